@@ -40,6 +40,16 @@ struct OpenFile {
 #define MAXOPEN		1024
 #define FILEVA		0xD0000000
 
+// With at least FS_PIN_NCPU CPUs, the file server keeps to the last
+// CPU (and the network server to the one before; see net/serv.c), so
+// that the block cache stays in that CPU's caches.  The price is that
+// clients on other CPUs can't hand the server their time slice with
+// sys_ipc_try_send's directed yield, which only switches to an env
+// allowed on the sender's CPU.  On smaller machines that costs more
+// than it gains, and the servers would take too many of the CPUs, so
+// the file server runs anywhere.
+#define FS_PIN_NCPU	4
+
 // initialize to force into data section
 struct OpenFile opentab[MAXOPEN] = {
 	{ 0, 0, 1, 0 }
@@ -349,10 +359,20 @@ serve(void)
 void
 umain(int argc, char **argv)
 {
+	int n, r;
+
 	static_assert(sizeof(struct File) == 256);
 	binaryname = "fs";
 	cprintf("FS is running\n");
 
+	// Clients block on us; don't let them wait behind batch jobs.
+	if ((r = sys_env_set_priority(0, ENV_PRIO_HIGHEST)) < 0)
+		panic("sys_env_set_priority: %e", r);
+
+	if ((n = sys_ncpu()) >= FS_PIN_NCPU
+	    && (r = sys_env_set_affinity(0, 1 << (n - 1))) < 0)
+		panic("sys_env_set_affinity: %e", r);
+
 	// Check that we are able to do I/O
 	outw(0x8A00, 0x8A00);
 	cprintf("FS can do I/O\n");
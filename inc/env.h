@@ -11,11 +11,11 @@ typedef int32_t envid_t;
 
 // An environment ID 'envid_t' has three parts:
 //
-// +1+---------------21-----------------+--------10--------+
-// |0|          Uniqueifier             |   Environment    |
-// | |                                  |      Index       |
-// +------------------------------------+------------------+
-//                                       \--- ENVX(eid) --/
+// +1+---------------18--------------+----------13---------+
+// |0|          Uniqueifier          |     Environment     |
+// | |                               |        Index        |
+// +---------------------------------+---------------------+
+//                                    \----- ENVX(eid) ---/
 //
 // The environment index ENVX(eid) equals the environment's offset in the
 // 'envs[]' array.  The uniqueifier distinguishes environments that were
@@ -24,11 +24,20 @@ typedef int32_t envid_t;
 // All real environments are greater than 0 (so the sign bit is zero).
 // envid_ts less than 0 signify errors.  The envid_t == 0 is special, and
 // stands for the current environment.
+//
+// NENV is the most environments there can be: envs[] fills the PTSIZE
+// window at UENVS.  The kernel grows the array a page at a time as
+// environments are created, so only the start of it is mapped; an
+// environment's slot is always mapped by the time its envid exists.
 
-#define LOG2NENV		10
+#define LOG2NENV		13
 #define NENV			(1 << LOG2NENV)
 #define ENVX(envid)		((envid) & (NENV - 1))
 
+// Each struct Env is padded to ENVSIZE bytes, so that a page of envs[]
+// holds a whole number of them.
+#define ENVSIZE			(PTSIZE / NENV)
+
 // Values of env_status in struct Env
 enum {
 	ENV_FREE = 0,
@@ -38,6 +47,32 @@ enum {
 	ENV_NOT_RUNNABLE
 };
 
+// Scheduling priority levels; lower levels are scheduled first.
+#define NENVPRIO		4
+#define ENV_PRIO_HIGHEST	0
+#define ENV_PRIO_LOWEST		(NENVPRIO - 1)
+// Passed to sys_env_set_priority to let the scheduler pick the level
+#define ENV_PRIO_DYNAMIC	(-1)
+
+// An env_cpumask that allows every CPU
+#define ENV_CPUMASK_ALL		0xffffffff
+
+// Buckets in the scheduler latency histograms.  Bucket 0 counts samples
+// shorter than 2^(SCHEDHIST_SHIFT+1) TSC cycles, bucket i > 0 those of
+// [2^(SCHEDHIST_SHIFT+i), 2^(SCHEDHIST_SHIFT+i+1)) cycles, and the last
+// bucket everything longer.
+#define NSCHEDHIST		20
+#define SCHEDHIST_SHIFT		10
+
+// Demand-zero regions (see sys_region_reserve).  The kernel maps a
+// zeroed page in a region the first time the environment touches it.
+#define NENVREGION		8
+struct EnvRegion {
+	uintptr_t er_start;		// First page of the region
+	uintptr_t er_end;		// End of the region; 0 if unused
+	int er_perm;			// Permissions of its pages
+};
+
 // Special environment types
 enum EnvType {
 	ENV_TYPE_USER = 0,
@@ -48,6 +83,7 @@ enum EnvType {
 struct Env {
 	struct Trapframe env_tf;	// Saved registers
 	struct Env *env_link;		// Next free Env
+	uint32_t env_index;		// Index in envs[]
 	envid_t env_id;			// Unique environment identifier
 	envid_t env_parent_id;		// env_id of this env's parent
 	enum EnvType env_type;		// Indicates special system environments
@@ -55,11 +91,28 @@ struct Env {
 	uint32_t env_runs;		// Number of times environment has run
 	int env_cpunum;			// The CPU that the env is running on
 
+	// Scheduling
+	struct Env *env_rq_next;	// Next env on the run queue
+	struct Env *env_rq_prev;	// Previous env on the run queue
+	int env_rq_cpu;			// CPU whose run queue holds the env, or -1
+	int env_priority;		// Current scheduling level
+	bool env_prio_pinned;		// Level set by sys_env_set_priority
+	int env_slice;			// Timer ticks left in the time slice
+	uint64_t env_last_run;		// TSC when the env was last switched to
+	uint32_t env_cpumask;		// Bit i set if the env may run on CPU i
+
+	// Scheduler statistics
+	uint64_t env_runnable_since;	// TSC when the env was last queued
+	uint32_t env_wait_hist[NSCHEDHIST]; // Time queued before running
+	uint32_t env_run_hist[NSCHEDHIST];  // Time run per switch-in
+
 	// Address space
 	pde_t *env_pgdir;		// Kernel virtual address of page dir
+	struct EnvRegion env_regions[NENVREGION]; // Demand-zero regions
 
 	// Exception handling
 	void *env_pgfault_upcall;	// Page fault upcall entry point
+	bool env_kernel_cow;		// Kernel resolves PTE_COW write faults
 
 	// Lab 4 IPC
 	bool env_ipc_recving;		// Env is blocked receiving
@@ -67,6 +120,6 @@ struct Env {
 	uint32_t env_ipc_value;		// Data value sent to us
 	envid_t env_ipc_from;		// envid of the sender
 	int env_ipc_perm;		// Perm of page mapping received
-};
+} __attribute__((__aligned__(ENVSIZE)));
 
 #endif // !JOS_INC_ENV_H
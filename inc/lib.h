@@ -48,16 +48,29 @@ void	sys_cputs(const char *string, size_t len);
 int	sys_cgetc(void);
 envid_t	sys_getenvid(void);
 int	sys_env_destroy(envid_t);
+envid_t	sys_env_find(enum EnvType type);
 void	sys_yield(void);
 static envid_t sys_exofork(void);
+envid_t	sys_fork_cow(void);
 int	sys_env_set_status(envid_t env, int status);
+int	sys_env_set_priority(envid_t env, int prio);
+int	sys_env_set_affinity(envid_t env, uint32_t mask);
+int	sys_ncpu(void);
 int	sys_env_set_trapframe(envid_t env, struct Trapframe *tf);
 int	sys_env_set_pgfault_upcall(envid_t env, void *upcall);
+int	sys_env_set_kernel_cow(envid_t env, int enable);
 int	sys_page_alloc(envid_t env, void *pg, int perm);
+int	sys_page_alloc_large(envid_t env, void *va, int perm);
 int	sys_page_map(envid_t src_env, void *src_pg,
 		     envid_t dst_env, void *dst_pg, int perm);
 int	sys_page_unmap(envid_t env, void *pg);
+int	sys_page_alloc_range(envid_t env, void *pg, size_t npages, int perm);
+int	sys_page_map_range(envid_t src_env, void *src_pg,
+			   envid_t dst_env, void *dst_pg, size_t npages, int perm);
+int	sys_page_unmap_range(envid_t env, void *pg, size_t npages);
+int	sys_region_reserve(envid_t env, void *va, size_t len, int perm);
 int	sys_ipc_try_send(envid_t to_env, uint32_t value, void *pg, int perm);
+int	sys_ipc_try_send_yield(envid_t to_env, uint32_t value, void *pg, int perm);
 int	sys_ipc_recv(void *rcv_pg);
 unsigned int sys_time_msec(void);
 int     sys_net_try_send(void *data, size_t size);
@@ -82,7 +95,6 @@ int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
 envid_t	ipc_find_env(enum EnvType type);
 
 // fork.c
-#define	PTE_SHARE	0x400
 envid_t	fork(void);
 envid_t	sfork(void);	// Challenge!
 
@@ -43,7 +43,9 @@
  *                     +------------------------------+                   |
  *                     :              .               :                   |
  *                     :              .               :                   |
- *    MMIOLIM ------>  +------------------------------+ 0xefc00000      --+
+ *                     +------------------------------+                   |
+ *                     |  Temporary High Mem. Maps    | RW/--             |
+ *    MMIOLIM,KMAPBASE +------------------------------+ 0xefc00000      --+
  *                     |       Memory-mapped I/O      | RW/--  PTSIZE
  * ULIM, MMIOBASE -->  +------------------------------+ 0xef800000
  *                     |  Cur. Page Table (User R-)   | R-/R-  PTSIZE
@@ -97,6 +99,13 @@
 #define KSTKSIZE	(8*PGSIZE)   		// size of a kernel stack
 #define KSTKGAP		(8*PGSIZE)   		// size of a kernel stack guard
 
+// Per-CPU temporary mappings of high memory, the physical pages above
+// the KERNBASE mapping (see kmap() in kern/pmap.c).  They take the
+// bottom of the PTSIZE region below KSTACKTOP, which the kernel stacks
+// don't reach; each CPU has KMAPSLOTS pages.
+#define KMAPBASE	(KSTACKTOP - PTSIZE)
+#define KMAPSLOTS	16
+
 // Memory-mapped IO.
 #define MMIOLIM		(KSTACKTOP - PTSIZE)
 #define MMIOBASE	(MMIOLIM - PTSIZE)
@@ -185,6 +194,13 @@ struct PageInfo {
 	// boot_alloc do not have valid reference count fields.
 
 	uint16_t pp_ref;
+
+	// If this page is the first page of a free block in the kernel's
+	// buddy allocator, the block's order (it is 2^pp_order pages
+	// long), and pp_prev is the previous block on the free list.
+	// Otherwise pp_order is -1.
+	int8_t pp_order;
+	struct PageInfo *pp_prev;
 };
 
 #endif /* !__ASSEMBLER__ */
@@ -7,15 +7,27 @@ enum {
 	SYS_cgetc,
 	SYS_getenvid,
 	SYS_env_destroy,
+	SYS_env_find,
 	SYS_page_alloc,
+	SYS_page_alloc_large,
 	SYS_page_map,
 	SYS_page_unmap,
+	SYS_page_alloc_range,
+	SYS_page_map_range,
+	SYS_page_unmap_range,
+	SYS_region_reserve,
 	SYS_exofork,
+	SYS_fork_cow,
 	SYS_env_set_status,
+	SYS_env_set_priority,
+	SYS_env_set_affinity,
+	SYS_ncpu,
 	SYS_env_set_trapframe,
 	SYS_env_set_pgfault_upcall,
+	SYS_env_set_kernel_cow,
 	SYS_yield,
 	SYS_ipc_try_send,
+	SYS_ipc_try_send_yield,
 	SYS_ipc_recv,
 	SYS_time_msec,
 	SYS_net_try_send,
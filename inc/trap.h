@@ -39,6 +39,11 @@
 #define IRQ_IDE         14
 #define IRQ_ERROR       19
 
+// Inter-processor interrupts.  These are sent between local APICs and
+// use vectors whose 8259A lines are never unmasked.
+#define IRQ_WAKEUP      10	// Wake a halted CPU to look for work
+#define IRQ_TLB         12	// Invalidate TLB entries (see tlb_shootdown)
+
 #ifndef __ASSEMBLER__
 
 #include <inc/types.h>
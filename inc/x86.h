@@ -293,4 +293,24 @@ xchg(volatile uint32_t *addr, uint32_t newval)
 	return result;
 }
 
+// Atomically add incr to *addr and return the old value of *addr.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t incr)
+{
+	uint32_t result = incr;
+
+	asm volatile("lock; xaddl %0, %1" :
+			"+r" (result), "+m" (*addr) :
+			: "cc", "memory");
+	return result;
+}
+
+// Full memory barrier: no load after it is performed before a store
+// ahead of it.  A locked instruction works on every CPU, unlike mfence.
+static inline void
+mb(void)
+{
+	asm volatile("lock; addl $0, 0(%%esp)" : : : "cc", "memory");
+}
+
 #endif /* !JOS_INC_X86_H */
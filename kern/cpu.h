@@ -17,12 +17,30 @@ enum {
 	CPU_HALTED,
 };
 
+// Per-CPU multi-level queue of ENV_RUNNABLE environments, linked
+// through env_rq_next and env_rq_prev (see kern/sched.c)
+struct RunQueue {
+	struct Env *rq_head[NENVPRIO];  // One FIFO per priority level
+	struct Env *rq_tail[NENVPRIO];
+	int rq_len;                     // Total number of queued envs
+	unsigned rq_ticks;              // Timer ticks since the last boost
+};
+
 // Per-CPU state
 struct CpuInfo {
 	uint8_t cpu_id;                 // Local APIC ID; index into cpus[] below
 	volatile unsigned cpu_status;   // The status of the CPU
 	struct Env *cpu_env;            // The currently-running environment.
 	struct Taskstate cpu_ts;        // Used by x86 to find stack for interrupt
+	struct RunQueue cpu_runq;       // Environments ready to run on this CPU
+	uint32_t cpu_steals;            // Envs this CPU took from other CPUs
+	uint32_t cpu_stolen;            // Envs other CPUs took from this one
+	uint32_t cpu_migrations;        // Envs run here that last ran elsewhere
+	struct PageInfo *cpu_free_pages; // Free pages cached by this CPU
+	int cpu_nfree_pages;            // Length of cpu_free_pages
+	uint32_t cpu_shootdowns;        // TLB shootdowns this CPU started
+	uint32_t cpu_shootdown_ipis;    // IPIs sent for them
+	int cpu_kmap_depth;             // kmap() slots in use on this CPU
 };
 
 // Initialized in mpconfig.c
@@ -42,5 +60,8 @@ void lapic_init(void);
 void lapic_startap(uint8_t apicid, uint32_t addr);
 void lapic_eoi(void);
 void lapic_ipi(int vector);
+void lapic_ipi_cpu(uint8_t apicid, int vector);
+void lapic_timer_start(void);
+void lapic_timer_stop(void);
 
 #endif
@@ -180,11 +180,36 @@ struct rx_desc
 
 volatile uint32_t *e1000;
 
-static struct tx_desc tx_descs[E1000_MAX_TDESC] __attribute__((aligned(16)));
-static uint8_t tx_pkts[E1000_MAX_TDESC][MAX_PACKET_SIZE];
+// The descriptor rings and packet buffers are physically contiguous
+// blocks from page_alloc_order(), allocated in e1000_attach().
+static struct tx_desc *tx_descs;
+static uint8_t (*tx_pkts)[MAX_PACKET_SIZE];
 
-static struct rx_desc rx_descs[E1000_MAX_RDESC] __attribute__((aligned(16)));
-static uint8_t rx_pkts[E1000_MAX_RDESC][MAX_BUFFER_SIZE];
+static struct rx_desc *rx_descs;
+static uint8_t (*rx_pkts)[MAX_BUFFER_SIZE];
+
+// Return the smallest order of a block of at least 'size' bytes.
+static int
+size_order(size_t size)
+{
+	int order = 0;
+
+	while ((PGSIZE << order) < size)
+		order++;
+	return order;
+}
+
+// Allocate a zeroed, physically contiguous block of at least 'size'
+// bytes, or return NULL.
+static void *
+e1000_alloc(size_t size)
+{
+	struct PageInfo *pp;
+
+	if (!(pp = page_alloc_order(size_order(size), ALLOC_ZERO)))
+		return NULL;
+	return page2kva(pp);
+}
 
 static uint32_t
 e1000_read_reg(uint32_t offset)
@@ -223,6 +248,14 @@ e1000_attach(struct pci_func *pcif)
 {
 	int i;
 
+	static_assert(E1000_MAX_TDESC * sizeof(struct tx_desc) +
+		      E1000_MAX_RDESC * sizeof(struct rx_desc) <= PGSIZE);
+	if (!(tx_descs = e1000_alloc(PGSIZE)) ||
+	    !(tx_pkts = e1000_alloc(E1000_MAX_TDESC * MAX_PACKET_SIZE)) ||
+	    !(rx_pkts = e1000_alloc(E1000_MAX_RDESC * MAX_BUFFER_SIZE)))
+		return -E_NO_MEM;
+	rx_descs = (struct rx_desc *) (tx_descs + E1000_MAX_TDESC);
+
         // Enable e1000 PCI device
 	pci_func_enable(pcif);
 
@@ -14,12 +14,32 @@
 #include <kern/sched.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
-
-struct Env *envs = NULL;		// All environments
+#include <kern/kmalloc.h>
+
+// The environment table.  It starts out empty and grows a page of
+// NENVPERPAGE environments at a time, whenever env_alloc() finds no
+// free environment, up to NENV.  env_pages[i] holds environments
+// [i * NENVPERPAGE, (i + 1) * NENVPERPAGE); the same page is mapped at
+// UENVS + i * PGSIZE, so user code sees them all as one envs[] array.
+// Pages are never taken away, so a struct Env stays valid for good.
+#define NENVPERPAGE	(PGSIZE / sizeof(struct Env))
+static struct Env *env_pages[NENV / NENVPERPAGE];
+static struct spinlock *env_page_locks[NENV / NENVPERPAGE];
+static volatile uint32_t env_nslots;	// Environments in env_pages
 static struct Env *env_free_list;	// Free environment list
 					// (linked by Env->env_link)
+static struct spinlock env_free_lock;	// Protects env_free_list and
+					// growing the table
+
+// Each environment's lock protects its address space (the page
+// tables under env_pgdir) and its IPC state (the env_ipc_* fields).
+// Scheduling state (env_status and the run queues) is still protected
+// by the big kernel lock.  Lock order: the big kernel lock, then an
+// environment's lock, then page_lock in kern/pmap.c.  Never hold two
+// environments' locks at once.  The locks of the environments in
+// env_pages[i] are env_page_locks[i][0 .. NENVPERPAGE).
 
-#define ENVGENSHIFT	12		// >= LOGNENV
+#define ENVGENSHIFT	LOG2NENV
 
 // Global descriptor table.
 //
@@ -88,8 +108,8 @@ envid2env(envid_t envid, struct Env **env_store, bool checkperm)
 	// to ensure that the envid is not stale
 	// (i.e., does not refer to a _previous_ environment
 	// that used the same slot in the envs[] array).
-	e = &envs[ENVX(envid)];
-	if (e->env_status == ENV_FREE || e->env_id != envid) {
+	e = env_slot(ENVX(envid));
+	if (!e || e->env_status == ENV_FREE || e->env_id != envid) {
 		*env_store = 0;
 		return -E_BAD_ENV;
 	}
@@ -108,29 +128,134 @@ envid2env(envid_t envid, struct Env **env_store, bool checkperm)
 	return 0;
 }
 
-// Mark all environments in 'envs' as free, set their env_ids to 0,
-// and insert them into the env_free_list.
-// Make sure the environments are in the free list in the same order
-// they are in the envs array (i.e., so that the first call to
-// env_alloc() returns envs[0]).
+static struct spinlock *
+env_lockp(struct Env *e)
+{
+	return &env_page_locks[e->env_index / NENVPERPAGE][e->env_index % NENVPERPAGE];
+}
+
+void
+env_lock(struct Env *e)
+{
+	spin_lock(env_lockp(e));
+}
+
+void
+env_unlock(struct Env *e)
+{
+	spin_unlock(env_lockp(e));
+}
+
+// Lock e, which envid2env returned for envid, and check that it is
+// still that environment: unless we hold its lock or the big kernel
+// lock, it may be freed, and its slot reused, at any time.
+//
+// RETURNS
+//   0 with e locked, or -E_BAD_ENV with e unlocked.
+//
+int
+env_lock_checked(struct Env *e, envid_t envid)
+{
+	env_lock(e);
+	if (e->env_status == ENV_FREE || (envid && e->env_id != envid)) {
+		env_unlock(e);
+		return -E_BAD_ENV;
+	}
+	return 0;
+}
+
+// Add a page of free environments to the table, mapped at the end of
+// envs[] for the user, and put them on env_free_list in the order they
+// are in the envs array (so that the first call to env_alloc() returns
+// envs[0]).  env_free_lock must be held.
 //
+// Returns 0 on success, -E_NO_FREE_ENV if the table has NENV
+// environments already, or -E_NO_MEM.
+//
+static int
+env_grow(void)
+{
+	struct PageInfo *pp;
+	struct Env *page;
+	struct spinlock *locks;
+	uint32_t n = env_nslots / NENVPERPAGE;
+	int i, r;
+
+	if (n == NENV / NENVPERPAGE)
+		return -E_NO_FREE_ENV;
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	if (!(locks = kmalloc(NENVPERPAGE * sizeof(*locks), 0))) {
+		page_free(pp);
+		return -E_NO_MEM;
+	}
+	// kern_pgdir and every env_pgdir share the page table at UENVS.
+	if ((r = page_insert(kern_pgdir, pp, (void *) (UENVS + n * PGSIZE), PTE_U|PTE_P)) < 0) {
+		kfree(locks);
+		page_free(pp);
+		return r;
+	}
+
+	page = page2kva(pp);
+	for (i = NENVPERPAGE - 1; i >= 0; i--) {
+		__spin_initlock(&locks[i], "env_lock");
+		page[i].env_index = env_nslots + i;
+		page[i].env_id = 0;
+		page[i].env_rq_cpu = -1;
+		page[i].env_link = env_free_list;
+		env_free_list = &page[i];
+	}
+	env_pages[n] = page;
+	env_page_locks[n] = locks;
+	// envid2env() reads env_pages without env_free_lock.
+	mb();
+	env_nslots += NENVPERPAGE;
+	return 0;
+}
+
+// Set up the first page of the environment table.
 void
 env_init(void)
 {
 	// Set up envs array
 	// LAB 3: Your code here.
-	int i;
+	static_assert(sizeof(struct Env) == ENVSIZE);
 
-	for (i =  NENV - 1; i >= 0; i--) {
-		envs[i].env_id = 0;
-		envs[i].env_link = env_free_list;
-		env_free_list = &envs[i];
-	}
+	spin_initlock(&env_free_lock);
+	spin_lock(&env_free_lock);
+	if (env_grow() < 0)
+		panic("env_init: out of memory");
+	spin_unlock(&env_free_lock);
 
 	// Per-CPU part of the initialization
 	env_init_percpu();
 }
 
+// Return the environment in slot 'index' of the table, whatever its
+// status, or NULL if the table doesn't reach that far.
+struct Env *
+env_slot(uint32_t index)
+{
+	if (index >= env_nslots)
+		return NULL;
+	return &env_pages[index / NENVPERPAGE][index % NENVPERPAGE];
+}
+
+// Return the id of the first environment of the given type, or 0 if
+// there is none.  Only the part of the table in use is searched.
+envid_t
+env_find(enum EnvType type)
+{
+	struct Env *e;
+	uint32_t i;
+
+	for (i = 0; (e = env_slot(i)); i++) {
+		if (e->env_status != ENV_FREE && e->env_type == type)
+			return e->env_id;
+	}
+	return 0;
+}
+
 // Load GDT and segment descriptors.
 void
 env_init_percpu(void)
@@ -216,18 +341,30 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	int r;
 	struct Env *e;
 
-	if (!(e = env_free_list))
-		return -E_NO_FREE_ENV;
+	spin_lock(&env_free_lock);
+	if (!env_free_list && (r = env_grow()) < 0) {
+		spin_unlock(&env_free_lock);
+		return r;
+	}
+	e = env_free_list;
+	env_free_list = e->env_link;
+	spin_unlock(&env_free_lock);
 
 	// Allocate and set up the page directory for this environment.
-	if ((r = env_setup_vm(e)) < 0)
+	if ((r = env_setup_vm(e)) < 0) {
+		spin_lock(&env_free_lock);
+		e->env_link = env_free_list;
+		env_free_list = e;
+		spin_unlock(&env_free_lock);
 		return r;
+	}
+	env_lock(e);
 
 	// Generate an env_id for this environment.
 	generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
 	if (generation <= 0)	// Don't create a negative env_id.
 		generation = 1 << ENVGENSHIFT;
-	e->env_id = generation | (e - envs);
+	e->env_id = generation | e->env_index;
 
 	// Set the basic status variables.
 	e->env_parent_id = parent_id;
@@ -235,6 +372,15 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	e->env_status = ENV_RUNNABLE;
 	e->env_runs = 0;
 
+	// New environments start at the top of the feedback scheduler.
+	e->env_priority = ENV_PRIO_HIGHEST;
+	e->env_prio_pinned = 0;
+	e->env_slice = SCHED_QUANTUM(ENV_PRIO_HIGHEST);
+	e->env_cpumask = ENV_CPUMASK_ALL;
+	memset(e->env_wait_hist, 0, sizeof(e->env_wait_hist));
+	memset(e->env_run_hist, 0, sizeof(e->env_run_hist));
+	memset(e->env_regions, 0, sizeof(e->env_regions));
+
 	// Clear out all the saved register state,
 	// to prevent the register values
 	// of a prior environment inhabiting this Env structure
@@ -262,14 +408,17 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 
 	// Clear the page fault handler until user installs one.
 	e->env_pgfault_upcall = 0;
+	e->env_kernel_cow = 0;
 
 	// Also clear the IPC receiving flag.
 	e->env_ipc_recving = 0;
 
-	// commit the allocation
-	env_free_list = e->env_link;
+	env_unlock(e);
 	*newenv_store = e;
 
+	// Make the new environment visible to the scheduler.
+	sched_enqueue(e);
+
 	cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 	return 0;
 }
@@ -303,7 +452,7 @@ region_alloc(struct Env *e, void *va, size_t len)
 		if (!pte)
 			panic("run out of physical memory to alloc a page table page");
 
-		p = page_alloc(0);
+		p = page_alloc(ALLOC_HIGH);
 		if (!p)
 			panic("run out of physical memory to alloc a page");
 
@@ -368,6 +517,8 @@ load_icode(struct Env *e, uint8_t *binary)
 	// LAB 3: Your code here.
 	struct Elf *elf;
 	struct Proghdr *ph, *eph;
+	uintptr_t va;
+	int r;
 
 	elf = (struct Elf*) binary;
 	if (elf->e_magic != ELF_MAGIC)
@@ -382,10 +533,15 @@ load_icode(struct Env *e, uint8_t *binary)
 		if (ph->p_type != ELF_PROG_LOAD)
 			continue;
 
-		region_alloc(e, (void *) ph->p_va, ph->p_memsz);
+		// Only the pages with file data are allocated now.  The
+		// rest of the segment is demand-zero.
+		va = ph->p_va + ph->p_filesz;
+		region_alloc(e, (void *) ph->p_va, ph->p_filesz);
 		memcpy((void *) ph->p_va, binary + ph->p_offset, ph->p_filesz);
-		if (ph->p_filesz < ph->p_memsz)
-			memset((void *) (ph->p_va + ph->p_filesz), 0, ph->p_memsz - ph->p_filesz);
+		memset((void *) va, 0, ROUNDUP(va, PGSIZE) - va);
+		if (ROUNDUP(va, PGSIZE) < ph->p_va + ph->p_memsz &&
+		    (r = env_region_add(e, ROUNDUP(va, PGSIZE), ROUNDUP(ph->p_va + ph->p_memsz, PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+			panic("load_icode: demand-zero region for segment: %e", r);
 	}
 
 	e->env_tf.tf_eip = elf->e_entry;
@@ -400,6 +556,109 @@ load_icode(struct Env *e, uint8_t *binary)
 	lcr3(PADDR(kern_pgdir));
 }
 
+//
+// Make [start, end) a demand-zero region of e, with permissions perm.
+// start and end are page-aligned, and the region doesn't overlap
+// another of e's regions.  A region that ends where another with the
+// same permissions starts is merged with it.  Regions are private:
+// fork and spawn copy the region, not the pages, so perm may not have
+// PTE_SHARE (nor PTE_COW).
+// The caller holds e's lock, unless nobody else can reach e yet.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if the region overlaps one of e's regions, or perm has
+//     PTE_SHARE or PTE_COW
+//   -E_NO_MEM, if e has NENVREGION regions already
+//
+int
+env_region_add(struct Env *e, uintptr_t start, uintptr_t end, int perm)
+{
+	struct EnvRegion *er, *free = NULL;
+
+	if (perm & (PTE_SHARE|PTE_COW))
+		return -E_INVAL;
+
+	for (er = e->env_regions; er < e->env_regions + NENVREGION; er++) {
+		if (!er->er_end) {
+			free = free ? free : er;
+			continue;
+		}
+		if (start < er->er_end && er->er_start < end)
+			return -E_INVAL;
+	}
+
+	for (er = e->env_regions; er < e->env_regions + NENVREGION; er++) {
+		if (!er->er_end || er->er_perm != perm)
+			continue;
+		if (er->er_end == start) {
+			er->er_end = end;
+			return 0;
+		}
+		if (er->er_start == end) {
+			er->er_start = start;
+			return 0;
+		}
+	}
+
+	if (!free)
+		return -E_NO_MEM;
+	free->er_start = start;
+	free->er_end = end;
+	free->er_perm = perm;
+	return 0;
+}
+
+//
+// If 'va' is in one of e's demand-zero regions and nothing is mapped
+// there, map a zeroed page at 'va'.  For a read ('write' false), that
+// is the shared zero_page, mapped PTE_COW instead of PTE_W, so it only
+// becomes a page of the environment's own on the first write (see
+// page_fault_cow).  The caller holds e's lock.
+//
+// RETURNS:
+//   0 on success
+//   -E_FAULT, if 'va' is not in a region, or is mapped already
+//   -E_NO_MEM, if there's no memory for the page
+//
+int
+env_region_fault(struct Env *e, uintptr_t va, bool write)
+{
+	struct EnvRegion *er;
+	struct PageInfo *p;
+	pte_t *pte;
+	int r, perm;
+
+	for (er = e->env_regions; er < e->env_regions + NENVREGION; er++)
+		if (er->er_start <= va && va < er->er_end)
+			break;
+	if (er == e->env_regions + NENVREGION)
+		return -E_FAULT;
+
+	pte = pgdir_walk(e->env_pgdir, (void *) va, 0);
+	if (pte && (*pte & PTE_P))
+		return -E_FAULT;
+
+	// A PTE_SHARE page must be a real page of its own from the
+	// start: a shared copy-on-write zero_page would be split on the
+	// first write.  (env_region_add refuses such regions anyway.)
+	if (!write && !(er->er_perm & PTE_SHARE)) {
+		perm = er->er_perm;
+		if (perm & PTE_W)
+			perm = (perm & ~PTE_W) | PTE_COW;
+		return page_insert(e->env_pgdir, zero_page, (void *) ROUNDDOWN(va, PGSIZE), perm);
+	}
+
+	p = page_alloc(ALLOC_ZERO|ALLOC_HIGH);
+	if (!p)
+		return -E_NO_MEM;
+	if ((r = page_insert(e->env_pgdir, p, (void *) ROUNDDOWN(va, PGSIZE), er->er_perm)) < 0) {
+		page_free(p);
+		return r;
+	}
+	return 0;
+}
+
 //
 // Allocates a new env with env_alloc, loads the named elf
 // binary into it with load_icode, and sets its env_type.
@@ -448,12 +707,19 @@ env_free(struct Env *e)
 
 	// Flush all mapped pages in the user portion of the address space
 	static_assert(UTOP % PTSIZE == 0);
+	env_lock(e);
 	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
 
 		// only look at mapped page tables
 		if (!(e->env_pgdir[pdeno] & PTE_P))
 			continue;
 
+		// 4MB pages have no page table
+		if (e->env_pgdir[pdeno] & PTE_PS) {
+			page_remove(e->env_pgdir, PGADDR(pdeno, 0, 0));
+			continue;
+		}
+
 		// find the pa and va of the page table
 		pa = PTE_ADDR(e->env_pgdir[pdeno]);
 		pt = (pte_t*) KADDR(pa);
@@ -475,9 +741,14 @@ env_free(struct Env *e)
 	page_decref(pa2page(pa));
 
 	// return the environment to the free list
+	sched_dequeue(e);
 	e->env_status = ENV_FREE;
+	env_unlock(e);
+
+	spin_lock(&env_free_lock);
 	e->env_link = env_free_list;
 	env_free_list = e;
+	spin_unlock(&env_free_lock);
 }
 
 //
@@ -499,6 +770,7 @@ env_destroy(struct Env *e)
 	env_free(e);
 
 	if (curenv == e) {
+		sched_account_run(e);
 		curenv = NULL;
 		sched_yield();
 	}
@@ -517,6 +789,10 @@ env_pop_tf(struct Trapframe *tf)
 	// Record the CPU we are running on for user-space debugging
 	curenv->env_cpunum = cpunum();
 
+	// Other CPUs must be done with addresses we unmapped before
+	// this CPU leaves the kernel.
+	tlb_shootdown();
+
 	__asm __volatile("movl %0,%%esp\n"
 		"\tpopal\n"
 		"\tpopl %%es\n"
@@ -555,8 +831,21 @@ env_run(struct Env *e)
 
 	// LAB 3: Your code here.
 	if (e) {
-		if (curenv && curenv->env_status == ENV_RUNNING)
+		if (curenv && curenv != e && curenv->env_status == ENV_RUNNING) {
 			curenv->env_status = ENV_RUNNABLE;
+			sched_enqueue(curenv);
+		}
+
+		sched_dequeue(e);
+		if (e->env_runs && e->env_cpunum != cpunum())
+			thiscpu->cpu_migrations++;
+
+		if (curenv != e) {
+			if (curenv)
+				sched_account_run(curenv);
+			sched_account_wait(e);
+			e->env_last_run = read_tsc();
+		}
 
 		curenv = e;
 		curenv->env_cpunum = cpunum();
@@ -6,7 +6,6 @@
 #include <inc/env.h>
 #include <kern/cpu.h>
 
-extern struct Env *envs;		// All environments
 #define curenv (thiscpu->cpu_env)		// Current environment
 extern struct Segdesc gdt[];
 
@@ -18,6 +17,13 @@ void	env_create(uint8_t *binary, enum EnvType type);
 void	env_destroy(struct Env *e);	// Does not return if e == curenv
 
 int	envid2env(envid_t envid, struct Env **env_store, bool checkperm);
+envid_t	env_find(enum EnvType type);
+struct Env *env_slot(uint32_t index);
+void	env_lock(struct Env *e);
+void	env_unlock(struct Env *e);
+int	env_lock_checked(struct Env *e, envid_t envid);
+int	env_region_add(struct Env *e, uintptr_t start, uintptr_t end, int perm);
+int	env_region_fault(struct Env *e, uintptr_t va, bool write);
 // The following two functions do not return
 void	env_run(struct Env *e) __attribute__((noreturn));
 void	env_pop_tf(struct Trapframe *tf) __attribute__((noreturn));
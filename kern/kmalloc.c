@@ -0,0 +1,327 @@
+// Slab allocator for small kernel objects.
+//
+// A KmemCache hands out objects of one size.  Objects are carved out of
+// one-page slabs taken from page_alloc(); each slab starts with a
+// KmemSlab header, so the slab (and the cache) an object belongs to is
+// found by rounding its address down to the page.  Free objects in a
+// slab are kept as a stack of indices in the header rather than a list
+// threaded through the objects, so objects stay exactly as the cache's
+// constructor left them.
+//
+// Each CPU keeps up to KMEM_CPU_MAX free objects of every cache for
+// itself, so most allocations and frees take no lock at all; the
+// cache lock is taken only to move KMEM_CPU_BATCH objects at a time
+// between a CPU and the slabs.
+//
+// kmalloc() and kfree() sit on top: requests up to KMALLOC_MAX bytes
+// come from one of the power-of-two "kmalloc-N" caches, and larger ones
+// get a block of pages of their own.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/string.h>
+
+#include <kern/kmalloc.h>
+#include <kern/pmap.h>
+
+struct KmemSlab {
+	struct KmemCache *sl_cache;	// Owning cache, or NULL for a kmalloc()
+					// page block
+	int sl_order;			// Block order when sl_cache is NULL
+	int sl_nfree;			// Entries in sl_freeidx
+	struct KmemSlab *sl_next;	// Links on the cache's kc_partial list
+	struct KmemSlab *sl_prev;
+	uint8_t sl_freeidx[];		// Indices of the free objects
+};
+
+// Objects begin this far into a kmalloc() page block, and are aligned to
+// this in a slab.
+#define KMEM_ALIGN	16
+
+static struct KmemCache kmem_cache_cache;	// The cache KmemCaches come from
+static struct KmemCache *kmem_caches;		// All caches
+static struct spinlock kmem_lock;		// Protects kmem_caches
+
+// kmalloc-16, kmalloc-32, ..., kmalloc-KMALLOC_MAX
+#define KMALLOC_NCLASS	7
+static struct KmemCache *kmalloc_caches[KMALLOC_NCLASS];
+static const char *kmalloc_names[KMALLOC_NCLASS] = {
+	"kmalloc-16", "kmalloc-32", "kmalloc-64", "kmalloc-128",
+	"kmalloc-256", "kmalloc-512", "kmalloc-1024",
+};
+
+static struct KmemSlab *
+obj2slab(void *obj)
+{
+	return (struct KmemSlab *) ROUNDDOWN(obj, PGSIZE);
+}
+
+// Offset of the first object in a slab holding n objects of kc's size
+static size_t
+kmem_offset(int n)
+{
+	return ROUNDUP(sizeof(struct KmemSlab) + n, KMEM_ALIGN);
+}
+
+static void *
+slab_obj(struct KmemCache *kc, struct KmemSlab *sl, int i)
+{
+	return (char *) sl + kmem_offset(kc->kc_perslab) + i * kc->kc_size;
+}
+
+static int
+slab_idx(struct KmemCache *kc, struct KmemSlab *sl, void *obj)
+{
+	return ((char *) obj - (char *) sl - kmem_offset(kc->kc_perslab))
+		/ kc->kc_size;
+}
+
+static void
+kmem_cache_init(struct KmemCache *kc, const char *name, size_t size,
+		void (*ctor)(void *))
+{
+	int n;
+
+	memset(kc, 0, sizeof(*kc));
+	kc->kc_name = name;
+	kc->kc_size = ROUNDUP(MAX(size, KMALLOC_MIN), 8);
+	kc->kc_ctor = ctor;
+	__spin_initlock(&kc->kc_lock, (char *) name);
+
+	// Fit as many objects as possible, with one index byte each.
+	n = (PGSIZE - sizeof(struct KmemSlab)) / (kc->kc_size + 1);
+	while (n > 0 && kmem_offset(n) + n * kc->kc_size > PGSIZE)
+		n--;
+	if (n <= 0 || n > 255)
+		panic("kmem_cache_init: bad object size %u for %s", size, name);
+	kc->kc_perslab = n;
+
+	spin_lock(&kmem_lock);
+	kc->kc_next = kmem_caches;
+	kmem_caches = kc;
+	spin_unlock(&kmem_lock);
+}
+
+// Set up the cache of caches and the kmalloc() size classes.
+void
+kmem_init(void)
+{
+	size_t size;
+	int i;
+
+	spin_initlock(&kmem_lock);
+	kmem_cache_init(&kmem_cache_cache, "kmem_cache",
+			sizeof(struct KmemCache), NULL);
+	for (i = 0, size = KMALLOC_MIN; size <= KMALLOC_MAX; i++, size <<= 1) {
+		assert(i < KMALLOC_NCLASS);
+		kmalloc_caches[i] = kmem_cache_create(kmalloc_names[i], size,
+						      NULL);
+		if (!kmalloc_caches[i])
+			panic("kmem_init: out of memory");
+	}
+}
+
+//
+// Create a cache of objects of 'size' bytes, called 'name' in the
+// monitor's kmemstat.  If ctor is not NULL, it is run on every object
+// once, when the slab holding it is allocated; objects must be in their
+// constructed state again when they are given back to
+// kmem_cache_free().
+//
+// Returns NULL if out of memory.  Caches are never destroyed.
+//
+struct KmemCache *
+kmem_cache_create(const char *name, size_t size, void (*ctor)(void *))
+{
+	struct KmemCache *kc;
+
+	if (!(kc = kmem_cache_alloc(&kmem_cache_cache)))
+		return NULL;
+	kmem_cache_init(kc, name, size, ctor);
+	return kc;
+}
+
+// Return the list of all caches, linked through kc_next.
+struct KmemCache *
+kmem_cache_list(void)
+{
+	return kmem_caches;
+}
+
+// Allocate a new slab for kc and put it on kc_partial.
+// kc->kc_lock must be held.
+static int
+kmem_cache_grow(struct KmemCache *kc)
+{
+	struct PageInfo *pp;
+	struct KmemSlab *sl;
+	int i;
+
+	if (!(pp = page_alloc(0)))
+		return -E_NO_MEM;
+	sl = page2kva(pp);
+	sl->sl_cache = kc;
+	sl->sl_order = 0;
+	sl->sl_nfree = kc->kc_perslab;
+	// Hand out the lowest addresses first.
+	for (i = 0; i < kc->kc_perslab; i++) {
+		sl->sl_freeidx[i] = kc->kc_perslab - 1 - i;
+		if (kc->kc_ctor)
+			kc->kc_ctor(slab_obj(kc, sl, i));
+	}
+
+	sl->sl_prev = NULL;
+	sl->sl_next = kc->kc_partial;
+	if (kc->kc_partial)
+		kc->kc_partial->sl_prev = sl;
+	kc->kc_partial = sl;
+	kc->kc_slabs++;
+	kc->kc_free += kc->kc_perslab;
+	return 0;
+}
+
+static void
+slab_unlink(struct KmemCache *kc, struct KmemSlab *sl)
+{
+	if (sl->sl_prev)
+		sl->sl_prev->sl_next = sl->sl_next;
+	else
+		kc->kc_partial = sl->sl_next;
+	if (sl->sl_next)
+		sl->sl_next->sl_prev = sl->sl_prev;
+}
+
+// Move up to KMEM_CPU_BATCH objects from kc's slabs to cc, which is
+// empty.  Returns -E_NO_MEM if none could be had.
+static int
+kmem_cache_refill(struct KmemCache *kc, struct KmemCpu *cc)
+{
+	struct KmemSlab *sl;
+
+	spin_lock(&kc->kc_lock);
+	while (cc->kc_nobjs < KMEM_CPU_BATCH) {
+		if (!kc->kc_partial && kmem_cache_grow(kc) < 0)
+			break;
+		sl = kc->kc_partial;
+		cc->kc_objs[cc->kc_nobjs++] =
+			slab_obj(kc, sl, sl->sl_freeidx[--sl->sl_nfree]);
+		kc->kc_free--;
+		if (sl->sl_nfree == 0)
+			slab_unlink(kc, sl);
+	}
+	spin_unlock(&kc->kc_lock);
+	cc->kc_refills++;
+	return cc->kc_nobjs ? 0 : -E_NO_MEM;
+}
+
+// Return the KMEM_CPU_BATCH least recently freed objects in cc, which
+// is full, to kc's slabs.  A slab left with no objects in use goes back
+// to the page allocator, unless it holds the cache's only free objects.
+static void
+kmem_cache_drain(struct KmemCache *kc, struct KmemCpu *cc)
+{
+	struct KmemSlab *sl;
+	void *obj;
+	int i;
+
+	spin_lock(&kc->kc_lock);
+	for (i = 0; i < KMEM_CPU_BATCH; i++) {
+		obj = cc->kc_objs[i];
+		sl = obj2slab(obj);
+		assert(sl->sl_cache == kc);
+		sl->sl_freeidx[sl->sl_nfree++] = slab_idx(kc, sl, obj);
+		kc->kc_free++;
+		if (sl->sl_nfree == 1) {
+			sl->sl_prev = NULL;
+			sl->sl_next = kc->kc_partial;
+			if (kc->kc_partial)
+				kc->kc_partial->sl_prev = sl;
+			kc->kc_partial = sl;
+		}
+		if (sl->sl_nfree == kc->kc_perslab
+		    && kc->kc_free > kc->kc_perslab) {
+			slab_unlink(kc, sl);
+			kc->kc_slabs--;
+			kc->kc_free -= kc->kc_perslab;
+			page_free(pa2page(PADDR(sl)));
+		}
+	}
+	spin_unlock(&kc->kc_lock);
+
+	cc->kc_nobjs -= KMEM_CPU_BATCH;
+	memmove(cc->kc_objs, cc->kc_objs + KMEM_CPU_BATCH,
+		cc->kc_nobjs * sizeof(cc->kc_objs[0]));
+}
+
+// Allocate an object from kc.  Returns NULL if out of memory.
+void *
+kmem_cache_alloc(struct KmemCache *kc)
+{
+	struct KmemCpu *cc = &kc->kc_cpu[cpunum()];
+
+	if (cc->kc_nobjs == 0 && kmem_cache_refill(kc, cc) < 0)
+		return NULL;
+	cc->kc_allocs++;
+	return cc->kc_objs[--cc->kc_nobjs];
+}
+
+// Give obj, which came from kmem_cache_alloc(kc), back to kc.
+void
+kmem_cache_free(struct KmemCache *kc, void *obj)
+{
+	struct KmemCpu *cc = &kc->kc_cpu[cpunum()];
+
+	if (cc->kc_nobjs == KMEM_CPU_MAX)
+		kmem_cache_drain(kc, cc);
+	cc->kc_objs[cc->kc_nobjs++] = obj;
+	cc->kc_frees++;
+}
+
+//
+// Allocate 'size' bytes of kernel memory, aligned to 16 bytes or to
+// the size class if that is smaller.  If (alloc_flags & ALLOC_ZERO),
+// the memory is zeroed.  Returns NULL if out of memory.
+//
+void *
+kmalloc(size_t size, int alloc_flags)
+{
+	struct PageInfo *pp;
+	struct KmemSlab *sl;
+	void *p;
+	int i, order;
+
+	if (size <= KMALLOC_MAX) {
+		for (i = 0; (KMALLOC_MIN << i) < size; i++)
+			;
+		if (!(p = kmem_cache_alloc(kmalloc_caches[i])))
+			return NULL;
+		if (alloc_flags & ALLOC_ZERO)
+			memset(p, 0, size);
+		return p;
+	}
+
+	for (order = 0; (PGSIZE << order) < size + KMEM_ALIGN; order++)
+		if (order == PAGE_MAX_ORDER)
+			return NULL;
+	if (!(pp = page_alloc_order(order, alloc_flags)))
+		return NULL;
+	sl = page2kva(pp);
+	sl->sl_cache = NULL;
+	sl->sl_order = order;
+	return (char *) sl + KMEM_ALIGN;
+}
+
+// Free memory returned by kmalloc().
+void
+kfree(void *p)
+{
+	struct KmemSlab *sl;
+
+	if (!p)
+		return;
+	sl = obj2slab(p);
+	if (sl->sl_cache)
+		kmem_cache_free(sl->sl_cache, p);
+	else
+		page_free_order(pa2page(PADDR(sl)), sl->sl_order);
+}
@@ -0,0 +1,56 @@
+#ifndef JOS_KERN_KMALLOC_H
+#define JOS_KERN_KMALLOC_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+
+// Objects each CPU keeps for itself in a cache, and how many are moved
+// between a CPU and the cache's slabs at a time.
+#define KMEM_CPU_MAX	16
+#define KMEM_CPU_BATCH	8
+
+// Smallest and largest kmalloc() size classes; larger requests get
+// whole pages.
+#define KMALLOC_MIN	16
+#define KMALLOC_MAX	1024
+
+struct KmemSlab;
+
+// Per-CPU part of a cache, touched only by its own CPU
+struct KmemCpu {
+	void *kc_objs[KMEM_CPU_MAX];	// Free objects, most recently freed last
+	int kc_nobjs;
+	uint32_t kc_allocs;		// Objects handed out by this CPU
+	uint32_t kc_frees;		// Objects given back on this CPU
+	uint32_t kc_refills;		// Times this CPU went to the slabs
+};
+
+// A cache of objects of one size, carved out of one-page slabs.
+struct KmemCache {
+	const char *kc_name;
+	size_t kc_size;			// Object size, rounded up for alignment
+	int kc_perslab;			// Objects in each slab
+	void (*kc_ctor)(void *);	// Run once on each object of a new slab
+	struct spinlock kc_lock;	// Protects the slab lists and counters below
+	struct KmemSlab *kc_partial;	// Slabs with free objects
+	uint32_t kc_slabs;		// Slabs allocated now
+	uint32_t kc_free;		// Free objects in the slabs
+	struct KmemCache *kc_next;	// Next cache on kmem_cache_list()
+	struct KmemCpu kc_cpu[NCPU];
+};
+
+void	kmem_init(void);
+struct KmemCache *kmem_cache_create(const char *name, size_t size,
+				    void (*ctor)(void *));
+void	*kmem_cache_alloc(struct KmemCache *kc);
+void	kmem_cache_free(struct KmemCache *kc, void *obj);
+struct KmemCache *kmem_cache_list(void);
+
+void	*kmalloc(size_t size, int alloc_flags);
+void	kfree(void *p);
+
+#endif // !JOS_KERN_KMALLOC_H
@@ -0,0 +1,291 @@
+// Same-page merging.
+//
+// Idle CPUs look through the environments' address spaces a page table
+// at a time for user pages that can't be written, hash their contents,
+// and point every mapping of identical contents at one shared physical
+// page, freeing the others.
+//
+// Only pages whose contents can never change again are merged: PTE_COW
+// pages, whose every mapping is copy-on-write, and read-only pages
+// with a single mapping.  Writable and PTE_SHARE pages are left alone,
+// and merged mappings keep their permissions, so a write to one is
+// still a copy-on-write fault that gives the environment its own copy.
+//
+// Each bucket of ksm_table holds either a hint, the environment and
+// address where a page with that hash was last seen, or a shared page.
+// A hint holds no reference, so that it doesn't stop a copy-on-write
+// fault from reusing a page that nobody else maps; it is checked again
+// under its environment's lock when another page with the same hash
+// turns up, and only then, if the contents match, do both mappings
+// become one shared page.  The table holds a reference to a shared page,
+// so it is never written in place by a copy-on-write fault.  A shared
+// page that nothing maps any more is dropped from the table by a later
+// scan.
+
+#include <inc/assert.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+
+#include <kern/ksm.h>
+#include <kern/env.h>
+#include <kern/pmap.h>
+
+#define KSM_NBUCKET	1024
+#define KSM_HASHES	32	// Pages hashed per ksm_scan(), at most
+#define KSM_SWEEP	16	// Buckets checked for unused pages per ksm_scan()
+
+struct KsmBucket {
+	uint32_t kb_hash;
+	struct PageInfo *kb_page;	// Shared page, or NULL
+	envid_t kb_envid;		// Without one, where a page with this
+	uintptr_t kb_va;		// hash was seen, if kb_envid != 0
+};
+
+// A page whose hash matched a bucket's hint, to be merged with the
+// hinted page once we have let go of the scanned environment's lock
+struct KsmMatch {
+	struct KsmBucket *km_bucket;
+	struct PageInfo *km_page;	// We hold a reference to it
+	envid_t km_envid;		// Where km_page is mapped
+	uintptr_t km_va;
+};
+
+// All of the following belong to whichever CPU set ksm_busy.
+static volatile uint32_t ksm_busy;
+static struct KsmBucket ksm_table[KSM_NBUCKET];
+static uint32_t ksm_env;	// Index of the environment being scanned
+static uintptr_t ksm_va;	// Where to carry on in it
+static uint32_t ksm_sweep;	// Next bucket to check
+static uint32_t ksm_scanned, ksm_merged;
+
+// FNV-1a, a word at a time
+static uint32_t
+ksm_hash(const uint32_t *p)
+{
+	uint32_t h = 2166136261U;
+	int i;
+
+	for (i = 0; i < PGSIZE / 4; i++)
+		h = (h ^ p[i]) * 16777619U;
+	return h;
+}
+
+// Drop shared pages that are no longer mapped anywhere.
+static void
+ksm_sweep_table(void)
+{
+	struct KsmBucket *b;
+	int i;
+
+	for (i = 0; i < KSM_SWEEP; i++) {
+		b = &ksm_table[ksm_sweep++ % KSM_NBUCKET];
+		// Only the table can map the page again, so it can't
+		// gain a reference behind our back.
+		if (b->kb_page && b->kb_page->pp_ref == 1) {
+			page_decref(b->kb_page);
+			b->kb_page = NULL;
+		}
+	}
+}
+
+// Can the page that *pte maps be merged?
+static bool
+ksm_candidate(pte_t *pte)
+{
+	struct PageInfo *pp;
+
+	if ((*pte & (PTE_P|PTE_U|PTE_W|PTE_SHARE)) != (PTE_P|PTE_U)
+	    || PGNUM(*pte) >= npages)
+		return 0;
+	pp = pa2page(PTE_ADDR(*pte));
+	return pp != zero_page && ((*pte & PTE_COW) || pp->pp_ref == 1);
+}
+
+// Merge the candidate page that *pte maps at va in e, if an identical
+// page is in the table.  Otherwise, if the bucket's hint has the same
+// hash, fill in *m and return 1, so that the caller stops and tries
+// ksm_promote(); or else make va the bucket's hint.  e must be locked.
+static bool
+ksm_merge(struct Env *e, uintptr_t va, pte_t *pte, struct KsmMatch *m)
+{
+	struct PageInfo *pp;
+	struct KsmBucket *b;
+	void *src, *dst;
+	uint32_t h;
+	bool same = 0;
+
+	pp = pa2page(PTE_ADDR(*pte));
+
+	src = kmap(pp);
+	h = ksm_hash(src);
+	ksm_scanned++;
+	b = &ksm_table[h % KSM_NBUCKET];
+	if (b->kb_page && b->kb_page != pp && b->kb_hash == h) {
+		dst = kmap(b->kb_page);
+		same = !memcmp(src, dst, PGSIZE);
+		kunmap(dst);
+	}
+	kunmap(src);
+
+	if (same) {
+		if (page_insert(e->env_pgdir, b->kb_page, (void *) va, *pte & PTE_SYSCALL) == 0)
+			ksm_merged++;
+		return 0;
+	}
+	if (b->kb_page) {
+		if (b->kb_page == pp || b->kb_page->pp_ref != 1)
+			return 0;
+		// Nothing maps the shared page any more.
+		page_decref(b->kb_page);
+		b->kb_page = NULL;
+	} else if (b->kb_envid && b->kb_hash == h
+		   && (b->kb_envid != e->env_id || b->kb_va != va)) {
+		page_incref(pp);
+		m->km_bucket = b;
+		m->km_page = pp;
+		m->km_envid = e->env_id;
+		m->km_va = va;
+		return 1;
+	}
+	b->kb_hash = h;
+	b->kb_envid = e->env_id;
+	b->kb_va = va;
+	return 0;
+}
+
+// Check m's bucket's hint under its environment's lock, and if it maps
+// a page identical to m->km_page, map m->km_page there instead and
+// make it the bucket's shared page.  Otherwise m->km_page becomes the
+// hint.  No environment may be locked.
+static void
+ksm_promote(struct KsmMatch *m)
+{
+	struct KsmBucket *b = m->km_bucket;
+	struct PageInfo *hp;
+	struct Env *he;
+	pte_t *pte;
+	void *src, *dst;
+	bool same = 0;
+
+	if (envid2env(b->kb_envid, &he, 0) == 0
+	    && env_lock_checked(he, b->kb_envid) == 0) {
+		pte = pgdir_walk(he->env_pgdir, (void *) b->kb_va, 0);
+		if (pte && ksm_candidate(pte)
+		    && (hp = pa2page(PTE_ADDR(*pte))) != m->km_page) {
+			src = kmap(m->km_page);
+			dst = kmap(hp);
+			same = !memcmp(src, dst, PGSIZE);
+			kunmap(dst);
+			kunmap(src);
+		}
+		if (same && page_insert(he->env_pgdir, m->km_page, (void *) b->kb_va, *pte & PTE_SYSCALL) == 0) {
+			ksm_merged++;
+			// Our reference becomes the table's.
+			b->kb_page = m->km_page;
+			b->kb_envid = 0;
+			m->km_page = NULL;
+		}
+		env_unlock(he);
+	}
+
+	if (m->km_page) {
+		b->kb_envid = m->km_envid;
+		b->kb_va = m->km_va;
+		page_decref(m->km_page);
+	}
+}
+
+// Scan on through e's address space from ksm_va, for at most one page
+// table's worth of PTEs or KSM_HASHES candidate pages, or until a page
+// matches a hint, which is then filled in *m.  e must be locked.
+// Returns 1 when e is done.
+static bool
+ksm_scan_env(struct Env *e, struct KsmMatch *m)
+{
+	pde_t pde;
+	pte_t *pte;
+	int examined = 0, hashed = 0;
+
+	while (ksm_va < UTOP && examined < NPTENTRIES && hashed < KSM_HASHES) {
+		pde = e->env_pgdir[PDX(ksm_va)];
+		if (!(pde & PTE_P) || (pde & PTE_PS)) {
+			ksm_va = ROUNDUP(ksm_va + 1, PTSIZE);
+			continue;
+		}
+		pte = (pte_t *) KADDR(PTE_ADDR(pde)) + PTX(ksm_va);
+		examined++;
+		if (ksm_candidate(pte)) {
+			hashed++;
+			if (ksm_merge(e, ksm_va, pte, m)) {
+				ksm_va += PGSIZE;
+				break;
+			}
+		}
+		ksm_va += PGSIZE;
+	}
+	return ksm_va >= UTOP;
+}
+
+//
+// Do a little merging.  Called by idle CPUs in sched_halt(), without
+// the big kernel lock; if another CPU is already scanning, returns at
+// once.
+//
+void
+ksm_scan(void)
+{
+	struct KsmMatch m;
+	struct Env *e;
+	bool done = 1;
+
+	if (xchg(&ksm_busy, 1))
+		return;
+
+	ksm_sweep_table();
+	if (!(e = env_slot(ksm_env))) {
+		ksm_env = 0;
+		e = env_slot(0);
+	}
+	m.km_bucket = NULL;
+	m.km_page = NULL;
+	// An environment that has never run may still be being built by
+	// sys_fork_cow, which fills in its page tables without its lock.
+	if (e && env_lock_checked(e, 0) == 0) {
+		if (e->env_runs > 0)
+			done = ksm_scan_env(e, &m);
+		env_unlock(e);
+	}
+	if (m.km_bucket)
+		ksm_promote(&m);
+	if (done) {
+		ksm_env++;
+		ksm_va = 0;
+	}
+
+	xchg(&ksm_busy, 0);
+
+	// Flush the replaced mappings from other CPUs' TLBs, so that the
+	// pages they mapped can be freed.
+	tlb_shootdown();
+}
+
+// Fill in *st with the merging counters.
+void
+ksm_stat(struct KsmStat *st)
+{
+	struct PageInfo *pp;
+	int i;
+
+	memset(st, 0, sizeof(*st));
+	st->scanned = ksm_scanned;
+	st->merged = ksm_merged;
+	for (i = 0; i < KSM_NBUCKET; i++) {
+		if (!(pp = ksm_table[i].kb_page))
+			continue;
+		st->pages++;
+		// One reference is the table's, and one mapping would
+		// need the page anyway.
+		if (pp->pp_ref > 2)
+			st->saved += pp->pp_ref - 2;
+	}
+}
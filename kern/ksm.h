@@ -0,0 +1,19 @@
+#ifndef JOS_KERN_KSM_H
+#define JOS_KERN_KSM_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct KsmStat {
+	uint32_t scanned;	// User pages hashed so far
+	uint32_t merged;	// Mappings switched to a shared page so far
+	uint32_t pages;		// Shared pages in the table now
+	uint32_t saved;		// Extra mappings of those pages: pages saved
+};
+
+void	ksm_scan(void);
+void	ksm_stat(struct KsmStat *st);
+
+#endif // !JOS_KERN_KSM_H
@@ -12,7 +12,11 @@
 #include <kern/monitor.h>
 #include <kern/kdebug.h>
 #include <kern/pmap.h>
+#include <kern/kmalloc.h>
+#include <kern/ksm.h>
 #include <kern/trap.h>
+#include <kern/sched.h>
+#include <kern/spinlock.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -33,6 +37,12 @@ static struct Command commands[] = {
 	{ "showvm", "Show virtual memory content", mon_showvm },
 	{ "continue", "Continue to run user env", mon_continue },
 	{ "stepinto", "Step into user env's next instruction", mon_stepinto },
+	{ "cpustat", "Display per-CPU run queue and load balancing counters", mon_cpustat },
+	{ "schedstat", "Display wait and run time histograms, overall or for one env", mon_schedstat },
+	{ "lockstat", "Display spinlock acquisition and contention counters", mon_lockstat },
+	{ "memstat", "Display free physical memory by block size", mon_memstat },
+	{ "kmemstat", "Display kernel object cache usage", mon_kmemstat },
+	{ "ksmstat", "Display same-page merging counters", mon_ksmstat },
 };
 #define NCOMMANDS (sizeof(commands)/sizeof(commands[0]))
 
@@ -144,6 +154,9 @@ mon_showmappings(int argc, char **argv, struct Trapframe *tf)
 		pte = pgdir_walk(pgdir, (void *) va, 0);
 		if (!pte || !(*pte & PTE_P)) {
 			cprintf("va 0x%x is not mapped\n", va);
+		} else if (*pte & PTE_PS) {
+			cprintf("va 0x%x 4MB ", va);
+			pte_show(*pte);
 		} else {
 			cprintf("va 0x%x ", va);
 			pte_show(*pte);
@@ -185,7 +198,7 @@ mon_modpageperms(int argc, char **argv, struct Trapframe *tf)
 
 	cprintf("va 0x%x existing pte ");
 	pte_show(*pte);
-	*pte = PTE_ADDR(*pte) | perms;
+	*pte = PTE_ADDR(*pte) | (*pte & PTE_PS) | perms;
 	cprintf("va 0x%x changed pte ");
 	pte_show(*pte);
 	return 0;
@@ -288,6 +301,192 @@ mon_stepinto(int argc, char **argv, struct Trapframe *tf)
 	env_run(curenv);
 }
 
+int
+mon_cpustat(int argc, char **argv, struct Trapframe *tf)
+{
+	struct CpuInfo *c;
+
+	if (argc != 1) {
+		cprintf("usage: cpustat\n");
+		return 0;
+	}
+
+	cprintf("cpu  queued  steals  stolen  migrations  shootdowns  ipis  env\n");
+	for (c = cpus; c < cpus + ncpu; c++)
+		cprintf("%3d  %6d  %6u  %6u  %10u  %10u  %4u  %08x\n", c - cpus,
+			c->cpu_runq.rq_len, c->cpu_steals, c->cpu_stolen,
+			c->cpu_migrations, c->cpu_shootdowns, c->cpu_shootdown_ipis,
+			c->cpu_env ? c->cpu_env->env_id : 0);
+	return 0;
+}
+
+int
+mon_schedstat(int argc, char **argv, struct Trapframe *tf)
+{
+	uint32_t *wait, *run;
+	envid_t envid;
+	struct Env *e;
+	char *end;
+	int i;
+
+	if (argc == 1) {
+		wait = sched_wait_hist;
+		run = sched_run_hist;
+	} else if (argc == 2) {
+		envid = strtol(argv[1], &end, 16);
+		if (*end || !envid || envid2env(envid, &e, 0) < 0) {
+			cprintf("schedstat: bad envid %s\n", argv[1]);
+			return 0;
+		}
+		wait = e->env_wait_hist;
+		run = e->env_run_hist;
+	} else {
+		cprintf("usage: schedstat [envid]\n");
+		return 0;
+	}
+
+	cprintf("TSC cycles >=        wait         run\n");
+	for (i = 0; i < NSCHEDHIST; i++) {
+		if (!wait[i] && !run[i])
+			continue;
+		cprintf("%13u  %10u  %10u\n",
+			i ? 1 << (SCHEDHIST_SHIFT + i) : 0, wait[i], run[i]);
+	}
+	return 0;
+}
+
+int
+mon_lockstat(int argc, char **argv, struct Trapframe *tf)
+{
+	struct spinlock *lk, *o;
+	uint32_t n, acquires, contended;
+	uint64_t spin, hold;
+
+	if (argc != 1) {
+		cprintf("usage: lockstat\n");
+		return 0;
+	}
+
+	cprintf("%-16s %5s %10s %10s %16s %12s\n", "lock", "locks",
+		"acquires", "contended", "spin cycles", "max hold");
+	for (lk = spin_lock_list(); lk; lk = lk->link) {
+		// Locks of the same name, like the per-env locks, are
+		// added up on one line, printed at the first of them.
+		for (o = spin_lock_list(); o->name != lk->name; o = o->link)
+			;
+		if (o != lk)
+			continue;
+
+		n = acquires = contended = 0;
+		spin = hold = 0;
+		for (; o; o = o->link) {
+			if (o->name != lk->name)
+				continue;
+			n++;
+			acquires += o->acquires;
+			contended += o->contended;
+			spin += o->spin_cycles;
+			if (o->max_hold > hold)
+				hold = o->max_hold;
+		}
+		cprintf("%-16s %5u %10u %10u %16llu %12llu\n", lk->name, n,
+			acquires, contended, spin, hold);
+	}
+	return 0;
+}
+
+int
+mon_memstat(int argc, char **argv, struct Trapframe *tf)
+{
+	uint32_t blocks[PAGE_MAX_ORDER + 1];
+	uint32_t free, cached, below;
+	struct CpuInfo *c;
+	struct PageZeroStat zs;
+	int order;
+
+	if (argc != 1) {
+		cprintf("usage: memstat\n");
+		return 0;
+	}
+
+	free = 0;
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+		blocks[order] = page_free_blocks(order);
+		free += blocks[order] << order;
+	}
+	cached = 0;
+	for (c = cpus; c < cpus + ncpu; c++)
+		cached += c->cpu_nfree_pages;
+
+	// 'unusable' is the share of free memory that is in blocks too
+	// small for an allocation of that order.
+	cprintf("order  free blocks  free pages  unusable\n");
+	below = 0;
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+		cprintf("%5d  %11u  %10u  %7u%%\n", order, blocks[order],
+			blocks[order] << order, free ? below * 100 / free : 0);
+		below += blocks[order] << order;
+	}
+	cprintf("%u pages free, %u more in per-CPU caches\n", free, cached);
+	if (npages > npages_lowmem)
+		cprintf("high memory: %u of %u pages free\n",
+			page_high_free_count(), npages - npages_lowmem);
+
+	page_zero_stat(&zs);
+	cprintf("zeroed pool: %u pages, %u filled, %u hits, %u misses (%u%% hit)\n",
+		zs.pages, zs.filled, zs.hits, zs.misses,
+		zs.hits + zs.misses ? zs.hits * 100 / (zs.hits + zs.misses) : 0);
+	return 0;
+}
+
+int
+mon_kmemstat(int argc, char **argv, struct Trapframe *tf)
+{
+	struct KmemCache *kc;
+	struct KmemCpu *cc;
+	uint32_t cached, allocs, frees, refills, inuse;
+
+	if (argc != 1) {
+		cprintf("usage: kmemstat\n");
+		return 0;
+	}
+
+	// Objects on the per-CPU lists are free but not in the slabs.
+	cprintf("%-16s %6s %6s %8s %8s %10s %10s %8s\n", "cache", "size",
+		"slabs", "in use", "cached", "allocs", "frees", "refills");
+	for (kc = kmem_cache_list(); kc; kc = kc->kc_next) {
+		cached = allocs = frees = refills = 0;
+		for (cc = kc->kc_cpu; cc < kc->kc_cpu + ncpu; cc++) {
+			cached += cc->kc_nobjs;
+			allocs += cc->kc_allocs;
+			frees += cc->kc_frees;
+			refills += cc->kc_refills;
+		}
+		inuse = kc->kc_slabs * kc->kc_perslab - kc->kc_free - cached;
+		cprintf("%-16s %6u %6u %8u %8u %10u %10u %8u\n", kc->kc_name,
+			kc->kc_size, kc->kc_slabs, inuse, cached, allocs,
+			frees, refills);
+	}
+	return 0;
+}
+
+int
+mon_ksmstat(int argc, char **argv, struct Trapframe *tf)
+{
+	struct KsmStat st;
+
+	if (argc != 1) {
+		cprintf("usage: ksmstat\n");
+		return 0;
+	}
+
+	ksm_stat(&st);
+	cprintf("%u pages hashed, %u mappings merged\n", st.scanned, st.merged);
+	cprintf("%u shared pages, %u pages (%uK) saved\n", st.pages, st.saved,
+		st.saved * (PGSIZE / 1024));
+	return 0;
+}
+
 /***** Kernel monitor command interpreter *****/
 
 #define WHITESPACE "\t\r\n "
@@ -20,5 +20,11 @@ int mon_modpageperms(int argc, char **argv, struct Trapframe *tf);
 int mon_showvm(int argc, char **argv, struct Trapframe *tf);
 int mon_continue(int argc, char **argv, struct Trapframe *tf);
 int mon_stepinto(int argc, char **argv, struct Trapframe *tf);
+int mon_cpustat(int argc, char **argv, struct Trapframe *tf);
+int mon_schedstat(int argc, char **argv, struct Trapframe *tf);
+int mon_lockstat(int argc, char **argv, struct Trapframe *tf);
+int mon_memstat(int argc, char **argv, struct Trapframe *tf);
+int mon_kmemstat(int argc, char **argv, struct Trapframe *tf);
+int mon_ksmstat(int argc, char **argv, struct Trapframe *tf);
 
 #endif	// !JOS_KERN_MONITOR_H
@@ -10,15 +10,105 @@
 #include <kern/kclock.h>
 #include <kern/env.h>
 #include <kern/cpu.h>
+#include <kern/spinlock.h>
+#include <kern/kmalloc.h>
 
 // These variables are set by i386_detect_memory()
 size_t npages;			// Amount of physical memory (in pages)
+size_t npages_lowmem;		// Pages below the end of the KERNBASE mapping
 static size_t npages_basemem;	// Amount of base memory (in pages)
 
 // These variables are set in mem_init()
 pde_t *kern_pgdir;		// Kernel's initial page directory
+bool page_pse;			// 4MB pages (CR4_PSE) are enabled
+static uint32_t kern_cr4;	// CR4 flags every CPU needs before kern_pgdir
+static uint32_t kern_pte_g;	// PTE_G if global pages are enabled
 struct PageInfo *pages;		// Physical page state array
+struct PageInfo *zero_page;	// Shared page of zeros (see env_region_fault)
 static struct PageInfo *page_free_list;	// Free list of physical pages
+// Protects page_free_list, the buddy allocator, and the pp_ref of every
+// page
+static struct spinlock page_lock = {
+	.name = "page_lock"
+};
+
+// Buddy allocator.  page_free_list is only used while booting: once
+// mem_init() is done checking it, page_buddy_init() moves every free
+// page into free_area[].  free_area[k] lists the free blocks of 2^k
+// physically contiguous pages, aligned to their size, through the
+// pp_link and pp_prev fields of their first page.  A block of order k
+// is split in two buddies of order k-1 to satisfy smaller requests,
+// and a freed block is merged with its buddy for as long as the buddy
+// is free too.
+static struct PageInfo *free_area[PAGE_MAX_ORDER + 1];
+static uint32_t free_area_len[PAGE_MAX_ORDER + 1];
+static bool page_buddy_ready;
+
+// High memory.  Pages from npages_lowmem up aren't in the KERNBASE
+// mapping, so the kernel can't use them for its own data.  They sit on
+// page_high_list (under page_lock) instead of in the buddy allocator,
+// and only page_alloc(ALLOC_HIGH) hands them out, for user pages that
+// the kernel reaches through its own page tables or kmap().  kmap()
+// maps a page in one of this CPU's KMAPSLOTS slots at KMAPBASE, whose
+// PTEs are kmap_ptes.
+static struct PageInfo *page_high_list;
+static uint32_t page_high_free;
+static pte_t *kmap_ptes;
+
+// Per-CPU page caches.  Each CPU keeps up to PAGE_CACHE_MAX free pages
+// on its own cpu_free_pages list, which it allocates from and frees to
+// without taking page_lock.  Pages move between the cache and the
+// buddy allocator PAGE_CACHE_BATCH at a time.  The cache is LIFO, so a
+// page freed on a CPU is the next one allocated there, while it is
+// still in that CPU's cache.
+#define PAGE_CACHE_MAX		64
+#define PAGE_CACHE_BATCH	32
+
+// Pre-zeroed page pool.  Before halting, an idle CPU zeroes up to
+// PAGE_ZERO_BATCH free pages into page_zero_list, which holds at most
+// PAGE_ZERO_MAX pages.  page_alloc(ALLOC_ZERO) takes from the pool
+// before zeroing a page itself, and any allocation falls back on the
+// pool when there's no other free page.  If there is high memory, the
+// pool is filled with high pages (through kmap()), since nearly all
+// ALLOC_ZERO allocations are user pages that ask for ALLOC_HIGH, and
+// only ALLOC_HIGH allocations take from it.
+#define PAGE_ZERO_MAX		256
+#define PAGE_ZERO_BATCH		16
+static struct spinlock page_zero_lock = {
+	.name = "page_zero_lock"
+};
+static struct PageInfo *page_zero_list;
+static struct PageZeroStat page_zero;
+static bool page_zero_nt;	// Zero with non-temporal stores
+static bool page_zero_high;	// The pool holds high pages
+
+// TLB shootdown.  tlb_invalidate() only flushes this CPU's TLB, but
+// other CPUs may be running the environment whose page table changed.
+// tlb_invalidate() records each such address in this CPU's batch, and
+// tlb_shootdown() later sends a single IRQ_TLB to each CPU concerned
+// and waits for all of them to work through the whole batch.  Until
+// then, those CPUs may still reach a page that was unmapped, so
+// page_remove() leaves the reference the mapping had to tlb_shootdown().
+// That goes for every reference, not just the last: page_fault_cow()
+// and ksm take pp_ref == 1 to mean that no other mapping can reach the
+// page.  tlb_shootdown() spins, so it is called with no lock held, on
+// the way out of the kernel (env_pop_tf() and sched_halt()).
+#define TLB_BATCH_MAX	16
+struct TlbRelease {
+	struct PageInfo *tr_page;	// Block of 2^tr_order pages
+	int tr_order;
+	struct TlbRelease *tr_next;
+};
+struct TlbBatch {
+	int tb_nva;			// > TLB_BATCH_MAX: flush everything
+	pde_t *tb_pgdir[TLB_BATCH_MAX];	// Page directory of each address
+	uintptr_t tb_va[TLB_BATCH_MAX];
+	uint32_t tb_cpus;		// CPUs to shoot down, by index
+	volatile uint32_t tb_request[NCPU];	// Set for each CPU asked
+	volatile uint32_t tb_waiting;	// CPUs that are not done yet
+	struct TlbRelease *tb_release;	// References to drop when done
+};
+static struct TlbBatch tlb_batch[NCPU];
 
 
 // --------------------------------------------------------------
@@ -34,24 +124,41 @@ nvram_read(int r)
 static void
 i386_detect_memory(void)
 {
-	size_t npages_extmem;
+	size_t npages_extmem, npages_ext16mem;
 
 	// Use CMOS calls to measure available base & extended memory.
-	// (CMOS calls return results in kilobytes.)
+	// (CMOS calls return results in kilobytes, except for memory
+	// above 16MB, which is in 64K units.)
 	npages_basemem = (nvram_read(NVRAM_BASELO) * 1024) / PGSIZE;
 	npages_extmem = (nvram_read(NVRAM_EXTLO) * 1024) / PGSIZE;
+	npages_ext16mem = nvram_read(NVRAM_EXT16LO) * (64 * 1024 / PGSIZE);
 
 	// Calculate the number of physical pages available in both base
 	// and extended memory.
-	if (npages_extmem)
+	if (npages_ext16mem)
+		npages = (16 * 1024 * 1024) / PGSIZE + npages_ext16mem;
+	else if (npages_extmem)
 		npages = (EXTPHYSMEM / PGSIZE) + npages_extmem;
 	else
 		npages = npages_basemem;
 
-	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
-		npages * PGSIZE / 1024,
+	// 'pages' is mapped for the user in the PTSIZE window at UPAGES,
+	// which bounds how much memory we can keep track of.
+	if (npages > PTSIZE / sizeof(struct PageInfo)) {
+		cprintf("Physical memory: only using the first %uK of %uK\n",
+			PTSIZE / sizeof(struct PageInfo) * (PGSIZE / 1024),
+			npages * (PGSIZE / 1024));
+		npages = PTSIZE / sizeof(struct PageInfo);
+	}
+	npages_lowmem = MIN(npages, (size_t) ((0xffffffff - KERNBASE + 1) / PGSIZE));
+	if (npages_lowmem > EXTPHYSMEM / PGSIZE)
+		npages_extmem = npages_lowmem - EXTPHYSMEM / PGSIZE;
+
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK, high = %uK\n",
+		npages * (PGSIZE / 1024),
 		npages_basemem * PGSIZE / 1024,
-		npages_extmem * PGSIZE / 1024);
+		npages_extmem * PGSIZE / 1024,
+		(npages - npages_lowmem) * (PGSIZE / 1024));
 }
 
 
@@ -61,6 +168,13 @@ i386_detect_memory(void)
 
 static void mem_init_mp(void);
 static void boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm);
+static void page_buddy_init(void);
+static void page_init_high(void);
+static void enable_cr4_features(void);
+static struct PageInfo *page_alloc_free(void);
+static struct PageInfo *page_alloc_high(void);
+static struct PageInfo *page_zero_pop(int alloc_flags, bool count);
+static void page_release(struct PageInfo *pp, int order);
 static void check_page_free_list(bool only_low_memory);
 static void check_page_alloc(void);
 static void check_kern_pgdir(void);
@@ -80,6 +194,10 @@ static void check_page_installed_pgdir(void);
 // If we're out of memory, boot_alloc should panic.
 // This function may ONLY be used during initialization,
 // before the page_free_list list has been set up.
+//
+// Until mem_init() loads kern_pgdir, only the first 4MB of physical
+// memory are mapped, so anything boot_alloc() returns beyond that must
+// be left alone until then.
 static void *
 boot_alloc(uint32_t n)
 {
@@ -107,7 +225,7 @@ boot_alloc(uint32_t n)
 	result = nextfree;
 	nextfree = ROUNDUP(nextfree + n, PGSIZE);
 
-	if ((uintptr_t) nextfree >= KERNBASE + PTSIZE)
+	if (PADDR(nextfree) > npages_lowmem * PGSIZE)
 		panic("run out of physical memory: nextfree 0x%8x", nextfree);
 
 	return result;
@@ -155,13 +273,13 @@ mem_init(void)
 	// array.  'npages' is the number of physical pages in memory.  Use memset
 	// to initialize all fields of each struct PageInfo to 0.
 	// Your code goes here:
+	//
+	// The entries for high memory may lie beyond the 4MB that are
+	// mapped for now; page_init_high() sets them up later.
 	pages = boot_alloc(npages * sizeof(struct PageInfo));
-	memset(pages, 0, npages * sizeof(struct PageInfo));
-
-	//////////////////////////////////////////////////////////////////////
-	// Make 'envs' point to an array of size 'NENV' of 'struct Env'.
-	// LAB 3: Your code here.
-	envs = boot_alloc(NENV * sizeof(struct Env));
+	if ((uintptr_t) (pages + npages_lowmem) > KERNBASE + PTSIZE)
+		panic("mem_init: pages array is past the entry mapping");
+	memset(pages, 0, npages_lowmem * sizeof(struct PageInfo));
 
 	//////////////////////////////////////////////////////////////////////
 	// Now that we've allocated the initial kernel data structures, we set
@@ -185,6 +303,12 @@ mem_init(void)
 	//      (ie. perm = PTE_U | PTE_P)
 	//    - pages itself -- kernel RW, user NONE
 	// Your code goes here:
+	// Use 4MB pages where boot_map_region() can, so the KERNBASE
+	// mapping below costs one TLB entry per 4MB instead of per page,
+	// and make the mappings global, so they survive the lcr3() in
+	// env_run().
+	enable_cr4_features();
+
 	boot_map_region(kern_pgdir, UPAGES, ROUNDUP(npages * sizeof(struct PageInfo), PGSIZE), PADDR(pages), PTE_U|PTE_P);
 
 	//////////////////////////////////////////////////////////////////////
@@ -194,7 +318,12 @@ mem_init(void)
 	//    - the new image at UENVS  -- kernel R, user R
 	//    - envs itself -- kernel RW, user NONE
 	// LAB 3: Your code here.
-	boot_map_region(kern_pgdir, UENVS, ROUNDUP(NENV * sizeof(struct Env), PGSIZE), PADDR(envs), PTE_U|PTE_P);
+	// The envs array grows as environments are created (see env_grow()
+	// in kern/env.c), so for now just make the page table at UENVS.
+	// Every env_pgdir shares it with kern_pgdir, and sees the pages
+	// that are mapped there later.
+	if (!pgdir_walk(kern_pgdir, (void *) UENVS, 1))
+		panic("mem_init: out of memory");
 
 	//////////////////////////////////////////////////////////////////////
 	// Use the physical memory that 'bootstack' refers to as the kernel
@@ -232,6 +361,7 @@ mem_init(void)
 	//
 	// If the machine reboots at this point, you've probably set up your
 	// kern_pgdir wrong.
+	lcr4(rcr4() | kern_cr4);
 	lcr3(PADDR(kern_pgdir));
 
 	check_page_free_list(0);
@@ -245,6 +375,42 @@ mem_init(void)
 
 	// Some more checks, only possible after kern_pgdir is installed.
 	check_page_installed_pgdir();
+
+	page_init_high();
+	page_buddy_init();
+
+	// Read faults in demand-zero regions map this one page, copy-on-
+	// write.  Its extra reference keeps it from ever being freed.
+	if (!(zero_page = page_alloc(ALLOC_ZERO)))
+		panic("mem_init: out of memory");
+	zero_page->pp_ref++;
+}
+
+// Turn on 4MB pages and global pages if the CPU has them, and note
+// whether it can zero pages with movnti.
+static void
+enable_cr4_features(void)
+{
+	uint32_t edx;
+
+	cpuid(1, NULL, NULL, NULL, &edx);
+	page_zero_nt = !!(edx & CPUID_SSE2);
+	if (edx & CPUID_PSE) {
+		kern_cr4 |= CR4_PSE;
+		page_pse = 1;
+	}
+	if (edx & CPUID_PGE) {
+		kern_cr4 |= CR4_PGE;
+		kern_pte_g = PTE_G;
+	}
+}
+
+// Called by each AP to switch from entry_pgdir to kern_pgdir.
+void
+mem_init_percpu(void)
+{
+	lcr4(rcr4() | kern_cr4);
+	lcr3(PADDR(kern_pgdir));
 }
 
 // Modify mappings in kern_pgdir to support SMP
@@ -274,6 +440,11 @@ mem_init_mp(void)
 	for (i = 0; i < NCPU; i++) {
 		boot_map_region(kern_pgdir, KSTACKTOP - i * (KSTKSIZE + KSTKGAP) - KSTKSIZE, KSTKSIZE, PADDR(percpu_kstacks[i]), PTE_W|PTE_P);
 	}
+
+	// Make the page table for the kmap() slots, below the stacks.
+	static_assert(NCPU * (KMAPSLOTS * PGSIZE + KSTKSIZE + KSTKGAP) <= PTSIZE);
+	if (!(kmap_ptes = pgdir_walk(kern_pgdir, (void *) KMAPBASE, 1)))
+		panic("mem_init_mp: out of memory");
 }
 
 // --------------------------------------------------------------
@@ -317,7 +488,8 @@ page_init(void)
 	size_t i;
 
 	nextfree = (uintptr_t) boot_alloc(0);
-	for (i = 0; i < npages; i++) {
+	for (i = 0; i < npages_lowmem; i++) {
+		pages[i].pp_order = -1;
 		if (!i) continue;
 
 		pa = page2pa(&pages[i]);
@@ -336,6 +508,170 @@ page_init(void)
 	}
 }
 
+// Put block pp of the given order on its free list.
+static void
+buddy_push(struct PageInfo *pp, int order)
+{
+	pp->pp_order = order;
+	pp->pp_prev = NULL;
+	pp->pp_link = free_area[order];
+	if (free_area[order])
+		free_area[order]->pp_prev = pp;
+	free_area[order] = pp;
+	free_area_len[order]++;
+}
+
+// Take free block pp off its free list.
+static void
+buddy_remove(struct PageInfo *pp)
+{
+	int order = pp->pp_order;
+
+	if (pp->pp_prev)
+		pp->pp_prev->pp_link = pp->pp_link;
+	else
+		free_area[order] = pp->pp_link;
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp->pp_prev;
+	free_area_len[order]--;
+	pp->pp_order = -1;
+	pp->pp_link = pp->pp_prev = NULL;
+}
+
+// Allocate a block of 2^order pages, splitting a larger block if there
+// is no free block of that order.  Returns NULL if there is no block
+// large enough.  Called with page_lock held.
+static struct PageInfo *
+buddy_alloc(int order)
+{
+	struct PageInfo *pp;
+	int k;
+
+	for (k = order; k <= PAGE_MAX_ORDER && !free_area[k]; k++)
+		;
+	if (k > PAGE_MAX_ORDER)
+		return NULL;
+
+	pp = free_area[k];
+	buddy_remove(pp);
+	// Give back the upper half of the block until it is small enough.
+	while (k > order) {
+		k--;
+		buddy_push(pp + (1 << k), k);
+	}
+	return pp;
+}
+
+// Free the block of 2^order pages starting at pp, merging it with its
+// buddy while that is free.  Called with page_lock held.
+static void
+buddy_free(struct PageInfo *pp, int order)
+{
+	size_t pfn = pp - pages, buddy;
+
+	while (order < PAGE_MAX_ORDER) {
+		buddy = pfn ^ (1 << order);
+		if (buddy >= npages_lowmem || pages[buddy].pp_order != order)
+			break;
+		buddy_remove(&pages[buddy]);
+		pfn &= ~(1 << order);
+		order++;
+	}
+	buddy_push(&pages[pfn], order);
+}
+
+// Hand every page on page_free_list over to the buddy allocator.
+static void
+page_buddy_init(void)
+{
+	struct PageInfo *pp;
+
+	spin_lock(&page_lock);
+	while ((pp = page_free_list)) {
+		page_free_list = pp->pp_link;
+		pp->pp_link = NULL;
+		buddy_free(pp, 0);
+	}
+	page_buddy_ready = 1;
+	spin_unlock(&page_lock);
+}
+
+// Set up the 'pages' entries for high memory, which page_init() leaves
+// alone, and put every high page on page_high_list.  Called once
+// kern_pgdir maps all of 'pages'.
+static void
+page_init_high(void)
+{
+	size_t i;
+
+	memset(pages + npages_lowmem, 0,
+	       (npages - npages_lowmem) * sizeof(struct PageInfo));
+	spin_lock(&page_lock);
+	for (i = npages; i-- > npages_lowmem; ) {
+		pages[i].pp_order = -1;
+		pages[i].pp_link = page_high_list;
+		page_high_list = &pages[i];
+		page_high_free++;
+	}
+	spin_unlock(&page_lock);
+	page_zero_high = (npages > npages_lowmem);
+}
+
+// Return the number of free pages in high memory.
+uint32_t
+page_high_free_count(void)
+{
+	return page_high_free;
+}
+
+// Return the number of free blocks of 2^order pages, not counting the
+// pages in the per-CPU caches.
+uint32_t
+page_free_blocks(int order)
+{
+	return free_area_len[order];
+}
+
+// Move up to PAGE_CACHE_BATCH pages from the buddy allocator to c's
+// cache, which is empty.
+static void
+page_cache_refill(struct CpuInfo *c)
+{
+	struct PageInfo *pp;
+
+	spin_lock(&page_lock);
+	while (c->cpu_nfree_pages < PAGE_CACHE_BATCH && (pp = buddy_alloc(0))) {
+		pp->pp_link = c->cpu_free_pages;
+		c->cpu_free_pages = pp;
+		c->cpu_nfree_pages++;
+	}
+	spin_unlock(&page_lock);
+}
+
+// Return the PAGE_CACHE_BATCH least recently freed pages in c's cache to
+// the buddy allocator.
+static void
+page_cache_drain(struct CpuInfo *c)
+{
+	struct PageInfo *keep, *pp, *next;
+	int n;
+
+	keep = c->cpu_free_pages;
+	for (n = 1; n < c->cpu_nfree_pages - PAGE_CACHE_BATCH; n++)
+		keep = keep->pp_link;
+	pp = keep->pp_link;
+	keep->pp_link = NULL;
+	c->cpu_nfree_pages -= PAGE_CACHE_BATCH;
+
+	spin_lock(&page_lock);
+	for (; pp; pp = next) {
+		next = pp->pp_link;
+		pp->pp_link = NULL;
+		buddy_free(pp, 0);
+	}
+	spin_unlock(&page_lock);
+}
+
 //
 // Allocates a physical page.  If (alloc_flags & ALLOC_ZERO), fills the entire
 // returned physical page with '\0' bytes.  Does NOT increment the reference
@@ -353,19 +689,165 @@ page_alloc(int alloc_flags)
 {
 	// Fill this function in
 	struct PageInfo *pp;
+	void *va;
 
-	if (!page_free_list)
-		return NULL;
+	if ((alloc_flags & ALLOC_ZERO) && (pp = page_zero_pop(alloc_flags, 1)))
+		return pp;
+
+	if ((alloc_flags & ALLOC_HIGH) && (pp = page_alloc_high())) {
+		if (alloc_flags & ALLOC_ZERO) {
+			va = kmap(pp);
+			memset(va, 0, PGSIZE);
+			kunmap(va);
+		}
+		return pp;
+	}
 
-	pp = page_free_list;
-	page_free_list = pp->pp_link;
-	pp->pp_link = NULL;
+	pp = page_alloc_free();
+	if (!pp)
+		return page_zero_pop(alloc_flags, 0);
 
 	if (alloc_flags & ALLOC_ZERO)
 		memset(page2kva(pp), 0, PGSIZE);
 	return pp;
 }
 
+// Take a page from this CPU's cache (or, while booting, from
+// page_free_list), without zeroing it.
+static struct PageInfo *
+page_alloc_free(void)
+{
+	struct PageInfo *pp;
+	struct CpuInfo *c = thiscpu;
+
+	if (page_buddy_ready) {
+		if (!c->cpu_free_pages)
+			page_cache_refill(c);
+		pp = c->cpu_free_pages;
+		if (pp) {
+			c->cpu_free_pages = pp->pp_link;
+			c->cpu_nfree_pages--;
+		}
+	} else {
+		spin_lock(&page_lock);
+		pp = page_free_list;
+		if (pp)
+			page_free_list = pp->pp_link;
+		spin_unlock(&page_lock);
+	}
+
+	if (pp)
+		pp->pp_link = NULL;
+	return pp;
+}
+
+// Take a high page from page_high_list, without zeroing it.
+static struct PageInfo *
+page_alloc_high(void)
+{
+	struct PageInfo *pp;
+
+	spin_lock(&page_lock);
+	if ((pp = page_high_list)) {
+		page_high_list = pp->pp_link;
+		page_high_free--;
+	}
+	spin_unlock(&page_lock);
+
+	if (pp)
+		pp->pp_link = NULL;
+	return pp;
+}
+
+// Take a page from the pre-zeroed pool for page_alloc(alloc_flags).
+// If 'count', this is an ALLOC_ZERO allocation, and counts as a pool
+// hit or miss.
+static struct PageInfo *
+page_zero_pop(int alloc_flags, bool count)
+{
+	struct PageInfo *pp;
+
+	if (page_zero_high && !(alloc_flags & ALLOC_HIGH))
+		return NULL;
+
+	spin_lock(&page_zero_lock);
+	pp = page_zero_list;
+	if (pp) {
+		page_zero_list = pp->pp_link;
+		page_zero.pages--;
+	}
+	if (count && pp)
+		page_zero.hits++;
+	else if (count)
+		page_zero.misses++;
+	spin_unlock(&page_zero_lock);
+
+	if (pp)
+		pp->pp_link = NULL;
+	return pp;
+}
+
+// Zero a page with non-temporal stores, which bypass the cache: the
+// idle CPU doing it shouldn't evict anything, and whoever gets the
+// page may not touch all of it soon.
+static void
+page_zero_page(void *va)
+{
+	uint32_t *p, *end;
+
+	if (!page_zero_nt) {
+		memset(va, 0, PGSIZE);
+		return;
+	}
+	end = (uint32_t *) (va + PGSIZE);
+	for (p = va; p < end; p += 4)
+		asm volatile("movnti %1, 0(%0)\n\t"
+			     "movnti %1, 4(%0)\n\t"
+			     "movnti %1, 8(%0)\n\t"
+			     "movnti %1, 12(%0)"
+			     : : "r" (p), "r" (0) : "memory");
+	asm volatile("sfence" : : : "memory");
+}
+
+//
+// Zero up to PAGE_ZERO_BATCH free pages into the pre-zeroed pool.
+// Called by idle CPUs in sched_halt(), without the big kernel lock.
+//
+void
+page_zero_fill(void)
+{
+	struct PageInfo *pp;
+	void *va;
+	int i;
+
+	if (!page_buddy_ready)
+		return;
+
+	for (i = 0; i < PAGE_ZERO_BATCH && page_zero.pages < PAGE_ZERO_MAX; i++) {
+		if (!(pp = page_zero_high ? page_alloc_high() : page_alloc_free()))
+			break;
+		va = kmap(pp);
+		page_zero_page(va);
+		kunmap(va);
+
+		spin_lock(&page_zero_lock);
+		pp->pp_link = page_zero_list;
+		page_zero_list = pp;
+		page_zero.pages++;
+		page_zero.filled++;
+		spin_unlock(&page_zero_lock);
+	}
+}
+
+// Copy out the pre-zeroed pool's counters.
+void
+page_zero_stat(struct PageZeroStat *st)
+{
+	spin_lock(&page_zero_lock);
+	*st = page_zero;
+	spin_unlock(&page_zero_lock);
+}
+
 //
 // Return a page to the free list.
 // (This function should only be called when pp->pp_ref reaches 0.)
@@ -373,14 +855,96 @@ page_alloc(int alloc_flags)
 void
 page_free(struct PageInfo *pp)
 {
+	struct CpuInfo *c;
+
 	// Fill this function in
 	// Hint: You may want to panic if pp->pp_ref is nonzero or
 	// pp->pp_link is not NULL.
-	if (pp->pp_ref || pp->pp_link)
+	if (pp->pp_ref || pp->pp_link || pp->pp_order >= 0)
 		panic("page is not ready to be freed: pp_ref %d pp_link %p", pp->pp_ref, pp->pp_link);
 
+	if (PGNUM(page2pa(pp)) >= npages_lowmem) {
+		spin_lock(&page_lock);
+		pp->pp_link = page_high_list;
+		page_high_list = pp;
+		page_high_free++;
+		spin_unlock(&page_lock);
+		return;
+	}
+
+	if (page_buddy_ready) {
+		c = thiscpu;
+		pp->pp_link = c->cpu_free_pages;
+		c->cpu_free_pages = pp;
+		if (++c->cpu_nfree_pages > PAGE_CACHE_MAX)
+			page_cache_drain(c);
+		return;
+	}
+
+	spin_lock(&page_lock);
 	pp->pp_link = page_free_list;
 	page_free_list = pp;
+	spin_unlock(&page_lock);
+}
+
+//
+// Allocates 2^order physically contiguous pages, aligned to their size,
+// and returns the first.  Like page_alloc(), which is the same as
+// page_alloc_order(0, alloc_flags), this zeroes the pages if
+// (alloc_flags & ALLOC_ZERO) and doesn't touch their reference counts.
+// The pages must be freed all together, with page_free_order().
+//
+// Returns NULL if there is no free block that large, or if order is
+// out of range.
+//
+struct PageInfo *
+page_alloc_order(int order, int alloc_flags)
+{
+	struct PageInfo *pp;
+
+	if (order == 0)
+		return page_alloc(alloc_flags);
+	if (order < 0 || order > PAGE_MAX_ORDER || !page_buddy_ready)
+		return NULL;
+
+	spin_lock(&page_lock);
+	pp = buddy_alloc(order);
+	spin_unlock(&page_lock);
+
+	if (pp && (alloc_flags & ALLOC_ZERO))
+		memset(page2kva(pp), 0, PGSIZE << order);
+	return pp;
+}
+
+//
+// Frees 2^order pages allocated by page_alloc_order().  pp's reference
+// count must be zero.
+//
+void
+page_free_order(struct PageInfo *pp, int order)
+{
+	if (order == 0) {
+		page_free(pp);
+		return;
+	}
+
+	if (pp->pp_ref || pp->pp_link || pp->pp_order >= 0)
+		panic("pages are not ready to be freed: pp_ref %d pp_link %p", pp->pp_ref, pp->pp_link);
+
+	spin_lock(&page_lock);
+	buddy_free(pp, order);
+	spin_unlock(&page_lock);
+}
+
+//
+// Increment the reference count on a page.
+//
+void
+page_incref(struct PageInfo *pp)
+{
+	spin_lock(&page_lock);
+	pp->pp_ref++;
+	spin_unlock(&page_lock);
 }
 
 //
@@ -390,8 +954,70 @@ page_free(struct PageInfo *pp)
 void
 page_decref(struct PageInfo* pp)
 {
-	if (--pp->pp_ref == 0)
-		page_free(pp);
+	page_decref_order(pp, 0);
+}
+
+//
+// Same as page_decref(), for a block from page_alloc_order(), whose
+// reference count is kept in its first page.
+//
+void
+page_decref_order(struct PageInfo *pp, int order)
+{
+	bool last;
+
+	spin_lock(&page_lock);
+	last = (--pp->pp_ref == 0);
+	spin_unlock(&page_lock);
+
+	if (last)
+		page_free_order(pp, order);
+}
+
+//
+// Return a kernel virtual address for the page pp.  For a page in low
+// memory that is page2kva(pp); a high memory page is mapped in the
+// next free kmap slot of this CPU.  Mappings must be undone with
+// kunmap(), in the reverse order, before the kernel returns to user
+// mode.  The slots are private to the CPU, so no other CPU's TLB ever
+// needs flushing.
+//
+void *
+kmap(struct PageInfo *pp)
+{
+	struct CpuInfo *c;
+	int slot;
+
+	if (PGNUM(page2pa(pp)) < npages_lowmem)
+		return page2kva(pp);
+
+	c = thiscpu;
+	if (c->cpu_kmap_depth == KMAPSLOTS)
+		panic("kmap: out of slots");
+	slot = cpunum() * KMAPSLOTS + c->cpu_kmap_depth++;
+	kmap_ptes[slot] = page2pa(pp) | PTE_W | PTE_P;
+	return (void *) (KMAPBASE + slot * PGSIZE);
+}
+
+//
+// Undo the kmap() that returned va.
+//
+void
+kunmap(void *va)
+{
+	struct CpuInfo *c;
+	int slot;
+
+	if ((uintptr_t) va >= KERNBASE)
+		return;
+
+	c = thiscpu;
+	slot = ((uintptr_t) va - KMAPBASE) / PGSIZE;
+	if (slot != cpunum() * KMAPSLOTS + c->cpu_kmap_depth - 1)
+		panic("kunmap: %08x is not the last kmap", va);
+	c->cpu_kmap_depth--;
+	kmap_ptes[slot] = 0;
+	invlpg(va);
 }
 
 // Given 'pgdir', a pointer to a page directory, pgdir_walk returns
@@ -416,6 +1042,10 @@ page_decref(struct PageInfo* pp)
 // Hint 3: look at inc/mmu.h for useful macros that mainipulate page
 // table and page directory entries.
 //
+// If 'va' is covered by a 4MB (PTE_PS) mapping, there is no page table:
+// pgdir_walk returns a pointer to the page directory entry itself,
+// whatever 'create' is.  Callers that care check for PTE_PS.
+//
 pte_t *
 pgdir_walk(pde_t *pgdir, const void *va, int create)
 {
@@ -437,6 +1067,9 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 		*pde = page2pa(pp)|(PTE_U|PTE_P|PTE_W);
 	}
 
+	if (*pde & PTE_PS)
+		return pde;
+
 	pt = (pte_t *) (KADDR(PTE_ADDR(*pde)));
 	return &pt[PTX(va)];
 }
@@ -451,6 +1084,11 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 // above UTOP. As such, it should *not* change the pp_ref field on the
 // mapped pages.
 //
+// If 4MB pages are enabled, every 4MB-aligned piece of the region that
+// is 4MB long is mapped with a single PTE_PS page directory entry.
+// These mappings are the same in every environment (env_setup_vm()
+// copies them), so they are marked PTE_G when global pages are enabled.
+//
 // Hint: the TA solution uses pgdir_walk
 static void
 boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm)
@@ -463,8 +1101,18 @@ boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm
 	int i, n;
 	pte_t *pte;
 
+	perm |= kern_pte_g;
 	n = size / PGSIZE;
 	for (i = 0; i < n; i++, va += PGSIZE, pa += PGSIZE) {
+		if (page_pse && va % PTSIZE == 0 && pa % PTSIZE == 0
+		    && n - i >= NPTENTRIES && !(pgdir[PDX(va)] & PTE_P)) {
+			pgdir[PDX(va)] = pa|perm|PTE_P|PTE_PS;
+			i += NPTENTRIES - 1;
+			va += PTSIZE - PGSIZE;
+			pa += PTSIZE - PGSIZE;
+			continue;
+		}
+
 		pte = pgdir_walk(pgdir, (void *) va, 1);
 		if (!pte)
 			panic("pgdir_walk failed to get a pte for va %08x", va);
@@ -494,6 +1142,7 @@ boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm
 // RETURNS:
 //   0 on success
 //   -E_NO_MEM, if page table couldn't be allocated
+//   -E_INVAL, if 'va' is inside a 4MB mapping
 //
 // Hint: The TA solution is implemented using pgdir_walk, page_remove,
 // and page2pa.
@@ -507,8 +1156,10 @@ page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
 	pte = pgdir_walk(pgdir, va, 1);
 	if (!pte)
 		return -E_NO_MEM;
+	if (*pte & PTE_PS)
+		return -E_INVAL;
 
-	pp->pp_ref++;
+	page_incref(pp);
 	if (*pte)
 		page_remove(pgdir, va);
 
@@ -523,7 +1174,8 @@ page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
 // can be used to verify page permissions for syscall arguments,
 // but should not be used by most callers.
 //
-// Return NULL if there is no page mapped at va.
+// Return NULL if there is no page mapped at va.  4MB mappings are
+// not looked up either: their pages can't be mapped one by one.
 //
 // Hint: the TA solution uses pgdir_walk and pa2page.
 //
@@ -533,7 +1185,7 @@ page_lookup(pde_t *pgdir, void *va, pte_t **pte_store)
 	pte_t *pte;
 
 	pte = pgdir_walk(pgdir, va, 0);
-	if (!pte)
+	if (!pte || !(*pte & PTE_P) || (*pte & PTE_PS))
 		return NULL;
 
 	if (pte_store)
@@ -554,6 +1206,8 @@ page_lookup(pde_t *pgdir, void *va, pte_t **pte_store)
 //   - The TLB must be invalidated if you remove an entry from
 //     the page table.
 //
+// If 'va' is inside a 4MB mapping, the whole 4MB mapping is removed.
+//
 // Hint: The TA solution is implemented using page_lookup,
 // 	tlb_invalidate, and page_decref.
 //
@@ -563,14 +1217,210 @@ page_remove(pde_t *pgdir, void *va)
 	// Fill this function in
 	struct PageInfo *pp;
 	pte_t *pte;
+	pde_t *pde;
+
+	pde = &pgdir[PDX(va)];
+	if ((*pde & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS)) {
+		pp = pa2page(PTE_ADDR(*pde));
+		*pde = 0;
+		tlb_invalidate(pgdir, va);
+		page_release(pp, PAGE_LARGE_ORDER);
+		return;
+	}
 
 	pp = page_lookup(pgdir, va, &pte);
 	if (!pp)
 		return;
 
-	page_decref(pp);
 	*pte = 0;
 	tlb_invalidate(pgdir, va);
+	page_release(pp, 0);
+}
+
+//
+// Drop the reference a mapping removed by page_remove() had on pp (a
+// block of 2^order pages).  If other CPUs still have to invalidate
+// their TLBs, the reference is only dropped by tlb_shootdown().  The
+// same page may be released several times in one batch, and on
+// several CPUs, so each release gets a TlbRelease of its own.
+//
+static void
+page_release(struct PageInfo *pp, int order)
+{
+	struct TlbBatch *b = &tlb_batch[cpunum()];
+	struct TlbRelease *tr;
+
+	if (!b->tb_cpus) {
+		page_decref_order(pp, order);
+		return;
+	}
+
+	if (!(tr = kmalloc(sizeof(*tr), 0))) {
+		// Better to lose the page than to reuse it while
+		// another CPU may still write to it.
+		cprintf("page_release: out of memory, leaking page %08x\n",
+			page2pa(pp));
+		return;
+	}
+	tr->tr_page = pp;
+	tr->tr_order = order;
+	tr->tr_next = b->tb_release;
+	b->tb_release = tr;
+}
+
+//
+// Map the 2^PAGE_LARGE_ORDER pages starting at 'pp' (a block from
+// page_alloc_order()) as one 4MB page at the 4MB-aligned 'va', with
+// permissions perm|PTE_P|PTE_PS.  Whatever was mapped in
+// [va, va+PTSIZE) is unmapped first, and its page table, if any, freed.
+// The reference count of the mapping is kept in pp->pp_ref.
+//
+// RETURNS:
+//   0 on success
+//   -E_NOT_SUPP, if the CPU has no 4MB pages
+//
+int
+page_insert_large(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
+{
+	pde_t *pde;
+	pte_t *pt;
+	physaddr_t pa;
+	int i;
+
+	assert((uintptr_t) va % PTSIZE == 0);
+	if (!page_pse)
+		return -E_NOT_SUPP;
+
+	page_incref(pp);
+	pde = &pgdir[PDX(va)];
+	if (*pde & PTE_PS)
+		page_remove(pgdir, va);
+	else if (*pde & PTE_P) {
+		pa = PTE_ADDR(*pde);
+		pt = (pte_t *) KADDR(pa);
+		for (i = 0; i < NPTENTRIES; i++)
+			if (pt[i] & PTE_P)
+				page_remove(pgdir, va + i * PGSIZE);
+		*pde = 0;
+		tlb_invalidate(pgdir, va);
+		page_release(pa2page(pa), 0);
+	}
+
+	*pde = page2pa(pp)|perm|PTE_P|PTE_PS;
+	return 0;
+}
+
+//
+// Resolve a write fault at 'va' on a PTE_COW page: if no other mapping
+// shares the page, make it writable again, otherwise map a writable
+// copy in its place (a fresh zeroed page, for zero_page).  If
+// zero_only, only faults on zero_page are resolved.  The caller holds
+// the lock of the environment that owns 'pgdir', so that nobody can
+// take a new reference to the page meanwhile.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if 'va' is not a user PTE_COW page (or not zero_page)
+//   -E_NO_MEM, if there's no memory for the copy
+//
+int
+page_fault_cow(pde_t *pgdir, void *va, bool zero_only)
+{
+	struct PageInfo *pp, *np;
+	pte_t *pte;
+	void *src, *dst;
+	bool sole;
+	int perm;
+
+	pte = pgdir_walk(pgdir, va, 0);
+	if (!pte || (*pte & (PTE_P|PTE_U|PTE_PS|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+		return -E_INVAL;
+
+	pp = pa2page(PTE_ADDR(*pte));
+	if (zero_only && pp != zero_page)
+		return -E_INVAL;
+	perm = ((*pte & PTE_SYSCALL) & ~PTE_COW) | PTE_W;
+
+	spin_lock(&page_lock);
+	sole = (pp->pp_ref == 1);
+	spin_unlock(&page_lock);
+
+	if (sole) {
+		*pte = page2pa(pp) | perm;
+		tlb_invalidate(pgdir, va);
+		return 0;
+	}
+
+	if (pp == zero_page) {
+		if (!(np = page_alloc(ALLOC_ZERO|ALLOC_HIGH)))
+			return -E_NO_MEM;
+		return page_insert(pgdir, np, va, perm);
+	}
+
+	np = page_alloc(ALLOC_HIGH);
+	if (!np)
+		return -E_NO_MEM;
+	src = kmap(pp);
+	dst = kmap(np);
+	memcpy(dst, src, PGSIZE);
+	kunmap(dst);
+	kunmap(src);
+	return page_insert(pgdir, np, va, perm);
+}
+
+//
+// Give 'dst' the user mappings of 'src' below UTOP, for fork: PTE_SHARE
+// pages are mapped with the same permissions, writable and PTE_COW
+// pages are made read-only and PTE_COW in both, and read-only pages
+// are mapped read-only.  The user exception stack page and 4MB pages
+// are not copied.
+//
+// RETURNS:
+//   0 on success
+//   -E_NO_MEM, if a page table couldn't be allocated.  Some mappings
+//     may have been made in 'dst' and changed to PTE_COW in 'src'.
+//
+int
+pgdir_copy_cow(pde_t *dst, pde_t *src)
+{
+	uint32_t pdeno, pteno;
+	pte_t *spt, *dpt, pte;
+	void *va;
+	int perm;
+
+	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+		if ((src[pdeno] & (PTE_P|PTE_PS)) != PTE_P)
+			continue;
+		spt = (pte_t *) KADDR(PTE_ADDR(src[pdeno]));
+		dpt = NULL;
+
+		for (pteno = 0; pteno < NPTENTRIES; pteno++) {
+			pte = spt[pteno];
+			va = PGADDR(pdeno, pteno, 0);
+			if (!(pte & PTE_P) || va == (void *) (UXSTACKTOP - PGSIZE))
+				continue;
+
+			if (!dpt) {
+				dpt = pgdir_walk(dst, va, 1);
+				if (!dpt)
+					return -E_NO_MEM;
+				dpt -= pteno;
+			}
+
+			perm = pte & PTE_SYSCALL;
+			if (!(pte & PTE_SHARE) && (pte & (PTE_W|PTE_COW))) {
+				perm = (perm & ~PTE_W) | PTE_COW;
+				if (perm != (pte & PTE_SYSCALL)) {
+					spt[pteno] = PTE_ADDR(pte) | perm;
+					tlb_invalidate(src, va);
+				}
+			}
+
+			page_incref(pa2page(PTE_ADDR(pte)));
+			dpt[pteno] = PTE_ADDR(pte) | perm;
+		}
+	}
+	return 0;
 }
 
 //
@@ -580,9 +1430,101 @@ page_remove(pde_t *pgdir, void *va)
 void
 tlb_invalidate(pde_t *pgdir, void *va)
 {
+	struct TlbBatch *b;
+	struct CpuInfo *c;
+	uint32_t mask;
+
 	// Flush the entry only if we're modifying the current address space.
 	if (!curenv || curenv->env_pgdir == pgdir)
 		invlpg(va);
+
+	// Queue it for the other CPUs running on pgdir.  The page table
+	// update must be visible before we look: a CPU that switches to
+	// pgdir after that can't load the old entry.
+	mb();
+	mask = 0;
+	for (c = cpus; c < cpus + ncpu; c++)
+		if (c != thiscpu && c->cpu_env && c->cpu_env->env_pgdir == pgdir)
+			mask |= 1 << (c - cpus);
+	if (!mask)
+		return;
+
+	b = &tlb_batch[cpunum()];
+	b->tb_cpus |= mask;
+	if (b->tb_nva < TLB_BATCH_MAX) {
+		b->tb_pgdir[b->tb_nva] = pgdir;
+		b->tb_va[b->tb_nva] = (uintptr_t) va;
+	}
+	if (b->tb_nva <= TLB_BATCH_MAX)
+		b->tb_nva++;
+}
+
+//
+// Have every CPU that tlb_invalidate() queued addresses for invalidate
+// them, then drop the page references page_release() held on to.
+// Must be called without any spinlock held.
+//
+void
+tlb_shootdown(void)
+{
+	struct TlbBatch *b = &tlb_batch[cpunum()];
+	struct TlbRelease *tr;
+	int i, n;
+
+	if (!b->tb_cpus)
+		return;
+
+	n = 0;
+	for (i = 0; i < ncpu; i++)
+		if (b->tb_cpus & (1 << i))
+			n++;
+	b->tb_waiting = n;
+	for (i = 0; i < ncpu; i++) {
+		if (!(b->tb_cpus & (1 << i)))
+			continue;
+		b->tb_request[i] = 1;
+		lapic_ipi_cpu(cpus[i].cpu_id, IRQ_OFFSET + IRQ_TLB);
+	}
+	thiscpu->cpu_shootdowns++;
+	thiscpu->cpu_shootdown_ipis += n;
+
+	// Answer the CPUs shooting at us meanwhile, or two CPUs could
+	// wait for each other forever.
+	while (b->tb_waiting) {
+		tlb_shootdown_recv();
+		asm volatile("pause");
+	}
+
+	b->tb_cpus = 0;
+	b->tb_nva = 0;
+	while ((tr = b->tb_release)) {
+		b->tb_release = tr->tr_next;
+		page_decref_order(tr->tr_page, tr->tr_order);
+		kfree(tr);
+	}
+}
+
+//
+// Invalidate what other CPUs asked this one to with tlb_shootdown().
+// Called on IRQ_TLB.
+//
+void
+tlb_shootdown_recv(void)
+{
+	struct TlbBatch *b;
+	int i, me = cpunum();
+
+	for (b = tlb_batch; b < tlb_batch + ncpu; b++) {
+		if (!xchg(&b->tb_request[me], 0))
+			continue;
+		if (b->tb_nva > TLB_BATCH_MAX)
+			lcr3(rcr3());
+		else
+			for (i = 0; i < b->tb_nva; i++)
+				if (PADDR(b->tb_pgdir[i]) == rcr3())
+					invlpg((void *) b->tb_va[i]);
+		xadd(&b->tb_waiting, -1);
+	}
 }
 
 //
@@ -631,6 +1573,9 @@ mmio_map_region(physaddr_t pa, size_t size)
 
 static uintptr_t user_mem_check_addr;
 
+static int user_mem_check_locked(struct Env *env, const void *va,
+				 size_t len, int perm);
+
 //
 // Check that an environment is allowed to access the range of memory
 // [va, va+len) with permissions 'perm | PTE_P'.
@@ -651,12 +1596,37 @@ static uintptr_t user_mem_check_addr;
 //
 int
 user_mem_check(struct Env *env, const void *va, size_t len, int perm)
+{
+	int r;
+
+	env_lock(env);
+	r = user_mem_check_locked(env, va, len, perm);
+	env_unlock(env);
+	return r;
+}
+
+// user_mem_check, for a caller holding env's lock.
+static int
+user_mem_check_locked(struct Env *env, const void *va, size_t len, int perm)
 {
 	// LAB 3: Your code here.
 	pte_t * pte;
 
 	for (; len > 0; len--, va++) {
 		pte = pgdir_walk(env->env_pgdir, va, 0);
+		if ((!pte || !(*pte & PTE_P)) && (uintptr_t) va < UTOP) {
+			// Fault in demand-zero pages the kernel is about
+			// to touch on the user's behalf.
+			env_region_fault(env, (uintptr_t) va, perm & PTE_W);
+			pte = pgdir_walk(env->env_pgdir, va, 0);
+		} else if ((perm & PTE_W) && pte && (*pte & PTE_COW)
+			   && (uintptr_t) va < UTOP) {
+			// Don't let the kernel write the shared zero page
+			// (or another copy-on-write page): give the user a
+			// page of its own first.
+			page_fault_cow(env->env_pgdir, ROUNDDOWN((void *) va, PGSIZE), !env->env_kernel_cow);
+			pte = pgdir_walk(env->env_pgdir, va, 0);
+		}
 		if ((uintptr_t) va >= ULIM || !pte || !(*pte & (perm | PTE_P))) {
 			user_mem_check_addr = (uintptr_t) va;
 			return -E_FAULT;
@@ -682,6 +1652,25 @@ user_mem_assert(struct Env *env, const void *va, size_t len, int perm)
 	}
 }
 
+//
+// Like user_mem_assert, for the current environment 'env', but returns
+// holding env's lock.  The page and IPC system calls change env's
+// mappings only under that lock, without the big kernel lock, so the
+// caller must not touch [va, va+len) after its env_unlock(env).
+//
+void
+user_mem_assert_lock(struct Env *env, const void *va, size_t len, int perm)
+{
+	env_lock(env);
+	if (user_mem_check_locked(env, va, len, perm | PTE_U) < 0) {
+		env_unlock(env);
+		cprintf("[%08x] user_mem_check assertion failure for "
+			"va %08x\n", env->env_id, user_mem_check_addr);
+		env_destroy(env);	// does not return
+		panic("user_mem_assert_lock: env_destroy returned");
+	}
+}
+
 
 // --------------------------------------------------------------
 // Checking functions.
@@ -847,13 +1836,13 @@ check_kern_pgdir(void)
 	for (i = 0; i < n; i += PGSIZE)
 		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
 
-	// check envs array (new test for lab 3)
-	n = ROUNDUP(NENV*sizeof(struct Env), PGSIZE);
-	for (i = 0; i < n; i += PGSIZE)
-		assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+	// check envs array (new test for lab 3): nothing is mapped until
+	// env_init()
+	for (i = 0; i < PTSIZE; i += PGSIZE)
+		assert(check_va2pa(pgdir, UENVS + i) == ~0);
 
 	// check phys mem
-	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+	for (i = 0; i < npages_lowmem * PGSIZE; i += PGSIZE)
 		assert(check_va2pa(pgdir, KERNBASE + i) == i);
 
 	// check kernel stack
@@ -902,6 +1891,8 @@ check_va2pa(pde_t *pgdir, uintptr_t va)
 	pgdir = &pgdir[PDX(va)];
 	if (!(*pgdir & PTE_P))
 		return ~0;
+	if (*pgdir & PTE_PS)
+		return PTE_ADDR(*pgdir) + (PTX(va) << PTXSHIFT);
 	p = (pte_t*) KADDR(PTE_ADDR(*pgdir));
 	if (!(p[PTX(va)] & PTE_P))
 		return ~0;
@@ -14,8 +14,10 @@ extern char bootstacktop[], bootstack[];
 
 extern struct PageInfo *pages;
 extern size_t npages;
+extern size_t npages_lowmem;
 
 extern pde_t *kern_pgdir;
+extern struct PageInfo *zero_page;
 
 
 /* This macro takes a kernel virtual address -- an address that points above
@@ -34,13 +36,15 @@ _paddr(const char *file, int line, void *kva)
 }
 
 /* This macro takes a physical address and returns the corresponding kernel
- * virtual address.  It panics if you pass an invalid physical address. */
+ * virtual address.  It panics if you pass an invalid physical address,
+ * including one in high memory, above the KERNBASE mapping; use kmap()
+ * to get at those pages. */
 #define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
 
 static inline void*
 _kaddr(const char *file, int line, physaddr_t pa)
 {
-	if (PGNUM(pa) >= npages)
+	if (PGNUM(pa) >= npages_lowmem)
 		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
 	return (void *)(pa + KERNBASE);
 }
@@ -49,24 +53,57 @@ _kaddr(const char *file, int line, physaddr_t pa)
 enum {
 	// For page_alloc, zero the returned physical page.
 	ALLOC_ZERO = 1<<0,
+	// For page_alloc, prefer a page in high memory.  The caller must
+	// reach it through kmap() rather than page2kva().
+	ALLOC_HIGH = 1<<1,
 };
 
 void	mem_init(void);
+void	mem_init_percpu(void);
 
 void	page_init(void);
 struct PageInfo *page_alloc(int alloc_flags);
 void	page_free(struct PageInfo *pp);
+// Largest block page_alloc_order() can hand out: 2^PAGE_MAX_ORDER pages
+#define PAGE_MAX_ORDER	10
+struct PageInfo *page_alloc_order(int order, int alloc_flags);
+void	page_free_order(struct PageInfo *pp, int order);
+uint32_t page_free_blocks(int order);
+uint32_t page_high_free_count(void);
+void	*kmap(struct PageInfo *pp);
+void	kunmap(void *va);
+
+// Pool of free pages zeroed ahead of time by idle CPUs
+struct PageZeroStat {
+	uint32_t pages;		// Pages in the pool now
+	uint32_t hits;		// ALLOC_ZERO allocations served from the pool
+	uint32_t misses;	// ALLOC_ZERO allocations that had to zero
+	uint32_t filled;	// Pages zeroed into the pool so far
+};
+void	page_zero_fill(void);
+void	page_zero_stat(struct PageZeroStat *st);
+// Order of the blocks backing 4MB (PTE_PS) mappings
+#define PAGE_LARGE_ORDER	(PTSHIFT - PGSHIFT)
+extern bool page_pse;
 int	page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm);
+int	page_insert_large(pde_t *pgdir, struct PageInfo *pp, void *va, int perm);
+int	pgdir_copy_cow(pde_t *dst, pde_t *src);
+int	page_fault_cow(pde_t *pgdir, void *va, bool zero_only);
 void	page_remove(pde_t *pgdir, void *va);
 struct PageInfo *page_lookup(pde_t *pgdir, void *va, pte_t **pte_store);
+void	page_incref(struct PageInfo *pp);
 void	page_decref(struct PageInfo *pp);
+void	page_decref_order(struct PageInfo *pp, int order);
 
 void	tlb_invalidate(pde_t *pgdir, void *va);
+void	tlb_shootdown(void);
+void	tlb_shootdown_recv(void);
 
 void *	mmio_map_region(physaddr_t pa, size_t size);
 
 int	user_mem_check(struct Env *env, const void *va, size_t len, int perm);
 void	user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
+void	user_mem_assert_lock(struct Env *env, const void *va, size_t len, int perm);
 
 static inline physaddr_t
 page2pa(struct PageInfo *pp)
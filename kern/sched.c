@@ -2,42 +2,403 @@
 #include <inc/x86.h>
 #include <kern/spinlock.h>
 #include <kern/env.h>
+#include <kern/sched.h>
 #include <kern/pmap.h>
+#include <kern/ksm.h>
 #include <kern/monitor.h>
 
-void sched_halt(void);
+void sched_halt(void) __attribute__((noreturn));
+
+// Multi-level feedback queue scheduling.
+//
+// Each CPU's run queue has NENVPRIO levels, level ENV_PRIO_HIGHEST
+// being served first and round-robin within a level.  A level's time
+// slice is SCHED_QUANTUM(level) timer ticks, doubling at each level
+// down.  An environment that uses up its whole slice is demoted one
+// level, so CPU-bound environments sink towards the bottom; one that
+// blocks in sys_ipc_recv and is woken by a sender is promoted one
+// level, so interactive servers float to the top.  Every
+// SCHED_BOOST_TICKS ticks all queued environments go back to the top
+// level, so nothing starves.  Environments pinned with
+// sys_env_set_priority never move.
+
+uint32_t sched_wait_hist[NSCHEDHIST];
+uint32_t sched_run_hist[NSCHEDHIST];
+
+// Does e's CPU affinity mask allow it to run on CPU c?
+static bool
+cpu_allowed(struct Env *e, struct CpuInfo *c)
+{
+	return (e->env_cpumask >> (c - cpus)) & 1;
+}
+
+// Idle CPUs sleep without a timer tick (see sched_halt), so they have
+// to be woken up when there is work for them.  e has just been queued
+// on c: wake c if it is idle, and otherwise wake an idle CPU that e is
+// allowed on, so that it can steal e rather than let it wait for c.
+static void
+sched_kick(struct CpuInfo *c, struct Env *e)
+{
+	struct CpuInfo *idle;
+
+	if (c != thiscpu && c->cpu_status == CPU_HALTED) {
+		lapic_ipi_cpu(c->cpu_id, IRQ_OFFSET + IRQ_WAKEUP);
+		return;
+	}
+
+	for (idle = cpus; idle < cpus + ncpu; idle++) {
+		if (idle != thiscpu && idle->cpu_status == CPU_HALTED &&
+		    cpu_allowed(e, idle)) {
+			lapic_ipi_cpu(idle->cpu_id, IRQ_OFFSET + IRQ_WAKEUP);
+			return;
+		}
+	}
+}
+
+// Append e to the tail of its priority level in c's run queue.
+static void
+runq_push(struct CpuInfo *c, struct Env *e)
+{
+	struct RunQueue *rq = &c->cpu_runq;
+	int prio = e->env_priority;
+
+	e->env_rq_next = NULL;
+	e->env_rq_prev = rq->rq_tail[prio];
+	if (rq->rq_tail[prio])
+		rq->rq_tail[prio]->env_rq_next = e;
+	else
+		rq->rq_head[prio] = e;
+	rq->rq_tail[prio] = e;
+	rq->rq_len++;
+	e->env_rq_cpu = c - cpus;
+}
+
+// Unlink e from the run queue that currently holds it.
+static void
+runq_remove(struct Env *e)
+{
+	struct RunQueue *rq = &cpus[e->env_rq_cpu].cpu_runq;
+	int prio = e->env_priority;
+
+	if (e->env_rq_prev)
+		e->env_rq_prev->env_rq_next = e->env_rq_next;
+	else
+		rq->rq_head[prio] = e->env_rq_next;
+	if (e->env_rq_next)
+		e->env_rq_next->env_rq_prev = e->env_rq_prev;
+	else
+		rq->rq_tail[prio] = e->env_rq_prev;
+	rq->rq_len--;
+	e->env_rq_next = e->env_rq_prev = NULL;
+	e->env_rq_cpu = -1;
+}
+
+// Return the first environment on the highest non-empty level of rq,
+// or NULL if rq is empty.  Only levels above 'below' are considered.
+static struct Env *
+runq_first(struct RunQueue *rq, int below)
+{
+	int prio;
+
+	for (prio = ENV_PRIO_HIGHEST; prio < below; prio++)
+		if (rq->rq_head[prio])
+			return rq->rq_head[prio];
+	return NULL;
+}
+
+// Move e to level prio and give it a fresh time slice there.
+// e must not be on a run queue.
+static void
+env_set_level(struct Env *e, int prio)
+{
+	e->env_priority = prio;
+	e->env_slice = SCHED_QUANTUM(prio);
+}
+
+// Move every unpinned environment queued on this CPU, and the one
+// running here, back to the top level.
+static void
+sched_boost(void)
+{
+	struct RunQueue *rq = &thiscpu->cpu_runq;
+	struct Env *e, *next;
+	int prio;
+
+	for (prio = ENV_PRIO_HIGHEST + 1; prio < NENVPRIO; prio++) {
+		for (e = rq->rq_head[prio]; e; e = next) {
+			next = e->env_rq_next;
+			if (e->env_prio_pinned)
+				continue;
+			runq_remove(e);
+			env_set_level(e, ENV_PRIO_HIGHEST);
+			runq_push(thiscpu, e);
+		}
+	}
+
+	if (curenv && !curenv->env_prio_pinned)
+		env_set_level(curenv, ENV_PRIO_HIGHEST);
+}
+
+// Take an environment off the run queue of the busiest other CPU, so
+// that this CPU, which has nothing else to do, can run it.  Among the
+// first SCHED_STEAL_SCAN queued environments, in scheduling order, the
+// one that last ran the longest time ago is taken: it has the least
+// cache state left behind on the victim.  Environments whose affinity
+// mask excludes this CPU are never taken.  Returns NULL if there is
+// nothing to steal.
+static struct Env *
+sched_steal(void)
+{
+	struct CpuInfo *c, *victim;
+	struct Env *e, *best;
+	int prio, n;
+
+	victim = NULL;
+	for (c = cpus; c < cpus + ncpu; c++) {
+		if (c == thiscpu || !c->cpu_runq.rq_len)
+			continue;
+		if (!victim || c->cpu_runq.rq_len > victim->cpu_runq.rq_len)
+			victim = c;
+	}
+	if (!victim)
+		return NULL;
+
+	best = NULL;
+	n = 0;
+	for (prio = ENV_PRIO_HIGHEST; prio < NENVPRIO; prio++) {
+		e = victim->cpu_runq.rq_head[prio];
+		for (; e && n < SCHED_STEAL_SCAN; e = e->env_rq_next, n++) {
+			if (!cpu_allowed(e, thiscpu))
+				continue;
+			if (!best || e->env_last_run < best->env_last_run)
+				best = e;
+		}
+	}
+	if (!best)
+		return NULL;
+
+	runq_remove(best);
+	victim->cpu_stolen++;
+	thiscpu->cpu_steals++;
+	return best;
+}
+
+// Make ENV_RUNNABLE environment e eligible to be picked by sched_yield.
+// An environment that has run before goes back to the CPU it last ran
+// on, so that it finds its working set still in that CPU's cache.  A
+// brand new environment, or one whose affinity mask no longer allows
+// its last CPU, goes to the allowed CPU with the shortest run queue.
+// Does nothing if e is already queued.
+void
+sched_enqueue(struct Env *e)
+{
+	struct CpuInfo *c, *best;
+
+	if (e->env_rq_cpu >= 0)
+		return;
+
+	e->env_runnable_since = read_tsc();
+	if (e->env_runs > 0 && e->env_cpunum >= 0 && e->env_cpunum < ncpu &&
+	    cpu_allowed(e, &cpus[e->env_cpunum]))
+		best = &cpus[e->env_cpunum];
+	else {
+		best = cpu_allowed(e, thiscpu) ? thiscpu : NULL;
+		for (c = cpus; c < cpus + ncpu; c++) {
+			if (!cpu_allowed(e, c))
+				continue;
+			if (!best || c->cpu_runq.rq_len < best->cpu_runq.rq_len)
+				best = c;
+		}
+		// sys_env_set_affinity never accepts a mask without a
+		// usable CPU
+		assert(best);
+	}
+
+	// Requeueing an environment that was queued already (see
+	// sched_boost and sched_set_priority) adds no work, so only here
+	// may an idle CPU need waking.
+	runq_push(best, e);
+	sched_kick(best, e);
+}
+
+// Remove e from its run queue, if it is on one.  Must be called whenever
+// an environment stops being ENV_RUNNABLE.
+void
+sched_dequeue(struct Env *e)
+{
+	if (e->env_rq_cpu >= 0)
+		runq_remove(e);
+}
+
+// Queue e, which was blocked and has just been made ENV_RUNNABLE again
+// by an IPC, rewarding it with a promotion for having blocked.
+void
+sched_wakeup(struct Env *e)
+{
+	if (!e->env_prio_pinned && e->env_priority > ENV_PRIO_HIGHEST)
+		env_set_level(e, e->env_priority - 1);
+	sched_enqueue(e);
+}
+
+// Directed yield: run e, which an IPC from curenv has just made
+// ENV_RUNNABLE, on this CPU right away instead of queueing it, and give
+// it the rest of curenv's time slice.  e gets the usual promotion for
+// having blocked, but no fresh slice; curenv goes back on the run queue
+// with a full one, as if it had blocked.  Does not return, unless e
+// isn't allowed on this CPU: then it does nothing, and the caller should
+// wake e up and carry on running curenv, since descheduling curenv
+// would gain nothing.
+void
+sched_yield_to(struct Env *e)
+{
+	assert(e->env_status == ENV_RUNNABLE && e->env_rq_cpu < 0);
+
+	if (!cpu_allowed(e, thiscpu))
+		return;
+
+	if (!e->env_prio_pinned && e->env_priority > ENV_PRIO_HIGHEST)
+		e->env_priority--;
+	e->env_slice = curenv->env_slice;
+	e->env_runnable_since = read_tsc();
+	env_set_level(curenv, curenv->env_priority);
+	env_run(e);
+}
+
+// Count a sample of 'cycles' TSC cycles in histogram hist.
+static void
+hist_add(uint32_t *hist, uint64_t cycles)
+{
+	int b = 0;
+
+	cycles >>= SCHEDHIST_SHIFT;
+	while (cycles > 1 && b < NSCHEDHIST - 1) {
+		cycles >>= 1;
+		b++;
+	}
+	hist[b]++;
+}
+
+// Record how long e, which is about to be switched to, waited since it
+// last became ENV_RUNNABLE.
+void
+sched_account_wait(struct Env *e)
+{
+	uint64_t cycles = read_tsc() - e->env_runnable_since;
+
+	hist_add(e->env_wait_hist, cycles);
+	hist_add(sched_wait_hist, cycles);
+}
+
+// Record how long e, which is being switched away from, has run since
+// it was switched to.
+void
+sched_account_run(struct Env *e)
+{
+	uint64_t cycles = read_tsc() - e->env_last_run;
+
+	hist_add(e->env_run_hist, cycles);
+	hist_add(sched_run_hist, cycles);
+}
+
+// Pin e at level prio, or hand it back to the feedback scheduler at
+// the top level if prio is ENV_PRIO_DYNAMIC.
+void
+sched_set_priority(struct Env *e, int prio)
+{
+	int cpu = e->env_rq_cpu;
+
+	if (cpu >= 0)
+		runq_remove(e);
+
+	e->env_prio_pinned = (prio != ENV_PRIO_DYNAMIC);
+	env_set_level(e, e->env_prio_pinned ? prio : ENV_PRIO_HIGHEST);
+
+	if (cpu >= 0)
+		runq_push(&cpus[cpu], e);
+}
+
+// Called on every timer interrupt.  Charges the tick to the current
+// environment and returns if it should keep running; otherwise picks
+// another environment to run and does not return.
+void
+sched_tick(void)
+{
+	struct RunQueue *rq = &thiscpu->cpu_runq;
+	struct Env *e = curenv;
+
+	if (++rq->rq_ticks >= SCHED_BOOST_TICKS) {
+		rq->rq_ticks = 0;
+		sched_boost();
+	}
+
+	if (!e || e->env_status != ENV_RUNNING)
+		sched_yield();
+
+	if (--e->env_slice > 0) {
+		// Keep running unless something more urgent is waiting,
+		// or e isn't allowed to run here anymore.
+		if (!runq_first(rq, e->env_priority) && cpu_allowed(e, thiscpu))
+			return;
+	} else if (!e->env_prio_pinned && e->env_priority < ENV_PRIO_LOWEST)
+		env_set_level(e, e->env_priority + 1);
+	else
+		env_set_level(e, e->env_priority);
+
+	sched_yield();
+}
+
+// Would sched_yield() just keep running curenv, because nothing else is
+// queued on this CPU?  Safe to call without the big kernel lock, in
+// which case the answer is only a hint: an environment queued here
+// concurrently will get its turn at the next timer tick.
+bool
+sched_yield_is_noop(void)
+{
+	return curenv && curenv->env_status == ENV_RUNNING &&
+		thiscpu->cpu_runq.rq_len == 0 && cpu_allowed(curenv, thiscpu);
+}
 
 // Choose a user environment to run and run it.
 void
 sched_yield(void)
 {
-	// Implement simple round-robin scheduling.
+	// Multi-level feedback scheduling over this CPU's run queue.
 	//
-	// Search through 'envs' for an ENV_RUNNABLE environment in
-	// circular fashion starting just after the env this CPU was
-	// last running.  Switch to the first such environment found.
+	// Every ENV_RUNNABLE environment sits on exactly one CPU's run
+	// queue, so picking the next one to run is just a matter of
+	// taking the head of our highest non-empty level.  env_run()
+	// puts the environment we switch away from back on the tail of
+	// its level.
 	//
 	// If no envs are runnable, but the environment previously
 	// running on this CPU is still ENV_RUNNING, it's okay to
 	// choose that environment.
 	//
-	// Never choose an environment that's currently running on
-	// another CPU (env_status == ENV_RUNNING). If there are
-	// no runnable environments, simply drop through to the code
-	// below to halt the cpu.
-
-	// LAB 4: Your code here.
-	int idx, i;
-
-	idx = curenv ? ENVX(curenv->env_id) : 0;
-	for (i = 0; i < NENV; i++) {
-		idx = ENVX(idx + 1);
-		if (envs[idx].env_status == ENV_RUNNABLE)
-			env_run(&envs[idx]);
+	// Environments running on other CPUs are never on a run queue,
+	// so they can't be chosen here.  If there is nothing to run
+	// here, try to steal a runnable environment from another CPU,
+	// and only if there are none drop through to the code below to
+	// halt the cpu.
+	struct Env *e;
+
+	if ((e = runq_first(&thiscpu->cpu_runq, NENVPRIO))) {
+		assert(e->env_status == ENV_RUNNABLE);
+		env_run(e);
 	}
 
-	if (curenv && curenv->env_status == ENV_RUNNING)
-		env_run(curenv);
+	if (curenv && curenv->env_status == ENV_RUNNING) {
+		if (cpu_allowed(curenv, thiscpu))
+			env_run(curenv);
+
+		// Its affinity mask changed while it was running here;
+		// hand it to a CPU it is allowed on.
+		curenv->env_status = ENV_RUNNABLE;
+		sched_enqueue(curenv);
+	}
+
+	// Nothing to do here; help out a busier CPU before going idle.
+	if ((e = sched_steal()))
+		env_run(e);
 
 	// sched_halt never returns
 	sched_halt();
@@ -49,26 +410,38 @@ sched_yield(void)
 void
 sched_halt(void)
 {
-	int i;
+	struct CpuInfo *c;
 
 	// For debugging and testing purposes, if there are no runnable
 	// environments in the system, then drop into the kernel monitor.
-	for (i = 0; i < NENV; i++) {
-		if ((envs[i].env_status == ENV_RUNNABLE ||
-		     envs[i].env_status == ENV_RUNNING ||
-		     envs[i].env_status == ENV_DYING))
+	// Runnable environments are on some CPU's run queue, and running
+	// or dying ones are some other CPU's cpu_env, so it's enough to
+	// look at each CPU.
+	for (c = cpus; c < cpus + ncpu; c++) {
+		if (c->cpu_runq.rq_len)
+			break;
+		if (c != thiscpu && c->cpu_env)
 			break;
 	}
-	if (i == NENV) {
+	if (c == cpus + ncpu) {
 		cprintf("No runnable environments in the system!\n");
 		while (1)
 			monitor(NULL);
 	}
 
 	// Mark that no environment is running on this CPU
+	if (curenv)
+		sched_account_run(curenv);
 	curenv = NULL;
 	lcr3(PADDR(kern_pgdir));
 
+	// Go tickless: nothing in the kernel needs this CPU to wake up at
+	// a particular time, and whoever gives it work sends it an
+	// IRQ_WAKEUP (see sched_kick).  The boot CPU keeps its tick
+	// because it keeps the time for sys_time_msec.
+	if (thiscpu != bootcpu)
+		lapic_timer_stop();
+
 	// Mark that this CPU is in the HALT state, so that when
 	// timer interupts come in, we know we should re-acquire the
 	// big kernel lock
@@ -76,6 +449,12 @@ sched_halt(void)
 
 	// Release the big kernel lock as if we were "leaving" the kernel
 	unlock_kernel();
+	tlb_shootdown();
+
+	// Put the idle time to use.  Work handed to this CPU meanwhile
+	// raises an IRQ_WAKEUP, which is taken as soon as we sti below.
+	page_zero_fill();
+	ksm_scan();
 
 	// Reset stack pointer, enable interrupts and then halt.
 	asm volatile (
@@ -88,5 +467,6 @@ sched_halt(void)
 		"hlt\n"
 		"jmp 1b\n"
 	: : "a" (thiscpu->cpu_ts.ts_esp0));
+	panic("sched_halt: hlt loop exited");  /* mostly to placate the compiler */
 }
 
@@ -6,7 +6,31 @@
 # error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/env.h>
+
+// Length of the time slice at scheduling level 'prio', in timer ticks
+#define SCHED_QUANTUM(prio)	(1 << (prio))
+// Timer ticks between resets of every queued environment to the top level
+#define SCHED_BOOST_TICKS	100
+// Queued environments an idle CPU looks at when choosing one to steal
+#define SCHED_STEAL_SCAN	8
+
 // This function does not return.
 void sched_yield(void) __attribute__((noreturn));
+void sched_yield_to(struct Env *e);
+
+void sched_enqueue(struct Env *e);
+void sched_dequeue(struct Env *e);
+void sched_wakeup(struct Env *e);
+void sched_set_priority(struct Env *e, int prio);
+void sched_tick(void);
+bool sched_yield_is_noop(void);
+
+// Histograms over all environments; see NSCHEDHIST
+extern uint32_t sched_wait_hist[NSCHEDHIST];
+extern uint32_t sched_run_hist[NSCHEDHIST];
+
+void sched_account_wait(struct Env *e);
+void sched_account_run(struct Env *e);
 
 #endif	// !JOS_KERN_SCHED_H
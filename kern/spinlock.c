@@ -11,11 +11,16 @@
 
 // The big kernel lock
 struct spinlock kernel_lock = {
-#ifdef DEBUG_SPINLOCK
 	.name = "kernel_lock"
-#endif
 };
 
+// Every lock that has ever been acquired, linked through 'link', so the
+// monitor can show their statistics.  Protected by spin_list_lock,
+// which is a bare test-and-set lock so that it can't recurse into
+// spin_lock().
+static struct spinlock *spin_list;
+static volatile uint32_t spin_list_lock;
+
 #ifdef DEBUG_SPINLOCK
 // Record the current call stack in pcs[] by following the %ebp chain.
 static void
@@ -39,18 +44,37 @@ get_caller_pcs(uint32_t pcs[])
 static int
 holding(struct spinlock *lock)
 {
-	return lock->locked && lock->cpu == thiscpu;
+	return lock->owner != lock->next && lock->cpu == thiscpu;
 }
 #endif
 
 void
 __spin_initlock(struct spinlock *lk, char *name)
 {
-	lk->locked = 0;
-#ifdef DEBUG_SPINLOCK
+	memset(lk, 0, sizeof(*lk));
 	lk->name = name;
-	lk->cpu = 0;
-#endif
+}
+
+// Put lk on spin_list.  Locks that are statically initialized never
+// see __spin_initlock, so this is done on a lock's first acquisition,
+// while holding it.
+static void
+spin_list_add(struct spinlock *lk)
+{
+	while (xchg(&spin_list_lock, 1) != 0)
+		asm volatile ("pause");
+	lk->link = spin_list;
+	spin_list = lk;
+	lk->listed = 1;
+	xchg(&spin_list_lock, 0);
+}
+
+// Return the first of all the locks that have been acquired at least
+// once.  The rest follow through their 'link' fields.
+struct spinlock *
+spin_lock_list(void)
+{
+	return spin_list;
 }
 
 // Acquire the lock.
@@ -60,16 +84,32 @@ __spin_initlock(struct spinlock *lk, char *name)
 void
 spin_lock(struct spinlock *lk)
 {
+	uint32_t ticket;
+	uint64_t start;
+
 #ifdef DEBUG_SPINLOCK
 	if (holding(lk))
 		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
 #endif
 
-	// The xchg is atomic.
+	// Take a ticket and wait for our turn.  The xadd is atomic.
 	// It also serializes, so that reads after acquire are not
-	// reordered before it. 
-	while (xchg(&lk->locked, 1) != 0)
-		asm volatile ("pause");
+	// reordered before it.  Waiters only read lk->owner, so they
+	// don't fight over the cache line while they wait.
+	ticket = xadd(&lk->next, 1);
+	if (lk->owner != ticket) {
+		start = read_tsc();
+		while (lk->owner != ticket)
+			asm volatile ("pause");
+		lk->contended++;
+		lk->spin_cycles += read_tsc() - start;
+	}
+	asm volatile("" ::: "memory");
+
+	lk->acquires++;
+	if (!lk->listed)
+		spin_list_add(lk);
+	lk->hold_start = read_tsc();
 
 	// Record info about lock acquisition for debugging.
 #ifdef DEBUG_SPINLOCK
@@ -82,6 +122,8 @@ spin_lock(struct spinlock *lk)
 void
 spin_unlock(struct spinlock *lk)
 {
+	uint64_t hold;
+
 #ifdef DEBUG_SPINLOCK
 	if (!holding(lk)) {
 		int i;
@@ -107,14 +149,16 @@ spin_unlock(struct spinlock *lk)
 	lk->cpu = 0;
 #endif
 
-	// The xchg serializes, so that reads before release are 
-	// not reordered after it.  The 1996 PentiumPro manual (Volume 3,
-	// 7.2) says reads can be carried out speculatively and in
-	// any order, which implies we need to serialize here.
-	// But the 2007 Intel 64 Architecture Memory Ordering White
-	// Paper says that Intel 64 and IA-32 will not move a load
-	// after a store. So lock->locked = 0 would work here.
-	// The xchg being asm volatile ensures gcc emits it after
-	// the above assignments (and after the critical section).
-	xchg(&lk->locked, 0);
+	hold = read_tsc() - lk->hold_start;
+	if (hold > lk->max_hold)
+		lk->max_hold = hold;
+
+	// Hand the lock to the next ticket.  Only the holder writes
+	// lk->owner, so a plain store does it.  The 2007 Intel 64
+	// Architecture Memory Ordering White Paper says that Intel 64
+	// and IA-32 will not move a load after a store, and the
+	// compiler barrier keeps gcc from moving the critical section
+	// past it.
+	asm volatile("" ::: "memory");
+	lk->owner++;
 }
@@ -6,13 +6,24 @@
 // Comment this to disable spinlock debugging
 #define DEBUG_SPINLOCK
 
-// Mutual exclusion lock.
+// Mutual exclusion lock.  This is a ticket lock: CPUs acquire the lock
+// in the order they asked for it.
 struct spinlock {
-	unsigned locked;       // Is the lock held?
+	volatile uint32_t next;  // Next ticket to hand out
+	volatile uint32_t owner; // Ticket of the CPU holding the lock
+	char *name;            // Name of lock.
+
+	// Statistics, updated while holding the lock:
+	uint32_t acquires;     // Number of times the lock was acquired
+	uint32_t contended;    // Acquisitions that had to wait
+	uint64_t spin_cycles;  // TSC cycles spent waiting, in total
+	uint64_t max_hold;     // Longest time the lock was held, in cycles
+	uint64_t hold_start;   // TSC when the lock was acquired
+	struct spinlock *link; // Next lock on spin_lock_list()
+	bool listed;           // Is the lock on spin_lock_list()?
 
 #ifdef DEBUG_SPINLOCK
 	// For debugging:
-	char *name;            // Name of lock.
 	struct CpuInfo *cpu;   // The CPU holding the lock.
 	uintptr_t pcs[10];     // The call stack (an array of program counters)
 	                       // that locked the lock.
@@ -22,6 +33,7 @@ struct spinlock {
 void __spin_initlock(struct spinlock *lk, char *name);
 void spin_lock(struct spinlock *lk);
 void spin_unlock(struct spinlock *lk);
+struct spinlock *spin_lock_list(void);
 
 #define spin_initlock(lock)   __spin_initlock(lock, #lock)
 
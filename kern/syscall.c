@@ -13,6 +13,11 @@
 #include <kern/sched.h>
 #include <kern/time.h>
 #include <kern/e1000.h>
+#include <kern/spinlock.h>
+
+static int page_alloc_at(struct Env *e, envid_t envid, void *va, int perm);
+static int page_map_at(struct Env *srce, envid_t srcenvid, void *srcva,
+		       struct Env *dste, envid_t dstenvid, void *dstva, int perm);
 
 // Print a string to the system console.
 // The string is exactly 'len' characters long.
@@ -24,10 +29,12 @@ sys_cputs(const char *s, size_t len)
 	// Destroy the environment if not.
 
 	// LAB 3: Your code here.
-	user_mem_assert(curenv, s, len, PTE_U);
+	// Hold our lock, so that nobody unmaps the string meanwhile.
+	user_mem_assert_lock(curenv, s, len, PTE_U);
 
 	// Print the string supplied by the user.
 	cprintf("%.*s", len, s);
+	env_unlock(curenv);
 }
 
 // Read a character from the system console without blocking.
@@ -45,6 +52,14 @@ sys_getenvid(void)
 	return curenv->env_id;
 }
 
+// Returns the number of CPUs, which are numbered 0 to ncpu-1 in
+// sys_env_set_affinity masks.
+static int
+sys_ncpu(void)
+{
+	return ncpu;
+}
+
 // Destroy a given environment (possibly the currently running environment).
 //
 // Returns 0 on success, < 0 on error.  Errors are:
@@ -62,6 +77,15 @@ sys_env_destroy(envid_t envid)
 	return 0;
 }
 
+// Returns the envid of the first environment of the given type, or 0 if
+// there is none.  This is how user code finds the file system and
+// network servers without scanning envs[].
+static envid_t
+sys_env_find(int type)
+{
+	return env_find(type);
+}
+
 // Deschedule current environment and pick a different one to run.
 static void
 sys_yield(void)
@@ -89,9 +113,62 @@ sys_exofork(void)
 	if ((r = env_alloc(&e, curenv->env_id)) < 0)
 	    return r;
 
+	sched_dequeue(e);
+	e->env_status = ENV_NOT_RUNNABLE;
+	e->env_cpumask = curenv->env_cpumask;
+	e->env_tf = curenv->env_tf;
+	e->env_tf.tf_regs.reg_eax = 0;
+	return e->env_id;
+}
+
+// Fork the current environment in one go.  Like sys_exofork, but the
+// child also gets the parent's address space, copy-on-write (see
+// pgdir_copy_cow), a fresh user exception stack page, and the parent's
+// page fault upcall, demand-zero regions and sys_env_set_kernel_cow
+// setting, and it is made
+// runnable.  Copy-on-write faults are left to the kernel or the upcall
+// according to that setting.
+//
+// Returns envid of new environment, or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_fork_cow(void)
+{
+	struct Env *e;
+	struct PageInfo *p;
+	int r;
+
+	if ((r = env_alloc(&e, curenv->env_id)) < 0)
+		return r;
+
+	sched_dequeue(e);
 	e->env_status = ENV_NOT_RUNNABLE;
+	e->env_cpumask = curenv->env_cpumask;
 	e->env_tf = curenv->env_tf;
 	e->env_tf.tf_regs.reg_eax = 0;
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+	e->env_kernel_cow = curenv->env_kernel_cow;
+
+	// The child's page tables are filled in without its lock: only
+	// we may change its mappings until it is runnable, and ksm_scan
+	// leaves environments that have never run alone.
+	env_lock(curenv);
+	r = pgdir_copy_cow(e->env_pgdir, curenv->env_pgdir);
+	memcpy(e->env_regions, curenv->env_regions, sizeof(e->env_regions));
+	env_unlock(curenv);
+
+	if (r == 0 && !(p = page_alloc(ALLOC_ZERO|ALLOC_HIGH)))
+		r = -E_NO_MEM;
+	if (r == 0 && (r = page_insert(e->env_pgdir, p, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+		page_free(p);
+	if (r < 0) {
+		env_free(e);
+		return r;
+	}
+
+	e->env_status = ENV_RUNNABLE;
+	sched_enqueue(e);
 	return e->env_id;
 }
 
@@ -121,10 +198,88 @@ sys_env_set_status(envid_t envid, int status)
 	if ((r = envid2env(envid, &e, 1)) < 0)
 		return r;
 
+	// An environment that is running or dying on some CPU is not on
+	// any run queue; the CPU running it takes care of it on its next
+	// trap, so just leave it alone if it's being made runnable.
+	if (status == ENV_RUNNABLE) {
+		if (e->env_status == ENV_NOT_RUNNABLE) {
+			e->env_status = ENV_RUNNABLE;
+			sched_enqueue(e);
+		}
+		return 0;
+	}
+
+	sched_dequeue(e);
 	e->env_status = status;
 	return 0;
 }
 
+// Set envid's scheduling priority.  'prio' is either a level between
+// ENV_PRIO_HIGHEST and ENV_PRIO_LOWEST, which pins the environment at
+// that level, or ENV_PRIO_DYNAMIC, which lets the feedback scheduler
+// promote and demote it according to how it behaves.
+// Only system environments (the file and network servers) may pin an
+// environment above ENV_PRIO_LOWEST.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if prio is not a valid priority, or the caller may not
+//		pin envid at prio.
+static int
+sys_env_set_priority(envid_t envid, int prio)
+{
+	struct Env *e;
+	int r;
+
+	if (prio != ENV_PRIO_DYNAMIC &&
+	    (prio < ENV_PRIO_HIGHEST || prio > ENV_PRIO_LOWEST))
+		return -E_INVAL;
+
+	if (prio != ENV_PRIO_DYNAMIC && prio != ENV_PRIO_LOWEST &&
+	    curenv->env_type == ENV_TYPE_USER)
+		return -E_INVAL;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+
+	sched_set_priority(e, prio);
+	return 0;
+}
+
+// Restrict envid to run only on the CPUs whose bits are set in 'mask'
+// (bit i stands for CPU i).  Bits for CPUs that don't exist are
+// ignored.  If envid is queued or running on a CPU that the new mask
+// excludes, it moves to an allowed CPU the next time it is scheduled.
+// New environments inherit the mask of the environment that created
+// them.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if mask doesn't include any CPU in the system.
+static int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+	struct Env *e;
+	int r;
+
+	if (ncpu < 32)
+		mask &= (1 << ncpu) - 1;
+	if (!mask)
+		return -E_INVAL;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+
+	e->env_cpumask = mask;
+	if (e->env_rq_cpu >= 0 && !(mask & (1 << e->env_rq_cpu))) {
+		sched_dequeue(e);
+		sched_enqueue(e);
+	}
+	return 0;
+}
+
 // Set envid's trap frame to 'tf'.
 // tf is modified to make sure that user environments always run at code
 // protection level 3 (CPL 3) with interrupts enabled.
@@ -172,6 +327,29 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 	return 0;
 }
 
+// Choose who resolves envid's write faults on PTE_COW pages.  If
+// 'enable', the kernel copies the page (or just makes it writable, if
+// nothing else maps it) and restarts the faulting instruction.
+// Otherwise, which is the default, these faults go to the page fault
+// upcall like any other, for environments with their own idea of
+// PTE_COW.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+static int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+
+	e->env_kernel_cow = !!enable;
+	return 0;
+}
+
 // Allocate a page of memory and map it at 'va' with permission
 // 'perm' in the address space of 'envid'.
 // The page's contents are set to 0.
@@ -185,6 +363,7 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 //	-E_BAD_ENV if environment envid doesn't currently exist,
 //		or the caller doesn't have permission to change envid.
 //	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_INVAL if va is inside a 4MB page (see sys_page_alloc_large).
 //	-E_INVAL if perm is inappropriate (see above).
 //	-E_NO_MEM if there's no memory to allocate the new page,
 //		or to allocate any necessary page tables.
@@ -212,17 +391,161 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 	if (!(perm & (PTE_U|PTE_P)) || (perm & ~PTE_SYSCALL))
 		return -E_INVAL;
 
-	p = page_alloc(ALLOC_ZERO);
+	return page_alloc_at(e, envid, va, perm);
+}
+
+// Allocate a zeroed page and map it at 'va' in e, whose id must still
+// be envid, for sys_page_alloc and sys_page_alloc_range.
+static int
+page_alloc_at(struct Env *e, envid_t envid, void *va, int perm)
+{
+	struct PageInfo *p;
+	int r;
+
+	p = page_alloc(ALLOC_ZERO|ALLOC_HIGH);
 	if (!p)
 		return -E_NO_MEM;
 
-	if ((r = page_insert(e->env_pgdir, p, va, perm)) < 0) {
+	if ((r = env_lock_checked(e, envid)) == 0) {
+		r = page_insert(e->env_pgdir, p, va, perm);
+		env_unlock(e);
+	}
+	if (r < 0) {
 		page_free(p);
 		return r;
 	}
 	return 0;
 }
 
+// Check that [va, va + npages * PGSIZE) is page-aligned and below UTOP.
+static bool
+page_range_ok(void *va, size_t npages)
+{
+	return PTE_ADDR(va) == (uintptr_t) va && (uintptr_t) va <= UTOP
+		&& npages <= (UTOP - (uintptr_t) va) / PGSIZE;
+}
+
+// Reserve [va, va+len) in envid's address space as a demand-zero
+// region: each page in it is allocated, zeroed and mapped with
+// permission 'perm' by the kernel the first time the environment
+// touches it, or passes it to a system call that reads or writes user
+// memory.  Until then, the pages are not mapped: sys_page_map and
+// sys_ipc_try_send don't see them, nor does uvpt.  Pages already
+// mapped in the region are left alone.
+//
+// perm -- same as sys_page_alloc, but without PTE_SHARE or PTE_COW:
+//         pages nobody has touched yet can't be shared.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if va is not page-aligned, or the region doesn't fit
+//		below UTOP, or it overlaps another region of envid.
+//	-E_INVAL if perm is inappropriate.
+//	-E_NO_MEM if envid has NENVREGION regions already.
+static int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+
+	len = ROUNDUP(len, PGSIZE);
+	if (!page_range_ok(va, len / PGSIZE) || len == 0)
+		return -E_INVAL;
+
+	if ((perm & (PTE_U|PTE_P)) != (PTE_U|PTE_P) || (perm & ~PTE_SYSCALL))
+		return -E_INVAL;
+
+	if ((r = env_lock_checked(e, envid)) < 0)
+		return r;
+	r = env_region_add(e, (uintptr_t) va, (uintptr_t) va + len, perm);
+	env_unlock(e);
+	return r;
+}
+
+// Like sys_page_alloc, for the npages pages starting at 'va'.
+//
+// Returns the number of pages allocated, which is less than npages if
+// allocating the next page failed, or < 0 if the first page failed or
+// the arguments are wrong.  The errors are those of sys_page_alloc,
+// plus -E_INVAL if the range doesn't fit below UTOP.
+static int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+	struct Env *e;
+	size_t i;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+
+	if (!page_range_ok(va, npages))
+		return -E_INVAL;
+
+	if (!(perm & (PTE_U|PTE_P)) || (perm & ~PTE_SYSCALL))
+		return -E_INVAL;
+
+	for (i = 0; i < npages; i++, va += PGSIZE)
+		if ((r = page_alloc_at(e, envid, va, perm)) < 0)
+			return i ? i : r;
+	return npages;
+}
+
+// Allocate 4MB of physically contiguous memory and map it as one 4MB
+// page at 'va' with permission 'perm' in the address space of 'envid',
+// so that the whole region costs a single TLB entry.  The memory is
+// set to 0.  Anything already mapped in [va, va+PTSIZE) is unmapped.
+//
+// A 4MB page is private to its environment: it can't be passed to
+// sys_page_map or sys_ipc_try_send, and fork and spawn don't copy it.
+// sys_page_unmap of any address inside it unmaps the whole 4MB.
+//
+// perm -- same as sys_page_alloc.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if va >= UTOP, or va is not 4MB-aligned.
+//	-E_INVAL if perm is inappropriate.
+//	-E_NO_MEM if there's no 4MB of contiguous free memory.
+//	-E_NOT_SUPP if the CPU has no 4MB pages.
+static int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+	struct Env *e;
+	int r;
+	struct PageInfo *p;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+
+	if ((uintptr_t) va >= UTOP || (uintptr_t) va % PTSIZE)
+		return -E_INVAL;
+
+	if ((perm & (PTE_U|PTE_P)) != (PTE_U|PTE_P) || (perm & ~PTE_SYSCALL))
+		return -E_INVAL;
+
+	if (!page_pse)
+		return -E_NOT_SUPP;
+
+	p = page_alloc_order(PAGE_LARGE_ORDER, ALLOC_ZERO);
+	if (!p)
+		return -E_NO_MEM;
+
+	if ((r = env_lock_checked(e, envid)) == 0) {
+		r = page_insert_large(e->env_pgdir, p, va, perm);
+		env_unlock(e);
+	}
+	if (r < 0) {
+		page_free_order(p, PAGE_LARGE_ORDER);
+		return r;
+	}
+	return 0;
+}
+
 // Map the page of memory at 'srcva' in srcenvid's address space
 // at 'dstva' in dstenvid's address space with permission 'perm'.
 // Perm has the same restrictions as in sys_page_alloc, except
@@ -253,8 +576,6 @@ sys_page_map(envid_t srcenvid, void *srcva,
 	// LAB 4: Your code here.
 	struct Env *srce, *dste;
 	int r;
-	struct PageInfo *p;
-	pte_t *pte;
 
 	if ((r = envid2env(srcenvid, &srce, 1)) < 0)
 		return r;
@@ -271,14 +592,61 @@ sys_page_map(envid_t srcenvid, void *srcva,
 	if (!(perm & (PTE_U|PTE_P)) || (perm & ~PTE_SYSCALL))
 		return -E_INVAL;
 
-	p = page_lookup(srce->env_pgdir, srcva, &pte);
-	if (!p)
-		return -E_INVAL;
+	return page_map_at(srce, srcenvid, srcva, dste, dstenvid, dstva, perm);
+}
+
+// Return the page at 'va' in e, which the caller has locked, for
+// mapping it elsewhere with 'perm', first faulting it in if it is an
+// untouched demand-zero page.  For a writable mapping, a copy-on-write
+// page the kernel would resolve on a write fault (always zero_page, and
+// any PTE_COW page if e uses kernel copy-on-write) is resolved now.
+// Returns NULL if nothing is mapped at 'va', or if (perm & PTE_W) but
+// 'va' is read-only in e.
+static struct PageInfo *
+page_lookup_src(struct Env *e, void *va, int perm)
+{
+	struct PageInfo *p;
+	pte_t *pte;
 
-	if ((perm & PTE_W) && !(*pte & PTE_W))
+	env_region_fault(e, (uintptr_t) va, perm & PTE_W);
+	p = page_lookup(e->env_pgdir, va, &pte);
+	if (p && (perm & PTE_W) && (*pte & PTE_COW)
+	    && page_fault_cow(e->env_pgdir, va, !e->env_kernel_cow) == 0)
+		p = page_lookup(e->env_pgdir, va, &pte);
+	if (p && (perm & PTE_W) && !(*pte & PTE_W))
+		return NULL;
+	return p;
+}
+
+// Map the page at 'srcva' in srce at 'dstva' in dste, whose ids must
+// still be srcenvid and dstenvid, for sys_page_map and
+// sys_page_map_range.
+static int
+page_map_at(struct Env *srce, envid_t srcenvid, void *srcva,
+	    struct Env *dste, envid_t dstenvid, void *dstva, int perm)
+{
+	struct PageInfo *p;
+	int r;
+
+	if ((r = env_lock_checked(srce, srcenvid)) < 0)
+		return r;
+
+	p = page_lookup_src(srce, srcva, perm);
+
+	// Hold a reference to the page, so that it stays around even
+	// if srce unmaps it once we let go of srce's lock.
+	if (p)
+		page_incref(p);
+	env_unlock(srce);
+	if (!p)
 		return -E_INVAL;
 
-	return page_insert(dste->env_pgdir, p, dstva, perm);
+	if ((r = env_lock_checked(dste, dstenvid)) == 0) {
+		r = page_insert(dste->env_pgdir, p, dstva, perm);
+		env_unlock(dste);
+	}
+	page_decref(p);
+	return r;
 }
 
 // Unmap the page of memory at 'va' in the address space of 'envid'.
@@ -303,10 +671,72 @@ sys_page_unmap(envid_t envid, void *va)
 	if ((uintptr_t) va >= UTOP || PTE_ADDR(va) != (uintptr_t) va)
 		return -E_INVAL;
 
+	if ((r = env_lock_checked(e, envid)) < 0)
+		return r;
 	page_remove(e->env_pgdir, va);
+	env_unlock(e);
 	return 0;
 }
 
+// Like sys_page_map, for the npages pages starting at 'srcva' and
+// 'dstva'.  With the same environment and addresses on both sides,
+// this changes the permissions of a range of pages.
+//
+// Returns the number of pages mapped, which is less than npages if
+// mapping the next page failed, or < 0 if the first page failed or
+// the arguments are wrong.  The errors are those of sys_page_map,
+// plus -E_INVAL if either range doesn't fit below UTOP.
+static int
+sys_page_map_range(envid_t srcenvid, void *srcva,
+		   envid_t dstenvid, void *dstva, size_t npages, int perm)
+{
+	struct Env *srce, *dste;
+	size_t i;
+	int r;
+
+	if ((r = envid2env(srcenvid, &srce, 1)) < 0)
+		return r;
+
+	if ((r = envid2env(dstenvid, &dste, 1)) < 0)
+		return r;
+
+	if (!page_range_ok(srcva, npages) || !page_range_ok(dstva, npages))
+		return -E_INVAL;
+
+	if (!(perm & (PTE_U|PTE_P)) || (perm & ~PTE_SYSCALL))
+		return -E_INVAL;
+
+	for (i = 0; i < npages; i++, srcva += PGSIZE, dstva += PGSIZE)
+		if ((r = page_map_at(srce, srcenvid, srcva, dste, dstenvid, dstva, perm)) < 0)
+			return i ? i : r;
+	return npages;
+}
+
+// Like sys_page_unmap, for the npages pages starting at 'va'.
+//
+// Returns npages, or < 0 on error.  The errors are those of
+// sys_page_unmap, plus -E_INVAL if the range doesn't fit below UTOP.
+static int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+	struct Env *e;
+	size_t i;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+
+	if (!page_range_ok(va, npages))
+		return -E_INVAL;
+
+	if ((r = env_lock_checked(e, envid)) < 0)
+		return r;
+	for (i = 0; i < npages; i++, va += PGSIZE)
+		page_remove(e->env_pgdir, va);
+	env_unlock(e);
+	return npages;
+}
+
 // Try to send 'value' to the target env 'envid'.
 // If srcva < UTOP, then also send page currently mapped at 'srcva',
 // so that receiver gets a duplicate mapping of the same page.
@@ -345,18 +775,25 @@ sys_page_unmap(envid_t envid, void *va)
 //		current environment's address space.
 //	-E_NO_MEM if there's not enough memory to map srcva in envid's
 //		address space.
+//
+// If 'yield' is set and the send succeeds, this CPU switches straight
+// to the target, which gets the rest of our time slice, and the system
+// call returns 0 once we are scheduled again (see sched_yield_to).  If
+// the target's affinity mask excludes this CPU, it is just woken up, as
+// without 'yield'.
 static int
-sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+		 bool yield)
 {
 	// LAB 4: Your code here.
 	struct Env *e;
 	int r;
-	struct PageInfo *p;
-	pte_t *pte;
+	struct PageInfo *p = NULL;
 
 	if ((r = envid2env(envid, &e, 0)) < 0)
 		return r;
 
+	// Cheap early test, repeated below under e's lock.
 	if (!e->env_ipc_recving)
 		return -E_IPC_NOT_RECV;
 
@@ -367,26 +804,64 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 		if (!(perm & (PTE_U|PTE_P)) || (perm & ~PTE_SYSCALL))
 			return -E_INVAL;
 
-		p = page_lookup(curenv->env_pgdir, srcva, &pte);
+		// As in sys_page_map, hold a reference to the page
+		// while we don't hold our own lock.
+		env_lock(curenv);
+		p = page_lookup_src(curenv, srcva, perm);
+		if (p)
+			page_incref(p);
+		env_unlock(curenv);
 		if (!p)
 			return -E_INVAL;
+	}
 
-		if ((perm & PTE_W) && !(*pte & PTE_W))
-			return -E_INVAL;
-
-		if ((uintptr_t) e->env_ipc_dstva < UTOP && PTE_ADDR(e->env_ipc_dstva) == (uintptr_t) e->env_ipc_dstva) {
-			if ((r = page_insert(e->env_pgdir, p, e->env_ipc_dstva, perm)) < 0)
-				return r;
+	if ((r = env_lock_checked(e, envid)) < 0)
+		goto out;
+	if (!e->env_ipc_recving) {
+		r = -E_IPC_NOT_RECV;
+		goto unlock;
+	}
 
-			e->env_ipc_perm = perm;
-		}
+	e->env_ipc_perm = 0;
+	if (p && (uintptr_t) e->env_ipc_dstva < UTOP) {
+		if ((r = page_insert(e->env_pgdir, p, e->env_ipc_dstva, perm)) < 0)
+			goto unlock;
+		e->env_ipc_perm = perm;
 	}
 
 	e->env_ipc_recving = 0;
 	e->env_ipc_value = value;
 	e->env_ipc_from = curenv->env_id;
+	envid = e->env_id;
+	env_unlock(e);
+	if (p)
+		page_decref(p);
+
+	// Waking e up needs the big kernel lock.  Until we have it, e
+	// is NOT_RUNNABLE, but it may be destroyed in the meantime.
+	lock_kernel();
+	if (e->env_id != envid || e->env_status != ENV_NOT_RUNNABLE) {
+		unlock_kernel();
+		return 0;
+	}
 	e->env_status = ENV_RUNNABLE;
+	// Another CPU may have destroyed (or stopped) us meanwhile; then
+	// just wake e, and leave the rest to trap(), as for any other
+	// system call that returns.
+	if (yield && curenv->env_status == ENV_RUNNING) {
+		curenv->env_tf.tf_regs.reg_eax = 0;
+		sched_yield_to(e);
+	}
+	sched_wakeup(e);
+	unlock_kernel();
 	return 0;
+
+unlock:
+	env_unlock(e);
+out:
+	if (p)
+		page_decref(p);
+	return r;
 }
 
 // Block until a value is ready.  Record that you want to receive
@@ -407,12 +882,16 @@ sys_ipc_recv(void *dstva)
 	if ((uintptr_t) dstva < UTOP) {
 		if (PTE_ADDR(dstva) != (uint32_t) dstva)
 			return -E_INVAL;
-
-		curenv->env_ipc_dstva = dstva;
 	}
 
+	// Senders look at our IPC state under our lock, without the big
+	// kernel lock; by the time they see env_ipc_recving set, we must
+	// be NOT_RUNNABLE.
+	env_lock(curenv);
+	curenv->env_ipc_dstva = dstva;
 	curenv->env_ipc_recving = 1;
 	curenv->env_status = ENV_NOT_RUNNABLE;
+	env_unlock(curenv);
 	curenv->env_tf.tf_regs.reg_eax = 0;
 	sched_yield();
 	return 0;
@@ -450,8 +929,8 @@ sys_net_try_receive(void *data, size_t *size)
 }
 
 // Dispatches to the correct kernel function, passing the arguments.
-int32_t
-syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+static int32_t
+syscall_dispatch(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
 {
 	// Call the function corresponding to the 'syscallno' parameter.
 	// Return any appropriate return value.
@@ -465,27 +944,53 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 		return sys_cgetc();
 	case SYS_getenvid:
 		return sys_getenvid();
+	case SYS_ncpu:
+		return sys_ncpu();
 	case SYS_env_destroy:
 		return sys_env_destroy(a1);
+	case SYS_env_find:
+		return sys_env_find(a1);
 	case SYS_page_alloc:
 		return sys_page_alloc(a1, (void *) a2, a3);
+	case SYS_page_alloc_large:
+		return sys_page_alloc_large(a1, (void *) a2, a3);
 	case SYS_page_map:
 		return sys_page_map(a1, (void *) a2, a3, (void *) a4, a5);
 	case SYS_page_unmap:
 		return sys_page_unmap(a1, (void *) a2);
+	case SYS_page_alloc_range:
+		return sys_page_alloc_range(a1, (void *) a2, a3, a4);
+	case SYS_page_map_range:
+		// The page count and permissions share the last argument
+		return sys_page_map_range(a1, (void *) a2, a3, (void *) a4,
+					  a5 >> PGSHIFT, PGOFF(a5));
+	case SYS_page_unmap_range:
+		return sys_page_unmap_range(a1, (void *) a2, a3);
+	case SYS_region_reserve:
+		return sys_region_reserve(a1, (void *) a2, a3, a4);
 	case SYS_exofork:
 		return sys_exofork();
+	case SYS_fork_cow:
+		return sys_fork_cow();
 	case SYS_env_set_status:
 		return sys_env_set_status(a1, a2);
+	case SYS_env_set_priority:
+		return sys_env_set_priority(a1, a2);
+	case SYS_env_set_affinity:
+		return sys_env_set_affinity(a1, a2);
 	case SYS_env_set_trapframe:
 		return sys_env_set_trapframe(a1, (struct Trapframe *) a2);
+	case SYS_env_set_kernel_cow:
+		return sys_env_set_kernel_cow(a1, a2);
 	case SYS_env_set_pgfault_upcall:
 		return sys_env_set_pgfault_upcall(a1, (void *) a2);
 	case SYS_yield:
 		sys_yield();
 		return 0;
 	case SYS_ipc_try_send:
-		return sys_ipc_try_send(a1, a2, (void *)a3, a4);
+		return sys_ipc_try_send(a1, a2, (void *)a3, a4, 0);
+	case SYS_ipc_try_send_yield:
+		return sys_ipc_try_send(a1, a2, (void *)a3, a4, 1);
 	case SYS_ipc_recv:
 		return sys_ipc_recv((void *) a1);
 	case SYS_time_msec:
@@ -499,3 +1004,82 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 	}
 }
 
+// Handle the system call in tf on the spot if it is one of the few
+// that touch nothing but curenv, word-sized counters and the console
+// (which has its own lock): sys_getenvid, sys_ncpu, sys_time_msec,
+// sys_cgetc, and sys_yield when there is nothing else to run on this
+// CPU.
+// trap() calls this before taking any locks or even saving tf in
+// curenv.  Returns 1, with the result in tf's %eax, if the system call
+// was handled, or 0 if it has to go through syscall().
+bool
+syscall_fast(struct Trapframe *tf)
+{
+	int32_t r;
+
+	switch (tf->tf_regs.reg_eax) {
+	case SYS_getenvid:
+		r = sys_getenvid();
+		break;
+	case SYS_ncpu:
+		r = sys_ncpu();
+		break;
+	case SYS_time_msec:
+		r = sys_time_msec();
+		break;
+	case SYS_cgetc:
+		r = sys_cgetc();
+		break;
+	case SYS_yield:
+		if (!sched_yield_is_noop())
+			return 0;
+		r = 0;
+		break;
+	default:
+		return 0;
+	}
+	tf->tf_regs.reg_eax = r;
+	return 1;
+}
+
+// Does system call 'syscallno' do its own locking?  These run without
+// the big kernel lock, so that, for example, two environments can
+// allocate pages on two CPUs at once.  They may only touch another
+// environment under its lock (see env_lock_checked), and must take the
+// big kernel lock for anything to do with scheduling.
+static bool
+syscall_unlocked(uint32_t syscallno)
+{
+	switch (syscallno) {
+	case SYS_page_alloc:
+	case SYS_page_alloc_large:
+	case SYS_page_map:
+	case SYS_page_unmap:
+	case SYS_page_alloc_range:
+	case SYS_page_map_range:
+	case SYS_page_unmap_range:
+	case SYS_region_reserve:
+	case SYS_ipc_try_send:
+	case SYS_ipc_try_send_yield:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+// Called from trap() without the big kernel lock.  Runs the system
+// call, under the big kernel lock unless it does its own locking, and
+// returns without the big kernel lock.
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	bool locked = !syscall_unlocked(syscallno);
+	int32_t r;
+
+	if (locked)
+		lock_kernel();
+	r = syscall_dispatch(syscallno, a1, a2, a3, a4, a5);
+	if (locked)
+		unlock_kernel();
+	return r;
+}
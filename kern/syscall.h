@@ -5,7 +5,9 @@
 #endif
 
 #include <inc/syscall.h>
+#include <inc/trap.h>
 
 int32_t syscall(uint32_t num, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5);
+bool syscall_fast(struct Trapframe *tf);
 
 #endif /* !JOS_KERN_SYSCALL_H */
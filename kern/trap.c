@@ -218,15 +218,29 @@ trap_dispatch(struct Trapframe *tf)
 	// triggered on every CPU.
 	// LAB 6: Your code here.
 	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER) {
-		static int i = 0;
-
-		if (!(++i % ncpu)) {
-			i = 0;
+		// Idle CPUs other than the boot CPU stop their timer
+		// (see sched_halt), so the boot CPU keeps the time.
+		if (thiscpu == bootcpu)
 			time_tick();
-		}
 
 		lapic_eoi();
-		sched_yield();
+		sched_tick();
+		return;
+	}
+
+	// Another CPU queued work for us, or has work we could steal.
+	// Just return: trap() runs the scheduler if we were idle.
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_WAKEUP) {
+		lapic_eoi();
+		return;
+	}
+
+	// A shootdown that reached us after we left the environment it
+	// was for.  It still has to be acknowledged.
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TLB) {
+		lapic_eoi();
+		tlb_shootdown_recv();
+		return;
 	}
 
 	// Handle keyboard and serial interrupts.
@@ -264,9 +278,12 @@ trap(struct Trapframe *tf)
 		asm volatile("hlt");
 
 	// Re-acqurie the big kernel lock if we were halted in
-	// sched_yield()
-	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+	// sched_yield(), and restart the tick that sched_halt() stopped
+	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED) {
 		lock_kernel();
+		if (thiscpu != bootcpu)
+			lapic_timer_start();
+	}
 	// Check that interrupts are disabled.  If this assertion
 	// fails, DO NOT be tempted to fix it by inserting a "cli" in
 	// the interrupt path.
@@ -274,15 +291,31 @@ trap(struct Trapframe *tf)
 
 	if ((tf->tf_cs & 3) == 3) {
 		// Trapped from user mode.
+		assert(curenv);
+
+		// So are TLB shootdowns, which mustn't wait for any lock.
+		if (tf->tf_trapno == IRQ_OFFSET + IRQ_TLB) {
+			lapic_eoi();
+			tlb_shootdown_recv();
+			env_pop_tf(tf);
+		}
+
+		// Some system calls are answered straight away.
+		if (tf->tf_trapno == T_SYSCALL &&
+		    curenv->env_status == ENV_RUNNING && syscall_fast(tf))
+			env_pop_tf(tf);
+
 		// Acquire the big kernel lock before doing any
-		// serious kernel work.
+		// serious kernel work.  System calls take it themselves
+		// if they need it (see syscall()).
 		// LAB 4: Your code here.
-		lock_kernel();
-
-		assert(curenv);
+		if (tf->tf_trapno != T_SYSCALL)
+			lock_kernel();
 
 		// Garbage collect if current enviroment is a zombie
 		if (curenv->env_status == ENV_DYING) {
+			if (tf->tf_trapno == T_SYSCALL)
+				lock_kernel();
 			env_free(curenv);
 			curenv = NULL;
 			sched_yield();
@@ -303,6 +336,21 @@ trap(struct Trapframe *tf)
 	// Dispatch based on what type of trap occurred
 	trap_dispatch(tf);
 
+	// System calls that return come back without the big kernel
+	// lock.  Go straight back to curenv if it can carry on;
+	// otherwise, it was stopped or destroyed by another CPU while
+	// we were in the system call, and we need the lock to deal
+	// with that.
+	if (tf->tf_trapno == T_SYSCALL) {
+		if (curenv->env_status == ENV_RUNNING)
+			env_pop_tf(tf);
+		lock_kernel();
+		if (curenv->env_status == ENV_DYING) {
+			env_free(curenv);
+			curenv = NULL;
+		}
+	}
+
 	// If we made it to this point, then no other environment was
 	// scheduled, so we should return to the current environment
 	// if doing so makes sense.
@@ -319,6 +367,7 @@ page_fault_handler(struct Trapframe *tf)
 	uint32_t fault_va;
 	uintptr_t tf_esp;
 	struct UTrapframe *utf;
+	int r;
 
 	// Read processor's CR2 register to find the faulting address
 	fault_va = rcr2();
@@ -363,13 +412,34 @@ page_fault_handler(struct Trapframe *tf)
 	//   (the 'tf' variable points at 'curenv->env_tf').
 
 	// LAB 4: Your code here.
+	// The first touch of a demand-zero page is resolved right here
+	// (see sys_region_reserve).
+	if (!(tf->tf_err & FEC_PR)) {
+		env_lock(curenv);
+		r = env_region_fault(curenv, fault_va, tf->tf_err & FEC_WR);
+		env_unlock(curenv);
+		if (r == 0)
+			env_run(curenv);
+	}
+
+	// So are copy-on-write faults on the shared zero page, and all
+	// copy-on-write faults if the environment asked for it (see
+	// sys_env_set_kernel_cow).
+	if ((tf->tf_err & FEC_WR) && (tf->tf_err & FEC_PR)) {
+		env_lock(curenv);
+		r = page_fault_cow(curenv->env_pgdir, (void *) fault_va, !curenv->env_kernel_cow);
+		env_unlock(curenv);
+		if (r == 0)
+			env_run(curenv);
+	}
+
 	if (curenv->env_pgfault_upcall) {
 		if (tf->tf_esp < UXSTACKTOP - PGSIZE || tf->tf_esp >= UXSTACKTOP)
 			tf_esp = UXSTACKTOP - sizeof(struct UTrapframe);
 		else
 			tf_esp = tf->tf_esp - sizeof(struct UTrapframe) - 4;
 
-		user_mem_assert(curenv, (void *) tf_esp, sizeof(struct UTrapframe), PTE_W);
+		user_mem_assert_lock(curenv, (void *) tf_esp, sizeof(struct UTrapframe), PTE_W);
 		utf = (struct UTrapframe *) tf_esp;
 		utf->utf_fault_va = fault_va;
 		utf->utf_err = tf->tf_err;
@@ -377,6 +447,7 @@ page_fault_handler(struct Trapframe *tf)
 		utf->utf_eip = tf->tf_eip;
 		utf->utf_eflags = tf->tf_eflags;
 		utf->utf_esp = tf->tf_esp;
+		env_unlock(curenv);
 
 		tf->tf_eip = (uintptr_t) curenv->env_pgfault_upcall;
 		tf->tf_esp = tf_esp;
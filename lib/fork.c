@@ -3,10 +3,6 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW		0x800
-
 //
 // Custom page fault handler - if faulting page is copy-on-write,
 // map in our own private writable copy.
@@ -98,6 +94,9 @@ duppage(envid_t envid, unsigned pn)
 //   Neither user exception stack should ever be marked copy-on-write,
 //   so you must allocate a new page for the child's user exception stack.
 //
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
 envid_t
 fork(void)
 {
@@ -108,6 +107,19 @@ fork(void)
 
 	set_pgfault_handler(pgfault);
 
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+
+	envid = sys_fork_cow();
+	if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+		return envid;
+
 	envid = sys_exofork();
 	if (envid < 0)
 		panic("sys_exofork: %e", envid);
@@ -119,7 +131,8 @@ fork(void)
 
 	for (pn = 0; pn < PGNUM(UTOP); pn++) {
 		uintptr_t va = pn << PGSHIFT;
-		if (!(uvpd[PDX(va)] & PTE_P))
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
 			continue;
 
 		if (!(uvpt[pn] & PTE_P))
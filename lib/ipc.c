@@ -47,19 +47,20 @@ ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
 //   Use sys_yield() to be CPU-friendly.
 //   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
 //   as meaning "no page".  (Zero is not the right value.)
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
 void
 ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
 {
 	// LAB 4: Your code here.
 	int r;
 
-	do {
-		if ((r = sys_ipc_try_send(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
-			if (r != -E_IPC_NOT_RECV)
-				panic("sys_ipc_try_send: %e", r);
-		}
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+		if (r != -E_IPC_NOT_RECV)
+			panic("sys_ipc_try_send: %e", r);
 		sys_yield();
-	} while (r);
+	}
 }
 
 // Find the first environment of the given type.  We'll use this to
@@ -68,9 +69,7 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
 envid_t
 ipc_find_env(enum EnvType type)
 {
-	int i;
-	for (i = 0; i < NENV; i++)
-		if (envs[i].env_type == type)
-			return envs[i].env_id;
-	return 0;
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
 }
@@ -41,7 +41,7 @@ isfree(void *v, size_t n)
 void*
 malloc(size_t n)
 {
-	int i, cont;
+	int npages;
 	int nwrap;
 	uint32_t *ref;
 	void *v;
@@ -94,17 +94,16 @@ malloc(size_t n)
 
 	/*
 	 * allocate at mptr - the +4 makes sure we allocate a ref count.
+	 * all pages but the last are continued.
 	 */
-	for (i = 0; i < n + 4; i += PGSIZE){
-		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
-		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
-			for (; i >= 0; i -= PGSIZE)
-				sys_page_unmap(0, mptr + i);
-			return 0;	/* out of physical memory */
-		}
+	npages = ROUNDUP(n + 4, PGSIZE) / PGSIZE;
+	if (sys_page_alloc_range(0, mptr, npages - 1, PTE_P|PTE_U|PTE_W|PTE_CONTINUED) != npages - 1
+	    || sys_page_alloc(0, mptr + (npages - 1) * PGSIZE, PTE_P|PTE_U|PTE_W) < 0) {
+		sys_page_unmap_range(0, mptr, npages);
+		return 0;	/* out of physical memory */
 	}
 
-	ref = (uint32_t*) (mptr + i - 4);
+	ref = (uint32_t*) (mptr + npages * PGSIZE - 4);
 	*ref = 2;	/* reference for mptr, reference for returned block */
 	v = mptr;
 	mptr += n;
@@ -116,6 +115,7 @@ free(void *v)
 {
 	uint8_t *c;
 	uint32_t *ref;
+	int npages;
 
 	if (v == 0)
 		return;
@@ -123,11 +123,10 @@ free(void *v)
 
 	c = ROUNDDOWN(v, PGSIZE);
 
-	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
-		sys_page_unmap(0, c);
-		c += PGSIZE;
-		assert(mbegin <= c && c < mend);
-	}
+	for (npages = 0; uvpt[PGNUM(c + npages * PGSIZE)] & PTE_CONTINUED; npages++)
+		assert(c + (npages + 1) * PGSIZE < mend);
+	sys_page_unmap_range(0, c, npages);
+	c += npages * PGSIZE;
 
 	/*
 	 * c is just a piece of this page, so dec the ref count
@@ -263,7 +263,7 @@ static int
 map_segment(envid_t child, uintptr_t va, size_t memsz,
 	int fd, size_t filesz, off_t fileoffset, int perm)
 {
-	int i, r;
+	int i, j, n, r;
 	void *blk;
 
 	//cprintf("map_segment %x+%x\n", va, memsz);
@@ -275,24 +275,25 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
 		fileoffset -= i;
 	}
 
-	for (i = 0; i < memsz; i += PGSIZE) {
-		if (i >= filesz) {
-			// allocate a blank page
-			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+	// from file, as many pages at a time as fit below PFTEMP
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+		for (j = 0; j < n; j += r)
+			if ((r = sys_page_alloc_range(0, UTEMP + j * PGSIZE, n - j, PTE_P|PTE_U|PTE_W)) < 0)
 				return r;
-		} else {
-			// from file
-			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
-				return r;
-			if ((r = seek(fd, fileoffset + i)) < 0)
-				return r;
-			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
-				return r;
-			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
-				panic("spawn: sys_page_map data: %e", r);
-			sys_page_unmap(0, UTEMP);
-		}
+		if ((r = seek(fd, fileoffset + i)) < 0)
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+			return r;
+		for (j = 0; j < n; j += r)
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+				panic("spawn: sys_page_map_range data: %e", r);
+		sys_page_unmap_range(0, UTEMP, n);
 	}
+
+	// the rest is zero-filled on demand
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+		return r;
 	return 0;
 }
 
@@ -301,21 +302,29 @@ static int
 copy_shared_pages(envid_t child)
 {
 	// LAB 5: Your code here.
-	uint32_t pn;
+	uint32_t pn, n;
 	void *va;
-	int r;
+	int perm, r;
 
-	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+		n = 1;
 		va = (void *) (pn << PGSHIFT);
-		if (!(uvpd[PDX(va)] & PTE_P))
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
 			continue;
 		if (!(uvpt[pn] & PTE_P))
 			continue;
 		if (!(uvpt[pn] & PTE_SHARE))
 			continue;
 
-		if ((r = sys_page_map(0, va, child, va, uvpt[pn] & PTE_SYSCALL)) < 0)
-			panic("sys_page_map: %e", r);
+		// Share the whole run of pages with the same permissions
+		// in one go.
+		perm = uvpt[pn] & PTE_SYSCALL;
+		while (pn + n < PGNUM(UTOP)
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+			n++;
+		if ((r = sys_page_map_range(0, va, child, va, n, perm)) != n)
+			panic("sys_page_map_range: %e", r < 0 ? r : -E_NO_MEM);
 	}
 	return 0;
 }
@@ -49,6 +49,12 @@ sys_cgetc(void)
 	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
 }
 
+envid_t
+sys_env_find(enum EnvType type)
+{
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+
 int
 sys_env_destroy(envid_t envid)
 {
@@ -67,12 +73,30 @@ sys_yield(void)
 	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
 }
 
+envid_t
+sys_fork_cow(void)
+{
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+
 int
 sys_page_alloc(envid_t envid, void *va, int perm)
 {
 	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
 }
 
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+
 int
 sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
 {
@@ -85,6 +109,33 @@ sys_page_unmap(envid_t envid, void *va)
 	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
 }
 
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+}
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+
 // sys_exofork is inlined in lib.h
 
 int
@@ -93,6 +144,24 @@ sys_env_set_status(envid_t envid, int status)
 	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
 }
 
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+
+int
+sys_ncpu(void)
+{
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+
 int
 sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
 {
@@ -111,6 +180,12 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
 	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
 }
 
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+
 int
 sys_ipc_recv(void *dstva)
 {
@@ -33,6 +33,13 @@ struct netif nif;
 
 #define debug 0
 
+// With at least NS_PIN_NCPU CPUs, the network server, its timer and
+// its output helper keep to the next-to-last CPU (the last is the file
+// server's; see fs/serv.c for the trade-off).  The input helper
+// busy-polls the card, so it is left free to run anywhere rather than
+// compete with lwIP for that CPU.
+#define NS_PIN_NCPU 4
+
 struct timer_thread {
 	uint32_t msec;
 	void (*func)(void);
@@ -315,9 +322,19 @@ void
 umain(int argc, char **argv)
 {
 	envid_t ns_envid = sys_getenvid();
+	int ncpu, r;
 
 	binaryname = "ns";
 
+	// Packet processing is latency sensitive; keep it ahead of batch jobs.
+	if ((r = sys_env_set_priority(0, ENV_PRIO_HIGHEST)) < 0)
+		panic("sys_env_set_priority: %e", r);
+
+	// The helpers forked below inherit the mask.
+	if ((ncpu = sys_ncpu()) >= NS_PIN_NCPU
+	    && (r = sys_env_set_affinity(0, 1 << (ncpu - 2))) < 0)
+		panic("sys_env_set_affinity: %e", r);
+
 	// fork off the timer thread which will send us periodic messages
 	timer_envid = fork();
 	if (timer_envid < 0)
@@ -336,6 +353,11 @@ umain(int argc, char **argv)
 		input(ns_envid);
 		return;
 	}
+	if ((r = sys_env_set_priority(input_envid, ENV_PRIO_HIGHEST)) < 0)
+		panic("sys_env_set_priority: %e", r);
+	if (ncpu >= NS_PIN_NCPU
+	    && (r = sys_env_set_affinity(input_envid, (1 << ncpu) - 1)) < 0)
+		panic("sys_env_set_affinity: %e", r);
 
 	// fork off the output thread that will send the packets to the NIC
 	// driver
@@ -346,6 +368,8 @@ umain(int argc, char **argv)
 		output(ns_envid);
 		return;
 	}
+	if ((r = sys_env_set_priority(output_envid, ENV_PRIO_HIGHEST)) < 0)
+		panic("sys_env_set_priority: %e", r);
 
 	// lwIP requires a user threading library; start the library and jump
 	// into a thread to continue initialization.
@@ -0,0 +1,8611 @@
+
+obj/fs/fs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ca 19 00 00       	call   8019fb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ide_wait_ready>:
+
+static int diskno = 1;
+
+static int
+ide_wait_ready(bool check_error)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	89 c3                	mov    %eax,%ebx
+
+static __inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800039:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80003e:	ec                   	in     (%dx),%al
+	int r;
+
+	while (((r = inb(0x1F7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+  80003f:	89 c1                	mov    %eax,%ecx
+  800041:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800044:	80 f9 40             	cmp    $0x40,%cl
+  800047:	75 f5                	jne    80003e <ide_wait_ready+0xb>
+		/* do nothing */;
+
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+		return -1;
+	return 0;
+  800049:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+  80004e:	84 db                	test   %bl,%bl
+  800050:	74 0a                	je     80005c <ide_wait_ready+0x29>
+  800052:	a8 21                	test   $0x21,%al
+  800054:	0f 95 c2             	setne  %dl
+  800057:	0f b6 d2             	movzbl %dl,%edx
+  80005a:	f7 da                	neg    %edx
+}
+  80005c:	89 d0                	mov    %edx,%eax
+  80005e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800061:	c9                   	leave
+  800062:	c3                   	ret
+
+00800063 <ide_probe_disk1>:
+
+bool
+ide_probe_disk1(void)
+{
+  800063:	55                   	push   %ebp
+  800064:	89 e5                	mov    %esp,%ebp
+  800066:	53                   	push   %ebx
+  800067:	83 ec 04             	sub    $0x4,%esp
+	int r, x;
+
+	// wait for Device 0 to be ready
+	ide_wait_ready(0);
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006f:	e8 bf ff ff ff       	call   800033 <ide_wait_ready>
+}
+
+static __inline void
+outb(int port, uint8_t data)
+{
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800074:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  800079:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80007e:	ee                   	out    %al,(%dx)
+
+	// switch to Device 1
+	outb(0x1F6, 0xE0 | (1<<4));
+
+	// check for Device 1 to be ready for a while
+	for (x = 0;
+  80007f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800084:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800089:	ec                   	in     (%dx),%al
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  80008a:	a8 a1                	test   $0xa1,%al
+  80008c:	74 0b                	je     800099 <ide_probe_disk1+0x36>
+	     x++)
+  80008e:	83 c1 01             	add    $0x1,%ecx
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  800091:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  800097:	75 f0                	jne    800089 <ide_probe_disk1+0x26>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800099:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  80009e:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  8000a3:	ee                   	out    %al,(%dx)
+		/* do nothing */;
+
+	// switch back to Device 0
+	outb(0x1F6, 0xE0 | (0<<4));
+
+	cprintf("Device 1 presence: %d\n", (x < 1000));
+  8000a4:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  8000aa:	0f 9e c3             	setle  %bl
+  8000ad:	83 ec 08             	sub    $0x8,%esp
+  8000b0:	0f b6 c3             	movzbl %bl,%eax
+  8000b3:	50                   	push   %eax
+  8000b4:	68 c0 40 80 00       	push   $0x8040c0
+  8000b9:	e8 78 1a 00 00       	call   801b36 <cprintf>
+	return (x < 1000);
+}
+  8000be:	89 d8                	mov    %ebx,%eax
+  8000c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000c3:	c9                   	leave
+  8000c4:	c3                   	ret
+
+008000c5 <ide_set_disk>:
+
+void
+ide_set_disk(int d)
+{
+  8000c5:	55                   	push   %ebp
+  8000c6:	89 e5                	mov    %esp,%ebp
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (d != 0 && d != 1)
+  8000ce:	83 f8 01             	cmp    $0x1,%eax
+  8000d1:	77 07                	ja     8000da <ide_set_disk+0x15>
+		panic("bad disk number");
+	diskno = d;
+  8000d3:	a3 00 50 80 00       	mov    %eax,0x805000
+}
+  8000d8:	c9                   	leave
+  8000d9:	c3                   	ret
+		panic("bad disk number");
+  8000da:	83 ec 04             	sub    $0x4,%esp
+  8000dd:	68 d7 40 80 00       	push   $0x8040d7
+  8000e2:	6a 3a                	push   $0x3a
+  8000e4:	68 e7 40 80 00       	push   $0x8040e7
+  8000e9:	e8 6d 19 00 00       	call   801a5b <_panic>
+
+008000ee <ide_read>:
+
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  8000ee:	55                   	push   %ebp
+  8000ef:	89 e5                	mov    %esp,%ebp
+  8000f1:	57                   	push   %edi
+  8000f2:	56                   	push   %esi
+  8000f3:	53                   	push   %ebx
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8000fd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	assert(nsecs <= 256);
+  800100:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  800106:	0f 87 87 00 00 00    	ja     800193 <ide_read+0xa5>
+
+	ide_wait_ready(0);
+  80010c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800111:	e8 1d ff ff ff       	call   800033 <ide_wait_ready>
+  800116:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  80011b:	89 f0                	mov    %esi,%eax
+  80011d:	ee                   	out    %al,(%dx)
+  80011e:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  800123:	89 f8                	mov    %edi,%eax
+  800125:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsecs);
+	outb(0x1F3, secno & 0xFF);
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  800126:	89 f8                	mov    %edi,%eax
+  800128:	c1 e8 08             	shr    $0x8,%eax
+  80012b:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  800130:	ee                   	out    %al,(%dx)
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  800131:	89 f8                	mov    %edi,%eax
+  800133:	c1 e8 10             	shr    $0x10,%eax
+  800136:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  80013b:	ee                   	out    %al,(%dx)
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  80013c:	0f b6 05 00 50 80 00 	movzbl 0x805000,%eax
+  800143:	c1 e0 04             	shl    $0x4,%eax
+  800146:	83 e0 10             	and    $0x10,%eax
+  800149:	c1 ef 18             	shr    $0x18,%edi
+  80014c:	83 e7 0f             	and    $0xf,%edi
+  80014f:	09 f8                	or     %edi,%eax
+  800151:	83 c8 e0             	or     $0xffffffe0,%eax
+  800154:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800159:	ee                   	out    %al,(%dx)
+  80015a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80015f:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800164:	ee                   	out    %al,(%dx)
+  800165:	c1 e6 09             	shl    $0x9,%esi
+  800168:	01 de                	add    %ebx,%esi
+	outb(0x1F7, 0x20);	// CMD 0x20 means read sector
+
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  80016a:	39 f3                	cmp    %esi,%ebx
+  80016c:	74 3b                	je     8001a9 <ide_read+0xbb>
+		if ((r = ide_wait_ready(1)) < 0)
+  80016e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800173:	e8 bb fe ff ff       	call   800033 <ide_wait_ready>
+  800178:	85 c0                	test   %eax,%eax
+  80017a:	78 32                	js     8001ae <ide_read+0xc0>
+	__asm __volatile("cld\n\trepne\n\tinsl"			:
+  80017c:	89 df                	mov    %ebx,%edi
+  80017e:	b9 80 00 00 00       	mov    $0x80,%ecx
+  800183:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800188:	fc                   	cld
+  800189:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  80018b:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  800191:	eb d7                	jmp    80016a <ide_read+0x7c>
+	assert(nsecs <= 256);
+  800193:	68 f0 40 80 00       	push   $0x8040f0
+  800198:	68 fd 40 80 00       	push   $0x8040fd
+  80019d:	6a 44                	push   $0x44
+  80019f:	68 e7 40 80 00       	push   $0x8040e7
+  8001a4:	e8 b2 18 00 00       	call   801a5b <_panic>
+			return r;
+		insl(0x1F0, dst, SECTSIZE/4);
+	}
+
+	return 0;
+  8001a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8001ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b1:	5b                   	pop    %ebx
+  8001b2:	5e                   	pop    %esi
+  8001b3:	5f                   	pop    %edi
+  8001b4:	5d                   	pop    %ebp
+  8001b5:	c3                   	ret
+
+008001b6 <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs)
+{
+  8001b6:	55                   	push   %ebp
+  8001b7:	89 e5                	mov    %esp,%ebp
+  8001b9:	57                   	push   %edi
+  8001ba:	56                   	push   %esi
+  8001bb:	53                   	push   %ebx
+  8001bc:	83 ec 0c             	sub    $0xc,%esp
+  8001bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001c5:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int r;
+
+	assert(nsecs <= 256);
+  8001c8:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+  8001ce:	0f 87 87 00 00 00    	ja     80025b <ide_write+0xa5>
+
+	ide_wait_ready(0);
+  8001d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d9:	e8 55 fe ff ff       	call   800033 <ide_wait_ready>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8001de:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  8001e3:	89 f8                	mov    %edi,%eax
+  8001e5:	ee                   	out    %al,(%dx)
+  8001e6:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  8001eb:	89 f0                	mov    %esi,%eax
+  8001ed:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsecs);
+	outb(0x1F3, secno & 0xFF);
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  8001ee:	89 f0                	mov    %esi,%eax
+  8001f0:	c1 e8 08             	shr    $0x8,%eax
+  8001f3:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  8001f8:	ee                   	out    %al,(%dx)
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  8001f9:	89 f0                	mov    %esi,%eax
+  8001fb:	c1 e8 10             	shr    $0x10,%eax
+  8001fe:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800203:	ee                   	out    %al,(%dx)
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  800204:	0f b6 05 00 50 80 00 	movzbl 0x805000,%eax
+  80020b:	c1 e0 04             	shl    $0x4,%eax
+  80020e:	83 e0 10             	and    $0x10,%eax
+  800211:	c1 ee 18             	shr    $0x18,%esi
+  800214:	83 e6 0f             	and    $0xf,%esi
+  800217:	09 f0                	or     %esi,%eax
+  800219:	83 c8 e0             	or     $0xffffffe0,%eax
+  80021c:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800221:	ee                   	out    %al,(%dx)
+  800222:	b8 30 00 00 00       	mov    $0x30,%eax
+  800227:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80022c:	ee                   	out    %al,(%dx)
+  80022d:	c1 e7 09             	shl    $0x9,%edi
+  800230:	01 df                	add    %ebx,%edi
+	outb(0x1F7, 0x30);	// CMD 0x30 means write sector
+
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  800232:	39 fb                	cmp    %edi,%ebx
+  800234:	74 3b                	je     800271 <ide_write+0xbb>
+		if ((r = ide_wait_ready(1)) < 0)
+  800236:	b8 01 00 00 00       	mov    $0x1,%eax
+  80023b:	e8 f3 fd ff ff       	call   800033 <ide_wait_ready>
+  800240:	85 c0                	test   %eax,%eax
+  800242:	78 32                	js     800276 <ide_write+0xc0>
+}
+
+static __inline void
+outsl(int port, const void *addr, int cnt)
+{
+	__asm __volatile("cld\n\trepne\n\toutsl"		:
+  800244:	89 de                	mov    %ebx,%esi
+  800246:	b9 80 00 00 00       	mov    $0x80,%ecx
+  80024b:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800250:	fc                   	cld
+  800251:	f2 6f                	repnz outsl %ds:(%esi),(%dx)
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  800253:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  800259:	eb d7                	jmp    800232 <ide_write+0x7c>
+	assert(nsecs <= 256);
+  80025b:	68 f0 40 80 00       	push   $0x8040f0
+  800260:	68 fd 40 80 00       	push   $0x8040fd
+  800265:	6a 5d                	push   $0x5d
+  800267:	68 e7 40 80 00       	push   $0x8040e7
+  80026c:	e8 ea 17 00 00       	call   801a5b <_panic>
+			return r;
+		outsl(0x1F0, src, SECTSIZE/4);
+	}
+
+	return 0;
+  800271:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800279:	5b                   	pop    %ebx
+  80027a:	5e                   	pop    %esi
+  80027b:	5f                   	pop    %edi
+  80027c:	5d                   	pop    %ebp
+  80027d:	c3                   	ret
+
+0080027e <bc_pgfault>:
+
+// Fault any disk block that is read in to memory by
+// loading it from disk.
+static void
+bc_pgfault(struct UTrapframe *utf)
+{
+  80027e:	55                   	push   %ebp
+  80027f:	89 e5                	mov    %esp,%ebp
+  800281:	56                   	push   %esi
+  800282:	53                   	push   %ebx
+  800283:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  800286:	8b 1a                	mov    (%edx),%ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  800288:	8d 83 00 00 00 f0    	lea    -0x10000000(%ebx),%eax
+  80028e:	89 c6                	mov    %eax,%esi
+  800290:	c1 ee 0c             	shr    $0xc,%esi
+	int r;
+
+	// Check that the fault was within the block cache region
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  800293:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  800298:	0f 87 95 00 00 00    	ja     800333 <bc_pgfault+0xb5>
+		panic("page fault in FS: eip %08x, va %08x, err %04x",
+		      utf->utf_eip, addr, utf->utf_err);
+
+	// Sanity check the block number.
+	if (super && blockno >= super->s_nblocks)
+  80029e:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  8002a3:	85 c0                	test   %eax,%eax
+  8002a5:	74 09                	je     8002b0 <bc_pgfault+0x32>
+  8002a7:	3b 70 04             	cmp    0x4(%eax),%esi
+  8002aa:	0f 83 9e 00 00 00    	jae    80034e <bc_pgfault+0xd0>
+	// of the block from the disk into that page.
+	// Hint: first round addr to page boundary. fs/ide.c has code to read
+	// the disk.
+	//
+	// LAB 5: you code here:
+	addr = ROUNDDOWN(addr, BLKSIZE);
+  8002b0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if ((r = sys_page_alloc(0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  8002b6:	83 ec 04             	sub    $0x4,%esp
+  8002b9:	6a 07                	push   $0x7
+  8002bb:	53                   	push   %ebx
+  8002bc:	6a 00                	push   $0x0
+  8002be:	e8 ce 22 00 00       	call   802591 <sys_page_alloc>
+  8002c3:	83 c4 10             	add    $0x10,%esp
+  8002c6:	85 c0                	test   %eax,%eax
+  8002c8:	0f 88 92 00 00 00    	js     800360 <bc_pgfault+0xe2>
+		panic("sys_page_alloc: %e", r);
+
+	if (ide_read(blockno * BLKSECTS, addr, BLKSECTS) < 0)
+  8002ce:	83 ec 04             	sub    $0x4,%esp
+  8002d1:	6a 08                	push   $0x8
+  8002d3:	53                   	push   %ebx
+  8002d4:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+  8002db:	50                   	push   %eax
+  8002dc:	e8 0d fe ff ff       	call   8000ee <ide_read>
+  8002e1:	83 c4 10             	add    $0x10,%esp
+  8002e4:	85 c0                	test   %eax,%eax
+  8002e6:	0f 88 86 00 00 00    	js     800372 <bc_pgfault+0xf4>
+		panic("ide_read failed");
+
+	// Clear the dirty bit for the disk block page since we just read the
+	// block from disk
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
+  8002ec:	89 d8                	mov    %ebx,%eax
+  8002ee:	c1 e8 0c             	shr    $0xc,%eax
+  8002f1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+  8002fb:	25 07 0e 00 00       	and    $0xe07,%eax
+  800300:	50                   	push   %eax
+  800301:	53                   	push   %ebx
+  800302:	6a 00                	push   $0x0
+  800304:	53                   	push   %ebx
+  800305:	6a 00                	push   $0x0
+  800307:	e8 0b 23 00 00       	call   802617 <sys_page_map>
+  80030c:	83 c4 20             	add    $0x20,%esp
+  80030f:	85 c0                	test   %eax,%eax
+  800311:	78 73                	js     800386 <bc_pgfault+0x108>
+		panic("in bc_pgfault, sys_page_map: %e", r);
+
+	// Check that the block we read was allocated. (exercise for
+	// the reader: why do we do this *after* reading the block
+	// in?)
+	if (bitmap && block_is_free(blockno))
+  800313:	83 3d 08 a0 80 00 00 	cmpl   $0x0,0x80a008
+  80031a:	74 10                	je     80032c <bc_pgfault+0xae>
+  80031c:	83 ec 0c             	sub    $0xc,%esp
+  80031f:	56                   	push   %esi
+  800320:	e8 c6 03 00 00       	call   8006eb <block_is_free>
+  800325:	83 c4 10             	add    $0x10,%esp
+  800328:	84 c0                	test   %al,%al
+  80032a:	75 6c                	jne    800398 <bc_pgfault+0x11a>
+		panic("reading free block %08x\n", blockno);
+}
+  80032c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80032f:	5b                   	pop    %ebx
+  800330:	5e                   	pop    %esi
+  800331:	5d                   	pop    %ebp
+  800332:	c3                   	ret
+		panic("page fault in FS: eip %08x, va %08x, err %04x",
+  800333:	83 ec 08             	sub    $0x8,%esp
+  800336:	ff 72 04             	push   0x4(%edx)
+  800339:	53                   	push   %ebx
+  80033a:	ff 72 28             	push   0x28(%edx)
+  80033d:	68 14 41 80 00       	push   $0x804114
+  800342:	6a 26                	push   $0x26
+  800344:	68 d0 41 80 00       	push   $0x8041d0
+  800349:	e8 0d 17 00 00       	call   801a5b <_panic>
+		panic("reading non-existent block %08x\n", blockno);
+  80034e:	56                   	push   %esi
+  80034f:	68 44 41 80 00       	push   $0x804144
+  800354:	6a 2b                	push   $0x2b
+  800356:	68 d0 41 80 00       	push   $0x8041d0
+  80035b:	e8 fb 16 00 00       	call   801a5b <_panic>
+		panic("sys_page_alloc: %e", r);
+  800360:	50                   	push   %eax
+  800361:	68 d8 41 80 00       	push   $0x8041d8
+  800366:	6a 35                	push   $0x35
+  800368:	68 d0 41 80 00       	push   $0x8041d0
+  80036d:	e8 e9 16 00 00       	call   801a5b <_panic>
+		panic("ide_read failed");
+  800372:	83 ec 04             	sub    $0x4,%esp
+  800375:	68 eb 41 80 00       	push   $0x8041eb
+  80037a:	6a 38                	push   $0x38
+  80037c:	68 d0 41 80 00       	push   $0x8041d0
+  800381:	e8 d5 16 00 00       	call   801a5b <_panic>
+		panic("in bc_pgfault, sys_page_map: %e", r);
+  800386:	50                   	push   %eax
+  800387:	68 68 41 80 00       	push   $0x804168
+  80038c:	6a 3d                	push   $0x3d
+  80038e:	68 d0 41 80 00       	push   $0x8041d0
+  800393:	e8 c3 16 00 00       	call   801a5b <_panic>
+		panic("reading free block %08x\n", blockno);
+  800398:	56                   	push   %esi
+  800399:	68 fb 41 80 00       	push   $0x8041fb
+  80039e:	6a 43                	push   $0x43
+  8003a0:	68 d0 41 80 00       	push   $0x8041d0
+  8003a5:	e8 b1 16 00 00       	call   801a5b <_panic>
+
+008003aa <diskaddr>:
+{
+  8003aa:	55                   	push   %ebp
+  8003ab:	89 e5                	mov    %esp,%ebp
+  8003ad:	83 ec 08             	sub    $0x8,%esp
+  8003b0:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  8003b3:	85 c0                	test   %eax,%eax
+  8003b5:	74 19                	je     8003d0 <diskaddr+0x26>
+  8003b7:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  8003bd:	85 d2                	test   %edx,%edx
+  8003bf:	74 05                	je     8003c6 <diskaddr+0x1c>
+  8003c1:	3b 42 04             	cmp    0x4(%edx),%eax
+  8003c4:	73 0a                	jae    8003d0 <diskaddr+0x26>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  8003c6:	05 00 00 01 00       	add    $0x10000,%eax
+  8003cb:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8003ce:	c9                   	leave
+  8003cf:	c3                   	ret
+		panic("bad block number %08x in diskaddr", blockno);
+  8003d0:	50                   	push   %eax
+  8003d1:	68 88 41 80 00       	push   $0x804188
+  8003d6:	6a 09                	push   $0x9
+  8003d8:	68 d0 41 80 00       	push   $0x8041d0
+  8003dd:	e8 79 16 00 00       	call   801a5b <_panic>
+
+008003e2 <va_is_mapped>:
+{
+  8003e2:	55                   	push   %ebp
+  8003e3:	89 e5                	mov    %esp,%ebp
+  8003e5:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8003e8:	89 d0                	mov    %edx,%eax
+  8003ea:	c1 e8 16             	shr    $0x16,%eax
+  8003ed:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8003f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f9:	f6 c1 01             	test   $0x1,%cl
+  8003fc:	74 0d                	je     80040b <va_is_mapped+0x29>
+  8003fe:	c1 ea 0c             	shr    $0xc,%edx
+  800401:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  800408:	83 e0 01             	and    $0x1,%eax
+  80040b:	83 e0 01             	and    $0x1,%eax
+}
+  80040e:	5d                   	pop    %ebp
+  80040f:	c3                   	ret
+
+00800410 <va_is_dirty>:
+{
+  800410:	55                   	push   %ebp
+  800411:	89 e5                	mov    %esp,%ebp
+	return (uvpt[PGNUM(va)] & PTE_D) != 0;
+  800413:	8b 45 08             	mov    0x8(%ebp),%eax
+  800416:	c1 e8 0c             	shr    $0xc,%eax
+  800419:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800420:	c1 e8 06             	shr    $0x6,%eax
+  800423:	83 e0 01             	and    $0x1,%eax
+}
+  800426:	5d                   	pop    %ebp
+  800427:	c3                   	ret
+
+00800428 <flush_block>:
+// Hint: Use va_is_mapped, va_is_dirty, and ide_write.
+// Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
+// Hint: Don't forget to round addr down.
+void
+flush_block(void *addr)
+{
+  800428:	55                   	push   %ebp
+  800429:	89 e5                	mov    %esp,%ebp
+  80042b:	56                   	push   %esi
+  80042c:	53                   	push   %ebx
+  80042d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  800430:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+	int r;
+
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  800436:	81 fe ff ff ff bf    	cmp    $0xbfffffff,%esi
+  80043c:	77 17                	ja     800455 <flush_block+0x2d>
+		panic("flush_block of bad va %08x", addr);
+
+	// LAB 5: Your code here.
+	if (!va_is_mapped(addr) || !va_is_dirty(addr))
+  80043e:	83 ec 0c             	sub    $0xc,%esp
+  800441:	53                   	push   %ebx
+  800442:	e8 9b ff ff ff       	call   8003e2 <va_is_mapped>
+  800447:	83 c4 10             	add    $0x10,%esp
+  80044a:	84 c0                	test   %al,%al
+  80044c:	75 19                	jne    800467 <flush_block+0x3f>
+	if (ide_write(blockno * BLKSECTS, addr, BLKSECTS) < 0)
+		panic("ide_write failed");
+
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
+		panic("sys_page_map: %e", r);
+}
+  80044e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800451:	5b                   	pop    %ebx
+  800452:	5e                   	pop    %esi
+  800453:	5d                   	pop    %ebp
+  800454:	c3                   	ret
+		panic("flush_block of bad va %08x", addr);
+  800455:	53                   	push   %ebx
+  800456:	68 14 42 80 00       	push   $0x804214
+  80045b:	6a 54                	push   $0x54
+  80045d:	68 d0 41 80 00       	push   $0x8041d0
+  800462:	e8 f4 15 00 00       	call   801a5b <_panic>
+	if (!va_is_mapped(addr) || !va_is_dirty(addr))
+  800467:	83 ec 0c             	sub    $0xc,%esp
+  80046a:	53                   	push   %ebx
+  80046b:	e8 a0 ff ff ff       	call   800410 <va_is_dirty>
+  800470:	83 c4 10             	add    $0x10,%esp
+  800473:	84 c0                	test   %al,%al
+  800475:	74 d7                	je     80044e <flush_block+0x26>
+	addr = ROUNDDOWN(addr, BLKSIZE);
+  800477:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (ide_write(blockno * BLKSECTS, addr, BLKSECTS) < 0)
+  80047d:	83 ec 04             	sub    $0x4,%esp
+  800480:	6a 08                	push   $0x8
+  800482:	53                   	push   %ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  800483:	c1 ee 0c             	shr    $0xc,%esi
+	if (ide_write(blockno * BLKSECTS, addr, BLKSECTS) < 0)
+  800486:	c1 e6 03             	shl    $0x3,%esi
+  800489:	56                   	push   %esi
+  80048a:	e8 27 fd ff ff       	call   8001b6 <ide_write>
+  80048f:	83 c4 10             	add    $0x10,%esp
+  800492:	85 c0                	test   %eax,%eax
+  800494:	78 39                	js     8004cf <flush_block+0xa7>
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
+  800496:	89 d8                	mov    %ebx,%eax
+  800498:	c1 e8 0c             	shr    $0xc,%eax
+  80049b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8004a2:	83 ec 0c             	sub    $0xc,%esp
+  8004a5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8004aa:	50                   	push   %eax
+  8004ab:	53                   	push   %ebx
+  8004ac:	6a 00                	push   $0x0
+  8004ae:	53                   	push   %ebx
+  8004af:	6a 00                	push   $0x0
+  8004b1:	e8 61 21 00 00       	call   802617 <sys_page_map>
+  8004b6:	83 c4 20             	add    $0x20,%esp
+  8004b9:	85 c0                	test   %eax,%eax
+  8004bb:	79 91                	jns    80044e <flush_block+0x26>
+		panic("sys_page_map: %e", r);
+  8004bd:	50                   	push   %eax
+  8004be:	68 40 42 80 00       	push   $0x804240
+  8004c3:	6a 5f                	push   $0x5f
+  8004c5:	68 d0 41 80 00       	push   $0x8041d0
+  8004ca:	e8 8c 15 00 00       	call   801a5b <_panic>
+		panic("ide_write failed");
+  8004cf:	83 ec 04             	sub    $0x4,%esp
+  8004d2:	68 2f 42 80 00       	push   $0x80422f
+  8004d7:	6a 5c                	push   $0x5c
+  8004d9:	68 d0 41 80 00       	push   $0x8041d0
+  8004de:	e8 78 15 00 00       	call   801a5b <_panic>
+
+008004e3 <bc_init>:
+	cprintf("block cache is good\n");
+}
+
+void
+bc_init(void)
+{
+  8004e3:	55                   	push   %ebp
+  8004e4:	89 e5                	mov    %esp,%ebp
+  8004e6:	81 ec 24 02 00 00    	sub    $0x224,%esp
+	struct Super super;
+	set_pgfault_handler(bc_pgfault);
+  8004ec:	68 7e 02 80 00       	push   $0x80027e
+  8004f1:	e8 c0 24 00 00       	call   8029b6 <set_pgfault_handler>
+	memmove(&backup, diskaddr(1), sizeof backup);
+  8004f6:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8004fd:	e8 a8 fe ff ff       	call   8003aa <diskaddr>
+  800502:	83 c4 0c             	add    $0xc,%esp
+  800505:	68 08 01 00 00       	push   $0x108
+  80050a:	50                   	push   %eax
+  80050b:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  800511:	50                   	push   %eax
+  800512:	e8 93 1d 00 00       	call   8022aa <memmove>
+	strcpy(diskaddr(1), "OOPS!\n");
+  800517:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80051e:	e8 87 fe ff ff       	call   8003aa <diskaddr>
+  800523:	83 c4 08             	add    $0x8,%esp
+  800526:	68 51 42 80 00       	push   $0x804251
+  80052b:	50                   	push   %eax
+  80052c:	e8 f3 1b 00 00       	call   802124 <strcpy>
+	flush_block(diskaddr(1));
+  800531:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800538:	e8 6d fe ff ff       	call   8003aa <diskaddr>
+  80053d:	89 04 24             	mov    %eax,(%esp)
+  800540:	e8 e3 fe ff ff       	call   800428 <flush_block>
+	assert(va_is_mapped(diskaddr(1)));
+  800545:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80054c:	e8 59 fe ff ff       	call   8003aa <diskaddr>
+  800551:	89 04 24             	mov    %eax,(%esp)
+  800554:	e8 89 fe ff ff       	call   8003e2 <va_is_mapped>
+  800559:	83 c4 10             	add    $0x10,%esp
+  80055c:	84 c0                	test   %al,%al
+  80055e:	0f 84 d9 00 00 00    	je     80063d <bc_init+0x15a>
+	assert(!va_is_dirty(diskaddr(1)));
+  800564:	83 ec 0c             	sub    $0xc,%esp
+  800567:	6a 01                	push   $0x1
+  800569:	e8 3c fe ff ff       	call   8003aa <diskaddr>
+  80056e:	89 04 24             	mov    %eax,(%esp)
+  800571:	e8 9a fe ff ff       	call   800410 <va_is_dirty>
+  800576:	83 c4 10             	add    $0x10,%esp
+  800579:	84 c0                	test   %al,%al
+  80057b:	0f 85 d2 00 00 00    	jne    800653 <bc_init+0x170>
+	sys_page_unmap(0, diskaddr(1));
+  800581:	83 ec 0c             	sub    $0xc,%esp
+  800584:	6a 01                	push   $0x1
+  800586:	e8 1f fe ff ff       	call   8003aa <diskaddr>
+  80058b:	83 c4 08             	add    $0x8,%esp
+  80058e:	50                   	push   %eax
+  80058f:	6a 00                	push   $0x0
+  800591:	e8 c3 20 00 00       	call   802659 <sys_page_unmap>
+	assert(!va_is_mapped(diskaddr(1)));
+  800596:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80059d:	e8 08 fe ff ff       	call   8003aa <diskaddr>
+  8005a2:	89 04 24             	mov    %eax,(%esp)
+  8005a5:	e8 38 fe ff ff       	call   8003e2 <va_is_mapped>
+  8005aa:	83 c4 10             	add    $0x10,%esp
+  8005ad:	84 c0                	test   %al,%al
+  8005af:	0f 85 b4 00 00 00    	jne    800669 <bc_init+0x186>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8005b5:	83 ec 0c             	sub    $0xc,%esp
+  8005b8:	6a 01                	push   $0x1
+  8005ba:	e8 eb fd ff ff       	call   8003aa <diskaddr>
+  8005bf:	83 c4 08             	add    $0x8,%esp
+  8005c2:	68 51 42 80 00       	push   $0x804251
+  8005c7:	50                   	push   %eax
+  8005c8:	e8 08 1c 00 00       	call   8021d5 <strcmp>
+  8005cd:	83 c4 10             	add    $0x10,%esp
+  8005d0:	85 c0                	test   %eax,%eax
+  8005d2:	0f 85 a7 00 00 00    	jne    80067f <bc_init+0x19c>
+	memmove(diskaddr(1), &backup, sizeof backup);
+  8005d8:	83 ec 0c             	sub    $0xc,%esp
+  8005db:	6a 01                	push   $0x1
+  8005dd:	e8 c8 fd ff ff       	call   8003aa <diskaddr>
+  8005e2:	83 c4 0c             	add    $0xc,%esp
+  8005e5:	68 08 01 00 00       	push   $0x108
+  8005ea:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+  8005f0:	52                   	push   %edx
+  8005f1:	50                   	push   %eax
+  8005f2:	e8 b3 1c 00 00       	call   8022aa <memmove>
+	flush_block(diskaddr(1));
+  8005f7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8005fe:	e8 a7 fd ff ff       	call   8003aa <diskaddr>
+  800603:	89 04 24             	mov    %eax,(%esp)
+  800606:	e8 1d fe ff ff       	call   800428 <flush_block>
+	cprintf("block cache is good\n");
+  80060b:	c7 04 24 8d 42 80 00 	movl   $0x80428d,(%esp)
+  800612:	e8 1f 15 00 00       	call   801b36 <cprintf>
+	check_bc();
+
+	// cache the super block by reading it once
+	memmove(&super, diskaddr(1), sizeof super);
+  800617:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80061e:	e8 87 fd ff ff       	call   8003aa <diskaddr>
+  800623:	83 c4 0c             	add    $0xc,%esp
+  800626:	68 08 01 00 00       	push   $0x108
+  80062b:	50                   	push   %eax
+  80062c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800632:	50                   	push   %eax
+  800633:	e8 72 1c 00 00       	call   8022aa <memmove>
+}
+  800638:	83 c4 10             	add    $0x10,%esp
+  80063b:	c9                   	leave
+  80063c:	c3                   	ret
+	assert(va_is_mapped(diskaddr(1)));
+  80063d:	68 73 42 80 00       	push   $0x804273
+  800642:	68 fd 40 80 00       	push   $0x8040fd
+  800647:	6a 6f                	push   $0x6f
+  800649:	68 d0 41 80 00       	push   $0x8041d0
+  80064e:	e8 08 14 00 00       	call   801a5b <_panic>
+	assert(!va_is_dirty(diskaddr(1)));
+  800653:	68 58 42 80 00       	push   $0x804258
+  800658:	68 fd 40 80 00       	push   $0x8040fd
+  80065d:	6a 70                	push   $0x70
+  80065f:	68 d0 41 80 00       	push   $0x8041d0
+  800664:	e8 f2 13 00 00       	call   801a5b <_panic>
+	assert(!va_is_mapped(diskaddr(1)));
+  800669:	68 72 42 80 00       	push   $0x804272
+  80066e:	68 fd 40 80 00       	push   $0x8040fd
+  800673:	6a 74                	push   $0x74
+  800675:	68 d0 41 80 00       	push   $0x8041d0
+  80067a:	e8 dc 13 00 00       	call   801a5b <_panic>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  80067f:	68 ac 41 80 00       	push   $0x8041ac
+  800684:	68 fd 40 80 00       	push   $0x8040fd
+  800689:	6a 77                	push   $0x77
+  80068b:	68 d0 41 80 00       	push   $0x8041d0
+  800690:	e8 c6 13 00 00       	call   801a5b <_panic>
+
+00800695 <check_super>:
+// --------------------------------------------------------------
+
+// Validate the file system super-block.
+void
+check_super(void)
+{
+  800695:	55                   	push   %ebp
+  800696:	89 e5                	mov    %esp,%ebp
+  800698:	83 ec 08             	sub    $0x8,%esp
+	if (super->s_magic != FS_MAGIC)
+  80069b:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  8006a0:	81 38 ae 30 05 4a    	cmpl   $0x4a0530ae,(%eax)
+  8006a6:	75 1b                	jne    8006c3 <check_super+0x2e>
+		panic("bad file system magic number");
+
+	if (super->s_nblocks > DISKSIZE/BLKSIZE)
+  8006a8:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%eax)
+  8006af:	77 26                	ja     8006d7 <check_super+0x42>
+		panic("file system is too large");
+
+	cprintf("superblock is good\n");
+  8006b1:	83 ec 0c             	sub    $0xc,%esp
+  8006b4:	68 e0 42 80 00       	push   $0x8042e0
+  8006b9:	e8 78 14 00 00       	call   801b36 <cprintf>
+}
+  8006be:	83 c4 10             	add    $0x10,%esp
+  8006c1:	c9                   	leave
+  8006c2:	c3                   	ret
+		panic("bad file system magic number");
+  8006c3:	83 ec 04             	sub    $0x4,%esp
+  8006c6:	68 a2 42 80 00       	push   $0x8042a2
+  8006cb:	6a 0f                	push   $0xf
+  8006cd:	68 bf 42 80 00       	push   $0x8042bf
+  8006d2:	e8 84 13 00 00       	call   801a5b <_panic>
+		panic("file system is too large");
+  8006d7:	83 ec 04             	sub    $0x4,%esp
+  8006da:	68 c7 42 80 00       	push   $0x8042c7
+  8006df:	6a 12                	push   $0x12
+  8006e1:	68 bf 42 80 00       	push   $0x8042bf
+  8006e6:	e8 70 13 00 00       	call   801a5b <_panic>
+
+008006eb <block_is_free>:
+
+// Check to see if the block bitmap indicates that block 'blockno' is free.
+// Return 1 if the block is free, 0 if not.
+bool
+block_is_free(uint32_t blockno)
+{
+  8006eb:	55                   	push   %ebp
+  8006ec:	89 e5                	mov    %esp,%ebp
+  8006ee:	53                   	push   %ebx
+  8006ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (super == 0 || blockno >= super->s_nblocks)
+  8006f2:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  8006f7:	85 c0                	test   %eax,%eax
+  8006f9:	74 29                	je     800724 <block_is_free+0x39>
+		return 0;
+  8006fb:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (super == 0 || blockno >= super->s_nblocks)
+  800700:	3b 48 04             	cmp    0x4(%eax),%ecx
+  800703:	73 18                	jae    80071d <block_is_free+0x32>
+	if (bitmap[blockno / 32] & (1 << (blockno % 32)))
+  800705:	89 cb                	mov    %ecx,%ebx
+  800707:	c1 eb 05             	shr    $0x5,%ebx
+  80070a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80070f:	d3 e0                	shl    %cl,%eax
+  800711:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  800717:	23 04 9a             	and    (%edx,%ebx,4),%eax
+  80071a:	0f 95 c2             	setne  %dl
+		return 1;
+	return 0;
+}
+  80071d:	89 d0                	mov    %edx,%eax
+  80071f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800722:	c9                   	leave
+  800723:	c3                   	ret
+		return 0;
+  800724:	ba 00 00 00 00       	mov    $0x0,%edx
+  800729:	eb f2                	jmp    80071d <block_is_free+0x32>
+
+0080072b <free_block>:
+
+// Mark a block free in the bitmap
+void
+free_block(uint32_t blockno)
+{
+  80072b:	55                   	push   %ebp
+  80072c:	89 e5                	mov    %esp,%ebp
+  80072e:	53                   	push   %ebx
+  80072f:	83 ec 04             	sub    $0x4,%esp
+  800732:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	// Blockno zero is the null pointer of block numbers.
+	if (blockno == 0)
+  800735:	85 c9                	test   %ecx,%ecx
+  800737:	74 1a                	je     800753 <free_block+0x28>
+		panic("attempt to free zero block");
+	bitmap[blockno/32] |= 1<<(blockno%32);
+  800739:	89 cb                	mov    %ecx,%ebx
+  80073b:	c1 eb 05             	shr    $0x5,%ebx
+  80073e:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  800744:	b8 01 00 00 00       	mov    $0x1,%eax
+  800749:	d3 e0                	shl    %cl,%eax
+  80074b:	09 04 9a             	or     %eax,(%edx,%ebx,4)
+}
+  80074e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800751:	c9                   	leave
+  800752:	c3                   	ret
+		panic("attempt to free zero block");
+  800753:	83 ec 04             	sub    $0x4,%esp
+  800756:	68 f4 42 80 00       	push   $0x8042f4
+  80075b:	6a 2d                	push   $0x2d
+  80075d:	68 bf 42 80 00       	push   $0x8042bf
+  800762:	e8 f4 12 00 00       	call   801a5b <_panic>
+
+00800767 <alloc_block>:
+// -E_NO_DISK if we are out of blocks.
+//
+// Hint: use free_block as an example for manipulating the bitmap.
+int
+alloc_block(void)
+{
+  800767:	55                   	push   %ebp
+  800768:	89 e5                	mov    %esp,%ebp
+  80076a:	56                   	push   %esi
+  80076b:	53                   	push   %ebx
+	// contains the in-use bits for BLKBITSIZE blocks.  There are
+	// super->s_nblocks blocks in the disk altogether.
+
+	// LAB 5: Your code here.
+	int blockno;
+	for (blockno = 1; blockno < super->s_nblocks; blockno++) {
+  80076c:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  800771:	8b 70 04             	mov    0x4(%eax),%esi
+  800774:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800779:	eb 03                	jmp    80077e <alloc_block+0x17>
+  80077b:	83 c3 01             	add    $0x1,%ebx
+  80077e:	39 f3                	cmp    %esi,%ebx
+  800780:	73 40                	jae    8007c2 <alloc_block+0x5b>
+		if (block_is_free(blockno)) {
+  800782:	83 ec 0c             	sub    $0xc,%esp
+  800785:	53                   	push   %ebx
+  800786:	e8 60 ff ff ff       	call   8006eb <block_is_free>
+  80078b:	83 c4 10             	add    $0x10,%esp
+  80078e:	84 c0                	test   %al,%al
+  800790:	74 e9                	je     80077b <alloc_block+0x14>
+			bitmap[blockno/32] &= ~(1<<(blockno%32));
+  800792:	8d 43 1f             	lea    0x1f(%ebx),%eax
+  800795:	85 db                	test   %ebx,%ebx
+  800797:	0f 49 c3             	cmovns %ebx,%eax
+  80079a:	c1 f8 05             	sar    $0x5,%eax
+  80079d:	8b 35 08 a0 80 00    	mov    0x80a008,%esi
+  8007a3:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+  8007a8:	89 d9                	mov    %ebx,%ecx
+  8007aa:	d3 c2                	rol    %cl,%edx
+  8007ac:	21 14 86             	and    %edx,(%esi,%eax,4)
+			flush_block(bitmap);
+  8007af:	83 ec 0c             	sub    $0xc,%esp
+  8007b2:	ff 35 08 a0 80 00    	push   0x80a008
+  8007b8:	e8 6b fc ff ff       	call   800428 <flush_block>
+			return blockno;
+  8007bd:	83 c4 10             	add    $0x10,%esp
+  8007c0:	eb 05                	jmp    8007c7 <alloc_block+0x60>
+		}
+	}
+	return -E_NO_DISK;
+  8007c2:	bb f7 ff ff ff       	mov    $0xfffffff7,%ebx
+}
+  8007c7:	89 d8                	mov    %ebx,%eax
+  8007c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8007cc:	5b                   	pop    %ebx
+  8007cd:	5e                   	pop    %esi
+  8007ce:	5d                   	pop    %ebp
+  8007cf:	c3                   	ret
+
+008007d0 <file_block_walk>:
+//
+// Analogy: This is like pgdir_walk for files.
+// Hint: Don't forget to clear any block you allocate.
+static int
+file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc)
+{
+  8007d0:	55                   	push   %ebp
+  8007d1:	89 e5                	mov    %esp,%ebp
+  8007d3:	57                   	push   %edi
+  8007d4:	56                   	push   %esi
+  8007d5:	53                   	push   %ebx
+  8007d6:	83 ec 0c             	sub    $0xc,%esp
+  8007d9:	89 c6                	mov    %eax,%esi
+  8007db:	8b 45 08             	mov    0x8(%ebp),%eax
+       // LAB 5: Your code here.
+	int r;
+
+	if (filebno >= NDIRECT + NINDIRECT)
+  8007de:	81 fa 09 04 00 00    	cmp    $0x409,%edx
+  8007e4:	0f 87 87 00 00 00    	ja     800871 <file_block_walk+0xa1>
+  8007ea:	89 d3                	mov    %edx,%ebx
+  8007ec:	89 cf                	mov    %ecx,%edi
+		return -E_INVAL;
+
+	if (filebno < NDIRECT) {
+  8007ee:	83 fa 09             	cmp    $0x9,%edx
+  8007f1:	76 6e                	jbe    800861 <file_block_walk+0x91>
+		*ppdiskbno = &f->f_direct[filebno];
+		return 0;
+	}
+
+	if (!f->f_indirect) {
+  8007f3:	83 be b0 00 00 00 00 	cmpl   $0x0,0xb0(%esi)
+  8007fa:	75 41                	jne    80083d <file_block_walk+0x6d>
+		if (!alloc)
+  8007fc:	84 c0                	test   %al,%al
+  8007fe:	74 78                	je     800878 <file_block_walk+0xa8>
+			return -E_NOT_FOUND;
+
+		if ((f->f_indirect = alloc_block()) < 0) {
+  800800:	e8 62 ff ff ff       	call   800767 <alloc_block>
+  800805:	89 86 b0 00 00 00    	mov    %eax,0xb0(%esi)
+			f->f_indirect = 0;
+			return -E_NO_DISK;
+		}
+
+		memset(diskaddr(f->f_indirect), 0, BLKSIZE);
+  80080b:	83 ec 0c             	sub    $0xc,%esp
+  80080e:	50                   	push   %eax
+  80080f:	e8 96 fb ff ff       	call   8003aa <diskaddr>
+  800814:	83 c4 0c             	add    $0xc,%esp
+  800817:	68 00 10 00 00       	push   $0x1000
+  80081c:	6a 00                	push   $0x0
+  80081e:	50                   	push   %eax
+  80081f:	e8 51 1a 00 00       	call   802275 <memset>
+		flush_block(diskaddr(f->f_indirect));
+  800824:	83 c4 04             	add    $0x4,%esp
+  800827:	ff b6 b0 00 00 00    	push   0xb0(%esi)
+  80082d:	e8 78 fb ff ff       	call   8003aa <diskaddr>
+  800832:	89 04 24             	mov    %eax,(%esp)
+  800835:	e8 ee fb ff ff       	call   800428 <flush_block>
+  80083a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	*ppdiskbno = (uint32_t *) (diskaddr(f->f_indirect) + (filebno - NDIRECT) * sizeof(uint32_t));
+  80083d:	83 ec 0c             	sub    $0xc,%esp
+  800840:	ff b6 b0 00 00 00    	push   0xb0(%esi)
+  800846:	e8 5f fb ff ff       	call   8003aa <diskaddr>
+  80084b:	8d 44 98 d8          	lea    -0x28(%eax,%ebx,4),%eax
+  80084f:	89 07                	mov    %eax,(%edi)
+	return 0;
+  800851:	83 c4 10             	add    $0x10,%esp
+  800854:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800859:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80085c:	5b                   	pop    %ebx
+  80085d:	5e                   	pop    %esi
+  80085e:	5f                   	pop    %edi
+  80085f:	5d                   	pop    %ebp
+  800860:	c3                   	ret
+		*ppdiskbno = &f->f_direct[filebno];
+  800861:	8d 84 96 88 00 00 00 	lea    0x88(%esi,%edx,4),%eax
+  800868:	89 01                	mov    %eax,(%ecx)
+		return 0;
+  80086a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086f:	eb e8                	jmp    800859 <file_block_walk+0x89>
+		return -E_INVAL;
+  800871:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800876:	eb e1                	jmp    800859 <file_block_walk+0x89>
+			return -E_NOT_FOUND;
+  800878:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80087d:	eb da                	jmp    800859 <file_block_walk+0x89>
+
+0080087f <check_bitmap>:
+{
+  80087f:	55                   	push   %ebp
+  800880:	89 e5                	mov    %esp,%ebp
+  800882:	56                   	push   %esi
+  800883:	53                   	push   %ebx
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  800884:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  800889:	8b 70 04             	mov    0x4(%eax),%esi
+  80088c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800891:	89 d8                	mov    %ebx,%eax
+  800893:	c1 e0 0f             	shl    $0xf,%eax
+  800896:	39 f0                	cmp    %esi,%eax
+  800898:	73 2e                	jae    8008c8 <check_bitmap+0x49>
+		assert(!block_is_free(2+i));
+  80089a:	83 ec 0c             	sub    $0xc,%esp
+  80089d:	8d 43 02             	lea    0x2(%ebx),%eax
+  8008a0:	50                   	push   %eax
+  8008a1:	e8 45 fe ff ff       	call   8006eb <block_is_free>
+  8008a6:	83 c4 10             	add    $0x10,%esp
+  8008a9:	84 c0                	test   %al,%al
+  8008ab:	75 05                	jne    8008b2 <check_bitmap+0x33>
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  8008ad:	83 c3 01             	add    $0x1,%ebx
+  8008b0:	eb df                	jmp    800891 <check_bitmap+0x12>
+		assert(!block_is_free(2+i));
+  8008b2:	68 0f 43 80 00       	push   $0x80430f
+  8008b7:	68 fd 40 80 00       	push   $0x8040fd
+  8008bc:	6a 57                	push   $0x57
+  8008be:	68 bf 42 80 00       	push   $0x8042bf
+  8008c3:	e8 93 11 00 00       	call   801a5b <_panic>
+	assert(!block_is_free(0));
+  8008c8:	83 ec 0c             	sub    $0xc,%esp
+  8008cb:	6a 00                	push   $0x0
+  8008cd:	e8 19 fe ff ff       	call   8006eb <block_is_free>
+  8008d2:	83 c4 10             	add    $0x10,%esp
+  8008d5:	84 c0                	test   %al,%al
+  8008d7:	75 28                	jne    800901 <check_bitmap+0x82>
+	assert(!block_is_free(1));
+  8008d9:	83 ec 0c             	sub    $0xc,%esp
+  8008dc:	6a 01                	push   $0x1
+  8008de:	e8 08 fe ff ff       	call   8006eb <block_is_free>
+  8008e3:	83 c4 10             	add    $0x10,%esp
+  8008e6:	84 c0                	test   %al,%al
+  8008e8:	75 2d                	jne    800917 <check_bitmap+0x98>
+	cprintf("bitmap is good\n");
+  8008ea:	83 ec 0c             	sub    $0xc,%esp
+  8008ed:	68 47 43 80 00       	push   $0x804347
+  8008f2:	e8 3f 12 00 00       	call   801b36 <cprintf>
+}
+  8008f7:	83 c4 10             	add    $0x10,%esp
+  8008fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008fd:	5b                   	pop    %ebx
+  8008fe:	5e                   	pop    %esi
+  8008ff:	5d                   	pop    %ebp
+  800900:	c3                   	ret
+	assert(!block_is_free(0));
+  800901:	68 23 43 80 00       	push   $0x804323
+  800906:	68 fd 40 80 00       	push   $0x8040fd
+  80090b:	6a 5a                	push   $0x5a
+  80090d:	68 bf 42 80 00       	push   $0x8042bf
+  800912:	e8 44 11 00 00       	call   801a5b <_panic>
+	assert(!block_is_free(1));
+  800917:	68 35 43 80 00       	push   $0x804335
+  80091c:	68 fd 40 80 00       	push   $0x8040fd
+  800921:	6a 5b                	push   $0x5b
+  800923:	68 bf 42 80 00       	push   $0x8042bf
+  800928:	e8 2e 11 00 00       	call   801a5b <_panic>
+
+0080092d <fs_init>:
+{
+  80092d:	55                   	push   %ebp
+  80092e:	89 e5                	mov    %esp,%ebp
+  800930:	83 ec 08             	sub    $0x8,%esp
+       if (ide_probe_disk1())
+  800933:	e8 2b f7 ff ff       	call   800063 <ide_probe_disk1>
+  800938:	84 c0                	test   %al,%al
+  80093a:	74 41                	je     80097d <fs_init+0x50>
+               ide_set_disk(1);
+  80093c:	83 ec 0c             	sub    $0xc,%esp
+  80093f:	6a 01                	push   $0x1
+  800941:	e8 7f f7 ff ff       	call   8000c5 <ide_set_disk>
+  800946:	83 c4 10             	add    $0x10,%esp
+	bc_init();
+  800949:	e8 95 fb ff ff       	call   8004e3 <bc_init>
+	super = diskaddr(1);
+  80094e:	83 ec 0c             	sub    $0xc,%esp
+  800951:	6a 01                	push   $0x1
+  800953:	e8 52 fa ff ff       	call   8003aa <diskaddr>
+  800958:	a3 0c a0 80 00       	mov    %eax,0x80a00c
+	check_super();
+  80095d:	e8 33 fd ff ff       	call   800695 <check_super>
+	bitmap = diskaddr(2);
+  800962:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  800969:	e8 3c fa ff ff       	call   8003aa <diskaddr>
+  80096e:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	check_bitmap();
+  800973:	e8 07 ff ff ff       	call   80087f <check_bitmap>
+}
+  800978:	83 c4 10             	add    $0x10,%esp
+  80097b:	c9                   	leave
+  80097c:	c3                   	ret
+               ide_set_disk(0);
+  80097d:	83 ec 0c             	sub    $0xc,%esp
+  800980:	6a 00                	push   $0x0
+  800982:	e8 3e f7 ff ff       	call   8000c5 <ide_set_disk>
+  800987:	83 c4 10             	add    $0x10,%esp
+  80098a:	eb bd                	jmp    800949 <fs_init+0x1c>
+
+0080098c <file_get_block>:
+//	-E_INVAL if filebno is out of range.
+//
+// Hint: Use file_block_walk and alloc_block.
+int
+file_get_block(struct File *f, uint32_t filebno, char **blk)
+{
+  80098c:	55                   	push   %ebp
+  80098d:	89 e5                	mov    %esp,%ebp
+  80098f:	56                   	push   %esi
+  800990:	53                   	push   %ebx
+  800991:	83 ec 1c             	sub    $0x1c,%esp
+       // LAB 5: Your code here.
+	int r;
+	uint32_t* pdiskbno;
+
+	if ((r = file_block_walk(f, filebno, &pdiskbno, 1)) < 0)
+  800994:	6a 01                	push   $0x1
+  800996:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800999:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80099c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099f:	e8 2c fe ff ff       	call   8007d0 <file_block_walk>
+  8009a4:	83 c4 10             	add    $0x10,%esp
+  8009a7:	85 c0                	test   %eax,%eax
+  8009a9:	78 58                	js     800a03 <file_get_block+0x77>
+		return r;
+
+	if (!*pdiskbno) {
+  8009ab:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+  8009ae:	83 3b 00             	cmpl   $0x0,(%ebx)
+  8009b1:	75 39                	jne    8009ec <file_get_block+0x60>
+		if ((r = alloc_block()) < 0)
+  8009b3:	e8 af fd ff ff       	call   800767 <alloc_block>
+  8009b8:	89 c6                	mov    %eax,%esi
+  8009ba:	85 c0                	test   %eax,%eax
+  8009bc:	78 4c                	js     800a0a <file_get_block+0x7e>
+			return -E_NO_DISK;
+
+		*pdiskbno = r;
+  8009be:	89 03                	mov    %eax,(%ebx)
+
+		memset(diskaddr(r), 0, BLKSIZE);
+  8009c0:	83 ec 0c             	sub    $0xc,%esp
+  8009c3:	50                   	push   %eax
+  8009c4:	e8 e1 f9 ff ff       	call   8003aa <diskaddr>
+  8009c9:	83 c4 0c             	add    $0xc,%esp
+  8009cc:	68 00 10 00 00       	push   $0x1000
+  8009d1:	6a 00                	push   $0x0
+  8009d3:	50                   	push   %eax
+  8009d4:	e8 9c 18 00 00       	call   802275 <memset>
+		flush_block(diskaddr(r));
+  8009d9:	89 34 24             	mov    %esi,(%esp)
+  8009dc:	e8 c9 f9 ff ff       	call   8003aa <diskaddr>
+  8009e1:	89 04 24             	mov    %eax,(%esp)
+  8009e4:	e8 3f fa ff ff       	call   800428 <flush_block>
+  8009e9:	83 c4 10             	add    $0x10,%esp
+	}
+
+	*blk = (char *) diskaddr(*pdiskbno);
+  8009ec:	83 ec 0c             	sub    $0xc,%esp
+  8009ef:	ff 33                	push   (%ebx)
+  8009f1:	e8 b4 f9 ff ff       	call   8003aa <diskaddr>
+  8009f6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009f9:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8009fb:	83 c4 10             	add    $0x10,%esp
+  8009fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a06:	5b                   	pop    %ebx
+  800a07:	5e                   	pop    %esi
+  800a08:	5d                   	pop    %ebp
+  800a09:	c3                   	ret
+			return -E_NO_DISK;
+  800a0a:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  800a0f:	eb f2                	jmp    800a03 <file_get_block+0x77>
+
+00800a11 <walk_path>:
+// If we cannot find the file but find the directory
+// it should be in, set *pdir and copy the final path
+// element into lastelem.
+static int
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	57                   	push   %edi
+  800a15:	56                   	push   %esi
+  800a16:	53                   	push   %ebx
+  800a17:	81 ec bc 00 00 00    	sub    $0xbc,%esp
+  800a1d:	89 95 40 ff ff ff    	mov    %edx,-0xc0(%ebp)
+  800a23:	89 8d 3c ff ff ff    	mov    %ecx,-0xc4(%ebp)
+	while (*p == '/')
+  800a29:	eb 03                	jmp    800a2e <walk_path+0x1d>
+		p++;
+  800a2b:	83 c0 01             	add    $0x1,%eax
+	while (*p == '/')
+  800a2e:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800a31:	74 f8                	je     800a2b <walk_path+0x1a>
+	int r;
+
+	// if (*path != '/')
+	//	return -E_BAD_PATH;
+	path = skip_slash(path);
+	f = &super->s_root;
+  800a33:	8b 0d 0c a0 80 00    	mov    0x80a00c,%ecx
+  800a39:	83 c1 08             	add    $0x8,%ecx
+  800a3c:	89 8d 4c ff ff ff    	mov    %ecx,-0xb4(%ebp)
+	dir = 0;
+	name[0] = 0;
+  800a42:	c6 85 68 ff ff ff 00 	movb   $0x0,-0x98(%ebp)
+
+	if (pdir)
+  800a49:	8b 8d 40 ff ff ff    	mov    -0xc0(%ebp),%ecx
+  800a4f:	85 c9                	test   %ecx,%ecx
+  800a51:	74 06                	je     800a59 <walk_path+0x48>
+		*pdir = 0;
+  800a53:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	*pf = 0;
+  800a59:	8b 8d 3c ff ff ff    	mov    -0xc4(%ebp),%ecx
+  800a5f:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	dir = 0;
+  800a65:	ba 00 00 00 00       	mov    $0x0,%edx
+		p = path;
+		while (*path != '/' && *path != '\0')
+			path++;
+		if (path - p >= MAXNAMELEN)
+			return -E_BAD_PATH;
+		memmove(name, p, path - p);
+  800a6a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	while (*path != '\0') {
+  800a70:	e9 03 01 00 00       	jmp    800b78 <walk_path+0x167>
+			path++;
+  800a75:	83 c3 01             	add    $0x1,%ebx
+		while (*path != '/' && *path != '\0')
+  800a78:	0f b6 13             	movzbl (%ebx),%edx
+  800a7b:	80 fa 2f             	cmp    $0x2f,%dl
+  800a7e:	74 04                	je     800a84 <walk_path+0x73>
+  800a80:	84 d2                	test   %dl,%dl
+  800a82:	75 f1                	jne    800a75 <walk_path+0x64>
+		if (path - p >= MAXNAMELEN)
+  800a84:	89 de                	mov    %ebx,%esi
+  800a86:	29 c6                	sub    %eax,%esi
+  800a88:	83 fe 7f             	cmp    $0x7f,%esi
+  800a8b:	0f 8f 9f 01 00 00    	jg     800c30 <walk_path+0x21f>
+		memmove(name, p, path - p);
+  800a91:	83 ec 04             	sub    $0x4,%esp
+  800a94:	56                   	push   %esi
+  800a95:	50                   	push   %eax
+  800a96:	57                   	push   %edi
+  800a97:	e8 0e 18 00 00       	call   8022aa <memmove>
+		name[path - p] = '\0';
+  800a9c:	c6 84 35 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%esi,1)
+  800aa3:	00 
+	while (*p == '/')
+  800aa4:	83 c4 10             	add    $0x10,%esp
+  800aa7:	eb 03                	jmp    800aac <walk_path+0x9b>
+		p++;
+  800aa9:	83 c3 01             	add    $0x1,%ebx
+	while (*p == '/')
+  800aac:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  800aaf:	74 f8                	je     800aa9 <walk_path+0x98>
+		path = skip_slash(path);
+
+		if (dir->f_type != FTYPE_DIR)
+  800ab1:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+  800ab7:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  800abe:	0f 85 73 01 00 00    	jne    800c37 <walk_path+0x226>
+	assert((dir->f_size % BLKSIZE) == 0);
+  800ac4:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  800aca:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  800acf:	0f 85 b3 00 00 00    	jne    800b88 <walk_path+0x177>
+	nblock = dir->f_size / BLKSIZE;
+  800ad5:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  800adb:	85 c0                	test   %eax,%eax
+  800add:	0f 48 c2             	cmovs  %edx,%eax
+  800ae0:	c1 f8 0c             	sar    $0xc,%eax
+  800ae3:	89 85 48 ff ff ff    	mov    %eax,-0xb8(%ebp)
+	for (i = 0; i < nblock; i++) {
+  800ae9:	c7 85 50 ff ff ff 00 	movl   $0x0,-0xb0(%ebp)
+  800af0:	00 00 00 
+  800af3:	89 9d 44 ff ff ff    	mov    %ebx,-0xbc(%ebp)
+  800af9:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+  800aff:	39 8d 48 ff ff ff    	cmp    %ecx,-0xb8(%ebp)
+  800b05:	0f 84 a2 00 00 00    	je     800bad <walk_path+0x19c>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  800b0b:	83 ec 04             	sub    $0x4,%esp
+  800b0e:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+  800b14:	50                   	push   %eax
+  800b15:	ff b5 50 ff ff ff    	push   -0xb0(%ebp)
+  800b1b:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+  800b21:	e8 66 fe ff ff       	call   80098c <file_get_block>
+  800b26:	83 c4 10             	add    $0x10,%esp
+  800b29:	85 c0                	test   %eax,%eax
+  800b2b:	0f 88 cc 00 00 00    	js     800bfd <walk_path+0x1ec>
+		for (j = 0; j < BLKFILES; j++)
+  800b31:	8b 9d 64 ff ff ff    	mov    -0x9c(%ebp),%ebx
+  800b37:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  800b3d:	39 f3                	cmp    %esi,%ebx
+  800b3f:	74 60                	je     800ba1 <walk_path+0x190>
+			if (strcmp(f[j].f_name, name) == 0) {
+  800b41:	89 9d 54 ff ff ff    	mov    %ebx,-0xac(%ebp)
+  800b47:	83 ec 08             	sub    $0x8,%esp
+  800b4a:	57                   	push   %edi
+  800b4b:	53                   	push   %ebx
+  800b4c:	e8 84 16 00 00       	call   8021d5 <strcmp>
+  800b51:	81 c3 00 01 00 00    	add    $0x100,%ebx
+  800b57:	83 c4 10             	add    $0x10,%esp
+  800b5a:	85 c0                	test   %eax,%eax
+  800b5c:	75 df                	jne    800b3d <walk_path+0x12c>
+  800b5e:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  800b64:	8b 95 4c ff ff ff    	mov    -0xb4(%ebp),%edx
+  800b6a:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  800b70:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  800b76:	89 d8                	mov    %ebx,%eax
+	while (*path != '\0') {
+  800b78:	80 38 00             	cmpb   $0x0,(%eax)
+  800b7b:	0f 84 86 00 00 00    	je     800c07 <walk_path+0x1f6>
+  800b81:	89 c3                	mov    %eax,%ebx
+  800b83:	e9 f0 fe ff ff       	jmp    800a78 <walk_path+0x67>
+	assert((dir->f_size % BLKSIZE) == 0);
+  800b88:	68 57 43 80 00       	push   $0x804357
+  800b8d:	68 fd 40 80 00       	push   $0x8040fd
+  800b92:	68 db 00 00 00       	push   $0xdb
+  800b97:	68 bf 42 80 00       	push   $0x8042bf
+  800b9c:	e8 ba 0e 00 00       	call   801a5b <_panic>
+	for (i = 0; i < nblock; i++) {
+  800ba1:	83 85 50 ff ff ff 01 	addl   $0x1,-0xb0(%ebp)
+  800ba8:	e9 4c ff ff ff       	jmp    800af9 <walk_path+0xe8>
+	return -E_NOT_FOUND;
+  800bad:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  800bb3:	be f5 ff ff ff       	mov    $0xfffffff5,%esi
+			return -E_NOT_FOUND;
+
+		if ((r = dir_lookup(dir, name, &f)) < 0) {
+			if (r == -E_NOT_FOUND && *path == '\0') {
+  800bb8:	83 fe f5             	cmp    $0xfffffff5,%esi
+  800bbb:	75 69                	jne    800c26 <walk_path+0x215>
+  800bbd:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800bc0:	75 64                	jne    800c26 <walk_path+0x215>
+				if (pdir)
+  800bc2:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  800bc8:	85 c0                	test   %eax,%eax
+  800bca:	74 08                	je     800bd4 <walk_path+0x1c3>
+					*pdir = dir;
+  800bcc:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  800bd2:	89 08                	mov    %ecx,(%eax)
+				if (lastelem)
+  800bd4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  800bd8:	74 15                	je     800bef <walk_path+0x1de>
+					strcpy(lastelem, name);
+  800bda:	83 ec 08             	sub    $0x8,%esp
+  800bdd:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800be3:	50                   	push   %eax
+  800be4:	ff 75 08             	push   0x8(%ebp)
+  800be7:	e8 38 15 00 00       	call   802124 <strcpy>
+  800bec:	83 c4 10             	add    $0x10,%esp
+				*pf = 0;
+  800bef:	8b 85 3c ff ff ff    	mov    -0xc4(%ebp),%eax
+  800bf5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  800bfb:	eb 29                	jmp    800c26 <walk_path+0x215>
+  800bfd:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  800c03:	89 c6                	mov    %eax,%esi
+  800c05:	eb b1                	jmp    800bb8 <walk_path+0x1a7>
+			}
+			return r;
+		}
+	}
+
+	if (pdir)
+  800c07:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  800c0d:	85 c0                	test   %eax,%eax
+  800c0f:	74 02                	je     800c13 <walk_path+0x202>
+		*pdir = dir;
+  800c11:	89 10                	mov    %edx,(%eax)
+	*pf = f;
+  800c13:	8b 85 3c ff ff ff    	mov    -0xc4(%ebp),%eax
+  800c19:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  800c1f:	89 08                	mov    %ecx,(%eax)
+	return 0;
+  800c21:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  800c26:	89 f0                	mov    %esi,%eax
+  800c28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2b:	5b                   	pop    %ebx
+  800c2c:	5e                   	pop    %esi
+  800c2d:	5f                   	pop    %edi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+			return -E_BAD_PATH;
+  800c30:	be f4 ff ff ff       	mov    $0xfffffff4,%esi
+  800c35:	eb ef                	jmp    800c26 <walk_path+0x215>
+			return -E_NOT_FOUND;
+  800c37:	be f5 ff ff ff       	mov    $0xfffffff5,%esi
+  800c3c:	eb e8                	jmp    800c26 <walk_path+0x215>
+
+00800c3e <file_open>:
+
+// Open "path".  On success set *pf to point at the file and return 0.
+// On error return < 0.
+int
+file_open(const char *path, struct File **pf)
+{
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	83 ec 14             	sub    $0x14,%esp
+	return walk_path(path, 0, pf, 0);
+  800c44:	6a 00                	push   $0x0
+  800c46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c51:	e8 bb fd ff ff       	call   800a11 <walk_path>
+}
+  800c56:	c9                   	leave
+  800c57:	c3                   	ret
+
+00800c58 <file_read>:
+// Read count bytes from f into buf, starting from seek position
+// offset.  This meant to mimic the standard pread function.
+// Returns the number of bytes read, < 0 on error.
+ssize_t
+file_read(struct File *f, void *buf, size_t count, off_t offset)
+{
+  800c58:	55                   	push   %ebp
+  800c59:	89 e5                	mov    %esp,%ebp
+  800c5b:	57                   	push   %edi
+  800c5c:	56                   	push   %esi
+  800c5d:	53                   	push   %ebx
+  800c5e:	83 ec 2c             	sub    $0x2c,%esp
+  800c61:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c67:	8b 55 14             	mov    0x14(%ebp),%edx
+	int r, bn;
+	off_t pos;
+	char *blk;
+
+	if (offset >= f->f_size)
+  800c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6d:	8b 88 80 00 00 00    	mov    0x80(%eax),%ecx
+		return 0;
+  800c73:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (offset >= f->f_size)
+  800c78:	39 d1                	cmp    %edx,%ecx
+  800c7a:	0f 8e 81 00 00 00    	jle    800d01 <file_read+0xa9>
+
+	count = MIN(count, f->f_size - offset);
+  800c80:	29 d1                	sub    %edx,%ecx
+  800c82:	39 d9                	cmp    %ebx,%ecx
+  800c84:	0f 47 cb             	cmova  %ebx,%ecx
+
+	for (pos = offset; pos < offset + count; ) {
+  800c87:	89 d3                	mov    %edx,%ebx
+  800c89:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  800c8c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c8f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800c92:	89 de                	mov    %ebx,%esi
+  800c94:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800c97:	39 c3                	cmp    %eax,%ebx
+  800c99:	73 61                	jae    800cfc <file_read+0xa4>
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  800c9b:	83 ec 04             	sub    $0x4,%esp
+  800c9e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800ca1:	50                   	push   %eax
+  800ca2:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800ca8:	85 db                	test   %ebx,%ebx
+  800caa:	0f 49 c3             	cmovns %ebx,%eax
+  800cad:	c1 f8 0c             	sar    $0xc,%eax
+  800cb0:	50                   	push   %eax
+  800cb1:	ff 75 08             	push   0x8(%ebp)
+  800cb4:	e8 d3 fc ff ff       	call   80098c <file_get_block>
+  800cb9:	83 c4 10             	add    $0x10,%esp
+  800cbc:	85 c0                	test   %eax,%eax
+  800cbe:	78 41                	js     800d01 <file_read+0xa9>
+			return r;
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  800cc0:	89 da                	mov    %ebx,%edx
+  800cc2:	c1 fa 1f             	sar    $0x1f,%edx
+  800cc5:	c1 ea 14             	shr    $0x14,%edx
+  800cc8:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  800ccb:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800cd0:	29 d0                	sub    %edx,%eax
+  800cd2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800cd7:	29 c2                	sub    %eax,%edx
+  800cd9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800cdc:	29 f1                	sub    %esi,%ecx
+  800cde:	39 ca                	cmp    %ecx,%edx
+  800ce0:	89 ce                	mov    %ecx,%esi
+  800ce2:	0f 46 f2             	cmovbe %edx,%esi
+		memmove(buf, blk + pos % BLKSIZE, bn);
+  800ce5:	83 ec 04             	sub    $0x4,%esp
+  800ce8:	56                   	push   %esi
+  800ce9:	03 45 e4             	add    -0x1c(%ebp),%eax
+  800cec:	50                   	push   %eax
+  800ced:	57                   	push   %edi
+  800cee:	e8 b7 15 00 00       	call   8022aa <memmove>
+		pos += bn;
+  800cf3:	01 f3                	add    %esi,%ebx
+		buf += bn;
+  800cf5:	01 f7                	add    %esi,%edi
+  800cf7:	83 c4 10             	add    $0x10,%esp
+  800cfa:	eb 96                	jmp    800c92 <file_read+0x3a>
+	}
+
+	return count;
+  800cfc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800cff:	89 c8                	mov    %ecx,%eax
+}
+  800d01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d04:	5b                   	pop    %ebx
+  800d05:	5e                   	pop    %esi
+  800d06:	5f                   	pop    %edi
+  800d07:	5d                   	pop    %ebp
+  800d08:	c3                   	ret
+
+00800d09 <file_set_size>:
+}
+
+// Set the size of file f, truncating or extending as necessary.
+int
+file_set_size(struct File *f, off_t newsize)
+{
+  800d09:	55                   	push   %ebp
+  800d0a:	89 e5                	mov    %esp,%ebp
+  800d0c:	57                   	push   %edi
+  800d0d:	56                   	push   %esi
+  800d0e:	53                   	push   %ebx
+  800d0f:	83 ec 2c             	sub    $0x2c,%esp
+  800d12:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d15:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (f->f_size > newsize)
+  800d18:	8b 86 80 00 00 00    	mov    0x80(%esi),%eax
+  800d1e:	39 f8                	cmp    %edi,%eax
+  800d20:	7f 1c                	jg     800d3e <file_set_size+0x35>
+		file_truncate_blocks(f, newsize);
+	f->f_size = newsize;
+  800d22:	89 be 80 00 00 00    	mov    %edi,0x80(%esi)
+	flush_block(f);
+  800d28:	83 ec 0c             	sub    $0xc,%esp
+  800d2b:	56                   	push   %esi
+  800d2c:	e8 f7 f6 ff ff       	call   800428 <flush_block>
+	return 0;
+}
+  800d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d39:	5b                   	pop    %ebx
+  800d3a:	5e                   	pop    %esi
+  800d3b:	5f                   	pop    %edi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  800d3e:	8d 90 fe 1f 00 00    	lea    0x1ffe(%eax),%edx
+  800d44:	05 ff 0f 00 00       	add    $0xfff,%eax
+  800d49:	0f 48 c2             	cmovs  %edx,%eax
+  800d4c:	c1 f8 0c             	sar    $0xc,%eax
+  800d4f:	89 c1                	mov    %eax,%ecx
+	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
+  800d51:	8d 97 fe 1f 00 00    	lea    0x1ffe(%edi),%edx
+  800d57:	89 f8                	mov    %edi,%eax
+  800d59:	05 ff 0f 00 00       	add    $0xfff,%eax
+  800d5e:	0f 49 d0             	cmovns %eax,%edx
+  800d61:	c1 fa 0c             	sar    $0xc,%edx
+	for (bno = new_nblocks; bno < old_nblocks; bno++)
+  800d64:	89 d3                	mov    %edx,%ebx
+  800d66:	89 ce                	mov    %ecx,%esi
+  800d68:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  800d6b:	eb 44                	jmp    800db1 <file_set_size+0xa8>
+	if (new_nblocks <= NDIRECT && f->f_indirect) {
+  800d6d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d70:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d73:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800d76:	83 fa 0a             	cmp    $0xa,%edx
+  800d79:	77 a7                	ja     800d22 <file_set_size+0x19>
+  800d7b:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  800d81:	85 c0                	test   %eax,%eax
+  800d83:	74 9d                	je     800d22 <file_set_size+0x19>
+		free_block(f->f_indirect);
+  800d85:	83 ec 0c             	sub    $0xc,%esp
+  800d88:	50                   	push   %eax
+  800d89:	e8 9d f9 ff ff       	call   80072b <free_block>
+		f->f_indirect = 0;
+  800d8e:	c7 86 b0 00 00 00 00 	movl   $0x0,0xb0(%esi)
+  800d95:	00 00 00 
+  800d98:	83 c4 10             	add    $0x10,%esp
+  800d9b:	eb 85                	jmp    800d22 <file_set_size+0x19>
+			cprintf("warning: file_free_block: %e", r);
+  800d9d:	83 ec 08             	sub    $0x8,%esp
+  800da0:	50                   	push   %eax
+  800da1:	68 74 43 80 00       	push   $0x804374
+  800da6:	e8 8b 0d 00 00       	call   801b36 <cprintf>
+  800dab:	83 c4 10             	add    $0x10,%esp
+	for (bno = new_nblocks; bno < old_nblocks; bno++)
+  800dae:	83 c3 01             	add    $0x1,%ebx
+  800db1:	39 f3                	cmp    %esi,%ebx
+  800db3:	73 b8                	jae    800d6d <file_set_size+0x64>
+	if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0)
+  800db5:	83 ec 0c             	sub    $0xc,%esp
+  800db8:	6a 00                	push   $0x0
+  800dba:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  800dbd:	89 da                	mov    %ebx,%edx
+  800dbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc2:	e8 09 fa ff ff       	call   8007d0 <file_block_walk>
+  800dc7:	83 c4 10             	add    $0x10,%esp
+  800dca:	85 c0                	test   %eax,%eax
+  800dcc:	78 cf                	js     800d9d <file_set_size+0x94>
+	if (*ptr) {
+  800dce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800dd1:	8b 07                	mov    (%edi),%eax
+  800dd3:	85 c0                	test   %eax,%eax
+  800dd5:	74 d7                	je     800dae <file_set_size+0xa5>
+		free_block(*ptr);
+  800dd7:	83 ec 0c             	sub    $0xc,%esp
+  800dda:	50                   	push   %eax
+  800ddb:	e8 4b f9 ff ff       	call   80072b <free_block>
+		*ptr = 0;
+  800de0:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  800de6:	83 c4 10             	add    $0x10,%esp
+  800de9:	eb c3                	jmp    800dae <file_set_size+0xa5>
+
+00800deb <file_write>:
+{
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+  800dee:	57                   	push   %edi
+  800def:	56                   	push   %esi
+  800df0:	53                   	push   %ebx
+  800df1:	83 ec 2c             	sub    $0x2c,%esp
+  800df4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	if (offset + count > f->f_size)
+  800df7:	89 df                	mov    %ebx,%edi
+  800df9:	03 7d 10             	add    0x10(%ebp),%edi
+  800dfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dff:	39 b8 80 00 00 00    	cmp    %edi,0x80(%eax)
+  800e05:	72 70                	jb     800e77 <file_write+0x8c>
+  800e07:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  800e0a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (pos = offset; pos < offset + count; ) {
+  800e0d:	89 de                	mov    %ebx,%esi
+  800e0f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800e12:	39 c3                	cmp    %eax,%ebx
+  800e14:	73 78                	jae    800e8e <file_write+0xa3>
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  800e16:	83 ec 04             	sub    $0x4,%esp
+  800e19:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800e1c:	50                   	push   %eax
+  800e1d:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800e23:	85 db                	test   %ebx,%ebx
+  800e25:	0f 49 c3             	cmovns %ebx,%eax
+  800e28:	c1 f8 0c             	sar    $0xc,%eax
+  800e2b:	50                   	push   %eax
+  800e2c:	ff 75 08             	push   0x8(%ebp)
+  800e2f:	e8 58 fb ff ff       	call   80098c <file_get_block>
+  800e34:	83 c4 10             	add    $0x10,%esp
+  800e37:	85 c0                	test   %eax,%eax
+  800e39:	78 56                	js     800e91 <file_write+0xa6>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  800e3b:	89 da                	mov    %ebx,%edx
+  800e3d:	c1 fa 1f             	sar    $0x1f,%edx
+  800e40:	c1 ea 14             	shr    $0x14,%edx
+  800e43:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  800e46:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800e4b:	29 d0                	sub    %edx,%eax
+  800e4d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e52:	29 c1                	sub    %eax,%ecx
+  800e54:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800e57:	29 f2                	sub    %esi,%edx
+  800e59:	39 d1                	cmp    %edx,%ecx
+  800e5b:	89 d6                	mov    %edx,%esi
+  800e5d:	0f 46 f1             	cmovbe %ecx,%esi
+		memmove(blk + pos % BLKSIZE, buf, bn);
+  800e60:	83 ec 04             	sub    $0x4,%esp
+  800e63:	56                   	push   %esi
+  800e64:	57                   	push   %edi
+  800e65:	03 45 e4             	add    -0x1c(%ebp),%eax
+  800e68:	50                   	push   %eax
+  800e69:	e8 3c 14 00 00       	call   8022aa <memmove>
+		pos += bn;
+  800e6e:	01 f3                	add    %esi,%ebx
+		buf += bn;
+  800e70:	01 f7                	add    %esi,%edi
+  800e72:	83 c4 10             	add    $0x10,%esp
+  800e75:	eb 96                	jmp    800e0d <file_write+0x22>
+		if ((r = file_set_size(f, offset + count)) < 0)
+  800e77:	83 ec 08             	sub    $0x8,%esp
+  800e7a:	57                   	push   %edi
+  800e7b:	50                   	push   %eax
+  800e7c:	e8 88 fe ff ff       	call   800d09 <file_set_size>
+  800e81:	83 c4 10             	add    $0x10,%esp
+  800e84:	85 c0                	test   %eax,%eax
+  800e86:	0f 89 7b ff ff ff    	jns    800e07 <file_write+0x1c>
+  800e8c:	eb 03                	jmp    800e91 <file_write+0xa6>
+	return count;
+  800e8e:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+  800e91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e94:	5b                   	pop    %ebx
+  800e95:	5e                   	pop    %esi
+  800e96:	5f                   	pop    %edi
+  800e97:	5d                   	pop    %ebp
+  800e98:	c3                   	ret
+
+00800e99 <file_flush>:
+// Loop over all the blocks in file.
+// Translate the file block number into a disk block number
+// and then check whether that disk block is dirty.  If so, write it out.
+void
+file_flush(struct File *f)
+{
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	56                   	push   %esi
+  800e9d:	53                   	push   %ebx
+  800e9e:	83 ec 10             	sub    $0x10,%esp
+  800ea1:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i;
+	uint32_t *pdiskbno;
+
+	for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++) {
+  800ea4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea9:	eb 03                	jmp    800eae <file_flush+0x15>
+  800eab:	83 c3 01             	add    $0x1,%ebx
+  800eae:	8b 96 80 00 00 00    	mov    0x80(%esi),%edx
+  800eb4:	8d 82 fe 1f 00 00    	lea    0x1ffe(%edx),%eax
+  800eba:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+  800ec0:	0f 49 c2             	cmovns %edx,%eax
+  800ec3:	c1 f8 0c             	sar    $0xc,%eax
+  800ec6:	39 d8                	cmp    %ebx,%eax
+  800ec8:	7e 3b                	jle    800f05 <file_flush+0x6c>
+		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  800eca:	83 ec 0c             	sub    $0xc,%esp
+  800ecd:	6a 00                	push   $0x0
+  800ecf:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800ed2:	89 da                	mov    %ebx,%edx
+  800ed4:	89 f0                	mov    %esi,%eax
+  800ed6:	e8 f5 f8 ff ff       	call   8007d0 <file_block_walk>
+  800edb:	83 c4 10             	add    $0x10,%esp
+  800ede:	85 c0                	test   %eax,%eax
+  800ee0:	78 c9                	js     800eab <file_flush+0x12>
+		    pdiskbno == NULL || *pdiskbno == 0)
+  800ee2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  800ee5:	85 c0                	test   %eax,%eax
+  800ee7:	74 c2                	je     800eab <file_flush+0x12>
+		    pdiskbno == NULL || *pdiskbno == 0)
+  800ee9:	8b 00                	mov    (%eax),%eax
+  800eeb:	85 c0                	test   %eax,%eax
+  800eed:	74 bc                	je     800eab <file_flush+0x12>
+			continue;
+		flush_block(diskaddr(*pdiskbno));
+  800eef:	83 ec 0c             	sub    $0xc,%esp
+  800ef2:	50                   	push   %eax
+  800ef3:	e8 b2 f4 ff ff       	call   8003aa <diskaddr>
+  800ef8:	89 04 24             	mov    %eax,(%esp)
+  800efb:	e8 28 f5 ff ff       	call   800428 <flush_block>
+  800f00:	83 c4 10             	add    $0x10,%esp
+  800f03:	eb a6                	jmp    800eab <file_flush+0x12>
+	}
+	flush_block(f);
+  800f05:	83 ec 0c             	sub    $0xc,%esp
+  800f08:	56                   	push   %esi
+  800f09:	e8 1a f5 ff ff       	call   800428 <flush_block>
+	if (f->f_indirect)
+  800f0e:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  800f14:	83 c4 10             	add    $0x10,%esp
+  800f17:	85 c0                	test   %eax,%eax
+  800f19:	75 07                	jne    800f22 <file_flush+0x89>
+		flush_block(diskaddr(f->f_indirect));
+}
+  800f1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f1e:	5b                   	pop    %ebx
+  800f1f:	5e                   	pop    %esi
+  800f20:	5d                   	pop    %ebp
+  800f21:	c3                   	ret
+		flush_block(diskaddr(f->f_indirect));
+  800f22:	83 ec 0c             	sub    $0xc,%esp
+  800f25:	50                   	push   %eax
+  800f26:	e8 7f f4 ff ff       	call   8003aa <diskaddr>
+  800f2b:	89 04 24             	mov    %eax,(%esp)
+  800f2e:	e8 f5 f4 ff ff       	call   800428 <flush_block>
+  800f33:	83 c4 10             	add    $0x10,%esp
+}
+  800f36:	eb e3                	jmp    800f1b <file_flush+0x82>
+
+00800f38 <file_create>:
+{
+  800f38:	55                   	push   %ebp
+  800f39:	89 e5                	mov    %esp,%ebp
+  800f3b:	57                   	push   %edi
+  800f3c:	56                   	push   %esi
+  800f3d:	53                   	push   %ebx
+  800f3e:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+	if ((r = walk_path(path, &dir, &f, name)) == 0)
+  800f44:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800f4a:	50                   	push   %eax
+  800f4b:	8d 8d 60 ff ff ff    	lea    -0xa0(%ebp),%ecx
+  800f51:	8d 95 64 ff ff ff    	lea    -0x9c(%ebp),%edx
+  800f57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f5a:	e8 b2 fa ff ff       	call   800a11 <walk_path>
+  800f5f:	83 c4 10             	add    $0x10,%esp
+  800f62:	85 c0                	test   %eax,%eax
+  800f64:	0f 84 cd 00 00 00    	je     801037 <file_create+0xff>
+  800f6a:	89 c3                	mov    %eax,%ebx
+	if (r != -E_NOT_FOUND || dir == 0)
+  800f6c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  800f6f:	0f 85 f1 00 00 00    	jne    801066 <file_create+0x12e>
+  800f75:	8b bd 64 ff ff ff    	mov    -0x9c(%ebp),%edi
+  800f7b:	85 ff                	test   %edi,%edi
+  800f7d:	0f 84 e3 00 00 00    	je     801066 <file_create+0x12e>
+	assert((dir->f_size % BLKSIZE) == 0);
+  800f83:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+  800f89:	89 c3                	mov    %eax,%ebx
+  800f8b:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  800f91:	75 58                	jne    800feb <file_create+0xb3>
+	nblock = dir->f_size / BLKSIZE;
+  800f93:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  800f99:	85 c0                	test   %eax,%eax
+  800f9b:	0f 48 c2             	cmovs  %edx,%eax
+  800f9e:	c1 f8 0c             	sar    $0xc,%eax
+  800fa1:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+	for (i = 0; i < nblock; i++) {
+  800fa7:	be 00 00 00 00       	mov    $0x0,%esi
+  800fac:	39 b5 54 ff ff ff    	cmp    %esi,-0xac(%ebp)
+  800fb2:	74 55                	je     801009 <file_create+0xd1>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  800fb4:	83 ec 04             	sub    $0x4,%esp
+  800fb7:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  800fbd:	50                   	push   %eax
+  800fbe:	56                   	push   %esi
+  800fbf:	57                   	push   %edi
+  800fc0:	e8 c7 f9 ff ff       	call   80098c <file_get_block>
+  800fc5:	83 c4 10             	add    $0x10,%esp
+  800fc8:	85 c0                	test   %eax,%eax
+  800fca:	78 67                	js     801033 <file_create+0xfb>
+		for (j = 0; j < BLKFILES; j++)
+  800fcc:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  800fd2:	8d 88 00 10 00 00    	lea    0x1000(%eax),%ecx
+  800fd8:	39 c8                	cmp    %ecx,%eax
+  800fda:	74 28                	je     801004 <file_create+0xcc>
+			if (f[j].f_name[0] == '\0') {
+  800fdc:	8d 90 00 01 00 00    	lea    0x100(%eax),%edx
+  800fe2:	80 38 00             	cmpb   $0x0,(%eax)
+  800fe5:	74 57                	je     80103e <file_create+0x106>
+  800fe7:	89 d0                	mov    %edx,%eax
+  800fe9:	eb ed                	jmp    800fd8 <file_create+0xa0>
+	assert((dir->f_size % BLKSIZE) == 0);
+  800feb:	68 57 43 80 00       	push   $0x804357
+  800ff0:	68 fd 40 80 00       	push   $0x8040fd
+  800ff5:	68 f4 00 00 00       	push   $0xf4
+  800ffa:	68 bf 42 80 00       	push   $0x8042bf
+  800fff:	e8 57 0a 00 00       	call   801a5b <_panic>
+	for (i = 0; i < nblock; i++) {
+  801004:	83 c6 01             	add    $0x1,%esi
+  801007:	eb a3                	jmp    800fac <file_create+0x74>
+	dir->f_size += BLKSIZE;
+  801009:	81 87 80 00 00 00 00 	addl   $0x1000,0x80(%edi)
+  801010:	10 00 00 
+	if ((r = file_get_block(dir, i, &blk)) < 0)
+  801013:	83 ec 04             	sub    $0x4,%esp
+  801016:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80101c:	50                   	push   %eax
+  80101d:	56                   	push   %esi
+  80101e:	57                   	push   %edi
+  80101f:	e8 68 f9 ff ff       	call   80098c <file_get_block>
+  801024:	83 c4 10             	add    $0x10,%esp
+  801027:	85 c0                	test   %eax,%eax
+  801029:	78 45                	js     801070 <file_create+0x138>
+	f = (struct File*) blk;
+  80102b:	8b b5 5c ff ff ff    	mov    -0xa4(%ebp),%esi
+	return 0;
+  801031:	eb 0d                	jmp    801040 <file_create+0x108>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  801033:	89 c3                	mov    %eax,%ebx
+  801035:	eb 2f                	jmp    801066 <file_create+0x12e>
+		return -E_FILE_EXISTS;
+  801037:	bb f3 ff ff ff       	mov    $0xfffffff3,%ebx
+  80103c:	eb 28                	jmp    801066 <file_create+0x12e>
+			if (f[j].f_name[0] == '\0') {
+  80103e:	89 c6                	mov    %eax,%esi
+	*file = &f[0];
+  801040:	89 b5 60 ff ff ff    	mov    %esi,-0xa0(%ebp)
+	strcpy(f->f_name, name);
+  801046:	83 ec 08             	sub    $0x8,%esp
+  801049:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80104f:	50                   	push   %eax
+  801050:	56                   	push   %esi
+  801051:	e8 ce 10 00 00       	call   802124 <strcpy>
+	*pf = f;
+  801056:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801059:	89 30                	mov    %esi,(%eax)
+	file_flush(dir);
+  80105b:	89 3c 24             	mov    %edi,(%esp)
+  80105e:	e8 36 fe ff ff       	call   800e99 <file_flush>
+	return 0;
+  801063:	83 c4 10             	add    $0x10,%esp
+}
+  801066:	89 d8                	mov    %ebx,%eax
+  801068:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106b:	5b                   	pop    %ebx
+  80106c:	5e                   	pop    %esi
+  80106d:	5f                   	pop    %edi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+		return r;
+  801070:	89 c3                	mov    %eax,%ebx
+  801072:	eb f2                	jmp    801066 <file_create+0x12e>
+
+00801074 <fs_sync>:
+
+
+// Sync the entire file system.  A big hammer.
+void
+fs_sync(void)
+{
+  801074:	55                   	push   %ebp
+  801075:	89 e5                	mov    %esp,%ebp
+  801077:	53                   	push   %ebx
+  801078:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 1; i < super->s_nblocks; i++)
+  80107b:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801080:	eb 17                	jmp    801099 <fs_sync+0x25>
+		flush_block(diskaddr(i));
+  801082:	83 ec 0c             	sub    $0xc,%esp
+  801085:	53                   	push   %ebx
+  801086:	e8 1f f3 ff ff       	call   8003aa <diskaddr>
+  80108b:	89 04 24             	mov    %eax,(%esp)
+  80108e:	e8 95 f3 ff ff       	call   800428 <flush_block>
+	for (i = 1; i < super->s_nblocks; i++)
+  801093:	83 c3 01             	add    $0x1,%ebx
+  801096:	83 c4 10             	add    $0x10,%esp
+  801099:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  80109e:	3b 58 04             	cmp    0x4(%eax),%ebx
+  8010a1:	72 df                	jb     801082 <fs_sync+0xe>
+}
+  8010a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010a6:	c9                   	leave
+  8010a7:	c3                   	ret
+
+008010a8 <serve_sync>:
+}
+
+
+int
+serve_sync(envid_t envid, union Fsipc *req)
+{
+  8010a8:	55                   	push   %ebp
+  8010a9:	89 e5                	mov    %esp,%ebp
+  8010ab:	83 ec 08             	sub    $0x8,%esp
+	fs_sync();
+  8010ae:	e8 c1 ff ff ff       	call   801074 <fs_sync>
+	return 0;
+}
+  8010b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b8:	c9                   	leave
+  8010b9:	c3                   	ret
+
+008010ba <serve_init>:
+	for (i = 0; i < MAXOPEN; i++) {
+  8010ba:	ba 60 50 80 00       	mov    $0x805060,%edx
+	uintptr_t va = FILEVA;
+  8010bf:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	for (i = 0; i < MAXOPEN; i++) {
+  8010c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+		opentab[i].o_fileid = i;
+  8010c9:	89 0a                	mov    %ecx,(%edx)
+		opentab[i].o_fd = (struct Fd*) va;
+  8010cb:	89 42 0c             	mov    %eax,0xc(%edx)
+		va += PGSIZE;
+  8010ce:	05 00 10 00 00       	add    $0x1000,%eax
+	for (i = 0; i < MAXOPEN; i++) {
+  8010d3:	83 c1 01             	add    $0x1,%ecx
+  8010d6:	83 c2 10             	add    $0x10,%edx
+  8010d9:	3d 00 00 40 d0       	cmp    $0xd0400000,%eax
+  8010de:	75 e9                	jne    8010c9 <serve_init+0xf>
+}
+  8010e0:	c3                   	ret
+
+008010e1 <openfile_alloc>:
+{
+  8010e1:	55                   	push   %ebp
+  8010e2:	89 e5                	mov    %esp,%ebp
+  8010e4:	57                   	push   %edi
+  8010e5:	56                   	push   %esi
+  8010e6:	53                   	push   %ebx
+  8010e7:	83 ec 0c             	sub    $0xc,%esp
+  8010ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+	for (i = 0; i < MAXOPEN; i++) {
+  8010ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+		switch (pageref(opentab[i].o_fd)) {
+  8010f2:	89 de                	mov    %ebx,%esi
+  8010f4:	c1 e6 04             	shl    $0x4,%esi
+  8010f7:	83 ec 0c             	sub    $0xc,%esp
+  8010fa:	ff b6 6c 50 80 00    	push   0x80506c(%esi)
+  801100:	e8 09 22 00 00       	call   80330e <pageref>
+  801105:	83 c4 10             	add    $0x10,%esp
+  801108:	85 c0                	test   %eax,%eax
+  80110a:	74 17                	je     801123 <openfile_alloc+0x42>
+  80110c:	83 f8 01             	cmp    $0x1,%eax
+  80110f:	74 30                	je     801141 <openfile_alloc+0x60>
+	for (i = 0; i < MAXOPEN; i++) {
+  801111:	83 c3 01             	add    $0x1,%ebx
+  801114:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  80111a:	75 d6                	jne    8010f2 <openfile_alloc+0x11>
+	return -E_MAX_OPEN;
+  80111c:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801121:	eb 4f                	jmp    801172 <openfile_alloc+0x91>
+			if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P|PTE_U|PTE_W)) < 0)
+  801123:	83 ec 04             	sub    $0x4,%esp
+  801126:	6a 07                	push   $0x7
+  801128:	89 d8                	mov    %ebx,%eax
+  80112a:	c1 e0 04             	shl    $0x4,%eax
+  80112d:	ff b0 6c 50 80 00    	push   0x80506c(%eax)
+  801133:	6a 00                	push   $0x0
+  801135:	e8 57 14 00 00       	call   802591 <sys_page_alloc>
+  80113a:	83 c4 10             	add    $0x10,%esp
+  80113d:	85 c0                	test   %eax,%eax
+  80113f:	78 31                	js     801172 <openfile_alloc+0x91>
+			opentab[i].o_fileid += MAXOPEN;
+  801141:	c1 e3 04             	shl    $0x4,%ebx
+  801144:	81 83 60 50 80 00 00 	addl   $0x400,0x805060(%ebx)
+  80114b:	04 00 00 
+			*o = &opentab[i];
+  80114e:	81 c6 60 50 80 00    	add    $0x805060,%esi
+  801154:	89 37                	mov    %esi,(%edi)
+			memset(opentab[i].o_fd, 0, PGSIZE);
+  801156:	83 ec 04             	sub    $0x4,%esp
+  801159:	68 00 10 00 00       	push   $0x1000
+  80115e:	6a 00                	push   $0x0
+  801160:	ff b3 6c 50 80 00    	push   0x80506c(%ebx)
+  801166:	e8 0a 11 00 00       	call   802275 <memset>
+			return (*o)->o_fileid;
+  80116b:	8b 07                	mov    (%edi),%eax
+  80116d:	8b 00                	mov    (%eax),%eax
+  80116f:	83 c4 10             	add    $0x10,%esp
+}
+  801172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+
+0080117a <openfile_lookup>:
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+  801180:	83 ec 18             	sub    $0x18,%esp
+  801183:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	o = &opentab[fileid % MAXOPEN];
+  801186:	89 fb                	mov    %edi,%ebx
+  801188:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80118e:	89 de                	mov    %ebx,%esi
+  801190:	c1 e6 04             	shl    $0x4,%esi
+	if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  801193:	ff b6 6c 50 80 00    	push   0x80506c(%esi)
+	o = &opentab[fileid % MAXOPEN];
+  801199:	81 c6 60 50 80 00    	add    $0x805060,%esi
+	if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  80119f:	e8 6a 21 00 00       	call   80330e <pageref>
+  8011a4:	83 c4 10             	add    $0x10,%esp
+  8011a7:	83 f8 01             	cmp    $0x1,%eax
+  8011aa:	7e 1d                	jle    8011c9 <openfile_lookup+0x4f>
+  8011ac:	c1 e3 04             	shl    $0x4,%ebx
+  8011af:	39 bb 60 50 80 00    	cmp    %edi,0x805060(%ebx)
+  8011b5:	75 19                	jne    8011d0 <openfile_lookup+0x56>
+	*po = o;
+  8011b7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8011ba:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8011bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c4:	5b                   	pop    %ebx
+  8011c5:	5e                   	pop    %esi
+  8011c6:	5f                   	pop    %edi
+  8011c7:	5d                   	pop    %ebp
+  8011c8:	c3                   	ret
+		return -E_INVAL;
+  8011c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ce:	eb f1                	jmp    8011c1 <openfile_lookup+0x47>
+  8011d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011d5:	eb ea                	jmp    8011c1 <openfile_lookup+0x47>
+
+008011d7 <serve_set_size>:
+{
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+  8011da:	53                   	push   %ebx
+  8011db:	83 ec 18             	sub    $0x18,%esp
+  8011de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8011e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011e4:	50                   	push   %eax
+  8011e5:	ff 33                	push   (%ebx)
+  8011e7:	ff 75 08             	push   0x8(%ebp)
+  8011ea:	e8 8b ff ff ff       	call   80117a <openfile_lookup>
+  8011ef:	83 c4 10             	add    $0x10,%esp
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	78 14                	js     80120a <serve_set_size+0x33>
+	return file_set_size(o->o_file, req->req_size);
+  8011f6:	83 ec 08             	sub    $0x8,%esp
+  8011f9:	ff 73 04             	push   0x4(%ebx)
+  8011fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8011ff:	ff 70 04             	push   0x4(%eax)
+  801202:	e8 02 fb ff ff       	call   800d09 <file_set_size>
+  801207:	83 c4 10             	add    $0x10,%esp
+}
+  80120a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80120d:	c9                   	leave
+  80120e:	c3                   	ret
+
+0080120f <serve_read>:
+{
+  80120f:	55                   	push   %ebp
+  801210:	89 e5                	mov    %esp,%ebp
+  801212:	56                   	push   %esi
+  801213:	53                   	push   %ebx
+  801214:	83 ec 14             	sub    $0x14,%esp
+  801217:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  80121a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80121d:	50                   	push   %eax
+  80121e:	ff 33                	push   (%ebx)
+  801220:	ff 75 08             	push   0x8(%ebp)
+  801223:	e8 52 ff ff ff       	call   80117a <openfile_lookup>
+  801228:	83 c4 10             	add    $0x10,%esp
+  80122b:	85 c0                	test   %eax,%eax
+  80122d:	78 2d                	js     80125c <serve_read+0x4d>
+	if ((r = file_read(o->o_file, ret->ret_buf, MIN(req->req_n, sizeof(ret->ret_buf)), o->o_fd->fd_offset)) < 0)
+  80122f:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  801232:	8b 46 0c             	mov    0xc(%esi),%eax
+  801235:	ff 70 04             	push   0x4(%eax)
+  801238:	8b 43 04             	mov    0x4(%ebx),%eax
+  80123b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801240:	39 d0                	cmp    %edx,%eax
+  801242:	0f 47 c2             	cmova  %edx,%eax
+  801245:	50                   	push   %eax
+  801246:	53                   	push   %ebx
+  801247:	ff 76 04             	push   0x4(%esi)
+  80124a:	e8 09 fa ff ff       	call   800c58 <file_read>
+  80124f:	83 c4 10             	add    $0x10,%esp
+  801252:	85 c0                	test   %eax,%eax
+  801254:	78 06                	js     80125c <serve_read+0x4d>
+	o->o_fd->fd_offset += r;
+  801256:	8b 56 0c             	mov    0xc(%esi),%edx
+  801259:	01 42 04             	add    %eax,0x4(%edx)
+}
+  80125c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80125f:	5b                   	pop    %ebx
+  801260:	5e                   	pop    %esi
+  801261:	5d                   	pop    %ebp
+  801262:	c3                   	ret
+
+00801263 <serve_write>:
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	56                   	push   %esi
+  801267:	53                   	push   %ebx
+  801268:	83 ec 14             	sub    $0x14,%esp
+  80126b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  80126e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801271:	50                   	push   %eax
+  801272:	ff 33                	push   (%ebx)
+  801274:	ff 75 08             	push   0x8(%ebp)
+  801277:	e8 fe fe ff ff       	call   80117a <openfile_lookup>
+  80127c:	83 c4 10             	add    $0x10,%esp
+  80127f:	85 c0                	test   %eax,%eax
+  801281:	78 30                	js     8012b3 <serve_write+0x50>
+	if ((r = file_write(o->o_file, req->req_buf, MIN(req->req_n, sizeof(req->req_buf)), o->o_fd->fd_offset)) < 0)
+  801283:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  801286:	8b 46 0c             	mov    0xc(%esi),%eax
+  801289:	ff 70 04             	push   0x4(%eax)
+  80128c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80128f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801294:	39 d0                	cmp    %edx,%eax
+  801296:	0f 47 c2             	cmova  %edx,%eax
+  801299:	50                   	push   %eax
+  80129a:	83 c3 08             	add    $0x8,%ebx
+  80129d:	53                   	push   %ebx
+  80129e:	ff 76 04             	push   0x4(%esi)
+  8012a1:	e8 45 fb ff ff       	call   800deb <file_write>
+  8012a6:	83 c4 10             	add    $0x10,%esp
+  8012a9:	85 c0                	test   %eax,%eax
+  8012ab:	78 06                	js     8012b3 <serve_write+0x50>
+	o->o_fd->fd_offset += r;
+  8012ad:	8b 56 0c             	mov    0xc(%esi),%edx
+  8012b0:	01 42 04             	add    %eax,0x4(%edx)
+}
+  8012b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012b6:	5b                   	pop    %ebx
+  8012b7:	5e                   	pop    %esi
+  8012b8:	5d                   	pop    %ebp
+  8012b9:	c3                   	ret
+
+008012ba <serve_stat>:
+{
+  8012ba:	55                   	push   %ebp
+  8012bb:	89 e5                	mov    %esp,%ebp
+  8012bd:	56                   	push   %esi
+  8012be:	53                   	push   %ebx
+  8012bf:	83 ec 14             	sub    $0x14,%esp
+  8012c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8012c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012c8:	50                   	push   %eax
+  8012c9:	ff 33                	push   (%ebx)
+  8012cb:	ff 75 08             	push   0x8(%ebp)
+  8012ce:	e8 a7 fe ff ff       	call   80117a <openfile_lookup>
+  8012d3:	83 c4 10             	add    $0x10,%esp
+  8012d6:	85 c0                	test   %eax,%eax
+  8012d8:	78 3c                	js     801316 <serve_stat+0x5c>
+	strcpy(ret->ret_name, o->o_file->f_name);
+  8012da:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8012dd:	83 ec 08             	sub    $0x8,%esp
+  8012e0:	ff 76 04             	push   0x4(%esi)
+  8012e3:	53                   	push   %ebx
+  8012e4:	e8 3b 0e 00 00       	call   802124 <strcpy>
+	ret->ret_size = o->o_file->f_size;
+  8012e9:	8b 46 04             	mov    0x4(%esi),%eax
+  8012ec:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8012f2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  8012f8:	8b 46 04             	mov    0x4(%esi),%eax
+  8012fb:	83 c4 10             	add    $0x10,%esp
+  8012fe:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  801305:	0f 94 c0             	sete   %al
+  801308:	0f b6 c0             	movzbl %al,%eax
+  80130b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801311:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801316:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801319:	5b                   	pop    %ebx
+  80131a:	5e                   	pop    %esi
+  80131b:	5d                   	pop    %ebp
+  80131c:	c3                   	ret
+
+0080131d <serve_flush>:
+{
+  80131d:	55                   	push   %ebp
+  80131e:	89 e5                	mov    %esp,%ebp
+  801320:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801323:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801326:	50                   	push   %eax
+  801327:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80132a:	ff 30                	push   (%eax)
+  80132c:	ff 75 08             	push   0x8(%ebp)
+  80132f:	e8 46 fe ff ff       	call   80117a <openfile_lookup>
+  801334:	83 c4 10             	add    $0x10,%esp
+  801337:	85 c0                	test   %eax,%eax
+  801339:	78 16                	js     801351 <serve_flush+0x34>
+	file_flush(o->o_file);
+  80133b:	83 ec 0c             	sub    $0xc,%esp
+  80133e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801341:	ff 70 04             	push   0x4(%eax)
+  801344:	e8 50 fb ff ff       	call   800e99 <file_flush>
+	return 0;
+  801349:	83 c4 10             	add    $0x10,%esp
+  80134c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801351:	c9                   	leave
+  801352:	c3                   	ret
+
+00801353 <serve_open>:
+{
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	53                   	push   %ebx
+  801357:	81 ec 18 04 00 00    	sub    $0x418,%esp
+  80135d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	memmove(path, req->req_path, MAXPATHLEN);
+  801360:	68 00 04 00 00       	push   $0x400
+  801365:	53                   	push   %ebx
+  801366:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  80136c:	50                   	push   %eax
+  80136d:	e8 38 0f 00 00       	call   8022aa <memmove>
+	path[MAXPATHLEN-1] = 0;
+  801372:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+	if ((r = openfile_alloc(&o)) < 0) {
+  801376:	8d 85 f0 fb ff ff    	lea    -0x410(%ebp),%eax
+  80137c:	89 04 24             	mov    %eax,(%esp)
+  80137f:	e8 5d fd ff ff       	call   8010e1 <openfile_alloc>
+  801384:	83 c4 10             	add    $0x10,%esp
+  801387:	85 c0                	test   %eax,%eax
+  801389:	0f 88 ea 00 00 00    	js     801479 <serve_open+0x126>
+	if (req->req_omode & O_CREAT) {
+  80138f:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%ebx)
+  801396:	74 33                	je     8013cb <serve_open+0x78>
+		if ((r = file_create(path, &f)) < 0) {
+  801398:	83 ec 08             	sub    $0x8,%esp
+  80139b:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  8013a1:	50                   	push   %eax
+  8013a2:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8013a8:	50                   	push   %eax
+  8013a9:	e8 8a fb ff ff       	call   800f38 <file_create>
+  8013ae:	83 c4 10             	add    $0x10,%esp
+  8013b1:	85 c0                	test   %eax,%eax
+  8013b3:	79 37                	jns    8013ec <serve_open+0x99>
+			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+  8013b5:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%ebx)
+  8013bc:	0f 85 b7 00 00 00    	jne    801479 <serve_open+0x126>
+  8013c2:	83 f8 f3             	cmp    $0xfffffff3,%eax
+  8013c5:	0f 85 ae 00 00 00    	jne    801479 <serve_open+0x126>
+		if ((r = file_open(path, &f)) < 0) {
+  8013cb:	83 ec 08             	sub    $0x8,%esp
+  8013ce:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  8013d4:	50                   	push   %eax
+  8013d5:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8013db:	50                   	push   %eax
+  8013dc:	e8 5d f8 ff ff       	call   800c3e <file_open>
+  8013e1:	83 c4 10             	add    $0x10,%esp
+  8013e4:	85 c0                	test   %eax,%eax
+  8013e6:	0f 88 8d 00 00 00    	js     801479 <serve_open+0x126>
+	if (req->req_omode & O_TRUNC) {
+  8013ec:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%ebx)
+  8013f3:	74 17                	je     80140c <serve_open+0xb9>
+		if ((r = file_set_size(f, 0)) < 0) {
+  8013f5:	83 ec 08             	sub    $0x8,%esp
+  8013f8:	6a 00                	push   $0x0
+  8013fa:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  801400:	e8 04 f9 ff ff       	call   800d09 <file_set_size>
+  801405:	83 c4 10             	add    $0x10,%esp
+  801408:	85 c0                	test   %eax,%eax
+  80140a:	78 6d                	js     801479 <serve_open+0x126>
+	if ((r = file_open(path, &f)) < 0) {
+  80140c:	83 ec 08             	sub    $0x8,%esp
+  80140f:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  801415:	50                   	push   %eax
+  801416:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  80141c:	50                   	push   %eax
+  80141d:	e8 1c f8 ff ff       	call   800c3e <file_open>
+  801422:	83 c4 10             	add    $0x10,%esp
+  801425:	85 c0                	test   %eax,%eax
+  801427:	78 50                	js     801479 <serve_open+0x126>
+	o->o_file = f;
+  801429:	8b 85 f0 fb ff ff    	mov    -0x410(%ebp),%eax
+  80142f:	8b 95 f4 fb ff ff    	mov    -0x40c(%ebp),%edx
+  801435:	89 50 04             	mov    %edx,0x4(%eax)
+	o->o_fd->fd_file.id = o->o_fileid;
+  801438:	8b 50 0c             	mov    0xc(%eax),%edx
+  80143b:	8b 08                	mov    (%eax),%ecx
+  80143d:	89 4a 0c             	mov    %ecx,0xc(%edx)
+	o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  801440:	8b 48 0c             	mov    0xc(%eax),%ecx
+  801443:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  801449:	83 e2 03             	and    $0x3,%edx
+  80144c:	89 51 08             	mov    %edx,0x8(%ecx)
+	o->o_fd->fd_dev_id = devfile.dev_id;
+  80144f:	8b 50 0c             	mov    0xc(%eax),%edx
+  801452:	8b 0d 64 90 80 00    	mov    0x809064,%ecx
+  801458:	89 0a                	mov    %ecx,(%edx)
+	o->o_mode = req->req_omode;
+  80145a:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  801460:	89 50 08             	mov    %edx,0x8(%eax)
+	*pg_store = o->o_fd;
+  801463:	8b 50 0c             	mov    0xc(%eax),%edx
+  801466:	8b 45 10             	mov    0x10(%ebp),%eax
+  801469:	89 10                	mov    %edx,(%eax)
+	*perm_store = PTE_P|PTE_U|PTE_W|PTE_SHARE;
+  80146b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80146e:	c7 00 07 04 00 00    	movl   $0x407,(%eax)
+	return 0;
+  801474:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801479:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80147c:	c9                   	leave
+  80147d:	c3                   	ret
+
+0080147e <serve>:
+};
+#define NHANDLERS (sizeof(handlers)/sizeof(handlers[0]))
+
+void
+serve(void)
+{
+  80147e:	55                   	push   %ebp
+  80147f:	89 e5                	mov    %esp,%ebp
+  801481:	56                   	push   %esi
+  801482:	53                   	push   %ebx
+  801483:	83 ec 10             	sub    $0x10,%esp
+	int perm, r;
+	void *pg;
+
+	while (1) {
+		perm = 0;
+		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+  801486:	8d 5d f0             	lea    -0x10(%ebp),%ebx
+  801489:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80148c:	eb 13                	jmp    8014a1 <serve+0x23>
+			cprintf("fs req %d from %08x [page %08x: %s]\n",
+				req, whom, uvpt[PGNUM(fsreq)], fsreq);
+
+		// All requests must contain an argument page
+		if (!(perm & PTE_P)) {
+			cprintf("Invalid request from %08x: no argument page\n",
+  80148e:	83 ec 08             	sub    $0x8,%esp
+  801491:	ff 75 f4             	push   -0xc(%ebp)
+  801494:	68 94 43 80 00       	push   $0x804394
+  801499:	e8 98 06 00 00       	call   801b36 <cprintf>
+				whom);
+			continue; // just leave it hanging...
+  80149e:	83 c4 10             	add    $0x10,%esp
+		perm = 0;
+  8014a1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+  8014a8:	83 ec 04             	sub    $0x4,%esp
+  8014ab:	53                   	push   %ebx
+  8014ac:	ff 35 44 50 80 00    	push   0x805044
+  8014b2:	56                   	push   %esi
+  8014b3:	e8 8f 15 00 00       	call   802a47 <ipc_recv>
+		if (!(perm & PTE_P)) {
+  8014b8:	83 c4 10             	add    $0x10,%esp
+  8014bb:	f6 45 f0 01          	testb  $0x1,-0x10(%ebp)
+  8014bf:	74 cd                	je     80148e <serve+0x10>
+		}
+
+		pg = NULL;
+  8014c1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+		if (req == FSREQ_OPEN) {
+  8014c8:	83 f8 01             	cmp    $0x1,%eax
+  8014cb:	74 23                	je     8014f0 <serve+0x72>
+			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+		} else if (req < NHANDLERS && handlers[req]) {
+  8014cd:	83 f8 08             	cmp    $0x8,%eax
+  8014d0:	77 36                	ja     801508 <serve+0x8a>
+  8014d2:	8b 14 85 20 50 80 00 	mov    0x805020(,%eax,4),%edx
+  8014d9:	85 d2                	test   %edx,%edx
+  8014db:	74 2b                	je     801508 <serve+0x8a>
+			r = handlers[req](whom, fsreq);
+  8014dd:	83 ec 08             	sub    $0x8,%esp
+  8014e0:	ff 35 44 50 80 00    	push   0x805044
+  8014e6:	ff 75 f4             	push   -0xc(%ebp)
+  8014e9:	ff d2                	call   *%edx
+  8014eb:	83 c4 10             	add    $0x10,%esp
+  8014ee:	eb 31                	jmp    801521 <serve+0xa3>
+			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+  8014f0:	53                   	push   %ebx
+  8014f1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8014f4:	50                   	push   %eax
+  8014f5:	ff 35 44 50 80 00    	push   0x805044
+  8014fb:	ff 75 f4             	push   -0xc(%ebp)
+  8014fe:	e8 50 fe ff ff       	call   801353 <serve_open>
+  801503:	83 c4 10             	add    $0x10,%esp
+  801506:	eb 19                	jmp    801521 <serve+0xa3>
+		} else {
+			cprintf("Invalid request code %d from %08x\n", req, whom);
+  801508:	83 ec 04             	sub    $0x4,%esp
+  80150b:	ff 75 f4             	push   -0xc(%ebp)
+  80150e:	50                   	push   %eax
+  80150f:	68 c4 43 80 00       	push   $0x8043c4
+  801514:	e8 1d 06 00 00       	call   801b36 <cprintf>
+  801519:	83 c4 10             	add    $0x10,%esp
+			r = -E_INVAL;
+  80151c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+		}
+		ipc_send(whom, r, pg, perm);
+  801521:	ff 75 f0             	push   -0x10(%ebp)
+  801524:	ff 75 ec             	push   -0x14(%ebp)
+  801527:	50                   	push   %eax
+  801528:	ff 75 f4             	push   -0xc(%ebp)
+  80152b:	e8 8f 15 00 00       	call   802abf <ipc_send>
+		sys_page_unmap(0, fsreq);
+  801530:	83 c4 08             	add    $0x8,%esp
+  801533:	ff 35 44 50 80 00    	push   0x805044
+  801539:	6a 00                	push   $0x0
+  80153b:	e8 19 11 00 00       	call   802659 <sys_page_unmap>
+  801540:	83 c4 10             	add    $0x10,%esp
+  801543:	e9 59 ff ff ff       	jmp    8014a1 <serve+0x23>
+
+00801548 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  801548:	55                   	push   %ebp
+  801549:	89 e5                	mov    %esp,%ebp
+  80154b:	83 ec 14             	sub    $0x14,%esp
+	int n, r;
+
+	static_assert(sizeof(struct File) == 256);
+	binaryname = "fs";
+  80154e:	c7 05 60 90 80 00 e7 	movl   $0x8043e7,0x809060
+  801555:	43 80 00 
+	cprintf("FS is running\n");
+  801558:	68 ea 43 80 00       	push   $0x8043ea
+  80155d:	e8 d4 05 00 00       	call   801b36 <cprintf>
+
+	// Clients block on us; don't let them wait behind batch jobs.
+	if ((r = sys_env_set_priority(0, ENV_PRIO_HIGHEST)) < 0)
+  801562:	83 c4 08             	add    $0x8,%esp
+  801565:	6a 00                	push   $0x0
+  801567:	6a 00                	push   $0x0
+  801569:	e8 39 12 00 00       	call   8027a7 <sys_env_set_priority>
+  80156e:	83 c4 10             	add    $0x10,%esp
+  801571:	85 c0                	test   %eax,%eax
+  801573:	78 4e                	js     8015c3 <umain+0x7b>
+		panic("sys_env_set_priority: %e", r);
+
+	if ((n = sys_ncpu()) >= FS_PIN_NCPU
+  801575:	e8 b1 12 00 00       	call   80282b <sys_ncpu>
+  80157a:	83 f8 03             	cmp    $0x3,%eax
+  80157d:	7e 1c                	jle    80159b <umain+0x53>
+	    && (r = sys_env_set_affinity(0, 1 << (n - 1))) < 0)
+  80157f:	83 ec 08             	sub    $0x8,%esp
+  801582:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  801585:	b8 01 00 00 00       	mov    $0x1,%eax
+  80158a:	d3 e0                	shl    %cl,%eax
+  80158c:	50                   	push   %eax
+  80158d:	6a 00                	push   $0x0
+  80158f:	e8 55 12 00 00       	call   8027e9 <sys_env_set_affinity>
+  801594:	83 c4 10             	add    $0x10,%esp
+  801597:	85 c0                	test   %eax,%eax
+  801599:	78 3d                	js     8015d8 <umain+0x90>
+	__asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  80159b:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  8015a0:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  8015a5:	66 ef                	out    %ax,(%dx)
+		panic("sys_env_set_affinity: %e", r);
+
+	// Check that we are able to do I/O
+	outw(0x8A00, 0x8A00);
+	cprintf("FS can do I/O\n");
+  8015a7:	83 ec 0c             	sub    $0xc,%esp
+  8015aa:	68 35 44 80 00       	push   $0x804435
+  8015af:	e8 82 05 00 00       	call   801b36 <cprintf>
+
+	serve_init();
+  8015b4:	e8 01 fb ff ff       	call   8010ba <serve_init>
+	fs_init();
+  8015b9:	e8 6f f3 ff ff       	call   80092d <fs_init>
+	serve();
+  8015be:	e8 bb fe ff ff       	call   80147e <serve>
+		panic("sys_env_set_priority: %e", r);
+  8015c3:	50                   	push   %eax
+  8015c4:	68 f9 43 80 00       	push   $0x8043f9
+  8015c9:	68 72 01 00 00       	push   $0x172
+  8015ce:	68 12 44 80 00       	push   $0x804412
+  8015d3:	e8 83 04 00 00       	call   801a5b <_panic>
+		panic("sys_env_set_affinity: %e", r);
+  8015d8:	50                   	push   %eax
+  8015d9:	68 1c 44 80 00       	push   $0x80441c
+  8015de:	68 76 01 00 00       	push   $0x176
+  8015e3:	68 12 44 80 00       	push   $0x804412
+  8015e8:	e8 6e 04 00 00       	call   801a5b <_panic>
+
+008015ed <fs_test>:
+
+static char *msg = "This is the NEW message of the day!\n\n";
+
+void
+fs_test(void)
+{
+  8015ed:	55                   	push   %ebp
+  8015ee:	89 e5                	mov    %esp,%ebp
+  8015f0:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	char *blk;
+	uint32_t *bits;
+
+	// back up bitmap
+	if ((r = sys_page_alloc(0, (void*) PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  8015f3:	6a 07                	push   $0x7
+  8015f5:	68 00 10 00 00       	push   $0x1000
+  8015fa:	6a 00                	push   $0x0
+  8015fc:	e8 90 0f 00 00       	call   802591 <sys_page_alloc>
+  801601:	83 c4 10             	add    $0x10,%esp
+  801604:	85 c0                	test   %eax,%eax
+  801606:	0f 88 52 02 00 00    	js     80185e <fs_test+0x271>
+		panic("sys_page_alloc: %e", r);
+	bits = (uint32_t*) PGSIZE;
+	memmove(bits, bitmap, PGSIZE);
+  80160c:	83 ec 04             	sub    $0x4,%esp
+  80160f:	68 00 10 00 00       	push   $0x1000
+  801614:	ff 35 08 a0 80 00    	push   0x80a008
+  80161a:	68 00 10 00 00       	push   $0x1000
+  80161f:	e8 86 0c 00 00       	call   8022aa <memmove>
+	// allocate block
+	if ((r = alloc_block()) < 0)
+  801624:	e8 3e f1 ff ff       	call   800767 <alloc_block>
+  801629:	89 c1                	mov    %eax,%ecx
+  80162b:	83 c4 10             	add    $0x10,%esp
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	0f 88 3a 02 00 00    	js     801870 <fs_test+0x283>
+		panic("alloc_block: %e", r);
+	// check that block was free
+	assert(bits[r/32] & (1 << (r%32)));
+  801636:	8d 40 1f             	lea    0x1f(%eax),%eax
+  801639:	0f 49 c1             	cmovns %ecx,%eax
+  80163c:	c1 f8 05             	sar    $0x5,%eax
+  80163f:	ba 01 00 00 00       	mov    $0x1,%edx
+  801644:	d3 e2                	shl    %cl,%edx
+  801646:	89 d1                	mov    %edx,%ecx
+  801648:	23 0c 85 00 10 00 00 	and    0x1000(,%eax,4),%ecx
+  80164f:	0f 84 2d 02 00 00    	je     801882 <fs_test+0x295>
+	// and is not free any more
+	assert(!(bitmap[r/32] & (1 << (r%32))));
+  801655:	8b 0d 08 a0 80 00    	mov    0x80a008,%ecx
+  80165b:	23 14 81             	and    (%ecx,%eax,4),%edx
+  80165e:	0f 85 34 02 00 00    	jne    801898 <fs_test+0x2ab>
+	cprintf("alloc_block is good\n");
+  801664:	83 ec 0c             	sub    $0xc,%esp
+  801667:	68 79 44 80 00       	push   $0x804479
+  80166c:	e8 c5 04 00 00       	call   801b36 <cprintf>
+
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  801671:	83 c4 08             	add    $0x8,%esp
+  801674:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801677:	50                   	push   %eax
+  801678:	68 8e 44 80 00       	push   $0x80448e
+  80167d:	e8 bc f5 ff ff       	call   800c3e <file_open>
+  801682:	83 c4 10             	add    $0x10,%esp
+  801685:	85 c0                	test   %eax,%eax
+  801687:	0f 88 21 02 00 00    	js     8018ae <fs_test+0x2c1>
+		panic("file_open /not-found: %e", r);
+	else if (r == 0)
+  80168d:	0f 84 36 02 00 00    	je     8018c9 <fs_test+0x2dc>
+		panic("file_open /not-found succeeded!");
+	if ((r = file_open("/newmotd", &f)) < 0)
+  801693:	83 ec 08             	sub    $0x8,%esp
+  801696:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801699:	50                   	push   %eax
+  80169a:	68 b2 44 80 00       	push   $0x8044b2
+  80169f:	e8 9a f5 ff ff       	call   800c3e <file_open>
+  8016a4:	83 c4 10             	add    $0x10,%esp
+  8016a7:	85 c0                	test   %eax,%eax
+  8016a9:	0f 88 2e 02 00 00    	js     8018dd <fs_test+0x2f0>
+		panic("file_open /newmotd: %e", r);
+	cprintf("file_open is good\n");
+  8016af:	83 ec 0c             	sub    $0xc,%esp
+  8016b2:	68 d2 44 80 00       	push   $0x8044d2
+  8016b7:	e8 7a 04 00 00       	call   801b36 <cprintf>
+
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  8016bc:	83 c4 0c             	add    $0xc,%esp
+  8016bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016c2:	50                   	push   %eax
+  8016c3:	6a 00                	push   $0x0
+  8016c5:	ff 75 f4             	push   -0xc(%ebp)
+  8016c8:	e8 bf f2 ff ff       	call   80098c <file_get_block>
+  8016cd:	83 c4 10             	add    $0x10,%esp
+  8016d0:	85 c0                	test   %eax,%eax
+  8016d2:	0f 88 17 02 00 00    	js     8018ef <fs_test+0x302>
+		panic("file_get_block: %e", r);
+	if (strcmp(blk, msg) != 0)
+  8016d8:	83 ec 08             	sub    $0x8,%esp
+  8016db:	68 18 46 80 00       	push   $0x804618
+  8016e0:	ff 75 f0             	push   -0x10(%ebp)
+  8016e3:	e8 ed 0a 00 00       	call   8021d5 <strcmp>
+  8016e8:	83 c4 10             	add    $0x10,%esp
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	0f 85 0e 02 00 00    	jne    801901 <fs_test+0x314>
+		panic("file_get_block returned wrong data");
+	cprintf("file_get_block is good\n");
+  8016f3:	83 ec 0c             	sub    $0xc,%esp
+  8016f6:	68 f8 44 80 00       	push   $0x8044f8
+  8016fb:	e8 36 04 00 00       	call   801b36 <cprintf>
+
+	*(volatile char*)blk = *(volatile char*)blk;
+  801700:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801703:	0f b6 10             	movzbl (%eax),%edx
+  801706:	88 10                	mov    %dl,(%eax)
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  801708:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80170b:	c1 e8 0c             	shr    $0xc,%eax
+  80170e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801715:	83 c4 10             	add    $0x10,%esp
+  801718:	a8 40                	test   $0x40,%al
+  80171a:	0f 84 f5 01 00 00    	je     801915 <fs_test+0x328>
+	file_flush(f);
+  801720:	83 ec 0c             	sub    $0xc,%esp
+  801723:	ff 75 f4             	push   -0xc(%ebp)
+  801726:	e8 6e f7 ff ff       	call   800e99 <file_flush>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  80172b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80172e:	c1 e8 0c             	shr    $0xc,%eax
+  801731:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801738:	83 c4 10             	add    $0x10,%esp
+  80173b:	a8 40                	test   $0x40,%al
+  80173d:	0f 85 e8 01 00 00    	jne    80192b <fs_test+0x33e>
+	cprintf("file_flush is good\n");
+  801743:	83 ec 0c             	sub    $0xc,%esp
+  801746:	68 2c 45 80 00       	push   $0x80452c
+  80174b:	e8 e6 03 00 00       	call   801b36 <cprintf>
+
+	if ((r = file_set_size(f, 0)) < 0)
+  801750:	83 c4 08             	add    $0x8,%esp
+  801753:	6a 00                	push   $0x0
+  801755:	ff 75 f4             	push   -0xc(%ebp)
+  801758:	e8 ac f5 ff ff       	call   800d09 <file_set_size>
+  80175d:	83 c4 10             	add    $0x10,%esp
+  801760:	85 c0                	test   %eax,%eax
+  801762:	0f 88 d9 01 00 00    	js     801941 <fs_test+0x354>
+		panic("file_set_size: %e", r);
+	assert(f->f_direct[0] == 0);
+  801768:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80176b:	83 b8 88 00 00 00 00 	cmpl   $0x0,0x88(%eax)
+  801772:	0f 85 db 01 00 00    	jne    801953 <fs_test+0x366>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801778:	c1 e8 0c             	shr    $0xc,%eax
+  80177b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801782:	a8 40                	test   $0x40,%al
+  801784:	0f 85 df 01 00 00    	jne    801969 <fs_test+0x37c>
+	cprintf("file_truncate is good\n");
+  80178a:	83 ec 0c             	sub    $0xc,%esp
+  80178d:	68 80 45 80 00       	push   $0x804580
+  801792:	e8 9f 03 00 00       	call   801b36 <cprintf>
+
+	if ((r = file_set_size(f, strlen(msg))) < 0)
+  801797:	c7 04 24 18 46 80 00 	movl   $0x804618,(%esp)
+  80179e:	e8 46 09 00 00       	call   8020e9 <strlen>
+  8017a3:	83 c4 08             	add    $0x8,%esp
+  8017a6:	50                   	push   %eax
+  8017a7:	ff 75 f4             	push   -0xc(%ebp)
+  8017aa:	e8 5a f5 ff ff       	call   800d09 <file_set_size>
+  8017af:	83 c4 10             	add    $0x10,%esp
+  8017b2:	85 c0                	test   %eax,%eax
+  8017b4:	0f 88 c5 01 00 00    	js     80197f <fs_test+0x392>
+		panic("file_set_size 2: %e", r);
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  8017ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017bd:	89 c2                	mov    %eax,%edx
+  8017bf:	c1 ea 0c             	shr    $0xc,%edx
+  8017c2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8017c9:	f6 c2 40             	test   $0x40,%dl
+  8017cc:	0f 85 bf 01 00 00    	jne    801991 <fs_test+0x3a4>
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  8017d2:	83 ec 04             	sub    $0x4,%esp
+  8017d5:	8d 55 f0             	lea    -0x10(%ebp),%edx
+  8017d8:	52                   	push   %edx
+  8017d9:	6a 00                	push   $0x0
+  8017db:	50                   	push   %eax
+  8017dc:	e8 ab f1 ff ff       	call   80098c <file_get_block>
+  8017e1:	83 c4 10             	add    $0x10,%esp
+  8017e4:	85 c0                	test   %eax,%eax
+  8017e6:	0f 88 bb 01 00 00    	js     8019a7 <fs_test+0x3ba>
+		panic("file_get_block 2: %e", r);
+	strcpy(blk, msg);
+  8017ec:	83 ec 08             	sub    $0x8,%esp
+  8017ef:	68 18 46 80 00       	push   $0x804618
+  8017f4:	ff 75 f0             	push   -0x10(%ebp)
+  8017f7:	e8 28 09 00 00       	call   802124 <strcpy>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  8017fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8017ff:	c1 e8 0c             	shr    $0xc,%eax
+  801802:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801809:	83 c4 10             	add    $0x10,%esp
+  80180c:	a8 40                	test   $0x40,%al
+  80180e:	0f 84 a5 01 00 00    	je     8019b9 <fs_test+0x3cc>
+	file_flush(f);
+  801814:	83 ec 0c             	sub    $0xc,%esp
+  801817:	ff 75 f4             	push   -0xc(%ebp)
+  80181a:	e8 7a f6 ff ff       	call   800e99 <file_flush>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  80181f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801822:	c1 e8 0c             	shr    $0xc,%eax
+  801825:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80182c:	83 c4 10             	add    $0x10,%esp
+  80182f:	a8 40                	test   $0x40,%al
+  801831:	0f 85 98 01 00 00    	jne    8019cf <fs_test+0x3e2>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801837:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80183a:	c1 e8 0c             	shr    $0xc,%eax
+  80183d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801844:	a8 40                	test   $0x40,%al
+  801846:	0f 85 99 01 00 00    	jne    8019e5 <fs_test+0x3f8>
+	cprintf("file rewrite is good\n");
+  80184c:	83 ec 0c             	sub    $0xc,%esp
+  80184f:	68 c0 45 80 00       	push   $0x8045c0
+  801854:	e8 dd 02 00 00       	call   801b36 <cprintf>
+}
+  801859:	83 c4 10             	add    $0x10,%esp
+  80185c:	c9                   	leave
+  80185d:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  80185e:	50                   	push   %eax
+  80185f:	68 d8 41 80 00       	push   $0x8041d8
+  801864:	6a 12                	push   $0x12
+  801866:	68 44 44 80 00       	push   $0x804444
+  80186b:	e8 eb 01 00 00       	call   801a5b <_panic>
+		panic("alloc_block: %e", r);
+  801870:	50                   	push   %eax
+  801871:	68 4e 44 80 00       	push   $0x80444e
+  801876:	6a 17                	push   $0x17
+  801878:	68 44 44 80 00       	push   $0x804444
+  80187d:	e8 d9 01 00 00       	call   801a5b <_panic>
+	assert(bits[r/32] & (1 << (r%32)));
+  801882:	68 5e 44 80 00       	push   $0x80445e
+  801887:	68 fd 40 80 00       	push   $0x8040fd
+  80188c:	6a 19                	push   $0x19
+  80188e:	68 44 44 80 00       	push   $0x804444
+  801893:	e8 c3 01 00 00       	call   801a5b <_panic>
+	assert(!(bitmap[r/32] & (1 << (r%32))));
+  801898:	68 d8 45 80 00       	push   $0x8045d8
+  80189d:	68 fd 40 80 00       	push   $0x8040fd
+  8018a2:	6a 1b                	push   $0x1b
+  8018a4:	68 44 44 80 00       	push   $0x804444
+  8018a9:	e8 ad 01 00 00       	call   801a5b <_panic>
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  8018ae:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8018b1:	0f 84 dc fd ff ff    	je     801693 <fs_test+0xa6>
+		panic("file_open /not-found: %e", r);
+  8018b7:	50                   	push   %eax
+  8018b8:	68 99 44 80 00       	push   $0x804499
+  8018bd:	6a 1f                	push   $0x1f
+  8018bf:	68 44 44 80 00       	push   $0x804444
+  8018c4:	e8 92 01 00 00       	call   801a5b <_panic>
+		panic("file_open /not-found succeeded!");
+  8018c9:	83 ec 04             	sub    $0x4,%esp
+  8018cc:	68 f8 45 80 00       	push   $0x8045f8
+  8018d1:	6a 21                	push   $0x21
+  8018d3:	68 44 44 80 00       	push   $0x804444
+  8018d8:	e8 7e 01 00 00       	call   801a5b <_panic>
+		panic("file_open /newmotd: %e", r);
+  8018dd:	50                   	push   %eax
+  8018de:	68 bb 44 80 00       	push   $0x8044bb
+  8018e3:	6a 23                	push   $0x23
+  8018e5:	68 44 44 80 00       	push   $0x804444
+  8018ea:	e8 6c 01 00 00       	call   801a5b <_panic>
+		panic("file_get_block: %e", r);
+  8018ef:	50                   	push   %eax
+  8018f0:	68 e5 44 80 00       	push   $0x8044e5
+  8018f5:	6a 27                	push   $0x27
+  8018f7:	68 44 44 80 00       	push   $0x804444
+  8018fc:	e8 5a 01 00 00       	call   801a5b <_panic>
+		panic("file_get_block returned wrong data");
+  801901:	83 ec 04             	sub    $0x4,%esp
+  801904:	68 40 46 80 00       	push   $0x804640
+  801909:	6a 29                	push   $0x29
+  80190b:	68 44 44 80 00       	push   $0x804444
+  801910:	e8 46 01 00 00       	call   801a5b <_panic>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  801915:	68 11 45 80 00       	push   $0x804511
+  80191a:	68 fd 40 80 00       	push   $0x8040fd
+  80191f:	6a 2d                	push   $0x2d
+  801921:	68 44 44 80 00       	push   $0x804444
+  801926:	e8 30 01 00 00       	call   801a5b <_panic>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  80192b:	68 10 45 80 00       	push   $0x804510
+  801930:	68 fd 40 80 00       	push   $0x8040fd
+  801935:	6a 2f                	push   $0x2f
+  801937:	68 44 44 80 00       	push   $0x804444
+  80193c:	e8 1a 01 00 00       	call   801a5b <_panic>
+		panic("file_set_size: %e", r);
+  801941:	50                   	push   %eax
+  801942:	68 40 45 80 00       	push   $0x804540
+  801947:	6a 33                	push   $0x33
+  801949:	68 44 44 80 00       	push   $0x804444
+  80194e:	e8 08 01 00 00       	call   801a5b <_panic>
+	assert(f->f_direct[0] == 0);
+  801953:	68 52 45 80 00       	push   $0x804552
+  801958:	68 fd 40 80 00       	push   $0x8040fd
+  80195d:	6a 34                	push   $0x34
+  80195f:	68 44 44 80 00       	push   $0x804444
+  801964:	e8 f2 00 00 00       	call   801a5b <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801969:	68 66 45 80 00       	push   $0x804566
+  80196e:	68 fd 40 80 00       	push   $0x8040fd
+  801973:	6a 35                	push   $0x35
+  801975:	68 44 44 80 00       	push   $0x804444
+  80197a:	e8 dc 00 00 00       	call   801a5b <_panic>
+		panic("file_set_size 2: %e", r);
+  80197f:	50                   	push   %eax
+  801980:	68 97 45 80 00       	push   $0x804597
+  801985:	6a 39                	push   $0x39
+  801987:	68 44 44 80 00       	push   $0x804444
+  80198c:	e8 ca 00 00 00       	call   801a5b <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801991:	68 66 45 80 00       	push   $0x804566
+  801996:	68 fd 40 80 00       	push   $0x8040fd
+  80199b:	6a 3a                	push   $0x3a
+  80199d:	68 44 44 80 00       	push   $0x804444
+  8019a2:	e8 b4 00 00 00       	call   801a5b <_panic>
+		panic("file_get_block 2: %e", r);
+  8019a7:	50                   	push   %eax
+  8019a8:	68 ab 45 80 00       	push   $0x8045ab
+  8019ad:	6a 3c                	push   $0x3c
+  8019af:	68 44 44 80 00       	push   $0x804444
+  8019b4:	e8 a2 00 00 00       	call   801a5b <_panic>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  8019b9:	68 11 45 80 00       	push   $0x804511
+  8019be:	68 fd 40 80 00       	push   $0x8040fd
+  8019c3:	6a 3e                	push   $0x3e
+  8019c5:	68 44 44 80 00       	push   $0x804444
+  8019ca:	e8 8c 00 00 00       	call   801a5b <_panic>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  8019cf:	68 10 45 80 00       	push   $0x804510
+  8019d4:	68 fd 40 80 00       	push   $0x8040fd
+  8019d9:	6a 40                	push   $0x40
+  8019db:	68 44 44 80 00       	push   $0x804444
+  8019e0:	e8 76 00 00 00       	call   801a5b <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  8019e5:	68 66 45 80 00       	push   $0x804566
+  8019ea:	68 fd 40 80 00       	push   $0x8040fd
+  8019ef:	6a 41                	push   $0x41
+  8019f1:	68 44 44 80 00       	push   $0x804444
+  8019f6:	e8 60 00 00 00       	call   801a5b <_panic>
+
+008019fb <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8019fb:	55                   	push   %ebp
+  8019fc:	89 e5                	mov    %esp,%ebp
+  8019fe:	56                   	push   %esi
+  8019ff:	53                   	push   %ebx
+  801a00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a03:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  801a06:	e8 e7 0a 00 00       	call   8024f2 <sys_getenvid>
+  801a0b:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801a10:	c1 e0 09             	shl    $0x9,%eax
+  801a13:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a18:	a3 10 a0 80 00       	mov    %eax,0x80a010
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  801a1d:	85 db                	test   %ebx,%ebx
+  801a1f:	7e 07                	jle    801a28 <libmain+0x2d>
+		binaryname = argv[0];
+  801a21:	8b 06                	mov    (%esi),%eax
+  801a23:	a3 60 90 80 00       	mov    %eax,0x809060
+
+	// call user main routine
+	umain(argc, argv);
+  801a28:	83 ec 08             	sub    $0x8,%esp
+  801a2b:	56                   	push   %esi
+  801a2c:	53                   	push   %ebx
+  801a2d:	e8 16 fb ff ff       	call   801548 <umain>
+
+	// exit gracefully
+	exit();
+  801a32:	e8 0a 00 00 00       	call   801a41 <exit>
+}
+  801a37:	83 c4 10             	add    $0x10,%esp
+  801a3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a3d:	5b                   	pop    %ebx
+  801a3e:	5e                   	pop    %esi
+  801a3f:	5d                   	pop    %ebp
+  801a40:	c3                   	ret
+
+00801a41 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  801a41:	55                   	push   %ebp
+  801a42:	89 e5                	mov    %esp,%ebp
+  801a44:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  801a47:	e8 ab 12 00 00       	call   802cf7 <close_all>
+	sys_env_destroy(0);
+  801a4c:	83 ec 0c             	sub    $0xc,%esp
+  801a4f:	6a 00                	push   $0x0
+  801a51:	e8 5b 0a 00 00       	call   8024b1 <sys_env_destroy>
+}
+  801a56:	83 c4 10             	add    $0x10,%esp
+  801a59:	c9                   	leave
+  801a5a:	c3                   	ret
+
+00801a5b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801a5b:	55                   	push   %ebp
+  801a5c:	89 e5                	mov    %esp,%ebp
+  801a5e:	56                   	push   %esi
+  801a5f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801a60:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801a63:	8b 35 60 90 80 00    	mov    0x809060,%esi
+  801a69:	e8 84 0a 00 00       	call   8024f2 <sys_getenvid>
+  801a6e:	83 ec 0c             	sub    $0xc,%esp
+  801a71:	ff 75 0c             	push   0xc(%ebp)
+  801a74:	ff 75 08             	push   0x8(%ebp)
+  801a77:	56                   	push   %esi
+  801a78:	50                   	push   %eax
+  801a79:	68 70 46 80 00       	push   $0x804670
+  801a7e:	e8 b3 00 00 00       	call   801b36 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801a83:	83 c4 18             	add    $0x18,%esp
+  801a86:	53                   	push   %ebx
+  801a87:	ff 75 10             	push   0x10(%ebp)
+  801a8a:	e8 56 00 00 00       	call   801ae5 <vcprintf>
+	cprintf("\n");
+  801a8f:	c7 04 24 56 42 80 00 	movl   $0x804256,(%esp)
+  801a96:	e8 9b 00 00 00       	call   801b36 <cprintf>
+  801a9b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801a9e:	cc                   	int3
+	while (1)
+  801a9f:	eb fd                	jmp    801a9e <_panic+0x43>
+
+00801aa1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801aa1:	55                   	push   %ebp
+  801aa2:	89 e5                	mov    %esp,%ebp
+  801aa4:	53                   	push   %ebx
+  801aa5:	83 ec 04             	sub    $0x4,%esp
+  801aa8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801aab:	8b 13                	mov    (%ebx),%edx
+  801aad:	8d 42 01             	lea    0x1(%edx),%eax
+  801ab0:	89 03                	mov    %eax,(%ebx)
+  801ab2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ab5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801ab9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801abe:	74 09                	je     801ac9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801ac0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801ac4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac7:	c9                   	leave
+  801ac8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801ac9:	83 ec 08             	sub    $0x8,%esp
+  801acc:	68 ff 00 00 00       	push   $0xff
+  801ad1:	8d 43 08             	lea    0x8(%ebx),%eax
+  801ad4:	50                   	push   %eax
+  801ad5:	e8 7a 09 00 00       	call   802454 <sys_cputs>
+		b->idx = 0;
+  801ada:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801ae0:	83 c4 10             	add    $0x10,%esp
+  801ae3:	eb db                	jmp    801ac0 <putch+0x1f>
+
+00801ae5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801ae5:	55                   	push   %ebp
+  801ae6:	89 e5                	mov    %esp,%ebp
+  801ae8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  801aee:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801af5:	00 00 00 
+	b.cnt = 0;
+  801af8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  801aff:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  801b02:	ff 75 0c             	push   0xc(%ebp)
+  801b05:	ff 75 08             	push   0x8(%ebp)
+  801b08:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  801b0e:	50                   	push   %eax
+  801b0f:	68 a1 1a 80 00       	push   $0x801aa1
+  801b14:	e8 14 01 00 00       	call   801c2d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801b19:	83 c4 08             	add    $0x8,%esp
+  801b1c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801b22:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801b28:	50                   	push   %eax
+  801b29:	e8 26 09 00 00       	call   802454 <sys_cputs>
+
+	return b.cnt;
+}
+  801b2e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801b34:	c9                   	leave
+  801b35:	c3                   	ret
+
+00801b36 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801b36:	55                   	push   %ebp
+  801b37:	89 e5                	mov    %esp,%ebp
+  801b39:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801b3c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801b3f:	50                   	push   %eax
+  801b40:	ff 75 08             	push   0x8(%ebp)
+  801b43:	e8 9d ff ff ff       	call   801ae5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801b48:	c9                   	leave
+  801b49:	c3                   	ret
+
+00801b4a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801b4a:	55                   	push   %ebp
+  801b4b:	89 e5                	mov    %esp,%ebp
+  801b4d:	57                   	push   %edi
+  801b4e:	56                   	push   %esi
+  801b4f:	53                   	push   %ebx
+  801b50:	83 ec 1c             	sub    $0x1c,%esp
+  801b53:	89 c7                	mov    %eax,%edi
+  801b55:	89 d6                	mov    %edx,%esi
+  801b57:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b5d:	89 d1                	mov    %edx,%ecx
+  801b5f:	89 c2                	mov    %eax,%edx
+  801b61:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b64:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801b67:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b6a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801b6d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801b70:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801b77:	39 c2                	cmp    %eax,%edx
+  801b79:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801b7c:	72 3e                	jb     801bbc <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801b7e:	83 ec 0c             	sub    $0xc,%esp
+  801b81:	ff 75 18             	push   0x18(%ebp)
+  801b84:	83 eb 01             	sub    $0x1,%ebx
+  801b87:	53                   	push   %ebx
+  801b88:	50                   	push   %eax
+  801b89:	83 ec 08             	sub    $0x8,%esp
+  801b8c:	ff 75 e4             	push   -0x1c(%ebp)
+  801b8f:	ff 75 e0             	push   -0x20(%ebp)
+  801b92:	ff 75 dc             	push   -0x24(%ebp)
+  801b95:	ff 75 d8             	push   -0x28(%ebp)
+  801b98:	e8 b3 21 00 00       	call   803d50 <__udivdi3>
+  801b9d:	83 c4 18             	add    $0x18,%esp
+  801ba0:	52                   	push   %edx
+  801ba1:	50                   	push   %eax
+  801ba2:	89 f2                	mov    %esi,%edx
+  801ba4:	89 f8                	mov    %edi,%eax
+  801ba6:	e8 9f ff ff ff       	call   801b4a <printnum>
+  801bab:	83 c4 20             	add    $0x20,%esp
+  801bae:	eb 13                	jmp    801bc3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801bb0:	83 ec 08             	sub    $0x8,%esp
+  801bb3:	56                   	push   %esi
+  801bb4:	ff 75 18             	push   0x18(%ebp)
+  801bb7:	ff d7                	call   *%edi
+  801bb9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801bbc:	83 eb 01             	sub    $0x1,%ebx
+  801bbf:	85 db                	test   %ebx,%ebx
+  801bc1:	7f ed                	jg     801bb0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801bc3:	83 ec 08             	sub    $0x8,%esp
+  801bc6:	56                   	push   %esi
+  801bc7:	83 ec 04             	sub    $0x4,%esp
+  801bca:	ff 75 e4             	push   -0x1c(%ebp)
+  801bcd:	ff 75 e0             	push   -0x20(%ebp)
+  801bd0:	ff 75 dc             	push   -0x24(%ebp)
+  801bd3:	ff 75 d8             	push   -0x28(%ebp)
+  801bd6:	e8 35 22 00 00       	call   803e10 <__umoddi3>
+  801bdb:	83 c4 14             	add    $0x14,%esp
+  801bde:	0f be 80 93 46 80 00 	movsbl 0x804693(%eax),%eax
+  801be5:	50                   	push   %eax
+  801be6:	ff d7                	call   *%edi
+}
+  801be8:	83 c4 10             	add    $0x10,%esp
+  801beb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bee:	5b                   	pop    %ebx
+  801bef:	5e                   	pop    %esi
+  801bf0:	5f                   	pop    %edi
+  801bf1:	5d                   	pop    %ebp
+  801bf2:	c3                   	ret
+
+00801bf3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801bf3:	55                   	push   %ebp
+  801bf4:	89 e5                	mov    %esp,%ebp
+  801bf6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801bf9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801bfd:	8b 10                	mov    (%eax),%edx
+  801bff:	3b 50 04             	cmp    0x4(%eax),%edx
+  801c02:	73 0a                	jae    801c0e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801c04:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801c07:	89 08                	mov    %ecx,(%eax)
+  801c09:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c0c:	88 02                	mov    %al,(%edx)
+}
+  801c0e:	5d                   	pop    %ebp
+  801c0f:	c3                   	ret
+
+00801c10 <printfmt>:
+{
+  801c10:	55                   	push   %ebp
+  801c11:	89 e5                	mov    %esp,%ebp
+  801c13:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801c16:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801c19:	50                   	push   %eax
+  801c1a:	ff 75 10             	push   0x10(%ebp)
+  801c1d:	ff 75 0c             	push   0xc(%ebp)
+  801c20:	ff 75 08             	push   0x8(%ebp)
+  801c23:	e8 05 00 00 00       	call   801c2d <vprintfmt>
+}
+  801c28:	83 c4 10             	add    $0x10,%esp
+  801c2b:	c9                   	leave
+  801c2c:	c3                   	ret
+
+00801c2d <vprintfmt>:
+{
+  801c2d:	55                   	push   %ebp
+  801c2e:	89 e5                	mov    %esp,%ebp
+  801c30:	57                   	push   %edi
+  801c31:	56                   	push   %esi
+  801c32:	53                   	push   %ebx
+  801c33:	83 ec 2c             	sub    $0x2c,%esp
+  801c36:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c3c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801c3f:	eb 0a                	jmp    801c4b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801c41:	83 ec 08             	sub    $0x8,%esp
+  801c44:	53                   	push   %ebx
+  801c45:	50                   	push   %eax
+  801c46:	ff d6                	call   *%esi
+  801c48:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801c4b:	83 c7 01             	add    $0x1,%edi
+  801c4e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801c52:	83 f8 25             	cmp    $0x25,%eax
+  801c55:	74 0c                	je     801c63 <vprintfmt+0x36>
+			if (ch == '\0')
+  801c57:	85 c0                	test   %eax,%eax
+  801c59:	75 e6                	jne    801c41 <vprintfmt+0x14>
+}
+  801c5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c5e:	5b                   	pop    %ebx
+  801c5f:	5e                   	pop    %esi
+  801c60:	5f                   	pop    %edi
+  801c61:	5d                   	pop    %ebp
+  801c62:	c3                   	ret
+		padc = ' ';
+  801c63:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801c67:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801c6e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801c75:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801c7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801c81:	8d 47 01             	lea    0x1(%edi),%eax
+  801c84:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c87:	0f b6 17             	movzbl (%edi),%edx
+  801c8a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801c8d:	3c 55                	cmp    $0x55,%al
+  801c8f:	0f 87 cf 03 00 00    	ja     802064 <vprintfmt+0x437>
+  801c95:	0f b6 c0             	movzbl %al,%eax
+  801c98:	ff 24 85 e0 47 80 00 	jmp    *0x8047e0(,%eax,4)
+  801c9f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801ca2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801ca6:	eb d9                	jmp    801c81 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801ca8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801cab:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801caf:	eb d0                	jmp    801c81 <vprintfmt+0x54>
+  801cb1:	0f b6 d2             	movzbl %dl,%edx
+  801cb4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801cbf:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801cc2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801cc6:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801cc9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801ccc:	83 f9 09             	cmp    $0x9,%ecx
+  801ccf:	77 55                	ja     801d26 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801cd1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801cd4:	eb e9                	jmp    801cbf <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801cd6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cd9:	8b 00                	mov    (%eax),%eax
+  801cdb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801cde:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ce1:	8d 40 04             	lea    0x4(%eax),%eax
+  801ce4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801ce7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801cea:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801cee:	79 91                	jns    801c81 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801cf0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801cf3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801cf6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801cfd:	eb 82                	jmp    801c81 <vprintfmt+0x54>
+			if (width < 0)
+  801cff:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801d02:	85 d2                	test   %edx,%edx
+  801d04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d09:	0f 49 c2             	cmovns %edx,%eax
+  801d0c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801d0f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801d12:	e9 6a ff ff ff       	jmp    801c81 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801d17:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801d1a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801d21:	e9 5b ff ff ff       	jmp    801c81 <vprintfmt+0x54>
+  801d26:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d29:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801d2c:	eb bc                	jmp    801cea <vprintfmt+0xbd>
+			lflag++;
+  801d2e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801d31:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801d34:	e9 48 ff ff ff       	jmp    801c81 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801d39:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d3c:	8d 78 04             	lea    0x4(%eax),%edi
+  801d3f:	83 ec 08             	sub    $0x8,%esp
+  801d42:	53                   	push   %ebx
+  801d43:	ff 30                	push   (%eax)
+  801d45:	ff d6                	call   *%esi
+			break;
+  801d47:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801d4a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801d4d:	e9 b1 02 00 00       	jmp    802003 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801d52:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d55:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801d58:	8b 10                	mov    (%eax),%edx
+  801d5a:	89 d0                	mov    %edx,%eax
+  801d5c:	f7 d8                	neg    %eax
+  801d5e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801d61:	83 f8 0f             	cmp    $0xf,%eax
+  801d64:	7f 23                	jg     801d89 <vprintfmt+0x15c>
+  801d66:	8b 14 85 40 49 80 00 	mov    0x804940(,%eax,4),%edx
+  801d6d:	85 d2                	test   %edx,%edx
+  801d6f:	74 18                	je     801d89 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801d71:	52                   	push   %edx
+  801d72:	68 0f 41 80 00       	push   $0x80410f
+  801d77:	53                   	push   %ebx
+  801d78:	56                   	push   %esi
+  801d79:	e8 92 fe ff ff       	call   801c10 <printfmt>
+  801d7e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801d81:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801d84:	e9 7a 02 00 00       	jmp    802003 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801d89:	50                   	push   %eax
+  801d8a:	68 ab 46 80 00       	push   $0x8046ab
+  801d8f:	53                   	push   %ebx
+  801d90:	56                   	push   %esi
+  801d91:	e8 7a fe ff ff       	call   801c10 <printfmt>
+  801d96:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801d99:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801d9c:	e9 62 02 00 00       	jmp    802003 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801da1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801da4:	83 c0 04             	add    $0x4,%eax
+  801da7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801daa:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dad:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801daf:	85 c9                	test   %ecx,%ecx
+  801db1:	b8 a4 46 80 00       	mov    $0x8046a4,%eax
+  801db6:	0f 45 c1             	cmovne %ecx,%eax
+  801db9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801dbc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801dc0:	7e 06                	jle    801dc8 <vprintfmt+0x19b>
+  801dc2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801dc6:	75 0b                	jne    801dd3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801dc8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801dcb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801dce:	89 75 08             	mov    %esi,0x8(%ebp)
+  801dd1:	eb 5c                	jmp    801e2f <vprintfmt+0x202>
+  801dd3:	83 ec 08             	sub    $0x8,%esp
+  801dd6:	ff 75 d0             	push   -0x30(%ebp)
+  801dd9:	ff 75 cc             	push   -0x34(%ebp)
+  801ddc:	e8 20 03 00 00       	call   802101 <strnlen>
+  801de1:	89 c2                	mov    %eax,%edx
+  801de3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801de6:	29 d0                	sub    %edx,%eax
+  801de8:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801deb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801def:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801df2:	89 75 08             	mov    %esi,0x8(%ebp)
+  801df5:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801df7:	eb 0e                	jmp    801e07 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801df9:	83 ec 08             	sub    $0x8,%esp
+  801dfc:	53                   	push   %ebx
+  801dfd:	57                   	push   %edi
+  801dfe:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801e01:	83 ee 01             	sub    $0x1,%esi
+  801e04:	83 c4 10             	add    $0x10,%esp
+  801e07:	85 f6                	test   %esi,%esi
+  801e09:	7f ee                	jg     801df9 <vprintfmt+0x1cc>
+  801e0b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e0e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e18:	0f 49 d0             	cmovns %eax,%edx
+  801e1b:	29 d0                	sub    %edx,%eax
+  801e1d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e20:	eb a6                	jmp    801dc8 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801e22:	83 ec 08             	sub    $0x8,%esp
+  801e25:	53                   	push   %ebx
+  801e26:	52                   	push   %edx
+  801e27:	ff 55 08             	call   *0x8(%ebp)
+  801e2a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801e2d:	89 f1                	mov    %esi,%ecx
+  801e2f:	8d 71 01             	lea    0x1(%ecx),%esi
+  801e32:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801e36:	0f be d0             	movsbl %al,%edx
+  801e39:	85 d2                	test   %edx,%edx
+  801e3b:	74 28                	je     801e65 <vprintfmt+0x238>
+  801e3d:	85 ff                	test   %edi,%edi
+  801e3f:	78 05                	js     801e46 <vprintfmt+0x219>
+  801e41:	83 ef 01             	sub    $0x1,%edi
+  801e44:	78 30                	js     801e76 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801e46:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801e4a:	74 d6                	je     801e22 <vprintfmt+0x1f5>
+  801e4c:	0f be c0             	movsbl %al,%eax
+  801e4f:	83 e8 20             	sub    $0x20,%eax
+  801e52:	83 f8 5e             	cmp    $0x5e,%eax
+  801e55:	76 cb                	jbe    801e22 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801e57:	83 ec 08             	sub    $0x8,%esp
+  801e5a:	53                   	push   %ebx
+  801e5b:	6a 3f                	push   $0x3f
+  801e5d:	ff 55 08             	call   *0x8(%ebp)
+  801e60:	83 c4 10             	add    $0x10,%esp
+  801e63:	eb c8                	jmp    801e2d <vprintfmt+0x200>
+  801e65:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e68:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801e6b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e6e:	01 d0                	add    %edx,%eax
+  801e70:	29 c8                	sub    %ecx,%eax
+  801e72:	89 c7                	mov    %eax,%edi
+  801e74:	eb 13                	jmp    801e89 <vprintfmt+0x25c>
+  801e76:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e79:	eb ed                	jmp    801e68 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801e7b:	83 ec 08             	sub    $0x8,%esp
+  801e7e:	53                   	push   %ebx
+  801e7f:	6a 20                	push   $0x20
+  801e81:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801e83:	83 ef 01             	sub    $0x1,%edi
+  801e86:	83 c4 10             	add    $0x10,%esp
+  801e89:	85 ff                	test   %edi,%edi
+  801e8b:	7f ee                	jg     801e7b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801e8d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801e90:	89 45 14             	mov    %eax,0x14(%ebp)
+  801e93:	e9 6b 01 00 00       	jmp    802003 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801e98:	83 f9 01             	cmp    $0x1,%ecx
+  801e9b:	7f 1f                	jg     801ebc <vprintfmt+0x28f>
+	else if (lflag)
+  801e9d:	85 c9                	test   %ecx,%ecx
+  801e9f:	74 67                	je     801f08 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801ea1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ea4:	8b 00                	mov    (%eax),%eax
+  801ea6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801ea9:	89 c1                	mov    %eax,%ecx
+  801eab:	c1 f9 1f             	sar    $0x1f,%ecx
+  801eae:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801eb1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801eb4:	8d 40 04             	lea    0x4(%eax),%eax
+  801eb7:	89 45 14             	mov    %eax,0x14(%ebp)
+  801eba:	eb 17                	jmp    801ed3 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801ebc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ebf:	8b 50 04             	mov    0x4(%eax),%edx
+  801ec2:	8b 00                	mov    (%eax),%eax
+  801ec4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801ec7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801eca:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ecd:	8d 40 08             	lea    0x8(%eax),%eax
+  801ed0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801ed3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801ed6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801ed9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801ede:	85 c9                	test   %ecx,%ecx
+  801ee0:	0f 89 03 01 00 00    	jns    801fe9 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  801ee6:	83 ec 08             	sub    $0x8,%esp
+  801ee9:	53                   	push   %ebx
+  801eea:	6a 2d                	push   $0x2d
+  801eec:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801eee:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801ef1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801ef4:	f7 da                	neg    %edx
+  801ef6:	83 d1 00             	adc    $0x0,%ecx
+  801ef9:	f7 d9                	neg    %ecx
+  801efb:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801efe:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f03:	e9 e1 00 00 00       	jmp    801fe9 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  801f08:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f0b:	8b 00                	mov    (%eax),%eax
+  801f0d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801f10:	89 c1                	mov    %eax,%ecx
+  801f12:	c1 f9 1f             	sar    $0x1f,%ecx
+  801f15:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801f18:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f1b:	8d 40 04             	lea    0x4(%eax),%eax
+  801f1e:	89 45 14             	mov    %eax,0x14(%ebp)
+  801f21:	eb b0                	jmp    801ed3 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801f23:	83 f9 01             	cmp    $0x1,%ecx
+  801f26:	7f 1e                	jg     801f46 <vprintfmt+0x319>
+	else if (lflag)
+  801f28:	85 c9                	test   %ecx,%ecx
+  801f2a:	74 32                	je     801f5e <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  801f2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f2f:	8b 10                	mov    (%eax),%edx
+  801f31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f36:	8d 40 04             	lea    0x4(%eax),%eax
+  801f39:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801f3c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801f41:	e9 a3 00 00 00       	jmp    801fe9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801f46:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f49:	8b 10                	mov    (%eax),%edx
+  801f4b:	8b 48 04             	mov    0x4(%eax),%ecx
+  801f4e:	8d 40 08             	lea    0x8(%eax),%eax
+  801f51:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801f54:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801f59:	e9 8b 00 00 00       	jmp    801fe9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801f5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f61:	8b 10                	mov    (%eax),%edx
+  801f63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f68:	8d 40 04             	lea    0x4(%eax),%eax
+  801f6b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801f6e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801f73:	eb 74                	jmp    801fe9 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  801f75:	83 f9 01             	cmp    $0x1,%ecx
+  801f78:	7f 1b                	jg     801f95 <vprintfmt+0x368>
+	else if (lflag)
+  801f7a:	85 c9                	test   %ecx,%ecx
+  801f7c:	74 2c                	je     801faa <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  801f7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f81:	8b 10                	mov    (%eax),%edx
+  801f83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f88:	8d 40 04             	lea    0x4(%eax),%eax
+  801f8b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801f8e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  801f93:	eb 54                	jmp    801fe9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801f95:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f98:	8b 10                	mov    (%eax),%edx
+  801f9a:	8b 48 04             	mov    0x4(%eax),%ecx
+  801f9d:	8d 40 08             	lea    0x8(%eax),%eax
+  801fa0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801fa3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  801fa8:	eb 3f                	jmp    801fe9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801faa:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fad:	8b 10                	mov    (%eax),%edx
+  801faf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fb4:	8d 40 04             	lea    0x4(%eax),%eax
+  801fb7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801fba:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  801fbf:	eb 28                	jmp    801fe9 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  801fc1:	83 ec 08             	sub    $0x8,%esp
+  801fc4:	53                   	push   %ebx
+  801fc5:	6a 30                	push   $0x30
+  801fc7:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801fc9:	83 c4 08             	add    $0x8,%esp
+  801fcc:	53                   	push   %ebx
+  801fcd:	6a 78                	push   $0x78
+  801fcf:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801fd1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fd4:	8b 10                	mov    (%eax),%edx
+  801fd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801fdb:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801fde:	8d 40 04             	lea    0x4(%eax),%eax
+  801fe1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801fe4:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801fe9:	83 ec 0c             	sub    $0xc,%esp
+  801fec:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801ff0:	50                   	push   %eax
+  801ff1:	ff 75 e0             	push   -0x20(%ebp)
+  801ff4:	57                   	push   %edi
+  801ff5:	51                   	push   %ecx
+  801ff6:	52                   	push   %edx
+  801ff7:	89 da                	mov    %ebx,%edx
+  801ff9:	89 f0                	mov    %esi,%eax
+  801ffb:	e8 4a fb ff ff       	call   801b4a <printnum>
+			break;
+  802000:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802003:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802006:	e9 40 fc ff ff       	jmp    801c4b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80200b:	83 f9 01             	cmp    $0x1,%ecx
+  80200e:	7f 1b                	jg     80202b <vprintfmt+0x3fe>
+	else if (lflag)
+  802010:	85 c9                	test   %ecx,%ecx
+  802012:	74 2c                	je     802040 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802014:	8b 45 14             	mov    0x14(%ebp),%eax
+  802017:	8b 10                	mov    (%eax),%edx
+  802019:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80201e:	8d 40 04             	lea    0x4(%eax),%eax
+  802021:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802024:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802029:	eb be                	jmp    801fe9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80202b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80202e:	8b 10                	mov    (%eax),%edx
+  802030:	8b 48 04             	mov    0x4(%eax),%ecx
+  802033:	8d 40 08             	lea    0x8(%eax),%eax
+  802036:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802039:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80203e:	eb a9                	jmp    801fe9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802040:	8b 45 14             	mov    0x14(%ebp),%eax
+  802043:	8b 10                	mov    (%eax),%edx
+  802045:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80204a:	8d 40 04             	lea    0x4(%eax),%eax
+  80204d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802050:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802055:	eb 92                	jmp    801fe9 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802057:	83 ec 08             	sub    $0x8,%esp
+  80205a:	53                   	push   %ebx
+  80205b:	6a 25                	push   $0x25
+  80205d:	ff d6                	call   *%esi
+			break;
+  80205f:	83 c4 10             	add    $0x10,%esp
+  802062:	eb 9f                	jmp    802003 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802064:	83 ec 08             	sub    $0x8,%esp
+  802067:	53                   	push   %ebx
+  802068:	6a 25                	push   $0x25
+  80206a:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80206c:	83 c4 10             	add    $0x10,%esp
+  80206f:	89 f8                	mov    %edi,%eax
+  802071:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802075:	74 05                	je     80207c <vprintfmt+0x44f>
+  802077:	83 e8 01             	sub    $0x1,%eax
+  80207a:	eb f5                	jmp    802071 <vprintfmt+0x444>
+  80207c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80207f:	eb 82                	jmp    802003 <vprintfmt+0x3d6>
+
+00802081 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802081:	55                   	push   %ebp
+  802082:	89 e5                	mov    %esp,%ebp
+  802084:	83 ec 18             	sub    $0x18,%esp
+  802087:	8b 45 08             	mov    0x8(%ebp),%eax
+  80208a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80208d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802090:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802094:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802097:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80209e:	85 c0                	test   %eax,%eax
+  8020a0:	74 26                	je     8020c8 <vsnprintf+0x47>
+  8020a2:	85 d2                	test   %edx,%edx
+  8020a4:	7e 22                	jle    8020c8 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8020a6:	ff 75 14             	push   0x14(%ebp)
+  8020a9:	ff 75 10             	push   0x10(%ebp)
+  8020ac:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8020af:	50                   	push   %eax
+  8020b0:	68 f3 1b 80 00       	push   $0x801bf3
+  8020b5:	e8 73 fb ff ff       	call   801c2d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8020ba:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8020bd:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8020c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c3:	83 c4 10             	add    $0x10,%esp
+}
+  8020c6:	c9                   	leave
+  8020c7:	c3                   	ret
+		return -E_INVAL;
+  8020c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020cd:	eb f7                	jmp    8020c6 <vsnprintf+0x45>
+
+008020cf <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8020cf:	55                   	push   %ebp
+  8020d0:	89 e5                	mov    %esp,%ebp
+  8020d2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8020d5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8020d8:	50                   	push   %eax
+  8020d9:	ff 75 10             	push   0x10(%ebp)
+  8020dc:	ff 75 0c             	push   0xc(%ebp)
+  8020df:	ff 75 08             	push   0x8(%ebp)
+  8020e2:	e8 9a ff ff ff       	call   802081 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8020e7:	c9                   	leave
+  8020e8:	c3                   	ret
+
+008020e9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8020e9:	55                   	push   %ebp
+  8020ea:	89 e5                	mov    %esp,%ebp
+  8020ec:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8020ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f4:	eb 03                	jmp    8020f9 <strlen+0x10>
+		n++;
+  8020f6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8020f9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8020fd:	75 f7                	jne    8020f6 <strlen+0xd>
+	return n;
+}
+  8020ff:	5d                   	pop    %ebp
+  802100:	c3                   	ret
+
+00802101 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802101:	55                   	push   %ebp
+  802102:	89 e5                	mov    %esp,%ebp
+  802104:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802107:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80210a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210f:	eb 03                	jmp    802114 <strnlen+0x13>
+		n++;
+  802111:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802114:	39 d0                	cmp    %edx,%eax
+  802116:	74 08                	je     802120 <strnlen+0x1f>
+  802118:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80211c:	75 f3                	jne    802111 <strnlen+0x10>
+  80211e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802120:	89 d0                	mov    %edx,%eax
+  802122:	5d                   	pop    %ebp
+  802123:	c3                   	ret
+
+00802124 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802124:	55                   	push   %ebp
+  802125:	89 e5                	mov    %esp,%ebp
+  802127:	53                   	push   %ebx
+  802128:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80212b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80212e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802133:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802137:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80213a:	83 c0 01             	add    $0x1,%eax
+  80213d:	84 d2                	test   %dl,%dl
+  80213f:	75 f2                	jne    802133 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802141:	89 c8                	mov    %ecx,%eax
+  802143:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802146:	c9                   	leave
+  802147:	c3                   	ret
+
+00802148 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802148:	55                   	push   %ebp
+  802149:	89 e5                	mov    %esp,%ebp
+  80214b:	53                   	push   %ebx
+  80214c:	83 ec 10             	sub    $0x10,%esp
+  80214f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802152:	53                   	push   %ebx
+  802153:	e8 91 ff ff ff       	call   8020e9 <strlen>
+  802158:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80215b:	ff 75 0c             	push   0xc(%ebp)
+  80215e:	01 d8                	add    %ebx,%eax
+  802160:	50                   	push   %eax
+  802161:	e8 be ff ff ff       	call   802124 <strcpy>
+	return dst;
+}
+  802166:	89 d8                	mov    %ebx,%eax
+  802168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80216b:	c9                   	leave
+  80216c:	c3                   	ret
+
+0080216d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80216d:	55                   	push   %ebp
+  80216e:	89 e5                	mov    %esp,%ebp
+  802170:	56                   	push   %esi
+  802171:	53                   	push   %ebx
+  802172:	8b 75 08             	mov    0x8(%ebp),%esi
+  802175:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  802178:	89 f3                	mov    %esi,%ebx
+  80217a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80217d:	89 f0                	mov    %esi,%eax
+  80217f:	eb 0f                	jmp    802190 <strncpy+0x23>
+		*dst++ = *src;
+  802181:	83 c0 01             	add    $0x1,%eax
+  802184:	0f b6 0a             	movzbl (%edx),%ecx
+  802187:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80218a:	80 f9 01             	cmp    $0x1,%cl
+  80218d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  802190:	39 d8                	cmp    %ebx,%eax
+  802192:	75 ed                	jne    802181 <strncpy+0x14>
+	}
+	return ret;
+}
+  802194:	89 f0                	mov    %esi,%eax
+  802196:	5b                   	pop    %ebx
+  802197:	5e                   	pop    %esi
+  802198:	5d                   	pop    %ebp
+  802199:	c3                   	ret
+
+0080219a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80219a:	55                   	push   %ebp
+  80219b:	89 e5                	mov    %esp,%ebp
+  80219d:	56                   	push   %esi
+  80219e:	53                   	push   %ebx
+  80219f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021a5:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8021a8:	89 f0                	mov    %esi,%eax
+  8021aa:	85 d2                	test   %edx,%edx
+  8021ac:	74 21                	je     8021cf <strlcpy+0x35>
+  8021ae:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8021b2:	89 f2                	mov    %esi,%edx
+  8021b4:	eb 09                	jmp    8021bf <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8021b6:	83 c1 01             	add    $0x1,%ecx
+  8021b9:	83 c2 01             	add    $0x1,%edx
+  8021bc:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8021bf:	39 c2                	cmp    %eax,%edx
+  8021c1:	74 09                	je     8021cc <strlcpy+0x32>
+  8021c3:	0f b6 19             	movzbl (%ecx),%ebx
+  8021c6:	84 db                	test   %bl,%bl
+  8021c8:	75 ec                	jne    8021b6 <strlcpy+0x1c>
+  8021ca:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8021cc:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8021cf:	29 f0                	sub    %esi,%eax
+}
+  8021d1:	5b                   	pop    %ebx
+  8021d2:	5e                   	pop    %esi
+  8021d3:	5d                   	pop    %ebp
+  8021d4:	c3                   	ret
+
+008021d5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8021d5:	55                   	push   %ebp
+  8021d6:	89 e5                	mov    %esp,%ebp
+  8021d8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021db:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8021de:	eb 06                	jmp    8021e6 <strcmp+0x11>
+		p++, q++;
+  8021e0:	83 c1 01             	add    $0x1,%ecx
+  8021e3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8021e6:	0f b6 01             	movzbl (%ecx),%eax
+  8021e9:	84 c0                	test   %al,%al
+  8021eb:	74 04                	je     8021f1 <strcmp+0x1c>
+  8021ed:	3a 02                	cmp    (%edx),%al
+  8021ef:	74 ef                	je     8021e0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8021f1:	0f b6 c0             	movzbl %al,%eax
+  8021f4:	0f b6 12             	movzbl (%edx),%edx
+  8021f7:	29 d0                	sub    %edx,%eax
+}
+  8021f9:	5d                   	pop    %ebp
+  8021fa:	c3                   	ret
+
+008021fb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8021fb:	55                   	push   %ebp
+  8021fc:	89 e5                	mov    %esp,%ebp
+  8021fe:	53                   	push   %ebx
+  8021ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802202:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802205:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802208:	eb 09                	jmp    802213 <strncmp+0x18>
+		n--, p++, q++;
+  80220a:	83 ea 01             	sub    $0x1,%edx
+  80220d:	83 c0 01             	add    $0x1,%eax
+  802210:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802213:	85 d2                	test   %edx,%edx
+  802215:	74 18                	je     80222f <strncmp+0x34>
+  802217:	0f b6 18             	movzbl (%eax),%ebx
+  80221a:	84 db                	test   %bl,%bl
+  80221c:	74 04                	je     802222 <strncmp+0x27>
+  80221e:	3a 19                	cmp    (%ecx),%bl
+  802220:	74 e8                	je     80220a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802222:	0f b6 00             	movzbl (%eax),%eax
+  802225:	0f b6 11             	movzbl (%ecx),%edx
+  802228:	29 d0                	sub    %edx,%eax
+}
+  80222a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80222d:	c9                   	leave
+  80222e:	c3                   	ret
+		return 0;
+  80222f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802234:	eb f4                	jmp    80222a <strncmp+0x2f>
+
+00802236 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802236:	55                   	push   %ebp
+  802237:	89 e5                	mov    %esp,%ebp
+  802239:	8b 45 08             	mov    0x8(%ebp),%eax
+  80223c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802240:	eb 03                	jmp    802245 <strchr+0xf>
+  802242:	83 c0 01             	add    $0x1,%eax
+  802245:	0f b6 10             	movzbl (%eax),%edx
+  802248:	84 d2                	test   %dl,%dl
+  80224a:	74 06                	je     802252 <strchr+0x1c>
+		if (*s == c)
+  80224c:	38 ca                	cmp    %cl,%dl
+  80224e:	75 f2                	jne    802242 <strchr+0xc>
+  802250:	eb 05                	jmp    802257 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802252:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802257:	5d                   	pop    %ebp
+  802258:	c3                   	ret
+
+00802259 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802259:	55                   	push   %ebp
+  80225a:	89 e5                	mov    %esp,%ebp
+  80225c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80225f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802263:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  802266:	38 ca                	cmp    %cl,%dl
+  802268:	74 09                	je     802273 <strfind+0x1a>
+  80226a:	84 d2                	test   %dl,%dl
+  80226c:	74 05                	je     802273 <strfind+0x1a>
+	for (; *s; s++)
+  80226e:	83 c0 01             	add    $0x1,%eax
+  802271:	eb f0                	jmp    802263 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  802273:	5d                   	pop    %ebp
+  802274:	c3                   	ret
+
+00802275 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802275:	55                   	push   %ebp
+  802276:	89 e5                	mov    %esp,%ebp
+  802278:	57                   	push   %edi
+  802279:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80227c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80227f:	85 c9                	test   %ecx,%ecx
+  802281:	74 20                	je     8022a3 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  802283:	89 f8                	mov    %edi,%eax
+  802285:	09 c8                	or     %ecx,%eax
+  802287:	a8 03                	test   $0x3,%al
+  802289:	75 12                	jne    80229d <memset+0x28>
+		c &= 0xFF;
+  80228b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80228f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802295:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802298:	fc                   	cld
+  802299:	f3 ab                	rep stos %eax,%es:(%edi)
+  80229b:	eb 06                	jmp    8022a3 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80229d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022a0:	fc                   	cld
+  8022a1:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8022a3:	89 f8                	mov    %edi,%eax
+  8022a5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8022a8:	c9                   	leave
+  8022a9:	c3                   	ret
+
+008022aa <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8022aa:	55                   	push   %ebp
+  8022ab:	89 e5                	mov    %esp,%ebp
+  8022ad:	57                   	push   %edi
+  8022ae:	56                   	push   %esi
+  8022af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8022b5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8022b8:	39 c6                	cmp    %eax,%esi
+  8022ba:	73 32                	jae    8022ee <memmove+0x44>
+  8022bc:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8022bf:	39 d0                	cmp    %edx,%eax
+  8022c1:	73 2b                	jae    8022ee <memmove+0x44>
+		s += n;
+		d += n;
+  8022c3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8022c6:	89 d6                	mov    %edx,%esi
+  8022c8:	09 fe                	or     %edi,%esi
+  8022ca:	09 ce                	or     %ecx,%esi
+  8022cc:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8022d2:	75 0e                	jne    8022e2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8022d4:	83 ef 04             	sub    $0x4,%edi
+  8022d7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8022da:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8022dd:	fd                   	std
+  8022de:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8022e0:	eb 09                	jmp    8022eb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8022e2:	83 ef 01             	sub    $0x1,%edi
+  8022e5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8022e8:	fd                   	std
+  8022e9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8022eb:	fc                   	cld
+  8022ec:	eb 1a                	jmp    802308 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8022ee:	89 f2                	mov    %esi,%edx
+  8022f0:	09 c2                	or     %eax,%edx
+  8022f2:	09 ca                	or     %ecx,%edx
+  8022f4:	f6 c2 03             	test   $0x3,%dl
+  8022f7:	75 0a                	jne    802303 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8022f9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8022fc:	89 c7                	mov    %eax,%edi
+  8022fe:	fc                   	cld
+  8022ff:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802301:	eb 05                	jmp    802308 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802303:	89 c7                	mov    %eax,%edi
+  802305:	fc                   	cld
+  802306:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802308:	5e                   	pop    %esi
+  802309:	5f                   	pop    %edi
+  80230a:	5d                   	pop    %ebp
+  80230b:	c3                   	ret
+
+0080230c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80230c:	55                   	push   %ebp
+  80230d:	89 e5                	mov    %esp,%ebp
+  80230f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802312:	ff 75 10             	push   0x10(%ebp)
+  802315:	ff 75 0c             	push   0xc(%ebp)
+  802318:	ff 75 08             	push   0x8(%ebp)
+  80231b:	e8 8a ff ff ff       	call   8022aa <memmove>
+}
+  802320:	c9                   	leave
+  802321:	c3                   	ret
+
+00802322 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802322:	55                   	push   %ebp
+  802323:	89 e5                	mov    %esp,%ebp
+  802325:	56                   	push   %esi
+  802326:	53                   	push   %ebx
+  802327:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80232d:	89 c6                	mov    %eax,%esi
+  80232f:	03 75 10             	add    0x10(%ebp),%esi
+  802332:	eb 06                	jmp    80233a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802334:	83 c0 01             	add    $0x1,%eax
+  802337:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80233a:	39 f0                	cmp    %esi,%eax
+  80233c:	74 14                	je     802352 <memcmp+0x30>
+		if (*s1 != *s2)
+  80233e:	0f b6 08             	movzbl (%eax),%ecx
+  802341:	0f b6 1a             	movzbl (%edx),%ebx
+  802344:	38 d9                	cmp    %bl,%cl
+  802346:	74 ec                	je     802334 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802348:	0f b6 c1             	movzbl %cl,%eax
+  80234b:	0f b6 db             	movzbl %bl,%ebx
+  80234e:	29 d8                	sub    %ebx,%eax
+  802350:	eb 05                	jmp    802357 <memcmp+0x35>
+	}
+
+	return 0;
+  802352:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802357:	5b                   	pop    %ebx
+  802358:	5e                   	pop    %esi
+  802359:	5d                   	pop    %ebp
+  80235a:	c3                   	ret
+
+0080235b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80235b:	55                   	push   %ebp
+  80235c:	89 e5                	mov    %esp,%ebp
+  80235e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802361:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802364:	89 c2                	mov    %eax,%edx
+  802366:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802369:	eb 03                	jmp    80236e <memfind+0x13>
+  80236b:	83 c0 01             	add    $0x1,%eax
+  80236e:	39 d0                	cmp    %edx,%eax
+  802370:	73 04                	jae    802376 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802372:	38 08                	cmp    %cl,(%eax)
+  802374:	75 f5                	jne    80236b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802376:	5d                   	pop    %ebp
+  802377:	c3                   	ret
+
+00802378 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802378:	55                   	push   %ebp
+  802379:	89 e5                	mov    %esp,%ebp
+  80237b:	57                   	push   %edi
+  80237c:	56                   	push   %esi
+  80237d:	53                   	push   %ebx
+  80237e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802381:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802384:	eb 03                	jmp    802389 <strtol+0x11>
+		s++;
+  802386:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802389:	0f b6 02             	movzbl (%edx),%eax
+  80238c:	3c 20                	cmp    $0x20,%al
+  80238e:	74 f6                	je     802386 <strtol+0xe>
+  802390:	3c 09                	cmp    $0x9,%al
+  802392:	74 f2                	je     802386 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802394:	3c 2b                	cmp    $0x2b,%al
+  802396:	74 2a                	je     8023c2 <strtol+0x4a>
+	int neg = 0;
+  802398:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80239d:	3c 2d                	cmp    $0x2d,%al
+  80239f:	74 2b                	je     8023cc <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8023a1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8023a7:	75 0f                	jne    8023b8 <strtol+0x40>
+  8023a9:	80 3a 30             	cmpb   $0x30,(%edx)
+  8023ac:	74 28                	je     8023d6 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8023ae:	85 db                	test   %ebx,%ebx
+  8023b0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8023b5:	0f 44 d8             	cmove  %eax,%ebx
+  8023b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023bd:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8023c0:	eb 46                	jmp    802408 <strtol+0x90>
+		s++;
+  8023c2:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8023c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ca:	eb d5                	jmp    8023a1 <strtol+0x29>
+		s++, neg = 1;
+  8023cc:	83 c2 01             	add    $0x1,%edx
+  8023cf:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023d4:	eb cb                	jmp    8023a1 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8023d6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8023da:	74 0e                	je     8023ea <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8023dc:	85 db                	test   %ebx,%ebx
+  8023de:	75 d8                	jne    8023b8 <strtol+0x40>
+		s++, base = 8;
+  8023e0:	83 c2 01             	add    $0x1,%edx
+  8023e3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8023e8:	eb ce                	jmp    8023b8 <strtol+0x40>
+		s += 2, base = 16;
+  8023ea:	83 c2 02             	add    $0x2,%edx
+  8023ed:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8023f2:	eb c4                	jmp    8023b8 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8023f4:	0f be c0             	movsbl %al,%eax
+  8023f7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8023fa:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023fd:	7d 3a                	jge    802439 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8023ff:	83 c2 01             	add    $0x1,%edx
+  802402:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802406:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802408:	0f b6 02             	movzbl (%edx),%eax
+  80240b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80240e:	89 f3                	mov    %esi,%ebx
+  802410:	80 fb 09             	cmp    $0x9,%bl
+  802413:	76 df                	jbe    8023f4 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802415:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802418:	89 f3                	mov    %esi,%ebx
+  80241a:	80 fb 19             	cmp    $0x19,%bl
+  80241d:	77 08                	ja     802427 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80241f:	0f be c0             	movsbl %al,%eax
+  802422:	83 e8 57             	sub    $0x57,%eax
+  802425:	eb d3                	jmp    8023fa <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802427:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80242a:	89 f3                	mov    %esi,%ebx
+  80242c:	80 fb 19             	cmp    $0x19,%bl
+  80242f:	77 08                	ja     802439 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802431:	0f be c0             	movsbl %al,%eax
+  802434:	83 e8 37             	sub    $0x37,%eax
+  802437:	eb c1                	jmp    8023fa <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802439:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80243d:	74 05                	je     802444 <strtol+0xcc>
+		*endptr = (char *) s;
+  80243f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802442:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802444:	89 c8                	mov    %ecx,%eax
+  802446:	f7 d8                	neg    %eax
+  802448:	85 ff                	test   %edi,%edi
+  80244a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80244d:	89 c8                	mov    %ecx,%eax
+  80244f:	5b                   	pop    %ebx
+  802450:	5e                   	pop    %esi
+  802451:	5f                   	pop    %edi
+  802452:	5d                   	pop    %ebp
+  802453:	c3                   	ret
+
+00802454 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802454:	55                   	push   %ebp
+  802455:	89 e5                	mov    %esp,%ebp
+  802457:	57                   	push   %edi
+  802458:	56                   	push   %esi
+  802459:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80245a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80245f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802462:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802465:	89 c3                	mov    %eax,%ebx
+  802467:	89 c7                	mov    %eax,%edi
+  802469:	89 c6                	mov    %eax,%esi
+  80246b:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80246d:	5b                   	pop    %ebx
+  80246e:	5e                   	pop    %esi
+  80246f:	5f                   	pop    %edi
+  802470:	5d                   	pop    %ebp
+  802471:	c3                   	ret
+
+00802472 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802472:	55                   	push   %ebp
+  802473:	89 e5                	mov    %esp,%ebp
+  802475:	57                   	push   %edi
+  802476:	56                   	push   %esi
+  802477:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802478:	ba 00 00 00 00       	mov    $0x0,%edx
+  80247d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802482:	89 d1                	mov    %edx,%ecx
+  802484:	89 d3                	mov    %edx,%ebx
+  802486:	89 d7                	mov    %edx,%edi
+  802488:	89 d6                	mov    %edx,%esi
+  80248a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80248c:	5b                   	pop    %ebx
+  80248d:	5e                   	pop    %esi
+  80248e:	5f                   	pop    %edi
+  80248f:	5d                   	pop    %ebp
+  802490:	c3                   	ret
+
+00802491 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  802491:	55                   	push   %ebp
+  802492:	89 e5                	mov    %esp,%ebp
+  802494:	57                   	push   %edi
+  802495:	56                   	push   %esi
+  802496:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802497:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80249c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80249f:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024a4:	89 cb                	mov    %ecx,%ebx
+  8024a6:	89 cf                	mov    %ecx,%edi
+  8024a8:	89 ce                	mov    %ecx,%esi
+  8024aa:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  8024ac:	5b                   	pop    %ebx
+  8024ad:	5e                   	pop    %esi
+  8024ae:	5f                   	pop    %edi
+  8024af:	5d                   	pop    %ebp
+  8024b0:	c3                   	ret
+
+008024b1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8024b1:	55                   	push   %ebp
+  8024b2:	89 e5                	mov    %esp,%ebp
+  8024b4:	57                   	push   %edi
+  8024b5:	56                   	push   %esi
+  8024b6:	53                   	push   %ebx
+  8024b7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8024ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024c2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024c7:	89 cb                	mov    %ecx,%ebx
+  8024c9:	89 cf                	mov    %ecx,%edi
+  8024cb:	89 ce                	mov    %ecx,%esi
+  8024cd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8024cf:	85 c0                	test   %eax,%eax
+  8024d1:	7f 08                	jg     8024db <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8024d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d6:	5b                   	pop    %ebx
+  8024d7:	5e                   	pop    %esi
+  8024d8:	5f                   	pop    %edi
+  8024d9:	5d                   	pop    %ebp
+  8024da:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8024db:	83 ec 0c             	sub    $0xc,%esp
+  8024de:	50                   	push   %eax
+  8024df:	6a 03                	push   $0x3
+  8024e1:	68 9f 49 80 00       	push   $0x80499f
+  8024e6:	6a 23                	push   $0x23
+  8024e8:	68 bc 49 80 00       	push   $0x8049bc
+  8024ed:	e8 69 f5 ff ff       	call   801a5b <_panic>
+
+008024f2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8024f2:	55                   	push   %ebp
+  8024f3:	89 e5                	mov    %esp,%ebp
+  8024f5:	57                   	push   %edi
+  8024f6:	56                   	push   %esi
+  8024f7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8024f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fd:	b8 02 00 00 00       	mov    $0x2,%eax
+  802502:	89 d1                	mov    %edx,%ecx
+  802504:	89 d3                	mov    %edx,%ebx
+  802506:	89 d7                	mov    %edx,%edi
+  802508:	89 d6                	mov    %edx,%esi
+  80250a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80250c:	5b                   	pop    %ebx
+  80250d:	5e                   	pop    %esi
+  80250e:	5f                   	pop    %edi
+  80250f:	5d                   	pop    %ebp
+  802510:	c3                   	ret
+
+00802511 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802511:	55                   	push   %ebp
+  802512:	89 e5                	mov    %esp,%ebp
+  802514:	57                   	push   %edi
+  802515:	56                   	push   %esi
+  802516:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802517:	ba 00 00 00 00       	mov    $0x0,%edx
+  80251c:	b8 16 00 00 00       	mov    $0x16,%eax
+  802521:	89 d1                	mov    %edx,%ecx
+  802523:	89 d3                	mov    %edx,%ebx
+  802525:	89 d7                	mov    %edx,%edi
+  802527:	89 d6                	mov    %edx,%esi
+  802529:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80252b:	5b                   	pop    %ebx
+  80252c:	5e                   	pop    %esi
+  80252d:	5f                   	pop    %edi
+  80252e:	5d                   	pop    %ebp
+  80252f:	c3                   	ret
+
+00802530 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  802530:	55                   	push   %ebp
+  802531:	89 e5                	mov    %esp,%ebp
+  802533:	57                   	push   %edi
+  802534:	56                   	push   %esi
+  802535:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802536:	ba 00 00 00 00       	mov    $0x0,%edx
+  80253b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802540:	89 d1                	mov    %edx,%ecx
+  802542:	89 d3                	mov    %edx,%ebx
+  802544:	89 d7                	mov    %edx,%edi
+  802546:	89 d6                	mov    %edx,%esi
+  802548:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  80254a:	5b                   	pop    %ebx
+  80254b:	5e                   	pop    %esi
+  80254c:	5f                   	pop    %edi
+  80254d:	5d                   	pop    %ebp
+  80254e:	c3                   	ret
+
+0080254f <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  80254f:	55                   	push   %ebp
+  802550:	89 e5                	mov    %esp,%ebp
+  802552:	57                   	push   %edi
+  802553:	56                   	push   %esi
+  802554:	53                   	push   %ebx
+  802555:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802558:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80255d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802560:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802563:	b8 15 00 00 00       	mov    $0x15,%eax
+  802568:	89 df                	mov    %ebx,%edi
+  80256a:	89 de                	mov    %ebx,%esi
+  80256c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80256e:	85 c0                	test   %eax,%eax
+  802570:	7f 08                	jg     80257a <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  802572:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802575:	5b                   	pop    %ebx
+  802576:	5e                   	pop    %esi
+  802577:	5f                   	pop    %edi
+  802578:	5d                   	pop    %ebp
+  802579:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80257a:	83 ec 0c             	sub    $0xc,%esp
+  80257d:	50                   	push   %eax
+  80257e:	6a 15                	push   $0x15
+  802580:	68 9f 49 80 00       	push   $0x80499f
+  802585:	6a 23                	push   $0x23
+  802587:	68 bc 49 80 00       	push   $0x8049bc
+  80258c:	e8 ca f4 ff ff       	call   801a5b <_panic>
+
+00802591 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802591:	55                   	push   %ebp
+  802592:	89 e5                	mov    %esp,%ebp
+  802594:	57                   	push   %edi
+  802595:	56                   	push   %esi
+  802596:	53                   	push   %ebx
+  802597:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80259a:	be 00 00 00 00       	mov    $0x0,%esi
+  80259f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025a5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025ad:	89 f7                	mov    %esi,%edi
+  8025af:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	7f 08                	jg     8025bd <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8025b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025b8:	5b                   	pop    %ebx
+  8025b9:	5e                   	pop    %esi
+  8025ba:	5f                   	pop    %edi
+  8025bb:	5d                   	pop    %ebp
+  8025bc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8025bd:	83 ec 0c             	sub    $0xc,%esp
+  8025c0:	50                   	push   %eax
+  8025c1:	6a 05                	push   $0x5
+  8025c3:	68 9f 49 80 00       	push   $0x80499f
+  8025c8:	6a 23                	push   $0x23
+  8025ca:	68 bc 49 80 00       	push   $0x8049bc
+  8025cf:	e8 87 f4 ff ff       	call   801a5b <_panic>
+
+008025d4 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  8025d4:	55                   	push   %ebp
+  8025d5:	89 e5                	mov    %esp,%ebp
+  8025d7:	57                   	push   %edi
+  8025d8:	56                   	push   %esi
+  8025d9:	53                   	push   %ebx
+  8025da:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8025dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025e8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025f0:	89 f7                	mov    %esi,%edi
+  8025f2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8025f4:	85 c0                	test   %eax,%eax
+  8025f6:	7f 08                	jg     802600 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8025f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025fb:	5b                   	pop    %ebx
+  8025fc:	5e                   	pop    %esi
+  8025fd:	5f                   	pop    %edi
+  8025fe:	5d                   	pop    %ebp
+  8025ff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802600:	83 ec 0c             	sub    $0xc,%esp
+  802603:	50                   	push   %eax
+  802604:	6a 06                	push   $0x6
+  802606:	68 9f 49 80 00       	push   $0x80499f
+  80260b:	6a 23                	push   $0x23
+  80260d:	68 bc 49 80 00       	push   $0x8049bc
+  802612:	e8 44 f4 ff ff       	call   801a5b <_panic>
+
+00802617 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802617:	55                   	push   %ebp
+  802618:	89 e5                	mov    %esp,%ebp
+  80261a:	57                   	push   %edi
+  80261b:	56                   	push   %esi
+  80261c:	53                   	push   %ebx
+  80261d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802620:	8b 55 08             	mov    0x8(%ebp),%edx
+  802623:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802626:	b8 07 00 00 00       	mov    $0x7,%eax
+  80262b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80262e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802631:	8b 75 18             	mov    0x18(%ebp),%esi
+  802634:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802636:	85 c0                	test   %eax,%eax
+  802638:	7f 08                	jg     802642 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80263a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80263d:	5b                   	pop    %ebx
+  80263e:	5e                   	pop    %esi
+  80263f:	5f                   	pop    %edi
+  802640:	5d                   	pop    %ebp
+  802641:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802642:	83 ec 0c             	sub    $0xc,%esp
+  802645:	50                   	push   %eax
+  802646:	6a 07                	push   $0x7
+  802648:	68 9f 49 80 00       	push   $0x80499f
+  80264d:	6a 23                	push   $0x23
+  80264f:	68 bc 49 80 00       	push   $0x8049bc
+  802654:	e8 02 f4 ff ff       	call   801a5b <_panic>
+
+00802659 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802659:	55                   	push   %ebp
+  80265a:	89 e5                	mov    %esp,%ebp
+  80265c:	57                   	push   %edi
+  80265d:	56                   	push   %esi
+  80265e:	53                   	push   %ebx
+  80265f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802662:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802667:	8b 55 08             	mov    0x8(%ebp),%edx
+  80266a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80266d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802672:	89 df                	mov    %ebx,%edi
+  802674:	89 de                	mov    %ebx,%esi
+  802676:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802678:	85 c0                	test   %eax,%eax
+  80267a:	7f 08                	jg     802684 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80267c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80267f:	5b                   	pop    %ebx
+  802680:	5e                   	pop    %esi
+  802681:	5f                   	pop    %edi
+  802682:	5d                   	pop    %ebp
+  802683:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802684:	83 ec 0c             	sub    $0xc,%esp
+  802687:	50                   	push   %eax
+  802688:	6a 08                	push   $0x8
+  80268a:	68 9f 49 80 00       	push   $0x80499f
+  80268f:	6a 23                	push   $0x23
+  802691:	68 bc 49 80 00       	push   $0x8049bc
+  802696:	e8 c0 f3 ff ff       	call   801a5b <_panic>
+
+0080269b <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  80269b:	55                   	push   %ebp
+  80269c:	89 e5                	mov    %esp,%ebp
+  80269e:	57                   	push   %edi
+  80269f:	56                   	push   %esi
+  8026a0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8026a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026a7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8026ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026b4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8026b7:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8026b9:	5b                   	pop    %ebx
+  8026ba:	5e                   	pop    %esi
+  8026bb:	5f                   	pop    %edi
+  8026bc:	5d                   	pop    %ebp
+  8026bd:	c3                   	ret
+
+008026be <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8026be:	55                   	push   %ebp
+  8026bf:	89 e5                	mov    %esp,%ebp
+  8026c1:	57                   	push   %edi
+  8026c2:	56                   	push   %esi
+  8026c3:	53                   	push   %ebx
+  8026c4:	8b 45 18             	mov    0x18(%ebp),%eax
+  8026c7:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  8026ca:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  8026cf:	77 27                	ja     8026f8 <sys_page_map_range+0x3a>
+  8026d1:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8026d7:	77 1f                	ja     8026f8 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  8026d9:	c1 e0 0c             	shl    $0xc,%eax
+  8026dc:	89 c6                	mov    %eax,%esi
+  8026de:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  8026e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8026f1:	cd 30                	int    $0x30
+}
+  8026f3:	5b                   	pop    %ebx
+  8026f4:	5e                   	pop    %esi
+  8026f5:	5f                   	pop    %edi
+  8026f6:	5d                   	pop    %ebp
+  8026f7:	c3                   	ret
+		return -E_INVAL;
+  8026f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026fd:	eb f4                	jmp    8026f3 <sys_page_map_range+0x35>
+
+008026ff <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8026ff:	55                   	push   %ebp
+  802700:	89 e5                	mov    %esp,%ebp
+  802702:	57                   	push   %edi
+  802703:	56                   	push   %esi
+  802704:	53                   	push   %ebx
+  802705:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802708:	8b 55 08             	mov    0x8(%ebp),%edx
+  80270b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80270e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802713:	be 00 00 00 00       	mov    $0x0,%esi
+  802718:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80271b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80271e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802720:	85 c0                	test   %eax,%eax
+  802722:	7f 08                	jg     80272c <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  802724:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802727:	5b                   	pop    %ebx
+  802728:	5e                   	pop    %esi
+  802729:	5f                   	pop    %edi
+  80272a:	5d                   	pop    %ebp
+  80272b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80272c:	83 ec 0c             	sub    $0xc,%esp
+  80272f:	50                   	push   %eax
+  802730:	6a 0c                	push   $0xc
+  802732:	68 9f 49 80 00       	push   $0x80499f
+  802737:	6a 23                	push   $0x23
+  802739:	68 bc 49 80 00       	push   $0x8049bc
+  80273e:	e8 18 f3 ff ff       	call   801a5b <_panic>
+
+00802743 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  802743:	55                   	push   %ebp
+  802744:	89 e5                	mov    %esp,%ebp
+  802746:	57                   	push   %edi
+  802747:	56                   	push   %esi
+  802748:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802749:	be 00 00 00 00       	mov    $0x0,%esi
+  80274e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802751:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802754:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802759:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80275c:	89 f7                	mov    %esi,%edi
+  80275e:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  802760:	5b                   	pop    %ebx
+  802761:	5e                   	pop    %esi
+  802762:	5f                   	pop    %edi
+  802763:	5d                   	pop    %ebp
+  802764:	c3                   	ret
+
+00802765 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802765:	55                   	push   %ebp
+  802766:	89 e5                	mov    %esp,%ebp
+  802768:	57                   	push   %edi
+  802769:	56                   	push   %esi
+  80276a:	53                   	push   %ebx
+  80276b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80276e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802773:	8b 55 08             	mov    0x8(%ebp),%edx
+  802776:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802779:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80277e:	89 df                	mov    %ebx,%edi
+  802780:	89 de                	mov    %ebx,%esi
+  802782:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802784:	85 c0                	test   %eax,%eax
+  802786:	7f 08                	jg     802790 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  802788:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80278b:	5b                   	pop    %ebx
+  80278c:	5e                   	pop    %esi
+  80278d:	5f                   	pop    %edi
+  80278e:	5d                   	pop    %ebp
+  80278f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802790:	83 ec 0c             	sub    $0xc,%esp
+  802793:	50                   	push   %eax
+  802794:	6a 0f                	push   $0xf
+  802796:	68 9f 49 80 00       	push   $0x80499f
+  80279b:	6a 23                	push   $0x23
+  80279d:	68 bc 49 80 00       	push   $0x8049bc
+  8027a2:	e8 b4 f2 ff ff       	call   801a5b <_panic>
+
+008027a7 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8027a7:	55                   	push   %ebp
+  8027a8:	89 e5                	mov    %esp,%ebp
+  8027aa:	57                   	push   %edi
+  8027ab:	56                   	push   %esi
+  8027ac:	53                   	push   %ebx
+  8027ad:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8027b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027bb:	b8 10 00 00 00       	mov    $0x10,%eax
+  8027c0:	89 df                	mov    %ebx,%edi
+  8027c2:	89 de                	mov    %ebx,%esi
+  8027c4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8027c6:	85 c0                	test   %eax,%eax
+  8027c8:	7f 08                	jg     8027d2 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  8027ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027cd:	5b                   	pop    %ebx
+  8027ce:	5e                   	pop    %esi
+  8027cf:	5f                   	pop    %edi
+  8027d0:	5d                   	pop    %ebp
+  8027d1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8027d2:	83 ec 0c             	sub    $0xc,%esp
+  8027d5:	50                   	push   %eax
+  8027d6:	6a 10                	push   $0x10
+  8027d8:	68 9f 49 80 00       	push   $0x80499f
+  8027dd:	6a 23                	push   $0x23
+  8027df:	68 bc 49 80 00       	push   $0x8049bc
+  8027e4:	e8 72 f2 ff ff       	call   801a5b <_panic>
+
+008027e9 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8027e9:	55                   	push   %ebp
+  8027ea:	89 e5                	mov    %esp,%ebp
+  8027ec:	57                   	push   %edi
+  8027ed:	56                   	push   %esi
+  8027ee:	53                   	push   %ebx
+  8027ef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8027f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027fd:	b8 11 00 00 00       	mov    $0x11,%eax
+  802802:	89 df                	mov    %ebx,%edi
+  802804:	89 de                	mov    %ebx,%esi
+  802806:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802808:	85 c0                	test   %eax,%eax
+  80280a:	7f 08                	jg     802814 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  80280c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80280f:	5b                   	pop    %ebx
+  802810:	5e                   	pop    %esi
+  802811:	5f                   	pop    %edi
+  802812:	5d                   	pop    %ebp
+  802813:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802814:	83 ec 0c             	sub    $0xc,%esp
+  802817:	50                   	push   %eax
+  802818:	6a 11                	push   $0x11
+  80281a:	68 9f 49 80 00       	push   $0x80499f
+  80281f:	6a 23                	push   $0x23
+  802821:	68 bc 49 80 00       	push   $0x8049bc
+  802826:	e8 30 f2 ff ff       	call   801a5b <_panic>
+
+0080282b <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  80282b:	55                   	push   %ebp
+  80282c:	89 e5                	mov    %esp,%ebp
+  80282e:	57                   	push   %edi
+  80282f:	56                   	push   %esi
+  802830:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  802831:	ba 00 00 00 00       	mov    $0x0,%edx
+  802836:	b8 12 00 00 00       	mov    $0x12,%eax
+  80283b:	89 d1                	mov    %edx,%ecx
+  80283d:	89 d3                	mov    %edx,%ebx
+  80283f:	89 d7                	mov    %edx,%edi
+  802841:	89 d6                	mov    %edx,%esi
+  802843:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  802845:	5b                   	pop    %ebx
+  802846:	5e                   	pop    %esi
+  802847:	5f                   	pop    %edi
+  802848:	5d                   	pop    %ebp
+  802849:	c3                   	ret
+
+0080284a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80284a:	55                   	push   %ebp
+  80284b:	89 e5                	mov    %esp,%ebp
+  80284d:	57                   	push   %edi
+  80284e:	56                   	push   %esi
+  80284f:	53                   	push   %ebx
+  802850:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802853:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802858:	8b 55 08             	mov    0x8(%ebp),%edx
+  80285b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80285e:	b8 13 00 00 00       	mov    $0x13,%eax
+  802863:	89 df                	mov    %ebx,%edi
+  802865:	89 de                	mov    %ebx,%esi
+  802867:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802869:	85 c0                	test   %eax,%eax
+  80286b:	7f 08                	jg     802875 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80286d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802870:	5b                   	pop    %ebx
+  802871:	5e                   	pop    %esi
+  802872:	5f                   	pop    %edi
+  802873:	5d                   	pop    %ebp
+  802874:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802875:	83 ec 0c             	sub    $0xc,%esp
+  802878:	50                   	push   %eax
+  802879:	6a 13                	push   $0x13
+  80287b:	68 9f 49 80 00       	push   $0x80499f
+  802880:	6a 23                	push   $0x23
+  802882:	68 bc 49 80 00       	push   $0x8049bc
+  802887:	e8 cf f1 ff ff       	call   801a5b <_panic>
+
+0080288c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80288c:	55                   	push   %ebp
+  80288d:	89 e5                	mov    %esp,%ebp
+  80288f:	57                   	push   %edi
+  802890:	56                   	push   %esi
+  802891:	53                   	push   %ebx
+  802892:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802895:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80289a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80289d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028a0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8028a5:	89 df                	mov    %ebx,%edi
+  8028a7:	89 de                	mov    %ebx,%esi
+  8028a9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8028ab:	85 c0                	test   %eax,%eax
+  8028ad:	7f 08                	jg     8028b7 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8028af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028b2:	5b                   	pop    %ebx
+  8028b3:	5e                   	pop    %esi
+  8028b4:	5f                   	pop    %edi
+  8028b5:	5d                   	pop    %ebp
+  8028b6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8028b7:	83 ec 0c             	sub    $0xc,%esp
+  8028ba:	50                   	push   %eax
+  8028bb:	6a 14                	push   $0x14
+  8028bd:	68 9f 49 80 00       	push   $0x80499f
+  8028c2:	6a 23                	push   $0x23
+  8028c4:	68 bc 49 80 00       	push   $0x8049bc
+  8028c9:	e8 8d f1 ff ff       	call   801a5b <_panic>
+
+008028ce <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8028ce:	55                   	push   %ebp
+  8028cf:	89 e5                	mov    %esp,%ebp
+  8028d1:	57                   	push   %edi
+  8028d2:	56                   	push   %esi
+  8028d3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8028d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028da:	b8 17 00 00 00       	mov    $0x17,%eax
+  8028df:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028e7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8028ea:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8028ec:	5b                   	pop    %ebx
+  8028ed:	5e                   	pop    %esi
+  8028ee:	5f                   	pop    %edi
+  8028ef:	5d                   	pop    %ebp
+  8028f0:	c3                   	ret
+
+008028f1 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8028f1:	55                   	push   %ebp
+  8028f2:	89 e5                	mov    %esp,%ebp
+  8028f4:	57                   	push   %edi
+  8028f5:	56                   	push   %esi
+  8028f6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8028f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028fd:	b8 18 00 00 00       	mov    $0x18,%eax
+  802902:	be 00 00 00 00       	mov    $0x0,%esi
+  802907:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80290a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80290d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80290f:	5b                   	pop    %ebx
+  802910:	5e                   	pop    %esi
+  802911:	5f                   	pop    %edi
+  802912:	5d                   	pop    %ebp
+  802913:	c3                   	ret
+
+00802914 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802914:	55                   	push   %ebp
+  802915:	89 e5                	mov    %esp,%ebp
+  802917:	57                   	push   %edi
+  802918:	56                   	push   %esi
+  802919:	53                   	push   %ebx
+  80291a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80291d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802922:	8b 55 08             	mov    0x8(%ebp),%edx
+  802925:	b8 19 00 00 00       	mov    $0x19,%eax
+  80292a:	89 cb                	mov    %ecx,%ebx
+  80292c:	89 cf                	mov    %ecx,%edi
+  80292e:	89 ce                	mov    %ecx,%esi
+  802930:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802932:	85 c0                	test   %eax,%eax
+  802934:	7f 08                	jg     80293e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  802936:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802939:	5b                   	pop    %ebx
+  80293a:	5e                   	pop    %esi
+  80293b:	5f                   	pop    %edi
+  80293c:	5d                   	pop    %ebp
+  80293d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80293e:	83 ec 0c             	sub    $0xc,%esp
+  802941:	50                   	push   %eax
+  802942:	6a 19                	push   $0x19
+  802944:	68 9f 49 80 00       	push   $0x80499f
+  802949:	6a 23                	push   $0x23
+  80294b:	68 bc 49 80 00       	push   $0x8049bc
+  802950:	e8 06 f1 ff ff       	call   801a5b <_panic>
+
+00802955 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802955:	55                   	push   %ebp
+  802956:	89 e5                	mov    %esp,%ebp
+  802958:	57                   	push   %edi
+  802959:	56                   	push   %esi
+  80295a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80295b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802960:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  802965:	89 d1                	mov    %edx,%ecx
+  802967:	89 d3                	mov    %edx,%ebx
+  802969:	89 d7                	mov    %edx,%edi
+  80296b:	89 d6                	mov    %edx,%esi
+  80296d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80296f:	5b                   	pop    %ebx
+  802970:	5e                   	pop    %esi
+  802971:	5f                   	pop    %edi
+  802972:	5d                   	pop    %ebp
+  802973:	c3                   	ret
+
+00802974 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  802974:	55                   	push   %ebp
+  802975:	89 e5                	mov    %esp,%ebp
+  802977:	57                   	push   %edi
+  802978:	56                   	push   %esi
+  802979:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80297a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80297f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802982:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802985:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80298a:	89 df                	mov    %ebx,%edi
+  80298c:	89 de                	mov    %ebx,%esi
+  80298e:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  802990:	5b                   	pop    %ebx
+  802991:	5e                   	pop    %esi
+  802992:	5f                   	pop    %edi
+  802993:	5d                   	pop    %ebp
+  802994:	c3                   	ret
+
+00802995 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  802995:	55                   	push   %ebp
+  802996:	89 e5                	mov    %esp,%ebp
+  802998:	57                   	push   %edi
+  802999:	56                   	push   %esi
+  80299a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80299b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029a6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8029ab:	89 df                	mov    %ebx,%edi
+  8029ad:	89 de                	mov    %ebx,%esi
+  8029af:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  8029b1:	5b                   	pop    %ebx
+  8029b2:	5e                   	pop    %esi
+  8029b3:	5f                   	pop    %edi
+  8029b4:	5d                   	pop    %ebp
+  8029b5:	c3                   	ret
+
+008029b6 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8029b6:	55                   	push   %ebp
+  8029b7:	89 e5                	mov    %esp,%ebp
+  8029b9:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8029bc:	83 3d 14 a0 80 00 00 	cmpl   $0x0,0x80a014
+  8029c3:	74 0a                	je     8029cf <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8029c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c8:	a3 14 a0 80 00       	mov    %eax,0x80a014
+}
+  8029cd:	c9                   	leave
+  8029ce:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  8029cf:	83 ec 04             	sub    $0x4,%esp
+  8029d2:	6a 07                	push   $0x7
+  8029d4:	68 00 f0 bf ee       	push   $0xeebff000
+  8029d9:	6a 00                	push   $0x0
+  8029db:	e8 b1 fb ff ff       	call   802591 <sys_page_alloc>
+  8029e0:	83 c4 10             	add    $0x10,%esp
+  8029e3:	85 c0                	test   %eax,%eax
+  8029e5:	78 28                	js     802a0f <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  8029e7:	83 ec 08             	sub    $0x8,%esp
+  8029ea:	68 21 2a 80 00       	push   $0x802a21
+  8029ef:	6a 00                	push   $0x0
+  8029f1:	e8 96 fe ff ff       	call   80288c <sys_env_set_pgfault_upcall>
+  8029f6:	83 c4 10             	add    $0x10,%esp
+  8029f9:	85 c0                	test   %eax,%eax
+  8029fb:	79 c8                	jns    8029c5 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  8029fd:	50                   	push   %eax
+  8029fe:	68 d8 49 80 00       	push   $0x8049d8
+  802a03:	6a 24                	push   $0x24
+  802a05:	68 ca 49 80 00       	push   $0x8049ca
+  802a0a:	e8 4c f0 ff ff       	call   801a5b <_panic>
+			panic("sys_page_alloc: %e", r);
+  802a0f:	50                   	push   %eax
+  802a10:	68 d8 41 80 00       	push   $0x8041d8
+  802a15:	6a 21                	push   $0x21
+  802a17:	68 ca 49 80 00       	push   $0x8049ca
+  802a1c:	e8 3a f0 ff ff       	call   801a5b <_panic>
+
+00802a21 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802a21:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802a22:	a1 14 a0 80 00       	mov    0x80a014,%eax
+	call *%eax
+  802a27:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802a29:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802a2c:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  802a2f:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  802a33:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  802a36:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  802a3a:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  802a3e:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  802a40:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802a41:	83 c4 04             	add    $0x4,%esp
+	popf
+  802a44:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802a45:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802a46:	c3                   	ret
+
+00802a47 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802a47:	55                   	push   %ebp
+  802a48:	89 e5                	mov    %esp,%ebp
+  802a4a:	57                   	push   %edi
+  802a4b:	56                   	push   %esi
+  802a4c:	53                   	push   %ebx
+  802a4d:	83 ec 18             	sub    $0x18,%esp
+  802a50:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a56:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802a59:	85 db                	test   %ebx,%ebx
+  802a5b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a60:	0f 45 c3             	cmovne %ebx,%eax
+  802a63:	50                   	push   %eax
+  802a64:	e8 ab fe ff ff       	call   802914 <sys_ipc_recv>
+
+	if (from_env_store)
+  802a69:	83 c4 10             	add    $0x10,%esp
+  802a6c:	85 ff                	test   %edi,%edi
+  802a6e:	74 17                	je     802a87 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802a70:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a75:	85 c0                	test   %eax,%eax
+  802a77:	75 0c                	jne    802a85 <ipc_recv+0x3e>
+  802a79:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  802a7f:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802a85:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802a87:	85 f6                	test   %esi,%esi
+  802a89:	74 2e                	je     802ab9 <ipc_recv+0x72>
+		if (!r && pg)
+  802a8b:	85 c0                	test   %eax,%eax
+  802a8d:	75 24                	jne    802ab3 <ipc_recv+0x6c>
+  802a8f:	85 db                	test   %ebx,%ebx
+  802a91:	74 20                	je     802ab3 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802a93:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802a98:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802a9e:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802aa0:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802aa5:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802aab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aae:	5b                   	pop    %ebx
+  802aaf:	5e                   	pop    %esi
+  802ab0:	5f                   	pop    %edi
+  802ab1:	5d                   	pop    %ebp
+  802ab2:	c3                   	ret
+			*perm_store = 0;
+  802ab3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802ab9:	85 c0                	test   %eax,%eax
+  802abb:	75 ee                	jne    802aab <ipc_recv+0x64>
+  802abd:	eb e1                	jmp    802aa0 <ipc_recv+0x59>
+
+00802abf <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802abf:	55                   	push   %ebp
+  802ac0:	89 e5                	mov    %esp,%ebp
+  802ac2:	57                   	push   %edi
+  802ac3:	56                   	push   %esi
+  802ac4:	53                   	push   %ebx
+  802ac5:	83 ec 0c             	sub    $0xc,%esp
+  802ac8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802acb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802ace:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802ad1:	85 db                	test   %ebx,%ebx
+  802ad3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ad8:	0f 44 d8             	cmove  %eax,%ebx
+  802adb:	ff 75 14             	push   0x14(%ebp)
+  802ade:	53                   	push   %ebx
+  802adf:	56                   	push   %esi
+  802ae0:	57                   	push   %edi
+  802ae1:	e8 0b fe ff ff       	call   8028f1 <sys_ipc_try_send_yield>
+  802ae6:	83 c4 10             	add    $0x10,%esp
+  802ae9:	85 c0                	test   %eax,%eax
+  802aeb:	79 1e                	jns    802b0b <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802aed:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802af0:	75 07                	jne    802af9 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802af2:	e8 1a fa ff ff       	call   802511 <sys_yield>
+  802af7:	eb e2                	jmp    802adb <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802af9:	50                   	push   %eax
+  802afa:	68 f6 49 80 00       	push   $0x8049f6
+  802aff:	6a 3d                	push   $0x3d
+  802b01:	68 0b 4a 80 00       	push   $0x804a0b
+  802b06:	e8 50 ef ff ff       	call   801a5b <_panic>
+	}
+}
+  802b0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b0e:	5b                   	pop    %ebx
+  802b0f:	5e                   	pop    %esi
+  802b10:	5f                   	pop    %edi
+  802b11:	5d                   	pop    %ebp
+  802b12:	c3                   	ret
+
+00802b13 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b13:	55                   	push   %ebp
+  802b14:	89 e5                	mov    %esp,%ebp
+  802b16:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802b19:	ff 75 08             	push   0x8(%ebp)
+  802b1c:	e8 70 f9 ff ff       	call   802491 <sys_env_find>
+}
+  802b21:	c9                   	leave
+  802b22:	c3                   	ret
+
+00802b23 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  802b23:	55                   	push   %ebp
+  802b24:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802b26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b29:	05 00 00 00 30       	add    $0x30000000,%eax
+  802b2e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802b31:	5d                   	pop    %ebp
+  802b32:	c3                   	ret
+
+00802b33 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802b33:	55                   	push   %ebp
+  802b34:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b39:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802b3e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802b43:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802b48:	5d                   	pop    %ebp
+  802b49:	c3                   	ret
+
+00802b4a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802b4a:	55                   	push   %ebp
+  802b4b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802b4d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802b52:	eb 02                	jmp    802b56 <fd_alloc+0xc>
+  802b54:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802b56:	89 c2                	mov    %eax,%edx
+  802b58:	c1 ea 16             	shr    $0x16,%edx
+  802b5b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802b62:	f6 c2 01             	test   $0x1,%dl
+  802b65:	74 2b                	je     802b92 <fd_alloc+0x48>
+  802b67:	89 c2                	mov    %eax,%edx
+  802b69:	c1 ea 0c             	shr    $0xc,%edx
+  802b6c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802b73:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802b79:	f6 c1 01             	test   $0x1,%cl
+  802b7c:	74 14                	je     802b92 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  802b7e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802b84:	75 ce                	jne    802b54 <fd_alloc+0xa>
+  802b86:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802b8b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802b90:	eb 05                	jmp    802b97 <fd_alloc+0x4d>
+			return 0;
+  802b92:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802b97:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b9a:	89 02                	mov    %eax,(%edx)
+}
+  802b9c:	89 c8                	mov    %ecx,%eax
+  802b9e:	5d                   	pop    %ebp
+  802b9f:	c3                   	ret
+
+00802ba0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802ba0:	55                   	push   %ebp
+  802ba1:	89 e5                	mov    %esp,%ebp
+  802ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802ba6:	83 f8 1f             	cmp    $0x1f,%eax
+  802ba9:	77 30                	ja     802bdb <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802bab:	c1 e0 0c             	shl    $0xc,%eax
+  802bae:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802bb3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802bb9:	f6 c2 01             	test   $0x1,%dl
+  802bbc:	74 24                	je     802be2 <fd_lookup+0x42>
+  802bbe:	89 c2                	mov    %eax,%edx
+  802bc0:	c1 ea 0c             	shr    $0xc,%edx
+  802bc3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802bca:	f6 c2 01             	test   $0x1,%dl
+  802bcd:	74 1a                	je     802be9 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802bcf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bd2:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bd9:	5d                   	pop    %ebp
+  802bda:	c3                   	ret
+		return -E_INVAL;
+  802bdb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802be0:	eb f7                	jmp    802bd9 <fd_lookup+0x39>
+		return -E_INVAL;
+  802be2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802be7:	eb f0                	jmp    802bd9 <fd_lookup+0x39>
+  802be9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bee:	eb e9                	jmp    802bd9 <fd_lookup+0x39>
+
+00802bf0 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802bf0:	55                   	push   %ebp
+  802bf1:	89 e5                	mov    %esp,%ebp
+  802bf3:	53                   	push   %ebx
+  802bf4:	83 ec 04             	sub    $0x4,%esp
+  802bf7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bff:	eb 03                	jmp    802c04 <dev_lookup+0x14>
+  802c01:	83 c0 01             	add    $0x1,%eax
+  802c04:	8b 1c 85 94 4a 80 00 	mov    0x804a94(,%eax,4),%ebx
+  802c0b:	85 db                	test   %ebx,%ebx
+  802c0d:	74 0b                	je     802c1a <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802c0f:	39 13                	cmp    %edx,(%ebx)
+  802c11:	75 ee                	jne    802c01 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c18:	eb 1f                	jmp    802c39 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802c1a:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802c1f:	8b 40 4c             	mov    0x4c(%eax),%eax
+  802c22:	83 ec 04             	sub    $0x4,%esp
+  802c25:	52                   	push   %edx
+  802c26:	50                   	push   %eax
+  802c27:	68 18 4a 80 00       	push   $0x804a18
+  802c2c:	e8 05 ef ff ff       	call   801b36 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802c31:	83 c4 10             	add    $0x10,%esp
+  802c34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802c39:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c3c:	89 1a                	mov    %ebx,(%edx)
+}
+  802c3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c41:	c9                   	leave
+  802c42:	c3                   	ret
+
+00802c43 <fd_close>:
+{
+  802c43:	55                   	push   %ebp
+  802c44:	89 e5                	mov    %esp,%ebp
+  802c46:	57                   	push   %edi
+  802c47:	56                   	push   %esi
+  802c48:	53                   	push   %ebx
+  802c49:	83 ec 24             	sub    $0x24,%esp
+  802c4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c4f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802c52:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802c55:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802c56:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802c5c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802c5f:	50                   	push   %eax
+  802c60:	e8 3b ff ff ff       	call   802ba0 <fd_lookup>
+  802c65:	89 c3                	mov    %eax,%ebx
+  802c67:	83 c4 10             	add    $0x10,%esp
+  802c6a:	85 c0                	test   %eax,%eax
+  802c6c:	78 05                	js     802c73 <fd_close+0x30>
+	    || fd != fd2)
+  802c6e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802c71:	74 16                	je     802c89 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802c73:	89 f8                	mov    %edi,%eax
+  802c75:	84 c0                	test   %al,%al
+  802c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  802c7f:	89 d8                	mov    %ebx,%eax
+  802c81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c84:	5b                   	pop    %ebx
+  802c85:	5e                   	pop    %esi
+  802c86:	5f                   	pop    %edi
+  802c87:	5d                   	pop    %ebp
+  802c88:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802c89:	83 ec 08             	sub    $0x8,%esp
+  802c8c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802c8f:	50                   	push   %eax
+  802c90:	ff 36                	push   (%esi)
+  802c92:	e8 59 ff ff ff       	call   802bf0 <dev_lookup>
+  802c97:	89 c3                	mov    %eax,%ebx
+  802c99:	83 c4 10             	add    $0x10,%esp
+  802c9c:	85 c0                	test   %eax,%eax
+  802c9e:	78 1a                	js     802cba <fd_close+0x77>
+		if (dev->dev_close)
+  802ca0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ca3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802ca6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802cab:	85 c0                	test   %eax,%eax
+  802cad:	74 0b                	je     802cba <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  802caf:	83 ec 0c             	sub    $0xc,%esp
+  802cb2:	56                   	push   %esi
+  802cb3:	ff d0                	call   *%eax
+  802cb5:	89 c3                	mov    %eax,%ebx
+  802cb7:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802cba:	83 ec 08             	sub    $0x8,%esp
+  802cbd:	56                   	push   %esi
+  802cbe:	6a 00                	push   $0x0
+  802cc0:	e8 94 f9 ff ff       	call   802659 <sys_page_unmap>
+	return r;
+  802cc5:	83 c4 10             	add    $0x10,%esp
+  802cc8:	eb b5                	jmp    802c7f <fd_close+0x3c>
+
+00802cca <close>:
+
+int
+close(int fdnum)
+{
+  802cca:	55                   	push   %ebp
+  802ccb:	89 e5                	mov    %esp,%ebp
+  802ccd:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cd0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cd3:	50                   	push   %eax
+  802cd4:	ff 75 08             	push   0x8(%ebp)
+  802cd7:	e8 c4 fe ff ff       	call   802ba0 <fd_lookup>
+  802cdc:	83 c4 10             	add    $0x10,%esp
+  802cdf:	85 c0                	test   %eax,%eax
+  802ce1:	79 02                	jns    802ce5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802ce3:	c9                   	leave
+  802ce4:	c3                   	ret
+		return fd_close(fd, 1);
+  802ce5:	83 ec 08             	sub    $0x8,%esp
+  802ce8:	6a 01                	push   $0x1
+  802cea:	ff 75 f4             	push   -0xc(%ebp)
+  802ced:	e8 51 ff ff ff       	call   802c43 <fd_close>
+  802cf2:	83 c4 10             	add    $0x10,%esp
+  802cf5:	eb ec                	jmp    802ce3 <close+0x19>
+
+00802cf7 <close_all>:
+
+void
+close_all(void)
+{
+  802cf7:	55                   	push   %ebp
+  802cf8:	89 e5                	mov    %esp,%ebp
+  802cfa:	53                   	push   %ebx
+  802cfb:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802cfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802d03:	83 ec 0c             	sub    $0xc,%esp
+  802d06:	53                   	push   %ebx
+  802d07:	e8 be ff ff ff       	call   802cca <close>
+	for (i = 0; i < MAXFD; i++)
+  802d0c:	83 c3 01             	add    $0x1,%ebx
+  802d0f:	83 c4 10             	add    $0x10,%esp
+  802d12:	83 fb 20             	cmp    $0x20,%ebx
+  802d15:	75 ec                	jne    802d03 <close_all+0xc>
+}
+  802d17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d1a:	c9                   	leave
+  802d1b:	c3                   	ret
+
+00802d1c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802d1c:	55                   	push   %ebp
+  802d1d:	89 e5                	mov    %esp,%ebp
+  802d1f:	57                   	push   %edi
+  802d20:	56                   	push   %esi
+  802d21:	53                   	push   %ebx
+  802d22:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802d25:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d28:	50                   	push   %eax
+  802d29:	ff 75 08             	push   0x8(%ebp)
+  802d2c:	e8 6f fe ff ff       	call   802ba0 <fd_lookup>
+  802d31:	89 c3                	mov    %eax,%ebx
+  802d33:	83 c4 10             	add    $0x10,%esp
+  802d36:	85 c0                	test   %eax,%eax
+  802d38:	78 7f                	js     802db9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802d3a:	83 ec 0c             	sub    $0xc,%esp
+  802d3d:	ff 75 0c             	push   0xc(%ebp)
+  802d40:	e8 85 ff ff ff       	call   802cca <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802d45:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d48:	c1 e6 0c             	shl    $0xc,%esi
+  802d4b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802d51:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802d54:	89 3c 24             	mov    %edi,(%esp)
+  802d57:	e8 d7 fd ff ff       	call   802b33 <fd2data>
+  802d5c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802d5e:	89 34 24             	mov    %esi,(%esp)
+  802d61:	e8 cd fd ff ff       	call   802b33 <fd2data>
+  802d66:	83 c4 10             	add    $0x10,%esp
+  802d69:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802d6c:	89 d8                	mov    %ebx,%eax
+  802d6e:	c1 e8 16             	shr    $0x16,%eax
+  802d71:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802d78:	a8 01                	test   $0x1,%al
+  802d7a:	74 11                	je     802d8d <dup+0x71>
+  802d7c:	89 d8                	mov    %ebx,%eax
+  802d7e:	c1 e8 0c             	shr    $0xc,%eax
+  802d81:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802d88:	f6 c2 01             	test   $0x1,%dl
+  802d8b:	75 36                	jne    802dc3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802d8d:	89 f8                	mov    %edi,%eax
+  802d8f:	c1 e8 0c             	shr    $0xc,%eax
+  802d92:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802d99:	83 ec 0c             	sub    $0xc,%esp
+  802d9c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802da1:	50                   	push   %eax
+  802da2:	56                   	push   %esi
+  802da3:	6a 00                	push   $0x0
+  802da5:	57                   	push   %edi
+  802da6:	6a 00                	push   $0x0
+  802da8:	e8 6a f8 ff ff       	call   802617 <sys_page_map>
+  802dad:	89 c3                	mov    %eax,%ebx
+  802daf:	83 c4 20             	add    $0x20,%esp
+  802db2:	85 c0                	test   %eax,%eax
+  802db4:	78 33                	js     802de9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802db6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802db9:	89 d8                	mov    %ebx,%eax
+  802dbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dbe:	5b                   	pop    %ebx
+  802dbf:	5e                   	pop    %esi
+  802dc0:	5f                   	pop    %edi
+  802dc1:	5d                   	pop    %ebp
+  802dc2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802dc3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802dca:	83 ec 0c             	sub    $0xc,%esp
+  802dcd:	25 07 0e 00 00       	and    $0xe07,%eax
+  802dd2:	50                   	push   %eax
+  802dd3:	ff 75 d4             	push   -0x2c(%ebp)
+  802dd6:	6a 00                	push   $0x0
+  802dd8:	53                   	push   %ebx
+  802dd9:	6a 00                	push   $0x0
+  802ddb:	e8 37 f8 ff ff       	call   802617 <sys_page_map>
+  802de0:	89 c3                	mov    %eax,%ebx
+  802de2:	83 c4 20             	add    $0x20,%esp
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	79 a4                	jns    802d8d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802de9:	83 ec 08             	sub    $0x8,%esp
+  802dec:	56                   	push   %esi
+  802ded:	6a 00                	push   $0x0
+  802def:	e8 65 f8 ff ff       	call   802659 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802df4:	83 c4 08             	add    $0x8,%esp
+  802df7:	ff 75 d4             	push   -0x2c(%ebp)
+  802dfa:	6a 00                	push   $0x0
+  802dfc:	e8 58 f8 ff ff       	call   802659 <sys_page_unmap>
+	return r;
+  802e01:	83 c4 10             	add    $0x10,%esp
+  802e04:	eb b3                	jmp    802db9 <dup+0x9d>
+
+00802e06 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802e06:	55                   	push   %ebp
+  802e07:	89 e5                	mov    %esp,%ebp
+  802e09:	56                   	push   %esi
+  802e0a:	53                   	push   %ebx
+  802e0b:	83 ec 18             	sub    $0x18,%esp
+  802e0e:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802e11:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e14:	50                   	push   %eax
+  802e15:	56                   	push   %esi
+  802e16:	e8 85 fd ff ff       	call   802ba0 <fd_lookup>
+  802e1b:	83 c4 10             	add    $0x10,%esp
+  802e1e:	85 c0                	test   %eax,%eax
+  802e20:	78 3c                	js     802e5e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802e22:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802e25:	83 ec 08             	sub    $0x8,%esp
+  802e28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e2b:	50                   	push   %eax
+  802e2c:	ff 33                	push   (%ebx)
+  802e2e:	e8 bd fd ff ff       	call   802bf0 <dev_lookup>
+  802e33:	83 c4 10             	add    $0x10,%esp
+  802e36:	85 c0                	test   %eax,%eax
+  802e38:	78 24                	js     802e5e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802e3a:	8b 43 08             	mov    0x8(%ebx),%eax
+  802e3d:	83 e0 03             	and    $0x3,%eax
+  802e40:	83 f8 01             	cmp    $0x1,%eax
+  802e43:	74 20                	je     802e65 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802e45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e48:	8b 40 08             	mov    0x8(%eax),%eax
+  802e4b:	85 c0                	test   %eax,%eax
+  802e4d:	74 37                	je     802e86 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802e4f:	83 ec 04             	sub    $0x4,%esp
+  802e52:	ff 75 10             	push   0x10(%ebp)
+  802e55:	ff 75 0c             	push   0xc(%ebp)
+  802e58:	53                   	push   %ebx
+  802e59:	ff d0                	call   *%eax
+  802e5b:	83 c4 10             	add    $0x10,%esp
+}
+  802e5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e61:	5b                   	pop    %ebx
+  802e62:	5e                   	pop    %esi
+  802e63:	5d                   	pop    %ebp
+  802e64:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802e65:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802e6a:	8b 40 4c             	mov    0x4c(%eax),%eax
+  802e6d:	83 ec 04             	sub    $0x4,%esp
+  802e70:	56                   	push   %esi
+  802e71:	50                   	push   %eax
+  802e72:	68 59 4a 80 00       	push   $0x804a59
+  802e77:	e8 ba ec ff ff       	call   801b36 <cprintf>
+		return -E_INVAL;
+  802e7c:	83 c4 10             	add    $0x10,%esp
+  802e7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e84:	eb d8                	jmp    802e5e <read+0x58>
+		return -E_NOT_SUPP;
+  802e86:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802e8b:	eb d1                	jmp    802e5e <read+0x58>
+
+00802e8d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802e8d:	55                   	push   %ebp
+  802e8e:	89 e5                	mov    %esp,%ebp
+  802e90:	57                   	push   %edi
+  802e91:	56                   	push   %esi
+  802e92:	53                   	push   %ebx
+  802e93:	83 ec 0c             	sub    $0xc,%esp
+  802e96:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e99:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802e9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ea1:	eb 02                	jmp    802ea5 <readn+0x18>
+  802ea3:	01 c3                	add    %eax,%ebx
+  802ea5:	39 f3                	cmp    %esi,%ebx
+  802ea7:	73 21                	jae    802eca <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802ea9:	83 ec 04             	sub    $0x4,%esp
+  802eac:	89 f0                	mov    %esi,%eax
+  802eae:	29 d8                	sub    %ebx,%eax
+  802eb0:	50                   	push   %eax
+  802eb1:	89 d8                	mov    %ebx,%eax
+  802eb3:	03 45 0c             	add    0xc(%ebp),%eax
+  802eb6:	50                   	push   %eax
+  802eb7:	57                   	push   %edi
+  802eb8:	e8 49 ff ff ff       	call   802e06 <read>
+		if (m < 0)
+  802ebd:	83 c4 10             	add    $0x10,%esp
+  802ec0:	85 c0                	test   %eax,%eax
+  802ec2:	78 04                	js     802ec8 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802ec4:	75 dd                	jne    802ea3 <readn+0x16>
+  802ec6:	eb 02                	jmp    802eca <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802ec8:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802eca:	89 d8                	mov    %ebx,%eax
+  802ecc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ecf:	5b                   	pop    %ebx
+  802ed0:	5e                   	pop    %esi
+  802ed1:	5f                   	pop    %edi
+  802ed2:	5d                   	pop    %ebp
+  802ed3:	c3                   	ret
+
+00802ed4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802ed4:	55                   	push   %ebp
+  802ed5:	89 e5                	mov    %esp,%ebp
+  802ed7:	56                   	push   %esi
+  802ed8:	53                   	push   %ebx
+  802ed9:	83 ec 18             	sub    $0x18,%esp
+  802edc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802edf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802ee2:	50                   	push   %eax
+  802ee3:	53                   	push   %ebx
+  802ee4:	e8 b7 fc ff ff       	call   802ba0 <fd_lookup>
+  802ee9:	83 c4 10             	add    $0x10,%esp
+  802eec:	85 c0                	test   %eax,%eax
+  802eee:	78 37                	js     802f27 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802ef0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802ef3:	83 ec 08             	sub    $0x8,%esp
+  802ef6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ef9:	50                   	push   %eax
+  802efa:	ff 36                	push   (%esi)
+  802efc:	e8 ef fc ff ff       	call   802bf0 <dev_lookup>
+  802f01:	83 c4 10             	add    $0x10,%esp
+  802f04:	85 c0                	test   %eax,%eax
+  802f06:	78 1f                	js     802f27 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802f08:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802f0c:	74 20                	je     802f2e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802f0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f11:	8b 40 0c             	mov    0xc(%eax),%eax
+  802f14:	85 c0                	test   %eax,%eax
+  802f16:	74 37                	je     802f4f <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802f18:	83 ec 04             	sub    $0x4,%esp
+  802f1b:	ff 75 10             	push   0x10(%ebp)
+  802f1e:	ff 75 0c             	push   0xc(%ebp)
+  802f21:	56                   	push   %esi
+  802f22:	ff d0                	call   *%eax
+  802f24:	83 c4 10             	add    $0x10,%esp
+}
+  802f27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f2a:	5b                   	pop    %ebx
+  802f2b:	5e                   	pop    %esi
+  802f2c:	5d                   	pop    %ebp
+  802f2d:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802f2e:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802f33:	8b 40 4c             	mov    0x4c(%eax),%eax
+  802f36:	83 ec 04             	sub    $0x4,%esp
+  802f39:	53                   	push   %ebx
+  802f3a:	50                   	push   %eax
+  802f3b:	68 75 4a 80 00       	push   $0x804a75
+  802f40:	e8 f1 eb ff ff       	call   801b36 <cprintf>
+		return -E_INVAL;
+  802f45:	83 c4 10             	add    $0x10,%esp
+  802f48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f4d:	eb d8                	jmp    802f27 <write+0x53>
+		return -E_NOT_SUPP;
+  802f4f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f54:	eb d1                	jmp    802f27 <write+0x53>
+
+00802f56 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802f56:	55                   	push   %ebp
+  802f57:	89 e5                	mov    %esp,%ebp
+  802f59:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f5c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f5f:	50                   	push   %eax
+  802f60:	ff 75 08             	push   0x8(%ebp)
+  802f63:	e8 38 fc ff ff       	call   802ba0 <fd_lookup>
+  802f68:	83 c4 10             	add    $0x10,%esp
+  802f6b:	85 c0                	test   %eax,%eax
+  802f6d:	78 0e                	js     802f7d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802f6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f75:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802f78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f7d:	c9                   	leave
+  802f7e:	c3                   	ret
+
+00802f7f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802f7f:	55                   	push   %ebp
+  802f80:	89 e5                	mov    %esp,%ebp
+  802f82:	56                   	push   %esi
+  802f83:	53                   	push   %ebx
+  802f84:	83 ec 18             	sub    $0x18,%esp
+  802f87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802f8a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802f8d:	50                   	push   %eax
+  802f8e:	53                   	push   %ebx
+  802f8f:	e8 0c fc ff ff       	call   802ba0 <fd_lookup>
+  802f94:	83 c4 10             	add    $0x10,%esp
+  802f97:	85 c0                	test   %eax,%eax
+  802f99:	78 34                	js     802fcf <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802f9b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802f9e:	83 ec 08             	sub    $0x8,%esp
+  802fa1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fa4:	50                   	push   %eax
+  802fa5:	ff 36                	push   (%esi)
+  802fa7:	e8 44 fc ff ff       	call   802bf0 <dev_lookup>
+  802fac:	83 c4 10             	add    $0x10,%esp
+  802faf:	85 c0                	test   %eax,%eax
+  802fb1:	78 1c                	js     802fcf <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802fb3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802fb7:	74 1d                	je     802fd6 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802fb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fbc:	8b 40 18             	mov    0x18(%eax),%eax
+  802fbf:	85 c0                	test   %eax,%eax
+  802fc1:	74 34                	je     802ff7 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802fc3:	83 ec 08             	sub    $0x8,%esp
+  802fc6:	ff 75 0c             	push   0xc(%ebp)
+  802fc9:	56                   	push   %esi
+  802fca:	ff d0                	call   *%eax
+  802fcc:	83 c4 10             	add    $0x10,%esp
+}
+  802fcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fd2:	5b                   	pop    %ebx
+  802fd3:	5e                   	pop    %esi
+  802fd4:	5d                   	pop    %ebp
+  802fd5:	c3                   	ret
+			thisenv->env_id, fdnum);
+  802fd6:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802fdb:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802fde:	83 ec 04             	sub    $0x4,%esp
+  802fe1:	53                   	push   %ebx
+  802fe2:	50                   	push   %eax
+  802fe3:	68 38 4a 80 00       	push   $0x804a38
+  802fe8:	e8 49 eb ff ff       	call   801b36 <cprintf>
+		return -E_INVAL;
+  802fed:	83 c4 10             	add    $0x10,%esp
+  802ff0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ff5:	eb d8                	jmp    802fcf <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802ff7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ffc:	eb d1                	jmp    802fcf <ftruncate+0x50>
+
+00802ffe <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802ffe:	55                   	push   %ebp
+  802fff:	89 e5                	mov    %esp,%ebp
+  803001:	56                   	push   %esi
+  803002:	53                   	push   %ebx
+  803003:	83 ec 18             	sub    $0x18,%esp
+  803006:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803009:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80300c:	50                   	push   %eax
+  80300d:	ff 75 08             	push   0x8(%ebp)
+  803010:	e8 8b fb ff ff       	call   802ba0 <fd_lookup>
+  803015:	83 c4 10             	add    $0x10,%esp
+  803018:	85 c0                	test   %eax,%eax
+  80301a:	78 49                	js     803065 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80301c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80301f:	83 ec 08             	sub    $0x8,%esp
+  803022:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803025:	50                   	push   %eax
+  803026:	ff 36                	push   (%esi)
+  803028:	e8 c3 fb ff ff       	call   802bf0 <dev_lookup>
+  80302d:	83 c4 10             	add    $0x10,%esp
+  803030:	85 c0                	test   %eax,%eax
+  803032:	78 31                	js     803065 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  803034:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803037:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80303b:	74 2f                	je     80306c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80303d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  803040:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  803047:	00 00 00 
+	stat->st_isdir = 0;
+  80304a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803051:	00 00 00 
+	stat->st_dev = dev;
+  803054:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80305a:	83 ec 08             	sub    $0x8,%esp
+  80305d:	53                   	push   %ebx
+  80305e:	56                   	push   %esi
+  80305f:	ff 50 14             	call   *0x14(%eax)
+  803062:	83 c4 10             	add    $0x10,%esp
+}
+  803065:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803068:	5b                   	pop    %ebx
+  803069:	5e                   	pop    %esi
+  80306a:	5d                   	pop    %ebp
+  80306b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80306c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803071:	eb f2                	jmp    803065 <fstat+0x67>
+
+00803073 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803073:	55                   	push   %ebp
+  803074:	89 e5                	mov    %esp,%ebp
+  803076:	56                   	push   %esi
+  803077:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803078:	83 ec 08             	sub    $0x8,%esp
+  80307b:	6a 00                	push   $0x0
+  80307d:	ff 75 08             	push   0x8(%ebp)
+  803080:	e8 e4 01 00 00       	call   803269 <open>
+  803085:	89 c3                	mov    %eax,%ebx
+  803087:	83 c4 10             	add    $0x10,%esp
+  80308a:	85 c0                	test   %eax,%eax
+  80308c:	78 1b                	js     8030a9 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80308e:	83 ec 08             	sub    $0x8,%esp
+  803091:	ff 75 0c             	push   0xc(%ebp)
+  803094:	50                   	push   %eax
+  803095:	e8 64 ff ff ff       	call   802ffe <fstat>
+  80309a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80309c:	89 1c 24             	mov    %ebx,(%esp)
+  80309f:	e8 26 fc ff ff       	call   802cca <close>
+	return r;
+  8030a4:	83 c4 10             	add    $0x10,%esp
+  8030a7:	89 f3                	mov    %esi,%ebx
+}
+  8030a9:	89 d8                	mov    %ebx,%eax
+  8030ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030ae:	5b                   	pop    %ebx
+  8030af:	5e                   	pop    %esi
+  8030b0:	5d                   	pop    %ebp
+  8030b1:	c3                   	ret
+
+008030b2 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8030b2:	55                   	push   %ebp
+  8030b3:	89 e5                	mov    %esp,%ebp
+  8030b5:	56                   	push   %esi
+  8030b6:	53                   	push   %ebx
+  8030b7:	89 c6                	mov    %eax,%esi
+  8030b9:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8030bb:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8030c2:	74 27                	je     8030eb <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8030c4:	6a 07                	push   $0x7
+  8030c6:	68 00 b0 80 00       	push   $0x80b000
+  8030cb:	56                   	push   %esi
+  8030cc:	ff 35 00 a0 80 00    	push   0x80a000
+  8030d2:	e8 e8 f9 ff ff       	call   802abf <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8030d7:	83 c4 0c             	add    $0xc,%esp
+  8030da:	6a 00                	push   $0x0
+  8030dc:	53                   	push   %ebx
+  8030dd:	6a 00                	push   $0x0
+  8030df:	e8 63 f9 ff ff       	call   802a47 <ipc_recv>
+}
+  8030e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030e7:	5b                   	pop    %ebx
+  8030e8:	5e                   	pop    %esi
+  8030e9:	5d                   	pop    %ebp
+  8030ea:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8030eb:	83 ec 0c             	sub    $0xc,%esp
+  8030ee:	6a 01                	push   $0x1
+  8030f0:	e8 1e fa ff ff       	call   802b13 <ipc_find_env>
+  8030f5:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  8030fa:	83 c4 10             	add    $0x10,%esp
+  8030fd:	eb c5                	jmp    8030c4 <fsipc+0x12>
+
+008030ff <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8030ff:	55                   	push   %ebp
+  803100:	89 e5                	mov    %esp,%ebp
+  803102:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803105:	8b 45 08             	mov    0x8(%ebp),%eax
+  803108:	8b 40 0c             	mov    0xc(%eax),%eax
+  80310b:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	fsipcbuf.set_size.req_size = newsize;
+  803110:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803113:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  803118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80311d:	b8 02 00 00 00       	mov    $0x2,%eax
+  803122:	e8 8b ff ff ff       	call   8030b2 <fsipc>
+}
+  803127:	c9                   	leave
+  803128:	c3                   	ret
+
+00803129 <devfile_flush>:
+{
+  803129:	55                   	push   %ebp
+  80312a:	89 e5                	mov    %esp,%ebp
+  80312c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80312f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803132:	8b 40 0c             	mov    0xc(%eax),%eax
+  803135:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80313a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313f:	b8 06 00 00 00       	mov    $0x6,%eax
+  803144:	e8 69 ff ff ff       	call   8030b2 <fsipc>
+}
+  803149:	c9                   	leave
+  80314a:	c3                   	ret
+
+0080314b <devfile_stat>:
+{
+  80314b:	55                   	push   %ebp
+  80314c:	89 e5                	mov    %esp,%ebp
+  80314e:	53                   	push   %ebx
+  80314f:	83 ec 04             	sub    $0x4,%esp
+  803152:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803155:	8b 45 08             	mov    0x8(%ebp),%eax
+  803158:	8b 40 0c             	mov    0xc(%eax),%eax
+  80315b:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803160:	ba 00 00 00 00       	mov    $0x0,%edx
+  803165:	b8 05 00 00 00       	mov    $0x5,%eax
+  80316a:	e8 43 ff ff ff       	call   8030b2 <fsipc>
+  80316f:	85 c0                	test   %eax,%eax
+  803171:	78 2c                	js     80319f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803173:	83 ec 08             	sub    $0x8,%esp
+  803176:	68 00 b0 80 00       	push   $0x80b000
+  80317b:	53                   	push   %ebx
+  80317c:	e8 a3 ef ff ff       	call   802124 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803181:	a1 80 b0 80 00       	mov    0x80b080,%eax
+  803186:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80318c:	a1 84 b0 80 00       	mov    0x80b084,%eax
+  803191:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  803197:	83 c4 10             	add    $0x10,%esp
+  80319a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80319f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031a2:	c9                   	leave
+  8031a3:	c3                   	ret
+
+008031a4 <devfile_write>:
+{
+  8031a4:	55                   	push   %ebp
+  8031a5:	89 e5                	mov    %esp,%ebp
+  8031a7:	83 ec 0c             	sub    $0xc,%esp
+  8031aa:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8031ad:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8031b2:	39 d0                	cmp    %edx,%eax
+  8031b4:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8031b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031ba:	8b 52 0c             	mov    0xc(%edx),%edx
+  8031bd:	89 15 00 b0 80 00    	mov    %edx,0x80b000
+	fsipcbuf.write.req_n = n;
+  8031c3:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8031c8:	50                   	push   %eax
+  8031c9:	ff 75 0c             	push   0xc(%ebp)
+  8031cc:	68 08 b0 80 00       	push   $0x80b008
+  8031d1:	e8 d4 f0 ff ff       	call   8022aa <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8031d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031db:	b8 04 00 00 00       	mov    $0x4,%eax
+  8031e0:	e8 cd fe ff ff       	call   8030b2 <fsipc>
+}
+  8031e5:	c9                   	leave
+  8031e6:	c3                   	ret
+
+008031e7 <devfile_read>:
+{
+  8031e7:	55                   	push   %ebp
+  8031e8:	89 e5                	mov    %esp,%ebp
+  8031ea:	56                   	push   %esi
+  8031eb:	53                   	push   %ebx
+  8031ec:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8031ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8031f5:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	fsipcbuf.read.req_n = n;
+  8031fa:	89 35 04 b0 80 00    	mov    %esi,0x80b004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  803200:	ba 00 00 00 00       	mov    $0x0,%edx
+  803205:	b8 03 00 00 00       	mov    $0x3,%eax
+  80320a:	e8 a3 fe ff ff       	call   8030b2 <fsipc>
+  80320f:	89 c3                	mov    %eax,%ebx
+  803211:	85 c0                	test   %eax,%eax
+  803213:	78 1f                	js     803234 <devfile_read+0x4d>
+	assert(r <= n);
+  803215:	39 c6                	cmp    %eax,%esi
+  803217:	72 24                	jb     80323d <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  803219:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80321e:	7f 33                	jg     803253 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  803220:	83 ec 04             	sub    $0x4,%esp
+  803223:	50                   	push   %eax
+  803224:	68 00 b0 80 00       	push   $0x80b000
+  803229:	ff 75 0c             	push   0xc(%ebp)
+  80322c:	e8 79 f0 ff ff       	call   8022aa <memmove>
+	return r;
+  803231:	83 c4 10             	add    $0x10,%esp
+}
+  803234:	89 d8                	mov    %ebx,%eax
+  803236:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803239:	5b                   	pop    %ebx
+  80323a:	5e                   	pop    %esi
+  80323b:	5d                   	pop    %ebp
+  80323c:	c3                   	ret
+	assert(r <= n);
+  80323d:	68 a8 4a 80 00       	push   $0x804aa8
+  803242:	68 fd 40 80 00       	push   $0x8040fd
+  803247:	6a 7c                	push   $0x7c
+  803249:	68 af 4a 80 00       	push   $0x804aaf
+  80324e:	e8 08 e8 ff ff       	call   801a5b <_panic>
+	assert(r <= PGSIZE);
+  803253:	68 ba 4a 80 00       	push   $0x804aba
+  803258:	68 fd 40 80 00       	push   $0x8040fd
+  80325d:	6a 7d                	push   $0x7d
+  80325f:	68 af 4a 80 00       	push   $0x804aaf
+  803264:	e8 f2 e7 ff ff       	call   801a5b <_panic>
+
+00803269 <open>:
+{
+  803269:	55                   	push   %ebp
+  80326a:	89 e5                	mov    %esp,%ebp
+  80326c:	56                   	push   %esi
+  80326d:	53                   	push   %ebx
+  80326e:	83 ec 1c             	sub    $0x1c,%esp
+  803271:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  803274:	56                   	push   %esi
+  803275:	e8 6f ee ff ff       	call   8020e9 <strlen>
+  80327a:	83 c4 10             	add    $0x10,%esp
+  80327d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803282:	7f 6c                	jg     8032f0 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  803284:	83 ec 0c             	sub    $0xc,%esp
+  803287:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80328a:	50                   	push   %eax
+  80328b:	e8 ba f8 ff ff       	call   802b4a <fd_alloc>
+  803290:	89 c3                	mov    %eax,%ebx
+  803292:	83 c4 10             	add    $0x10,%esp
+  803295:	85 c0                	test   %eax,%eax
+  803297:	78 3c                	js     8032d5 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  803299:	83 ec 08             	sub    $0x8,%esp
+  80329c:	56                   	push   %esi
+  80329d:	68 00 b0 80 00       	push   $0x80b000
+  8032a2:	e8 7d ee ff ff       	call   802124 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8032a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032aa:	a3 00 b4 80 00       	mov    %eax,0x80b400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8032af:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032b7:	e8 f6 fd ff ff       	call   8030b2 <fsipc>
+  8032bc:	89 c3                	mov    %eax,%ebx
+  8032be:	83 c4 10             	add    $0x10,%esp
+  8032c1:	85 c0                	test   %eax,%eax
+  8032c3:	78 19                	js     8032de <open+0x75>
+	return fd2num(fd);
+  8032c5:	83 ec 0c             	sub    $0xc,%esp
+  8032c8:	ff 75 f4             	push   -0xc(%ebp)
+  8032cb:	e8 53 f8 ff ff       	call   802b23 <fd2num>
+  8032d0:	89 c3                	mov    %eax,%ebx
+  8032d2:	83 c4 10             	add    $0x10,%esp
+}
+  8032d5:	89 d8                	mov    %ebx,%eax
+  8032d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032da:	5b                   	pop    %ebx
+  8032db:	5e                   	pop    %esi
+  8032dc:	5d                   	pop    %ebp
+  8032dd:	c3                   	ret
+		fd_close(fd, 0);
+  8032de:	83 ec 08             	sub    $0x8,%esp
+  8032e1:	6a 00                	push   $0x0
+  8032e3:	ff 75 f4             	push   -0xc(%ebp)
+  8032e6:	e8 58 f9 ff ff       	call   802c43 <fd_close>
+		return r;
+  8032eb:	83 c4 10             	add    $0x10,%esp
+  8032ee:	eb e5                	jmp    8032d5 <open+0x6c>
+		return -E_BAD_PATH;
+  8032f0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8032f5:	eb de                	jmp    8032d5 <open+0x6c>
+
+008032f7 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8032f7:	55                   	push   %ebp
+  8032f8:	89 e5                	mov    %esp,%ebp
+  8032fa:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8032fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803302:	b8 08 00 00 00       	mov    $0x8,%eax
+  803307:	e8 a6 fd ff ff       	call   8030b2 <fsipc>
+}
+  80330c:	c9                   	leave
+  80330d:	c3                   	ret
+
+0080330e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80330e:	55                   	push   %ebp
+  80330f:	89 e5                	mov    %esp,%ebp
+  803311:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803314:	89 c2                	mov    %eax,%edx
+  803316:	c1 ea 16             	shr    $0x16,%edx
+  803319:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803320:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803325:	f6 c1 01             	test   $0x1,%cl
+  803328:	74 22                	je     80334c <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80332a:	c1 e8 0c             	shr    $0xc,%eax
+  80332d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803334:	a8 01                	test   $0x1,%al
+  803336:	74 14                	je     80334c <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803338:	c1 e8 0c             	shr    $0xc,%eax
+  80333b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80333e:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803345:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803349:	0f b7 d2             	movzwl %dx,%edx
+}
+  80334c:	89 d0                	mov    %edx,%eax
+  80334e:	5d                   	pop    %ebp
+  80334f:	c3                   	ret
+
+00803350 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803350:	55                   	push   %ebp
+  803351:	89 e5                	mov    %esp,%ebp
+  803353:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803356:	68 c6 4a 80 00       	push   $0x804ac6
+  80335b:	ff 75 0c             	push   0xc(%ebp)
+  80335e:	e8 c1 ed ff ff       	call   802124 <strcpy>
+	return 0;
+}
+  803363:	b8 00 00 00 00       	mov    $0x0,%eax
+  803368:	c9                   	leave
+  803369:	c3                   	ret
+
+0080336a <devsock_close>:
+{
+  80336a:	55                   	push   %ebp
+  80336b:	89 e5                	mov    %esp,%ebp
+  80336d:	53                   	push   %ebx
+  80336e:	83 ec 10             	sub    $0x10,%esp
+  803371:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803374:	53                   	push   %ebx
+  803375:	e8 94 ff ff ff       	call   80330e <pageref>
+  80337a:	89 c2                	mov    %eax,%edx
+  80337c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80337f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803384:	83 fa 01             	cmp    $0x1,%edx
+  803387:	74 05                	je     80338e <devsock_close+0x24>
+}
+  803389:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80338c:	c9                   	leave
+  80338d:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80338e:	83 ec 0c             	sub    $0xc,%esp
+  803391:	ff 73 0c             	push   0xc(%ebx)
+  803394:	e8 b7 02 00 00       	call   803650 <nsipc_close>
+  803399:	83 c4 10             	add    $0x10,%esp
+  80339c:	eb eb                	jmp    803389 <devsock_close+0x1f>
+
+0080339e <devsock_write>:
+{
+  80339e:	55                   	push   %ebp
+  80339f:	89 e5                	mov    %esp,%ebp
+  8033a1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8033a4:	6a 00                	push   $0x0
+  8033a6:	ff 75 10             	push   0x10(%ebp)
+  8033a9:	ff 75 0c             	push   0xc(%ebp)
+  8033ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033af:	ff 70 0c             	push   0xc(%eax)
+  8033b2:	e8 79 03 00 00       	call   803730 <nsipc_send>
+}
+  8033b7:	c9                   	leave
+  8033b8:	c3                   	ret
+
+008033b9 <devsock_read>:
+{
+  8033b9:	55                   	push   %ebp
+  8033ba:	89 e5                	mov    %esp,%ebp
+  8033bc:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8033bf:	6a 00                	push   $0x0
+  8033c1:	ff 75 10             	push   0x10(%ebp)
+  8033c4:	ff 75 0c             	push   0xc(%ebp)
+  8033c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ca:	ff 70 0c             	push   0xc(%eax)
+  8033cd:	e8 ef 02 00 00       	call   8036c1 <nsipc_recv>
+}
+  8033d2:	c9                   	leave
+  8033d3:	c3                   	ret
+
+008033d4 <fd2sockid>:
+{
+  8033d4:	55                   	push   %ebp
+  8033d5:	89 e5                	mov    %esp,%ebp
+  8033d7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8033da:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033dd:	52                   	push   %edx
+  8033de:	50                   	push   %eax
+  8033df:	e8 bc f7 ff ff       	call   802ba0 <fd_lookup>
+  8033e4:	83 c4 10             	add    $0x10,%esp
+  8033e7:	85 c0                	test   %eax,%eax
+  8033e9:	78 10                	js     8033fb <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8033eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033ee:	8b 0d 80 90 80 00    	mov    0x809080,%ecx
+  8033f4:	39 08                	cmp    %ecx,(%eax)
+  8033f6:	75 05                	jne    8033fd <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8033f8:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8033fb:	c9                   	leave
+  8033fc:	c3                   	ret
+		return -E_NOT_SUPP;
+  8033fd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803402:	eb f7                	jmp    8033fb <fd2sockid+0x27>
+
+00803404 <alloc_sockfd>:
+{
+  803404:	55                   	push   %ebp
+  803405:	89 e5                	mov    %esp,%ebp
+  803407:	56                   	push   %esi
+  803408:	53                   	push   %ebx
+  803409:	83 ec 1c             	sub    $0x1c,%esp
+  80340c:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80340e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803411:	50                   	push   %eax
+  803412:	e8 33 f7 ff ff       	call   802b4a <fd_alloc>
+  803417:	89 c3                	mov    %eax,%ebx
+  803419:	83 c4 10             	add    $0x10,%esp
+  80341c:	85 c0                	test   %eax,%eax
+  80341e:	78 43                	js     803463 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803420:	83 ec 04             	sub    $0x4,%esp
+  803423:	68 07 04 00 00       	push   $0x407
+  803428:	ff 75 f4             	push   -0xc(%ebp)
+  80342b:	6a 00                	push   $0x0
+  80342d:	e8 5f f1 ff ff       	call   802591 <sys_page_alloc>
+  803432:	89 c3                	mov    %eax,%ebx
+  803434:	83 c4 10             	add    $0x10,%esp
+  803437:	85 c0                	test   %eax,%eax
+  803439:	78 28                	js     803463 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80343b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80343e:	8b 15 80 90 80 00    	mov    0x809080,%edx
+  803444:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803446:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803449:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803450:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803453:	83 ec 0c             	sub    $0xc,%esp
+  803456:	50                   	push   %eax
+  803457:	e8 c7 f6 ff ff       	call   802b23 <fd2num>
+  80345c:	89 c3                	mov    %eax,%ebx
+  80345e:	83 c4 10             	add    $0x10,%esp
+  803461:	eb 0c                	jmp    80346f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803463:	83 ec 0c             	sub    $0xc,%esp
+  803466:	56                   	push   %esi
+  803467:	e8 e4 01 00 00       	call   803650 <nsipc_close>
+		return r;
+  80346c:	83 c4 10             	add    $0x10,%esp
+}
+  80346f:	89 d8                	mov    %ebx,%eax
+  803471:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803474:	5b                   	pop    %ebx
+  803475:	5e                   	pop    %esi
+  803476:	5d                   	pop    %ebp
+  803477:	c3                   	ret
+
+00803478 <accept>:
+{
+  803478:	55                   	push   %ebp
+  803479:	89 e5                	mov    %esp,%ebp
+  80347b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80347e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803481:	e8 4e ff ff ff       	call   8033d4 <fd2sockid>
+  803486:	85 c0                	test   %eax,%eax
+  803488:	78 1b                	js     8034a5 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80348a:	83 ec 04             	sub    $0x4,%esp
+  80348d:	ff 75 10             	push   0x10(%ebp)
+  803490:	ff 75 0c             	push   0xc(%ebp)
+  803493:	50                   	push   %eax
+  803494:	e8 0e 01 00 00       	call   8035a7 <nsipc_accept>
+  803499:	83 c4 10             	add    $0x10,%esp
+  80349c:	85 c0                	test   %eax,%eax
+  80349e:	78 05                	js     8034a5 <accept+0x2d>
+	return alloc_sockfd(r);
+  8034a0:	e8 5f ff ff ff       	call   803404 <alloc_sockfd>
+}
+  8034a5:	c9                   	leave
+  8034a6:	c3                   	ret
+
+008034a7 <bind>:
+{
+  8034a7:	55                   	push   %ebp
+  8034a8:	89 e5                	mov    %esp,%ebp
+  8034aa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8034ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034b0:	e8 1f ff ff ff       	call   8033d4 <fd2sockid>
+  8034b5:	85 c0                	test   %eax,%eax
+  8034b7:	78 12                	js     8034cb <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8034b9:	83 ec 04             	sub    $0x4,%esp
+  8034bc:	ff 75 10             	push   0x10(%ebp)
+  8034bf:	ff 75 0c             	push   0xc(%ebp)
+  8034c2:	50                   	push   %eax
+  8034c3:	e8 31 01 00 00       	call   8035f9 <nsipc_bind>
+  8034c8:	83 c4 10             	add    $0x10,%esp
+}
+  8034cb:	c9                   	leave
+  8034cc:	c3                   	ret
+
+008034cd <shutdown>:
+{
+  8034cd:	55                   	push   %ebp
+  8034ce:	89 e5                	mov    %esp,%ebp
+  8034d0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8034d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034d6:	e8 f9 fe ff ff       	call   8033d4 <fd2sockid>
+  8034db:	85 c0                	test   %eax,%eax
+  8034dd:	78 0f                	js     8034ee <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8034df:	83 ec 08             	sub    $0x8,%esp
+  8034e2:	ff 75 0c             	push   0xc(%ebp)
+  8034e5:	50                   	push   %eax
+  8034e6:	e8 43 01 00 00       	call   80362e <nsipc_shutdown>
+  8034eb:	83 c4 10             	add    $0x10,%esp
+}
+  8034ee:	c9                   	leave
+  8034ef:	c3                   	ret
+
+008034f0 <connect>:
+{
+  8034f0:	55                   	push   %ebp
+  8034f1:	89 e5                	mov    %esp,%ebp
+  8034f3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8034f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034f9:	e8 d6 fe ff ff       	call   8033d4 <fd2sockid>
+  8034fe:	85 c0                	test   %eax,%eax
+  803500:	78 12                	js     803514 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803502:	83 ec 04             	sub    $0x4,%esp
+  803505:	ff 75 10             	push   0x10(%ebp)
+  803508:	ff 75 0c             	push   0xc(%ebp)
+  80350b:	50                   	push   %eax
+  80350c:	e8 59 01 00 00       	call   80366a <nsipc_connect>
+  803511:	83 c4 10             	add    $0x10,%esp
+}
+  803514:	c9                   	leave
+  803515:	c3                   	ret
+
+00803516 <listen>:
+{
+  803516:	55                   	push   %ebp
+  803517:	89 e5                	mov    %esp,%ebp
+  803519:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80351c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80351f:	e8 b0 fe ff ff       	call   8033d4 <fd2sockid>
+  803524:	85 c0                	test   %eax,%eax
+  803526:	78 0f                	js     803537 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803528:	83 ec 08             	sub    $0x8,%esp
+  80352b:	ff 75 0c             	push   0xc(%ebp)
+  80352e:	50                   	push   %eax
+  80352f:	e8 6b 01 00 00       	call   80369f <nsipc_listen>
+  803534:	83 c4 10             	add    $0x10,%esp
+}
+  803537:	c9                   	leave
+  803538:	c3                   	ret
+
+00803539 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803539:	55                   	push   %ebp
+  80353a:	89 e5                	mov    %esp,%ebp
+  80353c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80353f:	ff 75 10             	push   0x10(%ebp)
+  803542:	ff 75 0c             	push   0xc(%ebp)
+  803545:	ff 75 08             	push   0x8(%ebp)
+  803548:	e8 41 02 00 00       	call   80378e <nsipc_socket>
+  80354d:	83 c4 10             	add    $0x10,%esp
+  803550:	85 c0                	test   %eax,%eax
+  803552:	78 05                	js     803559 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803554:	e8 ab fe ff ff       	call   803404 <alloc_sockfd>
+}
+  803559:	c9                   	leave
+  80355a:	c3                   	ret
+
+0080355b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80355b:	55                   	push   %ebp
+  80355c:	89 e5                	mov    %esp,%ebp
+  80355e:	53                   	push   %ebx
+  80355f:	83 ec 04             	sub    $0x4,%esp
+  803562:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803564:	83 3d 04 a0 80 00 00 	cmpl   $0x0,0x80a004
+  80356b:	74 26                	je     803593 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80356d:	6a 07                	push   $0x7
+  80356f:	68 00 c0 80 00       	push   $0x80c000
+  803574:	53                   	push   %ebx
+  803575:	ff 35 04 a0 80 00    	push   0x80a004
+  80357b:	e8 3f f5 ff ff       	call   802abf <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803580:	83 c4 0c             	add    $0xc,%esp
+  803583:	6a 00                	push   $0x0
+  803585:	6a 00                	push   $0x0
+  803587:	6a 00                	push   $0x0
+  803589:	e8 b9 f4 ff ff       	call   802a47 <ipc_recv>
+}
+  80358e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803591:	c9                   	leave
+  803592:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803593:	83 ec 0c             	sub    $0xc,%esp
+  803596:	6a 02                	push   $0x2
+  803598:	e8 76 f5 ff ff       	call   802b13 <ipc_find_env>
+  80359d:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  8035a2:	83 c4 10             	add    $0x10,%esp
+  8035a5:	eb c6                	jmp    80356d <nsipc+0x12>
+
+008035a7 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8035a7:	55                   	push   %ebp
+  8035a8:	89 e5                	mov    %esp,%ebp
+  8035aa:	56                   	push   %esi
+  8035ab:	53                   	push   %ebx
+  8035ac:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8035af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b2:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8035b7:	8b 06                	mov    (%esi),%eax
+  8035b9:	a3 04 c0 80 00       	mov    %eax,0x80c004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8035be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035c3:	e8 93 ff ff ff       	call   80355b <nsipc>
+  8035c8:	89 c3                	mov    %eax,%ebx
+  8035ca:	85 c0                	test   %eax,%eax
+  8035cc:	79 09                	jns    8035d7 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8035ce:	89 d8                	mov    %ebx,%eax
+  8035d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035d3:	5b                   	pop    %ebx
+  8035d4:	5e                   	pop    %esi
+  8035d5:	5d                   	pop    %ebp
+  8035d6:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8035d7:	83 ec 04             	sub    $0x4,%esp
+  8035da:	ff 35 10 c0 80 00    	push   0x80c010
+  8035e0:	68 00 c0 80 00       	push   $0x80c000
+  8035e5:	ff 75 0c             	push   0xc(%ebp)
+  8035e8:	e8 bd ec ff ff       	call   8022aa <memmove>
+		*addrlen = ret->ret_addrlen;
+  8035ed:	a1 10 c0 80 00       	mov    0x80c010,%eax
+  8035f2:	89 06                	mov    %eax,(%esi)
+  8035f4:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8035f7:	eb d5                	jmp    8035ce <nsipc_accept+0x27>
+
+008035f9 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8035f9:	55                   	push   %ebp
+  8035fa:	89 e5                	mov    %esp,%ebp
+  8035fc:	53                   	push   %ebx
+  8035fd:	83 ec 08             	sub    $0x8,%esp
+  803600:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803603:	8b 45 08             	mov    0x8(%ebp),%eax
+  803606:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80360b:	53                   	push   %ebx
+  80360c:	ff 75 0c             	push   0xc(%ebp)
+  80360f:	68 04 c0 80 00       	push   $0x80c004
+  803614:	e8 91 ec ff ff       	call   8022aa <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803619:	89 1d 14 c0 80 00    	mov    %ebx,0x80c014
+	return nsipc(NSREQ_BIND);
+  80361f:	b8 02 00 00 00       	mov    $0x2,%eax
+  803624:	e8 32 ff ff ff       	call   80355b <nsipc>
+}
+  803629:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80362c:	c9                   	leave
+  80362d:	c3                   	ret
+
+0080362e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80362e:	55                   	push   %ebp
+  80362f:	89 e5                	mov    %esp,%ebp
+  803631:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803634:	8b 45 08             	mov    0x8(%ebp),%eax
+  803637:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	nsipcbuf.shutdown.req_how = how;
+  80363c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80363f:	a3 04 c0 80 00       	mov    %eax,0x80c004
+	return nsipc(NSREQ_SHUTDOWN);
+  803644:	b8 03 00 00 00       	mov    $0x3,%eax
+  803649:	e8 0d ff ff ff       	call   80355b <nsipc>
+}
+  80364e:	c9                   	leave
+  80364f:	c3                   	ret
+
+00803650 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803650:	55                   	push   %ebp
+  803651:	89 e5                	mov    %esp,%ebp
+  803653:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803656:	8b 45 08             	mov    0x8(%ebp),%eax
+  803659:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return nsipc(NSREQ_CLOSE);
+  80365e:	b8 04 00 00 00       	mov    $0x4,%eax
+  803663:	e8 f3 fe ff ff       	call   80355b <nsipc>
+}
+  803668:	c9                   	leave
+  803669:	c3                   	ret
+
+0080366a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80366a:	55                   	push   %ebp
+  80366b:	89 e5                	mov    %esp,%ebp
+  80366d:	53                   	push   %ebx
+  80366e:	83 ec 08             	sub    $0x8,%esp
+  803671:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803674:	8b 45 08             	mov    0x8(%ebp),%eax
+  803677:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80367c:	53                   	push   %ebx
+  80367d:	ff 75 0c             	push   0xc(%ebp)
+  803680:	68 04 c0 80 00       	push   $0x80c004
+  803685:	e8 20 ec ff ff       	call   8022aa <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80368a:	89 1d 14 c0 80 00    	mov    %ebx,0x80c014
+	return nsipc(NSREQ_CONNECT);
+  803690:	b8 05 00 00 00       	mov    $0x5,%eax
+  803695:	e8 c1 fe ff ff       	call   80355b <nsipc>
+}
+  80369a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80369d:	c9                   	leave
+  80369e:	c3                   	ret
+
+0080369f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80369f:	55                   	push   %ebp
+  8036a0:	89 e5                	mov    %esp,%ebp
+  8036a2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8036a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036a8:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	nsipcbuf.listen.req_backlog = backlog;
+  8036ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036b0:	a3 04 c0 80 00       	mov    %eax,0x80c004
+	return nsipc(NSREQ_LISTEN);
+  8036b5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8036ba:	e8 9c fe ff ff       	call   80355b <nsipc>
+}
+  8036bf:	c9                   	leave
+  8036c0:	c3                   	ret
+
+008036c1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8036c1:	55                   	push   %ebp
+  8036c2:	89 e5                	mov    %esp,%ebp
+  8036c4:	56                   	push   %esi
+  8036c5:	53                   	push   %ebx
+  8036c6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8036c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036cc:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	nsipcbuf.recv.req_len = len;
+  8036d1:	89 35 04 c0 80 00    	mov    %esi,0x80c004
+	nsipcbuf.recv.req_flags = flags;
+  8036d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036da:	a3 08 c0 80 00       	mov    %eax,0x80c008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8036df:	b8 07 00 00 00       	mov    $0x7,%eax
+  8036e4:	e8 72 fe ff ff       	call   80355b <nsipc>
+  8036e9:	89 c3                	mov    %eax,%ebx
+  8036eb:	85 c0                	test   %eax,%eax
+  8036ed:	78 22                	js     803711 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8036ef:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8036f4:	39 c6                	cmp    %eax,%esi
+  8036f6:	0f 4e c6             	cmovle %esi,%eax
+  8036f9:	39 c3                	cmp    %eax,%ebx
+  8036fb:	7f 1d                	jg     80371a <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8036fd:	83 ec 04             	sub    $0x4,%esp
+  803700:	53                   	push   %ebx
+  803701:	68 00 c0 80 00       	push   $0x80c000
+  803706:	ff 75 0c             	push   0xc(%ebp)
+  803709:	e8 9c eb ff ff       	call   8022aa <memmove>
+  80370e:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803711:	89 d8                	mov    %ebx,%eax
+  803713:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803716:	5b                   	pop    %ebx
+  803717:	5e                   	pop    %esi
+  803718:	5d                   	pop    %ebp
+  803719:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80371a:	68 d2 4a 80 00       	push   $0x804ad2
+  80371f:	68 fd 40 80 00       	push   $0x8040fd
+  803724:	6a 62                	push   $0x62
+  803726:	68 e7 4a 80 00       	push   $0x804ae7
+  80372b:	e8 2b e3 ff ff       	call   801a5b <_panic>
+
+00803730 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803730:	55                   	push   %ebp
+  803731:	89 e5                	mov    %esp,%ebp
+  803733:	53                   	push   %ebx
+  803734:	83 ec 04             	sub    $0x4,%esp
+  803737:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80373a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80373d:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	assert(size < 1600);
+  803742:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803748:	7f 2e                	jg     803778 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80374a:	83 ec 04             	sub    $0x4,%esp
+  80374d:	53                   	push   %ebx
+  80374e:	ff 75 0c             	push   0xc(%ebp)
+  803751:	68 0c c0 80 00       	push   $0x80c00c
+  803756:	e8 4f eb ff ff       	call   8022aa <memmove>
+	nsipcbuf.send.req_size = size;
+  80375b:	89 1d 04 c0 80 00    	mov    %ebx,0x80c004
+	nsipcbuf.send.req_flags = flags;
+  803761:	8b 45 14             	mov    0x14(%ebp),%eax
+  803764:	a3 08 c0 80 00       	mov    %eax,0x80c008
+	return nsipc(NSREQ_SEND);
+  803769:	b8 08 00 00 00       	mov    $0x8,%eax
+  80376e:	e8 e8 fd ff ff       	call   80355b <nsipc>
+}
+  803773:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803776:	c9                   	leave
+  803777:	c3                   	ret
+	assert(size < 1600);
+  803778:	68 f3 4a 80 00       	push   $0x804af3
+  80377d:	68 fd 40 80 00       	push   $0x8040fd
+  803782:	6a 6d                	push   $0x6d
+  803784:	68 e7 4a 80 00       	push   $0x804ae7
+  803789:	e8 cd e2 ff ff       	call   801a5b <_panic>
+
+0080378e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80378e:	55                   	push   %ebp
+  80378f:	89 e5                	mov    %esp,%ebp
+  803791:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803794:	8b 45 08             	mov    0x8(%ebp),%eax
+  803797:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	nsipcbuf.socket.req_type = type;
+  80379c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80379f:	a3 04 c0 80 00       	mov    %eax,0x80c004
+	nsipcbuf.socket.req_protocol = protocol;
+  8037a4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8037a7:	a3 08 c0 80 00       	mov    %eax,0x80c008
+	return nsipc(NSREQ_SOCKET);
+  8037ac:	b8 09 00 00 00       	mov    $0x9,%eax
+  8037b1:	e8 a5 fd ff ff       	call   80355b <nsipc>
+}
+  8037b6:	c9                   	leave
+  8037b7:	c3                   	ret
+
+008037b8 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8037b8:	55                   	push   %ebp
+  8037b9:	89 e5                	mov    %esp,%ebp
+  8037bb:	56                   	push   %esi
+  8037bc:	53                   	push   %ebx
+  8037bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8037c0:	83 ec 0c             	sub    $0xc,%esp
+  8037c3:	ff 75 08             	push   0x8(%ebp)
+  8037c6:	e8 68 f3 ff ff       	call   802b33 <fd2data>
+  8037cb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8037cd:	83 c4 08             	add    $0x8,%esp
+  8037d0:	68 ff 4a 80 00       	push   $0x804aff
+  8037d5:	53                   	push   %ebx
+  8037d6:	e8 49 e9 ff ff       	call   802124 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8037db:	8b 46 04             	mov    0x4(%esi),%eax
+  8037de:	2b 06                	sub    (%esi),%eax
+  8037e0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8037e6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8037ed:	00 00 00 
+	stat->st_dev = &devpipe;
+  8037f0:	c7 83 88 00 00 00 9c 	movl   $0x80909c,0x88(%ebx)
+  8037f7:	90 80 00 
+	return 0;
+}
+  8037fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803802:	5b                   	pop    %ebx
+  803803:	5e                   	pop    %esi
+  803804:	5d                   	pop    %ebp
+  803805:	c3                   	ret
+
+00803806 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803806:	55                   	push   %ebp
+  803807:	89 e5                	mov    %esp,%ebp
+  803809:	53                   	push   %ebx
+  80380a:	83 ec 0c             	sub    $0xc,%esp
+  80380d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803810:	53                   	push   %ebx
+  803811:	6a 00                	push   $0x0
+  803813:	e8 41 ee ff ff       	call   802659 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803818:	89 1c 24             	mov    %ebx,(%esp)
+  80381b:	e8 13 f3 ff ff       	call   802b33 <fd2data>
+  803820:	83 c4 08             	add    $0x8,%esp
+  803823:	50                   	push   %eax
+  803824:	6a 00                	push   $0x0
+  803826:	e8 2e ee ff ff       	call   802659 <sys_page_unmap>
+}
+  80382b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80382e:	c9                   	leave
+  80382f:	c3                   	ret
+
+00803830 <_pipeisclosed>:
+{
+  803830:	55                   	push   %ebp
+  803831:	89 e5                	mov    %esp,%ebp
+  803833:	57                   	push   %edi
+  803834:	56                   	push   %esi
+  803835:	53                   	push   %ebx
+  803836:	83 ec 1c             	sub    $0x1c,%esp
+  803839:	89 c7                	mov    %eax,%edi
+  80383b:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80383d:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  803842:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803845:	83 ec 0c             	sub    $0xc,%esp
+  803848:	57                   	push   %edi
+  803849:	e8 c0 fa ff ff       	call   80330e <pageref>
+  80384e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803851:	89 34 24             	mov    %esi,(%esp)
+  803854:	e8 b5 fa ff ff       	call   80330e <pageref>
+		nn = thisenv->env_runs;
+  803859:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  80385f:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  803862:	83 c4 10             	add    $0x10,%esp
+  803865:	39 cb                	cmp    %ecx,%ebx
+  803867:	74 1b                	je     803884 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803869:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80386c:	75 cf                	jne    80383d <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80386e:	8b 42 5c             	mov    0x5c(%edx),%eax
+  803871:	6a 01                	push   $0x1
+  803873:	50                   	push   %eax
+  803874:	53                   	push   %ebx
+  803875:	68 06 4b 80 00       	push   $0x804b06
+  80387a:	e8 b7 e2 ff ff       	call   801b36 <cprintf>
+  80387f:	83 c4 10             	add    $0x10,%esp
+  803882:	eb b9                	jmp    80383d <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  803884:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803887:	0f 94 c0             	sete   %al
+  80388a:	0f b6 c0             	movzbl %al,%eax
+}
+  80388d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803890:	5b                   	pop    %ebx
+  803891:	5e                   	pop    %esi
+  803892:	5f                   	pop    %edi
+  803893:	5d                   	pop    %ebp
+  803894:	c3                   	ret
+
+00803895 <devpipe_write>:
+{
+  803895:	55                   	push   %ebp
+  803896:	89 e5                	mov    %esp,%ebp
+  803898:	57                   	push   %edi
+  803899:	56                   	push   %esi
+  80389a:	53                   	push   %ebx
+  80389b:	83 ec 28             	sub    $0x28,%esp
+  80389e:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8038a1:	56                   	push   %esi
+  8038a2:	e8 8c f2 ff ff       	call   802b33 <fd2data>
+  8038a7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8038a9:	83 c4 10             	add    $0x10,%esp
+  8038ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038b1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8038b4:	75 09                	jne    8038bf <devpipe_write+0x2a>
+	return i;
+  8038b6:	89 f8                	mov    %edi,%eax
+  8038b8:	eb 23                	jmp    8038dd <devpipe_write+0x48>
+			sys_yield();
+  8038ba:	e8 52 ec ff ff       	call   802511 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8038bf:	8b 43 04             	mov    0x4(%ebx),%eax
+  8038c2:	8b 0b                	mov    (%ebx),%ecx
+  8038c4:	8d 51 20             	lea    0x20(%ecx),%edx
+  8038c7:	39 d0                	cmp    %edx,%eax
+  8038c9:	72 1a                	jb     8038e5 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8038cb:	89 da                	mov    %ebx,%edx
+  8038cd:	89 f0                	mov    %esi,%eax
+  8038cf:	e8 5c ff ff ff       	call   803830 <_pipeisclosed>
+  8038d4:	85 c0                	test   %eax,%eax
+  8038d6:	74 e2                	je     8038ba <devpipe_write+0x25>
+				return 0;
+  8038d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038e0:	5b                   	pop    %ebx
+  8038e1:	5e                   	pop    %esi
+  8038e2:	5f                   	pop    %edi
+  8038e3:	5d                   	pop    %ebp
+  8038e4:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8038e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8038e8:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8038ec:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8038ef:	89 c2                	mov    %eax,%edx
+  8038f1:	c1 fa 1f             	sar    $0x1f,%edx
+  8038f4:	89 d1                	mov    %edx,%ecx
+  8038f6:	c1 e9 1b             	shr    $0x1b,%ecx
+  8038f9:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8038fc:	83 e2 1f             	and    $0x1f,%edx
+  8038ff:	29 ca                	sub    %ecx,%edx
+  803901:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803905:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803909:	83 c0 01             	add    $0x1,%eax
+  80390c:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80390f:	83 c7 01             	add    $0x1,%edi
+  803912:	eb 9d                	jmp    8038b1 <devpipe_write+0x1c>
+
+00803914 <devpipe_read>:
+{
+  803914:	55                   	push   %ebp
+  803915:	89 e5                	mov    %esp,%ebp
+  803917:	57                   	push   %edi
+  803918:	56                   	push   %esi
+  803919:	53                   	push   %ebx
+  80391a:	83 ec 18             	sub    $0x18,%esp
+  80391d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803920:	57                   	push   %edi
+  803921:	e8 0d f2 ff ff       	call   802b33 <fd2data>
+  803926:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803928:	83 c4 10             	add    $0x10,%esp
+  80392b:	be 00 00 00 00       	mov    $0x0,%esi
+  803930:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803933:	75 13                	jne    803948 <devpipe_read+0x34>
+	return i;
+  803935:	89 f0                	mov    %esi,%eax
+  803937:	eb 02                	jmp    80393b <devpipe_read+0x27>
+				return i;
+  803939:	89 f0                	mov    %esi,%eax
+}
+  80393b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80393e:	5b                   	pop    %ebx
+  80393f:	5e                   	pop    %esi
+  803940:	5f                   	pop    %edi
+  803941:	5d                   	pop    %ebp
+  803942:	c3                   	ret
+			sys_yield();
+  803943:	e8 c9 eb ff ff       	call   802511 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803948:	8b 03                	mov    (%ebx),%eax
+  80394a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80394d:	75 18                	jne    803967 <devpipe_read+0x53>
+			if (i > 0)
+  80394f:	85 f6                	test   %esi,%esi
+  803951:	75 e6                	jne    803939 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803953:	89 da                	mov    %ebx,%edx
+  803955:	89 f8                	mov    %edi,%eax
+  803957:	e8 d4 fe ff ff       	call   803830 <_pipeisclosed>
+  80395c:	85 c0                	test   %eax,%eax
+  80395e:	74 e3                	je     803943 <devpipe_read+0x2f>
+				return 0;
+  803960:	b8 00 00 00 00       	mov    $0x0,%eax
+  803965:	eb d4                	jmp    80393b <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803967:	99                   	cltd
+  803968:	c1 ea 1b             	shr    $0x1b,%edx
+  80396b:	01 d0                	add    %edx,%eax
+  80396d:	83 e0 1f             	and    $0x1f,%eax
+  803970:	29 d0                	sub    %edx,%eax
+  803972:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803977:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80397a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80397d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803980:	83 c6 01             	add    $0x1,%esi
+  803983:	eb ab                	jmp    803930 <devpipe_read+0x1c>
+
+00803985 <pipe>:
+{
+  803985:	55                   	push   %ebp
+  803986:	89 e5                	mov    %esp,%ebp
+  803988:	56                   	push   %esi
+  803989:	53                   	push   %ebx
+  80398a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80398d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803990:	50                   	push   %eax
+  803991:	e8 b4 f1 ff ff       	call   802b4a <fd_alloc>
+  803996:	89 c3                	mov    %eax,%ebx
+  803998:	83 c4 10             	add    $0x10,%esp
+  80399b:	85 c0                	test   %eax,%eax
+  80399d:	0f 88 23 01 00 00    	js     803ac6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039a3:	83 ec 04             	sub    $0x4,%esp
+  8039a6:	68 07 04 00 00       	push   $0x407
+  8039ab:	ff 75 f4             	push   -0xc(%ebp)
+  8039ae:	6a 00                	push   $0x0
+  8039b0:	e8 dc eb ff ff       	call   802591 <sys_page_alloc>
+  8039b5:	89 c3                	mov    %eax,%ebx
+  8039b7:	83 c4 10             	add    $0x10,%esp
+  8039ba:	85 c0                	test   %eax,%eax
+  8039bc:	0f 88 04 01 00 00    	js     803ac6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8039c2:	83 ec 0c             	sub    $0xc,%esp
+  8039c5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8039c8:	50                   	push   %eax
+  8039c9:	e8 7c f1 ff ff       	call   802b4a <fd_alloc>
+  8039ce:	89 c3                	mov    %eax,%ebx
+  8039d0:	83 c4 10             	add    $0x10,%esp
+  8039d3:	85 c0                	test   %eax,%eax
+  8039d5:	0f 88 db 00 00 00    	js     803ab6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039db:	83 ec 04             	sub    $0x4,%esp
+  8039de:	68 07 04 00 00       	push   $0x407
+  8039e3:	ff 75 f0             	push   -0x10(%ebp)
+  8039e6:	6a 00                	push   $0x0
+  8039e8:	e8 a4 eb ff ff       	call   802591 <sys_page_alloc>
+  8039ed:	89 c3                	mov    %eax,%ebx
+  8039ef:	83 c4 10             	add    $0x10,%esp
+  8039f2:	85 c0                	test   %eax,%eax
+  8039f4:	0f 88 bc 00 00 00    	js     803ab6 <pipe+0x131>
+	va = fd2data(fd0);
+  8039fa:	83 ec 0c             	sub    $0xc,%esp
+  8039fd:	ff 75 f4             	push   -0xc(%ebp)
+  803a00:	e8 2e f1 ff ff       	call   802b33 <fd2data>
+  803a05:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a07:	83 c4 0c             	add    $0xc,%esp
+  803a0a:	68 07 04 00 00       	push   $0x407
+  803a0f:	50                   	push   %eax
+  803a10:	6a 00                	push   $0x0
+  803a12:	e8 7a eb ff ff       	call   802591 <sys_page_alloc>
+  803a17:	89 c3                	mov    %eax,%ebx
+  803a19:	83 c4 10             	add    $0x10,%esp
+  803a1c:	85 c0                	test   %eax,%eax
+  803a1e:	0f 88 82 00 00 00    	js     803aa6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a24:	83 ec 0c             	sub    $0xc,%esp
+  803a27:	ff 75 f0             	push   -0x10(%ebp)
+  803a2a:	e8 04 f1 ff ff       	call   802b33 <fd2data>
+  803a2f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803a36:	50                   	push   %eax
+  803a37:	6a 00                	push   $0x0
+  803a39:	56                   	push   %esi
+  803a3a:	6a 00                	push   $0x0
+  803a3c:	e8 d6 eb ff ff       	call   802617 <sys_page_map>
+  803a41:	89 c3                	mov    %eax,%ebx
+  803a43:	83 c4 20             	add    $0x20,%esp
+  803a46:	85 c0                	test   %eax,%eax
+  803a48:	78 4e                	js     803a98 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803a4a:	a1 9c 90 80 00       	mov    0x80909c,%eax
+  803a4f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a52:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803a54:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a57:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803a5e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803a61:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803a63:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803a66:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803a6d:	83 ec 0c             	sub    $0xc,%esp
+  803a70:	ff 75 f4             	push   -0xc(%ebp)
+  803a73:	e8 ab f0 ff ff       	call   802b23 <fd2num>
+  803a78:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a7b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803a7d:	83 c4 04             	add    $0x4,%esp
+  803a80:	ff 75 f0             	push   -0x10(%ebp)
+  803a83:	e8 9b f0 ff ff       	call   802b23 <fd2num>
+  803a88:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a8b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803a8e:	83 c4 10             	add    $0x10,%esp
+  803a91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a96:	eb 2e                	jmp    803ac6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803a98:	83 ec 08             	sub    $0x8,%esp
+  803a9b:	56                   	push   %esi
+  803a9c:	6a 00                	push   $0x0
+  803a9e:	e8 b6 eb ff ff       	call   802659 <sys_page_unmap>
+  803aa3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803aa6:	83 ec 08             	sub    $0x8,%esp
+  803aa9:	ff 75 f0             	push   -0x10(%ebp)
+  803aac:	6a 00                	push   $0x0
+  803aae:	e8 a6 eb ff ff       	call   802659 <sys_page_unmap>
+  803ab3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803ab6:	83 ec 08             	sub    $0x8,%esp
+  803ab9:	ff 75 f4             	push   -0xc(%ebp)
+  803abc:	6a 00                	push   $0x0
+  803abe:	e8 96 eb ff ff       	call   802659 <sys_page_unmap>
+  803ac3:	83 c4 10             	add    $0x10,%esp
+}
+  803ac6:	89 d8                	mov    %ebx,%eax
+  803ac8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803acb:	5b                   	pop    %ebx
+  803acc:	5e                   	pop    %esi
+  803acd:	5d                   	pop    %ebp
+  803ace:	c3                   	ret
+
+00803acf <pipeisclosed>:
+{
+  803acf:	55                   	push   %ebp
+  803ad0:	89 e5                	mov    %esp,%ebp
+  803ad2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803ad5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ad8:	50                   	push   %eax
+  803ad9:	ff 75 08             	push   0x8(%ebp)
+  803adc:	e8 bf f0 ff ff       	call   802ba0 <fd_lookup>
+  803ae1:	83 c4 10             	add    $0x10,%esp
+  803ae4:	85 c0                	test   %eax,%eax
+  803ae6:	78 18                	js     803b00 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803ae8:	83 ec 0c             	sub    $0xc,%esp
+  803aeb:	ff 75 f4             	push   -0xc(%ebp)
+  803aee:	e8 40 f0 ff ff       	call   802b33 <fd2data>
+  803af3:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803af5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803af8:	e8 33 fd ff ff       	call   803830 <_pipeisclosed>
+  803afd:	83 c4 10             	add    $0x10,%esp
+}
+  803b00:	c9                   	leave
+  803b01:	c3                   	ret
+
+00803b02 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b07:	c3                   	ret
+
+00803b08 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803b08:	55                   	push   %ebp
+  803b09:	89 e5                	mov    %esp,%ebp
+  803b0b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803b0e:	68 1e 4b 80 00       	push   $0x804b1e
+  803b13:	ff 75 0c             	push   0xc(%ebp)
+  803b16:	e8 09 e6 ff ff       	call   802124 <strcpy>
+	return 0;
+}
+  803b1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b20:	c9                   	leave
+  803b21:	c3                   	ret
+
+00803b22 <devcons_write>:
+{
+  803b22:	55                   	push   %ebp
+  803b23:	89 e5                	mov    %esp,%ebp
+  803b25:	57                   	push   %edi
+  803b26:	56                   	push   %esi
+  803b27:	53                   	push   %ebx
+  803b28:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803b2e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803b33:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803b39:	eb 2e                	jmp    803b69 <devcons_write+0x47>
+		m = n - tot;
+  803b3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803b3e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803b40:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803b45:	39 c3                	cmp    %eax,%ebx
+  803b47:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803b4a:	83 ec 04             	sub    $0x4,%esp
+  803b4d:	53                   	push   %ebx
+  803b4e:	89 f0                	mov    %esi,%eax
+  803b50:	03 45 0c             	add    0xc(%ebp),%eax
+  803b53:	50                   	push   %eax
+  803b54:	57                   	push   %edi
+  803b55:	e8 50 e7 ff ff       	call   8022aa <memmove>
+		sys_cputs(buf, m);
+  803b5a:	83 c4 08             	add    $0x8,%esp
+  803b5d:	53                   	push   %ebx
+  803b5e:	57                   	push   %edi
+  803b5f:	e8 f0 e8 ff ff       	call   802454 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803b64:	01 de                	add    %ebx,%esi
+  803b66:	83 c4 10             	add    $0x10,%esp
+  803b69:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803b6c:	72 cd                	jb     803b3b <devcons_write+0x19>
+}
+  803b6e:	89 f0                	mov    %esi,%eax
+  803b70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b73:	5b                   	pop    %ebx
+  803b74:	5e                   	pop    %esi
+  803b75:	5f                   	pop    %edi
+  803b76:	5d                   	pop    %ebp
+  803b77:	c3                   	ret
+
+00803b78 <devcons_read>:
+{
+  803b78:	55                   	push   %ebp
+  803b79:	89 e5                	mov    %esp,%ebp
+  803b7b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b83:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803b87:	75 07                	jne    803b90 <devcons_read+0x18>
+  803b89:	eb 1f                	jmp    803baa <devcons_read+0x32>
+		sys_yield();
+  803b8b:	e8 81 e9 ff ff       	call   802511 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803b90:	e8 dd e8 ff ff       	call   802472 <sys_cgetc>
+  803b95:	85 c0                	test   %eax,%eax
+  803b97:	74 f2                	je     803b8b <devcons_read+0x13>
+	if (c < 0)
+  803b99:	78 0f                	js     803baa <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803b9b:	83 f8 04             	cmp    $0x4,%eax
+  803b9e:	74 0c                	je     803bac <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803ba0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ba3:	88 02                	mov    %al,(%edx)
+	return 1;
+  803ba5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803baa:	c9                   	leave
+  803bab:	c3                   	ret
+		return 0;
+  803bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb1:	eb f7                	jmp    803baa <devcons_read+0x32>
+
+00803bb3 <cputchar>:
+{
+  803bb3:	55                   	push   %ebp
+  803bb4:	89 e5                	mov    %esp,%ebp
+  803bb6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bbc:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803bbf:	6a 01                	push   $0x1
+  803bc1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803bc4:	50                   	push   %eax
+  803bc5:	e8 8a e8 ff ff       	call   802454 <sys_cputs>
+}
+  803bca:	83 c4 10             	add    $0x10,%esp
+  803bcd:	c9                   	leave
+  803bce:	c3                   	ret
+
+00803bcf <getchar>:
+{
+  803bcf:	55                   	push   %ebp
+  803bd0:	89 e5                	mov    %esp,%ebp
+  803bd2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803bd5:	6a 01                	push   $0x1
+  803bd7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803bda:	50                   	push   %eax
+  803bdb:	6a 00                	push   $0x0
+  803bdd:	e8 24 f2 ff ff       	call   802e06 <read>
+	if (r < 0)
+  803be2:	83 c4 10             	add    $0x10,%esp
+  803be5:	85 c0                	test   %eax,%eax
+  803be7:	78 06                	js     803bef <getchar+0x20>
+	if (r < 1)
+  803be9:	74 06                	je     803bf1 <getchar+0x22>
+	return c;
+  803beb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803bef:	c9                   	leave
+  803bf0:	c3                   	ret
+		return -E_EOF;
+  803bf1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803bf6:	eb f7                	jmp    803bef <getchar+0x20>
+
+00803bf8 <iscons>:
+{
+  803bf8:	55                   	push   %ebp
+  803bf9:	89 e5                	mov    %esp,%ebp
+  803bfb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803bfe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c01:	50                   	push   %eax
+  803c02:	ff 75 08             	push   0x8(%ebp)
+  803c05:	e8 96 ef ff ff       	call   802ba0 <fd_lookup>
+  803c0a:	83 c4 10             	add    $0x10,%esp
+  803c0d:	85 c0                	test   %eax,%eax
+  803c0f:	78 11                	js     803c22 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803c11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c14:	8b 15 b8 90 80 00    	mov    0x8090b8,%edx
+  803c1a:	39 10                	cmp    %edx,(%eax)
+  803c1c:	0f 94 c0             	sete   %al
+  803c1f:	0f b6 c0             	movzbl %al,%eax
+}
+  803c22:	c9                   	leave
+  803c23:	c3                   	ret
+
+00803c24 <opencons>:
+{
+  803c24:	55                   	push   %ebp
+  803c25:	89 e5                	mov    %esp,%ebp
+  803c27:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803c2a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c2d:	50                   	push   %eax
+  803c2e:	e8 17 ef ff ff       	call   802b4a <fd_alloc>
+  803c33:	83 c4 10             	add    $0x10,%esp
+  803c36:	85 c0                	test   %eax,%eax
+  803c38:	78 3a                	js     803c74 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803c3a:	83 ec 04             	sub    $0x4,%esp
+  803c3d:	68 07 04 00 00       	push   $0x407
+  803c42:	ff 75 f4             	push   -0xc(%ebp)
+  803c45:	6a 00                	push   $0x0
+  803c47:	e8 45 e9 ff ff       	call   802591 <sys_page_alloc>
+  803c4c:	83 c4 10             	add    $0x10,%esp
+  803c4f:	85 c0                	test   %eax,%eax
+  803c51:	78 21                	js     803c74 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803c53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c56:	8b 15 b8 90 80 00    	mov    0x8090b8,%edx
+  803c5c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803c5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c61:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803c68:	83 ec 0c             	sub    $0xc,%esp
+  803c6b:	50                   	push   %eax
+  803c6c:	e8 b2 ee ff ff       	call   802b23 <fd2num>
+  803c71:	83 c4 10             	add    $0x10,%esp
+}
+  803c74:	c9                   	leave
+  803c75:	c3                   	ret
+  803c76:	66 90                	xchg   %ax,%ax
+  803c78:	66 90                	xchg   %ax,%ax
+  803c7a:	66 90                	xchg   %ax,%ax
+  803c7c:	66 90                	xchg   %ax,%ax
+  803c7e:	66 90                	xchg   %ax,%ax
+
+00803c80 <__udivmoddi4>:
+  803c80:	55                   	push   %ebp
+  803c81:	57                   	push   %edi
+  803c82:	56                   	push   %esi
+  803c83:	53                   	push   %ebx
+  803c84:	83 ec 14             	sub    $0x14,%esp
+  803c87:	8b 74 24 34          	mov    0x34(%esp),%esi
+  803c8b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  803c8f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803c93:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803c97:	89 f1                	mov    %esi,%ecx
+  803c99:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  803c9d:	09 d9                	or     %ebx,%ecx
+  803c9f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  803ca3:	0f 84 92 00 00 00    	je     803d3b <__udivmoddi4+0xbb>
+  803ca9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803cb0:	00 
+  803cb1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  803cb6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803cbd:	00 
+  803cbe:	89 1c 24             	mov    %ebx,(%esp)
+  803cc1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  803cc5:	8d 76 00             	lea    0x0(%esi),%esi
+  803cc8:	89 e9                	mov    %ebp,%ecx
+  803cca:	89 c3                	mov    %eax,%ebx
+  803ccc:	89 d6                	mov    %edx,%esi
+  803cce:	31 ff                	xor    %edi,%edi
+  803cd0:	d3 ee                	shr    %cl,%esi
+  803cd2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  803cd5:	f6 c1 20             	test   $0x20,%cl
+  803cd8:	0f 45 de             	cmovne %esi,%ebx
+  803cdb:	0f 45 f7             	cmovne %edi,%esi
+  803cde:	8b 3c 24             	mov    (%esp),%edi
+  803ce1:	39 fb                	cmp    %edi,%ebx
+  803ce3:	89 f7                	mov    %esi,%edi
+  803ce5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803ce9:	8b 1c 24             	mov    (%esp),%ebx
+  803cec:	19 f7                	sbb    %esi,%edi
+  803cee:	72 39                	jb     803d29 <__udivmoddi4+0xa9>
+  803cf0:	89 e9                	mov    %ebp,%ecx
+  803cf2:	89 f7                	mov    %esi,%edi
+  803cf4:	89 de                	mov    %ebx,%esi
+  803cf6:	0f a5 df             	shld   %cl,%ebx,%edi
+  803cf9:	d3 e6                	shl    %cl,%esi
+  803cfb:	31 db                	xor    %ebx,%ebx
+  803cfd:	f6 c1 20             	test   $0x20,%cl
+  803d00:	0f 45 fe             	cmovne %esi,%edi
+  803d03:	0f 45 f3             	cmovne %ebx,%esi
+  803d06:	29 f0                	sub    %esi,%eax
+  803d08:	be 01 00 00 00       	mov    $0x1,%esi
+  803d0d:	19 fa                	sbb    %edi,%edx
+  803d0f:	31 ff                	xor    %edi,%edi
+  803d11:	31 db                	xor    %ebx,%ebx
+  803d13:	0f a5 f7             	shld   %cl,%esi,%edi
+  803d16:	d3 e6                	shl    %cl,%esi
+  803d18:	f6 c1 20             	test   $0x20,%cl
+  803d1b:	0f 45 fe             	cmovne %esi,%edi
+  803d1e:	0f 45 f3             	cmovne %ebx,%esi
+  803d21:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803d25:	09 74 24 08          	or     %esi,0x8(%esp)
+  803d29:	83 ed 01             	sub    $0x1,%ebp
+  803d2c:	73 9a                	jae    803cc8 <__udivmoddi4+0x48>
+  803d2e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  803d32:	85 ff                	test   %edi,%edi
+  803d34:	74 05                	je     803d3b <__udivmoddi4+0xbb>
+  803d36:	89 07                	mov    %eax,(%edi)
+  803d38:	89 57 04             	mov    %edx,0x4(%edi)
+  803d3b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803d3f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803d43:	83 c4 14             	add    $0x14,%esp
+  803d46:	5b                   	pop    %ebx
+  803d47:	5e                   	pop    %esi
+  803d48:	5f                   	pop    %edi
+  803d49:	5d                   	pop    %ebp
+  803d4a:	c3                   	ret
+  803d4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  803d4f:	90                   	nop
+
+00803d50 <__udivdi3>:
+  803d50:	55                   	push   %ebp
+  803d51:	57                   	push   %edi
+  803d52:	56                   	push   %esi
+  803d53:	53                   	push   %ebx
+  803d54:	83 ec 14             	sub    $0x14,%esp
+  803d57:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  803d5b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  803d5f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803d63:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803d67:	89 fb                	mov    %edi,%ebx
+  803d69:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803d6d:	09 f3                	or     %esi,%ebx
+  803d6f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803d73:	0f 84 85 00 00 00    	je     803dfe <__udivdi3+0xae>
+  803d79:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803d80:	00 
+  803d81:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  803d86:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803d8d:	00 
+  803d8e:	89 34 24             	mov    %esi,(%esp)
+  803d91:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803d95:	8d 76 00             	lea    0x0(%esi),%esi
+  803d98:	89 e9                	mov    %ebp,%ecx
+  803d9a:	89 c3                	mov    %eax,%ebx
+  803d9c:	89 d6                	mov    %edx,%esi
+  803d9e:	31 ff                	xor    %edi,%edi
+  803da0:	d3 ee                	shr    %cl,%esi
+  803da2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  803da5:	f6 c1 20             	test   $0x20,%cl
+  803da8:	0f 45 de             	cmovne %esi,%ebx
+  803dab:	0f 45 f7             	cmovne %edi,%esi
+  803dae:	8b 3c 24             	mov    (%esp),%edi
+  803db1:	39 fb                	cmp    %edi,%ebx
+  803db3:	89 f7                	mov    %esi,%edi
+  803db5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803db9:	8b 1c 24             	mov    (%esp),%ebx
+  803dbc:	19 f7                	sbb    %esi,%edi
+  803dbe:	72 39                	jb     803df9 <__udivdi3+0xa9>
+  803dc0:	89 e9                	mov    %ebp,%ecx
+  803dc2:	89 f7                	mov    %esi,%edi
+  803dc4:	89 de                	mov    %ebx,%esi
+  803dc6:	0f a5 df             	shld   %cl,%ebx,%edi
+  803dc9:	d3 e6                	shl    %cl,%esi
+  803dcb:	31 db                	xor    %ebx,%ebx
+  803dcd:	f6 c1 20             	test   $0x20,%cl
+  803dd0:	0f 45 fe             	cmovne %esi,%edi
+  803dd3:	0f 45 f3             	cmovne %ebx,%esi
+  803dd6:	29 f0                	sub    %esi,%eax
+  803dd8:	be 01 00 00 00       	mov    $0x1,%esi
+  803ddd:	19 fa                	sbb    %edi,%edx
+  803ddf:	31 ff                	xor    %edi,%edi
+  803de1:	31 db                	xor    %ebx,%ebx
+  803de3:	0f a5 f7             	shld   %cl,%esi,%edi
+  803de6:	d3 e6                	shl    %cl,%esi
+  803de8:	f6 c1 20             	test   $0x20,%cl
+  803deb:	0f 45 fe             	cmovne %esi,%edi
+  803dee:	0f 45 f3             	cmovne %ebx,%esi
+  803df1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803df5:	09 74 24 08          	or     %esi,0x8(%esp)
+  803df9:	83 ed 01             	sub    $0x1,%ebp
+  803dfc:	73 9a                	jae    803d98 <__udivdi3+0x48>
+  803dfe:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803e02:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803e06:	83 c4 14             	add    $0x14,%esp
+  803e09:	5b                   	pop    %ebx
+  803e0a:	5e                   	pop    %esi
+  803e0b:	5f                   	pop    %edi
+  803e0c:	5d                   	pop    %ebp
+  803e0d:	c3                   	ret
+  803e0e:	66 90                	xchg   %ax,%ax
+
+00803e10 <__umoddi3>:
+  803e10:	57                   	push   %edi
+  803e11:	56                   	push   %esi
+  803e12:	53                   	push   %ebx
+  803e13:	83 ec 08             	sub    $0x8,%esp
+  803e16:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803e1a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803e1e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803e22:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803e26:	89 f9                	mov    %edi,%ecx
+  803e28:	89 34 24             	mov    %esi,(%esp)
+  803e2b:	09 f1                	or     %esi,%ecx
+  803e2d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803e31:	74 53                	je     803e86 <__umoddi3+0x76>
+  803e33:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803e38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803e3f:	90                   	nop
+  803e40:	89 c6                	mov    %eax,%esi
+  803e42:	89 d7                	mov    %edx,%edi
+  803e44:	31 db                	xor    %ebx,%ebx
+  803e46:	d3 ef                	shr    %cl,%edi
+  803e48:	0f ad d6             	shrd   %cl,%edx,%esi
+  803e4b:	f6 c1 20             	test   $0x20,%cl
+  803e4e:	0f 45 f7             	cmovne %edi,%esi
+  803e51:	0f 45 fb             	cmovne %ebx,%edi
+  803e54:	8b 1c 24             	mov    (%esp),%ebx
+  803e57:	39 de                	cmp    %ebx,%esi
+  803e59:	89 fb                	mov    %edi,%ebx
+  803e5b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  803e5f:	8b 34 24             	mov    (%esp),%esi
+  803e62:	19 fb                	sbb    %edi,%ebx
+  803e64:	72 14                	jb     803e7a <__umoddi3+0x6a>
+  803e66:	0f a5 f7             	shld   %cl,%esi,%edi
+  803e69:	31 db                	xor    %ebx,%ebx
+  803e6b:	d3 e6                	shl    %cl,%esi
+  803e6d:	f6 c1 20             	test   $0x20,%cl
+  803e70:	0f 45 fe             	cmovne %esi,%edi
+  803e73:	0f 45 f3             	cmovne %ebx,%esi
+  803e76:	29 f0                	sub    %esi,%eax
+  803e78:	19 fa                	sbb    %edi,%edx
+  803e7a:	83 e9 01             	sub    $0x1,%ecx
+  803e7d:	73 c1                	jae    803e40 <__umoddi3+0x30>
+  803e7f:	83 c4 08             	add    $0x8,%esp
+  803e82:	5b                   	pop    %ebx
+  803e83:	5e                   	pop    %esi
+  803e84:	5f                   	pop    %edi
+  803e85:	c3                   	ret
+  803e86:	83 c4 08             	add    $0x8,%esp
+  803e89:	31 c0                	xor    %eax,%eax
+  803e8b:	31 d2                	xor    %edx,%edx
+  803e8d:	5b                   	pop    %ebx
+  803e8e:	5e                   	pop    %esi
+  803e8f:	5f                   	pop    %edi
+  803e90:	c3                   	ret
+  803e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803e98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803e9f:	90                   	nop
+
+00803ea0 <__divdi3>:
+  803ea0:	55                   	push   %ebp
+  803ea1:	57                   	push   %edi
+  803ea2:	56                   	push   %esi
+  803ea3:	53                   	push   %ebx
+  803ea4:	83 ec 1c             	sub    $0x1c,%esp
+  803ea7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  803eab:	8b 74 24 30          	mov    0x30(%esp),%esi
+  803eaf:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  803eb3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  803eb7:	85 ff                	test   %edi,%edi
+  803eb9:	0f 88 da 00 00 00    	js     803f99 <__divdi3+0xf9>
+  803ebf:	85 db                	test   %ebx,%ebx
+  803ec1:	78 16                	js     803ed9 <__divdi3+0x39>
+  803ec3:	89 dd                	mov    %ebx,%ebp
+  803ec5:	89 c8                	mov    %ecx,%eax
+  803ec7:	89 da                	mov    %ebx,%edx
+  803ec9:	09 cd                	or     %ecx,%ebp
+  803ecb:	0f 85 fd 00 00 00    	jne    803fce <__divdi3+0x12e>
+  803ed1:	83 c4 1c             	add    $0x1c,%esp
+  803ed4:	5b                   	pop    %ebx
+  803ed5:	5e                   	pop    %esi
+  803ed6:	5f                   	pop    %edi
+  803ed7:	5d                   	pop    %ebp
+  803ed8:	c3                   	ret
+  803ed9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  803ede:	f7 d9                	neg    %ecx
+  803ee0:	89 f0                	mov    %esi,%eax
+  803ee2:	89 fa                	mov    %edi,%edx
+  803ee4:	83 d3 00             	adc    $0x0,%ebx
+  803ee7:	89 0c 24             	mov    %ecx,(%esp)
+  803eea:	f7 db                	neg    %ebx
+  803eec:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  803ef0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803ef7:	00 
+  803ef8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803efd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803f04:	00 
+  803f05:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  803f09:	89 cd                	mov    %ecx,%ebp
+  803f0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  803f0f:	90                   	nop
+  803f10:	89 e9                	mov    %ebp,%ecx
+  803f12:	89 c3                	mov    %eax,%ebx
+  803f14:	89 d6                	mov    %edx,%esi
+  803f16:	31 ff                	xor    %edi,%edi
+  803f18:	d3 ee                	shr    %cl,%esi
+  803f1a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  803f1d:	f6 c1 20             	test   $0x20,%cl
+  803f20:	0f 45 de             	cmovne %esi,%ebx
+  803f23:	0f 45 f7             	cmovne %edi,%esi
+  803f26:	8b 3c 24             	mov    (%esp),%edi
+  803f29:	39 fb                	cmp    %edi,%ebx
+  803f2b:	89 f7                	mov    %esi,%edi
+  803f2d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803f31:	8b 1c 24             	mov    (%esp),%ebx
+  803f34:	19 f7                	sbb    %esi,%edi
+  803f36:	72 39                	jb     803f71 <__divdi3+0xd1>
+  803f38:	89 e9                	mov    %ebp,%ecx
+  803f3a:	89 f7                	mov    %esi,%edi
+  803f3c:	89 de                	mov    %ebx,%esi
+  803f3e:	0f a5 df             	shld   %cl,%ebx,%edi
+  803f41:	d3 e6                	shl    %cl,%esi
+  803f43:	31 db                	xor    %ebx,%ebx
+  803f45:	f6 c1 20             	test   $0x20,%cl
+  803f48:	0f 45 fe             	cmovne %esi,%edi
+  803f4b:	0f 45 f3             	cmovne %ebx,%esi
+  803f4e:	29 f0                	sub    %esi,%eax
+  803f50:	be 01 00 00 00       	mov    $0x1,%esi
+  803f55:	19 fa                	sbb    %edi,%edx
+  803f57:	31 ff                	xor    %edi,%edi
+  803f59:	31 db                	xor    %ebx,%ebx
+  803f5b:	0f a5 f7             	shld   %cl,%esi,%edi
+  803f5e:	d3 e6                	shl    %cl,%esi
+  803f60:	f6 c1 20             	test   $0x20,%cl
+  803f63:	0f 45 fe             	cmovne %esi,%edi
+  803f66:	0f 45 f3             	cmovne %ebx,%esi
+  803f69:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803f6d:	09 74 24 08          	or     %esi,0x8(%esp)
+  803f71:	83 ed 01             	sub    $0x1,%ebp
+  803f74:	73 9a                	jae    803f10 <__divdi3+0x70>
+  803f76:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  803f7a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803f7e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803f82:	85 ed                	test   %ebp,%ebp
+  803f84:	0f 84 47 ff ff ff    	je     803ed1 <__divdi3+0x31>
+  803f8a:	f7 d8                	neg    %eax
+  803f8c:	83 d2 00             	adc    $0x0,%edx
+  803f8f:	83 c4 1c             	add    $0x1c,%esp
+  803f92:	5b                   	pop    %ebx
+  803f93:	f7 da                	neg    %edx
+  803f95:	5e                   	pop    %esi
+  803f96:	5f                   	pop    %edi
+  803f97:	5d                   	pop    %ebp
+  803f98:	c3                   	ret
+  803f99:	f7 de                	neg    %esi
+  803f9b:	83 d7 00             	adc    $0x0,%edi
+  803f9e:	f7 df                	neg    %edi
+  803fa0:	85 db                	test   %ebx,%ebx
+  803fa2:	78 23                	js     803fc7 <__divdi3+0x127>
+  803fa4:	89 dd                	mov    %ebx,%ebp
+  803fa6:	89 c8                	mov    %ecx,%eax
+  803fa8:	89 da                	mov    %ebx,%edx
+  803faa:	09 cd                	or     %ecx,%ebp
+  803fac:	0f 84 1f ff ff ff    	je     803ed1 <__divdi3+0x31>
+  803fb2:	89 0c 24             	mov    %ecx,(%esp)
+  803fb5:	89 f0                	mov    %esi,%eax
+  803fb7:	89 fa                	mov    %edi,%edx
+  803fb9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  803fbe:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  803fc2:	e9 29 ff ff ff       	jmp    803ef0 <__divdi3+0x50>
+  803fc7:	31 ed                	xor    %ebp,%ebp
+  803fc9:	e9 10 ff ff ff       	jmp    803ede <__divdi3+0x3e>
+  803fce:	89 0c 24             	mov    %ecx,(%esp)
+  803fd1:	89 f0                	mov    %esi,%eax
+  803fd3:	89 fa                	mov    %edi,%edx
+  803fd5:	31 ed                	xor    %ebp,%ebp
+  803fd7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  803fdb:	e9 10 ff ff ff       	jmp    803ef0 <__divdi3+0x50>
+
+00803fe0 <__moddi3>:
+  803fe0:	55                   	push   %ebp
+  803fe1:	57                   	push   %edi
+  803fe2:	56                   	push   %esi
+  803fe3:	53                   	push   %ebx
+  803fe4:	83 ec 14             	sub    $0x14,%esp
+  803fe7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803feb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803fef:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803ff3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  803ff7:	85 d2                	test   %edx,%edx
+  803ff9:	0f 88 9b 00 00 00    	js     80409a <__moddi3+0xba>
+  803fff:	89 f7                	mov    %esi,%edi
+  804001:	31 ed                	xor    %ebp,%ebp
+  804003:	09 cf                	or     %ecx,%edi
+  804005:	0f 84 83 00 00 00    	je     80408e <__moddi3+0xae>
+  80400b:	89 cb                	mov    %ecx,%ebx
+  80400d:	89 f7                	mov    %esi,%edi
+  80400f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  804013:	f7 db                	neg    %ebx
+  804015:	83 d7 00             	adc    $0x0,%edi
+  804018:	f7 df                	neg    %edi
+  80401a:	0f 49 f7             	cmovns %edi,%esi
+  80401d:	0f 49 cb             	cmovns %ebx,%ecx
+  804020:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804024:	89 0c 24             	mov    %ecx,(%esp)
+  804027:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80402c:	89 cd                	mov    %ecx,%ebp
+  80402e:	66 90                	xchg   %ax,%ax
+  804030:	89 e9                	mov    %ebp,%ecx
+  804032:	89 c3                	mov    %eax,%ebx
+  804034:	89 d6                	mov    %edx,%esi
+  804036:	31 ff                	xor    %edi,%edi
+  804038:	d3 ee                	shr    %cl,%esi
+  80403a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80403d:	f6 c1 20             	test   $0x20,%cl
+  804040:	0f 45 de             	cmovne %esi,%ebx
+  804043:	0f 45 f7             	cmovne %edi,%esi
+  804046:	8b 3c 24             	mov    (%esp),%edi
+  804049:	39 fb                	cmp    %edi,%ebx
+  80404b:	89 f7                	mov    %esi,%edi
+  80404d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  804051:	8b 1c 24             	mov    (%esp),%ebx
+  804054:	19 f7                	sbb    %esi,%edi
+  804056:	72 1a                	jb     804072 <__moddi3+0x92>
+  804058:	89 e9                	mov    %ebp,%ecx
+  80405a:	89 f7                	mov    %esi,%edi
+  80405c:	89 de                	mov    %ebx,%esi
+  80405e:	0f a5 df             	shld   %cl,%ebx,%edi
+  804061:	d3 e6                	shl    %cl,%esi
+  804063:	31 db                	xor    %ebx,%ebx
+  804065:	f6 c1 20             	test   $0x20,%cl
+  804068:	0f 45 fe             	cmovne %esi,%edi
+  80406b:	0f 45 f3             	cmovne %ebx,%esi
+  80406e:	29 f0                	sub    %esi,%eax
+  804070:	19 fa                	sbb    %edi,%edx
+  804072:	83 ed 01             	sub    $0x1,%ebp
+  804075:	73 b9                	jae    804030 <__moddi3+0x50>
+  804077:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80407b:	85 ed                	test   %ebp,%ebp
+  80407d:	74 07                	je     804086 <__moddi3+0xa6>
+  80407f:	f7 d8                	neg    %eax
+  804081:	83 d2 00             	adc    $0x0,%edx
+  804084:	f7 da                	neg    %edx
+  804086:	83 c4 14             	add    $0x14,%esp
+  804089:	5b                   	pop    %ebx
+  80408a:	5e                   	pop    %esi
+  80408b:	5f                   	pop    %edi
+  80408c:	5d                   	pop    %ebp
+  80408d:	c3                   	ret
+  80408e:	83 c4 14             	add    $0x14,%esp
+  804091:	31 c0                	xor    %eax,%eax
+  804093:	31 d2                	xor    %edx,%edx
+  804095:	5b                   	pop    %ebx
+  804096:	5e                   	pop    %esi
+  804097:	5f                   	pop    %edi
+  804098:	5d                   	pop    %ebp
+  804099:	c3                   	ret
+  80409a:	89 f7                	mov    %esi,%edi
+  80409c:	09 cf                	or     %ecx,%edi
+  80409e:	74 11                	je     8040b1 <__moddi3+0xd1>
+  8040a0:	f7 d8                	neg    %eax
+  8040a2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8040a7:	83 d2 00             	adc    $0x0,%edx
+  8040aa:	f7 da                	neg    %edx
+  8040ac:	e9 5a ff ff ff       	jmp    80400b <__moddi3+0x2b>
+  8040b1:	31 c0                	xor    %eax,%eax
+  8040b3:	31 d2                	xor    %edx,%edx
+  8040b5:	eb c8                	jmp    80407f <__moddi3+0x9f>
@@ -0,0 +1,20413 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+f0100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fe 4f 52             	decb   0x52(%edi)
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+.globl		_start
+_start = RELOC(entry)
+
+.globl entry
+entry:
+	movw	$0x1234,0x472			# warm boot
+f010000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f0100013:	34 12 
+	# sufficient until we set up our real page table in mem_init
+	# in lab 2.
+
+	# Load the physical address of entry_pgdir into cr3.  entry_pgdir
+	# is defined in entrypgdir.c.
+	movl	$(RELOC(entry_pgdir)), %eax
+f0100015:	b8 00 70 11 00       	mov    $0x117000,%eax
+	movl	%eax, %cr3
+f010001a:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl	%cr0, %eax
+f010001d:	0f 20 c0             	mov    %cr0,%eax
+	orl	$(CR0_PE|CR0_PG|CR0_WP), %eax
+f0100020:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl	%eax, %cr0
+f0100025:	0f 22 c0             	mov    %eax,%cr0
+
+	# Now paging is enabled, but we're still running at a low EIP
+	# (why is this okay?).  Jump up above KERNBASE before entering
+	# C code.
+	mov	$relocated, %eax
+f0100028:	b8 2f 00 10 f0       	mov    $0xf010002f,%eax
+	jmp	*%eax
+f010002d:	ff e0                	jmp    *%eax
+
+f010002f <relocated>:
+relocated:
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0,%ebp			# nuke frame pointer
+f010002f:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(bootstacktop),%esp
+f0100034:	bc 00 70 11 f0       	mov    $0xf0117000,%esp
+
+	# now to C code
+	call	i386_init
+f0100039:	e8 b9 00 00 00       	call   f01000f7 <i386_init>
+
+f010003e <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+f010003e:	eb fe                	jmp    f010003e <spin>
+
+f0100040 <mp_main>:
+}
+
+// Setup code for APs
+void
+mp_main(void)
+{
+f0100040:	55                   	push   %ebp
+f0100041:	89 e5                	mov    %esp,%ebp
+f0100043:	83 ec 08             	sub    $0x8,%esp
+	// We are in high EIP now, safe to switch to kern_pgdir 
+	mem_init_percpu();
+f0100046:	e8 c1 1c 00 00       	call   f0101d0c <mem_init_percpu>
+	cprintf("SMP: CPU %d starting\n", cpunum());
+f010004b:	e8 f4 ab 00 00       	call   f010ac44 <cpunum>
+f0100050:	83 ec 08             	sub    $0x8,%esp
+f0100053:	50                   	push   %eax
+f0100054:	68 a0 bf 10 f0       	push   $0xf010bfa0
+f0100059:	e8 9e 6f 00 00       	call   f0106ffc <cprintf>
+
+	lapic_init();
+f010005e:	e8 f7 ab 00 00       	call   f010ac5a <lapic_init>
+	env_init_percpu();
+f0100063:	e8 ae 62 00 00       	call   f0106316 <env_init_percpu>
+	trap_init_percpu();
+f0100068:	e8 a3 6f 00 00       	call   f0107010 <trap_init_percpu>
+	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
+f010006d:	e8 d2 ab 00 00       	call   f010ac44 <cpunum>
+f0100072:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+f0100078:	83 c2 04             	add    $0x4,%edx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+f010007b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100080:	f0 87 82 20 90 61 f0 	lock xchg %eax,-0xf9e6fe0(%edx)
+extern struct spinlock kernel_lock;
+
+static inline void
+lock_kernel(void)
+{
+	spin_lock(&kernel_lock);
+f0100087:	c7 04 24 c0 95 11 f0 	movl   $0xf01195c0,(%esp)
+f010008e:	e8 40 ae 00 00       	call   f010aed3 <spin_lock>
+	// to start running processes on this CPU.  But make sure that
+	// only one CPU can enter the scheduler at a time!
+	//
+	// Your code here:
+	lock_kernel();
+	sched_yield();
+f0100093:	e8 06 82 00 00       	call   f010829e <sched_yield>
+
+f0100098 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: mesg", and then enters the kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt,...)
+{
+f0100098:	55                   	push   %ebp
+f0100099:	89 e5                	mov    %esp,%ebp
+f010009b:	53                   	push   %ebx
+f010009c:	83 ec 04             	sub    $0x4,%esp
+	va_list ap;
+
+	if (panicstr)
+f010009f:	83 3d 64 89 61 f0 00 	cmpl   $0x0,0xf0618964
+f01000a6:	74 0f                	je     f01000b7 <_panic+0x1f>
+	va_end(ap);
+
+dead:
+	/* break into the kernel monitor */
+	while (1)
+		monitor(NULL);
+f01000a8:	83 ec 0c             	sub    $0xc,%esp
+f01000ab:	6a 00                	push   $0x0
+f01000ad:	e8 67 13 00 00       	call   f0101419 <monitor>
+f01000b2:	83 c4 10             	add    $0x10,%esp
+f01000b5:	eb f1                	jmp    f01000a8 <_panic+0x10>
+	panicstr = fmt;
+f01000b7:	8b 45 10             	mov    0x10(%ebp),%eax
+f01000ba:	a3 64 89 61 f0       	mov    %eax,0xf0618964
+	__asm __volatile("cli; cld");
+f01000bf:	fa                   	cli
+f01000c0:	fc                   	cld
+	va_start(ap, fmt);
+f01000c1:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel panic on CPU %d at %s:%d: ", cpunum(), file, line);
+f01000c4:	e8 7b ab 00 00       	call   f010ac44 <cpunum>
+f01000c9:	ff 75 0c             	push   0xc(%ebp)
+f01000cc:	ff 75 08             	push   0x8(%ebp)
+f01000cf:	50                   	push   %eax
+f01000d0:	68 f8 bf 10 f0       	push   $0xf010bff8
+f01000d5:	e8 22 6f 00 00       	call   f0106ffc <cprintf>
+	vcprintf(fmt, ap);
+f01000da:	83 c4 08             	add    $0x8,%esp
+f01000dd:	53                   	push   %ebx
+f01000de:	ff 75 10             	push   0x10(%ebp)
+f01000e1:	e8 f0 6e 00 00       	call   f0106fd6 <vcprintf>
+	cprintf("\n");
+f01000e6:	c7 04 24 30 db 10 f0 	movl   $0xf010db30,(%esp)
+f01000ed:	e8 0a 6f 00 00       	call   f0106ffc <cprintf>
+f01000f2:	83 c4 10             	add    $0x10,%esp
+f01000f5:	eb b1                	jmp    f01000a8 <_panic+0x10>
+
+f01000f7 <i386_init>:
+{
+f01000f7:	55                   	push   %ebp
+f01000f8:	89 e5                	mov    %esp,%ebp
+f01000fa:	53                   	push   %ebx
+f01000fb:	83 ec 08             	sub    $0x8,%esp
+	memset(edata, 0, end - edata);
+f01000fe:	b8 0c a0 65 f0       	mov    $0xf065a00c,%eax
+f0100103:	2d 94 0f 61 f0       	sub    $0xf0610f94,%eax
+f0100108:	50                   	push   %eax
+f0100109:	6a 00                	push   $0x0
+f010010b:	68 94 0f 61 f0       	push   $0xf0610f94
+f0100110:	e8 e9 a4 00 00       	call   f010a5fe <memset>
+	cons_init();
+f0100115:	e8 74 05 00 00       	call   f010068e <cons_init>
+	cprintf("6828 decimal is %o octal!\n", 6828);
+f010011a:	83 c4 08             	add    $0x8,%esp
+f010011d:	68 ac 1a 00 00       	push   $0x1aac
+f0100122:	68 b6 bf 10 f0       	push   $0xf010bfb6
+f0100127:	e8 d0 6e 00 00       	call   f0106ffc <cprintf>
+	mem_init();
+f010012c:	e8 e7 30 00 00       	call   f0103218 <mem_init>
+	kmem_init();
+f0100131:	e8 b1 53 00 00       	call   f01054e7 <kmem_init>
+	env_init();
+f0100136:	e8 07 62 00 00       	call   f0106342 <env_init>
+	trap_init();
+f010013b:	e8 b1 6f 00 00       	call   f01070f1 <trap_init>
+	mp_init();
+f0100140:	e8 b8 a7 00 00       	call   f010a8fd <mp_init>
+	lapic_init();
+f0100145:	e8 10 ab 00 00       	call   f010ac5a <lapic_init>
+	pic_init();
+f010014a:	e8 bc 6d 00 00       	call   f0106f0b <pic_init>
+	time_init();
+f010014f:	e8 bf b9 00 00       	call   f010bb13 <time_init>
+	pci_init();
+f0100154:	e8 9a b9 00 00       	call   f010baf3 <pci_init>
+f0100159:	c7 04 24 c0 95 11 f0 	movl   $0xf01195c0,(%esp)
+f0100160:	e8 6e ad 00 00       	call   f010aed3 <spin_lock>
+#define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
+
+static inline void*
+_kaddr(const char *file, int line, physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages_lowmem)
+f0100165:	83 c4 10             	add    $0x10,%esp
+f0100168:	83 3d 6c 89 61 f0 07 	cmpl   $0x7,0xf061896c
+f010016f:	76 27                	jbe    f0100198 <i386_init+0xa1>
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+f0100171:	83 ec 04             	sub    $0x4,%esp
+f0100174:	b8 5a a8 10 f0       	mov    $0xf010a85a,%eax
+f0100179:	2d e0 a7 10 f0       	sub    $0xf010a7e0,%eax
+f010017e:	50                   	push   %eax
+f010017f:	68 e0 a7 10 f0       	push   $0xf010a7e0
+f0100184:	68 00 70 00 f0       	push   $0xf0007000
+f0100189:	e8 a5 a4 00 00       	call   f010a633 <memmove>
+	for (c = cpus; c < cpus + ncpu; c++) {
+f010018e:	83 c4 10             	add    $0x10,%esp
+f0100191:	bb 20 90 61 f0       	mov    $0xf0619020,%ebx
+f0100196:	eb 1c                	jmp    f01001b4 <i386_init+0xbd>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100198:	68 00 70 00 00       	push   $0x7000
+f010019d:	68 1c c0 10 f0       	push   $0xf010c01c
+f01001a2:	6a 67                	push   $0x67
+f01001a4:	68 d1 bf 10 f0       	push   $0xf010bfd1
+f01001a9:	e8 ea fe ff ff       	call   f0100098 <_panic>
+f01001ae:	81 c3 bc 00 00 00    	add    $0xbc,%ebx
+f01001b4:	69 05 04 96 61 f0 bc 	imul   $0xbc,0xf0619604,%eax
+f01001bb:	00 00 00 
+f01001be:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f01001c3:	39 c3                	cmp    %eax,%ebx
+f01001c5:	73 50                	jae    f0100217 <i386_init+0x120>
+		if (c == cpus + cpunum())  // We've started already.
+f01001c7:	e8 78 aa 00 00       	call   f010ac44 <cpunum>
+f01001cc:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01001d2:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f01001d7:	39 c3                	cmp    %eax,%ebx
+f01001d9:	74 d3                	je     f01001ae <i386_init+0xb7>
+		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
+f01001db:	89 d8                	mov    %ebx,%eax
+f01001dd:	2d 20 90 61 f0       	sub    $0xf0619020,%eax
+f01001e2:	c1 f8 02             	sar    $0x2,%eax
+f01001e5:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+f01001eb:	c1 e0 0f             	shl    $0xf,%eax
+f01001ee:	8d 80 00 20 62 f0    	lea    -0xf9de000(%eax),%eax
+f01001f4:	a3 68 89 61 f0       	mov    %eax,0xf0618968
+		lapic_startap(c->cpu_id, PADDR(code));
+f01001f9:	83 ec 08             	sub    $0x8,%esp
+f01001fc:	68 00 70 00 00       	push   $0x7000
+f0100201:	0f b6 03             	movzbl (%ebx),%eax
+f0100204:	50                   	push   %eax
+f0100205:	e8 7d ab 00 00       	call   f010ad87 <lapic_startap>
+		while(c->cpu_status != CPU_STARTED)
+f010020a:	83 c4 10             	add    $0x10,%esp
+f010020d:	8b 43 04             	mov    0x4(%ebx),%eax
+f0100210:	83 f8 01             	cmp    $0x1,%eax
+f0100213:	75 f8                	jne    f010020d <i386_init+0x116>
+f0100215:	eb 97                	jmp    f01001ae <i386_init+0xb7>
+	ENV_CREATE(fs_fs, ENV_TYPE_FS);
+f0100217:	83 ec 08             	sub    $0x8,%esp
+f010021a:	6a 01                	push   $0x1
+f010021c:	68 80 b5 43 f0       	push   $0xf043b580
+f0100221:	e8 b5 65 00 00       	call   f01067db <env_create>
+	ENV_CREATE(net_ns, ENV_TYPE_NS);
+f0100226:	83 c4 08             	add    $0x8,%esp
+f0100229:	6a 02                	push   $0x2
+f010022b:	68 18 ca 4e f0       	push   $0xf04eca18
+f0100230:	e8 a6 65 00 00       	call   f01067db <env_create>
+	ENV_CREATE(user_icode, ENV_TYPE_USER);
+f0100235:	83 c4 08             	add    $0x8,%esp
+f0100238:	6a 00                	push   $0x0
+f010023a:	68 54 36 42 f0       	push   $0xf0423654
+f010023f:	e8 97 65 00 00       	call   f01067db <env_create>
+	kbd_intr();
+f0100244:	e8 d0 03 00 00       	call   f0100619 <kbd_intr>
+	sched_yield();
+f0100249:	e8 50 80 00 00       	call   f010829e <sched_yield>
+
+f010024e <_warn>:
+}
+
+/* like panic, but don't */
+void
+_warn(const char *file, int line, const char *fmt,...)
+{
+f010024e:	55                   	push   %ebp
+f010024f:	89 e5                	mov    %esp,%ebp
+f0100251:	53                   	push   %ebx
+f0100252:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+
+	va_start(ap, fmt);
+f0100255:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel warning at %s:%d: ", file, line);
+f0100258:	ff 75 0c             	push   0xc(%ebp)
+f010025b:	ff 75 08             	push   0x8(%ebp)
+f010025e:	68 dd bf 10 f0       	push   $0xf010bfdd
+f0100263:	e8 94 6d 00 00       	call   f0106ffc <cprintf>
+	vcprintf(fmt, ap);
+f0100268:	83 c4 08             	add    $0x8,%esp
+f010026b:	53                   	push   %ebx
+f010026c:	ff 75 10             	push   0x10(%ebp)
+f010026f:	e8 62 6d 00 00       	call   f0106fd6 <vcprintf>
+	cprintf("\n");
+f0100274:	c7 04 24 30 db 10 f0 	movl   $0xf010db30,(%esp)
+f010027b:	e8 7c 6d 00 00       	call   f0106ffc <cprintf>
+	va_end(ap);
+}
+f0100280:	83 c4 10             	add    $0x10,%esp
+f0100283:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100286:	c9                   	leave
+f0100287:	c3                   	ret
+
+f0100288 <serial_proc_data>:
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100288:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f010028d:	ec                   	in     (%dx),%al
+static bool serial_exists;
+
+static int
+serial_proc_data(void)
+{
+	if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+f010028e:	a8 01                	test   $0x1,%al
+f0100290:	74 0a                	je     f010029c <serial_proc_data+0x14>
+f0100292:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100297:	ec                   	in     (%dx),%al
+		return -1;
+	return inb(COM1+COM_RX);
+f0100298:	0f b6 c0             	movzbl %al,%eax
+f010029b:	c3                   	ret
+		return -1;
+f010029c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f01002a1:	c3                   	ret
+
+f01002a2 <cons_intr>:
+
+// called by device interrupt routines to feed input characters
+// into the circular console input buffer.
+static void
+cons_intr(int (*proc)(void))
+{
+f01002a2:	55                   	push   %ebp
+f01002a3:	89 e5                	mov    %esp,%ebp
+f01002a5:	53                   	push   %ebx
+f01002a6:	83 ec 10             	sub    $0x10,%esp
+f01002a9:	89 c3                	mov    %eax,%ebx
+	int c;
+
+	spin_lock(&cons_lock);
+f01002ab:	68 00 90 11 f0       	push   $0xf0119000
+f01002b0:	e8 1e ac 00 00       	call   f010aed3 <spin_lock>
+	while ((c = (*proc)()) != -1) {
+f01002b5:	83 c4 10             	add    $0x10,%esp
+f01002b8:	eb 23                	jmp    f01002dd <cons_intr+0x3b>
+		if (c == 0)
+			continue;
+		cons.buf[cons.wpos++] = c;
+f01002ba:	8b 0d 24 12 61 f0    	mov    0xf0611224,%ecx
+f01002c0:	8d 51 01             	lea    0x1(%ecx),%edx
+f01002c3:	88 81 20 10 61 f0    	mov    %al,-0xf9eefe0(%ecx)
+		if (cons.wpos == CONSBUFSIZE)
+f01002c9:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+			cons.wpos = 0;
+f01002cf:	b8 00 00 00 00       	mov    $0x0,%eax
+f01002d4:	0f 44 d0             	cmove  %eax,%edx
+f01002d7:	89 15 24 12 61 f0    	mov    %edx,0xf0611224
+	while ((c = (*proc)()) != -1) {
+f01002dd:	ff d3                	call   *%ebx
+f01002df:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01002e2:	74 06                	je     f01002ea <cons_intr+0x48>
+		if (c == 0)
+f01002e4:	85 c0                	test   %eax,%eax
+f01002e6:	75 d2                	jne    f01002ba <cons_intr+0x18>
+f01002e8:	eb f3                	jmp    f01002dd <cons_intr+0x3b>
+	}
+	spin_unlock(&cons_lock);
+f01002ea:	83 ec 0c             	sub    $0xc,%esp
+f01002ed:	68 00 90 11 f0       	push   $0xf0119000
+f01002f2:	e8 f8 ac 00 00       	call   f010afef <spin_unlock>
+}
+f01002f7:	83 c4 10             	add    $0x10,%esp
+f01002fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01002fd:	c9                   	leave
+f01002fe:	c3                   	ret
+
+f01002ff <kbd_proc_data>:
+{
+f01002ff:	55                   	push   %ebp
+f0100300:	89 e5                	mov    %esp,%ebp
+f0100302:	53                   	push   %ebx
+f0100303:	83 ec 04             	sub    $0x4,%esp
+f0100306:	ba 64 00 00 00       	mov    $0x64,%edx
+f010030b:	ec                   	in     (%dx),%al
+	if ((inb(KBSTATP) & KBS_DIB) == 0)
+f010030c:	a8 01                	test   $0x1,%al
+f010030e:	0f 84 e6 00 00 00    	je     f01003fa <kbd_proc_data+0xfb>
+f0100314:	ba 60 00 00 00       	mov    $0x60,%edx
+f0100319:	ec                   	in     (%dx),%al
+f010031a:	89 c2                	mov    %eax,%edx
+	if (data == 0xE0) {
+f010031c:	3c e0                	cmp    $0xe0,%al
+f010031e:	74 61                	je     f0100381 <kbd_proc_data+0x82>
+	} else if (data & 0x80) {
+f0100320:	84 c0                	test   %al,%al
+f0100322:	78 70                	js     f0100394 <kbd_proc_data+0x95>
+	} else if (shift & E0ESC) {
+f0100324:	8b 0d 00 10 61 f0    	mov    0xf0611000,%ecx
+f010032a:	f6 c1 40             	test   $0x40,%cl
+f010032d:	74 0e                	je     f010033d <kbd_proc_data+0x3e>
+		data |= 0x80;
+f010032f:	83 c8 80             	or     $0xffffff80,%eax
+f0100332:	89 c2                	mov    %eax,%edx
+		shift &= ~E0ESC;
+f0100334:	83 e1 bf             	and    $0xffffffbf,%ecx
+f0100337:	89 0d 00 10 61 f0    	mov    %ecx,0xf0611000
+	shift |= shiftcode[data];
+f010033d:	0f b6 d2             	movzbl %dl,%edx
+f0100340:	0f b6 82 a0 c1 10 f0 	movzbl -0xfef3e60(%edx),%eax
+f0100347:	0b 05 00 10 61 f0    	or     0xf0611000,%eax
+	shift ^= togglecode[data];
+f010034d:	0f b6 8a a0 c0 10 f0 	movzbl -0xfef3f60(%edx),%ecx
+f0100354:	31 c8                	xor    %ecx,%eax
+f0100356:	a3 00 10 61 f0       	mov    %eax,0xf0611000
+	c = charcode[shift & (CTL | SHIFT)][data];
+f010035b:	89 c1                	mov    %eax,%ecx
+f010035d:	83 e1 03             	and    $0x3,%ecx
+f0100360:	8b 0c 8d 80 c0 10 f0 	mov    -0xfef3f80(,%ecx,4),%ecx
+f0100367:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f010036b:	0f b6 da             	movzbl %dl,%ebx
+	if (shift & CAPSLOCK) {
+f010036e:	a8 08                	test   $0x8,%al
+f0100370:	74 5d                	je     f01003cf <kbd_proc_data+0xd0>
+		if ('a' <= c && c <= 'z')
+f0100372:	89 da                	mov    %ebx,%edx
+f0100374:	8d 4b 9f             	lea    -0x61(%ebx),%ecx
+f0100377:	83 f9 19             	cmp    $0x19,%ecx
+f010037a:	77 47                	ja     f01003c3 <kbd_proc_data+0xc4>
+			c += 'A' - 'a';
+f010037c:	83 eb 20             	sub    $0x20,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f010037f:	eb 0c                	jmp    f010038d <kbd_proc_data+0x8e>
+		shift |= E0ESC;
+f0100381:	83 0d 00 10 61 f0 40 	orl    $0x40,0xf0611000
+		return 0;
+f0100388:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f010038d:	89 d8                	mov    %ebx,%eax
+f010038f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100392:	c9                   	leave
+f0100393:	c3                   	ret
+		data = (shift & E0ESC ? data : data & 0x7F);
+f0100394:	8b 0d 00 10 61 f0    	mov    0xf0611000,%ecx
+f010039a:	83 e0 7f             	and    $0x7f,%eax
+f010039d:	f6 c1 40             	test   $0x40,%cl
+f01003a0:	0f 44 d0             	cmove  %eax,%edx
+		shift &= ~(shiftcode[data] | E0ESC);
+f01003a3:	0f b6 d2             	movzbl %dl,%edx
+f01003a6:	0f b6 82 a0 c1 10 f0 	movzbl -0xfef3e60(%edx),%eax
+f01003ad:	83 c8 40             	or     $0x40,%eax
+f01003b0:	0f b6 c0             	movzbl %al,%eax
+f01003b3:	f7 d0                	not    %eax
+f01003b5:	21 c8                	and    %ecx,%eax
+f01003b7:	a3 00 10 61 f0       	mov    %eax,0xf0611000
+		return 0;
+f01003bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01003c1:	eb ca                	jmp    f010038d <kbd_proc_data+0x8e>
+		else if ('A' <= c && c <= 'Z')
+f01003c3:	83 ea 41             	sub    $0x41,%edx
+			c += 'a' - 'A';
+f01003c6:	8d 4b 20             	lea    0x20(%ebx),%ecx
+f01003c9:	83 fa 1a             	cmp    $0x1a,%edx
+f01003cc:	0f 42 d9             	cmovb  %ecx,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f01003cf:	f7 d0                	not    %eax
+f01003d1:	a8 06                	test   $0x6,%al
+f01003d3:	75 b8                	jne    f010038d <kbd_proc_data+0x8e>
+f01003d5:	81 fb e9 00 00 00    	cmp    $0xe9,%ebx
+f01003db:	75 b0                	jne    f010038d <kbd_proc_data+0x8e>
+		cprintf("Rebooting!\n");
+f01003dd:	83 ec 0c             	sub    $0xc,%esp
+f01003e0:	68 3f c0 10 f0       	push   $0xf010c03f
+f01003e5:	e8 12 6c 00 00       	call   f0106ffc <cprintf>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01003ea:	b8 03 00 00 00       	mov    $0x3,%eax
+f01003ef:	ba 92 00 00 00       	mov    $0x92,%edx
+f01003f4:	ee                   	out    %al,(%dx)
+}
+f01003f5:	83 c4 10             	add    $0x10,%esp
+f01003f8:	eb 93                	jmp    f010038d <kbd_proc_data+0x8e>
+		return -1;
+f01003fa:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f01003ff:	eb 8c                	jmp    f010038d <kbd_proc_data+0x8e>
+
+f0100401 <cons_putc>:
+}
+
+// output a character to the console
+static void
+cons_putc(int c)
+{
+f0100401:	55                   	push   %ebp
+f0100402:	89 e5                	mov    %esp,%ebp
+f0100404:	57                   	push   %edi
+f0100405:	56                   	push   %esi
+f0100406:	53                   	push   %ebx
+f0100407:	83 ec 1c             	sub    $0x1c,%esp
+f010040a:	89 c7                	mov    %eax,%edi
+	for (i = 0;
+f010040c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100411:	be fd 03 00 00       	mov    $0x3fd,%esi
+f0100416:	b9 84 00 00 00       	mov    $0x84,%ecx
+f010041b:	89 f2                	mov    %esi,%edx
+f010041d:	ec                   	in     (%dx),%al
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+f010041e:	a8 20                	test   $0x20,%al
+f0100420:	75 13                	jne    f0100435 <cons_putc+0x34>
+f0100422:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100428:	7f 0b                	jg     f0100435 <cons_putc+0x34>
+f010042a:	89 ca                	mov    %ecx,%edx
+f010042c:	ec                   	in     (%dx),%al
+f010042d:	ec                   	in     (%dx),%al
+f010042e:	ec                   	in     (%dx),%al
+f010042f:	ec                   	in     (%dx),%al
+	     i++)
+f0100430:	83 c3 01             	add    $0x1,%ebx
+f0100433:	eb e6                	jmp    f010041b <cons_putc+0x1a>
+	outb(COM1 + COM_TX, c);
+f0100435:	89 f8                	mov    %edi,%eax
+f0100437:	88 45 e7             	mov    %al,-0x19(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010043a:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f010043f:	ee                   	out    %al,(%dx)
+	for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
+f0100440:	bb 00 00 00 00       	mov    $0x0,%ebx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100445:	be 79 03 00 00       	mov    $0x379,%esi
+f010044a:	b9 84 00 00 00       	mov    $0x84,%ecx
+f010044f:	89 f2                	mov    %esi,%edx
+f0100451:	ec                   	in     (%dx),%al
+f0100452:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100458:	7f 0f                	jg     f0100469 <cons_putc+0x68>
+f010045a:	84 c0                	test   %al,%al
+f010045c:	78 0b                	js     f0100469 <cons_putc+0x68>
+f010045e:	89 ca                	mov    %ecx,%edx
+f0100460:	ec                   	in     (%dx),%al
+f0100461:	ec                   	in     (%dx),%al
+f0100462:	ec                   	in     (%dx),%al
+f0100463:	ec                   	in     (%dx),%al
+f0100464:	83 c3 01             	add    $0x1,%ebx
+f0100467:	eb e6                	jmp    f010044f <cons_putc+0x4e>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100469:	ba 78 03 00 00       	mov    $0x378,%edx
+f010046e:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f0100472:	ee                   	out    %al,(%dx)
+f0100473:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f0100478:	b8 0d 00 00 00       	mov    $0xd,%eax
+f010047d:	ee                   	out    %al,(%dx)
+f010047e:	b8 08 00 00 00       	mov    $0x8,%eax
+f0100483:	ee                   	out    %al,(%dx)
+		c |= 0x0700;
+f0100484:	89 f8                	mov    %edi,%eax
+f0100486:	80 cc 07             	or     $0x7,%ah
+f0100489:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+f010048f:	0f 42 f8             	cmovb  %eax,%edi
+	switch (c & 0xff) {
+f0100492:	89 f8                	mov    %edi,%eax
+f0100494:	0f b6 c0             	movzbl %al,%eax
+f0100497:	89 fb                	mov    %edi,%ebx
+f0100499:	80 fb 0a             	cmp    $0xa,%bl
+f010049c:	0f 84 e1 00 00 00    	je     f0100583 <cons_putc+0x182>
+f01004a2:	83 f8 0a             	cmp    $0xa,%eax
+f01004a5:	7f 46                	jg     f01004ed <cons_putc+0xec>
+f01004a7:	83 f8 08             	cmp    $0x8,%eax
+f01004aa:	0f 84 a7 00 00 00    	je     f0100557 <cons_putc+0x156>
+f01004b0:	83 f8 09             	cmp    $0x9,%eax
+f01004b3:	0f 85 d7 00 00 00    	jne    f0100590 <cons_putc+0x18f>
+		cons_putc(' ');
+f01004b9:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004be:	e8 3e ff ff ff       	call   f0100401 <cons_putc>
+		cons_putc(' ');
+f01004c3:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004c8:	e8 34 ff ff ff       	call   f0100401 <cons_putc>
+		cons_putc(' ');
+f01004cd:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004d2:	e8 2a ff ff ff       	call   f0100401 <cons_putc>
+		cons_putc(' ');
+f01004d7:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004dc:	e8 20 ff ff ff       	call   f0100401 <cons_putc>
+		cons_putc(' ');
+f01004e1:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004e6:	e8 16 ff ff ff       	call   f0100401 <cons_putc>
+		break;
+f01004eb:	eb 25                	jmp    f0100512 <cons_putc+0x111>
+	switch (c & 0xff) {
+f01004ed:	83 f8 0d             	cmp    $0xd,%eax
+f01004f0:	0f 85 9a 00 00 00    	jne    f0100590 <cons_putc+0x18f>
+		crt_pos -= (crt_pos % CRT_COLS);
+f01004f6:	0f b7 05 28 12 61 f0 	movzwl 0xf0611228,%eax
+f01004fd:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f0100503:	c1 e8 16             	shr    $0x16,%eax
+f0100506:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0100509:	c1 e0 04             	shl    $0x4,%eax
+f010050c:	66 a3 28 12 61 f0    	mov    %ax,0xf0611228
+	if (crt_pos >= CRT_SIZE) {
+f0100512:	66 81 3d 28 12 61 f0 	cmpw   $0x7cf,0xf0611228
+f0100519:	cf 07 
+f010051b:	0f 87 92 00 00 00    	ja     f01005b3 <cons_putc+0x1b2>
+	outb(addr_6845, 14);
+f0100521:	8b 0d 30 12 61 f0    	mov    0xf0611230,%ecx
+f0100527:	b8 0e 00 00 00       	mov    $0xe,%eax
+f010052c:	89 ca                	mov    %ecx,%edx
+f010052e:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, crt_pos >> 8);
+f010052f:	0f b7 1d 28 12 61 f0 	movzwl 0xf0611228,%ebx
+f0100536:	8d 71 01             	lea    0x1(%ecx),%esi
+f0100539:	89 d8                	mov    %ebx,%eax
+f010053b:	66 c1 e8 08          	shr    $0x8,%ax
+f010053f:	89 f2                	mov    %esi,%edx
+f0100541:	ee                   	out    %al,(%dx)
+f0100542:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0100547:	89 ca                	mov    %ecx,%edx
+f0100549:	ee                   	out    %al,(%dx)
+f010054a:	89 d8                	mov    %ebx,%eax
+f010054c:	89 f2                	mov    %esi,%edx
+f010054e:	ee                   	out    %al,(%dx)
+	serial_putc(c);
+	lpt_putc(c);
+	cga_putc(c);
+}
+f010054f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100552:	5b                   	pop    %ebx
+f0100553:	5e                   	pop    %esi
+f0100554:	5f                   	pop    %edi
+f0100555:	5d                   	pop    %ebp
+f0100556:	c3                   	ret
+		if (crt_pos > 0) {
+f0100557:	0f b7 05 28 12 61 f0 	movzwl 0xf0611228,%eax
+f010055e:	66 85 c0             	test   %ax,%ax
+f0100561:	74 be                	je     f0100521 <cons_putc+0x120>
+			crt_pos--;
+f0100563:	83 e8 01             	sub    $0x1,%eax
+f0100566:	66 a3 28 12 61 f0    	mov    %ax,0xf0611228
+			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+f010056c:	0f b7 c0             	movzwl %ax,%eax
+f010056f:	66 81 e7 00 ff       	and    $0xff00,%di
+f0100574:	83 cf 20             	or     $0x20,%edi
+f0100577:	8b 15 2c 12 61 f0    	mov    0xf061122c,%edx
+f010057d:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+f0100581:	eb 8f                	jmp    f0100512 <cons_putc+0x111>
+		crt_pos += CRT_COLS;
+f0100583:	66 83 05 28 12 61 f0 	addw   $0x50,0xf0611228
+f010058a:	50 
+f010058b:	e9 66 ff ff ff       	jmp    f01004f6 <cons_putc+0xf5>
+		crt_buf[crt_pos++] = c;		/* write the character */
+f0100590:	0f b7 05 28 12 61 f0 	movzwl 0xf0611228,%eax
+f0100597:	8d 50 01             	lea    0x1(%eax),%edx
+f010059a:	66 89 15 28 12 61 f0 	mov    %dx,0xf0611228
+f01005a1:	0f b7 c0             	movzwl %ax,%eax
+f01005a4:	8b 15 2c 12 61 f0    	mov    0xf061122c,%edx
+f01005aa:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+		break;
+f01005ae:	e9 5f ff ff ff       	jmp    f0100512 <cons_putc+0x111>
+		memmove(crt_buf, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+f01005b3:	a1 2c 12 61 f0       	mov    0xf061122c,%eax
+f01005b8:	83 ec 04             	sub    $0x4,%esp
+f01005bb:	68 00 0f 00 00       	push   $0xf00
+f01005c0:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+f01005c6:	52                   	push   %edx
+f01005c7:	50                   	push   %eax
+f01005c8:	e8 66 a0 00 00       	call   f010a633 <memmove>
+			crt_buf[i] = 0x0700 | ' ';
+f01005cd:	8b 15 2c 12 61 f0    	mov    0xf061122c,%edx
+f01005d3:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+f01005d9:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f01005df:	83 c4 10             	add    $0x10,%esp
+f01005e2:	eb 08                	jmp    f01005ec <cons_putc+0x1eb>
+			crt_buf[i] = 0x0700 | ' ';
+f01005e4:	66 c7 00 20 07       	movw   $0x720,(%eax)
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f01005e9:	83 c0 02             	add    $0x2,%eax
+f01005ec:	39 d0                	cmp    %edx,%eax
+f01005ee:	75 f4                	jne    f01005e4 <cons_putc+0x1e3>
+		crt_pos -= CRT_COLS;
+f01005f0:	66 83 2d 28 12 61 f0 	subw   $0x50,0xf0611228
+f01005f7:	50 
+f01005f8:	e9 24 ff ff ff       	jmp    f0100521 <cons_putc+0x120>
+
+f01005fd <serial_intr>:
+	if (serial_exists)
+f01005fd:	80 3d 34 12 61 f0 00 	cmpb   $0x0,0xf0611234
+f0100604:	75 01                	jne    f0100607 <serial_intr+0xa>
+f0100606:	c3                   	ret
+{
+f0100607:	55                   	push   %ebp
+f0100608:	89 e5                	mov    %esp,%ebp
+f010060a:	83 ec 08             	sub    $0x8,%esp
+		cons_intr(serial_proc_data);
+f010060d:	b8 88 02 10 f0       	mov    $0xf0100288,%eax
+f0100612:	e8 8b fc ff ff       	call   f01002a2 <cons_intr>
+}
+f0100617:	c9                   	leave
+f0100618:	c3                   	ret
+
+f0100619 <kbd_intr>:
+{
+f0100619:	55                   	push   %ebp
+f010061a:	89 e5                	mov    %esp,%ebp
+f010061c:	83 ec 08             	sub    $0x8,%esp
+	cons_intr(kbd_proc_data);
+f010061f:	b8 ff 02 10 f0       	mov    $0xf01002ff,%eax
+f0100624:	e8 79 fc ff ff       	call   f01002a2 <cons_intr>
+}
+f0100629:	c9                   	leave
+f010062a:	c3                   	ret
+
+f010062b <cons_getc>:
+{
+f010062b:	55                   	push   %ebp
+f010062c:	89 e5                	mov    %esp,%ebp
+f010062e:	53                   	push   %ebx
+f010062f:	83 ec 04             	sub    $0x4,%esp
+	serial_intr();
+f0100632:	e8 c6 ff ff ff       	call   f01005fd <serial_intr>
+	kbd_intr();
+f0100637:	e8 dd ff ff ff       	call   f0100619 <kbd_intr>
+	spin_lock(&cons_lock);
+f010063c:	83 ec 0c             	sub    $0xc,%esp
+f010063f:	68 00 90 11 f0       	push   $0xf0119000
+f0100644:	e8 8a a8 00 00       	call   f010aed3 <spin_lock>
+	if (cons.rpos != cons.wpos) {
+f0100649:	a1 20 12 61 f0       	mov    0xf0611220,%eax
+f010064e:	83 c4 10             	add    $0x10,%esp
+	c = 0;
+f0100651:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (cons.rpos != cons.wpos) {
+f0100656:	3b 05 24 12 61 f0    	cmp    0xf0611224,%eax
+f010065c:	74 1c                	je     f010067a <cons_getc+0x4f>
+		c = cons.buf[cons.rpos++];
+f010065e:	8d 50 01             	lea    0x1(%eax),%edx
+f0100661:	0f b6 98 20 10 61 f0 	movzbl -0xf9eefe0(%eax),%ebx
+			cons.rpos = 0;
+f0100668:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f010066d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100672:	0f 45 c2             	cmovne %edx,%eax
+f0100675:	a3 20 12 61 f0       	mov    %eax,0xf0611220
+	spin_unlock(&cons_lock);
+f010067a:	83 ec 0c             	sub    $0xc,%esp
+f010067d:	68 00 90 11 f0       	push   $0xf0119000
+f0100682:	e8 68 a9 00 00       	call   f010afef <spin_unlock>
+}
+f0100687:	89 d8                	mov    %ebx,%eax
+f0100689:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010068c:	c9                   	leave
+f010068d:	c3                   	ret
+
+f010068e <cons_init>:
+
+// initialize the console devices
+void
+cons_init(void)
+{
+f010068e:	55                   	push   %ebp
+f010068f:	89 e5                	mov    %esp,%ebp
+f0100691:	57                   	push   %edi
+f0100692:	56                   	push   %esi
+f0100693:	53                   	push   %ebx
+f0100694:	83 ec 0c             	sub    $0xc,%esp
+	was = *cp;
+f0100697:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+	*cp = (uint16_t) 0xA55A;
+f010069e:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f01006a5:	5a a5 
+	if (*cp != 0xA55A) {
+f01006a7:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f01006ae:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+		cp = (uint16_t*) (KERNBASE + MONO_BUF);
+f01006b3:	be 00 00 0b f0       	mov    $0xf00b0000,%esi
+	if (*cp != 0xA55A) {
+f01006b8:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f01006bc:	0f 84 cd 00 00 00    	je     f010078f <cons_init+0x101>
+		addr_6845 = MONO_BASE;
+f01006c2:	89 1d 30 12 61 f0    	mov    %ebx,0xf0611230
+f01006c8:	b8 0e 00 00 00       	mov    $0xe,%eax
+f01006cd:	89 da                	mov    %ebx,%edx
+f01006cf:	ee                   	out    %al,(%dx)
+	pos = inb(addr_6845 + 1) << 8;
+f01006d0:	8d 7b 01             	lea    0x1(%ebx),%edi
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01006d3:	89 fa                	mov    %edi,%edx
+f01006d5:	ec                   	in     (%dx),%al
+f01006d6:	0f b6 c8             	movzbl %al,%ecx
+f01006d9:	c1 e1 08             	shl    $0x8,%ecx
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01006dc:	b8 0f 00 00 00       	mov    $0xf,%eax
+f01006e1:	89 da                	mov    %ebx,%edx
+f01006e3:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01006e4:	89 fa                	mov    %edi,%edx
+f01006e6:	ec                   	in     (%dx),%al
+	crt_buf = (uint16_t*) cp;
+f01006e7:	89 35 2c 12 61 f0    	mov    %esi,0xf061122c
+	pos |= inb(addr_6845 + 1);
+f01006ed:	0f b6 c0             	movzbl %al,%eax
+f01006f0:	09 c8                	or     %ecx,%eax
+	crt_pos = pos;
+f01006f2:	66 a3 28 12 61 f0    	mov    %ax,0xf0611228
+	kbd_intr();
+f01006f8:	e8 1c ff ff ff       	call   f0100619 <kbd_intr>
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<1));
+f01006fd:	83 ec 0c             	sub    $0xc,%esp
+f0100700:	0f b7 05 c8 94 11 f0 	movzwl 0xf01194c8,%eax
+f0100707:	25 fd ff 00 00       	and    $0xfffd,%eax
+f010070c:	50                   	push   %eax
+f010070d:	e8 76 67 00 00       	call   f0106e88 <irq_setmask_8259A>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100712:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0100717:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+f010071c:	89 c8                	mov    %ecx,%eax
+f010071e:	89 da                	mov    %ebx,%edx
+f0100720:	ee                   	out    %al,(%dx)
+f0100721:	bf fb 03 00 00       	mov    $0x3fb,%edi
+f0100726:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f010072b:	89 fa                	mov    %edi,%edx
+f010072d:	ee                   	out    %al,(%dx)
+f010072e:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100733:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100738:	ee                   	out    %al,(%dx)
+f0100739:	be f9 03 00 00       	mov    $0x3f9,%esi
+f010073e:	89 c8                	mov    %ecx,%eax
+f0100740:	89 f2                	mov    %esi,%edx
+f0100742:	ee                   	out    %al,(%dx)
+f0100743:	b8 03 00 00 00       	mov    $0x3,%eax
+f0100748:	89 fa                	mov    %edi,%edx
+f010074a:	ee                   	out    %al,(%dx)
+f010074b:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f0100750:	89 c8                	mov    %ecx,%eax
+f0100752:	ee                   	out    %al,(%dx)
+f0100753:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100758:	89 f2                	mov    %esi,%edx
+f010075a:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010075b:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100760:	ec                   	in     (%dx),%al
+f0100761:	89 c1                	mov    %eax,%ecx
+	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+f0100763:	83 c4 10             	add    $0x10,%esp
+f0100766:	3c ff                	cmp    $0xff,%al
+f0100768:	0f 95 05 34 12 61 f0 	setne  0xf0611234
+f010076f:	89 da                	mov    %ebx,%edx
+f0100771:	ec                   	in     (%dx),%al
+f0100772:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100777:	ec                   	in     (%dx),%al
+	if (serial_exists)
+f0100778:	80 f9 ff             	cmp    $0xff,%cl
+f010077b:	75 28                	jne    f01007a5 <cons_init+0x117>
+	cga_init();
+	kbd_init();
+	serial_init();
+
+	if (!serial_exists)
+		cprintf("Serial port does not exist!\n");
+f010077d:	83 ec 0c             	sub    $0xc,%esp
+f0100780:	68 4b c0 10 f0       	push   $0xf010c04b
+f0100785:	e8 72 68 00 00       	call   f0106ffc <cprintf>
+f010078a:	83 c4 10             	add    $0x10,%esp
+}
+f010078d:	eb 37                	jmp    f01007c6 <cons_init+0x138>
+		*cp = was;
+f010078f:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f0100796:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+	cp = (uint16_t*) (KERNBASE + CGA_BUF);
+f010079b:	be 00 80 0b f0       	mov    $0xf00b8000,%esi
+f01007a0:	e9 1d ff ff ff       	jmp    f01006c2 <cons_init+0x34>
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<4));
+f01007a5:	83 ec 0c             	sub    $0xc,%esp
+f01007a8:	0f b7 05 c8 94 11 f0 	movzwl 0xf01194c8,%eax
+f01007af:	25 ef ff 00 00       	and    $0xffef,%eax
+f01007b4:	50                   	push   %eax
+f01007b5:	e8 ce 66 00 00       	call   f0106e88 <irq_setmask_8259A>
+	if (!serial_exists)
+f01007ba:	83 c4 10             	add    $0x10,%esp
+f01007bd:	80 3d 34 12 61 f0 00 	cmpb   $0x0,0xf0611234
+f01007c4:	74 b7                	je     f010077d <cons_init+0xef>
+}
+f01007c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01007c9:	5b                   	pop    %ebx
+f01007ca:	5e                   	pop    %esi
+f01007cb:	5f                   	pop    %edi
+f01007cc:	5d                   	pop    %ebp
+f01007cd:	c3                   	ret
+
+f01007ce <cputchar>:
+
+// `High'-level console I/O.  Used by readline and cprintf.
+
+void
+cputchar(int c)
+{
+f01007ce:	55                   	push   %ebp
+f01007cf:	89 e5                	mov    %esp,%ebp
+f01007d1:	83 ec 08             	sub    $0x8,%esp
+	cons_putc(c);
+f01007d4:	8b 45 08             	mov    0x8(%ebp),%eax
+f01007d7:	e8 25 fc ff ff       	call   f0100401 <cons_putc>
+}
+f01007dc:	c9                   	leave
+f01007dd:	c3                   	ret
+
+f01007de <getchar>:
+
+int
+getchar(void)
+{
+f01007de:	55                   	push   %ebp
+f01007df:	89 e5                	mov    %esp,%ebp
+f01007e1:	83 ec 08             	sub    $0x8,%esp
+	int c;
+
+	while ((c = cons_getc()) == 0)
+f01007e4:	e8 42 fe ff ff       	call   f010062b <cons_getc>
+f01007e9:	85 c0                	test   %eax,%eax
+f01007eb:	74 f7                	je     f01007e4 <getchar+0x6>
+		/* do nothing */;
+	return c;
+}
+f01007ed:	c9                   	leave
+f01007ee:	c3                   	ret
+
+f01007ef <iscons>:
+int
+iscons(int fdnum)
+{
+	// used by readline
+	return 1;
+}
+f01007ef:	b8 01 00 00 00       	mov    $0x1,%eax
+f01007f4:	c3                   	ret
+
+f01007f5 <mon_help>:
+
+/***** Implementations of basic kernel monitor commands *****/
+
+int
+mon_help(int argc, char **argv, struct Trapframe *tf)
+{
+f01007f5:	55                   	push   %ebp
+f01007f6:	89 e5                	mov    %esp,%ebp
+f01007f8:	56                   	push   %esi
+f01007f9:	53                   	push   %ebx
+	int i;
+
+	for (i = 0; i < NCOMMANDS; i++)
+f01007fa:	bb 40 cc 10 f0       	mov    $0xf010cc40,%ebx
+f01007ff:	be e8 cc 10 f0       	mov    $0xf010cce8,%esi
+f0100804:	eb 18                	jmp    f010081e <mon_help+0x29>
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f0100806:	83 ec 04             	sub    $0x4,%esp
+f0100809:	ff 73 04             	push   0x4(%ebx)
+f010080c:	ff 33                	push   (%ebx)
+f010080e:	68 a0 c2 10 f0       	push   $0xf010c2a0
+f0100813:	e8 e4 67 00 00       	call   f0106ffc <cprintf>
+	for (i = 0; i < NCOMMANDS; i++)
+f0100818:	83 c3 0c             	add    $0xc,%ebx
+f010081b:	83 c4 10             	add    $0x10,%esp
+f010081e:	39 f3                	cmp    %esi,%ebx
+f0100820:	75 e4                	jne    f0100806 <mon_help+0x11>
+	return 0;
+}
+f0100822:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100827:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010082a:	5b                   	pop    %ebx
+f010082b:	5e                   	pop    %esi
+f010082c:	5d                   	pop    %ebp
+f010082d:	c3                   	ret
+
+f010082e <mon_kerninfo>:
+
+int
+mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
+{
+f010082e:	55                   	push   %ebp
+f010082f:	89 e5                	mov    %esp,%ebp
+f0100831:	83 ec 14             	sub    $0x14,%esp
+	extern char _start[], entry[], etext[], edata[], end[];
+
+	cprintf("Special kernel symbols:\n");
+f0100834:	68 a9 c2 10 f0       	push   $0xf010c2a9
+f0100839:	e8 be 67 00 00       	call   f0106ffc <cprintf>
+	cprintf("  _start                  %08x (phys)\n", _start);
+f010083e:	83 c4 08             	add    $0x8,%esp
+f0100841:	68 0c 00 10 00       	push   $0x10000c
+f0100846:	68 48 c6 10 f0       	push   $0xf010c648
+f010084b:	e8 ac 67 00 00       	call   f0106ffc <cprintf>
+	cprintf("  entry  %08x (virt)  %08x (phys)\n", entry, entry - KERNBASE);
+f0100850:	83 c4 0c             	add    $0xc,%esp
+f0100853:	68 0c 00 10 00       	push   $0x10000c
+f0100858:	68 0c 00 10 f0       	push   $0xf010000c
+f010085d:	68 70 c6 10 f0       	push   $0xf010c670
+f0100862:	e8 95 67 00 00       	call   f0106ffc <cprintf>
+	cprintf("  etext  %08x (virt)  %08x (phys)\n", etext, etext - KERNBASE);
+f0100867:	83 c4 0c             	add    $0xc,%esp
+f010086a:	68 97 bf 10 00       	push   $0x10bf97
+f010086f:	68 97 bf 10 f0       	push   $0xf010bf97
+f0100874:	68 94 c6 10 f0       	push   $0xf010c694
+f0100879:	e8 7e 67 00 00       	call   f0106ffc <cprintf>
+	cprintf("  edata  %08x (virt)  %08x (phys)\n", edata, edata - KERNBASE);
+f010087e:	83 c4 0c             	add    $0xc,%esp
+f0100881:	68 94 0f 61 00       	push   $0x610f94
+f0100886:	68 94 0f 61 f0       	push   $0xf0610f94
+f010088b:	68 b8 c6 10 f0       	push   $0xf010c6b8
+f0100890:	e8 67 67 00 00       	call   f0106ffc <cprintf>
+	cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
+f0100895:	83 c4 0c             	add    $0xc,%esp
+f0100898:	68 0c a0 65 00       	push   $0x65a00c
+f010089d:	68 0c a0 65 f0       	push   $0xf065a00c
+f01008a2:	68 dc c6 10 f0       	push   $0xf010c6dc
+f01008a7:	e8 50 67 00 00       	call   f0106ffc <cprintf>
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f01008ac:	83 c4 08             	add    $0x8,%esp
+		ROUNDUP(end - entry, 1024) / 1024);
+f01008af:	b8 0c a0 65 f0       	mov    $0xf065a00c,%eax
+f01008b4:	2d 0d fc 0f f0       	sub    $0xf00ffc0d,%eax
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f01008b9:	c1 f8 0a             	sar    $0xa,%eax
+f01008bc:	50                   	push   %eax
+f01008bd:	68 00 c7 10 f0       	push   $0xf010c700
+f01008c2:	e8 35 67 00 00       	call   f0106ffc <cprintf>
+	return 0;
+}
+f01008c7:	b8 00 00 00 00       	mov    $0x0,%eax
+f01008cc:	c9                   	leave
+f01008cd:	c3                   	ret
+
+f01008ce <pte_show>:
+	cprintf("\n");
+}
+
+static void
+pte_show(pte_t pte)
+{
+f01008ce:	55                   	push   %ebp
+f01008cf:	89 e5                	mov    %esp,%ebp
+f01008d1:	57                   	push   %edi
+f01008d2:	56                   	push   %esi
+f01008d3:	53                   	push   %ebx
+f01008d4:	83 ec 14             	sub    $0x14,%esp
+f01008d7:	89 c6                	mov    %eax,%esi
+	cprintf("pa 0x%x ", PTE_ADDR(pte));
+f01008d9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f01008de:	50                   	push   %eax
+f01008df:	68 c2 c2 10 f0       	push   $0xf010c2c2
+f01008e4:	e8 13 67 00 00       	call   f0106ffc <cprintf>
+	pte_perms_show(PGOFF(pte));
+f01008e9:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+f01008ef:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < size; i++) {
+f01008f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		cprintf("%s: 0x%x ", perm_strs[i], perms & (1 << i));
+f01008f7:	bf 01 00 00 00       	mov    $0x1,%edi
+f01008fc:	83 ec 04             	sub    $0x4,%esp
+f01008ff:	89 f8                	mov    %edi,%eax
+f0100901:	89 d9                	mov    %ebx,%ecx
+f0100903:	d3 e0                	shl    %cl,%eax
+f0100905:	21 f0                	and    %esi,%eax
+f0100907:	50                   	push   %eax
+f0100908:	ff 34 9d 00 cc 10 f0 	push   -0xfef3400(,%ebx,4)
+f010090f:	68 cb c2 10 f0       	push   $0xf010c2cb
+f0100914:	e8 e3 66 00 00       	call   f0106ffc <cprintf>
+	for (i = 0; i < size; i++) {
+f0100919:	83 c3 01             	add    $0x1,%ebx
+f010091c:	83 c4 10             	add    $0x10,%esp
+f010091f:	83 fb 09             	cmp    $0x9,%ebx
+f0100922:	75 d8                	jne    f01008fc <pte_show+0x2e>
+	cprintf("\n");
+f0100924:	83 ec 0c             	sub    $0xc,%esp
+f0100927:	68 30 db 10 f0       	push   $0xf010db30
+f010092c:	e8 cb 66 00 00       	call   f0106ffc <cprintf>
+}
+f0100931:	83 c4 10             	add    $0x10,%esp
+f0100934:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100937:	5b                   	pop    %ebx
+f0100938:	5e                   	pop    %esi
+f0100939:	5f                   	pop    %edi
+f010093a:	5d                   	pop    %ebp
+f010093b:	c3                   	ret
+
+f010093c <mon_cpustat>:
+	env_run(curenv);
+}
+
+int
+mon_cpustat(int argc, char **argv, struct Trapframe *tf)
+{
+f010093c:	55                   	push   %ebp
+f010093d:	89 e5                	mov    %esp,%ebp
+f010093f:	56                   	push   %esi
+f0100940:	53                   	push   %ebx
+	struct CpuInfo *c;
+
+	if (argc != 1) {
+f0100941:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f0100945:	74 1c                	je     f0100963 <mon_cpustat+0x27>
+		cprintf("usage: cpustat\n");
+f0100947:	83 ec 0c             	sub    $0xc,%esp
+f010094a:	68 d5 c2 10 f0       	push   $0xf010c2d5
+f010094f:	e8 a8 66 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0100954:	83 c4 10             	add    $0x10,%esp
+		cprintf("%3d  %6d  %6u  %6u  %10u  %10u  %4u  %08x\n", c - cpus,
+			c->cpu_runq.rq_len, c->cpu_steals, c->cpu_stolen,
+			c->cpu_migrations, c->cpu_shootdowns, c->cpu_shootdown_ipis,
+			c->cpu_env ? c->cpu_env->env_id : 0);
+	return 0;
+}
+f0100957:	b8 00 00 00 00       	mov    $0x0,%eax
+f010095c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010095f:	5b                   	pop    %ebx
+f0100960:	5e                   	pop    %esi
+f0100961:	5d                   	pop    %ebp
+f0100962:	c3                   	ret
+	cprintf("cpu  queued  steals  stolen  migrations  shootdowns  ipis  env\n");
+f0100963:	83 ec 0c             	sub    $0xc,%esp
+f0100966:	68 2c c7 10 f0       	push   $0xf010c72c
+f010096b:	e8 8c 66 00 00       	call   f0106ffc <cprintf>
+	for (c = cpus; c < cpus + ncpu; c++)
+f0100970:	83 c4 10             	add    $0x10,%esp
+f0100973:	bb 20 90 61 f0       	mov    $0xf0619020,%ebx
+		cprintf("%3d  %6d  %6u  %6u  %10u  %10u  %4u  %08x\n", c - cpus,
+f0100978:	be 00 00 00 00       	mov    $0x0,%esi
+	for (c = cpus; c < cpus + ncpu; c++)
+f010097d:	eb 4f                	jmp    f01009ce <mon_cpustat+0x92>
+		cprintf("%3d  %6d  %6u  %6u  %10u  %10u  %4u  %08x\n", c - cpus,
+f010097f:	8b 42 4c             	mov    0x4c(%edx),%eax
+f0100982:	83 ec 0c             	sub    $0xc,%esp
+f0100985:	50                   	push   %eax
+f0100986:	ff b3 b4 00 00 00    	push   0xb4(%ebx)
+f010098c:	ff b3 b0 00 00 00    	push   0xb0(%ebx)
+f0100992:	ff b3 a4 00 00 00    	push   0xa4(%ebx)
+f0100998:	ff b3 a0 00 00 00    	push   0xa0(%ebx)
+f010099e:	ff b3 9c 00 00 00    	push   0x9c(%ebx)
+f01009a4:	ff b3 94 00 00 00    	push   0x94(%ebx)
+f01009aa:	89 d8                	mov    %ebx,%eax
+f01009ac:	2d 20 90 61 f0       	sub    $0xf0619020,%eax
+f01009b1:	c1 f8 02             	sar    $0x2,%eax
+f01009b4:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+f01009ba:	50                   	push   %eax
+f01009bb:	68 6c c7 10 f0       	push   $0xf010c76c
+f01009c0:	e8 37 66 00 00       	call   f0106ffc <cprintf>
+	for (c = cpus; c < cpus + ncpu; c++)
+f01009c5:	81 c3 bc 00 00 00    	add    $0xbc,%ebx
+f01009cb:	83 c4 30             	add    $0x30,%esp
+f01009ce:	69 05 04 96 61 f0 bc 	imul   $0xbc,0xf0619604,%eax
+f01009d5:	00 00 00 
+f01009d8:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f01009dd:	39 c3                	cmp    %eax,%ebx
+f01009df:	0f 83 72 ff ff ff    	jae    f0100957 <mon_cpustat+0x1b>
+			c->cpu_env ? c->cpu_env->env_id : 0);
+f01009e5:	8b 53 08             	mov    0x8(%ebx),%edx
+		cprintf("%3d  %6d  %6u  %6u  %10u  %10u  %4u  %08x\n", c - cpus,
+f01009e8:	89 f0                	mov    %esi,%eax
+f01009ea:	85 d2                	test   %edx,%edx
+f01009ec:	75 91                	jne    f010097f <mon_cpustat+0x43>
+f01009ee:	eb 92                	jmp    f0100982 <mon_cpustat+0x46>
+
+f01009f0 <mon_backtrace>:
+{
+f01009f0:	55                   	push   %ebp
+f01009f1:	89 e5                	mov    %esp,%ebp
+f01009f3:	57                   	push   %edi
+f01009f4:	56                   	push   %esi
+f01009f5:	53                   	push   %ebx
+f01009f6:	83 ec 48             	sub    $0x48,%esp
+	cprintf("Stack backtrace:\n");
+f01009f9:	68 e5 c2 10 f0       	push   $0xf010c2e5
+f01009fe:	e8 f9 65 00 00       	call   f0106ffc <cprintf>
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+f0100a03:	89 ee                	mov    %ebp,%esi
+	while (ebp) {
+f0100a05:	83 c4 10             	add    $0x10,%esp
+f0100a08:	eb 3e                	jmp    f0100a48 <mon_backtrace+0x58>
+			cprintf("%08x ", ((uint32_t *) ebp)[1 + i]);
+f0100a0a:	83 ec 08             	sub    $0x8,%esp
+f0100a0d:	ff 33                	push   (%ebx)
+f0100a0f:	68 06 c3 10 f0       	push   $0xf010c306
+f0100a14:	e8 e3 65 00 00       	call   f0106ffc <cprintf>
+		for (i = 1; i <= 5; i++) {
+f0100a19:	83 c3 04             	add    $0x4,%ebx
+f0100a1c:	83 c4 10             	add    $0x10,%esp
+f0100a1f:	39 fb                	cmp    %edi,%ebx
+f0100a21:	75 e7                	jne    f0100a0a <mon_backtrace+0x1a>
+		cprintf("\n");
+f0100a23:	83 ec 0c             	sub    $0xc,%esp
+f0100a26:	68 30 db 10 f0       	push   $0xf010db30
+f0100a2b:	e8 cc 65 00 00       	call   f0106ffc <cprintf>
+		if (!debuginfo_eip(eip, &info))
+f0100a30:	83 c4 08             	add    $0x8,%esp
+f0100a33:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f0100a36:	50                   	push   %eax
+f0100a37:	ff 75 c4             	push   -0x3c(%ebp)
+f0100a3a:	e8 df 90 00 00       	call   f0109b1e <debuginfo_eip>
+f0100a3f:	83 c4 10             	add    $0x10,%esp
+f0100a42:	85 c0                	test   %eax,%eax
+f0100a44:	74 32                	je     f0100a78 <mon_backtrace+0x88>
+		ebp = ((uint32_t *) ebp)[0];
+f0100a46:	8b 36                	mov    (%esi),%esi
+	while (ebp) {
+f0100a48:	85 f6                	test   %esi,%esi
+f0100a4a:	74 51                	je     f0100a9d <mon_backtrace+0xad>
+		eip = ((uint32_t *) ebp)[1];
+f0100a4c:	8b 46 04             	mov    0x4(%esi),%eax
+f0100a4f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+		cprintf("  ebp %08x eip %08x ", ebp, eip);
+f0100a52:	83 ec 04             	sub    $0x4,%esp
+f0100a55:	50                   	push   %eax
+f0100a56:	56                   	push   %esi
+f0100a57:	68 f7 c2 10 f0       	push   $0xf010c2f7
+f0100a5c:	e8 9b 65 00 00       	call   f0106ffc <cprintf>
+		cprintf("args ");
+f0100a61:	c7 04 24 0c c3 10 f0 	movl   $0xf010c30c,(%esp)
+f0100a68:	e8 8f 65 00 00       	call   f0106ffc <cprintf>
+		for (i = 1; i <= 5; i++) {
+f0100a6d:	8d 5e 08             	lea    0x8(%esi),%ebx
+f0100a70:	8d 7e 1c             	lea    0x1c(%esi),%edi
+f0100a73:	83 c4 10             	add    $0x10,%esp
+f0100a76:	eb a7                	jmp    f0100a1f <mon_backtrace+0x2f>
+			cprintf("\t%s:%d: %.*s+%d\n", info.eip_file, info.eip_line,
+f0100a78:	83 ec 08             	sub    $0x8,%esp
+f0100a7b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0100a7e:	2b 45 e0             	sub    -0x20(%ebp),%eax
+f0100a81:	50                   	push   %eax
+f0100a82:	ff 75 d8             	push   -0x28(%ebp)
+f0100a85:	ff 75 dc             	push   -0x24(%ebp)
+f0100a88:	ff 75 d4             	push   -0x2c(%ebp)
+f0100a8b:	ff 75 d0             	push   -0x30(%ebp)
+f0100a8e:	68 12 c3 10 f0       	push   $0xf010c312
+f0100a93:	e8 64 65 00 00       	call   f0106ffc <cprintf>
+f0100a98:	83 c4 20             	add    $0x20,%esp
+f0100a9b:	eb a9                	jmp    f0100a46 <mon_backtrace+0x56>
+}
+f0100a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100aa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100aa5:	5b                   	pop    %ebx
+f0100aa6:	5e                   	pop    %esi
+f0100aa7:	5f                   	pop    %edi
+f0100aa8:	5d                   	pop    %ebp
+f0100aa9:	c3                   	ret
+
+f0100aaa <mon_showvm>:
+{
+f0100aaa:	55                   	push   %ebp
+f0100aab:	89 e5                	mov    %esp,%ebp
+f0100aad:	57                   	push   %edi
+f0100aae:	56                   	push   %esi
+f0100aaf:	53                   	push   %ebx
+f0100ab0:	83 ec 2c             	sub    $0x2c,%esp
+	if (argc != 3) {
+f0100ab3:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+f0100ab7:	74 1d                	je     f0100ad6 <mon_showvm+0x2c>
+		cprintf("usage: dumpvm begin_va end_va\n");
+f0100ab9:	83 ec 0c             	sub    $0xc,%esp
+f0100abc:	68 98 c7 10 f0       	push   $0xf010c798
+f0100ac1:	e8 36 65 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0100ac6:	83 c4 10             	add    $0x10,%esp
+}
+f0100ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100ace:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100ad1:	5b                   	pop    %ebx
+f0100ad2:	5e                   	pop    %esi
+f0100ad3:	5f                   	pop    %edi
+f0100ad4:	5d                   	pop    %ebp
+f0100ad5:	c3                   	ret
+	begin_va = (uintptr_t) strtol(argv[1], NULL, 0);
+f0100ad6:	83 ec 04             	sub    $0x4,%esp
+f0100ad9:	6a 00                	push   $0x0
+f0100adb:	6a 00                	push   $0x0
+f0100add:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100ae0:	ff 70 04             	push   0x4(%eax)
+f0100ae3:	e8 19 9c 00 00       	call   f010a701 <strtol>
+f0100ae8:	89 c6                	mov    %eax,%esi
+f0100aea:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	end_va = (uintptr_t) strtol(argv[2], NULL, 0);
+f0100aed:	83 c4 0c             	add    $0xc,%esp
+f0100af0:	6a 00                	push   $0x0
+f0100af2:	6a 00                	push   $0x0
+f0100af4:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100af7:	ff 70 08             	push   0x8(%eax)
+f0100afa:	e8 02 9c 00 00       	call   f010a701 <strtol>
+f0100aff:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	if (begin_va > end_va) {
+f0100b02:	83 c4 10             	add    $0x10,%esp
+f0100b05:	39 f0                	cmp    %esi,%eax
+f0100b07:	72 27                	jb     f0100b30 <mon_showvm+0x86>
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+f0100b09:	0f 20 d8             	mov    %cr3,%eax
+	if (PGNUM(pa) >= npages_lowmem)
+f0100b0c:	89 c2                	mov    %eax,%edx
+f0100b0e:	c1 ea 0c             	shr    $0xc,%edx
+f0100b11:	3b 15 6c 89 61 f0    	cmp    0xf061896c,%edx
+f0100b17:	73 2d                	jae    f0100b46 <mon_showvm+0x9c>
+	return (void *)(pa + KERNBASE);
+f0100b19:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0100b1e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	for (i = j = 0, va = begin_va; va <= end_va; va += PGSIZE) {
+f0100b21:	be 00 00 00 00       	mov    $0x0,%esi
+f0100b26:	bf 00 00 00 00       	mov    $0x0,%edi
+f0100b2b:	e9 c3 00 00 00       	jmp    f0100bf3 <mon_showvm+0x149>
+		cprintf("begin va (0x%x) is greater than end va (0x%x)\n", begin_va, end_va);
+f0100b30:	83 ec 04             	sub    $0x4,%esp
+f0100b33:	50                   	push   %eax
+f0100b34:	ff 75 dc             	push   -0x24(%ebp)
+f0100b37:	68 b8 c7 10 f0       	push   $0xf010c7b8
+f0100b3c:	e8 bb 64 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0100b41:	83 c4 10             	add    $0x10,%esp
+f0100b44:	eb 83                	jmp    f0100ac9 <mon_showvm+0x1f>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100b46:	50                   	push   %eax
+f0100b47:	68 1c c0 10 f0       	push   $0xf010c01c
+f0100b4c:	68 ff 00 00 00       	push   $0xff
+f0100b51:	68 23 c3 10 f0       	push   $0xf010c323
+f0100b56:	e8 3d f5 ff ff       	call   f0100098 <_panic>
+			cprintf("0x%08x: ", va);
+f0100b5b:	83 ec 08             	sub    $0x8,%esp
+f0100b5e:	53                   	push   %ebx
+f0100b5f:	68 32 c3 10 f0       	push   $0xf010c332
+f0100b64:	e8 93 64 00 00       	call   f0106ffc <cprintf>
+f0100b69:	83 c4 10             	add    $0x10,%esp
+f0100b6c:	eb 2b                	jmp    f0100b99 <mon_showvm+0xef>
+			cprintf("xx");
+f0100b6e:	83 ec 0c             	sub    $0xc,%esp
+f0100b71:	68 40 c3 10 f0       	push   $0xf010c340
+f0100b76:	e8 81 64 00 00       	call   f0106ffc <cprintf>
+f0100b7b:	83 c4 10             	add    $0x10,%esp
+		(*i)++;
+f0100b7e:	83 c7 01             	add    $0x1,%edi
+		if (*i == 4) {
+f0100b81:	83 ff 04             	cmp    $0x4,%edi
+f0100b84:	74 2f                	je     f0100bb5 <mon_showvm+0x10b>
+		if (*j == 4) {
+f0100b86:	83 fe 04             	cmp    $0x4,%esi
+f0100b89:	74 44                	je     f0100bcf <mon_showvm+0x125>
+	for (va = (char *) begin_va; va <= (char *) end_va; va++) {
+f0100b8b:	83 c3 01             	add    $0x1,%ebx
+f0100b8e:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+f0100b91:	72 58                	jb     f0100beb <mon_showvm+0x141>
+		if (*i == 0 && *j == 0)
+f0100b93:	89 f8                	mov    %edi,%eax
+f0100b95:	09 f0                	or     %esi,%eax
+f0100b97:	74 c2                	je     f0100b5b <mon_showvm+0xb1>
+		if (valid)
+f0100b99:	80 7d e3 00          	cmpb   $0x0,-0x1d(%ebp)
+f0100b9d:	74 cf                	je     f0100b6e <mon_showvm+0xc4>
+			cprintf("%02x", (uint8_t) *va);
+f0100b9f:	83 ec 08             	sub    $0x8,%esp
+f0100ba2:	0f b6 03             	movzbl (%ebx),%eax
+f0100ba5:	50                   	push   %eax
+f0100ba6:	68 3b c3 10 f0       	push   $0xf010c33b
+f0100bab:	e8 4c 64 00 00       	call   f0106ffc <cprintf>
+f0100bb0:	83 c4 10             	add    $0x10,%esp
+f0100bb3:	eb c9                	jmp    f0100b7e <mon_showvm+0xd4>
+		cprintf(" ");
+f0100bb5:	83 ec 0c             	sub    $0xc,%esp
+f0100bb8:	68 05 c5 10 f0       	push   $0xf010c505
+f0100bbd:	e8 3a 64 00 00       	call   f0106ffc <cprintf>
+			(*j)++;
+f0100bc2:	83 c6 01             	add    $0x1,%esi
+f0100bc5:	83 c4 10             	add    $0x10,%esp
+			*i = 0;
+f0100bc8:	bf 00 00 00 00       	mov    $0x0,%edi
+f0100bcd:	eb b7                	jmp    f0100b86 <mon_showvm+0xdc>
+			cprintf("\n");
+f0100bcf:	83 ec 0c             	sub    $0xc,%esp
+f0100bd2:	68 30 db 10 f0       	push   $0xf010db30
+f0100bd7:	e8 20 64 00 00       	call   f0106ffc <cprintf>
+f0100bdc:	83 c4 10             	add    $0x10,%esp
+			*i = *j = 0;
+f0100bdf:	be 00 00 00 00       	mov    $0x0,%esi
+f0100be4:	bf 00 00 00 00       	mov    $0x0,%edi
+f0100be9:	eb a0                	jmp    f0100b8b <mon_showvm+0xe1>
+	for (i = j = 0, va = begin_va; va <= end_va; va += PGSIZE) {
+f0100beb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0100bee:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+f0100bf1:	72 51                	jb     f0100c44 <mon_showvm+0x19a>
+		pte = pgdir_walk(pgdir, (void *) va, 0);
+f0100bf3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0100bf6:	89 c3                	mov    %eax,%ebx
+f0100bf8:	83 ec 04             	sub    $0x4,%esp
+f0100bfb:	6a 00                	push   $0x0
+f0100bfd:	50                   	push   %eax
+f0100bfe:	ff 75 d4             	push   -0x2c(%ebp)
+f0100c01:	e8 5a 19 00 00       	call   f0102560 <pgdir_walk>
+f0100c06:	89 c2                	mov    %eax,%edx
+		next_va = MIN(ROUNDDOWN(va + PGSIZE, PGSIZE) - 1, end_va);
+f0100c08:	81 45 dc 00 10 00 00 	addl   $0x1000,-0x24(%ebp)
+f0100c0f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0100c12:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100c17:	83 e8 01             	sub    $0x1,%eax
+f0100c1a:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f0100c1d:	39 c8                	cmp    %ecx,%eax
+f0100c1f:	0f 47 c1             	cmova  %ecx,%eax
+f0100c22:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		show_page(pgdir, va, next_va, *pte && (*pte & PTE_P), &i, &j);
+f0100c25:	8b 12                	mov    (%edx),%edx
+f0100c27:	83 c4 10             	add    $0x10,%esp
+f0100c2a:	89 d0                	mov    %edx,%eax
+f0100c2c:	83 e0 01             	and    $0x1,%eax
+f0100c2f:	85 d2                	test   %edx,%edx
+f0100c31:	ba 00 00 00 00       	mov    $0x0,%edx
+f0100c36:	0f 44 c2             	cmove  %edx,%eax
+f0100c39:	83 e0 01             	and    $0x1,%eax
+f0100c3c:	88 45 e3             	mov    %al,-0x1d(%ebp)
+	for (va = (char *) begin_va; va <= (char *) end_va; va++) {
+f0100c3f:	e9 4a ff ff ff       	jmp    f0100b8e <mon_showvm+0xe4>
+	if (i)
+f0100c44:	85 ff                	test   %edi,%edi
+f0100c46:	0f 84 7d fe ff ff    	je     f0100ac9 <mon_showvm+0x1f>
+		cprintf("\n");
+f0100c4c:	83 ec 0c             	sub    $0xc,%esp
+f0100c4f:	68 30 db 10 f0       	push   $0xf010db30
+f0100c54:	e8 a3 63 00 00       	call   f0106ffc <cprintf>
+f0100c59:	83 c4 10             	add    $0x10,%esp
+f0100c5c:	e9 68 fe ff ff       	jmp    f0100ac9 <mon_showvm+0x1f>
+
+f0100c61 <mon_continue>:
+{
+f0100c61:	55                   	push   %ebp
+f0100c62:	89 e5                	mov    %esp,%ebp
+f0100c64:	83 ec 08             	sub    $0x8,%esp
+	if (argc != 1) {
+f0100c67:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f0100c6b:	75 1d                	jne    f0100c8a <mon_continue+0x29>
+	if (!tf) {
+f0100c6d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0100c71:	75 29                	jne    f0100c9c <mon_continue+0x3b>
+		cprintf("tf is invalid\n");
+f0100c73:	83 ec 0c             	sub    $0xc,%esp
+f0100c76:	68 54 c3 10 f0       	push   $0xf010c354
+f0100c7b:	e8 7c 63 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0100c80:	83 c4 10             	add    $0x10,%esp
+}
+f0100c83:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100c88:	c9                   	leave
+f0100c89:	c3                   	ret
+		cprintf("usage: continue\n");
+f0100c8a:	83 ec 0c             	sub    $0xc,%esp
+f0100c8d:	68 43 c3 10 f0       	push   $0xf010c343
+f0100c92:	e8 65 63 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0100c97:	83 c4 10             	add    $0x10,%esp
+f0100c9a:	eb e7                	jmp    f0100c83 <mon_continue+0x22>
+	if (tf->tf_eflags & FL_TF)
+f0100c9c:	8b 45 10             	mov    0x10(%ebp),%eax
+f0100c9f:	8b 40 38             	mov    0x38(%eax),%eax
+f0100ca2:	f6 c4 01             	test   $0x1,%ah
+f0100ca5:	74 09                	je     f0100cb0 <mon_continue+0x4f>
+		tf->tf_eflags &= ~FL_TF;
+f0100ca7:	80 e4 fe             	and    $0xfe,%ah
+f0100caa:	8b 55 10             	mov    0x10(%ebp),%edx
+f0100cad:	89 42 38             	mov    %eax,0x38(%edx)
+	env_run(curenv);
+f0100cb0:	e8 8f 9f 00 00       	call   f010ac44 <cpunum>
+f0100cb5:	83 ec 0c             	sub    $0xc,%esp
+f0100cb8:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0100cbe:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0100cc4:	e8 b1 5f 00 00       	call   f0106c7a <env_run>
+
+f0100cc9 <mon_stepinto>:
+{
+f0100cc9:	55                   	push   %ebp
+f0100cca:	89 e5                	mov    %esp,%ebp
+f0100ccc:	83 ec 08             	sub    $0x8,%esp
+	if (argc != 1) {
+f0100ccf:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f0100cd3:	75 1d                	jne    f0100cf2 <mon_stepinto+0x29>
+	if (!tf) {
+f0100cd5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0100cd9:	75 29                	jne    f0100d04 <mon_stepinto+0x3b>
+		cprintf("tf is invalid\n");
+f0100cdb:	83 ec 0c             	sub    $0xc,%esp
+f0100cde:	68 54 c3 10 f0       	push   $0xf010c354
+f0100ce3:	e8 14 63 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0100ce8:	83 c4 10             	add    $0x10,%esp
+}
+f0100ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100cf0:	c9                   	leave
+f0100cf1:	c3                   	ret
+		cprintf("usage: stepinto\n");
+f0100cf2:	83 ec 0c             	sub    $0xc,%esp
+f0100cf5:	68 63 c3 10 f0       	push   $0xf010c363
+f0100cfa:	e8 fd 62 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0100cff:	83 c4 10             	add    $0x10,%esp
+f0100d02:	eb e7                	jmp    f0100ceb <mon_stepinto+0x22>
+	if (!(tf->tf_eflags & FL_TF))
+f0100d04:	8b 45 10             	mov    0x10(%ebp),%eax
+f0100d07:	8b 40 38             	mov    0x38(%eax),%eax
+f0100d0a:	f6 c4 01             	test   $0x1,%ah
+f0100d0d:	75 09                	jne    f0100d18 <mon_stepinto+0x4f>
+		tf->tf_eflags |= FL_TF;
+f0100d0f:	80 cc 01             	or     $0x1,%ah
+f0100d12:	8b 55 10             	mov    0x10(%ebp),%edx
+f0100d15:	89 42 38             	mov    %eax,0x38(%edx)
+	env_run(curenv);
+f0100d18:	e8 27 9f 00 00       	call   f010ac44 <cpunum>
+f0100d1d:	83 ec 0c             	sub    $0xc,%esp
+f0100d20:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0100d26:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0100d2c:	e8 49 5f 00 00       	call   f0106c7a <env_run>
+
+f0100d31 <mon_schedstat>:
+
+int
+mon_schedstat(int argc, char **argv, struct Trapframe *tf)
+{
+f0100d31:	55                   	push   %ebp
+f0100d32:	89 e5                	mov    %esp,%ebp
+f0100d34:	57                   	push   %edi
+f0100d35:	56                   	push   %esi
+f0100d36:	53                   	push   %ebx
+f0100d37:	83 ec 2c             	sub    $0x2c,%esp
+f0100d3a:	8b 45 08             	mov    0x8(%ebp),%eax
+	envid_t envid;
+	struct Env *e;
+	char *end;
+	int i;
+
+	if (argc == 1) {
+f0100d3d:	83 f8 01             	cmp    $0x1,%eax
+f0100d40:	0f 84 87 00 00 00    	je     f0100dcd <mon_schedstat+0x9c>
+		wait = sched_wait_hist;
+		run = sched_run_hist;
+	} else if (argc == 2) {
+f0100d46:	83 f8 02             	cmp    $0x2,%eax
+f0100d49:	75 65                	jne    f0100db0 <mon_schedstat+0x7f>
+		envid = strtol(argv[1], &end, 16);
+f0100d4b:	83 ec 04             	sub    $0x4,%esp
+f0100d4e:	6a 10                	push   $0x10
+f0100d50:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0100d53:	50                   	push   %eax
+f0100d54:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100d57:	ff 70 04             	push   0x4(%eax)
+f0100d5a:	e8 a2 99 00 00       	call   f010a701 <strtol>
+		if (*end || !envid || envid2env(envid, &e, 0) < 0) {
+f0100d5f:	83 c4 10             	add    $0x10,%esp
+f0100d62:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0100d65:	80 3a 00             	cmpb   $0x0,(%edx)
+f0100d68:	75 2e                	jne    f0100d98 <mon_schedstat+0x67>
+f0100d6a:	85 c0                	test   %eax,%eax
+f0100d6c:	74 2a                	je     f0100d98 <mon_schedstat+0x67>
+f0100d6e:	83 ec 04             	sub    $0x4,%esp
+f0100d71:	6a 00                	push   $0x0
+f0100d73:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0100d76:	52                   	push   %edx
+f0100d77:	50                   	push   %eax
+f0100d78:	e8 a7 54 00 00       	call   f0106224 <envid2env>
+f0100d7d:	83 c4 10             	add    $0x10,%esp
+f0100d80:	85 c0                	test   %eax,%eax
+f0100d82:	78 14                	js     f0100d98 <mon_schedstat+0x67>
+			cprintf("schedstat: bad envid %s\n", argv[1]);
+			return 0;
+		}
+		wait = e->env_wait_hist;
+f0100d84:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0100d87:	8d 86 90 00 00 00    	lea    0x90(%esi),%eax
+f0100d8d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		run = e->env_run_hist;
+f0100d90:	81 c6 e0 00 00 00    	add    $0xe0,%esi
+f0100d96:	eb 41                	jmp    f0100dd9 <mon_schedstat+0xa8>
+			cprintf("schedstat: bad envid %s\n", argv[1]);
+f0100d98:	83 ec 08             	sub    $0x8,%esp
+f0100d9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100d9e:	ff 70 04             	push   0x4(%eax)
+f0100da1:	68 74 c3 10 f0       	push   $0xf010c374
+f0100da6:	e8 51 62 00 00       	call   f0106ffc <cprintf>
+			return 0;
+f0100dab:	83 c4 10             	add    $0x10,%esp
+f0100dae:	eb 10                	jmp    f0100dc0 <mon_schedstat+0x8f>
+	} else {
+		cprintf("usage: schedstat [envid]\n");
+f0100db0:	83 ec 0c             	sub    $0xc,%esp
+f0100db3:	68 8d c3 10 f0       	push   $0xf010c38d
+f0100db8:	e8 3f 62 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0100dbd:	83 c4 10             	add    $0x10,%esp
+			continue;
+		cprintf("%13u  %10u  %10u\n",
+			i ? 1 << (SCHEDHIST_SHIFT + i) : 0, wait[i], run[i]);
+	}
+	return 0;
+}
+f0100dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100dc8:	5b                   	pop    %ebx
+f0100dc9:	5e                   	pop    %esi
+f0100dca:	5f                   	pop    %edi
+f0100dcb:	5d                   	pop    %ebp
+f0100dcc:	c3                   	ret
+		run = sched_run_hist;
+f0100dcd:	be a0 89 61 f0       	mov    $0xf06189a0,%esi
+		wait = sched_wait_hist;
+f0100dd2:	c7 45 d0 00 8a 61 f0 	movl   $0xf0618a00,-0x30(%ebp)
+	cprintf("TSC cycles >=        wait         run\n");
+f0100dd9:	83 ec 0c             	sub    $0xc,%esp
+f0100ddc:	68 e8 c7 10 f0       	push   $0xf010c7e8
+f0100de1:	e8 16 62 00 00       	call   f0106ffc <cprintf>
+f0100de6:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NSCHEDHIST; i++) {
+f0100de9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		cprintf("%13u  %10u  %10u\n",
+f0100dee:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+f0100df1:	eb 2f                	jmp    f0100e22 <mon_schedstat+0xf1>
+f0100df3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0100df6:	8b 3c 88             	mov    (%eax,%ecx,4),%edi
+f0100df9:	89 d8                	mov    %ebx,%eax
+f0100dfb:	83 c1 0a             	add    $0xa,%ecx
+f0100dfe:	be 01 00 00 00       	mov    $0x1,%esi
+f0100e03:	d3 e6                	shl    %cl,%esi
+f0100e05:	85 db                	test   %ebx,%ebx
+f0100e07:	0f 45 c6             	cmovne %esi,%eax
+f0100e0a:	57                   	push   %edi
+f0100e0b:	52                   	push   %edx
+f0100e0c:	50                   	push   %eax
+f0100e0d:	68 a7 c3 10 f0       	push   $0xf010c3a7
+f0100e12:	e8 e5 61 00 00       	call   f0106ffc <cprintf>
+f0100e17:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NSCHEDHIST; i++) {
+f0100e1a:	83 c3 01             	add    $0x1,%ebx
+f0100e1d:	83 fb 14             	cmp    $0x14,%ebx
+f0100e20:	74 9e                	je     f0100dc0 <mon_schedstat+0x8f>
+		if (!wait[i] && !run[i])
+f0100e22:	89 d9                	mov    %ebx,%ecx
+f0100e24:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0100e27:	8b 14 98             	mov    (%eax,%ebx,4),%edx
+f0100e2a:	85 d2                	test   %edx,%edx
+f0100e2c:	75 c5                	jne    f0100df3 <mon_schedstat+0xc2>
+f0100e2e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0100e31:	83 3c 98 00          	cmpl   $0x0,(%eax,%ebx,4)
+f0100e35:	75 bc                	jne    f0100df3 <mon_schedstat+0xc2>
+f0100e37:	eb e1                	jmp    f0100e1a <mon_schedstat+0xe9>
+
+f0100e39 <mon_lockstat>:
+
+int
+mon_lockstat(int argc, char **argv, struct Trapframe *tf)
+{
+f0100e39:	55                   	push   %ebp
+f0100e3a:	89 e5                	mov    %esp,%ebp
+f0100e3c:	57                   	push   %edi
+f0100e3d:	56                   	push   %esi
+f0100e3e:	53                   	push   %ebx
+f0100e3f:	83 ec 2c             	sub    $0x2c,%esp
+	struct spinlock *lk, *o;
+	uint32_t n, acquires, contended;
+	uint64_t spin, hold;
+
+	if (argc != 1) {
+f0100e42:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f0100e46:	74 1d                	je     f0100e65 <mon_lockstat+0x2c>
+		cprintf("usage: lockstat\n");
+f0100e48:	83 ec 0c             	sub    $0xc,%esp
+f0100e4b:	68 b9 c3 10 f0       	push   $0xf010c3b9
+f0100e50:	e8 a7 61 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0100e55:	83 c4 10             	add    $0x10,%esp
+		}
+		cprintf("%-16s %5u %10u %10u %16llu %12llu\n", lk->name, n,
+			acquires, contended, spin, hold);
+	}
+	return 0;
+}
+f0100e58:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100e60:	5b                   	pop    %ebx
+f0100e61:	5e                   	pop    %esi
+f0100e62:	5f                   	pop    %edi
+f0100e63:	5d                   	pop    %ebp
+f0100e64:	c3                   	ret
+	cprintf("%-16s %5s %10s %10s %16s %12s\n", "lock", "locks",
+f0100e65:	83 ec 04             	sub    $0x4,%esp
+f0100e68:	68 ca c3 10 f0       	push   $0xf010c3ca
+f0100e6d:	68 d3 c3 10 f0       	push   $0xf010c3d3
+f0100e72:	68 df c3 10 f0       	push   $0xf010c3df
+f0100e77:	68 e9 c3 10 f0       	push   $0xf010c3e9
+f0100e7c:	68 f2 c3 10 f0       	push   $0xf010c3f2
+f0100e81:	68 55 dd 10 f0       	push   $0xf010dd55
+f0100e86:	68 10 c8 10 f0       	push   $0xf010c810
+f0100e8b:	e8 6c 61 00 00       	call   f0106ffc <cprintf>
+	for (lk = spin_lock_list(); lk; lk = lk->link) {
+f0100e90:	83 c4 20             	add    $0x20,%esp
+f0100e93:	e8 35 a0 00 00       	call   f010aecd <spin_lock_list>
+f0100e98:	89 c6                	mov    %eax,%esi
+f0100e9a:	eb 0f                	jmp    f0100eab <mon_lockstat+0x72>
+		for (o = spin_lock_list(); o->name != lk->name; o = o->link)
+f0100e9c:	8b 40 2c             	mov    0x2c(%eax),%eax
+f0100e9f:	39 50 08             	cmp    %edx,0x8(%eax)
+f0100ea2:	75 f8                	jne    f0100e9c <mon_lockstat+0x63>
+		if (o != lk)
+f0100ea4:	39 c6                	cmp    %eax,%esi
+f0100ea6:	74 11                	je     f0100eb9 <mon_lockstat+0x80>
+	for (lk = spin_lock_list(); lk; lk = lk->link) {
+f0100ea8:	8b 76 2c             	mov    0x2c(%esi),%esi
+f0100eab:	85 f6                	test   %esi,%esi
+f0100ead:	74 a9                	je     f0100e58 <mon_lockstat+0x1f>
+		for (o = spin_lock_list(); o->name != lk->name; o = o->link)
+f0100eaf:	e8 19 a0 00 00       	call   f010aecd <spin_lock_list>
+f0100eb4:	8b 56 08             	mov    0x8(%esi),%edx
+f0100eb7:	eb e6                	jmp    f0100e9f <mon_lockstat+0x66>
+		spin = hold = 0;
+f0100eb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0100ebe:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0100ec3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+f0100eca:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+		n = acquires = contended = 0;
+f0100ed1:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0100ed8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0100edf:	bf 00 00 00 00       	mov    $0x0,%edi
+f0100ee4:	89 75 d0             	mov    %esi,-0x30(%ebp)
+f0100ee7:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+f0100eea:	eb 07                	jmp    f0100ef3 <mon_lockstat+0xba>
+		for (; o; o = o->link) {
+f0100eec:	8b 40 2c             	mov    0x2c(%eax),%eax
+f0100eef:	85 c0                	test   %eax,%eax
+f0100ef1:	74 33                	je     f0100f26 <mon_lockstat+0xed>
+			if (o->name != lk->name)
+f0100ef3:	3b 50 08             	cmp    0x8(%eax),%edx
+f0100ef6:	75 f4                	jne    f0100eec <mon_lockstat+0xb3>
+			n++;
+f0100ef8:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+			acquires += o->acquires;
+f0100efc:	8b 70 0c             	mov    0xc(%eax),%esi
+f0100eff:	01 75 e4             	add    %esi,-0x1c(%ebp)
+			contended += o->contended;
+f0100f02:	8b 70 10             	mov    0x10(%eax),%esi
+f0100f05:	01 75 e0             	add    %esi,-0x20(%ebp)
+			spin += o->spin_cycles;
+f0100f08:	8b 70 14             	mov    0x14(%eax),%esi
+f0100f0b:	8b 78 18             	mov    0x18(%eax),%edi
+f0100f0e:	01 75 d8             	add    %esi,-0x28(%ebp)
+f0100f11:	11 7d dc             	adc    %edi,-0x24(%ebp)
+			if (o->max_hold > hold)
+f0100f14:	3b 48 1c             	cmp    0x1c(%eax),%ecx
+f0100f17:	89 df                	mov    %ebx,%edi
+f0100f19:	1b 78 20             	sbb    0x20(%eax),%edi
+f0100f1c:	0f 42 48 1c          	cmovb  0x1c(%eax),%ecx
+f0100f20:	0f 42 58 20          	cmovb  0x20(%eax),%ebx
+f0100f24:	eb c6                	jmp    f0100eec <mon_lockstat+0xb3>
+		cprintf("%-16s %5u %10u %10u %16llu %12llu\n", lk->name, n,
+f0100f26:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f0100f29:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0100f2c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f0100f2f:	83 ec 0c             	sub    $0xc,%esp
+f0100f32:	53                   	push   %ebx
+f0100f33:	51                   	push   %ecx
+f0100f34:	ff 75 dc             	push   -0x24(%ebp)
+f0100f37:	ff 75 d8             	push   -0x28(%ebp)
+f0100f3a:	50                   	push   %eax
+f0100f3b:	ff 75 e4             	push   -0x1c(%ebp)
+f0100f3e:	57                   	push   %edi
+f0100f3f:	52                   	push   %edx
+f0100f40:	68 30 c8 10 f0       	push   $0xf010c830
+f0100f45:	e8 b2 60 00 00       	call   f0106ffc <cprintf>
+f0100f4a:	83 c4 30             	add    $0x30,%esp
+f0100f4d:	e9 56 ff ff ff       	jmp    f0100ea8 <mon_lockstat+0x6f>
+
+f0100f52 <mon_memstat>:
+
+int
+mon_memstat(int argc, char **argv, struct Trapframe *tf)
+{
+f0100f52:	55                   	push   %ebp
+f0100f53:	89 e5                	mov    %esp,%ebp
+f0100f55:	57                   	push   %edi
+f0100f56:	56                   	push   %esi
+f0100f57:	53                   	push   %ebx
+f0100f58:	83 ec 5c             	sub    $0x5c,%esp
+		cprintf("usage: memstat\n");
+		return 0;
+	}
+
+	free = 0;
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+f0100f5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	free = 0;
+f0100f60:	be 00 00 00 00       	mov    $0x0,%esi
+	if (argc != 1) {
+f0100f65:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f0100f69:	75 3a                	jne    f0100fa5 <mon_memstat+0x53>
+		blocks[order] = page_free_blocks(order);
+f0100f6b:	83 ec 0c             	sub    $0xc,%esp
+f0100f6e:	53                   	push   %ebx
+f0100f6f:	e8 e7 0e 00 00       	call   f0101e5b <page_free_blocks>
+f0100f74:	89 44 9d bc          	mov    %eax,-0x44(%ebp,%ebx,4)
+		free += blocks[order] << order;
+f0100f78:	89 d9                	mov    %ebx,%ecx
+f0100f7a:	d3 e0                	shl    %cl,%eax
+f0100f7c:	01 c6                	add    %eax,%esi
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+f0100f7e:	83 c3 01             	add    $0x1,%ebx
+f0100f81:	83 c4 10             	add    $0x10,%esp
+f0100f84:	83 fb 0b             	cmp    $0xb,%ebx
+f0100f87:	75 e2                	jne    f0100f6b <mon_memstat+0x19>
+	}
+	cached = 0;
+	for (c = cpus; c < cpus + ncpu; c++)
+f0100f89:	69 15 04 96 61 f0 bc 	imul   $0xbc,0xf0619604,%edx
+f0100f90:	00 00 00 
+f0100f93:	81 c2 20 90 61 f0    	add    $0xf0619020,%edx
+f0100f99:	b8 20 90 61 f0       	mov    $0xf0619020,%eax
+	cached = 0;
+f0100f9e:	bf 00 00 00 00       	mov    $0x0,%edi
+f0100fa3:	eb 20                	jmp    f0100fc5 <mon_memstat+0x73>
+		cprintf("usage: memstat\n");
+f0100fa5:	83 ec 0c             	sub    $0xc,%esp
+f0100fa8:	68 f8 c3 10 f0       	push   $0xf010c3f8
+f0100fad:	e8 4a 60 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0100fb2:	83 c4 10             	add    $0x10,%esp
+f0100fb5:	e9 db 00 00 00       	jmp    f0101095 <mon_memstat+0x143>
+		cached += c->cpu_nfree_pages;
+f0100fba:	03 b8 ac 00 00 00    	add    0xac(%eax),%edi
+	for (c = cpus; c < cpus + ncpu; c++)
+f0100fc0:	05 bc 00 00 00       	add    $0xbc,%eax
+f0100fc5:	39 d0                	cmp    %edx,%eax
+f0100fc7:	72 f1                	jb     f0100fba <mon_memstat+0x68>
+
+	// 'unusable' is the share of free memory that is in blocks too
+	// small for an allocation of that order.
+	cprintf("order  free blocks  free pages  unusable\n");
+f0100fc9:	83 ec 0c             	sub    $0xc,%esp
+f0100fcc:	68 54 c8 10 f0       	push   $0xf010c854
+f0100fd1:	e8 26 60 00 00       	call   f0106ffc <cprintf>
+f0100fd6:	83 c4 10             	add    $0x10,%esp
+	below = 0;
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+f0100fd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+	below = 0;
+f0100fde:	b8 00 00 00 00       	mov    $0x0,%eax
+		cprintf("%5d  %11u  %10u  %7u%%\n", order, blocks[order],
+f0100fe3:	89 75 a0             	mov    %esi,-0x60(%ebp)
+f0100fe6:	89 7d 9c             	mov    %edi,-0x64(%ebp)
+f0100fe9:	89 c7                	mov    %eax,%edi
+f0100feb:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+f0100fee:	eb 28                	jmp    f0101018 <mon_memstat+0xc6>
+			blocks[order] << order, free ? below * 100 / free : 0);
+f0100ff0:	8b 54 9d bc          	mov    -0x44(%ebp,%ebx,4),%edx
+		cprintf("%5d  %11u  %10u  %7u%%\n", order, blocks[order],
+f0100ff4:	89 d6                	mov    %edx,%esi
+f0100ff6:	89 d9                	mov    %ebx,%ecx
+f0100ff8:	d3 e6                	shl    %cl,%esi
+f0100ffa:	83 ec 0c             	sub    $0xc,%esp
+f0100ffd:	50                   	push   %eax
+f0100ffe:	56                   	push   %esi
+f0100fff:	52                   	push   %edx
+f0101000:	53                   	push   %ebx
+f0101001:	68 08 c4 10 f0       	push   $0xf010c408
+f0101006:	e8 f1 5f 00 00       	call   f0106ffc <cprintf>
+		below += blocks[order] << order;
+f010100b:	01 f7                	add    %esi,%edi
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+f010100d:	83 c3 01             	add    $0x1,%ebx
+f0101010:	83 c4 20             	add    $0x20,%esp
+f0101013:	83 fb 0b             	cmp    $0xb,%ebx
+f0101016:	74 16                	je     f010102e <mon_memstat+0xdc>
+		cprintf("%5d  %11u  %10u  %7u%%\n", order, blocks[order],
+f0101018:	8b 45 a0             	mov    -0x60(%ebp),%eax
+f010101b:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+f010101e:	85 c9                	test   %ecx,%ecx
+f0101020:	74 ce                	je     f0100ff0 <mon_memstat+0x9e>
+			blocks[order] << order, free ? below * 100 / free : 0);
+f0101022:	6b c7 64             	imul   $0x64,%edi,%eax
+		cprintf("%5d  %11u  %10u  %7u%%\n", order, blocks[order],
+f0101025:	ba 00 00 00 00       	mov    $0x0,%edx
+f010102a:	f7 f1                	div    %ecx
+f010102c:	eb c2                	jmp    f0100ff0 <mon_memstat+0x9e>
+	}
+	cprintf("%u pages free, %u more in per-CPU caches\n", free, cached);
+f010102e:	8b 7d 9c             	mov    -0x64(%ebp),%edi
+f0101031:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+f0101034:	83 ec 04             	sub    $0x4,%esp
+f0101037:	57                   	push   %edi
+f0101038:	56                   	push   %esi
+f0101039:	68 80 c8 10 f0       	push   $0xf010c880
+f010103e:	e8 b9 5f 00 00       	call   f0106ffc <cprintf>
+	if (npages > npages_lowmem)
+f0101043:	a1 78 89 61 f0       	mov    0xf0618978,%eax
+f0101048:	8b 15 6c 89 61 f0    	mov    0xf061896c,%edx
+f010104e:	83 c4 10             	add    $0x10,%esp
+f0101051:	39 c2                	cmp    %eax,%edx
+f0101053:	72 4d                	jb     f01010a2 <mon_memstat+0x150>
+		cprintf("high memory: %u of %u pages free\n",
+			page_high_free_count(), npages - npages_lowmem);
+
+	page_zero_stat(&zs);
+f0101055:	83 ec 0c             	sub    $0xc,%esp
+f0101058:	8d 45 ac             	lea    -0x54(%ebp),%eax
+f010105b:	50                   	push   %eax
+f010105c:	e8 09 0e 00 00       	call   f0101e6a <page_zero_stat>
+	cprintf("zeroed pool: %u pages, %u filled, %u hits, %u misses (%u%% hit)\n",
+		zs.pages, zs.filled, zs.hits, zs.misses,
+		zs.hits + zs.misses ? zs.hits * 100 / (zs.hits + zs.misses) : 0);
+f0101061:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+f0101064:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+	cprintf("zeroed pool: %u pages, %u filled, %u hits, %u misses (%u%% hit)\n",
+f0101067:	83 c4 10             	add    $0x10,%esp
+f010106a:	89 ce                	mov    %ecx,%esi
+f010106c:	01 de                	add    %ebx,%esi
+f010106e:	74 0c                	je     f010107c <mon_memstat+0x12a>
+		zs.hits + zs.misses ? zs.hits * 100 / (zs.hits + zs.misses) : 0);
+f0101070:	6b c1 64             	imul   $0x64,%ecx,%eax
+	cprintf("zeroed pool: %u pages, %u filled, %u hits, %u misses (%u%% hit)\n",
+f0101073:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101078:	f7 f6                	div    %esi
+f010107a:	89 c6                	mov    %eax,%esi
+f010107c:	83 ec 08             	sub    $0x8,%esp
+f010107f:	56                   	push   %esi
+f0101080:	53                   	push   %ebx
+f0101081:	51                   	push   %ecx
+f0101082:	ff 75 b8             	push   -0x48(%ebp)
+f0101085:	ff 75 ac             	push   -0x54(%ebp)
+f0101088:	68 d0 c8 10 f0       	push   $0xf010c8d0
+f010108d:	e8 6a 5f 00 00       	call   f0106ffc <cprintf>
+	return 0;
+f0101092:	83 c4 20             	add    $0x20,%esp
+}
+f0101095:	b8 00 00 00 00       	mov    $0x0,%eax
+f010109a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010109d:	5b                   	pop    %ebx
+f010109e:	5e                   	pop    %esi
+f010109f:	5f                   	pop    %edi
+f01010a0:	5d                   	pop    %ebp
+f01010a1:	c3                   	ret
+		cprintf("high memory: %u of %u pages free\n",
+f01010a2:	29 d0                	sub    %edx,%eax
+f01010a4:	89 c3                	mov    %eax,%ebx
+f01010a6:	e8 aa 0d 00 00       	call   f0101e55 <page_high_free_count>
+f01010ab:	83 ec 04             	sub    $0x4,%esp
+f01010ae:	53                   	push   %ebx
+f01010af:	50                   	push   %eax
+f01010b0:	68 ac c8 10 f0       	push   $0xf010c8ac
+f01010b5:	e8 42 5f 00 00       	call   f0106ffc <cprintf>
+f01010ba:	83 c4 10             	add    $0x10,%esp
+f01010bd:	eb 96                	jmp    f0101055 <mon_memstat+0x103>
+
+f01010bf <mon_kmemstat>:
+
+int
+mon_kmemstat(int argc, char **argv, struct Trapframe *tf)
+{
+f01010bf:	55                   	push   %ebp
+f01010c0:	89 e5                	mov    %esp,%ebp
+f01010c2:	57                   	push   %edi
+f01010c3:	56                   	push   %esi
+f01010c4:	53                   	push   %ebx
+f01010c5:	83 ec 1c             	sub    $0x1c,%esp
+	struct KmemCache *kc;
+	struct KmemCpu *cc;
+	uint32_t cached, allocs, frees, refills, inuse;
+
+	if (argc != 1) {
+f01010c8:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f01010cc:	74 1d                	je     f01010eb <mon_kmemstat+0x2c>
+		cprintf("usage: kmemstat\n");
+f01010ce:	83 ec 0c             	sub    $0xc,%esp
+f01010d1:	68 20 c4 10 f0       	push   $0xf010c420
+f01010d6:	e8 21 5f 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f01010db:	83 c4 10             	add    $0x10,%esp
+		cprintf("%-16s %6u %6u %8u %8u %10u %10u %8u\n", kc->kc_name,
+			kc->kc_size, kc->kc_slabs, inuse, cached, allocs,
+			frees, refills);
+	}
+	return 0;
+}
+f01010de:	b8 00 00 00 00       	mov    $0x0,%eax
+f01010e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01010e6:	5b                   	pop    %ebx
+f01010e7:	5e                   	pop    %esi
+f01010e8:	5f                   	pop    %edi
+f01010e9:	5d                   	pop    %ebp
+f01010ea:	c3                   	ret
+	cprintf("%-16s %6s %6s %8s %8s %10s %10s %8s\n", "cache", "size",
+f01010eb:	83 ec 0c             	sub    $0xc,%esp
+f01010ee:	68 31 c4 10 f0       	push   $0xf010c431
+f01010f3:	68 39 c4 10 f0       	push   $0xf010c439
+f01010f8:	68 3f c4 10 f0       	push   $0xf010c43f
+f01010fd:	68 46 c4 10 f0       	push   $0xf010c446
+f0101102:	68 4d c4 10 f0       	push   $0xf010c44d
+f0101107:	68 54 c4 10 f0       	push   $0xf010c454
+f010110c:	68 5a c4 10 f0       	push   $0xf010c45a
+f0101111:	68 e2 db 10 f0       	push   $0xf010dbe2
+f0101116:	68 14 c9 10 f0       	push   $0xf010c914
+f010111b:	e8 dc 5e 00 00       	call   f0106ffc <cprintf>
+	for (kc = kmem_cache_list(); kc; kc = kc->kc_next) {
+f0101120:	83 c4 30             	add    $0x30,%esp
+f0101123:	e8 68 41 00 00       	call   f0105290 <kmem_cache_list>
+f0101128:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010112b:	eb 45                	jmp    f0101172 <mon_kmemstat+0xb3>
+			cached += cc->kc_nobjs;
+f010112d:	03 50 40             	add    0x40(%eax),%edx
+			allocs += cc->kc_allocs;
+f0101130:	03 48 44             	add    0x44(%eax),%ecx
+			frees += cc->kc_frees;
+f0101133:	03 58 48             	add    0x48(%eax),%ebx
+			refills += cc->kc_refills;
+f0101136:	03 70 4c             	add    0x4c(%eax),%esi
+		for (cc = kc->kc_cpu; cc < kc->kc_cpu + ncpu; cc++) {
+f0101139:	83 c0 50             	add    $0x50,%eax
+f010113c:	39 f8                	cmp    %edi,%eax
+f010113e:	72 ed                	jb     f010112d <mon_kmemstat+0x6e>
+		inuse = kc->kc_slabs * kc->kc_perslab - kc->kc_free - cached;
+f0101140:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0101143:	8b 47 74             	mov    0x74(%edi),%eax
+		cprintf("%-16s %6u %6u %8u %8u %10u %10u %8u\n", kc->kc_name,
+f0101146:	83 ec 0c             	sub    $0xc,%esp
+f0101149:	56                   	push   %esi
+f010114a:	53                   	push   %ebx
+f010114b:	51                   	push   %ecx
+f010114c:	52                   	push   %edx
+		inuse = kc->kc_slabs * kc->kc_perslab - kc->kc_free - cached;
+f010114d:	89 c1                	mov    %eax,%ecx
+f010114f:	0f af 4f 08          	imul   0x8(%edi),%ecx
+f0101153:	2b 4f 78             	sub    0x78(%edi),%ecx
+f0101156:	29 d1                	sub    %edx,%ecx
+		cprintf("%-16s %6u %6u %8u %8u %10u %10u %8u\n", kc->kc_name,
+f0101158:	51                   	push   %ecx
+f0101159:	50                   	push   %eax
+f010115a:	ff 77 04             	push   0x4(%edi)
+f010115d:	ff 37                	push   (%edi)
+f010115f:	68 3c c9 10 f0       	push   $0xf010c93c
+f0101164:	e8 93 5e 00 00       	call   f0106ffc <cprintf>
+	for (kc = kmem_cache_list(); kc; kc = kc->kc_next) {
+f0101169:	8b 47 7c             	mov    0x7c(%edi),%eax
+f010116c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010116f:	83 c4 30             	add    $0x30,%esp
+f0101172:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0101176:	0f 84 62 ff ff ff    	je     f01010de <mon_kmemstat+0x1f>
+		for (cc = kc->kc_cpu; cc < kc->kc_cpu + ncpu; cc++) {
+f010117c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010117f:	83 e8 80             	sub    $0xffffff80,%eax
+f0101182:	8b 15 04 96 61 f0    	mov    0xf0619604,%edx
+f0101188:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+f010118b:	c1 e7 04             	shl    $0x4,%edi
+f010118e:	01 c7                	add    %eax,%edi
+		cached = allocs = frees = refills = 0;
+f0101190:	be 00 00 00 00       	mov    $0x0,%esi
+f0101195:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010119a:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010119f:	ba 00 00 00 00       	mov    $0x0,%edx
+		for (cc = kc->kc_cpu; cc < kc->kc_cpu + ncpu; cc++) {
+f01011a4:	eb 96                	jmp    f010113c <mon_kmemstat+0x7d>
+
+f01011a6 <mon_ksmstat>:
+
+int
+mon_ksmstat(int argc, char **argv, struct Trapframe *tf)
+{
+f01011a6:	55                   	push   %ebp
+f01011a7:	89 e5                	mov    %esp,%ebp
+f01011a9:	83 ec 18             	sub    $0x18,%esp
+	struct KsmStat st;
+
+	if (argc != 1) {
+f01011ac:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f01011b0:	74 17                	je     f01011c9 <mon_ksmstat+0x23>
+		cprintf("usage: ksmstat\n");
+f01011b2:	83 ec 0c             	sub    $0xc,%esp
+f01011b5:	68 5f c4 10 f0       	push   $0xf010c45f
+f01011ba:	e8 3d 5e 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f01011bf:	83 c4 10             	add    $0x10,%esp
+	ksm_stat(&st);
+	cprintf("%u pages hashed, %u mappings merged\n", st.scanned, st.merged);
+	cprintf("%u shared pages, %u pages (%uK) saved\n", st.pages, st.saved,
+		st.saved * (PGSIZE / 1024));
+	return 0;
+}
+f01011c2:	b8 00 00 00 00       	mov    $0x0,%eax
+f01011c7:	c9                   	leave
+f01011c8:	c3                   	ret
+	ksm_stat(&st);
+f01011c9:	83 ec 0c             	sub    $0xc,%esp
+f01011cc:	8d 45 e8             	lea    -0x18(%ebp),%eax
+f01011cf:	50                   	push   %eax
+f01011d0:	e8 e8 4c 00 00       	call   f0105ebd <ksm_stat>
+	cprintf("%u pages hashed, %u mappings merged\n", st.scanned, st.merged);
+f01011d5:	83 c4 0c             	add    $0xc,%esp
+f01011d8:	ff 75 ec             	push   -0x14(%ebp)
+f01011db:	ff 75 e8             	push   -0x18(%ebp)
+f01011de:	68 64 c9 10 f0       	push   $0xf010c964
+f01011e3:	e8 14 5e 00 00       	call   f0106ffc <cprintf>
+		st.saved * (PGSIZE / 1024));
+f01011e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+	cprintf("%u shared pages, %u pages (%uK) saved\n", st.pages, st.saved,
+f01011eb:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+f01011f2:	52                   	push   %edx
+f01011f3:	50                   	push   %eax
+f01011f4:	ff 75 f0             	push   -0x10(%ebp)
+f01011f7:	68 8c c9 10 f0       	push   $0xf010c98c
+f01011fc:	e8 fb 5d 00 00       	call   f0106ffc <cprintf>
+	return 0;
+f0101201:	83 c4 20             	add    $0x20,%esp
+f0101204:	eb bc                	jmp    f01011c2 <mon_ksmstat+0x1c>
+
+f0101206 <mon_showmappings>:
+{
+f0101206:	55                   	push   %ebp
+f0101207:	89 e5                	mov    %esp,%ebp
+f0101209:	57                   	push   %edi
+f010120a:	56                   	push   %esi
+f010120b:	53                   	push   %ebx
+f010120c:	83 ec 1c             	sub    $0x1c,%esp
+f010120f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (argc != 3) {
+f0101212:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+f0101216:	75 42                	jne    f010125a <mon_showmappings+0x54>
+		va_arg[i - 1] = (uintptr_t) strtol(argv[i], NULL, 0);
+f0101218:	83 ec 04             	sub    $0x4,%esp
+f010121b:	6a 00                	push   $0x0
+f010121d:	6a 00                	push   $0x0
+f010121f:	ff 76 04             	push   0x4(%esi)
+f0101222:	e8 da 94 00 00       	call   f010a701 <strtol>
+f0101227:	89 c3                	mov    %eax,%ebx
+f0101229:	83 c4 0c             	add    $0xc,%esp
+f010122c:	6a 00                	push   $0x0
+f010122e:	6a 00                	push   $0x0
+f0101230:	ff 76 08             	push   0x8(%esi)
+f0101233:	e8 c9 94 00 00       	call   f010a701 <strtol>
+f0101238:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (va_arg[0] > va_arg[1]) {
+f010123b:	83 c4 10             	add    $0x10,%esp
+f010123e:	39 d8                	cmp    %ebx,%eax
+f0101240:	72 35                	jb     f0101277 <mon_showmappings+0x71>
+f0101242:	0f 20 df             	mov    %cr3,%edi
+	if (PGNUM(pa) >= npages_lowmem)
+f0101245:	89 f8                	mov    %edi,%eax
+f0101247:	c1 e8 0c             	shr    $0xc,%eax
+f010124a:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0101250:	73 3b                	jae    f010128d <mon_showmappings+0x87>
+	return (void *)(pa + KERNBASE);
+f0101252:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+	for (va = va_arg[0]; va <= va_arg[1]; va += PGSIZE) {
+f0101258:	eb 6c                	jmp    f01012c6 <mon_showmappings+0xc0>
+		cprintf("usage: showmappings begin_va end_va\n");
+f010125a:	83 ec 0c             	sub    $0xc,%esp
+f010125d:	68 b4 c9 10 f0       	push   $0xf010c9b4
+f0101262:	e8 95 5d 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0101267:	83 c4 10             	add    $0x10,%esp
+}
+f010126a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010126f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101272:	5b                   	pop    %ebx
+f0101273:	5e                   	pop    %esi
+f0101274:	5f                   	pop    %edi
+f0101275:	5d                   	pop    %ebp
+f0101276:	c3                   	ret
+		cprintf("begin va (0x%x) is greater than end va (0x%x)\n", va_arg[0], va_arg[1]);
+f0101277:	83 ec 04             	sub    $0x4,%esp
+f010127a:	ff 75 e4             	push   -0x1c(%ebp)
+f010127d:	53                   	push   %ebx
+f010127e:	68 b8 c7 10 f0       	push   $0xf010c7b8
+f0101283:	e8 74 5d 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0101288:	83 c4 10             	add    $0x10,%esp
+f010128b:	eb dd                	jmp    f010126a <mon_showmappings+0x64>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010128d:	57                   	push   %edi
+f010128e:	68 1c c0 10 f0       	push   $0xf010c01c
+f0101293:	68 98 00 00 00       	push   $0x98
+f0101298:	68 23 c3 10 f0       	push   $0xf010c323
+f010129d:	e8 f6 ed ff ff       	call   f0100098 <_panic>
+			cprintf("va 0x%x is not mapped\n", va);
+f01012a2:	83 ec 08             	sub    $0x8,%esp
+f01012a5:	53                   	push   %ebx
+f01012a6:	68 6f c4 10 f0       	push   $0xf010c46f
+f01012ab:	e8 4c 5d 00 00       	call   f0106ffc <cprintf>
+f01012b0:	83 c4 10             	add    $0x10,%esp
+		if (va + PGSIZE < va)
+f01012b3:	81 fb ff ef ff ff    	cmp    $0xffffefff,%ebx
+f01012b9:	77 af                	ja     f010126a <mon_showmappings+0x64>
+	for (va = va_arg[0]; va <= va_arg[1]; va += PGSIZE) {
+f01012bb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01012c1:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+f01012c4:	72 a4                	jb     f010126a <mon_showmappings+0x64>
+		pte = pgdir_walk(pgdir, (void *) va, 0);
+f01012c6:	83 ec 04             	sub    $0x4,%esp
+f01012c9:	6a 00                	push   $0x0
+f01012cb:	53                   	push   %ebx
+f01012cc:	57                   	push   %edi
+f01012cd:	e8 8e 12 00 00       	call   f0102560 <pgdir_walk>
+f01012d2:	89 c6                	mov    %eax,%esi
+		if (!pte || !(*pte & PTE_P)) {
+f01012d4:	83 c4 10             	add    $0x10,%esp
+f01012d7:	85 c0                	test   %eax,%eax
+f01012d9:	74 c7                	je     f01012a2 <mon_showmappings+0x9c>
+f01012db:	8b 00                	mov    (%eax),%eax
+f01012dd:	a8 01                	test   $0x1,%al
+f01012df:	74 c1                	je     f01012a2 <mon_showmappings+0x9c>
+		} else if (*pte & PTE_PS) {
+f01012e1:	a8 80                	test   $0x80,%al
+f01012e3:	74 1a                	je     f01012ff <mon_showmappings+0xf9>
+			cprintf("va 0x%x 4MB ", va);
+f01012e5:	83 ec 08             	sub    $0x8,%esp
+f01012e8:	53                   	push   %ebx
+f01012e9:	68 86 c4 10 f0       	push   $0xf010c486
+f01012ee:	e8 09 5d 00 00       	call   f0106ffc <cprintf>
+			pte_show(*pte);
+f01012f3:	8b 06                	mov    (%esi),%eax
+f01012f5:	e8 d4 f5 ff ff       	call   f01008ce <pte_show>
+f01012fa:	83 c4 10             	add    $0x10,%esp
+f01012fd:	eb b4                	jmp    f01012b3 <mon_showmappings+0xad>
+			cprintf("va 0x%x ", va);
+f01012ff:	83 ec 08             	sub    $0x8,%esp
+f0101302:	53                   	push   %ebx
+f0101303:	68 93 c4 10 f0       	push   $0xf010c493
+f0101308:	e8 ef 5c 00 00       	call   f0106ffc <cprintf>
+			pte_show(*pte);
+f010130d:	8b 06                	mov    (%esi),%eax
+f010130f:	e8 ba f5 ff ff       	call   f01008ce <pte_show>
+f0101314:	83 c4 10             	add    $0x10,%esp
+f0101317:	eb 9a                	jmp    f01012b3 <mon_showmappings+0xad>
+
+f0101319 <mon_modpageperms>:
+{
+f0101319:	55                   	push   %ebp
+f010131a:	89 e5                	mov    %esp,%ebp
+f010131c:	57                   	push   %edi
+f010131d:	56                   	push   %esi
+f010131e:	53                   	push   %ebx
+f010131f:	83 ec 0c             	sub    $0xc,%esp
+f0101322:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (argc != 3) {
+f0101325:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+f0101329:	74 1d                	je     f0101348 <mon_modpageperms+0x2f>
+		cprintf("usage: modpageperms va perms\n");
+f010132b:	83 ec 0c             	sub    $0xc,%esp
+f010132e:	68 9c c4 10 f0       	push   $0xf010c49c
+f0101333:	e8 c4 5c 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0101338:	83 c4 10             	add    $0x10,%esp
+}
+f010133b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101343:	5b                   	pop    %ebx
+f0101344:	5e                   	pop    %esi
+f0101345:	5f                   	pop    %edi
+f0101346:	5d                   	pop    %ebp
+f0101347:	c3                   	ret
+	va_arg = (uintptr_t) strtol(argv[1], NULL, 0);
+f0101348:	83 ec 04             	sub    $0x4,%esp
+f010134b:	6a 00                	push   $0x0
+f010134d:	6a 00                	push   $0x0
+f010134f:	ff 73 04             	push   0x4(%ebx)
+f0101352:	e8 aa 93 00 00       	call   f010a701 <strtol>
+f0101357:	89 c7                	mov    %eax,%edi
+	perms = (uintptr_t) strtol(argv[2], NULL, 0);
+f0101359:	83 c4 0c             	add    $0xc,%esp
+f010135c:	6a 00                	push   $0x0
+f010135e:	6a 00                	push   $0x0
+f0101360:	ff 73 08             	push   0x8(%ebx)
+f0101363:	e8 99 93 00 00       	call   f010a701 <strtol>
+f0101368:	89 c3                	mov    %eax,%ebx
+	if (PTE_ADDR(perms)) {
+f010136a:	83 c4 10             	add    $0x10,%esp
+f010136d:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+f0101372:	77 64                	ja     f01013d8 <mon_modpageperms+0xbf>
+f0101374:	0f 20 d8             	mov    %cr3,%eax
+	if (PGNUM(pa) >= npages_lowmem)
+f0101377:	89 c2                	mov    %eax,%edx
+f0101379:	c1 ea 0c             	shr    $0xc,%edx
+f010137c:	3b 15 6c 89 61 f0    	cmp    0xf061896c,%edx
+f0101382:	73 6a                	jae    f01013ee <mon_modpageperms+0xd5>
+	pte = pgdir_walk(pgdir, (void *) va_arg, 0);
+f0101384:	83 ec 04             	sub    $0x4,%esp
+f0101387:	6a 00                	push   $0x0
+f0101389:	57                   	push   %edi
+	return (void *)(pa + KERNBASE);
+f010138a:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f010138f:	50                   	push   %eax
+f0101390:	e8 cb 11 00 00       	call   f0102560 <pgdir_walk>
+f0101395:	89 c6                	mov    %eax,%esi
+	if (!pte) {
+f0101397:	83 c4 10             	add    $0x10,%esp
+f010139a:	85 c0                	test   %eax,%eax
+f010139c:	74 65                	je     f0101403 <mon_modpageperms+0xea>
+	cprintf("va 0x%x existing pte ");
+f010139e:	83 ec 0c             	sub    $0xc,%esp
+f01013a1:	68 d3 c4 10 f0       	push   $0xf010c4d3
+f01013a6:	e8 51 5c 00 00       	call   f0106ffc <cprintf>
+	pte_show(*pte);
+f01013ab:	8b 06                	mov    (%esi),%eax
+f01013ad:	e8 1c f5 ff ff       	call   f01008ce <pte_show>
+	*pte = PTE_ADDR(*pte) | (*pte & PTE_PS) | perms;
+f01013b2:	8b 06                	mov    (%esi),%eax
+f01013b4:	25 80 f0 ff ff       	and    $0xfffff080,%eax
+f01013b9:	09 d8                	or     %ebx,%eax
+f01013bb:	89 06                	mov    %eax,(%esi)
+	cprintf("va 0x%x changed pte ");
+f01013bd:	c7 04 24 e9 c4 10 f0 	movl   $0xf010c4e9,(%esp)
+f01013c4:	e8 33 5c 00 00       	call   f0106ffc <cprintf>
+	pte_show(*pte);
+f01013c9:	8b 06                	mov    (%esi),%eax
+f01013cb:	e8 fe f4 ff ff       	call   f01008ce <pte_show>
+	return 0;
+f01013d0:	83 c4 10             	add    $0x10,%esp
+f01013d3:	e9 63 ff ff ff       	jmp    f010133b <mon_modpageperms+0x22>
+		cprintf("perms 0x%03x is invalid\n", perms);
+f01013d8:	83 ec 08             	sub    $0x8,%esp
+f01013db:	50                   	push   %eax
+f01013dc:	68 ba c4 10 f0       	push   $0xf010c4ba
+f01013e1:	e8 16 5c 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f01013e6:	83 c4 10             	add    $0x10,%esp
+f01013e9:	e9 4d ff ff ff       	jmp    f010133b <mon_modpageperms+0x22>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01013ee:	50                   	push   %eax
+f01013ef:	68 1c c0 10 f0       	push   $0xf010c01c
+f01013f4:	68 c0 00 00 00       	push   $0xc0
+f01013f9:	68 23 c3 10 f0       	push   $0xf010c323
+f01013fe:	e8 95 ec ff ff       	call   f0100098 <_panic>
+		cprintf("va 0x%x is not mapped\n", va_arg);
+f0101403:	83 ec 08             	sub    $0x8,%esp
+f0101406:	57                   	push   %edi
+f0101407:	68 6f c4 10 f0       	push   $0xf010c46f
+f010140c:	e8 eb 5b 00 00       	call   f0106ffc <cprintf>
+		return 0;
+f0101411:	83 c4 10             	add    $0x10,%esp
+f0101414:	e9 22 ff ff ff       	jmp    f010133b <mon_modpageperms+0x22>
+
+f0101419 <monitor>:
+	return 0;
+}
+
+void
+monitor(struct Trapframe *tf)
+{
+f0101419:	55                   	push   %ebp
+f010141a:	89 e5                	mov    %esp,%ebp
+f010141c:	57                   	push   %edi
+f010141d:	56                   	push   %esi
+f010141e:	53                   	push   %ebx
+f010141f:	83 ec 58             	sub    $0x58,%esp
+	char *buf;
+
+	cprintf("Welcome to the JOS kernel monitor!\n");
+f0101422:	68 dc c9 10 f0       	push   $0xf010c9dc
+f0101427:	e8 d0 5b 00 00       	call   f0106ffc <cprintf>
+	cprintf("Type 'help' for a list of commands.\n");
+f010142c:	c7 04 24 00 ca 10 f0 	movl   $0xf010ca00,(%esp)
+f0101433:	e8 c4 5b 00 00       	call   f0106ffc <cprintf>
+
+	if (tf != NULL)
+f0101438:	83 c4 10             	add    $0x10,%esp
+f010143b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f010143f:	74 57                	je     f0101498 <monitor+0x7f>
+		print_trapframe(tf);
+f0101441:	83 ec 0c             	sub    $0xc,%esp
+f0101444:	ff 75 08             	push   0x8(%ebp)
+f0101447:	e8 d7 5d 00 00       	call   f0107223 <print_trapframe>
+f010144c:	83 c4 10             	add    $0x10,%esp
+f010144f:	eb 47                	jmp    f0101498 <monitor+0x7f>
+		while (*buf && strchr(WHITESPACE, *buf))
+f0101451:	83 ec 08             	sub    $0x8,%esp
+f0101454:	0f be c0             	movsbl %al,%eax
+f0101457:	50                   	push   %eax
+f0101458:	68 02 c5 10 f0       	push   $0xf010c502
+f010145d:	e8 5d 91 00 00       	call   f010a5bf <strchr>
+f0101462:	83 c4 10             	add    $0x10,%esp
+f0101465:	85 c0                	test   %eax,%eax
+f0101467:	74 0a                	je     f0101473 <monitor+0x5a>
+			*buf++ = 0;
+f0101469:	c6 03 00             	movb   $0x0,(%ebx)
+f010146c:	89 f7                	mov    %esi,%edi
+f010146e:	8d 5b 01             	lea    0x1(%ebx),%ebx
+f0101471:	eb 6b                	jmp    f01014de <monitor+0xc5>
+		if (*buf == 0)
+f0101473:	80 3b 00             	cmpb   $0x0,(%ebx)
+f0101476:	74 73                	je     f01014eb <monitor+0xd2>
+		if (argc == MAXARGS-1) {
+f0101478:	83 fe 0f             	cmp    $0xf,%esi
+f010147b:	74 09                	je     f0101486 <monitor+0x6d>
+		argv[argc++] = buf;
+f010147d:	8d 7e 01             	lea    0x1(%esi),%edi
+f0101480:	89 5c b5 a8          	mov    %ebx,-0x58(%ebp,%esi,4)
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0101484:	eb 39                	jmp    f01014bf <monitor+0xa6>
+			cprintf("Too many arguments (max %d)\n", MAXARGS);
+f0101486:	83 ec 08             	sub    $0x8,%esp
+f0101489:	6a 10                	push   $0x10
+f010148b:	68 07 c5 10 f0       	push   $0xf010c507
+f0101490:	e8 67 5b 00 00       	call   f0106ffc <cprintf>
+			return 0;
+f0101495:	83 c4 10             	add    $0x10,%esp
+
+	while (1) {
+		buf = readline("K> ");
+f0101498:	83 ec 0c             	sub    $0xc,%esp
+f010149b:	68 fe c4 10 f0       	push   $0xf010c4fe
+f01014a0:	e8 df 8e 00 00       	call   f010a384 <readline>
+f01014a5:	89 c3                	mov    %eax,%ebx
+		if (buf != NULL)
+f01014a7:	83 c4 10             	add    $0x10,%esp
+f01014aa:	85 c0                	test   %eax,%eax
+f01014ac:	74 ea                	je     f0101498 <monitor+0x7f>
+	argv[argc] = 0;
+f01014ae:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+	argc = 0;
+f01014b5:	be 00 00 00 00       	mov    $0x0,%esi
+f01014ba:	eb 24                	jmp    f01014e0 <monitor+0xc7>
+			buf++;
+f01014bc:	83 c3 01             	add    $0x1,%ebx
+		while (*buf && !strchr(WHITESPACE, *buf))
+f01014bf:	0f b6 03             	movzbl (%ebx),%eax
+f01014c2:	84 c0                	test   %al,%al
+f01014c4:	74 18                	je     f01014de <monitor+0xc5>
+f01014c6:	83 ec 08             	sub    $0x8,%esp
+f01014c9:	0f be c0             	movsbl %al,%eax
+f01014cc:	50                   	push   %eax
+f01014cd:	68 02 c5 10 f0       	push   $0xf010c502
+f01014d2:	e8 e8 90 00 00       	call   f010a5bf <strchr>
+f01014d7:	83 c4 10             	add    $0x10,%esp
+f01014da:	85 c0                	test   %eax,%eax
+f01014dc:	74 de                	je     f01014bc <monitor+0xa3>
+			*buf++ = 0;
+f01014de:	89 fe                	mov    %edi,%esi
+		while (*buf && strchr(WHITESPACE, *buf))
+f01014e0:	0f b6 03             	movzbl (%ebx),%eax
+f01014e3:	84 c0                	test   %al,%al
+f01014e5:	0f 85 66 ff ff ff    	jne    f0101451 <monitor+0x38>
+	argv[argc] = 0;
+f01014eb:	c7 44 b5 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%esi,4)
+f01014f2:	00 
+	if (argc == 0)
+f01014f3:	85 f6                	test   %esi,%esi
+f01014f5:	74 a1                	je     f0101498 <monitor+0x7f>
+	for (i = 0; i < NCOMMANDS; i++) {
+f01014f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (strcmp(argv[0], commands[i].name) == 0)
+f01014fc:	83 ec 08             	sub    $0x8,%esp
+f01014ff:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0101502:	ff 34 85 40 cc 10 f0 	push   -0xfef33c0(,%eax,4)
+f0101509:	ff 75 a8             	push   -0x58(%ebp)
+f010150c:	e8 4d 90 00 00       	call   f010a55e <strcmp>
+f0101511:	83 c4 10             	add    $0x10,%esp
+f0101514:	85 c0                	test   %eax,%eax
+f0101516:	74 20                	je     f0101538 <monitor+0x11f>
+	for (i = 0; i < NCOMMANDS; i++) {
+f0101518:	83 c3 01             	add    $0x1,%ebx
+f010151b:	83 fb 0e             	cmp    $0xe,%ebx
+f010151e:	75 dc                	jne    f01014fc <monitor+0xe3>
+	cprintf("Unknown command '%s'\n", argv[0]);
+f0101520:	83 ec 08             	sub    $0x8,%esp
+f0101523:	ff 75 a8             	push   -0x58(%ebp)
+f0101526:	68 24 c5 10 f0       	push   $0xf010c524
+f010152b:	e8 cc 5a 00 00       	call   f0106ffc <cprintf>
+	return 0;
+f0101530:	83 c4 10             	add    $0x10,%esp
+f0101533:	e9 60 ff ff ff       	jmp    f0101498 <monitor+0x7f>
+			return commands[i].func(argc, argv, tf);
+f0101538:	83 ec 04             	sub    $0x4,%esp
+f010153b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f010153e:	ff 75 08             	push   0x8(%ebp)
+f0101541:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f0101544:	52                   	push   %edx
+f0101545:	56                   	push   %esi
+f0101546:	ff 14 85 48 cc 10 f0 	call   *-0xfef33b8(,%eax,4)
+			if (runcmd(buf, tf) < 0)
+f010154d:	83 c4 10             	add    $0x10,%esp
+f0101550:	85 c0                	test   %eax,%eax
+f0101552:	0f 89 40 ff ff ff    	jns    f0101498 <monitor+0x7f>
+				break;
+	}
+}
+f0101558:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010155b:	5b                   	pop    %ebx
+f010155c:	5e                   	pop    %esi
+f010155d:	5f                   	pop    %edi
+f010155e:	5d                   	pop    %ebp
+f010155f:	c3                   	ret
+
+f0101560 <buddy_push>:
+
+// Put block pp of the given order on its free list.
+static void
+buddy_push(struct PageInfo *pp, int order)
+{
+	pp->pp_order = order;
+f0101560:	88 50 06             	mov    %dl,0x6(%eax)
+	pp->pp_prev = NULL;
+f0101563:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+	pp->pp_link = free_area[order];
+f010156a:	8b 0c 95 60 18 61 f0 	mov    -0xf9ee7a0(,%edx,4),%ecx
+f0101571:	89 08                	mov    %ecx,(%eax)
+	if (free_area[order])
+f0101573:	85 c9                	test   %ecx,%ecx
+f0101575:	74 03                	je     f010157a <buddy_push+0x1a>
+		free_area[order]->pp_prev = pp;
+f0101577:	89 41 08             	mov    %eax,0x8(%ecx)
+	free_area[order] = pp;
+f010157a:	89 04 95 60 18 61 f0 	mov    %eax,-0xf9ee7a0(,%edx,4)
+	free_area_len[order]++;
+f0101581:	83 04 95 20 18 61 f0 	addl   $0x1,-0xf9ee7e0(,%edx,4)
+f0101588:	01 
+}
+f0101589:	c3                   	ret
+
+f010158a <buddy_remove>:
+
+// Take free block pp off its free list.
+static void
+buddy_remove(struct PageInfo *pp)
+{
+f010158a:	55                   	push   %ebp
+f010158b:	89 e5                	mov    %esp,%ebp
+f010158d:	53                   	push   %ebx
+	int order = pp->pp_order;
+f010158e:	0f be 48 06          	movsbl 0x6(%eax),%ecx
+
+	if (pp->pp_prev)
+f0101592:	8b 50 08             	mov    0x8(%eax),%edx
+f0101595:	85 d2                	test   %edx,%edx
+f0101597:	74 2e                	je     f01015c7 <buddy_remove+0x3d>
+		pp->pp_prev->pp_link = pp->pp_link;
+f0101599:	8b 18                	mov    (%eax),%ebx
+f010159b:	89 1a                	mov    %ebx,(%edx)
+	else
+		free_area[order] = pp->pp_link;
+	if (pp->pp_link)
+f010159d:	8b 10                	mov    (%eax),%edx
+f010159f:	85 d2                	test   %edx,%edx
+f01015a1:	74 06                	je     f01015a9 <buddy_remove+0x1f>
+		pp->pp_link->pp_prev = pp->pp_prev;
+f01015a3:	8b 58 08             	mov    0x8(%eax),%ebx
+f01015a6:	89 5a 08             	mov    %ebx,0x8(%edx)
+	free_area_len[order]--;
+f01015a9:	83 2c 8d 20 18 61 f0 	subl   $0x1,-0xf9ee7e0(,%ecx,4)
+f01015b0:	01 
+	pp->pp_order = -1;
+f01015b1:	c6 40 06 ff          	movb   $0xff,0x6(%eax)
+	pp->pp_link = pp->pp_prev = NULL;
+f01015b5:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+f01015bc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+f01015c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01015c5:	c9                   	leave
+f01015c6:	c3                   	ret
+		free_area[order] = pp->pp_link;
+f01015c7:	8b 10                	mov    (%eax),%edx
+f01015c9:	89 14 8d 60 18 61 f0 	mov    %edx,-0xf9ee7a0(,%ecx,4)
+f01015d0:	eb cb                	jmp    f010159d <buddy_remove+0x13>
+
+f01015d2 <buddy_alloc>:
+// Allocate a block of 2^order pages, splitting a larger block if there
+// is no free block of that order.  Returns NULL if there is no block
+// large enough.  Called with page_lock held.
+static struct PageInfo *
+buddy_alloc(int order)
+{
+f01015d2:	55                   	push   %ebp
+f01015d3:	89 e5                	mov    %esp,%ebp
+f01015d5:	57                   	push   %edi
+f01015d6:	56                   	push   %esi
+f01015d7:	53                   	push   %ebx
+f01015d8:	83 ec 0c             	sub    $0xc,%esp
+f01015db:	89 c6                	mov    %eax,%esi
+	struct PageInfo *pp;
+	int k;
+
+	for (k = order; k <= PAGE_MAX_ORDER && !free_area[k]; k++)
+f01015dd:	89 c3                	mov    %eax,%ebx
+f01015df:	eb 03                	jmp    f01015e4 <buddy_alloc+0x12>
+f01015e1:	83 c3 01             	add    $0x1,%ebx
+f01015e4:	83 fb 0a             	cmp    $0xa,%ebx
+f01015e7:	7f 33                	jg     f010161c <buddy_alloc+0x4a>
+f01015e9:	83 3c 9d 60 18 61 f0 	cmpl   $0x0,-0xf9ee7a0(,%ebx,4)
+f01015f0:	00 
+f01015f1:	74 ee                	je     f01015e1 <buddy_alloc+0xf>
+		;
+	if (k > PAGE_MAX_ORDER)
+		return NULL;
+
+	pp = free_area[k];
+f01015f3:	8b 3c 9d 60 18 61 f0 	mov    -0xf9ee7a0(,%ebx,4),%edi
+	buddy_remove(pp);
+f01015fa:	89 f8                	mov    %edi,%eax
+f01015fc:	e8 89 ff ff ff       	call   f010158a <buddy_remove>
+	// Give back the upper half of the block until it is small enough.
+	while (k > order) {
+f0101601:	39 f3                	cmp    %esi,%ebx
+f0101603:	7e 1c                	jle    f0101621 <buddy_alloc+0x4f>
+		k--;
+f0101605:	83 eb 01             	sub    $0x1,%ebx
+		buddy_push(pp + (1 << k), k);
+f0101608:	b8 0c 00 00 00       	mov    $0xc,%eax
+f010160d:	89 d9                	mov    %ebx,%ecx
+f010160f:	d3 e0                	shl    %cl,%eax
+f0101611:	01 f8                	add    %edi,%eax
+f0101613:	89 da                	mov    %ebx,%edx
+f0101615:	e8 46 ff ff ff       	call   f0101560 <buddy_push>
+f010161a:	eb e5                	jmp    f0101601 <buddy_alloc+0x2f>
+		return NULL;
+f010161c:	bf 00 00 00 00       	mov    $0x0,%edi
+	}
+	return pp;
+}
+f0101621:	89 f8                	mov    %edi,%eax
+f0101623:	83 c4 0c             	add    $0xc,%esp
+f0101626:	5b                   	pop    %ebx
+f0101627:	5e                   	pop    %esi
+f0101628:	5f                   	pop    %edi
+f0101629:	5d                   	pop    %ebp
+f010162a:	c3                   	ret
+
+f010162b <buddy_free>:
+
+// Free the block of 2^order pages starting at pp, merging it with its
+// buddy while that is free.  Called with page_lock held.
+static void
+buddy_free(struct PageInfo *pp, int order)
+{
+f010162b:	55                   	push   %ebp
+f010162c:	89 e5                	mov    %esp,%ebp
+f010162e:	57                   	push   %edi
+f010162f:	56                   	push   %esi
+f0101630:	53                   	push   %ebx
+f0101631:	83 ec 0c             	sub    $0xc,%esp
+f0101634:	89 d3                	mov    %edx,%ebx
+	size_t pfn = pp - pages, buddy;
+f0101636:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f010163c:	c1 f8 02             	sar    $0x2,%eax
+f010163f:	69 f8 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%edi
+
+	while (order < PAGE_MAX_ORDER) {
+f0101645:	eb 0c                	jmp    f0101653 <buddy_free+0x28>
+		buddy = pfn ^ (1 << order);
+		if (buddy >= npages_lowmem || pages[buddy].pp_order != order)
+			break;
+		buddy_remove(&pages[buddy]);
+f0101647:	e8 3e ff ff ff       	call   f010158a <buddy_remove>
+		pfn &= ~(1 << order);
+f010164c:	f7 d6                	not    %esi
+f010164e:	21 f7                	and    %esi,%edi
+		order++;
+f0101650:	83 c3 01             	add    $0x1,%ebx
+	while (order < PAGE_MAX_ORDER) {
+f0101653:	83 fb 09             	cmp    $0x9,%ebx
+f0101656:	7f 28                	jg     f0101680 <buddy_free+0x55>
+		buddy = pfn ^ (1 << order);
+f0101658:	be 01 00 00 00       	mov    $0x1,%esi
+f010165d:	89 d9                	mov    %ebx,%ecx
+f010165f:	d3 e6                	shl    %cl,%esi
+f0101661:	89 f0                	mov    %esi,%eax
+f0101663:	31 f8                	xor    %edi,%eax
+		if (buddy >= npages_lowmem || pages[buddy].pp_order != order)
+f0101665:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f010166b:	73 13                	jae    f0101680 <buddy_free+0x55>
+f010166d:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0101670:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0101675:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0101678:	0f be 50 06          	movsbl 0x6(%eax),%edx
+f010167c:	39 da                	cmp    %ebx,%edx
+f010167e:	74 c7                	je     f0101647 <buddy_free+0x1c>
+	}
+	buddy_push(&pages[pfn], order);
+f0101680:	8d 14 7f             	lea    (%edi,%edi,2),%edx
+f0101683:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0101688:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f010168b:	89 da                	mov    %ebx,%edx
+f010168d:	e8 ce fe ff ff       	call   f0101560 <buddy_push>
+}
+f0101692:	83 c4 0c             	add    $0xc,%esp
+f0101695:	5b                   	pop    %ebx
+f0101696:	5e                   	pop    %esi
+f0101697:	5f                   	pop    %edi
+f0101698:	5d                   	pop    %ebp
+f0101699:	c3                   	ret
+
+f010169a <boot_alloc>:
+	if (!nextfree) {
+f010169a:	83 3d 40 12 61 f0 00 	cmpl   $0x0,0xf0611240
+f01016a1:	74 43                	je     f01016e6 <boot_alloc+0x4c>
+	if (!n)
+f01016a3:	85 c0                	test   %eax,%eax
+f01016a5:	74 52                	je     f01016f9 <boot_alloc+0x5f>
+{
+f01016a7:	55                   	push   %ebp
+f01016a8:	89 e5                	mov    %esp,%ebp
+f01016aa:	53                   	push   %ebx
+f01016ab:	83 ec 04             	sub    $0x4,%esp
+	result = nextfree;
+f01016ae:	8b 15 40 12 61 f0    	mov    0xf0611240,%edx
+	nextfree = ROUNDUP(nextfree + n, PGSIZE);
+f01016b4:	8d 84 02 ff 0f 00 00 	lea    0xfff(%edx,%eax,1),%eax
+f01016bb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f01016c0:	a3 40 12 61 f0       	mov    %eax,0xf0611240
+	if ((uint32_t)kva < KERNBASE)
+f01016c5:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01016ca:	76 36                	jbe    f0101702 <boot_alloc+0x68>
+	if (PADDR(nextfree) > npages_lowmem * PGSIZE)
+f01016cc:	8b 0d 6c 89 61 f0    	mov    0xf061896c,%ecx
+f01016d2:	c1 e1 0c             	shl    $0xc,%ecx
+	return (physaddr_t)kva - KERNBASE;
+f01016d5:	8d 98 00 00 00 10    	lea    0x10000000(%eax),%ebx
+f01016db:	39 d9                	cmp    %ebx,%ecx
+f01016dd:	72 38                	jb     f0101717 <boot_alloc+0x7d>
+}
+f01016df:	89 d0                	mov    %edx,%eax
+f01016e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01016e4:	c9                   	leave
+f01016e5:	c3                   	ret
+		nextfree = ROUNDUP((char *) end, PGSIZE);
+f01016e6:	ba 0b b0 65 f0       	mov    $0xf065b00b,%edx
+f01016eb:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f01016f1:	89 15 40 12 61 f0    	mov    %edx,0xf0611240
+f01016f7:	eb aa                	jmp    f01016a3 <boot_alloc+0x9>
+		return nextfree;
+f01016f9:	8b 15 40 12 61 f0    	mov    0xf0611240,%edx
+}
+f01016ff:	89 d0                	mov    %edx,%eax
+f0101701:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101702:	50                   	push   %eax
+f0101703:	68 e8 cc 10 f0       	push   $0xf010cce8
+f0101708:	68 e4 00 00 00       	push   $0xe4
+f010170d:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101712:	e8 81 e9 ff ff       	call   f0100098 <_panic>
+		panic("run out of physical memory: nextfree 0x%8x", nextfree);
+f0101717:	50                   	push   %eax
+f0101718:	68 0c cd 10 f0       	push   $0xf010cd0c
+f010171d:	68 e5 00 00 00       	push   $0xe5
+f0101722:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101727:	e8 6c e9 ff ff       	call   f0100098 <_panic>
+
+f010172c <nvram_read>:
+{
+f010172c:	55                   	push   %ebp
+f010172d:	89 e5                	mov    %esp,%ebp
+f010172f:	56                   	push   %esi
+f0101730:	53                   	push   %ebx
+f0101731:	89 c3                	mov    %eax,%ebx
+	return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+f0101733:	83 ec 0c             	sub    $0xc,%esp
+f0101736:	50                   	push   %eax
+f0101737:	e8 1e 57 00 00       	call   f0106e5a <mc146818_read>
+f010173c:	89 c6                	mov    %eax,%esi
+f010173e:	83 c3 01             	add    $0x1,%ebx
+f0101741:	89 1c 24             	mov    %ebx,(%esp)
+f0101744:	e8 11 57 00 00       	call   f0106e5a <mc146818_read>
+f0101749:	c1 e0 08             	shl    $0x8,%eax
+f010174c:	09 f0                	or     %esi,%eax
+}
+f010174e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101751:	5b                   	pop    %ebx
+f0101752:	5e                   	pop    %esi
+f0101753:	5d                   	pop    %ebp
+f0101754:	c3                   	ret
+
+f0101755 <page_alloc_high>:
+}
+
+// Take a high page from page_high_list, without zeroing it.
+static struct PageInfo *
+page_alloc_high(void)
+{
+f0101755:	55                   	push   %ebp
+f0101756:	89 e5                	mov    %esp,%ebp
+f0101758:	53                   	push   %ebx
+f0101759:	83 ec 10             	sub    $0x10,%esp
+	struct PageInfo *pp;
+
+	spin_lock(&page_lock);
+f010175c:	68 e0 93 11 f0       	push   $0xf01193e0
+f0101761:	e8 6d 97 00 00       	call   f010aed3 <spin_lock>
+	if ((pp = page_high_list)) {
+f0101766:	8b 1d 00 18 61 f0    	mov    0xf0611800,%ebx
+f010176c:	83 c4 10             	add    $0x10,%esp
+f010176f:	85 db                	test   %ebx,%ebx
+f0101771:	74 2b                	je     f010179e <page_alloc_high+0x49>
+		page_high_list = pp->pp_link;
+f0101773:	8b 03                	mov    (%ebx),%eax
+f0101775:	a3 00 18 61 f0       	mov    %eax,0xf0611800
+		page_high_free--;
+f010177a:	83 2d fc 17 61 f0 01 	subl   $0x1,0xf06117fc
+	}
+	spin_unlock(&page_lock);
+f0101781:	83 ec 0c             	sub    $0xc,%esp
+f0101784:	68 e0 93 11 f0       	push   $0xf01193e0
+f0101789:	e8 61 98 00 00       	call   f010afef <spin_unlock>
+
+	if (pp)
+		pp->pp_link = NULL;
+f010178e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+f0101794:	83 c4 10             	add    $0x10,%esp
+	return pp;
+}
+f0101797:	89 d8                	mov    %ebx,%eax
+f0101799:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010179c:	c9                   	leave
+f010179d:	c3                   	ret
+	spin_unlock(&page_lock);
+f010179e:	83 ec 0c             	sub    $0xc,%esp
+f01017a1:	68 e0 93 11 f0       	push   $0xf01193e0
+f01017a6:	e8 44 98 00 00       	call   f010afef <spin_unlock>
+f01017ab:	83 c4 10             	add    $0x10,%esp
+f01017ae:	eb e7                	jmp    f0101797 <page_alloc_high+0x42>
+
+f01017b0 <page_zero_pop>:
+// Take a page from the pre-zeroed pool for page_alloc(alloc_flags).
+// If 'count', this is an ALLOC_ZERO allocation, and counts as a pool
+// hit or miss.
+static struct PageInfo *
+page_zero_pop(int alloc_flags, bool count)
+{
+f01017b0:	55                   	push   %ebp
+f01017b1:	89 e5                	mov    %esp,%ebp
+f01017b3:	56                   	push   %esi
+f01017b4:	53                   	push   %ebx
+f01017b5:	89 d6                	mov    %edx,%esi
+	struct PageInfo *pp;
+
+	if (page_zero_high && !(alloc_flags & ALLOC_HIGH))
+f01017b7:	80 3d e0 17 61 f0 00 	cmpb   $0x0,0xf06117e0
+f01017be:	74 04                	je     f01017c4 <page_zero_pop+0x14>
+f01017c0:	a8 02                	test   $0x2,%al
+f01017c2:	74 54                	je     f0101818 <page_zero_pop+0x68>
+		return NULL;
+
+	spin_lock(&page_zero_lock);
+f01017c4:	83 ec 0c             	sub    $0xc,%esp
+f01017c7:	68 80 93 11 f0       	push   $0xf0119380
+f01017cc:	e8 02 97 00 00       	call   f010aed3 <spin_lock>
+	pp = page_zero_list;
+f01017d1:	8b 1d f4 17 61 f0    	mov    0xf06117f4,%ebx
+	if (pp) {
+f01017d7:	83 c4 10             	add    $0x10,%esp
+f01017da:	85 db                	test   %ebx,%ebx
+f01017dc:	74 41                	je     f010181f <page_zero_pop+0x6f>
+		page_zero_list = pp->pp_link;
+f01017de:	8b 03                	mov    (%ebx),%eax
+f01017e0:	a3 f4 17 61 f0       	mov    %eax,0xf06117f4
+		page_zero.pages--;
+f01017e5:	83 2d e4 17 61 f0 01 	subl   $0x1,0xf06117e4
+	}
+	if (count && pp)
+f01017ec:	89 f0                	mov    %esi,%eax
+f01017ee:	84 c0                	test   %al,%al
+f01017f0:	74 4c                	je     f010183e <page_zero_pop+0x8e>
+		page_zero.hits++;
+f01017f2:	83 05 e8 17 61 f0 01 	addl   $0x1,0xf06117e8
+	else if (count)
+		page_zero.misses++;
+	spin_unlock(&page_zero_lock);
+f01017f9:	83 ec 0c             	sub    $0xc,%esp
+f01017fc:	68 80 93 11 f0       	push   $0xf0119380
+f0101801:	e8 e9 97 00 00       	call   f010afef <spin_unlock>
+f0101806:	83 c4 10             	add    $0x10,%esp
+
+	if (pp)
+		pp->pp_link = NULL;
+f0101809:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return pp;
+}
+f010180f:	89 d8                	mov    %ebx,%eax
+f0101811:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101814:	5b                   	pop    %ebx
+f0101815:	5e                   	pop    %esi
+f0101816:	5d                   	pop    %ebp
+f0101817:	c3                   	ret
+		return NULL;
+f0101818:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010181d:	eb f0                	jmp    f010180f <page_zero_pop+0x5f>
+	else if (count)
+f010181f:	89 f0                	mov    %esi,%eax
+f0101821:	84 c0                	test   %al,%al
+f0101823:	74 2b                	je     f0101850 <page_zero_pop+0xa0>
+		page_zero.misses++;
+f0101825:	83 05 ec 17 61 f0 01 	addl   $0x1,0xf06117ec
+	spin_unlock(&page_zero_lock);
+f010182c:	83 ec 0c             	sub    $0xc,%esp
+f010182f:	68 80 93 11 f0       	push   $0xf0119380
+f0101834:	e8 b6 97 00 00       	call   f010afef <spin_unlock>
+f0101839:	83 c4 10             	add    $0x10,%esp
+f010183c:	eb d1                	jmp    f010180f <page_zero_pop+0x5f>
+f010183e:	83 ec 0c             	sub    $0xc,%esp
+f0101841:	68 80 93 11 f0       	push   $0xf0119380
+f0101846:	e8 a4 97 00 00       	call   f010afef <spin_unlock>
+	if (pp)
+f010184b:	83 c4 10             	add    $0x10,%esp
+f010184e:	eb b9                	jmp    f0101809 <page_zero_pop+0x59>
+	spin_unlock(&page_zero_lock);
+f0101850:	83 ec 0c             	sub    $0xc,%esp
+f0101853:	68 80 93 11 f0       	push   $0xf0119380
+f0101858:	e8 92 97 00 00       	call   f010afef <spin_unlock>
+f010185d:	83 c4 10             	add    $0x10,%esp
+f0101860:	eb ad                	jmp    f010180f <page_zero_pop+0x5f>
+
+f0101862 <page_alloc_free>:
+{
+f0101862:	55                   	push   %ebp
+f0101863:	89 e5                	mov    %esp,%ebp
+f0101865:	56                   	push   %esi
+f0101866:	53                   	push   %ebx
+	struct CpuInfo *c = thiscpu;
+f0101867:	e8 d8 93 00 00       	call   f010ac44 <cpunum>
+	if (page_buddy_ready) {
+f010186c:	80 3d 04 18 61 f0 00 	cmpb   $0x0,0xf0611804
+f0101873:	0f 84 ab 00 00 00    	je     f0101924 <page_alloc_free+0xc2>
+f0101879:	89 c3                	mov    %eax,%ebx
+		if (!c->cpu_free_pages)
+f010187b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0101881:	8b b0 c8 90 61 f0    	mov    -0xf9e6f38(%eax),%esi
+f0101887:	85 f6                	test   %esi,%esi
+f0101889:	74 2a                	je     f01018b5 <page_alloc_free+0x53>
+			c->cpu_free_pages = pp->pp_link;
+f010188b:	8b 06                	mov    (%esi),%eax
+f010188d:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+f0101893:	89 83 c8 90 61 f0    	mov    %eax,-0xf9e6f38(%ebx)
+f0101899:	81 c3 20 90 61 f0    	add    $0xf0619020,%ebx
+			c->cpu_nfree_pages--;
+f010189f:	83 ab ac 00 00 00 01 	subl   $0x1,0xac(%ebx)
+		pp->pp_link = NULL;
+f01018a6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+f01018ac:	89 f0                	mov    %esi,%eax
+f01018ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01018b1:	5b                   	pop    %ebx
+f01018b2:	5e                   	pop    %esi
+f01018b3:	5d                   	pop    %ebp
+f01018b4:	c3                   	ret
+	spin_lock(&page_lock);
+f01018b5:	83 ec 0c             	sub    $0xc,%esp
+f01018b8:	68 e0 93 11 f0       	push   $0xf01193e0
+f01018bd:	e8 11 96 00 00       	call   f010aed3 <spin_lock>
+	while (c->cpu_nfree_pages < PAGE_CACHE_BATCH && (pp = buddy_alloc(0))) {
+f01018c2:	83 c4 10             	add    $0x10,%esp
+f01018c5:	69 f3 bc 00 00 00    	imul   $0xbc,%ebx,%esi
+f01018cb:	81 c6 20 90 61 f0    	add    $0xf0619020,%esi
+f01018d1:	eb 15                	jmp    f01018e8 <page_alloc_free+0x86>
+		pp->pp_link = c->cpu_free_pages;
+f01018d3:	8b 96 a8 00 00 00    	mov    0xa8(%esi),%edx
+f01018d9:	89 10                	mov    %edx,(%eax)
+		c->cpu_free_pages = pp;
+f01018db:	89 86 a8 00 00 00    	mov    %eax,0xa8(%esi)
+		c->cpu_nfree_pages++;
+f01018e1:	83 86 ac 00 00 00 01 	addl   $0x1,0xac(%esi)
+	while (c->cpu_nfree_pages < PAGE_CACHE_BATCH && (pp = buddy_alloc(0))) {
+f01018e8:	83 be ac 00 00 00 1f 	cmpl   $0x1f,0xac(%esi)
+f01018ef:	7f 0e                	jg     f01018ff <page_alloc_free+0x9d>
+f01018f1:	b8 00 00 00 00       	mov    $0x0,%eax
+f01018f6:	e8 d7 fc ff ff       	call   f01015d2 <buddy_alloc>
+f01018fb:	85 c0                	test   %eax,%eax
+f01018fd:	75 d4                	jne    f01018d3 <page_alloc_free+0x71>
+	spin_unlock(&page_lock);
+f01018ff:	83 ec 0c             	sub    $0xc,%esp
+f0101902:	68 e0 93 11 f0       	push   $0xf01193e0
+f0101907:	e8 e3 96 00 00       	call   f010afef <spin_unlock>
+		pp = c->cpu_free_pages;
+f010190c:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+f0101912:	8b b0 c8 90 61 f0    	mov    -0xf9e6f38(%eax),%esi
+		if (pp) {
+f0101918:	83 c4 10             	add    $0x10,%esp
+f010191b:	85 f6                	test   %esi,%esi
+f010191d:	74 8d                	je     f01018ac <page_alloc_free+0x4a>
+f010191f:	e9 67 ff ff ff       	jmp    f010188b <page_alloc_free+0x29>
+		spin_lock(&page_lock);
+f0101924:	83 ec 0c             	sub    $0xc,%esp
+f0101927:	68 e0 93 11 f0       	push   $0xf01193e0
+f010192c:	e8 a2 95 00 00       	call   f010aed3 <spin_lock>
+		pp = page_free_list;
+f0101931:	8b 35 8c 18 61 f0    	mov    0xf061188c,%esi
+		if (pp)
+f0101937:	83 c4 10             	add    $0x10,%esp
+f010193a:	85 f6                	test   %esi,%esi
+f010193c:	74 1c                	je     f010195a <page_alloc_free+0xf8>
+			page_free_list = pp->pp_link;
+f010193e:	8b 06                	mov    (%esi),%eax
+f0101940:	a3 8c 18 61 f0       	mov    %eax,0xf061188c
+		spin_unlock(&page_lock);
+f0101945:	83 ec 0c             	sub    $0xc,%esp
+f0101948:	68 e0 93 11 f0       	push   $0xf01193e0
+f010194d:	e8 9d 96 00 00       	call   f010afef <spin_unlock>
+f0101952:	83 c4 10             	add    $0x10,%esp
+f0101955:	e9 4c ff ff ff       	jmp    f01018a6 <page_alloc_free+0x44>
+f010195a:	83 ec 0c             	sub    $0xc,%esp
+f010195d:	68 e0 93 11 f0       	push   $0xf01193e0
+f0101962:	e8 88 96 00 00       	call   f010afef <spin_unlock>
+f0101967:	83 c4 10             	add    $0x10,%esp
+f010196a:	e9 3d ff ff ff       	jmp    f01018ac <page_alloc_free+0x4a>
+
+f010196f <check_va2pa>:
+static physaddr_t
+check_va2pa(pde_t *pgdir, uintptr_t va)
+{
+	pte_t *p;
+
+	pgdir = &pgdir[PDX(va)];
+f010196f:	89 d1                	mov    %edx,%ecx
+f0101971:	c1 e9 16             	shr    $0x16,%ecx
+	if (!(*pgdir & PTE_P))
+f0101974:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+f0101977:	a8 01                	test   $0x1,%al
+f0101979:	74 63                	je     f01019de <check_va2pa+0x6f>
+		return ~0;
+	if (*pgdir & PTE_PS)
+f010197b:	a8 80                	test   $0x80,%al
+f010197d:	74 0e                	je     f010198d <check_va2pa+0x1e>
+		return PTE_ADDR(*pgdir) + (PTX(va) << PTXSHIFT);
+f010197f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101984:	81 e2 00 f0 3f 00    	and    $0x3ff000,%edx
+f010198a:	01 d0                	add    %edx,%eax
+f010198c:	c3                   	ret
+	p = (pte_t*) KADDR(PTE_ADDR(*pgdir));
+f010198d:	89 c1                	mov    %eax,%ecx
+f010198f:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	if (PGNUM(pa) >= npages_lowmem)
+f0101995:	c1 e8 0c             	shr    $0xc,%eax
+f0101998:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f010199e:	73 23                	jae    f01019c3 <check_va2pa+0x54>
+	if (!(p[PTX(va)] & PTE_P))
+f01019a0:	c1 ea 0c             	shr    $0xc,%edx
+f01019a3:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f01019a9:	8b 94 91 00 00 00 f0 	mov    -0x10000000(%ecx,%edx,4),%edx
+		return ~0;
+	return PTE_ADDR(p[PTX(va)]);
+f01019b0:	89 d0                	mov    %edx,%eax
+f01019b2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f01019b7:	f6 c2 01             	test   $0x1,%dl
+f01019ba:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f01019bf:	0f 44 c2             	cmove  %edx,%eax
+f01019c2:	c3                   	ret
+{
+f01019c3:	55                   	push   %ebp
+f01019c4:	89 e5                	mov    %esp,%ebp
+f01019c6:	83 ec 08             	sub    $0x8,%esp
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01019c9:	51                   	push   %ecx
+f01019ca:	68 1c c0 10 f0       	push   $0xf010c01c
+f01019cf:	68 68 07 00 00       	push   $0x768
+f01019d4:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01019d9:	e8 ba e6 ff ff       	call   f0100098 <_panic>
+		return ~0;
+f01019de:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f01019e3:	c3                   	ret
+
+f01019e4 <check_page_free_list>:
+{
+f01019e4:	55                   	push   %ebp
+f01019e5:	89 e5                	mov    %esp,%ebp
+f01019e7:	57                   	push   %edi
+f01019e8:	56                   	push   %esi
+f01019e9:	53                   	push   %ebx
+f01019ea:	83 ec 2c             	sub    $0x2c,%esp
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f01019ed:	84 c0                	test   %al,%al
+f01019ef:	0f 85 a8 02 00 00    	jne    f0101c9d <check_page_free_list+0x2b9>
+	if (!page_free_list)
+f01019f5:	83 3d 8c 18 61 f0 00 	cmpl   $0x0,0xf061188c
+f01019fc:	74 0a                	je     f0101a08 <check_page_free_list+0x24>
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f01019fe:	be 00 04 00 00       	mov    $0x400,%esi
+f0101a03:	e9 f9 02 00 00       	jmp    f0101d01 <check_page_free_list+0x31d>
+		panic("'page_free_list' is a null pointer!");
+f0101a08:	83 ec 04             	sub    $0x4,%esp
+f0101a0b:	68 38 cd 10 f0       	push   $0xf010cd38
+f0101a10:	68 9b 06 00 00       	push   $0x69b
+f0101a15:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101a1a:	e8 79 e6 ff ff       	call   f0100098 <_panic>
+f0101a1f:	50                   	push   %eax
+f0101a20:	68 1c c0 10 f0       	push   $0xf010c01c
+f0101a25:	6a 7d                	push   $0x7d
+f0101a27:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0101a2c:	e8 67 e6 ff ff       	call   f0100098 <_panic>
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f0101a31:	8b 1b                	mov    (%ebx),%ebx
+f0101a33:	85 db                	test   %ebx,%ebx
+f0101a35:	74 47                	je     f0101a7e <check_page_free_list+0x9a>
+void	user_mem_assert_lock(struct Env *env, const void *va, size_t len, int perm);
+
+static inline physaddr_t
+page2pa(struct PageInfo *pp)
+{
+	return (pp - pages) << PGSHIFT;
+f0101a37:	89 d8                	mov    %ebx,%eax
+f0101a39:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0101a3f:	c1 f8 02             	sar    $0x2,%eax
+f0101a42:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0101a48:	c1 e0 0c             	shl    $0xc,%eax
+		if (PDX(page2pa(pp)) < pdx_limit)
+f0101a4b:	89 c2                	mov    %eax,%edx
+f0101a4d:	c1 ea 16             	shr    $0x16,%edx
+f0101a50:	39 f2                	cmp    %esi,%edx
+f0101a52:	73 dd                	jae    f0101a31 <check_page_free_list+0x4d>
+	if (PGNUM(pa) >= npages_lowmem)
+f0101a54:	89 c2                	mov    %eax,%edx
+f0101a56:	c1 ea 0c             	shr    $0xc,%edx
+f0101a59:	3b 15 6c 89 61 f0    	cmp    0xf061896c,%edx
+f0101a5f:	73 be                	jae    f0101a1f <check_page_free_list+0x3b>
+			memset(page2kva(pp), 0x97, 128);
+f0101a61:	83 ec 04             	sub    $0x4,%esp
+f0101a64:	68 80 00 00 00       	push   $0x80
+f0101a69:	68 97 00 00 00       	push   $0x97
+	return (void *)(pa + KERNBASE);
+f0101a6e:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0101a73:	50                   	push   %eax
+f0101a74:	e8 85 8b 00 00       	call   f010a5fe <memset>
+f0101a79:	83 c4 10             	add    $0x10,%esp
+f0101a7c:	eb b3                	jmp    f0101a31 <check_page_free_list+0x4d>
+	first_free_page = (char *) boot_alloc(0);
+f0101a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101a83:	e8 12 fc ff ff       	call   f010169a <boot_alloc>
+f0101a88:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0101a8b:	8b 1d 8c 18 61 f0    	mov    0xf061188c,%ebx
+		assert(pp >= pages);
+f0101a91:	8b 3d 80 89 61 f0    	mov    0xf0618980,%edi
+		assert(pp < pages + npages);
+f0101a97:	a1 78 89 61 f0       	mov    0xf0618978,%eax
+f0101a9c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0101a9f:	8d 34 87             	lea    (%edi,%eax,4),%esi
+	if (PGNUM(pa) >= npages_lowmem)
+f0101aa2:	a1 6c 89 61 f0       	mov    0xf061896c,%eax
+f0101aa7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	int nfree_basemem = 0, nfree_extmem = 0;
+f0101aaa:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+f0101ab1:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0101ab8:	e9 ff 00 00 00       	jmp    f0101bbc <check_page_free_list+0x1d8>
+		assert(pp >= pages);
+f0101abd:	68 01 d8 10 f0       	push   $0xf010d801
+f0101ac2:	68 0d d8 10 f0       	push   $0xf010d80d
+f0101ac7:	68 b5 06 00 00       	push   $0x6b5
+f0101acc:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101ad1:	e8 c2 e5 ff ff       	call   f0100098 <_panic>
+		assert(pp < pages + npages);
+f0101ad6:	68 22 d8 10 f0       	push   $0xf010d822
+f0101adb:	68 0d d8 10 f0       	push   $0xf010d80d
+f0101ae0:	68 b6 06 00 00       	push   $0x6b6
+f0101ae5:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101aea:	e8 a9 e5 ff ff       	call   f0100098 <_panic>
+		assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
+f0101aef:	68 5c cd 10 f0       	push   $0xf010cd5c
+f0101af4:	68 0d d8 10 f0       	push   $0xf010d80d
+f0101af9:	68 b7 06 00 00       	push   $0x6b7
+f0101afe:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101b03:	e8 90 e5 ff ff       	call   f0100098 <_panic>
+		assert(page2pa(pp) != 0);
+f0101b08:	68 36 d8 10 f0       	push   $0xf010d836
+f0101b0d:	68 0d d8 10 f0       	push   $0xf010d80d
+f0101b12:	68 ba 06 00 00       	push   $0x6ba
+f0101b17:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101b1c:	e8 77 e5 ff ff       	call   f0100098 <_panic>
+		assert(page2pa(pp) != IOPHYSMEM);
+f0101b21:	68 47 d8 10 f0       	push   $0xf010d847
+f0101b26:	68 0d d8 10 f0       	push   $0xf010d80d
+f0101b2b:	68 bb 06 00 00       	push   $0x6bb
+f0101b30:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101b35:	e8 5e e5 ff ff       	call   f0100098 <_panic>
+		assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f0101b3a:	68 90 cd 10 f0       	push   $0xf010cd90
+f0101b3f:	68 0d d8 10 f0       	push   $0xf010d80d
+f0101b44:	68 bc 06 00 00       	push   $0x6bc
+f0101b49:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101b4e:	e8 45 e5 ff ff       	call   f0100098 <_panic>
+		assert(page2pa(pp) != EXTPHYSMEM);
+f0101b53:	68 60 d8 10 f0       	push   $0xf010d860
+f0101b58:	68 0d d8 10 f0       	push   $0xf010d80d
+f0101b5d:	68 bd 06 00 00       	push   $0x6bd
+f0101b62:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101b67:	e8 2c e5 ff ff       	call   f0100098 <_panic>
+f0101b6c:	89 c8                	mov    %ecx,%eax
+f0101b6e:	c1 e8 0c             	shr    $0xc,%eax
+f0101b71:	8b 55 c8             	mov    -0x38(%ebp),%edx
+f0101b74:	39 d0                	cmp    %edx,%eax
+f0101b76:	73 13                	jae    f0101b8b <check_page_free_list+0x1a7>
+	return (void *)(pa + KERNBASE);
+f0101b78:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f0101b7e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0101b81:	39 c1                	cmp    %eax,%ecx
+f0101b83:	72 18                	jb     f0101b9d <check_page_free_list+0x1b9>
+			++nfree_extmem;
+f0101b85:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+f0101b89:	eb 2f                	jmp    f0101bba <check_page_free_list+0x1d6>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101b8b:	51                   	push   %ecx
+f0101b8c:	68 1c c0 10 f0       	push   $0xf010c01c
+f0101b91:	6a 7d                	push   $0x7d
+f0101b93:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0101b98:	e8 fb e4 ff ff       	call   f0100098 <_panic>
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f0101b9d:	68 b4 cd 10 f0       	push   $0xf010cdb4
+f0101ba2:	68 0d d8 10 f0       	push   $0xf010d80d
+f0101ba7:	68 be 06 00 00       	push   $0x6be
+f0101bac:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101bb1:	e8 e2 e4 ff ff       	call   f0100098 <_panic>
+			++nfree_basemem;
+f0101bb6:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0101bba:	8b 1b                	mov    (%ebx),%ebx
+f0101bbc:	85 db                	test   %ebx,%ebx
+f0101bbe:	0f 84 93 00 00 00    	je     f0101c57 <check_page_free_list+0x273>
+		assert(pp >= pages);
+f0101bc4:	39 fb                	cmp    %edi,%ebx
+f0101bc6:	0f 82 f1 fe ff ff    	jb     f0101abd <check_page_free_list+0xd9>
+		assert(pp < pages + npages);
+f0101bcc:	39 f3                	cmp    %esi,%ebx
+f0101bce:	0f 83 02 ff ff ff    	jae    f0101ad6 <check_page_free_list+0xf2>
+		assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
+f0101bd4:	89 d9                	mov    %ebx,%ecx
+f0101bd6:	29 f9                	sub    %edi,%ecx
+f0101bd8:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+f0101bdd:	f7 e1                	mul    %ecx
+f0101bdf:	c1 ea 03             	shr    $0x3,%edx
+f0101be2:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0101be5:	c1 e0 02             	shl    $0x2,%eax
+f0101be8:	39 c1                	cmp    %eax,%ecx
+f0101bea:	0f 85 ff fe ff ff    	jne    f0101aef <check_page_free_list+0x10b>
+	return (pp - pages) << PGSHIFT;
+f0101bf0:	c1 f9 02             	sar    $0x2,%ecx
+f0101bf3:	69 c9 ab aa aa aa    	imul   $0xaaaaaaab,%ecx,%ecx
+		assert(page2pa(pp) != 0);
+f0101bf9:	c1 e1 0c             	shl    $0xc,%ecx
+f0101bfc:	0f 84 06 ff ff ff    	je     f0101b08 <check_page_free_list+0x124>
+		assert(page2pa(pp) != IOPHYSMEM);
+f0101c02:	81 f9 00 00 0a 00    	cmp    $0xa0000,%ecx
+f0101c08:	0f 84 13 ff ff ff    	je     f0101b21 <check_page_free_list+0x13d>
+		assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f0101c0e:	81 f9 00 f0 0f 00    	cmp    $0xff000,%ecx
+f0101c14:	0f 84 20 ff ff ff    	je     f0101b3a <check_page_free_list+0x156>
+		assert(page2pa(pp) != EXTPHYSMEM);
+f0101c1a:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+f0101c20:	0f 84 2d ff ff ff    	je     f0101b53 <check_page_free_list+0x16f>
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f0101c26:	81 f9 ff ff 0f 00    	cmp    $0xfffff,%ecx
+f0101c2c:	0f 87 3a ff ff ff    	ja     f0101b6c <check_page_free_list+0x188>
+		assert(page2pa(pp) != MPENTRY_PADDR);
+f0101c32:	81 f9 00 70 00 00    	cmp    $0x7000,%ecx
+f0101c38:	0f 85 78 ff ff ff    	jne    f0101bb6 <check_page_free_list+0x1d2>
+f0101c3e:	68 7a d8 10 f0       	push   $0xf010d87a
+f0101c43:	68 0d d8 10 f0       	push   $0xf010d80d
+f0101c48:	68 c0 06 00 00       	push   $0x6c0
+f0101c4d:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101c52:	e8 41 e4 ff ff       	call   f0100098 <_panic>
+	assert(nfree_basemem > 0);
+f0101c57:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+f0101c5b:	7e 0e                	jle    f0101c6b <check_page_free_list+0x287>
+	assert(nfree_extmem > 0);
+f0101c5d:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+f0101c61:	7e 21                	jle    f0101c84 <check_page_free_list+0x2a0>
+}
+f0101c63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101c66:	5b                   	pop    %ebx
+f0101c67:	5e                   	pop    %esi
+f0101c68:	5f                   	pop    %edi
+f0101c69:	5d                   	pop    %ebp
+f0101c6a:	c3                   	ret
+	assert(nfree_basemem > 0);
+f0101c6b:	68 97 d8 10 f0       	push   $0xf010d897
+f0101c70:	68 0d d8 10 f0       	push   $0xf010d80d
+f0101c75:	68 c8 06 00 00       	push   $0x6c8
+f0101c7a:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101c7f:	e8 14 e4 ff ff       	call   f0100098 <_panic>
+	assert(nfree_extmem > 0);
+f0101c84:	68 a9 d8 10 f0       	push   $0xf010d8a9
+f0101c89:	68 0d d8 10 f0       	push   $0xf010d80d
+f0101c8e:	68 c9 06 00 00       	push   $0x6c9
+f0101c93:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101c98:	e8 fb e3 ff ff       	call   f0100098 <_panic>
+	if (!page_free_list)
+f0101c9d:	a1 8c 18 61 f0       	mov    0xf061188c,%eax
+f0101ca2:	85 c0                	test   %eax,%eax
+f0101ca4:	0f 84 5e fd ff ff    	je     f0101a08 <check_page_free_list+0x24>
+		struct PageInfo **tp[2] = { &pp1, &pp2 };
+f0101caa:	8d 55 d8             	lea    -0x28(%ebp),%edx
+f0101cad:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f0101cb0:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0101cb3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0101cb6:	89 c2                	mov    %eax,%edx
+f0101cb8:	2b 15 80 89 61 f0    	sub    0xf0618980,%edx
+f0101cbe:	c1 fa 02             	sar    $0x2,%edx
+f0101cc1:	69 d2 ab aa aa aa    	imul   $0xaaaaaaab,%edx,%edx
+			int pagetype = PDX(page2pa(pp)) >= pdx_limit;
+f0101cc7:	f7 c2 00 fc 0f 00    	test   $0xffc00,%edx
+f0101ccd:	0f 95 c2             	setne  %dl
+f0101cd0:	0f b6 d2             	movzbl %dl,%edx
+			*tp[pagetype] = pp;
+f0101cd3:	8b 4c 95 e0          	mov    -0x20(%ebp,%edx,4),%ecx
+f0101cd7:	89 01                	mov    %eax,(%ecx)
+			tp[pagetype] = &pp->pp_link;
+f0101cd9:	89 44 95 e0          	mov    %eax,-0x20(%ebp,%edx,4)
+		for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0101cdd:	8b 00                	mov    (%eax),%eax
+f0101cdf:	85 c0                	test   %eax,%eax
+f0101ce1:	75 d3                	jne    f0101cb6 <check_page_free_list+0x2d2>
+		*tp[1] = 0;
+f0101ce3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101ce6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		*tp[0] = pp2;
+f0101cec:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0101cef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101cf2:	89 10                	mov    %edx,(%eax)
+		page_free_list = pp1;
+f0101cf4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0101cf7:	a3 8c 18 61 f0       	mov    %eax,0xf061188c
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f0101cfc:	be 01 00 00 00       	mov    $0x1,%esi
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f0101d01:	8b 1d 8c 18 61 f0    	mov    0xf061188c,%ebx
+f0101d07:	e9 27 fd ff ff       	jmp    f0101a33 <check_page_free_list+0x4f>
+
+f0101d0c <mem_init_percpu>:
+	__asm __volatile("movl %%cr4,%0" : "=r" (cr4));
+f0101d0c:	0f 20 e0             	mov    %cr4,%eax
+	lcr4(rcr4() | kern_cr4);
+f0101d0f:	0b 05 94 18 61 f0    	or     0xf0611894,%eax
+	__asm __volatile("movl %0,%%cr4" : : "r" (val));
+f0101d15:	0f 22 e0             	mov    %eax,%cr4
+	lcr3(PADDR(kern_pgdir));
+f0101d18:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0101d1d:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101d22:	76 09                	jbe    f0101d2d <mem_init_percpu+0x21>
+	return (physaddr_t)kva - KERNBASE;
+f0101d24:	05 00 00 00 10       	add    $0x10000000,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0101d29:	0f 22 d8             	mov    %eax,%cr3
+f0101d2c:	c3                   	ret
+{
+f0101d2d:	55                   	push   %ebp
+f0101d2e:	89 e5                	mov    %esp,%ebp
+f0101d30:	83 ec 08             	sub    $0x8,%esp
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101d33:	50                   	push   %eax
+f0101d34:	68 e8 cc 10 f0       	push   $0xf010cce8
+f0101d39:	68 9d 01 00 00       	push   $0x19d
+f0101d3e:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101d43:	e8 50 e3 ff ff       	call   f0100098 <_panic>
+
+f0101d48 <page_init>:
+{
+f0101d48:	55                   	push   %ebp
+f0101d49:	89 e5                	mov    %esp,%ebp
+f0101d4b:	57                   	push   %edi
+f0101d4c:	56                   	push   %esi
+f0101d4d:	53                   	push   %ebx
+f0101d4e:	83 ec 1c             	sub    $0x1c,%esp
+	nextfree = (uintptr_t) boot_alloc(0);
+f0101d51:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101d56:	e8 3f f9 ff ff       	call   f010169a <boot_alloc>
+f0101d5b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	for (i = 0; i < npages_lowmem; i++) {
+f0101d5e:	a1 8c 18 61 f0       	mov    0xf061188c,%eax
+f0101d63:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0101d66:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0101d6b:	c6 45 df 00          	movb   $0x0,-0x21(%ebp)
+f0101d6f:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101d74:	eb 44                	jmp    f0101dba <page_init+0x72>
+f0101d76:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101d79:	80 7d df 00          	cmpb   $0x0,-0x21(%ebp)
+f0101d7d:	74 09                	je     f0101d88 <page_init+0x40>
+f0101d7f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0101d82:	89 3d 8c 18 61 f0    	mov    %edi,0xf061188c
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101d88:	50                   	push   %eax
+f0101d89:	68 1c c0 10 f0       	push   $0xf010c01c
+f0101d8e:	6a 7d                	push   $0x7d
+f0101d90:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0101d95:	e8 fe e2 ff ff       	call   f0100098 <_panic>
+		pages[i].pp_ref = 0;
+f0101d9a:	66 c7 46 04 00 00    	movw   $0x0,0x4(%esi)
+		pages[i].pp_link = page_free_list;
+f0101da0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101da3:	89 06                	mov    %eax,(%esi)
+		page_free_list = &pages[i];
+f0101da5:	89 c8                	mov    %ecx,%eax
+f0101da7:	03 05 80 89 61 f0    	add    0xf0618980,%eax
+f0101dad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0101db0:	c6 45 df 01          	movb   $0x1,-0x21(%ebp)
+	for (i = 0; i < npages_lowmem; i++) {
+f0101db4:	83 c2 01             	add    $0x1,%edx
+f0101db7:	83 c1 0c             	add    $0xc,%ecx
+f0101dba:	8b 1d 6c 89 61 f0    	mov    0xf061896c,%ebx
+f0101dc0:	39 da                	cmp    %ebx,%edx
+f0101dc2:	73 7b                	jae    f0101e3f <page_init+0xf7>
+		pages[i].pp_order = -1;
+f0101dc4:	89 ce                	mov    %ecx,%esi
+f0101dc6:	03 35 80 89 61 f0    	add    0xf0618980,%esi
+f0101dcc:	c6 46 06 ff          	movb   $0xff,0x6(%esi)
+		if (!i) continue;
+f0101dd0:	85 d2                	test   %edx,%edx
+f0101dd2:	74 e0                	je     f0101db4 <page_init+0x6c>
+	return (pp - pages) << PGSHIFT;
+f0101dd4:	89 c8                	mov    %ecx,%eax
+f0101dd6:	c1 f8 02             	sar    $0x2,%eax
+f0101dd9:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0101ddf:	c1 e0 0c             	shl    $0xc,%eax
+f0101de2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		if (pa == MPENTRY_PADDR)
+f0101de5:	3d 00 70 00 00       	cmp    $0x7000,%eax
+f0101dea:	74 c8                	je     f0101db4 <page_init+0x6c>
+		if (pa >= IOPHYSMEM && pa < EXTPHYSMEM)
+f0101dec:	8d b8 00 00 f6 ff    	lea    -0xa0000(%eax),%edi
+f0101df2:	81 ff ff ff 05 00    	cmp    $0x5ffff,%edi
+f0101df8:	76 ba                	jbe    f0101db4 <page_init+0x6c>
+	if (PGNUM(pa) >= npages_lowmem)
+f0101dfa:	c1 e8 0c             	shr    $0xc,%eax
+f0101dfd:	39 d8                	cmp    %ebx,%eax
+f0101dff:	0f 83 71 ff ff ff    	jae    f0101d76 <page_init+0x2e>
+	return (void *)(pa + KERNBASE);
+f0101e05:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0101e08:	8d 87 00 00 00 f0    	lea    -0x10000000(%edi),%eax
+		if (pa >= EXTPHYSMEM && va >= KERNBASE && va < nextfree)
+f0101e0e:	81 ff ff ff ff 0f    	cmp    $0xfffffff,%edi
+f0101e14:	0f 96 c3             	setbe  %bl
+f0101e17:	89 df                	mov    %ebx,%edi
+f0101e19:	89 c3                	mov    %eax,%ebx
+f0101e1b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0101e1e:	39 c3                	cmp    %eax,%ebx
+f0101e20:	0f 92 c3             	setb   %bl
+f0101e23:	89 f8                	mov    %edi,%eax
+f0101e25:	84 d8                	test   %bl,%al
+f0101e27:	0f 84 6d ff ff ff    	je     f0101d9a <page_init+0x52>
+f0101e2d:	81 7d e4 ff ff 0f 00 	cmpl   $0xfffff,-0x1c(%ebp)
+f0101e34:	0f 86 60 ff ff ff    	jbe    f0101d9a <page_init+0x52>
+f0101e3a:	e9 75 ff ff ff       	jmp    f0101db4 <page_init+0x6c>
+f0101e3f:	80 7d df 00          	cmpb   $0x0,-0x21(%ebp)
+f0101e43:	74 08                	je     f0101e4d <page_init+0x105>
+f0101e45:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101e48:	a3 8c 18 61 f0       	mov    %eax,0xf061188c
+}
+f0101e4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101e50:	5b                   	pop    %ebx
+f0101e51:	5e                   	pop    %esi
+f0101e52:	5f                   	pop    %edi
+f0101e53:	5d                   	pop    %ebp
+f0101e54:	c3                   	ret
+
+f0101e55 <page_high_free_count>:
+}
+f0101e55:	a1 fc 17 61 f0       	mov    0xf06117fc,%eax
+f0101e5a:	c3                   	ret
+
+f0101e5b <page_free_blocks>:
+{
+f0101e5b:	55                   	push   %ebp
+f0101e5c:	89 e5                	mov    %esp,%ebp
+	return free_area_len[order];
+f0101e5e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101e61:	8b 04 85 20 18 61 f0 	mov    -0xf9ee7e0(,%eax,4),%eax
+}
+f0101e68:	5d                   	pop    %ebp
+f0101e69:	c3                   	ret
+
+f0101e6a <page_zero_stat>:
+{
+f0101e6a:	55                   	push   %ebp
+f0101e6b:	89 e5                	mov    %esp,%ebp
+f0101e6d:	53                   	push   %ebx
+f0101e6e:	83 ec 10             	sub    $0x10,%esp
+f0101e71:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	spin_lock(&page_zero_lock);
+f0101e74:	68 80 93 11 f0       	push   $0xf0119380
+f0101e79:	e8 55 90 00 00       	call   f010aed3 <spin_lock>
+	*st = page_zero;
+f0101e7e:	a1 e4 17 61 f0       	mov    0xf06117e4,%eax
+f0101e83:	89 03                	mov    %eax,(%ebx)
+f0101e85:	a1 e8 17 61 f0       	mov    0xf06117e8,%eax
+f0101e8a:	89 43 04             	mov    %eax,0x4(%ebx)
+f0101e8d:	a1 ec 17 61 f0       	mov    0xf06117ec,%eax
+f0101e92:	89 43 08             	mov    %eax,0x8(%ebx)
+f0101e95:	a1 f0 17 61 f0       	mov    0xf06117f0,%eax
+f0101e9a:	89 43 0c             	mov    %eax,0xc(%ebx)
+	spin_unlock(&page_zero_lock);
+f0101e9d:	c7 04 24 80 93 11 f0 	movl   $0xf0119380,(%esp)
+f0101ea4:	e8 46 91 00 00       	call   f010afef <spin_unlock>
+}
+f0101ea9:	83 c4 10             	add    $0x10,%esp
+f0101eac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101eaf:	c9                   	leave
+f0101eb0:	c3                   	ret
+
+f0101eb1 <page_free>:
+{
+f0101eb1:	55                   	push   %ebp
+f0101eb2:	89 e5                	mov    %esp,%ebp
+f0101eb4:	56                   	push   %esi
+f0101eb5:	53                   	push   %ebx
+f0101eb6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pp->pp_ref || pp->pp_link || pp->pp_order >= 0)
+f0101eb9:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+f0101ebd:	66 85 c0             	test   %ax,%ax
+f0101ec0:	75 62                	jne    f0101f24 <page_free+0x73>
+f0101ec2:	83 3b 00             	cmpl   $0x0,(%ebx)
+f0101ec5:	75 5d                	jne    f0101f24 <page_free+0x73>
+f0101ec7:	80 7b 06 00          	cmpb   $0x0,0x6(%ebx)
+f0101ecb:	79 57                	jns    f0101f24 <page_free+0x73>
+	return (pp - pages) << PGSHIFT;
+f0101ecd:	89 d8                	mov    %ebx,%eax
+f0101ecf:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0101ed5:	c1 f8 02             	sar    $0x2,%eax
+f0101ed8:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+	if (PGNUM(page2pa(pp)) >= npages_lowmem) {
+f0101ede:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101ee3:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0101ee9:	73 56                	jae    f0101f41 <page_free+0x90>
+	if (page_buddy_ready) {
+f0101eeb:	80 3d 04 18 61 f0 00 	cmpb   $0x0,0xf0611804
+f0101ef2:	75 7f                	jne    f0101f73 <page_free+0xc2>
+	spin_lock(&page_lock);
+f0101ef4:	83 ec 0c             	sub    $0xc,%esp
+f0101ef7:	68 e0 93 11 f0       	push   $0xf01193e0
+f0101efc:	e8 d2 8f 00 00       	call   f010aed3 <spin_lock>
+	pp->pp_link = page_free_list;
+f0101f01:	a1 8c 18 61 f0       	mov    0xf061188c,%eax
+f0101f06:	89 03                	mov    %eax,(%ebx)
+	page_free_list = pp;
+f0101f08:	89 1d 8c 18 61 f0    	mov    %ebx,0xf061188c
+	spin_unlock(&page_lock);
+f0101f0e:	c7 04 24 e0 93 11 f0 	movl   $0xf01193e0,(%esp)
+f0101f15:	e8 d5 90 00 00       	call   f010afef <spin_unlock>
+f0101f1a:	83 c4 10             	add    $0x10,%esp
+}
+f0101f1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101f20:	5b                   	pop    %ebx
+f0101f21:	5e                   	pop    %esi
+f0101f22:	5d                   	pop    %ebp
+f0101f23:	c3                   	ret
+		panic("page is not ready to be freed: pp_ref %d pp_link %p", pp->pp_ref, pp->pp_link);
+f0101f24:	83 ec 0c             	sub    $0xc,%esp
+f0101f27:	ff 33                	push   (%ebx)
+f0101f29:	0f b7 c0             	movzwl %ax,%eax
+f0101f2c:	50                   	push   %eax
+f0101f2d:	68 fc cd 10 f0       	push   $0xf010cdfc
+f0101f32:	68 60 03 00 00       	push   $0x360
+f0101f37:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0101f3c:	e8 57 e1 ff ff       	call   f0100098 <_panic>
+		spin_lock(&page_lock);
+f0101f41:	83 ec 0c             	sub    $0xc,%esp
+f0101f44:	68 e0 93 11 f0       	push   $0xf01193e0
+f0101f49:	e8 85 8f 00 00       	call   f010aed3 <spin_lock>
+		pp->pp_link = page_high_list;
+f0101f4e:	a1 00 18 61 f0       	mov    0xf0611800,%eax
+f0101f53:	89 03                	mov    %eax,(%ebx)
+		page_high_list = pp;
+f0101f55:	89 1d 00 18 61 f0    	mov    %ebx,0xf0611800
+		page_high_free++;
+f0101f5b:	83 05 fc 17 61 f0 01 	addl   $0x1,0xf06117fc
+		spin_unlock(&page_lock);
+f0101f62:	c7 04 24 e0 93 11 f0 	movl   $0xf01193e0,(%esp)
+f0101f69:	e8 81 90 00 00       	call   f010afef <spin_unlock>
+		return;
+f0101f6e:	83 c4 10             	add    $0x10,%esp
+f0101f71:	eb aa                	jmp    f0101f1d <page_free+0x6c>
+		c = thiscpu;
+f0101f73:	e8 cc 8c 00 00       	call   f010ac44 <cpunum>
+f0101f78:	89 c2                	mov    %eax,%edx
+		pp->pp_link = c->cpu_free_pages;
+f0101f7a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0101f80:	8b 88 c8 90 61 f0    	mov    -0xf9e6f38(%eax),%ecx
+f0101f86:	89 0b                	mov    %ecx,(%ebx)
+		c->cpu_free_pages = pp;
+f0101f88:	89 98 c8 90 61 f0    	mov    %ebx,-0xf9e6f38(%eax)
+		if (++c->cpu_nfree_pages > PAGE_CACHE_MAX)
+f0101f8e:	8b 88 cc 90 61 f0    	mov    -0xf9e6f34(%eax),%ecx
+f0101f94:	8d 71 01             	lea    0x1(%ecx),%esi
+f0101f97:	89 b0 cc 90 61 f0    	mov    %esi,-0xf9e6f34(%eax)
+f0101f9d:	83 e9 1f             	sub    $0x1f,%ecx
+	for (n = 1; n < c->cpu_nfree_pages - PAGE_CACHE_BATCH; n++)
+f0101fa0:	b8 01 00 00 00       	mov    $0x1,%eax
+		if (++c->cpu_nfree_pages > PAGE_CACHE_MAX)
+f0101fa5:	83 fe 40             	cmp    $0x40,%esi
+f0101fa8:	0f 8e 6f ff ff ff    	jle    f0101f1d <page_free+0x6c>
+f0101fae:	eb 05                	jmp    f0101fb5 <page_free+0x104>
+		keep = keep->pp_link;
+f0101fb0:	8b 1b                	mov    (%ebx),%ebx
+	for (n = 1; n < c->cpu_nfree_pages - PAGE_CACHE_BATCH; n++)
+f0101fb2:	83 c0 01             	add    $0x1,%eax
+f0101fb5:	39 c8                	cmp    %ecx,%eax
+f0101fb7:	75 f7                	jne    f0101fb0 <page_free+0xff>
+	pp = keep->pp_link;
+f0101fb9:	8b 33                	mov    (%ebx),%esi
+	keep->pp_link = NULL;
+f0101fbb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	c->cpu_nfree_pages -= PAGE_CACHE_BATCH;
+f0101fc1:	69 d2 bc 00 00 00    	imul   $0xbc,%edx,%edx
+f0101fc7:	83 aa cc 90 61 f0 20 	subl   $0x20,-0xf9e6f34(%edx)
+	spin_lock(&page_lock);
+f0101fce:	83 ec 0c             	sub    $0xc,%esp
+f0101fd1:	68 e0 93 11 f0       	push   $0xf01193e0
+f0101fd6:	e8 f8 8e 00 00       	call   f010aed3 <spin_lock>
+	for (; pp; pp = next) {
+f0101fdb:	83 c4 10             	add    $0x10,%esp
+f0101fde:	eb 16                	jmp    f0101ff6 <page_free+0x145>
+		next = pp->pp_link;
+f0101fe0:	8b 1e                	mov    (%esi),%ebx
+		pp->pp_link = NULL;
+f0101fe2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		buddy_free(pp, 0);
+f0101fe8:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101fed:	89 f0                	mov    %esi,%eax
+f0101fef:	e8 37 f6 ff ff       	call   f010162b <buddy_free>
+	for (; pp; pp = next) {
+f0101ff4:	89 de                	mov    %ebx,%esi
+f0101ff6:	85 f6                	test   %esi,%esi
+f0101ff8:	75 e6                	jne    f0101fe0 <page_free+0x12f>
+	spin_unlock(&page_lock);
+f0101ffa:	83 ec 0c             	sub    $0xc,%esp
+f0101ffd:	68 e0 93 11 f0       	push   $0xf01193e0
+f0102002:	e8 e8 8f 00 00       	call   f010afef <spin_unlock>
+}
+f0102007:	83 c4 10             	add    $0x10,%esp
+f010200a:	e9 0e ff ff ff       	jmp    f0101f1d <page_free+0x6c>
+
+f010200f <page_free_order>:
+{
+f010200f:	55                   	push   %ebp
+f0102010:	89 e5                	mov    %esp,%ebp
+f0102012:	56                   	push   %esi
+f0102013:	53                   	push   %ebx
+f0102014:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0102017:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (order == 0) {
+f010201a:	85 f6                	test   %esi,%esi
+f010201c:	74 40                	je     f010205e <page_free_order+0x4f>
+	if (pp->pp_ref || pp->pp_link || pp->pp_order >= 0)
+f010201e:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+f0102022:	66 85 c0             	test   %ax,%ax
+f0102025:	75 45                	jne    f010206c <page_free_order+0x5d>
+f0102027:	83 3b 00             	cmpl   $0x0,(%ebx)
+f010202a:	75 40                	jne    f010206c <page_free_order+0x5d>
+f010202c:	80 7b 06 00          	cmpb   $0x0,0x6(%ebx)
+f0102030:	79 3a                	jns    f010206c <page_free_order+0x5d>
+	spin_lock(&page_lock);
+f0102032:	83 ec 0c             	sub    $0xc,%esp
+f0102035:	68 e0 93 11 f0       	push   $0xf01193e0
+f010203a:	e8 94 8e 00 00       	call   f010aed3 <spin_lock>
+	buddy_free(pp, order);
+f010203f:	89 f2                	mov    %esi,%edx
+f0102041:	89 d8                	mov    %ebx,%eax
+f0102043:	e8 e3 f5 ff ff       	call   f010162b <buddy_free>
+	spin_unlock(&page_lock);
+f0102048:	c7 04 24 e0 93 11 f0 	movl   $0xf01193e0,(%esp)
+f010204f:	e8 9b 8f 00 00       	call   f010afef <spin_unlock>
+f0102054:	83 c4 10             	add    $0x10,%esp
+}
+f0102057:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010205a:	5b                   	pop    %ebx
+f010205b:	5e                   	pop    %esi
+f010205c:	5d                   	pop    %ebp
+f010205d:	c3                   	ret
+		page_free(pp);
+f010205e:	83 ec 0c             	sub    $0xc,%esp
+f0102061:	53                   	push   %ebx
+f0102062:	e8 4a fe ff ff       	call   f0101eb1 <page_free>
+		return;
+f0102067:	83 c4 10             	add    $0x10,%esp
+f010206a:	eb eb                	jmp    f0102057 <page_free_order+0x48>
+		panic("pages are not ready to be freed: pp_ref %d pp_link %p", pp->pp_ref, pp->pp_link);
+f010206c:	83 ec 0c             	sub    $0xc,%esp
+f010206f:	ff 33                	push   (%ebx)
+f0102071:	0f b7 c0             	movzwl %ax,%eax
+f0102074:	50                   	push   %eax
+f0102075:	68 30 ce 10 f0       	push   $0xf010ce30
+f010207a:	68 a4 03 00 00       	push   $0x3a4
+f010207f:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0102084:	e8 0f e0 ff ff       	call   f0100098 <_panic>
+
+f0102089 <page_incref>:
+{
+f0102089:	55                   	push   %ebp
+f010208a:	89 e5                	mov    %esp,%ebp
+f010208c:	53                   	push   %ebx
+f010208d:	83 ec 10             	sub    $0x10,%esp
+f0102090:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	spin_lock(&page_lock);
+f0102093:	68 e0 93 11 f0       	push   $0xf01193e0
+f0102098:	e8 36 8e 00 00       	call   f010aed3 <spin_lock>
+	pp->pp_ref++;
+f010209d:	66 83 43 04 01       	addw   $0x1,0x4(%ebx)
+	spin_unlock(&page_lock);
+f01020a2:	c7 04 24 e0 93 11 f0 	movl   $0xf01193e0,(%esp)
+f01020a9:	e8 41 8f 00 00       	call   f010afef <spin_unlock>
+}
+f01020ae:	83 c4 10             	add    $0x10,%esp
+f01020b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01020b4:	c9                   	leave
+f01020b5:	c3                   	ret
+
+f01020b6 <page_decref_order>:
+{
+f01020b6:	55                   	push   %ebp
+f01020b7:	89 e5                	mov    %esp,%ebp
+f01020b9:	56                   	push   %esi
+f01020ba:	53                   	push   %ebx
+f01020bb:	8b 75 08             	mov    0x8(%ebp),%esi
+	spin_lock(&page_lock);
+f01020be:	83 ec 0c             	sub    $0xc,%esp
+f01020c1:	68 e0 93 11 f0       	push   $0xf01193e0
+f01020c6:	e8 08 8e 00 00       	call   f010aed3 <spin_lock>
+	last = (--pp->pp_ref == 0);
+f01020cb:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+f01020cf:	8d 58 ff             	lea    -0x1(%eax),%ebx
+f01020d2:	66 89 5e 04          	mov    %bx,0x4(%esi)
+	spin_unlock(&page_lock);
+f01020d6:	c7 04 24 e0 93 11 f0 	movl   $0xf01193e0,(%esp)
+f01020dd:	e8 0d 8f 00 00       	call   f010afef <spin_unlock>
+	if (last)
+f01020e2:	83 c4 10             	add    $0x10,%esp
+f01020e5:	66 85 db             	test   %bx,%bx
+f01020e8:	74 07                	je     f01020f1 <page_decref_order+0x3b>
+}
+f01020ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01020ed:	5b                   	pop    %ebx
+f01020ee:	5e                   	pop    %esi
+f01020ef:	5d                   	pop    %ebp
+f01020f0:	c3                   	ret
+		page_free_order(pp, order);
+f01020f1:	83 ec 08             	sub    $0x8,%esp
+f01020f4:	ff 75 0c             	push   0xc(%ebp)
+f01020f7:	56                   	push   %esi
+f01020f8:	e8 12 ff ff ff       	call   f010200f <page_free_order>
+f01020fd:	83 c4 10             	add    $0x10,%esp
+}
+f0102100:	eb e8                	jmp    f01020ea <page_decref_order+0x34>
+
+f0102102 <page_decref>:
+{
+f0102102:	55                   	push   %ebp
+f0102103:	89 e5                	mov    %esp,%ebp
+f0102105:	83 ec 10             	sub    $0x10,%esp
+	page_decref_order(pp, 0);
+f0102108:	6a 00                	push   $0x0
+f010210a:	ff 75 08             	push   0x8(%ebp)
+f010210d:	e8 a4 ff ff ff       	call   f01020b6 <page_decref_order>
+}
+f0102112:	83 c4 10             	add    $0x10,%esp
+f0102115:	c9                   	leave
+f0102116:	c3                   	ret
+
+f0102117 <page_release>:
+{
+f0102117:	55                   	push   %ebp
+f0102118:	89 e5                	mov    %esp,%ebp
+f010211a:	57                   	push   %edi
+f010211b:	56                   	push   %esi
+f010211c:	53                   	push   %ebx
+f010211d:	83 ec 0c             	sub    $0xc,%esp
+f0102120:	89 c6                	mov    %eax,%esi
+f0102122:	89 d7                	mov    %edx,%edi
+	struct TlbBatch *b = &tlb_batch[cpunum()];
+f0102124:	e8 1b 8b 00 00       	call   f010ac44 <cpunum>
+f0102129:	89 c3                	mov    %eax,%ebx
+	if (!b->tb_cpus) {
+f010212b:	69 c0 b0 00 00 00    	imul   $0xb0,%eax,%eax
+f0102131:	83 b8 e4 12 61 f0 00 	cmpl   $0x0,-0xf9eed1c(%eax)
+f0102138:	74 35                	je     f010216f <page_release+0x58>
+	if (!(tr = kmalloc(sizeof(*tr), 0))) {
+f010213a:	83 ec 08             	sub    $0x8,%esp
+f010213d:	6a 00                	push   $0x0
+f010213f:	6a 0c                	push   $0xc
+f0102141:	e8 58 36 00 00       	call   f010579e <kmalloc>
+f0102146:	83 c4 10             	add    $0x10,%esp
+f0102149:	85 c0                	test   %eax,%eax
+f010214b:	74 31                	je     f010217e <page_release+0x67>
+	tr->tr_page = pp;
+f010214d:	89 30                	mov    %esi,(%eax)
+	tr->tr_order = order;
+f010214f:	89 78 04             	mov    %edi,0x4(%eax)
+	tr->tr_next = b->tb_release;
+f0102152:	69 db b0 00 00 00    	imul   $0xb0,%ebx,%ebx
+f0102158:	8b 93 0c 13 61 f0    	mov    -0xf9eecf4(%ebx),%edx
+f010215e:	89 50 08             	mov    %edx,0x8(%eax)
+	b->tb_release = tr;
+f0102161:	89 83 0c 13 61 f0    	mov    %eax,-0xf9eecf4(%ebx)
+}
+f0102167:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010216a:	5b                   	pop    %ebx
+f010216b:	5e                   	pop    %esi
+f010216c:	5f                   	pop    %edi
+f010216d:	5d                   	pop    %ebp
+f010216e:	c3                   	ret
+		page_decref_order(pp, order);
+f010216f:	83 ec 08             	sub    $0x8,%esp
+f0102172:	57                   	push   %edi
+f0102173:	56                   	push   %esi
+f0102174:	e8 3d ff ff ff       	call   f01020b6 <page_decref_order>
+		return;
+f0102179:	83 c4 10             	add    $0x10,%esp
+f010217c:	eb e9                	jmp    f0102167 <page_release+0x50>
+		cprintf("page_release: out of memory, leaking page %08x\n",
+f010217e:	83 ec 08             	sub    $0x8,%esp
+f0102181:	2b 35 80 89 61 f0    	sub    0xf0618980,%esi
+f0102187:	c1 fe 02             	sar    $0x2,%esi
+f010218a:	69 f6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%esi
+f0102190:	c1 e6 0c             	shl    $0xc,%esi
+f0102193:	56                   	push   %esi
+f0102194:	68 68 ce 10 f0       	push   $0xf010ce68
+f0102199:	e8 5e 4e 00 00       	call   f0106ffc <cprintf>
+		return;
+f010219e:	83 c4 10             	add    $0x10,%esp
+f01021a1:	eb c4                	jmp    f0102167 <page_release+0x50>
+
+f01021a3 <kmap>:
+{
+f01021a3:	55                   	push   %ebp
+f01021a4:	89 e5                	mov    %esp,%ebp
+f01021a6:	56                   	push   %esi
+f01021a7:	53                   	push   %ebx
+f01021a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01021ab:	89 da                	mov    %ebx,%edx
+f01021ad:	2b 15 80 89 61 f0    	sub    0xf0618980,%edx
+f01021b3:	c1 fa 02             	sar    $0x2,%edx
+f01021b6:	69 d2 ab aa aa aa    	imul   $0xaaaaaaab,%edx,%edx
+f01021bc:	89 d0                	mov    %edx,%eax
+f01021be:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(page2pa(pp)) < npages_lowmem)
+f01021c1:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+	return (void *)(pa + KERNBASE);
+f01021c7:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f01021cc:	3b 15 6c 89 61 f0    	cmp    0xf061896c,%edx
+f01021d2:	72 5b                	jb     f010222f <kmap+0x8c>
+	c = thiscpu;
+f01021d4:	e8 6b 8a 00 00       	call   f010ac44 <cpunum>
+f01021d9:	89 c6                	mov    %eax,%esi
+	if (c->cpu_kmap_depth == KMAPSLOTS)
+f01021db:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01021e1:	83 b8 d8 90 61 f0 10 	cmpl   $0x10,-0xf9e6f28(%eax)
+f01021e8:	74 4c                	je     f0102236 <kmap+0x93>
+	slot = cpunum() * KMAPSLOTS + c->cpu_kmap_depth++;
+f01021ea:	e8 55 8a 00 00       	call   f010ac44 <cpunum>
+f01021ef:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+f01021f5:	8b 96 d8 90 61 f0    	mov    -0xf9e6f28(%esi),%edx
+f01021fb:	8d 4a 01             	lea    0x1(%edx),%ecx
+f01021fe:	89 8e d8 90 61 f0    	mov    %ecx,-0xf9e6f28(%esi)
+f0102204:	c1 e0 04             	shl    $0x4,%eax
+f0102207:	01 d0                	add    %edx,%eax
+	return (pp - pages) << PGSHIFT;
+f0102209:	2b 1d 80 89 61 f0    	sub    0xf0618980,%ebx
+f010220f:	c1 fb 02             	sar    $0x2,%ebx
+f0102212:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+f0102218:	c1 e3 0c             	shl    $0xc,%ebx
+	kmap_ptes[slot] = page2pa(pp) | PTE_W | PTE_P;
+f010221b:	83 cb 03             	or     $0x3,%ebx
+f010221e:	8b 15 f8 17 61 f0    	mov    0xf06117f8,%edx
+f0102224:	89 1c 82             	mov    %ebx,(%edx,%eax,4)
+	return (void *) (KMAPBASE + slot * PGSIZE);
+f0102227:	c1 e0 0c             	shl    $0xc,%eax
+f010222a:	2d 00 00 40 10       	sub    $0x10400000,%eax
+}
+f010222f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0102232:	5b                   	pop    %ebx
+f0102233:	5e                   	pop    %esi
+f0102234:	5d                   	pop    %ebp
+f0102235:	c3                   	ret
+		panic("kmap: out of slots");
+f0102236:	83 ec 04             	sub    $0x4,%esp
+f0102239:	68 ba d8 10 f0       	push   $0xf010d8ba
+f010223e:	68 e4 03 00 00       	push   $0x3e4
+f0102243:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0102248:	e8 4b de ff ff       	call   f0100098 <_panic>
+
+f010224d <kunmap>:
+{
+f010224d:	55                   	push   %ebp
+f010224e:	89 e5                	mov    %esp,%ebp
+f0102250:	57                   	push   %edi
+f0102251:	56                   	push   %esi
+f0102252:	53                   	push   %ebx
+f0102253:	83 ec 0c             	sub    $0xc,%esp
+f0102256:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((uintptr_t) va >= KERNBASE)
+f0102259:	81 fe ff ff ff ef    	cmp    $0xefffffff,%esi
+f010225f:	76 08                	jbe    f0102269 <kunmap+0x1c>
+}
+f0102261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102264:	5b                   	pop    %ebx
+f0102265:	5e                   	pop    %esi
+f0102266:	5f                   	pop    %edi
+f0102267:	5d                   	pop    %ebp
+f0102268:	c3                   	ret
+	c = thiscpu;
+f0102269:	e8 d6 89 00 00       	call   f010ac44 <cpunum>
+f010226e:	89 c3                	mov    %eax,%ebx
+	slot = ((uintptr_t) va - KMAPBASE) / PGSIZE;
+f0102270:	8d be 00 00 40 10    	lea    0x10400000(%esi),%edi
+f0102276:	c1 ef 0c             	shr    $0xc,%edi
+	if (slot != cpunum() * KMAPSLOTS + c->cpu_kmap_depth - 1)
+f0102279:	e8 c6 89 00 00       	call   f010ac44 <cpunum>
+f010227e:	69 d3 bc 00 00 00    	imul   $0xbc,%ebx,%edx
+f0102284:	8b 92 d8 90 61 f0    	mov    -0xf9e6f28(%edx),%edx
+f010228a:	c1 e0 04             	shl    $0x4,%eax
+f010228d:	8d 44 02 ff          	lea    -0x1(%edx,%eax,1),%eax
+f0102291:	39 f8                	cmp    %edi,%eax
+f0102293:	75 20                	jne    f01022b5 <kunmap+0x68>
+	c->cpu_kmap_depth--;
+f0102295:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+f010229b:	83 ea 01             	sub    $0x1,%edx
+f010229e:	89 93 d8 90 61 f0    	mov    %edx,-0xf9e6f28(%ebx)
+	kmap_ptes[slot] = 0;
+f01022a4:	a1 f8 17 61 f0       	mov    0xf06117f8,%eax
+f01022a9:	c7 04 b8 00 00 00 00 	movl   $0x0,(%eax,%edi,4)
+	__asm __volatile("invlpg (%0)" : : "r" (addr) : "memory");
+f01022b0:	0f 01 3e             	invlpg (%esi)
+}
+f01022b3:	eb ac                	jmp    f0102261 <kunmap+0x14>
+		panic("kunmap: %08x is not the last kmap", va);
+f01022b5:	56                   	push   %esi
+f01022b6:	68 98 ce 10 f0       	push   $0xf010ce98
+f01022bb:	68 f9 03 00 00       	push   $0x3f9
+f01022c0:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01022c5:	e8 ce dd ff ff       	call   f0100098 <_panic>
+
+f01022ca <page_alloc>:
+{
+f01022ca:	55                   	push   %ebp
+f01022cb:	89 e5                	mov    %esp,%ebp
+f01022cd:	57                   	push   %edi
+f01022ce:	56                   	push   %esi
+f01022cf:	53                   	push   %ebx
+f01022d0:	83 ec 0c             	sub    $0xc,%esp
+f01022d3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((alloc_flags & ALLOC_ZERO) && (pp = page_zero_pop(alloc_flags, 1)))
+f01022d6:	89 f7                	mov    %esi,%edi
+f01022d8:	83 e7 01             	and    $0x1,%edi
+f01022db:	75 3f                	jne    f010231c <page_alloc+0x52>
+	if ((alloc_flags & ALLOC_HIGH) && (pp = page_alloc_high())) {
+f01022dd:	f7 c6 02 00 00 00    	test   $0x2,%esi
+f01022e3:	74 4b                	je     f0102330 <page_alloc+0x66>
+f01022e5:	e8 6b f4 ff ff       	call   f0101755 <page_alloc_high>
+f01022ea:	89 c3                	mov    %eax,%ebx
+f01022ec:	85 c0                	test   %eax,%eax
+f01022ee:	74 40                	je     f0102330 <page_alloc+0x66>
+		if (alloc_flags & ALLOC_ZERO) {
+f01022f0:	85 ff                	test   %edi,%edi
+f01022f2:	74 4b                	je     f010233f <page_alloc+0x75>
+			va = kmap(pp);
+f01022f4:	83 ec 0c             	sub    $0xc,%esp
+f01022f7:	50                   	push   %eax
+f01022f8:	e8 a6 fe ff ff       	call   f01021a3 <kmap>
+f01022fd:	89 c6                	mov    %eax,%esi
+			memset(va, 0, PGSIZE);
+f01022ff:	83 c4 0c             	add    $0xc,%esp
+f0102302:	68 00 10 00 00       	push   $0x1000
+f0102307:	6a 00                	push   $0x0
+f0102309:	50                   	push   %eax
+f010230a:	e8 ef 82 00 00       	call   f010a5fe <memset>
+			kunmap(va);
+f010230f:	89 34 24             	mov    %esi,(%esp)
+f0102312:	e8 36 ff ff ff       	call   f010224d <kunmap>
+f0102317:	83 c4 10             	add    $0x10,%esp
+f010231a:	eb 23                	jmp    f010233f <page_alloc+0x75>
+	if ((alloc_flags & ALLOC_ZERO) && (pp = page_zero_pop(alloc_flags, 1)))
+f010231c:	ba 01 00 00 00       	mov    $0x1,%edx
+f0102321:	89 f0                	mov    %esi,%eax
+f0102323:	e8 88 f4 ff ff       	call   f01017b0 <page_zero_pop>
+f0102328:	89 c3                	mov    %eax,%ebx
+f010232a:	85 c0                	test   %eax,%eax
+f010232c:	75 11                	jne    f010233f <page_alloc+0x75>
+f010232e:	eb ad                	jmp    f01022dd <page_alloc+0x13>
+	pp = page_alloc_free();
+f0102330:	e8 2d f5 ff ff       	call   f0101862 <page_alloc_free>
+f0102335:	89 c3                	mov    %eax,%ebx
+	if (!pp)
+f0102337:	85 c0                	test   %eax,%eax
+f0102339:	74 0e                	je     f0102349 <page_alloc+0x7f>
+	if (alloc_flags & ALLOC_ZERO)
+f010233b:	85 ff                	test   %edi,%edi
+f010233d:	75 1a                	jne    f0102359 <page_alloc+0x8f>
+}
+f010233f:	89 d8                	mov    %ebx,%eax
+f0102341:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102344:	5b                   	pop    %ebx
+f0102345:	5e                   	pop    %esi
+f0102346:	5f                   	pop    %edi
+f0102347:	5d                   	pop    %ebp
+f0102348:	c3                   	ret
+		return page_zero_pop(alloc_flags, 0);
+f0102349:	ba 00 00 00 00       	mov    $0x0,%edx
+f010234e:	89 f0                	mov    %esi,%eax
+f0102350:	e8 5b f4 ff ff       	call   f01017b0 <page_zero_pop>
+f0102355:	89 c3                	mov    %eax,%ebx
+f0102357:	eb e6                	jmp    f010233f <page_alloc+0x75>
+f0102359:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f010235f:	c1 f8 02             	sar    $0x2,%eax
+f0102362:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102368:	89 c2                	mov    %eax,%edx
+f010236a:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages_lowmem)
+f010236d:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102372:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0102378:	73 1b                	jae    f0102395 <page_alloc+0xcb>
+		memset(page2kva(pp), 0, PGSIZE);
+f010237a:	83 ec 04             	sub    $0x4,%esp
+f010237d:	68 00 10 00 00       	push   $0x1000
+f0102382:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f0102384:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f010238a:	52                   	push   %edx
+f010238b:	e8 6e 82 00 00       	call   f010a5fe <memset>
+f0102390:	83 c4 10             	add    $0x10,%esp
+f0102393:	eb aa                	jmp    f010233f <page_alloc+0x75>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102395:	52                   	push   %edx
+f0102396:	68 1c c0 10 f0       	push   $0xf010c01c
+f010239b:	6a 7d                	push   $0x7d
+f010239d:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f01023a2:	e8 f1 dc ff ff       	call   f0100098 <_panic>
+
+f01023a7 <page_alloc_order>:
+{
+f01023a7:	55                   	push   %ebp
+f01023a8:	89 e5                	mov    %esp,%ebp
+f01023aa:	56                   	push   %esi
+f01023ab:	53                   	push   %ebx
+f01023ac:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (order == 0)
+f01023af:	85 f6                	test   %esi,%esi
+f01023b1:	74 4e                	je     f0102401 <page_alloc_order+0x5a>
+	if (order < 0 || order > PAGE_MAX_ORDER || !page_buddy_ready)
+f01023b3:	83 fe 0a             	cmp    $0xa,%esi
+f01023b6:	0f 87 ac 00 00 00    	ja     f0102468 <page_alloc_order+0xc1>
+f01023bc:	80 3d 04 18 61 f0 00 	cmpb   $0x0,0xf0611804
+f01023c3:	0f 84 a6 00 00 00    	je     f010246f <page_alloc_order+0xc8>
+	spin_lock(&page_lock);
+f01023c9:	83 ec 0c             	sub    $0xc,%esp
+f01023cc:	68 e0 93 11 f0       	push   $0xf01193e0
+f01023d1:	e8 fd 8a 00 00       	call   f010aed3 <spin_lock>
+	pp = buddy_alloc(order);
+f01023d6:	89 f0                	mov    %esi,%eax
+f01023d8:	e8 f5 f1 ff ff       	call   f01015d2 <buddy_alloc>
+f01023dd:	89 c3                	mov    %eax,%ebx
+	spin_unlock(&page_lock);
+f01023df:	c7 04 24 e0 93 11 f0 	movl   $0xf01193e0,(%esp)
+f01023e6:	e8 04 8c 00 00       	call   f010afef <spin_unlock>
+	if (pp && (alloc_flags & ALLOC_ZERO))
+f01023eb:	83 c4 10             	add    $0x10,%esp
+f01023ee:	85 db                	test   %ebx,%ebx
+f01023f0:	74 06                	je     f01023f8 <page_alloc_order+0x51>
+f01023f2:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+f01023f6:	75 1b                	jne    f0102413 <page_alloc_order+0x6c>
+}
+f01023f8:	89 d8                	mov    %ebx,%eax
+f01023fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01023fd:	5b                   	pop    %ebx
+f01023fe:	5e                   	pop    %esi
+f01023ff:	5d                   	pop    %ebp
+f0102400:	c3                   	ret
+		return page_alloc(alloc_flags);
+f0102401:	83 ec 0c             	sub    $0xc,%esp
+f0102404:	ff 75 0c             	push   0xc(%ebp)
+f0102407:	e8 be fe ff ff       	call   f01022ca <page_alloc>
+f010240c:	89 c3                	mov    %eax,%ebx
+f010240e:	83 c4 10             	add    $0x10,%esp
+f0102411:	eb e5                	jmp    f01023f8 <page_alloc_order+0x51>
+		memset(page2kva(pp), 0, PGSIZE << order);
+f0102413:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102418:	89 f1                	mov    %esi,%ecx
+f010241a:	d3 e2                	shl    %cl,%edx
+	return (pp - pages) << PGSHIFT;
+f010241c:	89 d8                	mov    %ebx,%eax
+f010241e:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0102424:	c1 f8 02             	sar    $0x2,%eax
+f0102427:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010242d:	89 c1                	mov    %eax,%ecx
+f010242f:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages_lowmem)
+f0102432:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102437:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f010243d:	73 17                	jae    f0102456 <page_alloc_order+0xaf>
+f010243f:	83 ec 04             	sub    $0x4,%esp
+f0102442:	52                   	push   %edx
+f0102443:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f0102445:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f010244b:	51                   	push   %ecx
+f010244c:	e8 ad 81 00 00       	call   f010a5fe <memset>
+f0102451:	83 c4 10             	add    $0x10,%esp
+f0102454:	eb a2                	jmp    f01023f8 <page_alloc_order+0x51>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102456:	51                   	push   %ecx
+f0102457:	68 1c c0 10 f0       	push   $0xf010c01c
+f010245c:	6a 7d                	push   $0x7d
+f010245e:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0102463:	e8 30 dc ff ff       	call   f0100098 <_panic>
+		return NULL;
+f0102468:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010246d:	eb 89                	jmp    f01023f8 <page_alloc_order+0x51>
+f010246f:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0102474:	eb 82                	jmp    f01023f8 <page_alloc_order+0x51>
+
+f0102476 <page_zero_fill>:
+{
+f0102476:	55                   	push   %ebp
+f0102477:	89 e5                	mov    %esp,%ebp
+f0102479:	57                   	push   %edi
+f010247a:	56                   	push   %esi
+f010247b:	53                   	push   %ebx
+f010247c:	83 ec 1c             	sub    $0x1c,%esp
+	if (!page_buddy_ready)
+f010247f:	c7 45 e4 11 00 00 00 	movl   $0x11,-0x1c(%ebp)
+		asm volatile("movnti %1, 0(%0)\n\t"
+f0102486:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (!page_buddy_ready)
+f010248b:	80 3d 04 18 61 f0 00 	cmpb   $0x0,0xf0611804
+f0102492:	75 69                	jne    f01024fd <page_zero_fill+0x87>
+}
+f0102494:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102497:	5b                   	pop    %ebx
+f0102498:	5e                   	pop    %esi
+f0102499:	5f                   	pop    %edi
+f010249a:	5d                   	pop    %ebp
+f010249b:	c3                   	ret
+		if (!(pp = page_zero_high ? page_alloc_high() : page_alloc_free()))
+f010249c:	e8 c1 f3 ff ff       	call   f0101862 <page_alloc_free>
+f01024a1:	89 c6                	mov    %eax,%esi
+f01024a3:	eb 7a                	jmp    f010251f <page_zero_fill+0xa9>
+		asm volatile("movnti %1, 0(%0)\n\t"
+f01024a5:	0f c3 18             	movnti %ebx,(%eax)
+f01024a8:	0f c3 58 04          	movnti %ebx,0x4(%eax)
+f01024ac:	0f c3 58 08          	movnti %ebx,0x8(%eax)
+f01024b0:	0f c3 58 0c          	movnti %ebx,0xc(%eax)
+	for (p = va; p < end; p += 4)
+f01024b4:	83 c0 10             	add    $0x10,%eax
+f01024b7:	39 c2                	cmp    %eax,%edx
+f01024b9:	75 ea                	jne    f01024a5 <page_zero_fill+0x2f>
+	asm volatile("sfence" : : : "memory");
+f01024bb:	0f ae f8             	sfence
+		kunmap(va);
+f01024be:	83 ec 0c             	sub    $0xc,%esp
+f01024c1:	57                   	push   %edi
+f01024c2:	e8 86 fd ff ff       	call   f010224d <kunmap>
+		spin_lock(&page_zero_lock);
+f01024c7:	c7 04 24 80 93 11 f0 	movl   $0xf0119380,(%esp)
+f01024ce:	e8 00 8a 00 00       	call   f010aed3 <spin_lock>
+		pp->pp_link = page_zero_list;
+f01024d3:	a1 f4 17 61 f0       	mov    0xf06117f4,%eax
+f01024d8:	89 06                	mov    %eax,(%esi)
+		page_zero_list = pp;
+f01024da:	89 35 f4 17 61 f0    	mov    %esi,0xf06117f4
+		page_zero.pages++;
+f01024e0:	83 05 e4 17 61 f0 01 	addl   $0x1,0xf06117e4
+		page_zero.filled++;
+f01024e7:	83 05 f0 17 61 f0 01 	addl   $0x1,0xf06117f0
+		spin_unlock(&page_zero_lock);
+f01024ee:	c7 04 24 80 93 11 f0 	movl   $0xf0119380,(%esp)
+f01024f5:	e8 f5 8a 00 00       	call   f010afef <spin_unlock>
+f01024fa:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < PAGE_ZERO_BATCH && page_zero.pages < PAGE_ZERO_MAX; i++) {
+f01024fd:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+f0102501:	74 91                	je     f0102494 <page_zero_fill+0x1e>
+f0102503:	81 3d e4 17 61 f0 ff 	cmpl   $0xff,0xf06117e4
+f010250a:	00 00 00 
+f010250d:	77 85                	ja     f0102494 <page_zero_fill+0x1e>
+		if (!(pp = page_zero_high ? page_alloc_high() : page_alloc_free()))
+f010250f:	80 3d e0 17 61 f0 00 	cmpb   $0x0,0xf06117e0
+f0102516:	74 84                	je     f010249c <page_zero_fill+0x26>
+f0102518:	e8 38 f2 ff ff       	call   f0101755 <page_alloc_high>
+f010251d:	89 c6                	mov    %eax,%esi
+f010251f:	85 f6                	test   %esi,%esi
+f0102521:	0f 84 6d ff ff ff    	je     f0102494 <page_zero_fill+0x1e>
+		va = kmap(pp);
+f0102527:	83 ec 0c             	sub    $0xc,%esp
+f010252a:	56                   	push   %esi
+f010252b:	e8 73 fc ff ff       	call   f01021a3 <kmap>
+f0102530:	89 c7                	mov    %eax,%edi
+	if (!page_zero_nt) {
+f0102532:	83 c4 10             	add    $0x10,%esp
+	end = (uint32_t *) (va + PGSIZE);
+f0102535:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+	if (!page_zero_nt) {
+f010253b:	80 3d e1 17 61 f0 00 	cmpb   $0x0,0xf06117e1
+f0102542:	0f 85 6f ff ff ff    	jne    f01024b7 <page_zero_fill+0x41>
+		memset(va, 0, PGSIZE);
+f0102548:	83 ec 04             	sub    $0x4,%esp
+f010254b:	68 00 10 00 00       	push   $0x1000
+f0102550:	6a 00                	push   $0x0
+f0102552:	50                   	push   %eax
+f0102553:	e8 a6 80 00 00       	call   f010a5fe <memset>
+		return;
+f0102558:	83 c4 10             	add    $0x10,%esp
+f010255b:	e9 5e ff ff ff       	jmp    f01024be <page_zero_fill+0x48>
+
+f0102560 <pgdir_walk>:
+{
+f0102560:	55                   	push   %ebp
+f0102561:	89 e5                	mov    %esp,%ebp
+f0102563:	56                   	push   %esi
+f0102564:	53                   	push   %ebx
+f0102565:	8b 75 0c             	mov    0xc(%ebp),%esi
+	pde = &pgdir[PDX(va)];
+f0102568:	89 f3                	mov    %esi,%ebx
+f010256a:	c1 eb 16             	shr    $0x16,%ebx
+f010256d:	c1 e3 02             	shl    $0x2,%ebx
+f0102570:	03 5d 08             	add    0x8(%ebp),%ebx
+	if (!(*pde & PTE_P)) {
+f0102573:	f6 03 01             	testb  $0x1,(%ebx)
+f0102576:	75 33                	jne    f01025ab <pgdir_walk+0x4b>
+		if (!create)
+f0102578:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f010257c:	74 76                	je     f01025f4 <pgdir_walk+0x94>
+		pp = page_alloc(ALLOC_ZERO);
+f010257e:	83 ec 0c             	sub    $0xc,%esp
+f0102581:	6a 01                	push   $0x1
+f0102583:	e8 42 fd ff ff       	call   f01022ca <page_alloc>
+		if (!pp)
+f0102588:	83 c4 10             	add    $0x10,%esp
+f010258b:	85 c0                	test   %eax,%eax
+f010258d:	74 6c                	je     f01025fb <pgdir_walk+0x9b>
+		pp->pp_ref++;
+f010258f:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f0102594:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f010259a:	c1 f8 02             	sar    $0x2,%eax
+f010259d:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01025a3:	c1 e0 0c             	shl    $0xc,%eax
+		*pde = page2pa(pp)|(PTE_U|PTE_P|PTE_W);
+f01025a6:	83 c8 07             	or     $0x7,%eax
+f01025a9:	89 03                	mov    %eax,(%ebx)
+	if (*pde & PTE_PS)
+f01025ab:	8b 03                	mov    (%ebx),%eax
+f01025ad:	a8 80                	test   $0x80,%al
+f01025af:	74 09                	je     f01025ba <pgdir_walk+0x5a>
+}
+f01025b1:	89 d8                	mov    %ebx,%eax
+f01025b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01025b6:	5b                   	pop    %ebx
+f01025b7:	5e                   	pop    %esi
+f01025b8:	5d                   	pop    %ebp
+f01025b9:	c3                   	ret
+	pt = (pte_t *) (KADDR(PTE_ADDR(*pde)));
+f01025ba:	89 c2                	mov    %eax,%edx
+f01025bc:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages_lowmem)
+f01025c2:	c1 e8 0c             	shr    $0xc,%eax
+f01025c5:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f01025cb:	73 12                	jae    f01025df <pgdir_walk+0x7f>
+	return &pt[PTX(va)];
+f01025cd:	c1 ee 0a             	shr    $0xa,%esi
+f01025d0:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+f01025d6:	8d 9c 32 00 00 00 f0 	lea    -0x10000000(%edx,%esi,1),%ebx
+f01025dd:	eb d2                	jmp    f01025b1 <pgdir_walk+0x51>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01025df:	52                   	push   %edx
+f01025e0:	68 1c c0 10 f0       	push   $0xf010c01c
+f01025e5:	68 31 04 00 00       	push   $0x431
+f01025ea:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01025ef:	e8 a4 da ff ff       	call   f0100098 <_panic>
+			return NULL;
+f01025f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01025f9:	eb b6                	jmp    f01025b1 <pgdir_walk+0x51>
+			return NULL;
+f01025fb:	89 c3                	mov    %eax,%ebx
+f01025fd:	eb b2                	jmp    f01025b1 <pgdir_walk+0x51>
+
+f01025ff <boot_map_region>:
+{
+f01025ff:	55                   	push   %ebp
+f0102600:	89 e5                	mov    %esp,%ebp
+f0102602:	57                   	push   %edi
+f0102603:	56                   	push   %esi
+f0102604:	53                   	push   %ebx
+f0102605:	83 ec 1c             	sub    $0x1c,%esp
+f0102608:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010260b:	8b 75 08             	mov    0x8(%ebp),%esi
+	assert(size % PGSIZE == 0);
+f010260e:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+f0102614:	75 2b                	jne    f0102641 <boot_map_region+0x42>
+f0102616:	89 d3                	mov    %edx,%ebx
+	assert(PTE_ADDR(va) == va);
+f0102618:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f010261e:	75 3a                	jne    f010265a <boot_map_region+0x5b>
+	assert(PTE_ADDR(pa) == pa);
+f0102620:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+f0102626:	75 4b                	jne    f0102673 <boot_map_region+0x74>
+	perm |= kern_pte_g;
+f0102628:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010262b:	0b 05 90 18 61 f0    	or     0xf0611890,%eax
+f0102631:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	n = size / PGSIZE;
+f0102634:	c1 e9 0c             	shr    $0xc,%ecx
+f0102637:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	for (i = 0; i < n; i++, va += PGSIZE, pa += PGSIZE) {
+f010263a:	bf 00 00 00 00       	mov    $0x0,%edi
+f010263f:	eb 79                	jmp    f01026ba <boot_map_region+0xbb>
+	assert(size % PGSIZE == 0);
+f0102641:	68 cd d8 10 f0       	push   $0xf010d8cd
+f0102646:	68 0d d8 10 f0       	push   $0xf010d80d
+f010264b:	68 49 04 00 00       	push   $0x449
+f0102650:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0102655:	e8 3e da ff ff       	call   f0100098 <_panic>
+	assert(PTE_ADDR(va) == va);
+f010265a:	68 e0 d8 10 f0       	push   $0xf010d8e0
+f010265f:	68 0d d8 10 f0       	push   $0xf010d80d
+f0102664:	68 4a 04 00 00       	push   $0x44a
+f0102669:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010266e:	e8 25 da ff ff       	call   f0100098 <_panic>
+	assert(PTE_ADDR(pa) == pa);
+f0102673:	68 f3 d8 10 f0       	push   $0xf010d8f3
+f0102678:	68 0d d8 10 f0       	push   $0xf010d80d
+f010267d:	68 4b 04 00 00       	push   $0x44b
+f0102682:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0102687:	e8 0c da ff ff       	call   f0100098 <_panic>
+		pte = pgdir_walk(pgdir, (void *) va, 1);
+f010268c:	83 ec 04             	sub    $0x4,%esp
+f010268f:	6a 01                	push   $0x1
+f0102691:	53                   	push   %ebx
+f0102692:	ff 75 e0             	push   -0x20(%ebp)
+f0102695:	e8 c6 fe ff ff       	call   f0102560 <pgdir_walk>
+		if (!pte)
+f010269a:	83 c4 10             	add    $0x10,%esp
+f010269d:	85 c0                	test   %eax,%eax
+f010269f:	74 6e                	je     f010270f <boot_map_region+0x110>
+		*pte = pa|perm|PTE_P;
+f01026a1:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01026a4:	09 f2                	or     %esi,%edx
+f01026a6:	83 ca 01             	or     $0x1,%edx
+f01026a9:	89 10                	mov    %edx,(%eax)
+	for (i = 0; i < n; i++, va += PGSIZE, pa += PGSIZE) {
+f01026ab:	83 c7 01             	add    $0x1,%edi
+f01026ae:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01026b4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01026ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01026bd:	39 c7                	cmp    %eax,%edi
+f01026bf:	7d 63                	jge    f0102724 <boot_map_region+0x125>
+		if (page_pse && va % PTSIZE == 0 && pa % PTSIZE == 0
+f01026c1:	80 3d 70 89 61 f0 00 	cmpb   $0x0,0xf0618970
+f01026c8:	74 c2                	je     f010268c <boot_map_region+0x8d>
+f01026ca:	89 d8                	mov    %ebx,%eax
+f01026cc:	09 f0                	or     %esi,%eax
+f01026ce:	a9 ff ff 3f 00       	test   $0x3fffff,%eax
+f01026d3:	75 b7                	jne    f010268c <boot_map_region+0x8d>
+		    && n - i >= NPTENTRIES && !(pgdir[PDX(va)] & PTE_P)) {
+f01026d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01026d8:	29 f8                	sub    %edi,%eax
+f01026da:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+f01026df:	7e ab                	jle    f010268c <boot_map_region+0x8d>
+f01026e1:	89 d8                	mov    %ebx,%eax
+f01026e3:	c1 e8 16             	shr    $0x16,%eax
+f01026e6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f01026e9:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f01026ec:	f6 00 01             	testb  $0x1,(%eax)
+f01026ef:	75 9b                	jne    f010268c <boot_map_region+0x8d>
+			pgdir[PDX(va)] = pa|perm|PTE_P|PTE_PS;
+f01026f1:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01026f4:	09 f2                	or     %esi,%edx
+f01026f6:	80 ca 81             	or     $0x81,%dl
+f01026f9:	89 10                	mov    %edx,(%eax)
+			i += NPTENTRIES - 1;
+f01026fb:	81 c7 ff 03 00 00    	add    $0x3ff,%edi
+			va += PTSIZE - PGSIZE;
+f0102701:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			pa += PTSIZE - PGSIZE;
+f0102707:	81 c6 00 f0 3f 00    	add    $0x3ff000,%esi
+			continue;
+f010270d:	eb 9c                	jmp    f01026ab <boot_map_region+0xac>
+			panic("pgdir_walk failed to get a pte for va %08x", va);
+f010270f:	53                   	push   %ebx
+f0102710:	68 bc ce 10 f0       	push   $0xf010cebc
+f0102715:	68 5e 04 00 00       	push   $0x45e
+f010271a:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010271f:	e8 74 d9 ff ff       	call   f0100098 <_panic>
+}
+f0102724:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102727:	5b                   	pop    %ebx
+f0102728:	5e                   	pop    %esi
+f0102729:	5f                   	pop    %edi
+f010272a:	5d                   	pop    %ebp
+f010272b:	c3                   	ret
+
+f010272c <page_lookup>:
+{
+f010272c:	55                   	push   %ebp
+f010272d:	89 e5                	mov    %esp,%ebp
+f010272f:	53                   	push   %ebx
+f0102730:	83 ec 08             	sub    $0x8,%esp
+f0102733:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	pte = pgdir_walk(pgdir, va, 0);
+f0102736:	6a 00                	push   $0x0
+f0102738:	ff 75 0c             	push   0xc(%ebp)
+f010273b:	ff 75 08             	push   0x8(%ebp)
+f010273e:	e8 1d fe ff ff       	call   f0102560 <pgdir_walk>
+	if (!pte || !(*pte & PTE_P) || (*pte & PTE_PS))
+f0102743:	83 c4 10             	add    $0x10,%esp
+f0102746:	85 c0                	test   %eax,%eax
+f0102748:	74 2b                	je     f0102775 <page_lookup+0x49>
+f010274a:	8b 10                	mov    (%eax),%edx
+f010274c:	81 e2 81 00 00 00    	and    $0x81,%edx
+f0102752:	83 fa 01             	cmp    $0x1,%edx
+f0102755:	75 37                	jne    f010278e <page_lookup+0x62>
+	if (pte_store)
+f0102757:	85 db                	test   %ebx,%ebx
+f0102759:	74 02                	je     f010275d <page_lookup+0x31>
+		*pte_store = pte;
+f010275b:	89 03                	mov    %eax,(%ebx)
+}
+
+static inline struct PageInfo*
+pa2page(physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f010275d:	8b 00                	mov    (%eax),%eax
+f010275f:	c1 e8 0c             	shr    $0xc,%eax
+f0102762:	3b 05 78 89 61 f0    	cmp    0xf0618978,%eax
+f0102768:	73 10                	jae    f010277a <page_lookup+0x4e>
+		panic("pa2page called with invalid pa");
+	return &pages[PGNUM(pa)];
+f010276a:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f010276d:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0102772:	8d 04 90             	lea    (%eax,%edx,4),%eax
+}
+f0102775:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0102778:	c9                   	leave
+f0102779:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f010277a:	83 ec 04             	sub    $0x4,%esp
+f010277d:	68 e8 ce 10 f0       	push   $0xf010cee8
+f0102782:	6a 76                	push   $0x76
+f0102784:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0102789:	e8 0a d9 ff ff       	call   f0100098 <_panic>
+		return NULL;
+f010278e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102793:	eb e0                	jmp    f0102775 <page_lookup+0x49>
+
+f0102795 <tlb_invalidate>:
+{
+f0102795:	55                   	push   %ebp
+f0102796:	89 e5                	mov    %esp,%ebp
+f0102798:	57                   	push   %edi
+f0102799:	56                   	push   %esi
+f010279a:	53                   	push   %ebx
+f010279b:	83 ec 0c             	sub    $0xc,%esp
+f010279e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (!curenv || curenv->env_pgdir == pgdir)
+f01027a1:	e8 9e 84 00 00       	call   f010ac44 <cpunum>
+f01027a6:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01027ac:	83 b8 28 90 61 f0 00 	cmpl   $0x0,-0xf9e6fd8(%eax)
+f01027b3:	74 19                	je     f01027ce <tlb_invalidate+0x39>
+f01027b5:	e8 8a 84 00 00       	call   f010ac44 <cpunum>
+f01027ba:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01027c0:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01027c6:	39 b0 30 01 00 00    	cmp    %esi,0x130(%eax)
+f01027cc:	75 06                	jne    f01027d4 <tlb_invalidate+0x3f>
+	__asm __volatile("invlpg (%0)" : : "r" (addr) : "memory");
+f01027ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01027d1:	0f 01 38             	invlpg (%eax)
+// Full memory barrier: no load after it is performed before a store
+// ahead of it.  A locked instruction works on every CPU, unlike mfence.
+static inline void
+mb(void)
+{
+	asm volatile("lock; addl $0, 0(%%esp)" : : : "cc", "memory");
+f01027d4:	f0 83 04 24 00       	lock addl $0x0,(%esp)
+	mask = 0;
+f01027d9:	bf 00 00 00 00       	mov    $0x0,%edi
+	for (c = cpus; c < cpus + ncpu; c++)
+f01027de:	bb 20 90 61 f0       	mov    $0xf0619020,%ebx
+f01027e3:	eb 06                	jmp    f01027eb <tlb_invalidate+0x56>
+f01027e5:	81 c3 bc 00 00 00    	add    $0xbc,%ebx
+f01027eb:	69 05 04 96 61 f0 bc 	imul   $0xbc,0xf0619604,%eax
+f01027f2:	00 00 00 
+f01027f5:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f01027fa:	39 c3                	cmp    %eax,%ebx
+f01027fc:	73 3f                	jae    f010283d <tlb_invalidate+0xa8>
+		if (c != thiscpu && c->cpu_env && c->cpu_env->env_pgdir == pgdir)
+f01027fe:	e8 41 84 00 00       	call   f010ac44 <cpunum>
+f0102803:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0102809:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f010280e:	39 c3                	cmp    %eax,%ebx
+f0102810:	74 d3                	je     f01027e5 <tlb_invalidate+0x50>
+f0102812:	8b 43 08             	mov    0x8(%ebx),%eax
+f0102815:	85 c0                	test   %eax,%eax
+f0102817:	74 cc                	je     f01027e5 <tlb_invalidate+0x50>
+f0102819:	39 b0 30 01 00 00    	cmp    %esi,0x130(%eax)
+f010281f:	75 c4                	jne    f01027e5 <tlb_invalidate+0x50>
+			mask |= 1 << (c - cpus);
+f0102821:	89 d9                	mov    %ebx,%ecx
+f0102823:	81 e9 20 90 61 f0    	sub    $0xf0619020,%ecx
+f0102829:	c1 f9 02             	sar    $0x2,%ecx
+f010282c:	69 c9 cf 46 7d 67    	imul   $0x677d46cf,%ecx,%ecx
+f0102832:	b8 01 00 00 00       	mov    $0x1,%eax
+f0102837:	d3 e0                	shl    %cl,%eax
+f0102839:	09 c7                	or     %eax,%edi
+f010283b:	eb a8                	jmp    f01027e5 <tlb_invalidate+0x50>
+	if (!mask)
+f010283d:	85 ff                	test   %edi,%edi
+f010283f:	75 08                	jne    f0102849 <tlb_invalidate+0xb4>
+}
+f0102841:	83 c4 0c             	add    $0xc,%esp
+f0102844:	5b                   	pop    %ebx
+f0102845:	5e                   	pop    %esi
+f0102846:	5f                   	pop    %edi
+f0102847:	5d                   	pop    %ebp
+f0102848:	c3                   	ret
+	b = &tlb_batch[cpunum()];
+f0102849:	e8 f6 83 00 00       	call   f010ac44 <cpunum>
+	b->tb_cpus |= mask;
+f010284e:	69 d0 b0 00 00 00    	imul   $0xb0,%eax,%edx
+f0102854:	09 ba e4 12 61 f0    	or     %edi,-0xf9eed1c(%edx)
+	if (b->tb_nva < TLB_BATCH_MAX) {
+f010285a:	8b 92 60 12 61 f0    	mov    -0xf9eeda0(%edx),%edx
+f0102860:	83 fa 0f             	cmp    $0xf,%edx
+f0102863:	7f 27                	jg     f010288c <tlb_invalidate+0xf7>
+		b->tb_pgdir[b->tb_nva] = pgdir;
+f0102865:	6b c8 2c             	imul   $0x2c,%eax,%ecx
+f0102868:	01 d1                	add    %edx,%ecx
+f010286a:	89 34 8d 64 12 61 f0 	mov    %esi,-0xf9eed9c(,%ecx,4)
+		b->tb_va[b->tb_nva] = (uintptr_t) va;
+f0102871:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0102874:	89 3c 8d a4 12 61 f0 	mov    %edi,-0xf9eed5c(,%ecx,4)
+		b->tb_nva++;
+f010287b:	69 c0 b0 00 00 00    	imul   $0xb0,%eax,%eax
+f0102881:	83 c2 01             	add    $0x1,%edx
+f0102884:	89 90 60 12 61 f0    	mov    %edx,-0xf9eeda0(%eax)
+f010288a:	eb b5                	jmp    f0102841 <tlb_invalidate+0xac>
+	if (b->tb_nva <= TLB_BATCH_MAX)
+f010288c:	83 fa 10             	cmp    $0x10,%edx
+f010288f:	7f b0                	jg     f0102841 <tlb_invalidate+0xac>
+f0102891:	eb e8                	jmp    f010287b <tlb_invalidate+0xe6>
+
+f0102893 <page_remove>:
+{
+f0102893:	55                   	push   %ebp
+f0102894:	89 e5                	mov    %esp,%ebp
+f0102896:	57                   	push   %edi
+f0102897:	56                   	push   %esi
+f0102898:	53                   	push   %ebx
+f0102899:	83 ec 1c             	sub    $0x1c,%esp
+f010289c:	8b 75 08             	mov    0x8(%ebp),%esi
+f010289f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	pde = &pgdir[PDX(va)];
+f01028a2:	89 f8                	mov    %edi,%eax
+f01028a4:	c1 e8 16             	shr    $0x16,%eax
+f01028a7:	8d 14 86             	lea    (%esi,%eax,4),%edx
+	if ((*pde & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS)) {
+f01028aa:	8b 02                	mov    (%edx),%eax
+f01028ac:	89 c1                	mov    %eax,%ecx
+f01028ae:	81 e1 81 00 00 00    	and    $0x81,%ecx
+f01028b4:	81 f9 81 00 00 00    	cmp    $0x81,%ecx
+f01028ba:	74 41                	je     f01028fd <page_remove+0x6a>
+	pp = page_lookup(pgdir, va, &pte);
+f01028bc:	83 ec 04             	sub    $0x4,%esp
+f01028bf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01028c2:	50                   	push   %eax
+f01028c3:	57                   	push   %edi
+f01028c4:	56                   	push   %esi
+f01028c5:	e8 62 fe ff ff       	call   f010272c <page_lookup>
+f01028ca:	89 c3                	mov    %eax,%ebx
+	if (!pp)
+f01028cc:	83 c4 10             	add    $0x10,%esp
+f01028cf:	85 c0                	test   %eax,%eax
+f01028d1:	74 22                	je     f01028f5 <page_remove+0x62>
+	*pte = 0;
+f01028d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01028d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	tlb_invalidate(pgdir, va);
+f01028dc:	83 ec 08             	sub    $0x8,%esp
+f01028df:	57                   	push   %edi
+f01028e0:	56                   	push   %esi
+f01028e1:	e8 af fe ff ff       	call   f0102795 <tlb_invalidate>
+	page_release(pp, 0);
+f01028e6:	ba 00 00 00 00       	mov    $0x0,%edx
+f01028eb:	89 d8                	mov    %ebx,%eax
+f01028ed:	e8 25 f8 ff ff       	call   f0102117 <page_release>
+f01028f2:	83 c4 10             	add    $0x10,%esp
+}
+f01028f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01028f8:	5b                   	pop    %ebx
+f01028f9:	5e                   	pop    %esi
+f01028fa:	5f                   	pop    %edi
+f01028fb:	5d                   	pop    %ebp
+f01028fc:	c3                   	ret
+	if (PGNUM(pa) >= npages)
+f01028fd:	c1 e8 0c             	shr    $0xc,%eax
+f0102900:	3b 05 78 89 61 f0    	cmp    0xf0618978,%eax
+f0102906:	73 2c                	jae    f0102934 <page_remove+0xa1>
+	return &pages[PGNUM(pa)];
+f0102908:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+f010290b:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0102910:	8d 1c 88             	lea    (%eax,%ecx,4),%ebx
+		*pde = 0;
+f0102913:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+		tlb_invalidate(pgdir, va);
+f0102919:	83 ec 08             	sub    $0x8,%esp
+f010291c:	57                   	push   %edi
+f010291d:	56                   	push   %esi
+f010291e:	e8 72 fe ff ff       	call   f0102795 <tlb_invalidate>
+		page_release(pp, PAGE_LARGE_ORDER);
+f0102923:	ba 0a 00 00 00       	mov    $0xa,%edx
+f0102928:	89 d8                	mov    %ebx,%eax
+f010292a:	e8 e8 f7 ff ff       	call   f0102117 <page_release>
+		return;
+f010292f:	83 c4 10             	add    $0x10,%esp
+f0102932:	eb c1                	jmp    f01028f5 <page_remove+0x62>
+		panic("pa2page called with invalid pa");
+f0102934:	83 ec 04             	sub    $0x4,%esp
+f0102937:	68 e8 ce 10 f0       	push   $0xf010cee8
+f010293c:	6a 76                	push   $0x76
+f010293e:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0102943:	e8 50 d7 ff ff       	call   f0100098 <_panic>
+
+f0102948 <page_insert>:
+{
+f0102948:	55                   	push   %ebp
+f0102949:	89 e5                	mov    %esp,%ebp
+f010294b:	57                   	push   %edi
+f010294c:	56                   	push   %esi
+f010294d:	53                   	push   %ebx
+f010294e:	83 ec 10             	sub    $0x10,%esp
+f0102951:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0102954:	8b 7d 10             	mov    0x10(%ebp),%edi
+	pte = pgdir_walk(pgdir, va, 1);
+f0102957:	6a 01                	push   $0x1
+f0102959:	57                   	push   %edi
+f010295a:	ff 75 08             	push   0x8(%ebp)
+f010295d:	e8 fe fb ff ff       	call   f0102560 <pgdir_walk>
+	if (!pte)
+f0102962:	83 c4 10             	add    $0x10,%esp
+f0102965:	85 c0                	test   %eax,%eax
+f0102967:	74 50                	je     f01029b9 <page_insert+0x71>
+f0102969:	89 c6                	mov    %eax,%esi
+	if (*pte & PTE_PS)
+f010296b:	f6 00 80             	testb  $0x80,(%eax)
+f010296e:	75 50                	jne    f01029c0 <page_insert+0x78>
+	page_incref(pp);
+f0102970:	83 ec 0c             	sub    $0xc,%esp
+f0102973:	53                   	push   %ebx
+f0102974:	e8 10 f7 ff ff       	call   f0102089 <page_incref>
+	if (*pte)
+f0102979:	83 c4 10             	add    $0x10,%esp
+f010297c:	83 3e 00             	cmpl   $0x0,(%esi)
+f010297f:	75 27                	jne    f01029a8 <page_insert+0x60>
+	return (pp - pages) << PGSHIFT;
+f0102981:	2b 1d 80 89 61 f0    	sub    0xf0618980,%ebx
+f0102987:	c1 fb 02             	sar    $0x2,%ebx
+f010298a:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+f0102990:	c1 e3 0c             	shl    $0xc,%ebx
+	*pte = page2pa(pp)|perm|PTE_P;
+f0102993:	0b 5d 14             	or     0x14(%ebp),%ebx
+f0102996:	83 cb 01             	or     $0x1,%ebx
+f0102999:	89 1e                	mov    %ebx,(%esi)
+	return 0;
+f010299b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01029a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01029a3:	5b                   	pop    %ebx
+f01029a4:	5e                   	pop    %esi
+f01029a5:	5f                   	pop    %edi
+f01029a6:	5d                   	pop    %ebp
+f01029a7:	c3                   	ret
+		page_remove(pgdir, va);
+f01029a8:	83 ec 08             	sub    $0x8,%esp
+f01029ab:	57                   	push   %edi
+f01029ac:	ff 75 08             	push   0x8(%ebp)
+f01029af:	e8 df fe ff ff       	call   f0102893 <page_remove>
+f01029b4:	83 c4 10             	add    $0x10,%esp
+f01029b7:	eb c8                	jmp    f0102981 <page_insert+0x39>
+		return -E_NO_MEM;
+f01029b9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01029be:	eb e0                	jmp    f01029a0 <page_insert+0x58>
+		return -E_INVAL;
+f01029c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01029c5:	eb d9                	jmp    f01029a0 <page_insert+0x58>
+
+f01029c7 <page_insert_large>:
+{
+f01029c7:	55                   	push   %ebp
+f01029c8:	89 e5                	mov    %esp,%ebp
+f01029ca:	57                   	push   %edi
+f01029cb:	56                   	push   %esi
+f01029cc:	53                   	push   %ebx
+f01029cd:	83 ec 1c             	sub    $0x1c,%esp
+	assert((uintptr_t) va % PTSIZE == 0);
+f01029d0:	8b 75 10             	mov    0x10(%ebp),%esi
+f01029d3:	f7 c6 ff ff 3f 00    	test   $0x3fffff,%esi
+f01029d9:	75 60                	jne    f0102a3b <page_insert_large+0x74>
+	if (!page_pse)
+f01029db:	80 3d 70 89 61 f0 00 	cmpb   $0x0,0xf0618970
+f01029e2:	0f 84 2f 01 00 00    	je     f0102b17 <page_insert_large+0x150>
+	page_incref(pp);
+f01029e8:	83 ec 0c             	sub    $0xc,%esp
+f01029eb:	ff 75 0c             	push   0xc(%ebp)
+f01029ee:	e8 96 f6 ff ff       	call   f0102089 <page_incref>
+	pde = &pgdir[PDX(va)];
+f01029f3:	8b 45 10             	mov    0x10(%ebp),%eax
+f01029f6:	c1 e8 16             	shr    $0x16,%eax
+f01029f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01029fc:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f01029ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (*pde & PTE_PS)
+f0102a02:	8b 00                	mov    (%eax),%eax
+f0102a04:	83 c4 10             	add    $0x10,%esp
+f0102a07:	a8 80                	test   $0x80,%al
+f0102a09:	75 49                	jne    f0102a54 <page_insert_large+0x8d>
+	else if (*pde & PTE_P) {
+f0102a0b:	a8 01                	test   $0x1,%al
+f0102a0d:	75 56                	jne    f0102a65 <page_insert_large+0x9e>
+f0102a0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0102a12:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0102a18:	c1 f8 02             	sar    $0x2,%eax
+f0102a1b:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102a21:	c1 e0 0c             	shl    $0xc,%eax
+	*pde = page2pa(pp)|perm|PTE_P|PTE_PS;
+f0102a24:	0b 45 14             	or     0x14(%ebp),%eax
+f0102a27:	0c 81                	or     $0x81,%al
+f0102a29:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0102a2c:	89 02                	mov    %eax,(%edx)
+	return 0;
+f0102a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0102a33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102a36:	5b                   	pop    %ebx
+f0102a37:	5e                   	pop    %esi
+f0102a38:	5f                   	pop    %edi
+f0102a39:	5d                   	pop    %ebp
+f0102a3a:	c3                   	ret
+	assert((uintptr_t) va % PTSIZE == 0);
+f0102a3b:	68 06 d9 10 f0       	push   $0xf010d906
+f0102a40:	68 0d d8 10 f0       	push   $0xf010d80d
+f0102a45:	68 0a 05 00 00       	push   $0x50a
+f0102a4a:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0102a4f:	e8 44 d6 ff ff       	call   f0100098 <_panic>
+		page_remove(pgdir, va);
+f0102a54:	83 ec 08             	sub    $0x8,%esp
+f0102a57:	ff 75 10             	push   0x10(%ebp)
+f0102a5a:	51                   	push   %ecx
+f0102a5b:	e8 33 fe ff ff       	call   f0102893 <page_remove>
+f0102a60:	83 c4 10             	add    $0x10,%esp
+f0102a63:	eb aa                	jmp    f0102a0f <page_insert_large+0x48>
+		pa = PTE_ADDR(*pde);
+f0102a65:	89 c7                	mov    %eax,%edi
+f0102a67:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	if (PGNUM(pa) >= npages_lowmem)
+f0102a6d:	c1 e8 0c             	shr    $0xc,%eax
+f0102a70:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0102a73:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0102a79:	73 0e                	jae    f0102a89 <page_insert_large+0xc2>
+	return (void *)(pa + KERNBASE);
+f0102a7b:	8d 9f 00 00 00 f0    	lea    -0x10000000(%edi),%ebx
+		for (i = 0; i < NPTENTRIES; i++)
+f0102a81:	81 ef 00 f0 ff 0f    	sub    $0xffff000,%edi
+f0102a87:	eb 1e                	jmp    f0102aa7 <page_insert_large+0xe0>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102a89:	57                   	push   %edi
+f0102a8a:	68 1c c0 10 f0       	push   $0xf010c01c
+f0102a8f:	68 14 05 00 00       	push   $0x514
+f0102a94:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0102a99:	e8 fa d5 ff ff       	call   f0100098 <_panic>
+f0102a9e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0102aa4:	83 c3 04             	add    $0x4,%ebx
+f0102aa7:	39 fb                	cmp    %edi,%ebx
+f0102aa9:	74 16                	je     f0102ac1 <page_insert_large+0xfa>
+			if (pt[i] & PTE_P)
+f0102aab:	f6 03 01             	testb  $0x1,(%ebx)
+f0102aae:	74 ee                	je     f0102a9e <page_insert_large+0xd7>
+				page_remove(pgdir, va + i * PGSIZE);
+f0102ab0:	83 ec 08             	sub    $0x8,%esp
+f0102ab3:	56                   	push   %esi
+f0102ab4:	ff 75 08             	push   0x8(%ebp)
+f0102ab7:	e8 d7 fd ff ff       	call   f0102893 <page_remove>
+f0102abc:	83 c4 10             	add    $0x10,%esp
+f0102abf:	eb dd                	jmp    f0102a9e <page_insert_large+0xd7>
+		*pde = 0;
+f0102ac1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0102ac4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		tlb_invalidate(pgdir, va);
+f0102aca:	83 ec 08             	sub    $0x8,%esp
+f0102acd:	ff 75 10             	push   0x10(%ebp)
+f0102ad0:	ff 75 08             	push   0x8(%ebp)
+f0102ad3:	e8 bd fc ff ff       	call   f0102795 <tlb_invalidate>
+	if (PGNUM(pa) >= npages)
+f0102ad8:	83 c4 10             	add    $0x10,%esp
+f0102adb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0102ade:	3b 05 78 89 61 f0    	cmp    0xf0618978,%eax
+f0102ae4:	73 1d                	jae    f0102b03 <page_insert_large+0x13c>
+	return &pages[PGNUM(pa)];
+f0102ae6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0102ae9:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0102aec:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0102af1:	8d 04 90             	lea    (%eax,%edx,4),%eax
+		page_release(pa2page(pa), 0);
+f0102af4:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102af9:	e8 19 f6 ff ff       	call   f0102117 <page_release>
+f0102afe:	e9 0c ff ff ff       	jmp    f0102a0f <page_insert_large+0x48>
+		panic("pa2page called with invalid pa");
+f0102b03:	83 ec 04             	sub    $0x4,%esp
+f0102b06:	68 e8 ce 10 f0       	push   $0xf010cee8
+f0102b0b:	6a 76                	push   $0x76
+f0102b0d:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0102b12:	e8 81 d5 ff ff       	call   f0100098 <_panic>
+		return -E_NOT_SUPP;
+f0102b17:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+f0102b1c:	e9 12 ff ff ff       	jmp    f0102a33 <page_insert_large+0x6c>
+
+f0102b21 <page_fault_cow>:
+{
+f0102b21:	55                   	push   %ebp
+f0102b22:	89 e5                	mov    %esp,%ebp
+f0102b24:	57                   	push   %edi
+f0102b25:	56                   	push   %esi
+f0102b26:	53                   	push   %ebx
+f0102b27:	83 ec 20             	sub    $0x20,%esp
+f0102b2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	pte = pgdir_walk(pgdir, va, 0);
+f0102b2d:	6a 00                	push   $0x0
+f0102b2f:	ff 75 0c             	push   0xc(%ebp)
+f0102b32:	ff 75 08             	push   0x8(%ebp)
+f0102b35:	e8 26 fa ff ff       	call   f0102560 <pgdir_walk>
+	if (!pte || (*pte & (PTE_P|PTE_U|PTE_PS|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+f0102b3a:	83 c4 10             	add    $0x10,%esp
+f0102b3d:	85 c0                	test   %eax,%eax
+f0102b3f:	0f 84 5a 01 00 00    	je     f0102c9f <page_fault_cow+0x17e>
+f0102b45:	89 c7                	mov    %eax,%edi
+f0102b47:	8b 00                	mov    (%eax),%eax
+f0102b49:	89 c2                	mov    %eax,%edx
+f0102b4b:	81 e2 85 08 00 00    	and    $0x885,%edx
+f0102b51:	81 fa 05 08 00 00    	cmp    $0x805,%edx
+f0102b57:	0f 85 49 01 00 00    	jne    f0102ca6 <page_fault_cow+0x185>
+	if (PGNUM(pa) >= npages)
+f0102b5d:	89 c2                	mov    %eax,%edx
+f0102b5f:	c1 ea 0c             	shr    $0xc,%edx
+f0102b62:	3b 15 78 89 61 f0    	cmp    0xf0618978,%edx
+f0102b68:	0f 83 ca 00 00 00    	jae    f0102c38 <page_fault_cow+0x117>
+	return &pages[PGNUM(pa)];
+f0102b6e:	8d 0c 52             	lea    (%edx,%edx,2),%ecx
+f0102b71:	8b 15 80 89 61 f0    	mov    0xf0618980,%edx
+f0102b77:	8d 34 8a             	lea    (%edx,%ecx,4),%esi
+	if (zero_only && pp != zero_page)
+f0102b7a:	84 db                	test   %bl,%bl
+f0102b7c:	74 0c                	je     f0102b8a <page_fault_cow+0x69>
+f0102b7e:	39 35 74 89 61 f0    	cmp    %esi,0xf0618974
+f0102b84:	0f 85 23 01 00 00    	jne    f0102cad <page_fault_cow+0x18c>
+	perm = ((*pte & PTE_SYSCALL) & ~PTE_COW) | PTE_W;
+f0102b8a:	25 05 06 00 00       	and    $0x605,%eax
+f0102b8f:	89 c3                	mov    %eax,%ebx
+f0102b91:	83 cb 02             	or     $0x2,%ebx
+	spin_lock(&page_lock);
+f0102b94:	83 ec 0c             	sub    $0xc,%esp
+f0102b97:	68 e0 93 11 f0       	push   $0xf01193e0
+f0102b9c:	e8 32 83 00 00       	call   f010aed3 <spin_lock>
+	sole = (pp->pp_ref == 1);
+f0102ba1:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+f0102ba5:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+	spin_unlock(&page_lock);
+f0102ba9:	c7 04 24 e0 93 11 f0 	movl   $0xf01193e0,(%esp)
+f0102bb0:	e8 3a 84 00 00       	call   f010afef <spin_unlock>
+	if (sole) {
+f0102bb5:	83 c4 10             	add    $0x10,%esp
+f0102bb8:	66 83 7d e4 01       	cmpw   $0x1,-0x1c(%ebp)
+f0102bbd:	0f 84 89 00 00 00    	je     f0102c4c <page_fault_cow+0x12b>
+	if (pp == zero_page) {
+f0102bc3:	39 35 74 89 61 f0    	cmp    %esi,0xf0618974
+f0102bc9:	0f 84 ad 00 00 00    	je     f0102c7c <page_fault_cow+0x15b>
+	np = page_alloc(ALLOC_HIGH);
+f0102bcf:	83 ec 0c             	sub    $0xc,%esp
+f0102bd2:	6a 02                	push   $0x2
+f0102bd4:	e8 f1 f6 ff ff       	call   f01022ca <page_alloc>
+f0102bd9:	89 c7                	mov    %eax,%edi
+	if (!np)
+f0102bdb:	83 c4 10             	add    $0x10,%esp
+f0102bde:	85 c0                	test   %eax,%eax
+f0102be0:	0f 84 db 00 00 00    	je     f0102cc1 <page_fault_cow+0x1a0>
+	src = kmap(pp);
+f0102be6:	83 ec 0c             	sub    $0xc,%esp
+f0102be9:	56                   	push   %esi
+f0102bea:	e8 b4 f5 ff ff       	call   f01021a3 <kmap>
+f0102bef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	dst = kmap(np);
+f0102bf2:	89 3c 24             	mov    %edi,(%esp)
+f0102bf5:	e8 a9 f5 ff ff       	call   f01021a3 <kmap>
+f0102bfa:	89 c6                	mov    %eax,%esi
+	memcpy(dst, src, PGSIZE);
+f0102bfc:	83 c4 0c             	add    $0xc,%esp
+f0102bff:	68 00 10 00 00       	push   $0x1000
+f0102c04:	ff 75 e4             	push   -0x1c(%ebp)
+f0102c07:	50                   	push   %eax
+f0102c08:	e8 88 7a 00 00       	call   f010a695 <memcpy>
+	kunmap(dst);
+f0102c0d:	89 34 24             	mov    %esi,(%esp)
+f0102c10:	e8 38 f6 ff ff       	call   f010224d <kunmap>
+	kunmap(src);
+f0102c15:	83 c4 04             	add    $0x4,%esp
+f0102c18:	ff 75 e4             	push   -0x1c(%ebp)
+f0102c1b:	e8 2d f6 ff ff       	call   f010224d <kunmap>
+	return page_insert(pgdir, np, va, perm);
+f0102c20:	53                   	push   %ebx
+f0102c21:	ff 75 0c             	push   0xc(%ebp)
+f0102c24:	57                   	push   %edi
+f0102c25:	ff 75 08             	push   0x8(%ebp)
+f0102c28:	e8 1b fd ff ff       	call   f0102948 <page_insert>
+f0102c2d:	83 c4 20             	add    $0x20,%esp
+}
+f0102c30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102c33:	5b                   	pop    %ebx
+f0102c34:	5e                   	pop    %esi
+f0102c35:	5f                   	pop    %edi
+f0102c36:	5d                   	pop    %ebp
+f0102c37:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f0102c38:	83 ec 04             	sub    $0x4,%esp
+f0102c3b:	68 e8 ce 10 f0       	push   $0xf010cee8
+f0102c40:	6a 76                	push   $0x76
+f0102c42:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0102c47:	e8 4c d4 ff ff       	call   f0100098 <_panic>
+	return (pp - pages) << PGSHIFT;
+f0102c4c:	89 f0                	mov    %esi,%eax
+f0102c4e:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0102c54:	c1 f8 02             	sar    $0x2,%eax
+f0102c57:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102c5d:	c1 e0 0c             	shl    $0xc,%eax
+		*pte = page2pa(pp) | perm;
+f0102c60:	09 d8                	or     %ebx,%eax
+f0102c62:	89 07                	mov    %eax,(%edi)
+		tlb_invalidate(pgdir, va);
+f0102c64:	83 ec 08             	sub    $0x8,%esp
+f0102c67:	ff 75 0c             	push   0xc(%ebp)
+f0102c6a:	ff 75 08             	push   0x8(%ebp)
+f0102c6d:	e8 23 fb ff ff       	call   f0102795 <tlb_invalidate>
+		return 0;
+f0102c72:	83 c4 10             	add    $0x10,%esp
+f0102c75:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102c7a:	eb b4                	jmp    f0102c30 <page_fault_cow+0x10f>
+		if (!(np = page_alloc(ALLOC_ZERO|ALLOC_HIGH)))
+f0102c7c:	83 ec 0c             	sub    $0xc,%esp
+f0102c7f:	6a 03                	push   $0x3
+f0102c81:	e8 44 f6 ff ff       	call   f01022ca <page_alloc>
+f0102c86:	83 c4 10             	add    $0x10,%esp
+f0102c89:	85 c0                	test   %eax,%eax
+f0102c8b:	74 2a                	je     f0102cb7 <page_fault_cow+0x196>
+		return page_insert(pgdir, np, va, perm);
+f0102c8d:	53                   	push   %ebx
+f0102c8e:	ff 75 0c             	push   0xc(%ebp)
+f0102c91:	50                   	push   %eax
+f0102c92:	ff 75 08             	push   0x8(%ebp)
+f0102c95:	e8 ae fc ff ff       	call   f0102948 <page_insert>
+f0102c9a:	83 c4 10             	add    $0x10,%esp
+f0102c9d:	eb 91                	jmp    f0102c30 <page_fault_cow+0x10f>
+		return -E_INVAL;
+f0102c9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0102ca4:	eb 8a                	jmp    f0102c30 <page_fault_cow+0x10f>
+f0102ca6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0102cab:	eb 83                	jmp    f0102c30 <page_fault_cow+0x10f>
+		return -E_INVAL;
+f0102cad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0102cb2:	e9 79 ff ff ff       	jmp    f0102c30 <page_fault_cow+0x10f>
+			return -E_NO_MEM;
+f0102cb7:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0102cbc:	e9 6f ff ff ff       	jmp    f0102c30 <page_fault_cow+0x10f>
+		return -E_NO_MEM;
+f0102cc1:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0102cc6:	e9 65 ff ff ff       	jmp    f0102c30 <page_fault_cow+0x10f>
+
+f0102ccb <user_mem_check_locked>:
+{
+f0102ccb:	55                   	push   %ebp
+f0102ccc:	89 e5                	mov    %esp,%ebp
+f0102cce:	57                   	push   %edi
+f0102ccf:	56                   	push   %esi
+f0102cd0:	53                   	push   %ebx
+f0102cd1:	83 ec 1c             	sub    $0x1c,%esp
+f0102cd4:	89 c6                	mov    %eax,%esi
+f0102cd6:	89 d3                	mov    %edx,%ebx
+f0102cd8:	8b 7d 08             	mov    0x8(%ebp),%edi
+	for (; len > 0; len--, va++) {
+f0102cdb:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+f0102cde:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			env_region_fault(env, (uintptr_t) va, perm & PTE_W);
+f0102ce1:	89 f8                	mov    %edi,%eax
+f0102ce3:	d1 e8                	shr    %eax
+f0102ce5:	83 e0 01             	and    $0x1,%eax
+f0102ce8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (; len > 0; len--, va++) {
+f0102ceb:	eb 32                	jmp    f0102d1f <user_mem_check_locked+0x54>
+		} else if ((perm & PTE_W) && pte && (*pte & PTE_COW)
+f0102ced:	f7 c7 02 00 00 00    	test   $0x2,%edi
+f0102cf3:	0f 85 84 00 00 00    	jne    f0102d7d <user_mem_check_locked+0xb2>
+		if ((uintptr_t) va >= ULIM || !pte || !(*pte & (perm | PTE_P))) {
+f0102cf9:	89 da                	mov    %ebx,%edx
+f0102cfb:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f0102d01:	0f 87 df 00 00 00    	ja     f0102de6 <user_mem_check_locked+0x11b>
+f0102d07:	85 c0                	test   %eax,%eax
+f0102d09:	0f 84 d7 00 00 00    	je     f0102de6 <user_mem_check_locked+0x11b>
+f0102d0f:	89 f9                	mov    %edi,%ecx
+f0102d11:	83 c9 01             	or     $0x1,%ecx
+f0102d14:	23 08                	and    (%eax),%ecx
+f0102d16:	0f 84 ca 00 00 00    	je     f0102de6 <user_mem_check_locked+0x11b>
+	for (; len > 0; len--, va++) {
+f0102d1c:	83 c3 01             	add    $0x1,%ebx
+f0102d1f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0102d22:	39 c3                	cmp    %eax,%ebx
+f0102d24:	0f 84 a5 00 00 00    	je     f0102dcf <user_mem_check_locked+0x104>
+		pte = pgdir_walk(env->env_pgdir, va, 0);
+f0102d2a:	83 ec 04             	sub    $0x4,%esp
+f0102d2d:	6a 00                	push   $0x0
+f0102d2f:	53                   	push   %ebx
+f0102d30:	ff b6 30 01 00 00    	push   0x130(%esi)
+f0102d36:	e8 25 f8 ff ff       	call   f0102560 <pgdir_walk>
+		if ((!pte || !(*pte & PTE_P)) && (uintptr_t) va < UTOP) {
+f0102d3b:	83 c4 10             	add    $0x10,%esp
+f0102d3e:	85 c0                	test   %eax,%eax
+f0102d40:	0f 84 90 00 00 00    	je     f0102dd6 <user_mem_check_locked+0x10b>
+f0102d46:	8b 10                	mov    (%eax),%edx
+f0102d48:	f6 c2 01             	test   $0x1,%dl
+f0102d4b:	75 a0                	jne    f0102ced <user_mem_check_locked+0x22>
+f0102d4d:	89 d9                	mov    %ebx,%ecx
+f0102d4f:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0102d55:	77 96                	ja     f0102ced <user_mem_check_locked+0x22>
+			env_region_fault(env, (uintptr_t) va, perm & PTE_W);
+f0102d57:	83 ec 04             	sub    $0x4,%esp
+f0102d5a:	ff 75 e0             	push   -0x20(%ebp)
+f0102d5d:	51                   	push   %ecx
+f0102d5e:	56                   	push   %esi
+f0102d5f:	e8 7e 39 00 00       	call   f01066e2 <env_region_fault>
+			pte = pgdir_walk(env->env_pgdir, va, 0);
+f0102d64:	83 c4 0c             	add    $0xc,%esp
+f0102d67:	6a 00                	push   $0x0
+f0102d69:	53                   	push   %ebx
+f0102d6a:	ff b6 30 01 00 00    	push   0x130(%esi)
+f0102d70:	e8 eb f7 ff ff       	call   f0102560 <pgdir_walk>
+f0102d75:	83 c4 10             	add    $0x10,%esp
+f0102d78:	e9 7c ff ff ff       	jmp    f0102cf9 <user_mem_check_locked+0x2e>
+		} else if ((perm & PTE_W) && pte && (*pte & PTE_COW)
+f0102d7d:	f6 c6 08             	test   $0x8,%dh
+f0102d80:	0f 84 73 ff ff ff    	je     f0102cf9 <user_mem_check_locked+0x2e>
+			   && (uintptr_t) va < UTOP) {
+f0102d86:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0102d8c:	0f 87 67 ff ff ff    	ja     f0102cf9 <user_mem_check_locked+0x2e>
+			page_fault_cow(env->env_pgdir, ROUNDDOWN((void *) va, PGSIZE), !env->env_kernel_cow);
+f0102d92:	83 ec 04             	sub    $0x4,%esp
+f0102d95:	0f b6 86 98 01 00 00 	movzbl 0x198(%esi),%eax
+f0102d9c:	83 f0 01             	xor    $0x1,%eax
+f0102d9f:	0f b6 c0             	movzbl %al,%eax
+f0102da2:	50                   	push   %eax
+f0102da3:	89 d8                	mov    %ebx,%eax
+f0102da5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0102daa:	50                   	push   %eax
+f0102dab:	ff b6 30 01 00 00    	push   0x130(%esi)
+f0102db1:	e8 6b fd ff ff       	call   f0102b21 <page_fault_cow>
+			pte = pgdir_walk(env->env_pgdir, va, 0);
+f0102db6:	83 c4 0c             	add    $0xc,%esp
+f0102db9:	6a 00                	push   $0x0
+f0102dbb:	53                   	push   %ebx
+f0102dbc:	ff b6 30 01 00 00    	push   0x130(%esi)
+f0102dc2:	e8 99 f7 ff ff       	call   f0102560 <pgdir_walk>
+f0102dc7:	83 c4 10             	add    $0x10,%esp
+f0102dca:	e9 2a ff ff ff       	jmp    f0102cf9 <user_mem_check_locked+0x2e>
+	return 0;
+f0102dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102dd4:	eb 1b                	jmp    f0102df1 <user_mem_check_locked+0x126>
+f0102dd6:	89 d9                	mov    %ebx,%ecx
+		if ((!pte || !(*pte & PTE_P)) && (uintptr_t) va < UTOP) {
+f0102dd8:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0102dde:	0f 86 73 ff ff ff    	jbe    f0102d57 <user_mem_check_locked+0x8c>
+		if ((uintptr_t) va >= ULIM || !pte || !(*pte & (perm | PTE_P))) {
+f0102de4:	89 da                	mov    %ebx,%edx
+			user_mem_check_addr = (uintptr_t) va;
+f0102de6:	89 15 44 12 61 f0    	mov    %edx,0xf0611244
+			return -E_FAULT;
+f0102dec:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+f0102df1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102df4:	5b                   	pop    %ebx
+f0102df5:	5e                   	pop    %esi
+f0102df6:	5f                   	pop    %edi
+f0102df7:	5d                   	pop    %ebp
+f0102df8:	c3                   	ret
+
+f0102df9 <pgdir_copy_cow>:
+{
+f0102df9:	55                   	push   %ebp
+f0102dfa:	89 e5                	mov    %esp,%ebp
+f0102dfc:	57                   	push   %edi
+f0102dfd:	56                   	push   %esi
+f0102dfe:	53                   	push   %ebx
+f0102dff:	83 ec 2c             	sub    $0x2c,%esp
+f0102e02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+f0102e05:	bf 00 00 00 00       	mov    $0x0,%edi
+		dpt = NULL;
+f0102e0a:	89 fe                	mov    %edi,%esi
+f0102e0c:	e9 1f 01 00 00       	jmp    f0102f30 <pgdir_copy_cow+0x137>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102e11:	52                   	push   %edx
+f0102e12:	68 1c c0 10 f0       	push   $0xf010c01c
+f0102e17:	68 72 05 00 00       	push   $0x572
+f0102e1c:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0102e21:	e8 72 d2 ff ff       	call   f0100098 <_panic>
+				dpt = pgdir_walk(dst, va, 1);
+f0102e26:	83 ec 04             	sub    $0x4,%esp
+f0102e29:	6a 01                	push   $0x1
+f0102e2b:	51                   	push   %ecx
+f0102e2c:	ff 75 08             	push   0x8(%ebp)
+f0102e2f:	e8 2c f7 ff ff       	call   f0102560 <pgdir_walk>
+				if (!dpt)
+f0102e34:	83 c4 10             	add    $0x10,%esp
+f0102e37:	85 c0                	test   %eax,%eax
+f0102e39:	0f 84 47 01 00 00    	je     f0102f86 <pgdir_copy_cow+0x18d>
+				dpt -= pteno;
+f0102e3f:	29 f8                	sub    %edi,%eax
+f0102e41:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0102e44:	e9 8c 00 00 00       	jmp    f0102ed5 <pgdir_copy_cow+0xdc>
+					spt[pteno] = PTE_ADDR(pte) | perm;
+f0102e49:	89 d8                	mov    %ebx,%eax
+f0102e4b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0102e50:	09 d0                	or     %edx,%eax
+f0102e52:	89 06                	mov    %eax,(%esi)
+					tlb_invalidate(src, va);
+f0102e54:	83 ec 08             	sub    $0x8,%esp
+f0102e57:	ff 75 dc             	push   -0x24(%ebp)
+f0102e5a:	ff 75 0c             	push   0xc(%ebp)
+f0102e5d:	e8 33 f9 ff ff       	call   f0102795 <tlb_invalidate>
+f0102e62:	83 c4 10             	add    $0x10,%esp
+			page_incref(pa2page(PTE_ADDR(pte)));
+f0102e65:	89 de                	mov    %ebx,%esi
+f0102e67:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0102e6d:	c1 eb 0c             	shr    $0xc,%ebx
+f0102e70:	3b 1d 78 89 61 f0    	cmp    0xf0618978,%ebx
+f0102e76:	0f 83 8f 00 00 00    	jae    f0102f0b <pgdir_copy_cow+0x112>
+f0102e7c:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0102e7f:	8d 14 5b             	lea    (%ebx,%ebx,2),%edx
+f0102e82:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0102e87:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0102e8a:	50                   	push   %eax
+f0102e8b:	e8 f9 f1 ff ff       	call   f0102089 <page_incref>
+			dpt[pteno] = PTE_ADDR(pte) | perm;
+f0102e90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0102e93:	09 f0                	or     %esi,%eax
+f0102e95:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0102e98:	89 04 3a             	mov    %eax,(%edx,%edi,1)
+f0102e9b:	83 c4 10             	add    $0x10,%esp
+		for (pteno = 0; pteno < NPTENTRIES; pteno++) {
+f0102e9e:	83 c7 04             	add    $0x4,%edi
+f0102ea1:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+f0102ea7:	74 76                	je     f0102f1f <pgdir_copy_cow+0x126>
+			pte = spt[pteno];
+f0102ea9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0102eac:	8d 34 38             	lea    (%eax,%edi,1),%esi
+f0102eaf:	8b 1e                	mov    (%esi),%ebx
+			va = PGADDR(pdeno, pteno, 0);
+f0102eb1:	89 f8                	mov    %edi,%eax
+f0102eb3:	c1 e0 0a             	shl    $0xa,%eax
+f0102eb6:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0102eb9:	09 c1                	or     %eax,%ecx
+f0102ebb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+			if (!(pte & PTE_P) || va == (void *) (UXSTACKTOP - PGSIZE))
+f0102ebe:	f6 c3 01             	test   $0x1,%bl
+f0102ec1:	74 db                	je     f0102e9e <pgdir_copy_cow+0xa5>
+f0102ec3:	81 f9 00 f0 bf ee    	cmp    $0xeebff000,%ecx
+f0102ec9:	74 d3                	je     f0102e9e <pgdir_copy_cow+0xa5>
+			if (!dpt) {
+f0102ecb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f0102ecf:	0f 84 51 ff ff ff    	je     f0102e26 <pgdir_copy_cow+0x2d>
+			perm = pte & PTE_SYSCALL;
+f0102ed5:	89 d8                	mov    %ebx,%eax
+f0102ed7:	25 07 0e 00 00       	and    $0xe07,%eax
+f0102edc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			if (!(pte & PTE_SHARE) && (pte & (PTE_W|PTE_COW))) {
+f0102edf:	f6 c7 04             	test   $0x4,%bh
+f0102ee2:	75 81                	jne    f0102e65 <pgdir_copy_cow+0x6c>
+f0102ee4:	f7 c3 02 08 00 00    	test   $0x802,%ebx
+f0102eea:	0f 84 75 ff ff ff    	je     f0102e65 <pgdir_copy_cow+0x6c>
+				perm = (perm & ~PTE_W) | PTE_COW;
+f0102ef0:	89 da                	mov    %ebx,%edx
+f0102ef2:	81 e2 05 06 00 00    	and    $0x605,%edx
+f0102ef8:	80 ce 08             	or     $0x8,%dh
+f0102efb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+				if (perm != (pte & PTE_SYSCALL)) {
+f0102efe:	39 d0                	cmp    %edx,%eax
+f0102f00:	0f 84 5f ff ff ff    	je     f0102e65 <pgdir_copy_cow+0x6c>
+f0102f06:	e9 3e ff ff ff       	jmp    f0102e49 <pgdir_copy_cow+0x50>
+		panic("pa2page called with invalid pa");
+f0102f0b:	83 ec 04             	sub    $0x4,%esp
+f0102f0e:	68 e8 ce 10 f0       	push   $0xf010cee8
+f0102f13:	6a 76                	push   $0x76
+f0102f15:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0102f1a:	e8 79 d1 ff ff       	call   f0100098 <_panic>
+f0102f1f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f0102f22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+f0102f25:	83 c6 01             	add    $0x1,%esi
+f0102f28:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+f0102f2e:	74 4f                	je     f0102f7f <pgdir_copy_cow+0x186>
+		if ((src[pdeno] & (PTE_P|PTE_PS)) != PTE_P)
+f0102f30:	8b 04 b1             	mov    (%ecx,%esi,4),%eax
+f0102f33:	89 c2                	mov    %eax,%edx
+f0102f35:	81 e2 81 00 00 00    	and    $0x81,%edx
+f0102f3b:	83 fa 01             	cmp    $0x1,%edx
+f0102f3e:	75 e5                	jne    f0102f25 <pgdir_copy_cow+0x12c>
+		spt = (pte_t *) KADDR(PTE_ADDR(src[pdeno]));
+f0102f40:	89 c2                	mov    %eax,%edx
+f0102f42:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages_lowmem)
+f0102f48:	c1 e8 0c             	shr    $0xc,%eax
+f0102f4b:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0102f51:	0f 83 ba fe ff ff    	jae    f0102e11 <pgdir_copy_cow+0x18>
+	return (void *)(pa + KERNBASE);
+f0102f57:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+f0102f5d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+		for (pteno = 0; pteno < NPTENTRIES; pteno++) {
+f0102f60:	89 f0                	mov    %esi,%eax
+f0102f62:	c1 e0 16             	shl    $0x16,%eax
+f0102f65:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102f68:	bf 00 00 00 00       	mov    $0x0,%edi
+		dpt = NULL;
+f0102f6d:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0102f74:	89 75 d0             	mov    %esi,-0x30(%ebp)
+f0102f77:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+f0102f7a:	e9 2a ff ff ff       	jmp    f0102ea9 <pgdir_copy_cow+0xb0>
+	return 0;
+f0102f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102f84:	eb 05                	jmp    f0102f8b <pgdir_copy_cow+0x192>
+					return -E_NO_MEM;
+f0102f86:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+}
+f0102f8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102f8e:	5b                   	pop    %ebx
+f0102f8f:	5e                   	pop    %esi
+f0102f90:	5f                   	pop    %edi
+f0102f91:	5d                   	pop    %ebp
+f0102f92:	c3                   	ret
+
+f0102f93 <tlb_shootdown_recv>:
+{
+f0102f93:	55                   	push   %ebp
+f0102f94:	89 e5                	mov    %esp,%ebp
+f0102f96:	57                   	push   %edi
+f0102f97:	56                   	push   %esi
+f0102f98:	53                   	push   %ebx
+f0102f99:	83 ec 1c             	sub    $0x1c,%esp
+	int i, me = cpunum();
+f0102f9c:	e8 a3 7c 00 00       	call   f010ac44 <cpunum>
+	for (b = tlb_batch; b < tlb_batch + ncpu; b++) {
+f0102fa1:	8d 1c 85 88 00 00 00 	lea    0x88(,%eax,4),%ebx
+f0102fa8:	b9 60 12 61 f0       	mov    $0xf0611260,%ecx
+f0102fad:	eb 5e                	jmp    f010300d <tlb_shootdown_recv+0x7a>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0102faf:	52                   	push   %edx
+f0102fb0:	68 e8 cc 10 f0       	push   $0xf010cce8
+f0102fb5:	68 f4 05 00 00       	push   $0x5f4
+f0102fba:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0102fbf:	e8 d4 d0 ff ff       	call   f0100098 <_panic>
+			for (i = 0; i < b->tb_nva; i++)
+f0102fc4:	83 c0 01             	add    $0x1,%eax
+f0102fc7:	39 01                	cmp    %eax,(%ecx)
+f0102fc9:	7e 2c                	jle    f0102ff7 <tlb_shootdown_recv+0x64>
+				if (PADDR(b->tb_pgdir[i]) == rcr3())
+f0102fcb:	8b 54 81 04          	mov    0x4(%ecx,%eax,4),%edx
+	if ((uint32_t)kva < KERNBASE)
+f0102fcf:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0102fd5:	76 d8                	jbe    f0102faf <tlb_shootdown_recv+0x1c>
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+f0102fd7:	0f 20 db             	mov    %cr3,%ebx
+	return (physaddr_t)kva - KERNBASE;
+f0102fda:	81 c2 00 00 00 10    	add    $0x10000000,%edx
+f0102fe0:	39 d3                	cmp    %edx,%ebx
+f0102fe2:	75 e0                	jne    f0102fc4 <tlb_shootdown_recv+0x31>
+	__asm __volatile("invlpg (%0)" : : "r" (addr) : "memory");
+f0102fe4:	8b 54 81 44          	mov    0x44(%ecx,%eax,4),%edx
+f0102fe8:	0f 01 3a             	invlpg (%edx)
+}
+f0102feb:	eb d7                	jmp    f0102fc4 <tlb_shootdown_recv+0x31>
+			for (i = 0; i < b->tb_nva; i++)
+f0102fed:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102ff2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f0102ff5:	eb d0                	jmp    f0102fc7 <tlb_shootdown_recv+0x34>
+f0102ff7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+	asm volatile("lock; xaddl %0, %1" :
+f0102ffa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0102fff:	f0 0f c1 86 a8 00 00 	lock xadd %eax,0xa8(%esi)
+f0103006:	00 
+	for (b = tlb_batch; b < tlb_batch + ncpu; b++) {
+f0103007:	81 c1 b0 00 00 00    	add    $0xb0,%ecx
+f010300d:	69 05 04 96 61 f0 b0 	imul   $0xb0,0xf0619604,%eax
+f0103014:	00 00 00 
+f0103017:	05 60 12 61 f0       	add    $0xf0611260,%eax
+f010301c:	39 c1                	cmp    %eax,%ecx
+f010301e:	73 1e                	jae    f010303e <tlb_shootdown_recv+0xab>
+		if (!xchg(&b->tb_request[me], 0))
+f0103020:	89 ce                	mov    %ecx,%esi
+f0103022:	8d 14 0b             	lea    (%ebx,%ecx,1),%edx
+	asm volatile("lock; xchgl %0, %1" :
+f0103025:	b8 00 00 00 00       	mov    $0x0,%eax
+f010302a:	f0 87 02             	lock xchg %eax,(%edx)
+f010302d:	85 c0                	test   %eax,%eax
+f010302f:	74 d6                	je     f0103007 <tlb_shootdown_recv+0x74>
+		if (b->tb_nva > TLB_BATCH_MAX)
+f0103031:	83 39 10             	cmpl   $0x10,(%ecx)
+f0103034:	7e b7                	jle    f0102fed <tlb_shootdown_recv+0x5a>
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+f0103036:	0f 20 d8             	mov    %cr3,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0103039:	0f 22 d8             	mov    %eax,%cr3
+}
+f010303c:	eb bc                	jmp    f0102ffa <tlb_shootdown_recv+0x67>
+}
+f010303e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103041:	5b                   	pop    %ebx
+f0103042:	5e                   	pop    %esi
+f0103043:	5f                   	pop    %edi
+f0103044:	5d                   	pop    %ebp
+f0103045:	c3                   	ret
+
+f0103046 <tlb_shootdown>:
+{
+f0103046:	55                   	push   %ebp
+f0103047:	89 e5                	mov    %esp,%ebp
+f0103049:	57                   	push   %edi
+f010304a:	56                   	push   %esi
+f010304b:	53                   	push   %ebx
+f010304c:	83 ec 1c             	sub    $0x1c,%esp
+	struct TlbBatch *b = &tlb_batch[cpunum()];
+f010304f:	e8 f0 7b 00 00       	call   f010ac44 <cpunum>
+f0103054:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if (!b->tb_cpus)
+f0103057:	69 c0 b0 00 00 00    	imul   $0xb0,%eax,%eax
+f010305d:	8b b8 e4 12 61 f0    	mov    -0xf9eed1c(%eax),%edi
+f0103063:	85 ff                	test   %edi,%edi
+f0103065:	0f 84 3b 01 00 00    	je     f01031a6 <tlb_shootdown+0x160>
+	for (i = 0; i < ncpu; i++)
+f010306b:	8b 1d 04 96 61 f0    	mov    0xf0619604,%ebx
+	n = 0;
+f0103071:	ba 00 00 00 00       	mov    $0x0,%edx
+	for (i = 0; i < ncpu; i++)
+f0103076:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (b->tb_cpus & (1 << i))
+f010307b:	be 01 00 00 00       	mov    $0x1,%esi
+f0103080:	eb 0f                	jmp    f0103091 <tlb_shootdown+0x4b>
+f0103082:	89 f0                	mov    %esi,%eax
+f0103084:	d3 e0                	shl    %cl,%eax
+f0103086:	21 f8                	and    %edi,%eax
+			n++;
+f0103088:	83 f8 01             	cmp    $0x1,%eax
+f010308b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < ncpu; i++)
+f010308e:	83 c1 01             	add    $0x1,%ecx
+f0103091:	39 cb                	cmp    %ecx,%ebx
+f0103093:	7f ed                	jg     f0103082 <tlb_shootdown+0x3c>
+	b->tb_waiting = n;
+f0103095:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0103098:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f010309b:	69 c7 b0 00 00 00    	imul   $0xb0,%edi,%eax
+f01030a1:	89 90 08 13 61 f0    	mov    %edx,-0xf9eecf8(%eax)
+	for (i = 0; i < ncpu; i++) {
+f01030a7:	be 20 90 61 f0       	mov    $0xf0619020,%esi
+f01030ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!(b->tb_cpus & (1 << i)))
+f01030b1:	89 f8                	mov    %edi,%eax
+f01030b3:	69 ff b0 00 00 00    	imul   $0xb0,%edi,%edi
+f01030b9:	81 c7 60 12 61 f0    	add    $0xf0611260,%edi
+		b->tb_request[i] = 1;
+f01030bf:	6b c0 2c             	imul   $0x2c,%eax,%eax
+f01030c2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; i < ncpu; i++) {
+f01030c5:	eb 09                	jmp    f01030d0 <tlb_shootdown+0x8a>
+f01030c7:	83 c3 01             	add    $0x1,%ebx
+f01030ca:	81 c6 bc 00 00 00    	add    $0xbc,%esi
+f01030d0:	39 1d 04 96 61 f0    	cmp    %ebx,0xf0619604
+f01030d6:	7e 36                	jle    f010310e <tlb_shootdown+0xc8>
+		if (!(b->tb_cpus & (1 << i)))
+f01030d8:	b8 01 00 00 00       	mov    $0x1,%eax
+f01030dd:	89 d9                	mov    %ebx,%ecx
+f01030df:	d3 e0                	shl    %cl,%eax
+f01030e1:	23 87 84 00 00 00    	and    0x84(%edi),%eax
+f01030e7:	74 de                	je     f01030c7 <tlb_shootdown+0x81>
+		b->tb_request[i] = 1;
+f01030e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01030ec:	8d 44 03 20          	lea    0x20(%ebx,%eax,1),%eax
+f01030f0:	c7 04 85 68 12 61 f0 	movl   $0x1,-0xf9eed98(,%eax,4)
+f01030f7:	01 00 00 00 
+		lapic_ipi_cpu(cpus[i].cpu_id, IRQ_OFFSET + IRQ_TLB);
+f01030fb:	83 ec 08             	sub    $0x8,%esp
+f01030fe:	6a 2c                	push   $0x2c
+f0103100:	0f b6 06             	movzbl (%esi),%eax
+f0103103:	50                   	push   %eax
+f0103104:	e8 6b 7d 00 00       	call   f010ae74 <lapic_ipi_cpu>
+f0103109:	83 c4 10             	add    $0x10,%esp
+f010310c:	eb b9                	jmp    f01030c7 <tlb_shootdown+0x81>
+	thiscpu->cpu_shootdowns++;
+f010310e:	e8 31 7b 00 00       	call   f010ac44 <cpunum>
+f0103113:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0103119:	83 80 d0 90 61 f0 01 	addl   $0x1,-0xf9e6f30(%eax)
+	thiscpu->cpu_shootdown_ipis += n;
+f0103120:	e8 1f 7b 00 00       	call   f010ac44 <cpunum>
+f0103125:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010312b:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f010312e:	01 90 d4 90 61 f0    	add    %edx,-0xf9e6f2c(%eax)
+	while (b->tb_waiting) {
+f0103134:	69 5d e0 b0 00 00 00 	imul   $0xb0,-0x20(%ebp),%ebx
+f010313b:	81 c3 60 12 61 f0    	add    $0xf0611260,%ebx
+f0103141:	eb 07                	jmp    f010314a <tlb_shootdown+0x104>
+		tlb_shootdown_recv();
+f0103143:	e8 4b fe ff ff       	call   f0102f93 <tlb_shootdown_recv>
+		asm volatile("pause");
+f0103148:	f3 90                	pause
+	while (b->tb_waiting) {
+f010314a:	8b 83 a8 00 00 00    	mov    0xa8(%ebx),%eax
+f0103150:	85 c0                	test   %eax,%eax
+f0103152:	75 ef                	jne    f0103143 <tlb_shootdown+0xfd>
+	b->tb_cpus = 0;
+f0103154:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0103157:	69 c2 b0 00 00 00    	imul   $0xb0,%edx,%eax
+f010315d:	c7 80 e4 12 61 f0 00 	movl   $0x0,-0xf9eed1c(%eax)
+f0103164:	00 00 00 
+	b->tb_nva = 0;
+f0103167:	c7 80 60 12 61 f0 00 	movl   $0x0,-0xf9eeda0(%eax)
+f010316e:	00 00 00 
+	while ((tr = b->tb_release)) {
+f0103171:	89 c6                	mov    %eax,%esi
+f0103173:	81 c6 60 12 61 f0    	add    $0xf0611260,%esi
+f0103179:	eb 21                	jmp    f010319c <tlb_shootdown+0x156>
+		b->tb_release = tr->tr_next;
+f010317b:	8b 43 08             	mov    0x8(%ebx),%eax
+f010317e:	89 86 ac 00 00 00    	mov    %eax,0xac(%esi)
+		page_decref_order(tr->tr_page, tr->tr_order);
+f0103184:	83 ec 08             	sub    $0x8,%esp
+f0103187:	ff 73 04             	push   0x4(%ebx)
+f010318a:	ff 33                	push   (%ebx)
+f010318c:	e8 25 ef ff ff       	call   f01020b6 <page_decref_order>
+		kfree(tr);
+f0103191:	89 1c 24             	mov    %ebx,(%esp)
+f0103194:	e8 fb 26 00 00       	call   f0105894 <kfree>
+f0103199:	83 c4 10             	add    $0x10,%esp
+	while ((tr = b->tb_release)) {
+f010319c:	8b 9e ac 00 00 00    	mov    0xac(%esi),%ebx
+f01031a2:	85 db                	test   %ebx,%ebx
+f01031a4:	75 d5                	jne    f010317b <tlb_shootdown+0x135>
+}
+f01031a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01031a9:	5b                   	pop    %ebx
+f01031aa:	5e                   	pop    %esi
+f01031ab:	5f                   	pop    %edi
+f01031ac:	5d                   	pop    %ebp
+f01031ad:	c3                   	ret
+
+f01031ae <mmio_map_region>:
+{
+f01031ae:	55                   	push   %ebp
+f01031af:	89 e5                	mov    %esp,%ebp
+f01031b1:	53                   	push   %ebx
+f01031b2:	83 ec 04             	sub    $0x4,%esp
+	size = ROUNDUP(size, PGSIZE);
+f01031b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01031b8:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+f01031be:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (base + size >= MMIOLIM)
+f01031c4:	8b 15 60 93 11 f0    	mov    0xf0119360,%edx
+f01031ca:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+f01031cd:	3d ff ff bf ef       	cmp    $0xefbfffff,%eax
+f01031d2:	77 26                	ja     f01031fa <mmio_map_region+0x4c>
+	boot_map_region(kern_pgdir, base, size, pa, PTE_PCD|PTE_PWT|PTE_W);
+f01031d4:	83 ec 08             	sub    $0x8,%esp
+f01031d7:	6a 1a                	push   $0x1a
+f01031d9:	ff 75 08             	push   0x8(%ebp)
+f01031dc:	89 d9                	mov    %ebx,%ecx
+f01031de:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+f01031e3:	e8 17 f4 ff ff       	call   f01025ff <boot_map_region>
+	alloc = (void *) base;
+f01031e8:	a1 60 93 11 f0       	mov    0xf0119360,%eax
+	base += size;
+f01031ed:	01 c3                	add    %eax,%ebx
+f01031ef:	89 1d 60 93 11 f0    	mov    %ebx,0xf0119360
+}
+f01031f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01031f8:	c9                   	leave
+f01031f9:	c3                   	ret
+		panic("reserved size 0x%x from base 0x%x exceed MMIOLIM 0x%x", size, base, MMIOLIM);
+f01031fa:	83 ec 08             	sub    $0x8,%esp
+f01031fd:	68 00 00 c0 ef       	push   $0xefc00000
+f0103202:	52                   	push   %edx
+f0103203:	53                   	push   %ebx
+f0103204:	68 08 cf 10 f0       	push   $0xf010cf08
+f0103209:	68 1d 06 00 00       	push   $0x61d
+f010320e:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103213:	e8 80 ce ff ff       	call   f0100098 <_panic>
+
+f0103218 <mem_init>:
+{
+f0103218:	55                   	push   %ebp
+f0103219:	89 e5                	mov    %esp,%ebp
+f010321b:	57                   	push   %edi
+f010321c:	56                   	push   %esi
+f010321d:	53                   	push   %ebx
+f010321e:	83 ec 4c             	sub    $0x4c,%esp
+	npages_basemem = (nvram_read(NVRAM_BASELO) * 1024) / PGSIZE;
+f0103221:	b8 15 00 00 00       	mov    $0x15,%eax
+f0103226:	e8 01 e5 ff ff       	call   f010172c <nvram_read>
+f010322b:	8d 50 03             	lea    0x3(%eax),%edx
+f010322e:	85 c0                	test   %eax,%eax
+f0103230:	0f 48 c2             	cmovs  %edx,%eax
+f0103233:	c1 f8 02             	sar    $0x2,%eax
+f0103236:	a3 98 18 61 f0       	mov    %eax,0xf0611898
+	npages_extmem = (nvram_read(NVRAM_EXTLO) * 1024) / PGSIZE;
+f010323b:	b8 17 00 00 00       	mov    $0x17,%eax
+f0103240:	e8 e7 e4 ff ff       	call   f010172c <nvram_read>
+f0103245:	8d 58 03             	lea    0x3(%eax),%ebx
+f0103248:	85 c0                	test   %eax,%eax
+f010324a:	0f 49 d8             	cmovns %eax,%ebx
+f010324d:	c1 fb 02             	sar    $0x2,%ebx
+f0103250:	89 de                	mov    %ebx,%esi
+	npages_ext16mem = nvram_read(NVRAM_EXT16LO) * (64 * 1024 / PGSIZE);
+f0103252:	b8 34 00 00 00       	mov    $0x34,%eax
+f0103257:	e8 d0 e4 ff ff       	call   f010172c <nvram_read>
+	if (npages_ext16mem)
+f010325c:	c1 e0 04             	shl    $0x4,%eax
+f010325f:	0f 84 19 01 00 00    	je     f010337e <mem_init+0x166>
+		npages = (16 * 1024 * 1024) / PGSIZE + npages_ext16mem;
+f0103265:	05 00 10 00 00       	add    $0x1000,%eax
+f010326a:	a3 78 89 61 f0       	mov    %eax,0xf0618978
+	if (npages > PTSIZE / sizeof(struct PageInfo)) {
+f010326f:	3d 55 55 05 00       	cmp    $0x55555,%eax
+f0103274:	0f 87 18 01 00 00    	ja     f0103392 <mem_init+0x17a>
+	npages_lowmem = MIN(npages, (size_t) ((0xffffffff - KERNBASE + 1) / PGSIZE));
+f010327a:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010327f:	39 d0                	cmp    %edx,%eax
+f0103281:	0f 46 d0             	cmovbe %eax,%edx
+f0103284:	89 15 6c 89 61 f0    	mov    %edx,0xf061896c
+	if (npages_lowmem > EXTPHYSMEM / PGSIZE)
+f010328a:	3d 00 01 00 00       	cmp    $0x100,%eax
+f010328f:	0f 87 34 01 00 00    	ja     f01033c9 <mem_init+0x1b1>
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK, high = %uK\n",
+f0103295:	83 ec 0c             	sub    $0xc,%esp
+		(npages - npages_lowmem) * (PGSIZE / 1024));
+f0103298:	89 c1                	mov    %eax,%ecx
+f010329a:	29 d1                	sub    %edx,%ecx
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK, high = %uK\n",
+f010329c:	8d 14 8d 00 00 00 00 	lea    0x0(,%ecx,4),%edx
+f01032a3:	52                   	push   %edx
+		npages_extmem * PGSIZE / 1024,
+f01032a4:	c1 e6 0c             	shl    $0xc,%esi
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK, high = %uK\n",
+f01032a7:	c1 ee 0a             	shr    $0xa,%esi
+f01032aa:	56                   	push   %esi
+		npages_basemem * PGSIZE / 1024,
+f01032ab:	8b 15 98 18 61 f0    	mov    0xf0611898,%edx
+f01032b1:	c1 e2 0c             	shl    $0xc,%edx
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK, high = %uK\n",
+f01032b4:	c1 ea 0a             	shr    $0xa,%edx
+f01032b7:	52                   	push   %edx
+f01032b8:	c1 e0 02             	shl    $0x2,%eax
+f01032bb:	50                   	push   %eax
+f01032bc:	68 74 cf 10 f0       	push   $0xf010cf74
+f01032c1:	e8 36 3d 00 00       	call   f0106ffc <cprintf>
+	kern_pgdir = (pde_t *) boot_alloc(PGSIZE);
+f01032c6:	83 c4 20             	add    $0x20,%esp
+f01032c9:	b8 00 10 00 00       	mov    $0x1000,%eax
+f01032ce:	e8 c7 e3 ff ff       	call   f010169a <boot_alloc>
+f01032d3:	a3 7c 89 61 f0       	mov    %eax,0xf061897c
+	memset(kern_pgdir, 0, PGSIZE);
+f01032d8:	83 ec 04             	sub    $0x4,%esp
+f01032db:	68 00 10 00 00       	push   $0x1000
+f01032e0:	6a 00                	push   $0x0
+f01032e2:	50                   	push   %eax
+f01032e3:	e8 16 73 00 00       	call   f010a5fe <memset>
+	kern_pgdir[PDX(UVPT)] = PADDR(kern_pgdir) | PTE_U | PTE_P;
+f01032e8:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01032ed:	83 c4 10             	add    $0x10,%esp
+f01032f0:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01032f5:	0f 86 d9 00 00 00    	jbe    f01033d4 <mem_init+0x1bc>
+	return (physaddr_t)kva - KERNBASE;
+f01032fb:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0103301:	83 ca 05             	or     $0x5,%edx
+f0103304:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+	pages = boot_alloc(npages * sizeof(struct PageInfo));
+f010330a:	a1 78 89 61 f0       	mov    0xf0618978,%eax
+f010330f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0103312:	c1 e0 02             	shl    $0x2,%eax
+f0103315:	e8 80 e3 ff ff       	call   f010169a <boot_alloc>
+f010331a:	a3 80 89 61 f0       	mov    %eax,0xf0618980
+	if ((uintptr_t) (pages + npages_lowmem) > KERNBASE + PTSIZE)
+f010331f:	8b 15 6c 89 61 f0    	mov    0xf061896c,%edx
+f0103325:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f0103328:	c1 e2 02             	shl    $0x2,%edx
+f010332b:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+f010332e:	81 f9 00 00 40 f0    	cmp    $0xf0400000,%ecx
+f0103334:	0f 87 af 00 00 00    	ja     f01033e9 <mem_init+0x1d1>
+	memset(pages, 0, npages_lowmem * sizeof(struct PageInfo));
+f010333a:	83 ec 04             	sub    $0x4,%esp
+f010333d:	52                   	push   %edx
+f010333e:	6a 00                	push   $0x0
+f0103340:	50                   	push   %eax
+f0103341:	e8 b8 72 00 00       	call   f010a5fe <memset>
+	page_init();
+f0103346:	e8 fd e9 ff ff       	call   f0101d48 <page_init>
+	check_page_free_list(1);
+f010334b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0103350:	e8 8f e6 ff ff       	call   f01019e4 <check_page_free_list>
+	if (!pages)
+f0103355:	83 c4 10             	add    $0x10,%esp
+f0103358:	83 3d 80 89 61 f0 00 	cmpl   $0x0,0xf0618980
+f010335f:	0f 84 9b 00 00 00    	je     f0103400 <mem_init+0x1e8>
+	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f0103365:	a1 8c 18 61 f0       	mov    0xf061188c,%eax
+f010336a:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010336f:	85 c0                	test   %eax,%eax
+f0103371:	0f 84 a0 00 00 00    	je     f0103417 <mem_init+0x1ff>
+		++nfree;
+f0103377:	83 c3 01             	add    $0x1,%ebx
+	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f010337a:	8b 00                	mov    (%eax),%eax
+f010337c:	eb f1                	jmp    f010336f <mem_init+0x157>
+		npages = (EXTPHYSMEM / PGSIZE) + npages_extmem;
+f010337e:	8d 83 00 01 00 00    	lea    0x100(%ebx),%eax
+f0103384:	85 db                	test   %ebx,%ebx
+f0103386:	0f 44 05 98 18 61 f0 	cmove  0xf0611898,%eax
+f010338d:	e9 d8 fe ff ff       	jmp    f010326a <mem_init+0x52>
+		cprintf("Physical memory: only using the first %uK of %uK\n",
+f0103392:	83 ec 04             	sub    $0x4,%esp
+f0103395:	c1 e0 02             	shl    $0x2,%eax
+f0103398:	50                   	push   %eax
+f0103399:	68 54 55 15 00       	push   $0x155554
+f010339e:	68 40 cf 10 f0       	push   $0xf010cf40
+f01033a3:	e8 54 3c 00 00       	call   f0106ffc <cprintf>
+		npages = PTSIZE / sizeof(struct PageInfo);
+f01033a8:	c7 05 78 89 61 f0 55 	movl   $0x55555,0xf0618978
+f01033af:	55 05 00 
+	npages_lowmem = MIN(npages, (size_t) ((0xffffffff - KERNBASE + 1) / PGSIZE));
+f01033b2:	c7 05 6c 89 61 f0 00 	movl   $0x10000,0xf061896c
+f01033b9:	00 01 00 
+f01033bc:	83 c4 10             	add    $0x10,%esp
+f01033bf:	ba 00 00 01 00       	mov    $0x10000,%edx
+f01033c4:	b8 55 55 05 00       	mov    $0x55555,%eax
+		npages_extmem = npages_lowmem - EXTPHYSMEM / PGSIZE;
+f01033c9:	8d b2 00 ff ff ff    	lea    -0x100(%edx),%esi
+f01033cf:	e9 c1 fe ff ff       	jmp    f0103295 <mem_init+0x7d>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01033d4:	50                   	push   %eax
+f01033d5:	68 e8 cc 10 f0       	push   $0xf010cce8
+f01033da:	68 0b 01 00 00       	push   $0x10b
+f01033df:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01033e4:	e8 af cc ff ff       	call   f0100098 <_panic>
+		panic("mem_init: pages array is past the entry mapping");
+f01033e9:	83 ec 04             	sub    $0x4,%esp
+f01033ec:	68 bc cf 10 f0       	push   $0xf010cfbc
+f01033f1:	68 19 01 00 00       	push   $0x119
+f01033f6:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01033fb:	e8 98 cc ff ff       	call   f0100098 <_panic>
+		panic("'pages' is a null pointer!");
+f0103400:	83 ec 04             	sub    $0x4,%esp
+f0103403:	68 23 d9 10 f0       	push   $0xf010d923
+f0103408:	68 da 06 00 00       	push   $0x6da
+f010340d:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103412:	e8 81 cc ff ff       	call   f0100098 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0103417:	83 ec 0c             	sub    $0xc,%esp
+f010341a:	6a 00                	push   $0x0
+f010341c:	e8 a9 ee ff ff       	call   f01022ca <page_alloc>
+f0103421:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0103424:	83 c4 10             	add    $0x10,%esp
+f0103427:	85 c0                	test   %eax,%eax
+f0103429:	0f 84 1b 02 00 00    	je     f010364a <mem_init+0x432>
+	assert((pp1 = page_alloc(0)));
+f010342f:	83 ec 0c             	sub    $0xc,%esp
+f0103432:	6a 00                	push   $0x0
+f0103434:	e8 91 ee ff ff       	call   f01022ca <page_alloc>
+f0103439:	89 c7                	mov    %eax,%edi
+f010343b:	83 c4 10             	add    $0x10,%esp
+f010343e:	85 c0                	test   %eax,%eax
+f0103440:	0f 84 1d 02 00 00    	je     f0103663 <mem_init+0x44b>
+	assert((pp2 = page_alloc(0)));
+f0103446:	83 ec 0c             	sub    $0xc,%esp
+f0103449:	6a 00                	push   $0x0
+f010344b:	e8 7a ee ff ff       	call   f01022ca <page_alloc>
+f0103450:	89 c6                	mov    %eax,%esi
+f0103452:	83 c4 10             	add    $0x10,%esp
+f0103455:	85 c0                	test   %eax,%eax
+f0103457:	0f 84 1f 02 00 00    	je     f010367c <mem_init+0x464>
+	assert(pp1 && pp1 != pp0);
+f010345d:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0103460:	0f 84 2f 02 00 00    	je     f0103695 <mem_init+0x47d>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0103466:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0103469:	0f 84 3f 02 00 00    	je     f01036ae <mem_init+0x496>
+f010346f:	39 c7                	cmp    %eax,%edi
+f0103471:	0f 84 37 02 00 00    	je     f01036ae <mem_init+0x496>
+	return (pp - pages) << PGSHIFT;
+f0103477:	8b 0d 80 89 61 f0    	mov    0xf0618980,%ecx
+	assert(page2pa(pp0) < npages*PGSIZE);
+f010347d:	8b 15 78 89 61 f0    	mov    0xf0618978,%edx
+f0103483:	c1 e2 0c             	shl    $0xc,%edx
+f0103486:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103489:	29 c8                	sub    %ecx,%eax
+f010348b:	c1 f8 02             	sar    $0x2,%eax
+f010348e:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103494:	c1 e0 0c             	shl    $0xc,%eax
+f0103497:	39 d0                	cmp    %edx,%eax
+f0103499:	0f 83 28 02 00 00    	jae    f01036c7 <mem_init+0x4af>
+f010349f:	89 f8                	mov    %edi,%eax
+f01034a1:	29 c8                	sub    %ecx,%eax
+f01034a3:	c1 f8 02             	sar    $0x2,%eax
+f01034a6:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01034ac:	c1 e0 0c             	shl    $0xc,%eax
+	assert(page2pa(pp1) < npages*PGSIZE);
+f01034af:	39 d0                	cmp    %edx,%eax
+f01034b1:	0f 83 29 02 00 00    	jae    f01036e0 <mem_init+0x4c8>
+f01034b7:	89 f0                	mov    %esi,%eax
+f01034b9:	29 c8                	sub    %ecx,%eax
+f01034bb:	c1 f8 02             	sar    $0x2,%eax
+f01034be:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01034c4:	c1 e0 0c             	shl    $0xc,%eax
+	assert(page2pa(pp2) < npages*PGSIZE);
+f01034c7:	39 d0                	cmp    %edx,%eax
+f01034c9:	0f 83 2a 02 00 00    	jae    f01036f9 <mem_init+0x4e1>
+	fl = page_free_list;
+f01034cf:	a1 8c 18 61 f0       	mov    0xf061188c,%eax
+f01034d4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	page_free_list = 0;
+f01034d7:	c7 05 8c 18 61 f0 00 	movl   $0x0,0xf061188c
+f01034de:	00 00 00 
+	assert(!page_alloc(0));
+f01034e1:	83 ec 0c             	sub    $0xc,%esp
+f01034e4:	6a 00                	push   $0x0
+f01034e6:	e8 df ed ff ff       	call   f01022ca <page_alloc>
+f01034eb:	83 c4 10             	add    $0x10,%esp
+f01034ee:	85 c0                	test   %eax,%eax
+f01034f0:	0f 85 1c 02 00 00    	jne    f0103712 <mem_init+0x4fa>
+	page_free(pp0);
+f01034f6:	83 ec 0c             	sub    $0xc,%esp
+f01034f9:	ff 75 d4             	push   -0x2c(%ebp)
+f01034fc:	e8 b0 e9 ff ff       	call   f0101eb1 <page_free>
+	page_free(pp1);
+f0103501:	89 3c 24             	mov    %edi,(%esp)
+f0103504:	e8 a8 e9 ff ff       	call   f0101eb1 <page_free>
+	page_free(pp2);
+f0103509:	89 34 24             	mov    %esi,(%esp)
+f010350c:	e8 a0 e9 ff ff       	call   f0101eb1 <page_free>
+	assert((pp0 = page_alloc(0)));
+f0103511:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f0103518:	e8 ad ed ff ff       	call   f01022ca <page_alloc>
+f010351d:	89 c6                	mov    %eax,%esi
+f010351f:	83 c4 10             	add    $0x10,%esp
+f0103522:	85 c0                	test   %eax,%eax
+f0103524:	0f 84 01 02 00 00    	je     f010372b <mem_init+0x513>
+	assert((pp1 = page_alloc(0)));
+f010352a:	83 ec 0c             	sub    $0xc,%esp
+f010352d:	6a 00                	push   $0x0
+f010352f:	e8 96 ed ff ff       	call   f01022ca <page_alloc>
+f0103534:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0103537:	83 c4 10             	add    $0x10,%esp
+f010353a:	85 c0                	test   %eax,%eax
+f010353c:	0f 84 02 02 00 00    	je     f0103744 <mem_init+0x52c>
+	assert((pp2 = page_alloc(0)));
+f0103542:	83 ec 0c             	sub    $0xc,%esp
+f0103545:	6a 00                	push   $0x0
+f0103547:	e8 7e ed ff ff       	call   f01022ca <page_alloc>
+f010354c:	89 c7                	mov    %eax,%edi
+f010354e:	83 c4 10             	add    $0x10,%esp
+f0103551:	85 c0                	test   %eax,%eax
+f0103553:	0f 84 04 02 00 00    	je     f010375d <mem_init+0x545>
+	assert(pp1 && pp1 != pp0);
+f0103559:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010355c:	39 c6                	cmp    %eax,%esi
+f010355e:	0f 84 12 02 00 00    	je     f0103776 <mem_init+0x55e>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0103564:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0103567:	0f 84 22 02 00 00    	je     f010378f <mem_init+0x577>
+f010356d:	39 fe                	cmp    %edi,%esi
+f010356f:	0f 84 1a 02 00 00    	je     f010378f <mem_init+0x577>
+	assert(!page_alloc(0));
+f0103575:	83 ec 0c             	sub    $0xc,%esp
+f0103578:	6a 00                	push   $0x0
+f010357a:	e8 4b ed ff ff       	call   f01022ca <page_alloc>
+f010357f:	83 c4 10             	add    $0x10,%esp
+f0103582:	85 c0                	test   %eax,%eax
+f0103584:	0f 85 1e 02 00 00    	jne    f01037a8 <mem_init+0x590>
+f010358a:	89 f0                	mov    %esi,%eax
+f010358c:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0103592:	c1 f8 02             	sar    $0x2,%eax
+f0103595:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010359b:	89 c2                	mov    %eax,%edx
+f010359d:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages_lowmem)
+f01035a0:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01035a5:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f01035ab:	0f 83 10 02 00 00    	jae    f01037c1 <mem_init+0x5a9>
+	memset(page2kva(pp0), 1, PGSIZE);
+f01035b1:	83 ec 04             	sub    $0x4,%esp
+f01035b4:	68 00 10 00 00       	push   $0x1000
+f01035b9:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f01035bb:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01035c1:	52                   	push   %edx
+f01035c2:	e8 37 70 00 00       	call   f010a5fe <memset>
+	page_free(pp0);
+f01035c7:	89 34 24             	mov    %esi,(%esp)
+f01035ca:	e8 e2 e8 ff ff       	call   f0101eb1 <page_free>
+	assert((pp = page_alloc(ALLOC_ZERO)));
+f01035cf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f01035d6:	e8 ef ec ff ff       	call   f01022ca <page_alloc>
+f01035db:	83 c4 10             	add    $0x10,%esp
+f01035de:	85 c0                	test   %eax,%eax
+f01035e0:	0f 84 ed 01 00 00    	je     f01037d3 <mem_init+0x5bb>
+	assert(pp && pp0 == pp);
+f01035e6:	39 c6                	cmp    %eax,%esi
+f01035e8:	0f 85 fe 01 00 00    	jne    f01037ec <mem_init+0x5d4>
+	return (pp - pages) << PGSHIFT;
+f01035ee:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f01035f4:	c1 f8 02             	sar    $0x2,%eax
+f01035f7:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01035fd:	89 c1                	mov    %eax,%ecx
+f01035ff:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages_lowmem)
+f0103602:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103607:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f010360d:	0f 83 f2 01 00 00    	jae    f0103805 <mem_init+0x5ed>
+	return (void *)(pa + KERNBASE);
+f0103613:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+	for (i = 0; i < PGSIZE; i++)
+f0103619:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f010361f:	39 c8                	cmp    %ecx,%eax
+f0103621:	0f 84 f0 01 00 00    	je     f0103817 <mem_init+0x5ff>
+		assert(c[i] == 0);
+f0103627:	0f b6 10             	movzbl (%eax),%edx
+f010362a:	83 c0 01             	add    $0x1,%eax
+f010362d:	84 d2                	test   %dl,%dl
+f010362f:	74 ee                	je     f010361f <mem_init+0x407>
+f0103631:	68 26 da 10 f0       	push   $0xf010da26
+f0103636:	68 0d d8 10 f0       	push   $0xf010d80d
+f010363b:	68 08 07 00 00       	push   $0x708
+f0103640:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103645:	e8 4e ca ff ff       	call   f0100098 <_panic>
+	assert((pp0 = page_alloc(0)));
+f010364a:	68 3e d9 10 f0       	push   $0xf010d93e
+f010364f:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103654:	68 e2 06 00 00       	push   $0x6e2
+f0103659:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010365e:	e8 35 ca ff ff       	call   f0100098 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0103663:	68 54 d9 10 f0       	push   $0xf010d954
+f0103668:	68 0d d8 10 f0       	push   $0xf010d80d
+f010366d:	68 e3 06 00 00       	push   $0x6e3
+f0103672:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103677:	e8 1c ca ff ff       	call   f0100098 <_panic>
+	assert((pp2 = page_alloc(0)));
+f010367c:	68 6a d9 10 f0       	push   $0xf010d96a
+f0103681:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103686:	68 e4 06 00 00       	push   $0x6e4
+f010368b:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103690:	e8 03 ca ff ff       	call   f0100098 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0103695:	68 80 d9 10 f0       	push   $0xf010d980
+f010369a:	68 0d d8 10 f0       	push   $0xf010d80d
+f010369f:	68 e7 06 00 00       	push   $0x6e7
+f01036a4:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01036a9:	e8 ea c9 ff ff       	call   f0100098 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f01036ae:	68 ec cf 10 f0       	push   $0xf010cfec
+f01036b3:	68 0d d8 10 f0       	push   $0xf010d80d
+f01036b8:	68 e8 06 00 00       	push   $0x6e8
+f01036bd:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01036c2:	e8 d1 c9 ff ff       	call   f0100098 <_panic>
+	assert(page2pa(pp0) < npages*PGSIZE);
+f01036c7:	68 92 d9 10 f0       	push   $0xf010d992
+f01036cc:	68 0d d8 10 f0       	push   $0xf010d80d
+f01036d1:	68 e9 06 00 00       	push   $0x6e9
+f01036d6:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01036db:	e8 b8 c9 ff ff       	call   f0100098 <_panic>
+	assert(page2pa(pp1) < npages*PGSIZE);
+f01036e0:	68 af d9 10 f0       	push   $0xf010d9af
+f01036e5:	68 0d d8 10 f0       	push   $0xf010d80d
+f01036ea:	68 ea 06 00 00       	push   $0x6ea
+f01036ef:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01036f4:	e8 9f c9 ff ff       	call   f0100098 <_panic>
+	assert(page2pa(pp2) < npages*PGSIZE);
+f01036f9:	68 cc d9 10 f0       	push   $0xf010d9cc
+f01036fe:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103703:	68 eb 06 00 00       	push   $0x6eb
+f0103708:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010370d:	e8 86 c9 ff ff       	call   f0100098 <_panic>
+	assert(!page_alloc(0));
+f0103712:	68 e9 d9 10 f0       	push   $0xf010d9e9
+f0103717:	68 0d d8 10 f0       	push   $0xf010d80d
+f010371c:	68 f2 06 00 00       	push   $0x6f2
+f0103721:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103726:	e8 6d c9 ff ff       	call   f0100098 <_panic>
+	assert((pp0 = page_alloc(0)));
+f010372b:	68 3e d9 10 f0       	push   $0xf010d93e
+f0103730:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103735:	68 f9 06 00 00       	push   $0x6f9
+f010373a:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010373f:	e8 54 c9 ff ff       	call   f0100098 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0103744:	68 54 d9 10 f0       	push   $0xf010d954
+f0103749:	68 0d d8 10 f0       	push   $0xf010d80d
+f010374e:	68 fa 06 00 00       	push   $0x6fa
+f0103753:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103758:	e8 3b c9 ff ff       	call   f0100098 <_panic>
+	assert((pp2 = page_alloc(0)));
+f010375d:	68 6a d9 10 f0       	push   $0xf010d96a
+f0103762:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103767:	68 fb 06 00 00       	push   $0x6fb
+f010376c:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103771:	e8 22 c9 ff ff       	call   f0100098 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0103776:	68 80 d9 10 f0       	push   $0xf010d980
+f010377b:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103780:	68 fd 06 00 00       	push   $0x6fd
+f0103785:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010378a:	e8 09 c9 ff ff       	call   f0100098 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f010378f:	68 ec cf 10 f0       	push   $0xf010cfec
+f0103794:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103799:	68 fe 06 00 00       	push   $0x6fe
+f010379e:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01037a3:	e8 f0 c8 ff ff       	call   f0100098 <_panic>
+	assert(!page_alloc(0));
+f01037a8:	68 e9 d9 10 f0       	push   $0xf010d9e9
+f01037ad:	68 0d d8 10 f0       	push   $0xf010d80d
+f01037b2:	68 ff 06 00 00       	push   $0x6ff
+f01037b7:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01037bc:	e8 d7 c8 ff ff       	call   f0100098 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01037c1:	52                   	push   %edx
+f01037c2:	68 1c c0 10 f0       	push   $0xf010c01c
+f01037c7:	6a 7d                	push   $0x7d
+f01037c9:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f01037ce:	e8 c5 c8 ff ff       	call   f0100098 <_panic>
+	assert((pp = page_alloc(ALLOC_ZERO)));
+f01037d3:	68 f8 d9 10 f0       	push   $0xf010d9f8
+f01037d8:	68 0d d8 10 f0       	push   $0xf010d80d
+f01037dd:	68 04 07 00 00       	push   $0x704
+f01037e2:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01037e7:	e8 ac c8 ff ff       	call   f0100098 <_panic>
+	assert(pp && pp0 == pp);
+f01037ec:	68 16 da 10 f0       	push   $0xf010da16
+f01037f1:	68 0d d8 10 f0       	push   $0xf010d80d
+f01037f6:	68 05 07 00 00       	push   $0x705
+f01037fb:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103800:	e8 93 c8 ff ff       	call   f0100098 <_panic>
+f0103805:	51                   	push   %ecx
+f0103806:	68 1c c0 10 f0       	push   $0xf010c01c
+f010380b:	6a 7d                	push   $0x7d
+f010380d:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0103812:	e8 81 c8 ff ff       	call   f0100098 <_panic>
+	page_free_list = fl;
+f0103817:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010381a:	a3 8c 18 61 f0       	mov    %eax,0xf061188c
+	page_free(pp0);
+f010381f:	83 ec 0c             	sub    $0xc,%esp
+f0103822:	56                   	push   %esi
+f0103823:	e8 89 e6 ff ff       	call   f0101eb1 <page_free>
+	page_free(pp1);
+f0103828:	83 c4 04             	add    $0x4,%esp
+f010382b:	ff 75 d4             	push   -0x2c(%ebp)
+f010382e:	e8 7e e6 ff ff       	call   f0101eb1 <page_free>
+	page_free(pp2);
+f0103833:	89 3c 24             	mov    %edi,(%esp)
+f0103836:	e8 76 e6 ff ff       	call   f0101eb1 <page_free>
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f010383b:	a1 8c 18 61 f0       	mov    0xf061188c,%eax
+f0103840:	83 c4 10             	add    $0x10,%esp
+f0103843:	85 c0                	test   %eax,%eax
+f0103845:	74 07                	je     f010384e <mem_init+0x636>
+		--nfree;
+f0103847:	83 eb 01             	sub    $0x1,%ebx
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f010384a:	8b 00                	mov    (%eax),%eax
+f010384c:	eb f5                	jmp    f0103843 <mem_init+0x62b>
+	assert(nfree == 0);
+f010384e:	85 db                	test   %ebx,%ebx
+f0103850:	0f 85 ba 06 00 00    	jne    f0103f10 <mem_init+0xcf8>
+	cprintf("check_page_alloc() succeeded!\n");
+f0103856:	83 ec 0c             	sub    $0xc,%esp
+f0103859:	68 0c d0 10 f0       	push   $0xf010d00c
+f010385e:	e8 99 37 00 00       	call   f0106ffc <cprintf>
+	int i;
+	extern pde_t entry_pgdir[];
+
+	// should be able to allocate three pages
+	pp0 = pp1 = pp2 = 0;
+	assert((pp0 = page_alloc(0)));
+f0103863:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f010386a:	e8 5b ea ff ff       	call   f01022ca <page_alloc>
+f010386f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0103872:	83 c4 10             	add    $0x10,%esp
+f0103875:	85 c0                	test   %eax,%eax
+f0103877:	0f 84 ac 06 00 00    	je     f0103f29 <mem_init+0xd11>
+	assert((pp1 = page_alloc(0)));
+f010387d:	83 ec 0c             	sub    $0xc,%esp
+f0103880:	6a 00                	push   $0x0
+f0103882:	e8 43 ea ff ff       	call   f01022ca <page_alloc>
+f0103887:	89 c3                	mov    %eax,%ebx
+f0103889:	83 c4 10             	add    $0x10,%esp
+f010388c:	85 c0                	test   %eax,%eax
+f010388e:	0f 84 ae 06 00 00    	je     f0103f42 <mem_init+0xd2a>
+	assert((pp2 = page_alloc(0)));
+f0103894:	83 ec 0c             	sub    $0xc,%esp
+f0103897:	6a 00                	push   $0x0
+f0103899:	e8 2c ea ff ff       	call   f01022ca <page_alloc>
+f010389e:	89 c6                	mov    %eax,%esi
+f01038a0:	83 c4 10             	add    $0x10,%esp
+f01038a3:	85 c0                	test   %eax,%eax
+f01038a5:	0f 84 b0 06 00 00    	je     f0103f5b <mem_init+0xd43>
+
+	assert(pp0);
+	assert(pp1 && pp1 != pp0);
+f01038ab:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+f01038ae:	0f 84 c0 06 00 00    	je     f0103f74 <mem_init+0xd5c>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f01038b4:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f01038b7:	0f 84 d0 06 00 00    	je     f0103f8d <mem_init+0xd75>
+f01038bd:	39 c3                	cmp    %eax,%ebx
+f01038bf:	0f 84 c8 06 00 00    	je     f0103f8d <mem_init+0xd75>
+
+	// temporarily steal the rest of the free pages
+	fl = page_free_list;
+f01038c5:	a1 8c 18 61 f0       	mov    0xf061188c,%eax
+f01038ca:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	page_free_list = 0;
+f01038cd:	c7 05 8c 18 61 f0 00 	movl   $0x0,0xf061188c
+f01038d4:	00 00 00 
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f01038d7:	83 ec 0c             	sub    $0xc,%esp
+f01038da:	6a 00                	push   $0x0
+f01038dc:	e8 e9 e9 ff ff       	call   f01022ca <page_alloc>
+f01038e1:	83 c4 10             	add    $0x10,%esp
+f01038e4:	85 c0                	test   %eax,%eax
+f01038e6:	0f 85 ba 06 00 00    	jne    f0103fa6 <mem_init+0xd8e>
+
+	// there is no page allocated at address 0
+	assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f01038ec:	83 ec 04             	sub    $0x4,%esp
+f01038ef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01038f2:	50                   	push   %eax
+f01038f3:	6a 00                	push   $0x0
+f01038f5:	ff 35 7c 89 61 f0    	push   0xf061897c
+f01038fb:	e8 2c ee ff ff       	call   f010272c <page_lookup>
+f0103900:	83 c4 10             	add    $0x10,%esp
+f0103903:	85 c0                	test   %eax,%eax
+f0103905:	0f 85 b4 06 00 00    	jne    f0103fbf <mem_init+0xda7>
+
+	// there is no free memory, so we can't allocate a page table
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f010390b:	6a 02                	push   $0x2
+f010390d:	6a 00                	push   $0x0
+f010390f:	53                   	push   %ebx
+f0103910:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103916:	e8 2d f0 ff ff       	call   f0102948 <page_insert>
+f010391b:	83 c4 10             	add    $0x10,%esp
+f010391e:	85 c0                	test   %eax,%eax
+f0103920:	0f 89 b2 06 00 00    	jns    f0103fd8 <mem_init+0xdc0>
+
+	// free pp0 and try again: pp0 should be used for page table
+	page_free(pp0);
+f0103926:	83 ec 0c             	sub    $0xc,%esp
+f0103929:	ff 75 d4             	push   -0x2c(%ebp)
+f010392c:	e8 80 e5 ff ff       	call   f0101eb1 <page_free>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f0103931:	6a 02                	push   $0x2
+f0103933:	6a 00                	push   $0x0
+f0103935:	53                   	push   %ebx
+f0103936:	ff 35 7c 89 61 f0    	push   0xf061897c
+f010393c:	e8 07 f0 ff ff       	call   f0102948 <page_insert>
+f0103941:	83 c4 20             	add    $0x20,%esp
+f0103944:	85 c0                	test   %eax,%eax
+f0103946:	0f 85 a5 06 00 00    	jne    f0103ff1 <mem_init+0xdd9>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f010394c:	8b 3d 7c 89 61 f0    	mov    0xf061897c,%edi
+	return (pp - pages) << PGSHIFT;
+f0103952:	8b 0d 80 89 61 f0    	mov    0xf0618980,%ecx
+f0103958:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f010395b:	8b 17                	mov    (%edi),%edx
+f010395d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0103963:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103966:	29 c8                	sub    %ecx,%eax
+f0103968:	c1 f8 02             	sar    $0x2,%eax
+f010396b:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103971:	c1 e0 0c             	shl    $0xc,%eax
+f0103974:	39 c2                	cmp    %eax,%edx
+f0103976:	0f 85 8e 06 00 00    	jne    f010400a <mem_init+0xdf2>
+	assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f010397c:	ba 00 00 00 00       	mov    $0x0,%edx
+f0103981:	89 f8                	mov    %edi,%eax
+f0103983:	e8 e7 df ff ff       	call   f010196f <check_va2pa>
+f0103988:	89 c2                	mov    %eax,%edx
+f010398a:	89 d8                	mov    %ebx,%eax
+f010398c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f010398f:	29 c8                	sub    %ecx,%eax
+f0103991:	c1 f8 02             	sar    $0x2,%eax
+f0103994:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010399a:	c1 e0 0c             	shl    $0xc,%eax
+f010399d:	39 c2                	cmp    %eax,%edx
+f010399f:	0f 85 7e 06 00 00    	jne    f0104023 <mem_init+0xe0b>
+	assert(pp1->pp_ref == 1);
+f01039a5:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01039aa:	0f 85 8c 06 00 00    	jne    f010403c <mem_init+0xe24>
+	assert(pp0->pp_ref == 1);
+f01039b0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01039b3:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f01039b8:	0f 85 97 06 00 00    	jne    f0104055 <mem_init+0xe3d>
+
+	// should be able to map pp2 at PGSIZE because pp0 is already allocated for page table
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f01039be:	6a 02                	push   $0x2
+f01039c0:	68 00 10 00 00       	push   $0x1000
+f01039c5:	56                   	push   %esi
+f01039c6:	57                   	push   %edi
+f01039c7:	e8 7c ef ff ff       	call   f0102948 <page_insert>
+f01039cc:	83 c4 10             	add    $0x10,%esp
+f01039cf:	85 c0                	test   %eax,%eax
+f01039d1:	0f 85 97 06 00 00    	jne    f010406e <mem_init+0xe56>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01039d7:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01039dc:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+f01039e1:	e8 89 df ff ff       	call   f010196f <check_va2pa>
+f01039e6:	89 c2                	mov    %eax,%edx
+f01039e8:	89 f0                	mov    %esi,%eax
+f01039ea:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f01039f0:	c1 f8 02             	sar    $0x2,%eax
+f01039f3:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01039f9:	c1 e0 0c             	shl    $0xc,%eax
+f01039fc:	39 c2                	cmp    %eax,%edx
+f01039fe:	0f 85 83 06 00 00    	jne    f0104087 <mem_init+0xe6f>
+	assert(pp2->pp_ref == 1);
+f0103a04:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f0103a09:	0f 85 91 06 00 00    	jne    f01040a0 <mem_init+0xe88>
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f0103a0f:	83 ec 0c             	sub    $0xc,%esp
+f0103a12:	6a 00                	push   $0x0
+f0103a14:	e8 b1 e8 ff ff       	call   f01022ca <page_alloc>
+f0103a19:	83 c4 10             	add    $0x10,%esp
+f0103a1c:	85 c0                	test   %eax,%eax
+f0103a1e:	0f 85 95 06 00 00    	jne    f01040b9 <mem_init+0xea1>
+
+	// should be able to map pp2 at PGSIZE because it's already there
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0103a24:	6a 02                	push   $0x2
+f0103a26:	68 00 10 00 00       	push   $0x1000
+f0103a2b:	56                   	push   %esi
+f0103a2c:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103a32:	e8 11 ef ff ff       	call   f0102948 <page_insert>
+f0103a37:	83 c4 10             	add    $0x10,%esp
+f0103a3a:	85 c0                	test   %eax,%eax
+f0103a3c:	0f 85 90 06 00 00    	jne    f01040d2 <mem_init+0xeba>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0103a42:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103a47:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+f0103a4c:	e8 1e df ff ff       	call   f010196f <check_va2pa>
+f0103a51:	89 c2                	mov    %eax,%edx
+f0103a53:	89 f0                	mov    %esi,%eax
+f0103a55:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0103a5b:	c1 f8 02             	sar    $0x2,%eax
+f0103a5e:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103a64:	c1 e0 0c             	shl    $0xc,%eax
+f0103a67:	39 c2                	cmp    %eax,%edx
+f0103a69:	0f 85 7c 06 00 00    	jne    f01040eb <mem_init+0xed3>
+	assert(pp2->pp_ref == 1);
+f0103a6f:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f0103a74:	0f 85 8a 06 00 00    	jne    f0104104 <mem_init+0xeec>
+
+	// pp2 should NOT be on the free list
+	// could happen in ref counts are handled sloppily in page_insert
+	assert(!page_alloc(0));
+f0103a7a:	83 ec 0c             	sub    $0xc,%esp
+f0103a7d:	6a 00                	push   $0x0
+f0103a7f:	e8 46 e8 ff ff       	call   f01022ca <page_alloc>
+f0103a84:	83 c4 10             	add    $0x10,%esp
+f0103a87:	85 c0                	test   %eax,%eax
+f0103a89:	0f 85 8e 06 00 00    	jne    f010411d <mem_init+0xf05>
+
+	// check that pgdir_walk returns a pointer to the pte
+	ptep = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(PGSIZE)]));
+f0103a8f:	8b 15 7c 89 61 f0    	mov    0xf061897c,%edx
+f0103a95:	8b 02                	mov    (%edx),%eax
+f0103a97:	89 c7                	mov    %eax,%edi
+f0103a99:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	if (PGNUM(pa) >= npages_lowmem)
+f0103a9f:	c1 e8 0c             	shr    $0xc,%eax
+f0103aa2:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0103aa8:	0f 83 88 06 00 00    	jae    f0104136 <mem_init+0xf1e>
+	assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f0103aae:	83 ec 04             	sub    $0x4,%esp
+f0103ab1:	6a 00                	push   $0x0
+f0103ab3:	68 00 10 00 00       	push   $0x1000
+f0103ab8:	52                   	push   %edx
+f0103ab9:	e8 a2 ea ff ff       	call   f0102560 <pgdir_walk>
+f0103abe:	81 ef fc ff ff 0f    	sub    $0xffffffc,%edi
+f0103ac4:	83 c4 10             	add    $0x10,%esp
+f0103ac7:	39 f8                	cmp    %edi,%eax
+f0103ac9:	0f 85 7c 06 00 00    	jne    f010414b <mem_init+0xf33>
+
+	// should be able to change permissions too.
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W|PTE_U) == 0);
+f0103acf:	6a 06                	push   $0x6
+f0103ad1:	68 00 10 00 00       	push   $0x1000
+f0103ad6:	56                   	push   %esi
+f0103ad7:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103add:	e8 66 ee ff ff       	call   f0102948 <page_insert>
+f0103ae2:	83 c4 10             	add    $0x10,%esp
+f0103ae5:	85 c0                	test   %eax,%eax
+f0103ae7:	0f 85 77 06 00 00    	jne    f0104164 <mem_init+0xf4c>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0103aed:	8b 3d 7c 89 61 f0    	mov    0xf061897c,%edi
+f0103af3:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103af8:	89 f8                	mov    %edi,%eax
+f0103afa:	e8 70 de ff ff       	call   f010196f <check_va2pa>
+f0103aff:	89 c2                	mov    %eax,%edx
+	return (pp - pages) << PGSHIFT;
+f0103b01:	89 f0                	mov    %esi,%eax
+f0103b03:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0103b09:	c1 f8 02             	sar    $0x2,%eax
+f0103b0c:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103b12:	c1 e0 0c             	shl    $0xc,%eax
+f0103b15:	39 c2                	cmp    %eax,%edx
+f0103b17:	0f 85 60 06 00 00    	jne    f010417d <mem_init+0xf65>
+	assert(pp2->pp_ref == 1);
+f0103b1d:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f0103b22:	0f 85 6e 06 00 00    	jne    f0104196 <mem_init+0xf7e>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U);
+f0103b28:	83 ec 04             	sub    $0x4,%esp
+f0103b2b:	6a 00                	push   $0x0
+f0103b2d:	68 00 10 00 00       	push   $0x1000
+f0103b32:	57                   	push   %edi
+f0103b33:	e8 28 ea ff ff       	call   f0102560 <pgdir_walk>
+f0103b38:	83 c4 10             	add    $0x10,%esp
+f0103b3b:	f6 00 04             	testb  $0x4,(%eax)
+f0103b3e:	0f 84 6b 06 00 00    	je     f01041af <mem_init+0xf97>
+	assert(kern_pgdir[0] & PTE_U);
+f0103b44:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+f0103b49:	f6 00 04             	testb  $0x4,(%eax)
+f0103b4c:	0f 84 76 06 00 00    	je     f01041c8 <mem_init+0xfb0>
+
+	// should be able to remap with fewer permissions
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0103b52:	6a 02                	push   $0x2
+f0103b54:	68 00 10 00 00       	push   $0x1000
+f0103b59:	56                   	push   %esi
+f0103b5a:	50                   	push   %eax
+f0103b5b:	e8 e8 ed ff ff       	call   f0102948 <page_insert>
+f0103b60:	83 c4 10             	add    $0x10,%esp
+f0103b63:	85 c0                	test   %eax,%eax
+f0103b65:	0f 85 76 06 00 00    	jne    f01041e1 <mem_init+0xfc9>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_W);
+f0103b6b:	83 ec 04             	sub    $0x4,%esp
+f0103b6e:	6a 00                	push   $0x0
+f0103b70:	68 00 10 00 00       	push   $0x1000
+f0103b75:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103b7b:	e8 e0 e9 ff ff       	call   f0102560 <pgdir_walk>
+f0103b80:	83 c4 10             	add    $0x10,%esp
+f0103b83:	f6 00 02             	testb  $0x2,(%eax)
+f0103b86:	0f 84 6e 06 00 00    	je     f01041fa <mem_init+0xfe2>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f0103b8c:	83 ec 04             	sub    $0x4,%esp
+f0103b8f:	6a 00                	push   $0x0
+f0103b91:	68 00 10 00 00       	push   $0x1000
+f0103b96:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103b9c:	e8 bf e9 ff ff       	call   f0102560 <pgdir_walk>
+f0103ba1:	83 c4 10             	add    $0x10,%esp
+f0103ba4:	f6 00 04             	testb  $0x4,(%eax)
+f0103ba7:	0f 85 66 06 00 00    	jne    f0104213 <mem_init+0xffb>
+
+	// should not be able to map at PTSIZE because need free page for page table
+	assert(page_insert(kern_pgdir, pp0, (void*) PTSIZE, PTE_W) < 0);
+f0103bad:	6a 02                	push   $0x2
+f0103baf:	68 00 00 40 00       	push   $0x400000
+f0103bb4:	ff 75 d4             	push   -0x2c(%ebp)
+f0103bb7:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103bbd:	e8 86 ed ff ff       	call   f0102948 <page_insert>
+f0103bc2:	83 c4 10             	add    $0x10,%esp
+f0103bc5:	85 c0                	test   %eax,%eax
+f0103bc7:	0f 89 5f 06 00 00    	jns    f010422c <mem_init+0x1014>
+
+	// insert pp1 at PGSIZE (replacing pp2)
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W) == 0);
+f0103bcd:	6a 02                	push   $0x2
+f0103bcf:	68 00 10 00 00       	push   $0x1000
+f0103bd4:	53                   	push   %ebx
+f0103bd5:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103bdb:	e8 68 ed ff ff       	call   f0102948 <page_insert>
+f0103be0:	83 c4 10             	add    $0x10,%esp
+f0103be3:	85 c0                	test   %eax,%eax
+f0103be5:	0f 85 5a 06 00 00    	jne    f0104245 <mem_init+0x102d>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f0103beb:	83 ec 04             	sub    $0x4,%esp
+f0103bee:	6a 00                	push   $0x0
+f0103bf0:	68 00 10 00 00       	push   $0x1000
+f0103bf5:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103bfb:	e8 60 e9 ff ff       	call   f0102560 <pgdir_walk>
+f0103c00:	83 c4 10             	add    $0x10,%esp
+f0103c03:	f6 00 04             	testb  $0x4,(%eax)
+f0103c06:	0f 85 52 06 00 00    	jne    f010425e <mem_init+0x1046>
+
+	// should have pp1 at both 0 and PGSIZE, pp2 nowhere, ...
+	assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f0103c0c:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+f0103c11:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0103c14:	ba 00 00 00 00       	mov    $0x0,%edx
+f0103c19:	e8 51 dd ff ff       	call   f010196f <check_va2pa>
+f0103c1e:	89 df                	mov    %ebx,%edi
+f0103c20:	2b 3d 80 89 61 f0    	sub    0xf0618980,%edi
+f0103c26:	c1 ff 02             	sar    $0x2,%edi
+f0103c29:	69 ff ab aa aa aa    	imul   $0xaaaaaaab,%edi,%edi
+f0103c2f:	c1 e7 0c             	shl    $0xc,%edi
+f0103c32:	39 f8                	cmp    %edi,%eax
+f0103c34:	0f 85 3d 06 00 00    	jne    f0104277 <mem_init+0x105f>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0103c3a:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103c3f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0103c42:	e8 28 dd ff ff       	call   f010196f <check_va2pa>
+f0103c47:	39 c7                	cmp    %eax,%edi
+f0103c49:	0f 85 41 06 00 00    	jne    f0104290 <mem_init+0x1078>
+	// ... and ref counts should reflect this
+	assert(pp1->pp_ref == 2);
+f0103c4f:	66 83 7b 04 02       	cmpw   $0x2,0x4(%ebx)
+f0103c54:	0f 85 4f 06 00 00    	jne    f01042a9 <mem_init+0x1091>
+	assert(pp2->pp_ref == 0);
+f0103c5a:	66 83 7e 04 00       	cmpw   $0x0,0x4(%esi)
+f0103c5f:	0f 85 5d 06 00 00    	jne    f01042c2 <mem_init+0x10aa>
+
+	// pp2 should be returned by page_alloc
+	assert((pp = page_alloc(0)) && pp == pp2);
+f0103c65:	83 ec 0c             	sub    $0xc,%esp
+f0103c68:	6a 00                	push   $0x0
+f0103c6a:	e8 5b e6 ff ff       	call   f01022ca <page_alloc>
+f0103c6f:	83 c4 10             	add    $0x10,%esp
+f0103c72:	85 c0                	test   %eax,%eax
+f0103c74:	0f 84 61 06 00 00    	je     f01042db <mem_init+0x10c3>
+f0103c7a:	39 c6                	cmp    %eax,%esi
+f0103c7c:	0f 85 59 06 00 00    	jne    f01042db <mem_init+0x10c3>
+
+	// unmapping pp1 at 0 should keep pp1 at PGSIZE
+	page_remove(kern_pgdir, 0x0);
+f0103c82:	83 ec 08             	sub    $0x8,%esp
+f0103c85:	6a 00                	push   $0x0
+f0103c87:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103c8d:	e8 01 ec ff ff       	call   f0102893 <page_remove>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0103c92:	8b 3d 7c 89 61 f0    	mov    0xf061897c,%edi
+f0103c98:	ba 00 00 00 00       	mov    $0x0,%edx
+f0103c9d:	89 f8                	mov    %edi,%eax
+f0103c9f:	e8 cb dc ff ff       	call   f010196f <check_va2pa>
+f0103ca4:	83 c4 10             	add    $0x10,%esp
+f0103ca7:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0103caa:	0f 85 44 06 00 00    	jne    f01042f4 <mem_init+0x10dc>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0103cb0:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103cb5:	89 f8                	mov    %edi,%eax
+f0103cb7:	e8 b3 dc ff ff       	call   f010196f <check_va2pa>
+f0103cbc:	89 c2                	mov    %eax,%edx
+f0103cbe:	89 d8                	mov    %ebx,%eax
+f0103cc0:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0103cc6:	c1 f8 02             	sar    $0x2,%eax
+f0103cc9:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103ccf:	c1 e0 0c             	shl    $0xc,%eax
+f0103cd2:	39 c2                	cmp    %eax,%edx
+f0103cd4:	0f 85 33 06 00 00    	jne    f010430d <mem_init+0x10f5>
+	assert(pp1->pp_ref == 1);
+f0103cda:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0103cdf:	0f 85 41 06 00 00    	jne    f0104326 <mem_init+0x110e>
+	assert(pp2->pp_ref == 0);
+f0103ce5:	66 83 7e 04 00       	cmpw   $0x0,0x4(%esi)
+f0103cea:	0f 85 4f 06 00 00    	jne    f010433f <mem_init+0x1127>
+
+	// test re-inserting pp1 at PGSIZE
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, 0) == 0);
+f0103cf0:	6a 00                	push   $0x0
+f0103cf2:	68 00 10 00 00       	push   $0x1000
+f0103cf7:	53                   	push   %ebx
+f0103cf8:	57                   	push   %edi
+f0103cf9:	e8 4a ec ff ff       	call   f0102948 <page_insert>
+f0103cfe:	83 c4 10             	add    $0x10,%esp
+f0103d01:	85 c0                	test   %eax,%eax
+f0103d03:	0f 85 4f 06 00 00    	jne    f0104358 <mem_init+0x1140>
+	assert(pp1->pp_ref);
+f0103d09:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0103d0e:	0f 84 5d 06 00 00    	je     f0104371 <mem_init+0x1159>
+	assert(pp1->pp_link == NULL);
+f0103d14:	83 3b 00             	cmpl   $0x0,(%ebx)
+f0103d17:	0f 85 6d 06 00 00    	jne    f010438a <mem_init+0x1172>
+
+	// unmapping pp1 at PGSIZE should free it
+	page_remove(kern_pgdir, (void*) PGSIZE);
+f0103d1d:	83 ec 08             	sub    $0x8,%esp
+f0103d20:	68 00 10 00 00       	push   $0x1000
+f0103d25:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103d2b:	e8 63 eb ff ff       	call   f0102893 <page_remove>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0103d30:	8b 3d 7c 89 61 f0    	mov    0xf061897c,%edi
+f0103d36:	ba 00 00 00 00       	mov    $0x0,%edx
+f0103d3b:	89 f8                	mov    %edi,%eax
+f0103d3d:	e8 2d dc ff ff       	call   f010196f <check_va2pa>
+f0103d42:	83 c4 10             	add    $0x10,%esp
+f0103d45:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0103d48:	0f 85 55 06 00 00    	jne    f01043a3 <mem_init+0x118b>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f0103d4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103d53:	89 f8                	mov    %edi,%eax
+f0103d55:	e8 15 dc ff ff       	call   f010196f <check_va2pa>
+f0103d5a:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0103d5d:	0f 85 59 06 00 00    	jne    f01043bc <mem_init+0x11a4>
+	assert(pp1->pp_ref == 0);
+f0103d63:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0103d68:	0f 85 67 06 00 00    	jne    f01043d5 <mem_init+0x11bd>
+	assert(pp2->pp_ref == 0);
+f0103d6e:	66 83 7e 04 00       	cmpw   $0x0,0x4(%esi)
+f0103d73:	0f 85 75 06 00 00    	jne    f01043ee <mem_init+0x11d6>
+
+	// so it should be returned by page_alloc
+	assert((pp = page_alloc(0)) && pp == pp1);
+f0103d79:	83 ec 0c             	sub    $0xc,%esp
+f0103d7c:	6a 00                	push   $0x0
+f0103d7e:	e8 47 e5 ff ff       	call   f01022ca <page_alloc>
+f0103d83:	83 c4 10             	add    $0x10,%esp
+f0103d86:	39 c3                	cmp    %eax,%ebx
+f0103d88:	0f 85 79 06 00 00    	jne    f0104407 <mem_init+0x11ef>
+f0103d8e:	85 c0                	test   %eax,%eax
+f0103d90:	0f 84 71 06 00 00    	je     f0104407 <mem_init+0x11ef>
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f0103d96:	83 ec 0c             	sub    $0xc,%esp
+f0103d99:	6a 00                	push   $0x0
+f0103d9b:	e8 2a e5 ff ff       	call   f01022ca <page_alloc>
+f0103da0:	83 c4 10             	add    $0x10,%esp
+f0103da3:	85 c0                	test   %eax,%eax
+f0103da5:	0f 85 75 06 00 00    	jne    f0104420 <mem_init+0x1208>
+
+	// forcibly take pp0 back
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0103dab:	8b 0d 7c 89 61 f0    	mov    0xf061897c,%ecx
+f0103db1:	8b 11                	mov    (%ecx),%edx
+f0103db3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0103db9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103dbc:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0103dc2:	c1 f8 02             	sar    $0x2,%eax
+f0103dc5:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103dcb:	c1 e0 0c             	shl    $0xc,%eax
+f0103dce:	39 c2                	cmp    %eax,%edx
+f0103dd0:	0f 85 63 06 00 00    	jne    f0104439 <mem_init+0x1221>
+	kern_pgdir[0] = 0;
+f0103dd6:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	assert(pp0->pp_ref == 1);
+f0103ddc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103ddf:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0103de4:	0f 85 68 06 00 00    	jne    f0104452 <mem_init+0x123a>
+	pp0->pp_ref = 0;
+f0103dea:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103ded:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+
+	// check pointer arithmetic in pgdir_walk
+	page_free(pp0);
+f0103df3:	83 ec 0c             	sub    $0xc,%esp
+f0103df6:	50                   	push   %eax
+f0103df7:	e8 b5 e0 ff ff       	call   f0101eb1 <page_free>
+	va = (void*)(PGSIZE * NPDENTRIES + PGSIZE);
+	ptep = pgdir_walk(kern_pgdir, va, 1);
+f0103dfc:	83 c4 0c             	add    $0xc,%esp
+f0103dff:	6a 01                	push   $0x1
+f0103e01:	68 00 10 40 00       	push   $0x401000
+f0103e06:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103e0c:	e8 4f e7 ff ff       	call   f0102560 <pgdir_walk>
+f0103e11:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	ptep1 = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(va)]));
+f0103e14:	8b 0d 7c 89 61 f0    	mov    0xf061897c,%ecx
+f0103e1a:	8b 41 04             	mov    0x4(%ecx),%eax
+f0103e1d:	89 c7                	mov    %eax,%edi
+f0103e1f:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	if (PGNUM(pa) >= npages_lowmem)
+f0103e25:	8b 15 6c 89 61 f0    	mov    0xf061896c,%edx
+f0103e2b:	c1 e8 0c             	shr    $0xc,%eax
+f0103e2e:	83 c4 10             	add    $0x10,%esp
+f0103e31:	39 d0                	cmp    %edx,%eax
+f0103e33:	0f 83 32 06 00 00    	jae    f010446b <mem_init+0x1253>
+	assert(ptep == ptep1 + PTX(va));
+f0103e39:	81 ef fc ff ff 0f    	sub    $0xffffffc,%edi
+f0103e3f:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+f0103e42:	0f 85 38 06 00 00    	jne    f0104480 <mem_init+0x1268>
+	kern_pgdir[PDX(va)] = 0;
+f0103e48:	c7 41 04 00 00 00 00 	movl   $0x0,0x4(%ecx)
+	pp0->pp_ref = 0;
+f0103e4f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103e52:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f0103e58:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0103e5e:	c1 f8 02             	sar    $0x2,%eax
+f0103e61:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103e67:	89 c1                	mov    %eax,%ecx
+f0103e69:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages_lowmem)
+f0103e6c:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103e71:	39 d0                	cmp    %edx,%eax
+f0103e73:	0f 83 20 06 00 00    	jae    f0104499 <mem_init+0x1281>
+
+	// check that new page tables get cleared
+	memset(page2kva(pp0), 0xFF, PGSIZE);
+f0103e79:	83 ec 04             	sub    $0x4,%esp
+f0103e7c:	68 00 10 00 00       	push   $0x1000
+f0103e81:	68 ff 00 00 00       	push   $0xff
+	return (void *)(pa + KERNBASE);
+f0103e86:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0103e8c:	51                   	push   %ecx
+f0103e8d:	e8 6c 67 00 00       	call   f010a5fe <memset>
+	page_free(pp0);
+f0103e92:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f0103e95:	89 3c 24             	mov    %edi,(%esp)
+f0103e98:	e8 14 e0 ff ff       	call   f0101eb1 <page_free>
+	pgdir_walk(kern_pgdir, 0x0, 1);
+f0103e9d:	83 c4 0c             	add    $0xc,%esp
+f0103ea0:	6a 01                	push   $0x1
+f0103ea2:	6a 00                	push   $0x0
+f0103ea4:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0103eaa:	e8 b1 e6 ff ff       	call   f0102560 <pgdir_walk>
+	return (pp - pages) << PGSHIFT;
+f0103eaf:	89 f8                	mov    %edi,%eax
+f0103eb1:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0103eb7:	c1 f8 02             	sar    $0x2,%eax
+f0103eba:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103ec0:	89 c1                	mov    %eax,%ecx
+f0103ec2:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages_lowmem)
+f0103ec5:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103eca:	83 c4 10             	add    $0x10,%esp
+f0103ecd:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0103ed3:	0f 83 d2 05 00 00    	jae    f01044ab <mem_init+0x1293>
+	return (void *)(pa + KERNBASE);
+f0103ed9:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+	ptep = (pte_t *) page2kva(pp0);
+	for(i=0; i<NPTENTRIES; i++)
+f0103edf:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f0103ee5:	39 c8                	cmp    %ecx,%eax
+f0103ee7:	0f 84 d0 05 00 00    	je     f01044bd <mem_init+0x12a5>
+		assert((ptep[i] & PTE_P) == 0);
+f0103eed:	8b 10                	mov    (%eax),%edx
+f0103eef:	83 c0 04             	add    $0x4,%eax
+f0103ef2:	f6 c2 01             	test   $0x1,%dl
+f0103ef5:	74 ee                	je     f0103ee5 <mem_init+0xccd>
+f0103ef7:	68 f0 da 10 f0       	push   $0xf010daf0
+f0103efc:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103f01:	68 fa 07 00 00       	push   $0x7fa
+f0103f06:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103f0b:	e8 88 c1 ff ff       	call   f0100098 <_panic>
+	assert(nfree == 0);
+f0103f10:	68 30 da 10 f0       	push   $0xf010da30
+f0103f15:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103f1a:	68 15 07 00 00       	push   $0x715
+f0103f1f:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103f24:	e8 6f c1 ff ff       	call   f0100098 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0103f29:	68 3e d9 10 f0       	push   $0xf010d93e
+f0103f2e:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103f33:	68 7d 07 00 00       	push   $0x77d
+f0103f38:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103f3d:	e8 56 c1 ff ff       	call   f0100098 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0103f42:	68 54 d9 10 f0       	push   $0xf010d954
+f0103f47:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103f4c:	68 7e 07 00 00       	push   $0x77e
+f0103f51:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103f56:	e8 3d c1 ff ff       	call   f0100098 <_panic>
+	assert((pp2 = page_alloc(0)));
+f0103f5b:	68 6a d9 10 f0       	push   $0xf010d96a
+f0103f60:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103f65:	68 7f 07 00 00       	push   $0x77f
+f0103f6a:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103f6f:	e8 24 c1 ff ff       	call   f0100098 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0103f74:	68 80 d9 10 f0       	push   $0xf010d980
+f0103f79:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103f7e:	68 82 07 00 00       	push   $0x782
+f0103f83:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103f88:	e8 0b c1 ff ff       	call   f0100098 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0103f8d:	68 ec cf 10 f0       	push   $0xf010cfec
+f0103f92:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103f97:	68 83 07 00 00       	push   $0x783
+f0103f9c:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103fa1:	e8 f2 c0 ff ff       	call   f0100098 <_panic>
+	assert(!page_alloc(0));
+f0103fa6:	68 e9 d9 10 f0       	push   $0xf010d9e9
+f0103fab:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103fb0:	68 8a 07 00 00       	push   $0x78a
+f0103fb5:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103fba:	e8 d9 c0 ff ff       	call   f0100098 <_panic>
+	assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f0103fbf:	68 2c d0 10 f0       	push   $0xf010d02c
+f0103fc4:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103fc9:	68 8d 07 00 00       	push   $0x78d
+f0103fce:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103fd3:	e8 c0 c0 ff ff       	call   f0100098 <_panic>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f0103fd8:	68 64 d0 10 f0       	push   $0xf010d064
+f0103fdd:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103fe2:	68 90 07 00 00       	push   $0x790
+f0103fe7:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0103fec:	e8 a7 c0 ff ff       	call   f0100098 <_panic>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f0103ff1:	68 94 d0 10 f0       	push   $0xf010d094
+f0103ff6:	68 0d d8 10 f0       	push   $0xf010d80d
+f0103ffb:	68 94 07 00 00       	push   $0x794
+f0104000:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104005:	e8 8e c0 ff ff       	call   f0100098 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f010400a:	68 c4 d0 10 f0       	push   $0xf010d0c4
+f010400f:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104014:	68 95 07 00 00       	push   $0x795
+f0104019:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010401e:	e8 75 c0 ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f0104023:	68 ec d0 10 f0       	push   $0xf010d0ec
+f0104028:	68 0d d8 10 f0       	push   $0xf010d80d
+f010402d:	68 96 07 00 00       	push   $0x796
+f0104032:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104037:	e8 5c c0 ff ff       	call   f0100098 <_panic>
+	assert(pp1->pp_ref == 1);
+f010403c:	68 3b da 10 f0       	push   $0xf010da3b
+f0104041:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104046:	68 97 07 00 00       	push   $0x797
+f010404b:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104050:	e8 43 c0 ff ff       	call   f0100098 <_panic>
+	assert(pp0->pp_ref == 1);
+f0104055:	68 4c da 10 f0       	push   $0xf010da4c
+f010405a:	68 0d d8 10 f0       	push   $0xf010d80d
+f010405f:	68 98 07 00 00       	push   $0x798
+f0104064:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104069:	e8 2a c0 ff ff       	call   f0100098 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f010406e:	68 1c d1 10 f0       	push   $0xf010d11c
+f0104073:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104078:	68 9b 07 00 00       	push   $0x79b
+f010407d:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104082:	e8 11 c0 ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0104087:	68 58 d1 10 f0       	push   $0xf010d158
+f010408c:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104091:	68 9c 07 00 00       	push   $0x79c
+f0104096:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010409b:	e8 f8 bf ff ff       	call   f0100098 <_panic>
+	assert(pp2->pp_ref == 1);
+f01040a0:	68 5d da 10 f0       	push   $0xf010da5d
+f01040a5:	68 0d d8 10 f0       	push   $0xf010d80d
+f01040aa:	68 9d 07 00 00       	push   $0x79d
+f01040af:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01040b4:	e8 df bf ff ff       	call   f0100098 <_panic>
+	assert(!page_alloc(0));
+f01040b9:	68 e9 d9 10 f0       	push   $0xf010d9e9
+f01040be:	68 0d d8 10 f0       	push   $0xf010d80d
+f01040c3:	68 a0 07 00 00       	push   $0x7a0
+f01040c8:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01040cd:	e8 c6 bf ff ff       	call   f0100098 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f01040d2:	68 1c d1 10 f0       	push   $0xf010d11c
+f01040d7:	68 0d d8 10 f0       	push   $0xf010d80d
+f01040dc:	68 a3 07 00 00       	push   $0x7a3
+f01040e1:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01040e6:	e8 ad bf ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01040eb:	68 58 d1 10 f0       	push   $0xf010d158
+f01040f0:	68 0d d8 10 f0       	push   $0xf010d80d
+f01040f5:	68 a4 07 00 00       	push   $0x7a4
+f01040fa:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01040ff:	e8 94 bf ff ff       	call   f0100098 <_panic>
+	assert(pp2->pp_ref == 1);
+f0104104:	68 5d da 10 f0       	push   $0xf010da5d
+f0104109:	68 0d d8 10 f0       	push   $0xf010d80d
+f010410e:	68 a5 07 00 00       	push   $0x7a5
+f0104113:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104118:	e8 7b bf ff ff       	call   f0100098 <_panic>
+	assert(!page_alloc(0));
+f010411d:	68 e9 d9 10 f0       	push   $0xf010d9e9
+f0104122:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104127:	68 a9 07 00 00       	push   $0x7a9
+f010412c:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104131:	e8 62 bf ff ff       	call   f0100098 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0104136:	57                   	push   %edi
+f0104137:	68 1c c0 10 f0       	push   $0xf010c01c
+f010413c:	68 ac 07 00 00       	push   $0x7ac
+f0104141:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104146:	e8 4d bf ff ff       	call   f0100098 <_panic>
+	assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f010414b:	68 88 d1 10 f0       	push   $0xf010d188
+f0104150:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104155:	68 ad 07 00 00       	push   $0x7ad
+f010415a:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010415f:	e8 34 bf ff ff       	call   f0100098 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W|PTE_U) == 0);
+f0104164:	68 c8 d1 10 f0       	push   $0xf010d1c8
+f0104169:	68 0d d8 10 f0       	push   $0xf010d80d
+f010416e:	68 b0 07 00 00       	push   $0x7b0
+f0104173:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104178:	e8 1b bf ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f010417d:	68 58 d1 10 f0       	push   $0xf010d158
+f0104182:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104187:	68 b1 07 00 00       	push   $0x7b1
+f010418c:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104191:	e8 02 bf ff ff       	call   f0100098 <_panic>
+	assert(pp2->pp_ref == 1);
+f0104196:	68 5d da 10 f0       	push   $0xf010da5d
+f010419b:	68 0d d8 10 f0       	push   $0xf010d80d
+f01041a0:	68 b2 07 00 00       	push   $0x7b2
+f01041a5:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01041aa:	e8 e9 be ff ff       	call   f0100098 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U);
+f01041af:	68 08 d2 10 f0       	push   $0xf010d208
+f01041b4:	68 0d d8 10 f0       	push   $0xf010d80d
+f01041b9:	68 b3 07 00 00       	push   $0x7b3
+f01041be:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01041c3:	e8 d0 be ff ff       	call   f0100098 <_panic>
+	assert(kern_pgdir[0] & PTE_U);
+f01041c8:	68 6e da 10 f0       	push   $0xf010da6e
+f01041cd:	68 0d d8 10 f0       	push   $0xf010d80d
+f01041d2:	68 b4 07 00 00       	push   $0x7b4
+f01041d7:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01041dc:	e8 b7 be ff ff       	call   f0100098 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f01041e1:	68 1c d1 10 f0       	push   $0xf010d11c
+f01041e6:	68 0d d8 10 f0       	push   $0xf010d80d
+f01041eb:	68 b7 07 00 00       	push   $0x7b7
+f01041f0:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01041f5:	e8 9e be ff ff       	call   f0100098 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_W);
+f01041fa:	68 3c d2 10 f0       	push   $0xf010d23c
+f01041ff:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104204:	68 b8 07 00 00       	push   $0x7b8
+f0104209:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010420e:	e8 85 be ff ff       	call   f0100098 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f0104213:	68 70 d2 10 f0       	push   $0xf010d270
+f0104218:	68 0d d8 10 f0       	push   $0xf010d80d
+f010421d:	68 b9 07 00 00       	push   $0x7b9
+f0104222:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104227:	e8 6c be ff ff       	call   f0100098 <_panic>
+	assert(page_insert(kern_pgdir, pp0, (void*) PTSIZE, PTE_W) < 0);
+f010422c:	68 a8 d2 10 f0       	push   $0xf010d2a8
+f0104231:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104236:	68 bc 07 00 00       	push   $0x7bc
+f010423b:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104240:	e8 53 be ff ff       	call   f0100098 <_panic>
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W) == 0);
+f0104245:	68 e0 d2 10 f0       	push   $0xf010d2e0
+f010424a:	68 0d d8 10 f0       	push   $0xf010d80d
+f010424f:	68 bf 07 00 00       	push   $0x7bf
+f0104254:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104259:	e8 3a be ff ff       	call   f0100098 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f010425e:	68 70 d2 10 f0       	push   $0xf010d270
+f0104263:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104268:	68 c0 07 00 00       	push   $0x7c0
+f010426d:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104272:	e8 21 be ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f0104277:	68 1c d3 10 f0       	push   $0xf010d31c
+f010427c:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104281:	68 c3 07 00 00       	push   $0x7c3
+f0104286:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010428b:	e8 08 be ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0104290:	68 48 d3 10 f0       	push   $0xf010d348
+f0104295:	68 0d d8 10 f0       	push   $0xf010d80d
+f010429a:	68 c4 07 00 00       	push   $0x7c4
+f010429f:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01042a4:	e8 ef bd ff ff       	call   f0100098 <_panic>
+	assert(pp1->pp_ref == 2);
+f01042a9:	68 84 da 10 f0       	push   $0xf010da84
+f01042ae:	68 0d d8 10 f0       	push   $0xf010d80d
+f01042b3:	68 c6 07 00 00       	push   $0x7c6
+f01042b8:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01042bd:	e8 d6 bd ff ff       	call   f0100098 <_panic>
+	assert(pp2->pp_ref == 0);
+f01042c2:	68 95 da 10 f0       	push   $0xf010da95
+f01042c7:	68 0d d8 10 f0       	push   $0xf010d80d
+f01042cc:	68 c7 07 00 00       	push   $0x7c7
+f01042d1:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01042d6:	e8 bd bd ff ff       	call   f0100098 <_panic>
+	assert((pp = page_alloc(0)) && pp == pp2);
+f01042db:	68 78 d3 10 f0       	push   $0xf010d378
+f01042e0:	68 0d d8 10 f0       	push   $0xf010d80d
+f01042e5:	68 ca 07 00 00       	push   $0x7ca
+f01042ea:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01042ef:	e8 a4 bd ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f01042f4:	68 9c d3 10 f0       	push   $0xf010d39c
+f01042f9:	68 0d d8 10 f0       	push   $0xf010d80d
+f01042fe:	68 ce 07 00 00       	push   $0x7ce
+f0104303:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104308:	e8 8b bd ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f010430d:	68 48 d3 10 f0       	push   $0xf010d348
+f0104312:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104317:	68 cf 07 00 00       	push   $0x7cf
+f010431c:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104321:	e8 72 bd ff ff       	call   f0100098 <_panic>
+	assert(pp1->pp_ref == 1);
+f0104326:	68 3b da 10 f0       	push   $0xf010da3b
+f010432b:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104330:	68 d0 07 00 00       	push   $0x7d0
+f0104335:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010433a:	e8 59 bd ff ff       	call   f0100098 <_panic>
+	assert(pp2->pp_ref == 0);
+f010433f:	68 95 da 10 f0       	push   $0xf010da95
+f0104344:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104349:	68 d1 07 00 00       	push   $0x7d1
+f010434e:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104353:	e8 40 bd ff ff       	call   f0100098 <_panic>
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, 0) == 0);
+f0104358:	68 c0 d3 10 f0       	push   $0xf010d3c0
+f010435d:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104362:	68 d4 07 00 00       	push   $0x7d4
+f0104367:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010436c:	e8 27 bd ff ff       	call   f0100098 <_panic>
+	assert(pp1->pp_ref);
+f0104371:	68 a6 da 10 f0       	push   $0xf010daa6
+f0104376:	68 0d d8 10 f0       	push   $0xf010d80d
+f010437b:	68 d5 07 00 00       	push   $0x7d5
+f0104380:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104385:	e8 0e bd ff ff       	call   f0100098 <_panic>
+	assert(pp1->pp_link == NULL);
+f010438a:	68 b2 da 10 f0       	push   $0xf010dab2
+f010438f:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104394:	68 d6 07 00 00       	push   $0x7d6
+f0104399:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010439e:	e8 f5 bc ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f01043a3:	68 9c d3 10 f0       	push   $0xf010d39c
+f01043a8:	68 0d d8 10 f0       	push   $0xf010d80d
+f01043ad:	68 da 07 00 00       	push   $0x7da
+f01043b2:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01043b7:	e8 dc bc ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f01043bc:	68 f8 d3 10 f0       	push   $0xf010d3f8
+f01043c1:	68 0d d8 10 f0       	push   $0xf010d80d
+f01043c6:	68 db 07 00 00       	push   $0x7db
+f01043cb:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01043d0:	e8 c3 bc ff ff       	call   f0100098 <_panic>
+	assert(pp1->pp_ref == 0);
+f01043d5:	68 c7 da 10 f0       	push   $0xf010dac7
+f01043da:	68 0d d8 10 f0       	push   $0xf010d80d
+f01043df:	68 dc 07 00 00       	push   $0x7dc
+f01043e4:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01043e9:	e8 aa bc ff ff       	call   f0100098 <_panic>
+	assert(pp2->pp_ref == 0);
+f01043ee:	68 95 da 10 f0       	push   $0xf010da95
+f01043f3:	68 0d d8 10 f0       	push   $0xf010d80d
+f01043f8:	68 dd 07 00 00       	push   $0x7dd
+f01043fd:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104402:	e8 91 bc ff ff       	call   f0100098 <_panic>
+	assert((pp = page_alloc(0)) && pp == pp1);
+f0104407:	68 20 d4 10 f0       	push   $0xf010d420
+f010440c:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104411:	68 e0 07 00 00       	push   $0x7e0
+f0104416:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010441b:	e8 78 bc ff ff       	call   f0100098 <_panic>
+	assert(!page_alloc(0));
+f0104420:	68 e9 d9 10 f0       	push   $0xf010d9e9
+f0104425:	68 0d d8 10 f0       	push   $0xf010d80d
+f010442a:	68 e3 07 00 00       	push   $0x7e3
+f010442f:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104434:	e8 5f bc ff ff       	call   f0100098 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0104439:	68 c4 d0 10 f0       	push   $0xf010d0c4
+f010443e:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104443:	68 e6 07 00 00       	push   $0x7e6
+f0104448:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010444d:	e8 46 bc ff ff       	call   f0100098 <_panic>
+	assert(pp0->pp_ref == 1);
+f0104452:	68 4c da 10 f0       	push   $0xf010da4c
+f0104457:	68 0d d8 10 f0       	push   $0xf010d80d
+f010445c:	68 e8 07 00 00       	push   $0x7e8
+f0104461:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104466:	e8 2d bc ff ff       	call   f0100098 <_panic>
+f010446b:	57                   	push   %edi
+f010446c:	68 1c c0 10 f0       	push   $0xf010c01c
+f0104471:	68 ef 07 00 00       	push   $0x7ef
+f0104476:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010447b:	e8 18 bc ff ff       	call   f0100098 <_panic>
+	assert(ptep == ptep1 + PTX(va));
+f0104480:	68 d8 da 10 f0       	push   $0xf010dad8
+f0104485:	68 0d d8 10 f0       	push   $0xf010d80d
+f010448a:	68 f0 07 00 00       	push   $0x7f0
+f010448f:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104494:	e8 ff bb ff ff       	call   f0100098 <_panic>
+f0104499:	51                   	push   %ecx
+f010449a:	68 1c c0 10 f0       	push   $0xf010c01c
+f010449f:	6a 7d                	push   $0x7d
+f01044a1:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f01044a6:	e8 ed bb ff ff       	call   f0100098 <_panic>
+f01044ab:	51                   	push   %ecx
+f01044ac:	68 1c c0 10 f0       	push   $0xf010c01c
+f01044b1:	6a 7d                	push   $0x7d
+f01044b3:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f01044b8:	e8 db bb ff ff       	call   f0100098 <_panic>
+	kern_pgdir[0] = 0;
+f01044bd:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+f01044c2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	pp0->pp_ref = 0;
+f01044c8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01044cb:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+
+	// give free list back
+	page_free_list = fl;
+f01044d1:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f01044d4:	89 3d 8c 18 61 f0    	mov    %edi,0xf061188c
+
+	// free the pages we took
+	page_free(pp0);
+f01044da:	83 ec 0c             	sub    $0xc,%esp
+f01044dd:	50                   	push   %eax
+f01044de:	e8 ce d9 ff ff       	call   f0101eb1 <page_free>
+	page_free(pp1);
+f01044e3:	89 1c 24             	mov    %ebx,(%esp)
+f01044e6:	e8 c6 d9 ff ff       	call   f0101eb1 <page_free>
+	page_free(pp2);
+f01044eb:	89 34 24             	mov    %esi,(%esp)
+f01044ee:	e8 be d9 ff ff       	call   f0101eb1 <page_free>
+
+	// test mmio_map_region
+	mm1 = (uintptr_t) mmio_map_region(0, 4097);
+f01044f3:	83 c4 08             	add    $0x8,%esp
+f01044f6:	68 01 10 00 00       	push   $0x1001
+f01044fb:	6a 00                	push   $0x0
+f01044fd:	e8 ac ec ff ff       	call   f01031ae <mmio_map_region>
+f0104502:	89 c3                	mov    %eax,%ebx
+	mm2 = (uintptr_t) mmio_map_region(0, 4096);
+f0104504:	83 c4 08             	add    $0x8,%esp
+f0104507:	68 00 10 00 00       	push   $0x1000
+f010450c:	6a 00                	push   $0x0
+f010450e:	e8 9b ec ff ff       	call   f01031ae <mmio_map_region>
+f0104513:	89 c6                	mov    %eax,%esi
+	// check that they're in the right region
+	assert(mm1 >= MMIOBASE && mm1 + 8096 < MMIOLIM);
+f0104515:	8d 83 a0 1f 00 00    	lea    0x1fa0(%ebx),%eax
+f010451b:	83 c4 10             	add    $0x10,%esp
+f010451e:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f0104524:	0f 86 38 02 00 00    	jbe    f0104762 <mem_init+0x154a>
+f010452a:	3d ff ff bf ef       	cmp    $0xefbfffff,%eax
+f010452f:	0f 87 2d 02 00 00    	ja     f0104762 <mem_init+0x154a>
+	assert(mm2 >= MMIOBASE && mm2 + 8096 < MMIOLIM);
+f0104535:	8d 96 a0 1f 00 00    	lea    0x1fa0(%esi),%edx
+f010453b:	81 fa ff ff bf ef    	cmp    $0xefbfffff,%edx
+f0104541:	0f 97 c1             	seta   %cl
+f0104544:	81 fe ff ff 7f ef    	cmp    $0xef7fffff,%esi
+f010454a:	0f 96 c2             	setbe  %dl
+f010454d:	08 d1                	or     %dl,%cl
+f010454f:	88 4d bb             	mov    %cl,-0x45(%ebp)
+f0104552:	0f 85 23 02 00 00    	jne    f010477b <mem_init+0x1563>
+	// check that they're page-aligned
+	assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f0104558:	89 da                	mov    %ebx,%edx
+f010455a:	09 f2                	or     %esi,%edx
+f010455c:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f0104562:	0f 85 2c 02 00 00    	jne    f0104794 <mem_init+0x157c>
+	// check that they don't overlap
+	assert(mm1 + 8096 <= mm2);
+f0104568:	39 c6                	cmp    %eax,%esi
+f010456a:	0f 82 3d 02 00 00    	jb     f01047ad <mem_init+0x1595>
+	// check page mappings
+	assert(check_va2pa(kern_pgdir, mm1) == 0);
+f0104570:	8b 3d 7c 89 61 f0    	mov    0xf061897c,%edi
+f0104576:	89 da                	mov    %ebx,%edx
+f0104578:	89 f8                	mov    %edi,%eax
+f010457a:	e8 f0 d3 ff ff       	call   f010196f <check_va2pa>
+f010457f:	85 c0                	test   %eax,%eax
+f0104581:	0f 85 3f 02 00 00    	jne    f01047c6 <mem_init+0x15ae>
+	assert(check_va2pa(kern_pgdir, mm1+PGSIZE) == PGSIZE);
+f0104587:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+f010458d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0104590:	89 c2                	mov    %eax,%edx
+f0104592:	89 f8                	mov    %edi,%eax
+f0104594:	e8 d6 d3 ff ff       	call   f010196f <check_va2pa>
+f0104599:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f010459e:	0f 85 3b 02 00 00    	jne    f01047df <mem_init+0x15c7>
+	assert(check_va2pa(kern_pgdir, mm2) == 0);
+f01045a4:	89 f2                	mov    %esi,%edx
+f01045a6:	89 f8                	mov    %edi,%eax
+f01045a8:	e8 c2 d3 ff ff       	call   f010196f <check_va2pa>
+f01045ad:	85 c0                	test   %eax,%eax
+f01045af:	0f 85 43 02 00 00    	jne    f01047f8 <mem_init+0x15e0>
+	assert(check_va2pa(kern_pgdir, mm2+PGSIZE) == ~0);
+f01045b5:	8d 96 00 10 00 00    	lea    0x1000(%esi),%edx
+f01045bb:	89 f8                	mov    %edi,%eax
+f01045bd:	e8 ad d3 ff ff       	call   f010196f <check_va2pa>
+f01045c2:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01045c5:	0f 85 46 02 00 00    	jne    f0104811 <mem_init+0x15f9>
+	// check permissions
+	assert(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & (PTE_W|PTE_PWT|PTE_PCD));
+f01045cb:	83 ec 04             	sub    $0x4,%esp
+f01045ce:	6a 00                	push   $0x0
+f01045d0:	53                   	push   %ebx
+f01045d1:	57                   	push   %edi
+f01045d2:	e8 89 df ff ff       	call   f0102560 <pgdir_walk>
+f01045d7:	83 c4 10             	add    $0x10,%esp
+f01045da:	f6 00 1a             	testb  $0x1a,(%eax)
+f01045dd:	0f 84 47 02 00 00    	je     f010482a <mem_init+0x1612>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & PTE_U));
+f01045e3:	83 ec 04             	sub    $0x4,%esp
+f01045e6:	6a 00                	push   $0x0
+f01045e8:	53                   	push   %ebx
+f01045e9:	ff 35 7c 89 61 f0    	push   0xf061897c
+f01045ef:	e8 6c df ff ff       	call   f0102560 <pgdir_walk>
+f01045f4:	8b 00                	mov    (%eax),%eax
+f01045f6:	83 c4 10             	add    $0x10,%esp
+f01045f9:	83 e0 04             	and    $0x4,%eax
+f01045fc:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+f01045ff:	0f 85 3e 02 00 00    	jne    f0104843 <mem_init+0x162b>
+	// clear the mappings
+	*pgdir_walk(kern_pgdir, (void*) mm1, 0) = 0;
+f0104605:	83 ec 04             	sub    $0x4,%esp
+f0104608:	6a 00                	push   $0x0
+f010460a:	53                   	push   %ebx
+f010460b:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0104611:	e8 4a df ff ff       	call   f0102560 <pgdir_walk>
+f0104616:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	*pgdir_walk(kern_pgdir, (void*) mm1 + PGSIZE, 0) = 0;
+f010461c:	83 c4 0c             	add    $0xc,%esp
+f010461f:	6a 00                	push   $0x0
+f0104621:	ff 75 d4             	push   -0x2c(%ebp)
+f0104624:	ff 35 7c 89 61 f0    	push   0xf061897c
+f010462a:	e8 31 df ff ff       	call   f0102560 <pgdir_walk>
+f010462f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	*pgdir_walk(kern_pgdir, (void*) mm2, 0) = 0;
+f0104635:	83 c4 0c             	add    $0xc,%esp
+f0104638:	6a 00                	push   $0x0
+f010463a:	56                   	push   %esi
+f010463b:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0104641:	e8 1a df ff ff       	call   f0102560 <pgdir_walk>
+f0104646:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+	cprintf("check_page() succeeded!\n");
+f010464c:	c7 04 24 19 db 10 f0 	movl   $0xf010db19,(%esp)
+f0104653:	e8 a4 29 00 00       	call   f0106ffc <cprintf>
+	asm volatile("cpuid"
+f0104658:	b8 01 00 00 00       	mov    $0x1,%eax
+f010465d:	0f a2                	cpuid
+	page_zero_nt = !!(edx & CPUID_SSE2);
+f010465f:	89 d0                	mov    %edx,%eax
+f0104661:	c1 e8 1a             	shr    $0x1a,%eax
+f0104664:	83 e0 01             	and    $0x1,%eax
+f0104667:	a2 e1 17 61 f0       	mov    %al,0xf06117e1
+	if (edx & CPUID_PSE) {
+f010466c:	83 c4 10             	add    $0x10,%esp
+f010466f:	f6 c2 08             	test   $0x8,%dl
+f0104672:	74 0e                	je     f0104682 <mem_init+0x146a>
+		kern_cr4 |= CR4_PSE;
+f0104674:	83 0d 94 18 61 f0 10 	orl    $0x10,0xf0611894
+		page_pse = 1;
+f010467b:	c6 05 70 89 61 f0 01 	movb   $0x1,0xf0618970
+	if (edx & CPUID_PGE) {
+f0104682:	f6 c6 20             	test   $0x20,%dh
+f0104685:	74 14                	je     f010469b <mem_init+0x1483>
+		kern_cr4 |= CR4_PGE;
+f0104687:	81 0d 94 18 61 f0 80 	orl    $0x80,0xf0611894
+f010468e:	00 00 00 
+		kern_pte_g = PTE_G;
+f0104691:	c7 05 90 18 61 f0 00 	movl   $0x100,0xf0611890
+f0104698:	01 00 00 
+	boot_map_region(kern_pgdir, UPAGES, ROUNDUP(npages * sizeof(struct PageInfo), PGSIZE), PADDR(pages), PTE_U|PTE_P);
+f010469b:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01046a0:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01046a5:	0f 86 b1 01 00 00    	jbe    f010485c <mem_init+0x1644>
+f01046ab:	8b 15 78 89 61 f0    	mov    0xf0618978,%edx
+f01046b1:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f01046b4:	8d 0c 95 ff 0f 00 00 	lea    0xfff(,%edx,4),%ecx
+f01046bb:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f01046c1:	83 ec 08             	sub    $0x8,%esp
+f01046c4:	6a 05                	push   $0x5
+	return (physaddr_t)kva - KERNBASE;
+f01046c6:	05 00 00 00 10       	add    $0x10000000,%eax
+f01046cb:	50                   	push   %eax
+f01046cc:	ba 00 00 00 ef       	mov    $0xef000000,%edx
+f01046d1:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+f01046d6:	e8 24 df ff ff       	call   f01025ff <boot_map_region>
+	if (!pgdir_walk(kern_pgdir, (void *) UENVS, 1))
+f01046db:	83 c4 0c             	add    $0xc,%esp
+f01046de:	6a 01                	push   $0x1
+f01046e0:	68 00 00 c0 ee       	push   $0xeec00000
+f01046e5:	ff 35 7c 89 61 f0    	push   0xf061897c
+f01046eb:	e8 70 de ff ff       	call   f0102560 <pgdir_walk>
+f01046f0:	83 c4 10             	add    $0x10,%esp
+f01046f3:	85 c0                	test   %eax,%eax
+f01046f5:	0f 84 76 01 00 00    	je     f0104871 <mem_init+0x1659>
+	if ((uint32_t)kva < KERNBASE)
+f01046fb:	b8 00 f0 10 f0       	mov    $0xf010f000,%eax
+f0104700:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104705:	0f 86 7d 01 00 00    	jbe    f0104888 <mem_init+0x1670>
+	boot_map_region(kern_pgdir, KSTACKTOP - KSTKSIZE, KSTKSIZE, PADDR(bootstack), PTE_W|PTE_P);
+f010470b:	83 ec 08             	sub    $0x8,%esp
+f010470e:	6a 03                	push   $0x3
+f0104710:	68 00 f0 10 00       	push   $0x10f000
+f0104715:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f010471a:	ba 00 80 ff ef       	mov    $0xefff8000,%edx
+f010471f:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+f0104724:	e8 d6 de ff ff       	call   f01025ff <boot_map_region>
+	boot_map_region(kern_pgdir, KERNBASE, 0xffffffff - KERNBASE + 1, 0, PTE_W|PTE_P);
+f0104729:	83 c4 08             	add    $0x8,%esp
+f010472c:	6a 03                	push   $0x3
+f010472e:	6a 00                	push   $0x0
+f0104730:	b9 00 00 00 10       	mov    $0x10000000,%ecx
+f0104735:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+f010473a:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+f010473f:	e8 bb de ff ff       	call   f01025ff <boot_map_region>
+	for (i = 0; i < NCPU; i++) {
+f0104744:	c7 45 d4 00 a0 61 f0 	movl   $0xf061a000,-0x2c(%ebp)
+f010474b:	be 00 a0 65 f0       	mov    $0xf065a000,%esi
+f0104750:	83 c4 10             	add    $0x10,%esp
+f0104753:	bf 00 a0 61 f0       	mov    $0xf061a000,%edi
+f0104758:	bb 00 80 ff ef       	mov    $0xefff8000,%ebx
+f010475d:	e9 67 01 00 00       	jmp    f01048c9 <mem_init+0x16b1>
+	assert(mm1 >= MMIOBASE && mm1 + 8096 < MMIOLIM);
+f0104762:	68 44 d4 10 f0       	push   $0xf010d444
+f0104767:	68 0d d8 10 f0       	push   $0xf010d80d
+f010476c:	68 0a 08 00 00       	push   $0x80a
+f0104771:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104776:	e8 1d b9 ff ff       	call   f0100098 <_panic>
+	assert(mm2 >= MMIOBASE && mm2 + 8096 < MMIOLIM);
+f010477b:	68 6c d4 10 f0       	push   $0xf010d46c
+f0104780:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104785:	68 0b 08 00 00       	push   $0x80b
+f010478a:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010478f:	e8 04 b9 ff ff       	call   f0100098 <_panic>
+	assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f0104794:	68 94 d4 10 f0       	push   $0xf010d494
+f0104799:	68 0d d8 10 f0       	push   $0xf010d80d
+f010479e:	68 0d 08 00 00       	push   $0x80d
+f01047a3:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01047a8:	e8 eb b8 ff ff       	call   f0100098 <_panic>
+	assert(mm1 + 8096 <= mm2);
+f01047ad:	68 07 db 10 f0       	push   $0xf010db07
+f01047b2:	68 0d d8 10 f0       	push   $0xf010d80d
+f01047b7:	68 0f 08 00 00       	push   $0x80f
+f01047bc:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01047c1:	e8 d2 b8 ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, mm1) == 0);
+f01047c6:	68 bc d4 10 f0       	push   $0xf010d4bc
+f01047cb:	68 0d d8 10 f0       	push   $0xf010d80d
+f01047d0:	68 11 08 00 00       	push   $0x811
+f01047d5:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01047da:	e8 b9 b8 ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, mm1+PGSIZE) == PGSIZE);
+f01047df:	68 e0 d4 10 f0       	push   $0xf010d4e0
+f01047e4:	68 0d d8 10 f0       	push   $0xf010d80d
+f01047e9:	68 12 08 00 00       	push   $0x812
+f01047ee:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01047f3:	e8 a0 b8 ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, mm2) == 0);
+f01047f8:	68 10 d5 10 f0       	push   $0xf010d510
+f01047fd:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104802:	68 13 08 00 00       	push   $0x813
+f0104807:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010480c:	e8 87 b8 ff ff       	call   f0100098 <_panic>
+	assert(check_va2pa(kern_pgdir, mm2+PGSIZE) == ~0);
+f0104811:	68 34 d5 10 f0       	push   $0xf010d534
+f0104816:	68 0d d8 10 f0       	push   $0xf010d80d
+f010481b:	68 14 08 00 00       	push   $0x814
+f0104820:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104825:	e8 6e b8 ff ff       	call   f0100098 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & (PTE_W|PTE_PWT|PTE_PCD));
+f010482a:	68 60 d5 10 f0       	push   $0xf010d560
+f010482f:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104834:	68 16 08 00 00       	push   $0x816
+f0104839:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010483e:	e8 55 b8 ff ff       	call   f0100098 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & PTE_U));
+f0104843:	68 a4 d5 10 f0       	push   $0xf010d5a4
+f0104848:	68 0d d8 10 f0       	push   $0xf010d80d
+f010484d:	68 17 08 00 00       	push   $0x817
+f0104852:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104857:	e8 3c b8 ff ff       	call   f0100098 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010485c:	50                   	push   %eax
+f010485d:	68 e8 cc 10 f0       	push   $0xf010cce8
+f0104862:	68 38 01 00 00       	push   $0x138
+f0104867:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f010486c:	e8 27 b8 ff ff       	call   f0100098 <_panic>
+		panic("mem_init: out of memory");
+f0104871:	83 ec 04             	sub    $0x4,%esp
+f0104874:	68 fc db 10 f0       	push   $0xf010dbfc
+f0104879:	68 46 01 00 00       	push   $0x146
+f010487e:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104883:	e8 10 b8 ff ff       	call   f0100098 <_panic>
+f0104888:	50                   	push   %eax
+f0104889:	68 e8 cc 10 f0       	push   $0xf010cce8
+f010488e:	68 53 01 00 00       	push   $0x153
+f0104893:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104898:	e8 fb b7 ff ff       	call   f0100098 <_panic>
+		boot_map_region(kern_pgdir, KSTACKTOP - i * (KSTKSIZE + KSTKGAP) - KSTKSIZE, KSTKSIZE, PADDR(percpu_kstacks[i]), PTE_W|PTE_P);
+f010489d:	83 ec 08             	sub    $0x8,%esp
+f01048a0:	6a 03                	push   $0x3
+	return (physaddr_t)kva - KERNBASE;
+f01048a2:	8d 87 00 00 00 10    	lea    0x10000000(%edi),%eax
+f01048a8:	50                   	push   %eax
+f01048a9:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f01048ae:	89 da                	mov    %ebx,%edx
+f01048b0:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+f01048b5:	e8 45 dd ff ff       	call   f01025ff <boot_map_region>
+	for (i = 0; i < NCPU; i++) {
+f01048ba:	81 eb 00 00 01 00    	sub    $0x10000,%ebx
+f01048c0:	81 c7 00 80 00 00    	add    $0x8000,%edi
+f01048c6:	83 c4 10             	add    $0x10,%esp
+f01048c9:	39 f7                	cmp    %esi,%edi
+f01048cb:	74 1d                	je     f01048ea <mem_init+0x16d2>
+	if ((uint32_t)kva < KERNBASE)
+f01048cd:	81 ff ff ff ff ef    	cmp    $0xefffffff,%edi
+f01048d3:	77 c8                	ja     f010489d <mem_init+0x1685>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01048d5:	57                   	push   %edi
+f01048d6:	68 e8 cc 10 f0       	push   $0xf010cce8
+f01048db:	68 b9 01 00 00       	push   $0x1b9
+f01048e0:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01048e5:	e8 ae b7 ff ff       	call   f0100098 <_panic>
+	if (!(kmap_ptes = pgdir_walk(kern_pgdir, (void *) KMAPBASE, 1)))
+f01048ea:	89 7d bc             	mov    %edi,-0x44(%ebp)
+f01048ed:	83 ec 04             	sub    $0x4,%esp
+f01048f0:	6a 01                	push   $0x1
+f01048f2:	68 00 00 c0 ef       	push   $0xefc00000
+f01048f7:	ff 35 7c 89 61 f0    	push   0xf061897c
+f01048fd:	e8 5e dc ff ff       	call   f0102560 <pgdir_walk>
+f0104902:	a3 f8 17 61 f0       	mov    %eax,0xf06117f8
+f0104907:	83 c4 10             	add    $0x10,%esp
+f010490a:	85 c0                	test   %eax,%eax
+f010490c:	74 38                	je     f0104946 <mem_init+0x172e>
+	pgdir = kern_pgdir;
+f010490e:	8b 35 7c 89 61 f0    	mov    0xf061897c,%esi
+	n = ROUNDUP(npages*sizeof(struct PageInfo), PGSIZE);
+f0104914:	8b 15 78 89 61 f0    	mov    0xf0618978,%edx
+f010491a:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f010491d:	8d 14 95 ff 0f 00 00 	lea    0xfff(,%edx,4),%edx
+f0104924:	89 d0                	mov    %edx,%eax
+f0104926:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f010492b:	8b 3d 80 89 61 f0    	mov    0xf0618980,%edi
+	return (physaddr_t)kva - KERNBASE;
+f0104931:	8d 8f 00 00 00 10    	lea    0x10000000(%edi),%ecx
+	for (i = 0; i < n; i += PGSIZE)
+f0104937:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+f010493a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+f010493d:	89 c6                	mov    %eax,%esi
+f010493f:	89 7d cc             	mov    %edi,-0x34(%ebp)
+f0104942:	89 cf                	mov    %ecx,%edi
+f0104944:	eb 35                	jmp    f010497b <mem_init+0x1763>
+		panic("mem_init_mp: out of memory");
+f0104946:	83 ec 04             	sub    $0x4,%esp
+f0104949:	68 32 db 10 f0       	push   $0xf010db32
+f010494e:	68 bf 01 00 00       	push   $0x1bf
+f0104953:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104958:	e8 3b b7 ff ff       	call   f0100098 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010495d:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f0104960:	57                   	push   %edi
+f0104961:	68 e8 cc 10 f0       	push   $0xf010cce8
+f0104966:	68 2d 07 00 00       	push   $0x72d
+f010496b:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104970:	e8 23 b7 ff ff       	call   f0100098 <_panic>
+	for (i = 0; i < n; i += PGSIZE)
+f0104975:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010497b:	39 f3                	cmp    %esi,%ebx
+f010497d:	73 37                	jae    f01049b6 <mem_init+0x179e>
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f010497f:	8d 93 00 00 00 ef    	lea    -0x11000000(%ebx),%edx
+f0104985:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0104988:	e8 e2 cf ff ff       	call   f010196f <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f010498d:	81 7d cc ff ff ff ef 	cmpl   $0xefffffff,-0x34(%ebp)
+f0104994:	76 c7                	jbe    f010495d <mem_init+0x1745>
+f0104996:	8d 14 3b             	lea    (%ebx,%edi,1),%edx
+f0104999:	39 d0                	cmp    %edx,%eax
+f010499b:	74 d8                	je     f0104975 <mem_init+0x175d>
+f010499d:	68 d8 d5 10 f0       	push   $0xf010d5d8
+f01049a2:	68 0d d8 10 f0       	push   $0xf010d80d
+f01049a7:	68 2d 07 00 00       	push   $0x72d
+f01049ac:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01049b1:	e8 e2 b6 ff ff       	call   f0100098 <_panic>
+f01049b6:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f01049b9:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+		assert(check_va2pa(pgdir, UENVS + i) == ~0);
+f01049be:	89 da                	mov    %ebx,%edx
+f01049c0:	89 f0                	mov    %esi,%eax
+f01049c2:	e8 a8 cf ff ff       	call   f010196f <check_va2pa>
+f01049c7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01049cd:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01049d0:	75 31                	jne    f0104a03 <mem_init+0x17eb>
+	for (i = 0; i < PTSIZE; i += PGSIZE)
+f01049d2:	81 fb 00 00 00 ef    	cmp    $0xef000000,%ebx
+f01049d8:	75 e4                	jne    f01049be <mem_init+0x17a6>
+	for (i = 0; i < npages_lowmem * PGSIZE; i += PGSIZE)
+f01049da:	8b 3d 6c 89 61 f0    	mov    0xf061896c,%edi
+f01049e0:	c1 e7 0c             	shl    $0xc,%edi
+f01049e3:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+f01049e6:	39 fb                	cmp    %edi,%ebx
+f01049e8:	73 4b                	jae    f0104a35 <mem_init+0x181d>
+		assert(check_va2pa(pgdir, KERNBASE + i) == i);
+f01049ea:	8d 93 00 00 00 f0    	lea    -0x10000000(%ebx),%edx
+f01049f0:	89 f0                	mov    %esi,%eax
+f01049f2:	e8 78 cf ff ff       	call   f010196f <check_va2pa>
+f01049f7:	39 c3                	cmp    %eax,%ebx
+f01049f9:	75 21                	jne    f0104a1c <mem_init+0x1804>
+	for (i = 0; i < npages_lowmem * PGSIZE; i += PGSIZE)
+f01049fb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0104a01:	eb e3                	jmp    f01049e6 <mem_init+0x17ce>
+		assert(check_va2pa(pgdir, UENVS + i) == ~0);
+f0104a03:	68 0c d6 10 f0       	push   $0xf010d60c
+f0104a08:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104a0d:	68 32 07 00 00       	push   $0x732
+f0104a12:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104a17:	e8 7c b6 ff ff       	call   f0100098 <_panic>
+		assert(check_va2pa(pgdir, KERNBASE + i) == i);
+f0104a1c:	68 30 d6 10 f0       	push   $0xf010d630
+f0104a21:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104a26:	68 36 07 00 00       	push   $0x736
+f0104a2b:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104a30:	e8 63 b6 ff ff       	call   f0100098 <_panic>
+f0104a35:	c7 45 c8 00 20 62 00 	movl   $0x622000,-0x38(%ebp)
+f0104a3c:	ba 00 00 ff ef       	mov    $0xefff0000,%edx
+f0104a41:	81 ea 00 a0 61 f0    	sub    $0xf061a000,%edx
+f0104a47:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+	for (i = 0; i < npages_lowmem * PGSIZE; i += PGSIZE)
+f0104a4a:	c7 45 cc 00 80 ff ef 	movl   $0xefff8000,-0x34(%ebp)
+f0104a51:	89 f7                	mov    %esi,%edi
+f0104a53:	e9 83 00 00 00       	jmp    f0104adb <mem_init+0x18c3>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0104a58:	ff 75 d4             	push   -0x2c(%ebp)
+f0104a5b:	68 e8 cc 10 f0       	push   $0xf010cce8
+f0104a60:	68 3e 07 00 00       	push   $0x73e
+f0104a65:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104a6a:	e8 29 b6 ff ff       	call   f0100098 <_panic>
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f0104a6f:	68 58 d6 10 f0       	push   $0xf010d658
+f0104a74:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104a79:	68 3d 07 00 00       	push   $0x73d
+f0104a7e:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104a83:	e8 10 b6 ff ff       	call   f0100098 <_panic>
+f0104a88:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f0104a8b:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+		for (i = 0; i < KSTKGAP; i += PGSIZE)
+f0104a8e:	39 de                	cmp    %ebx,%esi
+f0104a90:	74 2d                	je     f0104abf <mem_init+0x18a7>
+			assert(check_va2pa(pgdir, base + i) == ~0);
+f0104a92:	89 f2                	mov    %esi,%edx
+f0104a94:	89 f8                	mov    %edi,%eax
+f0104a96:	e8 d4 ce ff ff       	call   f010196f <check_va2pa>
+f0104a9b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0104aa1:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0104aa4:	74 e8                	je     f0104a8e <mem_init+0x1876>
+f0104aa6:	68 a0 d6 10 f0       	push   $0xf010d6a0
+f0104aab:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104ab0:	68 40 07 00 00       	push   $0x740
+f0104ab5:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104aba:	e8 d9 b5 ff ff       	call   f0100098 <_panic>
+	for (n = 0; n < NCPU; n++) {
+f0104abf:	81 6d cc 00 00 01 00 	subl   $0x10000,-0x34(%ebp)
+f0104ac6:	81 45 d4 00 80 00 00 	addl   $0x8000,-0x2c(%ebp)
+f0104acd:	81 45 c8 00 80 00 00 	addl   $0x8000,-0x38(%ebp)
+f0104ad4:	81 6d c4 00 80 01 00 	subl   $0x18000,-0x3c(%ebp)
+f0104adb:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+f0104ade:	39 4d d4             	cmp    %ecx,-0x2c(%ebp)
+f0104ae1:	74 55                	je     f0104b38 <mem_init+0x1920>
+		uint32_t base = KSTACKTOP - (KSTKSIZE + KSTKGAP) * (n + 1);
+f0104ae3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0104ae6:	8d b0 00 80 ff ff    	lea    -0x8000(%eax),%esi
+	return (physaddr_t)kva - KERNBASE;
+f0104aec:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0104aef:	8d 98 00 00 00 10    	lea    0x10000000(%eax),%ebx
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f0104af5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0104af8:	2d 00 80 ff 0f       	sub    $0xfff8000,%eax
+f0104afd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0104b00:	89 75 c0             	mov    %esi,-0x40(%ebp)
+f0104b03:	8b 75 c8             	mov    -0x38(%ebp),%esi
+		for (i = 0; i < KSTKSIZE; i += PGSIZE)
+f0104b06:	39 f3                	cmp    %esi,%ebx
+f0104b08:	0f 84 7a ff ff ff    	je     f0104a88 <mem_init+0x1870>
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f0104b0e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0104b11:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+f0104b14:	89 f8                	mov    %edi,%eax
+f0104b16:	e8 54 ce ff ff       	call   f010196f <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f0104b1b:	81 7d d4 ff ff ff ef 	cmpl   $0xefffffff,-0x2c(%ebp)
+f0104b22:	0f 86 30 ff ff ff    	jbe    f0104a58 <mem_init+0x1840>
+f0104b28:	39 d8                	cmp    %ebx,%eax
+f0104b2a:	0f 85 3f ff ff ff    	jne    f0104a6f <mem_init+0x1857>
+		for (i = 0; i < KSTKSIZE; i += PGSIZE)
+f0104b30:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0104b36:	eb ce                	jmp    f0104b06 <mem_init+0x18ee>
+f0104b38:	89 fe                	mov    %edi,%esi
+f0104b3a:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+f0104b3d:	eb 36                	jmp    f0104b75 <mem_init+0x195d>
+			assert(pgdir[i] & PTE_P);
+f0104b3f:	f6 04 86 01          	testb  $0x1,(%esi,%eax,4)
+f0104b43:	75 26                	jne    f0104b6b <mem_init+0x1953>
+f0104b45:	68 4d db 10 f0       	push   $0xf010db4d
+f0104b4a:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104b4f:	68 4b 07 00 00       	push   $0x74b
+f0104b54:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104b59:	e8 3a b5 ff ff       	call   f0100098 <_panic>
+				assert(pgdir[i] & PTE_P);
+f0104b5e:	8b 14 86             	mov    (%esi,%eax,4),%edx
+f0104b61:	f6 c2 01             	test   $0x1,%dl
+f0104b64:	74 40                	je     f0104ba6 <mem_init+0x198e>
+				assert(pgdir[i] & PTE_W);
+f0104b66:	f6 c2 02             	test   $0x2,%dl
+f0104b69:	74 54                	je     f0104bbf <mem_init+0x19a7>
+	for (i = 0; i < NPDENTRIES; i++) {
+f0104b6b:	83 c0 01             	add    $0x1,%eax
+f0104b6e:	3d 00 04 00 00       	cmp    $0x400,%eax
+f0104b73:	74 63                	je     f0104bd8 <mem_init+0x19c0>
+		switch (i) {
+f0104b75:	8d 90 45 fc ff ff    	lea    -0x3bb(%eax),%edx
+f0104b7b:	83 fa 04             	cmp    $0x4,%edx
+f0104b7e:	76 bf                	jbe    f0104b3f <mem_init+0x1927>
+			if (i >= PDX(KERNBASE)) {
+f0104b80:	3d bf 03 00 00       	cmp    $0x3bf,%eax
+f0104b85:	77 d7                	ja     f0104b5e <mem_init+0x1946>
+				assert(pgdir[i] == 0);
+f0104b87:	83 3c 86 00          	cmpl   $0x0,(%esi,%eax,4)
+f0104b8b:	74 de                	je     f0104b6b <mem_init+0x1953>
+f0104b8d:	68 6f db 10 f0       	push   $0xf010db6f
+f0104b92:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104b97:	68 52 07 00 00       	push   $0x752
+f0104b9c:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104ba1:	e8 f2 b4 ff ff       	call   f0100098 <_panic>
+				assert(pgdir[i] & PTE_P);
+f0104ba6:	68 4d db 10 f0       	push   $0xf010db4d
+f0104bab:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104bb0:	68 4f 07 00 00       	push   $0x74f
+f0104bb5:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104bba:	e8 d9 b4 ff ff       	call   f0100098 <_panic>
+				assert(pgdir[i] & PTE_W);
+f0104bbf:	68 5e db 10 f0       	push   $0xf010db5e
+f0104bc4:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104bc9:	68 50 07 00 00       	push   $0x750
+f0104bce:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104bd3:	e8 c0 b4 ff ff       	call   f0100098 <_panic>
+	cprintf("check_kern_pgdir() succeeded!\n");
+f0104bd8:	83 ec 0c             	sub    $0xc,%esp
+f0104bdb:	68 c4 d6 10 f0       	push   $0xf010d6c4
+f0104be0:	e8 17 24 00 00       	call   f0106ffc <cprintf>
+	__asm __volatile("movl %%cr4,%0" : "=r" (cr4));
+f0104be5:	0f 20 e0             	mov    %cr4,%eax
+	lcr4(rcr4() | kern_cr4);
+f0104be8:	0b 05 94 18 61 f0    	or     0xf0611894,%eax
+	__asm __volatile("movl %0,%%cr4" : : "r" (val));
+f0104bee:	0f 22 e0             	mov    %eax,%cr4
+	lcr3(PADDR(kern_pgdir));
+f0104bf1:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+f0104bf6:	83 c4 10             	add    $0x10,%esp
+f0104bf9:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104bfe:	0f 86 9c 02 00 00    	jbe    f0104ea0 <mem_init+0x1c88>
+	return (physaddr_t)kva - KERNBASE;
+f0104c04:	05 00 00 00 10       	add    $0x10000000,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0104c09:	0f 22 d8             	mov    %eax,%cr3
+	check_page_free_list(0);
+f0104c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104c11:	e8 ce cd ff ff       	call   f01019e4 <check_page_free_list>
+	__asm __volatile("movl %%cr0,%0" : "=r" (val));
+f0104c16:	0f 20 c0             	mov    %cr0,%eax
+	cr0 &= ~(CR0_TS|CR0_EM);
+f0104c19:	83 e0 f3             	and    $0xfffffff3,%eax
+f0104c1c:	0d 23 00 05 80       	or     $0x80050023,%eax
+	__asm __volatile("movl %0,%%cr0" : : "r" (val));
+f0104c21:	0f 22 c0             	mov    %eax,%cr0
+	uintptr_t va;
+	int i;
+
+	// check that we can read and write installed pages
+	pp1 = pp2 = 0;
+	assert((pp0 = page_alloc(0)));
+f0104c24:	83 ec 0c             	sub    $0xc,%esp
+f0104c27:	6a 00                	push   $0x0
+f0104c29:	e8 9c d6 ff ff       	call   f01022ca <page_alloc>
+f0104c2e:	89 c3                	mov    %eax,%ebx
+f0104c30:	83 c4 10             	add    $0x10,%esp
+f0104c33:	85 c0                	test   %eax,%eax
+f0104c35:	0f 84 7a 02 00 00    	je     f0104eb5 <mem_init+0x1c9d>
+	assert((pp1 = page_alloc(0)));
+f0104c3b:	83 ec 0c             	sub    $0xc,%esp
+f0104c3e:	6a 00                	push   $0x0
+f0104c40:	e8 85 d6 ff ff       	call   f01022ca <page_alloc>
+f0104c45:	89 c7                	mov    %eax,%edi
+f0104c47:	83 c4 10             	add    $0x10,%esp
+f0104c4a:	85 c0                	test   %eax,%eax
+f0104c4c:	0f 84 7c 02 00 00    	je     f0104ece <mem_init+0x1cb6>
+	assert((pp2 = page_alloc(0)));
+f0104c52:	83 ec 0c             	sub    $0xc,%esp
+f0104c55:	6a 00                	push   $0x0
+f0104c57:	e8 6e d6 ff ff       	call   f01022ca <page_alloc>
+f0104c5c:	89 c6                	mov    %eax,%esi
+f0104c5e:	83 c4 10             	add    $0x10,%esp
+f0104c61:	85 c0                	test   %eax,%eax
+f0104c63:	0f 84 7e 02 00 00    	je     f0104ee7 <mem_init+0x1ccf>
+	page_free(pp0);
+f0104c69:	83 ec 0c             	sub    $0xc,%esp
+f0104c6c:	53                   	push   %ebx
+f0104c6d:	e8 3f d2 ff ff       	call   f0101eb1 <page_free>
+	return (pp - pages) << PGSHIFT;
+f0104c72:	89 f8                	mov    %edi,%eax
+f0104c74:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0104c7a:	c1 f8 02             	sar    $0x2,%eax
+f0104c7d:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0104c83:	89 c2                	mov    %eax,%edx
+f0104c85:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages_lowmem)
+f0104c88:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0104c8d:	83 c4 10             	add    $0x10,%esp
+f0104c90:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0104c96:	0f 83 64 02 00 00    	jae    f0104f00 <mem_init+0x1ce8>
+	memset(page2kva(pp1), 1, PGSIZE);
+f0104c9c:	83 ec 04             	sub    $0x4,%esp
+f0104c9f:	68 00 10 00 00       	push   $0x1000
+f0104ca4:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f0104ca6:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0104cac:	52                   	push   %edx
+f0104cad:	e8 4c 59 00 00       	call   f010a5fe <memset>
+	return (pp - pages) << PGSHIFT;
+f0104cb2:	89 f0                	mov    %esi,%eax
+f0104cb4:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0104cba:	c1 f8 02             	sar    $0x2,%eax
+f0104cbd:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0104cc3:	89 c2                	mov    %eax,%edx
+f0104cc5:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages_lowmem)
+f0104cc8:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0104ccd:	83 c4 10             	add    $0x10,%esp
+f0104cd0:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0104cd6:	0f 83 36 02 00 00    	jae    f0104f12 <mem_init+0x1cfa>
+	memset(page2kva(pp2), 2, PGSIZE);
+f0104cdc:	83 ec 04             	sub    $0x4,%esp
+f0104cdf:	68 00 10 00 00       	push   $0x1000
+f0104ce4:	6a 02                	push   $0x2
+	return (void *)(pa + KERNBASE);
+f0104ce6:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0104cec:	52                   	push   %edx
+f0104ced:	e8 0c 59 00 00       	call   f010a5fe <memset>
+	page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W);
+f0104cf2:	6a 02                	push   $0x2
+f0104cf4:	68 00 10 00 00       	push   $0x1000
+f0104cf9:	57                   	push   %edi
+f0104cfa:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0104d00:	e8 43 dc ff ff       	call   f0102948 <page_insert>
+	assert(pp1->pp_ref == 1);
+f0104d05:	83 c4 20             	add    $0x20,%esp
+f0104d08:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0104d0d:	0f 85 11 02 00 00    	jne    f0104f24 <mem_init+0x1d0c>
+	assert(*(uint32_t *)PGSIZE == 0x01010101U);
+f0104d13:	81 3d 00 10 00 00 01 	cmpl   $0x1010101,0x1000
+f0104d1a:	01 01 01 
+f0104d1d:	0f 85 1a 02 00 00    	jne    f0104f3d <mem_init+0x1d25>
+	page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W);
+f0104d23:	6a 02                	push   $0x2
+f0104d25:	68 00 10 00 00       	push   $0x1000
+f0104d2a:	56                   	push   %esi
+f0104d2b:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0104d31:	e8 12 dc ff ff       	call   f0102948 <page_insert>
+	assert(*(uint32_t *)PGSIZE == 0x02020202U);
+f0104d36:	83 c4 10             	add    $0x10,%esp
+f0104d39:	81 3d 00 10 00 00 02 	cmpl   $0x2020202,0x1000
+f0104d40:	02 02 02 
+f0104d43:	0f 85 0d 02 00 00    	jne    f0104f56 <mem_init+0x1d3e>
+	assert(pp2->pp_ref == 1);
+f0104d49:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f0104d4e:	0f 85 1b 02 00 00    	jne    f0104f6f <mem_init+0x1d57>
+	assert(pp1->pp_ref == 0);
+f0104d54:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0104d59:	0f 85 29 02 00 00    	jne    f0104f88 <mem_init+0x1d70>
+	*(uint32_t *)PGSIZE = 0x03030303U;
+f0104d5f:	c7 05 00 10 00 00 03 	movl   $0x3030303,0x1000
+f0104d66:	03 03 03 
+	return (pp - pages) << PGSHIFT;
+f0104d69:	89 f0                	mov    %esi,%eax
+f0104d6b:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0104d71:	c1 f8 02             	sar    $0x2,%eax
+f0104d74:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0104d7a:	89 c2                	mov    %eax,%edx
+f0104d7c:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages_lowmem)
+f0104d7f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0104d84:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0104d8a:	0f 83 11 02 00 00    	jae    f0104fa1 <mem_init+0x1d89>
+	assert(*(uint32_t *)page2kva(pp2) == 0x03030303U);
+f0104d90:	81 ba 00 00 00 f0 03 	cmpl   $0x3030303,-0x10000000(%edx)
+f0104d97:	03 03 03 
+f0104d9a:	0f 85 13 02 00 00    	jne    f0104fb3 <mem_init+0x1d9b>
+	page_remove(kern_pgdir, (void*) PGSIZE);
+f0104da0:	83 ec 08             	sub    $0x8,%esp
+f0104da3:	68 00 10 00 00       	push   $0x1000
+f0104da8:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0104dae:	e8 e0 da ff ff       	call   f0102893 <page_remove>
+	assert(pp2->pp_ref == 0);
+f0104db3:	83 c4 10             	add    $0x10,%esp
+f0104db6:	66 83 7e 04 00       	cmpw   $0x0,0x4(%esi)
+f0104dbb:	0f 85 0b 02 00 00    	jne    f0104fcc <mem_init+0x1db4>
+
+	// forcibly take pp0 back
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0104dc1:	8b 0d 7c 89 61 f0    	mov    0xf061897c,%ecx
+f0104dc7:	8b 11                	mov    (%ecx),%edx
+f0104dc9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	return (pp - pages) << PGSHIFT;
+f0104dcf:	89 d8                	mov    %ebx,%eax
+f0104dd1:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f0104dd7:	c1 f8 02             	sar    $0x2,%eax
+f0104dda:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0104de0:	c1 e0 0c             	shl    $0xc,%eax
+f0104de3:	39 c2                	cmp    %eax,%edx
+f0104de5:	0f 85 fa 01 00 00    	jne    f0104fe5 <mem_init+0x1dcd>
+	kern_pgdir[0] = 0;
+f0104deb:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	assert(pp0->pp_ref == 1);
+f0104df1:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0104df6:	0f 85 02 02 00 00    	jne    f0104ffe <mem_init+0x1de6>
+	pp0->pp_ref = 0;
+f0104dfc:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+
+	// free the pages we took
+	page_free(pp0);
+f0104e02:	83 ec 0c             	sub    $0xc,%esp
+f0104e05:	53                   	push   %ebx
+f0104e06:	e8 a6 d0 ff ff       	call   f0101eb1 <page_free>
+
+	cprintf("check_page_installed_pgdir() succeeded!\n");
+f0104e0b:	c7 04 24 58 d7 10 f0 	movl   $0xf010d758,(%esp)
+f0104e12:	e8 e5 21 00 00       	call   f0106ffc <cprintf>
+	       (npages - npages_lowmem) * sizeof(struct PageInfo));
+f0104e17:	8b 15 6c 89 61 f0    	mov    0xf061896c,%edx
+	memset(pages + npages_lowmem, 0,
+f0104e1d:	83 c4 0c             	add    $0xc,%esp
+	       (npages - npages_lowmem) * sizeof(struct PageInfo));
+f0104e20:	a1 78 89 61 f0       	mov    0xf0618978,%eax
+f0104e25:	29 d0                	sub    %edx,%eax
+	memset(pages + npages_lowmem, 0,
+f0104e27:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0104e2a:	c1 e0 02             	shl    $0x2,%eax
+f0104e2d:	50                   	push   %eax
+f0104e2e:	6a 00                	push   $0x0
+f0104e30:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f0104e33:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0104e38:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0104e3b:	50                   	push   %eax
+f0104e3c:	e8 bd 57 00 00       	call   f010a5fe <memset>
+	spin_lock(&page_lock);
+f0104e41:	c7 04 24 e0 93 11 f0 	movl   $0xf01193e0,(%esp)
+f0104e48:	e8 86 60 00 00       	call   f010aed3 <spin_lock>
+	for (i = npages; i-- > npages_lowmem; ) {
+f0104e4d:	8b 0d 78 89 61 f0    	mov    0xf0618978,%ecx
+f0104e53:	8b 1d 00 18 61 f0    	mov    0xf0611800,%ebx
+f0104e59:	8b 3d fc 17 61 f0    	mov    0xf06117fc,%edi
+f0104e5f:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+f0104e62:	c1 e0 02             	shl    $0x2,%eax
+f0104e65:	83 c4 10             	add    $0x10,%esp
+f0104e68:	89 fa                	mov    %edi,%edx
+f0104e6a:	01 cf                	add    %ecx,%edi
+f0104e6c:	8d 4a 01             	lea    0x1(%edx),%ecx
+f0104e6f:	83 e8 0c             	sub    $0xc,%eax
+f0104e72:	89 fe                	mov    %edi,%esi
+f0104e74:	29 d6                	sub    %edx,%esi
+f0104e76:	39 35 6c 89 61 f0    	cmp    %esi,0xf061896c
+f0104e7c:	0f 83 95 01 00 00    	jae    f0105017 <mem_init+0x1dff>
+		pages[i].pp_order = -1;
+f0104e82:	89 c2                	mov    %eax,%edx
+f0104e84:	03 15 80 89 61 f0    	add    0xf0618980,%edx
+f0104e8a:	c6 42 06 ff          	movb   $0xff,0x6(%edx)
+		pages[i].pp_link = page_high_list;
+f0104e8e:	89 1a                	mov    %ebx,(%edx)
+		page_high_list = &pages[i];
+f0104e90:	89 c3                	mov    %eax,%ebx
+f0104e92:	03 1d 80 89 61 f0    	add    0xf0618980,%ebx
+f0104e98:	89 ca                	mov    %ecx,%edx
+f0104e9a:	c6 45 bb 01          	movb   $0x1,-0x45(%ebp)
+f0104e9e:	eb cc                	jmp    f0104e6c <mem_init+0x1c54>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0104ea0:	50                   	push   %eax
+f0104ea1:	68 e8 cc 10 f0       	push   $0xf010cce8
+f0104ea6:	68 6d 01 00 00       	push   $0x16d
+f0104eab:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104eb0:	e8 e3 b1 ff ff       	call   f0100098 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0104eb5:	68 3e d9 10 f0       	push   $0xf010d93e
+f0104eba:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104ebf:	68 2c 08 00 00       	push   $0x82c
+f0104ec4:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104ec9:	e8 ca b1 ff ff       	call   f0100098 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0104ece:	68 54 d9 10 f0       	push   $0xf010d954
+f0104ed3:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104ed8:	68 2d 08 00 00       	push   $0x82d
+f0104edd:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104ee2:	e8 b1 b1 ff ff       	call   f0100098 <_panic>
+	assert((pp2 = page_alloc(0)));
+f0104ee7:	68 6a d9 10 f0       	push   $0xf010d96a
+f0104eec:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104ef1:	68 2e 08 00 00       	push   $0x82e
+f0104ef6:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104efb:	e8 98 b1 ff ff       	call   f0100098 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0104f00:	52                   	push   %edx
+f0104f01:	68 1c c0 10 f0       	push   $0xf010c01c
+f0104f06:	6a 7d                	push   $0x7d
+f0104f08:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0104f0d:	e8 86 b1 ff ff       	call   f0100098 <_panic>
+f0104f12:	52                   	push   %edx
+f0104f13:	68 1c c0 10 f0       	push   $0xf010c01c
+f0104f18:	6a 7d                	push   $0x7d
+f0104f1a:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0104f1f:	e8 74 b1 ff ff       	call   f0100098 <_panic>
+	assert(pp1->pp_ref == 1);
+f0104f24:	68 3b da 10 f0       	push   $0xf010da3b
+f0104f29:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104f2e:	68 33 08 00 00       	push   $0x833
+f0104f33:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104f38:	e8 5b b1 ff ff       	call   f0100098 <_panic>
+	assert(*(uint32_t *)PGSIZE == 0x01010101U);
+f0104f3d:	68 e4 d6 10 f0       	push   $0xf010d6e4
+f0104f42:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104f47:	68 34 08 00 00       	push   $0x834
+f0104f4c:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104f51:	e8 42 b1 ff ff       	call   f0100098 <_panic>
+	assert(*(uint32_t *)PGSIZE == 0x02020202U);
+f0104f56:	68 08 d7 10 f0       	push   $0xf010d708
+f0104f5b:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104f60:	68 36 08 00 00       	push   $0x836
+f0104f65:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104f6a:	e8 29 b1 ff ff       	call   f0100098 <_panic>
+	assert(pp2->pp_ref == 1);
+f0104f6f:	68 5d da 10 f0       	push   $0xf010da5d
+f0104f74:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104f79:	68 37 08 00 00       	push   $0x837
+f0104f7e:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104f83:	e8 10 b1 ff ff       	call   f0100098 <_panic>
+	assert(pp1->pp_ref == 0);
+f0104f88:	68 c7 da 10 f0       	push   $0xf010dac7
+f0104f8d:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104f92:	68 38 08 00 00       	push   $0x838
+f0104f97:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104f9c:	e8 f7 b0 ff ff       	call   f0100098 <_panic>
+f0104fa1:	52                   	push   %edx
+f0104fa2:	68 1c c0 10 f0       	push   $0xf010c01c
+f0104fa7:	6a 7d                	push   $0x7d
+f0104fa9:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0104fae:	e8 e5 b0 ff ff       	call   f0100098 <_panic>
+	assert(*(uint32_t *)page2kva(pp2) == 0x03030303U);
+f0104fb3:	68 2c d7 10 f0       	push   $0xf010d72c
+f0104fb8:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104fbd:	68 3a 08 00 00       	push   $0x83a
+f0104fc2:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104fc7:	e8 cc b0 ff ff       	call   f0100098 <_panic>
+	assert(pp2->pp_ref == 0);
+f0104fcc:	68 95 da 10 f0       	push   $0xf010da95
+f0104fd1:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104fd6:	68 3c 08 00 00       	push   $0x83c
+f0104fdb:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104fe0:	e8 b3 b0 ff ff       	call   f0100098 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0104fe5:	68 c4 d0 10 f0       	push   $0xf010d0c4
+f0104fea:	68 0d d8 10 f0       	push   $0xf010d80d
+f0104fef:	68 3f 08 00 00       	push   $0x83f
+f0104ff4:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0104ff9:	e8 9a b0 ff ff       	call   f0100098 <_panic>
+	assert(pp0->pp_ref == 1);
+f0104ffe:	68 4c da 10 f0       	push   $0xf010da4c
+f0105003:	68 0d d8 10 f0       	push   $0xf010d80d
+f0105008:	68 41 08 00 00       	push   $0x841
+f010500d:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f0105012:	e8 81 b0 ff ff       	call   f0100098 <_panic>
+f0105017:	80 7d bb 00          	cmpb   $0x0,-0x45(%ebp)
+f010501b:	74 0c                	je     f0105029 <mem_init+0x1e11>
+f010501d:	89 1d 00 18 61 f0    	mov    %ebx,0xf0611800
+f0105023:	89 15 fc 17 61 f0    	mov    %edx,0xf06117fc
+	spin_unlock(&page_lock);
+f0105029:	83 ec 0c             	sub    $0xc,%esp
+f010502c:	68 e0 93 11 f0       	push   $0xf01193e0
+f0105031:	e8 b9 5f 00 00       	call   f010afef <spin_unlock>
+	page_zero_high = (npages > npages_lowmem);
+f0105036:	a1 78 89 61 f0       	mov    0xf0618978,%eax
+f010503b:	39 05 6c 89 61 f0    	cmp    %eax,0xf061896c
+f0105041:	0f 92 05 e0 17 61 f0 	setb   0xf06117e0
+	spin_lock(&page_lock);
+f0105048:	c7 04 24 e0 93 11 f0 	movl   $0xf01193e0,(%esp)
+f010504f:	e8 7f 5e 00 00       	call   f010aed3 <spin_lock>
+	while ((pp = page_free_list)) {
+f0105054:	83 c4 10             	add    $0x10,%esp
+f0105057:	a1 8c 18 61 f0       	mov    0xf061188c,%eax
+f010505c:	85 c0                	test   %eax,%eax
+f010505e:	74 1a                	je     f010507a <mem_init+0x1e62>
+		page_free_list = pp->pp_link;
+f0105060:	8b 10                	mov    (%eax),%edx
+f0105062:	89 15 8c 18 61 f0    	mov    %edx,0xf061188c
+		pp->pp_link = NULL;
+f0105068:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		buddy_free(pp, 0);
+f010506e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105073:	e8 b3 c5 ff ff       	call   f010162b <buddy_free>
+f0105078:	eb dd                	jmp    f0105057 <mem_init+0x1e3f>
+	page_buddy_ready = 1;
+f010507a:	c6 05 04 18 61 f0 01 	movb   $0x1,0xf0611804
+	spin_unlock(&page_lock);
+f0105081:	83 ec 0c             	sub    $0xc,%esp
+f0105084:	68 e0 93 11 f0       	push   $0xf01193e0
+f0105089:	e8 61 5f 00 00       	call   f010afef <spin_unlock>
+	if (!(zero_page = page_alloc(ALLOC_ZERO)))
+f010508e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f0105095:	e8 30 d2 ff ff       	call   f01022ca <page_alloc>
+f010509a:	a3 74 89 61 f0       	mov    %eax,0xf0618974
+f010509f:	83 c4 10             	add    $0x10,%esp
+f01050a2:	85 c0                	test   %eax,%eax
+f01050a4:	74 0d                	je     f01050b3 <mem_init+0x1e9b>
+	zero_page->pp_ref++;
+f01050a6:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+}
+f01050ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01050ae:	5b                   	pop    %ebx
+f01050af:	5e                   	pop    %esi
+f01050b0:	5f                   	pop    %edi
+f01050b1:	5d                   	pop    %ebp
+f01050b2:	c3                   	ret
+		panic("mem_init: out of memory");
+f01050b3:	83 ec 04             	sub    $0x4,%esp
+f01050b6:	68 fc db 10 f0       	push   $0xf010dbfc
+f01050bb:	68 81 01 00 00       	push   $0x181
+f01050c0:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01050c5:	e8 ce af ff ff       	call   f0100098 <_panic>
+
+f01050ca <user_mem_check>:
+{
+f01050ca:	55                   	push   %ebp
+f01050cb:	89 e5                	mov    %esp,%ebp
+f01050cd:	56                   	push   %esi
+f01050ce:	53                   	push   %ebx
+f01050cf:	8b 75 08             	mov    0x8(%ebp),%esi
+	env_lock(env);
+f01050d2:	83 ec 0c             	sub    $0xc,%esp
+f01050d5:	56                   	push   %esi
+f01050d6:	e8 7f 10 00 00       	call   f010615a <env_lock>
+	r = user_mem_check_locked(env, va, len, perm);
+f01050db:	83 c4 04             	add    $0x4,%esp
+f01050de:	ff 75 14             	push   0x14(%ebp)
+f01050e1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f01050e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01050e7:	89 f0                	mov    %esi,%eax
+f01050e9:	e8 dd db ff ff       	call   f0102ccb <user_mem_check_locked>
+f01050ee:	89 c3                	mov    %eax,%ebx
+	env_unlock(env);
+f01050f0:	89 34 24             	mov    %esi,(%esp)
+f01050f3:	e8 8e 10 00 00       	call   f0106186 <env_unlock>
+}
+f01050f8:	89 d8                	mov    %ebx,%eax
+f01050fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01050fd:	5b                   	pop    %ebx
+f01050fe:	5e                   	pop    %esi
+f01050ff:	5d                   	pop    %ebp
+f0105100:	c3                   	ret
+
+f0105101 <user_mem_assert>:
+{
+f0105101:	55                   	push   %ebp
+f0105102:	89 e5                	mov    %esp,%ebp
+f0105104:	53                   	push   %ebx
+f0105105:	83 ec 04             	sub    $0x4,%esp
+f0105108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (user_mem_check(env, va, len, perm | PTE_U) < 0) {
+f010510b:	8b 45 14             	mov    0x14(%ebp),%eax
+f010510e:	83 c8 04             	or     $0x4,%eax
+f0105111:	50                   	push   %eax
+f0105112:	ff 75 10             	push   0x10(%ebp)
+f0105115:	ff 75 0c             	push   0xc(%ebp)
+f0105118:	53                   	push   %ebx
+f0105119:	e8 ac ff ff ff       	call   f01050ca <user_mem_check>
+f010511e:	83 c4 10             	add    $0x10,%esp
+f0105121:	85 c0                	test   %eax,%eax
+f0105123:	78 05                	js     f010512a <user_mem_assert+0x29>
+}
+f0105125:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105128:	c9                   	leave
+f0105129:	c3                   	ret
+		cprintf("[%08x] user_mem_check assertion failure for "
+f010512a:	83 ec 04             	sub    $0x4,%esp
+f010512d:	ff 35 44 12 61 f0    	push   0xf0611244
+f0105133:	ff 73 4c             	push   0x4c(%ebx)
+f0105136:	68 84 d7 10 f0       	push   $0xf010d784
+f010513b:	e8 bc 1e 00 00       	call   f0106ffc <cprintf>
+		env_destroy(env);	// may not return
+f0105140:	89 1c 24             	mov    %ebx,(%esp)
+f0105143:	e8 79 1a 00 00       	call   f0106bc1 <env_destroy>
+f0105148:	83 c4 10             	add    $0x10,%esp
+}
+f010514b:	eb d8                	jmp    f0105125 <user_mem_assert+0x24>
+
+f010514d <user_mem_assert_lock>:
+{
+f010514d:	55                   	push   %ebp
+f010514e:	89 e5                	mov    %esp,%ebp
+f0105150:	53                   	push   %ebx
+f0105151:	83 ec 10             	sub    $0x10,%esp
+f0105154:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	env_lock(env);
+f0105157:	53                   	push   %ebx
+f0105158:	e8 fd 0f 00 00       	call   f010615a <env_lock>
+	if (user_mem_check_locked(env, va, len, perm | PTE_U) < 0) {
+f010515d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0105160:	83 c8 04             	or     $0x4,%eax
+f0105163:	89 04 24             	mov    %eax,(%esp)
+f0105166:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0105169:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010516c:	89 d8                	mov    %ebx,%eax
+f010516e:	e8 58 db ff ff       	call   f0102ccb <user_mem_check_locked>
+f0105173:	83 c4 10             	add    $0x10,%esp
+f0105176:	85 c0                	test   %eax,%eax
+f0105178:	78 05                	js     f010517f <user_mem_assert_lock+0x32>
+}
+f010517a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010517d:	c9                   	leave
+f010517e:	c3                   	ret
+		env_unlock(env);
+f010517f:	83 ec 0c             	sub    $0xc,%esp
+f0105182:	53                   	push   %ebx
+f0105183:	e8 fe 0f 00 00       	call   f0106186 <env_unlock>
+		cprintf("[%08x] user_mem_check assertion failure for "
+f0105188:	83 c4 0c             	add    $0xc,%esp
+f010518b:	ff 35 44 12 61 f0    	push   0xf0611244
+f0105191:	ff 73 4c             	push   0x4c(%ebx)
+f0105194:	68 84 d7 10 f0       	push   $0xf010d784
+f0105199:	e8 5e 1e 00 00       	call   f0106ffc <cprintf>
+		env_destroy(env);	// does not return
+f010519e:	89 1c 24             	mov    %ebx,(%esp)
+f01051a1:	e8 1b 1a 00 00       	call   f0106bc1 <env_destroy>
+		panic("user_mem_assert_lock: env_destroy returned");
+f01051a6:	83 c4 0c             	add    $0xc,%esp
+f01051a9:	68 bc d7 10 f0       	push   $0xf010d7bc
+f01051ae:	68 86 06 00 00       	push   $0x686
+f01051b3:	68 e7 d7 10 f0       	push   $0xf010d7e7
+f01051b8:	e8 db ae ff ff       	call   f0100098 <_panic>
+
+f01051bd <kmem_cache_init>:
+}
+
+static void
+kmem_cache_init(struct KmemCache *kc, const char *name, size_t size,
+		void (*ctor)(void *))
+{
+f01051bd:	55                   	push   %ebp
+f01051be:	89 e5                	mov    %esp,%ebp
+f01051c0:	57                   	push   %edi
+f01051c1:	56                   	push   %esi
+f01051c2:	53                   	push   %ebx
+f01051c3:	83 ec 20             	sub    $0x20,%esp
+f01051c6:	89 c3                	mov    %eax,%ebx
+f01051c8:	89 d6                	mov    %edx,%esi
+f01051ca:	89 cf                	mov    %ecx,%edi
+f01051cc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	int n;
+
+	memset(kc, 0, sizeof(*kc));
+f01051cf:	68 00 03 00 00       	push   $0x300
+f01051d4:	6a 00                	push   $0x0
+f01051d6:	50                   	push   %eax
+f01051d7:	e8 22 54 00 00       	call   f010a5fe <memset>
+	kc->kc_name = name;
+f01051dc:	89 33                	mov    %esi,(%ebx)
+	kc->kc_size = ROUNDUP(MAX(size, KMALLOC_MIN), 8);
+f01051de:	b8 10 00 00 00       	mov    $0x10,%eax
+f01051e3:	39 c7                	cmp    %eax,%edi
+f01051e5:	0f 43 c7             	cmovae %edi,%eax
+f01051e8:	83 c0 07             	add    $0x7,%eax
+f01051eb:	83 e0 f8             	and    $0xfffffff8,%eax
+f01051ee:	89 43 04             	mov    %eax,0x4(%ebx)
+	kc->kc_ctor = ctor;
+f01051f1:	8b 45 08             	mov    0x8(%ebp),%eax
+f01051f4:	89 43 0c             	mov    %eax,0xc(%ebx)
+	__spin_initlock(&kc->kc_lock, (char *) name);
+f01051f7:	83 c4 08             	add    $0x8,%esp
+f01051fa:	56                   	push   %esi
+f01051fb:	8d 43 10             	lea    0x10(%ebx),%eax
+f01051fe:	50                   	push   %eax
+f01051ff:	e8 a7 5c 00 00       	call   f010aeab <__spin_initlock>
+
+	// Fit as many objects as possible, with one index byte each.
+	n = (PGSIZE - sizeof(struct KmemSlab)) / (kc->kc_size + 1);
+f0105204:	8b 4b 04             	mov    0x4(%ebx),%ecx
+f0105207:	8d 79 01             	lea    0x1(%ecx),%edi
+f010520a:	b8 ec 0f 00 00       	mov    $0xfec,%eax
+f010520f:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105214:	f7 f7                	div    %edi
+f0105216:	89 c7                	mov    %eax,%edi
+	while (n > 0 && kmem_offset(n) + n * kc->kc_size > PGSIZE)
+f0105218:	0f af c1             	imul   %ecx,%eax
+f010521b:	83 c4 10             	add    $0x10,%esp
+f010521e:	eb 03                	jmp    f0105223 <kmem_cache_init+0x66>
+		n--;
+f0105220:	83 ef 01             	sub    $0x1,%edi
+	while (n > 0 && kmem_offset(n) + n * kc->kc_size > PGSIZE)
+f0105223:	85 ff                	test   %edi,%edi
+f0105225:	7e 12                	jle    f0105239 <kmem_cache_init+0x7c>
+	return ROUNDUP(sizeof(struct KmemSlab) + n, KMEM_ALIGN);
+f0105227:	8d 57 23             	lea    0x23(%edi),%edx
+	while (n > 0 && kmem_offset(n) + n * kc->kc_size > PGSIZE)
+f010522a:	83 e2 f0             	and    $0xfffffff0,%edx
+f010522d:	01 c2                	add    %eax,%edx
+f010522f:	29 c8                	sub    %ecx,%eax
+f0105231:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+f0105237:	77 e7                	ja     f0105220 <kmem_cache_init+0x63>
+	if (n <= 0 || n > 255)
+f0105239:	8d 47 ff             	lea    -0x1(%edi),%eax
+f010523c:	3d fe 00 00 00       	cmp    $0xfe,%eax
+f0105241:	77 35                	ja     f0105278 <kmem_cache_init+0xbb>
+		panic("kmem_cache_init: bad object size %u for %s", size, name);
+	kc->kc_perslab = n;
+f0105243:	89 7b 08             	mov    %edi,0x8(%ebx)
+
+	spin_lock(&kmem_lock);
+f0105246:	83 ec 0c             	sub    $0xc,%esp
+f0105249:	68 c0 18 61 f0       	push   $0xf06118c0
+f010524e:	e8 80 5c 00 00       	call   f010aed3 <spin_lock>
+	kc->kc_next = kmem_caches;
+f0105253:	a1 20 19 61 f0       	mov    0xf0611920,%eax
+f0105258:	89 43 7c             	mov    %eax,0x7c(%ebx)
+	kmem_caches = kc;
+f010525b:	89 1d 20 19 61 f0    	mov    %ebx,0xf0611920
+	spin_unlock(&kmem_lock);
+f0105261:	c7 04 24 c0 18 61 f0 	movl   $0xf06118c0,(%esp)
+f0105268:	e8 82 5d 00 00       	call   f010afef <spin_unlock>
+}
+f010526d:	83 c4 10             	add    $0x10,%esp
+f0105270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105273:	5b                   	pop    %ebx
+f0105274:	5e                   	pop    %esi
+f0105275:	5f                   	pop    %edi
+f0105276:	5d                   	pop    %ebp
+f0105277:	c3                   	ret
+		panic("kmem_cache_init: bad object size %u for %s", size, name);
+f0105278:	83 ec 0c             	sub    $0xc,%esp
+f010527b:	56                   	push   %esi
+f010527c:	ff 75 e4             	push   -0x1c(%ebp)
+f010527f:	68 98 db 10 f0       	push   $0xf010db98
+f0105284:	6a 60                	push   $0x60
+f0105286:	68 c3 db 10 f0       	push   $0xf010dbc3
+f010528b:	e8 08 ae ff ff       	call   f0100098 <_panic>
+
+f0105290 <kmem_cache_list>:
+// Return the list of all caches, linked through kc_next.
+struct KmemCache *
+kmem_cache_list(void)
+{
+	return kmem_caches;
+}
+f0105290:	a1 20 19 61 f0       	mov    0xf0611920,%eax
+f0105295:	c3                   	ret
+
+f0105296 <kmem_cache_alloc>:
+}
+
+// Allocate an object from kc.  Returns NULL if out of memory.
+void *
+kmem_cache_alloc(struct KmemCache *kc)
+{
+f0105296:	55                   	push   %ebp
+f0105297:	89 e5                	mov    %esp,%ebp
+f0105299:	57                   	push   %edi
+f010529a:	56                   	push   %esi
+f010529b:	53                   	push   %ebx
+f010529c:	83 ec 2c             	sub    $0x2c,%esp
+f010529f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	struct KmemCpu *cc = &kc->kc_cpu[cpunum()];
+f01052a2:	e8 9d 59 00 00       	call   f010ac44 <cpunum>
+f01052a7:	89 c3                	mov    %eax,%ebx
+
+	if (cc->kc_nobjs == 0 && kmem_cache_refill(kc, cc) < 0)
+f01052a9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f01052ac:	c1 e0 04             	shl    $0x4,%eax
+f01052af:	8b 84 07 c0 00 00 00 	mov    0xc0(%edi,%eax,1),%eax
+f01052b6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01052b9:	85 c0                	test   %eax,%eax
+f01052bb:	74 36                	je     f01052f3 <kmem_cache_alloc+0x5d>
+		return NULL;
+	cc->kc_allocs++;
+f01052bd:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+f01052c4:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+f01052c7:	c1 e0 04             	shl    $0x4,%eax
+f01052ca:	01 f8                	add    %edi,%eax
+f01052cc:	83 80 c4 00 00 00 01 	addl   $0x1,0xc4(%eax)
+	return cc->kc_objs[--cc->kc_nobjs];
+f01052d3:	8b 88 c0 00 00 00    	mov    0xc0(%eax),%ecx
+f01052d9:	83 e9 01             	sub    $0x1,%ecx
+f01052dc:	89 88 c0 00 00 00    	mov    %ecx,0xc0(%eax)
+f01052e2:	01 da                	add    %ebx,%edx
+f01052e4:	8d 44 91 20          	lea    0x20(%ecx,%edx,4),%eax
+f01052e8:	8b 04 87             	mov    (%edi,%eax,4),%eax
+}
+f01052eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01052ee:	5b                   	pop    %ebx
+f01052ef:	5e                   	pop    %esi
+f01052f0:	5f                   	pop    %edi
+f01052f1:	5d                   	pop    %ebp
+f01052f2:	c3                   	ret
+	spin_lock(&kc->kc_lock);
+f01052f3:	8d 77 10             	lea    0x10(%edi),%esi
+f01052f6:	83 ec 0c             	sub    $0xc,%esp
+f01052f9:	56                   	push   %esi
+f01052fa:	e8 d4 5b 00 00       	call   f010aed3 <spin_lock>
+	while (cc->kc_nobjs < KMEM_CPU_BATCH) {
+f01052ff:	83 c4 10             	add    $0x10,%esp
+f0105302:	8d 0c 9b             	lea    (%ebx,%ebx,4),%ecx
+f0105305:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0105308:	89 75 d0             	mov    %esi,-0x30(%ebp)
+f010530b:	89 cb                	mov    %ecx,%ebx
+f010530d:	89 d8                	mov    %ebx,%eax
+f010530f:	c1 e0 04             	shl    $0x4,%eax
+f0105312:	01 f8                	add    %edi,%eax
+f0105314:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		cc->kc_objs[cc->kc_nobjs++] =
+f0105317:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+f010531e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0105321:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+f0105324:	e9 b6 00 00 00       	jmp    f01053df <kmem_cache_alloc+0x149>
+f0105329:	52                   	push   %edx
+f010532a:	68 1c c0 10 f0       	push   $0xf010c01c
+f010532f:	6a 7d                	push   $0x7d
+f0105331:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0105336:	e8 5d ad ff ff       	call   f0100098 <_panic>
+			kc->kc_ctor(slab_obj(kc, sl, i));
+f010533b:	83 ec 0c             	sub    $0xc,%esp
+	return ROUNDUP(sizeof(struct KmemSlab) + n, KMEM_ALIGN);
+f010533e:	8b 47 08             	mov    0x8(%edi),%eax
+f0105341:	83 c0 23             	add    $0x23,%eax
+	return (char *) sl + kmem_offset(kc->kc_perslab) + i * kc->kc_size;
+f0105344:	83 e0 f0             	and    $0xfffffff0,%eax
+f0105347:	89 d9                	mov    %ebx,%ecx
+f0105349:	0f af 4f 04          	imul   0x4(%edi),%ecx
+f010534d:	01 c8                	add    %ecx,%eax
+f010534f:	01 f0                	add    %esi,%eax
+			kc->kc_ctor(slab_obj(kc, sl, i));
+f0105351:	50                   	push   %eax
+f0105352:	ff d2                	call   *%edx
+f0105354:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < kc->kc_perslab; i++) {
+f0105357:	83 c3 01             	add    $0x1,%ebx
+f010535a:	8b 47 08             	mov    0x8(%edi),%eax
+f010535d:	39 d8                	cmp    %ebx,%eax
+f010535f:	7e 12                	jle    f0105373 <kmem_cache_alloc+0xdd>
+		sl->sl_freeidx[i] = kc->kc_perslab - 1 - i;
+f0105361:	83 e8 01             	sub    $0x1,%eax
+f0105364:	29 d8                	sub    %ebx,%eax
+f0105366:	88 44 1e 14          	mov    %al,0x14(%esi,%ebx,1)
+		if (kc->kc_ctor)
+f010536a:	8b 57 0c             	mov    0xc(%edi),%edx
+f010536d:	85 d2                	test   %edx,%edx
+f010536f:	75 ca                	jne    f010533b <kmem_cache_alloc+0xa5>
+f0105371:	eb e4                	jmp    f0105357 <kmem_cache_alloc+0xc1>
+	sl->sl_prev = NULL;
+f0105373:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+	sl->sl_next = kc->kc_partial;
+f010537a:	8b 47 70             	mov    0x70(%edi),%eax
+f010537d:	89 46 0c             	mov    %eax,0xc(%esi)
+	if (kc->kc_partial)
+f0105380:	85 c0                	test   %eax,%eax
+f0105382:	74 03                	je     f0105387 <kmem_cache_alloc+0xf1>
+		kc->kc_partial->sl_prev = sl;
+f0105384:	89 70 10             	mov    %esi,0x10(%eax)
+	kc->kc_partial = sl;
+f0105387:	89 77 70             	mov    %esi,0x70(%edi)
+	kc->kc_slabs++;
+f010538a:	83 47 74 01          	addl   $0x1,0x74(%edi)
+	kc->kc_free += kc->kc_perslab;
+f010538e:	8b 47 08             	mov    0x8(%edi),%eax
+f0105391:	01 47 78             	add    %eax,0x78(%edi)
+		sl = kc->kc_partial;
+f0105394:	8b 57 70             	mov    0x70(%edi),%edx
+			slab_obj(kc, sl, sl->sl_freeidx[--sl->sl_nfree]);
+f0105397:	8b 42 08             	mov    0x8(%edx),%eax
+f010539a:	83 e8 01             	sub    $0x1,%eax
+		cc->kc_objs[cc->kc_nobjs++] =
+f010539d:	89 42 08             	mov    %eax,0x8(%edx)
+			slab_obj(kc, sl, sl->sl_freeidx[--sl->sl_nfree]);
+f01053a0:	0f b6 4c 02 14       	movzbl 0x14(%edx,%eax,1),%ecx
+		cc->kc_objs[cc->kc_nobjs++] =
+f01053a5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01053a8:	8b 86 c0 00 00 00    	mov    0xc0(%esi),%eax
+f01053ae:	8d 58 01             	lea    0x1(%eax),%ebx
+f01053b1:	89 9e c0 00 00 00    	mov    %ebx,0xc0(%esi)
+f01053b7:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f01053ba:	8d 5c 30 20          	lea    0x20(%eax,%esi,1),%ebx
+	return ROUNDUP(sizeof(struct KmemSlab) + n, KMEM_ALIGN);
+f01053be:	8b 47 08             	mov    0x8(%edi),%eax
+f01053c1:	83 c0 23             	add    $0x23,%eax
+	return (char *) sl + kmem_offset(kc->kc_perslab) + i * kc->kc_size;
+f01053c4:	83 e0 f0             	and    $0xfffffff0,%eax
+f01053c7:	0f b6 c9             	movzbl %cl,%ecx
+f01053ca:	0f af 4f 04          	imul   0x4(%edi),%ecx
+f01053ce:	01 c8                	add    %ecx,%eax
+f01053d0:	01 d0                	add    %edx,%eax
+f01053d2:	89 04 9f             	mov    %eax,(%edi,%ebx,4)
+		kc->kc_free--;
+f01053d5:	83 6f 78 01          	subl   $0x1,0x78(%edi)
+		if (sl->sl_nfree == 0)
+f01053d9:	83 7a 08 00          	cmpl   $0x0,0x8(%edx)
+f01053dd:	74 6d                	je     f010544c <kmem_cache_alloc+0x1b6>
+	while (cc->kc_nobjs < KMEM_CPU_BATCH) {
+f01053df:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01053e2:	83 b8 c0 00 00 00 07 	cmpl   $0x7,0xc0(%eax)
+f01053e9:	0f 8f 8b 00 00 00    	jg     f010547a <kmem_cache_alloc+0x1e4>
+		if (!kc->kc_partial && kmem_cache_grow(kc) < 0)
+f01053ef:	83 7f 70 00          	cmpl   $0x0,0x70(%edi)
+f01053f3:	75 9f                	jne    f0105394 <kmem_cache_alloc+0xfe>
+	if (!(pp = page_alloc(0)))
+f01053f5:	83 ec 0c             	sub    $0xc,%esp
+f01053f8:	6a 00                	push   $0x0
+f01053fa:	e8 cb ce ff ff       	call   f01022ca <page_alloc>
+f01053ff:	83 c4 10             	add    $0x10,%esp
+f0105402:	85 c0                	test   %eax,%eax
+f0105404:	74 74                	je     f010547a <kmem_cache_alloc+0x1e4>
+	return (pp - pages) << PGSHIFT;
+f0105406:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f010540c:	c1 f8 02             	sar    $0x2,%eax
+f010540f:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0105415:	89 c2                	mov    %eax,%edx
+f0105417:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages_lowmem)
+f010541a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010541f:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0105425:	0f 83 fe fe ff ff    	jae    f0105329 <kmem_cache_alloc+0x93>
+	return (void *)(pa + KERNBASE);
+f010542b:	8d b2 00 00 00 f0    	lea    -0x10000000(%edx),%esi
+	sl->sl_cache = kc;
+f0105431:	89 ba 00 00 00 f0    	mov    %edi,-0x10000000(%edx)
+	sl->sl_order = 0;
+f0105437:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	sl->sl_nfree = kc->kc_perslab;
+f010543e:	8b 47 08             	mov    0x8(%edi),%eax
+f0105441:	89 46 08             	mov    %eax,0x8(%esi)
+	for (i = 0; i < kc->kc_perslab; i++) {
+f0105444:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0105447:	e9 0e ff ff ff       	jmp    f010535a <kmem_cache_alloc+0xc4>
+	if (sl->sl_prev)
+f010544c:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f010544f:	8b 42 10             	mov    0x10(%edx),%eax
+f0105452:	85 c0                	test   %eax,%eax
+f0105454:	74 1c                	je     f0105472 <kmem_cache_alloc+0x1dc>
+		sl->sl_prev->sl_next = sl->sl_next;
+f0105456:	8b 4a 0c             	mov    0xc(%edx),%ecx
+f0105459:	89 48 0c             	mov    %ecx,0xc(%eax)
+	if (sl->sl_next)
+f010545c:	8b 42 0c             	mov    0xc(%edx),%eax
+f010545f:	85 c0                	test   %eax,%eax
+f0105461:	0f 84 a6 fe ff ff    	je     f010530d <kmem_cache_alloc+0x77>
+		sl->sl_next->sl_prev = sl->sl_prev;
+f0105467:	8b 52 10             	mov    0x10(%edx),%edx
+f010546a:	89 50 10             	mov    %edx,0x10(%eax)
+f010546d:	e9 9b fe ff ff       	jmp    f010530d <kmem_cache_alloc+0x77>
+		kc->kc_partial = sl->sl_next;
+f0105472:	8b 42 0c             	mov    0xc(%edx),%eax
+f0105475:	89 47 70             	mov    %eax,0x70(%edi)
+f0105478:	eb e2                	jmp    f010545c <kmem_cache_alloc+0x1c6>
+	spin_unlock(&kc->kc_lock);
+f010547a:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f010547d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f0105480:	83 ec 0c             	sub    $0xc,%esp
+f0105483:	56                   	push   %esi
+f0105484:	e8 66 5b 00 00       	call   f010afef <spin_unlock>
+	cc->kc_refills++;
+f0105489:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+f010548c:	c1 e0 04             	shl    $0x4,%eax
+f010548f:	01 f8                	add    %edi,%eax
+f0105491:	83 80 cc 00 00 00 01 	addl   $0x1,0xcc(%eax)
+	return cc->kc_nobjs ? 0 : -E_NO_MEM;
+f0105498:	83 c4 10             	add    $0x10,%esp
+f010549b:	83 b8 c0 00 00 00 00 	cmpl   $0x0,0xc0(%eax)
+f01054a2:	0f 85 15 fe ff ff    	jne    f01052bd <kmem_cache_alloc+0x27>
+		return NULL;
+f01054a8:	b8 00 00 00 00       	mov    $0x0,%eax
+f01054ad:	e9 39 fe ff ff       	jmp    f01052eb <kmem_cache_alloc+0x55>
+
+f01054b2 <kmem_cache_create>:
+{
+f01054b2:	55                   	push   %ebp
+f01054b3:	89 e5                	mov    %esp,%ebp
+f01054b5:	53                   	push   %ebx
+f01054b6:	83 ec 10             	sub    $0x10,%esp
+	if (!(kc = kmem_cache_alloc(&kmem_cache_cache)))
+f01054b9:	68 40 19 61 f0       	push   $0xf0611940
+f01054be:	e8 d3 fd ff ff       	call   f0105296 <kmem_cache_alloc>
+f01054c3:	89 c3                	mov    %eax,%ebx
+f01054c5:	83 c4 10             	add    $0x10,%esp
+f01054c8:	85 c0                	test   %eax,%eax
+f01054ca:	74 14                	je     f01054e0 <kmem_cache_create+0x2e>
+	kmem_cache_init(kc, name, size, ctor);
+f01054cc:	83 ec 0c             	sub    $0xc,%esp
+f01054cf:	ff 75 10             	push   0x10(%ebp)
+f01054d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f01054d5:	8b 55 08             	mov    0x8(%ebp),%edx
+f01054d8:	e8 e0 fc ff ff       	call   f01051bd <kmem_cache_init>
+	return kc;
+f01054dd:	83 c4 10             	add    $0x10,%esp
+}
+f01054e0:	89 d8                	mov    %ebx,%eax
+f01054e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01054e5:	c9                   	leave
+f01054e6:	c3                   	ret
+
+f01054e7 <kmem_init>:
+{
+f01054e7:	55                   	push   %ebp
+f01054e8:	89 e5                	mov    %esp,%ebp
+f01054ea:	56                   	push   %esi
+f01054eb:	53                   	push   %ebx
+	spin_initlock(&kmem_lock);
+f01054ec:	83 ec 08             	sub    $0x8,%esp
+f01054ef:	68 d2 db 10 f0       	push   $0xf010dbd2
+f01054f4:	68 c0 18 61 f0       	push   $0xf06118c0
+f01054f9:	e8 ad 59 00 00       	call   f010aeab <__spin_initlock>
+	kmem_cache_init(&kmem_cache_cache, "kmem_cache",
+f01054fe:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f0105505:	b9 00 03 00 00       	mov    $0x300,%ecx
+f010550a:	ba dd db 10 f0       	mov    $0xf010dbdd,%edx
+f010550f:	b8 40 19 61 f0       	mov    $0xf0611940,%eax
+f0105514:	e8 a4 fc ff ff       	call   f01051bd <kmem_cache_init>
+f0105519:	83 c4 10             	add    $0x10,%esp
+	for (i = 0, size = KMALLOC_MIN; size <= KMALLOC_MAX; i++, size <<= 1) {
+f010551c:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105521:	be 10 00 00 00       	mov    $0x10,%esi
+		kmalloc_caches[i] = kmem_cache_create(kmalloc_names[i], size,
+f0105526:	83 ec 04             	sub    $0x4,%esp
+f0105529:	6a 00                	push   $0x0
+f010552b:	56                   	push   %esi
+f010552c:	ff 34 9d 7c dc 10 f0 	push   -0xfef2384(,%ebx,4)
+f0105533:	e8 7a ff ff ff       	call   f01054b2 <kmem_cache_create>
+f0105538:	89 04 9d a0 18 61 f0 	mov    %eax,-0xf9ee760(,%ebx,4)
+		if (!kmalloc_caches[i])
+f010553f:	83 c4 10             	add    $0x10,%esp
+f0105542:	85 c0                	test   %eax,%eax
+f0105544:	74 28                	je     f010556e <kmem_init+0x87>
+	for (i = 0, size = KMALLOC_MIN; size <= KMALLOC_MAX; i++, size <<= 1) {
+f0105546:	83 c3 01             	add    $0x1,%ebx
+f0105549:	01 f6                	add    %esi,%esi
+f010554b:	81 fe 00 04 00 00    	cmp    $0x400,%esi
+f0105551:	77 2f                	ja     f0105582 <kmem_init+0x9b>
+		assert(i < KMALLOC_NCLASS);
+f0105553:	83 fb 07             	cmp    $0x7,%ebx
+f0105556:	75 ce                	jne    f0105526 <kmem_init+0x3f>
+f0105558:	68 e8 db 10 f0       	push   $0xf010dbe8
+f010555d:	68 0d d8 10 f0       	push   $0xf010d80d
+f0105562:	6a 74                	push   $0x74
+f0105564:	68 c3 db 10 f0       	push   $0xf010dbc3
+f0105569:	e8 2a ab ff ff       	call   f0100098 <_panic>
+			panic("kmem_init: out of memory");
+f010556e:	83 ec 04             	sub    $0x4,%esp
+f0105571:	68 fb db 10 f0       	push   $0xf010dbfb
+f0105576:	6a 78                	push   $0x78
+f0105578:	68 c3 db 10 f0       	push   $0xf010dbc3
+f010557d:	e8 16 ab ff ff       	call   f0100098 <_panic>
+}
+f0105582:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0105585:	5b                   	pop    %ebx
+f0105586:	5e                   	pop    %esi
+f0105587:	5d                   	pop    %ebp
+f0105588:	c3                   	ret
+
+f0105589 <kmem_cache_free>:
+
+// Give obj, which came from kmem_cache_alloc(kc), back to kc.
+void
+kmem_cache_free(struct KmemCache *kc, void *obj)
+{
+f0105589:	55                   	push   %ebp
+f010558a:	89 e5                	mov    %esp,%ebp
+f010558c:	57                   	push   %edi
+f010558d:	56                   	push   %esi
+f010558e:	53                   	push   %ebx
+f010558f:	83 ec 1c             	sub    $0x1c,%esp
+f0105592:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct KmemCpu *cc = &kc->kc_cpu[cpunum()];
+f0105595:	e8 aa 56 00 00       	call   f010ac44 <cpunum>
+f010559a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+	if (cc->kc_nobjs == KMEM_CPU_MAX)
+f010559d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f01055a0:	c1 e0 04             	shl    $0x4,%eax
+f01055a3:	83 bc 03 c0 00 00 00 	cmpl   $0x10,0xc0(%ebx,%eax,1)
+f01055aa:	10 
+f01055ab:	74 4b                	je     f01055f8 <kmem_cache_free+0x6f>
+		kmem_cache_drain(kc, cc);
+	cc->kc_objs[cc->kc_nobjs++] = obj;
+f01055ad:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01055b0:	8d 14 b5 00 00 00 00 	lea    0x0(,%esi,4),%edx
+f01055b7:	8d 04 32             	lea    (%edx,%esi,1),%eax
+f01055ba:	c1 e0 04             	shl    $0x4,%eax
+f01055bd:	01 d8                	add    %ebx,%eax
+f01055bf:	8b 88 c0 00 00 00    	mov    0xc0(%eax),%ecx
+f01055c5:	8d 79 01             	lea    0x1(%ecx),%edi
+f01055c8:	89 b8 c0 00 00 00    	mov    %edi,0xc0(%eax)
+f01055ce:	8d 3c 32             	lea    (%edx,%esi,1),%edi
+f01055d1:	8d 4c b9 20          	lea    0x20(%ecx,%edi,4),%ecx
+f01055d5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f01055d8:	89 3c 8b             	mov    %edi,(%ebx,%ecx,4)
+	cc->kc_frees++;
+f01055db:	01 f2                	add    %esi,%edx
+f01055dd:	c1 e2 04             	shl    $0x4,%edx
+f01055e0:	8b 94 13 c8 00 00 00 	mov    0xc8(%ebx,%edx,1),%edx
+f01055e7:	83 c2 01             	add    $0x1,%edx
+f01055ea:	89 90 c8 00 00 00    	mov    %edx,0xc8(%eax)
+}
+f01055f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01055f3:	5b                   	pop    %ebx
+f01055f4:	5e                   	pop    %esi
+f01055f5:	5f                   	pop    %edi
+f01055f6:	5d                   	pop    %ebp
+f01055f7:	c3                   	ret
+	spin_lock(&kc->kc_lock);
+f01055f8:	8d 43 10             	lea    0x10(%ebx),%eax
+f01055fb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01055fe:	83 ec 0c             	sub    $0xc,%esp
+f0105601:	50                   	push   %eax
+f0105602:	e8 cc 58 00 00       	call   f010aed3 <spin_lock>
+	for (i = 0; i < KMEM_CPU_BATCH; i++) {
+f0105607:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010560a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010560d:	c1 e0 04             	shl    $0x4,%eax
+f0105610:	8d b4 03 80 00 00 00 	lea    0x80(%ebx,%eax,1),%esi
+f0105617:	89 f7                	mov    %esi,%edi
+f0105619:	8d 84 03 a0 00 00 00 	lea    0xa0(%ebx,%eax,1),%eax
+f0105620:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0105623:	83 c4 10             	add    $0x10,%esp
+f0105626:	89 75 d8             	mov    %esi,-0x28(%ebp)
+f0105629:	e9 85 00 00 00       	jmp    f01056b3 <kmem_cache_free+0x12a>
+		assert(sl->sl_cache == kc);
+f010562e:	68 14 dc 10 f0       	push   $0xf010dc14
+f0105633:	68 0d d8 10 f0       	push   $0xf010d80d
+f0105638:	68 e7 00 00 00       	push   $0xe7
+f010563d:	68 c3 db 10 f0       	push   $0xf010dbc3
+f0105642:	e8 51 aa ff ff       	call   f0100098 <_panic>
+			sl->sl_prev = NULL;
+f0105647:	c7 41 10 00 00 00 00 	movl   $0x0,0x10(%ecx)
+			sl->sl_next = kc->kc_partial;
+f010564e:	8b 43 70             	mov    0x70(%ebx),%eax
+f0105651:	89 41 0c             	mov    %eax,0xc(%ecx)
+			if (kc->kc_partial)
+f0105654:	85 c0                	test   %eax,%eax
+f0105656:	74 03                	je     f010565b <kmem_cache_free+0xd2>
+				kc->kc_partial->sl_prev = sl;
+f0105658:	89 48 10             	mov    %ecx,0x10(%eax)
+			kc->kc_partial = sl;
+f010565b:	89 4b 70             	mov    %ecx,0x70(%ebx)
+f010565e:	e9 9d 00 00 00       	jmp    f0105700 <kmem_cache_free+0x177>
+		kc->kc_partial = sl->sl_next;
+f0105663:	8b 41 0c             	mov    0xc(%ecx),%eax
+f0105666:	89 43 70             	mov    %eax,0x70(%ebx)
+f0105669:	e9 b0 00 00 00       	jmp    f010571e <kmem_cache_free+0x195>
+			kc->kc_slabs--;
+f010566e:	83 6b 74 01          	subl   $0x1,0x74(%ebx)
+			kc->kc_free -= kc->kc_perslab;
+f0105672:	8b 43 08             	mov    0x8(%ebx),%eax
+f0105675:	29 43 78             	sub    %eax,0x78(%ebx)
+	if ((uint32_t)kva < KERNBASE)
+f0105678:	81 f9 ff ff ff ef    	cmp    $0xefffffff,%ecx
+f010567e:	0f 86 b0 00 00 00    	jbe    f0105734 <kmem_cache_free+0x1ab>
+	return (physaddr_t)kva - KERNBASE;
+f0105684:	81 c1 00 00 00 10    	add    $0x10000000,%ecx
+	if (PGNUM(pa) >= npages)
+f010568a:	c1 e9 0c             	shr    $0xc,%ecx
+f010568d:	3b 0d 78 89 61 f0    	cmp    0xf0618978,%ecx
+f0105693:	0f 83 b0 00 00 00    	jae    f0105749 <kmem_cache_free+0x1c0>
+			page_free(pa2page(PADDR(sl)));
+f0105699:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f010569c:	8d 14 49             	lea    (%ecx,%ecx,2),%edx
+f010569f:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f01056a4:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f01056a7:	50                   	push   %eax
+f01056a8:	e8 04 c8 ff ff       	call   f0101eb1 <page_free>
+f01056ad:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < KMEM_CPU_BATCH; i++) {
+f01056b0:	83 c7 04             	add    $0x4,%edi
+f01056b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01056b6:	39 c7                	cmp    %eax,%edi
+f01056b8:	0f 84 9f 00 00 00    	je     f010575d <kmem_cache_free+0x1d4>
+		obj = cc->kc_objs[i];
+f01056be:	8b 07                	mov    (%edi),%eax
+	return (struct KmemSlab *) ROUNDDOWN(obj, PGSIZE);
+f01056c0:	89 c1                	mov    %eax,%ecx
+f01056c2:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+		assert(sl->sl_cache == kc);
+f01056c8:	3b 19                	cmp    (%ecx),%ebx
+f01056ca:	0f 85 5e ff ff ff    	jne    f010562e <kmem_cache_free+0xa5>
+	return ((char *) obj - (char *) sl - kmem_offset(kc->kc_perslab))
+f01056d0:	29 c8                	sub    %ecx,%eax
+	return ROUNDUP(sizeof(struct KmemSlab) + n, KMEM_ALIGN);
+f01056d2:	8b 73 08             	mov    0x8(%ebx),%esi
+f01056d5:	8d 56 23             	lea    0x23(%esi),%edx
+	return ((char *) obj - (char *) sl - kmem_offset(kc->kc_perslab))
+f01056d8:	83 e2 f0             	and    $0xfffffff0,%edx
+f01056db:	29 d0                	sub    %edx,%eax
+		/ kc->kc_size;
+f01056dd:	ba 00 00 00 00       	mov    $0x0,%edx
+f01056e2:	f7 73 04             	divl   0x4(%ebx)
+		sl->sl_freeidx[sl->sl_nfree++] = slab_idx(kc, sl, obj);
+f01056e5:	8b 51 08             	mov    0x8(%ecx),%edx
+f01056e8:	8d 72 01             	lea    0x1(%edx),%esi
+f01056eb:	89 71 08             	mov    %esi,0x8(%ecx)
+f01056ee:	88 44 0a 14          	mov    %al,0x14(%edx,%ecx,1)
+		kc->kc_free++;
+f01056f2:	83 43 78 01          	addl   $0x1,0x78(%ebx)
+		if (sl->sl_nfree == 1) {
+f01056f6:	83 79 08 01          	cmpl   $0x1,0x8(%ecx)
+f01056fa:	0f 84 47 ff ff ff    	je     f0105647 <kmem_cache_free+0xbe>
+		if (sl->sl_nfree == kc->kc_perslab
+f0105700:	8b 43 08             	mov    0x8(%ebx),%eax
+f0105703:	39 41 08             	cmp    %eax,0x8(%ecx)
+f0105706:	75 a8                	jne    f01056b0 <kmem_cache_free+0x127>
+		    && kc->kc_free > kc->kc_perslab) {
+f0105708:	3b 43 78             	cmp    0x78(%ebx),%eax
+f010570b:	73 a3                	jae    f01056b0 <kmem_cache_free+0x127>
+	if (sl->sl_prev)
+f010570d:	8b 41 10             	mov    0x10(%ecx),%eax
+f0105710:	85 c0                	test   %eax,%eax
+f0105712:	0f 84 4b ff ff ff    	je     f0105663 <kmem_cache_free+0xda>
+		sl->sl_prev->sl_next = sl->sl_next;
+f0105718:	8b 51 0c             	mov    0xc(%ecx),%edx
+f010571b:	89 50 0c             	mov    %edx,0xc(%eax)
+	if (sl->sl_next)
+f010571e:	8b 41 0c             	mov    0xc(%ecx),%eax
+f0105721:	85 c0                	test   %eax,%eax
+f0105723:	0f 84 45 ff ff ff    	je     f010566e <kmem_cache_free+0xe5>
+		sl->sl_next->sl_prev = sl->sl_prev;
+f0105729:	8b 51 10             	mov    0x10(%ecx),%edx
+f010572c:	89 50 10             	mov    %edx,0x10(%eax)
+f010572f:	e9 3a ff ff ff       	jmp    f010566e <kmem_cache_free+0xe5>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0105734:	51                   	push   %ecx
+f0105735:	68 e8 cc 10 f0       	push   $0xf010cce8
+f010573a:	68 f6 00 00 00       	push   $0xf6
+f010573f:	68 c3 db 10 f0       	push   $0xf010dbc3
+f0105744:	e8 4f a9 ff ff       	call   f0100098 <_panic>
+		panic("pa2page called with invalid pa");
+f0105749:	83 ec 04             	sub    $0x4,%esp
+f010574c:	68 e8 ce 10 f0       	push   $0xf010cee8
+f0105751:	6a 76                	push   $0x76
+f0105753:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0105758:	e8 3b a9 ff ff       	call   f0100098 <_panic>
+	spin_unlock(&kc->kc_lock);
+f010575d:	8b 75 d8             	mov    -0x28(%ebp),%esi
+f0105760:	83 ec 0c             	sub    $0xc,%esp
+f0105763:	ff 75 dc             	push   -0x24(%ebp)
+f0105766:	e8 84 58 00 00       	call   f010afef <spin_unlock>
+	cc->kc_nobjs -= KMEM_CPU_BATCH;
+f010576b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010576e:	8d 14 80             	lea    (%eax,%eax,4),%edx
+f0105771:	c1 e2 04             	shl    $0x4,%edx
+f0105774:	01 da                	add    %ebx,%edx
+f0105776:	8b 82 c0 00 00 00    	mov    0xc0(%edx),%eax
+f010577c:	83 e8 08             	sub    $0x8,%eax
+f010577f:	89 82 c0 00 00 00    	mov    %eax,0xc0(%edx)
+	memmove(cc->kc_objs, cc->kc_objs + KMEM_CPU_BATCH,
+f0105785:	83 c4 0c             	add    $0xc,%esp
+f0105788:	c1 e0 02             	shl    $0x2,%eax
+f010578b:	50                   	push   %eax
+f010578c:	8d 46 20             	lea    0x20(%esi),%eax
+f010578f:	50                   	push   %eax
+f0105790:	56                   	push   %esi
+f0105791:	e8 9d 4e 00 00       	call   f010a633 <memmove>
+}
+f0105796:	83 c4 10             	add    $0x10,%esp
+f0105799:	e9 0f fe ff ff       	jmp    f01055ad <kmem_cache_free+0x24>
+
+f010579e <kmalloc>:
+// the size class if that is smaller.  If (alloc_flags & ALLOC_ZERO),
+// the memory is zeroed.  Returns NULL if out of memory.
+//
+void *
+kmalloc(size_t size, int alloc_flags)
+{
+f010579e:	55                   	push   %ebp
+f010579f:	89 e5                	mov    %esp,%ebp
+f01057a1:	57                   	push   %edi
+f01057a2:	56                   	push   %esi
+f01057a3:	53                   	push   %ebx
+f01057a4:	83 ec 0c             	sub    $0xc,%esp
+f01057a7:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct PageInfo *pp;
+	struct KmemSlab *sl;
+	void *p;
+	int i, order;
+
+	if (size <= KMALLOC_MAX) {
+f01057aa:	81 fe 00 04 00 00    	cmp    $0x400,%esi
+f01057b0:	76 67                	jbe    f0105819 <kmalloc+0x7b>
+		if (alloc_flags & ALLOC_ZERO)
+			memset(p, 0, size);
+		return p;
+	}
+
+	for (order = 0; (PGSIZE << order) < size + KMEM_ALIGN; order++)
+f01057b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01057b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01057bc:	83 c6 10             	add    $0x10,%esi
+f01057bf:	89 d0                	mov    %edx,%eax
+f01057c1:	89 d9                	mov    %ebx,%ecx
+f01057c3:	d3 e0                	shl    %cl,%eax
+f01057c5:	39 f0                	cmp    %esi,%eax
+f01057c7:	73 5c                	jae    f0105825 <kmalloc+0x87>
+		if (order == PAGE_MAX_ORDER)
+f01057c9:	83 fb 0a             	cmp    $0xa,%ebx
+f01057cc:	0f 84 b3 00 00 00    	je     f0105885 <kmalloc+0xe7>
+	for (order = 0; (PGSIZE << order) < size + KMEM_ALIGN; order++)
+f01057d2:	83 c3 01             	add    $0x1,%ebx
+f01057d5:	eb e8                	jmp    f01057bf <kmalloc+0x21>
+		for (i = 0; (KMALLOC_MIN << i) < size; i++)
+f01057d7:	83 c1 01             	add    $0x1,%ecx
+f01057da:	89 d0                	mov    %edx,%eax
+f01057dc:	d3 e0                	shl    %cl,%eax
+f01057de:	39 f0                	cmp    %esi,%eax
+f01057e0:	72 f5                	jb     f01057d7 <kmalloc+0x39>
+		if (!(p = kmem_cache_alloc(kmalloc_caches[i])))
+f01057e2:	83 ec 0c             	sub    $0xc,%esp
+f01057e5:	ff 34 8d a0 18 61 f0 	push   -0xf9ee760(,%ecx,4)
+f01057ec:	e8 a5 fa ff ff       	call   f0105296 <kmem_cache_alloc>
+f01057f1:	89 c7                	mov    %eax,%edi
+f01057f3:	83 c4 10             	add    $0x10,%esp
+f01057f6:	85 c0                	test   %eax,%eax
+f01057f8:	0f 84 8c 00 00 00    	je     f010588a <kmalloc+0xec>
+		if (alloc_flags & ALLOC_ZERO)
+f01057fe:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+f0105802:	0f 84 82 00 00 00    	je     f010588a <kmalloc+0xec>
+			memset(p, 0, size);
+f0105808:	83 ec 04             	sub    $0x4,%esp
+f010580b:	56                   	push   %esi
+f010580c:	6a 00                	push   $0x0
+f010580e:	50                   	push   %eax
+f010580f:	e8 ea 4d 00 00       	call   f010a5fe <memset>
+f0105814:	83 c4 10             	add    $0x10,%esp
+f0105817:	eb 71                	jmp    f010588a <kmalloc+0xec>
+		for (i = 0; (KMALLOC_MIN << i) < size; i++)
+f0105819:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010581e:	ba 10 00 00 00       	mov    $0x10,%edx
+f0105823:	eb b5                	jmp    f01057da <kmalloc+0x3c>
+			return NULL;
+	if (!(pp = page_alloc_order(order, alloc_flags)))
+f0105825:	83 ec 08             	sub    $0x8,%esp
+f0105828:	ff 75 0c             	push   0xc(%ebp)
+f010582b:	53                   	push   %ebx
+f010582c:	e8 76 cb ff ff       	call   f01023a7 <page_alloc_order>
+f0105831:	89 c7                	mov    %eax,%edi
+f0105833:	83 c4 10             	add    $0x10,%esp
+f0105836:	85 c0                	test   %eax,%eax
+f0105838:	74 50                	je     f010588a <kmalloc+0xec>
+	return (pp - pages) << PGSHIFT;
+f010583a:	2b 3d 80 89 61 f0    	sub    0xf0618980,%edi
+f0105840:	c1 ff 02             	sar    $0x2,%edi
+f0105843:	69 c7 ab aa aa aa    	imul   $0xaaaaaaab,%edi,%eax
+f0105849:	89 c7                	mov    %eax,%edi
+f010584b:	c1 e7 0c             	shl    $0xc,%edi
+	if (PGNUM(pa) >= npages_lowmem)
+f010584e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0105853:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0105859:	73 18                	jae    f0105873 <kmalloc+0xd5>
+		return NULL;
+	sl = page2kva(pp);
+	sl->sl_cache = NULL;
+f010585b:	c7 87 00 00 00 f0 00 	movl   $0x0,-0x10000000(%edi)
+f0105862:	00 00 00 
+	sl->sl_order = order;
+f0105865:	89 9f 04 00 00 f0    	mov    %ebx,-0xffffffc(%edi)
+	return (char *) sl + KMEM_ALIGN;
+f010586b:	81 ef f0 ff ff 0f    	sub    $0xffffff0,%edi
+f0105871:	eb 17                	jmp    f010588a <kmalloc+0xec>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0105873:	57                   	push   %edi
+f0105874:	68 1c c0 10 f0       	push   $0xf010c01c
+f0105879:	6a 7d                	push   $0x7d
+f010587b:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0105880:	e8 13 a8 ff ff       	call   f0100098 <_panic>
+			return NULL;
+f0105885:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+f010588a:	89 f8                	mov    %edi,%eax
+f010588c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010588f:	5b                   	pop    %ebx
+f0105890:	5e                   	pop    %esi
+f0105891:	5f                   	pop    %edi
+f0105892:	5d                   	pop    %ebp
+f0105893:	c3                   	ret
+
+f0105894 <kfree>:
+
+// Free memory returned by kmalloc().
+void
+kfree(void *p)
+{
+f0105894:	55                   	push   %ebp
+f0105895:	89 e5                	mov    %esp,%ebp
+f0105897:	83 ec 08             	sub    $0x8,%esp
+f010589a:	8b 55 08             	mov    0x8(%ebp),%edx
+	struct KmemSlab *sl;
+
+	if (!p)
+f010589d:	85 d2                	test   %edx,%edx
+f010589f:	74 1a                	je     f01058bb <kfree+0x27>
+	return (struct KmemSlab *) ROUNDDOWN(obj, PGSIZE);
+f01058a1:	89 d0                	mov    %edx,%eax
+f01058a3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		return;
+	sl = obj2slab(p);
+	if (sl->sl_cache)
+f01058a8:	8b 08                	mov    (%eax),%ecx
+f01058aa:	85 c9                	test   %ecx,%ecx
+f01058ac:	74 0f                	je     f01058bd <kfree+0x29>
+		kmem_cache_free(sl->sl_cache, p);
+f01058ae:	83 ec 08             	sub    $0x8,%esp
+f01058b1:	52                   	push   %edx
+f01058b2:	51                   	push   %ecx
+f01058b3:	e8 d1 fc ff ff       	call   f0105589 <kmem_cache_free>
+f01058b8:	83 c4 10             	add    $0x10,%esp
+	else
+		page_free_order(pa2page(PADDR(sl)), sl->sl_order);
+}
+f01058bb:	c9                   	leave
+f01058bc:	c3                   	ret
+		page_free_order(pa2page(PADDR(sl)), sl->sl_order);
+f01058bd:	8b 50 04             	mov    0x4(%eax),%edx
+	if ((uint32_t)kva < KERNBASE)
+f01058c0:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01058c5:	76 2a                	jbe    f01058f1 <kfree+0x5d>
+	return (physaddr_t)kva - KERNBASE;
+f01058c7:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f01058cc:	c1 e8 0c             	shr    $0xc,%eax
+f01058cf:	3b 05 78 89 61 f0    	cmp    0xf0618978,%eax
+f01058d5:	73 2f                	jae    f0105906 <kfree+0x72>
+f01058d7:	83 ec 08             	sub    $0x8,%esp
+f01058da:	52                   	push   %edx
+	return &pages[PGNUM(pa)];
+f01058db:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01058de:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f01058e3:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f01058e6:	50                   	push   %eax
+f01058e7:	e8 23 c7 ff ff       	call   f010200f <page_free_order>
+f01058ec:	83 c4 10             	add    $0x10,%esp
+f01058ef:	eb ca                	jmp    f01058bb <kfree+0x27>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01058f1:	50                   	push   %eax
+f01058f2:	68 e8 cc 10 f0       	push   $0xf010cce8
+f01058f7:	68 46 01 00 00       	push   $0x146
+f01058fc:	68 c3 db 10 f0       	push   $0xf010dbc3
+f0105901:	e8 92 a7 ff ff       	call   f0100098 <_panic>
+		panic("pa2page called with invalid pa");
+f0105906:	83 ec 04             	sub    $0x4,%esp
+f0105909:	68 e8 ce 10 f0       	push   $0xf010cee8
+f010590e:	6a 76                	push   $0x76
+f0105910:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0105915:	e8 7e a7 ff ff       	call   f0100098 <_panic>
+
+f010591a <ksm_candidate>:
+static bool
+ksm_candidate(pte_t *pte)
+{
+	struct PageInfo *pp;
+
+	if ((*pte & (PTE_P|PTE_U|PTE_W|PTE_SHARE)) != (PTE_P|PTE_U)
+f010591a:	8b 10                	mov    (%eax),%edx
+f010591c:	89 d0                	mov    %edx,%eax
+f010591e:	25 07 04 00 00       	and    $0x407,%eax
+f0105923:	83 f8 05             	cmp    $0x5,%eax
+f0105926:	75 43                	jne    f010596b <ksm_candidate+0x51>
+	    || PGNUM(*pte) >= npages)
+f0105928:	89 d1                	mov    %edx,%ecx
+f010592a:	c1 e9 0c             	shr    $0xc,%ecx
+		return 0;
+f010592d:	b8 00 00 00 00       	mov    $0x0,%eax
+	    || PGNUM(*pte) >= npages)
+f0105932:	3b 0d 78 89 61 f0    	cmp    0xf0618978,%ecx
+f0105938:	73 36                	jae    f0105970 <ksm_candidate+0x56>
+	return &pages[PGNUM(pa)];
+f010593a:	8d 0c 49             	lea    (%ecx,%ecx,2),%ecx
+f010593d:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0105942:	8d 0c 88             	lea    (%eax,%ecx,4),%ecx
+	pp = pa2page(PTE_ADDR(*pte));
+	return pp != zero_page && ((*pte & PTE_COW) || pp->pp_ref == 1);
+f0105945:	b8 00 00 00 00       	mov    $0x0,%eax
+f010594a:	39 0d 74 89 61 f0    	cmp    %ecx,0xf0618974
+f0105950:	74 15                	je     f0105967 <ksm_candidate+0x4d>
+f0105952:	b8 01 00 00 00       	mov    $0x1,%eax
+f0105957:	f6 c6 08             	test   $0x8,%dh
+f010595a:	75 0b                	jne    f0105967 <ksm_candidate+0x4d>
+f010595c:	66 83 79 04 01       	cmpw   $0x1,0x4(%ecx)
+f0105961:	0f 94 c0             	sete   %al
+f0105964:	0f b6 c0             	movzbl %al,%eax
+f0105967:	83 e0 01             	and    $0x1,%eax
+f010596a:	c3                   	ret
+		return 0;
+f010596b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0105970:	c3                   	ret
+
+f0105971 <ksm_scan>:
+	asm volatile("lock; xchgl %0, %1" :
+f0105971:	b8 01 00 00 00       	mov    $0x1,%eax
+f0105976:	f0 87 05 60 5c 61 f0 	lock xchg %eax,0xf0615c60
+{
+	struct KsmMatch m;
+	struct Env *e;
+	bool done = 1;
+
+	if (xchg(&ksm_busy, 1))
+f010597d:	85 c0                	test   %eax,%eax
+f010597f:	74 01                	je     f0105982 <ksm_scan+0x11>
+f0105981:	c3                   	ret
+{
+f0105982:	55                   	push   %ebp
+f0105983:	89 e5                	mov    %esp,%ebp
+f0105985:	57                   	push   %edi
+f0105986:	56                   	push   %esi
+f0105987:	53                   	push   %ebx
+f0105988:	83 ec 4c             	sub    $0x4c,%esp
+f010598b:	be 11 00 00 00       	mov    $0x11,%esi
+	for (i = 0; i < KSM_SWEEP; i++) {
+f0105990:	83 ee 01             	sub    $0x1,%esi
+f0105993:	74 46                	je     f01059db <ksm_scan+0x6a>
+		b = &ksm_table[ksm_sweep++ % KSM_NBUCKET];
+f0105995:	a1 48 1c 61 f0       	mov    0xf0611c48,%eax
+f010599a:	8d 50 01             	lea    0x1(%eax),%edx
+f010599d:	89 15 48 1c 61 f0    	mov    %edx,0xf0611c48
+f01059a3:	25 ff 03 00 00       	and    $0x3ff,%eax
+f01059a8:	89 c3                	mov    %eax,%ebx
+		if (b->kb_page && b->kb_page->pp_ref == 1) {
+f01059aa:	c1 e0 04             	shl    $0x4,%eax
+f01059ad:	8b 80 64 1c 61 f0    	mov    -0xf9ee39c(%eax),%eax
+f01059b3:	85 c0                	test   %eax,%eax
+f01059b5:	74 d9                	je     f0105990 <ksm_scan+0x1f>
+f01059b7:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f01059bc:	75 d2                	jne    f0105990 <ksm_scan+0x1f>
+			page_decref(b->kb_page);
+f01059be:	83 ec 0c             	sub    $0xc,%esp
+f01059c1:	50                   	push   %eax
+f01059c2:	e8 3b c7 ff ff       	call   f0102102 <page_decref>
+			b->kb_page = NULL;
+f01059c7:	89 d8                	mov    %ebx,%eax
+f01059c9:	c1 e0 04             	shl    $0x4,%eax
+f01059cc:	c7 80 64 1c 61 f0 00 	movl   $0x0,-0xf9ee39c(%eax)
+f01059d3:	00 00 00 
+f01059d6:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < KSM_SWEEP; i++) {
+f01059d9:	eb b5                	jmp    f0105990 <ksm_scan+0x1f>
+		return;
+
+	ksm_sweep_table();
+	if (!(e = env_slot(ksm_env))) {
+f01059db:	83 ec 0c             	sub    $0xc,%esp
+f01059de:	ff 35 50 1c 61 f0    	push   0xf0611c50
+f01059e4:	e8 10 08 00 00       	call   f01061f9 <env_slot>
+f01059e9:	89 c7                	mov    %eax,%edi
+f01059eb:	83 c4 10             	add    $0x10,%esp
+f01059ee:	85 c0                	test   %eax,%eax
+f01059f0:	74 35                	je     f0105a27 <ksm_scan+0xb6>
+	}
+	m.km_bucket = NULL;
+	m.km_page = NULL;
+	// An environment that has never run may still be being built by
+	// sys_fork_cow, which fills in its page tables without its lock.
+	if (e && env_lock_checked(e, 0) == 0) {
+f01059f2:	83 ec 08             	sub    $0x8,%esp
+f01059f5:	6a 00                	push   $0x0
+f01059f7:	57                   	push   %edi
+f01059f8:	e8 b5 07 00 00       	call   f01061b2 <env_lock_checked>
+f01059fd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0105a00:	83 c4 10             	add    $0x10,%esp
+f0105a03:	85 c0                	test   %eax,%eax
+f0105a05:	75 3d                	jne    f0105a44 <ksm_scan+0xd3>
+		if (e->env_runs > 0)
+f0105a07:	83 7f 5c 00          	cmpl   $0x0,0x5c(%edi)
+f0105a0b:	0f 85 f6 02 00 00    	jne    f0105d07 <ksm_scan+0x396>
+			done = ksm_scan_env(e, &m);
+		env_unlock(e);
+f0105a11:	83 ec 0c             	sub    $0xc,%esp
+f0105a14:	57                   	push   %edi
+f0105a15:	e8 6c 07 00 00       	call   f0106186 <env_unlock>
+f0105a1a:	83 c4 10             	add    $0x10,%esp
+	bool done = 1;
+f0105a1d:	be 01 00 00 00       	mov    $0x1,%esi
+f0105a22:	e9 5b 03 00 00       	jmp    f0105d82 <ksm_scan+0x411>
+		ksm_env = 0;
+f0105a27:	c7 05 50 1c 61 f0 00 	movl   $0x0,0xf0611c50
+f0105a2e:	00 00 00 
+		e = env_slot(0);
+f0105a31:	83 ec 0c             	sub    $0xc,%esp
+f0105a34:	6a 00                	push   $0x0
+f0105a36:	e8 be 07 00 00       	call   f01061f9 <env_slot>
+f0105a3b:	89 c7                	mov    %eax,%edi
+	if (e && env_lock_checked(e, 0) == 0) {
+f0105a3d:	83 c4 10             	add    $0x10,%esp
+f0105a40:	85 c0                	test   %eax,%eax
+f0105a42:	75 ae                	jne    f01059f2 <ksm_scan+0x81>
+	}
+	if (m.km_bucket)
+		ksm_promote(&m);
+	if (done) {
+		ksm_env++;
+f0105a44:	83 05 50 1c 61 f0 01 	addl   $0x1,0xf0611c50
+		ksm_va = 0;
+f0105a4b:	c7 05 4c 1c 61 f0 00 	movl   $0x0,0xf0611c4c
+f0105a52:	00 00 00 
+f0105a55:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105a5a:	f0 87 05 60 5c 61 f0 	lock xchg %eax,0xf0615c60
+
+	xchg(&ksm_busy, 0);
+
+	// Flush the replaced mappings from other CPUs' TLBs, so that the
+	// pages they mapped can be freed.
+	tlb_shootdown();
+f0105a61:	e8 e0 d5 ff ff       	call   f0103046 <tlb_shootdown>
+}
+f0105a66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105a69:	5b                   	pop    %ebx
+f0105a6a:	5e                   	pop    %esi
+f0105a6b:	5f                   	pop    %edi
+f0105a6c:	5d                   	pop    %ebp
+f0105a6d:	c3                   	ret
+			ksm_va = ROUNDUP(ksm_va + 1, PTSIZE);
+f0105a6e:	81 c6 00 00 40 00    	add    $0x400000,%esi
+f0105a74:	81 e6 00 00 c0 ff    	and    $0xffc00000,%esi
+		ksm_va += PGSIZE;
+f0105a7a:	89 35 4c 1c 61 f0    	mov    %esi,0xf0611c4c
+	while (ksm_va < UTOP && examined < NPTENTRIES && hashed < KSM_HASHES) {
+f0105a80:	8b 35 4c 1c 61 f0    	mov    0xf0611c4c,%esi
+f0105a86:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f0105a8c:	0f 87 8e 02 00 00    	ja     f0105d20 <ksm_scan+0x3af>
+f0105a92:	81 7d d4 ff 03 00 00 	cmpl   $0x3ff,-0x2c(%ebp)
+f0105a99:	0f 8f 73 02 00 00    	jg     f0105d12 <ksm_scan+0x3a1>
+f0105a9f:	83 7d d0 1f          	cmpl   $0x1f,-0x30(%ebp)
+f0105aa3:	0f 8f 69 02 00 00    	jg     f0105d12 <ksm_scan+0x3a1>
+		pde = e->env_pgdir[PDX(ksm_va)];
+f0105aa9:	89 f2                	mov    %esi,%edx
+f0105aab:	c1 ea 16             	shr    $0x16,%edx
+f0105aae:	8b 87 30 01 00 00    	mov    0x130(%edi),%eax
+f0105ab4:	8b 04 90             	mov    (%eax,%edx,4),%eax
+		if (!(pde & PTE_P) || (pde & PTE_PS)) {
+f0105ab7:	89 c2                	mov    %eax,%edx
+f0105ab9:	81 e2 81 00 00 00    	and    $0x81,%edx
+f0105abf:	83 fa 01             	cmp    $0x1,%edx
+f0105ac2:	75 aa                	jne    f0105a6e <ksm_scan+0xfd>
+		pte = (pte_t *) KADDR(PTE_ADDR(pde)) + PTX(ksm_va);
+f0105ac4:	89 c2                	mov    %eax,%edx
+f0105ac6:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages_lowmem)
+f0105acc:	c1 e8 0c             	shr    $0xc,%eax
+f0105acf:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0105ad5:	73 31                	jae    f0105b08 <ksm_scan+0x197>
+f0105ad7:	89 f0                	mov    %esi,%eax
+f0105ad9:	c1 e8 0a             	shr    $0xa,%eax
+f0105adc:	25 fc 0f 00 00       	and    $0xffc,%eax
+f0105ae1:	8d 84 02 00 00 00 f0 	lea    -0x10000000(%edx,%eax,1),%eax
+f0105ae8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+		examined++;
+f0105aeb:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+		if (ksm_candidate(pte)) {
+f0105aef:	e8 26 fe ff ff       	call   f010591a <ksm_candidate>
+f0105af4:	84 c0                	test   %al,%al
+f0105af6:	75 25                	jne    f0105b1d <ksm_scan+0x1ac>
+		ksm_va += PGSIZE;
+f0105af8:	a1 4c 1c 61 f0       	mov    0xf0611c4c,%eax
+f0105afd:	8d b0 00 10 00 00    	lea    0x1000(%eax),%esi
+f0105b03:	e9 72 ff ff ff       	jmp    f0105a7a <ksm_scan+0x109>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0105b08:	52                   	push   %edx
+f0105b09:	68 1c c0 10 f0       	push   $0xf010c01c
+f0105b0e:	68 d7 00 00 00       	push   $0xd7
+f0105b13:	68 98 dc 10 f0       	push   $0xf010dc98
+f0105b18:	e8 7b a5 ff ff       	call   f0100098 <_panic>
+			hashed++;
+f0105b1d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+	if (PGNUM(pa) >= npages)
+f0105b21:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0105b24:	8b 00                	mov    (%eax),%eax
+f0105b26:	c1 e8 0c             	shr    $0xc,%eax
+f0105b29:	3b 05 78 89 61 f0    	cmp    0xf0618978,%eax
+f0105b2f:	73 39                	jae    f0105b6a <ksm_scan+0x1f9>
+	return &pages[PGNUM(pa)];
+f0105b31:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0105b34:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0105b39:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0105b3c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	src = kmap(pp);
+f0105b3f:	83 ec 0c             	sub    $0xc,%esp
+f0105b42:	50                   	push   %eax
+f0105b43:	e8 5b c6 ff ff       	call   f01021a3 <kmap>
+f0105b48:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ksm_hash(const uint32_t *p)
+f0105b4b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+f0105b51:	83 c4 10             	add    $0x10,%esp
+	uint32_t h = 2166136261U;
+f0105b54:	bb c5 9d 1c 81       	mov    $0x811c9dc5,%ebx
+	for (i = 0; i < PGSIZE / 4; i++)
+f0105b59:	39 d0                	cmp    %edx,%eax
+f0105b5b:	74 21                	je     f0105b7e <ksm_scan+0x20d>
+		h = (h ^ p[i]) * 16777619U;
+f0105b5d:	33 18                	xor    (%eax),%ebx
+f0105b5f:	69 db 93 01 00 01    	imul   $0x1000193,%ebx,%ebx
+	for (i = 0; i < PGSIZE / 4; i++)
+f0105b65:	83 c0 04             	add    $0x4,%eax
+f0105b68:	eb ef                	jmp    f0105b59 <ksm_scan+0x1e8>
+		panic("pa2page called with invalid pa");
+f0105b6a:	83 ec 04             	sub    $0x4,%esp
+f0105b6d:	68 e8 ce 10 f0       	push   $0xf010cee8
+f0105b72:	6a 76                	push   $0x76
+f0105b74:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0105b79:	e8 1a a5 ff ff       	call   f0100098 <_panic>
+	ksm_scanned++;
+f0105b7e:	83 05 44 1c 61 f0 01 	addl   $0x1,0xf0611c44
+	b = &ksm_table[h % KSM_NBUCKET];
+f0105b85:	89 d9                	mov    %ebx,%ecx
+f0105b87:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+f0105b8d:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+	if (b->kb_page && b->kb_page != pp && b->kb_hash == h) {
+f0105b90:	89 c8                	mov    %ecx,%eax
+f0105b92:	c1 e0 04             	shl    $0x4,%eax
+f0105b95:	8b 80 64 1c 61 f0    	mov    -0xf9ee39c(%eax),%eax
+f0105b9b:	85 c0                	test   %eax,%eax
+f0105b9d:	74 12                	je     f0105bb1 <ksm_scan+0x240>
+f0105b9f:	8b 55 cc             	mov    -0x34(%ebp),%edx
+f0105ba2:	39 d0                	cmp    %edx,%eax
+f0105ba4:	74 0b                	je     f0105bb1 <ksm_scan+0x240>
+f0105ba6:	c1 e1 04             	shl    $0x4,%ecx
+f0105ba9:	39 99 60 1c 61 f0    	cmp    %ebx,-0xf9ee3a0(%ecx)
+f0105baf:	74 74                	je     f0105c25 <ksm_scan+0x2b4>
+	kunmap(src);
+f0105bb1:	83 ec 0c             	sub    $0xc,%esp
+f0105bb4:	ff 75 b8             	push   -0x48(%ebp)
+f0105bb7:	e8 91 c6 ff ff       	call   f010224d <kunmap>
+f0105bbc:	83 c4 10             	add    $0x10,%esp
+	if (b->kb_page) {
+f0105bbf:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0105bc2:	c1 e0 04             	shl    $0x4,%eax
+f0105bc5:	8b 80 64 1c 61 f0    	mov    -0xf9ee39c(%eax),%eax
+f0105bcb:	85 c0                	test   %eax,%eax
+f0105bcd:	0f 84 cf 00 00 00    	je     f0105ca2 <ksm_scan+0x331>
+		if (b->kb_page == pp || b->kb_page->pp_ref != 1)
+f0105bd3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0105bd6:	39 c8                	cmp    %ecx,%eax
+f0105bd8:	0f 84 1a ff ff ff    	je     f0105af8 <ksm_scan+0x187>
+f0105bde:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0105be3:	0f 85 0f ff ff ff    	jne    f0105af8 <ksm_scan+0x187>
+		page_decref(b->kb_page);
+f0105be9:	83 ec 0c             	sub    $0xc,%esp
+f0105bec:	50                   	push   %eax
+f0105bed:	e8 10 c5 ff ff       	call   f0102102 <page_decref>
+		b->kb_page = NULL;
+f0105bf2:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0105bf5:	c1 e0 04             	shl    $0x4,%eax
+f0105bf8:	c7 80 64 1c 61 f0 00 	movl   $0x0,-0xf9ee39c(%eax)
+f0105bff:	00 00 00 
+f0105c02:	83 c4 10             	add    $0x10,%esp
+	b->kb_hash = h;
+f0105c05:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0105c08:	c1 e2 04             	shl    $0x4,%edx
+f0105c0b:	8d 82 60 1c 61 f0    	lea    -0xf9ee3a0(%edx),%eax
+f0105c11:	89 9a 60 1c 61 f0    	mov    %ebx,-0xf9ee3a0(%edx)
+	b->kb_envid = e->env_id;
+f0105c17:	8b 57 4c             	mov    0x4c(%edi),%edx
+f0105c1a:	89 50 08             	mov    %edx,0x8(%eax)
+	b->kb_va = va;
+f0105c1d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return 0;
+f0105c20:	e9 d3 fe ff ff       	jmp    f0105af8 <ksm_scan+0x187>
+		dst = kmap(b->kb_page);
+f0105c25:	83 ec 0c             	sub    $0xc,%esp
+f0105c28:	50                   	push   %eax
+f0105c29:	e8 75 c5 ff ff       	call   f01021a3 <kmap>
+		same = !memcmp(src, dst, PGSIZE);
+f0105c2e:	83 c4 0c             	add    $0xc,%esp
+f0105c31:	68 00 10 00 00       	push   $0x1000
+f0105c36:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+f0105c39:	50                   	push   %eax
+f0105c3a:	ff 75 b8             	push   -0x48(%ebp)
+f0105c3d:	e8 69 4a 00 00       	call   f010a6ab <memcmp>
+f0105c42:	89 45 b0             	mov    %eax,-0x50(%ebp)
+		kunmap(dst);
+f0105c45:	83 c4 04             	add    $0x4,%esp
+f0105c48:	ff 75 b4             	push   -0x4c(%ebp)
+f0105c4b:	e8 fd c5 ff ff       	call   f010224d <kunmap>
+	kunmap(src);
+f0105c50:	83 c4 04             	add    $0x4,%esp
+f0105c53:	ff 75 b8             	push   -0x48(%ebp)
+f0105c56:	e8 f2 c5 ff ff       	call   f010224d <kunmap>
+	if (same) {
+f0105c5b:	83 c4 10             	add    $0x10,%esp
+f0105c5e:	83 7d b0 00          	cmpl   $0x0,-0x50(%ebp)
+f0105c62:	0f 85 57 ff ff ff    	jne    f0105bbf <ksm_scan+0x24e>
+		if (page_insert(e->env_pgdir, b->kb_page, (void *) va, *pte & PTE_SYSCALL) == 0)
+f0105c68:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0105c6b:	8b 00                	mov    (%eax),%eax
+f0105c6d:	25 07 0e 00 00       	and    $0xe07,%eax
+f0105c72:	50                   	push   %eax
+f0105c73:	56                   	push   %esi
+f0105c74:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0105c77:	c1 e0 04             	shl    $0x4,%eax
+f0105c7a:	ff b0 64 1c 61 f0    	push   -0xf9ee39c(%eax)
+f0105c80:	ff b7 30 01 00 00    	push   0x130(%edi)
+f0105c86:	e8 bd cc ff ff       	call   f0102948 <page_insert>
+f0105c8b:	83 c4 10             	add    $0x10,%esp
+f0105c8e:	85 c0                	test   %eax,%eax
+f0105c90:	0f 85 62 fe ff ff    	jne    f0105af8 <ksm_scan+0x187>
+			ksm_merged++;
+f0105c96:	83 05 40 1c 61 f0 01 	addl   $0x1,0xf0611c40
+f0105c9d:	e9 56 fe ff ff       	jmp    f0105af8 <ksm_scan+0x187>
+	} else if (b->kb_envid && b->kb_hash == h
+f0105ca2:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f0105ca5:	89 c8                	mov    %ecx,%eax
+f0105ca7:	c1 e0 04             	shl    $0x4,%eax
+f0105caa:	8b 80 68 1c 61 f0    	mov    -0xf9ee398(%eax),%eax
+f0105cb0:	85 c0                	test   %eax,%eax
+f0105cb2:	0f 84 4d ff ff ff    	je     f0105c05 <ksm_scan+0x294>
+f0105cb8:	c1 e1 04             	shl    $0x4,%ecx
+f0105cbb:	39 99 60 1c 61 f0    	cmp    %ebx,-0xf9ee3a0(%ecx)
+f0105cc1:	0f 85 3e ff ff ff    	jne    f0105c05 <ksm_scan+0x294>
+		   && (b->kb_envid != e->env_id || b->kb_va != va)) {
+f0105cc7:	3b 47 4c             	cmp    0x4c(%edi),%eax
+f0105cca:	75 0c                	jne    f0105cd8 <ksm_scan+0x367>
+f0105ccc:	3b b1 6c 1c 61 f0    	cmp    -0xf9ee394(%ecx),%esi
+f0105cd2:	0f 84 2d ff ff ff    	je     f0105c05 <ksm_scan+0x294>
+	b = &ksm_table[h % KSM_NBUCKET];
+f0105cd8:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f0105cdb:	c1 e3 04             	shl    $0x4,%ebx
+f0105cde:	81 c3 60 1c 61 f0    	add    $0xf0611c60,%ebx
+		page_incref(pp);
+f0105ce4:	83 ec 0c             	sub    $0xc,%esp
+f0105ce7:	ff 75 cc             	push   -0x34(%ebp)
+f0105cea:	e8 9a c3 ff ff       	call   f0102089 <page_incref>
+		m->km_envid = e->env_id;
+f0105cef:	8b 47 4c             	mov    0x4c(%edi),%eax
+f0105cf2:	89 45 c0             	mov    %eax,-0x40(%ebp)
+				ksm_va += PGSIZE;
+f0105cf5:	81 05 4c 1c 61 f0 00 	addl   $0x1000,0xf0611c4c
+f0105cfc:	10 00 00 
+				break;
+f0105cff:	83 c4 10             	add    $0x10,%esp
+f0105d02:	89 75 bc             	mov    %esi,-0x44(%ebp)
+f0105d05:	eb 25                	jmp    f0105d2c <ksm_scan+0x3bb>
+	int examined = 0, hashed = 0;
+f0105d07:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0105d0a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0105d0d:	e9 6e fd ff ff       	jmp    f0105a80 <ksm_scan+0x10f>
+f0105d12:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+f0105d19:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105d1e:	eb 0c                	jmp    f0105d2c <ksm_scan+0x3bb>
+f0105d20:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+f0105d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+	return ksm_va >= UTOP;
+f0105d2c:	81 3d 4c 1c 61 f0 ff 	cmpl   $0xeebfffff,0xf0611c4c
+f0105d33:	ff bf ee 
+f0105d36:	0f 97 c0             	seta   %al
+f0105d39:	89 c6                	mov    %eax,%esi
+		env_unlock(e);
+f0105d3b:	83 ec 0c             	sub    $0xc,%esp
+f0105d3e:	57                   	push   %edi
+f0105d3f:	e8 42 04 00 00       	call   f0106186 <env_unlock>
+	if (m.km_bucket)
+f0105d44:	83 c4 10             	add    $0x10,%esp
+f0105d47:	85 db                	test   %ebx,%ebx
+f0105d49:	74 37                	je     f0105d82 <ksm_scan+0x411>
+	if (envid2env(b->kb_envid, &he, 0) == 0
+f0105d4b:	83 ec 04             	sub    $0x4,%esp
+f0105d4e:	6a 00                	push   $0x0
+f0105d50:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105d53:	50                   	push   %eax
+f0105d54:	ff 73 08             	push   0x8(%ebx)
+f0105d57:	e8 c8 04 00 00       	call   f0106224 <envid2env>
+f0105d5c:	83 c4 10             	add    $0x10,%esp
+f0105d5f:	85 c0                	test   %eax,%eax
+f0105d61:	74 2e                	je     f0105d91 <ksm_scan+0x420>
+	if (m->km_page) {
+f0105d63:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0105d66:	85 c0                	test   %eax,%eax
+f0105d68:	74 18                	je     f0105d82 <ksm_scan+0x411>
+		b->kb_envid = m->km_envid;
+f0105d6a:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0105d6d:	89 4b 08             	mov    %ecx,0x8(%ebx)
+		b->kb_va = m->km_va;
+f0105d70:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+f0105d73:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		page_decref(m->km_page);
+f0105d76:	83 ec 0c             	sub    $0xc,%esp
+f0105d79:	50                   	push   %eax
+f0105d7a:	e8 83 c3 ff ff       	call   f0102102 <page_decref>
+f0105d7f:	83 c4 10             	add    $0x10,%esp
+	if (done) {
+f0105d82:	89 f0                	mov    %esi,%eax
+f0105d84:	84 c0                	test   %al,%al
+f0105d86:	0f 84 c9 fc ff ff    	je     f0105a55 <ksm_scan+0xe4>
+f0105d8c:	e9 b3 fc ff ff       	jmp    f0105a44 <ksm_scan+0xd3>
+	    && env_lock_checked(he, b->kb_envid) == 0) {
+f0105d91:	83 ec 08             	sub    $0x8,%esp
+f0105d94:	ff 73 08             	push   0x8(%ebx)
+f0105d97:	ff 75 e4             	push   -0x1c(%ebp)
+f0105d9a:	e8 13 04 00 00       	call   f01061b2 <env_lock_checked>
+f0105d9f:	83 c4 10             	add    $0x10,%esp
+f0105da2:	85 c0                	test   %eax,%eax
+f0105da4:	75 bd                	jne    f0105d63 <ksm_scan+0x3f2>
+		pte = pgdir_walk(he->env_pgdir, (void *) b->kb_va, 0);
+f0105da6:	83 ec 04             	sub    $0x4,%esp
+f0105da9:	6a 00                	push   $0x0
+f0105dab:	ff 73 0c             	push   0xc(%ebx)
+f0105dae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105db1:	ff b0 30 01 00 00    	push   0x130(%eax)
+f0105db7:	e8 a4 c7 ff ff       	call   f0102560 <pgdir_walk>
+f0105dbc:	89 c7                	mov    %eax,%edi
+		if (pte && ksm_candidate(pte)
+f0105dbe:	83 c4 10             	add    $0x10,%esp
+f0105dc1:	85 c0                	test   %eax,%eax
+f0105dc3:	74 09                	je     f0105dce <ksm_scan+0x45d>
+f0105dc5:	e8 50 fb ff ff       	call   f010591a <ksm_candidate>
+f0105dca:	84 c0                	test   %al,%al
+f0105dcc:	75 10                	jne    f0105dde <ksm_scan+0x46d>
+		env_unlock(he);
+f0105dce:	83 ec 0c             	sub    $0xc,%esp
+f0105dd1:	ff 75 e4             	push   -0x1c(%ebp)
+f0105dd4:	e8 ad 03 00 00       	call   f0106186 <env_unlock>
+f0105dd9:	83 c4 10             	add    $0x10,%esp
+f0105ddc:	eb 85                	jmp    f0105d63 <ksm_scan+0x3f2>
+	if (PGNUM(pa) >= npages)
+f0105dde:	8b 07                	mov    (%edi),%eax
+f0105de0:	c1 e8 0c             	shr    $0xc,%eax
+f0105de3:	3b 05 78 89 61 f0    	cmp    0xf0618978,%eax
+f0105de9:	0f 83 af 00 00 00    	jae    f0105e9e <ksm_scan+0x52d>
+	return &pages[PGNUM(pa)];
+f0105def:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0105df2:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0105df7:	8d 04 90             	lea    (%eax,%edx,4),%eax
+		    && (hp = pa2page(PTE_ADDR(*pte))) != m->km_page) {
+f0105dfa:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0105dfd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0105e00:	39 c1                	cmp    %eax,%ecx
+f0105e02:	0f 84 aa 00 00 00    	je     f0105eb2 <ksm_scan+0x541>
+			src = kmap(m->km_page);
+f0105e08:	83 ec 0c             	sub    $0xc,%esp
+f0105e0b:	51                   	push   %ecx
+f0105e0c:	e8 92 c3 ff ff       	call   f01021a3 <kmap>
+f0105e11:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+			dst = kmap(hp);
+f0105e14:	83 c4 04             	add    $0x4,%esp
+f0105e17:	ff 75 d0             	push   -0x30(%ebp)
+f0105e1a:	e8 84 c3 ff ff       	call   f01021a3 <kmap>
+			same = !memcmp(src, dst, PGSIZE);
+f0105e1f:	83 c4 0c             	add    $0xc,%esp
+f0105e22:	68 00 10 00 00       	push   $0x1000
+f0105e27:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0105e2a:	50                   	push   %eax
+f0105e2b:	ff 75 d4             	push   -0x2c(%ebp)
+f0105e2e:	e8 78 48 00 00       	call   f010a6ab <memcmp>
+f0105e33:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			kunmap(dst);
+f0105e36:	83 c4 04             	add    $0x4,%esp
+f0105e39:	ff 75 d0             	push   -0x30(%ebp)
+f0105e3c:	e8 0c c4 ff ff       	call   f010224d <kunmap>
+			kunmap(src);
+f0105e41:	83 c4 04             	add    $0x4,%esp
+f0105e44:	ff 75 d4             	push   -0x2c(%ebp)
+f0105e47:	e8 01 c4 ff ff       	call   f010224d <kunmap>
+		if (same && page_insert(he->env_pgdir, m->km_page, (void *) b->kb_va, *pte & PTE_SYSCALL) == 0) {
+f0105e4c:	83 c4 10             	add    $0x10,%esp
+f0105e4f:	83 7d c8 00          	cmpl   $0x0,-0x38(%ebp)
+f0105e53:	0f 85 75 ff ff ff    	jne    f0105dce <ksm_scan+0x45d>
+f0105e59:	8b 07                	mov    (%edi),%eax
+f0105e5b:	25 07 0e 00 00       	and    $0xe07,%eax
+f0105e60:	50                   	push   %eax
+f0105e61:	ff 73 0c             	push   0xc(%ebx)
+f0105e64:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f0105e67:	57                   	push   %edi
+f0105e68:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105e6b:	ff b0 30 01 00 00    	push   0x130(%eax)
+f0105e71:	e8 d2 ca ff ff       	call   f0102948 <page_insert>
+f0105e76:	83 c4 10             	add    $0x10,%esp
+f0105e79:	85 c0                	test   %eax,%eax
+f0105e7b:	0f 85 4d ff ff ff    	jne    f0105dce <ksm_scan+0x45d>
+			ksm_merged++;
+f0105e81:	83 05 40 1c 61 f0 01 	addl   $0x1,0xf0611c40
+			b->kb_page = m->km_page;
+f0105e88:	89 7b 04             	mov    %edi,0x4(%ebx)
+			b->kb_envid = 0;
+f0105e8b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+			m->km_page = NULL;
+f0105e92:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+f0105e99:	e9 30 ff ff ff       	jmp    f0105dce <ksm_scan+0x45d>
+		panic("pa2page called with invalid pa");
+f0105e9e:	83 ec 04             	sub    $0x4,%esp
+f0105ea1:	68 e8 ce 10 f0       	push   $0xf010cee8
+f0105ea6:	6a 76                	push   $0x76
+f0105ea8:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0105ead:	e8 e6 a1 ff ff       	call   f0100098 <_panic>
+f0105eb2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0105eb5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0105eb8:	e9 11 ff ff ff       	jmp    f0105dce <ksm_scan+0x45d>
+
+f0105ebd <ksm_stat>:
+
+// Fill in *st with the merging counters.
+void
+ksm_stat(struct KsmStat *st)
+{
+f0105ebd:	55                   	push   %ebp
+f0105ebe:	89 e5                	mov    %esp,%ebp
+f0105ec0:	56                   	push   %esi
+f0105ec1:	53                   	push   %ebx
+f0105ec2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct PageInfo *pp;
+	int i;
+
+	memset(st, 0, sizeof(*st));
+f0105ec5:	83 ec 04             	sub    $0x4,%esp
+f0105ec8:	6a 10                	push   $0x10
+f0105eca:	6a 00                	push   $0x0
+f0105ecc:	53                   	push   %ebx
+f0105ecd:	e8 2c 47 00 00       	call   f010a5fe <memset>
+	st->scanned = ksm_scanned;
+f0105ed2:	a1 44 1c 61 f0       	mov    0xf0611c44,%eax
+f0105ed7:	89 03                	mov    %eax,(%ebx)
+	st->merged = ksm_merged;
+f0105ed9:	a1 40 1c 61 f0       	mov    0xf0611c40,%eax
+f0105ede:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < KSM_NBUCKET; i++) {
+f0105ee1:	b8 64 1c 61 f0       	mov    $0xf0611c64,%eax
+f0105ee6:	b9 64 5c 61 f0       	mov    $0xf0615c64,%ecx
+f0105eeb:	83 c4 10             	add    $0x10,%esp
+f0105eee:	eb 03                	jmp    f0105ef3 <ksm_stat+0x36>
+f0105ef0:	83 c0 10             	add    $0x10,%eax
+f0105ef3:	39 c8                	cmp    %ecx,%eax
+f0105ef5:	74 23                	je     f0105f1a <ksm_stat+0x5d>
+		if (!(pp = ksm_table[i].kb_page))
+f0105ef7:	8b 10                	mov    (%eax),%edx
+f0105ef9:	85 d2                	test   %edx,%edx
+f0105efb:	74 f3                	je     f0105ef0 <ksm_stat+0x33>
+			continue;
+		st->pages++;
+f0105efd:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+		// One reference is the table's, and one mapping would
+		// need the page anyway.
+		if (pp->pp_ref > 2)
+f0105f01:	0f b7 52 04          	movzwl 0x4(%edx),%edx
+f0105f05:	66 83 fa 02          	cmp    $0x2,%dx
+f0105f09:	76 e5                	jbe    f0105ef0 <ksm_stat+0x33>
+			st->saved += pp->pp_ref - 2;
+f0105f0b:	0f b7 d2             	movzwl %dx,%edx
+f0105f0e:	8b 73 0c             	mov    0xc(%ebx),%esi
+f0105f11:	8d 54 16 fe          	lea    -0x2(%esi,%edx,1),%edx
+f0105f15:	89 53 0c             	mov    %edx,0xc(%ebx)
+f0105f18:	eb d6                	jmp    f0105ef0 <ksm_stat+0x33>
+	}
+}
+f0105f1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0105f1d:	5b                   	pop    %ebx
+f0105f1e:	5e                   	pop    %esi
+f0105f1f:	5d                   	pop    %ebp
+f0105f20:	c3                   	ret
+
+f0105f21 <env_grow>:
+// Returns 0 on success, -E_NO_FREE_ENV if the table has NENV
+// environments already, or -E_NO_MEM.
+//
+static int
+env_grow(void)
+{
+f0105f21:	55                   	push   %ebp
+f0105f22:	89 e5                	mov    %esp,%ebp
+f0105f24:	57                   	push   %edi
+f0105f25:	56                   	push   %esi
+f0105f26:	53                   	push   %ebx
+f0105f27:	83 ec 1c             	sub    $0x1c,%esp
+	struct PageInfo *pp;
+	struct Env *page;
+	struct spinlock *locks;
+	uint32_t n = env_nslots / NENVPERPAGE;
+f0105f2a:	a1 e4 5c 61 f0       	mov    0xf0615ce4,%eax
+f0105f2f:	c1 e8 03             	shr    $0x3,%eax
+f0105f32:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	int i, r;
+
+	if (n == NENV / NENVPERPAGE)
+f0105f35:	3d 00 04 00 00       	cmp    $0x400,%eax
+f0105f3a:	0f 84 5a 01 00 00    	je     f010609a <env_grow+0x179>
+		return -E_NO_FREE_ENV;
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+f0105f40:	83 ec 0c             	sub    $0xc,%esp
+f0105f43:	6a 01                	push   $0x1
+f0105f45:	e8 80 c3 ff ff       	call   f01022ca <page_alloc>
+f0105f4a:	89 c3                	mov    %eax,%ebx
+f0105f4c:	83 c4 10             	add    $0x10,%esp
+f0105f4f:	85 c0                	test   %eax,%eax
+f0105f51:	0f 84 4a 01 00 00    	je     f01060a1 <env_grow+0x180>
+		return -E_NO_MEM;
+	if (!(locks = kmalloc(NENVPERPAGE * sizeof(*locks), 0))) {
+f0105f57:	83 ec 08             	sub    $0x8,%esp
+f0105f5a:	6a 00                	push   $0x0
+f0105f5c:	68 00 03 00 00       	push   $0x300
+f0105f61:	e8 38 f8 ff ff       	call   f010579e <kmalloc>
+f0105f66:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0105f69:	83 c4 10             	add    $0x10,%esp
+f0105f6c:	85 c0                	test   %eax,%eax
+f0105f6e:	0f 84 e9 00 00 00    	je     f010605d <env_grow+0x13c>
+		page_free(pp);
+		return -E_NO_MEM;
+	}
+	// kern_pgdir and every env_pgdir share the page table at UENVS.
+	if ((r = page_insert(kern_pgdir, pp, (void *) (UENVS + n * PGSIZE), PTE_U|PTE_P)) < 0) {
+f0105f74:	6a 05                	push   $0x5
+f0105f76:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105f79:	05 00 ec 0e 00       	add    $0xeec00,%eax
+f0105f7e:	c1 e0 0c             	shl    $0xc,%eax
+f0105f81:	50                   	push   %eax
+f0105f82:	53                   	push   %ebx
+f0105f83:	ff 35 7c 89 61 f0    	push   0xf061897c
+f0105f89:	e8 ba c9 ff ff       	call   f0102948 <page_insert>
+f0105f8e:	89 c6                	mov    %eax,%esi
+f0105f90:	83 c4 10             	add    $0x10,%esp
+f0105f93:	85 c0                	test   %eax,%eax
+f0105f95:	0f 88 d5 00 00 00    	js     f0106070 <env_grow+0x14f>
+	return (pp - pages) << PGSHIFT;
+f0105f9b:	2b 1d 80 89 61 f0    	sub    0xf0618980,%ebx
+f0105fa1:	c1 fb 02             	sar    $0x2,%ebx
+f0105fa4:	69 c3 ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%eax
+f0105faa:	89 c3                	mov    %eax,%ebx
+f0105fac:	c1 e3 0c             	shl    $0xc,%ebx
+	if (PGNUM(pa) >= npages_lowmem)
+f0105faf:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0105fb4:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0105fba:	0f 83 c8 00 00 00    	jae    f0106088 <env_grow+0x167>
+	return (void *)(pa + KERNBASE);
+f0105fc0:	8d 93 00 00 00 f0    	lea    -0x10000000(%ebx),%edx
+		page_free(pp);
+		return r;
+	}
+
+	page = page2kva(pp);
+	for (i = NENVPERPAGE - 1; i >= 0; i--) {
+f0105fc6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105fc9:	8d b8 a0 02 00 00    	lea    0x2a0(%eax),%edi
+f0105fcf:	81 eb 00 f2 ff 0f    	sub    $0xffff200,%ebx
+f0105fd5:	be 07 00 00 00       	mov    $0x7,%esi
+f0105fda:	89 55 dc             	mov    %edx,-0x24(%ebp)
+		__spin_initlock(&locks[i], "env_lock");
+f0105fdd:	83 ec 08             	sub    $0x8,%esp
+f0105fe0:	68 37 dd 10 f0       	push   $0xf010dd37
+f0105fe5:	57                   	push   %edi
+f0105fe6:	e8 c0 4e 00 00       	call   f010aeab <__spin_initlock>
+		page[i].env_index = env_nslots + i;
+f0105feb:	a1 e4 5c 61 f0       	mov    0xf0615ce4,%eax
+f0105ff0:	01 f0                	add    %esi,%eax
+f0105ff2:	89 43 48             	mov    %eax,0x48(%ebx)
+		page[i].env_id = 0;
+f0105ff5:	c7 43 4c 00 00 00 00 	movl   $0x0,0x4c(%ebx)
+		page[i].env_rq_cpu = -1;
+f0105ffc:	c7 43 6c ff ff ff ff 	movl   $0xffffffff,0x6c(%ebx)
+		page[i].env_link = env_free_list;
+f0106003:	a1 e0 5c 61 f0       	mov    0xf0615ce0,%eax
+f0106008:	89 43 44             	mov    %eax,0x44(%ebx)
+		env_free_list = &page[i];
+f010600b:	89 1d e0 5c 61 f0    	mov    %ebx,0xf0615ce0
+	for (i = NENVPERPAGE - 1; i >= 0; i--) {
+f0106011:	83 ee 01             	sub    $0x1,%esi
+f0106014:	83 ef 60             	sub    $0x60,%edi
+f0106017:	81 eb 00 02 00 00    	sub    $0x200,%ebx
+f010601d:	83 c4 10             	add    $0x10,%esp
+f0106020:	83 fe ff             	cmp    $0xffffffff,%esi
+f0106023:	75 b8                	jne    f0105fdd <env_grow+0xbc>
+	}
+	env_pages[n] = page;
+f0106025:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0106028:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010602b:	89 14 85 00 6d 61 f0 	mov    %edx,-0xf9e9300(,%eax,4)
+	env_page_locks[n] = locks;
+f0106032:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0106035:	89 0c 85 00 5d 61 f0 	mov    %ecx,-0xf9ea300(,%eax,4)
+	asm volatile("lock; addl $0, 0(%%esp)" : : : "cc", "memory");
+f010603c:	f0 83 04 24 00       	lock addl $0x0,(%esp)
+	// envid2env() reads env_pages without env_free_lock.
+	mb();
+	env_nslots += NENVPERPAGE;
+f0106041:	a1 e4 5c 61 f0       	mov    0xf0615ce4,%eax
+f0106046:	83 c0 08             	add    $0x8,%eax
+f0106049:	a3 e4 5c 61 f0       	mov    %eax,0xf0615ce4
+	return 0;
+f010604e:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f0106053:	89 f0                	mov    %esi,%eax
+f0106055:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106058:	5b                   	pop    %ebx
+f0106059:	5e                   	pop    %esi
+f010605a:	5f                   	pop    %edi
+f010605b:	5d                   	pop    %ebp
+f010605c:	c3                   	ret
+		page_free(pp);
+f010605d:	83 ec 0c             	sub    $0xc,%esp
+f0106060:	53                   	push   %ebx
+f0106061:	e8 4b be ff ff       	call   f0101eb1 <page_free>
+		return -E_NO_MEM;
+f0106066:	83 c4 10             	add    $0x10,%esp
+f0106069:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f010606e:	eb e3                	jmp    f0106053 <env_grow+0x132>
+		kfree(locks);
+f0106070:	83 ec 0c             	sub    $0xc,%esp
+f0106073:	ff 75 e0             	push   -0x20(%ebp)
+f0106076:	e8 19 f8 ff ff       	call   f0105894 <kfree>
+		page_free(pp);
+f010607b:	89 1c 24             	mov    %ebx,(%esp)
+f010607e:	e8 2e be ff ff       	call   f0101eb1 <page_free>
+		return r;
+f0106083:	83 c4 10             	add    $0x10,%esp
+f0106086:	eb cb                	jmp    f0106053 <env_grow+0x132>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0106088:	53                   	push   %ebx
+f0106089:	68 1c c0 10 f0       	push   $0xf010c01c
+f010608e:	6a 7d                	push   $0x7d
+f0106090:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0106095:	e8 fe 9f ff ff       	call   f0100098 <_panic>
+		return -E_NO_FREE_ENV;
+f010609a:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+f010609f:	eb b2                	jmp    f0106053 <env_grow+0x132>
+		return -E_NO_MEM;
+f01060a1:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f01060a6:	eb ab                	jmp    f0106053 <env_grow+0x132>
+
+f01060a8 <region_alloc>:
+// Pages should be writable by user and kernel.
+// Panic if any allocation attempt fails.
+//
+static void
+region_alloc(struct Env *e, void *va, size_t len)
+{
+f01060a8:	55                   	push   %ebp
+f01060a9:	89 e5                	mov    %esp,%ebp
+f01060ab:	57                   	push   %edi
+f01060ac:	56                   	push   %esi
+f01060ad:	53                   	push   %ebx
+f01060ae:	83 ec 1c             	sub    $0x1c,%esp
+f01060b1:	89 c7                	mov    %eax,%edi
+	//   You should round va down, and round (va + len) up.
+	//   (Watch out for corner-cases!)
+	pte_t *pte;
+	struct PageInfo *p;
+
+	len = ROUNDUP((size_t) va + len, PGSIZE);
+f01060b3:	8d 84 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%eax
+f01060ba:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f01060bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	va = (void *) ROUNDDOWN((size_t) va, PGSIZE);
+f01060c2:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	len -= (size_t) va;
+f01060c8:	29 d0                	sub    %edx,%eax
+f01060ca:	89 c6                	mov    %eax,%esi
+
+	for (; len > 0; len -= PGSIZE, va += PGSIZE) {
+f01060cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01060cf:	29 f0                	sub    %esi,%eax
+f01060d1:	85 f6                	test   %esi,%esi
+f01060d3:	74 7d                	je     f0106152 <region_alloc+0xaa>
+		pte = pgdir_walk(e->env_pgdir, va, 1);
+f01060d5:	83 ec 04             	sub    $0x4,%esp
+f01060d8:	6a 01                	push   $0x1
+f01060da:	50                   	push   %eax
+f01060db:	ff b7 30 01 00 00    	push   0x130(%edi)
+f01060e1:	e8 7a c4 ff ff       	call   f0102560 <pgdir_walk>
+f01060e6:	89 c3                	mov    %eax,%ebx
+		if (!pte)
+f01060e8:	83 c4 10             	add    $0x10,%esp
+f01060eb:	85 c0                	test   %eax,%eax
+f01060ed:	74 35                	je     f0106124 <region_alloc+0x7c>
+			panic("run out of physical memory to alloc a page table page");
+
+		p = page_alloc(ALLOC_HIGH);
+f01060ef:	83 ec 0c             	sub    $0xc,%esp
+f01060f2:	6a 02                	push   $0x2
+f01060f4:	e8 d1 c1 ff ff       	call   f01022ca <page_alloc>
+		if (!p)
+f01060f9:	83 c4 10             	add    $0x10,%esp
+f01060fc:	85 c0                	test   %eax,%eax
+f01060fe:	74 3b                	je     f010613b <region_alloc+0x93>
+			panic("run out of physical memory to alloc a page");
+
+		p->pp_ref++;
+f0106100:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f0106105:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f010610b:	c1 f8 02             	sar    $0x2,%eax
+f010610e:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0106114:	c1 e0 0c             	shl    $0xc,%eax
+		*pte = PTE_ADDR(page2pa(p))|PTE_P|PTE_U|PTE_W;
+f0106117:	83 c8 07             	or     $0x7,%eax
+f010611a:	89 03                	mov    %eax,(%ebx)
+	for (; len > 0; len -= PGSIZE, va += PGSIZE) {
+f010611c:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+f0106122:	eb a8                	jmp    f01060cc <region_alloc+0x24>
+			panic("run out of physical memory to alloc a page table page");
+f0106124:	83 ec 04             	sub    $0x4,%esp
+f0106127:	68 a4 dc 10 f0       	push   $0xf010dca4
+f010612c:	68 c5 01 00 00       	push   $0x1c5
+f0106131:	68 40 dd 10 f0       	push   $0xf010dd40
+f0106136:	e8 5d 9f ff ff       	call   f0100098 <_panic>
+			panic("run out of physical memory to alloc a page");
+f010613b:	83 ec 04             	sub    $0x4,%esp
+f010613e:	68 dc dc 10 f0       	push   $0xf010dcdc
+f0106143:	68 c9 01 00 00       	push   $0x1c9
+f0106148:	68 40 dd 10 f0       	push   $0xf010dd40
+f010614d:	e8 46 9f ff ff       	call   f0100098 <_panic>
+	}
+}
+f0106152:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106155:	5b                   	pop    %ebx
+f0106156:	5e                   	pop    %esi
+f0106157:	5f                   	pop    %edi
+f0106158:	5d                   	pop    %ebp
+f0106159:	c3                   	ret
+
+f010615a <env_lock>:
+{
+f010615a:	55                   	push   %ebp
+f010615b:	89 e5                	mov    %esp,%ebp
+f010615d:	83 ec 14             	sub    $0x14,%esp
+	return &env_page_locks[e->env_index / NENVPERPAGE][e->env_index % NENVPERPAGE];
+f0106160:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106163:	8b 40 48             	mov    0x48(%eax),%eax
+f0106166:	89 c2                	mov    %eax,%edx
+f0106168:	c1 ea 03             	shr    $0x3,%edx
+f010616b:	83 e0 07             	and    $0x7,%eax
+f010616e:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0106171:	c1 e0 05             	shl    $0x5,%eax
+f0106174:	03 04 95 00 5d 61 f0 	add    -0xf9ea300(,%edx,4),%eax
+	spin_lock(env_lockp(e));
+f010617b:	50                   	push   %eax
+f010617c:	e8 52 4d 00 00       	call   f010aed3 <spin_lock>
+}
+f0106181:	83 c4 10             	add    $0x10,%esp
+f0106184:	c9                   	leave
+f0106185:	c3                   	ret
+
+f0106186 <env_unlock>:
+{
+f0106186:	55                   	push   %ebp
+f0106187:	89 e5                	mov    %esp,%ebp
+f0106189:	83 ec 14             	sub    $0x14,%esp
+	return &env_page_locks[e->env_index / NENVPERPAGE][e->env_index % NENVPERPAGE];
+f010618c:	8b 45 08             	mov    0x8(%ebp),%eax
+f010618f:	8b 40 48             	mov    0x48(%eax),%eax
+f0106192:	89 c2                	mov    %eax,%edx
+f0106194:	c1 ea 03             	shr    $0x3,%edx
+f0106197:	83 e0 07             	and    $0x7,%eax
+f010619a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f010619d:	c1 e0 05             	shl    $0x5,%eax
+f01061a0:	03 04 95 00 5d 61 f0 	add    -0xf9ea300(,%edx,4),%eax
+	spin_unlock(env_lockp(e));
+f01061a7:	50                   	push   %eax
+f01061a8:	e8 42 4e 00 00       	call   f010afef <spin_unlock>
+}
+f01061ad:	83 c4 10             	add    $0x10,%esp
+f01061b0:	c9                   	leave
+f01061b1:	c3                   	ret
+
+f01061b2 <env_lock_checked>:
+{
+f01061b2:	55                   	push   %ebp
+f01061b3:	89 e5                	mov    %esp,%ebp
+f01061b5:	56                   	push   %esi
+f01061b6:	53                   	push   %ebx
+f01061b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01061ba:	8b 75 0c             	mov    0xc(%ebp),%esi
+	env_lock(e);
+f01061bd:	83 ec 0c             	sub    $0xc,%esp
+f01061c0:	53                   	push   %ebx
+f01061c1:	e8 94 ff ff ff       	call   f010615a <env_lock>
+	if (e->env_status == ENV_FREE || (envid && e->env_id != envid)) {
+f01061c6:	83 c4 10             	add    $0x10,%esp
+f01061c9:	83 7b 58 00          	cmpl   $0x0,0x58(%ebx)
+f01061cd:	74 17                	je     f01061e6 <env_lock_checked+0x34>
+	return 0;
+f01061cf:	89 f0                	mov    %esi,%eax
+	if (e->env_status == ENV_FREE || (envid && e->env_id != envid)) {
+f01061d1:	85 f6                	test   %esi,%esi
+f01061d3:	74 0a                	je     f01061df <env_lock_checked+0x2d>
+f01061d5:	39 73 4c             	cmp    %esi,0x4c(%ebx)
+f01061d8:	75 0c                	jne    f01061e6 <env_lock_checked+0x34>
+	return 0;
+f01061da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01061df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01061e2:	5b                   	pop    %ebx
+f01061e3:	5e                   	pop    %esi
+f01061e4:	5d                   	pop    %ebp
+f01061e5:	c3                   	ret
+		env_unlock(e);
+f01061e6:	83 ec 0c             	sub    $0xc,%esp
+f01061e9:	53                   	push   %ebx
+f01061ea:	e8 97 ff ff ff       	call   f0106186 <env_unlock>
+		return -E_BAD_ENV;
+f01061ef:	83 c4 10             	add    $0x10,%esp
+f01061f2:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f01061f7:	eb e6                	jmp    f01061df <env_lock_checked+0x2d>
+
+f01061f9 <env_slot>:
+{
+f01061f9:	55                   	push   %ebp
+f01061fa:	89 e5                	mov    %esp,%ebp
+f01061fc:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (index >= env_nslots)
+f01061ff:	8b 15 e4 5c 61 f0    	mov    0xf0615ce4,%edx
+f0106205:	39 d0                	cmp    %edx,%eax
+f0106207:	73 14                	jae    f010621d <env_slot+0x24>
+	return &env_pages[index / NENVPERPAGE][index % NENVPERPAGE];
+f0106209:	89 c2                	mov    %eax,%edx
+f010620b:	c1 ea 03             	shr    $0x3,%edx
+f010620e:	83 e0 07             	and    $0x7,%eax
+f0106211:	c1 e0 09             	shl    $0x9,%eax
+f0106214:	03 04 95 00 6d 61 f0 	add    -0xf9e9300(,%edx,4),%eax
+}
+f010621b:	5d                   	pop    %ebp
+f010621c:	c3                   	ret
+		return NULL;
+f010621d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106222:	eb f7                	jmp    f010621b <env_slot+0x22>
+
+f0106224 <envid2env>:
+{
+f0106224:	55                   	push   %ebp
+f0106225:	89 e5                	mov    %esp,%ebp
+f0106227:	57                   	push   %edi
+f0106228:	56                   	push   %esi
+f0106229:	53                   	push   %ebx
+f010622a:	83 ec 0c             	sub    $0xc,%esp
+f010622d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0106230:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (envid == 0) {
+f0106233:	85 db                	test   %ebx,%ebx
+f0106235:	74 3c                	je     f0106273 <envid2env+0x4f>
+	e = env_slot(ENVX(envid));
+f0106237:	83 ec 0c             	sub    $0xc,%esp
+f010623a:	89 d8                	mov    %ebx,%eax
+f010623c:	25 ff 1f 00 00       	and    $0x1fff,%eax
+f0106241:	50                   	push   %eax
+f0106242:	e8 b2 ff ff ff       	call   f01061f9 <env_slot>
+f0106247:	89 c6                	mov    %eax,%esi
+	if (!e || e->env_status == ENV_FREE || e->env_id != envid) {
+f0106249:	83 c4 10             	add    $0x10,%esp
+f010624c:	85 c0                	test   %eax,%eax
+f010624e:	74 70                	je     f01062c0 <envid2env+0x9c>
+f0106250:	83 78 58 00          	cmpl   $0x0,0x58(%eax)
+f0106254:	74 71                	je     f01062c7 <envid2env+0xa3>
+f0106256:	39 58 4c             	cmp    %ebx,0x4c(%eax)
+f0106259:	75 78                	jne    f01062d3 <envid2env+0xaf>
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+f010625b:	89 f8                	mov    %edi,%eax
+f010625d:	84 c0                	test   %al,%al
+f010625f:	75 27                	jne    f0106288 <envid2env+0x64>
+	return 0;
+f0106261:	b8 00 00 00 00       	mov    $0x0,%eax
+		*env_store = curenv;
+f0106266:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0106269:	89 32                	mov    %esi,(%edx)
+}
+f010626b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010626e:	5b                   	pop    %ebx
+f010626f:	5e                   	pop    %esi
+f0106270:	5f                   	pop    %edi
+f0106271:	5d                   	pop    %ebp
+f0106272:	c3                   	ret
+		*env_store = curenv;
+f0106273:	e8 cc 49 00 00       	call   f010ac44 <cpunum>
+f0106278:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010627e:	8b b0 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%esi
+		return 0;
+f0106284:	89 d8                	mov    %ebx,%eax
+f0106286:	eb de                	jmp    f0106266 <envid2env+0x42>
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+f0106288:	e8 b7 49 00 00       	call   f010ac44 <cpunum>
+f010628d:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106293:	39 b0 28 90 61 f0    	cmp    %esi,-0xf9e6fd8(%eax)
+f0106299:	74 c6                	je     f0106261 <envid2env+0x3d>
+f010629b:	8b 5e 50             	mov    0x50(%esi),%ebx
+f010629e:	e8 a1 49 00 00       	call   f010ac44 <cpunum>
+f01062a3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01062a9:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01062af:	3b 58 4c             	cmp    0x4c(%eax),%ebx
+f01062b2:	74 ad                	je     f0106261 <envid2env+0x3d>
+f01062b4:	be 00 00 00 00       	mov    $0x0,%esi
+		return -E_BAD_ENV;
+f01062b9:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f01062be:	eb a6                	jmp    f0106266 <envid2env+0x42>
+		return -E_BAD_ENV;
+f01062c0:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f01062c5:	eb 9f                	jmp    f0106266 <envid2env+0x42>
+f01062c7:	be 00 00 00 00       	mov    $0x0,%esi
+f01062cc:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f01062d1:	eb 93                	jmp    f0106266 <envid2env+0x42>
+f01062d3:	be 00 00 00 00       	mov    $0x0,%esi
+f01062d8:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f01062dd:	eb 87                	jmp    f0106266 <envid2env+0x42>
+
+f01062df <env_find>:
+{
+f01062df:	55                   	push   %ebp
+f01062e0:	89 e5                	mov    %esp,%ebp
+f01062e2:	56                   	push   %esi
+f01062e3:	53                   	push   %ebx
+f01062e4:	8b 75 08             	mov    0x8(%ebp),%esi
+	for (i = 0; (e = env_slot(i)); i++) {
+f01062e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01062ec:	eb 03                	jmp    f01062f1 <env_find+0x12>
+f01062ee:	83 c3 01             	add    $0x1,%ebx
+f01062f1:	83 ec 0c             	sub    $0xc,%esp
+f01062f4:	53                   	push   %ebx
+f01062f5:	e8 ff fe ff ff       	call   f01061f9 <env_slot>
+f01062fa:	83 c4 10             	add    $0x10,%esp
+f01062fd:	85 c0                	test   %eax,%eax
+f01062ff:	74 0e                	je     f010630f <env_find+0x30>
+		if (e->env_status != ENV_FREE && e->env_type == type)
+f0106301:	83 78 58 00          	cmpl   $0x0,0x58(%eax)
+f0106305:	74 e7                	je     f01062ee <env_find+0xf>
+f0106307:	39 70 54             	cmp    %esi,0x54(%eax)
+f010630a:	75 e2                	jne    f01062ee <env_find+0xf>
+			return e->env_id;
+f010630c:	8b 40 4c             	mov    0x4c(%eax),%eax
+}
+f010630f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0106312:	5b                   	pop    %ebx
+f0106313:	5e                   	pop    %esi
+f0106314:	5d                   	pop    %ebp
+f0106315:	c3                   	ret
+
+f0106316 <env_init_percpu>:
+	__asm __volatile("lgdt (%0)" : : "r" (p));
+f0106316:	b8 40 94 11 f0       	mov    $0xf0119440,%eax
+f010631b:	0f 01 10             	lgdtl  (%eax)
+	asm volatile("movw %%ax,%%gs" :: "a" (GD_UD|3));
+f010631e:	b8 23 00 00 00       	mov    $0x23,%eax
+f0106323:	8e e8                	mov    %eax,%gs
+	asm volatile("movw %%ax,%%fs" :: "a" (GD_UD|3));
+f0106325:	8e e0                	mov    %eax,%fs
+	asm volatile("movw %%ax,%%es" :: "a" (GD_KD));
+f0106327:	b8 10 00 00 00       	mov    $0x10,%eax
+f010632c:	8e c0                	mov    %eax,%es
+	asm volatile("movw %%ax,%%ds" :: "a" (GD_KD));
+f010632e:	8e d8                	mov    %eax,%ds
+	asm volatile("movw %%ax,%%ss" :: "a" (GD_KD));
+f0106330:	8e d0                	mov    %eax,%ss
+	asm volatile("ljmp %0,$1f\n 1:\n" :: "i" (GD_KT));
+f0106332:	ea 39 63 10 f0 08 00 	ljmp   $0x8,$0xf0106339
+	__asm __volatile("lldt %0" : : "r" (sel));
+f0106339:	b8 00 00 00 00       	mov    $0x0,%eax
+f010633e:	0f 00 d0             	lldt   %ax
+}
+f0106341:	c3                   	ret
+
+f0106342 <env_init>:
+{
+f0106342:	55                   	push   %ebp
+f0106343:	89 e5                	mov    %esp,%ebp
+f0106345:	83 ec 10             	sub    $0x10,%esp
+	spin_initlock(&env_free_lock);
+f0106348:	68 4b dd 10 f0       	push   $0xf010dd4b
+f010634d:	68 80 5c 61 f0       	push   $0xf0615c80
+f0106352:	e8 54 4b 00 00       	call   f010aeab <__spin_initlock>
+	spin_lock(&env_free_lock);
+f0106357:	c7 04 24 80 5c 61 f0 	movl   $0xf0615c80,(%esp)
+f010635e:	e8 70 4b 00 00       	call   f010aed3 <spin_lock>
+	if (env_grow() < 0)
+f0106363:	e8 b9 fb ff ff       	call   f0105f21 <env_grow>
+f0106368:	83 c4 10             	add    $0x10,%esp
+f010636b:	85 c0                	test   %eax,%eax
+f010636d:	78 17                	js     f0106386 <env_init+0x44>
+	spin_unlock(&env_free_lock);
+f010636f:	83 ec 0c             	sub    $0xc,%esp
+f0106372:	68 80 5c 61 f0       	push   $0xf0615c80
+f0106377:	e8 73 4c 00 00       	call   f010afef <spin_unlock>
+	env_init_percpu();
+f010637c:	e8 95 ff ff ff       	call   f0106316 <env_init_percpu>
+}
+f0106381:	83 c4 10             	add    $0x10,%esp
+f0106384:	c9                   	leave
+f0106385:	c3                   	ret
+		panic("env_init: out of memory");
+f0106386:	83 ec 04             	sub    $0x4,%esp
+f0106389:	68 5a dd 10 f0       	push   $0xf010dd5a
+f010638e:	68 e3 00 00 00       	push   $0xe3
+f0106393:	68 40 dd 10 f0       	push   $0xf010dd40
+f0106398:	e8 fb 9c ff ff       	call   f0100098 <_panic>
+
+f010639d <env_alloc>:
+{
+f010639d:	55                   	push   %ebp
+f010639e:	89 e5                	mov    %esp,%ebp
+f01063a0:	53                   	push   %ebx
+f01063a1:	83 ec 10             	sub    $0x10,%esp
+	spin_lock(&env_free_lock);
+f01063a4:	68 80 5c 61 f0       	push   $0xf0615c80
+f01063a9:	e8 25 4b 00 00       	call   f010aed3 <spin_lock>
+	if (!env_free_list && (r = env_grow()) < 0) {
+f01063ae:	83 c4 10             	add    $0x10,%esp
+f01063b1:	83 3d e0 5c 61 f0 00 	cmpl   $0x0,0xf0615ce0
+f01063b8:	0f 84 ee 01 00 00    	je     f01065ac <env_alloc+0x20f>
+	e = env_free_list;
+f01063be:	8b 1d e0 5c 61 f0    	mov    0xf0615ce0,%ebx
+	env_free_list = e->env_link;
+f01063c4:	8b 43 44             	mov    0x44(%ebx),%eax
+f01063c7:	a3 e0 5c 61 f0       	mov    %eax,0xf0615ce0
+	spin_unlock(&env_free_lock);
+f01063cc:	83 ec 0c             	sub    $0xc,%esp
+f01063cf:	68 80 5c 61 f0       	push   $0xf0615c80
+f01063d4:	e8 16 4c 00 00       	call   f010afef <spin_unlock>
+	if (!(p = page_alloc(ALLOC_ZERO)))
+f01063d9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f01063e0:	e8 e5 be ff ff       	call   f01022ca <page_alloc>
+f01063e5:	83 c4 10             	add    $0x10,%esp
+f01063e8:	85 c0                	test   %eax,%eax
+f01063ea:	0f 84 04 02 00 00    	je     f01065f4 <env_alloc+0x257>
+	p->pp_ref++;
+f01063f0:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+f01063f5:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f01063fb:	c1 f8 02             	sar    $0x2,%eax
+f01063fe:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0106404:	89 c2                	mov    %eax,%edx
+f0106406:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages_lowmem)
+f0106409:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010640e:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0106414:	0f 83 b3 01 00 00    	jae    f01065cd <env_alloc+0x230>
+	return (void *)(pa + KERNBASE);
+f010641a:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0106420:	89 93 30 01 00 00    	mov    %edx,0x130(%ebx)
+	e->env_pgdir = page2kva(p);
+f0106426:	b8 ec 0e 00 00       	mov    $0xeec,%eax
+		e->env_pgdir[i] = kern_pgdir[i];
+f010642b:	8b 15 7c 89 61 f0    	mov    0xf061897c,%edx
+f0106431:	8b 0c 02             	mov    (%edx,%eax,1),%ecx
+f0106434:	8b 93 30 01 00 00    	mov    0x130(%ebx),%edx
+f010643a:	89 0c 02             	mov    %ecx,(%edx,%eax,1)
+	for (i = PDX(UTOP); i < NPDENTRIES; i++)
+f010643d:	83 c0 04             	add    $0x4,%eax
+f0106440:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f0106445:	75 e4                	jne    f010642b <env_alloc+0x8e>
+	e->env_pgdir[PDX(UVPT)] = PADDR(e->env_pgdir) | PTE_P | PTE_U;
+f0106447:	8b 83 30 01 00 00    	mov    0x130(%ebx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f010644d:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0106452:	0f 86 87 01 00 00    	jbe    f01065df <env_alloc+0x242>
+	return (physaddr_t)kva - KERNBASE;
+f0106458:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f010645e:	83 ca 05             	or     $0x5,%edx
+f0106461:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+	env_lock(e);
+f0106467:	83 ec 0c             	sub    $0xc,%esp
+f010646a:	53                   	push   %ebx
+f010646b:	e8 ea fc ff ff       	call   f010615a <env_lock>
+	generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
+f0106470:	8b 43 4c             	mov    0x4c(%ebx),%eax
+f0106473:	05 00 20 00 00       	add    $0x2000,%eax
+	if (generation <= 0)	// Don't create a negative env_id.
+f0106478:	83 c4 0c             	add    $0xc,%esp
+		generation = 1 << ENVGENSHIFT;
+f010647b:	25 00 e0 ff ff       	and    $0xffffe000,%eax
+f0106480:	ba 00 20 00 00       	mov    $0x2000,%edx
+f0106485:	0f 4e c2             	cmovle %edx,%eax
+	e->env_id = generation | e->env_index;
+f0106488:	0b 43 48             	or     0x48(%ebx),%eax
+f010648b:	89 43 4c             	mov    %eax,0x4c(%ebx)
+	e->env_parent_id = parent_id;
+f010648e:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106491:	89 43 50             	mov    %eax,0x50(%ebx)
+	e->env_type = ENV_TYPE_USER;
+f0106494:	c7 43 54 00 00 00 00 	movl   $0x0,0x54(%ebx)
+	e->env_status = ENV_RUNNABLE;
+f010649b:	c7 43 58 02 00 00 00 	movl   $0x2,0x58(%ebx)
+	e->env_runs = 0;
+f01064a2:	c7 43 5c 00 00 00 00 	movl   $0x0,0x5c(%ebx)
+	e->env_priority = ENV_PRIO_HIGHEST;
+f01064a9:	c7 43 70 00 00 00 00 	movl   $0x0,0x70(%ebx)
+	e->env_prio_pinned = 0;
+f01064b0:	c6 43 74 00          	movb   $0x0,0x74(%ebx)
+	e->env_slice = SCHED_QUANTUM(ENV_PRIO_HIGHEST);
+f01064b4:	c7 43 78 01 00 00 00 	movl   $0x1,0x78(%ebx)
+	e->env_cpumask = ENV_CPUMASK_ALL;
+f01064bb:	c7 83 84 00 00 00 ff 	movl   $0xffffffff,0x84(%ebx)
+f01064c2:	ff ff ff 
+	memset(e->env_wait_hist, 0, sizeof(e->env_wait_hist));
+f01064c5:	6a 50                	push   $0x50
+f01064c7:	6a 00                	push   $0x0
+f01064c9:	8d 83 90 00 00 00    	lea    0x90(%ebx),%eax
+f01064cf:	50                   	push   %eax
+f01064d0:	e8 29 41 00 00       	call   f010a5fe <memset>
+	memset(e->env_run_hist, 0, sizeof(e->env_run_hist));
+f01064d5:	83 c4 0c             	add    $0xc,%esp
+f01064d8:	6a 50                	push   $0x50
+f01064da:	6a 00                	push   $0x0
+f01064dc:	8d 83 e0 00 00 00    	lea    0xe0(%ebx),%eax
+f01064e2:	50                   	push   %eax
+f01064e3:	e8 16 41 00 00       	call   f010a5fe <memset>
+	memset(e->env_regions, 0, sizeof(e->env_regions));
+f01064e8:	83 c4 0c             	add    $0xc,%esp
+f01064eb:	6a 60                	push   $0x60
+f01064ed:	6a 00                	push   $0x0
+f01064ef:	8d 83 34 01 00 00    	lea    0x134(%ebx),%eax
+f01064f5:	50                   	push   %eax
+f01064f6:	e8 03 41 00 00       	call   f010a5fe <memset>
+	memset(&e->env_tf, 0, sizeof(e->env_tf));
+f01064fb:	83 c4 0c             	add    $0xc,%esp
+f01064fe:	6a 44                	push   $0x44
+f0106500:	6a 00                	push   $0x0
+f0106502:	53                   	push   %ebx
+f0106503:	e8 f6 40 00 00       	call   f010a5fe <memset>
+	e->env_tf.tf_ds = GD_UD | 3;
+f0106508:	66 c7 43 24 23 00    	movw   $0x23,0x24(%ebx)
+	e->env_tf.tf_es = GD_UD | 3;
+f010650e:	66 c7 43 20 23 00    	movw   $0x23,0x20(%ebx)
+	e->env_tf.tf_ss = GD_UD | 3;
+f0106514:	66 c7 43 40 23 00    	movw   $0x23,0x40(%ebx)
+	e->env_tf.tf_esp = USTACKTOP;
+f010651a:	c7 43 3c 00 e0 bf ee 	movl   $0xeebfe000,0x3c(%ebx)
+	e->env_tf.tf_cs = GD_UT | 3;
+f0106521:	66 c7 43 34 1b 00    	movw   $0x1b,0x34(%ebx)
+	e->env_tf.tf_eflags = FL_IF;
+f0106527:	c7 43 38 00 02 00 00 	movl   $0x200,0x38(%ebx)
+	e->env_pgfault_upcall = 0;
+f010652e:	c7 83 94 01 00 00 00 	movl   $0x0,0x194(%ebx)
+f0106535:	00 00 00 
+	e->env_kernel_cow = 0;
+f0106538:	c6 83 98 01 00 00 00 	movb   $0x0,0x198(%ebx)
+	e->env_ipc_recving = 0;
+f010653f:	c6 83 99 01 00 00 00 	movb   $0x0,0x199(%ebx)
+	env_unlock(e);
+f0106546:	89 1c 24             	mov    %ebx,(%esp)
+f0106549:	e8 38 fc ff ff       	call   f0106186 <env_unlock>
+	*newenv_store = e;
+f010654e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106551:	89 18                	mov    %ebx,(%eax)
+	sched_enqueue(e);
+f0106553:	89 1c 24             	mov    %ebx,(%esp)
+f0106556:	e8 99 17 00 00       	call   f0107cf4 <sched_enqueue>
+	cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+f010655b:	8b 5b 4c             	mov    0x4c(%ebx),%ebx
+f010655e:	e8 e1 46 00 00       	call   f010ac44 <cpunum>
+f0106563:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106569:	83 c4 10             	add    $0x10,%esp
+f010656c:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106571:	83 b8 28 90 61 f0 00 	cmpl   $0x0,-0xf9e6fd8(%eax)
+f0106578:	74 14                	je     f010658e <env_alloc+0x1f1>
+f010657a:	e8 c5 46 00 00       	call   f010ac44 <cpunum>
+f010657f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106585:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f010658b:	8b 50 4c             	mov    0x4c(%eax),%edx
+f010658e:	83 ec 04             	sub    $0x4,%esp
+f0106591:	53                   	push   %ebx
+f0106592:	52                   	push   %edx
+f0106593:	68 72 dd 10 f0       	push   $0xf010dd72
+f0106598:	e8 5f 0a 00 00       	call   f0106ffc <cprintf>
+	return 0;
+f010659d:	83 c4 10             	add    $0x10,%esp
+f01065a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f01065a5:	89 d8                	mov    %ebx,%eax
+f01065a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01065aa:	c9                   	leave
+f01065ab:	c3                   	ret
+	if (!env_free_list && (r = env_grow()) < 0) {
+f01065ac:	e8 70 f9 ff ff       	call   f0105f21 <env_grow>
+f01065b1:	89 c3                	mov    %eax,%ebx
+f01065b3:	85 c0                	test   %eax,%eax
+f01065b5:	0f 89 03 fe ff ff    	jns    f01063be <env_alloc+0x21>
+		spin_unlock(&env_free_lock);
+f01065bb:	83 ec 0c             	sub    $0xc,%esp
+f01065be:	68 80 5c 61 f0       	push   $0xf0615c80
+f01065c3:	e8 27 4a 00 00       	call   f010afef <spin_unlock>
+		return r;
+f01065c8:	83 c4 10             	add    $0x10,%esp
+f01065cb:	eb d8                	jmp    f01065a5 <env_alloc+0x208>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01065cd:	52                   	push   %edx
+f01065ce:	68 1c c0 10 f0       	push   $0xf010c01c
+f01065d3:	6a 7d                	push   $0x7d
+f01065d5:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f01065da:	e8 b9 9a ff ff       	call   f0100098 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01065df:	50                   	push   %eax
+f01065e0:	68 e8 cc 10 f0       	push   $0xf010cce8
+f01065e5:	68 44 01 00 00       	push   $0x144
+f01065ea:	68 40 dd 10 f0       	push   $0xf010dd40
+f01065ef:	e8 a4 9a ff ff       	call   f0100098 <_panic>
+		spin_lock(&env_free_lock);
+f01065f4:	83 ec 0c             	sub    $0xc,%esp
+f01065f7:	68 80 5c 61 f0       	push   $0xf0615c80
+f01065fc:	e8 d2 48 00 00       	call   f010aed3 <spin_lock>
+		e->env_link = env_free_list;
+f0106601:	a1 e0 5c 61 f0       	mov    0xf0615ce0,%eax
+f0106606:	89 43 44             	mov    %eax,0x44(%ebx)
+		env_free_list = e;
+f0106609:	89 1d e0 5c 61 f0    	mov    %ebx,0xf0615ce0
+		spin_unlock(&env_free_lock);
+f010660f:	c7 04 24 80 5c 61 f0 	movl   $0xf0615c80,(%esp)
+f0106616:	e8 d4 49 00 00       	call   f010afef <spin_unlock>
+		return r;
+f010661b:	83 c4 10             	add    $0x10,%esp
+		return -E_NO_MEM;
+f010661e:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+		return r;
+f0106623:	eb 80                	jmp    f01065a5 <env_alloc+0x208>
+
+f0106625 <env_region_add>:
+//     PTE_SHARE or PTE_COW
+//   -E_NO_MEM, if e has NENVREGION regions already
+//
+int
+env_region_add(struct Env *e, uintptr_t start, uintptr_t end, int perm)
+{
+f0106625:	55                   	push   %ebp
+f0106626:	89 e5                	mov    %esp,%ebp
+f0106628:	57                   	push   %edi
+f0106629:	56                   	push   %esi
+f010662a:	53                   	push   %ebx
+f010662b:	83 ec 04             	sub    $0x4,%esp
+f010662e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0106631:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0106634:	8b 4d 14             	mov    0x14(%ebp),%ecx
+	struct EnvRegion *er, *free = NULL;
+
+	if (perm & (PTE_SHARE|PTE_COW))
+f0106637:	89 c8                	mov    %ecx,%eax
+f0106639:	25 00 0c 00 00       	and    $0xc00,%eax
+f010663e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0106641:	0f 85 89 00 00 00    	jne    f01066d0 <env_region_add+0xab>
+		return -E_INVAL;
+
+	for (er = e->env_regions; er < e->env_regions + NENVREGION; er++) {
+f0106647:	8d 93 34 01 00 00    	lea    0x134(%ebx),%edx
+f010664d:	81 c3 94 01 00 00    	add    $0x194,%ebx
+f0106653:	89 d0                	mov    %edx,%eax
+	struct EnvRegion *er, *free = NULL;
+f0106655:	be 00 00 00 00       	mov    $0x0,%esi
+f010665a:	89 d1                	mov    %edx,%ecx
+	for (er = e->env_regions; er < e->env_regions + NENVREGION; er++) {
+f010665c:	eb 08                	jmp    f0106666 <env_region_add+0x41>
+		if (!er->er_end) {
+			free = free ? free : er;
+f010665e:	85 f6                	test   %esi,%esi
+f0106660:	0f 44 f0             	cmove  %eax,%esi
+	for (er = e->env_regions; er < e->env_regions + NENVREGION; er++) {
+f0106663:	83 c0 0c             	add    $0xc,%eax
+f0106666:	39 d8                	cmp    %ebx,%eax
+f0106668:	74 1b                	je     f0106685 <env_region_add+0x60>
+		if (!er->er_end) {
+f010666a:	8b 50 04             	mov    0x4(%eax),%edx
+f010666d:	85 d2                	test   %edx,%edx
+f010666f:	74 ed                	je     f010665e <env_region_add+0x39>
+			continue;
+		}
+		if (start < er->er_end && er->er_start < end)
+f0106671:	39 d7                	cmp    %edx,%edi
+f0106673:	73 ee                	jae    f0106663 <env_region_add+0x3e>
+f0106675:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106678:	39 10                	cmp    %edx,(%eax)
+f010667a:	73 e7                	jae    f0106663 <env_region_add+0x3e>
+			return -E_INVAL;
+f010667c:	c7 45 f0 fd ff ff ff 	movl   $0xfffffffd,-0x10(%ebp)
+f0106683:	eb 40                	jmp    f01066c5 <env_region_add+0xa0>
+f0106685:	89 ca                	mov    %ecx,%edx
+f0106687:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f010668a:	eb 0b                	jmp    f0106697 <env_region_add+0x72>
+
+	for (er = e->env_regions; er < e->env_regions + NENVREGION; er++) {
+		if (!er->er_end || er->er_perm != perm)
+			continue;
+		if (er->er_end == start) {
+			er->er_end = end;
+f010668c:	8b 45 10             	mov    0x10(%ebp),%eax
+f010668f:	89 42 04             	mov    %eax,0x4(%edx)
+			return 0;
+f0106692:	eb 31                	jmp    f01066c5 <env_region_add+0xa0>
+	for (er = e->env_regions; er < e->env_regions + NENVREGION; er++) {
+f0106694:	83 c2 0c             	add    $0xc,%edx
+f0106697:	39 da                	cmp    %ebx,%edx
+f0106699:	73 1b                	jae    f01066b6 <env_region_add+0x91>
+		if (!er->er_end || er->er_perm != perm)
+f010669b:	8b 42 04             	mov    0x4(%edx),%eax
+f010669e:	85 c0                	test   %eax,%eax
+f01066a0:	74 f2                	je     f0106694 <env_region_add+0x6f>
+f01066a2:	39 4a 08             	cmp    %ecx,0x8(%edx)
+f01066a5:	75 ed                	jne    f0106694 <env_region_add+0x6f>
+		if (er->er_end == start) {
+f01066a7:	39 f8                	cmp    %edi,%eax
+f01066a9:	74 e1                	je     f010668c <env_region_add+0x67>
+		}
+		if (er->er_start == end) {
+f01066ab:	8b 45 10             	mov    0x10(%ebp),%eax
+f01066ae:	39 02                	cmp    %eax,(%edx)
+f01066b0:	75 e2                	jne    f0106694 <env_region_add+0x6f>
+			er->er_start = start;
+f01066b2:	89 3a                	mov    %edi,(%edx)
+			return 0;
+f01066b4:	eb 0f                	jmp    f01066c5 <env_region_add+0xa0>
+		}
+	}
+
+	if (!free)
+f01066b6:	85 f6                	test   %esi,%esi
+f01066b8:	74 1f                	je     f01066d9 <env_region_add+0xb4>
+		return -E_NO_MEM;
+	free->er_start = start;
+f01066ba:	89 3e                	mov    %edi,(%esi)
+	free->er_end = end;
+f01066bc:	8b 45 10             	mov    0x10(%ebp),%eax
+f01066bf:	89 46 04             	mov    %eax,0x4(%esi)
+	free->er_perm = perm;
+f01066c2:	89 4e 08             	mov    %ecx,0x8(%esi)
+	return 0;
+}
+f01066c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+f01066c8:	83 c4 04             	add    $0x4,%esp
+f01066cb:	5b                   	pop    %ebx
+f01066cc:	5e                   	pop    %esi
+f01066cd:	5f                   	pop    %edi
+f01066ce:	5d                   	pop    %ebp
+f01066cf:	c3                   	ret
+		return -E_INVAL;
+f01066d0:	c7 45 f0 fd ff ff ff 	movl   $0xfffffffd,-0x10(%ebp)
+f01066d7:	eb ec                	jmp    f01066c5 <env_region_add+0xa0>
+		return -E_NO_MEM;
+f01066d9:	c7 45 f0 fc ff ff ff 	movl   $0xfffffffc,-0x10(%ebp)
+f01066e0:	eb e3                	jmp    f01066c5 <env_region_add+0xa0>
+
+f01066e2 <env_region_fault>:
+//   -E_FAULT, if 'va' is not in a region, or is mapped already
+//   -E_NO_MEM, if there's no memory for the page
+//
+int
+env_region_fault(struct Env *e, uintptr_t va, bool write)
+{
+f01066e2:	55                   	push   %ebp
+f01066e3:	89 e5                	mov    %esp,%ebp
+f01066e5:	57                   	push   %edi
+f01066e6:	56                   	push   %esi
+f01066e7:	53                   	push   %ebx
+f01066e8:	83 ec 1c             	sub    $0x1c,%esp
+f01066eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+f01066ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+f01066f1:	8b 45 10             	mov    0x10(%ebp),%eax
+f01066f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	struct EnvRegion *er;
+	struct PageInfo *p;
+	pte_t *pte;
+	int r, perm;
+
+	for (er = e->env_regions; er < e->env_regions + NENVREGION; er++)
+f01066f7:	8d 9f 34 01 00 00    	lea    0x134(%edi),%ebx
+f01066fd:	8d 87 94 01 00 00    	lea    0x194(%edi),%eax
+f0106703:	eb 03                	jmp    f0106708 <env_region_fault+0x26>
+f0106705:	83 c3 0c             	add    $0xc,%ebx
+f0106708:	39 c3                	cmp    %eax,%ebx
+f010670a:	74 72                	je     f010677e <env_region_fault+0x9c>
+		if (er->er_start <= va && va < er->er_end)
+f010670c:	3b 33                	cmp    (%ebx),%esi
+f010670e:	72 f5                	jb     f0106705 <env_region_fault+0x23>
+f0106710:	3b 73 04             	cmp    0x4(%ebx),%esi
+f0106713:	73 f0                	jae    f0106705 <env_region_fault+0x23>
+			break;
+	if (er == e->env_regions + NENVREGION)
+		return -E_FAULT;
+
+	pte = pgdir_walk(e->env_pgdir, (void *) va, 0);
+f0106715:	83 ec 04             	sub    $0x4,%esp
+f0106718:	6a 00                	push   $0x0
+f010671a:	56                   	push   %esi
+f010671b:	ff b7 30 01 00 00    	push   0x130(%edi)
+f0106721:	e8 3a be ff ff       	call   f0102560 <pgdir_walk>
+	if (pte && (*pte & PTE_P))
+f0106726:	83 c4 10             	add    $0x10,%esp
+f0106729:	85 c0                	test   %eax,%eax
+f010672b:	74 09                	je     f0106736 <env_region_fault+0x54>
+f010672d:	f6 00 01             	testb  $0x1,(%eax)
+f0106730:	0f 85 97 00 00 00    	jne    f01067cd <env_region_fault+0xeb>
+		return -E_FAULT;
+
+	// A PTE_SHARE page must be a real page of its own from the
+	// start: a shared copy-on-write zero_page would be split on the
+	// first write.  (env_region_add refuses such regions anyway.)
+	if (!write && !(er->er_perm & PTE_SHARE)) {
+f0106736:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+f010673a:	75 08                	jne    f0106744 <env_region_fault+0x62>
+f010673c:	8b 43 08             	mov    0x8(%ebx),%eax
+f010673f:	f6 c4 04             	test   $0x4,%ah
+f0106742:	74 49                	je     f010678d <env_region_fault+0xab>
+		if (perm & PTE_W)
+			perm = (perm & ~PTE_W) | PTE_COW;
+		return page_insert(e->env_pgdir, zero_page, (void *) ROUNDDOWN(va, PGSIZE), perm);
+	}
+
+	p = page_alloc(ALLOC_ZERO|ALLOC_HIGH);
+f0106744:	83 ec 0c             	sub    $0xc,%esp
+f0106747:	6a 03                	push   $0x3
+f0106749:	e8 7c bb ff ff       	call   f01022ca <page_alloc>
+f010674e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!p)
+f0106751:	83 c4 10             	add    $0x10,%esp
+f0106754:	85 c0                	test   %eax,%eax
+f0106756:	74 7c                	je     f01067d4 <env_region_fault+0xf2>
+		return -E_NO_MEM;
+	if ((r = page_insert(e->env_pgdir, p, (void *) ROUNDDOWN(va, PGSIZE), er->er_perm)) < 0) {
+f0106758:	ff 73 08             	push   0x8(%ebx)
+f010675b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0106761:	56                   	push   %esi
+f0106762:	50                   	push   %eax
+f0106763:	ff b7 30 01 00 00    	push   0x130(%edi)
+f0106769:	e8 da c1 ff ff       	call   f0102948 <page_insert>
+f010676e:	89 c3                	mov    %eax,%ebx
+f0106770:	83 c4 10             	add    $0x10,%esp
+f0106773:	85 c0                	test   %eax,%eax
+f0106775:	78 46                	js     f01067bd <env_region_fault+0xdb>
+		page_free(p);
+		return r;
+	}
+	return 0;
+f0106777:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010677c:	eb 05                	jmp    f0106783 <env_region_fault+0xa1>
+		return -E_FAULT;
+f010677e:	bb fa ff ff ff       	mov    $0xfffffffa,%ebx
+}
+f0106783:	89 d8                	mov    %ebx,%eax
+f0106785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106788:	5b                   	pop    %ebx
+f0106789:	5e                   	pop    %esi
+f010678a:	5f                   	pop    %edi
+f010678b:	5d                   	pop    %ebp
+f010678c:	c3                   	ret
+			perm = (perm & ~PTE_W) | PTE_COW;
+f010678d:	89 c2                	mov    %eax,%edx
+f010678f:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+f0106795:	80 ce 08             	or     $0x8,%dh
+f0106798:	a8 02                	test   $0x2,%al
+f010679a:	0f 45 c2             	cmovne %edx,%eax
+		return page_insert(e->env_pgdir, zero_page, (void *) ROUNDDOWN(va, PGSIZE), perm);
+f010679d:	50                   	push   %eax
+f010679e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f01067a4:	56                   	push   %esi
+f01067a5:	ff 35 74 89 61 f0    	push   0xf0618974
+f01067ab:	ff b7 30 01 00 00    	push   0x130(%edi)
+f01067b1:	e8 92 c1 ff ff       	call   f0102948 <page_insert>
+f01067b6:	89 c3                	mov    %eax,%ebx
+f01067b8:	83 c4 10             	add    $0x10,%esp
+f01067bb:	eb c6                	jmp    f0106783 <env_region_fault+0xa1>
+		page_free(p);
+f01067bd:	83 ec 0c             	sub    $0xc,%esp
+f01067c0:	ff 75 e4             	push   -0x1c(%ebp)
+f01067c3:	e8 e9 b6 ff ff       	call   f0101eb1 <page_free>
+		return r;
+f01067c8:	83 c4 10             	add    $0x10,%esp
+f01067cb:	eb b6                	jmp    f0106783 <env_region_fault+0xa1>
+		return -E_FAULT;
+f01067cd:	bb fa ff ff ff       	mov    $0xfffffffa,%ebx
+f01067d2:	eb af                	jmp    f0106783 <env_region_fault+0xa1>
+		return -E_NO_MEM;
+f01067d4:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f01067d9:	eb a8                	jmp    f0106783 <env_region_fault+0xa1>
+
+f01067db <env_create>:
+// before running the first user-mode environment.
+// The new env's parent ID is set to 0.
+//
+void
+env_create(uint8_t *binary, enum EnvType type)
+{
+f01067db:	55                   	push   %ebp
+f01067dc:	89 e5                	mov    %esp,%ebp
+f01067de:	57                   	push   %edi
+f01067df:	56                   	push   %esi
+f01067e0:	53                   	push   %ebx
+f01067e1:	83 ec 34             	sub    $0x34,%esp
+f01067e4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	// LAB 3: Your code here.
+	struct Env *e;
+	int r;
+
+	if ((r = env_alloc(&e, 0)) < 0)
+f01067e7:	6a 00                	push   $0x0
+f01067e9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01067ec:	50                   	push   %eax
+f01067ed:	e8 ab fb ff ff       	call   f010639d <env_alloc>
+f01067f2:	83 c4 10             	add    $0x10,%esp
+f01067f5:	85 c0                	test   %eax,%eax
+f01067f7:	78 42                	js     f010683b <env_create+0x60>
+		panic("failed to alloc an env %e", r);
+
+	load_icode(e, binary);
+f01067f9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01067fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	if (elf->e_magic != ELF_MAGIC)
+f01067ff:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106802:	81 38 7f 45 4c 46    	cmpl   $0x464c457f,(%eax)
+f0106808:	75 46                	jne    f0106850 <env_create+0x75>
+	lcr3(PADDR(e->env_pgdir));
+f010680a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010680d:	8b 80 30 01 00 00    	mov    0x130(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0106813:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0106818:	76 4d                	jbe    f0106867 <env_create+0x8c>
+	return (physaddr_t)kva - KERNBASE;
+f010681a:	05 00 00 00 10       	add    $0x10000000,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f010681f:	0f 22 d8             	mov    %eax,%cr3
+	ph = (struct Proghdr *) ((uint8_t *) elf + elf->e_phoff);
+f0106822:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106825:	89 c3                	mov    %eax,%ebx
+f0106827:	03 58 1c             	add    0x1c(%eax),%ebx
+	eph = (struct Proghdr *) (ph + elf->e_phnum);
+f010682a:	0f b7 40 2c          	movzwl 0x2c(%eax),%eax
+f010682e:	c1 e0 05             	shl    $0x5,%eax
+f0106831:	01 d8                	add    %ebx,%eax
+f0106833:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	for (; ph < eph; ph++) {
+f0106836:	89 7d 0c             	mov    %edi,0xc(%ebp)
+f0106839:	eb 44                	jmp    f010687f <env_create+0xa4>
+		panic("failed to alloc an env %e", r);
+f010683b:	50                   	push   %eax
+f010683c:	68 87 dd 10 f0       	push   $0xf010dd87
+f0106841:	68 a5 02 00 00       	push   $0x2a5
+f0106846:	68 40 dd 10 f0       	push   $0xf010dd40
+f010684b:	e8 48 98 ff ff       	call   f0100098 <_panic>
+		panic("tried to load an invalid elf");
+f0106850:	83 ec 04             	sub    $0x4,%esp
+f0106853:	68 a1 dd 10 f0       	push   $0xf010dda1
+f0106858:	68 0d 02 00 00       	push   $0x20d
+f010685d:	68 40 dd 10 f0       	push   $0xf010dd40
+f0106862:	e8 31 98 ff ff       	call   f0100098 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0106867:	50                   	push   %eax
+f0106868:	68 e8 cc 10 f0       	push   $0xf010cce8
+f010686d:	68 10 02 00 00       	push   $0x210
+f0106872:	68 40 dd 10 f0       	push   $0xf010dd40
+f0106877:	e8 1c 98 ff ff       	call   f0100098 <_panic>
+	for (; ph < eph; ph++) {
+f010687c:	83 c3 20             	add    $0x20,%ebx
+f010687f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0106882:	39 c3                	cmp    %eax,%ebx
+f0106884:	0f 83 86 00 00 00    	jae    f0106910 <env_create+0x135>
+		if (ph->p_type != ELF_PROG_LOAD)
+f010688a:	83 3b 01             	cmpl   $0x1,(%ebx)
+f010688d:	75 ed                	jne    f010687c <env_create+0xa1>
+		va = ph->p_va + ph->p_filesz;
+f010688f:	8b 53 08             	mov    0x8(%ebx),%edx
+f0106892:	8b 4b 10             	mov    0x10(%ebx),%ecx
+f0106895:	8d 3c 0a             	lea    (%edx,%ecx,1),%edi
+		region_alloc(e, (void *) ph->p_va, ph->p_filesz);
+f0106898:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010689b:	e8 08 f8 ff ff       	call   f01060a8 <region_alloc>
+		memcpy((void *) ph->p_va, binary + ph->p_offset, ph->p_filesz);
+f01068a0:	83 ec 04             	sub    $0x4,%esp
+f01068a3:	ff 73 10             	push   0x10(%ebx)
+f01068a6:	8b 45 08             	mov    0x8(%ebp),%eax
+f01068a9:	03 43 04             	add    0x4(%ebx),%eax
+f01068ac:	50                   	push   %eax
+f01068ad:	ff 73 08             	push   0x8(%ebx)
+f01068b0:	e8 e0 3d 00 00       	call   f010a695 <memcpy>
+		memset((void *) va, 0, ROUNDUP(va, PGSIZE) - va);
+f01068b5:	8d b7 ff 0f 00 00    	lea    0xfff(%edi),%esi
+f01068bb:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f01068c1:	83 c4 0c             	add    $0xc,%esp
+f01068c4:	89 f0                	mov    %esi,%eax
+f01068c6:	29 f8                	sub    %edi,%eax
+f01068c8:	50                   	push   %eax
+f01068c9:	6a 00                	push   $0x0
+f01068cb:	57                   	push   %edi
+f01068cc:	e8 2d 3d 00 00       	call   f010a5fe <memset>
+		if (ROUNDUP(va, PGSIZE) < ph->p_va + ph->p_memsz &&
+f01068d1:	8b 43 14             	mov    0x14(%ebx),%eax
+f01068d4:	03 43 08             	add    0x8(%ebx),%eax
+f01068d7:	83 c4 10             	add    $0x10,%esp
+f01068da:	39 c6                	cmp    %eax,%esi
+f01068dc:	73 9e                	jae    f010687c <env_create+0xa1>
+		    (r = env_region_add(e, ROUNDUP(va, PGSIZE), ROUNDUP(ph->p_va + ph->p_memsz, PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+f01068de:	6a 07                	push   $0x7
+f01068e0:	05 ff 0f 00 00       	add    $0xfff,%eax
+f01068e5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f01068ea:	50                   	push   %eax
+f01068eb:	56                   	push   %esi
+f01068ec:	ff 75 d0             	push   -0x30(%ebp)
+f01068ef:	e8 31 fd ff ff       	call   f0106625 <env_region_add>
+		if (ROUNDUP(va, PGSIZE) < ph->p_va + ph->p_memsz &&
+f01068f4:	83 c4 10             	add    $0x10,%esp
+f01068f7:	85 c0                	test   %eax,%eax
+f01068f9:	79 81                	jns    f010687c <env_create+0xa1>
+			panic("load_icode: demand-zero region for segment: %e", r);
+f01068fb:	50                   	push   %eax
+f01068fc:	68 08 dd 10 f0       	push   $0xf010dd08
+f0106901:	68 20 02 00 00       	push   $0x220
+f0106906:	68 40 dd 10 f0       	push   $0xf010dd40
+f010690b:	e8 88 97 ff ff       	call   f0100098 <_panic>
+	e->env_tf.tf_eip = elf->e_entry;
+f0106910:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0106913:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106916:	8b 40 18             	mov    0x18(%eax),%eax
+f0106919:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f010691c:	89 46 30             	mov    %eax,0x30(%esi)
+	region_alloc(e, (void *) (USTACKTOP - PGSIZE), PGSIZE);
+f010691f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+f0106924:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+f0106929:	89 f0                	mov    %esi,%eax
+f010692b:	e8 78 f7 ff ff       	call   f01060a8 <region_alloc>
+	lcr3(PADDR(kern_pgdir));
+f0106930:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0106935:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010693a:	76 1b                	jbe    f0106957 <env_create+0x17c>
+	return (physaddr_t)kva - KERNBASE;
+f010693c:	05 00 00 00 10       	add    $0x10000000,%eax
+f0106941:	0f 22 d8             	mov    %eax,%cr3
+
+	e->env_type = type;
+f0106944:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0106947:	89 78 54             	mov    %edi,0x54(%eax)
+
+	// If this is the file server (type == ENV_TYPE_FS) give it I/O privileges.
+	// LAB 5: Your code here.
+	if (type == ENV_TYPE_FS)
+f010694a:	83 ff 01             	cmp    $0x1,%edi
+f010694d:	74 1d                	je     f010696c <env_create+0x191>
+		e->env_tf.tf_eflags |= FL_IOPL_MASK;
+}
+f010694f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106952:	5b                   	pop    %ebx
+f0106953:	5e                   	pop    %esi
+f0106954:	5f                   	pop    %edi
+f0106955:	5d                   	pop    %ebp
+f0106956:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0106957:	50                   	push   %eax
+f0106958:	68 e8 cc 10 f0       	push   $0xf010cce8
+f010695d:	68 2c 02 00 00       	push   $0x22c
+f0106962:	68 40 dd 10 f0       	push   $0xf010dd40
+f0106967:	e8 2c 97 ff ff       	call   f0100098 <_panic>
+		e->env_tf.tf_eflags |= FL_IOPL_MASK;
+f010696c:	81 48 38 00 30 00 00 	orl    $0x3000,0x38(%eax)
+}
+f0106973:	eb da                	jmp    f010694f <env_create+0x174>
+
+f0106975 <env_free>:
+//
+// Frees env e and all memory it uses.
+//
+void
+env_free(struct Env *e)
+{
+f0106975:	55                   	push   %ebp
+f0106976:	89 e5                	mov    %esp,%ebp
+f0106978:	57                   	push   %edi
+f0106979:	56                   	push   %esi
+f010697a:	53                   	push   %ebx
+f010697b:	83 ec 1c             	sub    $0x1c,%esp
+f010697e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	physaddr_t pa;
+
+	// If freeing the current environment, switch to kern_pgdir
+	// before freeing the page directory, just in case the page
+	// gets reused.
+	if (e == curenv)
+f0106981:	e8 be 42 00 00       	call   f010ac44 <cpunum>
+f0106986:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010698c:	39 b8 28 90 61 f0    	cmp    %edi,-0xf9e6fd8(%eax)
+f0106992:	74 59                	je     f01069ed <env_free+0x78>
+		lcr3(PADDR(kern_pgdir));
+
+	// Note the environment's demise.
+	cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+f0106994:	8b 5f 4c             	mov    0x4c(%edi),%ebx
+f0106997:	e8 a8 42 00 00       	call   f010ac44 <cpunum>
+f010699c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01069a2:	ba 00 00 00 00       	mov    $0x0,%edx
+f01069a7:	83 b8 28 90 61 f0 00 	cmpl   $0x0,-0xf9e6fd8(%eax)
+f01069ae:	74 14                	je     f01069c4 <env_free+0x4f>
+f01069b0:	e8 8f 42 00 00       	call   f010ac44 <cpunum>
+f01069b5:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01069bb:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01069c1:	8b 50 4c             	mov    0x4c(%eax),%edx
+f01069c4:	83 ec 04             	sub    $0x4,%esp
+f01069c7:	53                   	push   %ebx
+f01069c8:	52                   	push   %edx
+f01069c9:	68 be dd 10 f0       	push   $0xf010ddbe
+f01069ce:	e8 29 06 00 00       	call   f0106ffc <cprintf>
+
+	// Flush all mapped pages in the user portion of the address space
+	static_assert(UTOP % PTSIZE == 0);
+	env_lock(e);
+f01069d3:	89 3c 24             	mov    %edi,(%esp)
+f01069d6:	e8 7f f7 ff ff       	call   f010615a <env_lock>
+f01069db:	83 c4 10             	add    $0x10,%esp
+f01069de:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f01069e5:	89 7d 08             	mov    %edi,0x8(%ebp)
+f01069e8:	e9 dc 00 00 00       	jmp    f0106ac9 <env_free+0x154>
+		lcr3(PADDR(kern_pgdir));
+f01069ed:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01069f2:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01069f7:	76 0a                	jbe    f0106a03 <env_free+0x8e>
+	return (physaddr_t)kva - KERNBASE;
+f01069f9:	05 00 00 00 10       	add    $0x10000000,%eax
+f01069fe:	0f 22 d8             	mov    %eax,%cr3
+}
+f0106a01:	eb 91                	jmp    f0106994 <env_free+0x1f>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0106a03:	50                   	push   %eax
+f0106a04:	68 e8 cc 10 f0       	push   $0xf010cce8
+f0106a09:	68 bf 02 00 00       	push   $0x2bf
+f0106a0e:	68 40 dd 10 f0       	push   $0xf010dd40
+f0106a13:	e8 80 96 ff ff       	call   f0100098 <_panic>
+			page_remove(e->env_pgdir, PGADDR(pdeno, 0, 0));
+			continue;
+		}
+
+		// find the pa and va of the page table
+		pa = PTE_ADDR(e->env_pgdir[pdeno]);
+f0106a18:	89 c6                	mov    %eax,%esi
+f0106a1a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages_lowmem)
+f0106a20:	c1 e8 0c             	shr    $0xc,%eax
+f0106a23:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f0106a29:	73 17                	jae    f0106a42 <env_free+0xcd>
+	return (void *)(pa + KERNBASE);
+f0106a2b:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+		pt = (pte_t*) KADDR(pa);
+
+		// unmap all PTEs in this page table
+		for (pteno = 0; pteno <= PTX(~0); pteno++) {
+f0106a31:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0106a34:	c1 e7 14             	shl    $0x14,%edi
+f0106a37:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0106a3a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0106a3d:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0106a40:	eb 26                	jmp    f0106a68 <env_free+0xf3>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0106a42:	56                   	push   %esi
+f0106a43:	68 1c c0 10 f0       	push   $0xf010c01c
+f0106a48:	68 d5 02 00 00       	push   $0x2d5
+f0106a4d:	68 40 dd 10 f0       	push   $0xf010dd40
+f0106a52:	e8 41 96 ff ff       	call   f0100098 <_panic>
+f0106a57:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0106a5d:	83 c6 04             	add    $0x4,%esi
+f0106a60:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+f0106a66:	74 1e                	je     f0106a86 <env_free+0x111>
+			if (pt[pteno] & PTE_P)
+f0106a68:	f6 06 01             	testb  $0x1,(%esi)
+f0106a6b:	74 ea                	je     f0106a57 <env_free+0xe2>
+				page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0));
+f0106a6d:	83 ec 08             	sub    $0x8,%esp
+f0106a70:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106a73:	09 d8                	or     %ebx,%eax
+f0106a75:	50                   	push   %eax
+f0106a76:	ff b7 30 01 00 00    	push   0x130(%edi)
+f0106a7c:	e8 12 be ff ff       	call   f0102893 <page_remove>
+f0106a81:	83 c4 10             	add    $0x10,%esp
+f0106a84:	eb d1                	jmp    f0106a57 <env_free+0xe2>
+		}
+
+		// free the page table itself
+		e->env_pgdir[pdeno] = 0;
+f0106a86:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0106a89:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106a8c:	8b 80 30 01 00 00    	mov    0x130(%eax),%eax
+f0106a92:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0106a95:	c7 04 08 00 00 00 00 	movl   $0x0,(%eax,%ecx,1)
+	if (PGNUM(pa) >= npages)
+f0106a9c:	3b 15 78 89 61 f0    	cmp    0xf0618978,%edx
+f0106aa2:	73 5a                	jae    f0106afe <env_free+0x189>
+		page_decref(pa2page(pa));
+f0106aa4:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0106aa7:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f0106aaa:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0106aaf:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0106ab2:	50                   	push   %eax
+f0106ab3:	e8 4a b6 ff ff       	call   f0102102 <page_decref>
+f0106ab8:	83 c4 10             	add    $0x10,%esp
+	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+f0106abb:	83 45 e0 04          	addl   $0x4,-0x20(%ebp)
+f0106abf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106ac2:	3d ec 0e 00 00       	cmp    $0xeec,%eax
+f0106ac7:	74 49                	je     f0106b12 <env_free+0x19d>
+		if (!(e->env_pgdir[pdeno] & PTE_P))
+f0106ac9:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106acc:	8b 90 30 01 00 00    	mov    0x130(%eax),%edx
+f0106ad2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0106ad5:	8b 04 0a             	mov    (%edx,%ecx,1),%eax
+f0106ad8:	a8 01                	test   $0x1,%al
+f0106ada:	74 df                	je     f0106abb <env_free+0x146>
+		if (e->env_pgdir[pdeno] & PTE_PS) {
+f0106adc:	89 c3                	mov    %eax,%ebx
+f0106ade:	81 e3 80 00 00 00    	and    $0x80,%ebx
+f0106ae4:	0f 84 2e ff ff ff    	je     f0106a18 <env_free+0xa3>
+			page_remove(e->env_pgdir, PGADDR(pdeno, 0, 0));
+f0106aea:	83 ec 08             	sub    $0x8,%esp
+f0106aed:	89 c8                	mov    %ecx,%eax
+f0106aef:	c1 e0 14             	shl    $0x14,%eax
+f0106af2:	50                   	push   %eax
+f0106af3:	52                   	push   %edx
+f0106af4:	e8 9a bd ff ff       	call   f0102893 <page_remove>
+			continue;
+f0106af9:	83 c4 10             	add    $0x10,%esp
+f0106afc:	eb bd                	jmp    f0106abb <env_free+0x146>
+		panic("pa2page called with invalid pa");
+f0106afe:	83 ec 04             	sub    $0x4,%esp
+f0106b01:	68 e8 ce 10 f0       	push   $0xf010cee8
+f0106b06:	6a 76                	push   $0x76
+f0106b08:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0106b0d:	e8 86 95 ff ff       	call   f0100098 <_panic>
+	}
+
+	// free the page directory
+	pa = PADDR(e->env_pgdir);
+f0106b12:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0106b15:	8b 87 30 01 00 00    	mov    0x130(%edi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0106b1b:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0106b20:	76 76                	jbe    f0106b98 <env_free+0x223>
+	e->env_pgdir = 0;
+f0106b22:	c7 87 30 01 00 00 00 	movl   $0x0,0x130(%edi)
+f0106b29:	00 00 00 
+	return (physaddr_t)kva - KERNBASE;
+f0106b2c:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0106b31:	c1 e8 0c             	shr    $0xc,%eax
+f0106b34:	3b 05 78 89 61 f0    	cmp    0xf0618978,%eax
+f0106b3a:	73 71                	jae    f0106bad <env_free+0x238>
+	page_decref(pa2page(pa));
+f0106b3c:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0106b3f:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106b42:	a1 80 89 61 f0       	mov    0xf0618980,%eax
+f0106b47:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0106b4a:	50                   	push   %eax
+f0106b4b:	e8 b2 b5 ff ff       	call   f0102102 <page_decref>
+
+	// return the environment to the free list
+	sched_dequeue(e);
+f0106b50:	89 3c 24             	mov    %edi,(%esp)
+f0106b53:	e8 30 13 00 00       	call   f0107e88 <sched_dequeue>
+	e->env_status = ENV_FREE;
+f0106b58:	c7 47 58 00 00 00 00 	movl   $0x0,0x58(%edi)
+	env_unlock(e);
+f0106b5f:	89 3c 24             	mov    %edi,(%esp)
+f0106b62:	e8 1f f6 ff ff       	call   f0106186 <env_unlock>
+
+	spin_lock(&env_free_lock);
+f0106b67:	c7 04 24 80 5c 61 f0 	movl   $0xf0615c80,(%esp)
+f0106b6e:	e8 60 43 00 00       	call   f010aed3 <spin_lock>
+	e->env_link = env_free_list;
+f0106b73:	a1 e0 5c 61 f0       	mov    0xf0615ce0,%eax
+f0106b78:	89 47 44             	mov    %eax,0x44(%edi)
+	env_free_list = e;
+f0106b7b:	89 3d e0 5c 61 f0    	mov    %edi,0xf0615ce0
+	spin_unlock(&env_free_lock);
+f0106b81:	c7 04 24 80 5c 61 f0 	movl   $0xf0615c80,(%esp)
+f0106b88:	e8 62 44 00 00       	call   f010afef <spin_unlock>
+}
+f0106b8d:	83 c4 10             	add    $0x10,%esp
+f0106b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106b93:	5b                   	pop    %ebx
+f0106b94:	5e                   	pop    %esi
+f0106b95:	5f                   	pop    %edi
+f0106b96:	5d                   	pop    %ebp
+f0106b97:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0106b98:	50                   	push   %eax
+f0106b99:	68 e8 cc 10 f0       	push   $0xf010cce8
+f0106b9e:	68 e3 02 00 00       	push   $0x2e3
+f0106ba3:	68 40 dd 10 f0       	push   $0xf010dd40
+f0106ba8:	e8 eb 94 ff ff       	call   f0100098 <_panic>
+		panic("pa2page called with invalid pa");
+f0106bad:	83 ec 04             	sub    $0x4,%esp
+f0106bb0:	68 e8 ce 10 f0       	push   $0xf010cee8
+f0106bb5:	6a 76                	push   $0x76
+f0106bb7:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f0106bbc:	e8 d7 94 ff ff       	call   f0100098 <_panic>
+
+f0106bc1 <env_destroy>:
+// If e was the current env, then runs a new environment (and does not return
+// to the caller).
+//
+void
+env_destroy(struct Env *e)
+{
+f0106bc1:	55                   	push   %ebp
+f0106bc2:	89 e5                	mov    %esp,%ebp
+f0106bc4:	53                   	push   %ebx
+f0106bc5:	83 ec 04             	sub    $0x4,%esp
+f0106bc8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	// If e is currently running on other CPUs, we change its state to
+	// ENV_DYING. A zombie environment will be freed the next time
+	// it traps to the kernel.
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f0106bcb:	83 7b 58 03          	cmpl   $0x3,0x58(%ebx)
+f0106bcf:	74 24                	je     f0106bf5 <env_destroy+0x34>
+		e->env_status = ENV_DYING;
+		return;
+	}
+
+	env_free(e);
+f0106bd1:	83 ec 0c             	sub    $0xc,%esp
+f0106bd4:	53                   	push   %ebx
+f0106bd5:	e8 9b fd ff ff       	call   f0106975 <env_free>
+
+	if (curenv == e) {
+f0106bda:	e8 65 40 00 00       	call   f010ac44 <cpunum>
+f0106bdf:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106be5:	83 c4 10             	add    $0x10,%esp
+f0106be8:	39 98 28 90 61 f0    	cmp    %ebx,-0xf9e6fd8(%eax)
+f0106bee:	74 21                	je     f0106c11 <env_destroy+0x50>
+		sched_account_run(e);
+		curenv = NULL;
+		sched_yield();
+	}
+}
+f0106bf0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0106bf3:	c9                   	leave
+f0106bf4:	c3                   	ret
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f0106bf5:	e8 4a 40 00 00       	call   f010ac44 <cpunum>
+f0106bfa:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106c00:	39 98 28 90 61 f0    	cmp    %ebx,-0xf9e6fd8(%eax)
+f0106c06:	74 c9                	je     f0106bd1 <env_destroy+0x10>
+		e->env_status = ENV_DYING;
+f0106c08:	c7 43 58 01 00 00 00 	movl   $0x1,0x58(%ebx)
+		return;
+f0106c0f:	eb df                	jmp    f0106bf0 <env_destroy+0x2f>
+		sched_account_run(e);
+f0106c11:	83 ec 0c             	sub    $0xc,%esp
+f0106c14:	53                   	push   %ebx
+f0106c15:	e8 bc 13 00 00       	call   f0107fd6 <sched_account_run>
+		curenv = NULL;
+f0106c1a:	e8 25 40 00 00       	call   f010ac44 <cpunum>
+f0106c1f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106c25:	c7 80 28 90 61 f0 00 	movl   $0x0,-0xf9e6fd8(%eax)
+f0106c2c:	00 00 00 
+		sched_yield();
+f0106c2f:	e8 6a 16 00 00       	call   f010829e <sched_yield>
+
+f0106c34 <env_pop_tf>:
+//
+// This function does not return.
+//
+void
+env_pop_tf(struct Trapframe *tf)
+{
+f0106c34:	55                   	push   %ebp
+f0106c35:	89 e5                	mov    %esp,%ebp
+f0106c37:	53                   	push   %ebx
+f0106c38:	83 ec 04             	sub    $0x4,%esp
+	// Record the CPU we are running on for user-space debugging
+	curenv->env_cpunum = cpunum();
+f0106c3b:	e8 04 40 00 00       	call   f010ac44 <cpunum>
+f0106c40:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106c46:	8b 98 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%ebx
+f0106c4c:	e8 f3 3f 00 00       	call   f010ac44 <cpunum>
+f0106c51:	89 43 60             	mov    %eax,0x60(%ebx)
+
+	// Other CPUs must be done with addresses we unmapped before
+	// this CPU leaves the kernel.
+	tlb_shootdown();
+f0106c54:	e8 ed c3 ff ff       	call   f0103046 <tlb_shootdown>
+
+	__asm __volatile("movl %0,%%esp\n"
+f0106c59:	8b 65 08             	mov    0x8(%ebp),%esp
+f0106c5c:	61                   	popa
+f0106c5d:	07                   	pop    %es
+f0106c5e:	1f                   	pop    %ds
+f0106c5f:	83 c4 08             	add    $0x8,%esp
+f0106c62:	cf                   	iret
+		"\tpopl %%es\n"
+		"\tpopl %%ds\n"
+		"\taddl $0x8,%%esp\n" /* skip tf_trapno and tf_errcode */
+		"\tiret"
+		: : "g" (tf) : "memory");
+	panic("iret failed");  /* mostly to placate the compiler */
+f0106c63:	83 ec 04             	sub    $0x4,%esp
+f0106c66:	68 d4 dd 10 f0       	push   $0xf010ddd4
+f0106c6b:	68 23 03 00 00       	push   $0x323
+f0106c70:	68 40 dd 10 f0       	push   $0xf010dd40
+f0106c75:	e8 1e 94 ff ff       	call   f0100098 <_panic>
+
+f0106c7a <env_run>:
+//
+// This function does not return.
+//
+void
+env_run(struct Env *e)
+{
+f0106c7a:	55                   	push   %ebp
+f0106c7b:	89 e5                	mov    %esp,%ebp
+f0106c7d:	56                   	push   %esi
+f0106c7e:	53                   	push   %ebx
+f0106c7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	//	e->env_tf.  Go back through the code you wrote above
+	//	and make sure you have set the relevant parts of
+	//	e->env_tf to sensible values.
+
+	// LAB 3: Your code here.
+	if (e) {
+f0106c82:	85 db                	test   %ebx,%ebx
+f0106c84:	0f 84 33 01 00 00    	je     f0106dbd <env_run+0x143>
+		if (curenv && curenv != e && curenv->env_status == ENV_RUNNING) {
+f0106c8a:	e8 b5 3f 00 00       	call   f010ac44 <cpunum>
+f0106c8f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106c95:	83 b8 28 90 61 f0 00 	cmpl   $0x0,-0xf9e6fd8(%eax)
+f0106c9c:	74 2e                	je     f0106ccc <env_run+0x52>
+f0106c9e:	e8 a1 3f 00 00       	call   f010ac44 <cpunum>
+f0106ca3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106ca9:	39 98 28 90 61 f0    	cmp    %ebx,-0xf9e6fd8(%eax)
+f0106caf:	74 1b                	je     f0106ccc <env_run+0x52>
+f0106cb1:	e8 8e 3f 00 00       	call   f010ac44 <cpunum>
+f0106cb6:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106cbc:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0106cc2:	83 78 58 03          	cmpl   $0x3,0x58(%eax)
+f0106cc6:	0f 84 19 01 00 00    	je     f0106de5 <env_run+0x16b>
+			curenv->env_status = ENV_RUNNABLE;
+			sched_enqueue(curenv);
+		}
+
+		sched_dequeue(e);
+f0106ccc:	83 ec 0c             	sub    $0xc,%esp
+f0106ccf:	53                   	push   %ebx
+f0106cd0:	e8 b3 11 00 00       	call   f0107e88 <sched_dequeue>
+		if (e->env_runs && e->env_cpunum != cpunum())
+f0106cd5:	83 c4 10             	add    $0x10,%esp
+f0106cd8:	83 7b 5c 00          	cmpl   $0x0,0x5c(%ebx)
+f0106cdc:	0f 85 3c 01 00 00    	jne    f0106e1e <env_run+0x1a4>
+			thiscpu->cpu_migrations++;
+
+		if (curenv != e) {
+f0106ce2:	e8 5d 3f 00 00       	call   f010ac44 <cpunum>
+f0106ce7:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106ced:	39 98 28 90 61 f0    	cmp    %ebx,-0xf9e6fd8(%eax)
+f0106cf3:	74 47                	je     f0106d3c <env_run+0xc2>
+			if (curenv)
+f0106cf5:	e8 4a 3f 00 00       	call   f010ac44 <cpunum>
+f0106cfa:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106d00:	83 b8 28 90 61 f0 00 	cmpl   $0x0,-0xf9e6fd8(%eax)
+f0106d07:	74 1c                	je     f0106d25 <env_run+0xab>
+				sched_account_run(curenv);
+f0106d09:	e8 36 3f 00 00       	call   f010ac44 <cpunum>
+f0106d0e:	83 ec 0c             	sub    $0xc,%esp
+f0106d11:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106d17:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0106d1d:	e8 b4 12 00 00       	call   f0107fd6 <sched_account_run>
+f0106d22:	83 c4 10             	add    $0x10,%esp
+			sched_account_wait(e);
+f0106d25:	83 ec 0c             	sub    $0xc,%esp
+f0106d28:	53                   	push   %ebx
+f0106d29:	e8 6d 12 00 00       	call   f0107f9b <sched_account_wait>
+	__asm __volatile("rdtsc" : "=A" (tsc));
+f0106d2e:	0f 31                	rdtsc
+			e->env_last_run = read_tsc();
+f0106d30:	89 43 7c             	mov    %eax,0x7c(%ebx)
+f0106d33:	89 93 80 00 00 00    	mov    %edx,0x80(%ebx)
+f0106d39:	83 c4 10             	add    $0x10,%esp
+		}
+
+		curenv = e;
+f0106d3c:	e8 03 3f 00 00       	call   f010ac44 <cpunum>
+f0106d41:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106d47:	89 98 28 90 61 f0    	mov    %ebx,-0xf9e6fd8(%eax)
+		curenv->env_cpunum = cpunum();
+f0106d4d:	e8 f2 3e 00 00       	call   f010ac44 <cpunum>
+f0106d52:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106d58:	8b 98 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%ebx
+f0106d5e:	e8 e1 3e 00 00       	call   f010ac44 <cpunum>
+f0106d63:	89 43 60             	mov    %eax,0x60(%ebx)
+		curenv->env_status = ENV_RUNNING;
+f0106d66:	e8 d9 3e 00 00       	call   f010ac44 <cpunum>
+f0106d6b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106d71:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0106d77:	c7 40 58 03 00 00 00 	movl   $0x3,0x58(%eax)
+		curenv->env_runs++;
+f0106d7e:	e8 c1 3e 00 00       	call   f010ac44 <cpunum>
+f0106d83:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106d89:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0106d8f:	83 40 5c 01          	addl   $0x1,0x5c(%eax)
+		lcr3(PADDR(curenv->env_pgdir));
+f0106d93:	e8 ac 3e 00 00       	call   f010ac44 <cpunum>
+f0106d98:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106d9e:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0106da4:	8b 80 30 01 00 00    	mov    0x130(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0106daa:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0106daf:	0f 86 90 00 00 00    	jbe    f0106e45 <env_run+0x1cb>
+	return (physaddr_t)kva - KERNBASE;
+f0106db5:	05 00 00 00 10       	add    $0x10000000,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0106dba:	0f 22 d8             	mov    %eax,%cr3
+}
+
+static inline void
+unlock_kernel(void)
+{
+	spin_unlock(&kernel_lock);
+f0106dbd:	83 ec 0c             	sub    $0xc,%esp
+f0106dc0:	68 c0 95 11 f0       	push   $0xf01195c0
+f0106dc5:	e8 25 42 00 00       	call   f010afef <spin_unlock>
+
+	// Normally we wouldn't need to do this, but QEMU only runs
+	// one CPU at a time and has a long time-slice.  Without the
+	// pause, this CPU is likely to reacquire the lock before
+	// another CPU has even been given a chance to acquire it.
+	asm volatile("pause");
+f0106dca:	f3 90                	pause
+	}
+	unlock_kernel();
+	env_pop_tf(&curenv->env_tf);
+f0106dcc:	e8 73 3e 00 00       	call   f010ac44 <cpunum>
+f0106dd1:	83 c4 04             	add    $0x4,%esp
+f0106dd4:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106dda:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0106de0:	e8 4f fe ff ff       	call   f0106c34 <env_pop_tf>
+			curenv->env_status = ENV_RUNNABLE;
+f0106de5:	e8 5a 3e 00 00       	call   f010ac44 <cpunum>
+f0106dea:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106df0:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0106df6:	c7 40 58 02 00 00 00 	movl   $0x2,0x58(%eax)
+			sched_enqueue(curenv);
+f0106dfd:	e8 42 3e 00 00       	call   f010ac44 <cpunum>
+f0106e02:	83 ec 0c             	sub    $0xc,%esp
+f0106e05:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106e0b:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0106e11:	e8 de 0e 00 00       	call   f0107cf4 <sched_enqueue>
+f0106e16:	83 c4 10             	add    $0x10,%esp
+f0106e19:	e9 ae fe ff ff       	jmp    f0106ccc <env_run+0x52>
+		if (e->env_runs && e->env_cpunum != cpunum())
+f0106e1e:	8b 73 60             	mov    0x60(%ebx),%esi
+f0106e21:	e8 1e 3e 00 00       	call   f010ac44 <cpunum>
+f0106e26:	39 c6                	cmp    %eax,%esi
+f0106e28:	0f 84 b4 fe ff ff    	je     f0106ce2 <env_run+0x68>
+			thiscpu->cpu_migrations++;
+f0106e2e:	e8 11 3e 00 00       	call   f010ac44 <cpunum>
+f0106e33:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0106e39:	83 80 c4 90 61 f0 01 	addl   $0x1,-0xf9e6f3c(%eax)
+f0106e40:	e9 9d fe ff ff       	jmp    f0106ce2 <env_run+0x68>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0106e45:	50                   	push   %eax
+f0106e46:	68 e8 cc 10 f0       	push   $0xf010cce8
+f0106e4b:	68 56 03 00 00       	push   $0x356
+f0106e50:	68 40 dd 10 f0       	push   $0xf010dd40
+f0106e55:	e8 3e 92 ff ff       	call   f0100098 <_panic>
+
+f0106e5a <mc146818_read>:
+#include <kern/kclock.h>
+
+
+unsigned
+mc146818_read(unsigned reg)
+{
+f0106e5a:	55                   	push   %ebp
+f0106e5b:	89 e5                	mov    %esp,%ebp
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0106e5d:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106e60:	ba 70 00 00 00       	mov    $0x70,%edx
+f0106e65:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0106e66:	ba 71 00 00 00       	mov    $0x71,%edx
+f0106e6b:	ec                   	in     (%dx),%al
+	outb(IO_RTC, reg);
+	return inb(IO_RTC+1);
+f0106e6c:	0f b6 c0             	movzbl %al,%eax
+}
+f0106e6f:	5d                   	pop    %ebp
+f0106e70:	c3                   	ret
+
+f0106e71 <mc146818_write>:
+
+void
+mc146818_write(unsigned reg, unsigned datum)
+{
+f0106e71:	55                   	push   %ebp
+f0106e72:	89 e5                	mov    %esp,%ebp
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0106e74:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106e77:	ba 70 00 00 00       	mov    $0x70,%edx
+f0106e7c:	ee                   	out    %al,(%dx)
+f0106e7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106e80:	ba 71 00 00 00       	mov    $0x71,%edx
+f0106e85:	ee                   	out    %al,(%dx)
+	outb(IO_RTC, reg);
+	outb(IO_RTC+1, datum);
+}
+f0106e86:	5d                   	pop    %ebp
+f0106e87:	c3                   	ret
+
+f0106e88 <irq_setmask_8259A>:
+		irq_setmask_8259A(irq_mask_8259A);
+}
+
+void
+irq_setmask_8259A(uint16_t mask)
+{
+f0106e88:	55                   	push   %ebp
+f0106e89:	89 e5                	mov    %esp,%ebp
+f0106e8b:	56                   	push   %esi
+f0106e8c:	53                   	push   %ebx
+f0106e8d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	irq_mask_8259A = mask;
+f0106e90:	66 89 0d c8 94 11 f0 	mov    %cx,0xf01194c8
+	if (!didinit)
+f0106e97:	80 3d 00 7d 61 f0 00 	cmpb   $0x0,0xf0617d00
+f0106e9e:	75 07                	jne    f0106ea7 <irq_setmask_8259A+0x1f>
+	cprintf("enabled interrupts:");
+	for (i = 0; i < 16; i++)
+		if (~mask & (1<<i))
+			cprintf(" %d", i);
+	cprintf("\n");
+}
+f0106ea0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0106ea3:	5b                   	pop    %ebx
+f0106ea4:	5e                   	pop    %esi
+f0106ea5:	5d                   	pop    %ebp
+f0106ea6:	c3                   	ret
+f0106ea7:	89 ce                	mov    %ecx,%esi
+f0106ea9:	ba 21 00 00 00       	mov    $0x21,%edx
+f0106eae:	89 c8                	mov    %ecx,%eax
+f0106eb0:	ee                   	out    %al,(%dx)
+	outb(IO_PIC2+1, (char)(mask >> 8));
+f0106eb1:	89 c8                	mov    %ecx,%eax
+f0106eb3:	66 c1 e8 08          	shr    $0x8,%ax
+f0106eb7:	ba a1 00 00 00       	mov    $0xa1,%edx
+f0106ebc:	ee                   	out    %al,(%dx)
+	cprintf("enabled interrupts:");
+f0106ebd:	83 ec 0c             	sub    $0xc,%esp
+f0106ec0:	68 e0 dd 10 f0       	push   $0xf010dde0
+f0106ec5:	e8 32 01 00 00       	call   f0106ffc <cprintf>
+f0106eca:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 16; i++)
+f0106ecd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (~mask & (1<<i))
+f0106ed2:	0f b7 f6             	movzwl %si,%esi
+f0106ed5:	f7 d6                	not    %esi
+f0106ed7:	eb 08                	jmp    f0106ee1 <irq_setmask_8259A+0x59>
+	for (i = 0; i < 16; i++)
+f0106ed9:	83 c3 01             	add    $0x1,%ebx
+f0106edc:	83 fb 10             	cmp    $0x10,%ebx
+f0106edf:	74 18                	je     f0106ef9 <irq_setmask_8259A+0x71>
+		if (~mask & (1<<i))
+f0106ee1:	0f a3 de             	bt     %ebx,%esi
+f0106ee4:	73 f3                	jae    f0106ed9 <irq_setmask_8259A+0x51>
+			cprintf(" %d", i);
+f0106ee6:	83 ec 08             	sub    $0x8,%esp
+f0106ee9:	53                   	push   %ebx
+f0106eea:	68 dc e4 10 f0       	push   $0xf010e4dc
+f0106eef:	e8 08 01 00 00       	call   f0106ffc <cprintf>
+f0106ef4:	83 c4 10             	add    $0x10,%esp
+f0106ef7:	eb e0                	jmp    f0106ed9 <irq_setmask_8259A+0x51>
+	cprintf("\n");
+f0106ef9:	83 ec 0c             	sub    $0xc,%esp
+f0106efc:	68 30 db 10 f0       	push   $0xf010db30
+f0106f01:	e8 f6 00 00 00       	call   f0106ffc <cprintf>
+f0106f06:	83 c4 10             	add    $0x10,%esp
+f0106f09:	eb 95                	jmp    f0106ea0 <irq_setmask_8259A+0x18>
+
+f0106f0b <pic_init>:
+{
+f0106f0b:	55                   	push   %ebp
+f0106f0c:	89 e5                	mov    %esp,%ebp
+f0106f0e:	57                   	push   %edi
+f0106f0f:	56                   	push   %esi
+f0106f10:	53                   	push   %ebx
+f0106f11:	83 ec 0c             	sub    $0xc,%esp
+	didinit = 1;
+f0106f14:	c6 05 00 7d 61 f0 01 	movb   $0x1,0xf0617d00
+f0106f1b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106f20:	bb 21 00 00 00       	mov    $0x21,%ebx
+f0106f25:	89 da                	mov    %ebx,%edx
+f0106f27:	ee                   	out    %al,(%dx)
+f0106f28:	b9 a1 00 00 00       	mov    $0xa1,%ecx
+f0106f2d:	89 ca                	mov    %ecx,%edx
+f0106f2f:	ee                   	out    %al,(%dx)
+f0106f30:	bf 11 00 00 00       	mov    $0x11,%edi
+f0106f35:	be 20 00 00 00       	mov    $0x20,%esi
+f0106f3a:	89 f8                	mov    %edi,%eax
+f0106f3c:	89 f2                	mov    %esi,%edx
+f0106f3e:	ee                   	out    %al,(%dx)
+f0106f3f:	b8 20 00 00 00       	mov    $0x20,%eax
+f0106f44:	89 da                	mov    %ebx,%edx
+f0106f46:	ee                   	out    %al,(%dx)
+f0106f47:	b8 04 00 00 00       	mov    $0x4,%eax
+f0106f4c:	ee                   	out    %al,(%dx)
+f0106f4d:	b8 03 00 00 00       	mov    $0x3,%eax
+f0106f52:	ee                   	out    %al,(%dx)
+f0106f53:	bb a0 00 00 00       	mov    $0xa0,%ebx
+f0106f58:	89 f8                	mov    %edi,%eax
+f0106f5a:	89 da                	mov    %ebx,%edx
+f0106f5c:	ee                   	out    %al,(%dx)
+f0106f5d:	b8 28 00 00 00       	mov    $0x28,%eax
+f0106f62:	89 ca                	mov    %ecx,%edx
+f0106f64:	ee                   	out    %al,(%dx)
+f0106f65:	b8 02 00 00 00       	mov    $0x2,%eax
+f0106f6a:	ee                   	out    %al,(%dx)
+f0106f6b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0106f70:	ee                   	out    %al,(%dx)
+f0106f71:	bf 68 00 00 00       	mov    $0x68,%edi
+f0106f76:	89 f8                	mov    %edi,%eax
+f0106f78:	89 f2                	mov    %esi,%edx
+f0106f7a:	ee                   	out    %al,(%dx)
+f0106f7b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+f0106f80:	89 c8                	mov    %ecx,%eax
+f0106f82:	ee                   	out    %al,(%dx)
+f0106f83:	89 f8                	mov    %edi,%eax
+f0106f85:	89 da                	mov    %ebx,%edx
+f0106f87:	ee                   	out    %al,(%dx)
+f0106f88:	89 c8                	mov    %ecx,%eax
+f0106f8a:	ee                   	out    %al,(%dx)
+	if (irq_mask_8259A != 0xFFFF)
+f0106f8b:	0f b7 05 c8 94 11 f0 	movzwl 0xf01194c8,%eax
+f0106f92:	66 83 f8 ff          	cmp    $0xffff,%ax
+f0106f96:	75 08                	jne    f0106fa0 <pic_init+0x95>
+}
+f0106f98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106f9b:	5b                   	pop    %ebx
+f0106f9c:	5e                   	pop    %esi
+f0106f9d:	5f                   	pop    %edi
+f0106f9e:	5d                   	pop    %ebp
+f0106f9f:	c3                   	ret
+		irq_setmask_8259A(irq_mask_8259A);
+f0106fa0:	83 ec 0c             	sub    $0xc,%esp
+f0106fa3:	0f b7 c0             	movzwl %ax,%eax
+f0106fa6:	50                   	push   %eax
+f0106fa7:	e8 dc fe ff ff       	call   f0106e88 <irq_setmask_8259A>
+f0106fac:	83 c4 10             	add    $0x10,%esp
+}
+f0106faf:	eb e7                	jmp    f0106f98 <pic_init+0x8d>
+
+f0106fb1 <irq_eoi>:
+f0106fb1:	b8 20 00 00 00       	mov    $0x20,%eax
+f0106fb6:	ba 20 00 00 00       	mov    $0x20,%edx
+f0106fbb:	ee                   	out    %al,(%dx)
+f0106fbc:	ba a0 00 00 00       	mov    $0xa0,%edx
+f0106fc1:	ee                   	out    %al,(%dx)
+	//   s: specific
+	//   e: end-of-interrupt
+	// xxx: specific interrupt line
+	outb(IO_PIC1, 0x20);
+	outb(IO_PIC2, 0x20);
+}
+f0106fc2:	c3                   	ret
+
+f0106fc3 <putch>:
+#include <inc/stdarg.h>
+
+
+static void
+putch(int ch, int *cnt)
+{
+f0106fc3:	55                   	push   %ebp
+f0106fc4:	89 e5                	mov    %esp,%ebp
+f0106fc6:	83 ec 14             	sub    $0x14,%esp
+	cputchar(ch);
+f0106fc9:	ff 75 08             	push   0x8(%ebp)
+f0106fcc:	e8 fd 97 ff ff       	call   f01007ce <cputchar>
+	*cnt++;
+}
+f0106fd1:	83 c4 10             	add    $0x10,%esp
+f0106fd4:	c9                   	leave
+f0106fd5:	c3                   	ret
+
+f0106fd6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+f0106fd6:	55                   	push   %ebp
+f0106fd7:	89 e5                	mov    %esp,%ebp
+f0106fd9:	83 ec 18             	sub    $0x18,%esp
+	int cnt = 0;
+f0106fdc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	vprintfmt((void*)putch, &cnt, fmt, ap);
+f0106fe3:	ff 75 0c             	push   0xc(%ebp)
+f0106fe6:	ff 75 08             	push   0x8(%ebp)
+f0106fe9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0106fec:	50                   	push   %eax
+f0106fed:	68 c3 6f 10 f0       	push   $0xf0106fc3
+f0106ff2:	e8 d1 2e 00 00       	call   f0109ec8 <vprintfmt>
+	return cnt;
+}
+f0106ff7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0106ffa:	c9                   	leave
+f0106ffb:	c3                   	ret
+
+f0106ffc <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+f0106ffc:	55                   	push   %ebp
+f0106ffd:	89 e5                	mov    %esp,%ebp
+f0106fff:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+f0107002:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+f0107005:	50                   	push   %eax
+f0107006:	ff 75 08             	push   0x8(%ebp)
+f0107009:	e8 c8 ff ff ff       	call   f0106fd6 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+f010700e:	c9                   	leave
+f010700f:	c3                   	ret
+
+f0107010 <trap_init_percpu>:
+}
+
+// Initialize and load the per-CPU TSS and IDT
+void
+trap_init_percpu(void)
+{
+f0107010:	55                   	push   %ebp
+f0107011:	89 e5                	mov    %esp,%ebp
+f0107013:	57                   	push   %edi
+f0107014:	56                   	push   %esi
+f0107015:	53                   	push   %ebx
+f0107016:	83 ec 1c             	sub    $0x1c,%esp
+	// get a triple fault.  If you set up an individual CPU's TSS
+	// wrong, you may not get a fault until you try to return from
+	// user space on that CPU.
+	//
+	// LAB 4: Your code here:
+	uint8_t cpu_id = thiscpu->cpu_id;
+f0107019:	e8 26 3c 00 00       	call   f010ac44 <cpunum>
+f010701e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107024:	0f b6 b8 20 90 61 f0 	movzbl -0xf9e6fe0(%eax),%edi
+
+	// Setup a TSS so that we get the right stack
+	// when we trap to the kernel.
+	thiscpu->cpu_ts.ts_esp0 = KSTACKTOP - cpu_id * (KSTKSIZE + KSTKGAP);
+f010702b:	89 f8                	mov    %edi,%eax
+f010702d:	0f b6 d8             	movzbl %al,%ebx
+f0107030:	e8 0f 3c 00 00       	call   f010ac44 <cpunum>
+f0107035:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010703b:	89 d9                	mov    %ebx,%ecx
+f010703d:	c1 e1 10             	shl    $0x10,%ecx
+f0107040:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+f0107045:	29 ca                	sub    %ecx,%edx
+f0107047:	89 90 30 90 61 f0    	mov    %edx,-0xf9e6fd0(%eax)
+	thiscpu->cpu_ts.ts_ss0 = GD_KD;
+f010704d:	e8 f2 3b 00 00       	call   f010ac44 <cpunum>
+f0107052:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107058:	66 c7 80 34 90 61 f0 	movw   $0x10,-0xf9e6fcc(%eax)
+f010705f:	10 00 
+
+	// Initialize the TSS slot of the gdt.
+	gdt[(GD_TSS0 >> 3) + cpu_id] = SEG16(STS_T32A, (uint32_t) (&thiscpu->cpu_ts),
+f0107061:	83 c3 05             	add    $0x5,%ebx
+f0107064:	e8 db 3b 00 00       	call   f010ac44 <cpunum>
+f0107069:	89 c6                	mov    %eax,%esi
+f010706b:	e8 d4 3b 00 00       	call   f010ac44 <cpunum>
+f0107070:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0107073:	e8 cc 3b 00 00       	call   f010ac44 <cpunum>
+f0107078:	66 c7 04 dd 60 94 11 	movw   $0x67,-0xfee6ba0(,%ebx,8)
+f010707f:	f0 67 00 
+f0107082:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+f0107088:	81 c6 2c 90 61 f0    	add    $0xf061902c,%esi
+f010708e:	66 89 34 dd 62 94 11 	mov    %si,-0xfee6b9e(,%ebx,8)
+f0107095:	f0 
+f0107096:	69 55 e4 bc 00 00 00 	imul   $0xbc,-0x1c(%ebp),%edx
+f010709d:	81 c2 2c 90 61 f0    	add    $0xf061902c,%edx
+f01070a3:	c1 ea 10             	shr    $0x10,%edx
+f01070a6:	88 14 dd 64 94 11 f0 	mov    %dl,-0xfee6b9c(,%ebx,8)
+f01070ad:	c6 04 dd 66 94 11 f0 	movb   $0x40,-0xfee6b9a(,%ebx,8)
+f01070b4:	40 
+f01070b5:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01070bb:	05 2c 90 61 f0       	add    $0xf061902c,%eax
+f01070c0:	c1 e8 18             	shr    $0x18,%eax
+f01070c3:	88 04 dd 67 94 11 f0 	mov    %al,-0xfee6b99(,%ebx,8)
+					     sizeof(struct Taskstate) - 1, 0);
+	gdt[(GD_TSS0 >> 3) + cpu_id].sd_s = 0;
+f01070ca:	c6 04 dd 65 94 11 f0 	movb   $0x89,-0xfee6b9b(,%ebx,8)
+f01070d1:	89 
+
+	// Load the TSS selector (like other segment selectors, the
+	// bottom three bits are special; we leave them 0)
+	ltr(GD_TSS0 + (cpu_id << 3));
+f01070d2:	89 f8                	mov    %edi,%eax
+f01070d4:	0f b6 f8             	movzbl %al,%edi
+f01070d7:	8d 3c fd 28 00 00 00 	lea    0x28(,%edi,8),%edi
+	__asm __volatile("ltr %0" : : "r" (sel));
+f01070de:	0f 00 df             	ltr    %di
+	__asm __volatile("lidt (%0)" : : "r" (p));
+f01070e1:	b8 cc 94 11 f0       	mov    $0xf01194cc,%eax
+f01070e6:	0f 01 18             	lidtl  (%eax)
+
+	// Load the IDT
+	lidt(&idt_pd);
+}
+f01070e9:	83 c4 1c             	add    $0x1c,%esp
+f01070ec:	5b                   	pop    %ebx
+f01070ed:	5e                   	pop    %esi
+f01070ee:	5f                   	pop    %edi
+f01070ef:	5d                   	pop    %ebp
+f01070f0:	c3                   	ret
+
+f01070f1 <trap_init>:
+{
+f01070f1:	55                   	push   %ebp
+f01070f2:	89 e5                	mov    %esp,%ebp
+f01070f4:	83 ec 08             	sub    $0x8,%esp
+	for (i = 0; i < T_SYSCALL; i++)
+f01070f7:	b8 00 00 00 00       	mov    $0x0,%eax
+		SETGATE(idt[i], 0, GD_KT, trap_handlers[i], 0);
+f01070fc:	8b 14 85 d2 94 11 f0 	mov    -0xfee6b2e(,%eax,4),%edx
+f0107103:	66 89 14 c5 20 7d 61 	mov    %dx,-0xf9e82e0(,%eax,8)
+f010710a:	f0 
+f010710b:	66 c7 04 c5 22 7d 61 	movw   $0x8,-0xf9e82de(,%eax,8)
+f0107112:	f0 08 00 
+f0107115:	c6 04 c5 24 7d 61 f0 	movb   $0x0,-0xf9e82dc(,%eax,8)
+f010711c:	00 
+f010711d:	c6 04 c5 25 7d 61 f0 	movb   $0x8e,-0xf9e82db(,%eax,8)
+f0107124:	8e 
+f0107125:	c1 ea 10             	shr    $0x10,%edx
+f0107128:	66 89 14 c5 26 7d 61 	mov    %dx,-0xf9e82da(,%eax,8)
+f010712f:	f0 
+	for (i = 0; i < T_SYSCALL; i++)
+f0107130:	83 c0 01             	add    $0x1,%eax
+f0107133:	83 f8 30             	cmp    $0x30,%eax
+f0107136:	75 c4                	jne    f01070fc <trap_init+0xb>
+	SETGATE(idt[T_BRKPT], 0, GD_KT, trap_handlers[T_BRKPT], 3);
+f0107138:	a1 de 94 11 f0       	mov    0xf01194de,%eax
+f010713d:	66 a3 38 7d 61 f0    	mov    %ax,0xf0617d38
+f0107143:	66 c7 05 3a 7d 61 f0 	movw   $0x8,0xf0617d3a
+f010714a:	08 00 
+f010714c:	c6 05 3c 7d 61 f0 00 	movb   $0x0,0xf0617d3c
+f0107153:	c6 05 3d 7d 61 f0 ee 	movb   $0xee,0xf0617d3d
+f010715a:	c1 e8 10             	shr    $0x10,%eax
+f010715d:	66 a3 3e 7d 61 f0    	mov    %ax,0xf0617d3e
+	SETGATE(idt[T_SYSCALL], 0, GD_KT, trap_handlers[T_SYSCALL], 3);
+f0107163:	a1 92 95 11 f0       	mov    0xf0119592,%eax
+f0107168:	66 a3 a0 7e 61 f0    	mov    %ax,0xf0617ea0
+f010716e:	66 c7 05 a2 7e 61 f0 	movw   $0x8,0xf0617ea2
+f0107175:	08 00 
+f0107177:	c6 05 a4 7e 61 f0 00 	movb   $0x0,0xf0617ea4
+f010717e:	c6 05 a5 7e 61 f0 ee 	movb   $0xee,0xf0617ea5
+f0107185:	c1 e8 10             	shr    $0x10,%eax
+f0107188:	66 a3 a6 7e 61 f0    	mov    %ax,0xf0617ea6
+	trap_init_percpu();
+f010718e:	e8 7d fe ff ff       	call   f0107010 <trap_init_percpu>
+}
+f0107193:	c9                   	leave
+f0107194:	c3                   	ret
+
+f0107195 <print_regs>:
+	}
+}
+
+void
+print_regs(struct PushRegs *regs)
+{
+f0107195:	55                   	push   %ebp
+f0107196:	89 e5                	mov    %esp,%ebp
+f0107198:	53                   	push   %ebx
+f0107199:	83 ec 0c             	sub    $0xc,%esp
+f010719c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("  edi  0x%08x\n", regs->reg_edi);
+f010719f:	ff 33                	push   (%ebx)
+f01071a1:	68 f4 dd 10 f0       	push   $0xf010ddf4
+f01071a6:	e8 51 fe ff ff       	call   f0106ffc <cprintf>
+	cprintf("  esi  0x%08x\n", regs->reg_esi);
+f01071ab:	83 c4 08             	add    $0x8,%esp
+f01071ae:	ff 73 04             	push   0x4(%ebx)
+f01071b1:	68 03 de 10 f0       	push   $0xf010de03
+f01071b6:	e8 41 fe ff ff       	call   f0106ffc <cprintf>
+	cprintf("  ebp  0x%08x\n", regs->reg_ebp);
+f01071bb:	83 c4 08             	add    $0x8,%esp
+f01071be:	ff 73 08             	push   0x8(%ebx)
+f01071c1:	68 12 de 10 f0       	push   $0xf010de12
+f01071c6:	e8 31 fe ff ff       	call   f0106ffc <cprintf>
+	cprintf("  oesp 0x%08x\n", regs->reg_oesp);
+f01071cb:	83 c4 08             	add    $0x8,%esp
+f01071ce:	ff 73 0c             	push   0xc(%ebx)
+f01071d1:	68 21 de 10 f0       	push   $0xf010de21
+f01071d6:	e8 21 fe ff ff       	call   f0106ffc <cprintf>
+	cprintf("  ebx  0x%08x\n", regs->reg_ebx);
+f01071db:	83 c4 08             	add    $0x8,%esp
+f01071de:	ff 73 10             	push   0x10(%ebx)
+f01071e1:	68 30 de 10 f0       	push   $0xf010de30
+f01071e6:	e8 11 fe ff ff       	call   f0106ffc <cprintf>
+	cprintf("  edx  0x%08x\n", regs->reg_edx);
+f01071eb:	83 c4 08             	add    $0x8,%esp
+f01071ee:	ff 73 14             	push   0x14(%ebx)
+f01071f1:	68 3f de 10 f0       	push   $0xf010de3f
+f01071f6:	e8 01 fe ff ff       	call   f0106ffc <cprintf>
+	cprintf("  ecx  0x%08x\n", regs->reg_ecx);
+f01071fb:	83 c4 08             	add    $0x8,%esp
+f01071fe:	ff 73 18             	push   0x18(%ebx)
+f0107201:	68 4e de 10 f0       	push   $0xf010de4e
+f0107206:	e8 f1 fd ff ff       	call   f0106ffc <cprintf>
+	cprintf("  eax  0x%08x\n", regs->reg_eax);
+f010720b:	83 c4 08             	add    $0x8,%esp
+f010720e:	ff 73 1c             	push   0x1c(%ebx)
+f0107211:	68 5d de 10 f0       	push   $0xf010de5d
+f0107216:	e8 e1 fd ff ff       	call   f0106ffc <cprintf>
+}
+f010721b:	83 c4 10             	add    $0x10,%esp
+f010721e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107221:	c9                   	leave
+f0107222:	c3                   	ret
+
+f0107223 <print_trapframe>:
+{
+f0107223:	55                   	push   %ebp
+f0107224:	89 e5                	mov    %esp,%ebp
+f0107226:	56                   	push   %esi
+f0107227:	53                   	push   %ebx
+f0107228:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("TRAP frame at %p from CPU %d\n", tf, cpunum());
+f010722b:	e8 14 3a 00 00       	call   f010ac44 <cpunum>
+f0107230:	83 ec 04             	sub    $0x4,%esp
+f0107233:	50                   	push   %eax
+f0107234:	53                   	push   %ebx
+f0107235:	68 c1 de 10 f0       	push   $0xf010dec1
+f010723a:	e8 bd fd ff ff       	call   f0106ffc <cprintf>
+	print_regs(&tf->tf_regs);
+f010723f:	89 1c 24             	mov    %ebx,(%esp)
+f0107242:	e8 4e ff ff ff       	call   f0107195 <print_regs>
+	cprintf("  es   0x----%04x\n", tf->tf_es);
+f0107247:	83 c4 08             	add    $0x8,%esp
+f010724a:	0f b7 43 20          	movzwl 0x20(%ebx),%eax
+f010724e:	50                   	push   %eax
+f010724f:	68 df de 10 f0       	push   $0xf010dedf
+f0107254:	e8 a3 fd ff ff       	call   f0106ffc <cprintf>
+	cprintf("  ds   0x----%04x\n", tf->tf_ds);
+f0107259:	83 c4 08             	add    $0x8,%esp
+f010725c:	0f b7 43 24          	movzwl 0x24(%ebx),%eax
+f0107260:	50                   	push   %eax
+f0107261:	68 f2 de 10 f0       	push   $0xf010def2
+f0107266:	e8 91 fd ff ff       	call   f0106ffc <cprintf>
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f010726b:	8b 43 28             	mov    0x28(%ebx),%eax
+	if (trapno < sizeof(excnames)/sizeof(excnames[0]))
+f010726e:	83 c4 10             	add    $0x10,%esp
+f0107271:	83 f8 13             	cmp    $0x13,%eax
+f0107274:	0f 86 da 00 00 00    	jbe    f0107354 <print_trapframe+0x131>
+		return "System call";
+f010727a:	ba 6c de 10 f0       	mov    $0xf010de6c,%edx
+	if (trapno == T_SYSCALL)
+f010727f:	83 f8 30             	cmp    $0x30,%eax
+f0107282:	74 13                	je     f0107297 <print_trapframe+0x74>
+	if (trapno >= IRQ_OFFSET && trapno < IRQ_OFFSET + 16)
+f0107284:	8d 50 e0             	lea    -0x20(%eax),%edx
+	return "(unknown trap)";
+f0107287:	83 fa 10             	cmp    $0x10,%edx
+f010728a:	ba 87 de 10 f0       	mov    $0xf010de87,%edx
+f010728f:	b9 78 de 10 f0       	mov    $0xf010de78,%ecx
+f0107294:	0f 43 d1             	cmovae %ecx,%edx
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f0107297:	83 ec 04             	sub    $0x4,%esp
+f010729a:	52                   	push   %edx
+f010729b:	50                   	push   %eax
+f010729c:	68 05 df 10 f0       	push   $0xf010df05
+f01072a1:	e8 56 fd ff ff       	call   f0106ffc <cprintf>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f01072a6:	83 c4 10             	add    $0x10,%esp
+f01072a9:	39 1d 20 85 61 f0    	cmp    %ebx,0xf0618520
+f01072af:	0f 84 ab 00 00 00    	je     f0107360 <print_trapframe+0x13d>
+	cprintf("  err  0x%08x", tf->tf_err);
+f01072b5:	83 ec 08             	sub    $0x8,%esp
+f01072b8:	ff 73 2c             	push   0x2c(%ebx)
+f01072bb:	68 26 df 10 f0       	push   $0xf010df26
+f01072c0:	e8 37 fd ff ff       	call   f0106ffc <cprintf>
+	if (tf->tf_trapno == T_PGFLT)
+f01072c5:	83 c4 10             	add    $0x10,%esp
+f01072c8:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f01072cc:	0f 85 b1 00 00 00    	jne    f0107383 <print_trapframe+0x160>
+			tf->tf_err & 1 ? "protection" : "not-present");
+f01072d2:	8b 43 2c             	mov    0x2c(%ebx),%eax
+		cprintf(" [%s, %s, %s]\n",
+f01072d5:	a8 01                	test   $0x1,%al
+f01072d7:	b9 a5 de 10 f0       	mov    $0xf010dea5,%ecx
+f01072dc:	ba 9a de 10 f0       	mov    $0xf010de9a,%edx
+f01072e1:	0f 45 ca             	cmovne %edx,%ecx
+f01072e4:	a8 02                	test   $0x2,%al
+f01072e6:	ba b7 de 10 f0       	mov    $0xf010deb7,%edx
+f01072eb:	be b1 de 10 f0       	mov    $0xf010deb1,%esi
+f01072f0:	0f 45 d6             	cmovne %esi,%edx
+f01072f3:	a8 04                	test   $0x4,%al
+f01072f5:	b8 f1 df 10 f0       	mov    $0xf010dff1,%eax
+f01072fa:	be bc de 10 f0       	mov    $0xf010debc,%esi
+f01072ff:	0f 45 c6             	cmovne %esi,%eax
+f0107302:	51                   	push   %ecx
+f0107303:	52                   	push   %edx
+f0107304:	50                   	push   %eax
+f0107305:	68 34 df 10 f0       	push   $0xf010df34
+f010730a:	e8 ed fc ff ff       	call   f0106ffc <cprintf>
+f010730f:	83 c4 10             	add    $0x10,%esp
+	cprintf("  eip  0x%08x\n", tf->tf_eip);
+f0107312:	83 ec 08             	sub    $0x8,%esp
+f0107315:	ff 73 30             	push   0x30(%ebx)
+f0107318:	68 43 df 10 f0       	push   $0xf010df43
+f010731d:	e8 da fc ff ff       	call   f0106ffc <cprintf>
+	cprintf("  cs   0x----%04x\n", tf->tf_cs);
+f0107322:	83 c4 08             	add    $0x8,%esp
+f0107325:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0107329:	50                   	push   %eax
+f010732a:	68 52 df 10 f0       	push   $0xf010df52
+f010732f:	e8 c8 fc ff ff       	call   f0106ffc <cprintf>
+	cprintf("  flag 0x%08x\n", tf->tf_eflags);
+f0107334:	83 c4 08             	add    $0x8,%esp
+f0107337:	ff 73 38             	push   0x38(%ebx)
+f010733a:	68 65 df 10 f0       	push   $0xf010df65
+f010733f:	e8 b8 fc ff ff       	call   f0106ffc <cprintf>
+	if ((tf->tf_cs & 3) != 0) {
+f0107344:	83 c4 10             	add    $0x10,%esp
+f0107347:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f010734b:	75 4b                	jne    f0107398 <print_trapframe+0x175>
+}
+f010734d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0107350:	5b                   	pop    %ebx
+f0107351:	5e                   	pop    %esi
+f0107352:	5d                   	pop    %ebp
+f0107353:	c3                   	ret
+		return excnames[trapno];
+f0107354:	8b 14 85 60 e2 10 f0 	mov    -0xfef1da0(,%eax,4),%edx
+f010735b:	e9 37 ff ff ff       	jmp    f0107297 <print_trapframe+0x74>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f0107360:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f0107364:	0f 85 4b ff ff ff    	jne    f01072b5 <print_trapframe+0x92>
+	__asm __volatile("movl %%cr2,%0" : "=r" (val));
+f010736a:	0f 20 d0             	mov    %cr2,%eax
+		cprintf("  cr2  0x%08x\n", rcr2());
+f010736d:	83 ec 08             	sub    $0x8,%esp
+f0107370:	50                   	push   %eax
+f0107371:	68 17 df 10 f0       	push   $0xf010df17
+f0107376:	e8 81 fc ff ff       	call   f0106ffc <cprintf>
+f010737b:	83 c4 10             	add    $0x10,%esp
+f010737e:	e9 32 ff ff ff       	jmp    f01072b5 <print_trapframe+0x92>
+		cprintf("\n");
+f0107383:	83 ec 0c             	sub    $0xc,%esp
+f0107386:	68 30 db 10 f0       	push   $0xf010db30
+f010738b:	e8 6c fc ff ff       	call   f0106ffc <cprintf>
+f0107390:	83 c4 10             	add    $0x10,%esp
+f0107393:	e9 7a ff ff ff       	jmp    f0107312 <print_trapframe+0xef>
+		cprintf("  esp  0x%08x\n", tf->tf_esp);
+f0107398:	83 ec 08             	sub    $0x8,%esp
+f010739b:	ff 73 3c             	push   0x3c(%ebx)
+f010739e:	68 74 df 10 f0       	push   $0xf010df74
+f01073a3:	e8 54 fc ff ff       	call   f0106ffc <cprintf>
+		cprintf("  ss   0x----%04x\n", tf->tf_ss);
+f01073a8:	83 c4 08             	add    $0x8,%esp
+f01073ab:	0f b7 43 40          	movzwl 0x40(%ebx),%eax
+f01073af:	50                   	push   %eax
+f01073b0:	68 83 df 10 f0       	push   $0xf010df83
+f01073b5:	e8 42 fc ff ff       	call   f0106ffc <cprintf>
+f01073ba:	83 c4 10             	add    $0x10,%esp
+}
+f01073bd:	eb 8e                	jmp    f010734d <print_trapframe+0x12a>
+
+f01073bf <page_fault_handler>:
+}
+
+
+void
+page_fault_handler(struct Trapframe *tf)
+{
+f01073bf:	55                   	push   %ebp
+f01073c0:	89 e5                	mov    %esp,%ebp
+f01073c2:	57                   	push   %edi
+f01073c3:	56                   	push   %esi
+f01073c4:	53                   	push   %ebx
+f01073c5:	83 ec 0c             	sub    $0xc,%esp
+f01073c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01073cb:	0f 20 d6             	mov    %cr2,%esi
+	fault_va = rcr2();
+
+	// Handle kernel-mode page faults.
+
+	// LAB 3: Your code here.
+	if ((tf->tf_cs & 3) != 3) {
+f01073ce:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f01073d2:	83 e0 03             	and    $0x3,%eax
+f01073d5:	66 83 f8 03          	cmp    $0x3,%ax
+f01073d9:	0f 85 86 00 00 00    	jne    f0107465 <page_fault_handler+0xa6>
+	//   (the 'tf' variable points at 'curenv->env_tf').
+
+	// LAB 4: Your code here.
+	// The first touch of a demand-zero page is resolved right here
+	// (see sys_region_reserve).
+	if (!(tf->tf_err & FEC_PR)) {
+f01073df:	f6 43 2c 01          	testb  $0x1,0x2c(%ebx)
+f01073e3:	0f 84 9c 00 00 00    	je     f0107485 <page_fault_handler+0xc6>
+	}
+
+	// So are copy-on-write faults on the shared zero page, and all
+	// copy-on-write faults if the environment asked for it (see
+	// sys_env_set_kernel_cow).
+	if ((tf->tf_err & FEC_WR) && (tf->tf_err & FEC_PR)) {
+f01073e9:	8b 43 2c             	mov    0x2c(%ebx),%eax
+f01073ec:	83 e0 03             	and    $0x3,%eax
+f01073ef:	83 f8 03             	cmp    $0x3,%eax
+f01073f2:	0f 84 08 01 00 00    	je     f0107500 <page_fault_handler+0x141>
+		env_unlock(curenv);
+		if (r == 0)
+			env_run(curenv);
+	}
+
+	if (curenv->env_pgfault_upcall) {
+f01073f8:	e8 47 38 00 00       	call   f010ac44 <cpunum>
+f01073fd:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107403:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0107409:	83 b8 94 01 00 00 00 	cmpl   $0x0,0x194(%eax)
+f0107410:	0f 85 81 01 00 00    	jne    f0107597 <page_fault_handler+0x1d8>
+		tf->tf_esp = tf_esp;
+		env_run(curenv);
+	}
+
+	// Destroy the environment that caused the fault.
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0107416:	8b 7b 30             	mov    0x30(%ebx),%edi
+		curenv->env_id, fault_va, tf->tf_eip);
+f0107419:	e8 26 38 00 00       	call   f010ac44 <cpunum>
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f010741e:	57                   	push   %edi
+f010741f:	56                   	push   %esi
+		curenv->env_id, fault_va, tf->tf_eip);
+f0107420:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0107426:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f010742c:	ff 70 4c             	push   0x4c(%eax)
+f010742f:	68 60 e1 10 f0       	push   $0xf010e160
+f0107434:	e8 c3 fb ff ff       	call   f0106ffc <cprintf>
+	print_trapframe(tf);
+f0107439:	89 1c 24             	mov    %ebx,(%esp)
+f010743c:	e8 e2 fd ff ff       	call   f0107223 <print_trapframe>
+	env_destroy(curenv);
+f0107441:	e8 fe 37 00 00       	call   f010ac44 <cpunum>
+f0107446:	83 c4 04             	add    $0x4,%esp
+f0107449:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010744f:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0107455:	e8 67 f7 ff ff       	call   f0106bc1 <env_destroy>
+}
+f010745a:	83 c4 10             	add    $0x10,%esp
+f010745d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107460:	5b                   	pop    %ebx
+f0107461:	5e                   	pop    %esi
+f0107462:	5f                   	pop    %edi
+f0107463:	5d                   	pop    %ebp
+f0107464:	c3                   	ret
+		print_trapframe(tf);
+f0107465:	83 ec 0c             	sub    $0xc,%esp
+f0107468:	53                   	push   %ebx
+f0107469:	e8 b5 fd ff ff       	call   f0107223 <print_trapframe>
+		panic("page fault happened in kernel mode");
+f010746e:	83 c4 0c             	add    $0xc,%esp
+f0107471:	68 3c e1 10 f0       	push   $0xf010e13c
+f0107476:	68 7c 01 00 00       	push   $0x17c
+f010747b:	68 96 df 10 f0       	push   $0xf010df96
+f0107480:	e8 13 8c ff ff       	call   f0100098 <_panic>
+		env_lock(curenv);
+f0107485:	e8 ba 37 00 00       	call   f010ac44 <cpunum>
+f010748a:	83 ec 0c             	sub    $0xc,%esp
+f010748d:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107493:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0107499:	e8 bc ec ff ff       	call   f010615a <env_lock>
+		r = env_region_fault(curenv, fault_va, tf->tf_err & FEC_WR);
+f010749e:	8b 7b 2c             	mov    0x2c(%ebx),%edi
+f01074a1:	d1 ef                	shr    %edi
+f01074a3:	83 e7 01             	and    $0x1,%edi
+f01074a6:	e8 99 37 00 00       	call   f010ac44 <cpunum>
+f01074ab:	83 c4 0c             	add    $0xc,%esp
+f01074ae:	57                   	push   %edi
+f01074af:	56                   	push   %esi
+f01074b0:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01074b6:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f01074bc:	e8 21 f2 ff ff       	call   f01066e2 <env_region_fault>
+f01074c1:	89 c7                	mov    %eax,%edi
+		env_unlock(curenv);
+f01074c3:	e8 7c 37 00 00       	call   f010ac44 <cpunum>
+f01074c8:	83 c4 04             	add    $0x4,%esp
+f01074cb:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01074d1:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f01074d7:	e8 aa ec ff ff       	call   f0106186 <env_unlock>
+		if (r == 0)
+f01074dc:	83 c4 10             	add    $0x10,%esp
+f01074df:	85 ff                	test   %edi,%edi
+f01074e1:	0f 85 02 ff ff ff    	jne    f01073e9 <page_fault_handler+0x2a>
+			env_run(curenv);
+f01074e7:	e8 58 37 00 00       	call   f010ac44 <cpunum>
+f01074ec:	83 ec 0c             	sub    $0xc,%esp
+f01074ef:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01074f5:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f01074fb:	e8 7a f7 ff ff       	call   f0106c7a <env_run>
+		env_lock(curenv);
+f0107500:	e8 3f 37 00 00       	call   f010ac44 <cpunum>
+f0107505:	83 ec 0c             	sub    $0xc,%esp
+f0107508:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010750e:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0107514:	e8 41 ec ff ff       	call   f010615a <env_lock>
+		r = page_fault_cow(curenv->env_pgdir, (void *) fault_va, !curenv->env_kernel_cow);
+f0107519:	e8 26 37 00 00       	call   f010ac44 <cpunum>
+f010751e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107524:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f010752a:	0f b6 80 98 01 00 00 	movzbl 0x198(%eax),%eax
+f0107531:	83 f0 01             	xor    $0x1,%eax
+f0107534:	0f b6 f8             	movzbl %al,%edi
+f0107537:	e8 08 37 00 00       	call   f010ac44 <cpunum>
+f010753c:	83 c4 0c             	add    $0xc,%esp
+f010753f:	57                   	push   %edi
+f0107540:	56                   	push   %esi
+f0107541:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107547:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f010754d:	ff b0 30 01 00 00    	push   0x130(%eax)
+f0107553:	e8 c9 b5 ff ff       	call   f0102b21 <page_fault_cow>
+f0107558:	89 c7                	mov    %eax,%edi
+		env_unlock(curenv);
+f010755a:	e8 e5 36 00 00       	call   f010ac44 <cpunum>
+f010755f:	83 c4 04             	add    $0x4,%esp
+f0107562:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107568:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f010756e:	e8 13 ec ff ff       	call   f0106186 <env_unlock>
+		if (r == 0)
+f0107573:	83 c4 10             	add    $0x10,%esp
+f0107576:	85 ff                	test   %edi,%edi
+f0107578:	0f 85 7a fe ff ff    	jne    f01073f8 <page_fault_handler+0x39>
+			env_run(curenv);
+f010757e:	e8 c1 36 00 00       	call   f010ac44 <cpunum>
+f0107583:	83 ec 0c             	sub    $0xc,%esp
+f0107586:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010758c:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0107592:	e8 e3 f6 ff ff       	call   f0106c7a <env_run>
+		if (tf->tf_esp < UXSTACKTOP - PGSIZE || tf->tf_esp >= UXSTACKTOP)
+f0107597:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f010759a:	8d 90 00 10 40 11    	lea    0x11401000(%eax),%edx
+			tf_esp = UXSTACKTOP - sizeof(struct UTrapframe);
+f01075a0:	bf cc ff bf ee       	mov    $0xeebfffcc,%edi
+		if (tf->tf_esp < UXSTACKTOP - PGSIZE || tf->tf_esp >= UXSTACKTOP)
+f01075a5:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+f01075ab:	77 05                	ja     f01075b2 <page_fault_handler+0x1f3>
+			tf_esp = tf->tf_esp - sizeof(struct UTrapframe) - 4;
+f01075ad:	83 e8 38             	sub    $0x38,%eax
+f01075b0:	89 c7                	mov    %eax,%edi
+		user_mem_assert_lock(curenv, (void *) tf_esp, sizeof(struct UTrapframe), PTE_W);
+f01075b2:	e8 8d 36 00 00       	call   f010ac44 <cpunum>
+f01075b7:	6a 02                	push   $0x2
+f01075b9:	6a 34                	push   $0x34
+f01075bb:	57                   	push   %edi
+f01075bc:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01075c2:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f01075c8:	e8 80 db ff ff       	call   f010514d <user_mem_assert_lock>
+		utf->utf_fault_va = fault_va;
+f01075cd:	89 fa                	mov    %edi,%edx
+f01075cf:	89 37                	mov    %esi,(%edi)
+		utf->utf_err = tf->tf_err;
+f01075d1:	8b 43 2c             	mov    0x2c(%ebx),%eax
+f01075d4:	89 47 04             	mov    %eax,0x4(%edi)
+		utf->utf_regs = tf->tf_regs;
+f01075d7:	8d 7f 08             	lea    0x8(%edi),%edi
+f01075da:	b9 08 00 00 00       	mov    $0x8,%ecx
+f01075df:	89 de                	mov    %ebx,%esi
+f01075e1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		utf->utf_eip = tf->tf_eip;
+f01075e3:	8b 43 30             	mov    0x30(%ebx),%eax
+f01075e6:	89 42 28             	mov    %eax,0x28(%edx)
+		utf->utf_eflags = tf->tf_eflags;
+f01075e9:	8b 43 38             	mov    0x38(%ebx),%eax
+f01075ec:	89 d6                	mov    %edx,%esi
+f01075ee:	89 42 2c             	mov    %eax,0x2c(%edx)
+		utf->utf_esp = tf->tf_esp;
+f01075f1:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f01075f4:	89 42 30             	mov    %eax,0x30(%edx)
+		env_unlock(curenv);
+f01075f7:	e8 48 36 00 00       	call   f010ac44 <cpunum>
+f01075fc:	83 c4 04             	add    $0x4,%esp
+f01075ff:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107605:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f010760b:	e8 76 eb ff ff       	call   f0106186 <env_unlock>
+		tf->tf_eip = (uintptr_t) curenv->env_pgfault_upcall;
+f0107610:	e8 2f 36 00 00       	call   f010ac44 <cpunum>
+f0107615:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010761b:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0107621:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+f0107627:	89 43 30             	mov    %eax,0x30(%ebx)
+		tf->tf_esp = tf_esp;
+f010762a:	89 73 3c             	mov    %esi,0x3c(%ebx)
+		env_run(curenv);
+f010762d:	e8 12 36 00 00       	call   f010ac44 <cpunum>
+f0107632:	83 c4 04             	add    $0x4,%esp
+f0107635:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010763b:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0107641:	e8 34 f6 ff ff       	call   f0106c7a <env_run>
+
+f0107646 <trap>:
+{
+f0107646:	55                   	push   %ebp
+f0107647:	89 e5                	mov    %esp,%ebp
+f0107649:	57                   	push   %edi
+f010764a:	56                   	push   %esi
+f010764b:	8b 75 08             	mov    0x8(%ebp),%esi
+	asm volatile("cld" ::: "cc");
+f010764e:	fc                   	cld
+	if (panicstr)
+f010764f:	83 3d 64 89 61 f0 00 	cmpl   $0x0,0xf0618964
+f0107656:	74 01                	je     f0107659 <trap+0x13>
+		asm volatile("hlt");
+f0107658:	f4                   	hlt
+	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED) {
+f0107659:	e8 e6 35 00 00       	call   f010ac44 <cpunum>
+f010765e:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+f0107664:	83 c2 04             	add    $0x4,%edx
+	asm volatile("lock; xchgl %0, %1" :
+f0107667:	b8 01 00 00 00       	mov    $0x1,%eax
+f010766c:	f0 87 82 20 90 61 f0 	lock xchg %eax,-0xf9e6fe0(%edx)
+f0107673:	83 f8 02             	cmp    $0x2,%eax
+f0107676:	74 39                	je     f01076b1 <trap+0x6b>
+	__asm __volatile("pushfl; popl %0" : "=r" (eflags));
+f0107678:	9c                   	pushf
+f0107679:	58                   	pop    %eax
+	assert(!(read_eflags() & FL_IF));
+f010767a:	f6 c4 02             	test   $0x2,%ah
+f010767d:	75 61                	jne    f01076e0 <trap+0x9a>
+	if ((tf->tf_cs & 3) == 3) {
+f010767f:	0f b7 46 34          	movzwl 0x34(%esi),%eax
+f0107683:	83 e0 03             	and    $0x3,%eax
+f0107686:	66 83 f8 03          	cmp    $0x3,%ax
+f010768a:	74 6d                	je     f01076f9 <trap+0xb3>
+	last_tf = tf;
+f010768c:	89 35 20 85 61 f0    	mov    %esi,0xf0618520
+	if (tf->tf_trapno == T_PGFLT) {
+f0107692:	8b 46 28             	mov    0x28(%esi),%eax
+f0107695:	83 f8 0e             	cmp    $0xe,%eax
+f0107698:	0f 84 82 01 00 00    	je     f0107820 <trap+0x1da>
+	if (tf->tf_trapno == T_DEBUG || tf->tf_trapno == T_BRKPT) {
+f010769e:	83 e8 01             	sub    $0x1,%eax
+f01076a1:	83 f8 2f             	cmp    $0x2f,%eax
+f01076a4:	0f 87 67 02 00 00    	ja     f0107911 <trap+0x2cb>
+f01076aa:	ff 24 85 a0 e1 10 f0 	jmp    *-0xfef1e60(,%eax,4)
+	spin_lock(&kernel_lock);
+f01076b1:	83 ec 0c             	sub    $0xc,%esp
+f01076b4:	68 c0 95 11 f0       	push   $0xf01195c0
+f01076b9:	e8 15 38 00 00       	call   f010aed3 <spin_lock>
+		if (thiscpu != bootcpu)
+f01076be:	e8 81 35 00 00       	call   f010ac44 <cpunum>
+f01076c3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01076c9:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f01076ce:	83 c4 10             	add    $0x10,%esp
+f01076d1:	39 05 00 96 61 f0    	cmp    %eax,0xf0619600
+f01076d7:	74 9f                	je     f0107678 <trap+0x32>
+			lapic_timer_start();
+f01076d9:	e8 0b 35 00 00       	call   f010abe9 <lapic_timer_start>
+f01076de:	eb 98                	jmp    f0107678 <trap+0x32>
+	assert(!(read_eflags() & FL_IF));
+f01076e0:	68 a2 df 10 f0       	push   $0xf010dfa2
+f01076e5:	68 0d d8 10 f0       	push   $0xf010d80d
+f01076ea:	68 22 01 00 00       	push   $0x122
+f01076ef:	68 96 df 10 f0       	push   $0xf010df96
+f01076f4:	e8 9f 89 ff ff       	call   f0100098 <_panic>
+		assert(curenv);
+f01076f9:	e8 46 35 00 00       	call   f010ac44 <cpunum>
+f01076fe:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107704:	83 b8 28 90 61 f0 00 	cmpl   $0x0,-0xf9e6fd8(%eax)
+f010770b:	74 1f                	je     f010772c <trap+0xe6>
+		if (tf->tf_trapno == IRQ_OFFSET + IRQ_TLB) {
+f010770d:	8b 46 28             	mov    0x28(%esi),%eax
+f0107710:	83 f8 2c             	cmp    $0x2c,%eax
+f0107713:	74 30                	je     f0107745 <trap+0xff>
+		if (tf->tf_trapno == T_SYSCALL &&
+f0107715:	83 f8 30             	cmp    $0x30,%eax
+f0107718:	74 3e                	je     f0107758 <trap+0x112>
+f010771a:	83 ec 0c             	sub    $0xc,%esp
+f010771d:	68 c0 95 11 f0       	push   $0xf01195c0
+f0107722:	e8 ac 37 00 00       	call   f010aed3 <spin_lock>
+}
+f0107727:	83 c4 10             	add    $0x10,%esp
+f010772a:	eb 49                	jmp    f0107775 <trap+0x12f>
+		assert(curenv);
+f010772c:	68 bb df 10 f0       	push   $0xf010dfbb
+f0107731:	68 0d d8 10 f0       	push   $0xf010d80d
+f0107736:	68 26 01 00 00       	push   $0x126
+f010773b:	68 96 df 10 f0       	push   $0xf010df96
+f0107740:	e8 53 89 ff ff       	call   f0100098 <_panic>
+			lapic_eoi();
+f0107745:	e8 1c 36 00 00       	call   f010ad66 <lapic_eoi>
+			tlb_shootdown_recv();
+f010774a:	e8 44 b8 ff ff       	call   f0102f93 <tlb_shootdown_recv>
+			env_pop_tf(tf);
+f010774f:	83 ec 0c             	sub    $0xc,%esp
+f0107752:	56                   	push   %esi
+f0107753:	e8 dc f4 ff ff       	call   f0106c34 <env_pop_tf>
+		    curenv->env_status == ENV_RUNNING && syscall_fast(tf))
+f0107758:	e8 e7 34 00 00       	call   f010ac44 <cpunum>
+f010775d:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107763:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+		if (tf->tf_trapno == T_SYSCALL &&
+f0107769:	83 78 58 03          	cmpl   $0x3,0x58(%eax)
+f010776d:	74 56                	je     f01077c5 <trap+0x17f>
+		if (tf->tf_trapno != T_SYSCALL)
+f010776f:	83 7e 28 30          	cmpl   $0x30,0x28(%esi)
+f0107773:	75 a5                	jne    f010771a <trap+0xd4>
+		if (curenv->env_status == ENV_DYING) {
+f0107775:	e8 ca 34 00 00       	call   f010ac44 <cpunum>
+f010777a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107780:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0107786:	83 78 58 01          	cmpl   $0x1,0x58(%eax)
+f010778a:	75 64                	jne    f01077f0 <trap+0x1aa>
+			if (tf->tf_trapno == T_SYSCALL)
+f010778c:	83 7e 28 30          	cmpl   $0x30,0x28(%esi)
+f0107790:	74 4c                	je     f01077de <trap+0x198>
+			env_free(curenv);
+f0107792:	e8 ad 34 00 00       	call   f010ac44 <cpunum>
+f0107797:	83 ec 0c             	sub    $0xc,%esp
+f010779a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01077a0:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f01077a6:	e8 ca f1 ff ff       	call   f0106975 <env_free>
+			curenv = NULL;
+f01077ab:	e8 94 34 00 00       	call   f010ac44 <cpunum>
+f01077b0:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01077b6:	c7 80 28 90 61 f0 00 	movl   $0x0,-0xf9e6fd8(%eax)
+f01077bd:	00 00 00 
+			sched_yield();
+f01077c0:	e8 d9 0a 00 00       	call   f010829e <sched_yield>
+		    curenv->env_status == ENV_RUNNING && syscall_fast(tf))
+f01077c5:	83 ec 0c             	sub    $0xc,%esp
+f01077c8:	56                   	push   %esi
+f01077c9:	e8 d6 13 00 00       	call   f0108ba4 <syscall_fast>
+f01077ce:	83 c4 10             	add    $0x10,%esp
+f01077d1:	84 c0                	test   %al,%al
+f01077d3:	74 9a                	je     f010776f <trap+0x129>
+			env_pop_tf(tf);
+f01077d5:	83 ec 0c             	sub    $0xc,%esp
+f01077d8:	56                   	push   %esi
+f01077d9:	e8 56 f4 ff ff       	call   f0106c34 <env_pop_tf>
+	spin_lock(&kernel_lock);
+f01077de:	83 ec 0c             	sub    $0xc,%esp
+f01077e1:	68 c0 95 11 f0       	push   $0xf01195c0
+f01077e6:	e8 e8 36 00 00       	call   f010aed3 <spin_lock>
+}
+f01077eb:	83 c4 10             	add    $0x10,%esp
+f01077ee:	eb a2                	jmp    f0107792 <trap+0x14c>
+		curenv->env_tf = *tf;
+f01077f0:	e8 4f 34 00 00       	call   f010ac44 <cpunum>
+f01077f5:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01077fb:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0107801:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0107806:	89 c7                	mov    %eax,%edi
+f0107808:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		tf = &curenv->env_tf;
+f010780a:	e8 35 34 00 00       	call   f010ac44 <cpunum>
+f010780f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107815:	8b b0 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%esi
+f010781b:	e9 6c fe ff ff       	jmp    f010768c <trap+0x46>
+		page_fault_handler(tf);
+f0107820:	83 ec 0c             	sub    $0xc,%esp
+f0107823:	56                   	push   %esi
+f0107824:	e8 96 fb ff ff       	call   f01073bf <page_fault_handler>
+		return;
+f0107829:	83 c4 10             	add    $0x10,%esp
+	if (tf->tf_trapno == T_SYSCALL) {
+f010782c:	83 7e 28 30          	cmpl   $0x30,0x28(%esi)
+f0107830:	0f 84 26 01 00 00    	je     f010795c <trap+0x316>
+	if (curenv && curenv->env_status == ENV_RUNNING)
+f0107836:	e8 09 34 00 00       	call   f010ac44 <cpunum>
+f010783b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107841:	83 b8 28 90 61 f0 00 	cmpl   $0x0,-0xf9e6fd8(%eax)
+f0107848:	74 1b                	je     f0107865 <trap+0x21f>
+f010784a:	e8 f5 33 00 00       	call   f010ac44 <cpunum>
+f010784f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107855:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f010785b:	83 78 58 03          	cmpl   $0x3,0x58(%eax)
+f010785f:	0f 84 78 01 00 00    	je     f01079dd <trap+0x397>
+		sched_yield();
+f0107865:	e8 34 0a 00 00       	call   f010829e <sched_yield>
+		monitor(tf);
+f010786a:	83 ec 0c             	sub    $0xc,%esp
+f010786d:	56                   	push   %esi
+f010786e:	e8 a6 9b ff ff       	call   f0101419 <monitor>
+		return;
+f0107873:	83 c4 10             	add    $0x10,%esp
+f0107876:	eb b4                	jmp    f010782c <trap+0x1e6>
+		tf->tf_regs.reg_eax = syscall(tf->tf_regs.reg_eax,
+f0107878:	83 ec 08             	sub    $0x8,%esp
+f010787b:	ff 76 04             	push   0x4(%esi)
+f010787e:	ff 36                	push   (%esi)
+f0107880:	ff 76 10             	push   0x10(%esi)
+f0107883:	ff 76 18             	push   0x18(%esi)
+f0107886:	ff 76 14             	push   0x14(%esi)
+f0107889:	ff 76 1c             	push   0x1c(%esi)
+f010788c:	e8 7a 13 00 00       	call   f0108c0b <syscall>
+f0107891:	89 46 1c             	mov    %eax,0x1c(%esi)
+		return;
+f0107894:	83 c4 20             	add    $0x20,%esp
+f0107897:	eb 93                	jmp    f010782c <trap+0x1e6>
+		cprintf("Spurious interrupt on irq 7\n");
+f0107899:	83 ec 0c             	sub    $0xc,%esp
+f010789c:	68 c2 df 10 f0       	push   $0xf010dfc2
+f01078a1:	e8 56 f7 ff ff       	call   f0106ffc <cprintf>
+		print_trapframe(tf);
+f01078a6:	89 34 24             	mov    %esi,(%esp)
+f01078a9:	e8 75 f9 ff ff       	call   f0107223 <print_trapframe>
+		return;
+f01078ae:	83 c4 10             	add    $0x10,%esp
+f01078b1:	e9 76 ff ff ff       	jmp    f010782c <trap+0x1e6>
+		if (thiscpu == bootcpu)
+f01078b6:	e8 89 33 00 00       	call   f010ac44 <cpunum>
+f01078bb:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01078c1:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f01078c6:	39 05 00 96 61 f0    	cmp    %eax,0xf0619600
+f01078cc:	74 0f                	je     f01078dd <trap+0x297>
+		lapic_eoi();
+f01078ce:	e8 93 34 00 00       	call   f010ad66 <lapic_eoi>
+		sched_tick();
+f01078d3:	e8 d0 0b 00 00       	call   f01084a8 <sched_tick>
+		return;
+f01078d8:	e9 4f ff ff ff       	jmp    f010782c <trap+0x1e6>
+			time_tick();
+f01078dd:	e8 3c 42 00 00       	call   f010bb1e <time_tick>
+f01078e2:	eb ea                	jmp    f01078ce <trap+0x288>
+		lapic_eoi();
+f01078e4:	e8 7d 34 00 00       	call   f010ad66 <lapic_eoi>
+		return;
+f01078e9:	e9 3e ff ff ff       	jmp    f010782c <trap+0x1e6>
+		lapic_eoi();
+f01078ee:	e8 73 34 00 00       	call   f010ad66 <lapic_eoi>
+		tlb_shootdown_recv();
+f01078f3:	e8 9b b6 ff ff       	call   f0102f93 <tlb_shootdown_recv>
+		return;
+f01078f8:	e9 2f ff ff ff       	jmp    f010782c <trap+0x1e6>
+		kbd_intr();
+f01078fd:	e8 17 8d ff ff       	call   f0100619 <kbd_intr>
+		return;
+f0107902:	e9 25 ff ff ff       	jmp    f010782c <trap+0x1e6>
+		serial_intr();
+f0107907:	e8 f1 8c ff ff       	call   f01005fd <serial_intr>
+		return;
+f010790c:	e9 1b ff ff ff       	jmp    f010782c <trap+0x1e6>
+	print_trapframe(tf);
+f0107911:	83 ec 0c             	sub    $0xc,%esp
+f0107914:	56                   	push   %esi
+f0107915:	e8 09 f9 ff ff       	call   f0107223 <print_trapframe>
+	if (tf->tf_cs == GD_KT)
+f010791a:	83 c4 10             	add    $0x10,%esp
+f010791d:	66 83 7e 34 08       	cmpw   $0x8,0x34(%esi)
+f0107922:	74 21                	je     f0107945 <trap+0x2ff>
+		env_destroy(curenv);
+f0107924:	e8 1b 33 00 00       	call   f010ac44 <cpunum>
+f0107929:	83 ec 0c             	sub    $0xc,%esp
+f010792c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107932:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0107938:	e8 84 f2 ff ff       	call   f0106bc1 <env_destroy>
+		return;
+f010793d:	83 c4 10             	add    $0x10,%esp
+f0107940:	e9 e7 fe ff ff       	jmp    f010782c <trap+0x1e6>
+		panic("unhandled trap in kernel");
+f0107945:	83 ec 04             	sub    $0x4,%esp
+f0107948:	68 df df 10 f0       	push   $0xf010dfdf
+f010794d:	68 05 01 00 00       	push   $0x105
+f0107952:	68 96 df 10 f0       	push   $0xf010df96
+f0107957:	e8 3c 87 ff ff       	call   f0100098 <_panic>
+		if (curenv->env_status == ENV_RUNNING)
+f010795c:	e8 e3 32 00 00       	call   f010ac44 <cpunum>
+f0107961:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107967:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f010796d:	83 78 58 03          	cmpl   $0x3,0x58(%eax)
+f0107971:	74 61                	je     f01079d4 <trap+0x38e>
+	spin_lock(&kernel_lock);
+f0107973:	83 ec 0c             	sub    $0xc,%esp
+f0107976:	68 c0 95 11 f0       	push   $0xf01195c0
+f010797b:	e8 53 35 00 00       	call   f010aed3 <spin_lock>
+		if (curenv->env_status == ENV_DYING) {
+f0107980:	e8 bf 32 00 00       	call   f010ac44 <cpunum>
+f0107985:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010798b:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0107991:	83 c4 10             	add    $0x10,%esp
+f0107994:	83 78 58 01          	cmpl   $0x1,0x58(%eax)
+f0107998:	0f 85 98 fe ff ff    	jne    f0107836 <trap+0x1f0>
+			env_free(curenv);
+f010799e:	e8 a1 32 00 00       	call   f010ac44 <cpunum>
+f01079a3:	83 ec 0c             	sub    $0xc,%esp
+f01079a6:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01079ac:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f01079b2:	e8 be ef ff ff       	call   f0106975 <env_free>
+			curenv = NULL;
+f01079b7:	e8 88 32 00 00       	call   f010ac44 <cpunum>
+f01079bc:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01079c2:	c7 80 28 90 61 f0 00 	movl   $0x0,-0xf9e6fd8(%eax)
+f01079c9:	00 00 00 
+f01079cc:	83 c4 10             	add    $0x10,%esp
+f01079cf:	e9 62 fe ff ff       	jmp    f0107836 <trap+0x1f0>
+			env_pop_tf(tf);
+f01079d4:	83 ec 0c             	sub    $0xc,%esp
+f01079d7:	56                   	push   %esi
+f01079d8:	e8 57 f2 ff ff       	call   f0106c34 <env_pop_tf>
+		env_run(curenv);
+f01079dd:	e8 62 32 00 00       	call   f010ac44 <cpunum>
+f01079e2:	83 ec 0c             	sub    $0xc,%esp
+f01079e5:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01079eb:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f01079f1:	e8 84 f2 ff ff       	call   f0106c7a <env_run>
+
+f01079f6 <trap_handler0>:
+ * Lab 3: Your code here for generating entry points for the different traps.
+ */
+.data
+.global trap_handlers
+trap_handlers:
+TRAPHANDLER_NOEC(trap_handler0, 0)
+f01079f6:	6a 00                	push   $0x0
+f01079f8:	6a 00                	push   $0x0
+f01079fa:	e9 97 1b 01 00       	jmp    f0119596 <_alltraps>
+f01079ff:	90                   	nop
+
+f0107a00 <trap_handler1>:
+TRAPHANDLER_NOEC(trap_handler1, 1)
+f0107a00:	6a 00                	push   $0x0
+f0107a02:	6a 01                	push   $0x1
+f0107a04:	e9 8d 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a09:	90                   	nop
+
+f0107a0a <trap_handler2>:
+TRAPHANDLER_NOEC(trap_handler2, 2)
+f0107a0a:	6a 00                	push   $0x0
+f0107a0c:	6a 02                	push   $0x2
+f0107a0e:	e9 83 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a13:	90                   	nop
+
+f0107a14 <trap_handler3>:
+TRAPHANDLER_NOEC(trap_handler3, 3)
+f0107a14:	6a 00                	push   $0x0
+f0107a16:	6a 03                	push   $0x3
+f0107a18:	e9 79 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a1d:	90                   	nop
+
+f0107a1e <trap_handler4>:
+TRAPHANDLER_NOEC(trap_handler4, 4)
+f0107a1e:	6a 00                	push   $0x0
+f0107a20:	6a 04                	push   $0x4
+f0107a22:	e9 6f 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a27:	90                   	nop
+
+f0107a28 <trap_handler5>:
+TRAPHANDLER_NOEC(trap_handler5, 5)
+f0107a28:	6a 00                	push   $0x0
+f0107a2a:	6a 05                	push   $0x5
+f0107a2c:	e9 65 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a31:	90                   	nop
+
+f0107a32 <trap_handler6>:
+TRAPHANDLER_NOEC(trap_handler6, 6)
+f0107a32:	6a 00                	push   $0x0
+f0107a34:	6a 06                	push   $0x6
+f0107a36:	e9 5b 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a3b:	90                   	nop
+
+f0107a3c <trap_handler7>:
+TRAPHANDLER_NOEC(trap_handler7, 7)
+f0107a3c:	6a 00                	push   $0x0
+f0107a3e:	6a 07                	push   $0x7
+f0107a40:	e9 51 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a45:	90                   	nop
+
+f0107a46 <trap_handler8>:
+TRAPHANDLER(trap_handler8, 8)
+f0107a46:	6a 08                	push   $0x8
+f0107a48:	e9 49 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a4d:	90                   	nop
+
+f0107a4e <trap_handler9>:
+TRAPHANDLER_NOEC(trap_handler9, 9)
+f0107a4e:	6a 00                	push   $0x0
+f0107a50:	6a 09                	push   $0x9
+f0107a52:	e9 3f 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a57:	90                   	nop
+
+f0107a58 <trap_handler10>:
+TRAPHANDLER(trap_handler10, 10)
+f0107a58:	6a 0a                	push   $0xa
+f0107a5a:	e9 37 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a5f:	90                   	nop
+
+f0107a60 <trap_handler11>:
+TRAPHANDLER(trap_handler11, 11)
+f0107a60:	6a 0b                	push   $0xb
+f0107a62:	e9 2f 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a67:	90                   	nop
+
+f0107a68 <trap_handler12>:
+TRAPHANDLER(trap_handler12, 12)
+f0107a68:	6a 0c                	push   $0xc
+f0107a6a:	e9 27 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a6f:	90                   	nop
+
+f0107a70 <trap_handler13>:
+TRAPHANDLER(trap_handler13, 13)
+f0107a70:	6a 0d                	push   $0xd
+f0107a72:	e9 1f 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a77:	90                   	nop
+
+f0107a78 <trap_handler14>:
+TRAPHANDLER(trap_handler14, 14)
+f0107a78:	6a 0e                	push   $0xe
+f0107a7a:	e9 17 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a7f:	90                   	nop
+
+f0107a80 <trap_handler15>:
+TRAPHANDLER_NOEC(trap_handler15, 15)
+f0107a80:	6a 00                	push   $0x0
+f0107a82:	6a 0f                	push   $0xf
+f0107a84:	e9 0d 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a89:	90                   	nop
+
+f0107a8a <trap_handler16>:
+TRAPHANDLER_NOEC(trap_handler16, 16)
+f0107a8a:	6a 00                	push   $0x0
+f0107a8c:	6a 10                	push   $0x10
+f0107a8e:	e9 03 1b 01 00       	jmp    f0119596 <_alltraps>
+f0107a93:	90                   	nop
+
+f0107a94 <trap_handler17>:
+TRAPHANDLER(trap_handler17, 17)
+f0107a94:	6a 11                	push   $0x11
+f0107a96:	e9 fb 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107a9b:	90                   	nop
+
+f0107a9c <trap_handler18>:
+TRAPHANDLER_NOEC(trap_handler18, 18)
+f0107a9c:	6a 00                	push   $0x0
+f0107a9e:	6a 12                	push   $0x12
+f0107aa0:	e9 f1 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107aa5:	90                   	nop
+
+f0107aa6 <trap_handler19>:
+TRAPHANDLER_NOEC(trap_handler19, 19)
+f0107aa6:	6a 00                	push   $0x0
+f0107aa8:	6a 13                	push   $0x13
+f0107aaa:	e9 e7 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107aaf:	90                   	nop
+
+f0107ab0 <trap_handler20>:
+TRAPHANDLER_NOEC(trap_handler20, 20)
+f0107ab0:	6a 00                	push   $0x0
+f0107ab2:	6a 14                	push   $0x14
+f0107ab4:	e9 dd 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107ab9:	90                   	nop
+
+f0107aba <trap_handler21>:
+TRAPHANDLER_NOEC(trap_handler21, 21)
+f0107aba:	6a 00                	push   $0x0
+f0107abc:	6a 15                	push   $0x15
+f0107abe:	e9 d3 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107ac3:	90                   	nop
+
+f0107ac4 <trap_handler22>:
+TRAPHANDLER_NOEC(trap_handler22, 22)
+f0107ac4:	6a 00                	push   $0x0
+f0107ac6:	6a 16                	push   $0x16
+f0107ac8:	e9 c9 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107acd:	90                   	nop
+
+f0107ace <trap_handler23>:
+TRAPHANDLER_NOEC(trap_handler23, 23)
+f0107ace:	6a 00                	push   $0x0
+f0107ad0:	6a 17                	push   $0x17
+f0107ad2:	e9 bf 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107ad7:	90                   	nop
+
+f0107ad8 <trap_handler24>:
+TRAPHANDLER_NOEC(trap_handler24, 24)
+f0107ad8:	6a 00                	push   $0x0
+f0107ada:	6a 18                	push   $0x18
+f0107adc:	e9 b5 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107ae1:	90                   	nop
+
+f0107ae2 <trap_handler25>:
+TRAPHANDLER_NOEC(trap_handler25, 25)
+f0107ae2:	6a 00                	push   $0x0
+f0107ae4:	6a 19                	push   $0x19
+f0107ae6:	e9 ab 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107aeb:	90                   	nop
+
+f0107aec <trap_handler26>:
+TRAPHANDLER_NOEC(trap_handler26, 26)
+f0107aec:	6a 00                	push   $0x0
+f0107aee:	6a 1a                	push   $0x1a
+f0107af0:	e9 a1 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107af5:	90                   	nop
+
+f0107af6 <trap_handler27>:
+TRAPHANDLER_NOEC(trap_handler27, 27)
+f0107af6:	6a 00                	push   $0x0
+f0107af8:	6a 1b                	push   $0x1b
+f0107afa:	e9 97 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107aff:	90                   	nop
+
+f0107b00 <trap_handler28>:
+TRAPHANDLER_NOEC(trap_handler28, 28)
+f0107b00:	6a 00                	push   $0x0
+f0107b02:	6a 1c                	push   $0x1c
+f0107b04:	e9 8d 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b09:	90                   	nop
+
+f0107b0a <trap_handler29>:
+TRAPHANDLER_NOEC(trap_handler29, 29)
+f0107b0a:	6a 00                	push   $0x0
+f0107b0c:	6a 1d                	push   $0x1d
+f0107b0e:	e9 83 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b13:	90                   	nop
+
+f0107b14 <trap_handler30>:
+TRAPHANDLER(trap_handler30, 30)
+f0107b14:	6a 1e                	push   $0x1e
+f0107b16:	e9 7b 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b1b:	90                   	nop
+
+f0107b1c <trap_handler31>:
+TRAPHANDLER_NOEC(trap_handler31, 31)
+f0107b1c:	6a 00                	push   $0x0
+f0107b1e:	6a 1f                	push   $0x1f
+f0107b20:	e9 71 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b25:	90                   	nop
+
+f0107b26 <trap_handler32>:
+TRAPHANDLER_NOEC(trap_handler32, 32)
+f0107b26:	6a 00                	push   $0x0
+f0107b28:	6a 20                	push   $0x20
+f0107b2a:	e9 67 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b2f:	90                   	nop
+
+f0107b30 <trap_handler33>:
+TRAPHANDLER_NOEC(trap_handler33, 33)
+f0107b30:	6a 00                	push   $0x0
+f0107b32:	6a 21                	push   $0x21
+f0107b34:	e9 5d 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b39:	90                   	nop
+
+f0107b3a <trap_handler34>:
+TRAPHANDLER_NOEC(trap_handler34, 34)
+f0107b3a:	6a 00                	push   $0x0
+f0107b3c:	6a 22                	push   $0x22
+f0107b3e:	e9 53 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b43:	90                   	nop
+
+f0107b44 <trap_handler35>:
+TRAPHANDLER_NOEC(trap_handler35, 35)
+f0107b44:	6a 00                	push   $0x0
+f0107b46:	6a 23                	push   $0x23
+f0107b48:	e9 49 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b4d:	90                   	nop
+
+f0107b4e <trap_handler36>:
+TRAPHANDLER_NOEC(trap_handler36, 36)
+f0107b4e:	6a 00                	push   $0x0
+f0107b50:	6a 24                	push   $0x24
+f0107b52:	e9 3f 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b57:	90                   	nop
+
+f0107b58 <trap_handler37>:
+TRAPHANDLER_NOEC(trap_handler37, 37)
+f0107b58:	6a 00                	push   $0x0
+f0107b5a:	6a 25                	push   $0x25
+f0107b5c:	e9 35 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b61:	90                   	nop
+
+f0107b62 <trap_handler38>:
+TRAPHANDLER_NOEC(trap_handler38, 38)
+f0107b62:	6a 00                	push   $0x0
+f0107b64:	6a 26                	push   $0x26
+f0107b66:	e9 2b 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b6b:	90                   	nop
+
+f0107b6c <trap_handler39>:
+TRAPHANDLER_NOEC(trap_handler39, 39)
+f0107b6c:	6a 00                	push   $0x0
+f0107b6e:	6a 27                	push   $0x27
+f0107b70:	e9 21 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b75:	90                   	nop
+
+f0107b76 <trap_handler40>:
+TRAPHANDLER_NOEC(trap_handler40, 40)
+f0107b76:	6a 00                	push   $0x0
+f0107b78:	6a 28                	push   $0x28
+f0107b7a:	e9 17 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b7f:	90                   	nop
+
+f0107b80 <trap_handler41>:
+TRAPHANDLER_NOEC(trap_handler41, 41)
+f0107b80:	6a 00                	push   $0x0
+f0107b82:	6a 29                	push   $0x29
+f0107b84:	e9 0d 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b89:	90                   	nop
+
+f0107b8a <trap_handler42>:
+TRAPHANDLER_NOEC(trap_handler42, 42)
+f0107b8a:	6a 00                	push   $0x0
+f0107b8c:	6a 2a                	push   $0x2a
+f0107b8e:	e9 03 1a 01 00       	jmp    f0119596 <_alltraps>
+f0107b93:	90                   	nop
+
+f0107b94 <trap_handler43>:
+TRAPHANDLER_NOEC(trap_handler43, 43)
+f0107b94:	6a 00                	push   $0x0
+f0107b96:	6a 2b                	push   $0x2b
+f0107b98:	e9 f9 19 01 00       	jmp    f0119596 <_alltraps>
+f0107b9d:	90                   	nop
+
+f0107b9e <trap_handler44>:
+TRAPHANDLER_NOEC(trap_handler44, 44)
+f0107b9e:	6a 00                	push   $0x0
+f0107ba0:	6a 2c                	push   $0x2c
+f0107ba2:	e9 ef 19 01 00       	jmp    f0119596 <_alltraps>
+f0107ba7:	90                   	nop
+
+f0107ba8 <trap_handler45>:
+TRAPHANDLER_NOEC(trap_handler45, 45)
+f0107ba8:	6a 00                	push   $0x0
+f0107baa:	6a 2d                	push   $0x2d
+f0107bac:	e9 e5 19 01 00       	jmp    f0119596 <_alltraps>
+f0107bb1:	90                   	nop
+
+f0107bb2 <trap_handler46>:
+TRAPHANDLER_NOEC(trap_handler46, 46)
+f0107bb2:	6a 00                	push   $0x0
+f0107bb4:	6a 2e                	push   $0x2e
+f0107bb6:	e9 db 19 01 00       	jmp    f0119596 <_alltraps>
+f0107bbb:	90                   	nop
+
+f0107bbc <trap_handler47>:
+TRAPHANDLER_NOEC(trap_handler47, 47)
+f0107bbc:	6a 00                	push   $0x0
+f0107bbe:	6a 2f                	push   $0x2f
+f0107bc0:	e9 d1 19 01 00       	jmp    f0119596 <_alltraps>
+f0107bc5:	90                   	nop
+
+f0107bc6 <trap_handler48>:
+TRAPHANDLER_NOEC(trap_handler48, 48)
+f0107bc6:	6a 00                	push   $0x0
+f0107bc8:	6a 30                	push   $0x30
+f0107bca:	e9 c7 19 01 00       	jmp    f0119596 <_alltraps>
+
+f0107bcf <cpu_allowed>:
+
+// Does e's CPU affinity mask allow it to run on CPU c?
+static bool
+cpu_allowed(struct Env *e, struct CpuInfo *c)
+{
+	return (e->env_cpumask >> (c - cpus)) & 1;
+f0107bcf:	81 ea 20 90 61 f0    	sub    $0xf0619020,%edx
+f0107bd5:	c1 fa 02             	sar    $0x2,%edx
+f0107bd8:	69 d2 cf 46 7d 67    	imul   $0x677d46cf,%edx,%edx
+f0107bde:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+f0107be4:	0f a3 d0             	bt     %edx,%eax
+f0107be7:	0f 92 c0             	setb   %al
+}
+f0107bea:	c3                   	ret
+
+f0107beb <runq_push>:
+}
+
+// Append e to the tail of its priority level in c's run queue.
+static void
+runq_push(struct CpuInfo *c, struct Env *e)
+{
+f0107beb:	55                   	push   %ebp
+f0107bec:	89 e5                	mov    %esp,%ebp
+f0107bee:	53                   	push   %ebx
+	struct RunQueue *rq = &c->cpu_runq;
+	int prio = e->env_priority;
+f0107bef:	8b 5a 70             	mov    0x70(%edx),%ebx
+
+	e->env_rq_next = NULL;
+f0107bf2:	c7 42 64 00 00 00 00 	movl   $0x0,0x64(%edx)
+	e->env_rq_prev = rq->rq_tail[prio];
+f0107bf9:	8b 8c 98 84 00 00 00 	mov    0x84(%eax,%ebx,4),%ecx
+f0107c00:	89 4a 68             	mov    %ecx,0x68(%edx)
+	if (rq->rq_tail[prio])
+f0107c03:	85 c9                	test   %ecx,%ecx
+f0107c05:	74 27                	je     f0107c2e <runq_push+0x43>
+		rq->rq_tail[prio]->env_rq_next = e;
+f0107c07:	89 51 64             	mov    %edx,0x64(%ecx)
+	else
+		rq->rq_head[prio] = e;
+	rq->rq_tail[prio] = e;
+f0107c0a:	89 94 98 84 00 00 00 	mov    %edx,0x84(%eax,%ebx,4)
+	rq->rq_len++;
+f0107c11:	83 80 94 00 00 00 01 	addl   $0x1,0x94(%eax)
+	e->env_rq_cpu = c - cpus;
+f0107c18:	2d 20 90 61 f0       	sub    $0xf0619020,%eax
+f0107c1d:	c1 f8 02             	sar    $0x2,%eax
+f0107c20:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+f0107c26:	89 42 6c             	mov    %eax,0x6c(%edx)
+}
+f0107c29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107c2c:	c9                   	leave
+f0107c2d:	c3                   	ret
+		rq->rq_head[prio] = e;
+f0107c2e:	89 54 98 74          	mov    %edx,0x74(%eax,%ebx,4)
+f0107c32:	eb d6                	jmp    f0107c0a <runq_push+0x1f>
+
+f0107c34 <runq_remove>:
+
+// Unlink e from the run queue that currently holds it.
+static void
+runq_remove(struct Env *e)
+{
+f0107c34:	55                   	push   %ebp
+f0107c35:	89 e5                	mov    %esp,%ebp
+f0107c37:	56                   	push   %esi
+f0107c38:	53                   	push   %ebx
+	struct RunQueue *rq = &cpus[e->env_rq_cpu].cpu_runq;
+f0107c39:	8b 50 6c             	mov    0x6c(%eax),%edx
+	int prio = e->env_priority;
+f0107c3c:	8b 58 70             	mov    0x70(%eax),%ebx
+
+	if (e->env_rq_prev)
+f0107c3f:	8b 48 68             	mov    0x68(%eax),%ecx
+f0107c42:	85 c9                	test   %ecx,%ecx
+f0107c44:	74 39                	je     f0107c7f <runq_remove+0x4b>
+		e->env_rq_prev->env_rq_next = e->env_rq_next;
+f0107c46:	8b 70 64             	mov    0x64(%eax),%esi
+f0107c49:	89 71 64             	mov    %esi,0x64(%ecx)
+	else
+		rq->rq_head[prio] = e->env_rq_next;
+	if (e->env_rq_next)
+f0107c4c:	8b 48 64             	mov    0x64(%eax),%ecx
+f0107c4f:	85 c9                	test   %ecx,%ecx
+f0107c51:	74 3f                	je     f0107c92 <runq_remove+0x5e>
+		e->env_rq_next->env_rq_prev = e->env_rq_prev;
+f0107c53:	8b 58 68             	mov    0x68(%eax),%ebx
+f0107c56:	89 59 68             	mov    %ebx,0x68(%ecx)
+	else
+		rq->rq_tail[prio] = e->env_rq_prev;
+	rq->rq_len--;
+f0107c59:	69 d2 bc 00 00 00    	imul   $0xbc,%edx,%edx
+f0107c5f:	83 aa b4 90 61 f0 01 	subl   $0x1,-0xf9e6f4c(%edx)
+	e->env_rq_next = e->env_rq_prev = NULL;
+f0107c66:	c7 40 68 00 00 00 00 	movl   $0x0,0x68(%eax)
+f0107c6d:	c7 40 64 00 00 00 00 	movl   $0x0,0x64(%eax)
+	e->env_rq_cpu = -1;
+f0107c74:	c7 40 6c ff ff ff ff 	movl   $0xffffffff,0x6c(%eax)
+}
+f0107c7b:	5b                   	pop    %ebx
+f0107c7c:	5e                   	pop    %esi
+f0107c7d:	5d                   	pop    %ebp
+f0107c7e:	c3                   	ret
+		rq->rq_head[prio] = e->env_rq_next;
+f0107c7f:	6b ca 2f             	imul   $0x2f,%edx,%ecx
+f0107c82:	8d 4c 0b 1c          	lea    0x1c(%ebx,%ecx,1),%ecx
+f0107c86:	8b 70 64             	mov    0x64(%eax),%esi
+f0107c89:	89 34 8d 24 90 61 f0 	mov    %esi,-0xf9e6fdc(,%ecx,4)
+f0107c90:	eb ba                	jmp    f0107c4c <runq_remove+0x18>
+		rq->rq_tail[prio] = e->env_rq_prev;
+f0107c92:	6b ca 2f             	imul   $0x2f,%edx,%ecx
+f0107c95:	8d 4c 0b 20          	lea    0x20(%ebx,%ecx,1),%ecx
+f0107c99:	8b 70 68             	mov    0x68(%eax),%esi
+f0107c9c:	89 34 8d 24 90 61 f0 	mov    %esi,-0xf9e6fdc(,%ecx,4)
+f0107ca3:	eb b4                	jmp    f0107c59 <runq_remove+0x25>
+
+f0107ca5 <hist_add>:
+}
+
+// Count a sample of 'cycles' TSC cycles in histogram hist.
+static void
+hist_add(uint32_t *hist, uint64_t cycles)
+{
+f0107ca5:	55                   	push   %ebp
+f0107ca6:	89 e5                	mov    %esp,%ebp
+f0107ca8:	57                   	push   %edi
+f0107ca9:	56                   	push   %esi
+f0107caa:	53                   	push   %ebx
+f0107cab:	83 ec 0c             	sub    $0xc,%esp
+f0107cae:	89 c7                	mov    %eax,%edi
+f0107cb0:	89 d0                	mov    %edx,%eax
+f0107cb2:	89 ca                	mov    %ecx,%edx
+	int b = 0;
+
+	cycles >>= SCHEDHIST_SHIFT;
+f0107cb4:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+f0107cb8:	c1 ea 0a             	shr    $0xa,%edx
+	int b = 0;
+f0107cbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	while (cycles > 1 && b < NSCHEDHIST - 1) {
+f0107cc0:	be 01 00 00 00       	mov    $0x1,%esi
+f0107cc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107cca:	89 7d ec             	mov    %edi,-0x14(%ebp)
+f0107ccd:	eb 09                	jmp    f0107cd8 <hist_add+0x33>
+		cycles >>= 1;
+f0107ccf:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+f0107cd3:	d1 ea                	shr    %edx
+		b++;
+f0107cd5:	83 c1 01             	add    $0x1,%ecx
+	while (cycles > 1 && b < NSCHEDHIST - 1) {
+f0107cd8:	39 c6                	cmp    %eax,%esi
+f0107cda:	89 df                	mov    %ebx,%edi
+f0107cdc:	19 d7                	sbb    %edx,%edi
+f0107cde:	73 05                	jae    f0107ce5 <hist_add+0x40>
+f0107ce0:	83 f9 12             	cmp    $0x12,%ecx
+f0107ce3:	7e ea                	jle    f0107ccf <hist_add+0x2a>
+	}
+	hist[b]++;
+f0107ce5:	8b 7d ec             	mov    -0x14(%ebp),%edi
+f0107ce8:	83 04 8f 01          	addl   $0x1,(%edi,%ecx,4)
+}
+f0107cec:	83 c4 0c             	add    $0xc,%esp
+f0107cef:	5b                   	pop    %ebx
+f0107cf0:	5e                   	pop    %esi
+f0107cf1:	5f                   	pop    %edi
+f0107cf2:	5d                   	pop    %ebp
+f0107cf3:	c3                   	ret
+
+f0107cf4 <sched_enqueue>:
+{
+f0107cf4:	55                   	push   %ebp
+f0107cf5:	89 e5                	mov    %esp,%ebp
+f0107cf7:	57                   	push   %edi
+f0107cf8:	56                   	push   %esi
+f0107cf9:	53                   	push   %ebx
+f0107cfa:	83 ec 1c             	sub    $0x1c,%esp
+f0107cfd:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if (e->env_rq_cpu >= 0)
+f0107d00:	83 7f 6c 00          	cmpl   $0x0,0x6c(%edi)
+f0107d04:	0f 89 6f 01 00 00    	jns    f0107e79 <sched_enqueue+0x185>
+	__asm __volatile("rdtsc" : "=A" (tsc));
+f0107d0a:	0f 31                	rdtsc
+	e->env_runnable_since = read_tsc();
+f0107d0c:	89 87 88 00 00 00    	mov    %eax,0x88(%edi)
+f0107d12:	89 97 8c 00 00 00    	mov    %edx,0x8c(%edi)
+	if (e->env_runs > 0 && e->env_cpunum >= 0 && e->env_cpunum < ncpu &&
+f0107d18:	83 7f 5c 00          	cmpl   $0x0,0x5c(%edi)
+f0107d1c:	74 2c                	je     f0107d4a <sched_enqueue+0x56>
+f0107d1e:	8b 47 60             	mov    0x60(%edi),%eax
+f0107d21:	85 c0                	test   %eax,%eax
+f0107d23:	78 25                	js     f0107d4a <sched_enqueue+0x56>
+f0107d25:	3b 05 04 96 61 f0    	cmp    0xf0619604,%eax
+f0107d2b:	7d 1d                	jge    f0107d4a <sched_enqueue+0x56>
+	    cpu_allowed(e, &cpus[e->env_cpunum]))
+f0107d2d:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107d33:	8d b0 20 90 61 f0    	lea    -0xf9e6fe0(%eax),%esi
+f0107d39:	89 f2                	mov    %esi,%edx
+f0107d3b:	89 f8                	mov    %edi,%eax
+f0107d3d:	e8 8d fe ff ff       	call   f0107bcf <cpu_allowed>
+	if (e->env_runs > 0 && e->env_cpunum >= 0 && e->env_cpunum < ncpu &&
+f0107d42:	84 c0                	test   %al,%al
+f0107d44:	0f 85 82 00 00 00    	jne    f0107dcc <sched_enqueue+0xd8>
+		best = cpu_allowed(e, thiscpu) ? thiscpu : NULL;
+f0107d4a:	e8 f5 2e 00 00       	call   f010ac44 <cpunum>
+f0107d4f:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+f0107d55:	81 c2 20 90 61 f0    	add    $0xf0619020,%edx
+f0107d5b:	89 f8                	mov    %edi,%eax
+f0107d5d:	e8 6d fe ff ff       	call   f0107bcf <cpu_allowed>
+f0107d62:	be 00 00 00 00       	mov    $0x0,%esi
+f0107d67:	84 c0                	test   %al,%al
+f0107d69:	75 19                	jne    f0107d84 <sched_enqueue+0x90>
+		for (c = cpus; c < cpus + ncpu; c++) {
+f0107d6b:	69 05 04 96 61 f0 bc 	imul   $0xbc,0xf0619604,%eax
+f0107d72:	00 00 00 
+f0107d75:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f0107d7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0107d7d:	bb 20 90 61 f0       	mov    $0xf0619020,%ebx
+f0107d82:	eb 1b                	jmp    f0107d9f <sched_enqueue+0xab>
+		best = cpu_allowed(e, thiscpu) ? thiscpu : NULL;
+f0107d84:	e8 bb 2e 00 00       	call   f010ac44 <cpunum>
+f0107d89:	69 f0 bc 00 00 00    	imul   $0xbc,%eax,%esi
+f0107d8f:	81 c6 20 90 61 f0    	add    $0xf0619020,%esi
+f0107d95:	eb d4                	jmp    f0107d6b <sched_enqueue+0x77>
+				best = c;
+f0107d97:	89 de                	mov    %ebx,%esi
+		for (c = cpus; c < cpus + ncpu; c++) {
+f0107d99:	81 c3 bc 00 00 00    	add    $0xbc,%ebx
+f0107d9f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107da2:	39 c3                	cmp    %eax,%ebx
+f0107da4:	73 22                	jae    f0107dc8 <sched_enqueue+0xd4>
+			if (!cpu_allowed(e, c))
+f0107da6:	89 da                	mov    %ebx,%edx
+f0107da8:	89 f8                	mov    %edi,%eax
+f0107daa:	e8 20 fe ff ff       	call   f0107bcf <cpu_allowed>
+f0107daf:	84 c0                	test   %al,%al
+f0107db1:	74 e6                	je     f0107d99 <sched_enqueue+0xa5>
+			if (!best || c->cpu_runq.rq_len < best->cpu_runq.rq_len)
+f0107db3:	85 f6                	test   %esi,%esi
+f0107db5:	74 e0                	je     f0107d97 <sched_enqueue+0xa3>
+				best = c;
+f0107db7:	8b 86 94 00 00 00    	mov    0x94(%esi),%eax
+f0107dbd:	39 83 94 00 00 00    	cmp    %eax,0x94(%ebx)
+f0107dc3:	0f 4c f3             	cmovl  %ebx,%esi
+f0107dc6:	eb d1                	jmp    f0107d99 <sched_enqueue+0xa5>
+		assert(best);
+f0107dc8:	85 f6                	test   %esi,%esi
+f0107dca:	74 41                	je     f0107e0d <sched_enqueue+0x119>
+	runq_push(best, e);
+f0107dcc:	89 fa                	mov    %edi,%edx
+f0107dce:	89 f0                	mov    %esi,%eax
+f0107dd0:	e8 16 fe ff ff       	call   f0107beb <runq_push>
+	if (c != thiscpu && c->cpu_status == CPU_HALTED) {
+f0107dd5:	e8 6a 2e 00 00       	call   f010ac44 <cpunum>
+f0107dda:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107de0:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f0107de5:	39 c6                	cmp    %eax,%esi
+f0107de7:	0f 84 94 00 00 00    	je     f0107e81 <sched_enqueue+0x18d>
+f0107ded:	8b 46 04             	mov    0x4(%esi),%eax
+f0107df0:	bb 20 90 61 f0       	mov    $0xf0619020,%ebx
+f0107df5:	83 f8 02             	cmp    $0x2,%eax
+f0107df8:	75 32                	jne    f0107e2c <sched_enqueue+0x138>
+		lapic_ipi_cpu(c->cpu_id, IRQ_OFFSET + IRQ_WAKEUP);
+f0107dfa:	83 ec 08             	sub    $0x8,%esp
+f0107dfd:	6a 2a                	push   $0x2a
+f0107dff:	0f b6 06             	movzbl (%esi),%eax
+f0107e02:	50                   	push   %eax
+f0107e03:	e8 6c 30 00 00       	call   f010ae74 <lapic_ipi_cpu>
+		return;
+f0107e08:	83 c4 10             	add    $0x10,%esp
+f0107e0b:	eb 6c                	jmp    f0107e79 <sched_enqueue+0x185>
+		assert(best);
+f0107e0d:	68 b0 e2 10 f0       	push   $0xf010e2b0
+f0107e12:	68 0d d8 10 f0       	push   $0xf010d80d
+f0107e17:	68 d6 00 00 00       	push   $0xd6
+f0107e1c:	68 b5 e2 10 f0       	push   $0xf010e2b5
+f0107e21:	e8 72 82 ff ff       	call   f0100098 <_panic>
+	for (idle = cpus; idle < cpus + ncpu; idle++) {
+f0107e26:	81 c3 bc 00 00 00    	add    $0xbc,%ebx
+f0107e2c:	69 05 04 96 61 f0 bc 	imul   $0xbc,0xf0619604,%eax
+f0107e33:	00 00 00 
+f0107e36:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f0107e3b:	39 c3                	cmp    %eax,%ebx
+f0107e3d:	73 3a                	jae    f0107e79 <sched_enqueue+0x185>
+		if (idle != thiscpu && idle->cpu_status == CPU_HALTED &&
+f0107e3f:	e8 00 2e 00 00       	call   f010ac44 <cpunum>
+f0107e44:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107e4a:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f0107e4f:	39 c3                	cmp    %eax,%ebx
+f0107e51:	74 d3                	je     f0107e26 <sched_enqueue+0x132>
+f0107e53:	8b 43 04             	mov    0x4(%ebx),%eax
+f0107e56:	83 f8 02             	cmp    $0x2,%eax
+f0107e59:	75 cb                	jne    f0107e26 <sched_enqueue+0x132>
+		    cpu_allowed(e, idle)) {
+f0107e5b:	89 da                	mov    %ebx,%edx
+f0107e5d:	89 f8                	mov    %edi,%eax
+f0107e5f:	e8 6b fd ff ff       	call   f0107bcf <cpu_allowed>
+		if (idle != thiscpu && idle->cpu_status == CPU_HALTED &&
+f0107e64:	84 c0                	test   %al,%al
+f0107e66:	74 be                	je     f0107e26 <sched_enqueue+0x132>
+			lapic_ipi_cpu(idle->cpu_id, IRQ_OFFSET + IRQ_WAKEUP);
+f0107e68:	83 ec 08             	sub    $0x8,%esp
+f0107e6b:	6a 2a                	push   $0x2a
+f0107e6d:	0f b6 03             	movzbl (%ebx),%eax
+f0107e70:	50                   	push   %eax
+f0107e71:	e8 fe 2f 00 00       	call   f010ae74 <lapic_ipi_cpu>
+			return;
+f0107e76:	83 c4 10             	add    $0x10,%esp
+}
+f0107e79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107e7c:	5b                   	pop    %ebx
+f0107e7d:	5e                   	pop    %esi
+f0107e7e:	5f                   	pop    %edi
+f0107e7f:	5d                   	pop    %ebp
+f0107e80:	c3                   	ret
+f0107e81:	bb 20 90 61 f0       	mov    $0xf0619020,%ebx
+f0107e86:	eb a4                	jmp    f0107e2c <sched_enqueue+0x138>
+
+f0107e88 <sched_dequeue>:
+{
+f0107e88:	55                   	push   %ebp
+f0107e89:	89 e5                	mov    %esp,%ebp
+f0107e8b:	83 ec 08             	sub    $0x8,%esp
+f0107e8e:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (e->env_rq_cpu >= 0)
+f0107e91:	83 78 6c 00          	cmpl   $0x0,0x6c(%eax)
+f0107e95:	79 02                	jns    f0107e99 <sched_dequeue+0x11>
+}
+f0107e97:	c9                   	leave
+f0107e98:	c3                   	ret
+		runq_remove(e);
+f0107e99:	e8 96 fd ff ff       	call   f0107c34 <runq_remove>
+}
+f0107e9e:	eb f7                	jmp    f0107e97 <sched_dequeue+0xf>
+
+f0107ea0 <sched_wakeup>:
+{
+f0107ea0:	55                   	push   %ebp
+f0107ea1:	89 e5                	mov    %esp,%ebp
+f0107ea3:	83 ec 08             	sub    $0x8,%esp
+f0107ea6:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (!e->env_prio_pinned && e->env_priority > ENV_PRIO_HIGHEST)
+f0107ea9:	80 78 74 00          	cmpb   $0x0,0x74(%eax)
+f0107ead:	75 07                	jne    f0107eb6 <sched_wakeup+0x16>
+f0107eaf:	8b 48 70             	mov    0x70(%eax),%ecx
+f0107eb2:	85 c9                	test   %ecx,%ecx
+f0107eb4:	7f 0e                	jg     f0107ec4 <sched_wakeup+0x24>
+	sched_enqueue(e);
+f0107eb6:	83 ec 0c             	sub    $0xc,%esp
+f0107eb9:	50                   	push   %eax
+f0107eba:	e8 35 fe ff ff       	call   f0107cf4 <sched_enqueue>
+}
+f0107ebf:	83 c4 10             	add    $0x10,%esp
+f0107ec2:	c9                   	leave
+f0107ec3:	c3                   	ret
+		env_set_level(e, e->env_priority - 1);
+f0107ec4:	83 e9 01             	sub    $0x1,%ecx
+	e->env_priority = prio;
+f0107ec7:	89 48 70             	mov    %ecx,0x70(%eax)
+	e->env_slice = SCHED_QUANTUM(prio);
+f0107eca:	ba 01 00 00 00       	mov    $0x1,%edx
+f0107ecf:	d3 e2                	shl    %cl,%edx
+f0107ed1:	89 50 78             	mov    %edx,0x78(%eax)
+}
+f0107ed4:	eb e0                	jmp    f0107eb6 <sched_wakeup+0x16>
+
+f0107ed6 <sched_yield_to>:
+{
+f0107ed6:	55                   	push   %ebp
+f0107ed7:	89 e5                	mov    %esp,%ebp
+f0107ed9:	56                   	push   %esi
+f0107eda:	53                   	push   %ebx
+f0107edb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	assert(e->env_status == ENV_RUNNABLE && e->env_rq_cpu < 0);
+f0107ede:	83 7b 58 02          	cmpl   $0x2,0x58(%ebx)
+f0107ee2:	75 29                	jne    f0107f0d <sched_yield_to+0x37>
+f0107ee4:	83 7b 6c 00          	cmpl   $0x0,0x6c(%ebx)
+f0107ee8:	79 23                	jns    f0107f0d <sched_yield_to+0x37>
+	if (!cpu_allowed(e, thiscpu))
+f0107eea:	e8 55 2d 00 00       	call   f010ac44 <cpunum>
+f0107eef:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+f0107ef5:	81 c2 20 90 61 f0    	add    $0xf0619020,%edx
+f0107efb:	89 d8                	mov    %ebx,%eax
+f0107efd:	e8 cd fc ff ff       	call   f0107bcf <cpu_allowed>
+f0107f02:	84 c0                	test   %al,%al
+f0107f04:	75 20                	jne    f0107f26 <sched_yield_to+0x50>
+}
+f0107f06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0107f09:	5b                   	pop    %ebx
+f0107f0a:	5e                   	pop    %esi
+f0107f0b:	5d                   	pop    %ebp
+f0107f0c:	c3                   	ret
+	assert(e->env_status == ENV_RUNNABLE && e->env_rq_cpu < 0);
+f0107f0d:	68 fc e2 10 f0       	push   $0xf010e2fc
+f0107f12:	68 0d d8 10 f0       	push   $0xf010d80d
+f0107f17:	68 fe 00 00 00       	push   $0xfe
+f0107f1c:	68 b5 e2 10 f0       	push   $0xf010e2b5
+f0107f21:	e8 72 81 ff ff       	call   f0100098 <_panic>
+	if (!e->env_prio_pinned && e->env_priority > ENV_PRIO_HIGHEST)
+f0107f26:	80 7b 74 00          	cmpb   $0x0,0x74(%ebx)
+f0107f2a:	75 0d                	jne    f0107f39 <sched_yield_to+0x63>
+f0107f2c:	8b 43 70             	mov    0x70(%ebx),%eax
+f0107f2f:	85 c0                	test   %eax,%eax
+f0107f31:	7e 06                	jle    f0107f39 <sched_yield_to+0x63>
+		e->env_priority--;
+f0107f33:	83 e8 01             	sub    $0x1,%eax
+f0107f36:	89 43 70             	mov    %eax,0x70(%ebx)
+	e->env_slice = curenv->env_slice;
+f0107f39:	e8 06 2d 00 00       	call   f010ac44 <cpunum>
+f0107f3e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107f44:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0107f4a:	8b 40 78             	mov    0x78(%eax),%eax
+f0107f4d:	89 43 78             	mov    %eax,0x78(%ebx)
+f0107f50:	0f 31                	rdtsc
+	e->env_runnable_since = read_tsc();
+f0107f52:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+f0107f58:	89 93 8c 00 00 00    	mov    %edx,0x8c(%ebx)
+	env_set_level(curenv, curenv->env_priority);
+f0107f5e:	e8 e1 2c 00 00       	call   f010ac44 <cpunum>
+f0107f63:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107f69:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0107f6f:	8b 70 70             	mov    0x70(%eax),%esi
+f0107f72:	e8 cd 2c 00 00       	call   f010ac44 <cpunum>
+f0107f77:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0107f7d:	8b 90 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%edx
+	e->env_priority = prio;
+f0107f83:	89 72 70             	mov    %esi,0x70(%edx)
+	e->env_slice = SCHED_QUANTUM(prio);
+f0107f86:	b8 01 00 00 00       	mov    $0x1,%eax
+f0107f8b:	89 f1                	mov    %esi,%ecx
+f0107f8d:	d3 e0                	shl    %cl,%eax
+f0107f8f:	89 42 78             	mov    %eax,0x78(%edx)
+	env_run(e);
+f0107f92:	83 ec 0c             	sub    $0xc,%esp
+f0107f95:	53                   	push   %ebx
+f0107f96:	e8 df ec ff ff       	call   f0106c7a <env_run>
+
+f0107f9b <sched_account_wait>:
+
+// Record how long e, which is about to be switched to, waited since it
+// last became ENV_RUNNABLE.
+void
+sched_account_wait(struct Env *e)
+{
+f0107f9b:	55                   	push   %ebp
+f0107f9c:	89 e5                	mov    %esp,%ebp
+f0107f9e:	57                   	push   %edi
+f0107f9f:	56                   	push   %esi
+f0107fa0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107fa3:	0f 31                	rdtsc
+	uint64_t cycles = read_tsc() - e->env_runnable_since;
+f0107fa5:	2b 81 88 00 00 00    	sub    0x88(%ecx),%eax
+f0107fab:	1b 91 8c 00 00 00    	sbb    0x8c(%ecx),%edx
+f0107fb1:	89 c6                	mov    %eax,%esi
+f0107fb3:	89 d7                	mov    %edx,%edi
+
+	hist_add(e->env_wait_hist, cycles);
+f0107fb5:	8d 81 90 00 00 00    	lea    0x90(%ecx),%eax
+f0107fbb:	89 f2                	mov    %esi,%edx
+f0107fbd:	89 f9                	mov    %edi,%ecx
+f0107fbf:	e8 e1 fc ff ff       	call   f0107ca5 <hist_add>
+	hist_add(sched_wait_hist, cycles);
+f0107fc4:	89 f2                	mov    %esi,%edx
+f0107fc6:	89 f9                	mov    %edi,%ecx
+f0107fc8:	b8 00 8a 61 f0       	mov    $0xf0618a00,%eax
+f0107fcd:	e8 d3 fc ff ff       	call   f0107ca5 <hist_add>
+}
+f0107fd2:	5e                   	pop    %esi
+f0107fd3:	5f                   	pop    %edi
+f0107fd4:	5d                   	pop    %ebp
+f0107fd5:	c3                   	ret
+
+f0107fd6 <sched_account_run>:
+
+// Record how long e, which is being switched away from, has run since
+// it was switched to.
+void
+sched_account_run(struct Env *e)
+{
+f0107fd6:	55                   	push   %ebp
+f0107fd7:	89 e5                	mov    %esp,%ebp
+f0107fd9:	57                   	push   %edi
+f0107fda:	56                   	push   %esi
+f0107fdb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107fde:	0f 31                	rdtsc
+	uint64_t cycles = read_tsc() - e->env_last_run;
+f0107fe0:	2b 41 7c             	sub    0x7c(%ecx),%eax
+f0107fe3:	1b 91 80 00 00 00    	sbb    0x80(%ecx),%edx
+f0107fe9:	89 c6                	mov    %eax,%esi
+f0107feb:	89 d7                	mov    %edx,%edi
+
+	hist_add(e->env_run_hist, cycles);
+f0107fed:	8d 81 e0 00 00 00    	lea    0xe0(%ecx),%eax
+f0107ff3:	89 f2                	mov    %esi,%edx
+f0107ff5:	89 f9                	mov    %edi,%ecx
+f0107ff7:	e8 a9 fc ff ff       	call   f0107ca5 <hist_add>
+	hist_add(sched_run_hist, cycles);
+f0107ffc:	89 f2                	mov    %esi,%edx
+f0107ffe:	89 f9                	mov    %edi,%ecx
+f0108000:	b8 a0 89 61 f0       	mov    $0xf06189a0,%eax
+f0108005:	e8 9b fc ff ff       	call   f0107ca5 <hist_add>
+}
+f010800a:	5e                   	pop    %esi
+f010800b:	5f                   	pop    %edi
+f010800c:	5d                   	pop    %ebp
+f010800d:	c3                   	ret
+
+f010800e <sched_set_priority>:
+
+// Pin e at level prio, or hand it back to the feedback scheduler at
+// the top level if prio is ENV_PRIO_DYNAMIC.
+void
+sched_set_priority(struct Env *e, int prio)
+{
+f010800e:	55                   	push   %ebp
+f010800f:	89 e5                	mov    %esp,%ebp
+f0108011:	57                   	push   %edi
+f0108012:	56                   	push   %esi
+f0108013:	53                   	push   %ebx
+f0108014:	83 ec 0c             	sub    $0xc,%esp
+f0108017:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010801a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int cpu = e->env_rq_cpu;
+f010801d:	8b 73 6c             	mov    0x6c(%ebx),%esi
+
+	if (cpu >= 0)
+f0108020:	85 f6                	test   %esi,%esi
+f0108022:	79 1a                	jns    f010803e <sched_set_priority+0x30>
+		runq_remove(e);
+
+	e->env_prio_pinned = (prio != ENV_PRIO_DYNAMIC);
+f0108024:	83 ff ff             	cmp    $0xffffffff,%edi
+f0108027:	0f 95 43 74          	setne  0x74(%ebx)
+	env_set_level(e, e->env_prio_pinned ? prio : ENV_PRIO_HIGHEST);
+f010802b:	74 58                	je     f0108085 <sched_set_priority+0x77>
+	e->env_priority = prio;
+f010802d:	89 7b 70             	mov    %edi,0x70(%ebx)
+	e->env_slice = SCHED_QUANTUM(prio);
+f0108030:	b8 01 00 00 00       	mov    $0x1,%eax
+f0108035:	89 f9                	mov    %edi,%ecx
+f0108037:	d3 e0                	shl    %cl,%eax
+f0108039:	89 43 78             	mov    %eax,0x78(%ebx)
+
+	if (cpu >= 0)
+f010803c:	eb 34                	jmp    f0108072 <sched_set_priority+0x64>
+		runq_remove(e);
+f010803e:	89 d8                	mov    %ebx,%eax
+f0108040:	e8 ef fb ff ff       	call   f0107c34 <runq_remove>
+	e->env_prio_pinned = (prio != ENV_PRIO_DYNAMIC);
+f0108045:	83 ff ff             	cmp    $0xffffffff,%edi
+f0108048:	0f 95 c2             	setne  %dl
+	env_set_level(e, e->env_prio_pinned ? prio : ENV_PRIO_HIGHEST);
+f010804b:	75 2d                	jne    f010807a <sched_set_priority+0x6c>
+f010804d:	bf 00 00 00 00       	mov    $0x0,%edi
+f0108052:	b8 01 00 00 00       	mov    $0x1,%eax
+	e->env_prio_pinned = (prio != ENV_PRIO_DYNAMIC);
+f0108057:	88 53 74             	mov    %dl,0x74(%ebx)
+	e->env_priority = prio;
+f010805a:	89 7b 70             	mov    %edi,0x70(%ebx)
+	e->env_slice = SCHED_QUANTUM(prio);
+f010805d:	89 43 78             	mov    %eax,0x78(%ebx)
+		runq_push(&cpus[cpu], e);
+f0108060:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+f0108066:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f010806b:	89 da                	mov    %ebx,%edx
+f010806d:	e8 79 fb ff ff       	call   f0107beb <runq_push>
+}
+f0108072:	83 c4 0c             	add    $0xc,%esp
+f0108075:	5b                   	pop    %ebx
+f0108076:	5e                   	pop    %esi
+f0108077:	5f                   	pop    %edi
+f0108078:	5d                   	pop    %ebp
+f0108079:	c3                   	ret
+	e->env_slice = SCHED_QUANTUM(prio);
+f010807a:	b8 01 00 00 00       	mov    $0x1,%eax
+f010807f:	89 f9                	mov    %edi,%ecx
+f0108081:	d3 e0                	shl    %cl,%eax
+	if (cpu >= 0)
+f0108083:	eb d2                	jmp    f0108057 <sched_set_priority+0x49>
+	e->env_priority = prio;
+f0108085:	c7 43 70 00 00 00 00 	movl   $0x0,0x70(%ebx)
+	e->env_slice = SCHED_QUANTUM(prio);
+f010808c:	c7 43 78 01 00 00 00 	movl   $0x1,0x78(%ebx)
+	if (cpu >= 0)
+f0108093:	eb dd                	jmp    f0108072 <sched_set_priority+0x64>
+
+f0108095 <sched_yield_is_noop>:
+// queued on this CPU?  Safe to call without the big kernel lock, in
+// which case the answer is only a hint: an environment queued here
+// concurrently will get its turn at the next timer tick.
+bool
+sched_yield_is_noop(void)
+{
+f0108095:	55                   	push   %ebp
+f0108096:	89 e5                	mov    %esp,%ebp
+f0108098:	53                   	push   %ebx
+f0108099:	83 ec 04             	sub    $0x4,%esp
+	return curenv && curenv->env_status == ENV_RUNNING &&
+f010809c:	e8 a3 2b 00 00       	call   f010ac44 <cpunum>
+f01080a1:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+		thiscpu->cpu_runq.rq_len == 0 && cpu_allowed(curenv, thiscpu);
+f01080a7:	b8 00 00 00 00       	mov    $0x0,%eax
+f01080ac:	83 ba 28 90 61 f0 00 	cmpl   $0x0,-0xf9e6fd8(%edx)
+f01080b3:	74 1c                	je     f01080d1 <sched_yield_is_noop+0x3c>
+	return curenv && curenv->env_status == ENV_RUNNING &&
+f01080b5:	e8 8a 2b 00 00       	call   f010ac44 <cpunum>
+f01080ba:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01080c0:	8b 90 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%edx
+		thiscpu->cpu_runq.rq_len == 0 && cpu_allowed(curenv, thiscpu);
+f01080c6:	b8 00 00 00 00       	mov    $0x0,%eax
+	return curenv && curenv->env_status == ENV_RUNNING &&
+f01080cb:	83 7a 58 03          	cmpl   $0x3,0x58(%edx)
+f01080cf:	74 08                	je     f01080d9 <sched_yield_is_noop+0x44>
+		thiscpu->cpu_runq.rq_len == 0 && cpu_allowed(curenv, thiscpu);
+f01080d1:	83 e0 01             	and    $0x1,%eax
+}
+f01080d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01080d7:	c9                   	leave
+f01080d8:	c3                   	ret
+		thiscpu->cpu_runq.rq_len == 0 && cpu_allowed(curenv, thiscpu);
+f01080d9:	e8 66 2b 00 00       	call   f010ac44 <cpunum>
+f01080de:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+f01080e4:	b8 00 00 00 00       	mov    $0x0,%eax
+	return curenv && curenv->env_status == ENV_RUNNING &&
+f01080e9:	83 ba b4 90 61 f0 00 	cmpl   $0x0,-0xf9e6f4c(%edx)
+f01080f0:	75 df                	jne    f01080d1 <sched_yield_is_noop+0x3c>
+		thiscpu->cpu_runq.rq_len == 0 && cpu_allowed(curenv, thiscpu);
+f01080f2:	e8 4d 2b 00 00       	call   f010ac44 <cpunum>
+f01080f7:	89 c3                	mov    %eax,%ebx
+f01080f9:	e8 46 2b 00 00       	call   f010ac44 <cpunum>
+f01080fe:	69 d3 bc 00 00 00    	imul   $0xbc,%ebx,%edx
+f0108104:	81 c2 20 90 61 f0    	add    $0xf0619020,%edx
+f010810a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108110:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0108116:	e8 b4 fa ff ff       	call   f0107bcf <cpu_allowed>
+f010811b:	0f b6 c0             	movzbl %al,%eax
+f010811e:	eb b1                	jmp    f01080d1 <sched_yield_is_noop+0x3c>
+
+f0108120 <sched_halt>:
+// Halt this CPU when there is nothing to do. Wait until the
+// timer interrupt wakes it up. This function never returns.
+//
+void
+sched_halt(void)
+{
+f0108120:	55                   	push   %ebp
+f0108121:	89 e5                	mov    %esp,%ebp
+f0108123:	53                   	push   %ebx
+f0108124:	83 ec 04             	sub    $0x4,%esp
+	// For debugging and testing purposes, if there are no runnable
+	// environments in the system, then drop into the kernel monitor.
+	// Runnable environments are on some CPU's run queue, and running
+	// or dying ones are some other CPU's cpu_env, so it's enough to
+	// look at each CPU.
+	for (c = cpus; c < cpus + ncpu; c++) {
+f0108127:	bb 20 90 61 f0       	mov    $0xf0619020,%ebx
+f010812c:	eb 06                	jmp    f0108134 <sched_halt+0x14>
+f010812e:	81 c3 bc 00 00 00    	add    $0xbc,%ebx
+f0108134:	69 05 04 96 61 f0 bc 	imul   $0xbc,0xf0619604,%eax
+f010813b:	00 00 00 
+f010813e:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f0108143:	39 c3                	cmp    %eax,%ebx
+f0108145:	73 23                	jae    f010816a <sched_halt+0x4a>
+		if (c->cpu_runq.rq_len)
+f0108147:	83 bb 94 00 00 00 00 	cmpl   $0x0,0x94(%ebx)
+f010814e:	75 31                	jne    f0108181 <sched_halt+0x61>
+			break;
+		if (c != thiscpu && c->cpu_env)
+f0108150:	e8 ef 2a 00 00       	call   f010ac44 <cpunum>
+f0108155:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010815b:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f0108160:	39 c3                	cmp    %eax,%ebx
+f0108162:	74 ca                	je     f010812e <sched_halt+0xe>
+f0108164:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+f0108168:	74 c4                	je     f010812e <sched_halt+0xe>
+			break;
+	}
+	if (c == cpus + ncpu) {
+f010816a:	69 05 04 96 61 f0 bc 	imul   $0xbc,0xf0619604,%eax
+f0108171:	00 00 00 
+f0108174:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f0108179:	39 c3                	cmp    %eax,%ebx
+f010817b:	0f 84 e9 00 00 00    	je     f010826a <sched_halt+0x14a>
+		while (1)
+			monitor(NULL);
+	}
+
+	// Mark that no environment is running on this CPU
+	if (curenv)
+f0108181:	e8 be 2a 00 00       	call   f010ac44 <cpunum>
+f0108186:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010818c:	83 b8 28 90 61 f0 00 	cmpl   $0x0,-0xf9e6fd8(%eax)
+f0108193:	74 1c                	je     f01081b1 <sched_halt+0x91>
+		sched_account_run(curenv);
+f0108195:	e8 aa 2a 00 00       	call   f010ac44 <cpunum>
+f010819a:	83 ec 0c             	sub    $0xc,%esp
+f010819d:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01081a3:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f01081a9:	e8 28 fe ff ff       	call   f0107fd6 <sched_account_run>
+f01081ae:	83 c4 10             	add    $0x10,%esp
+	curenv = NULL;
+f01081b1:	e8 8e 2a 00 00       	call   f010ac44 <cpunum>
+f01081b6:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01081bc:	c7 80 28 90 61 f0 00 	movl   $0x0,-0xf9e6fd8(%eax)
+f01081c3:	00 00 00 
+	lcr3(PADDR(kern_pgdir));
+f01081c6:	a1 7c 89 61 f0       	mov    0xf061897c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01081cb:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01081d0:	0f 86 b3 00 00 00    	jbe    f0108289 <sched_halt+0x169>
+	return (physaddr_t)kva - KERNBASE;
+f01081d6:	05 00 00 00 10       	add    $0x10000000,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f01081db:	0f 22 d8             	mov    %eax,%cr3
+
+	// Go tickless: nothing in the kernel needs this CPU to wake up at
+	// a particular time, and whoever gives it work sends it an
+	// IRQ_WAKEUP (see sched_kick).  The boot CPU keeps its tick
+	// because it keeps the time for sys_time_msec.
+	if (thiscpu != bootcpu)
+f01081de:	e8 61 2a 00 00       	call   f010ac44 <cpunum>
+f01081e3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01081e9:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f01081ee:	39 05 00 96 61 f0    	cmp    %eax,0xf0619600
+f01081f4:	74 05                	je     f01081fb <sched_halt+0xdb>
+		lapic_timer_stop();
+f01081f6:	e8 23 2a 00 00       	call   f010ac1e <lapic_timer_stop>
+
+	// Mark that this CPU is in the HALT state, so that when
+	// timer interupts come in, we know we should re-acquire the
+	// big kernel lock
+	xchg(&thiscpu->cpu_status, CPU_HALTED);
+f01081fb:	e8 44 2a 00 00       	call   f010ac44 <cpunum>
+f0108200:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+f0108206:	83 c2 04             	add    $0x4,%edx
+	asm volatile("lock; xchgl %0, %1" :
+f0108209:	b8 02 00 00 00       	mov    $0x2,%eax
+f010820e:	f0 87 82 20 90 61 f0 	lock xchg %eax,-0xf9e6fe0(%edx)
+	spin_unlock(&kernel_lock);
+f0108215:	83 ec 0c             	sub    $0xc,%esp
+f0108218:	68 c0 95 11 f0       	push   $0xf01195c0
+f010821d:	e8 cd 2d 00 00       	call   f010afef <spin_unlock>
+	asm volatile("pause");
+f0108222:	f3 90                	pause
+
+	// Release the big kernel lock as if we were "leaving" the kernel
+	unlock_kernel();
+	tlb_shootdown();
+f0108224:	e8 1d ae ff ff       	call   f0103046 <tlb_shootdown>
+
+	// Put the idle time to use.  Work handed to this CPU meanwhile
+	// raises an IRQ_WAKEUP, which is taken as soon as we sti below.
+	page_zero_fill();
+f0108229:	e8 48 a2 ff ff       	call   f0102476 <page_zero_fill>
+	ksm_scan();
+f010822e:	e8 3e d7 ff ff       	call   f0105971 <ksm_scan>
+		"pushl $0\n"
+		"sti\n"
+		"1:\n"
+		"hlt\n"
+		"jmp 1b\n"
+	: : "a" (thiscpu->cpu_ts.ts_esp0));
+f0108233:	e8 0c 2a 00 00       	call   f010ac44 <cpunum>
+f0108238:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+	asm volatile (
+f010823e:	8b 80 30 90 61 f0    	mov    -0xf9e6fd0(%eax),%eax
+f0108244:	bd 00 00 00 00       	mov    $0x0,%ebp
+f0108249:	89 c4                	mov    %eax,%esp
+f010824b:	6a 00                	push   $0x0
+f010824d:	6a 00                	push   $0x0
+f010824f:	fb                   	sti
+f0108250:	f4                   	hlt
+f0108251:	eb fd                	jmp    f0108250 <sched_halt+0x130>
+	panic("sched_halt: hlt loop exited");  /* mostly to placate the compiler */
+f0108253:	83 c4 0c             	add    $0xc,%esp
+f0108256:	68 c2 e2 10 f0       	push   $0xf010e2c2
+f010825b:	68 d6 01 00 00       	push   $0x1d6
+f0108260:	68 b5 e2 10 f0       	push   $0xf010e2b5
+f0108265:	e8 2e 7e ff ff       	call   f0100098 <_panic>
+		cprintf("No runnable environments in the system!\n");
+f010826a:	83 ec 0c             	sub    $0xc,%esp
+f010826d:	68 30 e3 10 f0       	push   $0xf010e330
+f0108272:	e8 85 ed ff ff       	call   f0106ffc <cprintf>
+f0108277:	83 c4 10             	add    $0x10,%esp
+			monitor(NULL);
+f010827a:	83 ec 0c             	sub    $0xc,%esp
+f010827d:	6a 00                	push   $0x0
+f010827f:	e8 95 91 ff ff       	call   f0101419 <monitor>
+f0108284:	83 c4 10             	add    $0x10,%esp
+f0108287:	eb f1                	jmp    f010827a <sched_halt+0x15a>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0108289:	50                   	push   %eax
+f010828a:	68 e8 cc 10 f0       	push   $0xf010cce8
+f010828f:	68 b4 01 00 00       	push   $0x1b4
+f0108294:	68 b5 e2 10 f0       	push   $0xf010e2b5
+f0108299:	e8 fa 7d ff ff       	call   f0100098 <_panic>
+
+f010829e <sched_yield>:
+{
+f010829e:	55                   	push   %ebp
+f010829f:	89 e5                	mov    %esp,%ebp
+f01082a1:	57                   	push   %edi
+f01082a2:	56                   	push   %esi
+f01082a3:	53                   	push   %ebx
+f01082a4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((e = runq_first(&thiscpu->cpu_runq, NENVPRIO))) {
+f01082a7:	e8 98 29 00 00       	call   f010ac44 <cpunum>
+	for (prio = ENV_PRIO_HIGHEST; prio < below; prio++)
+f01082ac:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01082b2:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (rq->rq_head[prio])
+f01082b7:	8b 9c 90 94 90 61 f0 	mov    -0xf9e6f6c(%eax,%edx,4),%ebx
+f01082be:	85 db                	test   %ebx,%ebx
+f01082c0:	0f 85 bf 01 00 00    	jne    f0108485 <sched_yield+0x1e7>
+	for (prio = ENV_PRIO_HIGHEST; prio < below; prio++)
+f01082c6:	83 c2 01             	add    $0x1,%edx
+f01082c9:	83 fa 04             	cmp    $0x4,%edx
+f01082cc:	75 e9                	jne    f01082b7 <sched_yield+0x19>
+	if (curenv && curenv->env_status == ENV_RUNNING) {
+f01082ce:	e8 71 29 00 00       	call   f010ac44 <cpunum>
+f01082d3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01082d9:	83 b8 28 90 61 f0 00 	cmpl   $0x0,-0xf9e6fd8(%eax)
+f01082e0:	74 17                	je     f01082f9 <sched_yield+0x5b>
+f01082e2:	e8 5d 29 00 00       	call   f010ac44 <cpunum>
+f01082e7:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01082ed:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01082f3:	83 78 58 03          	cmpl   $0x3,0x58(%eax)
+f01082f7:	74 15                	je     f010830e <sched_yield+0x70>
+			victim = c;
+f01082f9:	89 de                	mov    %ebx,%esi
+f01082fb:	bf 20 90 61 f0       	mov    $0xf0619020,%edi
+f0108300:	e9 90 00 00 00       	jmp    f0108395 <sched_yield+0xf7>
+		env_run(e);
+f0108305:	83 ec 0c             	sub    $0xc,%esp
+f0108308:	53                   	push   %ebx
+f0108309:	e8 6c e9 ff ff       	call   f0106c7a <env_run>
+		if (cpu_allowed(curenv, thiscpu))
+f010830e:	e8 31 29 00 00       	call   f010ac44 <cpunum>
+f0108313:	89 c6                	mov    %eax,%esi
+f0108315:	e8 2a 29 00 00       	call   f010ac44 <cpunum>
+f010831a:	69 d6 bc 00 00 00    	imul   $0xbc,%esi,%edx
+f0108320:	81 c2 20 90 61 f0    	add    $0xf0619020,%edx
+f0108326:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010832c:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0108332:	e8 98 f8 ff ff       	call   f0107bcf <cpu_allowed>
+f0108337:	84 c0                	test   %al,%al
+f0108339:	74 19                	je     f0108354 <sched_yield+0xb6>
+			env_run(curenv);
+f010833b:	e8 04 29 00 00       	call   f010ac44 <cpunum>
+f0108340:	83 ec 0c             	sub    $0xc,%esp
+f0108343:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108349:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f010834f:	e8 26 e9 ff ff       	call   f0106c7a <env_run>
+		curenv->env_status = ENV_RUNNABLE;
+f0108354:	e8 eb 28 00 00       	call   f010ac44 <cpunum>
+f0108359:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010835f:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0108365:	c7 40 58 02 00 00 00 	movl   $0x2,0x58(%eax)
+		sched_enqueue(curenv);
+f010836c:	e8 d3 28 00 00       	call   f010ac44 <cpunum>
+f0108371:	83 ec 0c             	sub    $0xc,%esp
+f0108374:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010837a:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0108380:	e8 6f f9 ff ff       	call   f0107cf4 <sched_enqueue>
+f0108385:	83 c4 10             	add    $0x10,%esp
+f0108388:	e9 6c ff ff ff       	jmp    f01082f9 <sched_yield+0x5b>
+			victim = c;
+f010838d:	89 fe                	mov    %edi,%esi
+	for (c = cpus; c < cpus + ncpu; c++) {
+f010838f:	81 c7 bc 00 00 00    	add    $0xbc,%edi
+f0108395:	69 05 04 96 61 f0 bc 	imul   $0xbc,0xf0619604,%eax
+f010839c:	00 00 00 
+f010839f:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f01083a4:	39 c7                	cmp    %eax,%edi
+f01083a6:	73 2e                	jae    f01083d6 <sched_yield+0x138>
+		if (c == thiscpu || !c->cpu_runq.rq_len)
+f01083a8:	e8 97 28 00 00       	call   f010ac44 <cpunum>
+f01083ad:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01083b3:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f01083b8:	39 c7                	cmp    %eax,%edi
+f01083ba:	74 d3                	je     f010838f <sched_yield+0xf1>
+f01083bc:	8b 87 94 00 00 00    	mov    0x94(%edi),%eax
+f01083c2:	85 c0                	test   %eax,%eax
+f01083c4:	74 c9                	je     f010838f <sched_yield+0xf1>
+		if (!victim || c->cpu_runq.rq_len > victim->cpu_runq.rq_len)
+f01083c6:	85 f6                	test   %esi,%esi
+f01083c8:	74 c3                	je     f010838d <sched_yield+0xef>
+f01083ca:	3b 86 94 00 00 00    	cmp    0x94(%esi),%eax
+f01083d0:	7e bd                	jle    f010838f <sched_yield+0xf1>
+			victim = c;
+f01083d2:	89 fe                	mov    %edi,%esi
+f01083d4:	eb b9                	jmp    f010838f <sched_yield+0xf1>
+	if (!victim)
+f01083d6:	85 f6                	test   %esi,%esi
+f01083d8:	0f 84 a2 00 00 00    	je     f0108480 <sched_yield+0x1e2>
+f01083de:	8d 46 74             	lea    0x74(%esi),%eax
+f01083e1:	8d 8e 84 00 00 00    	lea    0x84(%esi),%ecx
+f01083e7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	n = 0;
+f01083ea:	bf 00 00 00 00       	mov    $0x0,%edi
+f01083ef:	89 75 dc             	mov    %esi,-0x24(%ebp)
+f01083f2:	eb 4e                	jmp    f0108442 <sched_yield+0x1a4>
+			if (!best || e->env_last_run < best->env_last_run)
+f01083f4:	8b 86 80 00 00 00    	mov    0x80(%esi),%eax
+f01083fa:	8b 4b 7c             	mov    0x7c(%ebx),%ecx
+f01083fd:	39 4e 7c             	cmp    %ecx,0x7c(%esi)
+f0108400:	1b 83 80 00 00 00    	sbb    0x80(%ebx),%eax
+				best = e;
+f0108406:	0f 42 de             	cmovb  %esi,%ebx
+		for (; e && n < SCHED_STEAL_SCAN; e = e->env_rq_next, n++) {
+f0108409:	8b 76 64             	mov    0x64(%esi),%esi
+f010840c:	83 c7 01             	add    $0x1,%edi
+f010840f:	85 f6                	test   %esi,%esi
+f0108411:	74 29                	je     f010843c <sched_yield+0x19e>
+f0108413:	83 ff 07             	cmp    $0x7,%edi
+f0108416:	7f 24                	jg     f010843c <sched_yield+0x19e>
+			if (!cpu_allowed(e, thiscpu))
+f0108418:	e8 27 28 00 00       	call   f010ac44 <cpunum>
+f010841d:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+f0108423:	81 c2 20 90 61 f0    	add    $0xf0619020,%edx
+f0108429:	89 f0                	mov    %esi,%eax
+f010842b:	e8 9f f7 ff ff       	call   f0107bcf <cpu_allowed>
+f0108430:	84 c0                	test   %al,%al
+f0108432:	74 d5                	je     f0108409 <sched_yield+0x16b>
+			if (!best || e->env_last_run < best->env_last_run)
+f0108434:	85 db                	test   %ebx,%ebx
+f0108436:	75 bc                	jne    f01083f4 <sched_yield+0x156>
+				best = e;
+f0108438:	89 f3                	mov    %esi,%ebx
+f010843a:	eb cd                	jmp    f0108409 <sched_yield+0x16b>
+f010843c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+	for (prio = ENV_PRIO_HIGHEST; prio < NENVPRIO; prio++) {
+f010843f:	83 c0 04             	add    $0x4,%eax
+f0108442:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0108445:	39 c8                	cmp    %ecx,%eax
+f0108447:	74 07                	je     f0108450 <sched_yield+0x1b2>
+		e = victim->cpu_runq.rq_head[prio];
+f0108449:	8b 30                	mov    (%eax),%esi
+		for (; e && n < SCHED_STEAL_SCAN; e = e->env_rq_next, n++) {
+f010844b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010844e:	eb bf                	jmp    f010840f <sched_yield+0x171>
+	if (!best)
+f0108450:	8b 75 dc             	mov    -0x24(%ebp),%esi
+f0108453:	85 db                	test   %ebx,%ebx
+f0108455:	74 29                	je     f0108480 <sched_yield+0x1e2>
+	runq_remove(best);
+f0108457:	89 d8                	mov    %ebx,%eax
+f0108459:	e8 d6 f7 ff ff       	call   f0107c34 <runq_remove>
+	victim->cpu_stolen++;
+f010845e:	83 86 a0 00 00 00 01 	addl   $0x1,0xa0(%esi)
+	thiscpu->cpu_steals++;
+f0108465:	e8 da 27 00 00       	call   f010ac44 <cpunum>
+f010846a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108470:	83 80 bc 90 61 f0 01 	addl   $0x1,-0xf9e6f44(%eax)
+		env_run(e);
+f0108477:	83 ec 0c             	sub    $0xc,%esp
+f010847a:	53                   	push   %ebx
+f010847b:	e8 fa e7 ff ff       	call   f0106c7a <env_run>
+	sched_halt();
+f0108480:	e8 9b fc ff ff       	call   f0108120 <sched_halt>
+		assert(e->env_status == ENV_RUNNABLE);
+f0108485:	83 7b 58 02          	cmpl   $0x2,0x58(%ebx)
+f0108489:	0f 84 76 fe ff ff    	je     f0108305 <sched_yield+0x67>
+f010848f:	68 de e2 10 f0       	push   $0xf010e2de
+f0108494:	68 0d d8 10 f0       	push   $0xf010d80d
+f0108499:	68 81 01 00 00       	push   $0x181
+f010849e:	68 b5 e2 10 f0       	push   $0xf010e2b5
+f01084a3:	e8 f0 7b ff ff       	call   f0100098 <_panic>
+
+f01084a8 <sched_tick>:
+{
+f01084a8:	55                   	push   %ebp
+f01084a9:	89 e5                	mov    %esp,%ebp
+f01084ab:	57                   	push   %edi
+f01084ac:	56                   	push   %esi
+f01084ad:	53                   	push   %ebx
+f01084ae:	83 ec 1c             	sub    $0x1c,%esp
+	struct RunQueue *rq = &thiscpu->cpu_runq;
+f01084b1:	e8 8e 27 00 00       	call   f010ac44 <cpunum>
+f01084b6:	89 c7                	mov    %eax,%edi
+	struct Env *e = curenv;
+f01084b8:	e8 87 27 00 00       	call   f010ac44 <cpunum>
+f01084bd:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01084c3:	8b b0 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%esi
+	if (++rq->rq_ticks >= SCHED_BOOST_TICKS) {
+f01084c9:	69 c7 bc 00 00 00    	imul   $0xbc,%edi,%eax
+f01084cf:	8b 80 b8 90 61 f0    	mov    -0xf9e6f48(%eax),%eax
+f01084d5:	83 c0 01             	add    $0x1,%eax
+f01084d8:	83 f8 63             	cmp    $0x63,%eax
+f01084db:	77 58                	ja     f0108535 <sched_tick+0x8d>
+f01084dd:	69 d7 bc 00 00 00    	imul   $0xbc,%edi,%edx
+f01084e3:	89 82 b8 90 61 f0    	mov    %eax,-0xf9e6f48(%edx)
+	if (!e || e->env_status != ENV_RUNNING)
+f01084e9:	85 f6                	test   %esi,%esi
+f01084eb:	0f 84 1f 01 00 00    	je     f0108610 <sched_tick+0x168>
+f01084f1:	83 7e 58 03          	cmpl   $0x3,0x58(%esi)
+f01084f5:	0f 85 15 01 00 00    	jne    f0108610 <sched_tick+0x168>
+	if (--e->env_slice > 0) {
+f01084fb:	8b 46 78             	mov    0x78(%esi),%eax
+f01084fe:	83 e8 01             	sub    $0x1,%eax
+f0108501:	89 46 78             	mov    %eax,0x78(%esi)
+f0108504:	85 c0                	test   %eax,%eax
+f0108506:	0f 8e 09 01 00 00    	jle    f0108615 <sched_tick+0x16d>
+		if (!runq_first(rq, e->env_priority) && cpu_allowed(e, thiscpu))
+f010850c:	8b 56 70             	mov    0x70(%esi),%edx
+	for (prio = ENV_PRIO_HIGHEST; prio < below; prio++)
+f010850f:	69 ff bc 00 00 00    	imul   $0xbc,%edi,%edi
+f0108515:	b8 00 00 00 00       	mov    $0x0,%eax
+f010851a:	39 c2                	cmp    %eax,%edx
+f010851c:	0f 8e 25 01 00 00    	jle    f0108647 <sched_tick+0x19f>
+		if (rq->rq_head[prio])
+f0108522:	83 bc 87 94 90 61 f0 	cmpl   $0x0,-0xf9e6f6c(%edi,%eax,4)
+f0108529:	00 
+f010852a:	0f 85 00 01 00 00    	jne    f0108630 <sched_tick+0x188>
+	for (prio = ENV_PRIO_HIGHEST; prio < below; prio++)
+f0108530:	83 c0 01             	add    $0x1,%eax
+f0108533:	eb e5                	jmp    f010851a <sched_tick+0x72>
+		rq->rq_ticks = 0;
+f0108535:	69 c7 bc 00 00 00    	imul   $0xbc,%edi,%eax
+f010853b:	c7 80 b8 90 61 f0 00 	movl   $0x0,-0xf9e6f48(%eax)
+f0108542:	00 00 00 
+	struct RunQueue *rq = &thiscpu->cpu_runq;
+f0108545:	e8 fa 26 00 00       	call   f010ac44 <cpunum>
+	for (prio = ENV_PRIO_HIGHEST + 1; prio < NENVPRIO; prio++) {
+f010854a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108550:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0108553:	ba 01 00 00 00       	mov    $0x1,%edx
+f0108558:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f010855b:	89 75 dc             	mov    %esi,-0x24(%ebp)
+f010855e:	89 d6                	mov    %edx,%esi
+f0108560:	eb 45                	jmp    f01085a7 <sched_tick+0xff>
+f0108562:	89 fb                	mov    %edi,%ebx
+		for (e = rq->rq_head[prio]; e; e = next) {
+f0108564:	85 db                	test   %ebx,%ebx
+f0108566:	74 37                	je     f010859f <sched_tick+0xf7>
+			next = e->env_rq_next;
+f0108568:	8b 7b 64             	mov    0x64(%ebx),%edi
+			if (e->env_prio_pinned)
+f010856b:	80 7b 74 00          	cmpb   $0x0,0x74(%ebx)
+f010856f:	75 f1                	jne    f0108562 <sched_tick+0xba>
+			runq_remove(e);
+f0108571:	89 d8                	mov    %ebx,%eax
+f0108573:	e8 bc f6 ff ff       	call   f0107c34 <runq_remove>
+	e->env_priority = prio;
+f0108578:	c7 43 70 00 00 00 00 	movl   $0x0,0x70(%ebx)
+	e->env_slice = SCHED_QUANTUM(prio);
+f010857f:	c7 43 78 01 00 00 00 	movl   $0x1,0x78(%ebx)
+			runq_push(thiscpu, e);
+f0108586:	e8 b9 26 00 00       	call   f010ac44 <cpunum>
+f010858b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108591:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f0108596:	89 da                	mov    %ebx,%edx
+f0108598:	e8 4e f6 ff ff       	call   f0107beb <runq_push>
+f010859d:	eb c3                	jmp    f0108562 <sched_tick+0xba>
+	for (prio = ENV_PRIO_HIGHEST + 1; prio < NENVPRIO; prio++) {
+f010859f:	83 c6 01             	add    $0x1,%esi
+f01085a2:	83 fe 04             	cmp    $0x4,%esi
+f01085a5:	74 0c                	je     f01085b3 <sched_tick+0x10b>
+		for (e = rq->rq_head[prio]; e; e = next) {
+f01085a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01085aa:	8b 9c b0 94 90 61 f0 	mov    -0xf9e6f6c(%eax,%esi,4),%ebx
+f01085b1:	eb b1                	jmp    f0108564 <sched_tick+0xbc>
+	if (curenv && !curenv->env_prio_pinned)
+f01085b3:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f01085b6:	8b 75 dc             	mov    -0x24(%ebp),%esi
+f01085b9:	e8 86 26 00 00       	call   f010ac44 <cpunum>
+f01085be:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01085c4:	83 b8 28 90 61 f0 00 	cmpl   $0x0,-0xf9e6fd8(%eax)
+f01085cb:	0f 84 18 ff ff ff    	je     f01084e9 <sched_tick+0x41>
+f01085d1:	e8 6e 26 00 00       	call   f010ac44 <cpunum>
+f01085d6:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01085dc:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01085e2:	80 78 74 00          	cmpb   $0x0,0x74(%eax)
+f01085e6:	0f 85 fd fe ff ff    	jne    f01084e9 <sched_tick+0x41>
+		env_set_level(curenv, ENV_PRIO_HIGHEST);
+f01085ec:	e8 53 26 00 00       	call   f010ac44 <cpunum>
+f01085f1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01085f7:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+	e->env_priority = prio;
+f01085fd:	c7 40 70 00 00 00 00 	movl   $0x0,0x70(%eax)
+	e->env_slice = SCHED_QUANTUM(prio);
+f0108604:	c7 40 78 01 00 00 00 	movl   $0x1,0x78(%eax)
+}
+f010860b:	e9 d9 fe ff ff       	jmp    f01084e9 <sched_tick+0x41>
+		sched_yield();
+f0108610:	e8 89 fc ff ff       	call   f010829e <sched_yield>
+	} else if (!e->env_prio_pinned && e->env_priority < ENV_PRIO_LOWEST)
+f0108615:	80 7e 74 00          	cmpb   $0x0,0x74(%esi)
+f0108619:	75 08                	jne    f0108623 <sched_tick+0x17b>
+f010861b:	8b 4e 70             	mov    0x70(%esi),%ecx
+f010861e:	83 f9 02             	cmp    $0x2,%ecx
+f0108621:	7e 12                	jle    f0108635 <sched_tick+0x18d>
+	e->env_slice = SCHED_QUANTUM(prio);
+f0108623:	8b 4e 70             	mov    0x70(%esi),%ecx
+f0108626:	b8 01 00 00 00       	mov    $0x1,%eax
+f010862b:	d3 e0                	shl    %cl,%eax
+f010862d:	89 46 78             	mov    %eax,0x78(%esi)
+	sched_yield();
+f0108630:	e8 69 fc ff ff       	call   f010829e <sched_yield>
+		env_set_level(e, e->env_priority + 1);
+f0108635:	83 c1 01             	add    $0x1,%ecx
+	e->env_priority = prio;
+f0108638:	89 4e 70             	mov    %ecx,0x70(%esi)
+	e->env_slice = SCHED_QUANTUM(prio);
+f010863b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0108640:	d3 e0                	shl    %cl,%eax
+f0108642:	89 46 78             	mov    %eax,0x78(%esi)
+}
+f0108645:	eb e9                	jmp    f0108630 <sched_tick+0x188>
+		if (!runq_first(rq, e->env_priority) && cpu_allowed(e, thiscpu))
+f0108647:	e8 f8 25 00 00       	call   f010ac44 <cpunum>
+f010864c:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+f0108652:	81 c2 20 90 61 f0    	add    $0xf0619020,%edx
+f0108658:	89 f0                	mov    %esi,%eax
+f010865a:	e8 70 f5 ff ff       	call   f0107bcf <cpu_allowed>
+f010865f:	84 c0                	test   %al,%al
+f0108661:	74 cd                	je     f0108630 <sched_tick+0x188>
+}
+f0108663:	83 c4 1c             	add    $0x1c,%esp
+f0108666:	5b                   	pop    %ebx
+f0108667:	5e                   	pop    %esi
+f0108668:	5f                   	pop    %edi
+f0108669:	5d                   	pop    %ebp
+f010866a:	c3                   	ret
+
+f010866b <page_range_ok>:
+
+// Check that [va, va + npages * PGSIZE) is page-aligned and below UTOP.
+static bool
+page_range_ok(void *va, size_t npages)
+{
+	return PTE_ADDR(va) == (uintptr_t) va && (uintptr_t) va <= UTOP
+f010866b:	a9 ff 0f 00 00       	test   $0xfff,%eax
+f0108670:	75 07                	jne    f0108679 <page_range_ok+0xe>
+f0108672:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+f0108677:	76 09                	jbe    f0108682 <page_range_ok+0x17>
+		&& npages <= (UTOP - (uintptr_t) va) / PGSIZE;
+f0108679:	b8 00 00 00 00       	mov    $0x0,%eax
+f010867e:	83 e0 01             	and    $0x1,%eax
+}
+f0108681:	c3                   	ret
+		&& npages <= (UTOP - (uintptr_t) va) / PGSIZE;
+f0108682:	b9 00 00 c0 ee       	mov    $0xeec00000,%ecx
+f0108687:	29 c1                	sub    %eax,%ecx
+f0108689:	89 c8                	mov    %ecx,%eax
+f010868b:	c1 e8 0c             	shr    $0xc,%eax
+f010868e:	39 d0                	cmp    %edx,%eax
+f0108690:	0f 93 c0             	setae  %al
+f0108693:	0f b6 c0             	movzbl %al,%eax
+f0108696:	eb e6                	jmp    f010867e <page_range_ok+0x13>
+
+f0108698 <page_alloc_at>:
+{
+f0108698:	55                   	push   %ebp
+f0108699:	89 e5                	mov    %esp,%ebp
+f010869b:	57                   	push   %edi
+f010869c:	56                   	push   %esi
+f010869d:	53                   	push   %ebx
+f010869e:	83 ec 28             	sub    $0x28,%esp
+f01086a1:	89 c6                	mov    %eax,%esi
+f01086a3:	89 d3                	mov    %edx,%ebx
+f01086a5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	p = page_alloc(ALLOC_ZERO|ALLOC_HIGH);
+f01086a8:	6a 03                	push   $0x3
+f01086aa:	e8 1b 9c ff ff       	call   f01022ca <page_alloc>
+	if (!p)
+f01086af:	83 c4 10             	add    $0x10,%esp
+f01086b2:	85 c0                	test   %eax,%eax
+f01086b4:	74 57                	je     f010870d <page_alloc_at+0x75>
+f01086b6:	89 c7                	mov    %eax,%edi
+	if ((r = env_lock_checked(e, envid)) == 0) {
+f01086b8:	83 ec 08             	sub    $0x8,%esp
+f01086bb:	53                   	push   %ebx
+f01086bc:	56                   	push   %esi
+f01086bd:	e8 f0 da ff ff       	call   f01061b2 <env_lock_checked>
+f01086c2:	89 c3                	mov    %eax,%ebx
+f01086c4:	83 c4 10             	add    $0x10,%esp
+f01086c7:	85 c0                	test   %eax,%eax
+f01086c9:	74 13                	je     f01086de <page_alloc_at+0x46>
+	if (r < 0) {
+f01086cb:	85 db                	test   %ebx,%ebx
+f01086cd:	78 30                	js     f01086ff <page_alloc_at+0x67>
+	return 0;
+f01086cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f01086d4:	89 d8                	mov    %ebx,%eax
+f01086d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01086d9:	5b                   	pop    %ebx
+f01086da:	5e                   	pop    %esi
+f01086db:	5f                   	pop    %edi
+f01086dc:	5d                   	pop    %ebp
+f01086dd:	c3                   	ret
+		r = page_insert(e->env_pgdir, p, va, perm);
+f01086de:	ff 75 08             	push   0x8(%ebp)
+f01086e1:	ff 75 e4             	push   -0x1c(%ebp)
+f01086e4:	57                   	push   %edi
+f01086e5:	ff b6 30 01 00 00    	push   0x130(%esi)
+f01086eb:	e8 58 a2 ff ff       	call   f0102948 <page_insert>
+f01086f0:	89 c3                	mov    %eax,%ebx
+		env_unlock(e);
+f01086f2:	89 34 24             	mov    %esi,(%esp)
+f01086f5:	e8 8c da ff ff       	call   f0106186 <env_unlock>
+f01086fa:	83 c4 10             	add    $0x10,%esp
+f01086fd:	eb cc                	jmp    f01086cb <page_alloc_at+0x33>
+		page_free(p);
+f01086ff:	83 ec 0c             	sub    $0xc,%esp
+f0108702:	57                   	push   %edi
+f0108703:	e8 a9 97 ff ff       	call   f0101eb1 <page_free>
+		return r;
+f0108708:	83 c4 10             	add    $0x10,%esp
+f010870b:	eb c7                	jmp    f01086d4 <page_alloc_at+0x3c>
+		return -E_NO_MEM;
+f010870d:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f0108712:	eb c0                	jmp    f01086d4 <page_alloc_at+0x3c>
+
+f0108714 <page_lookup_src>:
+// any PTE_COW page if e uses kernel copy-on-write) is resolved now.
+// Returns NULL if nothing is mapped at 'va', or if (perm & PTE_W) but
+// 'va' is read-only in e.
+static struct PageInfo *
+page_lookup_src(struct Env *e, void *va, int perm)
+{
+f0108714:	55                   	push   %ebp
+f0108715:	89 e5                	mov    %esp,%ebp
+f0108717:	57                   	push   %edi
+f0108718:	56                   	push   %esi
+f0108719:	53                   	push   %ebx
+f010871a:	83 ec 30             	sub    $0x30,%esp
+f010871d:	89 c6                	mov    %eax,%esi
+f010871f:	89 d7                	mov    %edx,%edi
+	struct PageInfo *p;
+	pte_t *pte;
+
+	env_region_fault(e, (uintptr_t) va, perm & PTE_W);
+f0108721:	83 e1 02             	and    $0x2,%ecx
+f0108724:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+f0108727:	0f 95 c0             	setne  %al
+f010872a:	0f b6 c0             	movzbl %al,%eax
+f010872d:	50                   	push   %eax
+f010872e:	52                   	push   %edx
+f010872f:	56                   	push   %esi
+f0108730:	e8 ad df ff ff       	call   f01066e2 <env_region_fault>
+	p = page_lookup(e->env_pgdir, va, &pte);
+f0108735:	83 c4 0c             	add    $0xc,%esp
+f0108738:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010873b:	50                   	push   %eax
+f010873c:	57                   	push   %edi
+f010873d:	ff b6 30 01 00 00    	push   0x130(%esi)
+f0108743:	e8 e4 9f ff ff       	call   f010272c <page_lookup>
+f0108748:	89 c3                	mov    %eax,%ebx
+	if (p && (perm & PTE_W) && (*pte & PTE_COW)
+f010874a:	83 c4 10             	add    $0x10,%esp
+f010874d:	85 c0                	test   %eax,%eax
+f010874f:	74 1e                	je     f010876f <page_lookup_src+0x5b>
+f0108751:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+f0108755:	74 18                	je     f010876f <page_lookup_src+0x5b>
+f0108757:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010875a:	8b 00                	mov    (%eax),%eax
+f010875c:	f6 c4 08             	test   $0x8,%ah
+f010875f:	75 18                	jne    f0108779 <page_lookup_src+0x65>
+	    && page_fault_cow(e->env_pgdir, va, !e->env_kernel_cow) == 0)
+		p = page_lookup(e->env_pgdir, va, &pte);
+	if (p && (perm & PTE_W) && !(*pte & PTE_W))
+		return NULL;
+f0108761:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108764:	f6 00 02             	testb  $0x2,(%eax)
+f0108767:	b8 00 00 00 00       	mov    $0x0,%eax
+f010876c:	0f 44 d8             	cmove  %eax,%ebx
+	return p;
+}
+f010876f:	89 d8                	mov    %ebx,%eax
+f0108771:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108774:	5b                   	pop    %ebx
+f0108775:	5e                   	pop    %esi
+f0108776:	5f                   	pop    %edi
+f0108777:	5d                   	pop    %ebp
+f0108778:	c3                   	ret
+	    && page_fault_cow(e->env_pgdir, va, !e->env_kernel_cow) == 0)
+f0108779:	83 ec 04             	sub    $0x4,%esp
+f010877c:	0f b6 86 98 01 00 00 	movzbl 0x198(%esi),%eax
+f0108783:	83 f0 01             	xor    $0x1,%eax
+f0108786:	0f b6 c0             	movzbl %al,%eax
+f0108789:	50                   	push   %eax
+f010878a:	57                   	push   %edi
+f010878b:	ff b6 30 01 00 00    	push   0x130(%esi)
+f0108791:	e8 8b a3 ff ff       	call   f0102b21 <page_fault_cow>
+f0108796:	83 c4 10             	add    $0x10,%esp
+f0108799:	85 c0                	test   %eax,%eax
+f010879b:	75 c4                	jne    f0108761 <page_lookup_src+0x4d>
+		p = page_lookup(e->env_pgdir, va, &pte);
+f010879d:	83 ec 04             	sub    $0x4,%esp
+f01087a0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01087a3:	50                   	push   %eax
+f01087a4:	57                   	push   %edi
+f01087a5:	ff b6 30 01 00 00    	push   0x130(%esi)
+f01087ab:	e8 7c 9f ff ff       	call   f010272c <page_lookup>
+f01087b0:	89 c3                	mov    %eax,%ebx
+	if (p && (perm & PTE_W) && !(*pte & PTE_W))
+f01087b2:	83 c4 10             	add    $0x10,%esp
+f01087b5:	85 c0                	test   %eax,%eax
+f01087b7:	74 b6                	je     f010876f <page_lookup_src+0x5b>
+f01087b9:	eb a6                	jmp    f0108761 <page_lookup_src+0x4d>
+
+f01087bb <page_map_at>:
+// still be srcenvid and dstenvid, for sys_page_map and
+// sys_page_map_range.
+static int
+page_map_at(struct Env *srce, envid_t srcenvid, void *srcva,
+	    struct Env *dste, envid_t dstenvid, void *dstva, int perm)
+{
+f01087bb:	55                   	push   %ebp
+f01087bc:	89 e5                	mov    %esp,%ebp
+f01087be:	57                   	push   %edi
+f01087bf:	56                   	push   %esi
+f01087c0:	53                   	push   %ebx
+f01087c1:	83 ec 14             	sub    $0x14,%esp
+f01087c4:	89 c6                	mov    %eax,%esi
+f01087c6:	89 cf                	mov    %ecx,%edi
+	struct PageInfo *p;
+	int r;
+
+	if ((r = env_lock_checked(srce, srcenvid)) < 0)
+f01087c8:	52                   	push   %edx
+f01087c9:	50                   	push   %eax
+f01087ca:	e8 e3 d9 ff ff       	call   f01061b2 <env_lock_checked>
+f01087cf:	89 c3                	mov    %eax,%ebx
+f01087d1:	83 c4 10             	add    $0x10,%esp
+f01087d4:	85 c0                	test   %eax,%eax
+f01087d6:	78 46                	js     f010881e <page_map_at+0x63>
+		return r;
+
+	p = page_lookup_src(srce, srcva, perm);
+f01087d8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f01087db:	89 fa                	mov    %edi,%edx
+f01087dd:	89 f0                	mov    %esi,%eax
+f01087df:	e8 30 ff ff ff       	call   f0108714 <page_lookup_src>
+f01087e4:	89 c7                	mov    %eax,%edi
+
+	// Hold a reference to the page, so that it stays around even
+	// if srce unmaps it once we let go of srce's lock.
+	if (p)
+f01087e6:	85 c0                	test   %eax,%eax
+f01087e8:	74 65                	je     f010884f <page_map_at+0x94>
+		page_incref(p);
+f01087ea:	83 ec 0c             	sub    $0xc,%esp
+f01087ed:	50                   	push   %eax
+f01087ee:	e8 96 98 ff ff       	call   f0102089 <page_incref>
+	env_unlock(srce);
+f01087f3:	89 34 24             	mov    %esi,(%esp)
+f01087f6:	e8 8b d9 ff ff       	call   f0106186 <env_unlock>
+	if (!p)
+		return -E_INVAL;
+
+	if ((r = env_lock_checked(dste, dstenvid)) == 0) {
+f01087fb:	83 c4 08             	add    $0x8,%esp
+f01087fe:	ff 75 0c             	push   0xc(%ebp)
+f0108801:	ff 75 08             	push   0x8(%ebp)
+f0108804:	e8 a9 d9 ff ff       	call   f01061b2 <env_lock_checked>
+f0108809:	89 c3                	mov    %eax,%ebx
+f010880b:	83 c4 10             	add    $0x10,%esp
+f010880e:	85 c0                	test   %eax,%eax
+f0108810:	74 16                	je     f0108828 <page_map_at+0x6d>
+		r = page_insert(dste->env_pgdir, p, dstva, perm);
+		env_unlock(dste);
+	}
+	page_decref(p);
+f0108812:	83 ec 0c             	sub    $0xc,%esp
+f0108815:	57                   	push   %edi
+f0108816:	e8 e7 98 ff ff       	call   f0102102 <page_decref>
+	return r;
+f010881b:	83 c4 10             	add    $0x10,%esp
+}
+f010881e:	89 d8                	mov    %ebx,%eax
+f0108820:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108823:	5b                   	pop    %ebx
+f0108824:	5e                   	pop    %esi
+f0108825:	5f                   	pop    %edi
+f0108826:	5d                   	pop    %ebp
+f0108827:	c3                   	ret
+		r = page_insert(dste->env_pgdir, p, dstva, perm);
+f0108828:	ff 75 14             	push   0x14(%ebp)
+f010882b:	ff 75 10             	push   0x10(%ebp)
+f010882e:	57                   	push   %edi
+f010882f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108832:	ff b0 30 01 00 00    	push   0x130(%eax)
+f0108838:	e8 0b a1 ff ff       	call   f0102948 <page_insert>
+f010883d:	89 c3                	mov    %eax,%ebx
+		env_unlock(dste);
+f010883f:	83 c4 04             	add    $0x4,%esp
+f0108842:	ff 75 08             	push   0x8(%ebp)
+f0108845:	e8 3c d9 ff ff       	call   f0106186 <env_unlock>
+f010884a:	83 c4 10             	add    $0x10,%esp
+f010884d:	eb c3                	jmp    f0108812 <page_map_at+0x57>
+	env_unlock(srce);
+f010884f:	83 ec 0c             	sub    $0xc,%esp
+f0108852:	56                   	push   %esi
+f0108853:	e8 2e d9 ff ff       	call   f0106186 <env_unlock>
+f0108858:	83 c4 10             	add    $0x10,%esp
+		return -E_INVAL;
+f010885b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108860:	eb bc                	jmp    f010881e <page_map_at+0x63>
+
+f0108862 <sys_ipc_try_send>:
+// the target's affinity mask excludes this CPU, it is just woken up, as
+// without 'yield'.
+static int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+		 bool yield)
+{
+f0108862:	55                   	push   %ebp
+f0108863:	89 e5                	mov    %esp,%ebp
+f0108865:	57                   	push   %edi
+f0108866:	56                   	push   %esi
+f0108867:	53                   	push   %ebx
+f0108868:	83 ec 30             	sub    $0x30,%esp
+f010886b:	89 c6                	mov    %eax,%esi
+f010886d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f0108870:	89 cf                	mov    %ecx,%edi
+f0108872:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0108875:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	// LAB 4: Your code here.
+	struct Env *e;
+	int r;
+	struct PageInfo *p = NULL;
+
+	if ((r = envid2env(envid, &e, 0)) < 0)
+f0108878:	6a 00                	push   $0x0
+f010887a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010887d:	50                   	push   %eax
+f010887e:	56                   	push   %esi
+f010887f:	e8 a0 d9 ff ff       	call   f0106224 <envid2env>
+f0108884:	89 c3                	mov    %eax,%ebx
+f0108886:	83 c4 10             	add    $0x10,%esp
+f0108889:	85 c0                	test   %eax,%eax
+f010888b:	0f 88 6a 01 00 00    	js     f01089fb <sys_ipc_try_send+0x199>
+		return r;
+
+	// Cheap early test, repeated below under e's lock.
+	if (!e->env_ipc_recving)
+f0108891:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108894:	80 b8 99 01 00 00 00 	cmpb   $0x0,0x199(%eax)
+f010889b:	0f 84 0b 02 00 00    	je     f0108aac <sys_ipc_try_send+0x24a>
+		return -E_IPC_NOT_RECV;
+
+	if ((uintptr_t) srcva < UTOP) {
+f01088a1:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f01088a7:	0f 87 5e 02 00 00    	ja     f0108b0b <sys_ipc_try_send+0x2a9>
+		if (PTE_ADDR(srcva) != (uintptr_t) srcva)
+f01088ad:	89 fa                	mov    %edi,%edx
+f01088af:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+			return -E_INVAL;
+
+		if (!(perm & (PTE_U|PTE_P)) || (perm & ~PTE_SYSCALL))
+f01088b5:	f6 45 08 05          	testb  $0x5,0x8(%ebp)
+f01088b9:	0f 84 f7 01 00 00    	je     f0108ab6 <sys_ipc_try_send+0x254>
+f01088bf:	8b 45 08             	mov    0x8(%ebp),%eax
+f01088c2:	25 f8 f1 ff ff       	and    $0xfffff1f8,%eax
+f01088c7:	09 d0                	or     %edx,%eax
+f01088c9:	0f 85 f1 01 00 00    	jne    f0108ac0 <sys_ipc_try_send+0x25e>
+			return -E_INVAL;
+
+		// As in sys_page_map, hold a reference to the page
+		// while we don't hold our own lock.
+		env_lock(curenv);
+f01088cf:	e8 70 23 00 00       	call   f010ac44 <cpunum>
+f01088d4:	83 ec 0c             	sub    $0xc,%esp
+f01088d7:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01088dd:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f01088e3:	e8 72 d8 ff ff       	call   f010615a <env_lock>
+		p = page_lookup_src(curenv, srcva, perm);
+f01088e8:	e8 57 23 00 00       	call   f010ac44 <cpunum>
+f01088ed:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01088f3:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01088f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01088fc:	89 fa                	mov    %edi,%edx
+f01088fe:	e8 11 fe ff ff       	call   f0108714 <page_lookup_src>
+f0108903:	89 c7                	mov    %eax,%edi
+		if (p)
+f0108905:	83 c4 10             	add    $0x10,%esp
+f0108908:	85 c0                	test   %eax,%eax
+f010890a:	0f 84 3a 02 00 00    	je     f0108b4a <sys_ipc_try_send+0x2e8>
+			page_incref(p);
+f0108910:	83 ec 0c             	sub    $0xc,%esp
+f0108913:	50                   	push   %eax
+f0108914:	e8 70 97 ff ff       	call   f0102089 <page_incref>
+		env_unlock(curenv);
+f0108919:	e8 26 23 00 00       	call   f010ac44 <cpunum>
+f010891e:	83 c4 04             	add    $0x4,%esp
+f0108921:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108927:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f010892d:	e8 54 d8 ff ff       	call   f0106186 <env_unlock>
+		if (!p)
+			return -E_INVAL;
+	}
+
+	if ((r = env_lock_checked(e, envid)) < 0)
+f0108932:	83 c4 08             	add    $0x8,%esp
+f0108935:	56                   	push   %esi
+f0108936:	ff 75 e4             	push   -0x1c(%ebp)
+f0108939:	e8 74 d8 ff ff       	call   f01061b2 <env_lock_checked>
+f010893e:	89 c3                	mov    %eax,%ebx
+f0108940:	83 c4 10             	add    $0x10,%esp
+f0108943:	85 c0                	test   %eax,%eax
+f0108945:	0f 88 48 02 00 00    	js     f0108b93 <sys_ipc_try_send+0x331>
+		goto out;
+	if (!e->env_ipc_recving) {
+f010894b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010894e:	80 b8 99 01 00 00 00 	cmpb   $0x0,0x199(%eax)
+f0108955:	0f 84 25 02 00 00    	je     f0108b80 <sys_ipc_try_send+0x31e>
+		r = -E_IPC_NOT_RECV;
+		goto unlock;
+	}
+
+	e->env_ipc_perm = 0;
+f010895b:	c7 80 a8 01 00 00 00 	movl   $0x0,0x1a8(%eax)
+f0108962:	00 00 00 
+	if (p && (uintptr_t) e->env_ipc_dstva < UTOP) {
+f0108965:	85 ff                	test   %edi,%edi
+f0108967:	0f 84 5d 01 00 00    	je     f0108aca <sys_ipc_try_send+0x268>
+f010896d:	8b 90 9c 01 00 00    	mov    0x19c(%eax),%edx
+f0108973:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f0108979:	0f 86 90 00 00 00    	jbe    f0108a0f <sys_ipc_try_send+0x1ad>
+		if ((r = page_insert(e->env_pgdir, p, e->env_ipc_dstva, perm)) < 0)
+			goto unlock;
+		e->env_ipc_perm = perm;
+	}
+
+	e->env_ipc_recving = 0;
+f010897f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108982:	c6 80 99 01 00 00 00 	movb   $0x0,0x199(%eax)
+	e->env_ipc_value = value;
+f0108989:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f010898c:	89 b0 a0 01 00 00    	mov    %esi,0x1a0(%eax)
+	e->env_ipc_from = curenv->env_id;
+f0108992:	e8 ad 22 00 00       	call   f010ac44 <cpunum>
+f0108997:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f010899a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01089a0:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01089a6:	8b 40 4c             	mov    0x4c(%eax),%eax
+f01089a9:	89 82 a4 01 00 00    	mov    %eax,0x1a4(%edx)
+	envid = e->env_id;
+f01089af:	8b 5a 4c             	mov    0x4c(%edx),%ebx
+	env_unlock(e);
+f01089b2:	83 ec 0c             	sub    $0xc,%esp
+f01089b5:	52                   	push   %edx
+f01089b6:	e8 cb d7 ff ff       	call   f0106186 <env_unlock>
+	if (p)
+		page_decref(p);
+f01089bb:	89 3c 24             	mov    %edi,(%esp)
+f01089be:	e8 3f 97 ff ff       	call   f0102102 <page_decref>
+f01089c3:	83 c4 10             	add    $0x10,%esp
+	spin_lock(&kernel_lock);
+f01089c6:	83 ec 0c             	sub    $0xc,%esp
+f01089c9:	68 c0 95 11 f0       	push   $0xf01195c0
+f01089ce:	e8 00 25 00 00       	call   f010aed3 <spin_lock>
+
+	// Waking e up needs the big kernel lock.  Until we have it, e
+	// is NOT_RUNNABLE, but it may be destroyed in the meantime.
+	lock_kernel();
+	if (e->env_id != envid || e->env_status != ENV_NOT_RUNNABLE) {
+f01089d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01089d6:	83 c4 10             	add    $0x10,%esp
+f01089d9:	39 58 4c             	cmp    %ebx,0x4c(%eax)
+f01089dc:	75 06                	jne    f01089e4 <sys_ipc_try_send+0x182>
+f01089de:	83 78 58 04          	cmpl   $0x4,0x58(%eax)
+f01089e2:	74 59                	je     f0108a3d <sys_ipc_try_send+0x1db>
+	spin_unlock(&kernel_lock);
+f01089e4:	83 ec 0c             	sub    $0xc,%esp
+f01089e7:	68 c0 95 11 f0       	push   $0xf01195c0
+f01089ec:	e8 fe 25 00 00       	call   f010afef <spin_unlock>
+	asm volatile("pause");
+f01089f1:	f3 90                	pause
+		unlock_kernel();
+		return 0;
+f01089f3:	83 c4 10             	add    $0x10,%esp
+f01089f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+	env_unlock(e);
+out:
+	if (p)
+		page_decref(p);
+	return r;
+}
+f01089fb:	89 d8                	mov    %ebx,%eax
+f01089fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108a00:	5b                   	pop    %ebx
+f0108a01:	5e                   	pop    %esi
+f0108a02:	5f                   	pop    %edi
+f0108a03:	5d                   	pop    %ebp
+f0108a04:	c3                   	ret
+	struct PageInfo *p = NULL;
+f0108a05:	bf 00 00 00 00       	mov    $0x0,%edi
+f0108a0a:	e9 4c ff ff ff       	jmp    f010895b <sys_ipc_try_send+0xf9>
+		if ((r = page_insert(e->env_pgdir, p, e->env_ipc_dstva, perm)) < 0)
+f0108a0f:	ff 75 08             	push   0x8(%ebp)
+f0108a12:	52                   	push   %edx
+f0108a13:	57                   	push   %edi
+f0108a14:	ff b0 30 01 00 00    	push   0x130(%eax)
+f0108a1a:	e8 29 9f ff ff       	call   f0102948 <page_insert>
+f0108a1f:	89 c3                	mov    %eax,%ebx
+f0108a21:	83 c4 10             	add    $0x10,%esp
+f0108a24:	85 c0                	test   %eax,%eax
+f0108a26:	0f 88 44 01 00 00    	js     f0108b70 <sys_ipc_try_send+0x30e>
+		e->env_ipc_perm = perm;
+f0108a2c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108a2f:	8b 75 08             	mov    0x8(%ebp),%esi
+f0108a32:	89 b0 a8 01 00 00    	mov    %esi,0x1a8(%eax)
+f0108a38:	e9 42 ff ff ff       	jmp    f010897f <sys_ipc_try_send+0x11d>
+	e->env_status = ENV_RUNNABLE;
+f0108a3d:	c7 40 58 02 00 00 00 	movl   $0x2,0x58(%eax)
+	if (yield && curenv->env_status == ENV_RUNNING) {
+f0108a44:	80 7d d0 00          	cmpb   $0x0,-0x30(%ebp)
+f0108a48:	75 23                	jne    f0108a6d <sys_ipc_try_send+0x20b>
+	sched_wakeup(e);
+f0108a4a:	83 ec 0c             	sub    $0xc,%esp
+f0108a4d:	ff 75 e4             	push   -0x1c(%ebp)
+f0108a50:	e8 4b f4 ff ff       	call   f0107ea0 <sched_wakeup>
+	spin_unlock(&kernel_lock);
+f0108a55:	c7 04 24 c0 95 11 f0 	movl   $0xf01195c0,(%esp)
+f0108a5c:	e8 8e 25 00 00       	call   f010afef <spin_unlock>
+	asm volatile("pause");
+f0108a61:	f3 90                	pause
+	return 0;
+f0108a63:	83 c4 10             	add    $0x10,%esp
+f0108a66:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0108a6b:	eb 8e                	jmp    f01089fb <sys_ipc_try_send+0x199>
+	if (yield && curenv->env_status == ENV_RUNNING) {
+f0108a6d:	e8 d2 21 00 00       	call   f010ac44 <cpunum>
+f0108a72:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108a78:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0108a7e:	83 78 58 03          	cmpl   $0x3,0x58(%eax)
+f0108a82:	75 c6                	jne    f0108a4a <sys_ipc_try_send+0x1e8>
+		curenv->env_tf.tf_regs.reg_eax = 0;
+f0108a84:	e8 bb 21 00 00       	call   f010ac44 <cpunum>
+f0108a89:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108a8f:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0108a95:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+		sched_yield_to(e);
+f0108a9c:	83 ec 0c             	sub    $0xc,%esp
+f0108a9f:	ff 75 e4             	push   -0x1c(%ebp)
+f0108aa2:	e8 2f f4 ff ff       	call   f0107ed6 <sched_yield_to>
+f0108aa7:	83 c4 10             	add    $0x10,%esp
+f0108aaa:	eb 9e                	jmp    f0108a4a <sys_ipc_try_send+0x1e8>
+		return -E_IPC_NOT_RECV;
+f0108aac:	bb f9 ff ff ff       	mov    $0xfffffff9,%ebx
+f0108ab1:	e9 45 ff ff ff       	jmp    f01089fb <sys_ipc_try_send+0x199>
+			return -E_INVAL;
+f0108ab6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108abb:	e9 3b ff ff ff       	jmp    f01089fb <sys_ipc_try_send+0x199>
+f0108ac0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108ac5:	e9 31 ff ff ff       	jmp    f01089fb <sys_ipc_try_send+0x199>
+	e->env_ipc_recving = 0;
+f0108aca:	c6 80 99 01 00 00 00 	movb   $0x0,0x199(%eax)
+	e->env_ipc_value = value;
+f0108ad1:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f0108ad4:	89 b0 a0 01 00 00    	mov    %esi,0x1a0(%eax)
+	e->env_ipc_from = curenv->env_id;
+f0108ada:	e8 65 21 00 00       	call   f010ac44 <cpunum>
+f0108adf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0108ae2:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108ae8:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0108aee:	8b 40 4c             	mov    0x4c(%eax),%eax
+f0108af1:	89 82 a4 01 00 00    	mov    %eax,0x1a4(%edx)
+	envid = e->env_id;
+f0108af7:	8b 5a 4c             	mov    0x4c(%edx),%ebx
+	env_unlock(e);
+f0108afa:	83 ec 0c             	sub    $0xc,%esp
+f0108afd:	52                   	push   %edx
+f0108afe:	e8 83 d6 ff ff       	call   f0106186 <env_unlock>
+f0108b03:	83 c4 10             	add    $0x10,%esp
+f0108b06:	e9 bb fe ff ff       	jmp    f01089c6 <sys_ipc_try_send+0x164>
+	if ((r = env_lock_checked(e, envid)) < 0)
+f0108b0b:	83 ec 08             	sub    $0x8,%esp
+f0108b0e:	56                   	push   %esi
+f0108b0f:	50                   	push   %eax
+f0108b10:	e8 9d d6 ff ff       	call   f01061b2 <env_lock_checked>
+f0108b15:	89 c3                	mov    %eax,%ebx
+f0108b17:	83 c4 10             	add    $0x10,%esp
+f0108b1a:	85 c0                	test   %eax,%eax
+f0108b1c:	0f 88 d9 fe ff ff    	js     f01089fb <sys_ipc_try_send+0x199>
+	if (!e->env_ipc_recving) {
+f0108b22:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108b25:	80 b8 99 01 00 00 00 	cmpb   $0x0,0x199(%eax)
+f0108b2c:	0f 85 d3 fe ff ff    	jne    f0108a05 <sys_ipc_try_send+0x1a3>
+	env_unlock(e);
+f0108b32:	83 ec 0c             	sub    $0xc,%esp
+f0108b35:	ff 75 e4             	push   -0x1c(%ebp)
+f0108b38:	e8 49 d6 ff ff       	call   f0106186 <env_unlock>
+f0108b3d:	83 c4 10             	add    $0x10,%esp
+		r = -E_IPC_NOT_RECV;
+f0108b40:	bb f9 ff ff ff       	mov    $0xfffffff9,%ebx
+f0108b45:	e9 b1 fe ff ff       	jmp    f01089fb <sys_ipc_try_send+0x199>
+		env_unlock(curenv);
+f0108b4a:	e8 f5 20 00 00       	call   f010ac44 <cpunum>
+f0108b4f:	83 ec 0c             	sub    $0xc,%esp
+f0108b52:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108b58:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0108b5e:	e8 23 d6 ff ff       	call   f0106186 <env_unlock>
+f0108b63:	83 c4 10             	add    $0x10,%esp
+			return -E_INVAL;
+f0108b66:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108b6b:	e9 8b fe ff ff       	jmp    f01089fb <sys_ipc_try_send+0x199>
+	env_unlock(e);
+f0108b70:	83 ec 0c             	sub    $0xc,%esp
+f0108b73:	ff 75 e4             	push   -0x1c(%ebp)
+f0108b76:	e8 0b d6 ff ff       	call   f0106186 <env_unlock>
+f0108b7b:	83 c4 10             	add    $0x10,%esp
+f0108b7e:	eb 13                	jmp    f0108b93 <sys_ipc_try_send+0x331>
+f0108b80:	83 ec 0c             	sub    $0xc,%esp
+f0108b83:	ff 75 e4             	push   -0x1c(%ebp)
+f0108b86:	e8 fb d5 ff ff       	call   f0106186 <env_unlock>
+f0108b8b:	83 c4 10             	add    $0x10,%esp
+		r = -E_IPC_NOT_RECV;
+f0108b8e:	bb f9 ff ff ff       	mov    $0xfffffff9,%ebx
+		page_decref(p);
+f0108b93:	83 ec 0c             	sub    $0xc,%esp
+f0108b96:	57                   	push   %edi
+f0108b97:	e8 66 95 ff ff       	call   f0102102 <page_decref>
+f0108b9c:	83 c4 10             	add    $0x10,%esp
+f0108b9f:	e9 57 fe ff ff       	jmp    f01089fb <sys_ipc_try_send+0x199>
+
+f0108ba4 <syscall_fast>:
+// trap() calls this before taking any locks or even saving tf in
+// curenv.  Returns 1, with the result in tf's %eax, if the system call
+// was handled, or 0 if it has to go through syscall().
+bool
+syscall_fast(struct Trapframe *tf)
+{
+f0108ba4:	55                   	push   %ebp
+f0108ba5:	89 e5                	mov    %esp,%ebp
+f0108ba7:	53                   	push   %ebx
+f0108ba8:	83 ec 04             	sub    $0x4,%esp
+f0108bab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int32_t r;
+
+	switch (tf->tf_regs.reg_eax) {
+f0108bae:	83 7b 1c 1a          	cmpl   $0x1a,0x1c(%ebx)
+f0108bb2:	77 50                	ja     f0108c04 <syscall_fast+0x60>
+f0108bb4:	8b 43 1c             	mov    0x1c(%ebx),%eax
+f0108bb7:	ff 24 85 5c e3 10 f0 	jmp    *-0xfef1ca4(,%eax,4)
+	return curenv->env_id;
+f0108bbe:	e8 81 20 00 00       	call   f010ac44 <cpunum>
+f0108bc3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108bc9:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0108bcf:	8b 40 4c             	mov    0x4c(%eax),%eax
+		r = 0;
+		break;
+	default:
+		return 0;
+	}
+	tf->tf_regs.reg_eax = r;
+f0108bd2:	89 43 1c             	mov    %eax,0x1c(%ebx)
+	return 1;
+f0108bd5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+f0108bda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108bdd:	c9                   	leave
+f0108bde:	c3                   	ret
+	return ncpu;
+f0108bdf:	a1 04 96 61 f0       	mov    0xf0619604,%eax
+		break;
+f0108be4:	eb ec                	jmp    f0108bd2 <syscall_fast+0x2e>
+	return time_msec();
+f0108be6:	e8 61 2f 00 00       	call   f010bb4c <time_msec>
+		break;
+f0108beb:	eb e5                	jmp    f0108bd2 <syscall_fast+0x2e>
+	return cons_getc();
+f0108bed:	e8 39 7a ff ff       	call   f010062b <cons_getc>
+		break;
+f0108bf2:	eb de                	jmp    f0108bd2 <syscall_fast+0x2e>
+		if (!sched_yield_is_noop())
+f0108bf4:	e8 9c f4 ff ff       	call   f0108095 <sched_yield_is_noop>
+f0108bf9:	84 c0                	test   %al,%al
+f0108bfb:	74 dd                	je     f0108bda <syscall_fast+0x36>
+		r = 0;
+f0108bfd:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108c02:	eb ce                	jmp    f0108bd2 <syscall_fast+0x2e>
+	switch (tf->tf_regs.reg_eax) {
+f0108c04:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108c09:	eb cf                	jmp    f0108bda <syscall_fast+0x36>
+
+f0108c0b <syscall>:
+// Called from trap() without the big kernel lock.  Runs the system
+// call, under the big kernel lock unless it does its own locking, and
+// returns without the big kernel lock.
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+f0108c0b:	55                   	push   %ebp
+f0108c0c:	89 e5                	mov    %esp,%ebp
+f0108c0e:	57                   	push   %edi
+f0108c0f:	56                   	push   %esi
+f0108c10:	53                   	push   %ebx
+f0108c11:	83 ec 2c             	sub    $0x2c,%esp
+f0108c14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	switch (syscallno) {
+f0108c17:	83 fb 0c             	cmp    $0xc,%ebx
+f0108c1a:	77 25                	ja     f0108c41 <syscall+0x36>
+f0108c1c:	83 fb 04             	cmp    $0x4,%ebx
+f0108c1f:	77 28                	ja     f0108c49 <syscall+0x3e>
+	spin_lock(&kernel_lock);
+f0108c21:	83 ec 0c             	sub    $0xc,%esp
+f0108c24:	68 c0 95 11 f0       	push   $0xf01195c0
+f0108c29:	e8 a5 22 00 00       	call   f010aed3 <spin_lock>
+	switch (syscallno) {
+f0108c2e:	83 c4 10             	add    $0x10,%esp
+f0108c31:	83 fb 1c             	cmp    $0x1c,%ebx
+f0108c34:	0f 87 a2 0d 00 00    	ja     f01099dc <syscall+0xdd1>
+f0108c3a:	ff 24 9d c8 e3 10 f0 	jmp    *-0xfef1c38(,%ebx,4)
+	switch (syscallno) {
+f0108c41:	8d 43 e9             	lea    -0x17(%ebx),%eax
+f0108c44:	83 f8 01             	cmp    $0x1,%eax
+f0108c47:	77 d8                	ja     f0108c21 <syscall+0x16>
+	switch (syscallno) {
+f0108c49:	83 fb 1c             	cmp    $0x1c,%ebx
+f0108c4c:	0f 87 a6 0d 00 00    	ja     f01099f8 <syscall+0xded>
+f0108c52:	ff 24 9d 3c e4 10 f0 	jmp    *-0xfef1bc4(,%ebx,4)
+f0108c59:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0108c5d:	eb 04                	jmp    f0108c63 <syscall+0x58>
+f0108c5f:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	user_mem_assert_lock(curenv, s, len, PTE_U);
+f0108c63:	e8 dc 1f 00 00       	call   f010ac44 <cpunum>
+f0108c68:	6a 04                	push   $0x4
+f0108c6a:	ff 75 10             	push   0x10(%ebp)
+f0108c6d:	ff 75 0c             	push   0xc(%ebp)
+f0108c70:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108c76:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0108c7c:	e8 cc c4 ff ff       	call   f010514d <user_mem_assert_lock>
+	cprintf("%.*s", len, s);
+f0108c81:	83 c4 0c             	add    $0xc,%esp
+f0108c84:	ff 75 0c             	push   0xc(%ebp)
+f0108c87:	ff 75 10             	push   0x10(%ebp)
+f0108c8a:	68 b0 e4 10 f0       	push   $0xf010e4b0
+f0108c8f:	e8 68 e3 ff ff       	call   f0106ffc <cprintf>
+	env_unlock(curenv);
+f0108c94:	e8 ab 1f 00 00       	call   f010ac44 <cpunum>
+f0108c99:	83 c4 04             	add    $0x4,%esp
+f0108c9c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108ca2:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0108ca8:	e8 d9 d4 ff ff       	call   f0106186 <env_unlock>
+}
+f0108cad:	83 c4 10             	add    $0x10,%esp
+		return 0;
+f0108cb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+	int32_t r;
+
+	if (locked)
+		lock_kernel();
+	r = syscall_dispatch(syscallno, a1, a2, a3, a4, a5);
+	if (locked)
+f0108cb5:	80 7d d7 00          	cmpb   $0x0,-0x29(%ebp)
+f0108cb9:	0f 85 22 0d 00 00    	jne    f01099e1 <syscall+0xdd6>
+		unlock_kernel();
+	return r;
+}
+f0108cbf:	89 d8                	mov    %ebx,%eax
+f0108cc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108cc4:	5b                   	pop    %ebx
+f0108cc5:	5e                   	pop    %esi
+f0108cc6:	5f                   	pop    %edi
+f0108cc7:	5d                   	pop    %ebp
+f0108cc8:	c3                   	ret
+	switch (syscallno) {
+f0108cc9:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0108ccd:	eb 04                	jmp    f0108cd3 <syscall+0xc8>
+f0108ccf:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	return cons_getc();
+f0108cd3:	e8 53 79 ff ff       	call   f010062b <cons_getc>
+f0108cd8:	89 c3                	mov    %eax,%ebx
+		return sys_cgetc();
+f0108cda:	eb d9                	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0108cdc:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0108ce0:	eb 04                	jmp    f0108ce6 <syscall+0xdb>
+f0108ce2:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	return curenv->env_id;
+f0108ce6:	e8 59 1f 00 00       	call   f010ac44 <cpunum>
+f0108ceb:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0108cf1:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0108cf7:	8b 58 4c             	mov    0x4c(%eax),%ebx
+		return sys_getenvid();
+f0108cfa:	eb b9                	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0108cfc:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0108d00:	eb 04                	jmp    f0108d06 <syscall+0xfb>
+f0108d02:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	return ncpu;
+f0108d06:	8b 1d 04 96 61 f0    	mov    0xf0619604,%ebx
+		return sys_ncpu();
+f0108d0c:	eb a7                	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0108d0e:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0108d12:	eb 04                	jmp    f0108d18 <syscall+0x10d>
+f0108d14:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0108d18:	83 ec 04             	sub    $0x4,%esp
+f0108d1b:	6a 01                	push   $0x1
+f0108d1d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0108d20:	50                   	push   %eax
+f0108d21:	ff 75 0c             	push   0xc(%ebp)
+f0108d24:	e8 fb d4 ff ff       	call   f0106224 <envid2env>
+f0108d29:	89 c3                	mov    %eax,%ebx
+f0108d2b:	83 c4 10             	add    $0x10,%esp
+f0108d2e:	85 c0                	test   %eax,%eax
+f0108d30:	78 83                	js     f0108cb5 <syscall+0xaa>
+	env_destroy(e);
+f0108d32:	83 ec 0c             	sub    $0xc,%esp
+f0108d35:	ff 75 e4             	push   -0x1c(%ebp)
+f0108d38:	e8 84 de ff ff       	call   f0106bc1 <env_destroy>
+	return 0;
+f0108d3d:	83 c4 10             	add    $0x10,%esp
+f0108d40:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return sys_env_destroy(a1);
+f0108d45:	e9 6b ff ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0108d4a:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0108d4e:	eb 04                	jmp    f0108d54 <syscall+0x149>
+f0108d50:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	return env_find(type);
+f0108d54:	83 ec 0c             	sub    $0xc,%esp
+f0108d57:	ff 75 0c             	push   0xc(%ebp)
+f0108d5a:	e8 80 d5 ff ff       	call   f01062df <env_find>
+f0108d5f:	89 c3                	mov    %eax,%ebx
+		return sys_env_find(a1);
+f0108d61:	83 c4 10             	add    $0x10,%esp
+f0108d64:	e9 4c ff ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0108d69:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0108d6d:	eb 04                	jmp    f0108d73 <syscall+0x168>
+f0108d6f:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0108d73:	83 ec 04             	sub    $0x4,%esp
+f0108d76:	6a 01                	push   $0x1
+f0108d78:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0108d7b:	50                   	push   %eax
+f0108d7c:	ff 75 0c             	push   0xc(%ebp)
+f0108d7f:	e8 a0 d4 ff ff       	call   f0106224 <envid2env>
+f0108d84:	89 c3                	mov    %eax,%ebx
+f0108d86:	83 c4 10             	add    $0x10,%esp
+f0108d89:	85 c0                	test   %eax,%eax
+f0108d8b:	0f 88 24 ff ff ff    	js     f0108cb5 <syscall+0xaa>
+	if ((uintptr_t) va >= UTOP || PTE_ADDR(va) != (uintptr_t) va)
+f0108d91:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0108d98:	77 39                	ja     f0108dd3 <syscall+0x1c8>
+f0108d9a:	8b 55 10             	mov    0x10(%ebp),%edx
+f0108d9d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+	if (!(perm & (PTE_U|PTE_P)) || (perm & ~PTE_SYSCALL))
+f0108da3:	f6 45 14 05          	testb  $0x5,0x14(%ebp)
+f0108da7:	74 34                	je     f0108ddd <syscall+0x1d2>
+f0108da9:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108dac:	25 f8 f1 ff ff       	and    $0xfffff1f8,%eax
+f0108db1:	09 d0                	or     %edx,%eax
+f0108db3:	75 32                	jne    f0108de7 <syscall+0x1dc>
+	return page_alloc_at(e, envid, va, perm);
+f0108db5:	83 ec 0c             	sub    $0xc,%esp
+f0108db8:	ff 75 14             	push   0x14(%ebp)
+f0108dbb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0108dbe:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108dc1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108dc4:	e8 cf f8 ff ff       	call   f0108698 <page_alloc_at>
+f0108dc9:	89 c3                	mov    %eax,%ebx
+f0108dcb:	83 c4 10             	add    $0x10,%esp
+f0108dce:	e9 e2 fe ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f0108dd3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108dd8:	e9 d8 fe ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f0108ddd:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108de2:	e9 ce fe ff ff       	jmp    f0108cb5 <syscall+0xaa>
+f0108de7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+		return sys_page_alloc(a1, (void *) a2, a3);
+f0108dec:	e9 c4 fe ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0108df1:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0108df5:	eb 04                	jmp    f0108dfb <syscall+0x1f0>
+f0108df7:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0108dfb:	83 ec 04             	sub    $0x4,%esp
+f0108dfe:	6a 01                	push   $0x1
+f0108e00:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0108e03:	50                   	push   %eax
+f0108e04:	ff 75 0c             	push   0xc(%ebp)
+f0108e07:	e8 18 d4 ff ff       	call   f0106224 <envid2env>
+f0108e0c:	89 c3                	mov    %eax,%ebx
+f0108e0e:	83 c4 10             	add    $0x10,%esp
+f0108e11:	85 c0                	test   %eax,%eax
+f0108e13:	0f 88 9c fe ff ff    	js     f0108cb5 <syscall+0xaa>
+	if ((uintptr_t) va >= UTOP || (uintptr_t) va % PTSIZE)
+f0108e19:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0108e20:	0f 87 a3 00 00 00    	ja     f0108ec9 <syscall+0x2be>
+f0108e26:	f7 45 10 ff ff 3f 00 	testl  $0x3fffff,0x10(%ebp)
+f0108e2d:	0f 85 a0 00 00 00    	jne    f0108ed3 <syscall+0x2c8>
+	if ((perm & (PTE_U|PTE_P)) != (PTE_U|PTE_P) || (perm & ~PTE_SYSCALL))
+f0108e33:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108e36:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f0108e3b:	83 f8 05             	cmp    $0x5,%eax
+f0108e3e:	0f 85 99 00 00 00    	jne    f0108edd <syscall+0x2d2>
+	if (!page_pse)
+f0108e44:	80 3d 70 89 61 f0 00 	cmpb   $0x0,0xf0618970
+f0108e4b:	0f 84 96 00 00 00    	je     f0108ee7 <syscall+0x2dc>
+	p = page_alloc_order(PAGE_LARGE_ORDER, ALLOC_ZERO);
+f0108e51:	83 ec 08             	sub    $0x8,%esp
+f0108e54:	6a 01                	push   $0x1
+f0108e56:	6a 0a                	push   $0xa
+f0108e58:	e8 4a 95 ff ff       	call   f01023a7 <page_alloc_order>
+f0108e5d:	89 c6                	mov    %eax,%esi
+	if (!p)
+f0108e5f:	83 c4 10             	add    $0x10,%esp
+f0108e62:	85 c0                	test   %eax,%eax
+f0108e64:	0f 84 87 00 00 00    	je     f0108ef1 <syscall+0x2e6>
+	if ((r = env_lock_checked(e, envid)) == 0) {
+f0108e6a:	83 ec 08             	sub    $0x8,%esp
+f0108e6d:	ff 75 0c             	push   0xc(%ebp)
+f0108e70:	ff 75 e4             	push   -0x1c(%ebp)
+f0108e73:	e8 3a d3 ff ff       	call   f01061b2 <env_lock_checked>
+f0108e78:	89 c3                	mov    %eax,%ebx
+f0108e7a:	83 c4 10             	add    $0x10,%esp
+f0108e7d:	85 c0                	test   %eax,%eax
+f0108e7f:	74 0e                	je     f0108e8f <syscall+0x284>
+	if (r < 0) {
+f0108e81:	85 db                	test   %ebx,%ebx
+f0108e83:	78 31                	js     f0108eb6 <syscall+0x2ab>
+	return 0;
+f0108e85:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return sys_page_alloc_large(a1, (void *) a2, a3);
+f0108e8a:	e9 26 fe ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		r = page_insert_large(e->env_pgdir, p, va, perm);
+f0108e8f:	ff 75 14             	push   0x14(%ebp)
+f0108e92:	ff 75 10             	push   0x10(%ebp)
+f0108e95:	56                   	push   %esi
+f0108e96:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108e99:	ff b0 30 01 00 00    	push   0x130(%eax)
+f0108e9f:	e8 23 9b ff ff       	call   f01029c7 <page_insert_large>
+f0108ea4:	89 c3                	mov    %eax,%ebx
+		env_unlock(e);
+f0108ea6:	83 c4 04             	add    $0x4,%esp
+f0108ea9:	ff 75 e4             	push   -0x1c(%ebp)
+f0108eac:	e8 d5 d2 ff ff       	call   f0106186 <env_unlock>
+f0108eb1:	83 c4 10             	add    $0x10,%esp
+f0108eb4:	eb cb                	jmp    f0108e81 <syscall+0x276>
+		page_free_order(p, PAGE_LARGE_ORDER);
+f0108eb6:	83 ec 08             	sub    $0x8,%esp
+f0108eb9:	6a 0a                	push   $0xa
+f0108ebb:	56                   	push   %esi
+f0108ebc:	e8 4e 91 ff ff       	call   f010200f <page_free_order>
+		return r;
+f0108ec1:	83 c4 10             	add    $0x10,%esp
+f0108ec4:	e9 ec fd ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f0108ec9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108ece:	e9 e2 fd ff ff       	jmp    f0108cb5 <syscall+0xaa>
+f0108ed3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108ed8:	e9 d8 fd ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f0108edd:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108ee2:	e9 ce fd ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_NOT_SUPP;
+f0108ee7:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+f0108eec:	e9 c4 fd ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_NO_MEM;
+f0108ef1:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f0108ef6:	e9 ba fd ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0108efb:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0108eff:	eb 04                	jmp    f0108f05 <syscall+0x2fa>
+f0108f01:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(srcenvid, &srce, 1)) < 0)
+f0108f05:	83 ec 04             	sub    $0x4,%esp
+f0108f08:	6a 01                	push   $0x1
+f0108f0a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0108f0d:	50                   	push   %eax
+f0108f0e:	ff 75 0c             	push   0xc(%ebp)
+f0108f11:	e8 0e d3 ff ff       	call   f0106224 <envid2env>
+f0108f16:	89 c3                	mov    %eax,%ebx
+f0108f18:	83 c4 10             	add    $0x10,%esp
+f0108f1b:	85 c0                	test   %eax,%eax
+f0108f1d:	0f 88 92 fd ff ff    	js     f0108cb5 <syscall+0xaa>
+	if ((r = envid2env(dstenvid, &dste, 1)) < 0)
+f0108f23:	83 ec 04             	sub    $0x4,%esp
+f0108f26:	6a 01                	push   $0x1
+f0108f28:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0108f2b:	50                   	push   %eax
+f0108f2c:	ff 75 14             	push   0x14(%ebp)
+f0108f2f:	e8 f0 d2 ff ff       	call   f0106224 <envid2env>
+f0108f34:	89 c3                	mov    %eax,%ebx
+f0108f36:	83 c4 10             	add    $0x10,%esp
+f0108f39:	85 c0                	test   %eax,%eax
+f0108f3b:	0f 88 74 fd ff ff    	js     f0108cb5 <syscall+0xaa>
+	if ((uintptr_t) srcva >= UTOP || PTE_ADDR(srcva) != (uintptr_t) srcva)
+f0108f41:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0108f48:	77 53                	ja     f0108f9d <syscall+0x392>
+f0108f4a:	8b 55 10             	mov    0x10(%ebp),%edx
+f0108f4d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+	if ((uintptr_t) dstva >= UTOP || PTE_ADDR(dstva) != (uintptr_t) dstva)
+f0108f53:	81 7d 18 ff ff bf ee 	cmpl   $0xeebfffff,0x18(%ebp)
+f0108f5a:	77 4b                	ja     f0108fa7 <syscall+0x39c>
+f0108f5c:	8b 4d 18             	mov    0x18(%ebp),%ecx
+f0108f5f:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+	if (!(perm & (PTE_U|PTE_P)) || (perm & ~PTE_SYSCALL))
+f0108f65:	f6 45 1c 05          	testb  $0x5,0x1c(%ebp)
+f0108f69:	74 46                	je     f0108fb1 <syscall+0x3a6>
+f0108f6b:	8b 45 1c             	mov    0x1c(%ebp),%eax
+f0108f6e:	25 f8 f1 ff ff       	and    $0xfffff1f8,%eax
+f0108f73:	09 c8                	or     %ecx,%eax
+f0108f75:	09 d0                	or     %edx,%eax
+f0108f77:	75 42                	jne    f0108fbb <syscall+0x3b0>
+	return page_map_at(srce, srcenvid, srcva, dste, dstenvid, dstva, perm);
+f0108f79:	ff 75 1c             	push   0x1c(%ebp)
+f0108f7c:	ff 75 18             	push   0x18(%ebp)
+f0108f7f:	ff 75 14             	push   0x14(%ebp)
+f0108f82:	ff 75 e4             	push   -0x1c(%ebp)
+f0108f85:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0108f88:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108f8b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0108f8e:	e8 28 f8 ff ff       	call   f01087bb <page_map_at>
+f0108f93:	89 c3                	mov    %eax,%ebx
+f0108f95:	83 c4 10             	add    $0x10,%esp
+f0108f98:	e9 18 fd ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f0108f9d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108fa2:	e9 0e fd ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f0108fa7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108fac:	e9 04 fd ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f0108fb1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108fb6:	e9 fa fc ff ff       	jmp    f0108cb5 <syscall+0xaa>
+f0108fbb:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+		return sys_page_map(a1, (void *) a2, a3, (void *) a4, a5);
+f0108fc0:	e9 f0 fc ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0108fc5:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0108fc9:	eb 04                	jmp    f0108fcf <syscall+0x3c4>
+f0108fcb:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0108fcf:	83 ec 04             	sub    $0x4,%esp
+f0108fd2:	6a 01                	push   $0x1
+f0108fd4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0108fd7:	50                   	push   %eax
+f0108fd8:	ff 75 0c             	push   0xc(%ebp)
+f0108fdb:	e8 44 d2 ff ff       	call   f0106224 <envid2env>
+f0108fe0:	89 c3                	mov    %eax,%ebx
+f0108fe2:	83 c4 10             	add    $0x10,%esp
+f0108fe5:	85 c0                	test   %eax,%eax
+f0108fe7:	0f 88 c8 fc ff ff    	js     f0108cb5 <syscall+0xaa>
+	if ((uintptr_t) va >= UTOP || PTE_ADDR(va) != (uintptr_t) va)
+f0108fed:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0108ff4:	77 50                	ja     f0109046 <syscall+0x43b>
+f0108ff6:	f7 45 10 ff 0f 00 00 	testl  $0xfff,0x10(%ebp)
+f0108ffd:	75 51                	jne    f0109050 <syscall+0x445>
+	if ((r = env_lock_checked(e, envid)) < 0)
+f0108fff:	83 ec 08             	sub    $0x8,%esp
+f0109002:	ff 75 0c             	push   0xc(%ebp)
+f0109005:	ff 75 e4             	push   -0x1c(%ebp)
+f0109008:	e8 a5 d1 ff ff       	call   f01061b2 <env_lock_checked>
+f010900d:	89 c3                	mov    %eax,%ebx
+f010900f:	83 c4 10             	add    $0x10,%esp
+f0109012:	85 c0                	test   %eax,%eax
+f0109014:	0f 88 9b fc ff ff    	js     f0108cb5 <syscall+0xaa>
+	page_remove(e->env_pgdir, va);
+f010901a:	83 ec 08             	sub    $0x8,%esp
+f010901d:	ff 75 10             	push   0x10(%ebp)
+f0109020:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109023:	ff b0 30 01 00 00    	push   0x130(%eax)
+f0109029:	e8 65 98 ff ff       	call   f0102893 <page_remove>
+	env_unlock(e);
+f010902e:	83 c4 04             	add    $0x4,%esp
+f0109031:	ff 75 e4             	push   -0x1c(%ebp)
+f0109034:	e8 4d d1 ff ff       	call   f0106186 <env_unlock>
+	return 0;
+f0109039:	83 c4 10             	add    $0x10,%esp
+f010903c:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0109041:	e9 6f fc ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f0109046:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f010904b:	e9 65 fc ff ff       	jmp    f0108cb5 <syscall+0xaa>
+f0109050:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+		return sys_page_unmap(a1, (void *) a2);
+f0109055:	e9 5b fc ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f010905a:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f010905e:	eb 04                	jmp    f0109064 <syscall+0x459>
+f0109060:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0109064:	83 ec 04             	sub    $0x4,%esp
+f0109067:	6a 01                	push   $0x1
+f0109069:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010906c:	50                   	push   %eax
+f010906d:	ff 75 0c             	push   0xc(%ebp)
+f0109070:	e8 af d1 ff ff       	call   f0106224 <envid2env>
+f0109075:	89 c3                	mov    %eax,%ebx
+f0109077:	83 c4 10             	add    $0x10,%esp
+f010907a:	85 c0                	test   %eax,%eax
+f010907c:	0f 88 33 fc ff ff    	js     f0108cb5 <syscall+0xaa>
+		return sys_page_alloc_range(a1, (void *) a2, a3, a4);
+f0109082:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (!page_range_ok(va, npages))
+f0109085:	8b 55 14             	mov    0x14(%ebp),%edx
+f0109088:	89 f8                	mov    %edi,%eax
+f010908a:	e8 dc f5 ff ff       	call   f010866b <page_range_ok>
+f010908f:	84 c0                	test   %al,%al
+f0109091:	74 51                	je     f01090e4 <syscall+0x4d9>
+	if (!(perm & (PTE_U|PTE_P)) || (perm & ~PTE_SYSCALL))
+f0109093:	f6 45 18 05          	testb  $0x5,0x18(%ebp)
+f0109097:	74 55                	je     f01090ee <syscall+0x4e3>
+f0109099:	8b 75 18             	mov    0x18(%ebp),%esi
+f010909c:	81 e6 f8 f1 ff ff    	and    $0xfffff1f8,%esi
+f01090a2:	75 54                	jne    f01090f8 <syscall+0x4ed>
+f01090a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++, va += PGSIZE)
+f01090a7:	39 75 14             	cmp    %esi,0x14(%ebp)
+f01090aa:	74 30                	je     f01090dc <syscall+0x4d1>
+		if ((r = page_alloc_at(e, envid, va, perm)) < 0)
+f01090ac:	83 ec 0c             	sub    $0xc,%esp
+f01090af:	ff 75 18             	push   0x18(%ebp)
+f01090b2:	89 f9                	mov    %edi,%ecx
+f01090b4:	89 da                	mov    %ebx,%edx
+f01090b6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01090b9:	e8 da f5 ff ff       	call   f0108698 <page_alloc_at>
+f01090be:	83 c4 10             	add    $0x10,%esp
+f01090c1:	85 c0                	test   %eax,%eax
+f01090c3:	78 0b                	js     f01090d0 <syscall+0x4c5>
+	for (i = 0; i < npages; i++, va += PGSIZE)
+f01090c5:	83 c6 01             	add    $0x1,%esi
+f01090c8:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f01090ce:	eb d7                	jmp    f01090a7 <syscall+0x49c>
+			return i ? i : r;
+f01090d0:	89 c3                	mov    %eax,%ebx
+f01090d2:	85 f6                	test   %esi,%esi
+f01090d4:	0f 45 de             	cmovne %esi,%ebx
+f01090d7:	e9 d9 fb ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	return npages;
+f01090dc:	8b 5d 14             	mov    0x14(%ebp),%ebx
+f01090df:	e9 d1 fb ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f01090e4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01090e9:	e9 c7 fb ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f01090ee:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01090f3:	e9 bd fb ff ff       	jmp    f0108cb5 <syscall+0xaa>
+f01090f8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+		return sys_page_alloc_range(a1, (void *) a2, a3, a4);
+f01090fd:	e9 b3 fb ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0109102:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0109106:	eb 04                	jmp    f010910c <syscall+0x501>
+f0109108:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(srcenvid, &srce, 1)) < 0)
+f010910c:	83 ec 04             	sub    $0x4,%esp
+f010910f:	6a 01                	push   $0x1
+f0109111:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0109114:	50                   	push   %eax
+f0109115:	ff 75 0c             	push   0xc(%ebp)
+f0109118:	e8 07 d1 ff ff       	call   f0106224 <envid2env>
+f010911d:	89 c3                	mov    %eax,%ebx
+f010911f:	83 c4 10             	add    $0x10,%esp
+f0109122:	85 c0                	test   %eax,%eax
+f0109124:	0f 88 8b fb ff ff    	js     f0108cb5 <syscall+0xaa>
+	if ((r = envid2env(dstenvid, &dste, 1)) < 0)
+f010912a:	83 ec 04             	sub    $0x4,%esp
+f010912d:	6a 01                	push   $0x1
+f010912f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0109132:	50                   	push   %eax
+f0109133:	ff 75 14             	push   0x14(%ebp)
+f0109136:	e8 e9 d0 ff ff       	call   f0106224 <envid2env>
+f010913b:	89 c3                	mov    %eax,%ebx
+f010913d:	83 c4 10             	add    $0x10,%esp
+f0109140:	85 c0                	test   %eax,%eax
+f0109142:	0f 88 6d fb ff ff    	js     f0108cb5 <syscall+0xaa>
+		return sys_page_map_range(a1, (void *) a2, a3, (void *) a4,
+f0109148:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+f010914b:	c1 eb 0c             	shr    $0xc,%ebx
+f010914e:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+f0109151:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (!page_range_ok(srcva, npages) || !page_range_ok(dstva, npages))
+f0109154:	89 da                	mov    %ebx,%edx
+f0109156:	89 f0                	mov    %esi,%eax
+f0109158:	e8 0e f5 ff ff       	call   f010866b <page_range_ok>
+f010915d:	84 c0                	test   %al,%al
+f010915f:	0f 84 88 00 00 00    	je     f01091ed <syscall+0x5e2>
+f0109165:	89 da                	mov    %ebx,%edx
+f0109167:	8b 45 18             	mov    0x18(%ebp),%eax
+f010916a:	e8 fc f4 ff ff       	call   f010866b <page_range_ok>
+f010916f:	84 c0                	test   %al,%al
+f0109171:	0f 84 80 00 00 00    	je     f01091f7 <syscall+0x5ec>
+	if (!(perm & (PTE_U|PTE_P)) || (perm & ~PTE_SYSCALL))
+f0109177:	f6 45 1c 05          	testb  $0x5,0x1c(%ebp)
+f010917b:	0f 84 80 00 00 00    	je     f0109201 <syscall+0x5f6>
+f0109181:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+f0109184:	81 e7 f8 01 00 00    	and    $0x1f8,%edi
+f010918a:	75 7f                	jne    f010920b <syscall+0x600>
+		return sys_page_map_range(a1, (void *) a2, a3, (void *) a4,
+f010918c:	8b 45 1c             	mov    0x1c(%ebp),%eax
+f010918f:	25 ff 0f 00 00       	and    $0xfff,%eax
+f0109194:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0109197:	89 da                	mov    %ebx,%edx
+f0109199:	c1 e2 0c             	shl    $0xc,%edx
+f010919c:	01 f2                	add    %esi,%edx
+f010919e:	89 55 d0             	mov    %edx,-0x30(%ebp)
+f01091a1:	8b 5d 18             	mov    0x18(%ebp),%ebx
+f01091a4:	29 f3                	sub    %esi,%ebx
+f01091a6:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+	for (i = 0; i < npages; i++, srcva += PGSIZE, dstva += PGSIZE)
+f01091a9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f01091ac:	39 ce                	cmp    %ecx,%esi
+f01091ae:	74 35                	je     f01091e5 <syscall+0x5da>
+		if ((r = page_map_at(srce, srcenvid, srcva, dste, dstenvid, dstva, perm)) < 0)
+f01091b0:	ff 75 cc             	push   -0x34(%ebp)
+f01091b3:	50                   	push   %eax
+f01091b4:	ff 75 14             	push   0x14(%ebp)
+f01091b7:	ff 75 e4             	push   -0x1c(%ebp)
+f01091ba:	89 f1                	mov    %esi,%ecx
+f01091bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01091bf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01091c2:	e8 f4 f5 ff ff       	call   f01087bb <page_map_at>
+f01091c7:	83 c4 10             	add    $0x10,%esp
+f01091ca:	85 c0                	test   %eax,%eax
+f01091cc:	78 0b                	js     f01091d9 <syscall+0x5ce>
+	for (i = 0; i < npages; i++, srcva += PGSIZE, dstva += PGSIZE)
+f01091ce:	83 c7 01             	add    $0x1,%edi
+f01091d1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01091d7:	eb cd                	jmp    f01091a6 <syscall+0x59b>
+			return i ? i : r;
+f01091d9:	89 c3                	mov    %eax,%ebx
+f01091db:	85 ff                	test   %edi,%edi
+f01091dd:	0f 45 df             	cmovne %edi,%ebx
+f01091e0:	e9 d0 fa ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	return npages;
+f01091e5:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f01091e8:	e9 c8 fa ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f01091ed:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01091f2:	e9 be fa ff ff       	jmp    f0108cb5 <syscall+0xaa>
+f01091f7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01091fc:	e9 b4 fa ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f0109201:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0109206:	e9 aa fa ff ff       	jmp    f0108cb5 <syscall+0xaa>
+f010920b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+		return sys_page_map_range(a1, (void *) a2, a3, (void *) a4,
+f0109210:	e9 a0 fa ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0109215:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0109219:	eb 04                	jmp    f010921f <syscall+0x614>
+f010921b:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f010921f:	83 ec 04             	sub    $0x4,%esp
+f0109222:	6a 01                	push   $0x1
+f0109224:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0109227:	50                   	push   %eax
+f0109228:	ff 75 0c             	push   0xc(%ebp)
+f010922b:	e8 f4 cf ff ff       	call   f0106224 <envid2env>
+f0109230:	89 c3                	mov    %eax,%ebx
+f0109232:	83 c4 10             	add    $0x10,%esp
+f0109235:	85 c0                	test   %eax,%eax
+f0109237:	0f 88 78 fa ff ff    	js     f0108cb5 <syscall+0xaa>
+		return sys_page_unmap_range(a1, (void *) a2, a3);
+f010923d:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (!page_range_ok(va, npages))
+f0109240:	8b 55 14             	mov    0x14(%ebp),%edx
+f0109243:	89 f0                	mov    %esi,%eax
+f0109245:	e8 21 f4 ff ff       	call   f010866b <page_range_ok>
+f010924a:	84 c0                	test   %al,%al
+f010924c:	74 5b                	je     f01092a9 <syscall+0x69e>
+	if ((r = env_lock_checked(e, envid)) < 0)
+f010924e:	83 ec 08             	sub    $0x8,%esp
+f0109251:	ff 75 0c             	push   0xc(%ebp)
+f0109254:	ff 75 e4             	push   -0x1c(%ebp)
+f0109257:	e8 56 cf ff ff       	call   f01061b2 <env_lock_checked>
+f010925c:	89 c3                	mov    %eax,%ebx
+f010925e:	83 c4 10             	add    $0x10,%esp
+f0109261:	85 c0                	test   %eax,%eax
+f0109263:	0f 88 4c fa ff ff    	js     f0108cb5 <syscall+0xaa>
+	for (i = 0; i < npages; i++, va += PGSIZE)
+f0109269:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010926e:	39 5d 14             	cmp    %ebx,0x14(%ebp)
+f0109271:	74 20                	je     f0109293 <syscall+0x688>
+		page_remove(e->env_pgdir, va);
+f0109273:	83 ec 08             	sub    $0x8,%esp
+f0109276:	56                   	push   %esi
+f0109277:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010927a:	ff b0 30 01 00 00    	push   0x130(%eax)
+f0109280:	e8 0e 96 ff ff       	call   f0102893 <page_remove>
+	for (i = 0; i < npages; i++, va += PGSIZE)
+f0109285:	83 c3 01             	add    $0x1,%ebx
+f0109288:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f010928e:	83 c4 10             	add    $0x10,%esp
+f0109291:	eb db                	jmp    f010926e <syscall+0x663>
+	env_unlock(e);
+f0109293:	83 ec 0c             	sub    $0xc,%esp
+f0109296:	ff 75 e4             	push   -0x1c(%ebp)
+f0109299:	e8 e8 ce ff ff       	call   f0106186 <env_unlock>
+	return npages;
+f010929e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+f01092a1:	83 c4 10             	add    $0x10,%esp
+f01092a4:	e9 0c fa ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f01092a9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+		return sys_page_unmap_range(a1, (void *) a2, a3);
+f01092ae:	e9 02 fa ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f01092b3:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f01092b7:	eb 04                	jmp    f01092bd <syscall+0x6b2>
+f01092b9:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f01092bd:	83 ec 04             	sub    $0x4,%esp
+f01092c0:	6a 01                	push   $0x1
+f01092c2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01092c5:	50                   	push   %eax
+f01092c6:	ff 75 0c             	push   0xc(%ebp)
+f01092c9:	e8 56 cf ff ff       	call   f0106224 <envid2env>
+f01092ce:	89 c3                	mov    %eax,%ebx
+f01092d0:	83 c4 10             	add    $0x10,%esp
+f01092d3:	85 c0                	test   %eax,%eax
+f01092d5:	0f 88 da f9 ff ff    	js     f0108cb5 <syscall+0xaa>
+	len = ROUNDUP(len, PGSIZE);
+f01092db:	8b 45 14             	mov    0x14(%ebp),%eax
+f01092de:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+f01092e4:	89 d6                	mov    %edx,%esi
+f01092e6:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!page_range_ok(va, len / PGSIZE) || len == 0)
+f01092ec:	c1 ea 0c             	shr    $0xc,%edx
+f01092ef:	8b 45 10             	mov    0x10(%ebp),%eax
+f01092f2:	e8 74 f3 ff ff       	call   f010866b <page_range_ok>
+f01092f7:	3c 01                	cmp    $0x1,%al
+f01092f9:	75 53                	jne    f010934e <syscall+0x743>
+f01092fb:	85 f6                	test   %esi,%esi
+f01092fd:	74 4f                	je     f010934e <syscall+0x743>
+	if ((perm & (PTE_U|PTE_P)) != (PTE_U|PTE_P) || (perm & ~PTE_SYSCALL))
+f01092ff:	8b 45 18             	mov    0x18(%ebp),%eax
+f0109302:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f0109307:	83 f8 05             	cmp    $0x5,%eax
+f010930a:	75 4c                	jne    f0109358 <syscall+0x74d>
+	if ((r = env_lock_checked(e, envid)) < 0)
+f010930c:	83 ec 08             	sub    $0x8,%esp
+f010930f:	ff 75 0c             	push   0xc(%ebp)
+f0109312:	ff 75 e4             	push   -0x1c(%ebp)
+f0109315:	e8 98 ce ff ff       	call   f01061b2 <env_lock_checked>
+f010931a:	89 c3                	mov    %eax,%ebx
+f010931c:	83 c4 10             	add    $0x10,%esp
+f010931f:	85 c0                	test   %eax,%eax
+f0109321:	0f 88 8e f9 ff ff    	js     f0108cb5 <syscall+0xaa>
+	r = env_region_add(e, (uintptr_t) va, (uintptr_t) va + len, perm);
+f0109327:	ff 75 18             	push   0x18(%ebp)
+f010932a:	03 75 10             	add    0x10(%ebp),%esi
+f010932d:	56                   	push   %esi
+f010932e:	ff 75 10             	push   0x10(%ebp)
+f0109331:	ff 75 e4             	push   -0x1c(%ebp)
+f0109334:	e8 ec d2 ff ff       	call   f0106625 <env_region_add>
+f0109339:	89 c3                	mov    %eax,%ebx
+	env_unlock(e);
+f010933b:	83 c4 04             	add    $0x4,%esp
+f010933e:	ff 75 e4             	push   -0x1c(%ebp)
+f0109341:	e8 40 ce ff ff       	call   f0106186 <env_unlock>
+	return r;
+f0109346:	83 c4 10             	add    $0x10,%esp
+f0109349:	e9 67 f9 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f010934e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0109353:	e9 5d f9 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f0109358:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+		return sys_region_reserve(a1, (void *) a2, a3, a4);
+f010935d:	e9 53 f9 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0109362:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0109366:	eb 04                	jmp    f010936c <syscall+0x761>
+f0109368:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = env_alloc(&e, curenv->env_id)) < 0)
+f010936c:	e8 d3 18 00 00       	call   f010ac44 <cpunum>
+f0109371:	83 ec 08             	sub    $0x8,%esp
+f0109374:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010937a:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0109380:	ff 70 4c             	push   0x4c(%eax)
+f0109383:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0109386:	50                   	push   %eax
+f0109387:	e8 11 d0 ff ff       	call   f010639d <env_alloc>
+f010938c:	89 c3                	mov    %eax,%ebx
+f010938e:	83 c4 10             	add    $0x10,%esp
+f0109391:	85 c0                	test   %eax,%eax
+f0109393:	0f 88 1c f9 ff ff    	js     f0108cb5 <syscall+0xaa>
+	sched_dequeue(e);
+f0109399:	83 ec 0c             	sub    $0xc,%esp
+f010939c:	ff 75 e4             	push   -0x1c(%ebp)
+f010939f:	e8 e4 ea ff ff       	call   f0107e88 <sched_dequeue>
+	e->env_status = ENV_NOT_RUNNABLE;
+f01093a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01093a7:	c7 40 58 04 00 00 00 	movl   $0x4,0x58(%eax)
+	e->env_cpumask = curenv->env_cpumask;
+f01093ae:	e8 91 18 00 00       	call   f010ac44 <cpunum>
+f01093b3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01093b9:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01093bf:	8b 90 84 00 00 00    	mov    0x84(%eax),%edx
+f01093c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01093c8:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+	e->env_tf = curenv->env_tf;
+f01093ce:	e8 71 18 00 00       	call   f010ac44 <cpunum>
+f01093d3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01093d9:	8b b0 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%esi
+f01093df:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01093e2:	b9 11 00 00 00       	mov    $0x11,%ecx
+f01093e7:	89 c7                	mov    %eax,%edi
+f01093e9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	e->env_tf.tf_regs.reg_eax = 0;
+f01093eb:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	return e->env_id;
+f01093f2:	8b 58 4c             	mov    0x4c(%eax),%ebx
+f01093f5:	83 c4 10             	add    $0x10,%esp
+		return sys_exofork();
+f01093f8:	e9 b8 f8 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f01093fd:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0109401:	eb 04                	jmp    f0109407 <syscall+0x7fc>
+f0109403:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = env_alloc(&e, curenv->env_id)) < 0)
+f0109407:	e8 38 18 00 00       	call   f010ac44 <cpunum>
+f010940c:	83 ec 08             	sub    $0x8,%esp
+f010940f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0109415:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f010941b:	ff 70 4c             	push   0x4c(%eax)
+f010941e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0109421:	50                   	push   %eax
+f0109422:	e8 76 cf ff ff       	call   f010639d <env_alloc>
+f0109427:	89 c3                	mov    %eax,%ebx
+f0109429:	83 c4 10             	add    $0x10,%esp
+f010942c:	85 c0                	test   %eax,%eax
+f010942e:	0f 88 81 f8 ff ff    	js     f0108cb5 <syscall+0xaa>
+	sched_dequeue(e);
+f0109434:	83 ec 0c             	sub    $0xc,%esp
+f0109437:	ff 75 e4             	push   -0x1c(%ebp)
+f010943a:	e8 49 ea ff ff       	call   f0107e88 <sched_dequeue>
+	e->env_status = ENV_NOT_RUNNABLE;
+f010943f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109442:	c7 40 58 04 00 00 00 	movl   $0x4,0x58(%eax)
+	e->env_cpumask = curenv->env_cpumask;
+f0109449:	e8 f6 17 00 00       	call   f010ac44 <cpunum>
+f010944e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0109454:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f010945a:	8b 90 84 00 00 00    	mov    0x84(%eax),%edx
+f0109460:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109463:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+	e->env_tf = curenv->env_tf;
+f0109469:	e8 d6 17 00 00       	call   f010ac44 <cpunum>
+f010946e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0109474:	8b b0 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%esi
+f010947a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010947d:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0109482:	89 c7                	mov    %eax,%edi
+f0109484:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	e->env_tf.tf_regs.reg_eax = 0;
+f0109486:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+f010948d:	e8 b2 17 00 00       	call   f010ac44 <cpunum>
+f0109492:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0109498:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f010949e:	8b 90 94 01 00 00    	mov    0x194(%eax),%edx
+f01094a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01094a7:	89 90 94 01 00 00    	mov    %edx,0x194(%eax)
+	e->env_kernel_cow = curenv->env_kernel_cow;
+f01094ad:	e8 92 17 00 00       	call   f010ac44 <cpunum>
+f01094b2:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01094b8:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01094be:	0f b6 90 98 01 00 00 	movzbl 0x198(%eax),%edx
+f01094c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01094c8:	88 90 98 01 00 00    	mov    %dl,0x198(%eax)
+	env_lock(curenv);
+f01094ce:	e8 71 17 00 00       	call   f010ac44 <cpunum>
+f01094d3:	83 c4 04             	add    $0x4,%esp
+f01094d6:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01094dc:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f01094e2:	e8 73 cc ff ff       	call   f010615a <env_lock>
+	r = pgdir_copy_cow(e->env_pgdir, curenv->env_pgdir);
+f01094e7:	e8 58 17 00 00       	call   f010ac44 <cpunum>
+f01094ec:	83 c4 08             	add    $0x8,%esp
+f01094ef:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01094f5:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01094fb:	ff b0 30 01 00 00    	push   0x130(%eax)
+f0109501:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109504:	ff b0 30 01 00 00    	push   0x130(%eax)
+f010950a:	e8 ea 98 ff ff       	call   f0102df9 <pgdir_copy_cow>
+f010950f:	89 c3                	mov    %eax,%ebx
+	memcpy(e->env_regions, curenv->env_regions, sizeof(e->env_regions));
+f0109511:	e8 2e 17 00 00       	call   f010ac44 <cpunum>
+f0109516:	83 c4 0c             	add    $0xc,%esp
+f0109519:	6a 60                	push   $0x60
+f010951b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0109521:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0109527:	05 34 01 00 00       	add    $0x134,%eax
+f010952c:	50                   	push   %eax
+f010952d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109530:	05 34 01 00 00       	add    $0x134,%eax
+f0109535:	50                   	push   %eax
+f0109536:	e8 5a 11 00 00       	call   f010a695 <memcpy>
+	env_unlock(curenv);
+f010953b:	e8 04 17 00 00       	call   f010ac44 <cpunum>
+f0109540:	83 c4 04             	add    $0x4,%esp
+f0109543:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0109549:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f010954f:	e8 32 cc ff ff       	call   f0106186 <env_unlock>
+	if (r == 0 && !(p = page_alloc(ALLOC_ZERO|ALLOC_HIGH)))
+f0109554:	83 c4 10             	add    $0x10,%esp
+f0109557:	85 db                	test   %ebx,%ebx
+f0109559:	74 27                	je     f0109582 <syscall+0x977>
+	if (r < 0) {
+f010955b:	0f 88 a6 04 00 00    	js     f0109a07 <syscall+0xdfc>
+	e->env_status = ENV_RUNNABLE;
+f0109561:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109564:	c7 40 58 02 00 00 00 	movl   $0x2,0x58(%eax)
+	sched_enqueue(e);
+f010956b:	83 ec 0c             	sub    $0xc,%esp
+f010956e:	50                   	push   %eax
+f010956f:	e8 80 e7 ff ff       	call   f0107cf4 <sched_enqueue>
+	return e->env_id;
+f0109574:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109577:	8b 58 4c             	mov    0x4c(%eax),%ebx
+f010957a:	83 c4 10             	add    $0x10,%esp
+		return sys_fork_cow();
+f010957d:	e9 33 f7 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	if (r == 0 && !(p = page_alloc(ALLOC_ZERO|ALLOC_HIGH)))
+f0109582:	83 ec 0c             	sub    $0xc,%esp
+f0109585:	6a 03                	push   $0x3
+f0109587:	e8 3e 8d ff ff       	call   f01022ca <page_alloc>
+f010958c:	89 c6                	mov    %eax,%esi
+f010958e:	83 c4 10             	add    $0x10,%esp
+f0109591:	85 c0                	test   %eax,%eax
+f0109593:	0f 84 69 04 00 00    	je     f0109a02 <syscall+0xdf7>
+	if (r == 0 && (r = page_insert(e->env_pgdir, p, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+f0109599:	6a 07                	push   $0x7
+f010959b:	68 00 f0 bf ee       	push   $0xeebff000
+f01095a0:	50                   	push   %eax
+f01095a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01095a4:	ff b0 30 01 00 00    	push   0x130(%eax)
+f01095aa:	e8 99 93 ff ff       	call   f0102948 <page_insert>
+f01095af:	89 c3                	mov    %eax,%ebx
+f01095b1:	83 c4 10             	add    $0x10,%esp
+f01095b4:	85 c0                	test   %eax,%eax
+f01095b6:	79 a9                	jns    f0109561 <syscall+0x956>
+		page_free(p);
+f01095b8:	83 ec 0c             	sub    $0xc,%esp
+f01095bb:	56                   	push   %esi
+f01095bc:	e8 f0 88 ff ff       	call   f0101eb1 <page_free>
+f01095c1:	83 c4 10             	add    $0x10,%esp
+f01095c4:	e9 3e 04 00 00       	jmp    f0109a07 <syscall+0xdfc>
+	switch (syscallno) {
+f01095c9:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f01095cd:	eb 04                	jmp    f01095d3 <syscall+0x9c8>
+f01095cf:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if (status != ENV_RUNNABLE && status != ENV_NOT_RUNNABLE)
+f01095d3:	8b 45 10             	mov    0x10(%ebp),%eax
+f01095d6:	83 e8 02             	sub    $0x2,%eax
+f01095d9:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+f01095de:	75 6f                	jne    f010964f <syscall+0xa44>
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f01095e0:	83 ec 04             	sub    $0x4,%esp
+f01095e3:	6a 01                	push   $0x1
+f01095e5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01095e8:	50                   	push   %eax
+f01095e9:	ff 75 0c             	push   0xc(%ebp)
+f01095ec:	e8 33 cc ff ff       	call   f0106224 <envid2env>
+f01095f1:	89 c3                	mov    %eax,%ebx
+f01095f3:	83 c4 10             	add    $0x10,%esp
+f01095f6:	85 c0                	test   %eax,%eax
+f01095f8:	0f 88 b7 f6 ff ff    	js     f0108cb5 <syscall+0xaa>
+	if (status == ENV_RUNNABLE) {
+f01095fe:	83 7d 10 02          	cmpl   $0x2,0x10(%ebp)
+f0109602:	74 21                	je     f0109625 <syscall+0xa1a>
+	sched_dequeue(e);
+f0109604:	83 ec 0c             	sub    $0xc,%esp
+f0109607:	ff 75 e4             	push   -0x1c(%ebp)
+f010960a:	e8 79 e8 ff ff       	call   f0107e88 <sched_dequeue>
+	e->env_status = status;
+f010960f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109612:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0109615:	89 78 58             	mov    %edi,0x58(%eax)
+	return 0;
+f0109618:	83 c4 10             	add    $0x10,%esp
+f010961b:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0109620:	e9 90 f6 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		if (e->env_status == ENV_NOT_RUNNABLE) {
+f0109625:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+		return 0;
+f0109628:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (e->env_status == ENV_NOT_RUNNABLE) {
+f010962d:	83 78 58 04          	cmpl   $0x4,0x58(%eax)
+f0109631:	0f 85 7e f6 ff ff    	jne    f0108cb5 <syscall+0xaa>
+			e->env_status = ENV_RUNNABLE;
+f0109637:	c7 40 58 02 00 00 00 	movl   $0x2,0x58(%eax)
+			sched_enqueue(e);
+f010963e:	83 ec 0c             	sub    $0xc,%esp
+f0109641:	50                   	push   %eax
+f0109642:	e8 ad e6 ff ff       	call   f0107cf4 <sched_enqueue>
+f0109647:	83 c4 10             	add    $0x10,%esp
+f010964a:	e9 66 f6 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f010964f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0109654:	e9 5c f6 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0109659:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f010965d:	eb 04                	jmp    f0109663 <syscall+0xa58>
+f010965f:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+		return sys_env_set_priority(a1, a2);
+f0109663:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (prio != ENV_PRIO_DYNAMIC &&
+f0109666:	89 f0                	mov    %esi,%eax
+f0109668:	83 c0 01             	add    $0x1,%eax
+f010966b:	83 f8 04             	cmp    $0x4,%eax
+f010966e:	77 58                	ja     f01096c8 <syscall+0xabd>
+	if (prio != ENV_PRIO_DYNAMIC && prio != ENV_PRIO_LOWEST &&
+f0109670:	83 fe ff             	cmp    $0xffffffff,%esi
+f0109673:	74 1c                	je     f0109691 <syscall+0xa86>
+f0109675:	83 fe 03             	cmp    $0x3,%esi
+f0109678:	74 17                	je     f0109691 <syscall+0xa86>
+	    curenv->env_type == ENV_TYPE_USER)
+f010967a:	e8 c5 15 00 00       	call   f010ac44 <cpunum>
+f010967f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0109685:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+	if (prio != ENV_PRIO_DYNAMIC && prio != ENV_PRIO_LOWEST &&
+f010968b:	83 78 54 00          	cmpl   $0x0,0x54(%eax)
+f010968f:	74 41                	je     f01096d2 <syscall+0xac7>
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0109691:	83 ec 04             	sub    $0x4,%esp
+f0109694:	6a 01                	push   $0x1
+f0109696:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0109699:	50                   	push   %eax
+f010969a:	ff 75 0c             	push   0xc(%ebp)
+f010969d:	e8 82 cb ff ff       	call   f0106224 <envid2env>
+f01096a2:	89 c3                	mov    %eax,%ebx
+f01096a4:	83 c4 10             	add    $0x10,%esp
+f01096a7:	85 c0                	test   %eax,%eax
+f01096a9:	0f 88 06 f6 ff ff    	js     f0108cb5 <syscall+0xaa>
+	sched_set_priority(e, prio);
+f01096af:	83 ec 08             	sub    $0x8,%esp
+f01096b2:	56                   	push   %esi
+f01096b3:	ff 75 e4             	push   -0x1c(%ebp)
+f01096b6:	e8 53 e9 ff ff       	call   f010800e <sched_set_priority>
+	return 0;
+f01096bb:	83 c4 10             	add    $0x10,%esp
+f01096be:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01096c3:	e9 ed f5 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f01096c8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01096cd:	e9 e3 f5 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f01096d2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+		return sys_env_set_priority(a1, a2);
+f01096d7:	e9 d9 f5 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f01096dc:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f01096e0:	eb 04                	jmp    f01096e6 <syscall+0xadb>
+f01096e2:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if (ncpu < 32)
+f01096e6:	8b 0d 04 96 61 f0    	mov    0xf0619604,%ecx
+f01096ec:	83 f9 1f             	cmp    $0x1f,%ecx
+f01096ef:	7f 0d                	jg     f01096fe <syscall+0xaf3>
+		mask &= (1 << ncpu) - 1;
+f01096f1:	b8 01 00 00 00       	mov    $0x1,%eax
+f01096f6:	d3 e0                	shl    %cl,%eax
+f01096f8:	83 e8 01             	sub    $0x1,%eax
+f01096fb:	21 45 10             	and    %eax,0x10(%ebp)
+	if (!mask)
+f01096fe:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0109702:	74 65                	je     f0109769 <syscall+0xb5e>
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0109704:	83 ec 04             	sub    $0x4,%esp
+f0109707:	6a 01                	push   $0x1
+f0109709:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010970c:	50                   	push   %eax
+f010970d:	ff 75 0c             	push   0xc(%ebp)
+f0109710:	e8 0f cb ff ff       	call   f0106224 <envid2env>
+f0109715:	89 c3                	mov    %eax,%ebx
+f0109717:	83 c4 10             	add    $0x10,%esp
+f010971a:	85 c0                	test   %eax,%eax
+f010971c:	0f 88 93 f5 ff ff    	js     f0108cb5 <syscall+0xaa>
+	e->env_cpumask = mask;
+f0109722:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109725:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0109728:	89 b8 84 00 00 00    	mov    %edi,0x84(%eax)
+	if (e->env_rq_cpu >= 0 && !(mask & (1 << e->env_rq_cpu))) {
+f010972e:	8b 48 6c             	mov    0x6c(%eax),%ecx
+	return 0;
+f0109731:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (e->env_rq_cpu >= 0 && !(mask & (1 << e->env_rq_cpu))) {
+f0109736:	85 c9                	test   %ecx,%ecx
+f0109738:	0f 88 77 f5 ff ff    	js     f0108cb5 <syscall+0xaa>
+f010973e:	ba 01 00 00 00       	mov    $0x1,%edx
+f0109743:	d3 e2                	shl    %cl,%edx
+f0109745:	85 d7                	test   %edx,%edi
+f0109747:	0f 85 68 f5 ff ff    	jne    f0108cb5 <syscall+0xaa>
+		sched_dequeue(e);
+f010974d:	83 ec 0c             	sub    $0xc,%esp
+f0109750:	50                   	push   %eax
+f0109751:	e8 32 e7 ff ff       	call   f0107e88 <sched_dequeue>
+		sched_enqueue(e);
+f0109756:	83 c4 04             	add    $0x4,%esp
+f0109759:	ff 75 e4             	push   -0x1c(%ebp)
+f010975c:	e8 93 e5 ff ff       	call   f0107cf4 <sched_enqueue>
+f0109761:	83 c4 10             	add    $0x10,%esp
+f0109764:	e9 4c f5 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f0109769:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f010976e:	e9 42 f5 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0109773:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0109777:	eb 04                	jmp    f010977d <syscall+0xb72>
+f0109779:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f010977d:	83 ec 04             	sub    $0x4,%esp
+f0109780:	6a 01                	push   $0x1
+f0109782:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0109785:	50                   	push   %eax
+f0109786:	ff 75 0c             	push   0xc(%ebp)
+f0109789:	e8 96 ca ff ff       	call   f0106224 <envid2env>
+f010978e:	89 c3                	mov    %eax,%ebx
+f0109790:	83 c4 10             	add    $0x10,%esp
+f0109793:	85 c0                	test   %eax,%eax
+f0109795:	0f 88 1a f5 ff ff    	js     f0108cb5 <syscall+0xaa>
+	tf->tf_cs = GD_UT | 3;
+f010979b:	8b 45 10             	mov    0x10(%ebp),%eax
+f010979e:	66 c7 40 34 1b 00    	movw   $0x1b,0x34(%eax)
+	tf->tf_eflags |= FL_IF; 
+f01097a4:	81 48 38 00 02 00 00 	orl    $0x200,0x38(%eax)
+	e->env_tf = *tf;
+f01097ab:	b9 11 00 00 00       	mov    $0x11,%ecx
+f01097b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01097b3:	89 c6                	mov    %eax,%esi
+f01097b5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		return sys_env_set_trapframe(a1, (struct Trapframe *) a2);
+f01097b7:	e9 f9 f4 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f01097bc:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f01097c0:	eb 04                	jmp    f01097c6 <syscall+0xbbb>
+f01097c2:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f01097c6:	83 ec 04             	sub    $0x4,%esp
+f01097c9:	6a 01                	push   $0x1
+f01097cb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01097ce:	50                   	push   %eax
+f01097cf:	ff 75 0c             	push   0xc(%ebp)
+f01097d2:	e8 4d ca ff ff       	call   f0106224 <envid2env>
+f01097d7:	89 c3                	mov    %eax,%ebx
+f01097d9:	83 c4 10             	add    $0x10,%esp
+f01097dc:	85 c0                	test   %eax,%eax
+f01097de:	0f 88 d1 f4 ff ff    	js     f0108cb5 <syscall+0xaa>
+	e->env_kernel_cow = !!enable;
+f01097e4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01097e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01097eb:	0f 95 80 98 01 00 00 	setne  0x198(%eax)
+	return 0;
+f01097f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return sys_env_set_kernel_cow(a1, a2);
+f01097f7:	e9 b9 f4 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f01097fc:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0109800:	eb 04                	jmp    f0109806 <syscall+0xbfb>
+f0109802:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0109806:	83 ec 04             	sub    $0x4,%esp
+f0109809:	6a 01                	push   $0x1
+f010980b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010980e:	50                   	push   %eax
+f010980f:	ff 75 0c             	push   0xc(%ebp)
+f0109812:	e8 0d ca ff ff       	call   f0106224 <envid2env>
+f0109817:	89 c3                	mov    %eax,%ebx
+f0109819:	83 c4 10             	add    $0x10,%esp
+f010981c:	85 c0                	test   %eax,%eax
+f010981e:	0f 88 91 f4 ff ff    	js     f0108cb5 <syscall+0xaa>
+	e->env_pgfault_upcall = func;
+f0109824:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109827:	8b 7d 10             	mov    0x10(%ebp),%edi
+f010982a:	89 b8 94 01 00 00    	mov    %edi,0x194(%eax)
+	return 0;
+f0109830:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return sys_env_set_pgfault_upcall(a1, (void *) a2);
+f0109835:	e9 7b f4 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	sched_yield();
+f010983a:	e8 5f ea ff ff       	call   f010829e <sched_yield>
+	switch (syscallno) {
+f010983f:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0109843:	eb 04                	jmp    f0109849 <syscall+0xc3e>
+f0109845:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+		return sys_ipc_try_send(a1, a2, (void *)a3, a4, 0);
+f0109849:	83 ec 08             	sub    $0x8,%esp
+f010984c:	6a 00                	push   $0x0
+f010984e:	ff 75 18             	push   0x18(%ebp)
+f0109851:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0109854:	8b 55 10             	mov    0x10(%ebp),%edx
+f0109857:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010985a:	e8 03 f0 ff ff       	call   f0108862 <sys_ipc_try_send>
+f010985f:	89 c3                	mov    %eax,%ebx
+f0109861:	83 c4 10             	add    $0x10,%esp
+f0109864:	e9 4c f4 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0109869:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f010986d:	eb 04                	jmp    f0109873 <syscall+0xc68>
+f010986f:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+		return sys_ipc_try_send(a1, a2, (void *)a3, a4, 1);
+f0109873:	83 ec 08             	sub    $0x8,%esp
+f0109876:	6a 01                	push   $0x1
+f0109878:	ff 75 18             	push   0x18(%ebp)
+f010987b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f010987e:	8b 55 10             	mov    0x10(%ebp),%edx
+f0109881:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0109884:	e8 d9 ef ff ff       	call   f0108862 <sys_ipc_try_send>
+f0109889:	89 c3                	mov    %eax,%ebx
+f010988b:	83 c4 10             	add    $0x10,%esp
+f010988e:	e9 22 f4 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0109893:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0109897:	eb 04                	jmp    f010989d <syscall+0xc92>
+f0109899:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((uintptr_t) dstva < UTOP) {
+f010989d:	81 7d 0c ff ff bf ee 	cmpl   $0xeebfffff,0xc(%ebp)
+f01098a4:	77 13                	ja     f01098b9 <syscall+0xcae>
+		if (PTE_ADDR(dstva) != (uint32_t) dstva)
+f01098a6:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+f01098ad:	74 0a                	je     f01098b9 <syscall+0xcae>
+		return sys_ipc_recv((void *) a1);
+f01098af:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01098b4:	e9 fc f3 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	env_lock(curenv);
+f01098b9:	e8 86 13 00 00       	call   f010ac44 <cpunum>
+f01098be:	83 ec 0c             	sub    $0xc,%esp
+f01098c1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01098c7:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f01098cd:	e8 88 c8 ff ff       	call   f010615a <env_lock>
+	curenv->env_ipc_dstva = dstva;
+f01098d2:	e8 6d 13 00 00       	call   f010ac44 <cpunum>
+f01098d7:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01098dd:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01098e3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f01098e6:	89 b8 9c 01 00 00    	mov    %edi,0x19c(%eax)
+	curenv->env_ipc_recving = 1;
+f01098ec:	e8 53 13 00 00       	call   f010ac44 <cpunum>
+f01098f1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f01098f7:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f01098fd:	c6 80 99 01 00 00 01 	movb   $0x1,0x199(%eax)
+	curenv->env_status = ENV_NOT_RUNNABLE;
+f0109904:	e8 3b 13 00 00       	call   f010ac44 <cpunum>
+f0109909:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010990f:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0109915:	c7 40 58 04 00 00 00 	movl   $0x4,0x58(%eax)
+	env_unlock(curenv);
+f010991c:	e8 23 13 00 00       	call   f010ac44 <cpunum>
+f0109921:	83 c4 04             	add    $0x4,%esp
+f0109924:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010992a:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0109930:	e8 51 c8 ff ff       	call   f0106186 <env_unlock>
+	curenv->env_tf.tf_regs.reg_eax = 0;
+f0109935:	e8 0a 13 00 00       	call   f010ac44 <cpunum>
+f010993a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0109940:	8b 80 28 90 61 f0    	mov    -0xf9e6fd8(%eax),%eax
+f0109946:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	sched_yield();
+f010994d:	e8 4c e9 ff ff       	call   f010829e <sched_yield>
+	switch (syscallno) {
+f0109952:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0109956:	eb 04                	jmp    f010995c <syscall+0xd51>
+f0109958:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	return time_msec();
+f010995c:	e8 eb 21 00 00       	call   f010bb4c <time_msec>
+f0109961:	89 c3                	mov    %eax,%ebx
+		return sys_time_msec();
+f0109963:	e9 4d f3 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0109968:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f010996c:	eb 04                	jmp    f0109972 <syscall+0xd67>
+f010996e:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((uintptr_t) data >= UTOP)
+f0109972:	81 7d 0c ff ff bf ee 	cmpl   $0xeebfffff,0xc(%ebp)
+f0109979:	77 4d                	ja     f01099c8 <syscall+0xdbd>
+	return e1000_transmit(data, size);
+f010997b:	83 ec 08             	sub    $0x8,%esp
+f010997e:	ff 75 10             	push   0x10(%ebp)
+f0109981:	ff 75 0c             	push   0xc(%ebp)
+f0109984:	e8 0b 1b 00 00       	call   f010b494 <e1000_transmit>
+f0109989:	89 c3                	mov    %eax,%ebx
+f010998b:	83 c4 10             	add    $0x10,%esp
+f010998e:	e9 22 f3 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f0109993:	c6 45 d7 01          	movb   $0x1,-0x29(%ebp)
+f0109997:	eb 04                	jmp    f010999d <syscall+0xd92>
+f0109999:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+	if ((uintptr_t) data >= UTOP)
+f010999d:	81 7d 0c ff ff bf ee 	cmpl   $0xeebfffff,0xc(%ebp)
+f01099a4:	77 2c                	ja     f01099d2 <syscall+0xdc7>
+	r = e1000_receive(data);
+f01099a6:	83 ec 0c             	sub    $0xc,%esp
+f01099a9:	ff 75 0c             	push   0xc(%ebp)
+f01099ac:	e8 6f 1b 00 00       	call   f010b520 <e1000_receive>
+f01099b1:	89 c3                	mov    %eax,%ebx
+	if (r > 0)
+f01099b3:	83 c4 10             	add    $0x10,%esp
+f01099b6:	85 c0                	test   %eax,%eax
+f01099b8:	0f 8e f7 f2 ff ff    	jle    f0108cb5 <syscall+0xaa>
+		*size = r;
+f01099be:	8b 45 10             	mov    0x10(%ebp),%eax
+f01099c1:	89 18                	mov    %ebx,(%eax)
+f01099c3:	e9 ed f2 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f01099c8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01099cd:	e9 e3 f2 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+		return -E_INVAL;
+f01099d2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01099d7:	e9 d9 f2 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+	switch (syscallno) {
+f01099dc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+	spin_unlock(&kernel_lock);
+f01099e1:	83 ec 0c             	sub    $0xc,%esp
+f01099e4:	68 c0 95 11 f0       	push   $0xf01195c0
+f01099e9:	e8 01 16 00 00       	call   f010afef <spin_unlock>
+	asm volatile("pause");
+f01099ee:	f3 90                	pause
+}
+f01099f0:	83 c4 10             	add    $0x10,%esp
+f01099f3:	e9 c7 f2 ff ff       	jmp    f0108cbf <syscall+0xb4>
+f01099f8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+	return r;
+f01099fd:	e9 bd f2 ff ff       	jmp    f0108cbf <syscall+0xb4>
+		r = -E_NO_MEM;
+f0109a02:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+		env_free(e);
+f0109a07:	83 ec 0c             	sub    $0xc,%esp
+f0109a0a:	ff 75 e4             	push   -0x1c(%ebp)
+f0109a0d:	e8 63 cf ff ff       	call   f0106975 <env_free>
+		return r;
+f0109a12:	83 c4 10             	add    $0x10,%esp
+f0109a15:	e9 9b f2 ff ff       	jmp    f0108cb5 <syscall+0xaa>
+
+f0109a1a <stab_binsearch>:
+//	will exit setting left = 118, right = 554.
+//
+static void
+stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
+	       int type, uintptr_t addr)
+{
+f0109a1a:	55                   	push   %ebp
+f0109a1b:	89 e5                	mov    %esp,%ebp
+f0109a1d:	57                   	push   %edi
+f0109a1e:	56                   	push   %esi
+f0109a1f:	53                   	push   %ebx
+f0109a20:	83 ec 14             	sub    $0x14,%esp
+f0109a23:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0109a26:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0109a29:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	int l = *region_left, r = *region_right, any_matches = 0;
+f0109a2c:	8b 1a                	mov    (%edx),%ebx
+f0109a2e:	8b 09                	mov    (%ecx),%ecx
+f0109a30:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+
+	while (l <= r) {
+f0109a37:	eb 4f                	jmp    f0109a88 <stab_binsearch+0x6e>
+		int true_m = (l + r) / 2, m = true_m;
+
+		// search for earliest stab with right type
+		while (m >= l && stabs[m].n_type != type)
+			m--;
+f0109a39:	83 e8 01             	sub    $0x1,%eax
+		while (m >= l && stabs[m].n_type != type)
+f0109a3c:	39 c3                	cmp    %eax,%ebx
+f0109a3e:	0f 8f cc 00 00 00    	jg     f0109b10 <stab_binsearch+0xf6>
+f0109a44:	0f b6 0a             	movzbl (%edx),%ecx
+f0109a47:	83 ea 0c             	sub    $0xc,%edx
+f0109a4a:	39 f1                	cmp    %esi,%ecx
+f0109a4c:	75 eb                	jne    f0109a39 <stab_binsearch+0x1f>
+f0109a4e:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0109a51:	89 75 08             	mov    %esi,0x8(%ebp)
+			continue;
+		}
+
+		// actual binary search
+		any_matches = 1;
+		if (stabs[m].n_value < addr) {
+f0109a54:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0109a57:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f0109a5a:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f0109a5e:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f0109a61:	72 16                	jb     f0109a79 <stab_binsearch+0x5f>
+			*region_left = m;
+			l = true_m + 1;
+		} else if (stabs[m].n_value > addr) {
+f0109a63:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f0109a66:	73 48                	jae    f0109ab0 <stab_binsearch+0x96>
+			*region_right = m - 1;
+f0109a68:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f0109a6b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0109a6e:	89 08                	mov    %ecx,(%eax)
+		any_matches = 1;
+f0109a70:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0109a77:	eb 0f                	jmp    f0109a88 <stab_binsearch+0x6e>
+			*region_left = m;
+f0109a79:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0109a7c:	89 06                	mov    %eax,(%esi)
+			l = true_m + 1;
+f0109a7e:	8d 5f 01             	lea    0x1(%edi),%ebx
+		any_matches = 1;
+f0109a81:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+	while (l <= r) {
+f0109a88:	39 cb                	cmp    %ecx,%ebx
+f0109a8a:	7f 38                	jg     f0109ac4 <stab_binsearch+0xaa>
+		int true_m = (l + r) / 2, m = true_m;
+f0109a8c:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f0109a8f:	89 c2                	mov    %eax,%edx
+f0109a91:	c1 ea 1f             	shr    $0x1f,%edx
+f0109a94:	01 d0                	add    %edx,%eax
+f0109a96:	89 c7                	mov    %eax,%edi
+f0109a98:	d1 ff                	sar    %edi
+		while (m >= l && stabs[m].n_type != type)
+f0109a9a:	83 e0 fe             	and    $0xfffffffe,%eax
+f0109a9d:	01 f8                	add    %edi,%eax
+f0109a9f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f0109aa2:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+		int true_m = (l + r) / 2, m = true_m;
+f0109aa6:	89 f8                	mov    %edi,%eax
+f0109aa8:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+f0109aab:	8b 75 08             	mov    0x8(%ebp),%esi
+		while (m >= l && stabs[m].n_type != type)
+f0109aae:	eb 8c                	jmp    f0109a3c <stab_binsearch+0x22>
+			r = m - 1;
+		} else {
+			// exact match for 'addr', but continue loop to find
+			// *region_right
+			*region_left = m;
+f0109ab0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0109ab3:	89 07                	mov    %eax,(%edi)
+			l = m;
+			addr++;
+f0109ab5:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f0109ab9:	89 c3                	mov    %eax,%ebx
+		any_matches = 1;
+f0109abb:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0109ac2:	eb c4                	jmp    f0109a88 <stab_binsearch+0x6e>
+		}
+	}
+
+	if (!any_matches)
+f0109ac4:	8b 75 08             	mov    0x8(%ebp),%esi
+f0109ac7:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f0109acb:	75 15                	jne    f0109ae2 <stab_binsearch+0xc8>
+		*region_right = *region_left - 1;
+f0109acd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109ad0:	8b 00                	mov    (%eax),%eax
+f0109ad2:	83 e8 01             	sub    $0x1,%eax
+f0109ad5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0109ad8:	89 07                	mov    %eax,(%edi)
+		     l > *region_left && stabs[l].n_type != type;
+		     l--)
+			/* do nothing */;
+		*region_left = l;
+	}
+}
+f0109ada:	83 c4 14             	add    $0x14,%esp
+f0109add:	5b                   	pop    %ebx
+f0109ade:	5e                   	pop    %esi
+f0109adf:	5f                   	pop    %edi
+f0109ae0:	5d                   	pop    %ebp
+f0109ae1:	c3                   	ret
+		for (l = *region_right;
+f0109ae2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0109ae5:	8b 00                	mov    (%eax),%eax
+		     l > *region_left && stabs[l].n_type != type;
+f0109ae7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0109aea:	8b 0f                	mov    (%edi),%ecx
+f0109aec:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0109aef:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0109af2:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0109af6:	39 c1                	cmp    %eax,%ecx
+f0109af8:	7d 0f                	jge    f0109b09 <stab_binsearch+0xef>
+f0109afa:	0f b6 1a             	movzbl (%edx),%ebx
+f0109afd:	83 ea 0c             	sub    $0xc,%edx
+f0109b00:	39 f3                	cmp    %esi,%ebx
+f0109b02:	74 05                	je     f0109b09 <stab_binsearch+0xef>
+		     l--)
+f0109b04:	83 e8 01             	sub    $0x1,%eax
+f0109b07:	eb ed                	jmp    f0109af6 <stab_binsearch+0xdc>
+		*region_left = l;
+f0109b09:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0109b0c:	89 07                	mov    %eax,(%edi)
+}
+f0109b0e:	eb ca                	jmp    f0109ada <stab_binsearch+0xc0>
+			l = true_m + 1;
+f0109b10:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0109b13:	89 75 08             	mov    %esi,0x8(%ebp)
+f0109b16:	8d 5f 01             	lea    0x1(%edi),%ebx
+			continue;
+f0109b19:	e9 6a ff ff ff       	jmp    f0109a88 <stab_binsearch+0x6e>
+
+f0109b1e <debuginfo_eip>:
+//	negative if not.  But even if it returns negative it has stored some
+//	information into '*info'.
+//
+int
+debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+f0109b1e:	55                   	push   %ebp
+f0109b1f:	89 e5                	mov    %esp,%ebp
+f0109b21:	57                   	push   %edi
+f0109b22:	56                   	push   %esi
+f0109b23:	53                   	push   %ebx
+f0109b24:	83 ec 3c             	sub    $0x3c,%esp
+	const struct Stab *stabs, *stab_end;
+	const char *stabstr, *stabstr_end;
+	int lfile, rfile, lfun, rfun, lline, rline;
+
+	// Initialize *info
+	info->eip_file = "<unknown>";
+f0109b27:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0109b2a:	c7 00 b5 e4 10 f0    	movl   $0xf010e4b5,(%eax)
+	info->eip_line = 0;
+f0109b30:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	info->eip_fn_name = "<unknown>";
+f0109b37:	c7 40 08 b5 e4 10 f0 	movl   $0xf010e4b5,0x8(%eax)
+	info->eip_fn_namelen = 9;
+f0109b3e:	c7 40 0c 09 00 00 00 	movl   $0x9,0xc(%eax)
+	info->eip_fn_addr = addr;
+f0109b45:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0109b48:	89 78 10             	mov    %edi,0x10(%eax)
+	info->eip_fn_narg = 0;
+f0109b4b:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+
+	// Find the relevant set of stabs
+	if (addr >= ULIM) {
+f0109b52:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f0109b58:	0f 86 29 01 00 00    	jbe    f0109c87 <debuginfo_eip+0x169>
+		stabs = __STAB_BEGIN__;
+		stab_end = __STAB_END__;
+		stabstr = __STABSTR_BEGIN__;
+		stabstr_end = __STABSTR_END__;
+f0109b5e:	c7 45 c4 8c ed 10 f0 	movl   $0xf010ed8c,-0x3c(%ebp)
+		stabstr = __STABSTR_BEGIN__;
+f0109b65:	c7 45 c0 8c ed 10 f0 	movl   $0xf010ed8c,-0x40(%ebp)
+		stab_end = __STAB_END__;
+f0109b6c:	be 8b ed 10 f0       	mov    $0xf010ed8b,%esi
+		stabs = __STAB_BEGIN__;
+f0109b71:	bf 8b ed 10 f0       	mov    $0xf010ed8b,%edi
+		    user_mem_check(curenv, stabstr, (void *) stabstr_end - (void *) stabstr, PTE_U) < 0)
+			return -1;
+	}
+
+	// String table validity checks
+	if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
+f0109b76:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f0109b79:	39 4d c0             	cmp    %ecx,-0x40(%ebp)
+f0109b7c:	0f 83 3a 02 00 00    	jae    f0109dbc <debuginfo_eip+0x29e>
+f0109b82:	80 79 ff 00          	cmpb   $0x0,-0x1(%ecx)
+f0109b86:	0f 85 37 02 00 00    	jne    f0109dc3 <debuginfo_eip+0x2a5>
+	// 'eip'.  First, we find the basic source file containing 'eip'.
+	// Then, we look in that source file for the function.  Then we look
+	// for the line number.
+
+	// Search the entire set of stabs for the source file (type N_SO).
+	lfile = 0;
+f0109b8c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	rfile = (stab_end - stabs) - 1;
+f0109b93:	29 fe                	sub    %edi,%esi
+f0109b95:	c1 fe 02             	sar    $0x2,%esi
+f0109b98:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+f0109b9e:	83 e8 01             	sub    $0x1,%eax
+f0109ba1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	stab_binsearch(stabs, &lfile, &rfile, N_SO, addr);
+f0109ba4:	83 ec 08             	sub    $0x8,%esp
+f0109ba7:	ff 75 08             	push   0x8(%ebp)
+f0109baa:	6a 64                	push   $0x64
+f0109bac:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0109baf:	89 c1                	mov    %eax,%ecx
+f0109bb1:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0109bb4:	89 f8                	mov    %edi,%eax
+f0109bb6:	e8 5f fe ff ff       	call   f0109a1a <stab_binsearch>
+	if (lfile == 0)
+f0109bbb:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0109bbe:	83 c4 10             	add    $0x10,%esp
+f0109bc1:	85 f6                	test   %esi,%esi
+f0109bc3:	0f 84 01 02 00 00    	je     f0109dca <debuginfo_eip+0x2ac>
+		return -1;
+
+	// Search within that file's stabs for the function definition
+	// (N_FUN).
+	lfun = lfile;
+f0109bc9:	89 75 dc             	mov    %esi,-0x24(%ebp)
+	rfun = rfile;
+f0109bcc:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0109bcf:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+	stab_binsearch(stabs, &lfun, &rfun, N_FUN, addr);
+f0109bd2:	83 ec 08             	sub    $0x8,%esp
+f0109bd5:	ff 75 08             	push   0x8(%ebp)
+f0109bd8:	6a 24                	push   $0x24
+f0109bda:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f0109bdd:	89 c1                	mov    %eax,%ecx
+f0109bdf:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0109be2:	89 f8                	mov    %edi,%eax
+f0109be4:	e8 31 fe ff ff       	call   f0109a1a <stab_binsearch>
+
+	if (lfun <= rfun) {
+f0109be9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0109bec:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f0109bef:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0109bf2:	89 55 b8             	mov    %edx,-0x48(%ebp)
+f0109bf5:	83 c4 10             	add    $0x10,%esp
+f0109bf8:	39 d0                	cmp    %edx,%eax
+f0109bfa:	0f 8f 2c 01 00 00    	jg     f0109d2c <debuginfo_eip+0x20e>
+		// stabs[lfun] points to the function name
+		// in the string table, but check bounds just in case.
+		if (stabs[lfun].n_strx < stabstr_end - stabstr)
+f0109c00:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0109c03:	8d 14 87             	lea    (%edi,%eax,4),%edx
+f0109c06:	8b 02                	mov    (%edx),%eax
+f0109c08:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f0109c0b:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+f0109c0e:	29 d9                	sub    %ebx,%ecx
+f0109c10:	39 c8                	cmp    %ecx,%eax
+f0109c12:	73 08                	jae    f0109c1c <debuginfo_eip+0xfe>
+			info->eip_fn_name = stabstr + stabs[lfun].n_strx;
+f0109c14:	01 d8                	add    %ebx,%eax
+f0109c16:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0109c19:	89 43 08             	mov    %eax,0x8(%ebx)
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0109c1c:	8b 42 08             	mov    0x8(%edx),%eax
+		addr -= info->eip_fn_addr;
+f0109c1f:	29 45 08             	sub    %eax,0x8(%ebp)
+		// Search within the function definition for the line number.
+		lline = lfun;
+		rline = rfun;
+f0109c22:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f0109c25:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0109c28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0109c2b:	89 41 10             	mov    %eax,0x10(%ecx)
+		lline = lfun;
+f0109c2e:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+		rline = rfun;
+f0109c31:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+		info->eip_fn_addr = addr;
+		lline = lfile;
+		rline = rfile;
+	}
+	// Ignore stuff after the colon.
+	info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+f0109c34:	83 ec 08             	sub    $0x8,%esp
+f0109c37:	6a 3a                	push   $0x3a
+f0109c39:	ff 71 08             	push   0x8(%ecx)
+f0109c3c:	e8 a1 09 00 00       	call   f010a5e2 <strfind>
+f0109c41:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0109c44:	2b 43 08             	sub    0x8(%ebx),%eax
+f0109c47:	89 43 0c             	mov    %eax,0xc(%ebx)
+	// Hint:
+	//	There's a particular stabs type used for line numbers.
+	//	Look at the STABS documentation and <inc/stab.h> to find
+	//	which one.
+	// Your code here.
+	stab_binsearch(stabs, &lline, &rline, N_SLINE, addr);
+f0109c4a:	83 c4 08             	add    $0x8,%esp
+f0109c4d:	ff 75 08             	push   0x8(%ebp)
+f0109c50:	6a 44                	push   $0x44
+f0109c52:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f0109c55:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+f0109c58:	89 f8                	mov    %edi,%eax
+f0109c5a:	e8 bb fd ff ff       	call   f0109a1a <stab_binsearch>
+	if (lline <= rline)
+f0109c5f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0109c62:	83 c4 10             	add    $0x10,%esp
+f0109c65:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+f0109c68:	0f 8f 63 01 00 00    	jg     f0109dd1 <debuginfo_eip+0x2b3>
+		info->eip_line = stabs[lline].n_desc;
+f0109c6e:	89 c2                	mov    %eax,%edx
+f0109c70:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0109c73:	0f b7 4c 87 06       	movzwl 0x6(%edi,%eax,4),%ecx
+f0109c78:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0109c7b:	89 4b 04             	mov    %ecx,0x4(%ebx)
+	// Search backwards from the line number for the relevant filename
+	// stab.
+	// We can't just use the "lfile" stab because inlined functions
+	// can interpolate code from a different file!
+	// Such included source files use the N_SOL stab type.
+	while (lline >= lfile
+f0109c7e:	8d 44 87 04          	lea    0x4(%edi,%eax,4),%eax
+f0109c82:	e9 b5 00 00 00       	jmp    f0109d3c <debuginfo_eip+0x21e>
+		if (user_mem_check(curenv, usd, sizeof(struct UserStabData), PTE_U) < 0)
+f0109c87:	e8 b8 0f 00 00       	call   f010ac44 <cpunum>
+f0109c8c:	6a 04                	push   $0x4
+f0109c8e:	6a 10                	push   $0x10
+f0109c90:	68 00 00 20 00       	push   $0x200000
+f0109c95:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0109c9b:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0109ca1:	e8 24 b4 ff ff       	call   f01050ca <user_mem_check>
+f0109ca6:	83 c4 10             	add    $0x10,%esp
+f0109ca9:	85 c0                	test   %eax,%eax
+f0109cab:	0f 88 fd 00 00 00    	js     f0109dae <debuginfo_eip+0x290>
+		stabs = usd->stabs;
+f0109cb1:	8b 3d 00 00 20 00    	mov    0x200000,%edi
+		stab_end = usd->stab_end;
+f0109cb7:	8b 35 04 00 20 00    	mov    0x200004,%esi
+		stabstr = usd->stabstr;
+f0109cbd:	8b 1d 08 00 20 00    	mov    0x200008,%ebx
+f0109cc3:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+		stabstr_end = usd->stabstr_end;
+f0109cc6:	8b 15 0c 00 20 00    	mov    0x20000c,%edx
+f0109ccc:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+		if (user_mem_check(curenv, stabs, (void *) stab_end - (void *) stabs, PTE_U) < 0 ||
+f0109ccf:	e8 70 0f 00 00       	call   f010ac44 <cpunum>
+f0109cd4:	6a 04                	push   $0x4
+f0109cd6:	89 f1                	mov    %esi,%ecx
+f0109cd8:	29 f9                	sub    %edi,%ecx
+f0109cda:	51                   	push   %ecx
+f0109cdb:	57                   	push   %edi
+f0109cdc:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0109ce2:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0109ce8:	e8 dd b3 ff ff       	call   f01050ca <user_mem_check>
+f0109ced:	83 c4 10             	add    $0x10,%esp
+f0109cf0:	85 c0                	test   %eax,%eax
+f0109cf2:	0f 88 bd 00 00 00    	js     f0109db5 <debuginfo_eip+0x297>
+		    user_mem_check(curenv, stabstr, (void *) stabstr_end - (void *) stabstr, PTE_U) < 0)
+f0109cf8:	e8 47 0f 00 00       	call   f010ac44 <cpunum>
+f0109cfd:	6a 04                	push   $0x4
+f0109cff:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0109d02:	29 da                	sub    %ebx,%edx
+f0109d04:	52                   	push   %edx
+f0109d05:	53                   	push   %ebx
+f0109d06:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f0109d0c:	ff b0 28 90 61 f0    	push   -0xf9e6fd8(%eax)
+f0109d12:	e8 b3 b3 ff ff       	call   f01050ca <user_mem_check>
+		if (user_mem_check(curenv, stabs, (void *) stab_end - (void *) stabs, PTE_U) < 0 ||
+f0109d17:	83 c4 10             	add    $0x10,%esp
+f0109d1a:	85 c0                	test   %eax,%eax
+f0109d1c:	0f 89 54 fe ff ff    	jns    f0109b76 <debuginfo_eip+0x58>
+			return -1;
+f0109d22:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109d27:	e9 b1 00 00 00       	jmp    f0109ddd <debuginfo_eip+0x2bf>
+f0109d2c:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109d2f:	89 f2                	mov    %esi,%edx
+f0109d31:	e9 f2 fe ff ff       	jmp    f0109c28 <debuginfo_eip+0x10a>
+	       && stabs[lline].n_type != N_SOL
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+		lline--;
+f0109d36:	83 ea 01             	sub    $0x1,%edx
+f0109d39:	83 e8 0c             	sub    $0xc,%eax
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0109d3c:	39 d6                	cmp    %edx,%esi
+f0109d3e:	7f 31                	jg     f0109d71 <debuginfo_eip+0x253>
+	       && stabs[lline].n_type != N_SOL
+f0109d40:	0f b6 08             	movzbl (%eax),%ecx
+f0109d43:	80 f9 84             	cmp    $0x84,%cl
+f0109d46:	74 0b                	je     f0109d53 <debuginfo_eip+0x235>
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0109d48:	80 f9 64             	cmp    $0x64,%cl
+f0109d4b:	75 e9                	jne    f0109d36 <debuginfo_eip+0x218>
+f0109d4d:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0109d51:	74 e3                	je     f0109d36 <debuginfo_eip+0x218>
+	if (lline >= lfile && stabs[lline].n_strx < stabstr_end - stabstr)
+f0109d53:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0109d56:	8b 14 87             	mov    (%edi,%eax,4),%edx
+f0109d59:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0109d5c:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f0109d5f:	29 f0                	sub    %esi,%eax
+f0109d61:	39 c2                	cmp    %eax,%edx
+f0109d63:	73 0c                	jae    f0109d71 <debuginfo_eip+0x253>
+		info->eip_file = stabstr + stabs[lline].n_strx;
+f0109d65:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0109d68:	01 d0                	add    %edx,%eax
+f0109d6a:	89 c2                	mov    %eax,%edx
+f0109d6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0109d6f:	89 10                	mov    %edx,(%eax)
+		for (lline = lfun + 1;
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+		     lline++)
+			info->eip_fn_narg++;
+
+	return 0;
+f0109d71:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lfun < rfun)
+f0109d76:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f0109d79:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f0109d7c:	39 f3                	cmp    %esi,%ebx
+f0109d7e:	7d 5d                	jge    f0109ddd <debuginfo_eip+0x2bf>
+		for (lline = lfun + 1;
+f0109d80:	89 d8                	mov    %ebx,%eax
+f0109d82:	83 c0 01             	add    $0x1,%eax
+f0109d85:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0109d88:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0109d8c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0109d8f:	eb 04                	jmp    f0109d95 <debuginfo_eip+0x277>
+			info->eip_fn_narg++;
+f0109d91:	83 43 14 01          	addl   $0x1,0x14(%ebx)
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+f0109d95:	39 c6                	cmp    %eax,%esi
+f0109d97:	7e 3f                	jle    f0109dd8 <debuginfo_eip+0x2ba>
+f0109d99:	0f b6 0a             	movzbl (%edx),%ecx
+f0109d9c:	83 c0 01             	add    $0x1,%eax
+f0109d9f:	83 c2 0c             	add    $0xc,%edx
+f0109da2:	80 f9 a0             	cmp    $0xa0,%cl
+f0109da5:	74 ea                	je     f0109d91 <debuginfo_eip+0x273>
+	return 0;
+f0109da7:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109dac:	eb 2f                	jmp    f0109ddd <debuginfo_eip+0x2bf>
+			return -1;
+f0109dae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109db3:	eb 28                	jmp    f0109ddd <debuginfo_eip+0x2bf>
+			return -1;
+f0109db5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109dba:	eb 21                	jmp    f0109ddd <debuginfo_eip+0x2bf>
+		return -1;
+f0109dbc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109dc1:	eb 1a                	jmp    f0109ddd <debuginfo_eip+0x2bf>
+f0109dc3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109dc8:	eb 13                	jmp    f0109ddd <debuginfo_eip+0x2bf>
+		return -1;
+f0109dca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109dcf:	eb 0c                	jmp    f0109ddd <debuginfo_eip+0x2bf>
+		return -1;
+f0109dd1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109dd6:	eb 05                	jmp    f0109ddd <debuginfo_eip+0x2bf>
+	return 0;
+f0109dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0109ddd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109de0:	5b                   	pop    %ebx
+f0109de1:	5e                   	pop    %esi
+f0109de2:	5f                   	pop    %edi
+f0109de3:	5d                   	pop    %ebp
+f0109de4:	c3                   	ret
+
+f0109de5 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+f0109de5:	55                   	push   %ebp
+f0109de6:	89 e5                	mov    %esp,%ebp
+f0109de8:	57                   	push   %edi
+f0109de9:	56                   	push   %esi
+f0109dea:	53                   	push   %ebx
+f0109deb:	83 ec 1c             	sub    $0x1c,%esp
+f0109dee:	89 c7                	mov    %eax,%edi
+f0109df0:	89 d6                	mov    %edx,%esi
+f0109df2:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109df5:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0109df8:	89 d1                	mov    %edx,%ecx
+f0109dfa:	89 c2                	mov    %eax,%edx
+f0109dfc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0109dff:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0109e02:	8b 45 10             	mov    0x10(%ebp),%eax
+f0109e05:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+f0109e08:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0109e0b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0109e12:	39 c2                	cmp    %eax,%edx
+f0109e14:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+f0109e17:	72 3e                	jb     f0109e57 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+f0109e19:	83 ec 0c             	sub    $0xc,%esp
+f0109e1c:	ff 75 18             	push   0x18(%ebp)
+f0109e1f:	83 eb 01             	sub    $0x1,%ebx
+f0109e22:	53                   	push   %ebx
+f0109e23:	50                   	push   %eax
+f0109e24:	83 ec 08             	sub    $0x8,%esp
+f0109e27:	ff 75 e4             	push   -0x1c(%ebp)
+f0109e2a:	ff 75 e0             	push   -0x20(%ebp)
+f0109e2d:	ff 75 dc             	push   -0x24(%ebp)
+f0109e30:	ff 75 d8             	push   -0x28(%ebp)
+f0109e33:	e8 f8 1d 00 00       	call   f010bc30 <__udivdi3>
+f0109e38:	83 c4 18             	add    $0x18,%esp
+f0109e3b:	52                   	push   %edx
+f0109e3c:	50                   	push   %eax
+f0109e3d:	89 f2                	mov    %esi,%edx
+f0109e3f:	89 f8                	mov    %edi,%eax
+f0109e41:	e8 9f ff ff ff       	call   f0109de5 <printnum>
+f0109e46:	83 c4 20             	add    $0x20,%esp
+f0109e49:	eb 13                	jmp    f0109e5e <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+f0109e4b:	83 ec 08             	sub    $0x8,%esp
+f0109e4e:	56                   	push   %esi
+f0109e4f:	ff 75 18             	push   0x18(%ebp)
+f0109e52:	ff d7                	call   *%edi
+f0109e54:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+f0109e57:	83 eb 01             	sub    $0x1,%ebx
+f0109e5a:	85 db                	test   %ebx,%ebx
+f0109e5c:	7f ed                	jg     f0109e4b <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+f0109e5e:	83 ec 08             	sub    $0x8,%esp
+f0109e61:	56                   	push   %esi
+f0109e62:	83 ec 04             	sub    $0x4,%esp
+f0109e65:	ff 75 e4             	push   -0x1c(%ebp)
+f0109e68:	ff 75 e0             	push   -0x20(%ebp)
+f0109e6b:	ff 75 dc             	push   -0x24(%ebp)
+f0109e6e:	ff 75 d8             	push   -0x28(%ebp)
+f0109e71:	e8 7a 1e 00 00       	call   f010bcf0 <__umoddi3>
+f0109e76:	83 c4 14             	add    $0x14,%esp
+f0109e79:	0f be 80 bf e4 10 f0 	movsbl -0xfef1b41(%eax),%eax
+f0109e80:	50                   	push   %eax
+f0109e81:	ff d7                	call   *%edi
+}
+f0109e83:	83 c4 10             	add    $0x10,%esp
+f0109e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109e89:	5b                   	pop    %ebx
+f0109e8a:	5e                   	pop    %esi
+f0109e8b:	5f                   	pop    %edi
+f0109e8c:	5d                   	pop    %ebp
+f0109e8d:	c3                   	ret
+
+f0109e8e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+f0109e8e:	55                   	push   %ebp
+f0109e8f:	89 e5                	mov    %esp,%ebp
+f0109e91:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+f0109e94:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+f0109e98:	8b 10                	mov    (%eax),%edx
+f0109e9a:	3b 50 04             	cmp    0x4(%eax),%edx
+f0109e9d:	73 0a                	jae    f0109ea9 <sprintputch+0x1b>
+		*b->buf++ = ch;
+f0109e9f:	8d 4a 01             	lea    0x1(%edx),%ecx
+f0109ea2:	89 08                	mov    %ecx,(%eax)
+f0109ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109ea7:	88 02                	mov    %al,(%edx)
+}
+f0109ea9:	5d                   	pop    %ebp
+f0109eaa:	c3                   	ret
+
+f0109eab <printfmt>:
+{
+f0109eab:	55                   	push   %ebp
+f0109eac:	89 e5                	mov    %esp,%ebp
+f0109eae:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+f0109eb1:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+f0109eb4:	50                   	push   %eax
+f0109eb5:	ff 75 10             	push   0x10(%ebp)
+f0109eb8:	ff 75 0c             	push   0xc(%ebp)
+f0109ebb:	ff 75 08             	push   0x8(%ebp)
+f0109ebe:	e8 05 00 00 00       	call   f0109ec8 <vprintfmt>
+}
+f0109ec3:	83 c4 10             	add    $0x10,%esp
+f0109ec6:	c9                   	leave
+f0109ec7:	c3                   	ret
+
+f0109ec8 <vprintfmt>:
+{
+f0109ec8:	55                   	push   %ebp
+f0109ec9:	89 e5                	mov    %esp,%ebp
+f0109ecb:	57                   	push   %edi
+f0109ecc:	56                   	push   %esi
+f0109ecd:	53                   	push   %ebx
+f0109ece:	83 ec 2c             	sub    $0x2c,%esp
+f0109ed1:	8b 75 08             	mov    0x8(%ebp),%esi
+f0109ed4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0109ed7:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0109eda:	eb 0a                	jmp    f0109ee6 <vprintfmt+0x1e>
+			putch(ch, putdat);
+f0109edc:	83 ec 08             	sub    $0x8,%esp
+f0109edf:	53                   	push   %ebx
+f0109ee0:	50                   	push   %eax
+f0109ee1:	ff d6                	call   *%esi
+f0109ee3:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f0109ee6:	83 c7 01             	add    $0x1,%edi
+f0109ee9:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+f0109eed:	83 f8 25             	cmp    $0x25,%eax
+f0109ef0:	74 0c                	je     f0109efe <vprintfmt+0x36>
+			if (ch == '\0')
+f0109ef2:	85 c0                	test   %eax,%eax
+f0109ef4:	75 e6                	jne    f0109edc <vprintfmt+0x14>
+}
+f0109ef6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109ef9:	5b                   	pop    %ebx
+f0109efa:	5e                   	pop    %esi
+f0109efb:	5f                   	pop    %edi
+f0109efc:	5d                   	pop    %ebp
+f0109efd:	c3                   	ret
+		padc = ' ';
+f0109efe:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+f0109f02:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+f0109f09:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+f0109f10:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+f0109f17:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+f0109f1c:	8d 47 01             	lea    0x1(%edi),%eax
+f0109f1f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0109f22:	0f b6 17             	movzbl (%edi),%edx
+f0109f25:	8d 42 dd             	lea    -0x23(%edx),%eax
+f0109f28:	3c 55                	cmp    $0x55,%al
+f0109f2a:	0f 87 cf 03 00 00    	ja     f010a2ff <vprintfmt+0x437>
+f0109f30:	0f b6 c0             	movzbl %al,%eax
+f0109f33:	ff 24 85 00 e6 10 f0 	jmp    *-0xfef1a00(,%eax,4)
+f0109f3a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+f0109f3d:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+f0109f41:	eb d9                	jmp    f0109f1c <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+f0109f43:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0109f46:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+f0109f4a:	eb d0                	jmp    f0109f1c <vprintfmt+0x54>
+f0109f4c:	0f b6 d2             	movzbl %dl,%edx
+f0109f4f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+f0109f52:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109f57:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+f0109f5a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0109f5d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+f0109f61:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+f0109f64:	8d 4a d0             	lea    -0x30(%edx),%ecx
+f0109f67:	83 f9 09             	cmp    $0x9,%ecx
+f0109f6a:	77 55                	ja     f0109fc1 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+f0109f6c:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+f0109f6f:	eb e9                	jmp    f0109f5a <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+f0109f71:	8b 45 14             	mov    0x14(%ebp),%eax
+f0109f74:	8b 00                	mov    (%eax),%eax
+f0109f76:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0109f79:	8b 45 14             	mov    0x14(%ebp),%eax
+f0109f7c:	8d 40 04             	lea    0x4(%eax),%eax
+f0109f7f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f0109f82:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+f0109f85:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f0109f89:	79 91                	jns    f0109f1c <vprintfmt+0x54>
+				width = precision, precision = -1;
+f0109f8b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0109f8e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0109f91:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+f0109f98:	eb 82                	jmp    f0109f1c <vprintfmt+0x54>
+			if (width < 0)
+f0109f9a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0109f9d:	85 d2                	test   %edx,%edx
+f0109f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109fa4:	0f 49 c2             	cmovns %edx,%eax
+f0109fa7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f0109faa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f0109fad:	e9 6a ff ff ff       	jmp    f0109f1c <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+f0109fb2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+f0109fb5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+f0109fbc:	e9 5b ff ff ff       	jmp    f0109f1c <vprintfmt+0x54>
+f0109fc1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0109fc4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0109fc7:	eb bc                	jmp    f0109f85 <vprintfmt+0xbd>
+			lflag++;
+f0109fc9:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+f0109fcc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f0109fcf:	e9 48 ff ff ff       	jmp    f0109f1c <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+f0109fd4:	8b 45 14             	mov    0x14(%ebp),%eax
+f0109fd7:	8d 78 04             	lea    0x4(%eax),%edi
+f0109fda:	83 ec 08             	sub    $0x8,%esp
+f0109fdd:	53                   	push   %ebx
+f0109fde:	ff 30                	push   (%eax)
+f0109fe0:	ff d6                	call   *%esi
+			break;
+f0109fe2:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+f0109fe5:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+f0109fe8:	e9 b1 02 00 00       	jmp    f010a29e <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+f0109fed:	8b 45 14             	mov    0x14(%ebp),%eax
+f0109ff0:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+f0109ff3:	8b 10                	mov    (%eax),%edx
+f0109ff5:	89 d0                	mov    %edx,%eax
+f0109ff7:	f7 d8                	neg    %eax
+f0109ff9:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+f0109ffc:	83 f8 0f             	cmp    $0xf,%eax
+f0109fff:	7f 23                	jg     f010a024 <vprintfmt+0x15c>
+f010a001:	8b 14 85 60 e7 10 f0 	mov    -0xfef18a0(,%eax,4),%edx
+f010a008:	85 d2                	test   %edx,%edx
+f010a00a:	74 18                	je     f010a024 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+f010a00c:	52                   	push   %edx
+f010a00d:	68 1f d8 10 f0       	push   $0xf010d81f
+f010a012:	53                   	push   %ebx
+f010a013:	56                   	push   %esi
+f010a014:	e8 92 fe ff ff       	call   f0109eab <printfmt>
+f010a019:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f010a01c:	89 7d 14             	mov    %edi,0x14(%ebp)
+f010a01f:	e9 7a 02 00 00       	jmp    f010a29e <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+f010a024:	50                   	push   %eax
+f010a025:	68 d7 e4 10 f0       	push   $0xf010e4d7
+f010a02a:	53                   	push   %ebx
+f010a02b:	56                   	push   %esi
+f010a02c:	e8 7a fe ff ff       	call   f0109eab <printfmt>
+f010a031:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f010a034:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+f010a037:	e9 62 02 00 00       	jmp    f010a29e <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+f010a03c:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a03f:	83 c0 04             	add    $0x4,%eax
+f010a042:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f010a045:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a048:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+f010a04a:	85 c9                	test   %ecx,%ecx
+f010a04c:	b8 d0 e4 10 f0       	mov    $0xf010e4d0,%eax
+f010a051:	0f 45 c1             	cmovne %ecx,%eax
+f010a054:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+f010a057:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f010a05b:	7e 06                	jle    f010a063 <vprintfmt+0x19b>
+f010a05d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+f010a061:	75 0b                	jne    f010a06e <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+f010a063:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f010a066:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f010a069:	89 75 08             	mov    %esi,0x8(%ebp)
+f010a06c:	eb 5c                	jmp    f010a0ca <vprintfmt+0x202>
+f010a06e:	83 ec 08             	sub    $0x8,%esp
+f010a071:	ff 75 d0             	push   -0x30(%ebp)
+f010a074:	ff 75 cc             	push   -0x34(%ebp)
+f010a077:	e8 0e 04 00 00       	call   f010a48a <strnlen>
+f010a07c:	89 c2                	mov    %eax,%edx
+f010a07e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010a081:	29 d0                	sub    %edx,%eax
+f010a083:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+f010a086:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+f010a08a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010a08d:	89 75 08             	mov    %esi,0x8(%ebp)
+f010a090:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+f010a092:	eb 0e                	jmp    f010a0a2 <vprintfmt+0x1da>
+					putch(padc, putdat);
+f010a094:	83 ec 08             	sub    $0x8,%esp
+f010a097:	53                   	push   %ebx
+f010a098:	57                   	push   %edi
+f010a099:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+f010a09c:	83 ee 01             	sub    $0x1,%esi
+f010a09f:	83 c4 10             	add    $0x10,%esp
+f010a0a2:	85 f6                	test   %esi,%esi
+f010a0a4:	7f ee                	jg     f010a094 <vprintfmt+0x1cc>
+f010a0a6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010a0a9:	8b 75 08             	mov    0x8(%ebp),%esi
+f010a0ac:	85 c0                	test   %eax,%eax
+f010a0ae:	ba 00 00 00 00       	mov    $0x0,%edx
+f010a0b3:	0f 49 d0             	cmovns %eax,%edx
+f010a0b6:	29 d0                	sub    %edx,%eax
+f010a0b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010a0bb:	eb a6                	jmp    f010a063 <vprintfmt+0x19b>
+					putch(ch, putdat);
+f010a0bd:	83 ec 08             	sub    $0x8,%esp
+f010a0c0:	53                   	push   %ebx
+f010a0c1:	52                   	push   %edx
+f010a0c2:	ff 55 08             	call   *0x8(%ebp)
+f010a0c5:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f010a0c8:	89 f1                	mov    %esi,%ecx
+f010a0ca:	8d 71 01             	lea    0x1(%ecx),%esi
+f010a0cd:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f010a0d1:	0f be d0             	movsbl %al,%edx
+f010a0d4:	85 d2                	test   %edx,%edx
+f010a0d6:	74 28                	je     f010a100 <vprintfmt+0x238>
+f010a0d8:	85 ff                	test   %edi,%edi
+f010a0da:	78 05                	js     f010a0e1 <vprintfmt+0x219>
+f010a0dc:	83 ef 01             	sub    $0x1,%edi
+f010a0df:	78 30                	js     f010a111 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+f010a0e1:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f010a0e5:	74 d6                	je     f010a0bd <vprintfmt+0x1f5>
+f010a0e7:	0f be c0             	movsbl %al,%eax
+f010a0ea:	83 e8 20             	sub    $0x20,%eax
+f010a0ed:	83 f8 5e             	cmp    $0x5e,%eax
+f010a0f0:	76 cb                	jbe    f010a0bd <vprintfmt+0x1f5>
+					putch('?', putdat);
+f010a0f2:	83 ec 08             	sub    $0x8,%esp
+f010a0f5:	53                   	push   %ebx
+f010a0f6:	6a 3f                	push   $0x3f
+f010a0f8:	ff 55 08             	call   *0x8(%ebp)
+f010a0fb:	83 c4 10             	add    $0x10,%esp
+f010a0fe:	eb c8                	jmp    f010a0c8 <vprintfmt+0x200>
+f010a100:	8b 75 08             	mov    0x8(%ebp),%esi
+f010a103:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010a106:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f010a109:	01 d0                	add    %edx,%eax
+f010a10b:	29 c8                	sub    %ecx,%eax
+f010a10d:	89 c7                	mov    %eax,%edi
+f010a10f:	eb 13                	jmp    f010a124 <vprintfmt+0x25c>
+f010a111:	8b 75 08             	mov    0x8(%ebp),%esi
+f010a114:	eb ed                	jmp    f010a103 <vprintfmt+0x23b>
+				putch(' ', putdat);
+f010a116:	83 ec 08             	sub    $0x8,%esp
+f010a119:	53                   	push   %ebx
+f010a11a:	6a 20                	push   $0x20
+f010a11c:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+f010a11e:	83 ef 01             	sub    $0x1,%edi
+f010a121:	83 c4 10             	add    $0x10,%esp
+f010a124:	85 ff                	test   %edi,%edi
+f010a126:	7f ee                	jg     f010a116 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+f010a128:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f010a12b:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a12e:	e9 6b 01 00 00       	jmp    f010a29e <vprintfmt+0x3d6>
+	if (lflag >= 2)
+f010a133:	83 f9 01             	cmp    $0x1,%ecx
+f010a136:	7f 1f                	jg     f010a157 <vprintfmt+0x28f>
+	else if (lflag)
+f010a138:	85 c9                	test   %ecx,%ecx
+f010a13a:	74 67                	je     f010a1a3 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+f010a13c:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a13f:	8b 00                	mov    (%eax),%eax
+f010a141:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010a144:	89 c1                	mov    %eax,%ecx
+f010a146:	c1 f9 1f             	sar    $0x1f,%ecx
+f010a149:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f010a14c:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a14f:	8d 40 04             	lea    0x4(%eax),%eax
+f010a152:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a155:	eb 17                	jmp    f010a16e <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+f010a157:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a15a:	8b 50 04             	mov    0x4(%eax),%edx
+f010a15d:	8b 00                	mov    (%eax),%eax
+f010a15f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010a162:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f010a165:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a168:	8d 40 08             	lea    0x8(%eax),%eax
+f010a16b:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+f010a16e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f010a171:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+f010a174:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+f010a179:	85 c9                	test   %ecx,%ecx
+f010a17b:	0f 89 03 01 00 00    	jns    f010a284 <vprintfmt+0x3bc>
+				putch('-', putdat);
+f010a181:	83 ec 08             	sub    $0x8,%esp
+f010a184:	53                   	push   %ebx
+f010a185:	6a 2d                	push   $0x2d
+f010a187:	ff d6                	call   *%esi
+				num = -(long long) num;
+f010a189:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f010a18c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f010a18f:	f7 da                	neg    %edx
+f010a191:	83 d1 00             	adc    $0x0,%ecx
+f010a194:	f7 d9                	neg    %ecx
+f010a196:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+f010a199:	bf 0a 00 00 00       	mov    $0xa,%edi
+f010a19e:	e9 e1 00 00 00       	jmp    f010a284 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+f010a1a3:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a1a6:	8b 00                	mov    (%eax),%eax
+f010a1a8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010a1ab:	89 c1                	mov    %eax,%ecx
+f010a1ad:	c1 f9 1f             	sar    $0x1f,%ecx
+f010a1b0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f010a1b3:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a1b6:	8d 40 04             	lea    0x4(%eax),%eax
+f010a1b9:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a1bc:	eb b0                	jmp    f010a16e <vprintfmt+0x2a6>
+	if (lflag >= 2)
+f010a1be:	83 f9 01             	cmp    $0x1,%ecx
+f010a1c1:	7f 1e                	jg     f010a1e1 <vprintfmt+0x319>
+	else if (lflag)
+f010a1c3:	85 c9                	test   %ecx,%ecx
+f010a1c5:	74 32                	je     f010a1f9 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+f010a1c7:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a1ca:	8b 10                	mov    (%eax),%edx
+f010a1cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a1d1:	8d 40 04             	lea    0x4(%eax),%eax
+f010a1d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f010a1d7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+f010a1dc:	e9 a3 00 00 00       	jmp    f010a284 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+f010a1e1:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a1e4:	8b 10                	mov    (%eax),%edx
+f010a1e6:	8b 48 04             	mov    0x4(%eax),%ecx
+f010a1e9:	8d 40 08             	lea    0x8(%eax),%eax
+f010a1ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f010a1ef:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+f010a1f4:	e9 8b 00 00 00       	jmp    f010a284 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+f010a1f9:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a1fc:	8b 10                	mov    (%eax),%edx
+f010a1fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a203:	8d 40 04             	lea    0x4(%eax),%eax
+f010a206:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f010a209:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+f010a20e:	eb 74                	jmp    f010a284 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+f010a210:	83 f9 01             	cmp    $0x1,%ecx
+f010a213:	7f 1b                	jg     f010a230 <vprintfmt+0x368>
+	else if (lflag)
+f010a215:	85 c9                	test   %ecx,%ecx
+f010a217:	74 2c                	je     f010a245 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+f010a219:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a21c:	8b 10                	mov    (%eax),%edx
+f010a21e:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a223:	8d 40 04             	lea    0x4(%eax),%eax
+f010a226:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f010a229:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+f010a22e:	eb 54                	jmp    f010a284 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+f010a230:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a233:	8b 10                	mov    (%eax),%edx
+f010a235:	8b 48 04             	mov    0x4(%eax),%ecx
+f010a238:	8d 40 08             	lea    0x8(%eax),%eax
+f010a23b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f010a23e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+f010a243:	eb 3f                	jmp    f010a284 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+f010a245:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a248:	8b 10                	mov    (%eax),%edx
+f010a24a:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a24f:	8d 40 04             	lea    0x4(%eax),%eax
+f010a252:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f010a255:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+f010a25a:	eb 28                	jmp    f010a284 <vprintfmt+0x3bc>
+			putch('0', putdat);
+f010a25c:	83 ec 08             	sub    $0x8,%esp
+f010a25f:	53                   	push   %ebx
+f010a260:	6a 30                	push   $0x30
+f010a262:	ff d6                	call   *%esi
+			putch('x', putdat);
+f010a264:	83 c4 08             	add    $0x8,%esp
+f010a267:	53                   	push   %ebx
+f010a268:	6a 78                	push   $0x78
+f010a26a:	ff d6                	call   *%esi
+			num = (unsigned long long)
+f010a26c:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a26f:	8b 10                	mov    (%eax),%edx
+f010a271:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+f010a276:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+f010a279:	8d 40 04             	lea    0x4(%eax),%eax
+f010a27c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f010a27f:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+f010a284:	83 ec 0c             	sub    $0xc,%esp
+f010a287:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+f010a28b:	50                   	push   %eax
+f010a28c:	ff 75 e0             	push   -0x20(%ebp)
+f010a28f:	57                   	push   %edi
+f010a290:	51                   	push   %ecx
+f010a291:	52                   	push   %edx
+f010a292:	89 da                	mov    %ebx,%edx
+f010a294:	89 f0                	mov    %esi,%eax
+f010a296:	e8 4a fb ff ff       	call   f0109de5 <printnum>
+			break;
+f010a29b:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+f010a29e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f010a2a1:	e9 40 fc ff ff       	jmp    f0109ee6 <vprintfmt+0x1e>
+	if (lflag >= 2)
+f010a2a6:	83 f9 01             	cmp    $0x1,%ecx
+f010a2a9:	7f 1b                	jg     f010a2c6 <vprintfmt+0x3fe>
+	else if (lflag)
+f010a2ab:	85 c9                	test   %ecx,%ecx
+f010a2ad:	74 2c                	je     f010a2db <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+f010a2af:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a2b2:	8b 10                	mov    (%eax),%edx
+f010a2b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a2b9:	8d 40 04             	lea    0x4(%eax),%eax
+f010a2bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f010a2bf:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+f010a2c4:	eb be                	jmp    f010a284 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+f010a2c6:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a2c9:	8b 10                	mov    (%eax),%edx
+f010a2cb:	8b 48 04             	mov    0x4(%eax),%ecx
+f010a2ce:	8d 40 08             	lea    0x8(%eax),%eax
+f010a2d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f010a2d4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+f010a2d9:	eb a9                	jmp    f010a284 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+f010a2db:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a2de:	8b 10                	mov    (%eax),%edx
+f010a2e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a2e5:	8d 40 04             	lea    0x4(%eax),%eax
+f010a2e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f010a2eb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+f010a2f0:	eb 92                	jmp    f010a284 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+f010a2f2:	83 ec 08             	sub    $0x8,%esp
+f010a2f5:	53                   	push   %ebx
+f010a2f6:	6a 25                	push   $0x25
+f010a2f8:	ff d6                	call   *%esi
+			break;
+f010a2fa:	83 c4 10             	add    $0x10,%esp
+f010a2fd:	eb 9f                	jmp    f010a29e <vprintfmt+0x3d6>
+			putch('%', putdat);
+f010a2ff:	83 ec 08             	sub    $0x8,%esp
+f010a302:	53                   	push   %ebx
+f010a303:	6a 25                	push   $0x25
+f010a305:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+f010a307:	83 c4 10             	add    $0x10,%esp
+f010a30a:	89 f8                	mov    %edi,%eax
+f010a30c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+f010a310:	74 05                	je     f010a317 <vprintfmt+0x44f>
+f010a312:	83 e8 01             	sub    $0x1,%eax
+f010a315:	eb f5                	jmp    f010a30c <vprintfmt+0x444>
+f010a317:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010a31a:	eb 82                	jmp    f010a29e <vprintfmt+0x3d6>
+
+f010a31c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+f010a31c:	55                   	push   %ebp
+f010a31d:	89 e5                	mov    %esp,%ebp
+f010a31f:	83 ec 18             	sub    $0x18,%esp
+f010a322:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a325:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+f010a328:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f010a32b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f010a32f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f010a332:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+f010a339:	85 c0                	test   %eax,%eax
+f010a33b:	74 26                	je     f010a363 <vsnprintf+0x47>
+f010a33d:	85 d2                	test   %edx,%edx
+f010a33f:	7e 22                	jle    f010a363 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+f010a341:	ff 75 14             	push   0x14(%ebp)
+f010a344:	ff 75 10             	push   0x10(%ebp)
+f010a347:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f010a34a:	50                   	push   %eax
+f010a34b:	68 8e 9e 10 f0       	push   $0xf0109e8e
+f010a350:	e8 73 fb ff ff       	call   f0109ec8 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+f010a355:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f010a358:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+f010a35b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010a35e:	83 c4 10             	add    $0x10,%esp
+}
+f010a361:	c9                   	leave
+f010a362:	c3                   	ret
+		return -E_INVAL;
+f010a363:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a368:	eb f7                	jmp    f010a361 <vsnprintf+0x45>
+
+f010a36a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+f010a36a:	55                   	push   %ebp
+f010a36b:	89 e5                	mov    %esp,%ebp
+f010a36d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+f010a370:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+f010a373:	50                   	push   %eax
+f010a374:	ff 75 10             	push   0x10(%ebp)
+f010a377:	ff 75 0c             	push   0xc(%ebp)
+f010a37a:	ff 75 08             	push   0x8(%ebp)
+f010a37d:	e8 9a ff ff ff       	call   f010a31c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+f010a382:	c9                   	leave
+f010a383:	c3                   	ret
+
+f010a384 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+f010a384:	55                   	push   %ebp
+f010a385:	89 e5                	mov    %esp,%ebp
+f010a387:	57                   	push   %edi
+f010a388:	56                   	push   %esi
+f010a389:	53                   	push   %ebx
+f010a38a:	83 ec 0c             	sub    $0xc,%esp
+f010a38d:	8b 45 08             	mov    0x8(%ebp),%eax
+	int i, c, echoing;
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+f010a390:	85 c0                	test   %eax,%eax
+f010a392:	74 11                	je     f010a3a5 <readline+0x21>
+		cprintf("%s", prompt);
+f010a394:	83 ec 08             	sub    $0x8,%esp
+f010a397:	50                   	push   %eax
+f010a398:	68 1f d8 10 f0       	push   $0xf010d81f
+f010a39d:	e8 5a cc ff ff       	call   f0106ffc <cprintf>
+f010a3a2:	83 c4 10             	add    $0x10,%esp
+	if (prompt != NULL)
+		fprintf(1, "%s", prompt);
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+f010a3a5:	83 ec 0c             	sub    $0xc,%esp
+f010a3a8:	6a 00                	push   $0x0
+f010a3aa:	e8 40 64 ff ff       	call   f01007ef <iscons>
+f010a3af:	89 c7                	mov    %eax,%edi
+f010a3b1:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+f010a3b4:	be 00 00 00 00       	mov    $0x0,%esi
+f010a3b9:	eb 4b                	jmp    f010a406 <readline+0x82>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+f010a3bb:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+f010a3c0:	83 fb f8             	cmp    $0xfffffff8,%ebx
+f010a3c3:	75 08                	jne    f010a3cd <readline+0x49>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+f010a3c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a3c8:	5b                   	pop    %ebx
+f010a3c9:	5e                   	pop    %esi
+f010a3ca:	5f                   	pop    %edi
+f010a3cb:	5d                   	pop    %ebp
+f010a3cc:	c3                   	ret
+				cprintf("read error: %e\n", c);
+f010a3cd:	83 ec 08             	sub    $0x8,%esp
+f010a3d0:	53                   	push   %ebx
+f010a3d1:	68 bf e7 10 f0       	push   $0xf010e7bf
+f010a3d6:	e8 21 cc ff ff       	call   f0106ffc <cprintf>
+f010a3db:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+f010a3de:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a3e3:	eb e0                	jmp    f010a3c5 <readline+0x41>
+			if (echoing)
+f010a3e5:	85 ff                	test   %edi,%edi
+f010a3e7:	75 05                	jne    f010a3ee <readline+0x6a>
+			i--;
+f010a3e9:	83 ee 01             	sub    $0x1,%esi
+f010a3ec:	eb 18                	jmp    f010a406 <readline+0x82>
+				cputchar('\b');
+f010a3ee:	83 ec 0c             	sub    $0xc,%esp
+f010a3f1:	6a 08                	push   $0x8
+f010a3f3:	e8 d6 63 ff ff       	call   f01007ce <cputchar>
+f010a3f8:	83 c4 10             	add    $0x10,%esp
+f010a3fb:	eb ec                	jmp    f010a3e9 <readline+0x65>
+			buf[i++] = c;
+f010a3fd:	88 9e 40 85 61 f0    	mov    %bl,-0xf9e7ac0(%esi)
+f010a403:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+f010a406:	e8 d3 63 ff ff       	call   f01007de <getchar>
+f010a40b:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+f010a40d:	85 c0                	test   %eax,%eax
+f010a40f:	78 aa                	js     f010a3bb <readline+0x37>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+f010a411:	83 f8 08             	cmp    $0x8,%eax
+f010a414:	0f 94 c0             	sete   %al
+f010a417:	83 fb 7f             	cmp    $0x7f,%ebx
+f010a41a:	0f 94 c2             	sete   %dl
+f010a41d:	08 d0                	or     %dl,%al
+f010a41f:	74 04                	je     f010a425 <readline+0xa1>
+f010a421:	85 f6                	test   %esi,%esi
+f010a423:	7f c0                	jg     f010a3e5 <readline+0x61>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+f010a425:	83 fb 1f             	cmp    $0x1f,%ebx
+f010a428:	7e 1a                	jle    f010a444 <readline+0xc0>
+f010a42a:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+f010a430:	7f 12                	jg     f010a444 <readline+0xc0>
+			if (echoing)
+f010a432:	85 ff                	test   %edi,%edi
+f010a434:	74 c7                	je     f010a3fd <readline+0x79>
+				cputchar(c);
+f010a436:	83 ec 0c             	sub    $0xc,%esp
+f010a439:	53                   	push   %ebx
+f010a43a:	e8 8f 63 ff ff       	call   f01007ce <cputchar>
+f010a43f:	83 c4 10             	add    $0x10,%esp
+f010a442:	eb b9                	jmp    f010a3fd <readline+0x79>
+		} else if (c == '\n' || c == '\r') {
+f010a444:	83 fb 0a             	cmp    $0xa,%ebx
+f010a447:	74 05                	je     f010a44e <readline+0xca>
+f010a449:	83 fb 0d             	cmp    $0xd,%ebx
+f010a44c:	75 b8                	jne    f010a406 <readline+0x82>
+			if (echoing)
+f010a44e:	85 ff                	test   %edi,%edi
+f010a450:	75 11                	jne    f010a463 <readline+0xdf>
+			buf[i] = 0;
+f010a452:	c6 86 40 85 61 f0 00 	movb   $0x0,-0xf9e7ac0(%esi)
+			return buf;
+f010a459:	b8 40 85 61 f0       	mov    $0xf0618540,%eax
+f010a45e:	e9 62 ff ff ff       	jmp    f010a3c5 <readline+0x41>
+				cputchar('\n');
+f010a463:	83 ec 0c             	sub    $0xc,%esp
+f010a466:	6a 0a                	push   $0xa
+f010a468:	e8 61 63 ff ff       	call   f01007ce <cputchar>
+f010a46d:	83 c4 10             	add    $0x10,%esp
+f010a470:	eb e0                	jmp    f010a452 <readline+0xce>
+
+f010a472 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+f010a472:	55                   	push   %ebp
+f010a473:	89 e5                	mov    %esp,%ebp
+f010a475:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+f010a478:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a47d:	eb 03                	jmp    f010a482 <strlen+0x10>
+		n++;
+f010a47f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+f010a482:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f010a486:	75 f7                	jne    f010a47f <strlen+0xd>
+	return n;
+}
+f010a488:	5d                   	pop    %ebp
+f010a489:	c3                   	ret
+
+f010a48a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+f010a48a:	55                   	push   %ebp
+f010a48b:	89 e5                	mov    %esp,%ebp
+f010a48d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f010a490:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010a493:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a498:	eb 03                	jmp    f010a49d <strnlen+0x13>
+		n++;
+f010a49a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f010a49d:	39 d0                	cmp    %edx,%eax
+f010a49f:	74 08                	je     f010a4a9 <strnlen+0x1f>
+f010a4a1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f010a4a5:	75 f3                	jne    f010a49a <strnlen+0x10>
+f010a4a7:	89 c2                	mov    %eax,%edx
+	return n;
+}
+f010a4a9:	89 d0                	mov    %edx,%eax
+f010a4ab:	5d                   	pop    %ebp
+f010a4ac:	c3                   	ret
+
+f010a4ad <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+f010a4ad:	55                   	push   %ebp
+f010a4ae:	89 e5                	mov    %esp,%ebp
+f010a4b0:	53                   	push   %ebx
+f010a4b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f010a4b4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+f010a4b7:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a4bc:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f010a4c0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f010a4c3:	83 c0 01             	add    $0x1,%eax
+f010a4c6:	84 d2                	test   %dl,%dl
+f010a4c8:	75 f2                	jne    f010a4bc <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+f010a4ca:	89 c8                	mov    %ecx,%eax
+f010a4cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010a4cf:	c9                   	leave
+f010a4d0:	c3                   	ret
+
+f010a4d1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+f010a4d1:	55                   	push   %ebp
+f010a4d2:	89 e5                	mov    %esp,%ebp
+f010a4d4:	53                   	push   %ebx
+f010a4d5:	83 ec 10             	sub    $0x10,%esp
+f010a4d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+f010a4db:	53                   	push   %ebx
+f010a4dc:	e8 91 ff ff ff       	call   f010a472 <strlen>
+f010a4e1:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+f010a4e4:	ff 75 0c             	push   0xc(%ebp)
+f010a4e7:	01 d8                	add    %ebx,%eax
+f010a4e9:	50                   	push   %eax
+f010a4ea:	e8 be ff ff ff       	call   f010a4ad <strcpy>
+	return dst;
+}
+f010a4ef:	89 d8                	mov    %ebx,%eax
+f010a4f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010a4f4:	c9                   	leave
+f010a4f5:	c3                   	ret
+
+f010a4f6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+f010a4f6:	55                   	push   %ebp
+f010a4f7:	89 e5                	mov    %esp,%ebp
+f010a4f9:	56                   	push   %esi
+f010a4fa:	53                   	push   %ebx
+f010a4fb:	8b 75 08             	mov    0x8(%ebp),%esi
+f010a4fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+f010a501:	89 f3                	mov    %esi,%ebx
+f010a503:	03 5d 10             	add    0x10(%ebp),%ebx
+f010a506:	89 f0                	mov    %esi,%eax
+f010a508:	eb 0f                	jmp    f010a519 <strncpy+0x23>
+		*dst++ = *src;
+f010a50a:	83 c0 01             	add    $0x1,%eax
+f010a50d:	0f b6 0a             	movzbl (%edx),%ecx
+f010a510:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+f010a513:	80 f9 01             	cmp    $0x1,%cl
+f010a516:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+f010a519:	39 d8                	cmp    %ebx,%eax
+f010a51b:	75 ed                	jne    f010a50a <strncpy+0x14>
+	}
+	return ret;
+}
+f010a51d:	89 f0                	mov    %esi,%eax
+f010a51f:	5b                   	pop    %ebx
+f010a520:	5e                   	pop    %esi
+f010a521:	5d                   	pop    %ebp
+f010a522:	c3                   	ret
+
+f010a523 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+f010a523:	55                   	push   %ebp
+f010a524:	89 e5                	mov    %esp,%ebp
+f010a526:	56                   	push   %esi
+f010a527:	53                   	push   %ebx
+f010a528:	8b 75 08             	mov    0x8(%ebp),%esi
+f010a52b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010a52e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+f010a531:	89 f0                	mov    %esi,%eax
+f010a533:	85 d2                	test   %edx,%edx
+f010a535:	74 21                	je     f010a558 <strlcpy+0x35>
+f010a537:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+f010a53b:	89 f2                	mov    %esi,%edx
+f010a53d:	eb 09                	jmp    f010a548 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+f010a53f:	83 c1 01             	add    $0x1,%ecx
+f010a542:	83 c2 01             	add    $0x1,%edx
+f010a545:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+f010a548:	39 c2                	cmp    %eax,%edx
+f010a54a:	74 09                	je     f010a555 <strlcpy+0x32>
+f010a54c:	0f b6 19             	movzbl (%ecx),%ebx
+f010a54f:	84 db                	test   %bl,%bl
+f010a551:	75 ec                	jne    f010a53f <strlcpy+0x1c>
+f010a553:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+f010a555:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+f010a558:	29 f0                	sub    %esi,%eax
+}
+f010a55a:	5b                   	pop    %ebx
+f010a55b:	5e                   	pop    %esi
+f010a55c:	5d                   	pop    %ebp
+f010a55d:	c3                   	ret
+
+f010a55e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+f010a55e:	55                   	push   %ebp
+f010a55f:	89 e5                	mov    %esp,%ebp
+f010a561:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f010a564:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+f010a567:	eb 06                	jmp    f010a56f <strcmp+0x11>
+		p++, q++;
+f010a569:	83 c1 01             	add    $0x1,%ecx
+f010a56c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+f010a56f:	0f b6 01             	movzbl (%ecx),%eax
+f010a572:	84 c0                	test   %al,%al
+f010a574:	74 04                	je     f010a57a <strcmp+0x1c>
+f010a576:	3a 02                	cmp    (%edx),%al
+f010a578:	74 ef                	je     f010a569 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+f010a57a:	0f b6 c0             	movzbl %al,%eax
+f010a57d:	0f b6 12             	movzbl (%edx),%edx
+f010a580:	29 d0                	sub    %edx,%eax
+}
+f010a582:	5d                   	pop    %ebp
+f010a583:	c3                   	ret
+
+f010a584 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+f010a584:	55                   	push   %ebp
+f010a585:	89 e5                	mov    %esp,%ebp
+f010a587:	53                   	push   %ebx
+f010a588:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a58b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010a58e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+f010a591:	eb 09                	jmp    f010a59c <strncmp+0x18>
+		n--, p++, q++;
+f010a593:	83 ea 01             	sub    $0x1,%edx
+f010a596:	83 c0 01             	add    $0x1,%eax
+f010a599:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+f010a59c:	85 d2                	test   %edx,%edx
+f010a59e:	74 18                	je     f010a5b8 <strncmp+0x34>
+f010a5a0:	0f b6 18             	movzbl (%eax),%ebx
+f010a5a3:	84 db                	test   %bl,%bl
+f010a5a5:	74 04                	je     f010a5ab <strncmp+0x27>
+f010a5a7:	3a 19                	cmp    (%ecx),%bl
+f010a5a9:	74 e8                	je     f010a593 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+f010a5ab:	0f b6 00             	movzbl (%eax),%eax
+f010a5ae:	0f b6 11             	movzbl (%ecx),%edx
+f010a5b1:	29 d0                	sub    %edx,%eax
+}
+f010a5b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010a5b6:	c9                   	leave
+f010a5b7:	c3                   	ret
+		return 0;
+f010a5b8:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a5bd:	eb f4                	jmp    f010a5b3 <strncmp+0x2f>
+
+f010a5bf <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+f010a5bf:	55                   	push   %ebp
+f010a5c0:	89 e5                	mov    %esp,%ebp
+f010a5c2:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a5c5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f010a5c9:	eb 03                	jmp    f010a5ce <strchr+0xf>
+f010a5cb:	83 c0 01             	add    $0x1,%eax
+f010a5ce:	0f b6 10             	movzbl (%eax),%edx
+f010a5d1:	84 d2                	test   %dl,%dl
+f010a5d3:	74 06                	je     f010a5db <strchr+0x1c>
+		if (*s == c)
+f010a5d5:	38 ca                	cmp    %cl,%dl
+f010a5d7:	75 f2                	jne    f010a5cb <strchr+0xc>
+f010a5d9:	eb 05                	jmp    f010a5e0 <strchr+0x21>
+			return (char *) s;
+	return 0;
+f010a5db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010a5e0:	5d                   	pop    %ebp
+f010a5e1:	c3                   	ret
+
+f010a5e2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+f010a5e2:	55                   	push   %ebp
+f010a5e3:	89 e5                	mov    %esp,%ebp
+f010a5e5:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a5e8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f010a5ec:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+f010a5ef:	38 ca                	cmp    %cl,%dl
+f010a5f1:	74 09                	je     f010a5fc <strfind+0x1a>
+f010a5f3:	84 d2                	test   %dl,%dl
+f010a5f5:	74 05                	je     f010a5fc <strfind+0x1a>
+	for (; *s; s++)
+f010a5f7:	83 c0 01             	add    $0x1,%eax
+f010a5fa:	eb f0                	jmp    f010a5ec <strfind+0xa>
+			break;
+	return (char *) s;
+}
+f010a5fc:	5d                   	pop    %ebp
+f010a5fd:	c3                   	ret
+
+f010a5fe <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+f010a5fe:	55                   	push   %ebp
+f010a5ff:	89 e5                	mov    %esp,%ebp
+f010a601:	57                   	push   %edi
+f010a602:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010a605:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+f010a608:	85 c9                	test   %ecx,%ecx
+f010a60a:	74 20                	je     f010a62c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+f010a60c:	89 f8                	mov    %edi,%eax
+f010a60e:	09 c8                	or     %ecx,%eax
+f010a610:	a8 03                	test   $0x3,%al
+f010a612:	75 12                	jne    f010a626 <memset+0x28>
+		c &= 0xFF;
+f010a614:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+f010a618:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+f010a61e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+f010a621:	fc                   	cld
+f010a622:	f3 ab                	rep stos %eax,%es:(%edi)
+f010a624:	eb 06                	jmp    f010a62c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+f010a626:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010a629:	fc                   	cld
+f010a62a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+f010a62c:	89 f8                	mov    %edi,%eax
+f010a62e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+f010a631:	c9                   	leave
+f010a632:	c3                   	ret
+
+f010a633 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+f010a633:	55                   	push   %ebp
+f010a634:	89 e5                	mov    %esp,%ebp
+f010a636:	57                   	push   %edi
+f010a637:	56                   	push   %esi
+f010a638:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a63b:	8b 75 0c             	mov    0xc(%ebp),%esi
+f010a63e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+f010a641:	39 c6                	cmp    %eax,%esi
+f010a643:	73 32                	jae    f010a677 <memmove+0x44>
+f010a645:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f010a648:	39 d0                	cmp    %edx,%eax
+f010a64a:	73 2b                	jae    f010a677 <memmove+0x44>
+		s += n;
+		d += n;
+f010a64c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f010a64f:	89 d6                	mov    %edx,%esi
+f010a651:	09 fe                	or     %edi,%esi
+f010a653:	09 ce                	or     %ecx,%esi
+f010a655:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f010a65b:	75 0e                	jne    f010a66b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+f010a65d:	83 ef 04             	sub    $0x4,%edi
+f010a660:	8d 72 fc             	lea    -0x4(%edx),%esi
+f010a663:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+f010a666:	fd                   	std
+f010a667:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f010a669:	eb 09                	jmp    f010a674 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+f010a66b:	83 ef 01             	sub    $0x1,%edi
+f010a66e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+f010a671:	fd                   	std
+f010a672:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+f010a674:	fc                   	cld
+f010a675:	eb 1a                	jmp    f010a691 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f010a677:	89 f2                	mov    %esi,%edx
+f010a679:	09 c2                	or     %eax,%edx
+f010a67b:	09 ca                	or     %ecx,%edx
+f010a67d:	f6 c2 03             	test   $0x3,%dl
+f010a680:	75 0a                	jne    f010a68c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+f010a682:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+f010a685:	89 c7                	mov    %eax,%edi
+f010a687:	fc                   	cld
+f010a688:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f010a68a:	eb 05                	jmp    f010a691 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+f010a68c:	89 c7                	mov    %eax,%edi
+f010a68e:	fc                   	cld
+f010a68f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+f010a691:	5e                   	pop    %esi
+f010a692:	5f                   	pop    %edi
+f010a693:	5d                   	pop    %ebp
+f010a694:	c3                   	ret
+
+f010a695 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+f010a695:	55                   	push   %ebp
+f010a696:	89 e5                	mov    %esp,%ebp
+f010a698:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+f010a69b:	ff 75 10             	push   0x10(%ebp)
+f010a69e:	ff 75 0c             	push   0xc(%ebp)
+f010a6a1:	ff 75 08             	push   0x8(%ebp)
+f010a6a4:	e8 8a ff ff ff       	call   f010a633 <memmove>
+}
+f010a6a9:	c9                   	leave
+f010a6aa:	c3                   	ret
+
+f010a6ab <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+f010a6ab:	55                   	push   %ebp
+f010a6ac:	89 e5                	mov    %esp,%ebp
+f010a6ae:	56                   	push   %esi
+f010a6af:	53                   	push   %ebx
+f010a6b0:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a6b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+f010a6b6:	89 c6                	mov    %eax,%esi
+f010a6b8:	03 75 10             	add    0x10(%ebp),%esi
+f010a6bb:	eb 06                	jmp    f010a6c3 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+f010a6bd:	83 c0 01             	add    $0x1,%eax
+f010a6c0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+f010a6c3:	39 f0                	cmp    %esi,%eax
+f010a6c5:	74 14                	je     f010a6db <memcmp+0x30>
+		if (*s1 != *s2)
+f010a6c7:	0f b6 08             	movzbl (%eax),%ecx
+f010a6ca:	0f b6 1a             	movzbl (%edx),%ebx
+f010a6cd:	38 d9                	cmp    %bl,%cl
+f010a6cf:	74 ec                	je     f010a6bd <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+f010a6d1:	0f b6 c1             	movzbl %cl,%eax
+f010a6d4:	0f b6 db             	movzbl %bl,%ebx
+f010a6d7:	29 d8                	sub    %ebx,%eax
+f010a6d9:	eb 05                	jmp    f010a6e0 <memcmp+0x35>
+	}
+
+	return 0;
+f010a6db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010a6e0:	5b                   	pop    %ebx
+f010a6e1:	5e                   	pop    %esi
+f010a6e2:	5d                   	pop    %ebp
+f010a6e3:	c3                   	ret
+
+f010a6e4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+f010a6e4:	55                   	push   %ebp
+f010a6e5:	89 e5                	mov    %esp,%ebp
+f010a6e7:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a6ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+f010a6ed:	89 c2                	mov    %eax,%edx
+f010a6ef:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+f010a6f2:	eb 03                	jmp    f010a6f7 <memfind+0x13>
+f010a6f4:	83 c0 01             	add    $0x1,%eax
+f010a6f7:	39 d0                	cmp    %edx,%eax
+f010a6f9:	73 04                	jae    f010a6ff <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+f010a6fb:	38 08                	cmp    %cl,(%eax)
+f010a6fd:	75 f5                	jne    f010a6f4 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+f010a6ff:	5d                   	pop    %ebp
+f010a700:	c3                   	ret
+
+f010a701 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+f010a701:	55                   	push   %ebp
+f010a702:	89 e5                	mov    %esp,%ebp
+f010a704:	57                   	push   %edi
+f010a705:	56                   	push   %esi
+f010a706:	53                   	push   %ebx
+f010a707:	8b 55 08             	mov    0x8(%ebp),%edx
+f010a70a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+f010a70d:	eb 03                	jmp    f010a712 <strtol+0x11>
+		s++;
+f010a70f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+f010a712:	0f b6 02             	movzbl (%edx),%eax
+f010a715:	3c 20                	cmp    $0x20,%al
+f010a717:	74 f6                	je     f010a70f <strtol+0xe>
+f010a719:	3c 09                	cmp    $0x9,%al
+f010a71b:	74 f2                	je     f010a70f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+f010a71d:	3c 2b                	cmp    $0x2b,%al
+f010a71f:	74 2a                	je     f010a74b <strtol+0x4a>
+	int neg = 0;
+f010a721:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+f010a726:	3c 2d                	cmp    $0x2d,%al
+f010a728:	74 2b                	je     f010a755 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f010a72a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f010a730:	75 0f                	jne    f010a741 <strtol+0x40>
+f010a732:	80 3a 30             	cmpb   $0x30,(%edx)
+f010a735:	74 28                	je     f010a75f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+f010a737:	85 db                	test   %ebx,%ebx
+f010a739:	b8 0a 00 00 00       	mov    $0xa,%eax
+f010a73e:	0f 44 d8             	cmove  %eax,%ebx
+f010a741:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a746:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f010a749:	eb 46                	jmp    f010a791 <strtol+0x90>
+		s++;
+f010a74b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+f010a74e:	bf 00 00 00 00       	mov    $0x0,%edi
+f010a753:	eb d5                	jmp    f010a72a <strtol+0x29>
+		s++, neg = 1;
+f010a755:	83 c2 01             	add    $0x1,%edx
+f010a758:	bf 01 00 00 00       	mov    $0x1,%edi
+f010a75d:	eb cb                	jmp    f010a72a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f010a75f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f010a763:	74 0e                	je     f010a773 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+f010a765:	85 db                	test   %ebx,%ebx
+f010a767:	75 d8                	jne    f010a741 <strtol+0x40>
+		s++, base = 8;
+f010a769:	83 c2 01             	add    $0x1,%edx
+f010a76c:	bb 08 00 00 00       	mov    $0x8,%ebx
+f010a771:	eb ce                	jmp    f010a741 <strtol+0x40>
+		s += 2, base = 16;
+f010a773:	83 c2 02             	add    $0x2,%edx
+f010a776:	bb 10 00 00 00       	mov    $0x10,%ebx
+f010a77b:	eb c4                	jmp    f010a741 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+f010a77d:	0f be c0             	movsbl %al,%eax
+f010a780:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+f010a783:	3b 45 10             	cmp    0x10(%ebp),%eax
+f010a786:	7d 3a                	jge    f010a7c2 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+f010a788:	83 c2 01             	add    $0x1,%edx
+f010a78b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f010a78f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+f010a791:	0f b6 02             	movzbl (%edx),%eax
+f010a794:	8d 70 d0             	lea    -0x30(%eax),%esi
+f010a797:	89 f3                	mov    %esi,%ebx
+f010a799:	80 fb 09             	cmp    $0x9,%bl
+f010a79c:	76 df                	jbe    f010a77d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+f010a79e:	8d 70 9f             	lea    -0x61(%eax),%esi
+f010a7a1:	89 f3                	mov    %esi,%ebx
+f010a7a3:	80 fb 19             	cmp    $0x19,%bl
+f010a7a6:	77 08                	ja     f010a7b0 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+f010a7a8:	0f be c0             	movsbl %al,%eax
+f010a7ab:	83 e8 57             	sub    $0x57,%eax
+f010a7ae:	eb d3                	jmp    f010a783 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+f010a7b0:	8d 70 bf             	lea    -0x41(%eax),%esi
+f010a7b3:	89 f3                	mov    %esi,%ebx
+f010a7b5:	80 fb 19             	cmp    $0x19,%bl
+f010a7b8:	77 08                	ja     f010a7c2 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+f010a7ba:	0f be c0             	movsbl %al,%eax
+f010a7bd:	83 e8 37             	sub    $0x37,%eax
+f010a7c0:	eb c1                	jmp    f010a783 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+f010a7c2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f010a7c6:	74 05                	je     f010a7cd <strtol+0xcc>
+		*endptr = (char *) s;
+f010a7c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010a7cb:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+f010a7cd:	89 c8                	mov    %ecx,%eax
+f010a7cf:	f7 d8                	neg    %eax
+f010a7d1:	85 ff                	test   %edi,%edi
+f010a7d3:	0f 45 c8             	cmovne %eax,%ecx
+}
+f010a7d6:	89 c8                	mov    %ecx,%eax
+f010a7d8:	5b                   	pop    %ebx
+f010a7d9:	5e                   	pop    %esi
+f010a7da:	5f                   	pop    %edi
+f010a7db:	5d                   	pop    %ebp
+f010a7dc:	c3                   	ret
+f010a7dd:	66 90                	xchg   %ax,%ax
+f010a7df:	90                   	nop
+
+f010a7e0 <mpentry_start>:
+.set PROT_MODE_DSEG, 0x10	# kernel data segment selector
+
+.code16           
+.globl mpentry_start
+mpentry_start:
+	cli            
+f010a7e0:	fa                   	cli
+
+	xorw    %ax, %ax
+f010a7e1:	31 c0                	xor    %eax,%eax
+	movw    %ax, %ds
+f010a7e3:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f010a7e5:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f010a7e7:	8e d0                	mov    %eax,%ss
+
+	lgdt    MPBOOTPHYS(gdtdesc)
+f010a7e9:	0f 01 16             	lgdtl  (%esi)
+f010a7ec:	74 70                	je     f010a85e <mpsearch1+0x3>
+	movl    %cr0, %eax
+f010a7ee:	0f 20 c0             	mov    %cr0,%eax
+	orl     $CR0_PE, %eax
+f010a7f1:	66 83 c8 01          	or     $0x1,%ax
+	movl    %eax, %cr0
+f010a7f5:	0f 22 c0             	mov    %eax,%cr0
+
+	ljmpl   $(PROT_MODE_CSEG), $(MPBOOTPHYS(start32))
+f010a7f8:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f010a7fe:	08 00                	or     %al,(%eax)
+
+f010a800 <start32>:
+
+.code32
+start32:
+	movw    $(PROT_MODE_DSEG), %ax
+f010a800:	66 b8 10 00          	mov    $0x10,%ax
+	movw    %ax, %ds
+f010a804:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f010a806:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f010a808:	8e d0                	mov    %eax,%ss
+	movw    $0, %ax
+f010a80a:	66 b8 00 00          	mov    $0x0,%ax
+	movw    %ax, %fs
+f010a80e:	8e e0                	mov    %eax,%fs
+	movw    %ax, %gs
+f010a810:	8e e8                	mov    %eax,%gs
+
+	# Set up initial page table. We cannot use kern_pgdir yet because
+	# we are still running at a low EIP.
+	movl    $(RELOC(entry_pgdir)), %eax
+f010a812:	b8 00 70 11 00       	mov    $0x117000,%eax
+	movl    %eax, %cr3
+f010a817:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl    %cr0, %eax
+f010a81a:	0f 20 c0             	mov    %cr0,%eax
+	orl     $(CR0_PE|CR0_PG|CR0_WP), %eax
+f010a81d:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl    %eax, %cr0
+f010a822:	0f 22 c0             	mov    %eax,%cr0
+
+	# Switch to the per-cpu stack allocated in boot_aps()
+	movl    mpentry_kstack, %esp
+f010a825:	8b 25 68 89 61 f0    	mov    0xf0618968,%esp
+	movl    $0x0, %ebp       # nuke frame pointer
+f010a82b:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Call mp_main().  (Exercise for the reader: why the indirect call?)
+	movl    $mp_main, %eax
+f010a830:	b8 40 00 10 f0       	mov    $0xf0100040,%eax
+	call    *%eax
+f010a835:	ff d0                	call   *%eax
+
+f010a837 <spin>:
+
+	# If mp_main returns (it shouldn't), loop.
+spin:
+	jmp     spin
+f010a837:	eb fe                	jmp    f010a837 <spin>
+f010a839:	8d 76 00             	lea    0x0(%esi),%esi
+
+f010a83c <gdt>:
+	...
+f010a844:	ff                   	(bad)
+f010a845:	ff 00                	incl   (%eax)
+f010a847:	00 00                	add    %al,(%eax)
+f010a849:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f010a850:	00                   	.byte 0x0
+f010a851:	92                   	xchg   %eax,%edx
+f010a852:	cf                   	iret
+	...
+
+f010a854 <gdtdesc>:
+f010a854:	17                   	pop    %ss
+f010a855:	00 5c 70 00          	add    %bl,0x0(%eax,%esi,2)
+	...
+
+f010a85a <mpentry_end>:
+	.word   0x17				# sizeof(gdt) - 1
+	.long   MPBOOTPHYS(gdt)			# address gdt
+
+.globl mpentry_end
+mpentry_end:
+	nop
+f010a85a:	90                   	nop
+
+f010a85b <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at physical address addr.
+static struct mp *
+mpsearch1(physaddr_t a, int len)
+{
+f010a85b:	55                   	push   %ebp
+f010a85c:	89 e5                	mov    %esp,%ebp
+f010a85e:	57                   	push   %edi
+f010a85f:	56                   	push   %esi
+f010a860:	53                   	push   %ebx
+f010a861:	83 ec 0c             	sub    $0xc,%esp
+f010a864:	89 c3                	mov    %eax,%ebx
+f010a866:	89 d7                	mov    %edx,%edi
+	if (PGNUM(pa) >= npages_lowmem)
+f010a868:	a1 6c 89 61 f0       	mov    0xf061896c,%eax
+f010a86d:	89 da                	mov    %ebx,%edx
+f010a86f:	c1 ea 0c             	shr    $0xc,%edx
+f010a872:	39 c2                	cmp    %eax,%edx
+f010a874:	73 1f                	jae    f010a895 <mpsearch1+0x3a>
+	return (void *)(pa + KERNBASE);
+f010a876:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+	struct mp *mp = KADDR(a), *end = KADDR(a + len);
+f010a87c:	01 df                	add    %ebx,%edi
+	if (PGNUM(pa) >= npages_lowmem)
+f010a87e:	89 fa                	mov    %edi,%edx
+f010a880:	c1 ea 0c             	shr    $0xc,%edx
+f010a883:	39 c2                	cmp    %eax,%edx
+f010a885:	73 20                	jae    f010a8a7 <mpsearch1+0x4c>
+	return (void *)(pa + KERNBASE);
+f010a887:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+
+	for (; mp < end; mp++)
+f010a88d:	81 eb f0 ff ff 0f    	sub    $0xffffff0,%ebx
+f010a893:	eb 3a                	jmp    f010a8cf <mpsearch1+0x74>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010a895:	53                   	push   %ebx
+f010a896:	68 1c c0 10 f0       	push   $0xf010c01c
+f010a89b:	6a 57                	push   $0x57
+f010a89d:	68 5d e9 10 f0       	push   $0xf010e95d
+f010a8a2:	e8 f1 57 ff ff       	call   f0100098 <_panic>
+f010a8a7:	57                   	push   %edi
+f010a8a8:	68 1c c0 10 f0       	push   $0xf010c01c
+f010a8ad:	6a 57                	push   $0x57
+f010a8af:	68 5d e9 10 f0       	push   $0xf010e95d
+f010a8b4:	e8 df 57 ff ff       	call   f0100098 <_panic>
+		sum += ((uint8_t *)addr)[i];
+f010a8b9:	0f b6 0a             	movzbl (%edx),%ecx
+f010a8bc:	01 c8                	add    %ecx,%eax
+	for (i = 0; i < len; i++)
+f010a8be:	83 c2 01             	add    $0x1,%edx
+f010a8c1:	39 da                	cmp    %ebx,%edx
+f010a8c3:	75 f4                	jne    f010a8b9 <mpsearch1+0x5e>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f010a8c5:	84 c0                	test   %al,%al
+f010a8c7:	74 2a                	je     f010a8f3 <mpsearch1+0x98>
+	for (; mp < end; mp++)
+f010a8c9:	83 c6 10             	add    $0x10,%esi
+f010a8cc:	83 c3 10             	add    $0x10,%ebx
+f010a8cf:	39 fe                	cmp    %edi,%esi
+f010a8d1:	73 1b                	jae    f010a8ee <mpsearch1+0x93>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f010a8d3:	83 ec 04             	sub    $0x4,%esp
+f010a8d6:	6a 04                	push   $0x4
+f010a8d8:	68 6d e9 10 f0       	push   $0xf010e96d
+f010a8dd:	56                   	push   %esi
+f010a8de:	e8 c8 fd ff ff       	call   f010a6ab <memcmp>
+f010a8e3:	83 c4 10             	add    $0x10,%esp
+f010a8e6:	89 f2                	mov    %esi,%edx
+f010a8e8:	85 c0                	test   %eax,%eax
+f010a8ea:	74 d5                	je     f010a8c1 <mpsearch1+0x66>
+f010a8ec:	eb db                	jmp    f010a8c9 <mpsearch1+0x6e>
+		    sum(mp, sizeof(*mp)) == 0)
+			return mp;
+	return NULL;
+f010a8ee:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f010a8f3:	89 f0                	mov    %esi,%eax
+f010a8f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a8f8:	5b                   	pop    %ebx
+f010a8f9:	5e                   	pop    %esi
+f010a8fa:	5f                   	pop    %edi
+f010a8fb:	5d                   	pop    %ebp
+f010a8fc:	c3                   	ret
+
+f010a8fd <mp_init>:
+	return conf;
+}
+
+void
+mp_init(void)
+{
+f010a8fd:	55                   	push   %ebp
+f010a8fe:	89 e5                	mov    %esp,%ebp
+f010a900:	57                   	push   %edi
+f010a901:	56                   	push   %esi
+f010a902:	53                   	push   %ebx
+f010a903:	83 ec 1c             	sub    $0x1c,%esp
+	struct mpconf *conf;
+	struct mpproc *proc;
+	uint8_t *p;
+	unsigned int i;
+
+	bootcpu = &cpus[0];
+f010a906:	c7 05 00 96 61 f0 20 	movl   $0xf0619020,0xf0619600
+f010a90d:	90 61 f0 
+	if (PGNUM(pa) >= npages_lowmem)
+f010a910:	83 3d 6c 89 61 f0 00 	cmpl   $0x0,0xf061896c
+f010a917:	0f 84 86 00 00 00    	je     f010a9a3 <mp_init+0xa6>
+	if ((p = *(uint16_t *) (bda + 0x0E))) {
+f010a91d:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+f010a924:	85 c0                	test   %eax,%eax
+f010a926:	0f 84 8d 00 00 00    	je     f010a9b9 <mp_init+0xbc>
+		p <<= 4;	// Translate from segment to PA
+f010a92c:	c1 e0 04             	shl    $0x4,%eax
+		if ((mp = mpsearch1(p, 1024)))
+f010a92f:	ba 00 04 00 00       	mov    $0x400,%edx
+f010a934:	e8 22 ff ff ff       	call   f010a85b <mpsearch1>
+f010a939:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010a93c:	85 c0                	test   %eax,%eax
+f010a93e:	75 1a                	jne    f010a95a <mp_init+0x5d>
+	return mpsearch1(0xF0000, 0x10000);
+f010a940:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010a945:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+f010a94a:	e8 0c ff ff ff       	call   f010a85b <mpsearch1>
+f010a94f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((mp = mpsearch()) == 0)
+f010a952:	85 c0                	test   %eax,%eax
+f010a954:	0f 84 26 02 00 00    	je     f010ab80 <mp_init+0x283>
+	if (mp->physaddr == 0 || mp->type != 0) {
+f010a95a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010a95d:	8b 58 04             	mov    0x4(%eax),%ebx
+f010a960:	85 db                	test   %ebx,%ebx
+f010a962:	74 7a                	je     f010a9de <mp_init+0xe1>
+f010a964:	80 78 0b 00          	cmpb   $0x0,0xb(%eax)
+f010a968:	75 74                	jne    f010a9de <mp_init+0xe1>
+f010a96a:	89 d8                	mov    %ebx,%eax
+f010a96c:	c1 e8 0c             	shr    $0xc,%eax
+f010a96f:	3b 05 6c 89 61 f0    	cmp    0xf061896c,%eax
+f010a975:	73 7c                	jae    f010a9f3 <mp_init+0xf6>
+	return (void *)(pa + KERNBASE);
+f010a977:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f010a97d:	89 de                	mov    %ebx,%esi
+	if (memcmp(conf, "PCMP", 4) != 0) {
+f010a97f:	83 ec 04             	sub    $0x4,%esp
+f010a982:	6a 04                	push   $0x4
+f010a984:	68 72 e9 10 f0       	push   $0xf010e972
+f010a989:	53                   	push   %ebx
+f010a98a:	e8 1c fd ff ff       	call   f010a6ab <memcmp>
+f010a98f:	83 c4 10             	add    $0x10,%esp
+f010a992:	85 c0                	test   %eax,%eax
+f010a994:	75 72                	jne    f010aa08 <mp_init+0x10b>
+	for (i = 0; i < len; i++)
+f010a996:	0f b7 7b 04          	movzwl 0x4(%ebx),%edi
+f010a99a:	01 df                	add    %ebx,%edi
+	sum = 0;
+f010a99c:	89 c2                	mov    %eax,%edx
+	for (i = 0; i < len; i++)
+f010a99e:	e9 82 00 00 00       	jmp    f010aa25 <mp_init+0x128>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010a9a3:	68 00 04 00 00       	push   $0x400
+f010a9a8:	68 1c c0 10 f0       	push   $0xf010c01c
+f010a9ad:	6a 6f                	push   $0x6f
+f010a9af:	68 5d e9 10 f0       	push   $0xf010e95d
+f010a9b4:	e8 df 56 ff ff       	call   f0100098 <_panic>
+		p = *(uint16_t *) (bda + 0x13) * 1024;
+f010a9b9:	0f b7 05 13 04 00 f0 	movzwl 0xf0000413,%eax
+f010a9c0:	c1 e0 0a             	shl    $0xa,%eax
+		if ((mp = mpsearch1(p - 1024, 1024)))
+f010a9c3:	2d 00 04 00 00       	sub    $0x400,%eax
+f010a9c8:	ba 00 04 00 00       	mov    $0x400,%edx
+f010a9cd:	e8 89 fe ff ff       	call   f010a85b <mpsearch1>
+f010a9d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010a9d5:	85 c0                	test   %eax,%eax
+f010a9d7:	75 81                	jne    f010a95a <mp_init+0x5d>
+f010a9d9:	e9 62 ff ff ff       	jmp    f010a940 <mp_init+0x43>
+		cprintf("SMP: Default configurations not implemented\n");
+f010a9de:	83 ec 0c             	sub    $0xc,%esp
+f010a9e1:	68 d0 e7 10 f0       	push   $0xf010e7d0
+f010a9e6:	e8 11 c6 ff ff       	call   f0106ffc <cprintf>
+		return NULL;
+f010a9eb:	83 c4 10             	add    $0x10,%esp
+f010a9ee:	e9 8d 01 00 00       	jmp    f010ab80 <mp_init+0x283>
+f010a9f3:	53                   	push   %ebx
+f010a9f4:	68 1c c0 10 f0       	push   $0xf010c01c
+f010a9f9:	68 90 00 00 00       	push   $0x90
+f010a9fe:	68 5d e9 10 f0       	push   $0xf010e95d
+f010aa03:	e8 90 56 ff ff       	call   f0100098 <_panic>
+		cprintf("SMP: Incorrect MP configuration table signature\n");
+f010aa08:	83 ec 0c             	sub    $0xc,%esp
+f010aa0b:	68 00 e8 10 f0       	push   $0xf010e800
+f010aa10:	e8 e7 c5 ff ff       	call   f0106ffc <cprintf>
+		return NULL;
+f010aa15:	83 c4 10             	add    $0x10,%esp
+f010aa18:	e9 63 01 00 00       	jmp    f010ab80 <mp_init+0x283>
+		sum += ((uint8_t *)addr)[i];
+f010aa1d:	0f b6 0b             	movzbl (%ebx),%ecx
+f010aa20:	01 ca                	add    %ecx,%edx
+	for (i = 0; i < len; i++)
+f010aa22:	83 c3 01             	add    $0x1,%ebx
+f010aa25:	39 fb                	cmp    %edi,%ebx
+f010aa27:	75 f4                	jne    f010aa1d <mp_init+0x120>
+	if (sum(conf, conf->length) != 0) {
+f010aa29:	84 d2                	test   %dl,%dl
+f010aa2b:	75 16                	jne    f010aa43 <mp_init+0x146>
+	if (conf->version != 1 && conf->version != 4) {
+f010aa2d:	0f b6 56 06          	movzbl 0x6(%esi),%edx
+f010aa31:	80 fa 01             	cmp    $0x1,%dl
+f010aa34:	74 05                	je     f010aa3b <mp_init+0x13e>
+f010aa36:	80 fa 04             	cmp    $0x4,%dl
+f010aa39:	75 1d                	jne    f010aa58 <mp_init+0x15b>
+	for (i = 0; i < len; i++)
+f010aa3b:	0f b7 4e 28          	movzwl 0x28(%esi),%ecx
+f010aa3f:	01 d9                	add    %ebx,%ecx
+f010aa41:	eb 36                	jmp    f010aa79 <mp_init+0x17c>
+		cprintf("SMP: Bad MP configuration checksum\n");
+f010aa43:	83 ec 0c             	sub    $0xc,%esp
+f010aa46:	68 34 e8 10 f0       	push   $0xf010e834
+f010aa4b:	e8 ac c5 ff ff       	call   f0106ffc <cprintf>
+		return NULL;
+f010aa50:	83 c4 10             	add    $0x10,%esp
+f010aa53:	e9 28 01 00 00       	jmp    f010ab80 <mp_init+0x283>
+		cprintf("SMP: Unsupported MP version %d\n", conf->version);
+f010aa58:	83 ec 08             	sub    $0x8,%esp
+f010aa5b:	0f b6 d2             	movzbl %dl,%edx
+f010aa5e:	52                   	push   %edx
+f010aa5f:	68 58 e8 10 f0       	push   $0xf010e858
+f010aa64:	e8 93 c5 ff ff       	call   f0106ffc <cprintf>
+		return NULL;
+f010aa69:	83 c4 10             	add    $0x10,%esp
+f010aa6c:	e9 0f 01 00 00       	jmp    f010ab80 <mp_init+0x283>
+		sum += ((uint8_t *)addr)[i];
+f010aa71:	0f b6 13             	movzbl (%ebx),%edx
+f010aa74:	01 d0                	add    %edx,%eax
+	for (i = 0; i < len; i++)
+f010aa76:	83 c3 01             	add    $0x1,%ebx
+f010aa79:	39 d9                	cmp    %ebx,%ecx
+f010aa7b:	75 f4                	jne    f010aa71 <mp_init+0x174>
+	if ((sum((uint8_t *)conf + conf->length, conf->xlength) + conf->xchecksum) & 0xff) {
+f010aa7d:	02 46 2a             	add    0x2a(%esi),%al
+f010aa80:	75 1c                	jne    f010aa9e <mp_init+0x1a1>
+	if ((conf = mpconfig(&mp)) == 0)
+		return;
+	ismp = 1;
+f010aa82:	c7 05 00 90 61 f0 01 	movl   $0x1,0xf0619000
+f010aa89:	00 00 00 
+	lapicaddr = conf->lapicaddr;
+f010aa8c:	8b 46 24             	mov    0x24(%esi),%eax
+f010aa8f:	a3 00 a0 65 f0       	mov    %eax,0xf065a000
+
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f010aa94:	8d 7e 2c             	lea    0x2c(%esi),%edi
+f010aa97:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010aa9c:	eb 53                	jmp    f010aaf1 <mp_init+0x1f4>
+		cprintf("SMP: Bad MP configuration extended checksum\n");
+f010aa9e:	83 ec 0c             	sub    $0xc,%esp
+f010aaa1:	68 78 e8 10 f0       	push   $0xf010e878
+f010aaa6:	e8 51 c5 ff ff       	call   f0106ffc <cprintf>
+		return NULL;
+f010aaab:	83 c4 10             	add    $0x10,%esp
+f010aaae:	e9 cd 00 00 00       	jmp    f010ab80 <mp_init+0x283>
+		switch (*p) {
+		case MPPROC:
+			proc = (struct mpproc *)p;
+			if (proc->flags & MPPROC_BOOT)
+f010aab3:	f6 47 03 02          	testb  $0x2,0x3(%edi)
+f010aab7:	74 14                	je     f010aacd <mp_init+0x1d0>
+				bootcpu = &cpus[ncpu];
+f010aab9:	69 05 04 96 61 f0 bc 	imul   $0xbc,0xf0619604,%eax
+f010aac0:	00 00 00 
+f010aac3:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f010aac8:	a3 00 96 61 f0       	mov    %eax,0xf0619600
+			if (ncpu < NCPU) {
+f010aacd:	a1 04 96 61 f0       	mov    0xf0619604,%eax
+f010aad2:	83 f8 07             	cmp    $0x7,%eax
+f010aad5:	7f 36                	jg     f010ab0d <mp_init+0x210>
+				cpus[ncpu].cpu_id = ncpu;
+f010aad7:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+f010aadd:	88 82 20 90 61 f0    	mov    %al,-0xf9e6fe0(%edx)
+				ncpu++;
+f010aae3:	83 c0 01             	add    $0x1,%eax
+f010aae6:	a3 04 96 61 f0       	mov    %eax,0xf0619604
+			} else {
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+					proc->apicid);
+			}
+			p += sizeof(struct mpproc);
+f010aaeb:	83 c7 14             	add    $0x14,%edi
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f010aaee:	83 c3 01             	add    $0x1,%ebx
+f010aaf1:	0f b7 46 22          	movzwl 0x22(%esi),%eax
+f010aaf5:	39 c3                	cmp    %eax,%ebx
+f010aaf7:	73 4f                	jae    f010ab48 <mp_init+0x24b>
+		switch (*p) {
+f010aaf9:	0f b6 07             	movzbl (%edi),%eax
+f010aafc:	84 c0                	test   %al,%al
+f010aafe:	74 b3                	je     f010aab3 <mp_init+0x1b6>
+f010ab00:	8d 50 ff             	lea    -0x1(%eax),%edx
+f010ab03:	80 fa 03             	cmp    $0x3,%dl
+f010ab06:	77 1c                	ja     f010ab24 <mp_init+0x227>
+			continue;
+		case MPBUS:
+		case MPIOAPIC:
+		case MPIOINTR:
+		case MPLINTR:
+			p += 8;
+f010ab08:	83 c7 08             	add    $0x8,%edi
+			continue;
+f010ab0b:	eb e1                	jmp    f010aaee <mp_init+0x1f1>
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+f010ab0d:	83 ec 08             	sub    $0x8,%esp
+f010ab10:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+f010ab14:	50                   	push   %eax
+f010ab15:	68 a8 e8 10 f0       	push   $0xf010e8a8
+f010ab1a:	e8 dd c4 ff ff       	call   f0106ffc <cprintf>
+f010ab1f:	83 c4 10             	add    $0x10,%esp
+f010ab22:	eb c7                	jmp    f010aaeb <mp_init+0x1ee>
+		default:
+			cprintf("mpinit: unknown config type %x\n", *p);
+f010ab24:	83 ec 08             	sub    $0x8,%esp
+		switch (*p) {
+f010ab27:	0f b6 c0             	movzbl %al,%eax
+			cprintf("mpinit: unknown config type %x\n", *p);
+f010ab2a:	50                   	push   %eax
+f010ab2b:	68 d0 e8 10 f0       	push   $0xf010e8d0
+f010ab30:	e8 c7 c4 ff ff       	call   f0106ffc <cprintf>
+			ismp = 0;
+f010ab35:	c7 05 00 90 61 f0 00 	movl   $0x0,0xf0619000
+f010ab3c:	00 00 00 
+			i = conf->entry;
+f010ab3f:	0f b7 5e 22          	movzwl 0x22(%esi),%ebx
+f010ab43:	83 c4 10             	add    $0x10,%esp
+f010ab46:	eb a6                	jmp    f010aaee <mp_init+0x1f1>
+		}
+	}
+
+	bootcpu->cpu_status = CPU_STARTED;
+f010ab48:	a1 00 96 61 f0       	mov    0xf0619600,%eax
+f010ab4d:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	if (!ismp) {
+f010ab54:	83 3d 00 90 61 f0 00 	cmpl   $0x0,0xf0619000
+f010ab5b:	74 2b                	je     f010ab88 <mp_init+0x28b>
+		ncpu = 1;
+		lapicaddr = 0;
+		cprintf("SMP: configuration not found, SMP disabled\n");
+		return;
+	}
+	cprintf("SMP: CPU %d found %d CPU(s)\n", bootcpu->cpu_id,  ncpu);
+f010ab5d:	83 ec 04             	sub    $0x4,%esp
+f010ab60:	ff 35 04 96 61 f0    	push   0xf0619604
+f010ab66:	0f b6 00             	movzbl (%eax),%eax
+f010ab69:	50                   	push   %eax
+f010ab6a:	68 77 e9 10 f0       	push   $0xf010e977
+f010ab6f:	e8 88 c4 ff ff       	call   f0106ffc <cprintf>
+
+	if (mp->imcrp) {
+f010ab74:	83 c4 10             	add    $0x10,%esp
+f010ab77:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010ab7a:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+f010ab7e:	75 2e                	jne    f010abae <mp_init+0x2b1>
+		// switch to getting interrupts from the LAPIC.
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+		outb(0x22, 0x70);   // Select IMCR
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+	}
+}
+f010ab80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010ab83:	5b                   	pop    %ebx
+f010ab84:	5e                   	pop    %esi
+f010ab85:	5f                   	pop    %edi
+f010ab86:	5d                   	pop    %ebp
+f010ab87:	c3                   	ret
+		ncpu = 1;
+f010ab88:	c7 05 04 96 61 f0 01 	movl   $0x1,0xf0619604
+f010ab8f:	00 00 00 
+		lapicaddr = 0;
+f010ab92:	c7 05 00 a0 65 f0 00 	movl   $0x0,0xf065a000
+f010ab99:	00 00 00 
+		cprintf("SMP: configuration not found, SMP disabled\n");
+f010ab9c:	83 ec 0c             	sub    $0xc,%esp
+f010ab9f:	68 f0 e8 10 f0       	push   $0xf010e8f0
+f010aba4:	e8 53 c4 ff ff       	call   f0106ffc <cprintf>
+		return;
+f010aba9:	83 c4 10             	add    $0x10,%esp
+f010abac:	eb d2                	jmp    f010ab80 <mp_init+0x283>
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+f010abae:	83 ec 0c             	sub    $0xc,%esp
+f010abb1:	68 1c e9 10 f0       	push   $0xf010e91c
+f010abb6:	e8 41 c4 ff ff       	call   f0106ffc <cprintf>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010abbb:	b8 70 00 00 00       	mov    $0x70,%eax
+f010abc0:	ba 22 00 00 00       	mov    $0x22,%edx
+f010abc5:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010abc6:	ba 23 00 00 00       	mov    $0x23,%edx
+f010abcb:	ec                   	in     (%dx),%al
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+f010abcc:	83 c8 01             	or     $0x1,%eax
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010abcf:	ee                   	out    %al,(%dx)
+}
+f010abd0:	83 c4 10             	add    $0x10,%esp
+f010abd3:	eb ab                	jmp    f010ab80 <mp_init+0x283>
+
+f010abd5 <lapicw>:
+volatile uint32_t *lapic;
+
+static void
+lapicw(int index, int value)
+{
+	lapic[index] = value;
+f010abd5:	8b 0d 04 a0 65 f0    	mov    0xf065a004,%ecx
+f010abdb:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f010abde:	89 10                	mov    %edx,(%eax)
+	lapic[ID];  // wait for write to finish, by reading
+f010abe0:	a1 04 a0 65 f0       	mov    0xf065a004,%eax
+f010abe5:	8b 40 20             	mov    0x20(%eax),%eax
+}
+f010abe8:	c3                   	ret
+
+f010abe9 <lapic_timer_start>:
+// from lapic[TICR] and then issues an interrupt.
+// If we cared more about precise timekeeping,
+// TICR would be calibrated using an external time source.
+void
+lapic_timer_start(void)
+{
+f010abe9:	55                   	push   %ebp
+f010abea:	89 e5                	mov    %esp,%ebp
+f010abec:	83 ec 08             	sub    $0x8,%esp
+	lapicw(TDCR, X1);
+f010abef:	ba 0b 00 00 00       	mov    $0xb,%edx
+f010abf4:	b8 f8 00 00 00       	mov    $0xf8,%eax
+f010abf9:	e8 d7 ff ff ff       	call   f010abd5 <lapicw>
+	lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
+f010abfe:	ba 20 00 02 00       	mov    $0x20020,%edx
+f010ac03:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f010ac08:	e8 c8 ff ff ff       	call   f010abd5 <lapicw>
+	lapicw(TICR, 10000000);
+f010ac0d:	ba 80 96 98 00       	mov    $0x989680,%edx
+f010ac12:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f010ac17:	e8 b9 ff ff ff       	call   f010abd5 <lapicw>
+}
+f010ac1c:	c9                   	leave
+f010ac1d:	c3                   	ret
+
+f010ac1e <lapic_timer_stop>:
+
+// Stop this CPU's timer.  It takes no timer interrupts until the next
+// lapic_timer_start().
+void
+lapic_timer_stop(void)
+{
+f010ac1e:	55                   	push   %ebp
+f010ac1f:	89 e5                	mov    %esp,%ebp
+f010ac21:	83 ec 08             	sub    $0x8,%esp
+	lapicw(TIMER, MASKED | (IRQ_OFFSET + IRQ_TIMER));
+f010ac24:	ba 20 00 01 00       	mov    $0x10020,%edx
+f010ac29:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f010ac2e:	e8 a2 ff ff ff       	call   f010abd5 <lapicw>
+	lapicw(TICR, 0);
+f010ac33:	ba 00 00 00 00       	mov    $0x0,%edx
+f010ac38:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f010ac3d:	e8 93 ff ff ff       	call   f010abd5 <lapicw>
+}
+f010ac42:	c9                   	leave
+f010ac43:	c3                   	ret
+
+f010ac44 <cpunum>:
+}
+
+int
+cpunum(void)
+{
+	if (lapic)
+f010ac44:	8b 15 04 a0 65 f0    	mov    0xf065a004,%edx
+		return lapic[ID] >> 24;
+	return 0;
+f010ac4a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lapic)
+f010ac4f:	85 d2                	test   %edx,%edx
+f010ac51:	74 06                	je     f010ac59 <cpunum+0x15>
+		return lapic[ID] >> 24;
+f010ac53:	8b 42 20             	mov    0x20(%edx),%eax
+f010ac56:	c1 e8 18             	shr    $0x18,%eax
+}
+f010ac59:	c3                   	ret
+
+f010ac5a <lapic_init>:
+	if (!lapicaddr)
+f010ac5a:	a1 00 a0 65 f0       	mov    0xf065a000,%eax
+f010ac5f:	85 c0                	test   %eax,%eax
+f010ac61:	75 01                	jne    f010ac64 <lapic_init+0xa>
+f010ac63:	c3                   	ret
+{
+f010ac64:	55                   	push   %ebp
+f010ac65:	89 e5                	mov    %esp,%ebp
+f010ac67:	83 ec 10             	sub    $0x10,%esp
+	lapic = mmio_map_region(lapicaddr, 4096);
+f010ac6a:	68 00 10 00 00       	push   $0x1000
+f010ac6f:	50                   	push   %eax
+f010ac70:	e8 39 85 ff ff       	call   f01031ae <mmio_map_region>
+f010ac75:	a3 04 a0 65 f0       	mov    %eax,0xf065a004
+	lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+f010ac7a:	ba 27 01 00 00       	mov    $0x127,%edx
+f010ac7f:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f010ac84:	e8 4c ff ff ff       	call   f010abd5 <lapicw>
+	lapic_timer_start();
+f010ac89:	e8 5b ff ff ff       	call   f010abe9 <lapic_timer_start>
+	if (thiscpu != bootcpu)
+f010ac8e:	e8 b1 ff ff ff       	call   f010ac44 <cpunum>
+f010ac93:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010ac99:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f010ac9e:	83 c4 10             	add    $0x10,%esp
+f010aca1:	39 05 00 96 61 f0    	cmp    %eax,0xf0619600
+f010aca7:	74 0f                	je     f010acb8 <lapic_init+0x5e>
+		lapicw(LINT0, MASKED);
+f010aca9:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010acae:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f010acb3:	e8 1d ff ff ff       	call   f010abd5 <lapicw>
+	lapicw(LINT1, MASKED);
+f010acb8:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010acbd:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f010acc2:	e8 0e ff ff ff       	call   f010abd5 <lapicw>
+	if (((lapic[VER]>>16) & 0xFF) >= 4)
+f010acc7:	a1 04 a0 65 f0       	mov    0xf065a004,%eax
+f010accc:	8b 40 30             	mov    0x30(%eax),%eax
+f010accf:	c1 e8 10             	shr    $0x10,%eax
+f010acd2:	a8 fc                	test   $0xfc,%al
+f010acd4:	75 7c                	jne    f010ad52 <lapic_init+0xf8>
+	lapicw(ERROR, IRQ_OFFSET + IRQ_ERROR);
+f010acd6:	ba 33 00 00 00       	mov    $0x33,%edx
+f010acdb:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f010ace0:	e8 f0 fe ff ff       	call   f010abd5 <lapicw>
+	lapicw(ESR, 0);
+f010ace5:	ba 00 00 00 00       	mov    $0x0,%edx
+f010acea:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f010acef:	e8 e1 fe ff ff       	call   f010abd5 <lapicw>
+	lapicw(ESR, 0);
+f010acf4:	ba 00 00 00 00       	mov    $0x0,%edx
+f010acf9:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f010acfe:	e8 d2 fe ff ff       	call   f010abd5 <lapicw>
+	lapicw(EOI, 0);
+f010ad03:	ba 00 00 00 00       	mov    $0x0,%edx
+f010ad08:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f010ad0d:	e8 c3 fe ff ff       	call   f010abd5 <lapicw>
+	lapicw(ICRHI, 0);
+f010ad12:	ba 00 00 00 00       	mov    $0x0,%edx
+f010ad17:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010ad1c:	e8 b4 fe ff ff       	call   f010abd5 <lapicw>
+	lapicw(ICRLO, BCAST | INIT | LEVEL);
+f010ad21:	ba 00 85 08 00       	mov    $0x88500,%edx
+f010ad26:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010ad2b:	e8 a5 fe ff ff       	call   f010abd5 <lapicw>
+	while(lapic[ICRLO] & DELIVS)
+f010ad30:	8b 15 04 a0 65 f0    	mov    0xf065a004,%edx
+f010ad36:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f010ad3c:	f6 c4 10             	test   $0x10,%ah
+f010ad3f:	75 f5                	jne    f010ad36 <lapic_init+0xdc>
+	lapicw(TPR, 0);
+f010ad41:	ba 00 00 00 00       	mov    $0x0,%edx
+f010ad46:	b8 20 00 00 00       	mov    $0x20,%eax
+f010ad4b:	e8 85 fe ff ff       	call   f010abd5 <lapicw>
+}
+f010ad50:	c9                   	leave
+f010ad51:	c3                   	ret
+		lapicw(PCINT, MASKED);
+f010ad52:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010ad57:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f010ad5c:	e8 74 fe ff ff       	call   f010abd5 <lapicw>
+f010ad61:	e9 70 ff ff ff       	jmp    f010acd6 <lapic_init+0x7c>
+
+f010ad66 <lapic_eoi>:
+
+// Acknowledge interrupt.
+void
+lapic_eoi(void)
+{
+	if (lapic)
+f010ad66:	83 3d 04 a0 65 f0 00 	cmpl   $0x0,0xf065a004
+f010ad6d:	74 17                	je     f010ad86 <lapic_eoi+0x20>
+{
+f010ad6f:	55                   	push   %ebp
+f010ad70:	89 e5                	mov    %esp,%ebp
+f010ad72:	83 ec 08             	sub    $0x8,%esp
+		lapicw(EOI, 0);
+f010ad75:	ba 00 00 00 00       	mov    $0x0,%edx
+f010ad7a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f010ad7f:	e8 51 fe ff ff       	call   f010abd5 <lapicw>
+}
+f010ad84:	c9                   	leave
+f010ad85:	c3                   	ret
+f010ad86:	c3                   	ret
+
+f010ad87 <lapic_startap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapic_startap(uint8_t apicid, uint32_t addr)
+{
+f010ad87:	55                   	push   %ebp
+f010ad88:	89 e5                	mov    %esp,%ebp
+f010ad8a:	56                   	push   %esi
+f010ad8b:	53                   	push   %ebx
+f010ad8c:	8b 75 08             	mov    0x8(%ebp),%esi
+f010ad8f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010ad92:	b8 0f 00 00 00       	mov    $0xf,%eax
+f010ad97:	ba 70 00 00 00       	mov    $0x70,%edx
+f010ad9c:	ee                   	out    %al,(%dx)
+f010ad9d:	b8 0a 00 00 00       	mov    $0xa,%eax
+f010ada2:	ba 71 00 00 00       	mov    $0x71,%edx
+f010ada7:	ee                   	out    %al,(%dx)
+	if (PGNUM(pa) >= npages_lowmem)
+f010ada8:	83 3d 6c 89 61 f0 00 	cmpl   $0x0,0xf061896c
+f010adaf:	74 7e                	je     f010ae2f <lapic_startap+0xa8>
+	// and the warm reset vector (DWORD based at 40:67) to point at
+	// the AP startup code prior to the [universal startup algorithm]."
+	outb(IO_RTC, 0xF);  // offset 0xF is shutdown code
+	outb(IO_RTC+1, 0x0A);
+	wrv = (uint16_t *)KADDR((0x40 << 4 | 0x67));  // Warm reset vector
+	wrv[0] = 0;
+f010adb1:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f010adb8:	00 00 
+	wrv[1] = addr >> 4;
+f010adba:	89 d8                	mov    %ebx,%eax
+f010adbc:	c1 e8 04             	shr    $0x4,%eax
+f010adbf:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+
+	// "Universal startup algorithm."
+	// Send INIT (level-triggered) interrupt to reset other CPU.
+	lapicw(ICRHI, apicid << 24);
+f010adc5:	c1 e6 18             	shl    $0x18,%esi
+f010adc8:	89 f2                	mov    %esi,%edx
+f010adca:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010adcf:	e8 01 fe ff ff       	call   f010abd5 <lapicw>
+	lapicw(ICRLO, INIT | LEVEL | ASSERT);
+f010add4:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f010add9:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010adde:	e8 f2 fd ff ff       	call   f010abd5 <lapicw>
+	microdelay(200);
+	lapicw(ICRLO, INIT | LEVEL);
+f010ade3:	ba 00 85 00 00       	mov    $0x8500,%edx
+f010ade8:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010aded:	e8 e3 fd ff ff       	call   f010abd5 <lapicw>
+	// when it is in the halted state due to an INIT.  So the second
+	// should be ignored, but it is part of the official Intel algorithm.
+	// Bochs complains about the second one.  Too bad for Bochs.
+	for (i = 0; i < 2; i++) {
+		lapicw(ICRHI, apicid << 24);
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f010adf2:	c1 eb 0c             	shr    $0xc,%ebx
+f010adf5:	80 cf 06             	or     $0x6,%bh
+		lapicw(ICRHI, apicid << 24);
+f010adf8:	89 f2                	mov    %esi,%edx
+f010adfa:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010adff:	e8 d1 fd ff ff       	call   f010abd5 <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f010ae04:	89 da                	mov    %ebx,%edx
+f010ae06:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010ae0b:	e8 c5 fd ff ff       	call   f010abd5 <lapicw>
+		lapicw(ICRHI, apicid << 24);
+f010ae10:	89 f2                	mov    %esi,%edx
+f010ae12:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010ae17:	e8 b9 fd ff ff       	call   f010abd5 <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f010ae1c:	89 da                	mov    %ebx,%edx
+f010ae1e:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010ae23:	e8 ad fd ff ff       	call   f010abd5 <lapicw>
+		microdelay(200);
+	}
+}
+f010ae28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010ae2b:	5b                   	pop    %ebx
+f010ae2c:	5e                   	pop    %esi
+f010ae2d:	5d                   	pop    %ebp
+f010ae2e:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010ae2f:	68 67 04 00 00       	push   $0x467
+f010ae34:	68 1c c0 10 f0       	push   $0xf010c01c
+f010ae39:	68 aa 00 00 00       	push   $0xaa
+f010ae3e:	68 94 e9 10 f0       	push   $0xf010e994
+f010ae43:	e8 50 52 ff ff       	call   f0100098 <_panic>
+
+f010ae48 <lapic_ipi>:
+
+void
+lapic_ipi(int vector)
+{
+f010ae48:	55                   	push   %ebp
+f010ae49:	89 e5                	mov    %esp,%ebp
+f010ae4b:	83 ec 08             	sub    $0x8,%esp
+	lapicw(ICRLO, OTHERS | FIXED | vector);
+f010ae4e:	8b 55 08             	mov    0x8(%ebp),%edx
+f010ae51:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f010ae57:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010ae5c:	e8 74 fd ff ff       	call   f010abd5 <lapicw>
+	while (lapic[ICRLO] & DELIVS)
+f010ae61:	8b 15 04 a0 65 f0    	mov    0xf065a004,%edx
+f010ae67:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f010ae6d:	f6 c4 10             	test   $0x10,%ah
+f010ae70:	75 f5                	jne    f010ae67 <lapic_ipi+0x1f>
+		;
+}
+f010ae72:	c9                   	leave
+f010ae73:	c3                   	ret
+
+f010ae74 <lapic_ipi_cpu>:
+
+// Send interrupt 'vector' to the CPU whose local APIC ID is 'apicid'.
+void
+lapic_ipi_cpu(uint8_t apicid, int vector)
+{
+f010ae74:	55                   	push   %ebp
+f010ae75:	89 e5                	mov    %esp,%ebp
+f010ae77:	83 ec 08             	sub    $0x8,%esp
+	lapicw(ICRHI, apicid << 24);
+f010ae7a:	0f b6 55 08          	movzbl 0x8(%ebp),%edx
+f010ae7e:	c1 e2 18             	shl    $0x18,%edx
+f010ae81:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010ae86:	e8 4a fd ff ff       	call   f010abd5 <lapicw>
+	lapicw(ICRLO, FIXED | vector);
+f010ae8b:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010ae8e:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010ae93:	e8 3d fd ff ff       	call   f010abd5 <lapicw>
+	while (lapic[ICRLO] & DELIVS)
+f010ae98:	8b 15 04 a0 65 f0    	mov    0xf065a004,%edx
+f010ae9e:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f010aea4:	f6 c4 10             	test   $0x10,%ah
+f010aea7:	75 f5                	jne    f010ae9e <lapic_ipi_cpu+0x2a>
+		;
+}
+f010aea9:	c9                   	leave
+f010aeaa:	c3                   	ret
+
+f010aeab <__spin_initlock>:
+}
+#endif
+
+void
+__spin_initlock(struct spinlock *lk, char *name)
+{
+f010aeab:	55                   	push   %ebp
+f010aeac:	89 e5                	mov    %esp,%ebp
+f010aeae:	53                   	push   %ebx
+f010aeaf:	83 ec 08             	sub    $0x8,%esp
+f010aeb2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	memset(lk, 0, sizeof(*lk));
+f010aeb5:	6a 60                	push   $0x60
+f010aeb7:	6a 00                	push   $0x0
+f010aeb9:	53                   	push   %ebx
+f010aeba:	e8 3f f7 ff ff       	call   f010a5fe <memset>
+	lk->name = name;
+f010aebf:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010aec2:	89 43 08             	mov    %eax,0x8(%ebx)
+}
+f010aec5:	83 c4 10             	add    $0x10,%esp
+f010aec8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010aecb:	c9                   	leave
+f010aecc:	c3                   	ret
+
+f010aecd <spin_lock_list>:
+// once.  The rest follow through their 'link' fields.
+struct spinlock *
+spin_lock_list(void)
+{
+	return spin_list;
+}
+f010aecd:	a1 44 89 61 f0       	mov    0xf0618944,%eax
+f010aed2:	c3                   	ret
+
+f010aed3 <spin_lock>:
+// Loops (spins) until the lock is acquired.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+spin_lock(struct spinlock *lk)
+{
+f010aed3:	55                   	push   %ebp
+f010aed4:	89 e5                	mov    %esp,%ebp
+f010aed6:	57                   	push   %edi
+f010aed7:	56                   	push   %esi
+f010aed8:	53                   	push   %ebx
+f010aed9:	83 ec 1c             	sub    $0x1c,%esp
+f010aedc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	return lock->owner != lock->next && lock->cpu == thiscpu;
+f010aedf:	8b 53 04             	mov    0x4(%ebx),%edx
+f010aee2:	8b 03                	mov    (%ebx),%eax
+f010aee4:	39 c2                	cmp    %eax,%edx
+f010aee6:	75 1a                	jne    f010af02 <spin_lock+0x2f>
+	asm volatile("lock; xaddl %0, %1" :
+f010aee8:	b9 01 00 00 00       	mov    $0x1,%ecx
+f010aeed:	f0 0f c1 0b          	lock xadd %ecx,(%ebx)
+	// Take a ticket and wait for our turn.  The xadd is atomic.
+	// It also serializes, so that reads after acquire are not
+	// reordered before it.  Waiters only read lk->owner, so they
+	// don't fight over the cache line while they wait.
+	ticket = xadd(&lk->next, 1);
+	if (lk->owner != ticket) {
+f010aef1:	8b 43 04             	mov    0x4(%ebx),%eax
+f010aef4:	39 c8                	cmp    %ecx,%eax
+f010aef6:	74 64                	je     f010af5c <spin_lock+0x89>
+	__asm __volatile("rdtsc" : "=A" (tsc));
+f010aef8:	0f 31                	rdtsc
+f010aefa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010aefd:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		start = read_tsc();
+		while (lk->owner != ticket)
+f010af00:	eb 37                	jmp    f010af39 <spin_lock+0x66>
+	return lock->owner != lock->next && lock->cpu == thiscpu;
+f010af02:	8b 73 34             	mov    0x34(%ebx),%esi
+f010af05:	e8 3a fd ff ff       	call   f010ac44 <cpunum>
+f010af0a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010af10:	05 20 90 61 f0       	add    $0xf0619020,%eax
+	if (holding(lk))
+f010af15:	39 c6                	cmp    %eax,%esi
+f010af17:	75 cf                	jne    f010aee8 <spin_lock+0x15>
+		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
+f010af19:	8b 5b 08             	mov    0x8(%ebx),%ebx
+f010af1c:	e8 23 fd ff ff       	call   f010ac44 <cpunum>
+f010af21:	83 ec 0c             	sub    $0xc,%esp
+f010af24:	53                   	push   %ebx
+f010af25:	50                   	push   %eax
+f010af26:	68 a4 e9 10 f0       	push   $0xf010e9a4
+f010af2b:	6a 5c                	push   $0x5c
+f010af2d:	68 06 ea 10 f0       	push   $0xf010ea06
+f010af32:	e8 61 51 ff ff       	call   f0100098 <_panic>
+			asm volatile ("pause");
+f010af37:	f3 90                	pause
+		while (lk->owner != ticket)
+f010af39:	8b 43 04             	mov    0x4(%ebx),%eax
+f010af3c:	39 c8                	cmp    %ecx,%eax
+f010af3e:	75 f7                	jne    f010af37 <spin_lock+0x64>
+		lk->contended++;
+f010af40:	83 43 10 01          	addl   $0x1,0x10(%ebx)
+f010af44:	0f 31                	rdtsc
+		lk->spin_cycles += read_tsc() - start;
+f010af46:	8b 73 14             	mov    0x14(%ebx),%esi
+f010af49:	8b 7b 18             	mov    0x18(%ebx),%edi
+f010af4c:	2b 75 e0             	sub    -0x20(%ebp),%esi
+f010af4f:	1b 7d e4             	sbb    -0x1c(%ebp),%edi
+f010af52:	01 f0                	add    %esi,%eax
+f010af54:	11 fa                	adc    %edi,%edx
+f010af56:	89 43 14             	mov    %eax,0x14(%ebx)
+f010af59:	89 53 18             	mov    %edx,0x18(%ebx)
+	}
+	asm volatile("" ::: "memory");
+
+	lk->acquires++;
+f010af5c:	83 43 0c 01          	addl   $0x1,0xc(%ebx)
+	asm volatile("lock; xchgl %0, %1" :
+f010af60:	ba 01 00 00 00       	mov    $0x1,%edx
+	if (!lk->listed)
+f010af65:	80 7b 30 00          	cmpb   $0x0,0x30(%ebx)
+f010af69:	74 3f                	je     f010afaa <spin_lock+0xd7>
+	__asm __volatile("rdtsc" : "=A" (tsc));
+f010af6b:	0f 31                	rdtsc
+		spin_list_add(lk);
+	lk->hold_start = read_tsc();
+f010af6d:	89 43 24             	mov    %eax,0x24(%ebx)
+f010af70:	89 53 28             	mov    %edx,0x28(%ebx)
+
+	// Record info about lock acquisition for debugging.
+#ifdef DEBUG_SPINLOCK
+	lk->cpu = thiscpu;
+f010af73:	e8 cc fc ff ff       	call   f010ac44 <cpunum>
+f010af78:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010af7e:	05 20 90 61 f0       	add    $0xf0619020,%eax
+f010af83:	89 43 34             	mov    %eax,0x34(%ebx)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+f010af86:	89 ea                	mov    %ebp,%edx
+	for (i = 0; i < 10; i++){
+f010af88:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (ebp == 0 || ebp < (uint32_t *)ULIM)
+f010af8d:	83 f8 09             	cmp    $0x9,%eax
+f010af90:	7f 50                	jg     f010afe2 <spin_lock+0x10f>
+f010af92:	81 fa ff ff 7f ef    	cmp    $0xef7fffff,%edx
+f010af98:	76 48                	jbe    f010afe2 <spin_lock+0x10f>
+		pcs[i] = ebp[1];          // saved %eip
+f010af9a:	8b 4a 04             	mov    0x4(%edx),%ecx
+f010af9d:	89 4c 83 38          	mov    %ecx,0x38(%ebx,%eax,4)
+		ebp = (uint32_t *)ebp[0]; // saved %ebp
+f010afa1:	8b 12                	mov    (%edx),%edx
+	for (i = 0; i < 10; i++){
+f010afa3:	83 c0 01             	add    $0x1,%eax
+f010afa6:	eb e5                	jmp    f010af8d <spin_lock+0xba>
+		asm volatile ("pause");
+f010afa8:	f3 90                	pause
+	asm volatile("lock; xchgl %0, %1" :
+f010afaa:	89 d0                	mov    %edx,%eax
+f010afac:	f0 87 05 40 89 61 f0 	lock xchg %eax,0xf0618940
+	while (xchg(&spin_list_lock, 1) != 0)
+f010afb3:	85 c0                	test   %eax,%eax
+f010afb5:	75 f1                	jne    f010afa8 <spin_lock+0xd5>
+	lk->link = spin_list;
+f010afb7:	a1 44 89 61 f0       	mov    0xf0618944,%eax
+f010afbc:	89 43 2c             	mov    %eax,0x2c(%ebx)
+	spin_list = lk;
+f010afbf:	89 1d 44 89 61 f0    	mov    %ebx,0xf0618944
+	lk->listed = 1;
+f010afc5:	c6 43 30 01          	movb   $0x1,0x30(%ebx)
+f010afc9:	b8 00 00 00 00       	mov    $0x0,%eax
+f010afce:	f0 87 05 40 89 61 f0 	lock xchg %eax,0xf0618940
+}
+f010afd5:	eb 94                	jmp    f010af6b <spin_lock+0x98>
+		pcs[i] = 0;
+f010afd7:	c7 44 83 38 00 00 00 	movl   $0x0,0x38(%ebx,%eax,4)
+f010afde:	00 
+	for (; i < 10; i++)
+f010afdf:	83 c0 01             	add    $0x1,%eax
+f010afe2:	83 f8 09             	cmp    $0x9,%eax
+f010afe5:	7e f0                	jle    f010afd7 <spin_lock+0x104>
+	get_caller_pcs(lk->pcs);
+#endif
+}
+f010afe7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010afea:	5b                   	pop    %ebx
+f010afeb:	5e                   	pop    %esi
+f010afec:	5f                   	pop    %edi
+f010afed:	5d                   	pop    %ebp
+f010afee:	c3                   	ret
+
+f010afef <spin_unlock>:
+
+// Release the lock.
+void
+spin_unlock(struct spinlock *lk)
+{
+f010afef:	55                   	push   %ebp
+f010aff0:	89 e5                	mov    %esp,%ebp
+f010aff2:	57                   	push   %edi
+f010aff3:	56                   	push   %esi
+f010aff4:	53                   	push   %ebx
+f010aff5:	83 ec 5c             	sub    $0x5c,%esp
+f010aff8:	8b 75 08             	mov    0x8(%ebp),%esi
+	return lock->owner != lock->next && lock->cpu == thiscpu;
+f010affb:	8b 56 04             	mov    0x4(%esi),%edx
+f010affe:	8b 06                	mov    (%esi),%eax
+f010b000:	39 c2                	cmp    %eax,%edx
+f010b002:	75 38                	jne    f010b03c <spin_unlock+0x4d>
+#ifdef DEBUG_SPINLOCK
+	if (!holding(lk)) {
+		int i;
+		uint32_t pcs[10];
+		// Nab the acquiring EIP chain before it gets released
+		memmove(pcs, lk->pcs, sizeof pcs);
+f010b004:	83 ec 04             	sub    $0x4,%esp
+f010b007:	6a 28                	push   $0x28
+f010b009:	8d 46 38             	lea    0x38(%esi),%eax
+f010b00c:	50                   	push   %eax
+f010b00d:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+f010b010:	53                   	push   %ebx
+f010b011:	e8 1d f6 ff ff       	call   f010a633 <memmove>
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:", 
+			cpunum(), lk->name, lk->cpu->cpu_id);
+f010b016:	8b 46 34             	mov    0x34(%esi),%eax
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:", 
+f010b019:	0f b6 38             	movzbl (%eax),%edi
+f010b01c:	8b 76 08             	mov    0x8(%esi),%esi
+f010b01f:	e8 20 fc ff ff       	call   f010ac44 <cpunum>
+f010b024:	57                   	push   %edi
+f010b025:	56                   	push   %esi
+f010b026:	50                   	push   %eax
+f010b027:	68 d0 e9 10 f0       	push   $0xf010e9d0
+f010b02c:	e8 cb bf ff ff       	call   f0106ffc <cprintf>
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f010b031:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f010b034:	83 c4 20             	add    $0x20,%esp
+			struct Eipdebuginfo info;
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f010b037:	8d 75 a8             	lea    -0x58(%ebp),%esi
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f010b03a:	eb 66                	jmp    f010b0a2 <spin_unlock+0xb3>
+	return lock->owner != lock->next && lock->cpu == thiscpu;
+f010b03c:	8b 5e 34             	mov    0x34(%esi),%ebx
+f010b03f:	e8 00 fc ff ff       	call   f010ac44 <cpunum>
+f010b044:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+f010b04a:	05 20 90 61 f0       	add    $0xf0619020,%eax
+	if (!holding(lk)) {
+f010b04f:	39 c3                	cmp    %eax,%ebx
+f010b051:	75 b1                	jne    f010b004 <spin_unlock+0x15>
+				cprintf("  %08x\n", pcs[i]);
+		}
+		panic("spin_unlock");
+	}
+
+	lk->pcs[0] = 0;
+f010b053:	c7 46 38 00 00 00 00 	movl   $0x0,0x38(%esi)
+	lk->cpu = 0;
+f010b05a:	c7 46 34 00 00 00 00 	movl   $0x0,0x34(%esi)
+	__asm __volatile("rdtsc" : "=A" (tsc));
+f010b061:	0f 31                	rdtsc
+#endif
+
+	hold = read_tsc() - lk->hold_start;
+f010b063:	2b 46 24             	sub    0x24(%esi),%eax
+f010b066:	1b 56 28             	sbb    0x28(%esi),%edx
+	if (hold > lk->max_hold)
+f010b069:	8b 4e 20             	mov    0x20(%esi),%ecx
+f010b06c:	39 46 1c             	cmp    %eax,0x1c(%esi)
+f010b06f:	19 d1                	sbb    %edx,%ecx
+f010b071:	73 06                	jae    f010b079 <spin_unlock+0x8a>
+		lk->max_hold = hold;
+f010b073:	89 46 1c             	mov    %eax,0x1c(%esi)
+f010b076:	89 56 20             	mov    %edx,0x20(%esi)
+	// Architecture Memory Ordering White Paper says that Intel 64
+	// and IA-32 will not move a load after a store, and the
+	// compiler barrier keeps gcc from moving the critical section
+	// past it.
+	asm volatile("" ::: "memory");
+	lk->owner++;
+f010b079:	8b 46 04             	mov    0x4(%esi),%eax
+f010b07c:	83 c0 01             	add    $0x1,%eax
+f010b07f:	89 46 04             	mov    %eax,0x4(%esi)
+}
+f010b082:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b085:	5b                   	pop    %ebx
+f010b086:	5e                   	pop    %esi
+f010b087:	5f                   	pop    %edi
+f010b088:	5d                   	pop    %ebp
+f010b089:	c3                   	ret
+				cprintf("  %08x\n", pcs[i]);
+f010b08a:	83 ec 08             	sub    $0x8,%esp
+f010b08d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010b090:	ff 30                	push   (%eax)
+f010b092:	68 2d ea 10 f0       	push   $0xf010ea2d
+f010b097:	e8 60 bf ff ff       	call   f0106ffc <cprintf>
+f010b09c:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f010b09f:	83 c3 04             	add    $0x4,%ebx
+f010b0a2:	39 fb                	cmp    %edi,%ebx
+f010b0a4:	74 44                	je     f010b0ea <spin_unlock+0xfb>
+f010b0a6:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+f010b0a9:	8b 03                	mov    (%ebx),%eax
+f010b0ab:	85 c0                	test   %eax,%eax
+f010b0ad:	74 3b                	je     f010b0ea <spin_unlock+0xfb>
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f010b0af:	83 ec 08             	sub    $0x8,%esp
+f010b0b2:	56                   	push   %esi
+f010b0b3:	50                   	push   %eax
+f010b0b4:	e8 65 ea ff ff       	call   f0109b1e <debuginfo_eip>
+f010b0b9:	83 c4 10             	add    $0x10,%esp
+f010b0bc:	85 c0                	test   %eax,%eax
+f010b0be:	78 ca                	js     f010b08a <spin_unlock+0x9b>
+					pcs[i] - info.eip_fn_addr);
+f010b0c0:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010b0c3:	8b 00                	mov    (%eax),%eax
+				cprintf("  %08x %s:%d: %.*s+%x\n", pcs[i],
+f010b0c5:	83 ec 04             	sub    $0x4,%esp
+f010b0c8:	89 c2                	mov    %eax,%edx
+f010b0ca:	2b 55 b8             	sub    -0x48(%ebp),%edx
+f010b0cd:	52                   	push   %edx
+f010b0ce:	ff 75 b0             	push   -0x50(%ebp)
+f010b0d1:	ff 75 b4             	push   -0x4c(%ebp)
+f010b0d4:	ff 75 ac             	push   -0x54(%ebp)
+f010b0d7:	ff 75 a8             	push   -0x58(%ebp)
+f010b0da:	50                   	push   %eax
+f010b0db:	68 16 ea 10 f0       	push   $0xf010ea16
+f010b0e0:	e8 17 bf ff ff       	call   f0106ffc <cprintf>
+f010b0e5:	83 c4 20             	add    $0x20,%esp
+f010b0e8:	eb b5                	jmp    f010b09f <spin_unlock+0xb0>
+		panic("spin_unlock");
+f010b0ea:	83 ec 04             	sub    $0x4,%esp
+f010b0ed:	68 35 ea 10 f0       	push   $0xf010ea35
+f010b0f2:	68 91 00 00 00       	push   $0x91
+f010b0f7:	68 06 ea 10 f0       	push   $0xf010ea06
+f010b0fc:	e8 97 4f ff ff       	call   f0100098 <_panic>
+
+f010b101 <e1000_alloc>:
+
+// Allocate a zeroed, physically contiguous block of at least 'size'
+// bytes, or return NULL.
+static void *
+e1000_alloc(size_t size)
+{
+f010b101:	55                   	push   %ebp
+f010b102:	89 e5                	mov    %esp,%ebp
+f010b104:	53                   	push   %ebx
+f010b105:	83 ec 04             	sub    $0x4,%esp
+	int order = 0;
+f010b108:	b9 00 00 00 00       	mov    $0x0,%ecx
+	while ((PGSIZE << order) < size)
+f010b10d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+f010b112:	eb 03                	jmp    f010b117 <e1000_alloc+0x16>
+		order++;
+f010b114:	83 c1 01             	add    $0x1,%ecx
+	while ((PGSIZE << order) < size)
+f010b117:	89 da                	mov    %ebx,%edx
+f010b119:	d3 e2                	shl    %cl,%edx
+f010b11b:	39 c2                	cmp    %eax,%edx
+f010b11d:	72 f5                	jb     f010b114 <e1000_alloc+0x13>
+	struct PageInfo *pp;
+
+	if (!(pp = page_alloc_order(size_order(size), ALLOC_ZERO)))
+f010b11f:	83 ec 08             	sub    $0x8,%esp
+f010b122:	6a 01                	push   $0x1
+f010b124:	51                   	push   %ecx
+f010b125:	e8 7d 72 ff ff       	call   f01023a7 <page_alloc_order>
+f010b12a:	83 c4 10             	add    $0x10,%esp
+f010b12d:	85 c0                	test   %eax,%eax
+f010b12f:	74 27                	je     f010b158 <e1000_alloc+0x57>
+	return (pp - pages) << PGSHIFT;
+f010b131:	2b 05 80 89 61 f0    	sub    0xf0618980,%eax
+f010b137:	c1 f8 02             	sar    $0x2,%eax
+f010b13a:	69 d0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%edx
+f010b140:	89 d0                	mov    %edx,%eax
+f010b142:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(pa) >= npages_lowmem)
+f010b145:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f010b14b:	3b 15 6c 89 61 f0    	cmp    0xf061896c,%edx
+f010b151:	73 0a                	jae    f010b15d <e1000_alloc+0x5c>
+	return (void *)(pa + KERNBASE);
+f010b153:	2d 00 00 00 10       	sub    $0x10000000,%eax
+		return NULL;
+	return page2kva(pp);
+}
+f010b158:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010b15b:	c9                   	leave
+f010b15c:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010b15d:	50                   	push   %eax
+f010b15e:	68 1c c0 10 f0       	push   $0xf010c01c
+f010b163:	6a 7d                	push   $0x7d
+f010b165:	68 f3 d7 10 f0       	push   $0xf010d7f3
+f010b16a:	e8 29 4f ff ff       	call   f0100098 <_panic>
+
+f010b16f <e1000_attach>:
+	return (value << mask_shift(mask)) & mask;
+}
+
+int
+e1000_attach(struct pci_func *pcif)
+{
+f010b16f:	55                   	push   %ebp
+f010b170:	89 e5                	mov    %esp,%ebp
+f010b172:	57                   	push   %edi
+f010b173:	56                   	push   %esi
+f010b174:	53                   	push   %ebx
+f010b175:	83 ec 2c             	sub    $0x2c,%esp
+f010b178:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int i;
+
+	static_assert(E1000_MAX_TDESC * sizeof(struct tx_desc) +
+		      E1000_MAX_RDESC * sizeof(struct rx_desc) <= PGSIZE);
+	if (!(tx_descs = e1000_alloc(PGSIZE)) ||
+f010b17b:	b8 00 10 00 00       	mov    $0x1000,%eax
+f010b180:	e8 7c ff ff ff       	call   f010b101 <e1000_alloc>
+f010b185:	a3 54 89 61 f0       	mov    %eax,0xf0618954
+f010b18a:	85 c0                	test   %eax,%eax
+f010b18c:	0f 84 ed 02 00 00    	je     f010b47f <e1000_attach+0x310>
+	    !(tx_pkts = e1000_alloc(E1000_MAX_TDESC * MAX_PACKET_SIZE)) ||
+f010b192:	b8 80 7b 01 00       	mov    $0x17b80,%eax
+f010b197:	e8 65 ff ff ff       	call   f010b101 <e1000_alloc>
+f010b19c:	a3 50 89 61 f0       	mov    %eax,0xf0618950
+	if (!(tx_descs = e1000_alloc(PGSIZE)) ||
+f010b1a1:	85 c0                	test   %eax,%eax
+f010b1a3:	0f 84 dd 02 00 00    	je     f010b486 <e1000_attach+0x317>
+	    !(rx_pkts = e1000_alloc(E1000_MAX_RDESC * MAX_BUFFER_SIZE)))
+f010b1a9:	b8 00 00 04 00       	mov    $0x40000,%eax
+f010b1ae:	e8 4e ff ff ff       	call   f010b101 <e1000_alloc>
+f010b1b3:	a3 48 89 61 f0       	mov    %eax,0xf0618948
+	    !(tx_pkts = e1000_alloc(E1000_MAX_TDESC * MAX_PACKET_SIZE)) ||
+f010b1b8:	85 c0                	test   %eax,%eax
+f010b1ba:	0f 84 cd 02 00 00    	je     f010b48d <e1000_attach+0x31e>
+		return -E_NO_MEM;
+	rx_descs = (struct rx_desc *) (tx_descs + E1000_MAX_TDESC);
+f010b1c0:	a1 54 89 61 f0       	mov    0xf0618954,%eax
+f010b1c5:	05 00 04 00 00       	add    $0x400,%eax
+f010b1ca:	a3 4c 89 61 f0       	mov    %eax,0xf061894c
+
+        // Enable e1000 PCI device
+	pci_func_enable(pcif);
+f010b1cf:	83 ec 0c             	sub    $0xc,%esp
+f010b1d2:	53                   	push   %ebx
+f010b1d3:	e8 d7 07 00 00       	call   f010b9af <pci_func_enable>
+
+        // Map e1000 registers to MMIO region
+	e1000 = mmio_map_region(pcif->reg_base[0], pcif->reg_size[0]);
+f010b1d8:	83 c4 08             	add    $0x8,%esp
+f010b1db:	ff 73 2c             	push   0x2c(%ebx)
+f010b1de:	ff 73 14             	push   0x14(%ebx)
+f010b1e1:	e8 c8 7f ff ff       	call   f01031ae <mmio_map_region>
+f010b1e6:	89 c3                	mov    %eax,%ebx
+f010b1e8:	a3 08 a0 65 f0       	mov    %eax,0xf065a008
+
+        // Transmit initialization
+	assert((uintptr_t) tx_descs % 16 == 0);
+f010b1ed:	8b 0d 54 89 61 f0    	mov    0xf0618954,%ecx
+f010b1f3:	83 c4 10             	add    $0x10,%esp
+f010b1f6:	f6 c1 0f             	test   $0xf,%cl
+f010b1f9:	75 62                	jne    f010b25d <e1000_attach+0xee>
+f010b1fb:	a1 50 89 61 f0       	mov    0xf0618950,%eax
+f010b200:	05 00 00 00 10       	add    $0x10000000,%eax
+f010b205:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b20a:	8d 79 0c             	lea    0xc(%ecx),%edi
+f010b20d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+f010b210:	89 c6                	mov    %eax,%esi
+f010b212:	89 d7                	mov    %edx,%edi
+f010b214:	81 c6 80 7b 01 00    	add    $0x17b80,%esi
+f010b21a:	83 d7 00             	adc    $0x0,%edi
+f010b21d:	89 75 e0             	mov    %esi,-0x20(%ebp)
+f010b220:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f010b223:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+f010b226:	89 df                	mov    %ebx,%edi
+f010b228:	8b 75 dc             	mov    -0x24(%ebp),%esi
+	for (i = 0; i < E1000_MAX_TDESC; i++) {
+f010b22b:	89 c1                	mov    %eax,%ecx
+f010b22d:	89 d3                	mov    %edx,%ebx
+f010b22f:	33 4d e0             	xor    -0x20(%ebp),%ecx
+f010b232:	33 5d e4             	xor    -0x1c(%ebp),%ebx
+f010b235:	09 d9                	or     %ebx,%ecx
+f010b237:	74 52                	je     f010b28b <e1000_attach+0x11c>
+		tx_descs[i].addr = PADDR(tx_pkts[i]);
+f010b239:	8d 88 00 00 00 f0    	lea    -0x10000000(%eax),%ecx
+	if ((uint32_t)kva < KERNBASE)
+f010b23f:	81 f9 ff ff ff ef    	cmp    $0xefffffff,%ecx
+f010b245:	76 2f                	jbe    f010b276 <e1000_attach+0x107>
+f010b247:	89 46 f4             	mov    %eax,-0xc(%esi)
+f010b24a:	89 56 f8             	mov    %edx,-0x8(%esi)
+		tx_descs[i].status |= E1000_TXD_STAT_DD;
+f010b24d:	80 0e 01             	orb    $0x1,(%esi)
+	for (i = 0; i < E1000_MAX_TDESC; i++) {
+f010b250:	05 ee 05 00 00       	add    $0x5ee,%eax
+f010b255:	83 d2 00             	adc    $0x0,%edx
+f010b258:	83 c6 10             	add    $0x10,%esi
+f010b25b:	eb ce                	jmp    f010b22b <e1000_attach+0xbc>
+	assert((uintptr_t) tx_descs % 16 == 0);
+f010b25d:	68 50 ea 10 f0       	push   $0xf010ea50
+f010b262:	68 0d d8 10 f0       	push   $0xf010d80d
+f010b267:	68 0a 01 00 00       	push   $0x10a
+f010b26c:	68 0c eb 10 f0       	push   $0xf010eb0c
+f010b271:	e8 22 4e ff ff       	call   f0100098 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010b276:	51                   	push   %ecx
+f010b277:	68 e8 cc 10 f0       	push   $0xf010cce8
+f010b27c:	68 0c 01 00 00       	push   $0x10c
+f010b281:	68 0c eb 10 f0       	push   $0xf010eb0c
+f010b286:	e8 0d 4e ff ff       	call   f0100098 <_panic>
+	if ((uint32_t)kva < KERNBASE)
+f010b28b:	89 fb                	mov    %edi,%ebx
+f010b28d:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f010b290:	81 f9 ff ff ff ef    	cmp    $0xefffffff,%ecx
+f010b296:	76 3b                	jbe    f010b2d3 <e1000_attach+0x164>
+	return (physaddr_t)kva - KERNBASE;
+f010b298:	8d b9 00 00 00 10    	lea    0x10000000(%ecx),%edi
+	e1000[offset / sizeof(uint32_t)] = value;
+f010b29e:	89 bb 00 38 00 00    	mov    %edi,0x3800(%ebx)
+f010b2a4:	c7 83 08 38 00 00 00 	movl   $0x400,0x3808(%ebx)
+f010b2ab:	04 00 00 
+	return e1000[offset / sizeof(uint32_t)];
+f010b2ae:	8b 83 08 38 00 00    	mov    0x3808(%ebx),%eax
+	}
+	e1000_write_reg(E1000_TDBAL, PADDR(tx_descs));
+	e1000_write_reg(E1000_TDLEN, E1000_MAX_TDESC * sizeof(struct tx_desc));
+	assert(e1000_read_reg(E1000_TDLEN) % 128 == 0);
+f010b2b4:	a8 7f                	test   $0x7f,%al
+f010b2b6:	75 30                	jne    f010b2e8 <e1000_attach+0x179>
+	e1000[offset / sizeof(uint32_t)] = value;
+f010b2b8:	c7 83 10 38 00 00 00 	movl   $0x0,0x3810(%ebx)
+f010b2bf:	00 00 00 
+f010b2c2:	c7 83 18 38 00 00 00 	movl   $0x0,0x3818(%ebx)
+f010b2c9:	00 00 00 
+	for (i = 0; !(mask & 0x1); i++) {
+f010b2cc:	b8 00 00 00 00       	mov    $0x0,%eax
+f010b2d1:	eb 31                	jmp    f010b304 <e1000_attach+0x195>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010b2d3:	51                   	push   %ecx
+f010b2d4:	68 e8 cc 10 f0       	push   $0xf010cce8
+f010b2d9:	68 0f 01 00 00       	push   $0x10f
+f010b2de:	68 0c eb 10 f0       	push   $0xf010eb0c
+f010b2e3:	e8 b0 4d ff ff       	call   f0100098 <_panic>
+	assert(e1000_read_reg(E1000_TDLEN) % 128 == 0);
+f010b2e8:	68 70 ea 10 f0       	push   $0xf010ea70
+f010b2ed:	68 0d d8 10 f0       	push   $0xf010d80d
+f010b2f2:	68 11 01 00 00       	push   $0x111
+f010b2f7:	68 0c eb 10 f0       	push   $0xf010eb0c
+f010b2fc:	e8 97 4d ff ff       	call   f0100098 <_panic>
+	for (i = 0; !(mask & 0x1); i++) {
+f010b301:	83 c0 01             	add    $0x1,%eax
+f010b304:	83 f8 0c             	cmp    $0xc,%eax
+f010b307:	75 f8                	jne    f010b301 <e1000_attach+0x192>
+	e1000[offset / sizeof(uint32_t)] = value;
+f010b309:	c7 83 00 04 00 00 0a 	movl   $0x4010a,0x400(%ebx)
+f010b310:	01 04 00 
+	for (i = 0; !(mask & 0x1); i++) {
+f010b313:	b8 00 00 00 00       	mov    $0x0,%eax
+f010b318:	eb 03                	jmp    f010b31d <e1000_attach+0x1ae>
+f010b31a:	83 c0 01             	add    $0x1,%eax
+f010b31d:	83 f8 0a             	cmp    $0xa,%eax
+f010b320:	75 f8                	jne    f010b31a <e1000_attach+0x1ab>
+f010b322:	b8 00 00 00 00       	mov    $0x0,%eax
+f010b327:	eb 03                	jmp    f010b32c <e1000_attach+0x1bd>
+f010b329:	83 c0 01             	add    $0x1,%eax
+f010b32c:	83 f8 14             	cmp    $0x14,%eax
+f010b32f:	75 f8                	jne    f010b329 <e1000_attach+0x1ba>
+	e1000[offset / sizeof(uint32_t)] = value;
+f010b331:	c7 83 10 04 00 00 0a 	movl   $0x60200a,0x410(%ebx)
+f010b338:	20 60 00 
+        e1000_write_reg(E1000_TIPG, masked_value(E1000_TIPG_IPGT, 10) |
+			masked_value(E1000_TIPG_IPGR1, 8) |
+			masked_value(E1000_TIPG_IPGR2, 6));
+
+        // Receive initialization
+	assert((uintptr_t) rx_descs % 16 == 0);
+f010b33b:	8b 0d 4c 89 61 f0    	mov    0xf061894c,%ecx
+f010b341:	f6 c1 0f             	test   $0xf,%cl
+f010b344:	75 5c                	jne    f010b3a2 <e1000_attach+0x233>
+f010b346:	a1 48 89 61 f0       	mov    0xf0618948,%eax
+f010b34b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010b34e:	05 00 00 00 10       	add    $0x10000000,%eax
+f010b353:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b358:	89 c6                	mov    %eax,%esi
+f010b35a:	89 d7                	mov    %edx,%edi
+f010b35c:	81 c6 00 00 04 00    	add    $0x40000,%esi
+f010b362:	83 d7 00             	adc    $0x0,%edi
+f010b365:	89 75 e0             	mov    %esi,-0x20(%ebp)
+f010b368:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f010b36b:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+f010b36e:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+f010b371:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+	for (i = 0; i < E1000_MAX_RDESC; i++)
+f010b374:	89 c6                	mov    %eax,%esi
+f010b376:	89 d7                	mov    %edx,%edi
+f010b378:	33 75 e0             	xor    -0x20(%ebp),%esi
+f010b37b:	33 7d e4             	xor    -0x1c(%ebp),%edi
+f010b37e:	09 fe                	or     %edi,%esi
+f010b380:	74 4e                	je     f010b3d0 <e1000_attach+0x261>
+	if ((uint32_t)kva < KERNBASE)
+f010b382:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f010b388:	76 31                	jbe    f010b3bb <e1000_attach+0x24c>
+		rx_descs[i].addr = PADDR(rx_pkts[i]);
+f010b38a:	89 01                	mov    %eax,(%ecx)
+f010b38c:	89 51 04             	mov    %edx,0x4(%ecx)
+	for (i = 0; i < E1000_MAX_RDESC; i++)
+f010b38f:	05 00 08 00 00       	add    $0x800,%eax
+f010b394:	83 d2 00             	adc    $0x0,%edx
+f010b397:	83 c1 10             	add    $0x10,%ecx
+f010b39a:	81 c3 00 08 00 00    	add    $0x800,%ebx
+f010b3a0:	eb d2                	jmp    f010b374 <e1000_attach+0x205>
+	assert((uintptr_t) rx_descs % 16 == 0);
+f010b3a2:	68 98 ea 10 f0       	push   $0xf010ea98
+f010b3a7:	68 0d d8 10 f0       	push   $0xf010d80d
+f010b3ac:	68 1c 01 00 00       	push   $0x11c
+f010b3b1:	68 0c eb 10 f0       	push   $0xf010eb0c
+f010b3b6:	e8 dd 4c ff ff       	call   f0100098 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010b3bb:	53                   	push   %ebx
+f010b3bc:	68 e8 cc 10 f0       	push   $0xf010cce8
+f010b3c1:	68 1e 01 00 00       	push   $0x11e
+f010b3c6:	68 0c eb 10 f0       	push   $0xf010eb0c
+f010b3cb:	e8 c8 4c ff ff       	call   f0100098 <_panic>
+	e1000[offset / sizeof(uint32_t)] = value;
+f010b3d0:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f010b3d3:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f010b3d6:	c7 83 00 54 00 00 52 	movl   $0x12005452,0x5400(%ebx)
+f010b3dd:	54 00 12 
+f010b3e0:	c7 83 04 54 00 00 34 	movl   $0x80005634,0x5404(%ebx)
+f010b3e7:	56 00 80 
+f010b3ea:	c7 83 00 52 00 00 00 	movl   $0x0,0x5200(%ebx)
+f010b3f1:	00 00 00 
+f010b3f4:	c7 83 d0 00 00 00 00 	movl   $0x0,0xd0(%ebx)
+f010b3fb:	00 00 00 
+	if ((uint32_t)kva < KERNBASE)
+f010b3fe:	81 f9 ff ff ff ef    	cmp    $0xefffffff,%ecx
+f010b404:	76 4b                	jbe    f010b451 <e1000_attach+0x2e2>
+	return (physaddr_t)kva - KERNBASE;
+f010b406:	81 c1 00 00 00 10    	add    $0x10000000,%ecx
+f010b40c:	89 8b 00 28 00 00    	mov    %ecx,0x2800(%ebx)
+f010b412:	c7 83 08 28 00 00 00 	movl   $0x800,0x2808(%ebx)
+f010b419:	08 00 00 
+	return e1000[offset / sizeof(uint32_t)];
+f010b41c:	8b 83 08 28 00 00    	mov    0x2808(%ebx),%eax
+	e1000_write_reg(E1000_RAH, 0x5634 | E1000_RAH_AV);
+	e1000_write_reg(E1000_MTA, 0);
+	e1000_write_reg(E1000_IMS, 0);
+	e1000_write_reg(E1000_RDBAL, PADDR(rx_descs));
+	e1000_write_reg(E1000_RDLEN, E1000_MAX_RDESC * sizeof(struct rx_desc));
+	assert(e1000_read_reg(E1000_RDLEN) % 128 == 0);
+f010b422:	a8 7f                	test   $0x7f,%al
+f010b424:	75 40                	jne    f010b466 <e1000_attach+0x2f7>
+	e1000[offset / sizeof(uint32_t)] = value;
+f010b426:	c7 83 10 28 00 00 00 	movl   $0x0,0x2810(%ebx)
+f010b42d:	00 00 00 
+f010b430:	c7 83 18 28 00 00 7f 	movl   $0x7f,0x2818(%ebx)
+f010b437:	00 00 00 
+f010b43a:	c7 83 00 01 00 00 02 	movl   $0x4008002,0x100(%ebx)
+f010b441:	80 00 04 
+	e1000_write_reg(E1000_RDH, 0);
+	e1000_write_reg(E1000_RDT, E1000_MAX_RDESC - 1);
+	e1000_write_reg(E1000_RCTL, E1000_RCTL_EN | E1000_RCTL_BAM | E1000_RCTL_SECRC);
+	return 0;
+f010b444:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010b449:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b44c:	5b                   	pop    %ebx
+f010b44d:	5e                   	pop    %esi
+f010b44e:	5f                   	pop    %edi
+f010b44f:	5d                   	pop    %ebp
+f010b450:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010b451:	51                   	push   %ecx
+f010b452:	68 e8 cc 10 f0       	push   $0xf010cce8
+f010b457:	68 23 01 00 00       	push   $0x123
+f010b45c:	68 0c eb 10 f0       	push   $0xf010eb0c
+f010b461:	e8 32 4c ff ff       	call   f0100098 <_panic>
+	assert(e1000_read_reg(E1000_RDLEN) % 128 == 0);
+f010b466:	68 b8 ea 10 f0       	push   $0xf010eab8
+f010b46b:	68 0d d8 10 f0       	push   $0xf010d80d
+f010b470:	68 25 01 00 00       	push   $0x125
+f010b475:	68 0c eb 10 f0       	push   $0xf010eb0c
+f010b47a:	e8 19 4c ff ff       	call   f0100098 <_panic>
+		return -E_NO_MEM;
+f010b47f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010b484:	eb c3                	jmp    f010b449 <e1000_attach+0x2da>
+f010b486:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010b48b:	eb bc                	jmp    f010b449 <e1000_attach+0x2da>
+f010b48d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010b492:	eb b5                	jmp    f010b449 <e1000_attach+0x2da>
+
+f010b494 <e1000_transmit>:
+
+int
+e1000_transmit(void *data, size_t size)
+{
+f010b494:	55                   	push   %ebp
+f010b495:	89 e5                	mov    %esp,%ebp
+f010b497:	57                   	push   %edi
+f010b498:	56                   	push   %esi
+f010b499:	53                   	push   %ebx
+f010b49a:	83 ec 0c             	sub    $0xc,%esp
+f010b49d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t tdt;
+
+	if (size > MAX_PACKET_SIZE)
+f010b4a0:	81 fe ee 05 00 00    	cmp    $0x5ee,%esi
+f010b4a6:	77 6a                	ja     f010b512 <e1000_transmit+0x7e>
+	return e1000[offset / sizeof(uint32_t)];
+f010b4a8:	a1 08 a0 65 f0       	mov    0xf065a008,%eax
+f010b4ad:	8b 98 18 38 00 00    	mov    0x3818(%eax),%ebx
+		return -E_INVAL;
+
+	tdt = e1000_read_reg(E1000_TDT);
+	if (!(tx_descs[tdt].status & E1000_TXD_STAT_DD))
+f010b4b3:	89 df                	mov    %ebx,%edi
+f010b4b5:	c1 e7 04             	shl    $0x4,%edi
+f010b4b8:	a1 54 89 61 f0       	mov    0xf0618954,%eax
+f010b4bd:	f6 44 38 0c 01       	testb  $0x1,0xc(%eax,%edi,1)
+f010b4c2:	74 55                	je     f010b519 <e1000_transmit+0x85>
+		return -E_INVAL;
+
+	memcpy(tx_pkts[tdt], data, size);
+f010b4c4:	83 ec 04             	sub    $0x4,%esp
+f010b4c7:	56                   	push   %esi
+f010b4c8:	ff 75 08             	push   0x8(%ebp)
+f010b4cb:	69 c3 ee 05 00 00    	imul   $0x5ee,%ebx,%eax
+f010b4d1:	03 05 50 89 61 f0    	add    0xf0618950,%eax
+f010b4d7:	50                   	push   %eax
+f010b4d8:	e8 b8 f1 ff ff       	call   f010a695 <memcpy>
+	tx_descs[tdt].cmd = E1000_TXD_CMD_RS | E1000_TXD_CMD_EOP;
+f010b4dd:	89 f8                	mov    %edi,%eax
+f010b4df:	03 05 54 89 61 f0    	add    0xf0618954,%eax
+f010b4e5:	c6 40 0b 09          	movb   $0x9,0xb(%eax)
+	tx_descs[tdt].length = size;
+f010b4e9:	66 89 70 08          	mov    %si,0x8(%eax)
+	tx_descs[tdt].status &= ~E1000_TXD_STAT_DD;
+f010b4ed:	80 60 0c fe          	andb   $0xfe,0xc(%eax)
+	e1000_write_reg(E1000_TDT, (tdt + 1) % E1000_MAX_TDESC);
+f010b4f1:	83 c3 01             	add    $0x1,%ebx
+f010b4f4:	83 e3 3f             	and    $0x3f,%ebx
+	e1000[offset / sizeof(uint32_t)] = value;
+f010b4f7:	a1 08 a0 65 f0       	mov    0xf065a008,%eax
+f010b4fc:	89 98 18 38 00 00    	mov    %ebx,0x3818(%eax)
+}
+f010b502:	83 c4 10             	add    $0x10,%esp
+	return 0;
+f010b505:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010b50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b50d:	5b                   	pop    %ebx
+f010b50e:	5e                   	pop    %esi
+f010b50f:	5f                   	pop    %edi
+f010b510:	5d                   	pop    %ebp
+f010b511:	c3                   	ret
+		return -E_INVAL;
+f010b512:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010b517:	eb f1                	jmp    f010b50a <e1000_transmit+0x76>
+		return -E_INVAL;
+f010b519:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010b51e:	eb ea                	jmp    f010b50a <e1000_transmit+0x76>
+
+f010b520 <e1000_receive>:
+
+int
+e1000_receive(void *data)
+{
+f010b520:	55                   	push   %ebp
+f010b521:	89 e5                	mov    %esp,%ebp
+f010b523:	57                   	push   %edi
+f010b524:	56                   	push   %esi
+f010b525:	53                   	push   %ebx
+f010b526:	83 ec 0c             	sub    $0xc,%esp
+	return e1000[offset / sizeof(uint32_t)];
+f010b529:	a1 08 a0 65 f0       	mov    0xf065a008,%eax
+f010b52e:	8b 98 18 28 00 00    	mov    0x2818(%eax),%ebx
+	uint32_t next;
+	int length;
+
+	next = (e1000_read_reg(E1000_RDT) + 1) % E1000_MAX_RDESC;
+f010b534:	83 c3 01             	add    $0x1,%ebx
+f010b537:	83 e3 7f             	and    $0x7f,%ebx
+	if (!(rx_descs[next].status & E1000_RXD_STAT_DD))
+f010b53a:	89 de                	mov    %ebx,%esi
+f010b53c:	c1 e6 04             	shl    $0x4,%esi
+f010b53f:	89 f0                	mov    %esi,%eax
+f010b541:	03 05 4c 89 61 f0    	add    0xf061894c,%eax
+f010b547:	0f b6 50 0c          	movzbl 0xc(%eax),%edx
+f010b54b:	f6 c2 01             	test   $0x1,%dl
+f010b54e:	74 7a                	je     f010b5ca <e1000_receive+0xaa>
+		return -E_INVAL;
+
+	if (!(rx_descs[next].status & E1000_RXD_STAT_EOP))
+f010b550:	f6 c2 02             	test   $0x2,%dl
+f010b553:	74 48                	je     f010b59d <e1000_receive+0x7d>
+		panic("Do not expect jumbo frames");
+
+	length = rx_descs[next].length;
+f010b555:	0f b7 40 08          	movzwl 0x8(%eax),%eax
+f010b559:	0f b7 f8             	movzwl %ax,%edi
+	if (length <= 0)
+f010b55c:	85 ff                	test   %edi,%edi
+f010b55e:	7e 54                	jle    f010b5b4 <e1000_receive+0x94>
+		panic("Received a packet with an invalid length %d", length);
+
+	memcpy(data, rx_pkts[next], length);
+f010b560:	83 ec 04             	sub    $0x4,%esp
+f010b563:	0f b7 c0             	movzwl %ax,%eax
+f010b566:	50                   	push   %eax
+f010b567:	89 d8                	mov    %ebx,%eax
+f010b569:	c1 e0 0b             	shl    $0xb,%eax
+f010b56c:	03 05 48 89 61 f0    	add    0xf0618948,%eax
+f010b572:	50                   	push   %eax
+f010b573:	ff 75 08             	push   0x8(%ebp)
+f010b576:	e8 1a f1 ff ff       	call   f010a695 <memcpy>
+	rx_descs[next].status = 0;
+f010b57b:	a1 4c 89 61 f0       	mov    0xf061894c,%eax
+f010b580:	c6 44 30 0c 00       	movb   $0x0,0xc(%eax,%esi,1)
+	e1000[offset / sizeof(uint32_t)] = value;
+f010b585:	a1 08 a0 65 f0       	mov    0xf065a008,%eax
+f010b58a:	89 98 18 28 00 00    	mov    %ebx,0x2818(%eax)
+}
+f010b590:	83 c4 10             	add    $0x10,%esp
+	e1000_write_reg(E1000_RDT, next);
+	return length;
+}
+f010b593:	89 f8                	mov    %edi,%eax
+f010b595:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b598:	5b                   	pop    %ebx
+f010b599:	5e                   	pop    %esi
+f010b59a:	5f                   	pop    %edi
+f010b59b:	5d                   	pop    %ebp
+f010b59c:	c3                   	ret
+		panic("Do not expect jumbo frames");
+f010b59d:	83 ec 04             	sub    $0x4,%esp
+f010b5a0:	68 19 eb 10 f0       	push   $0xf010eb19
+f010b5a5:	68 4b 01 00 00       	push   $0x14b
+f010b5aa:	68 0c eb 10 f0       	push   $0xf010eb0c
+f010b5af:	e8 e4 4a ff ff       	call   f0100098 <_panic>
+		panic("Received a packet with an invalid length %d", length);
+f010b5b4:	6a 00                	push   $0x0
+f010b5b6:	68 e0 ea 10 f0       	push   $0xf010eae0
+f010b5bb:	68 4f 01 00 00       	push   $0x14f
+f010b5c0:	68 0c eb 10 f0       	push   $0xf010eb0c
+f010b5c5:	e8 ce 4a ff ff       	call   f0100098 <_panic>
+		return -E_INVAL;
+f010b5ca:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f010b5cf:	eb c2                	jmp    f010b593 <e1000_receive+0x73>
+
+f010b5d1 <pci_attach_match>:
+}
+
+static int __attribute__((warn_unused_result))
+pci_attach_match(uint32_t key1, uint32_t key2,
+		 struct pci_driver *list, struct pci_func *pcif)
+{
+f010b5d1:	55                   	push   %ebp
+f010b5d2:	89 e5                	mov    %esp,%ebp
+f010b5d4:	57                   	push   %edi
+f010b5d5:	56                   	push   %esi
+f010b5d6:	53                   	push   %ebx
+f010b5d7:	83 ec 1c             	sub    $0x1c,%esp
+f010b5da:	89 c7                	mov    %eax,%edi
+f010b5dc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	uint32_t i;
+
+	for (i = 0; list[i].attachfn; i++) {
+f010b5df:	89 cb                	mov    %ecx,%ebx
+f010b5e1:	eb 03                	jmp    f010b5e6 <pci_attach_match+0x15>
+f010b5e3:	83 c3 0c             	add    $0xc,%ebx
+f010b5e6:	89 de                	mov    %ebx,%esi
+f010b5e8:	8b 43 08             	mov    0x8(%ebx),%eax
+f010b5eb:	85 c0                	test   %eax,%eax
+f010b5ed:	74 37                	je     f010b626 <pci_attach_match+0x55>
+		if (list[i].key1 == key1 && list[i].key2 == key2) {
+f010b5ef:	39 3b                	cmp    %edi,(%ebx)
+f010b5f1:	75 f0                	jne    f010b5e3 <pci_attach_match+0x12>
+f010b5f3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f010b5f6:	39 56 04             	cmp    %edx,0x4(%esi)
+f010b5f9:	75 e8                	jne    f010b5e3 <pci_attach_match+0x12>
+			int r = list[i].attachfn(pcif);
+f010b5fb:	83 ec 0c             	sub    $0xc,%esp
+f010b5fe:	ff 75 08             	push   0x8(%ebp)
+f010b601:	ff d0                	call   *%eax
+			if (r > 0)
+f010b603:	83 c4 10             	add    $0x10,%esp
+f010b606:	85 c0                	test   %eax,%eax
+f010b608:	7f 1c                	jg     f010b626 <pci_attach_match+0x55>
+				return r;
+			if (r < 0)
+f010b60a:	79 d7                	jns    f010b5e3 <pci_attach_match+0x12>
+				cprintf("pci_attach_match: attaching "
+f010b60c:	83 ec 0c             	sub    $0xc,%esp
+f010b60f:	50                   	push   %eax
+f010b610:	ff 76 08             	push   0x8(%esi)
+f010b613:	ff 75 e4             	push   -0x1c(%ebp)
+f010b616:	57                   	push   %edi
+f010b617:	68 34 eb 10 f0       	push   $0xf010eb34
+f010b61c:	e8 db b9 ff ff       	call   f0106ffc <cprintf>
+f010b621:	83 c4 20             	add    $0x20,%esp
+f010b624:	eb bd                	jmp    f010b5e3 <pci_attach_match+0x12>
+					"%x.%x (%p): e\n",
+					key1, key2, list[i].attachfn, r);
+		}
+	}
+	return 0;
+}
+f010b626:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b629:	5b                   	pop    %ebx
+f010b62a:	5e                   	pop    %esi
+f010b62b:	5f                   	pop    %edi
+f010b62c:	5d                   	pop    %ebp
+f010b62d:	c3                   	ret
+
+f010b62e <pci_conf1_set_addr>:
+{
+f010b62e:	55                   	push   %ebp
+f010b62f:	89 e5                	mov    %esp,%ebp
+f010b631:	56                   	push   %esi
+f010b632:	53                   	push   %ebx
+f010b633:	8b 75 08             	mov    0x8(%ebp),%esi
+	assert(bus < 256);
+f010b636:	3d ff 00 00 00       	cmp    $0xff,%eax
+f010b63b:	77 3b                	ja     f010b678 <pci_conf1_set_addr+0x4a>
+	assert(dev < 32);
+f010b63d:	83 fa 1f             	cmp    $0x1f,%edx
+f010b640:	77 4c                	ja     f010b68e <pci_conf1_set_addr+0x60>
+	assert(func < 8);
+f010b642:	83 f9 07             	cmp    $0x7,%ecx
+f010b645:	77 5d                	ja     f010b6a4 <pci_conf1_set_addr+0x76>
+	assert(offset < 256);
+f010b647:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+f010b64d:	77 6b                	ja     f010b6ba <pci_conf1_set_addr+0x8c>
+	assert((offset & 0x3) == 0);
+f010b64f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f010b655:	75 79                	jne    f010b6d0 <pci_conf1_set_addr+0xa2>
+		(bus << 16) | (dev << 11) | (func << 8) | (offset);
+f010b657:	c1 e0 10             	shl    $0x10,%eax
+f010b65a:	09 f0                	or     %esi,%eax
+f010b65c:	c1 e1 08             	shl    $0x8,%ecx
+f010b65f:	09 c8                	or     %ecx,%eax
+f010b661:	c1 e2 0b             	shl    $0xb,%edx
+f010b664:	09 d0                	or     %edx,%eax
+	uint32_t v = (1 << 31) |		// config-space
+f010b666:	0d 00 00 00 80       	or     $0x80000000,%eax
+	__asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f010b66b:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+f010b670:	ef                   	out    %eax,(%dx)
+}
+f010b671:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010b674:	5b                   	pop    %ebx
+f010b675:	5e                   	pop    %esi
+f010b676:	5d                   	pop    %ebp
+f010b677:	c3                   	ret
+	assert(bus < 256);
+f010b678:	68 8b ec 10 f0       	push   $0xf010ec8b
+f010b67d:	68 0d d8 10 f0       	push   $0xf010d80d
+f010b682:	6a 2c                	push   $0x2c
+f010b684:	68 95 ec 10 f0       	push   $0xf010ec95
+f010b689:	e8 0a 4a ff ff       	call   f0100098 <_panic>
+	assert(dev < 32);
+f010b68e:	68 a0 ec 10 f0       	push   $0xf010eca0
+f010b693:	68 0d d8 10 f0       	push   $0xf010d80d
+f010b698:	6a 2d                	push   $0x2d
+f010b69a:	68 95 ec 10 f0       	push   $0xf010ec95
+f010b69f:	e8 f4 49 ff ff       	call   f0100098 <_panic>
+	assert(func < 8);
+f010b6a4:	68 a9 ec 10 f0       	push   $0xf010eca9
+f010b6a9:	68 0d d8 10 f0       	push   $0xf010d80d
+f010b6ae:	6a 2e                	push   $0x2e
+f010b6b0:	68 95 ec 10 f0       	push   $0xf010ec95
+f010b6b5:	e8 de 49 ff ff       	call   f0100098 <_panic>
+	assert(offset < 256);
+f010b6ba:	68 b2 ec 10 f0       	push   $0xf010ecb2
+f010b6bf:	68 0d d8 10 f0       	push   $0xf010d80d
+f010b6c4:	6a 2f                	push   $0x2f
+f010b6c6:	68 95 ec 10 f0       	push   $0xf010ec95
+f010b6cb:	e8 c8 49 ff ff       	call   f0100098 <_panic>
+	assert((offset & 0x3) == 0);
+f010b6d0:	68 bf ec 10 f0       	push   $0xf010ecbf
+f010b6d5:	68 0d d8 10 f0       	push   $0xf010d80d
+f010b6da:	6a 30                	push   $0x30
+f010b6dc:	68 95 ec 10 f0       	push   $0xf010ec95
+f010b6e1:	e8 b2 49 ff ff       	call   f0100098 <_panic>
+
+f010b6e6 <pci_conf_read>:
+{
+f010b6e6:	55                   	push   %ebp
+f010b6e7:	89 e5                	mov    %esp,%ebp
+f010b6e9:	53                   	push   %ebx
+f010b6ea:	83 ec 10             	sub    $0x10,%esp
+f010b6ed:	89 d3                	mov    %edx,%ebx
+	pci_conf1_set_addr(f->bus->busno, f->dev, f->func, off);
+f010b6ef:	8b 48 08             	mov    0x8(%eax),%ecx
+f010b6f2:	8b 50 04             	mov    0x4(%eax),%edx
+f010b6f5:	8b 00                	mov    (%eax),%eax
+f010b6f7:	8b 40 04             	mov    0x4(%eax),%eax
+f010b6fa:	53                   	push   %ebx
+f010b6fb:	e8 2e ff ff ff       	call   f010b62e <pci_conf1_set_addr>
+	__asm __volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f010b700:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f010b705:	ed                   	in     (%dx),%eax
+}
+f010b706:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010b709:	c9                   	leave
+f010b70a:	c3                   	ret
+
+f010b70b <pci_scan_bus>:
+		f->irq_line);
+}
+
+static int
+pci_scan_bus(struct pci_bus *bus)
+{
+f010b70b:	55                   	push   %ebp
+f010b70c:	89 e5                	mov    %esp,%ebp
+f010b70e:	57                   	push   %edi
+f010b70f:	56                   	push   %esi
+f010b710:	53                   	push   %ebx
+f010b711:	81 ec 00 01 00 00    	sub    $0x100,%esp
+f010b717:	89 c3                	mov    %eax,%ebx
+	int totaldev = 0;
+	struct pci_func df;
+	memset(&df, 0, sizeof(df));
+f010b719:	6a 48                	push   $0x48
+f010b71b:	6a 00                	push   $0x0
+f010b71d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f010b720:	50                   	push   %eax
+f010b721:	e8 d8 ee ff ff       	call   f010a5fe <memset>
+	df.bus = bus;
+f010b726:	89 5d a0             	mov    %ebx,-0x60(%ebp)
+
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f010b729:	83 c4 10             	add    $0x10,%esp
+f010b72c:	b8 00 00 00 00       	mov    $0x0,%eax
+	int totaldev = 0;
+f010b731:	c7 85 f8 fe ff ff 00 	movl   $0x0,-0x108(%ebp)
+f010b738:	00 00 00 
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f010b73b:	e9 3e 01 00 00       	jmp    f010b87e <pci_scan_bus+0x173>
+	cprintf("PCI: %02x:%02x.%d: %04x:%04x: class: %x.%x (%s) irq: %d\n",
+f010b740:	83 ec 08             	sub    $0x8,%esp
+f010b743:	89 fa                	mov    %edi,%edx
+f010b745:	0f b6 fa             	movzbl %dl,%edi
+f010b748:	57                   	push   %edi
+f010b749:	51                   	push   %ecx
+		PCI_CLASS(f->dev_class), PCI_SUBCLASS(f->dev_class), class,
+f010b74a:	c1 e8 10             	shr    $0x10,%eax
+	cprintf("PCI: %02x:%02x.%d: %04x:%04x: class: %x.%x (%s) irq: %d\n",
+f010b74d:	0f b6 c0             	movzbl %al,%eax
+f010b750:	50                   	push   %eax
+f010b751:	ff b5 00 ff ff ff    	push   -0x100(%ebp)
+f010b757:	c1 ee 10             	shr    $0x10,%esi
+f010b75a:	56                   	push   %esi
+f010b75b:	ff b5 04 ff ff ff    	push   -0xfc(%ebp)
+f010b761:	53                   	push   %ebx
+f010b762:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+f010b768:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+f010b76e:	ff 70 04             	push   0x4(%eax)
+f010b771:	68 60 eb 10 f0       	push   $0xf010eb60
+f010b776:	e8 81 b8 ff ff       	call   f0106ffc <cprintf>
+				 PCI_SUBCLASS(f->dev_class),
+f010b77b:	8b 85 68 ff ff ff    	mov    -0x98(%ebp),%eax
+		pci_attach_match(PCI_CLASS(f->dev_class),
+f010b781:	83 c4 24             	add    $0x24,%esp
+				 PCI_SUBCLASS(f->dev_class),
+f010b784:	89 c2                	mov    %eax,%edx
+f010b786:	c1 ea 10             	shr    $0x10,%edx
+		pci_attach_match(PCI_CLASS(f->dev_class),
+f010b789:	0f b6 d2             	movzbl %dl,%edx
+f010b78c:	c1 e8 18             	shr    $0x18,%eax
+f010b78f:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+f010b795:	51                   	push   %ecx
+f010b796:	b9 38 96 11 f0       	mov    $0xf0119638,%ecx
+f010b79b:	e8 31 fe ff ff       	call   f010b5d1 <pci_attach_match>
+				 &pci_attach_class[0], f) ||
+f010b7a0:	83 c4 10             	add    $0x10,%esp
+f010b7a3:	85 c0                	test   %eax,%eax
+f010b7a5:	0f 84 a3 00 00 00    	je     f010b84e <pci_scan_bus+0x143>
+
+		totaldev++;
+
+		struct pci_func f = df;
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+		     f.func++) {
+f010b7ab:	83 c3 01             	add    $0x1,%ebx
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+f010b7ae:	89 9d 18 ff ff ff    	mov    %ebx,-0xe8(%ebp)
+f010b7b4:	8b 85 fc fe ff ff    	mov    -0x104(%ebp),%eax
+f010b7ba:	39 c3                	cmp    %eax,%ebx
+f010b7bc:	0f 83 b6 00 00 00    	jae    f010b878 <pci_scan_bus+0x16d>
+			struct pci_func af = f;
+f010b7c2:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f010b7c8:	8d b5 10 ff ff ff    	lea    -0xf0(%ebp),%esi
+f010b7ce:	b9 12 00 00 00       	mov    $0x12,%ecx
+f010b7d3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+
+			af.dev_id = pci_conf_read(&f, PCI_ID_REG);
+f010b7d5:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b7da:	8d 85 10 ff ff ff    	lea    -0xf0(%ebp),%eax
+f010b7e0:	e8 01 ff ff ff       	call   f010b6e6 <pci_conf_read>
+f010b7e5:	89 c6                	mov    %eax,%esi
+f010b7e7:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+			if (PCI_VENDOR(af.dev_id) == 0xffff)
+f010b7ed:	0f b7 c0             	movzwl %ax,%eax
+f010b7f0:	89 85 04 ff ff ff    	mov    %eax,-0xfc(%ebp)
+f010b7f6:	66 83 fe ff          	cmp    $0xffff,%si
+f010b7fa:	74 af                	je     f010b7ab <pci_scan_bus+0xa0>
+				continue;
+
+			uint32_t intr = pci_conf_read(&af, PCI_INTERRUPT_REG);
+f010b7fc:	ba 3c 00 00 00       	mov    $0x3c,%edx
+f010b801:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f010b807:	e8 da fe ff ff       	call   f010b6e6 <pci_conf_read>
+f010b80c:	89 c7                	mov    %eax,%edi
+			af.irq_line = PCI_INTERRUPT_LINE(intr);
+f010b80e:	88 45 9c             	mov    %al,-0x64(%ebp)
+
+			af.dev_class = pci_conf_read(&af, PCI_CLASS_REG);
+f010b811:	ba 08 00 00 00       	mov    $0x8,%edx
+f010b816:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f010b81c:	e8 c5 fe ff ff       	call   f010b6e6 <pci_conf_read>
+f010b821:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+	if (PCI_CLASS(f->dev_class) < sizeof(pci_class) / sizeof(pci_class[0]))
+f010b827:	89 c2                	mov    %eax,%edx
+f010b829:	c1 ea 18             	shr    $0x18,%edx
+f010b82c:	89 95 00 ff ff ff    	mov    %edx,-0x100(%ebp)
+	const char *class = pci_class[0];
+f010b832:	b9 d3 ec 10 f0       	mov    $0xf010ecd3,%ecx
+	if (PCI_CLASS(f->dev_class) < sizeof(pci_class) / sizeof(pci_class[0]))
+f010b837:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+f010b83c:	0f 87 fe fe ff ff    	ja     f010b740 <pci_scan_bus+0x35>
+		class = pci_class[PCI_CLASS(f->dev_class)];
+f010b842:	8b 0c 95 48 ed 10 f0 	mov    -0xfef12b8(,%edx,4),%ecx
+f010b849:	e9 f2 fe ff ff       	jmp    f010b740 <pci_scan_bus+0x35>
+				 PCI_PRODUCT(f->dev_id),
+f010b84e:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+		pci_attach_match(PCI_VENDOR(f->dev_id),
+f010b854:	89 c2                	mov    %eax,%edx
+f010b856:	c1 ea 10             	shr    $0x10,%edx
+f010b859:	0f b7 c0             	movzwl %ax,%eax
+f010b85c:	83 ec 0c             	sub    $0xc,%esp
+f010b85f:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f010b865:	57                   	push   %edi
+f010b866:	b9 20 96 11 f0       	mov    $0xf0119620,%ecx
+f010b86b:	e8 61 fd ff ff       	call   f010b5d1 <pci_attach_match>
+f010b870:	83 c4 10             	add    $0x10,%esp
+f010b873:	e9 33 ff ff ff       	jmp    f010b7ab <pci_scan_bus+0xa0>
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f010b878:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010b87b:	83 c0 01             	add    $0x1,%eax
+f010b87e:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+f010b881:	83 f8 1f             	cmp    $0x1f,%eax
+f010b884:	77 4b                	ja     f010b8d1 <pci_scan_bus+0x1c6>
+		uint32_t bhlc = pci_conf_read(&df, PCI_BHLC_REG);
+f010b886:	ba 0c 00 00 00       	mov    $0xc,%edx
+f010b88b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f010b88e:	e8 53 fe ff ff       	call   f010b6e6 <pci_conf_read>
+		if (PCI_HDRTYPE_TYPE(bhlc) > 1)	    // Unsupported or no device
+f010b893:	89 c2                	mov    %eax,%edx
+f010b895:	c1 ea 10             	shr    $0x10,%edx
+f010b898:	89 d3                	mov    %edx,%ebx
+f010b89a:	83 e3 7e             	and    $0x7e,%ebx
+f010b89d:	75 d9                	jne    f010b878 <pci_scan_bus+0x16d>
+		totaldev++;
+f010b89f:	83 85 f8 fe ff ff 01 	addl   $0x1,-0x108(%ebp)
+		struct pci_func f = df;
+f010b8a6:	8d bd 10 ff ff ff    	lea    -0xf0(%ebp),%edi
+f010b8ac:	8d 75 a0             	lea    -0x60(%ebp),%esi
+f010b8af:	b9 12 00 00 00       	mov    $0x12,%ecx
+f010b8b4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+f010b8b6:	25 00 00 80 00       	and    $0x800000,%eax
+f010b8bb:	83 f8 01             	cmp    $0x1,%eax
+f010b8be:	19 c0                	sbb    %eax,%eax
+f010b8c0:	83 e0 f9             	and    $0xfffffff9,%eax
+f010b8c3:	83 c0 08             	add    $0x8,%eax
+f010b8c6:	89 85 fc fe ff ff    	mov    %eax,-0x104(%ebp)
+f010b8cc:	e9 dd fe ff ff       	jmp    f010b7ae <pci_scan_bus+0xa3>
+			pci_attach(&af);
+		}
+	}
+
+	return totaldev;
+}
+f010b8d1:	8b 85 f8 fe ff ff    	mov    -0x108(%ebp),%eax
+f010b8d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b8da:	5b                   	pop    %ebx
+f010b8db:	5e                   	pop    %esi
+f010b8dc:	5f                   	pop    %edi
+f010b8dd:	5d                   	pop    %ebp
+f010b8de:	c3                   	ret
+
+f010b8df <pci_bridge_attach>:
+
+static int
+pci_bridge_attach(struct pci_func *pcif)
+{
+f010b8df:	55                   	push   %ebp
+f010b8e0:	89 e5                	mov    %esp,%ebp
+f010b8e2:	57                   	push   %edi
+f010b8e3:	56                   	push   %esi
+f010b8e4:	53                   	push   %ebx
+f010b8e5:	83 ec 1c             	sub    $0x1c,%esp
+f010b8e8:	8b 75 08             	mov    0x8(%ebp),%esi
+	uint32_t ioreg  = pci_conf_read(pcif, PCI_BRIDGE_STATIO_REG);
+f010b8eb:	ba 1c 00 00 00       	mov    $0x1c,%edx
+f010b8f0:	89 f0                	mov    %esi,%eax
+f010b8f2:	e8 ef fd ff ff       	call   f010b6e6 <pci_conf_read>
+f010b8f7:	89 c7                	mov    %eax,%edi
+	uint32_t busreg = pci_conf_read(pcif, PCI_BRIDGE_BUS_REG);
+f010b8f9:	ba 18 00 00 00       	mov    $0x18,%edx
+f010b8fe:	89 f0                	mov    %esi,%eax
+f010b900:	e8 e1 fd ff ff       	call   f010b6e6 <pci_conf_read>
+
+	if (PCI_BRIDGE_IO_32BITS(ioreg)) {
+f010b905:	83 e7 0f             	and    $0xf,%edi
+f010b908:	83 ff 01             	cmp    $0x1,%edi
+f010b90b:	74 52                	je     f010b95f <pci_bridge_attach+0x80>
+f010b90d:	89 c3                	mov    %eax,%ebx
+			pcif->bus->busno, pcif->dev, pcif->func);
+		return 0;
+	}
+
+	struct pci_bus nbus;
+	memset(&nbus, 0, sizeof(nbus));
+f010b90f:	83 ec 04             	sub    $0x4,%esp
+f010b912:	6a 08                	push   $0x8
+f010b914:	6a 00                	push   $0x0
+f010b916:	8d 7d e0             	lea    -0x20(%ebp),%edi
+f010b919:	57                   	push   %edi
+f010b91a:	e8 df ec ff ff       	call   f010a5fe <memset>
+	nbus.parent_bridge = pcif;
+f010b91f:	89 75 e0             	mov    %esi,-0x20(%ebp)
+	nbus.busno = (busreg >> PCI_BRIDGE_BUS_SECONDARY_SHIFT) & 0xff;
+f010b922:	0f b6 c7             	movzbl %bh,%eax
+f010b925:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+	if (pci_show_devs)
+		cprintf("PCI: %02x:%02x.%d: bridge to PCI bus %d--%d\n",
+f010b928:	83 c4 08             	add    $0x8,%esp
+			pcif->bus->busno, pcif->dev, pcif->func,
+			nbus.busno,
+			(busreg >> PCI_BRIDGE_BUS_SUBORDINATE_SHIFT) & 0xff);
+f010b92b:	c1 eb 10             	shr    $0x10,%ebx
+		cprintf("PCI: %02x:%02x.%d: bridge to PCI bus %d--%d\n",
+f010b92e:	0f b6 db             	movzbl %bl,%ebx
+f010b931:	53                   	push   %ebx
+f010b932:	50                   	push   %eax
+f010b933:	ff 76 08             	push   0x8(%esi)
+f010b936:	ff 76 04             	push   0x4(%esi)
+f010b939:	8b 06                	mov    (%esi),%eax
+f010b93b:	ff 70 04             	push   0x4(%eax)
+f010b93e:	68 d0 eb 10 f0       	push   $0xf010ebd0
+f010b943:	e8 b4 b6 ff ff       	call   f0106ffc <cprintf>
+
+	pci_scan_bus(&nbus);
+f010b948:	83 c4 20             	add    $0x20,%esp
+f010b94b:	89 f8                	mov    %edi,%eax
+f010b94d:	e8 b9 fd ff ff       	call   f010b70b <pci_scan_bus>
+	return 1;
+f010b952:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+f010b957:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b95a:	5b                   	pop    %ebx
+f010b95b:	5e                   	pop    %esi
+f010b95c:	5f                   	pop    %edi
+f010b95d:	5d                   	pop    %ebp
+f010b95e:	c3                   	ret
+		cprintf("PCI: %02x:%02x.%d: 32-bit bridge IO not supported.\n",
+f010b95f:	ff 76 08             	push   0x8(%esi)
+f010b962:	ff 76 04             	push   0x4(%esi)
+f010b965:	8b 06                	mov    (%esi),%eax
+f010b967:	ff 70 04             	push   0x4(%eax)
+f010b96a:	68 9c eb 10 f0       	push   $0xf010eb9c
+f010b96f:	e8 88 b6 ff ff       	call   f0106ffc <cprintf>
+		return 0;
+f010b974:	83 c4 10             	add    $0x10,%esp
+f010b977:	b8 00 00 00 00       	mov    $0x0,%eax
+f010b97c:	eb d9                	jmp    f010b957 <pci_bridge_attach+0x78>
+
+f010b97e <pci_conf_write>:
+{
+f010b97e:	55                   	push   %ebp
+f010b97f:	89 e5                	mov    %esp,%ebp
+f010b981:	57                   	push   %edi
+f010b982:	56                   	push   %esi
+f010b983:	53                   	push   %ebx
+f010b984:	83 ec 18             	sub    $0x18,%esp
+f010b987:	89 d7                	mov    %edx,%edi
+f010b989:	89 ce                	mov    %ecx,%esi
+	pci_conf1_set_addr(f->bus->busno, f->dev, f->func, off);
+f010b98b:	8b 48 08             	mov    0x8(%eax),%ecx
+f010b98e:	8b 50 04             	mov    0x4(%eax),%edx
+f010b991:	8b 00                	mov    (%eax),%eax
+f010b993:	8b 40 04             	mov    0x4(%eax),%eax
+f010b996:	57                   	push   %edi
+f010b997:	e8 92 fc ff ff       	call   f010b62e <pci_conf1_set_addr>
+	__asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f010b99c:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f010b9a1:	89 f0                	mov    %esi,%eax
+f010b9a3:	ef                   	out    %eax,(%dx)
+}
+f010b9a4:	83 c4 10             	add    $0x10,%esp
+f010b9a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b9aa:	5b                   	pop    %ebx
+f010b9ab:	5e                   	pop    %esi
+f010b9ac:	5f                   	pop    %edi
+f010b9ad:	5d                   	pop    %ebp
+f010b9ae:	c3                   	ret
+
+f010b9af <pci_func_enable>:
+
+// External PCI subsystem interface
+
+void
+pci_func_enable(struct pci_func *f)
+{
+f010b9af:	55                   	push   %ebp
+f010b9b0:	89 e5                	mov    %esp,%ebp
+f010b9b2:	57                   	push   %edi
+f010b9b3:	56                   	push   %esi
+f010b9b4:	53                   	push   %ebx
+f010b9b5:	83 ec 1c             	sub    $0x1c,%esp
+f010b9b8:	8b 7d 08             	mov    0x8(%ebp),%edi
+	pci_conf_write(f, PCI_COMMAND_STATUS_REG,
+f010b9bb:	b9 07 00 00 00       	mov    $0x7,%ecx
+f010b9c0:	ba 04 00 00 00       	mov    $0x4,%edx
+f010b9c5:	89 f8                	mov    %edi,%eax
+f010b9c7:	e8 b2 ff ff ff       	call   f010b97e <pci_conf_write>
+		       PCI_COMMAND_MEM_ENABLE |
+		       PCI_COMMAND_MASTER_ENABLE);
+
+	uint32_t bar_width;
+	uint32_t bar;
+	for (bar = PCI_MAPREG_START; bar < PCI_MAPREG_END;
+f010b9cc:	be 10 00 00 00       	mov    $0x10,%esi
+f010b9d1:	eb 29                	jmp    f010b9fc <pci_func_enable+0x4d>
+			base = PCI_MAPREG_MEM_ADDR(oldv);
+			if (pci_show_addrs)
+				cprintf("  mem region %d: %d bytes at 0x%x\n",
+					regnum, size, base);
+		} else {
+			size = PCI_MAPREG_IO_SIZE(rv);
+f010b9d3:	89 d8                	mov    %ebx,%eax
+f010b9d5:	83 e0 fc             	and    $0xfffffffc,%eax
+f010b9d8:	f7 d8                	neg    %eax
+f010b9da:	21 c3                	and    %eax,%ebx
+			base = PCI_MAPREG_IO_ADDR(oldv);
+f010b9dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010b9df:	83 e0 fc             	and    $0xfffffffc,%eax
+f010b9e2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		bar_width = 4;
+f010b9e5:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+f010b9ec:	eb 7a                	jmp    f010ba68 <pci_func_enable+0xb9>
+	     bar += bar_width)
+f010b9ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010b9f1:	01 c6                	add    %eax,%esi
+	for (bar = PCI_MAPREG_START; bar < PCI_MAPREG_END;
+f010b9f3:	83 fe 27             	cmp    $0x27,%esi
+f010b9f6:	0f 87 c7 00 00 00    	ja     f010bac3 <pci_func_enable+0x114>
+		uint32_t oldv = pci_conf_read(f, bar);
+f010b9fc:	89 f2                	mov    %esi,%edx
+f010b9fe:	89 f8                	mov    %edi,%eax
+f010ba00:	e8 e1 fc ff ff       	call   f010b6e6 <pci_conf_read>
+f010ba05:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		pci_conf_write(f, bar, 0xffffffff);
+f010ba08:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+f010ba0d:	89 f2                	mov    %esi,%edx
+f010ba0f:	89 f8                	mov    %edi,%eax
+f010ba11:	e8 68 ff ff ff       	call   f010b97e <pci_conf_write>
+		uint32_t rv = pci_conf_read(f, bar);
+f010ba16:	89 f2                	mov    %esi,%edx
+f010ba18:	89 f8                	mov    %edi,%eax
+f010ba1a:	e8 c7 fc ff ff       	call   f010b6e6 <pci_conf_read>
+f010ba1f:	89 c3                	mov    %eax,%ebx
+		bar_width = 4;
+f010ba21:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+		if (rv == 0)
+f010ba28:	85 c0                	test   %eax,%eax
+f010ba2a:	74 c2                	je     f010b9ee <pci_func_enable+0x3f>
+		int regnum = PCI_MAPREG_NUM(bar);
+f010ba2c:	8d 46 f0             	lea    -0x10(%esi),%eax
+f010ba2f:	89 c2                	mov    %eax,%edx
+f010ba31:	c1 ea 02             	shr    $0x2,%edx
+f010ba34:	89 55 d8             	mov    %edx,-0x28(%ebp)
+		if (PCI_MAPREG_TYPE(rv) == PCI_MAPREG_TYPE_MEM) {
+f010ba37:	f6 c3 01             	test   $0x1,%bl
+f010ba3a:	75 97                	jne    f010b9d3 <pci_func_enable+0x24>
+			if (PCI_MAPREG_MEM_TYPE(rv) == PCI_MAPREG_MEM_TYPE_64BIT)
+f010ba3c:	89 da                	mov    %ebx,%edx
+f010ba3e:	83 e2 06             	and    $0x6,%edx
+		bar_width = 4;
+f010ba41:	83 fa 04             	cmp    $0x4,%edx
+f010ba44:	0f 94 c1             	sete   %cl
+f010ba47:	0f b6 c9             	movzbl %cl,%ecx
+f010ba4a:	8d 14 8d 04 00 00 00 	lea    0x4(,%ecx,4),%edx
+f010ba51:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+			size = PCI_MAPREG_MEM_SIZE(rv);
+f010ba54:	89 da                	mov    %ebx,%edx
+f010ba56:	83 e2 f0             	and    $0xfffffff0,%edx
+f010ba59:	89 d0                	mov    %edx,%eax
+f010ba5b:	f7 d8                	neg    %eax
+f010ba5d:	21 c3                	and    %eax,%ebx
+			base = PCI_MAPREG_MEM_ADDR(oldv);
+f010ba5f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010ba62:	83 e0 f0             	and    $0xfffffff0,%eax
+f010ba65:	89 45 dc             	mov    %eax,-0x24(%ebp)
+			if (pci_show_addrs)
+				cprintf("  io region %d: %d bytes at 0x%x\n",
+					regnum, size, base);
+		}
+
+		pci_conf_write(f, bar, oldv);
+f010ba68:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f010ba6b:	89 f2                	mov    %esi,%edx
+f010ba6d:	89 f8                	mov    %edi,%eax
+f010ba6f:	e8 0a ff ff ff       	call   f010b97e <pci_conf_write>
+		f->reg_base[regnum] = base;
+f010ba74:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f010ba77:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010ba7a:	89 44 8f 14          	mov    %eax,0x14(%edi,%ecx,4)
+		f->reg_size[regnum] = size;
+f010ba7e:	89 5c 8f 2c          	mov    %ebx,0x2c(%edi,%ecx,4)
+
+		if (size && !base)
+f010ba82:	85 db                	test   %ebx,%ebx
+f010ba84:	0f 84 64 ff ff ff    	je     f010b9ee <pci_func_enable+0x3f>
+f010ba8a:	85 c0                	test   %eax,%eax
+f010ba8c:	0f 85 5c ff ff ff    	jne    f010b9ee <pci_func_enable+0x3f>
+			cprintf("PCI device %02x:%02x.%d (%04x:%04x) "
+				"may be misconfigured: "
+				"region %d: base 0x%x, size %d\n",
+				f->bus->busno, f->dev, f->func,
+				PCI_VENDOR(f->dev_id), PCI_PRODUCT(f->dev_id),
+f010ba92:	8b 47 0c             	mov    0xc(%edi),%eax
+			cprintf("PCI device %02x:%02x.%d (%04x:%04x) "
+f010ba95:	83 ec 0c             	sub    $0xc,%esp
+f010ba98:	53                   	push   %ebx
+f010ba99:	6a 00                	push   $0x0
+f010ba9b:	51                   	push   %ecx
+f010ba9c:	89 c2                	mov    %eax,%edx
+f010ba9e:	c1 ea 10             	shr    $0x10,%edx
+f010baa1:	52                   	push   %edx
+f010baa2:	0f b7 c0             	movzwl %ax,%eax
+f010baa5:	50                   	push   %eax
+f010baa6:	ff 77 08             	push   0x8(%edi)
+f010baa9:	ff 77 04             	push   0x4(%edi)
+f010baac:	8b 07                	mov    (%edi),%eax
+f010baae:	ff 70 04             	push   0x4(%eax)
+f010bab1:	68 00 ec 10 f0       	push   $0xf010ec00
+f010bab6:	e8 41 b5 ff ff       	call   f0106ffc <cprintf>
+f010babb:	83 c4 30             	add    $0x30,%esp
+f010babe:	e9 2b ff ff ff       	jmp    f010b9ee <pci_func_enable+0x3f>
+				regnum, base, size);
+	}
+
+	cprintf("PCI function %02x:%02x.%d (%04x:%04x) enabled\n",
+		f->bus->busno, f->dev, f->func,
+		PCI_VENDOR(f->dev_id), PCI_PRODUCT(f->dev_id));
+f010bac3:	8b 47 0c             	mov    0xc(%edi),%eax
+	cprintf("PCI function %02x:%02x.%d (%04x:%04x) enabled\n",
+f010bac6:	83 ec 08             	sub    $0x8,%esp
+f010bac9:	89 c2                	mov    %eax,%edx
+f010bacb:	c1 ea 10             	shr    $0x10,%edx
+f010bace:	52                   	push   %edx
+f010bacf:	0f b7 c0             	movzwl %ax,%eax
+f010bad2:	50                   	push   %eax
+f010bad3:	ff 77 08             	push   0x8(%edi)
+f010bad6:	ff 77 04             	push   0x4(%edi)
+f010bad9:	8b 07                	mov    (%edi),%eax
+f010badb:	ff 70 04             	push   0x4(%eax)
+f010bade:	68 5c ec 10 f0       	push   $0xf010ec5c
+f010bae3:	e8 14 b5 ff ff       	call   f0106ffc <cprintf>
+}
+f010bae8:	83 c4 20             	add    $0x20,%esp
+f010baeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010baee:	5b                   	pop    %ebx
+f010baef:	5e                   	pop    %esi
+f010baf0:	5f                   	pop    %edi
+f010baf1:	5d                   	pop    %ebp
+f010baf2:	c3                   	ret
+
+f010baf3 <pci_init>:
+
+int
+pci_init(void)
+{
+f010baf3:	55                   	push   %ebp
+f010baf4:	89 e5                	mov    %esp,%ebp
+f010baf6:	83 ec 0c             	sub    $0xc,%esp
+	static struct pci_bus root_bus;
+	memset(&root_bus, 0, sizeof(root_bus));
+f010baf9:	6a 08                	push   $0x8
+f010bafb:	6a 00                	push   $0x0
+f010bafd:	68 58 89 61 f0       	push   $0xf0618958
+f010bb02:	e8 f7 ea ff ff       	call   f010a5fe <memset>
+
+	return pci_scan_bus(&root_bus);
+f010bb07:	b8 58 89 61 f0       	mov    $0xf0618958,%eax
+f010bb0c:	e8 fa fb ff ff       	call   f010b70b <pci_scan_bus>
+}
+f010bb11:	c9                   	leave
+f010bb12:	c3                   	ret
+
+f010bb13 <time_init>:
+static unsigned int ticks;
+
+void
+time_init(void)
+{
+	ticks = 0;
+f010bb13:	c7 05 60 89 61 f0 00 	movl   $0x0,0xf0618960
+f010bb1a:	00 00 00 
+}
+f010bb1d:	c3                   	ret
+
+f010bb1e <time_tick>:
+// This should be called once per timer interrupt.  A timer interrupt
+// fires every 10 ms.
+void
+time_tick(void)
+{
+	ticks++;
+f010bb1e:	a1 60 89 61 f0       	mov    0xf0618960,%eax
+f010bb23:	83 c0 01             	add    $0x1,%eax
+f010bb26:	a3 60 89 61 f0       	mov    %eax,0xf0618960
+	if (ticks * 10 < ticks)
+f010bb2b:	8d 14 80             	lea    (%eax,%eax,4),%edx
+f010bb2e:	01 d2                	add    %edx,%edx
+f010bb30:	39 c2                	cmp    %eax,%edx
+f010bb32:	72 01                	jb     f010bb35 <time_tick+0x17>
+f010bb34:	c3                   	ret
+{
+f010bb35:	55                   	push   %ebp
+f010bb36:	89 e5                	mov    %esp,%ebp
+f010bb38:	83 ec 0c             	sub    $0xc,%esp
+		panic("time_tick: time overflowed");
+f010bb3b:	68 64 ed 10 f0       	push   $0xf010ed64
+f010bb40:	6a 13                	push   $0x13
+f010bb42:	68 7f ed 10 f0       	push   $0xf010ed7f
+f010bb47:	e8 4c 45 ff ff       	call   f0100098 <_panic>
+
+f010bb4c <time_msec>:
+}
+
+unsigned int
+time_msec(void)
+{
+	return ticks * 10;
+f010bb4c:	a1 60 89 61 f0       	mov    0xf0618960,%eax
+f010bb51:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010bb54:	01 c0                	add    %eax,%eax
+}
+f010bb56:	c3                   	ret
+f010bb57:	66 90                	xchg   %ax,%ax
+f010bb59:	66 90                	xchg   %ax,%ax
+f010bb5b:	66 90                	xchg   %ax,%ax
+f010bb5d:	66 90                	xchg   %ax,%ax
+f010bb5f:	90                   	nop
+
+f010bb60 <__udivmoddi4>:
+f010bb60:	55                   	push   %ebp
+f010bb61:	57                   	push   %edi
+f010bb62:	56                   	push   %esi
+f010bb63:	53                   	push   %ebx
+f010bb64:	83 ec 14             	sub    $0x14,%esp
+f010bb67:	8b 74 24 34          	mov    0x34(%esp),%esi
+f010bb6b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+f010bb6f:	8b 44 24 28          	mov    0x28(%esp),%eax
+f010bb73:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f010bb77:	89 f1                	mov    %esi,%ecx
+f010bb79:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+f010bb7d:	09 d9                	or     %ebx,%ecx
+f010bb7f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+f010bb83:	0f 84 92 00 00 00    	je     f010bc1b <__udivmoddi4+0xbb>
+f010bb89:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+f010bb90:	00 
+f010bb91:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+f010bb96:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+f010bb9d:	00 
+f010bb9e:	89 1c 24             	mov    %ebx,(%esp)
+f010bba1:	89 74 24 04          	mov    %esi,0x4(%esp)
+f010bba5:	8d 76 00             	lea    0x0(%esi),%esi
+f010bba8:	89 e9                	mov    %ebp,%ecx
+f010bbaa:	89 c3                	mov    %eax,%ebx
+f010bbac:	89 d6                	mov    %edx,%esi
+f010bbae:	31 ff                	xor    %edi,%edi
+f010bbb0:	d3 ee                	shr    %cl,%esi
+f010bbb2:	0f ad d3             	shrd   %cl,%edx,%ebx
+f010bbb5:	f6 c1 20             	test   $0x20,%cl
+f010bbb8:	0f 45 de             	cmovne %esi,%ebx
+f010bbbb:	0f 45 f7             	cmovne %edi,%esi
+f010bbbe:	8b 3c 24             	mov    (%esp),%edi
+f010bbc1:	39 fb                	cmp    %edi,%ebx
+f010bbc3:	89 f7                	mov    %esi,%edi
+f010bbc5:	8b 74 24 04          	mov    0x4(%esp),%esi
+f010bbc9:	8b 1c 24             	mov    (%esp),%ebx
+f010bbcc:	19 f7                	sbb    %esi,%edi
+f010bbce:	72 39                	jb     f010bc09 <__udivmoddi4+0xa9>
+f010bbd0:	89 e9                	mov    %ebp,%ecx
+f010bbd2:	89 f7                	mov    %esi,%edi
+f010bbd4:	89 de                	mov    %ebx,%esi
+f010bbd6:	0f a5 df             	shld   %cl,%ebx,%edi
+f010bbd9:	d3 e6                	shl    %cl,%esi
+f010bbdb:	31 db                	xor    %ebx,%ebx
+f010bbdd:	f6 c1 20             	test   $0x20,%cl
+f010bbe0:	0f 45 fe             	cmovne %esi,%edi
+f010bbe3:	0f 45 f3             	cmovne %ebx,%esi
+f010bbe6:	29 f0                	sub    %esi,%eax
+f010bbe8:	be 01 00 00 00       	mov    $0x1,%esi
+f010bbed:	19 fa                	sbb    %edi,%edx
+f010bbef:	31 ff                	xor    %edi,%edi
+f010bbf1:	31 db                	xor    %ebx,%ebx
+f010bbf3:	0f a5 f7             	shld   %cl,%esi,%edi
+f010bbf6:	d3 e6                	shl    %cl,%esi
+f010bbf8:	f6 c1 20             	test   $0x20,%cl
+f010bbfb:	0f 45 fe             	cmovne %esi,%edi
+f010bbfe:	0f 45 f3             	cmovne %ebx,%esi
+f010bc01:	09 7c 24 0c          	or     %edi,0xc(%esp)
+f010bc05:	09 74 24 08          	or     %esi,0x8(%esp)
+f010bc09:	83 ed 01             	sub    $0x1,%ebp
+f010bc0c:	73 9a                	jae    f010bba8 <__udivmoddi4+0x48>
+f010bc0e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+f010bc12:	85 ff                	test   %edi,%edi
+f010bc14:	74 05                	je     f010bc1b <__udivmoddi4+0xbb>
+f010bc16:	89 07                	mov    %eax,(%edi)
+f010bc18:	89 57 04             	mov    %edx,0x4(%edi)
+f010bc1b:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010bc1f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010bc23:	83 c4 14             	add    $0x14,%esp
+f010bc26:	5b                   	pop    %ebx
+f010bc27:	5e                   	pop    %esi
+f010bc28:	5f                   	pop    %edi
+f010bc29:	5d                   	pop    %ebp
+f010bc2a:	c3                   	ret
+f010bc2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+f010bc2f:	90                   	nop
+
+f010bc30 <__udivdi3>:
+f010bc30:	55                   	push   %ebp
+f010bc31:	57                   	push   %edi
+f010bc32:	56                   	push   %esi
+f010bc33:	53                   	push   %ebx
+f010bc34:	83 ec 14             	sub    $0x14,%esp
+f010bc37:	8b 7c 24 34          	mov    0x34(%esp),%edi
+f010bc3b:	8b 74 24 30          	mov    0x30(%esp),%esi
+f010bc3f:	8b 44 24 28          	mov    0x28(%esp),%eax
+f010bc43:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f010bc47:	89 fb                	mov    %edi,%ebx
+f010bc49:	89 74 24 08          	mov    %esi,0x8(%esp)
+f010bc4d:	09 f3                	or     %esi,%ebx
+f010bc4f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+f010bc53:	0f 84 85 00 00 00    	je     f010bcde <__udivdi3+0xae>
+f010bc59:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+f010bc60:	00 
+f010bc61:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+f010bc66:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+f010bc6d:	00 
+f010bc6e:	89 34 24             	mov    %esi,(%esp)
+f010bc71:	89 7c 24 04          	mov    %edi,0x4(%esp)
+f010bc75:	8d 76 00             	lea    0x0(%esi),%esi
+f010bc78:	89 e9                	mov    %ebp,%ecx
+f010bc7a:	89 c3                	mov    %eax,%ebx
+f010bc7c:	89 d6                	mov    %edx,%esi
+f010bc7e:	31 ff                	xor    %edi,%edi
+f010bc80:	d3 ee                	shr    %cl,%esi
+f010bc82:	0f ad d3             	shrd   %cl,%edx,%ebx
+f010bc85:	f6 c1 20             	test   $0x20,%cl
+f010bc88:	0f 45 de             	cmovne %esi,%ebx
+f010bc8b:	0f 45 f7             	cmovne %edi,%esi
+f010bc8e:	8b 3c 24             	mov    (%esp),%edi
+f010bc91:	39 fb                	cmp    %edi,%ebx
+f010bc93:	89 f7                	mov    %esi,%edi
+f010bc95:	8b 74 24 04          	mov    0x4(%esp),%esi
+f010bc99:	8b 1c 24             	mov    (%esp),%ebx
+f010bc9c:	19 f7                	sbb    %esi,%edi
+f010bc9e:	72 39                	jb     f010bcd9 <__udivdi3+0xa9>
+f010bca0:	89 e9                	mov    %ebp,%ecx
+f010bca2:	89 f7                	mov    %esi,%edi
+f010bca4:	89 de                	mov    %ebx,%esi
+f010bca6:	0f a5 df             	shld   %cl,%ebx,%edi
+f010bca9:	d3 e6                	shl    %cl,%esi
+f010bcab:	31 db                	xor    %ebx,%ebx
+f010bcad:	f6 c1 20             	test   $0x20,%cl
+f010bcb0:	0f 45 fe             	cmovne %esi,%edi
+f010bcb3:	0f 45 f3             	cmovne %ebx,%esi
+f010bcb6:	29 f0                	sub    %esi,%eax
+f010bcb8:	be 01 00 00 00       	mov    $0x1,%esi
+f010bcbd:	19 fa                	sbb    %edi,%edx
+f010bcbf:	31 ff                	xor    %edi,%edi
+f010bcc1:	31 db                	xor    %ebx,%ebx
+f010bcc3:	0f a5 f7             	shld   %cl,%esi,%edi
+f010bcc6:	d3 e6                	shl    %cl,%esi
+f010bcc8:	f6 c1 20             	test   $0x20,%cl
+f010bccb:	0f 45 fe             	cmovne %esi,%edi
+f010bcce:	0f 45 f3             	cmovne %ebx,%esi
+f010bcd1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+f010bcd5:	09 74 24 08          	or     %esi,0x8(%esp)
+f010bcd9:	83 ed 01             	sub    $0x1,%ebp
+f010bcdc:	73 9a                	jae    f010bc78 <__udivdi3+0x48>
+f010bcde:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010bce2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010bce6:	83 c4 14             	add    $0x14,%esp
+f010bce9:	5b                   	pop    %ebx
+f010bcea:	5e                   	pop    %esi
+f010bceb:	5f                   	pop    %edi
+f010bcec:	5d                   	pop    %ebp
+f010bced:	c3                   	ret
+f010bcee:	66 90                	xchg   %ax,%ax
+
+f010bcf0 <__umoddi3>:
+f010bcf0:	57                   	push   %edi
+f010bcf1:	56                   	push   %esi
+f010bcf2:	53                   	push   %ebx
+f010bcf3:	83 ec 08             	sub    $0x8,%esp
+f010bcf6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+f010bcfa:	8b 74 24 20          	mov    0x20(%esp),%esi
+f010bcfe:	8b 44 24 18          	mov    0x18(%esp),%eax
+f010bd02:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010bd06:	89 f9                	mov    %edi,%ecx
+f010bd08:	89 34 24             	mov    %esi,(%esp)
+f010bd0b:	09 f1                	or     %esi,%ecx
+f010bd0d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+f010bd11:	74 53                	je     f010bd66 <__umoddi3+0x76>
+f010bd13:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f010bd18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+f010bd1f:	90                   	nop
+f010bd20:	89 c6                	mov    %eax,%esi
+f010bd22:	89 d7                	mov    %edx,%edi
+f010bd24:	31 db                	xor    %ebx,%ebx
+f010bd26:	d3 ef                	shr    %cl,%edi
+f010bd28:	0f ad d6             	shrd   %cl,%edx,%esi
+f010bd2b:	f6 c1 20             	test   $0x20,%cl
+f010bd2e:	0f 45 f7             	cmovne %edi,%esi
+f010bd31:	0f 45 fb             	cmovne %ebx,%edi
+f010bd34:	8b 1c 24             	mov    (%esp),%ebx
+f010bd37:	39 de                	cmp    %ebx,%esi
+f010bd39:	89 fb                	mov    %edi,%ebx
+f010bd3b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+f010bd3f:	8b 34 24             	mov    (%esp),%esi
+f010bd42:	19 fb                	sbb    %edi,%ebx
+f010bd44:	72 14                	jb     f010bd5a <__umoddi3+0x6a>
+f010bd46:	0f a5 f7             	shld   %cl,%esi,%edi
+f010bd49:	31 db                	xor    %ebx,%ebx
+f010bd4b:	d3 e6                	shl    %cl,%esi
+f010bd4d:	f6 c1 20             	test   $0x20,%cl
+f010bd50:	0f 45 fe             	cmovne %esi,%edi
+f010bd53:	0f 45 f3             	cmovne %ebx,%esi
+f010bd56:	29 f0                	sub    %esi,%eax
+f010bd58:	19 fa                	sbb    %edi,%edx
+f010bd5a:	83 e9 01             	sub    $0x1,%ecx
+f010bd5d:	73 c1                	jae    f010bd20 <__umoddi3+0x30>
+f010bd5f:	83 c4 08             	add    $0x8,%esp
+f010bd62:	5b                   	pop    %ebx
+f010bd63:	5e                   	pop    %esi
+f010bd64:	5f                   	pop    %edi
+f010bd65:	c3                   	ret
+f010bd66:	83 c4 08             	add    $0x8,%esp
+f010bd69:	31 c0                	xor    %eax,%eax
+f010bd6b:	31 d2                	xor    %edx,%edx
+f010bd6d:	5b                   	pop    %ebx
+f010bd6e:	5e                   	pop    %esi
+f010bd6f:	5f                   	pop    %edi
+f010bd70:	c3                   	ret
+f010bd71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+f010bd78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+f010bd7f:	90                   	nop
+
+f010bd80 <__divdi3>:
+f010bd80:	55                   	push   %ebp
+f010bd81:	57                   	push   %edi
+f010bd82:	56                   	push   %esi
+f010bd83:	53                   	push   %ebx
+f010bd84:	83 ec 1c             	sub    $0x1c,%esp
+f010bd87:	8b 7c 24 34          	mov    0x34(%esp),%edi
+f010bd8b:	8b 74 24 30          	mov    0x30(%esp),%esi
+f010bd8f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+f010bd93:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+f010bd97:	85 ff                	test   %edi,%edi
+f010bd99:	0f 88 da 00 00 00    	js     f010be79 <__divdi3+0xf9>
+f010bd9f:	85 db                	test   %ebx,%ebx
+f010bda1:	78 16                	js     f010bdb9 <__divdi3+0x39>
+f010bda3:	89 dd                	mov    %ebx,%ebp
+f010bda5:	89 c8                	mov    %ecx,%eax
+f010bda7:	89 da                	mov    %ebx,%edx
+f010bda9:	09 cd                	or     %ecx,%ebp
+f010bdab:	0f 85 fd 00 00 00    	jne    f010beae <__divdi3+0x12e>
+f010bdb1:	83 c4 1c             	add    $0x1c,%esp
+f010bdb4:	5b                   	pop    %ebx
+f010bdb5:	5e                   	pop    %esi
+f010bdb6:	5f                   	pop    %edi
+f010bdb7:	5d                   	pop    %ebp
+f010bdb8:	c3                   	ret
+f010bdb9:	bd 01 00 00 00       	mov    $0x1,%ebp
+f010bdbe:	f7 d9                	neg    %ecx
+f010bdc0:	89 f0                	mov    %esi,%eax
+f010bdc2:	89 fa                	mov    %edi,%edx
+f010bdc4:	83 d3 00             	adc    $0x0,%ebx
+f010bdc7:	89 0c 24             	mov    %ecx,(%esp)
+f010bdca:	f7 db                	neg    %ebx
+f010bdcc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+f010bdd0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+f010bdd7:	00 
+f010bdd8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f010bddd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+f010bde4:	00 
+f010bde5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+f010bde9:	89 cd                	mov    %ecx,%ebp
+f010bdeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+f010bdef:	90                   	nop
+f010bdf0:	89 e9                	mov    %ebp,%ecx
+f010bdf2:	89 c3                	mov    %eax,%ebx
+f010bdf4:	89 d6                	mov    %edx,%esi
+f010bdf6:	31 ff                	xor    %edi,%edi
+f010bdf8:	d3 ee                	shr    %cl,%esi
+f010bdfa:	0f ad d3             	shrd   %cl,%edx,%ebx
+f010bdfd:	f6 c1 20             	test   $0x20,%cl
+f010be00:	0f 45 de             	cmovne %esi,%ebx
+f010be03:	0f 45 f7             	cmovne %edi,%esi
+f010be06:	8b 3c 24             	mov    (%esp),%edi
+f010be09:	39 fb                	cmp    %edi,%ebx
+f010be0b:	89 f7                	mov    %esi,%edi
+f010be0d:	8b 74 24 04          	mov    0x4(%esp),%esi
+f010be11:	8b 1c 24             	mov    (%esp),%ebx
+f010be14:	19 f7                	sbb    %esi,%edi
+f010be16:	72 39                	jb     f010be51 <__divdi3+0xd1>
+f010be18:	89 e9                	mov    %ebp,%ecx
+f010be1a:	89 f7                	mov    %esi,%edi
+f010be1c:	89 de                	mov    %ebx,%esi
+f010be1e:	0f a5 df             	shld   %cl,%ebx,%edi
+f010be21:	d3 e6                	shl    %cl,%esi
+f010be23:	31 db                	xor    %ebx,%ebx
+f010be25:	f6 c1 20             	test   $0x20,%cl
+f010be28:	0f 45 fe             	cmovne %esi,%edi
+f010be2b:	0f 45 f3             	cmovne %ebx,%esi
+f010be2e:	29 f0                	sub    %esi,%eax
+f010be30:	be 01 00 00 00       	mov    $0x1,%esi
+f010be35:	19 fa                	sbb    %edi,%edx
+f010be37:	31 ff                	xor    %edi,%edi
+f010be39:	31 db                	xor    %ebx,%ebx
+f010be3b:	0f a5 f7             	shld   %cl,%esi,%edi
+f010be3e:	d3 e6                	shl    %cl,%esi
+f010be40:	f6 c1 20             	test   $0x20,%cl
+f010be43:	0f 45 fe             	cmovne %esi,%edi
+f010be46:	0f 45 f3             	cmovne %ebx,%esi
+f010be49:	09 7c 24 0c          	or     %edi,0xc(%esp)
+f010be4d:	09 74 24 08          	or     %esi,0x8(%esp)
+f010be51:	83 ed 01             	sub    $0x1,%ebp
+f010be54:	73 9a                	jae    f010bdf0 <__divdi3+0x70>
+f010be56:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+f010be5a:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010be5e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010be62:	85 ed                	test   %ebp,%ebp
+f010be64:	0f 84 47 ff ff ff    	je     f010bdb1 <__divdi3+0x31>
+f010be6a:	f7 d8                	neg    %eax
+f010be6c:	83 d2 00             	adc    $0x0,%edx
+f010be6f:	83 c4 1c             	add    $0x1c,%esp
+f010be72:	5b                   	pop    %ebx
+f010be73:	f7 da                	neg    %edx
+f010be75:	5e                   	pop    %esi
+f010be76:	5f                   	pop    %edi
+f010be77:	5d                   	pop    %ebp
+f010be78:	c3                   	ret
+f010be79:	f7 de                	neg    %esi
+f010be7b:	83 d7 00             	adc    $0x0,%edi
+f010be7e:	f7 df                	neg    %edi
+f010be80:	85 db                	test   %ebx,%ebx
+f010be82:	78 23                	js     f010bea7 <__divdi3+0x127>
+f010be84:	89 dd                	mov    %ebx,%ebp
+f010be86:	89 c8                	mov    %ecx,%eax
+f010be88:	89 da                	mov    %ebx,%edx
+f010be8a:	09 cd                	or     %ecx,%ebp
+f010be8c:	0f 84 1f ff ff ff    	je     f010bdb1 <__divdi3+0x31>
+f010be92:	89 0c 24             	mov    %ecx,(%esp)
+f010be95:	89 f0                	mov    %esi,%eax
+f010be97:	89 fa                	mov    %edi,%edx
+f010be99:	bd 01 00 00 00       	mov    $0x1,%ebp
+f010be9e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+f010bea2:	e9 29 ff ff ff       	jmp    f010bdd0 <__divdi3+0x50>
+f010bea7:	31 ed                	xor    %ebp,%ebp
+f010bea9:	e9 10 ff ff ff       	jmp    f010bdbe <__divdi3+0x3e>
+f010beae:	89 0c 24             	mov    %ecx,(%esp)
+f010beb1:	89 f0                	mov    %esi,%eax
+f010beb3:	89 fa                	mov    %edi,%edx
+f010beb5:	31 ed                	xor    %ebp,%ebp
+f010beb7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+f010bebb:	e9 10 ff ff ff       	jmp    f010bdd0 <__divdi3+0x50>
+
+f010bec0 <__moddi3>:
+f010bec0:	55                   	push   %ebp
+f010bec1:	57                   	push   %edi
+f010bec2:	56                   	push   %esi
+f010bec3:	53                   	push   %ebx
+f010bec4:	83 ec 14             	sub    $0x14,%esp
+f010bec7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f010becb:	8b 44 24 28          	mov    0x28(%esp),%eax
+f010becf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+f010bed3:	8b 74 24 34          	mov    0x34(%esp),%esi
+f010bed7:	85 d2                	test   %edx,%edx
+f010bed9:	0f 88 9b 00 00 00    	js     f010bf7a <__moddi3+0xba>
+f010bedf:	89 f7                	mov    %esi,%edi
+f010bee1:	31 ed                	xor    %ebp,%ebp
+f010bee3:	09 cf                	or     %ecx,%edi
+f010bee5:	0f 84 83 00 00 00    	je     f010bf6e <__moddi3+0xae>
+f010beeb:	89 cb                	mov    %ecx,%ebx
+f010beed:	89 f7                	mov    %esi,%edi
+f010beef:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+f010bef3:	f7 db                	neg    %ebx
+f010bef5:	83 d7 00             	adc    $0x0,%edi
+f010bef8:	f7 df                	neg    %edi
+f010befa:	0f 49 f7             	cmovns %edi,%esi
+f010befd:	0f 49 cb             	cmovns %ebx,%ecx
+f010bf00:	89 74 24 04          	mov    %esi,0x4(%esp)
+f010bf04:	89 0c 24             	mov    %ecx,(%esp)
+f010bf07:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f010bf0c:	89 cd                	mov    %ecx,%ebp
+f010bf0e:	66 90                	xchg   %ax,%ax
+f010bf10:	89 e9                	mov    %ebp,%ecx
+f010bf12:	89 c3                	mov    %eax,%ebx
+f010bf14:	89 d6                	mov    %edx,%esi
+f010bf16:	31 ff                	xor    %edi,%edi
+f010bf18:	d3 ee                	shr    %cl,%esi
+f010bf1a:	0f ad d3             	shrd   %cl,%edx,%ebx
+f010bf1d:	f6 c1 20             	test   $0x20,%cl
+f010bf20:	0f 45 de             	cmovne %esi,%ebx
+f010bf23:	0f 45 f7             	cmovne %edi,%esi
+f010bf26:	8b 3c 24             	mov    (%esp),%edi
+f010bf29:	39 fb                	cmp    %edi,%ebx
+f010bf2b:	89 f7                	mov    %esi,%edi
+f010bf2d:	8b 74 24 04          	mov    0x4(%esp),%esi
+f010bf31:	8b 1c 24             	mov    (%esp),%ebx
+f010bf34:	19 f7                	sbb    %esi,%edi
+f010bf36:	72 1a                	jb     f010bf52 <__moddi3+0x92>
+f010bf38:	89 e9                	mov    %ebp,%ecx
+f010bf3a:	89 f7                	mov    %esi,%edi
+f010bf3c:	89 de                	mov    %ebx,%esi
+f010bf3e:	0f a5 df             	shld   %cl,%ebx,%edi
+f010bf41:	d3 e6                	shl    %cl,%esi
+f010bf43:	31 db                	xor    %ebx,%ebx
+f010bf45:	f6 c1 20             	test   $0x20,%cl
+f010bf48:	0f 45 fe             	cmovne %esi,%edi
+f010bf4b:	0f 45 f3             	cmovne %ebx,%esi
+f010bf4e:	29 f0                	sub    %esi,%eax
+f010bf50:	19 fa                	sbb    %edi,%edx
+f010bf52:	83 ed 01             	sub    $0x1,%ebp
+f010bf55:	73 b9                	jae    f010bf10 <__moddi3+0x50>
+f010bf57:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+f010bf5b:	85 ed                	test   %ebp,%ebp
+f010bf5d:	74 07                	je     f010bf66 <__moddi3+0xa6>
+f010bf5f:	f7 d8                	neg    %eax
+f010bf61:	83 d2 00             	adc    $0x0,%edx
+f010bf64:	f7 da                	neg    %edx
+f010bf66:	83 c4 14             	add    $0x14,%esp
+f010bf69:	5b                   	pop    %ebx
+f010bf6a:	5e                   	pop    %esi
+f010bf6b:	5f                   	pop    %edi
+f010bf6c:	5d                   	pop    %ebp
+f010bf6d:	c3                   	ret
+f010bf6e:	83 c4 14             	add    $0x14,%esp
+f010bf71:	31 c0                	xor    %eax,%eax
+f010bf73:	31 d2                	xor    %edx,%edx
+f010bf75:	5b                   	pop    %ebx
+f010bf76:	5e                   	pop    %esi
+f010bf77:	5f                   	pop    %edi
+f010bf78:	5d                   	pop    %ebp
+f010bf79:	c3                   	ret
+f010bf7a:	89 f7                	mov    %esi,%edi
+f010bf7c:	09 cf                	or     %ecx,%edi
+f010bf7e:	74 11                	je     f010bf91 <__moddi3+0xd1>
+f010bf80:	f7 d8                	neg    %eax
+f010bf82:	bd 01 00 00 00       	mov    $0x1,%ebp
+f010bf87:	83 d2 00             	adc    $0x0,%edx
+f010bf8a:	f7 da                	neg    %edx
+f010bf8c:	e9 5a ff ff ff       	jmp    f010beeb <__moddi3+0x2b>
+f010bf91:	31 c0                	xor    %eax,%eax
+f010bf93:	31 d2                	xor    %edx,%edx
+f010bf95:	eb c8                	jmp    f010bf5f <__moddi3+0x9f>
@@ -0,0 +1,7005 @@
+
+obj/net/testinput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e4 07 00 00       	call   800815 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 7c             	sub    $0x7c,%esp
+	envid_t ns_envid = sys_getenvid();
+  80003c:	e8 cb 12 00 00       	call   80130c <sys_getenvid>
+  800041:	89 c3                	mov    %eax,%ebx
+	int i, r, first = 1;
+
+	binaryname = "testinput";
+  800043:	c7 05 00 40 80 00 40 	movl   $0x803240,0x804000
+  80004a:	32 80 00 
+
+	output_envid = fork();
+  80004d:	e8 59 18 00 00       	call   8018ab <fork>
+  800052:	a3 04 50 80 00       	mov    %eax,0x805004
+	if (output_envid < 0)
+  800057:	85 c0                	test   %eax,%eax
+  800059:	0f 88 7a 01 00 00    	js     8001d9 <umain+0x1a6>
+		panic("error forking");
+	else if (output_envid == 0) {
+  80005f:	0f 84 88 01 00 00    	je     8001ed <umain+0x1ba>
+		output(ns_envid);
+		return;
+	}
+
+	input_envid = fork();
+  800065:	e8 41 18 00 00       	call   8018ab <fork>
+  80006a:	a3 00 50 80 00       	mov    %eax,0x805000
+	if (input_envid < 0)
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	0f 88 8a 01 00 00    	js     800201 <umain+0x1ce>
+		panic("error forking");
+	else if (input_envid == 0) {
+  800077:	0f 84 98 01 00 00    	je     800215 <umain+0x1e2>
+		input(ns_envid);
+		return;
+	}
+
+	cprintf("Sending ARP announcement...\n");
+  80007d:	83 ec 0c             	sub    $0xc,%esp
+  800080:	68 68 32 80 00       	push   $0x803268
+  800085:	e8 c6 08 00 00       	call   800950 <cprintf>
+	uint8_t mac[6] = {0x52, 0x54, 0x00, 0x12, 0x34, 0x56};
+  80008a:	c7 45 98 52 54 00 12 	movl   $0x12005452,-0x68(%ebp)
+  800091:	66 c7 45 9c 34 56    	movw   $0x5634,-0x64(%ebp)
+	uint32_t myip = inet_addr(IP);
+  800097:	c7 04 24 85 32 80 00 	movl   $0x803285,(%esp)
+  80009e:	e8 38 07 00 00       	call   8007db <inet_addr>
+  8000a3:	89 45 90             	mov    %eax,-0x70(%ebp)
+	uint32_t gwip = inet_addr(DEFAULT);
+  8000a6:	c7 04 24 8f 32 80 00 	movl   $0x80328f,(%esp)
+  8000ad:	e8 29 07 00 00       	call   8007db <inet_addr>
+  8000b2:	89 45 94             	mov    %eax,-0x6c(%ebp)
+	if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  8000b5:	83 c4 0c             	add    $0xc,%esp
+  8000b8:	6a 07                	push   $0x7
+  8000ba:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000bf:	6a 00                	push   $0x0
+  8000c1:	e8 e5 12 00 00       	call   8013ab <sys_page_alloc>
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	85 c0                	test   %eax,%eax
+  8000cb:	0f 88 52 01 00 00    	js     800223 <umain+0x1f0>
+	pkt->jp_len = sizeof(*arp);
+  8000d1:	c7 05 00 b0 fe 0f 2a 	movl   $0x2a,0xffeb000
+  8000d8:	00 00 00 
+	memset(arp->ethhdr.dest.addr, 0xff, ETHARP_HWADDR_LEN);
+  8000db:	83 ec 04             	sub    $0x4,%esp
+  8000de:	6a 06                	push   $0x6
+  8000e0:	68 ff 00 00 00       	push   $0xff
+  8000e5:	68 04 b0 fe 0f       	push   $0xffeb004
+  8000ea:	e8 a0 0f 00 00       	call   80108f <memset>
+	memcpy(arp->ethhdr.src.addr,  mac,  ETHARP_HWADDR_LEN);
+  8000ef:	83 c4 0c             	add    $0xc,%esp
+  8000f2:	6a 06                	push   $0x6
+  8000f4:	8d 5d 98             	lea    -0x68(%ebp),%ebx
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 0a b0 fe 0f       	push   $0xffeb00a
+  8000fd:	e8 24 10 00 00       	call   801126 <memcpy>
+	arp->ethhdr.type = htons(ETHTYPE_ARP);
+  800102:	c7 04 24 06 08 00 00 	movl   $0x806,(%esp)
+  800109:	e8 af 04 00 00       	call   8005bd <htons>
+  80010e:	66 a3 10 b0 fe 0f    	mov    %ax,0xffeb010
+	arp->hwtype = htons(1); // Ethernet
+  800114:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80011b:	e8 9d 04 00 00       	call   8005bd <htons>
+  800120:	66 a3 12 b0 fe 0f    	mov    %ax,0xffeb012
+	arp->proto = htons(ETHTYPE_IP);
+  800126:	c7 04 24 00 08 00 00 	movl   $0x800,(%esp)
+  80012d:	e8 8b 04 00 00       	call   8005bd <htons>
+  800132:	66 a3 14 b0 fe 0f    	mov    %ax,0xffeb014
+	arp->_hwlen_protolen = htons((ETHARP_HWADDR_LEN << 8) | 4);
+  800138:	c7 04 24 04 06 00 00 	movl   $0x604,(%esp)
+  80013f:	e8 79 04 00 00       	call   8005bd <htons>
+  800144:	66 a3 16 b0 fe 0f    	mov    %ax,0xffeb016
+	arp->opcode = htons(ARP_REQUEST);
+  80014a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800151:	e8 67 04 00 00       	call   8005bd <htons>
+  800156:	66 a3 18 b0 fe 0f    	mov    %ax,0xffeb018
+	memcpy(arp->shwaddr.addr,  mac,   ETHARP_HWADDR_LEN);
+  80015c:	83 c4 0c             	add    $0xc,%esp
+  80015f:	6a 06                	push   $0x6
+  800161:	53                   	push   %ebx
+  800162:	68 1a b0 fe 0f       	push   $0xffeb01a
+  800167:	e8 ba 0f 00 00       	call   801126 <memcpy>
+	memcpy(arp->sipaddr.addrw, &myip, 4);
+  80016c:	83 c4 0c             	add    $0xc,%esp
+  80016f:	6a 04                	push   $0x4
+  800171:	8d 45 90             	lea    -0x70(%ebp),%eax
+  800174:	50                   	push   %eax
+  800175:	68 20 b0 fe 0f       	push   $0xffeb020
+  80017a:	e8 a7 0f 00 00       	call   801126 <memcpy>
+	memset(arp->dhwaddr.addr,  0x00,  ETHARP_HWADDR_LEN);
+  80017f:	83 c4 0c             	add    $0xc,%esp
+  800182:	6a 06                	push   $0x6
+  800184:	6a 00                	push   $0x0
+  800186:	68 24 b0 fe 0f       	push   $0xffeb024
+  80018b:	e8 ff 0e 00 00       	call   80108f <memset>
+	memcpy(arp->dipaddr.addrw, &gwip, 4);
+  800190:	83 c4 0c             	add    $0xc,%esp
+  800193:	6a 04                	push   $0x4
+  800195:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800198:	50                   	push   %eax
+  800199:	68 2a b0 fe 0f       	push   $0xffeb02a
+  80019e:	e8 83 0f 00 00       	call   801126 <memcpy>
+	ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8001a3:	6a 07                	push   $0x7
+  8001a5:	68 00 b0 fe 0f       	push   $0xffeb000
+  8001aa:	6a 0b                	push   $0xb
+  8001ac:	ff 35 04 50 80 00    	push   0x805004
+  8001b2:	e8 f3 19 00 00       	call   801baa <ipc_send>
+	sys_page_unmap(0, pkt);
+  8001b7:	83 c4 18             	add    $0x18,%esp
+  8001ba:	68 00 b0 fe 0f       	push   $0xffeb000
+  8001bf:	6a 00                	push   $0x0
+  8001c1:	e8 ad 12 00 00       	call   801473 <sys_page_unmap>
+}
+  8001c6:	83 c4 10             	add    $0x10,%esp
+	int i, r, first = 1;
+  8001c9:	bf 01 00 00 00       	mov    $0x1,%edi
+			out = buf + snprintf(buf, end - buf,
+  8001ce:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%ebp)
+}
+  8001d4:	e9 65 01 00 00       	jmp    80033e <umain+0x30b>
+		panic("error forking");
+  8001d9:	83 ec 04             	sub    $0x4,%esp
+  8001dc:	68 4a 32 80 00       	push   $0x80324a
+  8001e1:	6a 4d                	push   $0x4d
+  8001e3:	68 58 32 80 00       	push   $0x803258
+  8001e8:	e8 88 06 00 00       	call   800875 <_panic>
+		output(ns_envid);
+  8001ed:	83 ec 0c             	sub    $0xc,%esp
+  8001f0:	53                   	push   %ebx
+  8001f1:	e8 cb 02 00 00       	call   8004c1 <output>
+		return;
+  8001f6:	83 c4 10             	add    $0x10,%esp
+		// we've received the ARP reply
+		if (first)
+			cprintf("Waiting for packets...\n");
+		first = 0;
+	}
+}
+  8001f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fc:	5b                   	pop    %ebx
+  8001fd:	5e                   	pop    %esi
+  8001fe:	5f                   	pop    %edi
+  8001ff:	5d                   	pop    %ebp
+  800200:	c3                   	ret
+		panic("error forking");
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	68 4a 32 80 00       	push   $0x80324a
+  800209:	6a 55                	push   $0x55
+  80020b:	68 58 32 80 00       	push   $0x803258
+  800210:	e8 60 06 00 00       	call   800875 <_panic>
+		input(ns_envid);
+  800215:	83 ec 0c             	sub    $0xc,%esp
+  800218:	53                   	push   %ebx
+  800219:	e8 19 02 00 00       	call   800437 <input>
+		return;
+  80021e:	83 c4 10             	add    $0x10,%esp
+  800221:	eb d6                	jmp    8001f9 <umain+0x1c6>
+		panic("sys_page_map: %e", r);
+  800223:	50                   	push   %eax
+  800224:	68 98 32 80 00       	push   $0x803298
+  800229:	6a 19                	push   $0x19
+  80022b:	68 58 32 80 00       	push   $0x803258
+  800230:	e8 40 06 00 00       	call   800875 <_panic>
+			panic("ipc_recv: %e", req);
+  800235:	50                   	push   %eax
+  800236:	68 a9 32 80 00       	push   $0x8032a9
+  80023b:	6a 64                	push   $0x64
+  80023d:	68 58 32 80 00       	push   $0x803258
+  800242:	e8 2e 06 00 00       	call   800875 <_panic>
+			panic("IPC from unexpected environment %08x", whom);
+  800247:	52                   	push   %edx
+  800248:	68 00 33 80 00       	push   $0x803300
+  80024d:	6a 66                	push   $0x66
+  80024f:	68 58 32 80 00       	push   $0x803258
+  800254:	e8 1c 06 00 00       	call   800875 <_panic>
+			panic("Unexpected IPC %d", req);
+  800259:	50                   	push   %eax
+  80025a:	68 b6 32 80 00       	push   $0x8032b6
+  80025f:	6a 68                	push   $0x68
+  800261:	68 58 32 80 00       	push   $0x803258
+  800266:	e8 0a 06 00 00       	call   800875 <_panic>
+			out = buf + snprintf(buf, end - buf,
+  80026b:	83 ec 0c             	sub    $0xc,%esp
+  80026e:	53                   	push   %ebx
+  80026f:	68 c8 32 80 00       	push   $0x8032c8
+  800274:	68 d0 32 80 00       	push   $0x8032d0
+  800279:	6a 50                	push   $0x50
+  80027b:	8d 45 98             	lea    -0x68(%ebp),%eax
+  80027e:	50                   	push   %eax
+  80027f:	e8 65 0c 00 00       	call   800ee9 <snprintf>
+  800284:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  800287:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+  80028a:	83 c4 20             	add    $0x20,%esp
+  80028d:	eb 40                	jmp    8002cf <umain+0x29c>
+			cprintf("%.*s\n", out - buf, buf);
+  80028f:	83 ec 04             	sub    $0x4,%esp
+  800292:	8d 45 98             	lea    -0x68(%ebp),%eax
+  800295:	50                   	push   %eax
+  800296:	89 f0                	mov    %esi,%eax
+  800298:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  80029b:	29 c8                	sub    %ecx,%eax
+  80029d:	50                   	push   %eax
+  80029e:	68 df 32 80 00       	push   $0x8032df
+  8002a3:	e8 a8 06 00 00       	call   800950 <cprintf>
+  8002a8:	83 c4 10             	add    $0x10,%esp
+		if (i % 2 == 1)
+  8002ab:	89 da                	mov    %ebx,%edx
+  8002ad:	c1 ea 1f             	shr    $0x1f,%edx
+  8002b0:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  8002b3:	83 e0 01             	and    $0x1,%eax
+  8002b6:	29 d0                	sub    %edx,%eax
+  8002b8:	83 f8 01             	cmp    $0x1,%eax
+  8002bb:	74 4e                	je     80030b <umain+0x2d8>
+		if (i % 16 == 7)
+  8002bd:	83 ff 07             	cmp    $0x7,%edi
+  8002c0:	74 51                	je     800313 <umain+0x2e0>
+	for (i = 0; i < len; i++) {
+  8002c2:	83 c3 01             	add    $0x1,%ebx
+  8002c5:	39 5d 84             	cmp    %ebx,-0x7c(%ebp)
+  8002c8:	7e 51                	jle    80031b <umain+0x2e8>
+		if (i % 16 == 0)
+  8002ca:	f6 c3 0f             	test   $0xf,%bl
+  8002cd:	74 9c                	je     80026b <umain+0x238>
+		out += snprintf(out, end - out, "%02x", ((uint8_t*)data)[i]);
+  8002cf:	0f b6 83 04 b0 fe 0f 	movzbl 0xffeb004(%ebx),%eax
+  8002d6:	50                   	push   %eax
+  8002d7:	68 da 32 80 00       	push   $0x8032da
+  8002dc:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8002df:	29 f0                	sub    %esi,%eax
+  8002e1:	50                   	push   %eax
+  8002e2:	56                   	push   %esi
+  8002e3:	e8 01 0c 00 00       	call   800ee9 <snprintf>
+  8002e8:	01 c6                	add    %eax,%esi
+		if (i % 16 == 15 || i == len - 1)
+  8002ea:	89 d8                	mov    %ebx,%eax
+  8002ec:	c1 f8 1f             	sar    $0x1f,%eax
+  8002ef:	c1 e8 1c             	shr    $0x1c,%eax
+  8002f2:	8d 3c 03             	lea    (%ebx,%eax,1),%edi
+  8002f5:	83 e7 0f             	and    $0xf,%edi
+  8002f8:	29 c7                	sub    %eax,%edi
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	83 ff 0f             	cmp    $0xf,%edi
+  800300:	74 8d                	je     80028f <umain+0x25c>
+  800302:	8b 45 80             	mov    -0x80(%ebp),%eax
+  800305:	39 c3                	cmp    %eax,%ebx
+  800307:	75 a2                	jne    8002ab <umain+0x278>
+  800309:	eb 84                	jmp    80028f <umain+0x25c>
+			*(out++) = ' ';
+  80030b:	c6 06 20             	movb   $0x20,(%esi)
+  80030e:	8d 76 01             	lea    0x1(%esi),%esi
+  800311:	eb aa                	jmp    8002bd <umain+0x28a>
+			*(out++) = ' ';
+  800313:	c6 06 20             	movb   $0x20,(%esi)
+  800316:	8d 76 01             	lea    0x1(%esi),%esi
+  800319:	eb a7                	jmp    8002c2 <umain+0x28f>
+		cprintf("\n");
+  80031b:	83 ec 0c             	sub    $0xc,%esp
+  80031e:	68 fb 32 80 00       	push   $0x8032fb
+  800323:	e8 28 06 00 00       	call   800950 <cprintf>
+		if (first)
+  800328:	83 c4 10             	add    $0x10,%esp
+  80032b:	83 bd 7c ff ff ff 00 	cmpl   $0x0,-0x84(%ebp)
+  800332:	75 60                	jne    800394 <umain+0x361>
+		first = 0;
+  800334:	c7 85 7c ff ff ff 00 	movl   $0x0,-0x84(%ebp)
+  80033b:	00 00 00 
+		int32_t req = ipc_recv((int32_t *)&whom, pkt, &perm);
+  80033e:	83 ec 04             	sub    $0x4,%esp
+  800341:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800344:	50                   	push   %eax
+  800345:	68 00 b0 fe 0f       	push   $0xffeb000
+  80034a:	8d 45 90             	lea    -0x70(%ebp),%eax
+  80034d:	50                   	push   %eax
+  80034e:	e8 df 17 00 00       	call   801b32 <ipc_recv>
+		if (req < 0)
+  800353:	83 c4 10             	add    $0x10,%esp
+  800356:	85 c0                	test   %eax,%eax
+  800358:	0f 88 d7 fe ff ff    	js     800235 <umain+0x202>
+		if (whom != input_envid)
+  80035e:	8b 55 90             	mov    -0x70(%ebp),%edx
+  800361:	3b 15 00 50 80 00    	cmp    0x805000,%edx
+  800367:	0f 85 da fe ff ff    	jne    800247 <umain+0x214>
+		if (req != NSREQ_INPUT)
+  80036d:	83 f8 0a             	cmp    $0xa,%eax
+  800370:	0f 85 e3 fe ff ff    	jne    800259 <umain+0x226>
+		hexdump("input: ", pkt->jp_data, pkt->jp_len);
+  800376:	8b 0d 00 b0 fe 0f    	mov    0xffeb000,%ecx
+	char *out = NULL;
+  80037c:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < len; i++) {
+  800381:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (i % 16 == 15 || i == len - 1)
+  800386:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  800389:	89 45 80             	mov    %eax,-0x80(%ebp)
+  80038c:	89 4d 84             	mov    %ecx,-0x7c(%ebp)
+	for (i = 0; i < len; i++) {
+  80038f:	e9 31 ff ff ff       	jmp    8002c5 <umain+0x292>
+			cprintf("Waiting for packets...\n");
+  800394:	83 ec 0c             	sub    $0xc,%esp
+  800397:	68 e5 32 80 00       	push   $0x8032e5
+  80039c:	e8 af 05 00 00       	call   800950 <cprintf>
+  8003a1:	83 c4 10             	add    $0x10,%esp
+  8003a4:	eb 8e                	jmp    800334 <umain+0x301>
+
+008003a6 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  8003a6:	55                   	push   %ebp
+  8003a7:	89 e5                	mov    %esp,%ebp
+  8003a9:	57                   	push   %edi
+  8003aa:	56                   	push   %esi
+  8003ab:	53                   	push   %ebx
+  8003ac:	83 ec 1c             	sub    $0x1c,%esp
+  8003af:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	uint32_t stop = sys_time_msec() + initial_to;
+  8003b2:	e8 b8 13 00 00       	call   80176f <sys_time_msec>
+  8003b7:	03 45 0c             	add    0xc(%ebp),%eax
+  8003ba:	89 c3                	mov    %eax,%ebx
+
+	binaryname = "ns_timer";
+  8003bc:	c7 05 00 40 80 00 25 	movl   $0x803325,0x804000
+  8003c3:	33 80 00 
+
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+
+		while (1) {
+			uint32_t to, whom;
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  8003c6:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  8003c9:	eb 05                	jmp    8003d0 <timer+0x2a>
+			sys_yield();
+  8003cb:	e8 5b 0f 00 00       	call   80132b <sys_yield>
+		while((r = sys_time_msec()) < stop && r >= 0) {
+  8003d0:	e8 9a 13 00 00       	call   80176f <sys_time_msec>
+  8003d5:	39 d8                	cmp    %ebx,%eax
+  8003d7:	73 16                	jae    8003ef <timer+0x49>
+  8003d9:	85 c0                	test   %eax,%eax
+  8003db:	79 ee                	jns    8003cb <timer+0x25>
+			panic("sys_time_msec: %e", r);
+  8003dd:	50                   	push   %eax
+  8003de:	68 2e 33 80 00       	push   $0x80332e
+  8003e3:	6a 0f                	push   $0xf
+  8003e5:	68 40 33 80 00       	push   $0x803340
+  8003ea:	e8 86 04 00 00       	call   800875 <_panic>
+		if (r < 0)
+  8003ef:	85 c0                	test   %eax,%eax
+  8003f1:	78 ea                	js     8003dd <timer+0x37>
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  8003f3:	6a 00                	push   $0x0
+  8003f5:	6a 00                	push   $0x0
+  8003f7:	6a 0c                	push   $0xc
+  8003f9:	56                   	push   %esi
+  8003fa:	e8 ab 17 00 00       	call   801baa <ipc_send>
+  8003ff:	83 c4 10             	add    $0x10,%esp
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  800402:	83 ec 04             	sub    $0x4,%esp
+  800405:	6a 00                	push   $0x0
+  800407:	6a 00                	push   $0x0
+  800409:	57                   	push   %edi
+  80040a:	e8 23 17 00 00       	call   801b32 <ipc_recv>
+  80040f:	89 c3                	mov    %eax,%ebx
+
+			if (whom != ns_envid) {
+  800411:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800414:	83 c4 10             	add    $0x10,%esp
+  800417:	39 f0                	cmp    %esi,%eax
+  800419:	75 09                	jne    800424 <timer+0x7e>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+				continue;
+			}
+
+			stop = sys_time_msec() + to;
+  80041b:	e8 4f 13 00 00       	call   80176f <sys_time_msec>
+  800420:	01 c3                	add    %eax,%ebx
+			break;
+  800422:	eb ac                	jmp    8003d0 <timer+0x2a>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  800424:	83 ec 08             	sub    $0x8,%esp
+  800427:	50                   	push   %eax
+  800428:	68 4c 33 80 00       	push   $0x80334c
+  80042d:	e8 1e 05 00 00       	call   800950 <cprintf>
+				continue;
+  800432:	83 c4 10             	add    $0x10,%esp
+  800435:	eb cb                	jmp    800402 <timer+0x5c>
+
+00800437 <input>:
+
+extern union Nsipc nsipcbuf;
+
+void
+input(envid_t ns_envid)
+{
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+  80043a:	57                   	push   %edi
+  80043b:	56                   	push   %esi
+  80043c:	53                   	push   %ebx
+  80043d:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  800443:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	binaryname = "ns_input";
+  800446:	c7 05 00 40 80 00 87 	movl   $0x803387,0x804000
+  80044d:	33 80 00 
+	uint8_t buf[2048];
+	size_t size;
+	int perm = PTE_P|PTE_U|PTE_W;;
+
+	while (1) {
+		while (sys_net_try_receive(buf, &size) < 0) {
+  800450:	8d bd e4 f7 ff ff    	lea    -0x81c(%ebp),%edi
+  800456:	8d b5 e8 f7 ff ff    	lea    -0x818(%ebp),%esi
+  80045c:	eb 05                	jmp    800463 <input+0x2c>
+			sys_yield();
+  80045e:	e8 c8 0e 00 00       	call   80132b <sys_yield>
+		while (sys_net_try_receive(buf, &size) < 0) {
+  800463:	83 ec 08             	sub    $0x8,%esp
+  800466:	57                   	push   %edi
+  800467:	56                   	push   %esi
+  800468:	e8 42 13 00 00       	call   8017af <sys_net_try_receive>
+  80046d:	83 c4 10             	add    $0x10,%esp
+  800470:	85 c0                	test   %eax,%eax
+  800472:	78 ea                	js     80045e <input+0x27>
+		}
+
+		while (sys_page_alloc(0, &nsipcbuf, perm) < 0);
+  800474:	83 ec 04             	sub    $0x4,%esp
+  800477:	6a 07                	push   $0x7
+  800479:	68 00 70 80 00       	push   $0x807000
+  80047e:	6a 00                	push   $0x0
+  800480:	e8 26 0f 00 00       	call   8013ab <sys_page_alloc>
+  800485:	83 c4 10             	add    $0x10,%esp
+  800488:	85 c0                	test   %eax,%eax
+  80048a:	78 e8                	js     800474 <input+0x3d>
+
+		nsipcbuf.pkt.jp_len = size;
+  80048c:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+  800492:	a3 00 70 80 00       	mov    %eax,0x807000
+		memcpy(nsipcbuf.pkt.jp_data, buf, size);
+  800497:	83 ec 04             	sub    $0x4,%esp
+  80049a:	50                   	push   %eax
+  80049b:	56                   	push   %esi
+  80049c:	68 04 70 80 00       	push   $0x807004
+  8004a1:	e8 80 0c 00 00       	call   801126 <memcpy>
+
+		while (sys_ipc_try_send(ns_envid, NSREQ_INPUT, &nsipcbuf, perm) < 0);
+  8004a6:	83 c4 10             	add    $0x10,%esp
+  8004a9:	6a 07                	push   $0x7
+  8004ab:	68 00 70 80 00       	push   $0x807000
+  8004b0:	6a 0a                	push   $0xa
+  8004b2:	53                   	push   %ebx
+  8004b3:	e8 30 12 00 00       	call   8016e8 <sys_ipc_try_send>
+  8004b8:	83 c4 10             	add    $0x10,%esp
+  8004bb:	85 c0                	test   %eax,%eax
+  8004bd:	78 ea                	js     8004a9 <input+0x72>
+  8004bf:	eb a2                	jmp    800463 <input+0x2c>
+
+008004c1 <output>:
+
+extern union Nsipc nsipcbuf;
+
+void
+output(envid_t ns_envid)
+{
+  8004c1:	55                   	push   %ebp
+  8004c2:	89 e5                	mov    %esp,%ebp
+  8004c4:	53                   	push   %ebx
+  8004c5:	83 ec 04             	sub    $0x4,%esp
+  8004c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	binaryname = "ns_output";
+  8004cb:	c7 05 00 40 80 00 90 	movl   $0x803390,0x804000
+  8004d2:	33 80 00 
+
+	// LAB 6: Your code here:
+	// 	- read a packet from the network server
+	//	- send the packet to the device driver
+	while (1) {
+		sys_ipc_recv(&nsipcbuf);
+  8004d5:	83 ec 0c             	sub    $0xc,%esp
+  8004d8:	68 00 70 80 00       	push   $0x807000
+  8004dd:	e8 4c 12 00 00       	call   80172e <sys_ipc_recv>
+
+		if (thisenv->env_ipc_from != ns_envid || thisenv->env_ipc_value != NSREQ_OUTPUT)
+  8004e2:	a1 20 50 80 00       	mov    0x805020,%eax
+  8004e7:	8b 50 74             	mov    0x74(%eax),%edx
+  8004ea:	83 c4 10             	add    $0x10,%esp
+  8004ed:	39 da                	cmp    %ebx,%edx
+  8004ef:	75 e4                	jne    8004d5 <output+0x14>
+  8004f1:	8b 40 70             	mov    0x70(%eax),%eax
+  8004f4:	83 f8 0b             	cmp    $0xb,%eax
+  8004f7:	75 dc                	jne    8004d5 <output+0x14>
+			continue;
+
+		while (sys_net_try_send(nsipcbuf.pkt.jp_data, nsipcbuf.pkt.jp_len) < 0);
+  8004f9:	83 ec 08             	sub    $0x8,%esp
+  8004fc:	ff 35 00 70 80 00    	push   0x807000
+  800502:	68 04 70 80 00       	push   $0x807004
+  800507:	e8 82 12 00 00       	call   80178e <sys_net_try_send>
+  80050c:	83 c4 10             	add    $0x10,%esp
+  80050f:	85 c0                	test   %eax,%eax
+  800511:	78 e6                	js     8004f9 <output+0x38>
+  800513:	eb c0                	jmp    8004d5 <output+0x14>
+
+00800515 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  800515:	55                   	push   %ebp
+  800516:	89 e5                	mov    %esp,%ebp
+  800518:	57                   	push   %edi
+  800519:	56                   	push   %esi
+  80051a:	53                   	push   %ebx
+  80051b:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  80051e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800521:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  800524:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  800527:	b9 08 50 80 00       	mov    $0x805008,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  80052c:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  800531:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800534:	eb 31                	jmp    800567 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  800536:	0f b6 c8             	movzbl %al,%ecx
+  800539:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  80053e:	88 0a                	mov    %cl,(%edx)
+  800540:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  800543:	83 e8 01             	sub    $0x1,%eax
+  800546:	3c ff                	cmp    $0xff,%al
+  800548:	75 ec                	jne    800536 <inet_ntoa+0x21>
+  80054a:	0f b6 db             	movzbl %bl,%ebx
+  80054d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800550:	01 d8                	add    %ebx,%eax
+  800552:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  800554:	8d 40 01             	lea    0x1(%eax),%eax
+  800557:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80055a:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  80055d:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  800560:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800563:	39 c7                	cmp    %eax,%edi
+  800565:	74 46                	je     8005ad <inet_ntoa+0x98>
+  800567:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  80056a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80056f:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  800572:	89 f0                	mov    %esi,%eax
+  800574:	f6 e2                	mul    %dl
+  800576:	66 c1 e8 0b          	shr    $0xb,%ax
+  80057a:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  80057d:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  800580:	01 c9                	add    %ecx,%ecx
+  800582:	89 d0                	mov    %edx,%eax
+  800584:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800586:	89 d7                	mov    %edx,%edi
+  800588:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80058c:	89 d9                	mov    %ebx,%ecx
+  80058e:	83 c3 01             	add    $0x1,%ebx
+  800591:	0f b6 c9             	movzbl %cl,%ecx
+  800594:	83 c0 30             	add    $0x30,%eax
+  800597:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  80059b:	89 f8                	mov    %edi,%eax
+  80059d:	3c 09                	cmp    $0x9,%al
+  80059f:	77 d1                	ja     800572 <inet_ntoa+0x5d>
+  8005a1:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8005a4:	88 17                	mov    %dl,(%edi)
+  8005a6:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  8005a9:	89 d8                	mov    %ebx,%eax
+  8005ab:	eb 96                	jmp    800543 <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  8005ad:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  8005b0:	b8 08 50 80 00       	mov    $0x805008,%eax
+  8005b5:	83 c4 1c             	add    $0x1c,%esp
+  8005b8:	5b                   	pop    %ebx
+  8005b9:	5e                   	pop    %esi
+  8005ba:	5f                   	pop    %edi
+  8005bb:	5d                   	pop    %ebp
+  8005bc:	c3                   	ret
+
+008005bd <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  8005bd:	55                   	push   %ebp
+  8005be:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8005c0:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8005c4:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  8005c8:	5d                   	pop    %ebp
+  8005c9:	c3                   	ret
+
+008005ca <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  8005ca:	55                   	push   %ebp
+  8005cb:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8005cd:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8005d1:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  8005d5:	5d                   	pop    %ebp
+  8005d6:	c3                   	ret
+
+008005d7 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  8005d7:	55                   	push   %ebp
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  8005dd:	89 d0                	mov    %edx,%eax
+  8005df:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8005e2:	89 d1                	mov    %edx,%ecx
+  8005e4:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8005e7:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8005e9:	89 d1                	mov    %edx,%ecx
+  8005eb:	c1 e1 08             	shl    $0x8,%ecx
+  8005ee:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8005f4:	09 c8                	or     %ecx,%eax
+  8005f6:	c1 ea 08             	shr    $0x8,%edx
+  8005f9:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8005ff:	09 d0                	or     %edx,%eax
+}
+  800601:	5d                   	pop    %ebp
+  800602:	c3                   	ret
+
+00800603 <inet_aton>:
+{
+  800603:	55                   	push   %ebp
+  800604:	89 e5                	mov    %esp,%ebp
+  800606:	57                   	push   %edi
+  800607:	56                   	push   %esi
+  800608:	53                   	push   %ebx
+  800609:	83 ec 2c             	sub    $0x2c,%esp
+  80060c:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  80060f:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  800612:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  800615:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  800618:	e9 9b 00 00 00       	jmp    8006b8 <inet_aton+0xb5>
+      c = *++cp;
+  80061d:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  800621:	89 c1                	mov    %eax,%ecx
+  800623:	83 e1 df             	and    $0xffffffdf,%ecx
+  800626:	80 f9 58             	cmp    $0x58,%cl
+  800629:	74 10                	je     80063b <inet_aton+0x38>
+      c = *++cp;
+  80062b:	83 c2 01             	add    $0x1,%edx
+  80062e:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  800631:	bf 08 00 00 00       	mov    $0x8,%edi
+  800636:	e9 97 00 00 00       	jmp    8006d2 <inet_aton+0xcf>
+        c = *++cp;
+  80063b:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  80063f:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  800642:	bf 10 00 00 00       	mov    $0x10,%edi
+  800647:	e9 86 00 00 00       	jmp    8006d2 <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  80064c:	0f af d7             	imul   %edi,%edx
+  80064f:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  800653:	0f be 01             	movsbl (%ecx),%eax
+  800656:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800659:	88 45 d7             	mov    %al,-0x29(%ebp)
+  80065c:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  80065f:	80 fb 09             	cmp    $0x9,%bl
+  800662:	76 e8                	jbe    80064c <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  800664:	83 ff 10             	cmp    $0x10,%edi
+  800667:	75 2e                	jne    800697 <inet_aton+0x94>
+  800669:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  80066d:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  800670:	83 e3 df             	and    $0xffffffdf,%ebx
+  800673:	83 eb 41             	sub    $0x41,%ebx
+  800676:	80 fb 05             	cmp    $0x5,%bl
+  800679:	77 1c                	ja     800697 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  80067b:	c1 e2 04             	shl    $0x4,%edx
+  80067e:	83 c0 0a             	add    $0xa,%eax
+  800681:	89 f3                	mov    %esi,%ebx
+  800683:	80 fb 1a             	cmp    $0x1a,%bl
+  800686:	19 db                	sbb    %ebx,%ebx
+  800688:	83 e3 20             	and    $0x20,%ebx
+  80068b:	83 c3 41             	add    $0x41,%ebx
+  80068e:	29 d8                	sub    %ebx,%eax
+  800690:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  800692:	0f be 01             	movsbl (%ecx),%eax
+  800695:	eb bf                	jmp    800656 <inet_aton+0x53>
+    if (c == '.') {
+  800697:	83 f8 2e             	cmp    $0x2e,%eax
+  80069a:	75 43                	jne    8006df <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  80069c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80069f:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8006a2:	39 f0                	cmp    %esi,%eax
+  8006a4:	0f 84 22 01 00 00    	je     8007cc <inet_aton+0x1c9>
+      *pp++ = val;
+  8006aa:	83 c0 04             	add    $0x4,%eax
+  8006ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006b0:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  8006b3:	89 ca                	mov    %ecx,%edx
+  8006b5:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  8006b8:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8006bb:	80 f9 09             	cmp    $0x9,%cl
+  8006be:	0f 87 01 01 00 00    	ja     8007c5 <inet_aton+0x1c2>
+    base = 10;
+  8006c4:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  8006c9:	83 f8 30             	cmp    $0x30,%eax
+  8006cc:	0f 84 4b ff ff ff    	je     80061d <inet_aton+0x1a>
+  8006d2:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  8006d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006da:	e9 7a ff ff ff       	jmp    800659 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8006df:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8006e3:	89 d6                	mov    %edx,%esi
+  8006e5:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8006e8:	85 c0                	test   %eax,%eax
+  8006ea:	74 2e                	je     80071a <inet_aton+0x117>
+    return (0);
+  8006ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8006f1:	89 fa                	mov    %edi,%edx
+  8006f3:	80 fa 1f             	cmp    $0x1f,%dl
+  8006f6:	0f 86 d5 00 00 00    	jbe    8007d1 <inet_aton+0x1ce>
+  8006fc:	84 c0                	test   %al,%al
+  8006fe:	0f 88 cd 00 00 00    	js     8007d1 <inet_aton+0x1ce>
+  800704:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  800707:	83 f9 04             	cmp    $0x4,%ecx
+  80070a:	76 0e                	jbe    80071a <inet_aton+0x117>
+    return (0);
+  80070c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  800711:	83 f8 20             	cmp    $0x20,%eax
+  800714:	0f 85 b7 00 00 00    	jne    8007d1 <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  80071a:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  80071d:	89 d8                	mov    %ebx,%eax
+  80071f:	29 c8                	sub    %ecx,%eax
+  800721:	c1 f8 02             	sar    $0x2,%eax
+  800724:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  800727:	83 f8 02             	cmp    $0x2,%eax
+  80072a:	74 7a                	je     8007a6 <inet_aton+0x1a3>
+  80072c:	83 f9 03             	cmp    $0x3,%ecx
+  80072f:	7f 49                	jg     80077a <inet_aton+0x177>
+  800731:	85 c9                	test   %ecx,%ecx
+  800733:	0f 84 98 00 00 00    	je     8007d1 <inet_aton+0x1ce>
+  800739:	83 f9 02             	cmp    $0x2,%ecx
+  80073c:	75 19                	jne    800757 <inet_aton+0x154>
+      return (0);
+  80073e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  800743:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  800749:	0f 87 82 00 00 00    	ja     8007d1 <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  80074f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800752:	c1 e0 18             	shl    $0x18,%eax
+  800755:	09 c6                	or     %eax,%esi
+  return (1);
+  800757:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  80075c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800760:	74 6f                	je     8007d1 <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  800762:	83 ec 0c             	sub    $0xc,%esp
+  800765:	56                   	push   %esi
+  800766:	e8 6c fe ff ff       	call   8005d7 <htonl>
+  80076b:	83 c4 10             	add    $0x10,%esp
+  80076e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800771:	89 06                	mov    %eax,(%esi)
+  return (1);
+  800773:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800778:	eb 57                	jmp    8007d1 <inet_aton+0x1ce>
+  switch (n) {
+  80077a:	83 f9 04             	cmp    $0x4,%ecx
+  80077d:	75 d8                	jne    800757 <inet_aton+0x154>
+      return (0);
+  80077f:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  800784:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  80078a:	77 45                	ja     8007d1 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  80078c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80078f:	c1 e0 18             	shl    $0x18,%eax
+  800792:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800795:	c1 e1 10             	shl    $0x10,%ecx
+  800798:	09 c8                	or     %ecx,%eax
+  80079a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80079d:	c1 e1 08             	shl    $0x8,%ecx
+  8007a0:	09 c8                	or     %ecx,%eax
+  8007a2:	09 c6                	or     %eax,%esi
+    break;
+  8007a4:	eb b1                	jmp    800757 <inet_aton+0x154>
+      return (0);
+  8007a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  8007ab:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  8007b1:	77 1e                	ja     8007d1 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  8007b3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8007b6:	c1 e0 18             	shl    $0x18,%eax
+  8007b9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007bc:	c1 e1 10             	shl    $0x10,%ecx
+  8007bf:	09 c8                	or     %ecx,%eax
+  8007c1:	09 c6                	or     %eax,%esi
+    break;
+  8007c3:	eb 92                	jmp    800757 <inet_aton+0x154>
+      return (0);
+  8007c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ca:	eb 05                	jmp    8007d1 <inet_aton+0x1ce>
+        return (0);
+  8007cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  8007d1:	89 c8                	mov    %ecx,%eax
+  8007d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d6:	5b                   	pop    %ebx
+  8007d7:	5e                   	pop    %esi
+  8007d8:	5f                   	pop    %edi
+  8007d9:	5d                   	pop    %ebp
+  8007da:	c3                   	ret
+
+008007db <inet_addr>:
+{
+  8007db:	55                   	push   %ebp
+  8007dc:	89 e5                	mov    %esp,%ebp
+  8007de:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8007e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007e4:	50                   	push   %eax
+  8007e5:	ff 75 08             	push   0x8(%ebp)
+  8007e8:	e8 16 fe ff ff       	call   800603 <inet_aton>
+  8007ed:	89 c2                	mov    %eax,%edx
+  8007ef:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8007f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8007f7:	85 d2                	test   %edx,%edx
+  8007f9:	75 02                	jne    8007fd <inet_addr+0x22>
+}
+  8007fb:	c9                   	leave
+  8007fc:	c3                   	ret
+    return (val.s_addr);
+  8007fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800800:	eb f9                	jmp    8007fb <inet_addr+0x20>
+
+00800802 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  800802:	55                   	push   %ebp
+  800803:	89 e5                	mov    %esp,%ebp
+  800805:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  800808:	ff 75 08             	push   0x8(%ebp)
+  80080b:	e8 c7 fd ff ff       	call   8005d7 <htonl>
+  800810:	83 c4 10             	add    $0x10,%esp
+}
+  800813:	c9                   	leave
+  800814:	c3                   	ret
+
+00800815 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800815:	55                   	push   %ebp
+  800816:	89 e5                	mov    %esp,%ebp
+  800818:	56                   	push   %esi
+  800819:	53                   	push   %ebx
+  80081a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80081d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800820:	e8 e7 0a 00 00       	call   80130c <sys_getenvid>
+  800825:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80082a:	c1 e0 09             	shl    $0x9,%eax
+  80082d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800832:	a3 20 50 80 00       	mov    %eax,0x805020
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800837:	85 db                	test   %ebx,%ebx
+  800839:	7e 07                	jle    800842 <libmain+0x2d>
+		binaryname = argv[0];
+  80083b:	8b 06                	mov    (%esi),%eax
+  80083d:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800842:	83 ec 08             	sub    $0x8,%esp
+  800845:	56                   	push   %esi
+  800846:	53                   	push   %ebx
+  800847:	e8 e7 f7 ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80084c:	e8 0a 00 00 00       	call   80085b <exit>
+}
+  800851:	83 c4 10             	add    $0x10,%esp
+  800854:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800857:	5b                   	pop    %ebx
+  800858:	5e                   	pop    %esi
+  800859:	5d                   	pop    %ebp
+  80085a:	c3                   	ret
+
+0080085b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80085b:	55                   	push   %ebp
+  80085c:	89 e5                	mov    %esp,%ebp
+  80085e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800861:	e8 7c 15 00 00       	call   801de2 <close_all>
+	sys_env_destroy(0);
+  800866:	83 ec 0c             	sub    $0xc,%esp
+  800869:	6a 00                	push   $0x0
+  80086b:	e8 5b 0a 00 00       	call   8012cb <sys_env_destroy>
+}
+  800870:	83 c4 10             	add    $0x10,%esp
+  800873:	c9                   	leave
+  800874:	c3                   	ret
+
+00800875 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800875:	55                   	push   %ebp
+  800876:	89 e5                	mov    %esp,%ebp
+  800878:	56                   	push   %esi
+  800879:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80087a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80087d:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800883:	e8 84 0a 00 00       	call   80130c <sys_getenvid>
+  800888:	83 ec 0c             	sub    $0xc,%esp
+  80088b:	ff 75 0c             	push   0xc(%ebp)
+  80088e:	ff 75 08             	push   0x8(%ebp)
+  800891:	56                   	push   %esi
+  800892:	50                   	push   %eax
+  800893:	68 a4 33 80 00       	push   $0x8033a4
+  800898:	e8 b3 00 00 00       	call   800950 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80089d:	83 c4 18             	add    $0x18,%esp
+  8008a0:	53                   	push   %ebx
+  8008a1:	ff 75 10             	push   0x10(%ebp)
+  8008a4:	e8 56 00 00 00       	call   8008ff <vcprintf>
+	cprintf("\n");
+  8008a9:	c7 04 24 fb 32 80 00 	movl   $0x8032fb,(%esp)
+  8008b0:	e8 9b 00 00 00       	call   800950 <cprintf>
+  8008b5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8008b8:	cc                   	int3
+	while (1)
+  8008b9:	eb fd                	jmp    8008b8 <_panic+0x43>
+
+008008bb <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8008bb:	55                   	push   %ebp
+  8008bc:	89 e5                	mov    %esp,%ebp
+  8008be:	53                   	push   %ebx
+  8008bf:	83 ec 04             	sub    $0x4,%esp
+  8008c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8008c5:	8b 13                	mov    (%ebx),%edx
+  8008c7:	8d 42 01             	lea    0x1(%edx),%eax
+  8008ca:	89 03                	mov    %eax,(%ebx)
+  8008cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008cf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8008d3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8008d8:	74 09                	je     8008e3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8008da:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8008de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e1:	c9                   	leave
+  8008e2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8008e3:	83 ec 08             	sub    $0x8,%esp
+  8008e6:	68 ff 00 00 00       	push   $0xff
+  8008eb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8008ee:	50                   	push   %eax
+  8008ef:	e8 7a 09 00 00       	call   80126e <sys_cputs>
+		b->idx = 0;
+  8008f4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8008fa:	83 c4 10             	add    $0x10,%esp
+  8008fd:	eb db                	jmp    8008da <putch+0x1f>
+
+008008ff <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8008ff:	55                   	push   %ebp
+  800900:	89 e5                	mov    %esp,%ebp
+  800902:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800908:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80090f:	00 00 00 
+	b.cnt = 0;
+  800912:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800919:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80091c:	ff 75 0c             	push   0xc(%ebp)
+  80091f:	ff 75 08             	push   0x8(%ebp)
+  800922:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800928:	50                   	push   %eax
+  800929:	68 bb 08 80 00       	push   $0x8008bb
+  80092e:	e8 14 01 00 00       	call   800a47 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800933:	83 c4 08             	add    $0x8,%esp
+  800936:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80093c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800942:	50                   	push   %eax
+  800943:	e8 26 09 00 00       	call   80126e <sys_cputs>
+
+	return b.cnt;
+}
+  800948:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80094e:	c9                   	leave
+  80094f:	c3                   	ret
+
+00800950 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800950:	55                   	push   %ebp
+  800951:	89 e5                	mov    %esp,%ebp
+  800953:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800956:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800959:	50                   	push   %eax
+  80095a:	ff 75 08             	push   0x8(%ebp)
+  80095d:	e8 9d ff ff ff       	call   8008ff <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800962:	c9                   	leave
+  800963:	c3                   	ret
+
+00800964 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	57                   	push   %edi
+  800968:	56                   	push   %esi
+  800969:	53                   	push   %ebx
+  80096a:	83 ec 1c             	sub    $0x1c,%esp
+  80096d:	89 c7                	mov    %eax,%edi
+  80096f:	89 d6                	mov    %edx,%esi
+  800971:	8b 45 08             	mov    0x8(%ebp),%eax
+  800974:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800977:	89 d1                	mov    %edx,%ecx
+  800979:	89 c2                	mov    %eax,%edx
+  80097b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80097e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800981:	8b 45 10             	mov    0x10(%ebp),%eax
+  800984:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800987:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80098a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800991:	39 c2                	cmp    %eax,%edx
+  800993:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800996:	72 3e                	jb     8009d6 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800998:	83 ec 0c             	sub    $0xc,%esp
+  80099b:	ff 75 18             	push   0x18(%ebp)
+  80099e:	83 eb 01             	sub    $0x1,%ebx
+  8009a1:	53                   	push   %ebx
+  8009a2:	50                   	push   %eax
+  8009a3:	83 ec 08             	sub    $0x8,%esp
+  8009a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8009a9:	ff 75 e0             	push   -0x20(%ebp)
+  8009ac:	ff 75 dc             	push   -0x24(%ebp)
+  8009af:	ff 75 d8             	push   -0x28(%ebp)
+  8009b2:	e8 19 25 00 00       	call   802ed0 <__udivdi3>
+  8009b7:	83 c4 18             	add    $0x18,%esp
+  8009ba:	52                   	push   %edx
+  8009bb:	50                   	push   %eax
+  8009bc:	89 f2                	mov    %esi,%edx
+  8009be:	89 f8                	mov    %edi,%eax
+  8009c0:	e8 9f ff ff ff       	call   800964 <printnum>
+  8009c5:	83 c4 20             	add    $0x20,%esp
+  8009c8:	eb 13                	jmp    8009dd <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8009ca:	83 ec 08             	sub    $0x8,%esp
+  8009cd:	56                   	push   %esi
+  8009ce:	ff 75 18             	push   0x18(%ebp)
+  8009d1:	ff d7                	call   *%edi
+  8009d3:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8009d6:	83 eb 01             	sub    $0x1,%ebx
+  8009d9:	85 db                	test   %ebx,%ebx
+  8009db:	7f ed                	jg     8009ca <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8009dd:	83 ec 08             	sub    $0x8,%esp
+  8009e0:	56                   	push   %esi
+  8009e1:	83 ec 04             	sub    $0x4,%esp
+  8009e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8009e7:	ff 75 e0             	push   -0x20(%ebp)
+  8009ea:	ff 75 dc             	push   -0x24(%ebp)
+  8009ed:	ff 75 d8             	push   -0x28(%ebp)
+  8009f0:	e8 9b 25 00 00       	call   802f90 <__umoddi3>
+  8009f5:	83 c4 14             	add    $0x14,%esp
+  8009f8:	0f be 80 c7 33 80 00 	movsbl 0x8033c7(%eax),%eax
+  8009ff:	50                   	push   %eax
+  800a00:	ff d7                	call   *%edi
+}
+  800a02:	83 c4 10             	add    $0x10,%esp
+  800a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a08:	5b                   	pop    %ebx
+  800a09:	5e                   	pop    %esi
+  800a0a:	5f                   	pop    %edi
+  800a0b:	5d                   	pop    %ebp
+  800a0c:	c3                   	ret
+
+00800a0d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800a0d:	55                   	push   %ebp
+  800a0e:	89 e5                	mov    %esp,%ebp
+  800a10:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800a13:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800a17:	8b 10                	mov    (%eax),%edx
+  800a19:	3b 50 04             	cmp    0x4(%eax),%edx
+  800a1c:	73 0a                	jae    800a28 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800a1e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800a21:	89 08                	mov    %ecx,(%eax)
+  800a23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a26:	88 02                	mov    %al,(%edx)
+}
+  800a28:	5d                   	pop    %ebp
+  800a29:	c3                   	ret
+
+00800a2a <printfmt>:
+{
+  800a2a:	55                   	push   %ebp
+  800a2b:	89 e5                	mov    %esp,%ebp
+  800a2d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800a30:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800a33:	50                   	push   %eax
+  800a34:	ff 75 10             	push   0x10(%ebp)
+  800a37:	ff 75 0c             	push   0xc(%ebp)
+  800a3a:	ff 75 08             	push   0x8(%ebp)
+  800a3d:	e8 05 00 00 00       	call   800a47 <vprintfmt>
+}
+  800a42:	83 c4 10             	add    $0x10,%esp
+  800a45:	c9                   	leave
+  800a46:	c3                   	ret
+
+00800a47 <vprintfmt>:
+{
+  800a47:	55                   	push   %ebp
+  800a48:	89 e5                	mov    %esp,%ebp
+  800a4a:	57                   	push   %edi
+  800a4b:	56                   	push   %esi
+  800a4c:	53                   	push   %ebx
+  800a4d:	83 ec 2c             	sub    $0x2c,%esp
+  800a50:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a56:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800a59:	eb 0a                	jmp    800a65 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800a5b:	83 ec 08             	sub    $0x8,%esp
+  800a5e:	53                   	push   %ebx
+  800a5f:	50                   	push   %eax
+  800a60:	ff d6                	call   *%esi
+  800a62:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a65:	83 c7 01             	add    $0x1,%edi
+  800a68:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800a6c:	83 f8 25             	cmp    $0x25,%eax
+  800a6f:	74 0c                	je     800a7d <vprintfmt+0x36>
+			if (ch == '\0')
+  800a71:	85 c0                	test   %eax,%eax
+  800a73:	75 e6                	jne    800a5b <vprintfmt+0x14>
+}
+  800a75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a78:	5b                   	pop    %ebx
+  800a79:	5e                   	pop    %esi
+  800a7a:	5f                   	pop    %edi
+  800a7b:	5d                   	pop    %ebp
+  800a7c:	c3                   	ret
+		padc = ' ';
+  800a7d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800a81:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800a88:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800a8f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800a96:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800a9b:	8d 47 01             	lea    0x1(%edi),%eax
+  800a9e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800aa1:	0f b6 17             	movzbl (%edi),%edx
+  800aa4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800aa7:	3c 55                	cmp    $0x55,%al
+  800aa9:	0f 87 cf 03 00 00    	ja     800e7e <vprintfmt+0x437>
+  800aaf:	0f b6 c0             	movzbl %al,%eax
+  800ab2:	ff 24 85 00 35 80 00 	jmp    *0x803500(,%eax,4)
+  800ab9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800abc:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800ac0:	eb d9                	jmp    800a9b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800ac2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800ac5:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800ac9:	eb d0                	jmp    800a9b <vprintfmt+0x54>
+  800acb:	0f b6 d2             	movzbl %dl,%edx
+  800ace:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800ad9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800adc:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800ae0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800ae3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800ae6:	83 f9 09             	cmp    $0x9,%ecx
+  800ae9:	77 55                	ja     800b40 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800aeb:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800aee:	eb e9                	jmp    800ad9 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800af0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af3:	8b 00                	mov    (%eax),%eax
+  800af5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800af8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afb:	8d 40 04             	lea    0x4(%eax),%eax
+  800afe:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800b01:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800b04:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800b08:	79 91                	jns    800a9b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800b0a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800b0d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b10:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800b17:	eb 82                	jmp    800a9b <vprintfmt+0x54>
+			if (width < 0)
+  800b19:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800b1c:	85 d2                	test   %edx,%edx
+  800b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b23:	0f 49 c2             	cmovns %edx,%eax
+  800b26:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800b29:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b2c:	e9 6a ff ff ff       	jmp    800a9b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800b31:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800b34:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800b3b:	e9 5b ff ff ff       	jmp    800a9b <vprintfmt+0x54>
+  800b40:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800b43:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800b46:	eb bc                	jmp    800b04 <vprintfmt+0xbd>
+			lflag++;
+  800b48:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800b4b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b4e:	e9 48 ff ff ff       	jmp    800a9b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800b53:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b56:	8d 78 04             	lea    0x4(%eax),%edi
+  800b59:	83 ec 08             	sub    $0x8,%esp
+  800b5c:	53                   	push   %ebx
+  800b5d:	ff 30                	push   (%eax)
+  800b5f:	ff d6                	call   *%esi
+			break;
+  800b61:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800b64:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800b67:	e9 b1 02 00 00       	jmp    800e1d <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800b6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b6f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800b72:	8b 10                	mov    (%eax),%edx
+  800b74:	89 d0                	mov    %edx,%eax
+  800b76:	f7 d8                	neg    %eax
+  800b78:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b7b:	83 f8 0f             	cmp    $0xf,%eax
+  800b7e:	7f 23                	jg     800ba3 <vprintfmt+0x15c>
+  800b80:	8b 14 85 60 36 80 00 	mov    0x803660(,%eax,4),%edx
+  800b87:	85 d2                	test   %edx,%edx
+  800b89:	74 18                	je     800ba3 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800b8b:	52                   	push   %edx
+  800b8c:	68 99 38 80 00       	push   $0x803899
+  800b91:	53                   	push   %ebx
+  800b92:	56                   	push   %esi
+  800b93:	e8 92 fe ff ff       	call   800a2a <printfmt>
+  800b98:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800b9b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800b9e:	e9 7a 02 00 00       	jmp    800e1d <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800ba3:	50                   	push   %eax
+  800ba4:	68 df 33 80 00       	push   $0x8033df
+  800ba9:	53                   	push   %ebx
+  800baa:	56                   	push   %esi
+  800bab:	e8 7a fe ff ff       	call   800a2a <printfmt>
+  800bb0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800bb3:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800bb6:	e9 62 02 00 00       	jmp    800e1d <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800bbb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bbe:	83 c0 04             	add    $0x4,%eax
+  800bc1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800bc4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc7:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800bc9:	85 c9                	test   %ecx,%ecx
+  800bcb:	b8 d8 33 80 00       	mov    $0x8033d8,%eax
+  800bd0:	0f 45 c1             	cmovne %ecx,%eax
+  800bd3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800bd6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800bda:	7e 06                	jle    800be2 <vprintfmt+0x19b>
+  800bdc:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800be0:	75 0b                	jne    800bed <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800be2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800be5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800be8:	89 75 08             	mov    %esi,0x8(%ebp)
+  800beb:	eb 5c                	jmp    800c49 <vprintfmt+0x202>
+  800bed:	83 ec 08             	sub    $0x8,%esp
+  800bf0:	ff 75 d0             	push   -0x30(%ebp)
+  800bf3:	ff 75 cc             	push   -0x34(%ebp)
+  800bf6:	e8 20 03 00 00       	call   800f1b <strnlen>
+  800bfb:	89 c2                	mov    %eax,%edx
+  800bfd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c00:	29 d0                	sub    %edx,%eax
+  800c02:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800c05:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800c09:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c0c:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c0f:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c11:	eb 0e                	jmp    800c21 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800c13:	83 ec 08             	sub    $0x8,%esp
+  800c16:	53                   	push   %ebx
+  800c17:	57                   	push   %edi
+  800c18:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c1b:	83 ee 01             	sub    $0x1,%esi
+  800c1e:	83 c4 10             	add    $0x10,%esp
+  800c21:	85 f6                	test   %esi,%esi
+  800c23:	7f ee                	jg     800c13 <vprintfmt+0x1cc>
+  800c25:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c28:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c2b:	85 c0                	test   %eax,%eax
+  800c2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c32:	0f 49 d0             	cmovns %eax,%edx
+  800c35:	29 d0                	sub    %edx,%eax
+  800c37:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c3a:	eb a6                	jmp    800be2 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800c3c:	83 ec 08             	sub    $0x8,%esp
+  800c3f:	53                   	push   %ebx
+  800c40:	52                   	push   %edx
+  800c41:	ff 55 08             	call   *0x8(%ebp)
+  800c44:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c47:	89 f1                	mov    %esi,%ecx
+  800c49:	8d 71 01             	lea    0x1(%ecx),%esi
+  800c4c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800c50:	0f be d0             	movsbl %al,%edx
+  800c53:	85 d2                	test   %edx,%edx
+  800c55:	74 28                	je     800c7f <vprintfmt+0x238>
+  800c57:	85 ff                	test   %edi,%edi
+  800c59:	78 05                	js     800c60 <vprintfmt+0x219>
+  800c5b:	83 ef 01             	sub    $0x1,%edi
+  800c5e:	78 30                	js     800c90 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800c60:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800c64:	74 d6                	je     800c3c <vprintfmt+0x1f5>
+  800c66:	0f be c0             	movsbl %al,%eax
+  800c69:	83 e8 20             	sub    $0x20,%eax
+  800c6c:	83 f8 5e             	cmp    $0x5e,%eax
+  800c6f:	76 cb                	jbe    800c3c <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800c71:	83 ec 08             	sub    $0x8,%esp
+  800c74:	53                   	push   %ebx
+  800c75:	6a 3f                	push   $0x3f
+  800c77:	ff 55 08             	call   *0x8(%ebp)
+  800c7a:	83 c4 10             	add    $0x10,%esp
+  800c7d:	eb c8                	jmp    800c47 <vprintfmt+0x200>
+  800c7f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c82:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c85:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800c88:	01 d0                	add    %edx,%eax
+  800c8a:	29 c8                	sub    %ecx,%eax
+  800c8c:	89 c7                	mov    %eax,%edi
+  800c8e:	eb 13                	jmp    800ca3 <vprintfmt+0x25c>
+  800c90:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c93:	eb ed                	jmp    800c82 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800c95:	83 ec 08             	sub    $0x8,%esp
+  800c98:	53                   	push   %ebx
+  800c99:	6a 20                	push   $0x20
+  800c9b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800c9d:	83 ef 01             	sub    $0x1,%edi
+  800ca0:	83 c4 10             	add    $0x10,%esp
+  800ca3:	85 ff                	test   %edi,%edi
+  800ca5:	7f ee                	jg     800c95 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800ca7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800caa:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cad:	e9 6b 01 00 00       	jmp    800e1d <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800cb2:	83 f9 01             	cmp    $0x1,%ecx
+  800cb5:	7f 1f                	jg     800cd6 <vprintfmt+0x28f>
+	else if (lflag)
+  800cb7:	85 c9                	test   %ecx,%ecx
+  800cb9:	74 67                	je     800d22 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800cbb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cbe:	8b 00                	mov    (%eax),%eax
+  800cc0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cc3:	89 c1                	mov    %eax,%ecx
+  800cc5:	c1 f9 1f             	sar    $0x1f,%ecx
+  800cc8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ccb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cce:	8d 40 04             	lea    0x4(%eax),%eax
+  800cd1:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cd4:	eb 17                	jmp    800ced <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800cd6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cd9:	8b 50 04             	mov    0x4(%eax),%edx
+  800cdc:	8b 00                	mov    (%eax),%eax
+  800cde:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ce1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ce4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ce7:	8d 40 08             	lea    0x8(%eax),%eax
+  800cea:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800ced:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800cf0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800cf3:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800cf8:	85 c9                	test   %ecx,%ecx
+  800cfa:	0f 89 03 01 00 00    	jns    800e03 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800d00:	83 ec 08             	sub    $0x8,%esp
+  800d03:	53                   	push   %ebx
+  800d04:	6a 2d                	push   $0x2d
+  800d06:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800d08:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800d0b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d0e:	f7 da                	neg    %edx
+  800d10:	83 d1 00             	adc    $0x0,%ecx
+  800d13:	f7 d9                	neg    %ecx
+  800d15:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800d18:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800d1d:	e9 e1 00 00 00       	jmp    800e03 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800d22:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d25:	8b 00                	mov    (%eax),%eax
+  800d27:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d2a:	89 c1                	mov    %eax,%ecx
+  800d2c:	c1 f9 1f             	sar    $0x1f,%ecx
+  800d2f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d32:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d35:	8d 40 04             	lea    0x4(%eax),%eax
+  800d38:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d3b:	eb b0                	jmp    800ced <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800d3d:	83 f9 01             	cmp    $0x1,%ecx
+  800d40:	7f 1e                	jg     800d60 <vprintfmt+0x319>
+	else if (lflag)
+  800d42:	85 c9                	test   %ecx,%ecx
+  800d44:	74 32                	je     800d78 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800d46:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d49:	8b 10                	mov    (%eax),%edx
+  800d4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d50:	8d 40 04             	lea    0x4(%eax),%eax
+  800d53:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d56:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800d5b:	e9 a3 00 00 00       	jmp    800e03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800d60:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d63:	8b 10                	mov    (%eax),%edx
+  800d65:	8b 48 04             	mov    0x4(%eax),%ecx
+  800d68:	8d 40 08             	lea    0x8(%eax),%eax
+  800d6b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d6e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800d73:	e9 8b 00 00 00       	jmp    800e03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800d78:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d7b:	8b 10                	mov    (%eax),%edx
+  800d7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d82:	8d 40 04             	lea    0x4(%eax),%eax
+  800d85:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d88:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800d8d:	eb 74                	jmp    800e03 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800d8f:	83 f9 01             	cmp    $0x1,%ecx
+  800d92:	7f 1b                	jg     800daf <vprintfmt+0x368>
+	else if (lflag)
+  800d94:	85 c9                	test   %ecx,%ecx
+  800d96:	74 2c                	je     800dc4 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800d98:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d9b:	8b 10                	mov    (%eax),%edx
+  800d9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800da2:	8d 40 04             	lea    0x4(%eax),%eax
+  800da5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800da8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800dad:	eb 54                	jmp    800e03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800daf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800db2:	8b 10                	mov    (%eax),%edx
+  800db4:	8b 48 04             	mov    0x4(%eax),%ecx
+  800db7:	8d 40 08             	lea    0x8(%eax),%eax
+  800dba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800dbd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800dc2:	eb 3f                	jmp    800e03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800dc4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dc7:	8b 10                	mov    (%eax),%edx
+  800dc9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dce:	8d 40 04             	lea    0x4(%eax),%eax
+  800dd1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800dd4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800dd9:	eb 28                	jmp    800e03 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800ddb:	83 ec 08             	sub    $0x8,%esp
+  800dde:	53                   	push   %ebx
+  800ddf:	6a 30                	push   $0x30
+  800de1:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800de3:	83 c4 08             	add    $0x8,%esp
+  800de6:	53                   	push   %ebx
+  800de7:	6a 78                	push   $0x78
+  800de9:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800deb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dee:	8b 10                	mov    (%eax),%edx
+  800df0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800df5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800df8:	8d 40 04             	lea    0x4(%eax),%eax
+  800dfb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800dfe:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800e03:	83 ec 0c             	sub    $0xc,%esp
+  800e06:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800e0a:	50                   	push   %eax
+  800e0b:	ff 75 e0             	push   -0x20(%ebp)
+  800e0e:	57                   	push   %edi
+  800e0f:	51                   	push   %ecx
+  800e10:	52                   	push   %edx
+  800e11:	89 da                	mov    %ebx,%edx
+  800e13:	89 f0                	mov    %esi,%eax
+  800e15:	e8 4a fb ff ff       	call   800964 <printnum>
+			break;
+  800e1a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800e1d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800e20:	e9 40 fc ff ff       	jmp    800a65 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800e25:	83 f9 01             	cmp    $0x1,%ecx
+  800e28:	7f 1b                	jg     800e45 <vprintfmt+0x3fe>
+	else if (lflag)
+  800e2a:	85 c9                	test   %ecx,%ecx
+  800e2c:	74 2c                	je     800e5a <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800e2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e31:	8b 10                	mov    (%eax),%edx
+  800e33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e38:	8d 40 04             	lea    0x4(%eax),%eax
+  800e3b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e3e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800e43:	eb be                	jmp    800e03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800e45:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e48:	8b 10                	mov    (%eax),%edx
+  800e4a:	8b 48 04             	mov    0x4(%eax),%ecx
+  800e4d:	8d 40 08             	lea    0x8(%eax),%eax
+  800e50:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e53:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800e58:	eb a9                	jmp    800e03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800e5a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e5d:	8b 10                	mov    (%eax),%edx
+  800e5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e64:	8d 40 04             	lea    0x4(%eax),%eax
+  800e67:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e6a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800e6f:	eb 92                	jmp    800e03 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800e71:	83 ec 08             	sub    $0x8,%esp
+  800e74:	53                   	push   %ebx
+  800e75:	6a 25                	push   $0x25
+  800e77:	ff d6                	call   *%esi
+			break;
+  800e79:	83 c4 10             	add    $0x10,%esp
+  800e7c:	eb 9f                	jmp    800e1d <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800e7e:	83 ec 08             	sub    $0x8,%esp
+  800e81:	53                   	push   %ebx
+  800e82:	6a 25                	push   $0x25
+  800e84:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e86:	83 c4 10             	add    $0x10,%esp
+  800e89:	89 f8                	mov    %edi,%eax
+  800e8b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800e8f:	74 05                	je     800e96 <vprintfmt+0x44f>
+  800e91:	83 e8 01             	sub    $0x1,%eax
+  800e94:	eb f5                	jmp    800e8b <vprintfmt+0x444>
+  800e96:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800e99:	eb 82                	jmp    800e1d <vprintfmt+0x3d6>
+
+00800e9b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	83 ec 18             	sub    $0x18,%esp
+  800ea1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ea4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ea7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800eaa:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800eae:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800eb1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800eb8:	85 c0                	test   %eax,%eax
+  800eba:	74 26                	je     800ee2 <vsnprintf+0x47>
+  800ebc:	85 d2                	test   %edx,%edx
+  800ebe:	7e 22                	jle    800ee2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ec0:	ff 75 14             	push   0x14(%ebp)
+  800ec3:	ff 75 10             	push   0x10(%ebp)
+  800ec6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ec9:	50                   	push   %eax
+  800eca:	68 0d 0a 80 00       	push   $0x800a0d
+  800ecf:	e8 73 fb ff ff       	call   800a47 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ed4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ed7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800eda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800edd:	83 c4 10             	add    $0x10,%esp
+}
+  800ee0:	c9                   	leave
+  800ee1:	c3                   	ret
+		return -E_INVAL;
+  800ee2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ee7:	eb f7                	jmp    800ee0 <vsnprintf+0x45>
+
+00800ee9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ee9:	55                   	push   %ebp
+  800eea:	89 e5                	mov    %esp,%ebp
+  800eec:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800eef:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800ef2:	50                   	push   %eax
+  800ef3:	ff 75 10             	push   0x10(%ebp)
+  800ef6:	ff 75 0c             	push   0xc(%ebp)
+  800ef9:	ff 75 08             	push   0x8(%ebp)
+  800efc:	e8 9a ff ff ff       	call   800e9b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800f01:	c9                   	leave
+  800f02:	c3                   	ret
+
+00800f03 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800f03:	55                   	push   %ebp
+  800f04:	89 e5                	mov    %esp,%ebp
+  800f06:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f0e:	eb 03                	jmp    800f13 <strlen+0x10>
+		n++;
+  800f10:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800f13:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800f17:	75 f7                	jne    800f10 <strlen+0xd>
+	return n;
+}
+  800f19:	5d                   	pop    %ebp
+  800f1a:	c3                   	ret
+
+00800f1b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f21:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f29:	eb 03                	jmp    800f2e <strnlen+0x13>
+		n++;
+  800f2b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f2e:	39 d0                	cmp    %edx,%eax
+  800f30:	74 08                	je     800f3a <strnlen+0x1f>
+  800f32:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800f36:	75 f3                	jne    800f2b <strnlen+0x10>
+  800f38:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800f3a:	89 d0                	mov    %edx,%eax
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+
+00800f3e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	53                   	push   %ebx
+  800f42:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f45:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800f51:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800f54:	83 c0 01             	add    $0x1,%eax
+  800f57:	84 d2                	test   %dl,%dl
+  800f59:	75 f2                	jne    800f4d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800f5b:	89 c8                	mov    %ecx,%eax
+  800f5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f60:	c9                   	leave
+  800f61:	c3                   	ret
+
+00800f62 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	53                   	push   %ebx
+  800f66:	83 ec 10             	sub    $0x10,%esp
+  800f69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800f6c:	53                   	push   %ebx
+  800f6d:	e8 91 ff ff ff       	call   800f03 <strlen>
+  800f72:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800f75:	ff 75 0c             	push   0xc(%ebp)
+  800f78:	01 d8                	add    %ebx,%eax
+  800f7a:	50                   	push   %eax
+  800f7b:	e8 be ff ff ff       	call   800f3e <strcpy>
+	return dst;
+}
+  800f80:	89 d8                	mov    %ebx,%eax
+  800f82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f85:	c9                   	leave
+  800f86:	c3                   	ret
+
+00800f87 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f87:	55                   	push   %ebp
+  800f88:	89 e5                	mov    %esp,%ebp
+  800f8a:	56                   	push   %esi
+  800f8b:	53                   	push   %ebx
+  800f8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800f92:	89 f3                	mov    %esi,%ebx
+  800f94:	03 5d 10             	add    0x10(%ebp),%ebx
+  800f97:	89 f0                	mov    %esi,%eax
+  800f99:	eb 0f                	jmp    800faa <strncpy+0x23>
+		*dst++ = *src;
+  800f9b:	83 c0 01             	add    $0x1,%eax
+  800f9e:	0f b6 0a             	movzbl (%edx),%ecx
+  800fa1:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800fa4:	80 f9 01             	cmp    $0x1,%cl
+  800fa7:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800faa:	39 d8                	cmp    %ebx,%eax
+  800fac:	75 ed                	jne    800f9b <strncpy+0x14>
+	}
+	return ret;
+}
+  800fae:	89 f0                	mov    %esi,%eax
+  800fb0:	5b                   	pop    %ebx
+  800fb1:	5e                   	pop    %esi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+
+00800fb4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+  800fb7:	56                   	push   %esi
+  800fb8:	53                   	push   %ebx
+  800fb9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbf:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800fc2:	89 f0                	mov    %esi,%eax
+  800fc4:	85 d2                	test   %edx,%edx
+  800fc6:	74 21                	je     800fe9 <strlcpy+0x35>
+  800fc8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800fcc:	89 f2                	mov    %esi,%edx
+  800fce:	eb 09                	jmp    800fd9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800fd0:	83 c1 01             	add    $0x1,%ecx
+  800fd3:	83 c2 01             	add    $0x1,%edx
+  800fd6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800fd9:	39 c2                	cmp    %eax,%edx
+  800fdb:	74 09                	je     800fe6 <strlcpy+0x32>
+  800fdd:	0f b6 19             	movzbl (%ecx),%ebx
+  800fe0:	84 db                	test   %bl,%bl
+  800fe2:	75 ec                	jne    800fd0 <strlcpy+0x1c>
+  800fe4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800fe6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800fe9:	29 f0                	sub    %esi,%eax
+}
+  800feb:	5b                   	pop    %ebx
+  800fec:	5e                   	pop    %esi
+  800fed:	5d                   	pop    %ebp
+  800fee:	c3                   	ret
+
+00800fef <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800fef:	55                   	push   %ebp
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ff5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ff8:	eb 06                	jmp    801000 <strcmp+0x11>
+		p++, q++;
+  800ffa:	83 c1 01             	add    $0x1,%ecx
+  800ffd:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801000:	0f b6 01             	movzbl (%ecx),%eax
+  801003:	84 c0                	test   %al,%al
+  801005:	74 04                	je     80100b <strcmp+0x1c>
+  801007:	3a 02                	cmp    (%edx),%al
+  801009:	74 ef                	je     800ffa <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80100b:	0f b6 c0             	movzbl %al,%eax
+  80100e:	0f b6 12             	movzbl (%edx),%edx
+  801011:	29 d0                	sub    %edx,%eax
+}
+  801013:	5d                   	pop    %ebp
+  801014:	c3                   	ret
+
+00801015 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	53                   	push   %ebx
+  801019:	8b 45 08             	mov    0x8(%ebp),%eax
+  80101c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801022:	eb 09                	jmp    80102d <strncmp+0x18>
+		n--, p++, q++;
+  801024:	83 ea 01             	sub    $0x1,%edx
+  801027:	83 c0 01             	add    $0x1,%eax
+  80102a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80102d:	85 d2                	test   %edx,%edx
+  80102f:	74 18                	je     801049 <strncmp+0x34>
+  801031:	0f b6 18             	movzbl (%eax),%ebx
+  801034:	84 db                	test   %bl,%bl
+  801036:	74 04                	je     80103c <strncmp+0x27>
+  801038:	3a 19                	cmp    (%ecx),%bl
+  80103a:	74 e8                	je     801024 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80103c:	0f b6 00             	movzbl (%eax),%eax
+  80103f:	0f b6 11             	movzbl (%ecx),%edx
+  801042:	29 d0                	sub    %edx,%eax
+}
+  801044:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801047:	c9                   	leave
+  801048:	c3                   	ret
+		return 0;
+  801049:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104e:	eb f4                	jmp    801044 <strncmp+0x2f>
+
+00801050 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801050:	55                   	push   %ebp
+  801051:	89 e5                	mov    %esp,%ebp
+  801053:	8b 45 08             	mov    0x8(%ebp),%eax
+  801056:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80105a:	eb 03                	jmp    80105f <strchr+0xf>
+  80105c:	83 c0 01             	add    $0x1,%eax
+  80105f:	0f b6 10             	movzbl (%eax),%edx
+  801062:	84 d2                	test   %dl,%dl
+  801064:	74 06                	je     80106c <strchr+0x1c>
+		if (*s == c)
+  801066:	38 ca                	cmp    %cl,%dl
+  801068:	75 f2                	jne    80105c <strchr+0xc>
+  80106a:	eb 05                	jmp    801071 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80106c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801071:	5d                   	pop    %ebp
+  801072:	c3                   	ret
+
+00801073 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801073:	55                   	push   %ebp
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	8b 45 08             	mov    0x8(%ebp),%eax
+  801079:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80107d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801080:	38 ca                	cmp    %cl,%dl
+  801082:	74 09                	je     80108d <strfind+0x1a>
+  801084:	84 d2                	test   %dl,%dl
+  801086:	74 05                	je     80108d <strfind+0x1a>
+	for (; *s; s++)
+  801088:	83 c0 01             	add    $0x1,%eax
+  80108b:	eb f0                	jmp    80107d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80108d:	5d                   	pop    %ebp
+  80108e:	c3                   	ret
+
+0080108f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	57                   	push   %edi
+  801093:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801096:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801099:	85 c9                	test   %ecx,%ecx
+  80109b:	74 20                	je     8010bd <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80109d:	89 f8                	mov    %edi,%eax
+  80109f:	09 c8                	or     %ecx,%eax
+  8010a1:	a8 03                	test   $0x3,%al
+  8010a3:	75 12                	jne    8010b7 <memset+0x28>
+		c &= 0xFF;
+  8010a5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8010a9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8010af:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8010b2:	fc                   	cld
+  8010b3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8010b5:	eb 06                	jmp    8010bd <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8010b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010ba:	fc                   	cld
+  8010bb:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010bd:	89 f8                	mov    %edi,%eax
+  8010bf:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8010c2:	c9                   	leave
+  8010c3:	c3                   	ret
+
+008010c4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8010c4:	55                   	push   %ebp
+  8010c5:	89 e5                	mov    %esp,%ebp
+  8010c7:	57                   	push   %edi
+  8010c8:	56                   	push   %esi
+  8010c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010cf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8010d2:	39 c6                	cmp    %eax,%esi
+  8010d4:	73 32                	jae    801108 <memmove+0x44>
+  8010d6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8010d9:	39 d0                	cmp    %edx,%eax
+  8010db:	73 2b                	jae    801108 <memmove+0x44>
+		s += n;
+		d += n;
+  8010dd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8010e0:	89 d6                	mov    %edx,%esi
+  8010e2:	09 fe                	or     %edi,%esi
+  8010e4:	09 ce                	or     %ecx,%esi
+  8010e6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8010ec:	75 0e                	jne    8010fc <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8010ee:	83 ef 04             	sub    $0x4,%edi
+  8010f1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8010f4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8010f7:	fd                   	std
+  8010f8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8010fa:	eb 09                	jmp    801105 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8010fc:	83 ef 01             	sub    $0x1,%edi
+  8010ff:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801102:	fd                   	std
+  801103:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801105:	fc                   	cld
+  801106:	eb 1a                	jmp    801122 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801108:	89 f2                	mov    %esi,%edx
+  80110a:	09 c2                	or     %eax,%edx
+  80110c:	09 ca                	or     %ecx,%edx
+  80110e:	f6 c2 03             	test   $0x3,%dl
+  801111:	75 0a                	jne    80111d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801113:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801116:	89 c7                	mov    %eax,%edi
+  801118:	fc                   	cld
+  801119:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80111b:	eb 05                	jmp    801122 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80111d:	89 c7                	mov    %eax,%edi
+  80111f:	fc                   	cld
+  801120:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801122:	5e                   	pop    %esi
+  801123:	5f                   	pop    %edi
+  801124:	5d                   	pop    %ebp
+  801125:	c3                   	ret
+
+00801126 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80112c:	ff 75 10             	push   0x10(%ebp)
+  80112f:	ff 75 0c             	push   0xc(%ebp)
+  801132:	ff 75 08             	push   0x8(%ebp)
+  801135:	e8 8a ff ff ff       	call   8010c4 <memmove>
+}
+  80113a:	c9                   	leave
+  80113b:	c3                   	ret
+
+0080113c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	56                   	push   %esi
+  801140:	53                   	push   %ebx
+  801141:	8b 45 08             	mov    0x8(%ebp),%eax
+  801144:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801147:	89 c6                	mov    %eax,%esi
+  801149:	03 75 10             	add    0x10(%ebp),%esi
+  80114c:	eb 06                	jmp    801154 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80114e:	83 c0 01             	add    $0x1,%eax
+  801151:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801154:	39 f0                	cmp    %esi,%eax
+  801156:	74 14                	je     80116c <memcmp+0x30>
+		if (*s1 != *s2)
+  801158:	0f b6 08             	movzbl (%eax),%ecx
+  80115b:	0f b6 1a             	movzbl (%edx),%ebx
+  80115e:	38 d9                	cmp    %bl,%cl
+  801160:	74 ec                	je     80114e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801162:	0f b6 c1             	movzbl %cl,%eax
+  801165:	0f b6 db             	movzbl %bl,%ebx
+  801168:	29 d8                	sub    %ebx,%eax
+  80116a:	eb 05                	jmp    801171 <memcmp+0x35>
+	}
+
+	return 0;
+  80116c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801171:	5b                   	pop    %ebx
+  801172:	5e                   	pop    %esi
+  801173:	5d                   	pop    %ebp
+  801174:	c3                   	ret
+
+00801175 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801175:	55                   	push   %ebp
+  801176:	89 e5                	mov    %esp,%ebp
+  801178:	8b 45 08             	mov    0x8(%ebp),%eax
+  80117b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80117e:	89 c2                	mov    %eax,%edx
+  801180:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801183:	eb 03                	jmp    801188 <memfind+0x13>
+  801185:	83 c0 01             	add    $0x1,%eax
+  801188:	39 d0                	cmp    %edx,%eax
+  80118a:	73 04                	jae    801190 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80118c:	38 08                	cmp    %cl,(%eax)
+  80118e:	75 f5                	jne    801185 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801190:	5d                   	pop    %ebp
+  801191:	c3                   	ret
+
+00801192 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801192:	55                   	push   %ebp
+  801193:	89 e5                	mov    %esp,%ebp
+  801195:	57                   	push   %edi
+  801196:	56                   	push   %esi
+  801197:	53                   	push   %ebx
+  801198:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80119e:	eb 03                	jmp    8011a3 <strtol+0x11>
+		s++;
+  8011a0:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8011a3:	0f b6 02             	movzbl (%edx),%eax
+  8011a6:	3c 20                	cmp    $0x20,%al
+  8011a8:	74 f6                	je     8011a0 <strtol+0xe>
+  8011aa:	3c 09                	cmp    $0x9,%al
+  8011ac:	74 f2                	je     8011a0 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011ae:	3c 2b                	cmp    $0x2b,%al
+  8011b0:	74 2a                	je     8011dc <strtol+0x4a>
+	int neg = 0;
+  8011b2:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8011b7:	3c 2d                	cmp    $0x2d,%al
+  8011b9:	74 2b                	je     8011e6 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011bb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8011c1:	75 0f                	jne    8011d2 <strtol+0x40>
+  8011c3:	80 3a 30             	cmpb   $0x30,(%edx)
+  8011c6:	74 28                	je     8011f0 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011c8:	85 db                	test   %ebx,%ebx
+  8011ca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011cf:	0f 44 d8             	cmove  %eax,%ebx
+  8011d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8011da:	eb 46                	jmp    801222 <strtol+0x90>
+		s++;
+  8011dc:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8011df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011e4:	eb d5                	jmp    8011bb <strtol+0x29>
+		s++, neg = 1;
+  8011e6:	83 c2 01             	add    $0x1,%edx
+  8011e9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011ee:	eb cb                	jmp    8011bb <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011f0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8011f4:	74 0e                	je     801204 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8011f6:	85 db                	test   %ebx,%ebx
+  8011f8:	75 d8                	jne    8011d2 <strtol+0x40>
+		s++, base = 8;
+  8011fa:	83 c2 01             	add    $0x1,%edx
+  8011fd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801202:	eb ce                	jmp    8011d2 <strtol+0x40>
+		s += 2, base = 16;
+  801204:	83 c2 02             	add    $0x2,%edx
+  801207:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80120c:	eb c4                	jmp    8011d2 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80120e:	0f be c0             	movsbl %al,%eax
+  801211:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801214:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801217:	7d 3a                	jge    801253 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801219:	83 c2 01             	add    $0x1,%edx
+  80121c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801220:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801222:	0f b6 02             	movzbl (%edx),%eax
+  801225:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801228:	89 f3                	mov    %esi,%ebx
+  80122a:	80 fb 09             	cmp    $0x9,%bl
+  80122d:	76 df                	jbe    80120e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80122f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801232:	89 f3                	mov    %esi,%ebx
+  801234:	80 fb 19             	cmp    $0x19,%bl
+  801237:	77 08                	ja     801241 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801239:	0f be c0             	movsbl %al,%eax
+  80123c:	83 e8 57             	sub    $0x57,%eax
+  80123f:	eb d3                	jmp    801214 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801241:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801244:	89 f3                	mov    %esi,%ebx
+  801246:	80 fb 19             	cmp    $0x19,%bl
+  801249:	77 08                	ja     801253 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80124b:	0f be c0             	movsbl %al,%eax
+  80124e:	83 e8 37             	sub    $0x37,%eax
+  801251:	eb c1                	jmp    801214 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801253:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801257:	74 05                	je     80125e <strtol+0xcc>
+		*endptr = (char *) s;
+  801259:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80125c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80125e:	89 c8                	mov    %ecx,%eax
+  801260:	f7 d8                	neg    %eax
+  801262:	85 ff                	test   %edi,%edi
+  801264:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801267:	89 c8                	mov    %ecx,%eax
+  801269:	5b                   	pop    %ebx
+  80126a:	5e                   	pop    %esi
+  80126b:	5f                   	pop    %edi
+  80126c:	5d                   	pop    %ebp
+  80126d:	c3                   	ret
+
+0080126e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80126e:	55                   	push   %ebp
+  80126f:	89 e5                	mov    %esp,%ebp
+  801271:	57                   	push   %edi
+  801272:	56                   	push   %esi
+  801273:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801274:	b8 00 00 00 00       	mov    $0x0,%eax
+  801279:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127f:	89 c3                	mov    %eax,%ebx
+  801281:	89 c7                	mov    %eax,%edi
+  801283:	89 c6                	mov    %eax,%esi
+  801285:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801287:	5b                   	pop    %ebx
+  801288:	5e                   	pop    %esi
+  801289:	5f                   	pop    %edi
+  80128a:	5d                   	pop    %ebp
+  80128b:	c3                   	ret
+
+0080128c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80128c:	55                   	push   %ebp
+  80128d:	89 e5                	mov    %esp,%ebp
+  80128f:	57                   	push   %edi
+  801290:	56                   	push   %esi
+  801291:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801292:	ba 00 00 00 00       	mov    $0x0,%edx
+  801297:	b8 01 00 00 00       	mov    $0x1,%eax
+  80129c:	89 d1                	mov    %edx,%ecx
+  80129e:	89 d3                	mov    %edx,%ebx
+  8012a0:	89 d7                	mov    %edx,%edi
+  8012a2:	89 d6                	mov    %edx,%esi
+  8012a4:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8012a6:	5b                   	pop    %ebx
+  8012a7:	5e                   	pop    %esi
+  8012a8:	5f                   	pop    %edi
+  8012a9:	5d                   	pop    %ebp
+  8012aa:	c3                   	ret
+
+008012ab <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8012ab:	55                   	push   %ebp
+  8012ac:	89 e5                	mov    %esp,%ebp
+  8012ae:	57                   	push   %edi
+  8012af:	56                   	push   %esi
+  8012b0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8012be:	89 cb                	mov    %ecx,%ebx
+  8012c0:	89 cf                	mov    %ecx,%edi
+  8012c2:	89 ce                	mov    %ecx,%esi
+  8012c4:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  8012c6:	5b                   	pop    %ebx
+  8012c7:	5e                   	pop    %esi
+  8012c8:	5f                   	pop    %edi
+  8012c9:	5d                   	pop    %ebp
+  8012ca:	c3                   	ret
+
+008012cb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8012cb:	55                   	push   %ebp
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	57                   	push   %edi
+  8012cf:	56                   	push   %esi
+  8012d0:	53                   	push   %ebx
+  8012d1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dc:	b8 03 00 00 00       	mov    $0x3,%eax
+  8012e1:	89 cb                	mov    %ecx,%ebx
+  8012e3:	89 cf                	mov    %ecx,%edi
+  8012e5:	89 ce                	mov    %ecx,%esi
+  8012e7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012e9:	85 c0                	test   %eax,%eax
+  8012eb:	7f 08                	jg     8012f5 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8012ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f0:	5b                   	pop    %ebx
+  8012f1:	5e                   	pop    %esi
+  8012f2:	5f                   	pop    %edi
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f5:	83 ec 0c             	sub    $0xc,%esp
+  8012f8:	50                   	push   %eax
+  8012f9:	6a 03                	push   $0x3
+  8012fb:	68 bf 36 80 00       	push   $0x8036bf
+  801300:	6a 23                	push   $0x23
+  801302:	68 dc 36 80 00       	push   $0x8036dc
+  801307:	e8 69 f5 ff ff       	call   800875 <_panic>
+
+0080130c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80130c:	55                   	push   %ebp
+  80130d:	89 e5                	mov    %esp,%ebp
+  80130f:	57                   	push   %edi
+  801310:	56                   	push   %esi
+  801311:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801312:	ba 00 00 00 00       	mov    $0x0,%edx
+  801317:	b8 02 00 00 00       	mov    $0x2,%eax
+  80131c:	89 d1                	mov    %edx,%ecx
+  80131e:	89 d3                	mov    %edx,%ebx
+  801320:	89 d7                	mov    %edx,%edi
+  801322:	89 d6                	mov    %edx,%esi
+  801324:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801326:	5b                   	pop    %ebx
+  801327:	5e                   	pop    %esi
+  801328:	5f                   	pop    %edi
+  801329:	5d                   	pop    %ebp
+  80132a:	c3                   	ret
+
+0080132b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80132b:	55                   	push   %ebp
+  80132c:	89 e5                	mov    %esp,%ebp
+  80132e:	57                   	push   %edi
+  80132f:	56                   	push   %esi
+  801330:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801331:	ba 00 00 00 00       	mov    $0x0,%edx
+  801336:	b8 16 00 00 00       	mov    $0x16,%eax
+  80133b:	89 d1                	mov    %edx,%ecx
+  80133d:	89 d3                	mov    %edx,%ebx
+  80133f:	89 d7                	mov    %edx,%edi
+  801341:	89 d6                	mov    %edx,%esi
+  801343:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801345:	5b                   	pop    %ebx
+  801346:	5e                   	pop    %esi
+  801347:	5f                   	pop    %edi
+  801348:	5d                   	pop    %ebp
+  801349:	c3                   	ret
+
+0080134a <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  80134a:	55                   	push   %ebp
+  80134b:	89 e5                	mov    %esp,%ebp
+  80134d:	57                   	push   %edi
+  80134e:	56                   	push   %esi
+  80134f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801350:	ba 00 00 00 00       	mov    $0x0,%edx
+  801355:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80135a:	89 d1                	mov    %edx,%ecx
+  80135c:	89 d3                	mov    %edx,%ebx
+  80135e:	89 d7                	mov    %edx,%edi
+  801360:	89 d6                	mov    %edx,%esi
+  801362:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  801364:	5b                   	pop    %ebx
+  801365:	5e                   	pop    %esi
+  801366:	5f                   	pop    %edi
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+
+00801369 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  801369:	55                   	push   %ebp
+  80136a:	89 e5                	mov    %esp,%ebp
+  80136c:	57                   	push   %edi
+  80136d:	56                   	push   %esi
+  80136e:	53                   	push   %ebx
+  80136f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801372:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801377:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801382:	89 df                	mov    %ebx,%edi
+  801384:	89 de                	mov    %ebx,%esi
+  801386:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801388:	85 c0                	test   %eax,%eax
+  80138a:	7f 08                	jg     801394 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  80138c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138f:	5b                   	pop    %ebx
+  801390:	5e                   	pop    %esi
+  801391:	5f                   	pop    %edi
+  801392:	5d                   	pop    %ebp
+  801393:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801394:	83 ec 0c             	sub    $0xc,%esp
+  801397:	50                   	push   %eax
+  801398:	6a 15                	push   $0x15
+  80139a:	68 bf 36 80 00       	push   $0x8036bf
+  80139f:	6a 23                	push   $0x23
+  8013a1:	68 dc 36 80 00       	push   $0x8036dc
+  8013a6:	e8 ca f4 ff ff       	call   800875 <_panic>
+
+008013ab <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8013ab:	55                   	push   %ebp
+  8013ac:	89 e5                	mov    %esp,%ebp
+  8013ae:	57                   	push   %edi
+  8013af:	56                   	push   %esi
+  8013b0:	53                   	push   %ebx
+  8013b1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bf:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c7:	89 f7                	mov    %esi,%edi
+  8013c9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013cb:	85 c0                	test   %eax,%eax
+  8013cd:	7f 08                	jg     8013d7 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8013cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5e                   	pop    %esi
+  8013d4:	5f                   	pop    %edi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013d7:	83 ec 0c             	sub    $0xc,%esp
+  8013da:	50                   	push   %eax
+  8013db:	6a 05                	push   $0x5
+  8013dd:	68 bf 36 80 00       	push   $0x8036bf
+  8013e2:	6a 23                	push   $0x23
+  8013e4:	68 dc 36 80 00       	push   $0x8036dc
+  8013e9:	e8 87 f4 ff ff       	call   800875 <_panic>
+
+008013ee <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  8013ee:	55                   	push   %ebp
+  8013ef:	89 e5                	mov    %esp,%ebp
+  8013f1:	57                   	push   %edi
+  8013f2:	56                   	push   %esi
+  8013f3:	53                   	push   %ebx
+  8013f4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801402:	b8 06 00 00 00       	mov    $0x6,%eax
+  801407:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80140a:	89 f7                	mov    %esi,%edi
+  80140c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80140e:	85 c0                	test   %eax,%eax
+  801410:	7f 08                	jg     80141a <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801412:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801415:	5b                   	pop    %ebx
+  801416:	5e                   	pop    %esi
+  801417:	5f                   	pop    %edi
+  801418:	5d                   	pop    %ebp
+  801419:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80141a:	83 ec 0c             	sub    $0xc,%esp
+  80141d:	50                   	push   %eax
+  80141e:	6a 06                	push   $0x6
+  801420:	68 bf 36 80 00       	push   $0x8036bf
+  801425:	6a 23                	push   $0x23
+  801427:	68 dc 36 80 00       	push   $0x8036dc
+  80142c:	e8 44 f4 ff ff       	call   800875 <_panic>
+
+00801431 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801431:	55                   	push   %ebp
+  801432:	89 e5                	mov    %esp,%ebp
+  801434:	57                   	push   %edi
+  801435:	56                   	push   %esi
+  801436:	53                   	push   %ebx
+  801437:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80143a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801440:	b8 07 00 00 00       	mov    $0x7,%eax
+  801445:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801448:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80144b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80144e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801450:	85 c0                	test   %eax,%eax
+  801452:	7f 08                	jg     80145c <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801454:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801457:	5b                   	pop    %ebx
+  801458:	5e                   	pop    %esi
+  801459:	5f                   	pop    %edi
+  80145a:	5d                   	pop    %ebp
+  80145b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80145c:	83 ec 0c             	sub    $0xc,%esp
+  80145f:	50                   	push   %eax
+  801460:	6a 07                	push   $0x7
+  801462:	68 bf 36 80 00       	push   $0x8036bf
+  801467:	6a 23                	push   $0x23
+  801469:	68 dc 36 80 00       	push   $0x8036dc
+  80146e:	e8 02 f4 ff ff       	call   800875 <_panic>
+
+00801473 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801473:	55                   	push   %ebp
+  801474:	89 e5                	mov    %esp,%ebp
+  801476:	57                   	push   %edi
+  801477:	56                   	push   %esi
+  801478:	53                   	push   %ebx
+  801479:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80147c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801481:	8b 55 08             	mov    0x8(%ebp),%edx
+  801484:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801487:	b8 08 00 00 00       	mov    $0x8,%eax
+  80148c:	89 df                	mov    %ebx,%edi
+  80148e:	89 de                	mov    %ebx,%esi
+  801490:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801492:	85 c0                	test   %eax,%eax
+  801494:	7f 08                	jg     80149e <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801496:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801499:	5b                   	pop    %ebx
+  80149a:	5e                   	pop    %esi
+  80149b:	5f                   	pop    %edi
+  80149c:	5d                   	pop    %ebp
+  80149d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80149e:	83 ec 0c             	sub    $0xc,%esp
+  8014a1:	50                   	push   %eax
+  8014a2:	6a 08                	push   $0x8
+  8014a4:	68 bf 36 80 00       	push   $0x8036bf
+  8014a9:	6a 23                	push   $0x23
+  8014ab:	68 dc 36 80 00       	push   $0x8036dc
+  8014b0:	e8 c0 f3 ff ff       	call   800875 <_panic>
+
+008014b5 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8014b5:	55                   	push   %ebp
+  8014b6:	89 e5                	mov    %esp,%ebp
+  8014b8:	57                   	push   %edi
+  8014b9:	56                   	push   %esi
+  8014ba:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ce:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014d1:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8014d3:	5b                   	pop    %ebx
+  8014d4:	5e                   	pop    %esi
+  8014d5:	5f                   	pop    %edi
+  8014d6:	5d                   	pop    %ebp
+  8014d7:	c3                   	ret
+
+008014d8 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8014d8:	55                   	push   %ebp
+  8014d9:	89 e5                	mov    %esp,%ebp
+  8014db:	57                   	push   %edi
+  8014dc:	56                   	push   %esi
+  8014dd:	53                   	push   %ebx
+  8014de:	8b 45 18             	mov    0x18(%ebp),%eax
+  8014e1:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  8014e4:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  8014e9:	77 27                	ja     801512 <sys_page_map_range+0x3a>
+  8014eb:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8014f1:	77 1f                	ja     801512 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  8014f3:	c1 e0 0c             	shl    $0xc,%eax
+  8014f6:	89 c6                	mov    %eax,%esi
+  8014f8:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  8014fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801500:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801505:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801508:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80150b:	cd 30                	int    $0x30
+}
+  80150d:	5b                   	pop    %ebx
+  80150e:	5e                   	pop    %esi
+  80150f:	5f                   	pop    %edi
+  801510:	5d                   	pop    %ebp
+  801511:	c3                   	ret
+		return -E_INVAL;
+  801512:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801517:	eb f4                	jmp    80150d <sys_page_map_range+0x35>
+
+00801519 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801519:	55                   	push   %ebp
+  80151a:	89 e5                	mov    %esp,%ebp
+  80151c:	57                   	push   %edi
+  80151d:	56                   	push   %esi
+  80151e:	53                   	push   %ebx
+  80151f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801522:	8b 55 08             	mov    0x8(%ebp),%edx
+  801525:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801528:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80152d:	be 00 00 00 00       	mov    $0x0,%esi
+  801532:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801535:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801538:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80153a:	85 c0                	test   %eax,%eax
+  80153c:	7f 08                	jg     801546 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80153e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801541:	5b                   	pop    %ebx
+  801542:	5e                   	pop    %esi
+  801543:	5f                   	pop    %edi
+  801544:	5d                   	pop    %ebp
+  801545:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801546:	83 ec 0c             	sub    $0xc,%esp
+  801549:	50                   	push   %eax
+  80154a:	6a 0c                	push   $0xc
+  80154c:	68 bf 36 80 00       	push   $0x8036bf
+  801551:	6a 23                	push   $0x23
+  801553:	68 dc 36 80 00       	push   $0x8036dc
+  801558:	e8 18 f3 ff ff       	call   800875 <_panic>
+
+0080155d <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  80155d:	55                   	push   %ebp
+  80155e:	89 e5                	mov    %esp,%ebp
+  801560:	57                   	push   %edi
+  801561:	56                   	push   %esi
+  801562:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801563:	be 00 00 00 00       	mov    $0x0,%esi
+  801568:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80156e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801573:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801576:	89 f7                	mov    %esi,%edi
+  801578:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  80157a:	5b                   	pop    %ebx
+  80157b:	5e                   	pop    %esi
+  80157c:	5f                   	pop    %edi
+  80157d:	5d                   	pop    %ebp
+  80157e:	c3                   	ret
+
+0080157f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80157f:	55                   	push   %ebp
+  801580:	89 e5                	mov    %esp,%ebp
+  801582:	57                   	push   %edi
+  801583:	56                   	push   %esi
+  801584:	53                   	push   %ebx
+  801585:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801588:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801590:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801593:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801598:	89 df                	mov    %ebx,%edi
+  80159a:	89 de                	mov    %ebx,%esi
+  80159c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80159e:	85 c0                	test   %eax,%eax
+  8015a0:	7f 08                	jg     8015aa <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8015a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a5:	5b                   	pop    %ebx
+  8015a6:	5e                   	pop    %esi
+  8015a7:	5f                   	pop    %edi
+  8015a8:	5d                   	pop    %ebp
+  8015a9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015aa:	83 ec 0c             	sub    $0xc,%esp
+  8015ad:	50                   	push   %eax
+  8015ae:	6a 0f                	push   $0xf
+  8015b0:	68 bf 36 80 00       	push   $0x8036bf
+  8015b5:	6a 23                	push   $0x23
+  8015b7:	68 dc 36 80 00       	push   $0x8036dc
+  8015bc:	e8 b4 f2 ff ff       	call   800875 <_panic>
+
+008015c1 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8015c1:	55                   	push   %ebp
+  8015c2:	89 e5                	mov    %esp,%ebp
+  8015c4:	57                   	push   %edi
+  8015c5:	56                   	push   %esi
+  8015c6:	53                   	push   %ebx
+  8015c7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8015ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8015da:	89 df                	mov    %ebx,%edi
+  8015dc:	89 de                	mov    %ebx,%esi
+  8015de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015e0:	85 c0                	test   %eax,%eax
+  8015e2:	7f 08                	jg     8015ec <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  8015e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e7:	5b                   	pop    %ebx
+  8015e8:	5e                   	pop    %esi
+  8015e9:	5f                   	pop    %edi
+  8015ea:	5d                   	pop    %ebp
+  8015eb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015ec:	83 ec 0c             	sub    $0xc,%esp
+  8015ef:	50                   	push   %eax
+  8015f0:	6a 10                	push   $0x10
+  8015f2:	68 bf 36 80 00       	push   $0x8036bf
+  8015f7:	6a 23                	push   $0x23
+  8015f9:	68 dc 36 80 00       	push   $0x8036dc
+  8015fe:	e8 72 f2 ff ff       	call   800875 <_panic>
+
+00801603 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  801603:	55                   	push   %ebp
+  801604:	89 e5                	mov    %esp,%ebp
+  801606:	57                   	push   %edi
+  801607:	56                   	push   %esi
+  801608:	53                   	push   %ebx
+  801609:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80160c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801611:	8b 55 08             	mov    0x8(%ebp),%edx
+  801614:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801617:	b8 11 00 00 00       	mov    $0x11,%eax
+  80161c:	89 df                	mov    %ebx,%edi
+  80161e:	89 de                	mov    %ebx,%esi
+  801620:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801622:	85 c0                	test   %eax,%eax
+  801624:	7f 08                	jg     80162e <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  801626:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801629:	5b                   	pop    %ebx
+  80162a:	5e                   	pop    %esi
+  80162b:	5f                   	pop    %edi
+  80162c:	5d                   	pop    %ebp
+  80162d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80162e:	83 ec 0c             	sub    $0xc,%esp
+  801631:	50                   	push   %eax
+  801632:	6a 11                	push   $0x11
+  801634:	68 bf 36 80 00       	push   $0x8036bf
+  801639:	6a 23                	push   $0x23
+  80163b:	68 dc 36 80 00       	push   $0x8036dc
+  801640:	e8 30 f2 ff ff       	call   800875 <_panic>
+
+00801645 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  801645:	55                   	push   %ebp
+  801646:	89 e5                	mov    %esp,%ebp
+  801648:	57                   	push   %edi
+  801649:	56                   	push   %esi
+  80164a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80164b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801650:	b8 12 00 00 00       	mov    $0x12,%eax
+  801655:	89 d1                	mov    %edx,%ecx
+  801657:	89 d3                	mov    %edx,%ebx
+  801659:	89 d7                	mov    %edx,%edi
+  80165b:	89 d6                	mov    %edx,%esi
+  80165d:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  80165f:	5b                   	pop    %ebx
+  801660:	5e                   	pop    %esi
+  801661:	5f                   	pop    %edi
+  801662:	5d                   	pop    %ebp
+  801663:	c3                   	ret
+
+00801664 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801664:	55                   	push   %ebp
+  801665:	89 e5                	mov    %esp,%ebp
+  801667:	57                   	push   %edi
+  801668:	56                   	push   %esi
+  801669:	53                   	push   %ebx
+  80166a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80166d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801672:	8b 55 08             	mov    0x8(%ebp),%edx
+  801675:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801678:	b8 13 00 00 00       	mov    $0x13,%eax
+  80167d:	89 df                	mov    %ebx,%edi
+  80167f:	89 de                	mov    %ebx,%esi
+  801681:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801683:	85 c0                	test   %eax,%eax
+  801685:	7f 08                	jg     80168f <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801687:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168a:	5b                   	pop    %ebx
+  80168b:	5e                   	pop    %esi
+  80168c:	5f                   	pop    %edi
+  80168d:	5d                   	pop    %ebp
+  80168e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80168f:	83 ec 0c             	sub    $0xc,%esp
+  801692:	50                   	push   %eax
+  801693:	6a 13                	push   $0x13
+  801695:	68 bf 36 80 00       	push   $0x8036bf
+  80169a:	6a 23                	push   $0x23
+  80169c:	68 dc 36 80 00       	push   $0x8036dc
+  8016a1:	e8 cf f1 ff ff       	call   800875 <_panic>
+
+008016a6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	57                   	push   %edi
+  8016aa:	56                   	push   %esi
+  8016ab:	53                   	push   %ebx
+  8016ac:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8016af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ba:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016bf:	89 df                	mov    %ebx,%edi
+  8016c1:	89 de                	mov    %ebx,%esi
+  8016c3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016c5:	85 c0                	test   %eax,%eax
+  8016c7:	7f 08                	jg     8016d1 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8016c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016cc:	5b                   	pop    %ebx
+  8016cd:	5e                   	pop    %esi
+  8016ce:	5f                   	pop    %edi
+  8016cf:	5d                   	pop    %ebp
+  8016d0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016d1:	83 ec 0c             	sub    $0xc,%esp
+  8016d4:	50                   	push   %eax
+  8016d5:	6a 14                	push   $0x14
+  8016d7:	68 bf 36 80 00       	push   $0x8036bf
+  8016dc:	6a 23                	push   $0x23
+  8016de:	68 dc 36 80 00       	push   $0x8036dc
+  8016e3:	e8 8d f1 ff ff       	call   800875 <_panic>
+
+008016e8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8016e8:	55                   	push   %ebp
+  8016e9:	89 e5                	mov    %esp,%ebp
+  8016eb:	57                   	push   %edi
+  8016ec:	56                   	push   %esi
+  8016ed:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8016ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8016f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801701:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801704:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801706:	5b                   	pop    %ebx
+  801707:	5e                   	pop    %esi
+  801708:	5f                   	pop    %edi
+  801709:	5d                   	pop    %ebp
+  80170a:	c3                   	ret
+
+0080170b <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80170b:	55                   	push   %ebp
+  80170c:	89 e5                	mov    %esp,%ebp
+  80170e:	57                   	push   %edi
+  80170f:	56                   	push   %esi
+  801710:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801711:	8b 55 08             	mov    0x8(%ebp),%edx
+  801714:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801717:	b8 18 00 00 00       	mov    $0x18,%eax
+  80171c:	be 00 00 00 00       	mov    $0x0,%esi
+  801721:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801724:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801727:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801729:	5b                   	pop    %ebx
+  80172a:	5e                   	pop    %esi
+  80172b:	5f                   	pop    %edi
+  80172c:	5d                   	pop    %ebp
+  80172d:	c3                   	ret
+
+0080172e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80172e:	55                   	push   %ebp
+  80172f:	89 e5                	mov    %esp,%ebp
+  801731:	57                   	push   %edi
+  801732:	56                   	push   %esi
+  801733:	53                   	push   %ebx
+  801734:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801737:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80173c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801744:	89 cb                	mov    %ecx,%ebx
+  801746:	89 cf                	mov    %ecx,%edi
+  801748:	89 ce                	mov    %ecx,%esi
+  80174a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80174c:	85 c0                	test   %eax,%eax
+  80174e:	7f 08                	jg     801758 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801753:	5b                   	pop    %ebx
+  801754:	5e                   	pop    %esi
+  801755:	5f                   	pop    %edi
+  801756:	5d                   	pop    %ebp
+  801757:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801758:	83 ec 0c             	sub    $0xc,%esp
+  80175b:	50                   	push   %eax
+  80175c:	6a 19                	push   $0x19
+  80175e:	68 bf 36 80 00       	push   $0x8036bf
+  801763:	6a 23                	push   $0x23
+  801765:	68 dc 36 80 00       	push   $0x8036dc
+  80176a:	e8 06 f1 ff ff       	call   800875 <_panic>
+
+0080176f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80176f:	55                   	push   %ebp
+  801770:	89 e5                	mov    %esp,%ebp
+  801772:	57                   	push   %edi
+  801773:	56                   	push   %esi
+  801774:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801775:	ba 00 00 00 00       	mov    $0x0,%edx
+  80177a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80177f:	89 d1                	mov    %edx,%ecx
+  801781:	89 d3                	mov    %edx,%ebx
+  801783:	89 d7                	mov    %edx,%edi
+  801785:	89 d6                	mov    %edx,%esi
+  801787:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801789:	5b                   	pop    %ebx
+  80178a:	5e                   	pop    %esi
+  80178b:	5f                   	pop    %edi
+  80178c:	5d                   	pop    %ebp
+  80178d:	c3                   	ret
+
+0080178e <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  80178e:	55                   	push   %ebp
+  80178f:	89 e5                	mov    %esp,%ebp
+  801791:	57                   	push   %edi
+  801792:	56                   	push   %esi
+  801793:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801794:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801799:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80179f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8017a4:	89 df                	mov    %ebx,%edi
+  8017a6:	89 de                	mov    %ebx,%esi
+  8017a8:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8017aa:	5b                   	pop    %ebx
+  8017ab:	5e                   	pop    %esi
+  8017ac:	5f                   	pop    %edi
+  8017ad:	5d                   	pop    %ebp
+  8017ae:	c3                   	ret
+
+008017af <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8017af:	55                   	push   %ebp
+  8017b0:	89 e5                	mov    %esp,%ebp
+  8017b2:	57                   	push   %edi
+  8017b3:	56                   	push   %esi
+  8017b4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8017b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8017c5:	89 df                	mov    %ebx,%edi
+  8017c7:	89 de                	mov    %ebx,%esi
+  8017c9:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  8017cb:	5b                   	pop    %ebx
+  8017cc:	5e                   	pop    %esi
+  8017cd:	5f                   	pop    %edi
+  8017ce:	5d                   	pop    %ebp
+  8017cf:	c3                   	ret
+
+008017d0 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8017d0:	55                   	push   %ebp
+  8017d1:	89 e5                	mov    %esp,%ebp
+  8017d3:	53                   	push   %ebx
+  8017d4:	83 ec 04             	sub    $0x4,%esp
+  8017d7:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8017da:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  8017dc:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  8017df:	f6 c2 02             	test   $0x2,%dl
+  8017e2:	74 7b                	je     80185f <pgfault+0x8f>
+  8017e4:	89 c1                	mov    %eax,%ecx
+  8017e6:	c1 e9 0c             	shr    $0xc,%ecx
+  8017e9:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8017f0:	f6 c5 08             	test   $0x8,%ch
+  8017f3:	74 6a                	je     80185f <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8017f5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017fa:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8017fc:	83 ec 04             	sub    $0x4,%esp
+  8017ff:	6a 07                	push   $0x7
+  801801:	68 00 f0 7f 00       	push   $0x7ff000
+  801806:	6a 00                	push   $0x0
+  801808:	e8 9e fb ff ff       	call   8013ab <sys_page_alloc>
+  80180d:	83 c4 10             	add    $0x10,%esp
+  801810:	85 c0                	test   %eax,%eax
+  801812:	78 61                	js     801875 <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  801814:	83 ec 04             	sub    $0x4,%esp
+  801817:	68 00 10 00 00       	push   $0x1000
+  80181c:	53                   	push   %ebx
+  80181d:	68 00 f0 7f 00       	push   $0x7ff000
+  801822:	e8 9d f8 ff ff       	call   8010c4 <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  801827:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80182e:	53                   	push   %ebx
+  80182f:	6a 00                	push   $0x0
+  801831:	68 00 f0 7f 00       	push   $0x7ff000
+  801836:	6a 00                	push   $0x0
+  801838:	e8 f4 fb ff ff       	call   801431 <sys_page_map>
+  80183d:	83 c4 20             	add    $0x20,%esp
+  801840:	85 c0                	test   %eax,%eax
+  801842:	78 43                	js     801887 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  801844:	83 ec 08             	sub    $0x8,%esp
+  801847:	68 00 f0 7f 00       	push   $0x7ff000
+  80184c:	6a 00                	push   $0x0
+  80184e:	e8 20 fc ff ff       	call   801473 <sys_page_unmap>
+  801853:	83 c4 10             	add    $0x10,%esp
+  801856:	85 c0                	test   %eax,%eax
+  801858:	78 3f                	js     801899 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  80185a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80185d:	c9                   	leave
+  80185e:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  80185f:	83 ec 0c             	sub    $0xc,%esp
+  801862:	50                   	push   %eax
+  801863:	52                   	push   %edx
+  801864:	68 ea 36 80 00       	push   $0x8036ea
+  801869:	6a 19                	push   $0x19
+  80186b:	68 fb 36 80 00       	push   $0x8036fb
+  801870:	e8 00 f0 ff ff       	call   800875 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801875:	50                   	push   %eax
+  801876:	68 06 37 80 00       	push   $0x803706
+  80187b:	6a 24                	push   $0x24
+  80187d:	68 fb 36 80 00       	push   $0x8036fb
+  801882:	e8 ee ef ff ff       	call   800875 <_panic>
+		panic("sys_page_map: %e", r);
+  801887:	50                   	push   %eax
+  801888:	68 98 32 80 00       	push   $0x803298
+  80188d:	6a 29                	push   $0x29
+  80188f:	68 fb 36 80 00       	push   $0x8036fb
+  801894:	e8 dc ef ff ff       	call   800875 <_panic>
+		panic("sys_page_unmap: %e", r);
+  801899:	50                   	push   %eax
+  80189a:	68 19 37 80 00       	push   $0x803719
+  80189f:	6a 2c                	push   $0x2c
+  8018a1:	68 fb 36 80 00       	push   $0x8036fb
+  8018a6:	e8 ca ef ff ff       	call   800875 <_panic>
+
+008018ab <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  8018ab:	55                   	push   %ebp
+  8018ac:	89 e5                	mov    %esp,%ebp
+  8018ae:	57                   	push   %edi
+  8018af:	56                   	push   %esi
+  8018b0:	53                   	push   %ebx
+  8018b1:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8018b4:	68 d0 17 80 00       	push   $0x8017d0
+  8018b9:	e8 61 14 00 00       	call   802d1f <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  8018be:	83 c4 08             	add    $0x8,%esp
+  8018c1:	6a 01                	push   $0x1
+  8018c3:	6a 00                	push   $0x0
+  8018c5:	e8 9f fa ff ff       	call   801369 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  8018ca:	e8 7b fa ff ff       	call   80134a <sys_fork_cow>
+  8018cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  8018d2:	83 c4 10             	add    $0x10,%esp
+  8018d5:	85 c0                	test   %eax,%eax
+  8018d7:	74 2c                	je     801905 <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  8018d9:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8018dd:	0f 85 8b 01 00 00    	jne    801a6e <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8018e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018e8:	cd 30                	int    $0x30
+  8018ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8018ed:	85 c0                	test   %eax,%eax
+  8018ef:	78 30                	js     801921 <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  8018f1:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8018f6:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8018fb:	74 36                	je     801933 <fork+0x88>
+  8018fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801900:	e9 99 00 00 00       	jmp    80199e <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801905:	e8 02 fa ff ff       	call   80130c <sys_getenvid>
+  80190a:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80190f:	c1 e0 09             	shl    $0x9,%eax
+  801912:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801917:	a3 20 50 80 00       	mov    %eax,0x805020
+		return 0;
+  80191c:	e9 4d 01 00 00       	jmp    801a6e <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  801921:	50                   	push   %eax
+  801922:	68 2c 37 80 00       	push   $0x80372c
+  801927:	6a 7d                	push   $0x7d
+  801929:	68 fb 36 80 00       	push   $0x8036fb
+  80192e:	e8 42 ef ff ff       	call   800875 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801933:	e8 d4 f9 ff ff       	call   80130c <sys_getenvid>
+  801938:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80193d:	c1 e0 09             	shl    $0x9,%eax
+  801940:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801945:	a3 20 50 80 00       	mov    %eax,0x805020
+		return 0;
+  80194a:	e9 1f 01 00 00       	jmp    801a6e <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  80194f:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801956:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801959:	25 07 0e 00 00       	and    $0xe07,%eax
+  80195e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801961:	83 ec 0c             	sub    $0xc,%esp
+  801964:	50                   	push   %eax
+  801965:	56                   	push   %esi
+  801966:	ff 75 e4             	push   -0x1c(%ebp)
+  801969:	56                   	push   %esi
+  80196a:	6a 00                	push   $0x0
+  80196c:	e8 c0 fa ff ff       	call   801431 <sys_page_map>
+  801971:	83 c4 20             	add    $0x20,%esp
+  801974:	85 c0                	test   %eax,%eax
+  801976:	0f 88 98 00 00 00    	js     801a14 <fork+0x169>
+	if (perm & PTE_COW) {
+  80197c:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801983:	0f 85 61 01 00 00    	jne    801aea <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801989:	83 c7 01             	add    $0x1,%edi
+  80198c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801992:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  801998:	0f 84 88 00 00 00    	je     801a26 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  80199e:	89 f0                	mov    %esi,%eax
+  8019a0:	c1 e8 16             	shr    $0x16,%eax
+  8019a3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8019aa:	25 81 00 00 00       	and    $0x81,%eax
+  8019af:	83 f8 01             	cmp    $0x1,%eax
+  8019b2:	75 d5                	jne    801989 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  8019b4:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  8019bb:	a8 01                	test   $0x1,%al
+  8019bd:	74 ca                	je     801989 <fork+0xde>
+  8019bf:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  8019c5:	74 c2                	je     801989 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  8019c7:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  8019c9:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8019d0:	f6 c4 04             	test   $0x4,%ah
+  8019d3:	0f 85 76 ff ff ff    	jne    80194f <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  8019d9:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8019e0:	a8 02                	test   $0x2,%al
+  8019e2:	0f 85 dc 00 00 00    	jne    801ac4 <fork+0x219>
+  8019e8:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8019ef:	f6 c4 08             	test   $0x8,%ah
+  8019f2:	0f 85 cc 00 00 00    	jne    801ac4 <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8019f8:	83 ec 0c             	sub    $0xc,%esp
+  8019fb:	6a 05                	push   $0x5
+  8019fd:	56                   	push   %esi
+  8019fe:	ff 75 e4             	push   -0x1c(%ebp)
+  801a01:	56                   	push   %esi
+  801a02:	6a 00                	push   $0x0
+  801a04:	e8 28 fa ff ff       	call   801431 <sys_page_map>
+  801a09:	83 c4 20             	add    $0x20,%esp
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	0f 89 75 ff ff ff    	jns    801989 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  801a14:	50                   	push   %eax
+  801a15:	68 98 32 80 00       	push   $0x803298
+  801a1a:	6a 48                	push   $0x48
+  801a1c:	68 fb 36 80 00       	push   $0x8036fb
+  801a21:	e8 4f ee ff ff       	call   800875 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  801a26:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  801a29:	83 ec 04             	sub    $0x4,%esp
+  801a2c:	6a 07                	push   $0x7
+  801a2e:	68 00 f0 bf ee       	push   $0xeebff000
+  801a33:	53                   	push   %ebx
+  801a34:	e8 72 f9 ff ff       	call   8013ab <sys_page_alloc>
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	85 c0                	test   %eax,%eax
+  801a3e:	78 39                	js     801a79 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801a40:	a1 20 50 80 00       	mov    0x805020,%eax
+  801a45:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  801a4b:	83 ec 08             	sub    $0x8,%esp
+  801a4e:	50                   	push   %eax
+  801a4f:	53                   	push   %ebx
+  801a50:	e8 51 fc ff ff       	call   8016a6 <sys_env_set_pgfault_upcall>
+  801a55:	83 c4 10             	add    $0x10,%esp
+  801a58:	85 c0                	test   %eax,%eax
+  801a5a:	78 36                	js     801a92 <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  801a5c:	83 ec 08             	sub    $0x8,%esp
+  801a5f:	6a 02                	push   $0x2
+  801a61:	53                   	push   %ebx
+  801a62:	e8 18 fb ff ff       	call   80157f <sys_env_set_status>
+  801a67:	83 c4 10             	add    $0x10,%esp
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	78 3d                	js     801aab <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  801a6e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a74:	5b                   	pop    %ebx
+  801a75:	5e                   	pop    %esi
+  801a76:	5f                   	pop    %edi
+  801a77:	5d                   	pop    %ebp
+  801a78:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  801a79:	83 ec 0c             	sub    $0xc,%esp
+  801a7c:	53                   	push   %ebx
+  801a7d:	50                   	push   %eax
+  801a7e:	68 54 37 80 00       	push   $0x803754
+  801a83:	68 92 00 00 00       	push   $0x92
+  801a88:	68 fb 36 80 00       	push   $0x8036fb
+  801a8d:	e8 e3 ed ff ff       	call   800875 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  801a92:	83 ec 0c             	sub    $0xc,%esp
+  801a95:	53                   	push   %ebx
+  801a96:	50                   	push   %eax
+  801a97:	68 78 37 80 00       	push   $0x803778
+  801a9c:	68 95 00 00 00       	push   $0x95
+  801aa1:	68 fb 36 80 00       	push   $0x8036fb
+  801aa6:	e8 ca ed ff ff       	call   800875 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  801aab:	83 ec 0c             	sub    $0xc,%esp
+  801aae:	53                   	push   %ebx
+  801aaf:	50                   	push   %eax
+  801ab0:	68 a8 37 80 00       	push   $0x8037a8
+  801ab5:	68 98 00 00 00       	push   $0x98
+  801aba:	68 fb 36 80 00       	push   $0x8036fb
+  801abf:	e8 b1 ed ff ff       	call   800875 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801ac4:	83 ec 0c             	sub    $0xc,%esp
+  801ac7:	68 05 08 00 00       	push   $0x805
+  801acc:	53                   	push   %ebx
+  801acd:	ff 75 e4             	push   -0x1c(%ebp)
+  801ad0:	53                   	push   %ebx
+  801ad1:	6a 00                	push   $0x0
+  801ad3:	e8 59 f9 ff ff       	call   801431 <sys_page_map>
+  801ad8:	83 c4 20             	add    $0x20,%esp
+  801adb:	85 c0                	test   %eax,%eax
+  801add:	0f 88 31 ff ff ff    	js     801a14 <fork+0x169>
+		perm |= PTE_COW;
+  801ae3:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  801aea:	83 ec 0c             	sub    $0xc,%esp
+  801aed:	ff 75 e0             	push   -0x20(%ebp)
+  801af0:	53                   	push   %ebx
+  801af1:	6a 00                	push   $0x0
+  801af3:	53                   	push   %ebx
+  801af4:	6a 00                	push   $0x0
+  801af6:	e8 36 f9 ff ff       	call   801431 <sys_page_map>
+  801afb:	83 c4 20             	add    $0x20,%esp
+  801afe:	85 c0                	test   %eax,%eax
+  801b00:	0f 89 83 fe ff ff    	jns    801989 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  801b06:	50                   	push   %eax
+  801b07:	68 98 32 80 00       	push   $0x803298
+  801b0c:	6a 4c                	push   $0x4c
+  801b0e:	68 fb 36 80 00       	push   $0x8036fb
+  801b13:	e8 5d ed ff ff       	call   800875 <_panic>
+
+00801b18 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801b18:	55                   	push   %ebp
+  801b19:	89 e5                	mov    %esp,%ebp
+  801b1b:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801b1e:	68 3c 37 80 00       	push   $0x80373c
+  801b23:	68 a0 00 00 00       	push   $0xa0
+  801b28:	68 fb 36 80 00       	push   $0x8036fb
+  801b2d:	e8 43 ed ff ff       	call   800875 <_panic>
+
+00801b32 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801b32:	55                   	push   %ebp
+  801b33:	89 e5                	mov    %esp,%ebp
+  801b35:	57                   	push   %edi
+  801b36:	56                   	push   %esi
+  801b37:	53                   	push   %ebx
+  801b38:	83 ec 18             	sub    $0x18,%esp
+  801b3b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b3e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b41:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801b44:	85 db                	test   %ebx,%ebx
+  801b46:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801b4b:	0f 45 c3             	cmovne %ebx,%eax
+  801b4e:	50                   	push   %eax
+  801b4f:	e8 da fb ff ff       	call   80172e <sys_ipc_recv>
+
+	if (from_env_store)
+  801b54:	83 c4 10             	add    $0x10,%esp
+  801b57:	85 ff                	test   %edi,%edi
+  801b59:	74 17                	je     801b72 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801b5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b60:	85 c0                	test   %eax,%eax
+  801b62:	75 0c                	jne    801b70 <ipc_recv+0x3e>
+  801b64:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801b6a:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  801b70:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  801b72:	85 f6                	test   %esi,%esi
+  801b74:	74 2e                	je     801ba4 <ipc_recv+0x72>
+		if (!r && pg)
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	75 24                	jne    801b9e <ipc_recv+0x6c>
+  801b7a:	85 db                	test   %ebx,%ebx
+  801b7c:	74 20                	je     801b9e <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  801b7e:	a1 20 50 80 00       	mov    0x805020,%eax
+  801b83:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  801b89:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  801b8b:	a1 20 50 80 00       	mov    0x805020,%eax
+  801b90:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  801b96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b99:	5b                   	pop    %ebx
+  801b9a:	5e                   	pop    %esi
+  801b9b:	5f                   	pop    %edi
+  801b9c:	5d                   	pop    %ebp
+  801b9d:	c3                   	ret
+			*perm_store = 0;
+  801b9e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  801ba4:	85 c0                	test   %eax,%eax
+  801ba6:	75 ee                	jne    801b96 <ipc_recv+0x64>
+  801ba8:	eb e1                	jmp    801b8b <ipc_recv+0x59>
+
+00801baa <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801baa:	55                   	push   %ebp
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	57                   	push   %edi
+  801bae:	56                   	push   %esi
+  801baf:	53                   	push   %ebx
+  801bb0:	83 ec 0c             	sub    $0xc,%esp
+  801bb3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801bb6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  801bbc:	85 db                	test   %ebx,%ebx
+  801bbe:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801bc3:	0f 44 d8             	cmove  %eax,%ebx
+  801bc6:	ff 75 14             	push   0x14(%ebp)
+  801bc9:	53                   	push   %ebx
+  801bca:	56                   	push   %esi
+  801bcb:	57                   	push   %edi
+  801bcc:	e8 3a fb ff ff       	call   80170b <sys_ipc_try_send_yield>
+  801bd1:	83 c4 10             	add    $0x10,%esp
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	79 1e                	jns    801bf6 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  801bd8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801bdb:	75 07                	jne    801be4 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  801bdd:	e8 49 f7 ff ff       	call   80132b <sys_yield>
+  801be2:	eb e2                	jmp    801bc6 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  801be4:	50                   	push   %eax
+  801be5:	68 ce 37 80 00       	push   $0x8037ce
+  801bea:	6a 3d                	push   $0x3d
+  801bec:	68 e3 37 80 00       	push   $0x8037e3
+  801bf1:	e8 7f ec ff ff       	call   800875 <_panic>
+	}
+}
+  801bf6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bf9:	5b                   	pop    %ebx
+  801bfa:	5e                   	pop    %esi
+  801bfb:	5f                   	pop    %edi
+  801bfc:	5d                   	pop    %ebp
+  801bfd:	c3                   	ret
+
+00801bfe <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801bfe:	55                   	push   %ebp
+  801bff:	89 e5                	mov    %esp,%ebp
+  801c01:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  801c04:	ff 75 08             	push   0x8(%ebp)
+  801c07:	e8 9f f6 ff ff       	call   8012ab <sys_env_find>
+}
+  801c0c:	c9                   	leave
+  801c0d:	c3                   	ret
+
+00801c0e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c14:	05 00 00 00 30       	add    $0x30000000,%eax
+  801c19:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801c1c:	5d                   	pop    %ebp
+  801c1d:	c3                   	ret
+
+00801c1e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801c1e:	55                   	push   %ebp
+  801c1f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c21:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c24:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801c29:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c2e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801c33:	5d                   	pop    %ebp
+  801c34:	c3                   	ret
+
+00801c35 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801c35:	55                   	push   %ebp
+  801c36:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801c38:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801c3d:	eb 02                	jmp    801c41 <fd_alloc+0xc>
+  801c3f:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801c41:	89 c2                	mov    %eax,%edx
+  801c43:	c1 ea 16             	shr    $0x16,%edx
+  801c46:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c4d:	f6 c2 01             	test   $0x1,%dl
+  801c50:	74 2b                	je     801c7d <fd_alloc+0x48>
+  801c52:	89 c2                	mov    %eax,%edx
+  801c54:	c1 ea 0c             	shr    $0xc,%edx
+  801c57:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801c5e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801c64:	f6 c1 01             	test   $0x1,%cl
+  801c67:	74 14                	je     801c7d <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801c69:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801c6f:	75 ce                	jne    801c3f <fd_alloc+0xa>
+  801c71:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801c76:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801c7b:	eb 05                	jmp    801c82 <fd_alloc+0x4d>
+			return 0;
+  801c7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801c82:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c85:	89 02                	mov    %eax,(%edx)
+}
+  801c87:	89 c8                	mov    %ecx,%eax
+  801c89:	5d                   	pop    %ebp
+  801c8a:	c3                   	ret
+
+00801c8b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801c8b:	55                   	push   %ebp
+  801c8c:	89 e5                	mov    %esp,%ebp
+  801c8e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801c91:	83 f8 1f             	cmp    $0x1f,%eax
+  801c94:	77 30                	ja     801cc6 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801c96:	c1 e0 0c             	shl    $0xc,%eax
+  801c99:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801c9e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801ca4:	f6 c2 01             	test   $0x1,%dl
+  801ca7:	74 24                	je     801ccd <fd_lookup+0x42>
+  801ca9:	89 c2                	mov    %eax,%edx
+  801cab:	c1 ea 0c             	shr    $0xc,%edx
+  801cae:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801cb5:	f6 c2 01             	test   $0x1,%dl
+  801cb8:	74 1a                	je     801cd4 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801cba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cbd:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cc4:	5d                   	pop    %ebp
+  801cc5:	c3                   	ret
+		return -E_INVAL;
+  801cc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ccb:	eb f7                	jmp    801cc4 <fd_lookup+0x39>
+		return -E_INVAL;
+  801ccd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cd2:	eb f0                	jmp    801cc4 <fd_lookup+0x39>
+  801cd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cd9:	eb e9                	jmp    801cc4 <fd_lookup+0x39>
+
+00801cdb <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801cdb:	55                   	push   %ebp
+  801cdc:	89 e5                	mov    %esp,%ebp
+  801cde:	53                   	push   %ebx
+  801cdf:	83 ec 04             	sub    $0x4,%esp
+  801ce2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cea:	eb 03                	jmp    801cef <dev_lookup+0x14>
+  801cec:	83 c0 01             	add    $0x1,%eax
+  801cef:	8b 1c 85 6c 38 80 00 	mov    0x80386c(,%eax,4),%ebx
+  801cf6:	85 db                	test   %ebx,%ebx
+  801cf8:	74 0b                	je     801d05 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801cfa:	39 13                	cmp    %edx,(%ebx)
+  801cfc:	75 ee                	jne    801cec <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d03:	eb 1f                	jmp    801d24 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d05:	a1 20 50 80 00       	mov    0x805020,%eax
+  801d0a:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801d0d:	83 ec 04             	sub    $0x4,%esp
+  801d10:	52                   	push   %edx
+  801d11:	50                   	push   %eax
+  801d12:	68 f0 37 80 00       	push   $0x8037f0
+  801d17:	e8 34 ec ff ff       	call   800950 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801d1c:	83 c4 10             	add    $0x10,%esp
+  801d1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801d24:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d27:	89 1a                	mov    %ebx,(%edx)
+}
+  801d29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d2c:	c9                   	leave
+  801d2d:	c3                   	ret
+
+00801d2e <fd_close>:
+{
+  801d2e:	55                   	push   %ebp
+  801d2f:	89 e5                	mov    %esp,%ebp
+  801d31:	57                   	push   %edi
+  801d32:	56                   	push   %esi
+  801d33:	53                   	push   %ebx
+  801d34:	83 ec 24             	sub    $0x24,%esp
+  801d37:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d3a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d3d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d40:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d41:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d47:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d4a:	50                   	push   %eax
+  801d4b:	e8 3b ff ff ff       	call   801c8b <fd_lookup>
+  801d50:	89 c3                	mov    %eax,%ebx
+  801d52:	83 c4 10             	add    $0x10,%esp
+  801d55:	85 c0                	test   %eax,%eax
+  801d57:	78 05                	js     801d5e <fd_close+0x30>
+	    || fd != fd2)
+  801d59:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d5c:	74 16                	je     801d74 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801d5e:	89 f8                	mov    %edi,%eax
+  801d60:	84 c0                	test   %al,%al
+  801d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d67:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801d6a:	89 d8                	mov    %ebx,%eax
+  801d6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d6f:	5b                   	pop    %ebx
+  801d70:	5e                   	pop    %esi
+  801d71:	5f                   	pop    %edi
+  801d72:	5d                   	pop    %ebp
+  801d73:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d74:	83 ec 08             	sub    $0x8,%esp
+  801d77:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d7a:	50                   	push   %eax
+  801d7b:	ff 36                	push   (%esi)
+  801d7d:	e8 59 ff ff ff       	call   801cdb <dev_lookup>
+  801d82:	89 c3                	mov    %eax,%ebx
+  801d84:	83 c4 10             	add    $0x10,%esp
+  801d87:	85 c0                	test   %eax,%eax
+  801d89:	78 1a                	js     801da5 <fd_close+0x77>
+		if (dev->dev_close)
+  801d8b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d8e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801d91:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801d96:	85 c0                	test   %eax,%eax
+  801d98:	74 0b                	je     801da5 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801d9a:	83 ec 0c             	sub    $0xc,%esp
+  801d9d:	56                   	push   %esi
+  801d9e:	ff d0                	call   *%eax
+  801da0:	89 c3                	mov    %eax,%ebx
+  801da2:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801da5:	83 ec 08             	sub    $0x8,%esp
+  801da8:	56                   	push   %esi
+  801da9:	6a 00                	push   $0x0
+  801dab:	e8 c3 f6 ff ff       	call   801473 <sys_page_unmap>
+	return r;
+  801db0:	83 c4 10             	add    $0x10,%esp
+  801db3:	eb b5                	jmp    801d6a <fd_close+0x3c>
+
+00801db5 <close>:
+
+int
+close(int fdnum)
+{
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dbb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dbe:	50                   	push   %eax
+  801dbf:	ff 75 08             	push   0x8(%ebp)
+  801dc2:	e8 c4 fe ff ff       	call   801c8b <fd_lookup>
+  801dc7:	83 c4 10             	add    $0x10,%esp
+  801dca:	85 c0                	test   %eax,%eax
+  801dcc:	79 02                	jns    801dd0 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801dce:	c9                   	leave
+  801dcf:	c3                   	ret
+		return fd_close(fd, 1);
+  801dd0:	83 ec 08             	sub    $0x8,%esp
+  801dd3:	6a 01                	push   $0x1
+  801dd5:	ff 75 f4             	push   -0xc(%ebp)
+  801dd8:	e8 51 ff ff ff       	call   801d2e <fd_close>
+  801ddd:	83 c4 10             	add    $0x10,%esp
+  801de0:	eb ec                	jmp    801dce <close+0x19>
+
+00801de2 <close_all>:
+
+void
+close_all(void)
+{
+  801de2:	55                   	push   %ebp
+  801de3:	89 e5                	mov    %esp,%ebp
+  801de5:	53                   	push   %ebx
+  801de6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801de9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801dee:	83 ec 0c             	sub    $0xc,%esp
+  801df1:	53                   	push   %ebx
+  801df2:	e8 be ff ff ff       	call   801db5 <close>
+	for (i = 0; i < MAXFD; i++)
+  801df7:	83 c3 01             	add    $0x1,%ebx
+  801dfa:	83 c4 10             	add    $0x10,%esp
+  801dfd:	83 fb 20             	cmp    $0x20,%ebx
+  801e00:	75 ec                	jne    801dee <close_all+0xc>
+}
+  801e02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e05:	c9                   	leave
+  801e06:	c3                   	ret
+
+00801e07 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801e07:	55                   	push   %ebp
+  801e08:	89 e5                	mov    %esp,%ebp
+  801e0a:	57                   	push   %edi
+  801e0b:	56                   	push   %esi
+  801e0c:	53                   	push   %ebx
+  801e0d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801e10:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e13:	50                   	push   %eax
+  801e14:	ff 75 08             	push   0x8(%ebp)
+  801e17:	e8 6f fe ff ff       	call   801c8b <fd_lookup>
+  801e1c:	89 c3                	mov    %eax,%ebx
+  801e1e:	83 c4 10             	add    $0x10,%esp
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	78 7f                	js     801ea4 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801e25:	83 ec 0c             	sub    $0xc,%esp
+  801e28:	ff 75 0c             	push   0xc(%ebp)
+  801e2b:	e8 85 ff ff ff       	call   801db5 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801e30:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e33:	c1 e6 0c             	shl    $0xc,%esi
+  801e36:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801e3c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e3f:	89 3c 24             	mov    %edi,(%esp)
+  801e42:	e8 d7 fd ff ff       	call   801c1e <fd2data>
+  801e47:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801e49:	89 34 24             	mov    %esi,(%esp)
+  801e4c:	e8 cd fd ff ff       	call   801c1e <fd2data>
+  801e51:	83 c4 10             	add    $0x10,%esp
+  801e54:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801e57:	89 d8                	mov    %ebx,%eax
+  801e59:	c1 e8 16             	shr    $0x16,%eax
+  801e5c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e63:	a8 01                	test   $0x1,%al
+  801e65:	74 11                	je     801e78 <dup+0x71>
+  801e67:	89 d8                	mov    %ebx,%eax
+  801e69:	c1 e8 0c             	shr    $0xc,%eax
+  801e6c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e73:	f6 c2 01             	test   $0x1,%dl
+  801e76:	75 36                	jne    801eae <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801e78:	89 f8                	mov    %edi,%eax
+  801e7a:	c1 e8 0c             	shr    $0xc,%eax
+  801e7d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e84:	83 ec 0c             	sub    $0xc,%esp
+  801e87:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e8c:	50                   	push   %eax
+  801e8d:	56                   	push   %esi
+  801e8e:	6a 00                	push   $0x0
+  801e90:	57                   	push   %edi
+  801e91:	6a 00                	push   $0x0
+  801e93:	e8 99 f5 ff ff       	call   801431 <sys_page_map>
+  801e98:	89 c3                	mov    %eax,%ebx
+  801e9a:	83 c4 20             	add    $0x20,%esp
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	78 33                	js     801ed4 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801ea1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801ea4:	89 d8                	mov    %ebx,%eax
+  801ea6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ea9:	5b                   	pop    %ebx
+  801eaa:	5e                   	pop    %esi
+  801eab:	5f                   	pop    %edi
+  801eac:	5d                   	pop    %ebp
+  801ead:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801eae:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801eb5:	83 ec 0c             	sub    $0xc,%esp
+  801eb8:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ebd:	50                   	push   %eax
+  801ebe:	ff 75 d4             	push   -0x2c(%ebp)
+  801ec1:	6a 00                	push   $0x0
+  801ec3:	53                   	push   %ebx
+  801ec4:	6a 00                	push   $0x0
+  801ec6:	e8 66 f5 ff ff       	call   801431 <sys_page_map>
+  801ecb:	89 c3                	mov    %eax,%ebx
+  801ecd:	83 c4 20             	add    $0x20,%esp
+  801ed0:	85 c0                	test   %eax,%eax
+  801ed2:	79 a4                	jns    801e78 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ed4:	83 ec 08             	sub    $0x8,%esp
+  801ed7:	56                   	push   %esi
+  801ed8:	6a 00                	push   $0x0
+  801eda:	e8 94 f5 ff ff       	call   801473 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801edf:	83 c4 08             	add    $0x8,%esp
+  801ee2:	ff 75 d4             	push   -0x2c(%ebp)
+  801ee5:	6a 00                	push   $0x0
+  801ee7:	e8 87 f5 ff ff       	call   801473 <sys_page_unmap>
+	return r;
+  801eec:	83 c4 10             	add    $0x10,%esp
+  801eef:	eb b3                	jmp    801ea4 <dup+0x9d>
+
+00801ef1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ef1:	55                   	push   %ebp
+  801ef2:	89 e5                	mov    %esp,%ebp
+  801ef4:	56                   	push   %esi
+  801ef5:	53                   	push   %ebx
+  801ef6:	83 ec 18             	sub    $0x18,%esp
+  801ef9:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801efc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801eff:	50                   	push   %eax
+  801f00:	56                   	push   %esi
+  801f01:	e8 85 fd ff ff       	call   801c8b <fd_lookup>
+  801f06:	83 c4 10             	add    $0x10,%esp
+  801f09:	85 c0                	test   %eax,%eax
+  801f0b:	78 3c                	js     801f49 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f0d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801f10:	83 ec 08             	sub    $0x8,%esp
+  801f13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f16:	50                   	push   %eax
+  801f17:	ff 33                	push   (%ebx)
+  801f19:	e8 bd fd ff ff       	call   801cdb <dev_lookup>
+  801f1e:	83 c4 10             	add    $0x10,%esp
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	78 24                	js     801f49 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f25:	8b 43 08             	mov    0x8(%ebx),%eax
+  801f28:	83 e0 03             	and    $0x3,%eax
+  801f2b:	83 f8 01             	cmp    $0x1,%eax
+  801f2e:	74 20                	je     801f50 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801f30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f33:	8b 40 08             	mov    0x8(%eax),%eax
+  801f36:	85 c0                	test   %eax,%eax
+  801f38:	74 37                	je     801f71 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801f3a:	83 ec 04             	sub    $0x4,%esp
+  801f3d:	ff 75 10             	push   0x10(%ebp)
+  801f40:	ff 75 0c             	push   0xc(%ebp)
+  801f43:	53                   	push   %ebx
+  801f44:	ff d0                	call   *%eax
+  801f46:	83 c4 10             	add    $0x10,%esp
+}
+  801f49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f4c:	5b                   	pop    %ebx
+  801f4d:	5e                   	pop    %esi
+  801f4e:	5d                   	pop    %ebp
+  801f4f:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f50:	a1 20 50 80 00       	mov    0x805020,%eax
+  801f55:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801f58:	83 ec 04             	sub    $0x4,%esp
+  801f5b:	56                   	push   %esi
+  801f5c:	50                   	push   %eax
+  801f5d:	68 31 38 80 00       	push   $0x803831
+  801f62:	e8 e9 e9 ff ff       	call   800950 <cprintf>
+		return -E_INVAL;
+  801f67:	83 c4 10             	add    $0x10,%esp
+  801f6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f6f:	eb d8                	jmp    801f49 <read+0x58>
+		return -E_NOT_SUPP;
+  801f71:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f76:	eb d1                	jmp    801f49 <read+0x58>
+
+00801f78 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	57                   	push   %edi
+  801f7c:	56                   	push   %esi
+  801f7d:	53                   	push   %ebx
+  801f7e:	83 ec 0c             	sub    $0xc,%esp
+  801f81:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f84:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f8c:	eb 02                	jmp    801f90 <readn+0x18>
+  801f8e:	01 c3                	add    %eax,%ebx
+  801f90:	39 f3                	cmp    %esi,%ebx
+  801f92:	73 21                	jae    801fb5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f94:	83 ec 04             	sub    $0x4,%esp
+  801f97:	89 f0                	mov    %esi,%eax
+  801f99:	29 d8                	sub    %ebx,%eax
+  801f9b:	50                   	push   %eax
+  801f9c:	89 d8                	mov    %ebx,%eax
+  801f9e:	03 45 0c             	add    0xc(%ebp),%eax
+  801fa1:	50                   	push   %eax
+  801fa2:	57                   	push   %edi
+  801fa3:	e8 49 ff ff ff       	call   801ef1 <read>
+		if (m < 0)
+  801fa8:	83 c4 10             	add    $0x10,%esp
+  801fab:	85 c0                	test   %eax,%eax
+  801fad:	78 04                	js     801fb3 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801faf:	75 dd                	jne    801f8e <readn+0x16>
+  801fb1:	eb 02                	jmp    801fb5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801fb3:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801fb5:	89 d8                	mov    %ebx,%eax
+  801fb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fba:	5b                   	pop    %ebx
+  801fbb:	5e                   	pop    %esi
+  801fbc:	5f                   	pop    %edi
+  801fbd:	5d                   	pop    %ebp
+  801fbe:	c3                   	ret
+
+00801fbf <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801fbf:	55                   	push   %ebp
+  801fc0:	89 e5                	mov    %esp,%ebp
+  801fc2:	56                   	push   %esi
+  801fc3:	53                   	push   %ebx
+  801fc4:	83 ec 18             	sub    $0x18,%esp
+  801fc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fcd:	50                   	push   %eax
+  801fce:	53                   	push   %ebx
+  801fcf:	e8 b7 fc ff ff       	call   801c8b <fd_lookup>
+  801fd4:	83 c4 10             	add    $0x10,%esp
+  801fd7:	85 c0                	test   %eax,%eax
+  801fd9:	78 37                	js     802012 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fdb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fde:	83 ec 08             	sub    $0x8,%esp
+  801fe1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fe4:	50                   	push   %eax
+  801fe5:	ff 36                	push   (%esi)
+  801fe7:	e8 ef fc ff ff       	call   801cdb <dev_lookup>
+  801fec:	83 c4 10             	add    $0x10,%esp
+  801fef:	85 c0                	test   %eax,%eax
+  801ff1:	78 1f                	js     802012 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ff3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ff7:	74 20                	je     802019 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801ff9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ffc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fff:	85 c0                	test   %eax,%eax
+  802001:	74 37                	je     80203a <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802003:	83 ec 04             	sub    $0x4,%esp
+  802006:	ff 75 10             	push   0x10(%ebp)
+  802009:	ff 75 0c             	push   0xc(%ebp)
+  80200c:	56                   	push   %esi
+  80200d:	ff d0                	call   *%eax
+  80200f:	83 c4 10             	add    $0x10,%esp
+}
+  802012:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802015:	5b                   	pop    %ebx
+  802016:	5e                   	pop    %esi
+  802017:	5d                   	pop    %ebp
+  802018:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802019:	a1 20 50 80 00       	mov    0x805020,%eax
+  80201e:	8b 40 4c             	mov    0x4c(%eax),%eax
+  802021:	83 ec 04             	sub    $0x4,%esp
+  802024:	53                   	push   %ebx
+  802025:	50                   	push   %eax
+  802026:	68 4d 38 80 00       	push   $0x80384d
+  80202b:	e8 20 e9 ff ff       	call   800950 <cprintf>
+		return -E_INVAL;
+  802030:	83 c4 10             	add    $0x10,%esp
+  802033:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802038:	eb d8                	jmp    802012 <write+0x53>
+		return -E_NOT_SUPP;
+  80203a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80203f:	eb d1                	jmp    802012 <write+0x53>
+
+00802041 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802041:	55                   	push   %ebp
+  802042:	89 e5                	mov    %esp,%ebp
+  802044:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802047:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80204a:	50                   	push   %eax
+  80204b:	ff 75 08             	push   0x8(%ebp)
+  80204e:	e8 38 fc ff ff       	call   801c8b <fd_lookup>
+  802053:	83 c4 10             	add    $0x10,%esp
+  802056:	85 c0                	test   %eax,%eax
+  802058:	78 0e                	js     802068 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80205a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80205d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802060:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802063:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802068:	c9                   	leave
+  802069:	c3                   	ret
+
+0080206a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80206a:	55                   	push   %ebp
+  80206b:	89 e5                	mov    %esp,%ebp
+  80206d:	56                   	push   %esi
+  80206e:	53                   	push   %ebx
+  80206f:	83 ec 18             	sub    $0x18,%esp
+  802072:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802075:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802078:	50                   	push   %eax
+  802079:	53                   	push   %ebx
+  80207a:	e8 0c fc ff ff       	call   801c8b <fd_lookup>
+  80207f:	83 c4 10             	add    $0x10,%esp
+  802082:	85 c0                	test   %eax,%eax
+  802084:	78 34                	js     8020ba <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802086:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802089:	83 ec 08             	sub    $0x8,%esp
+  80208c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80208f:	50                   	push   %eax
+  802090:	ff 36                	push   (%esi)
+  802092:	e8 44 fc ff ff       	call   801cdb <dev_lookup>
+  802097:	83 c4 10             	add    $0x10,%esp
+  80209a:	85 c0                	test   %eax,%eax
+  80209c:	78 1c                	js     8020ba <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80209e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8020a2:	74 1d                	je     8020c1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8020a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020a7:	8b 40 18             	mov    0x18(%eax),%eax
+  8020aa:	85 c0                	test   %eax,%eax
+  8020ac:	74 34                	je     8020e2 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8020ae:	83 ec 08             	sub    $0x8,%esp
+  8020b1:	ff 75 0c             	push   0xc(%ebp)
+  8020b4:	56                   	push   %esi
+  8020b5:	ff d0                	call   *%eax
+  8020b7:	83 c4 10             	add    $0x10,%esp
+}
+  8020ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020bd:	5b                   	pop    %ebx
+  8020be:	5e                   	pop    %esi
+  8020bf:	5d                   	pop    %ebp
+  8020c0:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8020c1:	a1 20 50 80 00       	mov    0x805020,%eax
+  8020c6:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020c9:	83 ec 04             	sub    $0x4,%esp
+  8020cc:	53                   	push   %ebx
+  8020cd:	50                   	push   %eax
+  8020ce:	68 10 38 80 00       	push   $0x803810
+  8020d3:	e8 78 e8 ff ff       	call   800950 <cprintf>
+		return -E_INVAL;
+  8020d8:	83 c4 10             	add    $0x10,%esp
+  8020db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020e0:	eb d8                	jmp    8020ba <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8020e2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020e7:	eb d1                	jmp    8020ba <ftruncate+0x50>
+
+008020e9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8020e9:	55                   	push   %ebp
+  8020ea:	89 e5                	mov    %esp,%ebp
+  8020ec:	56                   	push   %esi
+  8020ed:	53                   	push   %ebx
+  8020ee:	83 ec 18             	sub    $0x18,%esp
+  8020f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020f4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020f7:	50                   	push   %eax
+  8020f8:	ff 75 08             	push   0x8(%ebp)
+  8020fb:	e8 8b fb ff ff       	call   801c8b <fd_lookup>
+  802100:	83 c4 10             	add    $0x10,%esp
+  802103:	85 c0                	test   %eax,%eax
+  802105:	78 49                	js     802150 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802107:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80210a:	83 ec 08             	sub    $0x8,%esp
+  80210d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802110:	50                   	push   %eax
+  802111:	ff 36                	push   (%esi)
+  802113:	e8 c3 fb ff ff       	call   801cdb <dev_lookup>
+  802118:	83 c4 10             	add    $0x10,%esp
+  80211b:	85 c0                	test   %eax,%eax
+  80211d:	78 31                	js     802150 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80211f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802122:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802126:	74 2f                	je     802157 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802128:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80212b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802132:	00 00 00 
+	stat->st_isdir = 0;
+  802135:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80213c:	00 00 00 
+	stat->st_dev = dev;
+  80213f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802145:	83 ec 08             	sub    $0x8,%esp
+  802148:	53                   	push   %ebx
+  802149:	56                   	push   %esi
+  80214a:	ff 50 14             	call   *0x14(%eax)
+  80214d:	83 c4 10             	add    $0x10,%esp
+}
+  802150:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802153:	5b                   	pop    %ebx
+  802154:	5e                   	pop    %esi
+  802155:	5d                   	pop    %ebp
+  802156:	c3                   	ret
+		return -E_NOT_SUPP;
+  802157:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80215c:	eb f2                	jmp    802150 <fstat+0x67>
+
+0080215e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80215e:	55                   	push   %ebp
+  80215f:	89 e5                	mov    %esp,%ebp
+  802161:	56                   	push   %esi
+  802162:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802163:	83 ec 08             	sub    $0x8,%esp
+  802166:	6a 00                	push   $0x0
+  802168:	ff 75 08             	push   0x8(%ebp)
+  80216b:	e8 e4 01 00 00       	call   802354 <open>
+  802170:	89 c3                	mov    %eax,%ebx
+  802172:	83 c4 10             	add    $0x10,%esp
+  802175:	85 c0                	test   %eax,%eax
+  802177:	78 1b                	js     802194 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802179:	83 ec 08             	sub    $0x8,%esp
+  80217c:	ff 75 0c             	push   0xc(%ebp)
+  80217f:	50                   	push   %eax
+  802180:	e8 64 ff ff ff       	call   8020e9 <fstat>
+  802185:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802187:	89 1c 24             	mov    %ebx,(%esp)
+  80218a:	e8 26 fc ff ff       	call   801db5 <close>
+	return r;
+  80218f:	83 c4 10             	add    $0x10,%esp
+  802192:	89 f3                	mov    %esi,%ebx
+}
+  802194:	89 d8                	mov    %ebx,%eax
+  802196:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802199:	5b                   	pop    %ebx
+  80219a:	5e                   	pop    %esi
+  80219b:	5d                   	pop    %ebp
+  80219c:	c3                   	ret
+
+0080219d <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80219d:	55                   	push   %ebp
+  80219e:	89 e5                	mov    %esp,%ebp
+  8021a0:	56                   	push   %esi
+  8021a1:	53                   	push   %ebx
+  8021a2:	89 c6                	mov    %eax,%esi
+  8021a4:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8021a6:	83 3d 18 50 80 00 00 	cmpl   $0x0,0x805018
+  8021ad:	74 27                	je     8021d6 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8021af:	6a 07                	push   $0x7
+  8021b1:	68 00 60 80 00       	push   $0x806000
+  8021b6:	56                   	push   %esi
+  8021b7:	ff 35 18 50 80 00    	push   0x805018
+  8021bd:	e8 e8 f9 ff ff       	call   801baa <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8021c2:	83 c4 0c             	add    $0xc,%esp
+  8021c5:	6a 00                	push   $0x0
+  8021c7:	53                   	push   %ebx
+  8021c8:	6a 00                	push   $0x0
+  8021ca:	e8 63 f9 ff ff       	call   801b32 <ipc_recv>
+}
+  8021cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021d2:	5b                   	pop    %ebx
+  8021d3:	5e                   	pop    %esi
+  8021d4:	5d                   	pop    %ebp
+  8021d5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021d6:	83 ec 0c             	sub    $0xc,%esp
+  8021d9:	6a 01                	push   $0x1
+  8021db:	e8 1e fa ff ff       	call   801bfe <ipc_find_env>
+  8021e0:	a3 18 50 80 00       	mov    %eax,0x805018
+  8021e5:	83 c4 10             	add    $0x10,%esp
+  8021e8:	eb c5                	jmp    8021af <fsipc+0x12>
+
+008021ea <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8021ea:	55                   	push   %ebp
+  8021eb:	89 e5                	mov    %esp,%ebp
+  8021ed:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021f6:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8021fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021fe:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802203:	ba 00 00 00 00       	mov    $0x0,%edx
+  802208:	b8 02 00 00 00       	mov    $0x2,%eax
+  80220d:	e8 8b ff ff ff       	call   80219d <fsipc>
+}
+  802212:	c9                   	leave
+  802213:	c3                   	ret
+
+00802214 <devfile_flush>:
+{
+  802214:	55                   	push   %ebp
+  802215:	89 e5                	mov    %esp,%ebp
+  802217:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80221a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80221d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802220:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802225:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80222f:	e8 69 ff ff ff       	call   80219d <fsipc>
+}
+  802234:	c9                   	leave
+  802235:	c3                   	ret
+
+00802236 <devfile_stat>:
+{
+  802236:	55                   	push   %ebp
+  802237:	89 e5                	mov    %esp,%ebp
+  802239:	53                   	push   %ebx
+  80223a:	83 ec 04             	sub    $0x4,%esp
+  80223d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802240:	8b 45 08             	mov    0x8(%ebp),%eax
+  802243:	8b 40 0c             	mov    0xc(%eax),%eax
+  802246:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80224b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802250:	b8 05 00 00 00       	mov    $0x5,%eax
+  802255:	e8 43 ff ff ff       	call   80219d <fsipc>
+  80225a:	85 c0                	test   %eax,%eax
+  80225c:	78 2c                	js     80228a <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80225e:	83 ec 08             	sub    $0x8,%esp
+  802261:	68 00 60 80 00       	push   $0x806000
+  802266:	53                   	push   %ebx
+  802267:	e8 d2 ec ff ff       	call   800f3e <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80226c:	a1 80 60 80 00       	mov    0x806080,%eax
+  802271:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802277:	a1 84 60 80 00       	mov    0x806084,%eax
+  80227c:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802282:	83 c4 10             	add    $0x10,%esp
+  802285:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80228a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80228d:	c9                   	leave
+  80228e:	c3                   	ret
+
+0080228f <devfile_write>:
+{
+  80228f:	55                   	push   %ebp
+  802290:	89 e5                	mov    %esp,%ebp
+  802292:	83 ec 0c             	sub    $0xc,%esp
+  802295:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802298:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80229d:	39 d0                	cmp    %edx,%eax
+  80229f:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022a5:	8b 52 0c             	mov    0xc(%edx),%edx
+  8022a8:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8022ae:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8022b3:	50                   	push   %eax
+  8022b4:	ff 75 0c             	push   0xc(%ebp)
+  8022b7:	68 08 60 80 00       	push   $0x806008
+  8022bc:	e8 03 ee ff ff       	call   8010c4 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8022c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022cb:	e8 cd fe ff ff       	call   80219d <fsipc>
+}
+  8022d0:	c9                   	leave
+  8022d1:	c3                   	ret
+
+008022d2 <devfile_read>:
+{
+  8022d2:	55                   	push   %ebp
+  8022d3:	89 e5                	mov    %esp,%ebp
+  8022d5:	56                   	push   %esi
+  8022d6:	53                   	push   %ebx
+  8022d7:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022dd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022e0:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8022e5:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8022eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022f5:	e8 a3 fe ff ff       	call   80219d <fsipc>
+  8022fa:	89 c3                	mov    %eax,%ebx
+  8022fc:	85 c0                	test   %eax,%eax
+  8022fe:	78 1f                	js     80231f <devfile_read+0x4d>
+	assert(r <= n);
+  802300:	39 c6                	cmp    %eax,%esi
+  802302:	72 24                	jb     802328 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802304:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802309:	7f 33                	jg     80233e <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80230b:	83 ec 04             	sub    $0x4,%esp
+  80230e:	50                   	push   %eax
+  80230f:	68 00 60 80 00       	push   $0x806000
+  802314:	ff 75 0c             	push   0xc(%ebp)
+  802317:	e8 a8 ed ff ff       	call   8010c4 <memmove>
+	return r;
+  80231c:	83 c4 10             	add    $0x10,%esp
+}
+  80231f:	89 d8                	mov    %ebx,%eax
+  802321:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802324:	5b                   	pop    %ebx
+  802325:	5e                   	pop    %esi
+  802326:	5d                   	pop    %ebp
+  802327:	c3                   	ret
+	assert(r <= n);
+  802328:	68 80 38 80 00       	push   $0x803880
+  80232d:	68 87 38 80 00       	push   $0x803887
+  802332:	6a 7c                	push   $0x7c
+  802334:	68 9c 38 80 00       	push   $0x80389c
+  802339:	e8 37 e5 ff ff       	call   800875 <_panic>
+	assert(r <= PGSIZE);
+  80233e:	68 a7 38 80 00       	push   $0x8038a7
+  802343:	68 87 38 80 00       	push   $0x803887
+  802348:	6a 7d                	push   $0x7d
+  80234a:	68 9c 38 80 00       	push   $0x80389c
+  80234f:	e8 21 e5 ff ff       	call   800875 <_panic>
+
+00802354 <open>:
+{
+  802354:	55                   	push   %ebp
+  802355:	89 e5                	mov    %esp,%ebp
+  802357:	56                   	push   %esi
+  802358:	53                   	push   %ebx
+  802359:	83 ec 1c             	sub    $0x1c,%esp
+  80235c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80235f:	56                   	push   %esi
+  802360:	e8 9e eb ff ff       	call   800f03 <strlen>
+  802365:	83 c4 10             	add    $0x10,%esp
+  802368:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80236d:	7f 6c                	jg     8023db <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80236f:	83 ec 0c             	sub    $0xc,%esp
+  802372:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802375:	50                   	push   %eax
+  802376:	e8 ba f8 ff ff       	call   801c35 <fd_alloc>
+  80237b:	89 c3                	mov    %eax,%ebx
+  80237d:	83 c4 10             	add    $0x10,%esp
+  802380:	85 c0                	test   %eax,%eax
+  802382:	78 3c                	js     8023c0 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802384:	83 ec 08             	sub    $0x8,%esp
+  802387:	56                   	push   %esi
+  802388:	68 00 60 80 00       	push   $0x806000
+  80238d:	e8 ac eb ff ff       	call   800f3e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802392:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802395:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80239a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80239d:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023a2:	e8 f6 fd ff ff       	call   80219d <fsipc>
+  8023a7:	89 c3                	mov    %eax,%ebx
+  8023a9:	83 c4 10             	add    $0x10,%esp
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	78 19                	js     8023c9 <open+0x75>
+	return fd2num(fd);
+  8023b0:	83 ec 0c             	sub    $0xc,%esp
+  8023b3:	ff 75 f4             	push   -0xc(%ebp)
+  8023b6:	e8 53 f8 ff ff       	call   801c0e <fd2num>
+  8023bb:	89 c3                	mov    %eax,%ebx
+  8023bd:	83 c4 10             	add    $0x10,%esp
+}
+  8023c0:	89 d8                	mov    %ebx,%eax
+  8023c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023c5:	5b                   	pop    %ebx
+  8023c6:	5e                   	pop    %esi
+  8023c7:	5d                   	pop    %ebp
+  8023c8:	c3                   	ret
+		fd_close(fd, 0);
+  8023c9:	83 ec 08             	sub    $0x8,%esp
+  8023cc:	6a 00                	push   $0x0
+  8023ce:	ff 75 f4             	push   -0xc(%ebp)
+  8023d1:	e8 58 f9 ff ff       	call   801d2e <fd_close>
+		return r;
+  8023d6:	83 c4 10             	add    $0x10,%esp
+  8023d9:	eb e5                	jmp    8023c0 <open+0x6c>
+		return -E_BAD_PATH;
+  8023db:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8023e0:	eb de                	jmp    8023c0 <open+0x6c>
+
+008023e2 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8023e2:	55                   	push   %ebp
+  8023e3:	89 e5                	mov    %esp,%ebp
+  8023e5:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8023e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ed:	b8 08 00 00 00       	mov    $0x8,%eax
+  8023f2:	e8 a6 fd ff ff       	call   80219d <fsipc>
+}
+  8023f7:	c9                   	leave
+  8023f8:	c3                   	ret
+
+008023f9 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023f9:	55                   	push   %ebp
+  8023fa:	89 e5                	mov    %esp,%ebp
+  8023fc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8023ff:	68 b3 38 80 00       	push   $0x8038b3
+  802404:	ff 75 0c             	push   0xc(%ebp)
+  802407:	e8 32 eb ff ff       	call   800f3e <strcpy>
+	return 0;
+}
+  80240c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802411:	c9                   	leave
+  802412:	c3                   	ret
+
+00802413 <devsock_close>:
+{
+  802413:	55                   	push   %ebp
+  802414:	89 e5                	mov    %esp,%ebp
+  802416:	53                   	push   %ebx
+  802417:	83 ec 10             	sub    $0x10,%esp
+  80241a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80241d:	53                   	push   %ebx
+  80241e:	e8 8d 09 00 00       	call   802db0 <pageref>
+  802423:	89 c2                	mov    %eax,%edx
+  802425:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802428:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80242d:	83 fa 01             	cmp    $0x1,%edx
+  802430:	74 05                	je     802437 <devsock_close+0x24>
+}
+  802432:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802435:	c9                   	leave
+  802436:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802437:	83 ec 0c             	sub    $0xc,%esp
+  80243a:	ff 73 0c             	push   0xc(%ebx)
+  80243d:	e8 b7 02 00 00       	call   8026f9 <nsipc_close>
+  802442:	83 c4 10             	add    $0x10,%esp
+  802445:	eb eb                	jmp    802432 <devsock_close+0x1f>
+
+00802447 <devsock_write>:
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80244d:	6a 00                	push   $0x0
+  80244f:	ff 75 10             	push   0x10(%ebp)
+  802452:	ff 75 0c             	push   0xc(%ebp)
+  802455:	8b 45 08             	mov    0x8(%ebp),%eax
+  802458:	ff 70 0c             	push   0xc(%eax)
+  80245b:	e8 79 03 00 00       	call   8027d9 <nsipc_send>
+}
+  802460:	c9                   	leave
+  802461:	c3                   	ret
+
+00802462 <devsock_read>:
+{
+  802462:	55                   	push   %ebp
+  802463:	89 e5                	mov    %esp,%ebp
+  802465:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802468:	6a 00                	push   $0x0
+  80246a:	ff 75 10             	push   0x10(%ebp)
+  80246d:	ff 75 0c             	push   0xc(%ebp)
+  802470:	8b 45 08             	mov    0x8(%ebp),%eax
+  802473:	ff 70 0c             	push   0xc(%eax)
+  802476:	e8 ef 02 00 00       	call   80276a <nsipc_recv>
+}
+  80247b:	c9                   	leave
+  80247c:	c3                   	ret
+
+0080247d <fd2sockid>:
+{
+  80247d:	55                   	push   %ebp
+  80247e:	89 e5                	mov    %esp,%ebp
+  802480:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802483:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802486:	52                   	push   %edx
+  802487:	50                   	push   %eax
+  802488:	e8 fe f7 ff ff       	call   801c8b <fd_lookup>
+  80248d:	83 c4 10             	add    $0x10,%esp
+  802490:	85 c0                	test   %eax,%eax
+  802492:	78 10                	js     8024a4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802494:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802497:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80249d:	39 08                	cmp    %ecx,(%eax)
+  80249f:	75 05                	jne    8024a6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8024a1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8024a4:	c9                   	leave
+  8024a5:	c3                   	ret
+		return -E_NOT_SUPP;
+  8024a6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024ab:	eb f7                	jmp    8024a4 <fd2sockid+0x27>
+
+008024ad <alloc_sockfd>:
+{
+  8024ad:	55                   	push   %ebp
+  8024ae:	89 e5                	mov    %esp,%ebp
+  8024b0:	56                   	push   %esi
+  8024b1:	53                   	push   %ebx
+  8024b2:	83 ec 1c             	sub    $0x1c,%esp
+  8024b5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8024b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024ba:	50                   	push   %eax
+  8024bb:	e8 75 f7 ff ff       	call   801c35 <fd_alloc>
+  8024c0:	89 c3                	mov    %eax,%ebx
+  8024c2:	83 c4 10             	add    $0x10,%esp
+  8024c5:	85 c0                	test   %eax,%eax
+  8024c7:	78 43                	js     80250c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8024c9:	83 ec 04             	sub    $0x4,%esp
+  8024cc:	68 07 04 00 00       	push   $0x407
+  8024d1:	ff 75 f4             	push   -0xc(%ebp)
+  8024d4:	6a 00                	push   $0x0
+  8024d6:	e8 d0 ee ff ff       	call   8013ab <sys_page_alloc>
+  8024db:	89 c3                	mov    %eax,%ebx
+  8024dd:	83 c4 10             	add    $0x10,%esp
+  8024e0:	85 c0                	test   %eax,%eax
+  8024e2:	78 28                	js     80250c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8024e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024e7:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8024ed:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8024ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024f2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8024f9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8024fc:	83 ec 0c             	sub    $0xc,%esp
+  8024ff:	50                   	push   %eax
+  802500:	e8 09 f7 ff ff       	call   801c0e <fd2num>
+  802505:	89 c3                	mov    %eax,%ebx
+  802507:	83 c4 10             	add    $0x10,%esp
+  80250a:	eb 0c                	jmp    802518 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80250c:	83 ec 0c             	sub    $0xc,%esp
+  80250f:	56                   	push   %esi
+  802510:	e8 e4 01 00 00       	call   8026f9 <nsipc_close>
+		return r;
+  802515:	83 c4 10             	add    $0x10,%esp
+}
+  802518:	89 d8                	mov    %ebx,%eax
+  80251a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80251d:	5b                   	pop    %ebx
+  80251e:	5e                   	pop    %esi
+  80251f:	5d                   	pop    %ebp
+  802520:	c3                   	ret
+
+00802521 <accept>:
+{
+  802521:	55                   	push   %ebp
+  802522:	89 e5                	mov    %esp,%ebp
+  802524:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802527:	8b 45 08             	mov    0x8(%ebp),%eax
+  80252a:	e8 4e ff ff ff       	call   80247d <fd2sockid>
+  80252f:	85 c0                	test   %eax,%eax
+  802531:	78 1b                	js     80254e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802533:	83 ec 04             	sub    $0x4,%esp
+  802536:	ff 75 10             	push   0x10(%ebp)
+  802539:	ff 75 0c             	push   0xc(%ebp)
+  80253c:	50                   	push   %eax
+  80253d:	e8 0e 01 00 00       	call   802650 <nsipc_accept>
+  802542:	83 c4 10             	add    $0x10,%esp
+  802545:	85 c0                	test   %eax,%eax
+  802547:	78 05                	js     80254e <accept+0x2d>
+	return alloc_sockfd(r);
+  802549:	e8 5f ff ff ff       	call   8024ad <alloc_sockfd>
+}
+  80254e:	c9                   	leave
+  80254f:	c3                   	ret
+
+00802550 <bind>:
+{
+  802550:	55                   	push   %ebp
+  802551:	89 e5                	mov    %esp,%ebp
+  802553:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802556:	8b 45 08             	mov    0x8(%ebp),%eax
+  802559:	e8 1f ff ff ff       	call   80247d <fd2sockid>
+  80255e:	85 c0                	test   %eax,%eax
+  802560:	78 12                	js     802574 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802562:	83 ec 04             	sub    $0x4,%esp
+  802565:	ff 75 10             	push   0x10(%ebp)
+  802568:	ff 75 0c             	push   0xc(%ebp)
+  80256b:	50                   	push   %eax
+  80256c:	e8 31 01 00 00       	call   8026a2 <nsipc_bind>
+  802571:	83 c4 10             	add    $0x10,%esp
+}
+  802574:	c9                   	leave
+  802575:	c3                   	ret
+
+00802576 <shutdown>:
+{
+  802576:	55                   	push   %ebp
+  802577:	89 e5                	mov    %esp,%ebp
+  802579:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80257c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80257f:	e8 f9 fe ff ff       	call   80247d <fd2sockid>
+  802584:	85 c0                	test   %eax,%eax
+  802586:	78 0f                	js     802597 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802588:	83 ec 08             	sub    $0x8,%esp
+  80258b:	ff 75 0c             	push   0xc(%ebp)
+  80258e:	50                   	push   %eax
+  80258f:	e8 43 01 00 00       	call   8026d7 <nsipc_shutdown>
+  802594:	83 c4 10             	add    $0x10,%esp
+}
+  802597:	c9                   	leave
+  802598:	c3                   	ret
+
+00802599 <connect>:
+{
+  802599:	55                   	push   %ebp
+  80259a:	89 e5                	mov    %esp,%ebp
+  80259c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80259f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a2:	e8 d6 fe ff ff       	call   80247d <fd2sockid>
+  8025a7:	85 c0                	test   %eax,%eax
+  8025a9:	78 12                	js     8025bd <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8025ab:	83 ec 04             	sub    $0x4,%esp
+  8025ae:	ff 75 10             	push   0x10(%ebp)
+  8025b1:	ff 75 0c             	push   0xc(%ebp)
+  8025b4:	50                   	push   %eax
+  8025b5:	e8 59 01 00 00       	call   802713 <nsipc_connect>
+  8025ba:	83 c4 10             	add    $0x10,%esp
+}
+  8025bd:	c9                   	leave
+  8025be:	c3                   	ret
+
+008025bf <listen>:
+{
+  8025bf:	55                   	push   %ebp
+  8025c0:	89 e5                	mov    %esp,%ebp
+  8025c2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8025c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025c8:	e8 b0 fe ff ff       	call   80247d <fd2sockid>
+  8025cd:	85 c0                	test   %eax,%eax
+  8025cf:	78 0f                	js     8025e0 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8025d1:	83 ec 08             	sub    $0x8,%esp
+  8025d4:	ff 75 0c             	push   0xc(%ebp)
+  8025d7:	50                   	push   %eax
+  8025d8:	e8 6b 01 00 00       	call   802748 <nsipc_listen>
+  8025dd:	83 c4 10             	add    $0x10,%esp
+}
+  8025e0:	c9                   	leave
+  8025e1:	c3                   	ret
+
+008025e2 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8025e2:	55                   	push   %ebp
+  8025e3:	89 e5                	mov    %esp,%ebp
+  8025e5:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8025e8:	ff 75 10             	push   0x10(%ebp)
+  8025eb:	ff 75 0c             	push   0xc(%ebp)
+  8025ee:	ff 75 08             	push   0x8(%ebp)
+  8025f1:	e8 41 02 00 00       	call   802837 <nsipc_socket>
+  8025f6:	83 c4 10             	add    $0x10,%esp
+  8025f9:	85 c0                	test   %eax,%eax
+  8025fb:	78 05                	js     802602 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8025fd:	e8 ab fe ff ff       	call   8024ad <alloc_sockfd>
+}
+  802602:	c9                   	leave
+  802603:	c3                   	ret
+
+00802604 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802604:	55                   	push   %ebp
+  802605:	89 e5                	mov    %esp,%ebp
+  802607:	53                   	push   %ebx
+  802608:	83 ec 04             	sub    $0x4,%esp
+  80260b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80260d:	83 3d 1c 50 80 00 00 	cmpl   $0x0,0x80501c
+  802614:	74 26                	je     80263c <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802616:	6a 07                	push   $0x7
+  802618:	68 00 70 80 00       	push   $0x807000
+  80261d:	53                   	push   %ebx
+  80261e:	ff 35 1c 50 80 00    	push   0x80501c
+  802624:	e8 81 f5 ff ff       	call   801baa <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802629:	83 c4 0c             	add    $0xc,%esp
+  80262c:	6a 00                	push   $0x0
+  80262e:	6a 00                	push   $0x0
+  802630:	6a 00                	push   $0x0
+  802632:	e8 fb f4 ff ff       	call   801b32 <ipc_recv>
+}
+  802637:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80263a:	c9                   	leave
+  80263b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80263c:	83 ec 0c             	sub    $0xc,%esp
+  80263f:	6a 02                	push   $0x2
+  802641:	e8 b8 f5 ff ff       	call   801bfe <ipc_find_env>
+  802646:	a3 1c 50 80 00       	mov    %eax,0x80501c
+  80264b:	83 c4 10             	add    $0x10,%esp
+  80264e:	eb c6                	jmp    802616 <nsipc+0x12>
+
+00802650 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802650:	55                   	push   %ebp
+  802651:	89 e5                	mov    %esp,%ebp
+  802653:	56                   	push   %esi
+  802654:	53                   	push   %ebx
+  802655:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802658:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802660:	8b 06                	mov    (%esi),%eax
+  802662:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802667:	b8 01 00 00 00       	mov    $0x1,%eax
+  80266c:	e8 93 ff ff ff       	call   802604 <nsipc>
+  802671:	89 c3                	mov    %eax,%ebx
+  802673:	85 c0                	test   %eax,%eax
+  802675:	79 09                	jns    802680 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802677:	89 d8                	mov    %ebx,%eax
+  802679:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80267c:	5b                   	pop    %ebx
+  80267d:	5e                   	pop    %esi
+  80267e:	5d                   	pop    %ebp
+  80267f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802680:	83 ec 04             	sub    $0x4,%esp
+  802683:	ff 35 10 70 80 00    	push   0x807010
+  802689:	68 00 70 80 00       	push   $0x807000
+  80268e:	ff 75 0c             	push   0xc(%ebp)
+  802691:	e8 2e ea ff ff       	call   8010c4 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802696:	a1 10 70 80 00       	mov    0x807010,%eax
+  80269b:	89 06                	mov    %eax,(%esi)
+  80269d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8026a0:	eb d5                	jmp    802677 <nsipc_accept+0x27>
+
+008026a2 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8026a2:	55                   	push   %ebp
+  8026a3:	89 e5                	mov    %esp,%ebp
+  8026a5:	53                   	push   %ebx
+  8026a6:	83 ec 08             	sub    $0x8,%esp
+  8026a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8026ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026af:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8026b4:	53                   	push   %ebx
+  8026b5:	ff 75 0c             	push   0xc(%ebp)
+  8026b8:	68 04 70 80 00       	push   $0x807004
+  8026bd:	e8 02 ea ff ff       	call   8010c4 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8026c2:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8026c8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8026cd:	e8 32 ff ff ff       	call   802604 <nsipc>
+}
+  8026d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d5:	c9                   	leave
+  8026d6:	c3                   	ret
+
+008026d7 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8026d7:	55                   	push   %ebp
+  8026d8:	89 e5                	mov    %esp,%ebp
+  8026da:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8026dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8026e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026e8:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8026ed:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026f2:	e8 0d ff ff ff       	call   802604 <nsipc>
+}
+  8026f7:	c9                   	leave
+  8026f8:	c3                   	ret
+
+008026f9 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8026f9:	55                   	push   %ebp
+  8026fa:	89 e5                	mov    %esp,%ebp
+  8026fc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8026ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802702:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802707:	b8 04 00 00 00       	mov    $0x4,%eax
+  80270c:	e8 f3 fe ff ff       	call   802604 <nsipc>
+}
+  802711:	c9                   	leave
+  802712:	c3                   	ret
+
+00802713 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802713:	55                   	push   %ebp
+  802714:	89 e5                	mov    %esp,%ebp
+  802716:	53                   	push   %ebx
+  802717:	83 ec 08             	sub    $0x8,%esp
+  80271a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80271d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802720:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802725:	53                   	push   %ebx
+  802726:	ff 75 0c             	push   0xc(%ebp)
+  802729:	68 04 70 80 00       	push   $0x807004
+  80272e:	e8 91 e9 ff ff       	call   8010c4 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802733:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802739:	b8 05 00 00 00       	mov    $0x5,%eax
+  80273e:	e8 c1 fe ff ff       	call   802604 <nsipc>
+}
+  802743:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802746:	c9                   	leave
+  802747:	c3                   	ret
+
+00802748 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802748:	55                   	push   %ebp
+  802749:	89 e5                	mov    %esp,%ebp
+  80274b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80274e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802751:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802756:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802759:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80275e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802763:	e8 9c fe ff ff       	call   802604 <nsipc>
+}
+  802768:	c9                   	leave
+  802769:	c3                   	ret
+
+0080276a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80276a:	55                   	push   %ebp
+  80276b:	89 e5                	mov    %esp,%ebp
+  80276d:	56                   	push   %esi
+  80276e:	53                   	push   %ebx
+  80276f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802772:	8b 45 08             	mov    0x8(%ebp),%eax
+  802775:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80277a:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802780:	8b 45 14             	mov    0x14(%ebp),%eax
+  802783:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802788:	b8 07 00 00 00       	mov    $0x7,%eax
+  80278d:	e8 72 fe ff ff       	call   802604 <nsipc>
+  802792:	89 c3                	mov    %eax,%ebx
+  802794:	85 c0                	test   %eax,%eax
+  802796:	78 22                	js     8027ba <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802798:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80279d:	39 c6                	cmp    %eax,%esi
+  80279f:	0f 4e c6             	cmovle %esi,%eax
+  8027a2:	39 c3                	cmp    %eax,%ebx
+  8027a4:	7f 1d                	jg     8027c3 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8027a6:	83 ec 04             	sub    $0x4,%esp
+  8027a9:	53                   	push   %ebx
+  8027aa:	68 00 70 80 00       	push   $0x807000
+  8027af:	ff 75 0c             	push   0xc(%ebp)
+  8027b2:	e8 0d e9 ff ff       	call   8010c4 <memmove>
+  8027b7:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8027ba:	89 d8                	mov    %ebx,%eax
+  8027bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027bf:	5b                   	pop    %ebx
+  8027c0:	5e                   	pop    %esi
+  8027c1:	5d                   	pop    %ebp
+  8027c2:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8027c3:	68 bf 38 80 00       	push   $0x8038bf
+  8027c8:	68 87 38 80 00       	push   $0x803887
+  8027cd:	6a 62                	push   $0x62
+  8027cf:	68 d4 38 80 00       	push   $0x8038d4
+  8027d4:	e8 9c e0 ff ff       	call   800875 <_panic>
+
+008027d9 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8027d9:	55                   	push   %ebp
+  8027da:	89 e5                	mov    %esp,%ebp
+  8027dc:	53                   	push   %ebx
+  8027dd:	83 ec 04             	sub    $0x4,%esp
+  8027e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8027e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e6:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8027eb:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8027f1:	7f 2e                	jg     802821 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8027f3:	83 ec 04             	sub    $0x4,%esp
+  8027f6:	53                   	push   %ebx
+  8027f7:	ff 75 0c             	push   0xc(%ebp)
+  8027fa:	68 0c 70 80 00       	push   $0x80700c
+  8027ff:	e8 c0 e8 ff ff       	call   8010c4 <memmove>
+	nsipcbuf.send.req_size = size;
+  802804:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80280a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80280d:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802812:	b8 08 00 00 00       	mov    $0x8,%eax
+  802817:	e8 e8 fd ff ff       	call   802604 <nsipc>
+}
+  80281c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80281f:	c9                   	leave
+  802820:	c3                   	ret
+	assert(size < 1600);
+  802821:	68 e0 38 80 00       	push   $0x8038e0
+  802826:	68 87 38 80 00       	push   $0x803887
+  80282b:	6a 6d                	push   $0x6d
+  80282d:	68 d4 38 80 00       	push   $0x8038d4
+  802832:	e8 3e e0 ff ff       	call   800875 <_panic>
+
+00802837 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802837:	55                   	push   %ebp
+  802838:	89 e5                	mov    %esp,%ebp
+  80283a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80283d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802840:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802845:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802848:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80284d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802850:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802855:	b8 09 00 00 00       	mov    $0x9,%eax
+  80285a:	e8 a5 fd ff ff       	call   802604 <nsipc>
+}
+  80285f:	c9                   	leave
+  802860:	c3                   	ret
+
+00802861 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802861:	55                   	push   %ebp
+  802862:	89 e5                	mov    %esp,%ebp
+  802864:	56                   	push   %esi
+  802865:	53                   	push   %ebx
+  802866:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802869:	83 ec 0c             	sub    $0xc,%esp
+  80286c:	ff 75 08             	push   0x8(%ebp)
+  80286f:	e8 aa f3 ff ff       	call   801c1e <fd2data>
+  802874:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802876:	83 c4 08             	add    $0x8,%esp
+  802879:	68 ec 38 80 00       	push   $0x8038ec
+  80287e:	53                   	push   %ebx
+  80287f:	e8 ba e6 ff ff       	call   800f3e <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802884:	8b 46 04             	mov    0x4(%esi),%eax
+  802887:	2b 06                	sub    (%esi),%eax
+  802889:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80288f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802896:	00 00 00 
+	stat->st_dev = &devpipe;
+  802899:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8028a0:	40 80 00 
+	return 0;
+}
+  8028a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028ab:	5b                   	pop    %ebx
+  8028ac:	5e                   	pop    %esi
+  8028ad:	5d                   	pop    %ebp
+  8028ae:	c3                   	ret
+
+008028af <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8028af:	55                   	push   %ebp
+  8028b0:	89 e5                	mov    %esp,%ebp
+  8028b2:	53                   	push   %ebx
+  8028b3:	83 ec 0c             	sub    $0xc,%esp
+  8028b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8028b9:	53                   	push   %ebx
+  8028ba:	6a 00                	push   $0x0
+  8028bc:	e8 b2 eb ff ff       	call   801473 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8028c1:	89 1c 24             	mov    %ebx,(%esp)
+  8028c4:	e8 55 f3 ff ff       	call   801c1e <fd2data>
+  8028c9:	83 c4 08             	add    $0x8,%esp
+  8028cc:	50                   	push   %eax
+  8028cd:	6a 00                	push   $0x0
+  8028cf:	e8 9f eb ff ff       	call   801473 <sys_page_unmap>
+}
+  8028d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028d7:	c9                   	leave
+  8028d8:	c3                   	ret
+
+008028d9 <_pipeisclosed>:
+{
+  8028d9:	55                   	push   %ebp
+  8028da:	89 e5                	mov    %esp,%ebp
+  8028dc:	57                   	push   %edi
+  8028dd:	56                   	push   %esi
+  8028de:	53                   	push   %ebx
+  8028df:	83 ec 1c             	sub    $0x1c,%esp
+  8028e2:	89 c7                	mov    %eax,%edi
+  8028e4:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8028e6:	a1 20 50 80 00       	mov    0x805020,%eax
+  8028eb:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8028ee:	83 ec 0c             	sub    $0xc,%esp
+  8028f1:	57                   	push   %edi
+  8028f2:	e8 b9 04 00 00       	call   802db0 <pageref>
+  8028f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028fa:	89 34 24             	mov    %esi,(%esp)
+  8028fd:	e8 ae 04 00 00       	call   802db0 <pageref>
+		nn = thisenv->env_runs;
+  802902:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802908:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  80290b:	83 c4 10             	add    $0x10,%esp
+  80290e:	39 cb                	cmp    %ecx,%ebx
+  802910:	74 1b                	je     80292d <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802912:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802915:	75 cf                	jne    8028e6 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802917:	8b 42 5c             	mov    0x5c(%edx),%eax
+  80291a:	6a 01                	push   $0x1
+  80291c:	50                   	push   %eax
+  80291d:	53                   	push   %ebx
+  80291e:	68 f3 38 80 00       	push   $0x8038f3
+  802923:	e8 28 e0 ff ff       	call   800950 <cprintf>
+  802928:	83 c4 10             	add    $0x10,%esp
+  80292b:	eb b9                	jmp    8028e6 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80292d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802930:	0f 94 c0             	sete   %al
+  802933:	0f b6 c0             	movzbl %al,%eax
+}
+  802936:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802939:	5b                   	pop    %ebx
+  80293a:	5e                   	pop    %esi
+  80293b:	5f                   	pop    %edi
+  80293c:	5d                   	pop    %ebp
+  80293d:	c3                   	ret
+
+0080293e <devpipe_write>:
+{
+  80293e:	55                   	push   %ebp
+  80293f:	89 e5                	mov    %esp,%ebp
+  802941:	57                   	push   %edi
+  802942:	56                   	push   %esi
+  802943:	53                   	push   %ebx
+  802944:	83 ec 28             	sub    $0x28,%esp
+  802947:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80294a:	56                   	push   %esi
+  80294b:	e8 ce f2 ff ff       	call   801c1e <fd2data>
+  802950:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802952:	83 c4 10             	add    $0x10,%esp
+  802955:	bf 00 00 00 00       	mov    $0x0,%edi
+  80295a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80295d:	75 09                	jne    802968 <devpipe_write+0x2a>
+	return i;
+  80295f:	89 f8                	mov    %edi,%eax
+  802961:	eb 23                	jmp    802986 <devpipe_write+0x48>
+			sys_yield();
+  802963:	e8 c3 e9 ff ff       	call   80132b <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802968:	8b 43 04             	mov    0x4(%ebx),%eax
+  80296b:	8b 0b                	mov    (%ebx),%ecx
+  80296d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802970:	39 d0                	cmp    %edx,%eax
+  802972:	72 1a                	jb     80298e <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802974:	89 da                	mov    %ebx,%edx
+  802976:	89 f0                	mov    %esi,%eax
+  802978:	e8 5c ff ff ff       	call   8028d9 <_pipeisclosed>
+  80297d:	85 c0                	test   %eax,%eax
+  80297f:	74 e2                	je     802963 <devpipe_write+0x25>
+				return 0;
+  802981:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802986:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802989:	5b                   	pop    %ebx
+  80298a:	5e                   	pop    %esi
+  80298b:	5f                   	pop    %edi
+  80298c:	5d                   	pop    %ebp
+  80298d:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80298e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802991:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802995:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802998:	89 c2                	mov    %eax,%edx
+  80299a:	c1 fa 1f             	sar    $0x1f,%edx
+  80299d:	89 d1                	mov    %edx,%ecx
+  80299f:	c1 e9 1b             	shr    $0x1b,%ecx
+  8029a2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8029a5:	83 e2 1f             	and    $0x1f,%edx
+  8029a8:	29 ca                	sub    %ecx,%edx
+  8029aa:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8029ae:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8029b2:	83 c0 01             	add    $0x1,%eax
+  8029b5:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8029b8:	83 c7 01             	add    $0x1,%edi
+  8029bb:	eb 9d                	jmp    80295a <devpipe_write+0x1c>
+
+008029bd <devpipe_read>:
+{
+  8029bd:	55                   	push   %ebp
+  8029be:	89 e5                	mov    %esp,%ebp
+  8029c0:	57                   	push   %edi
+  8029c1:	56                   	push   %esi
+  8029c2:	53                   	push   %ebx
+  8029c3:	83 ec 18             	sub    $0x18,%esp
+  8029c6:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8029c9:	57                   	push   %edi
+  8029ca:	e8 4f f2 ff ff       	call   801c1e <fd2data>
+  8029cf:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8029d1:	83 c4 10             	add    $0x10,%esp
+  8029d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8029d9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8029dc:	75 13                	jne    8029f1 <devpipe_read+0x34>
+	return i;
+  8029de:	89 f0                	mov    %esi,%eax
+  8029e0:	eb 02                	jmp    8029e4 <devpipe_read+0x27>
+				return i;
+  8029e2:	89 f0                	mov    %esi,%eax
+}
+  8029e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029e7:	5b                   	pop    %ebx
+  8029e8:	5e                   	pop    %esi
+  8029e9:	5f                   	pop    %edi
+  8029ea:	5d                   	pop    %ebp
+  8029eb:	c3                   	ret
+			sys_yield();
+  8029ec:	e8 3a e9 ff ff       	call   80132b <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8029f1:	8b 03                	mov    (%ebx),%eax
+  8029f3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8029f6:	75 18                	jne    802a10 <devpipe_read+0x53>
+			if (i > 0)
+  8029f8:	85 f6                	test   %esi,%esi
+  8029fa:	75 e6                	jne    8029e2 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8029fc:	89 da                	mov    %ebx,%edx
+  8029fe:	89 f8                	mov    %edi,%eax
+  802a00:	e8 d4 fe ff ff       	call   8028d9 <_pipeisclosed>
+  802a05:	85 c0                	test   %eax,%eax
+  802a07:	74 e3                	je     8029ec <devpipe_read+0x2f>
+				return 0;
+  802a09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0e:	eb d4                	jmp    8029e4 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802a10:	99                   	cltd
+  802a11:	c1 ea 1b             	shr    $0x1b,%edx
+  802a14:	01 d0                	add    %edx,%eax
+  802a16:	83 e0 1f             	and    $0x1f,%eax
+  802a19:	29 d0                	sub    %edx,%eax
+  802a1b:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802a20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a23:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802a26:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802a29:	83 c6 01             	add    $0x1,%esi
+  802a2c:	eb ab                	jmp    8029d9 <devpipe_read+0x1c>
+
+00802a2e <pipe>:
+{
+  802a2e:	55                   	push   %ebp
+  802a2f:	89 e5                	mov    %esp,%ebp
+  802a31:	56                   	push   %esi
+  802a32:	53                   	push   %ebx
+  802a33:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802a36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a39:	50                   	push   %eax
+  802a3a:	e8 f6 f1 ff ff       	call   801c35 <fd_alloc>
+  802a3f:	89 c3                	mov    %eax,%ebx
+  802a41:	83 c4 10             	add    $0x10,%esp
+  802a44:	85 c0                	test   %eax,%eax
+  802a46:	0f 88 23 01 00 00    	js     802b6f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a4c:	83 ec 04             	sub    $0x4,%esp
+  802a4f:	68 07 04 00 00       	push   $0x407
+  802a54:	ff 75 f4             	push   -0xc(%ebp)
+  802a57:	6a 00                	push   $0x0
+  802a59:	e8 4d e9 ff ff       	call   8013ab <sys_page_alloc>
+  802a5e:	89 c3                	mov    %eax,%ebx
+  802a60:	83 c4 10             	add    $0x10,%esp
+  802a63:	85 c0                	test   %eax,%eax
+  802a65:	0f 88 04 01 00 00    	js     802b6f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802a6b:	83 ec 0c             	sub    $0xc,%esp
+  802a6e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802a71:	50                   	push   %eax
+  802a72:	e8 be f1 ff ff       	call   801c35 <fd_alloc>
+  802a77:	89 c3                	mov    %eax,%ebx
+  802a79:	83 c4 10             	add    $0x10,%esp
+  802a7c:	85 c0                	test   %eax,%eax
+  802a7e:	0f 88 db 00 00 00    	js     802b5f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a84:	83 ec 04             	sub    $0x4,%esp
+  802a87:	68 07 04 00 00       	push   $0x407
+  802a8c:	ff 75 f0             	push   -0x10(%ebp)
+  802a8f:	6a 00                	push   $0x0
+  802a91:	e8 15 e9 ff ff       	call   8013ab <sys_page_alloc>
+  802a96:	89 c3                	mov    %eax,%ebx
+  802a98:	83 c4 10             	add    $0x10,%esp
+  802a9b:	85 c0                	test   %eax,%eax
+  802a9d:	0f 88 bc 00 00 00    	js     802b5f <pipe+0x131>
+	va = fd2data(fd0);
+  802aa3:	83 ec 0c             	sub    $0xc,%esp
+  802aa6:	ff 75 f4             	push   -0xc(%ebp)
+  802aa9:	e8 70 f1 ff ff       	call   801c1e <fd2data>
+  802aae:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ab0:	83 c4 0c             	add    $0xc,%esp
+  802ab3:	68 07 04 00 00       	push   $0x407
+  802ab8:	50                   	push   %eax
+  802ab9:	6a 00                	push   $0x0
+  802abb:	e8 eb e8 ff ff       	call   8013ab <sys_page_alloc>
+  802ac0:	89 c3                	mov    %eax,%ebx
+  802ac2:	83 c4 10             	add    $0x10,%esp
+  802ac5:	85 c0                	test   %eax,%eax
+  802ac7:	0f 88 82 00 00 00    	js     802b4f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802acd:	83 ec 0c             	sub    $0xc,%esp
+  802ad0:	ff 75 f0             	push   -0x10(%ebp)
+  802ad3:	e8 46 f1 ff ff       	call   801c1e <fd2data>
+  802ad8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802adf:	50                   	push   %eax
+  802ae0:	6a 00                	push   $0x0
+  802ae2:	56                   	push   %esi
+  802ae3:	6a 00                	push   $0x0
+  802ae5:	e8 47 e9 ff ff       	call   801431 <sys_page_map>
+  802aea:	89 c3                	mov    %eax,%ebx
+  802aec:	83 c4 20             	add    $0x20,%esp
+  802aef:	85 c0                	test   %eax,%eax
+  802af1:	78 4e                	js     802b41 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802af3:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802af8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802afb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802afd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b00:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802b07:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802b0a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802b0c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802b0f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802b16:	83 ec 0c             	sub    $0xc,%esp
+  802b19:	ff 75 f4             	push   -0xc(%ebp)
+  802b1c:	e8 ed f0 ff ff       	call   801c0e <fd2num>
+  802b21:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b24:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802b26:	83 c4 04             	add    $0x4,%esp
+  802b29:	ff 75 f0             	push   -0x10(%ebp)
+  802b2c:	e8 dd f0 ff ff       	call   801c0e <fd2num>
+  802b31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b34:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802b37:	83 c4 10             	add    $0x10,%esp
+  802b3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b3f:	eb 2e                	jmp    802b6f <pipe+0x141>
+	sys_page_unmap(0, va);
+  802b41:	83 ec 08             	sub    $0x8,%esp
+  802b44:	56                   	push   %esi
+  802b45:	6a 00                	push   $0x0
+  802b47:	e8 27 e9 ff ff       	call   801473 <sys_page_unmap>
+  802b4c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802b4f:	83 ec 08             	sub    $0x8,%esp
+  802b52:	ff 75 f0             	push   -0x10(%ebp)
+  802b55:	6a 00                	push   $0x0
+  802b57:	e8 17 e9 ff ff       	call   801473 <sys_page_unmap>
+  802b5c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802b5f:	83 ec 08             	sub    $0x8,%esp
+  802b62:	ff 75 f4             	push   -0xc(%ebp)
+  802b65:	6a 00                	push   $0x0
+  802b67:	e8 07 e9 ff ff       	call   801473 <sys_page_unmap>
+  802b6c:	83 c4 10             	add    $0x10,%esp
+}
+  802b6f:	89 d8                	mov    %ebx,%eax
+  802b71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b74:	5b                   	pop    %ebx
+  802b75:	5e                   	pop    %esi
+  802b76:	5d                   	pop    %ebp
+  802b77:	c3                   	ret
+
+00802b78 <pipeisclosed>:
+{
+  802b78:	55                   	push   %ebp
+  802b79:	89 e5                	mov    %esp,%ebp
+  802b7b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b7e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b81:	50                   	push   %eax
+  802b82:	ff 75 08             	push   0x8(%ebp)
+  802b85:	e8 01 f1 ff ff       	call   801c8b <fd_lookup>
+  802b8a:	83 c4 10             	add    $0x10,%esp
+  802b8d:	85 c0                	test   %eax,%eax
+  802b8f:	78 18                	js     802ba9 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802b91:	83 ec 0c             	sub    $0xc,%esp
+  802b94:	ff 75 f4             	push   -0xc(%ebp)
+  802b97:	e8 82 f0 ff ff       	call   801c1e <fd2data>
+  802b9c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802b9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ba1:	e8 33 fd ff ff       	call   8028d9 <_pipeisclosed>
+  802ba6:	83 c4 10             	add    $0x10,%esp
+}
+  802ba9:	c9                   	leave
+  802baa:	c3                   	ret
+
+00802bab <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802bab:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb0:	c3                   	ret
+
+00802bb1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802bb1:	55                   	push   %ebp
+  802bb2:	89 e5                	mov    %esp,%ebp
+  802bb4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802bb7:	68 0b 39 80 00       	push   $0x80390b
+  802bbc:	ff 75 0c             	push   0xc(%ebp)
+  802bbf:	e8 7a e3 ff ff       	call   800f3e <strcpy>
+	return 0;
+}
+  802bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc9:	c9                   	leave
+  802bca:	c3                   	ret
+
+00802bcb <devcons_write>:
+{
+  802bcb:	55                   	push   %ebp
+  802bcc:	89 e5                	mov    %esp,%ebp
+  802bce:	57                   	push   %edi
+  802bcf:	56                   	push   %esi
+  802bd0:	53                   	push   %ebx
+  802bd1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802bd7:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802bdc:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802be2:	eb 2e                	jmp    802c12 <devcons_write+0x47>
+		m = n - tot;
+  802be4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802be7:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802be9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802bee:	39 c3                	cmp    %eax,%ebx
+  802bf0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802bf3:	83 ec 04             	sub    $0x4,%esp
+  802bf6:	53                   	push   %ebx
+  802bf7:	89 f0                	mov    %esi,%eax
+  802bf9:	03 45 0c             	add    0xc(%ebp),%eax
+  802bfc:	50                   	push   %eax
+  802bfd:	57                   	push   %edi
+  802bfe:	e8 c1 e4 ff ff       	call   8010c4 <memmove>
+		sys_cputs(buf, m);
+  802c03:	83 c4 08             	add    $0x8,%esp
+  802c06:	53                   	push   %ebx
+  802c07:	57                   	push   %edi
+  802c08:	e8 61 e6 ff ff       	call   80126e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802c0d:	01 de                	add    %ebx,%esi
+  802c0f:	83 c4 10             	add    $0x10,%esp
+  802c12:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c15:	72 cd                	jb     802be4 <devcons_write+0x19>
+}
+  802c17:	89 f0                	mov    %esi,%eax
+  802c19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c1c:	5b                   	pop    %ebx
+  802c1d:	5e                   	pop    %esi
+  802c1e:	5f                   	pop    %edi
+  802c1f:	5d                   	pop    %ebp
+  802c20:	c3                   	ret
+
+00802c21 <devcons_read>:
+{
+  802c21:	55                   	push   %ebp
+  802c22:	89 e5                	mov    %esp,%ebp
+  802c24:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c30:	75 07                	jne    802c39 <devcons_read+0x18>
+  802c32:	eb 1f                	jmp    802c53 <devcons_read+0x32>
+		sys_yield();
+  802c34:	e8 f2 e6 ff ff       	call   80132b <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802c39:	e8 4e e6 ff ff       	call   80128c <sys_cgetc>
+  802c3e:	85 c0                	test   %eax,%eax
+  802c40:	74 f2                	je     802c34 <devcons_read+0x13>
+	if (c < 0)
+  802c42:	78 0f                	js     802c53 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802c44:	83 f8 04             	cmp    $0x4,%eax
+  802c47:	74 0c                	je     802c55 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802c49:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c4c:	88 02                	mov    %al,(%edx)
+	return 1;
+  802c4e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c53:	c9                   	leave
+  802c54:	c3                   	ret
+		return 0;
+  802c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c5a:	eb f7                	jmp    802c53 <devcons_read+0x32>
+
+00802c5c <cputchar>:
+{
+  802c5c:	55                   	push   %ebp
+  802c5d:	89 e5                	mov    %esp,%ebp
+  802c5f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802c62:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c65:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802c68:	6a 01                	push   $0x1
+  802c6a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c6d:	50                   	push   %eax
+  802c6e:	e8 fb e5 ff ff       	call   80126e <sys_cputs>
+}
+  802c73:	83 c4 10             	add    $0x10,%esp
+  802c76:	c9                   	leave
+  802c77:	c3                   	ret
+
+00802c78 <getchar>:
+{
+  802c78:	55                   	push   %ebp
+  802c79:	89 e5                	mov    %esp,%ebp
+  802c7b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802c7e:	6a 01                	push   $0x1
+  802c80:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c83:	50                   	push   %eax
+  802c84:	6a 00                	push   $0x0
+  802c86:	e8 66 f2 ff ff       	call   801ef1 <read>
+	if (r < 0)
+  802c8b:	83 c4 10             	add    $0x10,%esp
+  802c8e:	85 c0                	test   %eax,%eax
+  802c90:	78 06                	js     802c98 <getchar+0x20>
+	if (r < 1)
+  802c92:	74 06                	je     802c9a <getchar+0x22>
+	return c;
+  802c94:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802c98:	c9                   	leave
+  802c99:	c3                   	ret
+		return -E_EOF;
+  802c9a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c9f:	eb f7                	jmp    802c98 <getchar+0x20>
+
+00802ca1 <iscons>:
+{
+  802ca1:	55                   	push   %ebp
+  802ca2:	89 e5                	mov    %esp,%ebp
+  802ca4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ca7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802caa:	50                   	push   %eax
+  802cab:	ff 75 08             	push   0x8(%ebp)
+  802cae:	e8 d8 ef ff ff       	call   801c8b <fd_lookup>
+  802cb3:	83 c4 10             	add    $0x10,%esp
+  802cb6:	85 c0                	test   %eax,%eax
+  802cb8:	78 11                	js     802ccb <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802cba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cbd:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802cc3:	39 10                	cmp    %edx,(%eax)
+  802cc5:	0f 94 c0             	sete   %al
+  802cc8:	0f b6 c0             	movzbl %al,%eax
+}
+  802ccb:	c9                   	leave
+  802ccc:	c3                   	ret
+
+00802ccd <opencons>:
+{
+  802ccd:	55                   	push   %ebp
+  802cce:	89 e5                	mov    %esp,%ebp
+  802cd0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802cd3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cd6:	50                   	push   %eax
+  802cd7:	e8 59 ef ff ff       	call   801c35 <fd_alloc>
+  802cdc:	83 c4 10             	add    $0x10,%esp
+  802cdf:	85 c0                	test   %eax,%eax
+  802ce1:	78 3a                	js     802d1d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ce3:	83 ec 04             	sub    $0x4,%esp
+  802ce6:	68 07 04 00 00       	push   $0x407
+  802ceb:	ff 75 f4             	push   -0xc(%ebp)
+  802cee:	6a 00                	push   $0x0
+  802cf0:	e8 b6 e6 ff ff       	call   8013ab <sys_page_alloc>
+  802cf5:	83 c4 10             	add    $0x10,%esp
+  802cf8:	85 c0                	test   %eax,%eax
+  802cfa:	78 21                	js     802d1d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802cfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cff:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802d05:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802d07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d0a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802d11:	83 ec 0c             	sub    $0xc,%esp
+  802d14:	50                   	push   %eax
+  802d15:	e8 f4 ee ff ff       	call   801c0e <fd2num>
+  802d1a:	83 c4 10             	add    $0x10,%esp
+}
+  802d1d:	c9                   	leave
+  802d1e:	c3                   	ret
+
+00802d1f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802d1f:	55                   	push   %ebp
+  802d20:	89 e5                	mov    %esp,%ebp
+  802d22:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802d25:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802d2c:	74 0a                	je     802d38 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802d2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d31:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  802d36:	c9                   	leave
+  802d37:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  802d38:	83 ec 04             	sub    $0x4,%esp
+  802d3b:	6a 07                	push   $0x7
+  802d3d:	68 00 f0 bf ee       	push   $0xeebff000
+  802d42:	6a 00                	push   $0x0
+  802d44:	e8 62 e6 ff ff       	call   8013ab <sys_page_alloc>
+  802d49:	83 c4 10             	add    $0x10,%esp
+  802d4c:	85 c0                	test   %eax,%eax
+  802d4e:	78 28                	js     802d78 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802d50:	83 ec 08             	sub    $0x8,%esp
+  802d53:	68 8a 2d 80 00       	push   $0x802d8a
+  802d58:	6a 00                	push   $0x0
+  802d5a:	e8 47 e9 ff ff       	call   8016a6 <sys_env_set_pgfault_upcall>
+  802d5f:	83 c4 10             	add    $0x10,%esp
+  802d62:	85 c0                	test   %eax,%eax
+  802d64:	79 c8                	jns    802d2e <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  802d66:	50                   	push   %eax
+  802d67:	68 25 39 80 00       	push   $0x803925
+  802d6c:	6a 24                	push   $0x24
+  802d6e:	68 17 39 80 00       	push   $0x803917
+  802d73:	e8 fd da ff ff       	call   800875 <_panic>
+			panic("sys_page_alloc: %e", r);
+  802d78:	50                   	push   %eax
+  802d79:	68 06 37 80 00       	push   $0x803706
+  802d7e:	6a 21                	push   $0x21
+  802d80:	68 17 39 80 00       	push   $0x803917
+  802d85:	e8 eb da ff ff       	call   800875 <_panic>
+
+00802d8a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802d8a:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802d8b:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802d90:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802d92:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802d95:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  802d98:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  802d9c:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  802d9f:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  802da3:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  802da7:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  802da9:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802daa:	83 c4 04             	add    $0x4,%esp
+	popf
+  802dad:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802dae:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802daf:	c3                   	ret
+
+00802db0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802db0:	55                   	push   %ebp
+  802db1:	89 e5                	mov    %esp,%ebp
+  802db3:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802db6:	89 c2                	mov    %eax,%edx
+  802db8:	c1 ea 16             	shr    $0x16,%edx
+  802dbb:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802dc2:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802dc7:	f6 c1 01             	test   $0x1,%cl
+  802dca:	74 22                	je     802dee <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802dcc:	c1 e8 0c             	shr    $0xc,%eax
+  802dcf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802dd6:	a8 01                	test   $0x1,%al
+  802dd8:	74 14                	je     802dee <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802dda:	c1 e8 0c             	shr    $0xc,%eax
+  802ddd:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802de0:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802de7:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802deb:	0f b7 d2             	movzwl %dx,%edx
+}
+  802dee:	89 d0                	mov    %edx,%eax
+  802df0:	5d                   	pop    %ebp
+  802df1:	c3                   	ret
+  802df2:	66 90                	xchg   %ax,%ax
+  802df4:	66 90                	xchg   %ax,%ax
+  802df6:	66 90                	xchg   %ax,%ax
+  802df8:	66 90                	xchg   %ax,%ax
+  802dfa:	66 90                	xchg   %ax,%ax
+  802dfc:	66 90                	xchg   %ax,%ax
+  802dfe:	66 90                	xchg   %ax,%ax
+
+00802e00 <__udivmoddi4>:
+  802e00:	55                   	push   %ebp
+  802e01:	57                   	push   %edi
+  802e02:	56                   	push   %esi
+  802e03:	53                   	push   %ebx
+  802e04:	83 ec 14             	sub    $0x14,%esp
+  802e07:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802e0b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802e0f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e13:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e17:	89 f1                	mov    %esi,%ecx
+  802e19:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  802e1d:	09 d9                	or     %ebx,%ecx
+  802e1f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802e23:	0f 84 92 00 00 00    	je     802ebb <__udivmoddi4+0xbb>
+  802e29:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802e30:	00 
+  802e31:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802e36:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802e3d:	00 
+  802e3e:	89 1c 24             	mov    %ebx,(%esp)
+  802e41:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802e45:	8d 76 00             	lea    0x0(%esi),%esi
+  802e48:	89 e9                	mov    %ebp,%ecx
+  802e4a:	89 c3                	mov    %eax,%ebx
+  802e4c:	89 d6                	mov    %edx,%esi
+  802e4e:	31 ff                	xor    %edi,%edi
+  802e50:	d3 ee                	shr    %cl,%esi
+  802e52:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802e55:	f6 c1 20             	test   $0x20,%cl
+  802e58:	0f 45 de             	cmovne %esi,%ebx
+  802e5b:	0f 45 f7             	cmovne %edi,%esi
+  802e5e:	8b 3c 24             	mov    (%esp),%edi
+  802e61:	39 fb                	cmp    %edi,%ebx
+  802e63:	89 f7                	mov    %esi,%edi
+  802e65:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802e69:	8b 1c 24             	mov    (%esp),%ebx
+  802e6c:	19 f7                	sbb    %esi,%edi
+  802e6e:	72 39                	jb     802ea9 <__udivmoddi4+0xa9>
+  802e70:	89 e9                	mov    %ebp,%ecx
+  802e72:	89 f7                	mov    %esi,%edi
+  802e74:	89 de                	mov    %ebx,%esi
+  802e76:	0f a5 df             	shld   %cl,%ebx,%edi
+  802e79:	d3 e6                	shl    %cl,%esi
+  802e7b:	31 db                	xor    %ebx,%ebx
+  802e7d:	f6 c1 20             	test   $0x20,%cl
+  802e80:	0f 45 fe             	cmovne %esi,%edi
+  802e83:	0f 45 f3             	cmovne %ebx,%esi
+  802e86:	29 f0                	sub    %esi,%eax
+  802e88:	be 01 00 00 00       	mov    $0x1,%esi
+  802e8d:	19 fa                	sbb    %edi,%edx
+  802e8f:	31 ff                	xor    %edi,%edi
+  802e91:	31 db                	xor    %ebx,%ebx
+  802e93:	0f a5 f7             	shld   %cl,%esi,%edi
+  802e96:	d3 e6                	shl    %cl,%esi
+  802e98:	f6 c1 20             	test   $0x20,%cl
+  802e9b:	0f 45 fe             	cmovne %esi,%edi
+  802e9e:	0f 45 f3             	cmovne %ebx,%esi
+  802ea1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802ea5:	09 74 24 08          	or     %esi,0x8(%esp)
+  802ea9:	83 ed 01             	sub    $0x1,%ebp
+  802eac:	73 9a                	jae    802e48 <__udivmoddi4+0x48>
+  802eae:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802eb2:	85 ff                	test   %edi,%edi
+  802eb4:	74 05                	je     802ebb <__udivmoddi4+0xbb>
+  802eb6:	89 07                	mov    %eax,(%edi)
+  802eb8:	89 57 04             	mov    %edx,0x4(%edi)
+  802ebb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ebf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ec3:	83 c4 14             	add    $0x14,%esp
+  802ec6:	5b                   	pop    %ebx
+  802ec7:	5e                   	pop    %esi
+  802ec8:	5f                   	pop    %edi
+  802ec9:	5d                   	pop    %ebp
+  802eca:	c3                   	ret
+  802ecb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802ecf:	90                   	nop
+
+00802ed0 <__udivdi3>:
+  802ed0:	55                   	push   %ebp
+  802ed1:	57                   	push   %edi
+  802ed2:	56                   	push   %esi
+  802ed3:	53                   	push   %ebx
+  802ed4:	83 ec 14             	sub    $0x14,%esp
+  802ed7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802edb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802edf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ee3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ee7:	89 fb                	mov    %edi,%ebx
+  802ee9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802eed:	09 f3                	or     %esi,%ebx
+  802eef:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802ef3:	0f 84 85 00 00 00    	je     802f7e <__udivdi3+0xae>
+  802ef9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802f00:	00 
+  802f01:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802f06:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802f0d:	00 
+  802f0e:	89 34 24             	mov    %esi,(%esp)
+  802f11:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802f15:	8d 76 00             	lea    0x0(%esi),%esi
+  802f18:	89 e9                	mov    %ebp,%ecx
+  802f1a:	89 c3                	mov    %eax,%ebx
+  802f1c:	89 d6                	mov    %edx,%esi
+  802f1e:	31 ff                	xor    %edi,%edi
+  802f20:	d3 ee                	shr    %cl,%esi
+  802f22:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802f25:	f6 c1 20             	test   $0x20,%cl
+  802f28:	0f 45 de             	cmovne %esi,%ebx
+  802f2b:	0f 45 f7             	cmovne %edi,%esi
+  802f2e:	8b 3c 24             	mov    (%esp),%edi
+  802f31:	39 fb                	cmp    %edi,%ebx
+  802f33:	89 f7                	mov    %esi,%edi
+  802f35:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802f39:	8b 1c 24             	mov    (%esp),%ebx
+  802f3c:	19 f7                	sbb    %esi,%edi
+  802f3e:	72 39                	jb     802f79 <__udivdi3+0xa9>
+  802f40:	89 e9                	mov    %ebp,%ecx
+  802f42:	89 f7                	mov    %esi,%edi
+  802f44:	89 de                	mov    %ebx,%esi
+  802f46:	0f a5 df             	shld   %cl,%ebx,%edi
+  802f49:	d3 e6                	shl    %cl,%esi
+  802f4b:	31 db                	xor    %ebx,%ebx
+  802f4d:	f6 c1 20             	test   $0x20,%cl
+  802f50:	0f 45 fe             	cmovne %esi,%edi
+  802f53:	0f 45 f3             	cmovne %ebx,%esi
+  802f56:	29 f0                	sub    %esi,%eax
+  802f58:	be 01 00 00 00       	mov    $0x1,%esi
+  802f5d:	19 fa                	sbb    %edi,%edx
+  802f5f:	31 ff                	xor    %edi,%edi
+  802f61:	31 db                	xor    %ebx,%ebx
+  802f63:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f66:	d3 e6                	shl    %cl,%esi
+  802f68:	f6 c1 20             	test   $0x20,%cl
+  802f6b:	0f 45 fe             	cmovne %esi,%edi
+  802f6e:	0f 45 f3             	cmovne %ebx,%esi
+  802f71:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802f75:	09 74 24 08          	or     %esi,0x8(%esp)
+  802f79:	83 ed 01             	sub    $0x1,%ebp
+  802f7c:	73 9a                	jae    802f18 <__udivdi3+0x48>
+  802f7e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f82:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f86:	83 c4 14             	add    $0x14,%esp
+  802f89:	5b                   	pop    %ebx
+  802f8a:	5e                   	pop    %esi
+  802f8b:	5f                   	pop    %edi
+  802f8c:	5d                   	pop    %ebp
+  802f8d:	c3                   	ret
+  802f8e:	66 90                	xchg   %ax,%ax
+
+00802f90 <__umoddi3>:
+  802f90:	57                   	push   %edi
+  802f91:	56                   	push   %esi
+  802f92:	53                   	push   %ebx
+  802f93:	83 ec 08             	sub    $0x8,%esp
+  802f96:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  802f9a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  802f9e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802fa2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802fa6:	89 f9                	mov    %edi,%ecx
+  802fa8:	89 34 24             	mov    %esi,(%esp)
+  802fab:	09 f1                	or     %esi,%ecx
+  802fad:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802fb1:	74 53                	je     803006 <__umoddi3+0x76>
+  802fb3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802fb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802fbf:	90                   	nop
+  802fc0:	89 c6                	mov    %eax,%esi
+  802fc2:	89 d7                	mov    %edx,%edi
+  802fc4:	31 db                	xor    %ebx,%ebx
+  802fc6:	d3 ef                	shr    %cl,%edi
+  802fc8:	0f ad d6             	shrd   %cl,%edx,%esi
+  802fcb:	f6 c1 20             	test   $0x20,%cl
+  802fce:	0f 45 f7             	cmovne %edi,%esi
+  802fd1:	0f 45 fb             	cmovne %ebx,%edi
+  802fd4:	8b 1c 24             	mov    (%esp),%ebx
+  802fd7:	39 de                	cmp    %ebx,%esi
+  802fd9:	89 fb                	mov    %edi,%ebx
+  802fdb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  802fdf:	8b 34 24             	mov    (%esp),%esi
+  802fe2:	19 fb                	sbb    %edi,%ebx
+  802fe4:	72 14                	jb     802ffa <__umoddi3+0x6a>
+  802fe6:	0f a5 f7             	shld   %cl,%esi,%edi
+  802fe9:	31 db                	xor    %ebx,%ebx
+  802feb:	d3 e6                	shl    %cl,%esi
+  802fed:	f6 c1 20             	test   $0x20,%cl
+  802ff0:	0f 45 fe             	cmovne %esi,%edi
+  802ff3:	0f 45 f3             	cmovne %ebx,%esi
+  802ff6:	29 f0                	sub    %esi,%eax
+  802ff8:	19 fa                	sbb    %edi,%edx
+  802ffa:	83 e9 01             	sub    $0x1,%ecx
+  802ffd:	73 c1                	jae    802fc0 <__umoddi3+0x30>
+  802fff:	83 c4 08             	add    $0x8,%esp
+  803002:	5b                   	pop    %ebx
+  803003:	5e                   	pop    %esi
+  803004:	5f                   	pop    %edi
+  803005:	c3                   	ret
+  803006:	83 c4 08             	add    $0x8,%esp
+  803009:	31 c0                	xor    %eax,%eax
+  80300b:	31 d2                	xor    %edx,%edx
+  80300d:	5b                   	pop    %ebx
+  80300e:	5e                   	pop    %esi
+  80300f:	5f                   	pop    %edi
+  803010:	c3                   	ret
+  803011:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80301f:	90                   	nop
+
+00803020 <__divdi3>:
+  803020:	55                   	push   %ebp
+  803021:	57                   	push   %edi
+  803022:	56                   	push   %esi
+  803023:	53                   	push   %ebx
+  803024:	83 ec 1c             	sub    $0x1c,%esp
+  803027:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80302b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80302f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  803033:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  803037:	85 ff                	test   %edi,%edi
+  803039:	0f 88 da 00 00 00    	js     803119 <__divdi3+0xf9>
+  80303f:	85 db                	test   %ebx,%ebx
+  803041:	78 16                	js     803059 <__divdi3+0x39>
+  803043:	89 dd                	mov    %ebx,%ebp
+  803045:	89 c8                	mov    %ecx,%eax
+  803047:	89 da                	mov    %ebx,%edx
+  803049:	09 cd                	or     %ecx,%ebp
+  80304b:	0f 85 fd 00 00 00    	jne    80314e <__divdi3+0x12e>
+  803051:	83 c4 1c             	add    $0x1c,%esp
+  803054:	5b                   	pop    %ebx
+  803055:	5e                   	pop    %esi
+  803056:	5f                   	pop    %edi
+  803057:	5d                   	pop    %ebp
+  803058:	c3                   	ret
+  803059:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80305e:	f7 d9                	neg    %ecx
+  803060:	89 f0                	mov    %esi,%eax
+  803062:	89 fa                	mov    %edi,%edx
+  803064:	83 d3 00             	adc    $0x0,%ebx
+  803067:	89 0c 24             	mov    %ecx,(%esp)
+  80306a:	f7 db                	neg    %ebx
+  80306c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  803070:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803077:	00 
+  803078:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80307d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803084:	00 
+  803085:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  803089:	89 cd                	mov    %ecx,%ebp
+  80308b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80308f:	90                   	nop
+  803090:	89 e9                	mov    %ebp,%ecx
+  803092:	89 c3                	mov    %eax,%ebx
+  803094:	89 d6                	mov    %edx,%esi
+  803096:	31 ff                	xor    %edi,%edi
+  803098:	d3 ee                	shr    %cl,%esi
+  80309a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80309d:	f6 c1 20             	test   $0x20,%cl
+  8030a0:	0f 45 de             	cmovne %esi,%ebx
+  8030a3:	0f 45 f7             	cmovne %edi,%esi
+  8030a6:	8b 3c 24             	mov    (%esp),%edi
+  8030a9:	39 fb                	cmp    %edi,%ebx
+  8030ab:	89 f7                	mov    %esi,%edi
+  8030ad:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8030b1:	8b 1c 24             	mov    (%esp),%ebx
+  8030b4:	19 f7                	sbb    %esi,%edi
+  8030b6:	72 39                	jb     8030f1 <__divdi3+0xd1>
+  8030b8:	89 e9                	mov    %ebp,%ecx
+  8030ba:	89 f7                	mov    %esi,%edi
+  8030bc:	89 de                	mov    %ebx,%esi
+  8030be:	0f a5 df             	shld   %cl,%ebx,%edi
+  8030c1:	d3 e6                	shl    %cl,%esi
+  8030c3:	31 db                	xor    %ebx,%ebx
+  8030c5:	f6 c1 20             	test   $0x20,%cl
+  8030c8:	0f 45 fe             	cmovne %esi,%edi
+  8030cb:	0f 45 f3             	cmovne %ebx,%esi
+  8030ce:	29 f0                	sub    %esi,%eax
+  8030d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8030d5:	19 fa                	sbb    %edi,%edx
+  8030d7:	31 ff                	xor    %edi,%edi
+  8030d9:	31 db                	xor    %ebx,%ebx
+  8030db:	0f a5 f7             	shld   %cl,%esi,%edi
+  8030de:	d3 e6                	shl    %cl,%esi
+  8030e0:	f6 c1 20             	test   $0x20,%cl
+  8030e3:	0f 45 fe             	cmovne %esi,%edi
+  8030e6:	0f 45 f3             	cmovne %ebx,%esi
+  8030e9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8030ed:	09 74 24 08          	or     %esi,0x8(%esp)
+  8030f1:	83 ed 01             	sub    $0x1,%ebp
+  8030f4:	73 9a                	jae    803090 <__divdi3+0x70>
+  8030f6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8030fa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8030fe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803102:	85 ed                	test   %ebp,%ebp
+  803104:	0f 84 47 ff ff ff    	je     803051 <__divdi3+0x31>
+  80310a:	f7 d8                	neg    %eax
+  80310c:	83 d2 00             	adc    $0x0,%edx
+  80310f:	83 c4 1c             	add    $0x1c,%esp
+  803112:	5b                   	pop    %ebx
+  803113:	f7 da                	neg    %edx
+  803115:	5e                   	pop    %esi
+  803116:	5f                   	pop    %edi
+  803117:	5d                   	pop    %ebp
+  803118:	c3                   	ret
+  803119:	f7 de                	neg    %esi
+  80311b:	83 d7 00             	adc    $0x0,%edi
+  80311e:	f7 df                	neg    %edi
+  803120:	85 db                	test   %ebx,%ebx
+  803122:	78 23                	js     803147 <__divdi3+0x127>
+  803124:	89 dd                	mov    %ebx,%ebp
+  803126:	89 c8                	mov    %ecx,%eax
+  803128:	89 da                	mov    %ebx,%edx
+  80312a:	09 cd                	or     %ecx,%ebp
+  80312c:	0f 84 1f ff ff ff    	je     803051 <__divdi3+0x31>
+  803132:	89 0c 24             	mov    %ecx,(%esp)
+  803135:	89 f0                	mov    %esi,%eax
+  803137:	89 fa                	mov    %edi,%edx
+  803139:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80313e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  803142:	e9 29 ff ff ff       	jmp    803070 <__divdi3+0x50>
+  803147:	31 ed                	xor    %ebp,%ebp
+  803149:	e9 10 ff ff ff       	jmp    80305e <__divdi3+0x3e>
+  80314e:	89 0c 24             	mov    %ecx,(%esp)
+  803151:	89 f0                	mov    %esi,%eax
+  803153:	89 fa                	mov    %edi,%edx
+  803155:	31 ed                	xor    %ebp,%ebp
+  803157:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80315b:	e9 10 ff ff ff       	jmp    803070 <__divdi3+0x50>
+
+00803160 <__moddi3>:
+  803160:	55                   	push   %ebp
+  803161:	57                   	push   %edi
+  803162:	56                   	push   %esi
+  803163:	53                   	push   %ebx
+  803164:	83 ec 14             	sub    $0x14,%esp
+  803167:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80316b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80316f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803173:	8b 74 24 34          	mov    0x34(%esp),%esi
+  803177:	85 d2                	test   %edx,%edx
+  803179:	0f 88 9b 00 00 00    	js     80321a <__moddi3+0xba>
+  80317f:	89 f7                	mov    %esi,%edi
+  803181:	31 ed                	xor    %ebp,%ebp
+  803183:	09 cf                	or     %ecx,%edi
+  803185:	0f 84 83 00 00 00    	je     80320e <__moddi3+0xae>
+  80318b:	89 cb                	mov    %ecx,%ebx
+  80318d:	89 f7                	mov    %esi,%edi
+  80318f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  803193:	f7 db                	neg    %ebx
+  803195:	83 d7 00             	adc    $0x0,%edi
+  803198:	f7 df                	neg    %edi
+  80319a:	0f 49 f7             	cmovns %edi,%esi
+  80319d:	0f 49 cb             	cmovns %ebx,%ecx
+  8031a0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8031a4:	89 0c 24             	mov    %ecx,(%esp)
+  8031a7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8031ac:	89 cd                	mov    %ecx,%ebp
+  8031ae:	66 90                	xchg   %ax,%ax
+  8031b0:	89 e9                	mov    %ebp,%ecx
+  8031b2:	89 c3                	mov    %eax,%ebx
+  8031b4:	89 d6                	mov    %edx,%esi
+  8031b6:	31 ff                	xor    %edi,%edi
+  8031b8:	d3 ee                	shr    %cl,%esi
+  8031ba:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8031bd:	f6 c1 20             	test   $0x20,%cl
+  8031c0:	0f 45 de             	cmovne %esi,%ebx
+  8031c3:	0f 45 f7             	cmovne %edi,%esi
+  8031c6:	8b 3c 24             	mov    (%esp),%edi
+  8031c9:	39 fb                	cmp    %edi,%ebx
+  8031cb:	89 f7                	mov    %esi,%edi
+  8031cd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8031d1:	8b 1c 24             	mov    (%esp),%ebx
+  8031d4:	19 f7                	sbb    %esi,%edi
+  8031d6:	72 1a                	jb     8031f2 <__moddi3+0x92>
+  8031d8:	89 e9                	mov    %ebp,%ecx
+  8031da:	89 f7                	mov    %esi,%edi
+  8031dc:	89 de                	mov    %ebx,%esi
+  8031de:	0f a5 df             	shld   %cl,%ebx,%edi
+  8031e1:	d3 e6                	shl    %cl,%esi
+  8031e3:	31 db                	xor    %ebx,%ebx
+  8031e5:	f6 c1 20             	test   $0x20,%cl
+  8031e8:	0f 45 fe             	cmovne %esi,%edi
+  8031eb:	0f 45 f3             	cmovne %ebx,%esi
+  8031ee:	29 f0                	sub    %esi,%eax
+  8031f0:	19 fa                	sbb    %edi,%edx
+  8031f2:	83 ed 01             	sub    $0x1,%ebp
+  8031f5:	73 b9                	jae    8031b0 <__moddi3+0x50>
+  8031f7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  8031fb:	85 ed                	test   %ebp,%ebp
+  8031fd:	74 07                	je     803206 <__moddi3+0xa6>
+  8031ff:	f7 d8                	neg    %eax
+  803201:	83 d2 00             	adc    $0x0,%edx
+  803204:	f7 da                	neg    %edx
+  803206:	83 c4 14             	add    $0x14,%esp
+  803209:	5b                   	pop    %ebx
+  80320a:	5e                   	pop    %esi
+  80320b:	5f                   	pop    %edi
+  80320c:	5d                   	pop    %ebp
+  80320d:	c3                   	ret
+  80320e:	83 c4 14             	add    $0x14,%esp
+  803211:	31 c0                	xor    %eax,%eax
+  803213:	31 d2                	xor    %edx,%edx
+  803215:	5b                   	pop    %ebx
+  803216:	5e                   	pop    %esi
+  803217:	5f                   	pop    %edi
+  803218:	5d                   	pop    %ebp
+  803219:	c3                   	ret
+  80321a:	89 f7                	mov    %esi,%edi
+  80321c:	09 cf                	or     %ecx,%edi
+  80321e:	74 11                	je     803231 <__moddi3+0xd1>
+  803220:	f7 d8                	neg    %eax
+  803222:	bd 01 00 00 00       	mov    $0x1,%ebp
+  803227:	83 d2 00             	adc    $0x0,%edx
+  80322a:	f7 da                	neg    %edx
+  80322c:	e9 5a ff ff ff       	jmp    80318b <__moddi3+0x2b>
+  803231:	31 c0                	xor    %eax,%eax
+  803233:	31 d2                	xor    %edx,%edx
+  803235:	eb c8                	jmp    8031ff <__moddi3+0x9f>
@@ -0,0 +1,6357 @@
+
+obj/net/testoutput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5e 02 00 00       	call   80028f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+static struct jif_pkt *pkt = (struct jif_pkt*)REQVA;
+
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	envid_t ns_envid = sys_getenvid();
+  800038:	e8 49 0d 00 00       	call   800d86 <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+	int i, r;
+
+	binaryname = "testoutput";
+  80003f:	c7 05 00 40 80 00 c0 	movl   $0x802cc0,0x804000
+  800046:	2c 80 00 
+
+	output_envid = fork();
+  800049:	e8 d7 12 00 00       	call   801325 <fork>
+  80004e:	a3 00 50 80 00       	mov    %eax,0x805000
+	if (output_envid < 0)
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 80 00 00 00    	js     8000db <umain+0xa8>
+	else if (output_envid == 0) {
+		output(ns_envid);
+		return;
+	}
+
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  80005b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (output_envid == 0) {
+  800060:	0f 84 89 00 00 00    	je     8000ef <umain+0xbc>
+		if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  800066:	83 ec 04             	sub    $0x4,%esp
+  800069:	6a 07                	push   $0x7
+  80006b:	68 00 b0 fe 0f       	push   $0xffeb000
+  800070:	6a 00                	push   $0x0
+  800072:	e8 ae 0d 00 00       	call   800e25 <sys_page_alloc>
+  800077:	83 c4 10             	add    $0x10,%esp
+  80007a:	85 c0                	test   %eax,%eax
+  80007c:	78 7f                	js     8000fd <umain+0xca>
+			panic("sys_page_alloc: %e", r);
+		pkt->jp_len = snprintf(pkt->jp_data,
+  80007e:	53                   	push   %ebx
+  80007f:	68 fd 2c 80 00       	push   $0x802cfd
+  800084:	68 fc 0f 00 00       	push   $0xffc
+  800089:	68 04 b0 fe 0f       	push   $0xffeb004
+  80008e:	e8 d0 08 00 00       	call   800963 <snprintf>
+  800093:	a3 00 b0 fe 0f       	mov    %eax,0xffeb000
+				       PGSIZE - sizeof(pkt->jp_len),
+				       "Packet %02d", i);
+		cprintf("Transmitting packet %d\n", i);
+  800098:	83 c4 08             	add    $0x8,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	68 09 2d 80 00       	push   $0x802d09
+  8000a1:	e8 24 03 00 00       	call   8003ca <cprintf>
+		ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8000a6:	6a 07                	push   $0x7
+  8000a8:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000ad:	6a 0b                	push   $0xb
+  8000af:	ff 35 00 50 80 00    	push   0x805000
+  8000b5:	e8 6a 15 00 00       	call   801624 <ipc_send>
+		sys_page_unmap(0, pkt);
+  8000ba:	83 c4 18             	add    $0x18,%esp
+  8000bd:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000c2:	6a 00                	push   $0x0
+  8000c4:	e8 24 0e 00 00       	call   800eed <sys_page_unmap>
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  8000c9:	83 c3 01             	add    $0x1,%ebx
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	83 fb 0a             	cmp    $0xa,%ebx
+  8000d2:	75 92                	jne    800066 <umain+0x33>
+  8000d4:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8000d9:	eb 39                	jmp    800114 <umain+0xe1>
+		panic("error forking");
+  8000db:	83 ec 04             	sub    $0x4,%esp
+  8000de:	68 cb 2c 80 00       	push   $0x802ccb
+  8000e3:	6a 16                	push   $0x16
+  8000e5:	68 d9 2c 80 00       	push   $0x802cd9
+  8000ea:	e8 00 02 00 00       	call   8002ef <_panic>
+		output(ns_envid);
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+  8000f2:	56                   	push   %esi
+  8000f3:	e8 43 01 00 00       	call   80023b <output>
+		return;
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	eb 1c                	jmp    800119 <umain+0xe6>
+			panic("sys_page_alloc: %e", r);
+  8000fd:	50                   	push   %eax
+  8000fe:	68 ea 2c 80 00       	push   $0x802cea
+  800103:	6a 1e                	push   $0x1e
+  800105:	68 d9 2c 80 00       	push   $0x802cd9
+  80010a:	e8 e0 01 00 00       	call   8002ef <_panic>
+	}
+
+	// Spin for a while, just in case IPC's or packets need to be flushed
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+		sys_yield();
+  80010f:	e8 91 0c 00 00       	call   800da5 <sys_yield>
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+  800114:	83 eb 01             	sub    $0x1,%ebx
+  800117:	75 f6                	jne    80010f <umain+0xdc>
+}
+  800119:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011c:	5b                   	pop    %ebx
+  80011d:	5e                   	pop    %esi
+  80011e:	5d                   	pop    %ebp
+  80011f:	c3                   	ret
+
+00800120 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  800120:	55                   	push   %ebp
+  800121:	89 e5                	mov    %esp,%ebp
+  800123:	57                   	push   %edi
+  800124:	56                   	push   %esi
+  800125:	53                   	push   %ebx
+  800126:	83 ec 1c             	sub    $0x1c,%esp
+  800129:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	uint32_t stop = sys_time_msec() + initial_to;
+  80012c:	e8 b8 10 00 00       	call   8011e9 <sys_time_msec>
+  800131:	03 45 0c             	add    0xc(%ebp),%eax
+  800134:	89 c3                	mov    %eax,%ebx
+
+	binaryname = "ns_timer";
+  800136:	c7 05 00 40 80 00 21 	movl   $0x802d21,0x804000
+  80013d:	2d 80 00 
+
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+
+		while (1) {
+			uint32_t to, whom;
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  800140:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  800143:	eb 05                	jmp    80014a <timer+0x2a>
+			sys_yield();
+  800145:	e8 5b 0c 00 00       	call   800da5 <sys_yield>
+		while((r = sys_time_msec()) < stop && r >= 0) {
+  80014a:	e8 9a 10 00 00       	call   8011e9 <sys_time_msec>
+  80014f:	39 d8                	cmp    %ebx,%eax
+  800151:	73 16                	jae    800169 <timer+0x49>
+  800153:	85 c0                	test   %eax,%eax
+  800155:	79 ee                	jns    800145 <timer+0x25>
+			panic("sys_time_msec: %e", r);
+  800157:	50                   	push   %eax
+  800158:	68 2a 2d 80 00       	push   $0x802d2a
+  80015d:	6a 0f                	push   $0xf
+  80015f:	68 3c 2d 80 00       	push   $0x802d3c
+  800164:	e8 86 01 00 00       	call   8002ef <_panic>
+		if (r < 0)
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	78 ea                	js     800157 <timer+0x37>
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  80016d:	6a 00                	push   $0x0
+  80016f:	6a 00                	push   $0x0
+  800171:	6a 0c                	push   $0xc
+  800173:	56                   	push   %esi
+  800174:	e8 ab 14 00 00       	call   801624 <ipc_send>
+  800179:	83 c4 10             	add    $0x10,%esp
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  80017c:	83 ec 04             	sub    $0x4,%esp
+  80017f:	6a 00                	push   $0x0
+  800181:	6a 00                	push   $0x0
+  800183:	57                   	push   %edi
+  800184:	e8 23 14 00 00       	call   8015ac <ipc_recv>
+  800189:	89 c3                	mov    %eax,%ebx
+
+			if (whom != ns_envid) {
+  80018b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80018e:	83 c4 10             	add    $0x10,%esp
+  800191:	39 f0                	cmp    %esi,%eax
+  800193:	75 09                	jne    80019e <timer+0x7e>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+				continue;
+			}
+
+			stop = sys_time_msec() + to;
+  800195:	e8 4f 10 00 00       	call   8011e9 <sys_time_msec>
+  80019a:	01 c3                	add    %eax,%ebx
+			break;
+  80019c:	eb ac                	jmp    80014a <timer+0x2a>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  80019e:	83 ec 08             	sub    $0x8,%esp
+  8001a1:	50                   	push   %eax
+  8001a2:	68 48 2d 80 00       	push   $0x802d48
+  8001a7:	e8 1e 02 00 00       	call   8003ca <cprintf>
+				continue;
+  8001ac:	83 c4 10             	add    $0x10,%esp
+  8001af:	eb cb                	jmp    80017c <timer+0x5c>
+
+008001b1 <input>:
+
+extern union Nsipc nsipcbuf;
+
+void
+input(envid_t ns_envid)
+{
+  8001b1:	55                   	push   %ebp
+  8001b2:	89 e5                	mov    %esp,%ebp
+  8001b4:	57                   	push   %edi
+  8001b5:	56                   	push   %esi
+  8001b6:	53                   	push   %ebx
+  8001b7:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  8001bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	binaryname = "ns_input";
+  8001c0:	c7 05 00 40 80 00 83 	movl   $0x802d83,0x804000
+  8001c7:	2d 80 00 
+	uint8_t buf[2048];
+	size_t size;
+	int perm = PTE_P|PTE_U|PTE_W;;
+
+	while (1) {
+		while (sys_net_try_receive(buf, &size) < 0) {
+  8001ca:	8d bd e4 f7 ff ff    	lea    -0x81c(%ebp),%edi
+  8001d0:	8d b5 e8 f7 ff ff    	lea    -0x818(%ebp),%esi
+  8001d6:	eb 05                	jmp    8001dd <input+0x2c>
+			sys_yield();
+  8001d8:	e8 c8 0b 00 00       	call   800da5 <sys_yield>
+		while (sys_net_try_receive(buf, &size) < 0) {
+  8001dd:	83 ec 08             	sub    $0x8,%esp
+  8001e0:	57                   	push   %edi
+  8001e1:	56                   	push   %esi
+  8001e2:	e8 42 10 00 00       	call   801229 <sys_net_try_receive>
+  8001e7:	83 c4 10             	add    $0x10,%esp
+  8001ea:	85 c0                	test   %eax,%eax
+  8001ec:	78 ea                	js     8001d8 <input+0x27>
+		}
+
+		while (sys_page_alloc(0, &nsipcbuf, perm) < 0);
+  8001ee:	83 ec 04             	sub    $0x4,%esp
+  8001f1:	6a 07                	push   $0x7
+  8001f3:	68 00 70 80 00       	push   $0x807000
+  8001f8:	6a 00                	push   $0x0
+  8001fa:	e8 26 0c 00 00       	call   800e25 <sys_page_alloc>
+  8001ff:	83 c4 10             	add    $0x10,%esp
+  800202:	85 c0                	test   %eax,%eax
+  800204:	78 e8                	js     8001ee <input+0x3d>
+
+		nsipcbuf.pkt.jp_len = size;
+  800206:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+  80020c:	a3 00 70 80 00       	mov    %eax,0x807000
+		memcpy(nsipcbuf.pkt.jp_data, buf, size);
+  800211:	83 ec 04             	sub    $0x4,%esp
+  800214:	50                   	push   %eax
+  800215:	56                   	push   %esi
+  800216:	68 04 70 80 00       	push   $0x807004
+  80021b:	e8 80 09 00 00       	call   800ba0 <memcpy>
+
+		while (sys_ipc_try_send(ns_envid, NSREQ_INPUT, &nsipcbuf, perm) < 0);
+  800220:	83 c4 10             	add    $0x10,%esp
+  800223:	6a 07                	push   $0x7
+  800225:	68 00 70 80 00       	push   $0x807000
+  80022a:	6a 0a                	push   $0xa
+  80022c:	53                   	push   %ebx
+  80022d:	e8 30 0f 00 00       	call   801162 <sys_ipc_try_send>
+  800232:	83 c4 10             	add    $0x10,%esp
+  800235:	85 c0                	test   %eax,%eax
+  800237:	78 ea                	js     800223 <input+0x72>
+  800239:	eb a2                	jmp    8001dd <input+0x2c>
+
+0080023b <output>:
+
+extern union Nsipc nsipcbuf;
+
+void
+output(envid_t ns_envid)
+{
+  80023b:	55                   	push   %ebp
+  80023c:	89 e5                	mov    %esp,%ebp
+  80023e:	53                   	push   %ebx
+  80023f:	83 ec 04             	sub    $0x4,%esp
+  800242:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	binaryname = "ns_output";
+  800245:	c7 05 00 40 80 00 8c 	movl   $0x802d8c,0x804000
+  80024c:	2d 80 00 
+
+	// LAB 6: Your code here:
+	// 	- read a packet from the network server
+	//	- send the packet to the device driver
+	while (1) {
+		sys_ipc_recv(&nsipcbuf);
+  80024f:	83 ec 0c             	sub    $0xc,%esp
+  800252:	68 00 70 80 00       	push   $0x807000
+  800257:	e8 4c 0f 00 00       	call   8011a8 <sys_ipc_recv>
+
+		if (thisenv->env_ipc_from != ns_envid || thisenv->env_ipc_value != NSREQ_OUTPUT)
+  80025c:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  800261:	8b 50 74             	mov    0x74(%eax),%edx
+  800264:	83 c4 10             	add    $0x10,%esp
+  800267:	39 da                	cmp    %ebx,%edx
+  800269:	75 e4                	jne    80024f <output+0x14>
+  80026b:	8b 40 70             	mov    0x70(%eax),%eax
+  80026e:	83 f8 0b             	cmp    $0xb,%eax
+  800271:	75 dc                	jne    80024f <output+0x14>
+			continue;
+
+		while (sys_net_try_send(nsipcbuf.pkt.jp_data, nsipcbuf.pkt.jp_len) < 0);
+  800273:	83 ec 08             	sub    $0x8,%esp
+  800276:	ff 35 00 70 80 00    	push   0x807000
+  80027c:	68 04 70 80 00       	push   $0x807004
+  800281:	e8 82 0f 00 00       	call   801208 <sys_net_try_send>
+  800286:	83 c4 10             	add    $0x10,%esp
+  800289:	85 c0                	test   %eax,%eax
+  80028b:	78 e6                	js     800273 <output+0x38>
+  80028d:	eb c0                	jmp    80024f <output+0x14>
+
+0080028f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80028f:	55                   	push   %ebp
+  800290:	89 e5                	mov    %esp,%ebp
+  800292:	56                   	push   %esi
+  800293:	53                   	push   %ebx
+  800294:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800297:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80029a:	e8 e7 0a 00 00       	call   800d86 <sys_getenvid>
+  80029f:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8002a4:	c1 e0 09             	shl    $0x9,%eax
+  8002a7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002ac:	a3 0c 50 80 00       	mov    %eax,0x80500c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002b1:	85 db                	test   %ebx,%ebx
+  8002b3:	7e 07                	jle    8002bc <libmain+0x2d>
+		binaryname = argv[0];
+  8002b5:	8b 06                	mov    (%esi),%eax
+  8002b7:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8002bc:	83 ec 08             	sub    $0x8,%esp
+  8002bf:	56                   	push   %esi
+  8002c0:	53                   	push   %ebx
+  8002c1:	e8 6d fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8002c6:	e8 0a 00 00 00       	call   8002d5 <exit>
+}
+  8002cb:	83 c4 10             	add    $0x10,%esp
+  8002ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002d1:	5b                   	pop    %ebx
+  8002d2:	5e                   	pop    %esi
+  8002d3:	5d                   	pop    %ebp
+  8002d4:	c3                   	ret
+
+008002d5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002d5:	55                   	push   %ebp
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002db:	e8 7c 15 00 00       	call   80185c <close_all>
+	sys_env_destroy(0);
+  8002e0:	83 ec 0c             	sub    $0xc,%esp
+  8002e3:	6a 00                	push   $0x0
+  8002e5:	e8 5b 0a 00 00       	call   800d45 <sys_env_destroy>
+}
+  8002ea:	83 c4 10             	add    $0x10,%esp
+  8002ed:	c9                   	leave
+  8002ee:	c3                   	ret
+
+008002ef <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002ef:	55                   	push   %ebp
+  8002f0:	89 e5                	mov    %esp,%ebp
+  8002f2:	56                   	push   %esi
+  8002f3:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002f4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002f7:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8002fd:	e8 84 0a 00 00       	call   800d86 <sys_getenvid>
+  800302:	83 ec 0c             	sub    $0xc,%esp
+  800305:	ff 75 0c             	push   0xc(%ebp)
+  800308:	ff 75 08             	push   0x8(%ebp)
+  80030b:	56                   	push   %esi
+  80030c:	50                   	push   %eax
+  80030d:	68 a0 2d 80 00       	push   $0x802da0
+  800312:	e8 b3 00 00 00       	call   8003ca <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800317:	83 c4 18             	add    $0x18,%esp
+  80031a:	53                   	push   %ebx
+  80031b:	ff 75 10             	push   0x10(%ebp)
+  80031e:	e8 56 00 00 00       	call   800379 <vcprintf>
+	cprintf("\n");
+  800323:	c7 04 24 1f 2d 80 00 	movl   $0x802d1f,(%esp)
+  80032a:	e8 9b 00 00 00       	call   8003ca <cprintf>
+  80032f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800332:	cc                   	int3
+	while (1)
+  800333:	eb fd                	jmp    800332 <_panic+0x43>
+
+00800335 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800335:	55                   	push   %ebp
+  800336:	89 e5                	mov    %esp,%ebp
+  800338:	53                   	push   %ebx
+  800339:	83 ec 04             	sub    $0x4,%esp
+  80033c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80033f:	8b 13                	mov    (%ebx),%edx
+  800341:	8d 42 01             	lea    0x1(%edx),%eax
+  800344:	89 03                	mov    %eax,(%ebx)
+  800346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800349:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80034d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800352:	74 09                	je     80035d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800354:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800358:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80035b:	c9                   	leave
+  80035c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80035d:	83 ec 08             	sub    $0x8,%esp
+  800360:	68 ff 00 00 00       	push   $0xff
+  800365:	8d 43 08             	lea    0x8(%ebx),%eax
+  800368:	50                   	push   %eax
+  800369:	e8 7a 09 00 00       	call   800ce8 <sys_cputs>
+		b->idx = 0;
+  80036e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800374:	83 c4 10             	add    $0x10,%esp
+  800377:	eb db                	jmp    800354 <putch+0x1f>
+
+00800379 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800379:	55                   	push   %ebp
+  80037a:	89 e5                	mov    %esp,%ebp
+  80037c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800382:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800389:	00 00 00 
+	b.cnt = 0;
+  80038c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800393:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800396:	ff 75 0c             	push   0xc(%ebp)
+  800399:	ff 75 08             	push   0x8(%ebp)
+  80039c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003a2:	50                   	push   %eax
+  8003a3:	68 35 03 80 00       	push   $0x800335
+  8003a8:	e8 14 01 00 00       	call   8004c1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003ad:	83 c4 08             	add    $0x8,%esp
+  8003b0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003b6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003bc:	50                   	push   %eax
+  8003bd:	e8 26 09 00 00       	call   800ce8 <sys_cputs>
+
+	return b.cnt;
+}
+  8003c2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003c8:	c9                   	leave
+  8003c9:	c3                   	ret
+
+008003ca <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003ca:	55                   	push   %ebp
+  8003cb:	89 e5                	mov    %esp,%ebp
+  8003cd:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003d0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003d3:	50                   	push   %eax
+  8003d4:	ff 75 08             	push   0x8(%ebp)
+  8003d7:	e8 9d ff ff ff       	call   800379 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003dc:	c9                   	leave
+  8003dd:	c3                   	ret
+
+008003de <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003de:	55                   	push   %ebp
+  8003df:	89 e5                	mov    %esp,%ebp
+  8003e1:	57                   	push   %edi
+  8003e2:	56                   	push   %esi
+  8003e3:	53                   	push   %ebx
+  8003e4:	83 ec 1c             	sub    $0x1c,%esp
+  8003e7:	89 c7                	mov    %eax,%edi
+  8003e9:	89 d6                	mov    %edx,%esi
+  8003eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003f1:	89 d1                	mov    %edx,%ecx
+  8003f3:	89 c2                	mov    %eax,%edx
+  8003f5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003f8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003fb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003fe:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800401:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800404:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80040b:	39 c2                	cmp    %eax,%edx
+  80040d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800410:	72 3e                	jb     800450 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800412:	83 ec 0c             	sub    $0xc,%esp
+  800415:	ff 75 18             	push   0x18(%ebp)
+  800418:	83 eb 01             	sub    $0x1,%ebx
+  80041b:	53                   	push   %ebx
+  80041c:	50                   	push   %eax
+  80041d:	83 ec 08             	sub    $0x8,%esp
+  800420:	ff 75 e4             	push   -0x1c(%ebp)
+  800423:	ff 75 e0             	push   -0x20(%ebp)
+  800426:	ff 75 dc             	push   -0x24(%ebp)
+  800429:	ff 75 d8             	push   -0x28(%ebp)
+  80042c:	e8 0f 25 00 00       	call   802940 <__udivdi3>
+  800431:	83 c4 18             	add    $0x18,%esp
+  800434:	52                   	push   %edx
+  800435:	50                   	push   %eax
+  800436:	89 f2                	mov    %esi,%edx
+  800438:	89 f8                	mov    %edi,%eax
+  80043a:	e8 9f ff ff ff       	call   8003de <printnum>
+  80043f:	83 c4 20             	add    $0x20,%esp
+  800442:	eb 13                	jmp    800457 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800444:	83 ec 08             	sub    $0x8,%esp
+  800447:	56                   	push   %esi
+  800448:	ff 75 18             	push   0x18(%ebp)
+  80044b:	ff d7                	call   *%edi
+  80044d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800450:	83 eb 01             	sub    $0x1,%ebx
+  800453:	85 db                	test   %ebx,%ebx
+  800455:	7f ed                	jg     800444 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800457:	83 ec 08             	sub    $0x8,%esp
+  80045a:	56                   	push   %esi
+  80045b:	83 ec 04             	sub    $0x4,%esp
+  80045e:	ff 75 e4             	push   -0x1c(%ebp)
+  800461:	ff 75 e0             	push   -0x20(%ebp)
+  800464:	ff 75 dc             	push   -0x24(%ebp)
+  800467:	ff 75 d8             	push   -0x28(%ebp)
+  80046a:	e8 91 25 00 00       	call   802a00 <__umoddi3>
+  80046f:	83 c4 14             	add    $0x14,%esp
+  800472:	0f be 80 c3 2d 80 00 	movsbl 0x802dc3(%eax),%eax
+  800479:	50                   	push   %eax
+  80047a:	ff d7                	call   *%edi
+}
+  80047c:	83 c4 10             	add    $0x10,%esp
+  80047f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800482:	5b                   	pop    %ebx
+  800483:	5e                   	pop    %esi
+  800484:	5f                   	pop    %edi
+  800485:	5d                   	pop    %ebp
+  800486:	c3                   	ret
+
+00800487 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800487:	55                   	push   %ebp
+  800488:	89 e5                	mov    %esp,%ebp
+  80048a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80048d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800491:	8b 10                	mov    (%eax),%edx
+  800493:	3b 50 04             	cmp    0x4(%eax),%edx
+  800496:	73 0a                	jae    8004a2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800498:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80049b:	89 08                	mov    %ecx,(%eax)
+  80049d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004a0:	88 02                	mov    %al,(%edx)
+}
+  8004a2:	5d                   	pop    %ebp
+  8004a3:	c3                   	ret
+
+008004a4 <printfmt>:
+{
+  8004a4:	55                   	push   %ebp
+  8004a5:	89 e5                	mov    %esp,%ebp
+  8004a7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004aa:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004ad:	50                   	push   %eax
+  8004ae:	ff 75 10             	push   0x10(%ebp)
+  8004b1:	ff 75 0c             	push   0xc(%ebp)
+  8004b4:	ff 75 08             	push   0x8(%ebp)
+  8004b7:	e8 05 00 00 00       	call   8004c1 <vprintfmt>
+}
+  8004bc:	83 c4 10             	add    $0x10,%esp
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+
+008004c1 <vprintfmt>:
+{
+  8004c1:	55                   	push   %ebp
+  8004c2:	89 e5                	mov    %esp,%ebp
+  8004c4:	57                   	push   %edi
+  8004c5:	56                   	push   %esi
+  8004c6:	53                   	push   %ebx
+  8004c7:	83 ec 2c             	sub    $0x2c,%esp
+  8004ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004cd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004d0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8004d3:	eb 0a                	jmp    8004df <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8004d5:	83 ec 08             	sub    $0x8,%esp
+  8004d8:	53                   	push   %ebx
+  8004d9:	50                   	push   %eax
+  8004da:	ff d6                	call   *%esi
+  8004dc:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004df:	83 c7 01             	add    $0x1,%edi
+  8004e2:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8004e6:	83 f8 25             	cmp    $0x25,%eax
+  8004e9:	74 0c                	je     8004f7 <vprintfmt+0x36>
+			if (ch == '\0')
+  8004eb:	85 c0                	test   %eax,%eax
+  8004ed:	75 e6                	jne    8004d5 <vprintfmt+0x14>
+}
+  8004ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004f2:	5b                   	pop    %ebx
+  8004f3:	5e                   	pop    %esi
+  8004f4:	5f                   	pop    %edi
+  8004f5:	5d                   	pop    %ebp
+  8004f6:	c3                   	ret
+		padc = ' ';
+  8004f7:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004fb:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800502:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800509:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800510:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800515:	8d 47 01             	lea    0x1(%edi),%eax
+  800518:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80051b:	0f b6 17             	movzbl (%edi),%edx
+  80051e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800521:	3c 55                	cmp    $0x55,%al
+  800523:	0f 87 cf 03 00 00    	ja     8008f8 <vprintfmt+0x437>
+  800529:	0f b6 c0             	movzbl %al,%eax
+  80052c:	ff 24 85 00 2f 80 00 	jmp    *0x802f00(,%eax,4)
+  800533:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800536:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80053a:	eb d9                	jmp    800515 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80053c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80053f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800543:	eb d0                	jmp    800515 <vprintfmt+0x54>
+  800545:	0f b6 d2             	movzbl %dl,%edx
+  800548:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80054b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800550:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800553:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800556:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80055a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80055d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800560:	83 f9 09             	cmp    $0x9,%ecx
+  800563:	77 55                	ja     8005ba <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800565:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800568:	eb e9                	jmp    800553 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80056a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056d:	8b 00                	mov    (%eax),%eax
+  80056f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800572:	8b 45 14             	mov    0x14(%ebp),%eax
+  800575:	8d 40 04             	lea    0x4(%eax),%eax
+  800578:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80057b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80057e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800582:	79 91                	jns    800515 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800584:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800587:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80058a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800591:	eb 82                	jmp    800515 <vprintfmt+0x54>
+			if (width < 0)
+  800593:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800596:	85 d2                	test   %edx,%edx
+  800598:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059d:	0f 49 c2             	cmovns %edx,%eax
+  8005a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005a6:	e9 6a ff ff ff       	jmp    800515 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005ae:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005b5:	e9 5b ff ff ff       	jmp    800515 <vprintfmt+0x54>
+  8005ba:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005bd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005c0:	eb bc                	jmp    80057e <vprintfmt+0xbd>
+			lflag++;
+  8005c2:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005c8:	e9 48 ff ff ff       	jmp    800515 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8d 78 04             	lea    0x4(%eax),%edi
+  8005d3:	83 ec 08             	sub    $0x8,%esp
+  8005d6:	53                   	push   %ebx
+  8005d7:	ff 30                	push   (%eax)
+  8005d9:	ff d6                	call   *%esi
+			break;
+  8005db:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005de:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8005e1:	e9 b1 02 00 00       	jmp    800897 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8005e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e9:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8005ec:	8b 10                	mov    (%eax),%edx
+  8005ee:	89 d0                	mov    %edx,%eax
+  8005f0:	f7 d8                	neg    %eax
+  8005f2:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005f5:	83 f8 0f             	cmp    $0xf,%eax
+  8005f8:	7f 23                	jg     80061d <vprintfmt+0x15c>
+  8005fa:	8b 14 85 60 30 80 00 	mov    0x803060(,%eax,4),%edx
+  800601:	85 d2                	test   %edx,%edx
+  800603:	74 18                	je     80061d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800605:	52                   	push   %edx
+  800606:	68 95 32 80 00       	push   $0x803295
+  80060b:	53                   	push   %ebx
+  80060c:	56                   	push   %esi
+  80060d:	e8 92 fe ff ff       	call   8004a4 <printfmt>
+  800612:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800615:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800618:	e9 7a 02 00 00       	jmp    800897 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80061d:	50                   	push   %eax
+  80061e:	68 db 2d 80 00       	push   $0x802ddb
+  800623:	53                   	push   %ebx
+  800624:	56                   	push   %esi
+  800625:	e8 7a fe ff ff       	call   8004a4 <printfmt>
+  80062a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80062d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800630:	e9 62 02 00 00       	jmp    800897 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800635:	8b 45 14             	mov    0x14(%ebp),%eax
+  800638:	83 c0 04             	add    $0x4,%eax
+  80063b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80063e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800641:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800643:	85 c9                	test   %ecx,%ecx
+  800645:	b8 d4 2d 80 00       	mov    $0x802dd4,%eax
+  80064a:	0f 45 c1             	cmovne %ecx,%eax
+  80064d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800650:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800654:	7e 06                	jle    80065c <vprintfmt+0x19b>
+  800656:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80065a:	75 0b                	jne    800667 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80065c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80065f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800662:	89 75 08             	mov    %esi,0x8(%ebp)
+  800665:	eb 5c                	jmp    8006c3 <vprintfmt+0x202>
+  800667:	83 ec 08             	sub    $0x8,%esp
+  80066a:	ff 75 d0             	push   -0x30(%ebp)
+  80066d:	ff 75 cc             	push   -0x34(%ebp)
+  800670:	e8 20 03 00 00       	call   800995 <strnlen>
+  800675:	89 c2                	mov    %eax,%edx
+  800677:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80067a:	29 d0                	sub    %edx,%eax
+  80067c:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80067f:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800683:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800686:	89 75 08             	mov    %esi,0x8(%ebp)
+  800689:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80068b:	eb 0e                	jmp    80069b <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80068d:	83 ec 08             	sub    $0x8,%esp
+  800690:	53                   	push   %ebx
+  800691:	57                   	push   %edi
+  800692:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800695:	83 ee 01             	sub    $0x1,%esi
+  800698:	83 c4 10             	add    $0x10,%esp
+  80069b:	85 f6                	test   %esi,%esi
+  80069d:	7f ee                	jg     80068d <vprintfmt+0x1cc>
+  80069f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006a2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006a5:	85 c0                	test   %eax,%eax
+  8006a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ac:	0f 49 d0             	cmovns %eax,%edx
+  8006af:	29 d0                	sub    %edx,%eax
+  8006b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006b4:	eb a6                	jmp    80065c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8006b6:	83 ec 08             	sub    $0x8,%esp
+  8006b9:	53                   	push   %ebx
+  8006ba:	52                   	push   %edx
+  8006bb:	ff 55 08             	call   *0x8(%ebp)
+  8006be:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006c1:	89 f1                	mov    %esi,%ecx
+  8006c3:	8d 71 01             	lea    0x1(%ecx),%esi
+  8006c6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006ca:	0f be d0             	movsbl %al,%edx
+  8006cd:	85 d2                	test   %edx,%edx
+  8006cf:	74 28                	je     8006f9 <vprintfmt+0x238>
+  8006d1:	85 ff                	test   %edi,%edi
+  8006d3:	78 05                	js     8006da <vprintfmt+0x219>
+  8006d5:	83 ef 01             	sub    $0x1,%edi
+  8006d8:	78 30                	js     80070a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006da:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006de:	74 d6                	je     8006b6 <vprintfmt+0x1f5>
+  8006e0:	0f be c0             	movsbl %al,%eax
+  8006e3:	83 e8 20             	sub    $0x20,%eax
+  8006e6:	83 f8 5e             	cmp    $0x5e,%eax
+  8006e9:	76 cb                	jbe    8006b6 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8006eb:	83 ec 08             	sub    $0x8,%esp
+  8006ee:	53                   	push   %ebx
+  8006ef:	6a 3f                	push   $0x3f
+  8006f1:	ff 55 08             	call   *0x8(%ebp)
+  8006f4:	83 c4 10             	add    $0x10,%esp
+  8006f7:	eb c8                	jmp    8006c1 <vprintfmt+0x200>
+  8006f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006fc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006ff:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800702:	01 d0                	add    %edx,%eax
+  800704:	29 c8                	sub    %ecx,%eax
+  800706:	89 c7                	mov    %eax,%edi
+  800708:	eb 13                	jmp    80071d <vprintfmt+0x25c>
+  80070a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80070d:	eb ed                	jmp    8006fc <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80070f:	83 ec 08             	sub    $0x8,%esp
+  800712:	53                   	push   %ebx
+  800713:	6a 20                	push   $0x20
+  800715:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800717:	83 ef 01             	sub    $0x1,%edi
+  80071a:	83 c4 10             	add    $0x10,%esp
+  80071d:	85 ff                	test   %edi,%edi
+  80071f:	7f ee                	jg     80070f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800721:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+  800727:	e9 6b 01 00 00       	jmp    800897 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80072c:	83 f9 01             	cmp    $0x1,%ecx
+  80072f:	7f 1f                	jg     800750 <vprintfmt+0x28f>
+	else if (lflag)
+  800731:	85 c9                	test   %ecx,%ecx
+  800733:	74 67                	je     80079c <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800735:	8b 45 14             	mov    0x14(%ebp),%eax
+  800738:	8b 00                	mov    (%eax),%eax
+  80073a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80073d:	89 c1                	mov    %eax,%ecx
+  80073f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800742:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8d 40 04             	lea    0x4(%eax),%eax
+  80074b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074e:	eb 17                	jmp    800767 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800750:	8b 45 14             	mov    0x14(%ebp),%eax
+  800753:	8b 50 04             	mov    0x4(%eax),%edx
+  800756:	8b 00                	mov    (%eax),%eax
+  800758:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80075b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80075e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800761:	8d 40 08             	lea    0x8(%eax),%eax
+  800764:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800767:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80076a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80076d:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800772:	85 c9                	test   %ecx,%ecx
+  800774:	0f 89 03 01 00 00    	jns    80087d <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80077a:	83 ec 08             	sub    $0x8,%esp
+  80077d:	53                   	push   %ebx
+  80077e:	6a 2d                	push   $0x2d
+  800780:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800782:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800785:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800788:	f7 da                	neg    %edx
+  80078a:	83 d1 00             	adc    $0x0,%ecx
+  80078d:	f7 d9                	neg    %ecx
+  80078f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800792:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800797:	e9 e1 00 00 00       	jmp    80087d <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80079c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079f:	8b 00                	mov    (%eax),%eax
+  8007a1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a4:	89 c1                	mov    %eax,%ecx
+  8007a6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007a9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007af:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b5:	eb b0                	jmp    800767 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8007b7:	83 f9 01             	cmp    $0x1,%ecx
+  8007ba:	7f 1e                	jg     8007da <vprintfmt+0x319>
+	else if (lflag)
+  8007bc:	85 c9                	test   %ecx,%ecx
+  8007be:	74 32                	je     8007f2 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8007c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c3:	8b 10                	mov    (%eax),%edx
+  8007c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8007cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007d0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8007d5:	e9 a3 00 00 00       	jmp    80087d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007dd:	8b 10                	mov    (%eax),%edx
+  8007df:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007e2:	8d 40 08             	lea    0x8(%eax),%eax
+  8007e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007e8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8007ed:	e9 8b 00 00 00       	jmp    80087d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f5:	8b 10                	mov    (%eax),%edx
+  8007f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800802:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800807:	eb 74                	jmp    80087d <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800809:	83 f9 01             	cmp    $0x1,%ecx
+  80080c:	7f 1b                	jg     800829 <vprintfmt+0x368>
+	else if (lflag)
+  80080e:	85 c9                	test   %ecx,%ecx
+  800810:	74 2c                	je     80083e <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800812:	8b 45 14             	mov    0x14(%ebp),%eax
+  800815:	8b 10                	mov    (%eax),%edx
+  800817:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081c:	8d 40 04             	lea    0x4(%eax),%eax
+  80081f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800822:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800827:	eb 54                	jmp    80087d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800829:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082c:	8b 10                	mov    (%eax),%edx
+  80082e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800831:	8d 40 08             	lea    0x8(%eax),%eax
+  800834:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800837:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80083c:	eb 3f                	jmp    80087d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80083e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800841:	8b 10                	mov    (%eax),%edx
+  800843:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800848:	8d 40 04             	lea    0x4(%eax),%eax
+  80084b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80084e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800853:	eb 28                	jmp    80087d <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800855:	83 ec 08             	sub    $0x8,%esp
+  800858:	53                   	push   %ebx
+  800859:	6a 30                	push   $0x30
+  80085b:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80085d:	83 c4 08             	add    $0x8,%esp
+  800860:	53                   	push   %ebx
+  800861:	6a 78                	push   $0x78
+  800863:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800865:	8b 45 14             	mov    0x14(%ebp),%eax
+  800868:	8b 10                	mov    (%eax),%edx
+  80086a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80086f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800872:	8d 40 04             	lea    0x4(%eax),%eax
+  800875:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800878:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80087d:	83 ec 0c             	sub    $0xc,%esp
+  800880:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800884:	50                   	push   %eax
+  800885:	ff 75 e0             	push   -0x20(%ebp)
+  800888:	57                   	push   %edi
+  800889:	51                   	push   %ecx
+  80088a:	52                   	push   %edx
+  80088b:	89 da                	mov    %ebx,%edx
+  80088d:	89 f0                	mov    %esi,%eax
+  80088f:	e8 4a fb ff ff       	call   8003de <printnum>
+			break;
+  800894:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800897:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80089a:	e9 40 fc ff ff       	jmp    8004df <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80089f:	83 f9 01             	cmp    $0x1,%ecx
+  8008a2:	7f 1b                	jg     8008bf <vprintfmt+0x3fe>
+	else if (lflag)
+  8008a4:	85 c9                	test   %ecx,%ecx
+  8008a6:	74 2c                	je     8008d4 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8008a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ab:	8b 10                	mov    (%eax),%edx
+  8008ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008b8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8008bd:	eb be                	jmp    80087d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c2:	8b 10                	mov    (%eax),%edx
+  8008c4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008c7:	8d 40 08             	lea    0x8(%eax),%eax
+  8008ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008cd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8008d2:	eb a9                	jmp    80087d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d7:	8b 10                	mov    (%eax),%edx
+  8008d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008de:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008e4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8008e9:	eb 92                	jmp    80087d <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8008eb:	83 ec 08             	sub    $0x8,%esp
+  8008ee:	53                   	push   %ebx
+  8008ef:	6a 25                	push   $0x25
+  8008f1:	ff d6                	call   *%esi
+			break;
+  8008f3:	83 c4 10             	add    $0x10,%esp
+  8008f6:	eb 9f                	jmp    800897 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8008f8:	83 ec 08             	sub    $0x8,%esp
+  8008fb:	53                   	push   %ebx
+  8008fc:	6a 25                	push   $0x25
+  8008fe:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800900:	83 c4 10             	add    $0x10,%esp
+  800903:	89 f8                	mov    %edi,%eax
+  800905:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800909:	74 05                	je     800910 <vprintfmt+0x44f>
+  80090b:	83 e8 01             	sub    $0x1,%eax
+  80090e:	eb f5                	jmp    800905 <vprintfmt+0x444>
+  800910:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800913:	eb 82                	jmp    800897 <vprintfmt+0x3d6>
+
+00800915 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800915:	55                   	push   %ebp
+  800916:	89 e5                	mov    %esp,%ebp
+  800918:	83 ec 18             	sub    $0x18,%esp
+  80091b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80091e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800921:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800924:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800928:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80092b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800932:	85 c0                	test   %eax,%eax
+  800934:	74 26                	je     80095c <vsnprintf+0x47>
+  800936:	85 d2                	test   %edx,%edx
+  800938:	7e 22                	jle    80095c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80093a:	ff 75 14             	push   0x14(%ebp)
+  80093d:	ff 75 10             	push   0x10(%ebp)
+  800940:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800943:	50                   	push   %eax
+  800944:	68 87 04 80 00       	push   $0x800487
+  800949:	e8 73 fb ff ff       	call   8004c1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80094e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800951:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800954:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800957:	83 c4 10             	add    $0x10,%esp
+}
+  80095a:	c9                   	leave
+  80095b:	c3                   	ret
+		return -E_INVAL;
+  80095c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800961:	eb f7                	jmp    80095a <vsnprintf+0x45>
+
+00800963 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800969:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80096c:	50                   	push   %eax
+  80096d:	ff 75 10             	push   0x10(%ebp)
+  800970:	ff 75 0c             	push   0xc(%ebp)
+  800973:	ff 75 08             	push   0x8(%ebp)
+  800976:	e8 9a ff ff ff       	call   800915 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80097b:	c9                   	leave
+  80097c:	c3                   	ret
+
+0080097d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80097d:	55                   	push   %ebp
+  80097e:	89 e5                	mov    %esp,%ebp
+  800980:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800983:	b8 00 00 00 00       	mov    $0x0,%eax
+  800988:	eb 03                	jmp    80098d <strlen+0x10>
+		n++;
+  80098a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80098d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800991:	75 f7                	jne    80098a <strlen+0xd>
+	return n;
+}
+  800993:	5d                   	pop    %ebp
+  800994:	c3                   	ret
+
+00800995 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800995:	55                   	push   %ebp
+  800996:	89 e5                	mov    %esp,%ebp
+  800998:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80099b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80099e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a3:	eb 03                	jmp    8009a8 <strnlen+0x13>
+		n++;
+  8009a5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009a8:	39 d0                	cmp    %edx,%eax
+  8009aa:	74 08                	je     8009b4 <strnlen+0x1f>
+  8009ac:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009b0:	75 f3                	jne    8009a5 <strnlen+0x10>
+  8009b2:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009b4:	89 d0                	mov    %edx,%eax
+  8009b6:	5d                   	pop    %ebp
+  8009b7:	c3                   	ret
+
+008009b8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009b8:	55                   	push   %ebp
+  8009b9:	89 e5                	mov    %esp,%ebp
+  8009bb:	53                   	push   %ebx
+  8009bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009cb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009ce:	83 c0 01             	add    $0x1,%eax
+  8009d1:	84 d2                	test   %dl,%dl
+  8009d3:	75 f2                	jne    8009c7 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009d5:	89 c8                	mov    %ecx,%eax
+  8009d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009da:	c9                   	leave
+  8009db:	c3                   	ret
+
+008009dc <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	53                   	push   %ebx
+  8009e0:	83 ec 10             	sub    $0x10,%esp
+  8009e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009e6:	53                   	push   %ebx
+  8009e7:	e8 91 ff ff ff       	call   80097d <strlen>
+  8009ec:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009ef:	ff 75 0c             	push   0xc(%ebp)
+  8009f2:	01 d8                	add    %ebx,%eax
+  8009f4:	50                   	push   %eax
+  8009f5:	e8 be ff ff ff       	call   8009b8 <strcpy>
+	return dst;
+}
+  8009fa:	89 d8                	mov    %ebx,%eax
+  8009fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ff:	c9                   	leave
+  800a00:	c3                   	ret
+
+00800a01 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a01:	55                   	push   %ebp
+  800a02:	89 e5                	mov    %esp,%ebp
+  800a04:	56                   	push   %esi
+  800a05:	53                   	push   %ebx
+  800a06:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a09:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a0c:	89 f3                	mov    %esi,%ebx
+  800a0e:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a11:	89 f0                	mov    %esi,%eax
+  800a13:	eb 0f                	jmp    800a24 <strncpy+0x23>
+		*dst++ = *src;
+  800a15:	83 c0 01             	add    $0x1,%eax
+  800a18:	0f b6 0a             	movzbl (%edx),%ecx
+  800a1b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a1e:	80 f9 01             	cmp    $0x1,%cl
+  800a21:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a24:	39 d8                	cmp    %ebx,%eax
+  800a26:	75 ed                	jne    800a15 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a28:	89 f0                	mov    %esi,%eax
+  800a2a:	5b                   	pop    %ebx
+  800a2b:	5e                   	pop    %esi
+  800a2c:	5d                   	pop    %ebp
+  800a2d:	c3                   	ret
+
+00800a2e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a2e:	55                   	push   %ebp
+  800a2f:	89 e5                	mov    %esp,%ebp
+  800a31:	56                   	push   %esi
+  800a32:	53                   	push   %ebx
+  800a33:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a39:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a3c:	89 f0                	mov    %esi,%eax
+  800a3e:	85 d2                	test   %edx,%edx
+  800a40:	74 21                	je     800a63 <strlcpy+0x35>
+  800a42:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a46:	89 f2                	mov    %esi,%edx
+  800a48:	eb 09                	jmp    800a53 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a4a:	83 c1 01             	add    $0x1,%ecx
+  800a4d:	83 c2 01             	add    $0x1,%edx
+  800a50:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a53:	39 c2                	cmp    %eax,%edx
+  800a55:	74 09                	je     800a60 <strlcpy+0x32>
+  800a57:	0f b6 19             	movzbl (%ecx),%ebx
+  800a5a:	84 db                	test   %bl,%bl
+  800a5c:	75 ec                	jne    800a4a <strlcpy+0x1c>
+  800a5e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a60:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a63:	29 f0                	sub    %esi,%eax
+}
+  800a65:	5b                   	pop    %ebx
+  800a66:	5e                   	pop    %esi
+  800a67:	5d                   	pop    %ebp
+  800a68:	c3                   	ret
+
+00800a69 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a72:	eb 06                	jmp    800a7a <strcmp+0x11>
+		p++, q++;
+  800a74:	83 c1 01             	add    $0x1,%ecx
+  800a77:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a7a:	0f b6 01             	movzbl (%ecx),%eax
+  800a7d:	84 c0                	test   %al,%al
+  800a7f:	74 04                	je     800a85 <strcmp+0x1c>
+  800a81:	3a 02                	cmp    (%edx),%al
+  800a83:	74 ef                	je     800a74 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a85:	0f b6 c0             	movzbl %al,%eax
+  800a88:	0f b6 12             	movzbl (%edx),%edx
+  800a8b:	29 d0                	sub    %edx,%eax
+}
+  800a8d:	5d                   	pop    %ebp
+  800a8e:	c3                   	ret
+
+00800a8f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a8f:	55                   	push   %ebp
+  800a90:	89 e5                	mov    %esp,%ebp
+  800a92:	53                   	push   %ebx
+  800a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a99:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a9c:	eb 09                	jmp    800aa7 <strncmp+0x18>
+		n--, p++, q++;
+  800a9e:	83 ea 01             	sub    $0x1,%edx
+  800aa1:	83 c0 01             	add    $0x1,%eax
+  800aa4:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800aa7:	85 d2                	test   %edx,%edx
+  800aa9:	74 18                	je     800ac3 <strncmp+0x34>
+  800aab:	0f b6 18             	movzbl (%eax),%ebx
+  800aae:	84 db                	test   %bl,%bl
+  800ab0:	74 04                	je     800ab6 <strncmp+0x27>
+  800ab2:	3a 19                	cmp    (%ecx),%bl
+  800ab4:	74 e8                	je     800a9e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ab6:	0f b6 00             	movzbl (%eax),%eax
+  800ab9:	0f b6 11             	movzbl (%ecx),%edx
+  800abc:	29 d0                	sub    %edx,%eax
+}
+  800abe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ac1:	c9                   	leave
+  800ac2:	c3                   	ret
+		return 0;
+  800ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac8:	eb f4                	jmp    800abe <strncmp+0x2f>
+
+00800aca <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800aca:	55                   	push   %ebp
+  800acb:	89 e5                	mov    %esp,%ebp
+  800acd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ad4:	eb 03                	jmp    800ad9 <strchr+0xf>
+  800ad6:	83 c0 01             	add    $0x1,%eax
+  800ad9:	0f b6 10             	movzbl (%eax),%edx
+  800adc:	84 d2                	test   %dl,%dl
+  800ade:	74 06                	je     800ae6 <strchr+0x1c>
+		if (*s == c)
+  800ae0:	38 ca                	cmp    %cl,%dl
+  800ae2:	75 f2                	jne    800ad6 <strchr+0xc>
+  800ae4:	eb 05                	jmp    800aeb <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aeb:	5d                   	pop    %ebp
+  800aec:	c3                   	ret
+
+00800aed <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800aed:	55                   	push   %ebp
+  800aee:	89 e5                	mov    %esp,%ebp
+  800af0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800af7:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800afa:	38 ca                	cmp    %cl,%dl
+  800afc:	74 09                	je     800b07 <strfind+0x1a>
+  800afe:	84 d2                	test   %dl,%dl
+  800b00:	74 05                	je     800b07 <strfind+0x1a>
+	for (; *s; s++)
+  800b02:	83 c0 01             	add    $0x1,%eax
+  800b05:	eb f0                	jmp    800af7 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b07:	5d                   	pop    %ebp
+  800b08:	c3                   	ret
+
+00800b09 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b09:	55                   	push   %ebp
+  800b0a:	89 e5                	mov    %esp,%ebp
+  800b0c:	57                   	push   %edi
+  800b0d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b10:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b13:	85 c9                	test   %ecx,%ecx
+  800b15:	74 20                	je     800b37 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b17:	89 f8                	mov    %edi,%eax
+  800b19:	09 c8                	or     %ecx,%eax
+  800b1b:	a8 03                	test   $0x3,%al
+  800b1d:	75 12                	jne    800b31 <memset+0x28>
+		c &= 0xFF;
+  800b1f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b23:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b29:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b2c:	fc                   	cld
+  800b2d:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b2f:	eb 06                	jmp    800b37 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b34:	fc                   	cld
+  800b35:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b37:	89 f8                	mov    %edi,%eax
+  800b39:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b3c:	c9                   	leave
+  800b3d:	c3                   	ret
+
+00800b3e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b3e:	55                   	push   %ebp
+  800b3f:	89 e5                	mov    %esp,%ebp
+  800b41:	57                   	push   %edi
+  800b42:	56                   	push   %esi
+  800b43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b46:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b49:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b4c:	39 c6                	cmp    %eax,%esi
+  800b4e:	73 32                	jae    800b82 <memmove+0x44>
+  800b50:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b53:	39 d0                	cmp    %edx,%eax
+  800b55:	73 2b                	jae    800b82 <memmove+0x44>
+		s += n;
+		d += n;
+  800b57:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b5a:	89 d6                	mov    %edx,%esi
+  800b5c:	09 fe                	or     %edi,%esi
+  800b5e:	09 ce                	or     %ecx,%esi
+  800b60:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b66:	75 0e                	jne    800b76 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b68:	83 ef 04             	sub    $0x4,%edi
+  800b6b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b6e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b71:	fd                   	std
+  800b72:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b74:	eb 09                	jmp    800b7f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b76:	83 ef 01             	sub    $0x1,%edi
+  800b79:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b7c:	fd                   	std
+  800b7d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b7f:	fc                   	cld
+  800b80:	eb 1a                	jmp    800b9c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b82:	89 f2                	mov    %esi,%edx
+  800b84:	09 c2                	or     %eax,%edx
+  800b86:	09 ca                	or     %ecx,%edx
+  800b88:	f6 c2 03             	test   $0x3,%dl
+  800b8b:	75 0a                	jne    800b97 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b8d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b90:	89 c7                	mov    %eax,%edi
+  800b92:	fc                   	cld
+  800b93:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b95:	eb 05                	jmp    800b9c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b97:	89 c7                	mov    %eax,%edi
+  800b99:	fc                   	cld
+  800b9a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b9c:	5e                   	pop    %esi
+  800b9d:	5f                   	pop    %edi
+  800b9e:	5d                   	pop    %ebp
+  800b9f:	c3                   	ret
+
+00800ba0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ba0:	55                   	push   %ebp
+  800ba1:	89 e5                	mov    %esp,%ebp
+  800ba3:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ba6:	ff 75 10             	push   0x10(%ebp)
+  800ba9:	ff 75 0c             	push   0xc(%ebp)
+  800bac:	ff 75 08             	push   0x8(%ebp)
+  800baf:	e8 8a ff ff ff       	call   800b3e <memmove>
+}
+  800bb4:	c9                   	leave
+  800bb5:	c3                   	ret
+
+00800bb6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bb6:	55                   	push   %ebp
+  800bb7:	89 e5                	mov    %esp,%ebp
+  800bb9:	56                   	push   %esi
+  800bba:	53                   	push   %ebx
+  800bbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbe:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bc1:	89 c6                	mov    %eax,%esi
+  800bc3:	03 75 10             	add    0x10(%ebp),%esi
+  800bc6:	eb 06                	jmp    800bce <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bc8:	83 c0 01             	add    $0x1,%eax
+  800bcb:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bce:	39 f0                	cmp    %esi,%eax
+  800bd0:	74 14                	je     800be6 <memcmp+0x30>
+		if (*s1 != *s2)
+  800bd2:	0f b6 08             	movzbl (%eax),%ecx
+  800bd5:	0f b6 1a             	movzbl (%edx),%ebx
+  800bd8:	38 d9                	cmp    %bl,%cl
+  800bda:	74 ec                	je     800bc8 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800bdc:	0f b6 c1             	movzbl %cl,%eax
+  800bdf:	0f b6 db             	movzbl %bl,%ebx
+  800be2:	29 d8                	sub    %ebx,%eax
+  800be4:	eb 05                	jmp    800beb <memcmp+0x35>
+	}
+
+	return 0;
+  800be6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800beb:	5b                   	pop    %ebx
+  800bec:	5e                   	pop    %esi
+  800bed:	5d                   	pop    %ebp
+  800bee:	c3                   	ret
+
+00800bef <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bef:	55                   	push   %ebp
+  800bf0:	89 e5                	mov    %esp,%ebp
+  800bf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bf8:	89 c2                	mov    %eax,%edx
+  800bfa:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bfd:	eb 03                	jmp    800c02 <memfind+0x13>
+  800bff:	83 c0 01             	add    $0x1,%eax
+  800c02:	39 d0                	cmp    %edx,%eax
+  800c04:	73 04                	jae    800c0a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c06:	38 08                	cmp    %cl,(%eax)
+  800c08:	75 f5                	jne    800bff <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c0a:	5d                   	pop    %ebp
+  800c0b:	c3                   	ret
+
+00800c0c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c0c:	55                   	push   %ebp
+  800c0d:	89 e5                	mov    %esp,%ebp
+  800c0f:	57                   	push   %edi
+  800c10:	56                   	push   %esi
+  800c11:	53                   	push   %ebx
+  800c12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c18:	eb 03                	jmp    800c1d <strtol+0x11>
+		s++;
+  800c1a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c1d:	0f b6 02             	movzbl (%edx),%eax
+  800c20:	3c 20                	cmp    $0x20,%al
+  800c22:	74 f6                	je     800c1a <strtol+0xe>
+  800c24:	3c 09                	cmp    $0x9,%al
+  800c26:	74 f2                	je     800c1a <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c28:	3c 2b                	cmp    $0x2b,%al
+  800c2a:	74 2a                	je     800c56 <strtol+0x4a>
+	int neg = 0;
+  800c2c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c31:	3c 2d                	cmp    $0x2d,%al
+  800c33:	74 2b                	je     800c60 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c35:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c3b:	75 0f                	jne    800c4c <strtol+0x40>
+  800c3d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c40:	74 28                	je     800c6a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c42:	85 db                	test   %ebx,%ebx
+  800c44:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c49:	0f 44 d8             	cmove  %eax,%ebx
+  800c4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c51:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c54:	eb 46                	jmp    800c9c <strtol+0x90>
+		s++;
+  800c56:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c59:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c5e:	eb d5                	jmp    800c35 <strtol+0x29>
+		s++, neg = 1;
+  800c60:	83 c2 01             	add    $0x1,%edx
+  800c63:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c68:	eb cb                	jmp    800c35 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c6a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c6e:	74 0e                	je     800c7e <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c70:	85 db                	test   %ebx,%ebx
+  800c72:	75 d8                	jne    800c4c <strtol+0x40>
+		s++, base = 8;
+  800c74:	83 c2 01             	add    $0x1,%edx
+  800c77:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c7c:	eb ce                	jmp    800c4c <strtol+0x40>
+		s += 2, base = 16;
+  800c7e:	83 c2 02             	add    $0x2,%edx
+  800c81:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c86:	eb c4                	jmp    800c4c <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c88:	0f be c0             	movsbl %al,%eax
+  800c8b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c8e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c91:	7d 3a                	jge    800ccd <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c93:	83 c2 01             	add    $0x1,%edx
+  800c96:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c9a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c9c:	0f b6 02             	movzbl (%edx),%eax
+  800c9f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ca2:	89 f3                	mov    %esi,%ebx
+  800ca4:	80 fb 09             	cmp    $0x9,%bl
+  800ca7:	76 df                	jbe    800c88 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ca9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cac:	89 f3                	mov    %esi,%ebx
+  800cae:	80 fb 19             	cmp    $0x19,%bl
+  800cb1:	77 08                	ja     800cbb <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800cb3:	0f be c0             	movsbl %al,%eax
+  800cb6:	83 e8 57             	sub    $0x57,%eax
+  800cb9:	eb d3                	jmp    800c8e <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cbb:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cbe:	89 f3                	mov    %esi,%ebx
+  800cc0:	80 fb 19             	cmp    $0x19,%bl
+  800cc3:	77 08                	ja     800ccd <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800cc5:	0f be c0             	movsbl %al,%eax
+  800cc8:	83 e8 37             	sub    $0x37,%eax
+  800ccb:	eb c1                	jmp    800c8e <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ccd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cd1:	74 05                	je     800cd8 <strtol+0xcc>
+		*endptr = (char *) s;
+  800cd3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cd6:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800cd8:	89 c8                	mov    %ecx,%eax
+  800cda:	f7 d8                	neg    %eax
+  800cdc:	85 ff                	test   %edi,%edi
+  800cde:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ce1:	89 c8                	mov    %ecx,%eax
+  800ce3:	5b                   	pop    %ebx
+  800ce4:	5e                   	pop    %esi
+  800ce5:	5f                   	pop    %edi
+  800ce6:	5d                   	pop    %ebp
+  800ce7:	c3                   	ret
+
+00800ce8 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ce8:	55                   	push   %ebp
+  800ce9:	89 e5                	mov    %esp,%ebp
+  800ceb:	57                   	push   %edi
+  800cec:	56                   	push   %esi
+  800ced:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf9:	89 c3                	mov    %eax,%ebx
+  800cfb:	89 c7                	mov    %eax,%edi
+  800cfd:	89 c6                	mov    %eax,%esi
+  800cff:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d01:	5b                   	pop    %ebx
+  800d02:	5e                   	pop    %esi
+  800d03:	5f                   	pop    %edi
+  800d04:	5d                   	pop    %ebp
+  800d05:	c3                   	ret
+
+00800d06 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	57                   	push   %edi
+  800d0a:	56                   	push   %esi
+  800d0b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d11:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d16:	89 d1                	mov    %edx,%ecx
+  800d18:	89 d3                	mov    %edx,%ebx
+  800d1a:	89 d7                	mov    %edx,%edi
+  800d1c:	89 d6                	mov    %edx,%esi
+  800d1e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d20:	5b                   	pop    %ebx
+  800d21:	5e                   	pop    %esi
+  800d22:	5f                   	pop    %edi
+  800d23:	5d                   	pop    %ebp
+  800d24:	c3                   	ret
+
+00800d25 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	57                   	push   %edi
+  800d29:	56                   	push   %esi
+  800d2a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d2b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d33:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d38:	89 cb                	mov    %ecx,%ebx
+  800d3a:	89 cf                	mov    %ecx,%edi
+  800d3c:	89 ce                	mov    %ecx,%esi
+  800d3e:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800d40:	5b                   	pop    %ebx
+  800d41:	5e                   	pop    %esi
+  800d42:	5f                   	pop    %edi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+
+00800d45 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	57                   	push   %edi
+  800d49:	56                   	push   %esi
+  800d4a:	53                   	push   %ebx
+  800d4b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d56:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d5b:	89 cb                	mov    %ecx,%ebx
+  800d5d:	89 cf                	mov    %ecx,%edi
+  800d5f:	89 ce                	mov    %ecx,%esi
+  800d61:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d63:	85 c0                	test   %eax,%eax
+  800d65:	7f 08                	jg     800d6f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+  800d72:	50                   	push   %eax
+  800d73:	6a 03                	push   $0x3
+  800d75:	68 bf 30 80 00       	push   $0x8030bf
+  800d7a:	6a 23                	push   $0x23
+  800d7c:	68 dc 30 80 00       	push   $0x8030dc
+  800d81:	e8 69 f5 ff ff       	call   8002ef <_panic>
+
+00800d86 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	57                   	push   %edi
+  800d8a:	56                   	push   %esi
+  800d8b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d91:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d96:	89 d1                	mov    %edx,%ecx
+  800d98:	89 d3                	mov    %edx,%ebx
+  800d9a:	89 d7                	mov    %edx,%edi
+  800d9c:	89 d6                	mov    %edx,%esi
+  800d9e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+
+00800da5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800da5:	55                   	push   %ebp
+  800da6:	89 e5                	mov    %esp,%ebp
+  800da8:	57                   	push   %edi
+  800da9:	56                   	push   %esi
+  800daa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db0:	b8 16 00 00 00       	mov    $0x16,%eax
+  800db5:	89 d1                	mov    %edx,%ecx
+  800db7:	89 d3                	mov    %edx,%ebx
+  800db9:	89 d7                	mov    %edx,%edi
+  800dbb:	89 d6                	mov    %edx,%esi
+  800dbd:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dbf:	5b                   	pop    %ebx
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5f                   	pop    %edi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+
+00800dc4 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800dd4:	89 d1                	mov    %edx,%ecx
+  800dd6:	89 d3                	mov    %edx,%ebx
+  800dd8:	89 d7                	mov    %edx,%edi
+  800dda:	89 d6                	mov    %edx,%esi
+  800ddc:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800dde:	5b                   	pop    %ebx
+  800ddf:	5e                   	pop    %esi
+  800de0:	5f                   	pop    %edi
+  800de1:	5d                   	pop    %ebp
+  800de2:	c3                   	ret
+
+00800de3 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	57                   	push   %edi
+  800de7:	56                   	push   %esi
+  800de8:	53                   	push   %ebx
+  800de9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df7:	b8 15 00 00 00       	mov    $0x15,%eax
+  800dfc:	89 df                	mov    %ebx,%edi
+  800dfe:	89 de                	mov    %ebx,%esi
+  800e00:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e02:	85 c0                	test   %eax,%eax
+  800e04:	7f 08                	jg     800e0e <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800e06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e09:	5b                   	pop    %ebx
+  800e0a:	5e                   	pop    %esi
+  800e0b:	5f                   	pop    %edi
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0e:	83 ec 0c             	sub    $0xc,%esp
+  800e11:	50                   	push   %eax
+  800e12:	6a 15                	push   $0x15
+  800e14:	68 bf 30 80 00       	push   $0x8030bf
+  800e19:	6a 23                	push   $0x23
+  800e1b:	68 dc 30 80 00       	push   $0x8030dc
+  800e20:	e8 ca f4 ff ff       	call   8002ef <_panic>
+
+00800e25 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e25:	55                   	push   %ebp
+  800e26:	89 e5                	mov    %esp,%ebp
+  800e28:	57                   	push   %edi
+  800e29:	56                   	push   %esi
+  800e2a:	53                   	push   %ebx
+  800e2b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e2e:	be 00 00 00 00       	mov    $0x0,%esi
+  800e33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e39:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e41:	89 f7                	mov    %esi,%edi
+  800e43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e45:	85 c0                	test   %eax,%eax
+  800e47:	7f 08                	jg     800e51 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5e                   	pop    %esi
+  800e4e:	5f                   	pop    %edi
+  800e4f:	5d                   	pop    %ebp
+  800e50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e51:	83 ec 0c             	sub    $0xc,%esp
+  800e54:	50                   	push   %eax
+  800e55:	6a 05                	push   $0x5
+  800e57:	68 bf 30 80 00       	push   $0x8030bf
+  800e5c:	6a 23                	push   $0x23
+  800e5e:	68 dc 30 80 00       	push   $0x8030dc
+  800e63:	e8 87 f4 ff ff       	call   8002ef <_panic>
+
+00800e68 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	57                   	push   %edi
+  800e6c:	56                   	push   %esi
+  800e6d:	53                   	push   %ebx
+  800e6e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e71:	be 00 00 00 00       	mov    $0x0,%esi
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e84:	89 f7                	mov    %esi,%edi
+  800e86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e88:	85 c0                	test   %eax,%eax
+  800e8a:	7f 08                	jg     800e94 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5e                   	pop    %esi
+  800e91:	5f                   	pop    %edi
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e94:	83 ec 0c             	sub    $0xc,%esp
+  800e97:	50                   	push   %eax
+  800e98:	6a 06                	push   $0x6
+  800e9a:	68 bf 30 80 00       	push   $0x8030bf
+  800e9f:	6a 23                	push   $0x23
+  800ea1:	68 dc 30 80 00       	push   $0x8030dc
+  800ea6:	e8 44 f4 ff ff       	call   8002ef <_panic>
+
+00800eab <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	57                   	push   %edi
+  800eaf:	56                   	push   %esi
+  800eb0:	53                   	push   %ebx
+  800eb1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eba:	b8 07 00 00 00       	mov    $0x7,%eax
+  800ebf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ec8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eca:	85 c0                	test   %eax,%eax
+  800ecc:	7f 08                	jg     800ed6 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ece:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed1:	5b                   	pop    %ebx
+  800ed2:	5e                   	pop    %esi
+  800ed3:	5f                   	pop    %edi
+  800ed4:	5d                   	pop    %ebp
+  800ed5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed6:	83 ec 0c             	sub    $0xc,%esp
+  800ed9:	50                   	push   %eax
+  800eda:	6a 07                	push   $0x7
+  800edc:	68 bf 30 80 00       	push   $0x8030bf
+  800ee1:	6a 23                	push   $0x23
+  800ee3:	68 dc 30 80 00       	push   $0x8030dc
+  800ee8:	e8 02 f4 ff ff       	call   8002ef <_panic>
+
+00800eed <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eed:	55                   	push   %ebp
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	57                   	push   %edi
+  800ef1:	56                   	push   %esi
+  800ef2:	53                   	push   %ebx
+  800ef3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f01:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f06:	89 df                	mov    %ebx,%edi
+  800f08:	89 de                	mov    %ebx,%esi
+  800f0a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0c:	85 c0                	test   %eax,%eax
+  800f0e:	7f 08                	jg     800f18 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f13:	5b                   	pop    %ebx
+  800f14:	5e                   	pop    %esi
+  800f15:	5f                   	pop    %edi
+  800f16:	5d                   	pop    %ebp
+  800f17:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f18:	83 ec 0c             	sub    $0xc,%esp
+  800f1b:	50                   	push   %eax
+  800f1c:	6a 08                	push   $0x8
+  800f1e:	68 bf 30 80 00       	push   $0x8030bf
+  800f23:	6a 23                	push   $0x23
+  800f25:	68 dc 30 80 00       	push   $0x8030dc
+  800f2a:	e8 c0 f3 ff ff       	call   8002ef <_panic>
+
+00800f2f <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f2f:	55                   	push   %ebp
+  800f30:	89 e5                	mov    %esp,%ebp
+  800f32:	57                   	push   %edi
+  800f33:	56                   	push   %esi
+  800f34:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f40:	be 00 00 00 00       	mov    $0x0,%esi
+  800f45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f48:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f4b:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+
+00800f52 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	57                   	push   %edi
+  800f56:	56                   	push   %esi
+  800f57:	53                   	push   %ebx
+  800f58:	8b 45 18             	mov    0x18(%ebp),%eax
+  800f5b:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800f5e:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800f63:	77 27                	ja     800f8c <sys_page_map_range+0x3a>
+  800f65:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800f6b:	77 1f                	ja     800f8c <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800f6d:	c1 e0 0c             	shl    $0xc,%eax
+  800f70:	89 c6                	mov    %eax,%esi
+  800f72:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800f74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f82:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f85:	cd 30                	int    $0x30
+}
+  800f87:	5b                   	pop    %ebx
+  800f88:	5e                   	pop    %esi
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+		return -E_INVAL;
+  800f8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f91:	eb f4                	jmp    800f87 <sys_page_map_range+0x35>
+
+00800f93 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800f93:	55                   	push   %ebp
+  800f94:	89 e5                	mov    %esp,%ebp
+  800f96:	57                   	push   %edi
+  800f97:	56                   	push   %esi
+  800f98:	53                   	push   %ebx
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fa7:	be 00 00 00 00       	mov    $0x0,%esi
+  800fac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800faf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb4:	85 c0                	test   %eax,%eax
+  800fb6:	7f 08                	jg     800fc0 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800fb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbb:	5b                   	pop    %ebx
+  800fbc:	5e                   	pop    %esi
+  800fbd:	5f                   	pop    %edi
+  800fbe:	5d                   	pop    %ebp
+  800fbf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc0:	83 ec 0c             	sub    $0xc,%esp
+  800fc3:	50                   	push   %eax
+  800fc4:	6a 0c                	push   $0xc
+  800fc6:	68 bf 30 80 00       	push   $0x8030bf
+  800fcb:	6a 23                	push   $0x23
+  800fcd:	68 dc 30 80 00       	push   $0x8030dc
+  800fd2:	e8 18 f3 ff ff       	call   8002ef <_panic>
+
+00800fd7 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800fd7:	55                   	push   %ebp
+  800fd8:	89 e5                	mov    %esp,%ebp
+  800fda:	57                   	push   %edi
+  800fdb:	56                   	push   %esi
+  800fdc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fdd:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff0:	89 f7                	mov    %esi,%edi
+  800ff2:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ff4:	5b                   	pop    %ebx
+  800ff5:	5e                   	pop    %esi
+  800ff6:	5f                   	pop    %edi
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+
+00800ff9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	57                   	push   %edi
+  800ffd:	56                   	push   %esi
+  800ffe:	53                   	push   %ebx
+  800fff:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801012:	89 df                	mov    %ebx,%edi
+  801014:	89 de                	mov    %ebx,%esi
+  801016:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	7f 08                	jg     801024 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80101c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  801027:	50                   	push   %eax
+  801028:	6a 0f                	push   $0xf
+  80102a:	68 bf 30 80 00       	push   $0x8030bf
+  80102f:	6a 23                	push   $0x23
+  801031:	68 dc 30 80 00       	push   $0x8030dc
+  801036:	e8 b4 f2 ff ff       	call   8002ef <_panic>
+
+0080103b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	57                   	push   %edi
+  80103f:	56                   	push   %esi
+  801040:	53                   	push   %ebx
+  801041:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801044:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801049:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801054:	89 df                	mov    %ebx,%edi
+  801056:	89 de                	mov    %ebx,%esi
+  801058:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105a:	85 c0                	test   %eax,%eax
+  80105c:	7f 08                	jg     801066 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  80105e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801061:	5b                   	pop    %ebx
+  801062:	5e                   	pop    %esi
+  801063:	5f                   	pop    %edi
+  801064:	5d                   	pop    %ebp
+  801065:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801066:	83 ec 0c             	sub    $0xc,%esp
+  801069:	50                   	push   %eax
+  80106a:	6a 10                	push   $0x10
+  80106c:	68 bf 30 80 00       	push   $0x8030bf
+  801071:	6a 23                	push   $0x23
+  801073:	68 dc 30 80 00       	push   $0x8030dc
+  801078:	e8 72 f2 ff ff       	call   8002ef <_panic>
+
+0080107d <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	57                   	push   %edi
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+  801083:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801086:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801091:	b8 11 00 00 00       	mov    $0x11,%eax
+  801096:	89 df                	mov    %ebx,%edi
+  801098:	89 de                	mov    %ebx,%esi
+  80109a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80109c:	85 c0                	test   %eax,%eax
+  80109e:	7f 08                	jg     8010a8 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  8010a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a3:	5b                   	pop    %ebx
+  8010a4:	5e                   	pop    %esi
+  8010a5:	5f                   	pop    %edi
+  8010a6:	5d                   	pop    %ebp
+  8010a7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a8:	83 ec 0c             	sub    $0xc,%esp
+  8010ab:	50                   	push   %eax
+  8010ac:	6a 11                	push   $0x11
+  8010ae:	68 bf 30 80 00       	push   $0x8030bf
+  8010b3:	6a 23                	push   $0x23
+  8010b5:	68 dc 30 80 00       	push   $0x8030dc
+  8010ba:	e8 30 f2 ff ff       	call   8002ef <_panic>
+
+008010bf <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  8010bf:	55                   	push   %ebp
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	57                   	push   %edi
+  8010c3:	56                   	push   %esi
+  8010c4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ca:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010cf:	89 d1                	mov    %edx,%ecx
+  8010d1:	89 d3                	mov    %edx,%ebx
+  8010d3:	89 d7                	mov    %edx,%edi
+  8010d5:	89 d6                	mov    %edx,%esi
+  8010d7:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  8010d9:	5b                   	pop    %ebx
+  8010da:	5e                   	pop    %esi
+  8010db:	5f                   	pop    %edi
+  8010dc:	5d                   	pop    %ebp
+  8010dd:	c3                   	ret
+
+008010de <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	57                   	push   %edi
+  8010e2:	56                   	push   %esi
+  8010e3:	53                   	push   %ebx
+  8010e4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f2:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010f7:	89 df                	mov    %ebx,%edi
+  8010f9:	89 de                	mov    %ebx,%esi
+  8010fb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010fd:	85 c0                	test   %eax,%eax
+  8010ff:	7f 08                	jg     801109 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801101:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801104:	5b                   	pop    %ebx
+  801105:	5e                   	pop    %esi
+  801106:	5f                   	pop    %edi
+  801107:	5d                   	pop    %ebp
+  801108:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801109:	83 ec 0c             	sub    $0xc,%esp
+  80110c:	50                   	push   %eax
+  80110d:	6a 13                	push   $0x13
+  80110f:	68 bf 30 80 00       	push   $0x8030bf
+  801114:	6a 23                	push   $0x23
+  801116:	68 dc 30 80 00       	push   $0x8030dc
+  80111b:	e8 cf f1 ff ff       	call   8002ef <_panic>
+
+00801120 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801120:	55                   	push   %ebp
+  801121:	89 e5                	mov    %esp,%ebp
+  801123:	57                   	push   %edi
+  801124:	56                   	push   %esi
+  801125:	53                   	push   %ebx
+  801126:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801129:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801131:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801134:	b8 14 00 00 00       	mov    $0x14,%eax
+  801139:	89 df                	mov    %ebx,%edi
+  80113b:	89 de                	mov    %ebx,%esi
+  80113d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80113f:	85 c0                	test   %eax,%eax
+  801141:	7f 08                	jg     80114b <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801143:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801146:	5b                   	pop    %ebx
+  801147:	5e                   	pop    %esi
+  801148:	5f                   	pop    %edi
+  801149:	5d                   	pop    %ebp
+  80114a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114b:	83 ec 0c             	sub    $0xc,%esp
+  80114e:	50                   	push   %eax
+  80114f:	6a 14                	push   $0x14
+  801151:	68 bf 30 80 00       	push   $0x8030bf
+  801156:	6a 23                	push   $0x23
+  801158:	68 dc 30 80 00       	push   $0x8030dc
+  80115d:	e8 8d f1 ff ff       	call   8002ef <_panic>
+
+00801162 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801162:	55                   	push   %ebp
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	57                   	push   %edi
+  801166:	56                   	push   %esi
+  801167:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801168:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801173:	be 00 00 00 00       	mov    $0x0,%esi
+  801178:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80117b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80117e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801180:	5b                   	pop    %ebx
+  801181:	5e                   	pop    %esi
+  801182:	5f                   	pop    %edi
+  801183:	5d                   	pop    %ebp
+  801184:	c3                   	ret
+
+00801185 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801185:	55                   	push   %ebp
+  801186:	89 e5                	mov    %esp,%ebp
+  801188:	57                   	push   %edi
+  801189:	56                   	push   %esi
+  80118a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80118b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801191:	b8 18 00 00 00       	mov    $0x18,%eax
+  801196:	be 00 00 00 00       	mov    $0x0,%esi
+  80119b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011a1:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011a3:	5b                   	pop    %ebx
+  8011a4:	5e                   	pop    %esi
+  8011a5:	5f                   	pop    %edi
+  8011a6:	5d                   	pop    %ebp
+  8011a7:	c3                   	ret
+
+008011a8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011a8:	55                   	push   %ebp
+  8011a9:	89 e5                	mov    %esp,%ebp
+  8011ab:	57                   	push   %edi
+  8011ac:	56                   	push   %esi
+  8011ad:	53                   	push   %ebx
+  8011ae:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8011be:	89 cb                	mov    %ecx,%ebx
+  8011c0:	89 cf                	mov    %ecx,%edi
+  8011c2:	89 ce                	mov    %ecx,%esi
+  8011c4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c6:	85 c0                	test   %eax,%eax
+  8011c8:	7f 08                	jg     8011d2 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cd:	5b                   	pop    %ebx
+  8011ce:	5e                   	pop    %esi
+  8011cf:	5f                   	pop    %edi
+  8011d0:	5d                   	pop    %ebp
+  8011d1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d2:	83 ec 0c             	sub    $0xc,%esp
+  8011d5:	50                   	push   %eax
+  8011d6:	6a 19                	push   $0x19
+  8011d8:	68 bf 30 80 00       	push   $0x8030bf
+  8011dd:	6a 23                	push   $0x23
+  8011df:	68 dc 30 80 00       	push   $0x8030dc
+  8011e4:	e8 06 f1 ff ff       	call   8002ef <_panic>
+
+008011e9 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	57                   	push   %edi
+  8011ed:	56                   	push   %esi
+  8011ee:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8011f9:	89 d1                	mov    %edx,%ecx
+  8011fb:	89 d3                	mov    %edx,%ebx
+  8011fd:	89 d7                	mov    %edx,%edi
+  8011ff:	89 d6                	mov    %edx,%esi
+  801201:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801203:	5b                   	pop    %ebx
+  801204:	5e                   	pop    %esi
+  801205:	5f                   	pop    %edi
+  801206:	5d                   	pop    %ebp
+  801207:	c3                   	ret
+
+00801208 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801208:	55                   	push   %ebp
+  801209:	89 e5                	mov    %esp,%ebp
+  80120b:	57                   	push   %edi
+  80120c:	56                   	push   %esi
+  80120d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80120e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801213:	8b 55 08             	mov    0x8(%ebp),%edx
+  801216:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801219:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80121e:	89 df                	mov    %ebx,%edi
+  801220:	89 de                	mov    %ebx,%esi
+  801222:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801224:	5b                   	pop    %ebx
+  801225:	5e                   	pop    %esi
+  801226:	5f                   	pop    %edi
+  801227:	5d                   	pop    %ebp
+  801228:	c3                   	ret
+
+00801229 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801229:	55                   	push   %ebp
+  80122a:	89 e5                	mov    %esp,%ebp
+  80122c:	57                   	push   %edi
+  80122d:	56                   	push   %esi
+  80122e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80122f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801234:	8b 55 08             	mov    0x8(%ebp),%edx
+  801237:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80123f:	89 df                	mov    %ebx,%edi
+  801241:	89 de                	mov    %ebx,%esi
+  801243:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801245:	5b                   	pop    %ebx
+  801246:	5e                   	pop    %esi
+  801247:	5f                   	pop    %edi
+  801248:	5d                   	pop    %ebp
+  801249:	c3                   	ret
+
+0080124a <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80124a:	55                   	push   %ebp
+  80124b:	89 e5                	mov    %esp,%ebp
+  80124d:	53                   	push   %ebx
+  80124e:	83 ec 04             	sub    $0x4,%esp
+  801251:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801254:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  801256:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  801259:	f6 c2 02             	test   $0x2,%dl
+  80125c:	74 7b                	je     8012d9 <pgfault+0x8f>
+  80125e:	89 c1                	mov    %eax,%ecx
+  801260:	c1 e9 0c             	shr    $0xc,%ecx
+  801263:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  80126a:	f6 c5 08             	test   $0x8,%ch
+  80126d:	74 6a                	je     8012d9 <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80126f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801274:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801276:	83 ec 04             	sub    $0x4,%esp
+  801279:	6a 07                	push   $0x7
+  80127b:	68 00 f0 7f 00       	push   $0x7ff000
+  801280:	6a 00                	push   $0x0
+  801282:	e8 9e fb ff ff       	call   800e25 <sys_page_alloc>
+  801287:	83 c4 10             	add    $0x10,%esp
+  80128a:	85 c0                	test   %eax,%eax
+  80128c:	78 61                	js     8012ef <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  80128e:	83 ec 04             	sub    $0x4,%esp
+  801291:	68 00 10 00 00       	push   $0x1000
+  801296:	53                   	push   %ebx
+  801297:	68 00 f0 7f 00       	push   $0x7ff000
+  80129c:	e8 9d f8 ff ff       	call   800b3e <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  8012a1:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8012a8:	53                   	push   %ebx
+  8012a9:	6a 00                	push   $0x0
+  8012ab:	68 00 f0 7f 00       	push   $0x7ff000
+  8012b0:	6a 00                	push   $0x0
+  8012b2:	e8 f4 fb ff ff       	call   800eab <sys_page_map>
+  8012b7:	83 c4 20             	add    $0x20,%esp
+  8012ba:	85 c0                	test   %eax,%eax
+  8012bc:	78 43                	js     801301 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  8012be:	83 ec 08             	sub    $0x8,%esp
+  8012c1:	68 00 f0 7f 00       	push   $0x7ff000
+  8012c6:	6a 00                	push   $0x0
+  8012c8:	e8 20 fc ff ff       	call   800eed <sys_page_unmap>
+  8012cd:	83 c4 10             	add    $0x10,%esp
+  8012d0:	85 c0                	test   %eax,%eax
+  8012d2:	78 3f                	js     801313 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  8012d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012d7:	c9                   	leave
+  8012d8:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  8012d9:	83 ec 0c             	sub    $0xc,%esp
+  8012dc:	50                   	push   %eax
+  8012dd:	52                   	push   %edx
+  8012de:	68 ea 30 80 00       	push   $0x8030ea
+  8012e3:	6a 19                	push   $0x19
+  8012e5:	68 fb 30 80 00       	push   $0x8030fb
+  8012ea:	e8 00 f0 ff ff       	call   8002ef <_panic>
+		panic("sys_page_alloc: %e", r);
+  8012ef:	50                   	push   %eax
+  8012f0:	68 ea 2c 80 00       	push   $0x802cea
+  8012f5:	6a 24                	push   $0x24
+  8012f7:	68 fb 30 80 00       	push   $0x8030fb
+  8012fc:	e8 ee ef ff ff       	call   8002ef <_panic>
+		panic("sys_page_map: %e", r);
+  801301:	50                   	push   %eax
+  801302:	68 06 31 80 00       	push   $0x803106
+  801307:	6a 29                	push   $0x29
+  801309:	68 fb 30 80 00       	push   $0x8030fb
+  80130e:	e8 dc ef ff ff       	call   8002ef <_panic>
+		panic("sys_page_unmap: %e", r);
+  801313:	50                   	push   %eax
+  801314:	68 17 31 80 00       	push   $0x803117
+  801319:	6a 2c                	push   $0x2c
+  80131b:	68 fb 30 80 00       	push   $0x8030fb
+  801320:	e8 ca ef ff ff       	call   8002ef <_panic>
+
+00801325 <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  801325:	55                   	push   %ebp
+  801326:	89 e5                	mov    %esp,%ebp
+  801328:	57                   	push   %edi
+  801329:	56                   	push   %esi
+  80132a:	53                   	push   %ebx
+  80132b:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80132e:	68 4a 12 80 00       	push   $0x80124a
+  801333:	e8 61 14 00 00       	call   802799 <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  801338:	83 c4 08             	add    $0x8,%esp
+  80133b:	6a 01                	push   $0x1
+  80133d:	6a 00                	push   $0x0
+  80133f:	e8 9f fa ff ff       	call   800de3 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  801344:	e8 7b fa ff ff       	call   800dc4 <sys_fork_cow>
+  801349:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  80134c:	83 c4 10             	add    $0x10,%esp
+  80134f:	85 c0                	test   %eax,%eax
+  801351:	74 2c                	je     80137f <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  801353:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  801357:	0f 85 8b 01 00 00    	jne    8014e8 <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80135d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801362:	cd 30                	int    $0x30
+  801364:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  801367:	85 c0                	test   %eax,%eax
+  801369:	78 30                	js     80139b <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  80136b:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801370:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  801375:	74 36                	je     8013ad <fork+0x88>
+  801377:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80137a:	e9 99 00 00 00       	jmp    801418 <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80137f:	e8 02 fa ff ff       	call   800d86 <sys_getenvid>
+  801384:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801389:	c1 e0 09             	shl    $0x9,%eax
+  80138c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801391:	a3 0c 50 80 00       	mov    %eax,0x80500c
+		return 0;
+  801396:	e9 4d 01 00 00       	jmp    8014e8 <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  80139b:	50                   	push   %eax
+  80139c:	68 2a 31 80 00       	push   $0x80312a
+  8013a1:	6a 7d                	push   $0x7d
+  8013a3:	68 fb 30 80 00       	push   $0x8030fb
+  8013a8:	e8 42 ef ff ff       	call   8002ef <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8013ad:	e8 d4 f9 ff ff       	call   800d86 <sys_getenvid>
+  8013b2:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8013b7:	c1 e0 09             	shl    $0x9,%eax
+  8013ba:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8013bf:	a3 0c 50 80 00       	mov    %eax,0x80500c
+		return 0;
+  8013c4:	e9 1f 01 00 00       	jmp    8014e8 <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  8013c9:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8013d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8013d3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8013db:	83 ec 0c             	sub    $0xc,%esp
+  8013de:	50                   	push   %eax
+  8013df:	56                   	push   %esi
+  8013e0:	ff 75 e4             	push   -0x1c(%ebp)
+  8013e3:	56                   	push   %esi
+  8013e4:	6a 00                	push   $0x0
+  8013e6:	e8 c0 fa ff ff       	call   800eab <sys_page_map>
+  8013eb:	83 c4 20             	add    $0x20,%esp
+  8013ee:	85 c0                	test   %eax,%eax
+  8013f0:	0f 88 98 00 00 00    	js     80148e <fork+0x169>
+	if (perm & PTE_COW) {
+  8013f6:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  8013fd:	0f 85 61 01 00 00    	jne    801564 <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801403:	83 c7 01             	add    $0x1,%edi
+  801406:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80140c:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  801412:	0f 84 88 00 00 00    	je     8014a0 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  801418:	89 f0                	mov    %esi,%eax
+  80141a:	c1 e8 16             	shr    $0x16,%eax
+  80141d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801424:	25 81 00 00 00       	and    $0x81,%eax
+  801429:	83 f8 01             	cmp    $0x1,%eax
+  80142c:	75 d5                	jne    801403 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  80142e:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  801435:	a8 01                	test   $0x1,%al
+  801437:	74 ca                	je     801403 <fork+0xde>
+  801439:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  80143f:	74 c2                	je     801403 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  801441:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  801443:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80144a:	f6 c4 04             	test   $0x4,%ah
+  80144d:	0f 85 76 ff ff ff    	jne    8013c9 <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  801453:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80145a:	a8 02                	test   $0x2,%al
+  80145c:	0f 85 dc 00 00 00    	jne    80153e <fork+0x219>
+  801462:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801469:	f6 c4 08             	test   $0x8,%ah
+  80146c:	0f 85 cc 00 00 00    	jne    80153e <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801472:	83 ec 0c             	sub    $0xc,%esp
+  801475:	6a 05                	push   $0x5
+  801477:	56                   	push   %esi
+  801478:	ff 75 e4             	push   -0x1c(%ebp)
+  80147b:	56                   	push   %esi
+  80147c:	6a 00                	push   $0x0
+  80147e:	e8 28 fa ff ff       	call   800eab <sys_page_map>
+  801483:	83 c4 20             	add    $0x20,%esp
+  801486:	85 c0                	test   %eax,%eax
+  801488:	0f 89 75 ff ff ff    	jns    801403 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  80148e:	50                   	push   %eax
+  80148f:	68 06 31 80 00       	push   $0x803106
+  801494:	6a 48                	push   $0x48
+  801496:	68 fb 30 80 00       	push   $0x8030fb
+  80149b:	e8 4f ee ff ff       	call   8002ef <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  8014a0:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8014a3:	83 ec 04             	sub    $0x4,%esp
+  8014a6:	6a 07                	push   $0x7
+  8014a8:	68 00 f0 bf ee       	push   $0xeebff000
+  8014ad:	53                   	push   %ebx
+  8014ae:	e8 72 f9 ff ff       	call   800e25 <sys_page_alloc>
+  8014b3:	83 c4 10             	add    $0x10,%esp
+  8014b6:	85 c0                	test   %eax,%eax
+  8014b8:	78 39                	js     8014f3 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8014ba:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8014bf:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  8014c5:	83 ec 08             	sub    $0x8,%esp
+  8014c8:	50                   	push   %eax
+  8014c9:	53                   	push   %ebx
+  8014ca:	e8 51 fc ff ff       	call   801120 <sys_env_set_pgfault_upcall>
+  8014cf:	83 c4 10             	add    $0x10,%esp
+  8014d2:	85 c0                	test   %eax,%eax
+  8014d4:	78 36                	js     80150c <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8014d6:	83 ec 08             	sub    $0x8,%esp
+  8014d9:	6a 02                	push   $0x2
+  8014db:	53                   	push   %ebx
+  8014dc:	e8 18 fb ff ff       	call   800ff9 <sys_env_set_status>
+  8014e1:	83 c4 10             	add    $0x10,%esp
+  8014e4:	85 c0                	test   %eax,%eax
+  8014e6:	78 3d                	js     801525 <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  8014e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8014eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ee:	5b                   	pop    %ebx
+  8014ef:	5e                   	pop    %esi
+  8014f0:	5f                   	pop    %edi
+  8014f1:	5d                   	pop    %ebp
+  8014f2:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  8014f3:	83 ec 0c             	sub    $0xc,%esp
+  8014f6:	53                   	push   %ebx
+  8014f7:	50                   	push   %eax
+  8014f8:	68 50 31 80 00       	push   $0x803150
+  8014fd:	68 92 00 00 00       	push   $0x92
+  801502:	68 fb 30 80 00       	push   $0x8030fb
+  801507:	e8 e3 ed ff ff       	call   8002ef <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  80150c:	83 ec 0c             	sub    $0xc,%esp
+  80150f:	53                   	push   %ebx
+  801510:	50                   	push   %eax
+  801511:	68 74 31 80 00       	push   $0x803174
+  801516:	68 95 00 00 00       	push   $0x95
+  80151b:	68 fb 30 80 00       	push   $0x8030fb
+  801520:	e8 ca ed ff ff       	call   8002ef <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  801525:	83 ec 0c             	sub    $0xc,%esp
+  801528:	53                   	push   %ebx
+  801529:	50                   	push   %eax
+  80152a:	68 a4 31 80 00       	push   $0x8031a4
+  80152f:	68 98 00 00 00       	push   $0x98
+  801534:	68 fb 30 80 00       	push   $0x8030fb
+  801539:	e8 b1 ed ff ff       	call   8002ef <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  80153e:	83 ec 0c             	sub    $0xc,%esp
+  801541:	68 05 08 00 00       	push   $0x805
+  801546:	53                   	push   %ebx
+  801547:	ff 75 e4             	push   -0x1c(%ebp)
+  80154a:	53                   	push   %ebx
+  80154b:	6a 00                	push   $0x0
+  80154d:	e8 59 f9 ff ff       	call   800eab <sys_page_map>
+  801552:	83 c4 20             	add    $0x20,%esp
+  801555:	85 c0                	test   %eax,%eax
+  801557:	0f 88 31 ff ff ff    	js     80148e <fork+0x169>
+		perm |= PTE_COW;
+  80155d:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  801564:	83 ec 0c             	sub    $0xc,%esp
+  801567:	ff 75 e0             	push   -0x20(%ebp)
+  80156a:	53                   	push   %ebx
+  80156b:	6a 00                	push   $0x0
+  80156d:	53                   	push   %ebx
+  80156e:	6a 00                	push   $0x0
+  801570:	e8 36 f9 ff ff       	call   800eab <sys_page_map>
+  801575:	83 c4 20             	add    $0x20,%esp
+  801578:	85 c0                	test   %eax,%eax
+  80157a:	0f 89 83 fe ff ff    	jns    801403 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  801580:	50                   	push   %eax
+  801581:	68 06 31 80 00       	push   $0x803106
+  801586:	6a 4c                	push   $0x4c
+  801588:	68 fb 30 80 00       	push   $0x8030fb
+  80158d:	e8 5d ed ff ff       	call   8002ef <_panic>
+
+00801592 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801592:	55                   	push   %ebp
+  801593:	89 e5                	mov    %esp,%ebp
+  801595:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801598:	68 3a 31 80 00       	push   $0x80313a
+  80159d:	68 a0 00 00 00       	push   $0xa0
+  8015a2:	68 fb 30 80 00       	push   $0x8030fb
+  8015a7:	e8 43 ed ff ff       	call   8002ef <_panic>
+
+008015ac <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	57                   	push   %edi
+  8015b0:	56                   	push   %esi
+  8015b1:	53                   	push   %ebx
+  8015b2:	83 ec 18             	sub    $0x18,%esp
+  8015b5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8015bb:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8015be:	85 db                	test   %ebx,%ebx
+  8015c0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8015c5:	0f 45 c3             	cmovne %ebx,%eax
+  8015c8:	50                   	push   %eax
+  8015c9:	e8 da fb ff ff       	call   8011a8 <sys_ipc_recv>
+
+	if (from_env_store)
+  8015ce:	83 c4 10             	add    $0x10,%esp
+  8015d1:	85 ff                	test   %edi,%edi
+  8015d3:	74 17                	je     8015ec <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8015d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015da:	85 c0                	test   %eax,%eax
+  8015dc:	75 0c                	jne    8015ea <ipc_recv+0x3e>
+  8015de:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+  8015e4:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8015ea:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8015ec:	85 f6                	test   %esi,%esi
+  8015ee:	74 2e                	je     80161e <ipc_recv+0x72>
+		if (!r && pg)
+  8015f0:	85 c0                	test   %eax,%eax
+  8015f2:	75 24                	jne    801618 <ipc_recv+0x6c>
+  8015f4:	85 db                	test   %ebx,%ebx
+  8015f6:	74 20                	je     801618 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8015f8:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8015fd:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  801603:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  801605:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  80160a:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  801610:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801613:	5b                   	pop    %ebx
+  801614:	5e                   	pop    %esi
+  801615:	5f                   	pop    %edi
+  801616:	5d                   	pop    %ebp
+  801617:	c3                   	ret
+			*perm_store = 0;
+  801618:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80161e:	85 c0                	test   %eax,%eax
+  801620:	75 ee                	jne    801610 <ipc_recv+0x64>
+  801622:	eb e1                	jmp    801605 <ipc_recv+0x59>
+
+00801624 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801624:	55                   	push   %ebp
+  801625:	89 e5                	mov    %esp,%ebp
+  801627:	57                   	push   %edi
+  801628:	56                   	push   %esi
+  801629:	53                   	push   %ebx
+  80162a:	83 ec 0c             	sub    $0xc,%esp
+  80162d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801630:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801633:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  801636:	85 db                	test   %ebx,%ebx
+  801638:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80163d:	0f 44 d8             	cmove  %eax,%ebx
+  801640:	ff 75 14             	push   0x14(%ebp)
+  801643:	53                   	push   %ebx
+  801644:	56                   	push   %esi
+  801645:	57                   	push   %edi
+  801646:	e8 3a fb ff ff       	call   801185 <sys_ipc_try_send_yield>
+  80164b:	83 c4 10             	add    $0x10,%esp
+  80164e:	85 c0                	test   %eax,%eax
+  801650:	79 1e                	jns    801670 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  801652:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801655:	75 07                	jne    80165e <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  801657:	e8 49 f7 ff ff       	call   800da5 <sys_yield>
+  80165c:	eb e2                	jmp    801640 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  80165e:	50                   	push   %eax
+  80165f:	68 ca 31 80 00       	push   $0x8031ca
+  801664:	6a 3d                	push   $0x3d
+  801666:	68 df 31 80 00       	push   $0x8031df
+  80166b:	e8 7f ec ff ff       	call   8002ef <_panic>
+	}
+}
+  801670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801673:	5b                   	pop    %ebx
+  801674:	5e                   	pop    %esi
+  801675:	5f                   	pop    %edi
+  801676:	5d                   	pop    %ebp
+  801677:	c3                   	ret
+
+00801678 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801678:	55                   	push   %ebp
+  801679:	89 e5                	mov    %esp,%ebp
+  80167b:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  80167e:	ff 75 08             	push   0x8(%ebp)
+  801681:	e8 9f f6 ff ff       	call   800d25 <sys_env_find>
+}
+  801686:	c9                   	leave
+  801687:	c3                   	ret
+
+00801688 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801688:	55                   	push   %ebp
+  801689:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80168b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80168e:	05 00 00 00 30       	add    $0x30000000,%eax
+  801693:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801696:	5d                   	pop    %ebp
+  801697:	c3                   	ret
+
+00801698 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801698:	55                   	push   %ebp
+  801699:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80169b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80169e:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8016a3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016a8:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8016ad:	5d                   	pop    %ebp
+  8016ae:	c3                   	ret
+
+008016af <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8016b2:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8016b7:	eb 02                	jmp    8016bb <fd_alloc+0xc>
+  8016b9:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8016bb:	89 c2                	mov    %eax,%edx
+  8016bd:	c1 ea 16             	shr    $0x16,%edx
+  8016c0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016c7:	f6 c2 01             	test   $0x1,%dl
+  8016ca:	74 2b                	je     8016f7 <fd_alloc+0x48>
+  8016cc:	89 c2                	mov    %eax,%edx
+  8016ce:	c1 ea 0c             	shr    $0xc,%edx
+  8016d1:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8016d8:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8016de:	f6 c1 01             	test   $0x1,%cl
+  8016e1:	74 14                	je     8016f7 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8016e3:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8016e9:	75 ce                	jne    8016b9 <fd_alloc+0xa>
+  8016eb:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8016f0:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8016f5:	eb 05                	jmp    8016fc <fd_alloc+0x4d>
+			return 0;
+  8016f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8016fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ff:	89 02                	mov    %eax,(%edx)
+}
+  801701:	89 c8                	mov    %ecx,%eax
+  801703:	5d                   	pop    %ebp
+  801704:	c3                   	ret
+
+00801705 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801705:	55                   	push   %ebp
+  801706:	89 e5                	mov    %esp,%ebp
+  801708:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80170b:	83 f8 1f             	cmp    $0x1f,%eax
+  80170e:	77 30                	ja     801740 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801710:	c1 e0 0c             	shl    $0xc,%eax
+  801713:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801718:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80171e:	f6 c2 01             	test   $0x1,%dl
+  801721:	74 24                	je     801747 <fd_lookup+0x42>
+  801723:	89 c2                	mov    %eax,%edx
+  801725:	c1 ea 0c             	shr    $0xc,%edx
+  801728:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80172f:	f6 c2 01             	test   $0x1,%dl
+  801732:	74 1a                	je     80174e <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801734:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801737:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801739:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80173e:	5d                   	pop    %ebp
+  80173f:	c3                   	ret
+		return -E_INVAL;
+  801740:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801745:	eb f7                	jmp    80173e <fd_lookup+0x39>
+		return -E_INVAL;
+  801747:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80174c:	eb f0                	jmp    80173e <fd_lookup+0x39>
+  80174e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801753:	eb e9                	jmp    80173e <fd_lookup+0x39>
+
+00801755 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	53                   	push   %ebx
+  801759:	83 ec 04             	sub    $0x4,%esp
+  80175c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80175f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801764:	eb 03                	jmp    801769 <dev_lookup+0x14>
+  801766:	83 c0 01             	add    $0x1,%eax
+  801769:	8b 1c 85 68 32 80 00 	mov    0x803268(,%eax,4),%ebx
+  801770:	85 db                	test   %ebx,%ebx
+  801772:	74 0b                	je     80177f <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801774:	39 13                	cmp    %edx,(%ebx)
+  801776:	75 ee                	jne    801766 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801778:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177d:	eb 1f                	jmp    80179e <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80177f:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801784:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801787:	83 ec 04             	sub    $0x4,%esp
+  80178a:	52                   	push   %edx
+  80178b:	50                   	push   %eax
+  80178c:	68 ec 31 80 00       	push   $0x8031ec
+  801791:	e8 34 ec ff ff       	call   8003ca <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801796:	83 c4 10             	add    $0x10,%esp
+  801799:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80179e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017a1:	89 1a                	mov    %ebx,(%edx)
+}
+  8017a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017a6:	c9                   	leave
+  8017a7:	c3                   	ret
+
+008017a8 <fd_close>:
+{
+  8017a8:	55                   	push   %ebp
+  8017a9:	89 e5                	mov    %esp,%ebp
+  8017ab:	57                   	push   %edi
+  8017ac:	56                   	push   %esi
+  8017ad:	53                   	push   %ebx
+  8017ae:	83 ec 24             	sub    $0x24,%esp
+  8017b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017b4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017b7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017ba:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017bb:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8017c1:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017c4:	50                   	push   %eax
+  8017c5:	e8 3b ff ff ff       	call   801705 <fd_lookup>
+  8017ca:	89 c3                	mov    %eax,%ebx
+  8017cc:	83 c4 10             	add    $0x10,%esp
+  8017cf:	85 c0                	test   %eax,%eax
+  8017d1:	78 05                	js     8017d8 <fd_close+0x30>
+	    || fd != fd2)
+  8017d3:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017d6:	74 16                	je     8017ee <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8017d8:	89 f8                	mov    %edi,%eax
+  8017da:	84 c0                	test   %al,%al
+  8017dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e1:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8017e4:	89 d8                	mov    %ebx,%eax
+  8017e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017e9:	5b                   	pop    %ebx
+  8017ea:	5e                   	pop    %esi
+  8017eb:	5f                   	pop    %edi
+  8017ec:	5d                   	pop    %ebp
+  8017ed:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017ee:	83 ec 08             	sub    $0x8,%esp
+  8017f1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8017f4:	50                   	push   %eax
+  8017f5:	ff 36                	push   (%esi)
+  8017f7:	e8 59 ff ff ff       	call   801755 <dev_lookup>
+  8017fc:	89 c3                	mov    %eax,%ebx
+  8017fe:	83 c4 10             	add    $0x10,%esp
+  801801:	85 c0                	test   %eax,%eax
+  801803:	78 1a                	js     80181f <fd_close+0x77>
+		if (dev->dev_close)
+  801805:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801808:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80180b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801810:	85 c0                	test   %eax,%eax
+  801812:	74 0b                	je     80181f <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801814:	83 ec 0c             	sub    $0xc,%esp
+  801817:	56                   	push   %esi
+  801818:	ff d0                	call   *%eax
+  80181a:	89 c3                	mov    %eax,%ebx
+  80181c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80181f:	83 ec 08             	sub    $0x8,%esp
+  801822:	56                   	push   %esi
+  801823:	6a 00                	push   $0x0
+  801825:	e8 c3 f6 ff ff       	call   800eed <sys_page_unmap>
+	return r;
+  80182a:	83 c4 10             	add    $0x10,%esp
+  80182d:	eb b5                	jmp    8017e4 <fd_close+0x3c>
+
+0080182f <close>:
+
+int
+close(int fdnum)
+{
+  80182f:	55                   	push   %ebp
+  801830:	89 e5                	mov    %esp,%ebp
+  801832:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801835:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801838:	50                   	push   %eax
+  801839:	ff 75 08             	push   0x8(%ebp)
+  80183c:	e8 c4 fe ff ff       	call   801705 <fd_lookup>
+  801841:	83 c4 10             	add    $0x10,%esp
+  801844:	85 c0                	test   %eax,%eax
+  801846:	79 02                	jns    80184a <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801848:	c9                   	leave
+  801849:	c3                   	ret
+		return fd_close(fd, 1);
+  80184a:	83 ec 08             	sub    $0x8,%esp
+  80184d:	6a 01                	push   $0x1
+  80184f:	ff 75 f4             	push   -0xc(%ebp)
+  801852:	e8 51 ff ff ff       	call   8017a8 <fd_close>
+  801857:	83 c4 10             	add    $0x10,%esp
+  80185a:	eb ec                	jmp    801848 <close+0x19>
+
+0080185c <close_all>:
+
+void
+close_all(void)
+{
+  80185c:	55                   	push   %ebp
+  80185d:	89 e5                	mov    %esp,%ebp
+  80185f:	53                   	push   %ebx
+  801860:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801863:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801868:	83 ec 0c             	sub    $0xc,%esp
+  80186b:	53                   	push   %ebx
+  80186c:	e8 be ff ff ff       	call   80182f <close>
+	for (i = 0; i < MAXFD; i++)
+  801871:	83 c3 01             	add    $0x1,%ebx
+  801874:	83 c4 10             	add    $0x10,%esp
+  801877:	83 fb 20             	cmp    $0x20,%ebx
+  80187a:	75 ec                	jne    801868 <close_all+0xc>
+}
+  80187c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80187f:	c9                   	leave
+  801880:	c3                   	ret
+
+00801881 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801881:	55                   	push   %ebp
+  801882:	89 e5                	mov    %esp,%ebp
+  801884:	57                   	push   %edi
+  801885:	56                   	push   %esi
+  801886:	53                   	push   %ebx
+  801887:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80188a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80188d:	50                   	push   %eax
+  80188e:	ff 75 08             	push   0x8(%ebp)
+  801891:	e8 6f fe ff ff       	call   801705 <fd_lookup>
+  801896:	89 c3                	mov    %eax,%ebx
+  801898:	83 c4 10             	add    $0x10,%esp
+  80189b:	85 c0                	test   %eax,%eax
+  80189d:	78 7f                	js     80191e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80189f:	83 ec 0c             	sub    $0xc,%esp
+  8018a2:	ff 75 0c             	push   0xc(%ebp)
+  8018a5:	e8 85 ff ff ff       	call   80182f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8018aa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8018ad:	c1 e6 0c             	shl    $0xc,%esi
+  8018b0:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8018b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8018b9:	89 3c 24             	mov    %edi,(%esp)
+  8018bc:	e8 d7 fd ff ff       	call   801698 <fd2data>
+  8018c1:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8018c3:	89 34 24             	mov    %esi,(%esp)
+  8018c6:	e8 cd fd ff ff       	call   801698 <fd2data>
+  8018cb:	83 c4 10             	add    $0x10,%esp
+  8018ce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8018d1:	89 d8                	mov    %ebx,%eax
+  8018d3:	c1 e8 16             	shr    $0x16,%eax
+  8018d6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018dd:	a8 01                	test   $0x1,%al
+  8018df:	74 11                	je     8018f2 <dup+0x71>
+  8018e1:	89 d8                	mov    %ebx,%eax
+  8018e3:	c1 e8 0c             	shr    $0xc,%eax
+  8018e6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018ed:	f6 c2 01             	test   $0x1,%dl
+  8018f0:	75 36                	jne    801928 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8018f2:	89 f8                	mov    %edi,%eax
+  8018f4:	c1 e8 0c             	shr    $0xc,%eax
+  8018f7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018fe:	83 ec 0c             	sub    $0xc,%esp
+  801901:	25 07 0e 00 00       	and    $0xe07,%eax
+  801906:	50                   	push   %eax
+  801907:	56                   	push   %esi
+  801908:	6a 00                	push   $0x0
+  80190a:	57                   	push   %edi
+  80190b:	6a 00                	push   $0x0
+  80190d:	e8 99 f5 ff ff       	call   800eab <sys_page_map>
+  801912:	89 c3                	mov    %eax,%ebx
+  801914:	83 c4 20             	add    $0x20,%esp
+  801917:	85 c0                	test   %eax,%eax
+  801919:	78 33                	js     80194e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80191b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80191e:	89 d8                	mov    %ebx,%eax
+  801920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801923:	5b                   	pop    %ebx
+  801924:	5e                   	pop    %esi
+  801925:	5f                   	pop    %edi
+  801926:	5d                   	pop    %ebp
+  801927:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801928:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80192f:	83 ec 0c             	sub    $0xc,%esp
+  801932:	25 07 0e 00 00       	and    $0xe07,%eax
+  801937:	50                   	push   %eax
+  801938:	ff 75 d4             	push   -0x2c(%ebp)
+  80193b:	6a 00                	push   $0x0
+  80193d:	53                   	push   %ebx
+  80193e:	6a 00                	push   $0x0
+  801940:	e8 66 f5 ff ff       	call   800eab <sys_page_map>
+  801945:	89 c3                	mov    %eax,%ebx
+  801947:	83 c4 20             	add    $0x20,%esp
+  80194a:	85 c0                	test   %eax,%eax
+  80194c:	79 a4                	jns    8018f2 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80194e:	83 ec 08             	sub    $0x8,%esp
+  801951:	56                   	push   %esi
+  801952:	6a 00                	push   $0x0
+  801954:	e8 94 f5 ff ff       	call   800eed <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801959:	83 c4 08             	add    $0x8,%esp
+  80195c:	ff 75 d4             	push   -0x2c(%ebp)
+  80195f:	6a 00                	push   $0x0
+  801961:	e8 87 f5 ff ff       	call   800eed <sys_page_unmap>
+	return r;
+  801966:	83 c4 10             	add    $0x10,%esp
+  801969:	eb b3                	jmp    80191e <dup+0x9d>
+
+0080196b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80196b:	55                   	push   %ebp
+  80196c:	89 e5                	mov    %esp,%ebp
+  80196e:	56                   	push   %esi
+  80196f:	53                   	push   %ebx
+  801970:	83 ec 18             	sub    $0x18,%esp
+  801973:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801976:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801979:	50                   	push   %eax
+  80197a:	56                   	push   %esi
+  80197b:	e8 85 fd ff ff       	call   801705 <fd_lookup>
+  801980:	83 c4 10             	add    $0x10,%esp
+  801983:	85 c0                	test   %eax,%eax
+  801985:	78 3c                	js     8019c3 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801987:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80198a:	83 ec 08             	sub    $0x8,%esp
+  80198d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801990:	50                   	push   %eax
+  801991:	ff 33                	push   (%ebx)
+  801993:	e8 bd fd ff ff       	call   801755 <dev_lookup>
+  801998:	83 c4 10             	add    $0x10,%esp
+  80199b:	85 c0                	test   %eax,%eax
+  80199d:	78 24                	js     8019c3 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80199f:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019a2:	83 e0 03             	and    $0x3,%eax
+  8019a5:	83 f8 01             	cmp    $0x1,%eax
+  8019a8:	74 20                	je     8019ca <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8019aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019ad:	8b 40 08             	mov    0x8(%eax),%eax
+  8019b0:	85 c0                	test   %eax,%eax
+  8019b2:	74 37                	je     8019eb <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8019b4:	83 ec 04             	sub    $0x4,%esp
+  8019b7:	ff 75 10             	push   0x10(%ebp)
+  8019ba:	ff 75 0c             	push   0xc(%ebp)
+  8019bd:	53                   	push   %ebx
+  8019be:	ff d0                	call   *%eax
+  8019c0:	83 c4 10             	add    $0x10,%esp
+}
+  8019c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019c6:	5b                   	pop    %ebx
+  8019c7:	5e                   	pop    %esi
+  8019c8:	5d                   	pop    %ebp
+  8019c9:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019ca:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8019cf:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8019d2:	83 ec 04             	sub    $0x4,%esp
+  8019d5:	56                   	push   %esi
+  8019d6:	50                   	push   %eax
+  8019d7:	68 2d 32 80 00       	push   $0x80322d
+  8019dc:	e8 e9 e9 ff ff       	call   8003ca <cprintf>
+		return -E_INVAL;
+  8019e1:	83 c4 10             	add    $0x10,%esp
+  8019e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019e9:	eb d8                	jmp    8019c3 <read+0x58>
+		return -E_NOT_SUPP;
+  8019eb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019f0:	eb d1                	jmp    8019c3 <read+0x58>
+
+008019f2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8019f2:	55                   	push   %ebp
+  8019f3:	89 e5                	mov    %esp,%ebp
+  8019f5:	57                   	push   %edi
+  8019f6:	56                   	push   %esi
+  8019f7:	53                   	push   %ebx
+  8019f8:	83 ec 0c             	sub    $0xc,%esp
+  8019fb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019fe:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801a01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a06:	eb 02                	jmp    801a0a <readn+0x18>
+  801a08:	01 c3                	add    %eax,%ebx
+  801a0a:	39 f3                	cmp    %esi,%ebx
+  801a0c:	73 21                	jae    801a2f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a0e:	83 ec 04             	sub    $0x4,%esp
+  801a11:	89 f0                	mov    %esi,%eax
+  801a13:	29 d8                	sub    %ebx,%eax
+  801a15:	50                   	push   %eax
+  801a16:	89 d8                	mov    %ebx,%eax
+  801a18:	03 45 0c             	add    0xc(%ebp),%eax
+  801a1b:	50                   	push   %eax
+  801a1c:	57                   	push   %edi
+  801a1d:	e8 49 ff ff ff       	call   80196b <read>
+		if (m < 0)
+  801a22:	83 c4 10             	add    $0x10,%esp
+  801a25:	85 c0                	test   %eax,%eax
+  801a27:	78 04                	js     801a2d <readn+0x3b>
+			return m;
+		if (m == 0)
+  801a29:	75 dd                	jne    801a08 <readn+0x16>
+  801a2b:	eb 02                	jmp    801a2f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a2d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801a2f:	89 d8                	mov    %ebx,%eax
+  801a31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a34:	5b                   	pop    %ebx
+  801a35:	5e                   	pop    %esi
+  801a36:	5f                   	pop    %edi
+  801a37:	5d                   	pop    %ebp
+  801a38:	c3                   	ret
+
+00801a39 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a39:	55                   	push   %ebp
+  801a3a:	89 e5                	mov    %esp,%ebp
+  801a3c:	56                   	push   %esi
+  801a3d:	53                   	push   %ebx
+  801a3e:	83 ec 18             	sub    $0x18,%esp
+  801a41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a44:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a47:	50                   	push   %eax
+  801a48:	53                   	push   %ebx
+  801a49:	e8 b7 fc ff ff       	call   801705 <fd_lookup>
+  801a4e:	83 c4 10             	add    $0x10,%esp
+  801a51:	85 c0                	test   %eax,%eax
+  801a53:	78 37                	js     801a8c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a55:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a58:	83 ec 08             	sub    $0x8,%esp
+  801a5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5e:	50                   	push   %eax
+  801a5f:	ff 36                	push   (%esi)
+  801a61:	e8 ef fc ff ff       	call   801755 <dev_lookup>
+  801a66:	83 c4 10             	add    $0x10,%esp
+  801a69:	85 c0                	test   %eax,%eax
+  801a6b:	78 1f                	js     801a8c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a6d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a71:	74 20                	je     801a93 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801a73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a76:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a79:	85 c0                	test   %eax,%eax
+  801a7b:	74 37                	je     801ab4 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801a7d:	83 ec 04             	sub    $0x4,%esp
+  801a80:	ff 75 10             	push   0x10(%ebp)
+  801a83:	ff 75 0c             	push   0xc(%ebp)
+  801a86:	56                   	push   %esi
+  801a87:	ff d0                	call   *%eax
+  801a89:	83 c4 10             	add    $0x10,%esp
+}
+  801a8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a8f:	5b                   	pop    %ebx
+  801a90:	5e                   	pop    %esi
+  801a91:	5d                   	pop    %ebp
+  801a92:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a93:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801a98:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801a9b:	83 ec 04             	sub    $0x4,%esp
+  801a9e:	53                   	push   %ebx
+  801a9f:	50                   	push   %eax
+  801aa0:	68 49 32 80 00       	push   $0x803249
+  801aa5:	e8 20 e9 ff ff       	call   8003ca <cprintf>
+		return -E_INVAL;
+  801aaa:	83 c4 10             	add    $0x10,%esp
+  801aad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ab2:	eb d8                	jmp    801a8c <write+0x53>
+		return -E_NOT_SUPP;
+  801ab4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ab9:	eb d1                	jmp    801a8c <write+0x53>
+
+00801abb <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801abb:	55                   	push   %ebp
+  801abc:	89 e5                	mov    %esp,%ebp
+  801abe:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ac1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac4:	50                   	push   %eax
+  801ac5:	ff 75 08             	push   0x8(%ebp)
+  801ac8:	e8 38 fc ff ff       	call   801705 <fd_lookup>
+  801acd:	83 c4 10             	add    $0x10,%esp
+  801ad0:	85 c0                	test   %eax,%eax
+  801ad2:	78 0e                	js     801ae2 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801ad4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ad7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ada:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801add:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ae2:	c9                   	leave
+  801ae3:	c3                   	ret
+
+00801ae4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ae4:	55                   	push   %ebp
+  801ae5:	89 e5                	mov    %esp,%ebp
+  801ae7:	56                   	push   %esi
+  801ae8:	53                   	push   %ebx
+  801ae9:	83 ec 18             	sub    $0x18,%esp
+  801aec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801aef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801af2:	50                   	push   %eax
+  801af3:	53                   	push   %ebx
+  801af4:	e8 0c fc ff ff       	call   801705 <fd_lookup>
+  801af9:	83 c4 10             	add    $0x10,%esp
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	78 34                	js     801b34 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b00:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b03:	83 ec 08             	sub    $0x8,%esp
+  801b06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b09:	50                   	push   %eax
+  801b0a:	ff 36                	push   (%esi)
+  801b0c:	e8 44 fc ff ff       	call   801755 <dev_lookup>
+  801b11:	83 c4 10             	add    $0x10,%esp
+  801b14:	85 c0                	test   %eax,%eax
+  801b16:	78 1c                	js     801b34 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b18:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b1c:	74 1d                	je     801b3b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801b1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b21:	8b 40 18             	mov    0x18(%eax),%eax
+  801b24:	85 c0                	test   %eax,%eax
+  801b26:	74 34                	je     801b5c <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801b28:	83 ec 08             	sub    $0x8,%esp
+  801b2b:	ff 75 0c             	push   0xc(%ebp)
+  801b2e:	56                   	push   %esi
+  801b2f:	ff d0                	call   *%eax
+  801b31:	83 c4 10             	add    $0x10,%esp
+}
+  801b34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b37:	5b                   	pop    %ebx
+  801b38:	5e                   	pop    %esi
+  801b39:	5d                   	pop    %ebp
+  801b3a:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801b3b:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801b40:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b43:	83 ec 04             	sub    $0x4,%esp
+  801b46:	53                   	push   %ebx
+  801b47:	50                   	push   %eax
+  801b48:	68 0c 32 80 00       	push   $0x80320c
+  801b4d:	e8 78 e8 ff ff       	call   8003ca <cprintf>
+		return -E_INVAL;
+  801b52:	83 c4 10             	add    $0x10,%esp
+  801b55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b5a:	eb d8                	jmp    801b34 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801b5c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b61:	eb d1                	jmp    801b34 <ftruncate+0x50>
+
+00801b63 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b63:	55                   	push   %ebp
+  801b64:	89 e5                	mov    %esp,%ebp
+  801b66:	56                   	push   %esi
+  801b67:	53                   	push   %ebx
+  801b68:	83 ec 18             	sub    $0x18,%esp
+  801b6b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b6e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b71:	50                   	push   %eax
+  801b72:	ff 75 08             	push   0x8(%ebp)
+  801b75:	e8 8b fb ff ff       	call   801705 <fd_lookup>
+  801b7a:	83 c4 10             	add    $0x10,%esp
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	78 49                	js     801bca <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b81:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b84:	83 ec 08             	sub    $0x8,%esp
+  801b87:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b8a:	50                   	push   %eax
+  801b8b:	ff 36                	push   (%esi)
+  801b8d:	e8 c3 fb ff ff       	call   801755 <dev_lookup>
+  801b92:	83 c4 10             	add    $0x10,%esp
+  801b95:	85 c0                	test   %eax,%eax
+  801b97:	78 31                	js     801bca <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801b99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b9c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ba0:	74 2f                	je     801bd1 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801ba2:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801ba5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801bac:	00 00 00 
+	stat->st_isdir = 0;
+  801baf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801bb6:	00 00 00 
+	stat->st_dev = dev;
+  801bb9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801bbf:	83 ec 08             	sub    $0x8,%esp
+  801bc2:	53                   	push   %ebx
+  801bc3:	56                   	push   %esi
+  801bc4:	ff 50 14             	call   *0x14(%eax)
+  801bc7:	83 c4 10             	add    $0x10,%esp
+}
+  801bca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bcd:	5b                   	pop    %ebx
+  801bce:	5e                   	pop    %esi
+  801bcf:	5d                   	pop    %ebp
+  801bd0:	c3                   	ret
+		return -E_NOT_SUPP;
+  801bd1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bd6:	eb f2                	jmp    801bca <fstat+0x67>
+
+00801bd8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801bd8:	55                   	push   %ebp
+  801bd9:	89 e5                	mov    %esp,%ebp
+  801bdb:	56                   	push   %esi
+  801bdc:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801bdd:	83 ec 08             	sub    $0x8,%esp
+  801be0:	6a 00                	push   $0x0
+  801be2:	ff 75 08             	push   0x8(%ebp)
+  801be5:	e8 e4 01 00 00       	call   801dce <open>
+  801bea:	89 c3                	mov    %eax,%ebx
+  801bec:	83 c4 10             	add    $0x10,%esp
+  801bef:	85 c0                	test   %eax,%eax
+  801bf1:	78 1b                	js     801c0e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801bf3:	83 ec 08             	sub    $0x8,%esp
+  801bf6:	ff 75 0c             	push   0xc(%ebp)
+  801bf9:	50                   	push   %eax
+  801bfa:	e8 64 ff ff ff       	call   801b63 <fstat>
+  801bff:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801c01:	89 1c 24             	mov    %ebx,(%esp)
+  801c04:	e8 26 fc ff ff       	call   80182f <close>
+	return r;
+  801c09:	83 c4 10             	add    $0x10,%esp
+  801c0c:	89 f3                	mov    %esi,%ebx
+}
+  801c0e:	89 d8                	mov    %ebx,%eax
+  801c10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c13:	5b                   	pop    %ebx
+  801c14:	5e                   	pop    %esi
+  801c15:	5d                   	pop    %ebp
+  801c16:	c3                   	ret
+
+00801c17 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801c17:	55                   	push   %ebp
+  801c18:	89 e5                	mov    %esp,%ebp
+  801c1a:	56                   	push   %esi
+  801c1b:	53                   	push   %ebx
+  801c1c:	89 c6                	mov    %eax,%esi
+  801c1e:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801c20:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801c27:	74 27                	je     801c50 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c29:	6a 07                	push   $0x7
+  801c2b:	68 00 60 80 00       	push   $0x806000
+  801c30:	56                   	push   %esi
+  801c31:	ff 35 04 50 80 00    	push   0x805004
+  801c37:	e8 e8 f9 ff ff       	call   801624 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801c3c:	83 c4 0c             	add    $0xc,%esp
+  801c3f:	6a 00                	push   $0x0
+  801c41:	53                   	push   %ebx
+  801c42:	6a 00                	push   $0x0
+  801c44:	e8 63 f9 ff ff       	call   8015ac <ipc_recv>
+}
+  801c49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c4c:	5b                   	pop    %ebx
+  801c4d:	5e                   	pop    %esi
+  801c4e:	5d                   	pop    %ebp
+  801c4f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c50:	83 ec 0c             	sub    $0xc,%esp
+  801c53:	6a 01                	push   $0x1
+  801c55:	e8 1e fa ff ff       	call   801678 <ipc_find_env>
+  801c5a:	a3 04 50 80 00       	mov    %eax,0x805004
+  801c5f:	83 c4 10             	add    $0x10,%esp
+  801c62:	eb c5                	jmp    801c29 <fsipc+0x12>
+
+00801c64 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801c64:	55                   	push   %ebp
+  801c65:	89 e5                	mov    %esp,%ebp
+  801c67:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c6d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c70:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801c75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c78:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c82:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c87:	e8 8b ff ff ff       	call   801c17 <fsipc>
+}
+  801c8c:	c9                   	leave
+  801c8d:	c3                   	ret
+
+00801c8e <devfile_flush>:
+{
+  801c8e:	55                   	push   %ebp
+  801c8f:	89 e5                	mov    %esp,%ebp
+  801c91:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801c94:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c97:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c9a:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801c9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca4:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ca9:	e8 69 ff ff ff       	call   801c17 <fsipc>
+}
+  801cae:	c9                   	leave
+  801caf:	c3                   	ret
+
+00801cb0 <devfile_stat>:
+{
+  801cb0:	55                   	push   %ebp
+  801cb1:	89 e5                	mov    %esp,%ebp
+  801cb3:	53                   	push   %ebx
+  801cb4:	83 ec 04             	sub    $0x4,%esp
+  801cb7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801cba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cc0:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801cc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cca:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ccf:	e8 43 ff ff ff       	call   801c17 <fsipc>
+  801cd4:	85 c0                	test   %eax,%eax
+  801cd6:	78 2c                	js     801d04 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801cd8:	83 ec 08             	sub    $0x8,%esp
+  801cdb:	68 00 60 80 00       	push   $0x806000
+  801ce0:	53                   	push   %ebx
+  801ce1:	e8 d2 ec ff ff       	call   8009b8 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801ce6:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ceb:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801cf1:	a1 84 60 80 00       	mov    0x806084,%eax
+  801cf6:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801cfc:	83 c4 10             	add    $0x10,%esp
+  801cff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d07:	c9                   	leave
+  801d08:	c3                   	ret
+
+00801d09 <devfile_write>:
+{
+  801d09:	55                   	push   %ebp
+  801d0a:	89 e5                	mov    %esp,%ebp
+  801d0c:	83 ec 0c             	sub    $0xc,%esp
+  801d0f:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801d12:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801d17:	39 d0                	cmp    %edx,%eax
+  801d19:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d1f:	8b 52 0c             	mov    0xc(%edx),%edx
+  801d22:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801d28:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801d2d:	50                   	push   %eax
+  801d2e:	ff 75 0c             	push   0xc(%ebp)
+  801d31:	68 08 60 80 00       	push   $0x806008
+  801d36:	e8 03 ee ff ff       	call   800b3e <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801d3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d40:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d45:	e8 cd fe ff ff       	call   801c17 <fsipc>
+}
+  801d4a:	c9                   	leave
+  801d4b:	c3                   	ret
+
+00801d4c <devfile_read>:
+{
+  801d4c:	55                   	push   %ebp
+  801d4d:	89 e5                	mov    %esp,%ebp
+  801d4f:	56                   	push   %esi
+  801d50:	53                   	push   %ebx
+  801d51:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801d54:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d57:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d5a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801d5f:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801d65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d6f:	e8 a3 fe ff ff       	call   801c17 <fsipc>
+  801d74:	89 c3                	mov    %eax,%ebx
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	78 1f                	js     801d99 <devfile_read+0x4d>
+	assert(r <= n);
+  801d7a:	39 c6                	cmp    %eax,%esi
+  801d7c:	72 24                	jb     801da2 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801d7e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801d83:	7f 33                	jg     801db8 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801d85:	83 ec 04             	sub    $0x4,%esp
+  801d88:	50                   	push   %eax
+  801d89:	68 00 60 80 00       	push   $0x806000
+  801d8e:	ff 75 0c             	push   0xc(%ebp)
+  801d91:	e8 a8 ed ff ff       	call   800b3e <memmove>
+	return r;
+  801d96:	83 c4 10             	add    $0x10,%esp
+}
+  801d99:	89 d8                	mov    %ebx,%eax
+  801d9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d9e:	5b                   	pop    %ebx
+  801d9f:	5e                   	pop    %esi
+  801da0:	5d                   	pop    %ebp
+  801da1:	c3                   	ret
+	assert(r <= n);
+  801da2:	68 7c 32 80 00       	push   $0x80327c
+  801da7:	68 83 32 80 00       	push   $0x803283
+  801dac:	6a 7c                	push   $0x7c
+  801dae:	68 98 32 80 00       	push   $0x803298
+  801db3:	e8 37 e5 ff ff       	call   8002ef <_panic>
+	assert(r <= PGSIZE);
+  801db8:	68 a3 32 80 00       	push   $0x8032a3
+  801dbd:	68 83 32 80 00       	push   $0x803283
+  801dc2:	6a 7d                	push   $0x7d
+  801dc4:	68 98 32 80 00       	push   $0x803298
+  801dc9:	e8 21 e5 ff ff       	call   8002ef <_panic>
+
+00801dce <open>:
+{
+  801dce:	55                   	push   %ebp
+  801dcf:	89 e5                	mov    %esp,%ebp
+  801dd1:	56                   	push   %esi
+  801dd2:	53                   	push   %ebx
+  801dd3:	83 ec 1c             	sub    $0x1c,%esp
+  801dd6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801dd9:	56                   	push   %esi
+  801dda:	e8 9e eb ff ff       	call   80097d <strlen>
+  801ddf:	83 c4 10             	add    $0x10,%esp
+  801de2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801de7:	7f 6c                	jg     801e55 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801de9:	83 ec 0c             	sub    $0xc,%esp
+  801dec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801def:	50                   	push   %eax
+  801df0:	e8 ba f8 ff ff       	call   8016af <fd_alloc>
+  801df5:	89 c3                	mov    %eax,%ebx
+  801df7:	83 c4 10             	add    $0x10,%esp
+  801dfa:	85 c0                	test   %eax,%eax
+  801dfc:	78 3c                	js     801e3a <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801dfe:	83 ec 08             	sub    $0x8,%esp
+  801e01:	56                   	push   %esi
+  801e02:	68 00 60 80 00       	push   $0x806000
+  801e07:	e8 ac eb ff ff       	call   8009b8 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e0f:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e14:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e17:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e1c:	e8 f6 fd ff ff       	call   801c17 <fsipc>
+  801e21:	89 c3                	mov    %eax,%ebx
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 19                	js     801e43 <open+0x75>
+	return fd2num(fd);
+  801e2a:	83 ec 0c             	sub    $0xc,%esp
+  801e2d:	ff 75 f4             	push   -0xc(%ebp)
+  801e30:	e8 53 f8 ff ff       	call   801688 <fd2num>
+  801e35:	89 c3                	mov    %eax,%ebx
+  801e37:	83 c4 10             	add    $0x10,%esp
+}
+  801e3a:	89 d8                	mov    %ebx,%eax
+  801e3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e3f:	5b                   	pop    %ebx
+  801e40:	5e                   	pop    %esi
+  801e41:	5d                   	pop    %ebp
+  801e42:	c3                   	ret
+		fd_close(fd, 0);
+  801e43:	83 ec 08             	sub    $0x8,%esp
+  801e46:	6a 00                	push   $0x0
+  801e48:	ff 75 f4             	push   -0xc(%ebp)
+  801e4b:	e8 58 f9 ff ff       	call   8017a8 <fd_close>
+		return r;
+  801e50:	83 c4 10             	add    $0x10,%esp
+  801e53:	eb e5                	jmp    801e3a <open+0x6c>
+		return -E_BAD_PATH;
+  801e55:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e5a:	eb de                	jmp    801e3a <open+0x6c>
+
+00801e5c <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801e62:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e67:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e6c:	e8 a6 fd ff ff       	call   801c17 <fsipc>
+}
+  801e71:	c9                   	leave
+  801e72:	c3                   	ret
+
+00801e73 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e73:	55                   	push   %ebp
+  801e74:	89 e5                	mov    %esp,%ebp
+  801e76:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801e79:	68 af 32 80 00       	push   $0x8032af
+  801e7e:	ff 75 0c             	push   0xc(%ebp)
+  801e81:	e8 32 eb ff ff       	call   8009b8 <strcpy>
+	return 0;
+}
+  801e86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8b:	c9                   	leave
+  801e8c:	c3                   	ret
+
+00801e8d <devsock_close>:
+{
+  801e8d:	55                   	push   %ebp
+  801e8e:	89 e5                	mov    %esp,%ebp
+  801e90:	53                   	push   %ebx
+  801e91:	83 ec 10             	sub    $0x10,%esp
+  801e94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801e97:	53                   	push   %ebx
+  801e98:	e8 8d 09 00 00       	call   80282a <pageref>
+  801e9d:	89 c2                	mov    %eax,%edx
+  801e9f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801ea7:	83 fa 01             	cmp    $0x1,%edx
+  801eaa:	74 05                	je     801eb1 <devsock_close+0x24>
+}
+  801eac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eaf:	c9                   	leave
+  801eb0:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801eb1:	83 ec 0c             	sub    $0xc,%esp
+  801eb4:	ff 73 0c             	push   0xc(%ebx)
+  801eb7:	e8 b7 02 00 00       	call   802173 <nsipc_close>
+  801ebc:	83 c4 10             	add    $0x10,%esp
+  801ebf:	eb eb                	jmp    801eac <devsock_close+0x1f>
+
+00801ec1 <devsock_write>:
+{
+  801ec1:	55                   	push   %ebp
+  801ec2:	89 e5                	mov    %esp,%ebp
+  801ec4:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801ec7:	6a 00                	push   $0x0
+  801ec9:	ff 75 10             	push   0x10(%ebp)
+  801ecc:	ff 75 0c             	push   0xc(%ebp)
+  801ecf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed2:	ff 70 0c             	push   0xc(%eax)
+  801ed5:	e8 79 03 00 00       	call   802253 <nsipc_send>
+}
+  801eda:	c9                   	leave
+  801edb:	c3                   	ret
+
+00801edc <devsock_read>:
+{
+  801edc:	55                   	push   %ebp
+  801edd:	89 e5                	mov    %esp,%ebp
+  801edf:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801ee2:	6a 00                	push   $0x0
+  801ee4:	ff 75 10             	push   0x10(%ebp)
+  801ee7:	ff 75 0c             	push   0xc(%ebp)
+  801eea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eed:	ff 70 0c             	push   0xc(%eax)
+  801ef0:	e8 ef 02 00 00       	call   8021e4 <nsipc_recv>
+}
+  801ef5:	c9                   	leave
+  801ef6:	c3                   	ret
+
+00801ef7 <fd2sockid>:
+{
+  801ef7:	55                   	push   %ebp
+  801ef8:	89 e5                	mov    %esp,%ebp
+  801efa:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801efd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801f00:	52                   	push   %edx
+  801f01:	50                   	push   %eax
+  801f02:	e8 fe f7 ff ff       	call   801705 <fd_lookup>
+  801f07:	83 c4 10             	add    $0x10,%esp
+  801f0a:	85 c0                	test   %eax,%eax
+  801f0c:	78 10                	js     801f1e <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801f0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f11:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801f17:	39 08                	cmp    %ecx,(%eax)
+  801f19:	75 05                	jne    801f20 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801f1b:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801f1e:	c9                   	leave
+  801f1f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f20:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f25:	eb f7                	jmp    801f1e <fd2sockid+0x27>
+
+00801f27 <alloc_sockfd>:
+{
+  801f27:	55                   	push   %ebp
+  801f28:	89 e5                	mov    %esp,%ebp
+  801f2a:	56                   	push   %esi
+  801f2b:	53                   	push   %ebx
+  801f2c:	83 ec 1c             	sub    $0x1c,%esp
+  801f2f:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801f31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f34:	50                   	push   %eax
+  801f35:	e8 75 f7 ff ff       	call   8016af <fd_alloc>
+  801f3a:	89 c3                	mov    %eax,%ebx
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	78 43                	js     801f86 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801f43:	83 ec 04             	sub    $0x4,%esp
+  801f46:	68 07 04 00 00       	push   $0x407
+  801f4b:	ff 75 f4             	push   -0xc(%ebp)
+  801f4e:	6a 00                	push   $0x0
+  801f50:	e8 d0 ee ff ff       	call   800e25 <sys_page_alloc>
+  801f55:	89 c3                	mov    %eax,%ebx
+  801f57:	83 c4 10             	add    $0x10,%esp
+  801f5a:	85 c0                	test   %eax,%eax
+  801f5c:	78 28                	js     801f86 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801f5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f61:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801f67:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801f69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f6c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801f73:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801f76:	83 ec 0c             	sub    $0xc,%esp
+  801f79:	50                   	push   %eax
+  801f7a:	e8 09 f7 ff ff       	call   801688 <fd2num>
+  801f7f:	89 c3                	mov    %eax,%ebx
+  801f81:	83 c4 10             	add    $0x10,%esp
+  801f84:	eb 0c                	jmp    801f92 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801f86:	83 ec 0c             	sub    $0xc,%esp
+  801f89:	56                   	push   %esi
+  801f8a:	e8 e4 01 00 00       	call   802173 <nsipc_close>
+		return r;
+  801f8f:	83 c4 10             	add    $0x10,%esp
+}
+  801f92:	89 d8                	mov    %ebx,%eax
+  801f94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f97:	5b                   	pop    %ebx
+  801f98:	5e                   	pop    %esi
+  801f99:	5d                   	pop    %ebp
+  801f9a:	c3                   	ret
+
+00801f9b <accept>:
+{
+  801f9b:	55                   	push   %ebp
+  801f9c:	89 e5                	mov    %esp,%ebp
+  801f9e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa4:	e8 4e ff ff ff       	call   801ef7 <fd2sockid>
+  801fa9:	85 c0                	test   %eax,%eax
+  801fab:	78 1b                	js     801fc8 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801fad:	83 ec 04             	sub    $0x4,%esp
+  801fb0:	ff 75 10             	push   0x10(%ebp)
+  801fb3:	ff 75 0c             	push   0xc(%ebp)
+  801fb6:	50                   	push   %eax
+  801fb7:	e8 0e 01 00 00       	call   8020ca <nsipc_accept>
+  801fbc:	83 c4 10             	add    $0x10,%esp
+  801fbf:	85 c0                	test   %eax,%eax
+  801fc1:	78 05                	js     801fc8 <accept+0x2d>
+	return alloc_sockfd(r);
+  801fc3:	e8 5f ff ff ff       	call   801f27 <alloc_sockfd>
+}
+  801fc8:	c9                   	leave
+  801fc9:	c3                   	ret
+
+00801fca <bind>:
+{
+  801fca:	55                   	push   %ebp
+  801fcb:	89 e5                	mov    %esp,%ebp
+  801fcd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd3:	e8 1f ff ff ff       	call   801ef7 <fd2sockid>
+  801fd8:	85 c0                	test   %eax,%eax
+  801fda:	78 12                	js     801fee <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801fdc:	83 ec 04             	sub    $0x4,%esp
+  801fdf:	ff 75 10             	push   0x10(%ebp)
+  801fe2:	ff 75 0c             	push   0xc(%ebp)
+  801fe5:	50                   	push   %eax
+  801fe6:	e8 31 01 00 00       	call   80211c <nsipc_bind>
+  801feb:	83 c4 10             	add    $0x10,%esp
+}
+  801fee:	c9                   	leave
+  801fef:	c3                   	ret
+
+00801ff0 <shutdown>:
+{
+  801ff0:	55                   	push   %ebp
+  801ff1:	89 e5                	mov    %esp,%ebp
+  801ff3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ff6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff9:	e8 f9 fe ff ff       	call   801ef7 <fd2sockid>
+  801ffe:	85 c0                	test   %eax,%eax
+  802000:	78 0f                	js     802011 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802002:	83 ec 08             	sub    $0x8,%esp
+  802005:	ff 75 0c             	push   0xc(%ebp)
+  802008:	50                   	push   %eax
+  802009:	e8 43 01 00 00       	call   802151 <nsipc_shutdown>
+  80200e:	83 c4 10             	add    $0x10,%esp
+}
+  802011:	c9                   	leave
+  802012:	c3                   	ret
+
+00802013 <connect>:
+{
+  802013:	55                   	push   %ebp
+  802014:	89 e5                	mov    %esp,%ebp
+  802016:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802019:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201c:	e8 d6 fe ff ff       	call   801ef7 <fd2sockid>
+  802021:	85 c0                	test   %eax,%eax
+  802023:	78 12                	js     802037 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802025:	83 ec 04             	sub    $0x4,%esp
+  802028:	ff 75 10             	push   0x10(%ebp)
+  80202b:	ff 75 0c             	push   0xc(%ebp)
+  80202e:	50                   	push   %eax
+  80202f:	e8 59 01 00 00       	call   80218d <nsipc_connect>
+  802034:	83 c4 10             	add    $0x10,%esp
+}
+  802037:	c9                   	leave
+  802038:	c3                   	ret
+
+00802039 <listen>:
+{
+  802039:	55                   	push   %ebp
+  80203a:	89 e5                	mov    %esp,%ebp
+  80203c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80203f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802042:	e8 b0 fe ff ff       	call   801ef7 <fd2sockid>
+  802047:	85 c0                	test   %eax,%eax
+  802049:	78 0f                	js     80205a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80204b:	83 ec 08             	sub    $0x8,%esp
+  80204e:	ff 75 0c             	push   0xc(%ebp)
+  802051:	50                   	push   %eax
+  802052:	e8 6b 01 00 00       	call   8021c2 <nsipc_listen>
+  802057:	83 c4 10             	add    $0x10,%esp
+}
+  80205a:	c9                   	leave
+  80205b:	c3                   	ret
+
+0080205c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80205c:	55                   	push   %ebp
+  80205d:	89 e5                	mov    %esp,%ebp
+  80205f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802062:	ff 75 10             	push   0x10(%ebp)
+  802065:	ff 75 0c             	push   0xc(%ebp)
+  802068:	ff 75 08             	push   0x8(%ebp)
+  80206b:	e8 41 02 00 00       	call   8022b1 <nsipc_socket>
+  802070:	83 c4 10             	add    $0x10,%esp
+  802073:	85 c0                	test   %eax,%eax
+  802075:	78 05                	js     80207c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802077:	e8 ab fe ff ff       	call   801f27 <alloc_sockfd>
+}
+  80207c:	c9                   	leave
+  80207d:	c3                   	ret
+
+0080207e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80207e:	55                   	push   %ebp
+  80207f:	89 e5                	mov    %esp,%ebp
+  802081:	53                   	push   %ebx
+  802082:	83 ec 04             	sub    $0x4,%esp
+  802085:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802087:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  80208e:	74 26                	je     8020b6 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802090:	6a 07                	push   $0x7
+  802092:	68 00 70 80 00       	push   $0x807000
+  802097:	53                   	push   %ebx
+  802098:	ff 35 08 50 80 00    	push   0x805008
+  80209e:	e8 81 f5 ff ff       	call   801624 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8020a3:	83 c4 0c             	add    $0xc,%esp
+  8020a6:	6a 00                	push   $0x0
+  8020a8:	6a 00                	push   $0x0
+  8020aa:	6a 00                	push   $0x0
+  8020ac:	e8 fb f4 ff ff       	call   8015ac <ipc_recv>
+}
+  8020b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020b4:	c9                   	leave
+  8020b5:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8020b6:	83 ec 0c             	sub    $0xc,%esp
+  8020b9:	6a 02                	push   $0x2
+  8020bb:	e8 b8 f5 ff ff       	call   801678 <ipc_find_env>
+  8020c0:	a3 08 50 80 00       	mov    %eax,0x805008
+  8020c5:	83 c4 10             	add    $0x10,%esp
+  8020c8:	eb c6                	jmp    802090 <nsipc+0x12>
+
+008020ca <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8020ca:	55                   	push   %ebp
+  8020cb:	89 e5                	mov    %esp,%ebp
+  8020cd:	56                   	push   %esi
+  8020ce:	53                   	push   %ebx
+  8020cf:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8020d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8020da:	8b 06                	mov    (%esi),%eax
+  8020dc:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8020e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020e6:	e8 93 ff ff ff       	call   80207e <nsipc>
+  8020eb:	89 c3                	mov    %eax,%ebx
+  8020ed:	85 c0                	test   %eax,%eax
+  8020ef:	79 09                	jns    8020fa <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8020f1:	89 d8                	mov    %ebx,%eax
+  8020f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020f6:	5b                   	pop    %ebx
+  8020f7:	5e                   	pop    %esi
+  8020f8:	5d                   	pop    %ebp
+  8020f9:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8020fa:	83 ec 04             	sub    $0x4,%esp
+  8020fd:	ff 35 10 70 80 00    	push   0x807010
+  802103:	68 00 70 80 00       	push   $0x807000
+  802108:	ff 75 0c             	push   0xc(%ebp)
+  80210b:	e8 2e ea ff ff       	call   800b3e <memmove>
+		*addrlen = ret->ret_addrlen;
+  802110:	a1 10 70 80 00       	mov    0x807010,%eax
+  802115:	89 06                	mov    %eax,(%esi)
+  802117:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80211a:	eb d5                	jmp    8020f1 <nsipc_accept+0x27>
+
+0080211c <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80211c:	55                   	push   %ebp
+  80211d:	89 e5                	mov    %esp,%ebp
+  80211f:	53                   	push   %ebx
+  802120:	83 ec 08             	sub    $0x8,%esp
+  802123:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802126:	8b 45 08             	mov    0x8(%ebp),%eax
+  802129:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80212e:	53                   	push   %ebx
+  80212f:	ff 75 0c             	push   0xc(%ebp)
+  802132:	68 04 70 80 00       	push   $0x807004
+  802137:	e8 02 ea ff ff       	call   800b3e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80213c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802142:	b8 02 00 00 00       	mov    $0x2,%eax
+  802147:	e8 32 ff ff ff       	call   80207e <nsipc>
+}
+  80214c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80214f:	c9                   	leave
+  802150:	c3                   	ret
+
+00802151 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802151:	55                   	push   %ebp
+  802152:	89 e5                	mov    %esp,%ebp
+  802154:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802157:	8b 45 08             	mov    0x8(%ebp),%eax
+  80215a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  80215f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802162:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802167:	b8 03 00 00 00       	mov    $0x3,%eax
+  80216c:	e8 0d ff ff ff       	call   80207e <nsipc>
+}
+  802171:	c9                   	leave
+  802172:	c3                   	ret
+
+00802173 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802173:	55                   	push   %ebp
+  802174:	89 e5                	mov    %esp,%ebp
+  802176:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802179:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217c:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802181:	b8 04 00 00 00       	mov    $0x4,%eax
+  802186:	e8 f3 fe ff ff       	call   80207e <nsipc>
+}
+  80218b:	c9                   	leave
+  80218c:	c3                   	ret
+
+0080218d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80218d:	55                   	push   %ebp
+  80218e:	89 e5                	mov    %esp,%ebp
+  802190:	53                   	push   %ebx
+  802191:	83 ec 08             	sub    $0x8,%esp
+  802194:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802197:	8b 45 08             	mov    0x8(%ebp),%eax
+  80219a:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80219f:	53                   	push   %ebx
+  8021a0:	ff 75 0c             	push   0xc(%ebp)
+  8021a3:	68 04 70 80 00       	push   $0x807004
+  8021a8:	e8 91 e9 ff ff       	call   800b3e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8021ad:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8021b3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021b8:	e8 c1 fe ff ff       	call   80207e <nsipc>
+}
+  8021bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021c0:	c9                   	leave
+  8021c1:	c3                   	ret
+
+008021c2 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8021c2:	55                   	push   %ebp
+  8021c3:	89 e5                	mov    %esp,%ebp
+  8021c5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8021c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021cb:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8021d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021d3:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8021d8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8021dd:	e8 9c fe ff ff       	call   80207e <nsipc>
+}
+  8021e2:	c9                   	leave
+  8021e3:	c3                   	ret
+
+008021e4 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8021e4:	55                   	push   %ebp
+  8021e5:	89 e5                	mov    %esp,%ebp
+  8021e7:	56                   	push   %esi
+  8021e8:	53                   	push   %ebx
+  8021e9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8021ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ef:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8021f4:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8021fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021fd:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802202:	b8 07 00 00 00       	mov    $0x7,%eax
+  802207:	e8 72 fe ff ff       	call   80207e <nsipc>
+  80220c:	89 c3                	mov    %eax,%ebx
+  80220e:	85 c0                	test   %eax,%eax
+  802210:	78 22                	js     802234 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802212:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802217:	39 c6                	cmp    %eax,%esi
+  802219:	0f 4e c6             	cmovle %esi,%eax
+  80221c:	39 c3                	cmp    %eax,%ebx
+  80221e:	7f 1d                	jg     80223d <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802220:	83 ec 04             	sub    $0x4,%esp
+  802223:	53                   	push   %ebx
+  802224:	68 00 70 80 00       	push   $0x807000
+  802229:	ff 75 0c             	push   0xc(%ebp)
+  80222c:	e8 0d e9 ff ff       	call   800b3e <memmove>
+  802231:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802234:	89 d8                	mov    %ebx,%eax
+  802236:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802239:	5b                   	pop    %ebx
+  80223a:	5e                   	pop    %esi
+  80223b:	5d                   	pop    %ebp
+  80223c:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80223d:	68 bb 32 80 00       	push   $0x8032bb
+  802242:	68 83 32 80 00       	push   $0x803283
+  802247:	6a 62                	push   $0x62
+  802249:	68 d0 32 80 00       	push   $0x8032d0
+  80224e:	e8 9c e0 ff ff       	call   8002ef <_panic>
+
+00802253 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+  802256:	53                   	push   %ebx
+  802257:	83 ec 04             	sub    $0x4,%esp
+  80225a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80225d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802260:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802265:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80226b:	7f 2e                	jg     80229b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80226d:	83 ec 04             	sub    $0x4,%esp
+  802270:	53                   	push   %ebx
+  802271:	ff 75 0c             	push   0xc(%ebp)
+  802274:	68 0c 70 80 00       	push   $0x80700c
+  802279:	e8 c0 e8 ff ff       	call   800b3e <memmove>
+	nsipcbuf.send.req_size = size;
+  80227e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802284:	8b 45 14             	mov    0x14(%ebp),%eax
+  802287:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80228c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802291:	e8 e8 fd ff ff       	call   80207e <nsipc>
+}
+  802296:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802299:	c9                   	leave
+  80229a:	c3                   	ret
+	assert(size < 1600);
+  80229b:	68 dc 32 80 00       	push   $0x8032dc
+  8022a0:	68 83 32 80 00       	push   $0x803283
+  8022a5:	6a 6d                	push   $0x6d
+  8022a7:	68 d0 32 80 00       	push   $0x8032d0
+  8022ac:	e8 3e e0 ff ff       	call   8002ef <_panic>
+
+008022b1 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8022b1:	55                   	push   %ebp
+  8022b2:	89 e5                	mov    %esp,%ebp
+  8022b4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8022b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ba:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  8022bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022c2:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8022c7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022ca:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8022cf:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022d4:	e8 a5 fd ff ff       	call   80207e <nsipc>
+}
+  8022d9:	c9                   	leave
+  8022da:	c3                   	ret
+
+008022db <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8022db:	55                   	push   %ebp
+  8022dc:	89 e5                	mov    %esp,%ebp
+  8022de:	56                   	push   %esi
+  8022df:	53                   	push   %ebx
+  8022e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8022e3:	83 ec 0c             	sub    $0xc,%esp
+  8022e6:	ff 75 08             	push   0x8(%ebp)
+  8022e9:	e8 aa f3 ff ff       	call   801698 <fd2data>
+  8022ee:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8022f0:	83 c4 08             	add    $0x8,%esp
+  8022f3:	68 e8 32 80 00       	push   $0x8032e8
+  8022f8:	53                   	push   %ebx
+  8022f9:	e8 ba e6 ff ff       	call   8009b8 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8022fe:	8b 46 04             	mov    0x4(%esi),%eax
+  802301:	2b 06                	sub    (%esi),%eax
+  802303:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802309:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802310:	00 00 00 
+	stat->st_dev = &devpipe;
+  802313:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80231a:	40 80 00 
+	return 0;
+}
+  80231d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802322:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802325:	5b                   	pop    %ebx
+  802326:	5e                   	pop    %esi
+  802327:	5d                   	pop    %ebp
+  802328:	c3                   	ret
+
+00802329 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802329:	55                   	push   %ebp
+  80232a:	89 e5                	mov    %esp,%ebp
+  80232c:	53                   	push   %ebx
+  80232d:	83 ec 0c             	sub    $0xc,%esp
+  802330:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802333:	53                   	push   %ebx
+  802334:	6a 00                	push   $0x0
+  802336:	e8 b2 eb ff ff       	call   800eed <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80233b:	89 1c 24             	mov    %ebx,(%esp)
+  80233e:	e8 55 f3 ff ff       	call   801698 <fd2data>
+  802343:	83 c4 08             	add    $0x8,%esp
+  802346:	50                   	push   %eax
+  802347:	6a 00                	push   $0x0
+  802349:	e8 9f eb ff ff       	call   800eed <sys_page_unmap>
+}
+  80234e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802351:	c9                   	leave
+  802352:	c3                   	ret
+
+00802353 <_pipeisclosed>:
+{
+  802353:	55                   	push   %ebp
+  802354:	89 e5                	mov    %esp,%ebp
+  802356:	57                   	push   %edi
+  802357:	56                   	push   %esi
+  802358:	53                   	push   %ebx
+  802359:	83 ec 1c             	sub    $0x1c,%esp
+  80235c:	89 c7                	mov    %eax,%edi
+  80235e:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802360:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  802365:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802368:	83 ec 0c             	sub    $0xc,%esp
+  80236b:	57                   	push   %edi
+  80236c:	e8 b9 04 00 00       	call   80282a <pageref>
+  802371:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802374:	89 34 24             	mov    %esi,(%esp)
+  802377:	e8 ae 04 00 00       	call   80282a <pageref>
+		nn = thisenv->env_runs;
+  80237c:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+  802382:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802385:	83 c4 10             	add    $0x10,%esp
+  802388:	39 cb                	cmp    %ecx,%ebx
+  80238a:	74 1b                	je     8023a7 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80238c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80238f:	75 cf                	jne    802360 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802391:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802394:	6a 01                	push   $0x1
+  802396:	50                   	push   %eax
+  802397:	53                   	push   %ebx
+  802398:	68 ef 32 80 00       	push   $0x8032ef
+  80239d:	e8 28 e0 ff ff       	call   8003ca <cprintf>
+  8023a2:	83 c4 10             	add    $0x10,%esp
+  8023a5:	eb b9                	jmp    802360 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8023a7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023aa:	0f 94 c0             	sete   %al
+  8023ad:	0f b6 c0             	movzbl %al,%eax
+}
+  8023b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023b3:	5b                   	pop    %ebx
+  8023b4:	5e                   	pop    %esi
+  8023b5:	5f                   	pop    %edi
+  8023b6:	5d                   	pop    %ebp
+  8023b7:	c3                   	ret
+
+008023b8 <devpipe_write>:
+{
+  8023b8:	55                   	push   %ebp
+  8023b9:	89 e5                	mov    %esp,%ebp
+  8023bb:	57                   	push   %edi
+  8023bc:	56                   	push   %esi
+  8023bd:	53                   	push   %ebx
+  8023be:	83 ec 28             	sub    $0x28,%esp
+  8023c1:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8023c4:	56                   	push   %esi
+  8023c5:	e8 ce f2 ff ff       	call   801698 <fd2data>
+  8023ca:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8023cc:	83 c4 10             	add    $0x10,%esp
+  8023cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d4:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8023d7:	75 09                	jne    8023e2 <devpipe_write+0x2a>
+	return i;
+  8023d9:	89 f8                	mov    %edi,%eax
+  8023db:	eb 23                	jmp    802400 <devpipe_write+0x48>
+			sys_yield();
+  8023dd:	e8 c3 e9 ff ff       	call   800da5 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8023e2:	8b 43 04             	mov    0x4(%ebx),%eax
+  8023e5:	8b 0b                	mov    (%ebx),%ecx
+  8023e7:	8d 51 20             	lea    0x20(%ecx),%edx
+  8023ea:	39 d0                	cmp    %edx,%eax
+  8023ec:	72 1a                	jb     802408 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8023ee:	89 da                	mov    %ebx,%edx
+  8023f0:	89 f0                	mov    %esi,%eax
+  8023f2:	e8 5c ff ff ff       	call   802353 <_pipeisclosed>
+  8023f7:	85 c0                	test   %eax,%eax
+  8023f9:	74 e2                	je     8023dd <devpipe_write+0x25>
+				return 0;
+  8023fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802403:	5b                   	pop    %ebx
+  802404:	5e                   	pop    %esi
+  802405:	5f                   	pop    %edi
+  802406:	5d                   	pop    %ebp
+  802407:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802408:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80240b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80240f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802412:	89 c2                	mov    %eax,%edx
+  802414:	c1 fa 1f             	sar    $0x1f,%edx
+  802417:	89 d1                	mov    %edx,%ecx
+  802419:	c1 e9 1b             	shr    $0x1b,%ecx
+  80241c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80241f:	83 e2 1f             	and    $0x1f,%edx
+  802422:	29 ca                	sub    %ecx,%edx
+  802424:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802428:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80242c:	83 c0 01             	add    $0x1,%eax
+  80242f:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802432:	83 c7 01             	add    $0x1,%edi
+  802435:	eb 9d                	jmp    8023d4 <devpipe_write+0x1c>
+
+00802437 <devpipe_read>:
+{
+  802437:	55                   	push   %ebp
+  802438:	89 e5                	mov    %esp,%ebp
+  80243a:	57                   	push   %edi
+  80243b:	56                   	push   %esi
+  80243c:	53                   	push   %ebx
+  80243d:	83 ec 18             	sub    $0x18,%esp
+  802440:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802443:	57                   	push   %edi
+  802444:	e8 4f f2 ff ff       	call   801698 <fd2data>
+  802449:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80244b:	83 c4 10             	add    $0x10,%esp
+  80244e:	be 00 00 00 00       	mov    $0x0,%esi
+  802453:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802456:	75 13                	jne    80246b <devpipe_read+0x34>
+	return i;
+  802458:	89 f0                	mov    %esi,%eax
+  80245a:	eb 02                	jmp    80245e <devpipe_read+0x27>
+				return i;
+  80245c:	89 f0                	mov    %esi,%eax
+}
+  80245e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802461:	5b                   	pop    %ebx
+  802462:	5e                   	pop    %esi
+  802463:	5f                   	pop    %edi
+  802464:	5d                   	pop    %ebp
+  802465:	c3                   	ret
+			sys_yield();
+  802466:	e8 3a e9 ff ff       	call   800da5 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80246b:	8b 03                	mov    (%ebx),%eax
+  80246d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802470:	75 18                	jne    80248a <devpipe_read+0x53>
+			if (i > 0)
+  802472:	85 f6                	test   %esi,%esi
+  802474:	75 e6                	jne    80245c <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802476:	89 da                	mov    %ebx,%edx
+  802478:	89 f8                	mov    %edi,%eax
+  80247a:	e8 d4 fe ff ff       	call   802353 <_pipeisclosed>
+  80247f:	85 c0                	test   %eax,%eax
+  802481:	74 e3                	je     802466 <devpipe_read+0x2f>
+				return 0;
+  802483:	b8 00 00 00 00       	mov    $0x0,%eax
+  802488:	eb d4                	jmp    80245e <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80248a:	99                   	cltd
+  80248b:	c1 ea 1b             	shr    $0x1b,%edx
+  80248e:	01 d0                	add    %edx,%eax
+  802490:	83 e0 1f             	and    $0x1f,%eax
+  802493:	29 d0                	sub    %edx,%eax
+  802495:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80249a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80249d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8024a0:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8024a3:	83 c6 01             	add    $0x1,%esi
+  8024a6:	eb ab                	jmp    802453 <devpipe_read+0x1c>
+
+008024a8 <pipe>:
+{
+  8024a8:	55                   	push   %ebp
+  8024a9:	89 e5                	mov    %esp,%ebp
+  8024ab:	56                   	push   %esi
+  8024ac:	53                   	push   %ebx
+  8024ad:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8024b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024b3:	50                   	push   %eax
+  8024b4:	e8 f6 f1 ff ff       	call   8016af <fd_alloc>
+  8024b9:	89 c3                	mov    %eax,%ebx
+  8024bb:	83 c4 10             	add    $0x10,%esp
+  8024be:	85 c0                	test   %eax,%eax
+  8024c0:	0f 88 23 01 00 00    	js     8025e9 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024c6:	83 ec 04             	sub    $0x4,%esp
+  8024c9:	68 07 04 00 00       	push   $0x407
+  8024ce:	ff 75 f4             	push   -0xc(%ebp)
+  8024d1:	6a 00                	push   $0x0
+  8024d3:	e8 4d e9 ff ff       	call   800e25 <sys_page_alloc>
+  8024d8:	89 c3                	mov    %eax,%ebx
+  8024da:	83 c4 10             	add    $0x10,%esp
+  8024dd:	85 c0                	test   %eax,%eax
+  8024df:	0f 88 04 01 00 00    	js     8025e9 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8024e5:	83 ec 0c             	sub    $0xc,%esp
+  8024e8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024eb:	50                   	push   %eax
+  8024ec:	e8 be f1 ff ff       	call   8016af <fd_alloc>
+  8024f1:	89 c3                	mov    %eax,%ebx
+  8024f3:	83 c4 10             	add    $0x10,%esp
+  8024f6:	85 c0                	test   %eax,%eax
+  8024f8:	0f 88 db 00 00 00    	js     8025d9 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024fe:	83 ec 04             	sub    $0x4,%esp
+  802501:	68 07 04 00 00       	push   $0x407
+  802506:	ff 75 f0             	push   -0x10(%ebp)
+  802509:	6a 00                	push   $0x0
+  80250b:	e8 15 e9 ff ff       	call   800e25 <sys_page_alloc>
+  802510:	89 c3                	mov    %eax,%ebx
+  802512:	83 c4 10             	add    $0x10,%esp
+  802515:	85 c0                	test   %eax,%eax
+  802517:	0f 88 bc 00 00 00    	js     8025d9 <pipe+0x131>
+	va = fd2data(fd0);
+  80251d:	83 ec 0c             	sub    $0xc,%esp
+  802520:	ff 75 f4             	push   -0xc(%ebp)
+  802523:	e8 70 f1 ff ff       	call   801698 <fd2data>
+  802528:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80252a:	83 c4 0c             	add    $0xc,%esp
+  80252d:	68 07 04 00 00       	push   $0x407
+  802532:	50                   	push   %eax
+  802533:	6a 00                	push   $0x0
+  802535:	e8 eb e8 ff ff       	call   800e25 <sys_page_alloc>
+  80253a:	89 c3                	mov    %eax,%ebx
+  80253c:	83 c4 10             	add    $0x10,%esp
+  80253f:	85 c0                	test   %eax,%eax
+  802541:	0f 88 82 00 00 00    	js     8025c9 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802547:	83 ec 0c             	sub    $0xc,%esp
+  80254a:	ff 75 f0             	push   -0x10(%ebp)
+  80254d:	e8 46 f1 ff ff       	call   801698 <fd2data>
+  802552:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802559:	50                   	push   %eax
+  80255a:	6a 00                	push   $0x0
+  80255c:	56                   	push   %esi
+  80255d:	6a 00                	push   $0x0
+  80255f:	e8 47 e9 ff ff       	call   800eab <sys_page_map>
+  802564:	89 c3                	mov    %eax,%ebx
+  802566:	83 c4 20             	add    $0x20,%esp
+  802569:	85 c0                	test   %eax,%eax
+  80256b:	78 4e                	js     8025bb <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80256d:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802572:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802575:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802577:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80257a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802581:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802584:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802586:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802589:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802590:	83 ec 0c             	sub    $0xc,%esp
+  802593:	ff 75 f4             	push   -0xc(%ebp)
+  802596:	e8 ed f0 ff ff       	call   801688 <fd2num>
+  80259b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80259e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8025a0:	83 c4 04             	add    $0x4,%esp
+  8025a3:	ff 75 f0             	push   -0x10(%ebp)
+  8025a6:	e8 dd f0 ff ff       	call   801688 <fd2num>
+  8025ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025ae:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8025b1:	83 c4 10             	add    $0x10,%esp
+  8025b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025b9:	eb 2e                	jmp    8025e9 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8025bb:	83 ec 08             	sub    $0x8,%esp
+  8025be:	56                   	push   %esi
+  8025bf:	6a 00                	push   $0x0
+  8025c1:	e8 27 e9 ff ff       	call   800eed <sys_page_unmap>
+  8025c6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8025c9:	83 ec 08             	sub    $0x8,%esp
+  8025cc:	ff 75 f0             	push   -0x10(%ebp)
+  8025cf:	6a 00                	push   $0x0
+  8025d1:	e8 17 e9 ff ff       	call   800eed <sys_page_unmap>
+  8025d6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8025d9:	83 ec 08             	sub    $0x8,%esp
+  8025dc:	ff 75 f4             	push   -0xc(%ebp)
+  8025df:	6a 00                	push   $0x0
+  8025e1:	e8 07 e9 ff ff       	call   800eed <sys_page_unmap>
+  8025e6:	83 c4 10             	add    $0x10,%esp
+}
+  8025e9:	89 d8                	mov    %ebx,%eax
+  8025eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025ee:	5b                   	pop    %ebx
+  8025ef:	5e                   	pop    %esi
+  8025f0:	5d                   	pop    %ebp
+  8025f1:	c3                   	ret
+
+008025f2 <pipeisclosed>:
+{
+  8025f2:	55                   	push   %ebp
+  8025f3:	89 e5                	mov    %esp,%ebp
+  8025f5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025fb:	50                   	push   %eax
+  8025fc:	ff 75 08             	push   0x8(%ebp)
+  8025ff:	e8 01 f1 ff ff       	call   801705 <fd_lookup>
+  802604:	83 c4 10             	add    $0x10,%esp
+  802607:	85 c0                	test   %eax,%eax
+  802609:	78 18                	js     802623 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80260b:	83 ec 0c             	sub    $0xc,%esp
+  80260e:	ff 75 f4             	push   -0xc(%ebp)
+  802611:	e8 82 f0 ff ff       	call   801698 <fd2data>
+  802616:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802618:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80261b:	e8 33 fd ff ff       	call   802353 <_pipeisclosed>
+  802620:	83 c4 10             	add    $0x10,%esp
+}
+  802623:	c9                   	leave
+  802624:	c3                   	ret
+
+00802625 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80262a:	c3                   	ret
+
+0080262b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80262b:	55                   	push   %ebp
+  80262c:	89 e5                	mov    %esp,%ebp
+  80262e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802631:	68 07 33 80 00       	push   $0x803307
+  802636:	ff 75 0c             	push   0xc(%ebp)
+  802639:	e8 7a e3 ff ff       	call   8009b8 <strcpy>
+	return 0;
+}
+  80263e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802643:	c9                   	leave
+  802644:	c3                   	ret
+
+00802645 <devcons_write>:
+{
+  802645:	55                   	push   %ebp
+  802646:	89 e5                	mov    %esp,%ebp
+  802648:	57                   	push   %edi
+  802649:	56                   	push   %esi
+  80264a:	53                   	push   %ebx
+  80264b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802651:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802656:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80265c:	eb 2e                	jmp    80268c <devcons_write+0x47>
+		m = n - tot;
+  80265e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802661:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802663:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802668:	39 c3                	cmp    %eax,%ebx
+  80266a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80266d:	83 ec 04             	sub    $0x4,%esp
+  802670:	53                   	push   %ebx
+  802671:	89 f0                	mov    %esi,%eax
+  802673:	03 45 0c             	add    0xc(%ebp),%eax
+  802676:	50                   	push   %eax
+  802677:	57                   	push   %edi
+  802678:	e8 c1 e4 ff ff       	call   800b3e <memmove>
+		sys_cputs(buf, m);
+  80267d:	83 c4 08             	add    $0x8,%esp
+  802680:	53                   	push   %ebx
+  802681:	57                   	push   %edi
+  802682:	e8 61 e6 ff ff       	call   800ce8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802687:	01 de                	add    %ebx,%esi
+  802689:	83 c4 10             	add    $0x10,%esp
+  80268c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80268f:	72 cd                	jb     80265e <devcons_write+0x19>
+}
+  802691:	89 f0                	mov    %esi,%eax
+  802693:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802696:	5b                   	pop    %ebx
+  802697:	5e                   	pop    %esi
+  802698:	5f                   	pop    %edi
+  802699:	5d                   	pop    %ebp
+  80269a:	c3                   	ret
+
+0080269b <devcons_read>:
+{
+  80269b:	55                   	push   %ebp
+  80269c:	89 e5                	mov    %esp,%ebp
+  80269e:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8026a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8026aa:	75 07                	jne    8026b3 <devcons_read+0x18>
+  8026ac:	eb 1f                	jmp    8026cd <devcons_read+0x32>
+		sys_yield();
+  8026ae:	e8 f2 e6 ff ff       	call   800da5 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8026b3:	e8 4e e6 ff ff       	call   800d06 <sys_cgetc>
+  8026b8:	85 c0                	test   %eax,%eax
+  8026ba:	74 f2                	je     8026ae <devcons_read+0x13>
+	if (c < 0)
+  8026bc:	78 0f                	js     8026cd <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8026be:	83 f8 04             	cmp    $0x4,%eax
+  8026c1:	74 0c                	je     8026cf <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8026c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8026c6:	88 02                	mov    %al,(%edx)
+	return 1;
+  8026c8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8026cd:	c9                   	leave
+  8026ce:	c3                   	ret
+		return 0;
+  8026cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d4:	eb f7                	jmp    8026cd <devcons_read+0x32>
+
+008026d6 <cputchar>:
+{
+  8026d6:	55                   	push   %ebp
+  8026d7:	89 e5                	mov    %esp,%ebp
+  8026d9:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8026dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026df:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8026e2:	6a 01                	push   $0x1
+  8026e4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8026e7:	50                   	push   %eax
+  8026e8:	e8 fb e5 ff ff       	call   800ce8 <sys_cputs>
+}
+  8026ed:	83 c4 10             	add    $0x10,%esp
+  8026f0:	c9                   	leave
+  8026f1:	c3                   	ret
+
+008026f2 <getchar>:
+{
+  8026f2:	55                   	push   %ebp
+  8026f3:	89 e5                	mov    %esp,%ebp
+  8026f5:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8026f8:	6a 01                	push   $0x1
+  8026fa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8026fd:	50                   	push   %eax
+  8026fe:	6a 00                	push   $0x0
+  802700:	e8 66 f2 ff ff       	call   80196b <read>
+	if (r < 0)
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	78 06                	js     802712 <getchar+0x20>
+	if (r < 1)
+  80270c:	74 06                	je     802714 <getchar+0x22>
+	return c;
+  80270e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802712:	c9                   	leave
+  802713:	c3                   	ret
+		return -E_EOF;
+  802714:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802719:	eb f7                	jmp    802712 <getchar+0x20>
+
+0080271b <iscons>:
+{
+  80271b:	55                   	push   %ebp
+  80271c:	89 e5                	mov    %esp,%ebp
+  80271e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802721:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802724:	50                   	push   %eax
+  802725:	ff 75 08             	push   0x8(%ebp)
+  802728:	e8 d8 ef ff ff       	call   801705 <fd_lookup>
+  80272d:	83 c4 10             	add    $0x10,%esp
+  802730:	85 c0                	test   %eax,%eax
+  802732:	78 11                	js     802745 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802734:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802737:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80273d:	39 10                	cmp    %edx,(%eax)
+  80273f:	0f 94 c0             	sete   %al
+  802742:	0f b6 c0             	movzbl %al,%eax
+}
+  802745:	c9                   	leave
+  802746:	c3                   	ret
+
+00802747 <opencons>:
+{
+  802747:	55                   	push   %ebp
+  802748:	89 e5                	mov    %esp,%ebp
+  80274a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80274d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802750:	50                   	push   %eax
+  802751:	e8 59 ef ff ff       	call   8016af <fd_alloc>
+  802756:	83 c4 10             	add    $0x10,%esp
+  802759:	85 c0                	test   %eax,%eax
+  80275b:	78 3a                	js     802797 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80275d:	83 ec 04             	sub    $0x4,%esp
+  802760:	68 07 04 00 00       	push   $0x407
+  802765:	ff 75 f4             	push   -0xc(%ebp)
+  802768:	6a 00                	push   $0x0
+  80276a:	e8 b6 e6 ff ff       	call   800e25 <sys_page_alloc>
+  80276f:	83 c4 10             	add    $0x10,%esp
+  802772:	85 c0                	test   %eax,%eax
+  802774:	78 21                	js     802797 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802776:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802779:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80277f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802781:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802784:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80278b:	83 ec 0c             	sub    $0xc,%esp
+  80278e:	50                   	push   %eax
+  80278f:	e8 f4 ee ff ff       	call   801688 <fd2num>
+  802794:	83 c4 10             	add    $0x10,%esp
+}
+  802797:	c9                   	leave
+  802798:	c3                   	ret
+
+00802799 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802799:	55                   	push   %ebp
+  80279a:	89 e5                	mov    %esp,%ebp
+  80279c:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80279f:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8027a6:	74 0a                	je     8027b2 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8027a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ab:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8027b0:	c9                   	leave
+  8027b1:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  8027b2:	83 ec 04             	sub    $0x4,%esp
+  8027b5:	6a 07                	push   $0x7
+  8027b7:	68 00 f0 bf ee       	push   $0xeebff000
+  8027bc:	6a 00                	push   $0x0
+  8027be:	e8 62 e6 ff ff       	call   800e25 <sys_page_alloc>
+  8027c3:	83 c4 10             	add    $0x10,%esp
+  8027c6:	85 c0                	test   %eax,%eax
+  8027c8:	78 28                	js     8027f2 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  8027ca:	83 ec 08             	sub    $0x8,%esp
+  8027cd:	68 04 28 80 00       	push   $0x802804
+  8027d2:	6a 00                	push   $0x0
+  8027d4:	e8 47 e9 ff ff       	call   801120 <sys_env_set_pgfault_upcall>
+  8027d9:	83 c4 10             	add    $0x10,%esp
+  8027dc:	85 c0                	test   %eax,%eax
+  8027de:	79 c8                	jns    8027a8 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  8027e0:	50                   	push   %eax
+  8027e1:	68 21 33 80 00       	push   $0x803321
+  8027e6:	6a 24                	push   $0x24
+  8027e8:	68 13 33 80 00       	push   $0x803313
+  8027ed:	e8 fd da ff ff       	call   8002ef <_panic>
+			panic("sys_page_alloc: %e", r);
+  8027f2:	50                   	push   %eax
+  8027f3:	68 ea 2c 80 00       	push   $0x802cea
+  8027f8:	6a 21                	push   $0x21
+  8027fa:	68 13 33 80 00       	push   $0x803313
+  8027ff:	e8 eb da ff ff       	call   8002ef <_panic>
+
+00802804 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802804:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802805:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  80280a:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80280c:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  80280f:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  802812:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  802816:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  802819:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  80281d:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  802821:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  802823:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802824:	83 c4 04             	add    $0x4,%esp
+	popf
+  802827:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802828:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802829:	c3                   	ret
+
+0080282a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80282a:	55                   	push   %ebp
+  80282b:	89 e5                	mov    %esp,%ebp
+  80282d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802830:	89 c2                	mov    %eax,%edx
+  802832:	c1 ea 16             	shr    $0x16,%edx
+  802835:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80283c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802841:	f6 c1 01             	test   $0x1,%cl
+  802844:	74 22                	je     802868 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802846:	c1 e8 0c             	shr    $0xc,%eax
+  802849:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802850:	a8 01                	test   $0x1,%al
+  802852:	74 14                	je     802868 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802854:	c1 e8 0c             	shr    $0xc,%eax
+  802857:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80285a:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802861:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802865:	0f b7 d2             	movzwl %dx,%edx
+}
+  802868:	89 d0                	mov    %edx,%eax
+  80286a:	5d                   	pop    %ebp
+  80286b:	c3                   	ret
+  80286c:	66 90                	xchg   %ax,%ax
+  80286e:	66 90                	xchg   %ax,%ax
+
+00802870 <__udivmoddi4>:
+  802870:	55                   	push   %ebp
+  802871:	57                   	push   %edi
+  802872:	56                   	push   %esi
+  802873:	53                   	push   %ebx
+  802874:	83 ec 14             	sub    $0x14,%esp
+  802877:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80287b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80287f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802883:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802887:	89 f1                	mov    %esi,%ecx
+  802889:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80288d:	09 d9                	or     %ebx,%ecx
+  80288f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802893:	0f 84 92 00 00 00    	je     80292b <__udivmoddi4+0xbb>
+  802899:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8028a0:	00 
+  8028a1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8028a6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8028ad:	00 
+  8028ae:	89 1c 24             	mov    %ebx,(%esp)
+  8028b1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8028b5:	8d 76 00             	lea    0x0(%esi),%esi
+  8028b8:	89 e9                	mov    %ebp,%ecx
+  8028ba:	89 c3                	mov    %eax,%ebx
+  8028bc:	89 d6                	mov    %edx,%esi
+  8028be:	31 ff                	xor    %edi,%edi
+  8028c0:	d3 ee                	shr    %cl,%esi
+  8028c2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8028c5:	f6 c1 20             	test   $0x20,%cl
+  8028c8:	0f 45 de             	cmovne %esi,%ebx
+  8028cb:	0f 45 f7             	cmovne %edi,%esi
+  8028ce:	8b 3c 24             	mov    (%esp),%edi
+  8028d1:	39 fb                	cmp    %edi,%ebx
+  8028d3:	89 f7                	mov    %esi,%edi
+  8028d5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8028d9:	8b 1c 24             	mov    (%esp),%ebx
+  8028dc:	19 f7                	sbb    %esi,%edi
+  8028de:	72 39                	jb     802919 <__udivmoddi4+0xa9>
+  8028e0:	89 e9                	mov    %ebp,%ecx
+  8028e2:	89 f7                	mov    %esi,%edi
+  8028e4:	89 de                	mov    %ebx,%esi
+  8028e6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8028e9:	d3 e6                	shl    %cl,%esi
+  8028eb:	31 db                	xor    %ebx,%ebx
+  8028ed:	f6 c1 20             	test   $0x20,%cl
+  8028f0:	0f 45 fe             	cmovne %esi,%edi
+  8028f3:	0f 45 f3             	cmovne %ebx,%esi
+  8028f6:	29 f0                	sub    %esi,%eax
+  8028f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8028fd:	19 fa                	sbb    %edi,%edx
+  8028ff:	31 ff                	xor    %edi,%edi
+  802901:	31 db                	xor    %ebx,%ebx
+  802903:	0f a5 f7             	shld   %cl,%esi,%edi
+  802906:	d3 e6                	shl    %cl,%esi
+  802908:	f6 c1 20             	test   $0x20,%cl
+  80290b:	0f 45 fe             	cmovne %esi,%edi
+  80290e:	0f 45 f3             	cmovne %ebx,%esi
+  802911:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802915:	09 74 24 08          	or     %esi,0x8(%esp)
+  802919:	83 ed 01             	sub    $0x1,%ebp
+  80291c:	73 9a                	jae    8028b8 <__udivmoddi4+0x48>
+  80291e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802922:	85 ff                	test   %edi,%edi
+  802924:	74 05                	je     80292b <__udivmoddi4+0xbb>
+  802926:	89 07                	mov    %eax,(%edi)
+  802928:	89 57 04             	mov    %edx,0x4(%edi)
+  80292b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80292f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802933:	83 c4 14             	add    $0x14,%esp
+  802936:	5b                   	pop    %ebx
+  802937:	5e                   	pop    %esi
+  802938:	5f                   	pop    %edi
+  802939:	5d                   	pop    %ebp
+  80293a:	c3                   	ret
+  80293b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80293f:	90                   	nop
+
+00802940 <__udivdi3>:
+  802940:	55                   	push   %ebp
+  802941:	57                   	push   %edi
+  802942:	56                   	push   %esi
+  802943:	53                   	push   %ebx
+  802944:	83 ec 14             	sub    $0x14,%esp
+  802947:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80294b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80294f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802953:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802957:	89 fb                	mov    %edi,%ebx
+  802959:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80295d:	09 f3                	or     %esi,%ebx
+  80295f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802963:	0f 84 85 00 00 00    	je     8029ee <__udivdi3+0xae>
+  802969:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802970:	00 
+  802971:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802976:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80297d:	00 
+  80297e:	89 34 24             	mov    %esi,(%esp)
+  802981:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802985:	8d 76 00             	lea    0x0(%esi),%esi
+  802988:	89 e9                	mov    %ebp,%ecx
+  80298a:	89 c3                	mov    %eax,%ebx
+  80298c:	89 d6                	mov    %edx,%esi
+  80298e:	31 ff                	xor    %edi,%edi
+  802990:	d3 ee                	shr    %cl,%esi
+  802992:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802995:	f6 c1 20             	test   $0x20,%cl
+  802998:	0f 45 de             	cmovne %esi,%ebx
+  80299b:	0f 45 f7             	cmovne %edi,%esi
+  80299e:	8b 3c 24             	mov    (%esp),%edi
+  8029a1:	39 fb                	cmp    %edi,%ebx
+  8029a3:	89 f7                	mov    %esi,%edi
+  8029a5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8029a9:	8b 1c 24             	mov    (%esp),%ebx
+  8029ac:	19 f7                	sbb    %esi,%edi
+  8029ae:	72 39                	jb     8029e9 <__udivdi3+0xa9>
+  8029b0:	89 e9                	mov    %ebp,%ecx
+  8029b2:	89 f7                	mov    %esi,%edi
+  8029b4:	89 de                	mov    %ebx,%esi
+  8029b6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8029b9:	d3 e6                	shl    %cl,%esi
+  8029bb:	31 db                	xor    %ebx,%ebx
+  8029bd:	f6 c1 20             	test   $0x20,%cl
+  8029c0:	0f 45 fe             	cmovne %esi,%edi
+  8029c3:	0f 45 f3             	cmovne %ebx,%esi
+  8029c6:	29 f0                	sub    %esi,%eax
+  8029c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8029cd:	19 fa                	sbb    %edi,%edx
+  8029cf:	31 ff                	xor    %edi,%edi
+  8029d1:	31 db                	xor    %ebx,%ebx
+  8029d3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029d6:	d3 e6                	shl    %cl,%esi
+  8029d8:	f6 c1 20             	test   $0x20,%cl
+  8029db:	0f 45 fe             	cmovne %esi,%edi
+  8029de:	0f 45 f3             	cmovne %ebx,%esi
+  8029e1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8029e5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8029e9:	83 ed 01             	sub    $0x1,%ebp
+  8029ec:	73 9a                	jae    802988 <__udivdi3+0x48>
+  8029ee:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029f2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029f6:	83 c4 14             	add    $0x14,%esp
+  8029f9:	5b                   	pop    %ebx
+  8029fa:	5e                   	pop    %esi
+  8029fb:	5f                   	pop    %edi
+  8029fc:	5d                   	pop    %ebp
+  8029fd:	c3                   	ret
+  8029fe:	66 90                	xchg   %ax,%ax
+
+00802a00 <__umoddi3>:
+  802a00:	57                   	push   %edi
+  802a01:	56                   	push   %esi
+  802a02:	53                   	push   %ebx
+  802a03:	83 ec 08             	sub    $0x8,%esp
+  802a06:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  802a0a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  802a0e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a12:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a16:	89 f9                	mov    %edi,%ecx
+  802a18:	89 34 24             	mov    %esi,(%esp)
+  802a1b:	09 f1                	or     %esi,%ecx
+  802a1d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802a21:	74 53                	je     802a76 <__umoddi3+0x76>
+  802a23:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a2f:	90                   	nop
+  802a30:	89 c6                	mov    %eax,%esi
+  802a32:	89 d7                	mov    %edx,%edi
+  802a34:	31 db                	xor    %ebx,%ebx
+  802a36:	d3 ef                	shr    %cl,%edi
+  802a38:	0f ad d6             	shrd   %cl,%edx,%esi
+  802a3b:	f6 c1 20             	test   $0x20,%cl
+  802a3e:	0f 45 f7             	cmovne %edi,%esi
+  802a41:	0f 45 fb             	cmovne %ebx,%edi
+  802a44:	8b 1c 24             	mov    (%esp),%ebx
+  802a47:	39 de                	cmp    %ebx,%esi
+  802a49:	89 fb                	mov    %edi,%ebx
+  802a4b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  802a4f:	8b 34 24             	mov    (%esp),%esi
+  802a52:	19 fb                	sbb    %edi,%ebx
+  802a54:	72 14                	jb     802a6a <__umoddi3+0x6a>
+  802a56:	0f a5 f7             	shld   %cl,%esi,%edi
+  802a59:	31 db                	xor    %ebx,%ebx
+  802a5b:	d3 e6                	shl    %cl,%esi
+  802a5d:	f6 c1 20             	test   $0x20,%cl
+  802a60:	0f 45 fe             	cmovne %esi,%edi
+  802a63:	0f 45 f3             	cmovne %ebx,%esi
+  802a66:	29 f0                	sub    %esi,%eax
+  802a68:	19 fa                	sbb    %edi,%edx
+  802a6a:	83 e9 01             	sub    $0x1,%ecx
+  802a6d:	73 c1                	jae    802a30 <__umoddi3+0x30>
+  802a6f:	83 c4 08             	add    $0x8,%esp
+  802a72:	5b                   	pop    %ebx
+  802a73:	5e                   	pop    %esi
+  802a74:	5f                   	pop    %edi
+  802a75:	c3                   	ret
+  802a76:	83 c4 08             	add    $0x8,%esp
+  802a79:	31 c0                	xor    %eax,%eax
+  802a7b:	31 d2                	xor    %edx,%edx
+  802a7d:	5b                   	pop    %ebx
+  802a7e:	5e                   	pop    %esi
+  802a7f:	5f                   	pop    %edi
+  802a80:	c3                   	ret
+  802a81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a8f:	90                   	nop
+
+00802a90 <__divdi3>:
+  802a90:	55                   	push   %ebp
+  802a91:	57                   	push   %edi
+  802a92:	56                   	push   %esi
+  802a93:	53                   	push   %ebx
+  802a94:	83 ec 1c             	sub    $0x1c,%esp
+  802a97:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802a9b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802a9f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802aa3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802aa7:	85 ff                	test   %edi,%edi
+  802aa9:	0f 88 da 00 00 00    	js     802b89 <__divdi3+0xf9>
+  802aaf:	85 db                	test   %ebx,%ebx
+  802ab1:	78 16                	js     802ac9 <__divdi3+0x39>
+  802ab3:	89 dd                	mov    %ebx,%ebp
+  802ab5:	89 c8                	mov    %ecx,%eax
+  802ab7:	89 da                	mov    %ebx,%edx
+  802ab9:	09 cd                	or     %ecx,%ebp
+  802abb:	0f 85 fd 00 00 00    	jne    802bbe <__divdi3+0x12e>
+  802ac1:	83 c4 1c             	add    $0x1c,%esp
+  802ac4:	5b                   	pop    %ebx
+  802ac5:	5e                   	pop    %esi
+  802ac6:	5f                   	pop    %edi
+  802ac7:	5d                   	pop    %ebp
+  802ac8:	c3                   	ret
+  802ac9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802ace:	f7 d9                	neg    %ecx
+  802ad0:	89 f0                	mov    %esi,%eax
+  802ad2:	89 fa                	mov    %edi,%edx
+  802ad4:	83 d3 00             	adc    $0x0,%ebx
+  802ad7:	89 0c 24             	mov    %ecx,(%esp)
+  802ada:	f7 db                	neg    %ebx
+  802adc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802ae0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802ae7:	00 
+  802ae8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802aed:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802af4:	00 
+  802af5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802af9:	89 cd                	mov    %ecx,%ebp
+  802afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802aff:	90                   	nop
+  802b00:	89 e9                	mov    %ebp,%ecx
+  802b02:	89 c3                	mov    %eax,%ebx
+  802b04:	89 d6                	mov    %edx,%esi
+  802b06:	31 ff                	xor    %edi,%edi
+  802b08:	d3 ee                	shr    %cl,%esi
+  802b0a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802b0d:	f6 c1 20             	test   $0x20,%cl
+  802b10:	0f 45 de             	cmovne %esi,%ebx
+  802b13:	0f 45 f7             	cmovne %edi,%esi
+  802b16:	8b 3c 24             	mov    (%esp),%edi
+  802b19:	39 fb                	cmp    %edi,%ebx
+  802b1b:	89 f7                	mov    %esi,%edi
+  802b1d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802b21:	8b 1c 24             	mov    (%esp),%ebx
+  802b24:	19 f7                	sbb    %esi,%edi
+  802b26:	72 39                	jb     802b61 <__divdi3+0xd1>
+  802b28:	89 e9                	mov    %ebp,%ecx
+  802b2a:	89 f7                	mov    %esi,%edi
+  802b2c:	89 de                	mov    %ebx,%esi
+  802b2e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802b31:	d3 e6                	shl    %cl,%esi
+  802b33:	31 db                	xor    %ebx,%ebx
+  802b35:	f6 c1 20             	test   $0x20,%cl
+  802b38:	0f 45 fe             	cmovne %esi,%edi
+  802b3b:	0f 45 f3             	cmovne %ebx,%esi
+  802b3e:	29 f0                	sub    %esi,%eax
+  802b40:	be 01 00 00 00       	mov    $0x1,%esi
+  802b45:	19 fa                	sbb    %edi,%edx
+  802b47:	31 ff                	xor    %edi,%edi
+  802b49:	31 db                	xor    %ebx,%ebx
+  802b4b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802b4e:	d3 e6                	shl    %cl,%esi
+  802b50:	f6 c1 20             	test   $0x20,%cl
+  802b53:	0f 45 fe             	cmovne %esi,%edi
+  802b56:	0f 45 f3             	cmovne %ebx,%esi
+  802b59:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802b5d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802b61:	83 ed 01             	sub    $0x1,%ebp
+  802b64:	73 9a                	jae    802b00 <__divdi3+0x70>
+  802b66:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802b6a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b6e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b72:	85 ed                	test   %ebp,%ebp
+  802b74:	0f 84 47 ff ff ff    	je     802ac1 <__divdi3+0x31>
+  802b7a:	f7 d8                	neg    %eax
+  802b7c:	83 d2 00             	adc    $0x0,%edx
+  802b7f:	83 c4 1c             	add    $0x1c,%esp
+  802b82:	5b                   	pop    %ebx
+  802b83:	f7 da                	neg    %edx
+  802b85:	5e                   	pop    %esi
+  802b86:	5f                   	pop    %edi
+  802b87:	5d                   	pop    %ebp
+  802b88:	c3                   	ret
+  802b89:	f7 de                	neg    %esi
+  802b8b:	83 d7 00             	adc    $0x0,%edi
+  802b8e:	f7 df                	neg    %edi
+  802b90:	85 db                	test   %ebx,%ebx
+  802b92:	78 23                	js     802bb7 <__divdi3+0x127>
+  802b94:	89 dd                	mov    %ebx,%ebp
+  802b96:	89 c8                	mov    %ecx,%eax
+  802b98:	89 da                	mov    %ebx,%edx
+  802b9a:	09 cd                	or     %ecx,%ebp
+  802b9c:	0f 84 1f ff ff ff    	je     802ac1 <__divdi3+0x31>
+  802ba2:	89 0c 24             	mov    %ecx,(%esp)
+  802ba5:	89 f0                	mov    %esi,%eax
+  802ba7:	89 fa                	mov    %edi,%edx
+  802ba9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802bae:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802bb2:	e9 29 ff ff ff       	jmp    802ae0 <__divdi3+0x50>
+  802bb7:	31 ed                	xor    %ebp,%ebp
+  802bb9:	e9 10 ff ff ff       	jmp    802ace <__divdi3+0x3e>
+  802bbe:	89 0c 24             	mov    %ecx,(%esp)
+  802bc1:	89 f0                	mov    %esi,%eax
+  802bc3:	89 fa                	mov    %edi,%edx
+  802bc5:	31 ed                	xor    %ebp,%ebp
+  802bc7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802bcb:	e9 10 ff ff ff       	jmp    802ae0 <__divdi3+0x50>
+
+00802bd0 <__moddi3>:
+  802bd0:	55                   	push   %ebp
+  802bd1:	57                   	push   %edi
+  802bd2:	56                   	push   %esi
+  802bd3:	53                   	push   %ebx
+  802bd4:	83 ec 14             	sub    $0x14,%esp
+  802bd7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802bdb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802bdf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802be3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802be7:	85 d2                	test   %edx,%edx
+  802be9:	0f 88 9b 00 00 00    	js     802c8a <__moddi3+0xba>
+  802bef:	89 f7                	mov    %esi,%edi
+  802bf1:	31 ed                	xor    %ebp,%ebp
+  802bf3:	09 cf                	or     %ecx,%edi
+  802bf5:	0f 84 83 00 00 00    	je     802c7e <__moddi3+0xae>
+  802bfb:	89 cb                	mov    %ecx,%ebx
+  802bfd:	89 f7                	mov    %esi,%edi
+  802bff:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802c03:	f7 db                	neg    %ebx
+  802c05:	83 d7 00             	adc    $0x0,%edi
+  802c08:	f7 df                	neg    %edi
+  802c0a:	0f 49 f7             	cmovns %edi,%esi
+  802c0d:	0f 49 cb             	cmovns %ebx,%ecx
+  802c10:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802c14:	89 0c 24             	mov    %ecx,(%esp)
+  802c17:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c1c:	89 cd                	mov    %ecx,%ebp
+  802c1e:	66 90                	xchg   %ax,%ax
+  802c20:	89 e9                	mov    %ebp,%ecx
+  802c22:	89 c3                	mov    %eax,%ebx
+  802c24:	89 d6                	mov    %edx,%esi
+  802c26:	31 ff                	xor    %edi,%edi
+  802c28:	d3 ee                	shr    %cl,%esi
+  802c2a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802c2d:	f6 c1 20             	test   $0x20,%cl
+  802c30:	0f 45 de             	cmovne %esi,%ebx
+  802c33:	0f 45 f7             	cmovne %edi,%esi
+  802c36:	8b 3c 24             	mov    (%esp),%edi
+  802c39:	39 fb                	cmp    %edi,%ebx
+  802c3b:	89 f7                	mov    %esi,%edi
+  802c3d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c41:	8b 1c 24             	mov    (%esp),%ebx
+  802c44:	19 f7                	sbb    %esi,%edi
+  802c46:	72 1a                	jb     802c62 <__moddi3+0x92>
+  802c48:	89 e9                	mov    %ebp,%ecx
+  802c4a:	89 f7                	mov    %esi,%edi
+  802c4c:	89 de                	mov    %ebx,%esi
+  802c4e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802c51:	d3 e6                	shl    %cl,%esi
+  802c53:	31 db                	xor    %ebx,%ebx
+  802c55:	f6 c1 20             	test   $0x20,%cl
+  802c58:	0f 45 fe             	cmovne %esi,%edi
+  802c5b:	0f 45 f3             	cmovne %ebx,%esi
+  802c5e:	29 f0                	sub    %esi,%eax
+  802c60:	19 fa                	sbb    %edi,%edx
+  802c62:	83 ed 01             	sub    $0x1,%ebp
+  802c65:	73 b9                	jae    802c20 <__moddi3+0x50>
+  802c67:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802c6b:	85 ed                	test   %ebp,%ebp
+  802c6d:	74 07                	je     802c76 <__moddi3+0xa6>
+  802c6f:	f7 d8                	neg    %eax
+  802c71:	83 d2 00             	adc    $0x0,%edx
+  802c74:	f7 da                	neg    %edx
+  802c76:	83 c4 14             	add    $0x14,%esp
+  802c79:	5b                   	pop    %ebx
+  802c7a:	5e                   	pop    %esi
+  802c7b:	5f                   	pop    %edi
+  802c7c:	5d                   	pop    %ebp
+  802c7d:	c3                   	ret
+  802c7e:	83 c4 14             	add    $0x14,%esp
+  802c81:	31 c0                	xor    %eax,%eax
+  802c83:	31 d2                	xor    %edx,%edx
+  802c85:	5b                   	pop    %ebx
+  802c86:	5e                   	pop    %esi
+  802c87:	5f                   	pop    %edi
+  802c88:	5d                   	pop    %ebp
+  802c89:	c3                   	ret
+  802c8a:	89 f7                	mov    %esi,%edi
+  802c8c:	09 cf                	or     %ecx,%edi
+  802c8e:	74 11                	je     802ca1 <__moddi3+0xd1>
+  802c90:	f7 d8                	neg    %eax
+  802c92:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802c97:	83 d2 00             	adc    $0x0,%edx
+  802c9a:	f7 da                	neg    %edx
+  802c9c:	e9 5a ff ff ff       	jmp    802bfb <__moddi3+0x2b>
+  802ca1:	31 c0                	xor    %eax,%eax
+  802ca3:	31 d2                	xor    %edx,%edx
+  802ca5:	eb c8                	jmp    802c6f <__moddi3+0x9f>
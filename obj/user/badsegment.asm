@@ -0,0 +1,5557 @@
+
+obj/user/badsegment.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 09 00 00 00       	call   80003a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+	// Try to load the kernel's TSS selector into the DS register.
+	asm volatile("movw $0x28,%ax; movw %ax,%ds");
+  800033:	66 b8 28 00          	mov    $0x28,%ax
+  800037:	8e d8                	mov    %eax,%ds
+}
+  800039:	c3                   	ret
+
+0080003a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003a:	55                   	push   %ebp
+  80003b:	89 e5                	mov    %esp,%ebp
+  80003d:	56                   	push   %esi
+  80003e:	53                   	push   %ebx
+  80003f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800042:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800045:	e8 ee 00 00 00       	call   800138 <sys_getenvid>
+  80004a:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80004f:	c1 e0 09             	shl    $0x9,%eax
+  800052:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800057:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005c:	85 db                	test   %ebx,%ebx
+  80005e:	7e 07                	jle    800067 <libmain+0x2d>
+		binaryname = argv[0];
+  800060:	8b 06                	mov    (%esi),%eax
+  800062:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800067:	83 ec 08             	sub    $0x8,%esp
+  80006a:	56                   	push   %esi
+  80006b:	53                   	push   %ebx
+  80006c:	e8 c2 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800071:	e8 0a 00 00 00       	call   800080 <exit>
+}
+  800076:	83 c4 10             	add    $0x10,%esp
+  800079:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007c:	5b                   	pop    %ebx
+  80007d:	5e                   	pop    %esi
+  80007e:	5d                   	pop    %ebp
+  80007f:	c3                   	ret
+
+00800080 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800086:	e8 45 07 00 00       	call   8007d0 <close_all>
+	sys_env_destroy(0);
+  80008b:	83 ec 0c             	sub    $0xc,%esp
+  80008e:	6a 00                	push   $0x0
+  800090:	e8 62 00 00 00       	call   8000f7 <sys_env_destroy>
+}
+  800095:	83 c4 10             	add    $0x10,%esp
+  800098:	c9                   	leave
+  800099:	c3                   	ret
+
+0080009a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	57                   	push   %edi
+  80009e:	56                   	push   %esi
+  80009f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000ab:	89 c3                	mov    %eax,%ebx
+  8000ad:	89 c7                	mov    %eax,%edi
+  8000af:	89 c6                	mov    %eax,%esi
+  8000b1:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000b3:	5b                   	pop    %ebx
+  8000b4:	5e                   	pop    %esi
+  8000b5:	5f                   	pop    %edi
+  8000b6:	5d                   	pop    %ebp
+  8000b7:	c3                   	ret
+
+008000b8 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000b8:	55                   	push   %ebp
+  8000b9:	89 e5                	mov    %esp,%ebp
+  8000bb:	57                   	push   %edi
+  8000bc:	56                   	push   %esi
+  8000bd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000c8:	89 d1                	mov    %edx,%ecx
+  8000ca:	89 d3                	mov    %edx,%ebx
+  8000cc:	89 d7                	mov    %edx,%edi
+  8000ce:	89 d6                	mov    %edx,%esi
+  8000d0:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000d2:	5b                   	pop    %ebx
+  8000d3:	5e                   	pop    %esi
+  8000d4:	5f                   	pop    %edi
+  8000d5:	5d                   	pop    %ebp
+  8000d6:	c3                   	ret
+
+008000d7 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8000d7:	55                   	push   %ebp
+  8000d8:	89 e5                	mov    %esp,%ebp
+  8000da:	57                   	push   %edi
+  8000db:	56                   	push   %esi
+  8000dc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8000ea:	89 cb                	mov    %ecx,%ebx
+  8000ec:	89 cf                	mov    %ecx,%edi
+  8000ee:	89 ce                	mov    %ecx,%esi
+  8000f0:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  8000f2:	5b                   	pop    %ebx
+  8000f3:	5e                   	pop    %esi
+  8000f4:	5f                   	pop    %edi
+  8000f5:	5d                   	pop    %ebp
+  8000f6:	c3                   	ret
+
+008000f7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000f7:	55                   	push   %ebp
+  8000f8:	89 e5                	mov    %esp,%ebp
+  8000fa:	57                   	push   %edi
+  8000fb:	56                   	push   %esi
+  8000fc:	53                   	push   %ebx
+  8000fd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800100:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800105:	8b 55 08             	mov    0x8(%ebp),%edx
+  800108:	b8 03 00 00 00       	mov    $0x3,%eax
+  80010d:	89 cb                	mov    %ecx,%ebx
+  80010f:	89 cf                	mov    %ecx,%edi
+  800111:	89 ce                	mov    %ecx,%esi
+  800113:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800115:	85 c0                	test   %eax,%eax
+  800117:	7f 08                	jg     800121 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800119:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80011c:	5b                   	pop    %ebx
+  80011d:	5e                   	pop    %esi
+  80011e:	5f                   	pop    %edi
+  80011f:	5d                   	pop    %ebp
+  800120:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800121:	83 ec 0c             	sub    $0xc,%esp
+  800124:	50                   	push   %eax
+  800125:	6a 03                	push   $0x3
+  800127:	68 8a 26 80 00       	push   $0x80268a
+  80012c:	6a 23                	push   $0x23
+  80012e:	68 a7 26 80 00       	push   $0x8026a7
+  800133:	e8 d5 15 00 00       	call   80170d <_panic>
+
+00800138 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800138:	55                   	push   %ebp
+  800139:	89 e5                	mov    %esp,%ebp
+  80013b:	57                   	push   %edi
+  80013c:	56                   	push   %esi
+  80013d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80013e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800143:	b8 02 00 00 00       	mov    $0x2,%eax
+  800148:	89 d1                	mov    %edx,%ecx
+  80014a:	89 d3                	mov    %edx,%ebx
+  80014c:	89 d7                	mov    %edx,%edi
+  80014e:	89 d6                	mov    %edx,%esi
+  800150:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800152:	5b                   	pop    %ebx
+  800153:	5e                   	pop    %esi
+  800154:	5f                   	pop    %edi
+  800155:	5d                   	pop    %ebp
+  800156:	c3                   	ret
+
+00800157 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800157:	55                   	push   %ebp
+  800158:	89 e5                	mov    %esp,%ebp
+  80015a:	57                   	push   %edi
+  80015b:	56                   	push   %esi
+  80015c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80015d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800162:	b8 16 00 00 00       	mov    $0x16,%eax
+  800167:	89 d1                	mov    %edx,%ecx
+  800169:	89 d3                	mov    %edx,%ebx
+  80016b:	89 d7                	mov    %edx,%edi
+  80016d:	89 d6                	mov    %edx,%esi
+  80016f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800171:	5b                   	pop    %ebx
+  800172:	5e                   	pop    %esi
+  800173:	5f                   	pop    %edi
+  800174:	5d                   	pop    %ebp
+  800175:	c3                   	ret
+
+00800176 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800176:	55                   	push   %ebp
+  800177:	89 e5                	mov    %esp,%ebp
+  800179:	57                   	push   %edi
+  80017a:	56                   	push   %esi
+  80017b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80017c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800181:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800186:	89 d1                	mov    %edx,%ecx
+  800188:	89 d3                	mov    %edx,%ebx
+  80018a:	89 d7                	mov    %edx,%edi
+  80018c:	89 d6                	mov    %edx,%esi
+  80018e:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800190:	5b                   	pop    %ebx
+  800191:	5e                   	pop    %esi
+  800192:	5f                   	pop    %edi
+  800193:	5d                   	pop    %ebp
+  800194:	c3                   	ret
+
+00800195 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800195:	55                   	push   %ebp
+  800196:	89 e5                	mov    %esp,%ebp
+  800198:	57                   	push   %edi
+  800199:	56                   	push   %esi
+  80019a:	53                   	push   %ebx
+  80019b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80019e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001a9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8001ae:	89 df                	mov    %ebx,%edi
+  8001b0:	89 de                	mov    %ebx,%esi
+  8001b2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001b4:	85 c0                	test   %eax,%eax
+  8001b6:	7f 08                	jg     8001c0 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  8001b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001bb:	5b                   	pop    %ebx
+  8001bc:	5e                   	pop    %esi
+  8001bd:	5f                   	pop    %edi
+  8001be:	5d                   	pop    %ebp
+  8001bf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001c0:	83 ec 0c             	sub    $0xc,%esp
+  8001c3:	50                   	push   %eax
+  8001c4:	6a 15                	push   $0x15
+  8001c6:	68 8a 26 80 00       	push   $0x80268a
+  8001cb:	6a 23                	push   $0x23
+  8001cd:	68 a7 26 80 00       	push   $0x8026a7
+  8001d2:	e8 36 15 00 00       	call   80170d <_panic>
+
+008001d7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	57                   	push   %edi
+  8001db:	56                   	push   %esi
+  8001dc:	53                   	push   %ebx
+  8001dd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001eb:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001f3:	89 f7                	mov    %esi,%edi
+  8001f5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001f7:	85 c0                	test   %eax,%eax
+  8001f9:	7f 08                	jg     800203 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fe:	5b                   	pop    %ebx
+  8001ff:	5e                   	pop    %esi
+  800200:	5f                   	pop    %edi
+  800201:	5d                   	pop    %ebp
+  800202:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800203:	83 ec 0c             	sub    $0xc,%esp
+  800206:	50                   	push   %eax
+  800207:	6a 05                	push   $0x5
+  800209:	68 8a 26 80 00       	push   $0x80268a
+  80020e:	6a 23                	push   $0x23
+  800210:	68 a7 26 80 00       	push   $0x8026a7
+  800215:	e8 f3 14 00 00       	call   80170d <_panic>
+
+0080021a <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  80021a:	55                   	push   %ebp
+  80021b:	89 e5                	mov    %esp,%ebp
+  80021d:	57                   	push   %edi
+  80021e:	56                   	push   %esi
+  80021f:	53                   	push   %ebx
+  800220:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800223:	be 00 00 00 00       	mov    $0x0,%esi
+  800228:	8b 55 08             	mov    0x8(%ebp),%edx
+  80022b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800233:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800236:	89 f7                	mov    %esi,%edi
+  800238:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80023a:	85 c0                	test   %eax,%eax
+  80023c:	7f 08                	jg     800246 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80023e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800241:	5b                   	pop    %ebx
+  800242:	5e                   	pop    %esi
+  800243:	5f                   	pop    %edi
+  800244:	5d                   	pop    %ebp
+  800245:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800246:	83 ec 0c             	sub    $0xc,%esp
+  800249:	50                   	push   %eax
+  80024a:	6a 06                	push   $0x6
+  80024c:	68 8a 26 80 00       	push   $0x80268a
+  800251:	6a 23                	push   $0x23
+  800253:	68 a7 26 80 00       	push   $0x8026a7
+  800258:	e8 b0 14 00 00       	call   80170d <_panic>
+
+0080025d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80025d:	55                   	push   %ebp
+  80025e:	89 e5                	mov    %esp,%ebp
+  800260:	57                   	push   %edi
+  800261:	56                   	push   %esi
+  800262:	53                   	push   %ebx
+  800263:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800266:	8b 55 08             	mov    0x8(%ebp),%edx
+  800269:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80026c:	b8 07 00 00 00       	mov    $0x7,%eax
+  800271:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800274:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800277:	8b 75 18             	mov    0x18(%ebp),%esi
+  80027a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80027c:	85 c0                	test   %eax,%eax
+  80027e:	7f 08                	jg     800288 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800283:	5b                   	pop    %ebx
+  800284:	5e                   	pop    %esi
+  800285:	5f                   	pop    %edi
+  800286:	5d                   	pop    %ebp
+  800287:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800288:	83 ec 0c             	sub    $0xc,%esp
+  80028b:	50                   	push   %eax
+  80028c:	6a 07                	push   $0x7
+  80028e:	68 8a 26 80 00       	push   $0x80268a
+  800293:	6a 23                	push   $0x23
+  800295:	68 a7 26 80 00       	push   $0x8026a7
+  80029a:	e8 6e 14 00 00       	call   80170d <_panic>
+
+0080029f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80029f:	55                   	push   %ebp
+  8002a0:	89 e5                	mov    %esp,%ebp
+  8002a2:	57                   	push   %edi
+  8002a3:	56                   	push   %esi
+  8002a4:	53                   	push   %ebx
+  8002a5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002b3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002b8:	89 df                	mov    %ebx,%edi
+  8002ba:	89 de                	mov    %ebx,%esi
+  8002bc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002be:	85 c0                	test   %eax,%eax
+  8002c0:	7f 08                	jg     8002ca <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c5:	5b                   	pop    %ebx
+  8002c6:	5e                   	pop    %esi
+  8002c7:	5f                   	pop    %edi
+  8002c8:	5d                   	pop    %ebp
+  8002c9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002ca:	83 ec 0c             	sub    $0xc,%esp
+  8002cd:	50                   	push   %eax
+  8002ce:	6a 08                	push   $0x8
+  8002d0:	68 8a 26 80 00       	push   $0x80268a
+  8002d5:	6a 23                	push   $0x23
+  8002d7:	68 a7 26 80 00       	push   $0x8026a7
+  8002dc:	e8 2c 14 00 00       	call   80170d <_panic>
+
+008002e1 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002e1:	55                   	push   %ebp
+  8002e2:	89 e5                	mov    %esp,%ebp
+  8002e4:	57                   	push   %edi
+  8002e5:	56                   	push   %esi
+  8002e6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ed:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002fd:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8002ff:	5b                   	pop    %ebx
+  800300:	5e                   	pop    %esi
+  800301:	5f                   	pop    %edi
+  800302:	5d                   	pop    %ebp
+  800303:	c3                   	ret
+
+00800304 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800304:	55                   	push   %ebp
+  800305:	89 e5                	mov    %esp,%ebp
+  800307:	57                   	push   %edi
+  800308:	56                   	push   %esi
+  800309:	53                   	push   %ebx
+  80030a:	8b 45 18             	mov    0x18(%ebp),%eax
+  80030d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800310:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800315:	77 27                	ja     80033e <sys_page_map_range+0x3a>
+  800317:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80031d:	77 1f                	ja     80033e <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  80031f:	c1 e0 0c             	shl    $0xc,%eax
+  800322:	89 c6                	mov    %eax,%esi
+  800324:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800326:	8b 55 08             	mov    0x8(%ebp),%edx
+  800329:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80032c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800331:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800334:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800337:	cd 30                	int    $0x30
+}
+  800339:	5b                   	pop    %ebx
+  80033a:	5e                   	pop    %esi
+  80033b:	5f                   	pop    %edi
+  80033c:	5d                   	pop    %ebp
+  80033d:	c3                   	ret
+		return -E_INVAL;
+  80033e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800343:	eb f4                	jmp    800339 <sys_page_map_range+0x35>
+
+00800345 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800345:	55                   	push   %ebp
+  800346:	89 e5                	mov    %esp,%ebp
+  800348:	57                   	push   %edi
+  800349:	56                   	push   %esi
+  80034a:	53                   	push   %ebx
+  80034b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80034e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800351:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800354:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800359:	be 00 00 00 00       	mov    $0x0,%esi
+  80035e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800361:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800364:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800366:	85 c0                	test   %eax,%eax
+  800368:	7f 08                	jg     800372 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80036a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80036d:	5b                   	pop    %ebx
+  80036e:	5e                   	pop    %esi
+  80036f:	5f                   	pop    %edi
+  800370:	5d                   	pop    %ebp
+  800371:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800372:	83 ec 0c             	sub    $0xc,%esp
+  800375:	50                   	push   %eax
+  800376:	6a 0c                	push   $0xc
+  800378:	68 8a 26 80 00       	push   $0x80268a
+  80037d:	6a 23                	push   $0x23
+  80037f:	68 a7 26 80 00       	push   $0x8026a7
+  800384:	e8 84 13 00 00       	call   80170d <_panic>
+
+00800389 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800389:	55                   	push   %ebp
+  80038a:	89 e5                	mov    %esp,%ebp
+  80038c:	57                   	push   %edi
+  80038d:	56                   	push   %esi
+  80038e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80038f:	be 00 00 00 00       	mov    $0x0,%esi
+  800394:	8b 55 08             	mov    0x8(%ebp),%edx
+  800397:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80039a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80039f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003a2:	89 f7                	mov    %esi,%edi
+  8003a4:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003a6:	5b                   	pop    %ebx
+  8003a7:	5e                   	pop    %esi
+  8003a8:	5f                   	pop    %edi
+  8003a9:	5d                   	pop    %ebp
+  8003aa:	c3                   	ret
+
+008003ab <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003ab:	55                   	push   %ebp
+  8003ac:	89 e5                	mov    %esp,%ebp
+  8003ae:	57                   	push   %edi
+  8003af:	56                   	push   %esi
+  8003b0:	53                   	push   %ebx
+  8003b1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003bf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003c4:	89 df                	mov    %ebx,%edi
+  8003c6:	89 de                	mov    %ebx,%esi
+  8003c8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003ca:	85 c0                	test   %eax,%eax
+  8003cc:	7f 08                	jg     8003d6 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d1:	5b                   	pop    %ebx
+  8003d2:	5e                   	pop    %esi
+  8003d3:	5f                   	pop    %edi
+  8003d4:	5d                   	pop    %ebp
+  8003d5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003d6:	83 ec 0c             	sub    $0xc,%esp
+  8003d9:	50                   	push   %eax
+  8003da:	6a 0f                	push   $0xf
+  8003dc:	68 8a 26 80 00       	push   $0x80268a
+  8003e1:	6a 23                	push   $0x23
+  8003e3:	68 a7 26 80 00       	push   $0x8026a7
+  8003e8:	e8 20 13 00 00       	call   80170d <_panic>
+
+008003ed <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8003ed:	55                   	push   %ebp
+  8003ee:	89 e5                	mov    %esp,%ebp
+  8003f0:	57                   	push   %edi
+  8003f1:	56                   	push   %esi
+  8003f2:	53                   	push   %ebx
+  8003f3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800401:	b8 10 00 00 00       	mov    $0x10,%eax
+  800406:	89 df                	mov    %ebx,%edi
+  800408:	89 de                	mov    %ebx,%esi
+  80040a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80040c:	85 c0                	test   %eax,%eax
+  80040e:	7f 08                	jg     800418 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800410:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800413:	5b                   	pop    %ebx
+  800414:	5e                   	pop    %esi
+  800415:	5f                   	pop    %edi
+  800416:	5d                   	pop    %ebp
+  800417:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800418:	83 ec 0c             	sub    $0xc,%esp
+  80041b:	50                   	push   %eax
+  80041c:	6a 10                	push   $0x10
+  80041e:	68 8a 26 80 00       	push   $0x80268a
+  800423:	6a 23                	push   $0x23
+  800425:	68 a7 26 80 00       	push   $0x8026a7
+  80042a:	e8 de 12 00 00       	call   80170d <_panic>
+
+0080042f <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80042f:	55                   	push   %ebp
+  800430:	89 e5                	mov    %esp,%ebp
+  800432:	57                   	push   %edi
+  800433:	56                   	push   %esi
+  800434:	53                   	push   %ebx
+  800435:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800438:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80043d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800440:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800443:	b8 11 00 00 00       	mov    $0x11,%eax
+  800448:	89 df                	mov    %ebx,%edi
+  80044a:	89 de                	mov    %ebx,%esi
+  80044c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80044e:	85 c0                	test   %eax,%eax
+  800450:	7f 08                	jg     80045a <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800452:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800455:	5b                   	pop    %ebx
+  800456:	5e                   	pop    %esi
+  800457:	5f                   	pop    %edi
+  800458:	5d                   	pop    %ebp
+  800459:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80045a:	83 ec 0c             	sub    $0xc,%esp
+  80045d:	50                   	push   %eax
+  80045e:	6a 11                	push   $0x11
+  800460:	68 8a 26 80 00       	push   $0x80268a
+  800465:	6a 23                	push   $0x23
+  800467:	68 a7 26 80 00       	push   $0x8026a7
+  80046c:	e8 9c 12 00 00       	call   80170d <_panic>
+
+00800471 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800471:	55                   	push   %ebp
+  800472:	89 e5                	mov    %esp,%ebp
+  800474:	57                   	push   %edi
+  800475:	56                   	push   %esi
+  800476:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800477:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047c:	b8 12 00 00 00       	mov    $0x12,%eax
+  800481:	89 d1                	mov    %edx,%ecx
+  800483:	89 d3                	mov    %edx,%ebx
+  800485:	89 d7                	mov    %edx,%edi
+  800487:	89 d6                	mov    %edx,%esi
+  800489:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  80048b:	5b                   	pop    %ebx
+  80048c:	5e                   	pop    %esi
+  80048d:	5f                   	pop    %edi
+  80048e:	5d                   	pop    %ebp
+  80048f:	c3                   	ret
+
+00800490 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800490:	55                   	push   %ebp
+  800491:	89 e5                	mov    %esp,%ebp
+  800493:	57                   	push   %edi
+  800494:	56                   	push   %esi
+  800495:	53                   	push   %ebx
+  800496:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800499:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004a9:	89 df                	mov    %ebx,%edi
+  8004ab:	89 de                	mov    %ebx,%esi
+  8004ad:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004af:	85 c0                	test   %eax,%eax
+  8004b1:	7f 08                	jg     8004bb <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8004b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b6:	5b                   	pop    %ebx
+  8004b7:	5e                   	pop    %esi
+  8004b8:	5f                   	pop    %edi
+  8004b9:	5d                   	pop    %ebp
+  8004ba:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004bb:	83 ec 0c             	sub    $0xc,%esp
+  8004be:	50                   	push   %eax
+  8004bf:	6a 13                	push   $0x13
+  8004c1:	68 8a 26 80 00       	push   $0x80268a
+  8004c6:	6a 23                	push   $0x23
+  8004c8:	68 a7 26 80 00       	push   $0x8026a7
+  8004cd:	e8 3b 12 00 00       	call   80170d <_panic>
+
+008004d2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004d2:	55                   	push   %ebp
+  8004d3:	89 e5                	mov    %esp,%ebp
+  8004d5:	57                   	push   %edi
+  8004d6:	56                   	push   %esi
+  8004d7:	53                   	push   %ebx
+  8004d8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004eb:	89 df                	mov    %ebx,%edi
+  8004ed:	89 de                	mov    %ebx,%esi
+  8004ef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004f1:	85 c0                	test   %eax,%eax
+  8004f3:	7f 08                	jg     8004fd <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8004f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004f8:	5b                   	pop    %ebx
+  8004f9:	5e                   	pop    %esi
+  8004fa:	5f                   	pop    %edi
+  8004fb:	5d                   	pop    %ebp
+  8004fc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004fd:	83 ec 0c             	sub    $0xc,%esp
+  800500:	50                   	push   %eax
+  800501:	6a 14                	push   $0x14
+  800503:	68 8a 26 80 00       	push   $0x80268a
+  800508:	6a 23                	push   $0x23
+  80050a:	68 a7 26 80 00       	push   $0x8026a7
+  80050f:	e8 f9 11 00 00       	call   80170d <_panic>
+
+00800514 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800514:	55                   	push   %ebp
+  800515:	89 e5                	mov    %esp,%ebp
+  800517:	57                   	push   %edi
+  800518:	56                   	push   %esi
+  800519:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80051a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80051d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800520:	b8 17 00 00 00       	mov    $0x17,%eax
+  800525:	be 00 00 00 00       	mov    $0x0,%esi
+  80052a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80052d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800530:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800532:	5b                   	pop    %ebx
+  800533:	5e                   	pop    %esi
+  800534:	5f                   	pop    %edi
+  800535:	5d                   	pop    %ebp
+  800536:	c3                   	ret
+
+00800537 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800537:	55                   	push   %ebp
+  800538:	89 e5                	mov    %esp,%ebp
+  80053a:	57                   	push   %edi
+  80053b:	56                   	push   %esi
+  80053c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80053d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800540:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800543:	b8 18 00 00 00       	mov    $0x18,%eax
+  800548:	be 00 00 00 00       	mov    $0x0,%esi
+  80054d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800550:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800553:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800555:	5b                   	pop    %ebx
+  800556:	5e                   	pop    %esi
+  800557:	5f                   	pop    %edi
+  800558:	5d                   	pop    %ebp
+  800559:	c3                   	ret
+
+0080055a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80055a:	55                   	push   %ebp
+  80055b:	89 e5                	mov    %esp,%ebp
+  80055d:	57                   	push   %edi
+  80055e:	56                   	push   %esi
+  80055f:	53                   	push   %ebx
+  800560:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800563:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800568:	8b 55 08             	mov    0x8(%ebp),%edx
+  80056b:	b8 19 00 00 00       	mov    $0x19,%eax
+  800570:	89 cb                	mov    %ecx,%ebx
+  800572:	89 cf                	mov    %ecx,%edi
+  800574:	89 ce                	mov    %ecx,%esi
+  800576:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800578:	85 c0                	test   %eax,%eax
+  80057a:	7f 08                	jg     800584 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80057c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80057f:	5b                   	pop    %ebx
+  800580:	5e                   	pop    %esi
+  800581:	5f                   	pop    %edi
+  800582:	5d                   	pop    %ebp
+  800583:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800584:	83 ec 0c             	sub    $0xc,%esp
+  800587:	50                   	push   %eax
+  800588:	6a 19                	push   $0x19
+  80058a:	68 8a 26 80 00       	push   $0x80268a
+  80058f:	6a 23                	push   $0x23
+  800591:	68 a7 26 80 00       	push   $0x8026a7
+  800596:	e8 72 11 00 00       	call   80170d <_panic>
+
+0080059b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80059b:	55                   	push   %ebp
+  80059c:	89 e5                	mov    %esp,%ebp
+  80059e:	57                   	push   %edi
+  80059f:	56                   	push   %esi
+  8005a0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005ab:	89 d1                	mov    %edx,%ecx
+  8005ad:	89 d3                	mov    %edx,%ebx
+  8005af:	89 d7                	mov    %edx,%edi
+  8005b1:	89 d6                	mov    %edx,%esi
+  8005b3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8005b5:	5b                   	pop    %ebx
+  8005b6:	5e                   	pop    %esi
+  8005b7:	5f                   	pop    %edi
+  8005b8:	5d                   	pop    %ebp
+  8005b9:	c3                   	ret
+
+008005ba <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8005ba:	55                   	push   %ebp
+  8005bb:	89 e5                	mov    %esp,%ebp
+  8005bd:	57                   	push   %edi
+  8005be:	56                   	push   %esi
+  8005bf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005d0:	89 df                	mov    %ebx,%edi
+  8005d2:	89 de                	mov    %ebx,%esi
+  8005d4:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8005d6:	5b                   	pop    %ebx
+  8005d7:	5e                   	pop    %esi
+  8005d8:	5f                   	pop    %edi
+  8005d9:	5d                   	pop    %ebp
+  8005da:	c3                   	ret
+
+008005db <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8005db:	55                   	push   %ebp
+  8005dc:	89 e5                	mov    %esp,%ebp
+  8005de:	57                   	push   %edi
+  8005df:	56                   	push   %esi
+  8005e0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ec:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005f1:	89 df                	mov    %ebx,%edi
+  8005f3:	89 de                	mov    %ebx,%esi
+  8005f5:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  8005f7:	5b                   	pop    %ebx
+  8005f8:	5e                   	pop    %esi
+  8005f9:	5f                   	pop    %edi
+  8005fa:	5d                   	pop    %ebp
+  8005fb:	c3                   	ret
+
+008005fc <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8005fc:	55                   	push   %ebp
+  8005fd:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8005ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800602:	05 00 00 00 30       	add    $0x30000000,%eax
+  800607:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80060a:	5d                   	pop    %ebp
+  80060b:	c3                   	ret
+
+0080060c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80060c:	55                   	push   %ebp
+  80060d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80060f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800612:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800617:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80061c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800621:	5d                   	pop    %ebp
+  800622:	c3                   	ret
+
+00800623 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800623:	55                   	push   %ebp
+  800624:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800626:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80062b:	eb 02                	jmp    80062f <fd_alloc+0xc>
+  80062d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80062f:	89 c2                	mov    %eax,%edx
+  800631:	c1 ea 16             	shr    $0x16,%edx
+  800634:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80063b:	f6 c2 01             	test   $0x1,%dl
+  80063e:	74 2b                	je     80066b <fd_alloc+0x48>
+  800640:	89 c2                	mov    %eax,%edx
+  800642:	c1 ea 0c             	shr    $0xc,%edx
+  800645:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80064c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800652:	f6 c1 01             	test   $0x1,%cl
+  800655:	74 14                	je     80066b <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800657:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80065d:	75 ce                	jne    80062d <fd_alloc+0xa>
+  80065f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800664:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800669:	eb 05                	jmp    800670 <fd_alloc+0x4d>
+			return 0;
+  80066b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800670:	8b 55 08             	mov    0x8(%ebp),%edx
+  800673:	89 02                	mov    %eax,(%edx)
+}
+  800675:	89 c8                	mov    %ecx,%eax
+  800677:	5d                   	pop    %ebp
+  800678:	c3                   	ret
+
+00800679 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800679:	55                   	push   %ebp
+  80067a:	89 e5                	mov    %esp,%ebp
+  80067c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80067f:	83 f8 1f             	cmp    $0x1f,%eax
+  800682:	77 30                	ja     8006b4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800684:	c1 e0 0c             	shl    $0xc,%eax
+  800687:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80068c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800692:	f6 c2 01             	test   $0x1,%dl
+  800695:	74 24                	je     8006bb <fd_lookup+0x42>
+  800697:	89 c2                	mov    %eax,%edx
+  800699:	c1 ea 0c             	shr    $0xc,%edx
+  80069c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006a3:	f6 c2 01             	test   $0x1,%dl
+  8006a6:	74 1a                	je     8006c2 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006ab:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006b2:	5d                   	pop    %ebp
+  8006b3:	c3                   	ret
+		return -E_INVAL;
+  8006b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006b9:	eb f7                	jmp    8006b2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8006bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c0:	eb f0                	jmp    8006b2 <fd_lookup+0x39>
+  8006c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c7:	eb e9                	jmp    8006b2 <fd_lookup+0x39>
+
+008006c9 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006c9:	55                   	push   %ebp
+  8006ca:	89 e5                	mov    %esp,%ebp
+  8006cc:	53                   	push   %ebx
+  8006cd:	83 ec 04             	sub    $0x4,%esp
+  8006d0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d8:	eb 03                	jmp    8006dd <dev_lookup+0x14>
+  8006da:	83 c0 01             	add    $0x1,%eax
+  8006dd:	8b 1c 85 34 27 80 00 	mov    0x802734(,%eax,4),%ebx
+  8006e4:	85 db                	test   %ebx,%ebx
+  8006e6:	74 0b                	je     8006f3 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8006e8:	39 13                	cmp    %edx,(%ebx)
+  8006ea:	75 ee                	jne    8006da <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8006ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f1:	eb 1f                	jmp    800712 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8006f3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8006f8:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8006fb:	83 ec 04             	sub    $0x4,%esp
+  8006fe:	52                   	push   %edx
+  8006ff:	50                   	push   %eax
+  800700:	68 b8 26 80 00       	push   $0x8026b8
+  800705:	e8 de 10 00 00       	call   8017e8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80070a:	83 c4 10             	add    $0x10,%esp
+  80070d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800712:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800715:	89 1a                	mov    %ebx,(%edx)
+}
+  800717:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80071a:	c9                   	leave
+  80071b:	c3                   	ret
+
+0080071c <fd_close>:
+{
+  80071c:	55                   	push   %ebp
+  80071d:	89 e5                	mov    %esp,%ebp
+  80071f:	57                   	push   %edi
+  800720:	56                   	push   %esi
+  800721:	53                   	push   %ebx
+  800722:	83 ec 24             	sub    $0x24,%esp
+  800725:	8b 75 08             	mov    0x8(%ebp),%esi
+  800728:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80072b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80072e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80072f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800735:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800738:	50                   	push   %eax
+  800739:	e8 3b ff ff ff       	call   800679 <fd_lookup>
+  80073e:	89 c3                	mov    %eax,%ebx
+  800740:	83 c4 10             	add    $0x10,%esp
+  800743:	85 c0                	test   %eax,%eax
+  800745:	78 05                	js     80074c <fd_close+0x30>
+	    || fd != fd2)
+  800747:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80074a:	74 16                	je     800762 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80074c:	89 f8                	mov    %edi,%eax
+  80074e:	84 c0                	test   %al,%al
+  800750:	b8 00 00 00 00       	mov    $0x0,%eax
+  800755:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800758:	89 d8                	mov    %ebx,%eax
+  80075a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80075d:	5b                   	pop    %ebx
+  80075e:	5e                   	pop    %esi
+  80075f:	5f                   	pop    %edi
+  800760:	5d                   	pop    %ebp
+  800761:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800762:	83 ec 08             	sub    $0x8,%esp
+  800765:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800768:	50                   	push   %eax
+  800769:	ff 36                	push   (%esi)
+  80076b:	e8 59 ff ff ff       	call   8006c9 <dev_lookup>
+  800770:	89 c3                	mov    %eax,%ebx
+  800772:	83 c4 10             	add    $0x10,%esp
+  800775:	85 c0                	test   %eax,%eax
+  800777:	78 1a                	js     800793 <fd_close+0x77>
+		if (dev->dev_close)
+  800779:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80077c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80077f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800784:	85 c0                	test   %eax,%eax
+  800786:	74 0b                	je     800793 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800788:	83 ec 0c             	sub    $0xc,%esp
+  80078b:	56                   	push   %esi
+  80078c:	ff d0                	call   *%eax
+  80078e:	89 c3                	mov    %eax,%ebx
+  800790:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800793:	83 ec 08             	sub    $0x8,%esp
+  800796:	56                   	push   %esi
+  800797:	6a 00                	push   $0x0
+  800799:	e8 01 fb ff ff       	call   80029f <sys_page_unmap>
+	return r;
+  80079e:	83 c4 10             	add    $0x10,%esp
+  8007a1:	eb b5                	jmp    800758 <fd_close+0x3c>
+
+008007a3 <close>:
+
+int
+close(int fdnum)
+{
+  8007a3:	55                   	push   %ebp
+  8007a4:	89 e5                	mov    %esp,%ebp
+  8007a6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007ac:	50                   	push   %eax
+  8007ad:	ff 75 08             	push   0x8(%ebp)
+  8007b0:	e8 c4 fe ff ff       	call   800679 <fd_lookup>
+  8007b5:	83 c4 10             	add    $0x10,%esp
+  8007b8:	85 c0                	test   %eax,%eax
+  8007ba:	79 02                	jns    8007be <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007bc:	c9                   	leave
+  8007bd:	c3                   	ret
+		return fd_close(fd, 1);
+  8007be:	83 ec 08             	sub    $0x8,%esp
+  8007c1:	6a 01                	push   $0x1
+  8007c3:	ff 75 f4             	push   -0xc(%ebp)
+  8007c6:	e8 51 ff ff ff       	call   80071c <fd_close>
+  8007cb:	83 c4 10             	add    $0x10,%esp
+  8007ce:	eb ec                	jmp    8007bc <close+0x19>
+
+008007d0 <close_all>:
+
+void
+close_all(void)
+{
+  8007d0:	55                   	push   %ebp
+  8007d1:	89 e5                	mov    %esp,%ebp
+  8007d3:	53                   	push   %ebx
+  8007d4:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8007d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8007dc:	83 ec 0c             	sub    $0xc,%esp
+  8007df:	53                   	push   %ebx
+  8007e0:	e8 be ff ff ff       	call   8007a3 <close>
+	for (i = 0; i < MAXFD; i++)
+  8007e5:	83 c3 01             	add    $0x1,%ebx
+  8007e8:	83 c4 10             	add    $0x10,%esp
+  8007eb:	83 fb 20             	cmp    $0x20,%ebx
+  8007ee:	75 ec                	jne    8007dc <close_all+0xc>
+}
+  8007f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f3:	c9                   	leave
+  8007f4:	c3                   	ret
+
+008007f5 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8007f5:	55                   	push   %ebp
+  8007f6:	89 e5                	mov    %esp,%ebp
+  8007f8:	57                   	push   %edi
+  8007f9:	56                   	push   %esi
+  8007fa:	53                   	push   %ebx
+  8007fb:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8007fe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800801:	50                   	push   %eax
+  800802:	ff 75 08             	push   0x8(%ebp)
+  800805:	e8 6f fe ff ff       	call   800679 <fd_lookup>
+  80080a:	89 c3                	mov    %eax,%ebx
+  80080c:	83 c4 10             	add    $0x10,%esp
+  80080f:	85 c0                	test   %eax,%eax
+  800811:	78 7f                	js     800892 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800813:	83 ec 0c             	sub    $0xc,%esp
+  800816:	ff 75 0c             	push   0xc(%ebp)
+  800819:	e8 85 ff ff ff       	call   8007a3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80081e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800821:	c1 e6 0c             	shl    $0xc,%esi
+  800824:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80082a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80082d:	89 3c 24             	mov    %edi,(%esp)
+  800830:	e8 d7 fd ff ff       	call   80060c <fd2data>
+  800835:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800837:	89 34 24             	mov    %esi,(%esp)
+  80083a:	e8 cd fd ff ff       	call   80060c <fd2data>
+  80083f:	83 c4 10             	add    $0x10,%esp
+  800842:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800845:	89 d8                	mov    %ebx,%eax
+  800847:	c1 e8 16             	shr    $0x16,%eax
+  80084a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800851:	a8 01                	test   $0x1,%al
+  800853:	74 11                	je     800866 <dup+0x71>
+  800855:	89 d8                	mov    %ebx,%eax
+  800857:	c1 e8 0c             	shr    $0xc,%eax
+  80085a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800861:	f6 c2 01             	test   $0x1,%dl
+  800864:	75 36                	jne    80089c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800866:	89 f8                	mov    %edi,%eax
+  800868:	c1 e8 0c             	shr    $0xc,%eax
+  80086b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800872:	83 ec 0c             	sub    $0xc,%esp
+  800875:	25 07 0e 00 00       	and    $0xe07,%eax
+  80087a:	50                   	push   %eax
+  80087b:	56                   	push   %esi
+  80087c:	6a 00                	push   $0x0
+  80087e:	57                   	push   %edi
+  80087f:	6a 00                	push   $0x0
+  800881:	e8 d7 f9 ff ff       	call   80025d <sys_page_map>
+  800886:	89 c3                	mov    %eax,%ebx
+  800888:	83 c4 20             	add    $0x20,%esp
+  80088b:	85 c0                	test   %eax,%eax
+  80088d:	78 33                	js     8008c2 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80088f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800892:	89 d8                	mov    %ebx,%eax
+  800894:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800897:	5b                   	pop    %ebx
+  800898:	5e                   	pop    %esi
+  800899:	5f                   	pop    %edi
+  80089a:	5d                   	pop    %ebp
+  80089b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80089c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008a3:	83 ec 0c             	sub    $0xc,%esp
+  8008a6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008ab:	50                   	push   %eax
+  8008ac:	ff 75 d4             	push   -0x2c(%ebp)
+  8008af:	6a 00                	push   $0x0
+  8008b1:	53                   	push   %ebx
+  8008b2:	6a 00                	push   $0x0
+  8008b4:	e8 a4 f9 ff ff       	call   80025d <sys_page_map>
+  8008b9:	89 c3                	mov    %eax,%ebx
+  8008bb:	83 c4 20             	add    $0x20,%esp
+  8008be:	85 c0                	test   %eax,%eax
+  8008c0:	79 a4                	jns    800866 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008c2:	83 ec 08             	sub    $0x8,%esp
+  8008c5:	56                   	push   %esi
+  8008c6:	6a 00                	push   $0x0
+  8008c8:	e8 d2 f9 ff ff       	call   80029f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008cd:	83 c4 08             	add    $0x8,%esp
+  8008d0:	ff 75 d4             	push   -0x2c(%ebp)
+  8008d3:	6a 00                	push   $0x0
+  8008d5:	e8 c5 f9 ff ff       	call   80029f <sys_page_unmap>
+	return r;
+  8008da:	83 c4 10             	add    $0x10,%esp
+  8008dd:	eb b3                	jmp    800892 <dup+0x9d>
+
+008008df <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	56                   	push   %esi
+  8008e3:	53                   	push   %ebx
+  8008e4:	83 ec 18             	sub    $0x18,%esp
+  8008e7:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008ea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8008ed:	50                   	push   %eax
+  8008ee:	56                   	push   %esi
+  8008ef:	e8 85 fd ff ff       	call   800679 <fd_lookup>
+  8008f4:	83 c4 10             	add    $0x10,%esp
+  8008f7:	85 c0                	test   %eax,%eax
+  8008f9:	78 3c                	js     800937 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008fb:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8008fe:	83 ec 08             	sub    $0x8,%esp
+  800901:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800904:	50                   	push   %eax
+  800905:	ff 33                	push   (%ebx)
+  800907:	e8 bd fd ff ff       	call   8006c9 <dev_lookup>
+  80090c:	83 c4 10             	add    $0x10,%esp
+  80090f:	85 c0                	test   %eax,%eax
+  800911:	78 24                	js     800937 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800913:	8b 43 08             	mov    0x8(%ebx),%eax
+  800916:	83 e0 03             	and    $0x3,%eax
+  800919:	83 f8 01             	cmp    $0x1,%eax
+  80091c:	74 20                	je     80093e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80091e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800921:	8b 40 08             	mov    0x8(%eax),%eax
+  800924:	85 c0                	test   %eax,%eax
+  800926:	74 37                	je     80095f <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800928:	83 ec 04             	sub    $0x4,%esp
+  80092b:	ff 75 10             	push   0x10(%ebp)
+  80092e:	ff 75 0c             	push   0xc(%ebp)
+  800931:	53                   	push   %ebx
+  800932:	ff d0                	call   *%eax
+  800934:	83 c4 10             	add    $0x10,%esp
+}
+  800937:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80093a:	5b                   	pop    %ebx
+  80093b:	5e                   	pop    %esi
+  80093c:	5d                   	pop    %ebp
+  80093d:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80093e:	a1 08 40 80 00       	mov    0x804008,%eax
+  800943:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800946:	83 ec 04             	sub    $0x4,%esp
+  800949:	56                   	push   %esi
+  80094a:	50                   	push   %eax
+  80094b:	68 f9 26 80 00       	push   $0x8026f9
+  800950:	e8 93 0e 00 00       	call   8017e8 <cprintf>
+		return -E_INVAL;
+  800955:	83 c4 10             	add    $0x10,%esp
+  800958:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80095d:	eb d8                	jmp    800937 <read+0x58>
+		return -E_NOT_SUPP;
+  80095f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800964:	eb d1                	jmp    800937 <read+0x58>
+
+00800966 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800966:	55                   	push   %ebp
+  800967:	89 e5                	mov    %esp,%ebp
+  800969:	57                   	push   %edi
+  80096a:	56                   	push   %esi
+  80096b:	53                   	push   %ebx
+  80096c:	83 ec 0c             	sub    $0xc,%esp
+  80096f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800972:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800975:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80097a:	eb 02                	jmp    80097e <readn+0x18>
+  80097c:	01 c3                	add    %eax,%ebx
+  80097e:	39 f3                	cmp    %esi,%ebx
+  800980:	73 21                	jae    8009a3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800982:	83 ec 04             	sub    $0x4,%esp
+  800985:	89 f0                	mov    %esi,%eax
+  800987:	29 d8                	sub    %ebx,%eax
+  800989:	50                   	push   %eax
+  80098a:	89 d8                	mov    %ebx,%eax
+  80098c:	03 45 0c             	add    0xc(%ebp),%eax
+  80098f:	50                   	push   %eax
+  800990:	57                   	push   %edi
+  800991:	e8 49 ff ff ff       	call   8008df <read>
+		if (m < 0)
+  800996:	83 c4 10             	add    $0x10,%esp
+  800999:	85 c0                	test   %eax,%eax
+  80099b:	78 04                	js     8009a1 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80099d:	75 dd                	jne    80097c <readn+0x16>
+  80099f:	eb 02                	jmp    8009a3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009a1:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8009a3:	89 d8                	mov    %ebx,%eax
+  8009a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009a8:	5b                   	pop    %ebx
+  8009a9:	5e                   	pop    %esi
+  8009aa:	5f                   	pop    %edi
+  8009ab:	5d                   	pop    %ebp
+  8009ac:	c3                   	ret
+
+008009ad <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009ad:	55                   	push   %ebp
+  8009ae:	89 e5                	mov    %esp,%ebp
+  8009b0:	56                   	push   %esi
+  8009b1:	53                   	push   %ebx
+  8009b2:	83 ec 18             	sub    $0x18,%esp
+  8009b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009b8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009bb:	50                   	push   %eax
+  8009bc:	53                   	push   %ebx
+  8009bd:	e8 b7 fc ff ff       	call   800679 <fd_lookup>
+  8009c2:	83 c4 10             	add    $0x10,%esp
+  8009c5:	85 c0                	test   %eax,%eax
+  8009c7:	78 37                	js     800a00 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009c9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009cc:	83 ec 08             	sub    $0x8,%esp
+  8009cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009d2:	50                   	push   %eax
+  8009d3:	ff 36                	push   (%esi)
+  8009d5:	e8 ef fc ff ff       	call   8006c9 <dev_lookup>
+  8009da:	83 c4 10             	add    $0x10,%esp
+  8009dd:	85 c0                	test   %eax,%eax
+  8009df:	78 1f                	js     800a00 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8009e1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8009e5:	74 20                	je     800a07 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8009e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009ea:	8b 40 0c             	mov    0xc(%eax),%eax
+  8009ed:	85 c0                	test   %eax,%eax
+  8009ef:	74 37                	je     800a28 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8009f1:	83 ec 04             	sub    $0x4,%esp
+  8009f4:	ff 75 10             	push   0x10(%ebp)
+  8009f7:	ff 75 0c             	push   0xc(%ebp)
+  8009fa:	56                   	push   %esi
+  8009fb:	ff d0                	call   *%eax
+  8009fd:	83 c4 10             	add    $0x10,%esp
+}
+  800a00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a03:	5b                   	pop    %ebx
+  800a04:	5e                   	pop    %esi
+  800a05:	5d                   	pop    %ebp
+  800a06:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a07:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a0c:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800a0f:	83 ec 04             	sub    $0x4,%esp
+  800a12:	53                   	push   %ebx
+  800a13:	50                   	push   %eax
+  800a14:	68 15 27 80 00       	push   $0x802715
+  800a19:	e8 ca 0d 00 00       	call   8017e8 <cprintf>
+		return -E_INVAL;
+  800a1e:	83 c4 10             	add    $0x10,%esp
+  800a21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a26:	eb d8                	jmp    800a00 <write+0x53>
+		return -E_NOT_SUPP;
+  800a28:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a2d:	eb d1                	jmp    800a00 <write+0x53>
+
+00800a2f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a38:	50                   	push   %eax
+  800a39:	ff 75 08             	push   0x8(%ebp)
+  800a3c:	e8 38 fc ff ff       	call   800679 <fd_lookup>
+  800a41:	83 c4 10             	add    $0x10,%esp
+  800a44:	85 c0                	test   %eax,%eax
+  800a46:	78 0e                	js     800a56 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800a48:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a4e:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800a51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a56:	c9                   	leave
+  800a57:	c3                   	ret
+
+00800a58 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	56                   	push   %esi
+  800a5c:	53                   	push   %ebx
+  800a5d:	83 ec 18             	sub    $0x18,%esp
+  800a60:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a63:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a66:	50                   	push   %eax
+  800a67:	53                   	push   %ebx
+  800a68:	e8 0c fc ff ff       	call   800679 <fd_lookup>
+  800a6d:	83 c4 10             	add    $0x10,%esp
+  800a70:	85 c0                	test   %eax,%eax
+  800a72:	78 34                	js     800aa8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a74:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a77:	83 ec 08             	sub    $0x8,%esp
+  800a7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a7d:	50                   	push   %eax
+  800a7e:	ff 36                	push   (%esi)
+  800a80:	e8 44 fc ff ff       	call   8006c9 <dev_lookup>
+  800a85:	83 c4 10             	add    $0x10,%esp
+  800a88:	85 c0                	test   %eax,%eax
+  800a8a:	78 1c                	js     800aa8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a8c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a90:	74 1d                	je     800aaf <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800a92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a95:	8b 40 18             	mov    0x18(%eax),%eax
+  800a98:	85 c0                	test   %eax,%eax
+  800a9a:	74 34                	je     800ad0 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800a9c:	83 ec 08             	sub    $0x8,%esp
+  800a9f:	ff 75 0c             	push   0xc(%ebp)
+  800aa2:	56                   	push   %esi
+  800aa3:	ff d0                	call   *%eax
+  800aa5:	83 c4 10             	add    $0x10,%esp
+}
+  800aa8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aab:	5b                   	pop    %ebx
+  800aac:	5e                   	pop    %esi
+  800aad:	5d                   	pop    %ebp
+  800aae:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800aaf:	a1 08 40 80 00       	mov    0x804008,%eax
+  800ab4:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ab7:	83 ec 04             	sub    $0x4,%esp
+  800aba:	53                   	push   %ebx
+  800abb:	50                   	push   %eax
+  800abc:	68 d8 26 80 00       	push   $0x8026d8
+  800ac1:	e8 22 0d 00 00       	call   8017e8 <cprintf>
+		return -E_INVAL;
+  800ac6:	83 c4 10             	add    $0x10,%esp
+  800ac9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ace:	eb d8                	jmp    800aa8 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800ad0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ad5:	eb d1                	jmp    800aa8 <ftruncate+0x50>
+
+00800ad7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	56                   	push   %esi
+  800adb:	53                   	push   %ebx
+  800adc:	83 ec 18             	sub    $0x18,%esp
+  800adf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ae2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ae5:	50                   	push   %eax
+  800ae6:	ff 75 08             	push   0x8(%ebp)
+  800ae9:	e8 8b fb ff ff       	call   800679 <fd_lookup>
+  800aee:	83 c4 10             	add    $0x10,%esp
+  800af1:	85 c0                	test   %eax,%eax
+  800af3:	78 49                	js     800b3e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800af5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800af8:	83 ec 08             	sub    $0x8,%esp
+  800afb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800afe:	50                   	push   %eax
+  800aff:	ff 36                	push   (%esi)
+  800b01:	e8 c3 fb ff ff       	call   8006c9 <dev_lookup>
+  800b06:	83 c4 10             	add    $0x10,%esp
+  800b09:	85 c0                	test   %eax,%eax
+  800b0b:	78 31                	js     800b3e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b10:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b14:	74 2f                	je     800b45 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b16:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b19:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b20:	00 00 00 
+	stat->st_isdir = 0;
+  800b23:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b2a:	00 00 00 
+	stat->st_dev = dev;
+  800b2d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b33:	83 ec 08             	sub    $0x8,%esp
+  800b36:	53                   	push   %ebx
+  800b37:	56                   	push   %esi
+  800b38:	ff 50 14             	call   *0x14(%eax)
+  800b3b:	83 c4 10             	add    $0x10,%esp
+}
+  800b3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b41:	5b                   	pop    %ebx
+  800b42:	5e                   	pop    %esi
+  800b43:	5d                   	pop    %ebp
+  800b44:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b45:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b4a:	eb f2                	jmp    800b3e <fstat+0x67>
+
+00800b4c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b4c:	55                   	push   %ebp
+  800b4d:	89 e5                	mov    %esp,%ebp
+  800b4f:	56                   	push   %esi
+  800b50:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800b51:	83 ec 08             	sub    $0x8,%esp
+  800b54:	6a 00                	push   $0x0
+  800b56:	ff 75 08             	push   0x8(%ebp)
+  800b59:	e8 e4 01 00 00       	call   800d42 <open>
+  800b5e:	89 c3                	mov    %eax,%ebx
+  800b60:	83 c4 10             	add    $0x10,%esp
+  800b63:	85 c0                	test   %eax,%eax
+  800b65:	78 1b                	js     800b82 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800b67:	83 ec 08             	sub    $0x8,%esp
+  800b6a:	ff 75 0c             	push   0xc(%ebp)
+  800b6d:	50                   	push   %eax
+  800b6e:	e8 64 ff ff ff       	call   800ad7 <fstat>
+  800b73:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b75:	89 1c 24             	mov    %ebx,(%esp)
+  800b78:	e8 26 fc ff ff       	call   8007a3 <close>
+	return r;
+  800b7d:	83 c4 10             	add    $0x10,%esp
+  800b80:	89 f3                	mov    %esi,%ebx
+}
+  800b82:	89 d8                	mov    %ebx,%eax
+  800b84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b87:	5b                   	pop    %ebx
+  800b88:	5e                   	pop    %esi
+  800b89:	5d                   	pop    %ebp
+  800b8a:	c3                   	ret
+
+00800b8b <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800b8b:	55                   	push   %ebp
+  800b8c:	89 e5                	mov    %esp,%ebp
+  800b8e:	56                   	push   %esi
+  800b8f:	53                   	push   %ebx
+  800b90:	89 c6                	mov    %eax,%esi
+  800b92:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800b94:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800b9b:	74 27                	je     800bc4 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800b9d:	6a 07                	push   $0x7
+  800b9f:	68 00 50 80 00       	push   $0x805000
+  800ba4:	56                   	push   %esi
+  800ba5:	ff 35 00 40 80 00    	push   0x804000
+  800bab:	e8 ce 15 00 00       	call   80217e <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800bb0:	83 c4 0c             	add    $0xc,%esp
+  800bb3:	6a 00                	push   $0x0
+  800bb5:	53                   	push   %ebx
+  800bb6:	6a 00                	push   $0x0
+  800bb8:	e8 49 15 00 00       	call   802106 <ipc_recv>
+}
+  800bbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bc0:	5b                   	pop    %ebx
+  800bc1:	5e                   	pop    %esi
+  800bc2:	5d                   	pop    %ebp
+  800bc3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bc4:	83 ec 0c             	sub    $0xc,%esp
+  800bc7:	6a 01                	push   $0x1
+  800bc9:	e8 04 16 00 00       	call   8021d2 <ipc_find_env>
+  800bce:	a3 00 40 80 00       	mov    %eax,0x804000
+  800bd3:	83 c4 10             	add    $0x10,%esp
+  800bd6:	eb c5                	jmp    800b9d <fsipc+0x12>
+
+00800bd8 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800bd8:	55                   	push   %ebp
+  800bd9:	89 e5                	mov    %esp,%ebp
+  800bdb:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800bde:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be1:	8b 40 0c             	mov    0xc(%eax),%eax
+  800be4:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800be9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bec:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800bf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bfb:	e8 8b ff ff ff       	call   800b8b <fsipc>
+}
+  800c00:	c9                   	leave
+  800c01:	c3                   	ret
+
+00800c02 <devfile_flush>:
+{
+  800c02:	55                   	push   %ebp
+  800c03:	89 e5                	mov    %esp,%ebp
+  800c05:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800c08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c0e:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800c13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c18:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c1d:	e8 69 ff ff ff       	call   800b8b <fsipc>
+}
+  800c22:	c9                   	leave
+  800c23:	c3                   	ret
+
+00800c24 <devfile_stat>:
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	53                   	push   %ebx
+  800c28:	83 ec 04             	sub    $0x4,%esp
+  800c2b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800c2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c31:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c34:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800c39:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c3e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c43:	e8 43 ff ff ff       	call   800b8b <fsipc>
+  800c48:	85 c0                	test   %eax,%eax
+  800c4a:	78 2c                	js     800c78 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800c4c:	83 ec 08             	sub    $0x8,%esp
+  800c4f:	68 00 50 80 00       	push   $0x805000
+  800c54:	53                   	push   %ebx
+  800c55:	e8 7c 11 00 00       	call   801dd6 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800c5a:	a1 80 50 80 00       	mov    0x805080,%eax
+  800c5f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800c65:	a1 84 50 80 00       	mov    0x805084,%eax
+  800c6a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800c70:	83 c4 10             	add    $0x10,%esp
+  800c73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c7b:	c9                   	leave
+  800c7c:	c3                   	ret
+
+00800c7d <devfile_write>:
+{
+  800c7d:	55                   	push   %ebp
+  800c7e:	89 e5                	mov    %esp,%ebp
+  800c80:	83 ec 0c             	sub    $0xc,%esp
+  800c83:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800c86:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800c8b:	39 d0                	cmp    %edx,%eax
+  800c8d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800c90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c93:	8b 52 0c             	mov    0xc(%edx),%edx
+  800c96:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800c9c:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800ca1:	50                   	push   %eax
+  800ca2:	ff 75 0c             	push   0xc(%ebp)
+  800ca5:	68 08 50 80 00       	push   $0x805008
+  800caa:	e8 ad 12 00 00       	call   801f5c <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800caf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cb9:	e8 cd fe ff ff       	call   800b8b <fsipc>
+}
+  800cbe:	c9                   	leave
+  800cbf:	c3                   	ret
+
+00800cc0 <devfile_read>:
+{
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	56                   	push   %esi
+  800cc4:	53                   	push   %ebx
+  800cc5:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800cc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ccb:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cce:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800cd3:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800cd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cde:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ce3:	e8 a3 fe ff ff       	call   800b8b <fsipc>
+  800ce8:	89 c3                	mov    %eax,%ebx
+  800cea:	85 c0                	test   %eax,%eax
+  800cec:	78 1f                	js     800d0d <devfile_read+0x4d>
+	assert(r <= n);
+  800cee:	39 c6                	cmp    %eax,%esi
+  800cf0:	72 24                	jb     800d16 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  800cf2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800cf7:	7f 33                	jg     800d2c <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800cf9:	83 ec 04             	sub    $0x4,%esp
+  800cfc:	50                   	push   %eax
+  800cfd:	68 00 50 80 00       	push   $0x805000
+  800d02:	ff 75 0c             	push   0xc(%ebp)
+  800d05:	e8 52 12 00 00       	call   801f5c <memmove>
+	return r;
+  800d0a:	83 c4 10             	add    $0x10,%esp
+}
+  800d0d:	89 d8                	mov    %ebx,%eax
+  800d0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d12:	5b                   	pop    %ebx
+  800d13:	5e                   	pop    %esi
+  800d14:	5d                   	pop    %ebp
+  800d15:	c3                   	ret
+	assert(r <= n);
+  800d16:	68 48 27 80 00       	push   $0x802748
+  800d1b:	68 4f 27 80 00       	push   $0x80274f
+  800d20:	6a 7c                	push   $0x7c
+  800d22:	68 64 27 80 00       	push   $0x802764
+  800d27:	e8 e1 09 00 00       	call   80170d <_panic>
+	assert(r <= PGSIZE);
+  800d2c:	68 6f 27 80 00       	push   $0x80276f
+  800d31:	68 4f 27 80 00       	push   $0x80274f
+  800d36:	6a 7d                	push   $0x7d
+  800d38:	68 64 27 80 00       	push   $0x802764
+  800d3d:	e8 cb 09 00 00       	call   80170d <_panic>
+
+00800d42 <open>:
+{
+  800d42:	55                   	push   %ebp
+  800d43:	89 e5                	mov    %esp,%ebp
+  800d45:	56                   	push   %esi
+  800d46:	53                   	push   %ebx
+  800d47:	83 ec 1c             	sub    $0x1c,%esp
+  800d4a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800d4d:	56                   	push   %esi
+  800d4e:	e8 48 10 00 00       	call   801d9b <strlen>
+  800d53:	83 c4 10             	add    $0x10,%esp
+  800d56:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800d5b:	7f 6c                	jg     800dc9 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800d5d:	83 ec 0c             	sub    $0xc,%esp
+  800d60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d63:	50                   	push   %eax
+  800d64:	e8 ba f8 ff ff       	call   800623 <fd_alloc>
+  800d69:	89 c3                	mov    %eax,%ebx
+  800d6b:	83 c4 10             	add    $0x10,%esp
+  800d6e:	85 c0                	test   %eax,%eax
+  800d70:	78 3c                	js     800dae <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800d72:	83 ec 08             	sub    $0x8,%esp
+  800d75:	56                   	push   %esi
+  800d76:	68 00 50 80 00       	push   $0x805000
+  800d7b:	e8 56 10 00 00       	call   801dd6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800d80:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d83:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800d88:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800d8b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d90:	e8 f6 fd ff ff       	call   800b8b <fsipc>
+  800d95:	89 c3                	mov    %eax,%ebx
+  800d97:	83 c4 10             	add    $0x10,%esp
+  800d9a:	85 c0                	test   %eax,%eax
+  800d9c:	78 19                	js     800db7 <open+0x75>
+	return fd2num(fd);
+  800d9e:	83 ec 0c             	sub    $0xc,%esp
+  800da1:	ff 75 f4             	push   -0xc(%ebp)
+  800da4:	e8 53 f8 ff ff       	call   8005fc <fd2num>
+  800da9:	89 c3                	mov    %eax,%ebx
+  800dab:	83 c4 10             	add    $0x10,%esp
+}
+  800dae:	89 d8                	mov    %ebx,%eax
+  800db0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800db3:	5b                   	pop    %ebx
+  800db4:	5e                   	pop    %esi
+  800db5:	5d                   	pop    %ebp
+  800db6:	c3                   	ret
+		fd_close(fd, 0);
+  800db7:	83 ec 08             	sub    $0x8,%esp
+  800dba:	6a 00                	push   $0x0
+  800dbc:	ff 75 f4             	push   -0xc(%ebp)
+  800dbf:	e8 58 f9 ff ff       	call   80071c <fd_close>
+		return r;
+  800dc4:	83 c4 10             	add    $0x10,%esp
+  800dc7:	eb e5                	jmp    800dae <open+0x6c>
+		return -E_BAD_PATH;
+  800dc9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800dce:	eb de                	jmp    800dae <open+0x6c>
+
+00800dd0 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800dd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ddb:	b8 08 00 00 00       	mov    $0x8,%eax
+  800de0:	e8 a6 fd ff ff       	call   800b8b <fsipc>
+}
+  800de5:	c9                   	leave
+  800de6:	c3                   	ret
+
+00800de7 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800ded:	68 7b 27 80 00       	push   $0x80277b
+  800df2:	ff 75 0c             	push   0xc(%ebp)
+  800df5:	e8 dc 0f 00 00       	call   801dd6 <strcpy>
+	return 0;
+}
+  800dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dff:	c9                   	leave
+  800e00:	c3                   	ret
+
+00800e01 <devsock_close>:
+{
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	53                   	push   %ebx
+  800e05:	83 ec 10             	sub    $0x10,%esp
+  800e08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800e0b:	53                   	push   %ebx
+  800e0c:	e8 d1 13 00 00       	call   8021e2 <pageref>
+  800e11:	89 c2                	mov    %eax,%edx
+  800e13:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e16:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800e1b:	83 fa 01             	cmp    $0x1,%edx
+  800e1e:	74 05                	je     800e25 <devsock_close+0x24>
+}
+  800e20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e23:	c9                   	leave
+  800e24:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800e25:	83 ec 0c             	sub    $0xc,%esp
+  800e28:	ff 73 0c             	push   0xc(%ebx)
+  800e2b:	e8 b7 02 00 00       	call   8010e7 <nsipc_close>
+  800e30:	83 c4 10             	add    $0x10,%esp
+  800e33:	eb eb                	jmp    800e20 <devsock_close+0x1f>
+
+00800e35 <devsock_write>:
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800e3b:	6a 00                	push   $0x0
+  800e3d:	ff 75 10             	push   0x10(%ebp)
+  800e40:	ff 75 0c             	push   0xc(%ebp)
+  800e43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e46:	ff 70 0c             	push   0xc(%eax)
+  800e49:	e8 79 03 00 00       	call   8011c7 <nsipc_send>
+}
+  800e4e:	c9                   	leave
+  800e4f:	c3                   	ret
+
+00800e50 <devsock_read>:
+{
+  800e50:	55                   	push   %ebp
+  800e51:	89 e5                	mov    %esp,%ebp
+  800e53:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800e56:	6a 00                	push   $0x0
+  800e58:	ff 75 10             	push   0x10(%ebp)
+  800e5b:	ff 75 0c             	push   0xc(%ebp)
+  800e5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e61:	ff 70 0c             	push   0xc(%eax)
+  800e64:	e8 ef 02 00 00       	call   801158 <nsipc_recv>
+}
+  800e69:	c9                   	leave
+  800e6a:	c3                   	ret
+
+00800e6b <fd2sockid>:
+{
+  800e6b:	55                   	push   %ebp
+  800e6c:	89 e5                	mov    %esp,%ebp
+  800e6e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800e71:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800e74:	52                   	push   %edx
+  800e75:	50                   	push   %eax
+  800e76:	e8 fe f7 ff ff       	call   800679 <fd_lookup>
+  800e7b:	83 c4 10             	add    $0x10,%esp
+  800e7e:	85 c0                	test   %eax,%eax
+  800e80:	78 10                	js     800e92 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800e82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e85:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800e8b:	39 08                	cmp    %ecx,(%eax)
+  800e8d:	75 05                	jne    800e94 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800e8f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800e92:	c9                   	leave
+  800e93:	c3                   	ret
+		return -E_NOT_SUPP;
+  800e94:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e99:	eb f7                	jmp    800e92 <fd2sockid+0x27>
+
+00800e9b <alloc_sockfd>:
+{
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	56                   	push   %esi
+  800e9f:	53                   	push   %ebx
+  800ea0:	83 ec 1c             	sub    $0x1c,%esp
+  800ea3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800ea5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ea8:	50                   	push   %eax
+  800ea9:	e8 75 f7 ff ff       	call   800623 <fd_alloc>
+  800eae:	89 c3                	mov    %eax,%ebx
+  800eb0:	83 c4 10             	add    $0x10,%esp
+  800eb3:	85 c0                	test   %eax,%eax
+  800eb5:	78 43                	js     800efa <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800eb7:	83 ec 04             	sub    $0x4,%esp
+  800eba:	68 07 04 00 00       	push   $0x407
+  800ebf:	ff 75 f4             	push   -0xc(%ebp)
+  800ec2:	6a 00                	push   $0x0
+  800ec4:	e8 0e f3 ff ff       	call   8001d7 <sys_page_alloc>
+  800ec9:	89 c3                	mov    %eax,%ebx
+  800ecb:	83 c4 10             	add    $0x10,%esp
+  800ece:	85 c0                	test   %eax,%eax
+  800ed0:	78 28                	js     800efa <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800ed2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ed5:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800edb:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800edd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ee0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800ee7:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800eea:	83 ec 0c             	sub    $0xc,%esp
+  800eed:	50                   	push   %eax
+  800eee:	e8 09 f7 ff ff       	call   8005fc <fd2num>
+  800ef3:	89 c3                	mov    %eax,%ebx
+  800ef5:	83 c4 10             	add    $0x10,%esp
+  800ef8:	eb 0c                	jmp    800f06 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800efa:	83 ec 0c             	sub    $0xc,%esp
+  800efd:	56                   	push   %esi
+  800efe:	e8 e4 01 00 00       	call   8010e7 <nsipc_close>
+		return r;
+  800f03:	83 c4 10             	add    $0x10,%esp
+}
+  800f06:	89 d8                	mov    %ebx,%eax
+  800f08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f0b:	5b                   	pop    %ebx
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+
+00800f0f <accept>:
+{
+  800f0f:	55                   	push   %ebp
+  800f10:	89 e5                	mov    %esp,%ebp
+  800f12:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f18:	e8 4e ff ff ff       	call   800e6b <fd2sockid>
+  800f1d:	85 c0                	test   %eax,%eax
+  800f1f:	78 1b                	js     800f3c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800f21:	83 ec 04             	sub    $0x4,%esp
+  800f24:	ff 75 10             	push   0x10(%ebp)
+  800f27:	ff 75 0c             	push   0xc(%ebp)
+  800f2a:	50                   	push   %eax
+  800f2b:	e8 0e 01 00 00       	call   80103e <nsipc_accept>
+  800f30:	83 c4 10             	add    $0x10,%esp
+  800f33:	85 c0                	test   %eax,%eax
+  800f35:	78 05                	js     800f3c <accept+0x2d>
+	return alloc_sockfd(r);
+  800f37:	e8 5f ff ff ff       	call   800e9b <alloc_sockfd>
+}
+  800f3c:	c9                   	leave
+  800f3d:	c3                   	ret
+
+00800f3e <bind>:
+{
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f44:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f47:	e8 1f ff ff ff       	call   800e6b <fd2sockid>
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	78 12                	js     800f62 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800f50:	83 ec 04             	sub    $0x4,%esp
+  800f53:	ff 75 10             	push   0x10(%ebp)
+  800f56:	ff 75 0c             	push   0xc(%ebp)
+  800f59:	50                   	push   %eax
+  800f5a:	e8 31 01 00 00       	call   801090 <nsipc_bind>
+  800f5f:	83 c4 10             	add    $0x10,%esp
+}
+  800f62:	c9                   	leave
+  800f63:	c3                   	ret
+
+00800f64 <shutdown>:
+{
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f6d:	e8 f9 fe ff ff       	call   800e6b <fd2sockid>
+  800f72:	85 c0                	test   %eax,%eax
+  800f74:	78 0f                	js     800f85 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800f76:	83 ec 08             	sub    $0x8,%esp
+  800f79:	ff 75 0c             	push   0xc(%ebp)
+  800f7c:	50                   	push   %eax
+  800f7d:	e8 43 01 00 00       	call   8010c5 <nsipc_shutdown>
+  800f82:	83 c4 10             	add    $0x10,%esp
+}
+  800f85:	c9                   	leave
+  800f86:	c3                   	ret
+
+00800f87 <connect>:
+{
+  800f87:	55                   	push   %ebp
+  800f88:	89 e5                	mov    %esp,%ebp
+  800f8a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f90:	e8 d6 fe ff ff       	call   800e6b <fd2sockid>
+  800f95:	85 c0                	test   %eax,%eax
+  800f97:	78 12                	js     800fab <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800f99:	83 ec 04             	sub    $0x4,%esp
+  800f9c:	ff 75 10             	push   0x10(%ebp)
+  800f9f:	ff 75 0c             	push   0xc(%ebp)
+  800fa2:	50                   	push   %eax
+  800fa3:	e8 59 01 00 00       	call   801101 <nsipc_connect>
+  800fa8:	83 c4 10             	add    $0x10,%esp
+}
+  800fab:	c9                   	leave
+  800fac:	c3                   	ret
+
+00800fad <listen>:
+{
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800fb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fb6:	e8 b0 fe ff ff       	call   800e6b <fd2sockid>
+  800fbb:	85 c0                	test   %eax,%eax
+  800fbd:	78 0f                	js     800fce <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800fbf:	83 ec 08             	sub    $0x8,%esp
+  800fc2:	ff 75 0c             	push   0xc(%ebp)
+  800fc5:	50                   	push   %eax
+  800fc6:	e8 6b 01 00 00       	call   801136 <nsipc_listen>
+  800fcb:	83 c4 10             	add    $0x10,%esp
+}
+  800fce:	c9                   	leave
+  800fcf:	c3                   	ret
+
+00800fd0 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800fd6:	ff 75 10             	push   0x10(%ebp)
+  800fd9:	ff 75 0c             	push   0xc(%ebp)
+  800fdc:	ff 75 08             	push   0x8(%ebp)
+  800fdf:	e8 41 02 00 00       	call   801225 <nsipc_socket>
+  800fe4:	83 c4 10             	add    $0x10,%esp
+  800fe7:	85 c0                	test   %eax,%eax
+  800fe9:	78 05                	js     800ff0 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800feb:	e8 ab fe ff ff       	call   800e9b <alloc_sockfd>
+}
+  800ff0:	c9                   	leave
+  800ff1:	c3                   	ret
+
+00800ff2 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	53                   	push   %ebx
+  800ff6:	83 ec 04             	sub    $0x4,%esp
+  800ff9:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800ffb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801002:	74 26                	je     80102a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801004:	6a 07                	push   $0x7
+  801006:	68 00 60 80 00       	push   $0x806000
+  80100b:	53                   	push   %ebx
+  80100c:	ff 35 04 40 80 00    	push   0x804004
+  801012:	e8 67 11 00 00       	call   80217e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801017:	83 c4 0c             	add    $0xc,%esp
+  80101a:	6a 00                	push   $0x0
+  80101c:	6a 00                	push   $0x0
+  80101e:	6a 00                	push   $0x0
+  801020:	e8 e1 10 00 00       	call   802106 <ipc_recv>
+}
+  801025:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801028:	c9                   	leave
+  801029:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80102a:	83 ec 0c             	sub    $0xc,%esp
+  80102d:	6a 02                	push   $0x2
+  80102f:	e8 9e 11 00 00       	call   8021d2 <ipc_find_env>
+  801034:	a3 04 40 80 00       	mov    %eax,0x804004
+  801039:	83 c4 10             	add    $0x10,%esp
+  80103c:	eb c6                	jmp    801004 <nsipc+0x12>
+
+0080103e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80103e:	55                   	push   %ebp
+  80103f:	89 e5                	mov    %esp,%ebp
+  801041:	56                   	push   %esi
+  801042:	53                   	push   %ebx
+  801043:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801046:	8b 45 08             	mov    0x8(%ebp),%eax
+  801049:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80104e:	8b 06                	mov    (%esi),%eax
+  801050:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801055:	b8 01 00 00 00       	mov    $0x1,%eax
+  80105a:	e8 93 ff ff ff       	call   800ff2 <nsipc>
+  80105f:	89 c3                	mov    %eax,%ebx
+  801061:	85 c0                	test   %eax,%eax
+  801063:	79 09                	jns    80106e <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801065:	89 d8                	mov    %ebx,%eax
+  801067:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80106a:	5b                   	pop    %ebx
+  80106b:	5e                   	pop    %esi
+  80106c:	5d                   	pop    %ebp
+  80106d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80106e:	83 ec 04             	sub    $0x4,%esp
+  801071:	ff 35 10 60 80 00    	push   0x806010
+  801077:	68 00 60 80 00       	push   $0x806000
+  80107c:	ff 75 0c             	push   0xc(%ebp)
+  80107f:	e8 d8 0e 00 00       	call   801f5c <memmove>
+		*addrlen = ret->ret_addrlen;
+  801084:	a1 10 60 80 00       	mov    0x806010,%eax
+  801089:	89 06                	mov    %eax,(%esi)
+  80108b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80108e:	eb d5                	jmp    801065 <nsipc_accept+0x27>
+
+00801090 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801090:	55                   	push   %ebp
+  801091:	89 e5                	mov    %esp,%ebp
+  801093:	53                   	push   %ebx
+  801094:	83 ec 08             	sub    $0x8,%esp
+  801097:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80109a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80109d:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8010a2:	53                   	push   %ebx
+  8010a3:	ff 75 0c             	push   0xc(%ebp)
+  8010a6:	68 04 60 80 00       	push   $0x806004
+  8010ab:	e8 ac 0e 00 00       	call   801f5c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8010b0:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8010b6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010bb:	e8 32 ff ff ff       	call   800ff2 <nsipc>
+}
+  8010c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010c3:	c9                   	leave
+  8010c4:	c3                   	ret
+
+008010c5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8010cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ce:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8010d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010d6:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8010db:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010e0:	e8 0d ff ff ff       	call   800ff2 <nsipc>
+}
+  8010e5:	c9                   	leave
+  8010e6:	c3                   	ret
+
+008010e7 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8010e7:	55                   	push   %ebp
+  8010e8:	89 e5                	mov    %esp,%ebp
+  8010ea:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8010ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f0:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  8010f5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010fa:	e8 f3 fe ff ff       	call   800ff2 <nsipc>
+}
+  8010ff:	c9                   	leave
+  801100:	c3                   	ret
+
+00801101 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	53                   	push   %ebx
+  801105:	83 ec 08             	sub    $0x8,%esp
+  801108:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80110b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80110e:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801113:	53                   	push   %ebx
+  801114:	ff 75 0c             	push   0xc(%ebp)
+  801117:	68 04 60 80 00       	push   $0x806004
+  80111c:	e8 3b 0e 00 00       	call   801f5c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801121:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801127:	b8 05 00 00 00       	mov    $0x5,%eax
+  80112c:	e8 c1 fe ff ff       	call   800ff2 <nsipc>
+}
+  801131:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801134:	c9                   	leave
+  801135:	c3                   	ret
+
+00801136 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801136:	55                   	push   %ebp
+  801137:	89 e5                	mov    %esp,%ebp
+  801139:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80113c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80113f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801144:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801147:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  80114c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801151:	e8 9c fe ff ff       	call   800ff2 <nsipc>
+}
+  801156:	c9                   	leave
+  801157:	c3                   	ret
+
+00801158 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801158:	55                   	push   %ebp
+  801159:	89 e5                	mov    %esp,%ebp
+  80115b:	56                   	push   %esi
+  80115c:	53                   	push   %ebx
+  80115d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801160:	8b 45 08             	mov    0x8(%ebp),%eax
+  801163:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801168:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  80116e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801171:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801176:	b8 07 00 00 00       	mov    $0x7,%eax
+  80117b:	e8 72 fe ff ff       	call   800ff2 <nsipc>
+  801180:	89 c3                	mov    %eax,%ebx
+  801182:	85 c0                	test   %eax,%eax
+  801184:	78 22                	js     8011a8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801186:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80118b:	39 c6                	cmp    %eax,%esi
+  80118d:	0f 4e c6             	cmovle %esi,%eax
+  801190:	39 c3                	cmp    %eax,%ebx
+  801192:	7f 1d                	jg     8011b1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801194:	83 ec 04             	sub    $0x4,%esp
+  801197:	53                   	push   %ebx
+  801198:	68 00 60 80 00       	push   $0x806000
+  80119d:	ff 75 0c             	push   0xc(%ebp)
+  8011a0:	e8 b7 0d 00 00       	call   801f5c <memmove>
+  8011a5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8011a8:	89 d8                	mov    %ebx,%eax
+  8011aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011ad:	5b                   	pop    %ebx
+  8011ae:	5e                   	pop    %esi
+  8011af:	5d                   	pop    %ebp
+  8011b0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8011b1:	68 87 27 80 00       	push   $0x802787
+  8011b6:	68 4f 27 80 00       	push   $0x80274f
+  8011bb:	6a 62                	push   $0x62
+  8011bd:	68 9c 27 80 00       	push   $0x80279c
+  8011c2:	e8 46 05 00 00       	call   80170d <_panic>
+
+008011c7 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8011c7:	55                   	push   %ebp
+  8011c8:	89 e5                	mov    %esp,%ebp
+  8011ca:	53                   	push   %ebx
+  8011cb:	83 ec 04             	sub    $0x4,%esp
+  8011ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8011d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d4:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  8011d9:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8011df:	7f 2e                	jg     80120f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8011e1:	83 ec 04             	sub    $0x4,%esp
+  8011e4:	53                   	push   %ebx
+  8011e5:	ff 75 0c             	push   0xc(%ebp)
+  8011e8:	68 0c 60 80 00       	push   $0x80600c
+  8011ed:	e8 6a 0d 00 00       	call   801f5c <memmove>
+	nsipcbuf.send.req_size = size;
+  8011f2:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  8011f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011fb:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801200:	b8 08 00 00 00       	mov    $0x8,%eax
+  801205:	e8 e8 fd ff ff       	call   800ff2 <nsipc>
+}
+  80120a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80120d:	c9                   	leave
+  80120e:	c3                   	ret
+	assert(size < 1600);
+  80120f:	68 a8 27 80 00       	push   $0x8027a8
+  801214:	68 4f 27 80 00       	push   $0x80274f
+  801219:	6a 6d                	push   $0x6d
+  80121b:	68 9c 27 80 00       	push   $0x80279c
+  801220:	e8 e8 04 00 00       	call   80170d <_panic>
+
+00801225 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801225:	55                   	push   %ebp
+  801226:	89 e5                	mov    %esp,%ebp
+  801228:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80122b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80122e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801233:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801236:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  80123b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80123e:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801243:	b8 09 00 00 00       	mov    $0x9,%eax
+  801248:	e8 a5 fd ff ff       	call   800ff2 <nsipc>
+}
+  80124d:	c9                   	leave
+  80124e:	c3                   	ret
+
+0080124f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80124f:	55                   	push   %ebp
+  801250:	89 e5                	mov    %esp,%ebp
+  801252:	56                   	push   %esi
+  801253:	53                   	push   %ebx
+  801254:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801257:	83 ec 0c             	sub    $0xc,%esp
+  80125a:	ff 75 08             	push   0x8(%ebp)
+  80125d:	e8 aa f3 ff ff       	call   80060c <fd2data>
+  801262:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801264:	83 c4 08             	add    $0x8,%esp
+  801267:	68 b4 27 80 00       	push   $0x8027b4
+  80126c:	53                   	push   %ebx
+  80126d:	e8 64 0b 00 00       	call   801dd6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801272:	8b 46 04             	mov    0x4(%esi),%eax
+  801275:	2b 06                	sub    (%esi),%eax
+  801277:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80127d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801284:	00 00 00 
+	stat->st_dev = &devpipe;
+  801287:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  80128e:	30 80 00 
+	return 0;
+}
+  801291:	b8 00 00 00 00       	mov    $0x0,%eax
+  801296:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5d                   	pop    %ebp
+  80129c:	c3                   	ret
+
+0080129d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80129d:	55                   	push   %ebp
+  80129e:	89 e5                	mov    %esp,%ebp
+  8012a0:	53                   	push   %ebx
+  8012a1:	83 ec 0c             	sub    $0xc,%esp
+  8012a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8012a7:	53                   	push   %ebx
+  8012a8:	6a 00                	push   $0x0
+  8012aa:	e8 f0 ef ff ff       	call   80029f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8012af:	89 1c 24             	mov    %ebx,(%esp)
+  8012b2:	e8 55 f3 ff ff       	call   80060c <fd2data>
+  8012b7:	83 c4 08             	add    $0x8,%esp
+  8012ba:	50                   	push   %eax
+  8012bb:	6a 00                	push   $0x0
+  8012bd:	e8 dd ef ff ff       	call   80029f <sys_page_unmap>
+}
+  8012c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012c5:	c9                   	leave
+  8012c6:	c3                   	ret
+
+008012c7 <_pipeisclosed>:
+{
+  8012c7:	55                   	push   %ebp
+  8012c8:	89 e5                	mov    %esp,%ebp
+  8012ca:	57                   	push   %edi
+  8012cb:	56                   	push   %esi
+  8012cc:	53                   	push   %ebx
+  8012cd:	83 ec 1c             	sub    $0x1c,%esp
+  8012d0:	89 c7                	mov    %eax,%edi
+  8012d2:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8012d4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012d9:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8012dc:	83 ec 0c             	sub    $0xc,%esp
+  8012df:	57                   	push   %edi
+  8012e0:	e8 fd 0e 00 00       	call   8021e2 <pageref>
+  8012e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012e8:	89 34 24             	mov    %esi,(%esp)
+  8012eb:	e8 f2 0e 00 00       	call   8021e2 <pageref>
+		nn = thisenv->env_runs;
+  8012f0:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  8012f6:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8012f9:	83 c4 10             	add    $0x10,%esp
+  8012fc:	39 cb                	cmp    %ecx,%ebx
+  8012fe:	74 1b                	je     80131b <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801300:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801303:	75 cf                	jne    8012d4 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801305:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801308:	6a 01                	push   $0x1
+  80130a:	50                   	push   %eax
+  80130b:	53                   	push   %ebx
+  80130c:	68 bb 27 80 00       	push   $0x8027bb
+  801311:	e8 d2 04 00 00       	call   8017e8 <cprintf>
+  801316:	83 c4 10             	add    $0x10,%esp
+  801319:	eb b9                	jmp    8012d4 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80131b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80131e:	0f 94 c0             	sete   %al
+  801321:	0f b6 c0             	movzbl %al,%eax
+}
+  801324:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801327:	5b                   	pop    %ebx
+  801328:	5e                   	pop    %esi
+  801329:	5f                   	pop    %edi
+  80132a:	5d                   	pop    %ebp
+  80132b:	c3                   	ret
+
+0080132c <devpipe_write>:
+{
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+  80132f:	57                   	push   %edi
+  801330:	56                   	push   %esi
+  801331:	53                   	push   %ebx
+  801332:	83 ec 28             	sub    $0x28,%esp
+  801335:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801338:	56                   	push   %esi
+  801339:	e8 ce f2 ff ff       	call   80060c <fd2data>
+  80133e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801340:	83 c4 10             	add    $0x10,%esp
+  801343:	bf 00 00 00 00       	mov    $0x0,%edi
+  801348:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80134b:	75 09                	jne    801356 <devpipe_write+0x2a>
+	return i;
+  80134d:	89 f8                	mov    %edi,%eax
+  80134f:	eb 23                	jmp    801374 <devpipe_write+0x48>
+			sys_yield();
+  801351:	e8 01 ee ff ff       	call   800157 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801356:	8b 43 04             	mov    0x4(%ebx),%eax
+  801359:	8b 0b                	mov    (%ebx),%ecx
+  80135b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80135e:	39 d0                	cmp    %edx,%eax
+  801360:	72 1a                	jb     80137c <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801362:	89 da                	mov    %ebx,%edx
+  801364:	89 f0                	mov    %esi,%eax
+  801366:	e8 5c ff ff ff       	call   8012c7 <_pipeisclosed>
+  80136b:	85 c0                	test   %eax,%eax
+  80136d:	74 e2                	je     801351 <devpipe_write+0x25>
+				return 0;
+  80136f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801374:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801377:	5b                   	pop    %ebx
+  801378:	5e                   	pop    %esi
+  801379:	5f                   	pop    %edi
+  80137a:	5d                   	pop    %ebp
+  80137b:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80137c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801383:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801386:	89 c2                	mov    %eax,%edx
+  801388:	c1 fa 1f             	sar    $0x1f,%edx
+  80138b:	89 d1                	mov    %edx,%ecx
+  80138d:	c1 e9 1b             	shr    $0x1b,%ecx
+  801390:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801393:	83 e2 1f             	and    $0x1f,%edx
+  801396:	29 ca                	sub    %ecx,%edx
+  801398:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80139c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8013a0:	83 c0 01             	add    $0x1,%eax
+  8013a3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8013a6:	83 c7 01             	add    $0x1,%edi
+  8013a9:	eb 9d                	jmp    801348 <devpipe_write+0x1c>
+
+008013ab <devpipe_read>:
+{
+  8013ab:	55                   	push   %ebp
+  8013ac:	89 e5                	mov    %esp,%ebp
+  8013ae:	57                   	push   %edi
+  8013af:	56                   	push   %esi
+  8013b0:	53                   	push   %ebx
+  8013b1:	83 ec 18             	sub    $0x18,%esp
+  8013b4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8013b7:	57                   	push   %edi
+  8013b8:	e8 4f f2 ff ff       	call   80060c <fd2data>
+  8013bd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8013bf:	83 c4 10             	add    $0x10,%esp
+  8013c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8013ca:	75 13                	jne    8013df <devpipe_read+0x34>
+	return i;
+  8013cc:	89 f0                	mov    %esi,%eax
+  8013ce:	eb 02                	jmp    8013d2 <devpipe_read+0x27>
+				return i;
+  8013d0:	89 f0                	mov    %esi,%eax
+}
+  8013d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d5:	5b                   	pop    %ebx
+  8013d6:	5e                   	pop    %esi
+  8013d7:	5f                   	pop    %edi
+  8013d8:	5d                   	pop    %ebp
+  8013d9:	c3                   	ret
+			sys_yield();
+  8013da:	e8 78 ed ff ff       	call   800157 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8013df:	8b 03                	mov    (%ebx),%eax
+  8013e1:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8013e4:	75 18                	jne    8013fe <devpipe_read+0x53>
+			if (i > 0)
+  8013e6:	85 f6                	test   %esi,%esi
+  8013e8:	75 e6                	jne    8013d0 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8013ea:	89 da                	mov    %ebx,%edx
+  8013ec:	89 f8                	mov    %edi,%eax
+  8013ee:	e8 d4 fe ff ff       	call   8012c7 <_pipeisclosed>
+  8013f3:	85 c0                	test   %eax,%eax
+  8013f5:	74 e3                	je     8013da <devpipe_read+0x2f>
+				return 0;
+  8013f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fc:	eb d4                	jmp    8013d2 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8013fe:	99                   	cltd
+  8013ff:	c1 ea 1b             	shr    $0x1b,%edx
+  801402:	01 d0                	add    %edx,%eax
+  801404:	83 e0 1f             	and    $0x1f,%eax
+  801407:	29 d0                	sub    %edx,%eax
+  801409:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80140e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801411:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801414:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801417:	83 c6 01             	add    $0x1,%esi
+  80141a:	eb ab                	jmp    8013c7 <devpipe_read+0x1c>
+
+0080141c <pipe>:
+{
+  80141c:	55                   	push   %ebp
+  80141d:	89 e5                	mov    %esp,%ebp
+  80141f:	56                   	push   %esi
+  801420:	53                   	push   %ebx
+  801421:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801424:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801427:	50                   	push   %eax
+  801428:	e8 f6 f1 ff ff       	call   800623 <fd_alloc>
+  80142d:	89 c3                	mov    %eax,%ebx
+  80142f:	83 c4 10             	add    $0x10,%esp
+  801432:	85 c0                	test   %eax,%eax
+  801434:	0f 88 23 01 00 00    	js     80155d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80143a:	83 ec 04             	sub    $0x4,%esp
+  80143d:	68 07 04 00 00       	push   $0x407
+  801442:	ff 75 f4             	push   -0xc(%ebp)
+  801445:	6a 00                	push   $0x0
+  801447:	e8 8b ed ff ff       	call   8001d7 <sys_page_alloc>
+  80144c:	89 c3                	mov    %eax,%ebx
+  80144e:	83 c4 10             	add    $0x10,%esp
+  801451:	85 c0                	test   %eax,%eax
+  801453:	0f 88 04 01 00 00    	js     80155d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801459:	83 ec 0c             	sub    $0xc,%esp
+  80145c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80145f:	50                   	push   %eax
+  801460:	e8 be f1 ff ff       	call   800623 <fd_alloc>
+  801465:	89 c3                	mov    %eax,%ebx
+  801467:	83 c4 10             	add    $0x10,%esp
+  80146a:	85 c0                	test   %eax,%eax
+  80146c:	0f 88 db 00 00 00    	js     80154d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801472:	83 ec 04             	sub    $0x4,%esp
+  801475:	68 07 04 00 00       	push   $0x407
+  80147a:	ff 75 f0             	push   -0x10(%ebp)
+  80147d:	6a 00                	push   $0x0
+  80147f:	e8 53 ed ff ff       	call   8001d7 <sys_page_alloc>
+  801484:	89 c3                	mov    %eax,%ebx
+  801486:	83 c4 10             	add    $0x10,%esp
+  801489:	85 c0                	test   %eax,%eax
+  80148b:	0f 88 bc 00 00 00    	js     80154d <pipe+0x131>
+	va = fd2data(fd0);
+  801491:	83 ec 0c             	sub    $0xc,%esp
+  801494:	ff 75 f4             	push   -0xc(%ebp)
+  801497:	e8 70 f1 ff ff       	call   80060c <fd2data>
+  80149c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80149e:	83 c4 0c             	add    $0xc,%esp
+  8014a1:	68 07 04 00 00       	push   $0x407
+  8014a6:	50                   	push   %eax
+  8014a7:	6a 00                	push   $0x0
+  8014a9:	e8 29 ed ff ff       	call   8001d7 <sys_page_alloc>
+  8014ae:	89 c3                	mov    %eax,%ebx
+  8014b0:	83 c4 10             	add    $0x10,%esp
+  8014b3:	85 c0                	test   %eax,%eax
+  8014b5:	0f 88 82 00 00 00    	js     80153d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014bb:	83 ec 0c             	sub    $0xc,%esp
+  8014be:	ff 75 f0             	push   -0x10(%ebp)
+  8014c1:	e8 46 f1 ff ff       	call   80060c <fd2data>
+  8014c6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014cd:	50                   	push   %eax
+  8014ce:	6a 00                	push   $0x0
+  8014d0:	56                   	push   %esi
+  8014d1:	6a 00                	push   $0x0
+  8014d3:	e8 85 ed ff ff       	call   80025d <sys_page_map>
+  8014d8:	89 c3                	mov    %eax,%ebx
+  8014da:	83 c4 20             	add    $0x20,%esp
+  8014dd:	85 c0                	test   %eax,%eax
+  8014df:	78 4e                	js     80152f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014e1:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8014e6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014e9:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014eb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014ee:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8014f5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8014f8:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8014fa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8014fd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801504:	83 ec 0c             	sub    $0xc,%esp
+  801507:	ff 75 f4             	push   -0xc(%ebp)
+  80150a:	e8 ed f0 ff ff       	call   8005fc <fd2num>
+  80150f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801512:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801514:	83 c4 04             	add    $0x4,%esp
+  801517:	ff 75 f0             	push   -0x10(%ebp)
+  80151a:	e8 dd f0 ff ff       	call   8005fc <fd2num>
+  80151f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801522:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801525:	83 c4 10             	add    $0x10,%esp
+  801528:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152d:	eb 2e                	jmp    80155d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80152f:	83 ec 08             	sub    $0x8,%esp
+  801532:	56                   	push   %esi
+  801533:	6a 00                	push   $0x0
+  801535:	e8 65 ed ff ff       	call   80029f <sys_page_unmap>
+  80153a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80153d:	83 ec 08             	sub    $0x8,%esp
+  801540:	ff 75 f0             	push   -0x10(%ebp)
+  801543:	6a 00                	push   $0x0
+  801545:	e8 55 ed ff ff       	call   80029f <sys_page_unmap>
+  80154a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80154d:	83 ec 08             	sub    $0x8,%esp
+  801550:	ff 75 f4             	push   -0xc(%ebp)
+  801553:	6a 00                	push   $0x0
+  801555:	e8 45 ed ff ff       	call   80029f <sys_page_unmap>
+  80155a:	83 c4 10             	add    $0x10,%esp
+}
+  80155d:	89 d8                	mov    %ebx,%eax
+  80155f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801562:	5b                   	pop    %ebx
+  801563:	5e                   	pop    %esi
+  801564:	5d                   	pop    %ebp
+  801565:	c3                   	ret
+
+00801566 <pipeisclosed>:
+{
+  801566:	55                   	push   %ebp
+  801567:	89 e5                	mov    %esp,%ebp
+  801569:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80156c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80156f:	50                   	push   %eax
+  801570:	ff 75 08             	push   0x8(%ebp)
+  801573:	e8 01 f1 ff ff       	call   800679 <fd_lookup>
+  801578:	83 c4 10             	add    $0x10,%esp
+  80157b:	85 c0                	test   %eax,%eax
+  80157d:	78 18                	js     801597 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80157f:	83 ec 0c             	sub    $0xc,%esp
+  801582:	ff 75 f4             	push   -0xc(%ebp)
+  801585:	e8 82 f0 ff ff       	call   80060c <fd2data>
+  80158a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80158c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80158f:	e8 33 fd ff ff       	call   8012c7 <_pipeisclosed>
+  801594:	83 c4 10             	add    $0x10,%esp
+}
+  801597:	c9                   	leave
+  801598:	c3                   	ret
+
+00801599 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159e:	c3                   	ret
+
+0080159f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80159f:	55                   	push   %ebp
+  8015a0:	89 e5                	mov    %esp,%ebp
+  8015a2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015a5:	68 d3 27 80 00       	push   $0x8027d3
+  8015aa:	ff 75 0c             	push   0xc(%ebp)
+  8015ad:	e8 24 08 00 00       	call   801dd6 <strcpy>
+	return 0;
+}
+  8015b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b7:	c9                   	leave
+  8015b8:	c3                   	ret
+
+008015b9 <devcons_write>:
+{
+  8015b9:	55                   	push   %ebp
+  8015ba:	89 e5                	mov    %esp,%ebp
+  8015bc:	57                   	push   %edi
+  8015bd:	56                   	push   %esi
+  8015be:	53                   	push   %ebx
+  8015bf:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015c5:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015ca:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015d0:	eb 2e                	jmp    801600 <devcons_write+0x47>
+		m = n - tot;
+  8015d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015d5:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015d7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015dc:	39 c3                	cmp    %eax,%ebx
+  8015de:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015e1:	83 ec 04             	sub    $0x4,%esp
+  8015e4:	53                   	push   %ebx
+  8015e5:	89 f0                	mov    %esi,%eax
+  8015e7:	03 45 0c             	add    0xc(%ebp),%eax
+  8015ea:	50                   	push   %eax
+  8015eb:	57                   	push   %edi
+  8015ec:	e8 6b 09 00 00       	call   801f5c <memmove>
+		sys_cputs(buf, m);
+  8015f1:	83 c4 08             	add    $0x8,%esp
+  8015f4:	53                   	push   %ebx
+  8015f5:	57                   	push   %edi
+  8015f6:	e8 9f ea ff ff       	call   80009a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8015fb:	01 de                	add    %ebx,%esi
+  8015fd:	83 c4 10             	add    $0x10,%esp
+  801600:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801603:	72 cd                	jb     8015d2 <devcons_write+0x19>
+}
+  801605:	89 f0                	mov    %esi,%eax
+  801607:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160a:	5b                   	pop    %ebx
+  80160b:	5e                   	pop    %esi
+  80160c:	5f                   	pop    %edi
+  80160d:	5d                   	pop    %ebp
+  80160e:	c3                   	ret
+
+0080160f <devcons_read>:
+{
+  80160f:	55                   	push   %ebp
+  801610:	89 e5                	mov    %esp,%ebp
+  801612:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80161e:	75 07                	jne    801627 <devcons_read+0x18>
+  801620:	eb 1f                	jmp    801641 <devcons_read+0x32>
+		sys_yield();
+  801622:	e8 30 eb ff ff       	call   800157 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801627:	e8 8c ea ff ff       	call   8000b8 <sys_cgetc>
+  80162c:	85 c0                	test   %eax,%eax
+  80162e:	74 f2                	je     801622 <devcons_read+0x13>
+	if (c < 0)
+  801630:	78 0f                	js     801641 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801632:	83 f8 04             	cmp    $0x4,%eax
+  801635:	74 0c                	je     801643 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801637:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80163a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80163c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801641:	c9                   	leave
+  801642:	c3                   	ret
+		return 0;
+  801643:	b8 00 00 00 00       	mov    $0x0,%eax
+  801648:	eb f7                	jmp    801641 <devcons_read+0x32>
+
+0080164a <cputchar>:
+{
+  80164a:	55                   	push   %ebp
+  80164b:	89 e5                	mov    %esp,%ebp
+  80164d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801650:	8b 45 08             	mov    0x8(%ebp),%eax
+  801653:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801656:	6a 01                	push   $0x1
+  801658:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80165b:	50                   	push   %eax
+  80165c:	e8 39 ea ff ff       	call   80009a <sys_cputs>
+}
+  801661:	83 c4 10             	add    $0x10,%esp
+  801664:	c9                   	leave
+  801665:	c3                   	ret
+
+00801666 <getchar>:
+{
+  801666:	55                   	push   %ebp
+  801667:	89 e5                	mov    %esp,%ebp
+  801669:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80166c:	6a 01                	push   $0x1
+  80166e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801671:	50                   	push   %eax
+  801672:	6a 00                	push   $0x0
+  801674:	e8 66 f2 ff ff       	call   8008df <read>
+	if (r < 0)
+  801679:	83 c4 10             	add    $0x10,%esp
+  80167c:	85 c0                	test   %eax,%eax
+  80167e:	78 06                	js     801686 <getchar+0x20>
+	if (r < 1)
+  801680:	74 06                	je     801688 <getchar+0x22>
+	return c;
+  801682:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801686:	c9                   	leave
+  801687:	c3                   	ret
+		return -E_EOF;
+  801688:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80168d:	eb f7                	jmp    801686 <getchar+0x20>
+
+0080168f <iscons>:
+{
+  80168f:	55                   	push   %ebp
+  801690:	89 e5                	mov    %esp,%ebp
+  801692:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801695:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801698:	50                   	push   %eax
+  801699:	ff 75 08             	push   0x8(%ebp)
+  80169c:	e8 d8 ef ff ff       	call   800679 <fd_lookup>
+  8016a1:	83 c4 10             	add    $0x10,%esp
+  8016a4:	85 c0                	test   %eax,%eax
+  8016a6:	78 11                	js     8016b9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ab:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8016b1:	39 10                	cmp    %edx,(%eax)
+  8016b3:	0f 94 c0             	sete   %al
+  8016b6:	0f b6 c0             	movzbl %al,%eax
+}
+  8016b9:	c9                   	leave
+  8016ba:	c3                   	ret
+
+008016bb <opencons>:
+{
+  8016bb:	55                   	push   %ebp
+  8016bc:	89 e5                	mov    %esp,%ebp
+  8016be:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c4:	50                   	push   %eax
+  8016c5:	e8 59 ef ff ff       	call   800623 <fd_alloc>
+  8016ca:	83 c4 10             	add    $0x10,%esp
+  8016cd:	85 c0                	test   %eax,%eax
+  8016cf:	78 3a                	js     80170b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016d1:	83 ec 04             	sub    $0x4,%esp
+  8016d4:	68 07 04 00 00       	push   $0x407
+  8016d9:	ff 75 f4             	push   -0xc(%ebp)
+  8016dc:	6a 00                	push   $0x0
+  8016de:	e8 f4 ea ff ff       	call   8001d7 <sys_page_alloc>
+  8016e3:	83 c4 10             	add    $0x10,%esp
+  8016e6:	85 c0                	test   %eax,%eax
+  8016e8:	78 21                	js     80170b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ed:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8016f3:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8016f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8016ff:	83 ec 0c             	sub    $0xc,%esp
+  801702:	50                   	push   %eax
+  801703:	e8 f4 ee ff ff       	call   8005fc <fd2num>
+  801708:	83 c4 10             	add    $0x10,%esp
+}
+  80170b:	c9                   	leave
+  80170c:	c3                   	ret
+
+0080170d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80170d:	55                   	push   %ebp
+  80170e:	89 e5                	mov    %esp,%ebp
+  801710:	56                   	push   %esi
+  801711:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801712:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801715:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80171b:	e8 18 ea ff ff       	call   800138 <sys_getenvid>
+  801720:	83 ec 0c             	sub    $0xc,%esp
+  801723:	ff 75 0c             	push   0xc(%ebp)
+  801726:	ff 75 08             	push   0x8(%ebp)
+  801729:	56                   	push   %esi
+  80172a:	50                   	push   %eax
+  80172b:	68 e0 27 80 00       	push   $0x8027e0
+  801730:	e8 b3 00 00 00       	call   8017e8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801735:	83 c4 18             	add    $0x18,%esp
+  801738:	53                   	push   %ebx
+  801739:	ff 75 10             	push   0x10(%ebp)
+  80173c:	e8 56 00 00 00       	call   801797 <vcprintf>
+	cprintf("\n");
+  801741:	c7 04 24 cc 27 80 00 	movl   $0x8027cc,(%esp)
+  801748:	e8 9b 00 00 00       	call   8017e8 <cprintf>
+  80174d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801750:	cc                   	int3
+	while (1)
+  801751:	eb fd                	jmp    801750 <_panic+0x43>
+
+00801753 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801753:	55                   	push   %ebp
+  801754:	89 e5                	mov    %esp,%ebp
+  801756:	53                   	push   %ebx
+  801757:	83 ec 04             	sub    $0x4,%esp
+  80175a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80175d:	8b 13                	mov    (%ebx),%edx
+  80175f:	8d 42 01             	lea    0x1(%edx),%eax
+  801762:	89 03                	mov    %eax,(%ebx)
+  801764:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801767:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80176b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801770:	74 09                	je     80177b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801772:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801776:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801779:	c9                   	leave
+  80177a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80177b:	83 ec 08             	sub    $0x8,%esp
+  80177e:	68 ff 00 00 00       	push   $0xff
+  801783:	8d 43 08             	lea    0x8(%ebx),%eax
+  801786:	50                   	push   %eax
+  801787:	e8 0e e9 ff ff       	call   80009a <sys_cputs>
+		b->idx = 0;
+  80178c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801792:	83 c4 10             	add    $0x10,%esp
+  801795:	eb db                	jmp    801772 <putch+0x1f>
+
+00801797 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801797:	55                   	push   %ebp
+  801798:	89 e5                	mov    %esp,%ebp
+  80179a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017a0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017a7:	00 00 00 
+	b.cnt = 0;
+  8017aa:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017b1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017b4:	ff 75 0c             	push   0xc(%ebp)
+  8017b7:	ff 75 08             	push   0x8(%ebp)
+  8017ba:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017c0:	50                   	push   %eax
+  8017c1:	68 53 17 80 00       	push   $0x801753
+  8017c6:	e8 14 01 00 00       	call   8018df <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017cb:	83 c4 08             	add    $0x8,%esp
+  8017ce:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017d4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017da:	50                   	push   %eax
+  8017db:	e8 ba e8 ff ff       	call   80009a <sys_cputs>
+
+	return b.cnt;
+}
+  8017e0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017e6:	c9                   	leave
+  8017e7:	c3                   	ret
+
+008017e8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017ee:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8017f1:	50                   	push   %eax
+  8017f2:	ff 75 08             	push   0x8(%ebp)
+  8017f5:	e8 9d ff ff ff       	call   801797 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8017fa:	c9                   	leave
+  8017fb:	c3                   	ret
+
+008017fc <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8017fc:	55                   	push   %ebp
+  8017fd:	89 e5                	mov    %esp,%ebp
+  8017ff:	57                   	push   %edi
+  801800:	56                   	push   %esi
+  801801:	53                   	push   %ebx
+  801802:	83 ec 1c             	sub    $0x1c,%esp
+  801805:	89 c7                	mov    %eax,%edi
+  801807:	89 d6                	mov    %edx,%esi
+  801809:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80180f:	89 d1                	mov    %edx,%ecx
+  801811:	89 c2                	mov    %eax,%edx
+  801813:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801816:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801819:	8b 45 10             	mov    0x10(%ebp),%eax
+  80181c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80181f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801822:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801829:	39 c2                	cmp    %eax,%edx
+  80182b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80182e:	72 3e                	jb     80186e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801830:	83 ec 0c             	sub    $0xc,%esp
+  801833:	ff 75 18             	push   0x18(%ebp)
+  801836:	83 eb 01             	sub    $0x1,%ebx
+  801839:	53                   	push   %ebx
+  80183a:	50                   	push   %eax
+  80183b:	83 ec 08             	sub    $0x8,%esp
+  80183e:	ff 75 e4             	push   -0x1c(%ebp)
+  801841:	ff 75 e0             	push   -0x20(%ebp)
+  801844:	ff 75 dc             	push   -0x24(%ebp)
+  801847:	ff 75 d8             	push   -0x28(%ebp)
+  80184a:	e8 b1 0a 00 00       	call   802300 <__udivdi3>
+  80184f:	83 c4 18             	add    $0x18,%esp
+  801852:	52                   	push   %edx
+  801853:	50                   	push   %eax
+  801854:	89 f2                	mov    %esi,%edx
+  801856:	89 f8                	mov    %edi,%eax
+  801858:	e8 9f ff ff ff       	call   8017fc <printnum>
+  80185d:	83 c4 20             	add    $0x20,%esp
+  801860:	eb 13                	jmp    801875 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801862:	83 ec 08             	sub    $0x8,%esp
+  801865:	56                   	push   %esi
+  801866:	ff 75 18             	push   0x18(%ebp)
+  801869:	ff d7                	call   *%edi
+  80186b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80186e:	83 eb 01             	sub    $0x1,%ebx
+  801871:	85 db                	test   %ebx,%ebx
+  801873:	7f ed                	jg     801862 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801875:	83 ec 08             	sub    $0x8,%esp
+  801878:	56                   	push   %esi
+  801879:	83 ec 04             	sub    $0x4,%esp
+  80187c:	ff 75 e4             	push   -0x1c(%ebp)
+  80187f:	ff 75 e0             	push   -0x20(%ebp)
+  801882:	ff 75 dc             	push   -0x24(%ebp)
+  801885:	ff 75 d8             	push   -0x28(%ebp)
+  801888:	e8 33 0b 00 00       	call   8023c0 <__umoddi3>
+  80188d:	83 c4 14             	add    $0x14,%esp
+  801890:	0f be 80 03 28 80 00 	movsbl 0x802803(%eax),%eax
+  801897:	50                   	push   %eax
+  801898:	ff d7                	call   *%edi
+}
+  80189a:	83 c4 10             	add    $0x10,%esp
+  80189d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a0:	5b                   	pop    %ebx
+  8018a1:	5e                   	pop    %esi
+  8018a2:	5f                   	pop    %edi
+  8018a3:	5d                   	pop    %ebp
+  8018a4:	c3                   	ret
+
+008018a5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018a5:	55                   	push   %ebp
+  8018a6:	89 e5                	mov    %esp,%ebp
+  8018a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018ab:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018af:	8b 10                	mov    (%eax),%edx
+  8018b1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018b4:	73 0a                	jae    8018c0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018b6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018b9:	89 08                	mov    %ecx,(%eax)
+  8018bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018be:	88 02                	mov    %al,(%edx)
+}
+  8018c0:	5d                   	pop    %ebp
+  8018c1:	c3                   	ret
+
+008018c2 <printfmt>:
+{
+  8018c2:	55                   	push   %ebp
+  8018c3:	89 e5                	mov    %esp,%ebp
+  8018c5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018c8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018cb:	50                   	push   %eax
+  8018cc:	ff 75 10             	push   0x10(%ebp)
+  8018cf:	ff 75 0c             	push   0xc(%ebp)
+  8018d2:	ff 75 08             	push   0x8(%ebp)
+  8018d5:	e8 05 00 00 00       	call   8018df <vprintfmt>
+}
+  8018da:	83 c4 10             	add    $0x10,%esp
+  8018dd:	c9                   	leave
+  8018de:	c3                   	ret
+
+008018df <vprintfmt>:
+{
+  8018df:	55                   	push   %ebp
+  8018e0:	89 e5                	mov    %esp,%ebp
+  8018e2:	57                   	push   %edi
+  8018e3:	56                   	push   %esi
+  8018e4:	53                   	push   %ebx
+  8018e5:	83 ec 2c             	sub    $0x2c,%esp
+  8018e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018eb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018ee:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8018f1:	eb 0a                	jmp    8018fd <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8018f3:	83 ec 08             	sub    $0x8,%esp
+  8018f6:	53                   	push   %ebx
+  8018f7:	50                   	push   %eax
+  8018f8:	ff d6                	call   *%esi
+  8018fa:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8018fd:	83 c7 01             	add    $0x1,%edi
+  801900:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801904:	83 f8 25             	cmp    $0x25,%eax
+  801907:	74 0c                	je     801915 <vprintfmt+0x36>
+			if (ch == '\0')
+  801909:	85 c0                	test   %eax,%eax
+  80190b:	75 e6                	jne    8018f3 <vprintfmt+0x14>
+}
+  80190d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801910:	5b                   	pop    %ebx
+  801911:	5e                   	pop    %esi
+  801912:	5f                   	pop    %edi
+  801913:	5d                   	pop    %ebp
+  801914:	c3                   	ret
+		padc = ' ';
+  801915:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801919:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801920:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801927:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80192e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801933:	8d 47 01             	lea    0x1(%edi),%eax
+  801936:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801939:	0f b6 17             	movzbl (%edi),%edx
+  80193c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80193f:	3c 55                	cmp    $0x55,%al
+  801941:	0f 87 cf 03 00 00    	ja     801d16 <vprintfmt+0x437>
+  801947:	0f b6 c0             	movzbl %al,%eax
+  80194a:	ff 24 85 40 29 80 00 	jmp    *0x802940(,%eax,4)
+  801951:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801954:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801958:	eb d9                	jmp    801933 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80195a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80195d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801961:	eb d0                	jmp    801933 <vprintfmt+0x54>
+  801963:	0f b6 d2             	movzbl %dl,%edx
+  801966:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801971:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801974:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801978:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80197b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80197e:	83 f9 09             	cmp    $0x9,%ecx
+  801981:	77 55                	ja     8019d8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801983:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801986:	eb e9                	jmp    801971 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801988:	8b 45 14             	mov    0x14(%ebp),%eax
+  80198b:	8b 00                	mov    (%eax),%eax
+  80198d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801990:	8b 45 14             	mov    0x14(%ebp),%eax
+  801993:	8d 40 04             	lea    0x4(%eax),%eax
+  801996:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801999:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80199c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019a0:	79 91                	jns    801933 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019a2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019a8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019af:	eb 82                	jmp    801933 <vprintfmt+0x54>
+			if (width < 0)
+  8019b1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019b4:	85 d2                	test   %edx,%edx
+  8019b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019bb:	0f 49 c2             	cmovns %edx,%eax
+  8019be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019c4:	e9 6a ff ff ff       	jmp    801933 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019cc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019d3:	e9 5b ff ff ff       	jmp    801933 <vprintfmt+0x54>
+  8019d8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019db:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019de:	eb bc                	jmp    80199c <vprintfmt+0xbd>
+			lflag++;
+  8019e0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019e6:	e9 48 ff ff ff       	jmp    801933 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019ee:	8d 78 04             	lea    0x4(%eax),%edi
+  8019f1:	83 ec 08             	sub    $0x8,%esp
+  8019f4:	53                   	push   %ebx
+  8019f5:	ff 30                	push   (%eax)
+  8019f7:	ff d6                	call   *%esi
+			break;
+  8019f9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8019fc:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8019ff:	e9 b1 02 00 00       	jmp    801cb5 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801a04:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a07:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a0a:	8b 10                	mov    (%eax),%edx
+  801a0c:	89 d0                	mov    %edx,%eax
+  801a0e:	f7 d8                	neg    %eax
+  801a10:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a13:	83 f8 0f             	cmp    $0xf,%eax
+  801a16:	7f 23                	jg     801a3b <vprintfmt+0x15c>
+  801a18:	8b 14 85 a0 2a 80 00 	mov    0x802aa0(,%eax,4),%edx
+  801a1f:	85 d2                	test   %edx,%edx
+  801a21:	74 18                	je     801a3b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a23:	52                   	push   %edx
+  801a24:	68 61 27 80 00       	push   $0x802761
+  801a29:	53                   	push   %ebx
+  801a2a:	56                   	push   %esi
+  801a2b:	e8 92 fe ff ff       	call   8018c2 <printfmt>
+  801a30:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a33:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a36:	e9 7a 02 00 00       	jmp    801cb5 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801a3b:	50                   	push   %eax
+  801a3c:	68 1b 28 80 00       	push   $0x80281b
+  801a41:	53                   	push   %ebx
+  801a42:	56                   	push   %esi
+  801a43:	e8 7a fe ff ff       	call   8018c2 <printfmt>
+  801a48:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a4b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a4e:	e9 62 02 00 00       	jmp    801cb5 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a53:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a56:	83 c0 04             	add    $0x4,%eax
+  801a59:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a5c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a5f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a61:	85 c9                	test   %ecx,%ecx
+  801a63:	b8 14 28 80 00       	mov    $0x802814,%eax
+  801a68:	0f 45 c1             	cmovne %ecx,%eax
+  801a6b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a6e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a72:	7e 06                	jle    801a7a <vprintfmt+0x19b>
+  801a74:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a78:	75 0b                	jne    801a85 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a7a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a7d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a80:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a83:	eb 5c                	jmp    801ae1 <vprintfmt+0x202>
+  801a85:	83 ec 08             	sub    $0x8,%esp
+  801a88:	ff 75 d0             	push   -0x30(%ebp)
+  801a8b:	ff 75 cc             	push   -0x34(%ebp)
+  801a8e:	e8 20 03 00 00       	call   801db3 <strnlen>
+  801a93:	89 c2                	mov    %eax,%edx
+  801a95:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a98:	29 d0                	sub    %edx,%eax
+  801a9a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801a9d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801aa1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801aa4:	89 75 08             	mov    %esi,0x8(%ebp)
+  801aa7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aa9:	eb 0e                	jmp    801ab9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801aab:	83 ec 08             	sub    $0x8,%esp
+  801aae:	53                   	push   %ebx
+  801aaf:	57                   	push   %edi
+  801ab0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ab3:	83 ee 01             	sub    $0x1,%esi
+  801ab6:	83 c4 10             	add    $0x10,%esp
+  801ab9:	85 f6                	test   %esi,%esi
+  801abb:	7f ee                	jg     801aab <vprintfmt+0x1cc>
+  801abd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ac0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ac3:	85 c0                	test   %eax,%eax
+  801ac5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aca:	0f 49 d0             	cmovns %eax,%edx
+  801acd:	29 d0                	sub    %edx,%eax
+  801acf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ad2:	eb a6                	jmp    801a7a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ad4:	83 ec 08             	sub    $0x8,%esp
+  801ad7:	53                   	push   %ebx
+  801ad8:	52                   	push   %edx
+  801ad9:	ff 55 08             	call   *0x8(%ebp)
+  801adc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801adf:	89 f1                	mov    %esi,%ecx
+  801ae1:	8d 71 01             	lea    0x1(%ecx),%esi
+  801ae4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801ae8:	0f be d0             	movsbl %al,%edx
+  801aeb:	85 d2                	test   %edx,%edx
+  801aed:	74 28                	je     801b17 <vprintfmt+0x238>
+  801aef:	85 ff                	test   %edi,%edi
+  801af1:	78 05                	js     801af8 <vprintfmt+0x219>
+  801af3:	83 ef 01             	sub    $0x1,%edi
+  801af6:	78 30                	js     801b28 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801af8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801afc:	74 d6                	je     801ad4 <vprintfmt+0x1f5>
+  801afe:	0f be c0             	movsbl %al,%eax
+  801b01:	83 e8 20             	sub    $0x20,%eax
+  801b04:	83 f8 5e             	cmp    $0x5e,%eax
+  801b07:	76 cb                	jbe    801ad4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b09:	83 ec 08             	sub    $0x8,%esp
+  801b0c:	53                   	push   %ebx
+  801b0d:	6a 3f                	push   $0x3f
+  801b0f:	ff 55 08             	call   *0x8(%ebp)
+  801b12:	83 c4 10             	add    $0x10,%esp
+  801b15:	eb c8                	jmp    801adf <vprintfmt+0x200>
+  801b17:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b1a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b1d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b20:	01 d0                	add    %edx,%eax
+  801b22:	29 c8                	sub    %ecx,%eax
+  801b24:	89 c7                	mov    %eax,%edi
+  801b26:	eb 13                	jmp    801b3b <vprintfmt+0x25c>
+  801b28:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b2b:	eb ed                	jmp    801b1a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b2d:	83 ec 08             	sub    $0x8,%esp
+  801b30:	53                   	push   %ebx
+  801b31:	6a 20                	push   $0x20
+  801b33:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b35:	83 ef 01             	sub    $0x1,%edi
+  801b38:	83 c4 10             	add    $0x10,%esp
+  801b3b:	85 ff                	test   %edi,%edi
+  801b3d:	7f ee                	jg     801b2d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b3f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b42:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b45:	e9 6b 01 00 00       	jmp    801cb5 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801b4a:	83 f9 01             	cmp    $0x1,%ecx
+  801b4d:	7f 1f                	jg     801b6e <vprintfmt+0x28f>
+	else if (lflag)
+  801b4f:	85 c9                	test   %ecx,%ecx
+  801b51:	74 67                	je     801bba <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801b53:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b56:	8b 00                	mov    (%eax),%eax
+  801b58:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b5b:	89 c1                	mov    %eax,%ecx
+  801b5d:	c1 f9 1f             	sar    $0x1f,%ecx
+  801b60:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801b63:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b66:	8d 40 04             	lea    0x4(%eax),%eax
+  801b69:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b6c:	eb 17                	jmp    801b85 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801b6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b71:	8b 50 04             	mov    0x4(%eax),%edx
+  801b74:	8b 00                	mov    (%eax),%eax
+  801b76:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b79:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b7c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b7f:	8d 40 08             	lea    0x8(%eax),%eax
+  801b82:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b85:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b88:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b8b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801b90:	85 c9                	test   %ecx,%ecx
+  801b92:	0f 89 03 01 00 00    	jns    801c9b <vprintfmt+0x3bc>
+				putch('-', putdat);
+  801b98:	83 ec 08             	sub    $0x8,%esp
+  801b9b:	53                   	push   %ebx
+  801b9c:	6a 2d                	push   $0x2d
+  801b9e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801ba0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801ba3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801ba6:	f7 da                	neg    %edx
+  801ba8:	83 d1 00             	adc    $0x0,%ecx
+  801bab:	f7 d9                	neg    %ecx
+  801bad:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bb0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bb5:	e9 e1 00 00 00       	jmp    801c9b <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  801bba:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bbd:	8b 00                	mov    (%eax),%eax
+  801bbf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bc2:	89 c1                	mov    %eax,%ecx
+  801bc4:	c1 f9 1f             	sar    $0x1f,%ecx
+  801bc7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801bca:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bcd:	8d 40 04             	lea    0x4(%eax),%eax
+  801bd0:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bd3:	eb b0                	jmp    801b85 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801bd5:	83 f9 01             	cmp    $0x1,%ecx
+  801bd8:	7f 1e                	jg     801bf8 <vprintfmt+0x319>
+	else if (lflag)
+  801bda:	85 c9                	test   %ecx,%ecx
+  801bdc:	74 32                	je     801c10 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  801bde:	8b 45 14             	mov    0x14(%ebp),%eax
+  801be1:	8b 10                	mov    (%eax),%edx
+  801be3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be8:	8d 40 04             	lea    0x4(%eax),%eax
+  801beb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bee:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801bf3:	e9 a3 00 00 00       	jmp    801c9b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801bf8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bfb:	8b 10                	mov    (%eax),%edx
+  801bfd:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c00:	8d 40 08             	lea    0x8(%eax),%eax
+  801c03:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c06:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c0b:	e9 8b 00 00 00       	jmp    801c9b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c10:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c13:	8b 10                	mov    (%eax),%edx
+  801c15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c1a:	8d 40 04             	lea    0x4(%eax),%eax
+  801c1d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c20:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c25:	eb 74                	jmp    801c9b <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  801c27:	83 f9 01             	cmp    $0x1,%ecx
+  801c2a:	7f 1b                	jg     801c47 <vprintfmt+0x368>
+	else if (lflag)
+  801c2c:	85 c9                	test   %ecx,%ecx
+  801c2e:	74 2c                	je     801c5c <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  801c30:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c33:	8b 10                	mov    (%eax),%edx
+  801c35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c3a:	8d 40 04             	lea    0x4(%eax),%eax
+  801c3d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c40:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  801c45:	eb 54                	jmp    801c9b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c47:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c4a:	8b 10                	mov    (%eax),%edx
+  801c4c:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c4f:	8d 40 08             	lea    0x8(%eax),%eax
+  801c52:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c55:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  801c5a:	eb 3f                	jmp    801c9b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c5c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c5f:	8b 10                	mov    (%eax),%edx
+  801c61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c66:	8d 40 04             	lea    0x4(%eax),%eax
+  801c69:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c6c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  801c71:	eb 28                	jmp    801c9b <vprintfmt+0x3bc>
+			putch('0', putdat);
+  801c73:	83 ec 08             	sub    $0x8,%esp
+  801c76:	53                   	push   %ebx
+  801c77:	6a 30                	push   $0x30
+  801c79:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c7b:	83 c4 08             	add    $0x8,%esp
+  801c7e:	53                   	push   %ebx
+  801c7f:	6a 78                	push   $0x78
+  801c81:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c83:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c86:	8b 10                	mov    (%eax),%edx
+  801c88:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801c8d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801c90:	8d 40 04             	lea    0x4(%eax),%eax
+  801c93:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801c96:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801c9b:	83 ec 0c             	sub    $0xc,%esp
+  801c9e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801ca2:	50                   	push   %eax
+  801ca3:	ff 75 e0             	push   -0x20(%ebp)
+  801ca6:	57                   	push   %edi
+  801ca7:	51                   	push   %ecx
+  801ca8:	52                   	push   %edx
+  801ca9:	89 da                	mov    %ebx,%edx
+  801cab:	89 f0                	mov    %esi,%eax
+  801cad:	e8 4a fb ff ff       	call   8017fc <printnum>
+			break;
+  801cb2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801cb5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801cb8:	e9 40 fc ff ff       	jmp    8018fd <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801cbd:	83 f9 01             	cmp    $0x1,%ecx
+  801cc0:	7f 1b                	jg     801cdd <vprintfmt+0x3fe>
+	else if (lflag)
+  801cc2:	85 c9                	test   %ecx,%ecx
+  801cc4:	74 2c                	je     801cf2 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  801cc6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cc9:	8b 10                	mov    (%eax),%edx
+  801ccb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cd0:	8d 40 04             	lea    0x4(%eax),%eax
+  801cd3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cd6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801cdb:	eb be                	jmp    801c9b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801cdd:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ce0:	8b 10                	mov    (%eax),%edx
+  801ce2:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ce5:	8d 40 08             	lea    0x8(%eax),%eax
+  801ce8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ceb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801cf0:	eb a9                	jmp    801c9b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801cf2:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf5:	8b 10                	mov    (%eax),%edx
+  801cf7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cfc:	8d 40 04             	lea    0x4(%eax),%eax
+  801cff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d02:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d07:	eb 92                	jmp    801c9b <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  801d09:	83 ec 08             	sub    $0x8,%esp
+  801d0c:	53                   	push   %ebx
+  801d0d:	6a 25                	push   $0x25
+  801d0f:	ff d6                	call   *%esi
+			break;
+  801d11:	83 c4 10             	add    $0x10,%esp
+  801d14:	eb 9f                	jmp    801cb5 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  801d16:	83 ec 08             	sub    $0x8,%esp
+  801d19:	53                   	push   %ebx
+  801d1a:	6a 25                	push   $0x25
+  801d1c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d1e:	83 c4 10             	add    $0x10,%esp
+  801d21:	89 f8                	mov    %edi,%eax
+  801d23:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d27:	74 05                	je     801d2e <vprintfmt+0x44f>
+  801d29:	83 e8 01             	sub    $0x1,%eax
+  801d2c:	eb f5                	jmp    801d23 <vprintfmt+0x444>
+  801d2e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d31:	eb 82                	jmp    801cb5 <vprintfmt+0x3d6>
+
+00801d33 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d33:	55                   	push   %ebp
+  801d34:	89 e5                	mov    %esp,%ebp
+  801d36:	83 ec 18             	sub    $0x18,%esp
+  801d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d3f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d42:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d46:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d49:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d50:	85 c0                	test   %eax,%eax
+  801d52:	74 26                	je     801d7a <vsnprintf+0x47>
+  801d54:	85 d2                	test   %edx,%edx
+  801d56:	7e 22                	jle    801d7a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d58:	ff 75 14             	push   0x14(%ebp)
+  801d5b:	ff 75 10             	push   0x10(%ebp)
+  801d5e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d61:	50                   	push   %eax
+  801d62:	68 a5 18 80 00       	push   $0x8018a5
+  801d67:	e8 73 fb ff ff       	call   8018df <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d6c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d6f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d75:	83 c4 10             	add    $0x10,%esp
+}
+  801d78:	c9                   	leave
+  801d79:	c3                   	ret
+		return -E_INVAL;
+  801d7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d7f:	eb f7                	jmp    801d78 <vsnprintf+0x45>
+
+00801d81 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d81:	55                   	push   %ebp
+  801d82:	89 e5                	mov    %esp,%ebp
+  801d84:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d87:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d8a:	50                   	push   %eax
+  801d8b:	ff 75 10             	push   0x10(%ebp)
+  801d8e:	ff 75 0c             	push   0xc(%ebp)
+  801d91:	ff 75 08             	push   0x8(%ebp)
+  801d94:	e8 9a ff ff ff       	call   801d33 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801d99:	c9                   	leave
+  801d9a:	c3                   	ret
+
+00801d9b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801d9b:	55                   	push   %ebp
+  801d9c:	89 e5                	mov    %esp,%ebp
+  801d9e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801da1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da6:	eb 03                	jmp    801dab <strlen+0x10>
+		n++;
+  801da8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801dab:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801daf:	75 f7                	jne    801da8 <strlen+0xd>
+	return n;
+}
+  801db1:	5d                   	pop    %ebp
+  801db2:	c3                   	ret
+
+00801db3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801db3:	55                   	push   %ebp
+  801db4:	89 e5                	mov    %esp,%ebp
+  801db6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801db9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc1:	eb 03                	jmp    801dc6 <strnlen+0x13>
+		n++;
+  801dc3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dc6:	39 d0                	cmp    %edx,%eax
+  801dc8:	74 08                	je     801dd2 <strnlen+0x1f>
+  801dca:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801dce:	75 f3                	jne    801dc3 <strnlen+0x10>
+  801dd0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801dd2:	89 d0                	mov    %edx,%eax
+  801dd4:	5d                   	pop    %ebp
+  801dd5:	c3                   	ret
+
+00801dd6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801dd6:	55                   	push   %ebp
+  801dd7:	89 e5                	mov    %esp,%ebp
+  801dd9:	53                   	push   %ebx
+  801dda:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ddd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801de0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801de9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801dec:	83 c0 01             	add    $0x1,%eax
+  801def:	84 d2                	test   %dl,%dl
+  801df1:	75 f2                	jne    801de5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801df3:	89 c8                	mov    %ecx,%eax
+  801df5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801df8:	c9                   	leave
+  801df9:	c3                   	ret
+
+00801dfa <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801dfa:	55                   	push   %ebp
+  801dfb:	89 e5                	mov    %esp,%ebp
+  801dfd:	53                   	push   %ebx
+  801dfe:	83 ec 10             	sub    $0x10,%esp
+  801e01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e04:	53                   	push   %ebx
+  801e05:	e8 91 ff ff ff       	call   801d9b <strlen>
+  801e0a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e0d:	ff 75 0c             	push   0xc(%ebp)
+  801e10:	01 d8                	add    %ebx,%eax
+  801e12:	50                   	push   %eax
+  801e13:	e8 be ff ff ff       	call   801dd6 <strcpy>
+	return dst;
+}
+  801e18:	89 d8                	mov    %ebx,%eax
+  801e1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e1d:	c9                   	leave
+  801e1e:	c3                   	ret
+
+00801e1f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e1f:	55                   	push   %ebp
+  801e20:	89 e5                	mov    %esp,%ebp
+  801e22:	56                   	push   %esi
+  801e23:	53                   	push   %ebx
+  801e24:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e27:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e2a:	89 f3                	mov    %esi,%ebx
+  801e2c:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e2f:	89 f0                	mov    %esi,%eax
+  801e31:	eb 0f                	jmp    801e42 <strncpy+0x23>
+		*dst++ = *src;
+  801e33:	83 c0 01             	add    $0x1,%eax
+  801e36:	0f b6 0a             	movzbl (%edx),%ecx
+  801e39:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e3c:	80 f9 01             	cmp    $0x1,%cl
+  801e3f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e42:	39 d8                	cmp    %ebx,%eax
+  801e44:	75 ed                	jne    801e33 <strncpy+0x14>
+	}
+	return ret;
+}
+  801e46:	89 f0                	mov    %esi,%eax
+  801e48:	5b                   	pop    %ebx
+  801e49:	5e                   	pop    %esi
+  801e4a:	5d                   	pop    %ebp
+  801e4b:	c3                   	ret
+
+00801e4c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e4c:	55                   	push   %ebp
+  801e4d:	89 e5                	mov    %esp,%ebp
+  801e4f:	56                   	push   %esi
+  801e50:	53                   	push   %ebx
+  801e51:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e57:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e5a:	89 f0                	mov    %esi,%eax
+  801e5c:	85 d2                	test   %edx,%edx
+  801e5e:	74 21                	je     801e81 <strlcpy+0x35>
+  801e60:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e64:	89 f2                	mov    %esi,%edx
+  801e66:	eb 09                	jmp    801e71 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e68:	83 c1 01             	add    $0x1,%ecx
+  801e6b:	83 c2 01             	add    $0x1,%edx
+  801e6e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e71:	39 c2                	cmp    %eax,%edx
+  801e73:	74 09                	je     801e7e <strlcpy+0x32>
+  801e75:	0f b6 19             	movzbl (%ecx),%ebx
+  801e78:	84 db                	test   %bl,%bl
+  801e7a:	75 ec                	jne    801e68 <strlcpy+0x1c>
+  801e7c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e7e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e81:	29 f0                	sub    %esi,%eax
+}
+  801e83:	5b                   	pop    %ebx
+  801e84:	5e                   	pop    %esi
+  801e85:	5d                   	pop    %ebp
+  801e86:	c3                   	ret
+
+00801e87 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e87:	55                   	push   %ebp
+  801e88:	89 e5                	mov    %esp,%ebp
+  801e8a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801e90:	eb 06                	jmp    801e98 <strcmp+0x11>
+		p++, q++;
+  801e92:	83 c1 01             	add    $0x1,%ecx
+  801e95:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801e98:	0f b6 01             	movzbl (%ecx),%eax
+  801e9b:	84 c0                	test   %al,%al
+  801e9d:	74 04                	je     801ea3 <strcmp+0x1c>
+  801e9f:	3a 02                	cmp    (%edx),%al
+  801ea1:	74 ef                	je     801e92 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ea3:	0f b6 c0             	movzbl %al,%eax
+  801ea6:	0f b6 12             	movzbl (%edx),%edx
+  801ea9:	29 d0                	sub    %edx,%eax
+}
+  801eab:	5d                   	pop    %ebp
+  801eac:	c3                   	ret
+
+00801ead <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ead:	55                   	push   %ebp
+  801eae:	89 e5                	mov    %esp,%ebp
+  801eb0:	53                   	push   %ebx
+  801eb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eb7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801eba:	eb 09                	jmp    801ec5 <strncmp+0x18>
+		n--, p++, q++;
+  801ebc:	83 ea 01             	sub    $0x1,%edx
+  801ebf:	83 c0 01             	add    $0x1,%eax
+  801ec2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ec5:	85 d2                	test   %edx,%edx
+  801ec7:	74 18                	je     801ee1 <strncmp+0x34>
+  801ec9:	0f b6 18             	movzbl (%eax),%ebx
+  801ecc:	84 db                	test   %bl,%bl
+  801ece:	74 04                	je     801ed4 <strncmp+0x27>
+  801ed0:	3a 19                	cmp    (%ecx),%bl
+  801ed2:	74 e8                	je     801ebc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ed4:	0f b6 00             	movzbl (%eax),%eax
+  801ed7:	0f b6 11             	movzbl (%ecx),%edx
+  801eda:	29 d0                	sub    %edx,%eax
+}
+  801edc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801edf:	c9                   	leave
+  801ee0:	c3                   	ret
+		return 0;
+  801ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee6:	eb f4                	jmp    801edc <strncmp+0x2f>
+
+00801ee8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eee:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801ef2:	eb 03                	jmp    801ef7 <strchr+0xf>
+  801ef4:	83 c0 01             	add    $0x1,%eax
+  801ef7:	0f b6 10             	movzbl (%eax),%edx
+  801efa:	84 d2                	test   %dl,%dl
+  801efc:	74 06                	je     801f04 <strchr+0x1c>
+		if (*s == c)
+  801efe:	38 ca                	cmp    %cl,%dl
+  801f00:	75 f2                	jne    801ef4 <strchr+0xc>
+  801f02:	eb 05                	jmp    801f09 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f09:	5d                   	pop    %ebp
+  801f0a:	c3                   	ret
+
+00801f0b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f0b:	55                   	push   %ebp
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f11:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f15:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f18:	38 ca                	cmp    %cl,%dl
+  801f1a:	74 09                	je     801f25 <strfind+0x1a>
+  801f1c:	84 d2                	test   %dl,%dl
+  801f1e:	74 05                	je     801f25 <strfind+0x1a>
+	for (; *s; s++)
+  801f20:	83 c0 01             	add    $0x1,%eax
+  801f23:	eb f0                	jmp    801f15 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f25:	5d                   	pop    %ebp
+  801f26:	c3                   	ret
+
+00801f27 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f27:	55                   	push   %ebp
+  801f28:	89 e5                	mov    %esp,%ebp
+  801f2a:	57                   	push   %edi
+  801f2b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f2e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f31:	85 c9                	test   %ecx,%ecx
+  801f33:	74 20                	je     801f55 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f35:	89 f8                	mov    %edi,%eax
+  801f37:	09 c8                	or     %ecx,%eax
+  801f39:	a8 03                	test   $0x3,%al
+  801f3b:	75 12                	jne    801f4f <memset+0x28>
+		c &= 0xFF;
+  801f3d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f41:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f47:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f4a:	fc                   	cld
+  801f4b:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f4d:	eb 06                	jmp    801f55 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f52:	fc                   	cld
+  801f53:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f55:	89 f8                	mov    %edi,%eax
+  801f57:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f5a:	c9                   	leave
+  801f5b:	c3                   	ret
+
+00801f5c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f5c:	55                   	push   %ebp
+  801f5d:	89 e5                	mov    %esp,%ebp
+  801f5f:	57                   	push   %edi
+  801f60:	56                   	push   %esi
+  801f61:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f64:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f67:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f6a:	39 c6                	cmp    %eax,%esi
+  801f6c:	73 32                	jae    801fa0 <memmove+0x44>
+  801f6e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f71:	39 d0                	cmp    %edx,%eax
+  801f73:	73 2b                	jae    801fa0 <memmove+0x44>
+		s += n;
+		d += n;
+  801f75:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f78:	89 d6                	mov    %edx,%esi
+  801f7a:	09 fe                	or     %edi,%esi
+  801f7c:	09 ce                	or     %ecx,%esi
+  801f7e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f84:	75 0e                	jne    801f94 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f86:	83 ef 04             	sub    $0x4,%edi
+  801f89:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f8c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f8f:	fd                   	std
+  801f90:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f92:	eb 09                	jmp    801f9d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801f94:	83 ef 01             	sub    $0x1,%edi
+  801f97:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801f9a:	fd                   	std
+  801f9b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801f9d:	fc                   	cld
+  801f9e:	eb 1a                	jmp    801fba <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fa0:	89 f2                	mov    %esi,%edx
+  801fa2:	09 c2                	or     %eax,%edx
+  801fa4:	09 ca                	or     %ecx,%edx
+  801fa6:	f6 c2 03             	test   $0x3,%dl
+  801fa9:	75 0a                	jne    801fb5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fab:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fae:	89 c7                	mov    %eax,%edi
+  801fb0:	fc                   	cld
+  801fb1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fb3:	eb 05                	jmp    801fba <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fb5:	89 c7                	mov    %eax,%edi
+  801fb7:	fc                   	cld
+  801fb8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fba:	5e                   	pop    %esi
+  801fbb:	5f                   	pop    %edi
+  801fbc:	5d                   	pop    %ebp
+  801fbd:	c3                   	ret
+
+00801fbe <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fbe:	55                   	push   %ebp
+  801fbf:	89 e5                	mov    %esp,%ebp
+  801fc1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fc4:	ff 75 10             	push   0x10(%ebp)
+  801fc7:	ff 75 0c             	push   0xc(%ebp)
+  801fca:	ff 75 08             	push   0x8(%ebp)
+  801fcd:	e8 8a ff ff ff       	call   801f5c <memmove>
+}
+  801fd2:	c9                   	leave
+  801fd3:	c3                   	ret
+
+00801fd4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fd4:	55                   	push   %ebp
+  801fd5:	89 e5                	mov    %esp,%ebp
+  801fd7:	56                   	push   %esi
+  801fd8:	53                   	push   %ebx
+  801fd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fdc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fdf:	89 c6                	mov    %eax,%esi
+  801fe1:	03 75 10             	add    0x10(%ebp),%esi
+  801fe4:	eb 06                	jmp    801fec <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801fe6:	83 c0 01             	add    $0x1,%eax
+  801fe9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801fec:	39 f0                	cmp    %esi,%eax
+  801fee:	74 14                	je     802004 <memcmp+0x30>
+		if (*s1 != *s2)
+  801ff0:	0f b6 08             	movzbl (%eax),%ecx
+  801ff3:	0f b6 1a             	movzbl (%edx),%ebx
+  801ff6:	38 d9                	cmp    %bl,%cl
+  801ff8:	74 ec                	je     801fe6 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801ffa:	0f b6 c1             	movzbl %cl,%eax
+  801ffd:	0f b6 db             	movzbl %bl,%ebx
+  802000:	29 d8                	sub    %ebx,%eax
+  802002:	eb 05                	jmp    802009 <memcmp+0x35>
+	}
+
+	return 0;
+  802004:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802009:	5b                   	pop    %ebx
+  80200a:	5e                   	pop    %esi
+  80200b:	5d                   	pop    %ebp
+  80200c:	c3                   	ret
+
+0080200d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80200d:	55                   	push   %ebp
+  80200e:	89 e5                	mov    %esp,%ebp
+  802010:	8b 45 08             	mov    0x8(%ebp),%eax
+  802013:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802016:	89 c2                	mov    %eax,%edx
+  802018:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80201b:	eb 03                	jmp    802020 <memfind+0x13>
+  80201d:	83 c0 01             	add    $0x1,%eax
+  802020:	39 d0                	cmp    %edx,%eax
+  802022:	73 04                	jae    802028 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802024:	38 08                	cmp    %cl,(%eax)
+  802026:	75 f5                	jne    80201d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802028:	5d                   	pop    %ebp
+  802029:	c3                   	ret
+
+0080202a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80202a:	55                   	push   %ebp
+  80202b:	89 e5                	mov    %esp,%ebp
+  80202d:	57                   	push   %edi
+  80202e:	56                   	push   %esi
+  80202f:	53                   	push   %ebx
+  802030:	8b 55 08             	mov    0x8(%ebp),%edx
+  802033:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802036:	eb 03                	jmp    80203b <strtol+0x11>
+		s++;
+  802038:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80203b:	0f b6 02             	movzbl (%edx),%eax
+  80203e:	3c 20                	cmp    $0x20,%al
+  802040:	74 f6                	je     802038 <strtol+0xe>
+  802042:	3c 09                	cmp    $0x9,%al
+  802044:	74 f2                	je     802038 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802046:	3c 2b                	cmp    $0x2b,%al
+  802048:	74 2a                	je     802074 <strtol+0x4a>
+	int neg = 0;
+  80204a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80204f:	3c 2d                	cmp    $0x2d,%al
+  802051:	74 2b                	je     80207e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802053:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802059:	75 0f                	jne    80206a <strtol+0x40>
+  80205b:	80 3a 30             	cmpb   $0x30,(%edx)
+  80205e:	74 28                	je     802088 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802060:	85 db                	test   %ebx,%ebx
+  802062:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802067:	0f 44 d8             	cmove  %eax,%ebx
+  80206a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80206f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802072:	eb 46                	jmp    8020ba <strtol+0x90>
+		s++;
+  802074:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802077:	bf 00 00 00 00       	mov    $0x0,%edi
+  80207c:	eb d5                	jmp    802053 <strtol+0x29>
+		s++, neg = 1;
+  80207e:	83 c2 01             	add    $0x1,%edx
+  802081:	bf 01 00 00 00       	mov    $0x1,%edi
+  802086:	eb cb                	jmp    802053 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802088:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80208c:	74 0e                	je     80209c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80208e:	85 db                	test   %ebx,%ebx
+  802090:	75 d8                	jne    80206a <strtol+0x40>
+		s++, base = 8;
+  802092:	83 c2 01             	add    $0x1,%edx
+  802095:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80209a:	eb ce                	jmp    80206a <strtol+0x40>
+		s += 2, base = 16;
+  80209c:	83 c2 02             	add    $0x2,%edx
+  80209f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020a4:	eb c4                	jmp    80206a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020a6:	0f be c0             	movsbl %al,%eax
+  8020a9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020ac:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020af:	7d 3a                	jge    8020eb <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020b1:	83 c2 01             	add    $0x1,%edx
+  8020b4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020b8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020ba:	0f b6 02             	movzbl (%edx),%eax
+  8020bd:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020c0:	89 f3                	mov    %esi,%ebx
+  8020c2:	80 fb 09             	cmp    $0x9,%bl
+  8020c5:	76 df                	jbe    8020a6 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020c7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020ca:	89 f3                	mov    %esi,%ebx
+  8020cc:	80 fb 19             	cmp    $0x19,%bl
+  8020cf:	77 08                	ja     8020d9 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020d1:	0f be c0             	movsbl %al,%eax
+  8020d4:	83 e8 57             	sub    $0x57,%eax
+  8020d7:	eb d3                	jmp    8020ac <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020d9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020dc:	89 f3                	mov    %esi,%ebx
+  8020de:	80 fb 19             	cmp    $0x19,%bl
+  8020e1:	77 08                	ja     8020eb <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020e3:	0f be c0             	movsbl %al,%eax
+  8020e6:	83 e8 37             	sub    $0x37,%eax
+  8020e9:	eb c1                	jmp    8020ac <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020eb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020ef:	74 05                	je     8020f6 <strtol+0xcc>
+		*endptr = (char *) s;
+  8020f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020f4:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8020f6:	89 c8                	mov    %ecx,%eax
+  8020f8:	f7 d8                	neg    %eax
+  8020fa:	85 ff                	test   %edi,%edi
+  8020fc:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8020ff:	89 c8                	mov    %ecx,%eax
+  802101:	5b                   	pop    %ebx
+  802102:	5e                   	pop    %esi
+  802103:	5f                   	pop    %edi
+  802104:	5d                   	pop    %ebp
+  802105:	c3                   	ret
+
+00802106 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802106:	55                   	push   %ebp
+  802107:	89 e5                	mov    %esp,%ebp
+  802109:	57                   	push   %edi
+  80210a:	56                   	push   %esi
+  80210b:	53                   	push   %ebx
+  80210c:	83 ec 18             	sub    $0x18,%esp
+  80210f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802112:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802115:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802118:	85 db                	test   %ebx,%ebx
+  80211a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80211f:	0f 45 c3             	cmovne %ebx,%eax
+  802122:	50                   	push   %eax
+  802123:	e8 32 e4 ff ff       	call   80055a <sys_ipc_recv>
+
+	if (from_env_store)
+  802128:	83 c4 10             	add    $0x10,%esp
+  80212b:	85 ff                	test   %edi,%edi
+  80212d:	74 17                	je     802146 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80212f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802134:	85 c0                	test   %eax,%eax
+  802136:	75 0c                	jne    802144 <ipc_recv+0x3e>
+  802138:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80213e:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802144:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802146:	85 f6                	test   %esi,%esi
+  802148:	74 2e                	je     802178 <ipc_recv+0x72>
+		if (!r && pg)
+  80214a:	85 c0                	test   %eax,%eax
+  80214c:	75 24                	jne    802172 <ipc_recv+0x6c>
+  80214e:	85 db                	test   %ebx,%ebx
+  802150:	74 20                	je     802172 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802152:	a1 08 40 80 00       	mov    0x804008,%eax
+  802157:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  80215d:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80215f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802164:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80216a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80216d:	5b                   	pop    %ebx
+  80216e:	5e                   	pop    %esi
+  80216f:	5f                   	pop    %edi
+  802170:	5d                   	pop    %ebp
+  802171:	c3                   	ret
+			*perm_store = 0;
+  802172:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802178:	85 c0                	test   %eax,%eax
+  80217a:	75 ee                	jne    80216a <ipc_recv+0x64>
+  80217c:	eb e1                	jmp    80215f <ipc_recv+0x59>
+
+0080217e <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80217e:	55                   	push   %ebp
+  80217f:	89 e5                	mov    %esp,%ebp
+  802181:	57                   	push   %edi
+  802182:	56                   	push   %esi
+  802183:	53                   	push   %ebx
+  802184:	83 ec 0c             	sub    $0xc,%esp
+  802187:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80218a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80218d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802190:	85 db                	test   %ebx,%ebx
+  802192:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802197:	0f 44 d8             	cmove  %eax,%ebx
+  80219a:	ff 75 14             	push   0x14(%ebp)
+  80219d:	53                   	push   %ebx
+  80219e:	56                   	push   %esi
+  80219f:	57                   	push   %edi
+  8021a0:	e8 92 e3 ff ff       	call   800537 <sys_ipc_try_send_yield>
+  8021a5:	83 c4 10             	add    $0x10,%esp
+  8021a8:	85 c0                	test   %eax,%eax
+  8021aa:	79 1e                	jns    8021ca <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8021ac:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021af:	75 07                	jne    8021b8 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8021b1:	e8 a1 df ff ff       	call   800157 <sys_yield>
+  8021b6:	eb e2                	jmp    80219a <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8021b8:	50                   	push   %eax
+  8021b9:	68 ff 2a 80 00       	push   $0x802aff
+  8021be:	6a 3d                	push   $0x3d
+  8021c0:	68 14 2b 80 00       	push   $0x802b14
+  8021c5:	e8 43 f5 ff ff       	call   80170d <_panic>
+	}
+}
+  8021ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021cd:	5b                   	pop    %ebx
+  8021ce:	5e                   	pop    %esi
+  8021cf:	5f                   	pop    %edi
+  8021d0:	5d                   	pop    %ebp
+  8021d1:	c3                   	ret
+
+008021d2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8021d2:	55                   	push   %ebp
+  8021d3:	89 e5                	mov    %esp,%ebp
+  8021d5:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8021d8:	ff 75 08             	push   0x8(%ebp)
+  8021db:	e8 f7 de ff ff       	call   8000d7 <sys_env_find>
+}
+  8021e0:	c9                   	leave
+  8021e1:	c3                   	ret
+
+008021e2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8021e2:	55                   	push   %ebp
+  8021e3:	89 e5                	mov    %esp,%ebp
+  8021e5:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021e8:	89 c2                	mov    %eax,%edx
+  8021ea:	c1 ea 16             	shr    $0x16,%edx
+  8021ed:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8021f4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021f9:	f6 c1 01             	test   $0x1,%cl
+  8021fc:	74 22                	je     802220 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8021fe:	c1 e8 0c             	shr    $0xc,%eax
+  802201:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802208:	a8 01                	test   $0x1,%al
+  80220a:	74 14                	je     802220 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80220c:	c1 e8 0c             	shr    $0xc,%eax
+  80220f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802212:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802219:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80221d:	0f b7 d2             	movzwl %dx,%edx
+}
+  802220:	89 d0                	mov    %edx,%eax
+  802222:	5d                   	pop    %ebp
+  802223:	c3                   	ret
+  802224:	66 90                	xchg   %ax,%ax
+  802226:	66 90                	xchg   %ax,%ax
+  802228:	66 90                	xchg   %ax,%ax
+  80222a:	66 90                	xchg   %ax,%ax
+  80222c:	66 90                	xchg   %ax,%ax
+  80222e:	66 90                	xchg   %ax,%ax
+
+00802230 <__udivmoddi4>:
+  802230:	55                   	push   %ebp
+  802231:	57                   	push   %edi
+  802232:	56                   	push   %esi
+  802233:	53                   	push   %ebx
+  802234:	83 ec 14             	sub    $0x14,%esp
+  802237:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80223b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80223f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802243:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802247:	89 f1                	mov    %esi,%ecx
+  802249:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80224d:	09 d9                	or     %ebx,%ecx
+  80224f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802253:	0f 84 92 00 00 00    	je     8022eb <__udivmoddi4+0xbb>
+  802259:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802260:	00 
+  802261:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802266:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80226d:	00 
+  80226e:	89 1c 24             	mov    %ebx,(%esp)
+  802271:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802275:	8d 76 00             	lea    0x0(%esi),%esi
+  802278:	89 e9                	mov    %ebp,%ecx
+  80227a:	89 c3                	mov    %eax,%ebx
+  80227c:	89 d6                	mov    %edx,%esi
+  80227e:	31 ff                	xor    %edi,%edi
+  802280:	d3 ee                	shr    %cl,%esi
+  802282:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802285:	f6 c1 20             	test   $0x20,%cl
+  802288:	0f 45 de             	cmovne %esi,%ebx
+  80228b:	0f 45 f7             	cmovne %edi,%esi
+  80228e:	8b 3c 24             	mov    (%esp),%edi
+  802291:	39 fb                	cmp    %edi,%ebx
+  802293:	89 f7                	mov    %esi,%edi
+  802295:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802299:	8b 1c 24             	mov    (%esp),%ebx
+  80229c:	19 f7                	sbb    %esi,%edi
+  80229e:	72 39                	jb     8022d9 <__udivmoddi4+0xa9>
+  8022a0:	89 e9                	mov    %ebp,%ecx
+  8022a2:	89 f7                	mov    %esi,%edi
+  8022a4:	89 de                	mov    %ebx,%esi
+  8022a6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8022a9:	d3 e6                	shl    %cl,%esi
+  8022ab:	31 db                	xor    %ebx,%ebx
+  8022ad:	f6 c1 20             	test   $0x20,%cl
+  8022b0:	0f 45 fe             	cmovne %esi,%edi
+  8022b3:	0f 45 f3             	cmovne %ebx,%esi
+  8022b6:	29 f0                	sub    %esi,%eax
+  8022b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022bd:	19 fa                	sbb    %edi,%edx
+  8022bf:	31 ff                	xor    %edi,%edi
+  8022c1:	31 db                	xor    %ebx,%ebx
+  8022c3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8022c6:	d3 e6                	shl    %cl,%esi
+  8022c8:	f6 c1 20             	test   $0x20,%cl
+  8022cb:	0f 45 fe             	cmovne %esi,%edi
+  8022ce:	0f 45 f3             	cmovne %ebx,%esi
+  8022d1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8022d5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8022d9:	83 ed 01             	sub    $0x1,%ebp
+  8022dc:	73 9a                	jae    802278 <__udivmoddi4+0x48>
+  8022de:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8022e2:	85 ff                	test   %edi,%edi
+  8022e4:	74 05                	je     8022eb <__udivmoddi4+0xbb>
+  8022e6:	89 07                	mov    %eax,(%edi)
+  8022e8:	89 57 04             	mov    %edx,0x4(%edi)
+  8022eb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022ef:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022f3:	83 c4 14             	add    $0x14,%esp
+  8022f6:	5b                   	pop    %ebx
+  8022f7:	5e                   	pop    %esi
+  8022f8:	5f                   	pop    %edi
+  8022f9:	5d                   	pop    %ebp
+  8022fa:	c3                   	ret
+  8022fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8022ff:	90                   	nop
+
+00802300 <__udivdi3>:
+  802300:	55                   	push   %ebp
+  802301:	57                   	push   %edi
+  802302:	56                   	push   %esi
+  802303:	53                   	push   %ebx
+  802304:	83 ec 14             	sub    $0x14,%esp
+  802307:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80230b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80230f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802313:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802317:	89 fb                	mov    %edi,%ebx
+  802319:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80231d:	09 f3                	or     %esi,%ebx
+  80231f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802323:	0f 84 85 00 00 00    	je     8023ae <__udivdi3+0xae>
+  802329:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802330:	00 
+  802331:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802336:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80233d:	00 
+  80233e:	89 34 24             	mov    %esi,(%esp)
+  802341:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802345:	8d 76 00             	lea    0x0(%esi),%esi
+  802348:	89 e9                	mov    %ebp,%ecx
+  80234a:	89 c3                	mov    %eax,%ebx
+  80234c:	89 d6                	mov    %edx,%esi
+  80234e:	31 ff                	xor    %edi,%edi
+  802350:	d3 ee                	shr    %cl,%esi
+  802352:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802355:	f6 c1 20             	test   $0x20,%cl
+  802358:	0f 45 de             	cmovne %esi,%ebx
+  80235b:	0f 45 f7             	cmovne %edi,%esi
+  80235e:	8b 3c 24             	mov    (%esp),%edi
+  802361:	39 fb                	cmp    %edi,%ebx
+  802363:	89 f7                	mov    %esi,%edi
+  802365:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802369:	8b 1c 24             	mov    (%esp),%ebx
+  80236c:	19 f7                	sbb    %esi,%edi
+  80236e:	72 39                	jb     8023a9 <__udivdi3+0xa9>
+  802370:	89 e9                	mov    %ebp,%ecx
+  802372:	89 f7                	mov    %esi,%edi
+  802374:	89 de                	mov    %ebx,%esi
+  802376:	0f a5 df             	shld   %cl,%ebx,%edi
+  802379:	d3 e6                	shl    %cl,%esi
+  80237b:	31 db                	xor    %ebx,%ebx
+  80237d:	f6 c1 20             	test   $0x20,%cl
+  802380:	0f 45 fe             	cmovne %esi,%edi
+  802383:	0f 45 f3             	cmovne %ebx,%esi
+  802386:	29 f0                	sub    %esi,%eax
+  802388:	be 01 00 00 00       	mov    $0x1,%esi
+  80238d:	19 fa                	sbb    %edi,%edx
+  80238f:	31 ff                	xor    %edi,%edi
+  802391:	31 db                	xor    %ebx,%ebx
+  802393:	0f a5 f7             	shld   %cl,%esi,%edi
+  802396:	d3 e6                	shl    %cl,%esi
+  802398:	f6 c1 20             	test   $0x20,%cl
+  80239b:	0f 45 fe             	cmovne %esi,%edi
+  80239e:	0f 45 f3             	cmovne %ebx,%esi
+  8023a1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023a5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023a9:	83 ed 01             	sub    $0x1,%ebp
+  8023ac:	73 9a                	jae    802348 <__udivdi3+0x48>
+  8023ae:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023b2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023b6:	83 c4 14             	add    $0x14,%esp
+  8023b9:	5b                   	pop    %ebx
+  8023ba:	5e                   	pop    %esi
+  8023bb:	5f                   	pop    %edi
+  8023bc:	5d                   	pop    %ebp
+  8023bd:	c3                   	ret
+  8023be:	66 90                	xchg   %ax,%ax
+
+008023c0 <__umoddi3>:
+  8023c0:	57                   	push   %edi
+  8023c1:	56                   	push   %esi
+  8023c2:	53                   	push   %ebx
+  8023c3:	83 ec 08             	sub    $0x8,%esp
+  8023c6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8023ca:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8023ce:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023d2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023d6:	89 f9                	mov    %edi,%ecx
+  8023d8:	89 34 24             	mov    %esi,(%esp)
+  8023db:	09 f1                	or     %esi,%ecx
+  8023dd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023e1:	74 53                	je     802436 <__umoddi3+0x76>
+  8023e3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023ef:	90                   	nop
+  8023f0:	89 c6                	mov    %eax,%esi
+  8023f2:	89 d7                	mov    %edx,%edi
+  8023f4:	31 db                	xor    %ebx,%ebx
+  8023f6:	d3 ef                	shr    %cl,%edi
+  8023f8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8023fb:	f6 c1 20             	test   $0x20,%cl
+  8023fe:	0f 45 f7             	cmovne %edi,%esi
+  802401:	0f 45 fb             	cmovne %ebx,%edi
+  802404:	8b 1c 24             	mov    (%esp),%ebx
+  802407:	39 de                	cmp    %ebx,%esi
+  802409:	89 fb                	mov    %edi,%ebx
+  80240b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80240f:	8b 34 24             	mov    (%esp),%esi
+  802412:	19 fb                	sbb    %edi,%ebx
+  802414:	72 14                	jb     80242a <__umoddi3+0x6a>
+  802416:	0f a5 f7             	shld   %cl,%esi,%edi
+  802419:	31 db                	xor    %ebx,%ebx
+  80241b:	d3 e6                	shl    %cl,%esi
+  80241d:	f6 c1 20             	test   $0x20,%cl
+  802420:	0f 45 fe             	cmovne %esi,%edi
+  802423:	0f 45 f3             	cmovne %ebx,%esi
+  802426:	29 f0                	sub    %esi,%eax
+  802428:	19 fa                	sbb    %edi,%edx
+  80242a:	83 e9 01             	sub    $0x1,%ecx
+  80242d:	73 c1                	jae    8023f0 <__umoddi3+0x30>
+  80242f:	83 c4 08             	add    $0x8,%esp
+  802432:	5b                   	pop    %ebx
+  802433:	5e                   	pop    %esi
+  802434:	5f                   	pop    %edi
+  802435:	c3                   	ret
+  802436:	83 c4 08             	add    $0x8,%esp
+  802439:	31 c0                	xor    %eax,%eax
+  80243b:	31 d2                	xor    %edx,%edx
+  80243d:	5b                   	pop    %ebx
+  80243e:	5e                   	pop    %esi
+  80243f:	5f                   	pop    %edi
+  802440:	c3                   	ret
+  802441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80244f:	90                   	nop
+
+00802450 <__divdi3>:
+  802450:	55                   	push   %ebp
+  802451:	57                   	push   %edi
+  802452:	56                   	push   %esi
+  802453:	53                   	push   %ebx
+  802454:	83 ec 1c             	sub    $0x1c,%esp
+  802457:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80245b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80245f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802463:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802467:	85 ff                	test   %edi,%edi
+  802469:	0f 88 da 00 00 00    	js     802549 <__divdi3+0xf9>
+  80246f:	85 db                	test   %ebx,%ebx
+  802471:	78 16                	js     802489 <__divdi3+0x39>
+  802473:	89 dd                	mov    %ebx,%ebp
+  802475:	89 c8                	mov    %ecx,%eax
+  802477:	89 da                	mov    %ebx,%edx
+  802479:	09 cd                	or     %ecx,%ebp
+  80247b:	0f 85 fd 00 00 00    	jne    80257e <__divdi3+0x12e>
+  802481:	83 c4 1c             	add    $0x1c,%esp
+  802484:	5b                   	pop    %ebx
+  802485:	5e                   	pop    %esi
+  802486:	5f                   	pop    %edi
+  802487:	5d                   	pop    %ebp
+  802488:	c3                   	ret
+  802489:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80248e:	f7 d9                	neg    %ecx
+  802490:	89 f0                	mov    %esi,%eax
+  802492:	89 fa                	mov    %edi,%edx
+  802494:	83 d3 00             	adc    $0x0,%ebx
+  802497:	89 0c 24             	mov    %ecx,(%esp)
+  80249a:	f7 db                	neg    %ebx
+  80249c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8024a0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024a7:	00 
+  8024a8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024ad:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024b4:	00 
+  8024b5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024b9:	89 cd                	mov    %ecx,%ebp
+  8024bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024bf:	90                   	nop
+  8024c0:	89 e9                	mov    %ebp,%ecx
+  8024c2:	89 c3                	mov    %eax,%ebx
+  8024c4:	89 d6                	mov    %edx,%esi
+  8024c6:	31 ff                	xor    %edi,%edi
+  8024c8:	d3 ee                	shr    %cl,%esi
+  8024ca:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024cd:	f6 c1 20             	test   $0x20,%cl
+  8024d0:	0f 45 de             	cmovne %esi,%ebx
+  8024d3:	0f 45 f7             	cmovne %edi,%esi
+  8024d6:	8b 3c 24             	mov    (%esp),%edi
+  8024d9:	39 fb                	cmp    %edi,%ebx
+  8024db:	89 f7                	mov    %esi,%edi
+  8024dd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8024e1:	8b 1c 24             	mov    (%esp),%ebx
+  8024e4:	19 f7                	sbb    %esi,%edi
+  8024e6:	72 39                	jb     802521 <__divdi3+0xd1>
+  8024e8:	89 e9                	mov    %ebp,%ecx
+  8024ea:	89 f7                	mov    %esi,%edi
+  8024ec:	89 de                	mov    %ebx,%esi
+  8024ee:	0f a5 df             	shld   %cl,%ebx,%edi
+  8024f1:	d3 e6                	shl    %cl,%esi
+  8024f3:	31 db                	xor    %ebx,%ebx
+  8024f5:	f6 c1 20             	test   $0x20,%cl
+  8024f8:	0f 45 fe             	cmovne %esi,%edi
+  8024fb:	0f 45 f3             	cmovne %ebx,%esi
+  8024fe:	29 f0                	sub    %esi,%eax
+  802500:	be 01 00 00 00       	mov    $0x1,%esi
+  802505:	19 fa                	sbb    %edi,%edx
+  802507:	31 ff                	xor    %edi,%edi
+  802509:	31 db                	xor    %ebx,%ebx
+  80250b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80250e:	d3 e6                	shl    %cl,%esi
+  802510:	f6 c1 20             	test   $0x20,%cl
+  802513:	0f 45 fe             	cmovne %esi,%edi
+  802516:	0f 45 f3             	cmovne %ebx,%esi
+  802519:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80251d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802521:	83 ed 01             	sub    $0x1,%ebp
+  802524:	73 9a                	jae    8024c0 <__divdi3+0x70>
+  802526:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80252a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80252e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802532:	85 ed                	test   %ebp,%ebp
+  802534:	0f 84 47 ff ff ff    	je     802481 <__divdi3+0x31>
+  80253a:	f7 d8                	neg    %eax
+  80253c:	83 d2 00             	adc    $0x0,%edx
+  80253f:	83 c4 1c             	add    $0x1c,%esp
+  802542:	5b                   	pop    %ebx
+  802543:	f7 da                	neg    %edx
+  802545:	5e                   	pop    %esi
+  802546:	5f                   	pop    %edi
+  802547:	5d                   	pop    %ebp
+  802548:	c3                   	ret
+  802549:	f7 de                	neg    %esi
+  80254b:	83 d7 00             	adc    $0x0,%edi
+  80254e:	f7 df                	neg    %edi
+  802550:	85 db                	test   %ebx,%ebx
+  802552:	78 23                	js     802577 <__divdi3+0x127>
+  802554:	89 dd                	mov    %ebx,%ebp
+  802556:	89 c8                	mov    %ecx,%eax
+  802558:	89 da                	mov    %ebx,%edx
+  80255a:	09 cd                	or     %ecx,%ebp
+  80255c:	0f 84 1f ff ff ff    	je     802481 <__divdi3+0x31>
+  802562:	89 0c 24             	mov    %ecx,(%esp)
+  802565:	89 f0                	mov    %esi,%eax
+  802567:	89 fa                	mov    %edi,%edx
+  802569:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80256e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802572:	e9 29 ff ff ff       	jmp    8024a0 <__divdi3+0x50>
+  802577:	31 ed                	xor    %ebp,%ebp
+  802579:	e9 10 ff ff ff       	jmp    80248e <__divdi3+0x3e>
+  80257e:	89 0c 24             	mov    %ecx,(%esp)
+  802581:	89 f0                	mov    %esi,%eax
+  802583:	89 fa                	mov    %edi,%edx
+  802585:	31 ed                	xor    %ebp,%ebp
+  802587:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80258b:	e9 10 ff ff ff       	jmp    8024a0 <__divdi3+0x50>
+
+00802590 <__moddi3>:
+  802590:	55                   	push   %ebp
+  802591:	57                   	push   %edi
+  802592:	56                   	push   %esi
+  802593:	53                   	push   %ebx
+  802594:	83 ec 14             	sub    $0x14,%esp
+  802597:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80259b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80259f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8025a3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8025a7:	85 d2                	test   %edx,%edx
+  8025a9:	0f 88 9b 00 00 00    	js     80264a <__moddi3+0xba>
+  8025af:	89 f7                	mov    %esi,%edi
+  8025b1:	31 ed                	xor    %ebp,%ebp
+  8025b3:	09 cf                	or     %ecx,%edi
+  8025b5:	0f 84 83 00 00 00    	je     80263e <__moddi3+0xae>
+  8025bb:	89 cb                	mov    %ecx,%ebx
+  8025bd:	89 f7                	mov    %esi,%edi
+  8025bf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8025c3:	f7 db                	neg    %ebx
+  8025c5:	83 d7 00             	adc    $0x0,%edi
+  8025c8:	f7 df                	neg    %edi
+  8025ca:	0f 49 f7             	cmovns %edi,%esi
+  8025cd:	0f 49 cb             	cmovns %ebx,%ecx
+  8025d0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025d4:	89 0c 24             	mov    %ecx,(%esp)
+  8025d7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025dc:	89 cd                	mov    %ecx,%ebp
+  8025de:	66 90                	xchg   %ax,%ax
+  8025e0:	89 e9                	mov    %ebp,%ecx
+  8025e2:	89 c3                	mov    %eax,%ebx
+  8025e4:	89 d6                	mov    %edx,%esi
+  8025e6:	31 ff                	xor    %edi,%edi
+  8025e8:	d3 ee                	shr    %cl,%esi
+  8025ea:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025ed:	f6 c1 20             	test   $0x20,%cl
+  8025f0:	0f 45 de             	cmovne %esi,%ebx
+  8025f3:	0f 45 f7             	cmovne %edi,%esi
+  8025f6:	8b 3c 24             	mov    (%esp),%edi
+  8025f9:	39 fb                	cmp    %edi,%ebx
+  8025fb:	89 f7                	mov    %esi,%edi
+  8025fd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802601:	8b 1c 24             	mov    (%esp),%ebx
+  802604:	19 f7                	sbb    %esi,%edi
+  802606:	72 1a                	jb     802622 <__moddi3+0x92>
+  802608:	89 e9                	mov    %ebp,%ecx
+  80260a:	89 f7                	mov    %esi,%edi
+  80260c:	89 de                	mov    %ebx,%esi
+  80260e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802611:	d3 e6                	shl    %cl,%esi
+  802613:	31 db                	xor    %ebx,%ebx
+  802615:	f6 c1 20             	test   $0x20,%cl
+  802618:	0f 45 fe             	cmovne %esi,%edi
+  80261b:	0f 45 f3             	cmovne %ebx,%esi
+  80261e:	29 f0                	sub    %esi,%eax
+  802620:	19 fa                	sbb    %edi,%edx
+  802622:	83 ed 01             	sub    $0x1,%ebp
+  802625:	73 b9                	jae    8025e0 <__moddi3+0x50>
+  802627:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80262b:	85 ed                	test   %ebp,%ebp
+  80262d:	74 07                	je     802636 <__moddi3+0xa6>
+  80262f:	f7 d8                	neg    %eax
+  802631:	83 d2 00             	adc    $0x0,%edx
+  802634:	f7 da                	neg    %edx
+  802636:	83 c4 14             	add    $0x14,%esp
+  802639:	5b                   	pop    %ebx
+  80263a:	5e                   	pop    %esi
+  80263b:	5f                   	pop    %edi
+  80263c:	5d                   	pop    %ebp
+  80263d:	c3                   	ret
+  80263e:	83 c4 14             	add    $0x14,%esp
+  802641:	31 c0                	xor    %eax,%eax
+  802643:	31 d2                	xor    %edx,%edx
+  802645:	5b                   	pop    %ebx
+  802646:	5e                   	pop    %esi
+  802647:	5f                   	pop    %edi
+  802648:	5d                   	pop    %ebp
+  802649:	c3                   	ret
+  80264a:	89 f7                	mov    %esi,%edi
+  80264c:	09 cf                	or     %ecx,%edi
+  80264e:	74 11                	je     802661 <__moddi3+0xd1>
+  802650:	f7 d8                	neg    %eax
+  802652:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802657:	83 d2 00             	adc    $0x0,%edx
+  80265a:	f7 da                	neg    %edx
+  80265c:	e9 5a ff ff ff       	jmp    8025bb <__moddi3+0x2b>
+  802661:	31 c0                	xor    %eax,%eax
+  802663:	31 d2                	xor    %edx,%edx
+  802665:	eb c8                	jmp    80262f <__moddi3+0x9f>
@@ -0,0 +1,5564 @@
+
+obj/user/breakpoint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 25 00 00 00       	call   800056 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	asm volatile("int $3");
+  800039:	cc                   	int3
+	cprintf("breakpoint 1\n");
+  80003a:	68 80 26 80 00       	push   $0x802680
+  80003f:	e8 07 01 00 00       	call   80014b <cprintf>
+	asm volatile("int $3");
+  800044:	cc                   	int3
+	cprintf("breakpoint 2\n");
+  800045:	c7 04 24 8e 26 80 00 	movl   $0x80268e,(%esp)
+  80004c:	e8 fa 00 00 00       	call   80014b <cprintf>
+}
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	c9                   	leave
+  800055:	c3                   	ret
+
+00800056 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800056:	55                   	push   %ebp
+  800057:	89 e5                	mov    %esp,%ebp
+  800059:	56                   	push   %esi
+  80005a:	53                   	push   %ebx
+  80005b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800061:	e8 a1 0a 00 00       	call   800b07 <sys_getenvid>
+  800066:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80006b:	c1 e0 09             	shl    $0x9,%eax
+  80006e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800073:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800078:	85 db                	test   %ebx,%ebx
+  80007a:	7e 07                	jle    800083 <libmain+0x2d>
+		binaryname = argv[0];
+  80007c:	8b 06                	mov    (%esi),%eax
+  80007e:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800083:	83 ec 08             	sub    $0x8,%esp
+  800086:	56                   	push   %esi
+  800087:	53                   	push   %ebx
+  800088:	e8 a6 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80008d:	e8 0a 00 00 00       	call   80009c <exit>
+}
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800098:	5b                   	pop    %ebx
+  800099:	5e                   	pop    %esi
+  80009a:	5d                   	pop    %ebp
+  80009b:	c3                   	ret
+
+0080009c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009c:	55                   	push   %ebp
+  80009d:	89 e5                	mov    %esp,%ebp
+  80009f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000a2:	e8 f8 10 00 00       	call   80119f <close_all>
+	sys_env_destroy(0);
+  8000a7:	83 ec 0c             	sub    $0xc,%esp
+  8000aa:	6a 00                	push   $0x0
+  8000ac:	e8 15 0a 00 00       	call   800ac6 <sys_env_destroy>
+}
+  8000b1:	83 c4 10             	add    $0x10,%esp
+  8000b4:	c9                   	leave
+  8000b5:	c3                   	ret
+
+008000b6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000b6:	55                   	push   %ebp
+  8000b7:	89 e5                	mov    %esp,%ebp
+  8000b9:	53                   	push   %ebx
+  8000ba:	83 ec 04             	sub    $0x4,%esp
+  8000bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000c0:	8b 13                	mov    (%ebx),%edx
+  8000c2:	8d 42 01             	lea    0x1(%edx),%eax
+  8000c5:	89 03                	mov    %eax,(%ebx)
+  8000c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000ca:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000ce:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000d3:	74 09                	je     8000de <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000d5:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000dc:	c9                   	leave
+  8000dd:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000de:	83 ec 08             	sub    $0x8,%esp
+  8000e1:	68 ff 00 00 00       	push   $0xff
+  8000e6:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000e9:	50                   	push   %eax
+  8000ea:	e8 7a 09 00 00       	call   800a69 <sys_cputs>
+		b->idx = 0;
+  8000ef:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000f5:	83 c4 10             	add    $0x10,%esp
+  8000f8:	eb db                	jmp    8000d5 <putch+0x1f>
+
+008000fa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000fa:	55                   	push   %ebp
+  8000fb:	89 e5                	mov    %esp,%ebp
+  8000fd:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800103:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80010a:	00 00 00 
+	b.cnt = 0;
+  80010d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800114:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800117:	ff 75 0c             	push   0xc(%ebp)
+  80011a:	ff 75 08             	push   0x8(%ebp)
+  80011d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800123:	50                   	push   %eax
+  800124:	68 b6 00 80 00       	push   $0x8000b6
+  800129:	e8 14 01 00 00       	call   800242 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80012e:	83 c4 08             	add    $0x8,%esp
+  800131:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800137:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80013d:	50                   	push   %eax
+  80013e:	e8 26 09 00 00       	call   800a69 <sys_cputs>
+
+	return b.cnt;
+}
+  800143:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800149:	c9                   	leave
+  80014a:	c3                   	ret
+
+0080014b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80014b:	55                   	push   %ebp
+  80014c:	89 e5                	mov    %esp,%ebp
+  80014e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800151:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800154:	50                   	push   %eax
+  800155:	ff 75 08             	push   0x8(%ebp)
+  800158:	e8 9d ff ff ff       	call   8000fa <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80015d:	c9                   	leave
+  80015e:	c3                   	ret
+
+0080015f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	57                   	push   %edi
+  800163:	56                   	push   %esi
+  800164:	53                   	push   %ebx
+  800165:	83 ec 1c             	sub    $0x1c,%esp
+  800168:	89 c7                	mov    %eax,%edi
+  80016a:	89 d6                	mov    %edx,%esi
+  80016c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80016f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800172:	89 d1                	mov    %edx,%ecx
+  800174:	89 c2                	mov    %eax,%edx
+  800176:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800179:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80017c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800182:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800185:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80018c:	39 c2                	cmp    %eax,%edx
+  80018e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800191:	72 3e                	jb     8001d1 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800193:	83 ec 0c             	sub    $0xc,%esp
+  800196:	ff 75 18             	push   0x18(%ebp)
+  800199:	83 eb 01             	sub    $0x1,%ebx
+  80019c:	53                   	push   %ebx
+  80019d:	50                   	push   %eax
+  80019e:	83 ec 08             	sub    $0x8,%esp
+  8001a1:	ff 75 e4             	push   -0x1c(%ebp)
+  8001a4:	ff 75 e0             	push   -0x20(%ebp)
+  8001a7:	ff 75 dc             	push   -0x24(%ebp)
+  8001aa:	ff 75 d8             	push   -0x28(%ebp)
+  8001ad:	e8 5e 21 00 00       	call   802310 <__udivdi3>
+  8001b2:	83 c4 18             	add    $0x18,%esp
+  8001b5:	52                   	push   %edx
+  8001b6:	50                   	push   %eax
+  8001b7:	89 f2                	mov    %esi,%edx
+  8001b9:	89 f8                	mov    %edi,%eax
+  8001bb:	e8 9f ff ff ff       	call   80015f <printnum>
+  8001c0:	83 c4 20             	add    $0x20,%esp
+  8001c3:	eb 13                	jmp    8001d8 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001c5:	83 ec 08             	sub    $0x8,%esp
+  8001c8:	56                   	push   %esi
+  8001c9:	ff 75 18             	push   0x18(%ebp)
+  8001cc:	ff d7                	call   *%edi
+  8001ce:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001d1:	83 eb 01             	sub    $0x1,%ebx
+  8001d4:	85 db                	test   %ebx,%ebx
+  8001d6:	7f ed                	jg     8001c5 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001d8:	83 ec 08             	sub    $0x8,%esp
+  8001db:	56                   	push   %esi
+  8001dc:	83 ec 04             	sub    $0x4,%esp
+  8001df:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e2:	ff 75 e0             	push   -0x20(%ebp)
+  8001e5:	ff 75 dc             	push   -0x24(%ebp)
+  8001e8:	ff 75 d8             	push   -0x28(%ebp)
+  8001eb:	e8 e0 21 00 00       	call   8023d0 <__umoddi3>
+  8001f0:	83 c4 14             	add    $0x14,%esp
+  8001f3:	0f be 80 a6 26 80 00 	movsbl 0x8026a6(%eax),%eax
+  8001fa:	50                   	push   %eax
+  8001fb:	ff d7                	call   *%edi
+}
+  8001fd:	83 c4 10             	add    $0x10,%esp
+  800200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800203:	5b                   	pop    %ebx
+  800204:	5e                   	pop    %esi
+  800205:	5f                   	pop    %edi
+  800206:	5d                   	pop    %ebp
+  800207:	c3                   	ret
+
+00800208 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800208:	55                   	push   %ebp
+  800209:	89 e5                	mov    %esp,%ebp
+  80020b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80020e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800212:	8b 10                	mov    (%eax),%edx
+  800214:	3b 50 04             	cmp    0x4(%eax),%edx
+  800217:	73 0a                	jae    800223 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800219:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80021c:	89 08                	mov    %ecx,(%eax)
+  80021e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800221:	88 02                	mov    %al,(%edx)
+}
+  800223:	5d                   	pop    %ebp
+  800224:	c3                   	ret
+
+00800225 <printfmt>:
+{
+  800225:	55                   	push   %ebp
+  800226:	89 e5                	mov    %esp,%ebp
+  800228:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80022b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80022e:	50                   	push   %eax
+  80022f:	ff 75 10             	push   0x10(%ebp)
+  800232:	ff 75 0c             	push   0xc(%ebp)
+  800235:	ff 75 08             	push   0x8(%ebp)
+  800238:	e8 05 00 00 00       	call   800242 <vprintfmt>
+}
+  80023d:	83 c4 10             	add    $0x10,%esp
+  800240:	c9                   	leave
+  800241:	c3                   	ret
+
+00800242 <vprintfmt>:
+{
+  800242:	55                   	push   %ebp
+  800243:	89 e5                	mov    %esp,%ebp
+  800245:	57                   	push   %edi
+  800246:	56                   	push   %esi
+  800247:	53                   	push   %ebx
+  800248:	83 ec 2c             	sub    $0x2c,%esp
+  80024b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80024e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800251:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800254:	eb 0a                	jmp    800260 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800256:	83 ec 08             	sub    $0x8,%esp
+  800259:	53                   	push   %ebx
+  80025a:	50                   	push   %eax
+  80025b:	ff d6                	call   *%esi
+  80025d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800260:	83 c7 01             	add    $0x1,%edi
+  800263:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800267:	83 f8 25             	cmp    $0x25,%eax
+  80026a:	74 0c                	je     800278 <vprintfmt+0x36>
+			if (ch == '\0')
+  80026c:	85 c0                	test   %eax,%eax
+  80026e:	75 e6                	jne    800256 <vprintfmt+0x14>
+}
+  800270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800273:	5b                   	pop    %ebx
+  800274:	5e                   	pop    %esi
+  800275:	5f                   	pop    %edi
+  800276:	5d                   	pop    %ebp
+  800277:	c3                   	ret
+		padc = ' ';
+  800278:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80027c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800283:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80028a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800291:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800296:	8d 47 01             	lea    0x1(%edi),%eax
+  800299:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80029c:	0f b6 17             	movzbl (%edi),%edx
+  80029f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002a2:	3c 55                	cmp    $0x55,%al
+  8002a4:	0f 87 cf 03 00 00    	ja     800679 <vprintfmt+0x437>
+  8002aa:	0f b6 c0             	movzbl %al,%eax
+  8002ad:	ff 24 85 e0 27 80 00 	jmp    *0x8027e0(,%eax,4)
+  8002b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002b7:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002bb:	eb d9                	jmp    800296 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002c0:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002c4:	eb d0                	jmp    800296 <vprintfmt+0x54>
+  8002c6:	0f b6 d2             	movzbl %dl,%edx
+  8002c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002d4:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002d7:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002db:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002de:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002e1:	83 f9 09             	cmp    $0x9,%ecx
+  8002e4:	77 55                	ja     80033b <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002e6:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002e9:	eb e9                	jmp    8002d4 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ee:	8b 00                	mov    (%eax),%eax
+  8002f0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8002f9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8002ff:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800303:	79 91                	jns    800296 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800305:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800308:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80030b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800312:	eb 82                	jmp    800296 <vprintfmt+0x54>
+			if (width < 0)
+  800314:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800317:	85 d2                	test   %edx,%edx
+  800319:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031e:	0f 49 c2             	cmovns %edx,%eax
+  800321:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800324:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800327:	e9 6a ff ff ff       	jmp    800296 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80032f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800336:	e9 5b ff ff ff       	jmp    800296 <vprintfmt+0x54>
+  80033b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80033e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800341:	eb bc                	jmp    8002ff <vprintfmt+0xbd>
+			lflag++;
+  800343:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800346:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800349:	e9 48 ff ff ff       	jmp    800296 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80034e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800351:	8d 78 04             	lea    0x4(%eax),%edi
+  800354:	83 ec 08             	sub    $0x8,%esp
+  800357:	53                   	push   %ebx
+  800358:	ff 30                	push   (%eax)
+  80035a:	ff d6                	call   *%esi
+			break;
+  80035c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80035f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800362:	e9 b1 02 00 00       	jmp    800618 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800367:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80036d:	8b 10                	mov    (%eax),%edx
+  80036f:	89 d0                	mov    %edx,%eax
+  800371:	f7 d8                	neg    %eax
+  800373:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800376:	83 f8 0f             	cmp    $0xf,%eax
+  800379:	7f 23                	jg     80039e <vprintfmt+0x15c>
+  80037b:	8b 14 85 40 29 80 00 	mov    0x802940(,%eax,4),%edx
+  800382:	85 d2                	test   %edx,%edx
+  800384:	74 18                	je     80039e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800386:	52                   	push   %edx
+  800387:	68 75 2a 80 00       	push   $0x802a75
+  80038c:	53                   	push   %ebx
+  80038d:	56                   	push   %esi
+  80038e:	e8 92 fe ff ff       	call   800225 <printfmt>
+  800393:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800396:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800399:	e9 7a 02 00 00       	jmp    800618 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80039e:	50                   	push   %eax
+  80039f:	68 be 26 80 00       	push   $0x8026be
+  8003a4:	53                   	push   %ebx
+  8003a5:	56                   	push   %esi
+  8003a6:	e8 7a fe ff ff       	call   800225 <printfmt>
+  8003ab:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003ae:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003b1:	e9 62 02 00 00       	jmp    800618 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b9:	83 c0 04             	add    $0x4,%eax
+  8003bc:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c2:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003c4:	85 c9                	test   %ecx,%ecx
+  8003c6:	b8 b7 26 80 00       	mov    $0x8026b7,%eax
+  8003cb:	0f 45 c1             	cmovne %ecx,%eax
+  8003ce:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003d1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d5:	7e 06                	jle    8003dd <vprintfmt+0x19b>
+  8003d7:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003db:	75 0b                	jne    8003e8 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003dd:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003e0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003e3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003e6:	eb 5c                	jmp    800444 <vprintfmt+0x202>
+  8003e8:	83 ec 08             	sub    $0x8,%esp
+  8003eb:	ff 75 d0             	push   -0x30(%ebp)
+  8003ee:	ff 75 cc             	push   -0x34(%ebp)
+  8003f1:	e8 20 03 00 00       	call   800716 <strnlen>
+  8003f6:	89 c2                	mov    %eax,%edx
+  8003f8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003fb:	29 d0                	sub    %edx,%eax
+  8003fd:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800400:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800404:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800407:	89 75 08             	mov    %esi,0x8(%ebp)
+  80040a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040c:	eb 0e                	jmp    80041c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80040e:	83 ec 08             	sub    $0x8,%esp
+  800411:	53                   	push   %ebx
+  800412:	57                   	push   %edi
+  800413:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800416:	83 ee 01             	sub    $0x1,%esi
+  800419:	83 c4 10             	add    $0x10,%esp
+  80041c:	85 f6                	test   %esi,%esi
+  80041e:	7f ee                	jg     80040e <vprintfmt+0x1cc>
+  800420:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800423:	8b 75 08             	mov    0x8(%ebp),%esi
+  800426:	85 c0                	test   %eax,%eax
+  800428:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042d:	0f 49 d0             	cmovns %eax,%edx
+  800430:	29 d0                	sub    %edx,%eax
+  800432:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800435:	eb a6                	jmp    8003dd <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800437:	83 ec 08             	sub    $0x8,%esp
+  80043a:	53                   	push   %ebx
+  80043b:	52                   	push   %edx
+  80043c:	ff 55 08             	call   *0x8(%ebp)
+  80043f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800442:	89 f1                	mov    %esi,%ecx
+  800444:	8d 71 01             	lea    0x1(%ecx),%esi
+  800447:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80044b:	0f be d0             	movsbl %al,%edx
+  80044e:	85 d2                	test   %edx,%edx
+  800450:	74 28                	je     80047a <vprintfmt+0x238>
+  800452:	85 ff                	test   %edi,%edi
+  800454:	78 05                	js     80045b <vprintfmt+0x219>
+  800456:	83 ef 01             	sub    $0x1,%edi
+  800459:	78 30                	js     80048b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80045b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80045f:	74 d6                	je     800437 <vprintfmt+0x1f5>
+  800461:	0f be c0             	movsbl %al,%eax
+  800464:	83 e8 20             	sub    $0x20,%eax
+  800467:	83 f8 5e             	cmp    $0x5e,%eax
+  80046a:	76 cb                	jbe    800437 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80046c:	83 ec 08             	sub    $0x8,%esp
+  80046f:	53                   	push   %ebx
+  800470:	6a 3f                	push   $0x3f
+  800472:	ff 55 08             	call   *0x8(%ebp)
+  800475:	83 c4 10             	add    $0x10,%esp
+  800478:	eb c8                	jmp    800442 <vprintfmt+0x200>
+  80047a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80047d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800480:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800483:	01 d0                	add    %edx,%eax
+  800485:	29 c8                	sub    %ecx,%eax
+  800487:	89 c7                	mov    %eax,%edi
+  800489:	eb 13                	jmp    80049e <vprintfmt+0x25c>
+  80048b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80048e:	eb ed                	jmp    80047d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800490:	83 ec 08             	sub    $0x8,%esp
+  800493:	53                   	push   %ebx
+  800494:	6a 20                	push   $0x20
+  800496:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800498:	83 ef 01             	sub    $0x1,%edi
+  80049b:	83 c4 10             	add    $0x10,%esp
+  80049e:	85 ff                	test   %edi,%edi
+  8004a0:	7f ee                	jg     800490 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004a2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a8:	e9 6b 01 00 00       	jmp    800618 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004ad:	83 f9 01             	cmp    $0x1,%ecx
+  8004b0:	7f 1f                	jg     8004d1 <vprintfmt+0x28f>
+	else if (lflag)
+  8004b2:	85 c9                	test   %ecx,%ecx
+  8004b4:	74 67                	je     80051d <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b9:	8b 00                	mov    (%eax),%eax
+  8004bb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004be:	89 c1                	mov    %eax,%ecx
+  8004c0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004c3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8004cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004cf:	eb 17                	jmp    8004e8 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d4:	8b 50 04             	mov    0x4(%eax),%edx
+  8004d7:	8b 00                	mov    (%eax),%eax
+  8004d9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004dc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e2:	8d 40 08             	lea    0x8(%eax),%eax
+  8004e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004e8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004eb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004ee:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004f3:	85 c9                	test   %ecx,%ecx
+  8004f5:	0f 89 03 01 00 00    	jns    8005fe <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8004fb:	83 ec 08             	sub    $0x8,%esp
+  8004fe:	53                   	push   %ebx
+  8004ff:	6a 2d                	push   $0x2d
+  800501:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800503:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800506:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800509:	f7 da                	neg    %edx
+  80050b:	83 d1 00             	adc    $0x0,%ecx
+  80050e:	f7 d9                	neg    %ecx
+  800510:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800513:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800518:	e9 e1 00 00 00       	jmp    8005fe <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80051d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800520:	8b 00                	mov    (%eax),%eax
+  800522:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800525:	89 c1                	mov    %eax,%ecx
+  800527:	c1 f9 1f             	sar    $0x1f,%ecx
+  80052a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80052d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800530:	8d 40 04             	lea    0x4(%eax),%eax
+  800533:	89 45 14             	mov    %eax,0x14(%ebp)
+  800536:	eb b0                	jmp    8004e8 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800538:	83 f9 01             	cmp    $0x1,%ecx
+  80053b:	7f 1e                	jg     80055b <vprintfmt+0x319>
+	else if (lflag)
+  80053d:	85 c9                	test   %ecx,%ecx
+  80053f:	74 32                	je     800573 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800541:	8b 45 14             	mov    0x14(%ebp),%eax
+  800544:	8b 10                	mov    (%eax),%edx
+  800546:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80054b:	8d 40 04             	lea    0x4(%eax),%eax
+  80054e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800551:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800556:	e9 a3 00 00 00       	jmp    8005fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80055b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055e:	8b 10                	mov    (%eax),%edx
+  800560:	8b 48 04             	mov    0x4(%eax),%ecx
+  800563:	8d 40 08             	lea    0x8(%eax),%eax
+  800566:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800569:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80056e:	e9 8b 00 00 00       	jmp    8005fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	8b 10                	mov    (%eax),%edx
+  800578:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80057d:	8d 40 04             	lea    0x4(%eax),%eax
+  800580:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800583:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800588:	eb 74                	jmp    8005fe <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80058a:	83 f9 01             	cmp    $0x1,%ecx
+  80058d:	7f 1b                	jg     8005aa <vprintfmt+0x368>
+	else if (lflag)
+  80058f:	85 c9                	test   %ecx,%ecx
+  800591:	74 2c                	je     8005bf <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800593:	8b 45 14             	mov    0x14(%ebp),%eax
+  800596:	8b 10                	mov    (%eax),%edx
+  800598:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80059d:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005a3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005a8:	eb 54                	jmp    8005fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8b 10                	mov    (%eax),%edx
+  8005af:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005b2:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005b8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005bd:	eb 3f                	jmp    8005fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c2:	8b 10                	mov    (%eax),%edx
+  8005c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005cf:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005d4:	eb 28                	jmp    8005fe <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005d6:	83 ec 08             	sub    $0x8,%esp
+  8005d9:	53                   	push   %ebx
+  8005da:	6a 30                	push   $0x30
+  8005dc:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005de:	83 c4 08             	add    $0x8,%esp
+  8005e1:	53                   	push   %ebx
+  8005e2:	6a 78                	push   $0x78
+  8005e4:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e9:	8b 10                	mov    (%eax),%edx
+  8005eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005f0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005f9:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005fe:	83 ec 0c             	sub    $0xc,%esp
+  800601:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800605:	50                   	push   %eax
+  800606:	ff 75 e0             	push   -0x20(%ebp)
+  800609:	57                   	push   %edi
+  80060a:	51                   	push   %ecx
+  80060b:	52                   	push   %edx
+  80060c:	89 da                	mov    %ebx,%edx
+  80060e:	89 f0                	mov    %esi,%eax
+  800610:	e8 4a fb ff ff       	call   80015f <printnum>
+			break;
+  800615:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800618:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80061b:	e9 40 fc ff ff       	jmp    800260 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800620:	83 f9 01             	cmp    $0x1,%ecx
+  800623:	7f 1b                	jg     800640 <vprintfmt+0x3fe>
+	else if (lflag)
+  800625:	85 c9                	test   %ecx,%ecx
+  800627:	74 2c                	je     800655 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800629:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062c:	8b 10                	mov    (%eax),%edx
+  80062e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800633:	8d 40 04             	lea    0x4(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800639:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80063e:	eb be                	jmp    8005fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8b 10                	mov    (%eax),%edx
+  800645:	8b 48 04             	mov    0x4(%eax),%ecx
+  800648:	8d 40 08             	lea    0x8(%eax),%eax
+  80064b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80064e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800653:	eb a9                	jmp    8005fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800655:	8b 45 14             	mov    0x14(%ebp),%eax
+  800658:	8b 10                	mov    (%eax),%edx
+  80065a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065f:	8d 40 04             	lea    0x4(%eax),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800665:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80066a:	eb 92                	jmp    8005fe <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80066c:	83 ec 08             	sub    $0x8,%esp
+  80066f:	53                   	push   %ebx
+  800670:	6a 25                	push   $0x25
+  800672:	ff d6                	call   *%esi
+			break;
+  800674:	83 c4 10             	add    $0x10,%esp
+  800677:	eb 9f                	jmp    800618 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800679:	83 ec 08             	sub    $0x8,%esp
+  80067c:	53                   	push   %ebx
+  80067d:	6a 25                	push   $0x25
+  80067f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800681:	83 c4 10             	add    $0x10,%esp
+  800684:	89 f8                	mov    %edi,%eax
+  800686:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80068a:	74 05                	je     800691 <vprintfmt+0x44f>
+  80068c:	83 e8 01             	sub    $0x1,%eax
+  80068f:	eb f5                	jmp    800686 <vprintfmt+0x444>
+  800691:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800694:	eb 82                	jmp    800618 <vprintfmt+0x3d6>
+
+00800696 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800696:	55                   	push   %ebp
+  800697:	89 e5                	mov    %esp,%ebp
+  800699:	83 ec 18             	sub    $0x18,%esp
+  80069c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80069f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006a2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006a5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006a9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006b3:	85 c0                	test   %eax,%eax
+  8006b5:	74 26                	je     8006dd <vsnprintf+0x47>
+  8006b7:	85 d2                	test   %edx,%edx
+  8006b9:	7e 22                	jle    8006dd <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006bb:	ff 75 14             	push   0x14(%ebp)
+  8006be:	ff 75 10             	push   0x10(%ebp)
+  8006c1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006c4:	50                   	push   %eax
+  8006c5:	68 08 02 80 00       	push   $0x800208
+  8006ca:	e8 73 fb ff ff       	call   800242 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006d2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006d8:	83 c4 10             	add    $0x10,%esp
+}
+  8006db:	c9                   	leave
+  8006dc:	c3                   	ret
+		return -E_INVAL;
+  8006dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006e2:	eb f7                	jmp    8006db <vsnprintf+0x45>
+
+008006e4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006e4:	55                   	push   %ebp
+  8006e5:	89 e5                	mov    %esp,%ebp
+  8006e7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006ea:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006ed:	50                   	push   %eax
+  8006ee:	ff 75 10             	push   0x10(%ebp)
+  8006f1:	ff 75 0c             	push   0xc(%ebp)
+  8006f4:	ff 75 08             	push   0x8(%ebp)
+  8006f7:	e8 9a ff ff ff       	call   800696 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006fc:	c9                   	leave
+  8006fd:	c3                   	ret
+
+008006fe <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006fe:	55                   	push   %ebp
+  8006ff:	89 e5                	mov    %esp,%ebp
+  800701:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800704:	b8 00 00 00 00       	mov    $0x0,%eax
+  800709:	eb 03                	jmp    80070e <strlen+0x10>
+		n++;
+  80070b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80070e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800712:	75 f7                	jne    80070b <strlen+0xd>
+	return n;
+}
+  800714:	5d                   	pop    %ebp
+  800715:	c3                   	ret
+
+00800716 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800716:	55                   	push   %ebp
+  800717:	89 e5                	mov    %esp,%ebp
+  800719:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80071c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80071f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800724:	eb 03                	jmp    800729 <strnlen+0x13>
+		n++;
+  800726:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800729:	39 d0                	cmp    %edx,%eax
+  80072b:	74 08                	je     800735 <strnlen+0x1f>
+  80072d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800731:	75 f3                	jne    800726 <strnlen+0x10>
+  800733:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800735:	89 d0                	mov    %edx,%eax
+  800737:	5d                   	pop    %ebp
+  800738:	c3                   	ret
+
+00800739 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800739:	55                   	push   %ebp
+  80073a:	89 e5                	mov    %esp,%ebp
+  80073c:	53                   	push   %ebx
+  80073d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800740:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800743:	b8 00 00 00 00       	mov    $0x0,%eax
+  800748:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80074c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80074f:	83 c0 01             	add    $0x1,%eax
+  800752:	84 d2                	test   %dl,%dl
+  800754:	75 f2                	jne    800748 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800756:	89 c8                	mov    %ecx,%eax
+  800758:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80075b:	c9                   	leave
+  80075c:	c3                   	ret
+
+0080075d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80075d:	55                   	push   %ebp
+  80075e:	89 e5                	mov    %esp,%ebp
+  800760:	53                   	push   %ebx
+  800761:	83 ec 10             	sub    $0x10,%esp
+  800764:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800767:	53                   	push   %ebx
+  800768:	e8 91 ff ff ff       	call   8006fe <strlen>
+  80076d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800770:	ff 75 0c             	push   0xc(%ebp)
+  800773:	01 d8                	add    %ebx,%eax
+  800775:	50                   	push   %eax
+  800776:	e8 be ff ff ff       	call   800739 <strcpy>
+	return dst;
+}
+  80077b:	89 d8                	mov    %ebx,%eax
+  80077d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800780:	c9                   	leave
+  800781:	c3                   	ret
+
+00800782 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800782:	55                   	push   %ebp
+  800783:	89 e5                	mov    %esp,%ebp
+  800785:	56                   	push   %esi
+  800786:	53                   	push   %ebx
+  800787:	8b 75 08             	mov    0x8(%ebp),%esi
+  80078a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80078d:	89 f3                	mov    %esi,%ebx
+  80078f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800792:	89 f0                	mov    %esi,%eax
+  800794:	eb 0f                	jmp    8007a5 <strncpy+0x23>
+		*dst++ = *src;
+  800796:	83 c0 01             	add    $0x1,%eax
+  800799:	0f b6 0a             	movzbl (%edx),%ecx
+  80079c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80079f:	80 f9 01             	cmp    $0x1,%cl
+  8007a2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007a5:	39 d8                	cmp    %ebx,%eax
+  8007a7:	75 ed                	jne    800796 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007a9:	89 f0                	mov    %esi,%eax
+  8007ab:	5b                   	pop    %ebx
+  8007ac:	5e                   	pop    %esi
+  8007ad:	5d                   	pop    %ebp
+  8007ae:	c3                   	ret
+
+008007af <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007af:	55                   	push   %ebp
+  8007b0:	89 e5                	mov    %esp,%ebp
+  8007b2:	56                   	push   %esi
+  8007b3:	53                   	push   %ebx
+  8007b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007ba:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007bd:	89 f0                	mov    %esi,%eax
+  8007bf:	85 d2                	test   %edx,%edx
+  8007c1:	74 21                	je     8007e4 <strlcpy+0x35>
+  8007c3:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007c7:	89 f2                	mov    %esi,%edx
+  8007c9:	eb 09                	jmp    8007d4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007cb:	83 c1 01             	add    $0x1,%ecx
+  8007ce:	83 c2 01             	add    $0x1,%edx
+  8007d1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007d4:	39 c2                	cmp    %eax,%edx
+  8007d6:	74 09                	je     8007e1 <strlcpy+0x32>
+  8007d8:	0f b6 19             	movzbl (%ecx),%ebx
+  8007db:	84 db                	test   %bl,%bl
+  8007dd:	75 ec                	jne    8007cb <strlcpy+0x1c>
+  8007df:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007e1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007e4:	29 f0                	sub    %esi,%eax
+}
+  8007e6:	5b                   	pop    %ebx
+  8007e7:	5e                   	pop    %esi
+  8007e8:	5d                   	pop    %ebp
+  8007e9:	c3                   	ret
+
+008007ea <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007ea:	55                   	push   %ebp
+  8007eb:	89 e5                	mov    %esp,%ebp
+  8007ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007f3:	eb 06                	jmp    8007fb <strcmp+0x11>
+		p++, q++;
+  8007f5:	83 c1 01             	add    $0x1,%ecx
+  8007f8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007fb:	0f b6 01             	movzbl (%ecx),%eax
+  8007fe:	84 c0                	test   %al,%al
+  800800:	74 04                	je     800806 <strcmp+0x1c>
+  800802:	3a 02                	cmp    (%edx),%al
+  800804:	74 ef                	je     8007f5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800806:	0f b6 c0             	movzbl %al,%eax
+  800809:	0f b6 12             	movzbl (%edx),%edx
+  80080c:	29 d0                	sub    %edx,%eax
+}
+  80080e:	5d                   	pop    %ebp
+  80080f:	c3                   	ret
+
+00800810 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800810:	55                   	push   %ebp
+  800811:	89 e5                	mov    %esp,%ebp
+  800813:	53                   	push   %ebx
+  800814:	8b 45 08             	mov    0x8(%ebp),%eax
+  800817:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80081a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80081d:	eb 09                	jmp    800828 <strncmp+0x18>
+		n--, p++, q++;
+  80081f:	83 ea 01             	sub    $0x1,%edx
+  800822:	83 c0 01             	add    $0x1,%eax
+  800825:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800828:	85 d2                	test   %edx,%edx
+  80082a:	74 18                	je     800844 <strncmp+0x34>
+  80082c:	0f b6 18             	movzbl (%eax),%ebx
+  80082f:	84 db                	test   %bl,%bl
+  800831:	74 04                	je     800837 <strncmp+0x27>
+  800833:	3a 19                	cmp    (%ecx),%bl
+  800835:	74 e8                	je     80081f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800837:	0f b6 00             	movzbl (%eax),%eax
+  80083a:	0f b6 11             	movzbl (%ecx),%edx
+  80083d:	29 d0                	sub    %edx,%eax
+}
+  80083f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800842:	c9                   	leave
+  800843:	c3                   	ret
+		return 0;
+  800844:	b8 00 00 00 00       	mov    $0x0,%eax
+  800849:	eb f4                	jmp    80083f <strncmp+0x2f>
+
+0080084b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80084b:	55                   	push   %ebp
+  80084c:	89 e5                	mov    %esp,%ebp
+  80084e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800851:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800855:	eb 03                	jmp    80085a <strchr+0xf>
+  800857:	83 c0 01             	add    $0x1,%eax
+  80085a:	0f b6 10             	movzbl (%eax),%edx
+  80085d:	84 d2                	test   %dl,%dl
+  80085f:	74 06                	je     800867 <strchr+0x1c>
+		if (*s == c)
+  800861:	38 ca                	cmp    %cl,%dl
+  800863:	75 f2                	jne    800857 <strchr+0xc>
+  800865:	eb 05                	jmp    80086c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800867:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80086c:	5d                   	pop    %ebp
+  80086d:	c3                   	ret
+
+0080086e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80086e:	55                   	push   %ebp
+  80086f:	89 e5                	mov    %esp,%ebp
+  800871:	8b 45 08             	mov    0x8(%ebp),%eax
+  800874:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800878:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80087b:	38 ca                	cmp    %cl,%dl
+  80087d:	74 09                	je     800888 <strfind+0x1a>
+  80087f:	84 d2                	test   %dl,%dl
+  800881:	74 05                	je     800888 <strfind+0x1a>
+	for (; *s; s++)
+  800883:	83 c0 01             	add    $0x1,%eax
+  800886:	eb f0                	jmp    800878 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800888:	5d                   	pop    %ebp
+  800889:	c3                   	ret
+
+0080088a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80088a:	55                   	push   %ebp
+  80088b:	89 e5                	mov    %esp,%ebp
+  80088d:	57                   	push   %edi
+  80088e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800891:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800894:	85 c9                	test   %ecx,%ecx
+  800896:	74 20                	je     8008b8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800898:	89 f8                	mov    %edi,%eax
+  80089a:	09 c8                	or     %ecx,%eax
+  80089c:	a8 03                	test   $0x3,%al
+  80089e:	75 12                	jne    8008b2 <memset+0x28>
+		c &= 0xFF;
+  8008a0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008a4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008aa:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008ad:	fc                   	cld
+  8008ae:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008b0:	eb 06                	jmp    8008b8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008b5:	fc                   	cld
+  8008b6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008b8:	89 f8                	mov    %edi,%eax
+  8008ba:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008bd:	c9                   	leave
+  8008be:	c3                   	ret
+
+008008bf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008bf:	55                   	push   %ebp
+  8008c0:	89 e5                	mov    %esp,%ebp
+  8008c2:	57                   	push   %edi
+  8008c3:	56                   	push   %esi
+  8008c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008ca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008cd:	39 c6                	cmp    %eax,%esi
+  8008cf:	73 32                	jae    800903 <memmove+0x44>
+  8008d1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008d4:	39 d0                	cmp    %edx,%eax
+  8008d6:	73 2b                	jae    800903 <memmove+0x44>
+		s += n;
+		d += n;
+  8008d8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008db:	89 d6                	mov    %edx,%esi
+  8008dd:	09 fe                	or     %edi,%esi
+  8008df:	09 ce                	or     %ecx,%esi
+  8008e1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008e7:	75 0e                	jne    8008f7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008e9:	83 ef 04             	sub    $0x4,%edi
+  8008ec:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008ef:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008f2:	fd                   	std
+  8008f3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008f5:	eb 09                	jmp    800900 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008f7:	83 ef 01             	sub    $0x1,%edi
+  8008fa:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008fd:	fd                   	std
+  8008fe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800900:	fc                   	cld
+  800901:	eb 1a                	jmp    80091d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800903:	89 f2                	mov    %esi,%edx
+  800905:	09 c2                	or     %eax,%edx
+  800907:	09 ca                	or     %ecx,%edx
+  800909:	f6 c2 03             	test   $0x3,%dl
+  80090c:	75 0a                	jne    800918 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80090e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800911:	89 c7                	mov    %eax,%edi
+  800913:	fc                   	cld
+  800914:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800916:	eb 05                	jmp    80091d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800918:	89 c7                	mov    %eax,%edi
+  80091a:	fc                   	cld
+  80091b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80091d:	5e                   	pop    %esi
+  80091e:	5f                   	pop    %edi
+  80091f:	5d                   	pop    %ebp
+  800920:	c3                   	ret
+
+00800921 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800921:	55                   	push   %ebp
+  800922:	89 e5                	mov    %esp,%ebp
+  800924:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800927:	ff 75 10             	push   0x10(%ebp)
+  80092a:	ff 75 0c             	push   0xc(%ebp)
+  80092d:	ff 75 08             	push   0x8(%ebp)
+  800930:	e8 8a ff ff ff       	call   8008bf <memmove>
+}
+  800935:	c9                   	leave
+  800936:	c3                   	ret
+
+00800937 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800937:	55                   	push   %ebp
+  800938:	89 e5                	mov    %esp,%ebp
+  80093a:	56                   	push   %esi
+  80093b:	53                   	push   %ebx
+  80093c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800942:	89 c6                	mov    %eax,%esi
+  800944:	03 75 10             	add    0x10(%ebp),%esi
+  800947:	eb 06                	jmp    80094f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800949:	83 c0 01             	add    $0x1,%eax
+  80094c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80094f:	39 f0                	cmp    %esi,%eax
+  800951:	74 14                	je     800967 <memcmp+0x30>
+		if (*s1 != *s2)
+  800953:	0f b6 08             	movzbl (%eax),%ecx
+  800956:	0f b6 1a             	movzbl (%edx),%ebx
+  800959:	38 d9                	cmp    %bl,%cl
+  80095b:	74 ec                	je     800949 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80095d:	0f b6 c1             	movzbl %cl,%eax
+  800960:	0f b6 db             	movzbl %bl,%ebx
+  800963:	29 d8                	sub    %ebx,%eax
+  800965:	eb 05                	jmp    80096c <memcmp+0x35>
+	}
+
+	return 0;
+  800967:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80096c:	5b                   	pop    %ebx
+  80096d:	5e                   	pop    %esi
+  80096e:	5d                   	pop    %ebp
+  80096f:	c3                   	ret
+
+00800970 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800970:	55                   	push   %ebp
+  800971:	89 e5                	mov    %esp,%ebp
+  800973:	8b 45 08             	mov    0x8(%ebp),%eax
+  800976:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800979:	89 c2                	mov    %eax,%edx
+  80097b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80097e:	eb 03                	jmp    800983 <memfind+0x13>
+  800980:	83 c0 01             	add    $0x1,%eax
+  800983:	39 d0                	cmp    %edx,%eax
+  800985:	73 04                	jae    80098b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800987:	38 08                	cmp    %cl,(%eax)
+  800989:	75 f5                	jne    800980 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80098b:	5d                   	pop    %ebp
+  80098c:	c3                   	ret
+
+0080098d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80098d:	55                   	push   %ebp
+  80098e:	89 e5                	mov    %esp,%ebp
+  800990:	57                   	push   %edi
+  800991:	56                   	push   %esi
+  800992:	53                   	push   %ebx
+  800993:	8b 55 08             	mov    0x8(%ebp),%edx
+  800996:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800999:	eb 03                	jmp    80099e <strtol+0x11>
+		s++;
+  80099b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80099e:	0f b6 02             	movzbl (%edx),%eax
+  8009a1:	3c 20                	cmp    $0x20,%al
+  8009a3:	74 f6                	je     80099b <strtol+0xe>
+  8009a5:	3c 09                	cmp    $0x9,%al
+  8009a7:	74 f2                	je     80099b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009a9:	3c 2b                	cmp    $0x2b,%al
+  8009ab:	74 2a                	je     8009d7 <strtol+0x4a>
+	int neg = 0;
+  8009ad:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009b2:	3c 2d                	cmp    $0x2d,%al
+  8009b4:	74 2b                	je     8009e1 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009b6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009bc:	75 0f                	jne    8009cd <strtol+0x40>
+  8009be:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009c1:	74 28                	je     8009eb <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009c3:	85 db                	test   %ebx,%ebx
+  8009c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009ca:	0f 44 d8             	cmove  %eax,%ebx
+  8009cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009d5:	eb 46                	jmp    800a1d <strtol+0x90>
+		s++;
+  8009d7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009df:	eb d5                	jmp    8009b6 <strtol+0x29>
+		s++, neg = 1;
+  8009e1:	83 c2 01             	add    $0x1,%edx
+  8009e4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009e9:	eb cb                	jmp    8009b6 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009eb:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009ef:	74 0e                	je     8009ff <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009f1:	85 db                	test   %ebx,%ebx
+  8009f3:	75 d8                	jne    8009cd <strtol+0x40>
+		s++, base = 8;
+  8009f5:	83 c2 01             	add    $0x1,%edx
+  8009f8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009fd:	eb ce                	jmp    8009cd <strtol+0x40>
+		s += 2, base = 16;
+  8009ff:	83 c2 02             	add    $0x2,%edx
+  800a02:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a07:	eb c4                	jmp    8009cd <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a09:	0f be c0             	movsbl %al,%eax
+  800a0c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a0f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a12:	7d 3a                	jge    800a4e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a14:	83 c2 01             	add    $0x1,%edx
+  800a17:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a1b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a1d:	0f b6 02             	movzbl (%edx),%eax
+  800a20:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a23:	89 f3                	mov    %esi,%ebx
+  800a25:	80 fb 09             	cmp    $0x9,%bl
+  800a28:	76 df                	jbe    800a09 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a2a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a2d:	89 f3                	mov    %esi,%ebx
+  800a2f:	80 fb 19             	cmp    $0x19,%bl
+  800a32:	77 08                	ja     800a3c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a34:	0f be c0             	movsbl %al,%eax
+  800a37:	83 e8 57             	sub    $0x57,%eax
+  800a3a:	eb d3                	jmp    800a0f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a3c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a3f:	89 f3                	mov    %esi,%ebx
+  800a41:	80 fb 19             	cmp    $0x19,%bl
+  800a44:	77 08                	ja     800a4e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a46:	0f be c0             	movsbl %al,%eax
+  800a49:	83 e8 37             	sub    $0x37,%eax
+  800a4c:	eb c1                	jmp    800a0f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a4e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a52:	74 05                	je     800a59 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a57:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a59:	89 c8                	mov    %ecx,%eax
+  800a5b:	f7 d8                	neg    %eax
+  800a5d:	85 ff                	test   %edi,%edi
+  800a5f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a62:	89 c8                	mov    %ecx,%eax
+  800a64:	5b                   	pop    %ebx
+  800a65:	5e                   	pop    %esi
+  800a66:	5f                   	pop    %edi
+  800a67:	5d                   	pop    %ebp
+  800a68:	c3                   	ret
+
+00800a69 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	57                   	push   %edi
+  800a6d:	56                   	push   %esi
+  800a6e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a7a:	89 c3                	mov    %eax,%ebx
+  800a7c:	89 c7                	mov    %eax,%edi
+  800a7e:	89 c6                	mov    %eax,%esi
+  800a80:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800a82:	5b                   	pop    %ebx
+  800a83:	5e                   	pop    %esi
+  800a84:	5f                   	pop    %edi
+  800a85:	5d                   	pop    %ebp
+  800a86:	c3                   	ret
+
+00800a87 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800a87:	55                   	push   %ebp
+  800a88:	89 e5                	mov    %esp,%ebp
+  800a8a:	57                   	push   %edi
+  800a8b:	56                   	push   %esi
+  800a8c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a92:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a97:	89 d1                	mov    %edx,%ecx
+  800a99:	89 d3                	mov    %edx,%ebx
+  800a9b:	89 d7                	mov    %edx,%edi
+  800a9d:	89 d6                	mov    %edx,%esi
+  800a9f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800aa1:	5b                   	pop    %ebx
+  800aa2:	5e                   	pop    %esi
+  800aa3:	5f                   	pop    %edi
+  800aa4:	5d                   	pop    %ebp
+  800aa5:	c3                   	ret
+
+00800aa6 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800aa6:	55                   	push   %ebp
+  800aa7:	89 e5                	mov    %esp,%ebp
+  800aa9:	57                   	push   %edi
+  800aaa:	56                   	push   %esi
+  800aab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800aac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ab9:	89 cb                	mov    %ecx,%ebx
+  800abb:	89 cf                	mov    %ecx,%edi
+  800abd:	89 ce                	mov    %ecx,%esi
+  800abf:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800ac1:	5b                   	pop    %ebx
+  800ac2:	5e                   	pop    %esi
+  800ac3:	5f                   	pop    %edi
+  800ac4:	5d                   	pop    %ebp
+  800ac5:	c3                   	ret
+
+00800ac6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ac6:	55                   	push   %ebp
+  800ac7:	89 e5                	mov    %esp,%ebp
+  800ac9:	57                   	push   %edi
+  800aca:	56                   	push   %esi
+  800acb:	53                   	push   %ebx
+  800acc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800acf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ad7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800adc:	89 cb                	mov    %ecx,%ebx
+  800ade:	89 cf                	mov    %ecx,%edi
+  800ae0:	89 ce                	mov    %ecx,%esi
+  800ae2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ae4:	85 c0                	test   %eax,%eax
+  800ae6:	7f 08                	jg     800af0 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ae8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aeb:	5b                   	pop    %ebx
+  800aec:	5e                   	pop    %esi
+  800aed:	5f                   	pop    %edi
+  800aee:	5d                   	pop    %ebp
+  800aef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800af0:	83 ec 0c             	sub    $0xc,%esp
+  800af3:	50                   	push   %eax
+  800af4:	6a 03                	push   $0x3
+  800af6:	68 9f 29 80 00       	push   $0x80299f
+  800afb:	6a 23                	push   $0x23
+  800afd:	68 bc 29 80 00       	push   $0x8029bc
+  800b02:	e8 d5 15 00 00       	call   8020dc <_panic>
+
+00800b07 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b07:	55                   	push   %ebp
+  800b08:	89 e5                	mov    %esp,%ebp
+  800b0a:	57                   	push   %edi
+  800b0b:	56                   	push   %esi
+  800b0c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b12:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b17:	89 d1                	mov    %edx,%ecx
+  800b19:	89 d3                	mov    %edx,%ebx
+  800b1b:	89 d7                	mov    %edx,%edi
+  800b1d:	89 d6                	mov    %edx,%esi
+  800b1f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b21:	5b                   	pop    %ebx
+  800b22:	5e                   	pop    %esi
+  800b23:	5f                   	pop    %edi
+  800b24:	5d                   	pop    %ebp
+  800b25:	c3                   	ret
+
+00800b26 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	57                   	push   %edi
+  800b2a:	56                   	push   %esi
+  800b2b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b31:	b8 16 00 00 00       	mov    $0x16,%eax
+  800b36:	89 d1                	mov    %edx,%ecx
+  800b38:	89 d3                	mov    %edx,%ebx
+  800b3a:	89 d7                	mov    %edx,%edi
+  800b3c:	89 d6                	mov    %edx,%esi
+  800b3e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b40:	5b                   	pop    %ebx
+  800b41:	5e                   	pop    %esi
+  800b42:	5f                   	pop    %edi
+  800b43:	5d                   	pop    %ebp
+  800b44:	c3                   	ret
+
+00800b45 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800b45:	55                   	push   %ebp
+  800b46:	89 e5                	mov    %esp,%ebp
+  800b48:	57                   	push   %edi
+  800b49:	56                   	push   %esi
+  800b4a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b50:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800b55:	89 d1                	mov    %edx,%ecx
+  800b57:	89 d3                	mov    %edx,%ebx
+  800b59:	89 d7                	mov    %edx,%edi
+  800b5b:	89 d6                	mov    %edx,%esi
+  800b5d:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800b5f:	5b                   	pop    %ebx
+  800b60:	5e                   	pop    %esi
+  800b61:	5f                   	pop    %edi
+  800b62:	5d                   	pop    %ebp
+  800b63:	c3                   	ret
+
+00800b64 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800b64:	55                   	push   %ebp
+  800b65:	89 e5                	mov    %esp,%ebp
+  800b67:	57                   	push   %edi
+  800b68:	56                   	push   %esi
+  800b69:	53                   	push   %ebx
+  800b6a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b78:	b8 15 00 00 00       	mov    $0x15,%eax
+  800b7d:	89 df                	mov    %ebx,%edi
+  800b7f:	89 de                	mov    %ebx,%esi
+  800b81:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b83:	85 c0                	test   %eax,%eax
+  800b85:	7f 08                	jg     800b8f <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800b87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b8a:	5b                   	pop    %ebx
+  800b8b:	5e                   	pop    %esi
+  800b8c:	5f                   	pop    %edi
+  800b8d:	5d                   	pop    %ebp
+  800b8e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b8f:	83 ec 0c             	sub    $0xc,%esp
+  800b92:	50                   	push   %eax
+  800b93:	6a 15                	push   $0x15
+  800b95:	68 9f 29 80 00       	push   $0x80299f
+  800b9a:	6a 23                	push   $0x23
+  800b9c:	68 bc 29 80 00       	push   $0x8029bc
+  800ba1:	e8 36 15 00 00       	call   8020dc <_panic>
+
+00800ba6 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ba6:	55                   	push   %ebp
+  800ba7:	89 e5                	mov    %esp,%ebp
+  800ba9:	57                   	push   %edi
+  800baa:	56                   	push   %esi
+  800bab:	53                   	push   %ebx
+  800bac:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800baf:	be 00 00 00 00       	mov    $0x0,%esi
+  800bb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bba:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bbf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bc2:	89 f7                	mov    %esi,%edi
+  800bc4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bc6:	85 c0                	test   %eax,%eax
+  800bc8:	7f 08                	jg     800bd2 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bcd:	5b                   	pop    %ebx
+  800bce:	5e                   	pop    %esi
+  800bcf:	5f                   	pop    %edi
+  800bd0:	5d                   	pop    %ebp
+  800bd1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bd2:	83 ec 0c             	sub    $0xc,%esp
+  800bd5:	50                   	push   %eax
+  800bd6:	6a 05                	push   $0x5
+  800bd8:	68 9f 29 80 00       	push   $0x80299f
+  800bdd:	6a 23                	push   $0x23
+  800bdf:	68 bc 29 80 00       	push   $0x8029bc
+  800be4:	e8 f3 14 00 00       	call   8020dc <_panic>
+
+00800be9 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800be9:	55                   	push   %ebp
+  800bea:	89 e5                	mov    %esp,%ebp
+  800bec:	57                   	push   %edi
+  800bed:	56                   	push   %esi
+  800bee:	53                   	push   %ebx
+  800bef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bf2:	be 00 00 00 00       	mov    $0x0,%esi
+  800bf7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfd:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c05:	89 f7                	mov    %esi,%edi
+  800c07:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c09:	85 c0                	test   %eax,%eax
+  800c0b:	7f 08                	jg     800c15 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c10:	5b                   	pop    %ebx
+  800c11:	5e                   	pop    %esi
+  800c12:	5f                   	pop    %edi
+  800c13:	5d                   	pop    %ebp
+  800c14:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c15:	83 ec 0c             	sub    $0xc,%esp
+  800c18:	50                   	push   %eax
+  800c19:	6a 06                	push   $0x6
+  800c1b:	68 9f 29 80 00       	push   $0x80299f
+  800c20:	6a 23                	push   $0x23
+  800c22:	68 bc 29 80 00       	push   $0x8029bc
+  800c27:	e8 b0 14 00 00       	call   8020dc <_panic>
+
+00800c2c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c2c:	55                   	push   %ebp
+  800c2d:	89 e5                	mov    %esp,%ebp
+  800c2f:	57                   	push   %edi
+  800c30:	56                   	push   %esi
+  800c31:	53                   	push   %ebx
+  800c32:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3b:	b8 07 00 00 00       	mov    $0x7,%eax
+  800c40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c43:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c46:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c49:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c4b:	85 c0                	test   %eax,%eax
+  800c4d:	7f 08                	jg     800c57 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c52:	5b                   	pop    %ebx
+  800c53:	5e                   	pop    %esi
+  800c54:	5f                   	pop    %edi
+  800c55:	5d                   	pop    %ebp
+  800c56:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c57:	83 ec 0c             	sub    $0xc,%esp
+  800c5a:	50                   	push   %eax
+  800c5b:	6a 07                	push   $0x7
+  800c5d:	68 9f 29 80 00       	push   $0x80299f
+  800c62:	6a 23                	push   $0x23
+  800c64:	68 bc 29 80 00       	push   $0x8029bc
+  800c69:	e8 6e 14 00 00       	call   8020dc <_panic>
+
+00800c6e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c6e:	55                   	push   %ebp
+  800c6f:	89 e5                	mov    %esp,%ebp
+  800c71:	57                   	push   %edi
+  800c72:	56                   	push   %esi
+  800c73:	53                   	push   %ebx
+  800c74:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c82:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c87:	89 df                	mov    %ebx,%edi
+  800c89:	89 de                	mov    %ebx,%esi
+  800c8b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c8d:	85 c0                	test   %eax,%eax
+  800c8f:	7f 08                	jg     800c99 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c94:	5b                   	pop    %ebx
+  800c95:	5e                   	pop    %esi
+  800c96:	5f                   	pop    %edi
+  800c97:	5d                   	pop    %ebp
+  800c98:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c99:	83 ec 0c             	sub    $0xc,%esp
+  800c9c:	50                   	push   %eax
+  800c9d:	6a 08                	push   $0x8
+  800c9f:	68 9f 29 80 00       	push   $0x80299f
+  800ca4:	6a 23                	push   $0x23
+  800ca6:	68 bc 29 80 00       	push   $0x8029bc
+  800cab:	e8 2c 14 00 00       	call   8020dc <_panic>
+
+00800cb0 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800cb0:	55                   	push   %ebp
+  800cb1:	89 e5                	mov    %esp,%ebp
+  800cb3:	57                   	push   %edi
+  800cb4:	56                   	push   %esi
+  800cb5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbc:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cc1:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cc9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ccc:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800cce:	5b                   	pop    %ebx
+  800ccf:	5e                   	pop    %esi
+  800cd0:	5f                   	pop    %edi
+  800cd1:	5d                   	pop    %ebp
+  800cd2:	c3                   	ret
+
+00800cd3 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800cd3:	55                   	push   %ebp
+  800cd4:	89 e5                	mov    %esp,%ebp
+  800cd6:	57                   	push   %edi
+  800cd7:	56                   	push   %esi
+  800cd8:	53                   	push   %ebx
+  800cd9:	8b 45 18             	mov    0x18(%ebp),%eax
+  800cdc:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800cdf:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800ce4:	77 27                	ja     800d0d <sys_page_map_range+0x3a>
+  800ce6:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800cec:	77 1f                	ja     800d0d <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800cee:	c1 e0 0c             	shl    $0xc,%eax
+  800cf1:	89 c6                	mov    %eax,%esi
+  800cf3:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800cf5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d03:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d06:	cd 30                	int    $0x30
+}
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+		return -E_INVAL;
+  800d0d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d12:	eb f4                	jmp    800d08 <sys_page_map_range+0x35>
+
+00800d14 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800d14:	55                   	push   %ebp
+  800d15:	89 e5                	mov    %esp,%ebp
+  800d17:	57                   	push   %edi
+  800d18:	56                   	push   %esi
+  800d19:	53                   	push   %ebx
+  800d1a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d23:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d28:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d30:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d33:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d35:	85 c0                	test   %eax,%eax
+  800d37:	7f 08                	jg     800d41 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800d39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3c:	5b                   	pop    %ebx
+  800d3d:	5e                   	pop    %esi
+  800d3e:	5f                   	pop    %edi
+  800d3f:	5d                   	pop    %ebp
+  800d40:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d41:	83 ec 0c             	sub    $0xc,%esp
+  800d44:	50                   	push   %eax
+  800d45:	6a 0c                	push   $0xc
+  800d47:	68 9f 29 80 00       	push   $0x80299f
+  800d4c:	6a 23                	push   $0x23
+  800d4e:	68 bc 29 80 00       	push   $0x8029bc
+  800d53:	e8 84 13 00 00       	call   8020dc <_panic>
+
+00800d58 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800d58:	55                   	push   %ebp
+  800d59:	89 e5                	mov    %esp,%ebp
+  800d5b:	57                   	push   %edi
+  800d5c:	56                   	push   %esi
+  800d5d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d5e:	be 00 00 00 00       	mov    $0x0,%esi
+  800d63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d69:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d71:	89 f7                	mov    %esi,%edi
+  800d73:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800d75:	5b                   	pop    %ebx
+  800d76:	5e                   	pop    %esi
+  800d77:	5f                   	pop    %edi
+  800d78:	5d                   	pop    %ebp
+  800d79:	c3                   	ret
+
+00800d7a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d7a:	55                   	push   %ebp
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	57                   	push   %edi
+  800d7e:	56                   	push   %esi
+  800d7f:	53                   	push   %ebx
+  800d80:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d93:	89 df                	mov    %ebx,%edi
+  800d95:	89 de                	mov    %ebx,%esi
+  800d97:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d99:	85 c0                	test   %eax,%eax
+  800d9b:	7f 08                	jg     800da5 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da5:	83 ec 0c             	sub    $0xc,%esp
+  800da8:	50                   	push   %eax
+  800da9:	6a 0f                	push   $0xf
+  800dab:	68 9f 29 80 00       	push   $0x80299f
+  800db0:	6a 23                	push   $0x23
+  800db2:	68 bc 29 80 00       	push   $0x8029bc
+  800db7:	e8 20 13 00 00       	call   8020dc <_panic>
+
+00800dbc <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	57                   	push   %edi
+  800dc0:	56                   	push   %esi
+  800dc1:	53                   	push   %ebx
+  800dc2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd0:	b8 10 00 00 00       	mov    $0x10,%eax
+  800dd5:	89 df                	mov    %ebx,%edi
+  800dd7:	89 de                	mov    %ebx,%esi
+  800dd9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddb:	85 c0                	test   %eax,%eax
+  800ddd:	7f 08                	jg     800de7 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de2:	5b                   	pop    %ebx
+  800de3:	5e                   	pop    %esi
+  800de4:	5f                   	pop    %edi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de7:	83 ec 0c             	sub    $0xc,%esp
+  800dea:	50                   	push   %eax
+  800deb:	6a 10                	push   $0x10
+  800ded:	68 9f 29 80 00       	push   $0x80299f
+  800df2:	6a 23                	push   $0x23
+  800df4:	68 bc 29 80 00       	push   $0x8029bc
+  800df9:	e8 de 12 00 00       	call   8020dc <_panic>
+
+00800dfe <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	57                   	push   %edi
+  800e02:	56                   	push   %esi
+  800e03:	53                   	push   %ebx
+  800e04:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e12:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e17:	89 df                	mov    %ebx,%edi
+  800e19:	89 de                	mov    %ebx,%esi
+  800e1b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e1d:	85 c0                	test   %eax,%eax
+  800e1f:	7f 08                	jg     800e29 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800e21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e24:	5b                   	pop    %ebx
+  800e25:	5e                   	pop    %esi
+  800e26:	5f                   	pop    %edi
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+  800e2c:	50                   	push   %eax
+  800e2d:	6a 11                	push   $0x11
+  800e2f:	68 9f 29 80 00       	push   $0x80299f
+  800e34:	6a 23                	push   $0x23
+  800e36:	68 bc 29 80 00       	push   $0x8029bc
+  800e3b:	e8 9c 12 00 00       	call   8020dc <_panic>
+
+00800e40 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800e40:	55                   	push   %ebp
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	57                   	push   %edi
+  800e44:	56                   	push   %esi
+  800e45:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4b:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e50:	89 d1                	mov    %edx,%ecx
+  800e52:	89 d3                	mov    %edx,%ebx
+  800e54:	89 d7                	mov    %edx,%edi
+  800e56:	89 d6                	mov    %edx,%esi
+  800e58:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800e5a:	5b                   	pop    %ebx
+  800e5b:	5e                   	pop    %esi
+  800e5c:	5f                   	pop    %edi
+  800e5d:	5d                   	pop    %ebp
+  800e5e:	c3                   	ret
+
+00800e5f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e5f:	55                   	push   %ebp
+  800e60:	89 e5                	mov    %esp,%ebp
+  800e62:	57                   	push   %edi
+  800e63:	56                   	push   %esi
+  800e64:	53                   	push   %ebx
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e73:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e78:	89 df                	mov    %ebx,%edi
+  800e7a:	89 de                	mov    %ebx,%esi
+  800e7c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e7e:	85 c0                	test   %eax,%eax
+  800e80:	7f 08                	jg     800e8a <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e85:	5b                   	pop    %ebx
+  800e86:	5e                   	pop    %esi
+  800e87:	5f                   	pop    %edi
+  800e88:	5d                   	pop    %ebp
+  800e89:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8a:	83 ec 0c             	sub    $0xc,%esp
+  800e8d:	50                   	push   %eax
+  800e8e:	6a 13                	push   $0x13
+  800e90:	68 9f 29 80 00       	push   $0x80299f
+  800e95:	6a 23                	push   $0x23
+  800e97:	68 bc 29 80 00       	push   $0x8029bc
+  800e9c:	e8 3b 12 00 00       	call   8020dc <_panic>
+
+00800ea1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ea1:	55                   	push   %ebp
+  800ea2:	89 e5                	mov    %esp,%ebp
+  800ea4:	57                   	push   %edi
+  800ea5:	56                   	push   %esi
+  800ea6:	53                   	push   %ebx
+  800ea7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eaa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb5:	b8 14 00 00 00       	mov    $0x14,%eax
+  800eba:	89 df                	mov    %ebx,%edi
+  800ebc:	89 de                	mov    %ebx,%esi
+  800ebe:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec0:	85 c0                	test   %eax,%eax
+  800ec2:	7f 08                	jg     800ecc <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ec4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec7:	5b                   	pop    %ebx
+  800ec8:	5e                   	pop    %esi
+  800ec9:	5f                   	pop    %edi
+  800eca:	5d                   	pop    %ebp
+  800ecb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ecc:	83 ec 0c             	sub    $0xc,%esp
+  800ecf:	50                   	push   %eax
+  800ed0:	6a 14                	push   $0x14
+  800ed2:	68 9f 29 80 00       	push   $0x80299f
+  800ed7:	6a 23                	push   $0x23
+  800ed9:	68 bc 29 80 00       	push   $0x8029bc
+  800ede:	e8 f9 11 00 00       	call   8020dc <_panic>
+
+00800ee3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800ee3:	55                   	push   %ebp
+  800ee4:	89 e5                	mov    %esp,%ebp
+  800ee6:	57                   	push   %edi
+  800ee7:	56                   	push   %esi
+  800ee8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eef:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ef4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eff:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f01:	5b                   	pop    %ebx
+  800f02:	5e                   	pop    %esi
+  800f03:	5f                   	pop    %edi
+  800f04:	5d                   	pop    %ebp
+  800f05:	c3                   	ret
+
+00800f06 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f06:	55                   	push   %ebp
+  800f07:	89 e5                	mov    %esp,%ebp
+  800f09:	57                   	push   %edi
+  800f0a:	56                   	push   %esi
+  800f0b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f12:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f17:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f22:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f24:	5b                   	pop    %ebx
+  800f25:	5e                   	pop    %esi
+  800f26:	5f                   	pop    %edi
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+
+00800f29 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	57                   	push   %edi
+  800f2d:	56                   	push   %esi
+  800f2e:	53                   	push   %ebx
+  800f2f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3a:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f3f:	89 cb                	mov    %ecx,%ebx
+  800f41:	89 cf                	mov    %ecx,%edi
+  800f43:	89 ce                	mov    %ecx,%esi
+  800f45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	7f 08                	jg     800f53 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5e                   	pop    %esi
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f53:	83 ec 0c             	sub    $0xc,%esp
+  800f56:	50                   	push   %eax
+  800f57:	6a 19                	push   $0x19
+  800f59:	68 9f 29 80 00       	push   $0x80299f
+  800f5e:	6a 23                	push   $0x23
+  800f60:	68 bc 29 80 00       	push   $0x8029bc
+  800f65:	e8 72 11 00 00       	call   8020dc <_panic>
+
+00800f6a <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	57                   	push   %edi
+  800f6e:	56                   	push   %esi
+  800f6f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f75:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f7a:	89 d1                	mov    %edx,%ecx
+  800f7c:	89 d3                	mov    %edx,%ebx
+  800f7e:	89 d7                	mov    %edx,%edi
+  800f80:	89 d6                	mov    %edx,%esi
+  800f82:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f84:	5b                   	pop    %ebx
+  800f85:	5e                   	pop    %esi
+  800f86:	5f                   	pop    %edi
+  800f87:	5d                   	pop    %ebp
+  800f88:	c3                   	ret
+
+00800f89 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  800f89:	55                   	push   %ebp
+  800f8a:	89 e5                	mov    %esp,%ebp
+  800f8c:	57                   	push   %edi
+  800f8d:	56                   	push   %esi
+  800f8e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800f9f:	89 df                	mov    %ebx,%edi
+  800fa1:	89 de                	mov    %ebx,%esi
+  800fa3:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  800fa5:	5b                   	pop    %ebx
+  800fa6:	5e                   	pop    %esi
+  800fa7:	5f                   	pop    %edi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+
+00800faa <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	57                   	push   %edi
+  800fae:	56                   	push   %esi
+  800faf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800fc0:	89 df                	mov    %ebx,%edi
+  800fc2:	89 de                	mov    %ebx,%esi
+  800fc4:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  800fc6:	5b                   	pop    %ebx
+  800fc7:	5e                   	pop    %esi
+  800fc8:	5f                   	pop    %edi
+  800fc9:	5d                   	pop    %ebp
+  800fca:	c3                   	ret
+
+00800fcb <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fce:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fd1:	05 00 00 00 30       	add    $0x30000000,%eax
+  800fd6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800fd9:	5d                   	pop    %ebp
+  800fda:	c3                   	ret
+
+00800fdb <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fde:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe1:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800fe6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800feb:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800ff0:	5d                   	pop    %ebp
+  800ff1:	c3                   	ret
+
+00800ff2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800ff5:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800ffa:	eb 02                	jmp    800ffe <fd_alloc+0xc>
+  800ffc:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800ffe:	89 c2                	mov    %eax,%edx
+  801000:	c1 ea 16             	shr    $0x16,%edx
+  801003:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80100a:	f6 c2 01             	test   $0x1,%dl
+  80100d:	74 2b                	je     80103a <fd_alloc+0x48>
+  80100f:	89 c2                	mov    %eax,%edx
+  801011:	c1 ea 0c             	shr    $0xc,%edx
+  801014:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80101b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801021:	f6 c1 01             	test   $0x1,%cl
+  801024:	74 14                	je     80103a <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801026:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80102c:	75 ce                	jne    800ffc <fd_alloc+0xa>
+  80102e:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801033:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801038:	eb 05                	jmp    80103f <fd_alloc+0x4d>
+			return 0;
+  80103a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80103f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801042:	89 02                	mov    %eax,(%edx)
+}
+  801044:	89 c8                	mov    %ecx,%eax
+  801046:	5d                   	pop    %ebp
+  801047:	c3                   	ret
+
+00801048 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801048:	55                   	push   %ebp
+  801049:	89 e5                	mov    %esp,%ebp
+  80104b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80104e:	83 f8 1f             	cmp    $0x1f,%eax
+  801051:	77 30                	ja     801083 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801053:	c1 e0 0c             	shl    $0xc,%eax
+  801056:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80105b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801061:	f6 c2 01             	test   $0x1,%dl
+  801064:	74 24                	je     80108a <fd_lookup+0x42>
+  801066:	89 c2                	mov    %eax,%edx
+  801068:	c1 ea 0c             	shr    $0xc,%edx
+  80106b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801072:	f6 c2 01             	test   $0x1,%dl
+  801075:	74 1a                	je     801091 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801077:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80107a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80107c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801081:	5d                   	pop    %ebp
+  801082:	c3                   	ret
+		return -E_INVAL;
+  801083:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801088:	eb f7                	jmp    801081 <fd_lookup+0x39>
+		return -E_INVAL;
+  80108a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80108f:	eb f0                	jmp    801081 <fd_lookup+0x39>
+  801091:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801096:	eb e9                	jmp    801081 <fd_lookup+0x39>
+
+00801098 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801098:	55                   	push   %ebp
+  801099:	89 e5                	mov    %esp,%ebp
+  80109b:	53                   	push   %ebx
+  80109c:	83 ec 04             	sub    $0x4,%esp
+  80109f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8010a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a7:	eb 03                	jmp    8010ac <dev_lookup+0x14>
+  8010a9:	83 c0 01             	add    $0x1,%eax
+  8010ac:	8b 1c 85 48 2a 80 00 	mov    0x802a48(,%eax,4),%ebx
+  8010b3:	85 db                	test   %ebx,%ebx
+  8010b5:	74 0b                	je     8010c2 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8010b7:	39 13                	cmp    %edx,(%ebx)
+  8010b9:	75 ee                	jne    8010a9 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8010bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c0:	eb 1f                	jmp    8010e1 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8010c2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8010c7:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8010ca:	83 ec 04             	sub    $0x4,%esp
+  8010cd:	52                   	push   %edx
+  8010ce:	50                   	push   %eax
+  8010cf:	68 cc 29 80 00       	push   $0x8029cc
+  8010d4:	e8 72 f0 ff ff       	call   80014b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8010d9:	83 c4 10             	add    $0x10,%esp
+  8010dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8010e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010e4:	89 1a                	mov    %ebx,(%edx)
+}
+  8010e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010e9:	c9                   	leave
+  8010ea:	c3                   	ret
+
+008010eb <fd_close>:
+{
+  8010eb:	55                   	push   %ebp
+  8010ec:	89 e5                	mov    %esp,%ebp
+  8010ee:	57                   	push   %edi
+  8010ef:	56                   	push   %esi
+  8010f0:	53                   	push   %ebx
+  8010f1:	83 ec 24             	sub    $0x24,%esp
+  8010f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010f7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8010fa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8010fd:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010fe:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801104:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801107:	50                   	push   %eax
+  801108:	e8 3b ff ff ff       	call   801048 <fd_lookup>
+  80110d:	89 c3                	mov    %eax,%ebx
+  80110f:	83 c4 10             	add    $0x10,%esp
+  801112:	85 c0                	test   %eax,%eax
+  801114:	78 05                	js     80111b <fd_close+0x30>
+	    || fd != fd2)
+  801116:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801119:	74 16                	je     801131 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80111b:	89 f8                	mov    %edi,%eax
+  80111d:	84 c0                	test   %al,%al
+  80111f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801124:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801127:	89 d8                	mov    %ebx,%eax
+  801129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112c:	5b                   	pop    %ebx
+  80112d:	5e                   	pop    %esi
+  80112e:	5f                   	pop    %edi
+  80112f:	5d                   	pop    %ebp
+  801130:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801131:	83 ec 08             	sub    $0x8,%esp
+  801134:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801137:	50                   	push   %eax
+  801138:	ff 36                	push   (%esi)
+  80113a:	e8 59 ff ff ff       	call   801098 <dev_lookup>
+  80113f:	89 c3                	mov    %eax,%ebx
+  801141:	83 c4 10             	add    $0x10,%esp
+  801144:	85 c0                	test   %eax,%eax
+  801146:	78 1a                	js     801162 <fd_close+0x77>
+		if (dev->dev_close)
+  801148:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80114b:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80114e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801153:	85 c0                	test   %eax,%eax
+  801155:	74 0b                	je     801162 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801157:	83 ec 0c             	sub    $0xc,%esp
+  80115a:	56                   	push   %esi
+  80115b:	ff d0                	call   *%eax
+  80115d:	89 c3                	mov    %eax,%ebx
+  80115f:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801162:	83 ec 08             	sub    $0x8,%esp
+  801165:	56                   	push   %esi
+  801166:	6a 00                	push   $0x0
+  801168:	e8 01 fb ff ff       	call   800c6e <sys_page_unmap>
+	return r;
+  80116d:	83 c4 10             	add    $0x10,%esp
+  801170:	eb b5                	jmp    801127 <fd_close+0x3c>
+
+00801172 <close>:
+
+int
+close(int fdnum)
+{
+  801172:	55                   	push   %ebp
+  801173:	89 e5                	mov    %esp,%ebp
+  801175:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801178:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80117b:	50                   	push   %eax
+  80117c:	ff 75 08             	push   0x8(%ebp)
+  80117f:	e8 c4 fe ff ff       	call   801048 <fd_lookup>
+  801184:	83 c4 10             	add    $0x10,%esp
+  801187:	85 c0                	test   %eax,%eax
+  801189:	79 02                	jns    80118d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80118b:	c9                   	leave
+  80118c:	c3                   	ret
+		return fd_close(fd, 1);
+  80118d:	83 ec 08             	sub    $0x8,%esp
+  801190:	6a 01                	push   $0x1
+  801192:	ff 75 f4             	push   -0xc(%ebp)
+  801195:	e8 51 ff ff ff       	call   8010eb <fd_close>
+  80119a:	83 c4 10             	add    $0x10,%esp
+  80119d:	eb ec                	jmp    80118b <close+0x19>
+
+0080119f <close_all>:
+
+void
+close_all(void)
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	53                   	push   %ebx
+  8011a3:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8011a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8011ab:	83 ec 0c             	sub    $0xc,%esp
+  8011ae:	53                   	push   %ebx
+  8011af:	e8 be ff ff ff       	call   801172 <close>
+	for (i = 0; i < MAXFD; i++)
+  8011b4:	83 c3 01             	add    $0x1,%ebx
+  8011b7:	83 c4 10             	add    $0x10,%esp
+  8011ba:	83 fb 20             	cmp    $0x20,%ebx
+  8011bd:	75 ec                	jne    8011ab <close_all+0xc>
+}
+  8011bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011c2:	c9                   	leave
+  8011c3:	c3                   	ret
+
+008011c4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8011c4:	55                   	push   %ebp
+  8011c5:	89 e5                	mov    %esp,%ebp
+  8011c7:	57                   	push   %edi
+  8011c8:	56                   	push   %esi
+  8011c9:	53                   	push   %ebx
+  8011ca:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8011cd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011d0:	50                   	push   %eax
+  8011d1:	ff 75 08             	push   0x8(%ebp)
+  8011d4:	e8 6f fe ff ff       	call   801048 <fd_lookup>
+  8011d9:	89 c3                	mov    %eax,%ebx
+  8011db:	83 c4 10             	add    $0x10,%esp
+  8011de:	85 c0                	test   %eax,%eax
+  8011e0:	78 7f                	js     801261 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8011e2:	83 ec 0c             	sub    $0xc,%esp
+  8011e5:	ff 75 0c             	push   0xc(%ebp)
+  8011e8:	e8 85 ff ff ff       	call   801172 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8011ed:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8011f0:	c1 e6 0c             	shl    $0xc,%esi
+  8011f3:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8011f9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8011fc:	89 3c 24             	mov    %edi,(%esp)
+  8011ff:	e8 d7 fd ff ff       	call   800fdb <fd2data>
+  801204:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801206:	89 34 24             	mov    %esi,(%esp)
+  801209:	e8 cd fd ff ff       	call   800fdb <fd2data>
+  80120e:	83 c4 10             	add    $0x10,%esp
+  801211:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801214:	89 d8                	mov    %ebx,%eax
+  801216:	c1 e8 16             	shr    $0x16,%eax
+  801219:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801220:	a8 01                	test   $0x1,%al
+  801222:	74 11                	je     801235 <dup+0x71>
+  801224:	89 d8                	mov    %ebx,%eax
+  801226:	c1 e8 0c             	shr    $0xc,%eax
+  801229:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801230:	f6 c2 01             	test   $0x1,%dl
+  801233:	75 36                	jne    80126b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801235:	89 f8                	mov    %edi,%eax
+  801237:	c1 e8 0c             	shr    $0xc,%eax
+  80123a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801241:	83 ec 0c             	sub    $0xc,%esp
+  801244:	25 07 0e 00 00       	and    $0xe07,%eax
+  801249:	50                   	push   %eax
+  80124a:	56                   	push   %esi
+  80124b:	6a 00                	push   $0x0
+  80124d:	57                   	push   %edi
+  80124e:	6a 00                	push   $0x0
+  801250:	e8 d7 f9 ff ff       	call   800c2c <sys_page_map>
+  801255:	89 c3                	mov    %eax,%ebx
+  801257:	83 c4 20             	add    $0x20,%esp
+  80125a:	85 c0                	test   %eax,%eax
+  80125c:	78 33                	js     801291 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80125e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801261:	89 d8                	mov    %ebx,%eax
+  801263:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801266:	5b                   	pop    %ebx
+  801267:	5e                   	pop    %esi
+  801268:	5f                   	pop    %edi
+  801269:	5d                   	pop    %ebp
+  80126a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80126b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801272:	83 ec 0c             	sub    $0xc,%esp
+  801275:	25 07 0e 00 00       	and    $0xe07,%eax
+  80127a:	50                   	push   %eax
+  80127b:	ff 75 d4             	push   -0x2c(%ebp)
+  80127e:	6a 00                	push   $0x0
+  801280:	53                   	push   %ebx
+  801281:	6a 00                	push   $0x0
+  801283:	e8 a4 f9 ff ff       	call   800c2c <sys_page_map>
+  801288:	89 c3                	mov    %eax,%ebx
+  80128a:	83 c4 20             	add    $0x20,%esp
+  80128d:	85 c0                	test   %eax,%eax
+  80128f:	79 a4                	jns    801235 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801291:	83 ec 08             	sub    $0x8,%esp
+  801294:	56                   	push   %esi
+  801295:	6a 00                	push   $0x0
+  801297:	e8 d2 f9 ff ff       	call   800c6e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80129c:	83 c4 08             	add    $0x8,%esp
+  80129f:	ff 75 d4             	push   -0x2c(%ebp)
+  8012a2:	6a 00                	push   $0x0
+  8012a4:	e8 c5 f9 ff ff       	call   800c6e <sys_page_unmap>
+	return r;
+  8012a9:	83 c4 10             	add    $0x10,%esp
+  8012ac:	eb b3                	jmp    801261 <dup+0x9d>
+
+008012ae <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	56                   	push   %esi
+  8012b2:	53                   	push   %ebx
+  8012b3:	83 ec 18             	sub    $0x18,%esp
+  8012b6:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012b9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012bc:	50                   	push   %eax
+  8012bd:	56                   	push   %esi
+  8012be:	e8 85 fd ff ff       	call   801048 <fd_lookup>
+  8012c3:	83 c4 10             	add    $0x10,%esp
+  8012c6:	85 c0                	test   %eax,%eax
+  8012c8:	78 3c                	js     801306 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012ca:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8012cd:	83 ec 08             	sub    $0x8,%esp
+  8012d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012d3:	50                   	push   %eax
+  8012d4:	ff 33                	push   (%ebx)
+  8012d6:	e8 bd fd ff ff       	call   801098 <dev_lookup>
+  8012db:	83 c4 10             	add    $0x10,%esp
+  8012de:	85 c0                	test   %eax,%eax
+  8012e0:	78 24                	js     801306 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8012e2:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012e5:	83 e0 03             	and    $0x3,%eax
+  8012e8:	83 f8 01             	cmp    $0x1,%eax
+  8012eb:	74 20                	je     80130d <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8012ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012f0:	8b 40 08             	mov    0x8(%eax),%eax
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	74 37                	je     80132e <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8012f7:	83 ec 04             	sub    $0x4,%esp
+  8012fa:	ff 75 10             	push   0x10(%ebp)
+  8012fd:	ff 75 0c             	push   0xc(%ebp)
+  801300:	53                   	push   %ebx
+  801301:	ff d0                	call   *%eax
+  801303:	83 c4 10             	add    $0x10,%esp
+}
+  801306:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801309:	5b                   	pop    %ebx
+  80130a:	5e                   	pop    %esi
+  80130b:	5d                   	pop    %ebp
+  80130c:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80130d:	a1 08 40 80 00       	mov    0x804008,%eax
+  801312:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801315:	83 ec 04             	sub    $0x4,%esp
+  801318:	56                   	push   %esi
+  801319:	50                   	push   %eax
+  80131a:	68 0d 2a 80 00       	push   $0x802a0d
+  80131f:	e8 27 ee ff ff       	call   80014b <cprintf>
+		return -E_INVAL;
+  801324:	83 c4 10             	add    $0x10,%esp
+  801327:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80132c:	eb d8                	jmp    801306 <read+0x58>
+		return -E_NOT_SUPP;
+  80132e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801333:	eb d1                	jmp    801306 <read+0x58>
+
+00801335 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801335:	55                   	push   %ebp
+  801336:	89 e5                	mov    %esp,%ebp
+  801338:	57                   	push   %edi
+  801339:	56                   	push   %esi
+  80133a:	53                   	push   %ebx
+  80133b:	83 ec 0c             	sub    $0xc,%esp
+  80133e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801341:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801344:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801349:	eb 02                	jmp    80134d <readn+0x18>
+  80134b:	01 c3                	add    %eax,%ebx
+  80134d:	39 f3                	cmp    %esi,%ebx
+  80134f:	73 21                	jae    801372 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801351:	83 ec 04             	sub    $0x4,%esp
+  801354:	89 f0                	mov    %esi,%eax
+  801356:	29 d8                	sub    %ebx,%eax
+  801358:	50                   	push   %eax
+  801359:	89 d8                	mov    %ebx,%eax
+  80135b:	03 45 0c             	add    0xc(%ebp),%eax
+  80135e:	50                   	push   %eax
+  80135f:	57                   	push   %edi
+  801360:	e8 49 ff ff ff       	call   8012ae <read>
+		if (m < 0)
+  801365:	83 c4 10             	add    $0x10,%esp
+  801368:	85 c0                	test   %eax,%eax
+  80136a:	78 04                	js     801370 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80136c:	75 dd                	jne    80134b <readn+0x16>
+  80136e:	eb 02                	jmp    801372 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801370:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801372:	89 d8                	mov    %ebx,%eax
+  801374:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801377:	5b                   	pop    %ebx
+  801378:	5e                   	pop    %esi
+  801379:	5f                   	pop    %edi
+  80137a:	5d                   	pop    %ebp
+  80137b:	c3                   	ret
+
+0080137c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80137c:	55                   	push   %ebp
+  80137d:	89 e5                	mov    %esp,%ebp
+  80137f:	56                   	push   %esi
+  801380:	53                   	push   %ebx
+  801381:	83 ec 18             	sub    $0x18,%esp
+  801384:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801387:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80138a:	50                   	push   %eax
+  80138b:	53                   	push   %ebx
+  80138c:	e8 b7 fc ff ff       	call   801048 <fd_lookup>
+  801391:	83 c4 10             	add    $0x10,%esp
+  801394:	85 c0                	test   %eax,%eax
+  801396:	78 37                	js     8013cf <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801398:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80139b:	83 ec 08             	sub    $0x8,%esp
+  80139e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013a1:	50                   	push   %eax
+  8013a2:	ff 36                	push   (%esi)
+  8013a4:	e8 ef fc ff ff       	call   801098 <dev_lookup>
+  8013a9:	83 c4 10             	add    $0x10,%esp
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	78 1f                	js     8013cf <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013b0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013b4:	74 20                	je     8013d6 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8013b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013b9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013bc:	85 c0                	test   %eax,%eax
+  8013be:	74 37                	je     8013f7 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8013c0:	83 ec 04             	sub    $0x4,%esp
+  8013c3:	ff 75 10             	push   0x10(%ebp)
+  8013c6:	ff 75 0c             	push   0xc(%ebp)
+  8013c9:	56                   	push   %esi
+  8013ca:	ff d0                	call   *%eax
+  8013cc:	83 c4 10             	add    $0x10,%esp
+}
+  8013cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5e                   	pop    %esi
+  8013d4:	5d                   	pop    %ebp
+  8013d5:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013d6:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013db:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8013de:	83 ec 04             	sub    $0x4,%esp
+  8013e1:	53                   	push   %ebx
+  8013e2:	50                   	push   %eax
+  8013e3:	68 29 2a 80 00       	push   $0x802a29
+  8013e8:	e8 5e ed ff ff       	call   80014b <cprintf>
+		return -E_INVAL;
+  8013ed:	83 c4 10             	add    $0x10,%esp
+  8013f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013f5:	eb d8                	jmp    8013cf <write+0x53>
+		return -E_NOT_SUPP;
+  8013f7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013fc:	eb d1                	jmp    8013cf <write+0x53>
+
+008013fe <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8013fe:	55                   	push   %ebp
+  8013ff:	89 e5                	mov    %esp,%ebp
+  801401:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801404:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801407:	50                   	push   %eax
+  801408:	ff 75 08             	push   0x8(%ebp)
+  80140b:	e8 38 fc ff ff       	call   801048 <fd_lookup>
+  801410:	83 c4 10             	add    $0x10,%esp
+  801413:	85 c0                	test   %eax,%eax
+  801415:	78 0e                	js     801425 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801417:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80141a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80141d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801420:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801425:	c9                   	leave
+  801426:	c3                   	ret
+
+00801427 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801427:	55                   	push   %ebp
+  801428:	89 e5                	mov    %esp,%ebp
+  80142a:	56                   	push   %esi
+  80142b:	53                   	push   %ebx
+  80142c:	83 ec 18             	sub    $0x18,%esp
+  80142f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801432:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801435:	50                   	push   %eax
+  801436:	53                   	push   %ebx
+  801437:	e8 0c fc ff ff       	call   801048 <fd_lookup>
+  80143c:	83 c4 10             	add    $0x10,%esp
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	78 34                	js     801477 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801443:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801446:	83 ec 08             	sub    $0x8,%esp
+  801449:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80144c:	50                   	push   %eax
+  80144d:	ff 36                	push   (%esi)
+  80144f:	e8 44 fc ff ff       	call   801098 <dev_lookup>
+  801454:	83 c4 10             	add    $0x10,%esp
+  801457:	85 c0                	test   %eax,%eax
+  801459:	78 1c                	js     801477 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80145b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80145f:	74 1d                	je     80147e <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801461:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801464:	8b 40 18             	mov    0x18(%eax),%eax
+  801467:	85 c0                	test   %eax,%eax
+  801469:	74 34                	je     80149f <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80146b:	83 ec 08             	sub    $0x8,%esp
+  80146e:	ff 75 0c             	push   0xc(%ebp)
+  801471:	56                   	push   %esi
+  801472:	ff d0                	call   *%eax
+  801474:	83 c4 10             	add    $0x10,%esp
+}
+  801477:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80147a:	5b                   	pop    %ebx
+  80147b:	5e                   	pop    %esi
+  80147c:	5d                   	pop    %ebp
+  80147d:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80147e:	a1 08 40 80 00       	mov    0x804008,%eax
+  801483:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801486:	83 ec 04             	sub    $0x4,%esp
+  801489:	53                   	push   %ebx
+  80148a:	50                   	push   %eax
+  80148b:	68 ec 29 80 00       	push   $0x8029ec
+  801490:	e8 b6 ec ff ff       	call   80014b <cprintf>
+		return -E_INVAL;
+  801495:	83 c4 10             	add    $0x10,%esp
+  801498:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149d:	eb d8                	jmp    801477 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80149f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014a4:	eb d1                	jmp    801477 <ftruncate+0x50>
+
+008014a6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8014a6:	55                   	push   %ebp
+  8014a7:	89 e5                	mov    %esp,%ebp
+  8014a9:	56                   	push   %esi
+  8014aa:	53                   	push   %ebx
+  8014ab:	83 ec 18             	sub    $0x18,%esp
+  8014ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014b1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014b4:	50                   	push   %eax
+  8014b5:	ff 75 08             	push   0x8(%ebp)
+  8014b8:	e8 8b fb ff ff       	call   801048 <fd_lookup>
+  8014bd:	83 c4 10             	add    $0x10,%esp
+  8014c0:	85 c0                	test   %eax,%eax
+  8014c2:	78 49                	js     80150d <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014c4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014c7:	83 ec 08             	sub    $0x8,%esp
+  8014ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014cd:	50                   	push   %eax
+  8014ce:	ff 36                	push   (%esi)
+  8014d0:	e8 c3 fb ff ff       	call   801098 <dev_lookup>
+  8014d5:	83 c4 10             	add    $0x10,%esp
+  8014d8:	85 c0                	test   %eax,%eax
+  8014da:	78 31                	js     80150d <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8014dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014df:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8014e3:	74 2f                	je     801514 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8014e5:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8014e8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8014ef:	00 00 00 
+	stat->st_isdir = 0;
+  8014f2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8014f9:	00 00 00 
+	stat->st_dev = dev;
+  8014fc:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801502:	83 ec 08             	sub    $0x8,%esp
+  801505:	53                   	push   %ebx
+  801506:	56                   	push   %esi
+  801507:	ff 50 14             	call   *0x14(%eax)
+  80150a:	83 c4 10             	add    $0x10,%esp
+}
+  80150d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801510:	5b                   	pop    %ebx
+  801511:	5e                   	pop    %esi
+  801512:	5d                   	pop    %ebp
+  801513:	c3                   	ret
+		return -E_NOT_SUPP;
+  801514:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801519:	eb f2                	jmp    80150d <fstat+0x67>
+
+0080151b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80151b:	55                   	push   %ebp
+  80151c:	89 e5                	mov    %esp,%ebp
+  80151e:	56                   	push   %esi
+  80151f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801520:	83 ec 08             	sub    $0x8,%esp
+  801523:	6a 00                	push   $0x0
+  801525:	ff 75 08             	push   0x8(%ebp)
+  801528:	e8 e4 01 00 00       	call   801711 <open>
+  80152d:	89 c3                	mov    %eax,%ebx
+  80152f:	83 c4 10             	add    $0x10,%esp
+  801532:	85 c0                	test   %eax,%eax
+  801534:	78 1b                	js     801551 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801536:	83 ec 08             	sub    $0x8,%esp
+  801539:	ff 75 0c             	push   0xc(%ebp)
+  80153c:	50                   	push   %eax
+  80153d:	e8 64 ff ff ff       	call   8014a6 <fstat>
+  801542:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801544:	89 1c 24             	mov    %ebx,(%esp)
+  801547:	e8 26 fc ff ff       	call   801172 <close>
+	return r;
+  80154c:	83 c4 10             	add    $0x10,%esp
+  80154f:	89 f3                	mov    %esi,%ebx
+}
+  801551:	89 d8                	mov    %ebx,%eax
+  801553:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801556:	5b                   	pop    %ebx
+  801557:	5e                   	pop    %esi
+  801558:	5d                   	pop    %ebp
+  801559:	c3                   	ret
+
+0080155a <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80155a:	55                   	push   %ebp
+  80155b:	89 e5                	mov    %esp,%ebp
+  80155d:	56                   	push   %esi
+  80155e:	53                   	push   %ebx
+  80155f:	89 c6                	mov    %eax,%esi
+  801561:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801563:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  80156a:	74 27                	je     801593 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80156c:	6a 07                	push   $0x7
+  80156e:	68 00 50 80 00       	push   $0x805000
+  801573:	56                   	push   %esi
+  801574:	ff 35 00 40 80 00    	push   0x804000
+  80157a:	e8 1b 0c 00 00       	call   80219a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80157f:	83 c4 0c             	add    $0xc,%esp
+  801582:	6a 00                	push   $0x0
+  801584:	53                   	push   %ebx
+  801585:	6a 00                	push   $0x0
+  801587:	e8 96 0b 00 00       	call   802122 <ipc_recv>
+}
+  80158c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80158f:	5b                   	pop    %ebx
+  801590:	5e                   	pop    %esi
+  801591:	5d                   	pop    %ebp
+  801592:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801593:	83 ec 0c             	sub    $0xc,%esp
+  801596:	6a 01                	push   $0x1
+  801598:	e8 51 0c 00 00       	call   8021ee <ipc_find_env>
+  80159d:	a3 00 40 80 00       	mov    %eax,0x804000
+  8015a2:	83 c4 10             	add    $0x10,%esp
+  8015a5:	eb c5                	jmp    80156c <fsipc+0x12>
+
+008015a7 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8015a7:	55                   	push   %ebp
+  8015a8:	89 e5                	mov    %esp,%ebp
+  8015aa:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8015ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015b0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015b3:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8015b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015bb:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8015c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8015ca:	e8 8b ff ff ff       	call   80155a <fsipc>
+}
+  8015cf:	c9                   	leave
+  8015d0:	c3                   	ret
+
+008015d1 <devfile_flush>:
+{
+  8015d1:	55                   	push   %ebp
+  8015d2:	89 e5                	mov    %esp,%ebp
+  8015d4:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8015d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015da:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015dd:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8015e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015ec:	e8 69 ff ff ff       	call   80155a <fsipc>
+}
+  8015f1:	c9                   	leave
+  8015f2:	c3                   	ret
+
+008015f3 <devfile_stat>:
+{
+  8015f3:	55                   	push   %ebp
+  8015f4:	89 e5                	mov    %esp,%ebp
+  8015f6:	53                   	push   %ebx
+  8015f7:	83 ec 04             	sub    $0x4,%esp
+  8015fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8015fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801600:	8b 40 0c             	mov    0xc(%eax),%eax
+  801603:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801608:	ba 00 00 00 00       	mov    $0x0,%edx
+  80160d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801612:	e8 43 ff ff ff       	call   80155a <fsipc>
+  801617:	85 c0                	test   %eax,%eax
+  801619:	78 2c                	js     801647 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80161b:	83 ec 08             	sub    $0x8,%esp
+  80161e:	68 00 50 80 00       	push   $0x805000
+  801623:	53                   	push   %ebx
+  801624:	e8 10 f1 ff ff       	call   800739 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801629:	a1 80 50 80 00       	mov    0x805080,%eax
+  80162e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801634:	a1 84 50 80 00       	mov    0x805084,%eax
+  801639:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801647:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80164a:	c9                   	leave
+  80164b:	c3                   	ret
+
+0080164c <devfile_write>:
+{
+  80164c:	55                   	push   %ebp
+  80164d:	89 e5                	mov    %esp,%ebp
+  80164f:	83 ec 0c             	sub    $0xc,%esp
+  801652:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801655:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80165a:	39 d0                	cmp    %edx,%eax
+  80165c:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80165f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801662:	8b 52 0c             	mov    0xc(%edx),%edx
+  801665:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  80166b:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801670:	50                   	push   %eax
+  801671:	ff 75 0c             	push   0xc(%ebp)
+  801674:	68 08 50 80 00       	push   $0x805008
+  801679:	e8 41 f2 ff ff       	call   8008bf <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80167e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801683:	b8 04 00 00 00       	mov    $0x4,%eax
+  801688:	e8 cd fe ff ff       	call   80155a <fsipc>
+}
+  80168d:	c9                   	leave
+  80168e:	c3                   	ret
+
+0080168f <devfile_read>:
+{
+  80168f:	55                   	push   %ebp
+  801690:	89 e5                	mov    %esp,%ebp
+  801692:	56                   	push   %esi
+  801693:	53                   	push   %ebx
+  801694:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801697:	8b 45 08             	mov    0x8(%ebp),%eax
+  80169a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80169d:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  8016a2:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8016a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ad:	b8 03 00 00 00       	mov    $0x3,%eax
+  8016b2:	e8 a3 fe ff ff       	call   80155a <fsipc>
+  8016b7:	89 c3                	mov    %eax,%ebx
+  8016b9:	85 c0                	test   %eax,%eax
+  8016bb:	78 1f                	js     8016dc <devfile_read+0x4d>
+	assert(r <= n);
+  8016bd:	39 c6                	cmp    %eax,%esi
+  8016bf:	72 24                	jb     8016e5 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8016c1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8016c6:	7f 33                	jg     8016fb <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8016c8:	83 ec 04             	sub    $0x4,%esp
+  8016cb:	50                   	push   %eax
+  8016cc:	68 00 50 80 00       	push   $0x805000
+  8016d1:	ff 75 0c             	push   0xc(%ebp)
+  8016d4:	e8 e6 f1 ff ff       	call   8008bf <memmove>
+	return r;
+  8016d9:	83 c4 10             	add    $0x10,%esp
+}
+  8016dc:	89 d8                	mov    %ebx,%eax
+  8016de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016e1:	5b                   	pop    %ebx
+  8016e2:	5e                   	pop    %esi
+  8016e3:	5d                   	pop    %ebp
+  8016e4:	c3                   	ret
+	assert(r <= n);
+  8016e5:	68 5c 2a 80 00       	push   $0x802a5c
+  8016ea:	68 63 2a 80 00       	push   $0x802a63
+  8016ef:	6a 7c                	push   $0x7c
+  8016f1:	68 78 2a 80 00       	push   $0x802a78
+  8016f6:	e8 e1 09 00 00       	call   8020dc <_panic>
+	assert(r <= PGSIZE);
+  8016fb:	68 83 2a 80 00       	push   $0x802a83
+  801700:	68 63 2a 80 00       	push   $0x802a63
+  801705:	6a 7d                	push   $0x7d
+  801707:	68 78 2a 80 00       	push   $0x802a78
+  80170c:	e8 cb 09 00 00       	call   8020dc <_panic>
+
+00801711 <open>:
+{
+  801711:	55                   	push   %ebp
+  801712:	89 e5                	mov    %esp,%ebp
+  801714:	56                   	push   %esi
+  801715:	53                   	push   %ebx
+  801716:	83 ec 1c             	sub    $0x1c,%esp
+  801719:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80171c:	56                   	push   %esi
+  80171d:	e8 dc ef ff ff       	call   8006fe <strlen>
+  801722:	83 c4 10             	add    $0x10,%esp
+  801725:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80172a:	7f 6c                	jg     801798 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80172c:	83 ec 0c             	sub    $0xc,%esp
+  80172f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801732:	50                   	push   %eax
+  801733:	e8 ba f8 ff ff       	call   800ff2 <fd_alloc>
+  801738:	89 c3                	mov    %eax,%ebx
+  80173a:	83 c4 10             	add    $0x10,%esp
+  80173d:	85 c0                	test   %eax,%eax
+  80173f:	78 3c                	js     80177d <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801741:	83 ec 08             	sub    $0x8,%esp
+  801744:	56                   	push   %esi
+  801745:	68 00 50 80 00       	push   $0x805000
+  80174a:	e8 ea ef ff ff       	call   800739 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80174f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801752:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801757:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80175a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80175f:	e8 f6 fd ff ff       	call   80155a <fsipc>
+  801764:	89 c3                	mov    %eax,%ebx
+  801766:	83 c4 10             	add    $0x10,%esp
+  801769:	85 c0                	test   %eax,%eax
+  80176b:	78 19                	js     801786 <open+0x75>
+	return fd2num(fd);
+  80176d:	83 ec 0c             	sub    $0xc,%esp
+  801770:	ff 75 f4             	push   -0xc(%ebp)
+  801773:	e8 53 f8 ff ff       	call   800fcb <fd2num>
+  801778:	89 c3                	mov    %eax,%ebx
+  80177a:	83 c4 10             	add    $0x10,%esp
+}
+  80177d:	89 d8                	mov    %ebx,%eax
+  80177f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801782:	5b                   	pop    %ebx
+  801783:	5e                   	pop    %esi
+  801784:	5d                   	pop    %ebp
+  801785:	c3                   	ret
+		fd_close(fd, 0);
+  801786:	83 ec 08             	sub    $0x8,%esp
+  801789:	6a 00                	push   $0x0
+  80178b:	ff 75 f4             	push   -0xc(%ebp)
+  80178e:	e8 58 f9 ff ff       	call   8010eb <fd_close>
+		return r;
+  801793:	83 c4 10             	add    $0x10,%esp
+  801796:	eb e5                	jmp    80177d <open+0x6c>
+		return -E_BAD_PATH;
+  801798:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80179d:	eb de                	jmp    80177d <open+0x6c>
+
+0080179f <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80179f:	55                   	push   %ebp
+  8017a0:	89 e5                	mov    %esp,%ebp
+  8017a2:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8017a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017aa:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017af:	e8 a6 fd ff ff       	call   80155a <fsipc>
+}
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+
+008017b6 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+  8017b9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8017bc:	68 8f 2a 80 00       	push   $0x802a8f
+  8017c1:	ff 75 0c             	push   0xc(%ebp)
+  8017c4:	e8 70 ef ff ff       	call   800739 <strcpy>
+	return 0;
+}
+  8017c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ce:	c9                   	leave
+  8017cf:	c3                   	ret
+
+008017d0 <devsock_close>:
+{
+  8017d0:	55                   	push   %ebp
+  8017d1:	89 e5                	mov    %esp,%ebp
+  8017d3:	53                   	push   %ebx
+  8017d4:	83 ec 10             	sub    $0x10,%esp
+  8017d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8017da:	53                   	push   %ebx
+  8017db:	e8 1e 0a 00 00       	call   8021fe <pageref>
+  8017e0:	89 c2                	mov    %eax,%edx
+  8017e2:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8017e5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8017ea:	83 fa 01             	cmp    $0x1,%edx
+  8017ed:	74 05                	je     8017f4 <devsock_close+0x24>
+}
+  8017ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017f2:	c9                   	leave
+  8017f3:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8017f4:	83 ec 0c             	sub    $0xc,%esp
+  8017f7:	ff 73 0c             	push   0xc(%ebx)
+  8017fa:	e8 b7 02 00 00       	call   801ab6 <nsipc_close>
+  8017ff:	83 c4 10             	add    $0x10,%esp
+  801802:	eb eb                	jmp    8017ef <devsock_close+0x1f>
+
+00801804 <devsock_write>:
+{
+  801804:	55                   	push   %ebp
+  801805:	89 e5                	mov    %esp,%ebp
+  801807:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80180a:	6a 00                	push   $0x0
+  80180c:	ff 75 10             	push   0x10(%ebp)
+  80180f:	ff 75 0c             	push   0xc(%ebp)
+  801812:	8b 45 08             	mov    0x8(%ebp),%eax
+  801815:	ff 70 0c             	push   0xc(%eax)
+  801818:	e8 79 03 00 00       	call   801b96 <nsipc_send>
+}
+  80181d:	c9                   	leave
+  80181e:	c3                   	ret
+
+0080181f <devsock_read>:
+{
+  80181f:	55                   	push   %ebp
+  801820:	89 e5                	mov    %esp,%ebp
+  801822:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801825:	6a 00                	push   $0x0
+  801827:	ff 75 10             	push   0x10(%ebp)
+  80182a:	ff 75 0c             	push   0xc(%ebp)
+  80182d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801830:	ff 70 0c             	push   0xc(%eax)
+  801833:	e8 ef 02 00 00       	call   801b27 <nsipc_recv>
+}
+  801838:	c9                   	leave
+  801839:	c3                   	ret
+
+0080183a <fd2sockid>:
+{
+  80183a:	55                   	push   %ebp
+  80183b:	89 e5                	mov    %esp,%ebp
+  80183d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801840:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801843:	52                   	push   %edx
+  801844:	50                   	push   %eax
+  801845:	e8 fe f7 ff ff       	call   801048 <fd_lookup>
+  80184a:	83 c4 10             	add    $0x10,%esp
+  80184d:	85 c0                	test   %eax,%eax
+  80184f:	78 10                	js     801861 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801851:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801854:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  80185a:	39 08                	cmp    %ecx,(%eax)
+  80185c:	75 05                	jne    801863 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80185e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801861:	c9                   	leave
+  801862:	c3                   	ret
+		return -E_NOT_SUPP;
+  801863:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801868:	eb f7                	jmp    801861 <fd2sockid+0x27>
+
+0080186a <alloc_sockfd>:
+{
+  80186a:	55                   	push   %ebp
+  80186b:	89 e5                	mov    %esp,%ebp
+  80186d:	56                   	push   %esi
+  80186e:	53                   	push   %ebx
+  80186f:	83 ec 1c             	sub    $0x1c,%esp
+  801872:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801874:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801877:	50                   	push   %eax
+  801878:	e8 75 f7 ff ff       	call   800ff2 <fd_alloc>
+  80187d:	89 c3                	mov    %eax,%ebx
+  80187f:	83 c4 10             	add    $0x10,%esp
+  801882:	85 c0                	test   %eax,%eax
+  801884:	78 43                	js     8018c9 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801886:	83 ec 04             	sub    $0x4,%esp
+  801889:	68 07 04 00 00       	push   $0x407
+  80188e:	ff 75 f4             	push   -0xc(%ebp)
+  801891:	6a 00                	push   $0x0
+  801893:	e8 0e f3 ff ff       	call   800ba6 <sys_page_alloc>
+  801898:	89 c3                	mov    %eax,%ebx
+  80189a:	83 c4 10             	add    $0x10,%esp
+  80189d:	85 c0                	test   %eax,%eax
+  80189f:	78 28                	js     8018c9 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8018a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018a4:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8018aa:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8018ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018af:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8018b6:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8018b9:	83 ec 0c             	sub    $0xc,%esp
+  8018bc:	50                   	push   %eax
+  8018bd:	e8 09 f7 ff ff       	call   800fcb <fd2num>
+  8018c2:	89 c3                	mov    %eax,%ebx
+  8018c4:	83 c4 10             	add    $0x10,%esp
+  8018c7:	eb 0c                	jmp    8018d5 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8018c9:	83 ec 0c             	sub    $0xc,%esp
+  8018cc:	56                   	push   %esi
+  8018cd:	e8 e4 01 00 00       	call   801ab6 <nsipc_close>
+		return r;
+  8018d2:	83 c4 10             	add    $0x10,%esp
+}
+  8018d5:	89 d8                	mov    %ebx,%eax
+  8018d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018da:	5b                   	pop    %ebx
+  8018db:	5e                   	pop    %esi
+  8018dc:	5d                   	pop    %ebp
+  8018dd:	c3                   	ret
+
+008018de <accept>:
+{
+  8018de:	55                   	push   %ebp
+  8018df:	89 e5                	mov    %esp,%ebp
+  8018e1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8018e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e7:	e8 4e ff ff ff       	call   80183a <fd2sockid>
+  8018ec:	85 c0                	test   %eax,%eax
+  8018ee:	78 1b                	js     80190b <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8018f0:	83 ec 04             	sub    $0x4,%esp
+  8018f3:	ff 75 10             	push   0x10(%ebp)
+  8018f6:	ff 75 0c             	push   0xc(%ebp)
+  8018f9:	50                   	push   %eax
+  8018fa:	e8 0e 01 00 00       	call   801a0d <nsipc_accept>
+  8018ff:	83 c4 10             	add    $0x10,%esp
+  801902:	85 c0                	test   %eax,%eax
+  801904:	78 05                	js     80190b <accept+0x2d>
+	return alloc_sockfd(r);
+  801906:	e8 5f ff ff ff       	call   80186a <alloc_sockfd>
+}
+  80190b:	c9                   	leave
+  80190c:	c3                   	ret
+
+0080190d <bind>:
+{
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+  801910:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801913:	8b 45 08             	mov    0x8(%ebp),%eax
+  801916:	e8 1f ff ff ff       	call   80183a <fd2sockid>
+  80191b:	85 c0                	test   %eax,%eax
+  80191d:	78 12                	js     801931 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80191f:	83 ec 04             	sub    $0x4,%esp
+  801922:	ff 75 10             	push   0x10(%ebp)
+  801925:	ff 75 0c             	push   0xc(%ebp)
+  801928:	50                   	push   %eax
+  801929:	e8 31 01 00 00       	call   801a5f <nsipc_bind>
+  80192e:	83 c4 10             	add    $0x10,%esp
+}
+  801931:	c9                   	leave
+  801932:	c3                   	ret
+
+00801933 <shutdown>:
+{
+  801933:	55                   	push   %ebp
+  801934:	89 e5                	mov    %esp,%ebp
+  801936:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801939:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193c:	e8 f9 fe ff ff       	call   80183a <fd2sockid>
+  801941:	85 c0                	test   %eax,%eax
+  801943:	78 0f                	js     801954 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801945:	83 ec 08             	sub    $0x8,%esp
+  801948:	ff 75 0c             	push   0xc(%ebp)
+  80194b:	50                   	push   %eax
+  80194c:	e8 43 01 00 00       	call   801a94 <nsipc_shutdown>
+  801951:	83 c4 10             	add    $0x10,%esp
+}
+  801954:	c9                   	leave
+  801955:	c3                   	ret
+
+00801956 <connect>:
+{
+  801956:	55                   	push   %ebp
+  801957:	89 e5                	mov    %esp,%ebp
+  801959:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80195c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195f:	e8 d6 fe ff ff       	call   80183a <fd2sockid>
+  801964:	85 c0                	test   %eax,%eax
+  801966:	78 12                	js     80197a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801968:	83 ec 04             	sub    $0x4,%esp
+  80196b:	ff 75 10             	push   0x10(%ebp)
+  80196e:	ff 75 0c             	push   0xc(%ebp)
+  801971:	50                   	push   %eax
+  801972:	e8 59 01 00 00       	call   801ad0 <nsipc_connect>
+  801977:	83 c4 10             	add    $0x10,%esp
+}
+  80197a:	c9                   	leave
+  80197b:	c3                   	ret
+
+0080197c <listen>:
+{
+  80197c:	55                   	push   %ebp
+  80197d:	89 e5                	mov    %esp,%ebp
+  80197f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801982:	8b 45 08             	mov    0x8(%ebp),%eax
+  801985:	e8 b0 fe ff ff       	call   80183a <fd2sockid>
+  80198a:	85 c0                	test   %eax,%eax
+  80198c:	78 0f                	js     80199d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80198e:	83 ec 08             	sub    $0x8,%esp
+  801991:	ff 75 0c             	push   0xc(%ebp)
+  801994:	50                   	push   %eax
+  801995:	e8 6b 01 00 00       	call   801b05 <nsipc_listen>
+  80199a:	83 c4 10             	add    $0x10,%esp
+}
+  80199d:	c9                   	leave
+  80199e:	c3                   	ret
+
+0080199f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80199f:	55                   	push   %ebp
+  8019a0:	89 e5                	mov    %esp,%ebp
+  8019a2:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8019a5:	ff 75 10             	push   0x10(%ebp)
+  8019a8:	ff 75 0c             	push   0xc(%ebp)
+  8019ab:	ff 75 08             	push   0x8(%ebp)
+  8019ae:	e8 41 02 00 00       	call   801bf4 <nsipc_socket>
+  8019b3:	83 c4 10             	add    $0x10,%esp
+  8019b6:	85 c0                	test   %eax,%eax
+  8019b8:	78 05                	js     8019bf <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8019ba:	e8 ab fe ff ff       	call   80186a <alloc_sockfd>
+}
+  8019bf:	c9                   	leave
+  8019c0:	c3                   	ret
+
+008019c1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8019c1:	55                   	push   %ebp
+  8019c2:	89 e5                	mov    %esp,%ebp
+  8019c4:	53                   	push   %ebx
+  8019c5:	83 ec 04             	sub    $0x4,%esp
+  8019c8:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8019ca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019d1:	74 26                	je     8019f9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8019d3:	6a 07                	push   $0x7
+  8019d5:	68 00 60 80 00       	push   $0x806000
+  8019da:	53                   	push   %ebx
+  8019db:	ff 35 04 40 80 00    	push   0x804004
+  8019e1:	e8 b4 07 00 00       	call   80219a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8019e6:	83 c4 0c             	add    $0xc,%esp
+  8019e9:	6a 00                	push   $0x0
+  8019eb:	6a 00                	push   $0x0
+  8019ed:	6a 00                	push   $0x0
+  8019ef:	e8 2e 07 00 00       	call   802122 <ipc_recv>
+}
+  8019f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f7:	c9                   	leave
+  8019f8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8019f9:	83 ec 0c             	sub    $0xc,%esp
+  8019fc:	6a 02                	push   $0x2
+  8019fe:	e8 eb 07 00 00       	call   8021ee <ipc_find_env>
+  801a03:	a3 04 40 80 00       	mov    %eax,0x804004
+  801a08:	83 c4 10             	add    $0x10,%esp
+  801a0b:	eb c6                	jmp    8019d3 <nsipc+0x12>
+
+00801a0d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801a0d:	55                   	push   %ebp
+  801a0e:	89 e5                	mov    %esp,%ebp
+  801a10:	56                   	push   %esi
+  801a11:	53                   	push   %ebx
+  801a12:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a18:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801a1d:	8b 06                	mov    (%esi),%eax
+  801a1f:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801a24:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a29:	e8 93 ff ff ff       	call   8019c1 <nsipc>
+  801a2e:	89 c3                	mov    %eax,%ebx
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	79 09                	jns    801a3d <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801a34:	89 d8                	mov    %ebx,%eax
+  801a36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a39:	5b                   	pop    %ebx
+  801a3a:	5e                   	pop    %esi
+  801a3b:	5d                   	pop    %ebp
+  801a3c:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801a3d:	83 ec 04             	sub    $0x4,%esp
+  801a40:	ff 35 10 60 80 00    	push   0x806010
+  801a46:	68 00 60 80 00       	push   $0x806000
+  801a4b:	ff 75 0c             	push   0xc(%ebp)
+  801a4e:	e8 6c ee ff ff       	call   8008bf <memmove>
+		*addrlen = ret->ret_addrlen;
+  801a53:	a1 10 60 80 00       	mov    0x806010,%eax
+  801a58:	89 06                	mov    %eax,(%esi)
+  801a5a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801a5d:	eb d5                	jmp    801a34 <nsipc_accept+0x27>
+
+00801a5f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801a5f:	55                   	push   %ebp
+  801a60:	89 e5                	mov    %esp,%ebp
+  801a62:	53                   	push   %ebx
+  801a63:	83 ec 08             	sub    $0x8,%esp
+  801a66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801a69:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a6c:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801a71:	53                   	push   %ebx
+  801a72:	ff 75 0c             	push   0xc(%ebp)
+  801a75:	68 04 60 80 00       	push   $0x806004
+  801a7a:	e8 40 ee ff ff       	call   8008bf <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801a7f:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801a85:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a8a:	e8 32 ff ff ff       	call   8019c1 <nsipc>
+}
+  801a8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a92:	c9                   	leave
+  801a93:	c3                   	ret
+
+00801a94 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801a94:	55                   	push   %ebp
+  801a95:	89 e5                	mov    %esp,%ebp
+  801a97:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a9d:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801aa2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aa5:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801aaa:	b8 03 00 00 00       	mov    $0x3,%eax
+  801aaf:	e8 0d ff ff ff       	call   8019c1 <nsipc>
+}
+  801ab4:	c9                   	leave
+  801ab5:	c3                   	ret
+
+00801ab6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801ab6:	55                   	push   %ebp
+  801ab7:	89 e5                	mov    %esp,%ebp
+  801ab9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801abc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abf:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801ac4:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ac9:	e8 f3 fe ff ff       	call   8019c1 <nsipc>
+}
+  801ace:	c9                   	leave
+  801acf:	c3                   	ret
+
+00801ad0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801ad0:	55                   	push   %ebp
+  801ad1:	89 e5                	mov    %esp,%ebp
+  801ad3:	53                   	push   %ebx
+  801ad4:	83 ec 08             	sub    $0x8,%esp
+  801ad7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801ada:	8b 45 08             	mov    0x8(%ebp),%eax
+  801add:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801ae2:	53                   	push   %ebx
+  801ae3:	ff 75 0c             	push   0xc(%ebp)
+  801ae6:	68 04 60 80 00       	push   $0x806004
+  801aeb:	e8 cf ed ff ff       	call   8008bf <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801af0:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801af6:	b8 05 00 00 00       	mov    $0x5,%eax
+  801afb:	e8 c1 fe ff ff       	call   8019c1 <nsipc>
+}
+  801b00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b03:	c9                   	leave
+  801b04:	c3                   	ret
+
+00801b05 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801b05:	55                   	push   %ebp
+  801b06:	89 e5                	mov    %esp,%ebp
+  801b08:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801b0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b0e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801b13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b16:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801b1b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b20:	e8 9c fe ff ff       	call   8019c1 <nsipc>
+}
+  801b25:	c9                   	leave
+  801b26:	c3                   	ret
+
+00801b27 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801b27:	55                   	push   %ebp
+  801b28:	89 e5                	mov    %esp,%ebp
+  801b2a:	56                   	push   %esi
+  801b2b:	53                   	push   %ebx
+  801b2c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b32:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801b37:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801b3d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b40:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801b45:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b4a:	e8 72 fe ff ff       	call   8019c1 <nsipc>
+  801b4f:	89 c3                	mov    %eax,%ebx
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	78 22                	js     801b77 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801b55:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801b5a:	39 c6                	cmp    %eax,%esi
+  801b5c:	0f 4e c6             	cmovle %esi,%eax
+  801b5f:	39 c3                	cmp    %eax,%ebx
+  801b61:	7f 1d                	jg     801b80 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801b63:	83 ec 04             	sub    $0x4,%esp
+  801b66:	53                   	push   %ebx
+  801b67:	68 00 60 80 00       	push   $0x806000
+  801b6c:	ff 75 0c             	push   0xc(%ebp)
+  801b6f:	e8 4b ed ff ff       	call   8008bf <memmove>
+  801b74:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801b77:	89 d8                	mov    %ebx,%eax
+  801b79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b7c:	5b                   	pop    %ebx
+  801b7d:	5e                   	pop    %esi
+  801b7e:	5d                   	pop    %ebp
+  801b7f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801b80:	68 9b 2a 80 00       	push   $0x802a9b
+  801b85:	68 63 2a 80 00       	push   $0x802a63
+  801b8a:	6a 62                	push   $0x62
+  801b8c:	68 b0 2a 80 00       	push   $0x802ab0
+  801b91:	e8 46 05 00 00       	call   8020dc <_panic>
+
+00801b96 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801b96:	55                   	push   %ebp
+  801b97:	89 e5                	mov    %esp,%ebp
+  801b99:	53                   	push   %ebx
+  801b9a:	83 ec 04             	sub    $0x4,%esp
+  801b9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ba0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba3:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801ba8:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801bae:	7f 2e                	jg     801bde <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801bb0:	83 ec 04             	sub    $0x4,%esp
+  801bb3:	53                   	push   %ebx
+  801bb4:	ff 75 0c             	push   0xc(%ebp)
+  801bb7:	68 0c 60 80 00       	push   $0x80600c
+  801bbc:	e8 fe ec ff ff       	call   8008bf <memmove>
+	nsipcbuf.send.req_size = size;
+  801bc1:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801bc7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bca:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801bcf:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bd4:	e8 e8 fd ff ff       	call   8019c1 <nsipc>
+}
+  801bd9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bdc:	c9                   	leave
+  801bdd:	c3                   	ret
+	assert(size < 1600);
+  801bde:	68 bc 2a 80 00       	push   $0x802abc
+  801be3:	68 63 2a 80 00       	push   $0x802a63
+  801be8:	6a 6d                	push   $0x6d
+  801bea:	68 b0 2a 80 00       	push   $0x802ab0
+  801bef:	e8 e8 04 00 00       	call   8020dc <_panic>
+
+00801bf4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801bf4:	55                   	push   %ebp
+  801bf5:	89 e5                	mov    %esp,%ebp
+  801bf7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801bfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bfd:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801c02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c05:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801c0a:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c0d:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801c12:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c17:	e8 a5 fd ff ff       	call   8019c1 <nsipc>
+}
+  801c1c:	c9                   	leave
+  801c1d:	c3                   	ret
+
+00801c1e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c1e:	55                   	push   %ebp
+  801c1f:	89 e5                	mov    %esp,%ebp
+  801c21:	56                   	push   %esi
+  801c22:	53                   	push   %ebx
+  801c23:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801c26:	83 ec 0c             	sub    $0xc,%esp
+  801c29:	ff 75 08             	push   0x8(%ebp)
+  801c2c:	e8 aa f3 ff ff       	call   800fdb <fd2data>
+  801c31:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801c33:	83 c4 08             	add    $0x8,%esp
+  801c36:	68 c8 2a 80 00       	push   $0x802ac8
+  801c3b:	53                   	push   %ebx
+  801c3c:	e8 f8 ea ff ff       	call   800739 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801c41:	8b 46 04             	mov    0x4(%esi),%eax
+  801c44:	2b 06                	sub    (%esi),%eax
+  801c46:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801c4c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c53:	00 00 00 
+	stat->st_dev = &devpipe;
+  801c56:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801c5d:	30 80 00 
+	return 0;
+}
+  801c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c68:	5b                   	pop    %ebx
+  801c69:	5e                   	pop    %esi
+  801c6a:	5d                   	pop    %ebp
+  801c6b:	c3                   	ret
+
+00801c6c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801c6c:	55                   	push   %ebp
+  801c6d:	89 e5                	mov    %esp,%ebp
+  801c6f:	53                   	push   %ebx
+  801c70:	83 ec 0c             	sub    $0xc,%esp
+  801c73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801c76:	53                   	push   %ebx
+  801c77:	6a 00                	push   $0x0
+  801c79:	e8 f0 ef ff ff       	call   800c6e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801c7e:	89 1c 24             	mov    %ebx,(%esp)
+  801c81:	e8 55 f3 ff ff       	call   800fdb <fd2data>
+  801c86:	83 c4 08             	add    $0x8,%esp
+  801c89:	50                   	push   %eax
+  801c8a:	6a 00                	push   $0x0
+  801c8c:	e8 dd ef ff ff       	call   800c6e <sys_page_unmap>
+}
+  801c91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c94:	c9                   	leave
+  801c95:	c3                   	ret
+
+00801c96 <_pipeisclosed>:
+{
+  801c96:	55                   	push   %ebp
+  801c97:	89 e5                	mov    %esp,%ebp
+  801c99:	57                   	push   %edi
+  801c9a:	56                   	push   %esi
+  801c9b:	53                   	push   %ebx
+  801c9c:	83 ec 1c             	sub    $0x1c,%esp
+  801c9f:	89 c7                	mov    %eax,%edi
+  801ca1:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801ca3:	a1 08 40 80 00       	mov    0x804008,%eax
+  801ca8:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801cab:	83 ec 0c             	sub    $0xc,%esp
+  801cae:	57                   	push   %edi
+  801caf:	e8 4a 05 00 00       	call   8021fe <pageref>
+  801cb4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801cb7:	89 34 24             	mov    %esi,(%esp)
+  801cba:	e8 3f 05 00 00       	call   8021fe <pageref>
+		nn = thisenv->env_runs;
+  801cbf:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801cc5:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801cc8:	83 c4 10             	add    $0x10,%esp
+  801ccb:	39 cb                	cmp    %ecx,%ebx
+  801ccd:	74 1b                	je     801cea <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801ccf:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801cd2:	75 cf                	jne    801ca3 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801cd4:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801cd7:	6a 01                	push   $0x1
+  801cd9:	50                   	push   %eax
+  801cda:	53                   	push   %ebx
+  801cdb:	68 cf 2a 80 00       	push   $0x802acf
+  801ce0:	e8 66 e4 ff ff       	call   80014b <cprintf>
+  801ce5:	83 c4 10             	add    $0x10,%esp
+  801ce8:	eb b9                	jmp    801ca3 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801cea:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ced:	0f 94 c0             	sete   %al
+  801cf0:	0f b6 c0             	movzbl %al,%eax
+}
+  801cf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf6:	5b                   	pop    %ebx
+  801cf7:	5e                   	pop    %esi
+  801cf8:	5f                   	pop    %edi
+  801cf9:	5d                   	pop    %ebp
+  801cfa:	c3                   	ret
+
+00801cfb <devpipe_write>:
+{
+  801cfb:	55                   	push   %ebp
+  801cfc:	89 e5                	mov    %esp,%ebp
+  801cfe:	57                   	push   %edi
+  801cff:	56                   	push   %esi
+  801d00:	53                   	push   %ebx
+  801d01:	83 ec 28             	sub    $0x28,%esp
+  801d04:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801d07:	56                   	push   %esi
+  801d08:	e8 ce f2 ff ff       	call   800fdb <fd2data>
+  801d0d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d0f:	83 c4 10             	add    $0x10,%esp
+  801d12:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d17:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801d1a:	75 09                	jne    801d25 <devpipe_write+0x2a>
+	return i;
+  801d1c:	89 f8                	mov    %edi,%eax
+  801d1e:	eb 23                	jmp    801d43 <devpipe_write+0x48>
+			sys_yield();
+  801d20:	e8 01 ee ff ff       	call   800b26 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801d25:	8b 43 04             	mov    0x4(%ebx),%eax
+  801d28:	8b 0b                	mov    (%ebx),%ecx
+  801d2a:	8d 51 20             	lea    0x20(%ecx),%edx
+  801d2d:	39 d0                	cmp    %edx,%eax
+  801d2f:	72 1a                	jb     801d4b <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801d31:	89 da                	mov    %ebx,%edx
+  801d33:	89 f0                	mov    %esi,%eax
+  801d35:	e8 5c ff ff ff       	call   801c96 <_pipeisclosed>
+  801d3a:	85 c0                	test   %eax,%eax
+  801d3c:	74 e2                	je     801d20 <devpipe_write+0x25>
+				return 0;
+  801d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d46:	5b                   	pop    %ebx
+  801d47:	5e                   	pop    %esi
+  801d48:	5f                   	pop    %edi
+  801d49:	5d                   	pop    %ebp
+  801d4a:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d4e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801d52:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801d55:	89 c2                	mov    %eax,%edx
+  801d57:	c1 fa 1f             	sar    $0x1f,%edx
+  801d5a:	89 d1                	mov    %edx,%ecx
+  801d5c:	c1 e9 1b             	shr    $0x1b,%ecx
+  801d5f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801d62:	83 e2 1f             	and    $0x1f,%edx
+  801d65:	29 ca                	sub    %ecx,%edx
+  801d67:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801d6b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801d6f:	83 c0 01             	add    $0x1,%eax
+  801d72:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801d75:	83 c7 01             	add    $0x1,%edi
+  801d78:	eb 9d                	jmp    801d17 <devpipe_write+0x1c>
+
+00801d7a <devpipe_read>:
+{
+  801d7a:	55                   	push   %ebp
+  801d7b:	89 e5                	mov    %esp,%ebp
+  801d7d:	57                   	push   %edi
+  801d7e:	56                   	push   %esi
+  801d7f:	53                   	push   %ebx
+  801d80:	83 ec 18             	sub    $0x18,%esp
+  801d83:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801d86:	57                   	push   %edi
+  801d87:	e8 4f f2 ff ff       	call   800fdb <fd2data>
+  801d8c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d8e:	83 c4 10             	add    $0x10,%esp
+  801d91:	be 00 00 00 00       	mov    $0x0,%esi
+  801d96:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801d99:	75 13                	jne    801dae <devpipe_read+0x34>
+	return i;
+  801d9b:	89 f0                	mov    %esi,%eax
+  801d9d:	eb 02                	jmp    801da1 <devpipe_read+0x27>
+				return i;
+  801d9f:	89 f0                	mov    %esi,%eax
+}
+  801da1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da4:	5b                   	pop    %ebx
+  801da5:	5e                   	pop    %esi
+  801da6:	5f                   	pop    %edi
+  801da7:	5d                   	pop    %ebp
+  801da8:	c3                   	ret
+			sys_yield();
+  801da9:	e8 78 ed ff ff       	call   800b26 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801dae:	8b 03                	mov    (%ebx),%eax
+  801db0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801db3:	75 18                	jne    801dcd <devpipe_read+0x53>
+			if (i > 0)
+  801db5:	85 f6                	test   %esi,%esi
+  801db7:	75 e6                	jne    801d9f <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801db9:	89 da                	mov    %ebx,%edx
+  801dbb:	89 f8                	mov    %edi,%eax
+  801dbd:	e8 d4 fe ff ff       	call   801c96 <_pipeisclosed>
+  801dc2:	85 c0                	test   %eax,%eax
+  801dc4:	74 e3                	je     801da9 <devpipe_read+0x2f>
+				return 0;
+  801dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dcb:	eb d4                	jmp    801da1 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801dcd:	99                   	cltd
+  801dce:	c1 ea 1b             	shr    $0x1b,%edx
+  801dd1:	01 d0                	add    %edx,%eax
+  801dd3:	83 e0 1f             	and    $0x1f,%eax
+  801dd6:	29 d0                	sub    %edx,%eax
+  801dd8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ddd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801de0:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801de3:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801de6:	83 c6 01             	add    $0x1,%esi
+  801de9:	eb ab                	jmp    801d96 <devpipe_read+0x1c>
+
+00801deb <pipe>:
+{
+  801deb:	55                   	push   %ebp
+  801dec:	89 e5                	mov    %esp,%ebp
+  801dee:	56                   	push   %esi
+  801def:	53                   	push   %ebx
+  801df0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801df3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df6:	50                   	push   %eax
+  801df7:	e8 f6 f1 ff ff       	call   800ff2 <fd_alloc>
+  801dfc:	89 c3                	mov    %eax,%ebx
+  801dfe:	83 c4 10             	add    $0x10,%esp
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	0f 88 23 01 00 00    	js     801f2c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e09:	83 ec 04             	sub    $0x4,%esp
+  801e0c:	68 07 04 00 00       	push   $0x407
+  801e11:	ff 75 f4             	push   -0xc(%ebp)
+  801e14:	6a 00                	push   $0x0
+  801e16:	e8 8b ed ff ff       	call   800ba6 <sys_page_alloc>
+  801e1b:	89 c3                	mov    %eax,%ebx
+  801e1d:	83 c4 10             	add    $0x10,%esp
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	0f 88 04 01 00 00    	js     801f2c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801e28:	83 ec 0c             	sub    $0xc,%esp
+  801e2b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e2e:	50                   	push   %eax
+  801e2f:	e8 be f1 ff ff       	call   800ff2 <fd_alloc>
+  801e34:	89 c3                	mov    %eax,%ebx
+  801e36:	83 c4 10             	add    $0x10,%esp
+  801e39:	85 c0                	test   %eax,%eax
+  801e3b:	0f 88 db 00 00 00    	js     801f1c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e41:	83 ec 04             	sub    $0x4,%esp
+  801e44:	68 07 04 00 00       	push   $0x407
+  801e49:	ff 75 f0             	push   -0x10(%ebp)
+  801e4c:	6a 00                	push   $0x0
+  801e4e:	e8 53 ed ff ff       	call   800ba6 <sys_page_alloc>
+  801e53:	89 c3                	mov    %eax,%ebx
+  801e55:	83 c4 10             	add    $0x10,%esp
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	0f 88 bc 00 00 00    	js     801f1c <pipe+0x131>
+	va = fd2data(fd0);
+  801e60:	83 ec 0c             	sub    $0xc,%esp
+  801e63:	ff 75 f4             	push   -0xc(%ebp)
+  801e66:	e8 70 f1 ff ff       	call   800fdb <fd2data>
+  801e6b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e6d:	83 c4 0c             	add    $0xc,%esp
+  801e70:	68 07 04 00 00       	push   $0x407
+  801e75:	50                   	push   %eax
+  801e76:	6a 00                	push   $0x0
+  801e78:	e8 29 ed ff ff       	call   800ba6 <sys_page_alloc>
+  801e7d:	89 c3                	mov    %eax,%ebx
+  801e7f:	83 c4 10             	add    $0x10,%esp
+  801e82:	85 c0                	test   %eax,%eax
+  801e84:	0f 88 82 00 00 00    	js     801f0c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e8a:	83 ec 0c             	sub    $0xc,%esp
+  801e8d:	ff 75 f0             	push   -0x10(%ebp)
+  801e90:	e8 46 f1 ff ff       	call   800fdb <fd2data>
+  801e95:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801e9c:	50                   	push   %eax
+  801e9d:	6a 00                	push   $0x0
+  801e9f:	56                   	push   %esi
+  801ea0:	6a 00                	push   $0x0
+  801ea2:	e8 85 ed ff ff       	call   800c2c <sys_page_map>
+  801ea7:	89 c3                	mov    %eax,%ebx
+  801ea9:	83 c4 20             	add    $0x20,%esp
+  801eac:	85 c0                	test   %eax,%eax
+  801eae:	78 4e                	js     801efe <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801eb0:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801eb5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801eb8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801eba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ebd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801ec4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801ec7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801ec9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801ecc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801ed3:	83 ec 0c             	sub    $0xc,%esp
+  801ed6:	ff 75 f4             	push   -0xc(%ebp)
+  801ed9:	e8 ed f0 ff ff       	call   800fcb <fd2num>
+  801ede:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ee1:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801ee3:	83 c4 04             	add    $0x4,%esp
+  801ee6:	ff 75 f0             	push   -0x10(%ebp)
+  801ee9:	e8 dd f0 ff ff       	call   800fcb <fd2num>
+  801eee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ef1:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801ef4:	83 c4 10             	add    $0x10,%esp
+  801ef7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801efc:	eb 2e                	jmp    801f2c <pipe+0x141>
+	sys_page_unmap(0, va);
+  801efe:	83 ec 08             	sub    $0x8,%esp
+  801f01:	56                   	push   %esi
+  801f02:	6a 00                	push   $0x0
+  801f04:	e8 65 ed ff ff       	call   800c6e <sys_page_unmap>
+  801f09:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801f0c:	83 ec 08             	sub    $0x8,%esp
+  801f0f:	ff 75 f0             	push   -0x10(%ebp)
+  801f12:	6a 00                	push   $0x0
+  801f14:	e8 55 ed ff ff       	call   800c6e <sys_page_unmap>
+  801f19:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801f1c:	83 ec 08             	sub    $0x8,%esp
+  801f1f:	ff 75 f4             	push   -0xc(%ebp)
+  801f22:	6a 00                	push   $0x0
+  801f24:	e8 45 ed ff ff       	call   800c6e <sys_page_unmap>
+  801f29:	83 c4 10             	add    $0x10,%esp
+}
+  801f2c:	89 d8                	mov    %ebx,%eax
+  801f2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f31:	5b                   	pop    %ebx
+  801f32:	5e                   	pop    %esi
+  801f33:	5d                   	pop    %ebp
+  801f34:	c3                   	ret
+
+00801f35 <pipeisclosed>:
+{
+  801f35:	55                   	push   %ebp
+  801f36:	89 e5                	mov    %esp,%ebp
+  801f38:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f3e:	50                   	push   %eax
+  801f3f:	ff 75 08             	push   0x8(%ebp)
+  801f42:	e8 01 f1 ff ff       	call   801048 <fd_lookup>
+  801f47:	83 c4 10             	add    $0x10,%esp
+  801f4a:	85 c0                	test   %eax,%eax
+  801f4c:	78 18                	js     801f66 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801f4e:	83 ec 0c             	sub    $0xc,%esp
+  801f51:	ff 75 f4             	push   -0xc(%ebp)
+  801f54:	e8 82 f0 ff ff       	call   800fdb <fd2data>
+  801f59:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801f5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f5e:	e8 33 fd ff ff       	call   801c96 <_pipeisclosed>
+  801f63:	83 c4 10             	add    $0x10,%esp
+}
+  801f66:	c9                   	leave
+  801f67:	c3                   	ret
+
+00801f68 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801f68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6d:	c3                   	ret
+
+00801f6e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f6e:	55                   	push   %ebp
+  801f6f:	89 e5                	mov    %esp,%ebp
+  801f71:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801f74:	68 e7 2a 80 00       	push   $0x802ae7
+  801f79:	ff 75 0c             	push   0xc(%ebp)
+  801f7c:	e8 b8 e7 ff ff       	call   800739 <strcpy>
+	return 0;
+}
+  801f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f86:	c9                   	leave
+  801f87:	c3                   	ret
+
+00801f88 <devcons_write>:
+{
+  801f88:	55                   	push   %ebp
+  801f89:	89 e5                	mov    %esp,%ebp
+  801f8b:	57                   	push   %edi
+  801f8c:	56                   	push   %esi
+  801f8d:	53                   	push   %ebx
+  801f8e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801f94:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801f99:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801f9f:	eb 2e                	jmp    801fcf <devcons_write+0x47>
+		m = n - tot;
+  801fa1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fa4:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801fa6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801fab:	39 c3                	cmp    %eax,%ebx
+  801fad:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801fb0:	83 ec 04             	sub    $0x4,%esp
+  801fb3:	53                   	push   %ebx
+  801fb4:	89 f0                	mov    %esi,%eax
+  801fb6:	03 45 0c             	add    0xc(%ebp),%eax
+  801fb9:	50                   	push   %eax
+  801fba:	57                   	push   %edi
+  801fbb:	e8 ff e8 ff ff       	call   8008bf <memmove>
+		sys_cputs(buf, m);
+  801fc0:	83 c4 08             	add    $0x8,%esp
+  801fc3:	53                   	push   %ebx
+  801fc4:	57                   	push   %edi
+  801fc5:	e8 9f ea ff ff       	call   800a69 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801fca:	01 de                	add    %ebx,%esi
+  801fcc:	83 c4 10             	add    $0x10,%esp
+  801fcf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801fd2:	72 cd                	jb     801fa1 <devcons_write+0x19>
+}
+  801fd4:	89 f0                	mov    %esi,%eax
+  801fd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fd9:	5b                   	pop    %ebx
+  801fda:	5e                   	pop    %esi
+  801fdb:	5f                   	pop    %edi
+  801fdc:	5d                   	pop    %ebp
+  801fdd:	c3                   	ret
+
+00801fde <devcons_read>:
+{
+  801fde:	55                   	push   %ebp
+  801fdf:	89 e5                	mov    %esp,%ebp
+  801fe1:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801fed:	75 07                	jne    801ff6 <devcons_read+0x18>
+  801fef:	eb 1f                	jmp    802010 <devcons_read+0x32>
+		sys_yield();
+  801ff1:	e8 30 eb ff ff       	call   800b26 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801ff6:	e8 8c ea ff ff       	call   800a87 <sys_cgetc>
+  801ffb:	85 c0                	test   %eax,%eax
+  801ffd:	74 f2                	je     801ff1 <devcons_read+0x13>
+	if (c < 0)
+  801fff:	78 0f                	js     802010 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802001:	83 f8 04             	cmp    $0x4,%eax
+  802004:	74 0c                	je     802012 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802006:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802009:	88 02                	mov    %al,(%edx)
+	return 1;
+  80200b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802010:	c9                   	leave
+  802011:	c3                   	ret
+		return 0;
+  802012:	b8 00 00 00 00       	mov    $0x0,%eax
+  802017:	eb f7                	jmp    802010 <devcons_read+0x32>
+
+00802019 <cputchar>:
+{
+  802019:	55                   	push   %ebp
+  80201a:	89 e5                	mov    %esp,%ebp
+  80201c:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80201f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802022:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802025:	6a 01                	push   $0x1
+  802027:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80202a:	50                   	push   %eax
+  80202b:	e8 39 ea ff ff       	call   800a69 <sys_cputs>
+}
+  802030:	83 c4 10             	add    $0x10,%esp
+  802033:	c9                   	leave
+  802034:	c3                   	ret
+
+00802035 <getchar>:
+{
+  802035:	55                   	push   %ebp
+  802036:	89 e5                	mov    %esp,%ebp
+  802038:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80203b:	6a 01                	push   $0x1
+  80203d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802040:	50                   	push   %eax
+  802041:	6a 00                	push   $0x0
+  802043:	e8 66 f2 ff ff       	call   8012ae <read>
+	if (r < 0)
+  802048:	83 c4 10             	add    $0x10,%esp
+  80204b:	85 c0                	test   %eax,%eax
+  80204d:	78 06                	js     802055 <getchar+0x20>
+	if (r < 1)
+  80204f:	74 06                	je     802057 <getchar+0x22>
+	return c;
+  802051:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802055:	c9                   	leave
+  802056:	c3                   	ret
+		return -E_EOF;
+  802057:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80205c:	eb f7                	jmp    802055 <getchar+0x20>
+
+0080205e <iscons>:
+{
+  80205e:	55                   	push   %ebp
+  80205f:	89 e5                	mov    %esp,%ebp
+  802061:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802064:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802067:	50                   	push   %eax
+  802068:	ff 75 08             	push   0x8(%ebp)
+  80206b:	e8 d8 ef ff ff       	call   801048 <fd_lookup>
+  802070:	83 c4 10             	add    $0x10,%esp
+  802073:	85 c0                	test   %eax,%eax
+  802075:	78 11                	js     802088 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802077:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80207a:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802080:	39 10                	cmp    %edx,(%eax)
+  802082:	0f 94 c0             	sete   %al
+  802085:	0f b6 c0             	movzbl %al,%eax
+}
+  802088:	c9                   	leave
+  802089:	c3                   	ret
+
+0080208a <opencons>:
+{
+  80208a:	55                   	push   %ebp
+  80208b:	89 e5                	mov    %esp,%ebp
+  80208d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802090:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802093:	50                   	push   %eax
+  802094:	e8 59 ef ff ff       	call   800ff2 <fd_alloc>
+  802099:	83 c4 10             	add    $0x10,%esp
+  80209c:	85 c0                	test   %eax,%eax
+  80209e:	78 3a                	js     8020da <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8020a0:	83 ec 04             	sub    $0x4,%esp
+  8020a3:	68 07 04 00 00       	push   $0x407
+  8020a8:	ff 75 f4             	push   -0xc(%ebp)
+  8020ab:	6a 00                	push   $0x0
+  8020ad:	e8 f4 ea ff ff       	call   800ba6 <sys_page_alloc>
+  8020b2:	83 c4 10             	add    $0x10,%esp
+  8020b5:	85 c0                	test   %eax,%eax
+  8020b7:	78 21                	js     8020da <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8020b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020bc:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8020c2:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8020c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8020ce:	83 ec 0c             	sub    $0xc,%esp
+  8020d1:	50                   	push   %eax
+  8020d2:	e8 f4 ee ff ff       	call   800fcb <fd2num>
+  8020d7:	83 c4 10             	add    $0x10,%esp
+}
+  8020da:	c9                   	leave
+  8020db:	c3                   	ret
+
+008020dc <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8020dc:	55                   	push   %ebp
+  8020dd:	89 e5                	mov    %esp,%ebp
+  8020df:	56                   	push   %esi
+  8020e0:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8020e1:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8020e4:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8020ea:	e8 18 ea ff ff       	call   800b07 <sys_getenvid>
+  8020ef:	83 ec 0c             	sub    $0xc,%esp
+  8020f2:	ff 75 0c             	push   0xc(%ebp)
+  8020f5:	ff 75 08             	push   0x8(%ebp)
+  8020f8:	56                   	push   %esi
+  8020f9:	50                   	push   %eax
+  8020fa:	68 f4 2a 80 00       	push   $0x802af4
+  8020ff:	e8 47 e0 ff ff       	call   80014b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802104:	83 c4 18             	add    $0x18,%esp
+  802107:	53                   	push   %ebx
+  802108:	ff 75 10             	push   0x10(%ebp)
+  80210b:	e8 ea df ff ff       	call   8000fa <vcprintf>
+	cprintf("\n");
+  802110:	c7 04 24 8c 26 80 00 	movl   $0x80268c,(%esp)
+  802117:	e8 2f e0 ff ff       	call   80014b <cprintf>
+  80211c:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80211f:	cc                   	int3
+	while (1)
+  802120:	eb fd                	jmp    80211f <_panic+0x43>
+
+00802122 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802122:	55                   	push   %ebp
+  802123:	89 e5                	mov    %esp,%ebp
+  802125:	57                   	push   %edi
+  802126:	56                   	push   %esi
+  802127:	53                   	push   %ebx
+  802128:	83 ec 18             	sub    $0x18,%esp
+  80212b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80212e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802131:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802134:	85 db                	test   %ebx,%ebx
+  802136:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80213b:	0f 45 c3             	cmovne %ebx,%eax
+  80213e:	50                   	push   %eax
+  80213f:	e8 e5 ed ff ff       	call   800f29 <sys_ipc_recv>
+
+	if (from_env_store)
+  802144:	83 c4 10             	add    $0x10,%esp
+  802147:	85 ff                	test   %edi,%edi
+  802149:	74 17                	je     802162 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80214b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802150:	85 c0                	test   %eax,%eax
+  802152:	75 0c                	jne    802160 <ipc_recv+0x3e>
+  802154:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80215a:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802160:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802162:	85 f6                	test   %esi,%esi
+  802164:	74 2e                	je     802194 <ipc_recv+0x72>
+		if (!r && pg)
+  802166:	85 c0                	test   %eax,%eax
+  802168:	75 24                	jne    80218e <ipc_recv+0x6c>
+  80216a:	85 db                	test   %ebx,%ebx
+  80216c:	74 20                	je     80218e <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  80216e:	a1 08 40 80 00       	mov    0x804008,%eax
+  802173:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802179:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80217b:	a1 08 40 80 00       	mov    0x804008,%eax
+  802180:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802186:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802189:	5b                   	pop    %ebx
+  80218a:	5e                   	pop    %esi
+  80218b:	5f                   	pop    %edi
+  80218c:	5d                   	pop    %ebp
+  80218d:	c3                   	ret
+			*perm_store = 0;
+  80218e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802194:	85 c0                	test   %eax,%eax
+  802196:	75 ee                	jne    802186 <ipc_recv+0x64>
+  802198:	eb e1                	jmp    80217b <ipc_recv+0x59>
+
+0080219a <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80219a:	55                   	push   %ebp
+  80219b:	89 e5                	mov    %esp,%ebp
+  80219d:	57                   	push   %edi
+  80219e:	56                   	push   %esi
+  80219f:	53                   	push   %ebx
+  8021a0:	83 ec 0c             	sub    $0xc,%esp
+  8021a3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021a6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8021ac:	85 db                	test   %ebx,%ebx
+  8021ae:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021b3:	0f 44 d8             	cmove  %eax,%ebx
+  8021b6:	ff 75 14             	push   0x14(%ebp)
+  8021b9:	53                   	push   %ebx
+  8021ba:	56                   	push   %esi
+  8021bb:	57                   	push   %edi
+  8021bc:	e8 45 ed ff ff       	call   800f06 <sys_ipc_try_send_yield>
+  8021c1:	83 c4 10             	add    $0x10,%esp
+  8021c4:	85 c0                	test   %eax,%eax
+  8021c6:	79 1e                	jns    8021e6 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8021c8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021cb:	75 07                	jne    8021d4 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8021cd:	e8 54 e9 ff ff       	call   800b26 <sys_yield>
+  8021d2:	eb e2                	jmp    8021b6 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8021d4:	50                   	push   %eax
+  8021d5:	68 17 2b 80 00       	push   $0x802b17
+  8021da:	6a 3d                	push   $0x3d
+  8021dc:	68 2c 2b 80 00       	push   $0x802b2c
+  8021e1:	e8 f6 fe ff ff       	call   8020dc <_panic>
+	}
+}
+  8021e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021e9:	5b                   	pop    %ebx
+  8021ea:	5e                   	pop    %esi
+  8021eb:	5f                   	pop    %edi
+  8021ec:	5d                   	pop    %ebp
+  8021ed:	c3                   	ret
+
+008021ee <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8021ee:	55                   	push   %ebp
+  8021ef:	89 e5                	mov    %esp,%ebp
+  8021f1:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8021f4:	ff 75 08             	push   0x8(%ebp)
+  8021f7:	e8 aa e8 ff ff       	call   800aa6 <sys_env_find>
+}
+  8021fc:	c9                   	leave
+  8021fd:	c3                   	ret
+
+008021fe <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8021fe:	55                   	push   %ebp
+  8021ff:	89 e5                	mov    %esp,%ebp
+  802201:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802204:	89 c2                	mov    %eax,%edx
+  802206:	c1 ea 16             	shr    $0x16,%edx
+  802209:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802210:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802215:	f6 c1 01             	test   $0x1,%cl
+  802218:	74 22                	je     80223c <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80221a:	c1 e8 0c             	shr    $0xc,%eax
+  80221d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802224:	a8 01                	test   $0x1,%al
+  802226:	74 14                	je     80223c <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802228:	c1 e8 0c             	shr    $0xc,%eax
+  80222b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80222e:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802235:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802239:	0f b7 d2             	movzwl %dx,%edx
+}
+  80223c:	89 d0                	mov    %edx,%eax
+  80223e:	5d                   	pop    %ebp
+  80223f:	c3                   	ret
+
+00802240 <__udivmoddi4>:
+  802240:	55                   	push   %ebp
+  802241:	57                   	push   %edi
+  802242:	56                   	push   %esi
+  802243:	53                   	push   %ebx
+  802244:	83 ec 14             	sub    $0x14,%esp
+  802247:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80224b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80224f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802253:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802257:	89 f1                	mov    %esi,%ecx
+  802259:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80225d:	09 d9                	or     %ebx,%ecx
+  80225f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802263:	0f 84 92 00 00 00    	je     8022fb <__udivmoddi4+0xbb>
+  802269:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802270:	00 
+  802271:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802276:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80227d:	00 
+  80227e:	89 1c 24             	mov    %ebx,(%esp)
+  802281:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802285:	8d 76 00             	lea    0x0(%esi),%esi
+  802288:	89 e9                	mov    %ebp,%ecx
+  80228a:	89 c3                	mov    %eax,%ebx
+  80228c:	89 d6                	mov    %edx,%esi
+  80228e:	31 ff                	xor    %edi,%edi
+  802290:	d3 ee                	shr    %cl,%esi
+  802292:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802295:	f6 c1 20             	test   $0x20,%cl
+  802298:	0f 45 de             	cmovne %esi,%ebx
+  80229b:	0f 45 f7             	cmovne %edi,%esi
+  80229e:	8b 3c 24             	mov    (%esp),%edi
+  8022a1:	39 fb                	cmp    %edi,%ebx
+  8022a3:	89 f7                	mov    %esi,%edi
+  8022a5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8022a9:	8b 1c 24             	mov    (%esp),%ebx
+  8022ac:	19 f7                	sbb    %esi,%edi
+  8022ae:	72 39                	jb     8022e9 <__udivmoddi4+0xa9>
+  8022b0:	89 e9                	mov    %ebp,%ecx
+  8022b2:	89 f7                	mov    %esi,%edi
+  8022b4:	89 de                	mov    %ebx,%esi
+  8022b6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8022b9:	d3 e6                	shl    %cl,%esi
+  8022bb:	31 db                	xor    %ebx,%ebx
+  8022bd:	f6 c1 20             	test   $0x20,%cl
+  8022c0:	0f 45 fe             	cmovne %esi,%edi
+  8022c3:	0f 45 f3             	cmovne %ebx,%esi
+  8022c6:	29 f0                	sub    %esi,%eax
+  8022c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022cd:	19 fa                	sbb    %edi,%edx
+  8022cf:	31 ff                	xor    %edi,%edi
+  8022d1:	31 db                	xor    %ebx,%ebx
+  8022d3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8022d6:	d3 e6                	shl    %cl,%esi
+  8022d8:	f6 c1 20             	test   $0x20,%cl
+  8022db:	0f 45 fe             	cmovne %esi,%edi
+  8022de:	0f 45 f3             	cmovne %ebx,%esi
+  8022e1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8022e5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8022e9:	83 ed 01             	sub    $0x1,%ebp
+  8022ec:	73 9a                	jae    802288 <__udivmoddi4+0x48>
+  8022ee:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8022f2:	85 ff                	test   %edi,%edi
+  8022f4:	74 05                	je     8022fb <__udivmoddi4+0xbb>
+  8022f6:	89 07                	mov    %eax,(%edi)
+  8022f8:	89 57 04             	mov    %edx,0x4(%edi)
+  8022fb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022ff:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802303:	83 c4 14             	add    $0x14,%esp
+  802306:	5b                   	pop    %ebx
+  802307:	5e                   	pop    %esi
+  802308:	5f                   	pop    %edi
+  802309:	5d                   	pop    %ebp
+  80230a:	c3                   	ret
+  80230b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80230f:	90                   	nop
+
+00802310 <__udivdi3>:
+  802310:	55                   	push   %ebp
+  802311:	57                   	push   %edi
+  802312:	56                   	push   %esi
+  802313:	53                   	push   %ebx
+  802314:	83 ec 14             	sub    $0x14,%esp
+  802317:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80231b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80231f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802323:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802327:	89 fb                	mov    %edi,%ebx
+  802329:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80232d:	09 f3                	or     %esi,%ebx
+  80232f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802333:	0f 84 85 00 00 00    	je     8023be <__udivdi3+0xae>
+  802339:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802340:	00 
+  802341:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802346:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80234d:	00 
+  80234e:	89 34 24             	mov    %esi,(%esp)
+  802351:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802355:	8d 76 00             	lea    0x0(%esi),%esi
+  802358:	89 e9                	mov    %ebp,%ecx
+  80235a:	89 c3                	mov    %eax,%ebx
+  80235c:	89 d6                	mov    %edx,%esi
+  80235e:	31 ff                	xor    %edi,%edi
+  802360:	d3 ee                	shr    %cl,%esi
+  802362:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802365:	f6 c1 20             	test   $0x20,%cl
+  802368:	0f 45 de             	cmovne %esi,%ebx
+  80236b:	0f 45 f7             	cmovne %edi,%esi
+  80236e:	8b 3c 24             	mov    (%esp),%edi
+  802371:	39 fb                	cmp    %edi,%ebx
+  802373:	89 f7                	mov    %esi,%edi
+  802375:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802379:	8b 1c 24             	mov    (%esp),%ebx
+  80237c:	19 f7                	sbb    %esi,%edi
+  80237e:	72 39                	jb     8023b9 <__udivdi3+0xa9>
+  802380:	89 e9                	mov    %ebp,%ecx
+  802382:	89 f7                	mov    %esi,%edi
+  802384:	89 de                	mov    %ebx,%esi
+  802386:	0f a5 df             	shld   %cl,%ebx,%edi
+  802389:	d3 e6                	shl    %cl,%esi
+  80238b:	31 db                	xor    %ebx,%ebx
+  80238d:	f6 c1 20             	test   $0x20,%cl
+  802390:	0f 45 fe             	cmovne %esi,%edi
+  802393:	0f 45 f3             	cmovne %ebx,%esi
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	be 01 00 00 00       	mov    $0x1,%esi
+  80239d:	19 fa                	sbb    %edi,%edx
+  80239f:	31 ff                	xor    %edi,%edi
+  8023a1:	31 db                	xor    %ebx,%ebx
+  8023a3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023a6:	d3 e6                	shl    %cl,%esi
+  8023a8:	f6 c1 20             	test   $0x20,%cl
+  8023ab:	0f 45 fe             	cmovne %esi,%edi
+  8023ae:	0f 45 f3             	cmovne %ebx,%esi
+  8023b1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023b5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023b9:	83 ed 01             	sub    $0x1,%ebp
+  8023bc:	73 9a                	jae    802358 <__udivdi3+0x48>
+  8023be:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023c2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023c6:	83 c4 14             	add    $0x14,%esp
+  8023c9:	5b                   	pop    %ebx
+  8023ca:	5e                   	pop    %esi
+  8023cb:	5f                   	pop    %edi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+  8023ce:	66 90                	xchg   %ax,%ax
+
+008023d0 <__umoddi3>:
+  8023d0:	57                   	push   %edi
+  8023d1:	56                   	push   %esi
+  8023d2:	53                   	push   %ebx
+  8023d3:	83 ec 08             	sub    $0x8,%esp
+  8023d6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8023da:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8023de:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023e2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023e6:	89 f9                	mov    %edi,%ecx
+  8023e8:	89 34 24             	mov    %esi,(%esp)
+  8023eb:	09 f1                	or     %esi,%ecx
+  8023ed:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023f1:	74 53                	je     802446 <__umoddi3+0x76>
+  8023f3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023ff:	90                   	nop
+  802400:	89 c6                	mov    %eax,%esi
+  802402:	89 d7                	mov    %edx,%edi
+  802404:	31 db                	xor    %ebx,%ebx
+  802406:	d3 ef                	shr    %cl,%edi
+  802408:	0f ad d6             	shrd   %cl,%edx,%esi
+  80240b:	f6 c1 20             	test   $0x20,%cl
+  80240e:	0f 45 f7             	cmovne %edi,%esi
+  802411:	0f 45 fb             	cmovne %ebx,%edi
+  802414:	8b 1c 24             	mov    (%esp),%ebx
+  802417:	39 de                	cmp    %ebx,%esi
+  802419:	89 fb                	mov    %edi,%ebx
+  80241b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80241f:	8b 34 24             	mov    (%esp),%esi
+  802422:	19 fb                	sbb    %edi,%ebx
+  802424:	72 14                	jb     80243a <__umoddi3+0x6a>
+  802426:	0f a5 f7             	shld   %cl,%esi,%edi
+  802429:	31 db                	xor    %ebx,%ebx
+  80242b:	d3 e6                	shl    %cl,%esi
+  80242d:	f6 c1 20             	test   $0x20,%cl
+  802430:	0f 45 fe             	cmovne %esi,%edi
+  802433:	0f 45 f3             	cmovne %ebx,%esi
+  802436:	29 f0                	sub    %esi,%eax
+  802438:	19 fa                	sbb    %edi,%edx
+  80243a:	83 e9 01             	sub    $0x1,%ecx
+  80243d:	73 c1                	jae    802400 <__umoddi3+0x30>
+  80243f:	83 c4 08             	add    $0x8,%esp
+  802442:	5b                   	pop    %ebx
+  802443:	5e                   	pop    %esi
+  802444:	5f                   	pop    %edi
+  802445:	c3                   	ret
+  802446:	83 c4 08             	add    $0x8,%esp
+  802449:	31 c0                	xor    %eax,%eax
+  80244b:	31 d2                	xor    %edx,%edx
+  80244d:	5b                   	pop    %ebx
+  80244e:	5e                   	pop    %esi
+  80244f:	5f                   	pop    %edi
+  802450:	c3                   	ret
+  802451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80245f:	90                   	nop
+
+00802460 <__divdi3>:
+  802460:	55                   	push   %ebp
+  802461:	57                   	push   %edi
+  802462:	56                   	push   %esi
+  802463:	53                   	push   %ebx
+  802464:	83 ec 1c             	sub    $0x1c,%esp
+  802467:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80246b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80246f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802473:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802477:	85 ff                	test   %edi,%edi
+  802479:	0f 88 da 00 00 00    	js     802559 <__divdi3+0xf9>
+  80247f:	85 db                	test   %ebx,%ebx
+  802481:	78 16                	js     802499 <__divdi3+0x39>
+  802483:	89 dd                	mov    %ebx,%ebp
+  802485:	89 c8                	mov    %ecx,%eax
+  802487:	89 da                	mov    %ebx,%edx
+  802489:	09 cd                	or     %ecx,%ebp
+  80248b:	0f 85 fd 00 00 00    	jne    80258e <__divdi3+0x12e>
+  802491:	83 c4 1c             	add    $0x1c,%esp
+  802494:	5b                   	pop    %ebx
+  802495:	5e                   	pop    %esi
+  802496:	5f                   	pop    %edi
+  802497:	5d                   	pop    %ebp
+  802498:	c3                   	ret
+  802499:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80249e:	f7 d9                	neg    %ecx
+  8024a0:	89 f0                	mov    %esi,%eax
+  8024a2:	89 fa                	mov    %edi,%edx
+  8024a4:	83 d3 00             	adc    $0x0,%ebx
+  8024a7:	89 0c 24             	mov    %ecx,(%esp)
+  8024aa:	f7 db                	neg    %ebx
+  8024ac:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8024b0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024b7:	00 
+  8024b8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024bd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024c4:	00 
+  8024c5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024c9:	89 cd                	mov    %ecx,%ebp
+  8024cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024cf:	90                   	nop
+  8024d0:	89 e9                	mov    %ebp,%ecx
+  8024d2:	89 c3                	mov    %eax,%ebx
+  8024d4:	89 d6                	mov    %edx,%esi
+  8024d6:	31 ff                	xor    %edi,%edi
+  8024d8:	d3 ee                	shr    %cl,%esi
+  8024da:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024dd:	f6 c1 20             	test   $0x20,%cl
+  8024e0:	0f 45 de             	cmovne %esi,%ebx
+  8024e3:	0f 45 f7             	cmovne %edi,%esi
+  8024e6:	8b 3c 24             	mov    (%esp),%edi
+  8024e9:	39 fb                	cmp    %edi,%ebx
+  8024eb:	89 f7                	mov    %esi,%edi
+  8024ed:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8024f1:	8b 1c 24             	mov    (%esp),%ebx
+  8024f4:	19 f7                	sbb    %esi,%edi
+  8024f6:	72 39                	jb     802531 <__divdi3+0xd1>
+  8024f8:	89 e9                	mov    %ebp,%ecx
+  8024fa:	89 f7                	mov    %esi,%edi
+  8024fc:	89 de                	mov    %ebx,%esi
+  8024fe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802501:	d3 e6                	shl    %cl,%esi
+  802503:	31 db                	xor    %ebx,%ebx
+  802505:	f6 c1 20             	test   $0x20,%cl
+  802508:	0f 45 fe             	cmovne %esi,%edi
+  80250b:	0f 45 f3             	cmovne %ebx,%esi
+  80250e:	29 f0                	sub    %esi,%eax
+  802510:	be 01 00 00 00       	mov    $0x1,%esi
+  802515:	19 fa                	sbb    %edi,%edx
+  802517:	31 ff                	xor    %edi,%edi
+  802519:	31 db                	xor    %ebx,%ebx
+  80251b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80251e:	d3 e6                	shl    %cl,%esi
+  802520:	f6 c1 20             	test   $0x20,%cl
+  802523:	0f 45 fe             	cmovne %esi,%edi
+  802526:	0f 45 f3             	cmovne %ebx,%esi
+  802529:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80252d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802531:	83 ed 01             	sub    $0x1,%ebp
+  802534:	73 9a                	jae    8024d0 <__divdi3+0x70>
+  802536:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80253a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80253e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802542:	85 ed                	test   %ebp,%ebp
+  802544:	0f 84 47 ff ff ff    	je     802491 <__divdi3+0x31>
+  80254a:	f7 d8                	neg    %eax
+  80254c:	83 d2 00             	adc    $0x0,%edx
+  80254f:	83 c4 1c             	add    $0x1c,%esp
+  802552:	5b                   	pop    %ebx
+  802553:	f7 da                	neg    %edx
+  802555:	5e                   	pop    %esi
+  802556:	5f                   	pop    %edi
+  802557:	5d                   	pop    %ebp
+  802558:	c3                   	ret
+  802559:	f7 de                	neg    %esi
+  80255b:	83 d7 00             	adc    $0x0,%edi
+  80255e:	f7 df                	neg    %edi
+  802560:	85 db                	test   %ebx,%ebx
+  802562:	78 23                	js     802587 <__divdi3+0x127>
+  802564:	89 dd                	mov    %ebx,%ebp
+  802566:	89 c8                	mov    %ecx,%eax
+  802568:	89 da                	mov    %ebx,%edx
+  80256a:	09 cd                	or     %ecx,%ebp
+  80256c:	0f 84 1f ff ff ff    	je     802491 <__divdi3+0x31>
+  802572:	89 0c 24             	mov    %ecx,(%esp)
+  802575:	89 f0                	mov    %esi,%eax
+  802577:	89 fa                	mov    %edi,%edx
+  802579:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80257e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802582:	e9 29 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+  802587:	31 ed                	xor    %ebp,%ebp
+  802589:	e9 10 ff ff ff       	jmp    80249e <__divdi3+0x3e>
+  80258e:	89 0c 24             	mov    %ecx,(%esp)
+  802591:	89 f0                	mov    %esi,%eax
+  802593:	89 fa                	mov    %edi,%edx
+  802595:	31 ed                	xor    %ebp,%ebp
+  802597:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80259b:	e9 10 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+
+008025a0 <__moddi3>:
+  8025a0:	55                   	push   %ebp
+  8025a1:	57                   	push   %edi
+  8025a2:	56                   	push   %esi
+  8025a3:	53                   	push   %ebx
+  8025a4:	83 ec 14             	sub    $0x14,%esp
+  8025a7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025ab:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025af:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8025b3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8025b7:	85 d2                	test   %edx,%edx
+  8025b9:	0f 88 9b 00 00 00    	js     80265a <__moddi3+0xba>
+  8025bf:	89 f7                	mov    %esi,%edi
+  8025c1:	31 ed                	xor    %ebp,%ebp
+  8025c3:	09 cf                	or     %ecx,%edi
+  8025c5:	0f 84 83 00 00 00    	je     80264e <__moddi3+0xae>
+  8025cb:	89 cb                	mov    %ecx,%ebx
+  8025cd:	89 f7                	mov    %esi,%edi
+  8025cf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8025d3:	f7 db                	neg    %ebx
+  8025d5:	83 d7 00             	adc    $0x0,%edi
+  8025d8:	f7 df                	neg    %edi
+  8025da:	0f 49 f7             	cmovns %edi,%esi
+  8025dd:	0f 49 cb             	cmovns %ebx,%ecx
+  8025e0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025e4:	89 0c 24             	mov    %ecx,(%esp)
+  8025e7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025ec:	89 cd                	mov    %ecx,%ebp
+  8025ee:	66 90                	xchg   %ax,%ax
+  8025f0:	89 e9                	mov    %ebp,%ecx
+  8025f2:	89 c3                	mov    %eax,%ebx
+  8025f4:	89 d6                	mov    %edx,%esi
+  8025f6:	31 ff                	xor    %edi,%edi
+  8025f8:	d3 ee                	shr    %cl,%esi
+  8025fa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025fd:	f6 c1 20             	test   $0x20,%cl
+  802600:	0f 45 de             	cmovne %esi,%ebx
+  802603:	0f 45 f7             	cmovne %edi,%esi
+  802606:	8b 3c 24             	mov    (%esp),%edi
+  802609:	39 fb                	cmp    %edi,%ebx
+  80260b:	89 f7                	mov    %esi,%edi
+  80260d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802611:	8b 1c 24             	mov    (%esp),%ebx
+  802614:	19 f7                	sbb    %esi,%edi
+  802616:	72 1a                	jb     802632 <__moddi3+0x92>
+  802618:	89 e9                	mov    %ebp,%ecx
+  80261a:	89 f7                	mov    %esi,%edi
+  80261c:	89 de                	mov    %ebx,%esi
+  80261e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802621:	d3 e6                	shl    %cl,%esi
+  802623:	31 db                	xor    %ebx,%ebx
+  802625:	f6 c1 20             	test   $0x20,%cl
+  802628:	0f 45 fe             	cmovne %esi,%edi
+  80262b:	0f 45 f3             	cmovne %ebx,%esi
+  80262e:	29 f0                	sub    %esi,%eax
+  802630:	19 fa                	sbb    %edi,%edx
+  802632:	83 ed 01             	sub    $0x1,%ebp
+  802635:	73 b9                	jae    8025f0 <__moddi3+0x50>
+  802637:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80263b:	85 ed                	test   %ebp,%ebp
+  80263d:	74 07                	je     802646 <__moddi3+0xa6>
+  80263f:	f7 d8                	neg    %eax
+  802641:	83 d2 00             	adc    $0x0,%edx
+  802644:	f7 da                	neg    %edx
+  802646:	83 c4 14             	add    $0x14,%esp
+  802649:	5b                   	pop    %ebx
+  80264a:	5e                   	pop    %esi
+  80264b:	5f                   	pop    %edi
+  80264c:	5d                   	pop    %ebp
+  80264d:	c3                   	ret
+  80264e:	83 c4 14             	add    $0x14,%esp
+  802651:	31 c0                	xor    %eax,%eax
+  802653:	31 d2                	xor    %edx,%edx
+  802655:	5b                   	pop    %ebx
+  802656:	5e                   	pop    %esi
+  802657:	5f                   	pop    %edi
+  802658:	5d                   	pop    %ebp
+  802659:	c3                   	ret
+  80265a:	89 f7                	mov    %esi,%edi
+  80265c:	09 cf                	or     %ecx,%edi
+  80265e:	74 11                	je     802671 <__moddi3+0xd1>
+  802660:	f7 d8                	neg    %eax
+  802662:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802667:	83 d2 00             	adc    $0x0,%edx
+  80266a:	f7 da                	neg    %edx
+  80266c:	e9 5a ff ff ff       	jmp    8025cb <__moddi3+0x2b>
+  802671:	31 c0                	xor    %eax,%eax
+  802673:	31 d2                	xor    %edx,%edx
+  802675:	eb c8                	jmp    80263f <__moddi3+0x9f>
@@ -0,0 +1,5566 @@
+
+obj/user/buggyhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 16 00 00 00       	call   800047 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs((char*)1, 1);
+  800039:	6a 01                	push   $0x1
+  80003b:	6a 01                	push   $0x1
+  80003d:	e8 65 00 00 00       	call   8000a7 <sys_cputs>
+}
+  800042:	83 c4 10             	add    $0x10,%esp
+  800045:	c9                   	leave
+  800046:	c3                   	ret
+
+00800047 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800047:	55                   	push   %ebp
+  800048:	89 e5                	mov    %esp,%ebp
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80004f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800052:	e8 ee 00 00 00       	call   800145 <sys_getenvid>
+  800057:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80005c:	c1 e0 09             	shl    $0x9,%eax
+  80005f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800064:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800069:	85 db                	test   %ebx,%ebx
+  80006b:	7e 07                	jle    800074 <libmain+0x2d>
+		binaryname = argv[0];
+  80006d:	8b 06                	mov    (%esi),%eax
+  80006f:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800074:	83 ec 08             	sub    $0x8,%esp
+  800077:	56                   	push   %esi
+  800078:	53                   	push   %ebx
+  800079:	e8 b5 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80007e:	e8 0a 00 00 00       	call   80008d <exit>
+}
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800089:	5b                   	pop    %ebx
+  80008a:	5e                   	pop    %esi
+  80008b:	5d                   	pop    %ebp
+  80008c:	c3                   	ret
+
+0080008d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80008d:	55                   	push   %ebp
+  80008e:	89 e5                	mov    %esp,%ebp
+  800090:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800093:	e8 45 07 00 00       	call   8007dd <close_all>
+	sys_env_destroy(0);
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	6a 00                	push   $0x0
+  80009d:	e8 62 00 00 00       	call   800104 <sys_env_destroy>
+}
+  8000a2:	83 c4 10             	add    $0x10,%esp
+  8000a5:	c9                   	leave
+  8000a6:	c3                   	ret
+
+008000a7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	57                   	push   %edi
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000b8:	89 c3                	mov    %eax,%ebx
+  8000ba:	89 c7                	mov    %eax,%edi
+  8000bc:	89 c6                	mov    %eax,%esi
+  8000be:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000c0:	5b                   	pop    %ebx
+  8000c1:	5e                   	pop    %esi
+  8000c2:	5f                   	pop    %edi
+  8000c3:	5d                   	pop    %ebp
+  8000c4:	c3                   	ret
+
+008000c5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000c5:	55                   	push   %ebp
+  8000c6:	89 e5                	mov    %esp,%ebp
+  8000c8:	57                   	push   %edi
+  8000c9:	56                   	push   %esi
+  8000ca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d5:	89 d1                	mov    %edx,%ecx
+  8000d7:	89 d3                	mov    %edx,%ebx
+  8000d9:	89 d7                	mov    %edx,%edi
+  8000db:	89 d6                	mov    %edx,%esi
+  8000dd:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5f                   	pop    %edi
+  8000e2:	5d                   	pop    %ebp
+  8000e3:	c3                   	ret
+
+008000e4 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	57                   	push   %edi
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8000f7:	89 cb                	mov    %ecx,%ebx
+  8000f9:	89 cf                	mov    %ecx,%edi
+  8000fb:	89 ce                	mov    %ecx,%esi
+  8000fd:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  8000ff:	5b                   	pop    %ebx
+  800100:	5e                   	pop    %esi
+  800101:	5f                   	pop    %edi
+  800102:	5d                   	pop    %ebp
+  800103:	c3                   	ret
+
+00800104 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800104:	55                   	push   %ebp
+  800105:	89 e5                	mov    %esp,%ebp
+  800107:	57                   	push   %edi
+  800108:	56                   	push   %esi
+  800109:	53                   	push   %ebx
+  80010a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80010d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800112:	8b 55 08             	mov    0x8(%ebp),%edx
+  800115:	b8 03 00 00 00       	mov    $0x3,%eax
+  80011a:	89 cb                	mov    %ecx,%ebx
+  80011c:	89 cf                	mov    %ecx,%edi
+  80011e:	89 ce                	mov    %ecx,%esi
+  800120:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800122:	85 c0                	test   %eax,%eax
+  800124:	7f 08                	jg     80012e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5f                   	pop    %edi
+  80012c:	5d                   	pop    %ebp
+  80012d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80012e:	83 ec 0c             	sub    $0xc,%esp
+  800131:	50                   	push   %eax
+  800132:	6a 03                	push   $0x3
+  800134:	68 8a 26 80 00       	push   $0x80268a
+  800139:	6a 23                	push   $0x23
+  80013b:	68 a7 26 80 00       	push   $0x8026a7
+  800140:	e8 d5 15 00 00       	call   80171a <_panic>
+
+00800145 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800145:	55                   	push   %ebp
+  800146:	89 e5                	mov    %esp,%ebp
+  800148:	57                   	push   %edi
+  800149:	56                   	push   %esi
+  80014a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80014b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800150:	b8 02 00 00 00       	mov    $0x2,%eax
+  800155:	89 d1                	mov    %edx,%ecx
+  800157:	89 d3                	mov    %edx,%ebx
+  800159:	89 d7                	mov    %edx,%edi
+  80015b:	89 d6                	mov    %edx,%esi
+  80015d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80015f:	5b                   	pop    %ebx
+  800160:	5e                   	pop    %esi
+  800161:	5f                   	pop    %edi
+  800162:	5d                   	pop    %ebp
+  800163:	c3                   	ret
+
+00800164 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800164:	55                   	push   %ebp
+  800165:	89 e5                	mov    %esp,%ebp
+  800167:	57                   	push   %edi
+  800168:	56                   	push   %esi
+  800169:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80016a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80016f:	b8 16 00 00 00       	mov    $0x16,%eax
+  800174:	89 d1                	mov    %edx,%ecx
+  800176:	89 d3                	mov    %edx,%ebx
+  800178:	89 d7                	mov    %edx,%edi
+  80017a:	89 d6                	mov    %edx,%esi
+  80017c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80017e:	5b                   	pop    %ebx
+  80017f:	5e                   	pop    %esi
+  800180:	5f                   	pop    %edi
+  800181:	5d                   	pop    %ebp
+  800182:	c3                   	ret
+
+00800183 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800183:	55                   	push   %ebp
+  800184:	89 e5                	mov    %esp,%ebp
+  800186:	57                   	push   %edi
+  800187:	56                   	push   %esi
+  800188:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800189:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800193:	89 d1                	mov    %edx,%ecx
+  800195:	89 d3                	mov    %edx,%ebx
+  800197:	89 d7                	mov    %edx,%edi
+  800199:	89 d6                	mov    %edx,%esi
+  80019b:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  80019d:	5b                   	pop    %ebx
+  80019e:	5e                   	pop    %esi
+  80019f:	5f                   	pop    %edi
+  8001a0:	5d                   	pop    %ebp
+  8001a1:	c3                   	ret
+
+008001a2 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	57                   	push   %edi
+  8001a6:	56                   	push   %esi
+  8001a7:	53                   	push   %ebx
+  8001a8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8001bb:	89 df                	mov    %ebx,%edi
+  8001bd:	89 de                	mov    %ebx,%esi
+  8001bf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001c1:	85 c0                	test   %eax,%eax
+  8001c3:	7f 08                	jg     8001cd <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  8001c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c8:	5b                   	pop    %ebx
+  8001c9:	5e                   	pop    %esi
+  8001ca:	5f                   	pop    %edi
+  8001cb:	5d                   	pop    %ebp
+  8001cc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001cd:	83 ec 0c             	sub    $0xc,%esp
+  8001d0:	50                   	push   %eax
+  8001d1:	6a 15                	push   $0x15
+  8001d3:	68 8a 26 80 00       	push   $0x80268a
+  8001d8:	6a 23                	push   $0x23
+  8001da:	68 a7 26 80 00       	push   $0x8026a7
+  8001df:	e8 36 15 00 00       	call   80171a <_panic>
+
+008001e4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001e4:	55                   	push   %ebp
+  8001e5:	89 e5                	mov    %esp,%ebp
+  8001e7:	57                   	push   %edi
+  8001e8:	56                   	push   %esi
+  8001e9:	53                   	push   %ebx
+  8001ea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8001f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800200:	89 f7                	mov    %esi,%edi
+  800202:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800204:	85 c0                	test   %eax,%eax
+  800206:	7f 08                	jg     800210 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800208:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020b:	5b                   	pop    %ebx
+  80020c:	5e                   	pop    %esi
+  80020d:	5f                   	pop    %edi
+  80020e:	5d                   	pop    %ebp
+  80020f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800210:	83 ec 0c             	sub    $0xc,%esp
+  800213:	50                   	push   %eax
+  800214:	6a 05                	push   $0x5
+  800216:	68 8a 26 80 00       	push   $0x80268a
+  80021b:	6a 23                	push   $0x23
+  80021d:	68 a7 26 80 00       	push   $0x8026a7
+  800222:	e8 f3 14 00 00       	call   80171a <_panic>
+
+00800227 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800227:	55                   	push   %ebp
+  800228:	89 e5                	mov    %esp,%ebp
+  80022a:	57                   	push   %edi
+  80022b:	56                   	push   %esi
+  80022c:	53                   	push   %ebx
+  80022d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800230:	be 00 00 00 00       	mov    $0x0,%esi
+  800235:	8b 55 08             	mov    0x8(%ebp),%edx
+  800238:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80023b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800240:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800243:	89 f7                	mov    %esi,%edi
+  800245:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800247:	85 c0                	test   %eax,%eax
+  800249:	7f 08                	jg     800253 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80024b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024e:	5b                   	pop    %ebx
+  80024f:	5e                   	pop    %esi
+  800250:	5f                   	pop    %edi
+  800251:	5d                   	pop    %ebp
+  800252:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800253:	83 ec 0c             	sub    $0xc,%esp
+  800256:	50                   	push   %eax
+  800257:	6a 06                	push   $0x6
+  800259:	68 8a 26 80 00       	push   $0x80268a
+  80025e:	6a 23                	push   $0x23
+  800260:	68 a7 26 80 00       	push   $0x8026a7
+  800265:	e8 b0 14 00 00       	call   80171a <_panic>
+
+0080026a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80026a:	55                   	push   %ebp
+  80026b:	89 e5                	mov    %esp,%ebp
+  80026d:	57                   	push   %edi
+  80026e:	56                   	push   %esi
+  80026f:	53                   	push   %ebx
+  800270:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800273:	8b 55 08             	mov    0x8(%ebp),%edx
+  800276:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800279:	b8 07 00 00 00       	mov    $0x7,%eax
+  80027e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800281:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800284:	8b 75 18             	mov    0x18(%ebp),%esi
+  800287:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800289:	85 c0                	test   %eax,%eax
+  80028b:	7f 08                	jg     800295 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80028d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800290:	5b                   	pop    %ebx
+  800291:	5e                   	pop    %esi
+  800292:	5f                   	pop    %edi
+  800293:	5d                   	pop    %ebp
+  800294:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800295:	83 ec 0c             	sub    $0xc,%esp
+  800298:	50                   	push   %eax
+  800299:	6a 07                	push   $0x7
+  80029b:	68 8a 26 80 00       	push   $0x80268a
+  8002a0:	6a 23                	push   $0x23
+  8002a2:	68 a7 26 80 00       	push   $0x8026a7
+  8002a7:	e8 6e 14 00 00       	call   80171a <_panic>
+
+008002ac <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8002ac:	55                   	push   %ebp
+  8002ad:	89 e5                	mov    %esp,%ebp
+  8002af:	57                   	push   %edi
+  8002b0:	56                   	push   %esi
+  8002b1:	53                   	push   %ebx
+  8002b2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002c5:	89 df                	mov    %ebx,%edi
+  8002c7:	89 de                	mov    %ebx,%esi
+  8002c9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002cb:	85 c0                	test   %eax,%eax
+  8002cd:	7f 08                	jg     8002d7 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d2:	5b                   	pop    %ebx
+  8002d3:	5e                   	pop    %esi
+  8002d4:	5f                   	pop    %edi
+  8002d5:	5d                   	pop    %ebp
+  8002d6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002d7:	83 ec 0c             	sub    $0xc,%esp
+  8002da:	50                   	push   %eax
+  8002db:	6a 08                	push   $0x8
+  8002dd:	68 8a 26 80 00       	push   $0x80268a
+  8002e2:	6a 23                	push   $0x23
+  8002e4:	68 a7 26 80 00       	push   $0x8026a7
+  8002e9:	e8 2c 14 00 00       	call   80171a <_panic>
+
+008002ee <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002ee:	55                   	push   %ebp
+  8002ef:	89 e5                	mov    %esp,%ebp
+  8002f1:	57                   	push   %edi
+  8002f2:	56                   	push   %esi
+  8002f3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002fa:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800304:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800307:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80030a:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  80030c:	5b                   	pop    %ebx
+  80030d:	5e                   	pop    %esi
+  80030e:	5f                   	pop    %edi
+  80030f:	5d                   	pop    %ebp
+  800310:	c3                   	ret
+
+00800311 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800311:	55                   	push   %ebp
+  800312:	89 e5                	mov    %esp,%ebp
+  800314:	57                   	push   %edi
+  800315:	56                   	push   %esi
+  800316:	53                   	push   %ebx
+  800317:	8b 45 18             	mov    0x18(%ebp),%eax
+  80031a:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  80031d:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800322:	77 27                	ja     80034b <sys_page_map_range+0x3a>
+  800324:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80032a:	77 1f                	ja     80034b <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  80032c:	c1 e0 0c             	shl    $0xc,%eax
+  80032f:	89 c6                	mov    %eax,%esi
+  800331:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800333:	8b 55 08             	mov    0x8(%ebp),%edx
+  800336:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800339:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80033e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800341:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800344:	cd 30                	int    $0x30
+}
+  800346:	5b                   	pop    %ebx
+  800347:	5e                   	pop    %esi
+  800348:	5f                   	pop    %edi
+  800349:	5d                   	pop    %ebp
+  80034a:	c3                   	ret
+		return -E_INVAL;
+  80034b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800350:	eb f4                	jmp    800346 <sys_page_map_range+0x35>
+
+00800352 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800352:	55                   	push   %ebp
+  800353:	89 e5                	mov    %esp,%ebp
+  800355:	57                   	push   %edi
+  800356:	56                   	push   %esi
+  800357:	53                   	push   %ebx
+  800358:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80035b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800361:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800366:	be 00 00 00 00       	mov    $0x0,%esi
+  80036b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80036e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800371:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800373:	85 c0                	test   %eax,%eax
+  800375:	7f 08                	jg     80037f <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800377:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80037a:	5b                   	pop    %ebx
+  80037b:	5e                   	pop    %esi
+  80037c:	5f                   	pop    %edi
+  80037d:	5d                   	pop    %ebp
+  80037e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	50                   	push   %eax
+  800383:	6a 0c                	push   $0xc
+  800385:	68 8a 26 80 00       	push   $0x80268a
+  80038a:	6a 23                	push   $0x23
+  80038c:	68 a7 26 80 00       	push   $0x8026a7
+  800391:	e8 84 13 00 00       	call   80171a <_panic>
+
+00800396 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800396:	55                   	push   %ebp
+  800397:	89 e5                	mov    %esp,%ebp
+  800399:	57                   	push   %edi
+  80039a:	56                   	push   %esi
+  80039b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80039c:	be 00 00 00 00       	mov    $0x0,%esi
+  8003a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003a7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8003ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003af:	89 f7                	mov    %esi,%edi
+  8003b1:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003b3:	5b                   	pop    %ebx
+  8003b4:	5e                   	pop    %esi
+  8003b5:	5f                   	pop    %edi
+  8003b6:	5d                   	pop    %ebp
+  8003b7:	c3                   	ret
+
+008003b8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003b8:	55                   	push   %ebp
+  8003b9:	89 e5                	mov    %esp,%ebp
+  8003bb:	57                   	push   %edi
+  8003bc:	56                   	push   %esi
+  8003bd:	53                   	push   %ebx
+  8003be:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003cc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003d1:	89 df                	mov    %ebx,%edi
+  8003d3:	89 de                	mov    %ebx,%esi
+  8003d5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003d7:	85 c0                	test   %eax,%eax
+  8003d9:	7f 08                	jg     8003e3 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003de:	5b                   	pop    %ebx
+  8003df:	5e                   	pop    %esi
+  8003e0:	5f                   	pop    %edi
+  8003e1:	5d                   	pop    %ebp
+  8003e2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003e3:	83 ec 0c             	sub    $0xc,%esp
+  8003e6:	50                   	push   %eax
+  8003e7:	6a 0f                	push   $0xf
+  8003e9:	68 8a 26 80 00       	push   $0x80268a
+  8003ee:	6a 23                	push   $0x23
+  8003f0:	68 a7 26 80 00       	push   $0x8026a7
+  8003f5:	e8 20 13 00 00       	call   80171a <_panic>
+
+008003fa <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8003fa:	55                   	push   %ebp
+  8003fb:	89 e5                	mov    %esp,%ebp
+  8003fd:	57                   	push   %edi
+  8003fe:	56                   	push   %esi
+  8003ff:	53                   	push   %ebx
+  800400:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800403:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800408:	8b 55 08             	mov    0x8(%ebp),%edx
+  80040b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80040e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800413:	89 df                	mov    %ebx,%edi
+  800415:	89 de                	mov    %ebx,%esi
+  800417:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800419:	85 c0                	test   %eax,%eax
+  80041b:	7f 08                	jg     800425 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  80041d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800420:	5b                   	pop    %ebx
+  800421:	5e                   	pop    %esi
+  800422:	5f                   	pop    %edi
+  800423:	5d                   	pop    %ebp
+  800424:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800425:	83 ec 0c             	sub    $0xc,%esp
+  800428:	50                   	push   %eax
+  800429:	6a 10                	push   $0x10
+  80042b:	68 8a 26 80 00       	push   $0x80268a
+  800430:	6a 23                	push   $0x23
+  800432:	68 a7 26 80 00       	push   $0x8026a7
+  800437:	e8 de 12 00 00       	call   80171a <_panic>
+
+0080043c <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80043c:	55                   	push   %ebp
+  80043d:	89 e5                	mov    %esp,%ebp
+  80043f:	57                   	push   %edi
+  800440:	56                   	push   %esi
+  800441:	53                   	push   %ebx
+  800442:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800445:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80044a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80044d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800450:	b8 11 00 00 00       	mov    $0x11,%eax
+  800455:	89 df                	mov    %ebx,%edi
+  800457:	89 de                	mov    %ebx,%esi
+  800459:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80045b:	85 c0                	test   %eax,%eax
+  80045d:	7f 08                	jg     800467 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  80045f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800462:	5b                   	pop    %ebx
+  800463:	5e                   	pop    %esi
+  800464:	5f                   	pop    %edi
+  800465:	5d                   	pop    %ebp
+  800466:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800467:	83 ec 0c             	sub    $0xc,%esp
+  80046a:	50                   	push   %eax
+  80046b:	6a 11                	push   $0x11
+  80046d:	68 8a 26 80 00       	push   $0x80268a
+  800472:	6a 23                	push   $0x23
+  800474:	68 a7 26 80 00       	push   $0x8026a7
+  800479:	e8 9c 12 00 00       	call   80171a <_panic>
+
+0080047e <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  80047e:	55                   	push   %ebp
+  80047f:	89 e5                	mov    %esp,%ebp
+  800481:	57                   	push   %edi
+  800482:	56                   	push   %esi
+  800483:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800484:	ba 00 00 00 00       	mov    $0x0,%edx
+  800489:	b8 12 00 00 00       	mov    $0x12,%eax
+  80048e:	89 d1                	mov    %edx,%ecx
+  800490:	89 d3                	mov    %edx,%ebx
+  800492:	89 d7                	mov    %edx,%edi
+  800494:	89 d6                	mov    %edx,%esi
+  800496:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800498:	5b                   	pop    %ebx
+  800499:	5e                   	pop    %esi
+  80049a:	5f                   	pop    %edi
+  80049b:	5d                   	pop    %ebp
+  80049c:	c3                   	ret
+
+0080049d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80049d:	55                   	push   %ebp
+  80049e:	89 e5                	mov    %esp,%ebp
+  8004a0:	57                   	push   %edi
+  8004a1:	56                   	push   %esi
+  8004a2:	53                   	push   %ebx
+  8004a3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004b1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004b6:	89 df                	mov    %ebx,%edi
+  8004b8:	89 de                	mov    %ebx,%esi
+  8004ba:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004bc:	85 c0                	test   %eax,%eax
+  8004be:	7f 08                	jg     8004c8 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8004c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c3:	5b                   	pop    %ebx
+  8004c4:	5e                   	pop    %esi
+  8004c5:	5f                   	pop    %edi
+  8004c6:	5d                   	pop    %ebp
+  8004c7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004c8:	83 ec 0c             	sub    $0xc,%esp
+  8004cb:	50                   	push   %eax
+  8004cc:	6a 13                	push   $0x13
+  8004ce:	68 8a 26 80 00       	push   $0x80268a
+  8004d3:	6a 23                	push   $0x23
+  8004d5:	68 a7 26 80 00       	push   $0x8026a7
+  8004da:	e8 3b 12 00 00       	call   80171a <_panic>
+
+008004df <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004df:	55                   	push   %ebp
+  8004e0:	89 e5                	mov    %esp,%ebp
+  8004e2:	57                   	push   %edi
+  8004e3:	56                   	push   %esi
+  8004e4:	53                   	push   %ebx
+  8004e5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004f8:	89 df                	mov    %ebx,%edi
+  8004fa:	89 de                	mov    %ebx,%esi
+  8004fc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004fe:	85 c0                	test   %eax,%eax
+  800500:	7f 08                	jg     80050a <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800502:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800505:	5b                   	pop    %ebx
+  800506:	5e                   	pop    %esi
+  800507:	5f                   	pop    %edi
+  800508:	5d                   	pop    %ebp
+  800509:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80050a:	83 ec 0c             	sub    $0xc,%esp
+  80050d:	50                   	push   %eax
+  80050e:	6a 14                	push   $0x14
+  800510:	68 8a 26 80 00       	push   $0x80268a
+  800515:	6a 23                	push   $0x23
+  800517:	68 a7 26 80 00       	push   $0x8026a7
+  80051c:	e8 f9 11 00 00       	call   80171a <_panic>
+
+00800521 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800521:	55                   	push   %ebp
+  800522:	89 e5                	mov    %esp,%ebp
+  800524:	57                   	push   %edi
+  800525:	56                   	push   %esi
+  800526:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800527:	8b 55 08             	mov    0x8(%ebp),%edx
+  80052a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80052d:	b8 17 00 00 00       	mov    $0x17,%eax
+  800532:	be 00 00 00 00       	mov    $0x0,%esi
+  800537:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80053a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80053d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80053f:	5b                   	pop    %ebx
+  800540:	5e                   	pop    %esi
+  800541:	5f                   	pop    %edi
+  800542:	5d                   	pop    %ebp
+  800543:	c3                   	ret
+
+00800544 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800544:	55                   	push   %ebp
+  800545:	89 e5                	mov    %esp,%ebp
+  800547:	57                   	push   %edi
+  800548:	56                   	push   %esi
+  800549:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80054a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80054d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800550:	b8 18 00 00 00       	mov    $0x18,%eax
+  800555:	be 00 00 00 00       	mov    $0x0,%esi
+  80055a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80055d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800560:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800562:	5b                   	pop    %ebx
+  800563:	5e                   	pop    %esi
+  800564:	5f                   	pop    %edi
+  800565:	5d                   	pop    %ebp
+  800566:	c3                   	ret
+
+00800567 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800567:	55                   	push   %ebp
+  800568:	89 e5                	mov    %esp,%ebp
+  80056a:	57                   	push   %edi
+  80056b:	56                   	push   %esi
+  80056c:	53                   	push   %ebx
+  80056d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800570:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800575:	8b 55 08             	mov    0x8(%ebp),%edx
+  800578:	b8 19 00 00 00       	mov    $0x19,%eax
+  80057d:	89 cb                	mov    %ecx,%ebx
+  80057f:	89 cf                	mov    %ecx,%edi
+  800581:	89 ce                	mov    %ecx,%esi
+  800583:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800585:	85 c0                	test   %eax,%eax
+  800587:	7f 08                	jg     800591 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800589:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80058c:	5b                   	pop    %ebx
+  80058d:	5e                   	pop    %esi
+  80058e:	5f                   	pop    %edi
+  80058f:	5d                   	pop    %ebp
+  800590:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800591:	83 ec 0c             	sub    $0xc,%esp
+  800594:	50                   	push   %eax
+  800595:	6a 19                	push   $0x19
+  800597:	68 8a 26 80 00       	push   $0x80268a
+  80059c:	6a 23                	push   $0x23
+  80059e:	68 a7 26 80 00       	push   $0x8026a7
+  8005a3:	e8 72 11 00 00       	call   80171a <_panic>
+
+008005a8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8005a8:	55                   	push   %ebp
+  8005a9:	89 e5                	mov    %esp,%ebp
+  8005ab:	57                   	push   %edi
+  8005ac:	56                   	push   %esi
+  8005ad:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005b8:	89 d1                	mov    %edx,%ecx
+  8005ba:	89 d3                	mov    %edx,%ebx
+  8005bc:	89 d7                	mov    %edx,%edi
+  8005be:	89 d6                	mov    %edx,%esi
+  8005c0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8005c2:	5b                   	pop    %ebx
+  8005c3:	5e                   	pop    %esi
+  8005c4:	5f                   	pop    %edi
+  8005c5:	5d                   	pop    %ebp
+  8005c6:	c3                   	ret
+
+008005c7 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8005c7:	55                   	push   %ebp
+  8005c8:	89 e5                	mov    %esp,%ebp
+  8005ca:	57                   	push   %edi
+  8005cb:	56                   	push   %esi
+  8005cc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005d8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005dd:	89 df                	mov    %ebx,%edi
+  8005df:	89 de                	mov    %ebx,%esi
+  8005e1:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8005e3:	5b                   	pop    %ebx
+  8005e4:	5e                   	pop    %esi
+  8005e5:	5f                   	pop    %edi
+  8005e6:	5d                   	pop    %ebp
+  8005e7:	c3                   	ret
+
+008005e8 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8005e8:	55                   	push   %ebp
+  8005e9:	89 e5                	mov    %esp,%ebp
+  8005eb:	57                   	push   %edi
+  8005ec:	56                   	push   %esi
+  8005ed:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005f9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005fe:	89 df                	mov    %ebx,%edi
+  800600:	89 de                	mov    %ebx,%esi
+  800602:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  800604:	5b                   	pop    %ebx
+  800605:	5e                   	pop    %esi
+  800606:	5f                   	pop    %edi
+  800607:	5d                   	pop    %ebp
+  800608:	c3                   	ret
+
+00800609 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800609:	55                   	push   %ebp
+  80060a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80060c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80060f:	05 00 00 00 30       	add    $0x30000000,%eax
+  800614:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800617:	5d                   	pop    %ebp
+  800618:	c3                   	ret
+
+00800619 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800619:	55                   	push   %ebp
+  80061a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80061c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80061f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800624:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800629:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80062e:	5d                   	pop    %ebp
+  80062f:	c3                   	ret
+
+00800630 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800630:	55                   	push   %ebp
+  800631:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800633:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800638:	eb 02                	jmp    80063c <fd_alloc+0xc>
+  80063a:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80063c:	89 c2                	mov    %eax,%edx
+  80063e:	c1 ea 16             	shr    $0x16,%edx
+  800641:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800648:	f6 c2 01             	test   $0x1,%dl
+  80064b:	74 2b                	je     800678 <fd_alloc+0x48>
+  80064d:	89 c2                	mov    %eax,%edx
+  80064f:	c1 ea 0c             	shr    $0xc,%edx
+  800652:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800659:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80065f:	f6 c1 01             	test   $0x1,%cl
+  800662:	74 14                	je     800678 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800664:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80066a:	75 ce                	jne    80063a <fd_alloc+0xa>
+  80066c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800671:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800676:	eb 05                	jmp    80067d <fd_alloc+0x4d>
+			return 0;
+  800678:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80067d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800680:	89 02                	mov    %eax,(%edx)
+}
+  800682:	89 c8                	mov    %ecx,%eax
+  800684:	5d                   	pop    %ebp
+  800685:	c3                   	ret
+
+00800686 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800686:	55                   	push   %ebp
+  800687:	89 e5                	mov    %esp,%ebp
+  800689:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80068c:	83 f8 1f             	cmp    $0x1f,%eax
+  80068f:	77 30                	ja     8006c1 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800691:	c1 e0 0c             	shl    $0xc,%eax
+  800694:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800699:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80069f:	f6 c2 01             	test   $0x1,%dl
+  8006a2:	74 24                	je     8006c8 <fd_lookup+0x42>
+  8006a4:	89 c2                	mov    %eax,%edx
+  8006a6:	c1 ea 0c             	shr    $0xc,%edx
+  8006a9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006b0:	f6 c2 01             	test   $0x1,%dl
+  8006b3:	74 1a                	je     8006cf <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006b8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006bf:	5d                   	pop    %ebp
+  8006c0:	c3                   	ret
+		return -E_INVAL;
+  8006c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c6:	eb f7                	jmp    8006bf <fd_lookup+0x39>
+		return -E_INVAL;
+  8006c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006cd:	eb f0                	jmp    8006bf <fd_lookup+0x39>
+  8006cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006d4:	eb e9                	jmp    8006bf <fd_lookup+0x39>
+
+008006d6 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006d6:	55                   	push   %ebp
+  8006d7:	89 e5                	mov    %esp,%ebp
+  8006d9:	53                   	push   %ebx
+  8006da:	83 ec 04             	sub    $0x4,%esp
+  8006dd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e5:	eb 03                	jmp    8006ea <dev_lookup+0x14>
+  8006e7:	83 c0 01             	add    $0x1,%eax
+  8006ea:	8b 1c 85 34 27 80 00 	mov    0x802734(,%eax,4),%ebx
+  8006f1:	85 db                	test   %ebx,%ebx
+  8006f3:	74 0b                	je     800700 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8006f5:	39 13                	cmp    %edx,(%ebx)
+  8006f7:	75 ee                	jne    8006e7 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8006f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fe:	eb 1f                	jmp    80071f <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800700:	a1 08 40 80 00       	mov    0x804008,%eax
+  800705:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800708:	83 ec 04             	sub    $0x4,%esp
+  80070b:	52                   	push   %edx
+  80070c:	50                   	push   %eax
+  80070d:	68 b8 26 80 00       	push   $0x8026b8
+  800712:	e8 de 10 00 00       	call   8017f5 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800717:	83 c4 10             	add    $0x10,%esp
+  80071a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80071f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800722:	89 1a                	mov    %ebx,(%edx)
+}
+  800724:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800727:	c9                   	leave
+  800728:	c3                   	ret
+
+00800729 <fd_close>:
+{
+  800729:	55                   	push   %ebp
+  80072a:	89 e5                	mov    %esp,%ebp
+  80072c:	57                   	push   %edi
+  80072d:	56                   	push   %esi
+  80072e:	53                   	push   %ebx
+  80072f:	83 ec 24             	sub    $0x24,%esp
+  800732:	8b 75 08             	mov    0x8(%ebp),%esi
+  800735:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800738:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80073b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80073c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800742:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800745:	50                   	push   %eax
+  800746:	e8 3b ff ff ff       	call   800686 <fd_lookup>
+  80074b:	89 c3                	mov    %eax,%ebx
+  80074d:	83 c4 10             	add    $0x10,%esp
+  800750:	85 c0                	test   %eax,%eax
+  800752:	78 05                	js     800759 <fd_close+0x30>
+	    || fd != fd2)
+  800754:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800757:	74 16                	je     80076f <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800759:	89 f8                	mov    %edi,%eax
+  80075b:	84 c0                	test   %al,%al
+  80075d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800762:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800765:	89 d8                	mov    %ebx,%eax
+  800767:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80076a:	5b                   	pop    %ebx
+  80076b:	5e                   	pop    %esi
+  80076c:	5f                   	pop    %edi
+  80076d:	5d                   	pop    %ebp
+  80076e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80076f:	83 ec 08             	sub    $0x8,%esp
+  800772:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800775:	50                   	push   %eax
+  800776:	ff 36                	push   (%esi)
+  800778:	e8 59 ff ff ff       	call   8006d6 <dev_lookup>
+  80077d:	89 c3                	mov    %eax,%ebx
+  80077f:	83 c4 10             	add    $0x10,%esp
+  800782:	85 c0                	test   %eax,%eax
+  800784:	78 1a                	js     8007a0 <fd_close+0x77>
+		if (dev->dev_close)
+  800786:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800789:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80078c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800791:	85 c0                	test   %eax,%eax
+  800793:	74 0b                	je     8007a0 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800795:	83 ec 0c             	sub    $0xc,%esp
+  800798:	56                   	push   %esi
+  800799:	ff d0                	call   *%eax
+  80079b:	89 c3                	mov    %eax,%ebx
+  80079d:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007a0:	83 ec 08             	sub    $0x8,%esp
+  8007a3:	56                   	push   %esi
+  8007a4:	6a 00                	push   $0x0
+  8007a6:	e8 01 fb ff ff       	call   8002ac <sys_page_unmap>
+	return r;
+  8007ab:	83 c4 10             	add    $0x10,%esp
+  8007ae:	eb b5                	jmp    800765 <fd_close+0x3c>
+
+008007b0 <close>:
+
+int
+close(int fdnum)
+{
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007b9:	50                   	push   %eax
+  8007ba:	ff 75 08             	push   0x8(%ebp)
+  8007bd:	e8 c4 fe ff ff       	call   800686 <fd_lookup>
+  8007c2:	83 c4 10             	add    $0x10,%esp
+  8007c5:	85 c0                	test   %eax,%eax
+  8007c7:	79 02                	jns    8007cb <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007c9:	c9                   	leave
+  8007ca:	c3                   	ret
+		return fd_close(fd, 1);
+  8007cb:	83 ec 08             	sub    $0x8,%esp
+  8007ce:	6a 01                	push   $0x1
+  8007d0:	ff 75 f4             	push   -0xc(%ebp)
+  8007d3:	e8 51 ff ff ff       	call   800729 <fd_close>
+  8007d8:	83 c4 10             	add    $0x10,%esp
+  8007db:	eb ec                	jmp    8007c9 <close+0x19>
+
+008007dd <close_all>:
+
+void
+close_all(void)
+{
+  8007dd:	55                   	push   %ebp
+  8007de:	89 e5                	mov    %esp,%ebp
+  8007e0:	53                   	push   %ebx
+  8007e1:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8007e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8007e9:	83 ec 0c             	sub    $0xc,%esp
+  8007ec:	53                   	push   %ebx
+  8007ed:	e8 be ff ff ff       	call   8007b0 <close>
+	for (i = 0; i < MAXFD; i++)
+  8007f2:	83 c3 01             	add    $0x1,%ebx
+  8007f5:	83 c4 10             	add    $0x10,%esp
+  8007f8:	83 fb 20             	cmp    $0x20,%ebx
+  8007fb:	75 ec                	jne    8007e9 <close_all+0xc>
+}
+  8007fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800800:	c9                   	leave
+  800801:	c3                   	ret
+
+00800802 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800802:	55                   	push   %ebp
+  800803:	89 e5                	mov    %esp,%ebp
+  800805:	57                   	push   %edi
+  800806:	56                   	push   %esi
+  800807:	53                   	push   %ebx
+  800808:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80080b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80080e:	50                   	push   %eax
+  80080f:	ff 75 08             	push   0x8(%ebp)
+  800812:	e8 6f fe ff ff       	call   800686 <fd_lookup>
+  800817:	89 c3                	mov    %eax,%ebx
+  800819:	83 c4 10             	add    $0x10,%esp
+  80081c:	85 c0                	test   %eax,%eax
+  80081e:	78 7f                	js     80089f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800820:	83 ec 0c             	sub    $0xc,%esp
+  800823:	ff 75 0c             	push   0xc(%ebp)
+  800826:	e8 85 ff ff ff       	call   8007b0 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80082b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80082e:	c1 e6 0c             	shl    $0xc,%esi
+  800831:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800837:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80083a:	89 3c 24             	mov    %edi,(%esp)
+  80083d:	e8 d7 fd ff ff       	call   800619 <fd2data>
+  800842:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800844:	89 34 24             	mov    %esi,(%esp)
+  800847:	e8 cd fd ff ff       	call   800619 <fd2data>
+  80084c:	83 c4 10             	add    $0x10,%esp
+  80084f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800852:	89 d8                	mov    %ebx,%eax
+  800854:	c1 e8 16             	shr    $0x16,%eax
+  800857:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80085e:	a8 01                	test   $0x1,%al
+  800860:	74 11                	je     800873 <dup+0x71>
+  800862:	89 d8                	mov    %ebx,%eax
+  800864:	c1 e8 0c             	shr    $0xc,%eax
+  800867:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80086e:	f6 c2 01             	test   $0x1,%dl
+  800871:	75 36                	jne    8008a9 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800873:	89 f8                	mov    %edi,%eax
+  800875:	c1 e8 0c             	shr    $0xc,%eax
+  800878:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80087f:	83 ec 0c             	sub    $0xc,%esp
+  800882:	25 07 0e 00 00       	and    $0xe07,%eax
+  800887:	50                   	push   %eax
+  800888:	56                   	push   %esi
+  800889:	6a 00                	push   $0x0
+  80088b:	57                   	push   %edi
+  80088c:	6a 00                	push   $0x0
+  80088e:	e8 d7 f9 ff ff       	call   80026a <sys_page_map>
+  800893:	89 c3                	mov    %eax,%ebx
+  800895:	83 c4 20             	add    $0x20,%esp
+  800898:	85 c0                	test   %eax,%eax
+  80089a:	78 33                	js     8008cf <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80089c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80089f:	89 d8                	mov    %ebx,%eax
+  8008a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008a4:	5b                   	pop    %ebx
+  8008a5:	5e                   	pop    %esi
+  8008a6:	5f                   	pop    %edi
+  8008a7:	5d                   	pop    %ebp
+  8008a8:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008a9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008b0:	83 ec 0c             	sub    $0xc,%esp
+  8008b3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008b8:	50                   	push   %eax
+  8008b9:	ff 75 d4             	push   -0x2c(%ebp)
+  8008bc:	6a 00                	push   $0x0
+  8008be:	53                   	push   %ebx
+  8008bf:	6a 00                	push   $0x0
+  8008c1:	e8 a4 f9 ff ff       	call   80026a <sys_page_map>
+  8008c6:	89 c3                	mov    %eax,%ebx
+  8008c8:	83 c4 20             	add    $0x20,%esp
+  8008cb:	85 c0                	test   %eax,%eax
+  8008cd:	79 a4                	jns    800873 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008cf:	83 ec 08             	sub    $0x8,%esp
+  8008d2:	56                   	push   %esi
+  8008d3:	6a 00                	push   $0x0
+  8008d5:	e8 d2 f9 ff ff       	call   8002ac <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008da:	83 c4 08             	add    $0x8,%esp
+  8008dd:	ff 75 d4             	push   -0x2c(%ebp)
+  8008e0:	6a 00                	push   $0x0
+  8008e2:	e8 c5 f9 ff ff       	call   8002ac <sys_page_unmap>
+	return r;
+  8008e7:	83 c4 10             	add    $0x10,%esp
+  8008ea:	eb b3                	jmp    80089f <dup+0x9d>
+
+008008ec <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8008ec:	55                   	push   %ebp
+  8008ed:	89 e5                	mov    %esp,%ebp
+  8008ef:	56                   	push   %esi
+  8008f0:	53                   	push   %ebx
+  8008f1:	83 ec 18             	sub    $0x18,%esp
+  8008f4:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008f7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8008fa:	50                   	push   %eax
+  8008fb:	56                   	push   %esi
+  8008fc:	e8 85 fd ff ff       	call   800686 <fd_lookup>
+  800901:	83 c4 10             	add    $0x10,%esp
+  800904:	85 c0                	test   %eax,%eax
+  800906:	78 3c                	js     800944 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800908:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80090b:	83 ec 08             	sub    $0x8,%esp
+  80090e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800911:	50                   	push   %eax
+  800912:	ff 33                	push   (%ebx)
+  800914:	e8 bd fd ff ff       	call   8006d6 <dev_lookup>
+  800919:	83 c4 10             	add    $0x10,%esp
+  80091c:	85 c0                	test   %eax,%eax
+  80091e:	78 24                	js     800944 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800920:	8b 43 08             	mov    0x8(%ebx),%eax
+  800923:	83 e0 03             	and    $0x3,%eax
+  800926:	83 f8 01             	cmp    $0x1,%eax
+  800929:	74 20                	je     80094b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80092b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80092e:	8b 40 08             	mov    0x8(%eax),%eax
+  800931:	85 c0                	test   %eax,%eax
+  800933:	74 37                	je     80096c <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800935:	83 ec 04             	sub    $0x4,%esp
+  800938:	ff 75 10             	push   0x10(%ebp)
+  80093b:	ff 75 0c             	push   0xc(%ebp)
+  80093e:	53                   	push   %ebx
+  80093f:	ff d0                	call   *%eax
+  800941:	83 c4 10             	add    $0x10,%esp
+}
+  800944:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800947:	5b                   	pop    %ebx
+  800948:	5e                   	pop    %esi
+  800949:	5d                   	pop    %ebp
+  80094a:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80094b:	a1 08 40 80 00       	mov    0x804008,%eax
+  800950:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800953:	83 ec 04             	sub    $0x4,%esp
+  800956:	56                   	push   %esi
+  800957:	50                   	push   %eax
+  800958:	68 f9 26 80 00       	push   $0x8026f9
+  80095d:	e8 93 0e 00 00       	call   8017f5 <cprintf>
+		return -E_INVAL;
+  800962:	83 c4 10             	add    $0x10,%esp
+  800965:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80096a:	eb d8                	jmp    800944 <read+0x58>
+		return -E_NOT_SUPP;
+  80096c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800971:	eb d1                	jmp    800944 <read+0x58>
+
+00800973 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800973:	55                   	push   %ebp
+  800974:	89 e5                	mov    %esp,%ebp
+  800976:	57                   	push   %edi
+  800977:	56                   	push   %esi
+  800978:	53                   	push   %ebx
+  800979:	83 ec 0c             	sub    $0xc,%esp
+  80097c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80097f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800982:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800987:	eb 02                	jmp    80098b <readn+0x18>
+  800989:	01 c3                	add    %eax,%ebx
+  80098b:	39 f3                	cmp    %esi,%ebx
+  80098d:	73 21                	jae    8009b0 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80098f:	83 ec 04             	sub    $0x4,%esp
+  800992:	89 f0                	mov    %esi,%eax
+  800994:	29 d8                	sub    %ebx,%eax
+  800996:	50                   	push   %eax
+  800997:	89 d8                	mov    %ebx,%eax
+  800999:	03 45 0c             	add    0xc(%ebp),%eax
+  80099c:	50                   	push   %eax
+  80099d:	57                   	push   %edi
+  80099e:	e8 49 ff ff ff       	call   8008ec <read>
+		if (m < 0)
+  8009a3:	83 c4 10             	add    $0x10,%esp
+  8009a6:	85 c0                	test   %eax,%eax
+  8009a8:	78 04                	js     8009ae <readn+0x3b>
+			return m;
+		if (m == 0)
+  8009aa:	75 dd                	jne    800989 <readn+0x16>
+  8009ac:	eb 02                	jmp    8009b0 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009ae:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8009b0:	89 d8                	mov    %ebx,%eax
+  8009b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009b5:	5b                   	pop    %ebx
+  8009b6:	5e                   	pop    %esi
+  8009b7:	5f                   	pop    %edi
+  8009b8:	5d                   	pop    %ebp
+  8009b9:	c3                   	ret
+
+008009ba <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009ba:	55                   	push   %ebp
+  8009bb:	89 e5                	mov    %esp,%ebp
+  8009bd:	56                   	push   %esi
+  8009be:	53                   	push   %ebx
+  8009bf:	83 ec 18             	sub    $0x18,%esp
+  8009c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009c5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009c8:	50                   	push   %eax
+  8009c9:	53                   	push   %ebx
+  8009ca:	e8 b7 fc ff ff       	call   800686 <fd_lookup>
+  8009cf:	83 c4 10             	add    $0x10,%esp
+  8009d2:	85 c0                	test   %eax,%eax
+  8009d4:	78 37                	js     800a0d <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009d6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009d9:	83 ec 08             	sub    $0x8,%esp
+  8009dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009df:	50                   	push   %eax
+  8009e0:	ff 36                	push   (%esi)
+  8009e2:	e8 ef fc ff ff       	call   8006d6 <dev_lookup>
+  8009e7:	83 c4 10             	add    $0x10,%esp
+  8009ea:	85 c0                	test   %eax,%eax
+  8009ec:	78 1f                	js     800a0d <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8009ee:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8009f2:	74 20                	je     800a14 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8009f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009f7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8009fa:	85 c0                	test   %eax,%eax
+  8009fc:	74 37                	je     800a35 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8009fe:	83 ec 04             	sub    $0x4,%esp
+  800a01:	ff 75 10             	push   0x10(%ebp)
+  800a04:	ff 75 0c             	push   0xc(%ebp)
+  800a07:	56                   	push   %esi
+  800a08:	ff d0                	call   *%eax
+  800a0a:	83 c4 10             	add    $0x10,%esp
+}
+  800a0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a10:	5b                   	pop    %ebx
+  800a11:	5e                   	pop    %esi
+  800a12:	5d                   	pop    %ebp
+  800a13:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a14:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a19:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800a1c:	83 ec 04             	sub    $0x4,%esp
+  800a1f:	53                   	push   %ebx
+  800a20:	50                   	push   %eax
+  800a21:	68 15 27 80 00       	push   $0x802715
+  800a26:	e8 ca 0d 00 00       	call   8017f5 <cprintf>
+		return -E_INVAL;
+  800a2b:	83 c4 10             	add    $0x10,%esp
+  800a2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a33:	eb d8                	jmp    800a0d <write+0x53>
+		return -E_NOT_SUPP;
+  800a35:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a3a:	eb d1                	jmp    800a0d <write+0x53>
+
+00800a3c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a3c:	55                   	push   %ebp
+  800a3d:	89 e5                	mov    %esp,%ebp
+  800a3f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a45:	50                   	push   %eax
+  800a46:	ff 75 08             	push   0x8(%ebp)
+  800a49:	e8 38 fc ff ff       	call   800686 <fd_lookup>
+  800a4e:	83 c4 10             	add    $0x10,%esp
+  800a51:	85 c0                	test   %eax,%eax
+  800a53:	78 0e                	js     800a63 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800a55:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a5b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800a5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a63:	c9                   	leave
+  800a64:	c3                   	ret
+
+00800a65 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	56                   	push   %esi
+  800a69:	53                   	push   %ebx
+  800a6a:	83 ec 18             	sub    $0x18,%esp
+  800a6d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a70:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a73:	50                   	push   %eax
+  800a74:	53                   	push   %ebx
+  800a75:	e8 0c fc ff ff       	call   800686 <fd_lookup>
+  800a7a:	83 c4 10             	add    $0x10,%esp
+  800a7d:	85 c0                	test   %eax,%eax
+  800a7f:	78 34                	js     800ab5 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a81:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a84:	83 ec 08             	sub    $0x8,%esp
+  800a87:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a8a:	50                   	push   %eax
+  800a8b:	ff 36                	push   (%esi)
+  800a8d:	e8 44 fc ff ff       	call   8006d6 <dev_lookup>
+  800a92:	83 c4 10             	add    $0x10,%esp
+  800a95:	85 c0                	test   %eax,%eax
+  800a97:	78 1c                	js     800ab5 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a99:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a9d:	74 1d                	je     800abc <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800a9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800aa2:	8b 40 18             	mov    0x18(%eax),%eax
+  800aa5:	85 c0                	test   %eax,%eax
+  800aa7:	74 34                	je     800add <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800aa9:	83 ec 08             	sub    $0x8,%esp
+  800aac:	ff 75 0c             	push   0xc(%ebp)
+  800aaf:	56                   	push   %esi
+  800ab0:	ff d0                	call   *%eax
+  800ab2:	83 c4 10             	add    $0x10,%esp
+}
+  800ab5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ab8:	5b                   	pop    %ebx
+  800ab9:	5e                   	pop    %esi
+  800aba:	5d                   	pop    %ebp
+  800abb:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800abc:	a1 08 40 80 00       	mov    0x804008,%eax
+  800ac1:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ac4:	83 ec 04             	sub    $0x4,%esp
+  800ac7:	53                   	push   %ebx
+  800ac8:	50                   	push   %eax
+  800ac9:	68 d8 26 80 00       	push   $0x8026d8
+  800ace:	e8 22 0d 00 00       	call   8017f5 <cprintf>
+		return -E_INVAL;
+  800ad3:	83 c4 10             	add    $0x10,%esp
+  800ad6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800adb:	eb d8                	jmp    800ab5 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800add:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ae2:	eb d1                	jmp    800ab5 <ftruncate+0x50>
+
+00800ae4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800ae4:	55                   	push   %ebp
+  800ae5:	89 e5                	mov    %esp,%ebp
+  800ae7:	56                   	push   %esi
+  800ae8:	53                   	push   %ebx
+  800ae9:	83 ec 18             	sub    $0x18,%esp
+  800aec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800aef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800af2:	50                   	push   %eax
+  800af3:	ff 75 08             	push   0x8(%ebp)
+  800af6:	e8 8b fb ff ff       	call   800686 <fd_lookup>
+  800afb:	83 c4 10             	add    $0x10,%esp
+  800afe:	85 c0                	test   %eax,%eax
+  800b00:	78 49                	js     800b4b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b02:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b05:	83 ec 08             	sub    $0x8,%esp
+  800b08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b0b:	50                   	push   %eax
+  800b0c:	ff 36                	push   (%esi)
+  800b0e:	e8 c3 fb ff ff       	call   8006d6 <dev_lookup>
+  800b13:	83 c4 10             	add    $0x10,%esp
+  800b16:	85 c0                	test   %eax,%eax
+  800b18:	78 31                	js     800b4b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b1d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b21:	74 2f                	je     800b52 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b23:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b26:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b2d:	00 00 00 
+	stat->st_isdir = 0;
+  800b30:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b37:	00 00 00 
+	stat->st_dev = dev;
+  800b3a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b40:	83 ec 08             	sub    $0x8,%esp
+  800b43:	53                   	push   %ebx
+  800b44:	56                   	push   %esi
+  800b45:	ff 50 14             	call   *0x14(%eax)
+  800b48:	83 c4 10             	add    $0x10,%esp
+}
+  800b4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b4e:	5b                   	pop    %ebx
+  800b4f:	5e                   	pop    %esi
+  800b50:	5d                   	pop    %ebp
+  800b51:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b52:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b57:	eb f2                	jmp    800b4b <fstat+0x67>
+
+00800b59 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	56                   	push   %esi
+  800b5d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800b5e:	83 ec 08             	sub    $0x8,%esp
+  800b61:	6a 00                	push   $0x0
+  800b63:	ff 75 08             	push   0x8(%ebp)
+  800b66:	e8 e4 01 00 00       	call   800d4f <open>
+  800b6b:	89 c3                	mov    %eax,%ebx
+  800b6d:	83 c4 10             	add    $0x10,%esp
+  800b70:	85 c0                	test   %eax,%eax
+  800b72:	78 1b                	js     800b8f <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800b74:	83 ec 08             	sub    $0x8,%esp
+  800b77:	ff 75 0c             	push   0xc(%ebp)
+  800b7a:	50                   	push   %eax
+  800b7b:	e8 64 ff ff ff       	call   800ae4 <fstat>
+  800b80:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b82:	89 1c 24             	mov    %ebx,(%esp)
+  800b85:	e8 26 fc ff ff       	call   8007b0 <close>
+	return r;
+  800b8a:	83 c4 10             	add    $0x10,%esp
+  800b8d:	89 f3                	mov    %esi,%ebx
+}
+  800b8f:	89 d8                	mov    %ebx,%eax
+  800b91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b94:	5b                   	pop    %ebx
+  800b95:	5e                   	pop    %esi
+  800b96:	5d                   	pop    %ebp
+  800b97:	c3                   	ret
+
+00800b98 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800b98:	55                   	push   %ebp
+  800b99:	89 e5                	mov    %esp,%ebp
+  800b9b:	56                   	push   %esi
+  800b9c:	53                   	push   %ebx
+  800b9d:	89 c6                	mov    %eax,%esi
+  800b9f:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800ba1:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800ba8:	74 27                	je     800bd1 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800baa:	6a 07                	push   $0x7
+  800bac:	68 00 50 80 00       	push   $0x805000
+  800bb1:	56                   	push   %esi
+  800bb2:	ff 35 00 40 80 00    	push   0x804000
+  800bb8:	e8 ce 15 00 00       	call   80218b <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800bbd:	83 c4 0c             	add    $0xc,%esp
+  800bc0:	6a 00                	push   $0x0
+  800bc2:	53                   	push   %ebx
+  800bc3:	6a 00                	push   $0x0
+  800bc5:	e8 49 15 00 00       	call   802113 <ipc_recv>
+}
+  800bca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bcd:	5b                   	pop    %ebx
+  800bce:	5e                   	pop    %esi
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bd1:	83 ec 0c             	sub    $0xc,%esp
+  800bd4:	6a 01                	push   $0x1
+  800bd6:	e8 04 16 00 00       	call   8021df <ipc_find_env>
+  800bdb:	a3 00 40 80 00       	mov    %eax,0x804000
+  800be0:	83 c4 10             	add    $0x10,%esp
+  800be3:	eb c5                	jmp    800baa <fsipc+0x12>
+
+00800be5 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800be5:	55                   	push   %ebp
+  800be6:	89 e5                	mov    %esp,%ebp
+  800be8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bee:	8b 40 0c             	mov    0xc(%eax),%eax
+  800bf1:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800bf6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bf9:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800bfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c03:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c08:	e8 8b ff ff ff       	call   800b98 <fsipc>
+}
+  800c0d:	c9                   	leave
+  800c0e:	c3                   	ret
+
+00800c0f <devfile_flush>:
+{
+  800c0f:	55                   	push   %ebp
+  800c10:	89 e5                	mov    %esp,%ebp
+  800c12:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800c15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c18:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c1b:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800c20:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c25:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c2a:	e8 69 ff ff ff       	call   800b98 <fsipc>
+}
+  800c2f:	c9                   	leave
+  800c30:	c3                   	ret
+
+00800c31 <devfile_stat>:
+{
+  800c31:	55                   	push   %ebp
+  800c32:	89 e5                	mov    %esp,%ebp
+  800c34:	53                   	push   %ebx
+  800c35:	83 ec 04             	sub    $0x4,%esp
+  800c38:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800c3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c41:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800c46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c50:	e8 43 ff ff ff       	call   800b98 <fsipc>
+  800c55:	85 c0                	test   %eax,%eax
+  800c57:	78 2c                	js     800c85 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800c59:	83 ec 08             	sub    $0x8,%esp
+  800c5c:	68 00 50 80 00       	push   $0x805000
+  800c61:	53                   	push   %ebx
+  800c62:	e8 7c 11 00 00       	call   801de3 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800c67:	a1 80 50 80 00       	mov    0x805080,%eax
+  800c6c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800c72:	a1 84 50 80 00       	mov    0x805084,%eax
+  800c77:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800c7d:	83 c4 10             	add    $0x10,%esp
+  800c80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c88:	c9                   	leave
+  800c89:	c3                   	ret
+
+00800c8a <devfile_write>:
+{
+  800c8a:	55                   	push   %ebp
+  800c8b:	89 e5                	mov    %esp,%ebp
+  800c8d:	83 ec 0c             	sub    $0xc,%esp
+  800c90:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800c93:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800c98:	39 d0                	cmp    %edx,%eax
+  800c9a:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800c9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca0:	8b 52 0c             	mov    0xc(%edx),%edx
+  800ca3:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800ca9:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800cae:	50                   	push   %eax
+  800caf:	ff 75 0c             	push   0xc(%ebp)
+  800cb2:	68 08 50 80 00       	push   $0x805008
+  800cb7:	e8 ad 12 00 00       	call   801f69 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800cbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cc6:	e8 cd fe ff ff       	call   800b98 <fsipc>
+}
+  800ccb:	c9                   	leave
+  800ccc:	c3                   	ret
+
+00800ccd <devfile_read>:
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	56                   	push   %esi
+  800cd1:	53                   	push   %ebx
+  800cd2:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800cd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd8:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cdb:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800ce0:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800ce6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ceb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cf0:	e8 a3 fe ff ff       	call   800b98 <fsipc>
+  800cf5:	89 c3                	mov    %eax,%ebx
+  800cf7:	85 c0                	test   %eax,%eax
+  800cf9:	78 1f                	js     800d1a <devfile_read+0x4d>
+	assert(r <= n);
+  800cfb:	39 c6                	cmp    %eax,%esi
+  800cfd:	72 24                	jb     800d23 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  800cff:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800d04:	7f 33                	jg     800d39 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800d06:	83 ec 04             	sub    $0x4,%esp
+  800d09:	50                   	push   %eax
+  800d0a:	68 00 50 80 00       	push   $0x805000
+  800d0f:	ff 75 0c             	push   0xc(%ebp)
+  800d12:	e8 52 12 00 00       	call   801f69 <memmove>
+	return r;
+  800d17:	83 c4 10             	add    $0x10,%esp
+}
+  800d1a:	89 d8                	mov    %ebx,%eax
+  800d1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d1f:	5b                   	pop    %ebx
+  800d20:	5e                   	pop    %esi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+	assert(r <= n);
+  800d23:	68 48 27 80 00       	push   $0x802748
+  800d28:	68 4f 27 80 00       	push   $0x80274f
+  800d2d:	6a 7c                	push   $0x7c
+  800d2f:	68 64 27 80 00       	push   $0x802764
+  800d34:	e8 e1 09 00 00       	call   80171a <_panic>
+	assert(r <= PGSIZE);
+  800d39:	68 6f 27 80 00       	push   $0x80276f
+  800d3e:	68 4f 27 80 00       	push   $0x80274f
+  800d43:	6a 7d                	push   $0x7d
+  800d45:	68 64 27 80 00       	push   $0x802764
+  800d4a:	e8 cb 09 00 00       	call   80171a <_panic>
+
+00800d4f <open>:
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	56                   	push   %esi
+  800d53:	53                   	push   %ebx
+  800d54:	83 ec 1c             	sub    $0x1c,%esp
+  800d57:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800d5a:	56                   	push   %esi
+  800d5b:	e8 48 10 00 00       	call   801da8 <strlen>
+  800d60:	83 c4 10             	add    $0x10,%esp
+  800d63:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800d68:	7f 6c                	jg     800dd6 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800d6a:	83 ec 0c             	sub    $0xc,%esp
+  800d6d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d70:	50                   	push   %eax
+  800d71:	e8 ba f8 ff ff       	call   800630 <fd_alloc>
+  800d76:	89 c3                	mov    %eax,%ebx
+  800d78:	83 c4 10             	add    $0x10,%esp
+  800d7b:	85 c0                	test   %eax,%eax
+  800d7d:	78 3c                	js     800dbb <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800d7f:	83 ec 08             	sub    $0x8,%esp
+  800d82:	56                   	push   %esi
+  800d83:	68 00 50 80 00       	push   $0x805000
+  800d88:	e8 56 10 00 00       	call   801de3 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800d8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d90:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800d95:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800d98:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d9d:	e8 f6 fd ff ff       	call   800b98 <fsipc>
+  800da2:	89 c3                	mov    %eax,%ebx
+  800da4:	83 c4 10             	add    $0x10,%esp
+  800da7:	85 c0                	test   %eax,%eax
+  800da9:	78 19                	js     800dc4 <open+0x75>
+	return fd2num(fd);
+  800dab:	83 ec 0c             	sub    $0xc,%esp
+  800dae:	ff 75 f4             	push   -0xc(%ebp)
+  800db1:	e8 53 f8 ff ff       	call   800609 <fd2num>
+  800db6:	89 c3                	mov    %eax,%ebx
+  800db8:	83 c4 10             	add    $0x10,%esp
+}
+  800dbb:	89 d8                	mov    %ebx,%eax
+  800dbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dc0:	5b                   	pop    %ebx
+  800dc1:	5e                   	pop    %esi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+		fd_close(fd, 0);
+  800dc4:	83 ec 08             	sub    $0x8,%esp
+  800dc7:	6a 00                	push   $0x0
+  800dc9:	ff 75 f4             	push   -0xc(%ebp)
+  800dcc:	e8 58 f9 ff ff       	call   800729 <fd_close>
+		return r;
+  800dd1:	83 c4 10             	add    $0x10,%esp
+  800dd4:	eb e5                	jmp    800dbb <open+0x6c>
+		return -E_BAD_PATH;
+  800dd6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800ddb:	eb de                	jmp    800dbb <open+0x6c>
+
+00800ddd <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800ddd:	55                   	push   %ebp
+  800dde:	89 e5                	mov    %esp,%ebp
+  800de0:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800de3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de8:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ded:	e8 a6 fd ff ff       	call   800b98 <fsipc>
+}
+  800df2:	c9                   	leave
+  800df3:	c3                   	ret
+
+00800df4 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800dfa:	68 7b 27 80 00       	push   $0x80277b
+  800dff:	ff 75 0c             	push   0xc(%ebp)
+  800e02:	e8 dc 0f 00 00       	call   801de3 <strcpy>
+	return 0;
+}
+  800e07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0c:	c9                   	leave
+  800e0d:	c3                   	ret
+
+00800e0e <devsock_close>:
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	53                   	push   %ebx
+  800e12:	83 ec 10             	sub    $0x10,%esp
+  800e15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800e18:	53                   	push   %ebx
+  800e19:	e8 d1 13 00 00       	call   8021ef <pageref>
+  800e1e:	89 c2                	mov    %eax,%edx
+  800e20:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e23:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800e28:	83 fa 01             	cmp    $0x1,%edx
+  800e2b:	74 05                	je     800e32 <devsock_close+0x24>
+}
+  800e2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e30:	c9                   	leave
+  800e31:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800e32:	83 ec 0c             	sub    $0xc,%esp
+  800e35:	ff 73 0c             	push   0xc(%ebx)
+  800e38:	e8 b7 02 00 00       	call   8010f4 <nsipc_close>
+  800e3d:	83 c4 10             	add    $0x10,%esp
+  800e40:	eb eb                	jmp    800e2d <devsock_close+0x1f>
+
+00800e42 <devsock_write>:
+{
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800e48:	6a 00                	push   $0x0
+  800e4a:	ff 75 10             	push   0x10(%ebp)
+  800e4d:	ff 75 0c             	push   0xc(%ebp)
+  800e50:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e53:	ff 70 0c             	push   0xc(%eax)
+  800e56:	e8 79 03 00 00       	call   8011d4 <nsipc_send>
+}
+  800e5b:	c9                   	leave
+  800e5c:	c3                   	ret
+
+00800e5d <devsock_read>:
+{
+  800e5d:	55                   	push   %ebp
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800e63:	6a 00                	push   $0x0
+  800e65:	ff 75 10             	push   0x10(%ebp)
+  800e68:	ff 75 0c             	push   0xc(%ebp)
+  800e6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e6e:	ff 70 0c             	push   0xc(%eax)
+  800e71:	e8 ef 02 00 00       	call   801165 <nsipc_recv>
+}
+  800e76:	c9                   	leave
+  800e77:	c3                   	ret
+
+00800e78 <fd2sockid>:
+{
+  800e78:	55                   	push   %ebp
+  800e79:	89 e5                	mov    %esp,%ebp
+  800e7b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800e7e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800e81:	52                   	push   %edx
+  800e82:	50                   	push   %eax
+  800e83:	e8 fe f7 ff ff       	call   800686 <fd_lookup>
+  800e88:	83 c4 10             	add    $0x10,%esp
+  800e8b:	85 c0                	test   %eax,%eax
+  800e8d:	78 10                	js     800e9f <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800e8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e92:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800e98:	39 08                	cmp    %ecx,(%eax)
+  800e9a:	75 05                	jne    800ea1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800e9c:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800e9f:	c9                   	leave
+  800ea0:	c3                   	ret
+		return -E_NOT_SUPP;
+  800ea1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ea6:	eb f7                	jmp    800e9f <fd2sockid+0x27>
+
+00800ea8 <alloc_sockfd>:
+{
+  800ea8:	55                   	push   %ebp
+  800ea9:	89 e5                	mov    %esp,%ebp
+  800eab:	56                   	push   %esi
+  800eac:	53                   	push   %ebx
+  800ead:	83 ec 1c             	sub    $0x1c,%esp
+  800eb0:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800eb2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800eb5:	50                   	push   %eax
+  800eb6:	e8 75 f7 ff ff       	call   800630 <fd_alloc>
+  800ebb:	89 c3                	mov    %eax,%ebx
+  800ebd:	83 c4 10             	add    $0x10,%esp
+  800ec0:	85 c0                	test   %eax,%eax
+  800ec2:	78 43                	js     800f07 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800ec4:	83 ec 04             	sub    $0x4,%esp
+  800ec7:	68 07 04 00 00       	push   $0x407
+  800ecc:	ff 75 f4             	push   -0xc(%ebp)
+  800ecf:	6a 00                	push   $0x0
+  800ed1:	e8 0e f3 ff ff       	call   8001e4 <sys_page_alloc>
+  800ed6:	89 c3                	mov    %eax,%ebx
+  800ed8:	83 c4 10             	add    $0x10,%esp
+  800edb:	85 c0                	test   %eax,%eax
+  800edd:	78 28                	js     800f07 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800edf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ee2:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800ee8:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800eea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eed:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800ef4:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800ef7:	83 ec 0c             	sub    $0xc,%esp
+  800efa:	50                   	push   %eax
+  800efb:	e8 09 f7 ff ff       	call   800609 <fd2num>
+  800f00:	89 c3                	mov    %eax,%ebx
+  800f02:	83 c4 10             	add    $0x10,%esp
+  800f05:	eb 0c                	jmp    800f13 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800f07:	83 ec 0c             	sub    $0xc,%esp
+  800f0a:	56                   	push   %esi
+  800f0b:	e8 e4 01 00 00       	call   8010f4 <nsipc_close>
+		return r;
+  800f10:	83 c4 10             	add    $0x10,%esp
+}
+  800f13:	89 d8                	mov    %ebx,%eax
+  800f15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f18:	5b                   	pop    %ebx
+  800f19:	5e                   	pop    %esi
+  800f1a:	5d                   	pop    %ebp
+  800f1b:	c3                   	ret
+
+00800f1c <accept>:
+{
+  800f1c:	55                   	push   %ebp
+  800f1d:	89 e5                	mov    %esp,%ebp
+  800f1f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f25:	e8 4e ff ff ff       	call   800e78 <fd2sockid>
+  800f2a:	85 c0                	test   %eax,%eax
+  800f2c:	78 1b                	js     800f49 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800f2e:	83 ec 04             	sub    $0x4,%esp
+  800f31:	ff 75 10             	push   0x10(%ebp)
+  800f34:	ff 75 0c             	push   0xc(%ebp)
+  800f37:	50                   	push   %eax
+  800f38:	e8 0e 01 00 00       	call   80104b <nsipc_accept>
+  800f3d:	83 c4 10             	add    $0x10,%esp
+  800f40:	85 c0                	test   %eax,%eax
+  800f42:	78 05                	js     800f49 <accept+0x2d>
+	return alloc_sockfd(r);
+  800f44:	e8 5f ff ff ff       	call   800ea8 <alloc_sockfd>
+}
+  800f49:	c9                   	leave
+  800f4a:	c3                   	ret
+
+00800f4b <bind>:
+{
+  800f4b:	55                   	push   %ebp
+  800f4c:	89 e5                	mov    %esp,%ebp
+  800f4e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f54:	e8 1f ff ff ff       	call   800e78 <fd2sockid>
+  800f59:	85 c0                	test   %eax,%eax
+  800f5b:	78 12                	js     800f6f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800f5d:	83 ec 04             	sub    $0x4,%esp
+  800f60:	ff 75 10             	push   0x10(%ebp)
+  800f63:	ff 75 0c             	push   0xc(%ebp)
+  800f66:	50                   	push   %eax
+  800f67:	e8 31 01 00 00       	call   80109d <nsipc_bind>
+  800f6c:	83 c4 10             	add    $0x10,%esp
+}
+  800f6f:	c9                   	leave
+  800f70:	c3                   	ret
+
+00800f71 <shutdown>:
+{
+  800f71:	55                   	push   %ebp
+  800f72:	89 e5                	mov    %esp,%ebp
+  800f74:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f77:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7a:	e8 f9 fe ff ff       	call   800e78 <fd2sockid>
+  800f7f:	85 c0                	test   %eax,%eax
+  800f81:	78 0f                	js     800f92 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800f83:	83 ec 08             	sub    $0x8,%esp
+  800f86:	ff 75 0c             	push   0xc(%ebp)
+  800f89:	50                   	push   %eax
+  800f8a:	e8 43 01 00 00       	call   8010d2 <nsipc_shutdown>
+  800f8f:	83 c4 10             	add    $0x10,%esp
+}
+  800f92:	c9                   	leave
+  800f93:	c3                   	ret
+
+00800f94 <connect>:
+{
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f9d:	e8 d6 fe ff ff       	call   800e78 <fd2sockid>
+  800fa2:	85 c0                	test   %eax,%eax
+  800fa4:	78 12                	js     800fb8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800fa6:	83 ec 04             	sub    $0x4,%esp
+  800fa9:	ff 75 10             	push   0x10(%ebp)
+  800fac:	ff 75 0c             	push   0xc(%ebp)
+  800faf:	50                   	push   %eax
+  800fb0:	e8 59 01 00 00       	call   80110e <nsipc_connect>
+  800fb5:	83 c4 10             	add    $0x10,%esp
+}
+  800fb8:	c9                   	leave
+  800fb9:	c3                   	ret
+
+00800fba <listen>:
+{
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800fc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fc3:	e8 b0 fe ff ff       	call   800e78 <fd2sockid>
+  800fc8:	85 c0                	test   %eax,%eax
+  800fca:	78 0f                	js     800fdb <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800fcc:	83 ec 08             	sub    $0x8,%esp
+  800fcf:	ff 75 0c             	push   0xc(%ebp)
+  800fd2:	50                   	push   %eax
+  800fd3:	e8 6b 01 00 00       	call   801143 <nsipc_listen>
+  800fd8:	83 c4 10             	add    $0x10,%esp
+}
+  800fdb:	c9                   	leave
+  800fdc:	c3                   	ret
+
+00800fdd <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800fe3:	ff 75 10             	push   0x10(%ebp)
+  800fe6:	ff 75 0c             	push   0xc(%ebp)
+  800fe9:	ff 75 08             	push   0x8(%ebp)
+  800fec:	e8 41 02 00 00       	call   801232 <nsipc_socket>
+  800ff1:	83 c4 10             	add    $0x10,%esp
+  800ff4:	85 c0                	test   %eax,%eax
+  800ff6:	78 05                	js     800ffd <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800ff8:	e8 ab fe ff ff       	call   800ea8 <alloc_sockfd>
+}
+  800ffd:	c9                   	leave
+  800ffe:	c3                   	ret
+
+00800fff <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	53                   	push   %ebx
+  801003:	83 ec 04             	sub    $0x4,%esp
+  801006:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801008:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80100f:	74 26                	je     801037 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801011:	6a 07                	push   $0x7
+  801013:	68 00 60 80 00       	push   $0x806000
+  801018:	53                   	push   %ebx
+  801019:	ff 35 04 40 80 00    	push   0x804004
+  80101f:	e8 67 11 00 00       	call   80218b <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801024:	83 c4 0c             	add    $0xc,%esp
+  801027:	6a 00                	push   $0x0
+  801029:	6a 00                	push   $0x0
+  80102b:	6a 00                	push   $0x0
+  80102d:	e8 e1 10 00 00       	call   802113 <ipc_recv>
+}
+  801032:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801035:	c9                   	leave
+  801036:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801037:	83 ec 0c             	sub    $0xc,%esp
+  80103a:	6a 02                	push   $0x2
+  80103c:	e8 9e 11 00 00       	call   8021df <ipc_find_env>
+  801041:	a3 04 40 80 00       	mov    %eax,0x804004
+  801046:	83 c4 10             	add    $0x10,%esp
+  801049:	eb c6                	jmp    801011 <nsipc+0x12>
+
+0080104b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80104b:	55                   	push   %ebp
+  80104c:	89 e5                	mov    %esp,%ebp
+  80104e:	56                   	push   %esi
+  80104f:	53                   	push   %ebx
+  801050:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801053:	8b 45 08             	mov    0x8(%ebp),%eax
+  801056:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80105b:	8b 06                	mov    (%esi),%eax
+  80105d:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801062:	b8 01 00 00 00       	mov    $0x1,%eax
+  801067:	e8 93 ff ff ff       	call   800fff <nsipc>
+  80106c:	89 c3                	mov    %eax,%ebx
+  80106e:	85 c0                	test   %eax,%eax
+  801070:	79 09                	jns    80107b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801072:	89 d8                	mov    %ebx,%eax
+  801074:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801077:	5b                   	pop    %ebx
+  801078:	5e                   	pop    %esi
+  801079:	5d                   	pop    %ebp
+  80107a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80107b:	83 ec 04             	sub    $0x4,%esp
+  80107e:	ff 35 10 60 80 00    	push   0x806010
+  801084:	68 00 60 80 00       	push   $0x806000
+  801089:	ff 75 0c             	push   0xc(%ebp)
+  80108c:	e8 d8 0e 00 00       	call   801f69 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801091:	a1 10 60 80 00       	mov    0x806010,%eax
+  801096:	89 06                	mov    %eax,(%esi)
+  801098:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80109b:	eb d5                	jmp    801072 <nsipc_accept+0x27>
+
+0080109d <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80109d:	55                   	push   %ebp
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	53                   	push   %ebx
+  8010a1:	83 ec 08             	sub    $0x8,%esp
+  8010a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8010a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010aa:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8010af:	53                   	push   %ebx
+  8010b0:	ff 75 0c             	push   0xc(%ebp)
+  8010b3:	68 04 60 80 00       	push   $0x806004
+  8010b8:	e8 ac 0e 00 00       	call   801f69 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8010bd:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8010c3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010c8:	e8 32 ff ff ff       	call   800fff <nsipc>
+}
+  8010cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010d0:	c9                   	leave
+  8010d1:	c3                   	ret
+
+008010d2 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8010d2:	55                   	push   %ebp
+  8010d3:	89 e5                	mov    %esp,%ebp
+  8010d5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8010d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010db:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8010e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010e3:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8010e8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010ed:	e8 0d ff ff ff       	call   800fff <nsipc>
+}
+  8010f2:	c9                   	leave
+  8010f3:	c3                   	ret
+
+008010f4 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8010f4:	55                   	push   %ebp
+  8010f5:	89 e5                	mov    %esp,%ebp
+  8010f7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8010fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010fd:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801102:	b8 04 00 00 00       	mov    $0x4,%eax
+  801107:	e8 f3 fe ff ff       	call   800fff <nsipc>
+}
+  80110c:	c9                   	leave
+  80110d:	c3                   	ret
+
+0080110e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80110e:	55                   	push   %ebp
+  80110f:	89 e5                	mov    %esp,%ebp
+  801111:	53                   	push   %ebx
+  801112:	83 ec 08             	sub    $0x8,%esp
+  801115:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801118:	8b 45 08             	mov    0x8(%ebp),%eax
+  80111b:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801120:	53                   	push   %ebx
+  801121:	ff 75 0c             	push   0xc(%ebp)
+  801124:	68 04 60 80 00       	push   $0x806004
+  801129:	e8 3b 0e 00 00       	call   801f69 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80112e:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801134:	b8 05 00 00 00       	mov    $0x5,%eax
+  801139:	e8 c1 fe ff ff       	call   800fff <nsipc>
+}
+  80113e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801141:	c9                   	leave
+  801142:	c3                   	ret
+
+00801143 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801143:	55                   	push   %ebp
+  801144:	89 e5                	mov    %esp,%ebp
+  801146:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801149:	8b 45 08             	mov    0x8(%ebp),%eax
+  80114c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801151:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801154:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801159:	b8 06 00 00 00       	mov    $0x6,%eax
+  80115e:	e8 9c fe ff ff       	call   800fff <nsipc>
+}
+  801163:	c9                   	leave
+  801164:	c3                   	ret
+
+00801165 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801165:	55                   	push   %ebp
+  801166:	89 e5                	mov    %esp,%ebp
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  80116a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80116d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801170:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801175:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  80117b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80117e:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801183:	b8 07 00 00 00       	mov    $0x7,%eax
+  801188:	e8 72 fe ff ff       	call   800fff <nsipc>
+  80118d:	89 c3                	mov    %eax,%ebx
+  80118f:	85 c0                	test   %eax,%eax
+  801191:	78 22                	js     8011b5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801193:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801198:	39 c6                	cmp    %eax,%esi
+  80119a:	0f 4e c6             	cmovle %esi,%eax
+  80119d:	39 c3                	cmp    %eax,%ebx
+  80119f:	7f 1d                	jg     8011be <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8011a1:	83 ec 04             	sub    $0x4,%esp
+  8011a4:	53                   	push   %ebx
+  8011a5:	68 00 60 80 00       	push   $0x806000
+  8011aa:	ff 75 0c             	push   0xc(%ebp)
+  8011ad:	e8 b7 0d 00 00       	call   801f69 <memmove>
+  8011b2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8011b5:	89 d8                	mov    %ebx,%eax
+  8011b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011ba:	5b                   	pop    %ebx
+  8011bb:	5e                   	pop    %esi
+  8011bc:	5d                   	pop    %ebp
+  8011bd:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8011be:	68 87 27 80 00       	push   $0x802787
+  8011c3:	68 4f 27 80 00       	push   $0x80274f
+  8011c8:	6a 62                	push   $0x62
+  8011ca:	68 9c 27 80 00       	push   $0x80279c
+  8011cf:	e8 46 05 00 00       	call   80171a <_panic>
+
+008011d4 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	53                   	push   %ebx
+  8011d8:	83 ec 04             	sub    $0x4,%esp
+  8011db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8011de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e1:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  8011e6:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8011ec:	7f 2e                	jg     80121c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8011ee:	83 ec 04             	sub    $0x4,%esp
+  8011f1:	53                   	push   %ebx
+  8011f2:	ff 75 0c             	push   0xc(%ebp)
+  8011f5:	68 0c 60 80 00       	push   $0x80600c
+  8011fa:	e8 6a 0d 00 00       	call   801f69 <memmove>
+	nsipcbuf.send.req_size = size;
+  8011ff:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801205:	8b 45 14             	mov    0x14(%ebp),%eax
+  801208:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  80120d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801212:	e8 e8 fd ff ff       	call   800fff <nsipc>
+}
+  801217:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80121a:	c9                   	leave
+  80121b:	c3                   	ret
+	assert(size < 1600);
+  80121c:	68 a8 27 80 00       	push   $0x8027a8
+  801221:	68 4f 27 80 00       	push   $0x80274f
+  801226:	6a 6d                	push   $0x6d
+  801228:	68 9c 27 80 00       	push   $0x80279c
+  80122d:	e8 e8 04 00 00       	call   80171a <_panic>
+
+00801232 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801232:	55                   	push   %ebp
+  801233:	89 e5                	mov    %esp,%ebp
+  801235:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801238:	8b 45 08             	mov    0x8(%ebp),%eax
+  80123b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801240:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801243:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801248:	8b 45 10             	mov    0x10(%ebp),%eax
+  80124b:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801250:	b8 09 00 00 00       	mov    $0x9,%eax
+  801255:	e8 a5 fd ff ff       	call   800fff <nsipc>
+}
+  80125a:	c9                   	leave
+  80125b:	c3                   	ret
+
+0080125c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	56                   	push   %esi
+  801260:	53                   	push   %ebx
+  801261:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801264:	83 ec 0c             	sub    $0xc,%esp
+  801267:	ff 75 08             	push   0x8(%ebp)
+  80126a:	e8 aa f3 ff ff       	call   800619 <fd2data>
+  80126f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801271:	83 c4 08             	add    $0x8,%esp
+  801274:	68 b4 27 80 00       	push   $0x8027b4
+  801279:	53                   	push   %ebx
+  80127a:	e8 64 0b 00 00       	call   801de3 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80127f:	8b 46 04             	mov    0x4(%esi),%eax
+  801282:	2b 06                	sub    (%esi),%eax
+  801284:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80128a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801291:	00 00 00 
+	stat->st_dev = &devpipe;
+  801294:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  80129b:	30 80 00 
+	return 0;
+}
+  80129e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012a6:	5b                   	pop    %ebx
+  8012a7:	5e                   	pop    %esi
+  8012a8:	5d                   	pop    %ebp
+  8012a9:	c3                   	ret
+
+008012aa <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8012aa:	55                   	push   %ebp
+  8012ab:	89 e5                	mov    %esp,%ebp
+  8012ad:	53                   	push   %ebx
+  8012ae:	83 ec 0c             	sub    $0xc,%esp
+  8012b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8012b4:	53                   	push   %ebx
+  8012b5:	6a 00                	push   $0x0
+  8012b7:	e8 f0 ef ff ff       	call   8002ac <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8012bc:	89 1c 24             	mov    %ebx,(%esp)
+  8012bf:	e8 55 f3 ff ff       	call   800619 <fd2data>
+  8012c4:	83 c4 08             	add    $0x8,%esp
+  8012c7:	50                   	push   %eax
+  8012c8:	6a 00                	push   $0x0
+  8012ca:	e8 dd ef ff ff       	call   8002ac <sys_page_unmap>
+}
+  8012cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012d2:	c9                   	leave
+  8012d3:	c3                   	ret
+
+008012d4 <_pipeisclosed>:
+{
+  8012d4:	55                   	push   %ebp
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	57                   	push   %edi
+  8012d8:	56                   	push   %esi
+  8012d9:	53                   	push   %ebx
+  8012da:	83 ec 1c             	sub    $0x1c,%esp
+  8012dd:	89 c7                	mov    %eax,%edi
+  8012df:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8012e1:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012e6:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8012e9:	83 ec 0c             	sub    $0xc,%esp
+  8012ec:	57                   	push   %edi
+  8012ed:	e8 fd 0e 00 00       	call   8021ef <pageref>
+  8012f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012f5:	89 34 24             	mov    %esi,(%esp)
+  8012f8:	e8 f2 0e 00 00       	call   8021ef <pageref>
+		nn = thisenv->env_runs;
+  8012fd:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801303:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801306:	83 c4 10             	add    $0x10,%esp
+  801309:	39 cb                	cmp    %ecx,%ebx
+  80130b:	74 1b                	je     801328 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80130d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801310:	75 cf                	jne    8012e1 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801312:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801315:	6a 01                	push   $0x1
+  801317:	50                   	push   %eax
+  801318:	53                   	push   %ebx
+  801319:	68 bb 27 80 00       	push   $0x8027bb
+  80131e:	e8 d2 04 00 00       	call   8017f5 <cprintf>
+  801323:	83 c4 10             	add    $0x10,%esp
+  801326:	eb b9                	jmp    8012e1 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801328:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80132b:	0f 94 c0             	sete   %al
+  80132e:	0f b6 c0             	movzbl %al,%eax
+}
+  801331:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801334:	5b                   	pop    %ebx
+  801335:	5e                   	pop    %esi
+  801336:	5f                   	pop    %edi
+  801337:	5d                   	pop    %ebp
+  801338:	c3                   	ret
+
+00801339 <devpipe_write>:
+{
+  801339:	55                   	push   %ebp
+  80133a:	89 e5                	mov    %esp,%ebp
+  80133c:	57                   	push   %edi
+  80133d:	56                   	push   %esi
+  80133e:	53                   	push   %ebx
+  80133f:	83 ec 28             	sub    $0x28,%esp
+  801342:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801345:	56                   	push   %esi
+  801346:	e8 ce f2 ff ff       	call   800619 <fd2data>
+  80134b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80134d:	83 c4 10             	add    $0x10,%esp
+  801350:	bf 00 00 00 00       	mov    $0x0,%edi
+  801355:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801358:	75 09                	jne    801363 <devpipe_write+0x2a>
+	return i;
+  80135a:	89 f8                	mov    %edi,%eax
+  80135c:	eb 23                	jmp    801381 <devpipe_write+0x48>
+			sys_yield();
+  80135e:	e8 01 ee ff ff       	call   800164 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801363:	8b 43 04             	mov    0x4(%ebx),%eax
+  801366:	8b 0b                	mov    (%ebx),%ecx
+  801368:	8d 51 20             	lea    0x20(%ecx),%edx
+  80136b:	39 d0                	cmp    %edx,%eax
+  80136d:	72 1a                	jb     801389 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80136f:	89 da                	mov    %ebx,%edx
+  801371:	89 f0                	mov    %esi,%eax
+  801373:	e8 5c ff ff ff       	call   8012d4 <_pipeisclosed>
+  801378:	85 c0                	test   %eax,%eax
+  80137a:	74 e2                	je     80135e <devpipe_write+0x25>
+				return 0;
+  80137c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801381:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801384:	5b                   	pop    %ebx
+  801385:	5e                   	pop    %esi
+  801386:	5f                   	pop    %edi
+  801387:	5d                   	pop    %ebp
+  801388:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801389:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138c:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801390:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801393:	89 c2                	mov    %eax,%edx
+  801395:	c1 fa 1f             	sar    $0x1f,%edx
+  801398:	89 d1                	mov    %edx,%ecx
+  80139a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80139d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8013a0:	83 e2 1f             	and    $0x1f,%edx
+  8013a3:	29 ca                	sub    %ecx,%edx
+  8013a5:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8013a9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8013ad:	83 c0 01             	add    $0x1,%eax
+  8013b0:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8013b3:	83 c7 01             	add    $0x1,%edi
+  8013b6:	eb 9d                	jmp    801355 <devpipe_write+0x1c>
+
+008013b8 <devpipe_read>:
+{
+  8013b8:	55                   	push   %ebp
+  8013b9:	89 e5                	mov    %esp,%ebp
+  8013bb:	57                   	push   %edi
+  8013bc:	56                   	push   %esi
+  8013bd:	53                   	push   %ebx
+  8013be:	83 ec 18             	sub    $0x18,%esp
+  8013c1:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8013c4:	57                   	push   %edi
+  8013c5:	e8 4f f2 ff ff       	call   800619 <fd2data>
+  8013ca:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8013cc:	83 c4 10             	add    $0x10,%esp
+  8013cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8013d7:	75 13                	jne    8013ec <devpipe_read+0x34>
+	return i;
+  8013d9:	89 f0                	mov    %esi,%eax
+  8013db:	eb 02                	jmp    8013df <devpipe_read+0x27>
+				return i;
+  8013dd:	89 f0                	mov    %esi,%eax
+}
+  8013df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e2:	5b                   	pop    %ebx
+  8013e3:	5e                   	pop    %esi
+  8013e4:	5f                   	pop    %edi
+  8013e5:	5d                   	pop    %ebp
+  8013e6:	c3                   	ret
+			sys_yield();
+  8013e7:	e8 78 ed ff ff       	call   800164 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8013ec:	8b 03                	mov    (%ebx),%eax
+  8013ee:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8013f1:	75 18                	jne    80140b <devpipe_read+0x53>
+			if (i > 0)
+  8013f3:	85 f6                	test   %esi,%esi
+  8013f5:	75 e6                	jne    8013dd <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8013f7:	89 da                	mov    %ebx,%edx
+  8013f9:	89 f8                	mov    %edi,%eax
+  8013fb:	e8 d4 fe ff ff       	call   8012d4 <_pipeisclosed>
+  801400:	85 c0                	test   %eax,%eax
+  801402:	74 e3                	je     8013e7 <devpipe_read+0x2f>
+				return 0;
+  801404:	b8 00 00 00 00       	mov    $0x0,%eax
+  801409:	eb d4                	jmp    8013df <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80140b:	99                   	cltd
+  80140c:	c1 ea 1b             	shr    $0x1b,%edx
+  80140f:	01 d0                	add    %edx,%eax
+  801411:	83 e0 1f             	and    $0x1f,%eax
+  801414:	29 d0                	sub    %edx,%eax
+  801416:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80141b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801421:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801424:	83 c6 01             	add    $0x1,%esi
+  801427:	eb ab                	jmp    8013d4 <devpipe_read+0x1c>
+
+00801429 <pipe>:
+{
+  801429:	55                   	push   %ebp
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	56                   	push   %esi
+  80142d:	53                   	push   %ebx
+  80142e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801431:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801434:	50                   	push   %eax
+  801435:	e8 f6 f1 ff ff       	call   800630 <fd_alloc>
+  80143a:	89 c3                	mov    %eax,%ebx
+  80143c:	83 c4 10             	add    $0x10,%esp
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	0f 88 23 01 00 00    	js     80156a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801447:	83 ec 04             	sub    $0x4,%esp
+  80144a:	68 07 04 00 00       	push   $0x407
+  80144f:	ff 75 f4             	push   -0xc(%ebp)
+  801452:	6a 00                	push   $0x0
+  801454:	e8 8b ed ff ff       	call   8001e4 <sys_page_alloc>
+  801459:	89 c3                	mov    %eax,%ebx
+  80145b:	83 c4 10             	add    $0x10,%esp
+  80145e:	85 c0                	test   %eax,%eax
+  801460:	0f 88 04 01 00 00    	js     80156a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801466:	83 ec 0c             	sub    $0xc,%esp
+  801469:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80146c:	50                   	push   %eax
+  80146d:	e8 be f1 ff ff       	call   800630 <fd_alloc>
+  801472:	89 c3                	mov    %eax,%ebx
+  801474:	83 c4 10             	add    $0x10,%esp
+  801477:	85 c0                	test   %eax,%eax
+  801479:	0f 88 db 00 00 00    	js     80155a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80147f:	83 ec 04             	sub    $0x4,%esp
+  801482:	68 07 04 00 00       	push   $0x407
+  801487:	ff 75 f0             	push   -0x10(%ebp)
+  80148a:	6a 00                	push   $0x0
+  80148c:	e8 53 ed ff ff       	call   8001e4 <sys_page_alloc>
+  801491:	89 c3                	mov    %eax,%ebx
+  801493:	83 c4 10             	add    $0x10,%esp
+  801496:	85 c0                	test   %eax,%eax
+  801498:	0f 88 bc 00 00 00    	js     80155a <pipe+0x131>
+	va = fd2data(fd0);
+  80149e:	83 ec 0c             	sub    $0xc,%esp
+  8014a1:	ff 75 f4             	push   -0xc(%ebp)
+  8014a4:	e8 70 f1 ff ff       	call   800619 <fd2data>
+  8014a9:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014ab:	83 c4 0c             	add    $0xc,%esp
+  8014ae:	68 07 04 00 00       	push   $0x407
+  8014b3:	50                   	push   %eax
+  8014b4:	6a 00                	push   $0x0
+  8014b6:	e8 29 ed ff ff       	call   8001e4 <sys_page_alloc>
+  8014bb:	89 c3                	mov    %eax,%ebx
+  8014bd:	83 c4 10             	add    $0x10,%esp
+  8014c0:	85 c0                	test   %eax,%eax
+  8014c2:	0f 88 82 00 00 00    	js     80154a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014c8:	83 ec 0c             	sub    $0xc,%esp
+  8014cb:	ff 75 f0             	push   -0x10(%ebp)
+  8014ce:	e8 46 f1 ff ff       	call   800619 <fd2data>
+  8014d3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014da:	50                   	push   %eax
+  8014db:	6a 00                	push   $0x0
+  8014dd:	56                   	push   %esi
+  8014de:	6a 00                	push   $0x0
+  8014e0:	e8 85 ed ff ff       	call   80026a <sys_page_map>
+  8014e5:	89 c3                	mov    %eax,%ebx
+  8014e7:	83 c4 20             	add    $0x20,%esp
+  8014ea:	85 c0                	test   %eax,%eax
+  8014ec:	78 4e                	js     80153c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014ee:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8014f3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014f6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014fb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801502:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801505:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801507:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80150a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801511:	83 ec 0c             	sub    $0xc,%esp
+  801514:	ff 75 f4             	push   -0xc(%ebp)
+  801517:	e8 ed f0 ff ff       	call   800609 <fd2num>
+  80151c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80151f:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801521:	83 c4 04             	add    $0x4,%esp
+  801524:	ff 75 f0             	push   -0x10(%ebp)
+  801527:	e8 dd f0 ff ff       	call   800609 <fd2num>
+  80152c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80152f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801532:	83 c4 10             	add    $0x10,%esp
+  801535:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153a:	eb 2e                	jmp    80156a <pipe+0x141>
+	sys_page_unmap(0, va);
+  80153c:	83 ec 08             	sub    $0x8,%esp
+  80153f:	56                   	push   %esi
+  801540:	6a 00                	push   $0x0
+  801542:	e8 65 ed ff ff       	call   8002ac <sys_page_unmap>
+  801547:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80154a:	83 ec 08             	sub    $0x8,%esp
+  80154d:	ff 75 f0             	push   -0x10(%ebp)
+  801550:	6a 00                	push   $0x0
+  801552:	e8 55 ed ff ff       	call   8002ac <sys_page_unmap>
+  801557:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80155a:	83 ec 08             	sub    $0x8,%esp
+  80155d:	ff 75 f4             	push   -0xc(%ebp)
+  801560:	6a 00                	push   $0x0
+  801562:	e8 45 ed ff ff       	call   8002ac <sys_page_unmap>
+  801567:	83 c4 10             	add    $0x10,%esp
+}
+  80156a:	89 d8                	mov    %ebx,%eax
+  80156c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80156f:	5b                   	pop    %ebx
+  801570:	5e                   	pop    %esi
+  801571:	5d                   	pop    %ebp
+  801572:	c3                   	ret
+
+00801573 <pipeisclosed>:
+{
+  801573:	55                   	push   %ebp
+  801574:	89 e5                	mov    %esp,%ebp
+  801576:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801579:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80157c:	50                   	push   %eax
+  80157d:	ff 75 08             	push   0x8(%ebp)
+  801580:	e8 01 f1 ff ff       	call   800686 <fd_lookup>
+  801585:	83 c4 10             	add    $0x10,%esp
+  801588:	85 c0                	test   %eax,%eax
+  80158a:	78 18                	js     8015a4 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80158c:	83 ec 0c             	sub    $0xc,%esp
+  80158f:	ff 75 f4             	push   -0xc(%ebp)
+  801592:	e8 82 f0 ff ff       	call   800619 <fd2data>
+  801597:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801599:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80159c:	e8 33 fd ff ff       	call   8012d4 <_pipeisclosed>
+  8015a1:	83 c4 10             	add    $0x10,%esp
+}
+  8015a4:	c9                   	leave
+  8015a5:	c3                   	ret
+
+008015a6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8015a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ab:	c3                   	ret
+
+008015ac <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015b2:	68 d3 27 80 00       	push   $0x8027d3
+  8015b7:	ff 75 0c             	push   0xc(%ebp)
+  8015ba:	e8 24 08 00 00       	call   801de3 <strcpy>
+	return 0;
+}
+  8015bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c4:	c9                   	leave
+  8015c5:	c3                   	ret
+
+008015c6 <devcons_write>:
+{
+  8015c6:	55                   	push   %ebp
+  8015c7:	89 e5                	mov    %esp,%ebp
+  8015c9:	57                   	push   %edi
+  8015ca:	56                   	push   %esi
+  8015cb:	53                   	push   %ebx
+  8015cc:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015d2:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015d7:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015dd:	eb 2e                	jmp    80160d <devcons_write+0x47>
+		m = n - tot;
+  8015df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e2:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015e4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015e9:	39 c3                	cmp    %eax,%ebx
+  8015eb:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015ee:	83 ec 04             	sub    $0x4,%esp
+  8015f1:	53                   	push   %ebx
+  8015f2:	89 f0                	mov    %esi,%eax
+  8015f4:	03 45 0c             	add    0xc(%ebp),%eax
+  8015f7:	50                   	push   %eax
+  8015f8:	57                   	push   %edi
+  8015f9:	e8 6b 09 00 00       	call   801f69 <memmove>
+		sys_cputs(buf, m);
+  8015fe:	83 c4 08             	add    $0x8,%esp
+  801601:	53                   	push   %ebx
+  801602:	57                   	push   %edi
+  801603:	e8 9f ea ff ff       	call   8000a7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801608:	01 de                	add    %ebx,%esi
+  80160a:	83 c4 10             	add    $0x10,%esp
+  80160d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801610:	72 cd                	jb     8015df <devcons_write+0x19>
+}
+  801612:	89 f0                	mov    %esi,%eax
+  801614:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801617:	5b                   	pop    %ebx
+  801618:	5e                   	pop    %esi
+  801619:	5f                   	pop    %edi
+  80161a:	5d                   	pop    %ebp
+  80161b:	c3                   	ret
+
+0080161c <devcons_read>:
+{
+  80161c:	55                   	push   %ebp
+  80161d:	89 e5                	mov    %esp,%ebp
+  80161f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801622:	b8 00 00 00 00       	mov    $0x0,%eax
+  801627:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80162b:	75 07                	jne    801634 <devcons_read+0x18>
+  80162d:	eb 1f                	jmp    80164e <devcons_read+0x32>
+		sys_yield();
+  80162f:	e8 30 eb ff ff       	call   800164 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801634:	e8 8c ea ff ff       	call   8000c5 <sys_cgetc>
+  801639:	85 c0                	test   %eax,%eax
+  80163b:	74 f2                	je     80162f <devcons_read+0x13>
+	if (c < 0)
+  80163d:	78 0f                	js     80164e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80163f:	83 f8 04             	cmp    $0x4,%eax
+  801642:	74 0c                	je     801650 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801644:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801647:	88 02                	mov    %al,(%edx)
+	return 1;
+  801649:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80164e:	c9                   	leave
+  80164f:	c3                   	ret
+		return 0;
+  801650:	b8 00 00 00 00       	mov    $0x0,%eax
+  801655:	eb f7                	jmp    80164e <devcons_read+0x32>
+
+00801657 <cputchar>:
+{
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80165d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801660:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801663:	6a 01                	push   $0x1
+  801665:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801668:	50                   	push   %eax
+  801669:	e8 39 ea ff ff       	call   8000a7 <sys_cputs>
+}
+  80166e:	83 c4 10             	add    $0x10,%esp
+  801671:	c9                   	leave
+  801672:	c3                   	ret
+
+00801673 <getchar>:
+{
+  801673:	55                   	push   %ebp
+  801674:	89 e5                	mov    %esp,%ebp
+  801676:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801679:	6a 01                	push   $0x1
+  80167b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80167e:	50                   	push   %eax
+  80167f:	6a 00                	push   $0x0
+  801681:	e8 66 f2 ff ff       	call   8008ec <read>
+	if (r < 0)
+  801686:	83 c4 10             	add    $0x10,%esp
+  801689:	85 c0                	test   %eax,%eax
+  80168b:	78 06                	js     801693 <getchar+0x20>
+	if (r < 1)
+  80168d:	74 06                	je     801695 <getchar+0x22>
+	return c;
+  80168f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801693:	c9                   	leave
+  801694:	c3                   	ret
+		return -E_EOF;
+  801695:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80169a:	eb f7                	jmp    801693 <getchar+0x20>
+
+0080169c <iscons>:
+{
+  80169c:	55                   	push   %ebp
+  80169d:	89 e5                	mov    %esp,%ebp
+  80169f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016a5:	50                   	push   %eax
+  8016a6:	ff 75 08             	push   0x8(%ebp)
+  8016a9:	e8 d8 ef ff ff       	call   800686 <fd_lookup>
+  8016ae:	83 c4 10             	add    $0x10,%esp
+  8016b1:	85 c0                	test   %eax,%eax
+  8016b3:	78 11                	js     8016c6 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b8:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8016be:	39 10                	cmp    %edx,(%eax)
+  8016c0:	0f 94 c0             	sete   %al
+  8016c3:	0f b6 c0             	movzbl %al,%eax
+}
+  8016c6:	c9                   	leave
+  8016c7:	c3                   	ret
+
+008016c8 <opencons>:
+{
+  8016c8:	55                   	push   %ebp
+  8016c9:	89 e5                	mov    %esp,%ebp
+  8016cb:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d1:	50                   	push   %eax
+  8016d2:	e8 59 ef ff ff       	call   800630 <fd_alloc>
+  8016d7:	83 c4 10             	add    $0x10,%esp
+  8016da:	85 c0                	test   %eax,%eax
+  8016dc:	78 3a                	js     801718 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016de:	83 ec 04             	sub    $0x4,%esp
+  8016e1:	68 07 04 00 00       	push   $0x407
+  8016e6:	ff 75 f4             	push   -0xc(%ebp)
+  8016e9:	6a 00                	push   $0x0
+  8016eb:	e8 f4 ea ff ff       	call   8001e4 <sys_page_alloc>
+  8016f0:	83 c4 10             	add    $0x10,%esp
+  8016f3:	85 c0                	test   %eax,%eax
+  8016f5:	78 21                	js     801718 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016fa:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801700:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801702:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801705:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80170c:	83 ec 0c             	sub    $0xc,%esp
+  80170f:	50                   	push   %eax
+  801710:	e8 f4 ee ff ff       	call   800609 <fd2num>
+  801715:	83 c4 10             	add    $0x10,%esp
+}
+  801718:	c9                   	leave
+  801719:	c3                   	ret
+
+0080171a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80171a:	55                   	push   %ebp
+  80171b:	89 e5                	mov    %esp,%ebp
+  80171d:	56                   	push   %esi
+  80171e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80171f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801722:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801728:	e8 18 ea ff ff       	call   800145 <sys_getenvid>
+  80172d:	83 ec 0c             	sub    $0xc,%esp
+  801730:	ff 75 0c             	push   0xc(%ebp)
+  801733:	ff 75 08             	push   0x8(%ebp)
+  801736:	56                   	push   %esi
+  801737:	50                   	push   %eax
+  801738:	68 e0 27 80 00       	push   $0x8027e0
+  80173d:	e8 b3 00 00 00       	call   8017f5 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801742:	83 c4 18             	add    $0x18,%esp
+  801745:	53                   	push   %ebx
+  801746:	ff 75 10             	push   0x10(%ebp)
+  801749:	e8 56 00 00 00       	call   8017a4 <vcprintf>
+	cprintf("\n");
+  80174e:	c7 04 24 cc 27 80 00 	movl   $0x8027cc,(%esp)
+  801755:	e8 9b 00 00 00       	call   8017f5 <cprintf>
+  80175a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80175d:	cc                   	int3
+	while (1)
+  80175e:	eb fd                	jmp    80175d <_panic+0x43>
+
+00801760 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801760:	55                   	push   %ebp
+  801761:	89 e5                	mov    %esp,%ebp
+  801763:	53                   	push   %ebx
+  801764:	83 ec 04             	sub    $0x4,%esp
+  801767:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80176a:	8b 13                	mov    (%ebx),%edx
+  80176c:	8d 42 01             	lea    0x1(%edx),%eax
+  80176f:	89 03                	mov    %eax,(%ebx)
+  801771:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801774:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801778:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80177d:	74 09                	je     801788 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80177f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801783:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801786:	c9                   	leave
+  801787:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801788:	83 ec 08             	sub    $0x8,%esp
+  80178b:	68 ff 00 00 00       	push   $0xff
+  801790:	8d 43 08             	lea    0x8(%ebx),%eax
+  801793:	50                   	push   %eax
+  801794:	e8 0e e9 ff ff       	call   8000a7 <sys_cputs>
+		b->idx = 0;
+  801799:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80179f:	83 c4 10             	add    $0x10,%esp
+  8017a2:	eb db                	jmp    80177f <putch+0x1f>
+
+008017a4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8017a4:	55                   	push   %ebp
+  8017a5:	89 e5                	mov    %esp,%ebp
+  8017a7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017ad:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017b4:	00 00 00 
+	b.cnt = 0;
+  8017b7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017be:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017c1:	ff 75 0c             	push   0xc(%ebp)
+  8017c4:	ff 75 08             	push   0x8(%ebp)
+  8017c7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017cd:	50                   	push   %eax
+  8017ce:	68 60 17 80 00       	push   $0x801760
+  8017d3:	e8 14 01 00 00       	call   8018ec <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017d8:	83 c4 08             	add    $0x8,%esp
+  8017db:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017e1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017e7:	50                   	push   %eax
+  8017e8:	e8 ba e8 ff ff       	call   8000a7 <sys_cputs>
+
+	return b.cnt;
+}
+  8017ed:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017f3:	c9                   	leave
+  8017f4:	c3                   	ret
+
+008017f5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017f5:	55                   	push   %ebp
+  8017f6:	89 e5                	mov    %esp,%ebp
+  8017f8:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017fb:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8017fe:	50                   	push   %eax
+  8017ff:	ff 75 08             	push   0x8(%ebp)
+  801802:	e8 9d ff ff ff       	call   8017a4 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801807:	c9                   	leave
+  801808:	c3                   	ret
+
+00801809 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801809:	55                   	push   %ebp
+  80180a:	89 e5                	mov    %esp,%ebp
+  80180c:	57                   	push   %edi
+  80180d:	56                   	push   %esi
+  80180e:	53                   	push   %ebx
+  80180f:	83 ec 1c             	sub    $0x1c,%esp
+  801812:	89 c7                	mov    %eax,%edi
+  801814:	89 d6                	mov    %edx,%esi
+  801816:	8b 45 08             	mov    0x8(%ebp),%eax
+  801819:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80181c:	89 d1                	mov    %edx,%ecx
+  80181e:	89 c2                	mov    %eax,%edx
+  801820:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801823:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801826:	8b 45 10             	mov    0x10(%ebp),%eax
+  801829:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80182c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80182f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801836:	39 c2                	cmp    %eax,%edx
+  801838:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80183b:	72 3e                	jb     80187b <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80183d:	83 ec 0c             	sub    $0xc,%esp
+  801840:	ff 75 18             	push   0x18(%ebp)
+  801843:	83 eb 01             	sub    $0x1,%ebx
+  801846:	53                   	push   %ebx
+  801847:	50                   	push   %eax
+  801848:	83 ec 08             	sub    $0x8,%esp
+  80184b:	ff 75 e4             	push   -0x1c(%ebp)
+  80184e:	ff 75 e0             	push   -0x20(%ebp)
+  801851:	ff 75 dc             	push   -0x24(%ebp)
+  801854:	ff 75 d8             	push   -0x28(%ebp)
+  801857:	e8 b4 0a 00 00       	call   802310 <__udivdi3>
+  80185c:	83 c4 18             	add    $0x18,%esp
+  80185f:	52                   	push   %edx
+  801860:	50                   	push   %eax
+  801861:	89 f2                	mov    %esi,%edx
+  801863:	89 f8                	mov    %edi,%eax
+  801865:	e8 9f ff ff ff       	call   801809 <printnum>
+  80186a:	83 c4 20             	add    $0x20,%esp
+  80186d:	eb 13                	jmp    801882 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80186f:	83 ec 08             	sub    $0x8,%esp
+  801872:	56                   	push   %esi
+  801873:	ff 75 18             	push   0x18(%ebp)
+  801876:	ff d7                	call   *%edi
+  801878:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80187b:	83 eb 01             	sub    $0x1,%ebx
+  80187e:	85 db                	test   %ebx,%ebx
+  801880:	7f ed                	jg     80186f <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801882:	83 ec 08             	sub    $0x8,%esp
+  801885:	56                   	push   %esi
+  801886:	83 ec 04             	sub    $0x4,%esp
+  801889:	ff 75 e4             	push   -0x1c(%ebp)
+  80188c:	ff 75 e0             	push   -0x20(%ebp)
+  80188f:	ff 75 dc             	push   -0x24(%ebp)
+  801892:	ff 75 d8             	push   -0x28(%ebp)
+  801895:	e8 36 0b 00 00       	call   8023d0 <__umoddi3>
+  80189a:	83 c4 14             	add    $0x14,%esp
+  80189d:	0f be 80 03 28 80 00 	movsbl 0x802803(%eax),%eax
+  8018a4:	50                   	push   %eax
+  8018a5:	ff d7                	call   *%edi
+}
+  8018a7:	83 c4 10             	add    $0x10,%esp
+  8018aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ad:	5b                   	pop    %ebx
+  8018ae:	5e                   	pop    %esi
+  8018af:	5f                   	pop    %edi
+  8018b0:	5d                   	pop    %ebp
+  8018b1:	c3                   	ret
+
+008018b2 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018b2:	55                   	push   %ebp
+  8018b3:	89 e5                	mov    %esp,%ebp
+  8018b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018b8:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018bc:	8b 10                	mov    (%eax),%edx
+  8018be:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018c1:	73 0a                	jae    8018cd <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018c3:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018c6:	89 08                	mov    %ecx,(%eax)
+  8018c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018cb:	88 02                	mov    %al,(%edx)
+}
+  8018cd:	5d                   	pop    %ebp
+  8018ce:	c3                   	ret
+
+008018cf <printfmt>:
+{
+  8018cf:	55                   	push   %ebp
+  8018d0:	89 e5                	mov    %esp,%ebp
+  8018d2:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018d5:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018d8:	50                   	push   %eax
+  8018d9:	ff 75 10             	push   0x10(%ebp)
+  8018dc:	ff 75 0c             	push   0xc(%ebp)
+  8018df:	ff 75 08             	push   0x8(%ebp)
+  8018e2:	e8 05 00 00 00       	call   8018ec <vprintfmt>
+}
+  8018e7:	83 c4 10             	add    $0x10,%esp
+  8018ea:	c9                   	leave
+  8018eb:	c3                   	ret
+
+008018ec <vprintfmt>:
+{
+  8018ec:	55                   	push   %ebp
+  8018ed:	89 e5                	mov    %esp,%ebp
+  8018ef:	57                   	push   %edi
+  8018f0:	56                   	push   %esi
+  8018f1:	53                   	push   %ebx
+  8018f2:	83 ec 2c             	sub    $0x2c,%esp
+  8018f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018fb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8018fe:	eb 0a                	jmp    80190a <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801900:	83 ec 08             	sub    $0x8,%esp
+  801903:	53                   	push   %ebx
+  801904:	50                   	push   %eax
+  801905:	ff d6                	call   *%esi
+  801907:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80190a:	83 c7 01             	add    $0x1,%edi
+  80190d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801911:	83 f8 25             	cmp    $0x25,%eax
+  801914:	74 0c                	je     801922 <vprintfmt+0x36>
+			if (ch == '\0')
+  801916:	85 c0                	test   %eax,%eax
+  801918:	75 e6                	jne    801900 <vprintfmt+0x14>
+}
+  80191a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80191d:	5b                   	pop    %ebx
+  80191e:	5e                   	pop    %esi
+  80191f:	5f                   	pop    %edi
+  801920:	5d                   	pop    %ebp
+  801921:	c3                   	ret
+		padc = ' ';
+  801922:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801926:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80192d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801934:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80193b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801940:	8d 47 01             	lea    0x1(%edi),%eax
+  801943:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801946:	0f b6 17             	movzbl (%edi),%edx
+  801949:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80194c:	3c 55                	cmp    $0x55,%al
+  80194e:	0f 87 cf 03 00 00    	ja     801d23 <vprintfmt+0x437>
+  801954:	0f b6 c0             	movzbl %al,%eax
+  801957:	ff 24 85 40 29 80 00 	jmp    *0x802940(,%eax,4)
+  80195e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801961:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801965:	eb d9                	jmp    801940 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801967:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80196a:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80196e:	eb d0                	jmp    801940 <vprintfmt+0x54>
+  801970:	0f b6 d2             	movzbl %dl,%edx
+  801973:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801976:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80197e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801981:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801985:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801988:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80198b:	83 f9 09             	cmp    $0x9,%ecx
+  80198e:	77 55                	ja     8019e5 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801990:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801993:	eb e9                	jmp    80197e <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801995:	8b 45 14             	mov    0x14(%ebp),%eax
+  801998:	8b 00                	mov    (%eax),%eax
+  80199a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80199d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8019a3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8019a9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019ad:	79 91                	jns    801940 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019af:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019b2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019b5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019bc:	eb 82                	jmp    801940 <vprintfmt+0x54>
+			if (width < 0)
+  8019be:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019c1:	85 d2                	test   %edx,%edx
+  8019c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c8:	0f 49 c2             	cmovns %edx,%eax
+  8019cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019d1:	e9 6a ff ff ff       	jmp    801940 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019d9:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019e0:	e9 5b ff ff ff       	jmp    801940 <vprintfmt+0x54>
+  8019e5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019eb:	eb bc                	jmp    8019a9 <vprintfmt+0xbd>
+			lflag++;
+  8019ed:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019f3:	e9 48 ff ff ff       	jmp    801940 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019fb:	8d 78 04             	lea    0x4(%eax),%edi
+  8019fe:	83 ec 08             	sub    $0x8,%esp
+  801a01:	53                   	push   %ebx
+  801a02:	ff 30                	push   (%eax)
+  801a04:	ff d6                	call   *%esi
+			break;
+  801a06:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801a09:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801a0c:	e9 b1 02 00 00       	jmp    801cc2 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801a11:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a14:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a17:	8b 10                	mov    (%eax),%edx
+  801a19:	89 d0                	mov    %edx,%eax
+  801a1b:	f7 d8                	neg    %eax
+  801a1d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a20:	83 f8 0f             	cmp    $0xf,%eax
+  801a23:	7f 23                	jg     801a48 <vprintfmt+0x15c>
+  801a25:	8b 14 85 a0 2a 80 00 	mov    0x802aa0(,%eax,4),%edx
+  801a2c:	85 d2                	test   %edx,%edx
+  801a2e:	74 18                	je     801a48 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a30:	52                   	push   %edx
+  801a31:	68 61 27 80 00       	push   $0x802761
+  801a36:	53                   	push   %ebx
+  801a37:	56                   	push   %esi
+  801a38:	e8 92 fe ff ff       	call   8018cf <printfmt>
+  801a3d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a40:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a43:	e9 7a 02 00 00       	jmp    801cc2 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801a48:	50                   	push   %eax
+  801a49:	68 1b 28 80 00       	push   $0x80281b
+  801a4e:	53                   	push   %ebx
+  801a4f:	56                   	push   %esi
+  801a50:	e8 7a fe ff ff       	call   8018cf <printfmt>
+  801a55:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a58:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a5b:	e9 62 02 00 00       	jmp    801cc2 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a60:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a63:	83 c0 04             	add    $0x4,%eax
+  801a66:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a69:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a6c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a6e:	85 c9                	test   %ecx,%ecx
+  801a70:	b8 14 28 80 00       	mov    $0x802814,%eax
+  801a75:	0f 45 c1             	cmovne %ecx,%eax
+  801a78:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a7b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a7f:	7e 06                	jle    801a87 <vprintfmt+0x19b>
+  801a81:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a85:	75 0b                	jne    801a92 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a87:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a8a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a8d:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a90:	eb 5c                	jmp    801aee <vprintfmt+0x202>
+  801a92:	83 ec 08             	sub    $0x8,%esp
+  801a95:	ff 75 d0             	push   -0x30(%ebp)
+  801a98:	ff 75 cc             	push   -0x34(%ebp)
+  801a9b:	e8 20 03 00 00       	call   801dc0 <strnlen>
+  801aa0:	89 c2                	mov    %eax,%edx
+  801aa2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aa5:	29 d0                	sub    %edx,%eax
+  801aa7:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801aaa:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801aae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ab1:	89 75 08             	mov    %esi,0x8(%ebp)
+  801ab4:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ab6:	eb 0e                	jmp    801ac6 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801ab8:	83 ec 08             	sub    $0x8,%esp
+  801abb:	53                   	push   %ebx
+  801abc:	57                   	push   %edi
+  801abd:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ac0:	83 ee 01             	sub    $0x1,%esi
+  801ac3:	83 c4 10             	add    $0x10,%esp
+  801ac6:	85 f6                	test   %esi,%esi
+  801ac8:	7f ee                	jg     801ab8 <vprintfmt+0x1cc>
+  801aca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801acd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ad0:	85 c0                	test   %eax,%eax
+  801ad2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad7:	0f 49 d0             	cmovns %eax,%edx
+  801ada:	29 d0                	sub    %edx,%eax
+  801adc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801adf:	eb a6                	jmp    801a87 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ae1:	83 ec 08             	sub    $0x8,%esp
+  801ae4:	53                   	push   %ebx
+  801ae5:	52                   	push   %edx
+  801ae6:	ff 55 08             	call   *0x8(%ebp)
+  801ae9:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801aec:	89 f1                	mov    %esi,%ecx
+  801aee:	8d 71 01             	lea    0x1(%ecx),%esi
+  801af1:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801af5:	0f be d0             	movsbl %al,%edx
+  801af8:	85 d2                	test   %edx,%edx
+  801afa:	74 28                	je     801b24 <vprintfmt+0x238>
+  801afc:	85 ff                	test   %edi,%edi
+  801afe:	78 05                	js     801b05 <vprintfmt+0x219>
+  801b00:	83 ef 01             	sub    $0x1,%edi
+  801b03:	78 30                	js     801b35 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801b05:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801b09:	74 d6                	je     801ae1 <vprintfmt+0x1f5>
+  801b0b:	0f be c0             	movsbl %al,%eax
+  801b0e:	83 e8 20             	sub    $0x20,%eax
+  801b11:	83 f8 5e             	cmp    $0x5e,%eax
+  801b14:	76 cb                	jbe    801ae1 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b16:	83 ec 08             	sub    $0x8,%esp
+  801b19:	53                   	push   %ebx
+  801b1a:	6a 3f                	push   $0x3f
+  801b1c:	ff 55 08             	call   *0x8(%ebp)
+  801b1f:	83 c4 10             	add    $0x10,%esp
+  801b22:	eb c8                	jmp    801aec <vprintfmt+0x200>
+  801b24:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b27:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b2a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b2d:	01 d0                	add    %edx,%eax
+  801b2f:	29 c8                	sub    %ecx,%eax
+  801b31:	89 c7                	mov    %eax,%edi
+  801b33:	eb 13                	jmp    801b48 <vprintfmt+0x25c>
+  801b35:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b38:	eb ed                	jmp    801b27 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b3a:	83 ec 08             	sub    $0x8,%esp
+  801b3d:	53                   	push   %ebx
+  801b3e:	6a 20                	push   $0x20
+  801b40:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b42:	83 ef 01             	sub    $0x1,%edi
+  801b45:	83 c4 10             	add    $0x10,%esp
+  801b48:	85 ff                	test   %edi,%edi
+  801b4a:	7f ee                	jg     801b3a <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b4c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b4f:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b52:	e9 6b 01 00 00       	jmp    801cc2 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801b57:	83 f9 01             	cmp    $0x1,%ecx
+  801b5a:	7f 1f                	jg     801b7b <vprintfmt+0x28f>
+	else if (lflag)
+  801b5c:	85 c9                	test   %ecx,%ecx
+  801b5e:	74 67                	je     801bc7 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801b60:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b63:	8b 00                	mov    (%eax),%eax
+  801b65:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b68:	89 c1                	mov    %eax,%ecx
+  801b6a:	c1 f9 1f             	sar    $0x1f,%ecx
+  801b6d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801b70:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b73:	8d 40 04             	lea    0x4(%eax),%eax
+  801b76:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b79:	eb 17                	jmp    801b92 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801b7b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b7e:	8b 50 04             	mov    0x4(%eax),%edx
+  801b81:	8b 00                	mov    (%eax),%eax
+  801b83:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b86:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b89:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b8c:	8d 40 08             	lea    0x8(%eax),%eax
+  801b8f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b92:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b95:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b98:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801b9d:	85 c9                	test   %ecx,%ecx
+  801b9f:	0f 89 03 01 00 00    	jns    801ca8 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  801ba5:	83 ec 08             	sub    $0x8,%esp
+  801ba8:	53                   	push   %ebx
+  801ba9:	6a 2d                	push   $0x2d
+  801bab:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801bad:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801bb0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801bb3:	f7 da                	neg    %edx
+  801bb5:	83 d1 00             	adc    $0x0,%ecx
+  801bb8:	f7 d9                	neg    %ecx
+  801bba:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bbd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bc2:	e9 e1 00 00 00       	jmp    801ca8 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  801bc7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bca:	8b 00                	mov    (%eax),%eax
+  801bcc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bcf:	89 c1                	mov    %eax,%ecx
+  801bd1:	c1 f9 1f             	sar    $0x1f,%ecx
+  801bd4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801bd7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bda:	8d 40 04             	lea    0x4(%eax),%eax
+  801bdd:	89 45 14             	mov    %eax,0x14(%ebp)
+  801be0:	eb b0                	jmp    801b92 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801be2:	83 f9 01             	cmp    $0x1,%ecx
+  801be5:	7f 1e                	jg     801c05 <vprintfmt+0x319>
+	else if (lflag)
+  801be7:	85 c9                	test   %ecx,%ecx
+  801be9:	74 32                	je     801c1d <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  801beb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bee:	8b 10                	mov    (%eax),%edx
+  801bf0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bf5:	8d 40 04             	lea    0x4(%eax),%eax
+  801bf8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bfb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801c00:	e9 a3 00 00 00       	jmp    801ca8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c05:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c08:	8b 10                	mov    (%eax),%edx
+  801c0a:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c0d:	8d 40 08             	lea    0x8(%eax),%eax
+  801c10:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c13:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c18:	e9 8b 00 00 00       	jmp    801ca8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c20:	8b 10                	mov    (%eax),%edx
+  801c22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c27:	8d 40 04             	lea    0x4(%eax),%eax
+  801c2a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c2d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c32:	eb 74                	jmp    801ca8 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  801c34:	83 f9 01             	cmp    $0x1,%ecx
+  801c37:	7f 1b                	jg     801c54 <vprintfmt+0x368>
+	else if (lflag)
+  801c39:	85 c9                	test   %ecx,%ecx
+  801c3b:	74 2c                	je     801c69 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  801c3d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c40:	8b 10                	mov    (%eax),%edx
+  801c42:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c47:	8d 40 04             	lea    0x4(%eax),%eax
+  801c4a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c4d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  801c52:	eb 54                	jmp    801ca8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c54:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c57:	8b 10                	mov    (%eax),%edx
+  801c59:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c5c:	8d 40 08             	lea    0x8(%eax),%eax
+  801c5f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c62:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  801c67:	eb 3f                	jmp    801ca8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c69:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c6c:	8b 10                	mov    (%eax),%edx
+  801c6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c73:	8d 40 04             	lea    0x4(%eax),%eax
+  801c76:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c79:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  801c7e:	eb 28                	jmp    801ca8 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  801c80:	83 ec 08             	sub    $0x8,%esp
+  801c83:	53                   	push   %ebx
+  801c84:	6a 30                	push   $0x30
+  801c86:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c88:	83 c4 08             	add    $0x8,%esp
+  801c8b:	53                   	push   %ebx
+  801c8c:	6a 78                	push   $0x78
+  801c8e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c90:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c93:	8b 10                	mov    (%eax),%edx
+  801c95:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801c9a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801c9d:	8d 40 04             	lea    0x4(%eax),%eax
+  801ca0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ca3:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801ca8:	83 ec 0c             	sub    $0xc,%esp
+  801cab:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801caf:	50                   	push   %eax
+  801cb0:	ff 75 e0             	push   -0x20(%ebp)
+  801cb3:	57                   	push   %edi
+  801cb4:	51                   	push   %ecx
+  801cb5:	52                   	push   %edx
+  801cb6:	89 da                	mov    %ebx,%edx
+  801cb8:	89 f0                	mov    %esi,%eax
+  801cba:	e8 4a fb ff ff       	call   801809 <printnum>
+			break;
+  801cbf:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801cc2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801cc5:	e9 40 fc ff ff       	jmp    80190a <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801cca:	83 f9 01             	cmp    $0x1,%ecx
+  801ccd:	7f 1b                	jg     801cea <vprintfmt+0x3fe>
+	else if (lflag)
+  801ccf:	85 c9                	test   %ecx,%ecx
+  801cd1:	74 2c                	je     801cff <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  801cd3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cd6:	8b 10                	mov    (%eax),%edx
+  801cd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cdd:	8d 40 04             	lea    0x4(%eax),%eax
+  801ce0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ce3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801ce8:	eb be                	jmp    801ca8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801cea:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ced:	8b 10                	mov    (%eax),%edx
+  801cef:	8b 48 04             	mov    0x4(%eax),%ecx
+  801cf2:	8d 40 08             	lea    0x8(%eax),%eax
+  801cf5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cf8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801cfd:	eb a9                	jmp    801ca8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801cff:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d02:	8b 10                	mov    (%eax),%edx
+  801d04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d09:	8d 40 04             	lea    0x4(%eax),%eax
+  801d0c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d0f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d14:	eb 92                	jmp    801ca8 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  801d16:	83 ec 08             	sub    $0x8,%esp
+  801d19:	53                   	push   %ebx
+  801d1a:	6a 25                	push   $0x25
+  801d1c:	ff d6                	call   *%esi
+			break;
+  801d1e:	83 c4 10             	add    $0x10,%esp
+  801d21:	eb 9f                	jmp    801cc2 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  801d23:	83 ec 08             	sub    $0x8,%esp
+  801d26:	53                   	push   %ebx
+  801d27:	6a 25                	push   $0x25
+  801d29:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d2b:	83 c4 10             	add    $0x10,%esp
+  801d2e:	89 f8                	mov    %edi,%eax
+  801d30:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d34:	74 05                	je     801d3b <vprintfmt+0x44f>
+  801d36:	83 e8 01             	sub    $0x1,%eax
+  801d39:	eb f5                	jmp    801d30 <vprintfmt+0x444>
+  801d3b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d3e:	eb 82                	jmp    801cc2 <vprintfmt+0x3d6>
+
+00801d40 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d40:	55                   	push   %ebp
+  801d41:	89 e5                	mov    %esp,%ebp
+  801d43:	83 ec 18             	sub    $0x18,%esp
+  801d46:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d49:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d4c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d4f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d53:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d56:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d5d:	85 c0                	test   %eax,%eax
+  801d5f:	74 26                	je     801d87 <vsnprintf+0x47>
+  801d61:	85 d2                	test   %edx,%edx
+  801d63:	7e 22                	jle    801d87 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d65:	ff 75 14             	push   0x14(%ebp)
+  801d68:	ff 75 10             	push   0x10(%ebp)
+  801d6b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d6e:	50                   	push   %eax
+  801d6f:	68 b2 18 80 00       	push   $0x8018b2
+  801d74:	e8 73 fb ff ff       	call   8018ec <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d79:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d7c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d82:	83 c4 10             	add    $0x10,%esp
+}
+  801d85:	c9                   	leave
+  801d86:	c3                   	ret
+		return -E_INVAL;
+  801d87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d8c:	eb f7                	jmp    801d85 <vsnprintf+0x45>
+
+00801d8e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d8e:	55                   	push   %ebp
+  801d8f:	89 e5                	mov    %esp,%ebp
+  801d91:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d94:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d97:	50                   	push   %eax
+  801d98:	ff 75 10             	push   0x10(%ebp)
+  801d9b:	ff 75 0c             	push   0xc(%ebp)
+  801d9e:	ff 75 08             	push   0x8(%ebp)
+  801da1:	e8 9a ff ff ff       	call   801d40 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801da6:	c9                   	leave
+  801da7:	c3                   	ret
+
+00801da8 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801da8:	55                   	push   %ebp
+  801da9:	89 e5                	mov    %esp,%ebp
+  801dab:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801dae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db3:	eb 03                	jmp    801db8 <strlen+0x10>
+		n++;
+  801db5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801db8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801dbc:	75 f7                	jne    801db5 <strlen+0xd>
+	return n;
+}
+  801dbe:	5d                   	pop    %ebp
+  801dbf:	c3                   	ret
+
+00801dc0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801dc0:	55                   	push   %ebp
+  801dc1:	89 e5                	mov    %esp,%ebp
+  801dc3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dce:	eb 03                	jmp    801dd3 <strnlen+0x13>
+		n++;
+  801dd0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dd3:	39 d0                	cmp    %edx,%eax
+  801dd5:	74 08                	je     801ddf <strnlen+0x1f>
+  801dd7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801ddb:	75 f3                	jne    801dd0 <strnlen+0x10>
+  801ddd:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801ddf:	89 d0                	mov    %edx,%eax
+  801de1:	5d                   	pop    %ebp
+  801de2:	c3                   	ret
+
+00801de3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801de3:	55                   	push   %ebp
+  801de4:	89 e5                	mov    %esp,%ebp
+  801de6:	53                   	push   %ebx
+  801de7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801dea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801df6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801df9:	83 c0 01             	add    $0x1,%eax
+  801dfc:	84 d2                	test   %dl,%dl
+  801dfe:	75 f2                	jne    801df2 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801e00:	89 c8                	mov    %ecx,%eax
+  801e02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e05:	c9                   	leave
+  801e06:	c3                   	ret
+
+00801e07 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801e07:	55                   	push   %ebp
+  801e08:	89 e5                	mov    %esp,%ebp
+  801e0a:	53                   	push   %ebx
+  801e0b:	83 ec 10             	sub    $0x10,%esp
+  801e0e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e11:	53                   	push   %ebx
+  801e12:	e8 91 ff ff ff       	call   801da8 <strlen>
+  801e17:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e1a:	ff 75 0c             	push   0xc(%ebp)
+  801e1d:	01 d8                	add    %ebx,%eax
+  801e1f:	50                   	push   %eax
+  801e20:	e8 be ff ff ff       	call   801de3 <strcpy>
+	return dst;
+}
+  801e25:	89 d8                	mov    %ebx,%eax
+  801e27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e2a:	c9                   	leave
+  801e2b:	c3                   	ret
+
+00801e2c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e2c:	55                   	push   %ebp
+  801e2d:	89 e5                	mov    %esp,%ebp
+  801e2f:	56                   	push   %esi
+  801e30:	53                   	push   %ebx
+  801e31:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e34:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e37:	89 f3                	mov    %esi,%ebx
+  801e39:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e3c:	89 f0                	mov    %esi,%eax
+  801e3e:	eb 0f                	jmp    801e4f <strncpy+0x23>
+		*dst++ = *src;
+  801e40:	83 c0 01             	add    $0x1,%eax
+  801e43:	0f b6 0a             	movzbl (%edx),%ecx
+  801e46:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e49:	80 f9 01             	cmp    $0x1,%cl
+  801e4c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e4f:	39 d8                	cmp    %ebx,%eax
+  801e51:	75 ed                	jne    801e40 <strncpy+0x14>
+	}
+	return ret;
+}
+  801e53:	89 f0                	mov    %esi,%eax
+  801e55:	5b                   	pop    %ebx
+  801e56:	5e                   	pop    %esi
+  801e57:	5d                   	pop    %ebp
+  801e58:	c3                   	ret
+
+00801e59 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e59:	55                   	push   %ebp
+  801e5a:	89 e5                	mov    %esp,%ebp
+  801e5c:	56                   	push   %esi
+  801e5d:	53                   	push   %ebx
+  801e5e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e64:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e67:	89 f0                	mov    %esi,%eax
+  801e69:	85 d2                	test   %edx,%edx
+  801e6b:	74 21                	je     801e8e <strlcpy+0x35>
+  801e6d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e71:	89 f2                	mov    %esi,%edx
+  801e73:	eb 09                	jmp    801e7e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e75:	83 c1 01             	add    $0x1,%ecx
+  801e78:	83 c2 01             	add    $0x1,%edx
+  801e7b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e7e:	39 c2                	cmp    %eax,%edx
+  801e80:	74 09                	je     801e8b <strlcpy+0x32>
+  801e82:	0f b6 19             	movzbl (%ecx),%ebx
+  801e85:	84 db                	test   %bl,%bl
+  801e87:	75 ec                	jne    801e75 <strlcpy+0x1c>
+  801e89:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e8b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e8e:	29 f0                	sub    %esi,%eax
+}
+  801e90:	5b                   	pop    %ebx
+  801e91:	5e                   	pop    %esi
+  801e92:	5d                   	pop    %ebp
+  801e93:	c3                   	ret
+
+00801e94 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e94:	55                   	push   %ebp
+  801e95:	89 e5                	mov    %esp,%ebp
+  801e97:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801e9d:	eb 06                	jmp    801ea5 <strcmp+0x11>
+		p++, q++;
+  801e9f:	83 c1 01             	add    $0x1,%ecx
+  801ea2:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801ea5:	0f b6 01             	movzbl (%ecx),%eax
+  801ea8:	84 c0                	test   %al,%al
+  801eaa:	74 04                	je     801eb0 <strcmp+0x1c>
+  801eac:	3a 02                	cmp    (%edx),%al
+  801eae:	74 ef                	je     801e9f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801eb0:	0f b6 c0             	movzbl %al,%eax
+  801eb3:	0f b6 12             	movzbl (%edx),%edx
+  801eb6:	29 d0                	sub    %edx,%eax
+}
+  801eb8:	5d                   	pop    %ebp
+  801eb9:	c3                   	ret
+
+00801eba <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801eba:	55                   	push   %ebp
+  801ebb:	89 e5                	mov    %esp,%ebp
+  801ebd:	53                   	push   %ebx
+  801ebe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ec4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801ec7:	eb 09                	jmp    801ed2 <strncmp+0x18>
+		n--, p++, q++;
+  801ec9:	83 ea 01             	sub    $0x1,%edx
+  801ecc:	83 c0 01             	add    $0x1,%eax
+  801ecf:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ed2:	85 d2                	test   %edx,%edx
+  801ed4:	74 18                	je     801eee <strncmp+0x34>
+  801ed6:	0f b6 18             	movzbl (%eax),%ebx
+  801ed9:	84 db                	test   %bl,%bl
+  801edb:	74 04                	je     801ee1 <strncmp+0x27>
+  801edd:	3a 19                	cmp    (%ecx),%bl
+  801edf:	74 e8                	je     801ec9 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ee1:	0f b6 00             	movzbl (%eax),%eax
+  801ee4:	0f b6 11             	movzbl (%ecx),%edx
+  801ee7:	29 d0                	sub    %edx,%eax
+}
+  801ee9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eec:	c9                   	leave
+  801eed:	c3                   	ret
+		return 0;
+  801eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef3:	eb f4                	jmp    801ee9 <strncmp+0x2f>
+
+00801ef5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801ef5:	55                   	push   %ebp
+  801ef6:	89 e5                	mov    %esp,%ebp
+  801ef8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801efb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801eff:	eb 03                	jmp    801f04 <strchr+0xf>
+  801f01:	83 c0 01             	add    $0x1,%eax
+  801f04:	0f b6 10             	movzbl (%eax),%edx
+  801f07:	84 d2                	test   %dl,%dl
+  801f09:	74 06                	je     801f11 <strchr+0x1c>
+		if (*s == c)
+  801f0b:	38 ca                	cmp    %cl,%dl
+  801f0d:	75 f2                	jne    801f01 <strchr+0xc>
+  801f0f:	eb 05                	jmp    801f16 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f16:	5d                   	pop    %ebp
+  801f17:	c3                   	ret
+
+00801f18 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f22:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f25:	38 ca                	cmp    %cl,%dl
+  801f27:	74 09                	je     801f32 <strfind+0x1a>
+  801f29:	84 d2                	test   %dl,%dl
+  801f2b:	74 05                	je     801f32 <strfind+0x1a>
+	for (; *s; s++)
+  801f2d:	83 c0 01             	add    $0x1,%eax
+  801f30:	eb f0                	jmp    801f22 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f32:	5d                   	pop    %ebp
+  801f33:	c3                   	ret
+
+00801f34 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f34:	55                   	push   %ebp
+  801f35:	89 e5                	mov    %esp,%ebp
+  801f37:	57                   	push   %edi
+  801f38:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f3b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f3e:	85 c9                	test   %ecx,%ecx
+  801f40:	74 20                	je     801f62 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f42:	89 f8                	mov    %edi,%eax
+  801f44:	09 c8                	or     %ecx,%eax
+  801f46:	a8 03                	test   $0x3,%al
+  801f48:	75 12                	jne    801f5c <memset+0x28>
+		c &= 0xFF;
+  801f4a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f4e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f54:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f57:	fc                   	cld
+  801f58:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f5a:	eb 06                	jmp    801f62 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f5f:	fc                   	cld
+  801f60:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f62:	89 f8                	mov    %edi,%eax
+  801f64:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f67:	c9                   	leave
+  801f68:	c3                   	ret
+
+00801f69 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f69:	55                   	push   %ebp
+  801f6a:	89 e5                	mov    %esp,%ebp
+  801f6c:	57                   	push   %edi
+  801f6d:	56                   	push   %esi
+  801f6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f71:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f74:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f77:	39 c6                	cmp    %eax,%esi
+  801f79:	73 32                	jae    801fad <memmove+0x44>
+  801f7b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f7e:	39 d0                	cmp    %edx,%eax
+  801f80:	73 2b                	jae    801fad <memmove+0x44>
+		s += n;
+		d += n;
+  801f82:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f85:	89 d6                	mov    %edx,%esi
+  801f87:	09 fe                	or     %edi,%esi
+  801f89:	09 ce                	or     %ecx,%esi
+  801f8b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f91:	75 0e                	jne    801fa1 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f93:	83 ef 04             	sub    $0x4,%edi
+  801f96:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f99:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f9c:	fd                   	std
+  801f9d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f9f:	eb 09                	jmp    801faa <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801fa1:	83 ef 01             	sub    $0x1,%edi
+  801fa4:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801fa7:	fd                   	std
+  801fa8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801faa:	fc                   	cld
+  801fab:	eb 1a                	jmp    801fc7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fad:	89 f2                	mov    %esi,%edx
+  801faf:	09 c2                	or     %eax,%edx
+  801fb1:	09 ca                	or     %ecx,%edx
+  801fb3:	f6 c2 03             	test   $0x3,%dl
+  801fb6:	75 0a                	jne    801fc2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fb8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fbb:	89 c7                	mov    %eax,%edi
+  801fbd:	fc                   	cld
+  801fbe:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fc0:	eb 05                	jmp    801fc7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fc2:	89 c7                	mov    %eax,%edi
+  801fc4:	fc                   	cld
+  801fc5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fc7:	5e                   	pop    %esi
+  801fc8:	5f                   	pop    %edi
+  801fc9:	5d                   	pop    %ebp
+  801fca:	c3                   	ret
+
+00801fcb <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fcb:	55                   	push   %ebp
+  801fcc:	89 e5                	mov    %esp,%ebp
+  801fce:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fd1:	ff 75 10             	push   0x10(%ebp)
+  801fd4:	ff 75 0c             	push   0xc(%ebp)
+  801fd7:	ff 75 08             	push   0x8(%ebp)
+  801fda:	e8 8a ff ff ff       	call   801f69 <memmove>
+}
+  801fdf:	c9                   	leave
+  801fe0:	c3                   	ret
+
+00801fe1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fe1:	55                   	push   %ebp
+  801fe2:	89 e5                	mov    %esp,%ebp
+  801fe4:	56                   	push   %esi
+  801fe5:	53                   	push   %ebx
+  801fe6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fec:	89 c6                	mov    %eax,%esi
+  801fee:	03 75 10             	add    0x10(%ebp),%esi
+  801ff1:	eb 06                	jmp    801ff9 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801ff3:	83 c0 01             	add    $0x1,%eax
+  801ff6:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801ff9:	39 f0                	cmp    %esi,%eax
+  801ffb:	74 14                	je     802011 <memcmp+0x30>
+		if (*s1 != *s2)
+  801ffd:	0f b6 08             	movzbl (%eax),%ecx
+  802000:	0f b6 1a             	movzbl (%edx),%ebx
+  802003:	38 d9                	cmp    %bl,%cl
+  802005:	74 ec                	je     801ff3 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802007:	0f b6 c1             	movzbl %cl,%eax
+  80200a:	0f b6 db             	movzbl %bl,%ebx
+  80200d:	29 d8                	sub    %ebx,%eax
+  80200f:	eb 05                	jmp    802016 <memcmp+0x35>
+	}
+
+	return 0;
+  802011:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802016:	5b                   	pop    %ebx
+  802017:	5e                   	pop    %esi
+  802018:	5d                   	pop    %ebp
+  802019:	c3                   	ret
+
+0080201a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80201a:	55                   	push   %ebp
+  80201b:	89 e5                	mov    %esp,%ebp
+  80201d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802020:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802023:	89 c2                	mov    %eax,%edx
+  802025:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802028:	eb 03                	jmp    80202d <memfind+0x13>
+  80202a:	83 c0 01             	add    $0x1,%eax
+  80202d:	39 d0                	cmp    %edx,%eax
+  80202f:	73 04                	jae    802035 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802031:	38 08                	cmp    %cl,(%eax)
+  802033:	75 f5                	jne    80202a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802035:	5d                   	pop    %ebp
+  802036:	c3                   	ret
+
+00802037 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802037:	55                   	push   %ebp
+  802038:	89 e5                	mov    %esp,%ebp
+  80203a:	57                   	push   %edi
+  80203b:	56                   	push   %esi
+  80203c:	53                   	push   %ebx
+  80203d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802040:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802043:	eb 03                	jmp    802048 <strtol+0x11>
+		s++;
+  802045:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802048:	0f b6 02             	movzbl (%edx),%eax
+  80204b:	3c 20                	cmp    $0x20,%al
+  80204d:	74 f6                	je     802045 <strtol+0xe>
+  80204f:	3c 09                	cmp    $0x9,%al
+  802051:	74 f2                	je     802045 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802053:	3c 2b                	cmp    $0x2b,%al
+  802055:	74 2a                	je     802081 <strtol+0x4a>
+	int neg = 0;
+  802057:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80205c:	3c 2d                	cmp    $0x2d,%al
+  80205e:	74 2b                	je     80208b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802060:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802066:	75 0f                	jne    802077 <strtol+0x40>
+  802068:	80 3a 30             	cmpb   $0x30,(%edx)
+  80206b:	74 28                	je     802095 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80206d:	85 db                	test   %ebx,%ebx
+  80206f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802074:	0f 44 d8             	cmove  %eax,%ebx
+  802077:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80207c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80207f:	eb 46                	jmp    8020c7 <strtol+0x90>
+		s++;
+  802081:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802084:	bf 00 00 00 00       	mov    $0x0,%edi
+  802089:	eb d5                	jmp    802060 <strtol+0x29>
+		s++, neg = 1;
+  80208b:	83 c2 01             	add    $0x1,%edx
+  80208e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802093:	eb cb                	jmp    802060 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802095:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802099:	74 0e                	je     8020a9 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80209b:	85 db                	test   %ebx,%ebx
+  80209d:	75 d8                	jne    802077 <strtol+0x40>
+		s++, base = 8;
+  80209f:	83 c2 01             	add    $0x1,%edx
+  8020a2:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8020a7:	eb ce                	jmp    802077 <strtol+0x40>
+		s += 2, base = 16;
+  8020a9:	83 c2 02             	add    $0x2,%edx
+  8020ac:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020b1:	eb c4                	jmp    802077 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020b3:	0f be c0             	movsbl %al,%eax
+  8020b6:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020b9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020bc:	7d 3a                	jge    8020f8 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020be:	83 c2 01             	add    $0x1,%edx
+  8020c1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020c5:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020c7:	0f b6 02             	movzbl (%edx),%eax
+  8020ca:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020cd:	89 f3                	mov    %esi,%ebx
+  8020cf:	80 fb 09             	cmp    $0x9,%bl
+  8020d2:	76 df                	jbe    8020b3 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020d4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020d7:	89 f3                	mov    %esi,%ebx
+  8020d9:	80 fb 19             	cmp    $0x19,%bl
+  8020dc:	77 08                	ja     8020e6 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020de:	0f be c0             	movsbl %al,%eax
+  8020e1:	83 e8 57             	sub    $0x57,%eax
+  8020e4:	eb d3                	jmp    8020b9 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020e6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020e9:	89 f3                	mov    %esi,%ebx
+  8020eb:	80 fb 19             	cmp    $0x19,%bl
+  8020ee:	77 08                	ja     8020f8 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020f0:	0f be c0             	movsbl %al,%eax
+  8020f3:	83 e8 37             	sub    $0x37,%eax
+  8020f6:	eb c1                	jmp    8020b9 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020f8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020fc:	74 05                	je     802103 <strtol+0xcc>
+		*endptr = (char *) s;
+  8020fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802101:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802103:	89 c8                	mov    %ecx,%eax
+  802105:	f7 d8                	neg    %eax
+  802107:	85 ff                	test   %edi,%edi
+  802109:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80210c:	89 c8                	mov    %ecx,%eax
+  80210e:	5b                   	pop    %ebx
+  80210f:	5e                   	pop    %esi
+  802110:	5f                   	pop    %edi
+  802111:	5d                   	pop    %ebp
+  802112:	c3                   	ret
+
+00802113 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802113:	55                   	push   %ebp
+  802114:	89 e5                	mov    %esp,%ebp
+  802116:	57                   	push   %edi
+  802117:	56                   	push   %esi
+  802118:	53                   	push   %ebx
+  802119:	83 ec 18             	sub    $0x18,%esp
+  80211c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80211f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802122:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802125:	85 db                	test   %ebx,%ebx
+  802127:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80212c:	0f 45 c3             	cmovne %ebx,%eax
+  80212f:	50                   	push   %eax
+  802130:	e8 32 e4 ff ff       	call   800567 <sys_ipc_recv>
+
+	if (from_env_store)
+  802135:	83 c4 10             	add    $0x10,%esp
+  802138:	85 ff                	test   %edi,%edi
+  80213a:	74 17                	je     802153 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80213c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802141:	85 c0                	test   %eax,%eax
+  802143:	75 0c                	jne    802151 <ipc_recv+0x3e>
+  802145:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80214b:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802151:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802153:	85 f6                	test   %esi,%esi
+  802155:	74 2e                	je     802185 <ipc_recv+0x72>
+		if (!r && pg)
+  802157:	85 c0                	test   %eax,%eax
+  802159:	75 24                	jne    80217f <ipc_recv+0x6c>
+  80215b:	85 db                	test   %ebx,%ebx
+  80215d:	74 20                	je     80217f <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  80215f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802164:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  80216a:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80216c:	a1 08 40 80 00       	mov    0x804008,%eax
+  802171:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802177:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80217a:	5b                   	pop    %ebx
+  80217b:	5e                   	pop    %esi
+  80217c:	5f                   	pop    %edi
+  80217d:	5d                   	pop    %ebp
+  80217e:	c3                   	ret
+			*perm_store = 0;
+  80217f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802185:	85 c0                	test   %eax,%eax
+  802187:	75 ee                	jne    802177 <ipc_recv+0x64>
+  802189:	eb e1                	jmp    80216c <ipc_recv+0x59>
+
+0080218b <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80218b:	55                   	push   %ebp
+  80218c:	89 e5                	mov    %esp,%ebp
+  80218e:	57                   	push   %edi
+  80218f:	56                   	push   %esi
+  802190:	53                   	push   %ebx
+  802191:	83 ec 0c             	sub    $0xc,%esp
+  802194:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802197:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80219a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80219d:	85 db                	test   %ebx,%ebx
+  80219f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021a4:	0f 44 d8             	cmove  %eax,%ebx
+  8021a7:	ff 75 14             	push   0x14(%ebp)
+  8021aa:	53                   	push   %ebx
+  8021ab:	56                   	push   %esi
+  8021ac:	57                   	push   %edi
+  8021ad:	e8 92 e3 ff ff       	call   800544 <sys_ipc_try_send_yield>
+  8021b2:	83 c4 10             	add    $0x10,%esp
+  8021b5:	85 c0                	test   %eax,%eax
+  8021b7:	79 1e                	jns    8021d7 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8021b9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021bc:	75 07                	jne    8021c5 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8021be:	e8 a1 df ff ff       	call   800164 <sys_yield>
+  8021c3:	eb e2                	jmp    8021a7 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8021c5:	50                   	push   %eax
+  8021c6:	68 ff 2a 80 00       	push   $0x802aff
+  8021cb:	6a 3d                	push   $0x3d
+  8021cd:	68 14 2b 80 00       	push   $0x802b14
+  8021d2:	e8 43 f5 ff ff       	call   80171a <_panic>
+	}
+}
+  8021d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021da:	5b                   	pop    %ebx
+  8021db:	5e                   	pop    %esi
+  8021dc:	5f                   	pop    %edi
+  8021dd:	5d                   	pop    %ebp
+  8021de:	c3                   	ret
+
+008021df <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8021df:	55                   	push   %ebp
+  8021e0:	89 e5                	mov    %esp,%ebp
+  8021e2:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8021e5:	ff 75 08             	push   0x8(%ebp)
+  8021e8:	e8 f7 de ff ff       	call   8000e4 <sys_env_find>
+}
+  8021ed:	c9                   	leave
+  8021ee:	c3                   	ret
+
+008021ef <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8021ef:	55                   	push   %ebp
+  8021f0:	89 e5                	mov    %esp,%ebp
+  8021f2:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021f5:	89 c2                	mov    %eax,%edx
+  8021f7:	c1 ea 16             	shr    $0x16,%edx
+  8021fa:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802201:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802206:	f6 c1 01             	test   $0x1,%cl
+  802209:	74 22                	je     80222d <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80220b:	c1 e8 0c             	shr    $0xc,%eax
+  80220e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802215:	a8 01                	test   $0x1,%al
+  802217:	74 14                	je     80222d <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802219:	c1 e8 0c             	shr    $0xc,%eax
+  80221c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80221f:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802226:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80222a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80222d:	89 d0                	mov    %edx,%eax
+  80222f:	5d                   	pop    %ebp
+  802230:	c3                   	ret
+  802231:	66 90                	xchg   %ax,%ax
+  802233:	66 90                	xchg   %ax,%ax
+  802235:	66 90                	xchg   %ax,%ax
+  802237:	66 90                	xchg   %ax,%ax
+  802239:	66 90                	xchg   %ax,%ax
+  80223b:	66 90                	xchg   %ax,%ax
+  80223d:	66 90                	xchg   %ax,%ax
+  80223f:	90                   	nop
+
+00802240 <__udivmoddi4>:
+  802240:	55                   	push   %ebp
+  802241:	57                   	push   %edi
+  802242:	56                   	push   %esi
+  802243:	53                   	push   %ebx
+  802244:	83 ec 14             	sub    $0x14,%esp
+  802247:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80224b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80224f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802253:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802257:	89 f1                	mov    %esi,%ecx
+  802259:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80225d:	09 d9                	or     %ebx,%ecx
+  80225f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802263:	0f 84 92 00 00 00    	je     8022fb <__udivmoddi4+0xbb>
+  802269:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802270:	00 
+  802271:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802276:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80227d:	00 
+  80227e:	89 1c 24             	mov    %ebx,(%esp)
+  802281:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802285:	8d 76 00             	lea    0x0(%esi),%esi
+  802288:	89 e9                	mov    %ebp,%ecx
+  80228a:	89 c3                	mov    %eax,%ebx
+  80228c:	89 d6                	mov    %edx,%esi
+  80228e:	31 ff                	xor    %edi,%edi
+  802290:	d3 ee                	shr    %cl,%esi
+  802292:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802295:	f6 c1 20             	test   $0x20,%cl
+  802298:	0f 45 de             	cmovne %esi,%ebx
+  80229b:	0f 45 f7             	cmovne %edi,%esi
+  80229e:	8b 3c 24             	mov    (%esp),%edi
+  8022a1:	39 fb                	cmp    %edi,%ebx
+  8022a3:	89 f7                	mov    %esi,%edi
+  8022a5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8022a9:	8b 1c 24             	mov    (%esp),%ebx
+  8022ac:	19 f7                	sbb    %esi,%edi
+  8022ae:	72 39                	jb     8022e9 <__udivmoddi4+0xa9>
+  8022b0:	89 e9                	mov    %ebp,%ecx
+  8022b2:	89 f7                	mov    %esi,%edi
+  8022b4:	89 de                	mov    %ebx,%esi
+  8022b6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8022b9:	d3 e6                	shl    %cl,%esi
+  8022bb:	31 db                	xor    %ebx,%ebx
+  8022bd:	f6 c1 20             	test   $0x20,%cl
+  8022c0:	0f 45 fe             	cmovne %esi,%edi
+  8022c3:	0f 45 f3             	cmovne %ebx,%esi
+  8022c6:	29 f0                	sub    %esi,%eax
+  8022c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022cd:	19 fa                	sbb    %edi,%edx
+  8022cf:	31 ff                	xor    %edi,%edi
+  8022d1:	31 db                	xor    %ebx,%ebx
+  8022d3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8022d6:	d3 e6                	shl    %cl,%esi
+  8022d8:	f6 c1 20             	test   $0x20,%cl
+  8022db:	0f 45 fe             	cmovne %esi,%edi
+  8022de:	0f 45 f3             	cmovne %ebx,%esi
+  8022e1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8022e5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8022e9:	83 ed 01             	sub    $0x1,%ebp
+  8022ec:	73 9a                	jae    802288 <__udivmoddi4+0x48>
+  8022ee:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8022f2:	85 ff                	test   %edi,%edi
+  8022f4:	74 05                	je     8022fb <__udivmoddi4+0xbb>
+  8022f6:	89 07                	mov    %eax,(%edi)
+  8022f8:	89 57 04             	mov    %edx,0x4(%edi)
+  8022fb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022ff:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802303:	83 c4 14             	add    $0x14,%esp
+  802306:	5b                   	pop    %ebx
+  802307:	5e                   	pop    %esi
+  802308:	5f                   	pop    %edi
+  802309:	5d                   	pop    %ebp
+  80230a:	c3                   	ret
+  80230b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80230f:	90                   	nop
+
+00802310 <__udivdi3>:
+  802310:	55                   	push   %ebp
+  802311:	57                   	push   %edi
+  802312:	56                   	push   %esi
+  802313:	53                   	push   %ebx
+  802314:	83 ec 14             	sub    $0x14,%esp
+  802317:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80231b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80231f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802323:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802327:	89 fb                	mov    %edi,%ebx
+  802329:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80232d:	09 f3                	or     %esi,%ebx
+  80232f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802333:	0f 84 85 00 00 00    	je     8023be <__udivdi3+0xae>
+  802339:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802340:	00 
+  802341:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802346:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80234d:	00 
+  80234e:	89 34 24             	mov    %esi,(%esp)
+  802351:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802355:	8d 76 00             	lea    0x0(%esi),%esi
+  802358:	89 e9                	mov    %ebp,%ecx
+  80235a:	89 c3                	mov    %eax,%ebx
+  80235c:	89 d6                	mov    %edx,%esi
+  80235e:	31 ff                	xor    %edi,%edi
+  802360:	d3 ee                	shr    %cl,%esi
+  802362:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802365:	f6 c1 20             	test   $0x20,%cl
+  802368:	0f 45 de             	cmovne %esi,%ebx
+  80236b:	0f 45 f7             	cmovne %edi,%esi
+  80236e:	8b 3c 24             	mov    (%esp),%edi
+  802371:	39 fb                	cmp    %edi,%ebx
+  802373:	89 f7                	mov    %esi,%edi
+  802375:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802379:	8b 1c 24             	mov    (%esp),%ebx
+  80237c:	19 f7                	sbb    %esi,%edi
+  80237e:	72 39                	jb     8023b9 <__udivdi3+0xa9>
+  802380:	89 e9                	mov    %ebp,%ecx
+  802382:	89 f7                	mov    %esi,%edi
+  802384:	89 de                	mov    %ebx,%esi
+  802386:	0f a5 df             	shld   %cl,%ebx,%edi
+  802389:	d3 e6                	shl    %cl,%esi
+  80238b:	31 db                	xor    %ebx,%ebx
+  80238d:	f6 c1 20             	test   $0x20,%cl
+  802390:	0f 45 fe             	cmovne %esi,%edi
+  802393:	0f 45 f3             	cmovne %ebx,%esi
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	be 01 00 00 00       	mov    $0x1,%esi
+  80239d:	19 fa                	sbb    %edi,%edx
+  80239f:	31 ff                	xor    %edi,%edi
+  8023a1:	31 db                	xor    %ebx,%ebx
+  8023a3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023a6:	d3 e6                	shl    %cl,%esi
+  8023a8:	f6 c1 20             	test   $0x20,%cl
+  8023ab:	0f 45 fe             	cmovne %esi,%edi
+  8023ae:	0f 45 f3             	cmovne %ebx,%esi
+  8023b1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023b5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023b9:	83 ed 01             	sub    $0x1,%ebp
+  8023bc:	73 9a                	jae    802358 <__udivdi3+0x48>
+  8023be:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023c2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023c6:	83 c4 14             	add    $0x14,%esp
+  8023c9:	5b                   	pop    %ebx
+  8023ca:	5e                   	pop    %esi
+  8023cb:	5f                   	pop    %edi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+  8023ce:	66 90                	xchg   %ax,%ax
+
+008023d0 <__umoddi3>:
+  8023d0:	57                   	push   %edi
+  8023d1:	56                   	push   %esi
+  8023d2:	53                   	push   %ebx
+  8023d3:	83 ec 08             	sub    $0x8,%esp
+  8023d6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8023da:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8023de:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023e2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023e6:	89 f9                	mov    %edi,%ecx
+  8023e8:	89 34 24             	mov    %esi,(%esp)
+  8023eb:	09 f1                	or     %esi,%ecx
+  8023ed:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023f1:	74 53                	je     802446 <__umoddi3+0x76>
+  8023f3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023ff:	90                   	nop
+  802400:	89 c6                	mov    %eax,%esi
+  802402:	89 d7                	mov    %edx,%edi
+  802404:	31 db                	xor    %ebx,%ebx
+  802406:	d3 ef                	shr    %cl,%edi
+  802408:	0f ad d6             	shrd   %cl,%edx,%esi
+  80240b:	f6 c1 20             	test   $0x20,%cl
+  80240e:	0f 45 f7             	cmovne %edi,%esi
+  802411:	0f 45 fb             	cmovne %ebx,%edi
+  802414:	8b 1c 24             	mov    (%esp),%ebx
+  802417:	39 de                	cmp    %ebx,%esi
+  802419:	89 fb                	mov    %edi,%ebx
+  80241b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80241f:	8b 34 24             	mov    (%esp),%esi
+  802422:	19 fb                	sbb    %edi,%ebx
+  802424:	72 14                	jb     80243a <__umoddi3+0x6a>
+  802426:	0f a5 f7             	shld   %cl,%esi,%edi
+  802429:	31 db                	xor    %ebx,%ebx
+  80242b:	d3 e6                	shl    %cl,%esi
+  80242d:	f6 c1 20             	test   $0x20,%cl
+  802430:	0f 45 fe             	cmovne %esi,%edi
+  802433:	0f 45 f3             	cmovne %ebx,%esi
+  802436:	29 f0                	sub    %esi,%eax
+  802438:	19 fa                	sbb    %edi,%edx
+  80243a:	83 e9 01             	sub    $0x1,%ecx
+  80243d:	73 c1                	jae    802400 <__umoddi3+0x30>
+  80243f:	83 c4 08             	add    $0x8,%esp
+  802442:	5b                   	pop    %ebx
+  802443:	5e                   	pop    %esi
+  802444:	5f                   	pop    %edi
+  802445:	c3                   	ret
+  802446:	83 c4 08             	add    $0x8,%esp
+  802449:	31 c0                	xor    %eax,%eax
+  80244b:	31 d2                	xor    %edx,%edx
+  80244d:	5b                   	pop    %ebx
+  80244e:	5e                   	pop    %esi
+  80244f:	5f                   	pop    %edi
+  802450:	c3                   	ret
+  802451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80245f:	90                   	nop
+
+00802460 <__divdi3>:
+  802460:	55                   	push   %ebp
+  802461:	57                   	push   %edi
+  802462:	56                   	push   %esi
+  802463:	53                   	push   %ebx
+  802464:	83 ec 1c             	sub    $0x1c,%esp
+  802467:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80246b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80246f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802473:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802477:	85 ff                	test   %edi,%edi
+  802479:	0f 88 da 00 00 00    	js     802559 <__divdi3+0xf9>
+  80247f:	85 db                	test   %ebx,%ebx
+  802481:	78 16                	js     802499 <__divdi3+0x39>
+  802483:	89 dd                	mov    %ebx,%ebp
+  802485:	89 c8                	mov    %ecx,%eax
+  802487:	89 da                	mov    %ebx,%edx
+  802489:	09 cd                	or     %ecx,%ebp
+  80248b:	0f 85 fd 00 00 00    	jne    80258e <__divdi3+0x12e>
+  802491:	83 c4 1c             	add    $0x1c,%esp
+  802494:	5b                   	pop    %ebx
+  802495:	5e                   	pop    %esi
+  802496:	5f                   	pop    %edi
+  802497:	5d                   	pop    %ebp
+  802498:	c3                   	ret
+  802499:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80249e:	f7 d9                	neg    %ecx
+  8024a0:	89 f0                	mov    %esi,%eax
+  8024a2:	89 fa                	mov    %edi,%edx
+  8024a4:	83 d3 00             	adc    $0x0,%ebx
+  8024a7:	89 0c 24             	mov    %ecx,(%esp)
+  8024aa:	f7 db                	neg    %ebx
+  8024ac:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8024b0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024b7:	00 
+  8024b8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024bd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024c4:	00 
+  8024c5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024c9:	89 cd                	mov    %ecx,%ebp
+  8024cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024cf:	90                   	nop
+  8024d0:	89 e9                	mov    %ebp,%ecx
+  8024d2:	89 c3                	mov    %eax,%ebx
+  8024d4:	89 d6                	mov    %edx,%esi
+  8024d6:	31 ff                	xor    %edi,%edi
+  8024d8:	d3 ee                	shr    %cl,%esi
+  8024da:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024dd:	f6 c1 20             	test   $0x20,%cl
+  8024e0:	0f 45 de             	cmovne %esi,%ebx
+  8024e3:	0f 45 f7             	cmovne %edi,%esi
+  8024e6:	8b 3c 24             	mov    (%esp),%edi
+  8024e9:	39 fb                	cmp    %edi,%ebx
+  8024eb:	89 f7                	mov    %esi,%edi
+  8024ed:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8024f1:	8b 1c 24             	mov    (%esp),%ebx
+  8024f4:	19 f7                	sbb    %esi,%edi
+  8024f6:	72 39                	jb     802531 <__divdi3+0xd1>
+  8024f8:	89 e9                	mov    %ebp,%ecx
+  8024fa:	89 f7                	mov    %esi,%edi
+  8024fc:	89 de                	mov    %ebx,%esi
+  8024fe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802501:	d3 e6                	shl    %cl,%esi
+  802503:	31 db                	xor    %ebx,%ebx
+  802505:	f6 c1 20             	test   $0x20,%cl
+  802508:	0f 45 fe             	cmovne %esi,%edi
+  80250b:	0f 45 f3             	cmovne %ebx,%esi
+  80250e:	29 f0                	sub    %esi,%eax
+  802510:	be 01 00 00 00       	mov    $0x1,%esi
+  802515:	19 fa                	sbb    %edi,%edx
+  802517:	31 ff                	xor    %edi,%edi
+  802519:	31 db                	xor    %ebx,%ebx
+  80251b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80251e:	d3 e6                	shl    %cl,%esi
+  802520:	f6 c1 20             	test   $0x20,%cl
+  802523:	0f 45 fe             	cmovne %esi,%edi
+  802526:	0f 45 f3             	cmovne %ebx,%esi
+  802529:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80252d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802531:	83 ed 01             	sub    $0x1,%ebp
+  802534:	73 9a                	jae    8024d0 <__divdi3+0x70>
+  802536:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80253a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80253e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802542:	85 ed                	test   %ebp,%ebp
+  802544:	0f 84 47 ff ff ff    	je     802491 <__divdi3+0x31>
+  80254a:	f7 d8                	neg    %eax
+  80254c:	83 d2 00             	adc    $0x0,%edx
+  80254f:	83 c4 1c             	add    $0x1c,%esp
+  802552:	5b                   	pop    %ebx
+  802553:	f7 da                	neg    %edx
+  802555:	5e                   	pop    %esi
+  802556:	5f                   	pop    %edi
+  802557:	5d                   	pop    %ebp
+  802558:	c3                   	ret
+  802559:	f7 de                	neg    %esi
+  80255b:	83 d7 00             	adc    $0x0,%edi
+  80255e:	f7 df                	neg    %edi
+  802560:	85 db                	test   %ebx,%ebx
+  802562:	78 23                	js     802587 <__divdi3+0x127>
+  802564:	89 dd                	mov    %ebx,%ebp
+  802566:	89 c8                	mov    %ecx,%eax
+  802568:	89 da                	mov    %ebx,%edx
+  80256a:	09 cd                	or     %ecx,%ebp
+  80256c:	0f 84 1f ff ff ff    	je     802491 <__divdi3+0x31>
+  802572:	89 0c 24             	mov    %ecx,(%esp)
+  802575:	89 f0                	mov    %esi,%eax
+  802577:	89 fa                	mov    %edi,%edx
+  802579:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80257e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802582:	e9 29 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+  802587:	31 ed                	xor    %ebp,%ebp
+  802589:	e9 10 ff ff ff       	jmp    80249e <__divdi3+0x3e>
+  80258e:	89 0c 24             	mov    %ecx,(%esp)
+  802591:	89 f0                	mov    %esi,%eax
+  802593:	89 fa                	mov    %edi,%edx
+  802595:	31 ed                	xor    %ebp,%ebp
+  802597:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80259b:	e9 10 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+
+008025a0 <__moddi3>:
+  8025a0:	55                   	push   %ebp
+  8025a1:	57                   	push   %edi
+  8025a2:	56                   	push   %esi
+  8025a3:	53                   	push   %ebx
+  8025a4:	83 ec 14             	sub    $0x14,%esp
+  8025a7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025ab:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025af:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8025b3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8025b7:	85 d2                	test   %edx,%edx
+  8025b9:	0f 88 9b 00 00 00    	js     80265a <__moddi3+0xba>
+  8025bf:	89 f7                	mov    %esi,%edi
+  8025c1:	31 ed                	xor    %ebp,%ebp
+  8025c3:	09 cf                	or     %ecx,%edi
+  8025c5:	0f 84 83 00 00 00    	je     80264e <__moddi3+0xae>
+  8025cb:	89 cb                	mov    %ecx,%ebx
+  8025cd:	89 f7                	mov    %esi,%edi
+  8025cf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8025d3:	f7 db                	neg    %ebx
+  8025d5:	83 d7 00             	adc    $0x0,%edi
+  8025d8:	f7 df                	neg    %edi
+  8025da:	0f 49 f7             	cmovns %edi,%esi
+  8025dd:	0f 49 cb             	cmovns %ebx,%ecx
+  8025e0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025e4:	89 0c 24             	mov    %ecx,(%esp)
+  8025e7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025ec:	89 cd                	mov    %ecx,%ebp
+  8025ee:	66 90                	xchg   %ax,%ax
+  8025f0:	89 e9                	mov    %ebp,%ecx
+  8025f2:	89 c3                	mov    %eax,%ebx
+  8025f4:	89 d6                	mov    %edx,%esi
+  8025f6:	31 ff                	xor    %edi,%edi
+  8025f8:	d3 ee                	shr    %cl,%esi
+  8025fa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025fd:	f6 c1 20             	test   $0x20,%cl
+  802600:	0f 45 de             	cmovne %esi,%ebx
+  802603:	0f 45 f7             	cmovne %edi,%esi
+  802606:	8b 3c 24             	mov    (%esp),%edi
+  802609:	39 fb                	cmp    %edi,%ebx
+  80260b:	89 f7                	mov    %esi,%edi
+  80260d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802611:	8b 1c 24             	mov    (%esp),%ebx
+  802614:	19 f7                	sbb    %esi,%edi
+  802616:	72 1a                	jb     802632 <__moddi3+0x92>
+  802618:	89 e9                	mov    %ebp,%ecx
+  80261a:	89 f7                	mov    %esi,%edi
+  80261c:	89 de                	mov    %ebx,%esi
+  80261e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802621:	d3 e6                	shl    %cl,%esi
+  802623:	31 db                	xor    %ebx,%ebx
+  802625:	f6 c1 20             	test   $0x20,%cl
+  802628:	0f 45 fe             	cmovne %esi,%edi
+  80262b:	0f 45 f3             	cmovne %ebx,%esi
+  80262e:	29 f0                	sub    %esi,%eax
+  802630:	19 fa                	sbb    %edi,%edx
+  802632:	83 ed 01             	sub    $0x1,%ebp
+  802635:	73 b9                	jae    8025f0 <__moddi3+0x50>
+  802637:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80263b:	85 ed                	test   %ebp,%ebp
+  80263d:	74 07                	je     802646 <__moddi3+0xa6>
+  80263f:	f7 d8                	neg    %eax
+  802641:	83 d2 00             	adc    $0x0,%edx
+  802644:	f7 da                	neg    %edx
+  802646:	83 c4 14             	add    $0x14,%esp
+  802649:	5b                   	pop    %ebx
+  80264a:	5e                   	pop    %esi
+  80264b:	5f                   	pop    %edi
+  80264c:	5d                   	pop    %ebp
+  80264d:	c3                   	ret
+  80264e:	83 c4 14             	add    $0x14,%esp
+  802651:	31 c0                	xor    %eax,%eax
+  802653:	31 d2                	xor    %edx,%edx
+  802655:	5b                   	pop    %ebx
+  802656:	5e                   	pop    %esi
+  802657:	5f                   	pop    %edi
+  802658:	5d                   	pop    %ebp
+  802659:	c3                   	ret
+  80265a:	89 f7                	mov    %esi,%edi
+  80265c:	09 cf                	or     %ecx,%edi
+  80265e:	74 11                	je     802671 <__moddi3+0xd1>
+  802660:	f7 d8                	neg    %eax
+  802662:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802667:	83 d2 00             	adc    $0x0,%edx
+  80266a:	f7 da                	neg    %edx
+  80266c:	e9 5a ff ff ff       	jmp    8025cb <__moddi3+0x2b>
+  802671:	31 c0                	xor    %eax,%eax
+  802673:	31 d2                	xor    %edx,%edx
+  802675:	eb c8                	jmp    80263f <__moddi3+0x9f>
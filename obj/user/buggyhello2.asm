@@ -0,0 +1,5562 @@
+
+obj/user/buggyhello2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs(hello, 1024*1024);
+  800039:	68 00 00 10 00       	push   $0x100000
+  80003e:	ff 35 00 30 80 00    	push   0x803000
+  800044:	e8 65 00 00 00       	call   8000ae <sys_cputs>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800059:	e8 ee 00 00 00       	call   80014c <sys_getenvid>
+  80005e:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800063:	c1 e0 09             	shl    $0x9,%eax
+  800066:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006b:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800070:	85 db                	test   %ebx,%ebx
+  800072:	7e 07                	jle    80007b <libmain+0x2d>
+		binaryname = argv[0];
+  800074:	8b 06                	mov    (%esi),%eax
+  800076:	a3 04 30 80 00       	mov    %eax,0x803004
+
+	// call user main routine
+	umain(argc, argv);
+  80007b:	83 ec 08             	sub    $0x8,%esp
+  80007e:	56                   	push   %esi
+  80007f:	53                   	push   %ebx
+  800080:	e8 ae ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800085:	e8 0a 00 00 00       	call   800094 <exit>
+}
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800090:	5b                   	pop    %ebx
+  800091:	5e                   	pop    %esi
+  800092:	5d                   	pop    %ebp
+  800093:	c3                   	ret
+
+00800094 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800094:	55                   	push   %ebp
+  800095:	89 e5                	mov    %esp,%ebp
+  800097:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80009a:	e8 45 07 00 00       	call   8007e4 <close_all>
+	sys_env_destroy(0);
+  80009f:	83 ec 0c             	sub    $0xc,%esp
+  8000a2:	6a 00                	push   $0x0
+  8000a4:	e8 62 00 00 00       	call   80010b <sys_env_destroy>
+}
+  8000a9:	83 c4 10             	add    $0x10,%esp
+  8000ac:	c9                   	leave
+  8000ad:	c3                   	ret
+
+008000ae <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000ae:	55                   	push   %ebp
+  8000af:	89 e5                	mov    %esp,%ebp
+  8000b1:	57                   	push   %edi
+  8000b2:	56                   	push   %esi
+  8000b3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000bf:	89 c3                	mov    %eax,%ebx
+  8000c1:	89 c7                	mov    %eax,%edi
+  8000c3:	89 c6                	mov    %eax,%esi
+  8000c5:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000c7:	5b                   	pop    %ebx
+  8000c8:	5e                   	pop    %esi
+  8000c9:	5f                   	pop    %edi
+  8000ca:	5d                   	pop    %ebp
+  8000cb:	c3                   	ret
+
+008000cc <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000cc:	55                   	push   %ebp
+  8000cd:	89 e5                	mov    %esp,%ebp
+  8000cf:	57                   	push   %edi
+  8000d0:	56                   	push   %esi
+  8000d1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000dc:	89 d1                	mov    %edx,%ecx
+  8000de:	89 d3                	mov    %edx,%ebx
+  8000e0:	89 d7                	mov    %edx,%edi
+  8000e2:	89 d6                	mov    %edx,%esi
+  8000e4:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+
+008000eb <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8000fe:	89 cb                	mov    %ecx,%ebx
+  800100:	89 cf                	mov    %ecx,%edi
+  800102:	89 ce                	mov    %ecx,%esi
+  800104:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800106:	5b                   	pop    %ebx
+  800107:	5e                   	pop    %esi
+  800108:	5f                   	pop    %edi
+  800109:	5d                   	pop    %ebp
+  80010a:	c3                   	ret
+
+0080010b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80010b:	55                   	push   %ebp
+  80010c:	89 e5                	mov    %esp,%ebp
+  80010e:	57                   	push   %edi
+  80010f:	56                   	push   %esi
+  800110:	53                   	push   %ebx
+  800111:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800114:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800119:	8b 55 08             	mov    0x8(%ebp),%edx
+  80011c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800121:	89 cb                	mov    %ecx,%ebx
+  800123:	89 cf                	mov    %ecx,%edi
+  800125:	89 ce                	mov    %ecx,%esi
+  800127:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800129:	85 c0                	test   %eax,%eax
+  80012b:	7f 08                	jg     800135 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80012d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800130:	5b                   	pop    %ebx
+  800131:	5e                   	pop    %esi
+  800132:	5f                   	pop    %edi
+  800133:	5d                   	pop    %ebp
+  800134:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800135:	83 ec 0c             	sub    $0xc,%esp
+  800138:	50                   	push   %eax
+  800139:	6a 03                	push   $0x3
+  80013b:	68 98 26 80 00       	push   $0x802698
+  800140:	6a 23                	push   $0x23
+  800142:	68 b5 26 80 00       	push   $0x8026b5
+  800147:	e8 d5 15 00 00       	call   801721 <_panic>
+
+0080014c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	57                   	push   %edi
+  800150:	56                   	push   %esi
+  800151:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800152:	ba 00 00 00 00       	mov    $0x0,%edx
+  800157:	b8 02 00 00 00       	mov    $0x2,%eax
+  80015c:	89 d1                	mov    %edx,%ecx
+  80015e:	89 d3                	mov    %edx,%ebx
+  800160:	89 d7                	mov    %edx,%edi
+  800162:	89 d6                	mov    %edx,%esi
+  800164:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800166:	5b                   	pop    %ebx
+  800167:	5e                   	pop    %esi
+  800168:	5f                   	pop    %edi
+  800169:	5d                   	pop    %ebp
+  80016a:	c3                   	ret
+
+0080016b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80016b:	55                   	push   %ebp
+  80016c:	89 e5                	mov    %esp,%ebp
+  80016e:	57                   	push   %edi
+  80016f:	56                   	push   %esi
+  800170:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800171:	ba 00 00 00 00       	mov    $0x0,%edx
+  800176:	b8 16 00 00 00       	mov    $0x16,%eax
+  80017b:	89 d1                	mov    %edx,%ecx
+  80017d:	89 d3                	mov    %edx,%ebx
+  80017f:	89 d7                	mov    %edx,%edi
+  800181:	89 d6                	mov    %edx,%esi
+  800183:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800185:	5b                   	pop    %ebx
+  800186:	5e                   	pop    %esi
+  800187:	5f                   	pop    %edi
+  800188:	5d                   	pop    %ebp
+  800189:	c3                   	ret
+
+0080018a <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  80018a:	55                   	push   %ebp
+  80018b:	89 e5                	mov    %esp,%ebp
+  80018d:	57                   	push   %edi
+  80018e:	56                   	push   %esi
+  80018f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800190:	ba 00 00 00 00       	mov    $0x0,%edx
+  800195:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80019a:	89 d1                	mov    %edx,%ecx
+  80019c:	89 d3                	mov    %edx,%ebx
+  80019e:	89 d7                	mov    %edx,%edi
+  8001a0:	89 d6                	mov    %edx,%esi
+  8001a2:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  8001a4:	5b                   	pop    %ebx
+  8001a5:	5e                   	pop    %esi
+  8001a6:	5f                   	pop    %edi
+  8001a7:	5d                   	pop    %ebp
+  8001a8:	c3                   	ret
+
+008001a9 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  8001a9:	55                   	push   %ebp
+  8001aa:	89 e5                	mov    %esp,%ebp
+  8001ac:	57                   	push   %edi
+  8001ad:	56                   	push   %esi
+  8001ae:	53                   	push   %ebx
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001bd:	b8 15 00 00 00       	mov    $0x15,%eax
+  8001c2:	89 df                	mov    %ebx,%edi
+  8001c4:	89 de                	mov    %ebx,%esi
+  8001c6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001c8:	85 c0                	test   %eax,%eax
+  8001ca:	7f 08                	jg     8001d4 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  8001cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001cf:	5b                   	pop    %ebx
+  8001d0:	5e                   	pop    %esi
+  8001d1:	5f                   	pop    %edi
+  8001d2:	5d                   	pop    %ebp
+  8001d3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001d4:	83 ec 0c             	sub    $0xc,%esp
+  8001d7:	50                   	push   %eax
+  8001d8:	6a 15                	push   $0x15
+  8001da:	68 98 26 80 00       	push   $0x802698
+  8001df:	6a 23                	push   $0x23
+  8001e1:	68 b5 26 80 00       	push   $0x8026b5
+  8001e6:	e8 36 15 00 00       	call   801721 <_panic>
+
+008001eb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001eb:	55                   	push   %ebp
+  8001ec:	89 e5                	mov    %esp,%ebp
+  8001ee:	57                   	push   %edi
+  8001ef:	56                   	push   %esi
+  8001f0:	53                   	push   %ebx
+  8001f1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ff:	b8 05 00 00 00       	mov    $0x5,%eax
+  800204:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800207:	89 f7                	mov    %esi,%edi
+  800209:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80020b:	85 c0                	test   %eax,%eax
+  80020d:	7f 08                	jg     800217 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80020f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800212:	5b                   	pop    %ebx
+  800213:	5e                   	pop    %esi
+  800214:	5f                   	pop    %edi
+  800215:	5d                   	pop    %ebp
+  800216:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	50                   	push   %eax
+  80021b:	6a 05                	push   $0x5
+  80021d:	68 98 26 80 00       	push   $0x802698
+  800222:	6a 23                	push   $0x23
+  800224:	68 b5 26 80 00       	push   $0x8026b5
+  800229:	e8 f3 14 00 00       	call   801721 <_panic>
+
+0080022e <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  80022e:	55                   	push   %ebp
+  80022f:	89 e5                	mov    %esp,%ebp
+  800231:	57                   	push   %edi
+  800232:	56                   	push   %esi
+  800233:	53                   	push   %ebx
+  800234:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800237:	be 00 00 00 00       	mov    $0x0,%esi
+  80023c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80023f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800242:	b8 06 00 00 00       	mov    $0x6,%eax
+  800247:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80024a:	89 f7                	mov    %esi,%edi
+  80024c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80024e:	85 c0                	test   %eax,%eax
+  800250:	7f 08                	jg     80025a <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800252:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800255:	5b                   	pop    %ebx
+  800256:	5e                   	pop    %esi
+  800257:	5f                   	pop    %edi
+  800258:	5d                   	pop    %ebp
+  800259:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80025a:	83 ec 0c             	sub    $0xc,%esp
+  80025d:	50                   	push   %eax
+  80025e:	6a 06                	push   $0x6
+  800260:	68 98 26 80 00       	push   $0x802698
+  800265:	6a 23                	push   $0x23
+  800267:	68 b5 26 80 00       	push   $0x8026b5
+  80026c:	e8 b0 14 00 00       	call   801721 <_panic>
+
+00800271 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800271:	55                   	push   %ebp
+  800272:	89 e5                	mov    %esp,%ebp
+  800274:	57                   	push   %edi
+  800275:	56                   	push   %esi
+  800276:	53                   	push   %ebx
+  800277:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80027a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80027d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800280:	b8 07 00 00 00       	mov    $0x7,%eax
+  800285:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800288:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80028b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80028e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800290:	85 c0                	test   %eax,%eax
+  800292:	7f 08                	jg     80029c <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800294:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800297:	5b                   	pop    %ebx
+  800298:	5e                   	pop    %esi
+  800299:	5f                   	pop    %edi
+  80029a:	5d                   	pop    %ebp
+  80029b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80029c:	83 ec 0c             	sub    $0xc,%esp
+  80029f:	50                   	push   %eax
+  8002a0:	6a 07                	push   $0x7
+  8002a2:	68 98 26 80 00       	push   $0x802698
+  8002a7:	6a 23                	push   $0x23
+  8002a9:	68 b5 26 80 00       	push   $0x8026b5
+  8002ae:	e8 6e 14 00 00       	call   801721 <_panic>
+
+008002b3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8002b3:	55                   	push   %ebp
+  8002b4:	89 e5                	mov    %esp,%ebp
+  8002b6:	57                   	push   %edi
+  8002b7:	56                   	push   %esi
+  8002b8:	53                   	push   %ebx
+  8002b9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002cc:	89 df                	mov    %ebx,%edi
+  8002ce:	89 de                	mov    %ebx,%esi
+  8002d0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002d2:	85 c0                	test   %eax,%eax
+  8002d4:	7f 08                	jg     8002de <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d9:	5b                   	pop    %ebx
+  8002da:	5e                   	pop    %esi
+  8002db:	5f                   	pop    %edi
+  8002dc:	5d                   	pop    %ebp
+  8002dd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002de:	83 ec 0c             	sub    $0xc,%esp
+  8002e1:	50                   	push   %eax
+  8002e2:	6a 08                	push   $0x8
+  8002e4:	68 98 26 80 00       	push   $0x802698
+  8002e9:	6a 23                	push   $0x23
+  8002eb:	68 b5 26 80 00       	push   $0x8026b5
+  8002f0:	e8 2c 14 00 00       	call   801721 <_panic>
+
+008002f5 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002f5:	55                   	push   %ebp
+  8002f6:	89 e5                	mov    %esp,%ebp
+  8002f8:	57                   	push   %edi
+  8002f9:	56                   	push   %esi
+  8002fa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800301:	b8 09 00 00 00       	mov    $0x9,%eax
+  800306:	be 00 00 00 00       	mov    $0x0,%esi
+  80030b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80030e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800311:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800313:	5b                   	pop    %ebx
+  800314:	5e                   	pop    %esi
+  800315:	5f                   	pop    %edi
+  800316:	5d                   	pop    %ebp
+  800317:	c3                   	ret
+
+00800318 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800318:	55                   	push   %ebp
+  800319:	89 e5                	mov    %esp,%ebp
+  80031b:	57                   	push   %edi
+  80031c:	56                   	push   %esi
+  80031d:	53                   	push   %ebx
+  80031e:	8b 45 18             	mov    0x18(%ebp),%eax
+  800321:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800324:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800329:	77 27                	ja     800352 <sys_page_map_range+0x3a>
+  80032b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800331:	77 1f                	ja     800352 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800333:	c1 e0 0c             	shl    $0xc,%eax
+  800336:	89 c6                	mov    %eax,%esi
+  800338:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  80033a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80033d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800340:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800345:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800348:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80034b:	cd 30                	int    $0x30
+}
+  80034d:	5b                   	pop    %ebx
+  80034e:	5e                   	pop    %esi
+  80034f:	5f                   	pop    %edi
+  800350:	5d                   	pop    %ebp
+  800351:	c3                   	ret
+		return -E_INVAL;
+  800352:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800357:	eb f4                	jmp    80034d <sys_page_map_range+0x35>
+
+00800359 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800359:	55                   	push   %ebp
+  80035a:	89 e5                	mov    %esp,%ebp
+  80035c:	57                   	push   %edi
+  80035d:	56                   	push   %esi
+  80035e:	53                   	push   %ebx
+  80035f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800362:	8b 55 08             	mov    0x8(%ebp),%edx
+  800365:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800368:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80036d:	be 00 00 00 00       	mov    $0x0,%esi
+  800372:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800375:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800378:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80037a:	85 c0                	test   %eax,%eax
+  80037c:	7f 08                	jg     800386 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80037e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800381:	5b                   	pop    %ebx
+  800382:	5e                   	pop    %esi
+  800383:	5f                   	pop    %edi
+  800384:	5d                   	pop    %ebp
+  800385:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800386:	83 ec 0c             	sub    $0xc,%esp
+  800389:	50                   	push   %eax
+  80038a:	6a 0c                	push   $0xc
+  80038c:	68 98 26 80 00       	push   $0x802698
+  800391:	6a 23                	push   $0x23
+  800393:	68 b5 26 80 00       	push   $0x8026b5
+  800398:	e8 84 13 00 00       	call   801721 <_panic>
+
+0080039d <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  80039d:	55                   	push   %ebp
+  80039e:	89 e5                	mov    %esp,%ebp
+  8003a0:	57                   	push   %edi
+  8003a1:	56                   	push   %esi
+  8003a2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8003a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ae:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8003b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003b6:	89 f7                	mov    %esi,%edi
+  8003b8:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+
+008003bf <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003bf:	55                   	push   %ebp
+  8003c0:	89 e5                	mov    %esp,%ebp
+  8003c2:	57                   	push   %edi
+  8003c3:	56                   	push   %esi
+  8003c4:	53                   	push   %ebx
+  8003c5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003d8:	89 df                	mov    %ebx,%edi
+  8003da:	89 de                	mov    %ebx,%esi
+  8003dc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003de:	85 c0                	test   %eax,%eax
+  8003e0:	7f 08                	jg     8003ea <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e5:	5b                   	pop    %ebx
+  8003e6:	5e                   	pop    %esi
+  8003e7:	5f                   	pop    %edi
+  8003e8:	5d                   	pop    %ebp
+  8003e9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003ea:	83 ec 0c             	sub    $0xc,%esp
+  8003ed:	50                   	push   %eax
+  8003ee:	6a 0f                	push   $0xf
+  8003f0:	68 98 26 80 00       	push   $0x802698
+  8003f5:	6a 23                	push   $0x23
+  8003f7:	68 b5 26 80 00       	push   $0x8026b5
+  8003fc:	e8 20 13 00 00       	call   801721 <_panic>
+
+00800401 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800401:	55                   	push   %ebp
+  800402:	89 e5                	mov    %esp,%ebp
+  800404:	57                   	push   %edi
+  800405:	56                   	push   %esi
+  800406:	53                   	push   %ebx
+  800407:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80040a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80040f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800412:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800415:	b8 10 00 00 00       	mov    $0x10,%eax
+  80041a:	89 df                	mov    %ebx,%edi
+  80041c:	89 de                	mov    %ebx,%esi
+  80041e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800420:	85 c0                	test   %eax,%eax
+  800422:	7f 08                	jg     80042c <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800424:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800427:	5b                   	pop    %ebx
+  800428:	5e                   	pop    %esi
+  800429:	5f                   	pop    %edi
+  80042a:	5d                   	pop    %ebp
+  80042b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80042c:	83 ec 0c             	sub    $0xc,%esp
+  80042f:	50                   	push   %eax
+  800430:	6a 10                	push   $0x10
+  800432:	68 98 26 80 00       	push   $0x802698
+  800437:	6a 23                	push   $0x23
+  800439:	68 b5 26 80 00       	push   $0x8026b5
+  80043e:	e8 de 12 00 00       	call   801721 <_panic>
+
+00800443 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800443:	55                   	push   %ebp
+  800444:	89 e5                	mov    %esp,%ebp
+  800446:	57                   	push   %edi
+  800447:	56                   	push   %esi
+  800448:	53                   	push   %ebx
+  800449:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80044c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800451:	8b 55 08             	mov    0x8(%ebp),%edx
+  800454:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800457:	b8 11 00 00 00       	mov    $0x11,%eax
+  80045c:	89 df                	mov    %ebx,%edi
+  80045e:	89 de                	mov    %ebx,%esi
+  800460:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800462:	85 c0                	test   %eax,%eax
+  800464:	7f 08                	jg     80046e <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800466:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800469:	5b                   	pop    %ebx
+  80046a:	5e                   	pop    %esi
+  80046b:	5f                   	pop    %edi
+  80046c:	5d                   	pop    %ebp
+  80046d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80046e:	83 ec 0c             	sub    $0xc,%esp
+  800471:	50                   	push   %eax
+  800472:	6a 11                	push   $0x11
+  800474:	68 98 26 80 00       	push   $0x802698
+  800479:	6a 23                	push   $0x23
+  80047b:	68 b5 26 80 00       	push   $0x8026b5
+  800480:	e8 9c 12 00 00       	call   801721 <_panic>
+
+00800485 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800485:	55                   	push   %ebp
+  800486:	89 e5                	mov    %esp,%ebp
+  800488:	57                   	push   %edi
+  800489:	56                   	push   %esi
+  80048a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80048b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800490:	b8 12 00 00 00       	mov    $0x12,%eax
+  800495:	89 d1                	mov    %edx,%ecx
+  800497:	89 d3                	mov    %edx,%ebx
+  800499:	89 d7                	mov    %edx,%edi
+  80049b:	89 d6                	mov    %edx,%esi
+  80049d:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  80049f:	5b                   	pop    %ebx
+  8004a0:	5e                   	pop    %esi
+  8004a1:	5f                   	pop    %edi
+  8004a2:	5d                   	pop    %ebp
+  8004a3:	c3                   	ret
+
+008004a4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8004a4:	55                   	push   %ebp
+  8004a5:	89 e5                	mov    %esp,%ebp
+  8004a7:	57                   	push   %edi
+  8004a8:	56                   	push   %esi
+  8004a9:	53                   	push   %ebx
+  8004aa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004b8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004bd:	89 df                	mov    %ebx,%edi
+  8004bf:	89 de                	mov    %ebx,%esi
+  8004c1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004c3:	85 c0                	test   %eax,%eax
+  8004c5:	7f 08                	jg     8004cf <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8004c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004ca:	5b                   	pop    %ebx
+  8004cb:	5e                   	pop    %esi
+  8004cc:	5f                   	pop    %edi
+  8004cd:	5d                   	pop    %ebp
+  8004ce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004cf:	83 ec 0c             	sub    $0xc,%esp
+  8004d2:	50                   	push   %eax
+  8004d3:	6a 13                	push   $0x13
+  8004d5:	68 98 26 80 00       	push   $0x802698
+  8004da:	6a 23                	push   $0x23
+  8004dc:	68 b5 26 80 00       	push   $0x8026b5
+  8004e1:	e8 3b 12 00 00       	call   801721 <_panic>
+
+008004e6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004e6:	55                   	push   %ebp
+  8004e7:	89 e5                	mov    %esp,%ebp
+  8004e9:	57                   	push   %edi
+  8004ea:	56                   	push   %esi
+  8004eb:	53                   	push   %ebx
+  8004ec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004fa:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004ff:	89 df                	mov    %ebx,%edi
+  800501:	89 de                	mov    %ebx,%esi
+  800503:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800505:	85 c0                	test   %eax,%eax
+  800507:	7f 08                	jg     800511 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800509:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80050c:	5b                   	pop    %ebx
+  80050d:	5e                   	pop    %esi
+  80050e:	5f                   	pop    %edi
+  80050f:	5d                   	pop    %ebp
+  800510:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800511:	83 ec 0c             	sub    $0xc,%esp
+  800514:	50                   	push   %eax
+  800515:	6a 14                	push   $0x14
+  800517:	68 98 26 80 00       	push   $0x802698
+  80051c:	6a 23                	push   $0x23
+  80051e:	68 b5 26 80 00       	push   $0x8026b5
+  800523:	e8 f9 11 00 00       	call   801721 <_panic>
+
+00800528 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800528:	55                   	push   %ebp
+  800529:	89 e5                	mov    %esp,%ebp
+  80052b:	57                   	push   %edi
+  80052c:	56                   	push   %esi
+  80052d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80052e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800531:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800534:	b8 17 00 00 00       	mov    $0x17,%eax
+  800539:	be 00 00 00 00       	mov    $0x0,%esi
+  80053e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800541:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800544:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800546:	5b                   	pop    %ebx
+  800547:	5e                   	pop    %esi
+  800548:	5f                   	pop    %edi
+  800549:	5d                   	pop    %ebp
+  80054a:	c3                   	ret
+
+0080054b <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80054b:	55                   	push   %ebp
+  80054c:	89 e5                	mov    %esp,%ebp
+  80054e:	57                   	push   %edi
+  80054f:	56                   	push   %esi
+  800550:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800551:	8b 55 08             	mov    0x8(%ebp),%edx
+  800554:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800557:	b8 18 00 00 00       	mov    $0x18,%eax
+  80055c:	be 00 00 00 00       	mov    $0x0,%esi
+  800561:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800564:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800567:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800569:	5b                   	pop    %ebx
+  80056a:	5e                   	pop    %esi
+  80056b:	5f                   	pop    %edi
+  80056c:	5d                   	pop    %ebp
+  80056d:	c3                   	ret
+
+0080056e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80056e:	55                   	push   %ebp
+  80056f:	89 e5                	mov    %esp,%ebp
+  800571:	57                   	push   %edi
+  800572:	56                   	push   %esi
+  800573:	53                   	push   %ebx
+  800574:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800577:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80057c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80057f:	b8 19 00 00 00       	mov    $0x19,%eax
+  800584:	89 cb                	mov    %ecx,%ebx
+  800586:	89 cf                	mov    %ecx,%edi
+  800588:	89 ce                	mov    %ecx,%esi
+  80058a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80058c:	85 c0                	test   %eax,%eax
+  80058e:	7f 08                	jg     800598 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800590:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800593:	5b                   	pop    %ebx
+  800594:	5e                   	pop    %esi
+  800595:	5f                   	pop    %edi
+  800596:	5d                   	pop    %ebp
+  800597:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800598:	83 ec 0c             	sub    $0xc,%esp
+  80059b:	50                   	push   %eax
+  80059c:	6a 19                	push   $0x19
+  80059e:	68 98 26 80 00       	push   $0x802698
+  8005a3:	6a 23                	push   $0x23
+  8005a5:	68 b5 26 80 00       	push   $0x8026b5
+  8005aa:	e8 72 11 00 00       	call   801721 <_panic>
+
+008005af <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8005af:	55                   	push   %ebp
+  8005b0:	89 e5                	mov    %esp,%ebp
+  8005b2:	57                   	push   %edi
+  8005b3:	56                   	push   %esi
+  8005b4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ba:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005bf:	89 d1                	mov    %edx,%ecx
+  8005c1:	89 d3                	mov    %edx,%ebx
+  8005c3:	89 d7                	mov    %edx,%edi
+  8005c5:	89 d6                	mov    %edx,%esi
+  8005c7:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8005c9:	5b                   	pop    %ebx
+  8005ca:	5e                   	pop    %esi
+  8005cb:	5f                   	pop    %edi
+  8005cc:	5d                   	pop    %ebp
+  8005cd:	c3                   	ret
+
+008005ce <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8005ce:	55                   	push   %ebp
+  8005cf:	89 e5                	mov    %esp,%ebp
+  8005d1:	57                   	push   %edi
+  8005d2:	56                   	push   %esi
+  8005d3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005df:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005e4:	89 df                	mov    %ebx,%edi
+  8005e6:	89 de                	mov    %ebx,%esi
+  8005e8:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8005ea:	5b                   	pop    %ebx
+  8005eb:	5e                   	pop    %esi
+  8005ec:	5f                   	pop    %edi
+  8005ed:	5d                   	pop    %ebp
+  8005ee:	c3                   	ret
+
+008005ef <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8005ef:	55                   	push   %ebp
+  8005f0:	89 e5                	mov    %esp,%ebp
+  8005f2:	57                   	push   %edi
+  8005f3:	56                   	push   %esi
+  8005f4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800600:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800605:	89 df                	mov    %ebx,%edi
+  800607:	89 de                	mov    %ebx,%esi
+  800609:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  80060b:	5b                   	pop    %ebx
+  80060c:	5e                   	pop    %esi
+  80060d:	5f                   	pop    %edi
+  80060e:	5d                   	pop    %ebp
+  80060f:	c3                   	ret
+
+00800610 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800610:	55                   	push   %ebp
+  800611:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800613:	8b 45 08             	mov    0x8(%ebp),%eax
+  800616:	05 00 00 00 30       	add    $0x30000000,%eax
+  80061b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80061e:	5d                   	pop    %ebp
+  80061f:	c3                   	ret
+
+00800620 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800620:	55                   	push   %ebp
+  800621:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800623:	8b 45 08             	mov    0x8(%ebp),%eax
+  800626:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80062b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800630:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800635:	5d                   	pop    %ebp
+  800636:	c3                   	ret
+
+00800637 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800637:	55                   	push   %ebp
+  800638:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80063a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80063f:	eb 02                	jmp    800643 <fd_alloc+0xc>
+  800641:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800643:	89 c2                	mov    %eax,%edx
+  800645:	c1 ea 16             	shr    $0x16,%edx
+  800648:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80064f:	f6 c2 01             	test   $0x1,%dl
+  800652:	74 2b                	je     80067f <fd_alloc+0x48>
+  800654:	89 c2                	mov    %eax,%edx
+  800656:	c1 ea 0c             	shr    $0xc,%edx
+  800659:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800660:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800666:	f6 c1 01             	test   $0x1,%cl
+  800669:	74 14                	je     80067f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80066b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800671:	75 ce                	jne    800641 <fd_alloc+0xa>
+  800673:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800678:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80067d:	eb 05                	jmp    800684 <fd_alloc+0x4d>
+			return 0;
+  80067f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800684:	8b 55 08             	mov    0x8(%ebp),%edx
+  800687:	89 02                	mov    %eax,(%edx)
+}
+  800689:	89 c8                	mov    %ecx,%eax
+  80068b:	5d                   	pop    %ebp
+  80068c:	c3                   	ret
+
+0080068d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80068d:	55                   	push   %ebp
+  80068e:	89 e5                	mov    %esp,%ebp
+  800690:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800693:	83 f8 1f             	cmp    $0x1f,%eax
+  800696:	77 30                	ja     8006c8 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800698:	c1 e0 0c             	shl    $0xc,%eax
+  80069b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8006a0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006a6:	f6 c2 01             	test   $0x1,%dl
+  8006a9:	74 24                	je     8006cf <fd_lookup+0x42>
+  8006ab:	89 c2                	mov    %eax,%edx
+  8006ad:	c1 ea 0c             	shr    $0xc,%edx
+  8006b0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006b7:	f6 c2 01             	test   $0x1,%dl
+  8006ba:	74 1a                	je     8006d6 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006bf:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006c6:	5d                   	pop    %ebp
+  8006c7:	c3                   	ret
+		return -E_INVAL;
+  8006c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006cd:	eb f7                	jmp    8006c6 <fd_lookup+0x39>
+		return -E_INVAL;
+  8006cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006d4:	eb f0                	jmp    8006c6 <fd_lookup+0x39>
+  8006d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006db:	eb e9                	jmp    8006c6 <fd_lookup+0x39>
+
+008006dd <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006dd:	55                   	push   %ebp
+  8006de:	89 e5                	mov    %esp,%ebp
+  8006e0:	53                   	push   %ebx
+  8006e1:	83 ec 04             	sub    $0x4,%esp
+  8006e4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ec:	eb 03                	jmp    8006f1 <dev_lookup+0x14>
+  8006ee:	83 c0 01             	add    $0x1,%eax
+  8006f1:	8b 1c 85 40 27 80 00 	mov    0x802740(,%eax,4),%ebx
+  8006f8:	85 db                	test   %ebx,%ebx
+  8006fa:	74 0b                	je     800707 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8006fc:	39 13                	cmp    %edx,(%ebx)
+  8006fe:	75 ee                	jne    8006ee <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800700:	b8 00 00 00 00       	mov    $0x0,%eax
+  800705:	eb 1f                	jmp    800726 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800707:	a1 08 40 80 00       	mov    0x804008,%eax
+  80070c:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80070f:	83 ec 04             	sub    $0x4,%esp
+  800712:	52                   	push   %edx
+  800713:	50                   	push   %eax
+  800714:	68 c4 26 80 00       	push   $0x8026c4
+  800719:	e8 de 10 00 00       	call   8017fc <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80071e:	83 c4 10             	add    $0x10,%esp
+  800721:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800726:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800729:	89 1a                	mov    %ebx,(%edx)
+}
+  80072b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80072e:	c9                   	leave
+  80072f:	c3                   	ret
+
+00800730 <fd_close>:
+{
+  800730:	55                   	push   %ebp
+  800731:	89 e5                	mov    %esp,%ebp
+  800733:	57                   	push   %edi
+  800734:	56                   	push   %esi
+  800735:	53                   	push   %ebx
+  800736:	83 ec 24             	sub    $0x24,%esp
+  800739:	8b 75 08             	mov    0x8(%ebp),%esi
+  80073c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80073f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800742:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800743:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800749:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80074c:	50                   	push   %eax
+  80074d:	e8 3b ff ff ff       	call   80068d <fd_lookup>
+  800752:	89 c3                	mov    %eax,%ebx
+  800754:	83 c4 10             	add    $0x10,%esp
+  800757:	85 c0                	test   %eax,%eax
+  800759:	78 05                	js     800760 <fd_close+0x30>
+	    || fd != fd2)
+  80075b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80075e:	74 16                	je     800776 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800760:	89 f8                	mov    %edi,%eax
+  800762:	84 c0                	test   %al,%al
+  800764:	b8 00 00 00 00       	mov    $0x0,%eax
+  800769:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80076c:	89 d8                	mov    %ebx,%eax
+  80076e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800771:	5b                   	pop    %ebx
+  800772:	5e                   	pop    %esi
+  800773:	5f                   	pop    %edi
+  800774:	5d                   	pop    %ebp
+  800775:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800776:	83 ec 08             	sub    $0x8,%esp
+  800779:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80077c:	50                   	push   %eax
+  80077d:	ff 36                	push   (%esi)
+  80077f:	e8 59 ff ff ff       	call   8006dd <dev_lookup>
+  800784:	89 c3                	mov    %eax,%ebx
+  800786:	83 c4 10             	add    $0x10,%esp
+  800789:	85 c0                	test   %eax,%eax
+  80078b:	78 1a                	js     8007a7 <fd_close+0x77>
+		if (dev->dev_close)
+  80078d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800790:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800793:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800798:	85 c0                	test   %eax,%eax
+  80079a:	74 0b                	je     8007a7 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80079c:	83 ec 0c             	sub    $0xc,%esp
+  80079f:	56                   	push   %esi
+  8007a0:	ff d0                	call   *%eax
+  8007a2:	89 c3                	mov    %eax,%ebx
+  8007a4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007a7:	83 ec 08             	sub    $0x8,%esp
+  8007aa:	56                   	push   %esi
+  8007ab:	6a 00                	push   $0x0
+  8007ad:	e8 01 fb ff ff       	call   8002b3 <sys_page_unmap>
+	return r;
+  8007b2:	83 c4 10             	add    $0x10,%esp
+  8007b5:	eb b5                	jmp    80076c <fd_close+0x3c>
+
+008007b7 <close>:
+
+int
+close(int fdnum)
+{
+  8007b7:	55                   	push   %ebp
+  8007b8:	89 e5                	mov    %esp,%ebp
+  8007ba:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007c0:	50                   	push   %eax
+  8007c1:	ff 75 08             	push   0x8(%ebp)
+  8007c4:	e8 c4 fe ff ff       	call   80068d <fd_lookup>
+  8007c9:	83 c4 10             	add    $0x10,%esp
+  8007cc:	85 c0                	test   %eax,%eax
+  8007ce:	79 02                	jns    8007d2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007d0:	c9                   	leave
+  8007d1:	c3                   	ret
+		return fd_close(fd, 1);
+  8007d2:	83 ec 08             	sub    $0x8,%esp
+  8007d5:	6a 01                	push   $0x1
+  8007d7:	ff 75 f4             	push   -0xc(%ebp)
+  8007da:	e8 51 ff ff ff       	call   800730 <fd_close>
+  8007df:	83 c4 10             	add    $0x10,%esp
+  8007e2:	eb ec                	jmp    8007d0 <close+0x19>
+
+008007e4 <close_all>:
+
+void
+close_all(void)
+{
+  8007e4:	55                   	push   %ebp
+  8007e5:	89 e5                	mov    %esp,%ebp
+  8007e7:	53                   	push   %ebx
+  8007e8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8007eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8007f0:	83 ec 0c             	sub    $0xc,%esp
+  8007f3:	53                   	push   %ebx
+  8007f4:	e8 be ff ff ff       	call   8007b7 <close>
+	for (i = 0; i < MAXFD; i++)
+  8007f9:	83 c3 01             	add    $0x1,%ebx
+  8007fc:	83 c4 10             	add    $0x10,%esp
+  8007ff:	83 fb 20             	cmp    $0x20,%ebx
+  800802:	75 ec                	jne    8007f0 <close_all+0xc>
+}
+  800804:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800807:	c9                   	leave
+  800808:	c3                   	ret
+
+00800809 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800809:	55                   	push   %ebp
+  80080a:	89 e5                	mov    %esp,%ebp
+  80080c:	57                   	push   %edi
+  80080d:	56                   	push   %esi
+  80080e:	53                   	push   %ebx
+  80080f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800812:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800815:	50                   	push   %eax
+  800816:	ff 75 08             	push   0x8(%ebp)
+  800819:	e8 6f fe ff ff       	call   80068d <fd_lookup>
+  80081e:	89 c3                	mov    %eax,%ebx
+  800820:	83 c4 10             	add    $0x10,%esp
+  800823:	85 c0                	test   %eax,%eax
+  800825:	78 7f                	js     8008a6 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800827:	83 ec 0c             	sub    $0xc,%esp
+  80082a:	ff 75 0c             	push   0xc(%ebp)
+  80082d:	e8 85 ff ff ff       	call   8007b7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800832:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800835:	c1 e6 0c             	shl    $0xc,%esi
+  800838:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80083e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800841:	89 3c 24             	mov    %edi,(%esp)
+  800844:	e8 d7 fd ff ff       	call   800620 <fd2data>
+  800849:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80084b:	89 34 24             	mov    %esi,(%esp)
+  80084e:	e8 cd fd ff ff       	call   800620 <fd2data>
+  800853:	83 c4 10             	add    $0x10,%esp
+  800856:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800859:	89 d8                	mov    %ebx,%eax
+  80085b:	c1 e8 16             	shr    $0x16,%eax
+  80085e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800865:	a8 01                	test   $0x1,%al
+  800867:	74 11                	je     80087a <dup+0x71>
+  800869:	89 d8                	mov    %ebx,%eax
+  80086b:	c1 e8 0c             	shr    $0xc,%eax
+  80086e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800875:	f6 c2 01             	test   $0x1,%dl
+  800878:	75 36                	jne    8008b0 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80087a:	89 f8                	mov    %edi,%eax
+  80087c:	c1 e8 0c             	shr    $0xc,%eax
+  80087f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800886:	83 ec 0c             	sub    $0xc,%esp
+  800889:	25 07 0e 00 00       	and    $0xe07,%eax
+  80088e:	50                   	push   %eax
+  80088f:	56                   	push   %esi
+  800890:	6a 00                	push   $0x0
+  800892:	57                   	push   %edi
+  800893:	6a 00                	push   $0x0
+  800895:	e8 d7 f9 ff ff       	call   800271 <sys_page_map>
+  80089a:	89 c3                	mov    %eax,%ebx
+  80089c:	83 c4 20             	add    $0x20,%esp
+  80089f:	85 c0                	test   %eax,%eax
+  8008a1:	78 33                	js     8008d6 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008a6:	89 d8                	mov    %ebx,%eax
+  8008a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008ab:	5b                   	pop    %ebx
+  8008ac:	5e                   	pop    %esi
+  8008ad:	5f                   	pop    %edi
+  8008ae:	5d                   	pop    %ebp
+  8008af:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008b0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008b7:	83 ec 0c             	sub    $0xc,%esp
+  8008ba:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008bf:	50                   	push   %eax
+  8008c0:	ff 75 d4             	push   -0x2c(%ebp)
+  8008c3:	6a 00                	push   $0x0
+  8008c5:	53                   	push   %ebx
+  8008c6:	6a 00                	push   $0x0
+  8008c8:	e8 a4 f9 ff ff       	call   800271 <sys_page_map>
+  8008cd:	89 c3                	mov    %eax,%ebx
+  8008cf:	83 c4 20             	add    $0x20,%esp
+  8008d2:	85 c0                	test   %eax,%eax
+  8008d4:	79 a4                	jns    80087a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008d6:	83 ec 08             	sub    $0x8,%esp
+  8008d9:	56                   	push   %esi
+  8008da:	6a 00                	push   $0x0
+  8008dc:	e8 d2 f9 ff ff       	call   8002b3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008e1:	83 c4 08             	add    $0x8,%esp
+  8008e4:	ff 75 d4             	push   -0x2c(%ebp)
+  8008e7:	6a 00                	push   $0x0
+  8008e9:	e8 c5 f9 ff ff       	call   8002b3 <sys_page_unmap>
+	return r;
+  8008ee:	83 c4 10             	add    $0x10,%esp
+  8008f1:	eb b3                	jmp    8008a6 <dup+0x9d>
+
+008008f3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8008f3:	55                   	push   %ebp
+  8008f4:	89 e5                	mov    %esp,%ebp
+  8008f6:	56                   	push   %esi
+  8008f7:	53                   	push   %ebx
+  8008f8:	83 ec 18             	sub    $0x18,%esp
+  8008fb:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008fe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800901:	50                   	push   %eax
+  800902:	56                   	push   %esi
+  800903:	e8 85 fd ff ff       	call   80068d <fd_lookup>
+  800908:	83 c4 10             	add    $0x10,%esp
+  80090b:	85 c0                	test   %eax,%eax
+  80090d:	78 3c                	js     80094b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80090f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800912:	83 ec 08             	sub    $0x8,%esp
+  800915:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800918:	50                   	push   %eax
+  800919:	ff 33                	push   (%ebx)
+  80091b:	e8 bd fd ff ff       	call   8006dd <dev_lookup>
+  800920:	83 c4 10             	add    $0x10,%esp
+  800923:	85 c0                	test   %eax,%eax
+  800925:	78 24                	js     80094b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800927:	8b 43 08             	mov    0x8(%ebx),%eax
+  80092a:	83 e0 03             	and    $0x3,%eax
+  80092d:	83 f8 01             	cmp    $0x1,%eax
+  800930:	74 20                	je     800952 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800932:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800935:	8b 40 08             	mov    0x8(%eax),%eax
+  800938:	85 c0                	test   %eax,%eax
+  80093a:	74 37                	je     800973 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80093c:	83 ec 04             	sub    $0x4,%esp
+  80093f:	ff 75 10             	push   0x10(%ebp)
+  800942:	ff 75 0c             	push   0xc(%ebp)
+  800945:	53                   	push   %ebx
+  800946:	ff d0                	call   *%eax
+  800948:	83 c4 10             	add    $0x10,%esp
+}
+  80094b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80094e:	5b                   	pop    %ebx
+  80094f:	5e                   	pop    %esi
+  800950:	5d                   	pop    %ebp
+  800951:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800952:	a1 08 40 80 00       	mov    0x804008,%eax
+  800957:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80095a:	83 ec 04             	sub    $0x4,%esp
+  80095d:	56                   	push   %esi
+  80095e:	50                   	push   %eax
+  80095f:	68 05 27 80 00       	push   $0x802705
+  800964:	e8 93 0e 00 00       	call   8017fc <cprintf>
+		return -E_INVAL;
+  800969:	83 c4 10             	add    $0x10,%esp
+  80096c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800971:	eb d8                	jmp    80094b <read+0x58>
+		return -E_NOT_SUPP;
+  800973:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800978:	eb d1                	jmp    80094b <read+0x58>
+
+0080097a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80097a:	55                   	push   %ebp
+  80097b:	89 e5                	mov    %esp,%ebp
+  80097d:	57                   	push   %edi
+  80097e:	56                   	push   %esi
+  80097f:	53                   	push   %ebx
+  800980:	83 ec 0c             	sub    $0xc,%esp
+  800983:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800986:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800989:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80098e:	eb 02                	jmp    800992 <readn+0x18>
+  800990:	01 c3                	add    %eax,%ebx
+  800992:	39 f3                	cmp    %esi,%ebx
+  800994:	73 21                	jae    8009b7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800996:	83 ec 04             	sub    $0x4,%esp
+  800999:	89 f0                	mov    %esi,%eax
+  80099b:	29 d8                	sub    %ebx,%eax
+  80099d:	50                   	push   %eax
+  80099e:	89 d8                	mov    %ebx,%eax
+  8009a0:	03 45 0c             	add    0xc(%ebp),%eax
+  8009a3:	50                   	push   %eax
+  8009a4:	57                   	push   %edi
+  8009a5:	e8 49 ff ff ff       	call   8008f3 <read>
+		if (m < 0)
+  8009aa:	83 c4 10             	add    $0x10,%esp
+  8009ad:	85 c0                	test   %eax,%eax
+  8009af:	78 04                	js     8009b5 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8009b1:	75 dd                	jne    800990 <readn+0x16>
+  8009b3:	eb 02                	jmp    8009b7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009b5:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8009b7:	89 d8                	mov    %ebx,%eax
+  8009b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009bc:	5b                   	pop    %ebx
+  8009bd:	5e                   	pop    %esi
+  8009be:	5f                   	pop    %edi
+  8009bf:	5d                   	pop    %ebp
+  8009c0:	c3                   	ret
+
+008009c1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	56                   	push   %esi
+  8009c5:	53                   	push   %ebx
+  8009c6:	83 ec 18             	sub    $0x18,%esp
+  8009c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009cc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009cf:	50                   	push   %eax
+  8009d0:	53                   	push   %ebx
+  8009d1:	e8 b7 fc ff ff       	call   80068d <fd_lookup>
+  8009d6:	83 c4 10             	add    $0x10,%esp
+  8009d9:	85 c0                	test   %eax,%eax
+  8009db:	78 37                	js     800a14 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009dd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009e0:	83 ec 08             	sub    $0x8,%esp
+  8009e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009e6:	50                   	push   %eax
+  8009e7:	ff 36                	push   (%esi)
+  8009e9:	e8 ef fc ff ff       	call   8006dd <dev_lookup>
+  8009ee:	83 c4 10             	add    $0x10,%esp
+  8009f1:	85 c0                	test   %eax,%eax
+  8009f3:	78 1f                	js     800a14 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8009f5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8009f9:	74 20                	je     800a1b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8009fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009fe:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a01:	85 c0                	test   %eax,%eax
+  800a03:	74 37                	je     800a3c <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a05:	83 ec 04             	sub    $0x4,%esp
+  800a08:	ff 75 10             	push   0x10(%ebp)
+  800a0b:	ff 75 0c             	push   0xc(%ebp)
+  800a0e:	56                   	push   %esi
+  800a0f:	ff d0                	call   *%eax
+  800a11:	83 c4 10             	add    $0x10,%esp
+}
+  800a14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a17:	5b                   	pop    %ebx
+  800a18:	5e                   	pop    %esi
+  800a19:	5d                   	pop    %ebp
+  800a1a:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a1b:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a20:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800a23:	83 ec 04             	sub    $0x4,%esp
+  800a26:	53                   	push   %ebx
+  800a27:	50                   	push   %eax
+  800a28:	68 21 27 80 00       	push   $0x802721
+  800a2d:	e8 ca 0d 00 00       	call   8017fc <cprintf>
+		return -E_INVAL;
+  800a32:	83 c4 10             	add    $0x10,%esp
+  800a35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a3a:	eb d8                	jmp    800a14 <write+0x53>
+		return -E_NOT_SUPP;
+  800a3c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a41:	eb d1                	jmp    800a14 <write+0x53>
+
+00800a43 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a43:	55                   	push   %ebp
+  800a44:	89 e5                	mov    %esp,%ebp
+  800a46:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a4c:	50                   	push   %eax
+  800a4d:	ff 75 08             	push   0x8(%ebp)
+  800a50:	e8 38 fc ff ff       	call   80068d <fd_lookup>
+  800a55:	83 c4 10             	add    $0x10,%esp
+  800a58:	85 c0                	test   %eax,%eax
+  800a5a:	78 0e                	js     800a6a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800a5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a62:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800a65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a6a:	c9                   	leave
+  800a6b:	c3                   	ret
+
+00800a6c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a6c:	55                   	push   %ebp
+  800a6d:	89 e5                	mov    %esp,%ebp
+  800a6f:	56                   	push   %esi
+  800a70:	53                   	push   %ebx
+  800a71:	83 ec 18             	sub    $0x18,%esp
+  800a74:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a77:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a7a:	50                   	push   %eax
+  800a7b:	53                   	push   %ebx
+  800a7c:	e8 0c fc ff ff       	call   80068d <fd_lookup>
+  800a81:	83 c4 10             	add    $0x10,%esp
+  800a84:	85 c0                	test   %eax,%eax
+  800a86:	78 34                	js     800abc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a88:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a8b:	83 ec 08             	sub    $0x8,%esp
+  800a8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a91:	50                   	push   %eax
+  800a92:	ff 36                	push   (%esi)
+  800a94:	e8 44 fc ff ff       	call   8006dd <dev_lookup>
+  800a99:	83 c4 10             	add    $0x10,%esp
+  800a9c:	85 c0                	test   %eax,%eax
+  800a9e:	78 1c                	js     800abc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800aa0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800aa4:	74 1d                	je     800ac3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800aa6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800aa9:	8b 40 18             	mov    0x18(%eax),%eax
+  800aac:	85 c0                	test   %eax,%eax
+  800aae:	74 34                	je     800ae4 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800ab0:	83 ec 08             	sub    $0x8,%esp
+  800ab3:	ff 75 0c             	push   0xc(%ebp)
+  800ab6:	56                   	push   %esi
+  800ab7:	ff d0                	call   *%eax
+  800ab9:	83 c4 10             	add    $0x10,%esp
+}
+  800abc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800abf:	5b                   	pop    %ebx
+  800ac0:	5e                   	pop    %esi
+  800ac1:	5d                   	pop    %ebp
+  800ac2:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800ac3:	a1 08 40 80 00       	mov    0x804008,%eax
+  800ac8:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800acb:	83 ec 04             	sub    $0x4,%esp
+  800ace:	53                   	push   %ebx
+  800acf:	50                   	push   %eax
+  800ad0:	68 e4 26 80 00       	push   $0x8026e4
+  800ad5:	e8 22 0d 00 00       	call   8017fc <cprintf>
+		return -E_INVAL;
+  800ada:	83 c4 10             	add    $0x10,%esp
+  800add:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ae2:	eb d8                	jmp    800abc <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800ae4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ae9:	eb d1                	jmp    800abc <ftruncate+0x50>
+
+00800aeb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800aeb:	55                   	push   %ebp
+  800aec:	89 e5                	mov    %esp,%ebp
+  800aee:	56                   	push   %esi
+  800aef:	53                   	push   %ebx
+  800af0:	83 ec 18             	sub    $0x18,%esp
+  800af3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800af6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800af9:	50                   	push   %eax
+  800afa:	ff 75 08             	push   0x8(%ebp)
+  800afd:	e8 8b fb ff ff       	call   80068d <fd_lookup>
+  800b02:	83 c4 10             	add    $0x10,%esp
+  800b05:	85 c0                	test   %eax,%eax
+  800b07:	78 49                	js     800b52 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b09:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b0c:	83 ec 08             	sub    $0x8,%esp
+  800b0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b12:	50                   	push   %eax
+  800b13:	ff 36                	push   (%esi)
+  800b15:	e8 c3 fb ff ff       	call   8006dd <dev_lookup>
+  800b1a:	83 c4 10             	add    $0x10,%esp
+  800b1d:	85 c0                	test   %eax,%eax
+  800b1f:	78 31                	js     800b52 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b24:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b28:	74 2f                	je     800b59 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b2a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b2d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b34:	00 00 00 
+	stat->st_isdir = 0;
+  800b37:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b3e:	00 00 00 
+	stat->st_dev = dev;
+  800b41:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b47:	83 ec 08             	sub    $0x8,%esp
+  800b4a:	53                   	push   %ebx
+  800b4b:	56                   	push   %esi
+  800b4c:	ff 50 14             	call   *0x14(%eax)
+  800b4f:	83 c4 10             	add    $0x10,%esp
+}
+  800b52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b55:	5b                   	pop    %ebx
+  800b56:	5e                   	pop    %esi
+  800b57:	5d                   	pop    %ebp
+  800b58:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b59:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b5e:	eb f2                	jmp    800b52 <fstat+0x67>
+
+00800b60 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	56                   	push   %esi
+  800b64:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800b65:	83 ec 08             	sub    $0x8,%esp
+  800b68:	6a 00                	push   $0x0
+  800b6a:	ff 75 08             	push   0x8(%ebp)
+  800b6d:	e8 e4 01 00 00       	call   800d56 <open>
+  800b72:	89 c3                	mov    %eax,%ebx
+  800b74:	83 c4 10             	add    $0x10,%esp
+  800b77:	85 c0                	test   %eax,%eax
+  800b79:	78 1b                	js     800b96 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800b7b:	83 ec 08             	sub    $0x8,%esp
+  800b7e:	ff 75 0c             	push   0xc(%ebp)
+  800b81:	50                   	push   %eax
+  800b82:	e8 64 ff ff ff       	call   800aeb <fstat>
+  800b87:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b89:	89 1c 24             	mov    %ebx,(%esp)
+  800b8c:	e8 26 fc ff ff       	call   8007b7 <close>
+	return r;
+  800b91:	83 c4 10             	add    $0x10,%esp
+  800b94:	89 f3                	mov    %esi,%ebx
+}
+  800b96:	89 d8                	mov    %ebx,%eax
+  800b98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b9b:	5b                   	pop    %ebx
+  800b9c:	5e                   	pop    %esi
+  800b9d:	5d                   	pop    %ebp
+  800b9e:	c3                   	ret
+
+00800b9f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800b9f:	55                   	push   %ebp
+  800ba0:	89 e5                	mov    %esp,%ebp
+  800ba2:	56                   	push   %esi
+  800ba3:	53                   	push   %ebx
+  800ba4:	89 c6                	mov    %eax,%esi
+  800ba6:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800ba8:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800baf:	74 27                	je     800bd8 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800bb1:	6a 07                	push   $0x7
+  800bb3:	68 00 50 80 00       	push   $0x805000
+  800bb8:	56                   	push   %esi
+  800bb9:	ff 35 00 40 80 00    	push   0x804000
+  800bbf:	e8 ce 15 00 00       	call   802192 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800bc4:	83 c4 0c             	add    $0xc,%esp
+  800bc7:	6a 00                	push   $0x0
+  800bc9:	53                   	push   %ebx
+  800bca:	6a 00                	push   $0x0
+  800bcc:	e8 49 15 00 00       	call   80211a <ipc_recv>
+}
+  800bd1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bd4:	5b                   	pop    %ebx
+  800bd5:	5e                   	pop    %esi
+  800bd6:	5d                   	pop    %ebp
+  800bd7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bd8:	83 ec 0c             	sub    $0xc,%esp
+  800bdb:	6a 01                	push   $0x1
+  800bdd:	e8 04 16 00 00       	call   8021e6 <ipc_find_env>
+  800be2:	a3 00 40 80 00       	mov    %eax,0x804000
+  800be7:	83 c4 10             	add    $0x10,%esp
+  800bea:	eb c5                	jmp    800bb1 <fsipc+0x12>
+
+00800bec <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800bec:	55                   	push   %ebp
+  800bed:	89 e5                	mov    %esp,%ebp
+  800bef:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800bf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf5:	8b 40 0c             	mov    0xc(%eax),%eax
+  800bf8:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800bfd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c00:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800c05:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c0f:	e8 8b ff ff ff       	call   800b9f <fsipc>
+}
+  800c14:	c9                   	leave
+  800c15:	c3                   	ret
+
+00800c16 <devfile_flush>:
+{
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800c1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c1f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c22:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800c27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c31:	e8 69 ff ff ff       	call   800b9f <fsipc>
+}
+  800c36:	c9                   	leave
+  800c37:	c3                   	ret
+
+00800c38 <devfile_stat>:
+{
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	53                   	push   %ebx
+  800c3c:	83 ec 04             	sub    $0x4,%esp
+  800c3f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800c42:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c45:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c48:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800c4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c52:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c57:	e8 43 ff ff ff       	call   800b9f <fsipc>
+  800c5c:	85 c0                	test   %eax,%eax
+  800c5e:	78 2c                	js     800c8c <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800c60:	83 ec 08             	sub    $0x8,%esp
+  800c63:	68 00 50 80 00       	push   $0x805000
+  800c68:	53                   	push   %ebx
+  800c69:	e8 7c 11 00 00       	call   801dea <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800c6e:	a1 80 50 80 00       	mov    0x805080,%eax
+  800c73:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800c79:	a1 84 50 80 00       	mov    0x805084,%eax
+  800c7e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800c84:	83 c4 10             	add    $0x10,%esp
+  800c87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c8f:	c9                   	leave
+  800c90:	c3                   	ret
+
+00800c91 <devfile_write>:
+{
+  800c91:	55                   	push   %ebp
+  800c92:	89 e5                	mov    %esp,%ebp
+  800c94:	83 ec 0c             	sub    $0xc,%esp
+  800c97:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800c9a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800c9f:	39 d0                	cmp    %edx,%eax
+  800ca1:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ca4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca7:	8b 52 0c             	mov    0xc(%edx),%edx
+  800caa:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800cb0:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800cb5:	50                   	push   %eax
+  800cb6:	ff 75 0c             	push   0xc(%ebp)
+  800cb9:	68 08 50 80 00       	push   $0x805008
+  800cbe:	e8 ad 12 00 00       	call   801f70 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800cc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ccd:	e8 cd fe ff ff       	call   800b9f <fsipc>
+}
+  800cd2:	c9                   	leave
+  800cd3:	c3                   	ret
+
+00800cd4 <devfile_read>:
+{
+  800cd4:	55                   	push   %ebp
+  800cd5:	89 e5                	mov    %esp,%ebp
+  800cd7:	56                   	push   %esi
+  800cd8:	53                   	push   %ebx
+  800cd9:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cdf:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ce2:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800ce7:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800ced:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cf7:	e8 a3 fe ff ff       	call   800b9f <fsipc>
+  800cfc:	89 c3                	mov    %eax,%ebx
+  800cfe:	85 c0                	test   %eax,%eax
+  800d00:	78 1f                	js     800d21 <devfile_read+0x4d>
+	assert(r <= n);
+  800d02:	39 c6                	cmp    %eax,%esi
+  800d04:	72 24                	jb     800d2a <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  800d06:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800d0b:	7f 33                	jg     800d40 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800d0d:	83 ec 04             	sub    $0x4,%esp
+  800d10:	50                   	push   %eax
+  800d11:	68 00 50 80 00       	push   $0x805000
+  800d16:	ff 75 0c             	push   0xc(%ebp)
+  800d19:	e8 52 12 00 00       	call   801f70 <memmove>
+	return r;
+  800d1e:	83 c4 10             	add    $0x10,%esp
+}
+  800d21:	89 d8                	mov    %ebx,%eax
+  800d23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d26:	5b                   	pop    %ebx
+  800d27:	5e                   	pop    %esi
+  800d28:	5d                   	pop    %ebp
+  800d29:	c3                   	ret
+	assert(r <= n);
+  800d2a:	68 54 27 80 00       	push   $0x802754
+  800d2f:	68 5b 27 80 00       	push   $0x80275b
+  800d34:	6a 7c                	push   $0x7c
+  800d36:	68 70 27 80 00       	push   $0x802770
+  800d3b:	e8 e1 09 00 00       	call   801721 <_panic>
+	assert(r <= PGSIZE);
+  800d40:	68 7b 27 80 00       	push   $0x80277b
+  800d45:	68 5b 27 80 00       	push   $0x80275b
+  800d4a:	6a 7d                	push   $0x7d
+  800d4c:	68 70 27 80 00       	push   $0x802770
+  800d51:	e8 cb 09 00 00       	call   801721 <_panic>
+
+00800d56 <open>:
+{
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	56                   	push   %esi
+  800d5a:	53                   	push   %ebx
+  800d5b:	83 ec 1c             	sub    $0x1c,%esp
+  800d5e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800d61:	56                   	push   %esi
+  800d62:	e8 48 10 00 00       	call   801daf <strlen>
+  800d67:	83 c4 10             	add    $0x10,%esp
+  800d6a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800d6f:	7f 6c                	jg     800ddd <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800d71:	83 ec 0c             	sub    $0xc,%esp
+  800d74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d77:	50                   	push   %eax
+  800d78:	e8 ba f8 ff ff       	call   800637 <fd_alloc>
+  800d7d:	89 c3                	mov    %eax,%ebx
+  800d7f:	83 c4 10             	add    $0x10,%esp
+  800d82:	85 c0                	test   %eax,%eax
+  800d84:	78 3c                	js     800dc2 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800d86:	83 ec 08             	sub    $0x8,%esp
+  800d89:	56                   	push   %esi
+  800d8a:	68 00 50 80 00       	push   $0x805000
+  800d8f:	e8 56 10 00 00       	call   801dea <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800d94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d97:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800d9c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800d9f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da4:	e8 f6 fd ff ff       	call   800b9f <fsipc>
+  800da9:	89 c3                	mov    %eax,%ebx
+  800dab:	83 c4 10             	add    $0x10,%esp
+  800dae:	85 c0                	test   %eax,%eax
+  800db0:	78 19                	js     800dcb <open+0x75>
+	return fd2num(fd);
+  800db2:	83 ec 0c             	sub    $0xc,%esp
+  800db5:	ff 75 f4             	push   -0xc(%ebp)
+  800db8:	e8 53 f8 ff ff       	call   800610 <fd2num>
+  800dbd:	89 c3                	mov    %eax,%ebx
+  800dbf:	83 c4 10             	add    $0x10,%esp
+}
+  800dc2:	89 d8                	mov    %ebx,%eax
+  800dc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dc7:	5b                   	pop    %ebx
+  800dc8:	5e                   	pop    %esi
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+		fd_close(fd, 0);
+  800dcb:	83 ec 08             	sub    $0x8,%esp
+  800dce:	6a 00                	push   $0x0
+  800dd0:	ff 75 f4             	push   -0xc(%ebp)
+  800dd3:	e8 58 f9 ff ff       	call   800730 <fd_close>
+		return r;
+  800dd8:	83 c4 10             	add    $0x10,%esp
+  800ddb:	eb e5                	jmp    800dc2 <open+0x6c>
+		return -E_BAD_PATH;
+  800ddd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800de2:	eb de                	jmp    800dc2 <open+0x6c>
+
+00800de4 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800de4:	55                   	push   %ebp
+  800de5:	89 e5                	mov    %esp,%ebp
+  800de7:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800dea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800def:	b8 08 00 00 00       	mov    $0x8,%eax
+  800df4:	e8 a6 fd ff ff       	call   800b9f <fsipc>
+}
+  800df9:	c9                   	leave
+  800dfa:	c3                   	ret
+
+00800dfb <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800dfb:	55                   	push   %ebp
+  800dfc:	89 e5                	mov    %esp,%ebp
+  800dfe:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800e01:	68 87 27 80 00       	push   $0x802787
+  800e06:	ff 75 0c             	push   0xc(%ebp)
+  800e09:	e8 dc 0f 00 00       	call   801dea <strcpy>
+	return 0;
+}
+  800e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e13:	c9                   	leave
+  800e14:	c3                   	ret
+
+00800e15 <devsock_close>:
+{
+  800e15:	55                   	push   %ebp
+  800e16:	89 e5                	mov    %esp,%ebp
+  800e18:	53                   	push   %ebx
+  800e19:	83 ec 10             	sub    $0x10,%esp
+  800e1c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800e1f:	53                   	push   %ebx
+  800e20:	e8 d1 13 00 00       	call   8021f6 <pageref>
+  800e25:	89 c2                	mov    %eax,%edx
+  800e27:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800e2f:	83 fa 01             	cmp    $0x1,%edx
+  800e32:	74 05                	je     800e39 <devsock_close+0x24>
+}
+  800e34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e37:	c9                   	leave
+  800e38:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800e39:	83 ec 0c             	sub    $0xc,%esp
+  800e3c:	ff 73 0c             	push   0xc(%ebx)
+  800e3f:	e8 b7 02 00 00       	call   8010fb <nsipc_close>
+  800e44:	83 c4 10             	add    $0x10,%esp
+  800e47:	eb eb                	jmp    800e34 <devsock_close+0x1f>
+
+00800e49 <devsock_write>:
+{
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800e4f:	6a 00                	push   $0x0
+  800e51:	ff 75 10             	push   0x10(%ebp)
+  800e54:	ff 75 0c             	push   0xc(%ebp)
+  800e57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e5a:	ff 70 0c             	push   0xc(%eax)
+  800e5d:	e8 79 03 00 00       	call   8011db <nsipc_send>
+}
+  800e62:	c9                   	leave
+  800e63:	c3                   	ret
+
+00800e64 <devsock_read>:
+{
+  800e64:	55                   	push   %ebp
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800e6a:	6a 00                	push   $0x0
+  800e6c:	ff 75 10             	push   0x10(%ebp)
+  800e6f:	ff 75 0c             	push   0xc(%ebp)
+  800e72:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e75:	ff 70 0c             	push   0xc(%eax)
+  800e78:	e8 ef 02 00 00       	call   80116c <nsipc_recv>
+}
+  800e7d:	c9                   	leave
+  800e7e:	c3                   	ret
+
+00800e7f <fd2sockid>:
+{
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800e85:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800e88:	52                   	push   %edx
+  800e89:	50                   	push   %eax
+  800e8a:	e8 fe f7 ff ff       	call   80068d <fd_lookup>
+  800e8f:	83 c4 10             	add    $0x10,%esp
+  800e92:	85 c0                	test   %eax,%eax
+  800e94:	78 10                	js     800ea6 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800e96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e99:	8b 0d 24 30 80 00    	mov    0x803024,%ecx
+  800e9f:	39 08                	cmp    %ecx,(%eax)
+  800ea1:	75 05                	jne    800ea8 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800ea3:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800ea6:	c9                   	leave
+  800ea7:	c3                   	ret
+		return -E_NOT_SUPP;
+  800ea8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ead:	eb f7                	jmp    800ea6 <fd2sockid+0x27>
+
+00800eaf <alloc_sockfd>:
+{
+  800eaf:	55                   	push   %ebp
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	56                   	push   %esi
+  800eb3:	53                   	push   %ebx
+  800eb4:	83 ec 1c             	sub    $0x1c,%esp
+  800eb7:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800eb9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ebc:	50                   	push   %eax
+  800ebd:	e8 75 f7 ff ff       	call   800637 <fd_alloc>
+  800ec2:	89 c3                	mov    %eax,%ebx
+  800ec4:	83 c4 10             	add    $0x10,%esp
+  800ec7:	85 c0                	test   %eax,%eax
+  800ec9:	78 43                	js     800f0e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800ecb:	83 ec 04             	sub    $0x4,%esp
+  800ece:	68 07 04 00 00       	push   $0x407
+  800ed3:	ff 75 f4             	push   -0xc(%ebp)
+  800ed6:	6a 00                	push   $0x0
+  800ed8:	e8 0e f3 ff ff       	call   8001eb <sys_page_alloc>
+  800edd:	89 c3                	mov    %eax,%ebx
+  800edf:	83 c4 10             	add    $0x10,%esp
+  800ee2:	85 c0                	test   %eax,%eax
+  800ee4:	78 28                	js     800f0e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800ee6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ee9:	8b 15 24 30 80 00    	mov    0x803024,%edx
+  800eef:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800ef1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ef4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800efb:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800efe:	83 ec 0c             	sub    $0xc,%esp
+  800f01:	50                   	push   %eax
+  800f02:	e8 09 f7 ff ff       	call   800610 <fd2num>
+  800f07:	89 c3                	mov    %eax,%ebx
+  800f09:	83 c4 10             	add    $0x10,%esp
+  800f0c:	eb 0c                	jmp    800f1a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800f0e:	83 ec 0c             	sub    $0xc,%esp
+  800f11:	56                   	push   %esi
+  800f12:	e8 e4 01 00 00       	call   8010fb <nsipc_close>
+		return r;
+  800f17:	83 c4 10             	add    $0x10,%esp
+}
+  800f1a:	89 d8                	mov    %ebx,%eax
+  800f1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f1f:	5b                   	pop    %ebx
+  800f20:	5e                   	pop    %esi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+
+00800f23 <accept>:
+{
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f2c:	e8 4e ff ff ff       	call   800e7f <fd2sockid>
+  800f31:	85 c0                	test   %eax,%eax
+  800f33:	78 1b                	js     800f50 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800f35:	83 ec 04             	sub    $0x4,%esp
+  800f38:	ff 75 10             	push   0x10(%ebp)
+  800f3b:	ff 75 0c             	push   0xc(%ebp)
+  800f3e:	50                   	push   %eax
+  800f3f:	e8 0e 01 00 00       	call   801052 <nsipc_accept>
+  800f44:	83 c4 10             	add    $0x10,%esp
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	78 05                	js     800f50 <accept+0x2d>
+	return alloc_sockfd(r);
+  800f4b:	e8 5f ff ff ff       	call   800eaf <alloc_sockfd>
+}
+  800f50:	c9                   	leave
+  800f51:	c3                   	ret
+
+00800f52 <bind>:
+{
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f5b:	e8 1f ff ff ff       	call   800e7f <fd2sockid>
+  800f60:	85 c0                	test   %eax,%eax
+  800f62:	78 12                	js     800f76 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800f64:	83 ec 04             	sub    $0x4,%esp
+  800f67:	ff 75 10             	push   0x10(%ebp)
+  800f6a:	ff 75 0c             	push   0xc(%ebp)
+  800f6d:	50                   	push   %eax
+  800f6e:	e8 31 01 00 00       	call   8010a4 <nsipc_bind>
+  800f73:	83 c4 10             	add    $0x10,%esp
+}
+  800f76:	c9                   	leave
+  800f77:	c3                   	ret
+
+00800f78 <shutdown>:
+{
+  800f78:	55                   	push   %ebp
+  800f79:	89 e5                	mov    %esp,%ebp
+  800f7b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f81:	e8 f9 fe ff ff       	call   800e7f <fd2sockid>
+  800f86:	85 c0                	test   %eax,%eax
+  800f88:	78 0f                	js     800f99 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800f8a:	83 ec 08             	sub    $0x8,%esp
+  800f8d:	ff 75 0c             	push   0xc(%ebp)
+  800f90:	50                   	push   %eax
+  800f91:	e8 43 01 00 00       	call   8010d9 <nsipc_shutdown>
+  800f96:	83 c4 10             	add    $0x10,%esp
+}
+  800f99:	c9                   	leave
+  800f9a:	c3                   	ret
+
+00800f9b <connect>:
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800fa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa4:	e8 d6 fe ff ff       	call   800e7f <fd2sockid>
+  800fa9:	85 c0                	test   %eax,%eax
+  800fab:	78 12                	js     800fbf <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800fad:	83 ec 04             	sub    $0x4,%esp
+  800fb0:	ff 75 10             	push   0x10(%ebp)
+  800fb3:	ff 75 0c             	push   0xc(%ebp)
+  800fb6:	50                   	push   %eax
+  800fb7:	e8 59 01 00 00       	call   801115 <nsipc_connect>
+  800fbc:	83 c4 10             	add    $0x10,%esp
+}
+  800fbf:	c9                   	leave
+  800fc0:	c3                   	ret
+
+00800fc1 <listen>:
+{
+  800fc1:	55                   	push   %ebp
+  800fc2:	89 e5                	mov    %esp,%ebp
+  800fc4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800fc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fca:	e8 b0 fe ff ff       	call   800e7f <fd2sockid>
+  800fcf:	85 c0                	test   %eax,%eax
+  800fd1:	78 0f                	js     800fe2 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800fd3:	83 ec 08             	sub    $0x8,%esp
+  800fd6:	ff 75 0c             	push   0xc(%ebp)
+  800fd9:	50                   	push   %eax
+  800fda:	e8 6b 01 00 00       	call   80114a <nsipc_listen>
+  800fdf:	83 c4 10             	add    $0x10,%esp
+}
+  800fe2:	c9                   	leave
+  800fe3:	c3                   	ret
+
+00800fe4 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800fe4:	55                   	push   %ebp
+  800fe5:	89 e5                	mov    %esp,%ebp
+  800fe7:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800fea:	ff 75 10             	push   0x10(%ebp)
+  800fed:	ff 75 0c             	push   0xc(%ebp)
+  800ff0:	ff 75 08             	push   0x8(%ebp)
+  800ff3:	e8 41 02 00 00       	call   801239 <nsipc_socket>
+  800ff8:	83 c4 10             	add    $0x10,%esp
+  800ffb:	85 c0                	test   %eax,%eax
+  800ffd:	78 05                	js     801004 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800fff:	e8 ab fe ff ff       	call   800eaf <alloc_sockfd>
+}
+  801004:	c9                   	leave
+  801005:	c3                   	ret
+
+00801006 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801006:	55                   	push   %ebp
+  801007:	89 e5                	mov    %esp,%ebp
+  801009:	53                   	push   %ebx
+  80100a:	83 ec 04             	sub    $0x4,%esp
+  80100d:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80100f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801016:	74 26                	je     80103e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801018:	6a 07                	push   $0x7
+  80101a:	68 00 60 80 00       	push   $0x806000
+  80101f:	53                   	push   %ebx
+  801020:	ff 35 04 40 80 00    	push   0x804004
+  801026:	e8 67 11 00 00       	call   802192 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80102b:	83 c4 0c             	add    $0xc,%esp
+  80102e:	6a 00                	push   $0x0
+  801030:	6a 00                	push   $0x0
+  801032:	6a 00                	push   $0x0
+  801034:	e8 e1 10 00 00       	call   80211a <ipc_recv>
+}
+  801039:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80103c:	c9                   	leave
+  80103d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80103e:	83 ec 0c             	sub    $0xc,%esp
+  801041:	6a 02                	push   $0x2
+  801043:	e8 9e 11 00 00       	call   8021e6 <ipc_find_env>
+  801048:	a3 04 40 80 00       	mov    %eax,0x804004
+  80104d:	83 c4 10             	add    $0x10,%esp
+  801050:	eb c6                	jmp    801018 <nsipc+0x12>
+
+00801052 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801052:	55                   	push   %ebp
+  801053:	89 e5                	mov    %esp,%ebp
+  801055:	56                   	push   %esi
+  801056:	53                   	push   %ebx
+  801057:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80105a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80105d:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801062:	8b 06                	mov    (%esi),%eax
+  801064:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801069:	b8 01 00 00 00       	mov    $0x1,%eax
+  80106e:	e8 93 ff ff ff       	call   801006 <nsipc>
+  801073:	89 c3                	mov    %eax,%ebx
+  801075:	85 c0                	test   %eax,%eax
+  801077:	79 09                	jns    801082 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801079:	89 d8                	mov    %ebx,%eax
+  80107b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80107e:	5b                   	pop    %ebx
+  80107f:	5e                   	pop    %esi
+  801080:	5d                   	pop    %ebp
+  801081:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801082:	83 ec 04             	sub    $0x4,%esp
+  801085:	ff 35 10 60 80 00    	push   0x806010
+  80108b:	68 00 60 80 00       	push   $0x806000
+  801090:	ff 75 0c             	push   0xc(%ebp)
+  801093:	e8 d8 0e 00 00       	call   801f70 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801098:	a1 10 60 80 00       	mov    0x806010,%eax
+  80109d:	89 06                	mov    %eax,(%esi)
+  80109f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8010a2:	eb d5                	jmp    801079 <nsipc_accept+0x27>
+
+008010a4 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8010a4:	55                   	push   %ebp
+  8010a5:	89 e5                	mov    %esp,%ebp
+  8010a7:	53                   	push   %ebx
+  8010a8:	83 ec 08             	sub    $0x8,%esp
+  8010ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8010ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010b1:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8010b6:	53                   	push   %ebx
+  8010b7:	ff 75 0c             	push   0xc(%ebp)
+  8010ba:	68 04 60 80 00       	push   $0x806004
+  8010bf:	e8 ac 0e 00 00       	call   801f70 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8010c4:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8010ca:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010cf:	e8 32 ff ff ff       	call   801006 <nsipc>
+}
+  8010d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010d7:	c9                   	leave
+  8010d8:	c3                   	ret
+
+008010d9 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8010d9:	55                   	push   %ebp
+  8010da:	89 e5                	mov    %esp,%ebp
+  8010dc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8010df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010e2:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8010e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010ea:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8010ef:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010f4:	e8 0d ff ff ff       	call   801006 <nsipc>
+}
+  8010f9:	c9                   	leave
+  8010fa:	c3                   	ret
+
+008010fb <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801101:	8b 45 08             	mov    0x8(%ebp),%eax
+  801104:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801109:	b8 04 00 00 00       	mov    $0x4,%eax
+  80110e:	e8 f3 fe ff ff       	call   801006 <nsipc>
+}
+  801113:	c9                   	leave
+  801114:	c3                   	ret
+
+00801115 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801115:	55                   	push   %ebp
+  801116:	89 e5                	mov    %esp,%ebp
+  801118:	53                   	push   %ebx
+  801119:	83 ec 08             	sub    $0x8,%esp
+  80111c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80111f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801122:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801127:	53                   	push   %ebx
+  801128:	ff 75 0c             	push   0xc(%ebp)
+  80112b:	68 04 60 80 00       	push   $0x806004
+  801130:	e8 3b 0e 00 00       	call   801f70 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801135:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  80113b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801140:	e8 c1 fe ff ff       	call   801006 <nsipc>
+}
+  801145:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801148:	c9                   	leave
+  801149:	c3                   	ret
+
+0080114a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80114a:	55                   	push   %ebp
+  80114b:	89 e5                	mov    %esp,%ebp
+  80114d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801150:	8b 45 08             	mov    0x8(%ebp),%eax
+  801153:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801158:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80115b:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801160:	b8 06 00 00 00       	mov    $0x6,%eax
+  801165:	e8 9c fe ff ff       	call   801006 <nsipc>
+}
+  80116a:	c9                   	leave
+  80116b:	c3                   	ret
+
+0080116c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80116c:	55                   	push   %ebp
+  80116d:	89 e5                	mov    %esp,%ebp
+  80116f:	56                   	push   %esi
+  801170:	53                   	push   %ebx
+  801171:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801174:	8b 45 08             	mov    0x8(%ebp),%eax
+  801177:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  80117c:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801182:	8b 45 14             	mov    0x14(%ebp),%eax
+  801185:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80118a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80118f:	e8 72 fe ff ff       	call   801006 <nsipc>
+  801194:	89 c3                	mov    %eax,%ebx
+  801196:	85 c0                	test   %eax,%eax
+  801198:	78 22                	js     8011bc <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80119a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80119f:	39 c6                	cmp    %eax,%esi
+  8011a1:	0f 4e c6             	cmovle %esi,%eax
+  8011a4:	39 c3                	cmp    %eax,%ebx
+  8011a6:	7f 1d                	jg     8011c5 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8011a8:	83 ec 04             	sub    $0x4,%esp
+  8011ab:	53                   	push   %ebx
+  8011ac:	68 00 60 80 00       	push   $0x806000
+  8011b1:	ff 75 0c             	push   0xc(%ebp)
+  8011b4:	e8 b7 0d 00 00       	call   801f70 <memmove>
+  8011b9:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8011bc:	89 d8                	mov    %ebx,%eax
+  8011be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011c1:	5b                   	pop    %ebx
+  8011c2:	5e                   	pop    %esi
+  8011c3:	5d                   	pop    %ebp
+  8011c4:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8011c5:	68 93 27 80 00       	push   $0x802793
+  8011ca:	68 5b 27 80 00       	push   $0x80275b
+  8011cf:	6a 62                	push   $0x62
+  8011d1:	68 a8 27 80 00       	push   $0x8027a8
+  8011d6:	e8 46 05 00 00       	call   801721 <_panic>
+
+008011db <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	53                   	push   %ebx
+  8011df:	83 ec 04             	sub    $0x4,%esp
+  8011e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8011e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e8:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  8011ed:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8011f3:	7f 2e                	jg     801223 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8011f5:	83 ec 04             	sub    $0x4,%esp
+  8011f8:	53                   	push   %ebx
+  8011f9:	ff 75 0c             	push   0xc(%ebp)
+  8011fc:	68 0c 60 80 00       	push   $0x80600c
+  801201:	e8 6a 0d 00 00       	call   801f70 <memmove>
+	nsipcbuf.send.req_size = size;
+  801206:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  80120c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80120f:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801214:	b8 08 00 00 00       	mov    $0x8,%eax
+  801219:	e8 e8 fd ff ff       	call   801006 <nsipc>
+}
+  80121e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801221:	c9                   	leave
+  801222:	c3                   	ret
+	assert(size < 1600);
+  801223:	68 b4 27 80 00       	push   $0x8027b4
+  801228:	68 5b 27 80 00       	push   $0x80275b
+  80122d:	6a 6d                	push   $0x6d
+  80122f:	68 a8 27 80 00       	push   $0x8027a8
+  801234:	e8 e8 04 00 00       	call   801721 <_panic>
+
+00801239 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801239:	55                   	push   %ebp
+  80123a:	89 e5                	mov    %esp,%ebp
+  80123c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80123f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801242:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801247:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80124a:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  80124f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801252:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801257:	b8 09 00 00 00       	mov    $0x9,%eax
+  80125c:	e8 a5 fd ff ff       	call   801006 <nsipc>
+}
+  801261:	c9                   	leave
+  801262:	c3                   	ret
+
+00801263 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	56                   	push   %esi
+  801267:	53                   	push   %ebx
+  801268:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80126b:	83 ec 0c             	sub    $0xc,%esp
+  80126e:	ff 75 08             	push   0x8(%ebp)
+  801271:	e8 aa f3 ff ff       	call   800620 <fd2data>
+  801276:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801278:	83 c4 08             	add    $0x8,%esp
+  80127b:	68 c0 27 80 00       	push   $0x8027c0
+  801280:	53                   	push   %ebx
+  801281:	e8 64 0b 00 00       	call   801dea <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801286:	8b 46 04             	mov    0x4(%esi),%eax
+  801289:	2b 06                	sub    (%esi),%eax
+  80128b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801291:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801298:	00 00 00 
+	stat->st_dev = &devpipe;
+  80129b:	c7 83 88 00 00 00 40 	movl   $0x803040,0x88(%ebx)
+  8012a2:	30 80 00 
+	return 0;
+}
+  8012a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012ad:	5b                   	pop    %ebx
+  8012ae:	5e                   	pop    %esi
+  8012af:	5d                   	pop    %ebp
+  8012b0:	c3                   	ret
+
+008012b1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8012b1:	55                   	push   %ebp
+  8012b2:	89 e5                	mov    %esp,%ebp
+  8012b4:	53                   	push   %ebx
+  8012b5:	83 ec 0c             	sub    $0xc,%esp
+  8012b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8012bb:	53                   	push   %ebx
+  8012bc:	6a 00                	push   $0x0
+  8012be:	e8 f0 ef ff ff       	call   8002b3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8012c3:	89 1c 24             	mov    %ebx,(%esp)
+  8012c6:	e8 55 f3 ff ff       	call   800620 <fd2data>
+  8012cb:	83 c4 08             	add    $0x8,%esp
+  8012ce:	50                   	push   %eax
+  8012cf:	6a 00                	push   $0x0
+  8012d1:	e8 dd ef ff ff       	call   8002b3 <sys_page_unmap>
+}
+  8012d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012d9:	c9                   	leave
+  8012da:	c3                   	ret
+
+008012db <_pipeisclosed>:
+{
+  8012db:	55                   	push   %ebp
+  8012dc:	89 e5                	mov    %esp,%ebp
+  8012de:	57                   	push   %edi
+  8012df:	56                   	push   %esi
+  8012e0:	53                   	push   %ebx
+  8012e1:	83 ec 1c             	sub    $0x1c,%esp
+  8012e4:	89 c7                	mov    %eax,%edi
+  8012e6:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8012e8:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012ed:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8012f0:	83 ec 0c             	sub    $0xc,%esp
+  8012f3:	57                   	push   %edi
+  8012f4:	e8 fd 0e 00 00       	call   8021f6 <pageref>
+  8012f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012fc:	89 34 24             	mov    %esi,(%esp)
+  8012ff:	e8 f2 0e 00 00       	call   8021f6 <pageref>
+		nn = thisenv->env_runs;
+  801304:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80130a:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  80130d:	83 c4 10             	add    $0x10,%esp
+  801310:	39 cb                	cmp    %ecx,%ebx
+  801312:	74 1b                	je     80132f <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801314:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801317:	75 cf                	jne    8012e8 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801319:	8b 42 5c             	mov    0x5c(%edx),%eax
+  80131c:	6a 01                	push   $0x1
+  80131e:	50                   	push   %eax
+  80131f:	53                   	push   %ebx
+  801320:	68 c7 27 80 00       	push   $0x8027c7
+  801325:	e8 d2 04 00 00       	call   8017fc <cprintf>
+  80132a:	83 c4 10             	add    $0x10,%esp
+  80132d:	eb b9                	jmp    8012e8 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80132f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801332:	0f 94 c0             	sete   %al
+  801335:	0f b6 c0             	movzbl %al,%eax
+}
+  801338:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80133b:	5b                   	pop    %ebx
+  80133c:	5e                   	pop    %esi
+  80133d:	5f                   	pop    %edi
+  80133e:	5d                   	pop    %ebp
+  80133f:	c3                   	ret
+
+00801340 <devpipe_write>:
+{
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	57                   	push   %edi
+  801344:	56                   	push   %esi
+  801345:	53                   	push   %ebx
+  801346:	83 ec 28             	sub    $0x28,%esp
+  801349:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80134c:	56                   	push   %esi
+  80134d:	e8 ce f2 ff ff       	call   800620 <fd2data>
+  801352:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801354:	83 c4 10             	add    $0x10,%esp
+  801357:	bf 00 00 00 00       	mov    $0x0,%edi
+  80135c:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80135f:	75 09                	jne    80136a <devpipe_write+0x2a>
+	return i;
+  801361:	89 f8                	mov    %edi,%eax
+  801363:	eb 23                	jmp    801388 <devpipe_write+0x48>
+			sys_yield();
+  801365:	e8 01 ee ff ff       	call   80016b <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80136a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80136d:	8b 0b                	mov    (%ebx),%ecx
+  80136f:	8d 51 20             	lea    0x20(%ecx),%edx
+  801372:	39 d0                	cmp    %edx,%eax
+  801374:	72 1a                	jb     801390 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801376:	89 da                	mov    %ebx,%edx
+  801378:	89 f0                	mov    %esi,%eax
+  80137a:	e8 5c ff ff ff       	call   8012db <_pipeisclosed>
+  80137f:	85 c0                	test   %eax,%eax
+  801381:	74 e2                	je     801365 <devpipe_write+0x25>
+				return 0;
+  801383:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138b:	5b                   	pop    %ebx
+  80138c:	5e                   	pop    %esi
+  80138d:	5f                   	pop    %edi
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801390:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801393:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801397:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80139a:	89 c2                	mov    %eax,%edx
+  80139c:	c1 fa 1f             	sar    $0x1f,%edx
+  80139f:	89 d1                	mov    %edx,%ecx
+  8013a1:	c1 e9 1b             	shr    $0x1b,%ecx
+  8013a4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8013a7:	83 e2 1f             	and    $0x1f,%edx
+  8013aa:	29 ca                	sub    %ecx,%edx
+  8013ac:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8013b0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8013b4:	83 c0 01             	add    $0x1,%eax
+  8013b7:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8013ba:	83 c7 01             	add    $0x1,%edi
+  8013bd:	eb 9d                	jmp    80135c <devpipe_write+0x1c>
+
+008013bf <devpipe_read>:
+{
+  8013bf:	55                   	push   %ebp
+  8013c0:	89 e5                	mov    %esp,%ebp
+  8013c2:	57                   	push   %edi
+  8013c3:	56                   	push   %esi
+  8013c4:	53                   	push   %ebx
+  8013c5:	83 ec 18             	sub    $0x18,%esp
+  8013c8:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8013cb:	57                   	push   %edi
+  8013cc:	e8 4f f2 ff ff       	call   800620 <fd2data>
+  8013d1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8013d3:	83 c4 10             	add    $0x10,%esp
+  8013d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013db:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8013de:	75 13                	jne    8013f3 <devpipe_read+0x34>
+	return i;
+  8013e0:	89 f0                	mov    %esi,%eax
+  8013e2:	eb 02                	jmp    8013e6 <devpipe_read+0x27>
+				return i;
+  8013e4:	89 f0                	mov    %esi,%eax
+}
+  8013e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e9:	5b                   	pop    %ebx
+  8013ea:	5e                   	pop    %esi
+  8013eb:	5f                   	pop    %edi
+  8013ec:	5d                   	pop    %ebp
+  8013ed:	c3                   	ret
+			sys_yield();
+  8013ee:	e8 78 ed ff ff       	call   80016b <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8013f3:	8b 03                	mov    (%ebx),%eax
+  8013f5:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8013f8:	75 18                	jne    801412 <devpipe_read+0x53>
+			if (i > 0)
+  8013fa:	85 f6                	test   %esi,%esi
+  8013fc:	75 e6                	jne    8013e4 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8013fe:	89 da                	mov    %ebx,%edx
+  801400:	89 f8                	mov    %edi,%eax
+  801402:	e8 d4 fe ff ff       	call   8012db <_pipeisclosed>
+  801407:	85 c0                	test   %eax,%eax
+  801409:	74 e3                	je     8013ee <devpipe_read+0x2f>
+				return 0;
+  80140b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801410:	eb d4                	jmp    8013e6 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801412:	99                   	cltd
+  801413:	c1 ea 1b             	shr    $0x1b,%edx
+  801416:	01 d0                	add    %edx,%eax
+  801418:	83 e0 1f             	and    $0x1f,%eax
+  80141b:	29 d0                	sub    %edx,%eax
+  80141d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801422:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801425:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801428:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80142b:	83 c6 01             	add    $0x1,%esi
+  80142e:	eb ab                	jmp    8013db <devpipe_read+0x1c>
+
+00801430 <pipe>:
+{
+  801430:	55                   	push   %ebp
+  801431:	89 e5                	mov    %esp,%ebp
+  801433:	56                   	push   %esi
+  801434:	53                   	push   %ebx
+  801435:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801438:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80143b:	50                   	push   %eax
+  80143c:	e8 f6 f1 ff ff       	call   800637 <fd_alloc>
+  801441:	89 c3                	mov    %eax,%ebx
+  801443:	83 c4 10             	add    $0x10,%esp
+  801446:	85 c0                	test   %eax,%eax
+  801448:	0f 88 23 01 00 00    	js     801571 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80144e:	83 ec 04             	sub    $0x4,%esp
+  801451:	68 07 04 00 00       	push   $0x407
+  801456:	ff 75 f4             	push   -0xc(%ebp)
+  801459:	6a 00                	push   $0x0
+  80145b:	e8 8b ed ff ff       	call   8001eb <sys_page_alloc>
+  801460:	89 c3                	mov    %eax,%ebx
+  801462:	83 c4 10             	add    $0x10,%esp
+  801465:	85 c0                	test   %eax,%eax
+  801467:	0f 88 04 01 00 00    	js     801571 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80146d:	83 ec 0c             	sub    $0xc,%esp
+  801470:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801473:	50                   	push   %eax
+  801474:	e8 be f1 ff ff       	call   800637 <fd_alloc>
+  801479:	89 c3                	mov    %eax,%ebx
+  80147b:	83 c4 10             	add    $0x10,%esp
+  80147e:	85 c0                	test   %eax,%eax
+  801480:	0f 88 db 00 00 00    	js     801561 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801486:	83 ec 04             	sub    $0x4,%esp
+  801489:	68 07 04 00 00       	push   $0x407
+  80148e:	ff 75 f0             	push   -0x10(%ebp)
+  801491:	6a 00                	push   $0x0
+  801493:	e8 53 ed ff ff       	call   8001eb <sys_page_alloc>
+  801498:	89 c3                	mov    %eax,%ebx
+  80149a:	83 c4 10             	add    $0x10,%esp
+  80149d:	85 c0                	test   %eax,%eax
+  80149f:	0f 88 bc 00 00 00    	js     801561 <pipe+0x131>
+	va = fd2data(fd0);
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	ff 75 f4             	push   -0xc(%ebp)
+  8014ab:	e8 70 f1 ff ff       	call   800620 <fd2data>
+  8014b0:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014b2:	83 c4 0c             	add    $0xc,%esp
+  8014b5:	68 07 04 00 00       	push   $0x407
+  8014ba:	50                   	push   %eax
+  8014bb:	6a 00                	push   $0x0
+  8014bd:	e8 29 ed ff ff       	call   8001eb <sys_page_alloc>
+  8014c2:	89 c3                	mov    %eax,%ebx
+  8014c4:	83 c4 10             	add    $0x10,%esp
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	0f 88 82 00 00 00    	js     801551 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014cf:	83 ec 0c             	sub    $0xc,%esp
+  8014d2:	ff 75 f0             	push   -0x10(%ebp)
+  8014d5:	e8 46 f1 ff ff       	call   800620 <fd2data>
+  8014da:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014e1:	50                   	push   %eax
+  8014e2:	6a 00                	push   $0x0
+  8014e4:	56                   	push   %esi
+  8014e5:	6a 00                	push   $0x0
+  8014e7:	e8 85 ed ff ff       	call   800271 <sys_page_map>
+  8014ec:	89 c3                	mov    %eax,%ebx
+  8014ee:	83 c4 20             	add    $0x20,%esp
+  8014f1:	85 c0                	test   %eax,%eax
+  8014f3:	78 4e                	js     801543 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014f5:	a1 40 30 80 00       	mov    0x803040,%eax
+  8014fa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014fd:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014ff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801502:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801509:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80150c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80150e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801511:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801518:	83 ec 0c             	sub    $0xc,%esp
+  80151b:	ff 75 f4             	push   -0xc(%ebp)
+  80151e:	e8 ed f0 ff ff       	call   800610 <fd2num>
+  801523:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801526:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801528:	83 c4 04             	add    $0x4,%esp
+  80152b:	ff 75 f0             	push   -0x10(%ebp)
+  80152e:	e8 dd f0 ff ff       	call   800610 <fd2num>
+  801533:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801536:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801539:	83 c4 10             	add    $0x10,%esp
+  80153c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801541:	eb 2e                	jmp    801571 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801543:	83 ec 08             	sub    $0x8,%esp
+  801546:	56                   	push   %esi
+  801547:	6a 00                	push   $0x0
+  801549:	e8 65 ed ff ff       	call   8002b3 <sys_page_unmap>
+  80154e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801551:	83 ec 08             	sub    $0x8,%esp
+  801554:	ff 75 f0             	push   -0x10(%ebp)
+  801557:	6a 00                	push   $0x0
+  801559:	e8 55 ed ff ff       	call   8002b3 <sys_page_unmap>
+  80155e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801561:	83 ec 08             	sub    $0x8,%esp
+  801564:	ff 75 f4             	push   -0xc(%ebp)
+  801567:	6a 00                	push   $0x0
+  801569:	e8 45 ed ff ff       	call   8002b3 <sys_page_unmap>
+  80156e:	83 c4 10             	add    $0x10,%esp
+}
+  801571:	89 d8                	mov    %ebx,%eax
+  801573:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801576:	5b                   	pop    %ebx
+  801577:	5e                   	pop    %esi
+  801578:	5d                   	pop    %ebp
+  801579:	c3                   	ret
+
+0080157a <pipeisclosed>:
+{
+  80157a:	55                   	push   %ebp
+  80157b:	89 e5                	mov    %esp,%ebp
+  80157d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801580:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801583:	50                   	push   %eax
+  801584:	ff 75 08             	push   0x8(%ebp)
+  801587:	e8 01 f1 ff ff       	call   80068d <fd_lookup>
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	85 c0                	test   %eax,%eax
+  801591:	78 18                	js     8015ab <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801593:	83 ec 0c             	sub    $0xc,%esp
+  801596:	ff 75 f4             	push   -0xc(%ebp)
+  801599:	e8 82 f0 ff ff       	call   800620 <fd2data>
+  80159e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8015a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015a3:	e8 33 fd ff ff       	call   8012db <_pipeisclosed>
+  8015a8:	83 c4 10             	add    $0x10,%esp
+}
+  8015ab:	c9                   	leave
+  8015ac:	c3                   	ret
+
+008015ad <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8015ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b2:	c3                   	ret
+
+008015b3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015b3:	55                   	push   %ebp
+  8015b4:	89 e5                	mov    %esp,%ebp
+  8015b6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015b9:	68 df 27 80 00       	push   $0x8027df
+  8015be:	ff 75 0c             	push   0xc(%ebp)
+  8015c1:	e8 24 08 00 00       	call   801dea <strcpy>
+	return 0;
+}
+  8015c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cb:	c9                   	leave
+  8015cc:	c3                   	ret
+
+008015cd <devcons_write>:
+{
+  8015cd:	55                   	push   %ebp
+  8015ce:	89 e5                	mov    %esp,%ebp
+  8015d0:	57                   	push   %edi
+  8015d1:	56                   	push   %esi
+  8015d2:	53                   	push   %ebx
+  8015d3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015d9:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015de:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015e4:	eb 2e                	jmp    801614 <devcons_write+0x47>
+		m = n - tot;
+  8015e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e9:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015eb:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015f0:	39 c3                	cmp    %eax,%ebx
+  8015f2:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015f5:	83 ec 04             	sub    $0x4,%esp
+  8015f8:	53                   	push   %ebx
+  8015f9:	89 f0                	mov    %esi,%eax
+  8015fb:	03 45 0c             	add    0xc(%ebp),%eax
+  8015fe:	50                   	push   %eax
+  8015ff:	57                   	push   %edi
+  801600:	e8 6b 09 00 00       	call   801f70 <memmove>
+		sys_cputs(buf, m);
+  801605:	83 c4 08             	add    $0x8,%esp
+  801608:	53                   	push   %ebx
+  801609:	57                   	push   %edi
+  80160a:	e8 9f ea ff ff       	call   8000ae <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80160f:	01 de                	add    %ebx,%esi
+  801611:	83 c4 10             	add    $0x10,%esp
+  801614:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801617:	72 cd                	jb     8015e6 <devcons_write+0x19>
+}
+  801619:	89 f0                	mov    %esi,%eax
+  80161b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161e:	5b                   	pop    %ebx
+  80161f:	5e                   	pop    %esi
+  801620:	5f                   	pop    %edi
+  801621:	5d                   	pop    %ebp
+  801622:	c3                   	ret
+
+00801623 <devcons_read>:
+{
+  801623:	55                   	push   %ebp
+  801624:	89 e5                	mov    %esp,%ebp
+  801626:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801632:	75 07                	jne    80163b <devcons_read+0x18>
+  801634:	eb 1f                	jmp    801655 <devcons_read+0x32>
+		sys_yield();
+  801636:	e8 30 eb ff ff       	call   80016b <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80163b:	e8 8c ea ff ff       	call   8000cc <sys_cgetc>
+  801640:	85 c0                	test   %eax,%eax
+  801642:	74 f2                	je     801636 <devcons_read+0x13>
+	if (c < 0)
+  801644:	78 0f                	js     801655 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801646:	83 f8 04             	cmp    $0x4,%eax
+  801649:	74 0c                	je     801657 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80164b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80164e:	88 02                	mov    %al,(%edx)
+	return 1;
+  801650:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801655:	c9                   	leave
+  801656:	c3                   	ret
+		return 0;
+  801657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165c:	eb f7                	jmp    801655 <devcons_read+0x32>
+
+0080165e <cputchar>:
+{
+  80165e:	55                   	push   %ebp
+  80165f:	89 e5                	mov    %esp,%ebp
+  801661:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801664:	8b 45 08             	mov    0x8(%ebp),%eax
+  801667:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80166a:	6a 01                	push   $0x1
+  80166c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80166f:	50                   	push   %eax
+  801670:	e8 39 ea ff ff       	call   8000ae <sys_cputs>
+}
+  801675:	83 c4 10             	add    $0x10,%esp
+  801678:	c9                   	leave
+  801679:	c3                   	ret
+
+0080167a <getchar>:
+{
+  80167a:	55                   	push   %ebp
+  80167b:	89 e5                	mov    %esp,%ebp
+  80167d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801680:	6a 01                	push   $0x1
+  801682:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801685:	50                   	push   %eax
+  801686:	6a 00                	push   $0x0
+  801688:	e8 66 f2 ff ff       	call   8008f3 <read>
+	if (r < 0)
+  80168d:	83 c4 10             	add    $0x10,%esp
+  801690:	85 c0                	test   %eax,%eax
+  801692:	78 06                	js     80169a <getchar+0x20>
+	if (r < 1)
+  801694:	74 06                	je     80169c <getchar+0x22>
+	return c;
+  801696:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80169a:	c9                   	leave
+  80169b:	c3                   	ret
+		return -E_EOF;
+  80169c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8016a1:	eb f7                	jmp    80169a <getchar+0x20>
+
+008016a3 <iscons>:
+{
+  8016a3:	55                   	push   %ebp
+  8016a4:	89 e5                	mov    %esp,%ebp
+  8016a6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ac:	50                   	push   %eax
+  8016ad:	ff 75 08             	push   0x8(%ebp)
+  8016b0:	e8 d8 ef ff ff       	call   80068d <fd_lookup>
+  8016b5:	83 c4 10             	add    $0x10,%esp
+  8016b8:	85 c0                	test   %eax,%eax
+  8016ba:	78 11                	js     8016cd <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016bf:	8b 15 5c 30 80 00    	mov    0x80305c,%edx
+  8016c5:	39 10                	cmp    %edx,(%eax)
+  8016c7:	0f 94 c0             	sete   %al
+  8016ca:	0f b6 c0             	movzbl %al,%eax
+}
+  8016cd:	c9                   	leave
+  8016ce:	c3                   	ret
+
+008016cf <opencons>:
+{
+  8016cf:	55                   	push   %ebp
+  8016d0:	89 e5                	mov    %esp,%ebp
+  8016d2:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d8:	50                   	push   %eax
+  8016d9:	e8 59 ef ff ff       	call   800637 <fd_alloc>
+  8016de:	83 c4 10             	add    $0x10,%esp
+  8016e1:	85 c0                	test   %eax,%eax
+  8016e3:	78 3a                	js     80171f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016e5:	83 ec 04             	sub    $0x4,%esp
+  8016e8:	68 07 04 00 00       	push   $0x407
+  8016ed:	ff 75 f4             	push   -0xc(%ebp)
+  8016f0:	6a 00                	push   $0x0
+  8016f2:	e8 f4 ea ff ff       	call   8001eb <sys_page_alloc>
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	78 21                	js     80171f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801701:	8b 15 5c 30 80 00    	mov    0x80305c,%edx
+  801707:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801709:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801713:	83 ec 0c             	sub    $0xc,%esp
+  801716:	50                   	push   %eax
+  801717:	e8 f4 ee ff ff       	call   800610 <fd2num>
+  80171c:	83 c4 10             	add    $0x10,%esp
+}
+  80171f:	c9                   	leave
+  801720:	c3                   	ret
+
+00801721 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	56                   	push   %esi
+  801725:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801726:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801729:	8b 35 04 30 80 00    	mov    0x803004,%esi
+  80172f:	e8 18 ea ff ff       	call   80014c <sys_getenvid>
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	ff 75 0c             	push   0xc(%ebp)
+  80173a:	ff 75 08             	push   0x8(%ebp)
+  80173d:	56                   	push   %esi
+  80173e:	50                   	push   %eax
+  80173f:	68 ec 27 80 00       	push   $0x8027ec
+  801744:	e8 b3 00 00 00       	call   8017fc <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801749:	83 c4 18             	add    $0x18,%esp
+  80174c:	53                   	push   %ebx
+  80174d:	ff 75 10             	push   0x10(%ebp)
+  801750:	e8 56 00 00 00       	call   8017ab <vcprintf>
+	cprintf("\n");
+  801755:	c7 04 24 d8 27 80 00 	movl   $0x8027d8,(%esp)
+  80175c:	e8 9b 00 00 00       	call   8017fc <cprintf>
+  801761:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801764:	cc                   	int3
+	while (1)
+  801765:	eb fd                	jmp    801764 <_panic+0x43>
+
+00801767 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801767:	55                   	push   %ebp
+  801768:	89 e5                	mov    %esp,%ebp
+  80176a:	53                   	push   %ebx
+  80176b:	83 ec 04             	sub    $0x4,%esp
+  80176e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801771:	8b 13                	mov    (%ebx),%edx
+  801773:	8d 42 01             	lea    0x1(%edx),%eax
+  801776:	89 03                	mov    %eax,(%ebx)
+  801778:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80177b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80177f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801784:	74 09                	je     80178f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801786:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80178a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80178d:	c9                   	leave
+  80178e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80178f:	83 ec 08             	sub    $0x8,%esp
+  801792:	68 ff 00 00 00       	push   $0xff
+  801797:	8d 43 08             	lea    0x8(%ebx),%eax
+  80179a:	50                   	push   %eax
+  80179b:	e8 0e e9 ff ff       	call   8000ae <sys_cputs>
+		b->idx = 0;
+  8017a0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8017a6:	83 c4 10             	add    $0x10,%esp
+  8017a9:	eb db                	jmp    801786 <putch+0x1f>
+
+008017ab <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8017ab:	55                   	push   %ebp
+  8017ac:	89 e5                	mov    %esp,%ebp
+  8017ae:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017b4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017bb:	00 00 00 
+	b.cnt = 0;
+  8017be:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017c5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017c8:	ff 75 0c             	push   0xc(%ebp)
+  8017cb:	ff 75 08             	push   0x8(%ebp)
+  8017ce:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017d4:	50                   	push   %eax
+  8017d5:	68 67 17 80 00       	push   $0x801767
+  8017da:	e8 14 01 00 00       	call   8018f3 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017df:	83 c4 08             	add    $0x8,%esp
+  8017e2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017e8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017ee:	50                   	push   %eax
+  8017ef:	e8 ba e8 ff ff       	call   8000ae <sys_cputs>
+
+	return b.cnt;
+}
+  8017f4:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017fa:	c9                   	leave
+  8017fb:	c3                   	ret
+
+008017fc <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017fc:	55                   	push   %ebp
+  8017fd:	89 e5                	mov    %esp,%ebp
+  8017ff:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801802:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801805:	50                   	push   %eax
+  801806:	ff 75 08             	push   0x8(%ebp)
+  801809:	e8 9d ff ff ff       	call   8017ab <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80180e:	c9                   	leave
+  80180f:	c3                   	ret
+
+00801810 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801810:	55                   	push   %ebp
+  801811:	89 e5                	mov    %esp,%ebp
+  801813:	57                   	push   %edi
+  801814:	56                   	push   %esi
+  801815:	53                   	push   %ebx
+  801816:	83 ec 1c             	sub    $0x1c,%esp
+  801819:	89 c7                	mov    %eax,%edi
+  80181b:	89 d6                	mov    %edx,%esi
+  80181d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801820:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801823:	89 d1                	mov    %edx,%ecx
+  801825:	89 c2                	mov    %eax,%edx
+  801827:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80182a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80182d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801830:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801833:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801836:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80183d:	39 c2                	cmp    %eax,%edx
+  80183f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801842:	72 3e                	jb     801882 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801844:	83 ec 0c             	sub    $0xc,%esp
+  801847:	ff 75 18             	push   0x18(%ebp)
+  80184a:	83 eb 01             	sub    $0x1,%ebx
+  80184d:	53                   	push   %ebx
+  80184e:	50                   	push   %eax
+  80184f:	83 ec 08             	sub    $0x8,%esp
+  801852:	ff 75 e4             	push   -0x1c(%ebp)
+  801855:	ff 75 e0             	push   -0x20(%ebp)
+  801858:	ff 75 dc             	push   -0x24(%ebp)
+  80185b:	ff 75 d8             	push   -0x28(%ebp)
+  80185e:	e8 ad 0a 00 00       	call   802310 <__udivdi3>
+  801863:	83 c4 18             	add    $0x18,%esp
+  801866:	52                   	push   %edx
+  801867:	50                   	push   %eax
+  801868:	89 f2                	mov    %esi,%edx
+  80186a:	89 f8                	mov    %edi,%eax
+  80186c:	e8 9f ff ff ff       	call   801810 <printnum>
+  801871:	83 c4 20             	add    $0x20,%esp
+  801874:	eb 13                	jmp    801889 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801876:	83 ec 08             	sub    $0x8,%esp
+  801879:	56                   	push   %esi
+  80187a:	ff 75 18             	push   0x18(%ebp)
+  80187d:	ff d7                	call   *%edi
+  80187f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801882:	83 eb 01             	sub    $0x1,%ebx
+  801885:	85 db                	test   %ebx,%ebx
+  801887:	7f ed                	jg     801876 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801889:	83 ec 08             	sub    $0x8,%esp
+  80188c:	56                   	push   %esi
+  80188d:	83 ec 04             	sub    $0x4,%esp
+  801890:	ff 75 e4             	push   -0x1c(%ebp)
+  801893:	ff 75 e0             	push   -0x20(%ebp)
+  801896:	ff 75 dc             	push   -0x24(%ebp)
+  801899:	ff 75 d8             	push   -0x28(%ebp)
+  80189c:	e8 2f 0b 00 00       	call   8023d0 <__umoddi3>
+  8018a1:	83 c4 14             	add    $0x14,%esp
+  8018a4:	0f be 80 0f 28 80 00 	movsbl 0x80280f(%eax),%eax
+  8018ab:	50                   	push   %eax
+  8018ac:	ff d7                	call   *%edi
+}
+  8018ae:	83 c4 10             	add    $0x10,%esp
+  8018b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b4:	5b                   	pop    %ebx
+  8018b5:	5e                   	pop    %esi
+  8018b6:	5f                   	pop    %edi
+  8018b7:	5d                   	pop    %ebp
+  8018b8:	c3                   	ret
+
+008018b9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018b9:	55                   	push   %ebp
+  8018ba:	89 e5                	mov    %esp,%ebp
+  8018bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018bf:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018c3:	8b 10                	mov    (%eax),%edx
+  8018c5:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018c8:	73 0a                	jae    8018d4 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018ca:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018cd:	89 08                	mov    %ecx,(%eax)
+  8018cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d2:	88 02                	mov    %al,(%edx)
+}
+  8018d4:	5d                   	pop    %ebp
+  8018d5:	c3                   	ret
+
+008018d6 <printfmt>:
+{
+  8018d6:	55                   	push   %ebp
+  8018d7:	89 e5                	mov    %esp,%ebp
+  8018d9:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018dc:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018df:	50                   	push   %eax
+  8018e0:	ff 75 10             	push   0x10(%ebp)
+  8018e3:	ff 75 0c             	push   0xc(%ebp)
+  8018e6:	ff 75 08             	push   0x8(%ebp)
+  8018e9:	e8 05 00 00 00       	call   8018f3 <vprintfmt>
+}
+  8018ee:	83 c4 10             	add    $0x10,%esp
+  8018f1:	c9                   	leave
+  8018f2:	c3                   	ret
+
+008018f3 <vprintfmt>:
+{
+  8018f3:	55                   	push   %ebp
+  8018f4:	89 e5                	mov    %esp,%ebp
+  8018f6:	57                   	push   %edi
+  8018f7:	56                   	push   %esi
+  8018f8:	53                   	push   %ebx
+  8018f9:	83 ec 2c             	sub    $0x2c,%esp
+  8018fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801902:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801905:	eb 0a                	jmp    801911 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801907:	83 ec 08             	sub    $0x8,%esp
+  80190a:	53                   	push   %ebx
+  80190b:	50                   	push   %eax
+  80190c:	ff d6                	call   *%esi
+  80190e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801911:	83 c7 01             	add    $0x1,%edi
+  801914:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801918:	83 f8 25             	cmp    $0x25,%eax
+  80191b:	74 0c                	je     801929 <vprintfmt+0x36>
+			if (ch == '\0')
+  80191d:	85 c0                	test   %eax,%eax
+  80191f:	75 e6                	jne    801907 <vprintfmt+0x14>
+}
+  801921:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801924:	5b                   	pop    %ebx
+  801925:	5e                   	pop    %esi
+  801926:	5f                   	pop    %edi
+  801927:	5d                   	pop    %ebp
+  801928:	c3                   	ret
+		padc = ' ';
+  801929:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80192d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801934:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80193b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801942:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801947:	8d 47 01             	lea    0x1(%edi),%eax
+  80194a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80194d:	0f b6 17             	movzbl (%edi),%edx
+  801950:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801953:	3c 55                	cmp    $0x55,%al
+  801955:	0f 87 cf 03 00 00    	ja     801d2a <vprintfmt+0x437>
+  80195b:	0f b6 c0             	movzbl %al,%eax
+  80195e:	ff 24 85 60 29 80 00 	jmp    *0x802960(,%eax,4)
+  801965:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801968:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80196c:	eb d9                	jmp    801947 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80196e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801971:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801975:	eb d0                	jmp    801947 <vprintfmt+0x54>
+  801977:	0f b6 d2             	movzbl %dl,%edx
+  80197a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80197d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801982:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801985:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801988:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80198c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80198f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801992:	83 f9 09             	cmp    $0x9,%ecx
+  801995:	77 55                	ja     8019ec <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801997:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80199a:	eb e9                	jmp    801985 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80199c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199f:	8b 00                	mov    (%eax),%eax
+  8019a1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8019aa:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8019b0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019b4:	79 91                	jns    801947 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019b6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019bc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019c3:	eb 82                	jmp    801947 <vprintfmt+0x54>
+			if (width < 0)
+  8019c5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019c8:	85 d2                	test   %edx,%edx
+  8019ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cf:	0f 49 c2             	cmovns %edx,%eax
+  8019d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019d8:	e9 6a ff ff ff       	jmp    801947 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019e0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019e7:	e9 5b ff ff ff       	jmp    801947 <vprintfmt+0x54>
+  8019ec:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019ef:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019f2:	eb bc                	jmp    8019b0 <vprintfmt+0xbd>
+			lflag++;
+  8019f4:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019fa:	e9 48 ff ff ff       	jmp    801947 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a02:	8d 78 04             	lea    0x4(%eax),%edi
+  801a05:	83 ec 08             	sub    $0x8,%esp
+  801a08:	53                   	push   %ebx
+  801a09:	ff 30                	push   (%eax)
+  801a0b:	ff d6                	call   *%esi
+			break;
+  801a0d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801a10:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801a13:	e9 b1 02 00 00       	jmp    801cc9 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801a18:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a1b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a1e:	8b 10                	mov    (%eax),%edx
+  801a20:	89 d0                	mov    %edx,%eax
+  801a22:	f7 d8                	neg    %eax
+  801a24:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a27:	83 f8 0f             	cmp    $0xf,%eax
+  801a2a:	7f 23                	jg     801a4f <vprintfmt+0x15c>
+  801a2c:	8b 14 85 c0 2a 80 00 	mov    0x802ac0(,%eax,4),%edx
+  801a33:	85 d2                	test   %edx,%edx
+  801a35:	74 18                	je     801a4f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a37:	52                   	push   %edx
+  801a38:	68 6d 27 80 00       	push   $0x80276d
+  801a3d:	53                   	push   %ebx
+  801a3e:	56                   	push   %esi
+  801a3f:	e8 92 fe ff ff       	call   8018d6 <printfmt>
+  801a44:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a47:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a4a:	e9 7a 02 00 00       	jmp    801cc9 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801a4f:	50                   	push   %eax
+  801a50:	68 27 28 80 00       	push   $0x802827
+  801a55:	53                   	push   %ebx
+  801a56:	56                   	push   %esi
+  801a57:	e8 7a fe ff ff       	call   8018d6 <printfmt>
+  801a5c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a5f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a62:	e9 62 02 00 00       	jmp    801cc9 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a67:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a6a:	83 c0 04             	add    $0x4,%eax
+  801a6d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a70:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a73:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a75:	85 c9                	test   %ecx,%ecx
+  801a77:	b8 20 28 80 00       	mov    $0x802820,%eax
+  801a7c:	0f 45 c1             	cmovne %ecx,%eax
+  801a7f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a82:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a86:	7e 06                	jle    801a8e <vprintfmt+0x19b>
+  801a88:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a8c:	75 0b                	jne    801a99 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a8e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a91:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a94:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a97:	eb 5c                	jmp    801af5 <vprintfmt+0x202>
+  801a99:	83 ec 08             	sub    $0x8,%esp
+  801a9c:	ff 75 d0             	push   -0x30(%ebp)
+  801a9f:	ff 75 cc             	push   -0x34(%ebp)
+  801aa2:	e8 20 03 00 00       	call   801dc7 <strnlen>
+  801aa7:	89 c2                	mov    %eax,%edx
+  801aa9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aac:	29 d0                	sub    %edx,%eax
+  801aae:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801ab1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801ab5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ab8:	89 75 08             	mov    %esi,0x8(%ebp)
+  801abb:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801abd:	eb 0e                	jmp    801acd <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801abf:	83 ec 08             	sub    $0x8,%esp
+  801ac2:	53                   	push   %ebx
+  801ac3:	57                   	push   %edi
+  801ac4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ac7:	83 ee 01             	sub    $0x1,%esi
+  801aca:	83 c4 10             	add    $0x10,%esp
+  801acd:	85 f6                	test   %esi,%esi
+  801acf:	7f ee                	jg     801abf <vprintfmt+0x1cc>
+  801ad1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ad4:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ade:	0f 49 d0             	cmovns %eax,%edx
+  801ae1:	29 d0                	sub    %edx,%eax
+  801ae3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ae6:	eb a6                	jmp    801a8e <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ae8:	83 ec 08             	sub    $0x8,%esp
+  801aeb:	53                   	push   %ebx
+  801aec:	52                   	push   %edx
+  801aed:	ff 55 08             	call   *0x8(%ebp)
+  801af0:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801af3:	89 f1                	mov    %esi,%ecx
+  801af5:	8d 71 01             	lea    0x1(%ecx),%esi
+  801af8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801afc:	0f be d0             	movsbl %al,%edx
+  801aff:	85 d2                	test   %edx,%edx
+  801b01:	74 28                	je     801b2b <vprintfmt+0x238>
+  801b03:	85 ff                	test   %edi,%edi
+  801b05:	78 05                	js     801b0c <vprintfmt+0x219>
+  801b07:	83 ef 01             	sub    $0x1,%edi
+  801b0a:	78 30                	js     801b3c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801b0c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801b10:	74 d6                	je     801ae8 <vprintfmt+0x1f5>
+  801b12:	0f be c0             	movsbl %al,%eax
+  801b15:	83 e8 20             	sub    $0x20,%eax
+  801b18:	83 f8 5e             	cmp    $0x5e,%eax
+  801b1b:	76 cb                	jbe    801ae8 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b1d:	83 ec 08             	sub    $0x8,%esp
+  801b20:	53                   	push   %ebx
+  801b21:	6a 3f                	push   $0x3f
+  801b23:	ff 55 08             	call   *0x8(%ebp)
+  801b26:	83 c4 10             	add    $0x10,%esp
+  801b29:	eb c8                	jmp    801af3 <vprintfmt+0x200>
+  801b2b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b2e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b31:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b34:	01 d0                	add    %edx,%eax
+  801b36:	29 c8                	sub    %ecx,%eax
+  801b38:	89 c7                	mov    %eax,%edi
+  801b3a:	eb 13                	jmp    801b4f <vprintfmt+0x25c>
+  801b3c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b3f:	eb ed                	jmp    801b2e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b41:	83 ec 08             	sub    $0x8,%esp
+  801b44:	53                   	push   %ebx
+  801b45:	6a 20                	push   $0x20
+  801b47:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b49:	83 ef 01             	sub    $0x1,%edi
+  801b4c:	83 c4 10             	add    $0x10,%esp
+  801b4f:	85 ff                	test   %edi,%edi
+  801b51:	7f ee                	jg     801b41 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b53:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b56:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b59:	e9 6b 01 00 00       	jmp    801cc9 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801b5e:	83 f9 01             	cmp    $0x1,%ecx
+  801b61:	7f 1f                	jg     801b82 <vprintfmt+0x28f>
+	else if (lflag)
+  801b63:	85 c9                	test   %ecx,%ecx
+  801b65:	74 67                	je     801bce <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801b67:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b6a:	8b 00                	mov    (%eax),%eax
+  801b6c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b6f:	89 c1                	mov    %eax,%ecx
+  801b71:	c1 f9 1f             	sar    $0x1f,%ecx
+  801b74:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801b77:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b7a:	8d 40 04             	lea    0x4(%eax),%eax
+  801b7d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b80:	eb 17                	jmp    801b99 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801b82:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b85:	8b 50 04             	mov    0x4(%eax),%edx
+  801b88:	8b 00                	mov    (%eax),%eax
+  801b8a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b8d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b90:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b93:	8d 40 08             	lea    0x8(%eax),%eax
+  801b96:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b99:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b9c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b9f:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801ba4:	85 c9                	test   %ecx,%ecx
+  801ba6:	0f 89 03 01 00 00    	jns    801caf <vprintfmt+0x3bc>
+				putch('-', putdat);
+  801bac:	83 ec 08             	sub    $0x8,%esp
+  801baf:	53                   	push   %ebx
+  801bb0:	6a 2d                	push   $0x2d
+  801bb2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801bb4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801bb7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801bba:	f7 da                	neg    %edx
+  801bbc:	83 d1 00             	adc    $0x0,%ecx
+  801bbf:	f7 d9                	neg    %ecx
+  801bc1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bc4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bc9:	e9 e1 00 00 00       	jmp    801caf <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  801bce:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bd1:	8b 00                	mov    (%eax),%eax
+  801bd3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bd6:	89 c1                	mov    %eax,%ecx
+  801bd8:	c1 f9 1f             	sar    $0x1f,%ecx
+  801bdb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801bde:	8b 45 14             	mov    0x14(%ebp),%eax
+  801be1:	8d 40 04             	lea    0x4(%eax),%eax
+  801be4:	89 45 14             	mov    %eax,0x14(%ebp)
+  801be7:	eb b0                	jmp    801b99 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801be9:	83 f9 01             	cmp    $0x1,%ecx
+  801bec:	7f 1e                	jg     801c0c <vprintfmt+0x319>
+	else if (lflag)
+  801bee:	85 c9                	test   %ecx,%ecx
+  801bf0:	74 32                	je     801c24 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  801bf2:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bf5:	8b 10                	mov    (%eax),%edx
+  801bf7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bfc:	8d 40 04             	lea    0x4(%eax),%eax
+  801bff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c02:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801c07:	e9 a3 00 00 00       	jmp    801caf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c0c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c0f:	8b 10                	mov    (%eax),%edx
+  801c11:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c14:	8d 40 08             	lea    0x8(%eax),%eax
+  801c17:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c1a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c1f:	e9 8b 00 00 00       	jmp    801caf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c24:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c27:	8b 10                	mov    (%eax),%edx
+  801c29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c2e:	8d 40 04             	lea    0x4(%eax),%eax
+  801c31:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c34:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c39:	eb 74                	jmp    801caf <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  801c3b:	83 f9 01             	cmp    $0x1,%ecx
+  801c3e:	7f 1b                	jg     801c5b <vprintfmt+0x368>
+	else if (lflag)
+  801c40:	85 c9                	test   %ecx,%ecx
+  801c42:	74 2c                	je     801c70 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  801c44:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c47:	8b 10                	mov    (%eax),%edx
+  801c49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c4e:	8d 40 04             	lea    0x4(%eax),%eax
+  801c51:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c54:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  801c59:	eb 54                	jmp    801caf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c5e:	8b 10                	mov    (%eax),%edx
+  801c60:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c63:	8d 40 08             	lea    0x8(%eax),%eax
+  801c66:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c69:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  801c6e:	eb 3f                	jmp    801caf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c70:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c73:	8b 10                	mov    (%eax),%edx
+  801c75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c7a:	8d 40 04             	lea    0x4(%eax),%eax
+  801c7d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c80:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  801c85:	eb 28                	jmp    801caf <vprintfmt+0x3bc>
+			putch('0', putdat);
+  801c87:	83 ec 08             	sub    $0x8,%esp
+  801c8a:	53                   	push   %ebx
+  801c8b:	6a 30                	push   $0x30
+  801c8d:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c8f:	83 c4 08             	add    $0x8,%esp
+  801c92:	53                   	push   %ebx
+  801c93:	6a 78                	push   $0x78
+  801c95:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c97:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c9a:	8b 10                	mov    (%eax),%edx
+  801c9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801ca1:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801ca4:	8d 40 04             	lea    0x4(%eax),%eax
+  801ca7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801caa:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801caf:	83 ec 0c             	sub    $0xc,%esp
+  801cb2:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801cb6:	50                   	push   %eax
+  801cb7:	ff 75 e0             	push   -0x20(%ebp)
+  801cba:	57                   	push   %edi
+  801cbb:	51                   	push   %ecx
+  801cbc:	52                   	push   %edx
+  801cbd:	89 da                	mov    %ebx,%edx
+  801cbf:	89 f0                	mov    %esi,%eax
+  801cc1:	e8 4a fb ff ff       	call   801810 <printnum>
+			break;
+  801cc6:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801cc9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ccc:	e9 40 fc ff ff       	jmp    801911 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801cd1:	83 f9 01             	cmp    $0x1,%ecx
+  801cd4:	7f 1b                	jg     801cf1 <vprintfmt+0x3fe>
+	else if (lflag)
+  801cd6:	85 c9                	test   %ecx,%ecx
+  801cd8:	74 2c                	je     801d06 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  801cda:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cdd:	8b 10                	mov    (%eax),%edx
+  801cdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ce4:	8d 40 04             	lea    0x4(%eax),%eax
+  801ce7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cea:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801cef:	eb be                	jmp    801caf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801cf1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf4:	8b 10                	mov    (%eax),%edx
+  801cf6:	8b 48 04             	mov    0x4(%eax),%ecx
+  801cf9:	8d 40 08             	lea    0x8(%eax),%eax
+  801cfc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cff:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801d04:	eb a9                	jmp    801caf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801d06:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d09:	8b 10                	mov    (%eax),%edx
+  801d0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d10:	8d 40 04             	lea    0x4(%eax),%eax
+  801d13:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d16:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d1b:	eb 92                	jmp    801caf <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  801d1d:	83 ec 08             	sub    $0x8,%esp
+  801d20:	53                   	push   %ebx
+  801d21:	6a 25                	push   $0x25
+  801d23:	ff d6                	call   *%esi
+			break;
+  801d25:	83 c4 10             	add    $0x10,%esp
+  801d28:	eb 9f                	jmp    801cc9 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  801d2a:	83 ec 08             	sub    $0x8,%esp
+  801d2d:	53                   	push   %ebx
+  801d2e:	6a 25                	push   $0x25
+  801d30:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d32:	83 c4 10             	add    $0x10,%esp
+  801d35:	89 f8                	mov    %edi,%eax
+  801d37:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d3b:	74 05                	je     801d42 <vprintfmt+0x44f>
+  801d3d:	83 e8 01             	sub    $0x1,%eax
+  801d40:	eb f5                	jmp    801d37 <vprintfmt+0x444>
+  801d42:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d45:	eb 82                	jmp    801cc9 <vprintfmt+0x3d6>
+
+00801d47 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d47:	55                   	push   %ebp
+  801d48:	89 e5                	mov    %esp,%ebp
+  801d4a:	83 ec 18             	sub    $0x18,%esp
+  801d4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d50:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d53:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d56:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d5a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d5d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d64:	85 c0                	test   %eax,%eax
+  801d66:	74 26                	je     801d8e <vsnprintf+0x47>
+  801d68:	85 d2                	test   %edx,%edx
+  801d6a:	7e 22                	jle    801d8e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d6c:	ff 75 14             	push   0x14(%ebp)
+  801d6f:	ff 75 10             	push   0x10(%ebp)
+  801d72:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d75:	50                   	push   %eax
+  801d76:	68 b9 18 80 00       	push   $0x8018b9
+  801d7b:	e8 73 fb ff ff       	call   8018f3 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d80:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d83:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d89:	83 c4 10             	add    $0x10,%esp
+}
+  801d8c:	c9                   	leave
+  801d8d:	c3                   	ret
+		return -E_INVAL;
+  801d8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d93:	eb f7                	jmp    801d8c <vsnprintf+0x45>
+
+00801d95 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d95:	55                   	push   %ebp
+  801d96:	89 e5                	mov    %esp,%ebp
+  801d98:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d9b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d9e:	50                   	push   %eax
+  801d9f:	ff 75 10             	push   0x10(%ebp)
+  801da2:	ff 75 0c             	push   0xc(%ebp)
+  801da5:	ff 75 08             	push   0x8(%ebp)
+  801da8:	e8 9a ff ff ff       	call   801d47 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801dad:	c9                   	leave
+  801dae:	c3                   	ret
+
+00801daf <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801daf:	55                   	push   %ebp
+  801db0:	89 e5                	mov    %esp,%ebp
+  801db2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dba:	eb 03                	jmp    801dbf <strlen+0x10>
+		n++;
+  801dbc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801dbf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801dc3:	75 f7                	jne    801dbc <strlen+0xd>
+	return n;
+}
+  801dc5:	5d                   	pop    %ebp
+  801dc6:	c3                   	ret
+
+00801dc7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801dc7:	55                   	push   %ebp
+  801dc8:	89 e5                	mov    %esp,%ebp
+  801dca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dcd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd5:	eb 03                	jmp    801dda <strnlen+0x13>
+		n++;
+  801dd7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dda:	39 d0                	cmp    %edx,%eax
+  801ddc:	74 08                	je     801de6 <strnlen+0x1f>
+  801dde:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801de2:	75 f3                	jne    801dd7 <strnlen+0x10>
+  801de4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801de6:	89 d0                	mov    %edx,%eax
+  801de8:	5d                   	pop    %ebp
+  801de9:	c3                   	ret
+
+00801dea <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801dea:	55                   	push   %ebp
+  801deb:	89 e5                	mov    %esp,%ebp
+  801ded:	53                   	push   %ebx
+  801dee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801df1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801df4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801dfd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801e00:	83 c0 01             	add    $0x1,%eax
+  801e03:	84 d2                	test   %dl,%dl
+  801e05:	75 f2                	jne    801df9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801e07:	89 c8                	mov    %ecx,%eax
+  801e09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e0c:	c9                   	leave
+  801e0d:	c3                   	ret
+
+00801e0e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801e0e:	55                   	push   %ebp
+  801e0f:	89 e5                	mov    %esp,%ebp
+  801e11:	53                   	push   %ebx
+  801e12:	83 ec 10             	sub    $0x10,%esp
+  801e15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e18:	53                   	push   %ebx
+  801e19:	e8 91 ff ff ff       	call   801daf <strlen>
+  801e1e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e21:	ff 75 0c             	push   0xc(%ebp)
+  801e24:	01 d8                	add    %ebx,%eax
+  801e26:	50                   	push   %eax
+  801e27:	e8 be ff ff ff       	call   801dea <strcpy>
+	return dst;
+}
+  801e2c:	89 d8                	mov    %ebx,%eax
+  801e2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e31:	c9                   	leave
+  801e32:	c3                   	ret
+
+00801e33 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e33:	55                   	push   %ebp
+  801e34:	89 e5                	mov    %esp,%ebp
+  801e36:	56                   	push   %esi
+  801e37:	53                   	push   %ebx
+  801e38:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e3e:	89 f3                	mov    %esi,%ebx
+  801e40:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e43:	89 f0                	mov    %esi,%eax
+  801e45:	eb 0f                	jmp    801e56 <strncpy+0x23>
+		*dst++ = *src;
+  801e47:	83 c0 01             	add    $0x1,%eax
+  801e4a:	0f b6 0a             	movzbl (%edx),%ecx
+  801e4d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e50:	80 f9 01             	cmp    $0x1,%cl
+  801e53:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e56:	39 d8                	cmp    %ebx,%eax
+  801e58:	75 ed                	jne    801e47 <strncpy+0x14>
+	}
+	return ret;
+}
+  801e5a:	89 f0                	mov    %esi,%eax
+  801e5c:	5b                   	pop    %ebx
+  801e5d:	5e                   	pop    %esi
+  801e5e:	5d                   	pop    %ebp
+  801e5f:	c3                   	ret
+
+00801e60 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e60:	55                   	push   %ebp
+  801e61:	89 e5                	mov    %esp,%ebp
+  801e63:	56                   	push   %esi
+  801e64:	53                   	push   %ebx
+  801e65:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e6b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e6e:	89 f0                	mov    %esi,%eax
+  801e70:	85 d2                	test   %edx,%edx
+  801e72:	74 21                	je     801e95 <strlcpy+0x35>
+  801e74:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e78:	89 f2                	mov    %esi,%edx
+  801e7a:	eb 09                	jmp    801e85 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e7c:	83 c1 01             	add    $0x1,%ecx
+  801e7f:	83 c2 01             	add    $0x1,%edx
+  801e82:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e85:	39 c2                	cmp    %eax,%edx
+  801e87:	74 09                	je     801e92 <strlcpy+0x32>
+  801e89:	0f b6 19             	movzbl (%ecx),%ebx
+  801e8c:	84 db                	test   %bl,%bl
+  801e8e:	75 ec                	jne    801e7c <strlcpy+0x1c>
+  801e90:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e92:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e95:	29 f0                	sub    %esi,%eax
+}
+  801e97:	5b                   	pop    %ebx
+  801e98:	5e                   	pop    %esi
+  801e99:	5d                   	pop    %ebp
+  801e9a:	c3                   	ret
+
+00801e9b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e9b:	55                   	push   %ebp
+  801e9c:	89 e5                	mov    %esp,%ebp
+  801e9e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ea1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801ea4:	eb 06                	jmp    801eac <strcmp+0x11>
+		p++, q++;
+  801ea6:	83 c1 01             	add    $0x1,%ecx
+  801ea9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801eac:	0f b6 01             	movzbl (%ecx),%eax
+  801eaf:	84 c0                	test   %al,%al
+  801eb1:	74 04                	je     801eb7 <strcmp+0x1c>
+  801eb3:	3a 02                	cmp    (%edx),%al
+  801eb5:	74 ef                	je     801ea6 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801eb7:	0f b6 c0             	movzbl %al,%eax
+  801eba:	0f b6 12             	movzbl (%edx),%edx
+  801ebd:	29 d0                	sub    %edx,%eax
+}
+  801ebf:	5d                   	pop    %ebp
+  801ec0:	c3                   	ret
+
+00801ec1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ec1:	55                   	push   %ebp
+  801ec2:	89 e5                	mov    %esp,%ebp
+  801ec4:	53                   	push   %ebx
+  801ec5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ecb:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801ece:	eb 09                	jmp    801ed9 <strncmp+0x18>
+		n--, p++, q++;
+  801ed0:	83 ea 01             	sub    $0x1,%edx
+  801ed3:	83 c0 01             	add    $0x1,%eax
+  801ed6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ed9:	85 d2                	test   %edx,%edx
+  801edb:	74 18                	je     801ef5 <strncmp+0x34>
+  801edd:	0f b6 18             	movzbl (%eax),%ebx
+  801ee0:	84 db                	test   %bl,%bl
+  801ee2:	74 04                	je     801ee8 <strncmp+0x27>
+  801ee4:	3a 19                	cmp    (%ecx),%bl
+  801ee6:	74 e8                	je     801ed0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ee8:	0f b6 00             	movzbl (%eax),%eax
+  801eeb:	0f b6 11             	movzbl (%ecx),%edx
+  801eee:	29 d0                	sub    %edx,%eax
+}
+  801ef0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef3:	c9                   	leave
+  801ef4:	c3                   	ret
+		return 0;
+  801ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efa:	eb f4                	jmp    801ef0 <strncmp+0x2f>
+
+00801efc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801efc:	55                   	push   %ebp
+  801efd:	89 e5                	mov    %esp,%ebp
+  801eff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f02:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f06:	eb 03                	jmp    801f0b <strchr+0xf>
+  801f08:	83 c0 01             	add    $0x1,%eax
+  801f0b:	0f b6 10             	movzbl (%eax),%edx
+  801f0e:	84 d2                	test   %dl,%dl
+  801f10:	74 06                	je     801f18 <strchr+0x1c>
+		if (*s == c)
+  801f12:	38 ca                	cmp    %cl,%dl
+  801f14:	75 f2                	jne    801f08 <strchr+0xc>
+  801f16:	eb 05                	jmp    801f1d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f1d:	5d                   	pop    %ebp
+  801f1e:	c3                   	ret
+
+00801f1f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f1f:	55                   	push   %ebp
+  801f20:	89 e5                	mov    %esp,%ebp
+  801f22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f25:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f29:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f2c:	38 ca                	cmp    %cl,%dl
+  801f2e:	74 09                	je     801f39 <strfind+0x1a>
+  801f30:	84 d2                	test   %dl,%dl
+  801f32:	74 05                	je     801f39 <strfind+0x1a>
+	for (; *s; s++)
+  801f34:	83 c0 01             	add    $0x1,%eax
+  801f37:	eb f0                	jmp    801f29 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f39:	5d                   	pop    %ebp
+  801f3a:	c3                   	ret
+
+00801f3b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f3b:	55                   	push   %ebp
+  801f3c:	89 e5                	mov    %esp,%ebp
+  801f3e:	57                   	push   %edi
+  801f3f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f42:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f45:	85 c9                	test   %ecx,%ecx
+  801f47:	74 20                	je     801f69 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f49:	89 f8                	mov    %edi,%eax
+  801f4b:	09 c8                	or     %ecx,%eax
+  801f4d:	a8 03                	test   $0x3,%al
+  801f4f:	75 12                	jne    801f63 <memset+0x28>
+		c &= 0xFF;
+  801f51:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f55:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f5b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f5e:	fc                   	cld
+  801f5f:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f61:	eb 06                	jmp    801f69 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f66:	fc                   	cld
+  801f67:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f69:	89 f8                	mov    %edi,%eax
+  801f6b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f6e:	c9                   	leave
+  801f6f:	c3                   	ret
+
+00801f70 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f70:	55                   	push   %ebp
+  801f71:	89 e5                	mov    %esp,%ebp
+  801f73:	57                   	push   %edi
+  801f74:	56                   	push   %esi
+  801f75:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f78:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f7b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f7e:	39 c6                	cmp    %eax,%esi
+  801f80:	73 32                	jae    801fb4 <memmove+0x44>
+  801f82:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f85:	39 d0                	cmp    %edx,%eax
+  801f87:	73 2b                	jae    801fb4 <memmove+0x44>
+		s += n;
+		d += n;
+  801f89:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f8c:	89 d6                	mov    %edx,%esi
+  801f8e:	09 fe                	or     %edi,%esi
+  801f90:	09 ce                	or     %ecx,%esi
+  801f92:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f98:	75 0e                	jne    801fa8 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f9a:	83 ef 04             	sub    $0x4,%edi
+  801f9d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801fa0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801fa3:	fd                   	std
+  801fa4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fa6:	eb 09                	jmp    801fb1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801fa8:	83 ef 01             	sub    $0x1,%edi
+  801fab:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801fae:	fd                   	std
+  801faf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801fb1:	fc                   	cld
+  801fb2:	eb 1a                	jmp    801fce <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fb4:	89 f2                	mov    %esi,%edx
+  801fb6:	09 c2                	or     %eax,%edx
+  801fb8:	09 ca                	or     %ecx,%edx
+  801fba:	f6 c2 03             	test   $0x3,%dl
+  801fbd:	75 0a                	jne    801fc9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fbf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fc2:	89 c7                	mov    %eax,%edi
+  801fc4:	fc                   	cld
+  801fc5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fc7:	eb 05                	jmp    801fce <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fc9:	89 c7                	mov    %eax,%edi
+  801fcb:	fc                   	cld
+  801fcc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fce:	5e                   	pop    %esi
+  801fcf:	5f                   	pop    %edi
+  801fd0:	5d                   	pop    %ebp
+  801fd1:	c3                   	ret
+
+00801fd2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fd2:	55                   	push   %ebp
+  801fd3:	89 e5                	mov    %esp,%ebp
+  801fd5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fd8:	ff 75 10             	push   0x10(%ebp)
+  801fdb:	ff 75 0c             	push   0xc(%ebp)
+  801fde:	ff 75 08             	push   0x8(%ebp)
+  801fe1:	e8 8a ff ff ff       	call   801f70 <memmove>
+}
+  801fe6:	c9                   	leave
+  801fe7:	c3                   	ret
+
+00801fe8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fe8:	55                   	push   %ebp
+  801fe9:	89 e5                	mov    %esp,%ebp
+  801feb:	56                   	push   %esi
+  801fec:	53                   	push   %ebx
+  801fed:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801ff3:	89 c6                	mov    %eax,%esi
+  801ff5:	03 75 10             	add    0x10(%ebp),%esi
+  801ff8:	eb 06                	jmp    802000 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801ffa:	83 c0 01             	add    $0x1,%eax
+  801ffd:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802000:	39 f0                	cmp    %esi,%eax
+  802002:	74 14                	je     802018 <memcmp+0x30>
+		if (*s1 != *s2)
+  802004:	0f b6 08             	movzbl (%eax),%ecx
+  802007:	0f b6 1a             	movzbl (%edx),%ebx
+  80200a:	38 d9                	cmp    %bl,%cl
+  80200c:	74 ec                	je     801ffa <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80200e:	0f b6 c1             	movzbl %cl,%eax
+  802011:	0f b6 db             	movzbl %bl,%ebx
+  802014:	29 d8                	sub    %ebx,%eax
+  802016:	eb 05                	jmp    80201d <memcmp+0x35>
+	}
+
+	return 0;
+  802018:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80201d:	5b                   	pop    %ebx
+  80201e:	5e                   	pop    %esi
+  80201f:	5d                   	pop    %ebp
+  802020:	c3                   	ret
+
+00802021 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	8b 45 08             	mov    0x8(%ebp),%eax
+  802027:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80202a:	89 c2                	mov    %eax,%edx
+  80202c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80202f:	eb 03                	jmp    802034 <memfind+0x13>
+  802031:	83 c0 01             	add    $0x1,%eax
+  802034:	39 d0                	cmp    %edx,%eax
+  802036:	73 04                	jae    80203c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802038:	38 08                	cmp    %cl,(%eax)
+  80203a:	75 f5                	jne    802031 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80203c:	5d                   	pop    %ebp
+  80203d:	c3                   	ret
+
+0080203e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80203e:	55                   	push   %ebp
+  80203f:	89 e5                	mov    %esp,%ebp
+  802041:	57                   	push   %edi
+  802042:	56                   	push   %esi
+  802043:	53                   	push   %ebx
+  802044:	8b 55 08             	mov    0x8(%ebp),%edx
+  802047:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80204a:	eb 03                	jmp    80204f <strtol+0x11>
+		s++;
+  80204c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80204f:	0f b6 02             	movzbl (%edx),%eax
+  802052:	3c 20                	cmp    $0x20,%al
+  802054:	74 f6                	je     80204c <strtol+0xe>
+  802056:	3c 09                	cmp    $0x9,%al
+  802058:	74 f2                	je     80204c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80205a:	3c 2b                	cmp    $0x2b,%al
+  80205c:	74 2a                	je     802088 <strtol+0x4a>
+	int neg = 0;
+  80205e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802063:	3c 2d                	cmp    $0x2d,%al
+  802065:	74 2b                	je     802092 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802067:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80206d:	75 0f                	jne    80207e <strtol+0x40>
+  80206f:	80 3a 30             	cmpb   $0x30,(%edx)
+  802072:	74 28                	je     80209c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802074:	85 db                	test   %ebx,%ebx
+  802076:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80207b:	0f 44 d8             	cmove  %eax,%ebx
+  80207e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802083:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802086:	eb 46                	jmp    8020ce <strtol+0x90>
+		s++;
+  802088:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80208b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802090:	eb d5                	jmp    802067 <strtol+0x29>
+		s++, neg = 1;
+  802092:	83 c2 01             	add    $0x1,%edx
+  802095:	bf 01 00 00 00       	mov    $0x1,%edi
+  80209a:	eb cb                	jmp    802067 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80209c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8020a0:	74 0e                	je     8020b0 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8020a2:	85 db                	test   %ebx,%ebx
+  8020a4:	75 d8                	jne    80207e <strtol+0x40>
+		s++, base = 8;
+  8020a6:	83 c2 01             	add    $0x1,%edx
+  8020a9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8020ae:	eb ce                	jmp    80207e <strtol+0x40>
+		s += 2, base = 16;
+  8020b0:	83 c2 02             	add    $0x2,%edx
+  8020b3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020b8:	eb c4                	jmp    80207e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020ba:	0f be c0             	movsbl %al,%eax
+  8020bd:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020c0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020c3:	7d 3a                	jge    8020ff <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020c5:	83 c2 01             	add    $0x1,%edx
+  8020c8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020cc:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020ce:	0f b6 02             	movzbl (%edx),%eax
+  8020d1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020d4:	89 f3                	mov    %esi,%ebx
+  8020d6:	80 fb 09             	cmp    $0x9,%bl
+  8020d9:	76 df                	jbe    8020ba <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020db:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020de:	89 f3                	mov    %esi,%ebx
+  8020e0:	80 fb 19             	cmp    $0x19,%bl
+  8020e3:	77 08                	ja     8020ed <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020e5:	0f be c0             	movsbl %al,%eax
+  8020e8:	83 e8 57             	sub    $0x57,%eax
+  8020eb:	eb d3                	jmp    8020c0 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020ed:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020f0:	89 f3                	mov    %esi,%ebx
+  8020f2:	80 fb 19             	cmp    $0x19,%bl
+  8020f5:	77 08                	ja     8020ff <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020f7:	0f be c0             	movsbl %al,%eax
+  8020fa:	83 e8 37             	sub    $0x37,%eax
+  8020fd:	eb c1                	jmp    8020c0 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020ff:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802103:	74 05                	je     80210a <strtol+0xcc>
+		*endptr = (char *) s;
+  802105:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802108:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80210a:	89 c8                	mov    %ecx,%eax
+  80210c:	f7 d8                	neg    %eax
+  80210e:	85 ff                	test   %edi,%edi
+  802110:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802113:	89 c8                	mov    %ecx,%eax
+  802115:	5b                   	pop    %ebx
+  802116:	5e                   	pop    %esi
+  802117:	5f                   	pop    %edi
+  802118:	5d                   	pop    %ebp
+  802119:	c3                   	ret
+
+0080211a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80211a:	55                   	push   %ebp
+  80211b:	89 e5                	mov    %esp,%ebp
+  80211d:	57                   	push   %edi
+  80211e:	56                   	push   %esi
+  80211f:	53                   	push   %ebx
+  802120:	83 ec 18             	sub    $0x18,%esp
+  802123:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802126:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802129:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80212c:	85 db                	test   %ebx,%ebx
+  80212e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802133:	0f 45 c3             	cmovne %ebx,%eax
+  802136:	50                   	push   %eax
+  802137:	e8 32 e4 ff ff       	call   80056e <sys_ipc_recv>
+
+	if (from_env_store)
+  80213c:	83 c4 10             	add    $0x10,%esp
+  80213f:	85 ff                	test   %edi,%edi
+  802141:	74 17                	je     80215a <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802143:	ba 00 00 00 00       	mov    $0x0,%edx
+  802148:	85 c0                	test   %eax,%eax
+  80214a:	75 0c                	jne    802158 <ipc_recv+0x3e>
+  80214c:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802152:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802158:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  80215a:	85 f6                	test   %esi,%esi
+  80215c:	74 2e                	je     80218c <ipc_recv+0x72>
+		if (!r && pg)
+  80215e:	85 c0                	test   %eax,%eax
+  802160:	75 24                	jne    802186 <ipc_recv+0x6c>
+  802162:	85 db                	test   %ebx,%ebx
+  802164:	74 20                	je     802186 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802166:	a1 08 40 80 00       	mov    0x804008,%eax
+  80216b:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802171:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802173:	a1 08 40 80 00       	mov    0x804008,%eax
+  802178:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80217e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802181:	5b                   	pop    %ebx
+  802182:	5e                   	pop    %esi
+  802183:	5f                   	pop    %edi
+  802184:	5d                   	pop    %ebp
+  802185:	c3                   	ret
+			*perm_store = 0;
+  802186:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80218c:	85 c0                	test   %eax,%eax
+  80218e:	75 ee                	jne    80217e <ipc_recv+0x64>
+  802190:	eb e1                	jmp    802173 <ipc_recv+0x59>
+
+00802192 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802192:	55                   	push   %ebp
+  802193:	89 e5                	mov    %esp,%ebp
+  802195:	57                   	push   %edi
+  802196:	56                   	push   %esi
+  802197:	53                   	push   %ebx
+  802198:	83 ec 0c             	sub    $0xc,%esp
+  80219b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80219e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8021a4:	85 db                	test   %ebx,%ebx
+  8021a6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021ab:	0f 44 d8             	cmove  %eax,%ebx
+  8021ae:	ff 75 14             	push   0x14(%ebp)
+  8021b1:	53                   	push   %ebx
+  8021b2:	56                   	push   %esi
+  8021b3:	57                   	push   %edi
+  8021b4:	e8 92 e3 ff ff       	call   80054b <sys_ipc_try_send_yield>
+  8021b9:	83 c4 10             	add    $0x10,%esp
+  8021bc:	85 c0                	test   %eax,%eax
+  8021be:	79 1e                	jns    8021de <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8021c0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021c3:	75 07                	jne    8021cc <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8021c5:	e8 a1 df ff ff       	call   80016b <sys_yield>
+  8021ca:	eb e2                	jmp    8021ae <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8021cc:	50                   	push   %eax
+  8021cd:	68 1f 2b 80 00       	push   $0x802b1f
+  8021d2:	6a 3d                	push   $0x3d
+  8021d4:	68 34 2b 80 00       	push   $0x802b34
+  8021d9:	e8 43 f5 ff ff       	call   801721 <_panic>
+	}
+}
+  8021de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021e1:	5b                   	pop    %ebx
+  8021e2:	5e                   	pop    %esi
+  8021e3:	5f                   	pop    %edi
+  8021e4:	5d                   	pop    %ebp
+  8021e5:	c3                   	ret
+
+008021e6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8021e6:	55                   	push   %ebp
+  8021e7:	89 e5                	mov    %esp,%ebp
+  8021e9:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8021ec:	ff 75 08             	push   0x8(%ebp)
+  8021ef:	e8 f7 de ff ff       	call   8000eb <sys_env_find>
+}
+  8021f4:	c9                   	leave
+  8021f5:	c3                   	ret
+
+008021f6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8021f6:	55                   	push   %ebp
+  8021f7:	89 e5                	mov    %esp,%ebp
+  8021f9:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021fc:	89 c2                	mov    %eax,%edx
+  8021fe:	c1 ea 16             	shr    $0x16,%edx
+  802201:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802208:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80220d:	f6 c1 01             	test   $0x1,%cl
+  802210:	74 22                	je     802234 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802212:	c1 e8 0c             	shr    $0xc,%eax
+  802215:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80221c:	a8 01                	test   $0x1,%al
+  80221e:	74 14                	je     802234 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802220:	c1 e8 0c             	shr    $0xc,%eax
+  802223:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802226:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80222d:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802231:	0f b7 d2             	movzwl %dx,%edx
+}
+  802234:	89 d0                	mov    %edx,%eax
+  802236:	5d                   	pop    %ebp
+  802237:	c3                   	ret
+  802238:	66 90                	xchg   %ax,%ax
+  80223a:	66 90                	xchg   %ax,%ax
+  80223c:	66 90                	xchg   %ax,%ax
+  80223e:	66 90                	xchg   %ax,%ax
+
+00802240 <__udivmoddi4>:
+  802240:	55                   	push   %ebp
+  802241:	57                   	push   %edi
+  802242:	56                   	push   %esi
+  802243:	53                   	push   %ebx
+  802244:	83 ec 14             	sub    $0x14,%esp
+  802247:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80224b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80224f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802253:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802257:	89 f1                	mov    %esi,%ecx
+  802259:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80225d:	09 d9                	or     %ebx,%ecx
+  80225f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802263:	0f 84 92 00 00 00    	je     8022fb <__udivmoddi4+0xbb>
+  802269:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802270:	00 
+  802271:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802276:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80227d:	00 
+  80227e:	89 1c 24             	mov    %ebx,(%esp)
+  802281:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802285:	8d 76 00             	lea    0x0(%esi),%esi
+  802288:	89 e9                	mov    %ebp,%ecx
+  80228a:	89 c3                	mov    %eax,%ebx
+  80228c:	89 d6                	mov    %edx,%esi
+  80228e:	31 ff                	xor    %edi,%edi
+  802290:	d3 ee                	shr    %cl,%esi
+  802292:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802295:	f6 c1 20             	test   $0x20,%cl
+  802298:	0f 45 de             	cmovne %esi,%ebx
+  80229b:	0f 45 f7             	cmovne %edi,%esi
+  80229e:	8b 3c 24             	mov    (%esp),%edi
+  8022a1:	39 fb                	cmp    %edi,%ebx
+  8022a3:	89 f7                	mov    %esi,%edi
+  8022a5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8022a9:	8b 1c 24             	mov    (%esp),%ebx
+  8022ac:	19 f7                	sbb    %esi,%edi
+  8022ae:	72 39                	jb     8022e9 <__udivmoddi4+0xa9>
+  8022b0:	89 e9                	mov    %ebp,%ecx
+  8022b2:	89 f7                	mov    %esi,%edi
+  8022b4:	89 de                	mov    %ebx,%esi
+  8022b6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8022b9:	d3 e6                	shl    %cl,%esi
+  8022bb:	31 db                	xor    %ebx,%ebx
+  8022bd:	f6 c1 20             	test   $0x20,%cl
+  8022c0:	0f 45 fe             	cmovne %esi,%edi
+  8022c3:	0f 45 f3             	cmovne %ebx,%esi
+  8022c6:	29 f0                	sub    %esi,%eax
+  8022c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022cd:	19 fa                	sbb    %edi,%edx
+  8022cf:	31 ff                	xor    %edi,%edi
+  8022d1:	31 db                	xor    %ebx,%ebx
+  8022d3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8022d6:	d3 e6                	shl    %cl,%esi
+  8022d8:	f6 c1 20             	test   $0x20,%cl
+  8022db:	0f 45 fe             	cmovne %esi,%edi
+  8022de:	0f 45 f3             	cmovne %ebx,%esi
+  8022e1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8022e5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8022e9:	83 ed 01             	sub    $0x1,%ebp
+  8022ec:	73 9a                	jae    802288 <__udivmoddi4+0x48>
+  8022ee:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8022f2:	85 ff                	test   %edi,%edi
+  8022f4:	74 05                	je     8022fb <__udivmoddi4+0xbb>
+  8022f6:	89 07                	mov    %eax,(%edi)
+  8022f8:	89 57 04             	mov    %edx,0x4(%edi)
+  8022fb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022ff:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802303:	83 c4 14             	add    $0x14,%esp
+  802306:	5b                   	pop    %ebx
+  802307:	5e                   	pop    %esi
+  802308:	5f                   	pop    %edi
+  802309:	5d                   	pop    %ebp
+  80230a:	c3                   	ret
+  80230b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80230f:	90                   	nop
+
+00802310 <__udivdi3>:
+  802310:	55                   	push   %ebp
+  802311:	57                   	push   %edi
+  802312:	56                   	push   %esi
+  802313:	53                   	push   %ebx
+  802314:	83 ec 14             	sub    $0x14,%esp
+  802317:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80231b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80231f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802323:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802327:	89 fb                	mov    %edi,%ebx
+  802329:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80232d:	09 f3                	or     %esi,%ebx
+  80232f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802333:	0f 84 85 00 00 00    	je     8023be <__udivdi3+0xae>
+  802339:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802340:	00 
+  802341:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802346:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80234d:	00 
+  80234e:	89 34 24             	mov    %esi,(%esp)
+  802351:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802355:	8d 76 00             	lea    0x0(%esi),%esi
+  802358:	89 e9                	mov    %ebp,%ecx
+  80235a:	89 c3                	mov    %eax,%ebx
+  80235c:	89 d6                	mov    %edx,%esi
+  80235e:	31 ff                	xor    %edi,%edi
+  802360:	d3 ee                	shr    %cl,%esi
+  802362:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802365:	f6 c1 20             	test   $0x20,%cl
+  802368:	0f 45 de             	cmovne %esi,%ebx
+  80236b:	0f 45 f7             	cmovne %edi,%esi
+  80236e:	8b 3c 24             	mov    (%esp),%edi
+  802371:	39 fb                	cmp    %edi,%ebx
+  802373:	89 f7                	mov    %esi,%edi
+  802375:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802379:	8b 1c 24             	mov    (%esp),%ebx
+  80237c:	19 f7                	sbb    %esi,%edi
+  80237e:	72 39                	jb     8023b9 <__udivdi3+0xa9>
+  802380:	89 e9                	mov    %ebp,%ecx
+  802382:	89 f7                	mov    %esi,%edi
+  802384:	89 de                	mov    %ebx,%esi
+  802386:	0f a5 df             	shld   %cl,%ebx,%edi
+  802389:	d3 e6                	shl    %cl,%esi
+  80238b:	31 db                	xor    %ebx,%ebx
+  80238d:	f6 c1 20             	test   $0x20,%cl
+  802390:	0f 45 fe             	cmovne %esi,%edi
+  802393:	0f 45 f3             	cmovne %ebx,%esi
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	be 01 00 00 00       	mov    $0x1,%esi
+  80239d:	19 fa                	sbb    %edi,%edx
+  80239f:	31 ff                	xor    %edi,%edi
+  8023a1:	31 db                	xor    %ebx,%ebx
+  8023a3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023a6:	d3 e6                	shl    %cl,%esi
+  8023a8:	f6 c1 20             	test   $0x20,%cl
+  8023ab:	0f 45 fe             	cmovne %esi,%edi
+  8023ae:	0f 45 f3             	cmovne %ebx,%esi
+  8023b1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023b5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023b9:	83 ed 01             	sub    $0x1,%ebp
+  8023bc:	73 9a                	jae    802358 <__udivdi3+0x48>
+  8023be:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023c2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023c6:	83 c4 14             	add    $0x14,%esp
+  8023c9:	5b                   	pop    %ebx
+  8023ca:	5e                   	pop    %esi
+  8023cb:	5f                   	pop    %edi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+  8023ce:	66 90                	xchg   %ax,%ax
+
+008023d0 <__umoddi3>:
+  8023d0:	57                   	push   %edi
+  8023d1:	56                   	push   %esi
+  8023d2:	53                   	push   %ebx
+  8023d3:	83 ec 08             	sub    $0x8,%esp
+  8023d6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8023da:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8023de:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023e2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023e6:	89 f9                	mov    %edi,%ecx
+  8023e8:	89 34 24             	mov    %esi,(%esp)
+  8023eb:	09 f1                	or     %esi,%ecx
+  8023ed:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023f1:	74 53                	je     802446 <__umoddi3+0x76>
+  8023f3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023ff:	90                   	nop
+  802400:	89 c6                	mov    %eax,%esi
+  802402:	89 d7                	mov    %edx,%edi
+  802404:	31 db                	xor    %ebx,%ebx
+  802406:	d3 ef                	shr    %cl,%edi
+  802408:	0f ad d6             	shrd   %cl,%edx,%esi
+  80240b:	f6 c1 20             	test   $0x20,%cl
+  80240e:	0f 45 f7             	cmovne %edi,%esi
+  802411:	0f 45 fb             	cmovne %ebx,%edi
+  802414:	8b 1c 24             	mov    (%esp),%ebx
+  802417:	39 de                	cmp    %ebx,%esi
+  802419:	89 fb                	mov    %edi,%ebx
+  80241b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80241f:	8b 34 24             	mov    (%esp),%esi
+  802422:	19 fb                	sbb    %edi,%ebx
+  802424:	72 14                	jb     80243a <__umoddi3+0x6a>
+  802426:	0f a5 f7             	shld   %cl,%esi,%edi
+  802429:	31 db                	xor    %ebx,%ebx
+  80242b:	d3 e6                	shl    %cl,%esi
+  80242d:	f6 c1 20             	test   $0x20,%cl
+  802430:	0f 45 fe             	cmovne %esi,%edi
+  802433:	0f 45 f3             	cmovne %ebx,%esi
+  802436:	29 f0                	sub    %esi,%eax
+  802438:	19 fa                	sbb    %edi,%edx
+  80243a:	83 e9 01             	sub    $0x1,%ecx
+  80243d:	73 c1                	jae    802400 <__umoddi3+0x30>
+  80243f:	83 c4 08             	add    $0x8,%esp
+  802442:	5b                   	pop    %ebx
+  802443:	5e                   	pop    %esi
+  802444:	5f                   	pop    %edi
+  802445:	c3                   	ret
+  802446:	83 c4 08             	add    $0x8,%esp
+  802449:	31 c0                	xor    %eax,%eax
+  80244b:	31 d2                	xor    %edx,%edx
+  80244d:	5b                   	pop    %ebx
+  80244e:	5e                   	pop    %esi
+  80244f:	5f                   	pop    %edi
+  802450:	c3                   	ret
+  802451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80245f:	90                   	nop
+
+00802460 <__divdi3>:
+  802460:	55                   	push   %ebp
+  802461:	57                   	push   %edi
+  802462:	56                   	push   %esi
+  802463:	53                   	push   %ebx
+  802464:	83 ec 1c             	sub    $0x1c,%esp
+  802467:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80246b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80246f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802473:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802477:	85 ff                	test   %edi,%edi
+  802479:	0f 88 da 00 00 00    	js     802559 <__divdi3+0xf9>
+  80247f:	85 db                	test   %ebx,%ebx
+  802481:	78 16                	js     802499 <__divdi3+0x39>
+  802483:	89 dd                	mov    %ebx,%ebp
+  802485:	89 c8                	mov    %ecx,%eax
+  802487:	89 da                	mov    %ebx,%edx
+  802489:	09 cd                	or     %ecx,%ebp
+  80248b:	0f 85 fd 00 00 00    	jne    80258e <__divdi3+0x12e>
+  802491:	83 c4 1c             	add    $0x1c,%esp
+  802494:	5b                   	pop    %ebx
+  802495:	5e                   	pop    %esi
+  802496:	5f                   	pop    %edi
+  802497:	5d                   	pop    %ebp
+  802498:	c3                   	ret
+  802499:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80249e:	f7 d9                	neg    %ecx
+  8024a0:	89 f0                	mov    %esi,%eax
+  8024a2:	89 fa                	mov    %edi,%edx
+  8024a4:	83 d3 00             	adc    $0x0,%ebx
+  8024a7:	89 0c 24             	mov    %ecx,(%esp)
+  8024aa:	f7 db                	neg    %ebx
+  8024ac:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8024b0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024b7:	00 
+  8024b8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024bd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024c4:	00 
+  8024c5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024c9:	89 cd                	mov    %ecx,%ebp
+  8024cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024cf:	90                   	nop
+  8024d0:	89 e9                	mov    %ebp,%ecx
+  8024d2:	89 c3                	mov    %eax,%ebx
+  8024d4:	89 d6                	mov    %edx,%esi
+  8024d6:	31 ff                	xor    %edi,%edi
+  8024d8:	d3 ee                	shr    %cl,%esi
+  8024da:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024dd:	f6 c1 20             	test   $0x20,%cl
+  8024e0:	0f 45 de             	cmovne %esi,%ebx
+  8024e3:	0f 45 f7             	cmovne %edi,%esi
+  8024e6:	8b 3c 24             	mov    (%esp),%edi
+  8024e9:	39 fb                	cmp    %edi,%ebx
+  8024eb:	89 f7                	mov    %esi,%edi
+  8024ed:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8024f1:	8b 1c 24             	mov    (%esp),%ebx
+  8024f4:	19 f7                	sbb    %esi,%edi
+  8024f6:	72 39                	jb     802531 <__divdi3+0xd1>
+  8024f8:	89 e9                	mov    %ebp,%ecx
+  8024fa:	89 f7                	mov    %esi,%edi
+  8024fc:	89 de                	mov    %ebx,%esi
+  8024fe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802501:	d3 e6                	shl    %cl,%esi
+  802503:	31 db                	xor    %ebx,%ebx
+  802505:	f6 c1 20             	test   $0x20,%cl
+  802508:	0f 45 fe             	cmovne %esi,%edi
+  80250b:	0f 45 f3             	cmovne %ebx,%esi
+  80250e:	29 f0                	sub    %esi,%eax
+  802510:	be 01 00 00 00       	mov    $0x1,%esi
+  802515:	19 fa                	sbb    %edi,%edx
+  802517:	31 ff                	xor    %edi,%edi
+  802519:	31 db                	xor    %ebx,%ebx
+  80251b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80251e:	d3 e6                	shl    %cl,%esi
+  802520:	f6 c1 20             	test   $0x20,%cl
+  802523:	0f 45 fe             	cmovne %esi,%edi
+  802526:	0f 45 f3             	cmovne %ebx,%esi
+  802529:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80252d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802531:	83 ed 01             	sub    $0x1,%ebp
+  802534:	73 9a                	jae    8024d0 <__divdi3+0x70>
+  802536:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80253a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80253e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802542:	85 ed                	test   %ebp,%ebp
+  802544:	0f 84 47 ff ff ff    	je     802491 <__divdi3+0x31>
+  80254a:	f7 d8                	neg    %eax
+  80254c:	83 d2 00             	adc    $0x0,%edx
+  80254f:	83 c4 1c             	add    $0x1c,%esp
+  802552:	5b                   	pop    %ebx
+  802553:	f7 da                	neg    %edx
+  802555:	5e                   	pop    %esi
+  802556:	5f                   	pop    %edi
+  802557:	5d                   	pop    %ebp
+  802558:	c3                   	ret
+  802559:	f7 de                	neg    %esi
+  80255b:	83 d7 00             	adc    $0x0,%edi
+  80255e:	f7 df                	neg    %edi
+  802560:	85 db                	test   %ebx,%ebx
+  802562:	78 23                	js     802587 <__divdi3+0x127>
+  802564:	89 dd                	mov    %ebx,%ebp
+  802566:	89 c8                	mov    %ecx,%eax
+  802568:	89 da                	mov    %ebx,%edx
+  80256a:	09 cd                	or     %ecx,%ebp
+  80256c:	0f 84 1f ff ff ff    	je     802491 <__divdi3+0x31>
+  802572:	89 0c 24             	mov    %ecx,(%esp)
+  802575:	89 f0                	mov    %esi,%eax
+  802577:	89 fa                	mov    %edi,%edx
+  802579:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80257e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802582:	e9 29 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+  802587:	31 ed                	xor    %ebp,%ebp
+  802589:	e9 10 ff ff ff       	jmp    80249e <__divdi3+0x3e>
+  80258e:	89 0c 24             	mov    %ecx,(%esp)
+  802591:	89 f0                	mov    %esi,%eax
+  802593:	89 fa                	mov    %edi,%edx
+  802595:	31 ed                	xor    %ebp,%ebp
+  802597:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80259b:	e9 10 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+
+008025a0 <__moddi3>:
+  8025a0:	55                   	push   %ebp
+  8025a1:	57                   	push   %edi
+  8025a2:	56                   	push   %esi
+  8025a3:	53                   	push   %ebx
+  8025a4:	83 ec 14             	sub    $0x14,%esp
+  8025a7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025ab:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025af:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8025b3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8025b7:	85 d2                	test   %edx,%edx
+  8025b9:	0f 88 9b 00 00 00    	js     80265a <__moddi3+0xba>
+  8025bf:	89 f7                	mov    %esi,%edi
+  8025c1:	31 ed                	xor    %ebp,%ebp
+  8025c3:	09 cf                	or     %ecx,%edi
+  8025c5:	0f 84 83 00 00 00    	je     80264e <__moddi3+0xae>
+  8025cb:	89 cb                	mov    %ecx,%ebx
+  8025cd:	89 f7                	mov    %esi,%edi
+  8025cf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8025d3:	f7 db                	neg    %ebx
+  8025d5:	83 d7 00             	adc    $0x0,%edi
+  8025d8:	f7 df                	neg    %edi
+  8025da:	0f 49 f7             	cmovns %edi,%esi
+  8025dd:	0f 49 cb             	cmovns %ebx,%ecx
+  8025e0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025e4:	89 0c 24             	mov    %ecx,(%esp)
+  8025e7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025ec:	89 cd                	mov    %ecx,%ebp
+  8025ee:	66 90                	xchg   %ax,%ax
+  8025f0:	89 e9                	mov    %ebp,%ecx
+  8025f2:	89 c3                	mov    %eax,%ebx
+  8025f4:	89 d6                	mov    %edx,%esi
+  8025f6:	31 ff                	xor    %edi,%edi
+  8025f8:	d3 ee                	shr    %cl,%esi
+  8025fa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025fd:	f6 c1 20             	test   $0x20,%cl
+  802600:	0f 45 de             	cmovne %esi,%ebx
+  802603:	0f 45 f7             	cmovne %edi,%esi
+  802606:	8b 3c 24             	mov    (%esp),%edi
+  802609:	39 fb                	cmp    %edi,%ebx
+  80260b:	89 f7                	mov    %esi,%edi
+  80260d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802611:	8b 1c 24             	mov    (%esp),%ebx
+  802614:	19 f7                	sbb    %esi,%edi
+  802616:	72 1a                	jb     802632 <__moddi3+0x92>
+  802618:	89 e9                	mov    %ebp,%ecx
+  80261a:	89 f7                	mov    %esi,%edi
+  80261c:	89 de                	mov    %ebx,%esi
+  80261e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802621:	d3 e6                	shl    %cl,%esi
+  802623:	31 db                	xor    %ebx,%ebx
+  802625:	f6 c1 20             	test   $0x20,%cl
+  802628:	0f 45 fe             	cmovne %esi,%edi
+  80262b:	0f 45 f3             	cmovne %ebx,%esi
+  80262e:	29 f0                	sub    %esi,%eax
+  802630:	19 fa                	sbb    %edi,%edx
+  802632:	83 ed 01             	sub    $0x1,%ebp
+  802635:	73 b9                	jae    8025f0 <__moddi3+0x50>
+  802637:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80263b:	85 ed                	test   %ebp,%ebp
+  80263d:	74 07                	je     802646 <__moddi3+0xa6>
+  80263f:	f7 d8                	neg    %eax
+  802641:	83 d2 00             	adc    $0x0,%edx
+  802644:	f7 da                	neg    %edx
+  802646:	83 c4 14             	add    $0x14,%esp
+  802649:	5b                   	pop    %ebx
+  80264a:	5e                   	pop    %esi
+  80264b:	5f                   	pop    %edi
+  80264c:	5d                   	pop    %ebp
+  80264d:	c3                   	ret
+  80264e:	83 c4 14             	add    $0x14,%esp
+  802651:	31 c0                	xor    %eax,%eax
+  802653:	31 d2                	xor    %edx,%edx
+  802655:	5b                   	pop    %ebx
+  802656:	5e                   	pop    %esi
+  802657:	5f                   	pop    %edi
+  802658:	5d                   	pop    %ebp
+  802659:	c3                   	ret
+  80265a:	89 f7                	mov    %esi,%edi
+  80265c:	09 cf                	or     %ecx,%edi
+  80265e:	74 11                	je     802671 <__moddi3+0xd1>
+  802660:	f7 d8                	neg    %eax
+  802662:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802667:	83 d2 00             	adc    $0x0,%edx
+  80266a:	f7 da                	neg    %edx
+  80266c:	e9 5a ff ff ff       	jmp    8025cb <__moddi3+0x2b>
+  802671:	31 c0                	xor    %eax,%eax
+  802673:	31 d2                	xor    %edx,%edx
+  802675:	eb c8                	jmp    80263f <__moddi3+0x9f>
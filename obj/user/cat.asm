@@ -0,0 +1,5852 @@
+
+obj/user/cat.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 fc 00 00 00       	call   80012d <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <cat>:
+
+char buf[8192];
+
+void
+cat(int f, char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+
+	while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003b:	83 ec 04             	sub    $0x4,%esp
+  80003e:	68 00 20 00 00       	push   $0x2000
+  800043:	68 20 40 80 00       	push   $0x804020
+  800048:	56                   	push   %esi
+  800049:	e8 7d 13 00 00       	call   8013cb <read>
+  80004e:	89 c3                	mov    %eax,%ebx
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	7e 2f                	jle    800086 <cat+0x53>
+		if ((r = write(1, buf, n)) != n)
+  800057:	83 ec 04             	sub    $0x4,%esp
+  80005a:	53                   	push   %ebx
+  80005b:	68 20 40 80 00       	push   $0x804020
+  800060:	6a 01                	push   $0x1
+  800062:	e8 32 14 00 00       	call   801499 <write>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	39 c3                	cmp    %eax,%ebx
+  80006c:	74 cd                	je     80003b <cat+0x8>
+			panic("write error copying %s: %e", s, r);
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	50                   	push   %eax
+  800072:	ff 75 0c             	push   0xc(%ebp)
+  800075:	68 80 28 80 00       	push   $0x802880
+  80007a:	6a 0d                	push   $0xd
+  80007c:	68 9b 28 80 00       	push   $0x80289b
+  800081:	e8 07 01 00 00       	call   80018d <_panic>
+	if (n < 0)
+  800086:	78 07                	js     80008f <cat+0x5c>
+		panic("error reading %s: %e", s, n);
+}
+  800088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5d                   	pop    %ebp
+  80008e:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	50                   	push   %eax
+  800093:	ff 75 0c             	push   0xc(%ebp)
+  800096:	68 a6 28 80 00       	push   $0x8028a6
+  80009b:	6a 0f                	push   $0xf
+  80009d:	68 9b 28 80 00       	push   $0x80289b
+  8000a2:	e8 e6 00 00 00       	call   80018d <_panic>
+
+008000a7 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	57                   	push   %edi
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+  8000ad:	83 ec 0c             	sub    $0xc,%esp
+  8000b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int f, i;
+
+	binaryname = "cat";
+  8000b3:	c7 05 00 30 80 00 bb 	movl   $0x8028bb,0x803000
+  8000ba:	28 80 00 
+	if (argc == 1)
+		cat(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  8000bd:	be 01 00 00 00       	mov    $0x1,%esi
+	if (argc == 1)
+  8000c2:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000c6:	75 31                	jne    8000f9 <umain+0x52>
+		cat(0, "<stdin>");
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	68 bf 28 80 00       	push   $0x8028bf
+  8000d0:	6a 00                	push   $0x0
+  8000d2:	e8 5c ff ff ff       	call   800033 <cat>
+  8000d7:	83 c4 10             	add    $0x10,%esp
+			else {
+				cat(f, argv[i]);
+				close(f);
+			}
+		}
+}
+  8000da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000dd:	5b                   	pop    %ebx
+  8000de:	5e                   	pop    %esi
+  8000df:	5f                   	pop    %edi
+  8000e0:	5d                   	pop    %ebp
+  8000e1:	c3                   	ret
+				printf("can't open %s: %e\n", argv[i], f);
+  8000e2:	83 ec 04             	sub    $0x4,%esp
+  8000e5:	50                   	push   %eax
+  8000e6:	ff 34 b7             	push   (%edi,%esi,4)
+  8000e9:	68 c7 28 80 00       	push   $0x8028c7
+  8000ee:	e8 de 18 00 00       	call   8019d1 <printf>
+  8000f3:	83 c4 10             	add    $0x10,%esp
+		for (i = 1; i < argc; i++) {
+  8000f6:	83 c6 01             	add    $0x1,%esi
+  8000f9:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8000fc:	7d dc                	jge    8000da <umain+0x33>
+			f = open(argv[i], O_RDONLY);
+  8000fe:	83 ec 08             	sub    $0x8,%esp
+  800101:	6a 00                	push   $0x0
+  800103:	ff 34 b7             	push   (%edi,%esi,4)
+  800106:	e8 23 17 00 00       	call   80182e <open>
+  80010b:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	85 c0                	test   %eax,%eax
+  800112:	78 ce                	js     8000e2 <umain+0x3b>
+				cat(f, argv[i]);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	ff 34 b7             	push   (%edi,%esi,4)
+  80011a:	50                   	push   %eax
+  80011b:	e8 13 ff ff ff       	call   800033 <cat>
+				close(f);
+  800120:	89 1c 24             	mov    %ebx,(%esp)
+  800123:	e8 67 11 00 00       	call   80128f <close>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	eb c9                	jmp    8000f6 <umain+0x4f>
+
+0080012d <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	56                   	push   %esi
+  800131:	53                   	push   %ebx
+  800132:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800135:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800138:	e8 e7 0a 00 00       	call   800c24 <sys_getenvid>
+  80013d:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800142:	c1 e0 09             	shl    $0x9,%eax
+  800145:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80014a:	a3 20 60 80 00       	mov    %eax,0x806020
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80014f:	85 db                	test   %ebx,%ebx
+  800151:	7e 07                	jle    80015a <libmain+0x2d>
+		binaryname = argv[0];
+  800153:	8b 06                	mov    (%esi),%eax
+  800155:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80015a:	83 ec 08             	sub    $0x8,%esp
+  80015d:	56                   	push   %esi
+  80015e:	53                   	push   %ebx
+  80015f:	e8 43 ff ff ff       	call   8000a7 <umain>
+
+	// exit gracefully
+	exit();
+  800164:	e8 0a 00 00 00       	call   800173 <exit>
+}
+  800169:	83 c4 10             	add    $0x10,%esp
+  80016c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80016f:	5b                   	pop    %ebx
+  800170:	5e                   	pop    %esi
+  800171:	5d                   	pop    %ebp
+  800172:	c3                   	ret
+
+00800173 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800173:	55                   	push   %ebp
+  800174:	89 e5                	mov    %esp,%ebp
+  800176:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800179:	e8 3e 11 00 00       	call   8012bc <close_all>
+	sys_env_destroy(0);
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	6a 00                	push   $0x0
+  800183:	e8 5b 0a 00 00       	call   800be3 <sys_env_destroy>
+}
+  800188:	83 c4 10             	add    $0x10,%esp
+  80018b:	c9                   	leave
+  80018c:	c3                   	ret
+
+0080018d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80018d:	55                   	push   %ebp
+  80018e:	89 e5                	mov    %esp,%ebp
+  800190:	56                   	push   %esi
+  800191:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800192:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800195:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80019b:	e8 84 0a 00 00       	call   800c24 <sys_getenvid>
+  8001a0:	83 ec 0c             	sub    $0xc,%esp
+  8001a3:	ff 75 0c             	push   0xc(%ebp)
+  8001a6:	ff 75 08             	push   0x8(%ebp)
+  8001a9:	56                   	push   %esi
+  8001aa:	50                   	push   %eax
+  8001ab:	68 e4 28 80 00       	push   $0x8028e4
+  8001b0:	e8 b3 00 00 00       	call   800268 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001b5:	83 c4 18             	add    $0x18,%esp
+  8001b8:	53                   	push   %ebx
+  8001b9:	ff 75 10             	push   0x10(%ebp)
+  8001bc:	e8 56 00 00 00       	call   800217 <vcprintf>
+	cprintf("\n");
+  8001c1:	c7 04 24 40 2d 80 00 	movl   $0x802d40,(%esp)
+  8001c8:	e8 9b 00 00 00       	call   800268 <cprintf>
+  8001cd:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001d0:	cc                   	int3
+	while (1)
+  8001d1:	eb fd                	jmp    8001d0 <_panic+0x43>
+
+008001d3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001d3:	55                   	push   %ebp
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	53                   	push   %ebx
+  8001d7:	83 ec 04             	sub    $0x4,%esp
+  8001da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001dd:	8b 13                	mov    (%ebx),%edx
+  8001df:	8d 42 01             	lea    0x1(%edx),%eax
+  8001e2:	89 03                	mov    %eax,(%ebx)
+  8001e4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001e7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001eb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001f0:	74 09                	je     8001fb <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001f2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f9:	c9                   	leave
+  8001fa:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001fb:	83 ec 08             	sub    $0x8,%esp
+  8001fe:	68 ff 00 00 00       	push   $0xff
+  800203:	8d 43 08             	lea    0x8(%ebx),%eax
+  800206:	50                   	push   %eax
+  800207:	e8 7a 09 00 00       	call   800b86 <sys_cputs>
+		b->idx = 0;
+  80020c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800212:	83 c4 10             	add    $0x10,%esp
+  800215:	eb db                	jmp    8001f2 <putch+0x1f>
+
+00800217 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800217:	55                   	push   %ebp
+  800218:	89 e5                	mov    %esp,%ebp
+  80021a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800220:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800227:	00 00 00 
+	b.cnt = 0;
+  80022a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800231:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800234:	ff 75 0c             	push   0xc(%ebp)
+  800237:	ff 75 08             	push   0x8(%ebp)
+  80023a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800240:	50                   	push   %eax
+  800241:	68 d3 01 80 00       	push   $0x8001d3
+  800246:	e8 14 01 00 00       	call   80035f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80024b:	83 c4 08             	add    $0x8,%esp
+  80024e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800254:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80025a:	50                   	push   %eax
+  80025b:	e8 26 09 00 00       	call   800b86 <sys_cputs>
+
+	return b.cnt;
+}
+  800260:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800266:	c9                   	leave
+  800267:	c3                   	ret
+
+00800268 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800268:	55                   	push   %ebp
+  800269:	89 e5                	mov    %esp,%ebp
+  80026b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80026e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800271:	50                   	push   %eax
+  800272:	ff 75 08             	push   0x8(%ebp)
+  800275:	e8 9d ff ff ff       	call   800217 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80027a:	c9                   	leave
+  80027b:	c3                   	ret
+
+0080027c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80027c:	55                   	push   %ebp
+  80027d:	89 e5                	mov    %esp,%ebp
+  80027f:	57                   	push   %edi
+  800280:	56                   	push   %esi
+  800281:	53                   	push   %ebx
+  800282:	83 ec 1c             	sub    $0x1c,%esp
+  800285:	89 c7                	mov    %eax,%edi
+  800287:	89 d6                	mov    %edx,%esi
+  800289:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80028f:	89 d1                	mov    %edx,%ecx
+  800291:	89 c2                	mov    %eax,%edx
+  800293:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800296:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800299:	8b 45 10             	mov    0x10(%ebp),%eax
+  80029c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80029f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002a2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002a9:	39 c2                	cmp    %eax,%edx
+  8002ab:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002ae:	72 3e                	jb     8002ee <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002b0:	83 ec 0c             	sub    $0xc,%esp
+  8002b3:	ff 75 18             	push   0x18(%ebp)
+  8002b6:	83 eb 01             	sub    $0x1,%ebx
+  8002b9:	53                   	push   %ebx
+  8002ba:	50                   	push   %eax
+  8002bb:	83 ec 08             	sub    $0x8,%esp
+  8002be:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c1:	ff 75 e0             	push   -0x20(%ebp)
+  8002c4:	ff 75 dc             	push   -0x24(%ebp)
+  8002c7:	ff 75 d8             	push   -0x28(%ebp)
+  8002ca:	e8 31 22 00 00       	call   802500 <__udivdi3>
+  8002cf:	83 c4 18             	add    $0x18,%esp
+  8002d2:	52                   	push   %edx
+  8002d3:	50                   	push   %eax
+  8002d4:	89 f2                	mov    %esi,%edx
+  8002d6:	89 f8                	mov    %edi,%eax
+  8002d8:	e8 9f ff ff ff       	call   80027c <printnum>
+  8002dd:	83 c4 20             	add    $0x20,%esp
+  8002e0:	eb 13                	jmp    8002f5 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002e2:	83 ec 08             	sub    $0x8,%esp
+  8002e5:	56                   	push   %esi
+  8002e6:	ff 75 18             	push   0x18(%ebp)
+  8002e9:	ff d7                	call   *%edi
+  8002eb:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002ee:	83 eb 01             	sub    $0x1,%ebx
+  8002f1:	85 db                	test   %ebx,%ebx
+  8002f3:	7f ed                	jg     8002e2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002f5:	83 ec 08             	sub    $0x8,%esp
+  8002f8:	56                   	push   %esi
+  8002f9:	83 ec 04             	sub    $0x4,%esp
+  8002fc:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ff:	ff 75 e0             	push   -0x20(%ebp)
+  800302:	ff 75 dc             	push   -0x24(%ebp)
+  800305:	ff 75 d8             	push   -0x28(%ebp)
+  800308:	e8 b3 22 00 00       	call   8025c0 <__umoddi3>
+  80030d:	83 c4 14             	add    $0x14,%esp
+  800310:	0f be 80 07 29 80 00 	movsbl 0x802907(%eax),%eax
+  800317:	50                   	push   %eax
+  800318:	ff d7                	call   *%edi
+}
+  80031a:	83 c4 10             	add    $0x10,%esp
+  80031d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800320:	5b                   	pop    %ebx
+  800321:	5e                   	pop    %esi
+  800322:	5f                   	pop    %edi
+  800323:	5d                   	pop    %ebp
+  800324:	c3                   	ret
+
+00800325 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800325:	55                   	push   %ebp
+  800326:	89 e5                	mov    %esp,%ebp
+  800328:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80032b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80032f:	8b 10                	mov    (%eax),%edx
+  800331:	3b 50 04             	cmp    0x4(%eax),%edx
+  800334:	73 0a                	jae    800340 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800336:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800339:	89 08                	mov    %ecx,(%eax)
+  80033b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80033e:	88 02                	mov    %al,(%edx)
+}
+  800340:	5d                   	pop    %ebp
+  800341:	c3                   	ret
+
+00800342 <printfmt>:
+{
+  800342:	55                   	push   %ebp
+  800343:	89 e5                	mov    %esp,%ebp
+  800345:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800348:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80034b:	50                   	push   %eax
+  80034c:	ff 75 10             	push   0x10(%ebp)
+  80034f:	ff 75 0c             	push   0xc(%ebp)
+  800352:	ff 75 08             	push   0x8(%ebp)
+  800355:	e8 05 00 00 00       	call   80035f <vprintfmt>
+}
+  80035a:	83 c4 10             	add    $0x10,%esp
+  80035d:	c9                   	leave
+  80035e:	c3                   	ret
+
+0080035f <vprintfmt>:
+{
+  80035f:	55                   	push   %ebp
+  800360:	89 e5                	mov    %esp,%ebp
+  800362:	57                   	push   %edi
+  800363:	56                   	push   %esi
+  800364:	53                   	push   %ebx
+  800365:	83 ec 2c             	sub    $0x2c,%esp
+  800368:	8b 75 08             	mov    0x8(%ebp),%esi
+  80036b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80036e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800371:	eb 0a                	jmp    80037d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800373:	83 ec 08             	sub    $0x8,%esp
+  800376:	53                   	push   %ebx
+  800377:	50                   	push   %eax
+  800378:	ff d6                	call   *%esi
+  80037a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80037d:	83 c7 01             	add    $0x1,%edi
+  800380:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800384:	83 f8 25             	cmp    $0x25,%eax
+  800387:	74 0c                	je     800395 <vprintfmt+0x36>
+			if (ch == '\0')
+  800389:	85 c0                	test   %eax,%eax
+  80038b:	75 e6                	jne    800373 <vprintfmt+0x14>
+}
+  80038d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800390:	5b                   	pop    %ebx
+  800391:	5e                   	pop    %esi
+  800392:	5f                   	pop    %edi
+  800393:	5d                   	pop    %ebp
+  800394:	c3                   	ret
+		padc = ' ';
+  800395:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800399:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003a0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003a7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b3:	8d 47 01             	lea    0x1(%edi),%eax
+  8003b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003b9:	0f b6 17             	movzbl (%edi),%edx
+  8003bc:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003bf:	3c 55                	cmp    $0x55,%al
+  8003c1:	0f 87 cf 03 00 00    	ja     800796 <vprintfmt+0x437>
+  8003c7:	0f b6 c0             	movzbl %al,%eax
+  8003ca:	ff 24 85 40 2a 80 00 	jmp    *0x802a40(,%eax,4)
+  8003d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003d4:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003d8:	eb d9                	jmp    8003b3 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003dd:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003e1:	eb d0                	jmp    8003b3 <vprintfmt+0x54>
+  8003e3:	0f b6 d2             	movzbl %dl,%edx
+  8003e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ee:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003f1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003f4:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003f8:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003fb:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003fe:	83 f9 09             	cmp    $0x9,%ecx
+  800401:	77 55                	ja     800458 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800403:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800406:	eb e9                	jmp    8003f1 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800408:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040b:	8b 00                	mov    (%eax),%eax
+  80040d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800410:	8b 45 14             	mov    0x14(%ebp),%eax
+  800413:	8d 40 04             	lea    0x4(%eax),%eax
+  800416:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800419:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80041c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800420:	79 91                	jns    8003b3 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800422:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800425:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800428:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80042f:	eb 82                	jmp    8003b3 <vprintfmt+0x54>
+			if (width < 0)
+  800431:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800434:	85 d2                	test   %edx,%edx
+  800436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043b:	0f 49 c2             	cmovns %edx,%eax
+  80043e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800441:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800444:	e9 6a ff ff ff       	jmp    8003b3 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800449:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80044c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800453:	e9 5b ff ff ff       	jmp    8003b3 <vprintfmt+0x54>
+  800458:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80045b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80045e:	eb bc                	jmp    80041c <vprintfmt+0xbd>
+			lflag++;
+  800460:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800463:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800466:	e9 48 ff ff ff       	jmp    8003b3 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80046b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046e:	8d 78 04             	lea    0x4(%eax),%edi
+  800471:	83 ec 08             	sub    $0x8,%esp
+  800474:	53                   	push   %ebx
+  800475:	ff 30                	push   (%eax)
+  800477:	ff d6                	call   *%esi
+			break;
+  800479:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80047c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80047f:	e9 b1 02 00 00       	jmp    800735 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800484:	8b 45 14             	mov    0x14(%ebp),%eax
+  800487:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80048a:	8b 10                	mov    (%eax),%edx
+  80048c:	89 d0                	mov    %edx,%eax
+  80048e:	f7 d8                	neg    %eax
+  800490:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800493:	83 f8 0f             	cmp    $0xf,%eax
+  800496:	7f 23                	jg     8004bb <vprintfmt+0x15c>
+  800498:	8b 14 85 a0 2b 80 00 	mov    0x802ba0(,%eax,4),%edx
+  80049f:	85 d2                	test   %edx,%edx
+  8004a1:	74 18                	je     8004bb <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004a3:	52                   	push   %edx
+  8004a4:	68 d5 2c 80 00       	push   $0x802cd5
+  8004a9:	53                   	push   %ebx
+  8004aa:	56                   	push   %esi
+  8004ab:	e8 92 fe ff ff       	call   800342 <printfmt>
+  8004b0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b3:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004b6:	e9 7a 02 00 00       	jmp    800735 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8004bb:	50                   	push   %eax
+  8004bc:	68 1f 29 80 00       	push   $0x80291f
+  8004c1:	53                   	push   %ebx
+  8004c2:	56                   	push   %esi
+  8004c3:	e8 7a fe ff ff       	call   800342 <printfmt>
+  8004c8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004cb:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004ce:	e9 62 02 00 00       	jmp    800735 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d6:	83 c0 04             	add    $0x4,%eax
+  8004d9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004df:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004e1:	85 c9                	test   %ecx,%ecx
+  8004e3:	b8 18 29 80 00       	mov    $0x802918,%eax
+  8004e8:	0f 45 c1             	cmovne %ecx,%eax
+  8004eb:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004ee:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f2:	7e 06                	jle    8004fa <vprintfmt+0x19b>
+  8004f4:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004f8:	75 0b                	jne    800505 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fa:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004fd:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800500:	89 75 08             	mov    %esi,0x8(%ebp)
+  800503:	eb 5c                	jmp    800561 <vprintfmt+0x202>
+  800505:	83 ec 08             	sub    $0x8,%esp
+  800508:	ff 75 d0             	push   -0x30(%ebp)
+  80050b:	ff 75 cc             	push   -0x34(%ebp)
+  80050e:	e8 20 03 00 00       	call   800833 <strnlen>
+  800513:	89 c2                	mov    %eax,%edx
+  800515:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800518:	29 d0                	sub    %edx,%eax
+  80051a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80051d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800521:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800524:	89 75 08             	mov    %esi,0x8(%ebp)
+  800527:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800529:	eb 0e                	jmp    800539 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80052b:	83 ec 08             	sub    $0x8,%esp
+  80052e:	53                   	push   %ebx
+  80052f:	57                   	push   %edi
+  800530:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800533:	83 ee 01             	sub    $0x1,%esi
+  800536:	83 c4 10             	add    $0x10,%esp
+  800539:	85 f6                	test   %esi,%esi
+  80053b:	7f ee                	jg     80052b <vprintfmt+0x1cc>
+  80053d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800540:	8b 75 08             	mov    0x8(%ebp),%esi
+  800543:	85 c0                	test   %eax,%eax
+  800545:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054a:	0f 49 d0             	cmovns %eax,%edx
+  80054d:	29 d0                	sub    %edx,%eax
+  80054f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800552:	eb a6                	jmp    8004fa <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800554:	83 ec 08             	sub    $0x8,%esp
+  800557:	53                   	push   %ebx
+  800558:	52                   	push   %edx
+  800559:	ff 55 08             	call   *0x8(%ebp)
+  80055c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80055f:	89 f1                	mov    %esi,%ecx
+  800561:	8d 71 01             	lea    0x1(%ecx),%esi
+  800564:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800568:	0f be d0             	movsbl %al,%edx
+  80056b:	85 d2                	test   %edx,%edx
+  80056d:	74 28                	je     800597 <vprintfmt+0x238>
+  80056f:	85 ff                	test   %edi,%edi
+  800571:	78 05                	js     800578 <vprintfmt+0x219>
+  800573:	83 ef 01             	sub    $0x1,%edi
+  800576:	78 30                	js     8005a8 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800578:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80057c:	74 d6                	je     800554 <vprintfmt+0x1f5>
+  80057e:	0f be c0             	movsbl %al,%eax
+  800581:	83 e8 20             	sub    $0x20,%eax
+  800584:	83 f8 5e             	cmp    $0x5e,%eax
+  800587:	76 cb                	jbe    800554 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800589:	83 ec 08             	sub    $0x8,%esp
+  80058c:	53                   	push   %ebx
+  80058d:	6a 3f                	push   $0x3f
+  80058f:	ff 55 08             	call   *0x8(%ebp)
+  800592:	83 c4 10             	add    $0x10,%esp
+  800595:	eb c8                	jmp    80055f <vprintfmt+0x200>
+  800597:	8b 75 08             	mov    0x8(%ebp),%esi
+  80059a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80059d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005a0:	01 d0                	add    %edx,%eax
+  8005a2:	29 c8                	sub    %ecx,%eax
+  8005a4:	89 c7                	mov    %eax,%edi
+  8005a6:	eb 13                	jmp    8005bb <vprintfmt+0x25c>
+  8005a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ab:	eb ed                	jmp    80059a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005ad:	83 ec 08             	sub    $0x8,%esp
+  8005b0:	53                   	push   %ebx
+  8005b1:	6a 20                	push   $0x20
+  8005b3:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005b5:	83 ef 01             	sub    $0x1,%edi
+  8005b8:	83 c4 10             	add    $0x10,%esp
+  8005bb:	85 ff                	test   %edi,%edi
+  8005bd:	7f ee                	jg     8005ad <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005bf:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005c2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c5:	e9 6b 01 00 00       	jmp    800735 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8005ca:	83 f9 01             	cmp    $0x1,%ecx
+  8005cd:	7f 1f                	jg     8005ee <vprintfmt+0x28f>
+	else if (lflag)
+  8005cf:	85 c9                	test   %ecx,%ecx
+  8005d1:	74 67                	je     80063a <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d6:	8b 00                	mov    (%eax),%eax
+  8005d8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005db:	89 c1                	mov    %eax,%ecx
+  8005dd:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ec:	eb 17                	jmp    800605 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f1:	8b 50 04             	mov    0x4(%eax),%edx
+  8005f4:	8b 00                	mov    (%eax),%eax
+  8005f6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ff:	8d 40 08             	lea    0x8(%eax),%eax
+  800602:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800605:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800608:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80060b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800610:	85 c9                	test   %ecx,%ecx
+  800612:	0f 89 03 01 00 00    	jns    80071b <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800618:	83 ec 08             	sub    $0x8,%esp
+  80061b:	53                   	push   %ebx
+  80061c:	6a 2d                	push   $0x2d
+  80061e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800620:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800623:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800626:	f7 da                	neg    %edx
+  800628:	83 d1 00             	adc    $0x0,%ecx
+  80062b:	f7 d9                	neg    %ecx
+  80062d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800630:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800635:	e9 e1 00 00 00       	jmp    80071b <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80063a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063d:	8b 00                	mov    (%eax),%eax
+  80063f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800642:	89 c1                	mov    %eax,%ecx
+  800644:	c1 f9 1f             	sar    $0x1f,%ecx
+  800647:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80064a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064d:	8d 40 04             	lea    0x4(%eax),%eax
+  800650:	89 45 14             	mov    %eax,0x14(%ebp)
+  800653:	eb b0                	jmp    800605 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800655:	83 f9 01             	cmp    $0x1,%ecx
+  800658:	7f 1e                	jg     800678 <vprintfmt+0x319>
+	else if (lflag)
+  80065a:	85 c9                	test   %ecx,%ecx
+  80065c:	74 32                	je     800690 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80065e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800661:	8b 10                	mov    (%eax),%edx
+  800663:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800668:	8d 40 04             	lea    0x4(%eax),%eax
+  80066b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80066e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800673:	e9 a3 00 00 00       	jmp    80071b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067b:	8b 10                	mov    (%eax),%edx
+  80067d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800680:	8d 40 08             	lea    0x8(%eax),%eax
+  800683:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800686:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80068b:	e9 8b 00 00 00       	jmp    80071b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800690:	8b 45 14             	mov    0x14(%ebp),%eax
+  800693:	8b 10                	mov    (%eax),%edx
+  800695:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069a:	8d 40 04             	lea    0x4(%eax),%eax
+  80069d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006a5:	eb 74                	jmp    80071b <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8006a7:	83 f9 01             	cmp    $0x1,%ecx
+  8006aa:	7f 1b                	jg     8006c7 <vprintfmt+0x368>
+	else if (lflag)
+  8006ac:	85 c9                	test   %ecx,%ecx
+  8006ae:	74 2c                	je     8006dc <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8006b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b3:	8b 10                	mov    (%eax),%edx
+  8006b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006c5:	eb 54                	jmp    80071b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ca:	8b 10                	mov    (%eax),%edx
+  8006cc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006cf:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006d5:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006da:	eb 3f                	jmp    80071b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006df:	8b 10                	mov    (%eax),%edx
+  8006e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ec:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006f1:	eb 28                	jmp    80071b <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006f3:	83 ec 08             	sub    $0x8,%esp
+  8006f6:	53                   	push   %ebx
+  8006f7:	6a 30                	push   $0x30
+  8006f9:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006fb:	83 c4 08             	add    $0x8,%esp
+  8006fe:	53                   	push   %ebx
+  8006ff:	6a 78                	push   $0x78
+  800701:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800703:	8b 45 14             	mov    0x14(%ebp),%eax
+  800706:	8b 10                	mov    (%eax),%edx
+  800708:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80070d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800710:	8d 40 04             	lea    0x4(%eax),%eax
+  800713:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800716:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80071b:	83 ec 0c             	sub    $0xc,%esp
+  80071e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800722:	50                   	push   %eax
+  800723:	ff 75 e0             	push   -0x20(%ebp)
+  800726:	57                   	push   %edi
+  800727:	51                   	push   %ecx
+  800728:	52                   	push   %edx
+  800729:	89 da                	mov    %ebx,%edx
+  80072b:	89 f0                	mov    %esi,%eax
+  80072d:	e8 4a fb ff ff       	call   80027c <printnum>
+			break;
+  800732:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800735:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800738:	e9 40 fc ff ff       	jmp    80037d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80073d:	83 f9 01             	cmp    $0x1,%ecx
+  800740:	7f 1b                	jg     80075d <vprintfmt+0x3fe>
+	else if (lflag)
+  800742:	85 c9                	test   %ecx,%ecx
+  800744:	74 2c                	je     800772 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800746:	8b 45 14             	mov    0x14(%ebp),%eax
+  800749:	8b 10                	mov    (%eax),%edx
+  80074b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800750:	8d 40 04             	lea    0x4(%eax),%eax
+  800753:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800756:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80075b:	eb be                	jmp    80071b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80075d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800760:	8b 10                	mov    (%eax),%edx
+  800762:	8b 48 04             	mov    0x4(%eax),%ecx
+  800765:	8d 40 08             	lea    0x8(%eax),%eax
+  800768:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800770:	eb a9                	jmp    80071b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800772:	8b 45 14             	mov    0x14(%ebp),%eax
+  800775:	8b 10                	mov    (%eax),%edx
+  800777:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077c:	8d 40 04             	lea    0x4(%eax),%eax
+  80077f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800782:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800787:	eb 92                	jmp    80071b <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800789:	83 ec 08             	sub    $0x8,%esp
+  80078c:	53                   	push   %ebx
+  80078d:	6a 25                	push   $0x25
+  80078f:	ff d6                	call   *%esi
+			break;
+  800791:	83 c4 10             	add    $0x10,%esp
+  800794:	eb 9f                	jmp    800735 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800796:	83 ec 08             	sub    $0x8,%esp
+  800799:	53                   	push   %ebx
+  80079a:	6a 25                	push   $0x25
+  80079c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80079e:	83 c4 10             	add    $0x10,%esp
+  8007a1:	89 f8                	mov    %edi,%eax
+  8007a3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007a7:	74 05                	je     8007ae <vprintfmt+0x44f>
+  8007a9:	83 e8 01             	sub    $0x1,%eax
+  8007ac:	eb f5                	jmp    8007a3 <vprintfmt+0x444>
+  8007ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007b1:	eb 82                	jmp    800735 <vprintfmt+0x3d6>
+
+008007b3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007b3:	55                   	push   %ebp
+  8007b4:	89 e5                	mov    %esp,%ebp
+  8007b6:	83 ec 18             	sub    $0x18,%esp
+  8007b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007bf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007c2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007c6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007c9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007d0:	85 c0                	test   %eax,%eax
+  8007d2:	74 26                	je     8007fa <vsnprintf+0x47>
+  8007d4:	85 d2                	test   %edx,%edx
+  8007d6:	7e 22                	jle    8007fa <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007d8:	ff 75 14             	push   0x14(%ebp)
+  8007db:	ff 75 10             	push   0x10(%ebp)
+  8007de:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007e1:	50                   	push   %eax
+  8007e2:	68 25 03 80 00       	push   $0x800325
+  8007e7:	e8 73 fb ff ff       	call   80035f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007ec:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007ef:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007f5:	83 c4 10             	add    $0x10,%esp
+}
+  8007f8:	c9                   	leave
+  8007f9:	c3                   	ret
+		return -E_INVAL;
+  8007fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007ff:	eb f7                	jmp    8007f8 <vsnprintf+0x45>
+
+00800801 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800801:	55                   	push   %ebp
+  800802:	89 e5                	mov    %esp,%ebp
+  800804:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800807:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80080a:	50                   	push   %eax
+  80080b:	ff 75 10             	push   0x10(%ebp)
+  80080e:	ff 75 0c             	push   0xc(%ebp)
+  800811:	ff 75 08             	push   0x8(%ebp)
+  800814:	e8 9a ff ff ff       	call   8007b3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800819:	c9                   	leave
+  80081a:	c3                   	ret
+
+0080081b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80081b:	55                   	push   %ebp
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800821:	b8 00 00 00 00       	mov    $0x0,%eax
+  800826:	eb 03                	jmp    80082b <strlen+0x10>
+		n++;
+  800828:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80082b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80082f:	75 f7                	jne    800828 <strlen+0xd>
+	return n;
+}
+  800831:	5d                   	pop    %ebp
+  800832:	c3                   	ret
+
+00800833 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800833:	55                   	push   %ebp
+  800834:	89 e5                	mov    %esp,%ebp
+  800836:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800839:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80083c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800841:	eb 03                	jmp    800846 <strnlen+0x13>
+		n++;
+  800843:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800846:	39 d0                	cmp    %edx,%eax
+  800848:	74 08                	je     800852 <strnlen+0x1f>
+  80084a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80084e:	75 f3                	jne    800843 <strnlen+0x10>
+  800850:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800852:	89 d0                	mov    %edx,%eax
+  800854:	5d                   	pop    %ebp
+  800855:	c3                   	ret
+
+00800856 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800856:	55                   	push   %ebp
+  800857:	89 e5                	mov    %esp,%ebp
+  800859:	53                   	push   %ebx
+  80085a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800860:	b8 00 00 00 00       	mov    $0x0,%eax
+  800865:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800869:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80086c:	83 c0 01             	add    $0x1,%eax
+  80086f:	84 d2                	test   %dl,%dl
+  800871:	75 f2                	jne    800865 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800873:	89 c8                	mov    %ecx,%eax
+  800875:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800878:	c9                   	leave
+  800879:	c3                   	ret
+
+0080087a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80087a:	55                   	push   %ebp
+  80087b:	89 e5                	mov    %esp,%ebp
+  80087d:	53                   	push   %ebx
+  80087e:	83 ec 10             	sub    $0x10,%esp
+  800881:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800884:	53                   	push   %ebx
+  800885:	e8 91 ff ff ff       	call   80081b <strlen>
+  80088a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80088d:	ff 75 0c             	push   0xc(%ebp)
+  800890:	01 d8                	add    %ebx,%eax
+  800892:	50                   	push   %eax
+  800893:	e8 be ff ff ff       	call   800856 <strcpy>
+	return dst;
+}
+  800898:	89 d8                	mov    %ebx,%eax
+  80089a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80089d:	c9                   	leave
+  80089e:	c3                   	ret
+
+0080089f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80089f:	55                   	push   %ebp
+  8008a0:	89 e5                	mov    %esp,%ebp
+  8008a2:	56                   	push   %esi
+  8008a3:	53                   	push   %ebx
+  8008a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008aa:	89 f3                	mov    %esi,%ebx
+  8008ac:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008af:	89 f0                	mov    %esi,%eax
+  8008b1:	eb 0f                	jmp    8008c2 <strncpy+0x23>
+		*dst++ = *src;
+  8008b3:	83 c0 01             	add    $0x1,%eax
+  8008b6:	0f b6 0a             	movzbl (%edx),%ecx
+  8008b9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008bc:	80 f9 01             	cmp    $0x1,%cl
+  8008bf:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008c2:	39 d8                	cmp    %ebx,%eax
+  8008c4:	75 ed                	jne    8008b3 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008c6:	89 f0                	mov    %esi,%eax
+  8008c8:	5b                   	pop    %ebx
+  8008c9:	5e                   	pop    %esi
+  8008ca:	5d                   	pop    %ebp
+  8008cb:	c3                   	ret
+
+008008cc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008cc:	55                   	push   %ebp
+  8008cd:	89 e5                	mov    %esp,%ebp
+  8008cf:	56                   	push   %esi
+  8008d0:	53                   	push   %ebx
+  8008d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d7:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008da:	89 f0                	mov    %esi,%eax
+  8008dc:	85 d2                	test   %edx,%edx
+  8008de:	74 21                	je     800901 <strlcpy+0x35>
+  8008e0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008e4:	89 f2                	mov    %esi,%edx
+  8008e6:	eb 09                	jmp    8008f1 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008e8:	83 c1 01             	add    $0x1,%ecx
+  8008eb:	83 c2 01             	add    $0x1,%edx
+  8008ee:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008f1:	39 c2                	cmp    %eax,%edx
+  8008f3:	74 09                	je     8008fe <strlcpy+0x32>
+  8008f5:	0f b6 19             	movzbl (%ecx),%ebx
+  8008f8:	84 db                	test   %bl,%bl
+  8008fa:	75 ec                	jne    8008e8 <strlcpy+0x1c>
+  8008fc:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008fe:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800901:	29 f0                	sub    %esi,%eax
+}
+  800903:	5b                   	pop    %ebx
+  800904:	5e                   	pop    %esi
+  800905:	5d                   	pop    %ebp
+  800906:	c3                   	ret
+
+00800907 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800907:	55                   	push   %ebp
+  800908:	89 e5                	mov    %esp,%ebp
+  80090a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80090d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800910:	eb 06                	jmp    800918 <strcmp+0x11>
+		p++, q++;
+  800912:	83 c1 01             	add    $0x1,%ecx
+  800915:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800918:	0f b6 01             	movzbl (%ecx),%eax
+  80091b:	84 c0                	test   %al,%al
+  80091d:	74 04                	je     800923 <strcmp+0x1c>
+  80091f:	3a 02                	cmp    (%edx),%al
+  800921:	74 ef                	je     800912 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800923:	0f b6 c0             	movzbl %al,%eax
+  800926:	0f b6 12             	movzbl (%edx),%edx
+  800929:	29 d0                	sub    %edx,%eax
+}
+  80092b:	5d                   	pop    %ebp
+  80092c:	c3                   	ret
+
+0080092d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80092d:	55                   	push   %ebp
+  80092e:	89 e5                	mov    %esp,%ebp
+  800930:	53                   	push   %ebx
+  800931:	8b 45 08             	mov    0x8(%ebp),%eax
+  800934:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800937:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80093a:	eb 09                	jmp    800945 <strncmp+0x18>
+		n--, p++, q++;
+  80093c:	83 ea 01             	sub    $0x1,%edx
+  80093f:	83 c0 01             	add    $0x1,%eax
+  800942:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800945:	85 d2                	test   %edx,%edx
+  800947:	74 18                	je     800961 <strncmp+0x34>
+  800949:	0f b6 18             	movzbl (%eax),%ebx
+  80094c:	84 db                	test   %bl,%bl
+  80094e:	74 04                	je     800954 <strncmp+0x27>
+  800950:	3a 19                	cmp    (%ecx),%bl
+  800952:	74 e8                	je     80093c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800954:	0f b6 00             	movzbl (%eax),%eax
+  800957:	0f b6 11             	movzbl (%ecx),%edx
+  80095a:	29 d0                	sub    %edx,%eax
+}
+  80095c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095f:	c9                   	leave
+  800960:	c3                   	ret
+		return 0;
+  800961:	b8 00 00 00 00       	mov    $0x0,%eax
+  800966:	eb f4                	jmp    80095c <strncmp+0x2f>
+
+00800968 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800972:	eb 03                	jmp    800977 <strchr+0xf>
+  800974:	83 c0 01             	add    $0x1,%eax
+  800977:	0f b6 10             	movzbl (%eax),%edx
+  80097a:	84 d2                	test   %dl,%dl
+  80097c:	74 06                	je     800984 <strchr+0x1c>
+		if (*s == c)
+  80097e:	38 ca                	cmp    %cl,%dl
+  800980:	75 f2                	jne    800974 <strchr+0xc>
+  800982:	eb 05                	jmp    800989 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800984:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800989:	5d                   	pop    %ebp
+  80098a:	c3                   	ret
+
+0080098b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80098b:	55                   	push   %ebp
+  80098c:	89 e5                	mov    %esp,%ebp
+  80098e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800991:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800995:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800998:	38 ca                	cmp    %cl,%dl
+  80099a:	74 09                	je     8009a5 <strfind+0x1a>
+  80099c:	84 d2                	test   %dl,%dl
+  80099e:	74 05                	je     8009a5 <strfind+0x1a>
+	for (; *s; s++)
+  8009a0:	83 c0 01             	add    $0x1,%eax
+  8009a3:	eb f0                	jmp    800995 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009a5:	5d                   	pop    %ebp
+  8009a6:	c3                   	ret
+
+008009a7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	57                   	push   %edi
+  8009ab:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009ae:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009b1:	85 c9                	test   %ecx,%ecx
+  8009b3:	74 20                	je     8009d5 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009b5:	89 f8                	mov    %edi,%eax
+  8009b7:	09 c8                	or     %ecx,%eax
+  8009b9:	a8 03                	test   $0x3,%al
+  8009bb:	75 12                	jne    8009cf <memset+0x28>
+		c &= 0xFF;
+  8009bd:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009c1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009c7:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009ca:	fc                   	cld
+  8009cb:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009cd:	eb 06                	jmp    8009d5 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009d2:	fc                   	cld
+  8009d3:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009d5:	89 f8                	mov    %edi,%eax
+  8009d7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009da:	c9                   	leave
+  8009db:	c3                   	ret
+
+008009dc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	57                   	push   %edi
+  8009e0:	56                   	push   %esi
+  8009e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009ea:	39 c6                	cmp    %eax,%esi
+  8009ec:	73 32                	jae    800a20 <memmove+0x44>
+  8009ee:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009f1:	39 d0                	cmp    %edx,%eax
+  8009f3:	73 2b                	jae    800a20 <memmove+0x44>
+		s += n;
+		d += n;
+  8009f5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009f8:	89 d6                	mov    %edx,%esi
+  8009fa:	09 fe                	or     %edi,%esi
+  8009fc:	09 ce                	or     %ecx,%esi
+  8009fe:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a04:	75 0e                	jne    800a14 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a06:	83 ef 04             	sub    $0x4,%edi
+  800a09:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a0c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a0f:	fd                   	std
+  800a10:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a12:	eb 09                	jmp    800a1d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a14:	83 ef 01             	sub    $0x1,%edi
+  800a17:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a1a:	fd                   	std
+  800a1b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a1d:	fc                   	cld
+  800a1e:	eb 1a                	jmp    800a3a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a20:	89 f2                	mov    %esi,%edx
+  800a22:	09 c2                	or     %eax,%edx
+  800a24:	09 ca                	or     %ecx,%edx
+  800a26:	f6 c2 03             	test   $0x3,%dl
+  800a29:	75 0a                	jne    800a35 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a2b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a2e:	89 c7                	mov    %eax,%edi
+  800a30:	fc                   	cld
+  800a31:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a33:	eb 05                	jmp    800a3a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a35:	89 c7                	mov    %eax,%edi
+  800a37:	fc                   	cld
+  800a38:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a3a:	5e                   	pop    %esi
+  800a3b:	5f                   	pop    %edi
+  800a3c:	5d                   	pop    %ebp
+  800a3d:	c3                   	ret
+
+00800a3e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a3e:	55                   	push   %ebp
+  800a3f:	89 e5                	mov    %esp,%ebp
+  800a41:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a44:	ff 75 10             	push   0x10(%ebp)
+  800a47:	ff 75 0c             	push   0xc(%ebp)
+  800a4a:	ff 75 08             	push   0x8(%ebp)
+  800a4d:	e8 8a ff ff ff       	call   8009dc <memmove>
+}
+  800a52:	c9                   	leave
+  800a53:	c3                   	ret
+
+00800a54 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	56                   	push   %esi
+  800a58:	53                   	push   %ebx
+  800a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a5f:	89 c6                	mov    %eax,%esi
+  800a61:	03 75 10             	add    0x10(%ebp),%esi
+  800a64:	eb 06                	jmp    800a6c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a66:	83 c0 01             	add    $0x1,%eax
+  800a69:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a6c:	39 f0                	cmp    %esi,%eax
+  800a6e:	74 14                	je     800a84 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a70:	0f b6 08             	movzbl (%eax),%ecx
+  800a73:	0f b6 1a             	movzbl (%edx),%ebx
+  800a76:	38 d9                	cmp    %bl,%cl
+  800a78:	74 ec                	je     800a66 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a7a:	0f b6 c1             	movzbl %cl,%eax
+  800a7d:	0f b6 db             	movzbl %bl,%ebx
+  800a80:	29 d8                	sub    %ebx,%eax
+  800a82:	eb 05                	jmp    800a89 <memcmp+0x35>
+	}
+
+	return 0;
+  800a84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a89:	5b                   	pop    %ebx
+  800a8a:	5e                   	pop    %esi
+  800a8b:	5d                   	pop    %ebp
+  800a8c:	c3                   	ret
+
+00800a8d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a8d:	55                   	push   %ebp
+  800a8e:	89 e5                	mov    %esp,%ebp
+  800a90:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a96:	89 c2                	mov    %eax,%edx
+  800a98:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a9b:	eb 03                	jmp    800aa0 <memfind+0x13>
+  800a9d:	83 c0 01             	add    $0x1,%eax
+  800aa0:	39 d0                	cmp    %edx,%eax
+  800aa2:	73 04                	jae    800aa8 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aa4:	38 08                	cmp    %cl,(%eax)
+  800aa6:	75 f5                	jne    800a9d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aa8:	5d                   	pop    %ebp
+  800aa9:	c3                   	ret
+
+00800aaa <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800aaa:	55                   	push   %ebp
+  800aab:	89 e5                	mov    %esp,%ebp
+  800aad:	57                   	push   %edi
+  800aae:	56                   	push   %esi
+  800aaf:	53                   	push   %ebx
+  800ab0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ab6:	eb 03                	jmp    800abb <strtol+0x11>
+		s++;
+  800ab8:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800abb:	0f b6 02             	movzbl (%edx),%eax
+  800abe:	3c 20                	cmp    $0x20,%al
+  800ac0:	74 f6                	je     800ab8 <strtol+0xe>
+  800ac2:	3c 09                	cmp    $0x9,%al
+  800ac4:	74 f2                	je     800ab8 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ac6:	3c 2b                	cmp    $0x2b,%al
+  800ac8:	74 2a                	je     800af4 <strtol+0x4a>
+	int neg = 0;
+  800aca:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800acf:	3c 2d                	cmp    $0x2d,%al
+  800ad1:	74 2b                	je     800afe <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ad9:	75 0f                	jne    800aea <strtol+0x40>
+  800adb:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ade:	74 28                	je     800b08 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ae0:	85 db                	test   %ebx,%ebx
+  800ae2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ae7:	0f 44 d8             	cmove  %eax,%ebx
+  800aea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aef:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800af2:	eb 46                	jmp    800b3a <strtol+0x90>
+		s++;
+  800af4:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800af7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800afc:	eb d5                	jmp    800ad3 <strtol+0x29>
+		s++, neg = 1;
+  800afe:	83 c2 01             	add    $0x1,%edx
+  800b01:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b06:	eb cb                	jmp    800ad3 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b08:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b0c:	74 0e                	je     800b1c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b0e:	85 db                	test   %ebx,%ebx
+  800b10:	75 d8                	jne    800aea <strtol+0x40>
+		s++, base = 8;
+  800b12:	83 c2 01             	add    $0x1,%edx
+  800b15:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b1a:	eb ce                	jmp    800aea <strtol+0x40>
+		s += 2, base = 16;
+  800b1c:	83 c2 02             	add    $0x2,%edx
+  800b1f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b24:	eb c4                	jmp    800aea <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b26:	0f be c0             	movsbl %al,%eax
+  800b29:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b2c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b2f:	7d 3a                	jge    800b6b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b31:	83 c2 01             	add    $0x1,%edx
+  800b34:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b38:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b3a:	0f b6 02             	movzbl (%edx),%eax
+  800b3d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b40:	89 f3                	mov    %esi,%ebx
+  800b42:	80 fb 09             	cmp    $0x9,%bl
+  800b45:	76 df                	jbe    800b26 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b47:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b4a:	89 f3                	mov    %esi,%ebx
+  800b4c:	80 fb 19             	cmp    $0x19,%bl
+  800b4f:	77 08                	ja     800b59 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b51:	0f be c0             	movsbl %al,%eax
+  800b54:	83 e8 57             	sub    $0x57,%eax
+  800b57:	eb d3                	jmp    800b2c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b59:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b5c:	89 f3                	mov    %esi,%ebx
+  800b5e:	80 fb 19             	cmp    $0x19,%bl
+  800b61:	77 08                	ja     800b6b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b63:	0f be c0             	movsbl %al,%eax
+  800b66:	83 e8 37             	sub    $0x37,%eax
+  800b69:	eb c1                	jmp    800b2c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b6b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b6f:	74 05                	je     800b76 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b74:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b76:	89 c8                	mov    %ecx,%eax
+  800b78:	f7 d8                	neg    %eax
+  800b7a:	85 ff                	test   %edi,%edi
+  800b7c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b7f:	89 c8                	mov    %ecx,%eax
+  800b81:	5b                   	pop    %ebx
+  800b82:	5e                   	pop    %esi
+  800b83:	5f                   	pop    %edi
+  800b84:	5d                   	pop    %ebp
+  800b85:	c3                   	ret
+
+00800b86 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b86:	55                   	push   %ebp
+  800b87:	89 e5                	mov    %esp,%ebp
+  800b89:	57                   	push   %edi
+  800b8a:	56                   	push   %esi
+  800b8b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b97:	89 c3                	mov    %eax,%ebx
+  800b99:	89 c7                	mov    %eax,%edi
+  800b9b:	89 c6                	mov    %eax,%esi
+  800b9d:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b9f:	5b                   	pop    %ebx
+  800ba0:	5e                   	pop    %esi
+  800ba1:	5f                   	pop    %edi
+  800ba2:	5d                   	pop    %ebp
+  800ba3:	c3                   	ret
+
+00800ba4 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	57                   	push   %edi
+  800ba8:	56                   	push   %esi
+  800ba9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800baa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800baf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bb4:	89 d1                	mov    %edx,%ecx
+  800bb6:	89 d3                	mov    %edx,%ebx
+  800bb8:	89 d7                	mov    %edx,%edi
+  800bba:	89 d6                	mov    %edx,%esi
+  800bbc:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bbe:	5b                   	pop    %ebx
+  800bbf:	5e                   	pop    %esi
+  800bc0:	5f                   	pop    %edi
+  800bc1:	5d                   	pop    %ebp
+  800bc2:	c3                   	ret
+
+00800bc3 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800bc3:	55                   	push   %ebp
+  800bc4:	89 e5                	mov    %esp,%ebp
+  800bc6:	57                   	push   %edi
+  800bc7:	56                   	push   %esi
+  800bc8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bc9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bd6:	89 cb                	mov    %ecx,%ebx
+  800bd8:	89 cf                	mov    %ecx,%edi
+  800bda:	89 ce                	mov    %ecx,%esi
+  800bdc:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800bde:	5b                   	pop    %ebx
+  800bdf:	5e                   	pop    %esi
+  800be0:	5f                   	pop    %edi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+
+00800be3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	57                   	push   %edi
+  800be7:	56                   	push   %esi
+  800be8:	53                   	push   %ebx
+  800be9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bf9:	89 cb                	mov    %ecx,%ebx
+  800bfb:	89 cf                	mov    %ecx,%edi
+  800bfd:	89 ce                	mov    %ecx,%esi
+  800bff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c01:	85 c0                	test   %eax,%eax
+  800c03:	7f 08                	jg     800c0d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c08:	5b                   	pop    %ebx
+  800c09:	5e                   	pop    %esi
+  800c0a:	5f                   	pop    %edi
+  800c0b:	5d                   	pop    %ebp
+  800c0c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c0d:	83 ec 0c             	sub    $0xc,%esp
+  800c10:	50                   	push   %eax
+  800c11:	6a 03                	push   $0x3
+  800c13:	68 ff 2b 80 00       	push   $0x802bff
+  800c18:	6a 23                	push   $0x23
+  800c1a:	68 1c 2c 80 00       	push   $0x802c1c
+  800c1f:	e8 69 f5 ff ff       	call   80018d <_panic>
+
+00800c24 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	56                   	push   %esi
+  800c29:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c34:	89 d1                	mov    %edx,%ecx
+  800c36:	89 d3                	mov    %edx,%ebx
+  800c38:	89 d7                	mov    %edx,%edi
+  800c3a:	89 d6                	mov    %edx,%esi
+  800c3c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c3e:	5b                   	pop    %ebx
+  800c3f:	5e                   	pop    %esi
+  800c40:	5f                   	pop    %edi
+  800c41:	5d                   	pop    %ebp
+  800c42:	c3                   	ret
+
+00800c43 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c43:	55                   	push   %ebp
+  800c44:	89 e5                	mov    %esp,%ebp
+  800c46:	57                   	push   %edi
+  800c47:	56                   	push   %esi
+  800c48:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4e:	b8 16 00 00 00       	mov    $0x16,%eax
+  800c53:	89 d1                	mov    %edx,%ecx
+  800c55:	89 d3                	mov    %edx,%ebx
+  800c57:	89 d7                	mov    %edx,%edi
+  800c59:	89 d6                	mov    %edx,%esi
+  800c5b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c5d:	5b                   	pop    %ebx
+  800c5e:	5e                   	pop    %esi
+  800c5f:	5f                   	pop    %edi
+  800c60:	5d                   	pop    %ebp
+  800c61:	c3                   	ret
+
+00800c62 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800c62:	55                   	push   %ebp
+  800c63:	89 e5                	mov    %esp,%ebp
+  800c65:	57                   	push   %edi
+  800c66:	56                   	push   %esi
+  800c67:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c6d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800c72:	89 d1                	mov    %edx,%ecx
+  800c74:	89 d3                	mov    %edx,%ebx
+  800c76:	89 d7                	mov    %edx,%edi
+  800c78:	89 d6                	mov    %edx,%esi
+  800c7a:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800c7c:	5b                   	pop    %ebx
+  800c7d:	5e                   	pop    %esi
+  800c7e:	5f                   	pop    %edi
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+
+00800c81 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	57                   	push   %edi
+  800c85:	56                   	push   %esi
+  800c86:	53                   	push   %ebx
+  800c87:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c95:	b8 15 00 00 00       	mov    $0x15,%eax
+  800c9a:	89 df                	mov    %ebx,%edi
+  800c9c:	89 de                	mov    %ebx,%esi
+  800c9e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ca0:	85 c0                	test   %eax,%eax
+  800ca2:	7f 08                	jg     800cac <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800ca4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca7:	5b                   	pop    %ebx
+  800ca8:	5e                   	pop    %esi
+  800ca9:	5f                   	pop    %edi
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cac:	83 ec 0c             	sub    $0xc,%esp
+  800caf:	50                   	push   %eax
+  800cb0:	6a 15                	push   $0x15
+  800cb2:	68 ff 2b 80 00       	push   $0x802bff
+  800cb7:	6a 23                	push   $0x23
+  800cb9:	68 1c 2c 80 00       	push   $0x802c1c
+  800cbe:	e8 ca f4 ff ff       	call   80018d <_panic>
+
+00800cc3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cc3:	55                   	push   %ebp
+  800cc4:	89 e5                	mov    %esp,%ebp
+  800cc6:	57                   	push   %edi
+  800cc7:	56                   	push   %esi
+  800cc8:	53                   	push   %ebx
+  800cc9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ccc:	be 00 00 00 00       	mov    $0x0,%esi
+  800cd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cdc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cdf:	89 f7                	mov    %esi,%edi
+  800ce1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ce3:	85 c0                	test   %eax,%eax
+  800ce5:	7f 08                	jg     800cef <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ce7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cea:	5b                   	pop    %ebx
+  800ceb:	5e                   	pop    %esi
+  800cec:	5f                   	pop    %edi
+  800ced:	5d                   	pop    %ebp
+  800cee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cef:	83 ec 0c             	sub    $0xc,%esp
+  800cf2:	50                   	push   %eax
+  800cf3:	6a 05                	push   $0x5
+  800cf5:	68 ff 2b 80 00       	push   $0x802bff
+  800cfa:	6a 23                	push   $0x23
+  800cfc:	68 1c 2c 80 00       	push   $0x802c1c
+  800d01:	e8 87 f4 ff ff       	call   80018d <_panic>
+
+00800d06 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	57                   	push   %edi
+  800d0a:	56                   	push   %esi
+  800d0b:	53                   	push   %ebx
+  800d0c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d0f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d22:	89 f7                	mov    %esi,%edi
+  800d24:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d26:	85 c0                	test   %eax,%eax
+  800d28:	7f 08                	jg     800d32 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d2d:	5b                   	pop    %ebx
+  800d2e:	5e                   	pop    %esi
+  800d2f:	5f                   	pop    %edi
+  800d30:	5d                   	pop    %ebp
+  800d31:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d32:	83 ec 0c             	sub    $0xc,%esp
+  800d35:	50                   	push   %eax
+  800d36:	6a 06                	push   $0x6
+  800d38:	68 ff 2b 80 00       	push   $0x802bff
+  800d3d:	6a 23                	push   $0x23
+  800d3f:	68 1c 2c 80 00       	push   $0x802c1c
+  800d44:	e8 44 f4 ff ff       	call   80018d <_panic>
+
+00800d49 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d49:	55                   	push   %ebp
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	57                   	push   %edi
+  800d4d:	56                   	push   %esi
+  800d4e:	53                   	push   %ebx
+  800d4f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d58:	b8 07 00 00 00       	mov    $0x7,%eax
+  800d5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d60:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d63:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d66:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d68:	85 c0                	test   %eax,%eax
+  800d6a:	7f 08                	jg     800d74 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6f:	5b                   	pop    %ebx
+  800d70:	5e                   	pop    %esi
+  800d71:	5f                   	pop    %edi
+  800d72:	5d                   	pop    %ebp
+  800d73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d74:	83 ec 0c             	sub    $0xc,%esp
+  800d77:	50                   	push   %eax
+  800d78:	6a 07                	push   $0x7
+  800d7a:	68 ff 2b 80 00       	push   $0x802bff
+  800d7f:	6a 23                	push   $0x23
+  800d81:	68 1c 2c 80 00       	push   $0x802c1c
+  800d86:	e8 02 f4 ff ff       	call   80018d <_panic>
+
+00800d8b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d8b:	55                   	push   %ebp
+  800d8c:	89 e5                	mov    %esp,%ebp
+  800d8e:	57                   	push   %edi
+  800d8f:	56                   	push   %esi
+  800d90:	53                   	push   %ebx
+  800d91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800da4:	89 df                	mov    %ebx,%edi
+  800da6:	89 de                	mov    %ebx,%esi
+  800da8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800daa:	85 c0                	test   %eax,%eax
+  800dac:	7f 08                	jg     800db6 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db1:	5b                   	pop    %ebx
+  800db2:	5e                   	pop    %esi
+  800db3:	5f                   	pop    %edi
+  800db4:	5d                   	pop    %ebp
+  800db5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db6:	83 ec 0c             	sub    $0xc,%esp
+  800db9:	50                   	push   %eax
+  800dba:	6a 08                	push   $0x8
+  800dbc:	68 ff 2b 80 00       	push   $0x802bff
+  800dc1:	6a 23                	push   $0x23
+  800dc3:	68 1c 2c 80 00       	push   $0x802c1c
+  800dc8:	e8 c0 f3 ff ff       	call   80018d <_panic>
+
+00800dcd <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	57                   	push   %edi
+  800dd1:	56                   	push   %esi
+  800dd2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd9:	b8 09 00 00 00       	mov    $0x9,%eax
+  800dde:	be 00 00 00 00       	mov    $0x0,%esi
+  800de3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de9:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800deb:	5b                   	pop    %ebx
+  800dec:	5e                   	pop    %esi
+  800ded:	5f                   	pop    %edi
+  800dee:	5d                   	pop    %ebp
+  800def:	c3                   	ret
+
+00800df0 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800df0:	55                   	push   %ebp
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	57                   	push   %edi
+  800df4:	56                   	push   %esi
+  800df5:	53                   	push   %ebx
+  800df6:	8b 45 18             	mov    0x18(%ebp),%eax
+  800df9:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800dfc:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800e01:	77 27                	ja     800e2a <sys_page_map_range+0x3a>
+  800e03:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800e09:	77 1f                	ja     800e2a <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800e0b:	c1 e0 0c             	shl    $0xc,%eax
+  800e0e:	89 c6                	mov    %eax,%esi
+  800e10:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800e12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e18:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e20:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e23:	cd 30                	int    $0x30
+}
+  800e25:	5b                   	pop    %ebx
+  800e26:	5e                   	pop    %esi
+  800e27:	5f                   	pop    %edi
+  800e28:	5d                   	pop    %ebp
+  800e29:	c3                   	ret
+		return -E_INVAL;
+  800e2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e2f:	eb f4                	jmp    800e25 <sys_page_map_range+0x35>
+
+00800e31 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e40:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e45:	be 00 00 00 00       	mov    $0x0,%esi
+  800e4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e50:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e52:	85 c0                	test   %eax,%eax
+  800e54:	7f 08                	jg     800e5e <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800e56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e59:	5b                   	pop    %ebx
+  800e5a:	5e                   	pop    %esi
+  800e5b:	5f                   	pop    %edi
+  800e5c:	5d                   	pop    %ebp
+  800e5d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5e:	83 ec 0c             	sub    $0xc,%esp
+  800e61:	50                   	push   %eax
+  800e62:	6a 0c                	push   $0xc
+  800e64:	68 ff 2b 80 00       	push   $0x802bff
+  800e69:	6a 23                	push   $0x23
+  800e6b:	68 1c 2c 80 00       	push   $0x802c1c
+  800e70:	e8 18 f3 ff ff       	call   80018d <_panic>
+
+00800e75 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e75:	55                   	push   %ebp
+  800e76:	89 e5                	mov    %esp,%ebp
+  800e78:	57                   	push   %edi
+  800e79:	56                   	push   %esi
+  800e7a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e7b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e86:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8e:	89 f7                	mov    %esi,%edi
+  800e90:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e92:	5b                   	pop    %ebx
+  800e93:	5e                   	pop    %esi
+  800e94:	5f                   	pop    %edi
+  800e95:	5d                   	pop    %ebp
+  800e96:	c3                   	ret
+
+00800e97 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  800e9d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eab:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800eb0:	89 df                	mov    %ebx,%edi
+  800eb2:	89 de                	mov    %ebx,%esi
+  800eb4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb6:	85 c0                	test   %eax,%eax
+  800eb8:	7f 08                	jg     800ec2 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800eba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebd:	5b                   	pop    %ebx
+  800ebe:	5e                   	pop    %esi
+  800ebf:	5f                   	pop    %edi
+  800ec0:	5d                   	pop    %ebp
+  800ec1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec2:	83 ec 0c             	sub    $0xc,%esp
+  800ec5:	50                   	push   %eax
+  800ec6:	6a 0f                	push   $0xf
+  800ec8:	68 ff 2b 80 00       	push   $0x802bff
+  800ecd:	6a 23                	push   $0x23
+  800ecf:	68 1c 2c 80 00       	push   $0x802c1c
+  800ed4:	e8 b4 f2 ff ff       	call   80018d <_panic>
+
+00800ed9 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800ed9:	55                   	push   %ebp
+  800eda:	89 e5                	mov    %esp,%ebp
+  800edc:	57                   	push   %edi
+  800edd:	56                   	push   %esi
+  800ede:	53                   	push   %ebx
+  800edf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ee2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eed:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ef2:	89 df                	mov    %ebx,%edi
+  800ef4:	89 de                	mov    %ebx,%esi
+  800ef6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef8:	85 c0                	test   %eax,%eax
+  800efa:	7f 08                	jg     800f04 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800efc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eff:	5b                   	pop    %ebx
+  800f00:	5e                   	pop    %esi
+  800f01:	5f                   	pop    %edi
+  800f02:	5d                   	pop    %ebp
+  800f03:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f04:	83 ec 0c             	sub    $0xc,%esp
+  800f07:	50                   	push   %eax
+  800f08:	6a 10                	push   $0x10
+  800f0a:	68 ff 2b 80 00       	push   $0x802bff
+  800f0f:	6a 23                	push   $0x23
+  800f11:	68 1c 2c 80 00       	push   $0x802c1c
+  800f16:	e8 72 f2 ff ff       	call   80018d <_panic>
+
+00800f1b <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	57                   	push   %edi
+  800f1f:	56                   	push   %esi
+  800f20:	53                   	push   %ebx
+  800f21:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f34:	89 df                	mov    %ebx,%edi
+  800f36:	89 de                	mov    %ebx,%esi
+  800f38:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f3a:	85 c0                	test   %eax,%eax
+  800f3c:	7f 08                	jg     800f46 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800f3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f41:	5b                   	pop    %ebx
+  800f42:	5e                   	pop    %esi
+  800f43:	5f                   	pop    %edi
+  800f44:	5d                   	pop    %ebp
+  800f45:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f46:	83 ec 0c             	sub    $0xc,%esp
+  800f49:	50                   	push   %eax
+  800f4a:	6a 11                	push   $0x11
+  800f4c:	68 ff 2b 80 00       	push   $0x802bff
+  800f51:	6a 23                	push   $0x23
+  800f53:	68 1c 2c 80 00       	push   $0x802c1c
+  800f58:	e8 30 f2 ff ff       	call   80018d <_panic>
+
+00800f5d <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800f5d:	55                   	push   %ebp
+  800f5e:	89 e5                	mov    %esp,%ebp
+  800f60:	57                   	push   %edi
+  800f61:	56                   	push   %esi
+  800f62:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f68:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f6d:	89 d1                	mov    %edx,%ecx
+  800f6f:	89 d3                	mov    %edx,%ebx
+  800f71:	89 d7                	mov    %edx,%edi
+  800f73:	89 d6                	mov    %edx,%esi
+  800f75:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800f77:	5b                   	pop    %ebx
+  800f78:	5e                   	pop    %esi
+  800f79:	5f                   	pop    %edi
+  800f7a:	5d                   	pop    %ebp
+  800f7b:	c3                   	ret
+
+00800f7c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	56                   	push   %esi
+  800f81:	53                   	push   %ebx
+  800f82:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f90:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f95:	89 df                	mov    %ebx,%edi
+  800f97:	89 de                	mov    %ebx,%esi
+  800f99:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9b:	85 c0                	test   %eax,%eax
+  800f9d:	7f 08                	jg     800fa7 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5e                   	pop    %esi
+  800fa4:	5f                   	pop    %edi
+  800fa5:	5d                   	pop    %ebp
+  800fa6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa7:	83 ec 0c             	sub    $0xc,%esp
+  800faa:	50                   	push   %eax
+  800fab:	6a 13                	push   $0x13
+  800fad:	68 ff 2b 80 00       	push   $0x802bff
+  800fb2:	6a 23                	push   $0x23
+  800fb4:	68 1c 2c 80 00       	push   $0x802c1c
+  800fb9:	e8 cf f1 ff ff       	call   80018d <_panic>
+
+00800fbe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	57                   	push   %edi
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd2:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fd7:	89 df                	mov    %ebx,%edi
+  800fd9:	89 de                	mov    %ebx,%esi
+  800fdb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fdd:	85 c0                	test   %eax,%eax
+  800fdf:	7f 08                	jg     800fe9 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe4:	5b                   	pop    %ebx
+  800fe5:	5e                   	pop    %esi
+  800fe6:	5f                   	pop    %edi
+  800fe7:	5d                   	pop    %ebp
+  800fe8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe9:	83 ec 0c             	sub    $0xc,%esp
+  800fec:	50                   	push   %eax
+  800fed:	6a 14                	push   $0x14
+  800fef:	68 ff 2b 80 00       	push   $0x802bff
+  800ff4:	6a 23                	push   $0x23
+  800ff6:	68 1c 2c 80 00       	push   $0x802c1c
+  800ffb:	e8 8d f1 ff ff       	call   80018d <_panic>
+
+00801000 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801006:	8b 55 08             	mov    0x8(%ebp),%edx
+  801009:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801011:	be 00 00 00 00       	mov    $0x0,%esi
+  801016:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801019:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80101c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80101e:	5b                   	pop    %ebx
+  80101f:	5e                   	pop    %esi
+  801020:	5f                   	pop    %edi
+  801021:	5d                   	pop    %ebp
+  801022:	c3                   	ret
+
+00801023 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801023:	55                   	push   %ebp
+  801024:	89 e5                	mov    %esp,%ebp
+  801026:	57                   	push   %edi
+  801027:	56                   	push   %esi
+  801028:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801029:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801034:	be 00 00 00 00       	mov    $0x0,%esi
+  801039:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80103f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801041:	5b                   	pop    %ebx
+  801042:	5e                   	pop    %esi
+  801043:	5f                   	pop    %edi
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+
+00801046 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+  801049:	57                   	push   %edi
+  80104a:	56                   	push   %esi
+  80104b:	53                   	push   %ebx
+  80104c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80104f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801054:	8b 55 08             	mov    0x8(%ebp),%edx
+  801057:	b8 19 00 00 00       	mov    $0x19,%eax
+  80105c:	89 cb                	mov    %ecx,%ebx
+  80105e:	89 cf                	mov    %ecx,%edi
+  801060:	89 ce                	mov    %ecx,%esi
+  801062:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801064:	85 c0                	test   %eax,%eax
+  801066:	7f 08                	jg     801070 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801068:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106b:	5b                   	pop    %ebx
+  80106c:	5e                   	pop    %esi
+  80106d:	5f                   	pop    %edi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801070:	83 ec 0c             	sub    $0xc,%esp
+  801073:	50                   	push   %eax
+  801074:	6a 19                	push   $0x19
+  801076:	68 ff 2b 80 00       	push   $0x802bff
+  80107b:	6a 23                	push   $0x23
+  80107d:	68 1c 2c 80 00       	push   $0x802c1c
+  801082:	e8 06 f1 ff ff       	call   80018d <_panic>
+
+00801087 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+  80108a:	57                   	push   %edi
+  80108b:	56                   	push   %esi
+  80108c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80108d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801092:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801097:	89 d1                	mov    %edx,%ecx
+  801099:	89 d3                	mov    %edx,%ebx
+  80109b:	89 d7                	mov    %edx,%edi
+  80109d:	89 d6                	mov    %edx,%esi
+  80109f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010a1:	5b                   	pop    %ebx
+  8010a2:	5e                   	pop    %esi
+  8010a3:	5f                   	pop    %edi
+  8010a4:	5d                   	pop    %ebp
+  8010a5:	c3                   	ret
+
+008010a6 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8010a6:	55                   	push   %ebp
+  8010a7:	89 e5                	mov    %esp,%ebp
+  8010a9:	57                   	push   %edi
+  8010aa:	56                   	push   %esi
+  8010ab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010bc:	89 df                	mov    %ebx,%edi
+  8010be:	89 de                	mov    %ebx,%esi
+  8010c0:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5e                   	pop    %esi
+  8010c4:	5f                   	pop    %edi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+
+008010c7 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	57                   	push   %edi
+  8010cb:	56                   	push   %esi
+  8010cc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010dd:	89 df                	mov    %ebx,%edi
+  8010df:	89 de                	mov    %ebx,%esi
+  8010e1:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  8010e3:	5b                   	pop    %ebx
+  8010e4:	5e                   	pop    %esi
+  8010e5:	5f                   	pop    %edi
+  8010e6:	5d                   	pop    %ebp
+  8010e7:	c3                   	ret
+
+008010e8 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ee:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010f3:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+
+008010f8 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010fe:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801103:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801108:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80110d:	5d                   	pop    %ebp
+  80110e:	c3                   	ret
+
+0080110f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80110f:	55                   	push   %ebp
+  801110:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801112:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801117:	eb 02                	jmp    80111b <fd_alloc+0xc>
+  801119:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80111b:	89 c2                	mov    %eax,%edx
+  80111d:	c1 ea 16             	shr    $0x16,%edx
+  801120:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801127:	f6 c2 01             	test   $0x1,%dl
+  80112a:	74 2b                	je     801157 <fd_alloc+0x48>
+  80112c:	89 c2                	mov    %eax,%edx
+  80112e:	c1 ea 0c             	shr    $0xc,%edx
+  801131:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801138:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80113e:	f6 c1 01             	test   $0x1,%cl
+  801141:	74 14                	je     801157 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801143:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801149:	75 ce                	jne    801119 <fd_alloc+0xa>
+  80114b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801150:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801155:	eb 05                	jmp    80115c <fd_alloc+0x4d>
+			return 0;
+  801157:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80115c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115f:	89 02                	mov    %eax,(%edx)
+}
+  801161:	89 c8                	mov    %ecx,%eax
+  801163:	5d                   	pop    %ebp
+  801164:	c3                   	ret
+
+00801165 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801165:	55                   	push   %ebp
+  801166:	89 e5                	mov    %esp,%ebp
+  801168:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80116b:	83 f8 1f             	cmp    $0x1f,%eax
+  80116e:	77 30                	ja     8011a0 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801170:	c1 e0 0c             	shl    $0xc,%eax
+  801173:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801178:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80117e:	f6 c2 01             	test   $0x1,%dl
+  801181:	74 24                	je     8011a7 <fd_lookup+0x42>
+  801183:	89 c2                	mov    %eax,%edx
+  801185:	c1 ea 0c             	shr    $0xc,%edx
+  801188:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80118f:	f6 c2 01             	test   $0x1,%dl
+  801192:	74 1a                	je     8011ae <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801194:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801197:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801199:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80119e:	5d                   	pop    %ebp
+  80119f:	c3                   	ret
+		return -E_INVAL;
+  8011a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011a5:	eb f7                	jmp    80119e <fd_lookup+0x39>
+		return -E_INVAL;
+  8011a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ac:	eb f0                	jmp    80119e <fd_lookup+0x39>
+  8011ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011b3:	eb e9                	jmp    80119e <fd_lookup+0x39>
+
+008011b5 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	53                   	push   %ebx
+  8011b9:	83 ec 04             	sub    $0x4,%esp
+  8011bc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c4:	eb 03                	jmp    8011c9 <dev_lookup+0x14>
+  8011c6:	83 c0 01             	add    $0x1,%eax
+  8011c9:	8b 1c 85 a8 2c 80 00 	mov    0x802ca8(,%eax,4),%ebx
+  8011d0:	85 db                	test   %ebx,%ebx
+  8011d2:	74 0b                	je     8011df <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8011d4:	39 13                	cmp    %edx,(%ebx)
+  8011d6:	75 ee                	jne    8011c6 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8011d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011dd:	eb 1f                	jmp    8011fe <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8011df:	a1 20 60 80 00       	mov    0x806020,%eax
+  8011e4:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8011e7:	83 ec 04             	sub    $0x4,%esp
+  8011ea:	52                   	push   %edx
+  8011eb:	50                   	push   %eax
+  8011ec:	68 2c 2c 80 00       	push   $0x802c2c
+  8011f1:	e8 72 f0 ff ff       	call   800268 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8011f6:	83 c4 10             	add    $0x10,%esp
+  8011f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8011fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801201:	89 1a                	mov    %ebx,(%edx)
+}
+  801203:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801206:	c9                   	leave
+  801207:	c3                   	ret
+
+00801208 <fd_close>:
+{
+  801208:	55                   	push   %ebp
+  801209:	89 e5                	mov    %esp,%ebp
+  80120b:	57                   	push   %edi
+  80120c:	56                   	push   %esi
+  80120d:	53                   	push   %ebx
+  80120e:	83 ec 24             	sub    $0x24,%esp
+  801211:	8b 75 08             	mov    0x8(%ebp),%esi
+  801214:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801217:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80121a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80121b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801221:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801224:	50                   	push   %eax
+  801225:	e8 3b ff ff ff       	call   801165 <fd_lookup>
+  80122a:	89 c3                	mov    %eax,%ebx
+  80122c:	83 c4 10             	add    $0x10,%esp
+  80122f:	85 c0                	test   %eax,%eax
+  801231:	78 05                	js     801238 <fd_close+0x30>
+	    || fd != fd2)
+  801233:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801236:	74 16                	je     80124e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801238:	89 f8                	mov    %edi,%eax
+  80123a:	84 c0                	test   %al,%al
+  80123c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801241:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801244:	89 d8                	mov    %ebx,%eax
+  801246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801249:	5b                   	pop    %ebx
+  80124a:	5e                   	pop    %esi
+  80124b:	5f                   	pop    %edi
+  80124c:	5d                   	pop    %ebp
+  80124d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80124e:	83 ec 08             	sub    $0x8,%esp
+  801251:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801254:	50                   	push   %eax
+  801255:	ff 36                	push   (%esi)
+  801257:	e8 59 ff ff ff       	call   8011b5 <dev_lookup>
+  80125c:	89 c3                	mov    %eax,%ebx
+  80125e:	83 c4 10             	add    $0x10,%esp
+  801261:	85 c0                	test   %eax,%eax
+  801263:	78 1a                	js     80127f <fd_close+0x77>
+		if (dev->dev_close)
+  801265:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801268:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80126b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801270:	85 c0                	test   %eax,%eax
+  801272:	74 0b                	je     80127f <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801274:	83 ec 0c             	sub    $0xc,%esp
+  801277:	56                   	push   %esi
+  801278:	ff d0                	call   *%eax
+  80127a:	89 c3                	mov    %eax,%ebx
+  80127c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80127f:	83 ec 08             	sub    $0x8,%esp
+  801282:	56                   	push   %esi
+  801283:	6a 00                	push   $0x0
+  801285:	e8 01 fb ff ff       	call   800d8b <sys_page_unmap>
+	return r;
+  80128a:	83 c4 10             	add    $0x10,%esp
+  80128d:	eb b5                	jmp    801244 <fd_close+0x3c>
+
+0080128f <close>:
+
+int
+close(int fdnum)
+{
+  80128f:	55                   	push   %ebp
+  801290:	89 e5                	mov    %esp,%ebp
+  801292:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801295:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801298:	50                   	push   %eax
+  801299:	ff 75 08             	push   0x8(%ebp)
+  80129c:	e8 c4 fe ff ff       	call   801165 <fd_lookup>
+  8012a1:	83 c4 10             	add    $0x10,%esp
+  8012a4:	85 c0                	test   %eax,%eax
+  8012a6:	79 02                	jns    8012aa <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012a8:	c9                   	leave
+  8012a9:	c3                   	ret
+		return fd_close(fd, 1);
+  8012aa:	83 ec 08             	sub    $0x8,%esp
+  8012ad:	6a 01                	push   $0x1
+  8012af:	ff 75 f4             	push   -0xc(%ebp)
+  8012b2:	e8 51 ff ff ff       	call   801208 <fd_close>
+  8012b7:	83 c4 10             	add    $0x10,%esp
+  8012ba:	eb ec                	jmp    8012a8 <close+0x19>
+
+008012bc <close_all>:
+
+void
+close_all(void)
+{
+  8012bc:	55                   	push   %ebp
+  8012bd:	89 e5                	mov    %esp,%ebp
+  8012bf:	53                   	push   %ebx
+  8012c0:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8012c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8012c8:	83 ec 0c             	sub    $0xc,%esp
+  8012cb:	53                   	push   %ebx
+  8012cc:	e8 be ff ff ff       	call   80128f <close>
+	for (i = 0; i < MAXFD; i++)
+  8012d1:	83 c3 01             	add    $0x1,%ebx
+  8012d4:	83 c4 10             	add    $0x10,%esp
+  8012d7:	83 fb 20             	cmp    $0x20,%ebx
+  8012da:	75 ec                	jne    8012c8 <close_all+0xc>
+}
+  8012dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012df:	c9                   	leave
+  8012e0:	c3                   	ret
+
+008012e1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8012e1:	55                   	push   %ebp
+  8012e2:	89 e5                	mov    %esp,%ebp
+  8012e4:	57                   	push   %edi
+  8012e5:	56                   	push   %esi
+  8012e6:	53                   	push   %ebx
+  8012e7:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8012ea:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012ed:	50                   	push   %eax
+  8012ee:	ff 75 08             	push   0x8(%ebp)
+  8012f1:	e8 6f fe ff ff       	call   801165 <fd_lookup>
+  8012f6:	89 c3                	mov    %eax,%ebx
+  8012f8:	83 c4 10             	add    $0x10,%esp
+  8012fb:	85 c0                	test   %eax,%eax
+  8012fd:	78 7f                	js     80137e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8012ff:	83 ec 0c             	sub    $0xc,%esp
+  801302:	ff 75 0c             	push   0xc(%ebp)
+  801305:	e8 85 ff ff ff       	call   80128f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80130a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80130d:	c1 e6 0c             	shl    $0xc,%esi
+  801310:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801316:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801319:	89 3c 24             	mov    %edi,(%esp)
+  80131c:	e8 d7 fd ff ff       	call   8010f8 <fd2data>
+  801321:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801323:	89 34 24             	mov    %esi,(%esp)
+  801326:	e8 cd fd ff ff       	call   8010f8 <fd2data>
+  80132b:	83 c4 10             	add    $0x10,%esp
+  80132e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801331:	89 d8                	mov    %ebx,%eax
+  801333:	c1 e8 16             	shr    $0x16,%eax
+  801336:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80133d:	a8 01                	test   $0x1,%al
+  80133f:	74 11                	je     801352 <dup+0x71>
+  801341:	89 d8                	mov    %ebx,%eax
+  801343:	c1 e8 0c             	shr    $0xc,%eax
+  801346:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80134d:	f6 c2 01             	test   $0x1,%dl
+  801350:	75 36                	jne    801388 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801352:	89 f8                	mov    %edi,%eax
+  801354:	c1 e8 0c             	shr    $0xc,%eax
+  801357:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80135e:	83 ec 0c             	sub    $0xc,%esp
+  801361:	25 07 0e 00 00       	and    $0xe07,%eax
+  801366:	50                   	push   %eax
+  801367:	56                   	push   %esi
+  801368:	6a 00                	push   $0x0
+  80136a:	57                   	push   %edi
+  80136b:	6a 00                	push   $0x0
+  80136d:	e8 d7 f9 ff ff       	call   800d49 <sys_page_map>
+  801372:	89 c3                	mov    %eax,%ebx
+  801374:	83 c4 20             	add    $0x20,%esp
+  801377:	85 c0                	test   %eax,%eax
+  801379:	78 33                	js     8013ae <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80137b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80137e:	89 d8                	mov    %ebx,%eax
+  801380:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801383:	5b                   	pop    %ebx
+  801384:	5e                   	pop    %esi
+  801385:	5f                   	pop    %edi
+  801386:	5d                   	pop    %ebp
+  801387:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801388:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80138f:	83 ec 0c             	sub    $0xc,%esp
+  801392:	25 07 0e 00 00       	and    $0xe07,%eax
+  801397:	50                   	push   %eax
+  801398:	ff 75 d4             	push   -0x2c(%ebp)
+  80139b:	6a 00                	push   $0x0
+  80139d:	53                   	push   %ebx
+  80139e:	6a 00                	push   $0x0
+  8013a0:	e8 a4 f9 ff ff       	call   800d49 <sys_page_map>
+  8013a5:	89 c3                	mov    %eax,%ebx
+  8013a7:	83 c4 20             	add    $0x20,%esp
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	79 a4                	jns    801352 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013ae:	83 ec 08             	sub    $0x8,%esp
+  8013b1:	56                   	push   %esi
+  8013b2:	6a 00                	push   $0x0
+  8013b4:	e8 d2 f9 ff ff       	call   800d8b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8013b9:	83 c4 08             	add    $0x8,%esp
+  8013bc:	ff 75 d4             	push   -0x2c(%ebp)
+  8013bf:	6a 00                	push   $0x0
+  8013c1:	e8 c5 f9 ff ff       	call   800d8b <sys_page_unmap>
+	return r;
+  8013c6:	83 c4 10             	add    $0x10,%esp
+  8013c9:	eb b3                	jmp    80137e <dup+0x9d>
+
+008013cb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013cb:	55                   	push   %ebp
+  8013cc:	89 e5                	mov    %esp,%ebp
+  8013ce:	56                   	push   %esi
+  8013cf:	53                   	push   %ebx
+  8013d0:	83 ec 18             	sub    $0x18,%esp
+  8013d3:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013d6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013d9:	50                   	push   %eax
+  8013da:	56                   	push   %esi
+  8013db:	e8 85 fd ff ff       	call   801165 <fd_lookup>
+  8013e0:	83 c4 10             	add    $0x10,%esp
+  8013e3:	85 c0                	test   %eax,%eax
+  8013e5:	78 3c                	js     801423 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013e7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013ea:	83 ec 08             	sub    $0x8,%esp
+  8013ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013f0:	50                   	push   %eax
+  8013f1:	ff 33                	push   (%ebx)
+  8013f3:	e8 bd fd ff ff       	call   8011b5 <dev_lookup>
+  8013f8:	83 c4 10             	add    $0x10,%esp
+  8013fb:	85 c0                	test   %eax,%eax
+  8013fd:	78 24                	js     801423 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8013ff:	8b 43 08             	mov    0x8(%ebx),%eax
+  801402:	83 e0 03             	and    $0x3,%eax
+  801405:	83 f8 01             	cmp    $0x1,%eax
+  801408:	74 20                	je     80142a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80140a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80140d:	8b 40 08             	mov    0x8(%eax),%eax
+  801410:	85 c0                	test   %eax,%eax
+  801412:	74 37                	je     80144b <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801414:	83 ec 04             	sub    $0x4,%esp
+  801417:	ff 75 10             	push   0x10(%ebp)
+  80141a:	ff 75 0c             	push   0xc(%ebp)
+  80141d:	53                   	push   %ebx
+  80141e:	ff d0                	call   *%eax
+  801420:	83 c4 10             	add    $0x10,%esp
+}
+  801423:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801426:	5b                   	pop    %ebx
+  801427:	5e                   	pop    %esi
+  801428:	5d                   	pop    %ebp
+  801429:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80142a:	a1 20 60 80 00       	mov    0x806020,%eax
+  80142f:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801432:	83 ec 04             	sub    $0x4,%esp
+  801435:	56                   	push   %esi
+  801436:	50                   	push   %eax
+  801437:	68 6d 2c 80 00       	push   $0x802c6d
+  80143c:	e8 27 ee ff ff       	call   800268 <cprintf>
+		return -E_INVAL;
+  801441:	83 c4 10             	add    $0x10,%esp
+  801444:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801449:	eb d8                	jmp    801423 <read+0x58>
+		return -E_NOT_SUPP;
+  80144b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801450:	eb d1                	jmp    801423 <read+0x58>
+
+00801452 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801452:	55                   	push   %ebp
+  801453:	89 e5                	mov    %esp,%ebp
+  801455:	57                   	push   %edi
+  801456:	56                   	push   %esi
+  801457:	53                   	push   %ebx
+  801458:	83 ec 0c             	sub    $0xc,%esp
+  80145b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80145e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801461:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801466:	eb 02                	jmp    80146a <readn+0x18>
+  801468:	01 c3                	add    %eax,%ebx
+  80146a:	39 f3                	cmp    %esi,%ebx
+  80146c:	73 21                	jae    80148f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80146e:	83 ec 04             	sub    $0x4,%esp
+  801471:	89 f0                	mov    %esi,%eax
+  801473:	29 d8                	sub    %ebx,%eax
+  801475:	50                   	push   %eax
+  801476:	89 d8                	mov    %ebx,%eax
+  801478:	03 45 0c             	add    0xc(%ebp),%eax
+  80147b:	50                   	push   %eax
+  80147c:	57                   	push   %edi
+  80147d:	e8 49 ff ff ff       	call   8013cb <read>
+		if (m < 0)
+  801482:	83 c4 10             	add    $0x10,%esp
+  801485:	85 c0                	test   %eax,%eax
+  801487:	78 04                	js     80148d <readn+0x3b>
+			return m;
+		if (m == 0)
+  801489:	75 dd                	jne    801468 <readn+0x16>
+  80148b:	eb 02                	jmp    80148f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80148d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80148f:	89 d8                	mov    %ebx,%eax
+  801491:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801494:	5b                   	pop    %ebx
+  801495:	5e                   	pop    %esi
+  801496:	5f                   	pop    %edi
+  801497:	5d                   	pop    %ebp
+  801498:	c3                   	ret
+
+00801499 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801499:	55                   	push   %ebp
+  80149a:	89 e5                	mov    %esp,%ebp
+  80149c:	56                   	push   %esi
+  80149d:	53                   	push   %ebx
+  80149e:	83 ec 18             	sub    $0x18,%esp
+  8014a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014a4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014a7:	50                   	push   %eax
+  8014a8:	53                   	push   %ebx
+  8014a9:	e8 b7 fc ff ff       	call   801165 <fd_lookup>
+  8014ae:	83 c4 10             	add    $0x10,%esp
+  8014b1:	85 c0                	test   %eax,%eax
+  8014b3:	78 37                	js     8014ec <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014b5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014b8:	83 ec 08             	sub    $0x8,%esp
+  8014bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014be:	50                   	push   %eax
+  8014bf:	ff 36                	push   (%esi)
+  8014c1:	e8 ef fc ff ff       	call   8011b5 <dev_lookup>
+  8014c6:	83 c4 10             	add    $0x10,%esp
+  8014c9:	85 c0                	test   %eax,%eax
+  8014cb:	78 1f                	js     8014ec <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014cd:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014d1:	74 20                	je     8014f3 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8014d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014d6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014d9:	85 c0                	test   %eax,%eax
+  8014db:	74 37                	je     801514 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8014dd:	83 ec 04             	sub    $0x4,%esp
+  8014e0:	ff 75 10             	push   0x10(%ebp)
+  8014e3:	ff 75 0c             	push   0xc(%ebp)
+  8014e6:	56                   	push   %esi
+  8014e7:	ff d0                	call   *%eax
+  8014e9:	83 c4 10             	add    $0x10,%esp
+}
+  8014ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014ef:	5b                   	pop    %ebx
+  8014f0:	5e                   	pop    %esi
+  8014f1:	5d                   	pop    %ebp
+  8014f2:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014f3:	a1 20 60 80 00       	mov    0x806020,%eax
+  8014f8:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8014fb:	83 ec 04             	sub    $0x4,%esp
+  8014fe:	53                   	push   %ebx
+  8014ff:	50                   	push   %eax
+  801500:	68 89 2c 80 00       	push   $0x802c89
+  801505:	e8 5e ed ff ff       	call   800268 <cprintf>
+		return -E_INVAL;
+  80150a:	83 c4 10             	add    $0x10,%esp
+  80150d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801512:	eb d8                	jmp    8014ec <write+0x53>
+		return -E_NOT_SUPP;
+  801514:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801519:	eb d1                	jmp    8014ec <write+0x53>
+
+0080151b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80151b:	55                   	push   %ebp
+  80151c:	89 e5                	mov    %esp,%ebp
+  80151e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801521:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801524:	50                   	push   %eax
+  801525:	ff 75 08             	push   0x8(%ebp)
+  801528:	e8 38 fc ff ff       	call   801165 <fd_lookup>
+  80152d:	83 c4 10             	add    $0x10,%esp
+  801530:	85 c0                	test   %eax,%eax
+  801532:	78 0e                	js     801542 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801534:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801537:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80153a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80153d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801542:	c9                   	leave
+  801543:	c3                   	ret
+
+00801544 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801544:	55                   	push   %ebp
+  801545:	89 e5                	mov    %esp,%ebp
+  801547:	56                   	push   %esi
+  801548:	53                   	push   %ebx
+  801549:	83 ec 18             	sub    $0x18,%esp
+  80154c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80154f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801552:	50                   	push   %eax
+  801553:	53                   	push   %ebx
+  801554:	e8 0c fc ff ff       	call   801165 <fd_lookup>
+  801559:	83 c4 10             	add    $0x10,%esp
+  80155c:	85 c0                	test   %eax,%eax
+  80155e:	78 34                	js     801594 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801560:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801563:	83 ec 08             	sub    $0x8,%esp
+  801566:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801569:	50                   	push   %eax
+  80156a:	ff 36                	push   (%esi)
+  80156c:	e8 44 fc ff ff       	call   8011b5 <dev_lookup>
+  801571:	83 c4 10             	add    $0x10,%esp
+  801574:	85 c0                	test   %eax,%eax
+  801576:	78 1c                	js     801594 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801578:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80157c:	74 1d                	je     80159b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80157e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801581:	8b 40 18             	mov    0x18(%eax),%eax
+  801584:	85 c0                	test   %eax,%eax
+  801586:	74 34                	je     8015bc <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801588:	83 ec 08             	sub    $0x8,%esp
+  80158b:	ff 75 0c             	push   0xc(%ebp)
+  80158e:	56                   	push   %esi
+  80158f:	ff d0                	call   *%eax
+  801591:	83 c4 10             	add    $0x10,%esp
+}
+  801594:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801597:	5b                   	pop    %ebx
+  801598:	5e                   	pop    %esi
+  801599:	5d                   	pop    %ebp
+  80159a:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80159b:	a1 20 60 80 00       	mov    0x806020,%eax
+  8015a0:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015a3:	83 ec 04             	sub    $0x4,%esp
+  8015a6:	53                   	push   %ebx
+  8015a7:	50                   	push   %eax
+  8015a8:	68 4c 2c 80 00       	push   $0x802c4c
+  8015ad:	e8 b6 ec ff ff       	call   800268 <cprintf>
+		return -E_INVAL;
+  8015b2:	83 c4 10             	add    $0x10,%esp
+  8015b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ba:	eb d8                	jmp    801594 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015bc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015c1:	eb d1                	jmp    801594 <ftruncate+0x50>
+
+008015c3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015c3:	55                   	push   %ebp
+  8015c4:	89 e5                	mov    %esp,%ebp
+  8015c6:	56                   	push   %esi
+  8015c7:	53                   	push   %ebx
+  8015c8:	83 ec 18             	sub    $0x18,%esp
+  8015cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ce:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015d1:	50                   	push   %eax
+  8015d2:	ff 75 08             	push   0x8(%ebp)
+  8015d5:	e8 8b fb ff ff       	call   801165 <fd_lookup>
+  8015da:	83 c4 10             	add    $0x10,%esp
+  8015dd:	85 c0                	test   %eax,%eax
+  8015df:	78 49                	js     80162a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015e1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015e4:	83 ec 08             	sub    $0x8,%esp
+  8015e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015ea:	50                   	push   %eax
+  8015eb:	ff 36                	push   (%esi)
+  8015ed:	e8 c3 fb ff ff       	call   8011b5 <dev_lookup>
+  8015f2:	83 c4 10             	add    $0x10,%esp
+  8015f5:	85 c0                	test   %eax,%eax
+  8015f7:	78 31                	js     80162a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8015f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015fc:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801600:	74 2f                	je     801631 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801602:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801605:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80160c:	00 00 00 
+	stat->st_isdir = 0;
+  80160f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801616:	00 00 00 
+	stat->st_dev = dev;
+  801619:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80161f:	83 ec 08             	sub    $0x8,%esp
+  801622:	53                   	push   %ebx
+  801623:	56                   	push   %esi
+  801624:	ff 50 14             	call   *0x14(%eax)
+  801627:	83 c4 10             	add    $0x10,%esp
+}
+  80162a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80162d:	5b                   	pop    %ebx
+  80162e:	5e                   	pop    %esi
+  80162f:	5d                   	pop    %ebp
+  801630:	c3                   	ret
+		return -E_NOT_SUPP;
+  801631:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801636:	eb f2                	jmp    80162a <fstat+0x67>
+
+00801638 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801638:	55                   	push   %ebp
+  801639:	89 e5                	mov    %esp,%ebp
+  80163b:	56                   	push   %esi
+  80163c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80163d:	83 ec 08             	sub    $0x8,%esp
+  801640:	6a 00                	push   $0x0
+  801642:	ff 75 08             	push   0x8(%ebp)
+  801645:	e8 e4 01 00 00       	call   80182e <open>
+  80164a:	89 c3                	mov    %eax,%ebx
+  80164c:	83 c4 10             	add    $0x10,%esp
+  80164f:	85 c0                	test   %eax,%eax
+  801651:	78 1b                	js     80166e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801653:	83 ec 08             	sub    $0x8,%esp
+  801656:	ff 75 0c             	push   0xc(%ebp)
+  801659:	50                   	push   %eax
+  80165a:	e8 64 ff ff ff       	call   8015c3 <fstat>
+  80165f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801661:	89 1c 24             	mov    %ebx,(%esp)
+  801664:	e8 26 fc ff ff       	call   80128f <close>
+	return r;
+  801669:	83 c4 10             	add    $0x10,%esp
+  80166c:	89 f3                	mov    %esi,%ebx
+}
+  80166e:	89 d8                	mov    %ebx,%eax
+  801670:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801673:	5b                   	pop    %ebx
+  801674:	5e                   	pop    %esi
+  801675:	5d                   	pop    %ebp
+  801676:	c3                   	ret
+
+00801677 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801677:	55                   	push   %ebp
+  801678:	89 e5                	mov    %esp,%ebp
+  80167a:	56                   	push   %esi
+  80167b:	53                   	push   %ebx
+  80167c:	89 c6                	mov    %eax,%esi
+  80167e:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801680:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801687:	74 27                	je     8016b0 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801689:	6a 07                	push   $0x7
+  80168b:	68 00 70 80 00       	push   $0x807000
+  801690:	56                   	push   %esi
+  801691:	ff 35 00 40 80 00    	push   0x804000
+  801697:	e8 e9 0c 00 00       	call   802385 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80169c:	83 c4 0c             	add    $0xc,%esp
+  80169f:	6a 00                	push   $0x0
+  8016a1:	53                   	push   %ebx
+  8016a2:	6a 00                	push   $0x0
+  8016a4:	e8 64 0c 00 00       	call   80230d <ipc_recv>
+}
+  8016a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ac:	5b                   	pop    %ebx
+  8016ad:	5e                   	pop    %esi
+  8016ae:	5d                   	pop    %ebp
+  8016af:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016b0:	83 ec 0c             	sub    $0xc,%esp
+  8016b3:	6a 01                	push   $0x1
+  8016b5:	e8 1f 0d 00 00       	call   8023d9 <ipc_find_env>
+  8016ba:	a3 00 40 80 00       	mov    %eax,0x804000
+  8016bf:	83 c4 10             	add    $0x10,%esp
+  8016c2:	eb c5                	jmp    801689 <fsipc+0x12>
+
+008016c4 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8016c4:	55                   	push   %ebp
+  8016c5:	89 e5                	mov    %esp,%ebp
+  8016c7:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8016ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016cd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016d0:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8016d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016d8:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8016dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016e2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8016e7:	e8 8b ff ff ff       	call   801677 <fsipc>
+}
+  8016ec:	c9                   	leave
+  8016ed:	c3                   	ret
+
+008016ee <devfile_flush>:
+{
+  8016ee:	55                   	push   %ebp
+  8016ef:	89 e5                	mov    %esp,%ebp
+  8016f1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8016f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016f7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016fa:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8016ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801704:	b8 06 00 00 00       	mov    $0x6,%eax
+  801709:	e8 69 ff ff ff       	call   801677 <fsipc>
+}
+  80170e:	c9                   	leave
+  80170f:	c3                   	ret
+
+00801710 <devfile_stat>:
+{
+  801710:	55                   	push   %ebp
+  801711:	89 e5                	mov    %esp,%ebp
+  801713:	53                   	push   %ebx
+  801714:	83 ec 04             	sub    $0x4,%esp
+  801717:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80171a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80171d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801720:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801725:	ba 00 00 00 00       	mov    $0x0,%edx
+  80172a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80172f:	e8 43 ff ff ff       	call   801677 <fsipc>
+  801734:	85 c0                	test   %eax,%eax
+  801736:	78 2c                	js     801764 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801738:	83 ec 08             	sub    $0x8,%esp
+  80173b:	68 00 70 80 00       	push   $0x807000
+  801740:	53                   	push   %ebx
+  801741:	e8 10 f1 ff ff       	call   800856 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801746:	a1 80 70 80 00       	mov    0x807080,%eax
+  80174b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801751:	a1 84 70 80 00       	mov    0x807084,%eax
+  801756:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80175c:	83 c4 10             	add    $0x10,%esp
+  80175f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801764:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801767:	c9                   	leave
+  801768:	c3                   	ret
+
+00801769 <devfile_write>:
+{
+  801769:	55                   	push   %ebp
+  80176a:	89 e5                	mov    %esp,%ebp
+  80176c:	83 ec 0c             	sub    $0xc,%esp
+  80176f:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801772:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801777:	39 d0                	cmp    %edx,%eax
+  801779:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80177c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177f:	8b 52 0c             	mov    0xc(%edx),%edx
+  801782:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = n;
+  801788:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80178d:	50                   	push   %eax
+  80178e:	ff 75 0c             	push   0xc(%ebp)
+  801791:	68 08 70 80 00       	push   $0x807008
+  801796:	e8 41 f2 ff ff       	call   8009dc <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80179b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017a5:	e8 cd fe ff ff       	call   801677 <fsipc>
+}
+  8017aa:	c9                   	leave
+  8017ab:	c3                   	ret
+
+008017ac <devfile_read>:
+{
+  8017ac:	55                   	push   %ebp
+  8017ad:	89 e5                	mov    %esp,%ebp
+  8017af:	56                   	push   %esi
+  8017b0:	53                   	push   %ebx
+  8017b1:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8017b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017ba:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8017bf:	89 35 04 70 80 00    	mov    %esi,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8017c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ca:	b8 03 00 00 00       	mov    $0x3,%eax
+  8017cf:	e8 a3 fe ff ff       	call   801677 <fsipc>
+  8017d4:	89 c3                	mov    %eax,%ebx
+  8017d6:	85 c0                	test   %eax,%eax
+  8017d8:	78 1f                	js     8017f9 <devfile_read+0x4d>
+	assert(r <= n);
+  8017da:	39 c6                	cmp    %eax,%esi
+  8017dc:	72 24                	jb     801802 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8017de:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8017e3:	7f 33                	jg     801818 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8017e5:	83 ec 04             	sub    $0x4,%esp
+  8017e8:	50                   	push   %eax
+  8017e9:	68 00 70 80 00       	push   $0x807000
+  8017ee:	ff 75 0c             	push   0xc(%ebp)
+  8017f1:	e8 e6 f1 ff ff       	call   8009dc <memmove>
+	return r;
+  8017f6:	83 c4 10             	add    $0x10,%esp
+}
+  8017f9:	89 d8                	mov    %ebx,%eax
+  8017fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017fe:	5b                   	pop    %ebx
+  8017ff:	5e                   	pop    %esi
+  801800:	5d                   	pop    %ebp
+  801801:	c3                   	ret
+	assert(r <= n);
+  801802:	68 bc 2c 80 00       	push   $0x802cbc
+  801807:	68 c3 2c 80 00       	push   $0x802cc3
+  80180c:	6a 7c                	push   $0x7c
+  80180e:	68 d8 2c 80 00       	push   $0x802cd8
+  801813:	e8 75 e9 ff ff       	call   80018d <_panic>
+	assert(r <= PGSIZE);
+  801818:	68 e3 2c 80 00       	push   $0x802ce3
+  80181d:	68 c3 2c 80 00       	push   $0x802cc3
+  801822:	6a 7d                	push   $0x7d
+  801824:	68 d8 2c 80 00       	push   $0x802cd8
+  801829:	e8 5f e9 ff ff       	call   80018d <_panic>
+
+0080182e <open>:
+{
+  80182e:	55                   	push   %ebp
+  80182f:	89 e5                	mov    %esp,%ebp
+  801831:	56                   	push   %esi
+  801832:	53                   	push   %ebx
+  801833:	83 ec 1c             	sub    $0x1c,%esp
+  801836:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801839:	56                   	push   %esi
+  80183a:	e8 dc ef ff ff       	call   80081b <strlen>
+  80183f:	83 c4 10             	add    $0x10,%esp
+  801842:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801847:	7f 6c                	jg     8018b5 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801849:	83 ec 0c             	sub    $0xc,%esp
+  80184c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80184f:	50                   	push   %eax
+  801850:	e8 ba f8 ff ff       	call   80110f <fd_alloc>
+  801855:	89 c3                	mov    %eax,%ebx
+  801857:	83 c4 10             	add    $0x10,%esp
+  80185a:	85 c0                	test   %eax,%eax
+  80185c:	78 3c                	js     80189a <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80185e:	83 ec 08             	sub    $0x8,%esp
+  801861:	56                   	push   %esi
+  801862:	68 00 70 80 00       	push   $0x807000
+  801867:	e8 ea ef ff ff       	call   800856 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80186c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80186f:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801874:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801877:	b8 01 00 00 00       	mov    $0x1,%eax
+  80187c:	e8 f6 fd ff ff       	call   801677 <fsipc>
+  801881:	89 c3                	mov    %eax,%ebx
+  801883:	83 c4 10             	add    $0x10,%esp
+  801886:	85 c0                	test   %eax,%eax
+  801888:	78 19                	js     8018a3 <open+0x75>
+	return fd2num(fd);
+  80188a:	83 ec 0c             	sub    $0xc,%esp
+  80188d:	ff 75 f4             	push   -0xc(%ebp)
+  801890:	e8 53 f8 ff ff       	call   8010e8 <fd2num>
+  801895:	89 c3                	mov    %eax,%ebx
+  801897:	83 c4 10             	add    $0x10,%esp
+}
+  80189a:	89 d8                	mov    %ebx,%eax
+  80189c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80189f:	5b                   	pop    %ebx
+  8018a0:	5e                   	pop    %esi
+  8018a1:	5d                   	pop    %ebp
+  8018a2:	c3                   	ret
+		fd_close(fd, 0);
+  8018a3:	83 ec 08             	sub    $0x8,%esp
+  8018a6:	6a 00                	push   $0x0
+  8018a8:	ff 75 f4             	push   -0xc(%ebp)
+  8018ab:	e8 58 f9 ff ff       	call   801208 <fd_close>
+		return r;
+  8018b0:	83 c4 10             	add    $0x10,%esp
+  8018b3:	eb e5                	jmp    80189a <open+0x6c>
+		return -E_BAD_PATH;
+  8018b5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8018ba:	eb de                	jmp    80189a <open+0x6c>
+
+008018bc <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8018bc:	55                   	push   %ebp
+  8018bd:	89 e5                	mov    %esp,%ebp
+  8018bf:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8018c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018c7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018cc:	e8 a6 fd ff ff       	call   801677 <fsipc>
+}
+  8018d1:	c9                   	leave
+  8018d2:	c3                   	ret
+
+008018d3 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8018d3:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8018d7:	7f 01                	jg     8018da <writebuf+0x7>
+  8018d9:	c3                   	ret
+{
+  8018da:	55                   	push   %ebp
+  8018db:	89 e5                	mov    %esp,%ebp
+  8018dd:	53                   	push   %ebx
+  8018de:	83 ec 08             	sub    $0x8,%esp
+  8018e1:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8018e3:	ff 70 04             	push   0x4(%eax)
+  8018e6:	8d 40 10             	lea    0x10(%eax),%eax
+  8018e9:	50                   	push   %eax
+  8018ea:	ff 33                	push   (%ebx)
+  8018ec:	e8 a8 fb ff ff       	call   801499 <write>
+		if (result > 0)
+  8018f1:	83 c4 10             	add    $0x10,%esp
+  8018f4:	85 c0                	test   %eax,%eax
+  8018f6:	7e 03                	jle    8018fb <writebuf+0x28>
+			b->result += result;
+  8018f8:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  8018fb:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8018fe:	74 0d                	je     80190d <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801900:	85 c0                	test   %eax,%eax
+  801902:	ba 00 00 00 00       	mov    $0x0,%edx
+  801907:	0f 4f c2             	cmovg  %edx,%eax
+  80190a:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  80190d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801910:	c9                   	leave
+  801911:	c3                   	ret
+
+00801912 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	53                   	push   %ebx
+  801916:	83 ec 04             	sub    $0x4,%esp
+  801919:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  80191c:	8b 53 04             	mov    0x4(%ebx),%edx
+  80191f:	8d 42 01             	lea    0x1(%edx),%eax
+  801922:	89 43 04             	mov    %eax,0x4(%ebx)
+  801925:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801928:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  80192c:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801931:	74 05                	je     801938 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801933:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801936:	c9                   	leave
+  801937:	c3                   	ret
+		writebuf(b);
+  801938:	89 d8                	mov    %ebx,%eax
+  80193a:	e8 94 ff ff ff       	call   8018d3 <writebuf>
+		b->idx = 0;
+  80193f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801946:	eb eb                	jmp    801933 <putch+0x21>
+
+00801948 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801948:	55                   	push   %ebp
+  801949:	89 e5                	mov    %esp,%ebp
+  80194b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801951:	8b 45 08             	mov    0x8(%ebp),%eax
+  801954:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  80195a:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801961:	00 00 00 
+	b.result = 0;
+  801964:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80196b:	00 00 00 
+	b.error = 1;
+  80196e:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801975:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801978:	ff 75 10             	push   0x10(%ebp)
+  80197b:	ff 75 0c             	push   0xc(%ebp)
+  80197e:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801984:	50                   	push   %eax
+  801985:	68 12 19 80 00       	push   $0x801912
+  80198a:	e8 d0 e9 ff ff       	call   80035f <vprintfmt>
+	if (b.idx > 0)
+  80198f:	83 c4 10             	add    $0x10,%esp
+  801992:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801999:	7f 12                	jg     8019ad <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  80199b:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8019a1:	85 c0                	test   %eax,%eax
+  8019a3:	75 06                	jne    8019ab <vfprintf+0x63>
+  8019a5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8019ab:	c9                   	leave
+  8019ac:	c3                   	ret
+		writebuf(&b);
+  8019ad:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8019b3:	e8 1b ff ff ff       	call   8018d3 <writebuf>
+  8019b8:	eb e1                	jmp    80199b <vfprintf+0x53>
+
+008019ba <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8019ba:	55                   	push   %ebp
+  8019bb:	89 e5                	mov    %esp,%ebp
+  8019bd:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8019c0:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8019c3:	50                   	push   %eax
+  8019c4:	ff 75 0c             	push   0xc(%ebp)
+  8019c7:	ff 75 08             	push   0x8(%ebp)
+  8019ca:	e8 79 ff ff ff       	call   801948 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8019cf:	c9                   	leave
+  8019d0:	c3                   	ret
+
+008019d1 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8019d1:	55                   	push   %ebp
+  8019d2:	89 e5                	mov    %esp,%ebp
+  8019d4:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8019d7:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8019da:	50                   	push   %eax
+  8019db:	ff 75 08             	push   0x8(%ebp)
+  8019de:	6a 01                	push   $0x1
+  8019e0:	e8 63 ff ff ff       	call   801948 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8019e5:	c9                   	leave
+  8019e6:	c3                   	ret
+
+008019e7 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8019e7:	55                   	push   %ebp
+  8019e8:	89 e5                	mov    %esp,%ebp
+  8019ea:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8019ed:	68 ef 2c 80 00       	push   $0x802cef
+  8019f2:	ff 75 0c             	push   0xc(%ebp)
+  8019f5:	e8 5c ee ff ff       	call   800856 <strcpy>
+	return 0;
+}
+  8019fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ff:	c9                   	leave
+  801a00:	c3                   	ret
+
+00801a01 <devsock_close>:
+{
+  801a01:	55                   	push   %ebp
+  801a02:	89 e5                	mov    %esp,%ebp
+  801a04:	53                   	push   %ebx
+  801a05:	83 ec 10             	sub    $0x10,%esp
+  801a08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801a0b:	53                   	push   %ebx
+  801a0c:	e8 d8 09 00 00       	call   8023e9 <pageref>
+  801a11:	89 c2                	mov    %eax,%edx
+  801a13:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801a16:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801a1b:	83 fa 01             	cmp    $0x1,%edx
+  801a1e:	74 05                	je     801a25 <devsock_close+0x24>
+}
+  801a20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a23:	c9                   	leave
+  801a24:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801a25:	83 ec 0c             	sub    $0xc,%esp
+  801a28:	ff 73 0c             	push   0xc(%ebx)
+  801a2b:	e8 b7 02 00 00       	call   801ce7 <nsipc_close>
+  801a30:	83 c4 10             	add    $0x10,%esp
+  801a33:	eb eb                	jmp    801a20 <devsock_close+0x1f>
+
+00801a35 <devsock_write>:
+{
+  801a35:	55                   	push   %ebp
+  801a36:	89 e5                	mov    %esp,%ebp
+  801a38:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801a3b:	6a 00                	push   $0x0
+  801a3d:	ff 75 10             	push   0x10(%ebp)
+  801a40:	ff 75 0c             	push   0xc(%ebp)
+  801a43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a46:	ff 70 0c             	push   0xc(%eax)
+  801a49:	e8 79 03 00 00       	call   801dc7 <nsipc_send>
+}
+  801a4e:	c9                   	leave
+  801a4f:	c3                   	ret
+
+00801a50 <devsock_read>:
+{
+  801a50:	55                   	push   %ebp
+  801a51:	89 e5                	mov    %esp,%ebp
+  801a53:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801a56:	6a 00                	push   $0x0
+  801a58:	ff 75 10             	push   0x10(%ebp)
+  801a5b:	ff 75 0c             	push   0xc(%ebp)
+  801a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a61:	ff 70 0c             	push   0xc(%eax)
+  801a64:	e8 ef 02 00 00       	call   801d58 <nsipc_recv>
+}
+  801a69:	c9                   	leave
+  801a6a:	c3                   	ret
+
+00801a6b <fd2sockid>:
+{
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801a71:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801a74:	52                   	push   %edx
+  801a75:	50                   	push   %eax
+  801a76:	e8 ea f6 ff ff       	call   801165 <fd_lookup>
+  801a7b:	83 c4 10             	add    $0x10,%esp
+  801a7e:	85 c0                	test   %eax,%eax
+  801a80:	78 10                	js     801a92 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801a82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a85:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801a8b:	39 08                	cmp    %ecx,(%eax)
+  801a8d:	75 05                	jne    801a94 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801a8f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801a92:	c9                   	leave
+  801a93:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a94:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a99:	eb f7                	jmp    801a92 <fd2sockid+0x27>
+
+00801a9b <alloc_sockfd>:
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	56                   	push   %esi
+  801a9f:	53                   	push   %ebx
+  801aa0:	83 ec 1c             	sub    $0x1c,%esp
+  801aa3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801aa5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa8:	50                   	push   %eax
+  801aa9:	e8 61 f6 ff ff       	call   80110f <fd_alloc>
+  801aae:	89 c3                	mov    %eax,%ebx
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	78 43                	js     801afa <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ab7:	83 ec 04             	sub    $0x4,%esp
+  801aba:	68 07 04 00 00       	push   $0x407
+  801abf:	ff 75 f4             	push   -0xc(%ebp)
+  801ac2:	6a 00                	push   $0x0
+  801ac4:	e8 fa f1 ff ff       	call   800cc3 <sys_page_alloc>
+  801ac9:	89 c3                	mov    %eax,%ebx
+  801acb:	83 c4 10             	add    $0x10,%esp
+  801ace:	85 c0                	test   %eax,%eax
+  801ad0:	78 28                	js     801afa <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801ad2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ad5:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801adb:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801add:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801ae7:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801aea:	83 ec 0c             	sub    $0xc,%esp
+  801aed:	50                   	push   %eax
+  801aee:	e8 f5 f5 ff ff       	call   8010e8 <fd2num>
+  801af3:	89 c3                	mov    %eax,%ebx
+  801af5:	83 c4 10             	add    $0x10,%esp
+  801af8:	eb 0c                	jmp    801b06 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801afa:	83 ec 0c             	sub    $0xc,%esp
+  801afd:	56                   	push   %esi
+  801afe:	e8 e4 01 00 00       	call   801ce7 <nsipc_close>
+		return r;
+  801b03:	83 c4 10             	add    $0x10,%esp
+}
+  801b06:	89 d8                	mov    %ebx,%eax
+  801b08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b0b:	5b                   	pop    %ebx
+  801b0c:	5e                   	pop    %esi
+  801b0d:	5d                   	pop    %ebp
+  801b0e:	c3                   	ret
+
+00801b0f <accept>:
+{
+  801b0f:	55                   	push   %ebp
+  801b10:	89 e5                	mov    %esp,%ebp
+  801b12:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b18:	e8 4e ff ff ff       	call   801a6b <fd2sockid>
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	78 1b                	js     801b3c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801b21:	83 ec 04             	sub    $0x4,%esp
+  801b24:	ff 75 10             	push   0x10(%ebp)
+  801b27:	ff 75 0c             	push   0xc(%ebp)
+  801b2a:	50                   	push   %eax
+  801b2b:	e8 0e 01 00 00       	call   801c3e <nsipc_accept>
+  801b30:	83 c4 10             	add    $0x10,%esp
+  801b33:	85 c0                	test   %eax,%eax
+  801b35:	78 05                	js     801b3c <accept+0x2d>
+	return alloc_sockfd(r);
+  801b37:	e8 5f ff ff ff       	call   801a9b <alloc_sockfd>
+}
+  801b3c:	c9                   	leave
+  801b3d:	c3                   	ret
+
+00801b3e <bind>:
+{
+  801b3e:	55                   	push   %ebp
+  801b3f:	89 e5                	mov    %esp,%ebp
+  801b41:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b47:	e8 1f ff ff ff       	call   801a6b <fd2sockid>
+  801b4c:	85 c0                	test   %eax,%eax
+  801b4e:	78 12                	js     801b62 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801b50:	83 ec 04             	sub    $0x4,%esp
+  801b53:	ff 75 10             	push   0x10(%ebp)
+  801b56:	ff 75 0c             	push   0xc(%ebp)
+  801b59:	50                   	push   %eax
+  801b5a:	e8 31 01 00 00       	call   801c90 <nsipc_bind>
+  801b5f:	83 c4 10             	add    $0x10,%esp
+}
+  801b62:	c9                   	leave
+  801b63:	c3                   	ret
+
+00801b64 <shutdown>:
+{
+  801b64:	55                   	push   %ebp
+  801b65:	89 e5                	mov    %esp,%ebp
+  801b67:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b6d:	e8 f9 fe ff ff       	call   801a6b <fd2sockid>
+  801b72:	85 c0                	test   %eax,%eax
+  801b74:	78 0f                	js     801b85 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801b76:	83 ec 08             	sub    $0x8,%esp
+  801b79:	ff 75 0c             	push   0xc(%ebp)
+  801b7c:	50                   	push   %eax
+  801b7d:	e8 43 01 00 00       	call   801cc5 <nsipc_shutdown>
+  801b82:	83 c4 10             	add    $0x10,%esp
+}
+  801b85:	c9                   	leave
+  801b86:	c3                   	ret
+
+00801b87 <connect>:
+{
+  801b87:	55                   	push   %ebp
+  801b88:	89 e5                	mov    %esp,%ebp
+  801b8a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b90:	e8 d6 fe ff ff       	call   801a6b <fd2sockid>
+  801b95:	85 c0                	test   %eax,%eax
+  801b97:	78 12                	js     801bab <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801b99:	83 ec 04             	sub    $0x4,%esp
+  801b9c:	ff 75 10             	push   0x10(%ebp)
+  801b9f:	ff 75 0c             	push   0xc(%ebp)
+  801ba2:	50                   	push   %eax
+  801ba3:	e8 59 01 00 00       	call   801d01 <nsipc_connect>
+  801ba8:	83 c4 10             	add    $0x10,%esp
+}
+  801bab:	c9                   	leave
+  801bac:	c3                   	ret
+
+00801bad <listen>:
+{
+  801bad:	55                   	push   %ebp
+  801bae:	89 e5                	mov    %esp,%ebp
+  801bb0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb6:	e8 b0 fe ff ff       	call   801a6b <fd2sockid>
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	78 0f                	js     801bce <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801bbf:	83 ec 08             	sub    $0x8,%esp
+  801bc2:	ff 75 0c             	push   0xc(%ebp)
+  801bc5:	50                   	push   %eax
+  801bc6:	e8 6b 01 00 00       	call   801d36 <nsipc_listen>
+  801bcb:	83 c4 10             	add    $0x10,%esp
+}
+  801bce:	c9                   	leave
+  801bcf:	c3                   	ret
+
+00801bd0 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801bd0:	55                   	push   %ebp
+  801bd1:	89 e5                	mov    %esp,%ebp
+  801bd3:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801bd6:	ff 75 10             	push   0x10(%ebp)
+  801bd9:	ff 75 0c             	push   0xc(%ebp)
+  801bdc:	ff 75 08             	push   0x8(%ebp)
+  801bdf:	e8 41 02 00 00       	call   801e25 <nsipc_socket>
+  801be4:	83 c4 10             	add    $0x10,%esp
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	78 05                	js     801bf0 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801beb:	e8 ab fe ff ff       	call   801a9b <alloc_sockfd>
+}
+  801bf0:	c9                   	leave
+  801bf1:	c3                   	ret
+
+00801bf2 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801bf2:	55                   	push   %ebp
+  801bf3:	89 e5                	mov    %esp,%ebp
+  801bf5:	53                   	push   %ebx
+  801bf6:	83 ec 04             	sub    $0x4,%esp
+  801bf9:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801bfb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c02:	74 26                	je     801c2a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801c04:	6a 07                	push   $0x7
+  801c06:	68 00 80 80 00       	push   $0x808000
+  801c0b:	53                   	push   %ebx
+  801c0c:	ff 35 04 40 80 00    	push   0x804004
+  801c12:	e8 6e 07 00 00       	call   802385 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801c17:	83 c4 0c             	add    $0xc,%esp
+  801c1a:	6a 00                	push   $0x0
+  801c1c:	6a 00                	push   $0x0
+  801c1e:	6a 00                	push   $0x0
+  801c20:	e8 e8 06 00 00       	call   80230d <ipc_recv>
+}
+  801c25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c28:	c9                   	leave
+  801c29:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801c2a:	83 ec 0c             	sub    $0xc,%esp
+  801c2d:	6a 02                	push   $0x2
+  801c2f:	e8 a5 07 00 00       	call   8023d9 <ipc_find_env>
+  801c34:	a3 04 40 80 00       	mov    %eax,0x804004
+  801c39:	83 c4 10             	add    $0x10,%esp
+  801c3c:	eb c6                	jmp    801c04 <nsipc+0x12>
+
+00801c3e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801c3e:	55                   	push   %ebp
+  801c3f:	89 e5                	mov    %esp,%ebp
+  801c41:	56                   	push   %esi
+  801c42:	53                   	push   %ebx
+  801c43:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801c46:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c49:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801c4e:	8b 06                	mov    (%esi),%eax
+  801c50:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801c55:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c5a:	e8 93 ff ff ff       	call   801bf2 <nsipc>
+  801c5f:	89 c3                	mov    %eax,%ebx
+  801c61:	85 c0                	test   %eax,%eax
+  801c63:	79 09                	jns    801c6e <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801c65:	89 d8                	mov    %ebx,%eax
+  801c67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c6a:	5b                   	pop    %ebx
+  801c6b:	5e                   	pop    %esi
+  801c6c:	5d                   	pop    %ebp
+  801c6d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801c6e:	83 ec 04             	sub    $0x4,%esp
+  801c71:	ff 35 10 80 80 00    	push   0x808010
+  801c77:	68 00 80 80 00       	push   $0x808000
+  801c7c:	ff 75 0c             	push   0xc(%ebp)
+  801c7f:	e8 58 ed ff ff       	call   8009dc <memmove>
+		*addrlen = ret->ret_addrlen;
+  801c84:	a1 10 80 80 00       	mov    0x808010,%eax
+  801c89:	89 06                	mov    %eax,(%esi)
+  801c8b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801c8e:	eb d5                	jmp    801c65 <nsipc_accept+0x27>
+
+00801c90 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801c90:	55                   	push   %ebp
+  801c91:	89 e5                	mov    %esp,%ebp
+  801c93:	53                   	push   %ebx
+  801c94:	83 ec 08             	sub    $0x8,%esp
+  801c97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801c9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c9d:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ca2:	53                   	push   %ebx
+  801ca3:	ff 75 0c             	push   0xc(%ebp)
+  801ca6:	68 04 80 80 00       	push   $0x808004
+  801cab:	e8 2c ed ff ff       	call   8009dc <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801cb0:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801cb6:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cbb:	e8 32 ff ff ff       	call   801bf2 <nsipc>
+}
+  801cc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc3:	c9                   	leave
+  801cc4:	c3                   	ret
+
+00801cc5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801cc5:	55                   	push   %ebp
+  801cc6:	89 e5                	mov    %esp,%ebp
+  801cc8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801ccb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cce:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801cd3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cd6:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801cdb:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ce0:	e8 0d ff ff ff       	call   801bf2 <nsipc>
+}
+  801ce5:	c9                   	leave
+  801ce6:	c3                   	ret
+
+00801ce7 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801ce7:	55                   	push   %ebp
+  801ce8:	89 e5                	mov    %esp,%ebp
+  801cea:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801ced:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cf0:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801cf5:	b8 04 00 00 00       	mov    $0x4,%eax
+  801cfa:	e8 f3 fe ff ff       	call   801bf2 <nsipc>
+}
+  801cff:	c9                   	leave
+  801d00:	c3                   	ret
+
+00801d01 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801d01:	55                   	push   %ebp
+  801d02:	89 e5                	mov    %esp,%ebp
+  801d04:	53                   	push   %ebx
+  801d05:	83 ec 08             	sub    $0x8,%esp
+  801d08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801d0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d0e:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801d13:	53                   	push   %ebx
+  801d14:	ff 75 0c             	push   0xc(%ebp)
+  801d17:	68 04 80 80 00       	push   $0x808004
+  801d1c:	e8 bb ec ff ff       	call   8009dc <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801d21:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801d27:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d2c:	e8 c1 fe ff ff       	call   801bf2 <nsipc>
+}
+  801d31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d34:	c9                   	leave
+  801d35:	c3                   	ret
+
+00801d36 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801d36:	55                   	push   %ebp
+  801d37:	89 e5                	mov    %esp,%ebp
+  801d39:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801d3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801d44:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d47:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801d4c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d51:	e8 9c fe ff ff       	call   801bf2 <nsipc>
+}
+  801d56:	c9                   	leave
+  801d57:	c3                   	ret
+
+00801d58 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801d58:	55                   	push   %ebp
+  801d59:	89 e5                	mov    %esp,%ebp
+  801d5b:	56                   	push   %esi
+  801d5c:	53                   	push   %ebx
+  801d5d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801d60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d63:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801d68:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801d6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d71:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801d76:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d7b:	e8 72 fe ff ff       	call   801bf2 <nsipc>
+  801d80:	89 c3                	mov    %eax,%ebx
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	78 22                	js     801da8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801d86:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801d8b:	39 c6                	cmp    %eax,%esi
+  801d8d:	0f 4e c6             	cmovle %esi,%eax
+  801d90:	39 c3                	cmp    %eax,%ebx
+  801d92:	7f 1d                	jg     801db1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801d94:	83 ec 04             	sub    $0x4,%esp
+  801d97:	53                   	push   %ebx
+  801d98:	68 00 80 80 00       	push   $0x808000
+  801d9d:	ff 75 0c             	push   0xc(%ebp)
+  801da0:	e8 37 ec ff ff       	call   8009dc <memmove>
+  801da5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801da8:	89 d8                	mov    %ebx,%eax
+  801daa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dad:	5b                   	pop    %ebx
+  801dae:	5e                   	pop    %esi
+  801daf:	5d                   	pop    %ebp
+  801db0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801db1:	68 fb 2c 80 00       	push   $0x802cfb
+  801db6:	68 c3 2c 80 00       	push   $0x802cc3
+  801dbb:	6a 62                	push   $0x62
+  801dbd:	68 10 2d 80 00       	push   $0x802d10
+  801dc2:	e8 c6 e3 ff ff       	call   80018d <_panic>
+
+00801dc7 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801dc7:	55                   	push   %ebp
+  801dc8:	89 e5                	mov    %esp,%ebp
+  801dca:	53                   	push   %ebx
+  801dcb:	83 ec 04             	sub    $0x4,%esp
+  801dce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd4:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  801dd9:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801ddf:	7f 2e                	jg     801e0f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801de1:	83 ec 04             	sub    $0x4,%esp
+  801de4:	53                   	push   %ebx
+  801de5:	ff 75 0c             	push   0xc(%ebp)
+  801de8:	68 0c 80 80 00       	push   $0x80800c
+  801ded:	e8 ea eb ff ff       	call   8009dc <memmove>
+	nsipcbuf.send.req_size = size;
+  801df2:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  801df8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dfb:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  801e00:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e05:	e8 e8 fd ff ff       	call   801bf2 <nsipc>
+}
+  801e0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e0d:	c9                   	leave
+  801e0e:	c3                   	ret
+	assert(size < 1600);
+  801e0f:	68 1c 2d 80 00       	push   $0x802d1c
+  801e14:	68 c3 2c 80 00       	push   $0x802cc3
+  801e19:	6a 6d                	push   $0x6d
+  801e1b:	68 10 2d 80 00       	push   $0x802d10
+  801e20:	e8 68 e3 ff ff       	call   80018d <_panic>
+
+00801e25 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801e25:	55                   	push   %ebp
+  801e26:	89 e5                	mov    %esp,%ebp
+  801e28:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801e2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e2e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  801e33:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e36:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  801e3b:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e3e:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  801e43:	b8 09 00 00 00       	mov    $0x9,%eax
+  801e48:	e8 a5 fd ff ff       	call   801bf2 <nsipc>
+}
+  801e4d:	c9                   	leave
+  801e4e:	c3                   	ret
+
+00801e4f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e4f:	55                   	push   %ebp
+  801e50:	89 e5                	mov    %esp,%ebp
+  801e52:	56                   	push   %esi
+  801e53:	53                   	push   %ebx
+  801e54:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801e57:	83 ec 0c             	sub    $0xc,%esp
+  801e5a:	ff 75 08             	push   0x8(%ebp)
+  801e5d:	e8 96 f2 ff ff       	call   8010f8 <fd2data>
+  801e62:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801e64:	83 c4 08             	add    $0x8,%esp
+  801e67:	68 28 2d 80 00       	push   $0x802d28
+  801e6c:	53                   	push   %ebx
+  801e6d:	e8 e4 e9 ff ff       	call   800856 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801e72:	8b 46 04             	mov    0x4(%esi),%eax
+  801e75:	2b 06                	sub    (%esi),%eax
+  801e77:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801e7d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e84:	00 00 00 
+	stat->st_dev = &devpipe;
+  801e87:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801e8e:	30 80 00 
+	return 0;
+}
+  801e91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e99:	5b                   	pop    %ebx
+  801e9a:	5e                   	pop    %esi
+  801e9b:	5d                   	pop    %ebp
+  801e9c:	c3                   	ret
+
+00801e9d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801e9d:	55                   	push   %ebp
+  801e9e:	89 e5                	mov    %esp,%ebp
+  801ea0:	53                   	push   %ebx
+  801ea1:	83 ec 0c             	sub    $0xc,%esp
+  801ea4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801ea7:	53                   	push   %ebx
+  801ea8:	6a 00                	push   $0x0
+  801eaa:	e8 dc ee ff ff       	call   800d8b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801eaf:	89 1c 24             	mov    %ebx,(%esp)
+  801eb2:	e8 41 f2 ff ff       	call   8010f8 <fd2data>
+  801eb7:	83 c4 08             	add    $0x8,%esp
+  801eba:	50                   	push   %eax
+  801ebb:	6a 00                	push   $0x0
+  801ebd:	e8 c9 ee ff ff       	call   800d8b <sys_page_unmap>
+}
+  801ec2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ec5:	c9                   	leave
+  801ec6:	c3                   	ret
+
+00801ec7 <_pipeisclosed>:
+{
+  801ec7:	55                   	push   %ebp
+  801ec8:	89 e5                	mov    %esp,%ebp
+  801eca:	57                   	push   %edi
+  801ecb:	56                   	push   %esi
+  801ecc:	53                   	push   %ebx
+  801ecd:	83 ec 1c             	sub    $0x1c,%esp
+  801ed0:	89 c7                	mov    %eax,%edi
+  801ed2:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801ed4:	a1 20 60 80 00       	mov    0x806020,%eax
+  801ed9:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801edc:	83 ec 0c             	sub    $0xc,%esp
+  801edf:	57                   	push   %edi
+  801ee0:	e8 04 05 00 00       	call   8023e9 <pageref>
+  801ee5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ee8:	89 34 24             	mov    %esi,(%esp)
+  801eeb:	e8 f9 04 00 00       	call   8023e9 <pageref>
+		nn = thisenv->env_runs;
+  801ef0:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  801ef6:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801ef9:	83 c4 10             	add    $0x10,%esp
+  801efc:	39 cb                	cmp    %ecx,%ebx
+  801efe:	74 1b                	je     801f1b <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801f00:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f03:	75 cf                	jne    801ed4 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801f05:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801f08:	6a 01                	push   $0x1
+  801f0a:	50                   	push   %eax
+  801f0b:	53                   	push   %ebx
+  801f0c:	68 2f 2d 80 00       	push   $0x802d2f
+  801f11:	e8 52 e3 ff ff       	call   800268 <cprintf>
+  801f16:	83 c4 10             	add    $0x10,%esp
+  801f19:	eb b9                	jmp    801ed4 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801f1b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f1e:	0f 94 c0             	sete   %al
+  801f21:	0f b6 c0             	movzbl %al,%eax
+}
+  801f24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f27:	5b                   	pop    %ebx
+  801f28:	5e                   	pop    %esi
+  801f29:	5f                   	pop    %edi
+  801f2a:	5d                   	pop    %ebp
+  801f2b:	c3                   	ret
+
+00801f2c <devpipe_write>:
+{
+  801f2c:	55                   	push   %ebp
+  801f2d:	89 e5                	mov    %esp,%ebp
+  801f2f:	57                   	push   %edi
+  801f30:	56                   	push   %esi
+  801f31:	53                   	push   %ebx
+  801f32:	83 ec 28             	sub    $0x28,%esp
+  801f35:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801f38:	56                   	push   %esi
+  801f39:	e8 ba f1 ff ff       	call   8010f8 <fd2data>
+  801f3e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801f40:	83 c4 10             	add    $0x10,%esp
+  801f43:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f48:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801f4b:	75 09                	jne    801f56 <devpipe_write+0x2a>
+	return i;
+  801f4d:	89 f8                	mov    %edi,%eax
+  801f4f:	eb 23                	jmp    801f74 <devpipe_write+0x48>
+			sys_yield();
+  801f51:	e8 ed ec ff ff       	call   800c43 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801f56:	8b 43 04             	mov    0x4(%ebx),%eax
+  801f59:	8b 0b                	mov    (%ebx),%ecx
+  801f5b:	8d 51 20             	lea    0x20(%ecx),%edx
+  801f5e:	39 d0                	cmp    %edx,%eax
+  801f60:	72 1a                	jb     801f7c <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801f62:	89 da                	mov    %ebx,%edx
+  801f64:	89 f0                	mov    %esi,%eax
+  801f66:	e8 5c ff ff ff       	call   801ec7 <_pipeisclosed>
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	74 e2                	je     801f51 <devpipe_write+0x25>
+				return 0;
+  801f6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f77:	5b                   	pop    %ebx
+  801f78:	5e                   	pop    %esi
+  801f79:	5f                   	pop    %edi
+  801f7a:	5d                   	pop    %ebp
+  801f7b:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801f7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f7f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801f83:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801f86:	89 c2                	mov    %eax,%edx
+  801f88:	c1 fa 1f             	sar    $0x1f,%edx
+  801f8b:	89 d1                	mov    %edx,%ecx
+  801f8d:	c1 e9 1b             	shr    $0x1b,%ecx
+  801f90:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801f93:	83 e2 1f             	and    $0x1f,%edx
+  801f96:	29 ca                	sub    %ecx,%edx
+  801f98:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801f9c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801fa0:	83 c0 01             	add    $0x1,%eax
+  801fa3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801fa6:	83 c7 01             	add    $0x1,%edi
+  801fa9:	eb 9d                	jmp    801f48 <devpipe_write+0x1c>
+
+00801fab <devpipe_read>:
+{
+  801fab:	55                   	push   %ebp
+  801fac:	89 e5                	mov    %esp,%ebp
+  801fae:	57                   	push   %edi
+  801faf:	56                   	push   %esi
+  801fb0:	53                   	push   %ebx
+  801fb1:	83 ec 18             	sub    $0x18,%esp
+  801fb4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801fb7:	57                   	push   %edi
+  801fb8:	e8 3b f1 ff ff       	call   8010f8 <fd2data>
+  801fbd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801fbf:	83 c4 10             	add    $0x10,%esp
+  801fc2:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801fca:	75 13                	jne    801fdf <devpipe_read+0x34>
+	return i;
+  801fcc:	89 f0                	mov    %esi,%eax
+  801fce:	eb 02                	jmp    801fd2 <devpipe_read+0x27>
+				return i;
+  801fd0:	89 f0                	mov    %esi,%eax
+}
+  801fd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fd5:	5b                   	pop    %ebx
+  801fd6:	5e                   	pop    %esi
+  801fd7:	5f                   	pop    %edi
+  801fd8:	5d                   	pop    %ebp
+  801fd9:	c3                   	ret
+			sys_yield();
+  801fda:	e8 64 ec ff ff       	call   800c43 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801fdf:	8b 03                	mov    (%ebx),%eax
+  801fe1:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801fe4:	75 18                	jne    801ffe <devpipe_read+0x53>
+			if (i > 0)
+  801fe6:	85 f6                	test   %esi,%esi
+  801fe8:	75 e6                	jne    801fd0 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801fea:	89 da                	mov    %ebx,%edx
+  801fec:	89 f8                	mov    %edi,%eax
+  801fee:	e8 d4 fe ff ff       	call   801ec7 <_pipeisclosed>
+  801ff3:	85 c0                	test   %eax,%eax
+  801ff5:	74 e3                	je     801fda <devpipe_read+0x2f>
+				return 0;
+  801ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ffc:	eb d4                	jmp    801fd2 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801ffe:	99                   	cltd
+  801fff:	c1 ea 1b             	shr    $0x1b,%edx
+  802002:	01 d0                	add    %edx,%eax
+  802004:	83 e0 1f             	and    $0x1f,%eax
+  802007:	29 d0                	sub    %edx,%eax
+  802009:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80200e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802011:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802014:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802017:	83 c6 01             	add    $0x1,%esi
+  80201a:	eb ab                	jmp    801fc7 <devpipe_read+0x1c>
+
+0080201c <pipe>:
+{
+  80201c:	55                   	push   %ebp
+  80201d:	89 e5                	mov    %esp,%ebp
+  80201f:	56                   	push   %esi
+  802020:	53                   	push   %ebx
+  802021:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802024:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802027:	50                   	push   %eax
+  802028:	e8 e2 f0 ff ff       	call   80110f <fd_alloc>
+  80202d:	89 c3                	mov    %eax,%ebx
+  80202f:	83 c4 10             	add    $0x10,%esp
+  802032:	85 c0                	test   %eax,%eax
+  802034:	0f 88 23 01 00 00    	js     80215d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80203a:	83 ec 04             	sub    $0x4,%esp
+  80203d:	68 07 04 00 00       	push   $0x407
+  802042:	ff 75 f4             	push   -0xc(%ebp)
+  802045:	6a 00                	push   $0x0
+  802047:	e8 77 ec ff ff       	call   800cc3 <sys_page_alloc>
+  80204c:	89 c3                	mov    %eax,%ebx
+  80204e:	83 c4 10             	add    $0x10,%esp
+  802051:	85 c0                	test   %eax,%eax
+  802053:	0f 88 04 01 00 00    	js     80215d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802059:	83 ec 0c             	sub    $0xc,%esp
+  80205c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80205f:	50                   	push   %eax
+  802060:	e8 aa f0 ff ff       	call   80110f <fd_alloc>
+  802065:	89 c3                	mov    %eax,%ebx
+  802067:	83 c4 10             	add    $0x10,%esp
+  80206a:	85 c0                	test   %eax,%eax
+  80206c:	0f 88 db 00 00 00    	js     80214d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802072:	83 ec 04             	sub    $0x4,%esp
+  802075:	68 07 04 00 00       	push   $0x407
+  80207a:	ff 75 f0             	push   -0x10(%ebp)
+  80207d:	6a 00                	push   $0x0
+  80207f:	e8 3f ec ff ff       	call   800cc3 <sys_page_alloc>
+  802084:	89 c3                	mov    %eax,%ebx
+  802086:	83 c4 10             	add    $0x10,%esp
+  802089:	85 c0                	test   %eax,%eax
+  80208b:	0f 88 bc 00 00 00    	js     80214d <pipe+0x131>
+	va = fd2data(fd0);
+  802091:	83 ec 0c             	sub    $0xc,%esp
+  802094:	ff 75 f4             	push   -0xc(%ebp)
+  802097:	e8 5c f0 ff ff       	call   8010f8 <fd2data>
+  80209c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80209e:	83 c4 0c             	add    $0xc,%esp
+  8020a1:	68 07 04 00 00       	push   $0x407
+  8020a6:	50                   	push   %eax
+  8020a7:	6a 00                	push   $0x0
+  8020a9:	e8 15 ec ff ff       	call   800cc3 <sys_page_alloc>
+  8020ae:	89 c3                	mov    %eax,%ebx
+  8020b0:	83 c4 10             	add    $0x10,%esp
+  8020b3:	85 c0                	test   %eax,%eax
+  8020b5:	0f 88 82 00 00 00    	js     80213d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020bb:	83 ec 0c             	sub    $0xc,%esp
+  8020be:	ff 75 f0             	push   -0x10(%ebp)
+  8020c1:	e8 32 f0 ff ff       	call   8010f8 <fd2data>
+  8020c6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8020cd:	50                   	push   %eax
+  8020ce:	6a 00                	push   $0x0
+  8020d0:	56                   	push   %esi
+  8020d1:	6a 00                	push   $0x0
+  8020d3:	e8 71 ec ff ff       	call   800d49 <sys_page_map>
+  8020d8:	89 c3                	mov    %eax,%ebx
+  8020da:	83 c4 20             	add    $0x20,%esp
+  8020dd:	85 c0                	test   %eax,%eax
+  8020df:	78 4e                	js     80212f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8020e1:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8020e6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020e9:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8020eb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020ee:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8020f5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8020f8:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8020fa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8020fd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802104:	83 ec 0c             	sub    $0xc,%esp
+  802107:	ff 75 f4             	push   -0xc(%ebp)
+  80210a:	e8 d9 ef ff ff       	call   8010e8 <fd2num>
+  80210f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802112:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802114:	83 c4 04             	add    $0x4,%esp
+  802117:	ff 75 f0             	push   -0x10(%ebp)
+  80211a:	e8 c9 ef ff ff       	call   8010e8 <fd2num>
+  80211f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802122:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802125:	83 c4 10             	add    $0x10,%esp
+  802128:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80212d:	eb 2e                	jmp    80215d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80212f:	83 ec 08             	sub    $0x8,%esp
+  802132:	56                   	push   %esi
+  802133:	6a 00                	push   $0x0
+  802135:	e8 51 ec ff ff       	call   800d8b <sys_page_unmap>
+  80213a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80213d:	83 ec 08             	sub    $0x8,%esp
+  802140:	ff 75 f0             	push   -0x10(%ebp)
+  802143:	6a 00                	push   $0x0
+  802145:	e8 41 ec ff ff       	call   800d8b <sys_page_unmap>
+  80214a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80214d:	83 ec 08             	sub    $0x8,%esp
+  802150:	ff 75 f4             	push   -0xc(%ebp)
+  802153:	6a 00                	push   $0x0
+  802155:	e8 31 ec ff ff       	call   800d8b <sys_page_unmap>
+  80215a:	83 c4 10             	add    $0x10,%esp
+}
+  80215d:	89 d8                	mov    %ebx,%eax
+  80215f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802162:	5b                   	pop    %ebx
+  802163:	5e                   	pop    %esi
+  802164:	5d                   	pop    %ebp
+  802165:	c3                   	ret
+
+00802166 <pipeisclosed>:
+{
+  802166:	55                   	push   %ebp
+  802167:	89 e5                	mov    %esp,%ebp
+  802169:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80216c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80216f:	50                   	push   %eax
+  802170:	ff 75 08             	push   0x8(%ebp)
+  802173:	e8 ed ef ff ff       	call   801165 <fd_lookup>
+  802178:	83 c4 10             	add    $0x10,%esp
+  80217b:	85 c0                	test   %eax,%eax
+  80217d:	78 18                	js     802197 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80217f:	83 ec 0c             	sub    $0xc,%esp
+  802182:	ff 75 f4             	push   -0xc(%ebp)
+  802185:	e8 6e ef ff ff       	call   8010f8 <fd2data>
+  80218a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80218c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218f:	e8 33 fd ff ff       	call   801ec7 <_pipeisclosed>
+  802194:	83 c4 10             	add    $0x10,%esp
+}
+  802197:	c9                   	leave
+  802198:	c3                   	ret
+
+00802199 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802199:	b8 00 00 00 00       	mov    $0x0,%eax
+  80219e:	c3                   	ret
+
+0080219f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80219f:	55                   	push   %ebp
+  8021a0:	89 e5                	mov    %esp,%ebp
+  8021a2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8021a5:	68 47 2d 80 00       	push   $0x802d47
+  8021aa:	ff 75 0c             	push   0xc(%ebp)
+  8021ad:	e8 a4 e6 ff ff       	call   800856 <strcpy>
+	return 0;
+}
+  8021b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b7:	c9                   	leave
+  8021b8:	c3                   	ret
+
+008021b9 <devcons_write>:
+{
+  8021b9:	55                   	push   %ebp
+  8021ba:	89 e5                	mov    %esp,%ebp
+  8021bc:	57                   	push   %edi
+  8021bd:	56                   	push   %esi
+  8021be:	53                   	push   %ebx
+  8021bf:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8021c5:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8021ca:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8021d0:	eb 2e                	jmp    802200 <devcons_write+0x47>
+		m = n - tot;
+  8021d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021d5:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8021d7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8021dc:	39 c3                	cmp    %eax,%ebx
+  8021de:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8021e1:	83 ec 04             	sub    $0x4,%esp
+  8021e4:	53                   	push   %ebx
+  8021e5:	89 f0                	mov    %esi,%eax
+  8021e7:	03 45 0c             	add    0xc(%ebp),%eax
+  8021ea:	50                   	push   %eax
+  8021eb:	57                   	push   %edi
+  8021ec:	e8 eb e7 ff ff       	call   8009dc <memmove>
+		sys_cputs(buf, m);
+  8021f1:	83 c4 08             	add    $0x8,%esp
+  8021f4:	53                   	push   %ebx
+  8021f5:	57                   	push   %edi
+  8021f6:	e8 8b e9 ff ff       	call   800b86 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8021fb:	01 de                	add    %ebx,%esi
+  8021fd:	83 c4 10             	add    $0x10,%esp
+  802200:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802203:	72 cd                	jb     8021d2 <devcons_write+0x19>
+}
+  802205:	89 f0                	mov    %esi,%eax
+  802207:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80220a:	5b                   	pop    %ebx
+  80220b:	5e                   	pop    %esi
+  80220c:	5f                   	pop    %edi
+  80220d:	5d                   	pop    %ebp
+  80220e:	c3                   	ret
+
+0080220f <devcons_read>:
+{
+  80220f:	55                   	push   %ebp
+  802210:	89 e5                	mov    %esp,%ebp
+  802212:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80221e:	75 07                	jne    802227 <devcons_read+0x18>
+  802220:	eb 1f                	jmp    802241 <devcons_read+0x32>
+		sys_yield();
+  802222:	e8 1c ea ff ff       	call   800c43 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802227:	e8 78 e9 ff ff       	call   800ba4 <sys_cgetc>
+  80222c:	85 c0                	test   %eax,%eax
+  80222e:	74 f2                	je     802222 <devcons_read+0x13>
+	if (c < 0)
+  802230:	78 0f                	js     802241 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802232:	83 f8 04             	cmp    $0x4,%eax
+  802235:	74 0c                	je     802243 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802237:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80223a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80223c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802241:	c9                   	leave
+  802242:	c3                   	ret
+		return 0;
+  802243:	b8 00 00 00 00       	mov    $0x0,%eax
+  802248:	eb f7                	jmp    802241 <devcons_read+0x32>
+
+0080224a <cputchar>:
+{
+  80224a:	55                   	push   %ebp
+  80224b:	89 e5                	mov    %esp,%ebp
+  80224d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802250:	8b 45 08             	mov    0x8(%ebp),%eax
+  802253:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802256:	6a 01                	push   $0x1
+  802258:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80225b:	50                   	push   %eax
+  80225c:	e8 25 e9 ff ff       	call   800b86 <sys_cputs>
+}
+  802261:	83 c4 10             	add    $0x10,%esp
+  802264:	c9                   	leave
+  802265:	c3                   	ret
+
+00802266 <getchar>:
+{
+  802266:	55                   	push   %ebp
+  802267:	89 e5                	mov    %esp,%ebp
+  802269:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80226c:	6a 01                	push   $0x1
+  80226e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802271:	50                   	push   %eax
+  802272:	6a 00                	push   $0x0
+  802274:	e8 52 f1 ff ff       	call   8013cb <read>
+	if (r < 0)
+  802279:	83 c4 10             	add    $0x10,%esp
+  80227c:	85 c0                	test   %eax,%eax
+  80227e:	78 06                	js     802286 <getchar+0x20>
+	if (r < 1)
+  802280:	74 06                	je     802288 <getchar+0x22>
+	return c;
+  802282:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802286:	c9                   	leave
+  802287:	c3                   	ret
+		return -E_EOF;
+  802288:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80228d:	eb f7                	jmp    802286 <getchar+0x20>
+
+0080228f <iscons>:
+{
+  80228f:	55                   	push   %ebp
+  802290:	89 e5                	mov    %esp,%ebp
+  802292:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802295:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802298:	50                   	push   %eax
+  802299:	ff 75 08             	push   0x8(%ebp)
+  80229c:	e8 c4 ee ff ff       	call   801165 <fd_lookup>
+  8022a1:	83 c4 10             	add    $0x10,%esp
+  8022a4:	85 c0                	test   %eax,%eax
+  8022a6:	78 11                	js     8022b9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8022a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ab:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8022b1:	39 10                	cmp    %edx,(%eax)
+  8022b3:	0f 94 c0             	sete   %al
+  8022b6:	0f b6 c0             	movzbl %al,%eax
+}
+  8022b9:	c9                   	leave
+  8022ba:	c3                   	ret
+
+008022bb <opencons>:
+{
+  8022bb:	55                   	push   %ebp
+  8022bc:	89 e5                	mov    %esp,%ebp
+  8022be:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8022c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022c4:	50                   	push   %eax
+  8022c5:	e8 45 ee ff ff       	call   80110f <fd_alloc>
+  8022ca:	83 c4 10             	add    $0x10,%esp
+  8022cd:	85 c0                	test   %eax,%eax
+  8022cf:	78 3a                	js     80230b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8022d1:	83 ec 04             	sub    $0x4,%esp
+  8022d4:	68 07 04 00 00       	push   $0x407
+  8022d9:	ff 75 f4             	push   -0xc(%ebp)
+  8022dc:	6a 00                	push   $0x0
+  8022de:	e8 e0 e9 ff ff       	call   800cc3 <sys_page_alloc>
+  8022e3:	83 c4 10             	add    $0x10,%esp
+  8022e6:	85 c0                	test   %eax,%eax
+  8022e8:	78 21                	js     80230b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8022ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ed:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8022f3:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8022f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022f8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8022ff:	83 ec 0c             	sub    $0xc,%esp
+  802302:	50                   	push   %eax
+  802303:	e8 e0 ed ff ff       	call   8010e8 <fd2num>
+  802308:	83 c4 10             	add    $0x10,%esp
+}
+  80230b:	c9                   	leave
+  80230c:	c3                   	ret
+
+0080230d <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80230d:	55                   	push   %ebp
+  80230e:	89 e5                	mov    %esp,%ebp
+  802310:	57                   	push   %edi
+  802311:	56                   	push   %esi
+  802312:	53                   	push   %ebx
+  802313:	83 ec 18             	sub    $0x18,%esp
+  802316:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802319:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80231c:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80231f:	85 db                	test   %ebx,%ebx
+  802321:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802326:	0f 45 c3             	cmovne %ebx,%eax
+  802329:	50                   	push   %eax
+  80232a:	e8 17 ed ff ff       	call   801046 <sys_ipc_recv>
+
+	if (from_env_store)
+  80232f:	83 c4 10             	add    $0x10,%esp
+  802332:	85 ff                	test   %edi,%edi
+  802334:	74 17                	je     80234d <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802336:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233b:	85 c0                	test   %eax,%eax
+  80233d:	75 0c                	jne    80234b <ipc_recv+0x3e>
+  80233f:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  802345:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  80234b:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  80234d:	85 f6                	test   %esi,%esi
+  80234f:	74 2e                	je     80237f <ipc_recv+0x72>
+		if (!r && pg)
+  802351:	85 c0                	test   %eax,%eax
+  802353:	75 24                	jne    802379 <ipc_recv+0x6c>
+  802355:	85 db                	test   %ebx,%ebx
+  802357:	74 20                	je     802379 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802359:	a1 20 60 80 00       	mov    0x806020,%eax
+  80235e:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802364:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802366:	a1 20 60 80 00       	mov    0x806020,%eax
+  80236b:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802371:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802374:	5b                   	pop    %ebx
+  802375:	5e                   	pop    %esi
+  802376:	5f                   	pop    %edi
+  802377:	5d                   	pop    %ebp
+  802378:	c3                   	ret
+			*perm_store = 0;
+  802379:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80237f:	85 c0                	test   %eax,%eax
+  802381:	75 ee                	jne    802371 <ipc_recv+0x64>
+  802383:	eb e1                	jmp    802366 <ipc_recv+0x59>
+
+00802385 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802385:	55                   	push   %ebp
+  802386:	89 e5                	mov    %esp,%ebp
+  802388:	57                   	push   %edi
+  802389:	56                   	push   %esi
+  80238a:	53                   	push   %ebx
+  80238b:	83 ec 0c             	sub    $0xc,%esp
+  80238e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802391:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802394:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802397:	85 db                	test   %ebx,%ebx
+  802399:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80239e:	0f 44 d8             	cmove  %eax,%ebx
+  8023a1:	ff 75 14             	push   0x14(%ebp)
+  8023a4:	53                   	push   %ebx
+  8023a5:	56                   	push   %esi
+  8023a6:	57                   	push   %edi
+  8023a7:	e8 77 ec ff ff       	call   801023 <sys_ipc_try_send_yield>
+  8023ac:	83 c4 10             	add    $0x10,%esp
+  8023af:	85 c0                	test   %eax,%eax
+  8023b1:	79 1e                	jns    8023d1 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8023b3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8023b6:	75 07                	jne    8023bf <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8023b8:	e8 86 e8 ff ff       	call   800c43 <sys_yield>
+  8023bd:	eb e2                	jmp    8023a1 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8023bf:	50                   	push   %eax
+  8023c0:	68 53 2d 80 00       	push   $0x802d53
+  8023c5:	6a 3d                	push   $0x3d
+  8023c7:	68 68 2d 80 00       	push   $0x802d68
+  8023cc:	e8 bc dd ff ff       	call   80018d <_panic>
+	}
+}
+  8023d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023d4:	5b                   	pop    %ebx
+  8023d5:	5e                   	pop    %esi
+  8023d6:	5f                   	pop    %edi
+  8023d7:	5d                   	pop    %ebp
+  8023d8:	c3                   	ret
+
+008023d9 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8023d9:	55                   	push   %ebp
+  8023da:	89 e5                	mov    %esp,%ebp
+  8023dc:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8023df:	ff 75 08             	push   0x8(%ebp)
+  8023e2:	e8 dc e7 ff ff       	call   800bc3 <sys_env_find>
+}
+  8023e7:	c9                   	leave
+  8023e8:	c3                   	ret
+
+008023e9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8023e9:	55                   	push   %ebp
+  8023ea:	89 e5                	mov    %esp,%ebp
+  8023ec:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8023ef:	89 c2                	mov    %eax,%edx
+  8023f1:	c1 ea 16             	shr    $0x16,%edx
+  8023f4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8023fb:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802400:	f6 c1 01             	test   $0x1,%cl
+  802403:	74 22                	je     802427 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802405:	c1 e8 0c             	shr    $0xc,%eax
+  802408:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80240f:	a8 01                	test   $0x1,%al
+  802411:	74 14                	je     802427 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802413:	c1 e8 0c             	shr    $0xc,%eax
+  802416:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802419:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802420:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802424:	0f b7 d2             	movzwl %dx,%edx
+}
+  802427:	89 d0                	mov    %edx,%eax
+  802429:	5d                   	pop    %ebp
+  80242a:	c3                   	ret
+  80242b:	66 90                	xchg   %ax,%ax
+  80242d:	66 90                	xchg   %ax,%ax
+  80242f:	90                   	nop
+
+00802430 <__udivmoddi4>:
+  802430:	55                   	push   %ebp
+  802431:	57                   	push   %edi
+  802432:	56                   	push   %esi
+  802433:	53                   	push   %ebx
+  802434:	83 ec 14             	sub    $0x14,%esp
+  802437:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80243b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80243f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802443:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802447:	89 f1                	mov    %esi,%ecx
+  802449:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80244d:	09 d9                	or     %ebx,%ecx
+  80244f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802453:	0f 84 92 00 00 00    	je     8024eb <__udivmoddi4+0xbb>
+  802459:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802460:	00 
+  802461:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802466:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80246d:	00 
+  80246e:	89 1c 24             	mov    %ebx,(%esp)
+  802471:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802475:	8d 76 00             	lea    0x0(%esi),%esi
+  802478:	89 e9                	mov    %ebp,%ecx
+  80247a:	89 c3                	mov    %eax,%ebx
+  80247c:	89 d6                	mov    %edx,%esi
+  80247e:	31 ff                	xor    %edi,%edi
+  802480:	d3 ee                	shr    %cl,%esi
+  802482:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802485:	f6 c1 20             	test   $0x20,%cl
+  802488:	0f 45 de             	cmovne %esi,%ebx
+  80248b:	0f 45 f7             	cmovne %edi,%esi
+  80248e:	8b 3c 24             	mov    (%esp),%edi
+  802491:	39 fb                	cmp    %edi,%ebx
+  802493:	89 f7                	mov    %esi,%edi
+  802495:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802499:	8b 1c 24             	mov    (%esp),%ebx
+  80249c:	19 f7                	sbb    %esi,%edi
+  80249e:	72 39                	jb     8024d9 <__udivmoddi4+0xa9>
+  8024a0:	89 e9                	mov    %ebp,%ecx
+  8024a2:	89 f7                	mov    %esi,%edi
+  8024a4:	89 de                	mov    %ebx,%esi
+  8024a6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8024a9:	d3 e6                	shl    %cl,%esi
+  8024ab:	31 db                	xor    %ebx,%ebx
+  8024ad:	f6 c1 20             	test   $0x20,%cl
+  8024b0:	0f 45 fe             	cmovne %esi,%edi
+  8024b3:	0f 45 f3             	cmovne %ebx,%esi
+  8024b6:	29 f0                	sub    %esi,%eax
+  8024b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8024bd:	19 fa                	sbb    %edi,%edx
+  8024bf:	31 ff                	xor    %edi,%edi
+  8024c1:	31 db                	xor    %ebx,%ebx
+  8024c3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8024c6:	d3 e6                	shl    %cl,%esi
+  8024c8:	f6 c1 20             	test   $0x20,%cl
+  8024cb:	0f 45 fe             	cmovne %esi,%edi
+  8024ce:	0f 45 f3             	cmovne %ebx,%esi
+  8024d1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8024d5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8024d9:	83 ed 01             	sub    $0x1,%ebp
+  8024dc:	73 9a                	jae    802478 <__udivmoddi4+0x48>
+  8024de:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8024e2:	85 ff                	test   %edi,%edi
+  8024e4:	74 05                	je     8024eb <__udivmoddi4+0xbb>
+  8024e6:	89 07                	mov    %eax,(%edi)
+  8024e8:	89 57 04             	mov    %edx,0x4(%edi)
+  8024eb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024ef:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8024f3:	83 c4 14             	add    $0x14,%esp
+  8024f6:	5b                   	pop    %ebx
+  8024f7:	5e                   	pop    %esi
+  8024f8:	5f                   	pop    %edi
+  8024f9:	5d                   	pop    %ebp
+  8024fa:	c3                   	ret
+  8024fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024ff:	90                   	nop
+
+00802500 <__udivdi3>:
+  802500:	55                   	push   %ebp
+  802501:	57                   	push   %edi
+  802502:	56                   	push   %esi
+  802503:	53                   	push   %ebx
+  802504:	83 ec 14             	sub    $0x14,%esp
+  802507:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80250b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80250f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802513:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802517:	89 fb                	mov    %edi,%ebx
+  802519:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80251d:	09 f3                	or     %esi,%ebx
+  80251f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802523:	0f 84 85 00 00 00    	je     8025ae <__udivdi3+0xae>
+  802529:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802530:	00 
+  802531:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802536:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80253d:	00 
+  80253e:	89 34 24             	mov    %esi,(%esp)
+  802541:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802545:	8d 76 00             	lea    0x0(%esi),%esi
+  802548:	89 e9                	mov    %ebp,%ecx
+  80254a:	89 c3                	mov    %eax,%ebx
+  80254c:	89 d6                	mov    %edx,%esi
+  80254e:	31 ff                	xor    %edi,%edi
+  802550:	d3 ee                	shr    %cl,%esi
+  802552:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802555:	f6 c1 20             	test   $0x20,%cl
+  802558:	0f 45 de             	cmovne %esi,%ebx
+  80255b:	0f 45 f7             	cmovne %edi,%esi
+  80255e:	8b 3c 24             	mov    (%esp),%edi
+  802561:	39 fb                	cmp    %edi,%ebx
+  802563:	89 f7                	mov    %esi,%edi
+  802565:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802569:	8b 1c 24             	mov    (%esp),%ebx
+  80256c:	19 f7                	sbb    %esi,%edi
+  80256e:	72 39                	jb     8025a9 <__udivdi3+0xa9>
+  802570:	89 e9                	mov    %ebp,%ecx
+  802572:	89 f7                	mov    %esi,%edi
+  802574:	89 de                	mov    %ebx,%esi
+  802576:	0f a5 df             	shld   %cl,%ebx,%edi
+  802579:	d3 e6                	shl    %cl,%esi
+  80257b:	31 db                	xor    %ebx,%ebx
+  80257d:	f6 c1 20             	test   $0x20,%cl
+  802580:	0f 45 fe             	cmovne %esi,%edi
+  802583:	0f 45 f3             	cmovne %ebx,%esi
+  802586:	29 f0                	sub    %esi,%eax
+  802588:	be 01 00 00 00       	mov    $0x1,%esi
+  80258d:	19 fa                	sbb    %edi,%edx
+  80258f:	31 ff                	xor    %edi,%edi
+  802591:	31 db                	xor    %ebx,%ebx
+  802593:	0f a5 f7             	shld   %cl,%esi,%edi
+  802596:	d3 e6                	shl    %cl,%esi
+  802598:	f6 c1 20             	test   $0x20,%cl
+  80259b:	0f 45 fe             	cmovne %esi,%edi
+  80259e:	0f 45 f3             	cmovne %ebx,%esi
+  8025a1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8025a5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8025a9:	83 ed 01             	sub    $0x1,%ebp
+  8025ac:	73 9a                	jae    802548 <__udivdi3+0x48>
+  8025ae:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025b2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025b6:	83 c4 14             	add    $0x14,%esp
+  8025b9:	5b                   	pop    %ebx
+  8025ba:	5e                   	pop    %esi
+  8025bb:	5f                   	pop    %edi
+  8025bc:	5d                   	pop    %ebp
+  8025bd:	c3                   	ret
+  8025be:	66 90                	xchg   %ax,%ax
+
+008025c0 <__umoddi3>:
+  8025c0:	57                   	push   %edi
+  8025c1:	56                   	push   %esi
+  8025c2:	53                   	push   %ebx
+  8025c3:	83 ec 08             	sub    $0x8,%esp
+  8025c6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8025ca:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8025ce:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025d2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025d6:	89 f9                	mov    %edi,%ecx
+  8025d8:	89 34 24             	mov    %esi,(%esp)
+  8025db:	09 f1                	or     %esi,%ecx
+  8025dd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8025e1:	74 53                	je     802636 <__umoddi3+0x76>
+  8025e3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8025ef:	90                   	nop
+  8025f0:	89 c6                	mov    %eax,%esi
+  8025f2:	89 d7                	mov    %edx,%edi
+  8025f4:	31 db                	xor    %ebx,%ebx
+  8025f6:	d3 ef                	shr    %cl,%edi
+  8025f8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8025fb:	f6 c1 20             	test   $0x20,%cl
+  8025fe:	0f 45 f7             	cmovne %edi,%esi
+  802601:	0f 45 fb             	cmovne %ebx,%edi
+  802604:	8b 1c 24             	mov    (%esp),%ebx
+  802607:	39 de                	cmp    %ebx,%esi
+  802609:	89 fb                	mov    %edi,%ebx
+  80260b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80260f:	8b 34 24             	mov    (%esp),%esi
+  802612:	19 fb                	sbb    %edi,%ebx
+  802614:	72 14                	jb     80262a <__umoddi3+0x6a>
+  802616:	0f a5 f7             	shld   %cl,%esi,%edi
+  802619:	31 db                	xor    %ebx,%ebx
+  80261b:	d3 e6                	shl    %cl,%esi
+  80261d:	f6 c1 20             	test   $0x20,%cl
+  802620:	0f 45 fe             	cmovne %esi,%edi
+  802623:	0f 45 f3             	cmovne %ebx,%esi
+  802626:	29 f0                	sub    %esi,%eax
+  802628:	19 fa                	sbb    %edi,%edx
+  80262a:	83 e9 01             	sub    $0x1,%ecx
+  80262d:	73 c1                	jae    8025f0 <__umoddi3+0x30>
+  80262f:	83 c4 08             	add    $0x8,%esp
+  802632:	5b                   	pop    %ebx
+  802633:	5e                   	pop    %esi
+  802634:	5f                   	pop    %edi
+  802635:	c3                   	ret
+  802636:	83 c4 08             	add    $0x8,%esp
+  802639:	31 c0                	xor    %eax,%eax
+  80263b:	31 d2                	xor    %edx,%edx
+  80263d:	5b                   	pop    %ebx
+  80263e:	5e                   	pop    %esi
+  80263f:	5f                   	pop    %edi
+  802640:	c3                   	ret
+  802641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80264f:	90                   	nop
+
+00802650 <__divdi3>:
+  802650:	55                   	push   %ebp
+  802651:	57                   	push   %edi
+  802652:	56                   	push   %esi
+  802653:	53                   	push   %ebx
+  802654:	83 ec 1c             	sub    $0x1c,%esp
+  802657:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80265b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80265f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802663:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802667:	85 ff                	test   %edi,%edi
+  802669:	0f 88 da 00 00 00    	js     802749 <__divdi3+0xf9>
+  80266f:	85 db                	test   %ebx,%ebx
+  802671:	78 16                	js     802689 <__divdi3+0x39>
+  802673:	89 dd                	mov    %ebx,%ebp
+  802675:	89 c8                	mov    %ecx,%eax
+  802677:	89 da                	mov    %ebx,%edx
+  802679:	09 cd                	or     %ecx,%ebp
+  80267b:	0f 85 fd 00 00 00    	jne    80277e <__divdi3+0x12e>
+  802681:	83 c4 1c             	add    $0x1c,%esp
+  802684:	5b                   	pop    %ebx
+  802685:	5e                   	pop    %esi
+  802686:	5f                   	pop    %edi
+  802687:	5d                   	pop    %ebp
+  802688:	c3                   	ret
+  802689:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80268e:	f7 d9                	neg    %ecx
+  802690:	89 f0                	mov    %esi,%eax
+  802692:	89 fa                	mov    %edi,%edx
+  802694:	83 d3 00             	adc    $0x0,%ebx
+  802697:	89 0c 24             	mov    %ecx,(%esp)
+  80269a:	f7 db                	neg    %ebx
+  80269c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8026a0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8026a7:	00 
+  8026a8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026ad:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8026b4:	00 
+  8026b5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8026b9:	89 cd                	mov    %ecx,%ebp
+  8026bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8026bf:	90                   	nop
+  8026c0:	89 e9                	mov    %ebp,%ecx
+  8026c2:	89 c3                	mov    %eax,%ebx
+  8026c4:	89 d6                	mov    %edx,%esi
+  8026c6:	31 ff                	xor    %edi,%edi
+  8026c8:	d3 ee                	shr    %cl,%esi
+  8026ca:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8026cd:	f6 c1 20             	test   $0x20,%cl
+  8026d0:	0f 45 de             	cmovne %esi,%ebx
+  8026d3:	0f 45 f7             	cmovne %edi,%esi
+  8026d6:	8b 3c 24             	mov    (%esp),%edi
+  8026d9:	39 fb                	cmp    %edi,%ebx
+  8026db:	89 f7                	mov    %esi,%edi
+  8026dd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8026e1:	8b 1c 24             	mov    (%esp),%ebx
+  8026e4:	19 f7                	sbb    %esi,%edi
+  8026e6:	72 39                	jb     802721 <__divdi3+0xd1>
+  8026e8:	89 e9                	mov    %ebp,%ecx
+  8026ea:	89 f7                	mov    %esi,%edi
+  8026ec:	89 de                	mov    %ebx,%esi
+  8026ee:	0f a5 df             	shld   %cl,%ebx,%edi
+  8026f1:	d3 e6                	shl    %cl,%esi
+  8026f3:	31 db                	xor    %ebx,%ebx
+  8026f5:	f6 c1 20             	test   $0x20,%cl
+  8026f8:	0f 45 fe             	cmovne %esi,%edi
+  8026fb:	0f 45 f3             	cmovne %ebx,%esi
+  8026fe:	29 f0                	sub    %esi,%eax
+  802700:	be 01 00 00 00       	mov    $0x1,%esi
+  802705:	19 fa                	sbb    %edi,%edx
+  802707:	31 ff                	xor    %edi,%edi
+  802709:	31 db                	xor    %ebx,%ebx
+  80270b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80270e:	d3 e6                	shl    %cl,%esi
+  802710:	f6 c1 20             	test   $0x20,%cl
+  802713:	0f 45 fe             	cmovne %esi,%edi
+  802716:	0f 45 f3             	cmovne %ebx,%esi
+  802719:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80271d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802721:	83 ed 01             	sub    $0x1,%ebp
+  802724:	73 9a                	jae    8026c0 <__divdi3+0x70>
+  802726:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80272a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80272e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802732:	85 ed                	test   %ebp,%ebp
+  802734:	0f 84 47 ff ff ff    	je     802681 <__divdi3+0x31>
+  80273a:	f7 d8                	neg    %eax
+  80273c:	83 d2 00             	adc    $0x0,%edx
+  80273f:	83 c4 1c             	add    $0x1c,%esp
+  802742:	5b                   	pop    %ebx
+  802743:	f7 da                	neg    %edx
+  802745:	5e                   	pop    %esi
+  802746:	5f                   	pop    %edi
+  802747:	5d                   	pop    %ebp
+  802748:	c3                   	ret
+  802749:	f7 de                	neg    %esi
+  80274b:	83 d7 00             	adc    $0x0,%edi
+  80274e:	f7 df                	neg    %edi
+  802750:	85 db                	test   %ebx,%ebx
+  802752:	78 23                	js     802777 <__divdi3+0x127>
+  802754:	89 dd                	mov    %ebx,%ebp
+  802756:	89 c8                	mov    %ecx,%eax
+  802758:	89 da                	mov    %ebx,%edx
+  80275a:	09 cd                	or     %ecx,%ebp
+  80275c:	0f 84 1f ff ff ff    	je     802681 <__divdi3+0x31>
+  802762:	89 0c 24             	mov    %ecx,(%esp)
+  802765:	89 f0                	mov    %esi,%eax
+  802767:	89 fa                	mov    %edi,%edx
+  802769:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80276e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802772:	e9 29 ff ff ff       	jmp    8026a0 <__divdi3+0x50>
+  802777:	31 ed                	xor    %ebp,%ebp
+  802779:	e9 10 ff ff ff       	jmp    80268e <__divdi3+0x3e>
+  80277e:	89 0c 24             	mov    %ecx,(%esp)
+  802781:	89 f0                	mov    %esi,%eax
+  802783:	89 fa                	mov    %edi,%edx
+  802785:	31 ed                	xor    %ebp,%ebp
+  802787:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80278b:	e9 10 ff ff ff       	jmp    8026a0 <__divdi3+0x50>
+
+00802790 <__moddi3>:
+  802790:	55                   	push   %ebp
+  802791:	57                   	push   %edi
+  802792:	56                   	push   %esi
+  802793:	53                   	push   %ebx
+  802794:	83 ec 14             	sub    $0x14,%esp
+  802797:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80279b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80279f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8027a3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8027a7:	85 d2                	test   %edx,%edx
+  8027a9:	0f 88 9b 00 00 00    	js     80284a <__moddi3+0xba>
+  8027af:	89 f7                	mov    %esi,%edi
+  8027b1:	31 ed                	xor    %ebp,%ebp
+  8027b3:	09 cf                	or     %ecx,%edi
+  8027b5:	0f 84 83 00 00 00    	je     80283e <__moddi3+0xae>
+  8027bb:	89 cb                	mov    %ecx,%ebx
+  8027bd:	89 f7                	mov    %esi,%edi
+  8027bf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8027c3:	f7 db                	neg    %ebx
+  8027c5:	83 d7 00             	adc    $0x0,%edi
+  8027c8:	f7 df                	neg    %edi
+  8027ca:	0f 49 f7             	cmovns %edi,%esi
+  8027cd:	0f 49 cb             	cmovns %ebx,%ecx
+  8027d0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8027d4:	89 0c 24             	mov    %ecx,(%esp)
+  8027d7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027dc:	89 cd                	mov    %ecx,%ebp
+  8027de:	66 90                	xchg   %ax,%ax
+  8027e0:	89 e9                	mov    %ebp,%ecx
+  8027e2:	89 c3                	mov    %eax,%ebx
+  8027e4:	89 d6                	mov    %edx,%esi
+  8027e6:	31 ff                	xor    %edi,%edi
+  8027e8:	d3 ee                	shr    %cl,%esi
+  8027ea:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8027ed:	f6 c1 20             	test   $0x20,%cl
+  8027f0:	0f 45 de             	cmovne %esi,%ebx
+  8027f3:	0f 45 f7             	cmovne %edi,%esi
+  8027f6:	8b 3c 24             	mov    (%esp),%edi
+  8027f9:	39 fb                	cmp    %edi,%ebx
+  8027fb:	89 f7                	mov    %esi,%edi
+  8027fd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802801:	8b 1c 24             	mov    (%esp),%ebx
+  802804:	19 f7                	sbb    %esi,%edi
+  802806:	72 1a                	jb     802822 <__moddi3+0x92>
+  802808:	89 e9                	mov    %ebp,%ecx
+  80280a:	89 f7                	mov    %esi,%edi
+  80280c:	89 de                	mov    %ebx,%esi
+  80280e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802811:	d3 e6                	shl    %cl,%esi
+  802813:	31 db                	xor    %ebx,%ebx
+  802815:	f6 c1 20             	test   $0x20,%cl
+  802818:	0f 45 fe             	cmovne %esi,%edi
+  80281b:	0f 45 f3             	cmovne %ebx,%esi
+  80281e:	29 f0                	sub    %esi,%eax
+  802820:	19 fa                	sbb    %edi,%edx
+  802822:	83 ed 01             	sub    $0x1,%ebp
+  802825:	73 b9                	jae    8027e0 <__moddi3+0x50>
+  802827:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80282b:	85 ed                	test   %ebp,%ebp
+  80282d:	74 07                	je     802836 <__moddi3+0xa6>
+  80282f:	f7 d8                	neg    %eax
+  802831:	83 d2 00             	adc    $0x0,%edx
+  802834:	f7 da                	neg    %edx
+  802836:	83 c4 14             	add    $0x14,%esp
+  802839:	5b                   	pop    %ebx
+  80283a:	5e                   	pop    %esi
+  80283b:	5f                   	pop    %edi
+  80283c:	5d                   	pop    %ebp
+  80283d:	c3                   	ret
+  80283e:	83 c4 14             	add    $0x14,%esp
+  802841:	31 c0                	xor    %eax,%eax
+  802843:	31 d2                	xor    %edx,%edx
+  802845:	5b                   	pop    %ebx
+  802846:	5e                   	pop    %esi
+  802847:	5f                   	pop    %edi
+  802848:	5d                   	pop    %ebp
+  802849:	c3                   	ret
+  80284a:	89 f7                	mov    %esi,%edi
+  80284c:	09 cf                	or     %ecx,%edi
+  80284e:	74 11                	je     802861 <__moddi3+0xd1>
+  802850:	f7 d8                	neg    %eax
+  802852:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802857:	83 d2 00             	adc    $0x0,%edx
+  80285a:	f7 da                	neg    %edx
+  80285c:	e9 5a ff ff ff       	jmp    8027bb <__moddi3+0x2b>
+  802861:	31 c0                	xor    %eax,%eax
+  802863:	31 d2                	xor    %edx,%edx
+  802865:	eb c8                	jmp    80282f <__moddi3+0x9f>
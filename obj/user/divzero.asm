@@ -0,0 +1,5562 @@
+
+obj/user/divzero.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+int zero;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	zero = 0;
+  800039:	c7 05 08 40 80 00 00 	movl   $0x0,0x804008
+  800040:	00 00 00 
+	cprintf("1/0 is %08x!\n", 1/zero);
+  800043:	6a 00                	push   $0x0
+  800045:	68 80 26 80 00       	push   $0x802680
+  80004a:	e8 fa 00 00 00       	call   800149 <cprintf>
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80005f:	e8 a1 0a 00 00       	call   800b05 <sys_getenvid>
+  800064:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800069:	c1 e0 09             	shl    $0x9,%eax
+  80006c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800071:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800076:	85 db                	test   %ebx,%ebx
+  800078:	7e 07                	jle    800081 <libmain+0x2d>
+		binaryname = argv[0];
+  80007a:	8b 06                	mov    (%esi),%eax
+  80007c:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800081:	83 ec 08             	sub    $0x8,%esp
+  800084:	56                   	push   %esi
+  800085:	53                   	push   %ebx
+  800086:	e8 a8 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80008b:	e8 0a 00 00 00       	call   80009a <exit>
+}
+  800090:	83 c4 10             	add    $0x10,%esp
+  800093:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800096:	5b                   	pop    %ebx
+  800097:	5e                   	pop    %esi
+  800098:	5d                   	pop    %ebp
+  800099:	c3                   	ret
+
+0080009a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000a0:	e8 f8 10 00 00       	call   80119d <close_all>
+	sys_env_destroy(0);
+  8000a5:	83 ec 0c             	sub    $0xc,%esp
+  8000a8:	6a 00                	push   $0x0
+  8000aa:	e8 15 0a 00 00       	call   800ac4 <sys_env_destroy>
+}
+  8000af:	83 c4 10             	add    $0x10,%esp
+  8000b2:	c9                   	leave
+  8000b3:	c3                   	ret
+
+008000b4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000b4:	55                   	push   %ebp
+  8000b5:	89 e5                	mov    %esp,%ebp
+  8000b7:	53                   	push   %ebx
+  8000b8:	83 ec 04             	sub    $0x4,%esp
+  8000bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000be:	8b 13                	mov    (%ebx),%edx
+  8000c0:	8d 42 01             	lea    0x1(%edx),%eax
+  8000c3:	89 03                	mov    %eax,(%ebx)
+  8000c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000c8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000cc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000d1:	74 09                	je     8000dc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000d3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000da:	c9                   	leave
+  8000db:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000dc:	83 ec 08             	sub    $0x8,%esp
+  8000df:	68 ff 00 00 00       	push   $0xff
+  8000e4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000e7:	50                   	push   %eax
+  8000e8:	e8 7a 09 00 00       	call   800a67 <sys_cputs>
+		b->idx = 0;
+  8000ed:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000f3:	83 c4 10             	add    $0x10,%esp
+  8000f6:	eb db                	jmp    8000d3 <putch+0x1f>
+
+008000f8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000f8:	55                   	push   %ebp
+  8000f9:	89 e5                	mov    %esp,%ebp
+  8000fb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800101:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800108:	00 00 00 
+	b.cnt = 0;
+  80010b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800112:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800115:	ff 75 0c             	push   0xc(%ebp)
+  800118:	ff 75 08             	push   0x8(%ebp)
+  80011b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800121:	50                   	push   %eax
+  800122:	68 b4 00 80 00       	push   $0x8000b4
+  800127:	e8 14 01 00 00       	call   800240 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80012c:	83 c4 08             	add    $0x8,%esp
+  80012f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800135:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80013b:	50                   	push   %eax
+  80013c:	e8 26 09 00 00       	call   800a67 <sys_cputs>
+
+	return b.cnt;
+}
+  800141:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800147:	c9                   	leave
+  800148:	c3                   	ret
+
+00800149 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800149:	55                   	push   %ebp
+  80014a:	89 e5                	mov    %esp,%ebp
+  80014c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80014f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800152:	50                   	push   %eax
+  800153:	ff 75 08             	push   0x8(%ebp)
+  800156:	e8 9d ff ff ff       	call   8000f8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80015b:	c9                   	leave
+  80015c:	c3                   	ret
+
+0080015d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	57                   	push   %edi
+  800161:	56                   	push   %esi
+  800162:	53                   	push   %ebx
+  800163:	83 ec 1c             	sub    $0x1c,%esp
+  800166:	89 c7                	mov    %eax,%edi
+  800168:	89 d6                	mov    %edx,%esi
+  80016a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80016d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800170:	89 d1                	mov    %edx,%ecx
+  800172:	89 c2                	mov    %eax,%edx
+  800174:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800177:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80017a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800180:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800183:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80018a:	39 c2                	cmp    %eax,%edx
+  80018c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80018f:	72 3e                	jb     8001cf <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800191:	83 ec 0c             	sub    $0xc,%esp
+  800194:	ff 75 18             	push   0x18(%ebp)
+  800197:	83 eb 01             	sub    $0x1,%ebx
+  80019a:	53                   	push   %ebx
+  80019b:	50                   	push   %eax
+  80019c:	83 ec 08             	sub    $0x8,%esp
+  80019f:	ff 75 e4             	push   -0x1c(%ebp)
+  8001a2:	ff 75 e0             	push   -0x20(%ebp)
+  8001a5:	ff 75 dc             	push   -0x24(%ebp)
+  8001a8:	ff 75 d8             	push   -0x28(%ebp)
+  8001ab:	e8 60 21 00 00       	call   802310 <__udivdi3>
+  8001b0:	83 c4 18             	add    $0x18,%esp
+  8001b3:	52                   	push   %edx
+  8001b4:	50                   	push   %eax
+  8001b5:	89 f2                	mov    %esi,%edx
+  8001b7:	89 f8                	mov    %edi,%eax
+  8001b9:	e8 9f ff ff ff       	call   80015d <printnum>
+  8001be:	83 c4 20             	add    $0x20,%esp
+  8001c1:	eb 13                	jmp    8001d6 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001c3:	83 ec 08             	sub    $0x8,%esp
+  8001c6:	56                   	push   %esi
+  8001c7:	ff 75 18             	push   0x18(%ebp)
+  8001ca:	ff d7                	call   *%edi
+  8001cc:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001cf:	83 eb 01             	sub    $0x1,%ebx
+  8001d2:	85 db                	test   %ebx,%ebx
+  8001d4:	7f ed                	jg     8001c3 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001d6:	83 ec 08             	sub    $0x8,%esp
+  8001d9:	56                   	push   %esi
+  8001da:	83 ec 04             	sub    $0x4,%esp
+  8001dd:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e0:	ff 75 e0             	push   -0x20(%ebp)
+  8001e3:	ff 75 dc             	push   -0x24(%ebp)
+  8001e6:	ff 75 d8             	push   -0x28(%ebp)
+  8001e9:	e8 e2 21 00 00       	call   8023d0 <__umoddi3>
+  8001ee:	83 c4 14             	add    $0x14,%esp
+  8001f1:	0f be 80 98 26 80 00 	movsbl 0x802698(%eax),%eax
+  8001f8:	50                   	push   %eax
+  8001f9:	ff d7                	call   *%edi
+}
+  8001fb:	83 c4 10             	add    $0x10,%esp
+  8001fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800201:	5b                   	pop    %ebx
+  800202:	5e                   	pop    %esi
+  800203:	5f                   	pop    %edi
+  800204:	5d                   	pop    %ebp
+  800205:	c3                   	ret
+
+00800206 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800206:	55                   	push   %ebp
+  800207:	89 e5                	mov    %esp,%ebp
+  800209:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80020c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800210:	8b 10                	mov    (%eax),%edx
+  800212:	3b 50 04             	cmp    0x4(%eax),%edx
+  800215:	73 0a                	jae    800221 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800217:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80021a:	89 08                	mov    %ecx,(%eax)
+  80021c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021f:	88 02                	mov    %al,(%edx)
+}
+  800221:	5d                   	pop    %ebp
+  800222:	c3                   	ret
+
+00800223 <printfmt>:
+{
+  800223:	55                   	push   %ebp
+  800224:	89 e5                	mov    %esp,%ebp
+  800226:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800229:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80022c:	50                   	push   %eax
+  80022d:	ff 75 10             	push   0x10(%ebp)
+  800230:	ff 75 0c             	push   0xc(%ebp)
+  800233:	ff 75 08             	push   0x8(%ebp)
+  800236:	e8 05 00 00 00       	call   800240 <vprintfmt>
+}
+  80023b:	83 c4 10             	add    $0x10,%esp
+  80023e:	c9                   	leave
+  80023f:	c3                   	ret
+
+00800240 <vprintfmt>:
+{
+  800240:	55                   	push   %ebp
+  800241:	89 e5                	mov    %esp,%ebp
+  800243:	57                   	push   %edi
+  800244:	56                   	push   %esi
+  800245:	53                   	push   %ebx
+  800246:	83 ec 2c             	sub    $0x2c,%esp
+  800249:	8b 75 08             	mov    0x8(%ebp),%esi
+  80024c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80024f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800252:	eb 0a                	jmp    80025e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800254:	83 ec 08             	sub    $0x8,%esp
+  800257:	53                   	push   %ebx
+  800258:	50                   	push   %eax
+  800259:	ff d6                	call   *%esi
+  80025b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80025e:	83 c7 01             	add    $0x1,%edi
+  800261:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800265:	83 f8 25             	cmp    $0x25,%eax
+  800268:	74 0c                	je     800276 <vprintfmt+0x36>
+			if (ch == '\0')
+  80026a:	85 c0                	test   %eax,%eax
+  80026c:	75 e6                	jne    800254 <vprintfmt+0x14>
+}
+  80026e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800271:	5b                   	pop    %ebx
+  800272:	5e                   	pop    %esi
+  800273:	5f                   	pop    %edi
+  800274:	5d                   	pop    %ebp
+  800275:	c3                   	ret
+		padc = ' ';
+  800276:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80027a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800281:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800288:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80028f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800294:	8d 47 01             	lea    0x1(%edi),%eax
+  800297:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80029a:	0f b6 17             	movzbl (%edi),%edx
+  80029d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002a0:	3c 55                	cmp    $0x55,%al
+  8002a2:	0f 87 cf 03 00 00    	ja     800677 <vprintfmt+0x437>
+  8002a8:	0f b6 c0             	movzbl %al,%eax
+  8002ab:	ff 24 85 e0 27 80 00 	jmp    *0x8027e0(,%eax,4)
+  8002b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002b5:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002b9:	eb d9                	jmp    800294 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002be:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002c2:	eb d0                	jmp    800294 <vprintfmt+0x54>
+  8002c4:	0f b6 d2             	movzbl %dl,%edx
+  8002c7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002d2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002d5:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002d9:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002dc:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002df:	83 f9 09             	cmp    $0x9,%ecx
+  8002e2:	77 55                	ja     800339 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002e4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002e7:	eb e9                	jmp    8002d2 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ec:	8b 00                	mov    (%eax),%eax
+  8002ee:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f4:	8d 40 04             	lea    0x4(%eax),%eax
+  8002f7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8002fd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800301:	79 91                	jns    800294 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800303:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800306:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800309:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800310:	eb 82                	jmp    800294 <vprintfmt+0x54>
+			if (width < 0)
+  800312:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800315:	85 d2                	test   %edx,%edx
+  800317:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031c:	0f 49 c2             	cmovns %edx,%eax
+  80031f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800322:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800325:	e9 6a ff ff ff       	jmp    800294 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80032d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800334:	e9 5b ff ff ff       	jmp    800294 <vprintfmt+0x54>
+  800339:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80033c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80033f:	eb bc                	jmp    8002fd <vprintfmt+0xbd>
+			lflag++;
+  800341:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800344:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800347:	e9 48 ff ff ff       	jmp    800294 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80034c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80034f:	8d 78 04             	lea    0x4(%eax),%edi
+  800352:	83 ec 08             	sub    $0x8,%esp
+  800355:	53                   	push   %ebx
+  800356:	ff 30                	push   (%eax)
+  800358:	ff d6                	call   *%esi
+			break;
+  80035a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80035d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800360:	e9 b1 02 00 00       	jmp    800616 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800365:	8b 45 14             	mov    0x14(%ebp),%eax
+  800368:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80036b:	8b 10                	mov    (%eax),%edx
+  80036d:	89 d0                	mov    %edx,%eax
+  80036f:	f7 d8                	neg    %eax
+  800371:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800374:	83 f8 0f             	cmp    $0xf,%eax
+  800377:	7f 23                	jg     80039c <vprintfmt+0x15c>
+  800379:	8b 14 85 40 29 80 00 	mov    0x802940(,%eax,4),%edx
+  800380:	85 d2                	test   %edx,%edx
+  800382:	74 18                	je     80039c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800384:	52                   	push   %edx
+  800385:	68 75 2a 80 00       	push   $0x802a75
+  80038a:	53                   	push   %ebx
+  80038b:	56                   	push   %esi
+  80038c:	e8 92 fe ff ff       	call   800223 <printfmt>
+  800391:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800394:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800397:	e9 7a 02 00 00       	jmp    800616 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80039c:	50                   	push   %eax
+  80039d:	68 b0 26 80 00       	push   $0x8026b0
+  8003a2:	53                   	push   %ebx
+  8003a3:	56                   	push   %esi
+  8003a4:	e8 7a fe ff ff       	call   800223 <printfmt>
+  8003a9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003ac:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003af:	e9 62 02 00 00       	jmp    800616 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b7:	83 c0 04             	add    $0x4,%eax
+  8003ba:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c0:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003c2:	85 c9                	test   %ecx,%ecx
+  8003c4:	b8 a9 26 80 00       	mov    $0x8026a9,%eax
+  8003c9:	0f 45 c1             	cmovne %ecx,%eax
+  8003cc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003cf:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d3:	7e 06                	jle    8003db <vprintfmt+0x19b>
+  8003d5:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003d9:	75 0b                	jne    8003e6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003db:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003de:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003e1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003e4:	eb 5c                	jmp    800442 <vprintfmt+0x202>
+  8003e6:	83 ec 08             	sub    $0x8,%esp
+  8003e9:	ff 75 d0             	push   -0x30(%ebp)
+  8003ec:	ff 75 cc             	push   -0x34(%ebp)
+  8003ef:	e8 20 03 00 00       	call   800714 <strnlen>
+  8003f4:	89 c2                	mov    %eax,%edx
+  8003f6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003f9:	29 d0                	sub    %edx,%eax
+  8003fb:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8003fe:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800402:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800405:	89 75 08             	mov    %esi,0x8(%ebp)
+  800408:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040a:	eb 0e                	jmp    80041a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80040c:	83 ec 08             	sub    $0x8,%esp
+  80040f:	53                   	push   %ebx
+  800410:	57                   	push   %edi
+  800411:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800414:	83 ee 01             	sub    $0x1,%esi
+  800417:	83 c4 10             	add    $0x10,%esp
+  80041a:	85 f6                	test   %esi,%esi
+  80041c:	7f ee                	jg     80040c <vprintfmt+0x1cc>
+  80041e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800421:	8b 75 08             	mov    0x8(%ebp),%esi
+  800424:	85 c0                	test   %eax,%eax
+  800426:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042b:	0f 49 d0             	cmovns %eax,%edx
+  80042e:	29 d0                	sub    %edx,%eax
+  800430:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800433:	eb a6                	jmp    8003db <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800435:	83 ec 08             	sub    $0x8,%esp
+  800438:	53                   	push   %ebx
+  800439:	52                   	push   %edx
+  80043a:	ff 55 08             	call   *0x8(%ebp)
+  80043d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800440:	89 f1                	mov    %esi,%ecx
+  800442:	8d 71 01             	lea    0x1(%ecx),%esi
+  800445:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800449:	0f be d0             	movsbl %al,%edx
+  80044c:	85 d2                	test   %edx,%edx
+  80044e:	74 28                	je     800478 <vprintfmt+0x238>
+  800450:	85 ff                	test   %edi,%edi
+  800452:	78 05                	js     800459 <vprintfmt+0x219>
+  800454:	83 ef 01             	sub    $0x1,%edi
+  800457:	78 30                	js     800489 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800459:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80045d:	74 d6                	je     800435 <vprintfmt+0x1f5>
+  80045f:	0f be c0             	movsbl %al,%eax
+  800462:	83 e8 20             	sub    $0x20,%eax
+  800465:	83 f8 5e             	cmp    $0x5e,%eax
+  800468:	76 cb                	jbe    800435 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80046a:	83 ec 08             	sub    $0x8,%esp
+  80046d:	53                   	push   %ebx
+  80046e:	6a 3f                	push   $0x3f
+  800470:	ff 55 08             	call   *0x8(%ebp)
+  800473:	83 c4 10             	add    $0x10,%esp
+  800476:	eb c8                	jmp    800440 <vprintfmt+0x200>
+  800478:	8b 75 08             	mov    0x8(%ebp),%esi
+  80047b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80047e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800481:	01 d0                	add    %edx,%eax
+  800483:	29 c8                	sub    %ecx,%eax
+  800485:	89 c7                	mov    %eax,%edi
+  800487:	eb 13                	jmp    80049c <vprintfmt+0x25c>
+  800489:	8b 75 08             	mov    0x8(%ebp),%esi
+  80048c:	eb ed                	jmp    80047b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80048e:	83 ec 08             	sub    $0x8,%esp
+  800491:	53                   	push   %ebx
+  800492:	6a 20                	push   $0x20
+  800494:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800496:	83 ef 01             	sub    $0x1,%edi
+  800499:	83 c4 10             	add    $0x10,%esp
+  80049c:	85 ff                	test   %edi,%edi
+  80049e:	7f ee                	jg     80048e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004a0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a6:	e9 6b 01 00 00       	jmp    800616 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004ab:	83 f9 01             	cmp    $0x1,%ecx
+  8004ae:	7f 1f                	jg     8004cf <vprintfmt+0x28f>
+	else if (lflag)
+  8004b0:	85 c9                	test   %ecx,%ecx
+  8004b2:	74 67                	je     80051b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b7:	8b 00                	mov    (%eax),%eax
+  8004b9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004bc:	89 c1                	mov    %eax,%ecx
+  8004be:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004c1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8004ca:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004cd:	eb 17                	jmp    8004e6 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d2:	8b 50 04             	mov    0x4(%eax),%edx
+  8004d5:	8b 00                	mov    (%eax),%eax
+  8004d7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004da:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e0:	8d 40 08             	lea    0x8(%eax),%eax
+  8004e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004e6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004e9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004ec:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004f1:	85 c9                	test   %ecx,%ecx
+  8004f3:	0f 89 03 01 00 00    	jns    8005fc <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8004f9:	83 ec 08             	sub    $0x8,%esp
+  8004fc:	53                   	push   %ebx
+  8004fd:	6a 2d                	push   $0x2d
+  8004ff:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800501:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800504:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800507:	f7 da                	neg    %edx
+  800509:	83 d1 00             	adc    $0x0,%ecx
+  80050c:	f7 d9                	neg    %ecx
+  80050e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800511:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800516:	e9 e1 00 00 00       	jmp    8005fc <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80051b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051e:	8b 00                	mov    (%eax),%eax
+  800520:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800523:	89 c1                	mov    %eax,%ecx
+  800525:	c1 f9 1f             	sar    $0x1f,%ecx
+  800528:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80052b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052e:	8d 40 04             	lea    0x4(%eax),%eax
+  800531:	89 45 14             	mov    %eax,0x14(%ebp)
+  800534:	eb b0                	jmp    8004e6 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800536:	83 f9 01             	cmp    $0x1,%ecx
+  800539:	7f 1e                	jg     800559 <vprintfmt+0x319>
+	else if (lflag)
+  80053b:	85 c9                	test   %ecx,%ecx
+  80053d:	74 32                	je     800571 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80053f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800542:	8b 10                	mov    (%eax),%edx
+  800544:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800549:	8d 40 04             	lea    0x4(%eax),%eax
+  80054c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80054f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800554:	e9 a3 00 00 00       	jmp    8005fc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800559:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055c:	8b 10                	mov    (%eax),%edx
+  80055e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800561:	8d 40 08             	lea    0x8(%eax),%eax
+  800564:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800567:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80056c:	e9 8b 00 00 00       	jmp    8005fc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800571:	8b 45 14             	mov    0x14(%ebp),%eax
+  800574:	8b 10                	mov    (%eax),%edx
+  800576:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80057b:	8d 40 04             	lea    0x4(%eax),%eax
+  80057e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800581:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800586:	eb 74                	jmp    8005fc <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800588:	83 f9 01             	cmp    $0x1,%ecx
+  80058b:	7f 1b                	jg     8005a8 <vprintfmt+0x368>
+	else if (lflag)
+  80058d:	85 c9                	test   %ecx,%ecx
+  80058f:	74 2c                	je     8005bd <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8b 10                	mov    (%eax),%edx
+  800596:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80059b:	8d 40 04             	lea    0x4(%eax),%eax
+  80059e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005a1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005a6:	eb 54                	jmp    8005fc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ab:	8b 10                	mov    (%eax),%edx
+  8005ad:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005b0:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005b6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005bb:	eb 3f                	jmp    8005fc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8b 10                	mov    (%eax),%edx
+  8005c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005cd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005d2:	eb 28                	jmp    8005fc <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005d4:	83 ec 08             	sub    $0x8,%esp
+  8005d7:	53                   	push   %ebx
+  8005d8:	6a 30                	push   $0x30
+  8005da:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005dc:	83 c4 08             	add    $0x8,%esp
+  8005df:	53                   	push   %ebx
+  8005e0:	6a 78                	push   $0x78
+  8005e2:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8b 10                	mov    (%eax),%edx
+  8005e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005ee:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005f7:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005fc:	83 ec 0c             	sub    $0xc,%esp
+  8005ff:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800603:	50                   	push   %eax
+  800604:	ff 75 e0             	push   -0x20(%ebp)
+  800607:	57                   	push   %edi
+  800608:	51                   	push   %ecx
+  800609:	52                   	push   %edx
+  80060a:	89 da                	mov    %ebx,%edx
+  80060c:	89 f0                	mov    %esi,%eax
+  80060e:	e8 4a fb ff ff       	call   80015d <printnum>
+			break;
+  800613:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800616:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800619:	e9 40 fc ff ff       	jmp    80025e <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80061e:	83 f9 01             	cmp    $0x1,%ecx
+  800621:	7f 1b                	jg     80063e <vprintfmt+0x3fe>
+	else if (lflag)
+  800623:	85 c9                	test   %ecx,%ecx
+  800625:	74 2c                	je     800653 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800627:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062a:	8b 10                	mov    (%eax),%edx
+  80062c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800631:	8d 40 04             	lea    0x4(%eax),%eax
+  800634:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800637:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80063c:	eb be                	jmp    8005fc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80063e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800641:	8b 10                	mov    (%eax),%edx
+  800643:	8b 48 04             	mov    0x4(%eax),%ecx
+  800646:	8d 40 08             	lea    0x8(%eax),%eax
+  800649:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80064c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800651:	eb a9                	jmp    8005fc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800653:	8b 45 14             	mov    0x14(%ebp),%eax
+  800656:	8b 10                	mov    (%eax),%edx
+  800658:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065d:	8d 40 04             	lea    0x4(%eax),%eax
+  800660:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800663:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800668:	eb 92                	jmp    8005fc <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80066a:	83 ec 08             	sub    $0x8,%esp
+  80066d:	53                   	push   %ebx
+  80066e:	6a 25                	push   $0x25
+  800670:	ff d6                	call   *%esi
+			break;
+  800672:	83 c4 10             	add    $0x10,%esp
+  800675:	eb 9f                	jmp    800616 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800677:	83 ec 08             	sub    $0x8,%esp
+  80067a:	53                   	push   %ebx
+  80067b:	6a 25                	push   $0x25
+  80067d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	89 f8                	mov    %edi,%eax
+  800684:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800688:	74 05                	je     80068f <vprintfmt+0x44f>
+  80068a:	83 e8 01             	sub    $0x1,%eax
+  80068d:	eb f5                	jmp    800684 <vprintfmt+0x444>
+  80068f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800692:	eb 82                	jmp    800616 <vprintfmt+0x3d6>
+
+00800694 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800694:	55                   	push   %ebp
+  800695:	89 e5                	mov    %esp,%ebp
+  800697:	83 ec 18             	sub    $0x18,%esp
+  80069a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80069d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006a0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006a3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006a7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006aa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006b1:	85 c0                	test   %eax,%eax
+  8006b3:	74 26                	je     8006db <vsnprintf+0x47>
+  8006b5:	85 d2                	test   %edx,%edx
+  8006b7:	7e 22                	jle    8006db <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006b9:	ff 75 14             	push   0x14(%ebp)
+  8006bc:	ff 75 10             	push   0x10(%ebp)
+  8006bf:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006c2:	50                   	push   %eax
+  8006c3:	68 06 02 80 00       	push   $0x800206
+  8006c8:	e8 73 fb ff ff       	call   800240 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006cd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006d0:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006d6:	83 c4 10             	add    $0x10,%esp
+}
+  8006d9:	c9                   	leave
+  8006da:	c3                   	ret
+		return -E_INVAL;
+  8006db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006e0:	eb f7                	jmp    8006d9 <vsnprintf+0x45>
+
+008006e2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006e2:	55                   	push   %ebp
+  8006e3:	89 e5                	mov    %esp,%ebp
+  8006e5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006e8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006eb:	50                   	push   %eax
+  8006ec:	ff 75 10             	push   0x10(%ebp)
+  8006ef:	ff 75 0c             	push   0xc(%ebp)
+  8006f2:	ff 75 08             	push   0x8(%ebp)
+  8006f5:	e8 9a ff ff ff       	call   800694 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006fa:	c9                   	leave
+  8006fb:	c3                   	ret
+
+008006fc <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006fc:	55                   	push   %ebp
+  8006fd:	89 e5                	mov    %esp,%ebp
+  8006ff:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800702:	b8 00 00 00 00       	mov    $0x0,%eax
+  800707:	eb 03                	jmp    80070c <strlen+0x10>
+		n++;
+  800709:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80070c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800710:	75 f7                	jne    800709 <strlen+0xd>
+	return n;
+}
+  800712:	5d                   	pop    %ebp
+  800713:	c3                   	ret
+
+00800714 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800714:	55                   	push   %ebp
+  800715:	89 e5                	mov    %esp,%ebp
+  800717:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80071a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80071d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800722:	eb 03                	jmp    800727 <strnlen+0x13>
+		n++;
+  800724:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800727:	39 d0                	cmp    %edx,%eax
+  800729:	74 08                	je     800733 <strnlen+0x1f>
+  80072b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80072f:	75 f3                	jne    800724 <strnlen+0x10>
+  800731:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800733:	89 d0                	mov    %edx,%eax
+  800735:	5d                   	pop    %ebp
+  800736:	c3                   	ret
+
+00800737 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800737:	55                   	push   %ebp
+  800738:	89 e5                	mov    %esp,%ebp
+  80073a:	53                   	push   %ebx
+  80073b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80073e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800741:	b8 00 00 00 00       	mov    $0x0,%eax
+  800746:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80074a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80074d:	83 c0 01             	add    $0x1,%eax
+  800750:	84 d2                	test   %dl,%dl
+  800752:	75 f2                	jne    800746 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800754:	89 c8                	mov    %ecx,%eax
+  800756:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800759:	c9                   	leave
+  80075a:	c3                   	ret
+
+0080075b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80075b:	55                   	push   %ebp
+  80075c:	89 e5                	mov    %esp,%ebp
+  80075e:	53                   	push   %ebx
+  80075f:	83 ec 10             	sub    $0x10,%esp
+  800762:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800765:	53                   	push   %ebx
+  800766:	e8 91 ff ff ff       	call   8006fc <strlen>
+  80076b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80076e:	ff 75 0c             	push   0xc(%ebp)
+  800771:	01 d8                	add    %ebx,%eax
+  800773:	50                   	push   %eax
+  800774:	e8 be ff ff ff       	call   800737 <strcpy>
+	return dst;
+}
+  800779:	89 d8                	mov    %ebx,%eax
+  80077b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80077e:	c9                   	leave
+  80077f:	c3                   	ret
+
+00800780 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800780:	55                   	push   %ebp
+  800781:	89 e5                	mov    %esp,%ebp
+  800783:	56                   	push   %esi
+  800784:	53                   	push   %ebx
+  800785:	8b 75 08             	mov    0x8(%ebp),%esi
+  800788:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80078b:	89 f3                	mov    %esi,%ebx
+  80078d:	03 5d 10             	add    0x10(%ebp),%ebx
+  800790:	89 f0                	mov    %esi,%eax
+  800792:	eb 0f                	jmp    8007a3 <strncpy+0x23>
+		*dst++ = *src;
+  800794:	83 c0 01             	add    $0x1,%eax
+  800797:	0f b6 0a             	movzbl (%edx),%ecx
+  80079a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80079d:	80 f9 01             	cmp    $0x1,%cl
+  8007a0:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007a3:	39 d8                	cmp    %ebx,%eax
+  8007a5:	75 ed                	jne    800794 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007a7:	89 f0                	mov    %esi,%eax
+  8007a9:	5b                   	pop    %ebx
+  8007aa:	5e                   	pop    %esi
+  8007ab:	5d                   	pop    %ebp
+  8007ac:	c3                   	ret
+
+008007ad <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007ad:	55                   	push   %ebp
+  8007ae:	89 e5                	mov    %esp,%ebp
+  8007b0:	56                   	push   %esi
+  8007b1:	53                   	push   %ebx
+  8007b2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b8:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007bb:	89 f0                	mov    %esi,%eax
+  8007bd:	85 d2                	test   %edx,%edx
+  8007bf:	74 21                	je     8007e2 <strlcpy+0x35>
+  8007c1:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007c5:	89 f2                	mov    %esi,%edx
+  8007c7:	eb 09                	jmp    8007d2 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007c9:	83 c1 01             	add    $0x1,%ecx
+  8007cc:	83 c2 01             	add    $0x1,%edx
+  8007cf:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007d2:	39 c2                	cmp    %eax,%edx
+  8007d4:	74 09                	je     8007df <strlcpy+0x32>
+  8007d6:	0f b6 19             	movzbl (%ecx),%ebx
+  8007d9:	84 db                	test   %bl,%bl
+  8007db:	75 ec                	jne    8007c9 <strlcpy+0x1c>
+  8007dd:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007df:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007e2:	29 f0                	sub    %esi,%eax
+}
+  8007e4:	5b                   	pop    %ebx
+  8007e5:	5e                   	pop    %esi
+  8007e6:	5d                   	pop    %ebp
+  8007e7:	c3                   	ret
+
+008007e8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007e8:	55                   	push   %ebp
+  8007e9:	89 e5                	mov    %esp,%ebp
+  8007eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007f1:	eb 06                	jmp    8007f9 <strcmp+0x11>
+		p++, q++;
+  8007f3:	83 c1 01             	add    $0x1,%ecx
+  8007f6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007f9:	0f b6 01             	movzbl (%ecx),%eax
+  8007fc:	84 c0                	test   %al,%al
+  8007fe:	74 04                	je     800804 <strcmp+0x1c>
+  800800:	3a 02                	cmp    (%edx),%al
+  800802:	74 ef                	je     8007f3 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800804:	0f b6 c0             	movzbl %al,%eax
+  800807:	0f b6 12             	movzbl (%edx),%edx
+  80080a:	29 d0                	sub    %edx,%eax
+}
+  80080c:	5d                   	pop    %ebp
+  80080d:	c3                   	ret
+
+0080080e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80080e:	55                   	push   %ebp
+  80080f:	89 e5                	mov    %esp,%ebp
+  800811:	53                   	push   %ebx
+  800812:	8b 45 08             	mov    0x8(%ebp),%eax
+  800815:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800818:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80081b:	eb 09                	jmp    800826 <strncmp+0x18>
+		n--, p++, q++;
+  80081d:	83 ea 01             	sub    $0x1,%edx
+  800820:	83 c0 01             	add    $0x1,%eax
+  800823:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800826:	85 d2                	test   %edx,%edx
+  800828:	74 18                	je     800842 <strncmp+0x34>
+  80082a:	0f b6 18             	movzbl (%eax),%ebx
+  80082d:	84 db                	test   %bl,%bl
+  80082f:	74 04                	je     800835 <strncmp+0x27>
+  800831:	3a 19                	cmp    (%ecx),%bl
+  800833:	74 e8                	je     80081d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800835:	0f b6 00             	movzbl (%eax),%eax
+  800838:	0f b6 11             	movzbl (%ecx),%edx
+  80083b:	29 d0                	sub    %edx,%eax
+}
+  80083d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800840:	c9                   	leave
+  800841:	c3                   	ret
+		return 0;
+  800842:	b8 00 00 00 00       	mov    $0x0,%eax
+  800847:	eb f4                	jmp    80083d <strncmp+0x2f>
+
+00800849 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800849:	55                   	push   %ebp
+  80084a:	89 e5                	mov    %esp,%ebp
+  80084c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800853:	eb 03                	jmp    800858 <strchr+0xf>
+  800855:	83 c0 01             	add    $0x1,%eax
+  800858:	0f b6 10             	movzbl (%eax),%edx
+  80085b:	84 d2                	test   %dl,%dl
+  80085d:	74 06                	je     800865 <strchr+0x1c>
+		if (*s == c)
+  80085f:	38 ca                	cmp    %cl,%dl
+  800861:	75 f2                	jne    800855 <strchr+0xc>
+  800863:	eb 05                	jmp    80086a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800865:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80086a:	5d                   	pop    %ebp
+  80086b:	c3                   	ret
+
+0080086c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80086c:	55                   	push   %ebp
+  80086d:	89 e5                	mov    %esp,%ebp
+  80086f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800872:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800876:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800879:	38 ca                	cmp    %cl,%dl
+  80087b:	74 09                	je     800886 <strfind+0x1a>
+  80087d:	84 d2                	test   %dl,%dl
+  80087f:	74 05                	je     800886 <strfind+0x1a>
+	for (; *s; s++)
+  800881:	83 c0 01             	add    $0x1,%eax
+  800884:	eb f0                	jmp    800876 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800886:	5d                   	pop    %ebp
+  800887:	c3                   	ret
+
+00800888 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	57                   	push   %edi
+  80088c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80088f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800892:	85 c9                	test   %ecx,%ecx
+  800894:	74 20                	je     8008b6 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800896:	89 f8                	mov    %edi,%eax
+  800898:	09 c8                	or     %ecx,%eax
+  80089a:	a8 03                	test   $0x3,%al
+  80089c:	75 12                	jne    8008b0 <memset+0x28>
+		c &= 0xFF;
+  80089e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008a2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008a8:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008ab:	fc                   	cld
+  8008ac:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008ae:	eb 06                	jmp    8008b6 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008b3:	fc                   	cld
+  8008b4:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008b6:	89 f8                	mov    %edi,%eax
+  8008b8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008bb:	c9                   	leave
+  8008bc:	c3                   	ret
+
+008008bd <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	57                   	push   %edi
+  8008c1:	56                   	push   %esi
+  8008c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008c8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008cb:	39 c6                	cmp    %eax,%esi
+  8008cd:	73 32                	jae    800901 <memmove+0x44>
+  8008cf:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008d2:	39 d0                	cmp    %edx,%eax
+  8008d4:	73 2b                	jae    800901 <memmove+0x44>
+		s += n;
+		d += n;
+  8008d6:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008d9:	89 d6                	mov    %edx,%esi
+  8008db:	09 fe                	or     %edi,%esi
+  8008dd:	09 ce                	or     %ecx,%esi
+  8008df:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008e5:	75 0e                	jne    8008f5 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008e7:	83 ef 04             	sub    $0x4,%edi
+  8008ea:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008ed:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008f0:	fd                   	std
+  8008f1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008f3:	eb 09                	jmp    8008fe <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008f5:	83 ef 01             	sub    $0x1,%edi
+  8008f8:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008fb:	fd                   	std
+  8008fc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008fe:	fc                   	cld
+  8008ff:	eb 1a                	jmp    80091b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800901:	89 f2                	mov    %esi,%edx
+  800903:	09 c2                	or     %eax,%edx
+  800905:	09 ca                	or     %ecx,%edx
+  800907:	f6 c2 03             	test   $0x3,%dl
+  80090a:	75 0a                	jne    800916 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80090c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80090f:	89 c7                	mov    %eax,%edi
+  800911:	fc                   	cld
+  800912:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800914:	eb 05                	jmp    80091b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800916:	89 c7                	mov    %eax,%edi
+  800918:	fc                   	cld
+  800919:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80091b:	5e                   	pop    %esi
+  80091c:	5f                   	pop    %edi
+  80091d:	5d                   	pop    %ebp
+  80091e:	c3                   	ret
+
+0080091f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80091f:	55                   	push   %ebp
+  800920:	89 e5                	mov    %esp,%ebp
+  800922:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800925:	ff 75 10             	push   0x10(%ebp)
+  800928:	ff 75 0c             	push   0xc(%ebp)
+  80092b:	ff 75 08             	push   0x8(%ebp)
+  80092e:	e8 8a ff ff ff       	call   8008bd <memmove>
+}
+  800933:	c9                   	leave
+  800934:	c3                   	ret
+
+00800935 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800935:	55                   	push   %ebp
+  800936:	89 e5                	mov    %esp,%ebp
+  800938:	56                   	push   %esi
+  800939:	53                   	push   %ebx
+  80093a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800940:	89 c6                	mov    %eax,%esi
+  800942:	03 75 10             	add    0x10(%ebp),%esi
+  800945:	eb 06                	jmp    80094d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800947:	83 c0 01             	add    $0x1,%eax
+  80094a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80094d:	39 f0                	cmp    %esi,%eax
+  80094f:	74 14                	je     800965 <memcmp+0x30>
+		if (*s1 != *s2)
+  800951:	0f b6 08             	movzbl (%eax),%ecx
+  800954:	0f b6 1a             	movzbl (%edx),%ebx
+  800957:	38 d9                	cmp    %bl,%cl
+  800959:	74 ec                	je     800947 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80095b:	0f b6 c1             	movzbl %cl,%eax
+  80095e:	0f b6 db             	movzbl %bl,%ebx
+  800961:	29 d8                	sub    %ebx,%eax
+  800963:	eb 05                	jmp    80096a <memcmp+0x35>
+	}
+
+	return 0;
+  800965:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80096a:	5b                   	pop    %ebx
+  80096b:	5e                   	pop    %esi
+  80096c:	5d                   	pop    %ebp
+  80096d:	c3                   	ret
+
+0080096e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	8b 45 08             	mov    0x8(%ebp),%eax
+  800974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800977:	89 c2                	mov    %eax,%edx
+  800979:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80097c:	eb 03                	jmp    800981 <memfind+0x13>
+  80097e:	83 c0 01             	add    $0x1,%eax
+  800981:	39 d0                	cmp    %edx,%eax
+  800983:	73 04                	jae    800989 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800985:	38 08                	cmp    %cl,(%eax)
+  800987:	75 f5                	jne    80097e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800989:	5d                   	pop    %ebp
+  80098a:	c3                   	ret
+
+0080098b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80098b:	55                   	push   %ebp
+  80098c:	89 e5                	mov    %esp,%ebp
+  80098e:	57                   	push   %edi
+  80098f:	56                   	push   %esi
+  800990:	53                   	push   %ebx
+  800991:	8b 55 08             	mov    0x8(%ebp),%edx
+  800994:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800997:	eb 03                	jmp    80099c <strtol+0x11>
+		s++;
+  800999:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80099c:	0f b6 02             	movzbl (%edx),%eax
+  80099f:	3c 20                	cmp    $0x20,%al
+  8009a1:	74 f6                	je     800999 <strtol+0xe>
+  8009a3:	3c 09                	cmp    $0x9,%al
+  8009a5:	74 f2                	je     800999 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009a7:	3c 2b                	cmp    $0x2b,%al
+  8009a9:	74 2a                	je     8009d5 <strtol+0x4a>
+	int neg = 0;
+  8009ab:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009b0:	3c 2d                	cmp    $0x2d,%al
+  8009b2:	74 2b                	je     8009df <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009b4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009ba:	75 0f                	jne    8009cb <strtol+0x40>
+  8009bc:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009bf:	74 28                	je     8009e9 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009c1:	85 db                	test   %ebx,%ebx
+  8009c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009c8:	0f 44 d8             	cmove  %eax,%ebx
+  8009cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009d3:	eb 46                	jmp    800a1b <strtol+0x90>
+		s++;
+  8009d5:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009dd:	eb d5                	jmp    8009b4 <strtol+0x29>
+		s++, neg = 1;
+  8009df:	83 c2 01             	add    $0x1,%edx
+  8009e2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009e7:	eb cb                	jmp    8009b4 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009e9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009ed:	74 0e                	je     8009fd <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009ef:	85 db                	test   %ebx,%ebx
+  8009f1:	75 d8                	jne    8009cb <strtol+0x40>
+		s++, base = 8;
+  8009f3:	83 c2 01             	add    $0x1,%edx
+  8009f6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009fb:	eb ce                	jmp    8009cb <strtol+0x40>
+		s += 2, base = 16;
+  8009fd:	83 c2 02             	add    $0x2,%edx
+  800a00:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a05:	eb c4                	jmp    8009cb <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a07:	0f be c0             	movsbl %al,%eax
+  800a0a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a0d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a10:	7d 3a                	jge    800a4c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a12:	83 c2 01             	add    $0x1,%edx
+  800a15:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a19:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a1b:	0f b6 02             	movzbl (%edx),%eax
+  800a1e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a21:	89 f3                	mov    %esi,%ebx
+  800a23:	80 fb 09             	cmp    $0x9,%bl
+  800a26:	76 df                	jbe    800a07 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a28:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a2b:	89 f3                	mov    %esi,%ebx
+  800a2d:	80 fb 19             	cmp    $0x19,%bl
+  800a30:	77 08                	ja     800a3a <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a32:	0f be c0             	movsbl %al,%eax
+  800a35:	83 e8 57             	sub    $0x57,%eax
+  800a38:	eb d3                	jmp    800a0d <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a3a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a3d:	89 f3                	mov    %esi,%ebx
+  800a3f:	80 fb 19             	cmp    $0x19,%bl
+  800a42:	77 08                	ja     800a4c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a44:	0f be c0             	movsbl %al,%eax
+  800a47:	83 e8 37             	sub    $0x37,%eax
+  800a4a:	eb c1                	jmp    800a0d <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a4c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a50:	74 05                	je     800a57 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a52:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a55:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a57:	89 c8                	mov    %ecx,%eax
+  800a59:	f7 d8                	neg    %eax
+  800a5b:	85 ff                	test   %edi,%edi
+  800a5d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a60:	89 c8                	mov    %ecx,%eax
+  800a62:	5b                   	pop    %ebx
+  800a63:	5e                   	pop    %esi
+  800a64:	5f                   	pop    %edi
+  800a65:	5d                   	pop    %ebp
+  800a66:	c3                   	ret
+
+00800a67 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a67:	55                   	push   %ebp
+  800a68:	89 e5                	mov    %esp,%ebp
+  800a6a:	57                   	push   %edi
+  800a6b:	56                   	push   %esi
+  800a6c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a78:	89 c3                	mov    %eax,%ebx
+  800a7a:	89 c7                	mov    %eax,%edi
+  800a7c:	89 c6                	mov    %eax,%esi
+  800a7e:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800a80:	5b                   	pop    %ebx
+  800a81:	5e                   	pop    %esi
+  800a82:	5f                   	pop    %edi
+  800a83:	5d                   	pop    %ebp
+  800a84:	c3                   	ret
+
+00800a85 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800a85:	55                   	push   %ebp
+  800a86:	89 e5                	mov    %esp,%ebp
+  800a88:	57                   	push   %edi
+  800a89:	56                   	push   %esi
+  800a8a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a90:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a95:	89 d1                	mov    %edx,%ecx
+  800a97:	89 d3                	mov    %edx,%ebx
+  800a99:	89 d7                	mov    %edx,%edi
+  800a9b:	89 d6                	mov    %edx,%esi
+  800a9d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800a9f:	5b                   	pop    %ebx
+  800aa0:	5e                   	pop    %esi
+  800aa1:	5f                   	pop    %edi
+  800aa2:	5d                   	pop    %ebp
+  800aa3:	c3                   	ret
+
+00800aa4 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800aa4:	55                   	push   %ebp
+  800aa5:	89 e5                	mov    %esp,%ebp
+  800aa7:	57                   	push   %edi
+  800aa8:	56                   	push   %esi
+  800aa9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800aaa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ab7:	89 cb                	mov    %ecx,%ebx
+  800ab9:	89 cf                	mov    %ecx,%edi
+  800abb:	89 ce                	mov    %ecx,%esi
+  800abd:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800abf:	5b                   	pop    %ebx
+  800ac0:	5e                   	pop    %esi
+  800ac1:	5f                   	pop    %edi
+  800ac2:	5d                   	pop    %ebp
+  800ac3:	c3                   	ret
+
+00800ac4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ac4:	55                   	push   %ebp
+  800ac5:	89 e5                	mov    %esp,%ebp
+  800ac7:	57                   	push   %edi
+  800ac8:	56                   	push   %esi
+  800ac9:	53                   	push   %ebx
+  800aca:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800acd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ad5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ada:	89 cb                	mov    %ecx,%ebx
+  800adc:	89 cf                	mov    %ecx,%edi
+  800ade:	89 ce                	mov    %ecx,%esi
+  800ae0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ae2:	85 c0                	test   %eax,%eax
+  800ae4:	7f 08                	jg     800aee <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ae6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ae9:	5b                   	pop    %ebx
+  800aea:	5e                   	pop    %esi
+  800aeb:	5f                   	pop    %edi
+  800aec:	5d                   	pop    %ebp
+  800aed:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800aee:	83 ec 0c             	sub    $0xc,%esp
+  800af1:	50                   	push   %eax
+  800af2:	6a 03                	push   $0x3
+  800af4:	68 9f 29 80 00       	push   $0x80299f
+  800af9:	6a 23                	push   $0x23
+  800afb:	68 bc 29 80 00       	push   $0x8029bc
+  800b00:	e8 d5 15 00 00       	call   8020da <_panic>
+
+00800b05 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	57                   	push   %edi
+  800b09:	56                   	push   %esi
+  800b0a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b10:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b15:	89 d1                	mov    %edx,%ecx
+  800b17:	89 d3                	mov    %edx,%ebx
+  800b19:	89 d7                	mov    %edx,%edi
+  800b1b:	89 d6                	mov    %edx,%esi
+  800b1d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b1f:	5b                   	pop    %ebx
+  800b20:	5e                   	pop    %esi
+  800b21:	5f                   	pop    %edi
+  800b22:	5d                   	pop    %ebp
+  800b23:	c3                   	ret
+
+00800b24 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b24:	55                   	push   %ebp
+  800b25:	89 e5                	mov    %esp,%ebp
+  800b27:	57                   	push   %edi
+  800b28:	56                   	push   %esi
+  800b29:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b2f:	b8 16 00 00 00       	mov    $0x16,%eax
+  800b34:	89 d1                	mov    %edx,%ecx
+  800b36:	89 d3                	mov    %edx,%ebx
+  800b38:	89 d7                	mov    %edx,%edi
+  800b3a:	89 d6                	mov    %edx,%esi
+  800b3c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b3e:	5b                   	pop    %ebx
+  800b3f:	5e                   	pop    %esi
+  800b40:	5f                   	pop    %edi
+  800b41:	5d                   	pop    %ebp
+  800b42:	c3                   	ret
+
+00800b43 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800b43:	55                   	push   %ebp
+  800b44:	89 e5                	mov    %esp,%ebp
+  800b46:	57                   	push   %edi
+  800b47:	56                   	push   %esi
+  800b48:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800b53:	89 d1                	mov    %edx,%ecx
+  800b55:	89 d3                	mov    %edx,%ebx
+  800b57:	89 d7                	mov    %edx,%edi
+  800b59:	89 d6                	mov    %edx,%esi
+  800b5b:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800b5d:	5b                   	pop    %ebx
+  800b5e:	5e                   	pop    %esi
+  800b5f:	5f                   	pop    %edi
+  800b60:	5d                   	pop    %ebp
+  800b61:	c3                   	ret
+
+00800b62 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800b62:	55                   	push   %ebp
+  800b63:	89 e5                	mov    %esp,%ebp
+  800b65:	57                   	push   %edi
+  800b66:	56                   	push   %esi
+  800b67:	53                   	push   %ebx
+  800b68:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b76:	b8 15 00 00 00       	mov    $0x15,%eax
+  800b7b:	89 df                	mov    %ebx,%edi
+  800b7d:	89 de                	mov    %ebx,%esi
+  800b7f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b81:	85 c0                	test   %eax,%eax
+  800b83:	7f 08                	jg     800b8d <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800b85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b88:	5b                   	pop    %ebx
+  800b89:	5e                   	pop    %esi
+  800b8a:	5f                   	pop    %edi
+  800b8b:	5d                   	pop    %ebp
+  800b8c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b8d:	83 ec 0c             	sub    $0xc,%esp
+  800b90:	50                   	push   %eax
+  800b91:	6a 15                	push   $0x15
+  800b93:	68 9f 29 80 00       	push   $0x80299f
+  800b98:	6a 23                	push   $0x23
+  800b9a:	68 bc 29 80 00       	push   $0x8029bc
+  800b9f:	e8 36 15 00 00       	call   8020da <_panic>
+
+00800ba4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	57                   	push   %edi
+  800ba8:	56                   	push   %esi
+  800ba9:	53                   	push   %ebx
+  800baa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bad:	be 00 00 00 00       	mov    $0x0,%esi
+  800bb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb8:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bc0:	89 f7                	mov    %esi,%edi
+  800bc2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bc4:	85 c0                	test   %eax,%eax
+  800bc6:	7f 08                	jg     800bd0 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bcb:	5b                   	pop    %ebx
+  800bcc:	5e                   	pop    %esi
+  800bcd:	5f                   	pop    %edi
+  800bce:	5d                   	pop    %ebp
+  800bcf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bd0:	83 ec 0c             	sub    $0xc,%esp
+  800bd3:	50                   	push   %eax
+  800bd4:	6a 05                	push   $0x5
+  800bd6:	68 9f 29 80 00       	push   $0x80299f
+  800bdb:	6a 23                	push   $0x23
+  800bdd:	68 bc 29 80 00       	push   $0x8029bc
+  800be2:	e8 f3 14 00 00       	call   8020da <_panic>
+
+00800be7 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800be7:	55                   	push   %ebp
+  800be8:	89 e5                	mov    %esp,%ebp
+  800bea:	57                   	push   %edi
+  800beb:	56                   	push   %esi
+  800bec:	53                   	push   %ebx
+  800bed:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bf0:	be 00 00 00 00       	mov    $0x0,%esi
+  800bf5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfb:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c03:	89 f7                	mov    %esi,%edi
+  800c05:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c07:	85 c0                	test   %eax,%eax
+  800c09:	7f 08                	jg     800c13 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c0e:	5b                   	pop    %ebx
+  800c0f:	5e                   	pop    %esi
+  800c10:	5f                   	pop    %edi
+  800c11:	5d                   	pop    %ebp
+  800c12:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c13:	83 ec 0c             	sub    $0xc,%esp
+  800c16:	50                   	push   %eax
+  800c17:	6a 06                	push   $0x6
+  800c19:	68 9f 29 80 00       	push   $0x80299f
+  800c1e:	6a 23                	push   $0x23
+  800c20:	68 bc 29 80 00       	push   $0x8029bc
+  800c25:	e8 b0 14 00 00       	call   8020da <_panic>
+
+00800c2a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c2a:	55                   	push   %ebp
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	57                   	push   %edi
+  800c2e:	56                   	push   %esi
+  800c2f:	53                   	push   %ebx
+  800c30:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c39:	b8 07 00 00 00       	mov    $0x7,%eax
+  800c3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c41:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c44:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c47:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c49:	85 c0                	test   %eax,%eax
+  800c4b:	7f 08                	jg     800c55 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c50:	5b                   	pop    %ebx
+  800c51:	5e                   	pop    %esi
+  800c52:	5f                   	pop    %edi
+  800c53:	5d                   	pop    %ebp
+  800c54:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c55:	83 ec 0c             	sub    $0xc,%esp
+  800c58:	50                   	push   %eax
+  800c59:	6a 07                	push   $0x7
+  800c5b:	68 9f 29 80 00       	push   $0x80299f
+  800c60:	6a 23                	push   $0x23
+  800c62:	68 bc 29 80 00       	push   $0x8029bc
+  800c67:	e8 6e 14 00 00       	call   8020da <_panic>
+
+00800c6c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	57                   	push   %edi
+  800c70:	56                   	push   %esi
+  800c71:	53                   	push   %ebx
+  800c72:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c80:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c85:	89 df                	mov    %ebx,%edi
+  800c87:	89 de                	mov    %ebx,%esi
+  800c89:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c8b:	85 c0                	test   %eax,%eax
+  800c8d:	7f 08                	jg     800c97 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c92:	5b                   	pop    %ebx
+  800c93:	5e                   	pop    %esi
+  800c94:	5f                   	pop    %edi
+  800c95:	5d                   	pop    %ebp
+  800c96:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c97:	83 ec 0c             	sub    $0xc,%esp
+  800c9a:	50                   	push   %eax
+  800c9b:	6a 08                	push   $0x8
+  800c9d:	68 9f 29 80 00       	push   $0x80299f
+  800ca2:	6a 23                	push   $0x23
+  800ca4:	68 bc 29 80 00       	push   $0x8029bc
+  800ca9:	e8 2c 14 00 00       	call   8020da <_panic>
+
+00800cae <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	57                   	push   %edi
+  800cb2:	56                   	push   %esi
+  800cb3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cba:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cbf:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cc7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cca:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800ccc:	5b                   	pop    %ebx
+  800ccd:	5e                   	pop    %esi
+  800cce:	5f                   	pop    %edi
+  800ccf:	5d                   	pop    %ebp
+  800cd0:	c3                   	ret
+
+00800cd1 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800cd1:	55                   	push   %ebp
+  800cd2:	89 e5                	mov    %esp,%ebp
+  800cd4:	57                   	push   %edi
+  800cd5:	56                   	push   %esi
+  800cd6:	53                   	push   %ebx
+  800cd7:	8b 45 18             	mov    0x18(%ebp),%eax
+  800cda:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800cdd:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800ce2:	77 27                	ja     800d0b <sys_page_map_range+0x3a>
+  800ce4:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800cea:	77 1f                	ja     800d0b <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800cec:	c1 e0 0c             	shl    $0xc,%eax
+  800cef:	89 c6                	mov    %eax,%esi
+  800cf1:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800cf3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cfe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d01:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d04:	cd 30                	int    $0x30
+}
+  800d06:	5b                   	pop    %ebx
+  800d07:	5e                   	pop    %esi
+  800d08:	5f                   	pop    %edi
+  800d09:	5d                   	pop    %ebp
+  800d0a:	c3                   	ret
+		return -E_INVAL;
+  800d0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d10:	eb f4                	jmp    800d06 <sys_page_map_range+0x35>
+
+00800d12 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	57                   	push   %edi
+  800d16:	56                   	push   %esi
+  800d17:	53                   	push   %ebx
+  800d18:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d21:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d26:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d2e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d31:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d33:	85 c0                	test   %eax,%eax
+  800d35:	7f 08                	jg     800d3f <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800d37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3a:	5b                   	pop    %ebx
+  800d3b:	5e                   	pop    %esi
+  800d3c:	5f                   	pop    %edi
+  800d3d:	5d                   	pop    %ebp
+  800d3e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d3f:	83 ec 0c             	sub    $0xc,%esp
+  800d42:	50                   	push   %eax
+  800d43:	6a 0c                	push   $0xc
+  800d45:	68 9f 29 80 00       	push   $0x80299f
+  800d4a:	6a 23                	push   $0x23
+  800d4c:	68 bc 29 80 00       	push   $0x8029bc
+  800d51:	e8 84 13 00 00       	call   8020da <_panic>
+
+00800d56 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	57                   	push   %edi
+  800d5a:	56                   	push   %esi
+  800d5b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d67:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d6f:	89 f7                	mov    %esi,%edi
+  800d71:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800d73:	5b                   	pop    %ebx
+  800d74:	5e                   	pop    %esi
+  800d75:	5f                   	pop    %edi
+  800d76:	5d                   	pop    %ebp
+  800d77:	c3                   	ret
+
+00800d78 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d78:	55                   	push   %ebp
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	57                   	push   %edi
+  800d7c:	56                   	push   %esi
+  800d7d:	53                   	push   %ebx
+  800d7e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d91:	89 df                	mov    %ebx,%edi
+  800d93:	89 de                	mov    %ebx,%esi
+  800d95:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d97:	85 c0                	test   %eax,%eax
+  800d99:	7f 08                	jg     800da3 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9e:	5b                   	pop    %ebx
+  800d9f:	5e                   	pop    %esi
+  800da0:	5f                   	pop    %edi
+  800da1:	5d                   	pop    %ebp
+  800da2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da3:	83 ec 0c             	sub    $0xc,%esp
+  800da6:	50                   	push   %eax
+  800da7:	6a 0f                	push   $0xf
+  800da9:	68 9f 29 80 00       	push   $0x80299f
+  800dae:	6a 23                	push   $0x23
+  800db0:	68 bc 29 80 00       	push   $0x8029bc
+  800db5:	e8 20 13 00 00       	call   8020da <_panic>
+
+00800dba <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800dba:	55                   	push   %ebp
+  800dbb:	89 e5                	mov    %esp,%ebp
+  800dbd:	57                   	push   %edi
+  800dbe:	56                   	push   %esi
+  800dbf:	53                   	push   %ebx
+  800dc0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dce:	b8 10 00 00 00       	mov    $0x10,%eax
+  800dd3:	89 df                	mov    %ebx,%edi
+  800dd5:	89 de                	mov    %ebx,%esi
+  800dd7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dd9:	85 c0                	test   %eax,%eax
+  800ddb:	7f 08                	jg     800de5 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800ddd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de0:	5b                   	pop    %ebx
+  800de1:	5e                   	pop    %esi
+  800de2:	5f                   	pop    %edi
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de5:	83 ec 0c             	sub    $0xc,%esp
+  800de8:	50                   	push   %eax
+  800de9:	6a 10                	push   $0x10
+  800deb:	68 9f 29 80 00       	push   $0x80299f
+  800df0:	6a 23                	push   $0x23
+  800df2:	68 bc 29 80 00       	push   $0x8029bc
+  800df7:	e8 de 12 00 00       	call   8020da <_panic>
+
+00800dfc <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800dfc:	55                   	push   %ebp
+  800dfd:	89 e5                	mov    %esp,%ebp
+  800dff:	57                   	push   %edi
+  800e00:	56                   	push   %esi
+  800e01:	53                   	push   %ebx
+  800e02:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e10:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e15:	89 df                	mov    %ebx,%edi
+  800e17:	89 de                	mov    %ebx,%esi
+  800e19:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e1b:	85 c0                	test   %eax,%eax
+  800e1d:	7f 08                	jg     800e27 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e27:	83 ec 0c             	sub    $0xc,%esp
+  800e2a:	50                   	push   %eax
+  800e2b:	6a 11                	push   $0x11
+  800e2d:	68 9f 29 80 00       	push   $0x80299f
+  800e32:	6a 23                	push   $0x23
+  800e34:	68 bc 29 80 00       	push   $0x8029bc
+  800e39:	e8 9c 12 00 00       	call   8020da <_panic>
+
+00800e3e <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	57                   	push   %edi
+  800e42:	56                   	push   %esi
+  800e43:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e49:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e4e:	89 d1                	mov    %edx,%ecx
+  800e50:	89 d3                	mov    %edx,%ebx
+  800e52:	89 d7                	mov    %edx,%edi
+  800e54:	89 d6                	mov    %edx,%esi
+  800e56:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+
+00800e5d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e5d:	55                   	push   %ebp
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	57                   	push   %edi
+  800e61:	56                   	push   %esi
+  800e62:	53                   	push   %ebx
+  800e63:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e71:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e76:	89 df                	mov    %ebx,%edi
+  800e78:	89 de                	mov    %ebx,%esi
+  800e7a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e7c:	85 c0                	test   %eax,%eax
+  800e7e:	7f 08                	jg     800e88 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e83:	5b                   	pop    %ebx
+  800e84:	5e                   	pop    %esi
+  800e85:	5f                   	pop    %edi
+  800e86:	5d                   	pop    %ebp
+  800e87:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e88:	83 ec 0c             	sub    $0xc,%esp
+  800e8b:	50                   	push   %eax
+  800e8c:	6a 13                	push   $0x13
+  800e8e:	68 9f 29 80 00       	push   $0x80299f
+  800e93:	6a 23                	push   $0x23
+  800e95:	68 bc 29 80 00       	push   $0x8029bc
+  800e9a:	e8 3b 12 00 00       	call   8020da <_panic>
+
+00800e9f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	57                   	push   %edi
+  800ea3:	56                   	push   %esi
+  800ea4:	53                   	push   %ebx
+  800ea5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb3:	b8 14 00 00 00       	mov    $0x14,%eax
+  800eb8:	89 df                	mov    %ebx,%edi
+  800eba:	89 de                	mov    %ebx,%esi
+  800ebc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ebe:	85 c0                	test   %eax,%eax
+  800ec0:	7f 08                	jg     800eca <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ec2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eca:	83 ec 0c             	sub    $0xc,%esp
+  800ecd:	50                   	push   %eax
+  800ece:	6a 14                	push   $0x14
+  800ed0:	68 9f 29 80 00       	push   $0x80299f
+  800ed5:	6a 23                	push   $0x23
+  800ed7:	68 bc 29 80 00       	push   $0x8029bc
+  800edc:	e8 f9 11 00 00       	call   8020da <_panic>
+
+00800ee1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	57                   	push   %edi
+  800ee5:	56                   	push   %esi
+  800ee6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eed:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ef2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800efd:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800eff:	5b                   	pop    %ebx
+  800f00:	5e                   	pop    %esi
+  800f01:	5f                   	pop    %edi
+  800f02:	5d                   	pop    %ebp
+  800f03:	c3                   	ret
+
+00800f04 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f04:	55                   	push   %ebp
+  800f05:	89 e5                	mov    %esp,%ebp
+  800f07:	57                   	push   %edi
+  800f08:	56                   	push   %esi
+  800f09:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f10:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f15:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f20:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f22:	5b                   	pop    %ebx
+  800f23:	5e                   	pop    %esi
+  800f24:	5f                   	pop    %edi
+  800f25:	5d                   	pop    %ebp
+  800f26:	c3                   	ret
+
+00800f27 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	57                   	push   %edi
+  800f2b:	56                   	push   %esi
+  800f2c:	53                   	push   %ebx
+  800f2d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f3d:	89 cb                	mov    %ecx,%ebx
+  800f3f:	89 cf                	mov    %ecx,%edi
+  800f41:	89 ce                	mov    %ecx,%esi
+  800f43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f45:	85 c0                	test   %eax,%eax
+  800f47:	7f 08                	jg     800f51 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4c:	5b                   	pop    %ebx
+  800f4d:	5e                   	pop    %esi
+  800f4e:	5f                   	pop    %edi
+  800f4f:	5d                   	pop    %ebp
+  800f50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f51:	83 ec 0c             	sub    $0xc,%esp
+  800f54:	50                   	push   %eax
+  800f55:	6a 19                	push   $0x19
+  800f57:	68 9f 29 80 00       	push   $0x80299f
+  800f5c:	6a 23                	push   $0x23
+  800f5e:	68 bc 29 80 00       	push   $0x8029bc
+  800f63:	e8 72 11 00 00       	call   8020da <_panic>
+
+00800f68 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+  800f6b:	57                   	push   %edi
+  800f6c:	56                   	push   %esi
+  800f6d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f73:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f78:	89 d1                	mov    %edx,%ecx
+  800f7a:	89 d3                	mov    %edx,%ebx
+  800f7c:	89 d7                	mov    %edx,%edi
+  800f7e:	89 d6                	mov    %edx,%esi
+  800f80:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f82:	5b                   	pop    %ebx
+  800f83:	5e                   	pop    %esi
+  800f84:	5f                   	pop    %edi
+  800f85:	5d                   	pop    %ebp
+  800f86:	c3                   	ret
+
+00800f87 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  800f87:	55                   	push   %ebp
+  800f88:	89 e5                	mov    %esp,%ebp
+  800f8a:	57                   	push   %edi
+  800f8b:	56                   	push   %esi
+  800f8c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f98:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800f9d:	89 df                	mov    %ebx,%edi
+  800f9f:	89 de                	mov    %ebx,%esi
+  800fa1:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  800fa3:	5b                   	pop    %ebx
+  800fa4:	5e                   	pop    %esi
+  800fa5:	5f                   	pop    %edi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	c3                   	ret
+
+00800fa8 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  800fa8:	55                   	push   %ebp
+  800fa9:	89 e5                	mov    %esp,%ebp
+  800fab:	57                   	push   %edi
+  800fac:	56                   	push   %esi
+  800fad:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800fbe:	89 df                	mov    %ebx,%edi
+  800fc0:	89 de                	mov    %ebx,%esi
+  800fc2:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  800fc4:	5b                   	pop    %ebx
+  800fc5:	5e                   	pop    %esi
+  800fc6:	5f                   	pop    %edi
+  800fc7:	5d                   	pop    %ebp
+  800fc8:	c3                   	ret
+
+00800fc9 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fcf:	05 00 00 00 30       	add    $0x30000000,%eax
+  800fd4:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800fd7:	5d                   	pop    %ebp
+  800fd8:	c3                   	ret
+
+00800fd9 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800fd9:	55                   	push   %ebp
+  800fda:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fdf:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800fe4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800fe9:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800fee:	5d                   	pop    %ebp
+  800fef:	c3                   	ret
+
+00800ff0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800ff0:	55                   	push   %ebp
+  800ff1:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800ff3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800ff8:	eb 02                	jmp    800ffc <fd_alloc+0xc>
+  800ffa:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800ffc:	89 c2                	mov    %eax,%edx
+  800ffe:	c1 ea 16             	shr    $0x16,%edx
+  801001:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801008:	f6 c2 01             	test   $0x1,%dl
+  80100b:	74 2b                	je     801038 <fd_alloc+0x48>
+  80100d:	89 c2                	mov    %eax,%edx
+  80100f:	c1 ea 0c             	shr    $0xc,%edx
+  801012:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801019:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80101f:	f6 c1 01             	test   $0x1,%cl
+  801022:	74 14                	je     801038 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801024:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80102a:	75 ce                	jne    800ffa <fd_alloc+0xa>
+  80102c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801031:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801036:	eb 05                	jmp    80103d <fd_alloc+0x4d>
+			return 0;
+  801038:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80103d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801040:	89 02                	mov    %eax,(%edx)
+}
+  801042:	89 c8                	mov    %ecx,%eax
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+
+00801046 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+  801049:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80104c:	83 f8 1f             	cmp    $0x1f,%eax
+  80104f:	77 30                	ja     801081 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801051:	c1 e0 0c             	shl    $0xc,%eax
+  801054:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801059:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80105f:	f6 c2 01             	test   $0x1,%dl
+  801062:	74 24                	je     801088 <fd_lookup+0x42>
+  801064:	89 c2                	mov    %eax,%edx
+  801066:	c1 ea 0c             	shr    $0xc,%edx
+  801069:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801070:	f6 c2 01             	test   $0x1,%dl
+  801073:	74 1a                	je     80108f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801075:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801078:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80107a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80107f:	5d                   	pop    %ebp
+  801080:	c3                   	ret
+		return -E_INVAL;
+  801081:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801086:	eb f7                	jmp    80107f <fd_lookup+0x39>
+		return -E_INVAL;
+  801088:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80108d:	eb f0                	jmp    80107f <fd_lookup+0x39>
+  80108f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801094:	eb e9                	jmp    80107f <fd_lookup+0x39>
+
+00801096 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801096:	55                   	push   %ebp
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	53                   	push   %ebx
+  80109a:	83 ec 04             	sub    $0x4,%esp
+  80109d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8010a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a5:	eb 03                	jmp    8010aa <dev_lookup+0x14>
+  8010a7:	83 c0 01             	add    $0x1,%eax
+  8010aa:	8b 1c 85 48 2a 80 00 	mov    0x802a48(,%eax,4),%ebx
+  8010b1:	85 db                	test   %ebx,%ebx
+  8010b3:	74 0b                	je     8010c0 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8010b5:	39 13                	cmp    %edx,(%ebx)
+  8010b7:	75 ee                	jne    8010a7 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8010b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010be:	eb 1f                	jmp    8010df <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8010c0:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8010c5:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8010c8:	83 ec 04             	sub    $0x4,%esp
+  8010cb:	52                   	push   %edx
+  8010cc:	50                   	push   %eax
+  8010cd:	68 cc 29 80 00       	push   $0x8029cc
+  8010d2:	e8 72 f0 ff ff       	call   800149 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8010d7:	83 c4 10             	add    $0x10,%esp
+  8010da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8010df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010e2:	89 1a                	mov    %ebx,(%edx)
+}
+  8010e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010e7:	c9                   	leave
+  8010e8:	c3                   	ret
+
+008010e9 <fd_close>:
+{
+  8010e9:	55                   	push   %ebp
+  8010ea:	89 e5                	mov    %esp,%ebp
+  8010ec:	57                   	push   %edi
+  8010ed:	56                   	push   %esi
+  8010ee:	53                   	push   %ebx
+  8010ef:	83 ec 24             	sub    $0x24,%esp
+  8010f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010f5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8010f8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8010fb:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010fc:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801102:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801105:	50                   	push   %eax
+  801106:	e8 3b ff ff ff       	call   801046 <fd_lookup>
+  80110b:	89 c3                	mov    %eax,%ebx
+  80110d:	83 c4 10             	add    $0x10,%esp
+  801110:	85 c0                	test   %eax,%eax
+  801112:	78 05                	js     801119 <fd_close+0x30>
+	    || fd != fd2)
+  801114:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801117:	74 16                	je     80112f <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801119:	89 f8                	mov    %edi,%eax
+  80111b:	84 c0                	test   %al,%al
+  80111d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801122:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801125:	89 d8                	mov    %ebx,%eax
+  801127:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112a:	5b                   	pop    %ebx
+  80112b:	5e                   	pop    %esi
+  80112c:	5f                   	pop    %edi
+  80112d:	5d                   	pop    %ebp
+  80112e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80112f:	83 ec 08             	sub    $0x8,%esp
+  801132:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801135:	50                   	push   %eax
+  801136:	ff 36                	push   (%esi)
+  801138:	e8 59 ff ff ff       	call   801096 <dev_lookup>
+  80113d:	89 c3                	mov    %eax,%ebx
+  80113f:	83 c4 10             	add    $0x10,%esp
+  801142:	85 c0                	test   %eax,%eax
+  801144:	78 1a                	js     801160 <fd_close+0x77>
+		if (dev->dev_close)
+  801146:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801149:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80114c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801151:	85 c0                	test   %eax,%eax
+  801153:	74 0b                	je     801160 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801155:	83 ec 0c             	sub    $0xc,%esp
+  801158:	56                   	push   %esi
+  801159:	ff d0                	call   *%eax
+  80115b:	89 c3                	mov    %eax,%ebx
+  80115d:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801160:	83 ec 08             	sub    $0x8,%esp
+  801163:	56                   	push   %esi
+  801164:	6a 00                	push   $0x0
+  801166:	e8 01 fb ff ff       	call   800c6c <sys_page_unmap>
+	return r;
+  80116b:	83 c4 10             	add    $0x10,%esp
+  80116e:	eb b5                	jmp    801125 <fd_close+0x3c>
+
+00801170 <close>:
+
+int
+close(int fdnum)
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801176:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801179:	50                   	push   %eax
+  80117a:	ff 75 08             	push   0x8(%ebp)
+  80117d:	e8 c4 fe ff ff       	call   801046 <fd_lookup>
+  801182:	83 c4 10             	add    $0x10,%esp
+  801185:	85 c0                	test   %eax,%eax
+  801187:	79 02                	jns    80118b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801189:	c9                   	leave
+  80118a:	c3                   	ret
+		return fd_close(fd, 1);
+  80118b:	83 ec 08             	sub    $0x8,%esp
+  80118e:	6a 01                	push   $0x1
+  801190:	ff 75 f4             	push   -0xc(%ebp)
+  801193:	e8 51 ff ff ff       	call   8010e9 <fd_close>
+  801198:	83 c4 10             	add    $0x10,%esp
+  80119b:	eb ec                	jmp    801189 <close+0x19>
+
+0080119d <close_all>:
+
+void
+close_all(void)
+{
+  80119d:	55                   	push   %ebp
+  80119e:	89 e5                	mov    %esp,%ebp
+  8011a0:	53                   	push   %ebx
+  8011a1:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8011a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8011a9:	83 ec 0c             	sub    $0xc,%esp
+  8011ac:	53                   	push   %ebx
+  8011ad:	e8 be ff ff ff       	call   801170 <close>
+	for (i = 0; i < MAXFD; i++)
+  8011b2:	83 c3 01             	add    $0x1,%ebx
+  8011b5:	83 c4 10             	add    $0x10,%esp
+  8011b8:	83 fb 20             	cmp    $0x20,%ebx
+  8011bb:	75 ec                	jne    8011a9 <close_all+0xc>
+}
+  8011bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011c0:	c9                   	leave
+  8011c1:	c3                   	ret
+
+008011c2 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8011c2:	55                   	push   %ebp
+  8011c3:	89 e5                	mov    %esp,%ebp
+  8011c5:	57                   	push   %edi
+  8011c6:	56                   	push   %esi
+  8011c7:	53                   	push   %ebx
+  8011c8:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8011cb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011ce:	50                   	push   %eax
+  8011cf:	ff 75 08             	push   0x8(%ebp)
+  8011d2:	e8 6f fe ff ff       	call   801046 <fd_lookup>
+  8011d7:	89 c3                	mov    %eax,%ebx
+  8011d9:	83 c4 10             	add    $0x10,%esp
+  8011dc:	85 c0                	test   %eax,%eax
+  8011de:	78 7f                	js     80125f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8011e0:	83 ec 0c             	sub    $0xc,%esp
+  8011e3:	ff 75 0c             	push   0xc(%ebp)
+  8011e6:	e8 85 ff ff ff       	call   801170 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8011eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8011ee:	c1 e6 0c             	shl    $0xc,%esi
+  8011f1:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8011f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8011fa:	89 3c 24             	mov    %edi,(%esp)
+  8011fd:	e8 d7 fd ff ff       	call   800fd9 <fd2data>
+  801202:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801204:	89 34 24             	mov    %esi,(%esp)
+  801207:	e8 cd fd ff ff       	call   800fd9 <fd2data>
+  80120c:	83 c4 10             	add    $0x10,%esp
+  80120f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801212:	89 d8                	mov    %ebx,%eax
+  801214:	c1 e8 16             	shr    $0x16,%eax
+  801217:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80121e:	a8 01                	test   $0x1,%al
+  801220:	74 11                	je     801233 <dup+0x71>
+  801222:	89 d8                	mov    %ebx,%eax
+  801224:	c1 e8 0c             	shr    $0xc,%eax
+  801227:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80122e:	f6 c2 01             	test   $0x1,%dl
+  801231:	75 36                	jne    801269 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801233:	89 f8                	mov    %edi,%eax
+  801235:	c1 e8 0c             	shr    $0xc,%eax
+  801238:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80123f:	83 ec 0c             	sub    $0xc,%esp
+  801242:	25 07 0e 00 00       	and    $0xe07,%eax
+  801247:	50                   	push   %eax
+  801248:	56                   	push   %esi
+  801249:	6a 00                	push   $0x0
+  80124b:	57                   	push   %edi
+  80124c:	6a 00                	push   $0x0
+  80124e:	e8 d7 f9 ff ff       	call   800c2a <sys_page_map>
+  801253:	89 c3                	mov    %eax,%ebx
+  801255:	83 c4 20             	add    $0x20,%esp
+  801258:	85 c0                	test   %eax,%eax
+  80125a:	78 33                	js     80128f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80125c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80125f:	89 d8                	mov    %ebx,%eax
+  801261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5f                   	pop    %edi
+  801267:	5d                   	pop    %ebp
+  801268:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801269:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801270:	83 ec 0c             	sub    $0xc,%esp
+  801273:	25 07 0e 00 00       	and    $0xe07,%eax
+  801278:	50                   	push   %eax
+  801279:	ff 75 d4             	push   -0x2c(%ebp)
+  80127c:	6a 00                	push   $0x0
+  80127e:	53                   	push   %ebx
+  80127f:	6a 00                	push   $0x0
+  801281:	e8 a4 f9 ff ff       	call   800c2a <sys_page_map>
+  801286:	89 c3                	mov    %eax,%ebx
+  801288:	83 c4 20             	add    $0x20,%esp
+  80128b:	85 c0                	test   %eax,%eax
+  80128d:	79 a4                	jns    801233 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80128f:	83 ec 08             	sub    $0x8,%esp
+  801292:	56                   	push   %esi
+  801293:	6a 00                	push   $0x0
+  801295:	e8 d2 f9 ff ff       	call   800c6c <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80129a:	83 c4 08             	add    $0x8,%esp
+  80129d:	ff 75 d4             	push   -0x2c(%ebp)
+  8012a0:	6a 00                	push   $0x0
+  8012a2:	e8 c5 f9 ff ff       	call   800c6c <sys_page_unmap>
+	return r;
+  8012a7:	83 c4 10             	add    $0x10,%esp
+  8012aa:	eb b3                	jmp    80125f <dup+0x9d>
+
+008012ac <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	56                   	push   %esi
+  8012b0:	53                   	push   %ebx
+  8012b1:	83 ec 18             	sub    $0x18,%esp
+  8012b4:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012ba:	50                   	push   %eax
+  8012bb:	56                   	push   %esi
+  8012bc:	e8 85 fd ff ff       	call   801046 <fd_lookup>
+  8012c1:	83 c4 10             	add    $0x10,%esp
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	78 3c                	js     801304 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012c8:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8012cb:	83 ec 08             	sub    $0x8,%esp
+  8012ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012d1:	50                   	push   %eax
+  8012d2:	ff 33                	push   (%ebx)
+  8012d4:	e8 bd fd ff ff       	call   801096 <dev_lookup>
+  8012d9:	83 c4 10             	add    $0x10,%esp
+  8012dc:	85 c0                	test   %eax,%eax
+  8012de:	78 24                	js     801304 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8012e0:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012e3:	83 e0 03             	and    $0x3,%eax
+  8012e6:	83 f8 01             	cmp    $0x1,%eax
+  8012e9:	74 20                	je     80130b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8012eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012ee:	8b 40 08             	mov    0x8(%eax),%eax
+  8012f1:	85 c0                	test   %eax,%eax
+  8012f3:	74 37                	je     80132c <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8012f5:	83 ec 04             	sub    $0x4,%esp
+  8012f8:	ff 75 10             	push   0x10(%ebp)
+  8012fb:	ff 75 0c             	push   0xc(%ebp)
+  8012fe:	53                   	push   %ebx
+  8012ff:	ff d0                	call   *%eax
+  801301:	83 c4 10             	add    $0x10,%esp
+}
+  801304:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801307:	5b                   	pop    %ebx
+  801308:	5e                   	pop    %esi
+  801309:	5d                   	pop    %ebp
+  80130a:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80130b:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801310:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801313:	83 ec 04             	sub    $0x4,%esp
+  801316:	56                   	push   %esi
+  801317:	50                   	push   %eax
+  801318:	68 0d 2a 80 00       	push   $0x802a0d
+  80131d:	e8 27 ee ff ff       	call   800149 <cprintf>
+		return -E_INVAL;
+  801322:	83 c4 10             	add    $0x10,%esp
+  801325:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80132a:	eb d8                	jmp    801304 <read+0x58>
+		return -E_NOT_SUPP;
+  80132c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801331:	eb d1                	jmp    801304 <read+0x58>
+
+00801333 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801333:	55                   	push   %ebp
+  801334:	89 e5                	mov    %esp,%ebp
+  801336:	57                   	push   %edi
+  801337:	56                   	push   %esi
+  801338:	53                   	push   %ebx
+  801339:	83 ec 0c             	sub    $0xc,%esp
+  80133c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80133f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801342:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801347:	eb 02                	jmp    80134b <readn+0x18>
+  801349:	01 c3                	add    %eax,%ebx
+  80134b:	39 f3                	cmp    %esi,%ebx
+  80134d:	73 21                	jae    801370 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80134f:	83 ec 04             	sub    $0x4,%esp
+  801352:	89 f0                	mov    %esi,%eax
+  801354:	29 d8                	sub    %ebx,%eax
+  801356:	50                   	push   %eax
+  801357:	89 d8                	mov    %ebx,%eax
+  801359:	03 45 0c             	add    0xc(%ebp),%eax
+  80135c:	50                   	push   %eax
+  80135d:	57                   	push   %edi
+  80135e:	e8 49 ff ff ff       	call   8012ac <read>
+		if (m < 0)
+  801363:	83 c4 10             	add    $0x10,%esp
+  801366:	85 c0                	test   %eax,%eax
+  801368:	78 04                	js     80136e <readn+0x3b>
+			return m;
+		if (m == 0)
+  80136a:	75 dd                	jne    801349 <readn+0x16>
+  80136c:	eb 02                	jmp    801370 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80136e:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801370:	89 d8                	mov    %ebx,%eax
+  801372:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801375:	5b                   	pop    %ebx
+  801376:	5e                   	pop    %esi
+  801377:	5f                   	pop    %edi
+  801378:	5d                   	pop    %ebp
+  801379:	c3                   	ret
+
+0080137a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	56                   	push   %esi
+  80137e:	53                   	push   %ebx
+  80137f:	83 ec 18             	sub    $0x18,%esp
+  801382:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801385:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801388:	50                   	push   %eax
+  801389:	53                   	push   %ebx
+  80138a:	e8 b7 fc ff ff       	call   801046 <fd_lookup>
+  80138f:	83 c4 10             	add    $0x10,%esp
+  801392:	85 c0                	test   %eax,%eax
+  801394:	78 37                	js     8013cd <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801396:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801399:	83 ec 08             	sub    $0x8,%esp
+  80139c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80139f:	50                   	push   %eax
+  8013a0:	ff 36                	push   (%esi)
+  8013a2:	e8 ef fc ff ff       	call   801096 <dev_lookup>
+  8013a7:	83 c4 10             	add    $0x10,%esp
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	78 1f                	js     8013cd <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013ae:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013b2:	74 20                	je     8013d4 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8013b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013b7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013ba:	85 c0                	test   %eax,%eax
+  8013bc:	74 37                	je     8013f5 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8013be:	83 ec 04             	sub    $0x4,%esp
+  8013c1:	ff 75 10             	push   0x10(%ebp)
+  8013c4:	ff 75 0c             	push   0xc(%ebp)
+  8013c7:	56                   	push   %esi
+  8013c8:	ff d0                	call   *%eax
+  8013ca:	83 c4 10             	add    $0x10,%esp
+}
+  8013cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d0:	5b                   	pop    %ebx
+  8013d1:	5e                   	pop    %esi
+  8013d2:	5d                   	pop    %ebp
+  8013d3:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013d4:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8013d9:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8013dc:	83 ec 04             	sub    $0x4,%esp
+  8013df:	53                   	push   %ebx
+  8013e0:	50                   	push   %eax
+  8013e1:	68 29 2a 80 00       	push   $0x802a29
+  8013e6:	e8 5e ed ff ff       	call   800149 <cprintf>
+		return -E_INVAL;
+  8013eb:	83 c4 10             	add    $0x10,%esp
+  8013ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013f3:	eb d8                	jmp    8013cd <write+0x53>
+		return -E_NOT_SUPP;
+  8013f5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013fa:	eb d1                	jmp    8013cd <write+0x53>
+
+008013fc <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8013fc:	55                   	push   %ebp
+  8013fd:	89 e5                	mov    %esp,%ebp
+  8013ff:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801402:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801405:	50                   	push   %eax
+  801406:	ff 75 08             	push   0x8(%ebp)
+  801409:	e8 38 fc ff ff       	call   801046 <fd_lookup>
+  80140e:	83 c4 10             	add    $0x10,%esp
+  801411:	85 c0                	test   %eax,%eax
+  801413:	78 0e                	js     801423 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801415:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801418:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80141b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80141e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801423:	c9                   	leave
+  801424:	c3                   	ret
+
+00801425 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801425:	55                   	push   %ebp
+  801426:	89 e5                	mov    %esp,%ebp
+  801428:	56                   	push   %esi
+  801429:	53                   	push   %ebx
+  80142a:	83 ec 18             	sub    $0x18,%esp
+  80142d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801430:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801433:	50                   	push   %eax
+  801434:	53                   	push   %ebx
+  801435:	e8 0c fc ff ff       	call   801046 <fd_lookup>
+  80143a:	83 c4 10             	add    $0x10,%esp
+  80143d:	85 c0                	test   %eax,%eax
+  80143f:	78 34                	js     801475 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801441:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801444:	83 ec 08             	sub    $0x8,%esp
+  801447:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80144a:	50                   	push   %eax
+  80144b:	ff 36                	push   (%esi)
+  80144d:	e8 44 fc ff ff       	call   801096 <dev_lookup>
+  801452:	83 c4 10             	add    $0x10,%esp
+  801455:	85 c0                	test   %eax,%eax
+  801457:	78 1c                	js     801475 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801459:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80145d:	74 1d                	je     80147c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80145f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801462:	8b 40 18             	mov    0x18(%eax),%eax
+  801465:	85 c0                	test   %eax,%eax
+  801467:	74 34                	je     80149d <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801469:	83 ec 08             	sub    $0x8,%esp
+  80146c:	ff 75 0c             	push   0xc(%ebp)
+  80146f:	56                   	push   %esi
+  801470:	ff d0                	call   *%eax
+  801472:	83 c4 10             	add    $0x10,%esp
+}
+  801475:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801478:	5b                   	pop    %ebx
+  801479:	5e                   	pop    %esi
+  80147a:	5d                   	pop    %ebp
+  80147b:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80147c:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801481:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801484:	83 ec 04             	sub    $0x4,%esp
+  801487:	53                   	push   %ebx
+  801488:	50                   	push   %eax
+  801489:	68 ec 29 80 00       	push   $0x8029ec
+  80148e:	e8 b6 ec ff ff       	call   800149 <cprintf>
+		return -E_INVAL;
+  801493:	83 c4 10             	add    $0x10,%esp
+  801496:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149b:	eb d8                	jmp    801475 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80149d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014a2:	eb d1                	jmp    801475 <ftruncate+0x50>
+
+008014a4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8014a4:	55                   	push   %ebp
+  8014a5:	89 e5                	mov    %esp,%ebp
+  8014a7:	56                   	push   %esi
+  8014a8:	53                   	push   %ebx
+  8014a9:	83 ec 18             	sub    $0x18,%esp
+  8014ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014af:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014b2:	50                   	push   %eax
+  8014b3:	ff 75 08             	push   0x8(%ebp)
+  8014b6:	e8 8b fb ff ff       	call   801046 <fd_lookup>
+  8014bb:	83 c4 10             	add    $0x10,%esp
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	78 49                	js     80150b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014c2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014c5:	83 ec 08             	sub    $0x8,%esp
+  8014c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014cb:	50                   	push   %eax
+  8014cc:	ff 36                	push   (%esi)
+  8014ce:	e8 c3 fb ff ff       	call   801096 <dev_lookup>
+  8014d3:	83 c4 10             	add    $0x10,%esp
+  8014d6:	85 c0                	test   %eax,%eax
+  8014d8:	78 31                	js     80150b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8014da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014dd:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8014e1:	74 2f                	je     801512 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8014e3:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8014e6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8014ed:	00 00 00 
+	stat->st_isdir = 0;
+  8014f0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8014f7:	00 00 00 
+	stat->st_dev = dev;
+  8014fa:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801500:	83 ec 08             	sub    $0x8,%esp
+  801503:	53                   	push   %ebx
+  801504:	56                   	push   %esi
+  801505:	ff 50 14             	call   *0x14(%eax)
+  801508:	83 c4 10             	add    $0x10,%esp
+}
+  80150b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150e:	5b                   	pop    %ebx
+  80150f:	5e                   	pop    %esi
+  801510:	5d                   	pop    %ebp
+  801511:	c3                   	ret
+		return -E_NOT_SUPP;
+  801512:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801517:	eb f2                	jmp    80150b <fstat+0x67>
+
+00801519 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801519:	55                   	push   %ebp
+  80151a:	89 e5                	mov    %esp,%ebp
+  80151c:	56                   	push   %esi
+  80151d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80151e:	83 ec 08             	sub    $0x8,%esp
+  801521:	6a 00                	push   $0x0
+  801523:	ff 75 08             	push   0x8(%ebp)
+  801526:	e8 e4 01 00 00       	call   80170f <open>
+  80152b:	89 c3                	mov    %eax,%ebx
+  80152d:	83 c4 10             	add    $0x10,%esp
+  801530:	85 c0                	test   %eax,%eax
+  801532:	78 1b                	js     80154f <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801534:	83 ec 08             	sub    $0x8,%esp
+  801537:	ff 75 0c             	push   0xc(%ebp)
+  80153a:	50                   	push   %eax
+  80153b:	e8 64 ff ff ff       	call   8014a4 <fstat>
+  801540:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801542:	89 1c 24             	mov    %ebx,(%esp)
+  801545:	e8 26 fc ff ff       	call   801170 <close>
+	return r;
+  80154a:	83 c4 10             	add    $0x10,%esp
+  80154d:	89 f3                	mov    %esi,%ebx
+}
+  80154f:	89 d8                	mov    %ebx,%eax
+  801551:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801554:	5b                   	pop    %ebx
+  801555:	5e                   	pop    %esi
+  801556:	5d                   	pop    %ebp
+  801557:	c3                   	ret
+
+00801558 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	56                   	push   %esi
+  80155c:	53                   	push   %ebx
+  80155d:	89 c6                	mov    %eax,%esi
+  80155f:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801561:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801568:	74 27                	je     801591 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80156a:	6a 07                	push   $0x7
+  80156c:	68 00 50 80 00       	push   $0x805000
+  801571:	56                   	push   %esi
+  801572:	ff 35 00 40 80 00    	push   0x804000
+  801578:	e8 1b 0c 00 00       	call   802198 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80157d:	83 c4 0c             	add    $0xc,%esp
+  801580:	6a 00                	push   $0x0
+  801582:	53                   	push   %ebx
+  801583:	6a 00                	push   $0x0
+  801585:	e8 96 0b 00 00       	call   802120 <ipc_recv>
+}
+  80158a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80158d:	5b                   	pop    %ebx
+  80158e:	5e                   	pop    %esi
+  80158f:	5d                   	pop    %ebp
+  801590:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801591:	83 ec 0c             	sub    $0xc,%esp
+  801594:	6a 01                	push   $0x1
+  801596:	e8 51 0c 00 00       	call   8021ec <ipc_find_env>
+  80159b:	a3 00 40 80 00       	mov    %eax,0x804000
+  8015a0:	83 c4 10             	add    $0x10,%esp
+  8015a3:	eb c5                	jmp    80156a <fsipc+0x12>
+
+008015a5 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8015a5:	55                   	push   %ebp
+  8015a6:	89 e5                	mov    %esp,%ebp
+  8015a8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8015ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015ae:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015b1:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8015b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015b9:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8015be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8015c8:	e8 8b ff ff ff       	call   801558 <fsipc>
+}
+  8015cd:	c9                   	leave
+  8015ce:	c3                   	ret
+
+008015cf <devfile_flush>:
+{
+  8015cf:	55                   	push   %ebp
+  8015d0:	89 e5                	mov    %esp,%ebp
+  8015d2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8015d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015d8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015db:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8015e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015ea:	e8 69 ff ff ff       	call   801558 <fsipc>
+}
+  8015ef:	c9                   	leave
+  8015f0:	c3                   	ret
+
+008015f1 <devfile_stat>:
+{
+  8015f1:	55                   	push   %ebp
+  8015f2:	89 e5                	mov    %esp,%ebp
+  8015f4:	53                   	push   %ebx
+  8015f5:	83 ec 04             	sub    $0x4,%esp
+  8015f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8015fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015fe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801601:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801606:	ba 00 00 00 00       	mov    $0x0,%edx
+  80160b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801610:	e8 43 ff ff ff       	call   801558 <fsipc>
+  801615:	85 c0                	test   %eax,%eax
+  801617:	78 2c                	js     801645 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801619:	83 ec 08             	sub    $0x8,%esp
+  80161c:	68 00 50 80 00       	push   $0x805000
+  801621:	53                   	push   %ebx
+  801622:	e8 10 f1 ff ff       	call   800737 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801627:	a1 80 50 80 00       	mov    0x805080,%eax
+  80162c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801632:	a1 84 50 80 00       	mov    0x805084,%eax
+  801637:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80163d:	83 c4 10             	add    $0x10,%esp
+  801640:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801645:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801648:	c9                   	leave
+  801649:	c3                   	ret
+
+0080164a <devfile_write>:
+{
+  80164a:	55                   	push   %ebp
+  80164b:	89 e5                	mov    %esp,%ebp
+  80164d:	83 ec 0c             	sub    $0xc,%esp
+  801650:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801653:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801658:	39 d0                	cmp    %edx,%eax
+  80165a:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80165d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801660:	8b 52 0c             	mov    0xc(%edx),%edx
+  801663:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801669:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80166e:	50                   	push   %eax
+  80166f:	ff 75 0c             	push   0xc(%ebp)
+  801672:	68 08 50 80 00       	push   $0x805008
+  801677:	e8 41 f2 ff ff       	call   8008bd <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80167c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801681:	b8 04 00 00 00       	mov    $0x4,%eax
+  801686:	e8 cd fe ff ff       	call   801558 <fsipc>
+}
+  80168b:	c9                   	leave
+  80168c:	c3                   	ret
+
+0080168d <devfile_read>:
+{
+  80168d:	55                   	push   %ebp
+  80168e:	89 e5                	mov    %esp,%ebp
+  801690:	56                   	push   %esi
+  801691:	53                   	push   %ebx
+  801692:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801695:	8b 45 08             	mov    0x8(%ebp),%eax
+  801698:	8b 40 0c             	mov    0xc(%eax),%eax
+  80169b:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  8016a0:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8016a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ab:	b8 03 00 00 00       	mov    $0x3,%eax
+  8016b0:	e8 a3 fe ff ff       	call   801558 <fsipc>
+  8016b5:	89 c3                	mov    %eax,%ebx
+  8016b7:	85 c0                	test   %eax,%eax
+  8016b9:	78 1f                	js     8016da <devfile_read+0x4d>
+	assert(r <= n);
+  8016bb:	39 c6                	cmp    %eax,%esi
+  8016bd:	72 24                	jb     8016e3 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8016bf:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8016c4:	7f 33                	jg     8016f9 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8016c6:	83 ec 04             	sub    $0x4,%esp
+  8016c9:	50                   	push   %eax
+  8016ca:	68 00 50 80 00       	push   $0x805000
+  8016cf:	ff 75 0c             	push   0xc(%ebp)
+  8016d2:	e8 e6 f1 ff ff       	call   8008bd <memmove>
+	return r;
+  8016d7:	83 c4 10             	add    $0x10,%esp
+}
+  8016da:	89 d8                	mov    %ebx,%eax
+  8016dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016df:	5b                   	pop    %ebx
+  8016e0:	5e                   	pop    %esi
+  8016e1:	5d                   	pop    %ebp
+  8016e2:	c3                   	ret
+	assert(r <= n);
+  8016e3:	68 5c 2a 80 00       	push   $0x802a5c
+  8016e8:	68 63 2a 80 00       	push   $0x802a63
+  8016ed:	6a 7c                	push   $0x7c
+  8016ef:	68 78 2a 80 00       	push   $0x802a78
+  8016f4:	e8 e1 09 00 00       	call   8020da <_panic>
+	assert(r <= PGSIZE);
+  8016f9:	68 83 2a 80 00       	push   $0x802a83
+  8016fe:	68 63 2a 80 00       	push   $0x802a63
+  801703:	6a 7d                	push   $0x7d
+  801705:	68 78 2a 80 00       	push   $0x802a78
+  80170a:	e8 cb 09 00 00       	call   8020da <_panic>
+
+0080170f <open>:
+{
+  80170f:	55                   	push   %ebp
+  801710:	89 e5                	mov    %esp,%ebp
+  801712:	56                   	push   %esi
+  801713:	53                   	push   %ebx
+  801714:	83 ec 1c             	sub    $0x1c,%esp
+  801717:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80171a:	56                   	push   %esi
+  80171b:	e8 dc ef ff ff       	call   8006fc <strlen>
+  801720:	83 c4 10             	add    $0x10,%esp
+  801723:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801728:	7f 6c                	jg     801796 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80172a:	83 ec 0c             	sub    $0xc,%esp
+  80172d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801730:	50                   	push   %eax
+  801731:	e8 ba f8 ff ff       	call   800ff0 <fd_alloc>
+  801736:	89 c3                	mov    %eax,%ebx
+  801738:	83 c4 10             	add    $0x10,%esp
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	78 3c                	js     80177b <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80173f:	83 ec 08             	sub    $0x8,%esp
+  801742:	56                   	push   %esi
+  801743:	68 00 50 80 00       	push   $0x805000
+  801748:	e8 ea ef ff ff       	call   800737 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80174d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801750:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801755:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801758:	b8 01 00 00 00       	mov    $0x1,%eax
+  80175d:	e8 f6 fd ff ff       	call   801558 <fsipc>
+  801762:	89 c3                	mov    %eax,%ebx
+  801764:	83 c4 10             	add    $0x10,%esp
+  801767:	85 c0                	test   %eax,%eax
+  801769:	78 19                	js     801784 <open+0x75>
+	return fd2num(fd);
+  80176b:	83 ec 0c             	sub    $0xc,%esp
+  80176e:	ff 75 f4             	push   -0xc(%ebp)
+  801771:	e8 53 f8 ff ff       	call   800fc9 <fd2num>
+  801776:	89 c3                	mov    %eax,%ebx
+  801778:	83 c4 10             	add    $0x10,%esp
+}
+  80177b:	89 d8                	mov    %ebx,%eax
+  80177d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801780:	5b                   	pop    %ebx
+  801781:	5e                   	pop    %esi
+  801782:	5d                   	pop    %ebp
+  801783:	c3                   	ret
+		fd_close(fd, 0);
+  801784:	83 ec 08             	sub    $0x8,%esp
+  801787:	6a 00                	push   $0x0
+  801789:	ff 75 f4             	push   -0xc(%ebp)
+  80178c:	e8 58 f9 ff ff       	call   8010e9 <fd_close>
+		return r;
+  801791:	83 c4 10             	add    $0x10,%esp
+  801794:	eb e5                	jmp    80177b <open+0x6c>
+		return -E_BAD_PATH;
+  801796:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80179b:	eb de                	jmp    80177b <open+0x6c>
+
+0080179d <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80179d:	55                   	push   %ebp
+  80179e:	89 e5                	mov    %esp,%ebp
+  8017a0:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8017a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017ad:	e8 a6 fd ff ff       	call   801558 <fsipc>
+}
+  8017b2:	c9                   	leave
+  8017b3:	c3                   	ret
+
+008017b4 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8017b4:	55                   	push   %ebp
+  8017b5:	89 e5                	mov    %esp,%ebp
+  8017b7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8017ba:	68 8f 2a 80 00       	push   $0x802a8f
+  8017bf:	ff 75 0c             	push   0xc(%ebp)
+  8017c2:	e8 70 ef ff ff       	call   800737 <strcpy>
+	return 0;
+}
+  8017c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cc:	c9                   	leave
+  8017cd:	c3                   	ret
+
+008017ce <devsock_close>:
+{
+  8017ce:	55                   	push   %ebp
+  8017cf:	89 e5                	mov    %esp,%ebp
+  8017d1:	53                   	push   %ebx
+  8017d2:	83 ec 10             	sub    $0x10,%esp
+  8017d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8017d8:	53                   	push   %ebx
+  8017d9:	e8 1e 0a 00 00       	call   8021fc <pageref>
+  8017de:	89 c2                	mov    %eax,%edx
+  8017e0:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8017e3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8017e8:	83 fa 01             	cmp    $0x1,%edx
+  8017eb:	74 05                	je     8017f2 <devsock_close+0x24>
+}
+  8017ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017f0:	c9                   	leave
+  8017f1:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8017f2:	83 ec 0c             	sub    $0xc,%esp
+  8017f5:	ff 73 0c             	push   0xc(%ebx)
+  8017f8:	e8 b7 02 00 00       	call   801ab4 <nsipc_close>
+  8017fd:	83 c4 10             	add    $0x10,%esp
+  801800:	eb eb                	jmp    8017ed <devsock_close+0x1f>
+
+00801802 <devsock_write>:
+{
+  801802:	55                   	push   %ebp
+  801803:	89 e5                	mov    %esp,%ebp
+  801805:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801808:	6a 00                	push   $0x0
+  80180a:	ff 75 10             	push   0x10(%ebp)
+  80180d:	ff 75 0c             	push   0xc(%ebp)
+  801810:	8b 45 08             	mov    0x8(%ebp),%eax
+  801813:	ff 70 0c             	push   0xc(%eax)
+  801816:	e8 79 03 00 00       	call   801b94 <nsipc_send>
+}
+  80181b:	c9                   	leave
+  80181c:	c3                   	ret
+
+0080181d <devsock_read>:
+{
+  80181d:	55                   	push   %ebp
+  80181e:	89 e5                	mov    %esp,%ebp
+  801820:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801823:	6a 00                	push   $0x0
+  801825:	ff 75 10             	push   0x10(%ebp)
+  801828:	ff 75 0c             	push   0xc(%ebp)
+  80182b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80182e:	ff 70 0c             	push   0xc(%eax)
+  801831:	e8 ef 02 00 00       	call   801b25 <nsipc_recv>
+}
+  801836:	c9                   	leave
+  801837:	c3                   	ret
+
+00801838 <fd2sockid>:
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80183e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801841:	52                   	push   %edx
+  801842:	50                   	push   %eax
+  801843:	e8 fe f7 ff ff       	call   801046 <fd_lookup>
+  801848:	83 c4 10             	add    $0x10,%esp
+  80184b:	85 c0                	test   %eax,%eax
+  80184d:	78 10                	js     80185f <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80184f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801852:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801858:	39 08                	cmp    %ecx,(%eax)
+  80185a:	75 05                	jne    801861 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80185c:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80185f:	c9                   	leave
+  801860:	c3                   	ret
+		return -E_NOT_SUPP;
+  801861:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801866:	eb f7                	jmp    80185f <fd2sockid+0x27>
+
+00801868 <alloc_sockfd>:
+{
+  801868:	55                   	push   %ebp
+  801869:	89 e5                	mov    %esp,%ebp
+  80186b:	56                   	push   %esi
+  80186c:	53                   	push   %ebx
+  80186d:	83 ec 1c             	sub    $0x1c,%esp
+  801870:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801872:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801875:	50                   	push   %eax
+  801876:	e8 75 f7 ff ff       	call   800ff0 <fd_alloc>
+  80187b:	89 c3                	mov    %eax,%ebx
+  80187d:	83 c4 10             	add    $0x10,%esp
+  801880:	85 c0                	test   %eax,%eax
+  801882:	78 43                	js     8018c7 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801884:	83 ec 04             	sub    $0x4,%esp
+  801887:	68 07 04 00 00       	push   $0x407
+  80188c:	ff 75 f4             	push   -0xc(%ebp)
+  80188f:	6a 00                	push   $0x0
+  801891:	e8 0e f3 ff ff       	call   800ba4 <sys_page_alloc>
+  801896:	89 c3                	mov    %eax,%ebx
+  801898:	83 c4 10             	add    $0x10,%esp
+  80189b:	85 c0                	test   %eax,%eax
+  80189d:	78 28                	js     8018c7 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80189f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018a2:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8018a8:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8018aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018ad:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8018b4:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8018b7:	83 ec 0c             	sub    $0xc,%esp
+  8018ba:	50                   	push   %eax
+  8018bb:	e8 09 f7 ff ff       	call   800fc9 <fd2num>
+  8018c0:	89 c3                	mov    %eax,%ebx
+  8018c2:	83 c4 10             	add    $0x10,%esp
+  8018c5:	eb 0c                	jmp    8018d3 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8018c7:	83 ec 0c             	sub    $0xc,%esp
+  8018ca:	56                   	push   %esi
+  8018cb:	e8 e4 01 00 00       	call   801ab4 <nsipc_close>
+		return r;
+  8018d0:	83 c4 10             	add    $0x10,%esp
+}
+  8018d3:	89 d8                	mov    %ebx,%eax
+  8018d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018d8:	5b                   	pop    %ebx
+  8018d9:	5e                   	pop    %esi
+  8018da:	5d                   	pop    %ebp
+  8018db:	c3                   	ret
+
+008018dc <accept>:
+{
+  8018dc:	55                   	push   %ebp
+  8018dd:	89 e5                	mov    %esp,%ebp
+  8018df:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8018e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e5:	e8 4e ff ff ff       	call   801838 <fd2sockid>
+  8018ea:	85 c0                	test   %eax,%eax
+  8018ec:	78 1b                	js     801909 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8018ee:	83 ec 04             	sub    $0x4,%esp
+  8018f1:	ff 75 10             	push   0x10(%ebp)
+  8018f4:	ff 75 0c             	push   0xc(%ebp)
+  8018f7:	50                   	push   %eax
+  8018f8:	e8 0e 01 00 00       	call   801a0b <nsipc_accept>
+  8018fd:	83 c4 10             	add    $0x10,%esp
+  801900:	85 c0                	test   %eax,%eax
+  801902:	78 05                	js     801909 <accept+0x2d>
+	return alloc_sockfd(r);
+  801904:	e8 5f ff ff ff       	call   801868 <alloc_sockfd>
+}
+  801909:	c9                   	leave
+  80190a:	c3                   	ret
+
+0080190b <bind>:
+{
+  80190b:	55                   	push   %ebp
+  80190c:	89 e5                	mov    %esp,%ebp
+  80190e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801911:	8b 45 08             	mov    0x8(%ebp),%eax
+  801914:	e8 1f ff ff ff       	call   801838 <fd2sockid>
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	78 12                	js     80192f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80191d:	83 ec 04             	sub    $0x4,%esp
+  801920:	ff 75 10             	push   0x10(%ebp)
+  801923:	ff 75 0c             	push   0xc(%ebp)
+  801926:	50                   	push   %eax
+  801927:	e8 31 01 00 00       	call   801a5d <nsipc_bind>
+  80192c:	83 c4 10             	add    $0x10,%esp
+}
+  80192f:	c9                   	leave
+  801930:	c3                   	ret
+
+00801931 <shutdown>:
+{
+  801931:	55                   	push   %ebp
+  801932:	89 e5                	mov    %esp,%ebp
+  801934:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801937:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193a:	e8 f9 fe ff ff       	call   801838 <fd2sockid>
+  80193f:	85 c0                	test   %eax,%eax
+  801941:	78 0f                	js     801952 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801943:	83 ec 08             	sub    $0x8,%esp
+  801946:	ff 75 0c             	push   0xc(%ebp)
+  801949:	50                   	push   %eax
+  80194a:	e8 43 01 00 00       	call   801a92 <nsipc_shutdown>
+  80194f:	83 c4 10             	add    $0x10,%esp
+}
+  801952:	c9                   	leave
+  801953:	c3                   	ret
+
+00801954 <connect>:
+{
+  801954:	55                   	push   %ebp
+  801955:	89 e5                	mov    %esp,%ebp
+  801957:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80195a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195d:	e8 d6 fe ff ff       	call   801838 <fd2sockid>
+  801962:	85 c0                	test   %eax,%eax
+  801964:	78 12                	js     801978 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801966:	83 ec 04             	sub    $0x4,%esp
+  801969:	ff 75 10             	push   0x10(%ebp)
+  80196c:	ff 75 0c             	push   0xc(%ebp)
+  80196f:	50                   	push   %eax
+  801970:	e8 59 01 00 00       	call   801ace <nsipc_connect>
+  801975:	83 c4 10             	add    $0x10,%esp
+}
+  801978:	c9                   	leave
+  801979:	c3                   	ret
+
+0080197a <listen>:
+{
+  80197a:	55                   	push   %ebp
+  80197b:	89 e5                	mov    %esp,%ebp
+  80197d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801980:	8b 45 08             	mov    0x8(%ebp),%eax
+  801983:	e8 b0 fe ff ff       	call   801838 <fd2sockid>
+  801988:	85 c0                	test   %eax,%eax
+  80198a:	78 0f                	js     80199b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80198c:	83 ec 08             	sub    $0x8,%esp
+  80198f:	ff 75 0c             	push   0xc(%ebp)
+  801992:	50                   	push   %eax
+  801993:	e8 6b 01 00 00       	call   801b03 <nsipc_listen>
+  801998:	83 c4 10             	add    $0x10,%esp
+}
+  80199b:	c9                   	leave
+  80199c:	c3                   	ret
+
+0080199d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80199d:	55                   	push   %ebp
+  80199e:	89 e5                	mov    %esp,%ebp
+  8019a0:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8019a3:	ff 75 10             	push   0x10(%ebp)
+  8019a6:	ff 75 0c             	push   0xc(%ebp)
+  8019a9:	ff 75 08             	push   0x8(%ebp)
+  8019ac:	e8 41 02 00 00       	call   801bf2 <nsipc_socket>
+  8019b1:	83 c4 10             	add    $0x10,%esp
+  8019b4:	85 c0                	test   %eax,%eax
+  8019b6:	78 05                	js     8019bd <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8019b8:	e8 ab fe ff ff       	call   801868 <alloc_sockfd>
+}
+  8019bd:	c9                   	leave
+  8019be:	c3                   	ret
+
+008019bf <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8019bf:	55                   	push   %ebp
+  8019c0:	89 e5                	mov    %esp,%ebp
+  8019c2:	53                   	push   %ebx
+  8019c3:	83 ec 04             	sub    $0x4,%esp
+  8019c6:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8019c8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019cf:	74 26                	je     8019f7 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8019d1:	6a 07                	push   $0x7
+  8019d3:	68 00 60 80 00       	push   $0x806000
+  8019d8:	53                   	push   %ebx
+  8019d9:	ff 35 04 40 80 00    	push   0x804004
+  8019df:	e8 b4 07 00 00       	call   802198 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8019e4:	83 c4 0c             	add    $0xc,%esp
+  8019e7:	6a 00                	push   $0x0
+  8019e9:	6a 00                	push   $0x0
+  8019eb:	6a 00                	push   $0x0
+  8019ed:	e8 2e 07 00 00       	call   802120 <ipc_recv>
+}
+  8019f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f5:	c9                   	leave
+  8019f6:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8019f7:	83 ec 0c             	sub    $0xc,%esp
+  8019fa:	6a 02                	push   $0x2
+  8019fc:	e8 eb 07 00 00       	call   8021ec <ipc_find_env>
+  801a01:	a3 04 40 80 00       	mov    %eax,0x804004
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	eb c6                	jmp    8019d1 <nsipc+0x12>
+
+00801a0b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801a0b:	55                   	push   %ebp
+  801a0c:	89 e5                	mov    %esp,%ebp
+  801a0e:	56                   	push   %esi
+  801a0f:	53                   	push   %ebx
+  801a10:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801a13:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a16:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801a1b:	8b 06                	mov    (%esi),%eax
+  801a1d:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801a22:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a27:	e8 93 ff ff ff       	call   8019bf <nsipc>
+  801a2c:	89 c3                	mov    %eax,%ebx
+  801a2e:	85 c0                	test   %eax,%eax
+  801a30:	79 09                	jns    801a3b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801a32:	89 d8                	mov    %ebx,%eax
+  801a34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a37:	5b                   	pop    %ebx
+  801a38:	5e                   	pop    %esi
+  801a39:	5d                   	pop    %ebp
+  801a3a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801a3b:	83 ec 04             	sub    $0x4,%esp
+  801a3e:	ff 35 10 60 80 00    	push   0x806010
+  801a44:	68 00 60 80 00       	push   $0x806000
+  801a49:	ff 75 0c             	push   0xc(%ebp)
+  801a4c:	e8 6c ee ff ff       	call   8008bd <memmove>
+		*addrlen = ret->ret_addrlen;
+  801a51:	a1 10 60 80 00       	mov    0x806010,%eax
+  801a56:	89 06                	mov    %eax,(%esi)
+  801a58:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801a5b:	eb d5                	jmp    801a32 <nsipc_accept+0x27>
+
+00801a5d <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801a5d:	55                   	push   %ebp
+  801a5e:	89 e5                	mov    %esp,%ebp
+  801a60:	53                   	push   %ebx
+  801a61:	83 ec 08             	sub    $0x8,%esp
+  801a64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801a67:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a6a:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801a6f:	53                   	push   %ebx
+  801a70:	ff 75 0c             	push   0xc(%ebp)
+  801a73:	68 04 60 80 00       	push   $0x806004
+  801a78:	e8 40 ee ff ff       	call   8008bd <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801a7d:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801a83:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a88:	e8 32 ff ff ff       	call   8019bf <nsipc>
+}
+  801a8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a90:	c9                   	leave
+  801a91:	c3                   	ret
+
+00801a92 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801a92:	55                   	push   %ebp
+  801a93:	89 e5                	mov    %esp,%ebp
+  801a95:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801a98:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a9b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801aa0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aa3:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801aa8:	b8 03 00 00 00       	mov    $0x3,%eax
+  801aad:	e8 0d ff ff ff       	call   8019bf <nsipc>
+}
+  801ab2:	c9                   	leave
+  801ab3:	c3                   	ret
+
+00801ab4 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801ab4:	55                   	push   %ebp
+  801ab5:	89 e5                	mov    %esp,%ebp
+  801ab7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801aba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abd:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801ac2:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ac7:	e8 f3 fe ff ff       	call   8019bf <nsipc>
+}
+  801acc:	c9                   	leave
+  801acd:	c3                   	ret
+
+00801ace <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801ace:	55                   	push   %ebp
+  801acf:	89 e5                	mov    %esp,%ebp
+  801ad1:	53                   	push   %ebx
+  801ad2:	83 ec 08             	sub    $0x8,%esp
+  801ad5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801ad8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801adb:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801ae0:	53                   	push   %ebx
+  801ae1:	ff 75 0c             	push   0xc(%ebp)
+  801ae4:	68 04 60 80 00       	push   $0x806004
+  801ae9:	e8 cf ed ff ff       	call   8008bd <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801aee:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801af4:	b8 05 00 00 00       	mov    $0x5,%eax
+  801af9:	e8 c1 fe ff ff       	call   8019bf <nsipc>
+}
+  801afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b01:	c9                   	leave
+  801b02:	c3                   	ret
+
+00801b03 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801b03:	55                   	push   %ebp
+  801b04:	89 e5                	mov    %esp,%ebp
+  801b06:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801b09:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b0c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801b11:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b14:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801b19:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b1e:	e8 9c fe ff ff       	call   8019bf <nsipc>
+}
+  801b23:	c9                   	leave
+  801b24:	c3                   	ret
+
+00801b25 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801b25:	55                   	push   %ebp
+  801b26:	89 e5                	mov    %esp,%ebp
+  801b28:	56                   	push   %esi
+  801b29:	53                   	push   %ebx
+  801b2a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801b2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b30:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801b35:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801b3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b3e:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801b43:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b48:	e8 72 fe ff ff       	call   8019bf <nsipc>
+  801b4d:	89 c3                	mov    %eax,%ebx
+  801b4f:	85 c0                	test   %eax,%eax
+  801b51:	78 22                	js     801b75 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801b53:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801b58:	39 c6                	cmp    %eax,%esi
+  801b5a:	0f 4e c6             	cmovle %esi,%eax
+  801b5d:	39 c3                	cmp    %eax,%ebx
+  801b5f:	7f 1d                	jg     801b7e <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801b61:	83 ec 04             	sub    $0x4,%esp
+  801b64:	53                   	push   %ebx
+  801b65:	68 00 60 80 00       	push   $0x806000
+  801b6a:	ff 75 0c             	push   0xc(%ebp)
+  801b6d:	e8 4b ed ff ff       	call   8008bd <memmove>
+  801b72:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801b75:	89 d8                	mov    %ebx,%eax
+  801b77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b7a:	5b                   	pop    %ebx
+  801b7b:	5e                   	pop    %esi
+  801b7c:	5d                   	pop    %ebp
+  801b7d:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801b7e:	68 9b 2a 80 00       	push   $0x802a9b
+  801b83:	68 63 2a 80 00       	push   $0x802a63
+  801b88:	6a 62                	push   $0x62
+  801b8a:	68 b0 2a 80 00       	push   $0x802ab0
+  801b8f:	e8 46 05 00 00       	call   8020da <_panic>
+
+00801b94 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801b94:	55                   	push   %ebp
+  801b95:	89 e5                	mov    %esp,%ebp
+  801b97:	53                   	push   %ebx
+  801b98:	83 ec 04             	sub    $0x4,%esp
+  801b9b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801b9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba1:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801ba6:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801bac:	7f 2e                	jg     801bdc <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801bae:	83 ec 04             	sub    $0x4,%esp
+  801bb1:	53                   	push   %ebx
+  801bb2:	ff 75 0c             	push   0xc(%ebp)
+  801bb5:	68 0c 60 80 00       	push   $0x80600c
+  801bba:	e8 fe ec ff ff       	call   8008bd <memmove>
+	nsipcbuf.send.req_size = size;
+  801bbf:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801bc5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bc8:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801bcd:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bd2:	e8 e8 fd ff ff       	call   8019bf <nsipc>
+}
+  801bd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bda:	c9                   	leave
+  801bdb:	c3                   	ret
+	assert(size < 1600);
+  801bdc:	68 bc 2a 80 00       	push   $0x802abc
+  801be1:	68 63 2a 80 00       	push   $0x802a63
+  801be6:	6a 6d                	push   $0x6d
+  801be8:	68 b0 2a 80 00       	push   $0x802ab0
+  801bed:	e8 e8 04 00 00       	call   8020da <_panic>
+
+00801bf2 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801bf2:	55                   	push   %ebp
+  801bf3:	89 e5                	mov    %esp,%ebp
+  801bf5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801bf8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bfb:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801c00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c03:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801c08:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c0b:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801c10:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c15:	e8 a5 fd ff ff       	call   8019bf <nsipc>
+}
+  801c1a:	c9                   	leave
+  801c1b:	c3                   	ret
+
+00801c1c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c1c:	55                   	push   %ebp
+  801c1d:	89 e5                	mov    %esp,%ebp
+  801c1f:	56                   	push   %esi
+  801c20:	53                   	push   %ebx
+  801c21:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801c24:	83 ec 0c             	sub    $0xc,%esp
+  801c27:	ff 75 08             	push   0x8(%ebp)
+  801c2a:	e8 aa f3 ff ff       	call   800fd9 <fd2data>
+  801c2f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801c31:	83 c4 08             	add    $0x8,%esp
+  801c34:	68 c8 2a 80 00       	push   $0x802ac8
+  801c39:	53                   	push   %ebx
+  801c3a:	e8 f8 ea ff ff       	call   800737 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801c3f:	8b 46 04             	mov    0x4(%esi),%eax
+  801c42:	2b 06                	sub    (%esi),%eax
+  801c44:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801c4a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c51:	00 00 00 
+	stat->st_dev = &devpipe;
+  801c54:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801c5b:	30 80 00 
+	return 0;
+}
+  801c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c66:	5b                   	pop    %ebx
+  801c67:	5e                   	pop    %esi
+  801c68:	5d                   	pop    %ebp
+  801c69:	c3                   	ret
+
+00801c6a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801c6a:	55                   	push   %ebp
+  801c6b:	89 e5                	mov    %esp,%ebp
+  801c6d:	53                   	push   %ebx
+  801c6e:	83 ec 0c             	sub    $0xc,%esp
+  801c71:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801c74:	53                   	push   %ebx
+  801c75:	6a 00                	push   $0x0
+  801c77:	e8 f0 ef ff ff       	call   800c6c <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801c7c:	89 1c 24             	mov    %ebx,(%esp)
+  801c7f:	e8 55 f3 ff ff       	call   800fd9 <fd2data>
+  801c84:	83 c4 08             	add    $0x8,%esp
+  801c87:	50                   	push   %eax
+  801c88:	6a 00                	push   $0x0
+  801c8a:	e8 dd ef ff ff       	call   800c6c <sys_page_unmap>
+}
+  801c8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c92:	c9                   	leave
+  801c93:	c3                   	ret
+
+00801c94 <_pipeisclosed>:
+{
+  801c94:	55                   	push   %ebp
+  801c95:	89 e5                	mov    %esp,%ebp
+  801c97:	57                   	push   %edi
+  801c98:	56                   	push   %esi
+  801c99:	53                   	push   %ebx
+  801c9a:	83 ec 1c             	sub    $0x1c,%esp
+  801c9d:	89 c7                	mov    %eax,%edi
+  801c9f:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801ca1:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801ca6:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801ca9:	83 ec 0c             	sub    $0xc,%esp
+  801cac:	57                   	push   %edi
+  801cad:	e8 4a 05 00 00       	call   8021fc <pageref>
+  801cb2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801cb5:	89 34 24             	mov    %esi,(%esp)
+  801cb8:	e8 3f 05 00 00       	call   8021fc <pageref>
+		nn = thisenv->env_runs;
+  801cbd:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  801cc3:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801cc6:	83 c4 10             	add    $0x10,%esp
+  801cc9:	39 cb                	cmp    %ecx,%ebx
+  801ccb:	74 1b                	je     801ce8 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801ccd:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801cd0:	75 cf                	jne    801ca1 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801cd2:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801cd5:	6a 01                	push   $0x1
+  801cd7:	50                   	push   %eax
+  801cd8:	53                   	push   %ebx
+  801cd9:	68 cf 2a 80 00       	push   $0x802acf
+  801cde:	e8 66 e4 ff ff       	call   800149 <cprintf>
+  801ce3:	83 c4 10             	add    $0x10,%esp
+  801ce6:	eb b9                	jmp    801ca1 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801ce8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ceb:	0f 94 c0             	sete   %al
+  801cee:	0f b6 c0             	movzbl %al,%eax
+}
+  801cf1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf4:	5b                   	pop    %ebx
+  801cf5:	5e                   	pop    %esi
+  801cf6:	5f                   	pop    %edi
+  801cf7:	5d                   	pop    %ebp
+  801cf8:	c3                   	ret
+
+00801cf9 <devpipe_write>:
+{
+  801cf9:	55                   	push   %ebp
+  801cfa:	89 e5                	mov    %esp,%ebp
+  801cfc:	57                   	push   %edi
+  801cfd:	56                   	push   %esi
+  801cfe:	53                   	push   %ebx
+  801cff:	83 ec 28             	sub    $0x28,%esp
+  801d02:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801d05:	56                   	push   %esi
+  801d06:	e8 ce f2 ff ff       	call   800fd9 <fd2data>
+  801d0b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d0d:	83 c4 10             	add    $0x10,%esp
+  801d10:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d15:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801d18:	75 09                	jne    801d23 <devpipe_write+0x2a>
+	return i;
+  801d1a:	89 f8                	mov    %edi,%eax
+  801d1c:	eb 23                	jmp    801d41 <devpipe_write+0x48>
+			sys_yield();
+  801d1e:	e8 01 ee ff ff       	call   800b24 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801d23:	8b 43 04             	mov    0x4(%ebx),%eax
+  801d26:	8b 0b                	mov    (%ebx),%ecx
+  801d28:	8d 51 20             	lea    0x20(%ecx),%edx
+  801d2b:	39 d0                	cmp    %edx,%eax
+  801d2d:	72 1a                	jb     801d49 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801d2f:	89 da                	mov    %ebx,%edx
+  801d31:	89 f0                	mov    %esi,%eax
+  801d33:	e8 5c ff ff ff       	call   801c94 <_pipeisclosed>
+  801d38:	85 c0                	test   %eax,%eax
+  801d3a:	74 e2                	je     801d1e <devpipe_write+0x25>
+				return 0;
+  801d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d44:	5b                   	pop    %ebx
+  801d45:	5e                   	pop    %esi
+  801d46:	5f                   	pop    %edi
+  801d47:	5d                   	pop    %ebp
+  801d48:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d4c:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801d50:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801d53:	89 c2                	mov    %eax,%edx
+  801d55:	c1 fa 1f             	sar    $0x1f,%edx
+  801d58:	89 d1                	mov    %edx,%ecx
+  801d5a:	c1 e9 1b             	shr    $0x1b,%ecx
+  801d5d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801d60:	83 e2 1f             	and    $0x1f,%edx
+  801d63:	29 ca                	sub    %ecx,%edx
+  801d65:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801d69:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801d6d:	83 c0 01             	add    $0x1,%eax
+  801d70:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801d73:	83 c7 01             	add    $0x1,%edi
+  801d76:	eb 9d                	jmp    801d15 <devpipe_write+0x1c>
+
+00801d78 <devpipe_read>:
+{
+  801d78:	55                   	push   %ebp
+  801d79:	89 e5                	mov    %esp,%ebp
+  801d7b:	57                   	push   %edi
+  801d7c:	56                   	push   %esi
+  801d7d:	53                   	push   %ebx
+  801d7e:	83 ec 18             	sub    $0x18,%esp
+  801d81:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801d84:	57                   	push   %edi
+  801d85:	e8 4f f2 ff ff       	call   800fd9 <fd2data>
+  801d8a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d8c:	83 c4 10             	add    $0x10,%esp
+  801d8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d94:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801d97:	75 13                	jne    801dac <devpipe_read+0x34>
+	return i;
+  801d99:	89 f0                	mov    %esi,%eax
+  801d9b:	eb 02                	jmp    801d9f <devpipe_read+0x27>
+				return i;
+  801d9d:	89 f0                	mov    %esi,%eax
+}
+  801d9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da2:	5b                   	pop    %ebx
+  801da3:	5e                   	pop    %esi
+  801da4:	5f                   	pop    %edi
+  801da5:	5d                   	pop    %ebp
+  801da6:	c3                   	ret
+			sys_yield();
+  801da7:	e8 78 ed ff ff       	call   800b24 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801dac:	8b 03                	mov    (%ebx),%eax
+  801dae:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801db1:	75 18                	jne    801dcb <devpipe_read+0x53>
+			if (i > 0)
+  801db3:	85 f6                	test   %esi,%esi
+  801db5:	75 e6                	jne    801d9d <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801db7:	89 da                	mov    %ebx,%edx
+  801db9:	89 f8                	mov    %edi,%eax
+  801dbb:	e8 d4 fe ff ff       	call   801c94 <_pipeisclosed>
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	74 e3                	je     801da7 <devpipe_read+0x2f>
+				return 0;
+  801dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc9:	eb d4                	jmp    801d9f <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801dcb:	99                   	cltd
+  801dcc:	c1 ea 1b             	shr    $0x1b,%edx
+  801dcf:	01 d0                	add    %edx,%eax
+  801dd1:	83 e0 1f             	and    $0x1f,%eax
+  801dd4:	29 d0                	sub    %edx,%eax
+  801dd6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ddb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dde:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801de1:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801de4:	83 c6 01             	add    $0x1,%esi
+  801de7:	eb ab                	jmp    801d94 <devpipe_read+0x1c>
+
+00801de9 <pipe>:
+{
+  801de9:	55                   	push   %ebp
+  801dea:	89 e5                	mov    %esp,%ebp
+  801dec:	56                   	push   %esi
+  801ded:	53                   	push   %ebx
+  801dee:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801df1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df4:	50                   	push   %eax
+  801df5:	e8 f6 f1 ff ff       	call   800ff0 <fd_alloc>
+  801dfa:	89 c3                	mov    %eax,%ebx
+  801dfc:	83 c4 10             	add    $0x10,%esp
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	0f 88 23 01 00 00    	js     801f2a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e07:	83 ec 04             	sub    $0x4,%esp
+  801e0a:	68 07 04 00 00       	push   $0x407
+  801e0f:	ff 75 f4             	push   -0xc(%ebp)
+  801e12:	6a 00                	push   $0x0
+  801e14:	e8 8b ed ff ff       	call   800ba4 <sys_page_alloc>
+  801e19:	89 c3                	mov    %eax,%ebx
+  801e1b:	83 c4 10             	add    $0x10,%esp
+  801e1e:	85 c0                	test   %eax,%eax
+  801e20:	0f 88 04 01 00 00    	js     801f2a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801e26:	83 ec 0c             	sub    $0xc,%esp
+  801e29:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e2c:	50                   	push   %eax
+  801e2d:	e8 be f1 ff ff       	call   800ff0 <fd_alloc>
+  801e32:	89 c3                	mov    %eax,%ebx
+  801e34:	83 c4 10             	add    $0x10,%esp
+  801e37:	85 c0                	test   %eax,%eax
+  801e39:	0f 88 db 00 00 00    	js     801f1a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e3f:	83 ec 04             	sub    $0x4,%esp
+  801e42:	68 07 04 00 00       	push   $0x407
+  801e47:	ff 75 f0             	push   -0x10(%ebp)
+  801e4a:	6a 00                	push   $0x0
+  801e4c:	e8 53 ed ff ff       	call   800ba4 <sys_page_alloc>
+  801e51:	89 c3                	mov    %eax,%ebx
+  801e53:	83 c4 10             	add    $0x10,%esp
+  801e56:	85 c0                	test   %eax,%eax
+  801e58:	0f 88 bc 00 00 00    	js     801f1a <pipe+0x131>
+	va = fd2data(fd0);
+  801e5e:	83 ec 0c             	sub    $0xc,%esp
+  801e61:	ff 75 f4             	push   -0xc(%ebp)
+  801e64:	e8 70 f1 ff ff       	call   800fd9 <fd2data>
+  801e69:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e6b:	83 c4 0c             	add    $0xc,%esp
+  801e6e:	68 07 04 00 00       	push   $0x407
+  801e73:	50                   	push   %eax
+  801e74:	6a 00                	push   $0x0
+  801e76:	e8 29 ed ff ff       	call   800ba4 <sys_page_alloc>
+  801e7b:	89 c3                	mov    %eax,%ebx
+  801e7d:	83 c4 10             	add    $0x10,%esp
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	0f 88 82 00 00 00    	js     801f0a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e88:	83 ec 0c             	sub    $0xc,%esp
+  801e8b:	ff 75 f0             	push   -0x10(%ebp)
+  801e8e:	e8 46 f1 ff ff       	call   800fd9 <fd2data>
+  801e93:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801e9a:	50                   	push   %eax
+  801e9b:	6a 00                	push   $0x0
+  801e9d:	56                   	push   %esi
+  801e9e:	6a 00                	push   $0x0
+  801ea0:	e8 85 ed ff ff       	call   800c2a <sys_page_map>
+  801ea5:	89 c3                	mov    %eax,%ebx
+  801ea7:	83 c4 20             	add    $0x20,%esp
+  801eaa:	85 c0                	test   %eax,%eax
+  801eac:	78 4e                	js     801efc <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801eae:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801eb3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801eb6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801eb8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ebb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801ec2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801ec5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801ec7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801eca:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801ed1:	83 ec 0c             	sub    $0xc,%esp
+  801ed4:	ff 75 f4             	push   -0xc(%ebp)
+  801ed7:	e8 ed f0 ff ff       	call   800fc9 <fd2num>
+  801edc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801edf:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801ee1:	83 c4 04             	add    $0x4,%esp
+  801ee4:	ff 75 f0             	push   -0x10(%ebp)
+  801ee7:	e8 dd f0 ff ff       	call   800fc9 <fd2num>
+  801eec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801eef:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801ef2:	83 c4 10             	add    $0x10,%esp
+  801ef5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801efa:	eb 2e                	jmp    801f2a <pipe+0x141>
+	sys_page_unmap(0, va);
+  801efc:	83 ec 08             	sub    $0x8,%esp
+  801eff:	56                   	push   %esi
+  801f00:	6a 00                	push   $0x0
+  801f02:	e8 65 ed ff ff       	call   800c6c <sys_page_unmap>
+  801f07:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801f0a:	83 ec 08             	sub    $0x8,%esp
+  801f0d:	ff 75 f0             	push   -0x10(%ebp)
+  801f10:	6a 00                	push   $0x0
+  801f12:	e8 55 ed ff ff       	call   800c6c <sys_page_unmap>
+  801f17:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801f1a:	83 ec 08             	sub    $0x8,%esp
+  801f1d:	ff 75 f4             	push   -0xc(%ebp)
+  801f20:	6a 00                	push   $0x0
+  801f22:	e8 45 ed ff ff       	call   800c6c <sys_page_unmap>
+  801f27:	83 c4 10             	add    $0x10,%esp
+}
+  801f2a:	89 d8                	mov    %ebx,%eax
+  801f2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f2f:	5b                   	pop    %ebx
+  801f30:	5e                   	pop    %esi
+  801f31:	5d                   	pop    %ebp
+  801f32:	c3                   	ret
+
+00801f33 <pipeisclosed>:
+{
+  801f33:	55                   	push   %ebp
+  801f34:	89 e5                	mov    %esp,%ebp
+  801f36:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f3c:	50                   	push   %eax
+  801f3d:	ff 75 08             	push   0x8(%ebp)
+  801f40:	e8 01 f1 ff ff       	call   801046 <fd_lookup>
+  801f45:	83 c4 10             	add    $0x10,%esp
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	78 18                	js     801f64 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801f4c:	83 ec 0c             	sub    $0xc,%esp
+  801f4f:	ff 75 f4             	push   -0xc(%ebp)
+  801f52:	e8 82 f0 ff ff       	call   800fd9 <fd2data>
+  801f57:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801f59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f5c:	e8 33 fd ff ff       	call   801c94 <_pipeisclosed>
+  801f61:	83 c4 10             	add    $0x10,%esp
+}
+  801f64:	c9                   	leave
+  801f65:	c3                   	ret
+
+00801f66 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801f66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6b:	c3                   	ret
+
+00801f6c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f6c:	55                   	push   %ebp
+  801f6d:	89 e5                	mov    %esp,%ebp
+  801f6f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801f72:	68 e7 2a 80 00       	push   $0x802ae7
+  801f77:	ff 75 0c             	push   0xc(%ebp)
+  801f7a:	e8 b8 e7 ff ff       	call   800737 <strcpy>
+	return 0;
+}
+  801f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f84:	c9                   	leave
+  801f85:	c3                   	ret
+
+00801f86 <devcons_write>:
+{
+  801f86:	55                   	push   %ebp
+  801f87:	89 e5                	mov    %esp,%ebp
+  801f89:	57                   	push   %edi
+  801f8a:	56                   	push   %esi
+  801f8b:	53                   	push   %ebx
+  801f8c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801f92:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801f97:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801f9d:	eb 2e                	jmp    801fcd <devcons_write+0x47>
+		m = n - tot;
+  801f9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fa2:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801fa4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801fa9:	39 c3                	cmp    %eax,%ebx
+  801fab:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801fae:	83 ec 04             	sub    $0x4,%esp
+  801fb1:	53                   	push   %ebx
+  801fb2:	89 f0                	mov    %esi,%eax
+  801fb4:	03 45 0c             	add    0xc(%ebp),%eax
+  801fb7:	50                   	push   %eax
+  801fb8:	57                   	push   %edi
+  801fb9:	e8 ff e8 ff ff       	call   8008bd <memmove>
+		sys_cputs(buf, m);
+  801fbe:	83 c4 08             	add    $0x8,%esp
+  801fc1:	53                   	push   %ebx
+  801fc2:	57                   	push   %edi
+  801fc3:	e8 9f ea ff ff       	call   800a67 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801fc8:	01 de                	add    %ebx,%esi
+  801fca:	83 c4 10             	add    $0x10,%esp
+  801fcd:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801fd0:	72 cd                	jb     801f9f <devcons_write+0x19>
+}
+  801fd2:	89 f0                	mov    %esi,%eax
+  801fd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fd7:	5b                   	pop    %ebx
+  801fd8:	5e                   	pop    %esi
+  801fd9:	5f                   	pop    %edi
+  801fda:	5d                   	pop    %ebp
+  801fdb:	c3                   	ret
+
+00801fdc <devcons_read>:
+{
+  801fdc:	55                   	push   %ebp
+  801fdd:	89 e5                	mov    %esp,%ebp
+  801fdf:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801fe2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801feb:	75 07                	jne    801ff4 <devcons_read+0x18>
+  801fed:	eb 1f                	jmp    80200e <devcons_read+0x32>
+		sys_yield();
+  801fef:	e8 30 eb ff ff       	call   800b24 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801ff4:	e8 8c ea ff ff       	call   800a85 <sys_cgetc>
+  801ff9:	85 c0                	test   %eax,%eax
+  801ffb:	74 f2                	je     801fef <devcons_read+0x13>
+	if (c < 0)
+  801ffd:	78 0f                	js     80200e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801fff:	83 f8 04             	cmp    $0x4,%eax
+  802002:	74 0c                	je     802010 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802004:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802007:	88 02                	mov    %al,(%edx)
+	return 1;
+  802009:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80200e:	c9                   	leave
+  80200f:	c3                   	ret
+		return 0;
+  802010:	b8 00 00 00 00       	mov    $0x0,%eax
+  802015:	eb f7                	jmp    80200e <devcons_read+0x32>
+
+00802017 <cputchar>:
+{
+  802017:	55                   	push   %ebp
+  802018:	89 e5                	mov    %esp,%ebp
+  80201a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80201d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802020:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802023:	6a 01                	push   $0x1
+  802025:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802028:	50                   	push   %eax
+  802029:	e8 39 ea ff ff       	call   800a67 <sys_cputs>
+}
+  80202e:	83 c4 10             	add    $0x10,%esp
+  802031:	c9                   	leave
+  802032:	c3                   	ret
+
+00802033 <getchar>:
+{
+  802033:	55                   	push   %ebp
+  802034:	89 e5                	mov    %esp,%ebp
+  802036:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802039:	6a 01                	push   $0x1
+  80203b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80203e:	50                   	push   %eax
+  80203f:	6a 00                	push   $0x0
+  802041:	e8 66 f2 ff ff       	call   8012ac <read>
+	if (r < 0)
+  802046:	83 c4 10             	add    $0x10,%esp
+  802049:	85 c0                	test   %eax,%eax
+  80204b:	78 06                	js     802053 <getchar+0x20>
+	if (r < 1)
+  80204d:	74 06                	je     802055 <getchar+0x22>
+	return c;
+  80204f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802053:	c9                   	leave
+  802054:	c3                   	ret
+		return -E_EOF;
+  802055:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80205a:	eb f7                	jmp    802053 <getchar+0x20>
+
+0080205c <iscons>:
+{
+  80205c:	55                   	push   %ebp
+  80205d:	89 e5                	mov    %esp,%ebp
+  80205f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802062:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802065:	50                   	push   %eax
+  802066:	ff 75 08             	push   0x8(%ebp)
+  802069:	e8 d8 ef ff ff       	call   801046 <fd_lookup>
+  80206e:	83 c4 10             	add    $0x10,%esp
+  802071:	85 c0                	test   %eax,%eax
+  802073:	78 11                	js     802086 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802075:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802078:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80207e:	39 10                	cmp    %edx,(%eax)
+  802080:	0f 94 c0             	sete   %al
+  802083:	0f b6 c0             	movzbl %al,%eax
+}
+  802086:	c9                   	leave
+  802087:	c3                   	ret
+
+00802088 <opencons>:
+{
+  802088:	55                   	push   %ebp
+  802089:	89 e5                	mov    %esp,%ebp
+  80208b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80208e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802091:	50                   	push   %eax
+  802092:	e8 59 ef ff ff       	call   800ff0 <fd_alloc>
+  802097:	83 c4 10             	add    $0x10,%esp
+  80209a:	85 c0                	test   %eax,%eax
+  80209c:	78 3a                	js     8020d8 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80209e:	83 ec 04             	sub    $0x4,%esp
+  8020a1:	68 07 04 00 00       	push   $0x407
+  8020a6:	ff 75 f4             	push   -0xc(%ebp)
+  8020a9:	6a 00                	push   $0x0
+  8020ab:	e8 f4 ea ff ff       	call   800ba4 <sys_page_alloc>
+  8020b0:	83 c4 10             	add    $0x10,%esp
+  8020b3:	85 c0                	test   %eax,%eax
+  8020b5:	78 21                	js     8020d8 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8020b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020ba:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8020c0:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8020c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8020cc:	83 ec 0c             	sub    $0xc,%esp
+  8020cf:	50                   	push   %eax
+  8020d0:	e8 f4 ee ff ff       	call   800fc9 <fd2num>
+  8020d5:	83 c4 10             	add    $0x10,%esp
+}
+  8020d8:	c9                   	leave
+  8020d9:	c3                   	ret
+
+008020da <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8020da:	55                   	push   %ebp
+  8020db:	89 e5                	mov    %esp,%ebp
+  8020dd:	56                   	push   %esi
+  8020de:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8020df:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8020e2:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8020e8:	e8 18 ea ff ff       	call   800b05 <sys_getenvid>
+  8020ed:	83 ec 0c             	sub    $0xc,%esp
+  8020f0:	ff 75 0c             	push   0xc(%ebp)
+  8020f3:	ff 75 08             	push   0x8(%ebp)
+  8020f6:	56                   	push   %esi
+  8020f7:	50                   	push   %eax
+  8020f8:	68 f4 2a 80 00       	push   $0x802af4
+  8020fd:	e8 47 e0 ff ff       	call   800149 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802102:	83 c4 18             	add    $0x18,%esp
+  802105:	53                   	push   %ebx
+  802106:	ff 75 10             	push   0x10(%ebp)
+  802109:	e8 ea df ff ff       	call   8000f8 <vcprintf>
+	cprintf("\n");
+  80210e:	c7 04 24 8c 26 80 00 	movl   $0x80268c,(%esp)
+  802115:	e8 2f e0 ff ff       	call   800149 <cprintf>
+  80211a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80211d:	cc                   	int3
+	while (1)
+  80211e:	eb fd                	jmp    80211d <_panic+0x43>
+
+00802120 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802120:	55                   	push   %ebp
+  802121:	89 e5                	mov    %esp,%ebp
+  802123:	57                   	push   %edi
+  802124:	56                   	push   %esi
+  802125:	53                   	push   %ebx
+  802126:	83 ec 18             	sub    $0x18,%esp
+  802129:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80212c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80212f:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802132:	85 db                	test   %ebx,%ebx
+  802134:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802139:	0f 45 c3             	cmovne %ebx,%eax
+  80213c:	50                   	push   %eax
+  80213d:	e8 e5 ed ff ff       	call   800f27 <sys_ipc_recv>
+
+	if (from_env_store)
+  802142:	83 c4 10             	add    $0x10,%esp
+  802145:	85 ff                	test   %edi,%edi
+  802147:	74 17                	je     802160 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802149:	ba 00 00 00 00       	mov    $0x0,%edx
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	75 0c                	jne    80215e <ipc_recv+0x3e>
+  802152:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  802158:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  80215e:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802160:	85 f6                	test   %esi,%esi
+  802162:	74 2e                	je     802192 <ipc_recv+0x72>
+		if (!r && pg)
+  802164:	85 c0                	test   %eax,%eax
+  802166:	75 24                	jne    80218c <ipc_recv+0x6c>
+  802168:	85 db                	test   %ebx,%ebx
+  80216a:	74 20                	je     80218c <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  80216c:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802171:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802177:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802179:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80217e:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802184:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802187:	5b                   	pop    %ebx
+  802188:	5e                   	pop    %esi
+  802189:	5f                   	pop    %edi
+  80218a:	5d                   	pop    %ebp
+  80218b:	c3                   	ret
+			*perm_store = 0;
+  80218c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802192:	85 c0                	test   %eax,%eax
+  802194:	75 ee                	jne    802184 <ipc_recv+0x64>
+  802196:	eb e1                	jmp    802179 <ipc_recv+0x59>
+
+00802198 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802198:	55                   	push   %ebp
+  802199:	89 e5                	mov    %esp,%ebp
+  80219b:	57                   	push   %edi
+  80219c:	56                   	push   %esi
+  80219d:	53                   	push   %ebx
+  80219e:	83 ec 0c             	sub    $0xc,%esp
+  8021a1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021a4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8021aa:	85 db                	test   %ebx,%ebx
+  8021ac:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021b1:	0f 44 d8             	cmove  %eax,%ebx
+  8021b4:	ff 75 14             	push   0x14(%ebp)
+  8021b7:	53                   	push   %ebx
+  8021b8:	56                   	push   %esi
+  8021b9:	57                   	push   %edi
+  8021ba:	e8 45 ed ff ff       	call   800f04 <sys_ipc_try_send_yield>
+  8021bf:	83 c4 10             	add    $0x10,%esp
+  8021c2:	85 c0                	test   %eax,%eax
+  8021c4:	79 1e                	jns    8021e4 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8021c6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021c9:	75 07                	jne    8021d2 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8021cb:	e8 54 e9 ff ff       	call   800b24 <sys_yield>
+  8021d0:	eb e2                	jmp    8021b4 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8021d2:	50                   	push   %eax
+  8021d3:	68 17 2b 80 00       	push   $0x802b17
+  8021d8:	6a 3d                	push   $0x3d
+  8021da:	68 2c 2b 80 00       	push   $0x802b2c
+  8021df:	e8 f6 fe ff ff       	call   8020da <_panic>
+	}
+}
+  8021e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021e7:	5b                   	pop    %ebx
+  8021e8:	5e                   	pop    %esi
+  8021e9:	5f                   	pop    %edi
+  8021ea:	5d                   	pop    %ebp
+  8021eb:	c3                   	ret
+
+008021ec <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8021ec:	55                   	push   %ebp
+  8021ed:	89 e5                	mov    %esp,%ebp
+  8021ef:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8021f2:	ff 75 08             	push   0x8(%ebp)
+  8021f5:	e8 aa e8 ff ff       	call   800aa4 <sys_env_find>
+}
+  8021fa:	c9                   	leave
+  8021fb:	c3                   	ret
+
+008021fc <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8021fc:	55                   	push   %ebp
+  8021fd:	89 e5                	mov    %esp,%ebp
+  8021ff:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802202:	89 c2                	mov    %eax,%edx
+  802204:	c1 ea 16             	shr    $0x16,%edx
+  802207:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80220e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802213:	f6 c1 01             	test   $0x1,%cl
+  802216:	74 22                	je     80223a <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802218:	c1 e8 0c             	shr    $0xc,%eax
+  80221b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802222:	a8 01                	test   $0x1,%al
+  802224:	74 14                	je     80223a <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802226:	c1 e8 0c             	shr    $0xc,%eax
+  802229:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80222c:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802233:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802237:	0f b7 d2             	movzwl %dx,%edx
+}
+  80223a:	89 d0                	mov    %edx,%eax
+  80223c:	5d                   	pop    %ebp
+  80223d:	c3                   	ret
+  80223e:	66 90                	xchg   %ax,%ax
+
+00802240 <__udivmoddi4>:
+  802240:	55                   	push   %ebp
+  802241:	57                   	push   %edi
+  802242:	56                   	push   %esi
+  802243:	53                   	push   %ebx
+  802244:	83 ec 14             	sub    $0x14,%esp
+  802247:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80224b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80224f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802253:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802257:	89 f1                	mov    %esi,%ecx
+  802259:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80225d:	09 d9                	or     %ebx,%ecx
+  80225f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802263:	0f 84 92 00 00 00    	je     8022fb <__udivmoddi4+0xbb>
+  802269:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802270:	00 
+  802271:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802276:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80227d:	00 
+  80227e:	89 1c 24             	mov    %ebx,(%esp)
+  802281:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802285:	8d 76 00             	lea    0x0(%esi),%esi
+  802288:	89 e9                	mov    %ebp,%ecx
+  80228a:	89 c3                	mov    %eax,%ebx
+  80228c:	89 d6                	mov    %edx,%esi
+  80228e:	31 ff                	xor    %edi,%edi
+  802290:	d3 ee                	shr    %cl,%esi
+  802292:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802295:	f6 c1 20             	test   $0x20,%cl
+  802298:	0f 45 de             	cmovne %esi,%ebx
+  80229b:	0f 45 f7             	cmovne %edi,%esi
+  80229e:	8b 3c 24             	mov    (%esp),%edi
+  8022a1:	39 fb                	cmp    %edi,%ebx
+  8022a3:	89 f7                	mov    %esi,%edi
+  8022a5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8022a9:	8b 1c 24             	mov    (%esp),%ebx
+  8022ac:	19 f7                	sbb    %esi,%edi
+  8022ae:	72 39                	jb     8022e9 <__udivmoddi4+0xa9>
+  8022b0:	89 e9                	mov    %ebp,%ecx
+  8022b2:	89 f7                	mov    %esi,%edi
+  8022b4:	89 de                	mov    %ebx,%esi
+  8022b6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8022b9:	d3 e6                	shl    %cl,%esi
+  8022bb:	31 db                	xor    %ebx,%ebx
+  8022bd:	f6 c1 20             	test   $0x20,%cl
+  8022c0:	0f 45 fe             	cmovne %esi,%edi
+  8022c3:	0f 45 f3             	cmovne %ebx,%esi
+  8022c6:	29 f0                	sub    %esi,%eax
+  8022c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022cd:	19 fa                	sbb    %edi,%edx
+  8022cf:	31 ff                	xor    %edi,%edi
+  8022d1:	31 db                	xor    %ebx,%ebx
+  8022d3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8022d6:	d3 e6                	shl    %cl,%esi
+  8022d8:	f6 c1 20             	test   $0x20,%cl
+  8022db:	0f 45 fe             	cmovne %esi,%edi
+  8022de:	0f 45 f3             	cmovne %ebx,%esi
+  8022e1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8022e5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8022e9:	83 ed 01             	sub    $0x1,%ebp
+  8022ec:	73 9a                	jae    802288 <__udivmoddi4+0x48>
+  8022ee:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8022f2:	85 ff                	test   %edi,%edi
+  8022f4:	74 05                	je     8022fb <__udivmoddi4+0xbb>
+  8022f6:	89 07                	mov    %eax,(%edi)
+  8022f8:	89 57 04             	mov    %edx,0x4(%edi)
+  8022fb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022ff:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802303:	83 c4 14             	add    $0x14,%esp
+  802306:	5b                   	pop    %ebx
+  802307:	5e                   	pop    %esi
+  802308:	5f                   	pop    %edi
+  802309:	5d                   	pop    %ebp
+  80230a:	c3                   	ret
+  80230b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80230f:	90                   	nop
+
+00802310 <__udivdi3>:
+  802310:	55                   	push   %ebp
+  802311:	57                   	push   %edi
+  802312:	56                   	push   %esi
+  802313:	53                   	push   %ebx
+  802314:	83 ec 14             	sub    $0x14,%esp
+  802317:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80231b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80231f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802323:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802327:	89 fb                	mov    %edi,%ebx
+  802329:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80232d:	09 f3                	or     %esi,%ebx
+  80232f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802333:	0f 84 85 00 00 00    	je     8023be <__udivdi3+0xae>
+  802339:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802340:	00 
+  802341:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802346:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80234d:	00 
+  80234e:	89 34 24             	mov    %esi,(%esp)
+  802351:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802355:	8d 76 00             	lea    0x0(%esi),%esi
+  802358:	89 e9                	mov    %ebp,%ecx
+  80235a:	89 c3                	mov    %eax,%ebx
+  80235c:	89 d6                	mov    %edx,%esi
+  80235e:	31 ff                	xor    %edi,%edi
+  802360:	d3 ee                	shr    %cl,%esi
+  802362:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802365:	f6 c1 20             	test   $0x20,%cl
+  802368:	0f 45 de             	cmovne %esi,%ebx
+  80236b:	0f 45 f7             	cmovne %edi,%esi
+  80236e:	8b 3c 24             	mov    (%esp),%edi
+  802371:	39 fb                	cmp    %edi,%ebx
+  802373:	89 f7                	mov    %esi,%edi
+  802375:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802379:	8b 1c 24             	mov    (%esp),%ebx
+  80237c:	19 f7                	sbb    %esi,%edi
+  80237e:	72 39                	jb     8023b9 <__udivdi3+0xa9>
+  802380:	89 e9                	mov    %ebp,%ecx
+  802382:	89 f7                	mov    %esi,%edi
+  802384:	89 de                	mov    %ebx,%esi
+  802386:	0f a5 df             	shld   %cl,%ebx,%edi
+  802389:	d3 e6                	shl    %cl,%esi
+  80238b:	31 db                	xor    %ebx,%ebx
+  80238d:	f6 c1 20             	test   $0x20,%cl
+  802390:	0f 45 fe             	cmovne %esi,%edi
+  802393:	0f 45 f3             	cmovne %ebx,%esi
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	be 01 00 00 00       	mov    $0x1,%esi
+  80239d:	19 fa                	sbb    %edi,%edx
+  80239f:	31 ff                	xor    %edi,%edi
+  8023a1:	31 db                	xor    %ebx,%ebx
+  8023a3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023a6:	d3 e6                	shl    %cl,%esi
+  8023a8:	f6 c1 20             	test   $0x20,%cl
+  8023ab:	0f 45 fe             	cmovne %esi,%edi
+  8023ae:	0f 45 f3             	cmovne %ebx,%esi
+  8023b1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023b5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023b9:	83 ed 01             	sub    $0x1,%ebp
+  8023bc:	73 9a                	jae    802358 <__udivdi3+0x48>
+  8023be:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023c2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023c6:	83 c4 14             	add    $0x14,%esp
+  8023c9:	5b                   	pop    %ebx
+  8023ca:	5e                   	pop    %esi
+  8023cb:	5f                   	pop    %edi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+  8023ce:	66 90                	xchg   %ax,%ax
+
+008023d0 <__umoddi3>:
+  8023d0:	57                   	push   %edi
+  8023d1:	56                   	push   %esi
+  8023d2:	53                   	push   %ebx
+  8023d3:	83 ec 08             	sub    $0x8,%esp
+  8023d6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8023da:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8023de:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023e2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023e6:	89 f9                	mov    %edi,%ecx
+  8023e8:	89 34 24             	mov    %esi,(%esp)
+  8023eb:	09 f1                	or     %esi,%ecx
+  8023ed:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023f1:	74 53                	je     802446 <__umoddi3+0x76>
+  8023f3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023ff:	90                   	nop
+  802400:	89 c6                	mov    %eax,%esi
+  802402:	89 d7                	mov    %edx,%edi
+  802404:	31 db                	xor    %ebx,%ebx
+  802406:	d3 ef                	shr    %cl,%edi
+  802408:	0f ad d6             	shrd   %cl,%edx,%esi
+  80240b:	f6 c1 20             	test   $0x20,%cl
+  80240e:	0f 45 f7             	cmovne %edi,%esi
+  802411:	0f 45 fb             	cmovne %ebx,%edi
+  802414:	8b 1c 24             	mov    (%esp),%ebx
+  802417:	39 de                	cmp    %ebx,%esi
+  802419:	89 fb                	mov    %edi,%ebx
+  80241b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80241f:	8b 34 24             	mov    (%esp),%esi
+  802422:	19 fb                	sbb    %edi,%ebx
+  802424:	72 14                	jb     80243a <__umoddi3+0x6a>
+  802426:	0f a5 f7             	shld   %cl,%esi,%edi
+  802429:	31 db                	xor    %ebx,%ebx
+  80242b:	d3 e6                	shl    %cl,%esi
+  80242d:	f6 c1 20             	test   $0x20,%cl
+  802430:	0f 45 fe             	cmovne %esi,%edi
+  802433:	0f 45 f3             	cmovne %ebx,%esi
+  802436:	29 f0                	sub    %esi,%eax
+  802438:	19 fa                	sbb    %edi,%edx
+  80243a:	83 e9 01             	sub    $0x1,%ecx
+  80243d:	73 c1                	jae    802400 <__umoddi3+0x30>
+  80243f:	83 c4 08             	add    $0x8,%esp
+  802442:	5b                   	pop    %ebx
+  802443:	5e                   	pop    %esi
+  802444:	5f                   	pop    %edi
+  802445:	c3                   	ret
+  802446:	83 c4 08             	add    $0x8,%esp
+  802449:	31 c0                	xor    %eax,%eax
+  80244b:	31 d2                	xor    %edx,%edx
+  80244d:	5b                   	pop    %ebx
+  80244e:	5e                   	pop    %esi
+  80244f:	5f                   	pop    %edi
+  802450:	c3                   	ret
+  802451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80245f:	90                   	nop
+
+00802460 <__divdi3>:
+  802460:	55                   	push   %ebp
+  802461:	57                   	push   %edi
+  802462:	56                   	push   %esi
+  802463:	53                   	push   %ebx
+  802464:	83 ec 1c             	sub    $0x1c,%esp
+  802467:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80246b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80246f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802473:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802477:	85 ff                	test   %edi,%edi
+  802479:	0f 88 da 00 00 00    	js     802559 <__divdi3+0xf9>
+  80247f:	85 db                	test   %ebx,%ebx
+  802481:	78 16                	js     802499 <__divdi3+0x39>
+  802483:	89 dd                	mov    %ebx,%ebp
+  802485:	89 c8                	mov    %ecx,%eax
+  802487:	89 da                	mov    %ebx,%edx
+  802489:	09 cd                	or     %ecx,%ebp
+  80248b:	0f 85 fd 00 00 00    	jne    80258e <__divdi3+0x12e>
+  802491:	83 c4 1c             	add    $0x1c,%esp
+  802494:	5b                   	pop    %ebx
+  802495:	5e                   	pop    %esi
+  802496:	5f                   	pop    %edi
+  802497:	5d                   	pop    %ebp
+  802498:	c3                   	ret
+  802499:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80249e:	f7 d9                	neg    %ecx
+  8024a0:	89 f0                	mov    %esi,%eax
+  8024a2:	89 fa                	mov    %edi,%edx
+  8024a4:	83 d3 00             	adc    $0x0,%ebx
+  8024a7:	89 0c 24             	mov    %ecx,(%esp)
+  8024aa:	f7 db                	neg    %ebx
+  8024ac:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8024b0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024b7:	00 
+  8024b8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024bd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024c4:	00 
+  8024c5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024c9:	89 cd                	mov    %ecx,%ebp
+  8024cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024cf:	90                   	nop
+  8024d0:	89 e9                	mov    %ebp,%ecx
+  8024d2:	89 c3                	mov    %eax,%ebx
+  8024d4:	89 d6                	mov    %edx,%esi
+  8024d6:	31 ff                	xor    %edi,%edi
+  8024d8:	d3 ee                	shr    %cl,%esi
+  8024da:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024dd:	f6 c1 20             	test   $0x20,%cl
+  8024e0:	0f 45 de             	cmovne %esi,%ebx
+  8024e3:	0f 45 f7             	cmovne %edi,%esi
+  8024e6:	8b 3c 24             	mov    (%esp),%edi
+  8024e9:	39 fb                	cmp    %edi,%ebx
+  8024eb:	89 f7                	mov    %esi,%edi
+  8024ed:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8024f1:	8b 1c 24             	mov    (%esp),%ebx
+  8024f4:	19 f7                	sbb    %esi,%edi
+  8024f6:	72 39                	jb     802531 <__divdi3+0xd1>
+  8024f8:	89 e9                	mov    %ebp,%ecx
+  8024fa:	89 f7                	mov    %esi,%edi
+  8024fc:	89 de                	mov    %ebx,%esi
+  8024fe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802501:	d3 e6                	shl    %cl,%esi
+  802503:	31 db                	xor    %ebx,%ebx
+  802505:	f6 c1 20             	test   $0x20,%cl
+  802508:	0f 45 fe             	cmovne %esi,%edi
+  80250b:	0f 45 f3             	cmovne %ebx,%esi
+  80250e:	29 f0                	sub    %esi,%eax
+  802510:	be 01 00 00 00       	mov    $0x1,%esi
+  802515:	19 fa                	sbb    %edi,%edx
+  802517:	31 ff                	xor    %edi,%edi
+  802519:	31 db                	xor    %ebx,%ebx
+  80251b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80251e:	d3 e6                	shl    %cl,%esi
+  802520:	f6 c1 20             	test   $0x20,%cl
+  802523:	0f 45 fe             	cmovne %esi,%edi
+  802526:	0f 45 f3             	cmovne %ebx,%esi
+  802529:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80252d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802531:	83 ed 01             	sub    $0x1,%ebp
+  802534:	73 9a                	jae    8024d0 <__divdi3+0x70>
+  802536:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80253a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80253e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802542:	85 ed                	test   %ebp,%ebp
+  802544:	0f 84 47 ff ff ff    	je     802491 <__divdi3+0x31>
+  80254a:	f7 d8                	neg    %eax
+  80254c:	83 d2 00             	adc    $0x0,%edx
+  80254f:	83 c4 1c             	add    $0x1c,%esp
+  802552:	5b                   	pop    %ebx
+  802553:	f7 da                	neg    %edx
+  802555:	5e                   	pop    %esi
+  802556:	5f                   	pop    %edi
+  802557:	5d                   	pop    %ebp
+  802558:	c3                   	ret
+  802559:	f7 de                	neg    %esi
+  80255b:	83 d7 00             	adc    $0x0,%edi
+  80255e:	f7 df                	neg    %edi
+  802560:	85 db                	test   %ebx,%ebx
+  802562:	78 23                	js     802587 <__divdi3+0x127>
+  802564:	89 dd                	mov    %ebx,%ebp
+  802566:	89 c8                	mov    %ecx,%eax
+  802568:	89 da                	mov    %ebx,%edx
+  80256a:	09 cd                	or     %ecx,%ebp
+  80256c:	0f 84 1f ff ff ff    	je     802491 <__divdi3+0x31>
+  802572:	89 0c 24             	mov    %ecx,(%esp)
+  802575:	89 f0                	mov    %esi,%eax
+  802577:	89 fa                	mov    %edi,%edx
+  802579:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80257e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802582:	e9 29 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+  802587:	31 ed                	xor    %ebp,%ebp
+  802589:	e9 10 ff ff ff       	jmp    80249e <__divdi3+0x3e>
+  80258e:	89 0c 24             	mov    %ecx,(%esp)
+  802591:	89 f0                	mov    %esi,%eax
+  802593:	89 fa                	mov    %edi,%edx
+  802595:	31 ed                	xor    %ebp,%ebp
+  802597:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80259b:	e9 10 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+
+008025a0 <__moddi3>:
+  8025a0:	55                   	push   %ebp
+  8025a1:	57                   	push   %edi
+  8025a2:	56                   	push   %esi
+  8025a3:	53                   	push   %ebx
+  8025a4:	83 ec 14             	sub    $0x14,%esp
+  8025a7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025ab:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025af:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8025b3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8025b7:	85 d2                	test   %edx,%edx
+  8025b9:	0f 88 9b 00 00 00    	js     80265a <__moddi3+0xba>
+  8025bf:	89 f7                	mov    %esi,%edi
+  8025c1:	31 ed                	xor    %ebp,%ebp
+  8025c3:	09 cf                	or     %ecx,%edi
+  8025c5:	0f 84 83 00 00 00    	je     80264e <__moddi3+0xae>
+  8025cb:	89 cb                	mov    %ecx,%ebx
+  8025cd:	89 f7                	mov    %esi,%edi
+  8025cf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8025d3:	f7 db                	neg    %ebx
+  8025d5:	83 d7 00             	adc    $0x0,%edi
+  8025d8:	f7 df                	neg    %edi
+  8025da:	0f 49 f7             	cmovns %edi,%esi
+  8025dd:	0f 49 cb             	cmovns %ebx,%ecx
+  8025e0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025e4:	89 0c 24             	mov    %ecx,(%esp)
+  8025e7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025ec:	89 cd                	mov    %ecx,%ebp
+  8025ee:	66 90                	xchg   %ax,%ax
+  8025f0:	89 e9                	mov    %ebp,%ecx
+  8025f2:	89 c3                	mov    %eax,%ebx
+  8025f4:	89 d6                	mov    %edx,%esi
+  8025f6:	31 ff                	xor    %edi,%edi
+  8025f8:	d3 ee                	shr    %cl,%esi
+  8025fa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025fd:	f6 c1 20             	test   $0x20,%cl
+  802600:	0f 45 de             	cmovne %esi,%ebx
+  802603:	0f 45 f7             	cmovne %edi,%esi
+  802606:	8b 3c 24             	mov    (%esp),%edi
+  802609:	39 fb                	cmp    %edi,%ebx
+  80260b:	89 f7                	mov    %esi,%edi
+  80260d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802611:	8b 1c 24             	mov    (%esp),%ebx
+  802614:	19 f7                	sbb    %esi,%edi
+  802616:	72 1a                	jb     802632 <__moddi3+0x92>
+  802618:	89 e9                	mov    %ebp,%ecx
+  80261a:	89 f7                	mov    %esi,%edi
+  80261c:	89 de                	mov    %ebx,%esi
+  80261e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802621:	d3 e6                	shl    %cl,%esi
+  802623:	31 db                	xor    %ebx,%ebx
+  802625:	f6 c1 20             	test   $0x20,%cl
+  802628:	0f 45 fe             	cmovne %esi,%edi
+  80262b:	0f 45 f3             	cmovne %ebx,%esi
+  80262e:	29 f0                	sub    %esi,%eax
+  802630:	19 fa                	sbb    %edi,%edx
+  802632:	83 ed 01             	sub    $0x1,%ebp
+  802635:	73 b9                	jae    8025f0 <__moddi3+0x50>
+  802637:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80263b:	85 ed                	test   %ebp,%ebp
+  80263d:	74 07                	je     802646 <__moddi3+0xa6>
+  80263f:	f7 d8                	neg    %eax
+  802641:	83 d2 00             	adc    $0x0,%edx
+  802644:	f7 da                	neg    %edx
+  802646:	83 c4 14             	add    $0x14,%esp
+  802649:	5b                   	pop    %ebx
+  80264a:	5e                   	pop    %esi
+  80264b:	5f                   	pop    %edi
+  80264c:	5d                   	pop    %ebp
+  80264d:	c3                   	ret
+  80264e:	83 c4 14             	add    $0x14,%esp
+  802651:	31 c0                	xor    %eax,%eax
+  802653:	31 d2                	xor    %edx,%edx
+  802655:	5b                   	pop    %ebx
+  802656:	5e                   	pop    %esi
+  802657:	5f                   	pop    %edi
+  802658:	5d                   	pop    %ebp
+  802659:	c3                   	ret
+  80265a:	89 f7                	mov    %esi,%edi
+  80265c:	09 cf                	or     %ecx,%edi
+  80265e:	74 11                	je     802671 <__moddi3+0xd1>
+  802660:	f7 d8                	neg    %eax
+  802662:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802667:	83 d2 00             	adc    $0x0,%edx
+  80266a:	f7 da                	neg    %edx
+  80266c:	e9 5a ff ff ff       	jmp    8025cb <__moddi3+0x2b>
+  802671:	31 c0                	xor    %eax,%eax
+  802673:	31 d2                	xor    %edx,%edx
+  802675:	eb c8                	jmp    80263f <__moddi3+0x9f>
@@ -0,0 +1,5765 @@
+
+obj/user/dumbfork.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9a 01 00 00       	call   8001cb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <duppage>:
+	}
+}
+
+void
+duppage(envid_t dstenv, void *addr)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	// This is NOT what you should do in your fork.
+	if ((r = sys_page_alloc(dstenv, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  80003e:	83 ec 04             	sub    $0x4,%esp
+  800041:	6a 07                	push   $0x7
+  800043:	53                   	push   %ebx
+  800044:	56                   	push   %esi
+  800045:	e8 17 0d 00 00       	call   800d61 <sys_page_alloc>
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	78 4a                	js     80009b <duppage+0x68>
+		panic("sys_page_alloc: %e", r);
+	if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  800051:	83 ec 0c             	sub    $0xc,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 40 00       	push   $0x400000
+  80005b:	6a 00                	push   $0x0
+  80005d:	53                   	push   %ebx
+  80005e:	56                   	push   %esi
+  80005f:	e8 83 0d 00 00       	call   800de7 <sys_page_map>
+  800064:	83 c4 20             	add    $0x20,%esp
+  800067:	85 c0                	test   %eax,%eax
+  800069:	78 42                	js     8000ad <duppage+0x7a>
+		panic("sys_page_map: %e", r);
+	memmove(UTEMP, addr, PGSIZE);
+  80006b:	83 ec 04             	sub    $0x4,%esp
+  80006e:	68 00 10 00 00       	push   $0x1000
+  800073:	53                   	push   %ebx
+  800074:	68 00 00 40 00       	push   $0x400000
+  800079:	e8 fc 09 00 00       	call   800a7a <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80007e:	83 c4 08             	add    $0x8,%esp
+  800081:	68 00 00 40 00       	push   $0x400000
+  800086:	6a 00                	push   $0x0
+  800088:	e8 9c 0d 00 00       	call   800e29 <sys_page_unmap>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	78 2b                	js     8000bf <duppage+0x8c>
+		panic("sys_page_unmap: %e", r);
+}
+  800094:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800097:	5b                   	pop    %ebx
+  800098:	5e                   	pop    %esi
+  800099:	5d                   	pop    %ebp
+  80009a:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  80009b:	50                   	push   %eax
+  80009c:	68 00 28 80 00       	push   $0x802800
+  8000a1:	6a 20                	push   $0x20
+  8000a3:	68 13 28 80 00       	push   $0x802813
+  8000a8:	e8 7e 01 00 00       	call   80022b <_panic>
+		panic("sys_page_map: %e", r);
+  8000ad:	50                   	push   %eax
+  8000ae:	68 23 28 80 00       	push   $0x802823
+  8000b3:	6a 22                	push   $0x22
+  8000b5:	68 13 28 80 00       	push   $0x802813
+  8000ba:	e8 6c 01 00 00       	call   80022b <_panic>
+		panic("sys_page_unmap: %e", r);
+  8000bf:	50                   	push   %eax
+  8000c0:	68 34 28 80 00       	push   $0x802834
+  8000c5:	6a 25                	push   $0x25
+  8000c7:	68 13 28 80 00       	push   $0x802813
+  8000cc:	e8 5a 01 00 00       	call   80022b <_panic>
+
+008000d1 <dumbfork>:
+
+envid_t
+dumbfork(void)
+{
+  8000d1:	55                   	push   %ebp
+  8000d2:	89 e5                	mov    %esp,%ebp
+  8000d4:	53                   	push   %ebx
+  8000d5:	83 ec 14             	sub    $0x14,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8000d8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8000dd:	cd 30                	int    $0x30
+  8000df:	89 c3                	mov    %eax,%ebx
+	// The kernel will initialize it with a copy of our register state,
+	// so that the child will appear to have called sys_exofork() too -
+	// except that in the child, this "fake" call to sys_exofork()
+	// will return 0 instead of the envid of the child.
+	envid = sys_exofork();
+	if (envid < 0)
+  8000e1:	85 c0                	test   %eax,%eax
+  8000e3:	78 20                	js     800105 <dumbfork+0x34>
+		panic("sys_exofork: %e", envid);
+	if (envid == 0) {
+  8000e5:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8000ea:	75 41                	jne    80012d <dumbfork+0x5c>
+		// We're the child.
+		// The copied value of the global variable 'thisenv'
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8000ec:	e8 d1 0b 00 00       	call   800cc2 <sys_getenvid>
+  8000f1:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000f6:	c1 e0 09             	shl    $0x9,%eax
+  8000f9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000fe:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  800103:	eb 57                	jmp    80015c <dumbfork+0x8b>
+		panic("sys_exofork: %e", envid);
+  800105:	50                   	push   %eax
+  800106:	68 47 28 80 00       	push   $0x802847
+  80010b:	6a 37                	push   $0x37
+  80010d:	68 13 28 80 00       	push   $0x802813
+  800112:	e8 14 01 00 00       	call   80022b <_panic>
+
+	// We're the parent.
+	// Eagerly copy our entire address space into the child.
+	// This is NOT what you should do in your fork implementation.
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+		duppage(envid, addr);
+  800117:	83 ec 08             	sub    $0x8,%esp
+  80011a:	52                   	push   %edx
+  80011b:	53                   	push   %ebx
+  80011c:	e8 12 ff ff ff       	call   800033 <duppage>
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  800121:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800124:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80012a:	83 c4 10             	add    $0x10,%esp
+  80012d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  800130:	81 fa 00 70 80 00    	cmp    $0x807000,%edx
+  800136:	72 df                	jb     800117 <dumbfork+0x46>
+
+	// Also copy the stack we are currently running on.
+	duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  800138:	83 ec 08             	sub    $0x8,%esp
+  80013b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80013e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800143:	50                   	push   %eax
+  800144:	53                   	push   %ebx
+  800145:	e8 e9 fe ff ff       	call   800033 <duppage>
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80014a:	83 c4 08             	add    $0x8,%esp
+  80014d:	6a 02                	push   $0x2
+  80014f:	53                   	push   %ebx
+  800150:	e8 e0 0d 00 00       	call   800f35 <sys_env_set_status>
+  800155:	83 c4 10             	add    $0x10,%esp
+  800158:	85 c0                	test   %eax,%eax
+  80015a:	78 07                	js     800163 <dumbfork+0x92>
+		panic("sys_env_set_status: %e", r);
+
+	return envid;
+}
+  80015c:	89 d8                	mov    %ebx,%eax
+  80015e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800161:	c9                   	leave
+  800162:	c3                   	ret
+		panic("sys_env_set_status: %e", r);
+  800163:	50                   	push   %eax
+  800164:	68 57 28 80 00       	push   $0x802857
+  800169:	6a 4c                	push   $0x4c
+  80016b:	68 13 28 80 00       	push   $0x802813
+  800170:	e8 b6 00 00 00       	call   80022b <_panic>
+
+00800175 <umain>:
+{
+  800175:	55                   	push   %ebp
+  800176:	89 e5                	mov    %esp,%ebp
+  800178:	57                   	push   %edi
+  800179:	56                   	push   %esi
+  80017a:	53                   	push   %ebx
+  80017b:	83 ec 0c             	sub    $0xc,%esp
+	who = dumbfork();
+  80017e:	e8 4e ff ff ff       	call   8000d1 <dumbfork>
+  800183:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  800185:	85 c0                	test   %eax,%eax
+  800187:	bf 6e 28 80 00       	mov    $0x80286e,%edi
+  80018c:	b8 75 28 80 00       	mov    $0x802875,%eax
+  800191:	0f 44 f8             	cmove  %eax,%edi
+  800194:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800199:	eb 1f                	jmp    8001ba <umain+0x45>
+  80019b:	83 fb 13             	cmp    $0x13,%ebx
+  80019e:	7f 23                	jg     8001c3 <umain+0x4e>
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  8001a0:	83 ec 04             	sub    $0x4,%esp
+  8001a3:	57                   	push   %edi
+  8001a4:	53                   	push   %ebx
+  8001a5:	68 7b 28 80 00       	push   $0x80287b
+  8001aa:	e8 57 01 00 00       	call   800306 <cprintf>
+		sys_yield();
+  8001af:	e8 2d 0b 00 00       	call   800ce1 <sys_yield>
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8001b4:	83 c3 01             	add    $0x1,%ebx
+  8001b7:	83 c4 10             	add    $0x10,%esp
+  8001ba:	85 f6                	test   %esi,%esi
+  8001bc:	74 dd                	je     80019b <umain+0x26>
+  8001be:	83 fb 09             	cmp    $0x9,%ebx
+  8001c1:	7e dd                	jle    8001a0 <umain+0x2b>
+}
+  8001c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c6:	5b                   	pop    %ebx
+  8001c7:	5e                   	pop    %esi
+  8001c8:	5f                   	pop    %edi
+  8001c9:	5d                   	pop    %ebp
+  8001ca:	c3                   	ret
+
+008001cb <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001cb:	55                   	push   %ebp
+  8001cc:	89 e5                	mov    %esp,%ebp
+  8001ce:	56                   	push   %esi
+  8001cf:	53                   	push   %ebx
+  8001d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001d6:	e8 e7 0a 00 00       	call   800cc2 <sys_getenvid>
+  8001db:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8001e0:	c1 e0 09             	shl    $0x9,%eax
+  8001e3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001e8:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001ed:	85 db                	test   %ebx,%ebx
+  8001ef:	7e 07                	jle    8001f8 <libmain+0x2d>
+		binaryname = argv[0];
+  8001f1:	8b 06                	mov    (%esi),%eax
+  8001f3:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8001f8:	83 ec 08             	sub    $0x8,%esp
+  8001fb:	56                   	push   %esi
+  8001fc:	53                   	push   %ebx
+  8001fd:	e8 73 ff ff ff       	call   800175 <umain>
+
+	// exit gracefully
+	exit();
+  800202:	e8 0a 00 00 00       	call   800211 <exit>
+}
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80020d:	5b                   	pop    %ebx
+  80020e:	5e                   	pop    %esi
+  80020f:	5d                   	pop    %ebp
+  800210:	c3                   	ret
+
+00800211 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800211:	55                   	push   %ebp
+  800212:	89 e5                	mov    %esp,%ebp
+  800214:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800217:	e8 3e 11 00 00       	call   80135a <close_all>
+	sys_env_destroy(0);
+  80021c:	83 ec 0c             	sub    $0xc,%esp
+  80021f:	6a 00                	push   $0x0
+  800221:	e8 5b 0a 00 00       	call   800c81 <sys_env_destroy>
+}
+  800226:	83 c4 10             	add    $0x10,%esp
+  800229:	c9                   	leave
+  80022a:	c3                   	ret
+
+0080022b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80022b:	55                   	push   %ebp
+  80022c:	89 e5                	mov    %esp,%ebp
+  80022e:	56                   	push   %esi
+  80022f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800230:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800233:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  800239:	e8 84 0a 00 00       	call   800cc2 <sys_getenvid>
+  80023e:	83 ec 0c             	sub    $0xc,%esp
+  800241:	ff 75 0c             	push   0xc(%ebp)
+  800244:	ff 75 08             	push   0x8(%ebp)
+  800247:	56                   	push   %esi
+  800248:	50                   	push   %eax
+  800249:	68 98 28 80 00       	push   $0x802898
+  80024e:	e8 b3 00 00 00       	call   800306 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800253:	83 c4 18             	add    $0x18,%esp
+  800256:	53                   	push   %ebx
+  800257:	ff 75 10             	push   0x10(%ebp)
+  80025a:	e8 56 00 00 00       	call   8002b5 <vcprintf>
+	cprintf("\n");
+  80025f:	c7 04 24 8b 28 80 00 	movl   $0x80288b,(%esp)
+  800266:	e8 9b 00 00 00       	call   800306 <cprintf>
+  80026b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80026e:	cc                   	int3
+	while (1)
+  80026f:	eb fd                	jmp    80026e <_panic+0x43>
+
+00800271 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800271:	55                   	push   %ebp
+  800272:	89 e5                	mov    %esp,%ebp
+  800274:	53                   	push   %ebx
+  800275:	83 ec 04             	sub    $0x4,%esp
+  800278:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80027b:	8b 13                	mov    (%ebx),%edx
+  80027d:	8d 42 01             	lea    0x1(%edx),%eax
+  800280:	89 03                	mov    %eax,(%ebx)
+  800282:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800285:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800289:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80028e:	74 09                	je     800299 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800290:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800294:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800297:	c9                   	leave
+  800298:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800299:	83 ec 08             	sub    $0x8,%esp
+  80029c:	68 ff 00 00 00       	push   $0xff
+  8002a1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a4:	50                   	push   %eax
+  8002a5:	e8 7a 09 00 00       	call   800c24 <sys_cputs>
+		b->idx = 0;
+  8002aa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b0:	83 c4 10             	add    $0x10,%esp
+  8002b3:	eb db                	jmp    800290 <putch+0x1f>
+
+008002b5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002be:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002c5:	00 00 00 
+	b.cnt = 0;
+  8002c8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002cf:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d2:	ff 75 0c             	push   0xc(%ebp)
+  8002d5:	ff 75 08             	push   0x8(%ebp)
+  8002d8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	68 71 02 80 00       	push   $0x800271
+  8002e4:	e8 14 01 00 00       	call   8003fd <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002e9:	83 c4 08             	add    $0x8,%esp
+  8002ec:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f2:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002f8:	50                   	push   %eax
+  8002f9:	e8 26 09 00 00       	call   800c24 <sys_cputs>
+
+	return b.cnt;
+}
+  8002fe:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800304:	c9                   	leave
+  800305:	c3                   	ret
+
+00800306 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800306:	55                   	push   %ebp
+  800307:	89 e5                	mov    %esp,%ebp
+  800309:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80030c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80030f:	50                   	push   %eax
+  800310:	ff 75 08             	push   0x8(%ebp)
+  800313:	e8 9d ff ff ff       	call   8002b5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800318:	c9                   	leave
+  800319:	c3                   	ret
+
+0080031a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80031a:	55                   	push   %ebp
+  80031b:	89 e5                	mov    %esp,%ebp
+  80031d:	57                   	push   %edi
+  80031e:	56                   	push   %esi
+  80031f:	53                   	push   %ebx
+  800320:	83 ec 1c             	sub    $0x1c,%esp
+  800323:	89 c7                	mov    %eax,%edi
+  800325:	89 d6                	mov    %edx,%esi
+  800327:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80032d:	89 d1                	mov    %edx,%ecx
+  80032f:	89 c2                	mov    %eax,%edx
+  800331:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800334:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800337:	8b 45 10             	mov    0x10(%ebp),%eax
+  80033a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80033d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800340:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800347:	39 c2                	cmp    %eax,%edx
+  800349:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80034c:	72 3e                	jb     80038c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	ff 75 18             	push   0x18(%ebp)
+  800354:	83 eb 01             	sub    $0x1,%ebx
+  800357:	53                   	push   %ebx
+  800358:	50                   	push   %eax
+  800359:	83 ec 08             	sub    $0x8,%esp
+  80035c:	ff 75 e4             	push   -0x1c(%ebp)
+  80035f:	ff 75 e0             	push   -0x20(%ebp)
+  800362:	ff 75 dc             	push   -0x24(%ebp)
+  800365:	ff 75 d8             	push   -0x28(%ebp)
+  800368:	e8 23 21 00 00       	call   802490 <__udivdi3>
+  80036d:	83 c4 18             	add    $0x18,%esp
+  800370:	52                   	push   %edx
+  800371:	50                   	push   %eax
+  800372:	89 f2                	mov    %esi,%edx
+  800374:	89 f8                	mov    %edi,%eax
+  800376:	e8 9f ff ff ff       	call   80031a <printnum>
+  80037b:	83 c4 20             	add    $0x20,%esp
+  80037e:	eb 13                	jmp    800393 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800380:	83 ec 08             	sub    $0x8,%esp
+  800383:	56                   	push   %esi
+  800384:	ff 75 18             	push   0x18(%ebp)
+  800387:	ff d7                	call   *%edi
+  800389:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80038c:	83 eb 01             	sub    $0x1,%ebx
+  80038f:	85 db                	test   %ebx,%ebx
+  800391:	7f ed                	jg     800380 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800393:	83 ec 08             	sub    $0x8,%esp
+  800396:	56                   	push   %esi
+  800397:	83 ec 04             	sub    $0x4,%esp
+  80039a:	ff 75 e4             	push   -0x1c(%ebp)
+  80039d:	ff 75 e0             	push   -0x20(%ebp)
+  8003a0:	ff 75 dc             	push   -0x24(%ebp)
+  8003a3:	ff 75 d8             	push   -0x28(%ebp)
+  8003a6:	e8 a5 21 00 00       	call   802550 <__umoddi3>
+  8003ab:	83 c4 14             	add    $0x14,%esp
+  8003ae:	0f be 80 bb 28 80 00 	movsbl 0x8028bb(%eax),%eax
+  8003b5:	50                   	push   %eax
+  8003b6:	ff d7                	call   *%edi
+}
+  8003b8:	83 c4 10             	add    $0x10,%esp
+  8003bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003be:	5b                   	pop    %ebx
+  8003bf:	5e                   	pop    %esi
+  8003c0:	5f                   	pop    %edi
+  8003c1:	5d                   	pop    %ebp
+  8003c2:	c3                   	ret
+
+008003c3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c3:	55                   	push   %ebp
+  8003c4:	89 e5                	mov    %esp,%ebp
+  8003c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003c9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003cd:	8b 10                	mov    (%eax),%edx
+  8003cf:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d2:	73 0a                	jae    8003de <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003d7:	89 08                	mov    %ecx,(%eax)
+  8003d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003dc:	88 02                	mov    %al,(%edx)
+}
+  8003de:	5d                   	pop    %ebp
+  8003df:	c3                   	ret
+
+008003e0 <printfmt>:
+{
+  8003e0:	55                   	push   %ebp
+  8003e1:	89 e5                	mov    %esp,%ebp
+  8003e3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003e6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003e9:	50                   	push   %eax
+  8003ea:	ff 75 10             	push   0x10(%ebp)
+  8003ed:	ff 75 0c             	push   0xc(%ebp)
+  8003f0:	ff 75 08             	push   0x8(%ebp)
+  8003f3:	e8 05 00 00 00       	call   8003fd <vprintfmt>
+}
+  8003f8:	83 c4 10             	add    $0x10,%esp
+  8003fb:	c9                   	leave
+  8003fc:	c3                   	ret
+
+008003fd <vprintfmt>:
+{
+  8003fd:	55                   	push   %ebp
+  8003fe:	89 e5                	mov    %esp,%ebp
+  800400:	57                   	push   %edi
+  800401:	56                   	push   %esi
+  800402:	53                   	push   %ebx
+  800403:	83 ec 2c             	sub    $0x2c,%esp
+  800406:	8b 75 08             	mov    0x8(%ebp),%esi
+  800409:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80040c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80040f:	eb 0a                	jmp    80041b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800411:	83 ec 08             	sub    $0x8,%esp
+  800414:	53                   	push   %ebx
+  800415:	50                   	push   %eax
+  800416:	ff d6                	call   *%esi
+  800418:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80041b:	83 c7 01             	add    $0x1,%edi
+  80041e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800422:	83 f8 25             	cmp    $0x25,%eax
+  800425:	74 0c                	je     800433 <vprintfmt+0x36>
+			if (ch == '\0')
+  800427:	85 c0                	test   %eax,%eax
+  800429:	75 e6                	jne    800411 <vprintfmt+0x14>
+}
+  80042b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042e:	5b                   	pop    %ebx
+  80042f:	5e                   	pop    %esi
+  800430:	5f                   	pop    %edi
+  800431:	5d                   	pop    %ebp
+  800432:	c3                   	ret
+		padc = ' ';
+  800433:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800437:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80043e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800445:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80044c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800451:	8d 47 01             	lea    0x1(%edi),%eax
+  800454:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800457:	0f b6 17             	movzbl (%edi),%edx
+  80045a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80045d:	3c 55                	cmp    $0x55,%al
+  80045f:	0f 87 cf 03 00 00    	ja     800834 <vprintfmt+0x437>
+  800465:	0f b6 c0             	movzbl %al,%eax
+  800468:	ff 24 85 00 2a 80 00 	jmp    *0x802a00(,%eax,4)
+  80046f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800472:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800476:	eb d9                	jmp    800451 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800478:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80047b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80047f:	eb d0                	jmp    800451 <vprintfmt+0x54>
+  800481:	0f b6 d2             	movzbl %dl,%edx
+  800484:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80048f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800492:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800496:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800499:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80049c:	83 f9 09             	cmp    $0x9,%ecx
+  80049f:	77 55                	ja     8004f6 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004a1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004a4:	eb e9                	jmp    80048f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a9:	8b 00                	mov    (%eax),%eax
+  8004ab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004ba:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004be:	79 91                	jns    800451 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004cd:	eb 82                	jmp    800451 <vprintfmt+0x54>
+			if (width < 0)
+  8004cf:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d2:	85 d2                	test   %edx,%edx
+  8004d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d9:	0f 49 c2             	cmovns %edx,%eax
+  8004dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e2:	e9 6a ff ff ff       	jmp    800451 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004ea:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f1:	e9 5b ff ff ff       	jmp    800451 <vprintfmt+0x54>
+  8004f6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004f9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004fc:	eb bc                	jmp    8004ba <vprintfmt+0xbd>
+			lflag++;
+  8004fe:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800501:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800504:	e9 48 ff ff ff       	jmp    800451 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800509:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050c:	8d 78 04             	lea    0x4(%eax),%edi
+  80050f:	83 ec 08             	sub    $0x8,%esp
+  800512:	53                   	push   %ebx
+  800513:	ff 30                	push   (%eax)
+  800515:	ff d6                	call   *%esi
+			break;
+  800517:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80051a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80051d:	e9 b1 02 00 00       	jmp    8007d3 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800522:	8b 45 14             	mov    0x14(%ebp),%eax
+  800525:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800528:	8b 10                	mov    (%eax),%edx
+  80052a:	89 d0                	mov    %edx,%eax
+  80052c:	f7 d8                	neg    %eax
+  80052e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800531:	83 f8 0f             	cmp    $0xf,%eax
+  800534:	7f 23                	jg     800559 <vprintfmt+0x15c>
+  800536:	8b 14 85 60 2b 80 00 	mov    0x802b60(,%eax,4),%edx
+  80053d:	85 d2                	test   %edx,%edx
+  80053f:	74 18                	je     800559 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800541:	52                   	push   %edx
+  800542:	68 95 2c 80 00       	push   $0x802c95
+  800547:	53                   	push   %ebx
+  800548:	56                   	push   %esi
+  800549:	e8 92 fe ff ff       	call   8003e0 <printfmt>
+  80054e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800551:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800554:	e9 7a 02 00 00       	jmp    8007d3 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800559:	50                   	push   %eax
+  80055a:	68 d3 28 80 00       	push   $0x8028d3
+  80055f:	53                   	push   %ebx
+  800560:	56                   	push   %esi
+  800561:	e8 7a fe ff ff       	call   8003e0 <printfmt>
+  800566:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800569:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80056c:	e9 62 02 00 00       	jmp    8007d3 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800571:	8b 45 14             	mov    0x14(%ebp),%eax
+  800574:	83 c0 04             	add    $0x4,%eax
+  800577:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80057a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80057f:	85 c9                	test   %ecx,%ecx
+  800581:	b8 cc 28 80 00       	mov    $0x8028cc,%eax
+  800586:	0f 45 c1             	cmovne %ecx,%eax
+  800589:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80058c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800590:	7e 06                	jle    800598 <vprintfmt+0x19b>
+  800592:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800596:	75 0b                	jne    8005a3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800598:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80059b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80059e:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a1:	eb 5c                	jmp    8005ff <vprintfmt+0x202>
+  8005a3:	83 ec 08             	sub    $0x8,%esp
+  8005a6:	ff 75 d0             	push   -0x30(%ebp)
+  8005a9:	ff 75 cc             	push   -0x34(%ebp)
+  8005ac:	e8 20 03 00 00       	call   8008d1 <strnlen>
+  8005b1:	89 c2                	mov    %eax,%edx
+  8005b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b6:	29 d0                	sub    %edx,%eax
+  8005b8:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005bb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005bf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c5:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c7:	eb 0e                	jmp    8005d7 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005c9:	83 ec 08             	sub    $0x8,%esp
+  8005cc:	53                   	push   %ebx
+  8005cd:	57                   	push   %edi
+  8005ce:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d1:	83 ee 01             	sub    $0x1,%esi
+  8005d4:	83 c4 10             	add    $0x10,%esp
+  8005d7:	85 f6                	test   %esi,%esi
+  8005d9:	7f ee                	jg     8005c9 <vprintfmt+0x1cc>
+  8005db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e1:	85 c0                	test   %eax,%eax
+  8005e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005e8:	0f 49 d0             	cmovns %eax,%edx
+  8005eb:	29 d0                	sub    %edx,%eax
+  8005ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f0:	eb a6                	jmp    800598 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005f2:	83 ec 08             	sub    $0x8,%esp
+  8005f5:	53                   	push   %ebx
+  8005f6:	52                   	push   %edx
+  8005f7:	ff 55 08             	call   *0x8(%ebp)
+  8005fa:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005fd:	89 f1                	mov    %esi,%ecx
+  8005ff:	8d 71 01             	lea    0x1(%ecx),%esi
+  800602:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800606:	0f be d0             	movsbl %al,%edx
+  800609:	85 d2                	test   %edx,%edx
+  80060b:	74 28                	je     800635 <vprintfmt+0x238>
+  80060d:	85 ff                	test   %edi,%edi
+  80060f:	78 05                	js     800616 <vprintfmt+0x219>
+  800611:	83 ef 01             	sub    $0x1,%edi
+  800614:	78 30                	js     800646 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800616:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80061a:	74 d6                	je     8005f2 <vprintfmt+0x1f5>
+  80061c:	0f be c0             	movsbl %al,%eax
+  80061f:	83 e8 20             	sub    $0x20,%eax
+  800622:	83 f8 5e             	cmp    $0x5e,%eax
+  800625:	76 cb                	jbe    8005f2 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800627:	83 ec 08             	sub    $0x8,%esp
+  80062a:	53                   	push   %ebx
+  80062b:	6a 3f                	push   $0x3f
+  80062d:	ff 55 08             	call   *0x8(%ebp)
+  800630:	83 c4 10             	add    $0x10,%esp
+  800633:	eb c8                	jmp    8005fd <vprintfmt+0x200>
+  800635:	8b 75 08             	mov    0x8(%ebp),%esi
+  800638:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80063b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80063e:	01 d0                	add    %edx,%eax
+  800640:	29 c8                	sub    %ecx,%eax
+  800642:	89 c7                	mov    %eax,%edi
+  800644:	eb 13                	jmp    800659 <vprintfmt+0x25c>
+  800646:	8b 75 08             	mov    0x8(%ebp),%esi
+  800649:	eb ed                	jmp    800638 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80064b:	83 ec 08             	sub    $0x8,%esp
+  80064e:	53                   	push   %ebx
+  80064f:	6a 20                	push   $0x20
+  800651:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800653:	83 ef 01             	sub    $0x1,%edi
+  800656:	83 c4 10             	add    $0x10,%esp
+  800659:	85 ff                	test   %edi,%edi
+  80065b:	7f ee                	jg     80064b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80065d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800660:	89 45 14             	mov    %eax,0x14(%ebp)
+  800663:	e9 6b 01 00 00       	jmp    8007d3 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800668:	83 f9 01             	cmp    $0x1,%ecx
+  80066b:	7f 1f                	jg     80068c <vprintfmt+0x28f>
+	else if (lflag)
+  80066d:	85 c9                	test   %ecx,%ecx
+  80066f:	74 67                	je     8006d8 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800671:	8b 45 14             	mov    0x14(%ebp),%eax
+  800674:	8b 00                	mov    (%eax),%eax
+  800676:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800679:	89 c1                	mov    %eax,%ecx
+  80067b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80067e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800681:	8b 45 14             	mov    0x14(%ebp),%eax
+  800684:	8d 40 04             	lea    0x4(%eax),%eax
+  800687:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068a:	eb 17                	jmp    8006a3 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8b 50 04             	mov    0x4(%eax),%edx
+  800692:	8b 00                	mov    (%eax),%eax
+  800694:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800697:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80069a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069d:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006a9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006ae:	85 c9                	test   %ecx,%ecx
+  8006b0:	0f 89 03 01 00 00    	jns    8007b9 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006b6:	83 ec 08             	sub    $0x8,%esp
+  8006b9:	53                   	push   %ebx
+  8006ba:	6a 2d                	push   $0x2d
+  8006bc:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006be:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006c4:	f7 da                	neg    %edx
+  8006c6:	83 d1 00             	adc    $0x0,%ecx
+  8006c9:	f7 d9                	neg    %ecx
+  8006cb:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d3:	e9 e1 00 00 00       	jmp    8007b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006db:	8b 00                	mov    (%eax),%eax
+  8006dd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e0:	89 c1                	mov    %eax,%ecx
+  8006e2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006e5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f1:	eb b0                	jmp    8006a3 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006f3:	83 f9 01             	cmp    $0x1,%ecx
+  8006f6:	7f 1e                	jg     800716 <vprintfmt+0x319>
+	else if (lflag)
+  8006f8:	85 c9                	test   %ecx,%ecx
+  8006fa:	74 32                	je     80072e <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8006fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ff:	8b 10                	mov    (%eax),%edx
+  800701:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800706:	8d 40 04             	lea    0x4(%eax),%eax
+  800709:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800711:	e9 a3 00 00 00       	jmp    8007b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8b 10                	mov    (%eax),%edx
+  80071b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80071e:	8d 40 08             	lea    0x8(%eax),%eax
+  800721:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800724:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800729:	e9 8b 00 00 00       	jmp    8007b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8b 10                	mov    (%eax),%edx
+  800733:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800738:	8d 40 04             	lea    0x4(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80073e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800743:	eb 74                	jmp    8007b9 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800745:	83 f9 01             	cmp    $0x1,%ecx
+  800748:	7f 1b                	jg     800765 <vprintfmt+0x368>
+	else if (lflag)
+  80074a:	85 c9                	test   %ecx,%ecx
+  80074c:	74 2c                	je     80077a <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 10                	mov    (%eax),%edx
+  800753:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800758:	8d 40 04             	lea    0x4(%eax),%eax
+  80075b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80075e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800763:	eb 54                	jmp    8007b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800765:	8b 45 14             	mov    0x14(%ebp),%eax
+  800768:	8b 10                	mov    (%eax),%edx
+  80076a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80076d:	8d 40 08             	lea    0x8(%eax),%eax
+  800770:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800773:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800778:	eb 3f                	jmp    8007b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8b 10                	mov    (%eax),%edx
+  80077f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800784:	8d 40 04             	lea    0x4(%eax),%eax
+  800787:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80078a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80078f:	eb 28                	jmp    8007b9 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800791:	83 ec 08             	sub    $0x8,%esp
+  800794:	53                   	push   %ebx
+  800795:	6a 30                	push   $0x30
+  800797:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800799:	83 c4 08             	add    $0x8,%esp
+  80079c:	53                   	push   %ebx
+  80079d:	6a 78                	push   $0x78
+  80079f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8b 10                	mov    (%eax),%edx
+  8007a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007ab:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b4:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007b9:	83 ec 0c             	sub    $0xc,%esp
+  8007bc:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007c0:	50                   	push   %eax
+  8007c1:	ff 75 e0             	push   -0x20(%ebp)
+  8007c4:	57                   	push   %edi
+  8007c5:	51                   	push   %ecx
+  8007c6:	52                   	push   %edx
+  8007c7:	89 da                	mov    %ebx,%edx
+  8007c9:	89 f0                	mov    %esi,%eax
+  8007cb:	e8 4a fb ff ff       	call   80031a <printnum>
+			break;
+  8007d0:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007d6:	e9 40 fc ff ff       	jmp    80041b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007db:	83 f9 01             	cmp    $0x1,%ecx
+  8007de:	7f 1b                	jg     8007fb <vprintfmt+0x3fe>
+	else if (lflag)
+  8007e0:	85 c9                	test   %ecx,%ecx
+  8007e2:	74 2c                	je     800810 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e7:	8b 10                	mov    (%eax),%edx
+  8007e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007f9:	eb be                	jmp    8007b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fe:	8b 10                	mov    (%eax),%edx
+  800800:	8b 48 04             	mov    0x4(%eax),%ecx
+  800803:	8d 40 08             	lea    0x8(%eax),%eax
+  800806:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800809:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80080e:	eb a9                	jmp    8007b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800810:	8b 45 14             	mov    0x14(%ebp),%eax
+  800813:	8b 10                	mov    (%eax),%edx
+  800815:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081a:	8d 40 04             	lea    0x4(%eax),%eax
+  80081d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800820:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800825:	eb 92                	jmp    8007b9 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800827:	83 ec 08             	sub    $0x8,%esp
+  80082a:	53                   	push   %ebx
+  80082b:	6a 25                	push   $0x25
+  80082d:	ff d6                	call   *%esi
+			break;
+  80082f:	83 c4 10             	add    $0x10,%esp
+  800832:	eb 9f                	jmp    8007d3 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800834:	83 ec 08             	sub    $0x8,%esp
+  800837:	53                   	push   %ebx
+  800838:	6a 25                	push   $0x25
+  80083a:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80083c:	83 c4 10             	add    $0x10,%esp
+  80083f:	89 f8                	mov    %edi,%eax
+  800841:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800845:	74 05                	je     80084c <vprintfmt+0x44f>
+  800847:	83 e8 01             	sub    $0x1,%eax
+  80084a:	eb f5                	jmp    800841 <vprintfmt+0x444>
+  80084c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80084f:	eb 82                	jmp    8007d3 <vprintfmt+0x3d6>
+
+00800851 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800851:	55                   	push   %ebp
+  800852:	89 e5                	mov    %esp,%ebp
+  800854:	83 ec 18             	sub    $0x18,%esp
+  800857:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80085d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800860:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800864:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800867:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80086e:	85 c0                	test   %eax,%eax
+  800870:	74 26                	je     800898 <vsnprintf+0x47>
+  800872:	85 d2                	test   %edx,%edx
+  800874:	7e 22                	jle    800898 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800876:	ff 75 14             	push   0x14(%ebp)
+  800879:	ff 75 10             	push   0x10(%ebp)
+  80087c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80087f:	50                   	push   %eax
+  800880:	68 c3 03 80 00       	push   $0x8003c3
+  800885:	e8 73 fb ff ff       	call   8003fd <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80088a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80088d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800890:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800893:	83 c4 10             	add    $0x10,%esp
+}
+  800896:	c9                   	leave
+  800897:	c3                   	ret
+		return -E_INVAL;
+  800898:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80089d:	eb f7                	jmp    800896 <vsnprintf+0x45>
+
+0080089f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80089f:	55                   	push   %ebp
+  8008a0:	89 e5                	mov    %esp,%ebp
+  8008a2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008a5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008a8:	50                   	push   %eax
+  8008a9:	ff 75 10             	push   0x10(%ebp)
+  8008ac:	ff 75 0c             	push   0xc(%ebp)
+  8008af:	ff 75 08             	push   0x8(%ebp)
+  8008b2:	e8 9a ff ff ff       	call   800851 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008b7:	c9                   	leave
+  8008b8:	c3                   	ret
+
+008008b9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c4:	eb 03                	jmp    8008c9 <strlen+0x10>
+		n++;
+  8008c6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008c9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008cd:	75 f7                	jne    8008c6 <strlen+0xd>
+	return n;
+}
+  8008cf:	5d                   	pop    %ebp
+  8008d0:	c3                   	ret
+
+008008d1 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008d1:	55                   	push   %ebp
+  8008d2:	89 e5                	mov    %esp,%ebp
+  8008d4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008df:	eb 03                	jmp    8008e4 <strnlen+0x13>
+		n++;
+  8008e1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e4:	39 d0                	cmp    %edx,%eax
+  8008e6:	74 08                	je     8008f0 <strnlen+0x1f>
+  8008e8:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008ec:	75 f3                	jne    8008e1 <strnlen+0x10>
+  8008ee:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008f0:	89 d0                	mov    %edx,%eax
+  8008f2:	5d                   	pop    %ebp
+  8008f3:	c3                   	ret
+
+008008f4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008f4:	55                   	push   %ebp
+  8008f5:	89 e5                	mov    %esp,%ebp
+  8008f7:	53                   	push   %ebx
+  8008f8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800903:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800907:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80090a:	83 c0 01             	add    $0x1,%eax
+  80090d:	84 d2                	test   %dl,%dl
+  80090f:	75 f2                	jne    800903 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800911:	89 c8                	mov    %ecx,%eax
+  800913:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800916:	c9                   	leave
+  800917:	c3                   	ret
+
+00800918 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800918:	55                   	push   %ebp
+  800919:	89 e5                	mov    %esp,%ebp
+  80091b:	53                   	push   %ebx
+  80091c:	83 ec 10             	sub    $0x10,%esp
+  80091f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800922:	53                   	push   %ebx
+  800923:	e8 91 ff ff ff       	call   8008b9 <strlen>
+  800928:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80092b:	ff 75 0c             	push   0xc(%ebp)
+  80092e:	01 d8                	add    %ebx,%eax
+  800930:	50                   	push   %eax
+  800931:	e8 be ff ff ff       	call   8008f4 <strcpy>
+	return dst;
+}
+  800936:	89 d8                	mov    %ebx,%eax
+  800938:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093b:	c9                   	leave
+  80093c:	c3                   	ret
+
+0080093d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80093d:	55                   	push   %ebp
+  80093e:	89 e5                	mov    %esp,%ebp
+  800940:	56                   	push   %esi
+  800941:	53                   	push   %ebx
+  800942:	8b 75 08             	mov    0x8(%ebp),%esi
+  800945:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800948:	89 f3                	mov    %esi,%ebx
+  80094a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80094d:	89 f0                	mov    %esi,%eax
+  80094f:	eb 0f                	jmp    800960 <strncpy+0x23>
+		*dst++ = *src;
+  800951:	83 c0 01             	add    $0x1,%eax
+  800954:	0f b6 0a             	movzbl (%edx),%ecx
+  800957:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80095a:	80 f9 01             	cmp    $0x1,%cl
+  80095d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800960:	39 d8                	cmp    %ebx,%eax
+  800962:	75 ed                	jne    800951 <strncpy+0x14>
+	}
+	return ret;
+}
+  800964:	89 f0                	mov    %esi,%eax
+  800966:	5b                   	pop    %ebx
+  800967:	5e                   	pop    %esi
+  800968:	5d                   	pop    %ebp
+  800969:	c3                   	ret
+
+0080096a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80096a:	55                   	push   %ebp
+  80096b:	89 e5                	mov    %esp,%ebp
+  80096d:	56                   	push   %esi
+  80096e:	53                   	push   %ebx
+  80096f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800972:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800975:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800978:	89 f0                	mov    %esi,%eax
+  80097a:	85 d2                	test   %edx,%edx
+  80097c:	74 21                	je     80099f <strlcpy+0x35>
+  80097e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800982:	89 f2                	mov    %esi,%edx
+  800984:	eb 09                	jmp    80098f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800986:	83 c1 01             	add    $0x1,%ecx
+  800989:	83 c2 01             	add    $0x1,%edx
+  80098c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80098f:	39 c2                	cmp    %eax,%edx
+  800991:	74 09                	je     80099c <strlcpy+0x32>
+  800993:	0f b6 19             	movzbl (%ecx),%ebx
+  800996:	84 db                	test   %bl,%bl
+  800998:	75 ec                	jne    800986 <strlcpy+0x1c>
+  80099a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80099c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80099f:	29 f0                	sub    %esi,%eax
+}
+  8009a1:	5b                   	pop    %ebx
+  8009a2:	5e                   	pop    %esi
+  8009a3:	5d                   	pop    %ebp
+  8009a4:	c3                   	ret
+
+008009a5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ae:	eb 06                	jmp    8009b6 <strcmp+0x11>
+		p++, q++;
+  8009b0:	83 c1 01             	add    $0x1,%ecx
+  8009b3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009b6:	0f b6 01             	movzbl (%ecx),%eax
+  8009b9:	84 c0                	test   %al,%al
+  8009bb:	74 04                	je     8009c1 <strcmp+0x1c>
+  8009bd:	3a 02                	cmp    (%edx),%al
+  8009bf:	74 ef                	je     8009b0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c1:	0f b6 c0             	movzbl %al,%eax
+  8009c4:	0f b6 12             	movzbl (%edx),%edx
+  8009c7:	29 d0                	sub    %edx,%eax
+}
+  8009c9:	5d                   	pop    %ebp
+  8009ca:	c3                   	ret
+
+008009cb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009cb:	55                   	push   %ebp
+  8009cc:	89 e5                	mov    %esp,%ebp
+  8009ce:	53                   	push   %ebx
+  8009cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d5:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009d8:	eb 09                	jmp    8009e3 <strncmp+0x18>
+		n--, p++, q++;
+  8009da:	83 ea 01             	sub    $0x1,%edx
+  8009dd:	83 c0 01             	add    $0x1,%eax
+  8009e0:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009e3:	85 d2                	test   %edx,%edx
+  8009e5:	74 18                	je     8009ff <strncmp+0x34>
+  8009e7:	0f b6 18             	movzbl (%eax),%ebx
+  8009ea:	84 db                	test   %bl,%bl
+  8009ec:	74 04                	je     8009f2 <strncmp+0x27>
+  8009ee:	3a 19                	cmp    (%ecx),%bl
+  8009f0:	74 e8                	je     8009da <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f2:	0f b6 00             	movzbl (%eax),%eax
+  8009f5:	0f b6 11             	movzbl (%ecx),%edx
+  8009f8:	29 d0                	sub    %edx,%eax
+}
+  8009fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009fd:	c9                   	leave
+  8009fe:	c3                   	ret
+		return 0;
+  8009ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a04:	eb f4                	jmp    8009fa <strncmp+0x2f>
+
+00800a06 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a06:	55                   	push   %ebp
+  800a07:	89 e5                	mov    %esp,%ebp
+  800a09:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a10:	eb 03                	jmp    800a15 <strchr+0xf>
+  800a12:	83 c0 01             	add    $0x1,%eax
+  800a15:	0f b6 10             	movzbl (%eax),%edx
+  800a18:	84 d2                	test   %dl,%dl
+  800a1a:	74 06                	je     800a22 <strchr+0x1c>
+		if (*s == c)
+  800a1c:	38 ca                	cmp    %cl,%dl
+  800a1e:	75 f2                	jne    800a12 <strchr+0xc>
+  800a20:	eb 05                	jmp    800a27 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a27:	5d                   	pop    %ebp
+  800a28:	c3                   	ret
+
+00800a29 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a29:	55                   	push   %ebp
+  800a2a:	89 e5                	mov    %esp,%ebp
+  800a2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a33:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a36:	38 ca                	cmp    %cl,%dl
+  800a38:	74 09                	je     800a43 <strfind+0x1a>
+  800a3a:	84 d2                	test   %dl,%dl
+  800a3c:	74 05                	je     800a43 <strfind+0x1a>
+	for (; *s; s++)
+  800a3e:	83 c0 01             	add    $0x1,%eax
+  800a41:	eb f0                	jmp    800a33 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a43:	5d                   	pop    %ebp
+  800a44:	c3                   	ret
+
+00800a45 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	57                   	push   %edi
+  800a49:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a4c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a4f:	85 c9                	test   %ecx,%ecx
+  800a51:	74 20                	je     800a73 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a53:	89 f8                	mov    %edi,%eax
+  800a55:	09 c8                	or     %ecx,%eax
+  800a57:	a8 03                	test   $0x3,%al
+  800a59:	75 12                	jne    800a6d <memset+0x28>
+		c &= 0xFF;
+  800a5b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a5f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a65:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a68:	fc                   	cld
+  800a69:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a6b:	eb 06                	jmp    800a73 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a70:	fc                   	cld
+  800a71:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a73:	89 f8                	mov    %edi,%eax
+  800a75:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a78:	c9                   	leave
+  800a79:	c3                   	ret
+
+00800a7a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a7a:	55                   	push   %ebp
+  800a7b:	89 e5                	mov    %esp,%ebp
+  800a7d:	57                   	push   %edi
+  800a7e:	56                   	push   %esi
+  800a7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a82:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a85:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a88:	39 c6                	cmp    %eax,%esi
+  800a8a:	73 32                	jae    800abe <memmove+0x44>
+  800a8c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a8f:	39 d0                	cmp    %edx,%eax
+  800a91:	73 2b                	jae    800abe <memmove+0x44>
+		s += n;
+		d += n;
+  800a93:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a96:	89 d6                	mov    %edx,%esi
+  800a98:	09 fe                	or     %edi,%esi
+  800a9a:	09 ce                	or     %ecx,%esi
+  800a9c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aa2:	75 0e                	jne    800ab2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800aa4:	83 ef 04             	sub    $0x4,%edi
+  800aa7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aaa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aad:	fd                   	std
+  800aae:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ab0:	eb 09                	jmp    800abb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ab2:	83 ef 01             	sub    $0x1,%edi
+  800ab5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ab8:	fd                   	std
+  800ab9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800abb:	fc                   	cld
+  800abc:	eb 1a                	jmp    800ad8 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800abe:	89 f2                	mov    %esi,%edx
+  800ac0:	09 c2                	or     %eax,%edx
+  800ac2:	09 ca                	or     %ecx,%edx
+  800ac4:	f6 c2 03             	test   $0x3,%dl
+  800ac7:	75 0a                	jne    800ad3 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ac9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800acc:	89 c7                	mov    %eax,%edi
+  800ace:	fc                   	cld
+  800acf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad1:	eb 05                	jmp    800ad8 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ad3:	89 c7                	mov    %eax,%edi
+  800ad5:	fc                   	cld
+  800ad6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ad8:	5e                   	pop    %esi
+  800ad9:	5f                   	pop    %edi
+  800ada:	5d                   	pop    %ebp
+  800adb:	c3                   	ret
+
+00800adc <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800adc:	55                   	push   %ebp
+  800add:	89 e5                	mov    %esp,%ebp
+  800adf:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ae2:	ff 75 10             	push   0x10(%ebp)
+  800ae5:	ff 75 0c             	push   0xc(%ebp)
+  800ae8:	ff 75 08             	push   0x8(%ebp)
+  800aeb:	e8 8a ff ff ff       	call   800a7a <memmove>
+}
+  800af0:	c9                   	leave
+  800af1:	c3                   	ret
+
+00800af2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800af2:	55                   	push   %ebp
+  800af3:	89 e5                	mov    %esp,%ebp
+  800af5:	56                   	push   %esi
+  800af6:	53                   	push   %ebx
+  800af7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800afd:	89 c6                	mov    %eax,%esi
+  800aff:	03 75 10             	add    0x10(%ebp),%esi
+  800b02:	eb 06                	jmp    800b0a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b04:	83 c0 01             	add    $0x1,%eax
+  800b07:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b0a:	39 f0                	cmp    %esi,%eax
+  800b0c:	74 14                	je     800b22 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b0e:	0f b6 08             	movzbl (%eax),%ecx
+  800b11:	0f b6 1a             	movzbl (%edx),%ebx
+  800b14:	38 d9                	cmp    %bl,%cl
+  800b16:	74 ec                	je     800b04 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b18:	0f b6 c1             	movzbl %cl,%eax
+  800b1b:	0f b6 db             	movzbl %bl,%ebx
+  800b1e:	29 d8                	sub    %ebx,%eax
+  800b20:	eb 05                	jmp    800b27 <memcmp+0x35>
+	}
+
+	return 0;
+  800b22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b27:	5b                   	pop    %ebx
+  800b28:	5e                   	pop    %esi
+  800b29:	5d                   	pop    %ebp
+  800b2a:	c3                   	ret
+
+00800b2b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b2b:	55                   	push   %ebp
+  800b2c:	89 e5                	mov    %esp,%ebp
+  800b2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b34:	89 c2                	mov    %eax,%edx
+  800b36:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b39:	eb 03                	jmp    800b3e <memfind+0x13>
+  800b3b:	83 c0 01             	add    $0x1,%eax
+  800b3e:	39 d0                	cmp    %edx,%eax
+  800b40:	73 04                	jae    800b46 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b42:	38 08                	cmp    %cl,(%eax)
+  800b44:	75 f5                	jne    800b3b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b46:	5d                   	pop    %ebp
+  800b47:	c3                   	ret
+
+00800b48 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b48:	55                   	push   %ebp
+  800b49:	89 e5                	mov    %esp,%ebp
+  800b4b:	57                   	push   %edi
+  800b4c:	56                   	push   %esi
+  800b4d:	53                   	push   %ebx
+  800b4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b54:	eb 03                	jmp    800b59 <strtol+0x11>
+		s++;
+  800b56:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b59:	0f b6 02             	movzbl (%edx),%eax
+  800b5c:	3c 20                	cmp    $0x20,%al
+  800b5e:	74 f6                	je     800b56 <strtol+0xe>
+  800b60:	3c 09                	cmp    $0x9,%al
+  800b62:	74 f2                	je     800b56 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b64:	3c 2b                	cmp    $0x2b,%al
+  800b66:	74 2a                	je     800b92 <strtol+0x4a>
+	int neg = 0;
+  800b68:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b6d:	3c 2d                	cmp    $0x2d,%al
+  800b6f:	74 2b                	je     800b9c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b71:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b77:	75 0f                	jne    800b88 <strtol+0x40>
+  800b79:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b7c:	74 28                	je     800ba6 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b7e:	85 db                	test   %ebx,%ebx
+  800b80:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b85:	0f 44 d8             	cmove  %eax,%ebx
+  800b88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b90:	eb 46                	jmp    800bd8 <strtol+0x90>
+		s++;
+  800b92:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b95:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b9a:	eb d5                	jmp    800b71 <strtol+0x29>
+		s++, neg = 1;
+  800b9c:	83 c2 01             	add    $0x1,%edx
+  800b9f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ba4:	eb cb                	jmp    800b71 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800baa:	74 0e                	je     800bba <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bac:	85 db                	test   %ebx,%ebx
+  800bae:	75 d8                	jne    800b88 <strtol+0x40>
+		s++, base = 8;
+  800bb0:	83 c2 01             	add    $0x1,%edx
+  800bb3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bb8:	eb ce                	jmp    800b88 <strtol+0x40>
+		s += 2, base = 16;
+  800bba:	83 c2 02             	add    $0x2,%edx
+  800bbd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bc2:	eb c4                	jmp    800b88 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bc4:	0f be c0             	movsbl %al,%eax
+  800bc7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bca:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bcd:	7d 3a                	jge    800c09 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bcf:	83 c2 01             	add    $0x1,%edx
+  800bd2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bd6:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bd8:	0f b6 02             	movzbl (%edx),%eax
+  800bdb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bde:	89 f3                	mov    %esi,%ebx
+  800be0:	80 fb 09             	cmp    $0x9,%bl
+  800be3:	76 df                	jbe    800bc4 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800be5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800be8:	89 f3                	mov    %esi,%ebx
+  800bea:	80 fb 19             	cmp    $0x19,%bl
+  800bed:	77 08                	ja     800bf7 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bef:	0f be c0             	movsbl %al,%eax
+  800bf2:	83 e8 57             	sub    $0x57,%eax
+  800bf5:	eb d3                	jmp    800bca <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bf7:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bfa:	89 f3                	mov    %esi,%ebx
+  800bfc:	80 fb 19             	cmp    $0x19,%bl
+  800bff:	77 08                	ja     800c09 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c01:	0f be c0             	movsbl %al,%eax
+  800c04:	83 e8 37             	sub    $0x37,%eax
+  800c07:	eb c1                	jmp    800bca <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c09:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c0d:	74 05                	je     800c14 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c12:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c14:	89 c8                	mov    %ecx,%eax
+  800c16:	f7 d8                	neg    %eax
+  800c18:	85 ff                	test   %edi,%edi
+  800c1a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c1d:	89 c8                	mov    %ecx,%eax
+  800c1f:	5b                   	pop    %ebx
+  800c20:	5e                   	pop    %esi
+  800c21:	5f                   	pop    %edi
+  800c22:	5d                   	pop    %ebp
+  800c23:	c3                   	ret
+
+00800c24 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	56                   	push   %esi
+  800c29:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c35:	89 c3                	mov    %eax,%ebx
+  800c37:	89 c7                	mov    %eax,%edi
+  800c39:	89 c6                	mov    %eax,%esi
+  800c3b:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c3d:	5b                   	pop    %ebx
+  800c3e:	5e                   	pop    %esi
+  800c3f:	5f                   	pop    %edi
+  800c40:	5d                   	pop    %ebp
+  800c41:	c3                   	ret
+
+00800c42 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	57                   	push   %edi
+  800c46:	56                   	push   %esi
+  800c47:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c52:	89 d1                	mov    %edx,%ecx
+  800c54:	89 d3                	mov    %edx,%ebx
+  800c56:	89 d7                	mov    %edx,%edi
+  800c58:	89 d6                	mov    %edx,%esi
+  800c5a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c5c:	5b                   	pop    %ebx
+  800c5d:	5e                   	pop    %esi
+  800c5e:	5f                   	pop    %edi
+  800c5f:	5d                   	pop    %ebp
+  800c60:	c3                   	ret
+
+00800c61 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800c61:	55                   	push   %ebp
+  800c62:	89 e5                	mov    %esp,%ebp
+  800c64:	57                   	push   %edi
+  800c65:	56                   	push   %esi
+  800c66:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c74:	89 cb                	mov    %ecx,%ebx
+  800c76:	89 cf                	mov    %ecx,%edi
+  800c78:	89 ce                	mov    %ecx,%esi
+  800c7a:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800c7c:	5b                   	pop    %ebx
+  800c7d:	5e                   	pop    %esi
+  800c7e:	5f                   	pop    %edi
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+
+00800c81 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	57                   	push   %edi
+  800c85:	56                   	push   %esi
+  800c86:	53                   	push   %ebx
+  800c87:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c92:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c97:	89 cb                	mov    %ecx,%ebx
+  800c99:	89 cf                	mov    %ecx,%edi
+  800c9b:	89 ce                	mov    %ecx,%esi
+  800c9d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c9f:	85 c0                	test   %eax,%eax
+  800ca1:	7f 08                	jg     800cab <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ca3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca6:	5b                   	pop    %ebx
+  800ca7:	5e                   	pop    %esi
+  800ca8:	5f                   	pop    %edi
+  800ca9:	5d                   	pop    %ebp
+  800caa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cab:	83 ec 0c             	sub    $0xc,%esp
+  800cae:	50                   	push   %eax
+  800caf:	6a 03                	push   $0x3
+  800cb1:	68 bf 2b 80 00       	push   $0x802bbf
+  800cb6:	6a 23                	push   $0x23
+  800cb8:	68 dc 2b 80 00       	push   $0x802bdc
+  800cbd:	e8 69 f5 ff ff       	call   80022b <_panic>
+
+00800cc2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cc2:	55                   	push   %ebp
+  800cc3:	89 e5                	mov    %esp,%ebp
+  800cc5:	57                   	push   %edi
+  800cc6:	56                   	push   %esi
+  800cc7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd2:	89 d1                	mov    %edx,%ecx
+  800cd4:	89 d3                	mov    %edx,%ebx
+  800cd6:	89 d7                	mov    %edx,%edi
+  800cd8:	89 d6                	mov    %edx,%esi
+  800cda:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cdc:	5b                   	pop    %ebx
+  800cdd:	5e                   	pop    %esi
+  800cde:	5f                   	pop    %edi
+  800cdf:	5d                   	pop    %ebp
+  800ce0:	c3                   	ret
+
+00800ce1 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	57                   	push   %edi
+  800ce5:	56                   	push   %esi
+  800ce6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ce7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cec:	b8 16 00 00 00       	mov    $0x16,%eax
+  800cf1:	89 d1                	mov    %edx,%ecx
+  800cf3:	89 d3                	mov    %edx,%ebx
+  800cf5:	89 d7                	mov    %edx,%edi
+  800cf7:	89 d6                	mov    %edx,%esi
+  800cf9:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+
+00800d00 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800d00:	55                   	push   %ebp
+  800d01:	89 e5                	mov    %esp,%ebp
+  800d03:	57                   	push   %edi
+  800d04:	56                   	push   %esi
+  800d05:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d0b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d10:	89 d1                	mov    %edx,%ecx
+  800d12:	89 d3                	mov    %edx,%ebx
+  800d14:	89 d7                	mov    %edx,%edi
+  800d16:	89 d6                	mov    %edx,%esi
+  800d18:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800d1a:	5b                   	pop    %ebx
+  800d1b:	5e                   	pop    %esi
+  800d1c:	5f                   	pop    %edi
+  800d1d:	5d                   	pop    %ebp
+  800d1e:	c3                   	ret
+
+00800d1f <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800d1f:	55                   	push   %ebp
+  800d20:	89 e5                	mov    %esp,%ebp
+  800d22:	57                   	push   %edi
+  800d23:	56                   	push   %esi
+  800d24:	53                   	push   %ebx
+  800d25:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d33:	b8 15 00 00 00       	mov    $0x15,%eax
+  800d38:	89 df                	mov    %ebx,%edi
+  800d3a:	89 de                	mov    %ebx,%esi
+  800d3c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d3e:	85 c0                	test   %eax,%eax
+  800d40:	7f 08                	jg     800d4a <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800d42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d45:	5b                   	pop    %ebx
+  800d46:	5e                   	pop    %esi
+  800d47:	5f                   	pop    %edi
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d4a:	83 ec 0c             	sub    $0xc,%esp
+  800d4d:	50                   	push   %eax
+  800d4e:	6a 15                	push   $0x15
+  800d50:	68 bf 2b 80 00       	push   $0x802bbf
+  800d55:	6a 23                	push   $0x23
+  800d57:	68 dc 2b 80 00       	push   $0x802bdc
+  800d5c:	e8 ca f4 ff ff       	call   80022b <_panic>
+
+00800d61 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d61:	55                   	push   %ebp
+  800d62:	89 e5                	mov    %esp,%ebp
+  800d64:	57                   	push   %edi
+  800d65:	56                   	push   %esi
+  800d66:	53                   	push   %ebx
+  800d67:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6a:	be 00 00 00 00       	mov    $0x0,%esi
+  800d6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d75:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7d:	89 f7                	mov    %esi,%edi
+  800d7f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d81:	85 c0                	test   %eax,%eax
+  800d83:	7f 08                	jg     800d8d <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d88:	5b                   	pop    %ebx
+  800d89:	5e                   	pop    %esi
+  800d8a:	5f                   	pop    %edi
+  800d8b:	5d                   	pop    %ebp
+  800d8c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8d:	83 ec 0c             	sub    $0xc,%esp
+  800d90:	50                   	push   %eax
+  800d91:	6a 05                	push   $0x5
+  800d93:	68 bf 2b 80 00       	push   $0x802bbf
+  800d98:	6a 23                	push   $0x23
+  800d9a:	68 dc 2b 80 00       	push   $0x802bdc
+  800d9f:	e8 87 f4 ff ff       	call   80022b <_panic>
+
+00800da4 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	57                   	push   %edi
+  800da8:	56                   	push   %esi
+  800da9:	53                   	push   %ebx
+  800daa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dad:	be 00 00 00 00       	mov    $0x0,%esi
+  800db2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db8:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc0:	89 f7                	mov    %esi,%edi
+  800dc2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc4:	85 c0                	test   %eax,%eax
+  800dc6:	7f 08                	jg     800dd0 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dcb:	5b                   	pop    %ebx
+  800dcc:	5e                   	pop    %esi
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd0:	83 ec 0c             	sub    $0xc,%esp
+  800dd3:	50                   	push   %eax
+  800dd4:	6a 06                	push   $0x6
+  800dd6:	68 bf 2b 80 00       	push   $0x802bbf
+  800ddb:	6a 23                	push   $0x23
+  800ddd:	68 dc 2b 80 00       	push   $0x802bdc
+  800de2:	e8 44 f4 ff ff       	call   80022b <_panic>
+
+00800de7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	56                   	push   %esi
+  800dec:	53                   	push   %ebx
+  800ded:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df6:	b8 07 00 00 00       	mov    $0x7,%eax
+  800dfb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e01:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e04:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e06:	85 c0                	test   %eax,%eax
+  800e08:	7f 08                	jg     800e12 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0d:	5b                   	pop    %ebx
+  800e0e:	5e                   	pop    %esi
+  800e0f:	5f                   	pop    %edi
+  800e10:	5d                   	pop    %ebp
+  800e11:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e12:	83 ec 0c             	sub    $0xc,%esp
+  800e15:	50                   	push   %eax
+  800e16:	6a 07                	push   $0x7
+  800e18:	68 bf 2b 80 00       	push   $0x802bbf
+  800e1d:	6a 23                	push   $0x23
+  800e1f:	68 dc 2b 80 00       	push   $0x802bdc
+  800e24:	e8 02 f4 ff ff       	call   80022b <_panic>
+
+00800e29 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e29:	55                   	push   %ebp
+  800e2a:	89 e5                	mov    %esp,%ebp
+  800e2c:	57                   	push   %edi
+  800e2d:	56                   	push   %esi
+  800e2e:	53                   	push   %ebx
+  800e2f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e42:	89 df                	mov    %ebx,%edi
+  800e44:	89 de                	mov    %ebx,%esi
+  800e46:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e48:	85 c0                	test   %eax,%eax
+  800e4a:	7f 08                	jg     800e54 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4f:	5b                   	pop    %ebx
+  800e50:	5e                   	pop    %esi
+  800e51:	5f                   	pop    %edi
+  800e52:	5d                   	pop    %ebp
+  800e53:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e54:	83 ec 0c             	sub    $0xc,%esp
+  800e57:	50                   	push   %eax
+  800e58:	6a 08                	push   $0x8
+  800e5a:	68 bf 2b 80 00       	push   $0x802bbf
+  800e5f:	6a 23                	push   $0x23
+  800e61:	68 dc 2b 80 00       	push   $0x802bdc
+  800e66:	e8 c0 f3 ff ff       	call   80022b <_panic>
+
+00800e6b <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e6b:	55                   	push   %ebp
+  800e6c:	89 e5                	mov    %esp,%ebp
+  800e6e:	57                   	push   %edi
+  800e6f:	56                   	push   %esi
+  800e70:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e77:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e7c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e84:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e87:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e89:	5b                   	pop    %ebx
+  800e8a:	5e                   	pop    %esi
+  800e8b:	5f                   	pop    %edi
+  800e8c:	5d                   	pop    %ebp
+  800e8d:	c3                   	ret
+
+00800e8e <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e8e:	55                   	push   %ebp
+  800e8f:	89 e5                	mov    %esp,%ebp
+  800e91:	57                   	push   %edi
+  800e92:	56                   	push   %esi
+  800e93:	53                   	push   %ebx
+  800e94:	8b 45 18             	mov    0x18(%ebp),%eax
+  800e97:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800e9a:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800e9f:	77 27                	ja     800ec8 <sys_page_map_range+0x3a>
+  800ea1:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800ea7:	77 1f                	ja     800ec8 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800ea9:	c1 e0 0c             	shl    $0xc,%eax
+  800eac:	89 c6                	mov    %eax,%esi
+  800eae:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800eb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ebb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec1:	cd 30                	int    $0x30
+}
+  800ec3:	5b                   	pop    %ebx
+  800ec4:	5e                   	pop    %esi
+  800ec5:	5f                   	pop    %edi
+  800ec6:	5d                   	pop    %ebp
+  800ec7:	c3                   	ret
+		return -E_INVAL;
+  800ec8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ecd:	eb f4                	jmp    800ec3 <sys_page_map_range+0x35>
+
+00800ecf <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800ecf:	55                   	push   %ebp
+  800ed0:	89 e5                	mov    %esp,%ebp
+  800ed2:	57                   	push   %edi
+  800ed3:	56                   	push   %esi
+  800ed4:	53                   	push   %ebx
+  800ed5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ede:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ee3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eeb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef0:	85 c0                	test   %eax,%eax
+  800ef2:	7f 08                	jg     800efc <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+  800eff:	50                   	push   %eax
+  800f00:	6a 0c                	push   $0xc
+  800f02:	68 bf 2b 80 00       	push   $0x802bbf
+  800f07:	6a 23                	push   $0x23
+  800f09:	68 dc 2b 80 00       	push   $0x802bdc
+  800f0e:	e8 18 f3 ff ff       	call   80022b <_panic>
+
+00800f13 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f19:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f24:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2c:	89 f7                	mov    %esi,%edi
+  800f2e:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f30:	5b                   	pop    %ebx
+  800f31:	5e                   	pop    %esi
+  800f32:	5f                   	pop    %edi
+  800f33:	5d                   	pop    %ebp
+  800f34:	c3                   	ret
+
+00800f35 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f35:	55                   	push   %ebp
+  800f36:	89 e5                	mov    %esp,%ebp
+  800f38:	57                   	push   %edi
+  800f39:	56                   	push   %esi
+  800f3a:	53                   	push   %ebx
+  800f3b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f49:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f4e:	89 df                	mov    %ebx,%edi
+  800f50:	89 de                	mov    %ebx,%esi
+  800f52:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f54:	85 c0                	test   %eax,%eax
+  800f56:	7f 08                	jg     800f60 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5b:	5b                   	pop    %ebx
+  800f5c:	5e                   	pop    %esi
+  800f5d:	5f                   	pop    %edi
+  800f5e:	5d                   	pop    %ebp
+  800f5f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f60:	83 ec 0c             	sub    $0xc,%esp
+  800f63:	50                   	push   %eax
+  800f64:	6a 0f                	push   $0xf
+  800f66:	68 bf 2b 80 00       	push   $0x802bbf
+  800f6b:	6a 23                	push   $0x23
+  800f6d:	68 dc 2b 80 00       	push   $0x802bdc
+  800f72:	e8 b4 f2 ff ff       	call   80022b <_panic>
+
+00800f77 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800f77:	55                   	push   %ebp
+  800f78:	89 e5                	mov    %esp,%ebp
+  800f7a:	57                   	push   %edi
+  800f7b:	56                   	push   %esi
+  800f7c:	53                   	push   %ebx
+  800f7d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f90:	89 df                	mov    %ebx,%edi
+  800f92:	89 de                	mov    %ebx,%esi
+  800f94:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f96:	85 c0                	test   %eax,%eax
+  800f98:	7f 08                	jg     800fa2 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800f9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9d:	5b                   	pop    %ebx
+  800f9e:	5e                   	pop    %esi
+  800f9f:	5f                   	pop    %edi
+  800fa0:	5d                   	pop    %ebp
+  800fa1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa2:	83 ec 0c             	sub    $0xc,%esp
+  800fa5:	50                   	push   %eax
+  800fa6:	6a 10                	push   $0x10
+  800fa8:	68 bf 2b 80 00       	push   $0x802bbf
+  800fad:	6a 23                	push   $0x23
+  800faf:	68 dc 2b 80 00       	push   $0x802bdc
+  800fb4:	e8 72 f2 ff ff       	call   80022b <_panic>
+
+00800fb9 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800fb9:	55                   	push   %ebp
+  800fba:	89 e5                	mov    %esp,%ebp
+  800fbc:	57                   	push   %edi
+  800fbd:	56                   	push   %esi
+  800fbe:	53                   	push   %ebx
+  800fbf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcd:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fd2:	89 df                	mov    %ebx,%edi
+  800fd4:	89 de                	mov    %ebx,%esi
+  800fd6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd8:	85 c0                	test   %eax,%eax
+  800fda:	7f 08                	jg     800fe4 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800fdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdf:	5b                   	pop    %ebx
+  800fe0:	5e                   	pop    %esi
+  800fe1:	5f                   	pop    %edi
+  800fe2:	5d                   	pop    %ebp
+  800fe3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe4:	83 ec 0c             	sub    $0xc,%esp
+  800fe7:	50                   	push   %eax
+  800fe8:	6a 11                	push   $0x11
+  800fea:	68 bf 2b 80 00       	push   $0x802bbf
+  800fef:	6a 23                	push   $0x23
+  800ff1:	68 dc 2b 80 00       	push   $0x802bdc
+  800ff6:	e8 30 f2 ff ff       	call   80022b <_panic>
+
+00800ffb <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	57                   	push   %edi
+  800fff:	56                   	push   %esi
+  801000:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801001:	ba 00 00 00 00       	mov    $0x0,%edx
+  801006:	b8 12 00 00 00       	mov    $0x12,%eax
+  80100b:	89 d1                	mov    %edx,%ecx
+  80100d:	89 d3                	mov    %edx,%ebx
+  80100f:	89 d7                	mov    %edx,%edi
+  801011:	89 d6                	mov    %edx,%esi
+  801013:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  801015:	5b                   	pop    %ebx
+  801016:	5e                   	pop    %esi
+  801017:	5f                   	pop    %edi
+  801018:	5d                   	pop    %ebp
+  801019:	c3                   	ret
+
+0080101a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80101a:	55                   	push   %ebp
+  80101b:	89 e5                	mov    %esp,%ebp
+  80101d:	57                   	push   %edi
+  80101e:	56                   	push   %esi
+  80101f:	53                   	push   %ebx
+  801020:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801023:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801028:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801033:	89 df                	mov    %ebx,%edi
+  801035:	89 de                	mov    %ebx,%esi
+  801037:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801039:	85 c0                	test   %eax,%eax
+  80103b:	7f 08                	jg     801045 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80103d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801040:	5b                   	pop    %ebx
+  801041:	5e                   	pop    %esi
+  801042:	5f                   	pop    %edi
+  801043:	5d                   	pop    %ebp
+  801044:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801045:	83 ec 0c             	sub    $0xc,%esp
+  801048:	50                   	push   %eax
+  801049:	6a 13                	push   $0x13
+  80104b:	68 bf 2b 80 00       	push   $0x802bbf
+  801050:	6a 23                	push   $0x23
+  801052:	68 dc 2b 80 00       	push   $0x802bdc
+  801057:	e8 cf f1 ff ff       	call   80022b <_panic>
+
+0080105c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80105c:	55                   	push   %ebp
+  80105d:	89 e5                	mov    %esp,%ebp
+  80105f:	57                   	push   %edi
+  801060:	56                   	push   %esi
+  801061:	53                   	push   %ebx
+  801062:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801065:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801070:	b8 14 00 00 00       	mov    $0x14,%eax
+  801075:	89 df                	mov    %ebx,%edi
+  801077:	89 de                	mov    %ebx,%esi
+  801079:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107b:	85 c0                	test   %eax,%eax
+  80107d:	7f 08                	jg     801087 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80107f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801082:	5b                   	pop    %ebx
+  801083:	5e                   	pop    %esi
+  801084:	5f                   	pop    %edi
+  801085:	5d                   	pop    %ebp
+  801086:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801087:	83 ec 0c             	sub    $0xc,%esp
+  80108a:	50                   	push   %eax
+  80108b:	6a 14                	push   $0x14
+  80108d:	68 bf 2b 80 00       	push   $0x802bbf
+  801092:	6a 23                	push   $0x23
+  801094:	68 dc 2b 80 00       	push   $0x802bdc
+  801099:	e8 8d f1 ff ff       	call   80022b <_panic>
+
+0080109e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80109e:	55                   	push   %ebp
+  80109f:	89 e5                	mov    %esp,%ebp
+  8010a1:	57                   	push   %edi
+  8010a2:	56                   	push   %esi
+  8010a3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010aa:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010af:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ba:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010bc:	5b                   	pop    %ebx
+  8010bd:	5e                   	pop    %esi
+  8010be:	5f                   	pop    %edi
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	c3                   	ret
+
+008010c1 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+  8010c4:	57                   	push   %edi
+  8010c5:	56                   	push   %esi
+  8010c6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cd:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010da:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010dd:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010df:	5b                   	pop    %ebx
+  8010e0:	5e                   	pop    %esi
+  8010e1:	5f                   	pop    %edi
+  8010e2:	5d                   	pop    %ebp
+  8010e3:	c3                   	ret
+
+008010e4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010e4:	55                   	push   %ebp
+  8010e5:	89 e5                	mov    %esp,%ebp
+  8010e7:	57                   	push   %edi
+  8010e8:	56                   	push   %esi
+  8010e9:	53                   	push   %ebx
+  8010ea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010fa:	89 cb                	mov    %ecx,%ebx
+  8010fc:	89 cf                	mov    %ecx,%edi
+  8010fe:	89 ce                	mov    %ecx,%esi
+  801100:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801102:	85 c0                	test   %eax,%eax
+  801104:	7f 08                	jg     80110e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801109:	5b                   	pop    %ebx
+  80110a:	5e                   	pop    %esi
+  80110b:	5f                   	pop    %edi
+  80110c:	5d                   	pop    %ebp
+  80110d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110e:	83 ec 0c             	sub    $0xc,%esp
+  801111:	50                   	push   %eax
+  801112:	6a 19                	push   $0x19
+  801114:	68 bf 2b 80 00       	push   $0x802bbf
+  801119:	6a 23                	push   $0x23
+  80111b:	68 dc 2b 80 00       	push   $0x802bdc
+  801120:	e8 06 f1 ff ff       	call   80022b <_panic>
+
+00801125 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801130:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801135:	89 d1                	mov    %edx,%ecx
+  801137:	89 d3                	mov    %edx,%ebx
+  801139:	89 d7                	mov    %edx,%edi
+  80113b:	89 d6                	mov    %edx,%esi
+  80113d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80113f:	5b                   	pop    %ebx
+  801140:	5e                   	pop    %esi
+  801141:	5f                   	pop    %edi
+  801142:	5d                   	pop    %ebp
+  801143:	c3                   	ret
+
+00801144 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801144:	55                   	push   %ebp
+  801145:	89 e5                	mov    %esp,%ebp
+  801147:	57                   	push   %edi
+  801148:	56                   	push   %esi
+  801149:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80114a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801152:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801155:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80115a:	89 df                	mov    %ebx,%edi
+  80115c:	89 de                	mov    %ebx,%esi
+  80115e:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801160:	5b                   	pop    %ebx
+  801161:	5e                   	pop    %esi
+  801162:	5f                   	pop    %edi
+  801163:	5d                   	pop    %ebp
+  801164:	c3                   	ret
+
+00801165 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801165:	55                   	push   %ebp
+  801166:	89 e5                	mov    %esp,%ebp
+  801168:	57                   	push   %edi
+  801169:	56                   	push   %esi
+  80116a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80116b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801170:	8b 55 08             	mov    0x8(%ebp),%edx
+  801173:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801176:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80117b:	89 df                	mov    %ebx,%edi
+  80117d:	89 de                	mov    %ebx,%esi
+  80117f:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801181:	5b                   	pop    %ebx
+  801182:	5e                   	pop    %esi
+  801183:	5f                   	pop    %edi
+  801184:	5d                   	pop    %ebp
+  801185:	c3                   	ret
+
+00801186 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801189:	8b 45 08             	mov    0x8(%ebp),%eax
+  80118c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801191:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801194:	5d                   	pop    %ebp
+  801195:	c3                   	ret
+
+00801196 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801196:	55                   	push   %ebp
+  801197:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801199:	8b 45 08             	mov    0x8(%ebp),%eax
+  80119c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8011a1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011a6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8011ab:	5d                   	pop    %ebp
+  8011ac:	c3                   	ret
+
+008011ad <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011ad:	55                   	push   %ebp
+  8011ae:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8011b0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8011b5:	eb 02                	jmp    8011b9 <fd_alloc+0xc>
+  8011b7:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011b9:	89 c2                	mov    %eax,%edx
+  8011bb:	c1 ea 16             	shr    $0x16,%edx
+  8011be:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011c5:	f6 c2 01             	test   $0x1,%dl
+  8011c8:	74 2b                	je     8011f5 <fd_alloc+0x48>
+  8011ca:	89 c2                	mov    %eax,%edx
+  8011cc:	c1 ea 0c             	shr    $0xc,%edx
+  8011cf:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8011d6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011dc:	f6 c1 01             	test   $0x1,%cl
+  8011df:	74 14                	je     8011f5 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8011e1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011e7:	75 ce                	jne    8011b7 <fd_alloc+0xa>
+  8011e9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011ee:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011f3:	eb 05                	jmp    8011fa <fd_alloc+0x4d>
+			return 0;
+  8011f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fd:	89 02                	mov    %eax,(%edx)
+}
+  8011ff:	89 c8                	mov    %ecx,%eax
+  801201:	5d                   	pop    %ebp
+  801202:	c3                   	ret
+
+00801203 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801203:	55                   	push   %ebp
+  801204:	89 e5                	mov    %esp,%ebp
+  801206:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801209:	83 f8 1f             	cmp    $0x1f,%eax
+  80120c:	77 30                	ja     80123e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80120e:	c1 e0 0c             	shl    $0xc,%eax
+  801211:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801216:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80121c:	f6 c2 01             	test   $0x1,%dl
+  80121f:	74 24                	je     801245 <fd_lookup+0x42>
+  801221:	89 c2                	mov    %eax,%edx
+  801223:	c1 ea 0c             	shr    $0xc,%edx
+  801226:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80122d:	f6 c2 01             	test   $0x1,%dl
+  801230:	74 1a                	je     80124c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801232:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801235:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801237:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80123c:	5d                   	pop    %ebp
+  80123d:	c3                   	ret
+		return -E_INVAL;
+  80123e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801243:	eb f7                	jmp    80123c <fd_lookup+0x39>
+		return -E_INVAL;
+  801245:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80124a:	eb f0                	jmp    80123c <fd_lookup+0x39>
+  80124c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801251:	eb e9                	jmp    80123c <fd_lookup+0x39>
+
+00801253 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801253:	55                   	push   %ebp
+  801254:	89 e5                	mov    %esp,%ebp
+  801256:	53                   	push   %ebx
+  801257:	83 ec 04             	sub    $0x4,%esp
+  80125a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80125d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801262:	eb 03                	jmp    801267 <dev_lookup+0x14>
+  801264:	83 c0 01             	add    $0x1,%eax
+  801267:	8b 1c 85 68 2c 80 00 	mov    0x802c68(,%eax,4),%ebx
+  80126e:	85 db                	test   %ebx,%ebx
+  801270:	74 0b                	je     80127d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801272:	39 13                	cmp    %edx,(%ebx)
+  801274:	75 ee                	jne    801264 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801276:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127b:	eb 1f                	jmp    80129c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80127d:	a1 08 40 80 00       	mov    0x804008,%eax
+  801282:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801285:	83 ec 04             	sub    $0x4,%esp
+  801288:	52                   	push   %edx
+  801289:	50                   	push   %eax
+  80128a:	68 ec 2b 80 00       	push   $0x802bec
+  80128f:	e8 72 f0 ff ff       	call   800306 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801294:	83 c4 10             	add    $0x10,%esp
+  801297:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80129c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80129f:	89 1a                	mov    %ebx,(%edx)
+}
+  8012a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012a4:	c9                   	leave
+  8012a5:	c3                   	ret
+
+008012a6 <fd_close>:
+{
+  8012a6:	55                   	push   %ebp
+  8012a7:	89 e5                	mov    %esp,%ebp
+  8012a9:	57                   	push   %edi
+  8012aa:	56                   	push   %esi
+  8012ab:	53                   	push   %ebx
+  8012ac:	83 ec 24             	sub    $0x24,%esp
+  8012af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012b2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012b5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012b8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012b9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012bf:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012c2:	50                   	push   %eax
+  8012c3:	e8 3b ff ff ff       	call   801203 <fd_lookup>
+  8012c8:	89 c3                	mov    %eax,%ebx
+  8012ca:	83 c4 10             	add    $0x10,%esp
+  8012cd:	85 c0                	test   %eax,%eax
+  8012cf:	78 05                	js     8012d6 <fd_close+0x30>
+	    || fd != fd2)
+  8012d1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012d4:	74 16                	je     8012ec <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8012d6:	89 f8                	mov    %edi,%eax
+  8012d8:	84 c0                	test   %al,%al
+  8012da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012df:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012e2:	89 d8                	mov    %ebx,%eax
+  8012e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e7:	5b                   	pop    %ebx
+  8012e8:	5e                   	pop    %esi
+  8012e9:	5f                   	pop    %edi
+  8012ea:	5d                   	pop    %ebp
+  8012eb:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012ec:	83 ec 08             	sub    $0x8,%esp
+  8012ef:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012f2:	50                   	push   %eax
+  8012f3:	ff 36                	push   (%esi)
+  8012f5:	e8 59 ff ff ff       	call   801253 <dev_lookup>
+  8012fa:	89 c3                	mov    %eax,%ebx
+  8012fc:	83 c4 10             	add    $0x10,%esp
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	78 1a                	js     80131d <fd_close+0x77>
+		if (dev->dev_close)
+  801303:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801306:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801309:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80130e:	85 c0                	test   %eax,%eax
+  801310:	74 0b                	je     80131d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801312:	83 ec 0c             	sub    $0xc,%esp
+  801315:	56                   	push   %esi
+  801316:	ff d0                	call   *%eax
+  801318:	89 c3                	mov    %eax,%ebx
+  80131a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80131d:	83 ec 08             	sub    $0x8,%esp
+  801320:	56                   	push   %esi
+  801321:	6a 00                	push   $0x0
+  801323:	e8 01 fb ff ff       	call   800e29 <sys_page_unmap>
+	return r;
+  801328:	83 c4 10             	add    $0x10,%esp
+  80132b:	eb b5                	jmp    8012e2 <fd_close+0x3c>
+
+0080132d <close>:
+
+int
+close(int fdnum)
+{
+  80132d:	55                   	push   %ebp
+  80132e:	89 e5                	mov    %esp,%ebp
+  801330:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801333:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801336:	50                   	push   %eax
+  801337:	ff 75 08             	push   0x8(%ebp)
+  80133a:	e8 c4 fe ff ff       	call   801203 <fd_lookup>
+  80133f:	83 c4 10             	add    $0x10,%esp
+  801342:	85 c0                	test   %eax,%eax
+  801344:	79 02                	jns    801348 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801346:	c9                   	leave
+  801347:	c3                   	ret
+		return fd_close(fd, 1);
+  801348:	83 ec 08             	sub    $0x8,%esp
+  80134b:	6a 01                	push   $0x1
+  80134d:	ff 75 f4             	push   -0xc(%ebp)
+  801350:	e8 51 ff ff ff       	call   8012a6 <fd_close>
+  801355:	83 c4 10             	add    $0x10,%esp
+  801358:	eb ec                	jmp    801346 <close+0x19>
+
+0080135a <close_all>:
+
+void
+close_all(void)
+{
+  80135a:	55                   	push   %ebp
+  80135b:	89 e5                	mov    %esp,%ebp
+  80135d:	53                   	push   %ebx
+  80135e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801361:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801366:	83 ec 0c             	sub    $0xc,%esp
+  801369:	53                   	push   %ebx
+  80136a:	e8 be ff ff ff       	call   80132d <close>
+	for (i = 0; i < MAXFD; i++)
+  80136f:	83 c3 01             	add    $0x1,%ebx
+  801372:	83 c4 10             	add    $0x10,%esp
+  801375:	83 fb 20             	cmp    $0x20,%ebx
+  801378:	75 ec                	jne    801366 <close_all+0xc>
+}
+  80137a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80137d:	c9                   	leave
+  80137e:	c3                   	ret
+
+0080137f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80137f:	55                   	push   %ebp
+  801380:	89 e5                	mov    %esp,%ebp
+  801382:	57                   	push   %edi
+  801383:	56                   	push   %esi
+  801384:	53                   	push   %ebx
+  801385:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801388:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80138b:	50                   	push   %eax
+  80138c:	ff 75 08             	push   0x8(%ebp)
+  80138f:	e8 6f fe ff ff       	call   801203 <fd_lookup>
+  801394:	89 c3                	mov    %eax,%ebx
+  801396:	83 c4 10             	add    $0x10,%esp
+  801399:	85 c0                	test   %eax,%eax
+  80139b:	78 7f                	js     80141c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80139d:	83 ec 0c             	sub    $0xc,%esp
+  8013a0:	ff 75 0c             	push   0xc(%ebp)
+  8013a3:	e8 85 ff ff ff       	call   80132d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013ab:	c1 e6 0c             	shl    $0xc,%esi
+  8013ae:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013b7:	89 3c 24             	mov    %edi,(%esp)
+  8013ba:	e8 d7 fd ff ff       	call   801196 <fd2data>
+  8013bf:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8013c1:	89 34 24             	mov    %esi,(%esp)
+  8013c4:	e8 cd fd ff ff       	call   801196 <fd2data>
+  8013c9:	83 c4 10             	add    $0x10,%esp
+  8013cc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8013cf:	89 d8                	mov    %ebx,%eax
+  8013d1:	c1 e8 16             	shr    $0x16,%eax
+  8013d4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013db:	a8 01                	test   $0x1,%al
+  8013dd:	74 11                	je     8013f0 <dup+0x71>
+  8013df:	89 d8                	mov    %ebx,%eax
+  8013e1:	c1 e8 0c             	shr    $0xc,%eax
+  8013e4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013eb:	f6 c2 01             	test   $0x1,%dl
+  8013ee:	75 36                	jne    801426 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013f0:	89 f8                	mov    %edi,%eax
+  8013f2:	c1 e8 0c             	shr    $0xc,%eax
+  8013f5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013fc:	83 ec 0c             	sub    $0xc,%esp
+  8013ff:	25 07 0e 00 00       	and    $0xe07,%eax
+  801404:	50                   	push   %eax
+  801405:	56                   	push   %esi
+  801406:	6a 00                	push   $0x0
+  801408:	57                   	push   %edi
+  801409:	6a 00                	push   $0x0
+  80140b:	e8 d7 f9 ff ff       	call   800de7 <sys_page_map>
+  801410:	89 c3                	mov    %eax,%ebx
+  801412:	83 c4 20             	add    $0x20,%esp
+  801415:	85 c0                	test   %eax,%eax
+  801417:	78 33                	js     80144c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801419:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80141c:	89 d8                	mov    %ebx,%eax
+  80141e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801421:	5b                   	pop    %ebx
+  801422:	5e                   	pop    %esi
+  801423:	5f                   	pop    %edi
+  801424:	5d                   	pop    %ebp
+  801425:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801426:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80142d:	83 ec 0c             	sub    $0xc,%esp
+  801430:	25 07 0e 00 00       	and    $0xe07,%eax
+  801435:	50                   	push   %eax
+  801436:	ff 75 d4             	push   -0x2c(%ebp)
+  801439:	6a 00                	push   $0x0
+  80143b:	53                   	push   %ebx
+  80143c:	6a 00                	push   $0x0
+  80143e:	e8 a4 f9 ff ff       	call   800de7 <sys_page_map>
+  801443:	89 c3                	mov    %eax,%ebx
+  801445:	83 c4 20             	add    $0x20,%esp
+  801448:	85 c0                	test   %eax,%eax
+  80144a:	79 a4                	jns    8013f0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80144c:	83 ec 08             	sub    $0x8,%esp
+  80144f:	56                   	push   %esi
+  801450:	6a 00                	push   $0x0
+  801452:	e8 d2 f9 ff ff       	call   800e29 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801457:	83 c4 08             	add    $0x8,%esp
+  80145a:	ff 75 d4             	push   -0x2c(%ebp)
+  80145d:	6a 00                	push   $0x0
+  80145f:	e8 c5 f9 ff ff       	call   800e29 <sys_page_unmap>
+	return r;
+  801464:	83 c4 10             	add    $0x10,%esp
+  801467:	eb b3                	jmp    80141c <dup+0x9d>
+
+00801469 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801469:	55                   	push   %ebp
+  80146a:	89 e5                	mov    %esp,%ebp
+  80146c:	56                   	push   %esi
+  80146d:	53                   	push   %ebx
+  80146e:	83 ec 18             	sub    $0x18,%esp
+  801471:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801474:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801477:	50                   	push   %eax
+  801478:	56                   	push   %esi
+  801479:	e8 85 fd ff ff       	call   801203 <fd_lookup>
+  80147e:	83 c4 10             	add    $0x10,%esp
+  801481:	85 c0                	test   %eax,%eax
+  801483:	78 3c                	js     8014c1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801485:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801488:	83 ec 08             	sub    $0x8,%esp
+  80148b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80148e:	50                   	push   %eax
+  80148f:	ff 33                	push   (%ebx)
+  801491:	e8 bd fd ff ff       	call   801253 <dev_lookup>
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	85 c0                	test   %eax,%eax
+  80149b:	78 24                	js     8014c1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80149d:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014a0:	83 e0 03             	and    $0x3,%eax
+  8014a3:	83 f8 01             	cmp    $0x1,%eax
+  8014a6:	74 20                	je     8014c8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014ab:	8b 40 08             	mov    0x8(%eax),%eax
+  8014ae:	85 c0                	test   %eax,%eax
+  8014b0:	74 37                	je     8014e9 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014b2:	83 ec 04             	sub    $0x4,%esp
+  8014b5:	ff 75 10             	push   0x10(%ebp)
+  8014b8:	ff 75 0c             	push   0xc(%ebp)
+  8014bb:	53                   	push   %ebx
+  8014bc:	ff d0                	call   *%eax
+  8014be:	83 c4 10             	add    $0x10,%esp
+}
+  8014c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014c4:	5b                   	pop    %ebx
+  8014c5:	5e                   	pop    %esi
+  8014c6:	5d                   	pop    %ebp
+  8014c7:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014c8:	a1 08 40 80 00       	mov    0x804008,%eax
+  8014cd:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8014d0:	83 ec 04             	sub    $0x4,%esp
+  8014d3:	56                   	push   %esi
+  8014d4:	50                   	push   %eax
+  8014d5:	68 2d 2c 80 00       	push   $0x802c2d
+  8014da:	e8 27 ee ff ff       	call   800306 <cprintf>
+		return -E_INVAL;
+  8014df:	83 c4 10             	add    $0x10,%esp
+  8014e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e7:	eb d8                	jmp    8014c1 <read+0x58>
+		return -E_NOT_SUPP;
+  8014e9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014ee:	eb d1                	jmp    8014c1 <read+0x58>
+
+008014f0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014f0:	55                   	push   %ebp
+  8014f1:	89 e5                	mov    %esp,%ebp
+  8014f3:	57                   	push   %edi
+  8014f4:	56                   	push   %esi
+  8014f5:	53                   	push   %ebx
+  8014f6:	83 ec 0c             	sub    $0xc,%esp
+  8014f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014fc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801504:	eb 02                	jmp    801508 <readn+0x18>
+  801506:	01 c3                	add    %eax,%ebx
+  801508:	39 f3                	cmp    %esi,%ebx
+  80150a:	73 21                	jae    80152d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80150c:	83 ec 04             	sub    $0x4,%esp
+  80150f:	89 f0                	mov    %esi,%eax
+  801511:	29 d8                	sub    %ebx,%eax
+  801513:	50                   	push   %eax
+  801514:	89 d8                	mov    %ebx,%eax
+  801516:	03 45 0c             	add    0xc(%ebp),%eax
+  801519:	50                   	push   %eax
+  80151a:	57                   	push   %edi
+  80151b:	e8 49 ff ff ff       	call   801469 <read>
+		if (m < 0)
+  801520:	83 c4 10             	add    $0x10,%esp
+  801523:	85 c0                	test   %eax,%eax
+  801525:	78 04                	js     80152b <readn+0x3b>
+			return m;
+		if (m == 0)
+  801527:	75 dd                	jne    801506 <readn+0x16>
+  801529:	eb 02                	jmp    80152d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80152b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80152d:	89 d8                	mov    %ebx,%eax
+  80152f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801532:	5b                   	pop    %ebx
+  801533:	5e                   	pop    %esi
+  801534:	5f                   	pop    %edi
+  801535:	5d                   	pop    %ebp
+  801536:	c3                   	ret
+
+00801537 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801537:	55                   	push   %ebp
+  801538:	89 e5                	mov    %esp,%ebp
+  80153a:	56                   	push   %esi
+  80153b:	53                   	push   %ebx
+  80153c:	83 ec 18             	sub    $0x18,%esp
+  80153f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801542:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801545:	50                   	push   %eax
+  801546:	53                   	push   %ebx
+  801547:	e8 b7 fc ff ff       	call   801203 <fd_lookup>
+  80154c:	83 c4 10             	add    $0x10,%esp
+  80154f:	85 c0                	test   %eax,%eax
+  801551:	78 37                	js     80158a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801553:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801556:	83 ec 08             	sub    $0x8,%esp
+  801559:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80155c:	50                   	push   %eax
+  80155d:	ff 36                	push   (%esi)
+  80155f:	e8 ef fc ff ff       	call   801253 <dev_lookup>
+  801564:	83 c4 10             	add    $0x10,%esp
+  801567:	85 c0                	test   %eax,%eax
+  801569:	78 1f                	js     80158a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80156b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80156f:	74 20                	je     801591 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801571:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801574:	8b 40 0c             	mov    0xc(%eax),%eax
+  801577:	85 c0                	test   %eax,%eax
+  801579:	74 37                	je     8015b2 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80157b:	83 ec 04             	sub    $0x4,%esp
+  80157e:	ff 75 10             	push   0x10(%ebp)
+  801581:	ff 75 0c             	push   0xc(%ebp)
+  801584:	56                   	push   %esi
+  801585:	ff d0                	call   *%eax
+  801587:	83 c4 10             	add    $0x10,%esp
+}
+  80158a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80158d:	5b                   	pop    %ebx
+  80158e:	5e                   	pop    %esi
+  80158f:	5d                   	pop    %ebp
+  801590:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801591:	a1 08 40 80 00       	mov    0x804008,%eax
+  801596:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801599:	83 ec 04             	sub    $0x4,%esp
+  80159c:	53                   	push   %ebx
+  80159d:	50                   	push   %eax
+  80159e:	68 49 2c 80 00       	push   $0x802c49
+  8015a3:	e8 5e ed ff ff       	call   800306 <cprintf>
+		return -E_INVAL;
+  8015a8:	83 c4 10             	add    $0x10,%esp
+  8015ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b0:	eb d8                	jmp    80158a <write+0x53>
+		return -E_NOT_SUPP;
+  8015b2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015b7:	eb d1                	jmp    80158a <write+0x53>
+
+008015b9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015b9:	55                   	push   %ebp
+  8015ba:	89 e5                	mov    %esp,%ebp
+  8015bc:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015c2:	50                   	push   %eax
+  8015c3:	ff 75 08             	push   0x8(%ebp)
+  8015c6:	e8 38 fc ff ff       	call   801203 <fd_lookup>
+  8015cb:	83 c4 10             	add    $0x10,%esp
+  8015ce:	85 c0                	test   %eax,%eax
+  8015d0:	78 0e                	js     8015e0 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8015d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015d8:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8015db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015e0:	c9                   	leave
+  8015e1:	c3                   	ret
+
+008015e2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015e2:	55                   	push   %ebp
+  8015e3:	89 e5                	mov    %esp,%ebp
+  8015e5:	56                   	push   %esi
+  8015e6:	53                   	push   %ebx
+  8015e7:	83 ec 18             	sub    $0x18,%esp
+  8015ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015f0:	50                   	push   %eax
+  8015f1:	53                   	push   %ebx
+  8015f2:	e8 0c fc ff ff       	call   801203 <fd_lookup>
+  8015f7:	83 c4 10             	add    $0x10,%esp
+  8015fa:	85 c0                	test   %eax,%eax
+  8015fc:	78 34                	js     801632 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015fe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801601:	83 ec 08             	sub    $0x8,%esp
+  801604:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801607:	50                   	push   %eax
+  801608:	ff 36                	push   (%esi)
+  80160a:	e8 44 fc ff ff       	call   801253 <dev_lookup>
+  80160f:	83 c4 10             	add    $0x10,%esp
+  801612:	85 c0                	test   %eax,%eax
+  801614:	78 1c                	js     801632 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801616:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80161a:	74 1d                	je     801639 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80161c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80161f:	8b 40 18             	mov    0x18(%eax),%eax
+  801622:	85 c0                	test   %eax,%eax
+  801624:	74 34                	je     80165a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801626:	83 ec 08             	sub    $0x8,%esp
+  801629:	ff 75 0c             	push   0xc(%ebp)
+  80162c:	56                   	push   %esi
+  80162d:	ff d0                	call   *%eax
+  80162f:	83 c4 10             	add    $0x10,%esp
+}
+  801632:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801635:	5b                   	pop    %ebx
+  801636:	5e                   	pop    %esi
+  801637:	5d                   	pop    %ebp
+  801638:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801639:	a1 08 40 80 00       	mov    0x804008,%eax
+  80163e:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801641:	83 ec 04             	sub    $0x4,%esp
+  801644:	53                   	push   %ebx
+  801645:	50                   	push   %eax
+  801646:	68 0c 2c 80 00       	push   $0x802c0c
+  80164b:	e8 b6 ec ff ff       	call   800306 <cprintf>
+		return -E_INVAL;
+  801650:	83 c4 10             	add    $0x10,%esp
+  801653:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801658:	eb d8                	jmp    801632 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80165a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80165f:	eb d1                	jmp    801632 <ftruncate+0x50>
+
+00801661 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801661:	55                   	push   %ebp
+  801662:	89 e5                	mov    %esp,%ebp
+  801664:	56                   	push   %esi
+  801665:	53                   	push   %ebx
+  801666:	83 ec 18             	sub    $0x18,%esp
+  801669:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80166c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80166f:	50                   	push   %eax
+  801670:	ff 75 08             	push   0x8(%ebp)
+  801673:	e8 8b fb ff ff       	call   801203 <fd_lookup>
+  801678:	83 c4 10             	add    $0x10,%esp
+  80167b:	85 c0                	test   %eax,%eax
+  80167d:	78 49                	js     8016c8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80167f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801682:	83 ec 08             	sub    $0x8,%esp
+  801685:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801688:	50                   	push   %eax
+  801689:	ff 36                	push   (%esi)
+  80168b:	e8 c3 fb ff ff       	call   801253 <dev_lookup>
+  801690:	83 c4 10             	add    $0x10,%esp
+  801693:	85 c0                	test   %eax,%eax
+  801695:	78 31                	js     8016c8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801697:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80169a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80169e:	74 2f                	je     8016cf <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016a0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016a3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016aa:	00 00 00 
+	stat->st_isdir = 0;
+  8016ad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016b4:	00 00 00 
+	stat->st_dev = dev;
+  8016b7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8016bd:	83 ec 08             	sub    $0x8,%esp
+  8016c0:	53                   	push   %ebx
+  8016c1:	56                   	push   %esi
+  8016c2:	ff 50 14             	call   *0x14(%eax)
+  8016c5:	83 c4 10             	add    $0x10,%esp
+}
+  8016c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016cb:	5b                   	pop    %ebx
+  8016cc:	5e                   	pop    %esi
+  8016cd:	5d                   	pop    %ebp
+  8016ce:	c3                   	ret
+		return -E_NOT_SUPP;
+  8016cf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d4:	eb f2                	jmp    8016c8 <fstat+0x67>
+
+008016d6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016d6:	55                   	push   %ebp
+  8016d7:	89 e5                	mov    %esp,%ebp
+  8016d9:	56                   	push   %esi
+  8016da:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8016db:	83 ec 08             	sub    $0x8,%esp
+  8016de:	6a 00                	push   $0x0
+  8016e0:	ff 75 08             	push   0x8(%ebp)
+  8016e3:	e8 e4 01 00 00       	call   8018cc <open>
+  8016e8:	89 c3                	mov    %eax,%ebx
+  8016ea:	83 c4 10             	add    $0x10,%esp
+  8016ed:	85 c0                	test   %eax,%eax
+  8016ef:	78 1b                	js     80170c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8016f1:	83 ec 08             	sub    $0x8,%esp
+  8016f4:	ff 75 0c             	push   0xc(%ebp)
+  8016f7:	50                   	push   %eax
+  8016f8:	e8 64 ff ff ff       	call   801661 <fstat>
+  8016fd:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8016ff:	89 1c 24             	mov    %ebx,(%esp)
+  801702:	e8 26 fc ff ff       	call   80132d <close>
+	return r;
+  801707:	83 c4 10             	add    $0x10,%esp
+  80170a:	89 f3                	mov    %esi,%ebx
+}
+  80170c:	89 d8                	mov    %ebx,%eax
+  80170e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801711:	5b                   	pop    %ebx
+  801712:	5e                   	pop    %esi
+  801713:	5d                   	pop    %ebp
+  801714:	c3                   	ret
+
+00801715 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801715:	55                   	push   %ebp
+  801716:	89 e5                	mov    %esp,%ebp
+  801718:	56                   	push   %esi
+  801719:	53                   	push   %ebx
+  80171a:	89 c6                	mov    %eax,%esi
+  80171c:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80171e:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801725:	74 27                	je     80174e <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801727:	6a 07                	push   $0x7
+  801729:	68 00 50 80 00       	push   $0x805000
+  80172e:	56                   	push   %esi
+  80172f:	ff 35 00 40 80 00    	push   0x804000
+  801735:	e8 d5 0b 00 00       	call   80230f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80173a:	83 c4 0c             	add    $0xc,%esp
+  80173d:	6a 00                	push   $0x0
+  80173f:	53                   	push   %ebx
+  801740:	6a 00                	push   $0x0
+  801742:	e8 50 0b 00 00       	call   802297 <ipc_recv>
+}
+  801747:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80174a:	5b                   	pop    %ebx
+  80174b:	5e                   	pop    %esi
+  80174c:	5d                   	pop    %ebp
+  80174d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80174e:	83 ec 0c             	sub    $0xc,%esp
+  801751:	6a 01                	push   $0x1
+  801753:	e8 0b 0c 00 00       	call   802363 <ipc_find_env>
+  801758:	a3 00 40 80 00       	mov    %eax,0x804000
+  80175d:	83 c4 10             	add    $0x10,%esp
+  801760:	eb c5                	jmp    801727 <fsipc+0x12>
+
+00801762 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801762:	55                   	push   %ebp
+  801763:	89 e5                	mov    %esp,%ebp
+  801765:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801768:	8b 45 08             	mov    0x8(%ebp),%eax
+  80176b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80176e:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  801773:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801776:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80177b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801780:	b8 02 00 00 00       	mov    $0x2,%eax
+  801785:	e8 8b ff ff ff       	call   801715 <fsipc>
+}
+  80178a:	c9                   	leave
+  80178b:	c3                   	ret
+
+0080178c <devfile_flush>:
+{
+  80178c:	55                   	push   %ebp
+  80178d:	89 e5                	mov    %esp,%ebp
+  80178f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801792:	8b 45 08             	mov    0x8(%ebp),%eax
+  801795:	8b 40 0c             	mov    0xc(%eax),%eax
+  801798:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80179d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017a7:	e8 69 ff ff ff       	call   801715 <fsipc>
+}
+  8017ac:	c9                   	leave
+  8017ad:	c3                   	ret
+
+008017ae <devfile_stat>:
+{
+  8017ae:	55                   	push   %ebp
+  8017af:	89 e5                	mov    %esp,%ebp
+  8017b1:	53                   	push   %ebx
+  8017b2:	83 ec 04             	sub    $0x4,%esp
+  8017b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8017b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017bb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017be:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8017c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8017cd:	e8 43 ff ff ff       	call   801715 <fsipc>
+  8017d2:	85 c0                	test   %eax,%eax
+  8017d4:	78 2c                	js     801802 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8017d6:	83 ec 08             	sub    $0x8,%esp
+  8017d9:	68 00 50 80 00       	push   $0x805000
+  8017de:	53                   	push   %ebx
+  8017df:	e8 10 f1 ff ff       	call   8008f4 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8017e4:	a1 80 50 80 00       	mov    0x805080,%eax
+  8017e9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8017ef:	a1 84 50 80 00       	mov    0x805084,%eax
+  8017f4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8017fa:	83 c4 10             	add    $0x10,%esp
+  8017fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801802:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801805:	c9                   	leave
+  801806:	c3                   	ret
+
+00801807 <devfile_write>:
+{
+  801807:	55                   	push   %ebp
+  801808:	89 e5                	mov    %esp,%ebp
+  80180a:	83 ec 0c             	sub    $0xc,%esp
+  80180d:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801810:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801815:	39 d0                	cmp    %edx,%eax
+  801817:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80181a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181d:	8b 52 0c             	mov    0xc(%edx),%edx
+  801820:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801826:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80182b:	50                   	push   %eax
+  80182c:	ff 75 0c             	push   0xc(%ebp)
+  80182f:	68 08 50 80 00       	push   $0x805008
+  801834:	e8 41 f2 ff ff       	call   800a7a <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801839:	ba 00 00 00 00       	mov    $0x0,%edx
+  80183e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801843:	e8 cd fe ff ff       	call   801715 <fsipc>
+}
+  801848:	c9                   	leave
+  801849:	c3                   	ret
+
+0080184a <devfile_read>:
+{
+  80184a:	55                   	push   %ebp
+  80184b:	89 e5                	mov    %esp,%ebp
+  80184d:	56                   	push   %esi
+  80184e:	53                   	push   %ebx
+  80184f:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801852:	8b 45 08             	mov    0x8(%ebp),%eax
+  801855:	8b 40 0c             	mov    0xc(%eax),%eax
+  801858:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  80185d:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801863:	ba 00 00 00 00       	mov    $0x0,%edx
+  801868:	b8 03 00 00 00       	mov    $0x3,%eax
+  80186d:	e8 a3 fe ff ff       	call   801715 <fsipc>
+  801872:	89 c3                	mov    %eax,%ebx
+  801874:	85 c0                	test   %eax,%eax
+  801876:	78 1f                	js     801897 <devfile_read+0x4d>
+	assert(r <= n);
+  801878:	39 c6                	cmp    %eax,%esi
+  80187a:	72 24                	jb     8018a0 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80187c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801881:	7f 33                	jg     8018b6 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801883:	83 ec 04             	sub    $0x4,%esp
+  801886:	50                   	push   %eax
+  801887:	68 00 50 80 00       	push   $0x805000
+  80188c:	ff 75 0c             	push   0xc(%ebp)
+  80188f:	e8 e6 f1 ff ff       	call   800a7a <memmove>
+	return r;
+  801894:	83 c4 10             	add    $0x10,%esp
+}
+  801897:	89 d8                	mov    %ebx,%eax
+  801899:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80189c:	5b                   	pop    %ebx
+  80189d:	5e                   	pop    %esi
+  80189e:	5d                   	pop    %ebp
+  80189f:	c3                   	ret
+	assert(r <= n);
+  8018a0:	68 7c 2c 80 00       	push   $0x802c7c
+  8018a5:	68 83 2c 80 00       	push   $0x802c83
+  8018aa:	6a 7c                	push   $0x7c
+  8018ac:	68 98 2c 80 00       	push   $0x802c98
+  8018b1:	e8 75 e9 ff ff       	call   80022b <_panic>
+	assert(r <= PGSIZE);
+  8018b6:	68 a3 2c 80 00       	push   $0x802ca3
+  8018bb:	68 83 2c 80 00       	push   $0x802c83
+  8018c0:	6a 7d                	push   $0x7d
+  8018c2:	68 98 2c 80 00       	push   $0x802c98
+  8018c7:	e8 5f e9 ff ff       	call   80022b <_panic>
+
+008018cc <open>:
+{
+  8018cc:	55                   	push   %ebp
+  8018cd:	89 e5                	mov    %esp,%ebp
+  8018cf:	56                   	push   %esi
+  8018d0:	53                   	push   %ebx
+  8018d1:	83 ec 1c             	sub    $0x1c,%esp
+  8018d4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8018d7:	56                   	push   %esi
+  8018d8:	e8 dc ef ff ff       	call   8008b9 <strlen>
+  8018dd:	83 c4 10             	add    $0x10,%esp
+  8018e0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8018e5:	7f 6c                	jg     801953 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8018e7:	83 ec 0c             	sub    $0xc,%esp
+  8018ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018ed:	50                   	push   %eax
+  8018ee:	e8 ba f8 ff ff       	call   8011ad <fd_alloc>
+  8018f3:	89 c3                	mov    %eax,%ebx
+  8018f5:	83 c4 10             	add    $0x10,%esp
+  8018f8:	85 c0                	test   %eax,%eax
+  8018fa:	78 3c                	js     801938 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8018fc:	83 ec 08             	sub    $0x8,%esp
+  8018ff:	56                   	push   %esi
+  801900:	68 00 50 80 00       	push   $0x805000
+  801905:	e8 ea ef ff ff       	call   8008f4 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80190a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80190d:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801912:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801915:	b8 01 00 00 00       	mov    $0x1,%eax
+  80191a:	e8 f6 fd ff ff       	call   801715 <fsipc>
+  80191f:	89 c3                	mov    %eax,%ebx
+  801921:	83 c4 10             	add    $0x10,%esp
+  801924:	85 c0                	test   %eax,%eax
+  801926:	78 19                	js     801941 <open+0x75>
+	return fd2num(fd);
+  801928:	83 ec 0c             	sub    $0xc,%esp
+  80192b:	ff 75 f4             	push   -0xc(%ebp)
+  80192e:	e8 53 f8 ff ff       	call   801186 <fd2num>
+  801933:	89 c3                	mov    %eax,%ebx
+  801935:	83 c4 10             	add    $0x10,%esp
+}
+  801938:	89 d8                	mov    %ebx,%eax
+  80193a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80193d:	5b                   	pop    %ebx
+  80193e:	5e                   	pop    %esi
+  80193f:	5d                   	pop    %ebp
+  801940:	c3                   	ret
+		fd_close(fd, 0);
+  801941:	83 ec 08             	sub    $0x8,%esp
+  801944:	6a 00                	push   $0x0
+  801946:	ff 75 f4             	push   -0xc(%ebp)
+  801949:	e8 58 f9 ff ff       	call   8012a6 <fd_close>
+		return r;
+  80194e:	83 c4 10             	add    $0x10,%esp
+  801951:	eb e5                	jmp    801938 <open+0x6c>
+		return -E_BAD_PATH;
+  801953:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801958:	eb de                	jmp    801938 <open+0x6c>
+
+0080195a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80195a:	55                   	push   %ebp
+  80195b:	89 e5                	mov    %esp,%ebp
+  80195d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801960:	ba 00 00 00 00       	mov    $0x0,%edx
+  801965:	b8 08 00 00 00       	mov    $0x8,%eax
+  80196a:	e8 a6 fd ff ff       	call   801715 <fsipc>
+}
+  80196f:	c9                   	leave
+  801970:	c3                   	ret
+
+00801971 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801971:	55                   	push   %ebp
+  801972:	89 e5                	mov    %esp,%ebp
+  801974:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801977:	68 af 2c 80 00       	push   $0x802caf
+  80197c:	ff 75 0c             	push   0xc(%ebp)
+  80197f:	e8 70 ef ff ff       	call   8008f4 <strcpy>
+	return 0;
+}
+  801984:	b8 00 00 00 00       	mov    $0x0,%eax
+  801989:	c9                   	leave
+  80198a:	c3                   	ret
+
+0080198b <devsock_close>:
+{
+  80198b:	55                   	push   %ebp
+  80198c:	89 e5                	mov    %esp,%ebp
+  80198e:	53                   	push   %ebx
+  80198f:	83 ec 10             	sub    $0x10,%esp
+  801992:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801995:	53                   	push   %ebx
+  801996:	e8 d8 09 00 00       	call   802373 <pageref>
+  80199b:	89 c2                	mov    %eax,%edx
+  80199d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8019a0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8019a5:	83 fa 01             	cmp    $0x1,%edx
+  8019a8:	74 05                	je     8019af <devsock_close+0x24>
+}
+  8019aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ad:	c9                   	leave
+  8019ae:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8019af:	83 ec 0c             	sub    $0xc,%esp
+  8019b2:	ff 73 0c             	push   0xc(%ebx)
+  8019b5:	e8 b7 02 00 00       	call   801c71 <nsipc_close>
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	eb eb                	jmp    8019aa <devsock_close+0x1f>
+
+008019bf <devsock_write>:
+{
+  8019bf:	55                   	push   %ebp
+  8019c0:	89 e5                	mov    %esp,%ebp
+  8019c2:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8019c5:	6a 00                	push   $0x0
+  8019c7:	ff 75 10             	push   0x10(%ebp)
+  8019ca:	ff 75 0c             	push   0xc(%ebp)
+  8019cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d0:	ff 70 0c             	push   0xc(%eax)
+  8019d3:	e8 79 03 00 00       	call   801d51 <nsipc_send>
+}
+  8019d8:	c9                   	leave
+  8019d9:	c3                   	ret
+
+008019da <devsock_read>:
+{
+  8019da:	55                   	push   %ebp
+  8019db:	89 e5                	mov    %esp,%ebp
+  8019dd:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8019e0:	6a 00                	push   $0x0
+  8019e2:	ff 75 10             	push   0x10(%ebp)
+  8019e5:	ff 75 0c             	push   0xc(%ebp)
+  8019e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019eb:	ff 70 0c             	push   0xc(%eax)
+  8019ee:	e8 ef 02 00 00       	call   801ce2 <nsipc_recv>
+}
+  8019f3:	c9                   	leave
+  8019f4:	c3                   	ret
+
+008019f5 <fd2sockid>:
+{
+  8019f5:	55                   	push   %ebp
+  8019f6:	89 e5                	mov    %esp,%ebp
+  8019f8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8019fb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8019fe:	52                   	push   %edx
+  8019ff:	50                   	push   %eax
+  801a00:	e8 fe f7 ff ff       	call   801203 <fd_lookup>
+  801a05:	83 c4 10             	add    $0x10,%esp
+  801a08:	85 c0                	test   %eax,%eax
+  801a0a:	78 10                	js     801a1c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801a0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a0f:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801a15:	39 08                	cmp    %ecx,(%eax)
+  801a17:	75 05                	jne    801a1e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801a19:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801a1c:	c9                   	leave
+  801a1d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a1e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a23:	eb f7                	jmp    801a1c <fd2sockid+0x27>
+
+00801a25 <alloc_sockfd>:
+{
+  801a25:	55                   	push   %ebp
+  801a26:	89 e5                	mov    %esp,%ebp
+  801a28:	56                   	push   %esi
+  801a29:	53                   	push   %ebx
+  801a2a:	83 ec 1c             	sub    $0x1c,%esp
+  801a2d:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801a2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a32:	50                   	push   %eax
+  801a33:	e8 75 f7 ff ff       	call   8011ad <fd_alloc>
+  801a38:	89 c3                	mov    %eax,%ebx
+  801a3a:	83 c4 10             	add    $0x10,%esp
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	78 43                	js     801a84 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801a41:	83 ec 04             	sub    $0x4,%esp
+  801a44:	68 07 04 00 00       	push   $0x407
+  801a49:	ff 75 f4             	push   -0xc(%ebp)
+  801a4c:	6a 00                	push   $0x0
+  801a4e:	e8 0e f3 ff ff       	call   800d61 <sys_page_alloc>
+  801a53:	89 c3                	mov    %eax,%ebx
+  801a55:	83 c4 10             	add    $0x10,%esp
+  801a58:	85 c0                	test   %eax,%eax
+  801a5a:	78 28                	js     801a84 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801a5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a5f:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801a65:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801a67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a6a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801a71:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801a74:	83 ec 0c             	sub    $0xc,%esp
+  801a77:	50                   	push   %eax
+  801a78:	e8 09 f7 ff ff       	call   801186 <fd2num>
+  801a7d:	89 c3                	mov    %eax,%ebx
+  801a7f:	83 c4 10             	add    $0x10,%esp
+  801a82:	eb 0c                	jmp    801a90 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801a84:	83 ec 0c             	sub    $0xc,%esp
+  801a87:	56                   	push   %esi
+  801a88:	e8 e4 01 00 00       	call   801c71 <nsipc_close>
+		return r;
+  801a8d:	83 c4 10             	add    $0x10,%esp
+}
+  801a90:	89 d8                	mov    %ebx,%eax
+  801a92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a95:	5b                   	pop    %ebx
+  801a96:	5e                   	pop    %esi
+  801a97:	5d                   	pop    %ebp
+  801a98:	c3                   	ret
+
+00801a99 <accept>:
+{
+  801a99:	55                   	push   %ebp
+  801a9a:	89 e5                	mov    %esp,%ebp
+  801a9c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aa2:	e8 4e ff ff ff       	call   8019f5 <fd2sockid>
+  801aa7:	85 c0                	test   %eax,%eax
+  801aa9:	78 1b                	js     801ac6 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801aab:	83 ec 04             	sub    $0x4,%esp
+  801aae:	ff 75 10             	push   0x10(%ebp)
+  801ab1:	ff 75 0c             	push   0xc(%ebp)
+  801ab4:	50                   	push   %eax
+  801ab5:	e8 0e 01 00 00       	call   801bc8 <nsipc_accept>
+  801aba:	83 c4 10             	add    $0x10,%esp
+  801abd:	85 c0                	test   %eax,%eax
+  801abf:	78 05                	js     801ac6 <accept+0x2d>
+	return alloc_sockfd(r);
+  801ac1:	e8 5f ff ff ff       	call   801a25 <alloc_sockfd>
+}
+  801ac6:	c9                   	leave
+  801ac7:	c3                   	ret
+
+00801ac8 <bind>:
+{
+  801ac8:	55                   	push   %ebp
+  801ac9:	89 e5                	mov    %esp,%ebp
+  801acb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ace:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad1:	e8 1f ff ff ff       	call   8019f5 <fd2sockid>
+  801ad6:	85 c0                	test   %eax,%eax
+  801ad8:	78 12                	js     801aec <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801ada:	83 ec 04             	sub    $0x4,%esp
+  801add:	ff 75 10             	push   0x10(%ebp)
+  801ae0:	ff 75 0c             	push   0xc(%ebp)
+  801ae3:	50                   	push   %eax
+  801ae4:	e8 31 01 00 00       	call   801c1a <nsipc_bind>
+  801ae9:	83 c4 10             	add    $0x10,%esp
+}
+  801aec:	c9                   	leave
+  801aed:	c3                   	ret
+
+00801aee <shutdown>:
+{
+  801aee:	55                   	push   %ebp
+  801aef:	89 e5                	mov    %esp,%ebp
+  801af1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801af4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af7:	e8 f9 fe ff ff       	call   8019f5 <fd2sockid>
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	78 0f                	js     801b0f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801b00:	83 ec 08             	sub    $0x8,%esp
+  801b03:	ff 75 0c             	push   0xc(%ebp)
+  801b06:	50                   	push   %eax
+  801b07:	e8 43 01 00 00       	call   801c4f <nsipc_shutdown>
+  801b0c:	83 c4 10             	add    $0x10,%esp
+}
+  801b0f:	c9                   	leave
+  801b10:	c3                   	ret
+
+00801b11 <connect>:
+{
+  801b11:	55                   	push   %ebp
+  801b12:	89 e5                	mov    %esp,%ebp
+  801b14:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b17:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b1a:	e8 d6 fe ff ff       	call   8019f5 <fd2sockid>
+  801b1f:	85 c0                	test   %eax,%eax
+  801b21:	78 12                	js     801b35 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801b23:	83 ec 04             	sub    $0x4,%esp
+  801b26:	ff 75 10             	push   0x10(%ebp)
+  801b29:	ff 75 0c             	push   0xc(%ebp)
+  801b2c:	50                   	push   %eax
+  801b2d:	e8 59 01 00 00       	call   801c8b <nsipc_connect>
+  801b32:	83 c4 10             	add    $0x10,%esp
+}
+  801b35:	c9                   	leave
+  801b36:	c3                   	ret
+
+00801b37 <listen>:
+{
+  801b37:	55                   	push   %ebp
+  801b38:	89 e5                	mov    %esp,%ebp
+  801b3a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b40:	e8 b0 fe ff ff       	call   8019f5 <fd2sockid>
+  801b45:	85 c0                	test   %eax,%eax
+  801b47:	78 0f                	js     801b58 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801b49:	83 ec 08             	sub    $0x8,%esp
+  801b4c:	ff 75 0c             	push   0xc(%ebp)
+  801b4f:	50                   	push   %eax
+  801b50:	e8 6b 01 00 00       	call   801cc0 <nsipc_listen>
+  801b55:	83 c4 10             	add    $0x10,%esp
+}
+  801b58:	c9                   	leave
+  801b59:	c3                   	ret
+
+00801b5a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801b5a:	55                   	push   %ebp
+  801b5b:	89 e5                	mov    %esp,%ebp
+  801b5d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801b60:	ff 75 10             	push   0x10(%ebp)
+  801b63:	ff 75 0c             	push   0xc(%ebp)
+  801b66:	ff 75 08             	push   0x8(%ebp)
+  801b69:	e8 41 02 00 00       	call   801daf <nsipc_socket>
+  801b6e:	83 c4 10             	add    $0x10,%esp
+  801b71:	85 c0                	test   %eax,%eax
+  801b73:	78 05                	js     801b7a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801b75:	e8 ab fe ff ff       	call   801a25 <alloc_sockfd>
+}
+  801b7a:	c9                   	leave
+  801b7b:	c3                   	ret
+
+00801b7c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801b7c:	55                   	push   %ebp
+  801b7d:	89 e5                	mov    %esp,%ebp
+  801b7f:	53                   	push   %ebx
+  801b80:	83 ec 04             	sub    $0x4,%esp
+  801b83:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801b85:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b8c:	74 26                	je     801bb4 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801b8e:	6a 07                	push   $0x7
+  801b90:	68 00 60 80 00       	push   $0x806000
+  801b95:	53                   	push   %ebx
+  801b96:	ff 35 04 40 80 00    	push   0x804004
+  801b9c:	e8 6e 07 00 00       	call   80230f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801ba1:	83 c4 0c             	add    $0xc,%esp
+  801ba4:	6a 00                	push   $0x0
+  801ba6:	6a 00                	push   $0x0
+  801ba8:	6a 00                	push   $0x0
+  801baa:	e8 e8 06 00 00       	call   802297 <ipc_recv>
+}
+  801baf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bb2:	c9                   	leave
+  801bb3:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801bb4:	83 ec 0c             	sub    $0xc,%esp
+  801bb7:	6a 02                	push   $0x2
+  801bb9:	e8 a5 07 00 00       	call   802363 <ipc_find_env>
+  801bbe:	a3 04 40 80 00       	mov    %eax,0x804004
+  801bc3:	83 c4 10             	add    $0x10,%esp
+  801bc6:	eb c6                	jmp    801b8e <nsipc+0x12>
+
+00801bc8 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801bc8:	55                   	push   %ebp
+  801bc9:	89 e5                	mov    %esp,%ebp
+  801bcb:	56                   	push   %esi
+  801bcc:	53                   	push   %ebx
+  801bcd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801bd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd3:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801bd8:	8b 06                	mov    (%esi),%eax
+  801bda:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801bdf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801be4:	e8 93 ff ff ff       	call   801b7c <nsipc>
+  801be9:	89 c3                	mov    %eax,%ebx
+  801beb:	85 c0                	test   %eax,%eax
+  801bed:	79 09                	jns    801bf8 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801bef:	89 d8                	mov    %ebx,%eax
+  801bf1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf4:	5b                   	pop    %ebx
+  801bf5:	5e                   	pop    %esi
+  801bf6:	5d                   	pop    %ebp
+  801bf7:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801bf8:	83 ec 04             	sub    $0x4,%esp
+  801bfb:	ff 35 10 60 80 00    	push   0x806010
+  801c01:	68 00 60 80 00       	push   $0x806000
+  801c06:	ff 75 0c             	push   0xc(%ebp)
+  801c09:	e8 6c ee ff ff       	call   800a7a <memmove>
+		*addrlen = ret->ret_addrlen;
+  801c0e:	a1 10 60 80 00       	mov    0x806010,%eax
+  801c13:	89 06                	mov    %eax,(%esi)
+  801c15:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801c18:	eb d5                	jmp    801bef <nsipc_accept+0x27>
+
+00801c1a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801c1a:	55                   	push   %ebp
+  801c1b:	89 e5                	mov    %esp,%ebp
+  801c1d:	53                   	push   %ebx
+  801c1e:	83 ec 08             	sub    $0x8,%esp
+  801c21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801c24:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c27:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801c2c:	53                   	push   %ebx
+  801c2d:	ff 75 0c             	push   0xc(%ebp)
+  801c30:	68 04 60 80 00       	push   $0x806004
+  801c35:	e8 40 ee ff ff       	call   800a7a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801c3a:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801c40:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c45:	e8 32 ff ff ff       	call   801b7c <nsipc>
+}
+  801c4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+
+00801c4f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801c4f:	55                   	push   %ebp
+  801c50:	89 e5                	mov    %esp,%ebp
+  801c52:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801c55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c58:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801c5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c60:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801c65:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c6a:	e8 0d ff ff ff       	call   801b7c <nsipc>
+}
+  801c6f:	c9                   	leave
+  801c70:	c3                   	ret
+
+00801c71 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801c71:	55                   	push   %ebp
+  801c72:	89 e5                	mov    %esp,%ebp
+  801c74:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801c77:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7a:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801c7f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c84:	e8 f3 fe ff ff       	call   801b7c <nsipc>
+}
+  801c89:	c9                   	leave
+  801c8a:	c3                   	ret
+
+00801c8b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801c8b:	55                   	push   %ebp
+  801c8c:	89 e5                	mov    %esp,%ebp
+  801c8e:	53                   	push   %ebx
+  801c8f:	83 ec 08             	sub    $0x8,%esp
+  801c92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801c95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c98:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801c9d:	53                   	push   %ebx
+  801c9e:	ff 75 0c             	push   0xc(%ebp)
+  801ca1:	68 04 60 80 00       	push   $0x806004
+  801ca6:	e8 cf ed ff ff       	call   800a7a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801cab:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801cb1:	b8 05 00 00 00       	mov    $0x5,%eax
+  801cb6:	e8 c1 fe ff ff       	call   801b7c <nsipc>
+}
+  801cbb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cbe:	c9                   	leave
+  801cbf:	c3                   	ret
+
+00801cc0 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801cc0:	55                   	push   %ebp
+  801cc1:	89 e5                	mov    %esp,%ebp
+  801cc3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cc9:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801cce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cd1:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801cd6:	b8 06 00 00 00       	mov    $0x6,%eax
+  801cdb:	e8 9c fe ff ff       	call   801b7c <nsipc>
+}
+  801ce0:	c9                   	leave
+  801ce1:	c3                   	ret
+
+00801ce2 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801ce2:	55                   	push   %ebp
+  801ce3:	89 e5                	mov    %esp,%ebp
+  801ce5:	56                   	push   %esi
+  801ce6:	53                   	push   %ebx
+  801ce7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801cea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ced:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801cf2:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801cf8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cfb:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801d00:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d05:	e8 72 fe ff ff       	call   801b7c <nsipc>
+  801d0a:	89 c3                	mov    %eax,%ebx
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	78 22                	js     801d32 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801d10:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801d15:	39 c6                	cmp    %eax,%esi
+  801d17:	0f 4e c6             	cmovle %esi,%eax
+  801d1a:	39 c3                	cmp    %eax,%ebx
+  801d1c:	7f 1d                	jg     801d3b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801d1e:	83 ec 04             	sub    $0x4,%esp
+  801d21:	53                   	push   %ebx
+  801d22:	68 00 60 80 00       	push   $0x806000
+  801d27:	ff 75 0c             	push   0xc(%ebp)
+  801d2a:	e8 4b ed ff ff       	call   800a7a <memmove>
+  801d2f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801d32:	89 d8                	mov    %ebx,%eax
+  801d34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d37:	5b                   	pop    %ebx
+  801d38:	5e                   	pop    %esi
+  801d39:	5d                   	pop    %ebp
+  801d3a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801d3b:	68 bb 2c 80 00       	push   $0x802cbb
+  801d40:	68 83 2c 80 00       	push   $0x802c83
+  801d45:	6a 62                	push   $0x62
+  801d47:	68 d0 2c 80 00       	push   $0x802cd0
+  801d4c:	e8 da e4 ff ff       	call   80022b <_panic>
+
+00801d51 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801d51:	55                   	push   %ebp
+  801d52:	89 e5                	mov    %esp,%ebp
+  801d54:	53                   	push   %ebx
+  801d55:	83 ec 04             	sub    $0x4,%esp
+  801d58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801d5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d5e:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801d63:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801d69:	7f 2e                	jg     801d99 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801d6b:	83 ec 04             	sub    $0x4,%esp
+  801d6e:	53                   	push   %ebx
+  801d6f:	ff 75 0c             	push   0xc(%ebp)
+  801d72:	68 0c 60 80 00       	push   $0x80600c
+  801d77:	e8 fe ec ff ff       	call   800a7a <memmove>
+	nsipcbuf.send.req_size = size;
+  801d7c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801d82:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d85:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801d8a:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d8f:	e8 e8 fd ff ff       	call   801b7c <nsipc>
+}
+  801d94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d97:	c9                   	leave
+  801d98:	c3                   	ret
+	assert(size < 1600);
+  801d99:	68 dc 2c 80 00       	push   $0x802cdc
+  801d9e:	68 83 2c 80 00       	push   $0x802c83
+  801da3:	6a 6d                	push   $0x6d
+  801da5:	68 d0 2c 80 00       	push   $0x802cd0
+  801daa:	e8 7c e4 ff ff       	call   80022b <_panic>
+
+00801daf <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801daf:	55                   	push   %ebp
+  801db0:	89 e5                	mov    %esp,%ebp
+  801db2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801db5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db8:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801dbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dc0:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801dc5:	8b 45 10             	mov    0x10(%ebp),%eax
+  801dc8:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801dcd:	b8 09 00 00 00       	mov    $0x9,%eax
+  801dd2:	e8 a5 fd ff ff       	call   801b7c <nsipc>
+}
+  801dd7:	c9                   	leave
+  801dd8:	c3                   	ret
+
+00801dd9 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801dd9:	55                   	push   %ebp
+  801dda:	89 e5                	mov    %esp,%ebp
+  801ddc:	56                   	push   %esi
+  801ddd:	53                   	push   %ebx
+  801dde:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801de1:	83 ec 0c             	sub    $0xc,%esp
+  801de4:	ff 75 08             	push   0x8(%ebp)
+  801de7:	e8 aa f3 ff ff       	call   801196 <fd2data>
+  801dec:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801dee:	83 c4 08             	add    $0x8,%esp
+  801df1:	68 e8 2c 80 00       	push   $0x802ce8
+  801df6:	53                   	push   %ebx
+  801df7:	e8 f8 ea ff ff       	call   8008f4 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801dfc:	8b 46 04             	mov    0x4(%esi),%eax
+  801dff:	2b 06                	sub    (%esi),%eax
+  801e01:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801e07:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e0e:	00 00 00 
+	stat->st_dev = &devpipe;
+  801e11:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801e18:	30 80 00 
+	return 0;
+}
+  801e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e23:	5b                   	pop    %ebx
+  801e24:	5e                   	pop    %esi
+  801e25:	5d                   	pop    %ebp
+  801e26:	c3                   	ret
+
+00801e27 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801e27:	55                   	push   %ebp
+  801e28:	89 e5                	mov    %esp,%ebp
+  801e2a:	53                   	push   %ebx
+  801e2b:	83 ec 0c             	sub    $0xc,%esp
+  801e2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801e31:	53                   	push   %ebx
+  801e32:	6a 00                	push   $0x0
+  801e34:	e8 f0 ef ff ff       	call   800e29 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801e39:	89 1c 24             	mov    %ebx,(%esp)
+  801e3c:	e8 55 f3 ff ff       	call   801196 <fd2data>
+  801e41:	83 c4 08             	add    $0x8,%esp
+  801e44:	50                   	push   %eax
+  801e45:	6a 00                	push   $0x0
+  801e47:	e8 dd ef ff ff       	call   800e29 <sys_page_unmap>
+}
+  801e4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e4f:	c9                   	leave
+  801e50:	c3                   	ret
+
+00801e51 <_pipeisclosed>:
+{
+  801e51:	55                   	push   %ebp
+  801e52:	89 e5                	mov    %esp,%ebp
+  801e54:	57                   	push   %edi
+  801e55:	56                   	push   %esi
+  801e56:	53                   	push   %ebx
+  801e57:	83 ec 1c             	sub    $0x1c,%esp
+  801e5a:	89 c7                	mov    %eax,%edi
+  801e5c:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801e5e:	a1 08 40 80 00       	mov    0x804008,%eax
+  801e63:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801e66:	83 ec 0c             	sub    $0xc,%esp
+  801e69:	57                   	push   %edi
+  801e6a:	e8 04 05 00 00       	call   802373 <pageref>
+  801e6f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e72:	89 34 24             	mov    %esi,(%esp)
+  801e75:	e8 f9 04 00 00       	call   802373 <pageref>
+		nn = thisenv->env_runs;
+  801e7a:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801e80:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801e83:	83 c4 10             	add    $0x10,%esp
+  801e86:	39 cb                	cmp    %ecx,%ebx
+  801e88:	74 1b                	je     801ea5 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801e8a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e8d:	75 cf                	jne    801e5e <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801e8f:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801e92:	6a 01                	push   $0x1
+  801e94:	50                   	push   %eax
+  801e95:	53                   	push   %ebx
+  801e96:	68 ef 2c 80 00       	push   $0x802cef
+  801e9b:	e8 66 e4 ff ff       	call   800306 <cprintf>
+  801ea0:	83 c4 10             	add    $0x10,%esp
+  801ea3:	eb b9                	jmp    801e5e <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801ea5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ea8:	0f 94 c0             	sete   %al
+  801eab:	0f b6 c0             	movzbl %al,%eax
+}
+  801eae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb1:	5b                   	pop    %ebx
+  801eb2:	5e                   	pop    %esi
+  801eb3:	5f                   	pop    %edi
+  801eb4:	5d                   	pop    %ebp
+  801eb5:	c3                   	ret
+
+00801eb6 <devpipe_write>:
+{
+  801eb6:	55                   	push   %ebp
+  801eb7:	89 e5                	mov    %esp,%ebp
+  801eb9:	57                   	push   %edi
+  801eba:	56                   	push   %esi
+  801ebb:	53                   	push   %ebx
+  801ebc:	83 ec 28             	sub    $0x28,%esp
+  801ebf:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801ec2:	56                   	push   %esi
+  801ec3:	e8 ce f2 ff ff       	call   801196 <fd2data>
+  801ec8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801eca:	83 c4 10             	add    $0x10,%esp
+  801ecd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ed2:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801ed5:	75 09                	jne    801ee0 <devpipe_write+0x2a>
+	return i;
+  801ed7:	89 f8                	mov    %edi,%eax
+  801ed9:	eb 23                	jmp    801efe <devpipe_write+0x48>
+			sys_yield();
+  801edb:	e8 01 ee ff ff       	call   800ce1 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801ee0:	8b 43 04             	mov    0x4(%ebx),%eax
+  801ee3:	8b 0b                	mov    (%ebx),%ecx
+  801ee5:	8d 51 20             	lea    0x20(%ecx),%edx
+  801ee8:	39 d0                	cmp    %edx,%eax
+  801eea:	72 1a                	jb     801f06 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801eec:	89 da                	mov    %ebx,%edx
+  801eee:	89 f0                	mov    %esi,%eax
+  801ef0:	e8 5c ff ff ff       	call   801e51 <_pipeisclosed>
+  801ef5:	85 c0                	test   %eax,%eax
+  801ef7:	74 e2                	je     801edb <devpipe_write+0x25>
+				return 0;
+  801ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801efe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f01:	5b                   	pop    %ebx
+  801f02:	5e                   	pop    %esi
+  801f03:	5f                   	pop    %edi
+  801f04:	5d                   	pop    %ebp
+  801f05:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801f06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f09:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801f0d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801f10:	89 c2                	mov    %eax,%edx
+  801f12:	c1 fa 1f             	sar    $0x1f,%edx
+  801f15:	89 d1                	mov    %edx,%ecx
+  801f17:	c1 e9 1b             	shr    $0x1b,%ecx
+  801f1a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801f1d:	83 e2 1f             	and    $0x1f,%edx
+  801f20:	29 ca                	sub    %ecx,%edx
+  801f22:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801f26:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801f2a:	83 c0 01             	add    $0x1,%eax
+  801f2d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801f30:	83 c7 01             	add    $0x1,%edi
+  801f33:	eb 9d                	jmp    801ed2 <devpipe_write+0x1c>
+
+00801f35 <devpipe_read>:
+{
+  801f35:	55                   	push   %ebp
+  801f36:	89 e5                	mov    %esp,%ebp
+  801f38:	57                   	push   %edi
+  801f39:	56                   	push   %esi
+  801f3a:	53                   	push   %ebx
+  801f3b:	83 ec 18             	sub    $0x18,%esp
+  801f3e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801f41:	57                   	push   %edi
+  801f42:	e8 4f f2 ff ff       	call   801196 <fd2data>
+  801f47:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801f49:	83 c4 10             	add    $0x10,%esp
+  801f4c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f51:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f54:	75 13                	jne    801f69 <devpipe_read+0x34>
+	return i;
+  801f56:	89 f0                	mov    %esi,%eax
+  801f58:	eb 02                	jmp    801f5c <devpipe_read+0x27>
+				return i;
+  801f5a:	89 f0                	mov    %esi,%eax
+}
+  801f5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f5f:	5b                   	pop    %ebx
+  801f60:	5e                   	pop    %esi
+  801f61:	5f                   	pop    %edi
+  801f62:	5d                   	pop    %ebp
+  801f63:	c3                   	ret
+			sys_yield();
+  801f64:	e8 78 ed ff ff       	call   800ce1 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801f69:	8b 03                	mov    (%ebx),%eax
+  801f6b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801f6e:	75 18                	jne    801f88 <devpipe_read+0x53>
+			if (i > 0)
+  801f70:	85 f6                	test   %esi,%esi
+  801f72:	75 e6                	jne    801f5a <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801f74:	89 da                	mov    %ebx,%edx
+  801f76:	89 f8                	mov    %edi,%eax
+  801f78:	e8 d4 fe ff ff       	call   801e51 <_pipeisclosed>
+  801f7d:	85 c0                	test   %eax,%eax
+  801f7f:	74 e3                	je     801f64 <devpipe_read+0x2f>
+				return 0;
+  801f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f86:	eb d4                	jmp    801f5c <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801f88:	99                   	cltd
+  801f89:	c1 ea 1b             	shr    $0x1b,%edx
+  801f8c:	01 d0                	add    %edx,%eax
+  801f8e:	83 e0 1f             	and    $0x1f,%eax
+  801f91:	29 d0                	sub    %edx,%eax
+  801f93:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801f98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f9b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801f9e:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801fa1:	83 c6 01             	add    $0x1,%esi
+  801fa4:	eb ab                	jmp    801f51 <devpipe_read+0x1c>
+
+00801fa6 <pipe>:
+{
+  801fa6:	55                   	push   %ebp
+  801fa7:	89 e5                	mov    %esp,%ebp
+  801fa9:	56                   	push   %esi
+  801faa:	53                   	push   %ebx
+  801fab:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801fae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fb1:	50                   	push   %eax
+  801fb2:	e8 f6 f1 ff ff       	call   8011ad <fd_alloc>
+  801fb7:	89 c3                	mov    %eax,%ebx
+  801fb9:	83 c4 10             	add    $0x10,%esp
+  801fbc:	85 c0                	test   %eax,%eax
+  801fbe:	0f 88 23 01 00 00    	js     8020e7 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fc4:	83 ec 04             	sub    $0x4,%esp
+  801fc7:	68 07 04 00 00       	push   $0x407
+  801fcc:	ff 75 f4             	push   -0xc(%ebp)
+  801fcf:	6a 00                	push   $0x0
+  801fd1:	e8 8b ed ff ff       	call   800d61 <sys_page_alloc>
+  801fd6:	89 c3                	mov    %eax,%ebx
+  801fd8:	83 c4 10             	add    $0x10,%esp
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	0f 88 04 01 00 00    	js     8020e7 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801fe3:	83 ec 0c             	sub    $0xc,%esp
+  801fe6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fe9:	50                   	push   %eax
+  801fea:	e8 be f1 ff ff       	call   8011ad <fd_alloc>
+  801fef:	89 c3                	mov    %eax,%ebx
+  801ff1:	83 c4 10             	add    $0x10,%esp
+  801ff4:	85 c0                	test   %eax,%eax
+  801ff6:	0f 88 db 00 00 00    	js     8020d7 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ffc:	83 ec 04             	sub    $0x4,%esp
+  801fff:	68 07 04 00 00       	push   $0x407
+  802004:	ff 75 f0             	push   -0x10(%ebp)
+  802007:	6a 00                	push   $0x0
+  802009:	e8 53 ed ff ff       	call   800d61 <sys_page_alloc>
+  80200e:	89 c3                	mov    %eax,%ebx
+  802010:	83 c4 10             	add    $0x10,%esp
+  802013:	85 c0                	test   %eax,%eax
+  802015:	0f 88 bc 00 00 00    	js     8020d7 <pipe+0x131>
+	va = fd2data(fd0);
+  80201b:	83 ec 0c             	sub    $0xc,%esp
+  80201e:	ff 75 f4             	push   -0xc(%ebp)
+  802021:	e8 70 f1 ff ff       	call   801196 <fd2data>
+  802026:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802028:	83 c4 0c             	add    $0xc,%esp
+  80202b:	68 07 04 00 00       	push   $0x407
+  802030:	50                   	push   %eax
+  802031:	6a 00                	push   $0x0
+  802033:	e8 29 ed ff ff       	call   800d61 <sys_page_alloc>
+  802038:	89 c3                	mov    %eax,%ebx
+  80203a:	83 c4 10             	add    $0x10,%esp
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	0f 88 82 00 00 00    	js     8020c7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802045:	83 ec 0c             	sub    $0xc,%esp
+  802048:	ff 75 f0             	push   -0x10(%ebp)
+  80204b:	e8 46 f1 ff ff       	call   801196 <fd2data>
+  802050:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802057:	50                   	push   %eax
+  802058:	6a 00                	push   $0x0
+  80205a:	56                   	push   %esi
+  80205b:	6a 00                	push   $0x0
+  80205d:	e8 85 ed ff ff       	call   800de7 <sys_page_map>
+  802062:	89 c3                	mov    %eax,%ebx
+  802064:	83 c4 20             	add    $0x20,%esp
+  802067:	85 c0                	test   %eax,%eax
+  802069:	78 4e                	js     8020b9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80206b:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  802070:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802073:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802075:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802078:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80207f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802082:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802084:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802087:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80208e:	83 ec 0c             	sub    $0xc,%esp
+  802091:	ff 75 f4             	push   -0xc(%ebp)
+  802094:	e8 ed f0 ff ff       	call   801186 <fd2num>
+  802099:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80209c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80209e:	83 c4 04             	add    $0x4,%esp
+  8020a1:	ff 75 f0             	push   -0x10(%ebp)
+  8020a4:	e8 dd f0 ff ff       	call   801186 <fd2num>
+  8020a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020ac:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8020af:	83 c4 10             	add    $0x10,%esp
+  8020b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020b7:	eb 2e                	jmp    8020e7 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8020b9:	83 ec 08             	sub    $0x8,%esp
+  8020bc:	56                   	push   %esi
+  8020bd:	6a 00                	push   $0x0
+  8020bf:	e8 65 ed ff ff       	call   800e29 <sys_page_unmap>
+  8020c4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8020c7:	83 ec 08             	sub    $0x8,%esp
+  8020ca:	ff 75 f0             	push   -0x10(%ebp)
+  8020cd:	6a 00                	push   $0x0
+  8020cf:	e8 55 ed ff ff       	call   800e29 <sys_page_unmap>
+  8020d4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8020d7:	83 ec 08             	sub    $0x8,%esp
+  8020da:	ff 75 f4             	push   -0xc(%ebp)
+  8020dd:	6a 00                	push   $0x0
+  8020df:	e8 45 ed ff ff       	call   800e29 <sys_page_unmap>
+  8020e4:	83 c4 10             	add    $0x10,%esp
+}
+  8020e7:	89 d8                	mov    %ebx,%eax
+  8020e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020ec:	5b                   	pop    %ebx
+  8020ed:	5e                   	pop    %esi
+  8020ee:	5d                   	pop    %ebp
+  8020ef:	c3                   	ret
+
+008020f0 <pipeisclosed>:
+{
+  8020f0:	55                   	push   %ebp
+  8020f1:	89 e5                	mov    %esp,%ebp
+  8020f3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020f9:	50                   	push   %eax
+  8020fa:	ff 75 08             	push   0x8(%ebp)
+  8020fd:	e8 01 f1 ff ff       	call   801203 <fd_lookup>
+  802102:	83 c4 10             	add    $0x10,%esp
+  802105:	85 c0                	test   %eax,%eax
+  802107:	78 18                	js     802121 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802109:	83 ec 0c             	sub    $0xc,%esp
+  80210c:	ff 75 f4             	push   -0xc(%ebp)
+  80210f:	e8 82 f0 ff ff       	call   801196 <fd2data>
+  802114:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802116:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802119:	e8 33 fd ff ff       	call   801e51 <_pipeisclosed>
+  80211e:	83 c4 10             	add    $0x10,%esp
+}
+  802121:	c9                   	leave
+  802122:	c3                   	ret
+
+00802123 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802123:	b8 00 00 00 00       	mov    $0x0,%eax
+  802128:	c3                   	ret
+
+00802129 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802129:	55                   	push   %ebp
+  80212a:	89 e5                	mov    %esp,%ebp
+  80212c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80212f:	68 07 2d 80 00       	push   $0x802d07
+  802134:	ff 75 0c             	push   0xc(%ebp)
+  802137:	e8 b8 e7 ff ff       	call   8008f4 <strcpy>
+	return 0;
+}
+  80213c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802141:	c9                   	leave
+  802142:	c3                   	ret
+
+00802143 <devcons_write>:
+{
+  802143:	55                   	push   %ebp
+  802144:	89 e5                	mov    %esp,%ebp
+  802146:	57                   	push   %edi
+  802147:	56                   	push   %esi
+  802148:	53                   	push   %ebx
+  802149:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80214f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802154:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80215a:	eb 2e                	jmp    80218a <devcons_write+0x47>
+		m = n - tot;
+  80215c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80215f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802161:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802166:	39 c3                	cmp    %eax,%ebx
+  802168:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80216b:	83 ec 04             	sub    $0x4,%esp
+  80216e:	53                   	push   %ebx
+  80216f:	89 f0                	mov    %esi,%eax
+  802171:	03 45 0c             	add    0xc(%ebp),%eax
+  802174:	50                   	push   %eax
+  802175:	57                   	push   %edi
+  802176:	e8 ff e8 ff ff       	call   800a7a <memmove>
+		sys_cputs(buf, m);
+  80217b:	83 c4 08             	add    $0x8,%esp
+  80217e:	53                   	push   %ebx
+  80217f:	57                   	push   %edi
+  802180:	e8 9f ea ff ff       	call   800c24 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802185:	01 de                	add    %ebx,%esi
+  802187:	83 c4 10             	add    $0x10,%esp
+  80218a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80218d:	72 cd                	jb     80215c <devcons_write+0x19>
+}
+  80218f:	89 f0                	mov    %esi,%eax
+  802191:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802194:	5b                   	pop    %ebx
+  802195:	5e                   	pop    %esi
+  802196:	5f                   	pop    %edi
+  802197:	5d                   	pop    %ebp
+  802198:	c3                   	ret
+
+00802199 <devcons_read>:
+{
+  802199:	55                   	push   %ebp
+  80219a:	89 e5                	mov    %esp,%ebp
+  80219c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80219f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8021a8:	75 07                	jne    8021b1 <devcons_read+0x18>
+  8021aa:	eb 1f                	jmp    8021cb <devcons_read+0x32>
+		sys_yield();
+  8021ac:	e8 30 eb ff ff       	call   800ce1 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8021b1:	e8 8c ea ff ff       	call   800c42 <sys_cgetc>
+  8021b6:	85 c0                	test   %eax,%eax
+  8021b8:	74 f2                	je     8021ac <devcons_read+0x13>
+	if (c < 0)
+  8021ba:	78 0f                	js     8021cb <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8021bc:	83 f8 04             	cmp    $0x4,%eax
+  8021bf:	74 0c                	je     8021cd <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8021c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021c4:	88 02                	mov    %al,(%edx)
+	return 1;
+  8021c6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8021cb:	c9                   	leave
+  8021cc:	c3                   	ret
+		return 0;
+  8021cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d2:	eb f7                	jmp    8021cb <devcons_read+0x32>
+
+008021d4 <cputchar>:
+{
+  8021d4:	55                   	push   %ebp
+  8021d5:	89 e5                	mov    %esp,%ebp
+  8021d7:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8021da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021dd:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8021e0:	6a 01                	push   $0x1
+  8021e2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8021e5:	50                   	push   %eax
+  8021e6:	e8 39 ea ff ff       	call   800c24 <sys_cputs>
+}
+  8021eb:	83 c4 10             	add    $0x10,%esp
+  8021ee:	c9                   	leave
+  8021ef:	c3                   	ret
+
+008021f0 <getchar>:
+{
+  8021f0:	55                   	push   %ebp
+  8021f1:	89 e5                	mov    %esp,%ebp
+  8021f3:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8021f6:	6a 01                	push   $0x1
+  8021f8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8021fb:	50                   	push   %eax
+  8021fc:	6a 00                	push   $0x0
+  8021fe:	e8 66 f2 ff ff       	call   801469 <read>
+	if (r < 0)
+  802203:	83 c4 10             	add    $0x10,%esp
+  802206:	85 c0                	test   %eax,%eax
+  802208:	78 06                	js     802210 <getchar+0x20>
+	if (r < 1)
+  80220a:	74 06                	je     802212 <getchar+0x22>
+	return c;
+  80220c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802210:	c9                   	leave
+  802211:	c3                   	ret
+		return -E_EOF;
+  802212:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802217:	eb f7                	jmp    802210 <getchar+0x20>
+
+00802219 <iscons>:
+{
+  802219:	55                   	push   %ebp
+  80221a:	89 e5                	mov    %esp,%ebp
+  80221c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80221f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802222:	50                   	push   %eax
+  802223:	ff 75 08             	push   0x8(%ebp)
+  802226:	e8 d8 ef ff ff       	call   801203 <fd_lookup>
+  80222b:	83 c4 10             	add    $0x10,%esp
+  80222e:	85 c0                	test   %eax,%eax
+  802230:	78 11                	js     802243 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802232:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802235:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80223b:	39 10                	cmp    %edx,(%eax)
+  80223d:	0f 94 c0             	sete   %al
+  802240:	0f b6 c0             	movzbl %al,%eax
+}
+  802243:	c9                   	leave
+  802244:	c3                   	ret
+
+00802245 <opencons>:
+{
+  802245:	55                   	push   %ebp
+  802246:	89 e5                	mov    %esp,%ebp
+  802248:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80224b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80224e:	50                   	push   %eax
+  80224f:	e8 59 ef ff ff       	call   8011ad <fd_alloc>
+  802254:	83 c4 10             	add    $0x10,%esp
+  802257:	85 c0                	test   %eax,%eax
+  802259:	78 3a                	js     802295 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80225b:	83 ec 04             	sub    $0x4,%esp
+  80225e:	68 07 04 00 00       	push   $0x407
+  802263:	ff 75 f4             	push   -0xc(%ebp)
+  802266:	6a 00                	push   $0x0
+  802268:	e8 f4 ea ff ff       	call   800d61 <sys_page_alloc>
+  80226d:	83 c4 10             	add    $0x10,%esp
+  802270:	85 c0                	test   %eax,%eax
+  802272:	78 21                	js     802295 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802274:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802277:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80227d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80227f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802282:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802289:	83 ec 0c             	sub    $0xc,%esp
+  80228c:	50                   	push   %eax
+  80228d:	e8 f4 ee ff ff       	call   801186 <fd2num>
+  802292:	83 c4 10             	add    $0x10,%esp
+}
+  802295:	c9                   	leave
+  802296:	c3                   	ret
+
+00802297 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802297:	55                   	push   %ebp
+  802298:	89 e5                	mov    %esp,%ebp
+  80229a:	57                   	push   %edi
+  80229b:	56                   	push   %esi
+  80229c:	53                   	push   %ebx
+  80229d:	83 ec 18             	sub    $0x18,%esp
+  8022a0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8022a6:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8022a9:	85 db                	test   %ebx,%ebx
+  8022ab:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8022b0:	0f 45 c3             	cmovne %ebx,%eax
+  8022b3:	50                   	push   %eax
+  8022b4:	e8 2b ee ff ff       	call   8010e4 <sys_ipc_recv>
+
+	if (from_env_store)
+  8022b9:	83 c4 10             	add    $0x10,%esp
+  8022bc:	85 ff                	test   %edi,%edi
+  8022be:	74 17                	je     8022d7 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8022c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c5:	85 c0                	test   %eax,%eax
+  8022c7:	75 0c                	jne    8022d5 <ipc_recv+0x3e>
+  8022c9:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  8022cf:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8022d5:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8022d7:	85 f6                	test   %esi,%esi
+  8022d9:	74 2e                	je     802309 <ipc_recv+0x72>
+		if (!r && pg)
+  8022db:	85 c0                	test   %eax,%eax
+  8022dd:	75 24                	jne    802303 <ipc_recv+0x6c>
+  8022df:	85 db                	test   %ebx,%ebx
+  8022e1:	74 20                	je     802303 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8022e3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022e8:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8022ee:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8022f0:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022f5:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  8022fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022fe:	5b                   	pop    %ebx
+  8022ff:	5e                   	pop    %esi
+  802300:	5f                   	pop    %edi
+  802301:	5d                   	pop    %ebp
+  802302:	c3                   	ret
+			*perm_store = 0;
+  802303:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802309:	85 c0                	test   %eax,%eax
+  80230b:	75 ee                	jne    8022fb <ipc_recv+0x64>
+  80230d:	eb e1                	jmp    8022f0 <ipc_recv+0x59>
+
+0080230f <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80230f:	55                   	push   %ebp
+  802310:	89 e5                	mov    %esp,%ebp
+  802312:	57                   	push   %edi
+  802313:	56                   	push   %esi
+  802314:	53                   	push   %ebx
+  802315:	83 ec 0c             	sub    $0xc,%esp
+  802318:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80231b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80231e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802321:	85 db                	test   %ebx,%ebx
+  802323:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802328:	0f 44 d8             	cmove  %eax,%ebx
+  80232b:	ff 75 14             	push   0x14(%ebp)
+  80232e:	53                   	push   %ebx
+  80232f:	56                   	push   %esi
+  802330:	57                   	push   %edi
+  802331:	e8 8b ed ff ff       	call   8010c1 <sys_ipc_try_send_yield>
+  802336:	83 c4 10             	add    $0x10,%esp
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	79 1e                	jns    80235b <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80233d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802340:	75 07                	jne    802349 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802342:	e8 9a e9 ff ff       	call   800ce1 <sys_yield>
+  802347:	eb e2                	jmp    80232b <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802349:	50                   	push   %eax
+  80234a:	68 13 2d 80 00       	push   $0x802d13
+  80234f:	6a 3d                	push   $0x3d
+  802351:	68 28 2d 80 00       	push   $0x802d28
+  802356:	e8 d0 de ff ff       	call   80022b <_panic>
+	}
+}
+  80235b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80235e:	5b                   	pop    %ebx
+  80235f:	5e                   	pop    %esi
+  802360:	5f                   	pop    %edi
+  802361:	5d                   	pop    %ebp
+  802362:	c3                   	ret
+
+00802363 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802363:	55                   	push   %ebp
+  802364:	89 e5                	mov    %esp,%ebp
+  802366:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802369:	ff 75 08             	push   0x8(%ebp)
+  80236c:	e8 f0 e8 ff ff       	call   800c61 <sys_env_find>
+}
+  802371:	c9                   	leave
+  802372:	c3                   	ret
+
+00802373 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802373:	55                   	push   %ebp
+  802374:	89 e5                	mov    %esp,%ebp
+  802376:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802379:	89 c2                	mov    %eax,%edx
+  80237b:	c1 ea 16             	shr    $0x16,%edx
+  80237e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802385:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80238a:	f6 c1 01             	test   $0x1,%cl
+  80238d:	74 22                	je     8023b1 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80238f:	c1 e8 0c             	shr    $0xc,%eax
+  802392:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802399:	a8 01                	test   $0x1,%al
+  80239b:	74 14                	je     8023b1 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80239d:	c1 e8 0c             	shr    $0xc,%eax
+  8023a0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8023a3:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8023aa:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8023ae:	0f b7 d2             	movzwl %dx,%edx
+}
+  8023b1:	89 d0                	mov    %edx,%eax
+  8023b3:	5d                   	pop    %ebp
+  8023b4:	c3                   	ret
+  8023b5:	66 90                	xchg   %ax,%ax
+  8023b7:	66 90                	xchg   %ax,%ax
+  8023b9:	66 90                	xchg   %ax,%ax
+  8023bb:	66 90                	xchg   %ax,%ax
+  8023bd:	66 90                	xchg   %ax,%ax
+  8023bf:	90                   	nop
+
+008023c0 <__udivmoddi4>:
+  8023c0:	55                   	push   %ebp
+  8023c1:	57                   	push   %edi
+  8023c2:	56                   	push   %esi
+  8023c3:	53                   	push   %ebx
+  8023c4:	83 ec 14             	sub    $0x14,%esp
+  8023c7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8023cb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8023cf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8023d3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8023d7:	89 f1                	mov    %esi,%ecx
+  8023d9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8023dd:	09 d9                	or     %ebx,%ecx
+  8023df:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8023e3:	0f 84 92 00 00 00    	je     80247b <__udivmoddi4+0xbb>
+  8023e9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8023f0:	00 
+  8023f1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8023f6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8023fd:	00 
+  8023fe:	89 1c 24             	mov    %ebx,(%esp)
+  802401:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802405:	8d 76 00             	lea    0x0(%esi),%esi
+  802408:	89 e9                	mov    %ebp,%ecx
+  80240a:	89 c3                	mov    %eax,%ebx
+  80240c:	89 d6                	mov    %edx,%esi
+  80240e:	31 ff                	xor    %edi,%edi
+  802410:	d3 ee                	shr    %cl,%esi
+  802412:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802415:	f6 c1 20             	test   $0x20,%cl
+  802418:	0f 45 de             	cmovne %esi,%ebx
+  80241b:	0f 45 f7             	cmovne %edi,%esi
+  80241e:	8b 3c 24             	mov    (%esp),%edi
+  802421:	39 fb                	cmp    %edi,%ebx
+  802423:	89 f7                	mov    %esi,%edi
+  802425:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802429:	8b 1c 24             	mov    (%esp),%ebx
+  80242c:	19 f7                	sbb    %esi,%edi
+  80242e:	72 39                	jb     802469 <__udivmoddi4+0xa9>
+  802430:	89 e9                	mov    %ebp,%ecx
+  802432:	89 f7                	mov    %esi,%edi
+  802434:	89 de                	mov    %ebx,%esi
+  802436:	0f a5 df             	shld   %cl,%ebx,%edi
+  802439:	d3 e6                	shl    %cl,%esi
+  80243b:	31 db                	xor    %ebx,%ebx
+  80243d:	f6 c1 20             	test   $0x20,%cl
+  802440:	0f 45 fe             	cmovne %esi,%edi
+  802443:	0f 45 f3             	cmovne %ebx,%esi
+  802446:	29 f0                	sub    %esi,%eax
+  802448:	be 01 00 00 00       	mov    $0x1,%esi
+  80244d:	19 fa                	sbb    %edi,%edx
+  80244f:	31 ff                	xor    %edi,%edi
+  802451:	31 db                	xor    %ebx,%ebx
+  802453:	0f a5 f7             	shld   %cl,%esi,%edi
+  802456:	d3 e6                	shl    %cl,%esi
+  802458:	f6 c1 20             	test   $0x20,%cl
+  80245b:	0f 45 fe             	cmovne %esi,%edi
+  80245e:	0f 45 f3             	cmovne %ebx,%esi
+  802461:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802465:	09 74 24 08          	or     %esi,0x8(%esp)
+  802469:	83 ed 01             	sub    $0x1,%ebp
+  80246c:	73 9a                	jae    802408 <__udivmoddi4+0x48>
+  80246e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802472:	85 ff                	test   %edi,%edi
+  802474:	74 05                	je     80247b <__udivmoddi4+0xbb>
+  802476:	89 07                	mov    %eax,(%edi)
+  802478:	89 57 04             	mov    %edx,0x4(%edi)
+  80247b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80247f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802483:	83 c4 14             	add    $0x14,%esp
+  802486:	5b                   	pop    %ebx
+  802487:	5e                   	pop    %esi
+  802488:	5f                   	pop    %edi
+  802489:	5d                   	pop    %ebp
+  80248a:	c3                   	ret
+  80248b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80248f:	90                   	nop
+
+00802490 <__udivdi3>:
+  802490:	55                   	push   %ebp
+  802491:	57                   	push   %edi
+  802492:	56                   	push   %esi
+  802493:	53                   	push   %ebx
+  802494:	83 ec 14             	sub    $0x14,%esp
+  802497:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80249b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80249f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8024a3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8024a7:	89 fb                	mov    %edi,%ebx
+  8024a9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8024ad:	09 f3                	or     %esi,%ebx
+  8024af:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8024b3:	0f 84 85 00 00 00    	je     80253e <__udivdi3+0xae>
+  8024b9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024c0:	00 
+  8024c1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8024c6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024cd:	00 
+  8024ce:	89 34 24             	mov    %esi,(%esp)
+  8024d1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8024d5:	8d 76 00             	lea    0x0(%esi),%esi
+  8024d8:	89 e9                	mov    %ebp,%ecx
+  8024da:	89 c3                	mov    %eax,%ebx
+  8024dc:	89 d6                	mov    %edx,%esi
+  8024de:	31 ff                	xor    %edi,%edi
+  8024e0:	d3 ee                	shr    %cl,%esi
+  8024e2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024e5:	f6 c1 20             	test   $0x20,%cl
+  8024e8:	0f 45 de             	cmovne %esi,%ebx
+  8024eb:	0f 45 f7             	cmovne %edi,%esi
+  8024ee:	8b 3c 24             	mov    (%esp),%edi
+  8024f1:	39 fb                	cmp    %edi,%ebx
+  8024f3:	89 f7                	mov    %esi,%edi
+  8024f5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8024f9:	8b 1c 24             	mov    (%esp),%ebx
+  8024fc:	19 f7                	sbb    %esi,%edi
+  8024fe:	72 39                	jb     802539 <__udivdi3+0xa9>
+  802500:	89 e9                	mov    %ebp,%ecx
+  802502:	89 f7                	mov    %esi,%edi
+  802504:	89 de                	mov    %ebx,%esi
+  802506:	0f a5 df             	shld   %cl,%ebx,%edi
+  802509:	d3 e6                	shl    %cl,%esi
+  80250b:	31 db                	xor    %ebx,%ebx
+  80250d:	f6 c1 20             	test   $0x20,%cl
+  802510:	0f 45 fe             	cmovne %esi,%edi
+  802513:	0f 45 f3             	cmovne %ebx,%esi
+  802516:	29 f0                	sub    %esi,%eax
+  802518:	be 01 00 00 00       	mov    $0x1,%esi
+  80251d:	19 fa                	sbb    %edi,%edx
+  80251f:	31 ff                	xor    %edi,%edi
+  802521:	31 db                	xor    %ebx,%ebx
+  802523:	0f a5 f7             	shld   %cl,%esi,%edi
+  802526:	d3 e6                	shl    %cl,%esi
+  802528:	f6 c1 20             	test   $0x20,%cl
+  80252b:	0f 45 fe             	cmovne %esi,%edi
+  80252e:	0f 45 f3             	cmovne %ebx,%esi
+  802531:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802535:	09 74 24 08          	or     %esi,0x8(%esp)
+  802539:	83 ed 01             	sub    $0x1,%ebp
+  80253c:	73 9a                	jae    8024d8 <__udivdi3+0x48>
+  80253e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802542:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802546:	83 c4 14             	add    $0x14,%esp
+  802549:	5b                   	pop    %ebx
+  80254a:	5e                   	pop    %esi
+  80254b:	5f                   	pop    %edi
+  80254c:	5d                   	pop    %ebp
+  80254d:	c3                   	ret
+  80254e:	66 90                	xchg   %ax,%ax
+
+00802550 <__umoddi3>:
+  802550:	57                   	push   %edi
+  802551:	56                   	push   %esi
+  802552:	53                   	push   %ebx
+  802553:	83 ec 08             	sub    $0x8,%esp
+  802556:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80255a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80255e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802562:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802566:	89 f9                	mov    %edi,%ecx
+  802568:	89 34 24             	mov    %esi,(%esp)
+  80256b:	09 f1                	or     %esi,%ecx
+  80256d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802571:	74 53                	je     8025c6 <__umoddi3+0x76>
+  802573:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80257f:	90                   	nop
+  802580:	89 c6                	mov    %eax,%esi
+  802582:	89 d7                	mov    %edx,%edi
+  802584:	31 db                	xor    %ebx,%ebx
+  802586:	d3 ef                	shr    %cl,%edi
+  802588:	0f ad d6             	shrd   %cl,%edx,%esi
+  80258b:	f6 c1 20             	test   $0x20,%cl
+  80258e:	0f 45 f7             	cmovne %edi,%esi
+  802591:	0f 45 fb             	cmovne %ebx,%edi
+  802594:	8b 1c 24             	mov    (%esp),%ebx
+  802597:	39 de                	cmp    %ebx,%esi
+  802599:	89 fb                	mov    %edi,%ebx
+  80259b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80259f:	8b 34 24             	mov    (%esp),%esi
+  8025a2:	19 fb                	sbb    %edi,%ebx
+  8025a4:	72 14                	jb     8025ba <__umoddi3+0x6a>
+  8025a6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8025a9:	31 db                	xor    %ebx,%ebx
+  8025ab:	d3 e6                	shl    %cl,%esi
+  8025ad:	f6 c1 20             	test   $0x20,%cl
+  8025b0:	0f 45 fe             	cmovne %esi,%edi
+  8025b3:	0f 45 f3             	cmovne %ebx,%esi
+  8025b6:	29 f0                	sub    %esi,%eax
+  8025b8:	19 fa                	sbb    %edi,%edx
+  8025ba:	83 e9 01             	sub    $0x1,%ecx
+  8025bd:	73 c1                	jae    802580 <__umoddi3+0x30>
+  8025bf:	83 c4 08             	add    $0x8,%esp
+  8025c2:	5b                   	pop    %ebx
+  8025c3:	5e                   	pop    %esi
+  8025c4:	5f                   	pop    %edi
+  8025c5:	c3                   	ret
+  8025c6:	83 c4 08             	add    $0x8,%esp
+  8025c9:	31 c0                	xor    %eax,%eax
+  8025cb:	31 d2                	xor    %edx,%edx
+  8025cd:	5b                   	pop    %ebx
+  8025ce:	5e                   	pop    %esi
+  8025cf:	5f                   	pop    %edi
+  8025d0:	c3                   	ret
+  8025d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8025d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8025df:	90                   	nop
+
+008025e0 <__divdi3>:
+  8025e0:	55                   	push   %ebp
+  8025e1:	57                   	push   %edi
+  8025e2:	56                   	push   %esi
+  8025e3:	53                   	push   %ebx
+  8025e4:	83 ec 1c             	sub    $0x1c,%esp
+  8025e7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8025eb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025ef:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8025f3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8025f7:	85 ff                	test   %edi,%edi
+  8025f9:	0f 88 da 00 00 00    	js     8026d9 <__divdi3+0xf9>
+  8025ff:	85 db                	test   %ebx,%ebx
+  802601:	78 16                	js     802619 <__divdi3+0x39>
+  802603:	89 dd                	mov    %ebx,%ebp
+  802605:	89 c8                	mov    %ecx,%eax
+  802607:	89 da                	mov    %ebx,%edx
+  802609:	09 cd                	or     %ecx,%ebp
+  80260b:	0f 85 fd 00 00 00    	jne    80270e <__divdi3+0x12e>
+  802611:	83 c4 1c             	add    $0x1c,%esp
+  802614:	5b                   	pop    %ebx
+  802615:	5e                   	pop    %esi
+  802616:	5f                   	pop    %edi
+  802617:	5d                   	pop    %ebp
+  802618:	c3                   	ret
+  802619:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80261e:	f7 d9                	neg    %ecx
+  802620:	89 f0                	mov    %esi,%eax
+  802622:	89 fa                	mov    %edi,%edx
+  802624:	83 d3 00             	adc    $0x0,%ebx
+  802627:	89 0c 24             	mov    %ecx,(%esp)
+  80262a:	f7 db                	neg    %ebx
+  80262c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802630:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802637:	00 
+  802638:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80263d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802644:	00 
+  802645:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802649:	89 cd                	mov    %ecx,%ebp
+  80264b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80264f:	90                   	nop
+  802650:	89 e9                	mov    %ebp,%ecx
+  802652:	89 c3                	mov    %eax,%ebx
+  802654:	89 d6                	mov    %edx,%esi
+  802656:	31 ff                	xor    %edi,%edi
+  802658:	d3 ee                	shr    %cl,%esi
+  80265a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80265d:	f6 c1 20             	test   $0x20,%cl
+  802660:	0f 45 de             	cmovne %esi,%ebx
+  802663:	0f 45 f7             	cmovne %edi,%esi
+  802666:	8b 3c 24             	mov    (%esp),%edi
+  802669:	39 fb                	cmp    %edi,%ebx
+  80266b:	89 f7                	mov    %esi,%edi
+  80266d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802671:	8b 1c 24             	mov    (%esp),%ebx
+  802674:	19 f7                	sbb    %esi,%edi
+  802676:	72 39                	jb     8026b1 <__divdi3+0xd1>
+  802678:	89 e9                	mov    %ebp,%ecx
+  80267a:	89 f7                	mov    %esi,%edi
+  80267c:	89 de                	mov    %ebx,%esi
+  80267e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802681:	d3 e6                	shl    %cl,%esi
+  802683:	31 db                	xor    %ebx,%ebx
+  802685:	f6 c1 20             	test   $0x20,%cl
+  802688:	0f 45 fe             	cmovne %esi,%edi
+  80268b:	0f 45 f3             	cmovne %ebx,%esi
+  80268e:	29 f0                	sub    %esi,%eax
+  802690:	be 01 00 00 00       	mov    $0x1,%esi
+  802695:	19 fa                	sbb    %edi,%edx
+  802697:	31 ff                	xor    %edi,%edi
+  802699:	31 db                	xor    %ebx,%ebx
+  80269b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80269e:	d3 e6                	shl    %cl,%esi
+  8026a0:	f6 c1 20             	test   $0x20,%cl
+  8026a3:	0f 45 fe             	cmovne %esi,%edi
+  8026a6:	0f 45 f3             	cmovne %ebx,%esi
+  8026a9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8026ad:	09 74 24 08          	or     %esi,0x8(%esp)
+  8026b1:	83 ed 01             	sub    $0x1,%ebp
+  8026b4:	73 9a                	jae    802650 <__divdi3+0x70>
+  8026b6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8026ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026c2:	85 ed                	test   %ebp,%ebp
+  8026c4:	0f 84 47 ff ff ff    	je     802611 <__divdi3+0x31>
+  8026ca:	f7 d8                	neg    %eax
+  8026cc:	83 d2 00             	adc    $0x0,%edx
+  8026cf:	83 c4 1c             	add    $0x1c,%esp
+  8026d2:	5b                   	pop    %ebx
+  8026d3:	f7 da                	neg    %edx
+  8026d5:	5e                   	pop    %esi
+  8026d6:	5f                   	pop    %edi
+  8026d7:	5d                   	pop    %ebp
+  8026d8:	c3                   	ret
+  8026d9:	f7 de                	neg    %esi
+  8026db:	83 d7 00             	adc    $0x0,%edi
+  8026de:	f7 df                	neg    %edi
+  8026e0:	85 db                	test   %ebx,%ebx
+  8026e2:	78 23                	js     802707 <__divdi3+0x127>
+  8026e4:	89 dd                	mov    %ebx,%ebp
+  8026e6:	89 c8                	mov    %ecx,%eax
+  8026e8:	89 da                	mov    %ebx,%edx
+  8026ea:	09 cd                	or     %ecx,%ebp
+  8026ec:	0f 84 1f ff ff ff    	je     802611 <__divdi3+0x31>
+  8026f2:	89 0c 24             	mov    %ecx,(%esp)
+  8026f5:	89 f0                	mov    %esi,%eax
+  8026f7:	89 fa                	mov    %edi,%edx
+  8026f9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8026fe:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802702:	e9 29 ff ff ff       	jmp    802630 <__divdi3+0x50>
+  802707:	31 ed                	xor    %ebp,%ebp
+  802709:	e9 10 ff ff ff       	jmp    80261e <__divdi3+0x3e>
+  80270e:	89 0c 24             	mov    %ecx,(%esp)
+  802711:	89 f0                	mov    %esi,%eax
+  802713:	89 fa                	mov    %edi,%edx
+  802715:	31 ed                	xor    %ebp,%ebp
+  802717:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80271b:	e9 10 ff ff ff       	jmp    802630 <__divdi3+0x50>
+
+00802720 <__moddi3>:
+  802720:	55                   	push   %ebp
+  802721:	57                   	push   %edi
+  802722:	56                   	push   %esi
+  802723:	53                   	push   %ebx
+  802724:	83 ec 14             	sub    $0x14,%esp
+  802727:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80272b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80272f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802733:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802737:	85 d2                	test   %edx,%edx
+  802739:	0f 88 9b 00 00 00    	js     8027da <__moddi3+0xba>
+  80273f:	89 f7                	mov    %esi,%edi
+  802741:	31 ed                	xor    %ebp,%ebp
+  802743:	09 cf                	or     %ecx,%edi
+  802745:	0f 84 83 00 00 00    	je     8027ce <__moddi3+0xae>
+  80274b:	89 cb                	mov    %ecx,%ebx
+  80274d:	89 f7                	mov    %esi,%edi
+  80274f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802753:	f7 db                	neg    %ebx
+  802755:	83 d7 00             	adc    $0x0,%edi
+  802758:	f7 df                	neg    %edi
+  80275a:	0f 49 f7             	cmovns %edi,%esi
+  80275d:	0f 49 cb             	cmovns %ebx,%ecx
+  802760:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802764:	89 0c 24             	mov    %ecx,(%esp)
+  802767:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80276c:	89 cd                	mov    %ecx,%ebp
+  80276e:	66 90                	xchg   %ax,%ax
+  802770:	89 e9                	mov    %ebp,%ecx
+  802772:	89 c3                	mov    %eax,%ebx
+  802774:	89 d6                	mov    %edx,%esi
+  802776:	31 ff                	xor    %edi,%edi
+  802778:	d3 ee                	shr    %cl,%esi
+  80277a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80277d:	f6 c1 20             	test   $0x20,%cl
+  802780:	0f 45 de             	cmovne %esi,%ebx
+  802783:	0f 45 f7             	cmovne %edi,%esi
+  802786:	8b 3c 24             	mov    (%esp),%edi
+  802789:	39 fb                	cmp    %edi,%ebx
+  80278b:	89 f7                	mov    %esi,%edi
+  80278d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802791:	8b 1c 24             	mov    (%esp),%ebx
+  802794:	19 f7                	sbb    %esi,%edi
+  802796:	72 1a                	jb     8027b2 <__moddi3+0x92>
+  802798:	89 e9                	mov    %ebp,%ecx
+  80279a:	89 f7                	mov    %esi,%edi
+  80279c:	89 de                	mov    %ebx,%esi
+  80279e:	0f a5 df             	shld   %cl,%ebx,%edi
+  8027a1:	d3 e6                	shl    %cl,%esi
+  8027a3:	31 db                	xor    %ebx,%ebx
+  8027a5:	f6 c1 20             	test   $0x20,%cl
+  8027a8:	0f 45 fe             	cmovne %esi,%edi
+  8027ab:	0f 45 f3             	cmovne %ebx,%esi
+  8027ae:	29 f0                	sub    %esi,%eax
+  8027b0:	19 fa                	sbb    %edi,%edx
+  8027b2:	83 ed 01             	sub    $0x1,%ebp
+  8027b5:	73 b9                	jae    802770 <__moddi3+0x50>
+  8027b7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  8027bb:	85 ed                	test   %ebp,%ebp
+  8027bd:	74 07                	je     8027c6 <__moddi3+0xa6>
+  8027bf:	f7 d8                	neg    %eax
+  8027c1:	83 d2 00             	adc    $0x0,%edx
+  8027c4:	f7 da                	neg    %edx
+  8027c6:	83 c4 14             	add    $0x14,%esp
+  8027c9:	5b                   	pop    %ebx
+  8027ca:	5e                   	pop    %esi
+  8027cb:	5f                   	pop    %edi
+  8027cc:	5d                   	pop    %ebp
+  8027cd:	c3                   	ret
+  8027ce:	83 c4 14             	add    $0x14,%esp
+  8027d1:	31 c0                	xor    %eax,%eax
+  8027d3:	31 d2                	xor    %edx,%edx
+  8027d5:	5b                   	pop    %ebx
+  8027d6:	5e                   	pop    %esi
+  8027d7:	5f                   	pop    %edi
+  8027d8:	5d                   	pop    %ebp
+  8027d9:	c3                   	ret
+  8027da:	89 f7                	mov    %esi,%edi
+  8027dc:	09 cf                	or     %ecx,%edi
+  8027de:	74 11                	je     8027f1 <__moddi3+0xd1>
+  8027e0:	f7 d8                	neg    %eax
+  8027e2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8027e7:	83 d2 00             	adc    $0x0,%edx
+  8027ea:	f7 da                	neg    %edx
+  8027ec:	e9 5a ff ff ff       	jmp    80274b <__moddi3+0x2b>
+  8027f1:	31 c0                	xor    %eax,%eax
+  8027f3:	31 d2                	xor    %edx,%edx
+  8027f5:	eb c8                	jmp    8027bf <__moddi3+0x9f>
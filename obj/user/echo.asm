@@ -0,0 +1,5635 @@
+
+obj/user/echo.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b3 00 00 00       	call   8000e4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80003f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i, nflag;
+
+	nflag = 0;
+  800042:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800049:	83 ff 01             	cmp    $0x1,%edi
+  80004c:	7f 07                	jg     800055 <umain+0x22>
+		nflag = 1;
+		argc--;
+		argv++;
+	}
+	for (i = 1; i < argc; i++) {
+  80004e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800053:	eb 4c                	jmp    8000a1 <umain+0x6e>
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	68 20 27 80 00       	push   $0x802720
+  80005d:	ff 76 04             	push   0x4(%esi)
+  800060:	e8 cb 01 00 00       	call   800230 <strcmp>
+  800065:	83 c4 10             	add    $0x10,%esp
+	nflag = 0;
+  800068:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	75 db                	jne    80004e <umain+0x1b>
+		argc--;
+  800073:	83 ef 01             	sub    $0x1,%edi
+		argv++;
+  800076:	83 c6 04             	add    $0x4,%esi
+		nflag = 1;
+  800079:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  800080:	eb cc                	jmp    80004e <umain+0x1b>
+		if (i > 1)
+			write(1, " ", 1);
+		write(1, argv[i], strlen(argv[i]));
+  800082:	83 ec 0c             	sub    $0xc,%esp
+  800085:	ff 34 9e             	push   (%esi,%ebx,4)
+  800088:	e8 b7 00 00 00       	call   800144 <strlen>
+  80008d:	83 c4 0c             	add    $0xc,%esp
+  800090:	50                   	push   %eax
+  800091:	ff 34 9e             	push   (%esi,%ebx,4)
+  800094:	6a 01                	push   $0x1
+  800096:	e8 27 0d 00 00       	call   800dc2 <write>
+	for (i = 1; i < argc; i++) {
+  80009b:	83 c3 01             	add    $0x1,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	39 df                	cmp    %ebx,%edi
+  8000a3:	7e 1b                	jle    8000c0 <umain+0x8d>
+		if (i > 1)
+  8000a5:	83 fb 01             	cmp    $0x1,%ebx
+  8000a8:	7e d8                	jle    800082 <umain+0x4f>
+			write(1, " ", 1);
+  8000aa:	83 ec 04             	sub    $0x4,%esp
+  8000ad:	6a 01                	push   $0x1
+  8000af:	68 23 27 80 00       	push   $0x802723
+  8000b4:	6a 01                	push   $0x1
+  8000b6:	e8 07 0d 00 00       	call   800dc2 <write>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	eb c2                	jmp    800082 <umain+0x4f>
+	}
+	if (!nflag)
+  8000c0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8000c4:	74 08                	je     8000ce <umain+0x9b>
+		write(1, "\n", 1);
+}
+  8000c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c9:	5b                   	pop    %ebx
+  8000ca:	5e                   	pop    %esi
+  8000cb:	5f                   	pop    %edi
+  8000cc:	5d                   	pop    %ebp
+  8000cd:	c3                   	ret
+		write(1, "\n", 1);
+  8000ce:	83 ec 04             	sub    $0x4,%esp
+  8000d1:	6a 01                	push   $0x1
+  8000d3:	68 70 28 80 00       	push   $0x802870
+  8000d8:	6a 01                	push   $0x1
+  8000da:	e8 e3 0c 00 00       	call   800dc2 <write>
+  8000df:	83 c4 10             	add    $0x10,%esp
+}
+  8000e2:	eb e2                	jmp    8000c6 <umain+0x93>
+
+008000e4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+  8000e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000ef:	e8 59 04 00 00       	call   80054d <sys_getenvid>
+  8000f4:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000f9:	c1 e0 09             	shl    $0x9,%eax
+  8000fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800101:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800106:	85 db                	test   %ebx,%ebx
+  800108:	7e 07                	jle    800111 <libmain+0x2d>
+		binaryname = argv[0];
+  80010a:	8b 06                	mov    (%esi),%eax
+  80010c:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800111:	83 ec 08             	sub    $0x8,%esp
+  800114:	56                   	push   %esi
+  800115:	53                   	push   %ebx
+  800116:	e8 18 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80011b:	e8 0a 00 00 00       	call   80012a <exit>
+}
+  800120:	83 c4 10             	add    $0x10,%esp
+  800123:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800126:	5b                   	pop    %ebx
+  800127:	5e                   	pop    %esi
+  800128:	5d                   	pop    %ebp
+  800129:	c3                   	ret
+
+0080012a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012a:	55                   	push   %ebp
+  80012b:	89 e5                	mov    %esp,%ebp
+  80012d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800130:	e8 b0 0a 00 00       	call   800be5 <close_all>
+	sys_env_destroy(0);
+  800135:	83 ec 0c             	sub    $0xc,%esp
+  800138:	6a 00                	push   $0x0
+  80013a:	e8 cd 03 00 00       	call   80050c <sys_env_destroy>
+}
+  80013f:	83 c4 10             	add    $0x10,%esp
+  800142:	c9                   	leave
+  800143:	c3                   	ret
+
+00800144 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800144:	55                   	push   %ebp
+  800145:	89 e5                	mov    %esp,%ebp
+  800147:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80014a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014f:	eb 03                	jmp    800154 <strlen+0x10>
+		n++;
+  800151:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800154:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800158:	75 f7                	jne    800151 <strlen+0xd>
+	return n;
+}
+  80015a:	5d                   	pop    %ebp
+  80015b:	c3                   	ret
+
+0080015c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800162:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016a:	eb 03                	jmp    80016f <strnlen+0x13>
+		n++;
+  80016c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80016f:	39 d0                	cmp    %edx,%eax
+  800171:	74 08                	je     80017b <strnlen+0x1f>
+  800173:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800177:	75 f3                	jne    80016c <strnlen+0x10>
+  800179:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80017b:	89 d0                	mov    %edx,%eax
+  80017d:	5d                   	pop    %ebp
+  80017e:	c3                   	ret
+
+0080017f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80017f:	55                   	push   %ebp
+  800180:	89 e5                	mov    %esp,%ebp
+  800182:	53                   	push   %ebx
+  800183:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800186:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800192:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800195:	83 c0 01             	add    $0x1,%eax
+  800198:	84 d2                	test   %dl,%dl
+  80019a:	75 f2                	jne    80018e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80019c:	89 c8                	mov    %ecx,%eax
+  80019e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001a1:	c9                   	leave
+  8001a2:	c3                   	ret
+
+008001a3 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8001a3:	55                   	push   %ebp
+  8001a4:	89 e5                	mov    %esp,%ebp
+  8001a6:	53                   	push   %ebx
+  8001a7:	83 ec 10             	sub    $0x10,%esp
+  8001aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8001ad:	53                   	push   %ebx
+  8001ae:	e8 91 ff ff ff       	call   800144 <strlen>
+  8001b3:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8001b6:	ff 75 0c             	push   0xc(%ebp)
+  8001b9:	01 d8                	add    %ebx,%eax
+  8001bb:	50                   	push   %eax
+  8001bc:	e8 be ff ff ff       	call   80017f <strcpy>
+	return dst;
+}
+  8001c1:	89 d8                	mov    %ebx,%eax
+  8001c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c6:	c9                   	leave
+  8001c7:	c3                   	ret
+
+008001c8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8001c8:	55                   	push   %ebp
+  8001c9:	89 e5                	mov    %esp,%ebp
+  8001cb:	56                   	push   %esi
+  8001cc:	53                   	push   %ebx
+  8001cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8001d3:	89 f3                	mov    %esi,%ebx
+  8001d5:	03 5d 10             	add    0x10(%ebp),%ebx
+  8001d8:	89 f0                	mov    %esi,%eax
+  8001da:	eb 0f                	jmp    8001eb <strncpy+0x23>
+		*dst++ = *src;
+  8001dc:	83 c0 01             	add    $0x1,%eax
+  8001df:	0f b6 0a             	movzbl (%edx),%ecx
+  8001e2:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8001e5:	80 f9 01             	cmp    $0x1,%cl
+  8001e8:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8001eb:	39 d8                	cmp    %ebx,%eax
+  8001ed:	75 ed                	jne    8001dc <strncpy+0x14>
+	}
+	return ret;
+}
+  8001ef:	89 f0                	mov    %esi,%eax
+  8001f1:	5b                   	pop    %ebx
+  8001f2:	5e                   	pop    %esi
+  8001f3:	5d                   	pop    %ebp
+  8001f4:	c3                   	ret
+
+008001f5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8001f5:	55                   	push   %ebp
+  8001f6:	89 e5                	mov    %esp,%ebp
+  8001f8:	56                   	push   %esi
+  8001f9:	53                   	push   %ebx
+  8001fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800200:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800203:	89 f0                	mov    %esi,%eax
+  800205:	85 d2                	test   %edx,%edx
+  800207:	74 21                	je     80022a <strlcpy+0x35>
+  800209:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80020d:	89 f2                	mov    %esi,%edx
+  80020f:	eb 09                	jmp    80021a <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800211:	83 c1 01             	add    $0x1,%ecx
+  800214:	83 c2 01             	add    $0x1,%edx
+  800217:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80021a:	39 c2                	cmp    %eax,%edx
+  80021c:	74 09                	je     800227 <strlcpy+0x32>
+  80021e:	0f b6 19             	movzbl (%ecx),%ebx
+  800221:	84 db                	test   %bl,%bl
+  800223:	75 ec                	jne    800211 <strlcpy+0x1c>
+  800225:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800227:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80022a:	29 f0                	sub    %esi,%eax
+}
+  80022c:	5b                   	pop    %ebx
+  80022d:	5e                   	pop    %esi
+  80022e:	5d                   	pop    %ebp
+  80022f:	c3                   	ret
+
+00800230 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800230:	55                   	push   %ebp
+  800231:	89 e5                	mov    %esp,%ebp
+  800233:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800236:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800239:	eb 06                	jmp    800241 <strcmp+0x11>
+		p++, q++;
+  80023b:	83 c1 01             	add    $0x1,%ecx
+  80023e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800241:	0f b6 01             	movzbl (%ecx),%eax
+  800244:	84 c0                	test   %al,%al
+  800246:	74 04                	je     80024c <strcmp+0x1c>
+  800248:	3a 02                	cmp    (%edx),%al
+  80024a:	74 ef                	je     80023b <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80024c:	0f b6 c0             	movzbl %al,%eax
+  80024f:	0f b6 12             	movzbl (%edx),%edx
+  800252:	29 d0                	sub    %edx,%eax
+}
+  800254:	5d                   	pop    %ebp
+  800255:	c3                   	ret
+
+00800256 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800256:	55                   	push   %ebp
+  800257:	89 e5                	mov    %esp,%ebp
+  800259:	53                   	push   %ebx
+  80025a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80025d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800260:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800263:	eb 09                	jmp    80026e <strncmp+0x18>
+		n--, p++, q++;
+  800265:	83 ea 01             	sub    $0x1,%edx
+  800268:	83 c0 01             	add    $0x1,%eax
+  80026b:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80026e:	85 d2                	test   %edx,%edx
+  800270:	74 18                	je     80028a <strncmp+0x34>
+  800272:	0f b6 18             	movzbl (%eax),%ebx
+  800275:	84 db                	test   %bl,%bl
+  800277:	74 04                	je     80027d <strncmp+0x27>
+  800279:	3a 19                	cmp    (%ecx),%bl
+  80027b:	74 e8                	je     800265 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80027d:	0f b6 00             	movzbl (%eax),%eax
+  800280:	0f b6 11             	movzbl (%ecx),%edx
+  800283:	29 d0                	sub    %edx,%eax
+}
+  800285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800288:	c9                   	leave
+  800289:	c3                   	ret
+		return 0;
+  80028a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028f:	eb f4                	jmp    800285 <strncmp+0x2f>
+
+00800291 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800291:	55                   	push   %ebp
+  800292:	89 e5                	mov    %esp,%ebp
+  800294:	8b 45 08             	mov    0x8(%ebp),%eax
+  800297:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80029b:	eb 03                	jmp    8002a0 <strchr+0xf>
+  80029d:	83 c0 01             	add    $0x1,%eax
+  8002a0:	0f b6 10             	movzbl (%eax),%edx
+  8002a3:	84 d2                	test   %dl,%dl
+  8002a5:	74 06                	je     8002ad <strchr+0x1c>
+		if (*s == c)
+  8002a7:	38 ca                	cmp    %cl,%dl
+  8002a9:	75 f2                	jne    80029d <strchr+0xc>
+  8002ab:	eb 05                	jmp    8002b2 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8002ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8002b2:	5d                   	pop    %ebp
+  8002b3:	c3                   	ret
+
+008002b4 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8002b4:	55                   	push   %ebp
+  8002b5:	89 e5                	mov    %esp,%ebp
+  8002b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ba:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8002be:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8002c1:	38 ca                	cmp    %cl,%dl
+  8002c3:	74 09                	je     8002ce <strfind+0x1a>
+  8002c5:	84 d2                	test   %dl,%dl
+  8002c7:	74 05                	je     8002ce <strfind+0x1a>
+	for (; *s; s++)
+  8002c9:	83 c0 01             	add    $0x1,%eax
+  8002cc:	eb f0                	jmp    8002be <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8002ce:	5d                   	pop    %ebp
+  8002cf:	c3                   	ret
+
+008002d0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8002d0:	55                   	push   %ebp
+  8002d1:	89 e5                	mov    %esp,%ebp
+  8002d3:	57                   	push   %edi
+  8002d4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8002da:	85 c9                	test   %ecx,%ecx
+  8002dc:	74 20                	je     8002fe <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8002de:	89 f8                	mov    %edi,%eax
+  8002e0:	09 c8                	or     %ecx,%eax
+  8002e2:	a8 03                	test   $0x3,%al
+  8002e4:	75 12                	jne    8002f8 <memset+0x28>
+		c &= 0xFF;
+  8002e6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8002ea:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8002f0:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8002f3:	fc                   	cld
+  8002f4:	f3 ab                	rep stos %eax,%es:(%edi)
+  8002f6:	eb 06                	jmp    8002fe <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8002f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002fb:	fc                   	cld
+  8002fc:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8002fe:	89 f8                	mov    %edi,%eax
+  800300:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800303:	c9                   	leave
+  800304:	c3                   	ret
+
+00800305 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800305:	55                   	push   %ebp
+  800306:	89 e5                	mov    %esp,%ebp
+  800308:	57                   	push   %edi
+  800309:	56                   	push   %esi
+  80030a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80030d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800310:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800313:	39 c6                	cmp    %eax,%esi
+  800315:	73 32                	jae    800349 <memmove+0x44>
+  800317:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80031a:	39 d0                	cmp    %edx,%eax
+  80031c:	73 2b                	jae    800349 <memmove+0x44>
+		s += n;
+		d += n;
+  80031e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800321:	89 d6                	mov    %edx,%esi
+  800323:	09 fe                	or     %edi,%esi
+  800325:	09 ce                	or     %ecx,%esi
+  800327:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80032d:	75 0e                	jne    80033d <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80032f:	83 ef 04             	sub    $0x4,%edi
+  800332:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800335:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800338:	fd                   	std
+  800339:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80033b:	eb 09                	jmp    800346 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80033d:	83 ef 01             	sub    $0x1,%edi
+  800340:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800343:	fd                   	std
+  800344:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800346:	fc                   	cld
+  800347:	eb 1a                	jmp    800363 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800349:	89 f2                	mov    %esi,%edx
+  80034b:	09 c2                	or     %eax,%edx
+  80034d:	09 ca                	or     %ecx,%edx
+  80034f:	f6 c2 03             	test   $0x3,%dl
+  800352:	75 0a                	jne    80035e <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800354:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800357:	89 c7                	mov    %eax,%edi
+  800359:	fc                   	cld
+  80035a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80035c:	eb 05                	jmp    800363 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80035e:	89 c7                	mov    %eax,%edi
+  800360:	fc                   	cld
+  800361:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800363:	5e                   	pop    %esi
+  800364:	5f                   	pop    %edi
+  800365:	5d                   	pop    %ebp
+  800366:	c3                   	ret
+
+00800367 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800367:	55                   	push   %ebp
+  800368:	89 e5                	mov    %esp,%ebp
+  80036a:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80036d:	ff 75 10             	push   0x10(%ebp)
+  800370:	ff 75 0c             	push   0xc(%ebp)
+  800373:	ff 75 08             	push   0x8(%ebp)
+  800376:	e8 8a ff ff ff       	call   800305 <memmove>
+}
+  80037b:	c9                   	leave
+  80037c:	c3                   	ret
+
+0080037d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80037d:	55                   	push   %ebp
+  80037e:	89 e5                	mov    %esp,%ebp
+  800380:	56                   	push   %esi
+  800381:	53                   	push   %ebx
+  800382:	8b 45 08             	mov    0x8(%ebp),%eax
+  800385:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800388:	89 c6                	mov    %eax,%esi
+  80038a:	03 75 10             	add    0x10(%ebp),%esi
+  80038d:	eb 06                	jmp    800395 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80038f:	83 c0 01             	add    $0x1,%eax
+  800392:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800395:	39 f0                	cmp    %esi,%eax
+  800397:	74 14                	je     8003ad <memcmp+0x30>
+		if (*s1 != *s2)
+  800399:	0f b6 08             	movzbl (%eax),%ecx
+  80039c:	0f b6 1a             	movzbl (%edx),%ebx
+  80039f:	38 d9                	cmp    %bl,%cl
+  8003a1:	74 ec                	je     80038f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8003a3:	0f b6 c1             	movzbl %cl,%eax
+  8003a6:	0f b6 db             	movzbl %bl,%ebx
+  8003a9:	29 d8                	sub    %ebx,%eax
+  8003ab:	eb 05                	jmp    8003b2 <memcmp+0x35>
+	}
+
+	return 0;
+  8003ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003b2:	5b                   	pop    %ebx
+  8003b3:	5e                   	pop    %esi
+  8003b4:	5d                   	pop    %ebp
+  8003b5:	c3                   	ret
+
+008003b6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8003b6:	55                   	push   %ebp
+  8003b7:	89 e5                	mov    %esp,%ebp
+  8003b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8003bf:	89 c2                	mov    %eax,%edx
+  8003c1:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8003c4:	eb 03                	jmp    8003c9 <memfind+0x13>
+  8003c6:	83 c0 01             	add    $0x1,%eax
+  8003c9:	39 d0                	cmp    %edx,%eax
+  8003cb:	73 04                	jae    8003d1 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8003cd:	38 08                	cmp    %cl,(%eax)
+  8003cf:	75 f5                	jne    8003c6 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8003d1:	5d                   	pop    %ebp
+  8003d2:	c3                   	ret
+
+008003d3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8003d3:	55                   	push   %ebp
+  8003d4:	89 e5                	mov    %esp,%ebp
+  8003d6:	57                   	push   %edi
+  8003d7:	56                   	push   %esi
+  8003d8:	53                   	push   %ebx
+  8003d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8003df:	eb 03                	jmp    8003e4 <strtol+0x11>
+		s++;
+  8003e1:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8003e4:	0f b6 02             	movzbl (%edx),%eax
+  8003e7:	3c 20                	cmp    $0x20,%al
+  8003e9:	74 f6                	je     8003e1 <strtol+0xe>
+  8003eb:	3c 09                	cmp    $0x9,%al
+  8003ed:	74 f2                	je     8003e1 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8003ef:	3c 2b                	cmp    $0x2b,%al
+  8003f1:	74 2a                	je     80041d <strtol+0x4a>
+	int neg = 0;
+  8003f3:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8003f8:	3c 2d                	cmp    $0x2d,%al
+  8003fa:	74 2b                	je     800427 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8003fc:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800402:	75 0f                	jne    800413 <strtol+0x40>
+  800404:	80 3a 30             	cmpb   $0x30,(%edx)
+  800407:	74 28                	je     800431 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800409:	85 db                	test   %ebx,%ebx
+  80040b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800410:	0f 44 d8             	cmove  %eax,%ebx
+  800413:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800418:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80041b:	eb 46                	jmp    800463 <strtol+0x90>
+		s++;
+  80041d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800420:	bf 00 00 00 00       	mov    $0x0,%edi
+  800425:	eb d5                	jmp    8003fc <strtol+0x29>
+		s++, neg = 1;
+  800427:	83 c2 01             	add    $0x1,%edx
+  80042a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80042f:	eb cb                	jmp    8003fc <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800431:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800435:	74 0e                	je     800445 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800437:	85 db                	test   %ebx,%ebx
+  800439:	75 d8                	jne    800413 <strtol+0x40>
+		s++, base = 8;
+  80043b:	83 c2 01             	add    $0x1,%edx
+  80043e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800443:	eb ce                	jmp    800413 <strtol+0x40>
+		s += 2, base = 16;
+  800445:	83 c2 02             	add    $0x2,%edx
+  800448:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80044d:	eb c4                	jmp    800413 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80044f:	0f be c0             	movsbl %al,%eax
+  800452:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800455:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800458:	7d 3a                	jge    800494 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80045a:	83 c2 01             	add    $0x1,%edx
+  80045d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800461:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800463:	0f b6 02             	movzbl (%edx),%eax
+  800466:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800469:	89 f3                	mov    %esi,%ebx
+  80046b:	80 fb 09             	cmp    $0x9,%bl
+  80046e:	76 df                	jbe    80044f <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800470:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800473:	89 f3                	mov    %esi,%ebx
+  800475:	80 fb 19             	cmp    $0x19,%bl
+  800478:	77 08                	ja     800482 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80047a:	0f be c0             	movsbl %al,%eax
+  80047d:	83 e8 57             	sub    $0x57,%eax
+  800480:	eb d3                	jmp    800455 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800482:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800485:	89 f3                	mov    %esi,%ebx
+  800487:	80 fb 19             	cmp    $0x19,%bl
+  80048a:	77 08                	ja     800494 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80048c:	0f be c0             	movsbl %al,%eax
+  80048f:	83 e8 37             	sub    $0x37,%eax
+  800492:	eb c1                	jmp    800455 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800494:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800498:	74 05                	je     80049f <strtol+0xcc>
+		*endptr = (char *) s;
+  80049a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80049d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80049f:	89 c8                	mov    %ecx,%eax
+  8004a1:	f7 d8                	neg    %eax
+  8004a3:	85 ff                	test   %edi,%edi
+  8004a5:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8004a8:	89 c8                	mov    %ecx,%eax
+  8004aa:	5b                   	pop    %ebx
+  8004ab:	5e                   	pop    %esi
+  8004ac:	5f                   	pop    %edi
+  8004ad:	5d                   	pop    %ebp
+  8004ae:	c3                   	ret
+
+008004af <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8004af:	55                   	push   %ebp
+  8004b0:	89 e5                	mov    %esp,%ebp
+  8004b2:	57                   	push   %edi
+  8004b3:	56                   	push   %esi
+  8004b4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c0:	89 c3                	mov    %eax,%ebx
+  8004c2:	89 c7                	mov    %eax,%edi
+  8004c4:	89 c6                	mov    %eax,%esi
+  8004c6:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8004c8:	5b                   	pop    %ebx
+  8004c9:	5e                   	pop    %esi
+  8004ca:	5f                   	pop    %edi
+  8004cb:	5d                   	pop    %ebp
+  8004cc:	c3                   	ret
+
+008004cd <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8004cd:	55                   	push   %ebp
+  8004ce:	89 e5                	mov    %esp,%ebp
+  8004d0:	57                   	push   %edi
+  8004d1:	56                   	push   %esi
+  8004d2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004dd:	89 d1                	mov    %edx,%ecx
+  8004df:	89 d3                	mov    %edx,%ebx
+  8004e1:	89 d7                	mov    %edx,%edi
+  8004e3:	89 d6                	mov    %edx,%esi
+  8004e5:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8004e7:	5b                   	pop    %ebx
+  8004e8:	5e                   	pop    %esi
+  8004e9:	5f                   	pop    %edi
+  8004ea:	5d                   	pop    %ebp
+  8004eb:	c3                   	ret
+
+008004ec <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8004ec:	55                   	push   %ebp
+  8004ed:	89 e5                	mov    %esp,%ebp
+  8004ef:	57                   	push   %edi
+  8004f0:	56                   	push   %esi
+  8004f1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004fa:	b8 04 00 00 00       	mov    $0x4,%eax
+  8004ff:	89 cb                	mov    %ecx,%ebx
+  800501:	89 cf                	mov    %ecx,%edi
+  800503:	89 ce                	mov    %ecx,%esi
+  800505:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800507:	5b                   	pop    %ebx
+  800508:	5e                   	pop    %esi
+  800509:	5f                   	pop    %edi
+  80050a:	5d                   	pop    %ebp
+  80050b:	c3                   	ret
+
+0080050c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80050c:	55                   	push   %ebp
+  80050d:	89 e5                	mov    %esp,%ebp
+  80050f:	57                   	push   %edi
+  800510:	56                   	push   %esi
+  800511:	53                   	push   %ebx
+  800512:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800515:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80051a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80051d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800522:	89 cb                	mov    %ecx,%ebx
+  800524:	89 cf                	mov    %ecx,%edi
+  800526:	89 ce                	mov    %ecx,%esi
+  800528:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80052a:	85 c0                	test   %eax,%eax
+  80052c:	7f 08                	jg     800536 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80052e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800531:	5b                   	pop    %ebx
+  800532:	5e                   	pop    %esi
+  800533:	5f                   	pop    %edi
+  800534:	5d                   	pop    %ebp
+  800535:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800536:	83 ec 0c             	sub    $0xc,%esp
+  800539:	50                   	push   %eax
+  80053a:	6a 03                	push   $0x3
+  80053c:	68 2f 27 80 00       	push   $0x80272f
+  800541:	6a 23                	push   $0x23
+  800543:	68 4c 27 80 00       	push   $0x80274c
+  800548:	e8 d5 15 00 00       	call   801b22 <_panic>
+
+0080054d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80054d:	55                   	push   %ebp
+  80054e:	89 e5                	mov    %esp,%ebp
+  800550:	57                   	push   %edi
+  800551:	56                   	push   %esi
+  800552:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800553:	ba 00 00 00 00       	mov    $0x0,%edx
+  800558:	b8 02 00 00 00       	mov    $0x2,%eax
+  80055d:	89 d1                	mov    %edx,%ecx
+  80055f:	89 d3                	mov    %edx,%ebx
+  800561:	89 d7                	mov    %edx,%edi
+  800563:	89 d6                	mov    %edx,%esi
+  800565:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800567:	5b                   	pop    %ebx
+  800568:	5e                   	pop    %esi
+  800569:	5f                   	pop    %edi
+  80056a:	5d                   	pop    %ebp
+  80056b:	c3                   	ret
+
+0080056c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80056c:	55                   	push   %ebp
+  80056d:	89 e5                	mov    %esp,%ebp
+  80056f:	57                   	push   %edi
+  800570:	56                   	push   %esi
+  800571:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800572:	ba 00 00 00 00       	mov    $0x0,%edx
+  800577:	b8 16 00 00 00       	mov    $0x16,%eax
+  80057c:	89 d1                	mov    %edx,%ecx
+  80057e:	89 d3                	mov    %edx,%ebx
+  800580:	89 d7                	mov    %edx,%edi
+  800582:	89 d6                	mov    %edx,%esi
+  800584:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800586:	5b                   	pop    %ebx
+  800587:	5e                   	pop    %esi
+  800588:	5f                   	pop    %edi
+  800589:	5d                   	pop    %ebp
+  80058a:	c3                   	ret
+
+0080058b <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  80058b:	55                   	push   %ebp
+  80058c:	89 e5                	mov    %esp,%ebp
+  80058e:	57                   	push   %edi
+  80058f:	56                   	push   %esi
+  800590:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800591:	ba 00 00 00 00       	mov    $0x0,%edx
+  800596:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80059b:	89 d1                	mov    %edx,%ecx
+  80059d:	89 d3                	mov    %edx,%ebx
+  80059f:	89 d7                	mov    %edx,%edi
+  8005a1:	89 d6                	mov    %edx,%esi
+  8005a3:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  8005a5:	5b                   	pop    %ebx
+  8005a6:	5e                   	pop    %esi
+  8005a7:	5f                   	pop    %edi
+  8005a8:	5d                   	pop    %ebp
+  8005a9:	c3                   	ret
+
+008005aa <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  8005aa:	55                   	push   %ebp
+  8005ab:	89 e5                	mov    %esp,%ebp
+  8005ad:	57                   	push   %edi
+  8005ae:	56                   	push   %esi
+  8005af:	53                   	push   %ebx
+  8005b0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005be:	b8 15 00 00 00       	mov    $0x15,%eax
+  8005c3:	89 df                	mov    %ebx,%edi
+  8005c5:	89 de                	mov    %ebx,%esi
+  8005c7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005c9:	85 c0                	test   %eax,%eax
+  8005cb:	7f 08                	jg     8005d5 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  8005cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d0:	5b                   	pop    %ebx
+  8005d1:	5e                   	pop    %esi
+  8005d2:	5f                   	pop    %edi
+  8005d3:	5d                   	pop    %ebp
+  8005d4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005d5:	83 ec 0c             	sub    $0xc,%esp
+  8005d8:	50                   	push   %eax
+  8005d9:	6a 15                	push   $0x15
+  8005db:	68 2f 27 80 00       	push   $0x80272f
+  8005e0:	6a 23                	push   $0x23
+  8005e2:	68 4c 27 80 00       	push   $0x80274c
+  8005e7:	e8 36 15 00 00       	call   801b22 <_panic>
+
+008005ec <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8005ec:	55                   	push   %ebp
+  8005ed:	89 e5                	mov    %esp,%ebp
+  8005ef:	57                   	push   %edi
+  8005f0:	56                   	push   %esi
+  8005f1:	53                   	push   %ebx
+  8005f2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8005fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800600:	b8 05 00 00 00       	mov    $0x5,%eax
+  800605:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800608:	89 f7                	mov    %esi,%edi
+  80060a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80060c:	85 c0                	test   %eax,%eax
+  80060e:	7f 08                	jg     800618 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800610:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800613:	5b                   	pop    %ebx
+  800614:	5e                   	pop    %esi
+  800615:	5f                   	pop    %edi
+  800616:	5d                   	pop    %ebp
+  800617:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800618:	83 ec 0c             	sub    $0xc,%esp
+  80061b:	50                   	push   %eax
+  80061c:	6a 05                	push   $0x5
+  80061e:	68 2f 27 80 00       	push   $0x80272f
+  800623:	6a 23                	push   $0x23
+  800625:	68 4c 27 80 00       	push   $0x80274c
+  80062a:	e8 f3 14 00 00       	call   801b22 <_panic>
+
+0080062f <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  80062f:	55                   	push   %ebp
+  800630:	89 e5                	mov    %esp,%ebp
+  800632:	57                   	push   %edi
+  800633:	56                   	push   %esi
+  800634:	53                   	push   %ebx
+  800635:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800638:	be 00 00 00 00       	mov    $0x0,%esi
+  80063d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800640:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800643:	b8 06 00 00 00       	mov    $0x6,%eax
+  800648:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80064b:	89 f7                	mov    %esi,%edi
+  80064d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80064f:	85 c0                	test   %eax,%eax
+  800651:	7f 08                	jg     80065b <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800653:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800656:	5b                   	pop    %ebx
+  800657:	5e                   	pop    %esi
+  800658:	5f                   	pop    %edi
+  800659:	5d                   	pop    %ebp
+  80065a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80065b:	83 ec 0c             	sub    $0xc,%esp
+  80065e:	50                   	push   %eax
+  80065f:	6a 06                	push   $0x6
+  800661:	68 2f 27 80 00       	push   $0x80272f
+  800666:	6a 23                	push   $0x23
+  800668:	68 4c 27 80 00       	push   $0x80274c
+  80066d:	e8 b0 14 00 00       	call   801b22 <_panic>
+
+00800672 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800672:	55                   	push   %ebp
+  800673:	89 e5                	mov    %esp,%ebp
+  800675:	57                   	push   %edi
+  800676:	56                   	push   %esi
+  800677:	53                   	push   %ebx
+  800678:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80067b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80067e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800681:	b8 07 00 00 00       	mov    $0x7,%eax
+  800686:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800689:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80068c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80068f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800691:	85 c0                	test   %eax,%eax
+  800693:	7f 08                	jg     80069d <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800695:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800698:	5b                   	pop    %ebx
+  800699:	5e                   	pop    %esi
+  80069a:	5f                   	pop    %edi
+  80069b:	5d                   	pop    %ebp
+  80069c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80069d:	83 ec 0c             	sub    $0xc,%esp
+  8006a0:	50                   	push   %eax
+  8006a1:	6a 07                	push   $0x7
+  8006a3:	68 2f 27 80 00       	push   $0x80272f
+  8006a8:	6a 23                	push   $0x23
+  8006aa:	68 4c 27 80 00       	push   $0x80274c
+  8006af:	e8 6e 14 00 00       	call   801b22 <_panic>
+
+008006b4 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8006b4:	55                   	push   %ebp
+  8006b5:	89 e5                	mov    %esp,%ebp
+  8006b7:	57                   	push   %edi
+  8006b8:	56                   	push   %esi
+  8006b9:	53                   	push   %ebx
+  8006ba:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8006bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006c8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8006cd:	89 df                	mov    %ebx,%edi
+  8006cf:	89 de                	mov    %ebx,%esi
+  8006d1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8006d3:	85 c0                	test   %eax,%eax
+  8006d5:	7f 08                	jg     8006df <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8006d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006da:	5b                   	pop    %ebx
+  8006db:	5e                   	pop    %esi
+  8006dc:	5f                   	pop    %edi
+  8006dd:	5d                   	pop    %ebp
+  8006de:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006df:	83 ec 0c             	sub    $0xc,%esp
+  8006e2:	50                   	push   %eax
+  8006e3:	6a 08                	push   $0x8
+  8006e5:	68 2f 27 80 00       	push   $0x80272f
+  8006ea:	6a 23                	push   $0x23
+  8006ec:	68 4c 27 80 00       	push   $0x80274c
+  8006f1:	e8 2c 14 00 00       	call   801b22 <_panic>
+
+008006f6 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8006f6:	55                   	push   %ebp
+  8006f7:	89 e5                	mov    %esp,%ebp
+  8006f9:	57                   	push   %edi
+  8006fa:	56                   	push   %esi
+  8006fb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8006fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800702:	b8 09 00 00 00       	mov    $0x9,%eax
+  800707:	be 00 00 00 00       	mov    $0x0,%esi
+  80070c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80070f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800712:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800714:	5b                   	pop    %ebx
+  800715:	5e                   	pop    %esi
+  800716:	5f                   	pop    %edi
+  800717:	5d                   	pop    %ebp
+  800718:	c3                   	ret
+
+00800719 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800719:	55                   	push   %ebp
+  80071a:	89 e5                	mov    %esp,%ebp
+  80071c:	57                   	push   %edi
+  80071d:	56                   	push   %esi
+  80071e:	53                   	push   %ebx
+  80071f:	8b 45 18             	mov    0x18(%ebp),%eax
+  800722:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800725:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  80072a:	77 27                	ja     800753 <sys_page_map_range+0x3a>
+  80072c:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800732:	77 1f                	ja     800753 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800734:	c1 e0 0c             	shl    $0xc,%eax
+  800737:	89 c6                	mov    %eax,%esi
+  800739:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  80073b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80073e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800741:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800746:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800749:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80074c:	cd 30                	int    $0x30
+}
+  80074e:	5b                   	pop    %ebx
+  80074f:	5e                   	pop    %esi
+  800750:	5f                   	pop    %edi
+  800751:	5d                   	pop    %ebp
+  800752:	c3                   	ret
+		return -E_INVAL;
+  800753:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800758:	eb f4                	jmp    80074e <sys_page_map_range+0x35>
+
+0080075a <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80075a:	55                   	push   %ebp
+  80075b:	89 e5                	mov    %esp,%ebp
+  80075d:	57                   	push   %edi
+  80075e:	56                   	push   %esi
+  80075f:	53                   	push   %ebx
+  800760:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800763:	8b 55 08             	mov    0x8(%ebp),%edx
+  800766:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800769:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80076e:	be 00 00 00 00       	mov    $0x0,%esi
+  800773:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800776:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800779:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80077b:	85 c0                	test   %eax,%eax
+  80077d:	7f 08                	jg     800787 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80077f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800782:	5b                   	pop    %ebx
+  800783:	5e                   	pop    %esi
+  800784:	5f                   	pop    %edi
+  800785:	5d                   	pop    %ebp
+  800786:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800787:	83 ec 0c             	sub    $0xc,%esp
+  80078a:	50                   	push   %eax
+  80078b:	6a 0c                	push   $0xc
+  80078d:	68 2f 27 80 00       	push   $0x80272f
+  800792:	6a 23                	push   $0x23
+  800794:	68 4c 27 80 00       	push   $0x80274c
+  800799:	e8 84 13 00 00       	call   801b22 <_panic>
+
+0080079e <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  80079e:	55                   	push   %ebp
+  80079f:	89 e5                	mov    %esp,%ebp
+  8007a1:	57                   	push   %edi
+  8007a2:	56                   	push   %esi
+  8007a3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8007a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8007a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007af:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8007b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007b7:	89 f7                	mov    %esi,%edi
+  8007b9:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8007bb:	5b                   	pop    %ebx
+  8007bc:	5e                   	pop    %esi
+  8007bd:	5f                   	pop    %edi
+  8007be:	5d                   	pop    %ebp
+  8007bf:	c3                   	ret
+
+008007c0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8007c0:	55                   	push   %ebp
+  8007c1:	89 e5                	mov    %esp,%ebp
+  8007c3:	57                   	push   %edi
+  8007c4:	56                   	push   %esi
+  8007c5:	53                   	push   %ebx
+  8007c6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8007c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007d4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8007d9:	89 df                	mov    %ebx,%edi
+  8007db:	89 de                	mov    %ebx,%esi
+  8007dd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8007df:	85 c0                	test   %eax,%eax
+  8007e1:	7f 08                	jg     8007eb <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8007e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e6:	5b                   	pop    %ebx
+  8007e7:	5e                   	pop    %esi
+  8007e8:	5f                   	pop    %edi
+  8007e9:	5d                   	pop    %ebp
+  8007ea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007eb:	83 ec 0c             	sub    $0xc,%esp
+  8007ee:	50                   	push   %eax
+  8007ef:	6a 0f                	push   $0xf
+  8007f1:	68 2f 27 80 00       	push   $0x80272f
+  8007f6:	6a 23                	push   $0x23
+  8007f8:	68 4c 27 80 00       	push   $0x80274c
+  8007fd:	e8 20 13 00 00       	call   801b22 <_panic>
+
+00800802 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800802:	55                   	push   %ebp
+  800803:	89 e5                	mov    %esp,%ebp
+  800805:	57                   	push   %edi
+  800806:	56                   	push   %esi
+  800807:	53                   	push   %ebx
+  800808:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80080b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800810:	8b 55 08             	mov    0x8(%ebp),%edx
+  800813:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800816:	b8 10 00 00 00       	mov    $0x10,%eax
+  80081b:	89 df                	mov    %ebx,%edi
+  80081d:	89 de                	mov    %ebx,%esi
+  80081f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800821:	85 c0                	test   %eax,%eax
+  800823:	7f 08                	jg     80082d <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800825:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800828:	5b                   	pop    %ebx
+  800829:	5e                   	pop    %esi
+  80082a:	5f                   	pop    %edi
+  80082b:	5d                   	pop    %ebp
+  80082c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80082d:	83 ec 0c             	sub    $0xc,%esp
+  800830:	50                   	push   %eax
+  800831:	6a 10                	push   $0x10
+  800833:	68 2f 27 80 00       	push   $0x80272f
+  800838:	6a 23                	push   $0x23
+  80083a:	68 4c 27 80 00       	push   $0x80274c
+  80083f:	e8 de 12 00 00       	call   801b22 <_panic>
+
+00800844 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800844:	55                   	push   %ebp
+  800845:	89 e5                	mov    %esp,%ebp
+  800847:	57                   	push   %edi
+  800848:	56                   	push   %esi
+  800849:	53                   	push   %ebx
+  80084a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80084d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800852:	8b 55 08             	mov    0x8(%ebp),%edx
+  800855:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800858:	b8 11 00 00 00       	mov    $0x11,%eax
+  80085d:	89 df                	mov    %ebx,%edi
+  80085f:	89 de                	mov    %ebx,%esi
+  800861:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800863:	85 c0                	test   %eax,%eax
+  800865:	7f 08                	jg     80086f <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800867:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80086a:	5b                   	pop    %ebx
+  80086b:	5e                   	pop    %esi
+  80086c:	5f                   	pop    %edi
+  80086d:	5d                   	pop    %ebp
+  80086e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80086f:	83 ec 0c             	sub    $0xc,%esp
+  800872:	50                   	push   %eax
+  800873:	6a 11                	push   $0x11
+  800875:	68 2f 27 80 00       	push   $0x80272f
+  80087a:	6a 23                	push   $0x23
+  80087c:	68 4c 27 80 00       	push   $0x80274c
+  800881:	e8 9c 12 00 00       	call   801b22 <_panic>
+
+00800886 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800886:	55                   	push   %ebp
+  800887:	89 e5                	mov    %esp,%ebp
+  800889:	57                   	push   %edi
+  80088a:	56                   	push   %esi
+  80088b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80088c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800891:	b8 12 00 00 00       	mov    $0x12,%eax
+  800896:	89 d1                	mov    %edx,%ecx
+  800898:	89 d3                	mov    %edx,%ebx
+  80089a:	89 d7                	mov    %edx,%edi
+  80089c:	89 d6                	mov    %edx,%esi
+  80089e:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  8008a0:	5b                   	pop    %ebx
+  8008a1:	5e                   	pop    %esi
+  8008a2:	5f                   	pop    %edi
+  8008a3:	5d                   	pop    %ebp
+  8008a4:	c3                   	ret
+
+008008a5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8008a5:	55                   	push   %ebp
+  8008a6:	89 e5                	mov    %esp,%ebp
+  8008a8:	57                   	push   %edi
+  8008a9:	56                   	push   %esi
+  8008aa:	53                   	push   %ebx
+  8008ab:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8008ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008b9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8008be:	89 df                	mov    %ebx,%edi
+  8008c0:	89 de                	mov    %ebx,%esi
+  8008c2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8008c4:	85 c0                	test   %eax,%eax
+  8008c6:	7f 08                	jg     8008d0 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8008c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008cb:	5b                   	pop    %ebx
+  8008cc:	5e                   	pop    %esi
+  8008cd:	5f                   	pop    %edi
+  8008ce:	5d                   	pop    %ebp
+  8008cf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8008d0:	83 ec 0c             	sub    $0xc,%esp
+  8008d3:	50                   	push   %eax
+  8008d4:	6a 13                	push   $0x13
+  8008d6:	68 2f 27 80 00       	push   $0x80272f
+  8008db:	6a 23                	push   $0x23
+  8008dd:	68 4c 27 80 00       	push   $0x80274c
+  8008e2:	e8 3b 12 00 00       	call   801b22 <_panic>
+
+008008e7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8008e7:	55                   	push   %ebp
+  8008e8:	89 e5                	mov    %esp,%ebp
+  8008ea:	57                   	push   %edi
+  8008eb:	56                   	push   %esi
+  8008ec:	53                   	push   %ebx
+  8008ed:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8008f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008fb:	b8 14 00 00 00       	mov    $0x14,%eax
+  800900:	89 df                	mov    %ebx,%edi
+  800902:	89 de                	mov    %ebx,%esi
+  800904:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800906:	85 c0                	test   %eax,%eax
+  800908:	7f 08                	jg     800912 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80090a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80090d:	5b                   	pop    %ebx
+  80090e:	5e                   	pop    %esi
+  80090f:	5f                   	pop    %edi
+  800910:	5d                   	pop    %ebp
+  800911:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800912:	83 ec 0c             	sub    $0xc,%esp
+  800915:	50                   	push   %eax
+  800916:	6a 14                	push   $0x14
+  800918:	68 2f 27 80 00       	push   $0x80272f
+  80091d:	6a 23                	push   $0x23
+  80091f:	68 4c 27 80 00       	push   $0x80274c
+  800924:	e8 f9 11 00 00       	call   801b22 <_panic>
+
+00800929 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800929:	55                   	push   %ebp
+  80092a:	89 e5                	mov    %esp,%ebp
+  80092c:	57                   	push   %edi
+  80092d:	56                   	push   %esi
+  80092e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80092f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800932:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800935:	b8 17 00 00 00       	mov    $0x17,%eax
+  80093a:	be 00 00 00 00       	mov    $0x0,%esi
+  80093f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800942:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800945:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800947:	5b                   	pop    %ebx
+  800948:	5e                   	pop    %esi
+  800949:	5f                   	pop    %edi
+  80094a:	5d                   	pop    %ebp
+  80094b:	c3                   	ret
+
+0080094c <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80094c:	55                   	push   %ebp
+  80094d:	89 e5                	mov    %esp,%ebp
+  80094f:	57                   	push   %edi
+  800950:	56                   	push   %esi
+  800951:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800952:	8b 55 08             	mov    0x8(%ebp),%edx
+  800955:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800958:	b8 18 00 00 00       	mov    $0x18,%eax
+  80095d:	be 00 00 00 00       	mov    $0x0,%esi
+  800962:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800965:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800968:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80096a:	5b                   	pop    %ebx
+  80096b:	5e                   	pop    %esi
+  80096c:	5f                   	pop    %edi
+  80096d:	5d                   	pop    %ebp
+  80096e:	c3                   	ret
+
+0080096f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80096f:	55                   	push   %ebp
+  800970:	89 e5                	mov    %esp,%ebp
+  800972:	57                   	push   %edi
+  800973:	56                   	push   %esi
+  800974:	53                   	push   %ebx
+  800975:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800978:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80097d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800980:	b8 19 00 00 00       	mov    $0x19,%eax
+  800985:	89 cb                	mov    %ecx,%ebx
+  800987:	89 cf                	mov    %ecx,%edi
+  800989:	89 ce                	mov    %ecx,%esi
+  80098b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80098d:	85 c0                	test   %eax,%eax
+  80098f:	7f 08                	jg     800999 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800991:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800994:	5b                   	pop    %ebx
+  800995:	5e                   	pop    %esi
+  800996:	5f                   	pop    %edi
+  800997:	5d                   	pop    %ebp
+  800998:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800999:	83 ec 0c             	sub    $0xc,%esp
+  80099c:	50                   	push   %eax
+  80099d:	6a 19                	push   $0x19
+  80099f:	68 2f 27 80 00       	push   $0x80272f
+  8009a4:	6a 23                	push   $0x23
+  8009a6:	68 4c 27 80 00       	push   $0x80274c
+  8009ab:	e8 72 11 00 00       	call   801b22 <_panic>
+
+008009b0 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8009b0:	55                   	push   %ebp
+  8009b1:	89 e5                	mov    %esp,%ebp
+  8009b3:	57                   	push   %edi
+  8009b4:	56                   	push   %esi
+  8009b5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8009b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009bb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8009c0:	89 d1                	mov    %edx,%ecx
+  8009c2:	89 d3                	mov    %edx,%ebx
+  8009c4:	89 d7                	mov    %edx,%edi
+  8009c6:	89 d6                	mov    %edx,%esi
+  8009c8:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8009ca:	5b                   	pop    %ebx
+  8009cb:	5e                   	pop    %esi
+  8009cc:	5f                   	pop    %edi
+  8009cd:	5d                   	pop    %ebp
+  8009ce:	c3                   	ret
+
+008009cf <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8009cf:	55                   	push   %ebp
+  8009d0:	89 e5                	mov    %esp,%ebp
+  8009d2:	57                   	push   %edi
+  8009d3:	56                   	push   %esi
+  8009d4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8009d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8009e5:	89 df                	mov    %ebx,%edi
+  8009e7:	89 de                	mov    %ebx,%esi
+  8009e9:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8009eb:	5b                   	pop    %ebx
+  8009ec:	5e                   	pop    %esi
+  8009ed:	5f                   	pop    %edi
+  8009ee:	5d                   	pop    %ebp
+  8009ef:	c3                   	ret
+
+008009f0 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	57                   	push   %edi
+  8009f4:	56                   	push   %esi
+  8009f5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8009f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a01:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800a06:	89 df                	mov    %ebx,%edi
+  800a08:	89 de                	mov    %ebx,%esi
+  800a0a:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  800a0c:	5b                   	pop    %ebx
+  800a0d:	5e                   	pop    %esi
+  800a0e:	5f                   	pop    %edi
+  800a0f:	5d                   	pop    %ebp
+  800a10:	c3                   	ret
+
+00800a11 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800a14:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a17:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a1c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800a1f:	5d                   	pop    %ebp
+  800a20:	c3                   	ret
+
+00800a21 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800a21:	55                   	push   %ebp
+  800a22:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800a24:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a27:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800a2c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800a31:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800a36:	5d                   	pop    %ebp
+  800a37:	c3                   	ret
+
+00800a38 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800a38:	55                   	push   %ebp
+  800a39:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800a3b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800a40:	eb 02                	jmp    800a44 <fd_alloc+0xc>
+  800a42:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800a44:	89 c2                	mov    %eax,%edx
+  800a46:	c1 ea 16             	shr    $0x16,%edx
+  800a49:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800a50:	f6 c2 01             	test   $0x1,%dl
+  800a53:	74 2b                	je     800a80 <fd_alloc+0x48>
+  800a55:	89 c2                	mov    %eax,%edx
+  800a57:	c1 ea 0c             	shr    $0xc,%edx
+  800a5a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800a61:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800a67:	f6 c1 01             	test   $0x1,%cl
+  800a6a:	74 14                	je     800a80 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800a6c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800a72:	75 ce                	jne    800a42 <fd_alloc+0xa>
+  800a74:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800a79:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800a7e:	eb 05                	jmp    800a85 <fd_alloc+0x4d>
+			return 0;
+  800a80:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800a85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a88:	89 02                	mov    %eax,(%edx)
+}
+  800a8a:	89 c8                	mov    %ecx,%eax
+  800a8c:	5d                   	pop    %ebp
+  800a8d:	c3                   	ret
+
+00800a8e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800a8e:	55                   	push   %ebp
+  800a8f:	89 e5                	mov    %esp,%ebp
+  800a91:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800a94:	83 f8 1f             	cmp    $0x1f,%eax
+  800a97:	77 30                	ja     800ac9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800a99:	c1 e0 0c             	shl    $0xc,%eax
+  800a9c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800aa1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800aa7:	f6 c2 01             	test   $0x1,%dl
+  800aaa:	74 24                	je     800ad0 <fd_lookup+0x42>
+  800aac:	89 c2                	mov    %eax,%edx
+  800aae:	c1 ea 0c             	shr    $0xc,%edx
+  800ab1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800ab8:	f6 c2 01             	test   $0x1,%dl
+  800abb:	74 1a                	je     800ad7 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800abd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ac0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ac7:	5d                   	pop    %ebp
+  800ac8:	c3                   	ret
+		return -E_INVAL;
+  800ac9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ace:	eb f7                	jmp    800ac7 <fd_lookup+0x39>
+		return -E_INVAL;
+  800ad0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad5:	eb f0                	jmp    800ac7 <fd_lookup+0x39>
+  800ad7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800adc:	eb e9                	jmp    800ac7 <fd_lookup+0x39>
+
+00800ade <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	53                   	push   %ebx
+  800ae2:	83 ec 04             	sub    $0x4,%esp
+  800ae5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aed:	eb 03                	jmp    800af2 <dev_lookup+0x14>
+  800aef:	83 c0 01             	add    $0x1,%eax
+  800af2:	8b 1c 85 d8 27 80 00 	mov    0x8027d8(,%eax,4),%ebx
+  800af9:	85 db                	test   %ebx,%ebx
+  800afb:	74 0b                	je     800b08 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800afd:	39 13                	cmp    %edx,(%ebx)
+  800aff:	75 ee                	jne    800aef <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b06:	eb 1f                	jmp    800b27 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b08:	a1 08 40 80 00       	mov    0x804008,%eax
+  800b0d:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800b10:	83 ec 04             	sub    $0x4,%esp
+  800b13:	52                   	push   %edx
+  800b14:	50                   	push   %eax
+  800b15:	68 5c 27 80 00       	push   $0x80275c
+  800b1a:	e8 de 10 00 00       	call   801bfd <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800b1f:	83 c4 10             	add    $0x10,%esp
+  800b22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800b27:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b2a:	89 1a                	mov    %ebx,(%edx)
+}
+  800b2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b2f:	c9                   	leave
+  800b30:	c3                   	ret
+
+00800b31 <fd_close>:
+{
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	57                   	push   %edi
+  800b35:	56                   	push   %esi
+  800b36:	53                   	push   %ebx
+  800b37:	83 ec 24             	sub    $0x24,%esp
+  800b3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b3d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800b40:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b43:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800b44:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800b4a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800b4d:	50                   	push   %eax
+  800b4e:	e8 3b ff ff ff       	call   800a8e <fd_lookup>
+  800b53:	89 c3                	mov    %eax,%ebx
+  800b55:	83 c4 10             	add    $0x10,%esp
+  800b58:	85 c0                	test   %eax,%eax
+  800b5a:	78 05                	js     800b61 <fd_close+0x30>
+	    || fd != fd2)
+  800b5c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800b5f:	74 16                	je     800b77 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800b61:	89 f8                	mov    %edi,%eax
+  800b63:	84 c0                	test   %al,%al
+  800b65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800b6d:	89 d8                	mov    %ebx,%eax
+  800b6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b72:	5b                   	pop    %ebx
+  800b73:	5e                   	pop    %esi
+  800b74:	5f                   	pop    %edi
+  800b75:	5d                   	pop    %ebp
+  800b76:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800b77:	83 ec 08             	sub    $0x8,%esp
+  800b7a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800b7d:	50                   	push   %eax
+  800b7e:	ff 36                	push   (%esi)
+  800b80:	e8 59 ff ff ff       	call   800ade <dev_lookup>
+  800b85:	89 c3                	mov    %eax,%ebx
+  800b87:	83 c4 10             	add    $0x10,%esp
+  800b8a:	85 c0                	test   %eax,%eax
+  800b8c:	78 1a                	js     800ba8 <fd_close+0x77>
+		if (dev->dev_close)
+  800b8e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b91:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800b94:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800b99:	85 c0                	test   %eax,%eax
+  800b9b:	74 0b                	je     800ba8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800b9d:	83 ec 0c             	sub    $0xc,%esp
+  800ba0:	56                   	push   %esi
+  800ba1:	ff d0                	call   *%eax
+  800ba3:	89 c3                	mov    %eax,%ebx
+  800ba5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800ba8:	83 ec 08             	sub    $0x8,%esp
+  800bab:	56                   	push   %esi
+  800bac:	6a 00                	push   $0x0
+  800bae:	e8 01 fb ff ff       	call   8006b4 <sys_page_unmap>
+	return r;
+  800bb3:	83 c4 10             	add    $0x10,%esp
+  800bb6:	eb b5                	jmp    800b6d <fd_close+0x3c>
+
+00800bb8 <close>:
+
+int
+close(int fdnum)
+{
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800bbe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bc1:	50                   	push   %eax
+  800bc2:	ff 75 08             	push   0x8(%ebp)
+  800bc5:	e8 c4 fe ff ff       	call   800a8e <fd_lookup>
+  800bca:	83 c4 10             	add    $0x10,%esp
+  800bcd:	85 c0                	test   %eax,%eax
+  800bcf:	79 02                	jns    800bd3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800bd1:	c9                   	leave
+  800bd2:	c3                   	ret
+		return fd_close(fd, 1);
+  800bd3:	83 ec 08             	sub    $0x8,%esp
+  800bd6:	6a 01                	push   $0x1
+  800bd8:	ff 75 f4             	push   -0xc(%ebp)
+  800bdb:	e8 51 ff ff ff       	call   800b31 <fd_close>
+  800be0:	83 c4 10             	add    $0x10,%esp
+  800be3:	eb ec                	jmp    800bd1 <close+0x19>
+
+00800be5 <close_all>:
+
+void
+close_all(void)
+{
+  800be5:	55                   	push   %ebp
+  800be6:	89 e5                	mov    %esp,%ebp
+  800be8:	53                   	push   %ebx
+  800be9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800bec:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800bf1:	83 ec 0c             	sub    $0xc,%esp
+  800bf4:	53                   	push   %ebx
+  800bf5:	e8 be ff ff ff       	call   800bb8 <close>
+	for (i = 0; i < MAXFD; i++)
+  800bfa:	83 c3 01             	add    $0x1,%ebx
+  800bfd:	83 c4 10             	add    $0x10,%esp
+  800c00:	83 fb 20             	cmp    $0x20,%ebx
+  800c03:	75 ec                	jne    800bf1 <close_all+0xc>
+}
+  800c05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c08:	c9                   	leave
+  800c09:	c3                   	ret
+
+00800c0a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800c0a:	55                   	push   %ebp
+  800c0b:	89 e5                	mov    %esp,%ebp
+  800c0d:	57                   	push   %edi
+  800c0e:	56                   	push   %esi
+  800c0f:	53                   	push   %ebx
+  800c10:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800c13:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c16:	50                   	push   %eax
+  800c17:	ff 75 08             	push   0x8(%ebp)
+  800c1a:	e8 6f fe ff ff       	call   800a8e <fd_lookup>
+  800c1f:	89 c3                	mov    %eax,%ebx
+  800c21:	83 c4 10             	add    $0x10,%esp
+  800c24:	85 c0                	test   %eax,%eax
+  800c26:	78 7f                	js     800ca7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800c28:	83 ec 0c             	sub    $0xc,%esp
+  800c2b:	ff 75 0c             	push   0xc(%ebp)
+  800c2e:	e8 85 ff ff ff       	call   800bb8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800c33:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c36:	c1 e6 0c             	shl    $0xc,%esi
+  800c39:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800c3f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c42:	89 3c 24             	mov    %edi,(%esp)
+  800c45:	e8 d7 fd ff ff       	call   800a21 <fd2data>
+  800c4a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800c4c:	89 34 24             	mov    %esi,(%esp)
+  800c4f:	e8 cd fd ff ff       	call   800a21 <fd2data>
+  800c54:	83 c4 10             	add    $0x10,%esp
+  800c57:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800c5a:	89 d8                	mov    %ebx,%eax
+  800c5c:	c1 e8 16             	shr    $0x16,%eax
+  800c5f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800c66:	a8 01                	test   $0x1,%al
+  800c68:	74 11                	je     800c7b <dup+0x71>
+  800c6a:	89 d8                	mov    %ebx,%eax
+  800c6c:	c1 e8 0c             	shr    $0xc,%eax
+  800c6f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800c76:	f6 c2 01             	test   $0x1,%dl
+  800c79:	75 36                	jne    800cb1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800c7b:	89 f8                	mov    %edi,%eax
+  800c7d:	c1 e8 0c             	shr    $0xc,%eax
+  800c80:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800c87:	83 ec 0c             	sub    $0xc,%esp
+  800c8a:	25 07 0e 00 00       	and    $0xe07,%eax
+  800c8f:	50                   	push   %eax
+  800c90:	56                   	push   %esi
+  800c91:	6a 00                	push   $0x0
+  800c93:	57                   	push   %edi
+  800c94:	6a 00                	push   $0x0
+  800c96:	e8 d7 f9 ff ff       	call   800672 <sys_page_map>
+  800c9b:	89 c3                	mov    %eax,%ebx
+  800c9d:	83 c4 20             	add    $0x20,%esp
+  800ca0:	85 c0                	test   %eax,%eax
+  800ca2:	78 33                	js     800cd7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800ca4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800ca7:	89 d8                	mov    %ebx,%eax
+  800ca9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cac:	5b                   	pop    %ebx
+  800cad:	5e                   	pop    %esi
+  800cae:	5f                   	pop    %edi
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800cb1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800cb8:	83 ec 0c             	sub    $0xc,%esp
+  800cbb:	25 07 0e 00 00       	and    $0xe07,%eax
+  800cc0:	50                   	push   %eax
+  800cc1:	ff 75 d4             	push   -0x2c(%ebp)
+  800cc4:	6a 00                	push   $0x0
+  800cc6:	53                   	push   %ebx
+  800cc7:	6a 00                	push   $0x0
+  800cc9:	e8 a4 f9 ff ff       	call   800672 <sys_page_map>
+  800cce:	89 c3                	mov    %eax,%ebx
+  800cd0:	83 c4 20             	add    $0x20,%esp
+  800cd3:	85 c0                	test   %eax,%eax
+  800cd5:	79 a4                	jns    800c7b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800cd7:	83 ec 08             	sub    $0x8,%esp
+  800cda:	56                   	push   %esi
+  800cdb:	6a 00                	push   $0x0
+  800cdd:	e8 d2 f9 ff ff       	call   8006b4 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800ce2:	83 c4 08             	add    $0x8,%esp
+  800ce5:	ff 75 d4             	push   -0x2c(%ebp)
+  800ce8:	6a 00                	push   $0x0
+  800cea:	e8 c5 f9 ff ff       	call   8006b4 <sys_page_unmap>
+	return r;
+  800cef:	83 c4 10             	add    $0x10,%esp
+  800cf2:	eb b3                	jmp    800ca7 <dup+0x9d>
+
+00800cf4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	56                   	push   %esi
+  800cf8:	53                   	push   %ebx
+  800cf9:	83 ec 18             	sub    $0x18,%esp
+  800cfc:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800cff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800d02:	50                   	push   %eax
+  800d03:	56                   	push   %esi
+  800d04:	e8 85 fd ff ff       	call   800a8e <fd_lookup>
+  800d09:	83 c4 10             	add    $0x10,%esp
+  800d0c:	85 c0                	test   %eax,%eax
+  800d0e:	78 3c                	js     800d4c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800d10:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800d13:	83 ec 08             	sub    $0x8,%esp
+  800d16:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d19:	50                   	push   %eax
+  800d1a:	ff 33                	push   (%ebx)
+  800d1c:	e8 bd fd ff ff       	call   800ade <dev_lookup>
+  800d21:	83 c4 10             	add    $0x10,%esp
+  800d24:	85 c0                	test   %eax,%eax
+  800d26:	78 24                	js     800d4c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800d28:	8b 43 08             	mov    0x8(%ebx),%eax
+  800d2b:	83 e0 03             	and    $0x3,%eax
+  800d2e:	83 f8 01             	cmp    $0x1,%eax
+  800d31:	74 20                	je     800d53 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800d33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d36:	8b 40 08             	mov    0x8(%eax),%eax
+  800d39:	85 c0                	test   %eax,%eax
+  800d3b:	74 37                	je     800d74 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800d3d:	83 ec 04             	sub    $0x4,%esp
+  800d40:	ff 75 10             	push   0x10(%ebp)
+  800d43:	ff 75 0c             	push   0xc(%ebp)
+  800d46:	53                   	push   %ebx
+  800d47:	ff d0                	call   *%eax
+  800d49:	83 c4 10             	add    $0x10,%esp
+}
+  800d4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d4f:	5b                   	pop    %ebx
+  800d50:	5e                   	pop    %esi
+  800d51:	5d                   	pop    %ebp
+  800d52:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d53:	a1 08 40 80 00       	mov    0x804008,%eax
+  800d58:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800d5b:	83 ec 04             	sub    $0x4,%esp
+  800d5e:	56                   	push   %esi
+  800d5f:	50                   	push   %eax
+  800d60:	68 9d 27 80 00       	push   $0x80279d
+  800d65:	e8 93 0e 00 00       	call   801bfd <cprintf>
+		return -E_INVAL;
+  800d6a:	83 c4 10             	add    $0x10,%esp
+  800d6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d72:	eb d8                	jmp    800d4c <read+0x58>
+		return -E_NOT_SUPP;
+  800d74:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d79:	eb d1                	jmp    800d4c <read+0x58>
+
+00800d7b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	57                   	push   %edi
+  800d7f:	56                   	push   %esi
+  800d80:	53                   	push   %ebx
+  800d81:	83 ec 0c             	sub    $0xc,%esp
+  800d84:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d87:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800d8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d8f:	eb 02                	jmp    800d93 <readn+0x18>
+  800d91:	01 c3                	add    %eax,%ebx
+  800d93:	39 f3                	cmp    %esi,%ebx
+  800d95:	73 21                	jae    800db8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800d97:	83 ec 04             	sub    $0x4,%esp
+  800d9a:	89 f0                	mov    %esi,%eax
+  800d9c:	29 d8                	sub    %ebx,%eax
+  800d9e:	50                   	push   %eax
+  800d9f:	89 d8                	mov    %ebx,%eax
+  800da1:	03 45 0c             	add    0xc(%ebp),%eax
+  800da4:	50                   	push   %eax
+  800da5:	57                   	push   %edi
+  800da6:	e8 49 ff ff ff       	call   800cf4 <read>
+		if (m < 0)
+  800dab:	83 c4 10             	add    $0x10,%esp
+  800dae:	85 c0                	test   %eax,%eax
+  800db0:	78 04                	js     800db6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800db2:	75 dd                	jne    800d91 <readn+0x16>
+  800db4:	eb 02                	jmp    800db8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800db6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800db8:	89 d8                	mov    %ebx,%eax
+  800dba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbd:	5b                   	pop    %ebx
+  800dbe:	5e                   	pop    %esi
+  800dbf:	5f                   	pop    %edi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+
+00800dc2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	56                   	push   %esi
+  800dc6:	53                   	push   %ebx
+  800dc7:	83 ec 18             	sub    $0x18,%esp
+  800dca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800dcd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800dd0:	50                   	push   %eax
+  800dd1:	53                   	push   %ebx
+  800dd2:	e8 b7 fc ff ff       	call   800a8e <fd_lookup>
+  800dd7:	83 c4 10             	add    $0x10,%esp
+  800dda:	85 c0                	test   %eax,%eax
+  800ddc:	78 37                	js     800e15 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800dde:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800de1:	83 ec 08             	sub    $0x8,%esp
+  800de4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800de7:	50                   	push   %eax
+  800de8:	ff 36                	push   (%esi)
+  800dea:	e8 ef fc ff ff       	call   800ade <dev_lookup>
+  800def:	83 c4 10             	add    $0x10,%esp
+  800df2:	85 c0                	test   %eax,%eax
+  800df4:	78 1f                	js     800e15 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800df6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800dfa:	74 20                	je     800e1c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800dfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800dff:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e02:	85 c0                	test   %eax,%eax
+  800e04:	74 37                	je     800e3d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800e06:	83 ec 04             	sub    $0x4,%esp
+  800e09:	ff 75 10             	push   0x10(%ebp)
+  800e0c:	ff 75 0c             	push   0xc(%ebp)
+  800e0f:	56                   	push   %esi
+  800e10:	ff d0                	call   *%eax
+  800e12:	83 c4 10             	add    $0x10,%esp
+}
+  800e15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e18:	5b                   	pop    %ebx
+  800e19:	5e                   	pop    %esi
+  800e1a:	5d                   	pop    %ebp
+  800e1b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e1c:	a1 08 40 80 00       	mov    0x804008,%eax
+  800e21:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800e24:	83 ec 04             	sub    $0x4,%esp
+  800e27:	53                   	push   %ebx
+  800e28:	50                   	push   %eax
+  800e29:	68 b9 27 80 00       	push   $0x8027b9
+  800e2e:	e8 ca 0d 00 00       	call   801bfd <cprintf>
+		return -E_INVAL;
+  800e33:	83 c4 10             	add    $0x10,%esp
+  800e36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e3b:	eb d8                	jmp    800e15 <write+0x53>
+		return -E_NOT_SUPP;
+  800e3d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e42:	eb d1                	jmp    800e15 <write+0x53>
+
+00800e44 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800e44:	55                   	push   %ebp
+  800e45:	89 e5                	mov    %esp,%ebp
+  800e47:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e4a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e4d:	50                   	push   %eax
+  800e4e:	ff 75 08             	push   0x8(%ebp)
+  800e51:	e8 38 fc ff ff       	call   800a8e <fd_lookup>
+  800e56:	83 c4 10             	add    $0x10,%esp
+  800e59:	85 c0                	test   %eax,%eax
+  800e5b:	78 0e                	js     800e6b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800e5d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e63:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800e66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e6b:	c9                   	leave
+  800e6c:	c3                   	ret
+
+00800e6d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800e6d:	55                   	push   %ebp
+  800e6e:	89 e5                	mov    %esp,%ebp
+  800e70:	56                   	push   %esi
+  800e71:	53                   	push   %ebx
+  800e72:	83 ec 18             	sub    $0x18,%esp
+  800e75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800e78:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e7b:	50                   	push   %eax
+  800e7c:	53                   	push   %ebx
+  800e7d:	e8 0c fc ff ff       	call   800a8e <fd_lookup>
+  800e82:	83 c4 10             	add    $0x10,%esp
+  800e85:	85 c0                	test   %eax,%eax
+  800e87:	78 34                	js     800ebd <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800e89:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e8c:	83 ec 08             	sub    $0x8,%esp
+  800e8f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e92:	50                   	push   %eax
+  800e93:	ff 36                	push   (%esi)
+  800e95:	e8 44 fc ff ff       	call   800ade <dev_lookup>
+  800e9a:	83 c4 10             	add    $0x10,%esp
+  800e9d:	85 c0                	test   %eax,%eax
+  800e9f:	78 1c                	js     800ebd <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ea1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ea5:	74 1d                	je     800ec4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800ea7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eaa:	8b 40 18             	mov    0x18(%eax),%eax
+  800ead:	85 c0                	test   %eax,%eax
+  800eaf:	74 34                	je     800ee5 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800eb1:	83 ec 08             	sub    $0x8,%esp
+  800eb4:	ff 75 0c             	push   0xc(%ebp)
+  800eb7:	56                   	push   %esi
+  800eb8:	ff d0                	call   *%eax
+  800eba:	83 c4 10             	add    $0x10,%esp
+}
+  800ebd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5d                   	pop    %ebp
+  800ec3:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800ec4:	a1 08 40 80 00       	mov    0x804008,%eax
+  800ec9:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ecc:	83 ec 04             	sub    $0x4,%esp
+  800ecf:	53                   	push   %ebx
+  800ed0:	50                   	push   %eax
+  800ed1:	68 7c 27 80 00       	push   $0x80277c
+  800ed6:	e8 22 0d 00 00       	call   801bfd <cprintf>
+		return -E_INVAL;
+  800edb:	83 c4 10             	add    $0x10,%esp
+  800ede:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ee3:	eb d8                	jmp    800ebd <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800ee5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800eea:	eb d1                	jmp    800ebd <ftruncate+0x50>
+
+00800eec <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	56                   	push   %esi
+  800ef0:	53                   	push   %ebx
+  800ef1:	83 ec 18             	sub    $0x18,%esp
+  800ef4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ef7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800efa:	50                   	push   %eax
+  800efb:	ff 75 08             	push   0x8(%ebp)
+  800efe:	e8 8b fb ff ff       	call   800a8e <fd_lookup>
+  800f03:	83 c4 10             	add    $0x10,%esp
+  800f06:	85 c0                	test   %eax,%eax
+  800f08:	78 49                	js     800f53 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800f0a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f0d:	83 ec 08             	sub    $0x8,%esp
+  800f10:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f13:	50                   	push   %eax
+  800f14:	ff 36                	push   (%esi)
+  800f16:	e8 c3 fb ff ff       	call   800ade <dev_lookup>
+  800f1b:	83 c4 10             	add    $0x10,%esp
+  800f1e:	85 c0                	test   %eax,%eax
+  800f20:	78 31                	js     800f53 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800f22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f25:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800f29:	74 2f                	je     800f5a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800f2b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800f2e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800f35:	00 00 00 
+	stat->st_isdir = 0;
+  800f38:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800f3f:	00 00 00 
+	stat->st_dev = dev;
+  800f42:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800f48:	83 ec 08             	sub    $0x8,%esp
+  800f4b:	53                   	push   %ebx
+  800f4c:	56                   	push   %esi
+  800f4d:	ff 50 14             	call   *0x14(%eax)
+  800f50:	83 c4 10             	add    $0x10,%esp
+}
+  800f53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f56:	5b                   	pop    %ebx
+  800f57:	5e                   	pop    %esi
+  800f58:	5d                   	pop    %ebp
+  800f59:	c3                   	ret
+		return -E_NOT_SUPP;
+  800f5a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f5f:	eb f2                	jmp    800f53 <fstat+0x67>
+
+00800f61 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	56                   	push   %esi
+  800f65:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800f66:	83 ec 08             	sub    $0x8,%esp
+  800f69:	6a 00                	push   $0x0
+  800f6b:	ff 75 08             	push   0x8(%ebp)
+  800f6e:	e8 e4 01 00 00       	call   801157 <open>
+  800f73:	89 c3                	mov    %eax,%ebx
+  800f75:	83 c4 10             	add    $0x10,%esp
+  800f78:	85 c0                	test   %eax,%eax
+  800f7a:	78 1b                	js     800f97 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800f7c:	83 ec 08             	sub    $0x8,%esp
+  800f7f:	ff 75 0c             	push   0xc(%ebp)
+  800f82:	50                   	push   %eax
+  800f83:	e8 64 ff ff ff       	call   800eec <fstat>
+  800f88:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800f8a:	89 1c 24             	mov    %ebx,(%esp)
+  800f8d:	e8 26 fc ff ff       	call   800bb8 <close>
+	return r;
+  800f92:	83 c4 10             	add    $0x10,%esp
+  800f95:	89 f3                	mov    %esi,%ebx
+}
+  800f97:	89 d8                	mov    %ebx,%eax
+  800f99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f9c:	5b                   	pop    %ebx
+  800f9d:	5e                   	pop    %esi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+
+00800fa0 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	56                   	push   %esi
+  800fa4:	53                   	push   %ebx
+  800fa5:	89 c6                	mov    %eax,%esi
+  800fa7:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800fa9:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800fb0:	74 27                	je     800fd9 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800fb2:	6a 07                	push   $0x7
+  800fb4:	68 00 50 80 00       	push   $0x805000
+  800fb9:	56                   	push   %esi
+  800fba:	ff 35 00 40 80 00    	push   0x804000
+  800fc0:	e8 63 12 00 00       	call   802228 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800fc5:	83 c4 0c             	add    $0xc,%esp
+  800fc8:	6a 00                	push   $0x0
+  800fca:	53                   	push   %ebx
+  800fcb:	6a 00                	push   $0x0
+  800fcd:	e8 de 11 00 00       	call   8021b0 <ipc_recv>
+}
+  800fd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fd5:	5b                   	pop    %ebx
+  800fd6:	5e                   	pop    %esi
+  800fd7:	5d                   	pop    %ebp
+  800fd8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800fd9:	83 ec 0c             	sub    $0xc,%esp
+  800fdc:	6a 01                	push   $0x1
+  800fde:	e8 99 12 00 00       	call   80227c <ipc_find_env>
+  800fe3:	a3 00 40 80 00       	mov    %eax,0x804000
+  800fe8:	83 c4 10             	add    $0x10,%esp
+  800feb:	eb c5                	jmp    800fb2 <fsipc+0x12>
+
+00800fed <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800ff3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ff6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ff9:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800ffe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801001:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801006:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801010:	e8 8b ff ff ff       	call   800fa0 <fsipc>
+}
+  801015:	c9                   	leave
+  801016:	c3                   	ret
+
+00801017 <devfile_flush>:
+{
+  801017:	55                   	push   %ebp
+  801018:	89 e5                	mov    %esp,%ebp
+  80101a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80101d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801020:	8b 40 0c             	mov    0xc(%eax),%eax
+  801023:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801028:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801032:	e8 69 ff ff ff       	call   800fa0 <fsipc>
+}
+  801037:	c9                   	leave
+  801038:	c3                   	ret
+
+00801039 <devfile_stat>:
+{
+  801039:	55                   	push   %ebp
+  80103a:	89 e5                	mov    %esp,%ebp
+  80103c:	53                   	push   %ebx
+  80103d:	83 ec 04             	sub    $0x4,%esp
+  801040:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801043:	8b 45 08             	mov    0x8(%ebp),%eax
+  801046:	8b 40 0c             	mov    0xc(%eax),%eax
+  801049:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80104e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801053:	b8 05 00 00 00       	mov    $0x5,%eax
+  801058:	e8 43 ff ff ff       	call   800fa0 <fsipc>
+  80105d:	85 c0                	test   %eax,%eax
+  80105f:	78 2c                	js     80108d <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801061:	83 ec 08             	sub    $0x8,%esp
+  801064:	68 00 50 80 00       	push   $0x805000
+  801069:	53                   	push   %ebx
+  80106a:	e8 10 f1 ff ff       	call   80017f <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80106f:	a1 80 50 80 00       	mov    0x805080,%eax
+  801074:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80107a:	a1 84 50 80 00       	mov    0x805084,%eax
+  80107f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801085:	83 c4 10             	add    $0x10,%esp
+  801088:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80108d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801090:	c9                   	leave
+  801091:	c3                   	ret
+
+00801092 <devfile_write>:
+{
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	83 ec 0c             	sub    $0xc,%esp
+  801098:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80109b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8010a0:	39 d0                	cmp    %edx,%eax
+  8010a2:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a8:	8b 52 0c             	mov    0xc(%edx),%edx
+  8010ab:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  8010b1:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8010b6:	50                   	push   %eax
+  8010b7:	ff 75 0c             	push   0xc(%ebp)
+  8010ba:	68 08 50 80 00       	push   $0x805008
+  8010bf:	e8 41 f2 ff ff       	call   800305 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8010c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010ce:	e8 cd fe ff ff       	call   800fa0 <fsipc>
+}
+  8010d3:	c9                   	leave
+  8010d4:	c3                   	ret
+
+008010d5 <devfile_read>:
+{
+  8010d5:	55                   	push   %ebp
+  8010d6:	89 e5                	mov    %esp,%ebp
+  8010d8:	56                   	push   %esi
+  8010d9:	53                   	push   %ebx
+  8010da:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010e0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8010e3:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  8010e8:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8010ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010f8:	e8 a3 fe ff ff       	call   800fa0 <fsipc>
+  8010fd:	89 c3                	mov    %eax,%ebx
+  8010ff:	85 c0                	test   %eax,%eax
+  801101:	78 1f                	js     801122 <devfile_read+0x4d>
+	assert(r <= n);
+  801103:	39 c6                	cmp    %eax,%esi
+  801105:	72 24                	jb     80112b <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801107:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80110c:	7f 33                	jg     801141 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80110e:	83 ec 04             	sub    $0x4,%esp
+  801111:	50                   	push   %eax
+  801112:	68 00 50 80 00       	push   $0x805000
+  801117:	ff 75 0c             	push   0xc(%ebp)
+  80111a:	e8 e6 f1 ff ff       	call   800305 <memmove>
+	return r;
+  80111f:	83 c4 10             	add    $0x10,%esp
+}
+  801122:	89 d8                	mov    %ebx,%eax
+  801124:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801127:	5b                   	pop    %ebx
+  801128:	5e                   	pop    %esi
+  801129:	5d                   	pop    %ebp
+  80112a:	c3                   	ret
+	assert(r <= n);
+  80112b:	68 ec 27 80 00       	push   $0x8027ec
+  801130:	68 f3 27 80 00       	push   $0x8027f3
+  801135:	6a 7c                	push   $0x7c
+  801137:	68 08 28 80 00       	push   $0x802808
+  80113c:	e8 e1 09 00 00       	call   801b22 <_panic>
+	assert(r <= PGSIZE);
+  801141:	68 13 28 80 00       	push   $0x802813
+  801146:	68 f3 27 80 00       	push   $0x8027f3
+  80114b:	6a 7d                	push   $0x7d
+  80114d:	68 08 28 80 00       	push   $0x802808
+  801152:	e8 cb 09 00 00       	call   801b22 <_panic>
+
+00801157 <open>:
+{
+  801157:	55                   	push   %ebp
+  801158:	89 e5                	mov    %esp,%ebp
+  80115a:	56                   	push   %esi
+  80115b:	53                   	push   %ebx
+  80115c:	83 ec 1c             	sub    $0x1c,%esp
+  80115f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801162:	56                   	push   %esi
+  801163:	e8 dc ef ff ff       	call   800144 <strlen>
+  801168:	83 c4 10             	add    $0x10,%esp
+  80116b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801170:	7f 6c                	jg     8011de <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801172:	83 ec 0c             	sub    $0xc,%esp
+  801175:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801178:	50                   	push   %eax
+  801179:	e8 ba f8 ff ff       	call   800a38 <fd_alloc>
+  80117e:	89 c3                	mov    %eax,%ebx
+  801180:	83 c4 10             	add    $0x10,%esp
+  801183:	85 c0                	test   %eax,%eax
+  801185:	78 3c                	js     8011c3 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801187:	83 ec 08             	sub    $0x8,%esp
+  80118a:	56                   	push   %esi
+  80118b:	68 00 50 80 00       	push   $0x805000
+  801190:	e8 ea ef ff ff       	call   80017f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801195:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801198:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80119d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8011a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011a5:	e8 f6 fd ff ff       	call   800fa0 <fsipc>
+  8011aa:	89 c3                	mov    %eax,%ebx
+  8011ac:	83 c4 10             	add    $0x10,%esp
+  8011af:	85 c0                	test   %eax,%eax
+  8011b1:	78 19                	js     8011cc <open+0x75>
+	return fd2num(fd);
+  8011b3:	83 ec 0c             	sub    $0xc,%esp
+  8011b6:	ff 75 f4             	push   -0xc(%ebp)
+  8011b9:	e8 53 f8 ff ff       	call   800a11 <fd2num>
+  8011be:	89 c3                	mov    %eax,%ebx
+  8011c0:	83 c4 10             	add    $0x10,%esp
+}
+  8011c3:	89 d8                	mov    %ebx,%eax
+  8011c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011c8:	5b                   	pop    %ebx
+  8011c9:	5e                   	pop    %esi
+  8011ca:	5d                   	pop    %ebp
+  8011cb:	c3                   	ret
+		fd_close(fd, 0);
+  8011cc:	83 ec 08             	sub    $0x8,%esp
+  8011cf:	6a 00                	push   $0x0
+  8011d1:	ff 75 f4             	push   -0xc(%ebp)
+  8011d4:	e8 58 f9 ff ff       	call   800b31 <fd_close>
+		return r;
+  8011d9:	83 c4 10             	add    $0x10,%esp
+  8011dc:	eb e5                	jmp    8011c3 <open+0x6c>
+		return -E_BAD_PATH;
+  8011de:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8011e3:	eb de                	jmp    8011c3 <open+0x6c>
+
+008011e5 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8011e5:	55                   	push   %ebp
+  8011e6:	89 e5                	mov    %esp,%ebp
+  8011e8:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8011eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011f5:	e8 a6 fd ff ff       	call   800fa0 <fsipc>
+}
+  8011fa:	c9                   	leave
+  8011fb:	c3                   	ret
+
+008011fc <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8011fc:	55                   	push   %ebp
+  8011fd:	89 e5                	mov    %esp,%ebp
+  8011ff:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801202:	68 1f 28 80 00       	push   $0x80281f
+  801207:	ff 75 0c             	push   0xc(%ebp)
+  80120a:	e8 70 ef ff ff       	call   80017f <strcpy>
+	return 0;
+}
+  80120f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801214:	c9                   	leave
+  801215:	c3                   	ret
+
+00801216 <devsock_close>:
+{
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	53                   	push   %ebx
+  80121a:	83 ec 10             	sub    $0x10,%esp
+  80121d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801220:	53                   	push   %ebx
+  801221:	e8 66 10 00 00       	call   80228c <pageref>
+  801226:	89 c2                	mov    %eax,%edx
+  801228:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80122b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801230:	83 fa 01             	cmp    $0x1,%edx
+  801233:	74 05                	je     80123a <devsock_close+0x24>
+}
+  801235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801238:	c9                   	leave
+  801239:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80123a:	83 ec 0c             	sub    $0xc,%esp
+  80123d:	ff 73 0c             	push   0xc(%ebx)
+  801240:	e8 b7 02 00 00       	call   8014fc <nsipc_close>
+  801245:	83 c4 10             	add    $0x10,%esp
+  801248:	eb eb                	jmp    801235 <devsock_close+0x1f>
+
+0080124a <devsock_write>:
+{
+  80124a:	55                   	push   %ebp
+  80124b:	89 e5                	mov    %esp,%ebp
+  80124d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801250:	6a 00                	push   $0x0
+  801252:	ff 75 10             	push   0x10(%ebp)
+  801255:	ff 75 0c             	push   0xc(%ebp)
+  801258:	8b 45 08             	mov    0x8(%ebp),%eax
+  80125b:	ff 70 0c             	push   0xc(%eax)
+  80125e:	e8 79 03 00 00       	call   8015dc <nsipc_send>
+}
+  801263:	c9                   	leave
+  801264:	c3                   	ret
+
+00801265 <devsock_read>:
+{
+  801265:	55                   	push   %ebp
+  801266:	89 e5                	mov    %esp,%ebp
+  801268:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80126b:	6a 00                	push   $0x0
+  80126d:	ff 75 10             	push   0x10(%ebp)
+  801270:	ff 75 0c             	push   0xc(%ebp)
+  801273:	8b 45 08             	mov    0x8(%ebp),%eax
+  801276:	ff 70 0c             	push   0xc(%eax)
+  801279:	e8 ef 02 00 00       	call   80156d <nsipc_recv>
+}
+  80127e:	c9                   	leave
+  80127f:	c3                   	ret
+
+00801280 <fd2sockid>:
+{
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801286:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801289:	52                   	push   %edx
+  80128a:	50                   	push   %eax
+  80128b:	e8 fe f7 ff ff       	call   800a8e <fd_lookup>
+  801290:	83 c4 10             	add    $0x10,%esp
+  801293:	85 c0                	test   %eax,%eax
+  801295:	78 10                	js     8012a7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801297:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80129a:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  8012a0:	39 08                	cmp    %ecx,(%eax)
+  8012a2:	75 05                	jne    8012a9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8012a4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8012a7:	c9                   	leave
+  8012a8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8012a9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012ae:	eb f7                	jmp    8012a7 <fd2sockid+0x27>
+
+008012b0 <alloc_sockfd>:
+{
+  8012b0:	55                   	push   %ebp
+  8012b1:	89 e5                	mov    %esp,%ebp
+  8012b3:	56                   	push   %esi
+  8012b4:	53                   	push   %ebx
+  8012b5:	83 ec 1c             	sub    $0x1c,%esp
+  8012b8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8012ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012bd:	50                   	push   %eax
+  8012be:	e8 75 f7 ff ff       	call   800a38 <fd_alloc>
+  8012c3:	89 c3                	mov    %eax,%ebx
+  8012c5:	83 c4 10             	add    $0x10,%esp
+  8012c8:	85 c0                	test   %eax,%eax
+  8012ca:	78 43                	js     80130f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8012cc:	83 ec 04             	sub    $0x4,%esp
+  8012cf:	68 07 04 00 00       	push   $0x407
+  8012d4:	ff 75 f4             	push   -0xc(%ebp)
+  8012d7:	6a 00                	push   $0x0
+  8012d9:	e8 0e f3 ff ff       	call   8005ec <sys_page_alloc>
+  8012de:	89 c3                	mov    %eax,%ebx
+  8012e0:	83 c4 10             	add    $0x10,%esp
+  8012e3:	85 c0                	test   %eax,%eax
+  8012e5:	78 28                	js     80130f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8012e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012ea:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8012f0:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8012f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012f5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8012fc:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8012ff:	83 ec 0c             	sub    $0xc,%esp
+  801302:	50                   	push   %eax
+  801303:	e8 09 f7 ff ff       	call   800a11 <fd2num>
+  801308:	89 c3                	mov    %eax,%ebx
+  80130a:	83 c4 10             	add    $0x10,%esp
+  80130d:	eb 0c                	jmp    80131b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80130f:	83 ec 0c             	sub    $0xc,%esp
+  801312:	56                   	push   %esi
+  801313:	e8 e4 01 00 00       	call   8014fc <nsipc_close>
+		return r;
+  801318:	83 c4 10             	add    $0x10,%esp
+}
+  80131b:	89 d8                	mov    %ebx,%eax
+  80131d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801320:	5b                   	pop    %ebx
+  801321:	5e                   	pop    %esi
+  801322:	5d                   	pop    %ebp
+  801323:	c3                   	ret
+
+00801324 <accept>:
+{
+  801324:	55                   	push   %ebp
+  801325:	89 e5                	mov    %esp,%ebp
+  801327:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80132a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80132d:	e8 4e ff ff ff       	call   801280 <fd2sockid>
+  801332:	85 c0                	test   %eax,%eax
+  801334:	78 1b                	js     801351 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801336:	83 ec 04             	sub    $0x4,%esp
+  801339:	ff 75 10             	push   0x10(%ebp)
+  80133c:	ff 75 0c             	push   0xc(%ebp)
+  80133f:	50                   	push   %eax
+  801340:	e8 0e 01 00 00       	call   801453 <nsipc_accept>
+  801345:	83 c4 10             	add    $0x10,%esp
+  801348:	85 c0                	test   %eax,%eax
+  80134a:	78 05                	js     801351 <accept+0x2d>
+	return alloc_sockfd(r);
+  80134c:	e8 5f ff ff ff       	call   8012b0 <alloc_sockfd>
+}
+  801351:	c9                   	leave
+  801352:	c3                   	ret
+
+00801353 <bind>:
+{
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801359:	8b 45 08             	mov    0x8(%ebp),%eax
+  80135c:	e8 1f ff ff ff       	call   801280 <fd2sockid>
+  801361:	85 c0                	test   %eax,%eax
+  801363:	78 12                	js     801377 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801365:	83 ec 04             	sub    $0x4,%esp
+  801368:	ff 75 10             	push   0x10(%ebp)
+  80136b:	ff 75 0c             	push   0xc(%ebp)
+  80136e:	50                   	push   %eax
+  80136f:	e8 31 01 00 00       	call   8014a5 <nsipc_bind>
+  801374:	83 c4 10             	add    $0x10,%esp
+}
+  801377:	c9                   	leave
+  801378:	c3                   	ret
+
+00801379 <shutdown>:
+{
+  801379:	55                   	push   %ebp
+  80137a:	89 e5                	mov    %esp,%ebp
+  80137c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80137f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801382:	e8 f9 fe ff ff       	call   801280 <fd2sockid>
+  801387:	85 c0                	test   %eax,%eax
+  801389:	78 0f                	js     80139a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80138b:	83 ec 08             	sub    $0x8,%esp
+  80138e:	ff 75 0c             	push   0xc(%ebp)
+  801391:	50                   	push   %eax
+  801392:	e8 43 01 00 00       	call   8014da <nsipc_shutdown>
+  801397:	83 c4 10             	add    $0x10,%esp
+}
+  80139a:	c9                   	leave
+  80139b:	c3                   	ret
+
+0080139c <connect>:
+{
+  80139c:	55                   	push   %ebp
+  80139d:	89 e5                	mov    %esp,%ebp
+  80139f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8013a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013a5:	e8 d6 fe ff ff       	call   801280 <fd2sockid>
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	78 12                	js     8013c0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8013ae:	83 ec 04             	sub    $0x4,%esp
+  8013b1:	ff 75 10             	push   0x10(%ebp)
+  8013b4:	ff 75 0c             	push   0xc(%ebp)
+  8013b7:	50                   	push   %eax
+  8013b8:	e8 59 01 00 00       	call   801516 <nsipc_connect>
+  8013bd:	83 c4 10             	add    $0x10,%esp
+}
+  8013c0:	c9                   	leave
+  8013c1:	c3                   	ret
+
+008013c2 <listen>:
+{
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8013c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013cb:	e8 b0 fe ff ff       	call   801280 <fd2sockid>
+  8013d0:	85 c0                	test   %eax,%eax
+  8013d2:	78 0f                	js     8013e3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8013d4:	83 ec 08             	sub    $0x8,%esp
+  8013d7:	ff 75 0c             	push   0xc(%ebp)
+  8013da:	50                   	push   %eax
+  8013db:	e8 6b 01 00 00       	call   80154b <nsipc_listen>
+  8013e0:	83 c4 10             	add    $0x10,%esp
+}
+  8013e3:	c9                   	leave
+  8013e4:	c3                   	ret
+
+008013e5 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8013e5:	55                   	push   %ebp
+  8013e6:	89 e5                	mov    %esp,%ebp
+  8013e8:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8013eb:	ff 75 10             	push   0x10(%ebp)
+  8013ee:	ff 75 0c             	push   0xc(%ebp)
+  8013f1:	ff 75 08             	push   0x8(%ebp)
+  8013f4:	e8 41 02 00 00       	call   80163a <nsipc_socket>
+  8013f9:	83 c4 10             	add    $0x10,%esp
+  8013fc:	85 c0                	test   %eax,%eax
+  8013fe:	78 05                	js     801405 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801400:	e8 ab fe ff ff       	call   8012b0 <alloc_sockfd>
+}
+  801405:	c9                   	leave
+  801406:	c3                   	ret
+
+00801407 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801407:	55                   	push   %ebp
+  801408:	89 e5                	mov    %esp,%ebp
+  80140a:	53                   	push   %ebx
+  80140b:	83 ec 04             	sub    $0x4,%esp
+  80140e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801410:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801417:	74 26                	je     80143f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801419:	6a 07                	push   $0x7
+  80141b:	68 00 60 80 00       	push   $0x806000
+  801420:	53                   	push   %ebx
+  801421:	ff 35 04 40 80 00    	push   0x804004
+  801427:	e8 fc 0d 00 00       	call   802228 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80142c:	83 c4 0c             	add    $0xc,%esp
+  80142f:	6a 00                	push   $0x0
+  801431:	6a 00                	push   $0x0
+  801433:	6a 00                	push   $0x0
+  801435:	e8 76 0d 00 00       	call   8021b0 <ipc_recv>
+}
+  80143a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80143d:	c9                   	leave
+  80143e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80143f:	83 ec 0c             	sub    $0xc,%esp
+  801442:	6a 02                	push   $0x2
+  801444:	e8 33 0e 00 00       	call   80227c <ipc_find_env>
+  801449:	a3 04 40 80 00       	mov    %eax,0x804004
+  80144e:	83 c4 10             	add    $0x10,%esp
+  801451:	eb c6                	jmp    801419 <nsipc+0x12>
+
+00801453 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801453:	55                   	push   %ebp
+  801454:	89 e5                	mov    %esp,%ebp
+  801456:	56                   	push   %esi
+  801457:	53                   	push   %ebx
+  801458:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80145b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80145e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801463:	8b 06                	mov    (%esi),%eax
+  801465:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80146a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80146f:	e8 93 ff ff ff       	call   801407 <nsipc>
+  801474:	89 c3                	mov    %eax,%ebx
+  801476:	85 c0                	test   %eax,%eax
+  801478:	79 09                	jns    801483 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80147a:	89 d8                	mov    %ebx,%eax
+  80147c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80147f:	5b                   	pop    %ebx
+  801480:	5e                   	pop    %esi
+  801481:	5d                   	pop    %ebp
+  801482:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801483:	83 ec 04             	sub    $0x4,%esp
+  801486:	ff 35 10 60 80 00    	push   0x806010
+  80148c:	68 00 60 80 00       	push   $0x806000
+  801491:	ff 75 0c             	push   0xc(%ebp)
+  801494:	e8 6c ee ff ff       	call   800305 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801499:	a1 10 60 80 00       	mov    0x806010,%eax
+  80149e:	89 06                	mov    %eax,(%esi)
+  8014a0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8014a3:	eb d5                	jmp    80147a <nsipc_accept+0x27>
+
+008014a5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	53                   	push   %ebx
+  8014a9:	83 ec 08             	sub    $0x8,%esp
+  8014ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8014af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014b2:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8014b7:	53                   	push   %ebx
+  8014b8:	ff 75 0c             	push   0xc(%ebp)
+  8014bb:	68 04 60 80 00       	push   $0x806004
+  8014c0:	e8 40 ee ff ff       	call   800305 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8014c5:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8014cb:	b8 02 00 00 00       	mov    $0x2,%eax
+  8014d0:	e8 32 ff ff ff       	call   801407 <nsipc>
+}
+  8014d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014d8:	c9                   	leave
+  8014d9:	c3                   	ret
+
+008014da <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8014da:	55                   	push   %ebp
+  8014db:	89 e5                	mov    %esp,%ebp
+  8014dd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8014e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014e3:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8014e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014eb:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8014f0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014f5:	e8 0d ff ff ff       	call   801407 <nsipc>
+}
+  8014fa:	c9                   	leave
+  8014fb:	c3                   	ret
+
+008014fc <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8014fc:	55                   	push   %ebp
+  8014fd:	89 e5                	mov    %esp,%ebp
+  8014ff:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801502:	8b 45 08             	mov    0x8(%ebp),%eax
+  801505:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  80150a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80150f:	e8 f3 fe ff ff       	call   801407 <nsipc>
+}
+  801514:	c9                   	leave
+  801515:	c3                   	ret
+
+00801516 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801516:	55                   	push   %ebp
+  801517:	89 e5                	mov    %esp,%ebp
+  801519:	53                   	push   %ebx
+  80151a:	83 ec 08             	sub    $0x8,%esp
+  80151d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801520:	8b 45 08             	mov    0x8(%ebp),%eax
+  801523:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801528:	53                   	push   %ebx
+  801529:	ff 75 0c             	push   0xc(%ebp)
+  80152c:	68 04 60 80 00       	push   $0x806004
+  801531:	e8 cf ed ff ff       	call   800305 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801536:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  80153c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801541:	e8 c1 fe ff ff       	call   801407 <nsipc>
+}
+  801546:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801549:	c9                   	leave
+  80154a:	c3                   	ret
+
+0080154b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80154b:	55                   	push   %ebp
+  80154c:	89 e5                	mov    %esp,%ebp
+  80154e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801551:	8b 45 08             	mov    0x8(%ebp),%eax
+  801554:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801559:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80155c:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801561:	b8 06 00 00 00       	mov    $0x6,%eax
+  801566:	e8 9c fe ff ff       	call   801407 <nsipc>
+}
+  80156b:	c9                   	leave
+  80156c:	c3                   	ret
+
+0080156d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	56                   	push   %esi
+  801571:	53                   	push   %ebx
+  801572:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801575:	8b 45 08             	mov    0x8(%ebp),%eax
+  801578:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  80157d:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801583:	8b 45 14             	mov    0x14(%ebp),%eax
+  801586:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80158b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801590:	e8 72 fe ff ff       	call   801407 <nsipc>
+  801595:	89 c3                	mov    %eax,%ebx
+  801597:	85 c0                	test   %eax,%eax
+  801599:	78 22                	js     8015bd <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80159b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8015a0:	39 c6                	cmp    %eax,%esi
+  8015a2:	0f 4e c6             	cmovle %esi,%eax
+  8015a5:	39 c3                	cmp    %eax,%ebx
+  8015a7:	7f 1d                	jg     8015c6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8015a9:	83 ec 04             	sub    $0x4,%esp
+  8015ac:	53                   	push   %ebx
+  8015ad:	68 00 60 80 00       	push   $0x806000
+  8015b2:	ff 75 0c             	push   0xc(%ebp)
+  8015b5:	e8 4b ed ff ff       	call   800305 <memmove>
+  8015ba:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8015bd:	89 d8                	mov    %ebx,%eax
+  8015bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c2:	5b                   	pop    %ebx
+  8015c3:	5e                   	pop    %esi
+  8015c4:	5d                   	pop    %ebp
+  8015c5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8015c6:	68 2b 28 80 00       	push   $0x80282b
+  8015cb:	68 f3 27 80 00       	push   $0x8027f3
+  8015d0:	6a 62                	push   $0x62
+  8015d2:	68 40 28 80 00       	push   $0x802840
+  8015d7:	e8 46 05 00 00       	call   801b22 <_panic>
+
+008015dc <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	53                   	push   %ebx
+  8015e0:	83 ec 04             	sub    $0x4,%esp
+  8015e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8015e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e9:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  8015ee:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8015f4:	7f 2e                	jg     801624 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8015f6:	83 ec 04             	sub    $0x4,%esp
+  8015f9:	53                   	push   %ebx
+  8015fa:	ff 75 0c             	push   0xc(%ebp)
+  8015fd:	68 0c 60 80 00       	push   $0x80600c
+  801602:	e8 fe ec ff ff       	call   800305 <memmove>
+	nsipcbuf.send.req_size = size;
+  801607:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  80160d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801610:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801615:	b8 08 00 00 00       	mov    $0x8,%eax
+  80161a:	e8 e8 fd ff ff       	call   801407 <nsipc>
+}
+  80161f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801622:	c9                   	leave
+  801623:	c3                   	ret
+	assert(size < 1600);
+  801624:	68 4c 28 80 00       	push   $0x80284c
+  801629:	68 f3 27 80 00       	push   $0x8027f3
+  80162e:	6a 6d                	push   $0x6d
+  801630:	68 40 28 80 00       	push   $0x802840
+  801635:	e8 e8 04 00 00       	call   801b22 <_panic>
+
+0080163a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80163a:	55                   	push   %ebp
+  80163b:	89 e5                	mov    %esp,%ebp
+  80163d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801640:	8b 45 08             	mov    0x8(%ebp),%eax
+  801643:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801648:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80164b:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801650:	8b 45 10             	mov    0x10(%ebp),%eax
+  801653:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801658:	b8 09 00 00 00       	mov    $0x9,%eax
+  80165d:	e8 a5 fd ff ff       	call   801407 <nsipc>
+}
+  801662:	c9                   	leave
+  801663:	c3                   	ret
+
+00801664 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801664:	55                   	push   %ebp
+  801665:	89 e5                	mov    %esp,%ebp
+  801667:	56                   	push   %esi
+  801668:	53                   	push   %ebx
+  801669:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80166c:	83 ec 0c             	sub    $0xc,%esp
+  80166f:	ff 75 08             	push   0x8(%ebp)
+  801672:	e8 aa f3 ff ff       	call   800a21 <fd2data>
+  801677:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801679:	83 c4 08             	add    $0x8,%esp
+  80167c:	68 58 28 80 00       	push   $0x802858
+  801681:	53                   	push   %ebx
+  801682:	e8 f8 ea ff ff       	call   80017f <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801687:	8b 46 04             	mov    0x4(%esi),%eax
+  80168a:	2b 06                	sub    (%esi),%eax
+  80168c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801692:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801699:	00 00 00 
+	stat->st_dev = &devpipe;
+  80169c:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8016a3:	30 80 00 
+	return 0;
+}
+  8016a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ae:	5b                   	pop    %ebx
+  8016af:	5e                   	pop    %esi
+  8016b0:	5d                   	pop    %ebp
+  8016b1:	c3                   	ret
+
+008016b2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8016b2:	55                   	push   %ebp
+  8016b3:	89 e5                	mov    %esp,%ebp
+  8016b5:	53                   	push   %ebx
+  8016b6:	83 ec 0c             	sub    $0xc,%esp
+  8016b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8016bc:	53                   	push   %ebx
+  8016bd:	6a 00                	push   $0x0
+  8016bf:	e8 f0 ef ff ff       	call   8006b4 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8016c4:	89 1c 24             	mov    %ebx,(%esp)
+  8016c7:	e8 55 f3 ff ff       	call   800a21 <fd2data>
+  8016cc:	83 c4 08             	add    $0x8,%esp
+  8016cf:	50                   	push   %eax
+  8016d0:	6a 00                	push   $0x0
+  8016d2:	e8 dd ef ff ff       	call   8006b4 <sys_page_unmap>
+}
+  8016d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016da:	c9                   	leave
+  8016db:	c3                   	ret
+
+008016dc <_pipeisclosed>:
+{
+  8016dc:	55                   	push   %ebp
+  8016dd:	89 e5                	mov    %esp,%ebp
+  8016df:	57                   	push   %edi
+  8016e0:	56                   	push   %esi
+  8016e1:	53                   	push   %ebx
+  8016e2:	83 ec 1c             	sub    $0x1c,%esp
+  8016e5:	89 c7                	mov    %eax,%edi
+  8016e7:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8016e9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8016ee:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8016f1:	83 ec 0c             	sub    $0xc,%esp
+  8016f4:	57                   	push   %edi
+  8016f5:	e8 92 0b 00 00       	call   80228c <pageref>
+  8016fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8016fd:	89 34 24             	mov    %esi,(%esp)
+  801700:	e8 87 0b 00 00       	call   80228c <pageref>
+		nn = thisenv->env_runs;
+  801705:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80170b:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  80170e:	83 c4 10             	add    $0x10,%esp
+  801711:	39 cb                	cmp    %ecx,%ebx
+  801713:	74 1b                	je     801730 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801715:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801718:	75 cf                	jne    8016e9 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80171a:	8b 42 5c             	mov    0x5c(%edx),%eax
+  80171d:	6a 01                	push   $0x1
+  80171f:	50                   	push   %eax
+  801720:	53                   	push   %ebx
+  801721:	68 5f 28 80 00       	push   $0x80285f
+  801726:	e8 d2 04 00 00       	call   801bfd <cprintf>
+  80172b:	83 c4 10             	add    $0x10,%esp
+  80172e:	eb b9                	jmp    8016e9 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801730:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801733:	0f 94 c0             	sete   %al
+  801736:	0f b6 c0             	movzbl %al,%eax
+}
+  801739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80173c:	5b                   	pop    %ebx
+  80173d:	5e                   	pop    %esi
+  80173e:	5f                   	pop    %edi
+  80173f:	5d                   	pop    %ebp
+  801740:	c3                   	ret
+
+00801741 <devpipe_write>:
+{
+  801741:	55                   	push   %ebp
+  801742:	89 e5                	mov    %esp,%ebp
+  801744:	57                   	push   %edi
+  801745:	56                   	push   %esi
+  801746:	53                   	push   %ebx
+  801747:	83 ec 28             	sub    $0x28,%esp
+  80174a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80174d:	56                   	push   %esi
+  80174e:	e8 ce f2 ff ff       	call   800a21 <fd2data>
+  801753:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801755:	83 c4 10             	add    $0x10,%esp
+  801758:	bf 00 00 00 00       	mov    $0x0,%edi
+  80175d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801760:	75 09                	jne    80176b <devpipe_write+0x2a>
+	return i;
+  801762:	89 f8                	mov    %edi,%eax
+  801764:	eb 23                	jmp    801789 <devpipe_write+0x48>
+			sys_yield();
+  801766:	e8 01 ee ff ff       	call   80056c <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80176b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80176e:	8b 0b                	mov    (%ebx),%ecx
+  801770:	8d 51 20             	lea    0x20(%ecx),%edx
+  801773:	39 d0                	cmp    %edx,%eax
+  801775:	72 1a                	jb     801791 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801777:	89 da                	mov    %ebx,%edx
+  801779:	89 f0                	mov    %esi,%eax
+  80177b:	e8 5c ff ff ff       	call   8016dc <_pipeisclosed>
+  801780:	85 c0                	test   %eax,%eax
+  801782:	74 e2                	je     801766 <devpipe_write+0x25>
+				return 0;
+  801784:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801789:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80178c:	5b                   	pop    %ebx
+  80178d:	5e                   	pop    %esi
+  80178e:	5f                   	pop    %edi
+  80178f:	5d                   	pop    %ebp
+  801790:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801791:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801794:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801798:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80179b:	89 c2                	mov    %eax,%edx
+  80179d:	c1 fa 1f             	sar    $0x1f,%edx
+  8017a0:	89 d1                	mov    %edx,%ecx
+  8017a2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8017a5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8017a8:	83 e2 1f             	and    $0x1f,%edx
+  8017ab:	29 ca                	sub    %ecx,%edx
+  8017ad:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8017b1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8017b5:	83 c0 01             	add    $0x1,%eax
+  8017b8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8017bb:	83 c7 01             	add    $0x1,%edi
+  8017be:	eb 9d                	jmp    80175d <devpipe_write+0x1c>
+
+008017c0 <devpipe_read>:
+{
+  8017c0:	55                   	push   %ebp
+  8017c1:	89 e5                	mov    %esp,%ebp
+  8017c3:	57                   	push   %edi
+  8017c4:	56                   	push   %esi
+  8017c5:	53                   	push   %ebx
+  8017c6:	83 ec 18             	sub    $0x18,%esp
+  8017c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8017cc:	57                   	push   %edi
+  8017cd:	e8 4f f2 ff ff       	call   800a21 <fd2data>
+  8017d2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8017d4:	83 c4 10             	add    $0x10,%esp
+  8017d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017dc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8017df:	75 13                	jne    8017f4 <devpipe_read+0x34>
+	return i;
+  8017e1:	89 f0                	mov    %esi,%eax
+  8017e3:	eb 02                	jmp    8017e7 <devpipe_read+0x27>
+				return i;
+  8017e5:	89 f0                	mov    %esi,%eax
+}
+  8017e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ea:	5b                   	pop    %ebx
+  8017eb:	5e                   	pop    %esi
+  8017ec:	5f                   	pop    %edi
+  8017ed:	5d                   	pop    %ebp
+  8017ee:	c3                   	ret
+			sys_yield();
+  8017ef:	e8 78 ed ff ff       	call   80056c <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8017f4:	8b 03                	mov    (%ebx),%eax
+  8017f6:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8017f9:	75 18                	jne    801813 <devpipe_read+0x53>
+			if (i > 0)
+  8017fb:	85 f6                	test   %esi,%esi
+  8017fd:	75 e6                	jne    8017e5 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8017ff:	89 da                	mov    %ebx,%edx
+  801801:	89 f8                	mov    %edi,%eax
+  801803:	e8 d4 fe ff ff       	call   8016dc <_pipeisclosed>
+  801808:	85 c0                	test   %eax,%eax
+  80180a:	74 e3                	je     8017ef <devpipe_read+0x2f>
+				return 0;
+  80180c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801811:	eb d4                	jmp    8017e7 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801813:	99                   	cltd
+  801814:	c1 ea 1b             	shr    $0x1b,%edx
+  801817:	01 d0                	add    %edx,%eax
+  801819:	83 e0 1f             	and    $0x1f,%eax
+  80181c:	29 d0                	sub    %edx,%eax
+  80181e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801823:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801826:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801829:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80182c:	83 c6 01             	add    $0x1,%esi
+  80182f:	eb ab                	jmp    8017dc <devpipe_read+0x1c>
+
+00801831 <pipe>:
+{
+  801831:	55                   	push   %ebp
+  801832:	89 e5                	mov    %esp,%ebp
+  801834:	56                   	push   %esi
+  801835:	53                   	push   %ebx
+  801836:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801839:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80183c:	50                   	push   %eax
+  80183d:	e8 f6 f1 ff ff       	call   800a38 <fd_alloc>
+  801842:	89 c3                	mov    %eax,%ebx
+  801844:	83 c4 10             	add    $0x10,%esp
+  801847:	85 c0                	test   %eax,%eax
+  801849:	0f 88 23 01 00 00    	js     801972 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80184f:	83 ec 04             	sub    $0x4,%esp
+  801852:	68 07 04 00 00       	push   $0x407
+  801857:	ff 75 f4             	push   -0xc(%ebp)
+  80185a:	6a 00                	push   $0x0
+  80185c:	e8 8b ed ff ff       	call   8005ec <sys_page_alloc>
+  801861:	89 c3                	mov    %eax,%ebx
+  801863:	83 c4 10             	add    $0x10,%esp
+  801866:	85 c0                	test   %eax,%eax
+  801868:	0f 88 04 01 00 00    	js     801972 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80186e:	83 ec 0c             	sub    $0xc,%esp
+  801871:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801874:	50                   	push   %eax
+  801875:	e8 be f1 ff ff       	call   800a38 <fd_alloc>
+  80187a:	89 c3                	mov    %eax,%ebx
+  80187c:	83 c4 10             	add    $0x10,%esp
+  80187f:	85 c0                	test   %eax,%eax
+  801881:	0f 88 db 00 00 00    	js     801962 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801887:	83 ec 04             	sub    $0x4,%esp
+  80188a:	68 07 04 00 00       	push   $0x407
+  80188f:	ff 75 f0             	push   -0x10(%ebp)
+  801892:	6a 00                	push   $0x0
+  801894:	e8 53 ed ff ff       	call   8005ec <sys_page_alloc>
+  801899:	89 c3                	mov    %eax,%ebx
+  80189b:	83 c4 10             	add    $0x10,%esp
+  80189e:	85 c0                	test   %eax,%eax
+  8018a0:	0f 88 bc 00 00 00    	js     801962 <pipe+0x131>
+	va = fd2data(fd0);
+  8018a6:	83 ec 0c             	sub    $0xc,%esp
+  8018a9:	ff 75 f4             	push   -0xc(%ebp)
+  8018ac:	e8 70 f1 ff ff       	call   800a21 <fd2data>
+  8018b1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8018b3:	83 c4 0c             	add    $0xc,%esp
+  8018b6:	68 07 04 00 00       	push   $0x407
+  8018bb:	50                   	push   %eax
+  8018bc:	6a 00                	push   $0x0
+  8018be:	e8 29 ed ff ff       	call   8005ec <sys_page_alloc>
+  8018c3:	89 c3                	mov    %eax,%ebx
+  8018c5:	83 c4 10             	add    $0x10,%esp
+  8018c8:	85 c0                	test   %eax,%eax
+  8018ca:	0f 88 82 00 00 00    	js     801952 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8018d0:	83 ec 0c             	sub    $0xc,%esp
+  8018d3:	ff 75 f0             	push   -0x10(%ebp)
+  8018d6:	e8 46 f1 ff ff       	call   800a21 <fd2data>
+  8018db:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8018e2:	50                   	push   %eax
+  8018e3:	6a 00                	push   $0x0
+  8018e5:	56                   	push   %esi
+  8018e6:	6a 00                	push   $0x0
+  8018e8:	e8 85 ed ff ff       	call   800672 <sys_page_map>
+  8018ed:	89 c3                	mov    %eax,%ebx
+  8018ef:	83 c4 20             	add    $0x20,%esp
+  8018f2:	85 c0                	test   %eax,%eax
+  8018f4:	78 4e                	js     801944 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8018f6:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8018fb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8018fe:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801900:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801903:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80190a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80190d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80190f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801912:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801919:	83 ec 0c             	sub    $0xc,%esp
+  80191c:	ff 75 f4             	push   -0xc(%ebp)
+  80191f:	e8 ed f0 ff ff       	call   800a11 <fd2num>
+  801924:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801927:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801929:	83 c4 04             	add    $0x4,%esp
+  80192c:	ff 75 f0             	push   -0x10(%ebp)
+  80192f:	e8 dd f0 ff ff       	call   800a11 <fd2num>
+  801934:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801937:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80193a:	83 c4 10             	add    $0x10,%esp
+  80193d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801942:	eb 2e                	jmp    801972 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801944:	83 ec 08             	sub    $0x8,%esp
+  801947:	56                   	push   %esi
+  801948:	6a 00                	push   $0x0
+  80194a:	e8 65 ed ff ff       	call   8006b4 <sys_page_unmap>
+  80194f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801952:	83 ec 08             	sub    $0x8,%esp
+  801955:	ff 75 f0             	push   -0x10(%ebp)
+  801958:	6a 00                	push   $0x0
+  80195a:	e8 55 ed ff ff       	call   8006b4 <sys_page_unmap>
+  80195f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801962:	83 ec 08             	sub    $0x8,%esp
+  801965:	ff 75 f4             	push   -0xc(%ebp)
+  801968:	6a 00                	push   $0x0
+  80196a:	e8 45 ed ff ff       	call   8006b4 <sys_page_unmap>
+  80196f:	83 c4 10             	add    $0x10,%esp
+}
+  801972:	89 d8                	mov    %ebx,%eax
+  801974:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801977:	5b                   	pop    %ebx
+  801978:	5e                   	pop    %esi
+  801979:	5d                   	pop    %ebp
+  80197a:	c3                   	ret
+
+0080197b <pipeisclosed>:
+{
+  80197b:	55                   	push   %ebp
+  80197c:	89 e5                	mov    %esp,%ebp
+  80197e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801981:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801984:	50                   	push   %eax
+  801985:	ff 75 08             	push   0x8(%ebp)
+  801988:	e8 01 f1 ff ff       	call   800a8e <fd_lookup>
+  80198d:	83 c4 10             	add    $0x10,%esp
+  801990:	85 c0                	test   %eax,%eax
+  801992:	78 18                	js     8019ac <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801994:	83 ec 0c             	sub    $0xc,%esp
+  801997:	ff 75 f4             	push   -0xc(%ebp)
+  80199a:	e8 82 f0 ff ff       	call   800a21 <fd2data>
+  80199f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8019a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019a4:	e8 33 fd ff ff       	call   8016dc <_pipeisclosed>
+  8019a9:	83 c4 10             	add    $0x10,%esp
+}
+  8019ac:	c9                   	leave
+  8019ad:	c3                   	ret
+
+008019ae <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8019ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b3:	c3                   	ret
+
+008019b4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8019b4:	55                   	push   %ebp
+  8019b5:	89 e5                	mov    %esp,%ebp
+  8019b7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8019ba:	68 77 28 80 00       	push   $0x802877
+  8019bf:	ff 75 0c             	push   0xc(%ebp)
+  8019c2:	e8 b8 e7 ff ff       	call   80017f <strcpy>
+	return 0;
+}
+  8019c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cc:	c9                   	leave
+  8019cd:	c3                   	ret
+
+008019ce <devcons_write>:
+{
+  8019ce:	55                   	push   %ebp
+  8019cf:	89 e5                	mov    %esp,%ebp
+  8019d1:	57                   	push   %edi
+  8019d2:	56                   	push   %esi
+  8019d3:	53                   	push   %ebx
+  8019d4:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8019da:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8019df:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8019e5:	eb 2e                	jmp    801a15 <devcons_write+0x47>
+		m = n - tot;
+  8019e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019ea:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8019ec:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8019f1:	39 c3                	cmp    %eax,%ebx
+  8019f3:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8019f6:	83 ec 04             	sub    $0x4,%esp
+  8019f9:	53                   	push   %ebx
+  8019fa:	89 f0                	mov    %esi,%eax
+  8019fc:	03 45 0c             	add    0xc(%ebp),%eax
+  8019ff:	50                   	push   %eax
+  801a00:	57                   	push   %edi
+  801a01:	e8 ff e8 ff ff       	call   800305 <memmove>
+		sys_cputs(buf, m);
+  801a06:	83 c4 08             	add    $0x8,%esp
+  801a09:	53                   	push   %ebx
+  801a0a:	57                   	push   %edi
+  801a0b:	e8 9f ea ff ff       	call   8004af <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801a10:	01 de                	add    %ebx,%esi
+  801a12:	83 c4 10             	add    $0x10,%esp
+  801a15:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801a18:	72 cd                	jb     8019e7 <devcons_write+0x19>
+}
+  801a1a:	89 f0                	mov    %esi,%eax
+  801a1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a1f:	5b                   	pop    %ebx
+  801a20:	5e                   	pop    %esi
+  801a21:	5f                   	pop    %edi
+  801a22:	5d                   	pop    %ebp
+  801a23:	c3                   	ret
+
+00801a24 <devcons_read>:
+{
+  801a24:	55                   	push   %ebp
+  801a25:	89 e5                	mov    %esp,%ebp
+  801a27:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801a2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801a33:	75 07                	jne    801a3c <devcons_read+0x18>
+  801a35:	eb 1f                	jmp    801a56 <devcons_read+0x32>
+		sys_yield();
+  801a37:	e8 30 eb ff ff       	call   80056c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801a3c:	e8 8c ea ff ff       	call   8004cd <sys_cgetc>
+  801a41:	85 c0                	test   %eax,%eax
+  801a43:	74 f2                	je     801a37 <devcons_read+0x13>
+	if (c < 0)
+  801a45:	78 0f                	js     801a56 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801a47:	83 f8 04             	cmp    $0x4,%eax
+  801a4a:	74 0c                	je     801a58 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801a4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a4f:	88 02                	mov    %al,(%edx)
+	return 1;
+  801a51:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801a56:	c9                   	leave
+  801a57:	c3                   	ret
+		return 0;
+  801a58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5d:	eb f7                	jmp    801a56 <devcons_read+0x32>
+
+00801a5f <cputchar>:
+{
+  801a5f:	55                   	push   %ebp
+  801a60:	89 e5                	mov    %esp,%ebp
+  801a62:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801a65:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a68:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801a6b:	6a 01                	push   $0x1
+  801a6d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801a70:	50                   	push   %eax
+  801a71:	e8 39 ea ff ff       	call   8004af <sys_cputs>
+}
+  801a76:	83 c4 10             	add    $0x10,%esp
+  801a79:	c9                   	leave
+  801a7a:	c3                   	ret
+
+00801a7b <getchar>:
+{
+  801a7b:	55                   	push   %ebp
+  801a7c:	89 e5                	mov    %esp,%ebp
+  801a7e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801a81:	6a 01                	push   $0x1
+  801a83:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801a86:	50                   	push   %eax
+  801a87:	6a 00                	push   $0x0
+  801a89:	e8 66 f2 ff ff       	call   800cf4 <read>
+	if (r < 0)
+  801a8e:	83 c4 10             	add    $0x10,%esp
+  801a91:	85 c0                	test   %eax,%eax
+  801a93:	78 06                	js     801a9b <getchar+0x20>
+	if (r < 1)
+  801a95:	74 06                	je     801a9d <getchar+0x22>
+	return c;
+  801a97:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801a9b:	c9                   	leave
+  801a9c:	c3                   	ret
+		return -E_EOF;
+  801a9d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801aa2:	eb f7                	jmp    801a9b <getchar+0x20>
+
+00801aa4 <iscons>:
+{
+  801aa4:	55                   	push   %ebp
+  801aa5:	89 e5                	mov    %esp,%ebp
+  801aa7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801aaa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aad:	50                   	push   %eax
+  801aae:	ff 75 08             	push   0x8(%ebp)
+  801ab1:	e8 d8 ef ff ff       	call   800a8e <fd_lookup>
+  801ab6:	83 c4 10             	add    $0x10,%esp
+  801ab9:	85 c0                	test   %eax,%eax
+  801abb:	78 11                	js     801ace <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801abd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ac0:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801ac6:	39 10                	cmp    %edx,(%eax)
+  801ac8:	0f 94 c0             	sete   %al
+  801acb:	0f b6 c0             	movzbl %al,%eax
+}
+  801ace:	c9                   	leave
+  801acf:	c3                   	ret
+
+00801ad0 <opencons>:
+{
+  801ad0:	55                   	push   %ebp
+  801ad1:	89 e5                	mov    %esp,%ebp
+  801ad3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801ad6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad9:	50                   	push   %eax
+  801ada:	e8 59 ef ff ff       	call   800a38 <fd_alloc>
+  801adf:	83 c4 10             	add    $0x10,%esp
+  801ae2:	85 c0                	test   %eax,%eax
+  801ae4:	78 3a                	js     801b20 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801ae6:	83 ec 04             	sub    $0x4,%esp
+  801ae9:	68 07 04 00 00       	push   $0x407
+  801aee:	ff 75 f4             	push   -0xc(%ebp)
+  801af1:	6a 00                	push   $0x0
+  801af3:	e8 f4 ea ff ff       	call   8005ec <sys_page_alloc>
+  801af8:	83 c4 10             	add    $0x10,%esp
+  801afb:	85 c0                	test   %eax,%eax
+  801afd:	78 21                	js     801b20 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801aff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b02:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801b08:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801b0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b0d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801b14:	83 ec 0c             	sub    $0xc,%esp
+  801b17:	50                   	push   %eax
+  801b18:	e8 f4 ee ff ff       	call   800a11 <fd2num>
+  801b1d:	83 c4 10             	add    $0x10,%esp
+}
+  801b20:	c9                   	leave
+  801b21:	c3                   	ret
+
+00801b22 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	56                   	push   %esi
+  801b26:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801b27:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b2a:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801b30:	e8 18 ea ff ff       	call   80054d <sys_getenvid>
+  801b35:	83 ec 0c             	sub    $0xc,%esp
+  801b38:	ff 75 0c             	push   0xc(%ebp)
+  801b3b:	ff 75 08             	push   0x8(%ebp)
+  801b3e:	56                   	push   %esi
+  801b3f:	50                   	push   %eax
+  801b40:	68 84 28 80 00       	push   $0x802884
+  801b45:	e8 b3 00 00 00       	call   801bfd <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801b4a:	83 c4 18             	add    $0x18,%esp
+  801b4d:	53                   	push   %ebx
+  801b4e:	ff 75 10             	push   0x10(%ebp)
+  801b51:	e8 56 00 00 00       	call   801bac <vcprintf>
+	cprintf("\n");
+  801b56:	c7 04 24 70 28 80 00 	movl   $0x802870,(%esp)
+  801b5d:	e8 9b 00 00 00       	call   801bfd <cprintf>
+  801b62:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801b65:	cc                   	int3
+	while (1)
+  801b66:	eb fd                	jmp    801b65 <_panic+0x43>
+
+00801b68 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801b68:	55                   	push   %ebp
+  801b69:	89 e5                	mov    %esp,%ebp
+  801b6b:	53                   	push   %ebx
+  801b6c:	83 ec 04             	sub    $0x4,%esp
+  801b6f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801b72:	8b 13                	mov    (%ebx),%edx
+  801b74:	8d 42 01             	lea    0x1(%edx),%eax
+  801b77:	89 03                	mov    %eax,(%ebx)
+  801b79:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b7c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801b80:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801b85:	74 09                	je     801b90 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801b87:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801b8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b8e:	c9                   	leave
+  801b8f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801b90:	83 ec 08             	sub    $0x8,%esp
+  801b93:	68 ff 00 00 00       	push   $0xff
+  801b98:	8d 43 08             	lea    0x8(%ebx),%eax
+  801b9b:	50                   	push   %eax
+  801b9c:	e8 0e e9 ff ff       	call   8004af <sys_cputs>
+		b->idx = 0;
+  801ba1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801ba7:	83 c4 10             	add    $0x10,%esp
+  801baa:	eb db                	jmp    801b87 <putch+0x1f>
+
+00801bac <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801bac:	55                   	push   %ebp
+  801bad:	89 e5                	mov    %esp,%ebp
+  801baf:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  801bb5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801bbc:	00 00 00 
+	b.cnt = 0;
+  801bbf:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  801bc6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  801bc9:	ff 75 0c             	push   0xc(%ebp)
+  801bcc:	ff 75 08             	push   0x8(%ebp)
+  801bcf:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  801bd5:	50                   	push   %eax
+  801bd6:	68 68 1b 80 00       	push   $0x801b68
+  801bdb:	e8 14 01 00 00       	call   801cf4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801be0:	83 c4 08             	add    $0x8,%esp
+  801be3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801be9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801bef:	50                   	push   %eax
+  801bf0:	e8 ba e8 ff ff       	call   8004af <sys_cputs>
+
+	return b.cnt;
+}
+  801bf5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801bfb:	c9                   	leave
+  801bfc:	c3                   	ret
+
+00801bfd <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801bfd:	55                   	push   %ebp
+  801bfe:	89 e5                	mov    %esp,%ebp
+  801c00:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801c03:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801c06:	50                   	push   %eax
+  801c07:	ff 75 08             	push   0x8(%ebp)
+  801c0a:	e8 9d ff ff ff       	call   801bac <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801c0f:	c9                   	leave
+  801c10:	c3                   	ret
+
+00801c11 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801c11:	55                   	push   %ebp
+  801c12:	89 e5                	mov    %esp,%ebp
+  801c14:	57                   	push   %edi
+  801c15:	56                   	push   %esi
+  801c16:	53                   	push   %ebx
+  801c17:	83 ec 1c             	sub    $0x1c,%esp
+  801c1a:	89 c7                	mov    %eax,%edi
+  801c1c:	89 d6                	mov    %edx,%esi
+  801c1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c21:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c24:	89 d1                	mov    %edx,%ecx
+  801c26:	89 c2                	mov    %eax,%edx
+  801c28:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801c2b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801c2e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c31:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801c34:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801c37:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801c3e:	39 c2                	cmp    %eax,%edx
+  801c40:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801c43:	72 3e                	jb     801c83 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801c45:	83 ec 0c             	sub    $0xc,%esp
+  801c48:	ff 75 18             	push   0x18(%ebp)
+  801c4b:	83 eb 01             	sub    $0x1,%ebx
+  801c4e:	53                   	push   %ebx
+  801c4f:	50                   	push   %eax
+  801c50:	83 ec 08             	sub    $0x8,%esp
+  801c53:	ff 75 e4             	push   -0x1c(%ebp)
+  801c56:	ff 75 e0             	push   -0x20(%ebp)
+  801c59:	ff 75 dc             	push   -0x24(%ebp)
+  801c5c:	ff 75 d8             	push   -0x28(%ebp)
+  801c5f:	e8 3c 07 00 00       	call   8023a0 <__udivdi3>
+  801c64:	83 c4 18             	add    $0x18,%esp
+  801c67:	52                   	push   %edx
+  801c68:	50                   	push   %eax
+  801c69:	89 f2                	mov    %esi,%edx
+  801c6b:	89 f8                	mov    %edi,%eax
+  801c6d:	e8 9f ff ff ff       	call   801c11 <printnum>
+  801c72:	83 c4 20             	add    $0x20,%esp
+  801c75:	eb 13                	jmp    801c8a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801c77:	83 ec 08             	sub    $0x8,%esp
+  801c7a:	56                   	push   %esi
+  801c7b:	ff 75 18             	push   0x18(%ebp)
+  801c7e:	ff d7                	call   *%edi
+  801c80:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801c83:	83 eb 01             	sub    $0x1,%ebx
+  801c86:	85 db                	test   %ebx,%ebx
+  801c88:	7f ed                	jg     801c77 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801c8a:	83 ec 08             	sub    $0x8,%esp
+  801c8d:	56                   	push   %esi
+  801c8e:	83 ec 04             	sub    $0x4,%esp
+  801c91:	ff 75 e4             	push   -0x1c(%ebp)
+  801c94:	ff 75 e0             	push   -0x20(%ebp)
+  801c97:	ff 75 dc             	push   -0x24(%ebp)
+  801c9a:	ff 75 d8             	push   -0x28(%ebp)
+  801c9d:	e8 be 07 00 00       	call   802460 <__umoddi3>
+  801ca2:	83 c4 14             	add    $0x14,%esp
+  801ca5:	0f be 80 a7 28 80 00 	movsbl 0x8028a7(%eax),%eax
+  801cac:	50                   	push   %eax
+  801cad:	ff d7                	call   *%edi
+}
+  801caf:	83 c4 10             	add    $0x10,%esp
+  801cb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cb5:	5b                   	pop    %ebx
+  801cb6:	5e                   	pop    %esi
+  801cb7:	5f                   	pop    %edi
+  801cb8:	5d                   	pop    %ebp
+  801cb9:	c3                   	ret
+
+00801cba <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801cba:	55                   	push   %ebp
+  801cbb:	89 e5                	mov    %esp,%ebp
+  801cbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801cc0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801cc4:	8b 10                	mov    (%eax),%edx
+  801cc6:	3b 50 04             	cmp    0x4(%eax),%edx
+  801cc9:	73 0a                	jae    801cd5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801ccb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801cce:	89 08                	mov    %ecx,(%eax)
+  801cd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd3:	88 02                	mov    %al,(%edx)
+}
+  801cd5:	5d                   	pop    %ebp
+  801cd6:	c3                   	ret
+
+00801cd7 <printfmt>:
+{
+  801cd7:	55                   	push   %ebp
+  801cd8:	89 e5                	mov    %esp,%ebp
+  801cda:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801cdd:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801ce0:	50                   	push   %eax
+  801ce1:	ff 75 10             	push   0x10(%ebp)
+  801ce4:	ff 75 0c             	push   0xc(%ebp)
+  801ce7:	ff 75 08             	push   0x8(%ebp)
+  801cea:	e8 05 00 00 00       	call   801cf4 <vprintfmt>
+}
+  801cef:	83 c4 10             	add    $0x10,%esp
+  801cf2:	c9                   	leave
+  801cf3:	c3                   	ret
+
+00801cf4 <vprintfmt>:
+{
+  801cf4:	55                   	push   %ebp
+  801cf5:	89 e5                	mov    %esp,%ebp
+  801cf7:	57                   	push   %edi
+  801cf8:	56                   	push   %esi
+  801cf9:	53                   	push   %ebx
+  801cfa:	83 ec 2c             	sub    $0x2c,%esp
+  801cfd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d00:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d03:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801d06:	eb 0a                	jmp    801d12 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801d08:	83 ec 08             	sub    $0x8,%esp
+  801d0b:	53                   	push   %ebx
+  801d0c:	50                   	push   %eax
+  801d0d:	ff d6                	call   *%esi
+  801d0f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801d12:	83 c7 01             	add    $0x1,%edi
+  801d15:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801d19:	83 f8 25             	cmp    $0x25,%eax
+  801d1c:	74 0c                	je     801d2a <vprintfmt+0x36>
+			if (ch == '\0')
+  801d1e:	85 c0                	test   %eax,%eax
+  801d20:	75 e6                	jne    801d08 <vprintfmt+0x14>
+}
+  801d22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d25:	5b                   	pop    %ebx
+  801d26:	5e                   	pop    %esi
+  801d27:	5f                   	pop    %edi
+  801d28:	5d                   	pop    %ebp
+  801d29:	c3                   	ret
+		padc = ' ';
+  801d2a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801d2e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801d35:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801d3c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801d43:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801d48:	8d 47 01             	lea    0x1(%edi),%eax
+  801d4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d4e:	0f b6 17             	movzbl (%edi),%edx
+  801d51:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801d54:	3c 55                	cmp    $0x55,%al
+  801d56:	0f 87 cf 03 00 00    	ja     80212b <vprintfmt+0x437>
+  801d5c:	0f b6 c0             	movzbl %al,%eax
+  801d5f:	ff 24 85 e0 29 80 00 	jmp    *0x8029e0(,%eax,4)
+  801d66:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801d69:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801d6d:	eb d9                	jmp    801d48 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801d6f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d72:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801d76:	eb d0                	jmp    801d48 <vprintfmt+0x54>
+  801d78:	0f b6 d2             	movzbl %dl,%edx
+  801d7b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801d7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d83:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801d86:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801d89:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801d8d:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801d90:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801d93:	83 f9 09             	cmp    $0x9,%ecx
+  801d96:	77 55                	ja     801ded <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801d98:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801d9b:	eb e9                	jmp    801d86 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801d9d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801da0:	8b 00                	mov    (%eax),%eax
+  801da2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801da5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801da8:	8d 40 04             	lea    0x4(%eax),%eax
+  801dab:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801dae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801db1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801db5:	79 91                	jns    801d48 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801db7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801dba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801dbd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801dc4:	eb 82                	jmp    801d48 <vprintfmt+0x54>
+			if (width < 0)
+  801dc6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801dc9:	85 d2                	test   %edx,%edx
+  801dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd0:	0f 49 c2             	cmovns %edx,%eax
+  801dd3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801dd6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801dd9:	e9 6a ff ff ff       	jmp    801d48 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801dde:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801de1:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801de8:	e9 5b ff ff ff       	jmp    801d48 <vprintfmt+0x54>
+  801ded:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801df0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801df3:	eb bc                	jmp    801db1 <vprintfmt+0xbd>
+			lflag++;
+  801df5:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801df8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801dfb:	e9 48 ff ff ff       	jmp    801d48 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801e00:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e03:	8d 78 04             	lea    0x4(%eax),%edi
+  801e06:	83 ec 08             	sub    $0x8,%esp
+  801e09:	53                   	push   %ebx
+  801e0a:	ff 30                	push   (%eax)
+  801e0c:	ff d6                	call   *%esi
+			break;
+  801e0e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801e11:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801e14:	e9 b1 02 00 00       	jmp    8020ca <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801e19:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e1c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801e1f:	8b 10                	mov    (%eax),%edx
+  801e21:	89 d0                	mov    %edx,%eax
+  801e23:	f7 d8                	neg    %eax
+  801e25:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801e28:	83 f8 0f             	cmp    $0xf,%eax
+  801e2b:	7f 23                	jg     801e50 <vprintfmt+0x15c>
+  801e2d:	8b 14 85 40 2b 80 00 	mov    0x802b40(,%eax,4),%edx
+  801e34:	85 d2                	test   %edx,%edx
+  801e36:	74 18                	je     801e50 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801e38:	52                   	push   %edx
+  801e39:	68 05 28 80 00       	push   $0x802805
+  801e3e:	53                   	push   %ebx
+  801e3f:	56                   	push   %esi
+  801e40:	e8 92 fe ff ff       	call   801cd7 <printfmt>
+  801e45:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801e48:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801e4b:	e9 7a 02 00 00       	jmp    8020ca <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801e50:	50                   	push   %eax
+  801e51:	68 bf 28 80 00       	push   $0x8028bf
+  801e56:	53                   	push   %ebx
+  801e57:	56                   	push   %esi
+  801e58:	e8 7a fe ff ff       	call   801cd7 <printfmt>
+  801e5d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801e60:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801e63:	e9 62 02 00 00       	jmp    8020ca <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801e68:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e6b:	83 c0 04             	add    $0x4,%eax
+  801e6e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801e71:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e74:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801e76:	85 c9                	test   %ecx,%ecx
+  801e78:	b8 b8 28 80 00       	mov    $0x8028b8,%eax
+  801e7d:	0f 45 c1             	cmovne %ecx,%eax
+  801e80:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801e83:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e87:	7e 06                	jle    801e8f <vprintfmt+0x19b>
+  801e89:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801e8d:	75 0b                	jne    801e9a <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801e8f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801e92:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801e95:	89 75 08             	mov    %esi,0x8(%ebp)
+  801e98:	eb 5c                	jmp    801ef6 <vprintfmt+0x202>
+  801e9a:	83 ec 08             	sub    $0x8,%esp
+  801e9d:	ff 75 d0             	push   -0x30(%ebp)
+  801ea0:	ff 75 cc             	push   -0x34(%ebp)
+  801ea3:	e8 b4 e2 ff ff       	call   80015c <strnlen>
+  801ea8:	89 c2                	mov    %eax,%edx
+  801eaa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ead:	29 d0                	sub    %edx,%eax
+  801eaf:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801eb2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801eb6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801eb9:	89 75 08             	mov    %esi,0x8(%ebp)
+  801ebc:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ebe:	eb 0e                	jmp    801ece <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801ec0:	83 ec 08             	sub    $0x8,%esp
+  801ec3:	53                   	push   %ebx
+  801ec4:	57                   	push   %edi
+  801ec5:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ec8:	83 ee 01             	sub    $0x1,%esi
+  801ecb:	83 c4 10             	add    $0x10,%esp
+  801ece:	85 f6                	test   %esi,%esi
+  801ed0:	7f ee                	jg     801ec0 <vprintfmt+0x1cc>
+  801ed2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ed5:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801edf:	0f 49 d0             	cmovns %eax,%edx
+  801ee2:	29 d0                	sub    %edx,%eax
+  801ee4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ee7:	eb a6                	jmp    801e8f <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ee9:	83 ec 08             	sub    $0x8,%esp
+  801eec:	53                   	push   %ebx
+  801eed:	52                   	push   %edx
+  801eee:	ff 55 08             	call   *0x8(%ebp)
+  801ef1:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801ef4:	89 f1                	mov    %esi,%ecx
+  801ef6:	8d 71 01             	lea    0x1(%ecx),%esi
+  801ef9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801efd:	0f be d0             	movsbl %al,%edx
+  801f00:	85 d2                	test   %edx,%edx
+  801f02:	74 28                	je     801f2c <vprintfmt+0x238>
+  801f04:	85 ff                	test   %edi,%edi
+  801f06:	78 05                	js     801f0d <vprintfmt+0x219>
+  801f08:	83 ef 01             	sub    $0x1,%edi
+  801f0b:	78 30                	js     801f3d <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801f0d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801f11:	74 d6                	je     801ee9 <vprintfmt+0x1f5>
+  801f13:	0f be c0             	movsbl %al,%eax
+  801f16:	83 e8 20             	sub    $0x20,%eax
+  801f19:	83 f8 5e             	cmp    $0x5e,%eax
+  801f1c:	76 cb                	jbe    801ee9 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801f1e:	83 ec 08             	sub    $0x8,%esp
+  801f21:	53                   	push   %ebx
+  801f22:	6a 3f                	push   $0x3f
+  801f24:	ff 55 08             	call   *0x8(%ebp)
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	eb c8                	jmp    801ef4 <vprintfmt+0x200>
+  801f2c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f2f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801f32:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801f35:	01 d0                	add    %edx,%eax
+  801f37:	29 c8                	sub    %ecx,%eax
+  801f39:	89 c7                	mov    %eax,%edi
+  801f3b:	eb 13                	jmp    801f50 <vprintfmt+0x25c>
+  801f3d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f40:	eb ed                	jmp    801f2f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801f42:	83 ec 08             	sub    $0x8,%esp
+  801f45:	53                   	push   %ebx
+  801f46:	6a 20                	push   $0x20
+  801f48:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801f4a:	83 ef 01             	sub    $0x1,%edi
+  801f4d:	83 c4 10             	add    $0x10,%esp
+  801f50:	85 ff                	test   %edi,%edi
+  801f52:	7f ee                	jg     801f42 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801f54:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801f57:	89 45 14             	mov    %eax,0x14(%ebp)
+  801f5a:	e9 6b 01 00 00       	jmp    8020ca <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801f5f:	83 f9 01             	cmp    $0x1,%ecx
+  801f62:	7f 1f                	jg     801f83 <vprintfmt+0x28f>
+	else if (lflag)
+  801f64:	85 c9                	test   %ecx,%ecx
+  801f66:	74 67                	je     801fcf <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801f68:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f6b:	8b 00                	mov    (%eax),%eax
+  801f6d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801f70:	89 c1                	mov    %eax,%ecx
+  801f72:	c1 f9 1f             	sar    $0x1f,%ecx
+  801f75:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801f78:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f7b:	8d 40 04             	lea    0x4(%eax),%eax
+  801f7e:	89 45 14             	mov    %eax,0x14(%ebp)
+  801f81:	eb 17                	jmp    801f9a <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801f83:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f86:	8b 50 04             	mov    0x4(%eax),%edx
+  801f89:	8b 00                	mov    (%eax),%eax
+  801f8b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801f8e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801f91:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f94:	8d 40 08             	lea    0x8(%eax),%eax
+  801f97:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801f9a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801f9d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801fa0:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801fa5:	85 c9                	test   %ecx,%ecx
+  801fa7:	0f 89 03 01 00 00    	jns    8020b0 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  801fad:	83 ec 08             	sub    $0x8,%esp
+  801fb0:	53                   	push   %ebx
+  801fb1:	6a 2d                	push   $0x2d
+  801fb3:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801fb5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801fb8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801fbb:	f7 da                	neg    %edx
+  801fbd:	83 d1 00             	adc    $0x0,%ecx
+  801fc0:	f7 d9                	neg    %ecx
+  801fc2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801fc5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801fca:	e9 e1 00 00 00       	jmp    8020b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  801fcf:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fd2:	8b 00                	mov    (%eax),%eax
+  801fd4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801fd7:	89 c1                	mov    %eax,%ecx
+  801fd9:	c1 f9 1f             	sar    $0x1f,%ecx
+  801fdc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801fdf:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fe2:	8d 40 04             	lea    0x4(%eax),%eax
+  801fe5:	89 45 14             	mov    %eax,0x14(%ebp)
+  801fe8:	eb b0                	jmp    801f9a <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801fea:	83 f9 01             	cmp    $0x1,%ecx
+  801fed:	7f 1e                	jg     80200d <vprintfmt+0x319>
+	else if (lflag)
+  801fef:	85 c9                	test   %ecx,%ecx
+  801ff1:	74 32                	je     802025 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  801ff3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff6:	8b 10                	mov    (%eax),%edx
+  801ff8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ffd:	8d 40 04             	lea    0x4(%eax),%eax
+  802000:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802003:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802008:	e9 a3 00 00 00       	jmp    8020b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80200d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802010:	8b 10                	mov    (%eax),%edx
+  802012:	8b 48 04             	mov    0x4(%eax),%ecx
+  802015:	8d 40 08             	lea    0x8(%eax),%eax
+  802018:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80201b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802020:	e9 8b 00 00 00       	jmp    8020b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802025:	8b 45 14             	mov    0x14(%ebp),%eax
+  802028:	8b 10                	mov    (%eax),%edx
+  80202a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80202f:	8d 40 04             	lea    0x4(%eax),%eax
+  802032:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802035:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80203a:	eb 74                	jmp    8020b0 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80203c:	83 f9 01             	cmp    $0x1,%ecx
+  80203f:	7f 1b                	jg     80205c <vprintfmt+0x368>
+	else if (lflag)
+  802041:	85 c9                	test   %ecx,%ecx
+  802043:	74 2c                	je     802071 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  802045:	8b 45 14             	mov    0x14(%ebp),%eax
+  802048:	8b 10                	mov    (%eax),%edx
+  80204a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80204f:	8d 40 04             	lea    0x4(%eax),%eax
+  802052:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802055:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80205a:	eb 54                	jmp    8020b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80205c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80205f:	8b 10                	mov    (%eax),%edx
+  802061:	8b 48 04             	mov    0x4(%eax),%ecx
+  802064:	8d 40 08             	lea    0x8(%eax),%eax
+  802067:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80206a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80206f:	eb 3f                	jmp    8020b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802071:	8b 45 14             	mov    0x14(%ebp),%eax
+  802074:	8b 10                	mov    (%eax),%edx
+  802076:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80207b:	8d 40 04             	lea    0x4(%eax),%eax
+  80207e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802081:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802086:	eb 28                	jmp    8020b0 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802088:	83 ec 08             	sub    $0x8,%esp
+  80208b:	53                   	push   %ebx
+  80208c:	6a 30                	push   $0x30
+  80208e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802090:	83 c4 08             	add    $0x8,%esp
+  802093:	53                   	push   %ebx
+  802094:	6a 78                	push   $0x78
+  802096:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802098:	8b 45 14             	mov    0x14(%ebp),%eax
+  80209b:	8b 10                	mov    (%eax),%edx
+  80209d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8020a2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8020a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8020a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8020ab:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8020b0:	83 ec 0c             	sub    $0xc,%esp
+  8020b3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8020b7:	50                   	push   %eax
+  8020b8:	ff 75 e0             	push   -0x20(%ebp)
+  8020bb:	57                   	push   %edi
+  8020bc:	51                   	push   %ecx
+  8020bd:	52                   	push   %edx
+  8020be:	89 da                	mov    %ebx,%edx
+  8020c0:	89 f0                	mov    %esi,%eax
+  8020c2:	e8 4a fb ff ff       	call   801c11 <printnum>
+			break;
+  8020c7:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8020ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8020cd:	e9 40 fc ff ff       	jmp    801d12 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8020d2:	83 f9 01             	cmp    $0x1,%ecx
+  8020d5:	7f 1b                	jg     8020f2 <vprintfmt+0x3fe>
+	else if (lflag)
+  8020d7:	85 c9                	test   %ecx,%ecx
+  8020d9:	74 2c                	je     802107 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8020db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020de:	8b 10                	mov    (%eax),%edx
+  8020e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8020e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8020eb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8020f0:	eb be                	jmp    8020b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020f5:	8b 10                	mov    (%eax),%edx
+  8020f7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020fa:	8d 40 08             	lea    0x8(%eax),%eax
+  8020fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802100:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802105:	eb a9                	jmp    8020b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802107:	8b 45 14             	mov    0x14(%ebp),%eax
+  80210a:	8b 10                	mov    (%eax),%edx
+  80210c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802111:	8d 40 04             	lea    0x4(%eax),%eax
+  802114:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802117:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80211c:	eb 92                	jmp    8020b0 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80211e:	83 ec 08             	sub    $0x8,%esp
+  802121:	53                   	push   %ebx
+  802122:	6a 25                	push   $0x25
+  802124:	ff d6                	call   *%esi
+			break;
+  802126:	83 c4 10             	add    $0x10,%esp
+  802129:	eb 9f                	jmp    8020ca <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80212b:	83 ec 08             	sub    $0x8,%esp
+  80212e:	53                   	push   %ebx
+  80212f:	6a 25                	push   $0x25
+  802131:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802133:	83 c4 10             	add    $0x10,%esp
+  802136:	89 f8                	mov    %edi,%eax
+  802138:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80213c:	74 05                	je     802143 <vprintfmt+0x44f>
+  80213e:	83 e8 01             	sub    $0x1,%eax
+  802141:	eb f5                	jmp    802138 <vprintfmt+0x444>
+  802143:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802146:	eb 82                	jmp    8020ca <vprintfmt+0x3d6>
+
+00802148 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802148:	55                   	push   %ebp
+  802149:	89 e5                	mov    %esp,%ebp
+  80214b:	83 ec 18             	sub    $0x18,%esp
+  80214e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802151:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802154:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802157:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80215b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80215e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802165:	85 c0                	test   %eax,%eax
+  802167:	74 26                	je     80218f <vsnprintf+0x47>
+  802169:	85 d2                	test   %edx,%edx
+  80216b:	7e 22                	jle    80218f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80216d:	ff 75 14             	push   0x14(%ebp)
+  802170:	ff 75 10             	push   0x10(%ebp)
+  802173:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802176:	50                   	push   %eax
+  802177:	68 ba 1c 80 00       	push   $0x801cba
+  80217c:	e8 73 fb ff ff       	call   801cf4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802181:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802184:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802187:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218a:	83 c4 10             	add    $0x10,%esp
+}
+  80218d:	c9                   	leave
+  80218e:	c3                   	ret
+		return -E_INVAL;
+  80218f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802194:	eb f7                	jmp    80218d <vsnprintf+0x45>
+
+00802196 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802196:	55                   	push   %ebp
+  802197:	89 e5                	mov    %esp,%ebp
+  802199:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80219c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80219f:	50                   	push   %eax
+  8021a0:	ff 75 10             	push   0x10(%ebp)
+  8021a3:	ff 75 0c             	push   0xc(%ebp)
+  8021a6:	ff 75 08             	push   0x8(%ebp)
+  8021a9:	e8 9a ff ff ff       	call   802148 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8021ae:	c9                   	leave
+  8021af:	c3                   	ret
+
+008021b0 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8021b0:	55                   	push   %ebp
+  8021b1:	89 e5                	mov    %esp,%ebp
+  8021b3:	57                   	push   %edi
+  8021b4:	56                   	push   %esi
+  8021b5:	53                   	push   %ebx
+  8021b6:	83 ec 18             	sub    $0x18,%esp
+  8021b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021bf:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8021c2:	85 db                	test   %ebx,%ebx
+  8021c4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021c9:	0f 45 c3             	cmovne %ebx,%eax
+  8021cc:	50                   	push   %eax
+  8021cd:	e8 9d e7 ff ff       	call   80096f <sys_ipc_recv>
+
+	if (from_env_store)
+  8021d2:	83 c4 10             	add    $0x10,%esp
+  8021d5:	85 ff                	test   %edi,%edi
+  8021d7:	74 17                	je     8021f0 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8021d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021de:	85 c0                	test   %eax,%eax
+  8021e0:	75 0c                	jne    8021ee <ipc_recv+0x3e>
+  8021e2:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  8021e8:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8021ee:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8021f0:	85 f6                	test   %esi,%esi
+  8021f2:	74 2e                	je     802222 <ipc_recv+0x72>
+		if (!r && pg)
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	75 24                	jne    80221c <ipc_recv+0x6c>
+  8021f8:	85 db                	test   %ebx,%ebx
+  8021fa:	74 20                	je     80221c <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8021fc:	a1 08 40 80 00       	mov    0x804008,%eax
+  802201:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802207:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802209:	a1 08 40 80 00       	mov    0x804008,%eax
+  80220e:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802214:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802217:	5b                   	pop    %ebx
+  802218:	5e                   	pop    %esi
+  802219:	5f                   	pop    %edi
+  80221a:	5d                   	pop    %ebp
+  80221b:	c3                   	ret
+			*perm_store = 0;
+  80221c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802222:	85 c0                	test   %eax,%eax
+  802224:	75 ee                	jne    802214 <ipc_recv+0x64>
+  802226:	eb e1                	jmp    802209 <ipc_recv+0x59>
+
+00802228 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802228:	55                   	push   %ebp
+  802229:	89 e5                	mov    %esp,%ebp
+  80222b:	57                   	push   %edi
+  80222c:	56                   	push   %esi
+  80222d:	53                   	push   %ebx
+  80222e:	83 ec 0c             	sub    $0xc,%esp
+  802231:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802234:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802237:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80223a:	85 db                	test   %ebx,%ebx
+  80223c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802241:	0f 44 d8             	cmove  %eax,%ebx
+  802244:	ff 75 14             	push   0x14(%ebp)
+  802247:	53                   	push   %ebx
+  802248:	56                   	push   %esi
+  802249:	57                   	push   %edi
+  80224a:	e8 fd e6 ff ff       	call   80094c <sys_ipc_try_send_yield>
+  80224f:	83 c4 10             	add    $0x10,%esp
+  802252:	85 c0                	test   %eax,%eax
+  802254:	79 1e                	jns    802274 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802256:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802259:	75 07                	jne    802262 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80225b:	e8 0c e3 ff ff       	call   80056c <sys_yield>
+  802260:	eb e2                	jmp    802244 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802262:	50                   	push   %eax
+  802263:	68 9f 2b 80 00       	push   $0x802b9f
+  802268:	6a 3d                	push   $0x3d
+  80226a:	68 b4 2b 80 00       	push   $0x802bb4
+  80226f:	e8 ae f8 ff ff       	call   801b22 <_panic>
+	}
+}
+  802274:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802277:	5b                   	pop    %ebx
+  802278:	5e                   	pop    %esi
+  802279:	5f                   	pop    %edi
+  80227a:	5d                   	pop    %ebp
+  80227b:	c3                   	ret
+
+0080227c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80227c:	55                   	push   %ebp
+  80227d:	89 e5                	mov    %esp,%ebp
+  80227f:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802282:	ff 75 08             	push   0x8(%ebp)
+  802285:	e8 62 e2 ff ff       	call   8004ec <sys_env_find>
+}
+  80228a:	c9                   	leave
+  80228b:	c3                   	ret
+
+0080228c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80228c:	55                   	push   %ebp
+  80228d:	89 e5                	mov    %esp,%ebp
+  80228f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802292:	89 c2                	mov    %eax,%edx
+  802294:	c1 ea 16             	shr    $0x16,%edx
+  802297:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80229e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8022a3:	f6 c1 01             	test   $0x1,%cl
+  8022a6:	74 22                	je     8022ca <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8022a8:	c1 e8 0c             	shr    $0xc,%eax
+  8022ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8022b2:	a8 01                	test   $0x1,%al
+  8022b4:	74 14                	je     8022ca <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8022b6:	c1 e8 0c             	shr    $0xc,%eax
+  8022b9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8022bc:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8022c3:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8022c7:	0f b7 d2             	movzwl %dx,%edx
+}
+  8022ca:	89 d0                	mov    %edx,%eax
+  8022cc:	5d                   	pop    %ebp
+  8022cd:	c3                   	ret
+  8022ce:	66 90                	xchg   %ax,%ax
+
+008022d0 <__udivmoddi4>:
+  8022d0:	55                   	push   %ebp
+  8022d1:	57                   	push   %edi
+  8022d2:	56                   	push   %esi
+  8022d3:	53                   	push   %ebx
+  8022d4:	83 ec 14             	sub    $0x14,%esp
+  8022d7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8022db:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8022df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022e7:	89 f1                	mov    %esi,%ecx
+  8022e9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022ed:	09 d9                	or     %ebx,%ecx
+  8022ef:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022f3:	0f 84 92 00 00 00    	je     80238b <__udivmoddi4+0xbb>
+  8022f9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802300:	00 
+  802301:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802306:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80230d:	00 
+  80230e:	89 1c 24             	mov    %ebx,(%esp)
+  802311:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802315:	8d 76 00             	lea    0x0(%esi),%esi
+  802318:	89 e9                	mov    %ebp,%ecx
+  80231a:	89 c3                	mov    %eax,%ebx
+  80231c:	89 d6                	mov    %edx,%esi
+  80231e:	31 ff                	xor    %edi,%edi
+  802320:	d3 ee                	shr    %cl,%esi
+  802322:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802325:	f6 c1 20             	test   $0x20,%cl
+  802328:	0f 45 de             	cmovne %esi,%ebx
+  80232b:	0f 45 f7             	cmovne %edi,%esi
+  80232e:	8b 3c 24             	mov    (%esp),%edi
+  802331:	39 fb                	cmp    %edi,%ebx
+  802333:	89 f7                	mov    %esi,%edi
+  802335:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802339:	8b 1c 24             	mov    (%esp),%ebx
+  80233c:	19 f7                	sbb    %esi,%edi
+  80233e:	72 39                	jb     802379 <__udivmoddi4+0xa9>
+  802340:	89 e9                	mov    %ebp,%ecx
+  802342:	89 f7                	mov    %esi,%edi
+  802344:	89 de                	mov    %ebx,%esi
+  802346:	0f a5 df             	shld   %cl,%ebx,%edi
+  802349:	d3 e6                	shl    %cl,%esi
+  80234b:	31 db                	xor    %ebx,%ebx
+  80234d:	f6 c1 20             	test   $0x20,%cl
+  802350:	0f 45 fe             	cmovne %esi,%edi
+  802353:	0f 45 f3             	cmovne %ebx,%esi
+  802356:	29 f0                	sub    %esi,%eax
+  802358:	be 01 00 00 00       	mov    $0x1,%esi
+  80235d:	19 fa                	sbb    %edi,%edx
+  80235f:	31 ff                	xor    %edi,%edi
+  802361:	31 db                	xor    %ebx,%ebx
+  802363:	0f a5 f7             	shld   %cl,%esi,%edi
+  802366:	d3 e6                	shl    %cl,%esi
+  802368:	f6 c1 20             	test   $0x20,%cl
+  80236b:	0f 45 fe             	cmovne %esi,%edi
+  80236e:	0f 45 f3             	cmovne %ebx,%esi
+  802371:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802375:	09 74 24 08          	or     %esi,0x8(%esp)
+  802379:	83 ed 01             	sub    $0x1,%ebp
+  80237c:	73 9a                	jae    802318 <__udivmoddi4+0x48>
+  80237e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802382:	85 ff                	test   %edi,%edi
+  802384:	74 05                	je     80238b <__udivmoddi4+0xbb>
+  802386:	89 07                	mov    %eax,(%edi)
+  802388:	89 57 04             	mov    %edx,0x4(%edi)
+  80238b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80238f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802393:	83 c4 14             	add    $0x14,%esp
+  802396:	5b                   	pop    %ebx
+  802397:	5e                   	pop    %esi
+  802398:	5f                   	pop    %edi
+  802399:	5d                   	pop    %ebp
+  80239a:	c3                   	ret
+  80239b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80239f:	90                   	nop
+
+008023a0 <__udivdi3>:
+  8023a0:	55                   	push   %ebp
+  8023a1:	57                   	push   %edi
+  8023a2:	56                   	push   %esi
+  8023a3:	53                   	push   %ebx
+  8023a4:	83 ec 14             	sub    $0x14,%esp
+  8023a7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8023ab:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8023af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8023b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8023b7:	89 fb                	mov    %edi,%ebx
+  8023b9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8023bd:	09 f3                	or     %esi,%ebx
+  8023bf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8023c3:	0f 84 85 00 00 00    	je     80244e <__udivdi3+0xae>
+  8023c9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8023d0:	00 
+  8023d1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8023d6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8023dd:	00 
+  8023de:	89 34 24             	mov    %esi,(%esp)
+  8023e1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023e5:	8d 76 00             	lea    0x0(%esi),%esi
+  8023e8:	89 e9                	mov    %ebp,%ecx
+  8023ea:	89 c3                	mov    %eax,%ebx
+  8023ec:	89 d6                	mov    %edx,%esi
+  8023ee:	31 ff                	xor    %edi,%edi
+  8023f0:	d3 ee                	shr    %cl,%esi
+  8023f2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8023f5:	f6 c1 20             	test   $0x20,%cl
+  8023f8:	0f 45 de             	cmovne %esi,%ebx
+  8023fb:	0f 45 f7             	cmovne %edi,%esi
+  8023fe:	8b 3c 24             	mov    (%esp),%edi
+  802401:	39 fb                	cmp    %edi,%ebx
+  802403:	89 f7                	mov    %esi,%edi
+  802405:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802409:	8b 1c 24             	mov    (%esp),%ebx
+  80240c:	19 f7                	sbb    %esi,%edi
+  80240e:	72 39                	jb     802449 <__udivdi3+0xa9>
+  802410:	89 e9                	mov    %ebp,%ecx
+  802412:	89 f7                	mov    %esi,%edi
+  802414:	89 de                	mov    %ebx,%esi
+  802416:	0f a5 df             	shld   %cl,%ebx,%edi
+  802419:	d3 e6                	shl    %cl,%esi
+  80241b:	31 db                	xor    %ebx,%ebx
+  80241d:	f6 c1 20             	test   $0x20,%cl
+  802420:	0f 45 fe             	cmovne %esi,%edi
+  802423:	0f 45 f3             	cmovne %ebx,%esi
+  802426:	29 f0                	sub    %esi,%eax
+  802428:	be 01 00 00 00       	mov    $0x1,%esi
+  80242d:	19 fa                	sbb    %edi,%edx
+  80242f:	31 ff                	xor    %edi,%edi
+  802431:	31 db                	xor    %ebx,%ebx
+  802433:	0f a5 f7             	shld   %cl,%esi,%edi
+  802436:	d3 e6                	shl    %cl,%esi
+  802438:	f6 c1 20             	test   $0x20,%cl
+  80243b:	0f 45 fe             	cmovne %esi,%edi
+  80243e:	0f 45 f3             	cmovne %ebx,%esi
+  802441:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802445:	09 74 24 08          	or     %esi,0x8(%esp)
+  802449:	83 ed 01             	sub    $0x1,%ebp
+  80244c:	73 9a                	jae    8023e8 <__udivdi3+0x48>
+  80244e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802452:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802456:	83 c4 14             	add    $0x14,%esp
+  802459:	5b                   	pop    %ebx
+  80245a:	5e                   	pop    %esi
+  80245b:	5f                   	pop    %edi
+  80245c:	5d                   	pop    %ebp
+  80245d:	c3                   	ret
+  80245e:	66 90                	xchg   %ax,%ax
+
+00802460 <__umoddi3>:
+  802460:	57                   	push   %edi
+  802461:	56                   	push   %esi
+  802462:	53                   	push   %ebx
+  802463:	83 ec 08             	sub    $0x8,%esp
+  802466:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80246a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80246e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802472:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802476:	89 f9                	mov    %edi,%ecx
+  802478:	89 34 24             	mov    %esi,(%esp)
+  80247b:	09 f1                	or     %esi,%ecx
+  80247d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802481:	74 53                	je     8024d6 <__umoddi3+0x76>
+  802483:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802488:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80248f:	90                   	nop
+  802490:	89 c6                	mov    %eax,%esi
+  802492:	89 d7                	mov    %edx,%edi
+  802494:	31 db                	xor    %ebx,%ebx
+  802496:	d3 ef                	shr    %cl,%edi
+  802498:	0f ad d6             	shrd   %cl,%edx,%esi
+  80249b:	f6 c1 20             	test   $0x20,%cl
+  80249e:	0f 45 f7             	cmovne %edi,%esi
+  8024a1:	0f 45 fb             	cmovne %ebx,%edi
+  8024a4:	8b 1c 24             	mov    (%esp),%ebx
+  8024a7:	39 de                	cmp    %ebx,%esi
+  8024a9:	89 fb                	mov    %edi,%ebx
+  8024ab:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8024af:	8b 34 24             	mov    (%esp),%esi
+  8024b2:	19 fb                	sbb    %edi,%ebx
+  8024b4:	72 14                	jb     8024ca <__umoddi3+0x6a>
+  8024b6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8024b9:	31 db                	xor    %ebx,%ebx
+  8024bb:	d3 e6                	shl    %cl,%esi
+  8024bd:	f6 c1 20             	test   $0x20,%cl
+  8024c0:	0f 45 fe             	cmovne %esi,%edi
+  8024c3:	0f 45 f3             	cmovne %ebx,%esi
+  8024c6:	29 f0                	sub    %esi,%eax
+  8024c8:	19 fa                	sbb    %edi,%edx
+  8024ca:	83 e9 01             	sub    $0x1,%ecx
+  8024cd:	73 c1                	jae    802490 <__umoddi3+0x30>
+  8024cf:	83 c4 08             	add    $0x8,%esp
+  8024d2:	5b                   	pop    %ebx
+  8024d3:	5e                   	pop    %esi
+  8024d4:	5f                   	pop    %edi
+  8024d5:	c3                   	ret
+  8024d6:	83 c4 08             	add    $0x8,%esp
+  8024d9:	31 c0                	xor    %eax,%eax
+  8024db:	31 d2                	xor    %edx,%edx
+  8024dd:	5b                   	pop    %ebx
+  8024de:	5e                   	pop    %esi
+  8024df:	5f                   	pop    %edi
+  8024e0:	c3                   	ret
+  8024e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024ef:	90                   	nop
+
+008024f0 <__divdi3>:
+  8024f0:	55                   	push   %ebp
+  8024f1:	57                   	push   %edi
+  8024f2:	56                   	push   %esi
+  8024f3:	53                   	push   %ebx
+  8024f4:	83 ec 1c             	sub    $0x1c,%esp
+  8024f7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8024fb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8024ff:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802503:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802507:	85 ff                	test   %edi,%edi
+  802509:	0f 88 da 00 00 00    	js     8025e9 <__divdi3+0xf9>
+  80250f:	85 db                	test   %ebx,%ebx
+  802511:	78 16                	js     802529 <__divdi3+0x39>
+  802513:	89 dd                	mov    %ebx,%ebp
+  802515:	89 c8                	mov    %ecx,%eax
+  802517:	89 da                	mov    %ebx,%edx
+  802519:	09 cd                	or     %ecx,%ebp
+  80251b:	0f 85 fd 00 00 00    	jne    80261e <__divdi3+0x12e>
+  802521:	83 c4 1c             	add    $0x1c,%esp
+  802524:	5b                   	pop    %ebx
+  802525:	5e                   	pop    %esi
+  802526:	5f                   	pop    %edi
+  802527:	5d                   	pop    %ebp
+  802528:	c3                   	ret
+  802529:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80252e:	f7 d9                	neg    %ecx
+  802530:	89 f0                	mov    %esi,%eax
+  802532:	89 fa                	mov    %edi,%edx
+  802534:	83 d3 00             	adc    $0x0,%ebx
+  802537:	89 0c 24             	mov    %ecx,(%esp)
+  80253a:	f7 db                	neg    %ebx
+  80253c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802540:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802547:	00 
+  802548:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80254d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802554:	00 
+  802555:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802559:	89 cd                	mov    %ecx,%ebp
+  80255b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80255f:	90                   	nop
+  802560:	89 e9                	mov    %ebp,%ecx
+  802562:	89 c3                	mov    %eax,%ebx
+  802564:	89 d6                	mov    %edx,%esi
+  802566:	31 ff                	xor    %edi,%edi
+  802568:	d3 ee                	shr    %cl,%esi
+  80256a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80256d:	f6 c1 20             	test   $0x20,%cl
+  802570:	0f 45 de             	cmovne %esi,%ebx
+  802573:	0f 45 f7             	cmovne %edi,%esi
+  802576:	8b 3c 24             	mov    (%esp),%edi
+  802579:	39 fb                	cmp    %edi,%ebx
+  80257b:	89 f7                	mov    %esi,%edi
+  80257d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802581:	8b 1c 24             	mov    (%esp),%ebx
+  802584:	19 f7                	sbb    %esi,%edi
+  802586:	72 39                	jb     8025c1 <__divdi3+0xd1>
+  802588:	89 e9                	mov    %ebp,%ecx
+  80258a:	89 f7                	mov    %esi,%edi
+  80258c:	89 de                	mov    %ebx,%esi
+  80258e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802591:	d3 e6                	shl    %cl,%esi
+  802593:	31 db                	xor    %ebx,%ebx
+  802595:	f6 c1 20             	test   $0x20,%cl
+  802598:	0f 45 fe             	cmovne %esi,%edi
+  80259b:	0f 45 f3             	cmovne %ebx,%esi
+  80259e:	29 f0                	sub    %esi,%eax
+  8025a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8025a5:	19 fa                	sbb    %edi,%edx
+  8025a7:	31 ff                	xor    %edi,%edi
+  8025a9:	31 db                	xor    %ebx,%ebx
+  8025ab:	0f a5 f7             	shld   %cl,%esi,%edi
+  8025ae:	d3 e6                	shl    %cl,%esi
+  8025b0:	f6 c1 20             	test   $0x20,%cl
+  8025b3:	0f 45 fe             	cmovne %esi,%edi
+  8025b6:	0f 45 f3             	cmovne %ebx,%esi
+  8025b9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8025bd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8025c1:	83 ed 01             	sub    $0x1,%ebp
+  8025c4:	73 9a                	jae    802560 <__divdi3+0x70>
+  8025c6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8025ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025d2:	85 ed                	test   %ebp,%ebp
+  8025d4:	0f 84 47 ff ff ff    	je     802521 <__divdi3+0x31>
+  8025da:	f7 d8                	neg    %eax
+  8025dc:	83 d2 00             	adc    $0x0,%edx
+  8025df:	83 c4 1c             	add    $0x1c,%esp
+  8025e2:	5b                   	pop    %ebx
+  8025e3:	f7 da                	neg    %edx
+  8025e5:	5e                   	pop    %esi
+  8025e6:	5f                   	pop    %edi
+  8025e7:	5d                   	pop    %ebp
+  8025e8:	c3                   	ret
+  8025e9:	f7 de                	neg    %esi
+  8025eb:	83 d7 00             	adc    $0x0,%edi
+  8025ee:	f7 df                	neg    %edi
+  8025f0:	85 db                	test   %ebx,%ebx
+  8025f2:	78 23                	js     802617 <__divdi3+0x127>
+  8025f4:	89 dd                	mov    %ebx,%ebp
+  8025f6:	89 c8                	mov    %ecx,%eax
+  8025f8:	89 da                	mov    %ebx,%edx
+  8025fa:	09 cd                	or     %ecx,%ebp
+  8025fc:	0f 84 1f ff ff ff    	je     802521 <__divdi3+0x31>
+  802602:	89 0c 24             	mov    %ecx,(%esp)
+  802605:	89 f0                	mov    %esi,%eax
+  802607:	89 fa                	mov    %edi,%edx
+  802609:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80260e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802612:	e9 29 ff ff ff       	jmp    802540 <__divdi3+0x50>
+  802617:	31 ed                	xor    %ebp,%ebp
+  802619:	e9 10 ff ff ff       	jmp    80252e <__divdi3+0x3e>
+  80261e:	89 0c 24             	mov    %ecx,(%esp)
+  802621:	89 f0                	mov    %esi,%eax
+  802623:	89 fa                	mov    %edi,%edx
+  802625:	31 ed                	xor    %ebp,%ebp
+  802627:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80262b:	e9 10 ff ff ff       	jmp    802540 <__divdi3+0x50>
+
+00802630 <__moddi3>:
+  802630:	55                   	push   %ebp
+  802631:	57                   	push   %edi
+  802632:	56                   	push   %esi
+  802633:	53                   	push   %ebx
+  802634:	83 ec 14             	sub    $0x14,%esp
+  802637:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80263b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80263f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802643:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802647:	85 d2                	test   %edx,%edx
+  802649:	0f 88 9b 00 00 00    	js     8026ea <__moddi3+0xba>
+  80264f:	89 f7                	mov    %esi,%edi
+  802651:	31 ed                	xor    %ebp,%ebp
+  802653:	09 cf                	or     %ecx,%edi
+  802655:	0f 84 83 00 00 00    	je     8026de <__moddi3+0xae>
+  80265b:	89 cb                	mov    %ecx,%ebx
+  80265d:	89 f7                	mov    %esi,%edi
+  80265f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802663:	f7 db                	neg    %ebx
+  802665:	83 d7 00             	adc    $0x0,%edi
+  802668:	f7 df                	neg    %edi
+  80266a:	0f 49 f7             	cmovns %edi,%esi
+  80266d:	0f 49 cb             	cmovns %ebx,%ecx
+  802670:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802674:	89 0c 24             	mov    %ecx,(%esp)
+  802677:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80267c:	89 cd                	mov    %ecx,%ebp
+  80267e:	66 90                	xchg   %ax,%ax
+  802680:	89 e9                	mov    %ebp,%ecx
+  802682:	89 c3                	mov    %eax,%ebx
+  802684:	89 d6                	mov    %edx,%esi
+  802686:	31 ff                	xor    %edi,%edi
+  802688:	d3 ee                	shr    %cl,%esi
+  80268a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80268d:	f6 c1 20             	test   $0x20,%cl
+  802690:	0f 45 de             	cmovne %esi,%ebx
+  802693:	0f 45 f7             	cmovne %edi,%esi
+  802696:	8b 3c 24             	mov    (%esp),%edi
+  802699:	39 fb                	cmp    %edi,%ebx
+  80269b:	89 f7                	mov    %esi,%edi
+  80269d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8026a1:	8b 1c 24             	mov    (%esp),%ebx
+  8026a4:	19 f7                	sbb    %esi,%edi
+  8026a6:	72 1a                	jb     8026c2 <__moddi3+0x92>
+  8026a8:	89 e9                	mov    %ebp,%ecx
+  8026aa:	89 f7                	mov    %esi,%edi
+  8026ac:	89 de                	mov    %ebx,%esi
+  8026ae:	0f a5 df             	shld   %cl,%ebx,%edi
+  8026b1:	d3 e6                	shl    %cl,%esi
+  8026b3:	31 db                	xor    %ebx,%ebx
+  8026b5:	f6 c1 20             	test   $0x20,%cl
+  8026b8:	0f 45 fe             	cmovne %esi,%edi
+  8026bb:	0f 45 f3             	cmovne %ebx,%esi
+  8026be:	29 f0                	sub    %esi,%eax
+  8026c0:	19 fa                	sbb    %edi,%edx
+  8026c2:	83 ed 01             	sub    $0x1,%ebp
+  8026c5:	73 b9                	jae    802680 <__moddi3+0x50>
+  8026c7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  8026cb:	85 ed                	test   %ebp,%ebp
+  8026cd:	74 07                	je     8026d6 <__moddi3+0xa6>
+  8026cf:	f7 d8                	neg    %eax
+  8026d1:	83 d2 00             	adc    $0x0,%edx
+  8026d4:	f7 da                	neg    %edx
+  8026d6:	83 c4 14             	add    $0x14,%esp
+  8026d9:	5b                   	pop    %ebx
+  8026da:	5e                   	pop    %esi
+  8026db:	5f                   	pop    %edi
+  8026dc:	5d                   	pop    %ebp
+  8026dd:	c3                   	ret
+  8026de:	83 c4 14             	add    $0x14,%esp
+  8026e1:	31 c0                	xor    %eax,%eax
+  8026e3:	31 d2                	xor    %edx,%edx
+  8026e5:	5b                   	pop    %ebx
+  8026e6:	5e                   	pop    %esi
+  8026e7:	5f                   	pop    %edi
+  8026e8:	5d                   	pop    %ebp
+  8026e9:	c3                   	ret
+  8026ea:	89 f7                	mov    %esi,%edi
+  8026ec:	09 cf                	or     %ecx,%edi
+  8026ee:	74 11                	je     802701 <__moddi3+0xd1>
+  8026f0:	f7 d8                	neg    %eax
+  8026f2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8026f7:	83 d2 00             	adc    $0x0,%edx
+  8026fa:	f7 da                	neg    %edx
+  8026fc:	e9 5a ff ff ff       	jmp    80265b <__moddi3+0x2b>
+  802701:	31 c0                	xor    %eax,%eax
+  802703:	31 d2                	xor    %edx,%edx
+  802705:	eb c8                	jmp    8026cf <__moddi3+0x9f>
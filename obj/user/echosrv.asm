@@ -0,0 +1,6205 @@
+
+obj/user/echosrv.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 be 04 00 00       	call   8004ef <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+#define BUFFSIZE 32
+#define MAXPENDING 5    // Max connection requests
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 70 2b 80 00       	push   $0x802b70
+  80003f:	e8 a0 05 00 00       	call   8005e4 <cprintf>
+	exit();
+  800044:	e8 ec 04 00 00       	call   800535 <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <handle_client>:
+
+void
+handle_client(int sock)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 30             	sub    $0x30,%esp
+  800057:	8b 75 08             	mov    0x8(%ebp),%esi
+	char buffer[BUFFSIZE];
+	int received = -1;
+	// Receive message
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80005a:	6a 20                	push   $0x20
+  80005c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	56                   	push   %esi
+  800061:	e8 e1 16 00 00       	call   801747 <read>
+  800066:	89 c3                	mov    %eax,%ebx
+  800068:	83 c4 10             	add    $0x10,%esp
+		die("Failed to receive initial bytes from client");
+
+	// Send bytes and check for more incoming data in loop
+	while (received > 0) {
+		// Send back received data
+		if (write(sock, buffer, received) != received)
+  80006b:	8d 7d c8             	lea    -0x38(%ebp),%edi
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80006e:	85 c0                	test   %eax,%eax
+  800070:	79 33                	jns    8000a5 <handle_client+0x57>
+		die("Failed to receive initial bytes from client");
+  800072:	b8 74 2b 80 00       	mov    $0x802b74,%eax
+  800077:	e8 b7 ff ff ff       	call   800033 <die>
+
+		// Check for more data
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+			die("Failed to receive additional bytes from client");
+	}
+	close(sock);
+  80007c:	83 ec 0c             	sub    $0xc,%esp
+  80007f:	56                   	push   %esi
+  800080:	e8 86 15 00 00       	call   80160b <close>
+}
+  800085:	83 c4 10             	add    $0x10,%esp
+  800088:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5f                   	pop    %edi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  800090:	83 ec 04             	sub    $0x4,%esp
+  800093:	6a 20                	push   $0x20
+  800095:	57                   	push   %edi
+  800096:	56                   	push   %esi
+  800097:	e8 ab 16 00 00       	call   801747 <read>
+  80009c:	89 c3                	mov    %eax,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	85 c0                	test   %eax,%eax
+  8000a3:	78 22                	js     8000c7 <handle_client+0x79>
+	while (received > 0) {
+  8000a5:	85 db                	test   %ebx,%ebx
+  8000a7:	7e d3                	jle    80007c <handle_client+0x2e>
+		if (write(sock, buffer, received) != received)
+  8000a9:	83 ec 04             	sub    $0x4,%esp
+  8000ac:	53                   	push   %ebx
+  8000ad:	57                   	push   %edi
+  8000ae:	56                   	push   %esi
+  8000af:	e8 61 17 00 00       	call   801815 <write>
+  8000b4:	83 c4 10             	add    $0x10,%esp
+  8000b7:	39 d8                	cmp    %ebx,%eax
+  8000b9:	74 d5                	je     800090 <handle_client+0x42>
+			die("Failed to send bytes to client");
+  8000bb:	b8 a0 2b 80 00       	mov    $0x802ba0,%eax
+  8000c0:	e8 6e ff ff ff       	call   800033 <die>
+  8000c5:	eb c9                	jmp    800090 <handle_client+0x42>
+			die("Failed to receive additional bytes from client");
+  8000c7:	b8 c0 2b 80 00       	mov    $0x802bc0,%eax
+  8000cc:	e8 62 ff ff ff       	call   800033 <die>
+  8000d1:	eb d2                	jmp    8000a5 <handle_client+0x57>
+
+008000d3 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000d3:	55                   	push   %ebp
+  8000d4:	89 e5                	mov    %esp,%ebp
+  8000d6:	57                   	push   %edi
+  8000d7:	56                   	push   %esi
+  8000d8:	53                   	push   %ebx
+  8000d9:	83 ec 40             	sub    $0x40,%esp
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  8000dc:	6a 06                	push   $0x6
+  8000de:	6a 01                	push   $0x1
+  8000e0:	6a 02                	push   $0x2
+  8000e2:	e8 51 1d 00 00       	call   801e38 <socket>
+  8000e7:	89 c6                	mov    %eax,%esi
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	85 c0                	test   %eax,%eax
+  8000ee:	0f 88 86 00 00 00    	js     80017a <umain+0xa7>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	68 38 2b 80 00       	push   $0x802b38
+  8000fc:	e8 e3 04 00 00       	call   8005e4 <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  800101:	83 c4 0c             	add    $0xc,%esp
+  800104:	6a 10                	push   $0x10
+  800106:	6a 00                	push   $0x0
+  800108:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  80010b:	53                   	push   %ebx
+  80010c:	e8 12 0c 00 00       	call   800d23 <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  800111:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = htonl(INADDR_ANY);   // IP address
+  800115:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80011c:	e8 90 01 00 00       	call   8002b1 <htonl>
+  800121:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  800124:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80012b:	e8 67 01 00 00       	call   800297 <htons>
+  800130:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to bind\n");
+  800134:	c7 04 24 47 2b 80 00 	movl   $0x802b47,(%esp)
+  80013b:	e8 a4 04 00 00       	call   8005e4 <cprintf>
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &echoserver,
+  800140:	83 c4 0c             	add    $0xc,%esp
+  800143:	6a 10                	push   $0x10
+  800145:	53                   	push   %ebx
+  800146:	56                   	push   %esi
+  800147:	e8 5a 1c 00 00       	call   801da6 <bind>
+  80014c:	83 c4 10             	add    $0x10,%esp
+  80014f:	85 c0                	test   %eax,%eax
+  800151:	78 36                	js     800189 <umain+0xb6>
+		 sizeof(echoserver)) < 0) {
+		die("Failed to bind the server socket");
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  800153:	83 ec 08             	sub    $0x8,%esp
+  800156:	6a 05                	push   $0x5
+  800158:	56                   	push   %esi
+  800159:	e8 b7 1c 00 00       	call   801e15 <listen>
+  80015e:	83 c4 10             	add    $0x10,%esp
+  800161:	85 c0                	test   %eax,%eax
+  800163:	78 30                	js     800195 <umain+0xc2>
+		die("Failed to listen on server socket");
+
+	cprintf("bound\n");
+  800165:	83 ec 0c             	sub    $0xc,%esp
+  800168:	68 57 2b 80 00       	push   $0x802b57
+  80016d:	e8 72 04 00 00       	call   8005e4 <cprintf>
+  800172:	83 c4 10             	add    $0x10,%esp
+	// Run until canceled
+	while (1) {
+		unsigned int clientlen = sizeof(echoclient);
+		// Wait for client connection
+		if ((clientsock =
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  800175:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  800178:	eb 55                	jmp    8001cf <umain+0xfc>
+		die("Failed to create socket");
+  80017a:	b8 20 2b 80 00       	mov    $0x802b20,%eax
+  80017f:	e8 af fe ff ff       	call   800033 <die>
+  800184:	e9 6b ff ff ff       	jmp    8000f4 <umain+0x21>
+		die("Failed to bind the server socket");
+  800189:	b8 f0 2b 80 00       	mov    $0x802bf0,%eax
+  80018e:	e8 a0 fe ff ff       	call   800033 <die>
+  800193:	eb be                	jmp    800153 <umain+0x80>
+		die("Failed to listen on server socket");
+  800195:	b8 14 2c 80 00       	mov    $0x802c14,%eax
+  80019a:	e8 94 fe ff ff       	call   800033 <die>
+  80019f:	eb c4                	jmp    800165 <umain+0x92>
+			    &clientlen)) < 0) {
+			die("Failed to accept client connection");
+  8001a1:	b8 38 2c 80 00       	mov    $0x802c38,%eax
+  8001a6:	e8 88 fe ff ff       	call   800033 <die>
+		}
+		cprintf("Client connected: %s\n", inet_ntoa(echoclient.sin_addr));
+  8001ab:	83 ec 0c             	sub    $0xc,%esp
+  8001ae:	ff 75 cc             	push   -0x34(%ebp)
+  8001b1:	e8 39 00 00 00       	call   8001ef <inet_ntoa>
+  8001b6:	83 c4 08             	add    $0x8,%esp
+  8001b9:	50                   	push   %eax
+  8001ba:	68 5e 2b 80 00       	push   $0x802b5e
+  8001bf:	e8 20 04 00 00       	call   8005e4 <cprintf>
+		handle_client(clientsock);
+  8001c4:	89 1c 24             	mov    %ebx,(%esp)
+  8001c7:	e8 82 fe ff ff       	call   80004e <handle_client>
+	while (1) {
+  8001cc:	83 c4 10             	add    $0x10,%esp
+		unsigned int clientlen = sizeof(echoclient);
+  8001cf:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  8001d6:	83 ec 04             	sub    $0x4,%esp
+  8001d9:	57                   	push   %edi
+  8001da:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8001dd:	50                   	push   %eax
+  8001de:	56                   	push   %esi
+  8001df:	e8 93 1b 00 00       	call   801d77 <accept>
+  8001e4:	89 c3                	mov    %eax,%ebx
+		if ((clientsock =
+  8001e6:	83 c4 10             	add    $0x10,%esp
+  8001e9:	85 c0                	test   %eax,%eax
+  8001eb:	78 b4                	js     8001a1 <umain+0xce>
+  8001ed:	eb bc                	jmp    8001ab <umain+0xd8>
+
+008001ef <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8001ef:	55                   	push   %ebp
+  8001f0:	89 e5                	mov    %esp,%ebp
+  8001f2:	57                   	push   %edi
+  8001f3:	56                   	push   %esi
+  8001f4:	53                   	push   %ebx
+  8001f5:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8001f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001fb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8001fe:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  800201:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  800206:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  80020b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80020e:	eb 31                	jmp    800241 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  800210:	0f b6 c8             	movzbl %al,%ecx
+  800213:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800218:	88 0a                	mov    %cl,(%edx)
+  80021a:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  80021d:	83 e8 01             	sub    $0x1,%eax
+  800220:	3c ff                	cmp    $0xff,%al
+  800222:	75 ec                	jne    800210 <inet_ntoa+0x21>
+  800224:	0f b6 db             	movzbl %bl,%ebx
+  800227:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80022a:	01 d8                	add    %ebx,%eax
+  80022c:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  80022e:	8d 40 01             	lea    0x1(%eax),%eax
+  800231:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800234:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  800237:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  80023a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80023d:	39 c7                	cmp    %eax,%edi
+  80023f:	74 46                	je     800287 <inet_ntoa+0x98>
+  800241:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800249:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  80024c:	89 f0                	mov    %esi,%eax
+  80024e:	f6 e2                	mul    %dl
+  800250:	66 c1 e8 0b          	shr    $0xb,%ax
+  800254:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  800257:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  80025a:	01 c9                	add    %ecx,%ecx
+  80025c:	89 d0                	mov    %edx,%eax
+  80025e:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800260:	89 d7                	mov    %edx,%edi
+  800262:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800266:	89 d9                	mov    %ebx,%ecx
+  800268:	83 c3 01             	add    $0x1,%ebx
+  80026b:	0f b6 c9             	movzbl %cl,%ecx
+  80026e:	83 c0 30             	add    $0x30,%eax
+  800271:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  800275:	89 f8                	mov    %edi,%eax
+  800277:	3c 09                	cmp    $0x9,%al
+  800279:	77 d1                	ja     80024c <inet_ntoa+0x5d>
+  80027b:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80027e:	88 17                	mov    %dl,(%edi)
+  800280:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800283:	89 d8                	mov    %ebx,%eax
+  800285:	eb 96                	jmp    80021d <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  800287:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  80028a:	b8 00 50 80 00       	mov    $0x805000,%eax
+  80028f:	83 c4 1c             	add    $0x1c,%esp
+  800292:	5b                   	pop    %ebx
+  800293:	5e                   	pop    %esi
+  800294:	5f                   	pop    %edi
+  800295:	5d                   	pop    %ebp
+  800296:	c3                   	ret
+
+00800297 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80029a:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80029e:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  8002a2:	5d                   	pop    %ebp
+  8002a3:	c3                   	ret
+
+008002a4 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8002a7:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8002ab:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  8002af:	5d                   	pop    %ebp
+  8002b0:	c3                   	ret
+
+008002b1 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  8002b1:	55                   	push   %ebp
+  8002b2:	89 e5                	mov    %esp,%ebp
+  8002b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  8002b7:	89 d0                	mov    %edx,%eax
+  8002b9:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8002bc:	89 d1                	mov    %edx,%ecx
+  8002be:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002c1:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8002c3:	89 d1                	mov    %edx,%ecx
+  8002c5:	c1 e1 08             	shl    $0x8,%ecx
+  8002c8:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002ce:	09 c8                	or     %ecx,%eax
+  8002d0:	c1 ea 08             	shr    $0x8,%edx
+  8002d3:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8002d9:	09 d0                	or     %edx,%eax
+}
+  8002db:	5d                   	pop    %ebp
+  8002dc:	c3                   	ret
+
+008002dd <inet_aton>:
+{
+  8002dd:	55                   	push   %ebp
+  8002de:	89 e5                	mov    %esp,%ebp
+  8002e0:	57                   	push   %edi
+  8002e1:	56                   	push   %esi
+  8002e2:	53                   	push   %ebx
+  8002e3:	83 ec 2c             	sub    $0x2c,%esp
+  8002e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8002e9:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8002ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8002ef:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8002f2:	e9 9b 00 00 00       	jmp    800392 <inet_aton+0xb5>
+      c = *++cp;
+  8002f7:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8002fb:	89 c1                	mov    %eax,%ecx
+  8002fd:	83 e1 df             	and    $0xffffffdf,%ecx
+  800300:	80 f9 58             	cmp    $0x58,%cl
+  800303:	74 10                	je     800315 <inet_aton+0x38>
+      c = *++cp;
+  800305:	83 c2 01             	add    $0x1,%edx
+  800308:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  80030b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800310:	e9 97 00 00 00       	jmp    8003ac <inet_aton+0xcf>
+        c = *++cp;
+  800315:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800319:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  80031c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800321:	e9 86 00 00 00       	jmp    8003ac <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  800326:	0f af d7             	imul   %edi,%edx
+  800329:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  80032d:	0f be 01             	movsbl (%ecx),%eax
+  800330:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800333:	88 45 d7             	mov    %al,-0x29(%ebp)
+  800336:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800339:	80 fb 09             	cmp    $0x9,%bl
+  80033c:	76 e8                	jbe    800326 <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  80033e:	83 ff 10             	cmp    $0x10,%edi
+  800341:	75 2e                	jne    800371 <inet_aton+0x94>
+  800343:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  800347:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80034a:	83 e3 df             	and    $0xffffffdf,%ebx
+  80034d:	83 eb 41             	sub    $0x41,%ebx
+  800350:	80 fb 05             	cmp    $0x5,%bl
+  800353:	77 1c                	ja     800371 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800355:	c1 e2 04             	shl    $0x4,%edx
+  800358:	83 c0 0a             	add    $0xa,%eax
+  80035b:	89 f3                	mov    %esi,%ebx
+  80035d:	80 fb 1a             	cmp    $0x1a,%bl
+  800360:	19 db                	sbb    %ebx,%ebx
+  800362:	83 e3 20             	and    $0x20,%ebx
+  800365:	83 c3 41             	add    $0x41,%ebx
+  800368:	29 d8                	sub    %ebx,%eax
+  80036a:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  80036c:	0f be 01             	movsbl (%ecx),%eax
+  80036f:	eb bf                	jmp    800330 <inet_aton+0x53>
+    if (c == '.') {
+  800371:	83 f8 2e             	cmp    $0x2e,%eax
+  800374:	75 43                	jne    8003b9 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  800376:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800379:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80037c:	39 f0                	cmp    %esi,%eax
+  80037e:	0f 84 22 01 00 00    	je     8004a6 <inet_aton+0x1c9>
+      *pp++ = val;
+  800384:	83 c0 04             	add    $0x4,%eax
+  800387:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038a:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  80038d:	89 ca                	mov    %ecx,%edx
+  80038f:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  800392:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800395:	80 f9 09             	cmp    $0x9,%cl
+  800398:	0f 87 01 01 00 00    	ja     80049f <inet_aton+0x1c2>
+    base = 10;
+  80039e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  8003a3:	83 f8 30             	cmp    $0x30,%eax
+  8003a6:	0f 84 4b ff ff ff    	je     8002f7 <inet_aton+0x1a>
+  8003ac:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  8003af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b4:	e9 7a ff ff ff       	jmp    800333 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003b9:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8003bd:	89 d6                	mov    %edx,%esi
+  8003bf:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8003c2:	85 c0                	test   %eax,%eax
+  8003c4:	74 2e                	je     8003f4 <inet_aton+0x117>
+    return (0);
+  8003c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003cb:	89 fa                	mov    %edi,%edx
+  8003cd:	80 fa 1f             	cmp    $0x1f,%dl
+  8003d0:	0f 86 d5 00 00 00    	jbe    8004ab <inet_aton+0x1ce>
+  8003d6:	84 c0                	test   %al,%al
+  8003d8:	0f 88 cd 00 00 00    	js     8004ab <inet_aton+0x1ce>
+  8003de:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8003e1:	83 f9 04             	cmp    $0x4,%ecx
+  8003e4:	76 0e                	jbe    8003f4 <inet_aton+0x117>
+    return (0);
+  8003e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003eb:	83 f8 20             	cmp    $0x20,%eax
+  8003ee:	0f 85 b7 00 00 00    	jne    8004ab <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8003f4:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8003f7:	89 d8                	mov    %ebx,%eax
+  8003f9:	29 c8                	sub    %ecx,%eax
+  8003fb:	c1 f8 02             	sar    $0x2,%eax
+  8003fe:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  800401:	83 f8 02             	cmp    $0x2,%eax
+  800404:	74 7a                	je     800480 <inet_aton+0x1a3>
+  800406:	83 f9 03             	cmp    $0x3,%ecx
+  800409:	7f 49                	jg     800454 <inet_aton+0x177>
+  80040b:	85 c9                	test   %ecx,%ecx
+  80040d:	0f 84 98 00 00 00    	je     8004ab <inet_aton+0x1ce>
+  800413:	83 f9 02             	cmp    $0x2,%ecx
+  800416:	75 19                	jne    800431 <inet_aton+0x154>
+      return (0);
+  800418:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  80041d:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  800423:	0f 87 82 00 00 00    	ja     8004ab <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800429:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80042c:	c1 e0 18             	shl    $0x18,%eax
+  80042f:	09 c6                	or     %eax,%esi
+  return (1);
+  800431:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  800436:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80043a:	74 6f                	je     8004ab <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  80043c:	83 ec 0c             	sub    $0xc,%esp
+  80043f:	56                   	push   %esi
+  800440:	e8 6c fe ff ff       	call   8002b1 <htonl>
+  800445:	83 c4 10             	add    $0x10,%esp
+  800448:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80044b:	89 06                	mov    %eax,(%esi)
+  return (1);
+  80044d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800452:	eb 57                	jmp    8004ab <inet_aton+0x1ce>
+  switch (n) {
+  800454:	83 f9 04             	cmp    $0x4,%ecx
+  800457:	75 d8                	jne    800431 <inet_aton+0x154>
+      return (0);
+  800459:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  80045e:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800464:	77 45                	ja     8004ab <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  800466:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800469:	c1 e0 18             	shl    $0x18,%eax
+  80046c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80046f:	c1 e1 10             	shl    $0x10,%ecx
+  800472:	09 c8                	or     %ecx,%eax
+  800474:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800477:	c1 e1 08             	shl    $0x8,%ecx
+  80047a:	09 c8                	or     %ecx,%eax
+  80047c:	09 c6                	or     %eax,%esi
+    break;
+  80047e:	eb b1                	jmp    800431 <inet_aton+0x154>
+      return (0);
+  800480:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  800485:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  80048b:	77 1e                	ja     8004ab <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  80048d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800490:	c1 e0 18             	shl    $0x18,%eax
+  800493:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800496:	c1 e1 10             	shl    $0x10,%ecx
+  800499:	09 c8                	or     %ecx,%eax
+  80049b:	09 c6                	or     %eax,%esi
+    break;
+  80049d:	eb 92                	jmp    800431 <inet_aton+0x154>
+      return (0);
+  80049f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004a4:	eb 05                	jmp    8004ab <inet_aton+0x1ce>
+        return (0);
+  8004a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  8004ab:	89 c8                	mov    %ecx,%eax
+  8004ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b0:	5b                   	pop    %ebx
+  8004b1:	5e                   	pop    %esi
+  8004b2:	5f                   	pop    %edi
+  8004b3:	5d                   	pop    %ebp
+  8004b4:	c3                   	ret
+
+008004b5 <inet_addr>:
+{
+  8004b5:	55                   	push   %ebp
+  8004b6:	89 e5                	mov    %esp,%ebp
+  8004b8:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8004bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004be:	50                   	push   %eax
+  8004bf:	ff 75 08             	push   0x8(%ebp)
+  8004c2:	e8 16 fe ff ff       	call   8002dd <inet_aton>
+  8004c7:	89 c2                	mov    %eax,%edx
+  8004c9:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8004cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8004d1:	85 d2                	test   %edx,%edx
+  8004d3:	75 02                	jne    8004d7 <inet_addr+0x22>
+}
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+    return (val.s_addr);
+  8004d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004da:	eb f9                	jmp    8004d5 <inet_addr+0x20>
+
+008004dc <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8004dc:	55                   	push   %ebp
+  8004dd:	89 e5                	mov    %esp,%ebp
+  8004df:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8004e2:	ff 75 08             	push   0x8(%ebp)
+  8004e5:	e8 c7 fd ff ff       	call   8002b1 <htonl>
+  8004ea:	83 c4 10             	add    $0x10,%esp
+}
+  8004ed:	c9                   	leave
+  8004ee:	c3                   	ret
+
+008004ef <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004ef:	55                   	push   %ebp
+  8004f0:	89 e5                	mov    %esp,%ebp
+  8004f2:	56                   	push   %esi
+  8004f3:	53                   	push   %ebx
+  8004f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004f7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8004fa:	e8 a1 0a 00 00       	call   800fa0 <sys_getenvid>
+  8004ff:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800504:	c1 e0 09             	shl    $0x9,%eax
+  800507:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80050c:	a3 18 50 80 00       	mov    %eax,0x805018
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800511:	85 db                	test   %ebx,%ebx
+  800513:	7e 07                	jle    80051c <libmain+0x2d>
+		binaryname = argv[0];
+  800515:	8b 06                	mov    (%esi),%eax
+  800517:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80051c:	83 ec 08             	sub    $0x8,%esp
+  80051f:	56                   	push   %esi
+  800520:	53                   	push   %ebx
+  800521:	e8 ad fb ff ff       	call   8000d3 <umain>
+
+	// exit gracefully
+	exit();
+  800526:	e8 0a 00 00 00       	call   800535 <exit>
+}
+  80052b:	83 c4 10             	add    $0x10,%esp
+  80052e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800531:	5b                   	pop    %ebx
+  800532:	5e                   	pop    %esi
+  800533:	5d                   	pop    %ebp
+  800534:	c3                   	ret
+
+00800535 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800535:	55                   	push   %ebp
+  800536:	89 e5                	mov    %esp,%ebp
+  800538:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80053b:	e8 f8 10 00 00       	call   801638 <close_all>
+	sys_env_destroy(0);
+  800540:	83 ec 0c             	sub    $0xc,%esp
+  800543:	6a 00                	push   $0x0
+  800545:	e8 15 0a 00 00       	call   800f5f <sys_env_destroy>
+}
+  80054a:	83 c4 10             	add    $0x10,%esp
+  80054d:	c9                   	leave
+  80054e:	c3                   	ret
+
+0080054f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80054f:	55                   	push   %ebp
+  800550:	89 e5                	mov    %esp,%ebp
+  800552:	53                   	push   %ebx
+  800553:	83 ec 04             	sub    $0x4,%esp
+  800556:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800559:	8b 13                	mov    (%ebx),%edx
+  80055b:	8d 42 01             	lea    0x1(%edx),%eax
+  80055e:	89 03                	mov    %eax,(%ebx)
+  800560:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800563:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800567:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80056c:	74 09                	je     800577 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80056e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800572:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800575:	c9                   	leave
+  800576:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	68 ff 00 00 00       	push   $0xff
+  80057f:	8d 43 08             	lea    0x8(%ebx),%eax
+  800582:	50                   	push   %eax
+  800583:	e8 7a 09 00 00       	call   800f02 <sys_cputs>
+		b->idx = 0;
+  800588:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80058e:	83 c4 10             	add    $0x10,%esp
+  800591:	eb db                	jmp    80056e <putch+0x1f>
+
+00800593 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800593:	55                   	push   %ebp
+  800594:	89 e5                	mov    %esp,%ebp
+  800596:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80059c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005a3:	00 00 00 
+	b.cnt = 0;
+  8005a6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005ad:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005b0:	ff 75 0c             	push   0xc(%ebp)
+  8005b3:	ff 75 08             	push   0x8(%ebp)
+  8005b6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005bc:	50                   	push   %eax
+  8005bd:	68 4f 05 80 00       	push   $0x80054f
+  8005c2:	e8 14 01 00 00       	call   8006db <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005c7:	83 c4 08             	add    $0x8,%esp
+  8005ca:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005d0:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005d6:	50                   	push   %eax
+  8005d7:	e8 26 09 00 00       	call   800f02 <sys_cputs>
+
+	return b.cnt;
+}
+  8005dc:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005e2:	c9                   	leave
+  8005e3:	c3                   	ret
+
+008005e4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005e4:	55                   	push   %ebp
+  8005e5:	89 e5                	mov    %esp,%ebp
+  8005e7:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005ea:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005ed:	50                   	push   %eax
+  8005ee:	ff 75 08             	push   0x8(%ebp)
+  8005f1:	e8 9d ff ff ff       	call   800593 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005f6:	c9                   	leave
+  8005f7:	c3                   	ret
+
+008005f8 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005f8:	55                   	push   %ebp
+  8005f9:	89 e5                	mov    %esp,%ebp
+  8005fb:	57                   	push   %edi
+  8005fc:	56                   	push   %esi
+  8005fd:	53                   	push   %ebx
+  8005fe:	83 ec 1c             	sub    $0x1c,%esp
+  800601:	89 c7                	mov    %eax,%edi
+  800603:	89 d6                	mov    %edx,%esi
+  800605:	8b 45 08             	mov    0x8(%ebp),%eax
+  800608:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80060b:	89 d1                	mov    %edx,%ecx
+  80060d:	89 c2                	mov    %eax,%edx
+  80060f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800612:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800615:	8b 45 10             	mov    0x10(%ebp),%eax
+  800618:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80061b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80061e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800625:	39 c2                	cmp    %eax,%edx
+  800627:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80062a:	72 3e                	jb     80066a <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80062c:	83 ec 0c             	sub    $0xc,%esp
+  80062f:	ff 75 18             	push   0x18(%ebp)
+  800632:	83 eb 01             	sub    $0x1,%ebx
+  800635:	53                   	push   %ebx
+  800636:	50                   	push   %eax
+  800637:	83 ec 08             	sub    $0x8,%esp
+  80063a:	ff 75 e4             	push   -0x1c(%ebp)
+  80063d:	ff 75 e0             	push   -0x20(%ebp)
+  800640:	ff 75 dc             	push   -0x24(%ebp)
+  800643:	ff 75 d8             	push   -0x28(%ebp)
+  800646:	e8 65 21 00 00       	call   8027b0 <__udivdi3>
+  80064b:	83 c4 18             	add    $0x18,%esp
+  80064e:	52                   	push   %edx
+  80064f:	50                   	push   %eax
+  800650:	89 f2                	mov    %esi,%edx
+  800652:	89 f8                	mov    %edi,%eax
+  800654:	e8 9f ff ff ff       	call   8005f8 <printnum>
+  800659:	83 c4 20             	add    $0x20,%esp
+  80065c:	eb 13                	jmp    800671 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80065e:	83 ec 08             	sub    $0x8,%esp
+  800661:	56                   	push   %esi
+  800662:	ff 75 18             	push   0x18(%ebp)
+  800665:	ff d7                	call   *%edi
+  800667:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80066a:	83 eb 01             	sub    $0x1,%ebx
+  80066d:	85 db                	test   %ebx,%ebx
+  80066f:	7f ed                	jg     80065e <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800671:	83 ec 08             	sub    $0x8,%esp
+  800674:	56                   	push   %esi
+  800675:	83 ec 04             	sub    $0x4,%esp
+  800678:	ff 75 e4             	push   -0x1c(%ebp)
+  80067b:	ff 75 e0             	push   -0x20(%ebp)
+  80067e:	ff 75 dc             	push   -0x24(%ebp)
+  800681:	ff 75 d8             	push   -0x28(%ebp)
+  800684:	e8 e7 21 00 00       	call   802870 <__umoddi3>
+  800689:	83 c4 14             	add    $0x14,%esp
+  80068c:	0f be 80 65 2c 80 00 	movsbl 0x802c65(%eax),%eax
+  800693:	50                   	push   %eax
+  800694:	ff d7                	call   *%edi
+}
+  800696:	83 c4 10             	add    $0x10,%esp
+  800699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80069c:	5b                   	pop    %ebx
+  80069d:	5e                   	pop    %esi
+  80069e:	5f                   	pop    %edi
+  80069f:	5d                   	pop    %ebp
+  8006a0:	c3                   	ret
+
+008006a1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006a1:	55                   	push   %ebp
+  8006a2:	89 e5                	mov    %esp,%ebp
+  8006a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006a7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006ab:	8b 10                	mov    (%eax),%edx
+  8006ad:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006b0:	73 0a                	jae    8006bc <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006b2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006b5:	89 08                	mov    %ecx,(%eax)
+  8006b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006ba:	88 02                	mov    %al,(%edx)
+}
+  8006bc:	5d                   	pop    %ebp
+  8006bd:	c3                   	ret
+
+008006be <printfmt>:
+{
+  8006be:	55                   	push   %ebp
+  8006bf:	89 e5                	mov    %esp,%ebp
+  8006c1:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006c4:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006c7:	50                   	push   %eax
+  8006c8:	ff 75 10             	push   0x10(%ebp)
+  8006cb:	ff 75 0c             	push   0xc(%ebp)
+  8006ce:	ff 75 08             	push   0x8(%ebp)
+  8006d1:	e8 05 00 00 00       	call   8006db <vprintfmt>
+}
+  8006d6:	83 c4 10             	add    $0x10,%esp
+  8006d9:	c9                   	leave
+  8006da:	c3                   	ret
+
+008006db <vprintfmt>:
+{
+  8006db:	55                   	push   %ebp
+  8006dc:	89 e5                	mov    %esp,%ebp
+  8006de:	57                   	push   %edi
+  8006df:	56                   	push   %esi
+  8006e0:	53                   	push   %ebx
+  8006e1:	83 ec 2c             	sub    $0x2c,%esp
+  8006e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006ea:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006ed:	eb 0a                	jmp    8006f9 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006ef:	83 ec 08             	sub    $0x8,%esp
+  8006f2:	53                   	push   %ebx
+  8006f3:	50                   	push   %eax
+  8006f4:	ff d6                	call   *%esi
+  8006f6:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006f9:	83 c7 01             	add    $0x1,%edi
+  8006fc:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800700:	83 f8 25             	cmp    $0x25,%eax
+  800703:	74 0c                	je     800711 <vprintfmt+0x36>
+			if (ch == '\0')
+  800705:	85 c0                	test   %eax,%eax
+  800707:	75 e6                	jne    8006ef <vprintfmt+0x14>
+}
+  800709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80070c:	5b                   	pop    %ebx
+  80070d:	5e                   	pop    %esi
+  80070e:	5f                   	pop    %edi
+  80070f:	5d                   	pop    %ebp
+  800710:	c3                   	ret
+		padc = ' ';
+  800711:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800715:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80071c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800723:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80072a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80072f:	8d 47 01             	lea    0x1(%edi),%eax
+  800732:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800735:	0f b6 17             	movzbl (%edi),%edx
+  800738:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80073b:	3c 55                	cmp    $0x55,%al
+  80073d:	0f 87 cf 03 00 00    	ja     800b12 <vprintfmt+0x437>
+  800743:	0f b6 c0             	movzbl %al,%eax
+  800746:	ff 24 85 a0 2d 80 00 	jmp    *0x802da0(,%eax,4)
+  80074d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800750:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800754:	eb d9                	jmp    80072f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800756:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800759:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80075d:	eb d0                	jmp    80072f <vprintfmt+0x54>
+  80075f:	0f b6 d2             	movzbl %dl,%edx
+  800762:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80076d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800770:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800774:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800777:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80077a:	83 f9 09             	cmp    $0x9,%ecx
+  80077d:	77 55                	ja     8007d4 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80077f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800782:	eb e9                	jmp    80076d <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800784:	8b 45 14             	mov    0x14(%ebp),%eax
+  800787:	8b 00                	mov    (%eax),%eax
+  800789:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8d 40 04             	lea    0x4(%eax),%eax
+  800792:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800795:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800798:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80079c:	79 91                	jns    80072f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80079e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007a1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007a4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8007ab:	eb 82                	jmp    80072f <vprintfmt+0x54>
+			if (width < 0)
+  8007ad:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007b0:	85 d2                	test   %edx,%edx
+  8007b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b7:	0f 49 c2             	cmovns %edx,%eax
+  8007ba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007c0:	e9 6a ff ff ff       	jmp    80072f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007c8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007cf:	e9 5b ff ff ff       	jmp    80072f <vprintfmt+0x54>
+  8007d4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007d7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007da:	eb bc                	jmp    800798 <vprintfmt+0xbd>
+			lflag++;
+  8007dc:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007e2:	e9 48 ff ff ff       	jmp    80072f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ea:	8d 78 04             	lea    0x4(%eax),%edi
+  8007ed:	83 ec 08             	sub    $0x8,%esp
+  8007f0:	53                   	push   %ebx
+  8007f1:	ff 30                	push   (%eax)
+  8007f3:	ff d6                	call   *%esi
+			break;
+  8007f5:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007f8:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007fb:	e9 b1 02 00 00       	jmp    800ab1 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800800:	8b 45 14             	mov    0x14(%ebp),%eax
+  800803:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800806:	8b 10                	mov    (%eax),%edx
+  800808:	89 d0                	mov    %edx,%eax
+  80080a:	f7 d8                	neg    %eax
+  80080c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80080f:	83 f8 0f             	cmp    $0xf,%eax
+  800812:	7f 23                	jg     800837 <vprintfmt+0x15c>
+  800814:	8b 14 85 00 2f 80 00 	mov    0x802f00(,%eax,4),%edx
+  80081b:	85 d2                	test   %edx,%edx
+  80081d:	74 18                	je     800837 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80081f:	52                   	push   %edx
+  800820:	68 35 30 80 00       	push   $0x803035
+  800825:	53                   	push   %ebx
+  800826:	56                   	push   %esi
+  800827:	e8 92 fe ff ff       	call   8006be <printfmt>
+  80082c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80082f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800832:	e9 7a 02 00 00       	jmp    800ab1 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800837:	50                   	push   %eax
+  800838:	68 7d 2c 80 00       	push   $0x802c7d
+  80083d:	53                   	push   %ebx
+  80083e:	56                   	push   %esi
+  80083f:	e8 7a fe ff ff       	call   8006be <printfmt>
+  800844:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800847:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80084a:	e9 62 02 00 00       	jmp    800ab1 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80084f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800852:	83 c0 04             	add    $0x4,%eax
+  800855:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800858:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80085d:	85 c9                	test   %ecx,%ecx
+  80085f:	b8 76 2c 80 00       	mov    $0x802c76,%eax
+  800864:	0f 45 c1             	cmovne %ecx,%eax
+  800867:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80086a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80086e:	7e 06                	jle    800876 <vprintfmt+0x19b>
+  800870:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800874:	75 0b                	jne    800881 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800876:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800879:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80087c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80087f:	eb 5c                	jmp    8008dd <vprintfmt+0x202>
+  800881:	83 ec 08             	sub    $0x8,%esp
+  800884:	ff 75 d0             	push   -0x30(%ebp)
+  800887:	ff 75 cc             	push   -0x34(%ebp)
+  80088a:	e8 20 03 00 00       	call   800baf <strnlen>
+  80088f:	89 c2                	mov    %eax,%edx
+  800891:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800894:	29 d0                	sub    %edx,%eax
+  800896:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800899:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80089d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008a0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008a3:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008a5:	eb 0e                	jmp    8008b5 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8008a7:	83 ec 08             	sub    $0x8,%esp
+  8008aa:	53                   	push   %ebx
+  8008ab:	57                   	push   %edi
+  8008ac:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008af:	83 ee 01             	sub    $0x1,%esi
+  8008b2:	83 c4 10             	add    $0x10,%esp
+  8008b5:	85 f6                	test   %esi,%esi
+  8008b7:	7f ee                	jg     8008a7 <vprintfmt+0x1cc>
+  8008b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008bc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008bf:	85 c0                	test   %eax,%eax
+  8008c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008c6:	0f 49 d0             	cmovns %eax,%edx
+  8008c9:	29 d0                	sub    %edx,%eax
+  8008cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008ce:	eb a6                	jmp    800876 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8008d0:	83 ec 08             	sub    $0x8,%esp
+  8008d3:	53                   	push   %ebx
+  8008d4:	52                   	push   %edx
+  8008d5:	ff 55 08             	call   *0x8(%ebp)
+  8008d8:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008db:	89 f1                	mov    %esi,%ecx
+  8008dd:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008e0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008e4:	0f be d0             	movsbl %al,%edx
+  8008e7:	85 d2                	test   %edx,%edx
+  8008e9:	74 28                	je     800913 <vprintfmt+0x238>
+  8008eb:	85 ff                	test   %edi,%edi
+  8008ed:	78 05                	js     8008f4 <vprintfmt+0x219>
+  8008ef:	83 ef 01             	sub    $0x1,%edi
+  8008f2:	78 30                	js     800924 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008f4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008f8:	74 d6                	je     8008d0 <vprintfmt+0x1f5>
+  8008fa:	0f be c0             	movsbl %al,%eax
+  8008fd:	83 e8 20             	sub    $0x20,%eax
+  800900:	83 f8 5e             	cmp    $0x5e,%eax
+  800903:	76 cb                	jbe    8008d0 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800905:	83 ec 08             	sub    $0x8,%esp
+  800908:	53                   	push   %ebx
+  800909:	6a 3f                	push   $0x3f
+  80090b:	ff 55 08             	call   *0x8(%ebp)
+  80090e:	83 c4 10             	add    $0x10,%esp
+  800911:	eb c8                	jmp    8008db <vprintfmt+0x200>
+  800913:	8b 75 08             	mov    0x8(%ebp),%esi
+  800916:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800919:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80091c:	01 d0                	add    %edx,%eax
+  80091e:	29 c8                	sub    %ecx,%eax
+  800920:	89 c7                	mov    %eax,%edi
+  800922:	eb 13                	jmp    800937 <vprintfmt+0x25c>
+  800924:	8b 75 08             	mov    0x8(%ebp),%esi
+  800927:	eb ed                	jmp    800916 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800929:	83 ec 08             	sub    $0x8,%esp
+  80092c:	53                   	push   %ebx
+  80092d:	6a 20                	push   $0x20
+  80092f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800931:	83 ef 01             	sub    $0x1,%edi
+  800934:	83 c4 10             	add    $0x10,%esp
+  800937:	85 ff                	test   %edi,%edi
+  800939:	7f ee                	jg     800929 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80093b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80093e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800941:	e9 6b 01 00 00       	jmp    800ab1 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800946:	83 f9 01             	cmp    $0x1,%ecx
+  800949:	7f 1f                	jg     80096a <vprintfmt+0x28f>
+	else if (lflag)
+  80094b:	85 c9                	test   %ecx,%ecx
+  80094d:	74 67                	je     8009b6 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80094f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800952:	8b 00                	mov    (%eax),%eax
+  800954:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800957:	89 c1                	mov    %eax,%ecx
+  800959:	c1 f9 1f             	sar    $0x1f,%ecx
+  80095c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80095f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800962:	8d 40 04             	lea    0x4(%eax),%eax
+  800965:	89 45 14             	mov    %eax,0x14(%ebp)
+  800968:	eb 17                	jmp    800981 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80096a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096d:	8b 50 04             	mov    0x4(%eax),%edx
+  800970:	8b 00                	mov    (%eax),%eax
+  800972:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800975:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800978:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097b:	8d 40 08             	lea    0x8(%eax),%eax
+  80097e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800981:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800984:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800987:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80098c:	85 c9                	test   %ecx,%ecx
+  80098e:	0f 89 03 01 00 00    	jns    800a97 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800994:	83 ec 08             	sub    $0x8,%esp
+  800997:	53                   	push   %ebx
+  800998:	6a 2d                	push   $0x2d
+  80099a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80099c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80099f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009a2:	f7 da                	neg    %edx
+  8009a4:	83 d1 00             	adc    $0x0,%ecx
+  8009a7:	f7 d9                	neg    %ecx
+  8009a9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8009ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8009b1:	e9 e1 00 00 00       	jmp    800a97 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8009b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b9:	8b 00                	mov    (%eax),%eax
+  8009bb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009be:	89 c1                	mov    %eax,%ecx
+  8009c0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009c3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009cf:	eb b0                	jmp    800981 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8009d1:	83 f9 01             	cmp    $0x1,%ecx
+  8009d4:	7f 1e                	jg     8009f4 <vprintfmt+0x319>
+	else if (lflag)
+  8009d6:	85 c9                	test   %ecx,%ecx
+  8009d8:	74 32                	je     800a0c <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8009da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009dd:	8b 10                	mov    (%eax),%edx
+  8009df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ea:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8009ef:	e9 a3 00 00 00       	jmp    800a97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f7:	8b 10                	mov    (%eax),%edx
+  8009f9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009fc:	8d 40 08             	lea    0x8(%eax),%eax
+  8009ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a02:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800a07:	e9 8b 00 00 00       	jmp    800a97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a0c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0f:	8b 10                	mov    (%eax),%edx
+  800a11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a16:	8d 40 04             	lea    0x4(%eax),%eax
+  800a19:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a1c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a21:	eb 74                	jmp    800a97 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800a23:	83 f9 01             	cmp    $0x1,%ecx
+  800a26:	7f 1b                	jg     800a43 <vprintfmt+0x368>
+	else if (lflag)
+  800a28:	85 c9                	test   %ecx,%ecx
+  800a2a:	74 2c                	je     800a58 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800a2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a2f:	8b 10                	mov    (%eax),%edx
+  800a31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a36:	8d 40 04             	lea    0x4(%eax),%eax
+  800a39:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a3c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800a41:	eb 54                	jmp    800a97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800a43:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a46:	8b 10                	mov    (%eax),%edx
+  800a48:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a4b:	8d 40 08             	lea    0x8(%eax),%eax
+  800a4e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a51:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800a56:	eb 3f                	jmp    800a97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a58:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5b:	8b 10                	mov    (%eax),%edx
+  800a5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a62:	8d 40 04             	lea    0x4(%eax),%eax
+  800a65:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a68:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800a6d:	eb 28                	jmp    800a97 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800a6f:	83 ec 08             	sub    $0x8,%esp
+  800a72:	53                   	push   %ebx
+  800a73:	6a 30                	push   $0x30
+  800a75:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a77:	83 c4 08             	add    $0x8,%esp
+  800a7a:	53                   	push   %ebx
+  800a7b:	6a 78                	push   $0x78
+  800a7d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a82:	8b 10                	mov    (%eax),%edx
+  800a84:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a89:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a8c:	8d 40 04             	lea    0x4(%eax),%eax
+  800a8f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a92:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a97:	83 ec 0c             	sub    $0xc,%esp
+  800a9a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a9e:	50                   	push   %eax
+  800a9f:	ff 75 e0             	push   -0x20(%ebp)
+  800aa2:	57                   	push   %edi
+  800aa3:	51                   	push   %ecx
+  800aa4:	52                   	push   %edx
+  800aa5:	89 da                	mov    %ebx,%edx
+  800aa7:	89 f0                	mov    %esi,%eax
+  800aa9:	e8 4a fb ff ff       	call   8005f8 <printnum>
+			break;
+  800aae:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800ab1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ab4:	e9 40 fc ff ff       	jmp    8006f9 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800ab9:	83 f9 01             	cmp    $0x1,%ecx
+  800abc:	7f 1b                	jg     800ad9 <vprintfmt+0x3fe>
+	else if (lflag)
+  800abe:	85 c9                	test   %ecx,%ecx
+  800ac0:	74 2c                	je     800aee <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800ac2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac5:	8b 10                	mov    (%eax),%edx
+  800ac7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800acc:	8d 40 04             	lea    0x4(%eax),%eax
+  800acf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ad2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800ad7:	eb be                	jmp    800a97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800ad9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800adc:	8b 10                	mov    (%eax),%edx
+  800ade:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ae1:	8d 40 08             	lea    0x8(%eax),%eax
+  800ae4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ae7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800aec:	eb a9                	jmp    800a97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800aee:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af1:	8b 10                	mov    (%eax),%edx
+  800af3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af8:	8d 40 04             	lea    0x4(%eax),%eax
+  800afb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800afe:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800b03:	eb 92                	jmp    800a97 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800b05:	83 ec 08             	sub    $0x8,%esp
+  800b08:	53                   	push   %ebx
+  800b09:	6a 25                	push   $0x25
+  800b0b:	ff d6                	call   *%esi
+			break;
+  800b0d:	83 c4 10             	add    $0x10,%esp
+  800b10:	eb 9f                	jmp    800ab1 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800b12:	83 ec 08             	sub    $0x8,%esp
+  800b15:	53                   	push   %ebx
+  800b16:	6a 25                	push   $0x25
+  800b18:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b1a:	83 c4 10             	add    $0x10,%esp
+  800b1d:	89 f8                	mov    %edi,%eax
+  800b1f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b23:	74 05                	je     800b2a <vprintfmt+0x44f>
+  800b25:	83 e8 01             	sub    $0x1,%eax
+  800b28:	eb f5                	jmp    800b1f <vprintfmt+0x444>
+  800b2a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b2d:	eb 82                	jmp    800ab1 <vprintfmt+0x3d6>
+
+00800b2f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b2f:	55                   	push   %ebp
+  800b30:	89 e5                	mov    %esp,%ebp
+  800b32:	83 ec 18             	sub    $0x18,%esp
+  800b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b38:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b3b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b3e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b42:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b45:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b4c:	85 c0                	test   %eax,%eax
+  800b4e:	74 26                	je     800b76 <vsnprintf+0x47>
+  800b50:	85 d2                	test   %edx,%edx
+  800b52:	7e 22                	jle    800b76 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b54:	ff 75 14             	push   0x14(%ebp)
+  800b57:	ff 75 10             	push   0x10(%ebp)
+  800b5a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b5d:	50                   	push   %eax
+  800b5e:	68 a1 06 80 00       	push   $0x8006a1
+  800b63:	e8 73 fb ff ff       	call   8006db <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b68:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b6b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b71:	83 c4 10             	add    $0x10,%esp
+}
+  800b74:	c9                   	leave
+  800b75:	c3                   	ret
+		return -E_INVAL;
+  800b76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b7b:	eb f7                	jmp    800b74 <vsnprintf+0x45>
+
+00800b7d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b83:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b86:	50                   	push   %eax
+  800b87:	ff 75 10             	push   0x10(%ebp)
+  800b8a:	ff 75 0c             	push   0xc(%ebp)
+  800b8d:	ff 75 08             	push   0x8(%ebp)
+  800b90:	e8 9a ff ff ff       	call   800b2f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b95:	c9                   	leave
+  800b96:	c3                   	ret
+
+00800b97 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b97:	55                   	push   %ebp
+  800b98:	89 e5                	mov    %esp,%ebp
+  800b9a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba2:	eb 03                	jmp    800ba7 <strlen+0x10>
+		n++;
+  800ba4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800ba7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bab:	75 f7                	jne    800ba4 <strlen+0xd>
+	return n;
+}
+  800bad:	5d                   	pop    %ebp
+  800bae:	c3                   	ret
+
+00800baf <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bb5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbd:	eb 03                	jmp    800bc2 <strnlen+0x13>
+		n++;
+  800bbf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bc2:	39 d0                	cmp    %edx,%eax
+  800bc4:	74 08                	je     800bce <strnlen+0x1f>
+  800bc6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bca:	75 f3                	jne    800bbf <strnlen+0x10>
+  800bcc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800bce:	89 d0                	mov    %edx,%eax
+  800bd0:	5d                   	pop    %ebp
+  800bd1:	c3                   	ret
+
+00800bd2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bd2:	55                   	push   %ebp
+  800bd3:	89 e5                	mov    %esp,%ebp
+  800bd5:	53                   	push   %ebx
+  800bd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bd9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800be5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800be8:	83 c0 01             	add    $0x1,%eax
+  800beb:	84 d2                	test   %dl,%dl
+  800bed:	75 f2                	jne    800be1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bef:	89 c8                	mov    %ecx,%eax
+  800bf1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf4:	c9                   	leave
+  800bf5:	c3                   	ret
+
+00800bf6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bf6:	55                   	push   %ebp
+  800bf7:	89 e5                	mov    %esp,%ebp
+  800bf9:	53                   	push   %ebx
+  800bfa:	83 ec 10             	sub    $0x10,%esp
+  800bfd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c00:	53                   	push   %ebx
+  800c01:	e8 91 ff ff ff       	call   800b97 <strlen>
+  800c06:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c09:	ff 75 0c             	push   0xc(%ebp)
+  800c0c:	01 d8                	add    %ebx,%eax
+  800c0e:	50                   	push   %eax
+  800c0f:	e8 be ff ff ff       	call   800bd2 <strcpy>
+	return dst;
+}
+  800c14:	89 d8                	mov    %ebx,%eax
+  800c16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c19:	c9                   	leave
+  800c1a:	c3                   	ret
+
+00800c1b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	56                   	push   %esi
+  800c1f:	53                   	push   %ebx
+  800c20:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c23:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c26:	89 f3                	mov    %esi,%ebx
+  800c28:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c2b:	89 f0                	mov    %esi,%eax
+  800c2d:	eb 0f                	jmp    800c3e <strncpy+0x23>
+		*dst++ = *src;
+  800c2f:	83 c0 01             	add    $0x1,%eax
+  800c32:	0f b6 0a             	movzbl (%edx),%ecx
+  800c35:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c38:	80 f9 01             	cmp    $0x1,%cl
+  800c3b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c3e:	39 d8                	cmp    %ebx,%eax
+  800c40:	75 ed                	jne    800c2f <strncpy+0x14>
+	}
+	return ret;
+}
+  800c42:	89 f0                	mov    %esi,%eax
+  800c44:	5b                   	pop    %ebx
+  800c45:	5e                   	pop    %esi
+  800c46:	5d                   	pop    %ebp
+  800c47:	c3                   	ret
+
+00800c48 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c48:	55                   	push   %ebp
+  800c49:	89 e5                	mov    %esp,%ebp
+  800c4b:	56                   	push   %esi
+  800c4c:	53                   	push   %ebx
+  800c4d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c53:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c56:	89 f0                	mov    %esi,%eax
+  800c58:	85 d2                	test   %edx,%edx
+  800c5a:	74 21                	je     800c7d <strlcpy+0x35>
+  800c5c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c60:	89 f2                	mov    %esi,%edx
+  800c62:	eb 09                	jmp    800c6d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c64:	83 c1 01             	add    $0x1,%ecx
+  800c67:	83 c2 01             	add    $0x1,%edx
+  800c6a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c6d:	39 c2                	cmp    %eax,%edx
+  800c6f:	74 09                	je     800c7a <strlcpy+0x32>
+  800c71:	0f b6 19             	movzbl (%ecx),%ebx
+  800c74:	84 db                	test   %bl,%bl
+  800c76:	75 ec                	jne    800c64 <strlcpy+0x1c>
+  800c78:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c7a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c7d:	29 f0                	sub    %esi,%eax
+}
+  800c7f:	5b                   	pop    %ebx
+  800c80:	5e                   	pop    %esi
+  800c81:	5d                   	pop    %ebp
+  800c82:	c3                   	ret
+
+00800c83 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c83:	55                   	push   %ebp
+  800c84:	89 e5                	mov    %esp,%ebp
+  800c86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c89:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c8c:	eb 06                	jmp    800c94 <strcmp+0x11>
+		p++, q++;
+  800c8e:	83 c1 01             	add    $0x1,%ecx
+  800c91:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c94:	0f b6 01             	movzbl (%ecx),%eax
+  800c97:	84 c0                	test   %al,%al
+  800c99:	74 04                	je     800c9f <strcmp+0x1c>
+  800c9b:	3a 02                	cmp    (%edx),%al
+  800c9d:	74 ef                	je     800c8e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c9f:	0f b6 c0             	movzbl %al,%eax
+  800ca2:	0f b6 12             	movzbl (%edx),%edx
+  800ca5:	29 d0                	sub    %edx,%eax
+}
+  800ca7:	5d                   	pop    %ebp
+  800ca8:	c3                   	ret
+
+00800ca9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ca9:	55                   	push   %ebp
+  800caa:	89 e5                	mov    %esp,%ebp
+  800cac:	53                   	push   %ebx
+  800cad:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800cb6:	eb 09                	jmp    800cc1 <strncmp+0x18>
+		n--, p++, q++;
+  800cb8:	83 ea 01             	sub    $0x1,%edx
+  800cbb:	83 c0 01             	add    $0x1,%eax
+  800cbe:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800cc1:	85 d2                	test   %edx,%edx
+  800cc3:	74 18                	je     800cdd <strncmp+0x34>
+  800cc5:	0f b6 18             	movzbl (%eax),%ebx
+  800cc8:	84 db                	test   %bl,%bl
+  800cca:	74 04                	je     800cd0 <strncmp+0x27>
+  800ccc:	3a 19                	cmp    (%ecx),%bl
+  800cce:	74 e8                	je     800cb8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cd0:	0f b6 00             	movzbl (%eax),%eax
+  800cd3:	0f b6 11             	movzbl (%ecx),%edx
+  800cd6:	29 d0                	sub    %edx,%eax
+}
+  800cd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cdb:	c9                   	leave
+  800cdc:	c3                   	ret
+		return 0;
+  800cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce2:	eb f4                	jmp    800cd8 <strncmp+0x2f>
+
+00800ce4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ce4:	55                   	push   %ebp
+  800ce5:	89 e5                	mov    %esp,%ebp
+  800ce7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cea:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cee:	eb 03                	jmp    800cf3 <strchr+0xf>
+  800cf0:	83 c0 01             	add    $0x1,%eax
+  800cf3:	0f b6 10             	movzbl (%eax),%edx
+  800cf6:	84 d2                	test   %dl,%dl
+  800cf8:	74 06                	je     800d00 <strchr+0x1c>
+		if (*s == c)
+  800cfa:	38 ca                	cmp    %cl,%dl
+  800cfc:	75 f2                	jne    800cf0 <strchr+0xc>
+  800cfe:	eb 05                	jmp    800d05 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800d00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d05:	5d                   	pop    %ebp
+  800d06:	c3                   	ret
+
+00800d07 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d07:	55                   	push   %ebp
+  800d08:	89 e5                	mov    %esp,%ebp
+  800d0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d11:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d14:	38 ca                	cmp    %cl,%dl
+  800d16:	74 09                	je     800d21 <strfind+0x1a>
+  800d18:	84 d2                	test   %dl,%dl
+  800d1a:	74 05                	je     800d21 <strfind+0x1a>
+	for (; *s; s++)
+  800d1c:	83 c0 01             	add    $0x1,%eax
+  800d1f:	eb f0                	jmp    800d11 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+
+00800d23 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	57                   	push   %edi
+  800d27:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d2a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d2d:	85 c9                	test   %ecx,%ecx
+  800d2f:	74 20                	je     800d51 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d31:	89 f8                	mov    %edi,%eax
+  800d33:	09 c8                	or     %ecx,%eax
+  800d35:	a8 03                	test   $0x3,%al
+  800d37:	75 12                	jne    800d4b <memset+0x28>
+		c &= 0xFF;
+  800d39:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d3d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d43:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d46:	fc                   	cld
+  800d47:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d49:	eb 06                	jmp    800d51 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d4e:	fc                   	cld
+  800d4f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d51:	89 f8                	mov    %edi,%eax
+  800d53:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d56:	c9                   	leave
+  800d57:	c3                   	ret
+
+00800d58 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d58:	55                   	push   %ebp
+  800d59:	89 e5                	mov    %esp,%ebp
+  800d5b:	57                   	push   %edi
+  800d5c:	56                   	push   %esi
+  800d5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d60:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d63:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d66:	39 c6                	cmp    %eax,%esi
+  800d68:	73 32                	jae    800d9c <memmove+0x44>
+  800d6a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d6d:	39 d0                	cmp    %edx,%eax
+  800d6f:	73 2b                	jae    800d9c <memmove+0x44>
+		s += n;
+		d += n;
+  800d71:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d74:	89 d6                	mov    %edx,%esi
+  800d76:	09 fe                	or     %edi,%esi
+  800d78:	09 ce                	or     %ecx,%esi
+  800d7a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d80:	75 0e                	jne    800d90 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d82:	83 ef 04             	sub    $0x4,%edi
+  800d85:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d88:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d8b:	fd                   	std
+  800d8c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d8e:	eb 09                	jmp    800d99 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d90:	83 ef 01             	sub    $0x1,%edi
+  800d93:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d96:	fd                   	std
+  800d97:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d99:	fc                   	cld
+  800d9a:	eb 1a                	jmp    800db6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d9c:	89 f2                	mov    %esi,%edx
+  800d9e:	09 c2                	or     %eax,%edx
+  800da0:	09 ca                	or     %ecx,%edx
+  800da2:	f6 c2 03             	test   $0x3,%dl
+  800da5:	75 0a                	jne    800db1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800da7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800daa:	89 c7                	mov    %eax,%edi
+  800dac:	fc                   	cld
+  800dad:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800daf:	eb 05                	jmp    800db6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800db1:	89 c7                	mov    %eax,%edi
+  800db3:	fc                   	cld
+  800db4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800db6:	5e                   	pop    %esi
+  800db7:	5f                   	pop    %edi
+  800db8:	5d                   	pop    %ebp
+  800db9:	c3                   	ret
+
+00800dba <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800dba:	55                   	push   %ebp
+  800dbb:	89 e5                	mov    %esp,%ebp
+  800dbd:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800dc0:	ff 75 10             	push   0x10(%ebp)
+  800dc3:	ff 75 0c             	push   0xc(%ebp)
+  800dc6:	ff 75 08             	push   0x8(%ebp)
+  800dc9:	e8 8a ff ff ff       	call   800d58 <memmove>
+}
+  800dce:	c9                   	leave
+  800dcf:	c3                   	ret
+
+00800dd0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	56                   	push   %esi
+  800dd4:	53                   	push   %ebx
+  800dd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ddb:	89 c6                	mov    %eax,%esi
+  800ddd:	03 75 10             	add    0x10(%ebp),%esi
+  800de0:	eb 06                	jmp    800de8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800de2:	83 c0 01             	add    $0x1,%eax
+  800de5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800de8:	39 f0                	cmp    %esi,%eax
+  800dea:	74 14                	je     800e00 <memcmp+0x30>
+		if (*s1 != *s2)
+  800dec:	0f b6 08             	movzbl (%eax),%ecx
+  800def:	0f b6 1a             	movzbl (%edx),%ebx
+  800df2:	38 d9                	cmp    %bl,%cl
+  800df4:	74 ec                	je     800de2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800df6:	0f b6 c1             	movzbl %cl,%eax
+  800df9:	0f b6 db             	movzbl %bl,%ebx
+  800dfc:	29 d8                	sub    %ebx,%eax
+  800dfe:	eb 05                	jmp    800e05 <memcmp+0x35>
+	}
+
+	return 0;
+  800e00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5d                   	pop    %ebp
+  800e08:	c3                   	ret
+
+00800e09 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e09:	55                   	push   %ebp
+  800e0a:	89 e5                	mov    %esp,%ebp
+  800e0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e12:	89 c2                	mov    %eax,%edx
+  800e14:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e17:	eb 03                	jmp    800e1c <memfind+0x13>
+  800e19:	83 c0 01             	add    $0x1,%eax
+  800e1c:	39 d0                	cmp    %edx,%eax
+  800e1e:	73 04                	jae    800e24 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e20:	38 08                	cmp    %cl,(%eax)
+  800e22:	75 f5                	jne    800e19 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e24:	5d                   	pop    %ebp
+  800e25:	c3                   	ret
+
+00800e26 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	57                   	push   %edi
+  800e2a:	56                   	push   %esi
+  800e2b:	53                   	push   %ebx
+  800e2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e32:	eb 03                	jmp    800e37 <strtol+0x11>
+		s++;
+  800e34:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e37:	0f b6 02             	movzbl (%edx),%eax
+  800e3a:	3c 20                	cmp    $0x20,%al
+  800e3c:	74 f6                	je     800e34 <strtol+0xe>
+  800e3e:	3c 09                	cmp    $0x9,%al
+  800e40:	74 f2                	je     800e34 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e42:	3c 2b                	cmp    $0x2b,%al
+  800e44:	74 2a                	je     800e70 <strtol+0x4a>
+	int neg = 0;
+  800e46:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e4b:	3c 2d                	cmp    $0x2d,%al
+  800e4d:	74 2b                	je     800e7a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e4f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e55:	75 0f                	jne    800e66 <strtol+0x40>
+  800e57:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e5a:	74 28                	je     800e84 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e5c:	85 db                	test   %ebx,%ebx
+  800e5e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e63:	0f 44 d8             	cmove  %eax,%ebx
+  800e66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e6e:	eb 46                	jmp    800eb6 <strtol+0x90>
+		s++;
+  800e70:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e73:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e78:	eb d5                	jmp    800e4f <strtol+0x29>
+		s++, neg = 1;
+  800e7a:	83 c2 01             	add    $0x1,%edx
+  800e7d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e82:	eb cb                	jmp    800e4f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e84:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e88:	74 0e                	je     800e98 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e8a:	85 db                	test   %ebx,%ebx
+  800e8c:	75 d8                	jne    800e66 <strtol+0x40>
+		s++, base = 8;
+  800e8e:	83 c2 01             	add    $0x1,%edx
+  800e91:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e96:	eb ce                	jmp    800e66 <strtol+0x40>
+		s += 2, base = 16;
+  800e98:	83 c2 02             	add    $0x2,%edx
+  800e9b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ea0:	eb c4                	jmp    800e66 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ea2:	0f be c0             	movsbl %al,%eax
+  800ea5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ea8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800eab:	7d 3a                	jge    800ee7 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ead:	83 c2 01             	add    $0x1,%edx
+  800eb0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800eb4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800eb6:	0f b6 02             	movzbl (%edx),%eax
+  800eb9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ebc:	89 f3                	mov    %esi,%ebx
+  800ebe:	80 fb 09             	cmp    $0x9,%bl
+  800ec1:	76 df                	jbe    800ea2 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ec3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ec6:	89 f3                	mov    %esi,%ebx
+  800ec8:	80 fb 19             	cmp    $0x19,%bl
+  800ecb:	77 08                	ja     800ed5 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ecd:	0f be c0             	movsbl %al,%eax
+  800ed0:	83 e8 57             	sub    $0x57,%eax
+  800ed3:	eb d3                	jmp    800ea8 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ed5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ed8:	89 f3                	mov    %esi,%ebx
+  800eda:	80 fb 19             	cmp    $0x19,%bl
+  800edd:	77 08                	ja     800ee7 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800edf:	0f be c0             	movsbl %al,%eax
+  800ee2:	83 e8 37             	sub    $0x37,%eax
+  800ee5:	eb c1                	jmp    800ea8 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ee7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800eeb:	74 05                	je     800ef2 <strtol+0xcc>
+		*endptr = (char *) s;
+  800eed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ef0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ef2:	89 c8                	mov    %ecx,%eax
+  800ef4:	f7 d8                	neg    %eax
+  800ef6:	85 ff                	test   %edi,%edi
+  800ef8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800efb:	89 c8                	mov    %ecx,%eax
+  800efd:	5b                   	pop    %ebx
+  800efe:	5e                   	pop    %esi
+  800eff:	5f                   	pop    %edi
+  800f00:	5d                   	pop    %ebp
+  800f01:	c3                   	ret
+
+00800f02 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f02:	55                   	push   %ebp
+  800f03:	89 e5                	mov    %esp,%ebp
+  800f05:	57                   	push   %edi
+  800f06:	56                   	push   %esi
+  800f07:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f13:	89 c3                	mov    %eax,%ebx
+  800f15:	89 c7                	mov    %eax,%edi
+  800f17:	89 c6                	mov    %eax,%esi
+  800f19:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f1b:	5b                   	pop    %ebx
+  800f1c:	5e                   	pop    %esi
+  800f1d:	5f                   	pop    %edi
+  800f1e:	5d                   	pop    %ebp
+  800f1f:	c3                   	ret
+
+00800f20 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f20:	55                   	push   %ebp
+  800f21:	89 e5                	mov    %esp,%ebp
+  800f23:	57                   	push   %edi
+  800f24:	56                   	push   %esi
+  800f25:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f26:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f2b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f30:	89 d1                	mov    %edx,%ecx
+  800f32:	89 d3                	mov    %edx,%ebx
+  800f34:	89 d7                	mov    %edx,%edi
+  800f36:	89 d6                	mov    %edx,%esi
+  800f38:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f3a:	5b                   	pop    %ebx
+  800f3b:	5e                   	pop    %esi
+  800f3c:	5f                   	pop    %edi
+  800f3d:	5d                   	pop    %ebp
+  800f3e:	c3                   	ret
+
+00800f3f <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800f3f:	55                   	push   %ebp
+  800f40:	89 e5                	mov    %esp,%ebp
+  800f42:	57                   	push   %edi
+  800f43:	56                   	push   %esi
+  800f44:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f52:	89 cb                	mov    %ecx,%ebx
+  800f54:	89 cf                	mov    %ecx,%edi
+  800f56:	89 ce                	mov    %ecx,%esi
+  800f58:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800f5a:	5b                   	pop    %ebx
+  800f5b:	5e                   	pop    %esi
+  800f5c:	5f                   	pop    %edi
+  800f5d:	5d                   	pop    %ebp
+  800f5e:	c3                   	ret
+
+00800f5f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f5f:	55                   	push   %ebp
+  800f60:	89 e5                	mov    %esp,%ebp
+  800f62:	57                   	push   %edi
+  800f63:	56                   	push   %esi
+  800f64:	53                   	push   %ebx
+  800f65:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f70:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f75:	89 cb                	mov    %ecx,%ebx
+  800f77:	89 cf                	mov    %ecx,%edi
+  800f79:	89 ce                	mov    %ecx,%esi
+  800f7b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7d:	85 c0                	test   %eax,%eax
+  800f7f:	7f 08                	jg     800f89 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f84:	5b                   	pop    %ebx
+  800f85:	5e                   	pop    %esi
+  800f86:	5f                   	pop    %edi
+  800f87:	5d                   	pop    %ebp
+  800f88:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+  800f8c:	50                   	push   %eax
+  800f8d:	6a 03                	push   $0x3
+  800f8f:	68 5f 2f 80 00       	push   $0x802f5f
+  800f94:	6a 23                	push   $0x23
+  800f96:	68 7c 2f 80 00       	push   $0x802f7c
+  800f9b:	e8 d5 15 00 00       	call   802575 <_panic>
+
+00800fa0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fab:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fb0:	89 d1                	mov    %edx,%ecx
+  800fb2:	89 d3                	mov    %edx,%ebx
+  800fb4:	89 d7                	mov    %edx,%edi
+  800fb6:	89 d6                	mov    %edx,%esi
+  800fb8:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800fba:	5b                   	pop    %ebx
+  800fbb:	5e                   	pop    %esi
+  800fbc:	5f                   	pop    %edi
+  800fbd:	5d                   	pop    %ebp
+  800fbe:	c3                   	ret
+
+00800fbf <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	57                   	push   %edi
+  800fc3:	56                   	push   %esi
+  800fc4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fca:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fcf:	89 d1                	mov    %edx,%ecx
+  800fd1:	89 d3                	mov    %edx,%ebx
+  800fd3:	89 d7                	mov    %edx,%edi
+  800fd5:	89 d6                	mov    %edx,%esi
+  800fd7:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fd9:	5b                   	pop    %ebx
+  800fda:	5e                   	pop    %esi
+  800fdb:	5f                   	pop    %edi
+  800fdc:	5d                   	pop    %ebp
+  800fdd:	c3                   	ret
+
+00800fde <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800fde:	55                   	push   %ebp
+  800fdf:	89 e5                	mov    %esp,%ebp
+  800fe1:	57                   	push   %edi
+  800fe2:	56                   	push   %esi
+  800fe3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fe4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fee:	89 d1                	mov    %edx,%ecx
+  800ff0:	89 d3                	mov    %edx,%ebx
+  800ff2:	89 d7                	mov    %edx,%edi
+  800ff4:	89 d6                	mov    %edx,%esi
+  800ff6:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800ff8:	5b                   	pop    %ebx
+  800ff9:	5e                   	pop    %esi
+  800ffa:	5f                   	pop    %edi
+  800ffb:	5d                   	pop    %ebp
+  800ffc:	c3                   	ret
+
+00800ffd <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800ffd:	55                   	push   %ebp
+  800ffe:	89 e5                	mov    %esp,%ebp
+  801000:	57                   	push   %edi
+  801001:	56                   	push   %esi
+  801002:	53                   	push   %ebx
+  801003:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801006:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801011:	b8 15 00 00 00       	mov    $0x15,%eax
+  801016:	89 df                	mov    %ebx,%edi
+  801018:	89 de                	mov    %ebx,%esi
+  80101a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80101c:	85 c0                	test   %eax,%eax
+  80101e:	7f 08                	jg     801028 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  801020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801023:	5b                   	pop    %ebx
+  801024:	5e                   	pop    %esi
+  801025:	5f                   	pop    %edi
+  801026:	5d                   	pop    %ebp
+  801027:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801028:	83 ec 0c             	sub    $0xc,%esp
+  80102b:	50                   	push   %eax
+  80102c:	6a 15                	push   $0x15
+  80102e:	68 5f 2f 80 00       	push   $0x802f5f
+  801033:	6a 23                	push   $0x23
+  801035:	68 7c 2f 80 00       	push   $0x802f7c
+  80103a:	e8 36 15 00 00       	call   802575 <_panic>
+
+0080103f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80103f:	55                   	push   %ebp
+  801040:	89 e5                	mov    %esp,%ebp
+  801042:	57                   	push   %edi
+  801043:	56                   	push   %esi
+  801044:	53                   	push   %ebx
+  801045:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801048:	be 00 00 00 00       	mov    $0x0,%esi
+  80104d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801050:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801053:	b8 05 00 00 00       	mov    $0x5,%eax
+  801058:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80105b:	89 f7                	mov    %esi,%edi
+  80105d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105f:	85 c0                	test   %eax,%eax
+  801061:	7f 08                	jg     80106b <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801063:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801066:	5b                   	pop    %ebx
+  801067:	5e                   	pop    %esi
+  801068:	5f                   	pop    %edi
+  801069:	5d                   	pop    %ebp
+  80106a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106b:	83 ec 0c             	sub    $0xc,%esp
+  80106e:	50                   	push   %eax
+  80106f:	6a 05                	push   $0x5
+  801071:	68 5f 2f 80 00       	push   $0x802f5f
+  801076:	6a 23                	push   $0x23
+  801078:	68 7c 2f 80 00       	push   $0x802f7c
+  80107d:	e8 f3 14 00 00       	call   802575 <_panic>
+
+00801082 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	57                   	push   %edi
+  801086:	56                   	push   %esi
+  801087:	53                   	push   %ebx
+  801088:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80108b:	be 00 00 00 00       	mov    $0x0,%esi
+  801090:	8b 55 08             	mov    0x8(%ebp),%edx
+  801093:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801096:	b8 06 00 00 00       	mov    $0x6,%eax
+  80109b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109e:	89 f7                	mov    %esi,%edi
+  8010a0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010a2:	85 c0                	test   %eax,%eax
+  8010a4:	7f 08                	jg     8010ae <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8010a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a9:	5b                   	pop    %ebx
+  8010aa:	5e                   	pop    %esi
+  8010ab:	5f                   	pop    %edi
+  8010ac:	5d                   	pop    %ebp
+  8010ad:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ae:	83 ec 0c             	sub    $0xc,%esp
+  8010b1:	50                   	push   %eax
+  8010b2:	6a 06                	push   $0x6
+  8010b4:	68 5f 2f 80 00       	push   $0x802f5f
+  8010b9:	6a 23                	push   $0x23
+  8010bb:	68 7c 2f 80 00       	push   $0x802f7c
+  8010c0:	e8 b0 14 00 00       	call   802575 <_panic>
+
+008010c5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	57                   	push   %edi
+  8010c9:	56                   	push   %esi
+  8010ca:	53                   	push   %ebx
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8010d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010dc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010df:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e4:	85 c0                	test   %eax,%eax
+  8010e6:	7f 08                	jg     8010f0 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8010e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010eb:	5b                   	pop    %ebx
+  8010ec:	5e                   	pop    %esi
+  8010ed:	5f                   	pop    %edi
+  8010ee:	5d                   	pop    %ebp
+  8010ef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f0:	83 ec 0c             	sub    $0xc,%esp
+  8010f3:	50                   	push   %eax
+  8010f4:	6a 07                	push   $0x7
+  8010f6:	68 5f 2f 80 00       	push   $0x802f5f
+  8010fb:	6a 23                	push   $0x23
+  8010fd:	68 7c 2f 80 00       	push   $0x802f7c
+  801102:	e8 6e 14 00 00       	call   802575 <_panic>
+
+00801107 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801107:	55                   	push   %ebp
+  801108:	89 e5                	mov    %esp,%ebp
+  80110a:	57                   	push   %edi
+  80110b:	56                   	push   %esi
+  80110c:	53                   	push   %ebx
+  80110d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801110:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801115:	8b 55 08             	mov    0x8(%ebp),%edx
+  801118:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801120:	89 df                	mov    %ebx,%edi
+  801122:	89 de                	mov    %ebx,%esi
+  801124:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801126:	85 c0                	test   %eax,%eax
+  801128:	7f 08                	jg     801132 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80112a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112d:	5b                   	pop    %ebx
+  80112e:	5e                   	pop    %esi
+  80112f:	5f                   	pop    %edi
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801132:	83 ec 0c             	sub    $0xc,%esp
+  801135:	50                   	push   %eax
+  801136:	6a 08                	push   $0x8
+  801138:	68 5f 2f 80 00       	push   $0x802f5f
+  80113d:	6a 23                	push   $0x23
+  80113f:	68 7c 2f 80 00       	push   $0x802f7c
+  801144:	e8 2c 14 00 00       	call   802575 <_panic>
+
+00801149 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80114f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801152:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801155:	b8 09 00 00 00       	mov    $0x9,%eax
+  80115a:	be 00 00 00 00       	mov    $0x0,%esi
+  80115f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801162:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801165:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  801167:	5b                   	pop    %ebx
+  801168:	5e                   	pop    %esi
+  801169:	5f                   	pop    %edi
+  80116a:	5d                   	pop    %ebp
+  80116b:	c3                   	ret
+
+0080116c <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  80116c:	55                   	push   %ebp
+  80116d:	89 e5                	mov    %esp,%ebp
+  80116f:	57                   	push   %edi
+  801170:	56                   	push   %esi
+  801171:	53                   	push   %ebx
+  801172:	8b 45 18             	mov    0x18(%ebp),%eax
+  801175:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  801178:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  80117d:	77 27                	ja     8011a6 <sys_page_map_range+0x3a>
+  80117f:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  801185:	77 1f                	ja     8011a6 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  801187:	c1 e0 0c             	shl    $0xc,%eax
+  80118a:	89 c6                	mov    %eax,%esi
+  80118c:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  80118e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801191:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801194:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801199:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80119f:	cd 30                	int    $0x30
+}
+  8011a1:	5b                   	pop    %ebx
+  8011a2:	5e                   	pop    %esi
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+		return -E_INVAL;
+  8011a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ab:	eb f4                	jmp    8011a1 <sys_page_map_range+0x35>
+
+008011ad <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8011ad:	55                   	push   %ebp
+  8011ae:	89 e5                	mov    %esp,%ebp
+  8011b0:	57                   	push   %edi
+  8011b1:	56                   	push   %esi
+  8011b2:	53                   	push   %ebx
+  8011b3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011cc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ce:	85 c0                	test   %eax,%eax
+  8011d0:	7f 08                	jg     8011da <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8011d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d5:	5b                   	pop    %ebx
+  8011d6:	5e                   	pop    %esi
+  8011d7:	5f                   	pop    %edi
+  8011d8:	5d                   	pop    %ebp
+  8011d9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011da:	83 ec 0c             	sub    $0xc,%esp
+  8011dd:	50                   	push   %eax
+  8011de:	6a 0c                	push   $0xc
+  8011e0:	68 5f 2f 80 00       	push   $0x802f5f
+  8011e5:	6a 23                	push   $0x23
+  8011e7:	68 7c 2f 80 00       	push   $0x802f7c
+  8011ec:	e8 84 13 00 00       	call   802575 <_panic>
+
+008011f1 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8011f1:	55                   	push   %ebp
+  8011f2:	89 e5                	mov    %esp,%ebp
+  8011f4:	57                   	push   %edi
+  8011f5:	56                   	push   %esi
+  8011f6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801202:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801207:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120a:	89 f7                	mov    %esi,%edi
+  80120c:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  80120e:	5b                   	pop    %ebx
+  80120f:	5e                   	pop    %esi
+  801210:	5f                   	pop    %edi
+  801211:	5d                   	pop    %ebp
+  801212:	c3                   	ret
+
+00801213 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801213:	55                   	push   %ebp
+  801214:	89 e5                	mov    %esp,%ebp
+  801216:	57                   	push   %edi
+  801217:	56                   	push   %esi
+  801218:	53                   	push   %ebx
+  801219:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80121c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801221:	8b 55 08             	mov    0x8(%ebp),%edx
+  801224:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801227:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80122c:	89 df                	mov    %ebx,%edi
+  80122e:	89 de                	mov    %ebx,%esi
+  801230:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801232:	85 c0                	test   %eax,%eax
+  801234:	7f 08                	jg     80123e <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801239:	5b                   	pop    %ebx
+  80123a:	5e                   	pop    %esi
+  80123b:	5f                   	pop    %edi
+  80123c:	5d                   	pop    %ebp
+  80123d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80123e:	83 ec 0c             	sub    $0xc,%esp
+  801241:	50                   	push   %eax
+  801242:	6a 0f                	push   $0xf
+  801244:	68 5f 2f 80 00       	push   $0x802f5f
+  801249:	6a 23                	push   $0x23
+  80124b:	68 7c 2f 80 00       	push   $0x802f7c
+  801250:	e8 20 13 00 00       	call   802575 <_panic>
+
+00801255 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	57                   	push   %edi
+  801259:	56                   	push   %esi
+  80125a:	53                   	push   %ebx
+  80125b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80125e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801263:	8b 55 08             	mov    0x8(%ebp),%edx
+  801266:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801269:	b8 10 00 00 00       	mov    $0x10,%eax
+  80126e:	89 df                	mov    %ebx,%edi
+  801270:	89 de                	mov    %ebx,%esi
+  801272:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801274:	85 c0                	test   %eax,%eax
+  801276:	7f 08                	jg     801280 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  801278:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127b:	5b                   	pop    %ebx
+  80127c:	5e                   	pop    %esi
+  80127d:	5f                   	pop    %edi
+  80127e:	5d                   	pop    %ebp
+  80127f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801280:	83 ec 0c             	sub    $0xc,%esp
+  801283:	50                   	push   %eax
+  801284:	6a 10                	push   $0x10
+  801286:	68 5f 2f 80 00       	push   $0x802f5f
+  80128b:	6a 23                	push   $0x23
+  80128d:	68 7c 2f 80 00       	push   $0x802f7c
+  801292:	e8 de 12 00 00       	call   802575 <_panic>
+
+00801297 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  801297:	55                   	push   %ebp
+  801298:	89 e5                	mov    %esp,%ebp
+  80129a:	57                   	push   %edi
+  80129b:	56                   	push   %esi
+  80129c:	53                   	push   %ebx
+  80129d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ab:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012b0:	89 df                	mov    %ebx,%edi
+  8012b2:	89 de                	mov    %ebx,%esi
+  8012b4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012b6:	85 c0                	test   %eax,%eax
+  8012b8:	7f 08                	jg     8012c2 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  8012ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012bd:	5b                   	pop    %ebx
+  8012be:	5e                   	pop    %esi
+  8012bf:	5f                   	pop    %edi
+  8012c0:	5d                   	pop    %ebp
+  8012c1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c2:	83 ec 0c             	sub    $0xc,%esp
+  8012c5:	50                   	push   %eax
+  8012c6:	6a 11                	push   $0x11
+  8012c8:	68 5f 2f 80 00       	push   $0x802f5f
+  8012cd:	6a 23                	push   $0x23
+  8012cf:	68 7c 2f 80 00       	push   $0x802f7c
+  8012d4:	e8 9c 12 00 00       	call   802575 <_panic>
+
+008012d9 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  8012d9:	55                   	push   %ebp
+  8012da:	89 e5                	mov    %esp,%ebp
+  8012dc:	57                   	push   %edi
+  8012dd:	56                   	push   %esi
+  8012de:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e4:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012e9:	89 d1                	mov    %edx,%ecx
+  8012eb:	89 d3                	mov    %edx,%ebx
+  8012ed:	89 d7                	mov    %edx,%edi
+  8012ef:	89 d6                	mov    %edx,%esi
+  8012f1:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  8012f3:	5b                   	pop    %ebx
+  8012f4:	5e                   	pop    %esi
+  8012f5:	5f                   	pop    %edi
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	c3                   	ret
+
+008012f8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	57                   	push   %edi
+  8012fc:	56                   	push   %esi
+  8012fd:	53                   	push   %ebx
+  8012fe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801301:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801306:	8b 55 08             	mov    0x8(%ebp),%edx
+  801309:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801311:	89 df                	mov    %ebx,%edi
+  801313:	89 de                	mov    %ebx,%esi
+  801315:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801317:	85 c0                	test   %eax,%eax
+  801319:	7f 08                	jg     801323 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80131b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131e:	5b                   	pop    %ebx
+  80131f:	5e                   	pop    %esi
+  801320:	5f                   	pop    %edi
+  801321:	5d                   	pop    %ebp
+  801322:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801323:	83 ec 0c             	sub    $0xc,%esp
+  801326:	50                   	push   %eax
+  801327:	6a 13                	push   $0x13
+  801329:	68 5f 2f 80 00       	push   $0x802f5f
+  80132e:	6a 23                	push   $0x23
+  801330:	68 7c 2f 80 00       	push   $0x802f7c
+  801335:	e8 3b 12 00 00       	call   802575 <_panic>
+
+0080133a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80133a:	55                   	push   %ebp
+  80133b:	89 e5                	mov    %esp,%ebp
+  80133d:	57                   	push   %edi
+  80133e:	56                   	push   %esi
+  80133f:	53                   	push   %ebx
+  801340:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801343:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801348:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801353:	89 df                	mov    %ebx,%edi
+  801355:	89 de                	mov    %ebx,%esi
+  801357:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	7f 08                	jg     801365 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80135d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801360:	5b                   	pop    %ebx
+  801361:	5e                   	pop    %esi
+  801362:	5f                   	pop    %edi
+  801363:	5d                   	pop    %ebp
+  801364:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801365:	83 ec 0c             	sub    $0xc,%esp
+  801368:	50                   	push   %eax
+  801369:	6a 14                	push   $0x14
+  80136b:	68 5f 2f 80 00       	push   $0x802f5f
+  801370:	6a 23                	push   $0x23
+  801372:	68 7c 2f 80 00       	push   $0x802f7c
+  801377:	e8 f9 11 00 00       	call   802575 <_panic>
+
+0080137c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80137c:	55                   	push   %ebp
+  80137d:	89 e5                	mov    %esp,%ebp
+  80137f:	57                   	push   %edi
+  801380:	56                   	push   %esi
+  801381:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801382:	8b 55 08             	mov    0x8(%ebp),%edx
+  801385:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801388:	b8 17 00 00 00       	mov    $0x17,%eax
+  80138d:	be 00 00 00 00       	mov    $0x0,%esi
+  801392:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801395:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801398:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80139a:	5b                   	pop    %ebx
+  80139b:	5e                   	pop    %esi
+  80139c:	5f                   	pop    %edi
+  80139d:	5d                   	pop    %ebp
+  80139e:	c3                   	ret
+
+0080139f <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80139f:	55                   	push   %ebp
+  8013a0:	89 e5                	mov    %esp,%ebp
+  8013a2:	57                   	push   %edi
+  8013a3:	56                   	push   %esi
+  8013a4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ab:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013bb:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8013bd:	5b                   	pop    %ebx
+  8013be:	5e                   	pop    %esi
+  8013bf:	5f                   	pop    %edi
+  8013c0:	5d                   	pop    %ebp
+  8013c1:	c3                   	ret
+
+008013c2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	57                   	push   %edi
+  8013c6:	56                   	push   %esi
+  8013c7:	53                   	push   %ebx
+  8013c8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d3:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013d8:	89 cb                	mov    %ecx,%ebx
+  8013da:	89 cf                	mov    %ecx,%edi
+  8013dc:	89 ce                	mov    %ecx,%esi
+  8013de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013e0:	85 c0                	test   %eax,%eax
+  8013e2:	7f 08                	jg     8013ec <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8013e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e7:	5b                   	pop    %ebx
+  8013e8:	5e                   	pop    %esi
+  8013e9:	5f                   	pop    %edi
+  8013ea:	5d                   	pop    %ebp
+  8013eb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ec:	83 ec 0c             	sub    $0xc,%esp
+  8013ef:	50                   	push   %eax
+  8013f0:	6a 19                	push   $0x19
+  8013f2:	68 5f 2f 80 00       	push   $0x802f5f
+  8013f7:	6a 23                	push   $0x23
+  8013f9:	68 7c 2f 80 00       	push   $0x802f7c
+  8013fe:	e8 72 11 00 00       	call   802575 <_panic>
+
+00801403 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801403:	55                   	push   %ebp
+  801404:	89 e5                	mov    %esp,%ebp
+  801406:	57                   	push   %edi
+  801407:	56                   	push   %esi
+  801408:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801413:	89 d1                	mov    %edx,%ecx
+  801415:	89 d3                	mov    %edx,%ebx
+  801417:	89 d7                	mov    %edx,%edi
+  801419:	89 d6                	mov    %edx,%esi
+  80141b:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80141d:	5b                   	pop    %ebx
+  80141e:	5e                   	pop    %esi
+  80141f:	5f                   	pop    %edi
+  801420:	5d                   	pop    %ebp
+  801421:	c3                   	ret
+
+00801422 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801422:	55                   	push   %ebp
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	57                   	push   %edi
+  801426:	56                   	push   %esi
+  801427:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801430:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801433:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801438:	89 df                	mov    %ebx,%edi
+  80143a:	89 de                	mov    %ebx,%esi
+  80143c:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  80143e:	5b                   	pop    %ebx
+  80143f:	5e                   	pop    %esi
+  801440:	5f                   	pop    %edi
+  801441:	5d                   	pop    %ebp
+  801442:	c3                   	ret
+
+00801443 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801443:	55                   	push   %ebp
+  801444:	89 e5                	mov    %esp,%ebp
+  801446:	57                   	push   %edi
+  801447:	56                   	push   %esi
+  801448:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801449:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801451:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801454:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801459:	89 df                	mov    %ebx,%edi
+  80145b:	89 de                	mov    %ebx,%esi
+  80145d:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  80145f:	5b                   	pop    %ebx
+  801460:	5e                   	pop    %esi
+  801461:	5f                   	pop    %edi
+  801462:	5d                   	pop    %ebp
+  801463:	c3                   	ret
+
+00801464 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801464:	55                   	push   %ebp
+  801465:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801467:	8b 45 08             	mov    0x8(%ebp),%eax
+  80146a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80146f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801472:	5d                   	pop    %ebp
+  801473:	c3                   	ret
+
+00801474 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801474:	55                   	push   %ebp
+  801475:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801477:	8b 45 08             	mov    0x8(%ebp),%eax
+  80147a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80147f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801484:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801489:	5d                   	pop    %ebp
+  80148a:	c3                   	ret
+
+0080148b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80148b:	55                   	push   %ebp
+  80148c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80148e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801493:	eb 02                	jmp    801497 <fd_alloc+0xc>
+  801495:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801497:	89 c2                	mov    %eax,%edx
+  801499:	c1 ea 16             	shr    $0x16,%edx
+  80149c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014a3:	f6 c2 01             	test   $0x1,%dl
+  8014a6:	74 2b                	je     8014d3 <fd_alloc+0x48>
+  8014a8:	89 c2                	mov    %eax,%edx
+  8014aa:	c1 ea 0c             	shr    $0xc,%edx
+  8014ad:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8014b4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8014ba:	f6 c1 01             	test   $0x1,%cl
+  8014bd:	74 14                	je     8014d3 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8014bf:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8014c5:	75 ce                	jne    801495 <fd_alloc+0xa>
+  8014c7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8014cc:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8014d1:	eb 05                	jmp    8014d8 <fd_alloc+0x4d>
+			return 0;
+  8014d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8014d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014db:	89 02                	mov    %eax,(%edx)
+}
+  8014dd:	89 c8                	mov    %ecx,%eax
+  8014df:	5d                   	pop    %ebp
+  8014e0:	c3                   	ret
+
+008014e1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8014e7:	83 f8 1f             	cmp    $0x1f,%eax
+  8014ea:	77 30                	ja     80151c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8014ec:	c1 e0 0c             	shl    $0xc,%eax
+  8014ef:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8014f4:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8014fa:	f6 c2 01             	test   $0x1,%dl
+  8014fd:	74 24                	je     801523 <fd_lookup+0x42>
+  8014ff:	89 c2                	mov    %eax,%edx
+  801501:	c1 ea 0c             	shr    $0xc,%edx
+  801504:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80150b:	f6 c2 01             	test   $0x1,%dl
+  80150e:	74 1a                	je     80152a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801510:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801513:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801515:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80151a:	5d                   	pop    %ebp
+  80151b:	c3                   	ret
+		return -E_INVAL;
+  80151c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801521:	eb f7                	jmp    80151a <fd_lookup+0x39>
+		return -E_INVAL;
+  801523:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801528:	eb f0                	jmp    80151a <fd_lookup+0x39>
+  80152a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80152f:	eb e9                	jmp    80151a <fd_lookup+0x39>
+
+00801531 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	53                   	push   %ebx
+  801535:	83 ec 04             	sub    $0x4,%esp
+  801538:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80153b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801540:	eb 03                	jmp    801545 <dev_lookup+0x14>
+  801542:	83 c0 01             	add    $0x1,%eax
+  801545:	8b 1c 85 08 30 80 00 	mov    0x803008(,%eax,4),%ebx
+  80154c:	85 db                	test   %ebx,%ebx
+  80154e:	74 0b                	je     80155b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801550:	39 13                	cmp    %edx,(%ebx)
+  801552:	75 ee                	jne    801542 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801554:	b8 00 00 00 00       	mov    $0x0,%eax
+  801559:	eb 1f                	jmp    80157a <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80155b:	a1 18 50 80 00       	mov    0x805018,%eax
+  801560:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801563:	83 ec 04             	sub    $0x4,%esp
+  801566:	52                   	push   %edx
+  801567:	50                   	push   %eax
+  801568:	68 8c 2f 80 00       	push   $0x802f8c
+  80156d:	e8 72 f0 ff ff       	call   8005e4 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801572:	83 c4 10             	add    $0x10,%esp
+  801575:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80157a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80157d:	89 1a                	mov    %ebx,(%edx)
+}
+  80157f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801582:	c9                   	leave
+  801583:	c3                   	ret
+
+00801584 <fd_close>:
+{
+  801584:	55                   	push   %ebp
+  801585:	89 e5                	mov    %esp,%ebp
+  801587:	57                   	push   %edi
+  801588:	56                   	push   %esi
+  801589:	53                   	push   %ebx
+  80158a:	83 ec 24             	sub    $0x24,%esp
+  80158d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801590:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801593:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801596:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801597:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80159d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015a0:	50                   	push   %eax
+  8015a1:	e8 3b ff ff ff       	call   8014e1 <fd_lookup>
+  8015a6:	89 c3                	mov    %eax,%ebx
+  8015a8:	83 c4 10             	add    $0x10,%esp
+  8015ab:	85 c0                	test   %eax,%eax
+  8015ad:	78 05                	js     8015b4 <fd_close+0x30>
+	    || fd != fd2)
+  8015af:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8015b2:	74 16                	je     8015ca <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8015b4:	89 f8                	mov    %edi,%eax
+  8015b6:	84 c0                	test   %al,%al
+  8015b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8015c0:	89 d8                	mov    %ebx,%eax
+  8015c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c5:	5b                   	pop    %ebx
+  8015c6:	5e                   	pop    %esi
+  8015c7:	5f                   	pop    %edi
+  8015c8:	5d                   	pop    %ebp
+  8015c9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8015ca:	83 ec 08             	sub    $0x8,%esp
+  8015cd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8015d0:	50                   	push   %eax
+  8015d1:	ff 36                	push   (%esi)
+  8015d3:	e8 59 ff ff ff       	call   801531 <dev_lookup>
+  8015d8:	89 c3                	mov    %eax,%ebx
+  8015da:	83 c4 10             	add    $0x10,%esp
+  8015dd:	85 c0                	test   %eax,%eax
+  8015df:	78 1a                	js     8015fb <fd_close+0x77>
+		if (dev->dev_close)
+  8015e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015e4:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8015e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8015ec:	85 c0                	test   %eax,%eax
+  8015ee:	74 0b                	je     8015fb <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8015f0:	83 ec 0c             	sub    $0xc,%esp
+  8015f3:	56                   	push   %esi
+  8015f4:	ff d0                	call   *%eax
+  8015f6:	89 c3                	mov    %eax,%ebx
+  8015f8:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8015fb:	83 ec 08             	sub    $0x8,%esp
+  8015fe:	56                   	push   %esi
+  8015ff:	6a 00                	push   $0x0
+  801601:	e8 01 fb ff ff       	call   801107 <sys_page_unmap>
+	return r;
+  801606:	83 c4 10             	add    $0x10,%esp
+  801609:	eb b5                	jmp    8015c0 <fd_close+0x3c>
+
+0080160b <close>:
+
+int
+close(int fdnum)
+{
+  80160b:	55                   	push   %ebp
+  80160c:	89 e5                	mov    %esp,%ebp
+  80160e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801611:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801614:	50                   	push   %eax
+  801615:	ff 75 08             	push   0x8(%ebp)
+  801618:	e8 c4 fe ff ff       	call   8014e1 <fd_lookup>
+  80161d:	83 c4 10             	add    $0x10,%esp
+  801620:	85 c0                	test   %eax,%eax
+  801622:	79 02                	jns    801626 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801624:	c9                   	leave
+  801625:	c3                   	ret
+		return fd_close(fd, 1);
+  801626:	83 ec 08             	sub    $0x8,%esp
+  801629:	6a 01                	push   $0x1
+  80162b:	ff 75 f4             	push   -0xc(%ebp)
+  80162e:	e8 51 ff ff ff       	call   801584 <fd_close>
+  801633:	83 c4 10             	add    $0x10,%esp
+  801636:	eb ec                	jmp    801624 <close+0x19>
+
+00801638 <close_all>:
+
+void
+close_all(void)
+{
+  801638:	55                   	push   %ebp
+  801639:	89 e5                	mov    %esp,%ebp
+  80163b:	53                   	push   %ebx
+  80163c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80163f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801644:	83 ec 0c             	sub    $0xc,%esp
+  801647:	53                   	push   %ebx
+  801648:	e8 be ff ff ff       	call   80160b <close>
+	for (i = 0; i < MAXFD; i++)
+  80164d:	83 c3 01             	add    $0x1,%ebx
+  801650:	83 c4 10             	add    $0x10,%esp
+  801653:	83 fb 20             	cmp    $0x20,%ebx
+  801656:	75 ec                	jne    801644 <close_all+0xc>
+}
+  801658:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80165b:	c9                   	leave
+  80165c:	c3                   	ret
+
+0080165d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80165d:	55                   	push   %ebp
+  80165e:	89 e5                	mov    %esp,%ebp
+  801660:	57                   	push   %edi
+  801661:	56                   	push   %esi
+  801662:	53                   	push   %ebx
+  801663:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801666:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801669:	50                   	push   %eax
+  80166a:	ff 75 08             	push   0x8(%ebp)
+  80166d:	e8 6f fe ff ff       	call   8014e1 <fd_lookup>
+  801672:	89 c3                	mov    %eax,%ebx
+  801674:	83 c4 10             	add    $0x10,%esp
+  801677:	85 c0                	test   %eax,%eax
+  801679:	78 7f                	js     8016fa <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80167b:	83 ec 0c             	sub    $0xc,%esp
+  80167e:	ff 75 0c             	push   0xc(%ebp)
+  801681:	e8 85 ff ff ff       	call   80160b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801686:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801689:	c1 e6 0c             	shl    $0xc,%esi
+  80168c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801692:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801695:	89 3c 24             	mov    %edi,(%esp)
+  801698:	e8 d7 fd ff ff       	call   801474 <fd2data>
+  80169d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80169f:	89 34 24             	mov    %esi,(%esp)
+  8016a2:	e8 cd fd ff ff       	call   801474 <fd2data>
+  8016a7:	83 c4 10             	add    $0x10,%esp
+  8016aa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8016ad:	89 d8                	mov    %ebx,%eax
+  8016af:	c1 e8 16             	shr    $0x16,%eax
+  8016b2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016b9:	a8 01                	test   $0x1,%al
+  8016bb:	74 11                	je     8016ce <dup+0x71>
+  8016bd:	89 d8                	mov    %ebx,%eax
+  8016bf:	c1 e8 0c             	shr    $0xc,%eax
+  8016c2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016c9:	f6 c2 01             	test   $0x1,%dl
+  8016cc:	75 36                	jne    801704 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8016ce:	89 f8                	mov    %edi,%eax
+  8016d0:	c1 e8 0c             	shr    $0xc,%eax
+  8016d3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016da:	83 ec 0c             	sub    $0xc,%esp
+  8016dd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016e2:	50                   	push   %eax
+  8016e3:	56                   	push   %esi
+  8016e4:	6a 00                	push   $0x0
+  8016e6:	57                   	push   %edi
+  8016e7:	6a 00                	push   $0x0
+  8016e9:	e8 d7 f9 ff ff       	call   8010c5 <sys_page_map>
+  8016ee:	89 c3                	mov    %eax,%ebx
+  8016f0:	83 c4 20             	add    $0x20,%esp
+  8016f3:	85 c0                	test   %eax,%eax
+  8016f5:	78 33                	js     80172a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8016f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8016fa:	89 d8                	mov    %ebx,%eax
+  8016fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ff:	5b                   	pop    %ebx
+  801700:	5e                   	pop    %esi
+  801701:	5f                   	pop    %edi
+  801702:	5d                   	pop    %ebp
+  801703:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801704:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80170b:	83 ec 0c             	sub    $0xc,%esp
+  80170e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801713:	50                   	push   %eax
+  801714:	ff 75 d4             	push   -0x2c(%ebp)
+  801717:	6a 00                	push   $0x0
+  801719:	53                   	push   %ebx
+  80171a:	6a 00                	push   $0x0
+  80171c:	e8 a4 f9 ff ff       	call   8010c5 <sys_page_map>
+  801721:	89 c3                	mov    %eax,%ebx
+  801723:	83 c4 20             	add    $0x20,%esp
+  801726:	85 c0                	test   %eax,%eax
+  801728:	79 a4                	jns    8016ce <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80172a:	83 ec 08             	sub    $0x8,%esp
+  80172d:	56                   	push   %esi
+  80172e:	6a 00                	push   $0x0
+  801730:	e8 d2 f9 ff ff       	call   801107 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801735:	83 c4 08             	add    $0x8,%esp
+  801738:	ff 75 d4             	push   -0x2c(%ebp)
+  80173b:	6a 00                	push   $0x0
+  80173d:	e8 c5 f9 ff ff       	call   801107 <sys_page_unmap>
+	return r;
+  801742:	83 c4 10             	add    $0x10,%esp
+  801745:	eb b3                	jmp    8016fa <dup+0x9d>
+
+00801747 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801747:	55                   	push   %ebp
+  801748:	89 e5                	mov    %esp,%ebp
+  80174a:	56                   	push   %esi
+  80174b:	53                   	push   %ebx
+  80174c:	83 ec 18             	sub    $0x18,%esp
+  80174f:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801752:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801755:	50                   	push   %eax
+  801756:	56                   	push   %esi
+  801757:	e8 85 fd ff ff       	call   8014e1 <fd_lookup>
+  80175c:	83 c4 10             	add    $0x10,%esp
+  80175f:	85 c0                	test   %eax,%eax
+  801761:	78 3c                	js     80179f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801763:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801766:	83 ec 08             	sub    $0x8,%esp
+  801769:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80176c:	50                   	push   %eax
+  80176d:	ff 33                	push   (%ebx)
+  80176f:	e8 bd fd ff ff       	call   801531 <dev_lookup>
+  801774:	83 c4 10             	add    $0x10,%esp
+  801777:	85 c0                	test   %eax,%eax
+  801779:	78 24                	js     80179f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80177b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80177e:	83 e0 03             	and    $0x3,%eax
+  801781:	83 f8 01             	cmp    $0x1,%eax
+  801784:	74 20                	je     8017a6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801786:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801789:	8b 40 08             	mov    0x8(%eax),%eax
+  80178c:	85 c0                	test   %eax,%eax
+  80178e:	74 37                	je     8017c7 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801790:	83 ec 04             	sub    $0x4,%esp
+  801793:	ff 75 10             	push   0x10(%ebp)
+  801796:	ff 75 0c             	push   0xc(%ebp)
+  801799:	53                   	push   %ebx
+  80179a:	ff d0                	call   *%eax
+  80179c:	83 c4 10             	add    $0x10,%esp
+}
+  80179f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a2:	5b                   	pop    %ebx
+  8017a3:	5e                   	pop    %esi
+  8017a4:	5d                   	pop    %ebp
+  8017a5:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017a6:	a1 18 50 80 00       	mov    0x805018,%eax
+  8017ab:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8017ae:	83 ec 04             	sub    $0x4,%esp
+  8017b1:	56                   	push   %esi
+  8017b2:	50                   	push   %eax
+  8017b3:	68 cd 2f 80 00       	push   $0x802fcd
+  8017b8:	e8 27 ee ff ff       	call   8005e4 <cprintf>
+		return -E_INVAL;
+  8017bd:	83 c4 10             	add    $0x10,%esp
+  8017c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c5:	eb d8                	jmp    80179f <read+0x58>
+		return -E_NOT_SUPP;
+  8017c7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017cc:	eb d1                	jmp    80179f <read+0x58>
+
+008017ce <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8017ce:	55                   	push   %ebp
+  8017cf:	89 e5                	mov    %esp,%ebp
+  8017d1:	57                   	push   %edi
+  8017d2:	56                   	push   %esi
+  8017d3:	53                   	push   %ebx
+  8017d4:	83 ec 0c             	sub    $0xc,%esp
+  8017d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017da:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8017dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e2:	eb 02                	jmp    8017e6 <readn+0x18>
+  8017e4:	01 c3                	add    %eax,%ebx
+  8017e6:	39 f3                	cmp    %esi,%ebx
+  8017e8:	73 21                	jae    80180b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017ea:	83 ec 04             	sub    $0x4,%esp
+  8017ed:	89 f0                	mov    %esi,%eax
+  8017ef:	29 d8                	sub    %ebx,%eax
+  8017f1:	50                   	push   %eax
+  8017f2:	89 d8                	mov    %ebx,%eax
+  8017f4:	03 45 0c             	add    0xc(%ebp),%eax
+  8017f7:	50                   	push   %eax
+  8017f8:	57                   	push   %edi
+  8017f9:	e8 49 ff ff ff       	call   801747 <read>
+		if (m < 0)
+  8017fe:	83 c4 10             	add    $0x10,%esp
+  801801:	85 c0                	test   %eax,%eax
+  801803:	78 04                	js     801809 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801805:	75 dd                	jne    8017e4 <readn+0x16>
+  801807:	eb 02                	jmp    80180b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801809:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80180b:	89 d8                	mov    %ebx,%eax
+  80180d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801810:	5b                   	pop    %ebx
+  801811:	5e                   	pop    %esi
+  801812:	5f                   	pop    %edi
+  801813:	5d                   	pop    %ebp
+  801814:	c3                   	ret
+
+00801815 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801815:	55                   	push   %ebp
+  801816:	89 e5                	mov    %esp,%ebp
+  801818:	56                   	push   %esi
+  801819:	53                   	push   %ebx
+  80181a:	83 ec 18             	sub    $0x18,%esp
+  80181d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801820:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801823:	50                   	push   %eax
+  801824:	53                   	push   %ebx
+  801825:	e8 b7 fc ff ff       	call   8014e1 <fd_lookup>
+  80182a:	83 c4 10             	add    $0x10,%esp
+  80182d:	85 c0                	test   %eax,%eax
+  80182f:	78 37                	js     801868 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801831:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801834:	83 ec 08             	sub    $0x8,%esp
+  801837:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80183a:	50                   	push   %eax
+  80183b:	ff 36                	push   (%esi)
+  80183d:	e8 ef fc ff ff       	call   801531 <dev_lookup>
+  801842:	83 c4 10             	add    $0x10,%esp
+  801845:	85 c0                	test   %eax,%eax
+  801847:	78 1f                	js     801868 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801849:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80184d:	74 20                	je     80186f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80184f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801852:	8b 40 0c             	mov    0xc(%eax),%eax
+  801855:	85 c0                	test   %eax,%eax
+  801857:	74 37                	je     801890 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801859:	83 ec 04             	sub    $0x4,%esp
+  80185c:	ff 75 10             	push   0x10(%ebp)
+  80185f:	ff 75 0c             	push   0xc(%ebp)
+  801862:	56                   	push   %esi
+  801863:	ff d0                	call   *%eax
+  801865:	83 c4 10             	add    $0x10,%esp
+}
+  801868:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80186b:	5b                   	pop    %ebx
+  80186c:	5e                   	pop    %esi
+  80186d:	5d                   	pop    %ebp
+  80186e:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80186f:	a1 18 50 80 00       	mov    0x805018,%eax
+  801874:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801877:	83 ec 04             	sub    $0x4,%esp
+  80187a:	53                   	push   %ebx
+  80187b:	50                   	push   %eax
+  80187c:	68 e9 2f 80 00       	push   $0x802fe9
+  801881:	e8 5e ed ff ff       	call   8005e4 <cprintf>
+		return -E_INVAL;
+  801886:	83 c4 10             	add    $0x10,%esp
+  801889:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80188e:	eb d8                	jmp    801868 <write+0x53>
+		return -E_NOT_SUPP;
+  801890:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801895:	eb d1                	jmp    801868 <write+0x53>
+
+00801897 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801897:	55                   	push   %ebp
+  801898:	89 e5                	mov    %esp,%ebp
+  80189a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80189d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018a0:	50                   	push   %eax
+  8018a1:	ff 75 08             	push   0x8(%ebp)
+  8018a4:	e8 38 fc ff ff       	call   8014e1 <fd_lookup>
+  8018a9:	83 c4 10             	add    $0x10,%esp
+  8018ac:	85 c0                	test   %eax,%eax
+  8018ae:	78 0e                	js     8018be <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8018b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018b6:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8018b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018be:	c9                   	leave
+  8018bf:	c3                   	ret
+
+008018c0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018c0:	55                   	push   %ebp
+  8018c1:	89 e5                	mov    %esp,%ebp
+  8018c3:	56                   	push   %esi
+  8018c4:	53                   	push   %ebx
+  8018c5:	83 ec 18             	sub    $0x18,%esp
+  8018c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018cb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ce:	50                   	push   %eax
+  8018cf:	53                   	push   %ebx
+  8018d0:	e8 0c fc ff ff       	call   8014e1 <fd_lookup>
+  8018d5:	83 c4 10             	add    $0x10,%esp
+  8018d8:	85 c0                	test   %eax,%eax
+  8018da:	78 34                	js     801910 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018df:	83 ec 08             	sub    $0x8,%esp
+  8018e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018e5:	50                   	push   %eax
+  8018e6:	ff 36                	push   (%esi)
+  8018e8:	e8 44 fc ff ff       	call   801531 <dev_lookup>
+  8018ed:	83 c4 10             	add    $0x10,%esp
+  8018f0:	85 c0                	test   %eax,%eax
+  8018f2:	78 1c                	js     801910 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018f4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018f8:	74 1d                	je     801917 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8018fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018fd:	8b 40 18             	mov    0x18(%eax),%eax
+  801900:	85 c0                	test   %eax,%eax
+  801902:	74 34                	je     801938 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801904:	83 ec 08             	sub    $0x8,%esp
+  801907:	ff 75 0c             	push   0xc(%ebp)
+  80190a:	56                   	push   %esi
+  80190b:	ff d0                	call   *%eax
+  80190d:	83 c4 10             	add    $0x10,%esp
+}
+  801910:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801913:	5b                   	pop    %ebx
+  801914:	5e                   	pop    %esi
+  801915:	5d                   	pop    %ebp
+  801916:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801917:	a1 18 50 80 00       	mov    0x805018,%eax
+  80191c:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80191f:	83 ec 04             	sub    $0x4,%esp
+  801922:	53                   	push   %ebx
+  801923:	50                   	push   %eax
+  801924:	68 ac 2f 80 00       	push   $0x802fac
+  801929:	e8 b6 ec ff ff       	call   8005e4 <cprintf>
+		return -E_INVAL;
+  80192e:	83 c4 10             	add    $0x10,%esp
+  801931:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801936:	eb d8                	jmp    801910 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801938:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80193d:	eb d1                	jmp    801910 <ftruncate+0x50>
+
+0080193f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80193f:	55                   	push   %ebp
+  801940:	89 e5                	mov    %esp,%ebp
+  801942:	56                   	push   %esi
+  801943:	53                   	push   %ebx
+  801944:	83 ec 18             	sub    $0x18,%esp
+  801947:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80194a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80194d:	50                   	push   %eax
+  80194e:	ff 75 08             	push   0x8(%ebp)
+  801951:	e8 8b fb ff ff       	call   8014e1 <fd_lookup>
+  801956:	83 c4 10             	add    $0x10,%esp
+  801959:	85 c0                	test   %eax,%eax
+  80195b:	78 49                	js     8019a6 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80195d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801960:	83 ec 08             	sub    $0x8,%esp
+  801963:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801966:	50                   	push   %eax
+  801967:	ff 36                	push   (%esi)
+  801969:	e8 c3 fb ff ff       	call   801531 <dev_lookup>
+  80196e:	83 c4 10             	add    $0x10,%esp
+  801971:	85 c0                	test   %eax,%eax
+  801973:	78 31                	js     8019a6 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801975:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801978:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80197c:	74 2f                	je     8019ad <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80197e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801981:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801988:	00 00 00 
+	stat->st_isdir = 0;
+  80198b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801992:	00 00 00 
+	stat->st_dev = dev;
+  801995:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80199b:	83 ec 08             	sub    $0x8,%esp
+  80199e:	53                   	push   %ebx
+  80199f:	56                   	push   %esi
+  8019a0:	ff 50 14             	call   *0x14(%eax)
+  8019a3:	83 c4 10             	add    $0x10,%esp
+}
+  8019a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a9:	5b                   	pop    %ebx
+  8019aa:	5e                   	pop    %esi
+  8019ab:	5d                   	pop    %ebp
+  8019ac:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019ad:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019b2:	eb f2                	jmp    8019a6 <fstat+0x67>
+
+008019b4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019b4:	55                   	push   %ebp
+  8019b5:	89 e5                	mov    %esp,%ebp
+  8019b7:	56                   	push   %esi
+  8019b8:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8019b9:	83 ec 08             	sub    $0x8,%esp
+  8019bc:	6a 00                	push   $0x0
+  8019be:	ff 75 08             	push   0x8(%ebp)
+  8019c1:	e8 e4 01 00 00       	call   801baa <open>
+  8019c6:	89 c3                	mov    %eax,%ebx
+  8019c8:	83 c4 10             	add    $0x10,%esp
+  8019cb:	85 c0                	test   %eax,%eax
+  8019cd:	78 1b                	js     8019ea <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8019cf:	83 ec 08             	sub    $0x8,%esp
+  8019d2:	ff 75 0c             	push   0xc(%ebp)
+  8019d5:	50                   	push   %eax
+  8019d6:	e8 64 ff ff ff       	call   80193f <fstat>
+  8019db:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8019dd:	89 1c 24             	mov    %ebx,(%esp)
+  8019e0:	e8 26 fc ff ff       	call   80160b <close>
+	return r;
+  8019e5:	83 c4 10             	add    $0x10,%esp
+  8019e8:	89 f3                	mov    %esi,%ebx
+}
+  8019ea:	89 d8                	mov    %ebx,%eax
+  8019ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ef:	5b                   	pop    %ebx
+  8019f0:	5e                   	pop    %esi
+  8019f1:	5d                   	pop    %ebp
+  8019f2:	c3                   	ret
+
+008019f3 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8019f3:	55                   	push   %ebp
+  8019f4:	89 e5                	mov    %esp,%ebp
+  8019f6:	56                   	push   %esi
+  8019f7:	53                   	push   %ebx
+  8019f8:	89 c6                	mov    %eax,%esi
+  8019fa:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8019fc:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  801a03:	74 27                	je     801a2c <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a05:	6a 07                	push   $0x7
+  801a07:	68 00 60 80 00       	push   $0x806000
+  801a0c:	56                   	push   %esi
+  801a0d:	ff 35 10 50 80 00    	push   0x805010
+  801a13:	e8 1b 0c 00 00       	call   802633 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801a18:	83 c4 0c             	add    $0xc,%esp
+  801a1b:	6a 00                	push   $0x0
+  801a1d:	53                   	push   %ebx
+  801a1e:	6a 00                	push   $0x0
+  801a20:	e8 96 0b 00 00       	call   8025bb <ipc_recv>
+}
+  801a25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a28:	5b                   	pop    %ebx
+  801a29:	5e                   	pop    %esi
+  801a2a:	5d                   	pop    %ebp
+  801a2b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a2c:	83 ec 0c             	sub    $0xc,%esp
+  801a2f:	6a 01                	push   $0x1
+  801a31:	e8 51 0c 00 00       	call   802687 <ipc_find_env>
+  801a36:	a3 10 50 80 00       	mov    %eax,0x805010
+  801a3b:	83 c4 10             	add    $0x10,%esp
+  801a3e:	eb c5                	jmp    801a05 <fsipc+0x12>
+
+00801a40 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a40:	55                   	push   %ebp
+  801a41:	89 e5                	mov    %esp,%ebp
+  801a43:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a46:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a49:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a4c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801a51:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a54:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801a59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a5e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a63:	e8 8b ff ff ff       	call   8019f3 <fsipc>
+}
+  801a68:	c9                   	leave
+  801a69:	c3                   	ret
+
+00801a6a <devfile_flush>:
+{
+  801a6a:	55                   	push   %ebp
+  801a6b:	89 e5                	mov    %esp,%ebp
+  801a6d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a70:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a73:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a76:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801a7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a80:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a85:	e8 69 ff ff ff       	call   8019f3 <fsipc>
+}
+  801a8a:	c9                   	leave
+  801a8b:	c3                   	ret
+
+00801a8c <devfile_stat>:
+{
+  801a8c:	55                   	push   %ebp
+  801a8d:	89 e5                	mov    %esp,%ebp
+  801a8f:	53                   	push   %ebx
+  801a90:	83 ec 04             	sub    $0x4,%esp
+  801a93:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a99:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a9c:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801aa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa6:	b8 05 00 00 00       	mov    $0x5,%eax
+  801aab:	e8 43 ff ff ff       	call   8019f3 <fsipc>
+  801ab0:	85 c0                	test   %eax,%eax
+  801ab2:	78 2c                	js     801ae0 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ab4:	83 ec 08             	sub    $0x8,%esp
+  801ab7:	68 00 60 80 00       	push   $0x806000
+  801abc:	53                   	push   %ebx
+  801abd:	e8 10 f1 ff ff       	call   800bd2 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801ac2:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ac7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801acd:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ad2:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801ad8:	83 c4 10             	add    $0x10,%esp
+  801adb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ae0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae3:	c9                   	leave
+  801ae4:	c3                   	ret
+
+00801ae5 <devfile_write>:
+{
+  801ae5:	55                   	push   %ebp
+  801ae6:	89 e5                	mov    %esp,%ebp
+  801ae8:	83 ec 0c             	sub    $0xc,%esp
+  801aeb:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801aee:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801af3:	39 d0                	cmp    %edx,%eax
+  801af5:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801af8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801afb:	8b 52 0c             	mov    0xc(%edx),%edx
+  801afe:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801b04:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801b09:	50                   	push   %eax
+  801b0a:	ff 75 0c             	push   0xc(%ebp)
+  801b0d:	68 08 60 80 00       	push   $0x806008
+  801b12:	e8 41 f2 ff ff       	call   800d58 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801b17:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b21:	e8 cd fe ff ff       	call   8019f3 <fsipc>
+}
+  801b26:	c9                   	leave
+  801b27:	c3                   	ret
+
+00801b28 <devfile_read>:
+{
+  801b28:	55                   	push   %ebp
+  801b29:	89 e5                	mov    %esp,%ebp
+  801b2b:	56                   	push   %esi
+  801b2c:	53                   	push   %ebx
+  801b2d:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b33:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b36:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801b3b:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b46:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b4b:	e8 a3 fe ff ff       	call   8019f3 <fsipc>
+  801b50:	89 c3                	mov    %eax,%ebx
+  801b52:	85 c0                	test   %eax,%eax
+  801b54:	78 1f                	js     801b75 <devfile_read+0x4d>
+	assert(r <= n);
+  801b56:	39 c6                	cmp    %eax,%esi
+  801b58:	72 24                	jb     801b7e <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801b5a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b5f:	7f 33                	jg     801b94 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b61:	83 ec 04             	sub    $0x4,%esp
+  801b64:	50                   	push   %eax
+  801b65:	68 00 60 80 00       	push   $0x806000
+  801b6a:	ff 75 0c             	push   0xc(%ebp)
+  801b6d:	e8 e6 f1 ff ff       	call   800d58 <memmove>
+	return r;
+  801b72:	83 c4 10             	add    $0x10,%esp
+}
+  801b75:	89 d8                	mov    %ebx,%eax
+  801b77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b7a:	5b                   	pop    %ebx
+  801b7b:	5e                   	pop    %esi
+  801b7c:	5d                   	pop    %ebp
+  801b7d:	c3                   	ret
+	assert(r <= n);
+  801b7e:	68 1c 30 80 00       	push   $0x80301c
+  801b83:	68 23 30 80 00       	push   $0x803023
+  801b88:	6a 7c                	push   $0x7c
+  801b8a:	68 38 30 80 00       	push   $0x803038
+  801b8f:	e8 e1 09 00 00       	call   802575 <_panic>
+	assert(r <= PGSIZE);
+  801b94:	68 43 30 80 00       	push   $0x803043
+  801b99:	68 23 30 80 00       	push   $0x803023
+  801b9e:	6a 7d                	push   $0x7d
+  801ba0:	68 38 30 80 00       	push   $0x803038
+  801ba5:	e8 cb 09 00 00       	call   802575 <_panic>
+
+00801baa <open>:
+{
+  801baa:	55                   	push   %ebp
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	56                   	push   %esi
+  801bae:	53                   	push   %ebx
+  801baf:	83 ec 1c             	sub    $0x1c,%esp
+  801bb2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801bb5:	56                   	push   %esi
+  801bb6:	e8 dc ef ff ff       	call   800b97 <strlen>
+  801bbb:	83 c4 10             	add    $0x10,%esp
+  801bbe:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bc3:	7f 6c                	jg     801c31 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801bc5:	83 ec 0c             	sub    $0xc,%esp
+  801bc8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bcb:	50                   	push   %eax
+  801bcc:	e8 ba f8 ff ff       	call   80148b <fd_alloc>
+  801bd1:	89 c3                	mov    %eax,%ebx
+  801bd3:	83 c4 10             	add    $0x10,%esp
+  801bd6:	85 c0                	test   %eax,%eax
+  801bd8:	78 3c                	js     801c16 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801bda:	83 ec 08             	sub    $0x8,%esp
+  801bdd:	56                   	push   %esi
+  801bde:	68 00 60 80 00       	push   $0x806000
+  801be3:	e8 ea ef ff ff       	call   800bd2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801be8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801beb:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bf0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bf3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bf8:	e8 f6 fd ff ff       	call   8019f3 <fsipc>
+  801bfd:	89 c3                	mov    %eax,%ebx
+  801bff:	83 c4 10             	add    $0x10,%esp
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	78 19                	js     801c1f <open+0x75>
+	return fd2num(fd);
+  801c06:	83 ec 0c             	sub    $0xc,%esp
+  801c09:	ff 75 f4             	push   -0xc(%ebp)
+  801c0c:	e8 53 f8 ff ff       	call   801464 <fd2num>
+  801c11:	89 c3                	mov    %eax,%ebx
+  801c13:	83 c4 10             	add    $0x10,%esp
+}
+  801c16:	89 d8                	mov    %ebx,%eax
+  801c18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c1b:	5b                   	pop    %ebx
+  801c1c:	5e                   	pop    %esi
+  801c1d:	5d                   	pop    %ebp
+  801c1e:	c3                   	ret
+		fd_close(fd, 0);
+  801c1f:	83 ec 08             	sub    $0x8,%esp
+  801c22:	6a 00                	push   $0x0
+  801c24:	ff 75 f4             	push   -0xc(%ebp)
+  801c27:	e8 58 f9 ff ff       	call   801584 <fd_close>
+		return r;
+  801c2c:	83 c4 10             	add    $0x10,%esp
+  801c2f:	eb e5                	jmp    801c16 <open+0x6c>
+		return -E_BAD_PATH;
+  801c31:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c36:	eb de                	jmp    801c16 <open+0x6c>
+
+00801c38 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c38:	55                   	push   %ebp
+  801c39:	89 e5                	mov    %esp,%ebp
+  801c3b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c43:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c48:	e8 a6 fd ff ff       	call   8019f3 <fsipc>
+}
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+
+00801c4f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c4f:	55                   	push   %ebp
+  801c50:	89 e5                	mov    %esp,%ebp
+  801c52:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c55:	68 4f 30 80 00       	push   $0x80304f
+  801c5a:	ff 75 0c             	push   0xc(%ebp)
+  801c5d:	e8 70 ef ff ff       	call   800bd2 <strcpy>
+	return 0;
+}
+  801c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c67:	c9                   	leave
+  801c68:	c3                   	ret
+
+00801c69 <devsock_close>:
+{
+  801c69:	55                   	push   %ebp
+  801c6a:	89 e5                	mov    %esp,%ebp
+  801c6c:	53                   	push   %ebx
+  801c6d:	83 ec 10             	sub    $0x10,%esp
+  801c70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c73:	53                   	push   %ebx
+  801c74:	e8 1e 0a 00 00       	call   802697 <pageref>
+  801c79:	89 c2                	mov    %eax,%edx
+  801c7b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c83:	83 fa 01             	cmp    $0x1,%edx
+  801c86:	74 05                	je     801c8d <devsock_close+0x24>
+}
+  801c88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c8b:	c9                   	leave
+  801c8c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c8d:	83 ec 0c             	sub    $0xc,%esp
+  801c90:	ff 73 0c             	push   0xc(%ebx)
+  801c93:	e8 b7 02 00 00       	call   801f4f <nsipc_close>
+  801c98:	83 c4 10             	add    $0x10,%esp
+  801c9b:	eb eb                	jmp    801c88 <devsock_close+0x1f>
+
+00801c9d <devsock_write>:
+{
+  801c9d:	55                   	push   %ebp
+  801c9e:	89 e5                	mov    %esp,%ebp
+  801ca0:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801ca3:	6a 00                	push   $0x0
+  801ca5:	ff 75 10             	push   0x10(%ebp)
+  801ca8:	ff 75 0c             	push   0xc(%ebp)
+  801cab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cae:	ff 70 0c             	push   0xc(%eax)
+  801cb1:	e8 79 03 00 00       	call   80202f <nsipc_send>
+}
+  801cb6:	c9                   	leave
+  801cb7:	c3                   	ret
+
+00801cb8 <devsock_read>:
+{
+  801cb8:	55                   	push   %ebp
+  801cb9:	89 e5                	mov    %esp,%ebp
+  801cbb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801cbe:	6a 00                	push   $0x0
+  801cc0:	ff 75 10             	push   0x10(%ebp)
+  801cc3:	ff 75 0c             	push   0xc(%ebp)
+  801cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cc9:	ff 70 0c             	push   0xc(%eax)
+  801ccc:	e8 ef 02 00 00       	call   801fc0 <nsipc_recv>
+}
+  801cd1:	c9                   	leave
+  801cd2:	c3                   	ret
+
+00801cd3 <fd2sockid>:
+{
+  801cd3:	55                   	push   %ebp
+  801cd4:	89 e5                	mov    %esp,%ebp
+  801cd6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801cd9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cdc:	52                   	push   %edx
+  801cdd:	50                   	push   %eax
+  801cde:	e8 fe f7 ff ff       	call   8014e1 <fd_lookup>
+  801ce3:	83 c4 10             	add    $0x10,%esp
+  801ce6:	85 c0                	test   %eax,%eax
+  801ce8:	78 10                	js     801cfa <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801cea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ced:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801cf3:	39 08                	cmp    %ecx,(%eax)
+  801cf5:	75 05                	jne    801cfc <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cf7:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cfa:	c9                   	leave
+  801cfb:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cfc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d01:	eb f7                	jmp    801cfa <fd2sockid+0x27>
+
+00801d03 <alloc_sockfd>:
+{
+  801d03:	55                   	push   %ebp
+  801d04:	89 e5                	mov    %esp,%ebp
+  801d06:	56                   	push   %esi
+  801d07:	53                   	push   %ebx
+  801d08:	83 ec 1c             	sub    $0x1c,%esp
+  801d0b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d10:	50                   	push   %eax
+  801d11:	e8 75 f7 ff ff       	call   80148b <fd_alloc>
+  801d16:	89 c3                	mov    %eax,%ebx
+  801d18:	83 c4 10             	add    $0x10,%esp
+  801d1b:	85 c0                	test   %eax,%eax
+  801d1d:	78 43                	js     801d62 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d1f:	83 ec 04             	sub    $0x4,%esp
+  801d22:	68 07 04 00 00       	push   $0x407
+  801d27:	ff 75 f4             	push   -0xc(%ebp)
+  801d2a:	6a 00                	push   $0x0
+  801d2c:	e8 0e f3 ff ff       	call   80103f <sys_page_alloc>
+  801d31:	89 c3                	mov    %eax,%ebx
+  801d33:	83 c4 10             	add    $0x10,%esp
+  801d36:	85 c0                	test   %eax,%eax
+  801d38:	78 28                	js     801d62 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d3d:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d43:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d48:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d4f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d52:	83 ec 0c             	sub    $0xc,%esp
+  801d55:	50                   	push   %eax
+  801d56:	e8 09 f7 ff ff       	call   801464 <fd2num>
+  801d5b:	89 c3                	mov    %eax,%ebx
+  801d5d:	83 c4 10             	add    $0x10,%esp
+  801d60:	eb 0c                	jmp    801d6e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d62:	83 ec 0c             	sub    $0xc,%esp
+  801d65:	56                   	push   %esi
+  801d66:	e8 e4 01 00 00       	call   801f4f <nsipc_close>
+		return r;
+  801d6b:	83 c4 10             	add    $0x10,%esp
+}
+  801d6e:	89 d8                	mov    %ebx,%eax
+  801d70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d73:	5b                   	pop    %ebx
+  801d74:	5e                   	pop    %esi
+  801d75:	5d                   	pop    %ebp
+  801d76:	c3                   	ret
+
+00801d77 <accept>:
+{
+  801d77:	55                   	push   %ebp
+  801d78:	89 e5                	mov    %esp,%ebp
+  801d7a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d80:	e8 4e ff ff ff       	call   801cd3 <fd2sockid>
+  801d85:	85 c0                	test   %eax,%eax
+  801d87:	78 1b                	js     801da4 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d89:	83 ec 04             	sub    $0x4,%esp
+  801d8c:	ff 75 10             	push   0x10(%ebp)
+  801d8f:	ff 75 0c             	push   0xc(%ebp)
+  801d92:	50                   	push   %eax
+  801d93:	e8 0e 01 00 00       	call   801ea6 <nsipc_accept>
+  801d98:	83 c4 10             	add    $0x10,%esp
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 05                	js     801da4 <accept+0x2d>
+	return alloc_sockfd(r);
+  801d9f:	e8 5f ff ff ff       	call   801d03 <alloc_sockfd>
+}
+  801da4:	c9                   	leave
+  801da5:	c3                   	ret
+
+00801da6 <bind>:
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+  801da9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dac:	8b 45 08             	mov    0x8(%ebp),%eax
+  801daf:	e8 1f ff ff ff       	call   801cd3 <fd2sockid>
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	78 12                	js     801dca <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801db8:	83 ec 04             	sub    $0x4,%esp
+  801dbb:	ff 75 10             	push   0x10(%ebp)
+  801dbe:	ff 75 0c             	push   0xc(%ebp)
+  801dc1:	50                   	push   %eax
+  801dc2:	e8 31 01 00 00       	call   801ef8 <nsipc_bind>
+  801dc7:	83 c4 10             	add    $0x10,%esp
+}
+  801dca:	c9                   	leave
+  801dcb:	c3                   	ret
+
+00801dcc <shutdown>:
+{
+  801dcc:	55                   	push   %ebp
+  801dcd:	89 e5                	mov    %esp,%ebp
+  801dcf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd5:	e8 f9 fe ff ff       	call   801cd3 <fd2sockid>
+  801dda:	85 c0                	test   %eax,%eax
+  801ddc:	78 0f                	js     801ded <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dde:	83 ec 08             	sub    $0x8,%esp
+  801de1:	ff 75 0c             	push   0xc(%ebp)
+  801de4:	50                   	push   %eax
+  801de5:	e8 43 01 00 00       	call   801f2d <nsipc_shutdown>
+  801dea:	83 c4 10             	add    $0x10,%esp
+}
+  801ded:	c9                   	leave
+  801dee:	c3                   	ret
+
+00801def <connect>:
+{
+  801def:	55                   	push   %ebp
+  801df0:	89 e5                	mov    %esp,%ebp
+  801df2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801df5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df8:	e8 d6 fe ff ff       	call   801cd3 <fd2sockid>
+  801dfd:	85 c0                	test   %eax,%eax
+  801dff:	78 12                	js     801e13 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e01:	83 ec 04             	sub    $0x4,%esp
+  801e04:	ff 75 10             	push   0x10(%ebp)
+  801e07:	ff 75 0c             	push   0xc(%ebp)
+  801e0a:	50                   	push   %eax
+  801e0b:	e8 59 01 00 00       	call   801f69 <nsipc_connect>
+  801e10:	83 c4 10             	add    $0x10,%esp
+}
+  801e13:	c9                   	leave
+  801e14:	c3                   	ret
+
+00801e15 <listen>:
+{
+  801e15:	55                   	push   %ebp
+  801e16:	89 e5                	mov    %esp,%ebp
+  801e18:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1e:	e8 b0 fe ff ff       	call   801cd3 <fd2sockid>
+  801e23:	85 c0                	test   %eax,%eax
+  801e25:	78 0f                	js     801e36 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e27:	83 ec 08             	sub    $0x8,%esp
+  801e2a:	ff 75 0c             	push   0xc(%ebp)
+  801e2d:	50                   	push   %eax
+  801e2e:	e8 6b 01 00 00       	call   801f9e <nsipc_listen>
+  801e33:	83 c4 10             	add    $0x10,%esp
+}
+  801e36:	c9                   	leave
+  801e37:	c3                   	ret
+
+00801e38 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e38:	55                   	push   %ebp
+  801e39:	89 e5                	mov    %esp,%ebp
+  801e3b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e3e:	ff 75 10             	push   0x10(%ebp)
+  801e41:	ff 75 0c             	push   0xc(%ebp)
+  801e44:	ff 75 08             	push   0x8(%ebp)
+  801e47:	e8 41 02 00 00       	call   80208d <nsipc_socket>
+  801e4c:	83 c4 10             	add    $0x10,%esp
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	78 05                	js     801e58 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e53:	e8 ab fe ff ff       	call   801d03 <alloc_sockfd>
+}
+  801e58:	c9                   	leave
+  801e59:	c3                   	ret
+
+00801e5a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e5a:	55                   	push   %ebp
+  801e5b:	89 e5                	mov    %esp,%ebp
+  801e5d:	53                   	push   %ebx
+  801e5e:	83 ec 04             	sub    $0x4,%esp
+  801e61:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e63:	83 3d 14 50 80 00 00 	cmpl   $0x0,0x805014
+  801e6a:	74 26                	je     801e92 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e6c:	6a 07                	push   $0x7
+  801e6e:	68 00 70 80 00       	push   $0x807000
+  801e73:	53                   	push   %ebx
+  801e74:	ff 35 14 50 80 00    	push   0x805014
+  801e7a:	e8 b4 07 00 00       	call   802633 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e7f:	83 c4 0c             	add    $0xc,%esp
+  801e82:	6a 00                	push   $0x0
+  801e84:	6a 00                	push   $0x0
+  801e86:	6a 00                	push   $0x0
+  801e88:	e8 2e 07 00 00       	call   8025bb <ipc_recv>
+}
+  801e8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e90:	c9                   	leave
+  801e91:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e92:	83 ec 0c             	sub    $0xc,%esp
+  801e95:	6a 02                	push   $0x2
+  801e97:	e8 eb 07 00 00       	call   802687 <ipc_find_env>
+  801e9c:	a3 14 50 80 00       	mov    %eax,0x805014
+  801ea1:	83 c4 10             	add    $0x10,%esp
+  801ea4:	eb c6                	jmp    801e6c <nsipc+0x12>
+
+00801ea6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ea6:	55                   	push   %ebp
+  801ea7:	89 e5                	mov    %esp,%ebp
+  801ea9:	56                   	push   %esi
+  801eaa:	53                   	push   %ebx
+  801eab:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801eae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801eb6:	8b 06                	mov    (%esi),%eax
+  801eb8:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ebd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ec2:	e8 93 ff ff ff       	call   801e5a <nsipc>
+  801ec7:	89 c3                	mov    %eax,%ebx
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	79 09                	jns    801ed6 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801ecd:	89 d8                	mov    %ebx,%eax
+  801ecf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ed2:	5b                   	pop    %ebx
+  801ed3:	5e                   	pop    %esi
+  801ed4:	5d                   	pop    %ebp
+  801ed5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801ed6:	83 ec 04             	sub    $0x4,%esp
+  801ed9:	ff 35 10 70 80 00    	push   0x807010
+  801edf:	68 00 70 80 00       	push   $0x807000
+  801ee4:	ff 75 0c             	push   0xc(%ebp)
+  801ee7:	e8 6c ee ff ff       	call   800d58 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801eec:	a1 10 70 80 00       	mov    0x807010,%eax
+  801ef1:	89 06                	mov    %eax,(%esi)
+  801ef3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ef6:	eb d5                	jmp    801ecd <nsipc_accept+0x27>
+
+00801ef8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ef8:	55                   	push   %ebp
+  801ef9:	89 e5                	mov    %esp,%ebp
+  801efb:	53                   	push   %ebx
+  801efc:	83 ec 08             	sub    $0x8,%esp
+  801eff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f05:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f0a:	53                   	push   %ebx
+  801f0b:	ff 75 0c             	push   0xc(%ebp)
+  801f0e:	68 04 70 80 00       	push   $0x807004
+  801f13:	e8 40 ee ff ff       	call   800d58 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f18:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801f1e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f23:	e8 32 ff ff ff       	call   801e5a <nsipc>
+}
+  801f28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f2b:	c9                   	leave
+  801f2c:	c3                   	ret
+
+00801f2d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f2d:	55                   	push   %ebp
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f36:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801f3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f3e:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f43:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f48:	e8 0d ff ff ff       	call   801e5a <nsipc>
+}
+  801f4d:	c9                   	leave
+  801f4e:	c3                   	ret
+
+00801f4f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f4f:	55                   	push   %ebp
+  801f50:	89 e5                	mov    %esp,%ebp
+  801f52:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f58:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801f5d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f62:	e8 f3 fe ff ff       	call   801e5a <nsipc>
+}
+  801f67:	c9                   	leave
+  801f68:	c3                   	ret
+
+00801f69 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f69:	55                   	push   %ebp
+  801f6a:	89 e5                	mov    %esp,%ebp
+  801f6c:	53                   	push   %ebx
+  801f6d:	83 ec 08             	sub    $0x8,%esp
+  801f70:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f73:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f76:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f7b:	53                   	push   %ebx
+  801f7c:	ff 75 0c             	push   0xc(%ebp)
+  801f7f:	68 04 70 80 00       	push   $0x807004
+  801f84:	e8 cf ed ff ff       	call   800d58 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f89:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801f8f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f94:	e8 c1 fe ff ff       	call   801e5a <nsipc>
+}
+  801f99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f9c:	c9                   	leave
+  801f9d:	c3                   	ret
+
+00801f9e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f9e:	55                   	push   %ebp
+  801f9f:	89 e5                	mov    %esp,%ebp
+  801fa1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801fa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa7:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801fac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801faf:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801fb4:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fb9:	e8 9c fe ff ff       	call   801e5a <nsipc>
+}
+  801fbe:	c9                   	leave
+  801fbf:	c3                   	ret
+
+00801fc0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fc0:	55                   	push   %ebp
+  801fc1:	89 e5                	mov    %esp,%ebp
+  801fc3:	56                   	push   %esi
+  801fc4:	53                   	push   %ebx
+  801fc5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801fc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fcb:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801fd0:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801fd6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fd9:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801fde:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fe3:	e8 72 fe ff ff       	call   801e5a <nsipc>
+  801fe8:	89 c3                	mov    %eax,%ebx
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	78 22                	js     802010 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fee:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801ff3:	39 c6                	cmp    %eax,%esi
+  801ff5:	0f 4e c6             	cmovle %esi,%eax
+  801ff8:	39 c3                	cmp    %eax,%ebx
+  801ffa:	7f 1d                	jg     802019 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801ffc:	83 ec 04             	sub    $0x4,%esp
+  801fff:	53                   	push   %ebx
+  802000:	68 00 70 80 00       	push   $0x807000
+  802005:	ff 75 0c             	push   0xc(%ebp)
+  802008:	e8 4b ed ff ff       	call   800d58 <memmove>
+  80200d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802010:	89 d8                	mov    %ebx,%eax
+  802012:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802015:	5b                   	pop    %ebx
+  802016:	5e                   	pop    %esi
+  802017:	5d                   	pop    %ebp
+  802018:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802019:	68 5b 30 80 00       	push   $0x80305b
+  80201e:	68 23 30 80 00       	push   $0x803023
+  802023:	6a 62                	push   $0x62
+  802025:	68 70 30 80 00       	push   $0x803070
+  80202a:	e8 46 05 00 00       	call   802575 <_panic>
+
+0080202f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80202f:	55                   	push   %ebp
+  802030:	89 e5                	mov    %esp,%ebp
+  802032:	53                   	push   %ebx
+  802033:	83 ec 04             	sub    $0x4,%esp
+  802036:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802039:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203c:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802041:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802047:	7f 2e                	jg     802077 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802049:	83 ec 04             	sub    $0x4,%esp
+  80204c:	53                   	push   %ebx
+  80204d:	ff 75 0c             	push   0xc(%ebp)
+  802050:	68 0c 70 80 00       	push   $0x80700c
+  802055:	e8 fe ec ff ff       	call   800d58 <memmove>
+	nsipcbuf.send.req_size = size;
+  80205a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802060:	8b 45 14             	mov    0x14(%ebp),%eax
+  802063:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802068:	b8 08 00 00 00       	mov    $0x8,%eax
+  80206d:	e8 e8 fd ff ff       	call   801e5a <nsipc>
+}
+  802072:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+	assert(size < 1600);
+  802077:	68 7c 30 80 00       	push   $0x80307c
+  80207c:	68 23 30 80 00       	push   $0x803023
+  802081:	6a 6d                	push   $0x6d
+  802083:	68 70 30 80 00       	push   $0x803070
+  802088:	e8 e8 04 00 00       	call   802575 <_panic>
+
+0080208d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80208d:	55                   	push   %ebp
+  80208e:	89 e5                	mov    %esp,%ebp
+  802090:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802093:	8b 45 08             	mov    0x8(%ebp),%eax
+  802096:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80209b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80209e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020a3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020a6:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8020ab:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020b0:	e8 a5 fd ff ff       	call   801e5a <nsipc>
+}
+  8020b5:	c9                   	leave
+  8020b6:	c3                   	ret
+
+008020b7 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020b7:	55                   	push   %ebp
+  8020b8:	89 e5                	mov    %esp,%ebp
+  8020ba:	56                   	push   %esi
+  8020bb:	53                   	push   %ebx
+  8020bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8020bf:	83 ec 0c             	sub    $0xc,%esp
+  8020c2:	ff 75 08             	push   0x8(%ebp)
+  8020c5:	e8 aa f3 ff ff       	call   801474 <fd2data>
+  8020ca:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8020cc:	83 c4 08             	add    $0x8,%esp
+  8020cf:	68 88 30 80 00       	push   $0x803088
+  8020d4:	53                   	push   %ebx
+  8020d5:	e8 f8 ea ff ff       	call   800bd2 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8020da:	8b 46 04             	mov    0x4(%esi),%eax
+  8020dd:	2b 06                	sub    (%esi),%eax
+  8020df:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020e5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020ec:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020ef:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8020f6:	40 80 00 
+	return 0;
+}
+  8020f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802101:	5b                   	pop    %ebx
+  802102:	5e                   	pop    %esi
+  802103:	5d                   	pop    %ebp
+  802104:	c3                   	ret
+
+00802105 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802105:	55                   	push   %ebp
+  802106:	89 e5                	mov    %esp,%ebp
+  802108:	53                   	push   %ebx
+  802109:	83 ec 0c             	sub    $0xc,%esp
+  80210c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80210f:	53                   	push   %ebx
+  802110:	6a 00                	push   $0x0
+  802112:	e8 f0 ef ff ff       	call   801107 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802117:	89 1c 24             	mov    %ebx,(%esp)
+  80211a:	e8 55 f3 ff ff       	call   801474 <fd2data>
+  80211f:	83 c4 08             	add    $0x8,%esp
+  802122:	50                   	push   %eax
+  802123:	6a 00                	push   $0x0
+  802125:	e8 dd ef ff ff       	call   801107 <sys_page_unmap>
+}
+  80212a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80212d:	c9                   	leave
+  80212e:	c3                   	ret
+
+0080212f <_pipeisclosed>:
+{
+  80212f:	55                   	push   %ebp
+  802130:	89 e5                	mov    %esp,%ebp
+  802132:	57                   	push   %edi
+  802133:	56                   	push   %esi
+  802134:	53                   	push   %ebx
+  802135:	83 ec 1c             	sub    $0x1c,%esp
+  802138:	89 c7                	mov    %eax,%edi
+  80213a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80213c:	a1 18 50 80 00       	mov    0x805018,%eax
+  802141:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802144:	83 ec 0c             	sub    $0xc,%esp
+  802147:	57                   	push   %edi
+  802148:	e8 4a 05 00 00       	call   802697 <pageref>
+  80214d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802150:	89 34 24             	mov    %esi,(%esp)
+  802153:	e8 3f 05 00 00       	call   802697 <pageref>
+		nn = thisenv->env_runs;
+  802158:	8b 15 18 50 80 00    	mov    0x805018,%edx
+  80215e:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802161:	83 c4 10             	add    $0x10,%esp
+  802164:	39 cb                	cmp    %ecx,%ebx
+  802166:	74 1b                	je     802183 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802168:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80216b:	75 cf                	jne    80213c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80216d:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802170:	6a 01                	push   $0x1
+  802172:	50                   	push   %eax
+  802173:	53                   	push   %ebx
+  802174:	68 8f 30 80 00       	push   $0x80308f
+  802179:	e8 66 e4 ff ff       	call   8005e4 <cprintf>
+  80217e:	83 c4 10             	add    $0x10,%esp
+  802181:	eb b9                	jmp    80213c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802183:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802186:	0f 94 c0             	sete   %al
+  802189:	0f b6 c0             	movzbl %al,%eax
+}
+  80218c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80218f:	5b                   	pop    %ebx
+  802190:	5e                   	pop    %esi
+  802191:	5f                   	pop    %edi
+  802192:	5d                   	pop    %ebp
+  802193:	c3                   	ret
+
+00802194 <devpipe_write>:
+{
+  802194:	55                   	push   %ebp
+  802195:	89 e5                	mov    %esp,%ebp
+  802197:	57                   	push   %edi
+  802198:	56                   	push   %esi
+  802199:	53                   	push   %ebx
+  80219a:	83 ec 28             	sub    $0x28,%esp
+  80219d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8021a0:	56                   	push   %esi
+  8021a1:	e8 ce f2 ff ff       	call   801474 <fd2data>
+  8021a6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b0:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8021b3:	75 09                	jne    8021be <devpipe_write+0x2a>
+	return i;
+  8021b5:	89 f8                	mov    %edi,%eax
+  8021b7:	eb 23                	jmp    8021dc <devpipe_write+0x48>
+			sys_yield();
+  8021b9:	e8 01 ee ff ff       	call   800fbf <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8021be:	8b 43 04             	mov    0x4(%ebx),%eax
+  8021c1:	8b 0b                	mov    (%ebx),%ecx
+  8021c3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8021c6:	39 d0                	cmp    %edx,%eax
+  8021c8:	72 1a                	jb     8021e4 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8021ca:	89 da                	mov    %ebx,%edx
+  8021cc:	89 f0                	mov    %esi,%eax
+  8021ce:	e8 5c ff ff ff       	call   80212f <_pipeisclosed>
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	74 e2                	je     8021b9 <devpipe_write+0x25>
+				return 0;
+  8021d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021df:	5b                   	pop    %ebx
+  8021e0:	5e                   	pop    %esi
+  8021e1:	5f                   	pop    %edi
+  8021e2:	5d                   	pop    %ebp
+  8021e3:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021e7:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021eb:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021ee:	89 c2                	mov    %eax,%edx
+  8021f0:	c1 fa 1f             	sar    $0x1f,%edx
+  8021f3:	89 d1                	mov    %edx,%ecx
+  8021f5:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021f8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021fb:	83 e2 1f             	and    $0x1f,%edx
+  8021fe:	29 ca                	sub    %ecx,%edx
+  802200:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802204:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802208:	83 c0 01             	add    $0x1,%eax
+  80220b:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80220e:	83 c7 01             	add    $0x1,%edi
+  802211:	eb 9d                	jmp    8021b0 <devpipe_write+0x1c>
+
+00802213 <devpipe_read>:
+{
+  802213:	55                   	push   %ebp
+  802214:	89 e5                	mov    %esp,%ebp
+  802216:	57                   	push   %edi
+  802217:	56                   	push   %esi
+  802218:	53                   	push   %ebx
+  802219:	83 ec 18             	sub    $0x18,%esp
+  80221c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80221f:	57                   	push   %edi
+  802220:	e8 4f f2 ff ff       	call   801474 <fd2data>
+  802225:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802227:	83 c4 10             	add    $0x10,%esp
+  80222a:	be 00 00 00 00       	mov    $0x0,%esi
+  80222f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802232:	75 13                	jne    802247 <devpipe_read+0x34>
+	return i;
+  802234:	89 f0                	mov    %esi,%eax
+  802236:	eb 02                	jmp    80223a <devpipe_read+0x27>
+				return i;
+  802238:	89 f0                	mov    %esi,%eax
+}
+  80223a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80223d:	5b                   	pop    %ebx
+  80223e:	5e                   	pop    %esi
+  80223f:	5f                   	pop    %edi
+  802240:	5d                   	pop    %ebp
+  802241:	c3                   	ret
+			sys_yield();
+  802242:	e8 78 ed ff ff       	call   800fbf <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802247:	8b 03                	mov    (%ebx),%eax
+  802249:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80224c:	75 18                	jne    802266 <devpipe_read+0x53>
+			if (i > 0)
+  80224e:	85 f6                	test   %esi,%esi
+  802250:	75 e6                	jne    802238 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802252:	89 da                	mov    %ebx,%edx
+  802254:	89 f8                	mov    %edi,%eax
+  802256:	e8 d4 fe ff ff       	call   80212f <_pipeisclosed>
+  80225b:	85 c0                	test   %eax,%eax
+  80225d:	74 e3                	je     802242 <devpipe_read+0x2f>
+				return 0;
+  80225f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802264:	eb d4                	jmp    80223a <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802266:	99                   	cltd
+  802267:	c1 ea 1b             	shr    $0x1b,%edx
+  80226a:	01 d0                	add    %edx,%eax
+  80226c:	83 e0 1f             	and    $0x1f,%eax
+  80226f:	29 d0                	sub    %edx,%eax
+  802271:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802276:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802279:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80227c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80227f:	83 c6 01             	add    $0x1,%esi
+  802282:	eb ab                	jmp    80222f <devpipe_read+0x1c>
+
+00802284 <pipe>:
+{
+  802284:	55                   	push   %ebp
+  802285:	89 e5                	mov    %esp,%ebp
+  802287:	56                   	push   %esi
+  802288:	53                   	push   %ebx
+  802289:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80228c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80228f:	50                   	push   %eax
+  802290:	e8 f6 f1 ff ff       	call   80148b <fd_alloc>
+  802295:	89 c3                	mov    %eax,%ebx
+  802297:	83 c4 10             	add    $0x10,%esp
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	0f 88 23 01 00 00    	js     8023c5 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022a2:	83 ec 04             	sub    $0x4,%esp
+  8022a5:	68 07 04 00 00       	push   $0x407
+  8022aa:	ff 75 f4             	push   -0xc(%ebp)
+  8022ad:	6a 00                	push   $0x0
+  8022af:	e8 8b ed ff ff       	call   80103f <sys_page_alloc>
+  8022b4:	89 c3                	mov    %eax,%ebx
+  8022b6:	83 c4 10             	add    $0x10,%esp
+  8022b9:	85 c0                	test   %eax,%eax
+  8022bb:	0f 88 04 01 00 00    	js     8023c5 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8022c1:	83 ec 0c             	sub    $0xc,%esp
+  8022c4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022c7:	50                   	push   %eax
+  8022c8:	e8 be f1 ff ff       	call   80148b <fd_alloc>
+  8022cd:	89 c3                	mov    %eax,%ebx
+  8022cf:	83 c4 10             	add    $0x10,%esp
+  8022d2:	85 c0                	test   %eax,%eax
+  8022d4:	0f 88 db 00 00 00    	js     8023b5 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022da:	83 ec 04             	sub    $0x4,%esp
+  8022dd:	68 07 04 00 00       	push   $0x407
+  8022e2:	ff 75 f0             	push   -0x10(%ebp)
+  8022e5:	6a 00                	push   $0x0
+  8022e7:	e8 53 ed ff ff       	call   80103f <sys_page_alloc>
+  8022ec:	89 c3                	mov    %eax,%ebx
+  8022ee:	83 c4 10             	add    $0x10,%esp
+  8022f1:	85 c0                	test   %eax,%eax
+  8022f3:	0f 88 bc 00 00 00    	js     8023b5 <pipe+0x131>
+	va = fd2data(fd0);
+  8022f9:	83 ec 0c             	sub    $0xc,%esp
+  8022fc:	ff 75 f4             	push   -0xc(%ebp)
+  8022ff:	e8 70 f1 ff ff       	call   801474 <fd2data>
+  802304:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802306:	83 c4 0c             	add    $0xc,%esp
+  802309:	68 07 04 00 00       	push   $0x407
+  80230e:	50                   	push   %eax
+  80230f:	6a 00                	push   $0x0
+  802311:	e8 29 ed ff ff       	call   80103f <sys_page_alloc>
+  802316:	89 c3                	mov    %eax,%ebx
+  802318:	83 c4 10             	add    $0x10,%esp
+  80231b:	85 c0                	test   %eax,%eax
+  80231d:	0f 88 82 00 00 00    	js     8023a5 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802323:	83 ec 0c             	sub    $0xc,%esp
+  802326:	ff 75 f0             	push   -0x10(%ebp)
+  802329:	e8 46 f1 ff ff       	call   801474 <fd2data>
+  80232e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802335:	50                   	push   %eax
+  802336:	6a 00                	push   $0x0
+  802338:	56                   	push   %esi
+  802339:	6a 00                	push   $0x0
+  80233b:	e8 85 ed ff ff       	call   8010c5 <sys_page_map>
+  802340:	89 c3                	mov    %eax,%ebx
+  802342:	83 c4 20             	add    $0x20,%esp
+  802345:	85 c0                	test   %eax,%eax
+  802347:	78 4e                	js     802397 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802349:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80234e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802351:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802353:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802356:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80235d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802360:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802362:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802365:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80236c:	83 ec 0c             	sub    $0xc,%esp
+  80236f:	ff 75 f4             	push   -0xc(%ebp)
+  802372:	e8 ed f0 ff ff       	call   801464 <fd2num>
+  802377:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80237a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80237c:	83 c4 04             	add    $0x4,%esp
+  80237f:	ff 75 f0             	push   -0x10(%ebp)
+  802382:	e8 dd f0 ff ff       	call   801464 <fd2num>
+  802387:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80238a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80238d:	83 c4 10             	add    $0x10,%esp
+  802390:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802395:	eb 2e                	jmp    8023c5 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802397:	83 ec 08             	sub    $0x8,%esp
+  80239a:	56                   	push   %esi
+  80239b:	6a 00                	push   $0x0
+  80239d:	e8 65 ed ff ff       	call   801107 <sys_page_unmap>
+  8023a2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8023a5:	83 ec 08             	sub    $0x8,%esp
+  8023a8:	ff 75 f0             	push   -0x10(%ebp)
+  8023ab:	6a 00                	push   $0x0
+  8023ad:	e8 55 ed ff ff       	call   801107 <sys_page_unmap>
+  8023b2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8023b5:	83 ec 08             	sub    $0x8,%esp
+  8023b8:	ff 75 f4             	push   -0xc(%ebp)
+  8023bb:	6a 00                	push   $0x0
+  8023bd:	e8 45 ed ff ff       	call   801107 <sys_page_unmap>
+  8023c2:	83 c4 10             	add    $0x10,%esp
+}
+  8023c5:	89 d8                	mov    %ebx,%eax
+  8023c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ca:	5b                   	pop    %ebx
+  8023cb:	5e                   	pop    %esi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+
+008023ce <pipeisclosed>:
+{
+  8023ce:	55                   	push   %ebp
+  8023cf:	89 e5                	mov    %esp,%ebp
+  8023d1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023d7:	50                   	push   %eax
+  8023d8:	ff 75 08             	push   0x8(%ebp)
+  8023db:	e8 01 f1 ff ff       	call   8014e1 <fd_lookup>
+  8023e0:	83 c4 10             	add    $0x10,%esp
+  8023e3:	85 c0                	test   %eax,%eax
+  8023e5:	78 18                	js     8023ff <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023e7:	83 ec 0c             	sub    $0xc,%esp
+  8023ea:	ff 75 f4             	push   -0xc(%ebp)
+  8023ed:	e8 82 f0 ff ff       	call   801474 <fd2data>
+  8023f2:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023f7:	e8 33 fd ff ff       	call   80212f <_pipeisclosed>
+  8023fc:	83 c4 10             	add    $0x10,%esp
+}
+  8023ff:	c9                   	leave
+  802400:	c3                   	ret
+
+00802401 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802401:	b8 00 00 00 00       	mov    $0x0,%eax
+  802406:	c3                   	ret
+
+00802407 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802407:	55                   	push   %ebp
+  802408:	89 e5                	mov    %esp,%ebp
+  80240a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80240d:	68 a7 30 80 00       	push   $0x8030a7
+  802412:	ff 75 0c             	push   0xc(%ebp)
+  802415:	e8 b8 e7 ff ff       	call   800bd2 <strcpy>
+	return 0;
+}
+  80241a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241f:	c9                   	leave
+  802420:	c3                   	ret
+
+00802421 <devcons_write>:
+{
+  802421:	55                   	push   %ebp
+  802422:	89 e5                	mov    %esp,%ebp
+  802424:	57                   	push   %edi
+  802425:	56                   	push   %esi
+  802426:	53                   	push   %ebx
+  802427:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80242d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802432:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802438:	eb 2e                	jmp    802468 <devcons_write+0x47>
+		m = n - tot;
+  80243a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80243d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80243f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802444:	39 c3                	cmp    %eax,%ebx
+  802446:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802449:	83 ec 04             	sub    $0x4,%esp
+  80244c:	53                   	push   %ebx
+  80244d:	89 f0                	mov    %esi,%eax
+  80244f:	03 45 0c             	add    0xc(%ebp),%eax
+  802452:	50                   	push   %eax
+  802453:	57                   	push   %edi
+  802454:	e8 ff e8 ff ff       	call   800d58 <memmove>
+		sys_cputs(buf, m);
+  802459:	83 c4 08             	add    $0x8,%esp
+  80245c:	53                   	push   %ebx
+  80245d:	57                   	push   %edi
+  80245e:	e8 9f ea ff ff       	call   800f02 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802463:	01 de                	add    %ebx,%esi
+  802465:	83 c4 10             	add    $0x10,%esp
+  802468:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80246b:	72 cd                	jb     80243a <devcons_write+0x19>
+}
+  80246d:	89 f0                	mov    %esi,%eax
+  80246f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802472:	5b                   	pop    %ebx
+  802473:	5e                   	pop    %esi
+  802474:	5f                   	pop    %edi
+  802475:	5d                   	pop    %ebp
+  802476:	c3                   	ret
+
+00802477 <devcons_read>:
+{
+  802477:	55                   	push   %ebp
+  802478:	89 e5                	mov    %esp,%ebp
+  80247a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80247d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802482:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802486:	75 07                	jne    80248f <devcons_read+0x18>
+  802488:	eb 1f                	jmp    8024a9 <devcons_read+0x32>
+		sys_yield();
+  80248a:	e8 30 eb ff ff       	call   800fbf <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80248f:	e8 8c ea ff ff       	call   800f20 <sys_cgetc>
+  802494:	85 c0                	test   %eax,%eax
+  802496:	74 f2                	je     80248a <devcons_read+0x13>
+	if (c < 0)
+  802498:	78 0f                	js     8024a9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80249a:	83 f8 04             	cmp    $0x4,%eax
+  80249d:	74 0c                	je     8024ab <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80249f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024a2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8024a4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8024a9:	c9                   	leave
+  8024aa:	c3                   	ret
+		return 0;
+  8024ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b0:	eb f7                	jmp    8024a9 <devcons_read+0x32>
+
+008024b2 <cputchar>:
+{
+  8024b2:	55                   	push   %ebp
+  8024b3:	89 e5                	mov    %esp,%ebp
+  8024b5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8024b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024bb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8024be:	6a 01                	push   $0x1
+  8024c0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024c3:	50                   	push   %eax
+  8024c4:	e8 39 ea ff ff       	call   800f02 <sys_cputs>
+}
+  8024c9:	83 c4 10             	add    $0x10,%esp
+  8024cc:	c9                   	leave
+  8024cd:	c3                   	ret
+
+008024ce <getchar>:
+{
+  8024ce:	55                   	push   %ebp
+  8024cf:	89 e5                	mov    %esp,%ebp
+  8024d1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8024d4:	6a 01                	push   $0x1
+  8024d6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024d9:	50                   	push   %eax
+  8024da:	6a 00                	push   $0x0
+  8024dc:	e8 66 f2 ff ff       	call   801747 <read>
+	if (r < 0)
+  8024e1:	83 c4 10             	add    $0x10,%esp
+  8024e4:	85 c0                	test   %eax,%eax
+  8024e6:	78 06                	js     8024ee <getchar+0x20>
+	if (r < 1)
+  8024e8:	74 06                	je     8024f0 <getchar+0x22>
+	return c;
+  8024ea:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024ee:	c9                   	leave
+  8024ef:	c3                   	ret
+		return -E_EOF;
+  8024f0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024f5:	eb f7                	jmp    8024ee <getchar+0x20>
+
+008024f7 <iscons>:
+{
+  8024f7:	55                   	push   %ebp
+  8024f8:	89 e5                	mov    %esp,%ebp
+  8024fa:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802500:	50                   	push   %eax
+  802501:	ff 75 08             	push   0x8(%ebp)
+  802504:	e8 d8 ef ff ff       	call   8014e1 <fd_lookup>
+  802509:	83 c4 10             	add    $0x10,%esp
+  80250c:	85 c0                	test   %eax,%eax
+  80250e:	78 11                	js     802521 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802510:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802513:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802519:	39 10                	cmp    %edx,(%eax)
+  80251b:	0f 94 c0             	sete   %al
+  80251e:	0f b6 c0             	movzbl %al,%eax
+}
+  802521:	c9                   	leave
+  802522:	c3                   	ret
+
+00802523 <opencons>:
+{
+  802523:	55                   	push   %ebp
+  802524:	89 e5                	mov    %esp,%ebp
+  802526:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802529:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80252c:	50                   	push   %eax
+  80252d:	e8 59 ef ff ff       	call   80148b <fd_alloc>
+  802532:	83 c4 10             	add    $0x10,%esp
+  802535:	85 c0                	test   %eax,%eax
+  802537:	78 3a                	js     802573 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802539:	83 ec 04             	sub    $0x4,%esp
+  80253c:	68 07 04 00 00       	push   $0x407
+  802541:	ff 75 f4             	push   -0xc(%ebp)
+  802544:	6a 00                	push   $0x0
+  802546:	e8 f4 ea ff ff       	call   80103f <sys_page_alloc>
+  80254b:	83 c4 10             	add    $0x10,%esp
+  80254e:	85 c0                	test   %eax,%eax
+  802550:	78 21                	js     802573 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802552:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802555:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80255b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80255d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802560:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802567:	83 ec 0c             	sub    $0xc,%esp
+  80256a:	50                   	push   %eax
+  80256b:	e8 f4 ee ff ff       	call   801464 <fd2num>
+  802570:	83 c4 10             	add    $0x10,%esp
+}
+  802573:	c9                   	leave
+  802574:	c3                   	ret
+
+00802575 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802575:	55                   	push   %ebp
+  802576:	89 e5                	mov    %esp,%ebp
+  802578:	56                   	push   %esi
+  802579:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80257a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80257d:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802583:	e8 18 ea ff ff       	call   800fa0 <sys_getenvid>
+  802588:	83 ec 0c             	sub    $0xc,%esp
+  80258b:	ff 75 0c             	push   0xc(%ebp)
+  80258e:	ff 75 08             	push   0x8(%ebp)
+  802591:	56                   	push   %esi
+  802592:	50                   	push   %eax
+  802593:	68 b4 30 80 00       	push   $0x8030b4
+  802598:	e8 47 e0 ff ff       	call   8005e4 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80259d:	83 c4 18             	add    $0x18,%esp
+  8025a0:	53                   	push   %ebx
+  8025a1:	ff 75 10             	push   0x10(%ebp)
+  8025a4:	e8 ea df ff ff       	call   800593 <vcprintf>
+	cprintf("\n");
+  8025a9:	c7 04 24 a0 30 80 00 	movl   $0x8030a0,(%esp)
+  8025b0:	e8 2f e0 ff ff       	call   8005e4 <cprintf>
+  8025b5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8025b8:	cc                   	int3
+	while (1)
+  8025b9:	eb fd                	jmp    8025b8 <_panic+0x43>
+
+008025bb <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8025bb:	55                   	push   %ebp
+  8025bc:	89 e5                	mov    %esp,%ebp
+  8025be:	57                   	push   %edi
+  8025bf:	56                   	push   %esi
+  8025c0:	53                   	push   %ebx
+  8025c1:	83 ec 18             	sub    $0x18,%esp
+  8025c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025ca:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8025cd:	85 db                	test   %ebx,%ebx
+  8025cf:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8025d4:	0f 45 c3             	cmovne %ebx,%eax
+  8025d7:	50                   	push   %eax
+  8025d8:	e8 e5 ed ff ff       	call   8013c2 <sys_ipc_recv>
+
+	if (from_env_store)
+  8025dd:	83 c4 10             	add    $0x10,%esp
+  8025e0:	85 ff                	test   %edi,%edi
+  8025e2:	74 17                	je     8025fb <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8025e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e9:	85 c0                	test   %eax,%eax
+  8025eb:	75 0c                	jne    8025f9 <ipc_recv+0x3e>
+  8025ed:	8b 15 18 50 80 00    	mov    0x805018,%edx
+  8025f3:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8025f9:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8025fb:	85 f6                	test   %esi,%esi
+  8025fd:	74 2e                	je     80262d <ipc_recv+0x72>
+		if (!r && pg)
+  8025ff:	85 c0                	test   %eax,%eax
+  802601:	75 24                	jne    802627 <ipc_recv+0x6c>
+  802603:	85 db                	test   %ebx,%ebx
+  802605:	74 20                	je     802627 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802607:	a1 18 50 80 00       	mov    0x805018,%eax
+  80260c:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802612:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802614:	a1 18 50 80 00       	mov    0x805018,%eax
+  802619:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80261f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802622:	5b                   	pop    %ebx
+  802623:	5e                   	pop    %esi
+  802624:	5f                   	pop    %edi
+  802625:	5d                   	pop    %ebp
+  802626:	c3                   	ret
+			*perm_store = 0;
+  802627:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80262d:	85 c0                	test   %eax,%eax
+  80262f:	75 ee                	jne    80261f <ipc_recv+0x64>
+  802631:	eb e1                	jmp    802614 <ipc_recv+0x59>
+
+00802633 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802633:	55                   	push   %ebp
+  802634:	89 e5                	mov    %esp,%ebp
+  802636:	57                   	push   %edi
+  802637:	56                   	push   %esi
+  802638:	53                   	push   %ebx
+  802639:	83 ec 0c             	sub    $0xc,%esp
+  80263c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80263f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802642:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802645:	85 db                	test   %ebx,%ebx
+  802647:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80264c:	0f 44 d8             	cmove  %eax,%ebx
+  80264f:	ff 75 14             	push   0x14(%ebp)
+  802652:	53                   	push   %ebx
+  802653:	56                   	push   %esi
+  802654:	57                   	push   %edi
+  802655:	e8 45 ed ff ff       	call   80139f <sys_ipc_try_send_yield>
+  80265a:	83 c4 10             	add    $0x10,%esp
+  80265d:	85 c0                	test   %eax,%eax
+  80265f:	79 1e                	jns    80267f <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802661:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802664:	75 07                	jne    80266d <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802666:	e8 54 e9 ff ff       	call   800fbf <sys_yield>
+  80266b:	eb e2                	jmp    80264f <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  80266d:	50                   	push   %eax
+  80266e:	68 d7 30 80 00       	push   $0x8030d7
+  802673:	6a 3d                	push   $0x3d
+  802675:	68 ec 30 80 00       	push   $0x8030ec
+  80267a:	e8 f6 fe ff ff       	call   802575 <_panic>
+	}
+}
+  80267f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802682:	5b                   	pop    %ebx
+  802683:	5e                   	pop    %esi
+  802684:	5f                   	pop    %edi
+  802685:	5d                   	pop    %ebp
+  802686:	c3                   	ret
+
+00802687 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802687:	55                   	push   %ebp
+  802688:	89 e5                	mov    %esp,%ebp
+  80268a:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  80268d:	ff 75 08             	push   0x8(%ebp)
+  802690:	e8 aa e8 ff ff       	call   800f3f <sys_env_find>
+}
+  802695:	c9                   	leave
+  802696:	c3                   	ret
+
+00802697 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802697:	55                   	push   %ebp
+  802698:	89 e5                	mov    %esp,%ebp
+  80269a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80269d:	89 c2                	mov    %eax,%edx
+  80269f:	c1 ea 16             	shr    $0x16,%edx
+  8026a2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8026a9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8026ae:	f6 c1 01             	test   $0x1,%cl
+  8026b1:	74 22                	je     8026d5 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8026b3:	c1 e8 0c             	shr    $0xc,%eax
+  8026b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8026bd:	a8 01                	test   $0x1,%al
+  8026bf:	74 14                	je     8026d5 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8026c1:	c1 e8 0c             	shr    $0xc,%eax
+  8026c4:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026c7:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8026ce:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8026d2:	0f b7 d2             	movzwl %dx,%edx
+}
+  8026d5:	89 d0                	mov    %edx,%eax
+  8026d7:	5d                   	pop    %ebp
+  8026d8:	c3                   	ret
+  8026d9:	66 90                	xchg   %ax,%ax
+  8026db:	66 90                	xchg   %ax,%ax
+  8026dd:	66 90                	xchg   %ax,%ax
+  8026df:	90                   	nop
+
+008026e0 <__udivmoddi4>:
+  8026e0:	55                   	push   %ebp
+  8026e1:	57                   	push   %edi
+  8026e2:	56                   	push   %esi
+  8026e3:	53                   	push   %ebx
+  8026e4:	83 ec 14             	sub    $0x14,%esp
+  8026e7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8026eb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8026ef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026f3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026f7:	89 f1                	mov    %esi,%ecx
+  8026f9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8026fd:	09 d9                	or     %ebx,%ecx
+  8026ff:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802703:	0f 84 92 00 00 00    	je     80279b <__udivmoddi4+0xbb>
+  802709:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802710:	00 
+  802711:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802716:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80271d:	00 
+  80271e:	89 1c 24             	mov    %ebx,(%esp)
+  802721:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802725:	8d 76 00             	lea    0x0(%esi),%esi
+  802728:	89 e9                	mov    %ebp,%ecx
+  80272a:	89 c3                	mov    %eax,%ebx
+  80272c:	89 d6                	mov    %edx,%esi
+  80272e:	31 ff                	xor    %edi,%edi
+  802730:	d3 ee                	shr    %cl,%esi
+  802732:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802735:	f6 c1 20             	test   $0x20,%cl
+  802738:	0f 45 de             	cmovne %esi,%ebx
+  80273b:	0f 45 f7             	cmovne %edi,%esi
+  80273e:	8b 3c 24             	mov    (%esp),%edi
+  802741:	39 fb                	cmp    %edi,%ebx
+  802743:	89 f7                	mov    %esi,%edi
+  802745:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802749:	8b 1c 24             	mov    (%esp),%ebx
+  80274c:	19 f7                	sbb    %esi,%edi
+  80274e:	72 39                	jb     802789 <__udivmoddi4+0xa9>
+  802750:	89 e9                	mov    %ebp,%ecx
+  802752:	89 f7                	mov    %esi,%edi
+  802754:	89 de                	mov    %ebx,%esi
+  802756:	0f a5 df             	shld   %cl,%ebx,%edi
+  802759:	d3 e6                	shl    %cl,%esi
+  80275b:	31 db                	xor    %ebx,%ebx
+  80275d:	f6 c1 20             	test   $0x20,%cl
+  802760:	0f 45 fe             	cmovne %esi,%edi
+  802763:	0f 45 f3             	cmovne %ebx,%esi
+  802766:	29 f0                	sub    %esi,%eax
+  802768:	be 01 00 00 00       	mov    $0x1,%esi
+  80276d:	19 fa                	sbb    %edi,%edx
+  80276f:	31 ff                	xor    %edi,%edi
+  802771:	31 db                	xor    %ebx,%ebx
+  802773:	0f a5 f7             	shld   %cl,%esi,%edi
+  802776:	d3 e6                	shl    %cl,%esi
+  802778:	f6 c1 20             	test   $0x20,%cl
+  80277b:	0f 45 fe             	cmovne %esi,%edi
+  80277e:	0f 45 f3             	cmovne %ebx,%esi
+  802781:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802785:	09 74 24 08          	or     %esi,0x8(%esp)
+  802789:	83 ed 01             	sub    $0x1,%ebp
+  80278c:	73 9a                	jae    802728 <__udivmoddi4+0x48>
+  80278e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802792:	85 ff                	test   %edi,%edi
+  802794:	74 05                	je     80279b <__udivmoddi4+0xbb>
+  802796:	89 07                	mov    %eax,(%edi)
+  802798:	89 57 04             	mov    %edx,0x4(%edi)
+  80279b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80279f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027a3:	83 c4 14             	add    $0x14,%esp
+  8027a6:	5b                   	pop    %ebx
+  8027a7:	5e                   	pop    %esi
+  8027a8:	5f                   	pop    %edi
+  8027a9:	5d                   	pop    %ebp
+  8027aa:	c3                   	ret
+  8027ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8027af:	90                   	nop
+
+008027b0 <__udivdi3>:
+  8027b0:	55                   	push   %ebp
+  8027b1:	57                   	push   %edi
+  8027b2:	56                   	push   %esi
+  8027b3:	53                   	push   %ebx
+  8027b4:	83 ec 14             	sub    $0x14,%esp
+  8027b7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8027bb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8027bf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027c3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027c7:	89 fb                	mov    %edi,%ebx
+  8027c9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8027cd:	09 f3                	or     %esi,%ebx
+  8027cf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8027d3:	0f 84 85 00 00 00    	je     80285e <__udivdi3+0xae>
+  8027d9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027e0:	00 
+  8027e1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8027e6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027ed:	00 
+  8027ee:	89 34 24             	mov    %esi,(%esp)
+  8027f1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8027f5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027f8:	89 e9                	mov    %ebp,%ecx
+  8027fa:	89 c3                	mov    %eax,%ebx
+  8027fc:	89 d6                	mov    %edx,%esi
+  8027fe:	31 ff                	xor    %edi,%edi
+  802800:	d3 ee                	shr    %cl,%esi
+  802802:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802805:	f6 c1 20             	test   $0x20,%cl
+  802808:	0f 45 de             	cmovne %esi,%ebx
+  80280b:	0f 45 f7             	cmovne %edi,%esi
+  80280e:	8b 3c 24             	mov    (%esp),%edi
+  802811:	39 fb                	cmp    %edi,%ebx
+  802813:	89 f7                	mov    %esi,%edi
+  802815:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802819:	8b 1c 24             	mov    (%esp),%ebx
+  80281c:	19 f7                	sbb    %esi,%edi
+  80281e:	72 39                	jb     802859 <__udivdi3+0xa9>
+  802820:	89 e9                	mov    %ebp,%ecx
+  802822:	89 f7                	mov    %esi,%edi
+  802824:	89 de                	mov    %ebx,%esi
+  802826:	0f a5 df             	shld   %cl,%ebx,%edi
+  802829:	d3 e6                	shl    %cl,%esi
+  80282b:	31 db                	xor    %ebx,%ebx
+  80282d:	f6 c1 20             	test   $0x20,%cl
+  802830:	0f 45 fe             	cmovne %esi,%edi
+  802833:	0f 45 f3             	cmovne %ebx,%esi
+  802836:	29 f0                	sub    %esi,%eax
+  802838:	be 01 00 00 00       	mov    $0x1,%esi
+  80283d:	19 fa                	sbb    %edi,%edx
+  80283f:	31 ff                	xor    %edi,%edi
+  802841:	31 db                	xor    %ebx,%ebx
+  802843:	0f a5 f7             	shld   %cl,%esi,%edi
+  802846:	d3 e6                	shl    %cl,%esi
+  802848:	f6 c1 20             	test   $0x20,%cl
+  80284b:	0f 45 fe             	cmovne %esi,%edi
+  80284e:	0f 45 f3             	cmovne %ebx,%esi
+  802851:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802855:	09 74 24 08          	or     %esi,0x8(%esp)
+  802859:	83 ed 01             	sub    $0x1,%ebp
+  80285c:	73 9a                	jae    8027f8 <__udivdi3+0x48>
+  80285e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802862:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802866:	83 c4 14             	add    $0x14,%esp
+  802869:	5b                   	pop    %ebx
+  80286a:	5e                   	pop    %esi
+  80286b:	5f                   	pop    %edi
+  80286c:	5d                   	pop    %ebp
+  80286d:	c3                   	ret
+  80286e:	66 90                	xchg   %ax,%ax
+
+00802870 <__umoddi3>:
+  802870:	57                   	push   %edi
+  802871:	56                   	push   %esi
+  802872:	53                   	push   %ebx
+  802873:	83 ec 08             	sub    $0x8,%esp
+  802876:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80287a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80287e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802882:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802886:	89 f9                	mov    %edi,%ecx
+  802888:	89 34 24             	mov    %esi,(%esp)
+  80288b:	09 f1                	or     %esi,%ecx
+  80288d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802891:	74 53                	je     8028e6 <__umoddi3+0x76>
+  802893:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80289f:	90                   	nop
+  8028a0:	89 c6                	mov    %eax,%esi
+  8028a2:	89 d7                	mov    %edx,%edi
+  8028a4:	31 db                	xor    %ebx,%ebx
+  8028a6:	d3 ef                	shr    %cl,%edi
+  8028a8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8028ab:	f6 c1 20             	test   $0x20,%cl
+  8028ae:	0f 45 f7             	cmovne %edi,%esi
+  8028b1:	0f 45 fb             	cmovne %ebx,%edi
+  8028b4:	8b 1c 24             	mov    (%esp),%ebx
+  8028b7:	39 de                	cmp    %ebx,%esi
+  8028b9:	89 fb                	mov    %edi,%ebx
+  8028bb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8028bf:	8b 34 24             	mov    (%esp),%esi
+  8028c2:	19 fb                	sbb    %edi,%ebx
+  8028c4:	72 14                	jb     8028da <__umoddi3+0x6a>
+  8028c6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8028c9:	31 db                	xor    %ebx,%ebx
+  8028cb:	d3 e6                	shl    %cl,%esi
+  8028cd:	f6 c1 20             	test   $0x20,%cl
+  8028d0:	0f 45 fe             	cmovne %esi,%edi
+  8028d3:	0f 45 f3             	cmovne %ebx,%esi
+  8028d6:	29 f0                	sub    %esi,%eax
+  8028d8:	19 fa                	sbb    %edi,%edx
+  8028da:	83 e9 01             	sub    $0x1,%ecx
+  8028dd:	73 c1                	jae    8028a0 <__umoddi3+0x30>
+  8028df:	83 c4 08             	add    $0x8,%esp
+  8028e2:	5b                   	pop    %ebx
+  8028e3:	5e                   	pop    %esi
+  8028e4:	5f                   	pop    %edi
+  8028e5:	c3                   	ret
+  8028e6:	83 c4 08             	add    $0x8,%esp
+  8028e9:	31 c0                	xor    %eax,%eax
+  8028eb:	31 d2                	xor    %edx,%edx
+  8028ed:	5b                   	pop    %ebx
+  8028ee:	5e                   	pop    %esi
+  8028ef:	5f                   	pop    %edi
+  8028f0:	c3                   	ret
+  8028f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028ff:	90                   	nop
+
+00802900 <__divdi3>:
+  802900:	55                   	push   %ebp
+  802901:	57                   	push   %edi
+  802902:	56                   	push   %esi
+  802903:	53                   	push   %ebx
+  802904:	83 ec 1c             	sub    $0x1c,%esp
+  802907:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80290b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80290f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802913:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802917:	85 ff                	test   %edi,%edi
+  802919:	0f 88 da 00 00 00    	js     8029f9 <__divdi3+0xf9>
+  80291f:	85 db                	test   %ebx,%ebx
+  802921:	78 16                	js     802939 <__divdi3+0x39>
+  802923:	89 dd                	mov    %ebx,%ebp
+  802925:	89 c8                	mov    %ecx,%eax
+  802927:	89 da                	mov    %ebx,%edx
+  802929:	09 cd                	or     %ecx,%ebp
+  80292b:	0f 85 fd 00 00 00    	jne    802a2e <__divdi3+0x12e>
+  802931:	83 c4 1c             	add    $0x1c,%esp
+  802934:	5b                   	pop    %ebx
+  802935:	5e                   	pop    %esi
+  802936:	5f                   	pop    %edi
+  802937:	5d                   	pop    %ebp
+  802938:	c3                   	ret
+  802939:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80293e:	f7 d9                	neg    %ecx
+  802940:	89 f0                	mov    %esi,%eax
+  802942:	89 fa                	mov    %edi,%edx
+  802944:	83 d3 00             	adc    $0x0,%ebx
+  802947:	89 0c 24             	mov    %ecx,(%esp)
+  80294a:	f7 db                	neg    %ebx
+  80294c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802950:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802957:	00 
+  802958:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80295d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802964:	00 
+  802965:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802969:	89 cd                	mov    %ecx,%ebp
+  80296b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80296f:	90                   	nop
+  802970:	89 e9                	mov    %ebp,%ecx
+  802972:	89 c3                	mov    %eax,%ebx
+  802974:	89 d6                	mov    %edx,%esi
+  802976:	31 ff                	xor    %edi,%edi
+  802978:	d3 ee                	shr    %cl,%esi
+  80297a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80297d:	f6 c1 20             	test   $0x20,%cl
+  802980:	0f 45 de             	cmovne %esi,%ebx
+  802983:	0f 45 f7             	cmovne %edi,%esi
+  802986:	8b 3c 24             	mov    (%esp),%edi
+  802989:	39 fb                	cmp    %edi,%ebx
+  80298b:	89 f7                	mov    %esi,%edi
+  80298d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802991:	8b 1c 24             	mov    (%esp),%ebx
+  802994:	19 f7                	sbb    %esi,%edi
+  802996:	72 39                	jb     8029d1 <__divdi3+0xd1>
+  802998:	89 e9                	mov    %ebp,%ecx
+  80299a:	89 f7                	mov    %esi,%edi
+  80299c:	89 de                	mov    %ebx,%esi
+  80299e:	0f a5 df             	shld   %cl,%ebx,%edi
+  8029a1:	d3 e6                	shl    %cl,%esi
+  8029a3:	31 db                	xor    %ebx,%ebx
+  8029a5:	f6 c1 20             	test   $0x20,%cl
+  8029a8:	0f 45 fe             	cmovne %esi,%edi
+  8029ab:	0f 45 f3             	cmovne %ebx,%esi
+  8029ae:	29 f0                	sub    %esi,%eax
+  8029b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8029b5:	19 fa                	sbb    %edi,%edx
+  8029b7:	31 ff                	xor    %edi,%edi
+  8029b9:	31 db                	xor    %ebx,%ebx
+  8029bb:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029be:	d3 e6                	shl    %cl,%esi
+  8029c0:	f6 c1 20             	test   $0x20,%cl
+  8029c3:	0f 45 fe             	cmovne %esi,%edi
+  8029c6:	0f 45 f3             	cmovne %ebx,%esi
+  8029c9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8029cd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8029d1:	83 ed 01             	sub    $0x1,%ebp
+  8029d4:	73 9a                	jae    802970 <__divdi3+0x70>
+  8029d6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8029da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029e2:	85 ed                	test   %ebp,%ebp
+  8029e4:	0f 84 47 ff ff ff    	je     802931 <__divdi3+0x31>
+  8029ea:	f7 d8                	neg    %eax
+  8029ec:	83 d2 00             	adc    $0x0,%edx
+  8029ef:	83 c4 1c             	add    $0x1c,%esp
+  8029f2:	5b                   	pop    %ebx
+  8029f3:	f7 da                	neg    %edx
+  8029f5:	5e                   	pop    %esi
+  8029f6:	5f                   	pop    %edi
+  8029f7:	5d                   	pop    %ebp
+  8029f8:	c3                   	ret
+  8029f9:	f7 de                	neg    %esi
+  8029fb:	83 d7 00             	adc    $0x0,%edi
+  8029fe:	f7 df                	neg    %edi
+  802a00:	85 db                	test   %ebx,%ebx
+  802a02:	78 23                	js     802a27 <__divdi3+0x127>
+  802a04:	89 dd                	mov    %ebx,%ebp
+  802a06:	89 c8                	mov    %ecx,%eax
+  802a08:	89 da                	mov    %ebx,%edx
+  802a0a:	09 cd                	or     %ecx,%ebp
+  802a0c:	0f 84 1f ff ff ff    	je     802931 <__divdi3+0x31>
+  802a12:	89 0c 24             	mov    %ecx,(%esp)
+  802a15:	89 f0                	mov    %esi,%eax
+  802a17:	89 fa                	mov    %edi,%edx
+  802a19:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802a1e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a22:	e9 29 ff ff ff       	jmp    802950 <__divdi3+0x50>
+  802a27:	31 ed                	xor    %ebp,%ebp
+  802a29:	e9 10 ff ff ff       	jmp    80293e <__divdi3+0x3e>
+  802a2e:	89 0c 24             	mov    %ecx,(%esp)
+  802a31:	89 f0                	mov    %esi,%eax
+  802a33:	89 fa                	mov    %edi,%edx
+  802a35:	31 ed                	xor    %ebp,%ebp
+  802a37:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a3b:	e9 10 ff ff ff       	jmp    802950 <__divdi3+0x50>
+
+00802a40 <__moddi3>:
+  802a40:	55                   	push   %ebp
+  802a41:	57                   	push   %edi
+  802a42:	56                   	push   %esi
+  802a43:	53                   	push   %ebx
+  802a44:	83 ec 14             	sub    $0x14,%esp
+  802a47:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a4b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a4f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802a53:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802a57:	85 d2                	test   %edx,%edx
+  802a59:	0f 88 9b 00 00 00    	js     802afa <__moddi3+0xba>
+  802a5f:	89 f7                	mov    %esi,%edi
+  802a61:	31 ed                	xor    %ebp,%ebp
+  802a63:	09 cf                	or     %ecx,%edi
+  802a65:	0f 84 83 00 00 00    	je     802aee <__moddi3+0xae>
+  802a6b:	89 cb                	mov    %ecx,%ebx
+  802a6d:	89 f7                	mov    %esi,%edi
+  802a6f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802a73:	f7 db                	neg    %ebx
+  802a75:	83 d7 00             	adc    $0x0,%edi
+  802a78:	f7 df                	neg    %edi
+  802a7a:	0f 49 f7             	cmovns %edi,%esi
+  802a7d:	0f 49 cb             	cmovns %ebx,%ecx
+  802a80:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802a84:	89 0c 24             	mov    %ecx,(%esp)
+  802a87:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a8c:	89 cd                	mov    %ecx,%ebp
+  802a8e:	66 90                	xchg   %ax,%ax
+  802a90:	89 e9                	mov    %ebp,%ecx
+  802a92:	89 c3                	mov    %eax,%ebx
+  802a94:	89 d6                	mov    %edx,%esi
+  802a96:	31 ff                	xor    %edi,%edi
+  802a98:	d3 ee                	shr    %cl,%esi
+  802a9a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a9d:	f6 c1 20             	test   $0x20,%cl
+  802aa0:	0f 45 de             	cmovne %esi,%ebx
+  802aa3:	0f 45 f7             	cmovne %edi,%esi
+  802aa6:	8b 3c 24             	mov    (%esp),%edi
+  802aa9:	39 fb                	cmp    %edi,%ebx
+  802aab:	89 f7                	mov    %esi,%edi
+  802aad:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ab1:	8b 1c 24             	mov    (%esp),%ebx
+  802ab4:	19 f7                	sbb    %esi,%edi
+  802ab6:	72 1a                	jb     802ad2 <__moddi3+0x92>
+  802ab8:	89 e9                	mov    %ebp,%ecx
+  802aba:	89 f7                	mov    %esi,%edi
+  802abc:	89 de                	mov    %ebx,%esi
+  802abe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ac1:	d3 e6                	shl    %cl,%esi
+  802ac3:	31 db                	xor    %ebx,%ebx
+  802ac5:	f6 c1 20             	test   $0x20,%cl
+  802ac8:	0f 45 fe             	cmovne %esi,%edi
+  802acb:	0f 45 f3             	cmovne %ebx,%esi
+  802ace:	29 f0                	sub    %esi,%eax
+  802ad0:	19 fa                	sbb    %edi,%edx
+  802ad2:	83 ed 01             	sub    $0x1,%ebp
+  802ad5:	73 b9                	jae    802a90 <__moddi3+0x50>
+  802ad7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802adb:	85 ed                	test   %ebp,%ebp
+  802add:	74 07                	je     802ae6 <__moddi3+0xa6>
+  802adf:	f7 d8                	neg    %eax
+  802ae1:	83 d2 00             	adc    $0x0,%edx
+  802ae4:	f7 da                	neg    %edx
+  802ae6:	83 c4 14             	add    $0x14,%esp
+  802ae9:	5b                   	pop    %ebx
+  802aea:	5e                   	pop    %esi
+  802aeb:	5f                   	pop    %edi
+  802aec:	5d                   	pop    %ebp
+  802aed:	c3                   	ret
+  802aee:	83 c4 14             	add    $0x14,%esp
+  802af1:	31 c0                	xor    %eax,%eax
+  802af3:	31 d2                	xor    %edx,%edx
+  802af5:	5b                   	pop    %ebx
+  802af6:	5e                   	pop    %esi
+  802af7:	5f                   	pop    %edi
+  802af8:	5d                   	pop    %ebp
+  802af9:	c3                   	ret
+  802afa:	89 f7                	mov    %esi,%edi
+  802afc:	09 cf                	or     %ecx,%edi
+  802afe:	74 11                	je     802b11 <__moddi3+0xd1>
+  802b00:	f7 d8                	neg    %eax
+  802b02:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802b07:	83 d2 00             	adc    $0x0,%edx
+  802b0a:	f7 da                	neg    %edx
+  802b0c:	e9 5a ff ff ff       	jmp    802a6b <__moddi3+0x2b>
+  802b11:	31 c0                	xor    %eax,%eax
+  802b13:	31 d2                	xor    %edx,%edx
+  802b15:	eb c8                	jmp    802adf <__moddi3+0x9f>
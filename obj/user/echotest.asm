@@ -0,0 +1,6163 @@
+
+obj/user/echotest.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a6 04 00 00       	call   8004d7 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+
+const char *msg = "Hello world!\n";
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 20 2b 80 00       	push   $0x802b20
+  80003f:	e8 88 05 00 00       	call   8005cc <cprintf>
+	exit();
+  800044:	e8 d4 04 00 00       	call   80051d <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <umain>:
+
+void umain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 58             	sub    $0x58,%esp
+	struct sockaddr_in echoserver;
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	cprintf("Connecting to:\n");
+  800057:	68 24 2b 80 00       	push   $0x802b24
+  80005c:	e8 6b 05 00 00       	call   8005cc <cprintf>
+	cprintf("\tip address %s = %x\n", IPADDR, inet_addr(IPADDR));
+  800061:	c7 04 24 34 2b 80 00 	movl   $0x802b34,(%esp)
+  800068:	e8 30 04 00 00       	call   80049d <inet_addr>
+  80006d:	83 c4 0c             	add    $0xc,%esp
+  800070:	50                   	push   %eax
+  800071:	68 34 2b 80 00       	push   $0x802b34
+  800076:	68 3e 2b 80 00       	push   $0x802b3e
+  80007b:	e8 4c 05 00 00       	call   8005cc <cprintf>
+
+	// Create the TCP socket
+	if ((sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800080:	83 c4 0c             	add    $0xc,%esp
+  800083:	6a 06                	push   $0x6
+  800085:	6a 01                	push   $0x1
+  800087:	6a 02                	push   $0x2
+  800089:	e8 92 1d 00 00       	call   801e20 <socket>
+  80008e:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  800091:	83 c4 10             	add    $0x10,%esp
+  800094:	85 c0                	test   %eax,%eax
+  800096:	0f 88 b4 00 00 00    	js     800150 <umain+0x102>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  80009c:	83 ec 0c             	sub    $0xc,%esp
+  80009f:	68 6b 2b 80 00       	push   $0x802b6b
+  8000a4:	e8 23 05 00 00       	call   8005cc <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  8000a9:	83 c4 0c             	add    $0xc,%esp
+  8000ac:	6a 10                	push   $0x10
+  8000ae:	6a 00                	push   $0x0
+  8000b0:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8000b3:	53                   	push   %ebx
+  8000b4:	e8 52 0c 00 00       	call   800d0b <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  8000b9:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = inet_addr(IPADDR);   // IP address
+  8000bd:	c7 04 24 34 2b 80 00 	movl   $0x802b34,(%esp)
+  8000c4:	e8 d4 03 00 00       	call   80049d <inet_addr>
+  8000c9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  8000cc:	c7 04 24 10 27 00 00 	movl   $0x2710,(%esp)
+  8000d3:	e8 a7 01 00 00       	call   80027f <htons>
+  8000d8:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to connect to server\n");
+  8000dc:	c7 04 24 7a 2b 80 00 	movl   $0x802b7a,(%esp)
+  8000e3:	e8 e4 04 00 00       	call   8005cc <cprintf>
+
+	// Establish connection
+	if (connect(sock, (struct sockaddr *) &echoserver, sizeof(echoserver)) < 0)
+  8000e8:	83 c4 0c             	add    $0xc,%esp
+  8000eb:	6a 10                	push   $0x10
+  8000ed:	53                   	push   %ebx
+  8000ee:	ff 75 b4             	push   -0x4c(%ebp)
+  8000f1:	e8 e1 1c 00 00       	call   801dd7 <connect>
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	85 c0                	test   %eax,%eax
+  8000fb:	78 62                	js     80015f <umain+0x111>
+		die("Failed to connect with server");
+
+	cprintf("connected to server\n");
+  8000fd:	83 ec 0c             	sub    $0xc,%esp
+  800100:	68 b5 2b 80 00       	push   $0x802bb5
+  800105:	e8 c2 04 00 00       	call   8005cc <cprintf>
+
+	// Send the word to the server
+	echolen = strlen(msg);
+  80010a:	83 c4 04             	add    $0x4,%esp
+  80010d:	ff 35 00 40 80 00    	push   0x804000
+  800113:	e8 67 0a 00 00       	call   800b7f <strlen>
+  800118:	89 c7                	mov    %eax,%edi
+  80011a:	89 45 b0             	mov    %eax,-0x50(%ebp)
+	if (write(sock, msg, echolen) != echolen)
+  80011d:	83 c4 0c             	add    $0xc,%esp
+  800120:	50                   	push   %eax
+  800121:	ff 35 00 40 80 00    	push   0x804000
+  800127:	ff 75 b4             	push   -0x4c(%ebp)
+  80012a:	e8 ce 16 00 00       	call   8017fd <write>
+  80012f:	83 c4 10             	add    $0x10,%esp
+  800132:	39 c7                	cmp    %eax,%edi
+  800134:	75 35                	jne    80016b <umain+0x11d>
+		die("Mismatch in number of sent bytes");
+
+	// Receive the word back from the server
+	cprintf("Received: \n");
+  800136:	83 ec 0c             	sub    $0xc,%esp
+  800139:	68 ca 2b 80 00       	push   $0x802bca
+  80013e:	e8 89 04 00 00       	call   8005cc <cprintf>
+	while (received < echolen) {
+  800143:	83 c4 10             	add    $0x10,%esp
+	int received = 0;
+  800146:	be 00 00 00 00       	mov    $0x0,%esi
+		int bytes = 0;
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  80014b:	8d 7d b8             	lea    -0x48(%ebp),%edi
+	while (received < echolen) {
+  80014e:	eb 3a                	jmp    80018a <umain+0x13c>
+		die("Failed to create socket");
+  800150:	b8 53 2b 80 00       	mov    $0x802b53,%eax
+  800155:	e8 d9 fe ff ff       	call   800033 <die>
+  80015a:	e9 3d ff ff ff       	jmp    80009c <umain+0x4e>
+		die("Failed to connect with server");
+  80015f:	b8 97 2b 80 00       	mov    $0x802b97,%eax
+  800164:	e8 ca fe ff ff       	call   800033 <die>
+  800169:	eb 92                	jmp    8000fd <umain+0xaf>
+		die("Mismatch in number of sent bytes");
+  80016b:	b8 e4 2b 80 00       	mov    $0x802be4,%eax
+  800170:	e8 be fe ff ff       	call   800033 <die>
+  800175:	eb bf                	jmp    800136 <umain+0xe8>
+			die("Failed to receive bytes from server");
+		}
+		received += bytes;
+  800177:	01 de                	add    %ebx,%esi
+		buffer[bytes] = '\0';        // Assure null terminated string
+  800179:	c6 44 1d b8 00       	movb   $0x0,-0x48(%ebp,%ebx,1)
+		cprintf(buffer);
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	57                   	push   %edi
+  800182:	e8 45 04 00 00       	call   8005cc <cprintf>
+  800187:	83 c4 10             	add    $0x10,%esp
+	while (received < echolen) {
+  80018a:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  80018d:	39 c6                	cmp    %eax,%esi
+  80018f:	73 23                	jae    8001b4 <umain+0x166>
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  800191:	83 ec 04             	sub    $0x4,%esp
+  800194:	6a 1f                	push   $0x1f
+  800196:	57                   	push   %edi
+  800197:	ff 75 b4             	push   -0x4c(%ebp)
+  80019a:	e8 90 15 00 00       	call   80172f <read>
+  80019f:	89 c3                	mov    %eax,%ebx
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	85 c0                	test   %eax,%eax
+  8001a6:	7f cf                	jg     800177 <umain+0x129>
+			die("Failed to receive bytes from server");
+  8001a8:	b8 08 2c 80 00       	mov    $0x802c08,%eax
+  8001ad:	e8 81 fe ff ff       	call   800033 <die>
+  8001b2:	eb c3                	jmp    800177 <umain+0x129>
+	}
+	cprintf("\n");
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	68 d4 2b 80 00       	push   $0x802bd4
+  8001bc:	e8 0b 04 00 00       	call   8005cc <cprintf>
+
+	close(sock);
+  8001c1:	83 c4 04             	add    $0x4,%esp
+  8001c4:	ff 75 b4             	push   -0x4c(%ebp)
+  8001c7:	e8 27 14 00 00       	call   8015f3 <close>
+}
+  8001cc:	83 c4 10             	add    $0x10,%esp
+  8001cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d2:	5b                   	pop    %ebx
+  8001d3:	5e                   	pop    %esi
+  8001d4:	5f                   	pop    %edi
+  8001d5:	5d                   	pop    %ebp
+  8001d6:	c3                   	ret
+
+008001d7 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	57                   	push   %edi
+  8001db:	56                   	push   %esi
+  8001dc:	53                   	push   %ebx
+  8001dd:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8001e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8001e6:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  8001e9:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  8001ee:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  8001f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001f6:	eb 31                	jmp    800229 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  8001f8:	0f b6 c8             	movzbl %al,%ecx
+  8001fb:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800200:	88 0a                	mov    %cl,(%edx)
+  800202:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  800205:	83 e8 01             	sub    $0x1,%eax
+  800208:	3c ff                	cmp    $0xff,%al
+  80020a:	75 ec                	jne    8001f8 <inet_ntoa+0x21>
+  80020c:	0f b6 db             	movzbl %bl,%ebx
+  80020f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800212:	01 d8                	add    %ebx,%eax
+  800214:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  800216:	8d 40 01             	lea    0x1(%eax),%eax
+  800219:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80021c:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  80021f:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  800222:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800225:	39 c7                	cmp    %eax,%edi
+  800227:	74 46                	je     80026f <inet_ntoa+0x98>
+  800229:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  80022c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800231:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  800234:	89 f0                	mov    %esi,%eax
+  800236:	f6 e2                	mul    %dl
+  800238:	66 c1 e8 0b          	shr    $0xb,%ax
+  80023c:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  80023f:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  800242:	01 c9                	add    %ecx,%ecx
+  800244:	89 d0                	mov    %edx,%eax
+  800246:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800248:	89 d7                	mov    %edx,%edi
+  80024a:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80024e:	89 d9                	mov    %ebx,%ecx
+  800250:	83 c3 01             	add    $0x1,%ebx
+  800253:	0f b6 c9             	movzbl %cl,%ecx
+  800256:	83 c0 30             	add    $0x30,%eax
+  800259:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  80025d:	89 f8                	mov    %edi,%eax
+  80025f:	3c 09                	cmp    $0x9,%al
+  800261:	77 d1                	ja     800234 <inet_ntoa+0x5d>
+  800263:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  800266:	88 17                	mov    %dl,(%edi)
+  800268:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80026b:	89 d8                	mov    %ebx,%eax
+  80026d:	eb 96                	jmp    800205 <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  80026f:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  800272:	b8 00 50 80 00       	mov    $0x805000,%eax
+  800277:	83 c4 1c             	add    $0x1c,%esp
+  80027a:	5b                   	pop    %ebx
+  80027b:	5e                   	pop    %esi
+  80027c:	5f                   	pop    %edi
+  80027d:	5d                   	pop    %ebp
+  80027e:	c3                   	ret
+
+0080027f <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  80027f:	55                   	push   %ebp
+  800280:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  800282:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800286:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  80028a:	5d                   	pop    %ebp
+  80028b:	c3                   	ret
+
+0080028c <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  80028c:	55                   	push   %ebp
+  80028d:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80028f:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800293:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  800297:	5d                   	pop    %ebp
+  800298:	c3                   	ret
+
+00800299 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  800299:	55                   	push   %ebp
+  80029a:	89 e5                	mov    %esp,%ebp
+  80029c:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  80029f:	89 d0                	mov    %edx,%eax
+  8002a1:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8002a4:	89 d1                	mov    %edx,%ecx
+  8002a6:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002a9:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8002ab:	89 d1                	mov    %edx,%ecx
+  8002ad:	c1 e1 08             	shl    $0x8,%ecx
+  8002b0:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002b6:	09 c8                	or     %ecx,%eax
+  8002b8:	c1 ea 08             	shr    $0x8,%edx
+  8002bb:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8002c1:	09 d0                	or     %edx,%eax
+}
+  8002c3:	5d                   	pop    %ebp
+  8002c4:	c3                   	ret
+
+008002c5 <inet_aton>:
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	57                   	push   %edi
+  8002c9:	56                   	push   %esi
+  8002ca:	53                   	push   %ebx
+  8002cb:	83 ec 2c             	sub    $0x2c,%esp
+  8002ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8002d1:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8002d4:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8002d7:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8002da:	e9 9b 00 00 00       	jmp    80037a <inet_aton+0xb5>
+      c = *++cp;
+  8002df:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8002e3:	89 c1                	mov    %eax,%ecx
+  8002e5:	83 e1 df             	and    $0xffffffdf,%ecx
+  8002e8:	80 f9 58             	cmp    $0x58,%cl
+  8002eb:	74 10                	je     8002fd <inet_aton+0x38>
+      c = *++cp;
+  8002ed:	83 c2 01             	add    $0x1,%edx
+  8002f0:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  8002f3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8002f8:	e9 97 00 00 00       	jmp    800394 <inet_aton+0xcf>
+        c = *++cp;
+  8002fd:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800301:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  800304:	bf 10 00 00 00       	mov    $0x10,%edi
+  800309:	e9 86 00 00 00       	jmp    800394 <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  80030e:	0f af d7             	imul   %edi,%edx
+  800311:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  800315:	0f be 01             	movsbl (%ecx),%eax
+  800318:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  80031b:	88 45 d7             	mov    %al,-0x29(%ebp)
+  80031e:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800321:	80 fb 09             	cmp    $0x9,%bl
+  800324:	76 e8                	jbe    80030e <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  800326:	83 ff 10             	cmp    $0x10,%edi
+  800329:	75 2e                	jne    800359 <inet_aton+0x94>
+  80032b:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  80032f:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  800332:	83 e3 df             	and    $0xffffffdf,%ebx
+  800335:	83 eb 41             	sub    $0x41,%ebx
+  800338:	80 fb 05             	cmp    $0x5,%bl
+  80033b:	77 1c                	ja     800359 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  80033d:	c1 e2 04             	shl    $0x4,%edx
+  800340:	83 c0 0a             	add    $0xa,%eax
+  800343:	89 f3                	mov    %esi,%ebx
+  800345:	80 fb 1a             	cmp    $0x1a,%bl
+  800348:	19 db                	sbb    %ebx,%ebx
+  80034a:	83 e3 20             	and    $0x20,%ebx
+  80034d:	83 c3 41             	add    $0x41,%ebx
+  800350:	29 d8                	sub    %ebx,%eax
+  800352:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  800354:	0f be 01             	movsbl (%ecx),%eax
+  800357:	eb bf                	jmp    800318 <inet_aton+0x53>
+    if (c == '.') {
+  800359:	83 f8 2e             	cmp    $0x2e,%eax
+  80035c:	75 43                	jne    8003a1 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  80035e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800361:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800364:	39 f0                	cmp    %esi,%eax
+  800366:	0f 84 22 01 00 00    	je     80048e <inet_aton+0x1c9>
+      *pp++ = val;
+  80036c:	83 c0 04             	add    $0x4,%eax
+  80036f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800372:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  800375:	89 ca                	mov    %ecx,%edx
+  800377:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  80037a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80037d:	80 f9 09             	cmp    $0x9,%cl
+  800380:	0f 87 01 01 00 00    	ja     800487 <inet_aton+0x1c2>
+    base = 10;
+  800386:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  80038b:	83 f8 30             	cmp    $0x30,%eax
+  80038e:	0f 84 4b ff ff ff    	je     8002df <inet_aton+0x1a>
+  800394:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  800397:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039c:	e9 7a ff ff ff       	jmp    80031b <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003a1:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8003a5:	89 d6                	mov    %edx,%esi
+  8003a7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8003aa:	85 c0                	test   %eax,%eax
+  8003ac:	74 2e                	je     8003dc <inet_aton+0x117>
+    return (0);
+  8003ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003b3:	89 fa                	mov    %edi,%edx
+  8003b5:	80 fa 1f             	cmp    $0x1f,%dl
+  8003b8:	0f 86 d5 00 00 00    	jbe    800493 <inet_aton+0x1ce>
+  8003be:	84 c0                	test   %al,%al
+  8003c0:	0f 88 cd 00 00 00    	js     800493 <inet_aton+0x1ce>
+  8003c6:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8003c9:	83 f9 04             	cmp    $0x4,%ecx
+  8003cc:	76 0e                	jbe    8003dc <inet_aton+0x117>
+    return (0);
+  8003ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003d3:	83 f8 20             	cmp    $0x20,%eax
+  8003d6:	0f 85 b7 00 00 00    	jne    800493 <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8003dc:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8003df:	89 d8                	mov    %ebx,%eax
+  8003e1:	29 c8                	sub    %ecx,%eax
+  8003e3:	c1 f8 02             	sar    $0x2,%eax
+  8003e6:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  8003e9:	83 f8 02             	cmp    $0x2,%eax
+  8003ec:	74 7a                	je     800468 <inet_aton+0x1a3>
+  8003ee:	83 f9 03             	cmp    $0x3,%ecx
+  8003f1:	7f 49                	jg     80043c <inet_aton+0x177>
+  8003f3:	85 c9                	test   %ecx,%ecx
+  8003f5:	0f 84 98 00 00 00    	je     800493 <inet_aton+0x1ce>
+  8003fb:	83 f9 02             	cmp    $0x2,%ecx
+  8003fe:	75 19                	jne    800419 <inet_aton+0x154>
+      return (0);
+  800400:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  800405:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  80040b:	0f 87 82 00 00 00    	ja     800493 <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800411:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800414:	c1 e0 18             	shl    $0x18,%eax
+  800417:	09 c6                	or     %eax,%esi
+  return (1);
+  800419:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  80041e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800422:	74 6f                	je     800493 <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  800424:	83 ec 0c             	sub    $0xc,%esp
+  800427:	56                   	push   %esi
+  800428:	e8 6c fe ff ff       	call   800299 <htonl>
+  80042d:	83 c4 10             	add    $0x10,%esp
+  800430:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800433:	89 06                	mov    %eax,(%esi)
+  return (1);
+  800435:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80043a:	eb 57                	jmp    800493 <inet_aton+0x1ce>
+  switch (n) {
+  80043c:	83 f9 04             	cmp    $0x4,%ecx
+  80043f:	75 d8                	jne    800419 <inet_aton+0x154>
+      return (0);
+  800441:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  800446:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  80044c:	77 45                	ja     800493 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  80044e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800451:	c1 e0 18             	shl    $0x18,%eax
+  800454:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800457:	c1 e1 10             	shl    $0x10,%ecx
+  80045a:	09 c8                	or     %ecx,%eax
+  80045c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80045f:	c1 e1 08             	shl    $0x8,%ecx
+  800462:	09 c8                	or     %ecx,%eax
+  800464:	09 c6                	or     %eax,%esi
+    break;
+  800466:	eb b1                	jmp    800419 <inet_aton+0x154>
+      return (0);
+  800468:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  80046d:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  800473:	77 1e                	ja     800493 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  800475:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800478:	c1 e0 18             	shl    $0x18,%eax
+  80047b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80047e:	c1 e1 10             	shl    $0x10,%ecx
+  800481:	09 c8                	or     %ecx,%eax
+  800483:	09 c6                	or     %eax,%esi
+    break;
+  800485:	eb 92                	jmp    800419 <inet_aton+0x154>
+      return (0);
+  800487:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048c:	eb 05                	jmp    800493 <inet_aton+0x1ce>
+        return (0);
+  80048e:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  800493:	89 c8                	mov    %ecx,%eax
+  800495:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800498:	5b                   	pop    %ebx
+  800499:	5e                   	pop    %esi
+  80049a:	5f                   	pop    %edi
+  80049b:	5d                   	pop    %ebp
+  80049c:	c3                   	ret
+
+0080049d <inet_addr>:
+{
+  80049d:	55                   	push   %ebp
+  80049e:	89 e5                	mov    %esp,%ebp
+  8004a0:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8004a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004a6:	50                   	push   %eax
+  8004a7:	ff 75 08             	push   0x8(%ebp)
+  8004aa:	e8 16 fe ff ff       	call   8002c5 <inet_aton>
+  8004af:	89 c2                	mov    %eax,%edx
+  8004b1:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8004b4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8004b9:	85 d2                	test   %edx,%edx
+  8004bb:	75 02                	jne    8004bf <inet_addr+0x22>
+}
+  8004bd:	c9                   	leave
+  8004be:	c3                   	ret
+    return (val.s_addr);
+  8004bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004c2:	eb f9                	jmp    8004bd <inet_addr+0x20>
+
+008004c4 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8004c4:	55                   	push   %ebp
+  8004c5:	89 e5                	mov    %esp,%ebp
+  8004c7:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8004ca:	ff 75 08             	push   0x8(%ebp)
+  8004cd:	e8 c7 fd ff ff       	call   800299 <htonl>
+  8004d2:	83 c4 10             	add    $0x10,%esp
+}
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+
+008004d7 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004d7:	55                   	push   %ebp
+  8004d8:	89 e5                	mov    %esp,%ebp
+  8004da:	56                   	push   %esi
+  8004db:	53                   	push   %ebx
+  8004dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004df:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8004e2:	e8 a1 0a 00 00       	call   800f88 <sys_getenvid>
+  8004e7:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8004ec:	c1 e0 09             	shl    $0x9,%eax
+  8004ef:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004f4:	a3 18 50 80 00       	mov    %eax,0x805018
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004f9:	85 db                	test   %ebx,%ebx
+  8004fb:	7e 07                	jle    800504 <libmain+0x2d>
+		binaryname = argv[0];
+  8004fd:	8b 06                	mov    (%esi),%eax
+  8004ff:	a3 04 40 80 00       	mov    %eax,0x804004
+
+	// call user main routine
+	umain(argc, argv);
+  800504:	83 ec 08             	sub    $0x8,%esp
+  800507:	56                   	push   %esi
+  800508:	53                   	push   %ebx
+  800509:	e8 40 fb ff ff       	call   80004e <umain>
+
+	// exit gracefully
+	exit();
+  80050e:	e8 0a 00 00 00       	call   80051d <exit>
+}
+  800513:	83 c4 10             	add    $0x10,%esp
+  800516:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800519:	5b                   	pop    %ebx
+  80051a:	5e                   	pop    %esi
+  80051b:	5d                   	pop    %ebp
+  80051c:	c3                   	ret
+
+0080051d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80051d:	55                   	push   %ebp
+  80051e:	89 e5                	mov    %esp,%ebp
+  800520:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800523:	e8 f8 10 00 00       	call   801620 <close_all>
+	sys_env_destroy(0);
+  800528:	83 ec 0c             	sub    $0xc,%esp
+  80052b:	6a 00                	push   $0x0
+  80052d:	e8 15 0a 00 00       	call   800f47 <sys_env_destroy>
+}
+  800532:	83 c4 10             	add    $0x10,%esp
+  800535:	c9                   	leave
+  800536:	c3                   	ret
+
+00800537 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800537:	55                   	push   %ebp
+  800538:	89 e5                	mov    %esp,%ebp
+  80053a:	53                   	push   %ebx
+  80053b:	83 ec 04             	sub    $0x4,%esp
+  80053e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800541:	8b 13                	mov    (%ebx),%edx
+  800543:	8d 42 01             	lea    0x1(%edx),%eax
+  800546:	89 03                	mov    %eax,(%ebx)
+  800548:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80054b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80054f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800554:	74 09                	je     80055f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800556:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80055a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80055d:	c9                   	leave
+  80055e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	68 ff 00 00 00       	push   $0xff
+  800567:	8d 43 08             	lea    0x8(%ebx),%eax
+  80056a:	50                   	push   %eax
+  80056b:	e8 7a 09 00 00       	call   800eea <sys_cputs>
+		b->idx = 0;
+  800570:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800576:	83 c4 10             	add    $0x10,%esp
+  800579:	eb db                	jmp    800556 <putch+0x1f>
+
+0080057b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80057b:	55                   	push   %ebp
+  80057c:	89 e5                	mov    %esp,%ebp
+  80057e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800584:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80058b:	00 00 00 
+	b.cnt = 0;
+  80058e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800595:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800598:	ff 75 0c             	push   0xc(%ebp)
+  80059b:	ff 75 08             	push   0x8(%ebp)
+  80059e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005a4:	50                   	push   %eax
+  8005a5:	68 37 05 80 00       	push   $0x800537
+  8005aa:	e8 14 01 00 00       	call   8006c3 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005af:	83 c4 08             	add    $0x8,%esp
+  8005b2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005b8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005be:	50                   	push   %eax
+  8005bf:	e8 26 09 00 00       	call   800eea <sys_cputs>
+
+	return b.cnt;
+}
+  8005c4:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005ca:	c9                   	leave
+  8005cb:	c3                   	ret
+
+008005cc <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005cc:	55                   	push   %ebp
+  8005cd:	89 e5                	mov    %esp,%ebp
+  8005cf:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005d2:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005d5:	50                   	push   %eax
+  8005d6:	ff 75 08             	push   0x8(%ebp)
+  8005d9:	e8 9d ff ff ff       	call   80057b <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005de:	c9                   	leave
+  8005df:	c3                   	ret
+
+008005e0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005e0:	55                   	push   %ebp
+  8005e1:	89 e5                	mov    %esp,%ebp
+  8005e3:	57                   	push   %edi
+  8005e4:	56                   	push   %esi
+  8005e5:	53                   	push   %ebx
+  8005e6:	83 ec 1c             	sub    $0x1c,%esp
+  8005e9:	89 c7                	mov    %eax,%edi
+  8005eb:	89 d6                	mov    %edx,%esi
+  8005ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005f3:	89 d1                	mov    %edx,%ecx
+  8005f5:	89 c2                	mov    %eax,%edx
+  8005f7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005fd:	8b 45 10             	mov    0x10(%ebp),%eax
+  800600:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800603:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800606:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80060d:	39 c2                	cmp    %eax,%edx
+  80060f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800612:	72 3e                	jb     800652 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800614:	83 ec 0c             	sub    $0xc,%esp
+  800617:	ff 75 18             	push   0x18(%ebp)
+  80061a:	83 eb 01             	sub    $0x1,%ebx
+  80061d:	53                   	push   %ebx
+  80061e:	50                   	push   %eax
+  80061f:	83 ec 08             	sub    $0x8,%esp
+  800622:	ff 75 e4             	push   -0x1c(%ebp)
+  800625:	ff 75 e0             	push   -0x20(%ebp)
+  800628:	ff 75 dc             	push   -0x24(%ebp)
+  80062b:	ff 75 d8             	push   -0x28(%ebp)
+  80062e:	e8 6d 21 00 00       	call   8027a0 <__udivdi3>
+  800633:	83 c4 18             	add    $0x18,%esp
+  800636:	52                   	push   %edx
+  800637:	50                   	push   %eax
+  800638:	89 f2                	mov    %esi,%edx
+  80063a:	89 f8                	mov    %edi,%eax
+  80063c:	e8 9f ff ff ff       	call   8005e0 <printnum>
+  800641:	83 c4 20             	add    $0x20,%esp
+  800644:	eb 13                	jmp    800659 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800646:	83 ec 08             	sub    $0x8,%esp
+  800649:	56                   	push   %esi
+  80064a:	ff 75 18             	push   0x18(%ebp)
+  80064d:	ff d7                	call   *%edi
+  80064f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800652:	83 eb 01             	sub    $0x1,%ebx
+  800655:	85 db                	test   %ebx,%ebx
+  800657:	7f ed                	jg     800646 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800659:	83 ec 08             	sub    $0x8,%esp
+  80065c:	56                   	push   %esi
+  80065d:	83 ec 04             	sub    $0x4,%esp
+  800660:	ff 75 e4             	push   -0x1c(%ebp)
+  800663:	ff 75 e0             	push   -0x20(%ebp)
+  800666:	ff 75 dc             	push   -0x24(%ebp)
+  800669:	ff 75 d8             	push   -0x28(%ebp)
+  80066c:	e8 ef 21 00 00       	call   802860 <__umoddi3>
+  800671:	83 c4 14             	add    $0x14,%esp
+  800674:	0f be 80 36 2c 80 00 	movsbl 0x802c36(%eax),%eax
+  80067b:	50                   	push   %eax
+  80067c:	ff d7                	call   *%edi
+}
+  80067e:	83 c4 10             	add    $0x10,%esp
+  800681:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800684:	5b                   	pop    %ebx
+  800685:	5e                   	pop    %esi
+  800686:	5f                   	pop    %edi
+  800687:	5d                   	pop    %ebp
+  800688:	c3                   	ret
+
+00800689 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800689:	55                   	push   %ebp
+  80068a:	89 e5                	mov    %esp,%ebp
+  80068c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80068f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800693:	8b 10                	mov    (%eax),%edx
+  800695:	3b 50 04             	cmp    0x4(%eax),%edx
+  800698:	73 0a                	jae    8006a4 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80069a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80069d:	89 08                	mov    %ecx,(%eax)
+  80069f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a2:	88 02                	mov    %al,(%edx)
+}
+  8006a4:	5d                   	pop    %ebp
+  8006a5:	c3                   	ret
+
+008006a6 <printfmt>:
+{
+  8006a6:	55                   	push   %ebp
+  8006a7:	89 e5                	mov    %esp,%ebp
+  8006a9:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006ac:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006af:	50                   	push   %eax
+  8006b0:	ff 75 10             	push   0x10(%ebp)
+  8006b3:	ff 75 0c             	push   0xc(%ebp)
+  8006b6:	ff 75 08             	push   0x8(%ebp)
+  8006b9:	e8 05 00 00 00       	call   8006c3 <vprintfmt>
+}
+  8006be:	83 c4 10             	add    $0x10,%esp
+  8006c1:	c9                   	leave
+  8006c2:	c3                   	ret
+
+008006c3 <vprintfmt>:
+{
+  8006c3:	55                   	push   %ebp
+  8006c4:	89 e5                	mov    %esp,%ebp
+  8006c6:	57                   	push   %edi
+  8006c7:	56                   	push   %esi
+  8006c8:	53                   	push   %ebx
+  8006c9:	83 ec 2c             	sub    $0x2c,%esp
+  8006cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006d2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006d5:	eb 0a                	jmp    8006e1 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006d7:	83 ec 08             	sub    $0x8,%esp
+  8006da:	53                   	push   %ebx
+  8006db:	50                   	push   %eax
+  8006dc:	ff d6                	call   *%esi
+  8006de:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006e1:	83 c7 01             	add    $0x1,%edi
+  8006e4:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8006e8:	83 f8 25             	cmp    $0x25,%eax
+  8006eb:	74 0c                	je     8006f9 <vprintfmt+0x36>
+			if (ch == '\0')
+  8006ed:	85 c0                	test   %eax,%eax
+  8006ef:	75 e6                	jne    8006d7 <vprintfmt+0x14>
+}
+  8006f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006f4:	5b                   	pop    %ebx
+  8006f5:	5e                   	pop    %esi
+  8006f6:	5f                   	pop    %edi
+  8006f7:	5d                   	pop    %ebp
+  8006f8:	c3                   	ret
+		padc = ' ';
+  8006f9:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8006fd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800704:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80070b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800712:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800717:	8d 47 01             	lea    0x1(%edi),%eax
+  80071a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80071d:	0f b6 17             	movzbl (%edi),%edx
+  800720:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800723:	3c 55                	cmp    $0x55,%al
+  800725:	0f 87 cf 03 00 00    	ja     800afa <vprintfmt+0x437>
+  80072b:	0f b6 c0             	movzbl %al,%eax
+  80072e:	ff 24 85 80 2d 80 00 	jmp    *0x802d80(,%eax,4)
+  800735:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800738:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80073c:	eb d9                	jmp    800717 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80073e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800741:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800745:	eb d0                	jmp    800717 <vprintfmt+0x54>
+  800747:	0f b6 d2             	movzbl %dl,%edx
+  80074a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80074d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800752:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800755:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800758:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80075c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80075f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800762:	83 f9 09             	cmp    $0x9,%ecx
+  800765:	77 55                	ja     8007bc <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800767:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80076a:	eb e9                	jmp    800755 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80076c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076f:	8b 00                	mov    (%eax),%eax
+  800771:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800774:	8b 45 14             	mov    0x14(%ebp),%eax
+  800777:	8d 40 04             	lea    0x4(%eax),%eax
+  80077a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80077d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800780:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800784:	79 91                	jns    800717 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800786:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800789:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80078c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800793:	eb 82                	jmp    800717 <vprintfmt+0x54>
+			if (width < 0)
+  800795:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800798:	85 d2                	test   %edx,%edx
+  80079a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079f:	0f 49 c2             	cmovns %edx,%eax
+  8007a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007a8:	e9 6a ff ff ff       	jmp    800717 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007b0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007b7:	e9 5b ff ff ff       	jmp    800717 <vprintfmt+0x54>
+  8007bc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007bf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007c2:	eb bc                	jmp    800780 <vprintfmt+0xbd>
+			lflag++;
+  8007c4:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007c7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007ca:	e9 48 ff ff ff       	jmp    800717 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d2:	8d 78 04             	lea    0x4(%eax),%edi
+  8007d5:	83 ec 08             	sub    $0x8,%esp
+  8007d8:	53                   	push   %ebx
+  8007d9:	ff 30                	push   (%eax)
+  8007db:	ff d6                	call   *%esi
+			break;
+  8007dd:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007e0:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007e3:	e9 b1 02 00 00       	jmp    800a99 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8007e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007eb:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8007ee:	8b 10                	mov    (%eax),%edx
+  8007f0:	89 d0                	mov    %edx,%eax
+  8007f2:	f7 d8                	neg    %eax
+  8007f4:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007f7:	83 f8 0f             	cmp    $0xf,%eax
+  8007fa:	7f 23                	jg     80081f <vprintfmt+0x15c>
+  8007fc:	8b 14 85 e0 2e 80 00 	mov    0x802ee0(,%eax,4),%edx
+  800803:	85 d2                	test   %edx,%edx
+  800805:	74 18                	je     80081f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800807:	52                   	push   %edx
+  800808:	68 15 30 80 00       	push   $0x803015
+  80080d:	53                   	push   %ebx
+  80080e:	56                   	push   %esi
+  80080f:	e8 92 fe ff ff       	call   8006a6 <printfmt>
+  800814:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800817:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80081a:	e9 7a 02 00 00       	jmp    800a99 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80081f:	50                   	push   %eax
+  800820:	68 4e 2c 80 00       	push   $0x802c4e
+  800825:	53                   	push   %ebx
+  800826:	56                   	push   %esi
+  800827:	e8 7a fe ff ff       	call   8006a6 <printfmt>
+  80082c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80082f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800832:	e9 62 02 00 00       	jmp    800a99 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800837:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083a:	83 c0 04             	add    $0x4,%eax
+  80083d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800840:	8b 45 14             	mov    0x14(%ebp),%eax
+  800843:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800845:	85 c9                	test   %ecx,%ecx
+  800847:	b8 47 2c 80 00       	mov    $0x802c47,%eax
+  80084c:	0f 45 c1             	cmovne %ecx,%eax
+  80084f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800852:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800856:	7e 06                	jle    80085e <vprintfmt+0x19b>
+  800858:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80085c:	75 0b                	jne    800869 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80085e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800861:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800864:	89 75 08             	mov    %esi,0x8(%ebp)
+  800867:	eb 5c                	jmp    8008c5 <vprintfmt+0x202>
+  800869:	83 ec 08             	sub    $0x8,%esp
+  80086c:	ff 75 d0             	push   -0x30(%ebp)
+  80086f:	ff 75 cc             	push   -0x34(%ebp)
+  800872:	e8 20 03 00 00       	call   800b97 <strnlen>
+  800877:	89 c2                	mov    %eax,%edx
+  800879:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80087c:	29 d0                	sub    %edx,%eax
+  80087e:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800881:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800885:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800888:	89 75 08             	mov    %esi,0x8(%ebp)
+  80088b:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80088d:	eb 0e                	jmp    80089d <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80088f:	83 ec 08             	sub    $0x8,%esp
+  800892:	53                   	push   %ebx
+  800893:	57                   	push   %edi
+  800894:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800897:	83 ee 01             	sub    $0x1,%esi
+  80089a:	83 c4 10             	add    $0x10,%esp
+  80089d:	85 f6                	test   %esi,%esi
+  80089f:	7f ee                	jg     80088f <vprintfmt+0x1cc>
+  8008a1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a7:	85 c0                	test   %eax,%eax
+  8008a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008ae:	0f 49 d0             	cmovns %eax,%edx
+  8008b1:	29 d0                	sub    %edx,%eax
+  8008b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008b6:	eb a6                	jmp    80085e <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8008b8:	83 ec 08             	sub    $0x8,%esp
+  8008bb:	53                   	push   %ebx
+  8008bc:	52                   	push   %edx
+  8008bd:	ff 55 08             	call   *0x8(%ebp)
+  8008c0:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008c3:	89 f1                	mov    %esi,%ecx
+  8008c5:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008c8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008cc:	0f be d0             	movsbl %al,%edx
+  8008cf:	85 d2                	test   %edx,%edx
+  8008d1:	74 28                	je     8008fb <vprintfmt+0x238>
+  8008d3:	85 ff                	test   %edi,%edi
+  8008d5:	78 05                	js     8008dc <vprintfmt+0x219>
+  8008d7:	83 ef 01             	sub    $0x1,%edi
+  8008da:	78 30                	js     80090c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008dc:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008e0:	74 d6                	je     8008b8 <vprintfmt+0x1f5>
+  8008e2:	0f be c0             	movsbl %al,%eax
+  8008e5:	83 e8 20             	sub    $0x20,%eax
+  8008e8:	83 f8 5e             	cmp    $0x5e,%eax
+  8008eb:	76 cb                	jbe    8008b8 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8008ed:	83 ec 08             	sub    $0x8,%esp
+  8008f0:	53                   	push   %ebx
+  8008f1:	6a 3f                	push   $0x3f
+  8008f3:	ff 55 08             	call   *0x8(%ebp)
+  8008f6:	83 c4 10             	add    $0x10,%esp
+  8008f9:	eb c8                	jmp    8008c3 <vprintfmt+0x200>
+  8008fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008fe:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800901:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800904:	01 d0                	add    %edx,%eax
+  800906:	29 c8                	sub    %ecx,%eax
+  800908:	89 c7                	mov    %eax,%edi
+  80090a:	eb 13                	jmp    80091f <vprintfmt+0x25c>
+  80090c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80090f:	eb ed                	jmp    8008fe <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800911:	83 ec 08             	sub    $0x8,%esp
+  800914:	53                   	push   %ebx
+  800915:	6a 20                	push   $0x20
+  800917:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800919:	83 ef 01             	sub    $0x1,%edi
+  80091c:	83 c4 10             	add    $0x10,%esp
+  80091f:	85 ff                	test   %edi,%edi
+  800921:	7f ee                	jg     800911 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800923:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800926:	89 45 14             	mov    %eax,0x14(%ebp)
+  800929:	e9 6b 01 00 00       	jmp    800a99 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80092e:	83 f9 01             	cmp    $0x1,%ecx
+  800931:	7f 1f                	jg     800952 <vprintfmt+0x28f>
+	else if (lflag)
+  800933:	85 c9                	test   %ecx,%ecx
+  800935:	74 67                	je     80099e <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800937:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093a:	8b 00                	mov    (%eax),%eax
+  80093c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80093f:	89 c1                	mov    %eax,%ecx
+  800941:	c1 f9 1f             	sar    $0x1f,%ecx
+  800944:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800947:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094a:	8d 40 04             	lea    0x4(%eax),%eax
+  80094d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800950:	eb 17                	jmp    800969 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800952:	8b 45 14             	mov    0x14(%ebp),%eax
+  800955:	8b 50 04             	mov    0x4(%eax),%edx
+  800958:	8b 00                	mov    (%eax),%eax
+  80095a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80095d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800960:	8b 45 14             	mov    0x14(%ebp),%eax
+  800963:	8d 40 08             	lea    0x8(%eax),%eax
+  800966:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800969:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80096c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80096f:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800974:	85 c9                	test   %ecx,%ecx
+  800976:	0f 89 03 01 00 00    	jns    800a7f <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80097c:	83 ec 08             	sub    $0x8,%esp
+  80097f:	53                   	push   %ebx
+  800980:	6a 2d                	push   $0x2d
+  800982:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800984:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800987:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80098a:	f7 da                	neg    %edx
+  80098c:	83 d1 00             	adc    $0x0,%ecx
+  80098f:	f7 d9                	neg    %ecx
+  800991:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800994:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800999:	e9 e1 00 00 00       	jmp    800a7f <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80099e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a1:	8b 00                	mov    (%eax),%eax
+  8009a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009a6:	89 c1                	mov    %eax,%ecx
+  8009a8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009ab:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009b7:	eb b0                	jmp    800969 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8009b9:	83 f9 01             	cmp    $0x1,%ecx
+  8009bc:	7f 1e                	jg     8009dc <vprintfmt+0x319>
+	else if (lflag)
+  8009be:	85 c9                	test   %ecx,%ecx
+  8009c0:	74 32                	je     8009f4 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8009c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c5:	8b 10                	mov    (%eax),%edx
+  8009c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009d2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8009d7:	e9 a3 00 00 00       	jmp    800a7f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009df:	8b 10                	mov    (%eax),%edx
+  8009e1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009e4:	8d 40 08             	lea    0x8(%eax),%eax
+  8009e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ea:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8009ef:	e9 8b 00 00 00       	jmp    800a7f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8009f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f7:	8b 10                	mov    (%eax),%edx
+  8009f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009fe:	8d 40 04             	lea    0x4(%eax),%eax
+  800a01:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a04:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a09:	eb 74                	jmp    800a7f <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800a0b:	83 f9 01             	cmp    $0x1,%ecx
+  800a0e:	7f 1b                	jg     800a2b <vprintfmt+0x368>
+	else if (lflag)
+  800a10:	85 c9                	test   %ecx,%ecx
+  800a12:	74 2c                	je     800a40 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800a14:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a17:	8b 10                	mov    (%eax),%edx
+  800a19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a1e:	8d 40 04             	lea    0x4(%eax),%eax
+  800a21:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a24:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800a29:	eb 54                	jmp    800a7f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800a2b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a2e:	8b 10                	mov    (%eax),%edx
+  800a30:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a33:	8d 40 08             	lea    0x8(%eax),%eax
+  800a36:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a39:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800a3e:	eb 3f                	jmp    800a7f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a40:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a43:	8b 10                	mov    (%eax),%edx
+  800a45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a4a:	8d 40 04             	lea    0x4(%eax),%eax
+  800a4d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a50:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800a55:	eb 28                	jmp    800a7f <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800a57:	83 ec 08             	sub    $0x8,%esp
+  800a5a:	53                   	push   %ebx
+  800a5b:	6a 30                	push   $0x30
+  800a5d:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a5f:	83 c4 08             	add    $0x8,%esp
+  800a62:	53                   	push   %ebx
+  800a63:	6a 78                	push   $0x78
+  800a65:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a67:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6a:	8b 10                	mov    (%eax),%edx
+  800a6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a71:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a74:	8d 40 04             	lea    0x4(%eax),%eax
+  800a77:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a7a:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a7f:	83 ec 0c             	sub    $0xc,%esp
+  800a82:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a86:	50                   	push   %eax
+  800a87:	ff 75 e0             	push   -0x20(%ebp)
+  800a8a:	57                   	push   %edi
+  800a8b:	51                   	push   %ecx
+  800a8c:	52                   	push   %edx
+  800a8d:	89 da                	mov    %ebx,%edx
+  800a8f:	89 f0                	mov    %esi,%eax
+  800a91:	e8 4a fb ff ff       	call   8005e0 <printnum>
+			break;
+  800a96:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a99:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a9c:	e9 40 fc ff ff       	jmp    8006e1 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800aa1:	83 f9 01             	cmp    $0x1,%ecx
+  800aa4:	7f 1b                	jg     800ac1 <vprintfmt+0x3fe>
+	else if (lflag)
+  800aa6:	85 c9                	test   %ecx,%ecx
+  800aa8:	74 2c                	je     800ad6 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800aaa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aad:	8b 10                	mov    (%eax),%edx
+  800aaf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab4:	8d 40 04             	lea    0x4(%eax),%eax
+  800ab7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800aba:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800abf:	eb be                	jmp    800a7f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800ac1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac4:	8b 10                	mov    (%eax),%edx
+  800ac6:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ac9:	8d 40 08             	lea    0x8(%eax),%eax
+  800acc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800acf:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800ad4:	eb a9                	jmp    800a7f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800ad6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad9:	8b 10                	mov    (%eax),%edx
+  800adb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae0:	8d 40 04             	lea    0x4(%eax),%eax
+  800ae3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ae6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800aeb:	eb 92                	jmp    800a7f <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800aed:	83 ec 08             	sub    $0x8,%esp
+  800af0:	53                   	push   %ebx
+  800af1:	6a 25                	push   $0x25
+  800af3:	ff d6                	call   *%esi
+			break;
+  800af5:	83 c4 10             	add    $0x10,%esp
+  800af8:	eb 9f                	jmp    800a99 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800afa:	83 ec 08             	sub    $0x8,%esp
+  800afd:	53                   	push   %ebx
+  800afe:	6a 25                	push   $0x25
+  800b00:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b02:	83 c4 10             	add    $0x10,%esp
+  800b05:	89 f8                	mov    %edi,%eax
+  800b07:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b0b:	74 05                	je     800b12 <vprintfmt+0x44f>
+  800b0d:	83 e8 01             	sub    $0x1,%eax
+  800b10:	eb f5                	jmp    800b07 <vprintfmt+0x444>
+  800b12:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b15:	eb 82                	jmp    800a99 <vprintfmt+0x3d6>
+
+00800b17 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b17:	55                   	push   %ebp
+  800b18:	89 e5                	mov    %esp,%ebp
+  800b1a:	83 ec 18             	sub    $0x18,%esp
+  800b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b20:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b23:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b26:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b2a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b2d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b34:	85 c0                	test   %eax,%eax
+  800b36:	74 26                	je     800b5e <vsnprintf+0x47>
+  800b38:	85 d2                	test   %edx,%edx
+  800b3a:	7e 22                	jle    800b5e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b3c:	ff 75 14             	push   0x14(%ebp)
+  800b3f:	ff 75 10             	push   0x10(%ebp)
+  800b42:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b45:	50                   	push   %eax
+  800b46:	68 89 06 80 00       	push   $0x800689
+  800b4b:	e8 73 fb ff ff       	call   8006c3 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b50:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b53:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b59:	83 c4 10             	add    $0x10,%esp
+}
+  800b5c:	c9                   	leave
+  800b5d:	c3                   	ret
+		return -E_INVAL;
+  800b5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b63:	eb f7                	jmp    800b5c <vsnprintf+0x45>
+
+00800b65 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b65:	55                   	push   %ebp
+  800b66:	89 e5                	mov    %esp,%ebp
+  800b68:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b6b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b6e:	50                   	push   %eax
+  800b6f:	ff 75 10             	push   0x10(%ebp)
+  800b72:	ff 75 0c             	push   0xc(%ebp)
+  800b75:	ff 75 08             	push   0x8(%ebp)
+  800b78:	e8 9a ff ff ff       	call   800b17 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b7d:	c9                   	leave
+  800b7e:	c3                   	ret
+
+00800b7f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8a:	eb 03                	jmp    800b8f <strlen+0x10>
+		n++;
+  800b8c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b8f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b93:	75 f7                	jne    800b8c <strlen+0xd>
+	return n;
+}
+  800b95:	5d                   	pop    %ebp
+  800b96:	c3                   	ret
+
+00800b97 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b97:	55                   	push   %ebp
+  800b98:	89 e5                	mov    %esp,%ebp
+  800b9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba5:	eb 03                	jmp    800baa <strnlen+0x13>
+		n++;
+  800ba7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800baa:	39 d0                	cmp    %edx,%eax
+  800bac:	74 08                	je     800bb6 <strnlen+0x1f>
+  800bae:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bb2:	75 f3                	jne    800ba7 <strnlen+0x10>
+  800bb4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800bb6:	89 d0                	mov    %edx,%eax
+  800bb8:	5d                   	pop    %ebp
+  800bb9:	c3                   	ret
+
+00800bba <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bba:	55                   	push   %ebp
+  800bbb:	89 e5                	mov    %esp,%ebp
+  800bbd:	53                   	push   %ebx
+  800bbe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bc1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bcd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bd0:	83 c0 01             	add    $0x1,%eax
+  800bd3:	84 d2                	test   %dl,%dl
+  800bd5:	75 f2                	jne    800bc9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bd7:	89 c8                	mov    %ecx,%eax
+  800bd9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bdc:	c9                   	leave
+  800bdd:	c3                   	ret
+
+00800bde <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	53                   	push   %ebx
+  800be2:	83 ec 10             	sub    $0x10,%esp
+  800be5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800be8:	53                   	push   %ebx
+  800be9:	e8 91 ff ff ff       	call   800b7f <strlen>
+  800bee:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800bf1:	ff 75 0c             	push   0xc(%ebp)
+  800bf4:	01 d8                	add    %ebx,%eax
+  800bf6:	50                   	push   %eax
+  800bf7:	e8 be ff ff ff       	call   800bba <strcpy>
+	return dst;
+}
+  800bfc:	89 d8                	mov    %ebx,%eax
+  800bfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c01:	c9                   	leave
+  800c02:	c3                   	ret
+
+00800c03 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c03:	55                   	push   %ebp
+  800c04:	89 e5                	mov    %esp,%ebp
+  800c06:	56                   	push   %esi
+  800c07:	53                   	push   %ebx
+  800c08:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c0e:	89 f3                	mov    %esi,%ebx
+  800c10:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c13:	89 f0                	mov    %esi,%eax
+  800c15:	eb 0f                	jmp    800c26 <strncpy+0x23>
+		*dst++ = *src;
+  800c17:	83 c0 01             	add    $0x1,%eax
+  800c1a:	0f b6 0a             	movzbl (%edx),%ecx
+  800c1d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c20:	80 f9 01             	cmp    $0x1,%cl
+  800c23:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c26:	39 d8                	cmp    %ebx,%eax
+  800c28:	75 ed                	jne    800c17 <strncpy+0x14>
+	}
+	return ret;
+}
+  800c2a:	89 f0                	mov    %esi,%eax
+  800c2c:	5b                   	pop    %ebx
+  800c2d:	5e                   	pop    %esi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+
+00800c30 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	56                   	push   %esi
+  800c34:	53                   	push   %ebx
+  800c35:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c3e:	89 f0                	mov    %esi,%eax
+  800c40:	85 d2                	test   %edx,%edx
+  800c42:	74 21                	je     800c65 <strlcpy+0x35>
+  800c44:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c48:	89 f2                	mov    %esi,%edx
+  800c4a:	eb 09                	jmp    800c55 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c4c:	83 c1 01             	add    $0x1,%ecx
+  800c4f:	83 c2 01             	add    $0x1,%edx
+  800c52:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c55:	39 c2                	cmp    %eax,%edx
+  800c57:	74 09                	je     800c62 <strlcpy+0x32>
+  800c59:	0f b6 19             	movzbl (%ecx),%ebx
+  800c5c:	84 db                	test   %bl,%bl
+  800c5e:	75 ec                	jne    800c4c <strlcpy+0x1c>
+  800c60:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c62:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c65:	29 f0                	sub    %esi,%eax
+}
+  800c67:	5b                   	pop    %ebx
+  800c68:	5e                   	pop    %esi
+  800c69:	5d                   	pop    %ebp
+  800c6a:	c3                   	ret
+
+00800c6b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c6b:	55                   	push   %ebp
+  800c6c:	89 e5                	mov    %esp,%ebp
+  800c6e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c71:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c74:	eb 06                	jmp    800c7c <strcmp+0x11>
+		p++, q++;
+  800c76:	83 c1 01             	add    $0x1,%ecx
+  800c79:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c7c:	0f b6 01             	movzbl (%ecx),%eax
+  800c7f:	84 c0                	test   %al,%al
+  800c81:	74 04                	je     800c87 <strcmp+0x1c>
+  800c83:	3a 02                	cmp    (%edx),%al
+  800c85:	74 ef                	je     800c76 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c87:	0f b6 c0             	movzbl %al,%eax
+  800c8a:	0f b6 12             	movzbl (%edx),%edx
+  800c8d:	29 d0                	sub    %edx,%eax
+}
+  800c8f:	5d                   	pop    %ebp
+  800c90:	c3                   	ret
+
+00800c91 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c91:	55                   	push   %ebp
+  800c92:	89 e5                	mov    %esp,%ebp
+  800c94:	53                   	push   %ebx
+  800c95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c9e:	eb 09                	jmp    800ca9 <strncmp+0x18>
+		n--, p++, q++;
+  800ca0:	83 ea 01             	sub    $0x1,%edx
+  800ca3:	83 c0 01             	add    $0x1,%eax
+  800ca6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ca9:	85 d2                	test   %edx,%edx
+  800cab:	74 18                	je     800cc5 <strncmp+0x34>
+  800cad:	0f b6 18             	movzbl (%eax),%ebx
+  800cb0:	84 db                	test   %bl,%bl
+  800cb2:	74 04                	je     800cb8 <strncmp+0x27>
+  800cb4:	3a 19                	cmp    (%ecx),%bl
+  800cb6:	74 e8                	je     800ca0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cb8:	0f b6 00             	movzbl (%eax),%eax
+  800cbb:	0f b6 11             	movzbl (%ecx),%edx
+  800cbe:	29 d0                	sub    %edx,%eax
+}
+  800cc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cc3:	c9                   	leave
+  800cc4:	c3                   	ret
+		return 0;
+  800cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cca:	eb f4                	jmp    800cc0 <strncmp+0x2f>
+
+00800ccc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ccc:	55                   	push   %ebp
+  800ccd:	89 e5                	mov    %esp,%ebp
+  800ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cd6:	eb 03                	jmp    800cdb <strchr+0xf>
+  800cd8:	83 c0 01             	add    $0x1,%eax
+  800cdb:	0f b6 10             	movzbl (%eax),%edx
+  800cde:	84 d2                	test   %dl,%dl
+  800ce0:	74 06                	je     800ce8 <strchr+0x1c>
+		if (*s == c)
+  800ce2:	38 ca                	cmp    %cl,%dl
+  800ce4:	75 f2                	jne    800cd8 <strchr+0xc>
+  800ce6:	eb 05                	jmp    800ced <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ced:	5d                   	pop    %ebp
+  800cee:	c3                   	ret
+
+00800cef <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cef:	55                   	push   %ebp
+  800cf0:	89 e5                	mov    %esp,%ebp
+  800cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cf9:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cfc:	38 ca                	cmp    %cl,%dl
+  800cfe:	74 09                	je     800d09 <strfind+0x1a>
+  800d00:	84 d2                	test   %dl,%dl
+  800d02:	74 05                	je     800d09 <strfind+0x1a>
+	for (; *s; s++)
+  800d04:	83 c0 01             	add    $0x1,%eax
+  800d07:	eb f0                	jmp    800cf9 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d09:	5d                   	pop    %ebp
+  800d0a:	c3                   	ret
+
+00800d0b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d0b:	55                   	push   %ebp
+  800d0c:	89 e5                	mov    %esp,%ebp
+  800d0e:	57                   	push   %edi
+  800d0f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d12:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d15:	85 c9                	test   %ecx,%ecx
+  800d17:	74 20                	je     800d39 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d19:	89 f8                	mov    %edi,%eax
+  800d1b:	09 c8                	or     %ecx,%eax
+  800d1d:	a8 03                	test   $0x3,%al
+  800d1f:	75 12                	jne    800d33 <memset+0x28>
+		c &= 0xFF;
+  800d21:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d25:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d2b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d2e:	fc                   	cld
+  800d2f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d31:	eb 06                	jmp    800d39 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d33:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d36:	fc                   	cld
+  800d37:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d39:	89 f8                	mov    %edi,%eax
+  800d3b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d3e:	c9                   	leave
+  800d3f:	c3                   	ret
+
+00800d40 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	57                   	push   %edi
+  800d44:	56                   	push   %esi
+  800d45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d48:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d4b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d4e:	39 c6                	cmp    %eax,%esi
+  800d50:	73 32                	jae    800d84 <memmove+0x44>
+  800d52:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d55:	39 d0                	cmp    %edx,%eax
+  800d57:	73 2b                	jae    800d84 <memmove+0x44>
+		s += n;
+		d += n;
+  800d59:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d5c:	89 d6                	mov    %edx,%esi
+  800d5e:	09 fe                	or     %edi,%esi
+  800d60:	09 ce                	or     %ecx,%esi
+  800d62:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d68:	75 0e                	jne    800d78 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d6a:	83 ef 04             	sub    $0x4,%edi
+  800d6d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d70:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d73:	fd                   	std
+  800d74:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d76:	eb 09                	jmp    800d81 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d78:	83 ef 01             	sub    $0x1,%edi
+  800d7b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d7e:	fd                   	std
+  800d7f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d81:	fc                   	cld
+  800d82:	eb 1a                	jmp    800d9e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d84:	89 f2                	mov    %esi,%edx
+  800d86:	09 c2                	or     %eax,%edx
+  800d88:	09 ca                	or     %ecx,%edx
+  800d8a:	f6 c2 03             	test   $0x3,%dl
+  800d8d:	75 0a                	jne    800d99 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d8f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d92:	89 c7                	mov    %eax,%edi
+  800d94:	fc                   	cld
+  800d95:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d97:	eb 05                	jmp    800d9e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d99:	89 c7                	mov    %eax,%edi
+  800d9b:	fc                   	cld
+  800d9c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5f                   	pop    %edi
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+
+00800da2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800da2:	55                   	push   %ebp
+  800da3:	89 e5                	mov    %esp,%ebp
+  800da5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800da8:	ff 75 10             	push   0x10(%ebp)
+  800dab:	ff 75 0c             	push   0xc(%ebp)
+  800dae:	ff 75 08             	push   0x8(%ebp)
+  800db1:	e8 8a ff ff ff       	call   800d40 <memmove>
+}
+  800db6:	c9                   	leave
+  800db7:	c3                   	ret
+
+00800db8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800db8:	55                   	push   %ebp
+  800db9:	89 e5                	mov    %esp,%ebp
+  800dbb:	56                   	push   %esi
+  800dbc:	53                   	push   %ebx
+  800dbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800dc3:	89 c6                	mov    %eax,%esi
+  800dc5:	03 75 10             	add    0x10(%ebp),%esi
+  800dc8:	eb 06                	jmp    800dd0 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800dca:	83 c0 01             	add    $0x1,%eax
+  800dcd:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800dd0:	39 f0                	cmp    %esi,%eax
+  800dd2:	74 14                	je     800de8 <memcmp+0x30>
+		if (*s1 != *s2)
+  800dd4:	0f b6 08             	movzbl (%eax),%ecx
+  800dd7:	0f b6 1a             	movzbl (%edx),%ebx
+  800dda:	38 d9                	cmp    %bl,%cl
+  800ddc:	74 ec                	je     800dca <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800dde:	0f b6 c1             	movzbl %cl,%eax
+  800de1:	0f b6 db             	movzbl %bl,%ebx
+  800de4:	29 d8                	sub    %ebx,%eax
+  800de6:	eb 05                	jmp    800ded <memcmp+0x35>
+	}
+
+	return 0;
+  800de8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ded:	5b                   	pop    %ebx
+  800dee:	5e                   	pop    %esi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+
+00800df1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dfa:	89 c2                	mov    %eax,%edx
+  800dfc:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800dff:	eb 03                	jmp    800e04 <memfind+0x13>
+  800e01:	83 c0 01             	add    $0x1,%eax
+  800e04:	39 d0                	cmp    %edx,%eax
+  800e06:	73 04                	jae    800e0c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e08:	38 08                	cmp    %cl,(%eax)
+  800e0a:	75 f5                	jne    800e01 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+
+00800e0e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	57                   	push   %edi
+  800e12:	56                   	push   %esi
+  800e13:	53                   	push   %ebx
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e1a:	eb 03                	jmp    800e1f <strtol+0x11>
+		s++;
+  800e1c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e1f:	0f b6 02             	movzbl (%edx),%eax
+  800e22:	3c 20                	cmp    $0x20,%al
+  800e24:	74 f6                	je     800e1c <strtol+0xe>
+  800e26:	3c 09                	cmp    $0x9,%al
+  800e28:	74 f2                	je     800e1c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e2a:	3c 2b                	cmp    $0x2b,%al
+  800e2c:	74 2a                	je     800e58 <strtol+0x4a>
+	int neg = 0;
+  800e2e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e33:	3c 2d                	cmp    $0x2d,%al
+  800e35:	74 2b                	je     800e62 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e37:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e3d:	75 0f                	jne    800e4e <strtol+0x40>
+  800e3f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e42:	74 28                	je     800e6c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e44:	85 db                	test   %ebx,%ebx
+  800e46:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e4b:	0f 44 d8             	cmove  %eax,%ebx
+  800e4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e53:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e56:	eb 46                	jmp    800e9e <strtol+0x90>
+		s++;
+  800e58:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e60:	eb d5                	jmp    800e37 <strtol+0x29>
+		s++, neg = 1;
+  800e62:	83 c2 01             	add    $0x1,%edx
+  800e65:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e6a:	eb cb                	jmp    800e37 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e6c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e70:	74 0e                	je     800e80 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e72:	85 db                	test   %ebx,%ebx
+  800e74:	75 d8                	jne    800e4e <strtol+0x40>
+		s++, base = 8;
+  800e76:	83 c2 01             	add    $0x1,%edx
+  800e79:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e7e:	eb ce                	jmp    800e4e <strtol+0x40>
+		s += 2, base = 16;
+  800e80:	83 c2 02             	add    $0x2,%edx
+  800e83:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e88:	eb c4                	jmp    800e4e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e8a:	0f be c0             	movsbl %al,%eax
+  800e8d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e90:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e93:	7d 3a                	jge    800ecf <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e95:	83 c2 01             	add    $0x1,%edx
+  800e98:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e9c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e9e:	0f b6 02             	movzbl (%edx),%eax
+  800ea1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ea4:	89 f3                	mov    %esi,%ebx
+  800ea6:	80 fb 09             	cmp    $0x9,%bl
+  800ea9:	76 df                	jbe    800e8a <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800eab:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800eae:	89 f3                	mov    %esi,%ebx
+  800eb0:	80 fb 19             	cmp    $0x19,%bl
+  800eb3:	77 08                	ja     800ebd <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800eb5:	0f be c0             	movsbl %al,%eax
+  800eb8:	83 e8 57             	sub    $0x57,%eax
+  800ebb:	eb d3                	jmp    800e90 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ebd:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ec0:	89 f3                	mov    %esi,%ebx
+  800ec2:	80 fb 19             	cmp    $0x19,%bl
+  800ec5:	77 08                	ja     800ecf <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ec7:	0f be c0             	movsbl %al,%eax
+  800eca:	83 e8 37             	sub    $0x37,%eax
+  800ecd:	eb c1                	jmp    800e90 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ecf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ed3:	74 05                	je     800eda <strtol+0xcc>
+		*endptr = (char *) s;
+  800ed5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ed8:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800eda:	89 c8                	mov    %ecx,%eax
+  800edc:	f7 d8                	neg    %eax
+  800ede:	85 ff                	test   %edi,%edi
+  800ee0:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ee3:	89 c8                	mov    %ecx,%eax
+  800ee5:	5b                   	pop    %ebx
+  800ee6:	5e                   	pop    %esi
+  800ee7:	5f                   	pop    %edi
+  800ee8:	5d                   	pop    %ebp
+  800ee9:	c3                   	ret
+
+00800eea <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800eea:	55                   	push   %ebp
+  800eeb:	89 e5                	mov    %esp,%ebp
+  800eed:	57                   	push   %edi
+  800eee:	56                   	push   %esi
+  800eef:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efb:	89 c3                	mov    %eax,%ebx
+  800efd:	89 c7                	mov    %eax,%edi
+  800eff:	89 c6                	mov    %eax,%esi
+  800f01:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f03:	5b                   	pop    %ebx
+  800f04:	5e                   	pop    %esi
+  800f05:	5f                   	pop    %edi
+  800f06:	5d                   	pop    %ebp
+  800f07:	c3                   	ret
+
+00800f08 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	57                   	push   %edi
+  800f0c:	56                   	push   %esi
+  800f0d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f13:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f18:	89 d1                	mov    %edx,%ecx
+  800f1a:	89 d3                	mov    %edx,%ebx
+  800f1c:	89 d7                	mov    %edx,%edi
+  800f1e:	89 d6                	mov    %edx,%esi
+  800f20:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f22:	5b                   	pop    %ebx
+  800f23:	5e                   	pop    %esi
+  800f24:	5f                   	pop    %edi
+  800f25:	5d                   	pop    %ebp
+  800f26:	c3                   	ret
+
+00800f27 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	57                   	push   %edi
+  800f2b:	56                   	push   %esi
+  800f2c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f35:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f3a:	89 cb                	mov    %ecx,%ebx
+  800f3c:	89 cf                	mov    %ecx,%edi
+  800f3e:	89 ce                	mov    %ecx,%esi
+  800f40:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800f42:	5b                   	pop    %ebx
+  800f43:	5e                   	pop    %esi
+  800f44:	5f                   	pop    %edi
+  800f45:	5d                   	pop    %ebp
+  800f46:	c3                   	ret
+
+00800f47 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f47:	55                   	push   %ebp
+  800f48:	89 e5                	mov    %esp,%ebp
+  800f4a:	57                   	push   %edi
+  800f4b:	56                   	push   %esi
+  800f4c:	53                   	push   %ebx
+  800f4d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f58:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f5d:	89 cb                	mov    %ecx,%ebx
+  800f5f:	89 cf                	mov    %ecx,%edi
+  800f61:	89 ce                	mov    %ecx,%esi
+  800f63:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f65:	85 c0                	test   %eax,%eax
+  800f67:	7f 08                	jg     800f71 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f6c:	5b                   	pop    %ebx
+  800f6d:	5e                   	pop    %esi
+  800f6e:	5f                   	pop    %edi
+  800f6f:	5d                   	pop    %ebp
+  800f70:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f71:	83 ec 0c             	sub    $0xc,%esp
+  800f74:	50                   	push   %eax
+  800f75:	6a 03                	push   $0x3
+  800f77:	68 3f 2f 80 00       	push   $0x802f3f
+  800f7c:	6a 23                	push   $0x23
+  800f7e:	68 5c 2f 80 00       	push   $0x802f5c
+  800f83:	e8 d5 15 00 00       	call   80255d <_panic>
+
+00800f88 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	57                   	push   %edi
+  800f8c:	56                   	push   %esi
+  800f8d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f93:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f98:	89 d1                	mov    %edx,%ecx
+  800f9a:	89 d3                	mov    %edx,%ebx
+  800f9c:	89 d7                	mov    %edx,%edi
+  800f9e:	89 d6                	mov    %edx,%esi
+  800fa0:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5e                   	pop    %esi
+  800fa4:	5f                   	pop    %edi
+  800fa5:	5d                   	pop    %ebp
+  800fa6:	c3                   	ret
+
+00800fa7 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800fa7:	55                   	push   %ebp
+  800fa8:	89 e5                	mov    %esp,%ebp
+  800faa:	57                   	push   %edi
+  800fab:	56                   	push   %esi
+  800fac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fad:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb2:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fb7:	89 d1                	mov    %edx,%ecx
+  800fb9:	89 d3                	mov    %edx,%ebx
+  800fbb:	89 d7                	mov    %edx,%edi
+  800fbd:	89 d6                	mov    %edx,%esi
+  800fbf:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fc1:	5b                   	pop    %ebx
+  800fc2:	5e                   	pop    %esi
+  800fc3:	5f                   	pop    %edi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+
+00800fc6 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	57                   	push   %edi
+  800fca:	56                   	push   %esi
+  800fcb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fd6:	89 d1                	mov    %edx,%ecx
+  800fd8:	89 d3                	mov    %edx,%ebx
+  800fda:	89 d7                	mov    %edx,%edi
+  800fdc:	89 d6                	mov    %edx,%esi
+  800fde:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800fe0:	5b                   	pop    %ebx
+  800fe1:	5e                   	pop    %esi
+  800fe2:	5f                   	pop    %edi
+  800fe3:	5d                   	pop    %ebp
+  800fe4:	c3                   	ret
+
+00800fe5 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800fe5:	55                   	push   %ebp
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	57                   	push   %edi
+  800fe9:	56                   	push   %esi
+  800fea:	53                   	push   %ebx
+  800feb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff9:	b8 15 00 00 00       	mov    $0x15,%eax
+  800ffe:	89 df                	mov    %ebx,%edi
+  801000:	89 de                	mov    %ebx,%esi
+  801002:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801004:	85 c0                	test   %eax,%eax
+  801006:	7f 08                	jg     801010 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  801008:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100b:	5b                   	pop    %ebx
+  80100c:	5e                   	pop    %esi
+  80100d:	5f                   	pop    %edi
+  80100e:	5d                   	pop    %ebp
+  80100f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801010:	83 ec 0c             	sub    $0xc,%esp
+  801013:	50                   	push   %eax
+  801014:	6a 15                	push   $0x15
+  801016:	68 3f 2f 80 00       	push   $0x802f3f
+  80101b:	6a 23                	push   $0x23
+  80101d:	68 5c 2f 80 00       	push   $0x802f5c
+  801022:	e8 36 15 00 00       	call   80255d <_panic>
+
+00801027 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	56                   	push   %esi
+  80102c:	53                   	push   %ebx
+  80102d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801030:	be 00 00 00 00       	mov    $0x0,%esi
+  801035:	8b 55 08             	mov    0x8(%ebp),%edx
+  801038:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801040:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801043:	89 f7                	mov    %esi,%edi
+  801045:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801047:	85 c0                	test   %eax,%eax
+  801049:	7f 08                	jg     801053 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80104b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104e:	5b                   	pop    %ebx
+  80104f:	5e                   	pop    %esi
+  801050:	5f                   	pop    %edi
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801053:	83 ec 0c             	sub    $0xc,%esp
+  801056:	50                   	push   %eax
+  801057:	6a 05                	push   $0x5
+  801059:	68 3f 2f 80 00       	push   $0x802f3f
+  80105e:	6a 23                	push   $0x23
+  801060:	68 5c 2f 80 00       	push   $0x802f5c
+  801065:	e8 f3 14 00 00       	call   80255d <_panic>
+
+0080106a <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  80106a:	55                   	push   %ebp
+  80106b:	89 e5                	mov    %esp,%ebp
+  80106d:	57                   	push   %edi
+  80106e:	56                   	push   %esi
+  80106f:	53                   	push   %ebx
+  801070:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801073:	be 00 00 00 00       	mov    $0x0,%esi
+  801078:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801083:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801086:	89 f7                	mov    %esi,%edi
+  801088:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80108a:	85 c0                	test   %eax,%eax
+  80108c:	7f 08                	jg     801096 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80108e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801091:	5b                   	pop    %ebx
+  801092:	5e                   	pop    %esi
+  801093:	5f                   	pop    %edi
+  801094:	5d                   	pop    %ebp
+  801095:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801096:	83 ec 0c             	sub    $0xc,%esp
+  801099:	50                   	push   %eax
+  80109a:	6a 06                	push   $0x6
+  80109c:	68 3f 2f 80 00       	push   $0x802f3f
+  8010a1:	6a 23                	push   $0x23
+  8010a3:	68 5c 2f 80 00       	push   $0x802f5c
+  8010a8:	e8 b0 14 00 00       	call   80255d <_panic>
+
+008010ad <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	57                   	push   %edi
+  8010b1:	56                   	push   %esi
+  8010b2:	53                   	push   %ebx
+  8010b3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bc:	b8 07 00 00 00       	mov    $0x7,%eax
+  8010c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010ca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010cc:	85 c0                	test   %eax,%eax
+  8010ce:	7f 08                	jg     8010d8 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8010d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d3:	5b                   	pop    %ebx
+  8010d4:	5e                   	pop    %esi
+  8010d5:	5f                   	pop    %edi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d8:	83 ec 0c             	sub    $0xc,%esp
+  8010db:	50                   	push   %eax
+  8010dc:	6a 07                	push   $0x7
+  8010de:	68 3f 2f 80 00       	push   $0x802f3f
+  8010e3:	6a 23                	push   $0x23
+  8010e5:	68 5c 2f 80 00       	push   $0x802f5c
+  8010ea:	e8 6e 14 00 00       	call   80255d <_panic>
+
+008010ef <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8010ef:	55                   	push   %ebp
+  8010f0:	89 e5                	mov    %esp,%ebp
+  8010f2:	57                   	push   %edi
+  8010f3:	56                   	push   %esi
+  8010f4:	53                   	push   %ebx
+  8010f5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801100:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801103:	b8 08 00 00 00       	mov    $0x8,%eax
+  801108:	89 df                	mov    %ebx,%edi
+  80110a:	89 de                	mov    %ebx,%esi
+  80110c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80110e:	85 c0                	test   %eax,%eax
+  801110:	7f 08                	jg     80111a <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801112:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801115:	5b                   	pop    %ebx
+  801116:	5e                   	pop    %esi
+  801117:	5f                   	pop    %edi
+  801118:	5d                   	pop    %ebp
+  801119:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111a:	83 ec 0c             	sub    $0xc,%esp
+  80111d:	50                   	push   %eax
+  80111e:	6a 08                	push   $0x8
+  801120:	68 3f 2f 80 00       	push   $0x802f3f
+  801125:	6a 23                	push   $0x23
+  801127:	68 5c 2f 80 00       	push   $0x802f5c
+  80112c:	e8 2c 14 00 00       	call   80255d <_panic>
+
+00801131 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  801131:	55                   	push   %ebp
+  801132:	89 e5                	mov    %esp,%ebp
+  801134:	57                   	push   %edi
+  801135:	56                   	push   %esi
+  801136:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801137:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801142:	be 00 00 00 00       	mov    $0x0,%esi
+  801147:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80114a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80114d:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  80114f:	5b                   	pop    %ebx
+  801150:	5e                   	pop    %esi
+  801151:	5f                   	pop    %edi
+  801152:	5d                   	pop    %ebp
+  801153:	c3                   	ret
+
+00801154 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801154:	55                   	push   %ebp
+  801155:	89 e5                	mov    %esp,%ebp
+  801157:	57                   	push   %edi
+  801158:	56                   	push   %esi
+  801159:	53                   	push   %ebx
+  80115a:	8b 45 18             	mov    0x18(%ebp),%eax
+  80115d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  801160:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  801165:	77 27                	ja     80118e <sys_page_map_range+0x3a>
+  801167:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80116d:	77 1f                	ja     80118e <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  80116f:	c1 e0 0c             	shl    $0xc,%eax
+  801172:	89 c6                	mov    %eax,%esi
+  801174:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  801176:	8b 55 08             	mov    0x8(%ebp),%edx
+  801179:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801181:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801184:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801187:	cd 30                	int    $0x30
+}
+  801189:	5b                   	pop    %ebx
+  80118a:	5e                   	pop    %esi
+  80118b:	5f                   	pop    %edi
+  80118c:	5d                   	pop    %ebp
+  80118d:	c3                   	ret
+		return -E_INVAL;
+  80118e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801193:	eb f4                	jmp    801189 <sys_page_map_range+0x35>
+
+00801195 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801195:	55                   	push   %ebp
+  801196:	89 e5                	mov    %esp,%ebp
+  801198:	57                   	push   %edi
+  801199:	56                   	push   %esi
+  80119a:	53                   	push   %ebx
+  80119b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80119e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011b6:	85 c0                	test   %eax,%eax
+  8011b8:	7f 08                	jg     8011c2 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8011ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011bd:	5b                   	pop    %ebx
+  8011be:	5e                   	pop    %esi
+  8011bf:	5f                   	pop    %edi
+  8011c0:	5d                   	pop    %ebp
+  8011c1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011c2:	83 ec 0c             	sub    $0xc,%esp
+  8011c5:	50                   	push   %eax
+  8011c6:	6a 0c                	push   $0xc
+  8011c8:	68 3f 2f 80 00       	push   $0x802f3f
+  8011cd:	6a 23                	push   $0x23
+  8011cf:	68 5c 2f 80 00       	push   $0x802f5c
+  8011d4:	e8 84 13 00 00       	call   80255d <_panic>
+
+008011d9 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8011d9:	55                   	push   %ebp
+  8011da:	89 e5                	mov    %esp,%ebp
+  8011dc:	57                   	push   %edi
+  8011dd:	56                   	push   %esi
+  8011de:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011df:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ea:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8011ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f2:	89 f7                	mov    %esi,%edi
+  8011f4:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8011f6:	5b                   	pop    %ebx
+  8011f7:	5e                   	pop    %esi
+  8011f8:	5f                   	pop    %edi
+  8011f9:	5d                   	pop    %ebp
+  8011fa:	c3                   	ret
+
+008011fb <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	57                   	push   %edi
+  8011ff:	56                   	push   %esi
+  801200:	53                   	push   %ebx
+  801201:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801204:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801209:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801214:	89 df                	mov    %ebx,%edi
+  801216:	89 de                	mov    %ebx,%esi
+  801218:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80121a:	85 c0                	test   %eax,%eax
+  80121c:	7f 08                	jg     801226 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80121e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801221:	5b                   	pop    %ebx
+  801222:	5e                   	pop    %esi
+  801223:	5f                   	pop    %edi
+  801224:	5d                   	pop    %ebp
+  801225:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801226:	83 ec 0c             	sub    $0xc,%esp
+  801229:	50                   	push   %eax
+  80122a:	6a 0f                	push   $0xf
+  80122c:	68 3f 2f 80 00       	push   $0x802f3f
+  801231:	6a 23                	push   $0x23
+  801233:	68 5c 2f 80 00       	push   $0x802f5c
+  801238:	e8 20 13 00 00       	call   80255d <_panic>
+
+0080123d <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80123d:	55                   	push   %ebp
+  80123e:	89 e5                	mov    %esp,%ebp
+  801240:	57                   	push   %edi
+  801241:	56                   	push   %esi
+  801242:	53                   	push   %ebx
+  801243:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801246:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801251:	b8 10 00 00 00       	mov    $0x10,%eax
+  801256:	89 df                	mov    %ebx,%edi
+  801258:	89 de                	mov    %ebx,%esi
+  80125a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80125c:	85 c0                	test   %eax,%eax
+  80125e:	7f 08                	jg     801268 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  801260:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801263:	5b                   	pop    %ebx
+  801264:	5e                   	pop    %esi
+  801265:	5f                   	pop    %edi
+  801266:	5d                   	pop    %ebp
+  801267:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801268:	83 ec 0c             	sub    $0xc,%esp
+  80126b:	50                   	push   %eax
+  80126c:	6a 10                	push   $0x10
+  80126e:	68 3f 2f 80 00       	push   $0x802f3f
+  801273:	6a 23                	push   $0x23
+  801275:	68 5c 2f 80 00       	push   $0x802f5c
+  80127a:	e8 de 12 00 00       	call   80255d <_panic>
+
+0080127f <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80127f:	55                   	push   %ebp
+  801280:	89 e5                	mov    %esp,%ebp
+  801282:	57                   	push   %edi
+  801283:	56                   	push   %esi
+  801284:	53                   	push   %ebx
+  801285:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801288:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801290:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801293:	b8 11 00 00 00       	mov    $0x11,%eax
+  801298:	89 df                	mov    %ebx,%edi
+  80129a:	89 de                	mov    %ebx,%esi
+  80129c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80129e:	85 c0                	test   %eax,%eax
+  8012a0:	7f 08                	jg     8012aa <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  8012a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a5:	5b                   	pop    %ebx
+  8012a6:	5e                   	pop    %esi
+  8012a7:	5f                   	pop    %edi
+  8012a8:	5d                   	pop    %ebp
+  8012a9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012aa:	83 ec 0c             	sub    $0xc,%esp
+  8012ad:	50                   	push   %eax
+  8012ae:	6a 11                	push   $0x11
+  8012b0:	68 3f 2f 80 00       	push   $0x802f3f
+  8012b5:	6a 23                	push   $0x23
+  8012b7:	68 5c 2f 80 00       	push   $0x802f5c
+  8012bc:	e8 9c 12 00 00       	call   80255d <_panic>
+
+008012c1 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  8012c1:	55                   	push   %ebp
+  8012c2:	89 e5                	mov    %esp,%ebp
+  8012c4:	57                   	push   %edi
+  8012c5:	56                   	push   %esi
+  8012c6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012cc:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012d1:	89 d1                	mov    %edx,%ecx
+  8012d3:	89 d3                	mov    %edx,%ebx
+  8012d5:	89 d7                	mov    %edx,%edi
+  8012d7:	89 d6                	mov    %edx,%esi
+  8012d9:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  8012db:	5b                   	pop    %ebx
+  8012dc:	5e                   	pop    %esi
+  8012dd:	5f                   	pop    %edi
+  8012de:	5d                   	pop    %ebp
+  8012df:	c3                   	ret
+
+008012e0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+  8012e3:	57                   	push   %edi
+  8012e4:	56                   	push   %esi
+  8012e5:	53                   	push   %ebx
+  8012e6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012f9:	89 df                	mov    %ebx,%edi
+  8012fb:	89 de                	mov    %ebx,%esi
+  8012fd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	7f 08                	jg     80130b <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801303:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801306:	5b                   	pop    %ebx
+  801307:	5e                   	pop    %esi
+  801308:	5f                   	pop    %edi
+  801309:	5d                   	pop    %ebp
+  80130a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80130b:	83 ec 0c             	sub    $0xc,%esp
+  80130e:	50                   	push   %eax
+  80130f:	6a 13                	push   $0x13
+  801311:	68 3f 2f 80 00       	push   $0x802f3f
+  801316:	6a 23                	push   $0x23
+  801318:	68 5c 2f 80 00       	push   $0x802f5c
+  80131d:	e8 3b 12 00 00       	call   80255d <_panic>
+
+00801322 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801322:	55                   	push   %ebp
+  801323:	89 e5                	mov    %esp,%ebp
+  801325:	57                   	push   %edi
+  801326:	56                   	push   %esi
+  801327:	53                   	push   %ebx
+  801328:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80132b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801330:	8b 55 08             	mov    0x8(%ebp),%edx
+  801333:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801336:	b8 14 00 00 00       	mov    $0x14,%eax
+  80133b:	89 df                	mov    %ebx,%edi
+  80133d:	89 de                	mov    %ebx,%esi
+  80133f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801341:	85 c0                	test   %eax,%eax
+  801343:	7f 08                	jg     80134d <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801348:	5b                   	pop    %ebx
+  801349:	5e                   	pop    %esi
+  80134a:	5f                   	pop    %edi
+  80134b:	5d                   	pop    %ebp
+  80134c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80134d:	83 ec 0c             	sub    $0xc,%esp
+  801350:	50                   	push   %eax
+  801351:	6a 14                	push   $0x14
+  801353:	68 3f 2f 80 00       	push   $0x802f3f
+  801358:	6a 23                	push   $0x23
+  80135a:	68 5c 2f 80 00       	push   $0x802f5c
+  80135f:	e8 f9 11 00 00       	call   80255d <_panic>
+
+00801364 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801364:	55                   	push   %ebp
+  801365:	89 e5                	mov    %esp,%ebp
+  801367:	57                   	push   %edi
+  801368:	56                   	push   %esi
+  801369:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80136a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801370:	b8 17 00 00 00       	mov    $0x17,%eax
+  801375:	be 00 00 00 00       	mov    $0x0,%esi
+  80137a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80137d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801380:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801382:	5b                   	pop    %ebx
+  801383:	5e                   	pop    %esi
+  801384:	5f                   	pop    %edi
+  801385:	5d                   	pop    %ebp
+  801386:	c3                   	ret
+
+00801387 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	57                   	push   %edi
+  80138b:	56                   	push   %esi
+  80138c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80138d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801390:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801393:	b8 18 00 00 00       	mov    $0x18,%eax
+  801398:	be 00 00 00 00       	mov    $0x0,%esi
+  80139d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013a3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8013a5:	5b                   	pop    %ebx
+  8013a6:	5e                   	pop    %esi
+  8013a7:	5f                   	pop    %edi
+  8013a8:	5d                   	pop    %ebp
+  8013a9:	c3                   	ret
+
+008013aa <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8013aa:	55                   	push   %ebp
+  8013ab:	89 e5                	mov    %esp,%ebp
+  8013ad:	57                   	push   %edi
+  8013ae:	56                   	push   %esi
+  8013af:	53                   	push   %ebx
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bb:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013c0:	89 cb                	mov    %ecx,%ebx
+  8013c2:	89 cf                	mov    %ecx,%edi
+  8013c4:	89 ce                	mov    %ecx,%esi
+  8013c6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013c8:	85 c0                	test   %eax,%eax
+  8013ca:	7f 08                	jg     8013d4 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8013cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013cf:	5b                   	pop    %ebx
+  8013d0:	5e                   	pop    %esi
+  8013d1:	5f                   	pop    %edi
+  8013d2:	5d                   	pop    %ebp
+  8013d3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013d4:	83 ec 0c             	sub    $0xc,%esp
+  8013d7:	50                   	push   %eax
+  8013d8:	6a 19                	push   $0x19
+  8013da:	68 3f 2f 80 00       	push   $0x802f3f
+  8013df:	6a 23                	push   $0x23
+  8013e1:	68 5c 2f 80 00       	push   $0x802f5c
+  8013e6:	e8 72 11 00 00       	call   80255d <_panic>
+
+008013eb <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8013eb:	55                   	push   %ebp
+  8013ec:	89 e5                	mov    %esp,%ebp
+  8013ee:	57                   	push   %edi
+  8013ef:	56                   	push   %esi
+  8013f0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013fb:	89 d1                	mov    %edx,%ecx
+  8013fd:	89 d3                	mov    %edx,%ebx
+  8013ff:	89 d7                	mov    %edx,%edi
+  801401:	89 d6                	mov    %edx,%esi
+  801403:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801405:	5b                   	pop    %ebx
+  801406:	5e                   	pop    %esi
+  801407:	5f                   	pop    %edi
+  801408:	5d                   	pop    %ebp
+  801409:	c3                   	ret
+
+0080140a <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  80140a:	55                   	push   %ebp
+  80140b:	89 e5                	mov    %esp,%ebp
+  80140d:	57                   	push   %edi
+  80140e:	56                   	push   %esi
+  80140f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801410:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801415:	8b 55 08             	mov    0x8(%ebp),%edx
+  801418:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801420:	89 df                	mov    %ebx,%edi
+  801422:	89 de                	mov    %ebx,%esi
+  801424:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801426:	5b                   	pop    %ebx
+  801427:	5e                   	pop    %esi
+  801428:	5f                   	pop    %edi
+  801429:	5d                   	pop    %ebp
+  80142a:	c3                   	ret
+
+0080142b <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  80142b:	55                   	push   %ebp
+  80142c:	89 e5                	mov    %esp,%ebp
+  80142e:	57                   	push   %edi
+  80142f:	56                   	push   %esi
+  801430:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801431:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801436:	8b 55 08             	mov    0x8(%ebp),%edx
+  801439:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801441:	89 df                	mov    %ebx,%edi
+  801443:	89 de                	mov    %ebx,%esi
+  801445:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801447:	5b                   	pop    %ebx
+  801448:	5e                   	pop    %esi
+  801449:	5f                   	pop    %edi
+  80144a:	5d                   	pop    %ebp
+  80144b:	c3                   	ret
+
+0080144c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80144c:	55                   	push   %ebp
+  80144d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80144f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801452:	05 00 00 00 30       	add    $0x30000000,%eax
+  801457:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80145a:	5d                   	pop    %ebp
+  80145b:	c3                   	ret
+
+0080145c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80145c:	55                   	push   %ebp
+  80145d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80145f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801462:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801467:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80146c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801471:	5d                   	pop    %ebp
+  801472:	c3                   	ret
+
+00801473 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801473:	55                   	push   %ebp
+  801474:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801476:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80147b:	eb 02                	jmp    80147f <fd_alloc+0xc>
+  80147d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80147f:	89 c2                	mov    %eax,%edx
+  801481:	c1 ea 16             	shr    $0x16,%edx
+  801484:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80148b:	f6 c2 01             	test   $0x1,%dl
+  80148e:	74 2b                	je     8014bb <fd_alloc+0x48>
+  801490:	89 c2                	mov    %eax,%edx
+  801492:	c1 ea 0c             	shr    $0xc,%edx
+  801495:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80149c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8014a2:	f6 c1 01             	test   $0x1,%cl
+  8014a5:	74 14                	je     8014bb <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8014a7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8014ad:	75 ce                	jne    80147d <fd_alloc+0xa>
+  8014af:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8014b4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8014b9:	eb 05                	jmp    8014c0 <fd_alloc+0x4d>
+			return 0;
+  8014bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8014c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c3:	89 02                	mov    %eax,(%edx)
+}
+  8014c5:	89 c8                	mov    %ecx,%eax
+  8014c7:	5d                   	pop    %ebp
+  8014c8:	c3                   	ret
+
+008014c9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8014c9:	55                   	push   %ebp
+  8014ca:	89 e5                	mov    %esp,%ebp
+  8014cc:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8014cf:	83 f8 1f             	cmp    $0x1f,%eax
+  8014d2:	77 30                	ja     801504 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8014d4:	c1 e0 0c             	shl    $0xc,%eax
+  8014d7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8014dc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8014e2:	f6 c2 01             	test   $0x1,%dl
+  8014e5:	74 24                	je     80150b <fd_lookup+0x42>
+  8014e7:	89 c2                	mov    %eax,%edx
+  8014e9:	c1 ea 0c             	shr    $0xc,%edx
+  8014ec:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8014f3:	f6 c2 01             	test   $0x1,%dl
+  8014f6:	74 1a                	je     801512 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8014f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014fb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8014fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801502:	5d                   	pop    %ebp
+  801503:	c3                   	ret
+		return -E_INVAL;
+  801504:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801509:	eb f7                	jmp    801502 <fd_lookup+0x39>
+		return -E_INVAL;
+  80150b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801510:	eb f0                	jmp    801502 <fd_lookup+0x39>
+  801512:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801517:	eb e9                	jmp    801502 <fd_lookup+0x39>
+
+00801519 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801519:	55                   	push   %ebp
+  80151a:	89 e5                	mov    %esp,%ebp
+  80151c:	53                   	push   %ebx
+  80151d:	83 ec 04             	sub    $0x4,%esp
+  801520:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801523:	b8 00 00 00 00       	mov    $0x0,%eax
+  801528:	eb 03                	jmp    80152d <dev_lookup+0x14>
+  80152a:	83 c0 01             	add    $0x1,%eax
+  80152d:	8b 1c 85 e8 2f 80 00 	mov    0x802fe8(,%eax,4),%ebx
+  801534:	85 db                	test   %ebx,%ebx
+  801536:	74 0b                	je     801543 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801538:	39 13                	cmp    %edx,(%ebx)
+  80153a:	75 ee                	jne    80152a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80153c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801541:	eb 1f                	jmp    801562 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801543:	a1 18 50 80 00       	mov    0x805018,%eax
+  801548:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80154b:	83 ec 04             	sub    $0x4,%esp
+  80154e:	52                   	push   %edx
+  80154f:	50                   	push   %eax
+  801550:	68 6c 2f 80 00       	push   $0x802f6c
+  801555:	e8 72 f0 ff ff       	call   8005cc <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80155a:	83 c4 10             	add    $0x10,%esp
+  80155d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801562:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801565:	89 1a                	mov    %ebx,(%edx)
+}
+  801567:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80156a:	c9                   	leave
+  80156b:	c3                   	ret
+
+0080156c <fd_close>:
+{
+  80156c:	55                   	push   %ebp
+  80156d:	89 e5                	mov    %esp,%ebp
+  80156f:	57                   	push   %edi
+  801570:	56                   	push   %esi
+  801571:	53                   	push   %ebx
+  801572:	83 ec 24             	sub    $0x24,%esp
+  801575:	8b 75 08             	mov    0x8(%ebp),%esi
+  801578:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80157b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80157e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80157f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801585:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801588:	50                   	push   %eax
+  801589:	e8 3b ff ff ff       	call   8014c9 <fd_lookup>
+  80158e:	89 c3                	mov    %eax,%ebx
+  801590:	83 c4 10             	add    $0x10,%esp
+  801593:	85 c0                	test   %eax,%eax
+  801595:	78 05                	js     80159c <fd_close+0x30>
+	    || fd != fd2)
+  801597:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80159a:	74 16                	je     8015b2 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80159c:	89 f8                	mov    %edi,%eax
+  80159e:	84 c0                	test   %al,%al
+  8015a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a5:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8015a8:	89 d8                	mov    %ebx,%eax
+  8015aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ad:	5b                   	pop    %ebx
+  8015ae:	5e                   	pop    %esi
+  8015af:	5f                   	pop    %edi
+  8015b0:	5d                   	pop    %ebp
+  8015b1:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8015b2:	83 ec 08             	sub    $0x8,%esp
+  8015b5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8015b8:	50                   	push   %eax
+  8015b9:	ff 36                	push   (%esi)
+  8015bb:	e8 59 ff ff ff       	call   801519 <dev_lookup>
+  8015c0:	89 c3                	mov    %eax,%ebx
+  8015c2:	83 c4 10             	add    $0x10,%esp
+  8015c5:	85 c0                	test   %eax,%eax
+  8015c7:	78 1a                	js     8015e3 <fd_close+0x77>
+		if (dev->dev_close)
+  8015c9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015cc:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8015cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8015d4:	85 c0                	test   %eax,%eax
+  8015d6:	74 0b                	je     8015e3 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8015d8:	83 ec 0c             	sub    $0xc,%esp
+  8015db:	56                   	push   %esi
+  8015dc:	ff d0                	call   *%eax
+  8015de:	89 c3                	mov    %eax,%ebx
+  8015e0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8015e3:	83 ec 08             	sub    $0x8,%esp
+  8015e6:	56                   	push   %esi
+  8015e7:	6a 00                	push   $0x0
+  8015e9:	e8 01 fb ff ff       	call   8010ef <sys_page_unmap>
+	return r;
+  8015ee:	83 c4 10             	add    $0x10,%esp
+  8015f1:	eb b5                	jmp    8015a8 <fd_close+0x3c>
+
+008015f3 <close>:
+
+int
+close(int fdnum)
+{
+  8015f3:	55                   	push   %ebp
+  8015f4:	89 e5                	mov    %esp,%ebp
+  8015f6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015fc:	50                   	push   %eax
+  8015fd:	ff 75 08             	push   0x8(%ebp)
+  801600:	e8 c4 fe ff ff       	call   8014c9 <fd_lookup>
+  801605:	83 c4 10             	add    $0x10,%esp
+  801608:	85 c0                	test   %eax,%eax
+  80160a:	79 02                	jns    80160e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80160c:	c9                   	leave
+  80160d:	c3                   	ret
+		return fd_close(fd, 1);
+  80160e:	83 ec 08             	sub    $0x8,%esp
+  801611:	6a 01                	push   $0x1
+  801613:	ff 75 f4             	push   -0xc(%ebp)
+  801616:	e8 51 ff ff ff       	call   80156c <fd_close>
+  80161b:	83 c4 10             	add    $0x10,%esp
+  80161e:	eb ec                	jmp    80160c <close+0x19>
+
+00801620 <close_all>:
+
+void
+close_all(void)
+{
+  801620:	55                   	push   %ebp
+  801621:	89 e5                	mov    %esp,%ebp
+  801623:	53                   	push   %ebx
+  801624:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801627:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80162c:	83 ec 0c             	sub    $0xc,%esp
+  80162f:	53                   	push   %ebx
+  801630:	e8 be ff ff ff       	call   8015f3 <close>
+	for (i = 0; i < MAXFD; i++)
+  801635:	83 c3 01             	add    $0x1,%ebx
+  801638:	83 c4 10             	add    $0x10,%esp
+  80163b:	83 fb 20             	cmp    $0x20,%ebx
+  80163e:	75 ec                	jne    80162c <close_all+0xc>
+}
+  801640:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801643:	c9                   	leave
+  801644:	c3                   	ret
+
+00801645 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801645:	55                   	push   %ebp
+  801646:	89 e5                	mov    %esp,%ebp
+  801648:	57                   	push   %edi
+  801649:	56                   	push   %esi
+  80164a:	53                   	push   %ebx
+  80164b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80164e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801651:	50                   	push   %eax
+  801652:	ff 75 08             	push   0x8(%ebp)
+  801655:	e8 6f fe ff ff       	call   8014c9 <fd_lookup>
+  80165a:	89 c3                	mov    %eax,%ebx
+  80165c:	83 c4 10             	add    $0x10,%esp
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	78 7f                	js     8016e2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801663:	83 ec 0c             	sub    $0xc,%esp
+  801666:	ff 75 0c             	push   0xc(%ebp)
+  801669:	e8 85 ff ff ff       	call   8015f3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80166e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801671:	c1 e6 0c             	shl    $0xc,%esi
+  801674:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80167a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80167d:	89 3c 24             	mov    %edi,(%esp)
+  801680:	e8 d7 fd ff ff       	call   80145c <fd2data>
+  801685:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801687:	89 34 24             	mov    %esi,(%esp)
+  80168a:	e8 cd fd ff ff       	call   80145c <fd2data>
+  80168f:	83 c4 10             	add    $0x10,%esp
+  801692:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801695:	89 d8                	mov    %ebx,%eax
+  801697:	c1 e8 16             	shr    $0x16,%eax
+  80169a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016a1:	a8 01                	test   $0x1,%al
+  8016a3:	74 11                	je     8016b6 <dup+0x71>
+  8016a5:	89 d8                	mov    %ebx,%eax
+  8016a7:	c1 e8 0c             	shr    $0xc,%eax
+  8016aa:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016b1:	f6 c2 01             	test   $0x1,%dl
+  8016b4:	75 36                	jne    8016ec <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8016b6:	89 f8                	mov    %edi,%eax
+  8016b8:	c1 e8 0c             	shr    $0xc,%eax
+  8016bb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016c2:	83 ec 0c             	sub    $0xc,%esp
+  8016c5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016ca:	50                   	push   %eax
+  8016cb:	56                   	push   %esi
+  8016cc:	6a 00                	push   $0x0
+  8016ce:	57                   	push   %edi
+  8016cf:	6a 00                	push   $0x0
+  8016d1:	e8 d7 f9 ff ff       	call   8010ad <sys_page_map>
+  8016d6:	89 c3                	mov    %eax,%ebx
+  8016d8:	83 c4 20             	add    $0x20,%esp
+  8016db:	85 c0                	test   %eax,%eax
+  8016dd:	78 33                	js     801712 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8016df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8016e2:	89 d8                	mov    %ebx,%eax
+  8016e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e7:	5b                   	pop    %ebx
+  8016e8:	5e                   	pop    %esi
+  8016e9:	5f                   	pop    %edi
+  8016ea:	5d                   	pop    %ebp
+  8016eb:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8016ec:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016f3:	83 ec 0c             	sub    $0xc,%esp
+  8016f6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016fb:	50                   	push   %eax
+  8016fc:	ff 75 d4             	push   -0x2c(%ebp)
+  8016ff:	6a 00                	push   $0x0
+  801701:	53                   	push   %ebx
+  801702:	6a 00                	push   $0x0
+  801704:	e8 a4 f9 ff ff       	call   8010ad <sys_page_map>
+  801709:	89 c3                	mov    %eax,%ebx
+  80170b:	83 c4 20             	add    $0x20,%esp
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	79 a4                	jns    8016b6 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801712:	83 ec 08             	sub    $0x8,%esp
+  801715:	56                   	push   %esi
+  801716:	6a 00                	push   $0x0
+  801718:	e8 d2 f9 ff ff       	call   8010ef <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80171d:	83 c4 08             	add    $0x8,%esp
+  801720:	ff 75 d4             	push   -0x2c(%ebp)
+  801723:	6a 00                	push   $0x0
+  801725:	e8 c5 f9 ff ff       	call   8010ef <sys_page_unmap>
+	return r;
+  80172a:	83 c4 10             	add    $0x10,%esp
+  80172d:	eb b3                	jmp    8016e2 <dup+0x9d>
+
+0080172f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80172f:	55                   	push   %ebp
+  801730:	89 e5                	mov    %esp,%ebp
+  801732:	56                   	push   %esi
+  801733:	53                   	push   %ebx
+  801734:	83 ec 18             	sub    $0x18,%esp
+  801737:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80173a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80173d:	50                   	push   %eax
+  80173e:	56                   	push   %esi
+  80173f:	e8 85 fd ff ff       	call   8014c9 <fd_lookup>
+  801744:	83 c4 10             	add    $0x10,%esp
+  801747:	85 c0                	test   %eax,%eax
+  801749:	78 3c                	js     801787 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80174b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80174e:	83 ec 08             	sub    $0x8,%esp
+  801751:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801754:	50                   	push   %eax
+  801755:	ff 33                	push   (%ebx)
+  801757:	e8 bd fd ff ff       	call   801519 <dev_lookup>
+  80175c:	83 c4 10             	add    $0x10,%esp
+  80175f:	85 c0                	test   %eax,%eax
+  801761:	78 24                	js     801787 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801763:	8b 43 08             	mov    0x8(%ebx),%eax
+  801766:	83 e0 03             	and    $0x3,%eax
+  801769:	83 f8 01             	cmp    $0x1,%eax
+  80176c:	74 20                	je     80178e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80176e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801771:	8b 40 08             	mov    0x8(%eax),%eax
+  801774:	85 c0                	test   %eax,%eax
+  801776:	74 37                	je     8017af <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801778:	83 ec 04             	sub    $0x4,%esp
+  80177b:	ff 75 10             	push   0x10(%ebp)
+  80177e:	ff 75 0c             	push   0xc(%ebp)
+  801781:	53                   	push   %ebx
+  801782:	ff d0                	call   *%eax
+  801784:	83 c4 10             	add    $0x10,%esp
+}
+  801787:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80178a:	5b                   	pop    %ebx
+  80178b:	5e                   	pop    %esi
+  80178c:	5d                   	pop    %ebp
+  80178d:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80178e:	a1 18 50 80 00       	mov    0x805018,%eax
+  801793:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801796:	83 ec 04             	sub    $0x4,%esp
+  801799:	56                   	push   %esi
+  80179a:	50                   	push   %eax
+  80179b:	68 ad 2f 80 00       	push   $0x802fad
+  8017a0:	e8 27 ee ff ff       	call   8005cc <cprintf>
+		return -E_INVAL;
+  8017a5:	83 c4 10             	add    $0x10,%esp
+  8017a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ad:	eb d8                	jmp    801787 <read+0x58>
+		return -E_NOT_SUPP;
+  8017af:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017b4:	eb d1                	jmp    801787 <read+0x58>
+
+008017b6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+  8017b9:	57                   	push   %edi
+  8017ba:	56                   	push   %esi
+  8017bb:	53                   	push   %ebx
+  8017bc:	83 ec 0c             	sub    $0xc,%esp
+  8017bf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017c2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8017c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ca:	eb 02                	jmp    8017ce <readn+0x18>
+  8017cc:	01 c3                	add    %eax,%ebx
+  8017ce:	39 f3                	cmp    %esi,%ebx
+  8017d0:	73 21                	jae    8017f3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017d2:	83 ec 04             	sub    $0x4,%esp
+  8017d5:	89 f0                	mov    %esi,%eax
+  8017d7:	29 d8                	sub    %ebx,%eax
+  8017d9:	50                   	push   %eax
+  8017da:	89 d8                	mov    %ebx,%eax
+  8017dc:	03 45 0c             	add    0xc(%ebp),%eax
+  8017df:	50                   	push   %eax
+  8017e0:	57                   	push   %edi
+  8017e1:	e8 49 ff ff ff       	call   80172f <read>
+		if (m < 0)
+  8017e6:	83 c4 10             	add    $0x10,%esp
+  8017e9:	85 c0                	test   %eax,%eax
+  8017eb:	78 04                	js     8017f1 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8017ed:	75 dd                	jne    8017cc <readn+0x16>
+  8017ef:	eb 02                	jmp    8017f3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017f1:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8017f3:	89 d8                	mov    %ebx,%eax
+  8017f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f8:	5b                   	pop    %ebx
+  8017f9:	5e                   	pop    %esi
+  8017fa:	5f                   	pop    %edi
+  8017fb:	5d                   	pop    %ebp
+  8017fc:	c3                   	ret
+
+008017fd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+  801800:	56                   	push   %esi
+  801801:	53                   	push   %ebx
+  801802:	83 ec 18             	sub    $0x18,%esp
+  801805:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801808:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80180b:	50                   	push   %eax
+  80180c:	53                   	push   %ebx
+  80180d:	e8 b7 fc ff ff       	call   8014c9 <fd_lookup>
+  801812:	83 c4 10             	add    $0x10,%esp
+  801815:	85 c0                	test   %eax,%eax
+  801817:	78 37                	js     801850 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801819:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80181c:	83 ec 08             	sub    $0x8,%esp
+  80181f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801822:	50                   	push   %eax
+  801823:	ff 36                	push   (%esi)
+  801825:	e8 ef fc ff ff       	call   801519 <dev_lookup>
+  80182a:	83 c4 10             	add    $0x10,%esp
+  80182d:	85 c0                	test   %eax,%eax
+  80182f:	78 1f                	js     801850 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801831:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801835:	74 20                	je     801857 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801837:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80183a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80183d:	85 c0                	test   %eax,%eax
+  80183f:	74 37                	je     801878 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801841:	83 ec 04             	sub    $0x4,%esp
+  801844:	ff 75 10             	push   0x10(%ebp)
+  801847:	ff 75 0c             	push   0xc(%ebp)
+  80184a:	56                   	push   %esi
+  80184b:	ff d0                	call   *%eax
+  80184d:	83 c4 10             	add    $0x10,%esp
+}
+  801850:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801853:	5b                   	pop    %ebx
+  801854:	5e                   	pop    %esi
+  801855:	5d                   	pop    %ebp
+  801856:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801857:	a1 18 50 80 00       	mov    0x805018,%eax
+  80185c:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80185f:	83 ec 04             	sub    $0x4,%esp
+  801862:	53                   	push   %ebx
+  801863:	50                   	push   %eax
+  801864:	68 c9 2f 80 00       	push   $0x802fc9
+  801869:	e8 5e ed ff ff       	call   8005cc <cprintf>
+		return -E_INVAL;
+  80186e:	83 c4 10             	add    $0x10,%esp
+  801871:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801876:	eb d8                	jmp    801850 <write+0x53>
+		return -E_NOT_SUPP;
+  801878:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80187d:	eb d1                	jmp    801850 <write+0x53>
+
+0080187f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80187f:	55                   	push   %ebp
+  801880:	89 e5                	mov    %esp,%ebp
+  801882:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801885:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801888:	50                   	push   %eax
+  801889:	ff 75 08             	push   0x8(%ebp)
+  80188c:	e8 38 fc ff ff       	call   8014c9 <fd_lookup>
+  801891:	83 c4 10             	add    $0x10,%esp
+  801894:	85 c0                	test   %eax,%eax
+  801896:	78 0e                	js     8018a6 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801898:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80189b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80189e:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8018a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018a6:	c9                   	leave
+  8018a7:	c3                   	ret
+
+008018a8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018a8:	55                   	push   %ebp
+  8018a9:	89 e5                	mov    %esp,%ebp
+  8018ab:	56                   	push   %esi
+  8018ac:	53                   	push   %ebx
+  8018ad:	83 ec 18             	sub    $0x18,%esp
+  8018b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018b3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018b6:	50                   	push   %eax
+  8018b7:	53                   	push   %ebx
+  8018b8:	e8 0c fc ff ff       	call   8014c9 <fd_lookup>
+  8018bd:	83 c4 10             	add    $0x10,%esp
+  8018c0:	85 c0                	test   %eax,%eax
+  8018c2:	78 34                	js     8018f8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018c4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018c7:	83 ec 08             	sub    $0x8,%esp
+  8018ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018cd:	50                   	push   %eax
+  8018ce:	ff 36                	push   (%esi)
+  8018d0:	e8 44 fc ff ff       	call   801519 <dev_lookup>
+  8018d5:	83 c4 10             	add    $0x10,%esp
+  8018d8:	85 c0                	test   %eax,%eax
+  8018da:	78 1c                	js     8018f8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018dc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018e0:	74 1d                	je     8018ff <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8018e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018e5:	8b 40 18             	mov    0x18(%eax),%eax
+  8018e8:	85 c0                	test   %eax,%eax
+  8018ea:	74 34                	je     801920 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8018ec:	83 ec 08             	sub    $0x8,%esp
+  8018ef:	ff 75 0c             	push   0xc(%ebp)
+  8018f2:	56                   	push   %esi
+  8018f3:	ff d0                	call   *%eax
+  8018f5:	83 c4 10             	add    $0x10,%esp
+}
+  8018f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018fb:	5b                   	pop    %ebx
+  8018fc:	5e                   	pop    %esi
+  8018fd:	5d                   	pop    %ebp
+  8018fe:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8018ff:	a1 18 50 80 00       	mov    0x805018,%eax
+  801904:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801907:	83 ec 04             	sub    $0x4,%esp
+  80190a:	53                   	push   %ebx
+  80190b:	50                   	push   %eax
+  80190c:	68 8c 2f 80 00       	push   $0x802f8c
+  801911:	e8 b6 ec ff ff       	call   8005cc <cprintf>
+		return -E_INVAL;
+  801916:	83 c4 10             	add    $0x10,%esp
+  801919:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80191e:	eb d8                	jmp    8018f8 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801920:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801925:	eb d1                	jmp    8018f8 <ftruncate+0x50>
+
+00801927 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801927:	55                   	push   %ebp
+  801928:	89 e5                	mov    %esp,%ebp
+  80192a:	56                   	push   %esi
+  80192b:	53                   	push   %ebx
+  80192c:	83 ec 18             	sub    $0x18,%esp
+  80192f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801932:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801935:	50                   	push   %eax
+  801936:	ff 75 08             	push   0x8(%ebp)
+  801939:	e8 8b fb ff ff       	call   8014c9 <fd_lookup>
+  80193e:	83 c4 10             	add    $0x10,%esp
+  801941:	85 c0                	test   %eax,%eax
+  801943:	78 49                	js     80198e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801945:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801948:	83 ec 08             	sub    $0x8,%esp
+  80194b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80194e:	50                   	push   %eax
+  80194f:	ff 36                	push   (%esi)
+  801951:	e8 c3 fb ff ff       	call   801519 <dev_lookup>
+  801956:	83 c4 10             	add    $0x10,%esp
+  801959:	85 c0                	test   %eax,%eax
+  80195b:	78 31                	js     80198e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80195d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801960:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801964:	74 2f                	je     801995 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801966:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801969:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801970:	00 00 00 
+	stat->st_isdir = 0;
+  801973:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80197a:	00 00 00 
+	stat->st_dev = dev;
+  80197d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801983:	83 ec 08             	sub    $0x8,%esp
+  801986:	53                   	push   %ebx
+  801987:	56                   	push   %esi
+  801988:	ff 50 14             	call   *0x14(%eax)
+  80198b:	83 c4 10             	add    $0x10,%esp
+}
+  80198e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801991:	5b                   	pop    %ebx
+  801992:	5e                   	pop    %esi
+  801993:	5d                   	pop    %ebp
+  801994:	c3                   	ret
+		return -E_NOT_SUPP;
+  801995:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80199a:	eb f2                	jmp    80198e <fstat+0x67>
+
+0080199c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80199c:	55                   	push   %ebp
+  80199d:	89 e5                	mov    %esp,%ebp
+  80199f:	56                   	push   %esi
+  8019a0:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8019a1:	83 ec 08             	sub    $0x8,%esp
+  8019a4:	6a 00                	push   $0x0
+  8019a6:	ff 75 08             	push   0x8(%ebp)
+  8019a9:	e8 e4 01 00 00       	call   801b92 <open>
+  8019ae:	89 c3                	mov    %eax,%ebx
+  8019b0:	83 c4 10             	add    $0x10,%esp
+  8019b3:	85 c0                	test   %eax,%eax
+  8019b5:	78 1b                	js     8019d2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8019b7:	83 ec 08             	sub    $0x8,%esp
+  8019ba:	ff 75 0c             	push   0xc(%ebp)
+  8019bd:	50                   	push   %eax
+  8019be:	e8 64 ff ff ff       	call   801927 <fstat>
+  8019c3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8019c5:	89 1c 24             	mov    %ebx,(%esp)
+  8019c8:	e8 26 fc ff ff       	call   8015f3 <close>
+	return r;
+  8019cd:	83 c4 10             	add    $0x10,%esp
+  8019d0:	89 f3                	mov    %esi,%ebx
+}
+  8019d2:	89 d8                	mov    %ebx,%eax
+  8019d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019d7:	5b                   	pop    %ebx
+  8019d8:	5e                   	pop    %esi
+  8019d9:	5d                   	pop    %ebp
+  8019da:	c3                   	ret
+
+008019db <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8019db:	55                   	push   %ebp
+  8019dc:	89 e5                	mov    %esp,%ebp
+  8019de:	56                   	push   %esi
+  8019df:	53                   	push   %ebx
+  8019e0:	89 c6                	mov    %eax,%esi
+  8019e2:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8019e4:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  8019eb:	74 27                	je     801a14 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8019ed:	6a 07                	push   $0x7
+  8019ef:	68 00 60 80 00       	push   $0x806000
+  8019f4:	56                   	push   %esi
+  8019f5:	ff 35 10 50 80 00    	push   0x805010
+  8019fb:	e8 1b 0c 00 00       	call   80261b <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801a00:	83 c4 0c             	add    $0xc,%esp
+  801a03:	6a 00                	push   $0x0
+  801a05:	53                   	push   %ebx
+  801a06:	6a 00                	push   $0x0
+  801a08:	e8 96 0b 00 00       	call   8025a3 <ipc_recv>
+}
+  801a0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a10:	5b                   	pop    %ebx
+  801a11:	5e                   	pop    %esi
+  801a12:	5d                   	pop    %ebp
+  801a13:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a14:	83 ec 0c             	sub    $0xc,%esp
+  801a17:	6a 01                	push   $0x1
+  801a19:	e8 51 0c 00 00       	call   80266f <ipc_find_env>
+  801a1e:	a3 10 50 80 00       	mov    %eax,0x805010
+  801a23:	83 c4 10             	add    $0x10,%esp
+  801a26:	eb c5                	jmp    8019ed <fsipc+0x12>
+
+00801a28 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a28:	55                   	push   %ebp
+  801a29:	89 e5                	mov    %esp,%ebp
+  801a2b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a31:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a34:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801a39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a3c:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801a41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a46:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a4b:	e8 8b ff ff ff       	call   8019db <fsipc>
+}
+  801a50:	c9                   	leave
+  801a51:	c3                   	ret
+
+00801a52 <devfile_flush>:
+{
+  801a52:	55                   	push   %ebp
+  801a53:	89 e5                	mov    %esp,%ebp
+  801a55:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a5b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a5e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801a63:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a68:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a6d:	e8 69 ff ff ff       	call   8019db <fsipc>
+}
+  801a72:	c9                   	leave
+  801a73:	c3                   	ret
+
+00801a74 <devfile_stat>:
+{
+  801a74:	55                   	push   %ebp
+  801a75:	89 e5                	mov    %esp,%ebp
+  801a77:	53                   	push   %ebx
+  801a78:	83 ec 04             	sub    $0x4,%esp
+  801a7b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a81:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a84:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a8e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a93:	e8 43 ff ff ff       	call   8019db <fsipc>
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	78 2c                	js     801ac8 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a9c:	83 ec 08             	sub    $0x8,%esp
+  801a9f:	68 00 60 80 00       	push   $0x806000
+  801aa4:	53                   	push   %ebx
+  801aa5:	e8 10 f1 ff ff       	call   800bba <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801aaa:	a1 80 60 80 00       	mov    0x806080,%eax
+  801aaf:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ab5:	a1 84 60 80 00       	mov    0x806084,%eax
+  801aba:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801ac0:	83 c4 10             	add    $0x10,%esp
+  801ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ac8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801acb:	c9                   	leave
+  801acc:	c3                   	ret
+
+00801acd <devfile_write>:
+{
+  801acd:	55                   	push   %ebp
+  801ace:	89 e5                	mov    %esp,%ebp
+  801ad0:	83 ec 0c             	sub    $0xc,%esp
+  801ad3:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801ad6:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801adb:	39 d0                	cmp    %edx,%eax
+  801add:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ae0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae3:	8b 52 0c             	mov    0xc(%edx),%edx
+  801ae6:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801aec:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801af1:	50                   	push   %eax
+  801af2:	ff 75 0c             	push   0xc(%ebp)
+  801af5:	68 08 60 80 00       	push   $0x806008
+  801afa:	e8 41 f2 ff ff       	call   800d40 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801aff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b04:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b09:	e8 cd fe ff ff       	call   8019db <fsipc>
+}
+  801b0e:	c9                   	leave
+  801b0f:	c3                   	ret
+
+00801b10 <devfile_read>:
+{
+  801b10:	55                   	push   %ebp
+  801b11:	89 e5                	mov    %esp,%ebp
+  801b13:	56                   	push   %esi
+  801b14:	53                   	push   %ebx
+  801b15:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b18:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b1b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b1e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801b23:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b29:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b33:	e8 a3 fe ff ff       	call   8019db <fsipc>
+  801b38:	89 c3                	mov    %eax,%ebx
+  801b3a:	85 c0                	test   %eax,%eax
+  801b3c:	78 1f                	js     801b5d <devfile_read+0x4d>
+	assert(r <= n);
+  801b3e:	39 c6                	cmp    %eax,%esi
+  801b40:	72 24                	jb     801b66 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801b42:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b47:	7f 33                	jg     801b7c <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b49:	83 ec 04             	sub    $0x4,%esp
+  801b4c:	50                   	push   %eax
+  801b4d:	68 00 60 80 00       	push   $0x806000
+  801b52:	ff 75 0c             	push   0xc(%ebp)
+  801b55:	e8 e6 f1 ff ff       	call   800d40 <memmove>
+	return r;
+  801b5a:	83 c4 10             	add    $0x10,%esp
+}
+  801b5d:	89 d8                	mov    %ebx,%eax
+  801b5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b62:	5b                   	pop    %ebx
+  801b63:	5e                   	pop    %esi
+  801b64:	5d                   	pop    %ebp
+  801b65:	c3                   	ret
+	assert(r <= n);
+  801b66:	68 fc 2f 80 00       	push   $0x802ffc
+  801b6b:	68 03 30 80 00       	push   $0x803003
+  801b70:	6a 7c                	push   $0x7c
+  801b72:	68 18 30 80 00       	push   $0x803018
+  801b77:	e8 e1 09 00 00       	call   80255d <_panic>
+	assert(r <= PGSIZE);
+  801b7c:	68 23 30 80 00       	push   $0x803023
+  801b81:	68 03 30 80 00       	push   $0x803003
+  801b86:	6a 7d                	push   $0x7d
+  801b88:	68 18 30 80 00       	push   $0x803018
+  801b8d:	e8 cb 09 00 00       	call   80255d <_panic>
+
+00801b92 <open>:
+{
+  801b92:	55                   	push   %ebp
+  801b93:	89 e5                	mov    %esp,%ebp
+  801b95:	56                   	push   %esi
+  801b96:	53                   	push   %ebx
+  801b97:	83 ec 1c             	sub    $0x1c,%esp
+  801b9a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b9d:	56                   	push   %esi
+  801b9e:	e8 dc ef ff ff       	call   800b7f <strlen>
+  801ba3:	83 c4 10             	add    $0x10,%esp
+  801ba6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bab:	7f 6c                	jg     801c19 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801bad:	83 ec 0c             	sub    $0xc,%esp
+  801bb0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb3:	50                   	push   %eax
+  801bb4:	e8 ba f8 ff ff       	call   801473 <fd_alloc>
+  801bb9:	89 c3                	mov    %eax,%ebx
+  801bbb:	83 c4 10             	add    $0x10,%esp
+  801bbe:	85 c0                	test   %eax,%eax
+  801bc0:	78 3c                	js     801bfe <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801bc2:	83 ec 08             	sub    $0x8,%esp
+  801bc5:	56                   	push   %esi
+  801bc6:	68 00 60 80 00       	push   $0x806000
+  801bcb:	e8 ea ef ff ff       	call   800bba <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801bd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bd3:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bd8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bdb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801be0:	e8 f6 fd ff ff       	call   8019db <fsipc>
+  801be5:	89 c3                	mov    %eax,%ebx
+  801be7:	83 c4 10             	add    $0x10,%esp
+  801bea:	85 c0                	test   %eax,%eax
+  801bec:	78 19                	js     801c07 <open+0x75>
+	return fd2num(fd);
+  801bee:	83 ec 0c             	sub    $0xc,%esp
+  801bf1:	ff 75 f4             	push   -0xc(%ebp)
+  801bf4:	e8 53 f8 ff ff       	call   80144c <fd2num>
+  801bf9:	89 c3                	mov    %eax,%ebx
+  801bfb:	83 c4 10             	add    $0x10,%esp
+}
+  801bfe:	89 d8                	mov    %ebx,%eax
+  801c00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c03:	5b                   	pop    %ebx
+  801c04:	5e                   	pop    %esi
+  801c05:	5d                   	pop    %ebp
+  801c06:	c3                   	ret
+		fd_close(fd, 0);
+  801c07:	83 ec 08             	sub    $0x8,%esp
+  801c0a:	6a 00                	push   $0x0
+  801c0c:	ff 75 f4             	push   -0xc(%ebp)
+  801c0f:	e8 58 f9 ff ff       	call   80156c <fd_close>
+		return r;
+  801c14:	83 c4 10             	add    $0x10,%esp
+  801c17:	eb e5                	jmp    801bfe <open+0x6c>
+		return -E_BAD_PATH;
+  801c19:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c1e:	eb de                	jmp    801bfe <open+0x6c>
+
+00801c20 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c20:	55                   	push   %ebp
+  801c21:	89 e5                	mov    %esp,%ebp
+  801c23:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c2b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c30:	e8 a6 fd ff ff       	call   8019db <fsipc>
+}
+  801c35:	c9                   	leave
+  801c36:	c3                   	ret
+
+00801c37 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c37:	55                   	push   %ebp
+  801c38:	89 e5                	mov    %esp,%ebp
+  801c3a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c3d:	68 2f 30 80 00       	push   $0x80302f
+  801c42:	ff 75 0c             	push   0xc(%ebp)
+  801c45:	e8 70 ef ff ff       	call   800bba <strcpy>
+	return 0;
+}
+  801c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4f:	c9                   	leave
+  801c50:	c3                   	ret
+
+00801c51 <devsock_close>:
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	53                   	push   %ebx
+  801c55:	83 ec 10             	sub    $0x10,%esp
+  801c58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c5b:	53                   	push   %ebx
+  801c5c:	e8 1e 0a 00 00       	call   80267f <pageref>
+  801c61:	89 c2                	mov    %eax,%edx
+  801c63:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c66:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c6b:	83 fa 01             	cmp    $0x1,%edx
+  801c6e:	74 05                	je     801c75 <devsock_close+0x24>
+}
+  801c70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c73:	c9                   	leave
+  801c74:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c75:	83 ec 0c             	sub    $0xc,%esp
+  801c78:	ff 73 0c             	push   0xc(%ebx)
+  801c7b:	e8 b7 02 00 00       	call   801f37 <nsipc_close>
+  801c80:	83 c4 10             	add    $0x10,%esp
+  801c83:	eb eb                	jmp    801c70 <devsock_close+0x1f>
+
+00801c85 <devsock_write>:
+{
+  801c85:	55                   	push   %ebp
+  801c86:	89 e5                	mov    %esp,%ebp
+  801c88:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c8b:	6a 00                	push   $0x0
+  801c8d:	ff 75 10             	push   0x10(%ebp)
+  801c90:	ff 75 0c             	push   0xc(%ebp)
+  801c93:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c96:	ff 70 0c             	push   0xc(%eax)
+  801c99:	e8 79 03 00 00       	call   802017 <nsipc_send>
+}
+  801c9e:	c9                   	leave
+  801c9f:	c3                   	ret
+
+00801ca0 <devsock_read>:
+{
+  801ca0:	55                   	push   %ebp
+  801ca1:	89 e5                	mov    %esp,%ebp
+  801ca3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801ca6:	6a 00                	push   $0x0
+  801ca8:	ff 75 10             	push   0x10(%ebp)
+  801cab:	ff 75 0c             	push   0xc(%ebp)
+  801cae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb1:	ff 70 0c             	push   0xc(%eax)
+  801cb4:	e8 ef 02 00 00       	call   801fa8 <nsipc_recv>
+}
+  801cb9:	c9                   	leave
+  801cba:	c3                   	ret
+
+00801cbb <fd2sockid>:
+{
+  801cbb:	55                   	push   %ebp
+  801cbc:	89 e5                	mov    %esp,%ebp
+  801cbe:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801cc1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cc4:	52                   	push   %edx
+  801cc5:	50                   	push   %eax
+  801cc6:	e8 fe f7 ff ff       	call   8014c9 <fd_lookup>
+  801ccb:	83 c4 10             	add    $0x10,%esp
+  801cce:	85 c0                	test   %eax,%eax
+  801cd0:	78 10                	js     801ce2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801cd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cd5:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  801cdb:	39 08                	cmp    %ecx,(%eax)
+  801cdd:	75 05                	jne    801ce4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cdf:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801ce2:	c9                   	leave
+  801ce3:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ce4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ce9:	eb f7                	jmp    801ce2 <fd2sockid+0x27>
+
+00801ceb <alloc_sockfd>:
+{
+  801ceb:	55                   	push   %ebp
+  801cec:	89 e5                	mov    %esp,%ebp
+  801cee:	56                   	push   %esi
+  801cef:	53                   	push   %ebx
+  801cf0:	83 ec 1c             	sub    $0x1c,%esp
+  801cf3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cf5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cf8:	50                   	push   %eax
+  801cf9:	e8 75 f7 ff ff       	call   801473 <fd_alloc>
+  801cfe:	89 c3                	mov    %eax,%ebx
+  801d00:	83 c4 10             	add    $0x10,%esp
+  801d03:	85 c0                	test   %eax,%eax
+  801d05:	78 43                	js     801d4a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d07:	83 ec 04             	sub    $0x4,%esp
+  801d0a:	68 07 04 00 00       	push   $0x407
+  801d0f:	ff 75 f4             	push   -0xc(%ebp)
+  801d12:	6a 00                	push   $0x0
+  801d14:	e8 0e f3 ff ff       	call   801027 <sys_page_alloc>
+  801d19:	89 c3                	mov    %eax,%ebx
+  801d1b:	83 c4 10             	add    $0x10,%esp
+  801d1e:	85 c0                	test   %eax,%eax
+  801d20:	78 28                	js     801d4a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d25:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  801d2b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d30:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d37:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d3a:	83 ec 0c             	sub    $0xc,%esp
+  801d3d:	50                   	push   %eax
+  801d3e:	e8 09 f7 ff ff       	call   80144c <fd2num>
+  801d43:	89 c3                	mov    %eax,%ebx
+  801d45:	83 c4 10             	add    $0x10,%esp
+  801d48:	eb 0c                	jmp    801d56 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d4a:	83 ec 0c             	sub    $0xc,%esp
+  801d4d:	56                   	push   %esi
+  801d4e:	e8 e4 01 00 00       	call   801f37 <nsipc_close>
+		return r;
+  801d53:	83 c4 10             	add    $0x10,%esp
+}
+  801d56:	89 d8                	mov    %ebx,%eax
+  801d58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d5b:	5b                   	pop    %ebx
+  801d5c:	5e                   	pop    %esi
+  801d5d:	5d                   	pop    %ebp
+  801d5e:	c3                   	ret
+
+00801d5f <accept>:
+{
+  801d5f:	55                   	push   %ebp
+  801d60:	89 e5                	mov    %esp,%ebp
+  801d62:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d65:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d68:	e8 4e ff ff ff       	call   801cbb <fd2sockid>
+  801d6d:	85 c0                	test   %eax,%eax
+  801d6f:	78 1b                	js     801d8c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d71:	83 ec 04             	sub    $0x4,%esp
+  801d74:	ff 75 10             	push   0x10(%ebp)
+  801d77:	ff 75 0c             	push   0xc(%ebp)
+  801d7a:	50                   	push   %eax
+  801d7b:	e8 0e 01 00 00       	call   801e8e <nsipc_accept>
+  801d80:	83 c4 10             	add    $0x10,%esp
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	78 05                	js     801d8c <accept+0x2d>
+	return alloc_sockfd(r);
+  801d87:	e8 5f ff ff ff       	call   801ceb <alloc_sockfd>
+}
+  801d8c:	c9                   	leave
+  801d8d:	c3                   	ret
+
+00801d8e <bind>:
+{
+  801d8e:	55                   	push   %ebp
+  801d8f:	89 e5                	mov    %esp,%ebp
+  801d91:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d94:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d97:	e8 1f ff ff ff       	call   801cbb <fd2sockid>
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	78 12                	js     801db2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801da0:	83 ec 04             	sub    $0x4,%esp
+  801da3:	ff 75 10             	push   0x10(%ebp)
+  801da6:	ff 75 0c             	push   0xc(%ebp)
+  801da9:	50                   	push   %eax
+  801daa:	e8 31 01 00 00       	call   801ee0 <nsipc_bind>
+  801daf:	83 c4 10             	add    $0x10,%esp
+}
+  801db2:	c9                   	leave
+  801db3:	c3                   	ret
+
+00801db4 <shutdown>:
+{
+  801db4:	55                   	push   %ebp
+  801db5:	89 e5                	mov    %esp,%ebp
+  801db7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dbd:	e8 f9 fe ff ff       	call   801cbb <fd2sockid>
+  801dc2:	85 c0                	test   %eax,%eax
+  801dc4:	78 0f                	js     801dd5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dc6:	83 ec 08             	sub    $0x8,%esp
+  801dc9:	ff 75 0c             	push   0xc(%ebp)
+  801dcc:	50                   	push   %eax
+  801dcd:	e8 43 01 00 00       	call   801f15 <nsipc_shutdown>
+  801dd2:	83 c4 10             	add    $0x10,%esp
+}
+  801dd5:	c9                   	leave
+  801dd6:	c3                   	ret
+
+00801dd7 <connect>:
+{
+  801dd7:	55                   	push   %ebp
+  801dd8:	89 e5                	mov    %esp,%ebp
+  801dda:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ddd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de0:	e8 d6 fe ff ff       	call   801cbb <fd2sockid>
+  801de5:	85 c0                	test   %eax,%eax
+  801de7:	78 12                	js     801dfb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801de9:	83 ec 04             	sub    $0x4,%esp
+  801dec:	ff 75 10             	push   0x10(%ebp)
+  801def:	ff 75 0c             	push   0xc(%ebp)
+  801df2:	50                   	push   %eax
+  801df3:	e8 59 01 00 00       	call   801f51 <nsipc_connect>
+  801df8:	83 c4 10             	add    $0x10,%esp
+}
+  801dfb:	c9                   	leave
+  801dfc:	c3                   	ret
+
+00801dfd <listen>:
+{
+  801dfd:	55                   	push   %ebp
+  801dfe:	89 e5                	mov    %esp,%ebp
+  801e00:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e03:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e06:	e8 b0 fe ff ff       	call   801cbb <fd2sockid>
+  801e0b:	85 c0                	test   %eax,%eax
+  801e0d:	78 0f                	js     801e1e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e0f:	83 ec 08             	sub    $0x8,%esp
+  801e12:	ff 75 0c             	push   0xc(%ebp)
+  801e15:	50                   	push   %eax
+  801e16:	e8 6b 01 00 00       	call   801f86 <nsipc_listen>
+  801e1b:	83 c4 10             	add    $0x10,%esp
+}
+  801e1e:	c9                   	leave
+  801e1f:	c3                   	ret
+
+00801e20 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e20:	55                   	push   %ebp
+  801e21:	89 e5                	mov    %esp,%ebp
+  801e23:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e26:	ff 75 10             	push   0x10(%ebp)
+  801e29:	ff 75 0c             	push   0xc(%ebp)
+  801e2c:	ff 75 08             	push   0x8(%ebp)
+  801e2f:	e8 41 02 00 00       	call   802075 <nsipc_socket>
+  801e34:	83 c4 10             	add    $0x10,%esp
+  801e37:	85 c0                	test   %eax,%eax
+  801e39:	78 05                	js     801e40 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e3b:	e8 ab fe ff ff       	call   801ceb <alloc_sockfd>
+}
+  801e40:	c9                   	leave
+  801e41:	c3                   	ret
+
+00801e42 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e42:	55                   	push   %ebp
+  801e43:	89 e5                	mov    %esp,%ebp
+  801e45:	53                   	push   %ebx
+  801e46:	83 ec 04             	sub    $0x4,%esp
+  801e49:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e4b:	83 3d 14 50 80 00 00 	cmpl   $0x0,0x805014
+  801e52:	74 26                	je     801e7a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e54:	6a 07                	push   $0x7
+  801e56:	68 00 70 80 00       	push   $0x807000
+  801e5b:	53                   	push   %ebx
+  801e5c:	ff 35 14 50 80 00    	push   0x805014
+  801e62:	e8 b4 07 00 00       	call   80261b <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e67:	83 c4 0c             	add    $0xc,%esp
+  801e6a:	6a 00                	push   $0x0
+  801e6c:	6a 00                	push   $0x0
+  801e6e:	6a 00                	push   $0x0
+  801e70:	e8 2e 07 00 00       	call   8025a3 <ipc_recv>
+}
+  801e75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e78:	c9                   	leave
+  801e79:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e7a:	83 ec 0c             	sub    $0xc,%esp
+  801e7d:	6a 02                	push   $0x2
+  801e7f:	e8 eb 07 00 00       	call   80266f <ipc_find_env>
+  801e84:	a3 14 50 80 00       	mov    %eax,0x805014
+  801e89:	83 c4 10             	add    $0x10,%esp
+  801e8c:	eb c6                	jmp    801e54 <nsipc+0x12>
+
+00801e8e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e8e:	55                   	push   %ebp
+  801e8f:	89 e5                	mov    %esp,%ebp
+  801e91:	56                   	push   %esi
+  801e92:	53                   	push   %ebx
+  801e93:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e99:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e9e:	8b 06                	mov    (%esi),%eax
+  801ea0:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ea5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eaa:	e8 93 ff ff ff       	call   801e42 <nsipc>
+  801eaf:	89 c3                	mov    %eax,%ebx
+  801eb1:	85 c0                	test   %eax,%eax
+  801eb3:	79 09                	jns    801ebe <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801eb5:	89 d8                	mov    %ebx,%eax
+  801eb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eba:	5b                   	pop    %ebx
+  801ebb:	5e                   	pop    %esi
+  801ebc:	5d                   	pop    %ebp
+  801ebd:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801ebe:	83 ec 04             	sub    $0x4,%esp
+  801ec1:	ff 35 10 70 80 00    	push   0x807010
+  801ec7:	68 00 70 80 00       	push   $0x807000
+  801ecc:	ff 75 0c             	push   0xc(%ebp)
+  801ecf:	e8 6c ee ff ff       	call   800d40 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801ed4:	a1 10 70 80 00       	mov    0x807010,%eax
+  801ed9:	89 06                	mov    %eax,(%esi)
+  801edb:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ede:	eb d5                	jmp    801eb5 <nsipc_accept+0x27>
+
+00801ee0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ee0:	55                   	push   %ebp
+  801ee1:	89 e5                	mov    %esp,%ebp
+  801ee3:	53                   	push   %ebx
+  801ee4:	83 ec 08             	sub    $0x8,%esp
+  801ee7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801eea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eed:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ef2:	53                   	push   %ebx
+  801ef3:	ff 75 0c             	push   0xc(%ebp)
+  801ef6:	68 04 70 80 00       	push   $0x807004
+  801efb:	e8 40 ee ff ff       	call   800d40 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f00:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801f06:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f0b:	e8 32 ff ff ff       	call   801e42 <nsipc>
+}
+  801f10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f13:	c9                   	leave
+  801f14:	c3                   	ret
+
+00801f15 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f15:	55                   	push   %ebp
+  801f16:	89 e5                	mov    %esp,%ebp
+  801f18:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801f23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f26:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f2b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f30:	e8 0d ff ff ff       	call   801e42 <nsipc>
+}
+  801f35:	c9                   	leave
+  801f36:	c3                   	ret
+
+00801f37 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f37:	55                   	push   %ebp
+  801f38:	89 e5                	mov    %esp,%ebp
+  801f3a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f40:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801f45:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f4a:	e8 f3 fe ff ff       	call   801e42 <nsipc>
+}
+  801f4f:	c9                   	leave
+  801f50:	c3                   	ret
+
+00801f51 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f51:	55                   	push   %ebp
+  801f52:	89 e5                	mov    %esp,%ebp
+  801f54:	53                   	push   %ebx
+  801f55:	83 ec 08             	sub    $0x8,%esp
+  801f58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5e:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f63:	53                   	push   %ebx
+  801f64:	ff 75 0c             	push   0xc(%ebp)
+  801f67:	68 04 70 80 00       	push   $0x807004
+  801f6c:	e8 cf ed ff ff       	call   800d40 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f71:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801f77:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f7c:	e8 c1 fe ff ff       	call   801e42 <nsipc>
+}
+  801f81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f84:	c9                   	leave
+  801f85:	c3                   	ret
+
+00801f86 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f86:	55                   	push   %ebp
+  801f87:	89 e5                	mov    %esp,%ebp
+  801f89:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f97:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801f9c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fa1:	e8 9c fe ff ff       	call   801e42 <nsipc>
+}
+  801fa6:	c9                   	leave
+  801fa7:	c3                   	ret
+
+00801fa8 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fa8:	55                   	push   %ebp
+  801fa9:	89 e5                	mov    %esp,%ebp
+  801fab:	56                   	push   %esi
+  801fac:	53                   	push   %ebx
+  801fad:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801fb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb3:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801fb8:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801fbe:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fc1:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801fc6:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fcb:	e8 72 fe ff ff       	call   801e42 <nsipc>
+  801fd0:	89 c3                	mov    %eax,%ebx
+  801fd2:	85 c0                	test   %eax,%eax
+  801fd4:	78 22                	js     801ff8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fd6:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801fdb:	39 c6                	cmp    %eax,%esi
+  801fdd:	0f 4e c6             	cmovle %esi,%eax
+  801fe0:	39 c3                	cmp    %eax,%ebx
+  801fe2:	7f 1d                	jg     802001 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fe4:	83 ec 04             	sub    $0x4,%esp
+  801fe7:	53                   	push   %ebx
+  801fe8:	68 00 70 80 00       	push   $0x807000
+  801fed:	ff 75 0c             	push   0xc(%ebp)
+  801ff0:	e8 4b ed ff ff       	call   800d40 <memmove>
+  801ff5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801ff8:	89 d8                	mov    %ebx,%eax
+  801ffa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ffd:	5b                   	pop    %ebx
+  801ffe:	5e                   	pop    %esi
+  801fff:	5d                   	pop    %ebp
+  802000:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802001:	68 3b 30 80 00       	push   $0x80303b
+  802006:	68 03 30 80 00       	push   $0x803003
+  80200b:	6a 62                	push   $0x62
+  80200d:	68 50 30 80 00       	push   $0x803050
+  802012:	e8 46 05 00 00       	call   80255d <_panic>
+
+00802017 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802017:	55                   	push   %ebp
+  802018:	89 e5                	mov    %esp,%ebp
+  80201a:	53                   	push   %ebx
+  80201b:	83 ec 04             	sub    $0x4,%esp
+  80201e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802021:	8b 45 08             	mov    0x8(%ebp),%eax
+  802024:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802029:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80202f:	7f 2e                	jg     80205f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802031:	83 ec 04             	sub    $0x4,%esp
+  802034:	53                   	push   %ebx
+  802035:	ff 75 0c             	push   0xc(%ebp)
+  802038:	68 0c 70 80 00       	push   $0x80700c
+  80203d:	e8 fe ec ff ff       	call   800d40 <memmove>
+	nsipcbuf.send.req_size = size;
+  802042:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802048:	8b 45 14             	mov    0x14(%ebp),%eax
+  80204b:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802050:	b8 08 00 00 00       	mov    $0x8,%eax
+  802055:	e8 e8 fd ff ff       	call   801e42 <nsipc>
+}
+  80205a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80205d:	c9                   	leave
+  80205e:	c3                   	ret
+	assert(size < 1600);
+  80205f:	68 5c 30 80 00       	push   $0x80305c
+  802064:	68 03 30 80 00       	push   $0x803003
+  802069:	6a 6d                	push   $0x6d
+  80206b:	68 50 30 80 00       	push   $0x803050
+  802070:	e8 e8 04 00 00       	call   80255d <_panic>
+
+00802075 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802075:	55                   	push   %ebp
+  802076:	89 e5                	mov    %esp,%ebp
+  802078:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80207b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80207e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802083:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802086:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80208b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80208e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802093:	b8 09 00 00 00       	mov    $0x9,%eax
+  802098:	e8 a5 fd ff ff       	call   801e42 <nsipc>
+}
+  80209d:	c9                   	leave
+  80209e:	c3                   	ret
+
+0080209f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80209f:	55                   	push   %ebp
+  8020a0:	89 e5                	mov    %esp,%ebp
+  8020a2:	56                   	push   %esi
+  8020a3:	53                   	push   %ebx
+  8020a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8020a7:	83 ec 0c             	sub    $0xc,%esp
+  8020aa:	ff 75 08             	push   0x8(%ebp)
+  8020ad:	e8 aa f3 ff ff       	call   80145c <fd2data>
+  8020b2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8020b4:	83 c4 08             	add    $0x8,%esp
+  8020b7:	68 68 30 80 00       	push   $0x803068
+  8020bc:	53                   	push   %ebx
+  8020bd:	e8 f8 ea ff ff       	call   800bba <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8020c2:	8b 46 04             	mov    0x4(%esi),%eax
+  8020c5:	2b 06                	sub    (%esi),%eax
+  8020c7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020cd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020d4:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020d7:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  8020de:	40 80 00 
+	return 0;
+}
+  8020e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020e9:	5b                   	pop    %ebx
+  8020ea:	5e                   	pop    %esi
+  8020eb:	5d                   	pop    %ebp
+  8020ec:	c3                   	ret
+
+008020ed <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020ed:	55                   	push   %ebp
+  8020ee:	89 e5                	mov    %esp,%ebp
+  8020f0:	53                   	push   %ebx
+  8020f1:	83 ec 0c             	sub    $0xc,%esp
+  8020f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020f7:	53                   	push   %ebx
+  8020f8:	6a 00                	push   $0x0
+  8020fa:	e8 f0 ef ff ff       	call   8010ef <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020ff:	89 1c 24             	mov    %ebx,(%esp)
+  802102:	e8 55 f3 ff ff       	call   80145c <fd2data>
+  802107:	83 c4 08             	add    $0x8,%esp
+  80210a:	50                   	push   %eax
+  80210b:	6a 00                	push   $0x0
+  80210d:	e8 dd ef ff ff       	call   8010ef <sys_page_unmap>
+}
+  802112:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802115:	c9                   	leave
+  802116:	c3                   	ret
+
+00802117 <_pipeisclosed>:
+{
+  802117:	55                   	push   %ebp
+  802118:	89 e5                	mov    %esp,%ebp
+  80211a:	57                   	push   %edi
+  80211b:	56                   	push   %esi
+  80211c:	53                   	push   %ebx
+  80211d:	83 ec 1c             	sub    $0x1c,%esp
+  802120:	89 c7                	mov    %eax,%edi
+  802122:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802124:	a1 18 50 80 00       	mov    0x805018,%eax
+  802129:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80212c:	83 ec 0c             	sub    $0xc,%esp
+  80212f:	57                   	push   %edi
+  802130:	e8 4a 05 00 00       	call   80267f <pageref>
+  802135:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802138:	89 34 24             	mov    %esi,(%esp)
+  80213b:	e8 3f 05 00 00       	call   80267f <pageref>
+		nn = thisenv->env_runs;
+  802140:	8b 15 18 50 80 00    	mov    0x805018,%edx
+  802146:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802149:	83 c4 10             	add    $0x10,%esp
+  80214c:	39 cb                	cmp    %ecx,%ebx
+  80214e:	74 1b                	je     80216b <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802150:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802153:	75 cf                	jne    802124 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802155:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802158:	6a 01                	push   $0x1
+  80215a:	50                   	push   %eax
+  80215b:	53                   	push   %ebx
+  80215c:	68 6f 30 80 00       	push   $0x80306f
+  802161:	e8 66 e4 ff ff       	call   8005cc <cprintf>
+  802166:	83 c4 10             	add    $0x10,%esp
+  802169:	eb b9                	jmp    802124 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80216b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80216e:	0f 94 c0             	sete   %al
+  802171:	0f b6 c0             	movzbl %al,%eax
+}
+  802174:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802177:	5b                   	pop    %ebx
+  802178:	5e                   	pop    %esi
+  802179:	5f                   	pop    %edi
+  80217a:	5d                   	pop    %ebp
+  80217b:	c3                   	ret
+
+0080217c <devpipe_write>:
+{
+  80217c:	55                   	push   %ebp
+  80217d:	89 e5                	mov    %esp,%ebp
+  80217f:	57                   	push   %edi
+  802180:	56                   	push   %esi
+  802181:	53                   	push   %ebx
+  802182:	83 ec 28             	sub    $0x28,%esp
+  802185:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802188:	56                   	push   %esi
+  802189:	e8 ce f2 ff ff       	call   80145c <fd2data>
+  80218e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802190:	83 c4 10             	add    $0x10,%esp
+  802193:	bf 00 00 00 00       	mov    $0x0,%edi
+  802198:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80219b:	75 09                	jne    8021a6 <devpipe_write+0x2a>
+	return i;
+  80219d:	89 f8                	mov    %edi,%eax
+  80219f:	eb 23                	jmp    8021c4 <devpipe_write+0x48>
+			sys_yield();
+  8021a1:	e8 01 ee ff ff       	call   800fa7 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8021a6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8021a9:	8b 0b                	mov    (%ebx),%ecx
+  8021ab:	8d 51 20             	lea    0x20(%ecx),%edx
+  8021ae:	39 d0                	cmp    %edx,%eax
+  8021b0:	72 1a                	jb     8021cc <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8021b2:	89 da                	mov    %ebx,%edx
+  8021b4:	89 f0                	mov    %esi,%eax
+  8021b6:	e8 5c ff ff ff       	call   802117 <_pipeisclosed>
+  8021bb:	85 c0                	test   %eax,%eax
+  8021bd:	74 e2                	je     8021a1 <devpipe_write+0x25>
+				return 0;
+  8021bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021c7:	5b                   	pop    %ebx
+  8021c8:	5e                   	pop    %esi
+  8021c9:	5f                   	pop    %edi
+  8021ca:	5d                   	pop    %ebp
+  8021cb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021cf:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021d3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021d6:	89 c2                	mov    %eax,%edx
+  8021d8:	c1 fa 1f             	sar    $0x1f,%edx
+  8021db:	89 d1                	mov    %edx,%ecx
+  8021dd:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021e0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021e3:	83 e2 1f             	and    $0x1f,%edx
+  8021e6:	29 ca                	sub    %ecx,%edx
+  8021e8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021ec:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021f0:	83 c0 01             	add    $0x1,%eax
+  8021f3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021f6:	83 c7 01             	add    $0x1,%edi
+  8021f9:	eb 9d                	jmp    802198 <devpipe_write+0x1c>
+
+008021fb <devpipe_read>:
+{
+  8021fb:	55                   	push   %ebp
+  8021fc:	89 e5                	mov    %esp,%ebp
+  8021fe:	57                   	push   %edi
+  8021ff:	56                   	push   %esi
+  802200:	53                   	push   %ebx
+  802201:	83 ec 18             	sub    $0x18,%esp
+  802204:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802207:	57                   	push   %edi
+  802208:	e8 4f f2 ff ff       	call   80145c <fd2data>
+  80220d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80220f:	83 c4 10             	add    $0x10,%esp
+  802212:	be 00 00 00 00       	mov    $0x0,%esi
+  802217:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80221a:	75 13                	jne    80222f <devpipe_read+0x34>
+	return i;
+  80221c:	89 f0                	mov    %esi,%eax
+  80221e:	eb 02                	jmp    802222 <devpipe_read+0x27>
+				return i;
+  802220:	89 f0                	mov    %esi,%eax
+}
+  802222:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802225:	5b                   	pop    %ebx
+  802226:	5e                   	pop    %esi
+  802227:	5f                   	pop    %edi
+  802228:	5d                   	pop    %ebp
+  802229:	c3                   	ret
+			sys_yield();
+  80222a:	e8 78 ed ff ff       	call   800fa7 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80222f:	8b 03                	mov    (%ebx),%eax
+  802231:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802234:	75 18                	jne    80224e <devpipe_read+0x53>
+			if (i > 0)
+  802236:	85 f6                	test   %esi,%esi
+  802238:	75 e6                	jne    802220 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80223a:	89 da                	mov    %ebx,%edx
+  80223c:	89 f8                	mov    %edi,%eax
+  80223e:	e8 d4 fe ff ff       	call   802117 <_pipeisclosed>
+  802243:	85 c0                	test   %eax,%eax
+  802245:	74 e3                	je     80222a <devpipe_read+0x2f>
+				return 0;
+  802247:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224c:	eb d4                	jmp    802222 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80224e:	99                   	cltd
+  80224f:	c1 ea 1b             	shr    $0x1b,%edx
+  802252:	01 d0                	add    %edx,%eax
+  802254:	83 e0 1f             	and    $0x1f,%eax
+  802257:	29 d0                	sub    %edx,%eax
+  802259:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80225e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802261:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802264:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802267:	83 c6 01             	add    $0x1,%esi
+  80226a:	eb ab                	jmp    802217 <devpipe_read+0x1c>
+
+0080226c <pipe>:
+{
+  80226c:	55                   	push   %ebp
+  80226d:	89 e5                	mov    %esp,%ebp
+  80226f:	56                   	push   %esi
+  802270:	53                   	push   %ebx
+  802271:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802274:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802277:	50                   	push   %eax
+  802278:	e8 f6 f1 ff ff       	call   801473 <fd_alloc>
+  80227d:	89 c3                	mov    %eax,%ebx
+  80227f:	83 c4 10             	add    $0x10,%esp
+  802282:	85 c0                	test   %eax,%eax
+  802284:	0f 88 23 01 00 00    	js     8023ad <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80228a:	83 ec 04             	sub    $0x4,%esp
+  80228d:	68 07 04 00 00       	push   $0x407
+  802292:	ff 75 f4             	push   -0xc(%ebp)
+  802295:	6a 00                	push   $0x0
+  802297:	e8 8b ed ff ff       	call   801027 <sys_page_alloc>
+  80229c:	89 c3                	mov    %eax,%ebx
+  80229e:	83 c4 10             	add    $0x10,%esp
+  8022a1:	85 c0                	test   %eax,%eax
+  8022a3:	0f 88 04 01 00 00    	js     8023ad <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8022a9:	83 ec 0c             	sub    $0xc,%esp
+  8022ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022af:	50                   	push   %eax
+  8022b0:	e8 be f1 ff ff       	call   801473 <fd_alloc>
+  8022b5:	89 c3                	mov    %eax,%ebx
+  8022b7:	83 c4 10             	add    $0x10,%esp
+  8022ba:	85 c0                	test   %eax,%eax
+  8022bc:	0f 88 db 00 00 00    	js     80239d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022c2:	83 ec 04             	sub    $0x4,%esp
+  8022c5:	68 07 04 00 00       	push   $0x407
+  8022ca:	ff 75 f0             	push   -0x10(%ebp)
+  8022cd:	6a 00                	push   $0x0
+  8022cf:	e8 53 ed ff ff       	call   801027 <sys_page_alloc>
+  8022d4:	89 c3                	mov    %eax,%ebx
+  8022d6:	83 c4 10             	add    $0x10,%esp
+  8022d9:	85 c0                	test   %eax,%eax
+  8022db:	0f 88 bc 00 00 00    	js     80239d <pipe+0x131>
+	va = fd2data(fd0);
+  8022e1:	83 ec 0c             	sub    $0xc,%esp
+  8022e4:	ff 75 f4             	push   -0xc(%ebp)
+  8022e7:	e8 70 f1 ff ff       	call   80145c <fd2data>
+  8022ec:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022ee:	83 c4 0c             	add    $0xc,%esp
+  8022f1:	68 07 04 00 00       	push   $0x407
+  8022f6:	50                   	push   %eax
+  8022f7:	6a 00                	push   $0x0
+  8022f9:	e8 29 ed ff ff       	call   801027 <sys_page_alloc>
+  8022fe:	89 c3                	mov    %eax,%ebx
+  802300:	83 c4 10             	add    $0x10,%esp
+  802303:	85 c0                	test   %eax,%eax
+  802305:	0f 88 82 00 00 00    	js     80238d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80230b:	83 ec 0c             	sub    $0xc,%esp
+  80230e:	ff 75 f0             	push   -0x10(%ebp)
+  802311:	e8 46 f1 ff ff       	call   80145c <fd2data>
+  802316:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80231d:	50                   	push   %eax
+  80231e:	6a 00                	push   $0x0
+  802320:	56                   	push   %esi
+  802321:	6a 00                	push   $0x0
+  802323:	e8 85 ed ff ff       	call   8010ad <sys_page_map>
+  802328:	89 c3                	mov    %eax,%ebx
+  80232a:	83 c4 20             	add    $0x20,%esp
+  80232d:	85 c0                	test   %eax,%eax
+  80232f:	78 4e                	js     80237f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802331:	a1 40 40 80 00       	mov    0x804040,%eax
+  802336:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802339:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80233b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80233e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802345:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802348:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80234a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80234d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802354:	83 ec 0c             	sub    $0xc,%esp
+  802357:	ff 75 f4             	push   -0xc(%ebp)
+  80235a:	e8 ed f0 ff ff       	call   80144c <fd2num>
+  80235f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802362:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802364:	83 c4 04             	add    $0x4,%esp
+  802367:	ff 75 f0             	push   -0x10(%ebp)
+  80236a:	e8 dd f0 ff ff       	call   80144c <fd2num>
+  80236f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802372:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802375:	83 c4 10             	add    $0x10,%esp
+  802378:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80237d:	eb 2e                	jmp    8023ad <pipe+0x141>
+	sys_page_unmap(0, va);
+  80237f:	83 ec 08             	sub    $0x8,%esp
+  802382:	56                   	push   %esi
+  802383:	6a 00                	push   $0x0
+  802385:	e8 65 ed ff ff       	call   8010ef <sys_page_unmap>
+  80238a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80238d:	83 ec 08             	sub    $0x8,%esp
+  802390:	ff 75 f0             	push   -0x10(%ebp)
+  802393:	6a 00                	push   $0x0
+  802395:	e8 55 ed ff ff       	call   8010ef <sys_page_unmap>
+  80239a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80239d:	83 ec 08             	sub    $0x8,%esp
+  8023a0:	ff 75 f4             	push   -0xc(%ebp)
+  8023a3:	6a 00                	push   $0x0
+  8023a5:	e8 45 ed ff ff       	call   8010ef <sys_page_unmap>
+  8023aa:	83 c4 10             	add    $0x10,%esp
+}
+  8023ad:	89 d8                	mov    %ebx,%eax
+  8023af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023b2:	5b                   	pop    %ebx
+  8023b3:	5e                   	pop    %esi
+  8023b4:	5d                   	pop    %ebp
+  8023b5:	c3                   	ret
+
+008023b6 <pipeisclosed>:
+{
+  8023b6:	55                   	push   %ebp
+  8023b7:	89 e5                	mov    %esp,%ebp
+  8023b9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023bf:	50                   	push   %eax
+  8023c0:	ff 75 08             	push   0x8(%ebp)
+  8023c3:	e8 01 f1 ff ff       	call   8014c9 <fd_lookup>
+  8023c8:	83 c4 10             	add    $0x10,%esp
+  8023cb:	85 c0                	test   %eax,%eax
+  8023cd:	78 18                	js     8023e7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023cf:	83 ec 0c             	sub    $0xc,%esp
+  8023d2:	ff 75 f4             	push   -0xc(%ebp)
+  8023d5:	e8 82 f0 ff ff       	call   80145c <fd2data>
+  8023da:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023df:	e8 33 fd ff ff       	call   802117 <_pipeisclosed>
+  8023e4:	83 c4 10             	add    $0x10,%esp
+}
+  8023e7:	c9                   	leave
+  8023e8:	c3                   	ret
+
+008023e9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ee:	c3                   	ret
+
+008023ef <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023ef:	55                   	push   %ebp
+  8023f0:	89 e5                	mov    %esp,%ebp
+  8023f2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023f5:	68 87 30 80 00       	push   $0x803087
+  8023fa:	ff 75 0c             	push   0xc(%ebp)
+  8023fd:	e8 b8 e7 ff ff       	call   800bba <strcpy>
+	return 0;
+}
+  802402:	b8 00 00 00 00       	mov    $0x0,%eax
+  802407:	c9                   	leave
+  802408:	c3                   	ret
+
+00802409 <devcons_write>:
+{
+  802409:	55                   	push   %ebp
+  80240a:	89 e5                	mov    %esp,%ebp
+  80240c:	57                   	push   %edi
+  80240d:	56                   	push   %esi
+  80240e:	53                   	push   %ebx
+  80240f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802415:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80241a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802420:	eb 2e                	jmp    802450 <devcons_write+0x47>
+		m = n - tot;
+  802422:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802425:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802427:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80242c:	39 c3                	cmp    %eax,%ebx
+  80242e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802431:	83 ec 04             	sub    $0x4,%esp
+  802434:	53                   	push   %ebx
+  802435:	89 f0                	mov    %esi,%eax
+  802437:	03 45 0c             	add    0xc(%ebp),%eax
+  80243a:	50                   	push   %eax
+  80243b:	57                   	push   %edi
+  80243c:	e8 ff e8 ff ff       	call   800d40 <memmove>
+		sys_cputs(buf, m);
+  802441:	83 c4 08             	add    $0x8,%esp
+  802444:	53                   	push   %ebx
+  802445:	57                   	push   %edi
+  802446:	e8 9f ea ff ff       	call   800eea <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80244b:	01 de                	add    %ebx,%esi
+  80244d:	83 c4 10             	add    $0x10,%esp
+  802450:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802453:	72 cd                	jb     802422 <devcons_write+0x19>
+}
+  802455:	89 f0                	mov    %esi,%eax
+  802457:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80245a:	5b                   	pop    %ebx
+  80245b:	5e                   	pop    %esi
+  80245c:	5f                   	pop    %edi
+  80245d:	5d                   	pop    %ebp
+  80245e:	c3                   	ret
+
+0080245f <devcons_read>:
+{
+  80245f:	55                   	push   %ebp
+  802460:	89 e5                	mov    %esp,%ebp
+  802462:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80246e:	75 07                	jne    802477 <devcons_read+0x18>
+  802470:	eb 1f                	jmp    802491 <devcons_read+0x32>
+		sys_yield();
+  802472:	e8 30 eb ff ff       	call   800fa7 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802477:	e8 8c ea ff ff       	call   800f08 <sys_cgetc>
+  80247c:	85 c0                	test   %eax,%eax
+  80247e:	74 f2                	je     802472 <devcons_read+0x13>
+	if (c < 0)
+  802480:	78 0f                	js     802491 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802482:	83 f8 04             	cmp    $0x4,%eax
+  802485:	74 0c                	je     802493 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802487:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80248a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80248c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802491:	c9                   	leave
+  802492:	c3                   	ret
+		return 0;
+  802493:	b8 00 00 00 00       	mov    $0x0,%eax
+  802498:	eb f7                	jmp    802491 <devcons_read+0x32>
+
+0080249a <cputchar>:
+{
+  80249a:	55                   	push   %ebp
+  80249b:	89 e5                	mov    %esp,%ebp
+  80249d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8024a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a3:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8024a6:	6a 01                	push   $0x1
+  8024a8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024ab:	50                   	push   %eax
+  8024ac:	e8 39 ea ff ff       	call   800eea <sys_cputs>
+}
+  8024b1:	83 c4 10             	add    $0x10,%esp
+  8024b4:	c9                   	leave
+  8024b5:	c3                   	ret
+
+008024b6 <getchar>:
+{
+  8024b6:	55                   	push   %ebp
+  8024b7:	89 e5                	mov    %esp,%ebp
+  8024b9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8024bc:	6a 01                	push   $0x1
+  8024be:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024c1:	50                   	push   %eax
+  8024c2:	6a 00                	push   $0x0
+  8024c4:	e8 66 f2 ff ff       	call   80172f <read>
+	if (r < 0)
+  8024c9:	83 c4 10             	add    $0x10,%esp
+  8024cc:	85 c0                	test   %eax,%eax
+  8024ce:	78 06                	js     8024d6 <getchar+0x20>
+	if (r < 1)
+  8024d0:	74 06                	je     8024d8 <getchar+0x22>
+	return c;
+  8024d2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024d6:	c9                   	leave
+  8024d7:	c3                   	ret
+		return -E_EOF;
+  8024d8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024dd:	eb f7                	jmp    8024d6 <getchar+0x20>
+
+008024df <iscons>:
+{
+  8024df:	55                   	push   %ebp
+  8024e0:	89 e5                	mov    %esp,%ebp
+  8024e2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024e8:	50                   	push   %eax
+  8024e9:	ff 75 08             	push   0x8(%ebp)
+  8024ec:	e8 d8 ef ff ff       	call   8014c9 <fd_lookup>
+  8024f1:	83 c4 10             	add    $0x10,%esp
+  8024f4:	85 c0                	test   %eax,%eax
+  8024f6:	78 11                	js     802509 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024fb:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802501:	39 10                	cmp    %edx,(%eax)
+  802503:	0f 94 c0             	sete   %al
+  802506:	0f b6 c0             	movzbl %al,%eax
+}
+  802509:	c9                   	leave
+  80250a:	c3                   	ret
+
+0080250b <opencons>:
+{
+  80250b:	55                   	push   %ebp
+  80250c:	89 e5                	mov    %esp,%ebp
+  80250e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802511:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802514:	50                   	push   %eax
+  802515:	e8 59 ef ff ff       	call   801473 <fd_alloc>
+  80251a:	83 c4 10             	add    $0x10,%esp
+  80251d:	85 c0                	test   %eax,%eax
+  80251f:	78 3a                	js     80255b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802521:	83 ec 04             	sub    $0x4,%esp
+  802524:	68 07 04 00 00       	push   $0x407
+  802529:	ff 75 f4             	push   -0xc(%ebp)
+  80252c:	6a 00                	push   $0x0
+  80252e:	e8 f4 ea ff ff       	call   801027 <sys_page_alloc>
+  802533:	83 c4 10             	add    $0x10,%esp
+  802536:	85 c0                	test   %eax,%eax
+  802538:	78 21                	js     80255b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80253a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80253d:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802543:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802545:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802548:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80254f:	83 ec 0c             	sub    $0xc,%esp
+  802552:	50                   	push   %eax
+  802553:	e8 f4 ee ff ff       	call   80144c <fd2num>
+  802558:	83 c4 10             	add    $0x10,%esp
+}
+  80255b:	c9                   	leave
+  80255c:	c3                   	ret
+
+0080255d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80255d:	55                   	push   %ebp
+  80255e:	89 e5                	mov    %esp,%ebp
+  802560:	56                   	push   %esi
+  802561:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802562:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802565:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  80256b:	e8 18 ea ff ff       	call   800f88 <sys_getenvid>
+  802570:	83 ec 0c             	sub    $0xc,%esp
+  802573:	ff 75 0c             	push   0xc(%ebp)
+  802576:	ff 75 08             	push   0x8(%ebp)
+  802579:	56                   	push   %esi
+  80257a:	50                   	push   %eax
+  80257b:	68 94 30 80 00       	push   $0x803094
+  802580:	e8 47 e0 ff ff       	call   8005cc <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802585:	83 c4 18             	add    $0x18,%esp
+  802588:	53                   	push   %ebx
+  802589:	ff 75 10             	push   0x10(%ebp)
+  80258c:	e8 ea df ff ff       	call   80057b <vcprintf>
+	cprintf("\n");
+  802591:	c7 04 24 d4 2b 80 00 	movl   $0x802bd4,(%esp)
+  802598:	e8 2f e0 ff ff       	call   8005cc <cprintf>
+  80259d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8025a0:	cc                   	int3
+	while (1)
+  8025a1:	eb fd                	jmp    8025a0 <_panic+0x43>
+
+008025a3 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8025a3:	55                   	push   %ebp
+  8025a4:	89 e5                	mov    %esp,%ebp
+  8025a6:	57                   	push   %edi
+  8025a7:	56                   	push   %esi
+  8025a8:	53                   	push   %ebx
+  8025a9:	83 ec 18             	sub    $0x18,%esp
+  8025ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025b2:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8025b5:	85 db                	test   %ebx,%ebx
+  8025b7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8025bc:	0f 45 c3             	cmovne %ebx,%eax
+  8025bf:	50                   	push   %eax
+  8025c0:	e8 e5 ed ff ff       	call   8013aa <sys_ipc_recv>
+
+	if (from_env_store)
+  8025c5:	83 c4 10             	add    $0x10,%esp
+  8025c8:	85 ff                	test   %edi,%edi
+  8025ca:	74 17                	je     8025e3 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8025cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d1:	85 c0                	test   %eax,%eax
+  8025d3:	75 0c                	jne    8025e1 <ipc_recv+0x3e>
+  8025d5:	8b 15 18 50 80 00    	mov    0x805018,%edx
+  8025db:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8025e1:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8025e3:	85 f6                	test   %esi,%esi
+  8025e5:	74 2e                	je     802615 <ipc_recv+0x72>
+		if (!r && pg)
+  8025e7:	85 c0                	test   %eax,%eax
+  8025e9:	75 24                	jne    80260f <ipc_recv+0x6c>
+  8025eb:	85 db                	test   %ebx,%ebx
+  8025ed:	74 20                	je     80260f <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8025ef:	a1 18 50 80 00       	mov    0x805018,%eax
+  8025f4:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8025fa:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8025fc:	a1 18 50 80 00       	mov    0x805018,%eax
+  802601:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802607:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80260a:	5b                   	pop    %ebx
+  80260b:	5e                   	pop    %esi
+  80260c:	5f                   	pop    %edi
+  80260d:	5d                   	pop    %ebp
+  80260e:	c3                   	ret
+			*perm_store = 0;
+  80260f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802615:	85 c0                	test   %eax,%eax
+  802617:	75 ee                	jne    802607 <ipc_recv+0x64>
+  802619:	eb e1                	jmp    8025fc <ipc_recv+0x59>
+
+0080261b <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80261b:	55                   	push   %ebp
+  80261c:	89 e5                	mov    %esp,%ebp
+  80261e:	57                   	push   %edi
+  80261f:	56                   	push   %esi
+  802620:	53                   	push   %ebx
+  802621:	83 ec 0c             	sub    $0xc,%esp
+  802624:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802627:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80262a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80262d:	85 db                	test   %ebx,%ebx
+  80262f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802634:	0f 44 d8             	cmove  %eax,%ebx
+  802637:	ff 75 14             	push   0x14(%ebp)
+  80263a:	53                   	push   %ebx
+  80263b:	56                   	push   %esi
+  80263c:	57                   	push   %edi
+  80263d:	e8 45 ed ff ff       	call   801387 <sys_ipc_try_send_yield>
+  802642:	83 c4 10             	add    $0x10,%esp
+  802645:	85 c0                	test   %eax,%eax
+  802647:	79 1e                	jns    802667 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802649:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80264c:	75 07                	jne    802655 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80264e:	e8 54 e9 ff ff       	call   800fa7 <sys_yield>
+  802653:	eb e2                	jmp    802637 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802655:	50                   	push   %eax
+  802656:	68 b7 30 80 00       	push   $0x8030b7
+  80265b:	6a 3d                	push   $0x3d
+  80265d:	68 cc 30 80 00       	push   $0x8030cc
+  802662:	e8 f6 fe ff ff       	call   80255d <_panic>
+	}
+}
+  802667:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80266a:	5b                   	pop    %ebx
+  80266b:	5e                   	pop    %esi
+  80266c:	5f                   	pop    %edi
+  80266d:	5d                   	pop    %ebp
+  80266e:	c3                   	ret
+
+0080266f <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80266f:	55                   	push   %ebp
+  802670:	89 e5                	mov    %esp,%ebp
+  802672:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802675:	ff 75 08             	push   0x8(%ebp)
+  802678:	e8 aa e8 ff ff       	call   800f27 <sys_env_find>
+}
+  80267d:	c9                   	leave
+  80267e:	c3                   	ret
+
+0080267f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80267f:	55                   	push   %ebp
+  802680:	89 e5                	mov    %esp,%ebp
+  802682:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802685:	89 c2                	mov    %eax,%edx
+  802687:	c1 ea 16             	shr    $0x16,%edx
+  80268a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802691:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802696:	f6 c1 01             	test   $0x1,%cl
+  802699:	74 22                	je     8026bd <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80269b:	c1 e8 0c             	shr    $0xc,%eax
+  80269e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8026a5:	a8 01                	test   $0x1,%al
+  8026a7:	74 14                	je     8026bd <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8026a9:	c1 e8 0c             	shr    $0xc,%eax
+  8026ac:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026af:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8026b6:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8026ba:	0f b7 d2             	movzwl %dx,%edx
+}
+  8026bd:	89 d0                	mov    %edx,%eax
+  8026bf:	5d                   	pop    %ebp
+  8026c0:	c3                   	ret
+  8026c1:	66 90                	xchg   %ax,%ax
+  8026c3:	66 90                	xchg   %ax,%ax
+  8026c5:	66 90                	xchg   %ax,%ax
+  8026c7:	66 90                	xchg   %ax,%ax
+  8026c9:	66 90                	xchg   %ax,%ax
+  8026cb:	66 90                	xchg   %ax,%ax
+  8026cd:	66 90                	xchg   %ax,%ax
+  8026cf:	90                   	nop
+
+008026d0 <__udivmoddi4>:
+  8026d0:	55                   	push   %ebp
+  8026d1:	57                   	push   %edi
+  8026d2:	56                   	push   %esi
+  8026d3:	53                   	push   %ebx
+  8026d4:	83 ec 14             	sub    $0x14,%esp
+  8026d7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8026db:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8026df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026e7:	89 f1                	mov    %esi,%ecx
+  8026e9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8026ed:	09 d9                	or     %ebx,%ecx
+  8026ef:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8026f3:	0f 84 92 00 00 00    	je     80278b <__udivmoddi4+0xbb>
+  8026f9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802700:	00 
+  802701:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802706:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80270d:	00 
+  80270e:	89 1c 24             	mov    %ebx,(%esp)
+  802711:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802715:	8d 76 00             	lea    0x0(%esi),%esi
+  802718:	89 e9                	mov    %ebp,%ecx
+  80271a:	89 c3                	mov    %eax,%ebx
+  80271c:	89 d6                	mov    %edx,%esi
+  80271e:	31 ff                	xor    %edi,%edi
+  802720:	d3 ee                	shr    %cl,%esi
+  802722:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802725:	f6 c1 20             	test   $0x20,%cl
+  802728:	0f 45 de             	cmovne %esi,%ebx
+  80272b:	0f 45 f7             	cmovne %edi,%esi
+  80272e:	8b 3c 24             	mov    (%esp),%edi
+  802731:	39 fb                	cmp    %edi,%ebx
+  802733:	89 f7                	mov    %esi,%edi
+  802735:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802739:	8b 1c 24             	mov    (%esp),%ebx
+  80273c:	19 f7                	sbb    %esi,%edi
+  80273e:	72 39                	jb     802779 <__udivmoddi4+0xa9>
+  802740:	89 e9                	mov    %ebp,%ecx
+  802742:	89 f7                	mov    %esi,%edi
+  802744:	89 de                	mov    %ebx,%esi
+  802746:	0f a5 df             	shld   %cl,%ebx,%edi
+  802749:	d3 e6                	shl    %cl,%esi
+  80274b:	31 db                	xor    %ebx,%ebx
+  80274d:	f6 c1 20             	test   $0x20,%cl
+  802750:	0f 45 fe             	cmovne %esi,%edi
+  802753:	0f 45 f3             	cmovne %ebx,%esi
+  802756:	29 f0                	sub    %esi,%eax
+  802758:	be 01 00 00 00       	mov    $0x1,%esi
+  80275d:	19 fa                	sbb    %edi,%edx
+  80275f:	31 ff                	xor    %edi,%edi
+  802761:	31 db                	xor    %ebx,%ebx
+  802763:	0f a5 f7             	shld   %cl,%esi,%edi
+  802766:	d3 e6                	shl    %cl,%esi
+  802768:	f6 c1 20             	test   $0x20,%cl
+  80276b:	0f 45 fe             	cmovne %esi,%edi
+  80276e:	0f 45 f3             	cmovne %ebx,%esi
+  802771:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802775:	09 74 24 08          	or     %esi,0x8(%esp)
+  802779:	83 ed 01             	sub    $0x1,%ebp
+  80277c:	73 9a                	jae    802718 <__udivmoddi4+0x48>
+  80277e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802782:	85 ff                	test   %edi,%edi
+  802784:	74 05                	je     80278b <__udivmoddi4+0xbb>
+  802786:	89 07                	mov    %eax,(%edi)
+  802788:	89 57 04             	mov    %edx,0x4(%edi)
+  80278b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80278f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802793:	83 c4 14             	add    $0x14,%esp
+  802796:	5b                   	pop    %ebx
+  802797:	5e                   	pop    %esi
+  802798:	5f                   	pop    %edi
+  802799:	5d                   	pop    %ebp
+  80279a:	c3                   	ret
+  80279b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80279f:	90                   	nop
+
+008027a0 <__udivdi3>:
+  8027a0:	55                   	push   %ebp
+  8027a1:	57                   	push   %edi
+  8027a2:	56                   	push   %esi
+  8027a3:	53                   	push   %ebx
+  8027a4:	83 ec 14             	sub    $0x14,%esp
+  8027a7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8027ab:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8027af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027b7:	89 fb                	mov    %edi,%ebx
+  8027b9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8027bd:	09 f3                	or     %esi,%ebx
+  8027bf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8027c3:	0f 84 85 00 00 00    	je     80284e <__udivdi3+0xae>
+  8027c9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027d0:	00 
+  8027d1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8027d6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027dd:	00 
+  8027de:	89 34 24             	mov    %esi,(%esp)
+  8027e1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8027e5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027e8:	89 e9                	mov    %ebp,%ecx
+  8027ea:	89 c3                	mov    %eax,%ebx
+  8027ec:	89 d6                	mov    %edx,%esi
+  8027ee:	31 ff                	xor    %edi,%edi
+  8027f0:	d3 ee                	shr    %cl,%esi
+  8027f2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8027f5:	f6 c1 20             	test   $0x20,%cl
+  8027f8:	0f 45 de             	cmovne %esi,%ebx
+  8027fb:	0f 45 f7             	cmovne %edi,%esi
+  8027fe:	8b 3c 24             	mov    (%esp),%edi
+  802801:	39 fb                	cmp    %edi,%ebx
+  802803:	89 f7                	mov    %esi,%edi
+  802805:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802809:	8b 1c 24             	mov    (%esp),%ebx
+  80280c:	19 f7                	sbb    %esi,%edi
+  80280e:	72 39                	jb     802849 <__udivdi3+0xa9>
+  802810:	89 e9                	mov    %ebp,%ecx
+  802812:	89 f7                	mov    %esi,%edi
+  802814:	89 de                	mov    %ebx,%esi
+  802816:	0f a5 df             	shld   %cl,%ebx,%edi
+  802819:	d3 e6                	shl    %cl,%esi
+  80281b:	31 db                	xor    %ebx,%ebx
+  80281d:	f6 c1 20             	test   $0x20,%cl
+  802820:	0f 45 fe             	cmovne %esi,%edi
+  802823:	0f 45 f3             	cmovne %ebx,%esi
+  802826:	29 f0                	sub    %esi,%eax
+  802828:	be 01 00 00 00       	mov    $0x1,%esi
+  80282d:	19 fa                	sbb    %edi,%edx
+  80282f:	31 ff                	xor    %edi,%edi
+  802831:	31 db                	xor    %ebx,%ebx
+  802833:	0f a5 f7             	shld   %cl,%esi,%edi
+  802836:	d3 e6                	shl    %cl,%esi
+  802838:	f6 c1 20             	test   $0x20,%cl
+  80283b:	0f 45 fe             	cmovne %esi,%edi
+  80283e:	0f 45 f3             	cmovne %ebx,%esi
+  802841:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802845:	09 74 24 08          	or     %esi,0x8(%esp)
+  802849:	83 ed 01             	sub    $0x1,%ebp
+  80284c:	73 9a                	jae    8027e8 <__udivdi3+0x48>
+  80284e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802852:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802856:	83 c4 14             	add    $0x14,%esp
+  802859:	5b                   	pop    %ebx
+  80285a:	5e                   	pop    %esi
+  80285b:	5f                   	pop    %edi
+  80285c:	5d                   	pop    %ebp
+  80285d:	c3                   	ret
+  80285e:	66 90                	xchg   %ax,%ax
+
+00802860 <__umoddi3>:
+  802860:	57                   	push   %edi
+  802861:	56                   	push   %esi
+  802862:	53                   	push   %ebx
+  802863:	83 ec 08             	sub    $0x8,%esp
+  802866:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80286a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80286e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802872:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802876:	89 f9                	mov    %edi,%ecx
+  802878:	89 34 24             	mov    %esi,(%esp)
+  80287b:	09 f1                	or     %esi,%ecx
+  80287d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802881:	74 53                	je     8028d6 <__umoddi3+0x76>
+  802883:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80288f:	90                   	nop
+  802890:	89 c6                	mov    %eax,%esi
+  802892:	89 d7                	mov    %edx,%edi
+  802894:	31 db                	xor    %ebx,%ebx
+  802896:	d3 ef                	shr    %cl,%edi
+  802898:	0f ad d6             	shrd   %cl,%edx,%esi
+  80289b:	f6 c1 20             	test   $0x20,%cl
+  80289e:	0f 45 f7             	cmovne %edi,%esi
+  8028a1:	0f 45 fb             	cmovne %ebx,%edi
+  8028a4:	8b 1c 24             	mov    (%esp),%ebx
+  8028a7:	39 de                	cmp    %ebx,%esi
+  8028a9:	89 fb                	mov    %edi,%ebx
+  8028ab:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8028af:	8b 34 24             	mov    (%esp),%esi
+  8028b2:	19 fb                	sbb    %edi,%ebx
+  8028b4:	72 14                	jb     8028ca <__umoddi3+0x6a>
+  8028b6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8028b9:	31 db                	xor    %ebx,%ebx
+  8028bb:	d3 e6                	shl    %cl,%esi
+  8028bd:	f6 c1 20             	test   $0x20,%cl
+  8028c0:	0f 45 fe             	cmovne %esi,%edi
+  8028c3:	0f 45 f3             	cmovne %ebx,%esi
+  8028c6:	29 f0                	sub    %esi,%eax
+  8028c8:	19 fa                	sbb    %edi,%edx
+  8028ca:	83 e9 01             	sub    $0x1,%ecx
+  8028cd:	73 c1                	jae    802890 <__umoddi3+0x30>
+  8028cf:	83 c4 08             	add    $0x8,%esp
+  8028d2:	5b                   	pop    %ebx
+  8028d3:	5e                   	pop    %esi
+  8028d4:	5f                   	pop    %edi
+  8028d5:	c3                   	ret
+  8028d6:	83 c4 08             	add    $0x8,%esp
+  8028d9:	31 c0                	xor    %eax,%eax
+  8028db:	31 d2                	xor    %edx,%edx
+  8028dd:	5b                   	pop    %ebx
+  8028de:	5e                   	pop    %esi
+  8028df:	5f                   	pop    %edi
+  8028e0:	c3                   	ret
+  8028e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028ef:	90                   	nop
+
+008028f0 <__divdi3>:
+  8028f0:	55                   	push   %ebp
+  8028f1:	57                   	push   %edi
+  8028f2:	56                   	push   %esi
+  8028f3:	53                   	push   %ebx
+  8028f4:	83 ec 1c             	sub    $0x1c,%esp
+  8028f7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8028fb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8028ff:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802903:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802907:	85 ff                	test   %edi,%edi
+  802909:	0f 88 da 00 00 00    	js     8029e9 <__divdi3+0xf9>
+  80290f:	85 db                	test   %ebx,%ebx
+  802911:	78 16                	js     802929 <__divdi3+0x39>
+  802913:	89 dd                	mov    %ebx,%ebp
+  802915:	89 c8                	mov    %ecx,%eax
+  802917:	89 da                	mov    %ebx,%edx
+  802919:	09 cd                	or     %ecx,%ebp
+  80291b:	0f 85 fd 00 00 00    	jne    802a1e <__divdi3+0x12e>
+  802921:	83 c4 1c             	add    $0x1c,%esp
+  802924:	5b                   	pop    %ebx
+  802925:	5e                   	pop    %esi
+  802926:	5f                   	pop    %edi
+  802927:	5d                   	pop    %ebp
+  802928:	c3                   	ret
+  802929:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80292e:	f7 d9                	neg    %ecx
+  802930:	89 f0                	mov    %esi,%eax
+  802932:	89 fa                	mov    %edi,%edx
+  802934:	83 d3 00             	adc    $0x0,%ebx
+  802937:	89 0c 24             	mov    %ecx,(%esp)
+  80293a:	f7 db                	neg    %ebx
+  80293c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802940:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802947:	00 
+  802948:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80294d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802954:	00 
+  802955:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802959:	89 cd                	mov    %ecx,%ebp
+  80295b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80295f:	90                   	nop
+  802960:	89 e9                	mov    %ebp,%ecx
+  802962:	89 c3                	mov    %eax,%ebx
+  802964:	89 d6                	mov    %edx,%esi
+  802966:	31 ff                	xor    %edi,%edi
+  802968:	d3 ee                	shr    %cl,%esi
+  80296a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80296d:	f6 c1 20             	test   $0x20,%cl
+  802970:	0f 45 de             	cmovne %esi,%ebx
+  802973:	0f 45 f7             	cmovne %edi,%esi
+  802976:	8b 3c 24             	mov    (%esp),%edi
+  802979:	39 fb                	cmp    %edi,%ebx
+  80297b:	89 f7                	mov    %esi,%edi
+  80297d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802981:	8b 1c 24             	mov    (%esp),%ebx
+  802984:	19 f7                	sbb    %esi,%edi
+  802986:	72 39                	jb     8029c1 <__divdi3+0xd1>
+  802988:	89 e9                	mov    %ebp,%ecx
+  80298a:	89 f7                	mov    %esi,%edi
+  80298c:	89 de                	mov    %ebx,%esi
+  80298e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802991:	d3 e6                	shl    %cl,%esi
+  802993:	31 db                	xor    %ebx,%ebx
+  802995:	f6 c1 20             	test   $0x20,%cl
+  802998:	0f 45 fe             	cmovne %esi,%edi
+  80299b:	0f 45 f3             	cmovne %ebx,%esi
+  80299e:	29 f0                	sub    %esi,%eax
+  8029a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8029a5:	19 fa                	sbb    %edi,%edx
+  8029a7:	31 ff                	xor    %edi,%edi
+  8029a9:	31 db                	xor    %ebx,%ebx
+  8029ab:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029ae:	d3 e6                	shl    %cl,%esi
+  8029b0:	f6 c1 20             	test   $0x20,%cl
+  8029b3:	0f 45 fe             	cmovne %esi,%edi
+  8029b6:	0f 45 f3             	cmovne %ebx,%esi
+  8029b9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8029bd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8029c1:	83 ed 01             	sub    $0x1,%ebp
+  8029c4:	73 9a                	jae    802960 <__divdi3+0x70>
+  8029c6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8029ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029d2:	85 ed                	test   %ebp,%ebp
+  8029d4:	0f 84 47 ff ff ff    	je     802921 <__divdi3+0x31>
+  8029da:	f7 d8                	neg    %eax
+  8029dc:	83 d2 00             	adc    $0x0,%edx
+  8029df:	83 c4 1c             	add    $0x1c,%esp
+  8029e2:	5b                   	pop    %ebx
+  8029e3:	f7 da                	neg    %edx
+  8029e5:	5e                   	pop    %esi
+  8029e6:	5f                   	pop    %edi
+  8029e7:	5d                   	pop    %ebp
+  8029e8:	c3                   	ret
+  8029e9:	f7 de                	neg    %esi
+  8029eb:	83 d7 00             	adc    $0x0,%edi
+  8029ee:	f7 df                	neg    %edi
+  8029f0:	85 db                	test   %ebx,%ebx
+  8029f2:	78 23                	js     802a17 <__divdi3+0x127>
+  8029f4:	89 dd                	mov    %ebx,%ebp
+  8029f6:	89 c8                	mov    %ecx,%eax
+  8029f8:	89 da                	mov    %ebx,%edx
+  8029fa:	09 cd                	or     %ecx,%ebp
+  8029fc:	0f 84 1f ff ff ff    	je     802921 <__divdi3+0x31>
+  802a02:	89 0c 24             	mov    %ecx,(%esp)
+  802a05:	89 f0                	mov    %esi,%eax
+  802a07:	89 fa                	mov    %edi,%edx
+  802a09:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802a0e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a12:	e9 29 ff ff ff       	jmp    802940 <__divdi3+0x50>
+  802a17:	31 ed                	xor    %ebp,%ebp
+  802a19:	e9 10 ff ff ff       	jmp    80292e <__divdi3+0x3e>
+  802a1e:	89 0c 24             	mov    %ecx,(%esp)
+  802a21:	89 f0                	mov    %esi,%eax
+  802a23:	89 fa                	mov    %edi,%edx
+  802a25:	31 ed                	xor    %ebp,%ebp
+  802a27:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a2b:	e9 10 ff ff ff       	jmp    802940 <__divdi3+0x50>
+
+00802a30 <__moddi3>:
+  802a30:	55                   	push   %ebp
+  802a31:	57                   	push   %edi
+  802a32:	56                   	push   %esi
+  802a33:	53                   	push   %ebx
+  802a34:	83 ec 14             	sub    $0x14,%esp
+  802a37:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a3b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a3f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802a43:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802a47:	85 d2                	test   %edx,%edx
+  802a49:	0f 88 9b 00 00 00    	js     802aea <__moddi3+0xba>
+  802a4f:	89 f7                	mov    %esi,%edi
+  802a51:	31 ed                	xor    %ebp,%ebp
+  802a53:	09 cf                	or     %ecx,%edi
+  802a55:	0f 84 83 00 00 00    	je     802ade <__moddi3+0xae>
+  802a5b:	89 cb                	mov    %ecx,%ebx
+  802a5d:	89 f7                	mov    %esi,%edi
+  802a5f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802a63:	f7 db                	neg    %ebx
+  802a65:	83 d7 00             	adc    $0x0,%edi
+  802a68:	f7 df                	neg    %edi
+  802a6a:	0f 49 f7             	cmovns %edi,%esi
+  802a6d:	0f 49 cb             	cmovns %ebx,%ecx
+  802a70:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802a74:	89 0c 24             	mov    %ecx,(%esp)
+  802a77:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a7c:	89 cd                	mov    %ecx,%ebp
+  802a7e:	66 90                	xchg   %ax,%ax
+  802a80:	89 e9                	mov    %ebp,%ecx
+  802a82:	89 c3                	mov    %eax,%ebx
+  802a84:	89 d6                	mov    %edx,%esi
+  802a86:	31 ff                	xor    %edi,%edi
+  802a88:	d3 ee                	shr    %cl,%esi
+  802a8a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a8d:	f6 c1 20             	test   $0x20,%cl
+  802a90:	0f 45 de             	cmovne %esi,%ebx
+  802a93:	0f 45 f7             	cmovne %edi,%esi
+  802a96:	8b 3c 24             	mov    (%esp),%edi
+  802a99:	39 fb                	cmp    %edi,%ebx
+  802a9b:	89 f7                	mov    %esi,%edi
+  802a9d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802aa1:	8b 1c 24             	mov    (%esp),%ebx
+  802aa4:	19 f7                	sbb    %esi,%edi
+  802aa6:	72 1a                	jb     802ac2 <__moddi3+0x92>
+  802aa8:	89 e9                	mov    %ebp,%ecx
+  802aaa:	89 f7                	mov    %esi,%edi
+  802aac:	89 de                	mov    %ebx,%esi
+  802aae:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ab1:	d3 e6                	shl    %cl,%esi
+  802ab3:	31 db                	xor    %ebx,%ebx
+  802ab5:	f6 c1 20             	test   $0x20,%cl
+  802ab8:	0f 45 fe             	cmovne %esi,%edi
+  802abb:	0f 45 f3             	cmovne %ebx,%esi
+  802abe:	29 f0                	sub    %esi,%eax
+  802ac0:	19 fa                	sbb    %edi,%edx
+  802ac2:	83 ed 01             	sub    $0x1,%ebp
+  802ac5:	73 b9                	jae    802a80 <__moddi3+0x50>
+  802ac7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802acb:	85 ed                	test   %ebp,%ebp
+  802acd:	74 07                	je     802ad6 <__moddi3+0xa6>
+  802acf:	f7 d8                	neg    %eax
+  802ad1:	83 d2 00             	adc    $0x0,%edx
+  802ad4:	f7 da                	neg    %edx
+  802ad6:	83 c4 14             	add    $0x14,%esp
+  802ad9:	5b                   	pop    %ebx
+  802ada:	5e                   	pop    %esi
+  802adb:	5f                   	pop    %edi
+  802adc:	5d                   	pop    %ebp
+  802add:	c3                   	ret
+  802ade:	83 c4 14             	add    $0x14,%esp
+  802ae1:	31 c0                	xor    %eax,%eax
+  802ae3:	31 d2                	xor    %edx,%edx
+  802ae5:	5b                   	pop    %ebx
+  802ae6:	5e                   	pop    %esi
+  802ae7:	5f                   	pop    %edi
+  802ae8:	5d                   	pop    %ebp
+  802ae9:	c3                   	ret
+  802aea:	89 f7                	mov    %esi,%edi
+  802aec:	09 cf                	or     %ecx,%edi
+  802aee:	74 11                	je     802b01 <__moddi3+0xd1>
+  802af0:	f7 d8                	neg    %eax
+  802af2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802af7:	83 d2 00             	adc    $0x0,%edx
+  802afa:	f7 da                	neg    %edx
+  802afc:	e9 5a ff ff ff       	jmp    802a5b <__moddi3+0x2b>
+  802b01:	31 c0                	xor    %eax,%eax
+  802b03:	31 d2                	xor    %edx,%edx
+  802b05:	eb c8                	jmp    802acf <__moddi3+0x9f>
@@ -0,0 +1,5603 @@
+
+obj/user/fairness.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 70 00 00 00       	call   8000a1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+	envid_t who, id;
+
+	id = sys_getenvid();
+  80003b:	e8 12 0b 00 00       	call   800b52 <sys_getenvid>
+  800040:	89 c3                	mov    %eax,%ebx
+
+	if (thisenv == &envs[1]) {
+  800042:	81 3d 08 40 80 00 00 	cmpl   $0xeec00200,0x804008
+  800049:	02 c0 ee 
+  80004c:	74 2d                	je     80007b <umain+0x48>
+		while (1) {
+			ipc_recv(&who, 0, 0);
+			cprintf("%x recv from %x\n", id, who);
+		}
+	} else {
+		cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80004e:	a1 4c 02 c0 ee       	mov    0xeec0024c,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	53                   	push   %ebx
+  800058:	68 f1 26 80 00       	push   $0x8026f1
+  80005d:	e8 34 01 00 00       	call   800196 <cprintf>
+  800062:	83 c4 10             	add    $0x10,%esp
+		while (1)
+			ipc_send(envs[1].env_id, 0, 0, 0);
+  800065:	a1 4c 02 c0 ee       	mov    0xeec0024c,%eax
+  80006a:	6a 00                	push   $0x0
+  80006c:	6a 00                	push   $0x0
+  80006e:	6a 00                	push   $0x0
+  800070:	50                   	push   %eax
+  800071:	e8 18 10 00 00       	call   80108e <ipc_send>
+  800076:	83 c4 10             	add    $0x10,%esp
+  800079:	eb ea                	jmp    800065 <umain+0x32>
+			ipc_recv(&who, 0, 0);
+  80007b:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80007e:	83 ec 04             	sub    $0x4,%esp
+  800081:	6a 00                	push   $0x0
+  800083:	6a 00                	push   $0x0
+  800085:	56                   	push   %esi
+  800086:	e8 8b 0f 00 00       	call   801016 <ipc_recv>
+			cprintf("%x recv from %x\n", id, who);
+  80008b:	83 c4 0c             	add    $0xc,%esp
+  80008e:	ff 75 f4             	push   -0xc(%ebp)
+  800091:	53                   	push   %ebx
+  800092:	68 e0 26 80 00       	push   $0x8026e0
+  800097:	e8 fa 00 00 00       	call   800196 <cprintf>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb dd                	jmp    80007e <umain+0x4b>
+
+008000a1 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	56                   	push   %esi
+  8000a5:	53                   	push   %ebx
+  8000a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000ac:	e8 a1 0a 00 00       	call   800b52 <sys_getenvid>
+  8000b1:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000b6:	c1 e0 09             	shl    $0x9,%eax
+  8000b9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000be:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000c3:	85 db                	test   %ebx,%ebx
+  8000c5:	7e 07                	jle    8000ce <libmain+0x2d>
+		binaryname = argv[0];
+  8000c7:	8b 06                	mov    (%esi),%eax
+  8000c9:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ce:	83 ec 08             	sub    $0x8,%esp
+  8000d1:	56                   	push   %esi
+  8000d2:	53                   	push   %ebx
+  8000d3:	e8 5b ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000d8:	e8 0a 00 00 00       	call   8000e7 <exit>
+}
+  8000dd:	83 c4 10             	add    $0x10,%esp
+  8000e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000e3:	5b                   	pop    %ebx
+  8000e4:	5e                   	pop    %esi
+  8000e5:	5d                   	pop    %ebp
+  8000e6:	c3                   	ret
+
+008000e7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e7:	55                   	push   %ebp
+  8000e8:	89 e5                	mov    %esp,%ebp
+  8000ea:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000ed:	e8 d4 11 00 00       	call   8012c6 <close_all>
+	sys_env_destroy(0);
+  8000f2:	83 ec 0c             	sub    $0xc,%esp
+  8000f5:	6a 00                	push   $0x0
+  8000f7:	e8 15 0a 00 00       	call   800b11 <sys_env_destroy>
+}
+  8000fc:	83 c4 10             	add    $0x10,%esp
+  8000ff:	c9                   	leave
+  800100:	c3                   	ret
+
+00800101 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800101:	55                   	push   %ebp
+  800102:	89 e5                	mov    %esp,%ebp
+  800104:	53                   	push   %ebx
+  800105:	83 ec 04             	sub    $0x4,%esp
+  800108:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80010b:	8b 13                	mov    (%ebx),%edx
+  80010d:	8d 42 01             	lea    0x1(%edx),%eax
+  800110:	89 03                	mov    %eax,(%ebx)
+  800112:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800115:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800119:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80011e:	74 09                	je     800129 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800120:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800124:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800127:	c9                   	leave
+  800128:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800129:	83 ec 08             	sub    $0x8,%esp
+  80012c:	68 ff 00 00 00       	push   $0xff
+  800131:	8d 43 08             	lea    0x8(%ebx),%eax
+  800134:	50                   	push   %eax
+  800135:	e8 7a 09 00 00       	call   800ab4 <sys_cputs>
+		b->idx = 0;
+  80013a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800140:	83 c4 10             	add    $0x10,%esp
+  800143:	eb db                	jmp    800120 <putch+0x1f>
+
+00800145 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800145:	55                   	push   %ebp
+  800146:	89 e5                	mov    %esp,%ebp
+  800148:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80014e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800155:	00 00 00 
+	b.cnt = 0;
+  800158:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80015f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800162:	ff 75 0c             	push   0xc(%ebp)
+  800165:	ff 75 08             	push   0x8(%ebp)
+  800168:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80016e:	50                   	push   %eax
+  80016f:	68 01 01 80 00       	push   $0x800101
+  800174:	e8 14 01 00 00       	call   80028d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800179:	83 c4 08             	add    $0x8,%esp
+  80017c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800182:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800188:	50                   	push   %eax
+  800189:	e8 26 09 00 00       	call   800ab4 <sys_cputs>
+
+	return b.cnt;
+}
+  80018e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800194:	c9                   	leave
+  800195:	c3                   	ret
+
+00800196 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800196:	55                   	push   %ebp
+  800197:	89 e5                	mov    %esp,%ebp
+  800199:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80019c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80019f:	50                   	push   %eax
+  8001a0:	ff 75 08             	push   0x8(%ebp)
+  8001a3:	e8 9d ff ff ff       	call   800145 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001a8:	c9                   	leave
+  8001a9:	c3                   	ret
+
+008001aa <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	57                   	push   %edi
+  8001ae:	56                   	push   %esi
+  8001af:	53                   	push   %ebx
+  8001b0:	83 ec 1c             	sub    $0x1c,%esp
+  8001b3:	89 c7                	mov    %eax,%edi
+  8001b5:	89 d6                	mov    %edx,%esi
+  8001b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001bd:	89 d1                	mov    %edx,%ecx
+  8001bf:	89 c2                	mov    %eax,%edx
+  8001c1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001c4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001c7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ca:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001d0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001d7:	39 c2                	cmp    %eax,%edx
+  8001d9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001dc:	72 3e                	jb     80021c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001de:	83 ec 0c             	sub    $0xc,%esp
+  8001e1:	ff 75 18             	push   0x18(%ebp)
+  8001e4:	83 eb 01             	sub    $0x1,%ebx
+  8001e7:	53                   	push   %ebx
+  8001e8:	50                   	push   %eax
+  8001e9:	83 ec 08             	sub    $0x8,%esp
+  8001ec:	ff 75 e4             	push   -0x1c(%ebp)
+  8001ef:	ff 75 e0             	push   -0x20(%ebp)
+  8001f2:	ff 75 dc             	push   -0x24(%ebp)
+  8001f5:	ff 75 d8             	push   -0x28(%ebp)
+  8001f8:	e8 63 21 00 00       	call   802360 <__udivdi3>
+  8001fd:	83 c4 18             	add    $0x18,%esp
+  800200:	52                   	push   %edx
+  800201:	50                   	push   %eax
+  800202:	89 f2                	mov    %esi,%edx
+  800204:	89 f8                	mov    %edi,%eax
+  800206:	e8 9f ff ff ff       	call   8001aa <printnum>
+  80020b:	83 c4 20             	add    $0x20,%esp
+  80020e:	eb 13                	jmp    800223 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800210:	83 ec 08             	sub    $0x8,%esp
+  800213:	56                   	push   %esi
+  800214:	ff 75 18             	push   0x18(%ebp)
+  800217:	ff d7                	call   *%edi
+  800219:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80021c:	83 eb 01             	sub    $0x1,%ebx
+  80021f:	85 db                	test   %ebx,%ebx
+  800221:	7f ed                	jg     800210 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800223:	83 ec 08             	sub    $0x8,%esp
+  800226:	56                   	push   %esi
+  800227:	83 ec 04             	sub    $0x4,%esp
+  80022a:	ff 75 e4             	push   -0x1c(%ebp)
+  80022d:	ff 75 e0             	push   -0x20(%ebp)
+  800230:	ff 75 dc             	push   -0x24(%ebp)
+  800233:	ff 75 d8             	push   -0x28(%ebp)
+  800236:	e8 e5 21 00 00       	call   802420 <__umoddi3>
+  80023b:	83 c4 14             	add    $0x14,%esp
+  80023e:	0f be 80 12 27 80 00 	movsbl 0x802712(%eax),%eax
+  800245:	50                   	push   %eax
+  800246:	ff d7                	call   *%edi
+}
+  800248:	83 c4 10             	add    $0x10,%esp
+  80024b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024e:	5b                   	pop    %ebx
+  80024f:	5e                   	pop    %esi
+  800250:	5f                   	pop    %edi
+  800251:	5d                   	pop    %ebp
+  800252:	c3                   	ret
+
+00800253 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800253:	55                   	push   %ebp
+  800254:	89 e5                	mov    %esp,%ebp
+  800256:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800259:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80025d:	8b 10                	mov    (%eax),%edx
+  80025f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800262:	73 0a                	jae    80026e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800264:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800267:	89 08                	mov    %ecx,(%eax)
+  800269:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026c:	88 02                	mov    %al,(%edx)
+}
+  80026e:	5d                   	pop    %ebp
+  80026f:	c3                   	ret
+
+00800270 <printfmt>:
+{
+  800270:	55                   	push   %ebp
+  800271:	89 e5                	mov    %esp,%ebp
+  800273:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800276:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800279:	50                   	push   %eax
+  80027a:	ff 75 10             	push   0x10(%ebp)
+  80027d:	ff 75 0c             	push   0xc(%ebp)
+  800280:	ff 75 08             	push   0x8(%ebp)
+  800283:	e8 05 00 00 00       	call   80028d <vprintfmt>
+}
+  800288:	83 c4 10             	add    $0x10,%esp
+  80028b:	c9                   	leave
+  80028c:	c3                   	ret
+
+0080028d <vprintfmt>:
+{
+  80028d:	55                   	push   %ebp
+  80028e:	89 e5                	mov    %esp,%ebp
+  800290:	57                   	push   %edi
+  800291:	56                   	push   %esi
+  800292:	53                   	push   %ebx
+  800293:	83 ec 2c             	sub    $0x2c,%esp
+  800296:	8b 75 08             	mov    0x8(%ebp),%esi
+  800299:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80029c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80029f:	eb 0a                	jmp    8002ab <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002a1:	83 ec 08             	sub    $0x8,%esp
+  8002a4:	53                   	push   %ebx
+  8002a5:	50                   	push   %eax
+  8002a6:	ff d6                	call   *%esi
+  8002a8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ab:	83 c7 01             	add    $0x1,%edi
+  8002ae:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002b2:	83 f8 25             	cmp    $0x25,%eax
+  8002b5:	74 0c                	je     8002c3 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002b7:	85 c0                	test   %eax,%eax
+  8002b9:	75 e6                	jne    8002a1 <vprintfmt+0x14>
+}
+  8002bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002be:	5b                   	pop    %ebx
+  8002bf:	5e                   	pop    %esi
+  8002c0:	5f                   	pop    %edi
+  8002c1:	5d                   	pop    %ebp
+  8002c2:	c3                   	ret
+		padc = ' ';
+  8002c3:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002c7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002ce:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002d5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002e1:	8d 47 01             	lea    0x1(%edi),%eax
+  8002e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002e7:	0f b6 17             	movzbl (%edi),%edx
+  8002ea:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002ed:	3c 55                	cmp    $0x55,%al
+  8002ef:	0f 87 cf 03 00 00    	ja     8006c4 <vprintfmt+0x437>
+  8002f5:	0f b6 c0             	movzbl %al,%eax
+  8002f8:	ff 24 85 60 28 80 00 	jmp    *0x802860(,%eax,4)
+  8002ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800302:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800306:	eb d9                	jmp    8002e1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800308:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80030b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80030f:	eb d0                	jmp    8002e1 <vprintfmt+0x54>
+  800311:	0f b6 d2             	movzbl %dl,%edx
+  800314:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800317:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80031f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800322:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800326:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800329:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80032c:	83 f9 09             	cmp    $0x9,%ecx
+  80032f:	77 55                	ja     800386 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800331:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800334:	eb e9                	jmp    80031f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800336:	8b 45 14             	mov    0x14(%ebp),%eax
+  800339:	8b 00                	mov    (%eax),%eax
+  80033b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80033e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800341:	8d 40 04             	lea    0x4(%eax),%eax
+  800344:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800347:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80034a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80034e:	79 91                	jns    8002e1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800350:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800353:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800356:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80035d:	eb 82                	jmp    8002e1 <vprintfmt+0x54>
+			if (width < 0)
+  80035f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800362:	85 d2                	test   %edx,%edx
+  800364:	b8 00 00 00 00       	mov    $0x0,%eax
+  800369:	0f 49 c2             	cmovns %edx,%eax
+  80036c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80036f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800372:	e9 6a ff ff ff       	jmp    8002e1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800377:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80037a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800381:	e9 5b ff ff ff       	jmp    8002e1 <vprintfmt+0x54>
+  800386:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800389:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038c:	eb bc                	jmp    80034a <vprintfmt+0xbd>
+			lflag++;
+  80038e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800391:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800394:	e9 48 ff ff ff       	jmp    8002e1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800399:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039c:	8d 78 04             	lea    0x4(%eax),%edi
+  80039f:	83 ec 08             	sub    $0x8,%esp
+  8003a2:	53                   	push   %ebx
+  8003a3:	ff 30                	push   (%eax)
+  8003a5:	ff d6                	call   *%esi
+			break;
+  8003a7:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003aa:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003ad:	e9 b1 02 00 00       	jmp    800663 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b5:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003b8:	8b 10                	mov    (%eax),%edx
+  8003ba:	89 d0                	mov    %edx,%eax
+  8003bc:	f7 d8                	neg    %eax
+  8003be:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003c1:	83 f8 0f             	cmp    $0xf,%eax
+  8003c4:	7f 23                	jg     8003e9 <vprintfmt+0x15c>
+  8003c6:	8b 14 85 c0 29 80 00 	mov    0x8029c0(,%eax,4),%edx
+  8003cd:	85 d2                	test   %edx,%edx
+  8003cf:	74 18                	je     8003e9 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003d1:	52                   	push   %edx
+  8003d2:	68 15 2b 80 00       	push   $0x802b15
+  8003d7:	53                   	push   %ebx
+  8003d8:	56                   	push   %esi
+  8003d9:	e8 92 fe ff ff       	call   800270 <printfmt>
+  8003de:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003e1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003e4:	e9 7a 02 00 00       	jmp    800663 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003e9:	50                   	push   %eax
+  8003ea:	68 2a 27 80 00       	push   $0x80272a
+  8003ef:	53                   	push   %ebx
+  8003f0:	56                   	push   %esi
+  8003f1:	e8 7a fe ff ff       	call   800270 <printfmt>
+  8003f6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f9:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003fc:	e9 62 02 00 00       	jmp    800663 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800401:	8b 45 14             	mov    0x14(%ebp),%eax
+  800404:	83 c0 04             	add    $0x4,%eax
+  800407:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80040a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80040f:	85 c9                	test   %ecx,%ecx
+  800411:	b8 23 27 80 00       	mov    $0x802723,%eax
+  800416:	0f 45 c1             	cmovne %ecx,%eax
+  800419:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80041c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800420:	7e 06                	jle    800428 <vprintfmt+0x19b>
+  800422:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800426:	75 0b                	jne    800433 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800428:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80042b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80042e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800431:	eb 5c                	jmp    80048f <vprintfmt+0x202>
+  800433:	83 ec 08             	sub    $0x8,%esp
+  800436:	ff 75 d0             	push   -0x30(%ebp)
+  800439:	ff 75 cc             	push   -0x34(%ebp)
+  80043c:	e8 20 03 00 00       	call   800761 <strnlen>
+  800441:	89 c2                	mov    %eax,%edx
+  800443:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800446:	29 d0                	sub    %edx,%eax
+  800448:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80044b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80044f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800452:	89 75 08             	mov    %esi,0x8(%ebp)
+  800455:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800457:	eb 0e                	jmp    800467 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800459:	83 ec 08             	sub    $0x8,%esp
+  80045c:	53                   	push   %ebx
+  80045d:	57                   	push   %edi
+  80045e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800461:	83 ee 01             	sub    $0x1,%esi
+  800464:	83 c4 10             	add    $0x10,%esp
+  800467:	85 f6                	test   %esi,%esi
+  800469:	7f ee                	jg     800459 <vprintfmt+0x1cc>
+  80046b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80046e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800471:	85 c0                	test   %eax,%eax
+  800473:	ba 00 00 00 00       	mov    $0x0,%edx
+  800478:	0f 49 d0             	cmovns %eax,%edx
+  80047b:	29 d0                	sub    %edx,%eax
+  80047d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800480:	eb a6                	jmp    800428 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800482:	83 ec 08             	sub    $0x8,%esp
+  800485:	53                   	push   %ebx
+  800486:	52                   	push   %edx
+  800487:	ff 55 08             	call   *0x8(%ebp)
+  80048a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80048d:	89 f1                	mov    %esi,%ecx
+  80048f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800492:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800496:	0f be d0             	movsbl %al,%edx
+  800499:	85 d2                	test   %edx,%edx
+  80049b:	74 28                	je     8004c5 <vprintfmt+0x238>
+  80049d:	85 ff                	test   %edi,%edi
+  80049f:	78 05                	js     8004a6 <vprintfmt+0x219>
+  8004a1:	83 ef 01             	sub    $0x1,%edi
+  8004a4:	78 30                	js     8004d6 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004a6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004aa:	74 d6                	je     800482 <vprintfmt+0x1f5>
+  8004ac:	0f be c0             	movsbl %al,%eax
+  8004af:	83 e8 20             	sub    $0x20,%eax
+  8004b2:	83 f8 5e             	cmp    $0x5e,%eax
+  8004b5:	76 cb                	jbe    800482 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004b7:	83 ec 08             	sub    $0x8,%esp
+  8004ba:	53                   	push   %ebx
+  8004bb:	6a 3f                	push   $0x3f
+  8004bd:	ff 55 08             	call   *0x8(%ebp)
+  8004c0:	83 c4 10             	add    $0x10,%esp
+  8004c3:	eb c8                	jmp    80048d <vprintfmt+0x200>
+  8004c5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004cb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ce:	01 d0                	add    %edx,%eax
+  8004d0:	29 c8                	sub    %ecx,%eax
+  8004d2:	89 c7                	mov    %eax,%edi
+  8004d4:	eb 13                	jmp    8004e9 <vprintfmt+0x25c>
+  8004d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d9:	eb ed                	jmp    8004c8 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004db:	83 ec 08             	sub    $0x8,%esp
+  8004de:	53                   	push   %ebx
+  8004df:	6a 20                	push   $0x20
+  8004e1:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004e3:	83 ef 01             	sub    $0x1,%edi
+  8004e6:	83 c4 10             	add    $0x10,%esp
+  8004e9:	85 ff                	test   %edi,%edi
+  8004eb:	7f ee                	jg     8004db <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004ed:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004f3:	e9 6b 01 00 00       	jmp    800663 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004f8:	83 f9 01             	cmp    $0x1,%ecx
+  8004fb:	7f 1f                	jg     80051c <vprintfmt+0x28f>
+	else if (lflag)
+  8004fd:	85 c9                	test   %ecx,%ecx
+  8004ff:	74 67                	je     800568 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800501:	8b 45 14             	mov    0x14(%ebp),%eax
+  800504:	8b 00                	mov    (%eax),%eax
+  800506:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800509:	89 c1                	mov    %eax,%ecx
+  80050b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80050e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800511:	8b 45 14             	mov    0x14(%ebp),%eax
+  800514:	8d 40 04             	lea    0x4(%eax),%eax
+  800517:	89 45 14             	mov    %eax,0x14(%ebp)
+  80051a:	eb 17                	jmp    800533 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80051c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051f:	8b 50 04             	mov    0x4(%eax),%edx
+  800522:	8b 00                	mov    (%eax),%eax
+  800524:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800527:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80052a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052d:	8d 40 08             	lea    0x8(%eax),%eax
+  800530:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800533:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800536:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800539:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80053e:	85 c9                	test   %ecx,%ecx
+  800540:	0f 89 03 01 00 00    	jns    800649 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800546:	83 ec 08             	sub    $0x8,%esp
+  800549:	53                   	push   %ebx
+  80054a:	6a 2d                	push   $0x2d
+  80054c:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80054e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800551:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800554:	f7 da                	neg    %edx
+  800556:	83 d1 00             	adc    $0x0,%ecx
+  800559:	f7 d9                	neg    %ecx
+  80055b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80055e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800563:	e9 e1 00 00 00       	jmp    800649 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800568:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056b:	8b 00                	mov    (%eax),%eax
+  80056d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800570:	89 c1                	mov    %eax,%ecx
+  800572:	c1 f9 1f             	sar    $0x1f,%ecx
+  800575:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8d 40 04             	lea    0x4(%eax),%eax
+  80057e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800581:	eb b0                	jmp    800533 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800583:	83 f9 01             	cmp    $0x1,%ecx
+  800586:	7f 1e                	jg     8005a6 <vprintfmt+0x319>
+	else if (lflag)
+  800588:	85 c9                	test   %ecx,%ecx
+  80058a:	74 32                	je     8005be <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80058c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058f:	8b 10                	mov    (%eax),%edx
+  800591:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800596:	8d 40 04             	lea    0x4(%eax),%eax
+  800599:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80059c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005a1:	e9 a3 00 00 00       	jmp    800649 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a9:	8b 10                	mov    (%eax),%edx
+  8005ab:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005ae:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005b9:	e9 8b 00 00 00       	jmp    800649 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c1:	8b 10                	mov    (%eax),%edx
+  8005c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005d3:	eb 74                	jmp    800649 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005d5:	83 f9 01             	cmp    $0x1,%ecx
+  8005d8:	7f 1b                	jg     8005f5 <vprintfmt+0x368>
+	else if (lflag)
+  8005da:	85 c9                	test   %ecx,%ecx
+  8005dc:	74 2c                	je     80060a <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e1:	8b 10                	mov    (%eax),%edx
+  8005e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005ee:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005f3:	eb 54                	jmp    800649 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f8:	8b 10                	mov    (%eax),%edx
+  8005fa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005fd:	8d 40 08             	lea    0x8(%eax),%eax
+  800600:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800603:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800608:	eb 3f                	jmp    800649 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	8b 10                	mov    (%eax),%edx
+  80060f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800614:	8d 40 04             	lea    0x4(%eax),%eax
+  800617:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80061a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80061f:	eb 28                	jmp    800649 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800621:	83 ec 08             	sub    $0x8,%esp
+  800624:	53                   	push   %ebx
+  800625:	6a 30                	push   $0x30
+  800627:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800629:	83 c4 08             	add    $0x8,%esp
+  80062c:	53                   	push   %ebx
+  80062d:	6a 78                	push   $0x78
+  80062f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800631:	8b 45 14             	mov    0x14(%ebp),%eax
+  800634:	8b 10                	mov    (%eax),%edx
+  800636:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80063b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80063e:	8d 40 04             	lea    0x4(%eax),%eax
+  800641:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800644:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800649:	83 ec 0c             	sub    $0xc,%esp
+  80064c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800650:	50                   	push   %eax
+  800651:	ff 75 e0             	push   -0x20(%ebp)
+  800654:	57                   	push   %edi
+  800655:	51                   	push   %ecx
+  800656:	52                   	push   %edx
+  800657:	89 da                	mov    %ebx,%edx
+  800659:	89 f0                	mov    %esi,%eax
+  80065b:	e8 4a fb ff ff       	call   8001aa <printnum>
+			break;
+  800660:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800663:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800666:	e9 40 fc ff ff       	jmp    8002ab <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80066b:	83 f9 01             	cmp    $0x1,%ecx
+  80066e:	7f 1b                	jg     80068b <vprintfmt+0x3fe>
+	else if (lflag)
+  800670:	85 c9                	test   %ecx,%ecx
+  800672:	74 2c                	je     8006a0 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8b 10                	mov    (%eax),%edx
+  800679:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067e:	8d 40 04             	lea    0x4(%eax),%eax
+  800681:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800684:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800689:	eb be                	jmp    800649 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 10                	mov    (%eax),%edx
+  800690:	8b 48 04             	mov    0x4(%eax),%ecx
+  800693:	8d 40 08             	lea    0x8(%eax),%eax
+  800696:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800699:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80069e:	eb a9                	jmp    800649 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a3:	8b 10                	mov    (%eax),%edx
+  8006a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006b5:	eb 92                	jmp    800649 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006b7:	83 ec 08             	sub    $0x8,%esp
+  8006ba:	53                   	push   %ebx
+  8006bb:	6a 25                	push   $0x25
+  8006bd:	ff d6                	call   *%esi
+			break;
+  8006bf:	83 c4 10             	add    $0x10,%esp
+  8006c2:	eb 9f                	jmp    800663 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006c4:	83 ec 08             	sub    $0x8,%esp
+  8006c7:	53                   	push   %ebx
+  8006c8:	6a 25                	push   $0x25
+  8006ca:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006cc:	83 c4 10             	add    $0x10,%esp
+  8006cf:	89 f8                	mov    %edi,%eax
+  8006d1:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006d5:	74 05                	je     8006dc <vprintfmt+0x44f>
+  8006d7:	83 e8 01             	sub    $0x1,%eax
+  8006da:	eb f5                	jmp    8006d1 <vprintfmt+0x444>
+  8006dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006df:	eb 82                	jmp    800663 <vprintfmt+0x3d6>
+
+008006e1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006e1:	55                   	push   %ebp
+  8006e2:	89 e5                	mov    %esp,%ebp
+  8006e4:	83 ec 18             	sub    $0x18,%esp
+  8006e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006ed:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006f0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006f4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006f7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006fe:	85 c0                	test   %eax,%eax
+  800700:	74 26                	je     800728 <vsnprintf+0x47>
+  800702:	85 d2                	test   %edx,%edx
+  800704:	7e 22                	jle    800728 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800706:	ff 75 14             	push   0x14(%ebp)
+  800709:	ff 75 10             	push   0x10(%ebp)
+  80070c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80070f:	50                   	push   %eax
+  800710:	68 53 02 80 00       	push   $0x800253
+  800715:	e8 73 fb ff ff       	call   80028d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80071a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80071d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800720:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800723:	83 c4 10             	add    $0x10,%esp
+}
+  800726:	c9                   	leave
+  800727:	c3                   	ret
+		return -E_INVAL;
+  800728:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80072d:	eb f7                	jmp    800726 <vsnprintf+0x45>
+
+0080072f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80072f:	55                   	push   %ebp
+  800730:	89 e5                	mov    %esp,%ebp
+  800732:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800735:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800738:	50                   	push   %eax
+  800739:	ff 75 10             	push   0x10(%ebp)
+  80073c:	ff 75 0c             	push   0xc(%ebp)
+  80073f:	ff 75 08             	push   0x8(%ebp)
+  800742:	e8 9a ff ff ff       	call   8006e1 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800747:	c9                   	leave
+  800748:	c3                   	ret
+
+00800749 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800749:	55                   	push   %ebp
+  80074a:	89 e5                	mov    %esp,%ebp
+  80074c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80074f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800754:	eb 03                	jmp    800759 <strlen+0x10>
+		n++;
+  800756:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800759:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80075d:	75 f7                	jne    800756 <strlen+0xd>
+	return n;
+}
+  80075f:	5d                   	pop    %ebp
+  800760:	c3                   	ret
+
+00800761 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800761:	55                   	push   %ebp
+  800762:	89 e5                	mov    %esp,%ebp
+  800764:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800767:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80076a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076f:	eb 03                	jmp    800774 <strnlen+0x13>
+		n++;
+  800771:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800774:	39 d0                	cmp    %edx,%eax
+  800776:	74 08                	je     800780 <strnlen+0x1f>
+  800778:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80077c:	75 f3                	jne    800771 <strnlen+0x10>
+  80077e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800780:	89 d0                	mov    %edx,%eax
+  800782:	5d                   	pop    %ebp
+  800783:	c3                   	ret
+
+00800784 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800784:	55                   	push   %ebp
+  800785:	89 e5                	mov    %esp,%ebp
+  800787:	53                   	push   %ebx
+  800788:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80078b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80078e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800793:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800797:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80079a:	83 c0 01             	add    $0x1,%eax
+  80079d:	84 d2                	test   %dl,%dl
+  80079f:	75 f2                	jne    800793 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007a1:	89 c8                	mov    %ecx,%eax
+  8007a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007a6:	c9                   	leave
+  8007a7:	c3                   	ret
+
+008007a8 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007a8:	55                   	push   %ebp
+  8007a9:	89 e5                	mov    %esp,%ebp
+  8007ab:	53                   	push   %ebx
+  8007ac:	83 ec 10             	sub    $0x10,%esp
+  8007af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007b2:	53                   	push   %ebx
+  8007b3:	e8 91 ff ff ff       	call   800749 <strlen>
+  8007b8:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007bb:	ff 75 0c             	push   0xc(%ebp)
+  8007be:	01 d8                	add    %ebx,%eax
+  8007c0:	50                   	push   %eax
+  8007c1:	e8 be ff ff ff       	call   800784 <strcpy>
+	return dst;
+}
+  8007c6:	89 d8                	mov    %ebx,%eax
+  8007c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007cb:	c9                   	leave
+  8007cc:	c3                   	ret
+
+008007cd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007cd:	55                   	push   %ebp
+  8007ce:	89 e5                	mov    %esp,%ebp
+  8007d0:	56                   	push   %esi
+  8007d1:	53                   	push   %ebx
+  8007d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007d8:	89 f3                	mov    %esi,%ebx
+  8007da:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007dd:	89 f0                	mov    %esi,%eax
+  8007df:	eb 0f                	jmp    8007f0 <strncpy+0x23>
+		*dst++ = *src;
+  8007e1:	83 c0 01             	add    $0x1,%eax
+  8007e4:	0f b6 0a             	movzbl (%edx),%ecx
+  8007e7:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007ea:	80 f9 01             	cmp    $0x1,%cl
+  8007ed:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007f0:	39 d8                	cmp    %ebx,%eax
+  8007f2:	75 ed                	jne    8007e1 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007f4:	89 f0                	mov    %esi,%eax
+  8007f6:	5b                   	pop    %ebx
+  8007f7:	5e                   	pop    %esi
+  8007f8:	5d                   	pop    %ebp
+  8007f9:	c3                   	ret
+
+008007fa <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007fa:	55                   	push   %ebp
+  8007fb:	89 e5                	mov    %esp,%ebp
+  8007fd:	56                   	push   %esi
+  8007fe:	53                   	push   %ebx
+  8007ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  800802:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800805:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800808:	89 f0                	mov    %esi,%eax
+  80080a:	85 d2                	test   %edx,%edx
+  80080c:	74 21                	je     80082f <strlcpy+0x35>
+  80080e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800812:	89 f2                	mov    %esi,%edx
+  800814:	eb 09                	jmp    80081f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800816:	83 c1 01             	add    $0x1,%ecx
+  800819:	83 c2 01             	add    $0x1,%edx
+  80081c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80081f:	39 c2                	cmp    %eax,%edx
+  800821:	74 09                	je     80082c <strlcpy+0x32>
+  800823:	0f b6 19             	movzbl (%ecx),%ebx
+  800826:	84 db                	test   %bl,%bl
+  800828:	75 ec                	jne    800816 <strlcpy+0x1c>
+  80082a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80082c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80082f:	29 f0                	sub    %esi,%eax
+}
+  800831:	5b                   	pop    %ebx
+  800832:	5e                   	pop    %esi
+  800833:	5d                   	pop    %ebp
+  800834:	c3                   	ret
+
+00800835 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800835:	55                   	push   %ebp
+  800836:	89 e5                	mov    %esp,%ebp
+  800838:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80083b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80083e:	eb 06                	jmp    800846 <strcmp+0x11>
+		p++, q++;
+  800840:	83 c1 01             	add    $0x1,%ecx
+  800843:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800846:	0f b6 01             	movzbl (%ecx),%eax
+  800849:	84 c0                	test   %al,%al
+  80084b:	74 04                	je     800851 <strcmp+0x1c>
+  80084d:	3a 02                	cmp    (%edx),%al
+  80084f:	74 ef                	je     800840 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800851:	0f b6 c0             	movzbl %al,%eax
+  800854:	0f b6 12             	movzbl (%edx),%edx
+  800857:	29 d0                	sub    %edx,%eax
+}
+  800859:	5d                   	pop    %ebp
+  80085a:	c3                   	ret
+
+0080085b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80085b:	55                   	push   %ebp
+  80085c:	89 e5                	mov    %esp,%ebp
+  80085e:	53                   	push   %ebx
+  80085f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800862:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800865:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800868:	eb 09                	jmp    800873 <strncmp+0x18>
+		n--, p++, q++;
+  80086a:	83 ea 01             	sub    $0x1,%edx
+  80086d:	83 c0 01             	add    $0x1,%eax
+  800870:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800873:	85 d2                	test   %edx,%edx
+  800875:	74 18                	je     80088f <strncmp+0x34>
+  800877:	0f b6 18             	movzbl (%eax),%ebx
+  80087a:	84 db                	test   %bl,%bl
+  80087c:	74 04                	je     800882 <strncmp+0x27>
+  80087e:	3a 19                	cmp    (%ecx),%bl
+  800880:	74 e8                	je     80086a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800882:	0f b6 00             	movzbl (%eax),%eax
+  800885:	0f b6 11             	movzbl (%ecx),%edx
+  800888:	29 d0                	sub    %edx,%eax
+}
+  80088a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80088d:	c9                   	leave
+  80088e:	c3                   	ret
+		return 0;
+  80088f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800894:	eb f4                	jmp    80088a <strncmp+0x2f>
+
+00800896 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800896:	55                   	push   %ebp
+  800897:	89 e5                	mov    %esp,%ebp
+  800899:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008a0:	eb 03                	jmp    8008a5 <strchr+0xf>
+  8008a2:	83 c0 01             	add    $0x1,%eax
+  8008a5:	0f b6 10             	movzbl (%eax),%edx
+  8008a8:	84 d2                	test   %dl,%dl
+  8008aa:	74 06                	je     8008b2 <strchr+0x1c>
+		if (*s == c)
+  8008ac:	38 ca                	cmp    %cl,%dl
+  8008ae:	75 f2                	jne    8008a2 <strchr+0xc>
+  8008b0:	eb 05                	jmp    8008b7 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008b7:	5d                   	pop    %ebp
+  8008b8:	c3                   	ret
+
+008008b9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008c3:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008c6:	38 ca                	cmp    %cl,%dl
+  8008c8:	74 09                	je     8008d3 <strfind+0x1a>
+  8008ca:	84 d2                	test   %dl,%dl
+  8008cc:	74 05                	je     8008d3 <strfind+0x1a>
+	for (; *s; s++)
+  8008ce:	83 c0 01             	add    $0x1,%eax
+  8008d1:	eb f0                	jmp    8008c3 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008d3:	5d                   	pop    %ebp
+  8008d4:	c3                   	ret
+
+008008d5 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008d5:	55                   	push   %ebp
+  8008d6:	89 e5                	mov    %esp,%ebp
+  8008d8:	57                   	push   %edi
+  8008d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008dc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008df:	85 c9                	test   %ecx,%ecx
+  8008e1:	74 20                	je     800903 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008e3:	89 f8                	mov    %edi,%eax
+  8008e5:	09 c8                	or     %ecx,%eax
+  8008e7:	a8 03                	test   $0x3,%al
+  8008e9:	75 12                	jne    8008fd <memset+0x28>
+		c &= 0xFF;
+  8008eb:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008ef:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008f5:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008f8:	fc                   	cld
+  8008f9:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008fb:	eb 06                	jmp    800903 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800900:	fc                   	cld
+  800901:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800903:	89 f8                	mov    %edi,%eax
+  800905:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800908:	c9                   	leave
+  800909:	c3                   	ret
+
+0080090a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	57                   	push   %edi
+  80090e:	56                   	push   %esi
+  80090f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800912:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800915:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800918:	39 c6                	cmp    %eax,%esi
+  80091a:	73 32                	jae    80094e <memmove+0x44>
+  80091c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80091f:	39 d0                	cmp    %edx,%eax
+  800921:	73 2b                	jae    80094e <memmove+0x44>
+		s += n;
+		d += n;
+  800923:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800926:	89 d6                	mov    %edx,%esi
+  800928:	09 fe                	or     %edi,%esi
+  80092a:	09 ce                	or     %ecx,%esi
+  80092c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800932:	75 0e                	jne    800942 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800934:	83 ef 04             	sub    $0x4,%edi
+  800937:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80093a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80093d:	fd                   	std
+  80093e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800940:	eb 09                	jmp    80094b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800942:	83 ef 01             	sub    $0x1,%edi
+  800945:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800948:	fd                   	std
+  800949:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80094b:	fc                   	cld
+  80094c:	eb 1a                	jmp    800968 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80094e:	89 f2                	mov    %esi,%edx
+  800950:	09 c2                	or     %eax,%edx
+  800952:	09 ca                	or     %ecx,%edx
+  800954:	f6 c2 03             	test   $0x3,%dl
+  800957:	75 0a                	jne    800963 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800959:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80095c:	89 c7                	mov    %eax,%edi
+  80095e:	fc                   	cld
+  80095f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800961:	eb 05                	jmp    800968 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800963:	89 c7                	mov    %eax,%edi
+  800965:	fc                   	cld
+  800966:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800968:	5e                   	pop    %esi
+  800969:	5f                   	pop    %edi
+  80096a:	5d                   	pop    %ebp
+  80096b:	c3                   	ret
+
+0080096c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80096c:	55                   	push   %ebp
+  80096d:	89 e5                	mov    %esp,%ebp
+  80096f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800972:	ff 75 10             	push   0x10(%ebp)
+  800975:	ff 75 0c             	push   0xc(%ebp)
+  800978:	ff 75 08             	push   0x8(%ebp)
+  80097b:	e8 8a ff ff ff       	call   80090a <memmove>
+}
+  800980:	c9                   	leave
+  800981:	c3                   	ret
+
+00800982 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800982:	55                   	push   %ebp
+  800983:	89 e5                	mov    %esp,%ebp
+  800985:	56                   	push   %esi
+  800986:	53                   	push   %ebx
+  800987:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80098d:	89 c6                	mov    %eax,%esi
+  80098f:	03 75 10             	add    0x10(%ebp),%esi
+  800992:	eb 06                	jmp    80099a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800994:	83 c0 01             	add    $0x1,%eax
+  800997:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80099a:	39 f0                	cmp    %esi,%eax
+  80099c:	74 14                	je     8009b2 <memcmp+0x30>
+		if (*s1 != *s2)
+  80099e:	0f b6 08             	movzbl (%eax),%ecx
+  8009a1:	0f b6 1a             	movzbl (%edx),%ebx
+  8009a4:	38 d9                	cmp    %bl,%cl
+  8009a6:	74 ec                	je     800994 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009a8:	0f b6 c1             	movzbl %cl,%eax
+  8009ab:	0f b6 db             	movzbl %bl,%ebx
+  8009ae:	29 d8                	sub    %ebx,%eax
+  8009b0:	eb 05                	jmp    8009b7 <memcmp+0x35>
+	}
+
+	return 0;
+  8009b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009b7:	5b                   	pop    %ebx
+  8009b8:	5e                   	pop    %esi
+  8009b9:	5d                   	pop    %ebp
+  8009ba:	c3                   	ret
+
+008009bb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009bb:	55                   	push   %ebp
+  8009bc:	89 e5                	mov    %esp,%ebp
+  8009be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009c4:	89 c2                	mov    %eax,%edx
+  8009c6:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009c9:	eb 03                	jmp    8009ce <memfind+0x13>
+  8009cb:	83 c0 01             	add    $0x1,%eax
+  8009ce:	39 d0                	cmp    %edx,%eax
+  8009d0:	73 04                	jae    8009d6 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009d2:	38 08                	cmp    %cl,(%eax)
+  8009d4:	75 f5                	jne    8009cb <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009d6:	5d                   	pop    %ebp
+  8009d7:	c3                   	ret
+
+008009d8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009d8:	55                   	push   %ebp
+  8009d9:	89 e5                	mov    %esp,%ebp
+  8009db:	57                   	push   %edi
+  8009dc:	56                   	push   %esi
+  8009dd:	53                   	push   %ebx
+  8009de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009e4:	eb 03                	jmp    8009e9 <strtol+0x11>
+		s++;
+  8009e6:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009e9:	0f b6 02             	movzbl (%edx),%eax
+  8009ec:	3c 20                	cmp    $0x20,%al
+  8009ee:	74 f6                	je     8009e6 <strtol+0xe>
+  8009f0:	3c 09                	cmp    $0x9,%al
+  8009f2:	74 f2                	je     8009e6 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009f4:	3c 2b                	cmp    $0x2b,%al
+  8009f6:	74 2a                	je     800a22 <strtol+0x4a>
+	int neg = 0;
+  8009f8:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009fd:	3c 2d                	cmp    $0x2d,%al
+  8009ff:	74 2b                	je     800a2c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a01:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a07:	75 0f                	jne    800a18 <strtol+0x40>
+  800a09:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a0c:	74 28                	je     800a36 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a0e:	85 db                	test   %ebx,%ebx
+  800a10:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a15:	0f 44 d8             	cmove  %eax,%ebx
+  800a18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a1d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a20:	eb 46                	jmp    800a68 <strtol+0x90>
+		s++;
+  800a22:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a25:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a2a:	eb d5                	jmp    800a01 <strtol+0x29>
+		s++, neg = 1;
+  800a2c:	83 c2 01             	add    $0x1,%edx
+  800a2f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a34:	eb cb                	jmp    800a01 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a36:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a3a:	74 0e                	je     800a4a <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a3c:	85 db                	test   %ebx,%ebx
+  800a3e:	75 d8                	jne    800a18 <strtol+0x40>
+		s++, base = 8;
+  800a40:	83 c2 01             	add    $0x1,%edx
+  800a43:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a48:	eb ce                	jmp    800a18 <strtol+0x40>
+		s += 2, base = 16;
+  800a4a:	83 c2 02             	add    $0x2,%edx
+  800a4d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a52:	eb c4                	jmp    800a18 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a54:	0f be c0             	movsbl %al,%eax
+  800a57:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a5a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a5d:	7d 3a                	jge    800a99 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a5f:	83 c2 01             	add    $0x1,%edx
+  800a62:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a66:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a68:	0f b6 02             	movzbl (%edx),%eax
+  800a6b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a6e:	89 f3                	mov    %esi,%ebx
+  800a70:	80 fb 09             	cmp    $0x9,%bl
+  800a73:	76 df                	jbe    800a54 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a75:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a78:	89 f3                	mov    %esi,%ebx
+  800a7a:	80 fb 19             	cmp    $0x19,%bl
+  800a7d:	77 08                	ja     800a87 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a7f:	0f be c0             	movsbl %al,%eax
+  800a82:	83 e8 57             	sub    $0x57,%eax
+  800a85:	eb d3                	jmp    800a5a <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a87:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a8a:	89 f3                	mov    %esi,%ebx
+  800a8c:	80 fb 19             	cmp    $0x19,%bl
+  800a8f:	77 08                	ja     800a99 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a91:	0f be c0             	movsbl %al,%eax
+  800a94:	83 e8 37             	sub    $0x37,%eax
+  800a97:	eb c1                	jmp    800a5a <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a99:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a9d:	74 05                	je     800aa4 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aa2:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800aa4:	89 c8                	mov    %ecx,%eax
+  800aa6:	f7 d8                	neg    %eax
+  800aa8:	85 ff                	test   %edi,%edi
+  800aaa:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aad:	89 c8                	mov    %ecx,%eax
+  800aaf:	5b                   	pop    %ebx
+  800ab0:	5e                   	pop    %esi
+  800ab1:	5f                   	pop    %edi
+  800ab2:	5d                   	pop    %ebp
+  800ab3:	c3                   	ret
+
+00800ab4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ab4:	55                   	push   %ebp
+  800ab5:	89 e5                	mov    %esp,%ebp
+  800ab7:	57                   	push   %edi
+  800ab8:	56                   	push   %esi
+  800ab9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800aba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac5:	89 c3                	mov    %eax,%ebx
+  800ac7:	89 c7                	mov    %eax,%edi
+  800ac9:	89 c6                	mov    %eax,%esi
+  800acb:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800acd:	5b                   	pop    %ebx
+  800ace:	5e                   	pop    %esi
+  800acf:	5f                   	pop    %edi
+  800ad0:	5d                   	pop    %ebp
+  800ad1:	c3                   	ret
+
+00800ad2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	57                   	push   %edi
+  800ad6:	56                   	push   %esi
+  800ad7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ad8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800add:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ae2:	89 d1                	mov    %edx,%ecx
+  800ae4:	89 d3                	mov    %edx,%ebx
+  800ae6:	89 d7                	mov    %edx,%edi
+  800ae8:	89 d6                	mov    %edx,%esi
+  800aea:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800aec:	5b                   	pop    %ebx
+  800aed:	5e                   	pop    %esi
+  800aee:	5f                   	pop    %edi
+  800aef:	5d                   	pop    %ebp
+  800af0:	c3                   	ret
+
+00800af1 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800af1:	55                   	push   %ebp
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	57                   	push   %edi
+  800af5:	56                   	push   %esi
+  800af6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800af7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800afc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aff:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b04:	89 cb                	mov    %ecx,%ebx
+  800b06:	89 cf                	mov    %ecx,%edi
+  800b08:	89 ce                	mov    %ecx,%esi
+  800b0a:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b0c:	5b                   	pop    %ebx
+  800b0d:	5e                   	pop    %esi
+  800b0e:	5f                   	pop    %edi
+  800b0f:	5d                   	pop    %ebp
+  800b10:	c3                   	ret
+
+00800b11 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b11:	55                   	push   %ebp
+  800b12:	89 e5                	mov    %esp,%ebp
+  800b14:	57                   	push   %edi
+  800b15:	56                   	push   %esi
+  800b16:	53                   	push   %ebx
+  800b17:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b22:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b27:	89 cb                	mov    %ecx,%ebx
+  800b29:	89 cf                	mov    %ecx,%edi
+  800b2b:	89 ce                	mov    %ecx,%esi
+  800b2d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b2f:	85 c0                	test   %eax,%eax
+  800b31:	7f 08                	jg     800b3b <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b36:	5b                   	pop    %ebx
+  800b37:	5e                   	pop    %esi
+  800b38:	5f                   	pop    %edi
+  800b39:	5d                   	pop    %ebp
+  800b3a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b3b:	83 ec 0c             	sub    $0xc,%esp
+  800b3e:	50                   	push   %eax
+  800b3f:	6a 03                	push   $0x3
+  800b41:	68 1f 2a 80 00       	push   $0x802a1f
+  800b46:	6a 23                	push   $0x23
+  800b48:	68 3c 2a 80 00       	push   $0x802a3c
+  800b4d:	e8 b1 16 00 00       	call   802203 <_panic>
+
+00800b52 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b52:	55                   	push   %ebp
+  800b53:	89 e5                	mov    %esp,%ebp
+  800b55:	57                   	push   %edi
+  800b56:	56                   	push   %esi
+  800b57:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b5d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b62:	89 d1                	mov    %edx,%ecx
+  800b64:	89 d3                	mov    %edx,%ebx
+  800b66:	89 d7                	mov    %edx,%edi
+  800b68:	89 d6                	mov    %edx,%esi
+  800b6a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b6c:	5b                   	pop    %ebx
+  800b6d:	5e                   	pop    %esi
+  800b6e:	5f                   	pop    %edi
+  800b6f:	5d                   	pop    %ebp
+  800b70:	c3                   	ret
+
+00800b71 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b71:	55                   	push   %ebp
+  800b72:	89 e5                	mov    %esp,%ebp
+  800b74:	57                   	push   %edi
+  800b75:	56                   	push   %esi
+  800b76:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b77:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800b81:	89 d1                	mov    %edx,%ecx
+  800b83:	89 d3                	mov    %edx,%ebx
+  800b85:	89 d7                	mov    %edx,%edi
+  800b87:	89 d6                	mov    %edx,%esi
+  800b89:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b8b:	5b                   	pop    %ebx
+  800b8c:	5e                   	pop    %esi
+  800b8d:	5f                   	pop    %edi
+  800b8e:	5d                   	pop    %ebp
+  800b8f:	c3                   	ret
+
+00800b90 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800b90:	55                   	push   %ebp
+  800b91:	89 e5                	mov    %esp,%ebp
+  800b93:	57                   	push   %edi
+  800b94:	56                   	push   %esi
+  800b95:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b9b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ba0:	89 d1                	mov    %edx,%ecx
+  800ba2:	89 d3                	mov    %edx,%ebx
+  800ba4:	89 d7                	mov    %edx,%edi
+  800ba6:	89 d6                	mov    %edx,%esi
+  800ba8:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800baa:	5b                   	pop    %ebx
+  800bab:	5e                   	pop    %esi
+  800bac:	5f                   	pop    %edi
+  800bad:	5d                   	pop    %ebp
+  800bae:	c3                   	ret
+
+00800baf <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	57                   	push   %edi
+  800bb3:	56                   	push   %esi
+  800bb4:	53                   	push   %ebx
+  800bb5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc3:	b8 15 00 00 00       	mov    $0x15,%eax
+  800bc8:	89 df                	mov    %ebx,%edi
+  800bca:	89 de                	mov    %ebx,%esi
+  800bcc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bce:	85 c0                	test   %eax,%eax
+  800bd0:	7f 08                	jg     800bda <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800bd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd5:	5b                   	pop    %ebx
+  800bd6:	5e                   	pop    %esi
+  800bd7:	5f                   	pop    %edi
+  800bd8:	5d                   	pop    %ebp
+  800bd9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bda:	83 ec 0c             	sub    $0xc,%esp
+  800bdd:	50                   	push   %eax
+  800bde:	6a 15                	push   $0x15
+  800be0:	68 1f 2a 80 00       	push   $0x802a1f
+  800be5:	6a 23                	push   $0x23
+  800be7:	68 3c 2a 80 00       	push   $0x802a3c
+  800bec:	e8 12 16 00 00       	call   802203 <_panic>
+
+00800bf1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	57                   	push   %edi
+  800bf5:	56                   	push   %esi
+  800bf6:	53                   	push   %ebx
+  800bf7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bfa:	be 00 00 00 00       	mov    $0x0,%esi
+  800bff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c05:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c0d:	89 f7                	mov    %esi,%edi
+  800c0f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c11:	85 c0                	test   %eax,%eax
+  800c13:	7f 08                	jg     800c1d <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c18:	5b                   	pop    %ebx
+  800c19:	5e                   	pop    %esi
+  800c1a:	5f                   	pop    %edi
+  800c1b:	5d                   	pop    %ebp
+  800c1c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c1d:	83 ec 0c             	sub    $0xc,%esp
+  800c20:	50                   	push   %eax
+  800c21:	6a 05                	push   $0x5
+  800c23:	68 1f 2a 80 00       	push   $0x802a1f
+  800c28:	6a 23                	push   $0x23
+  800c2a:	68 3c 2a 80 00       	push   $0x802a3c
+  800c2f:	e8 cf 15 00 00       	call   802203 <_panic>
+
+00800c34 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	57                   	push   %edi
+  800c38:	56                   	push   %esi
+  800c39:	53                   	push   %ebx
+  800c3a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c3d:	be 00 00 00 00       	mov    $0x0,%esi
+  800c42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c48:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c4d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c50:	89 f7                	mov    %esi,%edi
+  800c52:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c54:	85 c0                	test   %eax,%eax
+  800c56:	7f 08                	jg     800c60 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5b:	5b                   	pop    %ebx
+  800c5c:	5e                   	pop    %esi
+  800c5d:	5f                   	pop    %edi
+  800c5e:	5d                   	pop    %ebp
+  800c5f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c60:	83 ec 0c             	sub    $0xc,%esp
+  800c63:	50                   	push   %eax
+  800c64:	6a 06                	push   $0x6
+  800c66:	68 1f 2a 80 00       	push   $0x802a1f
+  800c6b:	6a 23                	push   $0x23
+  800c6d:	68 3c 2a 80 00       	push   $0x802a3c
+  800c72:	e8 8c 15 00 00       	call   802203 <_panic>
+
+00800c77 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c77:	55                   	push   %ebp
+  800c78:	89 e5                	mov    %esp,%ebp
+  800c7a:	57                   	push   %edi
+  800c7b:	56                   	push   %esi
+  800c7c:	53                   	push   %ebx
+  800c7d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c86:	b8 07 00 00 00       	mov    $0x7,%eax
+  800c8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c8e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c91:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c94:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c96:	85 c0                	test   %eax,%eax
+  800c98:	7f 08                	jg     800ca2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9d:	5b                   	pop    %ebx
+  800c9e:	5e                   	pop    %esi
+  800c9f:	5f                   	pop    %edi
+  800ca0:	5d                   	pop    %ebp
+  800ca1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca2:	83 ec 0c             	sub    $0xc,%esp
+  800ca5:	50                   	push   %eax
+  800ca6:	6a 07                	push   $0x7
+  800ca8:	68 1f 2a 80 00       	push   $0x802a1f
+  800cad:	6a 23                	push   $0x23
+  800caf:	68 3c 2a 80 00       	push   $0x802a3c
+  800cb4:	e8 4a 15 00 00       	call   802203 <_panic>
+
+00800cb9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cb9:	55                   	push   %ebp
+  800cba:	89 e5                	mov    %esp,%ebp
+  800cbc:	57                   	push   %edi
+  800cbd:	56                   	push   %esi
+  800cbe:	53                   	push   %ebx
+  800cbf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccd:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cd2:	89 df                	mov    %ebx,%edi
+  800cd4:	89 de                	mov    %ebx,%esi
+  800cd6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd8:	85 c0                	test   %eax,%eax
+  800cda:	7f 08                	jg     800ce4 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdf:	5b                   	pop    %ebx
+  800ce0:	5e                   	pop    %esi
+  800ce1:	5f                   	pop    %edi
+  800ce2:	5d                   	pop    %ebp
+  800ce3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce4:	83 ec 0c             	sub    $0xc,%esp
+  800ce7:	50                   	push   %eax
+  800ce8:	6a 08                	push   $0x8
+  800cea:	68 1f 2a 80 00       	push   $0x802a1f
+  800cef:	6a 23                	push   $0x23
+  800cf1:	68 3c 2a 80 00       	push   $0x802a3c
+  800cf6:	e8 08 15 00 00       	call   802203 <_panic>
+
+00800cfb <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800cfb:	55                   	push   %ebp
+  800cfc:	89 e5                	mov    %esp,%ebp
+  800cfe:	57                   	push   %edi
+  800cff:	56                   	push   %esi
+  800d00:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d07:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d0c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d14:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d17:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d19:	5b                   	pop    %ebx
+  800d1a:	5e                   	pop    %esi
+  800d1b:	5f                   	pop    %edi
+  800d1c:	5d                   	pop    %ebp
+  800d1d:	c3                   	ret
+
+00800d1e <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d1e:	55                   	push   %ebp
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	57                   	push   %edi
+  800d22:	56                   	push   %esi
+  800d23:	53                   	push   %ebx
+  800d24:	8b 45 18             	mov    0x18(%ebp),%eax
+  800d27:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800d2a:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800d2f:	77 27                	ja     800d58 <sys_page_map_range+0x3a>
+  800d31:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800d37:	77 1f                	ja     800d58 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800d39:	c1 e0 0c             	shl    $0xc,%eax
+  800d3c:	89 c6                	mov    %eax,%esi
+  800d3e:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800d40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d46:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d4e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d51:	cd 30                	int    $0x30
+}
+  800d53:	5b                   	pop    %ebx
+  800d54:	5e                   	pop    %esi
+  800d55:	5f                   	pop    %edi
+  800d56:	5d                   	pop    %ebp
+  800d57:	c3                   	ret
+		return -E_INVAL;
+  800d58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d5d:	eb f4                	jmp    800d53 <sys_page_map_range+0x35>
+
+00800d5f <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800d5f:	55                   	push   %ebp
+  800d60:	89 e5                	mov    %esp,%ebp
+  800d62:	57                   	push   %edi
+  800d63:	56                   	push   %esi
+  800d64:	53                   	push   %ebx
+  800d65:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d73:	be 00 00 00 00       	mov    $0x0,%esi
+  800d78:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d7e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d80:	85 c0                	test   %eax,%eax
+  800d82:	7f 08                	jg     800d8c <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800d84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d87:	5b                   	pop    %ebx
+  800d88:	5e                   	pop    %esi
+  800d89:	5f                   	pop    %edi
+  800d8a:	5d                   	pop    %ebp
+  800d8b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8c:	83 ec 0c             	sub    $0xc,%esp
+  800d8f:	50                   	push   %eax
+  800d90:	6a 0c                	push   $0xc
+  800d92:	68 1f 2a 80 00       	push   $0x802a1f
+  800d97:	6a 23                	push   $0x23
+  800d99:	68 3c 2a 80 00       	push   $0x802a3c
+  800d9e:	e8 60 14 00 00       	call   802203 <_panic>
+
+00800da3 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800da3:	55                   	push   %ebp
+  800da4:	89 e5                	mov    %esp,%ebp
+  800da6:	57                   	push   %edi
+  800da7:	56                   	push   %esi
+  800da8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800da9:	be 00 00 00 00       	mov    $0x0,%esi
+  800dae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800db9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbc:	89 f7                	mov    %esi,%edi
+  800dbe:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800dc0:	5b                   	pop    %ebx
+  800dc1:	5e                   	pop    %esi
+  800dc2:	5f                   	pop    %edi
+  800dc3:	5d                   	pop    %ebp
+  800dc4:	c3                   	ret
+
+00800dc5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	57                   	push   %edi
+  800dc9:	56                   	push   %esi
+  800dca:	53                   	push   %ebx
+  800dcb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dde:	89 df                	mov    %ebx,%edi
+  800de0:	89 de                	mov    %ebx,%esi
+  800de2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de4:	85 c0                	test   %eax,%eax
+  800de6:	7f 08                	jg     800df0 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800de8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800deb:	5b                   	pop    %ebx
+  800dec:	5e                   	pop    %esi
+  800ded:	5f                   	pop    %edi
+  800dee:	5d                   	pop    %ebp
+  800def:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df0:	83 ec 0c             	sub    $0xc,%esp
+  800df3:	50                   	push   %eax
+  800df4:	6a 0f                	push   $0xf
+  800df6:	68 1f 2a 80 00       	push   $0x802a1f
+  800dfb:	6a 23                	push   $0x23
+  800dfd:	68 3c 2a 80 00       	push   $0x802a3c
+  800e02:	e8 fc 13 00 00       	call   802203 <_panic>
+
+00800e07 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e07:	55                   	push   %ebp
+  800e08:	89 e5                	mov    %esp,%ebp
+  800e0a:	57                   	push   %edi
+  800e0b:	56                   	push   %esi
+  800e0c:	53                   	push   %ebx
+  800e0d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e20:	89 df                	mov    %ebx,%edi
+  800e22:	89 de                	mov    %ebx,%esi
+  800e24:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e26:	85 c0                	test   %eax,%eax
+  800e28:	7f 08                	jg     800e32 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800e2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2d:	5b                   	pop    %ebx
+  800e2e:	5e                   	pop    %esi
+  800e2f:	5f                   	pop    %edi
+  800e30:	5d                   	pop    %ebp
+  800e31:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e32:	83 ec 0c             	sub    $0xc,%esp
+  800e35:	50                   	push   %eax
+  800e36:	6a 10                	push   $0x10
+  800e38:	68 1f 2a 80 00       	push   $0x802a1f
+  800e3d:	6a 23                	push   $0x23
+  800e3f:	68 3c 2a 80 00       	push   $0x802a3c
+  800e44:	e8 ba 13 00 00       	call   802203 <_panic>
+
+00800e49 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	57                   	push   %edi
+  800e4d:	56                   	push   %esi
+  800e4e:	53                   	push   %ebx
+  800e4f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e62:	89 df                	mov    %ebx,%edi
+  800e64:	89 de                	mov    %ebx,%esi
+  800e66:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e68:	85 c0                	test   %eax,%eax
+  800e6a:	7f 08                	jg     800e74 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800e6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6f:	5b                   	pop    %ebx
+  800e70:	5e                   	pop    %esi
+  800e71:	5f                   	pop    %edi
+  800e72:	5d                   	pop    %ebp
+  800e73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e74:	83 ec 0c             	sub    $0xc,%esp
+  800e77:	50                   	push   %eax
+  800e78:	6a 11                	push   $0x11
+  800e7a:	68 1f 2a 80 00       	push   $0x802a1f
+  800e7f:	6a 23                	push   $0x23
+  800e81:	68 3c 2a 80 00       	push   $0x802a3c
+  800e86:	e8 78 13 00 00       	call   802203 <_panic>
+
+00800e8b <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800e8b:	55                   	push   %ebp
+  800e8c:	89 e5                	mov    %esp,%ebp
+  800e8e:	57                   	push   %edi
+  800e8f:	56                   	push   %esi
+  800e90:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e96:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e9b:	89 d1                	mov    %edx,%ecx
+  800e9d:	89 d3                	mov    %edx,%ebx
+  800e9f:	89 d7                	mov    %edx,%edi
+  800ea1:	89 d6                	mov    %edx,%esi
+  800ea3:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800ea5:	5b                   	pop    %ebx
+  800ea6:	5e                   	pop    %esi
+  800ea7:	5f                   	pop    %edi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	c3                   	ret
+
+00800eaa <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eaa:	55                   	push   %ebp
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	57                   	push   %edi
+  800eae:	56                   	push   %esi
+  800eaf:	53                   	push   %ebx
+  800eb0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebe:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ec3:	89 df                	mov    %ebx,%edi
+  800ec5:	89 de                	mov    %ebx,%esi
+  800ec7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec9:	85 c0                	test   %eax,%eax
+  800ecb:	7f 08                	jg     800ed5 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ecd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed0:	5b                   	pop    %ebx
+  800ed1:	5e                   	pop    %esi
+  800ed2:	5f                   	pop    %edi
+  800ed3:	5d                   	pop    %ebp
+  800ed4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed5:	83 ec 0c             	sub    $0xc,%esp
+  800ed8:	50                   	push   %eax
+  800ed9:	6a 13                	push   $0x13
+  800edb:	68 1f 2a 80 00       	push   $0x802a1f
+  800ee0:	6a 23                	push   $0x23
+  800ee2:	68 3c 2a 80 00       	push   $0x802a3c
+  800ee7:	e8 17 13 00 00       	call   802203 <_panic>
+
+00800eec <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	57                   	push   %edi
+  800ef0:	56                   	push   %esi
+  800ef1:	53                   	push   %ebx
+  800ef2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f00:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f05:	89 df                	mov    %ebx,%edi
+  800f07:	89 de                	mov    %ebx,%esi
+  800f09:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0b:	85 c0                	test   %eax,%eax
+  800f0d:	7f 08                	jg     800f17 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f12:	5b                   	pop    %ebx
+  800f13:	5e                   	pop    %esi
+  800f14:	5f                   	pop    %edi
+  800f15:	5d                   	pop    %ebp
+  800f16:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f17:	83 ec 0c             	sub    $0xc,%esp
+  800f1a:	50                   	push   %eax
+  800f1b:	6a 14                	push   $0x14
+  800f1d:	68 1f 2a 80 00       	push   $0x802a1f
+  800f22:	6a 23                	push   $0x23
+  800f24:	68 3c 2a 80 00       	push   $0x802a3c
+  800f29:	e8 d5 12 00 00       	call   802203 <_panic>
+
+00800f2e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f2e:	55                   	push   %ebp
+  800f2f:	89 e5                	mov    %esp,%ebp
+  800f31:	57                   	push   %edi
+  800f32:	56                   	push   %esi
+  800f33:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3a:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f3f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f47:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f4a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f4c:	5b                   	pop    %ebx
+  800f4d:	5e                   	pop    %esi
+  800f4e:	5f                   	pop    %edi
+  800f4f:	5d                   	pop    %ebp
+  800f50:	c3                   	ret
+
+00800f51 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	57                   	push   %edi
+  800f55:	56                   	push   %esi
+  800f56:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5d:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f62:	be 00 00 00 00       	mov    $0x0,%esi
+  800f67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f6f:	5b                   	pop    %ebx
+  800f70:	5e                   	pop    %esi
+  800f71:	5f                   	pop    %edi
+  800f72:	5d                   	pop    %ebp
+  800f73:	c3                   	ret
+
+00800f74 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	57                   	push   %edi
+  800f78:	56                   	push   %esi
+  800f79:	53                   	push   %ebx
+  800f7a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f85:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f8a:	89 cb                	mov    %ecx,%ebx
+  800f8c:	89 cf                	mov    %ecx,%edi
+  800f8e:	89 ce                	mov    %ecx,%esi
+  800f90:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f92:	85 c0                	test   %eax,%eax
+  800f94:	7f 08                	jg     800f9e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f99:	5b                   	pop    %ebx
+  800f9a:	5e                   	pop    %esi
+  800f9b:	5f                   	pop    %edi
+  800f9c:	5d                   	pop    %ebp
+  800f9d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9e:	83 ec 0c             	sub    $0xc,%esp
+  800fa1:	50                   	push   %eax
+  800fa2:	6a 19                	push   $0x19
+  800fa4:	68 1f 2a 80 00       	push   $0x802a1f
+  800fa9:	6a 23                	push   $0x23
+  800fab:	68 3c 2a 80 00       	push   $0x802a3c
+  800fb0:	e8 4e 12 00 00       	call   802203 <_panic>
+
+00800fb5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fb5:	55                   	push   %ebp
+  800fb6:	89 e5                	mov    %esp,%ebp
+  800fb8:	57                   	push   %edi
+  800fb9:	56                   	push   %esi
+  800fba:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fc5:	89 d1                	mov    %edx,%ecx
+  800fc7:	89 d3                	mov    %edx,%ebx
+  800fc9:	89 d7                	mov    %edx,%edi
+  800fcb:	89 d6                	mov    %edx,%esi
+  800fcd:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fcf:	5b                   	pop    %ebx
+  800fd0:	5e                   	pop    %esi
+  800fd1:	5f                   	pop    %edi
+  800fd2:	5d                   	pop    %ebp
+  800fd3:	c3                   	ret
+
+00800fd4 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  800fd4:	55                   	push   %ebp
+  800fd5:	89 e5                	mov    %esp,%ebp
+  800fd7:	57                   	push   %edi
+  800fd8:	56                   	push   %esi
+  800fd9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fea:	89 df                	mov    %ebx,%edi
+  800fec:	89 de                	mov    %ebx,%esi
+  800fee:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5f                   	pop    %edi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+
+00800ff5 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	57                   	push   %edi
+  800ff9:	56                   	push   %esi
+  800ffa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ffb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801000:	8b 55 08             	mov    0x8(%ebp),%edx
+  801003:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801006:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80100b:	89 df                	mov    %ebx,%edi
+  80100d:	89 de                	mov    %ebx,%esi
+  80100f:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801011:	5b                   	pop    %ebx
+  801012:	5e                   	pop    %esi
+  801013:	5f                   	pop    %edi
+  801014:	5d                   	pop    %ebp
+  801015:	c3                   	ret
+
+00801016 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	57                   	push   %edi
+  80101a:	56                   	push   %esi
+  80101b:	53                   	push   %ebx
+  80101c:	83 ec 18             	sub    $0x18,%esp
+  80101f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801022:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801025:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801028:	85 db                	test   %ebx,%ebx
+  80102a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80102f:	0f 45 c3             	cmovne %ebx,%eax
+  801032:	50                   	push   %eax
+  801033:	e8 3c ff ff ff       	call   800f74 <sys_ipc_recv>
+
+	if (from_env_store)
+  801038:	83 c4 10             	add    $0x10,%esp
+  80103b:	85 ff                	test   %edi,%edi
+  80103d:	74 17                	je     801056 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80103f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801044:	85 c0                	test   %eax,%eax
+  801046:	75 0c                	jne    801054 <ipc_recv+0x3e>
+  801048:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80104e:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  801054:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  801056:	85 f6                	test   %esi,%esi
+  801058:	74 2e                	je     801088 <ipc_recv+0x72>
+		if (!r && pg)
+  80105a:	85 c0                	test   %eax,%eax
+  80105c:	75 24                	jne    801082 <ipc_recv+0x6c>
+  80105e:	85 db                	test   %ebx,%ebx
+  801060:	74 20                	je     801082 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  801062:	a1 08 40 80 00       	mov    0x804008,%eax
+  801067:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  80106d:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80106f:	a1 08 40 80 00       	mov    0x804008,%eax
+  801074:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80107a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107d:	5b                   	pop    %ebx
+  80107e:	5e                   	pop    %esi
+  80107f:	5f                   	pop    %edi
+  801080:	5d                   	pop    %ebp
+  801081:	c3                   	ret
+			*perm_store = 0;
+  801082:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  801088:	85 c0                	test   %eax,%eax
+  80108a:	75 ee                	jne    80107a <ipc_recv+0x64>
+  80108c:	eb e1                	jmp    80106f <ipc_recv+0x59>
+
+0080108e <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	57                   	push   %edi
+  801092:	56                   	push   %esi
+  801093:	53                   	push   %ebx
+  801094:	83 ec 0c             	sub    $0xc,%esp
+  801097:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80109a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80109d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8010a0:	85 db                	test   %ebx,%ebx
+  8010a2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8010a7:	0f 44 d8             	cmove  %eax,%ebx
+  8010aa:	ff 75 14             	push   0x14(%ebp)
+  8010ad:	53                   	push   %ebx
+  8010ae:	56                   	push   %esi
+  8010af:	57                   	push   %edi
+  8010b0:	e8 9c fe ff ff       	call   800f51 <sys_ipc_try_send_yield>
+  8010b5:	83 c4 10             	add    $0x10,%esp
+  8010b8:	85 c0                	test   %eax,%eax
+  8010ba:	79 1e                	jns    8010da <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8010bc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8010bf:	75 07                	jne    8010c8 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8010c1:	e8 ab fa ff ff       	call   800b71 <sys_yield>
+  8010c6:	eb e2                	jmp    8010aa <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8010c8:	50                   	push   %eax
+  8010c9:	68 4a 2a 80 00       	push   $0x802a4a
+  8010ce:	6a 3d                	push   $0x3d
+  8010d0:	68 5f 2a 80 00       	push   $0x802a5f
+  8010d5:	e8 29 11 00 00       	call   802203 <_panic>
+	}
+}
+  8010da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010dd:	5b                   	pop    %ebx
+  8010de:	5e                   	pop    %esi
+  8010df:	5f                   	pop    %edi
+  8010e0:	5d                   	pop    %ebp
+  8010e1:	c3                   	ret
+
+008010e2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8010e8:	ff 75 08             	push   0x8(%ebp)
+  8010eb:	e8 01 fa ff ff       	call   800af1 <sys_env_find>
+}
+  8010f0:	c9                   	leave
+  8010f1:	c3                   	ret
+
+008010f2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8010f2:	55                   	push   %ebp
+  8010f3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010fd:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801100:	5d                   	pop    %ebp
+  801101:	c3                   	ret
+
+00801102 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801105:	8b 45 08             	mov    0x8(%ebp),%eax
+  801108:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80110d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801112:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801117:	5d                   	pop    %ebp
+  801118:	c3                   	ret
+
+00801119 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801119:	55                   	push   %ebp
+  80111a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80111c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801121:	eb 02                	jmp    801125 <fd_alloc+0xc>
+  801123:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801125:	89 c2                	mov    %eax,%edx
+  801127:	c1 ea 16             	shr    $0x16,%edx
+  80112a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801131:	f6 c2 01             	test   $0x1,%dl
+  801134:	74 2b                	je     801161 <fd_alloc+0x48>
+  801136:	89 c2                	mov    %eax,%edx
+  801138:	c1 ea 0c             	shr    $0xc,%edx
+  80113b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801142:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801148:	f6 c1 01             	test   $0x1,%cl
+  80114b:	74 14                	je     801161 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80114d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801153:	75 ce                	jne    801123 <fd_alloc+0xa>
+  801155:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80115a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80115f:	eb 05                	jmp    801166 <fd_alloc+0x4d>
+			return 0;
+  801161:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801166:	8b 55 08             	mov    0x8(%ebp),%edx
+  801169:	89 02                	mov    %eax,(%edx)
+}
+  80116b:	89 c8                	mov    %ecx,%eax
+  80116d:	5d                   	pop    %ebp
+  80116e:	c3                   	ret
+
+0080116f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80116f:	55                   	push   %ebp
+  801170:	89 e5                	mov    %esp,%ebp
+  801172:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801175:	83 f8 1f             	cmp    $0x1f,%eax
+  801178:	77 30                	ja     8011aa <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80117a:	c1 e0 0c             	shl    $0xc,%eax
+  80117d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801182:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801188:	f6 c2 01             	test   $0x1,%dl
+  80118b:	74 24                	je     8011b1 <fd_lookup+0x42>
+  80118d:	89 c2                	mov    %eax,%edx
+  80118f:	c1 ea 0c             	shr    $0xc,%edx
+  801192:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801199:	f6 c2 01             	test   $0x1,%dl
+  80119c:	74 1a                	je     8011b8 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80119e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011a1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a8:	5d                   	pop    %ebp
+  8011a9:	c3                   	ret
+		return -E_INVAL;
+  8011aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011af:	eb f7                	jmp    8011a8 <fd_lookup+0x39>
+		return -E_INVAL;
+  8011b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011b6:	eb f0                	jmp    8011a8 <fd_lookup+0x39>
+  8011b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011bd:	eb e9                	jmp    8011a8 <fd_lookup+0x39>
+
+008011bf <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011bf:	55                   	push   %ebp
+  8011c0:	89 e5                	mov    %esp,%ebp
+  8011c2:	53                   	push   %ebx
+  8011c3:	83 ec 04             	sub    $0x4,%esp
+  8011c6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ce:	eb 03                	jmp    8011d3 <dev_lookup+0x14>
+  8011d0:	83 c0 01             	add    $0x1,%eax
+  8011d3:	8b 1c 85 e8 2a 80 00 	mov    0x802ae8(,%eax,4),%ebx
+  8011da:	85 db                	test   %ebx,%ebx
+  8011dc:	74 0b                	je     8011e9 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8011de:	39 13                	cmp    %edx,(%ebx)
+  8011e0:	75 ee                	jne    8011d0 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8011e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e7:	eb 1f                	jmp    801208 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8011e9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8011ee:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8011f1:	83 ec 04             	sub    $0x4,%esp
+  8011f4:	52                   	push   %edx
+  8011f5:	50                   	push   %eax
+  8011f6:	68 6c 2a 80 00       	push   $0x802a6c
+  8011fb:	e8 96 ef ff ff       	call   800196 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801200:	83 c4 10             	add    $0x10,%esp
+  801203:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801208:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80120b:	89 1a                	mov    %ebx,(%edx)
+}
+  80120d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801210:	c9                   	leave
+  801211:	c3                   	ret
+
+00801212 <fd_close>:
+{
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	57                   	push   %edi
+  801216:	56                   	push   %esi
+  801217:	53                   	push   %ebx
+  801218:	83 ec 24             	sub    $0x24,%esp
+  80121b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80121e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801221:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801224:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801225:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80122b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80122e:	50                   	push   %eax
+  80122f:	e8 3b ff ff ff       	call   80116f <fd_lookup>
+  801234:	89 c3                	mov    %eax,%ebx
+  801236:	83 c4 10             	add    $0x10,%esp
+  801239:	85 c0                	test   %eax,%eax
+  80123b:	78 05                	js     801242 <fd_close+0x30>
+	    || fd != fd2)
+  80123d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801240:	74 16                	je     801258 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801242:	89 f8                	mov    %edi,%eax
+  801244:	84 c0                	test   %al,%al
+  801246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80124e:	89 d8                	mov    %ebx,%eax
+  801250:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801253:	5b                   	pop    %ebx
+  801254:	5e                   	pop    %esi
+  801255:	5f                   	pop    %edi
+  801256:	5d                   	pop    %ebp
+  801257:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801258:	83 ec 08             	sub    $0x8,%esp
+  80125b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80125e:	50                   	push   %eax
+  80125f:	ff 36                	push   (%esi)
+  801261:	e8 59 ff ff ff       	call   8011bf <dev_lookup>
+  801266:	89 c3                	mov    %eax,%ebx
+  801268:	83 c4 10             	add    $0x10,%esp
+  80126b:	85 c0                	test   %eax,%eax
+  80126d:	78 1a                	js     801289 <fd_close+0x77>
+		if (dev->dev_close)
+  80126f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801272:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801275:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80127a:	85 c0                	test   %eax,%eax
+  80127c:	74 0b                	je     801289 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80127e:	83 ec 0c             	sub    $0xc,%esp
+  801281:	56                   	push   %esi
+  801282:	ff d0                	call   *%eax
+  801284:	89 c3                	mov    %eax,%ebx
+  801286:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801289:	83 ec 08             	sub    $0x8,%esp
+  80128c:	56                   	push   %esi
+  80128d:	6a 00                	push   $0x0
+  80128f:	e8 25 fa ff ff       	call   800cb9 <sys_page_unmap>
+	return r;
+  801294:	83 c4 10             	add    $0x10,%esp
+  801297:	eb b5                	jmp    80124e <fd_close+0x3c>
+
+00801299 <close>:
+
+int
+close(int fdnum)
+{
+  801299:	55                   	push   %ebp
+  80129a:	89 e5                	mov    %esp,%ebp
+  80129c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80129f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012a2:	50                   	push   %eax
+  8012a3:	ff 75 08             	push   0x8(%ebp)
+  8012a6:	e8 c4 fe ff ff       	call   80116f <fd_lookup>
+  8012ab:	83 c4 10             	add    $0x10,%esp
+  8012ae:	85 c0                	test   %eax,%eax
+  8012b0:	79 02                	jns    8012b4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012b2:	c9                   	leave
+  8012b3:	c3                   	ret
+		return fd_close(fd, 1);
+  8012b4:	83 ec 08             	sub    $0x8,%esp
+  8012b7:	6a 01                	push   $0x1
+  8012b9:	ff 75 f4             	push   -0xc(%ebp)
+  8012bc:	e8 51 ff ff ff       	call   801212 <fd_close>
+  8012c1:	83 c4 10             	add    $0x10,%esp
+  8012c4:	eb ec                	jmp    8012b2 <close+0x19>
+
+008012c6 <close_all>:
+
+void
+close_all(void)
+{
+  8012c6:	55                   	push   %ebp
+  8012c7:	89 e5                	mov    %esp,%ebp
+  8012c9:	53                   	push   %ebx
+  8012ca:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8012cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8012d2:	83 ec 0c             	sub    $0xc,%esp
+  8012d5:	53                   	push   %ebx
+  8012d6:	e8 be ff ff ff       	call   801299 <close>
+	for (i = 0; i < MAXFD; i++)
+  8012db:	83 c3 01             	add    $0x1,%ebx
+  8012de:	83 c4 10             	add    $0x10,%esp
+  8012e1:	83 fb 20             	cmp    $0x20,%ebx
+  8012e4:	75 ec                	jne    8012d2 <close_all+0xc>
+}
+  8012e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012e9:	c9                   	leave
+  8012ea:	c3                   	ret
+
+008012eb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8012eb:	55                   	push   %ebp
+  8012ec:	89 e5                	mov    %esp,%ebp
+  8012ee:	57                   	push   %edi
+  8012ef:	56                   	push   %esi
+  8012f0:	53                   	push   %ebx
+  8012f1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8012f4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012f7:	50                   	push   %eax
+  8012f8:	ff 75 08             	push   0x8(%ebp)
+  8012fb:	e8 6f fe ff ff       	call   80116f <fd_lookup>
+  801300:	89 c3                	mov    %eax,%ebx
+  801302:	83 c4 10             	add    $0x10,%esp
+  801305:	85 c0                	test   %eax,%eax
+  801307:	78 7f                	js     801388 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801309:	83 ec 0c             	sub    $0xc,%esp
+  80130c:	ff 75 0c             	push   0xc(%ebp)
+  80130f:	e8 85 ff ff ff       	call   801299 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801314:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801317:	c1 e6 0c             	shl    $0xc,%esi
+  80131a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801320:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801323:	89 3c 24             	mov    %edi,(%esp)
+  801326:	e8 d7 fd ff ff       	call   801102 <fd2data>
+  80132b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80132d:	89 34 24             	mov    %esi,(%esp)
+  801330:	e8 cd fd ff ff       	call   801102 <fd2data>
+  801335:	83 c4 10             	add    $0x10,%esp
+  801338:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80133b:	89 d8                	mov    %ebx,%eax
+  80133d:	c1 e8 16             	shr    $0x16,%eax
+  801340:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801347:	a8 01                	test   $0x1,%al
+  801349:	74 11                	je     80135c <dup+0x71>
+  80134b:	89 d8                	mov    %ebx,%eax
+  80134d:	c1 e8 0c             	shr    $0xc,%eax
+  801350:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801357:	f6 c2 01             	test   $0x1,%dl
+  80135a:	75 36                	jne    801392 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80135c:	89 f8                	mov    %edi,%eax
+  80135e:	c1 e8 0c             	shr    $0xc,%eax
+  801361:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801368:	83 ec 0c             	sub    $0xc,%esp
+  80136b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801370:	50                   	push   %eax
+  801371:	56                   	push   %esi
+  801372:	6a 00                	push   $0x0
+  801374:	57                   	push   %edi
+  801375:	6a 00                	push   $0x0
+  801377:	e8 fb f8 ff ff       	call   800c77 <sys_page_map>
+  80137c:	89 c3                	mov    %eax,%ebx
+  80137e:	83 c4 20             	add    $0x20,%esp
+  801381:	85 c0                	test   %eax,%eax
+  801383:	78 33                	js     8013b8 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801385:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801388:	89 d8                	mov    %ebx,%eax
+  80138a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138d:	5b                   	pop    %ebx
+  80138e:	5e                   	pop    %esi
+  80138f:	5f                   	pop    %edi
+  801390:	5d                   	pop    %ebp
+  801391:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801392:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801399:	83 ec 0c             	sub    $0xc,%esp
+  80139c:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013a1:	50                   	push   %eax
+  8013a2:	ff 75 d4             	push   -0x2c(%ebp)
+  8013a5:	6a 00                	push   $0x0
+  8013a7:	53                   	push   %ebx
+  8013a8:	6a 00                	push   $0x0
+  8013aa:	e8 c8 f8 ff ff       	call   800c77 <sys_page_map>
+  8013af:	89 c3                	mov    %eax,%ebx
+  8013b1:	83 c4 20             	add    $0x20,%esp
+  8013b4:	85 c0                	test   %eax,%eax
+  8013b6:	79 a4                	jns    80135c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013b8:	83 ec 08             	sub    $0x8,%esp
+  8013bb:	56                   	push   %esi
+  8013bc:	6a 00                	push   $0x0
+  8013be:	e8 f6 f8 ff ff       	call   800cb9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8013c3:	83 c4 08             	add    $0x8,%esp
+  8013c6:	ff 75 d4             	push   -0x2c(%ebp)
+  8013c9:	6a 00                	push   $0x0
+  8013cb:	e8 e9 f8 ff ff       	call   800cb9 <sys_page_unmap>
+	return r;
+  8013d0:	83 c4 10             	add    $0x10,%esp
+  8013d3:	eb b3                	jmp    801388 <dup+0x9d>
+
+008013d5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013d5:	55                   	push   %ebp
+  8013d6:	89 e5                	mov    %esp,%ebp
+  8013d8:	56                   	push   %esi
+  8013d9:	53                   	push   %ebx
+  8013da:	83 ec 18             	sub    $0x18,%esp
+  8013dd:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013e0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013e3:	50                   	push   %eax
+  8013e4:	56                   	push   %esi
+  8013e5:	e8 85 fd ff ff       	call   80116f <fd_lookup>
+  8013ea:	83 c4 10             	add    $0x10,%esp
+  8013ed:	85 c0                	test   %eax,%eax
+  8013ef:	78 3c                	js     80142d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013f1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013f4:	83 ec 08             	sub    $0x8,%esp
+  8013f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013fa:	50                   	push   %eax
+  8013fb:	ff 33                	push   (%ebx)
+  8013fd:	e8 bd fd ff ff       	call   8011bf <dev_lookup>
+  801402:	83 c4 10             	add    $0x10,%esp
+  801405:	85 c0                	test   %eax,%eax
+  801407:	78 24                	js     80142d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801409:	8b 43 08             	mov    0x8(%ebx),%eax
+  80140c:	83 e0 03             	and    $0x3,%eax
+  80140f:	83 f8 01             	cmp    $0x1,%eax
+  801412:	74 20                	je     801434 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801414:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801417:	8b 40 08             	mov    0x8(%eax),%eax
+  80141a:	85 c0                	test   %eax,%eax
+  80141c:	74 37                	je     801455 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80141e:	83 ec 04             	sub    $0x4,%esp
+  801421:	ff 75 10             	push   0x10(%ebp)
+  801424:	ff 75 0c             	push   0xc(%ebp)
+  801427:	53                   	push   %ebx
+  801428:	ff d0                	call   *%eax
+  80142a:	83 c4 10             	add    $0x10,%esp
+}
+  80142d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801430:	5b                   	pop    %ebx
+  801431:	5e                   	pop    %esi
+  801432:	5d                   	pop    %ebp
+  801433:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801434:	a1 08 40 80 00       	mov    0x804008,%eax
+  801439:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80143c:	83 ec 04             	sub    $0x4,%esp
+  80143f:	56                   	push   %esi
+  801440:	50                   	push   %eax
+  801441:	68 ad 2a 80 00       	push   $0x802aad
+  801446:	e8 4b ed ff ff       	call   800196 <cprintf>
+		return -E_INVAL;
+  80144b:	83 c4 10             	add    $0x10,%esp
+  80144e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801453:	eb d8                	jmp    80142d <read+0x58>
+		return -E_NOT_SUPP;
+  801455:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80145a:	eb d1                	jmp    80142d <read+0x58>
+
+0080145c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80145c:	55                   	push   %ebp
+  80145d:	89 e5                	mov    %esp,%ebp
+  80145f:	57                   	push   %edi
+  801460:	56                   	push   %esi
+  801461:	53                   	push   %ebx
+  801462:	83 ec 0c             	sub    $0xc,%esp
+  801465:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801468:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80146b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801470:	eb 02                	jmp    801474 <readn+0x18>
+  801472:	01 c3                	add    %eax,%ebx
+  801474:	39 f3                	cmp    %esi,%ebx
+  801476:	73 21                	jae    801499 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801478:	83 ec 04             	sub    $0x4,%esp
+  80147b:	89 f0                	mov    %esi,%eax
+  80147d:	29 d8                	sub    %ebx,%eax
+  80147f:	50                   	push   %eax
+  801480:	89 d8                	mov    %ebx,%eax
+  801482:	03 45 0c             	add    0xc(%ebp),%eax
+  801485:	50                   	push   %eax
+  801486:	57                   	push   %edi
+  801487:	e8 49 ff ff ff       	call   8013d5 <read>
+		if (m < 0)
+  80148c:	83 c4 10             	add    $0x10,%esp
+  80148f:	85 c0                	test   %eax,%eax
+  801491:	78 04                	js     801497 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801493:	75 dd                	jne    801472 <readn+0x16>
+  801495:	eb 02                	jmp    801499 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801497:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801499:	89 d8                	mov    %ebx,%eax
+  80149b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149e:	5b                   	pop    %ebx
+  80149f:	5e                   	pop    %esi
+  8014a0:	5f                   	pop    %edi
+  8014a1:	5d                   	pop    %ebp
+  8014a2:	c3                   	ret
+
+008014a3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014a3:	55                   	push   %ebp
+  8014a4:	89 e5                	mov    %esp,%ebp
+  8014a6:	56                   	push   %esi
+  8014a7:	53                   	push   %ebx
+  8014a8:	83 ec 18             	sub    $0x18,%esp
+  8014ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014ae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014b1:	50                   	push   %eax
+  8014b2:	53                   	push   %ebx
+  8014b3:	e8 b7 fc ff ff       	call   80116f <fd_lookup>
+  8014b8:	83 c4 10             	add    $0x10,%esp
+  8014bb:	85 c0                	test   %eax,%eax
+  8014bd:	78 37                	js     8014f6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014bf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014c2:	83 ec 08             	sub    $0x8,%esp
+  8014c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c8:	50                   	push   %eax
+  8014c9:	ff 36                	push   (%esi)
+  8014cb:	e8 ef fc ff ff       	call   8011bf <dev_lookup>
+  8014d0:	83 c4 10             	add    $0x10,%esp
+  8014d3:	85 c0                	test   %eax,%eax
+  8014d5:	78 1f                	js     8014f6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014d7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014db:	74 20                	je     8014fd <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8014dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014e0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014e3:	85 c0                	test   %eax,%eax
+  8014e5:	74 37                	je     80151e <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8014e7:	83 ec 04             	sub    $0x4,%esp
+  8014ea:	ff 75 10             	push   0x10(%ebp)
+  8014ed:	ff 75 0c             	push   0xc(%ebp)
+  8014f0:	56                   	push   %esi
+  8014f1:	ff d0                	call   *%eax
+  8014f3:	83 c4 10             	add    $0x10,%esp
+}
+  8014f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014f9:	5b                   	pop    %ebx
+  8014fa:	5e                   	pop    %esi
+  8014fb:	5d                   	pop    %ebp
+  8014fc:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014fd:	a1 08 40 80 00       	mov    0x804008,%eax
+  801502:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801505:	83 ec 04             	sub    $0x4,%esp
+  801508:	53                   	push   %ebx
+  801509:	50                   	push   %eax
+  80150a:	68 c9 2a 80 00       	push   $0x802ac9
+  80150f:	e8 82 ec ff ff       	call   800196 <cprintf>
+		return -E_INVAL;
+  801514:	83 c4 10             	add    $0x10,%esp
+  801517:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80151c:	eb d8                	jmp    8014f6 <write+0x53>
+		return -E_NOT_SUPP;
+  80151e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801523:	eb d1                	jmp    8014f6 <write+0x53>
+
+00801525 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801525:	55                   	push   %ebp
+  801526:	89 e5                	mov    %esp,%ebp
+  801528:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80152b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80152e:	50                   	push   %eax
+  80152f:	ff 75 08             	push   0x8(%ebp)
+  801532:	e8 38 fc ff ff       	call   80116f <fd_lookup>
+  801537:	83 c4 10             	add    $0x10,%esp
+  80153a:	85 c0                	test   %eax,%eax
+  80153c:	78 0e                	js     80154c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80153e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801541:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801544:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801547:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80154c:	c9                   	leave
+  80154d:	c3                   	ret
+
+0080154e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80154e:	55                   	push   %ebp
+  80154f:	89 e5                	mov    %esp,%ebp
+  801551:	56                   	push   %esi
+  801552:	53                   	push   %ebx
+  801553:	83 ec 18             	sub    $0x18,%esp
+  801556:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801559:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80155c:	50                   	push   %eax
+  80155d:	53                   	push   %ebx
+  80155e:	e8 0c fc ff ff       	call   80116f <fd_lookup>
+  801563:	83 c4 10             	add    $0x10,%esp
+  801566:	85 c0                	test   %eax,%eax
+  801568:	78 34                	js     80159e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80156a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80156d:	83 ec 08             	sub    $0x8,%esp
+  801570:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801573:	50                   	push   %eax
+  801574:	ff 36                	push   (%esi)
+  801576:	e8 44 fc ff ff       	call   8011bf <dev_lookup>
+  80157b:	83 c4 10             	add    $0x10,%esp
+  80157e:	85 c0                	test   %eax,%eax
+  801580:	78 1c                	js     80159e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801582:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801586:	74 1d                	je     8015a5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801588:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80158b:	8b 40 18             	mov    0x18(%eax),%eax
+  80158e:	85 c0                	test   %eax,%eax
+  801590:	74 34                	je     8015c6 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801592:	83 ec 08             	sub    $0x8,%esp
+  801595:	ff 75 0c             	push   0xc(%ebp)
+  801598:	56                   	push   %esi
+  801599:	ff d0                	call   *%eax
+  80159b:	83 c4 10             	add    $0x10,%esp
+}
+  80159e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015a1:	5b                   	pop    %ebx
+  8015a2:	5e                   	pop    %esi
+  8015a3:	5d                   	pop    %ebp
+  8015a4:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015a5:	a1 08 40 80 00       	mov    0x804008,%eax
+  8015aa:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015ad:	83 ec 04             	sub    $0x4,%esp
+  8015b0:	53                   	push   %ebx
+  8015b1:	50                   	push   %eax
+  8015b2:	68 8c 2a 80 00       	push   $0x802a8c
+  8015b7:	e8 da eb ff ff       	call   800196 <cprintf>
+		return -E_INVAL;
+  8015bc:	83 c4 10             	add    $0x10,%esp
+  8015bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c4:	eb d8                	jmp    80159e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015c6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015cb:	eb d1                	jmp    80159e <ftruncate+0x50>
+
+008015cd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015cd:	55                   	push   %ebp
+  8015ce:	89 e5                	mov    %esp,%ebp
+  8015d0:	56                   	push   %esi
+  8015d1:	53                   	push   %ebx
+  8015d2:	83 ec 18             	sub    $0x18,%esp
+  8015d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015d8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015db:	50                   	push   %eax
+  8015dc:	ff 75 08             	push   0x8(%ebp)
+  8015df:	e8 8b fb ff ff       	call   80116f <fd_lookup>
+  8015e4:	83 c4 10             	add    $0x10,%esp
+  8015e7:	85 c0                	test   %eax,%eax
+  8015e9:	78 49                	js     801634 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015eb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015ee:	83 ec 08             	sub    $0x8,%esp
+  8015f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f4:	50                   	push   %eax
+  8015f5:	ff 36                	push   (%esi)
+  8015f7:	e8 c3 fb ff ff       	call   8011bf <dev_lookup>
+  8015fc:	83 c4 10             	add    $0x10,%esp
+  8015ff:	85 c0                	test   %eax,%eax
+  801601:	78 31                	js     801634 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801603:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801606:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80160a:	74 2f                	je     80163b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80160c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80160f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801616:	00 00 00 
+	stat->st_isdir = 0;
+  801619:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801620:	00 00 00 
+	stat->st_dev = dev;
+  801623:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801629:	83 ec 08             	sub    $0x8,%esp
+  80162c:	53                   	push   %ebx
+  80162d:	56                   	push   %esi
+  80162e:	ff 50 14             	call   *0x14(%eax)
+  801631:	83 c4 10             	add    $0x10,%esp
+}
+  801634:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801637:	5b                   	pop    %ebx
+  801638:	5e                   	pop    %esi
+  801639:	5d                   	pop    %ebp
+  80163a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80163b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801640:	eb f2                	jmp    801634 <fstat+0x67>
+
+00801642 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801642:	55                   	push   %ebp
+  801643:	89 e5                	mov    %esp,%ebp
+  801645:	56                   	push   %esi
+  801646:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801647:	83 ec 08             	sub    $0x8,%esp
+  80164a:	6a 00                	push   $0x0
+  80164c:	ff 75 08             	push   0x8(%ebp)
+  80164f:	e8 e4 01 00 00       	call   801838 <open>
+  801654:	89 c3                	mov    %eax,%ebx
+  801656:	83 c4 10             	add    $0x10,%esp
+  801659:	85 c0                	test   %eax,%eax
+  80165b:	78 1b                	js     801678 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80165d:	83 ec 08             	sub    $0x8,%esp
+  801660:	ff 75 0c             	push   0xc(%ebp)
+  801663:	50                   	push   %eax
+  801664:	e8 64 ff ff ff       	call   8015cd <fstat>
+  801669:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80166b:	89 1c 24             	mov    %ebx,(%esp)
+  80166e:	e8 26 fc ff ff       	call   801299 <close>
+	return r;
+  801673:	83 c4 10             	add    $0x10,%esp
+  801676:	89 f3                	mov    %esi,%ebx
+}
+  801678:	89 d8                	mov    %ebx,%eax
+  80167a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80167d:	5b                   	pop    %ebx
+  80167e:	5e                   	pop    %esi
+  80167f:	5d                   	pop    %ebp
+  801680:	c3                   	ret
+
+00801681 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	56                   	push   %esi
+  801685:	53                   	push   %ebx
+  801686:	89 c6                	mov    %eax,%esi
+  801688:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80168a:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801691:	74 27                	je     8016ba <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801693:	6a 07                	push   $0x7
+  801695:	68 00 50 80 00       	push   $0x805000
+  80169a:	56                   	push   %esi
+  80169b:	ff 35 00 40 80 00    	push   0x804000
+  8016a1:	e8 e8 f9 ff ff       	call   80108e <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8016a6:	83 c4 0c             	add    $0xc,%esp
+  8016a9:	6a 00                	push   $0x0
+  8016ab:	53                   	push   %ebx
+  8016ac:	6a 00                	push   $0x0
+  8016ae:	e8 63 f9 ff ff       	call   801016 <ipc_recv>
+}
+  8016b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016b6:	5b                   	pop    %ebx
+  8016b7:	5e                   	pop    %esi
+  8016b8:	5d                   	pop    %ebp
+  8016b9:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016ba:	83 ec 0c             	sub    $0xc,%esp
+  8016bd:	6a 01                	push   $0x1
+  8016bf:	e8 1e fa ff ff       	call   8010e2 <ipc_find_env>
+  8016c4:	a3 00 40 80 00       	mov    %eax,0x804000
+  8016c9:	83 c4 10             	add    $0x10,%esp
+  8016cc:	eb c5                	jmp    801693 <fsipc+0x12>
+
+008016ce <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8016ce:	55                   	push   %ebp
+  8016cf:	89 e5                	mov    %esp,%ebp
+  8016d1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8016d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016d7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016da:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8016df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016e2:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8016e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ec:	b8 02 00 00 00       	mov    $0x2,%eax
+  8016f1:	e8 8b ff ff ff       	call   801681 <fsipc>
+}
+  8016f6:	c9                   	leave
+  8016f7:	c3                   	ret
+
+008016f8 <devfile_flush>:
+{
+  8016f8:	55                   	push   %ebp
+  8016f9:	89 e5                	mov    %esp,%ebp
+  8016fb:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8016fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801701:	8b 40 0c             	mov    0xc(%eax),%eax
+  801704:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801709:	ba 00 00 00 00       	mov    $0x0,%edx
+  80170e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801713:	e8 69 ff ff ff       	call   801681 <fsipc>
+}
+  801718:	c9                   	leave
+  801719:	c3                   	ret
+
+0080171a <devfile_stat>:
+{
+  80171a:	55                   	push   %ebp
+  80171b:	89 e5                	mov    %esp,%ebp
+  80171d:	53                   	push   %ebx
+  80171e:	83 ec 04             	sub    $0x4,%esp
+  801721:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801724:	8b 45 08             	mov    0x8(%ebp),%eax
+  801727:	8b 40 0c             	mov    0xc(%eax),%eax
+  80172a:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80172f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801734:	b8 05 00 00 00       	mov    $0x5,%eax
+  801739:	e8 43 ff ff ff       	call   801681 <fsipc>
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	78 2c                	js     80176e <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801742:	83 ec 08             	sub    $0x8,%esp
+  801745:	68 00 50 80 00       	push   $0x805000
+  80174a:	53                   	push   %ebx
+  80174b:	e8 34 f0 ff ff       	call   800784 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801750:	a1 80 50 80 00       	mov    0x805080,%eax
+  801755:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80175b:	a1 84 50 80 00       	mov    0x805084,%eax
+  801760:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801766:	83 c4 10             	add    $0x10,%esp
+  801769:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80176e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801771:	c9                   	leave
+  801772:	c3                   	ret
+
+00801773 <devfile_write>:
+{
+  801773:	55                   	push   %ebp
+  801774:	89 e5                	mov    %esp,%ebp
+  801776:	83 ec 0c             	sub    $0xc,%esp
+  801779:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80177c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801781:	39 d0                	cmp    %edx,%eax
+  801783:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801786:	8b 55 08             	mov    0x8(%ebp),%edx
+  801789:	8b 52 0c             	mov    0xc(%edx),%edx
+  80178c:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801792:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801797:	50                   	push   %eax
+  801798:	ff 75 0c             	push   0xc(%ebp)
+  80179b:	68 08 50 80 00       	push   $0x805008
+  8017a0:	e8 65 f1 ff ff       	call   80090a <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8017a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017aa:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017af:	e8 cd fe ff ff       	call   801681 <fsipc>
+}
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+
+008017b6 <devfile_read>:
+{
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+  8017b9:	56                   	push   %esi
+  8017ba:	53                   	push   %ebx
+  8017bb:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8017be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017c4:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  8017c9:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8017cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8017d9:	e8 a3 fe ff ff       	call   801681 <fsipc>
+  8017de:	89 c3                	mov    %eax,%ebx
+  8017e0:	85 c0                	test   %eax,%eax
+  8017e2:	78 1f                	js     801803 <devfile_read+0x4d>
+	assert(r <= n);
+  8017e4:	39 c6                	cmp    %eax,%esi
+  8017e6:	72 24                	jb     80180c <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8017e8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8017ed:	7f 33                	jg     801822 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8017ef:	83 ec 04             	sub    $0x4,%esp
+  8017f2:	50                   	push   %eax
+  8017f3:	68 00 50 80 00       	push   $0x805000
+  8017f8:	ff 75 0c             	push   0xc(%ebp)
+  8017fb:	e8 0a f1 ff ff       	call   80090a <memmove>
+	return r;
+  801800:	83 c4 10             	add    $0x10,%esp
+}
+  801803:	89 d8                	mov    %ebx,%eax
+  801805:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801808:	5b                   	pop    %ebx
+  801809:	5e                   	pop    %esi
+  80180a:	5d                   	pop    %ebp
+  80180b:	c3                   	ret
+	assert(r <= n);
+  80180c:	68 fc 2a 80 00       	push   $0x802afc
+  801811:	68 03 2b 80 00       	push   $0x802b03
+  801816:	6a 7c                	push   $0x7c
+  801818:	68 18 2b 80 00       	push   $0x802b18
+  80181d:	e8 e1 09 00 00       	call   802203 <_panic>
+	assert(r <= PGSIZE);
+  801822:	68 23 2b 80 00       	push   $0x802b23
+  801827:	68 03 2b 80 00       	push   $0x802b03
+  80182c:	6a 7d                	push   $0x7d
+  80182e:	68 18 2b 80 00       	push   $0x802b18
+  801833:	e8 cb 09 00 00       	call   802203 <_panic>
+
+00801838 <open>:
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	56                   	push   %esi
+  80183c:	53                   	push   %ebx
+  80183d:	83 ec 1c             	sub    $0x1c,%esp
+  801840:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801843:	56                   	push   %esi
+  801844:	e8 00 ef ff ff       	call   800749 <strlen>
+  801849:	83 c4 10             	add    $0x10,%esp
+  80184c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801851:	7f 6c                	jg     8018bf <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801853:	83 ec 0c             	sub    $0xc,%esp
+  801856:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801859:	50                   	push   %eax
+  80185a:	e8 ba f8 ff ff       	call   801119 <fd_alloc>
+  80185f:	89 c3                	mov    %eax,%ebx
+  801861:	83 c4 10             	add    $0x10,%esp
+  801864:	85 c0                	test   %eax,%eax
+  801866:	78 3c                	js     8018a4 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801868:	83 ec 08             	sub    $0x8,%esp
+  80186b:	56                   	push   %esi
+  80186c:	68 00 50 80 00       	push   $0x805000
+  801871:	e8 0e ef ff ff       	call   800784 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801876:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801879:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80187e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801881:	b8 01 00 00 00       	mov    $0x1,%eax
+  801886:	e8 f6 fd ff ff       	call   801681 <fsipc>
+  80188b:	89 c3                	mov    %eax,%ebx
+  80188d:	83 c4 10             	add    $0x10,%esp
+  801890:	85 c0                	test   %eax,%eax
+  801892:	78 19                	js     8018ad <open+0x75>
+	return fd2num(fd);
+  801894:	83 ec 0c             	sub    $0xc,%esp
+  801897:	ff 75 f4             	push   -0xc(%ebp)
+  80189a:	e8 53 f8 ff ff       	call   8010f2 <fd2num>
+  80189f:	89 c3                	mov    %eax,%ebx
+  8018a1:	83 c4 10             	add    $0x10,%esp
+}
+  8018a4:	89 d8                	mov    %ebx,%eax
+  8018a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018a9:	5b                   	pop    %ebx
+  8018aa:	5e                   	pop    %esi
+  8018ab:	5d                   	pop    %ebp
+  8018ac:	c3                   	ret
+		fd_close(fd, 0);
+  8018ad:	83 ec 08             	sub    $0x8,%esp
+  8018b0:	6a 00                	push   $0x0
+  8018b2:	ff 75 f4             	push   -0xc(%ebp)
+  8018b5:	e8 58 f9 ff ff       	call   801212 <fd_close>
+		return r;
+  8018ba:	83 c4 10             	add    $0x10,%esp
+  8018bd:	eb e5                	jmp    8018a4 <open+0x6c>
+		return -E_BAD_PATH;
+  8018bf:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8018c4:	eb de                	jmp    8018a4 <open+0x6c>
+
+008018c6 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8018c6:	55                   	push   %ebp
+  8018c7:	89 e5                	mov    %esp,%ebp
+  8018c9:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8018cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018d6:	e8 a6 fd ff ff       	call   801681 <fsipc>
+}
+  8018db:	c9                   	leave
+  8018dc:	c3                   	ret
+
+008018dd <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8018dd:	55                   	push   %ebp
+  8018de:	89 e5                	mov    %esp,%ebp
+  8018e0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8018e3:	68 2f 2b 80 00       	push   $0x802b2f
+  8018e8:	ff 75 0c             	push   0xc(%ebp)
+  8018eb:	e8 94 ee ff ff       	call   800784 <strcpy>
+	return 0;
+}
+  8018f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f5:	c9                   	leave
+  8018f6:	c3                   	ret
+
+008018f7 <devsock_close>:
+{
+  8018f7:	55                   	push   %ebp
+  8018f8:	89 e5                	mov    %esp,%ebp
+  8018fa:	53                   	push   %ebx
+  8018fb:	83 ec 10             	sub    $0x10,%esp
+  8018fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801901:	53                   	push   %ebx
+  801902:	e8 42 09 00 00       	call   802249 <pageref>
+  801907:	89 c2                	mov    %eax,%edx
+  801909:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80190c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801911:	83 fa 01             	cmp    $0x1,%edx
+  801914:	74 05                	je     80191b <devsock_close+0x24>
+}
+  801916:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801919:	c9                   	leave
+  80191a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80191b:	83 ec 0c             	sub    $0xc,%esp
+  80191e:	ff 73 0c             	push   0xc(%ebx)
+  801921:	e8 b7 02 00 00       	call   801bdd <nsipc_close>
+  801926:	83 c4 10             	add    $0x10,%esp
+  801929:	eb eb                	jmp    801916 <devsock_close+0x1f>
+
+0080192b <devsock_write>:
+{
+  80192b:	55                   	push   %ebp
+  80192c:	89 e5                	mov    %esp,%ebp
+  80192e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801931:	6a 00                	push   $0x0
+  801933:	ff 75 10             	push   0x10(%ebp)
+  801936:	ff 75 0c             	push   0xc(%ebp)
+  801939:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193c:	ff 70 0c             	push   0xc(%eax)
+  80193f:	e8 79 03 00 00       	call   801cbd <nsipc_send>
+}
+  801944:	c9                   	leave
+  801945:	c3                   	ret
+
+00801946 <devsock_read>:
+{
+  801946:	55                   	push   %ebp
+  801947:	89 e5                	mov    %esp,%ebp
+  801949:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80194c:	6a 00                	push   $0x0
+  80194e:	ff 75 10             	push   0x10(%ebp)
+  801951:	ff 75 0c             	push   0xc(%ebp)
+  801954:	8b 45 08             	mov    0x8(%ebp),%eax
+  801957:	ff 70 0c             	push   0xc(%eax)
+  80195a:	e8 ef 02 00 00       	call   801c4e <nsipc_recv>
+}
+  80195f:	c9                   	leave
+  801960:	c3                   	ret
+
+00801961 <fd2sockid>:
+{
+  801961:	55                   	push   %ebp
+  801962:	89 e5                	mov    %esp,%ebp
+  801964:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801967:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80196a:	52                   	push   %edx
+  80196b:	50                   	push   %eax
+  80196c:	e8 fe f7 ff ff       	call   80116f <fd_lookup>
+  801971:	83 c4 10             	add    $0x10,%esp
+  801974:	85 c0                	test   %eax,%eax
+  801976:	78 10                	js     801988 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801978:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80197b:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801981:	39 08                	cmp    %ecx,(%eax)
+  801983:	75 05                	jne    80198a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801985:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801988:	c9                   	leave
+  801989:	c3                   	ret
+		return -E_NOT_SUPP;
+  80198a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80198f:	eb f7                	jmp    801988 <fd2sockid+0x27>
+
+00801991 <alloc_sockfd>:
+{
+  801991:	55                   	push   %ebp
+  801992:	89 e5                	mov    %esp,%ebp
+  801994:	56                   	push   %esi
+  801995:	53                   	push   %ebx
+  801996:	83 ec 1c             	sub    $0x1c,%esp
+  801999:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80199b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80199e:	50                   	push   %eax
+  80199f:	e8 75 f7 ff ff       	call   801119 <fd_alloc>
+  8019a4:	89 c3                	mov    %eax,%ebx
+  8019a6:	83 c4 10             	add    $0x10,%esp
+  8019a9:	85 c0                	test   %eax,%eax
+  8019ab:	78 43                	js     8019f0 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8019ad:	83 ec 04             	sub    $0x4,%esp
+  8019b0:	68 07 04 00 00       	push   $0x407
+  8019b5:	ff 75 f4             	push   -0xc(%ebp)
+  8019b8:	6a 00                	push   $0x0
+  8019ba:	e8 32 f2 ff ff       	call   800bf1 <sys_page_alloc>
+  8019bf:	89 c3                	mov    %eax,%ebx
+  8019c1:	83 c4 10             	add    $0x10,%esp
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	78 28                	js     8019f0 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8019c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019cb:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8019d1:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8019d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019d6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8019dd:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8019e0:	83 ec 0c             	sub    $0xc,%esp
+  8019e3:	50                   	push   %eax
+  8019e4:	e8 09 f7 ff ff       	call   8010f2 <fd2num>
+  8019e9:	89 c3                	mov    %eax,%ebx
+  8019eb:	83 c4 10             	add    $0x10,%esp
+  8019ee:	eb 0c                	jmp    8019fc <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8019f0:	83 ec 0c             	sub    $0xc,%esp
+  8019f3:	56                   	push   %esi
+  8019f4:	e8 e4 01 00 00       	call   801bdd <nsipc_close>
+		return r;
+  8019f9:	83 c4 10             	add    $0x10,%esp
+}
+  8019fc:	89 d8                	mov    %ebx,%eax
+  8019fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a01:	5b                   	pop    %ebx
+  801a02:	5e                   	pop    %esi
+  801a03:	5d                   	pop    %ebp
+  801a04:	c3                   	ret
+
+00801a05 <accept>:
+{
+  801a05:	55                   	push   %ebp
+  801a06:	89 e5                	mov    %esp,%ebp
+  801a08:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a0e:	e8 4e ff ff ff       	call   801961 <fd2sockid>
+  801a13:	85 c0                	test   %eax,%eax
+  801a15:	78 1b                	js     801a32 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801a17:	83 ec 04             	sub    $0x4,%esp
+  801a1a:	ff 75 10             	push   0x10(%ebp)
+  801a1d:	ff 75 0c             	push   0xc(%ebp)
+  801a20:	50                   	push   %eax
+  801a21:	e8 0e 01 00 00       	call   801b34 <nsipc_accept>
+  801a26:	83 c4 10             	add    $0x10,%esp
+  801a29:	85 c0                	test   %eax,%eax
+  801a2b:	78 05                	js     801a32 <accept+0x2d>
+	return alloc_sockfd(r);
+  801a2d:	e8 5f ff ff ff       	call   801991 <alloc_sockfd>
+}
+  801a32:	c9                   	leave
+  801a33:	c3                   	ret
+
+00801a34 <bind>:
+{
+  801a34:	55                   	push   %ebp
+  801a35:	89 e5                	mov    %esp,%ebp
+  801a37:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a3d:	e8 1f ff ff ff       	call   801961 <fd2sockid>
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	78 12                	js     801a58 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801a46:	83 ec 04             	sub    $0x4,%esp
+  801a49:	ff 75 10             	push   0x10(%ebp)
+  801a4c:	ff 75 0c             	push   0xc(%ebp)
+  801a4f:	50                   	push   %eax
+  801a50:	e8 31 01 00 00       	call   801b86 <nsipc_bind>
+  801a55:	83 c4 10             	add    $0x10,%esp
+}
+  801a58:	c9                   	leave
+  801a59:	c3                   	ret
+
+00801a5a <shutdown>:
+{
+  801a5a:	55                   	push   %ebp
+  801a5b:	89 e5                	mov    %esp,%ebp
+  801a5d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a63:	e8 f9 fe ff ff       	call   801961 <fd2sockid>
+  801a68:	85 c0                	test   %eax,%eax
+  801a6a:	78 0f                	js     801a7b <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801a6c:	83 ec 08             	sub    $0x8,%esp
+  801a6f:	ff 75 0c             	push   0xc(%ebp)
+  801a72:	50                   	push   %eax
+  801a73:	e8 43 01 00 00       	call   801bbb <nsipc_shutdown>
+  801a78:	83 c4 10             	add    $0x10,%esp
+}
+  801a7b:	c9                   	leave
+  801a7c:	c3                   	ret
+
+00801a7d <connect>:
+{
+  801a7d:	55                   	push   %ebp
+  801a7e:	89 e5                	mov    %esp,%ebp
+  801a80:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a86:	e8 d6 fe ff ff       	call   801961 <fd2sockid>
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	78 12                	js     801aa1 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801a8f:	83 ec 04             	sub    $0x4,%esp
+  801a92:	ff 75 10             	push   0x10(%ebp)
+  801a95:	ff 75 0c             	push   0xc(%ebp)
+  801a98:	50                   	push   %eax
+  801a99:	e8 59 01 00 00       	call   801bf7 <nsipc_connect>
+  801a9e:	83 c4 10             	add    $0x10,%esp
+}
+  801aa1:	c9                   	leave
+  801aa2:	c3                   	ret
+
+00801aa3 <listen>:
+{
+  801aa3:	55                   	push   %ebp
+  801aa4:	89 e5                	mov    %esp,%ebp
+  801aa6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801aa9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aac:	e8 b0 fe ff ff       	call   801961 <fd2sockid>
+  801ab1:	85 c0                	test   %eax,%eax
+  801ab3:	78 0f                	js     801ac4 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801ab5:	83 ec 08             	sub    $0x8,%esp
+  801ab8:	ff 75 0c             	push   0xc(%ebp)
+  801abb:	50                   	push   %eax
+  801abc:	e8 6b 01 00 00       	call   801c2c <nsipc_listen>
+  801ac1:	83 c4 10             	add    $0x10,%esp
+}
+  801ac4:	c9                   	leave
+  801ac5:	c3                   	ret
+
+00801ac6 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801ac6:	55                   	push   %ebp
+  801ac7:	89 e5                	mov    %esp,%ebp
+  801ac9:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801acc:	ff 75 10             	push   0x10(%ebp)
+  801acf:	ff 75 0c             	push   0xc(%ebp)
+  801ad2:	ff 75 08             	push   0x8(%ebp)
+  801ad5:	e8 41 02 00 00       	call   801d1b <nsipc_socket>
+  801ada:	83 c4 10             	add    $0x10,%esp
+  801add:	85 c0                	test   %eax,%eax
+  801adf:	78 05                	js     801ae6 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801ae1:	e8 ab fe ff ff       	call   801991 <alloc_sockfd>
+}
+  801ae6:	c9                   	leave
+  801ae7:	c3                   	ret
+
+00801ae8 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801ae8:	55                   	push   %ebp
+  801ae9:	89 e5                	mov    %esp,%ebp
+  801aeb:	53                   	push   %ebx
+  801aec:	83 ec 04             	sub    $0x4,%esp
+  801aef:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801af1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801af8:	74 26                	je     801b20 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801afa:	6a 07                	push   $0x7
+  801afc:	68 00 60 80 00       	push   $0x806000
+  801b01:	53                   	push   %ebx
+  801b02:	ff 35 04 40 80 00    	push   0x804004
+  801b08:	e8 81 f5 ff ff       	call   80108e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801b0d:	83 c4 0c             	add    $0xc,%esp
+  801b10:	6a 00                	push   $0x0
+  801b12:	6a 00                	push   $0x0
+  801b14:	6a 00                	push   $0x0
+  801b16:	e8 fb f4 ff ff       	call   801016 <ipc_recv>
+}
+  801b1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b1e:	c9                   	leave
+  801b1f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801b20:	83 ec 0c             	sub    $0xc,%esp
+  801b23:	6a 02                	push   $0x2
+  801b25:	e8 b8 f5 ff ff       	call   8010e2 <ipc_find_env>
+  801b2a:	a3 04 40 80 00       	mov    %eax,0x804004
+  801b2f:	83 c4 10             	add    $0x10,%esp
+  801b32:	eb c6                	jmp    801afa <nsipc+0x12>
+
+00801b34 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801b34:	55                   	push   %ebp
+  801b35:	89 e5                	mov    %esp,%ebp
+  801b37:	56                   	push   %esi
+  801b38:	53                   	push   %ebx
+  801b39:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801b3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b3f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801b44:	8b 06                	mov    (%esi),%eax
+  801b46:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801b4b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b50:	e8 93 ff ff ff       	call   801ae8 <nsipc>
+  801b55:	89 c3                	mov    %eax,%ebx
+  801b57:	85 c0                	test   %eax,%eax
+  801b59:	79 09                	jns    801b64 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801b5b:	89 d8                	mov    %ebx,%eax
+  801b5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b60:	5b                   	pop    %ebx
+  801b61:	5e                   	pop    %esi
+  801b62:	5d                   	pop    %ebp
+  801b63:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801b64:	83 ec 04             	sub    $0x4,%esp
+  801b67:	ff 35 10 60 80 00    	push   0x806010
+  801b6d:	68 00 60 80 00       	push   $0x806000
+  801b72:	ff 75 0c             	push   0xc(%ebp)
+  801b75:	e8 90 ed ff ff       	call   80090a <memmove>
+		*addrlen = ret->ret_addrlen;
+  801b7a:	a1 10 60 80 00       	mov    0x806010,%eax
+  801b7f:	89 06                	mov    %eax,(%esi)
+  801b81:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801b84:	eb d5                	jmp    801b5b <nsipc_accept+0x27>
+
+00801b86 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801b86:	55                   	push   %ebp
+  801b87:	89 e5                	mov    %esp,%ebp
+  801b89:	53                   	push   %ebx
+  801b8a:	83 ec 08             	sub    $0x8,%esp
+  801b8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801b90:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b93:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801b98:	53                   	push   %ebx
+  801b99:	ff 75 0c             	push   0xc(%ebp)
+  801b9c:	68 04 60 80 00       	push   $0x806004
+  801ba1:	e8 64 ed ff ff       	call   80090a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801ba6:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801bac:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bb1:	e8 32 ff ff ff       	call   801ae8 <nsipc>
+}
+  801bb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bb9:	c9                   	leave
+  801bba:	c3                   	ret
+
+00801bbb <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801bbb:	55                   	push   %ebp
+  801bbc:	89 e5                	mov    %esp,%ebp
+  801bbe:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801bc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc4:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801bc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bcc:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801bd1:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bd6:	e8 0d ff ff ff       	call   801ae8 <nsipc>
+}
+  801bdb:	c9                   	leave
+  801bdc:	c3                   	ret
+
+00801bdd <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801bdd:	55                   	push   %ebp
+  801bde:	89 e5                	mov    %esp,%ebp
+  801be0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801be3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be6:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801beb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801bf0:	e8 f3 fe ff ff       	call   801ae8 <nsipc>
+}
+  801bf5:	c9                   	leave
+  801bf6:	c3                   	ret
+
+00801bf7 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801bf7:	55                   	push   %ebp
+  801bf8:	89 e5                	mov    %esp,%ebp
+  801bfa:	53                   	push   %ebx
+  801bfb:	83 ec 08             	sub    $0x8,%esp
+  801bfe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801c01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c04:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801c09:	53                   	push   %ebx
+  801c0a:	ff 75 0c             	push   0xc(%ebp)
+  801c0d:	68 04 60 80 00       	push   $0x806004
+  801c12:	e8 f3 ec ff ff       	call   80090a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801c17:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801c1d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c22:	e8 c1 fe ff ff       	call   801ae8 <nsipc>
+}
+  801c27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c2a:	c9                   	leave
+  801c2b:	c3                   	ret
+
+00801c2c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801c2c:	55                   	push   %ebp
+  801c2d:	89 e5                	mov    %esp,%ebp
+  801c2f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801c32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c35:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801c3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c3d:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801c42:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c47:	e8 9c fe ff ff       	call   801ae8 <nsipc>
+}
+  801c4c:	c9                   	leave
+  801c4d:	c3                   	ret
+
+00801c4e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801c4e:	55                   	push   %ebp
+  801c4f:	89 e5                	mov    %esp,%ebp
+  801c51:	56                   	push   %esi
+  801c52:	53                   	push   %ebx
+  801c53:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801c56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c59:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801c5e:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801c64:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c67:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801c6c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c71:	e8 72 fe ff ff       	call   801ae8 <nsipc>
+  801c76:	89 c3                	mov    %eax,%ebx
+  801c78:	85 c0                	test   %eax,%eax
+  801c7a:	78 22                	js     801c9e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801c7c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801c81:	39 c6                	cmp    %eax,%esi
+  801c83:	0f 4e c6             	cmovle %esi,%eax
+  801c86:	39 c3                	cmp    %eax,%ebx
+  801c88:	7f 1d                	jg     801ca7 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801c8a:	83 ec 04             	sub    $0x4,%esp
+  801c8d:	53                   	push   %ebx
+  801c8e:	68 00 60 80 00       	push   $0x806000
+  801c93:	ff 75 0c             	push   0xc(%ebp)
+  801c96:	e8 6f ec ff ff       	call   80090a <memmove>
+  801c9b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801c9e:	89 d8                	mov    %ebx,%eax
+  801ca0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ca3:	5b                   	pop    %ebx
+  801ca4:	5e                   	pop    %esi
+  801ca5:	5d                   	pop    %ebp
+  801ca6:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801ca7:	68 3b 2b 80 00       	push   $0x802b3b
+  801cac:	68 03 2b 80 00       	push   $0x802b03
+  801cb1:	6a 62                	push   $0x62
+  801cb3:	68 50 2b 80 00       	push   $0x802b50
+  801cb8:	e8 46 05 00 00       	call   802203 <_panic>
+
+00801cbd <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801cbd:	55                   	push   %ebp
+  801cbe:	89 e5                	mov    %esp,%ebp
+  801cc0:	53                   	push   %ebx
+  801cc1:	83 ec 04             	sub    $0x4,%esp
+  801cc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801cc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cca:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801ccf:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801cd5:	7f 2e                	jg     801d05 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801cd7:	83 ec 04             	sub    $0x4,%esp
+  801cda:	53                   	push   %ebx
+  801cdb:	ff 75 0c             	push   0xc(%ebp)
+  801cde:	68 0c 60 80 00       	push   $0x80600c
+  801ce3:	e8 22 ec ff ff       	call   80090a <memmove>
+	nsipcbuf.send.req_size = size;
+  801ce8:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801cee:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf1:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801cf6:	b8 08 00 00 00       	mov    $0x8,%eax
+  801cfb:	e8 e8 fd ff ff       	call   801ae8 <nsipc>
+}
+  801d00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d03:	c9                   	leave
+  801d04:	c3                   	ret
+	assert(size < 1600);
+  801d05:	68 5c 2b 80 00       	push   $0x802b5c
+  801d0a:	68 03 2b 80 00       	push   $0x802b03
+  801d0f:	6a 6d                	push   $0x6d
+  801d11:	68 50 2b 80 00       	push   $0x802b50
+  801d16:	e8 e8 04 00 00       	call   802203 <_panic>
+
+00801d1b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801d1b:	55                   	push   %ebp
+  801d1c:	89 e5                	mov    %esp,%ebp
+  801d1e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801d21:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d24:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801d29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d2c:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801d31:	8b 45 10             	mov    0x10(%ebp),%eax
+  801d34:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801d39:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d3e:	e8 a5 fd ff ff       	call   801ae8 <nsipc>
+}
+  801d43:	c9                   	leave
+  801d44:	c3                   	ret
+
+00801d45 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d45:	55                   	push   %ebp
+  801d46:	89 e5                	mov    %esp,%ebp
+  801d48:	56                   	push   %esi
+  801d49:	53                   	push   %ebx
+  801d4a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801d4d:	83 ec 0c             	sub    $0xc,%esp
+  801d50:	ff 75 08             	push   0x8(%ebp)
+  801d53:	e8 aa f3 ff ff       	call   801102 <fd2data>
+  801d58:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801d5a:	83 c4 08             	add    $0x8,%esp
+  801d5d:	68 68 2b 80 00       	push   $0x802b68
+  801d62:	53                   	push   %ebx
+  801d63:	e8 1c ea ff ff       	call   800784 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801d68:	8b 46 04             	mov    0x4(%esi),%eax
+  801d6b:	2b 06                	sub    (%esi),%eax
+  801d6d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801d73:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d7a:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d7d:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801d84:	30 80 00 
+	return 0;
+}
+  801d87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d8f:	5b                   	pop    %ebx
+  801d90:	5e                   	pop    %esi
+  801d91:	5d                   	pop    %ebp
+  801d92:	c3                   	ret
+
+00801d93 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d93:	55                   	push   %ebp
+  801d94:	89 e5                	mov    %esp,%ebp
+  801d96:	53                   	push   %ebx
+  801d97:	83 ec 0c             	sub    $0xc,%esp
+  801d9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d9d:	53                   	push   %ebx
+  801d9e:	6a 00                	push   $0x0
+  801da0:	e8 14 ef ff ff       	call   800cb9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801da5:	89 1c 24             	mov    %ebx,(%esp)
+  801da8:	e8 55 f3 ff ff       	call   801102 <fd2data>
+  801dad:	83 c4 08             	add    $0x8,%esp
+  801db0:	50                   	push   %eax
+  801db1:	6a 00                	push   $0x0
+  801db3:	e8 01 ef ff ff       	call   800cb9 <sys_page_unmap>
+}
+  801db8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dbb:	c9                   	leave
+  801dbc:	c3                   	ret
+
+00801dbd <_pipeisclosed>:
+{
+  801dbd:	55                   	push   %ebp
+  801dbe:	89 e5                	mov    %esp,%ebp
+  801dc0:	57                   	push   %edi
+  801dc1:	56                   	push   %esi
+  801dc2:	53                   	push   %ebx
+  801dc3:	83 ec 1c             	sub    $0x1c,%esp
+  801dc6:	89 c7                	mov    %eax,%edi
+  801dc8:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801dca:	a1 08 40 80 00       	mov    0x804008,%eax
+  801dcf:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801dd2:	83 ec 0c             	sub    $0xc,%esp
+  801dd5:	57                   	push   %edi
+  801dd6:	e8 6e 04 00 00       	call   802249 <pageref>
+  801ddb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dde:	89 34 24             	mov    %esi,(%esp)
+  801de1:	e8 63 04 00 00       	call   802249 <pageref>
+		nn = thisenv->env_runs;
+  801de6:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801dec:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801def:	83 c4 10             	add    $0x10,%esp
+  801df2:	39 cb                	cmp    %ecx,%ebx
+  801df4:	74 1b                	je     801e11 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801df6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801df9:	75 cf                	jne    801dca <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801dfb:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801dfe:	6a 01                	push   $0x1
+  801e00:	50                   	push   %eax
+  801e01:	53                   	push   %ebx
+  801e02:	68 6f 2b 80 00       	push   $0x802b6f
+  801e07:	e8 8a e3 ff ff       	call   800196 <cprintf>
+  801e0c:	83 c4 10             	add    $0x10,%esp
+  801e0f:	eb b9                	jmp    801dca <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801e11:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e14:	0f 94 c0             	sete   %al
+  801e17:	0f b6 c0             	movzbl %al,%eax
+}
+  801e1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e1d:	5b                   	pop    %ebx
+  801e1e:	5e                   	pop    %esi
+  801e1f:	5f                   	pop    %edi
+  801e20:	5d                   	pop    %ebp
+  801e21:	c3                   	ret
+
+00801e22 <devpipe_write>:
+{
+  801e22:	55                   	push   %ebp
+  801e23:	89 e5                	mov    %esp,%ebp
+  801e25:	57                   	push   %edi
+  801e26:	56                   	push   %esi
+  801e27:	53                   	push   %ebx
+  801e28:	83 ec 28             	sub    $0x28,%esp
+  801e2b:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801e2e:	56                   	push   %esi
+  801e2f:	e8 ce f2 ff ff       	call   801102 <fd2data>
+  801e34:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801e36:	83 c4 10             	add    $0x10,%esp
+  801e39:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e3e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801e41:	75 09                	jne    801e4c <devpipe_write+0x2a>
+	return i;
+  801e43:	89 f8                	mov    %edi,%eax
+  801e45:	eb 23                	jmp    801e6a <devpipe_write+0x48>
+			sys_yield();
+  801e47:	e8 25 ed ff ff       	call   800b71 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801e4c:	8b 43 04             	mov    0x4(%ebx),%eax
+  801e4f:	8b 0b                	mov    (%ebx),%ecx
+  801e51:	8d 51 20             	lea    0x20(%ecx),%edx
+  801e54:	39 d0                	cmp    %edx,%eax
+  801e56:	72 1a                	jb     801e72 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801e58:	89 da                	mov    %ebx,%edx
+  801e5a:	89 f0                	mov    %esi,%eax
+  801e5c:	e8 5c ff ff ff       	call   801dbd <_pipeisclosed>
+  801e61:	85 c0                	test   %eax,%eax
+  801e63:	74 e2                	je     801e47 <devpipe_write+0x25>
+				return 0;
+  801e65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e6d:	5b                   	pop    %ebx
+  801e6e:	5e                   	pop    %esi
+  801e6f:	5f                   	pop    %edi
+  801e70:	5d                   	pop    %ebp
+  801e71:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801e72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e75:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801e79:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801e7c:	89 c2                	mov    %eax,%edx
+  801e7e:	c1 fa 1f             	sar    $0x1f,%edx
+  801e81:	89 d1                	mov    %edx,%ecx
+  801e83:	c1 e9 1b             	shr    $0x1b,%ecx
+  801e86:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801e89:	83 e2 1f             	and    $0x1f,%edx
+  801e8c:	29 ca                	sub    %ecx,%edx
+  801e8e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801e92:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801e96:	83 c0 01             	add    $0x1,%eax
+  801e99:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801e9c:	83 c7 01             	add    $0x1,%edi
+  801e9f:	eb 9d                	jmp    801e3e <devpipe_write+0x1c>
+
+00801ea1 <devpipe_read>:
+{
+  801ea1:	55                   	push   %ebp
+  801ea2:	89 e5                	mov    %esp,%ebp
+  801ea4:	57                   	push   %edi
+  801ea5:	56                   	push   %esi
+  801ea6:	53                   	push   %ebx
+  801ea7:	83 ec 18             	sub    $0x18,%esp
+  801eaa:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801ead:	57                   	push   %edi
+  801eae:	e8 4f f2 ff ff       	call   801102 <fd2data>
+  801eb3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801eb5:	83 c4 10             	add    $0x10,%esp
+  801eb8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ebd:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801ec0:	75 13                	jne    801ed5 <devpipe_read+0x34>
+	return i;
+  801ec2:	89 f0                	mov    %esi,%eax
+  801ec4:	eb 02                	jmp    801ec8 <devpipe_read+0x27>
+				return i;
+  801ec6:	89 f0                	mov    %esi,%eax
+}
+  801ec8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ecb:	5b                   	pop    %ebx
+  801ecc:	5e                   	pop    %esi
+  801ecd:	5f                   	pop    %edi
+  801ece:	5d                   	pop    %ebp
+  801ecf:	c3                   	ret
+			sys_yield();
+  801ed0:	e8 9c ec ff ff       	call   800b71 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801ed5:	8b 03                	mov    (%ebx),%eax
+  801ed7:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801eda:	75 18                	jne    801ef4 <devpipe_read+0x53>
+			if (i > 0)
+  801edc:	85 f6                	test   %esi,%esi
+  801ede:	75 e6                	jne    801ec6 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801ee0:	89 da                	mov    %ebx,%edx
+  801ee2:	89 f8                	mov    %edi,%eax
+  801ee4:	e8 d4 fe ff ff       	call   801dbd <_pipeisclosed>
+  801ee9:	85 c0                	test   %eax,%eax
+  801eeb:	74 e3                	je     801ed0 <devpipe_read+0x2f>
+				return 0;
+  801eed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef2:	eb d4                	jmp    801ec8 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801ef4:	99                   	cltd
+  801ef5:	c1 ea 1b             	shr    $0x1b,%edx
+  801ef8:	01 d0                	add    %edx,%eax
+  801efa:	83 e0 1f             	and    $0x1f,%eax
+  801efd:	29 d0                	sub    %edx,%eax
+  801eff:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801f04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f07:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801f0a:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801f0d:	83 c6 01             	add    $0x1,%esi
+  801f10:	eb ab                	jmp    801ebd <devpipe_read+0x1c>
+
+00801f12 <pipe>:
+{
+  801f12:	55                   	push   %ebp
+  801f13:	89 e5                	mov    %esp,%ebp
+  801f15:	56                   	push   %esi
+  801f16:	53                   	push   %ebx
+  801f17:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801f1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f1d:	50                   	push   %eax
+  801f1e:	e8 f6 f1 ff ff       	call   801119 <fd_alloc>
+  801f23:	89 c3                	mov    %eax,%ebx
+  801f25:	83 c4 10             	add    $0x10,%esp
+  801f28:	85 c0                	test   %eax,%eax
+  801f2a:	0f 88 23 01 00 00    	js     802053 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f30:	83 ec 04             	sub    $0x4,%esp
+  801f33:	68 07 04 00 00       	push   $0x407
+  801f38:	ff 75 f4             	push   -0xc(%ebp)
+  801f3b:	6a 00                	push   $0x0
+  801f3d:	e8 af ec ff ff       	call   800bf1 <sys_page_alloc>
+  801f42:	89 c3                	mov    %eax,%ebx
+  801f44:	83 c4 10             	add    $0x10,%esp
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	0f 88 04 01 00 00    	js     802053 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801f4f:	83 ec 0c             	sub    $0xc,%esp
+  801f52:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f55:	50                   	push   %eax
+  801f56:	e8 be f1 ff ff       	call   801119 <fd_alloc>
+  801f5b:	89 c3                	mov    %eax,%ebx
+  801f5d:	83 c4 10             	add    $0x10,%esp
+  801f60:	85 c0                	test   %eax,%eax
+  801f62:	0f 88 db 00 00 00    	js     802043 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f68:	83 ec 04             	sub    $0x4,%esp
+  801f6b:	68 07 04 00 00       	push   $0x407
+  801f70:	ff 75 f0             	push   -0x10(%ebp)
+  801f73:	6a 00                	push   $0x0
+  801f75:	e8 77 ec ff ff       	call   800bf1 <sys_page_alloc>
+  801f7a:	89 c3                	mov    %eax,%ebx
+  801f7c:	83 c4 10             	add    $0x10,%esp
+  801f7f:	85 c0                	test   %eax,%eax
+  801f81:	0f 88 bc 00 00 00    	js     802043 <pipe+0x131>
+	va = fd2data(fd0);
+  801f87:	83 ec 0c             	sub    $0xc,%esp
+  801f8a:	ff 75 f4             	push   -0xc(%ebp)
+  801f8d:	e8 70 f1 ff ff       	call   801102 <fd2data>
+  801f92:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f94:	83 c4 0c             	add    $0xc,%esp
+  801f97:	68 07 04 00 00       	push   $0x407
+  801f9c:	50                   	push   %eax
+  801f9d:	6a 00                	push   $0x0
+  801f9f:	e8 4d ec ff ff       	call   800bf1 <sys_page_alloc>
+  801fa4:	89 c3                	mov    %eax,%ebx
+  801fa6:	83 c4 10             	add    $0x10,%esp
+  801fa9:	85 c0                	test   %eax,%eax
+  801fab:	0f 88 82 00 00 00    	js     802033 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fb1:	83 ec 0c             	sub    $0xc,%esp
+  801fb4:	ff 75 f0             	push   -0x10(%ebp)
+  801fb7:	e8 46 f1 ff ff       	call   801102 <fd2data>
+  801fbc:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801fc3:	50                   	push   %eax
+  801fc4:	6a 00                	push   $0x0
+  801fc6:	56                   	push   %esi
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	e8 a9 ec ff ff       	call   800c77 <sys_page_map>
+  801fce:	89 c3                	mov    %eax,%ebx
+  801fd0:	83 c4 20             	add    $0x20,%esp
+  801fd3:	85 c0                	test   %eax,%eax
+  801fd5:	78 4e                	js     802025 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801fd7:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801fdc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fdf:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801fe1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fe4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801feb:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801fee:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801ff0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801ff3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801ffa:	83 ec 0c             	sub    $0xc,%esp
+  801ffd:	ff 75 f4             	push   -0xc(%ebp)
+  802000:	e8 ed f0 ff ff       	call   8010f2 <fd2num>
+  802005:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802008:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80200a:	83 c4 04             	add    $0x4,%esp
+  80200d:	ff 75 f0             	push   -0x10(%ebp)
+  802010:	e8 dd f0 ff ff       	call   8010f2 <fd2num>
+  802015:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802018:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80201b:	83 c4 10             	add    $0x10,%esp
+  80201e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802023:	eb 2e                	jmp    802053 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802025:	83 ec 08             	sub    $0x8,%esp
+  802028:	56                   	push   %esi
+  802029:	6a 00                	push   $0x0
+  80202b:	e8 89 ec ff ff       	call   800cb9 <sys_page_unmap>
+  802030:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802033:	83 ec 08             	sub    $0x8,%esp
+  802036:	ff 75 f0             	push   -0x10(%ebp)
+  802039:	6a 00                	push   $0x0
+  80203b:	e8 79 ec ff ff       	call   800cb9 <sys_page_unmap>
+  802040:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802043:	83 ec 08             	sub    $0x8,%esp
+  802046:	ff 75 f4             	push   -0xc(%ebp)
+  802049:	6a 00                	push   $0x0
+  80204b:	e8 69 ec ff ff       	call   800cb9 <sys_page_unmap>
+  802050:	83 c4 10             	add    $0x10,%esp
+}
+  802053:	89 d8                	mov    %ebx,%eax
+  802055:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802058:	5b                   	pop    %ebx
+  802059:	5e                   	pop    %esi
+  80205a:	5d                   	pop    %ebp
+  80205b:	c3                   	ret
+
+0080205c <pipeisclosed>:
+{
+  80205c:	55                   	push   %ebp
+  80205d:	89 e5                	mov    %esp,%ebp
+  80205f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802062:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802065:	50                   	push   %eax
+  802066:	ff 75 08             	push   0x8(%ebp)
+  802069:	e8 01 f1 ff ff       	call   80116f <fd_lookup>
+  80206e:	83 c4 10             	add    $0x10,%esp
+  802071:	85 c0                	test   %eax,%eax
+  802073:	78 18                	js     80208d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802075:	83 ec 0c             	sub    $0xc,%esp
+  802078:	ff 75 f4             	push   -0xc(%ebp)
+  80207b:	e8 82 f0 ff ff       	call   801102 <fd2data>
+  802080:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802082:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802085:	e8 33 fd ff ff       	call   801dbd <_pipeisclosed>
+  80208a:	83 c4 10             	add    $0x10,%esp
+}
+  80208d:	c9                   	leave
+  80208e:	c3                   	ret
+
+0080208f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80208f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802094:	c3                   	ret
+
+00802095 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802095:	55                   	push   %ebp
+  802096:	89 e5                	mov    %esp,%ebp
+  802098:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80209b:	68 87 2b 80 00       	push   $0x802b87
+  8020a0:	ff 75 0c             	push   0xc(%ebp)
+  8020a3:	e8 dc e6 ff ff       	call   800784 <strcpy>
+	return 0;
+}
+  8020a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ad:	c9                   	leave
+  8020ae:	c3                   	ret
+
+008020af <devcons_write>:
+{
+  8020af:	55                   	push   %ebp
+  8020b0:	89 e5                	mov    %esp,%ebp
+  8020b2:	57                   	push   %edi
+  8020b3:	56                   	push   %esi
+  8020b4:	53                   	push   %ebx
+  8020b5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8020bb:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8020c0:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8020c6:	eb 2e                	jmp    8020f6 <devcons_write+0x47>
+		m = n - tot;
+  8020c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020cb:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8020cd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8020d2:	39 c3                	cmp    %eax,%ebx
+  8020d4:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8020d7:	83 ec 04             	sub    $0x4,%esp
+  8020da:	53                   	push   %ebx
+  8020db:	89 f0                	mov    %esi,%eax
+  8020dd:	03 45 0c             	add    0xc(%ebp),%eax
+  8020e0:	50                   	push   %eax
+  8020e1:	57                   	push   %edi
+  8020e2:	e8 23 e8 ff ff       	call   80090a <memmove>
+		sys_cputs(buf, m);
+  8020e7:	83 c4 08             	add    $0x8,%esp
+  8020ea:	53                   	push   %ebx
+  8020eb:	57                   	push   %edi
+  8020ec:	e8 c3 e9 ff ff       	call   800ab4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8020f1:	01 de                	add    %ebx,%esi
+  8020f3:	83 c4 10             	add    $0x10,%esp
+  8020f6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8020f9:	72 cd                	jb     8020c8 <devcons_write+0x19>
+}
+  8020fb:	89 f0                	mov    %esi,%eax
+  8020fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802100:	5b                   	pop    %ebx
+  802101:	5e                   	pop    %esi
+  802102:	5f                   	pop    %edi
+  802103:	5d                   	pop    %ebp
+  802104:	c3                   	ret
+
+00802105 <devcons_read>:
+{
+  802105:	55                   	push   %ebp
+  802106:	89 e5                	mov    %esp,%ebp
+  802108:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80210b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802110:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802114:	75 07                	jne    80211d <devcons_read+0x18>
+  802116:	eb 1f                	jmp    802137 <devcons_read+0x32>
+		sys_yield();
+  802118:	e8 54 ea ff ff       	call   800b71 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80211d:	e8 b0 e9 ff ff       	call   800ad2 <sys_cgetc>
+  802122:	85 c0                	test   %eax,%eax
+  802124:	74 f2                	je     802118 <devcons_read+0x13>
+	if (c < 0)
+  802126:	78 0f                	js     802137 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802128:	83 f8 04             	cmp    $0x4,%eax
+  80212b:	74 0c                	je     802139 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80212d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802130:	88 02                	mov    %al,(%edx)
+	return 1;
+  802132:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802137:	c9                   	leave
+  802138:	c3                   	ret
+		return 0;
+  802139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80213e:	eb f7                	jmp    802137 <devcons_read+0x32>
+
+00802140 <cputchar>:
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802146:	8b 45 08             	mov    0x8(%ebp),%eax
+  802149:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80214c:	6a 01                	push   $0x1
+  80214e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802151:	50                   	push   %eax
+  802152:	e8 5d e9 ff ff       	call   800ab4 <sys_cputs>
+}
+  802157:	83 c4 10             	add    $0x10,%esp
+  80215a:	c9                   	leave
+  80215b:	c3                   	ret
+
+0080215c <getchar>:
+{
+  80215c:	55                   	push   %ebp
+  80215d:	89 e5                	mov    %esp,%ebp
+  80215f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802162:	6a 01                	push   $0x1
+  802164:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802167:	50                   	push   %eax
+  802168:	6a 00                	push   $0x0
+  80216a:	e8 66 f2 ff ff       	call   8013d5 <read>
+	if (r < 0)
+  80216f:	83 c4 10             	add    $0x10,%esp
+  802172:	85 c0                	test   %eax,%eax
+  802174:	78 06                	js     80217c <getchar+0x20>
+	if (r < 1)
+  802176:	74 06                	je     80217e <getchar+0x22>
+	return c;
+  802178:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80217c:	c9                   	leave
+  80217d:	c3                   	ret
+		return -E_EOF;
+  80217e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802183:	eb f7                	jmp    80217c <getchar+0x20>
+
+00802185 <iscons>:
+{
+  802185:	55                   	push   %ebp
+  802186:	89 e5                	mov    %esp,%ebp
+  802188:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80218b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80218e:	50                   	push   %eax
+  80218f:	ff 75 08             	push   0x8(%ebp)
+  802192:	e8 d8 ef ff ff       	call   80116f <fd_lookup>
+  802197:	83 c4 10             	add    $0x10,%esp
+  80219a:	85 c0                	test   %eax,%eax
+  80219c:	78 11                	js     8021af <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80219e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021a1:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8021a7:	39 10                	cmp    %edx,(%eax)
+  8021a9:	0f 94 c0             	sete   %al
+  8021ac:	0f b6 c0             	movzbl %al,%eax
+}
+  8021af:	c9                   	leave
+  8021b0:	c3                   	ret
+
+008021b1 <opencons>:
+{
+  8021b1:	55                   	push   %ebp
+  8021b2:	89 e5                	mov    %esp,%ebp
+  8021b4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8021b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021ba:	50                   	push   %eax
+  8021bb:	e8 59 ef ff ff       	call   801119 <fd_alloc>
+  8021c0:	83 c4 10             	add    $0x10,%esp
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	78 3a                	js     802201 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8021c7:	83 ec 04             	sub    $0x4,%esp
+  8021ca:	68 07 04 00 00       	push   $0x407
+  8021cf:	ff 75 f4             	push   -0xc(%ebp)
+  8021d2:	6a 00                	push   $0x0
+  8021d4:	e8 18 ea ff ff       	call   800bf1 <sys_page_alloc>
+  8021d9:	83 c4 10             	add    $0x10,%esp
+  8021dc:	85 c0                	test   %eax,%eax
+  8021de:	78 21                	js     802201 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8021e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021e3:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8021e9:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8021eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ee:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8021f5:	83 ec 0c             	sub    $0xc,%esp
+  8021f8:	50                   	push   %eax
+  8021f9:	e8 f4 ee ff ff       	call   8010f2 <fd2num>
+  8021fe:	83 c4 10             	add    $0x10,%esp
+}
+  802201:	c9                   	leave
+  802202:	c3                   	ret
+
+00802203 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802203:	55                   	push   %ebp
+  802204:	89 e5                	mov    %esp,%ebp
+  802206:	56                   	push   %esi
+  802207:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802208:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80220b:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  802211:	e8 3c e9 ff ff       	call   800b52 <sys_getenvid>
+  802216:	83 ec 0c             	sub    $0xc,%esp
+  802219:	ff 75 0c             	push   0xc(%ebp)
+  80221c:	ff 75 08             	push   0x8(%ebp)
+  80221f:	56                   	push   %esi
+  802220:	50                   	push   %eax
+  802221:	68 94 2b 80 00       	push   $0x802b94
+  802226:	e8 6b df ff ff       	call   800196 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80222b:	83 c4 18             	add    $0x18,%esp
+  80222e:	53                   	push   %ebx
+  80222f:	ff 75 10             	push   0x10(%ebp)
+  802232:	e8 0e df ff ff       	call   800145 <vcprintf>
+	cprintf("\n");
+  802237:	c7 04 24 80 2b 80 00 	movl   $0x802b80,(%esp)
+  80223e:	e8 53 df ff ff       	call   800196 <cprintf>
+  802243:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802246:	cc                   	int3
+	while (1)
+  802247:	eb fd                	jmp    802246 <_panic+0x43>
+
+00802249 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802249:	55                   	push   %ebp
+  80224a:	89 e5                	mov    %esp,%ebp
+  80224c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80224f:	89 c2                	mov    %eax,%edx
+  802251:	c1 ea 16             	shr    $0x16,%edx
+  802254:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80225b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802260:	f6 c1 01             	test   $0x1,%cl
+  802263:	74 22                	je     802287 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802265:	c1 e8 0c             	shr    $0xc,%eax
+  802268:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80226f:	a8 01                	test   $0x1,%al
+  802271:	74 14                	je     802287 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802273:	c1 e8 0c             	shr    $0xc,%eax
+  802276:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802279:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802280:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802284:	0f b7 d2             	movzwl %dx,%edx
+}
+  802287:	89 d0                	mov    %edx,%eax
+  802289:	5d                   	pop    %ebp
+  80228a:	c3                   	ret
+  80228b:	66 90                	xchg   %ax,%ax
+  80228d:	66 90                	xchg   %ax,%ax
+  80228f:	90                   	nop
+
+00802290 <__udivmoddi4>:
+  802290:	55                   	push   %ebp
+  802291:	57                   	push   %edi
+  802292:	56                   	push   %esi
+  802293:	53                   	push   %ebx
+  802294:	83 ec 14             	sub    $0x14,%esp
+  802297:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80229b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80229f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022a3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022a7:	89 f1                	mov    %esi,%ecx
+  8022a9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022ad:	09 d9                	or     %ebx,%ecx
+  8022af:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022b3:	0f 84 92 00 00 00    	je     80234b <__udivmoddi4+0xbb>
+  8022b9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8022c0:	00 
+  8022c1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8022c6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8022cd:	00 
+  8022ce:	89 1c 24             	mov    %ebx,(%esp)
+  8022d1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8022d5:	8d 76 00             	lea    0x0(%esi),%esi
+  8022d8:	89 e9                	mov    %ebp,%ecx
+  8022da:	89 c3                	mov    %eax,%ebx
+  8022dc:	89 d6                	mov    %edx,%esi
+  8022de:	31 ff                	xor    %edi,%edi
+  8022e0:	d3 ee                	shr    %cl,%esi
+  8022e2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8022e5:	f6 c1 20             	test   $0x20,%cl
+  8022e8:	0f 45 de             	cmovne %esi,%ebx
+  8022eb:	0f 45 f7             	cmovne %edi,%esi
+  8022ee:	8b 3c 24             	mov    (%esp),%edi
+  8022f1:	39 fb                	cmp    %edi,%ebx
+  8022f3:	89 f7                	mov    %esi,%edi
+  8022f5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8022f9:	8b 1c 24             	mov    (%esp),%ebx
+  8022fc:	19 f7                	sbb    %esi,%edi
+  8022fe:	72 39                	jb     802339 <__udivmoddi4+0xa9>
+  802300:	89 e9                	mov    %ebp,%ecx
+  802302:	89 f7                	mov    %esi,%edi
+  802304:	89 de                	mov    %ebx,%esi
+  802306:	0f a5 df             	shld   %cl,%ebx,%edi
+  802309:	d3 e6                	shl    %cl,%esi
+  80230b:	31 db                	xor    %ebx,%ebx
+  80230d:	f6 c1 20             	test   $0x20,%cl
+  802310:	0f 45 fe             	cmovne %esi,%edi
+  802313:	0f 45 f3             	cmovne %ebx,%esi
+  802316:	29 f0                	sub    %esi,%eax
+  802318:	be 01 00 00 00       	mov    $0x1,%esi
+  80231d:	19 fa                	sbb    %edi,%edx
+  80231f:	31 ff                	xor    %edi,%edi
+  802321:	31 db                	xor    %ebx,%ebx
+  802323:	0f a5 f7             	shld   %cl,%esi,%edi
+  802326:	d3 e6                	shl    %cl,%esi
+  802328:	f6 c1 20             	test   $0x20,%cl
+  80232b:	0f 45 fe             	cmovne %esi,%edi
+  80232e:	0f 45 f3             	cmovne %ebx,%esi
+  802331:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802335:	09 74 24 08          	or     %esi,0x8(%esp)
+  802339:	83 ed 01             	sub    $0x1,%ebp
+  80233c:	73 9a                	jae    8022d8 <__udivmoddi4+0x48>
+  80233e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802342:	85 ff                	test   %edi,%edi
+  802344:	74 05                	je     80234b <__udivmoddi4+0xbb>
+  802346:	89 07                	mov    %eax,(%edi)
+  802348:	89 57 04             	mov    %edx,0x4(%edi)
+  80234b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80234f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802353:	83 c4 14             	add    $0x14,%esp
+  802356:	5b                   	pop    %ebx
+  802357:	5e                   	pop    %esi
+  802358:	5f                   	pop    %edi
+  802359:	5d                   	pop    %ebp
+  80235a:	c3                   	ret
+  80235b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80235f:	90                   	nop
+
+00802360 <__udivdi3>:
+  802360:	55                   	push   %ebp
+  802361:	57                   	push   %edi
+  802362:	56                   	push   %esi
+  802363:	53                   	push   %ebx
+  802364:	83 ec 14             	sub    $0x14,%esp
+  802367:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80236b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80236f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802373:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802377:	89 fb                	mov    %edi,%ebx
+  802379:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80237d:	09 f3                	or     %esi,%ebx
+  80237f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802383:	0f 84 85 00 00 00    	je     80240e <__udivdi3+0xae>
+  802389:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802390:	00 
+  802391:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802396:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80239d:	00 
+  80239e:	89 34 24             	mov    %esi,(%esp)
+  8023a1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023a5:	8d 76 00             	lea    0x0(%esi),%esi
+  8023a8:	89 e9                	mov    %ebp,%ecx
+  8023aa:	89 c3                	mov    %eax,%ebx
+  8023ac:	89 d6                	mov    %edx,%esi
+  8023ae:	31 ff                	xor    %edi,%edi
+  8023b0:	d3 ee                	shr    %cl,%esi
+  8023b2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8023b5:	f6 c1 20             	test   $0x20,%cl
+  8023b8:	0f 45 de             	cmovne %esi,%ebx
+  8023bb:	0f 45 f7             	cmovne %edi,%esi
+  8023be:	8b 3c 24             	mov    (%esp),%edi
+  8023c1:	39 fb                	cmp    %edi,%ebx
+  8023c3:	89 f7                	mov    %esi,%edi
+  8023c5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8023c9:	8b 1c 24             	mov    (%esp),%ebx
+  8023cc:	19 f7                	sbb    %esi,%edi
+  8023ce:	72 39                	jb     802409 <__udivdi3+0xa9>
+  8023d0:	89 e9                	mov    %ebp,%ecx
+  8023d2:	89 f7                	mov    %esi,%edi
+  8023d4:	89 de                	mov    %ebx,%esi
+  8023d6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8023d9:	d3 e6                	shl    %cl,%esi
+  8023db:	31 db                	xor    %ebx,%ebx
+  8023dd:	f6 c1 20             	test   $0x20,%cl
+  8023e0:	0f 45 fe             	cmovne %esi,%edi
+  8023e3:	0f 45 f3             	cmovne %ebx,%esi
+  8023e6:	29 f0                	sub    %esi,%eax
+  8023e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ed:	19 fa                	sbb    %edi,%edx
+  8023ef:	31 ff                	xor    %edi,%edi
+  8023f1:	31 db                	xor    %ebx,%ebx
+  8023f3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023f6:	d3 e6                	shl    %cl,%esi
+  8023f8:	f6 c1 20             	test   $0x20,%cl
+  8023fb:	0f 45 fe             	cmovne %esi,%edi
+  8023fe:	0f 45 f3             	cmovne %ebx,%esi
+  802401:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802405:	09 74 24 08          	or     %esi,0x8(%esp)
+  802409:	83 ed 01             	sub    $0x1,%ebp
+  80240c:	73 9a                	jae    8023a8 <__udivdi3+0x48>
+  80240e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802412:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802416:	83 c4 14             	add    $0x14,%esp
+  802419:	5b                   	pop    %ebx
+  80241a:	5e                   	pop    %esi
+  80241b:	5f                   	pop    %edi
+  80241c:	5d                   	pop    %ebp
+  80241d:	c3                   	ret
+  80241e:	66 90                	xchg   %ax,%ax
+
+00802420 <__umoddi3>:
+  802420:	57                   	push   %edi
+  802421:	56                   	push   %esi
+  802422:	53                   	push   %ebx
+  802423:	83 ec 08             	sub    $0x8,%esp
+  802426:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80242a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80242e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802432:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802436:	89 f9                	mov    %edi,%ecx
+  802438:	89 34 24             	mov    %esi,(%esp)
+  80243b:	09 f1                	or     %esi,%ecx
+  80243d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802441:	74 53                	je     802496 <__umoddi3+0x76>
+  802443:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80244f:	90                   	nop
+  802450:	89 c6                	mov    %eax,%esi
+  802452:	89 d7                	mov    %edx,%edi
+  802454:	31 db                	xor    %ebx,%ebx
+  802456:	d3 ef                	shr    %cl,%edi
+  802458:	0f ad d6             	shrd   %cl,%edx,%esi
+  80245b:	f6 c1 20             	test   $0x20,%cl
+  80245e:	0f 45 f7             	cmovne %edi,%esi
+  802461:	0f 45 fb             	cmovne %ebx,%edi
+  802464:	8b 1c 24             	mov    (%esp),%ebx
+  802467:	39 de                	cmp    %ebx,%esi
+  802469:	89 fb                	mov    %edi,%ebx
+  80246b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80246f:	8b 34 24             	mov    (%esp),%esi
+  802472:	19 fb                	sbb    %edi,%ebx
+  802474:	72 14                	jb     80248a <__umoddi3+0x6a>
+  802476:	0f a5 f7             	shld   %cl,%esi,%edi
+  802479:	31 db                	xor    %ebx,%ebx
+  80247b:	d3 e6                	shl    %cl,%esi
+  80247d:	f6 c1 20             	test   $0x20,%cl
+  802480:	0f 45 fe             	cmovne %esi,%edi
+  802483:	0f 45 f3             	cmovne %ebx,%esi
+  802486:	29 f0                	sub    %esi,%eax
+  802488:	19 fa                	sbb    %edi,%edx
+  80248a:	83 e9 01             	sub    $0x1,%ecx
+  80248d:	73 c1                	jae    802450 <__umoddi3+0x30>
+  80248f:	83 c4 08             	add    $0x8,%esp
+  802492:	5b                   	pop    %ebx
+  802493:	5e                   	pop    %esi
+  802494:	5f                   	pop    %edi
+  802495:	c3                   	ret
+  802496:	83 c4 08             	add    $0x8,%esp
+  802499:	31 c0                	xor    %eax,%eax
+  80249b:	31 d2                	xor    %edx,%edx
+  80249d:	5b                   	pop    %ebx
+  80249e:	5e                   	pop    %esi
+  80249f:	5f                   	pop    %edi
+  8024a0:	c3                   	ret
+  8024a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024af:	90                   	nop
+
+008024b0 <__divdi3>:
+  8024b0:	55                   	push   %ebp
+  8024b1:	57                   	push   %edi
+  8024b2:	56                   	push   %esi
+  8024b3:	53                   	push   %ebx
+  8024b4:	83 ec 1c             	sub    $0x1c,%esp
+  8024b7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8024bb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8024bf:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8024c3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8024c7:	85 ff                	test   %edi,%edi
+  8024c9:	0f 88 da 00 00 00    	js     8025a9 <__divdi3+0xf9>
+  8024cf:	85 db                	test   %ebx,%ebx
+  8024d1:	78 16                	js     8024e9 <__divdi3+0x39>
+  8024d3:	89 dd                	mov    %ebx,%ebp
+  8024d5:	89 c8                	mov    %ecx,%eax
+  8024d7:	89 da                	mov    %ebx,%edx
+  8024d9:	09 cd                	or     %ecx,%ebp
+  8024db:	0f 85 fd 00 00 00    	jne    8025de <__divdi3+0x12e>
+  8024e1:	83 c4 1c             	add    $0x1c,%esp
+  8024e4:	5b                   	pop    %ebx
+  8024e5:	5e                   	pop    %esi
+  8024e6:	5f                   	pop    %edi
+  8024e7:	5d                   	pop    %ebp
+  8024e8:	c3                   	ret
+  8024e9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8024ee:	f7 d9                	neg    %ecx
+  8024f0:	89 f0                	mov    %esi,%eax
+  8024f2:	89 fa                	mov    %edi,%edx
+  8024f4:	83 d3 00             	adc    $0x0,%ebx
+  8024f7:	89 0c 24             	mov    %ecx,(%esp)
+  8024fa:	f7 db                	neg    %ebx
+  8024fc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802500:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802507:	00 
+  802508:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80250d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802514:	00 
+  802515:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802519:	89 cd                	mov    %ecx,%ebp
+  80251b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80251f:	90                   	nop
+  802520:	89 e9                	mov    %ebp,%ecx
+  802522:	89 c3                	mov    %eax,%ebx
+  802524:	89 d6                	mov    %edx,%esi
+  802526:	31 ff                	xor    %edi,%edi
+  802528:	d3 ee                	shr    %cl,%esi
+  80252a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80252d:	f6 c1 20             	test   $0x20,%cl
+  802530:	0f 45 de             	cmovne %esi,%ebx
+  802533:	0f 45 f7             	cmovne %edi,%esi
+  802536:	8b 3c 24             	mov    (%esp),%edi
+  802539:	39 fb                	cmp    %edi,%ebx
+  80253b:	89 f7                	mov    %esi,%edi
+  80253d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802541:	8b 1c 24             	mov    (%esp),%ebx
+  802544:	19 f7                	sbb    %esi,%edi
+  802546:	72 39                	jb     802581 <__divdi3+0xd1>
+  802548:	89 e9                	mov    %ebp,%ecx
+  80254a:	89 f7                	mov    %esi,%edi
+  80254c:	89 de                	mov    %ebx,%esi
+  80254e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802551:	d3 e6                	shl    %cl,%esi
+  802553:	31 db                	xor    %ebx,%ebx
+  802555:	f6 c1 20             	test   $0x20,%cl
+  802558:	0f 45 fe             	cmovne %esi,%edi
+  80255b:	0f 45 f3             	cmovne %ebx,%esi
+  80255e:	29 f0                	sub    %esi,%eax
+  802560:	be 01 00 00 00       	mov    $0x1,%esi
+  802565:	19 fa                	sbb    %edi,%edx
+  802567:	31 ff                	xor    %edi,%edi
+  802569:	31 db                	xor    %ebx,%ebx
+  80256b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80256e:	d3 e6                	shl    %cl,%esi
+  802570:	f6 c1 20             	test   $0x20,%cl
+  802573:	0f 45 fe             	cmovne %esi,%edi
+  802576:	0f 45 f3             	cmovne %ebx,%esi
+  802579:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80257d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802581:	83 ed 01             	sub    $0x1,%ebp
+  802584:	73 9a                	jae    802520 <__divdi3+0x70>
+  802586:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80258a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80258e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802592:	85 ed                	test   %ebp,%ebp
+  802594:	0f 84 47 ff ff ff    	je     8024e1 <__divdi3+0x31>
+  80259a:	f7 d8                	neg    %eax
+  80259c:	83 d2 00             	adc    $0x0,%edx
+  80259f:	83 c4 1c             	add    $0x1c,%esp
+  8025a2:	5b                   	pop    %ebx
+  8025a3:	f7 da                	neg    %edx
+  8025a5:	5e                   	pop    %esi
+  8025a6:	5f                   	pop    %edi
+  8025a7:	5d                   	pop    %ebp
+  8025a8:	c3                   	ret
+  8025a9:	f7 de                	neg    %esi
+  8025ab:	83 d7 00             	adc    $0x0,%edi
+  8025ae:	f7 df                	neg    %edi
+  8025b0:	85 db                	test   %ebx,%ebx
+  8025b2:	78 23                	js     8025d7 <__divdi3+0x127>
+  8025b4:	89 dd                	mov    %ebx,%ebp
+  8025b6:	89 c8                	mov    %ecx,%eax
+  8025b8:	89 da                	mov    %ebx,%edx
+  8025ba:	09 cd                	or     %ecx,%ebp
+  8025bc:	0f 84 1f ff ff ff    	je     8024e1 <__divdi3+0x31>
+  8025c2:	89 0c 24             	mov    %ecx,(%esp)
+  8025c5:	89 f0                	mov    %esi,%eax
+  8025c7:	89 fa                	mov    %edi,%edx
+  8025c9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8025ce:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8025d2:	e9 29 ff ff ff       	jmp    802500 <__divdi3+0x50>
+  8025d7:	31 ed                	xor    %ebp,%ebp
+  8025d9:	e9 10 ff ff ff       	jmp    8024ee <__divdi3+0x3e>
+  8025de:	89 0c 24             	mov    %ecx,(%esp)
+  8025e1:	89 f0                	mov    %esi,%eax
+  8025e3:	89 fa                	mov    %edi,%edx
+  8025e5:	31 ed                	xor    %ebp,%ebp
+  8025e7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8025eb:	e9 10 ff ff ff       	jmp    802500 <__divdi3+0x50>
+
+008025f0 <__moddi3>:
+  8025f0:	55                   	push   %ebp
+  8025f1:	57                   	push   %edi
+  8025f2:	56                   	push   %esi
+  8025f3:	53                   	push   %ebx
+  8025f4:	83 ec 14             	sub    $0x14,%esp
+  8025f7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025fb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025ff:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802603:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802607:	85 d2                	test   %edx,%edx
+  802609:	0f 88 9b 00 00 00    	js     8026aa <__moddi3+0xba>
+  80260f:	89 f7                	mov    %esi,%edi
+  802611:	31 ed                	xor    %ebp,%ebp
+  802613:	09 cf                	or     %ecx,%edi
+  802615:	0f 84 83 00 00 00    	je     80269e <__moddi3+0xae>
+  80261b:	89 cb                	mov    %ecx,%ebx
+  80261d:	89 f7                	mov    %esi,%edi
+  80261f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802623:	f7 db                	neg    %ebx
+  802625:	83 d7 00             	adc    $0x0,%edi
+  802628:	f7 df                	neg    %edi
+  80262a:	0f 49 f7             	cmovns %edi,%esi
+  80262d:	0f 49 cb             	cmovns %ebx,%ecx
+  802630:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802634:	89 0c 24             	mov    %ecx,(%esp)
+  802637:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80263c:	89 cd                	mov    %ecx,%ebp
+  80263e:	66 90                	xchg   %ax,%ax
+  802640:	89 e9                	mov    %ebp,%ecx
+  802642:	89 c3                	mov    %eax,%ebx
+  802644:	89 d6                	mov    %edx,%esi
+  802646:	31 ff                	xor    %edi,%edi
+  802648:	d3 ee                	shr    %cl,%esi
+  80264a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80264d:	f6 c1 20             	test   $0x20,%cl
+  802650:	0f 45 de             	cmovne %esi,%ebx
+  802653:	0f 45 f7             	cmovne %edi,%esi
+  802656:	8b 3c 24             	mov    (%esp),%edi
+  802659:	39 fb                	cmp    %edi,%ebx
+  80265b:	89 f7                	mov    %esi,%edi
+  80265d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802661:	8b 1c 24             	mov    (%esp),%ebx
+  802664:	19 f7                	sbb    %esi,%edi
+  802666:	72 1a                	jb     802682 <__moddi3+0x92>
+  802668:	89 e9                	mov    %ebp,%ecx
+  80266a:	89 f7                	mov    %esi,%edi
+  80266c:	89 de                	mov    %ebx,%esi
+  80266e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802671:	d3 e6                	shl    %cl,%esi
+  802673:	31 db                	xor    %ebx,%ebx
+  802675:	f6 c1 20             	test   $0x20,%cl
+  802678:	0f 45 fe             	cmovne %esi,%edi
+  80267b:	0f 45 f3             	cmovne %ebx,%esi
+  80267e:	29 f0                	sub    %esi,%eax
+  802680:	19 fa                	sbb    %edi,%edx
+  802682:	83 ed 01             	sub    $0x1,%ebp
+  802685:	73 b9                	jae    802640 <__moddi3+0x50>
+  802687:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80268b:	85 ed                	test   %ebp,%ebp
+  80268d:	74 07                	je     802696 <__moddi3+0xa6>
+  80268f:	f7 d8                	neg    %eax
+  802691:	83 d2 00             	adc    $0x0,%edx
+  802694:	f7 da                	neg    %edx
+  802696:	83 c4 14             	add    $0x14,%esp
+  802699:	5b                   	pop    %ebx
+  80269a:	5e                   	pop    %esi
+  80269b:	5f                   	pop    %edi
+  80269c:	5d                   	pop    %ebp
+  80269d:	c3                   	ret
+  80269e:	83 c4 14             	add    $0x14,%esp
+  8026a1:	31 c0                	xor    %eax,%eax
+  8026a3:	31 d2                	xor    %edx,%edx
+  8026a5:	5b                   	pop    %ebx
+  8026a6:	5e                   	pop    %esi
+  8026a7:	5f                   	pop    %edi
+  8026a8:	5d                   	pop    %ebp
+  8026a9:	c3                   	ret
+  8026aa:	89 f7                	mov    %esi,%edi
+  8026ac:	09 cf                	or     %ecx,%edi
+  8026ae:	74 11                	je     8026c1 <__moddi3+0xd1>
+  8026b0:	f7 d8                	neg    %eax
+  8026b2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8026b7:	83 d2 00             	adc    $0x0,%edx
+  8026ba:	f7 da                	neg    %edx
+  8026bc:	e9 5a ff ff ff       	jmp    80261b <__moddi3+0x2b>
+  8026c1:	31 c0                	xor    %eax,%eax
+  8026c3:	31 d2                	xor    %edx,%edx
+  8026c5:	eb c8                	jmp    80268f <__moddi3+0x9f>
@@ -0,0 +1,5737 @@
+
+obj/user/faultalloc.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 00 00 00       	call   8000ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 a0 27 80 00       	push   $0x8027a0
+  800045:	e8 bb 01 00 00       	call   800205 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 02 0c 00 00       	call   800c60 <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 ec 27 80 00       	push   $0x8027ec
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 2b 07 00 00       	call   80079e <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 c0 27 80 00       	push   $0x8027c0
+  800085:	6a 0e                	push   $0xe
+  800087:	68 aa 27 80 00       	push   $0x8027aa
+  80008c:	e8 99 00 00 00       	call   80012a <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 e4 0f 00 00       	call   801085 <set_pgfault_handler>
+	cprintf("%s\n", (char*)0xDeadBeef);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	68 ef be ad de       	push   $0xdeadbeef
+  8000a9:	68 bc 27 80 00       	push   $0x8027bc
+  8000ae:	e8 52 01 00 00       	call   800205 <cprintf>
+	cprintf("%s\n", (char*)0xCafeBffe);
+  8000b3:	83 c4 08             	add    $0x8,%esp
+  8000b6:	68 fe bf fe ca       	push   $0xcafebffe
+  8000bb:	68 bc 27 80 00       	push   $0x8027bc
+  8000c0:	e8 40 01 00 00       	call   800205 <cprintf>
+}
+  8000c5:	83 c4 10             	add    $0x10,%esp
+  8000c8:	c9                   	leave
+  8000c9:	c3                   	ret
+
+008000ca <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000ca:	55                   	push   %ebp
+  8000cb:	89 e5                	mov    %esp,%ebp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000d5:	e8 e7 0a 00 00       	call   800bc1 <sys_getenvid>
+  8000da:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000df:	c1 e0 09             	shl    $0x9,%eax
+  8000e2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000e7:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000ec:	85 db                	test   %ebx,%ebx
+  8000ee:	7e 07                	jle    8000f7 <libmain+0x2d>
+		binaryname = argv[0];
+  8000f0:	8b 06                	mov    (%esi),%eax
+  8000f2:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000f7:	83 ec 08             	sub    $0x8,%esp
+  8000fa:	56                   	push   %esi
+  8000fb:	53                   	push   %ebx
+  8000fc:	e8 90 ff ff ff       	call   800091 <umain>
+
+	// exit gracefully
+	exit();
+  800101:	e8 0a 00 00 00       	call   800110 <exit>
+}
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5d                   	pop    %ebp
+  80010f:	c3                   	ret
+
+00800110 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800110:	55                   	push   %ebp
+  800111:	89 e5                	mov    %esp,%ebp
+  800113:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800116:	e8 cf 11 00 00       	call   8012ea <close_all>
+	sys_env_destroy(0);
+  80011b:	83 ec 0c             	sub    $0xc,%esp
+  80011e:	6a 00                	push   $0x0
+  800120:	e8 5b 0a 00 00       	call   800b80 <sys_env_destroy>
+}
+  800125:	83 c4 10             	add    $0x10,%esp
+  800128:	c9                   	leave
+  800129:	c3                   	ret
+
+0080012a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80012a:	55                   	push   %ebp
+  80012b:	89 e5                	mov    %esp,%ebp
+  80012d:	56                   	push   %esi
+  80012e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80012f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800132:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  800138:	e8 84 0a 00 00       	call   800bc1 <sys_getenvid>
+  80013d:	83 ec 0c             	sub    $0xc,%esp
+  800140:	ff 75 0c             	push   0xc(%ebp)
+  800143:	ff 75 08             	push   0x8(%ebp)
+  800146:	56                   	push   %esi
+  800147:	50                   	push   %eax
+  800148:	68 18 28 80 00       	push   $0x802818
+  80014d:	e8 b3 00 00 00       	call   800205 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800152:	83 c4 18             	add    $0x18,%esp
+  800155:	53                   	push   %ebx
+  800156:	ff 75 10             	push   0x10(%ebp)
+  800159:	e8 56 00 00 00       	call   8001b4 <vcprintf>
+	cprintf("\n");
+  80015e:	c7 04 24 c0 2c 80 00 	movl   $0x802cc0,(%esp)
+  800165:	e8 9b 00 00 00       	call   800205 <cprintf>
+  80016a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80016d:	cc                   	int3
+	while (1)
+  80016e:	eb fd                	jmp    80016d <_panic+0x43>
+
+00800170 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800170:	55                   	push   %ebp
+  800171:	89 e5                	mov    %esp,%ebp
+  800173:	53                   	push   %ebx
+  800174:	83 ec 04             	sub    $0x4,%esp
+  800177:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80017a:	8b 13                	mov    (%ebx),%edx
+  80017c:	8d 42 01             	lea    0x1(%edx),%eax
+  80017f:	89 03                	mov    %eax,(%ebx)
+  800181:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800184:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800188:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80018d:	74 09                	je     800198 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80018f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800193:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800196:	c9                   	leave
+  800197:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800198:	83 ec 08             	sub    $0x8,%esp
+  80019b:	68 ff 00 00 00       	push   $0xff
+  8001a0:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a3:	50                   	push   %eax
+  8001a4:	e8 7a 09 00 00       	call   800b23 <sys_cputs>
+		b->idx = 0;
+  8001a9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	eb db                	jmp    80018f <putch+0x1f>
+
+008001b4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001b4:	55                   	push   %ebp
+  8001b5:	89 e5                	mov    %esp,%ebp
+  8001b7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001bd:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c4:	00 00 00 
+	b.cnt = 0;
+  8001c7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001ce:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001d1:	ff 75 0c             	push   0xc(%ebp)
+  8001d4:	ff 75 08             	push   0x8(%ebp)
+  8001d7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001dd:	50                   	push   %eax
+  8001de:	68 70 01 80 00       	push   $0x800170
+  8001e3:	e8 14 01 00 00       	call   8002fc <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001e8:	83 c4 08             	add    $0x8,%esp
+  8001eb:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001f7:	50                   	push   %eax
+  8001f8:	e8 26 09 00 00       	call   800b23 <sys_cputs>
+
+	return b.cnt;
+}
+  8001fd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800203:	c9                   	leave
+  800204:	c3                   	ret
+
+00800205 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800205:	55                   	push   %ebp
+  800206:	89 e5                	mov    %esp,%ebp
+  800208:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80020b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80020e:	50                   	push   %eax
+  80020f:	ff 75 08             	push   0x8(%ebp)
+  800212:	e8 9d ff ff ff       	call   8001b4 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800217:	c9                   	leave
+  800218:	c3                   	ret
+
+00800219 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800219:	55                   	push   %ebp
+  80021a:	89 e5                	mov    %esp,%ebp
+  80021c:	57                   	push   %edi
+  80021d:	56                   	push   %esi
+  80021e:	53                   	push   %ebx
+  80021f:	83 ec 1c             	sub    $0x1c,%esp
+  800222:	89 c7                	mov    %eax,%edi
+  800224:	89 d6                	mov    %edx,%esi
+  800226:	8b 45 08             	mov    0x8(%ebp),%eax
+  800229:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80022c:	89 d1                	mov    %edx,%ecx
+  80022e:	89 c2                	mov    %eax,%edx
+  800230:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800233:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800236:	8b 45 10             	mov    0x10(%ebp),%eax
+  800239:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80023c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80023f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800246:	39 c2                	cmp    %eax,%edx
+  800248:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80024b:	72 3e                	jb     80028b <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	ff 75 18             	push   0x18(%ebp)
+  800253:	83 eb 01             	sub    $0x1,%ebx
+  800256:	53                   	push   %ebx
+  800257:	50                   	push   %eax
+  800258:	83 ec 08             	sub    $0x8,%esp
+  80025b:	ff 75 e4             	push   -0x1c(%ebp)
+  80025e:	ff 75 e0             	push   -0x20(%ebp)
+  800261:	ff 75 dc             	push   -0x24(%ebp)
+  800264:	ff 75 d8             	push   -0x28(%ebp)
+  800267:	e8 b4 21 00 00       	call   802420 <__udivdi3>
+  80026c:	83 c4 18             	add    $0x18,%esp
+  80026f:	52                   	push   %edx
+  800270:	50                   	push   %eax
+  800271:	89 f2                	mov    %esi,%edx
+  800273:	89 f8                	mov    %edi,%eax
+  800275:	e8 9f ff ff ff       	call   800219 <printnum>
+  80027a:	83 c4 20             	add    $0x20,%esp
+  80027d:	eb 13                	jmp    800292 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80027f:	83 ec 08             	sub    $0x8,%esp
+  800282:	56                   	push   %esi
+  800283:	ff 75 18             	push   0x18(%ebp)
+  800286:	ff d7                	call   *%edi
+  800288:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80028b:	83 eb 01             	sub    $0x1,%ebx
+  80028e:	85 db                	test   %ebx,%ebx
+  800290:	7f ed                	jg     80027f <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800292:	83 ec 08             	sub    $0x8,%esp
+  800295:	56                   	push   %esi
+  800296:	83 ec 04             	sub    $0x4,%esp
+  800299:	ff 75 e4             	push   -0x1c(%ebp)
+  80029c:	ff 75 e0             	push   -0x20(%ebp)
+  80029f:	ff 75 dc             	push   -0x24(%ebp)
+  8002a2:	ff 75 d8             	push   -0x28(%ebp)
+  8002a5:	e8 36 22 00 00       	call   8024e0 <__umoddi3>
+  8002aa:	83 c4 14             	add    $0x14,%esp
+  8002ad:	0f be 80 3b 28 80 00 	movsbl 0x80283b(%eax),%eax
+  8002b4:	50                   	push   %eax
+  8002b5:	ff d7                	call   *%edi
+}
+  8002b7:	83 c4 10             	add    $0x10,%esp
+  8002ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002bd:	5b                   	pop    %ebx
+  8002be:	5e                   	pop    %esi
+  8002bf:	5f                   	pop    %edi
+  8002c0:	5d                   	pop    %ebp
+  8002c1:	c3                   	ret
+
+008002c2 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c2:	55                   	push   %ebp
+  8002c3:	89 e5                	mov    %esp,%ebp
+  8002c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002c8:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002cc:	8b 10                	mov    (%eax),%edx
+  8002ce:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d1:	73 0a                	jae    8002dd <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d3:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002d6:	89 08                	mov    %ecx,(%eax)
+  8002d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002db:	88 02                	mov    %al,(%edx)
+}
+  8002dd:	5d                   	pop    %ebp
+  8002de:	c3                   	ret
+
+008002df <printfmt>:
+{
+  8002df:	55                   	push   %ebp
+  8002e0:	89 e5                	mov    %esp,%ebp
+  8002e2:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e5:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002e8:	50                   	push   %eax
+  8002e9:	ff 75 10             	push   0x10(%ebp)
+  8002ec:	ff 75 0c             	push   0xc(%ebp)
+  8002ef:	ff 75 08             	push   0x8(%ebp)
+  8002f2:	e8 05 00 00 00       	call   8002fc <vprintfmt>
+}
+  8002f7:	83 c4 10             	add    $0x10,%esp
+  8002fa:	c9                   	leave
+  8002fb:	c3                   	ret
+
+008002fc <vprintfmt>:
+{
+  8002fc:	55                   	push   %ebp
+  8002fd:	89 e5                	mov    %esp,%ebp
+  8002ff:	57                   	push   %edi
+  800300:	56                   	push   %esi
+  800301:	53                   	push   %ebx
+  800302:	83 ec 2c             	sub    $0x2c,%esp
+  800305:	8b 75 08             	mov    0x8(%ebp),%esi
+  800308:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80030b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80030e:	eb 0a                	jmp    80031a <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800310:	83 ec 08             	sub    $0x8,%esp
+  800313:	53                   	push   %ebx
+  800314:	50                   	push   %eax
+  800315:	ff d6                	call   *%esi
+  800317:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80031a:	83 c7 01             	add    $0x1,%edi
+  80031d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800321:	83 f8 25             	cmp    $0x25,%eax
+  800324:	74 0c                	je     800332 <vprintfmt+0x36>
+			if (ch == '\0')
+  800326:	85 c0                	test   %eax,%eax
+  800328:	75 e6                	jne    800310 <vprintfmt+0x14>
+}
+  80032a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032d:	5b                   	pop    %ebx
+  80032e:	5e                   	pop    %esi
+  80032f:	5f                   	pop    %edi
+  800330:	5d                   	pop    %ebp
+  800331:	c3                   	ret
+		padc = ' ';
+  800332:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800336:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80033d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800344:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80034b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800350:	8d 47 01             	lea    0x1(%edi),%eax
+  800353:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800356:	0f b6 17             	movzbl (%edi),%edx
+  800359:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80035c:	3c 55                	cmp    $0x55,%al
+  80035e:	0f 87 cf 03 00 00    	ja     800733 <vprintfmt+0x437>
+  800364:	0f b6 c0             	movzbl %al,%eax
+  800367:	ff 24 85 80 29 80 00 	jmp    *0x802980(,%eax,4)
+  80036e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800371:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800375:	eb d9                	jmp    800350 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800377:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80037a:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80037e:	eb d0                	jmp    800350 <vprintfmt+0x54>
+  800380:	0f b6 d2             	movzbl %dl,%edx
+  800383:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80038e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800391:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800395:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800398:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80039b:	83 f9 09             	cmp    $0x9,%ecx
+  80039e:	77 55                	ja     8003f5 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003a0:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003a3:	eb e9                	jmp    80038e <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a8:	8b 00                	mov    (%eax),%eax
+  8003aa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8003b3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003b9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003bd:	79 91                	jns    800350 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003bf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003c5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003cc:	eb 82                	jmp    800350 <vprintfmt+0x54>
+			if (width < 0)
+  8003ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003d1:	85 d2                	test   %edx,%edx
+  8003d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d8:	0f 49 c2             	cmovns %edx,%eax
+  8003db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003e1:	e9 6a ff ff ff       	jmp    800350 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003e9:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003f0:	e9 5b ff ff ff       	jmp    800350 <vprintfmt+0x54>
+  8003f5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003fb:	eb bc                	jmp    8003b9 <vprintfmt+0xbd>
+			lflag++;
+  8003fd:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800400:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800403:	e9 48 ff ff ff       	jmp    800350 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800408:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040b:	8d 78 04             	lea    0x4(%eax),%edi
+  80040e:	83 ec 08             	sub    $0x8,%esp
+  800411:	53                   	push   %ebx
+  800412:	ff 30                	push   (%eax)
+  800414:	ff d6                	call   *%esi
+			break;
+  800416:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800419:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80041c:	e9 b1 02 00 00       	jmp    8006d2 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800421:	8b 45 14             	mov    0x14(%ebp),%eax
+  800424:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800427:	8b 10                	mov    (%eax),%edx
+  800429:	89 d0                	mov    %edx,%eax
+  80042b:	f7 d8                	neg    %eax
+  80042d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800430:	83 f8 0f             	cmp    $0xf,%eax
+  800433:	7f 23                	jg     800458 <vprintfmt+0x15c>
+  800435:	8b 14 85 e0 2a 80 00 	mov    0x802ae0(,%eax,4),%edx
+  80043c:	85 d2                	test   %edx,%edx
+  80043e:	74 18                	je     800458 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800440:	52                   	push   %edx
+  800441:	68 55 2c 80 00       	push   $0x802c55
+  800446:	53                   	push   %ebx
+  800447:	56                   	push   %esi
+  800448:	e8 92 fe ff ff       	call   8002df <printfmt>
+  80044d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800450:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800453:	e9 7a 02 00 00       	jmp    8006d2 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800458:	50                   	push   %eax
+  800459:	68 53 28 80 00       	push   $0x802853
+  80045e:	53                   	push   %ebx
+  80045f:	56                   	push   %esi
+  800460:	e8 7a fe ff ff       	call   8002df <printfmt>
+  800465:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800468:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80046b:	e9 62 02 00 00       	jmp    8006d2 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800470:	8b 45 14             	mov    0x14(%ebp),%eax
+  800473:	83 c0 04             	add    $0x4,%eax
+  800476:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800479:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80047e:	85 c9                	test   %ecx,%ecx
+  800480:	b8 4c 28 80 00       	mov    $0x80284c,%eax
+  800485:	0f 45 c1             	cmovne %ecx,%eax
+  800488:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80048b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80048f:	7e 06                	jle    800497 <vprintfmt+0x19b>
+  800491:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800495:	75 0b                	jne    8004a2 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800497:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80049a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80049d:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a0:	eb 5c                	jmp    8004fe <vprintfmt+0x202>
+  8004a2:	83 ec 08             	sub    $0x8,%esp
+  8004a5:	ff 75 d0             	push   -0x30(%ebp)
+  8004a8:	ff 75 cc             	push   -0x34(%ebp)
+  8004ab:	e8 20 03 00 00       	call   8007d0 <strnlen>
+  8004b0:	89 c2                	mov    %eax,%edx
+  8004b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b5:	29 d0                	sub    %edx,%eax
+  8004b7:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004ba:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c4:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c6:	eb 0e                	jmp    8004d6 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004c8:	83 ec 08             	sub    $0x8,%esp
+  8004cb:	53                   	push   %ebx
+  8004cc:	57                   	push   %edi
+  8004cd:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d0:	83 ee 01             	sub    $0x1,%esi
+  8004d3:	83 c4 10             	add    $0x10,%esp
+  8004d6:	85 f6                	test   %esi,%esi
+  8004d8:	7f ee                	jg     8004c8 <vprintfmt+0x1cc>
+  8004da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e0:	85 c0                	test   %eax,%eax
+  8004e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e7:	0f 49 d0             	cmovns %eax,%edx
+  8004ea:	29 d0                	sub    %edx,%eax
+  8004ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ef:	eb a6                	jmp    800497 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004f1:	83 ec 08             	sub    $0x8,%esp
+  8004f4:	53                   	push   %ebx
+  8004f5:	52                   	push   %edx
+  8004f6:	ff 55 08             	call   *0x8(%ebp)
+  8004f9:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004fc:	89 f1                	mov    %esi,%ecx
+  8004fe:	8d 71 01             	lea    0x1(%ecx),%esi
+  800501:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800505:	0f be d0             	movsbl %al,%edx
+  800508:	85 d2                	test   %edx,%edx
+  80050a:	74 28                	je     800534 <vprintfmt+0x238>
+  80050c:	85 ff                	test   %edi,%edi
+  80050e:	78 05                	js     800515 <vprintfmt+0x219>
+  800510:	83 ef 01             	sub    $0x1,%edi
+  800513:	78 30                	js     800545 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800515:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800519:	74 d6                	je     8004f1 <vprintfmt+0x1f5>
+  80051b:	0f be c0             	movsbl %al,%eax
+  80051e:	83 e8 20             	sub    $0x20,%eax
+  800521:	83 f8 5e             	cmp    $0x5e,%eax
+  800524:	76 cb                	jbe    8004f1 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800526:	83 ec 08             	sub    $0x8,%esp
+  800529:	53                   	push   %ebx
+  80052a:	6a 3f                	push   $0x3f
+  80052c:	ff 55 08             	call   *0x8(%ebp)
+  80052f:	83 c4 10             	add    $0x10,%esp
+  800532:	eb c8                	jmp    8004fc <vprintfmt+0x200>
+  800534:	8b 75 08             	mov    0x8(%ebp),%esi
+  800537:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80053a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80053d:	01 d0                	add    %edx,%eax
+  80053f:	29 c8                	sub    %ecx,%eax
+  800541:	89 c7                	mov    %eax,%edi
+  800543:	eb 13                	jmp    800558 <vprintfmt+0x25c>
+  800545:	8b 75 08             	mov    0x8(%ebp),%esi
+  800548:	eb ed                	jmp    800537 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80054a:	83 ec 08             	sub    $0x8,%esp
+  80054d:	53                   	push   %ebx
+  80054e:	6a 20                	push   $0x20
+  800550:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800552:	83 ef 01             	sub    $0x1,%edi
+  800555:	83 c4 10             	add    $0x10,%esp
+  800558:	85 ff                	test   %edi,%edi
+  80055a:	7f ee                	jg     80054a <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80055c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80055f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800562:	e9 6b 01 00 00       	jmp    8006d2 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800567:	83 f9 01             	cmp    $0x1,%ecx
+  80056a:	7f 1f                	jg     80058b <vprintfmt+0x28f>
+	else if (lflag)
+  80056c:	85 c9                	test   %ecx,%ecx
+  80056e:	74 67                	je     8005d7 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800570:	8b 45 14             	mov    0x14(%ebp),%eax
+  800573:	8b 00                	mov    (%eax),%eax
+  800575:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800578:	89 c1                	mov    %eax,%ecx
+  80057a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80057d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8d 40 04             	lea    0x4(%eax),%eax
+  800586:	89 45 14             	mov    %eax,0x14(%ebp)
+  800589:	eb 17                	jmp    8005a2 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	8b 50 04             	mov    0x4(%eax),%edx
+  800591:	8b 00                	mov    (%eax),%eax
+  800593:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800596:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059c:	8d 40 08             	lea    0x8(%eax),%eax
+  80059f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005a2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005a5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005a8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005ad:	85 c9                	test   %ecx,%ecx
+  8005af:	0f 89 03 01 00 00    	jns    8006b8 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005b5:	83 ec 08             	sub    $0x8,%esp
+  8005b8:	53                   	push   %ebx
+  8005b9:	6a 2d                	push   $0x2d
+  8005bb:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005bd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c3:	f7 da                	neg    %edx
+  8005c5:	83 d1 00             	adc    $0x0,%ecx
+  8005c8:	f7 d9                	neg    %ecx
+  8005ca:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005cd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d2:	e9 e1 00 00 00       	jmp    8006b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005da:	8b 00                	mov    (%eax),%eax
+  8005dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005df:	89 c1                	mov    %eax,%ecx
+  8005e1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f0:	eb b0                	jmp    8005a2 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005f2:	83 f9 01             	cmp    $0x1,%ecx
+  8005f5:	7f 1e                	jg     800615 <vprintfmt+0x319>
+	else if (lflag)
+  8005f7:	85 c9                	test   %ecx,%ecx
+  8005f9:	74 32                	je     80062d <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8b 10                	mov    (%eax),%edx
+  800600:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800605:	8d 40 04             	lea    0x4(%eax),%eax
+  800608:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800610:	e9 a3 00 00 00       	jmp    8006b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8b 10                	mov    (%eax),%edx
+  80061a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80061d:	8d 40 08             	lea    0x8(%eax),%eax
+  800620:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800623:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800628:	e9 8b 00 00 00       	jmp    8006b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8b 10                	mov    (%eax),%edx
+  800632:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800637:	8d 40 04             	lea    0x4(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80063d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800642:	eb 74                	jmp    8006b8 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800644:	83 f9 01             	cmp    $0x1,%ecx
+  800647:	7f 1b                	jg     800664 <vprintfmt+0x368>
+	else if (lflag)
+  800649:	85 c9                	test   %ecx,%ecx
+  80064b:	74 2c                	je     800679 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8b 10                	mov    (%eax),%edx
+  800652:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800657:	8d 40 04             	lea    0x4(%eax),%eax
+  80065a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80065d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800662:	eb 54                	jmp    8006b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8b 10                	mov    (%eax),%edx
+  800669:	8b 48 04             	mov    0x4(%eax),%ecx
+  80066c:	8d 40 08             	lea    0x8(%eax),%eax
+  80066f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800672:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800677:	eb 3f                	jmp    8006b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800679:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067c:	8b 10                	mov    (%eax),%edx
+  80067e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800683:	8d 40 04             	lea    0x4(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800689:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80068e:	eb 28                	jmp    8006b8 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800690:	83 ec 08             	sub    $0x8,%esp
+  800693:	53                   	push   %ebx
+  800694:	6a 30                	push   $0x30
+  800696:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800698:	83 c4 08             	add    $0x8,%esp
+  80069b:	53                   	push   %ebx
+  80069c:	6a 78                	push   $0x78
+  80069e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a3:	8b 10                	mov    (%eax),%edx
+  8006a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006aa:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b3:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006b8:	83 ec 0c             	sub    $0xc,%esp
+  8006bb:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006bf:	50                   	push   %eax
+  8006c0:	ff 75 e0             	push   -0x20(%ebp)
+  8006c3:	57                   	push   %edi
+  8006c4:	51                   	push   %ecx
+  8006c5:	52                   	push   %edx
+  8006c6:	89 da                	mov    %ebx,%edx
+  8006c8:	89 f0                	mov    %esi,%eax
+  8006ca:	e8 4a fb ff ff       	call   800219 <printnum>
+			break;
+  8006cf:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006d5:	e9 40 fc ff ff       	jmp    80031a <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006da:	83 f9 01             	cmp    $0x1,%ecx
+  8006dd:	7f 1b                	jg     8006fa <vprintfmt+0x3fe>
+	else if (lflag)
+  8006df:	85 c9                	test   %ecx,%ecx
+  8006e1:	74 2c                	je     80070f <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8b 10                	mov    (%eax),%edx
+  8006e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006f8:	eb be                	jmp    8006b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fd:	8b 10                	mov    (%eax),%edx
+  8006ff:	8b 48 04             	mov    0x4(%eax),%ecx
+  800702:	8d 40 08             	lea    0x8(%eax),%eax
+  800705:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800708:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80070d:	eb a9                	jmp    8006b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8b 10                	mov    (%eax),%edx
+  800714:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800719:	8d 40 04             	lea    0x4(%eax),%eax
+  80071c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800724:	eb 92                	jmp    8006b8 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800726:	83 ec 08             	sub    $0x8,%esp
+  800729:	53                   	push   %ebx
+  80072a:	6a 25                	push   $0x25
+  80072c:	ff d6                	call   *%esi
+			break;
+  80072e:	83 c4 10             	add    $0x10,%esp
+  800731:	eb 9f                	jmp    8006d2 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800733:	83 ec 08             	sub    $0x8,%esp
+  800736:	53                   	push   %ebx
+  800737:	6a 25                	push   $0x25
+  800739:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80073b:	83 c4 10             	add    $0x10,%esp
+  80073e:	89 f8                	mov    %edi,%eax
+  800740:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800744:	74 05                	je     80074b <vprintfmt+0x44f>
+  800746:	83 e8 01             	sub    $0x1,%eax
+  800749:	eb f5                	jmp    800740 <vprintfmt+0x444>
+  80074b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80074e:	eb 82                	jmp    8006d2 <vprintfmt+0x3d6>
+
+00800750 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800750:	55                   	push   %ebp
+  800751:	89 e5                	mov    %esp,%ebp
+  800753:	83 ec 18             	sub    $0x18,%esp
+  800756:	8b 45 08             	mov    0x8(%ebp),%eax
+  800759:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80075c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80075f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800763:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800766:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80076d:	85 c0                	test   %eax,%eax
+  80076f:	74 26                	je     800797 <vsnprintf+0x47>
+  800771:	85 d2                	test   %edx,%edx
+  800773:	7e 22                	jle    800797 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800775:	ff 75 14             	push   0x14(%ebp)
+  800778:	ff 75 10             	push   0x10(%ebp)
+  80077b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80077e:	50                   	push   %eax
+  80077f:	68 c2 02 80 00       	push   $0x8002c2
+  800784:	e8 73 fb ff ff       	call   8002fc <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800789:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80078c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80078f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800792:	83 c4 10             	add    $0x10,%esp
+}
+  800795:	c9                   	leave
+  800796:	c3                   	ret
+		return -E_INVAL;
+  800797:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80079c:	eb f7                	jmp    800795 <vsnprintf+0x45>
+
+0080079e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80079e:	55                   	push   %ebp
+  80079f:	89 e5                	mov    %esp,%ebp
+  8007a1:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007a4:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007a7:	50                   	push   %eax
+  8007a8:	ff 75 10             	push   0x10(%ebp)
+  8007ab:	ff 75 0c             	push   0xc(%ebp)
+  8007ae:	ff 75 08             	push   0x8(%ebp)
+  8007b1:	e8 9a ff ff ff       	call   800750 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007b6:	c9                   	leave
+  8007b7:	c3                   	ret
+
+008007b8 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007b8:	55                   	push   %ebp
+  8007b9:	89 e5                	mov    %esp,%ebp
+  8007bb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c3:	eb 03                	jmp    8007c8 <strlen+0x10>
+		n++;
+  8007c5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007c8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007cc:	75 f7                	jne    8007c5 <strlen+0xd>
+	return n;
+}
+  8007ce:	5d                   	pop    %ebp
+  8007cf:	c3                   	ret
+
+008007d0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007d0:	55                   	push   %ebp
+  8007d1:	89 e5                	mov    %esp,%ebp
+  8007d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007de:	eb 03                	jmp    8007e3 <strnlen+0x13>
+		n++;
+  8007e0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e3:	39 d0                	cmp    %edx,%eax
+  8007e5:	74 08                	je     8007ef <strnlen+0x1f>
+  8007e7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007eb:	75 f3                	jne    8007e0 <strnlen+0x10>
+  8007ed:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007ef:	89 d0                	mov    %edx,%eax
+  8007f1:	5d                   	pop    %ebp
+  8007f2:	c3                   	ret
+
+008007f3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007f3:	55                   	push   %ebp
+  8007f4:	89 e5                	mov    %esp,%ebp
+  8007f6:	53                   	push   %ebx
+  8007f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800802:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800806:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800809:	83 c0 01             	add    $0x1,%eax
+  80080c:	84 d2                	test   %dl,%dl
+  80080e:	75 f2                	jne    800802 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800810:	89 c8                	mov    %ecx,%eax
+  800812:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800815:	c9                   	leave
+  800816:	c3                   	ret
+
+00800817 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800817:	55                   	push   %ebp
+  800818:	89 e5                	mov    %esp,%ebp
+  80081a:	53                   	push   %ebx
+  80081b:	83 ec 10             	sub    $0x10,%esp
+  80081e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800821:	53                   	push   %ebx
+  800822:	e8 91 ff ff ff       	call   8007b8 <strlen>
+  800827:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80082a:	ff 75 0c             	push   0xc(%ebp)
+  80082d:	01 d8                	add    %ebx,%eax
+  80082f:	50                   	push   %eax
+  800830:	e8 be ff ff ff       	call   8007f3 <strcpy>
+	return dst;
+}
+  800835:	89 d8                	mov    %ebx,%eax
+  800837:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083a:	c9                   	leave
+  80083b:	c3                   	ret
+
+0080083c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80083c:	55                   	push   %ebp
+  80083d:	89 e5                	mov    %esp,%ebp
+  80083f:	56                   	push   %esi
+  800840:	53                   	push   %ebx
+  800841:	8b 75 08             	mov    0x8(%ebp),%esi
+  800844:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800847:	89 f3                	mov    %esi,%ebx
+  800849:	03 5d 10             	add    0x10(%ebp),%ebx
+  80084c:	89 f0                	mov    %esi,%eax
+  80084e:	eb 0f                	jmp    80085f <strncpy+0x23>
+		*dst++ = *src;
+  800850:	83 c0 01             	add    $0x1,%eax
+  800853:	0f b6 0a             	movzbl (%edx),%ecx
+  800856:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800859:	80 f9 01             	cmp    $0x1,%cl
+  80085c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80085f:	39 d8                	cmp    %ebx,%eax
+  800861:	75 ed                	jne    800850 <strncpy+0x14>
+	}
+	return ret;
+}
+  800863:	89 f0                	mov    %esi,%eax
+  800865:	5b                   	pop    %ebx
+  800866:	5e                   	pop    %esi
+  800867:	5d                   	pop    %ebp
+  800868:	c3                   	ret
+
+00800869 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800869:	55                   	push   %ebp
+  80086a:	89 e5                	mov    %esp,%ebp
+  80086c:	56                   	push   %esi
+  80086d:	53                   	push   %ebx
+  80086e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800871:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800874:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800877:	89 f0                	mov    %esi,%eax
+  800879:	85 d2                	test   %edx,%edx
+  80087b:	74 21                	je     80089e <strlcpy+0x35>
+  80087d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800881:	89 f2                	mov    %esi,%edx
+  800883:	eb 09                	jmp    80088e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800885:	83 c1 01             	add    $0x1,%ecx
+  800888:	83 c2 01             	add    $0x1,%edx
+  80088b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80088e:	39 c2                	cmp    %eax,%edx
+  800890:	74 09                	je     80089b <strlcpy+0x32>
+  800892:	0f b6 19             	movzbl (%ecx),%ebx
+  800895:	84 db                	test   %bl,%bl
+  800897:	75 ec                	jne    800885 <strlcpy+0x1c>
+  800899:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80089b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80089e:	29 f0                	sub    %esi,%eax
+}
+  8008a0:	5b                   	pop    %ebx
+  8008a1:	5e                   	pop    %esi
+  8008a2:	5d                   	pop    %ebp
+  8008a3:	c3                   	ret
+
+008008a4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008a4:	55                   	push   %ebp
+  8008a5:	89 e5                	mov    %esp,%ebp
+  8008a7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008ad:	eb 06                	jmp    8008b5 <strcmp+0x11>
+		p++, q++;
+  8008af:	83 c1 01             	add    $0x1,%ecx
+  8008b2:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008b5:	0f b6 01             	movzbl (%ecx),%eax
+  8008b8:	84 c0                	test   %al,%al
+  8008ba:	74 04                	je     8008c0 <strcmp+0x1c>
+  8008bc:	3a 02                	cmp    (%edx),%al
+  8008be:	74 ef                	je     8008af <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008c0:	0f b6 c0             	movzbl %al,%eax
+  8008c3:	0f b6 12             	movzbl (%edx),%edx
+  8008c6:	29 d0                	sub    %edx,%eax
+}
+  8008c8:	5d                   	pop    %ebp
+  8008c9:	c3                   	ret
+
+008008ca <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	53                   	push   %ebx
+  8008ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008d7:	eb 09                	jmp    8008e2 <strncmp+0x18>
+		n--, p++, q++;
+  8008d9:	83 ea 01             	sub    $0x1,%edx
+  8008dc:	83 c0 01             	add    $0x1,%eax
+  8008df:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008e2:	85 d2                	test   %edx,%edx
+  8008e4:	74 18                	je     8008fe <strncmp+0x34>
+  8008e6:	0f b6 18             	movzbl (%eax),%ebx
+  8008e9:	84 db                	test   %bl,%bl
+  8008eb:	74 04                	je     8008f1 <strncmp+0x27>
+  8008ed:	3a 19                	cmp    (%ecx),%bl
+  8008ef:	74 e8                	je     8008d9 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008f1:	0f b6 00             	movzbl (%eax),%eax
+  8008f4:	0f b6 11             	movzbl (%ecx),%edx
+  8008f7:	29 d0                	sub    %edx,%eax
+}
+  8008f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008fc:	c9                   	leave
+  8008fd:	c3                   	ret
+		return 0;
+  8008fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800903:	eb f4                	jmp    8008f9 <strncmp+0x2f>
+
+00800905 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800905:	55                   	push   %ebp
+  800906:	89 e5                	mov    %esp,%ebp
+  800908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80090f:	eb 03                	jmp    800914 <strchr+0xf>
+  800911:	83 c0 01             	add    $0x1,%eax
+  800914:	0f b6 10             	movzbl (%eax),%edx
+  800917:	84 d2                	test   %dl,%dl
+  800919:	74 06                	je     800921 <strchr+0x1c>
+		if (*s == c)
+  80091b:	38 ca                	cmp    %cl,%dl
+  80091d:	75 f2                	jne    800911 <strchr+0xc>
+  80091f:	eb 05                	jmp    800926 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800921:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800926:	5d                   	pop    %ebp
+  800927:	c3                   	ret
+
+00800928 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800932:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800935:	38 ca                	cmp    %cl,%dl
+  800937:	74 09                	je     800942 <strfind+0x1a>
+  800939:	84 d2                	test   %dl,%dl
+  80093b:	74 05                	je     800942 <strfind+0x1a>
+	for (; *s; s++)
+  80093d:	83 c0 01             	add    $0x1,%eax
+  800940:	eb f0                	jmp    800932 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800942:	5d                   	pop    %ebp
+  800943:	c3                   	ret
+
+00800944 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800944:	55                   	push   %ebp
+  800945:	89 e5                	mov    %esp,%ebp
+  800947:	57                   	push   %edi
+  800948:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80094b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80094e:	85 c9                	test   %ecx,%ecx
+  800950:	74 20                	je     800972 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800952:	89 f8                	mov    %edi,%eax
+  800954:	09 c8                	or     %ecx,%eax
+  800956:	a8 03                	test   $0x3,%al
+  800958:	75 12                	jne    80096c <memset+0x28>
+		c &= 0xFF;
+  80095a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80095e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800964:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800967:	fc                   	cld
+  800968:	f3 ab                	rep stos %eax,%es:(%edi)
+  80096a:	eb 06                	jmp    800972 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80096c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80096f:	fc                   	cld
+  800970:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800972:	89 f8                	mov    %edi,%eax
+  800974:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800977:	c9                   	leave
+  800978:	c3                   	ret
+
+00800979 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800979:	55                   	push   %ebp
+  80097a:	89 e5                	mov    %esp,%ebp
+  80097c:	57                   	push   %edi
+  80097d:	56                   	push   %esi
+  80097e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800981:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800984:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800987:	39 c6                	cmp    %eax,%esi
+  800989:	73 32                	jae    8009bd <memmove+0x44>
+  80098b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80098e:	39 d0                	cmp    %edx,%eax
+  800990:	73 2b                	jae    8009bd <memmove+0x44>
+		s += n;
+		d += n;
+  800992:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800995:	89 d6                	mov    %edx,%esi
+  800997:	09 fe                	or     %edi,%esi
+  800999:	09 ce                	or     %ecx,%esi
+  80099b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009a1:	75 0e                	jne    8009b1 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009a3:	83 ef 04             	sub    $0x4,%edi
+  8009a6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009a9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009ac:	fd                   	std
+  8009ad:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009af:	eb 09                	jmp    8009ba <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009b1:	83 ef 01             	sub    $0x1,%edi
+  8009b4:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009b7:	fd                   	std
+  8009b8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009ba:	fc                   	cld
+  8009bb:	eb 1a                	jmp    8009d7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009bd:	89 f2                	mov    %esi,%edx
+  8009bf:	09 c2                	or     %eax,%edx
+  8009c1:	09 ca                	or     %ecx,%edx
+  8009c3:	f6 c2 03             	test   $0x3,%dl
+  8009c6:	75 0a                	jne    8009d2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009c8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009cb:	89 c7                	mov    %eax,%edi
+  8009cd:	fc                   	cld
+  8009ce:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d0:	eb 05                	jmp    8009d7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009d2:	89 c7                	mov    %eax,%edi
+  8009d4:	fc                   	cld
+  8009d5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009d7:	5e                   	pop    %esi
+  8009d8:	5f                   	pop    %edi
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+
+008009db <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009e1:	ff 75 10             	push   0x10(%ebp)
+  8009e4:	ff 75 0c             	push   0xc(%ebp)
+  8009e7:	ff 75 08             	push   0x8(%ebp)
+  8009ea:	e8 8a ff ff ff       	call   800979 <memmove>
+}
+  8009ef:	c9                   	leave
+  8009f0:	c3                   	ret
+
+008009f1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009f1:	55                   	push   %ebp
+  8009f2:	89 e5                	mov    %esp,%ebp
+  8009f4:	56                   	push   %esi
+  8009f5:	53                   	push   %ebx
+  8009f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009fc:	89 c6                	mov    %eax,%esi
+  8009fe:	03 75 10             	add    0x10(%ebp),%esi
+  800a01:	eb 06                	jmp    800a09 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a03:	83 c0 01             	add    $0x1,%eax
+  800a06:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a09:	39 f0                	cmp    %esi,%eax
+  800a0b:	74 14                	je     800a21 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a0d:	0f b6 08             	movzbl (%eax),%ecx
+  800a10:	0f b6 1a             	movzbl (%edx),%ebx
+  800a13:	38 d9                	cmp    %bl,%cl
+  800a15:	74 ec                	je     800a03 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a17:	0f b6 c1             	movzbl %cl,%eax
+  800a1a:	0f b6 db             	movzbl %bl,%ebx
+  800a1d:	29 d8                	sub    %ebx,%eax
+  800a1f:	eb 05                	jmp    800a26 <memcmp+0x35>
+	}
+
+	return 0;
+  800a21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a26:	5b                   	pop    %ebx
+  800a27:	5e                   	pop    %esi
+  800a28:	5d                   	pop    %ebp
+  800a29:	c3                   	ret
+
+00800a2a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a2a:	55                   	push   %ebp
+  800a2b:	89 e5                	mov    %esp,%ebp
+  800a2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a33:	89 c2                	mov    %eax,%edx
+  800a35:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a38:	eb 03                	jmp    800a3d <memfind+0x13>
+  800a3a:	83 c0 01             	add    $0x1,%eax
+  800a3d:	39 d0                	cmp    %edx,%eax
+  800a3f:	73 04                	jae    800a45 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a41:	38 08                	cmp    %cl,(%eax)
+  800a43:	75 f5                	jne    800a3a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a45:	5d                   	pop    %ebp
+  800a46:	c3                   	ret
+
+00800a47 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a47:	55                   	push   %ebp
+  800a48:	89 e5                	mov    %esp,%ebp
+  800a4a:	57                   	push   %edi
+  800a4b:	56                   	push   %esi
+  800a4c:	53                   	push   %ebx
+  800a4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a53:	eb 03                	jmp    800a58 <strtol+0x11>
+		s++;
+  800a55:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a58:	0f b6 02             	movzbl (%edx),%eax
+  800a5b:	3c 20                	cmp    $0x20,%al
+  800a5d:	74 f6                	je     800a55 <strtol+0xe>
+  800a5f:	3c 09                	cmp    $0x9,%al
+  800a61:	74 f2                	je     800a55 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a63:	3c 2b                	cmp    $0x2b,%al
+  800a65:	74 2a                	je     800a91 <strtol+0x4a>
+	int neg = 0;
+  800a67:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a6c:	3c 2d                	cmp    $0x2d,%al
+  800a6e:	74 2b                	je     800a9b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a70:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a76:	75 0f                	jne    800a87 <strtol+0x40>
+  800a78:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a7b:	74 28                	je     800aa5 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a7d:	85 db                	test   %ebx,%ebx
+  800a7f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a84:	0f 44 d8             	cmove  %eax,%ebx
+  800a87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a8f:	eb 46                	jmp    800ad7 <strtol+0x90>
+		s++;
+  800a91:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a94:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a99:	eb d5                	jmp    800a70 <strtol+0x29>
+		s++, neg = 1;
+  800a9b:	83 c2 01             	add    $0x1,%edx
+  800a9e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800aa3:	eb cb                	jmp    800a70 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa5:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aa9:	74 0e                	je     800ab9 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800aab:	85 db                	test   %ebx,%ebx
+  800aad:	75 d8                	jne    800a87 <strtol+0x40>
+		s++, base = 8;
+  800aaf:	83 c2 01             	add    $0x1,%edx
+  800ab2:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ab7:	eb ce                	jmp    800a87 <strtol+0x40>
+		s += 2, base = 16;
+  800ab9:	83 c2 02             	add    $0x2,%edx
+  800abc:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ac1:	eb c4                	jmp    800a87 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ac3:	0f be c0             	movsbl %al,%eax
+  800ac6:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ac9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800acc:	7d 3a                	jge    800b08 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ace:	83 c2 01             	add    $0x1,%edx
+  800ad1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ad5:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ad7:	0f b6 02             	movzbl (%edx),%eax
+  800ada:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800add:	89 f3                	mov    %esi,%ebx
+  800adf:	80 fb 09             	cmp    $0x9,%bl
+  800ae2:	76 df                	jbe    800ac3 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ae4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ae7:	89 f3                	mov    %esi,%ebx
+  800ae9:	80 fb 19             	cmp    $0x19,%bl
+  800aec:	77 08                	ja     800af6 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800aee:	0f be c0             	movsbl %al,%eax
+  800af1:	83 e8 57             	sub    $0x57,%eax
+  800af4:	eb d3                	jmp    800ac9 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800af6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800af9:	89 f3                	mov    %esi,%ebx
+  800afb:	80 fb 19             	cmp    $0x19,%bl
+  800afe:	77 08                	ja     800b08 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b00:	0f be c0             	movsbl %al,%eax
+  800b03:	83 e8 37             	sub    $0x37,%eax
+  800b06:	eb c1                	jmp    800ac9 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b08:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b0c:	74 05                	je     800b13 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b11:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b13:	89 c8                	mov    %ecx,%eax
+  800b15:	f7 d8                	neg    %eax
+  800b17:	85 ff                	test   %edi,%edi
+  800b19:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b1c:	89 c8                	mov    %ecx,%eax
+  800b1e:	5b                   	pop    %ebx
+  800b1f:	5e                   	pop    %esi
+  800b20:	5f                   	pop    %edi
+  800b21:	5d                   	pop    %ebp
+  800b22:	c3                   	ret
+
+00800b23 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b23:	55                   	push   %ebp
+  800b24:	89 e5                	mov    %esp,%ebp
+  800b26:	57                   	push   %edi
+  800b27:	56                   	push   %esi
+  800b28:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b34:	89 c3                	mov    %eax,%ebx
+  800b36:	89 c7                	mov    %eax,%edi
+  800b38:	89 c6                	mov    %eax,%esi
+  800b3a:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b3c:	5b                   	pop    %ebx
+  800b3d:	5e                   	pop    %esi
+  800b3e:	5f                   	pop    %edi
+  800b3f:	5d                   	pop    %ebp
+  800b40:	c3                   	ret
+
+00800b41 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b41:	55                   	push   %ebp
+  800b42:	89 e5                	mov    %esp,%ebp
+  800b44:	57                   	push   %edi
+  800b45:	56                   	push   %esi
+  800b46:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b51:	89 d1                	mov    %edx,%ecx
+  800b53:	89 d3                	mov    %edx,%ebx
+  800b55:	89 d7                	mov    %edx,%edi
+  800b57:	89 d6                	mov    %edx,%esi
+  800b59:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b5b:	5b                   	pop    %ebx
+  800b5c:	5e                   	pop    %esi
+  800b5d:	5f                   	pop    %edi
+  800b5e:	5d                   	pop    %ebp
+  800b5f:	c3                   	ret
+
+00800b60 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	57                   	push   %edi
+  800b64:	56                   	push   %esi
+  800b65:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b73:	89 cb                	mov    %ecx,%ebx
+  800b75:	89 cf                	mov    %ecx,%edi
+  800b77:	89 ce                	mov    %ecx,%esi
+  800b79:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b7b:	5b                   	pop    %ebx
+  800b7c:	5e                   	pop    %esi
+  800b7d:	5f                   	pop    %edi
+  800b7e:	5d                   	pop    %ebp
+  800b7f:	c3                   	ret
+
+00800b80 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	57                   	push   %edi
+  800b84:	56                   	push   %esi
+  800b85:	53                   	push   %ebx
+  800b86:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b91:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b96:	89 cb                	mov    %ecx,%ebx
+  800b98:	89 cf                	mov    %ecx,%edi
+  800b9a:	89 ce                	mov    %ecx,%esi
+  800b9c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b9e:	85 c0                	test   %eax,%eax
+  800ba0:	7f 08                	jg     800baa <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ba2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba5:	5b                   	pop    %ebx
+  800ba6:	5e                   	pop    %esi
+  800ba7:	5f                   	pop    %edi
+  800ba8:	5d                   	pop    %ebp
+  800ba9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800baa:	83 ec 0c             	sub    $0xc,%esp
+  800bad:	50                   	push   %eax
+  800bae:	6a 03                	push   $0x3
+  800bb0:	68 3f 2b 80 00       	push   $0x802b3f
+  800bb5:	6a 23                	push   $0x23
+  800bb7:	68 5c 2b 80 00       	push   $0x802b5c
+  800bbc:	e8 69 f5 ff ff       	call   80012a <_panic>
+
+00800bc1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bc1:	55                   	push   %ebp
+  800bc2:	89 e5                	mov    %esp,%ebp
+  800bc4:	57                   	push   %edi
+  800bc5:	56                   	push   %esi
+  800bc6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bcc:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bd1:	89 d1                	mov    %edx,%ecx
+  800bd3:	89 d3                	mov    %edx,%ebx
+  800bd5:	89 d7                	mov    %edx,%edi
+  800bd7:	89 d6                	mov    %edx,%esi
+  800bd9:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bdb:	5b                   	pop    %ebx
+  800bdc:	5e                   	pop    %esi
+  800bdd:	5f                   	pop    %edi
+  800bde:	5d                   	pop    %ebp
+  800bdf:	c3                   	ret
+
+00800be0 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800be0:	55                   	push   %ebp
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	57                   	push   %edi
+  800be4:	56                   	push   %esi
+  800be5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800be6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800beb:	b8 16 00 00 00       	mov    $0x16,%eax
+  800bf0:	89 d1                	mov    %edx,%ecx
+  800bf2:	89 d3                	mov    %edx,%ebx
+  800bf4:	89 d7                	mov    %edx,%edi
+  800bf6:	89 d6                	mov    %edx,%esi
+  800bf8:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bfa:	5b                   	pop    %ebx
+  800bfb:	5e                   	pop    %esi
+  800bfc:	5f                   	pop    %edi
+  800bfd:	5d                   	pop    %ebp
+  800bfe:	c3                   	ret
+
+00800bff <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800bff:	55                   	push   %ebp
+  800c00:	89 e5                	mov    %esp,%ebp
+  800c02:	57                   	push   %edi
+  800c03:	56                   	push   %esi
+  800c04:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c05:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800c0f:	89 d1                	mov    %edx,%ecx
+  800c11:	89 d3                	mov    %edx,%ebx
+  800c13:	89 d7                	mov    %edx,%edi
+  800c15:	89 d6                	mov    %edx,%esi
+  800c17:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800c19:	5b                   	pop    %ebx
+  800c1a:	5e                   	pop    %esi
+  800c1b:	5f                   	pop    %edi
+  800c1c:	5d                   	pop    %ebp
+  800c1d:	c3                   	ret
+
+00800c1e <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800c1e:	55                   	push   %ebp
+  800c1f:	89 e5                	mov    %esp,%ebp
+  800c21:	57                   	push   %edi
+  800c22:	56                   	push   %esi
+  800c23:	53                   	push   %ebx
+  800c24:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c32:	b8 15 00 00 00       	mov    $0x15,%eax
+  800c37:	89 df                	mov    %ebx,%edi
+  800c39:	89 de                	mov    %ebx,%esi
+  800c3b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c3d:	85 c0                	test   %eax,%eax
+  800c3f:	7f 08                	jg     800c49 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800c41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c44:	5b                   	pop    %ebx
+  800c45:	5e                   	pop    %esi
+  800c46:	5f                   	pop    %edi
+  800c47:	5d                   	pop    %ebp
+  800c48:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c49:	83 ec 0c             	sub    $0xc,%esp
+  800c4c:	50                   	push   %eax
+  800c4d:	6a 15                	push   $0x15
+  800c4f:	68 3f 2b 80 00       	push   $0x802b3f
+  800c54:	6a 23                	push   $0x23
+  800c56:	68 5c 2b 80 00       	push   $0x802b5c
+  800c5b:	e8 ca f4 ff ff       	call   80012a <_panic>
+
+00800c60 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c60:	55                   	push   %ebp
+  800c61:	89 e5                	mov    %esp,%ebp
+  800c63:	57                   	push   %edi
+  800c64:	56                   	push   %esi
+  800c65:	53                   	push   %ebx
+  800c66:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c69:	be 00 00 00 00       	mov    $0x0,%esi
+  800c6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c74:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c7c:	89 f7                	mov    %esi,%edi
+  800c7e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c80:	85 c0                	test   %eax,%eax
+  800c82:	7f 08                	jg     800c8c <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c87:	5b                   	pop    %ebx
+  800c88:	5e                   	pop    %esi
+  800c89:	5f                   	pop    %edi
+  800c8a:	5d                   	pop    %ebp
+  800c8b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c8c:	83 ec 0c             	sub    $0xc,%esp
+  800c8f:	50                   	push   %eax
+  800c90:	6a 05                	push   $0x5
+  800c92:	68 3f 2b 80 00       	push   $0x802b3f
+  800c97:	6a 23                	push   $0x23
+  800c99:	68 5c 2b 80 00       	push   $0x802b5c
+  800c9e:	e8 87 f4 ff ff       	call   80012a <_panic>
+
+00800ca3 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800ca3:	55                   	push   %ebp
+  800ca4:	89 e5                	mov    %esp,%ebp
+  800ca6:	57                   	push   %edi
+  800ca7:	56                   	push   %esi
+  800ca8:	53                   	push   %ebx
+  800ca9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cac:	be 00 00 00 00       	mov    $0x0,%esi
+  800cb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cbc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cbf:	89 f7                	mov    %esi,%edi
+  800cc1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cc3:	85 c0                	test   %eax,%eax
+  800cc5:	7f 08                	jg     800ccf <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cca:	5b                   	pop    %ebx
+  800ccb:	5e                   	pop    %esi
+  800ccc:	5f                   	pop    %edi
+  800ccd:	5d                   	pop    %ebp
+  800cce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ccf:	83 ec 0c             	sub    $0xc,%esp
+  800cd2:	50                   	push   %eax
+  800cd3:	6a 06                	push   $0x6
+  800cd5:	68 3f 2b 80 00       	push   $0x802b3f
+  800cda:	6a 23                	push   $0x23
+  800cdc:	68 5c 2b 80 00       	push   $0x802b5c
+  800ce1:	e8 44 f4 ff ff       	call   80012a <_panic>
+
+00800ce6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ce6:	55                   	push   %ebp
+  800ce7:	89 e5                	mov    %esp,%ebp
+  800ce9:	57                   	push   %edi
+  800cea:	56                   	push   %esi
+  800ceb:	53                   	push   %ebx
+  800cec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf5:	b8 07 00 00 00       	mov    $0x7,%eax
+  800cfa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cfd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d00:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d03:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d05:	85 c0                	test   %eax,%eax
+  800d07:	7f 08                	jg     800d11 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0c:	5b                   	pop    %ebx
+  800d0d:	5e                   	pop    %esi
+  800d0e:	5f                   	pop    %edi
+  800d0f:	5d                   	pop    %ebp
+  800d10:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d11:	83 ec 0c             	sub    $0xc,%esp
+  800d14:	50                   	push   %eax
+  800d15:	6a 07                	push   $0x7
+  800d17:	68 3f 2b 80 00       	push   $0x802b3f
+  800d1c:	6a 23                	push   $0x23
+  800d1e:	68 5c 2b 80 00       	push   $0x802b5c
+  800d23:	e8 02 f4 ff ff       	call   80012a <_panic>
+
+00800d28 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d28:	55                   	push   %ebp
+  800d29:	89 e5                	mov    %esp,%ebp
+  800d2b:	57                   	push   %edi
+  800d2c:	56                   	push   %esi
+  800d2d:	53                   	push   %ebx
+  800d2e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d41:	89 df                	mov    %ebx,%edi
+  800d43:	89 de                	mov    %ebx,%esi
+  800d45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d47:	85 c0                	test   %eax,%eax
+  800d49:	7f 08                	jg     800d53 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4e:	5b                   	pop    %ebx
+  800d4f:	5e                   	pop    %esi
+  800d50:	5f                   	pop    %edi
+  800d51:	5d                   	pop    %ebp
+  800d52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d53:	83 ec 0c             	sub    $0xc,%esp
+  800d56:	50                   	push   %eax
+  800d57:	6a 08                	push   $0x8
+  800d59:	68 3f 2b 80 00       	push   $0x802b3f
+  800d5e:	6a 23                	push   $0x23
+  800d60:	68 5c 2b 80 00       	push   $0x802b5c
+  800d65:	e8 c0 f3 ff ff       	call   80012a <_panic>
+
+00800d6a <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d6a:	55                   	push   %ebp
+  800d6b:	89 e5                	mov    %esp,%ebp
+  800d6d:	57                   	push   %edi
+  800d6e:	56                   	push   %esi
+  800d6f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d76:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d7b:	be 00 00 00 00       	mov    $0x0,%esi
+  800d80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d83:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d86:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d88:	5b                   	pop    %ebx
+  800d89:	5e                   	pop    %esi
+  800d8a:	5f                   	pop    %edi
+  800d8b:	5d                   	pop    %ebp
+  800d8c:	c3                   	ret
+
+00800d8d <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d8d:	55                   	push   %ebp
+  800d8e:	89 e5                	mov    %esp,%ebp
+  800d90:	57                   	push   %edi
+  800d91:	56                   	push   %esi
+  800d92:	53                   	push   %ebx
+  800d93:	8b 45 18             	mov    0x18(%ebp),%eax
+  800d96:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800d99:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800d9e:	77 27                	ja     800dc7 <sys_page_map_range+0x3a>
+  800da0:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800da6:	77 1f                	ja     800dc7 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800da8:	c1 e0 0c             	shl    $0xc,%eax
+  800dab:	89 c6                	mov    %eax,%esi
+  800dad:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800daf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc0:	cd 30                	int    $0x30
+}
+  800dc2:	5b                   	pop    %ebx
+  800dc3:	5e                   	pop    %esi
+  800dc4:	5f                   	pop    %edi
+  800dc5:	5d                   	pop    %ebp
+  800dc6:	c3                   	ret
+		return -E_INVAL;
+  800dc7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dcc:	eb f4                	jmp    800dc2 <sys_page_map_range+0x35>
+
+00800dce <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	57                   	push   %edi
+  800dd2:	56                   	push   %esi
+  800dd3:	53                   	push   %ebx
+  800dd4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800de2:	be 00 00 00 00       	mov    $0x0,%esi
+  800de7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ded:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800def:	85 c0                	test   %eax,%eax
+  800df1:	7f 08                	jg     800dfb <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800df3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df6:	5b                   	pop    %ebx
+  800df7:	5e                   	pop    %esi
+  800df8:	5f                   	pop    %edi
+  800df9:	5d                   	pop    %ebp
+  800dfa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfb:	83 ec 0c             	sub    $0xc,%esp
+  800dfe:	50                   	push   %eax
+  800dff:	6a 0c                	push   $0xc
+  800e01:	68 3f 2b 80 00       	push   $0x802b3f
+  800e06:	6a 23                	push   $0x23
+  800e08:	68 5c 2b 80 00       	push   $0x802b5c
+  800e0d:	e8 18 f3 ff ff       	call   80012a <_panic>
+
+00800e12 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e12:	55                   	push   %ebp
+  800e13:	89 e5                	mov    %esp,%ebp
+  800e15:	57                   	push   %edi
+  800e16:	56                   	push   %esi
+  800e17:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e18:	be 00 00 00 00       	mov    $0x0,%esi
+  800e1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e23:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e2b:	89 f7                	mov    %esi,%edi
+  800e2d:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e2f:	5b                   	pop    %ebx
+  800e30:	5e                   	pop    %esi
+  800e31:	5f                   	pop    %edi
+  800e32:	5d                   	pop    %ebp
+  800e33:	c3                   	ret
+
+00800e34 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e34:	55                   	push   %ebp
+  800e35:	89 e5                	mov    %esp,%ebp
+  800e37:	57                   	push   %edi
+  800e38:	56                   	push   %esi
+  800e39:	53                   	push   %ebx
+  800e3a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e48:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e4d:	89 df                	mov    %ebx,%edi
+  800e4f:	89 de                	mov    %ebx,%esi
+  800e51:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e53:	85 c0                	test   %eax,%eax
+  800e55:	7f 08                	jg     800e5f <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5a:	5b                   	pop    %ebx
+  800e5b:	5e                   	pop    %esi
+  800e5c:	5f                   	pop    %edi
+  800e5d:	5d                   	pop    %ebp
+  800e5e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5f:	83 ec 0c             	sub    $0xc,%esp
+  800e62:	50                   	push   %eax
+  800e63:	6a 0f                	push   $0xf
+  800e65:	68 3f 2b 80 00       	push   $0x802b3f
+  800e6a:	6a 23                	push   $0x23
+  800e6c:	68 5c 2b 80 00       	push   $0x802b5c
+  800e71:	e8 b4 f2 ff ff       	call   80012a <_panic>
+
+00800e76 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e76:	55                   	push   %ebp
+  800e77:	89 e5                	mov    %esp,%ebp
+  800e79:	57                   	push   %edi
+  800e7a:	56                   	push   %esi
+  800e7b:	53                   	push   %ebx
+  800e7c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8a:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e8f:	89 df                	mov    %ebx,%edi
+  800e91:	89 de                	mov    %ebx,%esi
+  800e93:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e95:	85 c0                	test   %eax,%eax
+  800e97:	7f 08                	jg     800ea1 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800e99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9c:	5b                   	pop    %ebx
+  800e9d:	5e                   	pop    %esi
+  800e9e:	5f                   	pop    %edi
+  800e9f:	5d                   	pop    %ebp
+  800ea0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea1:	83 ec 0c             	sub    $0xc,%esp
+  800ea4:	50                   	push   %eax
+  800ea5:	6a 10                	push   $0x10
+  800ea7:	68 3f 2b 80 00       	push   $0x802b3f
+  800eac:	6a 23                	push   $0x23
+  800eae:	68 5c 2b 80 00       	push   $0x802b5c
+  800eb3:	e8 72 f2 ff ff       	call   80012a <_panic>
+
+00800eb8 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800eb8:	55                   	push   %ebp
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	57                   	push   %edi
+  800ebc:	56                   	push   %esi
+  800ebd:	53                   	push   %ebx
+  800ebe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ec1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecc:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ed1:	89 df                	mov    %ebx,%edi
+  800ed3:	89 de                	mov    %ebx,%esi
+  800ed5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed7:	85 c0                	test   %eax,%eax
+  800ed9:	7f 08                	jg     800ee3 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800edb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ede:	5b                   	pop    %ebx
+  800edf:	5e                   	pop    %esi
+  800ee0:	5f                   	pop    %edi
+  800ee1:	5d                   	pop    %ebp
+  800ee2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee3:	83 ec 0c             	sub    $0xc,%esp
+  800ee6:	50                   	push   %eax
+  800ee7:	6a 11                	push   $0x11
+  800ee9:	68 3f 2b 80 00       	push   $0x802b3f
+  800eee:	6a 23                	push   $0x23
+  800ef0:	68 5c 2b 80 00       	push   $0x802b5c
+  800ef5:	e8 30 f2 ff ff       	call   80012a <_panic>
+
+00800efa <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	57                   	push   %edi
+  800efe:	56                   	push   %esi
+  800eff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f05:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f0a:	89 d1                	mov    %edx,%ecx
+  800f0c:	89 d3                	mov    %edx,%ebx
+  800f0e:	89 d7                	mov    %edx,%edi
+  800f10:	89 d6                	mov    %edx,%esi
+  800f12:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+
+00800f19 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+  800f1f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2d:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f32:	89 df                	mov    %ebx,%edi
+  800f34:	89 de                	mov    %ebx,%esi
+  800f36:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f38:	85 c0                	test   %eax,%eax
+  800f3a:	7f 08                	jg     800f44 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5e                   	pop    %esi
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f44:	83 ec 0c             	sub    $0xc,%esp
+  800f47:	50                   	push   %eax
+  800f48:	6a 13                	push   $0x13
+  800f4a:	68 3f 2b 80 00       	push   $0x802b3f
+  800f4f:	6a 23                	push   $0x23
+  800f51:	68 5c 2b 80 00       	push   $0x802b5c
+  800f56:	e8 cf f1 ff ff       	call   80012a <_panic>
+
+00800f5b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f5b:	55                   	push   %ebp
+  800f5c:	89 e5                	mov    %esp,%ebp
+  800f5e:	57                   	push   %edi
+  800f5f:	56                   	push   %esi
+  800f60:	53                   	push   %ebx
+  800f61:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f74:	89 df                	mov    %ebx,%edi
+  800f76:	89 de                	mov    %ebx,%esi
+  800f78:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	7f 08                	jg     800f86 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f81:	5b                   	pop    %ebx
+  800f82:	5e                   	pop    %esi
+  800f83:	5f                   	pop    %edi
+  800f84:	5d                   	pop    %ebp
+  800f85:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f86:	83 ec 0c             	sub    $0xc,%esp
+  800f89:	50                   	push   %eax
+  800f8a:	6a 14                	push   $0x14
+  800f8c:	68 3f 2b 80 00       	push   $0x802b3f
+  800f91:	6a 23                	push   $0x23
+  800f93:	68 5c 2b 80 00       	push   $0x802b5c
+  800f98:	e8 8d f1 ff ff       	call   80012a <_panic>
+
+00800f9d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	57                   	push   %edi
+  800fa1:	56                   	push   %esi
+  800fa2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa9:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fae:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fbb:	5b                   	pop    %ebx
+  800fbc:	5e                   	pop    %esi
+  800fbd:	5f                   	pop    %edi
+  800fbe:	5d                   	pop    %ebp
+  800fbf:	c3                   	ret
+
+00800fc0 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fc0:	55                   	push   %ebp
+  800fc1:	89 e5                	mov    %esp,%ebp
+  800fc3:	57                   	push   %edi
+  800fc4:	56                   	push   %esi
+  800fc5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcc:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fd1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fdc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fde:	5b                   	pop    %ebx
+  800fdf:	5e                   	pop    %esi
+  800fe0:	5f                   	pop    %edi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+
+00800fe3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800fe3:	55                   	push   %ebp
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	57                   	push   %edi
+  800fe7:	56                   	push   %esi
+  800fe8:	53                   	push   %ebx
+  800fe9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ff1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff4:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ff9:	89 cb                	mov    %ecx,%ebx
+  800ffb:	89 cf                	mov    %ecx,%edi
+  800ffd:	89 ce                	mov    %ecx,%esi
+  800fff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801001:	85 c0                	test   %eax,%eax
+  801003:	7f 08                	jg     80100d <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801005:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801008:	5b                   	pop    %ebx
+  801009:	5e                   	pop    %esi
+  80100a:	5f                   	pop    %edi
+  80100b:	5d                   	pop    %ebp
+  80100c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80100d:	83 ec 0c             	sub    $0xc,%esp
+  801010:	50                   	push   %eax
+  801011:	6a 19                	push   $0x19
+  801013:	68 3f 2b 80 00       	push   $0x802b3f
+  801018:	6a 23                	push   $0x23
+  80101a:	68 5c 2b 80 00       	push   $0x802b5c
+  80101f:	e8 06 f1 ff ff       	call   80012a <_panic>
+
+00801024 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  801027:	57                   	push   %edi
+  801028:	56                   	push   %esi
+  801029:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80102a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801034:	89 d1                	mov    %edx,%ecx
+  801036:	89 d3                	mov    %edx,%ebx
+  801038:	89 d7                	mov    %edx,%edi
+  80103a:	89 d6                	mov    %edx,%esi
+  80103c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80103e:	5b                   	pop    %ebx
+  80103f:	5e                   	pop    %esi
+  801040:	5f                   	pop    %edi
+  801041:	5d                   	pop    %ebp
+  801042:	c3                   	ret
+
+00801043 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801043:	55                   	push   %ebp
+  801044:	89 e5                	mov    %esp,%ebp
+  801046:	57                   	push   %edi
+  801047:	56                   	push   %esi
+  801048:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801049:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801051:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801054:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801059:	89 df                	mov    %ebx,%edi
+  80105b:	89 de                	mov    %ebx,%esi
+  80105d:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  80105f:	5b                   	pop    %ebx
+  801060:	5e                   	pop    %esi
+  801061:	5f                   	pop    %edi
+  801062:	5d                   	pop    %ebp
+  801063:	c3                   	ret
+
+00801064 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801064:	55                   	push   %ebp
+  801065:	89 e5                	mov    %esp,%ebp
+  801067:	57                   	push   %edi
+  801068:	56                   	push   %esi
+  801069:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80106a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801072:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801075:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80107a:	89 df                	mov    %ebx,%edi
+  80107c:	89 de                	mov    %ebx,%esi
+  80107e:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801080:	5b                   	pop    %ebx
+  801081:	5e                   	pop    %esi
+  801082:	5f                   	pop    %edi
+  801083:	5d                   	pop    %ebp
+  801084:	c3                   	ret
+
+00801085 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801085:	55                   	push   %ebp
+  801086:	89 e5                	mov    %esp,%ebp
+  801088:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80108b:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801092:	74 0a                	je     80109e <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801094:	8b 45 08             	mov    0x8(%ebp),%eax
+  801097:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  80109c:	c9                   	leave
+  80109d:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  80109e:	83 ec 04             	sub    $0x4,%esp
+  8010a1:	6a 07                	push   $0x7
+  8010a3:	68 00 f0 bf ee       	push   $0xeebff000
+  8010a8:	6a 00                	push   $0x0
+  8010aa:	e8 b1 fb ff ff       	call   800c60 <sys_page_alloc>
+  8010af:	83 c4 10             	add    $0x10,%esp
+  8010b2:	85 c0                	test   %eax,%eax
+  8010b4:	78 28                	js     8010de <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  8010b6:	83 ec 08             	sub    $0x8,%esp
+  8010b9:	68 f0 10 80 00       	push   $0x8010f0
+  8010be:	6a 00                	push   $0x0
+  8010c0:	e8 96 fe ff ff       	call   800f5b <sys_env_set_pgfault_upcall>
+  8010c5:	83 c4 10             	add    $0x10,%esp
+  8010c8:	85 c0                	test   %eax,%eax
+  8010ca:	79 c8                	jns    801094 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  8010cc:	50                   	push   %eax
+  8010cd:	68 8b 2b 80 00       	push   $0x802b8b
+  8010d2:	6a 24                	push   $0x24
+  8010d4:	68 7d 2b 80 00       	push   $0x802b7d
+  8010d9:	e8 4c f0 ff ff       	call   80012a <_panic>
+			panic("sys_page_alloc: %e", r);
+  8010de:	50                   	push   %eax
+  8010df:	68 6a 2b 80 00       	push   $0x802b6a
+  8010e4:	6a 21                	push   $0x21
+  8010e6:	68 7d 2b 80 00       	push   $0x802b7d
+  8010eb:	e8 3a f0 ff ff       	call   80012a <_panic>
+
+008010f0 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8010f0:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8010f1:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  8010f6:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8010f8:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8010fb:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  8010fe:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  801102:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  801105:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  801109:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  80110d:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  80110f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  801110:	83 c4 04             	add    $0x4,%esp
+	popf
+  801113:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  801114:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801115:	c3                   	ret
+
+00801116 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801116:	55                   	push   %ebp
+  801117:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801119:	8b 45 08             	mov    0x8(%ebp),%eax
+  80111c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801121:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801124:	5d                   	pop    %ebp
+  801125:	c3                   	ret
+
+00801126 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801129:	8b 45 08             	mov    0x8(%ebp),%eax
+  80112c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801131:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801136:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80113b:	5d                   	pop    %ebp
+  80113c:	c3                   	ret
+
+0080113d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80113d:	55                   	push   %ebp
+  80113e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801140:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801145:	eb 02                	jmp    801149 <fd_alloc+0xc>
+  801147:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801149:	89 c2                	mov    %eax,%edx
+  80114b:	c1 ea 16             	shr    $0x16,%edx
+  80114e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801155:	f6 c2 01             	test   $0x1,%dl
+  801158:	74 2b                	je     801185 <fd_alloc+0x48>
+  80115a:	89 c2                	mov    %eax,%edx
+  80115c:	c1 ea 0c             	shr    $0xc,%edx
+  80115f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801166:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80116c:	f6 c1 01             	test   $0x1,%cl
+  80116f:	74 14                	je     801185 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801171:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801177:	75 ce                	jne    801147 <fd_alloc+0xa>
+  801179:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80117e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801183:	eb 05                	jmp    80118a <fd_alloc+0x4d>
+			return 0;
+  801185:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80118a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118d:	89 02                	mov    %eax,(%edx)
+}
+  80118f:	89 c8                	mov    %ecx,%eax
+  801191:	5d                   	pop    %ebp
+  801192:	c3                   	ret
+
+00801193 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801193:	55                   	push   %ebp
+  801194:	89 e5                	mov    %esp,%ebp
+  801196:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801199:	83 f8 1f             	cmp    $0x1f,%eax
+  80119c:	77 30                	ja     8011ce <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80119e:	c1 e0 0c             	shl    $0xc,%eax
+  8011a1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011a6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011ac:	f6 c2 01             	test   $0x1,%dl
+  8011af:	74 24                	je     8011d5 <fd_lookup+0x42>
+  8011b1:	89 c2                	mov    %eax,%edx
+  8011b3:	c1 ea 0c             	shr    $0xc,%edx
+  8011b6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011bd:	f6 c2 01             	test   $0x1,%dl
+  8011c0:	74 1a                	je     8011dc <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011c5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011cc:	5d                   	pop    %ebp
+  8011cd:	c3                   	ret
+		return -E_INVAL;
+  8011ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011d3:	eb f7                	jmp    8011cc <fd_lookup+0x39>
+		return -E_INVAL;
+  8011d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011da:	eb f0                	jmp    8011cc <fd_lookup+0x39>
+  8011dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011e1:	eb e9                	jmp    8011cc <fd_lookup+0x39>
+
+008011e3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011e3:	55                   	push   %ebp
+  8011e4:	89 e5                	mov    %esp,%ebp
+  8011e6:	53                   	push   %ebx
+  8011e7:	83 ec 04             	sub    $0x4,%esp
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f2:	eb 03                	jmp    8011f7 <dev_lookup+0x14>
+  8011f4:	83 c0 01             	add    $0x1,%eax
+  8011f7:	8b 1c 85 28 2c 80 00 	mov    0x802c28(,%eax,4),%ebx
+  8011fe:	85 db                	test   %ebx,%ebx
+  801200:	74 0b                	je     80120d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801202:	39 13                	cmp    %edx,(%ebx)
+  801204:	75 ee                	jne    8011f4 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120b:	eb 1f                	jmp    80122c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80120d:	a1 08 40 80 00       	mov    0x804008,%eax
+  801212:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801215:	83 ec 04             	sub    $0x4,%esp
+  801218:	52                   	push   %edx
+  801219:	50                   	push   %eax
+  80121a:	68 ac 2b 80 00       	push   $0x802bac
+  80121f:	e8 e1 ef ff ff       	call   800205 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801224:	83 c4 10             	add    $0x10,%esp
+  801227:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80122c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80122f:	89 1a                	mov    %ebx,(%edx)
+}
+  801231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801234:	c9                   	leave
+  801235:	c3                   	ret
+
+00801236 <fd_close>:
+{
+  801236:	55                   	push   %ebp
+  801237:	89 e5                	mov    %esp,%ebp
+  801239:	57                   	push   %edi
+  80123a:	56                   	push   %esi
+  80123b:	53                   	push   %ebx
+  80123c:	83 ec 24             	sub    $0x24,%esp
+  80123f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801242:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801245:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801248:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801249:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80124f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801252:	50                   	push   %eax
+  801253:	e8 3b ff ff ff       	call   801193 <fd_lookup>
+  801258:	89 c3                	mov    %eax,%ebx
+  80125a:	83 c4 10             	add    $0x10,%esp
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	78 05                	js     801266 <fd_close+0x30>
+	    || fd != fd2)
+  801261:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801264:	74 16                	je     80127c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801266:	89 f8                	mov    %edi,%eax
+  801268:	84 c0                	test   %al,%al
+  80126a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801272:	89 d8                	mov    %ebx,%eax
+  801274:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801277:	5b                   	pop    %ebx
+  801278:	5e                   	pop    %esi
+  801279:	5f                   	pop    %edi
+  80127a:	5d                   	pop    %ebp
+  80127b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80127c:	83 ec 08             	sub    $0x8,%esp
+  80127f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801282:	50                   	push   %eax
+  801283:	ff 36                	push   (%esi)
+  801285:	e8 59 ff ff ff       	call   8011e3 <dev_lookup>
+  80128a:	89 c3                	mov    %eax,%ebx
+  80128c:	83 c4 10             	add    $0x10,%esp
+  80128f:	85 c0                	test   %eax,%eax
+  801291:	78 1a                	js     8012ad <fd_close+0x77>
+		if (dev->dev_close)
+  801293:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801296:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801299:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80129e:	85 c0                	test   %eax,%eax
+  8012a0:	74 0b                	je     8012ad <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8012a2:	83 ec 0c             	sub    $0xc,%esp
+  8012a5:	56                   	push   %esi
+  8012a6:	ff d0                	call   *%eax
+  8012a8:	89 c3                	mov    %eax,%ebx
+  8012aa:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012ad:	83 ec 08             	sub    $0x8,%esp
+  8012b0:	56                   	push   %esi
+  8012b1:	6a 00                	push   $0x0
+  8012b3:	e8 70 fa ff ff       	call   800d28 <sys_page_unmap>
+	return r;
+  8012b8:	83 c4 10             	add    $0x10,%esp
+  8012bb:	eb b5                	jmp    801272 <fd_close+0x3c>
+
+008012bd <close>:
+
+int
+close(int fdnum)
+{
+  8012bd:	55                   	push   %ebp
+  8012be:	89 e5                	mov    %esp,%ebp
+  8012c0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012c6:	50                   	push   %eax
+  8012c7:	ff 75 08             	push   0x8(%ebp)
+  8012ca:	e8 c4 fe ff ff       	call   801193 <fd_lookup>
+  8012cf:	83 c4 10             	add    $0x10,%esp
+  8012d2:	85 c0                	test   %eax,%eax
+  8012d4:	79 02                	jns    8012d8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012d6:	c9                   	leave
+  8012d7:	c3                   	ret
+		return fd_close(fd, 1);
+  8012d8:	83 ec 08             	sub    $0x8,%esp
+  8012db:	6a 01                	push   $0x1
+  8012dd:	ff 75 f4             	push   -0xc(%ebp)
+  8012e0:	e8 51 ff ff ff       	call   801236 <fd_close>
+  8012e5:	83 c4 10             	add    $0x10,%esp
+  8012e8:	eb ec                	jmp    8012d6 <close+0x19>
+
+008012ea <close_all>:
+
+void
+close_all(void)
+{
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	53                   	push   %ebx
+  8012ee:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8012f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8012f6:	83 ec 0c             	sub    $0xc,%esp
+  8012f9:	53                   	push   %ebx
+  8012fa:	e8 be ff ff ff       	call   8012bd <close>
+	for (i = 0; i < MAXFD; i++)
+  8012ff:	83 c3 01             	add    $0x1,%ebx
+  801302:	83 c4 10             	add    $0x10,%esp
+  801305:	83 fb 20             	cmp    $0x20,%ebx
+  801308:	75 ec                	jne    8012f6 <close_all+0xc>
+}
+  80130a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+
+0080130f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	57                   	push   %edi
+  801313:	56                   	push   %esi
+  801314:	53                   	push   %ebx
+  801315:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801318:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80131b:	50                   	push   %eax
+  80131c:	ff 75 08             	push   0x8(%ebp)
+  80131f:	e8 6f fe ff ff       	call   801193 <fd_lookup>
+  801324:	89 c3                	mov    %eax,%ebx
+  801326:	83 c4 10             	add    $0x10,%esp
+  801329:	85 c0                	test   %eax,%eax
+  80132b:	78 7f                	js     8013ac <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80132d:	83 ec 0c             	sub    $0xc,%esp
+  801330:	ff 75 0c             	push   0xc(%ebp)
+  801333:	e8 85 ff ff ff       	call   8012bd <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801338:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80133b:	c1 e6 0c             	shl    $0xc,%esi
+  80133e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801344:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801347:	89 3c 24             	mov    %edi,(%esp)
+  80134a:	e8 d7 fd ff ff       	call   801126 <fd2data>
+  80134f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801351:	89 34 24             	mov    %esi,(%esp)
+  801354:	e8 cd fd ff ff       	call   801126 <fd2data>
+  801359:	83 c4 10             	add    $0x10,%esp
+  80135c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80135f:	89 d8                	mov    %ebx,%eax
+  801361:	c1 e8 16             	shr    $0x16,%eax
+  801364:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80136b:	a8 01                	test   $0x1,%al
+  80136d:	74 11                	je     801380 <dup+0x71>
+  80136f:	89 d8                	mov    %ebx,%eax
+  801371:	c1 e8 0c             	shr    $0xc,%eax
+  801374:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80137b:	f6 c2 01             	test   $0x1,%dl
+  80137e:	75 36                	jne    8013b6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801380:	89 f8                	mov    %edi,%eax
+  801382:	c1 e8 0c             	shr    $0xc,%eax
+  801385:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80138c:	83 ec 0c             	sub    $0xc,%esp
+  80138f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801394:	50                   	push   %eax
+  801395:	56                   	push   %esi
+  801396:	6a 00                	push   $0x0
+  801398:	57                   	push   %edi
+  801399:	6a 00                	push   $0x0
+  80139b:	e8 46 f9 ff ff       	call   800ce6 <sys_page_map>
+  8013a0:	89 c3                	mov    %eax,%ebx
+  8013a2:	83 c4 20             	add    $0x20,%esp
+  8013a5:	85 c0                	test   %eax,%eax
+  8013a7:	78 33                	js     8013dc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013ac:	89 d8                	mov    %ebx,%eax
+  8013ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b1:	5b                   	pop    %ebx
+  8013b2:	5e                   	pop    %esi
+  8013b3:	5f                   	pop    %edi
+  8013b4:	5d                   	pop    %ebp
+  8013b5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013bd:	83 ec 0c             	sub    $0xc,%esp
+  8013c0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013c5:	50                   	push   %eax
+  8013c6:	ff 75 d4             	push   -0x2c(%ebp)
+  8013c9:	6a 00                	push   $0x0
+  8013cb:	53                   	push   %ebx
+  8013cc:	6a 00                	push   $0x0
+  8013ce:	e8 13 f9 ff ff       	call   800ce6 <sys_page_map>
+  8013d3:	89 c3                	mov    %eax,%ebx
+  8013d5:	83 c4 20             	add    $0x20,%esp
+  8013d8:	85 c0                	test   %eax,%eax
+  8013da:	79 a4                	jns    801380 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013dc:	83 ec 08             	sub    $0x8,%esp
+  8013df:	56                   	push   %esi
+  8013e0:	6a 00                	push   $0x0
+  8013e2:	e8 41 f9 ff ff       	call   800d28 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8013e7:	83 c4 08             	add    $0x8,%esp
+  8013ea:	ff 75 d4             	push   -0x2c(%ebp)
+  8013ed:	6a 00                	push   $0x0
+  8013ef:	e8 34 f9 ff ff       	call   800d28 <sys_page_unmap>
+	return r;
+  8013f4:	83 c4 10             	add    $0x10,%esp
+  8013f7:	eb b3                	jmp    8013ac <dup+0x9d>
+
+008013f9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	56                   	push   %esi
+  8013fd:	53                   	push   %ebx
+  8013fe:	83 ec 18             	sub    $0x18,%esp
+  801401:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801404:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801407:	50                   	push   %eax
+  801408:	56                   	push   %esi
+  801409:	e8 85 fd ff ff       	call   801193 <fd_lookup>
+  80140e:	83 c4 10             	add    $0x10,%esp
+  801411:	85 c0                	test   %eax,%eax
+  801413:	78 3c                	js     801451 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801415:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801418:	83 ec 08             	sub    $0x8,%esp
+  80141b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80141e:	50                   	push   %eax
+  80141f:	ff 33                	push   (%ebx)
+  801421:	e8 bd fd ff ff       	call   8011e3 <dev_lookup>
+  801426:	83 c4 10             	add    $0x10,%esp
+  801429:	85 c0                	test   %eax,%eax
+  80142b:	78 24                	js     801451 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80142d:	8b 43 08             	mov    0x8(%ebx),%eax
+  801430:	83 e0 03             	and    $0x3,%eax
+  801433:	83 f8 01             	cmp    $0x1,%eax
+  801436:	74 20                	je     801458 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801438:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80143b:	8b 40 08             	mov    0x8(%eax),%eax
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	74 37                	je     801479 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801442:	83 ec 04             	sub    $0x4,%esp
+  801445:	ff 75 10             	push   0x10(%ebp)
+  801448:	ff 75 0c             	push   0xc(%ebp)
+  80144b:	53                   	push   %ebx
+  80144c:	ff d0                	call   *%eax
+  80144e:	83 c4 10             	add    $0x10,%esp
+}
+  801451:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801454:	5b                   	pop    %ebx
+  801455:	5e                   	pop    %esi
+  801456:	5d                   	pop    %ebp
+  801457:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801458:	a1 08 40 80 00       	mov    0x804008,%eax
+  80145d:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801460:	83 ec 04             	sub    $0x4,%esp
+  801463:	56                   	push   %esi
+  801464:	50                   	push   %eax
+  801465:	68 ed 2b 80 00       	push   $0x802bed
+  80146a:	e8 96 ed ff ff       	call   800205 <cprintf>
+		return -E_INVAL;
+  80146f:	83 c4 10             	add    $0x10,%esp
+  801472:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801477:	eb d8                	jmp    801451 <read+0x58>
+		return -E_NOT_SUPP;
+  801479:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80147e:	eb d1                	jmp    801451 <read+0x58>
+
+00801480 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801480:	55                   	push   %ebp
+  801481:	89 e5                	mov    %esp,%ebp
+  801483:	57                   	push   %edi
+  801484:	56                   	push   %esi
+  801485:	53                   	push   %ebx
+  801486:	83 ec 0c             	sub    $0xc,%esp
+  801489:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80148c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80148f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801494:	eb 02                	jmp    801498 <readn+0x18>
+  801496:	01 c3                	add    %eax,%ebx
+  801498:	39 f3                	cmp    %esi,%ebx
+  80149a:	73 21                	jae    8014bd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80149c:	83 ec 04             	sub    $0x4,%esp
+  80149f:	89 f0                	mov    %esi,%eax
+  8014a1:	29 d8                	sub    %ebx,%eax
+  8014a3:	50                   	push   %eax
+  8014a4:	89 d8                	mov    %ebx,%eax
+  8014a6:	03 45 0c             	add    0xc(%ebp),%eax
+  8014a9:	50                   	push   %eax
+  8014aa:	57                   	push   %edi
+  8014ab:	e8 49 ff ff ff       	call   8013f9 <read>
+		if (m < 0)
+  8014b0:	83 c4 10             	add    $0x10,%esp
+  8014b3:	85 c0                	test   %eax,%eax
+  8014b5:	78 04                	js     8014bb <readn+0x3b>
+			return m;
+		if (m == 0)
+  8014b7:	75 dd                	jne    801496 <readn+0x16>
+  8014b9:	eb 02                	jmp    8014bd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014bb:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8014bd:	89 d8                	mov    %ebx,%eax
+  8014bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c2:	5b                   	pop    %ebx
+  8014c3:	5e                   	pop    %esi
+  8014c4:	5f                   	pop    %edi
+  8014c5:	5d                   	pop    %ebp
+  8014c6:	c3                   	ret
+
+008014c7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014c7:	55                   	push   %ebp
+  8014c8:	89 e5                	mov    %esp,%ebp
+  8014ca:	56                   	push   %esi
+  8014cb:	53                   	push   %ebx
+  8014cc:	83 ec 18             	sub    $0x18,%esp
+  8014cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014d2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014d5:	50                   	push   %eax
+  8014d6:	53                   	push   %ebx
+  8014d7:	e8 b7 fc ff ff       	call   801193 <fd_lookup>
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	78 37                	js     80151a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014e3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014e6:	83 ec 08             	sub    $0x8,%esp
+  8014e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014ec:	50                   	push   %eax
+  8014ed:	ff 36                	push   (%esi)
+  8014ef:	e8 ef fc ff ff       	call   8011e3 <dev_lookup>
+  8014f4:	83 c4 10             	add    $0x10,%esp
+  8014f7:	85 c0                	test   %eax,%eax
+  8014f9:	78 1f                	js     80151a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014fb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014ff:	74 20                	je     801521 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801501:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801504:	8b 40 0c             	mov    0xc(%eax),%eax
+  801507:	85 c0                	test   %eax,%eax
+  801509:	74 37                	je     801542 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80150b:	83 ec 04             	sub    $0x4,%esp
+  80150e:	ff 75 10             	push   0x10(%ebp)
+  801511:	ff 75 0c             	push   0xc(%ebp)
+  801514:	56                   	push   %esi
+  801515:	ff d0                	call   *%eax
+  801517:	83 c4 10             	add    $0x10,%esp
+}
+  80151a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80151d:	5b                   	pop    %ebx
+  80151e:	5e                   	pop    %esi
+  80151f:	5d                   	pop    %ebp
+  801520:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801521:	a1 08 40 80 00       	mov    0x804008,%eax
+  801526:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801529:	83 ec 04             	sub    $0x4,%esp
+  80152c:	53                   	push   %ebx
+  80152d:	50                   	push   %eax
+  80152e:	68 09 2c 80 00       	push   $0x802c09
+  801533:	e8 cd ec ff ff       	call   800205 <cprintf>
+		return -E_INVAL;
+  801538:	83 c4 10             	add    $0x10,%esp
+  80153b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801540:	eb d8                	jmp    80151a <write+0x53>
+		return -E_NOT_SUPP;
+  801542:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801547:	eb d1                	jmp    80151a <write+0x53>
+
+00801549 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801549:	55                   	push   %ebp
+  80154a:	89 e5                	mov    %esp,%ebp
+  80154c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80154f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801552:	50                   	push   %eax
+  801553:	ff 75 08             	push   0x8(%ebp)
+  801556:	e8 38 fc ff ff       	call   801193 <fd_lookup>
+  80155b:	83 c4 10             	add    $0x10,%esp
+  80155e:	85 c0                	test   %eax,%eax
+  801560:	78 0e                	js     801570 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801562:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801565:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801568:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80156b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801570:	c9                   	leave
+  801571:	c3                   	ret
+
+00801572 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801572:	55                   	push   %ebp
+  801573:	89 e5                	mov    %esp,%ebp
+  801575:	56                   	push   %esi
+  801576:	53                   	push   %ebx
+  801577:	83 ec 18             	sub    $0x18,%esp
+  80157a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80157d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801580:	50                   	push   %eax
+  801581:	53                   	push   %ebx
+  801582:	e8 0c fc ff ff       	call   801193 <fd_lookup>
+  801587:	83 c4 10             	add    $0x10,%esp
+  80158a:	85 c0                	test   %eax,%eax
+  80158c:	78 34                	js     8015c2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80158e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801591:	83 ec 08             	sub    $0x8,%esp
+  801594:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801597:	50                   	push   %eax
+  801598:	ff 36                	push   (%esi)
+  80159a:	e8 44 fc ff ff       	call   8011e3 <dev_lookup>
+  80159f:	83 c4 10             	add    $0x10,%esp
+  8015a2:	85 c0                	test   %eax,%eax
+  8015a4:	78 1c                	js     8015c2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015a6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015aa:	74 1d                	je     8015c9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8015ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015af:	8b 40 18             	mov    0x18(%eax),%eax
+  8015b2:	85 c0                	test   %eax,%eax
+  8015b4:	74 34                	je     8015ea <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8015b6:	83 ec 08             	sub    $0x8,%esp
+  8015b9:	ff 75 0c             	push   0xc(%ebp)
+  8015bc:	56                   	push   %esi
+  8015bd:	ff d0                	call   *%eax
+  8015bf:	83 c4 10             	add    $0x10,%esp
+}
+  8015c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c5:	5b                   	pop    %ebx
+  8015c6:	5e                   	pop    %esi
+  8015c7:	5d                   	pop    %ebp
+  8015c8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015c9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8015ce:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015d1:	83 ec 04             	sub    $0x4,%esp
+  8015d4:	53                   	push   %ebx
+  8015d5:	50                   	push   %eax
+  8015d6:	68 cc 2b 80 00       	push   $0x802bcc
+  8015db:	e8 25 ec ff ff       	call   800205 <cprintf>
+		return -E_INVAL;
+  8015e0:	83 c4 10             	add    $0x10,%esp
+  8015e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e8:	eb d8                	jmp    8015c2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015ef:	eb d1                	jmp    8015c2 <ftruncate+0x50>
+
+008015f1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015f1:	55                   	push   %ebp
+  8015f2:	89 e5                	mov    %esp,%ebp
+  8015f4:	56                   	push   %esi
+  8015f5:	53                   	push   %ebx
+  8015f6:	83 ec 18             	sub    $0x18,%esp
+  8015f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015fc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015ff:	50                   	push   %eax
+  801600:	ff 75 08             	push   0x8(%ebp)
+  801603:	e8 8b fb ff ff       	call   801193 <fd_lookup>
+  801608:	83 c4 10             	add    $0x10,%esp
+  80160b:	85 c0                	test   %eax,%eax
+  80160d:	78 49                	js     801658 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80160f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801612:	83 ec 08             	sub    $0x8,%esp
+  801615:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801618:	50                   	push   %eax
+  801619:	ff 36                	push   (%esi)
+  80161b:	e8 c3 fb ff ff       	call   8011e3 <dev_lookup>
+  801620:	83 c4 10             	add    $0x10,%esp
+  801623:	85 c0                	test   %eax,%eax
+  801625:	78 31                	js     801658 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801627:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80162a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80162e:	74 2f                	je     80165f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801630:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801633:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80163a:	00 00 00 
+	stat->st_isdir = 0;
+  80163d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801644:	00 00 00 
+	stat->st_dev = dev;
+  801647:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80164d:	83 ec 08             	sub    $0x8,%esp
+  801650:	53                   	push   %ebx
+  801651:	56                   	push   %esi
+  801652:	ff 50 14             	call   *0x14(%eax)
+  801655:	83 c4 10             	add    $0x10,%esp
+}
+  801658:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80165b:	5b                   	pop    %ebx
+  80165c:	5e                   	pop    %esi
+  80165d:	5d                   	pop    %ebp
+  80165e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80165f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801664:	eb f2                	jmp    801658 <fstat+0x67>
+
+00801666 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801666:	55                   	push   %ebp
+  801667:	89 e5                	mov    %esp,%ebp
+  801669:	56                   	push   %esi
+  80166a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80166b:	83 ec 08             	sub    $0x8,%esp
+  80166e:	6a 00                	push   $0x0
+  801670:	ff 75 08             	push   0x8(%ebp)
+  801673:	e8 e4 01 00 00       	call   80185c <open>
+  801678:	89 c3                	mov    %eax,%ebx
+  80167a:	83 c4 10             	add    $0x10,%esp
+  80167d:	85 c0                	test   %eax,%eax
+  80167f:	78 1b                	js     80169c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801681:	83 ec 08             	sub    $0x8,%esp
+  801684:	ff 75 0c             	push   0xc(%ebp)
+  801687:	50                   	push   %eax
+  801688:	e8 64 ff ff ff       	call   8015f1 <fstat>
+  80168d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80168f:	89 1c 24             	mov    %ebx,(%esp)
+  801692:	e8 26 fc ff ff       	call   8012bd <close>
+	return r;
+  801697:	83 c4 10             	add    $0x10,%esp
+  80169a:	89 f3                	mov    %esi,%ebx
+}
+  80169c:	89 d8                	mov    %ebx,%eax
+  80169e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016a1:	5b                   	pop    %ebx
+  8016a2:	5e                   	pop    %esi
+  8016a3:	5d                   	pop    %ebp
+  8016a4:	c3                   	ret
+
+008016a5 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8016a5:	55                   	push   %ebp
+  8016a6:	89 e5                	mov    %esp,%ebp
+  8016a8:	56                   	push   %esi
+  8016a9:	53                   	push   %ebx
+  8016aa:	89 c6                	mov    %eax,%esi
+  8016ac:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8016ae:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8016b5:	74 27                	je     8016de <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016b7:	6a 07                	push   $0x7
+  8016b9:	68 00 50 80 00       	push   $0x805000
+  8016be:	56                   	push   %esi
+  8016bf:	ff 35 00 40 80 00    	push   0x804000
+  8016c5:	e8 d5 0b 00 00       	call   80229f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8016ca:	83 c4 0c             	add    $0xc,%esp
+  8016cd:	6a 00                	push   $0x0
+  8016cf:	53                   	push   %ebx
+  8016d0:	6a 00                	push   $0x0
+  8016d2:	e8 50 0b 00 00       	call   802227 <ipc_recv>
+}
+  8016d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016da:	5b                   	pop    %ebx
+  8016db:	5e                   	pop    %esi
+  8016dc:	5d                   	pop    %ebp
+  8016dd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016de:	83 ec 0c             	sub    $0xc,%esp
+  8016e1:	6a 01                	push   $0x1
+  8016e3:	e8 0b 0c 00 00       	call   8022f3 <ipc_find_env>
+  8016e8:	a3 00 40 80 00       	mov    %eax,0x804000
+  8016ed:	83 c4 10             	add    $0x10,%esp
+  8016f0:	eb c5                	jmp    8016b7 <fsipc+0x12>
+
+008016f2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8016f2:	55                   	push   %ebp
+  8016f3:	89 e5                	mov    %esp,%ebp
+  8016f5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8016f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016fb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016fe:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  801703:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801706:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80170b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801710:	b8 02 00 00 00       	mov    $0x2,%eax
+  801715:	e8 8b ff ff ff       	call   8016a5 <fsipc>
+}
+  80171a:	c9                   	leave
+  80171b:	c3                   	ret
+
+0080171c <devfile_flush>:
+{
+  80171c:	55                   	push   %ebp
+  80171d:	89 e5                	mov    %esp,%ebp
+  80171f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801722:	8b 45 08             	mov    0x8(%ebp),%eax
+  801725:	8b 40 0c             	mov    0xc(%eax),%eax
+  801728:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80172d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801732:	b8 06 00 00 00       	mov    $0x6,%eax
+  801737:	e8 69 ff ff ff       	call   8016a5 <fsipc>
+}
+  80173c:	c9                   	leave
+  80173d:	c3                   	ret
+
+0080173e <devfile_stat>:
+{
+  80173e:	55                   	push   %ebp
+  80173f:	89 e5                	mov    %esp,%ebp
+  801741:	53                   	push   %ebx
+  801742:	83 ec 04             	sub    $0x4,%esp
+  801745:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801748:	8b 45 08             	mov    0x8(%ebp),%eax
+  80174b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80174e:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801753:	ba 00 00 00 00       	mov    $0x0,%edx
+  801758:	b8 05 00 00 00       	mov    $0x5,%eax
+  80175d:	e8 43 ff ff ff       	call   8016a5 <fsipc>
+  801762:	85 c0                	test   %eax,%eax
+  801764:	78 2c                	js     801792 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801766:	83 ec 08             	sub    $0x8,%esp
+  801769:	68 00 50 80 00       	push   $0x805000
+  80176e:	53                   	push   %ebx
+  80176f:	e8 7f f0 ff ff       	call   8007f3 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801774:	a1 80 50 80 00       	mov    0x805080,%eax
+  801779:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80177f:	a1 84 50 80 00       	mov    0x805084,%eax
+  801784:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801792:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801795:	c9                   	leave
+  801796:	c3                   	ret
+
+00801797 <devfile_write>:
+{
+  801797:	55                   	push   %ebp
+  801798:	89 e5                	mov    %esp,%ebp
+  80179a:	83 ec 0c             	sub    $0xc,%esp
+  80179d:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8017a0:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8017a5:	39 d0                	cmp    %edx,%eax
+  8017a7:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8017aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ad:	8b 52 0c             	mov    0xc(%edx),%edx
+  8017b0:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  8017b6:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8017bb:	50                   	push   %eax
+  8017bc:	ff 75 0c             	push   0xc(%ebp)
+  8017bf:	68 08 50 80 00       	push   $0x805008
+  8017c4:	e8 b0 f1 ff ff       	call   800979 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8017c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ce:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017d3:	e8 cd fe ff ff       	call   8016a5 <fsipc>
+}
+  8017d8:	c9                   	leave
+  8017d9:	c3                   	ret
+
+008017da <devfile_read>:
+{
+  8017da:	55                   	push   %ebp
+  8017db:	89 e5                	mov    %esp,%ebp
+  8017dd:	56                   	push   %esi
+  8017de:	53                   	push   %ebx
+  8017df:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8017e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017e8:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  8017ed:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8017f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8017fd:	e8 a3 fe ff ff       	call   8016a5 <fsipc>
+  801802:	89 c3                	mov    %eax,%ebx
+  801804:	85 c0                	test   %eax,%eax
+  801806:	78 1f                	js     801827 <devfile_read+0x4d>
+	assert(r <= n);
+  801808:	39 c6                	cmp    %eax,%esi
+  80180a:	72 24                	jb     801830 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80180c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801811:	7f 33                	jg     801846 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801813:	83 ec 04             	sub    $0x4,%esp
+  801816:	50                   	push   %eax
+  801817:	68 00 50 80 00       	push   $0x805000
+  80181c:	ff 75 0c             	push   0xc(%ebp)
+  80181f:	e8 55 f1 ff ff       	call   800979 <memmove>
+	return r;
+  801824:	83 c4 10             	add    $0x10,%esp
+}
+  801827:	89 d8                	mov    %ebx,%eax
+  801829:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182c:	5b                   	pop    %ebx
+  80182d:	5e                   	pop    %esi
+  80182e:	5d                   	pop    %ebp
+  80182f:	c3                   	ret
+	assert(r <= n);
+  801830:	68 3c 2c 80 00       	push   $0x802c3c
+  801835:	68 43 2c 80 00       	push   $0x802c43
+  80183a:	6a 7c                	push   $0x7c
+  80183c:	68 58 2c 80 00       	push   $0x802c58
+  801841:	e8 e4 e8 ff ff       	call   80012a <_panic>
+	assert(r <= PGSIZE);
+  801846:	68 63 2c 80 00       	push   $0x802c63
+  80184b:	68 43 2c 80 00       	push   $0x802c43
+  801850:	6a 7d                	push   $0x7d
+  801852:	68 58 2c 80 00       	push   $0x802c58
+  801857:	e8 ce e8 ff ff       	call   80012a <_panic>
+
+0080185c <open>:
+{
+  80185c:	55                   	push   %ebp
+  80185d:	89 e5                	mov    %esp,%ebp
+  80185f:	56                   	push   %esi
+  801860:	53                   	push   %ebx
+  801861:	83 ec 1c             	sub    $0x1c,%esp
+  801864:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801867:	56                   	push   %esi
+  801868:	e8 4b ef ff ff       	call   8007b8 <strlen>
+  80186d:	83 c4 10             	add    $0x10,%esp
+  801870:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801875:	7f 6c                	jg     8018e3 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801877:	83 ec 0c             	sub    $0xc,%esp
+  80187a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80187d:	50                   	push   %eax
+  80187e:	e8 ba f8 ff ff       	call   80113d <fd_alloc>
+  801883:	89 c3                	mov    %eax,%ebx
+  801885:	83 c4 10             	add    $0x10,%esp
+  801888:	85 c0                	test   %eax,%eax
+  80188a:	78 3c                	js     8018c8 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80188c:	83 ec 08             	sub    $0x8,%esp
+  80188f:	56                   	push   %esi
+  801890:	68 00 50 80 00       	push   $0x805000
+  801895:	e8 59 ef ff ff       	call   8007f3 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80189a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80189d:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8018a2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8018a5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018aa:	e8 f6 fd ff ff       	call   8016a5 <fsipc>
+  8018af:	89 c3                	mov    %eax,%ebx
+  8018b1:	83 c4 10             	add    $0x10,%esp
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	78 19                	js     8018d1 <open+0x75>
+	return fd2num(fd);
+  8018b8:	83 ec 0c             	sub    $0xc,%esp
+  8018bb:	ff 75 f4             	push   -0xc(%ebp)
+  8018be:	e8 53 f8 ff ff       	call   801116 <fd2num>
+  8018c3:	89 c3                	mov    %eax,%ebx
+  8018c5:	83 c4 10             	add    $0x10,%esp
+}
+  8018c8:	89 d8                	mov    %ebx,%eax
+  8018ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018cd:	5b                   	pop    %ebx
+  8018ce:	5e                   	pop    %esi
+  8018cf:	5d                   	pop    %ebp
+  8018d0:	c3                   	ret
+		fd_close(fd, 0);
+  8018d1:	83 ec 08             	sub    $0x8,%esp
+  8018d4:	6a 00                	push   $0x0
+  8018d6:	ff 75 f4             	push   -0xc(%ebp)
+  8018d9:	e8 58 f9 ff ff       	call   801236 <fd_close>
+		return r;
+  8018de:	83 c4 10             	add    $0x10,%esp
+  8018e1:	eb e5                	jmp    8018c8 <open+0x6c>
+		return -E_BAD_PATH;
+  8018e3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8018e8:	eb de                	jmp    8018c8 <open+0x6c>
+
+008018ea <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8018ea:	55                   	push   %ebp
+  8018eb:	89 e5                	mov    %esp,%ebp
+  8018ed:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8018f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018fa:	e8 a6 fd ff ff       	call   8016a5 <fsipc>
+}
+  8018ff:	c9                   	leave
+  801900:	c3                   	ret
+
+00801901 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801901:	55                   	push   %ebp
+  801902:	89 e5                	mov    %esp,%ebp
+  801904:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801907:	68 6f 2c 80 00       	push   $0x802c6f
+  80190c:	ff 75 0c             	push   0xc(%ebp)
+  80190f:	e8 df ee ff ff       	call   8007f3 <strcpy>
+	return 0;
+}
+  801914:	b8 00 00 00 00       	mov    $0x0,%eax
+  801919:	c9                   	leave
+  80191a:	c3                   	ret
+
+0080191b <devsock_close>:
+{
+  80191b:	55                   	push   %ebp
+  80191c:	89 e5                	mov    %esp,%ebp
+  80191e:	53                   	push   %ebx
+  80191f:	83 ec 10             	sub    $0x10,%esp
+  801922:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801925:	53                   	push   %ebx
+  801926:	e8 d8 09 00 00       	call   802303 <pageref>
+  80192b:	89 c2                	mov    %eax,%edx
+  80192d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801930:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801935:	83 fa 01             	cmp    $0x1,%edx
+  801938:	74 05                	je     80193f <devsock_close+0x24>
+}
+  80193a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80193d:	c9                   	leave
+  80193e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80193f:	83 ec 0c             	sub    $0xc,%esp
+  801942:	ff 73 0c             	push   0xc(%ebx)
+  801945:	e8 b7 02 00 00       	call   801c01 <nsipc_close>
+  80194a:	83 c4 10             	add    $0x10,%esp
+  80194d:	eb eb                	jmp    80193a <devsock_close+0x1f>
+
+0080194f <devsock_write>:
+{
+  80194f:	55                   	push   %ebp
+  801950:	89 e5                	mov    %esp,%ebp
+  801952:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801955:	6a 00                	push   $0x0
+  801957:	ff 75 10             	push   0x10(%ebp)
+  80195a:	ff 75 0c             	push   0xc(%ebp)
+  80195d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801960:	ff 70 0c             	push   0xc(%eax)
+  801963:	e8 79 03 00 00       	call   801ce1 <nsipc_send>
+}
+  801968:	c9                   	leave
+  801969:	c3                   	ret
+
+0080196a <devsock_read>:
+{
+  80196a:	55                   	push   %ebp
+  80196b:	89 e5                	mov    %esp,%ebp
+  80196d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801970:	6a 00                	push   $0x0
+  801972:	ff 75 10             	push   0x10(%ebp)
+  801975:	ff 75 0c             	push   0xc(%ebp)
+  801978:	8b 45 08             	mov    0x8(%ebp),%eax
+  80197b:	ff 70 0c             	push   0xc(%eax)
+  80197e:	e8 ef 02 00 00       	call   801c72 <nsipc_recv>
+}
+  801983:	c9                   	leave
+  801984:	c3                   	ret
+
+00801985 <fd2sockid>:
+{
+  801985:	55                   	push   %ebp
+  801986:	89 e5                	mov    %esp,%ebp
+  801988:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80198b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80198e:	52                   	push   %edx
+  80198f:	50                   	push   %eax
+  801990:	e8 fe f7 ff ff       	call   801193 <fd_lookup>
+  801995:	83 c4 10             	add    $0x10,%esp
+  801998:	85 c0                	test   %eax,%eax
+  80199a:	78 10                	js     8019ac <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80199c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80199f:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  8019a5:	39 08                	cmp    %ecx,(%eax)
+  8019a7:	75 05                	jne    8019ae <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8019a9:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8019ac:	c9                   	leave
+  8019ad:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019ae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019b3:	eb f7                	jmp    8019ac <fd2sockid+0x27>
+
+008019b5 <alloc_sockfd>:
+{
+  8019b5:	55                   	push   %ebp
+  8019b6:	89 e5                	mov    %esp,%ebp
+  8019b8:	56                   	push   %esi
+  8019b9:	53                   	push   %ebx
+  8019ba:	83 ec 1c             	sub    $0x1c,%esp
+  8019bd:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8019bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019c2:	50                   	push   %eax
+  8019c3:	e8 75 f7 ff ff       	call   80113d <fd_alloc>
+  8019c8:	89 c3                	mov    %eax,%ebx
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	78 43                	js     801a14 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8019d1:	83 ec 04             	sub    $0x4,%esp
+  8019d4:	68 07 04 00 00       	push   $0x407
+  8019d9:	ff 75 f4             	push   -0xc(%ebp)
+  8019dc:	6a 00                	push   $0x0
+  8019de:	e8 7d f2 ff ff       	call   800c60 <sys_page_alloc>
+  8019e3:	89 c3                	mov    %eax,%ebx
+  8019e5:	83 c4 10             	add    $0x10,%esp
+  8019e8:	85 c0                	test   %eax,%eax
+  8019ea:	78 28                	js     801a14 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8019ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019ef:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8019f5:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8019f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019fa:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801a01:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801a04:	83 ec 0c             	sub    $0xc,%esp
+  801a07:	50                   	push   %eax
+  801a08:	e8 09 f7 ff ff       	call   801116 <fd2num>
+  801a0d:	89 c3                	mov    %eax,%ebx
+  801a0f:	83 c4 10             	add    $0x10,%esp
+  801a12:	eb 0c                	jmp    801a20 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801a14:	83 ec 0c             	sub    $0xc,%esp
+  801a17:	56                   	push   %esi
+  801a18:	e8 e4 01 00 00       	call   801c01 <nsipc_close>
+		return r;
+  801a1d:	83 c4 10             	add    $0x10,%esp
+}
+  801a20:	89 d8                	mov    %ebx,%eax
+  801a22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a25:	5b                   	pop    %ebx
+  801a26:	5e                   	pop    %esi
+  801a27:	5d                   	pop    %ebp
+  801a28:	c3                   	ret
+
+00801a29 <accept>:
+{
+  801a29:	55                   	push   %ebp
+  801a2a:	89 e5                	mov    %esp,%ebp
+  801a2c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a32:	e8 4e ff ff ff       	call   801985 <fd2sockid>
+  801a37:	85 c0                	test   %eax,%eax
+  801a39:	78 1b                	js     801a56 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801a3b:	83 ec 04             	sub    $0x4,%esp
+  801a3e:	ff 75 10             	push   0x10(%ebp)
+  801a41:	ff 75 0c             	push   0xc(%ebp)
+  801a44:	50                   	push   %eax
+  801a45:	e8 0e 01 00 00       	call   801b58 <nsipc_accept>
+  801a4a:	83 c4 10             	add    $0x10,%esp
+  801a4d:	85 c0                	test   %eax,%eax
+  801a4f:	78 05                	js     801a56 <accept+0x2d>
+	return alloc_sockfd(r);
+  801a51:	e8 5f ff ff ff       	call   8019b5 <alloc_sockfd>
+}
+  801a56:	c9                   	leave
+  801a57:	c3                   	ret
+
+00801a58 <bind>:
+{
+  801a58:	55                   	push   %ebp
+  801a59:	89 e5                	mov    %esp,%ebp
+  801a5b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a61:	e8 1f ff ff ff       	call   801985 <fd2sockid>
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	78 12                	js     801a7c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801a6a:	83 ec 04             	sub    $0x4,%esp
+  801a6d:	ff 75 10             	push   0x10(%ebp)
+  801a70:	ff 75 0c             	push   0xc(%ebp)
+  801a73:	50                   	push   %eax
+  801a74:	e8 31 01 00 00       	call   801baa <nsipc_bind>
+  801a79:	83 c4 10             	add    $0x10,%esp
+}
+  801a7c:	c9                   	leave
+  801a7d:	c3                   	ret
+
+00801a7e <shutdown>:
+{
+  801a7e:	55                   	push   %ebp
+  801a7f:	89 e5                	mov    %esp,%ebp
+  801a81:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a87:	e8 f9 fe ff ff       	call   801985 <fd2sockid>
+  801a8c:	85 c0                	test   %eax,%eax
+  801a8e:	78 0f                	js     801a9f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801a90:	83 ec 08             	sub    $0x8,%esp
+  801a93:	ff 75 0c             	push   0xc(%ebp)
+  801a96:	50                   	push   %eax
+  801a97:	e8 43 01 00 00       	call   801bdf <nsipc_shutdown>
+  801a9c:	83 c4 10             	add    $0x10,%esp
+}
+  801a9f:	c9                   	leave
+  801aa0:	c3                   	ret
+
+00801aa1 <connect>:
+{
+  801aa1:	55                   	push   %ebp
+  801aa2:	89 e5                	mov    %esp,%ebp
+  801aa4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801aa7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aaa:	e8 d6 fe ff ff       	call   801985 <fd2sockid>
+  801aaf:	85 c0                	test   %eax,%eax
+  801ab1:	78 12                	js     801ac5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ab3:	83 ec 04             	sub    $0x4,%esp
+  801ab6:	ff 75 10             	push   0x10(%ebp)
+  801ab9:	ff 75 0c             	push   0xc(%ebp)
+  801abc:	50                   	push   %eax
+  801abd:	e8 59 01 00 00       	call   801c1b <nsipc_connect>
+  801ac2:	83 c4 10             	add    $0x10,%esp
+}
+  801ac5:	c9                   	leave
+  801ac6:	c3                   	ret
+
+00801ac7 <listen>:
+{
+  801ac7:	55                   	push   %ebp
+  801ac8:	89 e5                	mov    %esp,%ebp
+  801aca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801acd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad0:	e8 b0 fe ff ff       	call   801985 <fd2sockid>
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	78 0f                	js     801ae8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801ad9:	83 ec 08             	sub    $0x8,%esp
+  801adc:	ff 75 0c             	push   0xc(%ebp)
+  801adf:	50                   	push   %eax
+  801ae0:	e8 6b 01 00 00       	call   801c50 <nsipc_listen>
+  801ae5:	83 c4 10             	add    $0x10,%esp
+}
+  801ae8:	c9                   	leave
+  801ae9:	c3                   	ret
+
+00801aea <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801aea:	55                   	push   %ebp
+  801aeb:	89 e5                	mov    %esp,%ebp
+  801aed:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801af0:	ff 75 10             	push   0x10(%ebp)
+  801af3:	ff 75 0c             	push   0xc(%ebp)
+  801af6:	ff 75 08             	push   0x8(%ebp)
+  801af9:	e8 41 02 00 00       	call   801d3f <nsipc_socket>
+  801afe:	83 c4 10             	add    $0x10,%esp
+  801b01:	85 c0                	test   %eax,%eax
+  801b03:	78 05                	js     801b0a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801b05:	e8 ab fe ff ff       	call   8019b5 <alloc_sockfd>
+}
+  801b0a:	c9                   	leave
+  801b0b:	c3                   	ret
+
+00801b0c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801b0c:	55                   	push   %ebp
+  801b0d:	89 e5                	mov    %esp,%ebp
+  801b0f:	53                   	push   %ebx
+  801b10:	83 ec 04             	sub    $0x4,%esp
+  801b13:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801b15:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b1c:	74 26                	je     801b44 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801b1e:	6a 07                	push   $0x7
+  801b20:	68 00 60 80 00       	push   $0x806000
+  801b25:	53                   	push   %ebx
+  801b26:	ff 35 04 40 80 00    	push   0x804004
+  801b2c:	e8 6e 07 00 00       	call   80229f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801b31:	83 c4 0c             	add    $0xc,%esp
+  801b34:	6a 00                	push   $0x0
+  801b36:	6a 00                	push   $0x0
+  801b38:	6a 00                	push   $0x0
+  801b3a:	e8 e8 06 00 00       	call   802227 <ipc_recv>
+}
+  801b3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b42:	c9                   	leave
+  801b43:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801b44:	83 ec 0c             	sub    $0xc,%esp
+  801b47:	6a 02                	push   $0x2
+  801b49:	e8 a5 07 00 00       	call   8022f3 <ipc_find_env>
+  801b4e:	a3 04 40 80 00       	mov    %eax,0x804004
+  801b53:	83 c4 10             	add    $0x10,%esp
+  801b56:	eb c6                	jmp    801b1e <nsipc+0x12>
+
+00801b58 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801b58:	55                   	push   %ebp
+  801b59:	89 e5                	mov    %esp,%ebp
+  801b5b:	56                   	push   %esi
+  801b5c:	53                   	push   %ebx
+  801b5d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801b60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b63:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801b68:	8b 06                	mov    (%esi),%eax
+  801b6a:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801b6f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b74:	e8 93 ff ff ff       	call   801b0c <nsipc>
+  801b79:	89 c3                	mov    %eax,%ebx
+  801b7b:	85 c0                	test   %eax,%eax
+  801b7d:	79 09                	jns    801b88 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801b7f:	89 d8                	mov    %ebx,%eax
+  801b81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b84:	5b                   	pop    %ebx
+  801b85:	5e                   	pop    %esi
+  801b86:	5d                   	pop    %ebp
+  801b87:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801b88:	83 ec 04             	sub    $0x4,%esp
+  801b8b:	ff 35 10 60 80 00    	push   0x806010
+  801b91:	68 00 60 80 00       	push   $0x806000
+  801b96:	ff 75 0c             	push   0xc(%ebp)
+  801b99:	e8 db ed ff ff       	call   800979 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801b9e:	a1 10 60 80 00       	mov    0x806010,%eax
+  801ba3:	89 06                	mov    %eax,(%esi)
+  801ba5:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ba8:	eb d5                	jmp    801b7f <nsipc_accept+0x27>
+
+00801baa <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801baa:	55                   	push   %ebp
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	53                   	push   %ebx
+  801bae:	83 ec 08             	sub    $0x8,%esp
+  801bb1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801bb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb7:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801bbc:	53                   	push   %ebx
+  801bbd:	ff 75 0c             	push   0xc(%ebp)
+  801bc0:	68 04 60 80 00       	push   $0x806004
+  801bc5:	e8 af ed ff ff       	call   800979 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801bca:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801bd0:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bd5:	e8 32 ff ff ff       	call   801b0c <nsipc>
+}
+  801bda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bdd:	c9                   	leave
+  801bde:	c3                   	ret
+
+00801bdf <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801bdf:	55                   	push   %ebp
+  801be0:	89 e5                	mov    %esp,%ebp
+  801be2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801be5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be8:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801bed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bf0:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801bf5:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bfa:	e8 0d ff ff ff       	call   801b0c <nsipc>
+}
+  801bff:	c9                   	leave
+  801c00:	c3                   	ret
+
+00801c01 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801c01:	55                   	push   %ebp
+  801c02:	89 e5                	mov    %esp,%ebp
+  801c04:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801c07:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c0a:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801c0f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c14:	e8 f3 fe ff ff       	call   801b0c <nsipc>
+}
+  801c19:	c9                   	leave
+  801c1a:	c3                   	ret
+
+00801c1b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801c1b:	55                   	push   %ebp
+  801c1c:	89 e5                	mov    %esp,%ebp
+  801c1e:	53                   	push   %ebx
+  801c1f:	83 ec 08             	sub    $0x8,%esp
+  801c22:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801c25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c28:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801c2d:	53                   	push   %ebx
+  801c2e:	ff 75 0c             	push   0xc(%ebp)
+  801c31:	68 04 60 80 00       	push   $0x806004
+  801c36:	e8 3e ed ff ff       	call   800979 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801c3b:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801c41:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c46:	e8 c1 fe ff ff       	call   801b0c <nsipc>
+}
+  801c4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c4e:	c9                   	leave
+  801c4f:	c3                   	ret
+
+00801c50 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801c50:	55                   	push   %ebp
+  801c51:	89 e5                	mov    %esp,%ebp
+  801c53:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801c56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c59:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801c5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c61:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801c66:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c6b:	e8 9c fe ff ff       	call   801b0c <nsipc>
+}
+  801c70:	c9                   	leave
+  801c71:	c3                   	ret
+
+00801c72 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801c72:	55                   	push   %ebp
+  801c73:	89 e5                	mov    %esp,%ebp
+  801c75:	56                   	push   %esi
+  801c76:	53                   	push   %ebx
+  801c77:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801c7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7d:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801c82:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801c88:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c8b:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801c90:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c95:	e8 72 fe ff ff       	call   801b0c <nsipc>
+  801c9a:	89 c3                	mov    %eax,%ebx
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	78 22                	js     801cc2 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801ca0:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801ca5:	39 c6                	cmp    %eax,%esi
+  801ca7:	0f 4e c6             	cmovle %esi,%eax
+  801caa:	39 c3                	cmp    %eax,%ebx
+  801cac:	7f 1d                	jg     801ccb <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801cae:	83 ec 04             	sub    $0x4,%esp
+  801cb1:	53                   	push   %ebx
+  801cb2:	68 00 60 80 00       	push   $0x806000
+  801cb7:	ff 75 0c             	push   0xc(%ebp)
+  801cba:	e8 ba ec ff ff       	call   800979 <memmove>
+  801cbf:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801cc2:	89 d8                	mov    %ebx,%eax
+  801cc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cc7:	5b                   	pop    %ebx
+  801cc8:	5e                   	pop    %esi
+  801cc9:	5d                   	pop    %ebp
+  801cca:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801ccb:	68 7b 2c 80 00       	push   $0x802c7b
+  801cd0:	68 43 2c 80 00       	push   $0x802c43
+  801cd5:	6a 62                	push   $0x62
+  801cd7:	68 90 2c 80 00       	push   $0x802c90
+  801cdc:	e8 49 e4 ff ff       	call   80012a <_panic>
+
+00801ce1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801ce1:	55                   	push   %ebp
+  801ce2:	89 e5                	mov    %esp,%ebp
+  801ce4:	53                   	push   %ebx
+  801ce5:	83 ec 04             	sub    $0x4,%esp
+  801ce8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ceb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cee:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801cf3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801cf9:	7f 2e                	jg     801d29 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801cfb:	83 ec 04             	sub    $0x4,%esp
+  801cfe:	53                   	push   %ebx
+  801cff:	ff 75 0c             	push   0xc(%ebp)
+  801d02:	68 0c 60 80 00       	push   $0x80600c
+  801d07:	e8 6d ec ff ff       	call   800979 <memmove>
+	nsipcbuf.send.req_size = size;
+  801d0c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801d12:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d15:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801d1a:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d1f:	e8 e8 fd ff ff       	call   801b0c <nsipc>
+}
+  801d24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d27:	c9                   	leave
+  801d28:	c3                   	ret
+	assert(size < 1600);
+  801d29:	68 9c 2c 80 00       	push   $0x802c9c
+  801d2e:	68 43 2c 80 00       	push   $0x802c43
+  801d33:	6a 6d                	push   $0x6d
+  801d35:	68 90 2c 80 00       	push   $0x802c90
+  801d3a:	e8 eb e3 ff ff       	call   80012a <_panic>
+
+00801d3f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801d3f:	55                   	push   %ebp
+  801d40:	89 e5                	mov    %esp,%ebp
+  801d42:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801d45:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d48:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801d4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d50:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801d55:	8b 45 10             	mov    0x10(%ebp),%eax
+  801d58:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801d5d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d62:	e8 a5 fd ff ff       	call   801b0c <nsipc>
+}
+  801d67:	c9                   	leave
+  801d68:	c3                   	ret
+
+00801d69 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d69:	55                   	push   %ebp
+  801d6a:	89 e5                	mov    %esp,%ebp
+  801d6c:	56                   	push   %esi
+  801d6d:	53                   	push   %ebx
+  801d6e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801d71:	83 ec 0c             	sub    $0xc,%esp
+  801d74:	ff 75 08             	push   0x8(%ebp)
+  801d77:	e8 aa f3 ff ff       	call   801126 <fd2data>
+  801d7c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801d7e:	83 c4 08             	add    $0x8,%esp
+  801d81:	68 a8 2c 80 00       	push   $0x802ca8
+  801d86:	53                   	push   %ebx
+  801d87:	e8 67 ea ff ff       	call   8007f3 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801d8c:	8b 46 04             	mov    0x4(%esi),%eax
+  801d8f:	2b 06                	sub    (%esi),%eax
+  801d91:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801d97:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d9e:	00 00 00 
+	stat->st_dev = &devpipe;
+  801da1:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801da8:	30 80 00 
+	return 0;
+}
+  801dab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801db3:	5b                   	pop    %ebx
+  801db4:	5e                   	pop    %esi
+  801db5:	5d                   	pop    %ebp
+  801db6:	c3                   	ret
+
+00801db7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801db7:	55                   	push   %ebp
+  801db8:	89 e5                	mov    %esp,%ebp
+  801dba:	53                   	push   %ebx
+  801dbb:	83 ec 0c             	sub    $0xc,%esp
+  801dbe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801dc1:	53                   	push   %ebx
+  801dc2:	6a 00                	push   $0x0
+  801dc4:	e8 5f ef ff ff       	call   800d28 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801dc9:	89 1c 24             	mov    %ebx,(%esp)
+  801dcc:	e8 55 f3 ff ff       	call   801126 <fd2data>
+  801dd1:	83 c4 08             	add    $0x8,%esp
+  801dd4:	50                   	push   %eax
+  801dd5:	6a 00                	push   $0x0
+  801dd7:	e8 4c ef ff ff       	call   800d28 <sys_page_unmap>
+}
+  801ddc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ddf:	c9                   	leave
+  801de0:	c3                   	ret
+
+00801de1 <_pipeisclosed>:
+{
+  801de1:	55                   	push   %ebp
+  801de2:	89 e5                	mov    %esp,%ebp
+  801de4:	57                   	push   %edi
+  801de5:	56                   	push   %esi
+  801de6:	53                   	push   %ebx
+  801de7:	83 ec 1c             	sub    $0x1c,%esp
+  801dea:	89 c7                	mov    %eax,%edi
+  801dec:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801dee:	a1 08 40 80 00       	mov    0x804008,%eax
+  801df3:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801df6:	83 ec 0c             	sub    $0xc,%esp
+  801df9:	57                   	push   %edi
+  801dfa:	e8 04 05 00 00       	call   802303 <pageref>
+  801dff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e02:	89 34 24             	mov    %esi,(%esp)
+  801e05:	e8 f9 04 00 00       	call   802303 <pageref>
+		nn = thisenv->env_runs;
+  801e0a:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801e10:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801e13:	83 c4 10             	add    $0x10,%esp
+  801e16:	39 cb                	cmp    %ecx,%ebx
+  801e18:	74 1b                	je     801e35 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801e1a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e1d:	75 cf                	jne    801dee <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801e1f:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801e22:	6a 01                	push   $0x1
+  801e24:	50                   	push   %eax
+  801e25:	53                   	push   %ebx
+  801e26:	68 af 2c 80 00       	push   $0x802caf
+  801e2b:	e8 d5 e3 ff ff       	call   800205 <cprintf>
+  801e30:	83 c4 10             	add    $0x10,%esp
+  801e33:	eb b9                	jmp    801dee <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801e35:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e38:	0f 94 c0             	sete   %al
+  801e3b:	0f b6 c0             	movzbl %al,%eax
+}
+  801e3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e41:	5b                   	pop    %ebx
+  801e42:	5e                   	pop    %esi
+  801e43:	5f                   	pop    %edi
+  801e44:	5d                   	pop    %ebp
+  801e45:	c3                   	ret
+
+00801e46 <devpipe_write>:
+{
+  801e46:	55                   	push   %ebp
+  801e47:	89 e5                	mov    %esp,%ebp
+  801e49:	57                   	push   %edi
+  801e4a:	56                   	push   %esi
+  801e4b:	53                   	push   %ebx
+  801e4c:	83 ec 28             	sub    $0x28,%esp
+  801e4f:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801e52:	56                   	push   %esi
+  801e53:	e8 ce f2 ff ff       	call   801126 <fd2data>
+  801e58:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801e5a:	83 c4 10             	add    $0x10,%esp
+  801e5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e62:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801e65:	75 09                	jne    801e70 <devpipe_write+0x2a>
+	return i;
+  801e67:	89 f8                	mov    %edi,%eax
+  801e69:	eb 23                	jmp    801e8e <devpipe_write+0x48>
+			sys_yield();
+  801e6b:	e8 70 ed ff ff       	call   800be0 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801e70:	8b 43 04             	mov    0x4(%ebx),%eax
+  801e73:	8b 0b                	mov    (%ebx),%ecx
+  801e75:	8d 51 20             	lea    0x20(%ecx),%edx
+  801e78:	39 d0                	cmp    %edx,%eax
+  801e7a:	72 1a                	jb     801e96 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801e7c:	89 da                	mov    %ebx,%edx
+  801e7e:	89 f0                	mov    %esi,%eax
+  801e80:	e8 5c ff ff ff       	call   801de1 <_pipeisclosed>
+  801e85:	85 c0                	test   %eax,%eax
+  801e87:	74 e2                	je     801e6b <devpipe_write+0x25>
+				return 0;
+  801e89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e91:	5b                   	pop    %ebx
+  801e92:	5e                   	pop    %esi
+  801e93:	5f                   	pop    %edi
+  801e94:	5d                   	pop    %ebp
+  801e95:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801e96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e99:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801e9d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801ea0:	89 c2                	mov    %eax,%edx
+  801ea2:	c1 fa 1f             	sar    $0x1f,%edx
+  801ea5:	89 d1                	mov    %edx,%ecx
+  801ea7:	c1 e9 1b             	shr    $0x1b,%ecx
+  801eaa:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801ead:	83 e2 1f             	and    $0x1f,%edx
+  801eb0:	29 ca                	sub    %ecx,%edx
+  801eb2:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801eb6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801eba:	83 c0 01             	add    $0x1,%eax
+  801ebd:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801ec0:	83 c7 01             	add    $0x1,%edi
+  801ec3:	eb 9d                	jmp    801e62 <devpipe_write+0x1c>
+
+00801ec5 <devpipe_read>:
+{
+  801ec5:	55                   	push   %ebp
+  801ec6:	89 e5                	mov    %esp,%ebp
+  801ec8:	57                   	push   %edi
+  801ec9:	56                   	push   %esi
+  801eca:	53                   	push   %ebx
+  801ecb:	83 ec 18             	sub    $0x18,%esp
+  801ece:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801ed1:	57                   	push   %edi
+  801ed2:	e8 4f f2 ff ff       	call   801126 <fd2data>
+  801ed7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801ed9:	83 c4 10             	add    $0x10,%esp
+  801edc:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801ee4:	75 13                	jne    801ef9 <devpipe_read+0x34>
+	return i;
+  801ee6:	89 f0                	mov    %esi,%eax
+  801ee8:	eb 02                	jmp    801eec <devpipe_read+0x27>
+				return i;
+  801eea:	89 f0                	mov    %esi,%eax
+}
+  801eec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eef:	5b                   	pop    %ebx
+  801ef0:	5e                   	pop    %esi
+  801ef1:	5f                   	pop    %edi
+  801ef2:	5d                   	pop    %ebp
+  801ef3:	c3                   	ret
+			sys_yield();
+  801ef4:	e8 e7 ec ff ff       	call   800be0 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801ef9:	8b 03                	mov    (%ebx),%eax
+  801efb:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801efe:	75 18                	jne    801f18 <devpipe_read+0x53>
+			if (i > 0)
+  801f00:	85 f6                	test   %esi,%esi
+  801f02:	75 e6                	jne    801eea <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801f04:	89 da                	mov    %ebx,%edx
+  801f06:	89 f8                	mov    %edi,%eax
+  801f08:	e8 d4 fe ff ff       	call   801de1 <_pipeisclosed>
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	74 e3                	je     801ef4 <devpipe_read+0x2f>
+				return 0;
+  801f11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f16:	eb d4                	jmp    801eec <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801f18:	99                   	cltd
+  801f19:	c1 ea 1b             	shr    $0x1b,%edx
+  801f1c:	01 d0                	add    %edx,%eax
+  801f1e:	83 e0 1f             	and    $0x1f,%eax
+  801f21:	29 d0                	sub    %edx,%eax
+  801f23:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801f28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f2b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801f2e:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801f31:	83 c6 01             	add    $0x1,%esi
+  801f34:	eb ab                	jmp    801ee1 <devpipe_read+0x1c>
+
+00801f36 <pipe>:
+{
+  801f36:	55                   	push   %ebp
+  801f37:	89 e5                	mov    %esp,%ebp
+  801f39:	56                   	push   %esi
+  801f3a:	53                   	push   %ebx
+  801f3b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801f3e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f41:	50                   	push   %eax
+  801f42:	e8 f6 f1 ff ff       	call   80113d <fd_alloc>
+  801f47:	89 c3                	mov    %eax,%ebx
+  801f49:	83 c4 10             	add    $0x10,%esp
+  801f4c:	85 c0                	test   %eax,%eax
+  801f4e:	0f 88 23 01 00 00    	js     802077 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f54:	83 ec 04             	sub    $0x4,%esp
+  801f57:	68 07 04 00 00       	push   $0x407
+  801f5c:	ff 75 f4             	push   -0xc(%ebp)
+  801f5f:	6a 00                	push   $0x0
+  801f61:	e8 fa ec ff ff       	call   800c60 <sys_page_alloc>
+  801f66:	89 c3                	mov    %eax,%ebx
+  801f68:	83 c4 10             	add    $0x10,%esp
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	0f 88 04 01 00 00    	js     802077 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801f73:	83 ec 0c             	sub    $0xc,%esp
+  801f76:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f79:	50                   	push   %eax
+  801f7a:	e8 be f1 ff ff       	call   80113d <fd_alloc>
+  801f7f:	89 c3                	mov    %eax,%ebx
+  801f81:	83 c4 10             	add    $0x10,%esp
+  801f84:	85 c0                	test   %eax,%eax
+  801f86:	0f 88 db 00 00 00    	js     802067 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f8c:	83 ec 04             	sub    $0x4,%esp
+  801f8f:	68 07 04 00 00       	push   $0x407
+  801f94:	ff 75 f0             	push   -0x10(%ebp)
+  801f97:	6a 00                	push   $0x0
+  801f99:	e8 c2 ec ff ff       	call   800c60 <sys_page_alloc>
+  801f9e:	89 c3                	mov    %eax,%ebx
+  801fa0:	83 c4 10             	add    $0x10,%esp
+  801fa3:	85 c0                	test   %eax,%eax
+  801fa5:	0f 88 bc 00 00 00    	js     802067 <pipe+0x131>
+	va = fd2data(fd0);
+  801fab:	83 ec 0c             	sub    $0xc,%esp
+  801fae:	ff 75 f4             	push   -0xc(%ebp)
+  801fb1:	e8 70 f1 ff ff       	call   801126 <fd2data>
+  801fb6:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fb8:	83 c4 0c             	add    $0xc,%esp
+  801fbb:	68 07 04 00 00       	push   $0x407
+  801fc0:	50                   	push   %eax
+  801fc1:	6a 00                	push   $0x0
+  801fc3:	e8 98 ec ff ff       	call   800c60 <sys_page_alloc>
+  801fc8:	89 c3                	mov    %eax,%ebx
+  801fca:	83 c4 10             	add    $0x10,%esp
+  801fcd:	85 c0                	test   %eax,%eax
+  801fcf:	0f 88 82 00 00 00    	js     802057 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fd5:	83 ec 0c             	sub    $0xc,%esp
+  801fd8:	ff 75 f0             	push   -0x10(%ebp)
+  801fdb:	e8 46 f1 ff ff       	call   801126 <fd2data>
+  801fe0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801fe7:	50                   	push   %eax
+  801fe8:	6a 00                	push   $0x0
+  801fea:	56                   	push   %esi
+  801feb:	6a 00                	push   $0x0
+  801fed:	e8 f4 ec ff ff       	call   800ce6 <sys_page_map>
+  801ff2:	89 c3                	mov    %eax,%ebx
+  801ff4:	83 c4 20             	add    $0x20,%esp
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	78 4e                	js     802049 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801ffb:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  802000:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802003:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802005:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802008:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80200f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802012:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802014:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802017:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80201e:	83 ec 0c             	sub    $0xc,%esp
+  802021:	ff 75 f4             	push   -0xc(%ebp)
+  802024:	e8 ed f0 ff ff       	call   801116 <fd2num>
+  802029:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80202c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80202e:	83 c4 04             	add    $0x4,%esp
+  802031:	ff 75 f0             	push   -0x10(%ebp)
+  802034:	e8 dd f0 ff ff       	call   801116 <fd2num>
+  802039:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80203c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80203f:	83 c4 10             	add    $0x10,%esp
+  802042:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802047:	eb 2e                	jmp    802077 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802049:	83 ec 08             	sub    $0x8,%esp
+  80204c:	56                   	push   %esi
+  80204d:	6a 00                	push   $0x0
+  80204f:	e8 d4 ec ff ff       	call   800d28 <sys_page_unmap>
+  802054:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802057:	83 ec 08             	sub    $0x8,%esp
+  80205a:	ff 75 f0             	push   -0x10(%ebp)
+  80205d:	6a 00                	push   $0x0
+  80205f:	e8 c4 ec ff ff       	call   800d28 <sys_page_unmap>
+  802064:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802067:	83 ec 08             	sub    $0x8,%esp
+  80206a:	ff 75 f4             	push   -0xc(%ebp)
+  80206d:	6a 00                	push   $0x0
+  80206f:	e8 b4 ec ff ff       	call   800d28 <sys_page_unmap>
+  802074:	83 c4 10             	add    $0x10,%esp
+}
+  802077:	89 d8                	mov    %ebx,%eax
+  802079:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80207c:	5b                   	pop    %ebx
+  80207d:	5e                   	pop    %esi
+  80207e:	5d                   	pop    %ebp
+  80207f:	c3                   	ret
+
+00802080 <pipeisclosed>:
+{
+  802080:	55                   	push   %ebp
+  802081:	89 e5                	mov    %esp,%ebp
+  802083:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802086:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802089:	50                   	push   %eax
+  80208a:	ff 75 08             	push   0x8(%ebp)
+  80208d:	e8 01 f1 ff ff       	call   801193 <fd_lookup>
+  802092:	83 c4 10             	add    $0x10,%esp
+  802095:	85 c0                	test   %eax,%eax
+  802097:	78 18                	js     8020b1 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802099:	83 ec 0c             	sub    $0xc,%esp
+  80209c:	ff 75 f4             	push   -0xc(%ebp)
+  80209f:	e8 82 f0 ff ff       	call   801126 <fd2data>
+  8020a4:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8020a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020a9:	e8 33 fd ff ff       	call   801de1 <_pipeisclosed>
+  8020ae:	83 c4 10             	add    $0x10,%esp
+}
+  8020b1:	c9                   	leave
+  8020b2:	c3                   	ret
+
+008020b3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8020b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b8:	c3                   	ret
+
+008020b9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020b9:	55                   	push   %ebp
+  8020ba:	89 e5                	mov    %esp,%ebp
+  8020bc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8020bf:	68 c7 2c 80 00       	push   $0x802cc7
+  8020c4:	ff 75 0c             	push   0xc(%ebp)
+  8020c7:	e8 27 e7 ff ff       	call   8007f3 <strcpy>
+	return 0;
+}
+  8020cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d1:	c9                   	leave
+  8020d2:	c3                   	ret
+
+008020d3 <devcons_write>:
+{
+  8020d3:	55                   	push   %ebp
+  8020d4:	89 e5                	mov    %esp,%ebp
+  8020d6:	57                   	push   %edi
+  8020d7:	56                   	push   %esi
+  8020d8:	53                   	push   %ebx
+  8020d9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8020df:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8020e4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8020ea:	eb 2e                	jmp    80211a <devcons_write+0x47>
+		m = n - tot;
+  8020ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020ef:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8020f1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8020f6:	39 c3                	cmp    %eax,%ebx
+  8020f8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8020fb:	83 ec 04             	sub    $0x4,%esp
+  8020fe:	53                   	push   %ebx
+  8020ff:	89 f0                	mov    %esi,%eax
+  802101:	03 45 0c             	add    0xc(%ebp),%eax
+  802104:	50                   	push   %eax
+  802105:	57                   	push   %edi
+  802106:	e8 6e e8 ff ff       	call   800979 <memmove>
+		sys_cputs(buf, m);
+  80210b:	83 c4 08             	add    $0x8,%esp
+  80210e:	53                   	push   %ebx
+  80210f:	57                   	push   %edi
+  802110:	e8 0e ea ff ff       	call   800b23 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802115:	01 de                	add    %ebx,%esi
+  802117:	83 c4 10             	add    $0x10,%esp
+  80211a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80211d:	72 cd                	jb     8020ec <devcons_write+0x19>
+}
+  80211f:	89 f0                	mov    %esi,%eax
+  802121:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802124:	5b                   	pop    %ebx
+  802125:	5e                   	pop    %esi
+  802126:	5f                   	pop    %edi
+  802127:	5d                   	pop    %ebp
+  802128:	c3                   	ret
+
+00802129 <devcons_read>:
+{
+  802129:	55                   	push   %ebp
+  80212a:	89 e5                	mov    %esp,%ebp
+  80212c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80212f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802134:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802138:	75 07                	jne    802141 <devcons_read+0x18>
+  80213a:	eb 1f                	jmp    80215b <devcons_read+0x32>
+		sys_yield();
+  80213c:	e8 9f ea ff ff       	call   800be0 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802141:	e8 fb e9 ff ff       	call   800b41 <sys_cgetc>
+  802146:	85 c0                	test   %eax,%eax
+  802148:	74 f2                	je     80213c <devcons_read+0x13>
+	if (c < 0)
+  80214a:	78 0f                	js     80215b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80214c:	83 f8 04             	cmp    $0x4,%eax
+  80214f:	74 0c                	je     80215d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802151:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802154:	88 02                	mov    %al,(%edx)
+	return 1;
+  802156:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80215b:	c9                   	leave
+  80215c:	c3                   	ret
+		return 0;
+  80215d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802162:	eb f7                	jmp    80215b <devcons_read+0x32>
+
+00802164 <cputchar>:
+{
+  802164:	55                   	push   %ebp
+  802165:	89 e5                	mov    %esp,%ebp
+  802167:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80216a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802170:	6a 01                	push   $0x1
+  802172:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802175:	50                   	push   %eax
+  802176:	e8 a8 e9 ff ff       	call   800b23 <sys_cputs>
+}
+  80217b:	83 c4 10             	add    $0x10,%esp
+  80217e:	c9                   	leave
+  80217f:	c3                   	ret
+
+00802180 <getchar>:
+{
+  802180:	55                   	push   %ebp
+  802181:	89 e5                	mov    %esp,%ebp
+  802183:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802186:	6a 01                	push   $0x1
+  802188:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80218b:	50                   	push   %eax
+  80218c:	6a 00                	push   $0x0
+  80218e:	e8 66 f2 ff ff       	call   8013f9 <read>
+	if (r < 0)
+  802193:	83 c4 10             	add    $0x10,%esp
+  802196:	85 c0                	test   %eax,%eax
+  802198:	78 06                	js     8021a0 <getchar+0x20>
+	if (r < 1)
+  80219a:	74 06                	je     8021a2 <getchar+0x22>
+	return c;
+  80219c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8021a0:	c9                   	leave
+  8021a1:	c3                   	ret
+		return -E_EOF;
+  8021a2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8021a7:	eb f7                	jmp    8021a0 <getchar+0x20>
+
+008021a9 <iscons>:
+{
+  8021a9:	55                   	push   %ebp
+  8021aa:	89 e5                	mov    %esp,%ebp
+  8021ac:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b2:	50                   	push   %eax
+  8021b3:	ff 75 08             	push   0x8(%ebp)
+  8021b6:	e8 d8 ef ff ff       	call   801193 <fd_lookup>
+  8021bb:	83 c4 10             	add    $0x10,%esp
+  8021be:	85 c0                	test   %eax,%eax
+  8021c0:	78 11                	js     8021d3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8021c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c5:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8021cb:	39 10                	cmp    %edx,(%eax)
+  8021cd:	0f 94 c0             	sete   %al
+  8021d0:	0f b6 c0             	movzbl %al,%eax
+}
+  8021d3:	c9                   	leave
+  8021d4:	c3                   	ret
+
+008021d5 <opencons>:
+{
+  8021d5:	55                   	push   %ebp
+  8021d6:	89 e5                	mov    %esp,%ebp
+  8021d8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8021db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021de:	50                   	push   %eax
+  8021df:	e8 59 ef ff ff       	call   80113d <fd_alloc>
+  8021e4:	83 c4 10             	add    $0x10,%esp
+  8021e7:	85 c0                	test   %eax,%eax
+  8021e9:	78 3a                	js     802225 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8021eb:	83 ec 04             	sub    $0x4,%esp
+  8021ee:	68 07 04 00 00       	push   $0x407
+  8021f3:	ff 75 f4             	push   -0xc(%ebp)
+  8021f6:	6a 00                	push   $0x0
+  8021f8:	e8 63 ea ff ff       	call   800c60 <sys_page_alloc>
+  8021fd:	83 c4 10             	add    $0x10,%esp
+  802200:	85 c0                	test   %eax,%eax
+  802202:	78 21                	js     802225 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802204:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802207:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80220d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80220f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802212:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802219:	83 ec 0c             	sub    $0xc,%esp
+  80221c:	50                   	push   %eax
+  80221d:	e8 f4 ee ff ff       	call   801116 <fd2num>
+  802222:	83 c4 10             	add    $0x10,%esp
+}
+  802225:	c9                   	leave
+  802226:	c3                   	ret
+
+00802227 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802227:	55                   	push   %ebp
+  802228:	89 e5                	mov    %esp,%ebp
+  80222a:	57                   	push   %edi
+  80222b:	56                   	push   %esi
+  80222c:	53                   	push   %ebx
+  80222d:	83 ec 18             	sub    $0x18,%esp
+  802230:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802233:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802236:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802239:	85 db                	test   %ebx,%ebx
+  80223b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802240:	0f 45 c3             	cmovne %ebx,%eax
+  802243:	50                   	push   %eax
+  802244:	e8 9a ed ff ff       	call   800fe3 <sys_ipc_recv>
+
+	if (from_env_store)
+  802249:	83 c4 10             	add    $0x10,%esp
+  80224c:	85 ff                	test   %edi,%edi
+  80224e:	74 17                	je     802267 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802250:	ba 00 00 00 00       	mov    $0x0,%edx
+  802255:	85 c0                	test   %eax,%eax
+  802257:	75 0c                	jne    802265 <ipc_recv+0x3e>
+  802259:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80225f:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802265:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802267:	85 f6                	test   %esi,%esi
+  802269:	74 2e                	je     802299 <ipc_recv+0x72>
+		if (!r && pg)
+  80226b:	85 c0                	test   %eax,%eax
+  80226d:	75 24                	jne    802293 <ipc_recv+0x6c>
+  80226f:	85 db                	test   %ebx,%ebx
+  802271:	74 20                	je     802293 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802273:	a1 08 40 80 00       	mov    0x804008,%eax
+  802278:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  80227e:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802280:	a1 08 40 80 00       	mov    0x804008,%eax
+  802285:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80228b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80228e:	5b                   	pop    %ebx
+  80228f:	5e                   	pop    %esi
+  802290:	5f                   	pop    %edi
+  802291:	5d                   	pop    %ebp
+  802292:	c3                   	ret
+			*perm_store = 0;
+  802293:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802299:	85 c0                	test   %eax,%eax
+  80229b:	75 ee                	jne    80228b <ipc_recv+0x64>
+  80229d:	eb e1                	jmp    802280 <ipc_recv+0x59>
+
+0080229f <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80229f:	55                   	push   %ebp
+  8022a0:	89 e5                	mov    %esp,%ebp
+  8022a2:	57                   	push   %edi
+  8022a3:	56                   	push   %esi
+  8022a4:	53                   	push   %ebx
+  8022a5:	83 ec 0c             	sub    $0xc,%esp
+  8022a8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8022ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8022b1:	85 db                	test   %ebx,%ebx
+  8022b3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8022b8:	0f 44 d8             	cmove  %eax,%ebx
+  8022bb:	ff 75 14             	push   0x14(%ebp)
+  8022be:	53                   	push   %ebx
+  8022bf:	56                   	push   %esi
+  8022c0:	57                   	push   %edi
+  8022c1:	e8 fa ec ff ff       	call   800fc0 <sys_ipc_try_send_yield>
+  8022c6:	83 c4 10             	add    $0x10,%esp
+  8022c9:	85 c0                	test   %eax,%eax
+  8022cb:	79 1e                	jns    8022eb <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8022cd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8022d0:	75 07                	jne    8022d9 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8022d2:	e8 09 e9 ff ff       	call   800be0 <sys_yield>
+  8022d7:	eb e2                	jmp    8022bb <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8022d9:	50                   	push   %eax
+  8022da:	68 d3 2c 80 00       	push   $0x802cd3
+  8022df:	6a 3d                	push   $0x3d
+  8022e1:	68 e8 2c 80 00       	push   $0x802ce8
+  8022e6:	e8 3f de ff ff       	call   80012a <_panic>
+	}
+}
+  8022eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022ee:	5b                   	pop    %ebx
+  8022ef:	5e                   	pop    %esi
+  8022f0:	5f                   	pop    %edi
+  8022f1:	5d                   	pop    %ebp
+  8022f2:	c3                   	ret
+
+008022f3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8022f3:	55                   	push   %ebp
+  8022f4:	89 e5                	mov    %esp,%ebp
+  8022f6:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8022f9:	ff 75 08             	push   0x8(%ebp)
+  8022fc:	e8 5f e8 ff ff       	call   800b60 <sys_env_find>
+}
+  802301:	c9                   	leave
+  802302:	c3                   	ret
+
+00802303 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802309:	89 c2                	mov    %eax,%edx
+  80230b:	c1 ea 16             	shr    $0x16,%edx
+  80230e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802315:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80231a:	f6 c1 01             	test   $0x1,%cl
+  80231d:	74 22                	je     802341 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80231f:	c1 e8 0c             	shr    $0xc,%eax
+  802322:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802329:	a8 01                	test   $0x1,%al
+  80232b:	74 14                	je     802341 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80232d:	c1 e8 0c             	shr    $0xc,%eax
+  802330:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802333:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80233a:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80233e:	0f b7 d2             	movzwl %dx,%edx
+}
+  802341:	89 d0                	mov    %edx,%eax
+  802343:	5d                   	pop    %ebp
+  802344:	c3                   	ret
+  802345:	66 90                	xchg   %ax,%ax
+  802347:	66 90                	xchg   %ax,%ax
+  802349:	66 90                	xchg   %ax,%ax
+  80234b:	66 90                	xchg   %ax,%ax
+  80234d:	66 90                	xchg   %ax,%ax
+  80234f:	90                   	nop
+
+00802350 <__udivmoddi4>:
+  802350:	55                   	push   %ebp
+  802351:	57                   	push   %edi
+  802352:	56                   	push   %esi
+  802353:	53                   	push   %ebx
+  802354:	83 ec 14             	sub    $0x14,%esp
+  802357:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80235b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80235f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802363:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802367:	89 f1                	mov    %esi,%ecx
+  802369:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80236d:	09 d9                	or     %ebx,%ecx
+  80236f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802373:	0f 84 92 00 00 00    	je     80240b <__udivmoddi4+0xbb>
+  802379:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802380:	00 
+  802381:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802386:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80238d:	00 
+  80238e:	89 1c 24             	mov    %ebx,(%esp)
+  802391:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802395:	8d 76 00             	lea    0x0(%esi),%esi
+  802398:	89 e9                	mov    %ebp,%ecx
+  80239a:	89 c3                	mov    %eax,%ebx
+  80239c:	89 d6                	mov    %edx,%esi
+  80239e:	31 ff                	xor    %edi,%edi
+  8023a0:	d3 ee                	shr    %cl,%esi
+  8023a2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8023a5:	f6 c1 20             	test   $0x20,%cl
+  8023a8:	0f 45 de             	cmovne %esi,%ebx
+  8023ab:	0f 45 f7             	cmovne %edi,%esi
+  8023ae:	8b 3c 24             	mov    (%esp),%edi
+  8023b1:	39 fb                	cmp    %edi,%ebx
+  8023b3:	89 f7                	mov    %esi,%edi
+  8023b5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8023b9:	8b 1c 24             	mov    (%esp),%ebx
+  8023bc:	19 f7                	sbb    %esi,%edi
+  8023be:	72 39                	jb     8023f9 <__udivmoddi4+0xa9>
+  8023c0:	89 e9                	mov    %ebp,%ecx
+  8023c2:	89 f7                	mov    %esi,%edi
+  8023c4:	89 de                	mov    %ebx,%esi
+  8023c6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8023c9:	d3 e6                	shl    %cl,%esi
+  8023cb:	31 db                	xor    %ebx,%ebx
+  8023cd:	f6 c1 20             	test   $0x20,%cl
+  8023d0:	0f 45 fe             	cmovne %esi,%edi
+  8023d3:	0f 45 f3             	cmovne %ebx,%esi
+  8023d6:	29 f0                	sub    %esi,%eax
+  8023d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8023dd:	19 fa                	sbb    %edi,%edx
+  8023df:	31 ff                	xor    %edi,%edi
+  8023e1:	31 db                	xor    %ebx,%ebx
+  8023e3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023e6:	d3 e6                	shl    %cl,%esi
+  8023e8:	f6 c1 20             	test   $0x20,%cl
+  8023eb:	0f 45 fe             	cmovne %esi,%edi
+  8023ee:	0f 45 f3             	cmovne %ebx,%esi
+  8023f1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023f5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023f9:	83 ed 01             	sub    $0x1,%ebp
+  8023fc:	73 9a                	jae    802398 <__udivmoddi4+0x48>
+  8023fe:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802402:	85 ff                	test   %edi,%edi
+  802404:	74 05                	je     80240b <__udivmoddi4+0xbb>
+  802406:	89 07                	mov    %eax,(%edi)
+  802408:	89 57 04             	mov    %edx,0x4(%edi)
+  80240b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80240f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802413:	83 c4 14             	add    $0x14,%esp
+  802416:	5b                   	pop    %ebx
+  802417:	5e                   	pop    %esi
+  802418:	5f                   	pop    %edi
+  802419:	5d                   	pop    %ebp
+  80241a:	c3                   	ret
+  80241b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80241f:	90                   	nop
+
+00802420 <__udivdi3>:
+  802420:	55                   	push   %ebp
+  802421:	57                   	push   %edi
+  802422:	56                   	push   %esi
+  802423:	53                   	push   %ebx
+  802424:	83 ec 14             	sub    $0x14,%esp
+  802427:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80242b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80242f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802433:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802437:	89 fb                	mov    %edi,%ebx
+  802439:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80243d:	09 f3                	or     %esi,%ebx
+  80243f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802443:	0f 84 85 00 00 00    	je     8024ce <__udivdi3+0xae>
+  802449:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802450:	00 
+  802451:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802456:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80245d:	00 
+  80245e:	89 34 24             	mov    %esi,(%esp)
+  802461:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802465:	8d 76 00             	lea    0x0(%esi),%esi
+  802468:	89 e9                	mov    %ebp,%ecx
+  80246a:	89 c3                	mov    %eax,%ebx
+  80246c:	89 d6                	mov    %edx,%esi
+  80246e:	31 ff                	xor    %edi,%edi
+  802470:	d3 ee                	shr    %cl,%esi
+  802472:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802475:	f6 c1 20             	test   $0x20,%cl
+  802478:	0f 45 de             	cmovne %esi,%ebx
+  80247b:	0f 45 f7             	cmovne %edi,%esi
+  80247e:	8b 3c 24             	mov    (%esp),%edi
+  802481:	39 fb                	cmp    %edi,%ebx
+  802483:	89 f7                	mov    %esi,%edi
+  802485:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802489:	8b 1c 24             	mov    (%esp),%ebx
+  80248c:	19 f7                	sbb    %esi,%edi
+  80248e:	72 39                	jb     8024c9 <__udivdi3+0xa9>
+  802490:	89 e9                	mov    %ebp,%ecx
+  802492:	89 f7                	mov    %esi,%edi
+  802494:	89 de                	mov    %ebx,%esi
+  802496:	0f a5 df             	shld   %cl,%ebx,%edi
+  802499:	d3 e6                	shl    %cl,%esi
+  80249b:	31 db                	xor    %ebx,%ebx
+  80249d:	f6 c1 20             	test   $0x20,%cl
+  8024a0:	0f 45 fe             	cmovne %esi,%edi
+  8024a3:	0f 45 f3             	cmovne %ebx,%esi
+  8024a6:	29 f0                	sub    %esi,%eax
+  8024a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8024ad:	19 fa                	sbb    %edi,%edx
+  8024af:	31 ff                	xor    %edi,%edi
+  8024b1:	31 db                	xor    %ebx,%ebx
+  8024b3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8024b6:	d3 e6                	shl    %cl,%esi
+  8024b8:	f6 c1 20             	test   $0x20,%cl
+  8024bb:	0f 45 fe             	cmovne %esi,%edi
+  8024be:	0f 45 f3             	cmovne %ebx,%esi
+  8024c1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8024c5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8024c9:	83 ed 01             	sub    $0x1,%ebp
+  8024cc:	73 9a                	jae    802468 <__udivdi3+0x48>
+  8024ce:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024d2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8024d6:	83 c4 14             	add    $0x14,%esp
+  8024d9:	5b                   	pop    %ebx
+  8024da:	5e                   	pop    %esi
+  8024db:	5f                   	pop    %edi
+  8024dc:	5d                   	pop    %ebp
+  8024dd:	c3                   	ret
+  8024de:	66 90                	xchg   %ax,%ax
+
+008024e0 <__umoddi3>:
+  8024e0:	57                   	push   %edi
+  8024e1:	56                   	push   %esi
+  8024e2:	53                   	push   %ebx
+  8024e3:	83 ec 08             	sub    $0x8,%esp
+  8024e6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8024ea:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8024ee:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8024f2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8024f6:	89 f9                	mov    %edi,%ecx
+  8024f8:	89 34 24             	mov    %esi,(%esp)
+  8024fb:	09 f1                	or     %esi,%ecx
+  8024fd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802501:	74 53                	je     802556 <__umoddi3+0x76>
+  802503:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80250f:	90                   	nop
+  802510:	89 c6                	mov    %eax,%esi
+  802512:	89 d7                	mov    %edx,%edi
+  802514:	31 db                	xor    %ebx,%ebx
+  802516:	d3 ef                	shr    %cl,%edi
+  802518:	0f ad d6             	shrd   %cl,%edx,%esi
+  80251b:	f6 c1 20             	test   $0x20,%cl
+  80251e:	0f 45 f7             	cmovne %edi,%esi
+  802521:	0f 45 fb             	cmovne %ebx,%edi
+  802524:	8b 1c 24             	mov    (%esp),%ebx
+  802527:	39 de                	cmp    %ebx,%esi
+  802529:	89 fb                	mov    %edi,%ebx
+  80252b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80252f:	8b 34 24             	mov    (%esp),%esi
+  802532:	19 fb                	sbb    %edi,%ebx
+  802534:	72 14                	jb     80254a <__umoddi3+0x6a>
+  802536:	0f a5 f7             	shld   %cl,%esi,%edi
+  802539:	31 db                	xor    %ebx,%ebx
+  80253b:	d3 e6                	shl    %cl,%esi
+  80253d:	f6 c1 20             	test   $0x20,%cl
+  802540:	0f 45 fe             	cmovne %esi,%edi
+  802543:	0f 45 f3             	cmovne %ebx,%esi
+  802546:	29 f0                	sub    %esi,%eax
+  802548:	19 fa                	sbb    %edi,%edx
+  80254a:	83 e9 01             	sub    $0x1,%ecx
+  80254d:	73 c1                	jae    802510 <__umoddi3+0x30>
+  80254f:	83 c4 08             	add    $0x8,%esp
+  802552:	5b                   	pop    %ebx
+  802553:	5e                   	pop    %esi
+  802554:	5f                   	pop    %edi
+  802555:	c3                   	ret
+  802556:	83 c4 08             	add    $0x8,%esp
+  802559:	31 c0                	xor    %eax,%eax
+  80255b:	31 d2                	xor    %edx,%edx
+  80255d:	5b                   	pop    %ebx
+  80255e:	5e                   	pop    %esi
+  80255f:	5f                   	pop    %edi
+  802560:	c3                   	ret
+  802561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80256f:	90                   	nop
+
+00802570 <__divdi3>:
+  802570:	55                   	push   %ebp
+  802571:	57                   	push   %edi
+  802572:	56                   	push   %esi
+  802573:	53                   	push   %ebx
+  802574:	83 ec 1c             	sub    $0x1c,%esp
+  802577:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80257b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80257f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802583:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802587:	85 ff                	test   %edi,%edi
+  802589:	0f 88 da 00 00 00    	js     802669 <__divdi3+0xf9>
+  80258f:	85 db                	test   %ebx,%ebx
+  802591:	78 16                	js     8025a9 <__divdi3+0x39>
+  802593:	89 dd                	mov    %ebx,%ebp
+  802595:	89 c8                	mov    %ecx,%eax
+  802597:	89 da                	mov    %ebx,%edx
+  802599:	09 cd                	or     %ecx,%ebp
+  80259b:	0f 85 fd 00 00 00    	jne    80269e <__divdi3+0x12e>
+  8025a1:	83 c4 1c             	add    $0x1c,%esp
+  8025a4:	5b                   	pop    %ebx
+  8025a5:	5e                   	pop    %esi
+  8025a6:	5f                   	pop    %edi
+  8025a7:	5d                   	pop    %ebp
+  8025a8:	c3                   	ret
+  8025a9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8025ae:	f7 d9                	neg    %ecx
+  8025b0:	89 f0                	mov    %esi,%eax
+  8025b2:	89 fa                	mov    %edi,%edx
+  8025b4:	83 d3 00             	adc    $0x0,%ebx
+  8025b7:	89 0c 24             	mov    %ecx,(%esp)
+  8025ba:	f7 db                	neg    %ebx
+  8025bc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8025c0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8025c7:	00 
+  8025c8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025cd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8025d4:	00 
+  8025d5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8025d9:	89 cd                	mov    %ecx,%ebp
+  8025db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8025df:	90                   	nop
+  8025e0:	89 e9                	mov    %ebp,%ecx
+  8025e2:	89 c3                	mov    %eax,%ebx
+  8025e4:	89 d6                	mov    %edx,%esi
+  8025e6:	31 ff                	xor    %edi,%edi
+  8025e8:	d3 ee                	shr    %cl,%esi
+  8025ea:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025ed:	f6 c1 20             	test   $0x20,%cl
+  8025f0:	0f 45 de             	cmovne %esi,%ebx
+  8025f3:	0f 45 f7             	cmovne %edi,%esi
+  8025f6:	8b 3c 24             	mov    (%esp),%edi
+  8025f9:	39 fb                	cmp    %edi,%ebx
+  8025fb:	89 f7                	mov    %esi,%edi
+  8025fd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802601:	8b 1c 24             	mov    (%esp),%ebx
+  802604:	19 f7                	sbb    %esi,%edi
+  802606:	72 39                	jb     802641 <__divdi3+0xd1>
+  802608:	89 e9                	mov    %ebp,%ecx
+  80260a:	89 f7                	mov    %esi,%edi
+  80260c:	89 de                	mov    %ebx,%esi
+  80260e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802611:	d3 e6                	shl    %cl,%esi
+  802613:	31 db                	xor    %ebx,%ebx
+  802615:	f6 c1 20             	test   $0x20,%cl
+  802618:	0f 45 fe             	cmovne %esi,%edi
+  80261b:	0f 45 f3             	cmovne %ebx,%esi
+  80261e:	29 f0                	sub    %esi,%eax
+  802620:	be 01 00 00 00       	mov    $0x1,%esi
+  802625:	19 fa                	sbb    %edi,%edx
+  802627:	31 ff                	xor    %edi,%edi
+  802629:	31 db                	xor    %ebx,%ebx
+  80262b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80262e:	d3 e6                	shl    %cl,%esi
+  802630:	f6 c1 20             	test   $0x20,%cl
+  802633:	0f 45 fe             	cmovne %esi,%edi
+  802636:	0f 45 f3             	cmovne %ebx,%esi
+  802639:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80263d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802641:	83 ed 01             	sub    $0x1,%ebp
+  802644:	73 9a                	jae    8025e0 <__divdi3+0x70>
+  802646:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80264a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80264e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802652:	85 ed                	test   %ebp,%ebp
+  802654:	0f 84 47 ff ff ff    	je     8025a1 <__divdi3+0x31>
+  80265a:	f7 d8                	neg    %eax
+  80265c:	83 d2 00             	adc    $0x0,%edx
+  80265f:	83 c4 1c             	add    $0x1c,%esp
+  802662:	5b                   	pop    %ebx
+  802663:	f7 da                	neg    %edx
+  802665:	5e                   	pop    %esi
+  802666:	5f                   	pop    %edi
+  802667:	5d                   	pop    %ebp
+  802668:	c3                   	ret
+  802669:	f7 de                	neg    %esi
+  80266b:	83 d7 00             	adc    $0x0,%edi
+  80266e:	f7 df                	neg    %edi
+  802670:	85 db                	test   %ebx,%ebx
+  802672:	78 23                	js     802697 <__divdi3+0x127>
+  802674:	89 dd                	mov    %ebx,%ebp
+  802676:	89 c8                	mov    %ecx,%eax
+  802678:	89 da                	mov    %ebx,%edx
+  80267a:	09 cd                	or     %ecx,%ebp
+  80267c:	0f 84 1f ff ff ff    	je     8025a1 <__divdi3+0x31>
+  802682:	89 0c 24             	mov    %ecx,(%esp)
+  802685:	89 f0                	mov    %esi,%eax
+  802687:	89 fa                	mov    %edi,%edx
+  802689:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80268e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802692:	e9 29 ff ff ff       	jmp    8025c0 <__divdi3+0x50>
+  802697:	31 ed                	xor    %ebp,%ebp
+  802699:	e9 10 ff ff ff       	jmp    8025ae <__divdi3+0x3e>
+  80269e:	89 0c 24             	mov    %ecx,(%esp)
+  8026a1:	89 f0                	mov    %esi,%eax
+  8026a3:	89 fa                	mov    %edi,%edx
+  8026a5:	31 ed                	xor    %ebp,%ebp
+  8026a7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8026ab:	e9 10 ff ff ff       	jmp    8025c0 <__divdi3+0x50>
+
+008026b0 <__moddi3>:
+  8026b0:	55                   	push   %ebp
+  8026b1:	57                   	push   %edi
+  8026b2:	56                   	push   %esi
+  8026b3:	53                   	push   %ebx
+  8026b4:	83 ec 14             	sub    $0x14,%esp
+  8026b7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026bb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026bf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8026c3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8026c7:	85 d2                	test   %edx,%edx
+  8026c9:	0f 88 9b 00 00 00    	js     80276a <__moddi3+0xba>
+  8026cf:	89 f7                	mov    %esi,%edi
+  8026d1:	31 ed                	xor    %ebp,%ebp
+  8026d3:	09 cf                	or     %ecx,%edi
+  8026d5:	0f 84 83 00 00 00    	je     80275e <__moddi3+0xae>
+  8026db:	89 cb                	mov    %ecx,%ebx
+  8026dd:	89 f7                	mov    %esi,%edi
+  8026df:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8026e3:	f7 db                	neg    %ebx
+  8026e5:	83 d7 00             	adc    $0x0,%edi
+  8026e8:	f7 df                	neg    %edi
+  8026ea:	0f 49 f7             	cmovns %edi,%esi
+  8026ed:	0f 49 cb             	cmovns %ebx,%ecx
+  8026f0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8026f4:	89 0c 24             	mov    %ecx,(%esp)
+  8026f7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026fc:	89 cd                	mov    %ecx,%ebp
+  8026fe:	66 90                	xchg   %ax,%ax
+  802700:	89 e9                	mov    %ebp,%ecx
+  802702:	89 c3                	mov    %eax,%ebx
+  802704:	89 d6                	mov    %edx,%esi
+  802706:	31 ff                	xor    %edi,%edi
+  802708:	d3 ee                	shr    %cl,%esi
+  80270a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80270d:	f6 c1 20             	test   $0x20,%cl
+  802710:	0f 45 de             	cmovne %esi,%ebx
+  802713:	0f 45 f7             	cmovne %edi,%esi
+  802716:	8b 3c 24             	mov    (%esp),%edi
+  802719:	39 fb                	cmp    %edi,%ebx
+  80271b:	89 f7                	mov    %esi,%edi
+  80271d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802721:	8b 1c 24             	mov    (%esp),%ebx
+  802724:	19 f7                	sbb    %esi,%edi
+  802726:	72 1a                	jb     802742 <__moddi3+0x92>
+  802728:	89 e9                	mov    %ebp,%ecx
+  80272a:	89 f7                	mov    %esi,%edi
+  80272c:	89 de                	mov    %ebx,%esi
+  80272e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802731:	d3 e6                	shl    %cl,%esi
+  802733:	31 db                	xor    %ebx,%ebx
+  802735:	f6 c1 20             	test   $0x20,%cl
+  802738:	0f 45 fe             	cmovne %esi,%edi
+  80273b:	0f 45 f3             	cmovne %ebx,%esi
+  80273e:	29 f0                	sub    %esi,%eax
+  802740:	19 fa                	sbb    %edi,%edx
+  802742:	83 ed 01             	sub    $0x1,%ebp
+  802745:	73 b9                	jae    802700 <__moddi3+0x50>
+  802747:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80274b:	85 ed                	test   %ebp,%ebp
+  80274d:	74 07                	je     802756 <__moddi3+0xa6>
+  80274f:	f7 d8                	neg    %eax
+  802751:	83 d2 00             	adc    $0x0,%edx
+  802754:	f7 da                	neg    %edx
+  802756:	83 c4 14             	add    $0x14,%esp
+  802759:	5b                   	pop    %ebx
+  80275a:	5e                   	pop    %esi
+  80275b:	5f                   	pop    %edi
+  80275c:	5d                   	pop    %ebp
+  80275d:	c3                   	ret
+  80275e:	83 c4 14             	add    $0x14,%esp
+  802761:	31 c0                	xor    %eax,%eax
+  802763:	31 d2                	xor    %edx,%edx
+  802765:	5b                   	pop    %ebx
+  802766:	5e                   	pop    %esi
+  802767:	5f                   	pop    %edi
+  802768:	5d                   	pop    %ebp
+  802769:	c3                   	ret
+  80276a:	89 f7                	mov    %esi,%edi
+  80276c:	09 cf                	or     %ecx,%edi
+  80276e:	74 11                	je     802781 <__moddi3+0xd1>
+  802770:	f7 d8                	neg    %eax
+  802772:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802777:	83 d2 00             	adc    $0x0,%edx
+  80277a:	f7 da                	neg    %edx
+  80277c:	e9 5a ff ff ff       	jmp    8026db <__moddi3+0x2b>
+  802781:	31 c0                	xor    %eax,%eax
+  802783:	31 d2                	xor    %edx,%edx
+  802785:	eb c8                	jmp    80274f <__moddi3+0x9f>
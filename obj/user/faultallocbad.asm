@@ -0,0 +1,5726 @@
+
+obj/user/faultallocbad.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 80 27 80 00       	push   $0x802780
+  800045:	e8 a6 01 00 00       	call   8001f0 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 ed 0b 00 00       	call   800c4b <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 cc 27 80 00       	push   $0x8027cc
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 16 07 00 00       	call   800789 <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 a0 27 80 00       	push   $0x8027a0
+  800085:	6a 0f                	push   $0xf
+  800087:	68 8a 27 80 00       	push   $0x80278a
+  80008c:	e8 84 00 00 00       	call   800115 <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 cf 0f 00 00       	call   801070 <set_pgfault_handler>
+	sys_cputs((char*)0xDEADBEEF, 4);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	6a 04                	push   $0x4
+  8000a6:	68 ef be ad de       	push   $0xdeadbeef
+  8000ab:	e8 5e 0a 00 00       	call   800b0e <sys_cputs>
+}
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000c0:	e8 e7 0a 00 00       	call   800bac <sys_getenvid>
+  8000c5:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000ca:	c1 e0 09             	shl    $0x9,%eax
+  8000cd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d2:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000d7:	85 db                	test   %ebx,%ebx
+  8000d9:	7e 07                	jle    8000e2 <libmain+0x2d>
+		binaryname = argv[0];
+  8000db:	8b 06                	mov    (%esi),%eax
+  8000dd:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000e2:	83 ec 08             	sub    $0x8,%esp
+  8000e5:	56                   	push   %esi
+  8000e6:	53                   	push   %ebx
+  8000e7:	e8 a5 ff ff ff       	call   800091 <umain>
+
+	// exit gracefully
+	exit();
+  8000ec:	e8 0a 00 00 00       	call   8000fb <exit>
+}
+  8000f1:	83 c4 10             	add    $0x10,%esp
+  8000f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000f7:	5b                   	pop    %ebx
+  8000f8:	5e                   	pop    %esi
+  8000f9:	5d                   	pop    %ebp
+  8000fa:	c3                   	ret
+
+008000fb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fb:	55                   	push   %ebp
+  8000fc:	89 e5                	mov    %esp,%ebp
+  8000fe:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800101:	e8 cf 11 00 00       	call   8012d5 <close_all>
+	sys_env_destroy(0);
+  800106:	83 ec 0c             	sub    $0xc,%esp
+  800109:	6a 00                	push   $0x0
+  80010b:	e8 5b 0a 00 00       	call   800b6b <sys_env_destroy>
+}
+  800110:	83 c4 10             	add    $0x10,%esp
+  800113:	c9                   	leave
+  800114:	c3                   	ret
+
+00800115 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800115:	55                   	push   %ebp
+  800116:	89 e5                	mov    %esp,%ebp
+  800118:	56                   	push   %esi
+  800119:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80011a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80011d:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  800123:	e8 84 0a 00 00       	call   800bac <sys_getenvid>
+  800128:	83 ec 0c             	sub    $0xc,%esp
+  80012b:	ff 75 0c             	push   0xc(%ebp)
+  80012e:	ff 75 08             	push   0x8(%ebp)
+  800131:	56                   	push   %esi
+  800132:	50                   	push   %eax
+  800133:	68 f8 27 80 00       	push   $0x8027f8
+  800138:	e8 b3 00 00 00       	call   8001f0 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80013d:	83 c4 18             	add    $0x18,%esp
+  800140:	53                   	push   %ebx
+  800141:	ff 75 10             	push   0x10(%ebp)
+  800144:	e8 56 00 00 00       	call   80019f <vcprintf>
+	cprintf("\n");
+  800149:	c7 04 24 a0 2c 80 00 	movl   $0x802ca0,(%esp)
+  800150:	e8 9b 00 00 00       	call   8001f0 <cprintf>
+  800155:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800158:	cc                   	int3
+	while (1)
+  800159:	eb fd                	jmp    800158 <_panic+0x43>
+
+0080015b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80015b:	55                   	push   %ebp
+  80015c:	89 e5                	mov    %esp,%ebp
+  80015e:	53                   	push   %ebx
+  80015f:	83 ec 04             	sub    $0x4,%esp
+  800162:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800165:	8b 13                	mov    (%ebx),%edx
+  800167:	8d 42 01             	lea    0x1(%edx),%eax
+  80016a:	89 03                	mov    %eax,(%ebx)
+  80016c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80016f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800173:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800178:	74 09                	je     800183 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80017a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80017e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800181:	c9                   	leave
+  800182:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800183:	83 ec 08             	sub    $0x8,%esp
+  800186:	68 ff 00 00 00       	push   $0xff
+  80018b:	8d 43 08             	lea    0x8(%ebx),%eax
+  80018e:	50                   	push   %eax
+  80018f:	e8 7a 09 00 00       	call   800b0e <sys_cputs>
+		b->idx = 0;
+  800194:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80019a:	83 c4 10             	add    $0x10,%esp
+  80019d:	eb db                	jmp    80017a <putch+0x1f>
+
+0080019f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80019f:	55                   	push   %ebp
+  8001a0:	89 e5                	mov    %esp,%ebp
+  8001a2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001a8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001af:	00 00 00 
+	b.cnt = 0;
+  8001b2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001b9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001bc:	ff 75 0c             	push   0xc(%ebp)
+  8001bf:	ff 75 08             	push   0x8(%ebp)
+  8001c2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001c8:	50                   	push   %eax
+  8001c9:	68 5b 01 80 00       	push   $0x80015b
+  8001ce:	e8 14 01 00 00       	call   8002e7 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001d3:	83 c4 08             	add    $0x8,%esp
+  8001d6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001dc:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001e2:	50                   	push   %eax
+  8001e3:	e8 26 09 00 00       	call   800b0e <sys_cputs>
+
+	return b.cnt;
+}
+  8001e8:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001ee:	c9                   	leave
+  8001ef:	c3                   	ret
+
+008001f0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001f0:	55                   	push   %ebp
+  8001f1:	89 e5                	mov    %esp,%ebp
+  8001f3:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001f6:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001f9:	50                   	push   %eax
+  8001fa:	ff 75 08             	push   0x8(%ebp)
+  8001fd:	e8 9d ff ff ff       	call   80019f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800202:	c9                   	leave
+  800203:	c3                   	ret
+
+00800204 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800204:	55                   	push   %ebp
+  800205:	89 e5                	mov    %esp,%ebp
+  800207:	57                   	push   %edi
+  800208:	56                   	push   %esi
+  800209:	53                   	push   %ebx
+  80020a:	83 ec 1c             	sub    $0x1c,%esp
+  80020d:	89 c7                	mov    %eax,%edi
+  80020f:	89 d6                	mov    %edx,%esi
+  800211:	8b 45 08             	mov    0x8(%ebp),%eax
+  800214:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800217:	89 d1                	mov    %edx,%ecx
+  800219:	89 c2                	mov    %eax,%edx
+  80021b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80021e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800221:	8b 45 10             	mov    0x10(%ebp),%eax
+  800224:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800227:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80022a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800231:	39 c2                	cmp    %eax,%edx
+  800233:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800236:	72 3e                	jb     800276 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800238:	83 ec 0c             	sub    $0xc,%esp
+  80023b:	ff 75 18             	push   0x18(%ebp)
+  80023e:	83 eb 01             	sub    $0x1,%ebx
+  800241:	53                   	push   %ebx
+  800242:	50                   	push   %eax
+  800243:	83 ec 08             	sub    $0x8,%esp
+  800246:	ff 75 e4             	push   -0x1c(%ebp)
+  800249:	ff 75 e0             	push   -0x20(%ebp)
+  80024c:	ff 75 dc             	push   -0x24(%ebp)
+  80024f:	ff 75 d8             	push   -0x28(%ebp)
+  800252:	e8 a9 21 00 00       	call   802400 <__udivdi3>
+  800257:	83 c4 18             	add    $0x18,%esp
+  80025a:	52                   	push   %edx
+  80025b:	50                   	push   %eax
+  80025c:	89 f2                	mov    %esi,%edx
+  80025e:	89 f8                	mov    %edi,%eax
+  800260:	e8 9f ff ff ff       	call   800204 <printnum>
+  800265:	83 c4 20             	add    $0x20,%esp
+  800268:	eb 13                	jmp    80027d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80026a:	83 ec 08             	sub    $0x8,%esp
+  80026d:	56                   	push   %esi
+  80026e:	ff 75 18             	push   0x18(%ebp)
+  800271:	ff d7                	call   *%edi
+  800273:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800276:	83 eb 01             	sub    $0x1,%ebx
+  800279:	85 db                	test   %ebx,%ebx
+  80027b:	7f ed                	jg     80026a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80027d:	83 ec 08             	sub    $0x8,%esp
+  800280:	56                   	push   %esi
+  800281:	83 ec 04             	sub    $0x4,%esp
+  800284:	ff 75 e4             	push   -0x1c(%ebp)
+  800287:	ff 75 e0             	push   -0x20(%ebp)
+  80028a:	ff 75 dc             	push   -0x24(%ebp)
+  80028d:	ff 75 d8             	push   -0x28(%ebp)
+  800290:	e8 2b 22 00 00       	call   8024c0 <__umoddi3>
+  800295:	83 c4 14             	add    $0x14,%esp
+  800298:	0f be 80 1b 28 80 00 	movsbl 0x80281b(%eax),%eax
+  80029f:	50                   	push   %eax
+  8002a0:	ff d7                	call   *%edi
+}
+  8002a2:	83 c4 10             	add    $0x10,%esp
+  8002a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a8:	5b                   	pop    %ebx
+  8002a9:	5e                   	pop    %esi
+  8002aa:	5f                   	pop    %edi
+  8002ab:	5d                   	pop    %ebp
+  8002ac:	c3                   	ret
+
+008002ad <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002ad:	55                   	push   %ebp
+  8002ae:	89 e5                	mov    %esp,%ebp
+  8002b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002b3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002b7:	8b 10                	mov    (%eax),%edx
+  8002b9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002bc:	73 0a                	jae    8002c8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002be:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002c1:	89 08                	mov    %ecx,(%eax)
+  8002c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c6:	88 02                	mov    %al,(%edx)
+}
+  8002c8:	5d                   	pop    %ebp
+  8002c9:	c3                   	ret
+
+008002ca <printfmt>:
+{
+  8002ca:	55                   	push   %ebp
+  8002cb:	89 e5                	mov    %esp,%ebp
+  8002cd:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002d0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002d3:	50                   	push   %eax
+  8002d4:	ff 75 10             	push   0x10(%ebp)
+  8002d7:	ff 75 0c             	push   0xc(%ebp)
+  8002da:	ff 75 08             	push   0x8(%ebp)
+  8002dd:	e8 05 00 00 00       	call   8002e7 <vprintfmt>
+}
+  8002e2:	83 c4 10             	add    $0x10,%esp
+  8002e5:	c9                   	leave
+  8002e6:	c3                   	ret
+
+008002e7 <vprintfmt>:
+{
+  8002e7:	55                   	push   %ebp
+  8002e8:	89 e5                	mov    %esp,%ebp
+  8002ea:	57                   	push   %edi
+  8002eb:	56                   	push   %esi
+  8002ec:	53                   	push   %ebx
+  8002ed:	83 ec 2c             	sub    $0x2c,%esp
+  8002f0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002f6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002f9:	eb 0a                	jmp    800305 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002fb:	83 ec 08             	sub    $0x8,%esp
+  8002fe:	53                   	push   %ebx
+  8002ff:	50                   	push   %eax
+  800300:	ff d6                	call   *%esi
+  800302:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800305:	83 c7 01             	add    $0x1,%edi
+  800308:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80030c:	83 f8 25             	cmp    $0x25,%eax
+  80030f:	74 0c                	je     80031d <vprintfmt+0x36>
+			if (ch == '\0')
+  800311:	85 c0                	test   %eax,%eax
+  800313:	75 e6                	jne    8002fb <vprintfmt+0x14>
+}
+  800315:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800318:	5b                   	pop    %ebx
+  800319:	5e                   	pop    %esi
+  80031a:	5f                   	pop    %edi
+  80031b:	5d                   	pop    %ebp
+  80031c:	c3                   	ret
+		padc = ' ';
+  80031d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800321:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800328:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80032f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800336:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80033b:	8d 47 01             	lea    0x1(%edi),%eax
+  80033e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800341:	0f b6 17             	movzbl (%edi),%edx
+  800344:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800347:	3c 55                	cmp    $0x55,%al
+  800349:	0f 87 cf 03 00 00    	ja     80071e <vprintfmt+0x437>
+  80034f:	0f b6 c0             	movzbl %al,%eax
+  800352:	ff 24 85 60 29 80 00 	jmp    *0x802960(,%eax,4)
+  800359:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80035c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800360:	eb d9                	jmp    80033b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800362:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800365:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800369:	eb d0                	jmp    80033b <vprintfmt+0x54>
+  80036b:	0f b6 d2             	movzbl %dl,%edx
+  80036e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800371:	b8 00 00 00 00       	mov    $0x0,%eax
+  800376:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800379:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80037c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800380:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800383:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800386:	83 f9 09             	cmp    $0x9,%ecx
+  800389:	77 55                	ja     8003e0 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80038b:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80038e:	eb e9                	jmp    800379 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800390:	8b 45 14             	mov    0x14(%ebp),%eax
+  800393:	8b 00                	mov    (%eax),%eax
+  800395:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800398:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039b:	8d 40 04             	lea    0x4(%eax),%eax
+  80039e:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003a4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003a8:	79 91                	jns    80033b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003aa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003ad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003b7:	eb 82                	jmp    80033b <vprintfmt+0x54>
+			if (width < 0)
+  8003b9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003bc:	85 d2                	test   %edx,%edx
+  8003be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c3:	0f 49 c2             	cmovns %edx,%eax
+  8003c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003cc:	e9 6a ff ff ff       	jmp    80033b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003d4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003db:	e9 5b ff ff ff       	jmp    80033b <vprintfmt+0x54>
+  8003e0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003e3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003e6:	eb bc                	jmp    8003a4 <vprintfmt+0xbd>
+			lflag++;
+  8003e8:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ee:	e9 48 ff ff ff       	jmp    80033b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f6:	8d 78 04             	lea    0x4(%eax),%edi
+  8003f9:	83 ec 08             	sub    $0x8,%esp
+  8003fc:	53                   	push   %ebx
+  8003fd:	ff 30                	push   (%eax)
+  8003ff:	ff d6                	call   *%esi
+			break;
+  800401:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800404:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800407:	e9 b1 02 00 00       	jmp    8006bd <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80040c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800412:	8b 10                	mov    (%eax),%edx
+  800414:	89 d0                	mov    %edx,%eax
+  800416:	f7 d8                	neg    %eax
+  800418:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80041b:	83 f8 0f             	cmp    $0xf,%eax
+  80041e:	7f 23                	jg     800443 <vprintfmt+0x15c>
+  800420:	8b 14 85 c0 2a 80 00 	mov    0x802ac0(,%eax,4),%edx
+  800427:	85 d2                	test   %edx,%edx
+  800429:	74 18                	je     800443 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80042b:	52                   	push   %edx
+  80042c:	68 35 2c 80 00       	push   $0x802c35
+  800431:	53                   	push   %ebx
+  800432:	56                   	push   %esi
+  800433:	e8 92 fe ff ff       	call   8002ca <printfmt>
+  800438:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80043e:	e9 7a 02 00 00       	jmp    8006bd <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800443:	50                   	push   %eax
+  800444:	68 33 28 80 00       	push   $0x802833
+  800449:	53                   	push   %ebx
+  80044a:	56                   	push   %esi
+  80044b:	e8 7a fe ff ff       	call   8002ca <printfmt>
+  800450:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800453:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800456:	e9 62 02 00 00       	jmp    8006bd <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80045b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045e:	83 c0 04             	add    $0x4,%eax
+  800461:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800464:	8b 45 14             	mov    0x14(%ebp),%eax
+  800467:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800469:	85 c9                	test   %ecx,%ecx
+  80046b:	b8 2c 28 80 00       	mov    $0x80282c,%eax
+  800470:	0f 45 c1             	cmovne %ecx,%eax
+  800473:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800476:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80047a:	7e 06                	jle    800482 <vprintfmt+0x19b>
+  80047c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800480:	75 0b                	jne    80048d <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800482:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800485:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800488:	89 75 08             	mov    %esi,0x8(%ebp)
+  80048b:	eb 5c                	jmp    8004e9 <vprintfmt+0x202>
+  80048d:	83 ec 08             	sub    $0x8,%esp
+  800490:	ff 75 d0             	push   -0x30(%ebp)
+  800493:	ff 75 cc             	push   -0x34(%ebp)
+  800496:	e8 20 03 00 00       	call   8007bb <strnlen>
+  80049b:	89 c2                	mov    %eax,%edx
+  80049d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004a0:	29 d0                	sub    %edx,%eax
+  8004a2:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004a5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ac:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004af:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b1:	eb 0e                	jmp    8004c1 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004b3:	83 ec 08             	sub    $0x8,%esp
+  8004b6:	53                   	push   %ebx
+  8004b7:	57                   	push   %edi
+  8004b8:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004bb:	83 ee 01             	sub    $0x1,%esi
+  8004be:	83 c4 10             	add    $0x10,%esp
+  8004c1:	85 f6                	test   %esi,%esi
+  8004c3:	7f ee                	jg     8004b3 <vprintfmt+0x1cc>
+  8004c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004cb:	85 c0                	test   %eax,%eax
+  8004cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d2:	0f 49 d0             	cmovns %eax,%edx
+  8004d5:	29 d0                	sub    %edx,%eax
+  8004d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004da:	eb a6                	jmp    800482 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004dc:	83 ec 08             	sub    $0x8,%esp
+  8004df:	53                   	push   %ebx
+  8004e0:	52                   	push   %edx
+  8004e1:	ff 55 08             	call   *0x8(%ebp)
+  8004e4:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004e7:	89 f1                	mov    %esi,%ecx
+  8004e9:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004ec:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004f0:	0f be d0             	movsbl %al,%edx
+  8004f3:	85 d2                	test   %edx,%edx
+  8004f5:	74 28                	je     80051f <vprintfmt+0x238>
+  8004f7:	85 ff                	test   %edi,%edi
+  8004f9:	78 05                	js     800500 <vprintfmt+0x219>
+  8004fb:	83 ef 01             	sub    $0x1,%edi
+  8004fe:	78 30                	js     800530 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800500:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800504:	74 d6                	je     8004dc <vprintfmt+0x1f5>
+  800506:	0f be c0             	movsbl %al,%eax
+  800509:	83 e8 20             	sub    $0x20,%eax
+  80050c:	83 f8 5e             	cmp    $0x5e,%eax
+  80050f:	76 cb                	jbe    8004dc <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800511:	83 ec 08             	sub    $0x8,%esp
+  800514:	53                   	push   %ebx
+  800515:	6a 3f                	push   $0x3f
+  800517:	ff 55 08             	call   *0x8(%ebp)
+  80051a:	83 c4 10             	add    $0x10,%esp
+  80051d:	eb c8                	jmp    8004e7 <vprintfmt+0x200>
+  80051f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800522:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800525:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800528:	01 d0                	add    %edx,%eax
+  80052a:	29 c8                	sub    %ecx,%eax
+  80052c:	89 c7                	mov    %eax,%edi
+  80052e:	eb 13                	jmp    800543 <vprintfmt+0x25c>
+  800530:	8b 75 08             	mov    0x8(%ebp),%esi
+  800533:	eb ed                	jmp    800522 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800535:	83 ec 08             	sub    $0x8,%esp
+  800538:	53                   	push   %ebx
+  800539:	6a 20                	push   $0x20
+  80053b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80053d:	83 ef 01             	sub    $0x1,%edi
+  800540:	83 c4 10             	add    $0x10,%esp
+  800543:	85 ff                	test   %edi,%edi
+  800545:	7f ee                	jg     800535 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800547:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80054a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80054d:	e9 6b 01 00 00       	jmp    8006bd <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800552:	83 f9 01             	cmp    $0x1,%ecx
+  800555:	7f 1f                	jg     800576 <vprintfmt+0x28f>
+	else if (lflag)
+  800557:	85 c9                	test   %ecx,%ecx
+  800559:	74 67                	je     8005c2 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80055b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055e:	8b 00                	mov    (%eax),%eax
+  800560:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800563:	89 c1                	mov    %eax,%ecx
+  800565:	c1 f9 1f             	sar    $0x1f,%ecx
+  800568:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80056b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056e:	8d 40 04             	lea    0x4(%eax),%eax
+  800571:	89 45 14             	mov    %eax,0x14(%ebp)
+  800574:	eb 17                	jmp    80058d <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800576:	8b 45 14             	mov    0x14(%ebp),%eax
+  800579:	8b 50 04             	mov    0x4(%eax),%edx
+  80057c:	8b 00                	mov    (%eax),%eax
+  80057e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800581:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800584:	8b 45 14             	mov    0x14(%ebp),%eax
+  800587:	8d 40 08             	lea    0x8(%eax),%eax
+  80058a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80058d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800590:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800593:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800598:	85 c9                	test   %ecx,%ecx
+  80059a:	0f 89 03 01 00 00    	jns    8006a3 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005a0:	83 ec 08             	sub    $0x8,%esp
+  8005a3:	53                   	push   %ebx
+  8005a4:	6a 2d                	push   $0x2d
+  8005a6:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005a8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ab:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005ae:	f7 da                	neg    %edx
+  8005b0:	83 d1 00             	adc    $0x0,%ecx
+  8005b3:	f7 d9                	neg    %ecx
+  8005b5:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005b8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005bd:	e9 e1 00 00 00       	jmp    8006a3 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c5:	8b 00                	mov    (%eax),%eax
+  8005c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ca:	89 c1                	mov    %eax,%ecx
+  8005cc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005cf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005db:	eb b0                	jmp    80058d <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005dd:	83 f9 01             	cmp    $0x1,%ecx
+  8005e0:	7f 1e                	jg     800600 <vprintfmt+0x319>
+	else if (lflag)
+  8005e2:	85 c9                	test   %ecx,%ecx
+  8005e4:	74 32                	je     800618 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e9:	8b 10                	mov    (%eax),%edx
+  8005eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005fb:	e9 a3 00 00 00       	jmp    8006a3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800600:	8b 45 14             	mov    0x14(%ebp),%eax
+  800603:	8b 10                	mov    (%eax),%edx
+  800605:	8b 48 04             	mov    0x4(%eax),%ecx
+  800608:	8d 40 08             	lea    0x8(%eax),%eax
+  80060b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800613:	e9 8b 00 00 00       	jmp    8006a3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800618:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061b:	8b 10                	mov    (%eax),%edx
+  80061d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800622:	8d 40 04             	lea    0x4(%eax),%eax
+  800625:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800628:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80062d:	eb 74                	jmp    8006a3 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80062f:	83 f9 01             	cmp    $0x1,%ecx
+  800632:	7f 1b                	jg     80064f <vprintfmt+0x368>
+	else if (lflag)
+  800634:	85 c9                	test   %ecx,%ecx
+  800636:	74 2c                	je     800664 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800638:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063b:	8b 10                	mov    (%eax),%edx
+  80063d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800642:	8d 40 04             	lea    0x4(%eax),%eax
+  800645:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800648:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80064d:	eb 54                	jmp    8006a3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80064f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800652:	8b 10                	mov    (%eax),%edx
+  800654:	8b 48 04             	mov    0x4(%eax),%ecx
+  800657:	8d 40 08             	lea    0x8(%eax),%eax
+  80065a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80065d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800662:	eb 3f                	jmp    8006a3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8b 10                	mov    (%eax),%edx
+  800669:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066e:	8d 40 04             	lea    0x4(%eax),%eax
+  800671:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800674:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800679:	eb 28                	jmp    8006a3 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80067b:	83 ec 08             	sub    $0x8,%esp
+  80067e:	53                   	push   %ebx
+  80067f:	6a 30                	push   $0x30
+  800681:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800683:	83 c4 08             	add    $0x8,%esp
+  800686:	53                   	push   %ebx
+  800687:	6a 78                	push   $0x78
+  800689:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 10                	mov    (%eax),%edx
+  800690:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800695:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800698:	8d 40 04             	lea    0x4(%eax),%eax
+  80069b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80069e:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006a3:	83 ec 0c             	sub    $0xc,%esp
+  8006a6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006aa:	50                   	push   %eax
+  8006ab:	ff 75 e0             	push   -0x20(%ebp)
+  8006ae:	57                   	push   %edi
+  8006af:	51                   	push   %ecx
+  8006b0:	52                   	push   %edx
+  8006b1:	89 da                	mov    %ebx,%edx
+  8006b3:	89 f0                	mov    %esi,%eax
+  8006b5:	e8 4a fb ff ff       	call   800204 <printnum>
+			break;
+  8006ba:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006c0:	e9 40 fc ff ff       	jmp    800305 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006c5:	83 f9 01             	cmp    $0x1,%ecx
+  8006c8:	7f 1b                	jg     8006e5 <vprintfmt+0x3fe>
+	else if (lflag)
+  8006ca:	85 c9                	test   %ecx,%ecx
+  8006cc:	74 2c                	je     8006fa <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d1:	8b 10                	mov    (%eax),%edx
+  8006d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006de:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006e3:	eb be                	jmp    8006a3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e8:	8b 10                	mov    (%eax),%edx
+  8006ea:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006f8:	eb a9                	jmp    8006a3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fd:	8b 10                	mov    (%eax),%edx
+  8006ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800704:	8d 40 04             	lea    0x4(%eax),%eax
+  800707:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80070f:	eb 92                	jmp    8006a3 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800711:	83 ec 08             	sub    $0x8,%esp
+  800714:	53                   	push   %ebx
+  800715:	6a 25                	push   $0x25
+  800717:	ff d6                	call   *%esi
+			break;
+  800719:	83 c4 10             	add    $0x10,%esp
+  80071c:	eb 9f                	jmp    8006bd <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80071e:	83 ec 08             	sub    $0x8,%esp
+  800721:	53                   	push   %ebx
+  800722:	6a 25                	push   $0x25
+  800724:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800726:	83 c4 10             	add    $0x10,%esp
+  800729:	89 f8                	mov    %edi,%eax
+  80072b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80072f:	74 05                	je     800736 <vprintfmt+0x44f>
+  800731:	83 e8 01             	sub    $0x1,%eax
+  800734:	eb f5                	jmp    80072b <vprintfmt+0x444>
+  800736:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800739:	eb 82                	jmp    8006bd <vprintfmt+0x3d6>
+
+0080073b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80073b:	55                   	push   %ebp
+  80073c:	89 e5                	mov    %esp,%ebp
+  80073e:	83 ec 18             	sub    $0x18,%esp
+  800741:	8b 45 08             	mov    0x8(%ebp),%eax
+  800744:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800747:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80074a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80074e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800751:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800758:	85 c0                	test   %eax,%eax
+  80075a:	74 26                	je     800782 <vsnprintf+0x47>
+  80075c:	85 d2                	test   %edx,%edx
+  80075e:	7e 22                	jle    800782 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800760:	ff 75 14             	push   0x14(%ebp)
+  800763:	ff 75 10             	push   0x10(%ebp)
+  800766:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800769:	50                   	push   %eax
+  80076a:	68 ad 02 80 00       	push   $0x8002ad
+  80076f:	e8 73 fb ff ff       	call   8002e7 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800774:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800777:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80077a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80077d:	83 c4 10             	add    $0x10,%esp
+}
+  800780:	c9                   	leave
+  800781:	c3                   	ret
+		return -E_INVAL;
+  800782:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800787:	eb f7                	jmp    800780 <vsnprintf+0x45>
+
+00800789 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800789:	55                   	push   %ebp
+  80078a:	89 e5                	mov    %esp,%ebp
+  80078c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80078f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800792:	50                   	push   %eax
+  800793:	ff 75 10             	push   0x10(%ebp)
+  800796:	ff 75 0c             	push   0xc(%ebp)
+  800799:	ff 75 08             	push   0x8(%ebp)
+  80079c:	e8 9a ff ff ff       	call   80073b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007a1:	c9                   	leave
+  8007a2:	c3                   	ret
+
+008007a3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007a3:	55                   	push   %ebp
+  8007a4:	89 e5                	mov    %esp,%ebp
+  8007a6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ae:	eb 03                	jmp    8007b3 <strlen+0x10>
+		n++;
+  8007b0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007b7:	75 f7                	jne    8007b0 <strlen+0xd>
+	return n;
+}
+  8007b9:	5d                   	pop    %ebp
+  8007ba:	c3                   	ret
+
+008007bb <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007bb:	55                   	push   %ebp
+  8007bc:	89 e5                	mov    %esp,%ebp
+  8007be:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c9:	eb 03                	jmp    8007ce <strnlen+0x13>
+		n++;
+  8007cb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007ce:	39 d0                	cmp    %edx,%eax
+  8007d0:	74 08                	je     8007da <strnlen+0x1f>
+  8007d2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007d6:	75 f3                	jne    8007cb <strnlen+0x10>
+  8007d8:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007da:	89 d0                	mov    %edx,%eax
+  8007dc:	5d                   	pop    %ebp
+  8007dd:	c3                   	ret
+
+008007de <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007de:	55                   	push   %ebp
+  8007df:	89 e5                	mov    %esp,%ebp
+  8007e1:	53                   	push   %ebx
+  8007e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ed:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007f1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007f4:	83 c0 01             	add    $0x1,%eax
+  8007f7:	84 d2                	test   %dl,%dl
+  8007f9:	75 f2                	jne    8007ed <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007fb:	89 c8                	mov    %ecx,%eax
+  8007fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800800:	c9                   	leave
+  800801:	c3                   	ret
+
+00800802 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800802:	55                   	push   %ebp
+  800803:	89 e5                	mov    %esp,%ebp
+  800805:	53                   	push   %ebx
+  800806:	83 ec 10             	sub    $0x10,%esp
+  800809:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80080c:	53                   	push   %ebx
+  80080d:	e8 91 ff ff ff       	call   8007a3 <strlen>
+  800812:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800815:	ff 75 0c             	push   0xc(%ebp)
+  800818:	01 d8                	add    %ebx,%eax
+  80081a:	50                   	push   %eax
+  80081b:	e8 be ff ff ff       	call   8007de <strcpy>
+	return dst;
+}
+  800820:	89 d8                	mov    %ebx,%eax
+  800822:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800825:	c9                   	leave
+  800826:	c3                   	ret
+
+00800827 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800827:	55                   	push   %ebp
+  800828:	89 e5                	mov    %esp,%ebp
+  80082a:	56                   	push   %esi
+  80082b:	53                   	push   %ebx
+  80082c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80082f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800832:	89 f3                	mov    %esi,%ebx
+  800834:	03 5d 10             	add    0x10(%ebp),%ebx
+  800837:	89 f0                	mov    %esi,%eax
+  800839:	eb 0f                	jmp    80084a <strncpy+0x23>
+		*dst++ = *src;
+  80083b:	83 c0 01             	add    $0x1,%eax
+  80083e:	0f b6 0a             	movzbl (%edx),%ecx
+  800841:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800844:	80 f9 01             	cmp    $0x1,%cl
+  800847:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80084a:	39 d8                	cmp    %ebx,%eax
+  80084c:	75 ed                	jne    80083b <strncpy+0x14>
+	}
+	return ret;
+}
+  80084e:	89 f0                	mov    %esi,%eax
+  800850:	5b                   	pop    %ebx
+  800851:	5e                   	pop    %esi
+  800852:	5d                   	pop    %ebp
+  800853:	c3                   	ret
+
+00800854 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	56                   	push   %esi
+  800858:	53                   	push   %ebx
+  800859:	8b 75 08             	mov    0x8(%ebp),%esi
+  80085c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80085f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800862:	89 f0                	mov    %esi,%eax
+  800864:	85 d2                	test   %edx,%edx
+  800866:	74 21                	je     800889 <strlcpy+0x35>
+  800868:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80086c:	89 f2                	mov    %esi,%edx
+  80086e:	eb 09                	jmp    800879 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800870:	83 c1 01             	add    $0x1,%ecx
+  800873:	83 c2 01             	add    $0x1,%edx
+  800876:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800879:	39 c2                	cmp    %eax,%edx
+  80087b:	74 09                	je     800886 <strlcpy+0x32>
+  80087d:	0f b6 19             	movzbl (%ecx),%ebx
+  800880:	84 db                	test   %bl,%bl
+  800882:	75 ec                	jne    800870 <strlcpy+0x1c>
+  800884:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800886:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800889:	29 f0                	sub    %esi,%eax
+}
+  80088b:	5b                   	pop    %ebx
+  80088c:	5e                   	pop    %esi
+  80088d:	5d                   	pop    %ebp
+  80088e:	c3                   	ret
+
+0080088f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80088f:	55                   	push   %ebp
+  800890:	89 e5                	mov    %esp,%ebp
+  800892:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800895:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800898:	eb 06                	jmp    8008a0 <strcmp+0x11>
+		p++, q++;
+  80089a:	83 c1 01             	add    $0x1,%ecx
+  80089d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008a0:	0f b6 01             	movzbl (%ecx),%eax
+  8008a3:	84 c0                	test   %al,%al
+  8008a5:	74 04                	je     8008ab <strcmp+0x1c>
+  8008a7:	3a 02                	cmp    (%edx),%al
+  8008a9:	74 ef                	je     80089a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ab:	0f b6 c0             	movzbl %al,%eax
+  8008ae:	0f b6 12             	movzbl (%edx),%edx
+  8008b1:	29 d0                	sub    %edx,%eax
+}
+  8008b3:	5d                   	pop    %ebp
+  8008b4:	c3                   	ret
+
+008008b5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008b5:	55                   	push   %ebp
+  8008b6:	89 e5                	mov    %esp,%ebp
+  8008b8:	53                   	push   %ebx
+  8008b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008bf:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008c2:	eb 09                	jmp    8008cd <strncmp+0x18>
+		n--, p++, q++;
+  8008c4:	83 ea 01             	sub    $0x1,%edx
+  8008c7:	83 c0 01             	add    $0x1,%eax
+  8008ca:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008cd:	85 d2                	test   %edx,%edx
+  8008cf:	74 18                	je     8008e9 <strncmp+0x34>
+  8008d1:	0f b6 18             	movzbl (%eax),%ebx
+  8008d4:	84 db                	test   %bl,%bl
+  8008d6:	74 04                	je     8008dc <strncmp+0x27>
+  8008d8:	3a 19                	cmp    (%ecx),%bl
+  8008da:	74 e8                	je     8008c4 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008dc:	0f b6 00             	movzbl (%eax),%eax
+  8008df:	0f b6 11             	movzbl (%ecx),%edx
+  8008e2:	29 d0                	sub    %edx,%eax
+}
+  8008e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e7:	c9                   	leave
+  8008e8:	c3                   	ret
+		return 0;
+  8008e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ee:	eb f4                	jmp    8008e4 <strncmp+0x2f>
+
+008008f0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008f0:	55                   	push   %ebp
+  8008f1:	89 e5                	mov    %esp,%ebp
+  8008f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008fa:	eb 03                	jmp    8008ff <strchr+0xf>
+  8008fc:	83 c0 01             	add    $0x1,%eax
+  8008ff:	0f b6 10             	movzbl (%eax),%edx
+  800902:	84 d2                	test   %dl,%dl
+  800904:	74 06                	je     80090c <strchr+0x1c>
+		if (*s == c)
+  800906:	38 ca                	cmp    %cl,%dl
+  800908:	75 f2                	jne    8008fc <strchr+0xc>
+  80090a:	eb 05                	jmp    800911 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80090c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800911:	5d                   	pop    %ebp
+  800912:	c3                   	ret
+
+00800913 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	8b 45 08             	mov    0x8(%ebp),%eax
+  800919:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80091d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800920:	38 ca                	cmp    %cl,%dl
+  800922:	74 09                	je     80092d <strfind+0x1a>
+  800924:	84 d2                	test   %dl,%dl
+  800926:	74 05                	je     80092d <strfind+0x1a>
+	for (; *s; s++)
+  800928:	83 c0 01             	add    $0x1,%eax
+  80092b:	eb f0                	jmp    80091d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80092d:	5d                   	pop    %ebp
+  80092e:	c3                   	ret
+
+0080092f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	57                   	push   %edi
+  800933:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800936:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800939:	85 c9                	test   %ecx,%ecx
+  80093b:	74 20                	je     80095d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80093d:	89 f8                	mov    %edi,%eax
+  80093f:	09 c8                	or     %ecx,%eax
+  800941:	a8 03                	test   $0x3,%al
+  800943:	75 12                	jne    800957 <memset+0x28>
+		c &= 0xFF;
+  800945:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800949:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80094f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800952:	fc                   	cld
+  800953:	f3 ab                	rep stos %eax,%es:(%edi)
+  800955:	eb 06                	jmp    80095d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800957:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80095a:	fc                   	cld
+  80095b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80095d:	89 f8                	mov    %edi,%eax
+  80095f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800962:	c9                   	leave
+  800963:	c3                   	ret
+
+00800964 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	57                   	push   %edi
+  800968:	56                   	push   %esi
+  800969:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80096f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800972:	39 c6                	cmp    %eax,%esi
+  800974:	73 32                	jae    8009a8 <memmove+0x44>
+  800976:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800979:	39 d0                	cmp    %edx,%eax
+  80097b:	73 2b                	jae    8009a8 <memmove+0x44>
+		s += n;
+		d += n;
+  80097d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800980:	89 d6                	mov    %edx,%esi
+  800982:	09 fe                	or     %edi,%esi
+  800984:	09 ce                	or     %ecx,%esi
+  800986:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80098c:	75 0e                	jne    80099c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80098e:	83 ef 04             	sub    $0x4,%edi
+  800991:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800994:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800997:	fd                   	std
+  800998:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80099a:	eb 09                	jmp    8009a5 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80099c:	83 ef 01             	sub    $0x1,%edi
+  80099f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009a2:	fd                   	std
+  8009a3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009a5:	fc                   	cld
+  8009a6:	eb 1a                	jmp    8009c2 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009a8:	89 f2                	mov    %esi,%edx
+  8009aa:	09 c2                	or     %eax,%edx
+  8009ac:	09 ca                	or     %ecx,%edx
+  8009ae:	f6 c2 03             	test   $0x3,%dl
+  8009b1:	75 0a                	jne    8009bd <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009b3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009b6:	89 c7                	mov    %eax,%edi
+  8009b8:	fc                   	cld
+  8009b9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009bb:	eb 05                	jmp    8009c2 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009bd:	89 c7                	mov    %eax,%edi
+  8009bf:	fc                   	cld
+  8009c0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009c2:	5e                   	pop    %esi
+  8009c3:	5f                   	pop    %edi
+  8009c4:	5d                   	pop    %ebp
+  8009c5:	c3                   	ret
+
+008009c6 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009cc:	ff 75 10             	push   0x10(%ebp)
+  8009cf:	ff 75 0c             	push   0xc(%ebp)
+  8009d2:	ff 75 08             	push   0x8(%ebp)
+  8009d5:	e8 8a ff ff ff       	call   800964 <memmove>
+}
+  8009da:	c9                   	leave
+  8009db:	c3                   	ret
+
+008009dc <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	56                   	push   %esi
+  8009e0:	53                   	push   %ebx
+  8009e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009e7:	89 c6                	mov    %eax,%esi
+  8009e9:	03 75 10             	add    0x10(%ebp),%esi
+  8009ec:	eb 06                	jmp    8009f4 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009ee:	83 c0 01             	add    $0x1,%eax
+  8009f1:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009f4:	39 f0                	cmp    %esi,%eax
+  8009f6:	74 14                	je     800a0c <memcmp+0x30>
+		if (*s1 != *s2)
+  8009f8:	0f b6 08             	movzbl (%eax),%ecx
+  8009fb:	0f b6 1a             	movzbl (%edx),%ebx
+  8009fe:	38 d9                	cmp    %bl,%cl
+  800a00:	74 ec                	je     8009ee <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a02:	0f b6 c1             	movzbl %cl,%eax
+  800a05:	0f b6 db             	movzbl %bl,%ebx
+  800a08:	29 d8                	sub    %ebx,%eax
+  800a0a:	eb 05                	jmp    800a11 <memcmp+0x35>
+	}
+
+	return 0;
+  800a0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a11:	5b                   	pop    %ebx
+  800a12:	5e                   	pop    %esi
+  800a13:	5d                   	pop    %ebp
+  800a14:	c3                   	ret
+
+00800a15 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a1e:	89 c2                	mov    %eax,%edx
+  800a20:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a23:	eb 03                	jmp    800a28 <memfind+0x13>
+  800a25:	83 c0 01             	add    $0x1,%eax
+  800a28:	39 d0                	cmp    %edx,%eax
+  800a2a:	73 04                	jae    800a30 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a2c:	38 08                	cmp    %cl,(%eax)
+  800a2e:	75 f5                	jne    800a25 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a30:	5d                   	pop    %ebp
+  800a31:	c3                   	ret
+
+00800a32 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	57                   	push   %edi
+  800a36:	56                   	push   %esi
+  800a37:	53                   	push   %ebx
+  800a38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a3e:	eb 03                	jmp    800a43 <strtol+0x11>
+		s++;
+  800a40:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a43:	0f b6 02             	movzbl (%edx),%eax
+  800a46:	3c 20                	cmp    $0x20,%al
+  800a48:	74 f6                	je     800a40 <strtol+0xe>
+  800a4a:	3c 09                	cmp    $0x9,%al
+  800a4c:	74 f2                	je     800a40 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a4e:	3c 2b                	cmp    $0x2b,%al
+  800a50:	74 2a                	je     800a7c <strtol+0x4a>
+	int neg = 0;
+  800a52:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a57:	3c 2d                	cmp    $0x2d,%al
+  800a59:	74 2b                	je     800a86 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a5b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a61:	75 0f                	jne    800a72 <strtol+0x40>
+  800a63:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a66:	74 28                	je     800a90 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a68:	85 db                	test   %ebx,%ebx
+  800a6a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a6f:	0f 44 d8             	cmove  %eax,%ebx
+  800a72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a77:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a7a:	eb 46                	jmp    800ac2 <strtol+0x90>
+		s++;
+  800a7c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a84:	eb d5                	jmp    800a5b <strtol+0x29>
+		s++, neg = 1;
+  800a86:	83 c2 01             	add    $0x1,%edx
+  800a89:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a8e:	eb cb                	jmp    800a5b <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a90:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a94:	74 0e                	je     800aa4 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a96:	85 db                	test   %ebx,%ebx
+  800a98:	75 d8                	jne    800a72 <strtol+0x40>
+		s++, base = 8;
+  800a9a:	83 c2 01             	add    $0x1,%edx
+  800a9d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aa2:	eb ce                	jmp    800a72 <strtol+0x40>
+		s += 2, base = 16;
+  800aa4:	83 c2 02             	add    $0x2,%edx
+  800aa7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800aac:	eb c4                	jmp    800a72 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800aae:	0f be c0             	movsbl %al,%eax
+  800ab1:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ab4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ab7:	7d 3a                	jge    800af3 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ab9:	83 c2 01             	add    $0x1,%edx
+  800abc:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ac0:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ac2:	0f b6 02             	movzbl (%edx),%eax
+  800ac5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ac8:	89 f3                	mov    %esi,%ebx
+  800aca:	80 fb 09             	cmp    $0x9,%bl
+  800acd:	76 df                	jbe    800aae <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800acf:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ad2:	89 f3                	mov    %esi,%ebx
+  800ad4:	80 fb 19             	cmp    $0x19,%bl
+  800ad7:	77 08                	ja     800ae1 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ad9:	0f be c0             	movsbl %al,%eax
+  800adc:	83 e8 57             	sub    $0x57,%eax
+  800adf:	eb d3                	jmp    800ab4 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ae1:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ae4:	89 f3                	mov    %esi,%ebx
+  800ae6:	80 fb 19             	cmp    $0x19,%bl
+  800ae9:	77 08                	ja     800af3 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aeb:	0f be c0             	movsbl %al,%eax
+  800aee:	83 e8 37             	sub    $0x37,%eax
+  800af1:	eb c1                	jmp    800ab4 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800af3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800af7:	74 05                	je     800afe <strtol+0xcc>
+		*endptr = (char *) s;
+  800af9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800afc:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800afe:	89 c8                	mov    %ecx,%eax
+  800b00:	f7 d8                	neg    %eax
+  800b02:	85 ff                	test   %edi,%edi
+  800b04:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b07:	89 c8                	mov    %ecx,%eax
+  800b09:	5b                   	pop    %ebx
+  800b0a:	5e                   	pop    %esi
+  800b0b:	5f                   	pop    %edi
+  800b0c:	5d                   	pop    %ebp
+  800b0d:	c3                   	ret
+
+00800b0e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b0e:	55                   	push   %ebp
+  800b0f:	89 e5                	mov    %esp,%ebp
+  800b11:	57                   	push   %edi
+  800b12:	56                   	push   %esi
+  800b13:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b1f:	89 c3                	mov    %eax,%ebx
+  800b21:	89 c7                	mov    %eax,%edi
+  800b23:	89 c6                	mov    %eax,%esi
+  800b25:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b27:	5b                   	pop    %ebx
+  800b28:	5e                   	pop    %esi
+  800b29:	5f                   	pop    %edi
+  800b2a:	5d                   	pop    %ebp
+  800b2b:	c3                   	ret
+
+00800b2c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b2c:	55                   	push   %ebp
+  800b2d:	89 e5                	mov    %esp,%ebp
+  800b2f:	57                   	push   %edi
+  800b30:	56                   	push   %esi
+  800b31:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b32:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b37:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b3c:	89 d1                	mov    %edx,%ecx
+  800b3e:	89 d3                	mov    %edx,%ebx
+  800b40:	89 d7                	mov    %edx,%edi
+  800b42:	89 d6                	mov    %edx,%esi
+  800b44:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b46:	5b                   	pop    %ebx
+  800b47:	5e                   	pop    %esi
+  800b48:	5f                   	pop    %edi
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+
+00800b4b <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	57                   	push   %edi
+  800b4f:	56                   	push   %esi
+  800b50:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b59:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b5e:	89 cb                	mov    %ecx,%ebx
+  800b60:	89 cf                	mov    %ecx,%edi
+  800b62:	89 ce                	mov    %ecx,%esi
+  800b64:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b66:	5b                   	pop    %ebx
+  800b67:	5e                   	pop    %esi
+  800b68:	5f                   	pop    %edi
+  800b69:	5d                   	pop    %ebp
+  800b6a:	c3                   	ret
+
+00800b6b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b6b:	55                   	push   %ebp
+  800b6c:	89 e5                	mov    %esp,%ebp
+  800b6e:	57                   	push   %edi
+  800b6f:	56                   	push   %esi
+  800b70:	53                   	push   %ebx
+  800b71:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b81:	89 cb                	mov    %ecx,%ebx
+  800b83:	89 cf                	mov    %ecx,%edi
+  800b85:	89 ce                	mov    %ecx,%esi
+  800b87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b89:	85 c0                	test   %eax,%eax
+  800b8b:	7f 08                	jg     800b95 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b90:	5b                   	pop    %ebx
+  800b91:	5e                   	pop    %esi
+  800b92:	5f                   	pop    %edi
+  800b93:	5d                   	pop    %ebp
+  800b94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b95:	83 ec 0c             	sub    $0xc,%esp
+  800b98:	50                   	push   %eax
+  800b99:	6a 03                	push   $0x3
+  800b9b:	68 1f 2b 80 00       	push   $0x802b1f
+  800ba0:	6a 23                	push   $0x23
+  800ba2:	68 3c 2b 80 00       	push   $0x802b3c
+  800ba7:	e8 69 f5 ff ff       	call   800115 <_panic>
+
+00800bac <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	57                   	push   %edi
+  800bb0:	56                   	push   %esi
+  800bb1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bbc:	89 d1                	mov    %edx,%ecx
+  800bbe:	89 d3                	mov    %edx,%ebx
+  800bc0:	89 d7                	mov    %edx,%edi
+  800bc2:	89 d6                	mov    %edx,%esi
+  800bc4:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bc6:	5b                   	pop    %ebx
+  800bc7:	5e                   	pop    %esi
+  800bc8:	5f                   	pop    %edi
+  800bc9:	5d                   	pop    %ebp
+  800bca:	c3                   	ret
+
+00800bcb <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bcb:	55                   	push   %ebp
+  800bcc:	89 e5                	mov    %esp,%ebp
+  800bce:	57                   	push   %edi
+  800bcf:	56                   	push   %esi
+  800bd0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd6:	b8 16 00 00 00       	mov    $0x16,%eax
+  800bdb:	89 d1                	mov    %edx,%ecx
+  800bdd:	89 d3                	mov    %edx,%ebx
+  800bdf:	89 d7                	mov    %edx,%edi
+  800be1:	89 d6                	mov    %edx,%esi
+  800be3:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800be5:	5b                   	pop    %ebx
+  800be6:	5e                   	pop    %esi
+  800be7:	5f                   	pop    %edi
+  800be8:	5d                   	pop    %ebp
+  800be9:	c3                   	ret
+
+00800bea <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	57                   	push   %edi
+  800bee:	56                   	push   %esi
+  800bef:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bf0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800bfa:	89 d1                	mov    %edx,%ecx
+  800bfc:	89 d3                	mov    %edx,%ebx
+  800bfe:	89 d7                	mov    %edx,%edi
+  800c00:	89 d6                	mov    %edx,%esi
+  800c02:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800c04:	5b                   	pop    %ebx
+  800c05:	5e                   	pop    %esi
+  800c06:	5f                   	pop    %edi
+  800c07:	5d                   	pop    %ebp
+  800c08:	c3                   	ret
+
+00800c09 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800c09:	55                   	push   %ebp
+  800c0a:	89 e5                	mov    %esp,%ebp
+  800c0c:	57                   	push   %edi
+  800c0d:	56                   	push   %esi
+  800c0e:	53                   	push   %ebx
+  800c0f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c1d:	b8 15 00 00 00       	mov    $0x15,%eax
+  800c22:	89 df                	mov    %ebx,%edi
+  800c24:	89 de                	mov    %ebx,%esi
+  800c26:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c28:	85 c0                	test   %eax,%eax
+  800c2a:	7f 08                	jg     800c34 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800c2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2f:	5b                   	pop    %ebx
+  800c30:	5e                   	pop    %esi
+  800c31:	5f                   	pop    %edi
+  800c32:	5d                   	pop    %ebp
+  800c33:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c34:	83 ec 0c             	sub    $0xc,%esp
+  800c37:	50                   	push   %eax
+  800c38:	6a 15                	push   $0x15
+  800c3a:	68 1f 2b 80 00       	push   $0x802b1f
+  800c3f:	6a 23                	push   $0x23
+  800c41:	68 3c 2b 80 00       	push   $0x802b3c
+  800c46:	e8 ca f4 ff ff       	call   800115 <_panic>
+
+00800c4b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c4b:	55                   	push   %ebp
+  800c4c:	89 e5                	mov    %esp,%ebp
+  800c4e:	57                   	push   %edi
+  800c4f:	56                   	push   %esi
+  800c50:	53                   	push   %ebx
+  800c51:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c54:	be 00 00 00 00       	mov    $0x0,%esi
+  800c59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c67:	89 f7                	mov    %esi,%edi
+  800c69:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c6b:	85 c0                	test   %eax,%eax
+  800c6d:	7f 08                	jg     800c77 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c72:	5b                   	pop    %ebx
+  800c73:	5e                   	pop    %esi
+  800c74:	5f                   	pop    %edi
+  800c75:	5d                   	pop    %ebp
+  800c76:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c77:	83 ec 0c             	sub    $0xc,%esp
+  800c7a:	50                   	push   %eax
+  800c7b:	6a 05                	push   $0x5
+  800c7d:	68 1f 2b 80 00       	push   $0x802b1f
+  800c82:	6a 23                	push   $0x23
+  800c84:	68 3c 2b 80 00       	push   $0x802b3c
+  800c89:	e8 87 f4 ff ff       	call   800115 <_panic>
+
+00800c8e <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800c8e:	55                   	push   %ebp
+  800c8f:	89 e5                	mov    %esp,%ebp
+  800c91:	57                   	push   %edi
+  800c92:	56                   	push   %esi
+  800c93:	53                   	push   %ebx
+  800c94:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c97:	be 00 00 00 00       	mov    $0x0,%esi
+  800c9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca2:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ca7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800caa:	89 f7                	mov    %esi,%edi
+  800cac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cae:	85 c0                	test   %eax,%eax
+  800cb0:	7f 08                	jg     800cba <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb5:	5b                   	pop    %ebx
+  800cb6:	5e                   	pop    %esi
+  800cb7:	5f                   	pop    %edi
+  800cb8:	5d                   	pop    %ebp
+  800cb9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cba:	83 ec 0c             	sub    $0xc,%esp
+  800cbd:	50                   	push   %eax
+  800cbe:	6a 06                	push   $0x6
+  800cc0:	68 1f 2b 80 00       	push   $0x802b1f
+  800cc5:	6a 23                	push   $0x23
+  800cc7:	68 3c 2b 80 00       	push   $0x802b3c
+  800ccc:	e8 44 f4 ff ff       	call   800115 <_panic>
+
+00800cd1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cd1:	55                   	push   %ebp
+  800cd2:	89 e5                	mov    %esp,%ebp
+  800cd4:	57                   	push   %edi
+  800cd5:	56                   	push   %esi
+  800cd6:	53                   	push   %ebx
+  800cd7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce0:	b8 07 00 00 00       	mov    $0x7,%eax
+  800ce5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ce8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ceb:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cf0:	85 c0                	test   %eax,%eax
+  800cf2:	7f 08                	jg     800cfc <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cf4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf7:	5b                   	pop    %ebx
+  800cf8:	5e                   	pop    %esi
+  800cf9:	5f                   	pop    %edi
+  800cfa:	5d                   	pop    %ebp
+  800cfb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cfc:	83 ec 0c             	sub    $0xc,%esp
+  800cff:	50                   	push   %eax
+  800d00:	6a 07                	push   $0x7
+  800d02:	68 1f 2b 80 00       	push   $0x802b1f
+  800d07:	6a 23                	push   $0x23
+  800d09:	68 3c 2b 80 00       	push   $0x802b3c
+  800d0e:	e8 02 f4 ff ff       	call   800115 <_panic>
+
+00800d13 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d13:	55                   	push   %ebp
+  800d14:	89 e5                	mov    %esp,%ebp
+  800d16:	57                   	push   %edi
+  800d17:	56                   	push   %esi
+  800d18:	53                   	push   %ebx
+  800d19:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d27:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d2c:	89 df                	mov    %ebx,%edi
+  800d2e:	89 de                	mov    %ebx,%esi
+  800d30:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d32:	85 c0                	test   %eax,%eax
+  800d34:	7f 08                	jg     800d3e <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d39:	5b                   	pop    %ebx
+  800d3a:	5e                   	pop    %esi
+  800d3b:	5f                   	pop    %edi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d3e:	83 ec 0c             	sub    $0xc,%esp
+  800d41:	50                   	push   %eax
+  800d42:	6a 08                	push   $0x8
+  800d44:	68 1f 2b 80 00       	push   $0x802b1f
+  800d49:	6a 23                	push   $0x23
+  800d4b:	68 3c 2b 80 00       	push   $0x802b3c
+  800d50:	e8 c0 f3 ff ff       	call   800115 <_panic>
+
+00800d55 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d55:	55                   	push   %ebp
+  800d56:	89 e5                	mov    %esp,%ebp
+  800d58:	57                   	push   %edi
+  800d59:	56                   	push   %esi
+  800d5a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d61:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d66:	be 00 00 00 00       	mov    $0x0,%esi
+  800d6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d6e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d71:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d73:	5b                   	pop    %ebx
+  800d74:	5e                   	pop    %esi
+  800d75:	5f                   	pop    %edi
+  800d76:	5d                   	pop    %ebp
+  800d77:	c3                   	ret
+
+00800d78 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d78:	55                   	push   %ebp
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	57                   	push   %edi
+  800d7c:	56                   	push   %esi
+  800d7d:	53                   	push   %ebx
+  800d7e:	8b 45 18             	mov    0x18(%ebp),%eax
+  800d81:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800d84:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800d89:	77 27                	ja     800db2 <sys_page_map_range+0x3a>
+  800d8b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800d91:	77 1f                	ja     800db2 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800d93:	c1 e0 0c             	shl    $0xc,%eax
+  800d96:	89 c6                	mov    %eax,%esi
+  800d98:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800d9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800da5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dab:	cd 30                	int    $0x30
+}
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+		return -E_INVAL;
+  800db2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800db7:	eb f4                	jmp    800dad <sys_page_map_range+0x35>
+
+00800db9 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	57                   	push   %edi
+  800dbd:	56                   	push   %esi
+  800dbe:	53                   	push   %ebx
+  800dbf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dcd:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dd8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dda:	85 c0                	test   %eax,%eax
+  800ddc:	7f 08                	jg     800de6 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800dde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de1:	5b                   	pop    %ebx
+  800de2:	5e                   	pop    %esi
+  800de3:	5f                   	pop    %edi
+  800de4:	5d                   	pop    %ebp
+  800de5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de6:	83 ec 0c             	sub    $0xc,%esp
+  800de9:	50                   	push   %eax
+  800dea:	6a 0c                	push   $0xc
+  800dec:	68 1f 2b 80 00       	push   $0x802b1f
+  800df1:	6a 23                	push   $0x23
+  800df3:	68 3c 2b 80 00       	push   $0x802b3c
+  800df8:	e8 18 f3 ff ff       	call   800115 <_panic>
+
+00800dfd <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800dfd:	55                   	push   %ebp
+  800dfe:	89 e5                	mov    %esp,%ebp
+  800e00:	57                   	push   %edi
+  800e01:	56                   	push   %esi
+  800e02:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e03:	be 00 00 00 00       	mov    $0x0,%esi
+  800e08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e13:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e16:	89 f7                	mov    %esi,%edi
+  800e18:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e1a:	5b                   	pop    %ebx
+  800e1b:	5e                   	pop    %esi
+  800e1c:	5f                   	pop    %edi
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	c3                   	ret
+
+00800e1f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e1f:	55                   	push   %ebp
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	57                   	push   %edi
+  800e23:	56                   	push   %esi
+  800e24:	53                   	push   %ebx
+  800e25:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e33:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e38:	89 df                	mov    %ebx,%edi
+  800e3a:	89 de                	mov    %ebx,%esi
+  800e3c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e3e:	85 c0                	test   %eax,%eax
+  800e40:	7f 08                	jg     800e4a <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e45:	5b                   	pop    %ebx
+  800e46:	5e                   	pop    %esi
+  800e47:	5f                   	pop    %edi
+  800e48:	5d                   	pop    %ebp
+  800e49:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e4a:	83 ec 0c             	sub    $0xc,%esp
+  800e4d:	50                   	push   %eax
+  800e4e:	6a 0f                	push   $0xf
+  800e50:	68 1f 2b 80 00       	push   $0x802b1f
+  800e55:	6a 23                	push   $0x23
+  800e57:	68 3c 2b 80 00       	push   $0x802b3c
+  800e5c:	e8 b4 f2 ff ff       	call   800115 <_panic>
+
+00800e61 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	57                   	push   %edi
+  800e65:	56                   	push   %esi
+  800e66:	53                   	push   %ebx
+  800e67:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e75:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e7a:	89 df                	mov    %ebx,%edi
+  800e7c:	89 de                	mov    %ebx,%esi
+  800e7e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e80:	85 c0                	test   %eax,%eax
+  800e82:	7f 08                	jg     800e8c <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800e84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e87:	5b                   	pop    %ebx
+  800e88:	5e                   	pop    %esi
+  800e89:	5f                   	pop    %edi
+  800e8a:	5d                   	pop    %ebp
+  800e8b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8c:	83 ec 0c             	sub    $0xc,%esp
+  800e8f:	50                   	push   %eax
+  800e90:	6a 10                	push   $0x10
+  800e92:	68 1f 2b 80 00       	push   $0x802b1f
+  800e97:	6a 23                	push   $0x23
+  800e99:	68 3c 2b 80 00       	push   $0x802b3c
+  800e9e:	e8 72 f2 ff ff       	call   800115 <_panic>
+
+00800ea3 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800ea3:	55                   	push   %ebp
+  800ea4:	89 e5                	mov    %esp,%ebp
+  800ea6:	57                   	push   %edi
+  800ea7:	56                   	push   %esi
+  800ea8:	53                   	push   %ebx
+  800ea9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb7:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ebc:	89 df                	mov    %ebx,%edi
+  800ebe:	89 de                	mov    %ebx,%esi
+  800ec0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec2:	85 c0                	test   %eax,%eax
+  800ec4:	7f 08                	jg     800ece <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800ec6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec9:	5b                   	pop    %ebx
+  800eca:	5e                   	pop    %esi
+  800ecb:	5f                   	pop    %edi
+  800ecc:	5d                   	pop    %ebp
+  800ecd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ece:	83 ec 0c             	sub    $0xc,%esp
+  800ed1:	50                   	push   %eax
+  800ed2:	6a 11                	push   $0x11
+  800ed4:	68 1f 2b 80 00       	push   $0x802b1f
+  800ed9:	6a 23                	push   $0x23
+  800edb:	68 3c 2b 80 00       	push   $0x802b3c
+  800ee0:	e8 30 f2 ff ff       	call   800115 <_panic>
+
+00800ee5 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800ee5:	55                   	push   %ebp
+  800ee6:	89 e5                	mov    %esp,%ebp
+  800ee8:	57                   	push   %edi
+  800ee9:	56                   	push   %esi
+  800eea:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eeb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef0:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ef5:	89 d1                	mov    %edx,%ecx
+  800ef7:	89 d3                	mov    %edx,%ebx
+  800ef9:	89 d7                	mov    %edx,%edi
+  800efb:	89 d6                	mov    %edx,%esi
+  800efd:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800eff:	5b                   	pop    %ebx
+  800f00:	5e                   	pop    %esi
+  800f01:	5f                   	pop    %edi
+  800f02:	5d                   	pop    %ebp
+  800f03:	c3                   	ret
+
+00800f04 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f04:	55                   	push   %ebp
+  800f05:	89 e5                	mov    %esp,%ebp
+  800f07:	57                   	push   %edi
+  800f08:	56                   	push   %esi
+  800f09:	53                   	push   %ebx
+  800f0a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f18:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f1d:	89 df                	mov    %ebx,%edi
+  800f1f:	89 de                	mov    %ebx,%esi
+  800f21:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f23:	85 c0                	test   %eax,%eax
+  800f25:	7f 08                	jg     800f2f <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2a:	5b                   	pop    %ebx
+  800f2b:	5e                   	pop    %esi
+  800f2c:	5f                   	pop    %edi
+  800f2d:	5d                   	pop    %ebp
+  800f2e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2f:	83 ec 0c             	sub    $0xc,%esp
+  800f32:	50                   	push   %eax
+  800f33:	6a 13                	push   $0x13
+  800f35:	68 1f 2b 80 00       	push   $0x802b1f
+  800f3a:	6a 23                	push   $0x23
+  800f3c:	68 3c 2b 80 00       	push   $0x802b3c
+  800f41:	e8 cf f1 ff ff       	call   800115 <_panic>
+
+00800f46 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f46:	55                   	push   %ebp
+  800f47:	89 e5                	mov    %esp,%ebp
+  800f49:	57                   	push   %edi
+  800f4a:	56                   	push   %esi
+  800f4b:	53                   	push   %ebx
+  800f4c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5a:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f5f:	89 df                	mov    %ebx,%edi
+  800f61:	89 de                	mov    %ebx,%esi
+  800f63:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f65:	85 c0                	test   %eax,%eax
+  800f67:	7f 08                	jg     800f71 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f6c:	5b                   	pop    %ebx
+  800f6d:	5e                   	pop    %esi
+  800f6e:	5f                   	pop    %edi
+  800f6f:	5d                   	pop    %ebp
+  800f70:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f71:	83 ec 0c             	sub    $0xc,%esp
+  800f74:	50                   	push   %eax
+  800f75:	6a 14                	push   $0x14
+  800f77:	68 1f 2b 80 00       	push   $0x802b1f
+  800f7c:	6a 23                	push   $0x23
+  800f7e:	68 3c 2b 80 00       	push   $0x802b3c
+  800f83:	e8 8d f1 ff ff       	call   800115 <_panic>
+
+00800f88 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	57                   	push   %edi
+  800f8c:	56                   	push   %esi
+  800f8d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f94:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f99:	be 00 00 00 00       	mov    $0x0,%esi
+  800f9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fa4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fa6:	5b                   	pop    %ebx
+  800fa7:	5e                   	pop    %esi
+  800fa8:	5f                   	pop    %edi
+  800fa9:	5d                   	pop    %ebp
+  800faa:	c3                   	ret
+
+00800fab <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fab:	55                   	push   %ebp
+  800fac:	89 e5                	mov    %esp,%ebp
+  800fae:	57                   	push   %edi
+  800faf:	56                   	push   %esi
+  800fb0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb7:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fbc:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fc9:	5b                   	pop    %ebx
+  800fca:	5e                   	pop    %esi
+  800fcb:	5f                   	pop    %edi
+  800fcc:	5d                   	pop    %ebp
+  800fcd:	c3                   	ret
+
+00800fce <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	57                   	push   %edi
+  800fd2:	56                   	push   %esi
+  800fd3:	53                   	push   %ebx
+  800fd4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdf:	b8 19 00 00 00       	mov    $0x19,%eax
+  800fe4:	89 cb                	mov    %ecx,%ebx
+  800fe6:	89 cf                	mov    %ecx,%edi
+  800fe8:	89 ce                	mov    %ecx,%esi
+  800fea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fec:	85 c0                	test   %eax,%eax
+  800fee:	7f 08                	jg     800ff8 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800ff0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff3:	5b                   	pop    %ebx
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5f                   	pop    %edi
+  800ff6:	5d                   	pop    %ebp
+  800ff7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff8:	83 ec 0c             	sub    $0xc,%esp
+  800ffb:	50                   	push   %eax
+  800ffc:	6a 19                	push   $0x19
+  800ffe:	68 1f 2b 80 00       	push   $0x802b1f
+  801003:	6a 23                	push   $0x23
+  801005:	68 3c 2b 80 00       	push   $0x802b3c
+  80100a:	e8 06 f1 ff ff       	call   800115 <_panic>
+
+0080100f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	56                   	push   %esi
+  801014:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801015:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80101f:	89 d1                	mov    %edx,%ecx
+  801021:	89 d3                	mov    %edx,%ebx
+  801023:	89 d7                	mov    %edx,%edi
+  801025:	89 d6                	mov    %edx,%esi
+  801027:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801029:	5b                   	pop    %ebx
+  80102a:	5e                   	pop    %esi
+  80102b:	5f                   	pop    %edi
+  80102c:	5d                   	pop    %ebp
+  80102d:	c3                   	ret
+
+0080102e <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  80102e:	55                   	push   %ebp
+  80102f:	89 e5                	mov    %esp,%ebp
+  801031:	57                   	push   %edi
+  801032:	56                   	push   %esi
+  801033:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801034:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801039:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801044:	89 df                	mov    %ebx,%edi
+  801046:	89 de                	mov    %ebx,%esi
+  801048:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  80104a:	5b                   	pop    %ebx
+  80104b:	5e                   	pop    %esi
+  80104c:	5f                   	pop    %edi
+  80104d:	5d                   	pop    %ebp
+  80104e:	c3                   	ret
+
+0080104f <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	57                   	push   %edi
+  801053:	56                   	push   %esi
+  801054:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801055:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801060:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801065:	89 df                	mov    %ebx,%edi
+  801067:	89 de                	mov    %ebx,%esi
+  801069:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  80106b:	5b                   	pop    %ebx
+  80106c:	5e                   	pop    %esi
+  80106d:	5f                   	pop    %edi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+
+00801070 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801070:	55                   	push   %ebp
+  801071:	89 e5                	mov    %esp,%ebp
+  801073:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801076:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  80107d:	74 0a                	je     801089 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80107f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801082:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  801087:	c9                   	leave
+  801088:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  801089:	83 ec 04             	sub    $0x4,%esp
+  80108c:	6a 07                	push   $0x7
+  80108e:	68 00 f0 bf ee       	push   $0xeebff000
+  801093:	6a 00                	push   $0x0
+  801095:	e8 b1 fb ff ff       	call   800c4b <sys_page_alloc>
+  80109a:	83 c4 10             	add    $0x10,%esp
+  80109d:	85 c0                	test   %eax,%eax
+  80109f:	78 28                	js     8010c9 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  8010a1:	83 ec 08             	sub    $0x8,%esp
+  8010a4:	68 db 10 80 00       	push   $0x8010db
+  8010a9:	6a 00                	push   $0x0
+  8010ab:	e8 96 fe ff ff       	call   800f46 <sys_env_set_pgfault_upcall>
+  8010b0:	83 c4 10             	add    $0x10,%esp
+  8010b3:	85 c0                	test   %eax,%eax
+  8010b5:	79 c8                	jns    80107f <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  8010b7:	50                   	push   %eax
+  8010b8:	68 6b 2b 80 00       	push   $0x802b6b
+  8010bd:	6a 24                	push   $0x24
+  8010bf:	68 5d 2b 80 00       	push   $0x802b5d
+  8010c4:	e8 4c f0 ff ff       	call   800115 <_panic>
+			panic("sys_page_alloc: %e", r);
+  8010c9:	50                   	push   %eax
+  8010ca:	68 4a 2b 80 00       	push   $0x802b4a
+  8010cf:	6a 21                	push   $0x21
+  8010d1:	68 5d 2b 80 00       	push   $0x802b5d
+  8010d6:	e8 3a f0 ff ff       	call   800115 <_panic>
+
+008010db <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8010db:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8010dc:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  8010e1:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8010e3:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8010e6:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  8010e9:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  8010ed:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  8010f0:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  8010f4:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  8010f8:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  8010fa:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8010fb:	83 c4 04             	add    $0x4,%esp
+	popf
+  8010fe:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8010ff:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801100:	c3                   	ret
+
+00801101 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801104:	8b 45 08             	mov    0x8(%ebp),%eax
+  801107:	05 00 00 00 30       	add    $0x30000000,%eax
+  80110c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+
+00801111 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801114:	8b 45 08             	mov    0x8(%ebp),%eax
+  801117:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80111c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801121:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801126:	5d                   	pop    %ebp
+  801127:	c3                   	ret
+
+00801128 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80112b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801130:	eb 02                	jmp    801134 <fd_alloc+0xc>
+  801132:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801134:	89 c2                	mov    %eax,%edx
+  801136:	c1 ea 16             	shr    $0x16,%edx
+  801139:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801140:	f6 c2 01             	test   $0x1,%dl
+  801143:	74 2b                	je     801170 <fd_alloc+0x48>
+  801145:	89 c2                	mov    %eax,%edx
+  801147:	c1 ea 0c             	shr    $0xc,%edx
+  80114a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801151:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801157:	f6 c1 01             	test   $0x1,%cl
+  80115a:	74 14                	je     801170 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80115c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801162:	75 ce                	jne    801132 <fd_alloc+0xa>
+  801164:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801169:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80116e:	eb 05                	jmp    801175 <fd_alloc+0x4d>
+			return 0;
+  801170:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801175:	8b 55 08             	mov    0x8(%ebp),%edx
+  801178:	89 02                	mov    %eax,(%edx)
+}
+  80117a:	89 c8                	mov    %ecx,%eax
+  80117c:	5d                   	pop    %ebp
+  80117d:	c3                   	ret
+
+0080117e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801184:	83 f8 1f             	cmp    $0x1f,%eax
+  801187:	77 30                	ja     8011b9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801189:	c1 e0 0c             	shl    $0xc,%eax
+  80118c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801191:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801197:	f6 c2 01             	test   $0x1,%dl
+  80119a:	74 24                	je     8011c0 <fd_lookup+0x42>
+  80119c:	89 c2                	mov    %eax,%edx
+  80119e:	c1 ea 0c             	shr    $0xc,%edx
+  8011a1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011a8:	f6 c2 01             	test   $0x1,%dl
+  8011ab:	74 1a                	je     8011c7 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011b0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+		return -E_INVAL;
+  8011b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011be:	eb f7                	jmp    8011b7 <fd_lookup+0x39>
+		return -E_INVAL;
+  8011c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011c5:	eb f0                	jmp    8011b7 <fd_lookup+0x39>
+  8011c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011cc:	eb e9                	jmp    8011b7 <fd_lookup+0x39>
+
+008011ce <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011ce:	55                   	push   %ebp
+  8011cf:	89 e5                	mov    %esp,%ebp
+  8011d1:	53                   	push   %ebx
+  8011d2:	83 ec 04             	sub    $0x4,%esp
+  8011d5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011dd:	eb 03                	jmp    8011e2 <dev_lookup+0x14>
+  8011df:	83 c0 01             	add    $0x1,%eax
+  8011e2:	8b 1c 85 08 2c 80 00 	mov    0x802c08(,%eax,4),%ebx
+  8011e9:	85 db                	test   %ebx,%ebx
+  8011eb:	74 0b                	je     8011f8 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8011ed:	39 13                	cmp    %edx,(%ebx)
+  8011ef:	75 ee                	jne    8011df <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8011f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f6:	eb 1f                	jmp    801217 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8011f8:	a1 08 40 80 00       	mov    0x804008,%eax
+  8011fd:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801200:	83 ec 04             	sub    $0x4,%esp
+  801203:	52                   	push   %edx
+  801204:	50                   	push   %eax
+  801205:	68 8c 2b 80 00       	push   $0x802b8c
+  80120a:	e8 e1 ef ff ff       	call   8001f0 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80120f:	83 c4 10             	add    $0x10,%esp
+  801212:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801217:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80121a:	89 1a                	mov    %ebx,(%edx)
+}
+  80121c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80121f:	c9                   	leave
+  801220:	c3                   	ret
+
+00801221 <fd_close>:
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	57                   	push   %edi
+  801225:	56                   	push   %esi
+  801226:	53                   	push   %ebx
+  801227:	83 ec 24             	sub    $0x24,%esp
+  80122a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80122d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801230:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801233:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801234:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80123a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80123d:	50                   	push   %eax
+  80123e:	e8 3b ff ff ff       	call   80117e <fd_lookup>
+  801243:	89 c3                	mov    %eax,%ebx
+  801245:	83 c4 10             	add    $0x10,%esp
+  801248:	85 c0                	test   %eax,%eax
+  80124a:	78 05                	js     801251 <fd_close+0x30>
+	    || fd != fd2)
+  80124c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80124f:	74 16                	je     801267 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801251:	89 f8                	mov    %edi,%eax
+  801253:	84 c0                	test   %al,%al
+  801255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80125d:	89 d8                	mov    %ebx,%eax
+  80125f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801262:	5b                   	pop    %ebx
+  801263:	5e                   	pop    %esi
+  801264:	5f                   	pop    %edi
+  801265:	5d                   	pop    %ebp
+  801266:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801267:	83 ec 08             	sub    $0x8,%esp
+  80126a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80126d:	50                   	push   %eax
+  80126e:	ff 36                	push   (%esi)
+  801270:	e8 59 ff ff ff       	call   8011ce <dev_lookup>
+  801275:	89 c3                	mov    %eax,%ebx
+  801277:	83 c4 10             	add    $0x10,%esp
+  80127a:	85 c0                	test   %eax,%eax
+  80127c:	78 1a                	js     801298 <fd_close+0x77>
+		if (dev->dev_close)
+  80127e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801281:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801284:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801289:	85 c0                	test   %eax,%eax
+  80128b:	74 0b                	je     801298 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80128d:	83 ec 0c             	sub    $0xc,%esp
+  801290:	56                   	push   %esi
+  801291:	ff d0                	call   *%eax
+  801293:	89 c3                	mov    %eax,%ebx
+  801295:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801298:	83 ec 08             	sub    $0x8,%esp
+  80129b:	56                   	push   %esi
+  80129c:	6a 00                	push   $0x0
+  80129e:	e8 70 fa ff ff       	call   800d13 <sys_page_unmap>
+	return r;
+  8012a3:	83 c4 10             	add    $0x10,%esp
+  8012a6:	eb b5                	jmp    80125d <fd_close+0x3c>
+
+008012a8 <close>:
+
+int
+close(int fdnum)
+{
+  8012a8:	55                   	push   %ebp
+  8012a9:	89 e5                	mov    %esp,%ebp
+  8012ab:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012b1:	50                   	push   %eax
+  8012b2:	ff 75 08             	push   0x8(%ebp)
+  8012b5:	e8 c4 fe ff ff       	call   80117e <fd_lookup>
+  8012ba:	83 c4 10             	add    $0x10,%esp
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	79 02                	jns    8012c3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012c1:	c9                   	leave
+  8012c2:	c3                   	ret
+		return fd_close(fd, 1);
+  8012c3:	83 ec 08             	sub    $0x8,%esp
+  8012c6:	6a 01                	push   $0x1
+  8012c8:	ff 75 f4             	push   -0xc(%ebp)
+  8012cb:	e8 51 ff ff ff       	call   801221 <fd_close>
+  8012d0:	83 c4 10             	add    $0x10,%esp
+  8012d3:	eb ec                	jmp    8012c1 <close+0x19>
+
+008012d5 <close_all>:
+
+void
+close_all(void)
+{
+  8012d5:	55                   	push   %ebp
+  8012d6:	89 e5                	mov    %esp,%ebp
+  8012d8:	53                   	push   %ebx
+  8012d9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8012dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8012e1:	83 ec 0c             	sub    $0xc,%esp
+  8012e4:	53                   	push   %ebx
+  8012e5:	e8 be ff ff ff       	call   8012a8 <close>
+	for (i = 0; i < MAXFD; i++)
+  8012ea:	83 c3 01             	add    $0x1,%ebx
+  8012ed:	83 c4 10             	add    $0x10,%esp
+  8012f0:	83 fb 20             	cmp    $0x20,%ebx
+  8012f3:	75 ec                	jne    8012e1 <close_all+0xc>
+}
+  8012f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f8:	c9                   	leave
+  8012f9:	c3                   	ret
+
+008012fa <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8012fa:	55                   	push   %ebp
+  8012fb:	89 e5                	mov    %esp,%ebp
+  8012fd:	57                   	push   %edi
+  8012fe:	56                   	push   %esi
+  8012ff:	53                   	push   %ebx
+  801300:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801303:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801306:	50                   	push   %eax
+  801307:	ff 75 08             	push   0x8(%ebp)
+  80130a:	e8 6f fe ff ff       	call   80117e <fd_lookup>
+  80130f:	89 c3                	mov    %eax,%ebx
+  801311:	83 c4 10             	add    $0x10,%esp
+  801314:	85 c0                	test   %eax,%eax
+  801316:	78 7f                	js     801397 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801318:	83 ec 0c             	sub    $0xc,%esp
+  80131b:	ff 75 0c             	push   0xc(%ebp)
+  80131e:	e8 85 ff ff ff       	call   8012a8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801323:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801326:	c1 e6 0c             	shl    $0xc,%esi
+  801329:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80132f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801332:	89 3c 24             	mov    %edi,(%esp)
+  801335:	e8 d7 fd ff ff       	call   801111 <fd2data>
+  80133a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80133c:	89 34 24             	mov    %esi,(%esp)
+  80133f:	e8 cd fd ff ff       	call   801111 <fd2data>
+  801344:	83 c4 10             	add    $0x10,%esp
+  801347:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80134a:	89 d8                	mov    %ebx,%eax
+  80134c:	c1 e8 16             	shr    $0x16,%eax
+  80134f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801356:	a8 01                	test   $0x1,%al
+  801358:	74 11                	je     80136b <dup+0x71>
+  80135a:	89 d8                	mov    %ebx,%eax
+  80135c:	c1 e8 0c             	shr    $0xc,%eax
+  80135f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801366:	f6 c2 01             	test   $0x1,%dl
+  801369:	75 36                	jne    8013a1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80136b:	89 f8                	mov    %edi,%eax
+  80136d:	c1 e8 0c             	shr    $0xc,%eax
+  801370:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801377:	83 ec 0c             	sub    $0xc,%esp
+  80137a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80137f:	50                   	push   %eax
+  801380:	56                   	push   %esi
+  801381:	6a 00                	push   $0x0
+  801383:	57                   	push   %edi
+  801384:	6a 00                	push   $0x0
+  801386:	e8 46 f9 ff ff       	call   800cd1 <sys_page_map>
+  80138b:	89 c3                	mov    %eax,%ebx
+  80138d:	83 c4 20             	add    $0x20,%esp
+  801390:	85 c0                	test   %eax,%eax
+  801392:	78 33                	js     8013c7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801394:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801397:	89 d8                	mov    %ebx,%eax
+  801399:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139c:	5b                   	pop    %ebx
+  80139d:	5e                   	pop    %esi
+  80139e:	5f                   	pop    %edi
+  80139f:	5d                   	pop    %ebp
+  8013a0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013a1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+  8013ab:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013b0:	50                   	push   %eax
+  8013b1:	ff 75 d4             	push   -0x2c(%ebp)
+  8013b4:	6a 00                	push   $0x0
+  8013b6:	53                   	push   %ebx
+  8013b7:	6a 00                	push   $0x0
+  8013b9:	e8 13 f9 ff ff       	call   800cd1 <sys_page_map>
+  8013be:	89 c3                	mov    %eax,%ebx
+  8013c0:	83 c4 20             	add    $0x20,%esp
+  8013c3:	85 c0                	test   %eax,%eax
+  8013c5:	79 a4                	jns    80136b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013c7:	83 ec 08             	sub    $0x8,%esp
+  8013ca:	56                   	push   %esi
+  8013cb:	6a 00                	push   $0x0
+  8013cd:	e8 41 f9 ff ff       	call   800d13 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8013d2:	83 c4 08             	add    $0x8,%esp
+  8013d5:	ff 75 d4             	push   -0x2c(%ebp)
+  8013d8:	6a 00                	push   $0x0
+  8013da:	e8 34 f9 ff ff       	call   800d13 <sys_page_unmap>
+	return r;
+  8013df:	83 c4 10             	add    $0x10,%esp
+  8013e2:	eb b3                	jmp    801397 <dup+0x9d>
+
+008013e4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013e4:	55                   	push   %ebp
+  8013e5:	89 e5                	mov    %esp,%ebp
+  8013e7:	56                   	push   %esi
+  8013e8:	53                   	push   %ebx
+  8013e9:	83 ec 18             	sub    $0x18,%esp
+  8013ec:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013ef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013f2:	50                   	push   %eax
+  8013f3:	56                   	push   %esi
+  8013f4:	e8 85 fd ff ff       	call   80117e <fd_lookup>
+  8013f9:	83 c4 10             	add    $0x10,%esp
+  8013fc:	85 c0                	test   %eax,%eax
+  8013fe:	78 3c                	js     80143c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801400:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801403:	83 ec 08             	sub    $0x8,%esp
+  801406:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801409:	50                   	push   %eax
+  80140a:	ff 33                	push   (%ebx)
+  80140c:	e8 bd fd ff ff       	call   8011ce <dev_lookup>
+  801411:	83 c4 10             	add    $0x10,%esp
+  801414:	85 c0                	test   %eax,%eax
+  801416:	78 24                	js     80143c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801418:	8b 43 08             	mov    0x8(%ebx),%eax
+  80141b:	83 e0 03             	and    $0x3,%eax
+  80141e:	83 f8 01             	cmp    $0x1,%eax
+  801421:	74 20                	je     801443 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801423:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801426:	8b 40 08             	mov    0x8(%eax),%eax
+  801429:	85 c0                	test   %eax,%eax
+  80142b:	74 37                	je     801464 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80142d:	83 ec 04             	sub    $0x4,%esp
+  801430:	ff 75 10             	push   0x10(%ebp)
+  801433:	ff 75 0c             	push   0xc(%ebp)
+  801436:	53                   	push   %ebx
+  801437:	ff d0                	call   *%eax
+  801439:	83 c4 10             	add    $0x10,%esp
+}
+  80143c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80143f:	5b                   	pop    %ebx
+  801440:	5e                   	pop    %esi
+  801441:	5d                   	pop    %ebp
+  801442:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801443:	a1 08 40 80 00       	mov    0x804008,%eax
+  801448:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80144b:	83 ec 04             	sub    $0x4,%esp
+  80144e:	56                   	push   %esi
+  80144f:	50                   	push   %eax
+  801450:	68 cd 2b 80 00       	push   $0x802bcd
+  801455:	e8 96 ed ff ff       	call   8001f0 <cprintf>
+		return -E_INVAL;
+  80145a:	83 c4 10             	add    $0x10,%esp
+  80145d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801462:	eb d8                	jmp    80143c <read+0x58>
+		return -E_NOT_SUPP;
+  801464:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801469:	eb d1                	jmp    80143c <read+0x58>
+
+0080146b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	57                   	push   %edi
+  80146f:	56                   	push   %esi
+  801470:	53                   	push   %ebx
+  801471:	83 ec 0c             	sub    $0xc,%esp
+  801474:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801477:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80147a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80147f:	eb 02                	jmp    801483 <readn+0x18>
+  801481:	01 c3                	add    %eax,%ebx
+  801483:	39 f3                	cmp    %esi,%ebx
+  801485:	73 21                	jae    8014a8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801487:	83 ec 04             	sub    $0x4,%esp
+  80148a:	89 f0                	mov    %esi,%eax
+  80148c:	29 d8                	sub    %ebx,%eax
+  80148e:	50                   	push   %eax
+  80148f:	89 d8                	mov    %ebx,%eax
+  801491:	03 45 0c             	add    0xc(%ebp),%eax
+  801494:	50                   	push   %eax
+  801495:	57                   	push   %edi
+  801496:	e8 49 ff ff ff       	call   8013e4 <read>
+		if (m < 0)
+  80149b:	83 c4 10             	add    $0x10,%esp
+  80149e:	85 c0                	test   %eax,%eax
+  8014a0:	78 04                	js     8014a6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8014a2:	75 dd                	jne    801481 <readn+0x16>
+  8014a4:	eb 02                	jmp    8014a8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014a6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8014a8:	89 d8                	mov    %ebx,%eax
+  8014aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ad:	5b                   	pop    %ebx
+  8014ae:	5e                   	pop    %esi
+  8014af:	5f                   	pop    %edi
+  8014b0:	5d                   	pop    %ebp
+  8014b1:	c3                   	ret
+
+008014b2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014b2:	55                   	push   %ebp
+  8014b3:	89 e5                	mov    %esp,%ebp
+  8014b5:	56                   	push   %esi
+  8014b6:	53                   	push   %ebx
+  8014b7:	83 ec 18             	sub    $0x18,%esp
+  8014ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014bd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014c0:	50                   	push   %eax
+  8014c1:	53                   	push   %ebx
+  8014c2:	e8 b7 fc ff ff       	call   80117e <fd_lookup>
+  8014c7:	83 c4 10             	add    $0x10,%esp
+  8014ca:	85 c0                	test   %eax,%eax
+  8014cc:	78 37                	js     801505 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014ce:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014d1:	83 ec 08             	sub    $0x8,%esp
+  8014d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d7:	50                   	push   %eax
+  8014d8:	ff 36                	push   (%esi)
+  8014da:	e8 ef fc ff ff       	call   8011ce <dev_lookup>
+  8014df:	83 c4 10             	add    $0x10,%esp
+  8014e2:	85 c0                	test   %eax,%eax
+  8014e4:	78 1f                	js     801505 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014e6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014ea:	74 20                	je     80150c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8014ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014f2:	85 c0                	test   %eax,%eax
+  8014f4:	74 37                	je     80152d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8014f6:	83 ec 04             	sub    $0x4,%esp
+  8014f9:	ff 75 10             	push   0x10(%ebp)
+  8014fc:	ff 75 0c             	push   0xc(%ebp)
+  8014ff:	56                   	push   %esi
+  801500:	ff d0                	call   *%eax
+  801502:	83 c4 10             	add    $0x10,%esp
+}
+  801505:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801508:	5b                   	pop    %ebx
+  801509:	5e                   	pop    %esi
+  80150a:	5d                   	pop    %ebp
+  80150b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80150c:	a1 08 40 80 00       	mov    0x804008,%eax
+  801511:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801514:	83 ec 04             	sub    $0x4,%esp
+  801517:	53                   	push   %ebx
+  801518:	50                   	push   %eax
+  801519:	68 e9 2b 80 00       	push   $0x802be9
+  80151e:	e8 cd ec ff ff       	call   8001f0 <cprintf>
+		return -E_INVAL;
+  801523:	83 c4 10             	add    $0x10,%esp
+  801526:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80152b:	eb d8                	jmp    801505 <write+0x53>
+		return -E_NOT_SUPP;
+  80152d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801532:	eb d1                	jmp    801505 <write+0x53>
+
+00801534 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801534:	55                   	push   %ebp
+  801535:	89 e5                	mov    %esp,%ebp
+  801537:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80153a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80153d:	50                   	push   %eax
+  80153e:	ff 75 08             	push   0x8(%ebp)
+  801541:	e8 38 fc ff ff       	call   80117e <fd_lookup>
+  801546:	83 c4 10             	add    $0x10,%esp
+  801549:	85 c0                	test   %eax,%eax
+  80154b:	78 0e                	js     80155b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80154d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801550:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801553:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801556:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80155b:	c9                   	leave
+  80155c:	c3                   	ret
+
+0080155d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80155d:	55                   	push   %ebp
+  80155e:	89 e5                	mov    %esp,%ebp
+  801560:	56                   	push   %esi
+  801561:	53                   	push   %ebx
+  801562:	83 ec 18             	sub    $0x18,%esp
+  801565:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801568:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80156b:	50                   	push   %eax
+  80156c:	53                   	push   %ebx
+  80156d:	e8 0c fc ff ff       	call   80117e <fd_lookup>
+  801572:	83 c4 10             	add    $0x10,%esp
+  801575:	85 c0                	test   %eax,%eax
+  801577:	78 34                	js     8015ad <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801579:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80157c:	83 ec 08             	sub    $0x8,%esp
+  80157f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801582:	50                   	push   %eax
+  801583:	ff 36                	push   (%esi)
+  801585:	e8 44 fc ff ff       	call   8011ce <dev_lookup>
+  80158a:	83 c4 10             	add    $0x10,%esp
+  80158d:	85 c0                	test   %eax,%eax
+  80158f:	78 1c                	js     8015ad <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801591:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801595:	74 1d                	je     8015b4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801597:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80159a:	8b 40 18             	mov    0x18(%eax),%eax
+  80159d:	85 c0                	test   %eax,%eax
+  80159f:	74 34                	je     8015d5 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8015a1:	83 ec 08             	sub    $0x8,%esp
+  8015a4:	ff 75 0c             	push   0xc(%ebp)
+  8015a7:	56                   	push   %esi
+  8015a8:	ff d0                	call   *%eax
+  8015aa:	83 c4 10             	add    $0x10,%esp
+}
+  8015ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015b0:	5b                   	pop    %ebx
+  8015b1:	5e                   	pop    %esi
+  8015b2:	5d                   	pop    %ebp
+  8015b3:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015b4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8015b9:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015bc:	83 ec 04             	sub    $0x4,%esp
+  8015bf:	53                   	push   %ebx
+  8015c0:	50                   	push   %eax
+  8015c1:	68 ac 2b 80 00       	push   $0x802bac
+  8015c6:	e8 25 ec ff ff       	call   8001f0 <cprintf>
+		return -E_INVAL;
+  8015cb:	83 c4 10             	add    $0x10,%esp
+  8015ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015d3:	eb d8                	jmp    8015ad <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015d5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015da:	eb d1                	jmp    8015ad <ftruncate+0x50>
+
+008015dc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	56                   	push   %esi
+  8015e0:	53                   	push   %ebx
+  8015e1:	83 ec 18             	sub    $0x18,%esp
+  8015e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015e7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015ea:	50                   	push   %eax
+  8015eb:	ff 75 08             	push   0x8(%ebp)
+  8015ee:	e8 8b fb ff ff       	call   80117e <fd_lookup>
+  8015f3:	83 c4 10             	add    $0x10,%esp
+  8015f6:	85 c0                	test   %eax,%eax
+  8015f8:	78 49                	js     801643 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015fa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015fd:	83 ec 08             	sub    $0x8,%esp
+  801600:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801603:	50                   	push   %eax
+  801604:	ff 36                	push   (%esi)
+  801606:	e8 c3 fb ff ff       	call   8011ce <dev_lookup>
+  80160b:	83 c4 10             	add    $0x10,%esp
+  80160e:	85 c0                	test   %eax,%eax
+  801610:	78 31                	js     801643 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801612:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801615:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801619:	74 2f                	je     80164a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80161b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80161e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801625:	00 00 00 
+	stat->st_isdir = 0;
+  801628:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80162f:	00 00 00 
+	stat->st_dev = dev;
+  801632:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801638:	83 ec 08             	sub    $0x8,%esp
+  80163b:	53                   	push   %ebx
+  80163c:	56                   	push   %esi
+  80163d:	ff 50 14             	call   *0x14(%eax)
+  801640:	83 c4 10             	add    $0x10,%esp
+}
+  801643:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801646:	5b                   	pop    %ebx
+  801647:	5e                   	pop    %esi
+  801648:	5d                   	pop    %ebp
+  801649:	c3                   	ret
+		return -E_NOT_SUPP;
+  80164a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80164f:	eb f2                	jmp    801643 <fstat+0x67>
+
+00801651 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801651:	55                   	push   %ebp
+  801652:	89 e5                	mov    %esp,%ebp
+  801654:	56                   	push   %esi
+  801655:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801656:	83 ec 08             	sub    $0x8,%esp
+  801659:	6a 00                	push   $0x0
+  80165b:	ff 75 08             	push   0x8(%ebp)
+  80165e:	e8 e4 01 00 00       	call   801847 <open>
+  801663:	89 c3                	mov    %eax,%ebx
+  801665:	83 c4 10             	add    $0x10,%esp
+  801668:	85 c0                	test   %eax,%eax
+  80166a:	78 1b                	js     801687 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80166c:	83 ec 08             	sub    $0x8,%esp
+  80166f:	ff 75 0c             	push   0xc(%ebp)
+  801672:	50                   	push   %eax
+  801673:	e8 64 ff ff ff       	call   8015dc <fstat>
+  801678:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80167a:	89 1c 24             	mov    %ebx,(%esp)
+  80167d:	e8 26 fc ff ff       	call   8012a8 <close>
+	return r;
+  801682:	83 c4 10             	add    $0x10,%esp
+  801685:	89 f3                	mov    %esi,%ebx
+}
+  801687:	89 d8                	mov    %ebx,%eax
+  801689:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80168c:	5b                   	pop    %ebx
+  80168d:	5e                   	pop    %esi
+  80168e:	5d                   	pop    %ebp
+  80168f:	c3                   	ret
+
+00801690 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801690:	55                   	push   %ebp
+  801691:	89 e5                	mov    %esp,%ebp
+  801693:	56                   	push   %esi
+  801694:	53                   	push   %ebx
+  801695:	89 c6                	mov    %eax,%esi
+  801697:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801699:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8016a0:	74 27                	je     8016c9 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016a2:	6a 07                	push   $0x7
+  8016a4:	68 00 50 80 00       	push   $0x805000
+  8016a9:	56                   	push   %esi
+  8016aa:	ff 35 00 40 80 00    	push   0x804000
+  8016b0:	e8 d5 0b 00 00       	call   80228a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8016b5:	83 c4 0c             	add    $0xc,%esp
+  8016b8:	6a 00                	push   $0x0
+  8016ba:	53                   	push   %ebx
+  8016bb:	6a 00                	push   $0x0
+  8016bd:	e8 50 0b 00 00       	call   802212 <ipc_recv>
+}
+  8016c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c5:	5b                   	pop    %ebx
+  8016c6:	5e                   	pop    %esi
+  8016c7:	5d                   	pop    %ebp
+  8016c8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016c9:	83 ec 0c             	sub    $0xc,%esp
+  8016cc:	6a 01                	push   $0x1
+  8016ce:	e8 0b 0c 00 00       	call   8022de <ipc_find_env>
+  8016d3:	a3 00 40 80 00       	mov    %eax,0x804000
+  8016d8:	83 c4 10             	add    $0x10,%esp
+  8016db:	eb c5                	jmp    8016a2 <fsipc+0x12>
+
+008016dd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8016dd:	55                   	push   %ebp
+  8016de:	89 e5                	mov    %esp,%ebp
+  8016e0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8016e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016e9:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8016ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016f1:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8016f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016fb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801700:	e8 8b ff ff ff       	call   801690 <fsipc>
+}
+  801705:	c9                   	leave
+  801706:	c3                   	ret
+
+00801707 <devfile_flush>:
+{
+  801707:	55                   	push   %ebp
+  801708:	89 e5                	mov    %esp,%ebp
+  80170a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80170d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801710:	8b 40 0c             	mov    0xc(%eax),%eax
+  801713:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801718:	ba 00 00 00 00       	mov    $0x0,%edx
+  80171d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801722:	e8 69 ff ff ff       	call   801690 <fsipc>
+}
+  801727:	c9                   	leave
+  801728:	c3                   	ret
+
+00801729 <devfile_stat>:
+{
+  801729:	55                   	push   %ebp
+  80172a:	89 e5                	mov    %esp,%ebp
+  80172c:	53                   	push   %ebx
+  80172d:	83 ec 04             	sub    $0x4,%esp
+  801730:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801733:	8b 45 08             	mov    0x8(%ebp),%eax
+  801736:	8b 40 0c             	mov    0xc(%eax),%eax
+  801739:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80173e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801743:	b8 05 00 00 00       	mov    $0x5,%eax
+  801748:	e8 43 ff ff ff       	call   801690 <fsipc>
+  80174d:	85 c0                	test   %eax,%eax
+  80174f:	78 2c                	js     80177d <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801751:	83 ec 08             	sub    $0x8,%esp
+  801754:	68 00 50 80 00       	push   $0x805000
+  801759:	53                   	push   %ebx
+  80175a:	e8 7f f0 ff ff       	call   8007de <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80175f:	a1 80 50 80 00       	mov    0x805080,%eax
+  801764:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80176a:	a1 84 50 80 00       	mov    0x805084,%eax
+  80176f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801775:	83 c4 10             	add    $0x10,%esp
+  801778:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80177d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801780:	c9                   	leave
+  801781:	c3                   	ret
+
+00801782 <devfile_write>:
+{
+  801782:	55                   	push   %ebp
+  801783:	89 e5                	mov    %esp,%ebp
+  801785:	83 ec 0c             	sub    $0xc,%esp
+  801788:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80178b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801790:	39 d0                	cmp    %edx,%eax
+  801792:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801795:	8b 55 08             	mov    0x8(%ebp),%edx
+  801798:	8b 52 0c             	mov    0xc(%edx),%edx
+  80179b:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  8017a1:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8017a6:	50                   	push   %eax
+  8017a7:	ff 75 0c             	push   0xc(%ebp)
+  8017aa:	68 08 50 80 00       	push   $0x805008
+  8017af:	e8 b0 f1 ff ff       	call   800964 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8017b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017be:	e8 cd fe ff ff       	call   801690 <fsipc>
+}
+  8017c3:	c9                   	leave
+  8017c4:	c3                   	ret
+
+008017c5 <devfile_read>:
+{
+  8017c5:	55                   	push   %ebp
+  8017c6:	89 e5                	mov    %esp,%ebp
+  8017c8:	56                   	push   %esi
+  8017c9:	53                   	push   %ebx
+  8017ca:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8017cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017d3:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  8017d8:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8017de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8017e8:	e8 a3 fe ff ff       	call   801690 <fsipc>
+  8017ed:	89 c3                	mov    %eax,%ebx
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	78 1f                	js     801812 <devfile_read+0x4d>
+	assert(r <= n);
+  8017f3:	39 c6                	cmp    %eax,%esi
+  8017f5:	72 24                	jb     80181b <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8017f7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8017fc:	7f 33                	jg     801831 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8017fe:	83 ec 04             	sub    $0x4,%esp
+  801801:	50                   	push   %eax
+  801802:	68 00 50 80 00       	push   $0x805000
+  801807:	ff 75 0c             	push   0xc(%ebp)
+  80180a:	e8 55 f1 ff ff       	call   800964 <memmove>
+	return r;
+  80180f:	83 c4 10             	add    $0x10,%esp
+}
+  801812:	89 d8                	mov    %ebx,%eax
+  801814:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801817:	5b                   	pop    %ebx
+  801818:	5e                   	pop    %esi
+  801819:	5d                   	pop    %ebp
+  80181a:	c3                   	ret
+	assert(r <= n);
+  80181b:	68 1c 2c 80 00       	push   $0x802c1c
+  801820:	68 23 2c 80 00       	push   $0x802c23
+  801825:	6a 7c                	push   $0x7c
+  801827:	68 38 2c 80 00       	push   $0x802c38
+  80182c:	e8 e4 e8 ff ff       	call   800115 <_panic>
+	assert(r <= PGSIZE);
+  801831:	68 43 2c 80 00       	push   $0x802c43
+  801836:	68 23 2c 80 00       	push   $0x802c23
+  80183b:	6a 7d                	push   $0x7d
+  80183d:	68 38 2c 80 00       	push   $0x802c38
+  801842:	e8 ce e8 ff ff       	call   800115 <_panic>
+
+00801847 <open>:
+{
+  801847:	55                   	push   %ebp
+  801848:	89 e5                	mov    %esp,%ebp
+  80184a:	56                   	push   %esi
+  80184b:	53                   	push   %ebx
+  80184c:	83 ec 1c             	sub    $0x1c,%esp
+  80184f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801852:	56                   	push   %esi
+  801853:	e8 4b ef ff ff       	call   8007a3 <strlen>
+  801858:	83 c4 10             	add    $0x10,%esp
+  80185b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801860:	7f 6c                	jg     8018ce <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801862:	83 ec 0c             	sub    $0xc,%esp
+  801865:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801868:	50                   	push   %eax
+  801869:	e8 ba f8 ff ff       	call   801128 <fd_alloc>
+  80186e:	89 c3                	mov    %eax,%ebx
+  801870:	83 c4 10             	add    $0x10,%esp
+  801873:	85 c0                	test   %eax,%eax
+  801875:	78 3c                	js     8018b3 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801877:	83 ec 08             	sub    $0x8,%esp
+  80187a:	56                   	push   %esi
+  80187b:	68 00 50 80 00       	push   $0x805000
+  801880:	e8 59 ef ff ff       	call   8007de <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801885:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801888:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80188d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801890:	b8 01 00 00 00       	mov    $0x1,%eax
+  801895:	e8 f6 fd ff ff       	call   801690 <fsipc>
+  80189a:	89 c3                	mov    %eax,%ebx
+  80189c:	83 c4 10             	add    $0x10,%esp
+  80189f:	85 c0                	test   %eax,%eax
+  8018a1:	78 19                	js     8018bc <open+0x75>
+	return fd2num(fd);
+  8018a3:	83 ec 0c             	sub    $0xc,%esp
+  8018a6:	ff 75 f4             	push   -0xc(%ebp)
+  8018a9:	e8 53 f8 ff ff       	call   801101 <fd2num>
+  8018ae:	89 c3                	mov    %eax,%ebx
+  8018b0:	83 c4 10             	add    $0x10,%esp
+}
+  8018b3:	89 d8                	mov    %ebx,%eax
+  8018b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b8:	5b                   	pop    %ebx
+  8018b9:	5e                   	pop    %esi
+  8018ba:	5d                   	pop    %ebp
+  8018bb:	c3                   	ret
+		fd_close(fd, 0);
+  8018bc:	83 ec 08             	sub    $0x8,%esp
+  8018bf:	6a 00                	push   $0x0
+  8018c1:	ff 75 f4             	push   -0xc(%ebp)
+  8018c4:	e8 58 f9 ff ff       	call   801221 <fd_close>
+		return r;
+  8018c9:	83 c4 10             	add    $0x10,%esp
+  8018cc:	eb e5                	jmp    8018b3 <open+0x6c>
+		return -E_BAD_PATH;
+  8018ce:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8018d3:	eb de                	jmp    8018b3 <open+0x6c>
+
+008018d5 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8018d5:	55                   	push   %ebp
+  8018d6:	89 e5                	mov    %esp,%ebp
+  8018d8:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8018db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018e5:	e8 a6 fd ff ff       	call   801690 <fsipc>
+}
+  8018ea:	c9                   	leave
+  8018eb:	c3                   	ret
+
+008018ec <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8018ec:	55                   	push   %ebp
+  8018ed:	89 e5                	mov    %esp,%ebp
+  8018ef:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8018f2:	68 4f 2c 80 00       	push   $0x802c4f
+  8018f7:	ff 75 0c             	push   0xc(%ebp)
+  8018fa:	e8 df ee ff ff       	call   8007de <strcpy>
+	return 0;
+}
+  8018ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801904:	c9                   	leave
+  801905:	c3                   	ret
+
+00801906 <devsock_close>:
+{
+  801906:	55                   	push   %ebp
+  801907:	89 e5                	mov    %esp,%ebp
+  801909:	53                   	push   %ebx
+  80190a:	83 ec 10             	sub    $0x10,%esp
+  80190d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801910:	53                   	push   %ebx
+  801911:	e8 d8 09 00 00       	call   8022ee <pageref>
+  801916:	89 c2                	mov    %eax,%edx
+  801918:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80191b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801920:	83 fa 01             	cmp    $0x1,%edx
+  801923:	74 05                	je     80192a <devsock_close+0x24>
+}
+  801925:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801928:	c9                   	leave
+  801929:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80192a:	83 ec 0c             	sub    $0xc,%esp
+  80192d:	ff 73 0c             	push   0xc(%ebx)
+  801930:	e8 b7 02 00 00       	call   801bec <nsipc_close>
+  801935:	83 c4 10             	add    $0x10,%esp
+  801938:	eb eb                	jmp    801925 <devsock_close+0x1f>
+
+0080193a <devsock_write>:
+{
+  80193a:	55                   	push   %ebp
+  80193b:	89 e5                	mov    %esp,%ebp
+  80193d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801940:	6a 00                	push   $0x0
+  801942:	ff 75 10             	push   0x10(%ebp)
+  801945:	ff 75 0c             	push   0xc(%ebp)
+  801948:	8b 45 08             	mov    0x8(%ebp),%eax
+  80194b:	ff 70 0c             	push   0xc(%eax)
+  80194e:	e8 79 03 00 00       	call   801ccc <nsipc_send>
+}
+  801953:	c9                   	leave
+  801954:	c3                   	ret
+
+00801955 <devsock_read>:
+{
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80195b:	6a 00                	push   $0x0
+  80195d:	ff 75 10             	push   0x10(%ebp)
+  801960:	ff 75 0c             	push   0xc(%ebp)
+  801963:	8b 45 08             	mov    0x8(%ebp),%eax
+  801966:	ff 70 0c             	push   0xc(%eax)
+  801969:	e8 ef 02 00 00       	call   801c5d <nsipc_recv>
+}
+  80196e:	c9                   	leave
+  80196f:	c3                   	ret
+
+00801970 <fd2sockid>:
+{
+  801970:	55                   	push   %ebp
+  801971:	89 e5                	mov    %esp,%ebp
+  801973:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801976:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801979:	52                   	push   %edx
+  80197a:	50                   	push   %eax
+  80197b:	e8 fe f7 ff ff       	call   80117e <fd_lookup>
+  801980:	83 c4 10             	add    $0x10,%esp
+  801983:	85 c0                	test   %eax,%eax
+  801985:	78 10                	js     801997 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801987:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80198a:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801990:	39 08                	cmp    %ecx,(%eax)
+  801992:	75 05                	jne    801999 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801994:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801997:	c9                   	leave
+  801998:	c3                   	ret
+		return -E_NOT_SUPP;
+  801999:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80199e:	eb f7                	jmp    801997 <fd2sockid+0x27>
+
+008019a0 <alloc_sockfd>:
+{
+  8019a0:	55                   	push   %ebp
+  8019a1:	89 e5                	mov    %esp,%ebp
+  8019a3:	56                   	push   %esi
+  8019a4:	53                   	push   %ebx
+  8019a5:	83 ec 1c             	sub    $0x1c,%esp
+  8019a8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8019aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ad:	50                   	push   %eax
+  8019ae:	e8 75 f7 ff ff       	call   801128 <fd_alloc>
+  8019b3:	89 c3                	mov    %eax,%ebx
+  8019b5:	83 c4 10             	add    $0x10,%esp
+  8019b8:	85 c0                	test   %eax,%eax
+  8019ba:	78 43                	js     8019ff <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8019bc:	83 ec 04             	sub    $0x4,%esp
+  8019bf:	68 07 04 00 00       	push   $0x407
+  8019c4:	ff 75 f4             	push   -0xc(%ebp)
+  8019c7:	6a 00                	push   $0x0
+  8019c9:	e8 7d f2 ff ff       	call   800c4b <sys_page_alloc>
+  8019ce:	89 c3                	mov    %eax,%ebx
+  8019d0:	83 c4 10             	add    $0x10,%esp
+  8019d3:	85 c0                	test   %eax,%eax
+  8019d5:	78 28                	js     8019ff <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8019d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019da:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8019e0:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8019e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019e5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8019ec:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8019ef:	83 ec 0c             	sub    $0xc,%esp
+  8019f2:	50                   	push   %eax
+  8019f3:	e8 09 f7 ff ff       	call   801101 <fd2num>
+  8019f8:	89 c3                	mov    %eax,%ebx
+  8019fa:	83 c4 10             	add    $0x10,%esp
+  8019fd:	eb 0c                	jmp    801a0b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8019ff:	83 ec 0c             	sub    $0xc,%esp
+  801a02:	56                   	push   %esi
+  801a03:	e8 e4 01 00 00       	call   801bec <nsipc_close>
+		return r;
+  801a08:	83 c4 10             	add    $0x10,%esp
+}
+  801a0b:	89 d8                	mov    %ebx,%eax
+  801a0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a10:	5b                   	pop    %ebx
+  801a11:	5e                   	pop    %esi
+  801a12:	5d                   	pop    %ebp
+  801a13:	c3                   	ret
+
+00801a14 <accept>:
+{
+  801a14:	55                   	push   %ebp
+  801a15:	89 e5                	mov    %esp,%ebp
+  801a17:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a1d:	e8 4e ff ff ff       	call   801970 <fd2sockid>
+  801a22:	85 c0                	test   %eax,%eax
+  801a24:	78 1b                	js     801a41 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801a26:	83 ec 04             	sub    $0x4,%esp
+  801a29:	ff 75 10             	push   0x10(%ebp)
+  801a2c:	ff 75 0c             	push   0xc(%ebp)
+  801a2f:	50                   	push   %eax
+  801a30:	e8 0e 01 00 00       	call   801b43 <nsipc_accept>
+  801a35:	83 c4 10             	add    $0x10,%esp
+  801a38:	85 c0                	test   %eax,%eax
+  801a3a:	78 05                	js     801a41 <accept+0x2d>
+	return alloc_sockfd(r);
+  801a3c:	e8 5f ff ff ff       	call   8019a0 <alloc_sockfd>
+}
+  801a41:	c9                   	leave
+  801a42:	c3                   	ret
+
+00801a43 <bind>:
+{
+  801a43:	55                   	push   %ebp
+  801a44:	89 e5                	mov    %esp,%ebp
+  801a46:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a49:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a4c:	e8 1f ff ff ff       	call   801970 <fd2sockid>
+  801a51:	85 c0                	test   %eax,%eax
+  801a53:	78 12                	js     801a67 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801a55:	83 ec 04             	sub    $0x4,%esp
+  801a58:	ff 75 10             	push   0x10(%ebp)
+  801a5b:	ff 75 0c             	push   0xc(%ebp)
+  801a5e:	50                   	push   %eax
+  801a5f:	e8 31 01 00 00       	call   801b95 <nsipc_bind>
+  801a64:	83 c4 10             	add    $0x10,%esp
+}
+  801a67:	c9                   	leave
+  801a68:	c3                   	ret
+
+00801a69 <shutdown>:
+{
+  801a69:	55                   	push   %ebp
+  801a6a:	89 e5                	mov    %esp,%ebp
+  801a6c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a72:	e8 f9 fe ff ff       	call   801970 <fd2sockid>
+  801a77:	85 c0                	test   %eax,%eax
+  801a79:	78 0f                	js     801a8a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801a7b:	83 ec 08             	sub    $0x8,%esp
+  801a7e:	ff 75 0c             	push   0xc(%ebp)
+  801a81:	50                   	push   %eax
+  801a82:	e8 43 01 00 00       	call   801bca <nsipc_shutdown>
+  801a87:	83 c4 10             	add    $0x10,%esp
+}
+  801a8a:	c9                   	leave
+  801a8b:	c3                   	ret
+
+00801a8c <connect>:
+{
+  801a8c:	55                   	push   %ebp
+  801a8d:	89 e5                	mov    %esp,%ebp
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a95:	e8 d6 fe ff ff       	call   801970 <fd2sockid>
+  801a9a:	85 c0                	test   %eax,%eax
+  801a9c:	78 12                	js     801ab0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801a9e:	83 ec 04             	sub    $0x4,%esp
+  801aa1:	ff 75 10             	push   0x10(%ebp)
+  801aa4:	ff 75 0c             	push   0xc(%ebp)
+  801aa7:	50                   	push   %eax
+  801aa8:	e8 59 01 00 00       	call   801c06 <nsipc_connect>
+  801aad:	83 c4 10             	add    $0x10,%esp
+}
+  801ab0:	c9                   	leave
+  801ab1:	c3                   	ret
+
+00801ab2 <listen>:
+{
+  801ab2:	55                   	push   %ebp
+  801ab3:	89 e5                	mov    %esp,%ebp
+  801ab5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ab8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abb:	e8 b0 fe ff ff       	call   801970 <fd2sockid>
+  801ac0:	85 c0                	test   %eax,%eax
+  801ac2:	78 0f                	js     801ad3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801ac4:	83 ec 08             	sub    $0x8,%esp
+  801ac7:	ff 75 0c             	push   0xc(%ebp)
+  801aca:	50                   	push   %eax
+  801acb:	e8 6b 01 00 00       	call   801c3b <nsipc_listen>
+  801ad0:	83 c4 10             	add    $0x10,%esp
+}
+  801ad3:	c9                   	leave
+  801ad4:	c3                   	ret
+
+00801ad5 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801ad5:	55                   	push   %ebp
+  801ad6:	89 e5                	mov    %esp,%ebp
+  801ad8:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801adb:	ff 75 10             	push   0x10(%ebp)
+  801ade:	ff 75 0c             	push   0xc(%ebp)
+  801ae1:	ff 75 08             	push   0x8(%ebp)
+  801ae4:	e8 41 02 00 00       	call   801d2a <nsipc_socket>
+  801ae9:	83 c4 10             	add    $0x10,%esp
+  801aec:	85 c0                	test   %eax,%eax
+  801aee:	78 05                	js     801af5 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801af0:	e8 ab fe ff ff       	call   8019a0 <alloc_sockfd>
+}
+  801af5:	c9                   	leave
+  801af6:	c3                   	ret
+
+00801af7 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801af7:	55                   	push   %ebp
+  801af8:	89 e5                	mov    %esp,%ebp
+  801afa:	53                   	push   %ebx
+  801afb:	83 ec 04             	sub    $0x4,%esp
+  801afe:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801b00:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b07:	74 26                	je     801b2f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801b09:	6a 07                	push   $0x7
+  801b0b:	68 00 60 80 00       	push   $0x806000
+  801b10:	53                   	push   %ebx
+  801b11:	ff 35 04 40 80 00    	push   0x804004
+  801b17:	e8 6e 07 00 00       	call   80228a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801b1c:	83 c4 0c             	add    $0xc,%esp
+  801b1f:	6a 00                	push   $0x0
+  801b21:	6a 00                	push   $0x0
+  801b23:	6a 00                	push   $0x0
+  801b25:	e8 e8 06 00 00       	call   802212 <ipc_recv>
+}
+  801b2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b2d:	c9                   	leave
+  801b2e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801b2f:	83 ec 0c             	sub    $0xc,%esp
+  801b32:	6a 02                	push   $0x2
+  801b34:	e8 a5 07 00 00       	call   8022de <ipc_find_env>
+  801b39:	a3 04 40 80 00       	mov    %eax,0x804004
+  801b3e:	83 c4 10             	add    $0x10,%esp
+  801b41:	eb c6                	jmp    801b09 <nsipc+0x12>
+
+00801b43 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801b43:	55                   	push   %ebp
+  801b44:	89 e5                	mov    %esp,%ebp
+  801b46:	56                   	push   %esi
+  801b47:	53                   	push   %ebx
+  801b48:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801b4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801b53:	8b 06                	mov    (%esi),%eax
+  801b55:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801b5a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b5f:	e8 93 ff ff ff       	call   801af7 <nsipc>
+  801b64:	89 c3                	mov    %eax,%ebx
+  801b66:	85 c0                	test   %eax,%eax
+  801b68:	79 09                	jns    801b73 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801b6a:	89 d8                	mov    %ebx,%eax
+  801b6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b6f:	5b                   	pop    %ebx
+  801b70:	5e                   	pop    %esi
+  801b71:	5d                   	pop    %ebp
+  801b72:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801b73:	83 ec 04             	sub    $0x4,%esp
+  801b76:	ff 35 10 60 80 00    	push   0x806010
+  801b7c:	68 00 60 80 00       	push   $0x806000
+  801b81:	ff 75 0c             	push   0xc(%ebp)
+  801b84:	e8 db ed ff ff       	call   800964 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801b89:	a1 10 60 80 00       	mov    0x806010,%eax
+  801b8e:	89 06                	mov    %eax,(%esi)
+  801b90:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801b93:	eb d5                	jmp    801b6a <nsipc_accept+0x27>
+
+00801b95 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801b95:	55                   	push   %ebp
+  801b96:	89 e5                	mov    %esp,%ebp
+  801b98:	53                   	push   %ebx
+  801b99:	83 ec 08             	sub    $0x8,%esp
+  801b9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801b9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba2:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ba7:	53                   	push   %ebx
+  801ba8:	ff 75 0c             	push   0xc(%ebp)
+  801bab:	68 04 60 80 00       	push   $0x806004
+  801bb0:	e8 af ed ff ff       	call   800964 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801bb5:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801bbb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bc0:	e8 32 ff ff ff       	call   801af7 <nsipc>
+}
+  801bc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bc8:	c9                   	leave
+  801bc9:	c3                   	ret
+
+00801bca <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801bca:	55                   	push   %ebp
+  801bcb:	89 e5                	mov    %esp,%ebp
+  801bcd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801bd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd3:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801bd8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bdb:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801be0:	b8 03 00 00 00       	mov    $0x3,%eax
+  801be5:	e8 0d ff ff ff       	call   801af7 <nsipc>
+}
+  801bea:	c9                   	leave
+  801beb:	c3                   	ret
+
+00801bec <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801bec:	55                   	push   %ebp
+  801bed:	89 e5                	mov    %esp,%ebp
+  801bef:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801bf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf5:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801bfa:	b8 04 00 00 00       	mov    $0x4,%eax
+  801bff:	e8 f3 fe ff ff       	call   801af7 <nsipc>
+}
+  801c04:	c9                   	leave
+  801c05:	c3                   	ret
+
+00801c06 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801c06:	55                   	push   %ebp
+  801c07:	89 e5                	mov    %esp,%ebp
+  801c09:	53                   	push   %ebx
+  801c0a:	83 ec 08             	sub    $0x8,%esp
+  801c0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801c10:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c13:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801c18:	53                   	push   %ebx
+  801c19:	ff 75 0c             	push   0xc(%ebp)
+  801c1c:	68 04 60 80 00       	push   $0x806004
+  801c21:	e8 3e ed ff ff       	call   800964 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801c26:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801c2c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c31:	e8 c1 fe ff ff       	call   801af7 <nsipc>
+}
+  801c36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c39:	c9                   	leave
+  801c3a:	c3                   	ret
+
+00801c3b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801c3b:	55                   	push   %ebp
+  801c3c:	89 e5                	mov    %esp,%ebp
+  801c3e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801c41:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c44:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801c49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c4c:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801c51:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c56:	e8 9c fe ff ff       	call   801af7 <nsipc>
+}
+  801c5b:	c9                   	leave
+  801c5c:	c3                   	ret
+
+00801c5d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801c5d:	55                   	push   %ebp
+  801c5e:	89 e5                	mov    %esp,%ebp
+  801c60:	56                   	push   %esi
+  801c61:	53                   	push   %ebx
+  801c62:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801c65:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c68:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801c6d:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801c73:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c76:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801c7b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c80:	e8 72 fe ff ff       	call   801af7 <nsipc>
+  801c85:	89 c3                	mov    %eax,%ebx
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	78 22                	js     801cad <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801c8b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801c90:	39 c6                	cmp    %eax,%esi
+  801c92:	0f 4e c6             	cmovle %esi,%eax
+  801c95:	39 c3                	cmp    %eax,%ebx
+  801c97:	7f 1d                	jg     801cb6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801c99:	83 ec 04             	sub    $0x4,%esp
+  801c9c:	53                   	push   %ebx
+  801c9d:	68 00 60 80 00       	push   $0x806000
+  801ca2:	ff 75 0c             	push   0xc(%ebp)
+  801ca5:	e8 ba ec ff ff       	call   800964 <memmove>
+  801caa:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801cad:	89 d8                	mov    %ebx,%eax
+  801caf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb2:	5b                   	pop    %ebx
+  801cb3:	5e                   	pop    %esi
+  801cb4:	5d                   	pop    %ebp
+  801cb5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801cb6:	68 5b 2c 80 00       	push   $0x802c5b
+  801cbb:	68 23 2c 80 00       	push   $0x802c23
+  801cc0:	6a 62                	push   $0x62
+  801cc2:	68 70 2c 80 00       	push   $0x802c70
+  801cc7:	e8 49 e4 ff ff       	call   800115 <_panic>
+
+00801ccc <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801ccc:	55                   	push   %ebp
+  801ccd:	89 e5                	mov    %esp,%ebp
+  801ccf:	53                   	push   %ebx
+  801cd0:	83 ec 04             	sub    $0x4,%esp
+  801cd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd9:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801cde:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801ce4:	7f 2e                	jg     801d14 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801ce6:	83 ec 04             	sub    $0x4,%esp
+  801ce9:	53                   	push   %ebx
+  801cea:	ff 75 0c             	push   0xc(%ebp)
+  801ced:	68 0c 60 80 00       	push   $0x80600c
+  801cf2:	e8 6d ec ff ff       	call   800964 <memmove>
+	nsipcbuf.send.req_size = size;
+  801cf7:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801cfd:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d00:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801d05:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d0a:	e8 e8 fd ff ff       	call   801af7 <nsipc>
+}
+  801d0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d12:	c9                   	leave
+  801d13:	c3                   	ret
+	assert(size < 1600);
+  801d14:	68 7c 2c 80 00       	push   $0x802c7c
+  801d19:	68 23 2c 80 00       	push   $0x802c23
+  801d1e:	6a 6d                	push   $0x6d
+  801d20:	68 70 2c 80 00       	push   $0x802c70
+  801d25:	e8 eb e3 ff ff       	call   800115 <_panic>
+
+00801d2a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801d2a:	55                   	push   %ebp
+  801d2b:	89 e5                	mov    %esp,%ebp
+  801d2d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801d30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d33:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801d38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d3b:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801d40:	8b 45 10             	mov    0x10(%ebp),%eax
+  801d43:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801d48:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d4d:	e8 a5 fd ff ff       	call   801af7 <nsipc>
+}
+  801d52:	c9                   	leave
+  801d53:	c3                   	ret
+
+00801d54 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d54:	55                   	push   %ebp
+  801d55:	89 e5                	mov    %esp,%ebp
+  801d57:	56                   	push   %esi
+  801d58:	53                   	push   %ebx
+  801d59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801d5c:	83 ec 0c             	sub    $0xc,%esp
+  801d5f:	ff 75 08             	push   0x8(%ebp)
+  801d62:	e8 aa f3 ff ff       	call   801111 <fd2data>
+  801d67:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801d69:	83 c4 08             	add    $0x8,%esp
+  801d6c:	68 88 2c 80 00       	push   $0x802c88
+  801d71:	53                   	push   %ebx
+  801d72:	e8 67 ea ff ff       	call   8007de <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801d77:	8b 46 04             	mov    0x4(%esi),%eax
+  801d7a:	2b 06                	sub    (%esi),%eax
+  801d7c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801d82:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d89:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d8c:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801d93:	30 80 00 
+	return 0;
+}
+  801d96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d9e:	5b                   	pop    %ebx
+  801d9f:	5e                   	pop    %esi
+  801da0:	5d                   	pop    %ebp
+  801da1:	c3                   	ret
+
+00801da2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801da2:	55                   	push   %ebp
+  801da3:	89 e5                	mov    %esp,%ebp
+  801da5:	53                   	push   %ebx
+  801da6:	83 ec 0c             	sub    $0xc,%esp
+  801da9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801dac:	53                   	push   %ebx
+  801dad:	6a 00                	push   $0x0
+  801daf:	e8 5f ef ff ff       	call   800d13 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801db4:	89 1c 24             	mov    %ebx,(%esp)
+  801db7:	e8 55 f3 ff ff       	call   801111 <fd2data>
+  801dbc:	83 c4 08             	add    $0x8,%esp
+  801dbf:	50                   	push   %eax
+  801dc0:	6a 00                	push   $0x0
+  801dc2:	e8 4c ef ff ff       	call   800d13 <sys_page_unmap>
+}
+  801dc7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dca:	c9                   	leave
+  801dcb:	c3                   	ret
+
+00801dcc <_pipeisclosed>:
+{
+  801dcc:	55                   	push   %ebp
+  801dcd:	89 e5                	mov    %esp,%ebp
+  801dcf:	57                   	push   %edi
+  801dd0:	56                   	push   %esi
+  801dd1:	53                   	push   %ebx
+  801dd2:	83 ec 1c             	sub    $0x1c,%esp
+  801dd5:	89 c7                	mov    %eax,%edi
+  801dd7:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801dd9:	a1 08 40 80 00       	mov    0x804008,%eax
+  801dde:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801de1:	83 ec 0c             	sub    $0xc,%esp
+  801de4:	57                   	push   %edi
+  801de5:	e8 04 05 00 00       	call   8022ee <pageref>
+  801dea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ded:	89 34 24             	mov    %esi,(%esp)
+  801df0:	e8 f9 04 00 00       	call   8022ee <pageref>
+		nn = thisenv->env_runs;
+  801df5:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801dfb:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801dfe:	83 c4 10             	add    $0x10,%esp
+  801e01:	39 cb                	cmp    %ecx,%ebx
+  801e03:	74 1b                	je     801e20 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801e05:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e08:	75 cf                	jne    801dd9 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801e0a:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801e0d:	6a 01                	push   $0x1
+  801e0f:	50                   	push   %eax
+  801e10:	53                   	push   %ebx
+  801e11:	68 8f 2c 80 00       	push   $0x802c8f
+  801e16:	e8 d5 e3 ff ff       	call   8001f0 <cprintf>
+  801e1b:	83 c4 10             	add    $0x10,%esp
+  801e1e:	eb b9                	jmp    801dd9 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801e20:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e23:	0f 94 c0             	sete   %al
+  801e26:	0f b6 c0             	movzbl %al,%eax
+}
+  801e29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e2c:	5b                   	pop    %ebx
+  801e2d:	5e                   	pop    %esi
+  801e2e:	5f                   	pop    %edi
+  801e2f:	5d                   	pop    %ebp
+  801e30:	c3                   	ret
+
+00801e31 <devpipe_write>:
+{
+  801e31:	55                   	push   %ebp
+  801e32:	89 e5                	mov    %esp,%ebp
+  801e34:	57                   	push   %edi
+  801e35:	56                   	push   %esi
+  801e36:	53                   	push   %ebx
+  801e37:	83 ec 28             	sub    $0x28,%esp
+  801e3a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801e3d:	56                   	push   %esi
+  801e3e:	e8 ce f2 ff ff       	call   801111 <fd2data>
+  801e43:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801e45:	83 c4 10             	add    $0x10,%esp
+  801e48:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e4d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801e50:	75 09                	jne    801e5b <devpipe_write+0x2a>
+	return i;
+  801e52:	89 f8                	mov    %edi,%eax
+  801e54:	eb 23                	jmp    801e79 <devpipe_write+0x48>
+			sys_yield();
+  801e56:	e8 70 ed ff ff       	call   800bcb <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801e5b:	8b 43 04             	mov    0x4(%ebx),%eax
+  801e5e:	8b 0b                	mov    (%ebx),%ecx
+  801e60:	8d 51 20             	lea    0x20(%ecx),%edx
+  801e63:	39 d0                	cmp    %edx,%eax
+  801e65:	72 1a                	jb     801e81 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801e67:	89 da                	mov    %ebx,%edx
+  801e69:	89 f0                	mov    %esi,%eax
+  801e6b:	e8 5c ff ff ff       	call   801dcc <_pipeisclosed>
+  801e70:	85 c0                	test   %eax,%eax
+  801e72:	74 e2                	je     801e56 <devpipe_write+0x25>
+				return 0;
+  801e74:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e7c:	5b                   	pop    %ebx
+  801e7d:	5e                   	pop    %esi
+  801e7e:	5f                   	pop    %edi
+  801e7f:	5d                   	pop    %ebp
+  801e80:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801e81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e84:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801e88:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801e8b:	89 c2                	mov    %eax,%edx
+  801e8d:	c1 fa 1f             	sar    $0x1f,%edx
+  801e90:	89 d1                	mov    %edx,%ecx
+  801e92:	c1 e9 1b             	shr    $0x1b,%ecx
+  801e95:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801e98:	83 e2 1f             	and    $0x1f,%edx
+  801e9b:	29 ca                	sub    %ecx,%edx
+  801e9d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801ea1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801ea5:	83 c0 01             	add    $0x1,%eax
+  801ea8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801eab:	83 c7 01             	add    $0x1,%edi
+  801eae:	eb 9d                	jmp    801e4d <devpipe_write+0x1c>
+
+00801eb0 <devpipe_read>:
+{
+  801eb0:	55                   	push   %ebp
+  801eb1:	89 e5                	mov    %esp,%ebp
+  801eb3:	57                   	push   %edi
+  801eb4:	56                   	push   %esi
+  801eb5:	53                   	push   %ebx
+  801eb6:	83 ec 18             	sub    $0x18,%esp
+  801eb9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801ebc:	57                   	push   %edi
+  801ebd:	e8 4f f2 ff ff       	call   801111 <fd2data>
+  801ec2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801ec4:	83 c4 10             	add    $0x10,%esp
+  801ec7:	be 00 00 00 00       	mov    $0x0,%esi
+  801ecc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801ecf:	75 13                	jne    801ee4 <devpipe_read+0x34>
+	return i;
+  801ed1:	89 f0                	mov    %esi,%eax
+  801ed3:	eb 02                	jmp    801ed7 <devpipe_read+0x27>
+				return i;
+  801ed5:	89 f0                	mov    %esi,%eax
+}
+  801ed7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eda:	5b                   	pop    %ebx
+  801edb:	5e                   	pop    %esi
+  801edc:	5f                   	pop    %edi
+  801edd:	5d                   	pop    %ebp
+  801ede:	c3                   	ret
+			sys_yield();
+  801edf:	e8 e7 ec ff ff       	call   800bcb <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801ee4:	8b 03                	mov    (%ebx),%eax
+  801ee6:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801ee9:	75 18                	jne    801f03 <devpipe_read+0x53>
+			if (i > 0)
+  801eeb:	85 f6                	test   %esi,%esi
+  801eed:	75 e6                	jne    801ed5 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801eef:	89 da                	mov    %ebx,%edx
+  801ef1:	89 f8                	mov    %edi,%eax
+  801ef3:	e8 d4 fe ff ff       	call   801dcc <_pipeisclosed>
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	74 e3                	je     801edf <devpipe_read+0x2f>
+				return 0;
+  801efc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f01:	eb d4                	jmp    801ed7 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801f03:	99                   	cltd
+  801f04:	c1 ea 1b             	shr    $0x1b,%edx
+  801f07:	01 d0                	add    %edx,%eax
+  801f09:	83 e0 1f             	and    $0x1f,%eax
+  801f0c:	29 d0                	sub    %edx,%eax
+  801f0e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801f13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f16:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801f19:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801f1c:	83 c6 01             	add    $0x1,%esi
+  801f1f:	eb ab                	jmp    801ecc <devpipe_read+0x1c>
+
+00801f21 <pipe>:
+{
+  801f21:	55                   	push   %ebp
+  801f22:	89 e5                	mov    %esp,%ebp
+  801f24:	56                   	push   %esi
+  801f25:	53                   	push   %ebx
+  801f26:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801f29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f2c:	50                   	push   %eax
+  801f2d:	e8 f6 f1 ff ff       	call   801128 <fd_alloc>
+  801f32:	89 c3                	mov    %eax,%ebx
+  801f34:	83 c4 10             	add    $0x10,%esp
+  801f37:	85 c0                	test   %eax,%eax
+  801f39:	0f 88 23 01 00 00    	js     802062 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f3f:	83 ec 04             	sub    $0x4,%esp
+  801f42:	68 07 04 00 00       	push   $0x407
+  801f47:	ff 75 f4             	push   -0xc(%ebp)
+  801f4a:	6a 00                	push   $0x0
+  801f4c:	e8 fa ec ff ff       	call   800c4b <sys_page_alloc>
+  801f51:	89 c3                	mov    %eax,%ebx
+  801f53:	83 c4 10             	add    $0x10,%esp
+  801f56:	85 c0                	test   %eax,%eax
+  801f58:	0f 88 04 01 00 00    	js     802062 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801f5e:	83 ec 0c             	sub    $0xc,%esp
+  801f61:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f64:	50                   	push   %eax
+  801f65:	e8 be f1 ff ff       	call   801128 <fd_alloc>
+  801f6a:	89 c3                	mov    %eax,%ebx
+  801f6c:	83 c4 10             	add    $0x10,%esp
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	0f 88 db 00 00 00    	js     802052 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f77:	83 ec 04             	sub    $0x4,%esp
+  801f7a:	68 07 04 00 00       	push   $0x407
+  801f7f:	ff 75 f0             	push   -0x10(%ebp)
+  801f82:	6a 00                	push   $0x0
+  801f84:	e8 c2 ec ff ff       	call   800c4b <sys_page_alloc>
+  801f89:	89 c3                	mov    %eax,%ebx
+  801f8b:	83 c4 10             	add    $0x10,%esp
+  801f8e:	85 c0                	test   %eax,%eax
+  801f90:	0f 88 bc 00 00 00    	js     802052 <pipe+0x131>
+	va = fd2data(fd0);
+  801f96:	83 ec 0c             	sub    $0xc,%esp
+  801f99:	ff 75 f4             	push   -0xc(%ebp)
+  801f9c:	e8 70 f1 ff ff       	call   801111 <fd2data>
+  801fa1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fa3:	83 c4 0c             	add    $0xc,%esp
+  801fa6:	68 07 04 00 00       	push   $0x407
+  801fab:	50                   	push   %eax
+  801fac:	6a 00                	push   $0x0
+  801fae:	e8 98 ec ff ff       	call   800c4b <sys_page_alloc>
+  801fb3:	89 c3                	mov    %eax,%ebx
+  801fb5:	83 c4 10             	add    $0x10,%esp
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	0f 88 82 00 00 00    	js     802042 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fc0:	83 ec 0c             	sub    $0xc,%esp
+  801fc3:	ff 75 f0             	push   -0x10(%ebp)
+  801fc6:	e8 46 f1 ff ff       	call   801111 <fd2data>
+  801fcb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801fd2:	50                   	push   %eax
+  801fd3:	6a 00                	push   $0x0
+  801fd5:	56                   	push   %esi
+  801fd6:	6a 00                	push   $0x0
+  801fd8:	e8 f4 ec ff ff       	call   800cd1 <sys_page_map>
+  801fdd:	89 c3                	mov    %eax,%ebx
+  801fdf:	83 c4 20             	add    $0x20,%esp
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	78 4e                	js     802034 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801fe6:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801feb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fee:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801ff0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ff3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801ffa:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801ffd:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801fff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802002:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802009:	83 ec 0c             	sub    $0xc,%esp
+  80200c:	ff 75 f4             	push   -0xc(%ebp)
+  80200f:	e8 ed f0 ff ff       	call   801101 <fd2num>
+  802014:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802017:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802019:	83 c4 04             	add    $0x4,%esp
+  80201c:	ff 75 f0             	push   -0x10(%ebp)
+  80201f:	e8 dd f0 ff ff       	call   801101 <fd2num>
+  802024:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802027:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80202a:	83 c4 10             	add    $0x10,%esp
+  80202d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802032:	eb 2e                	jmp    802062 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802034:	83 ec 08             	sub    $0x8,%esp
+  802037:	56                   	push   %esi
+  802038:	6a 00                	push   $0x0
+  80203a:	e8 d4 ec ff ff       	call   800d13 <sys_page_unmap>
+  80203f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802042:	83 ec 08             	sub    $0x8,%esp
+  802045:	ff 75 f0             	push   -0x10(%ebp)
+  802048:	6a 00                	push   $0x0
+  80204a:	e8 c4 ec ff ff       	call   800d13 <sys_page_unmap>
+  80204f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802052:	83 ec 08             	sub    $0x8,%esp
+  802055:	ff 75 f4             	push   -0xc(%ebp)
+  802058:	6a 00                	push   $0x0
+  80205a:	e8 b4 ec ff ff       	call   800d13 <sys_page_unmap>
+  80205f:	83 c4 10             	add    $0x10,%esp
+}
+  802062:	89 d8                	mov    %ebx,%eax
+  802064:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802067:	5b                   	pop    %ebx
+  802068:	5e                   	pop    %esi
+  802069:	5d                   	pop    %ebp
+  80206a:	c3                   	ret
+
+0080206b <pipeisclosed>:
+{
+  80206b:	55                   	push   %ebp
+  80206c:	89 e5                	mov    %esp,%ebp
+  80206e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802071:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802074:	50                   	push   %eax
+  802075:	ff 75 08             	push   0x8(%ebp)
+  802078:	e8 01 f1 ff ff       	call   80117e <fd_lookup>
+  80207d:	83 c4 10             	add    $0x10,%esp
+  802080:	85 c0                	test   %eax,%eax
+  802082:	78 18                	js     80209c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802084:	83 ec 0c             	sub    $0xc,%esp
+  802087:	ff 75 f4             	push   -0xc(%ebp)
+  80208a:	e8 82 f0 ff ff       	call   801111 <fd2data>
+  80208f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802091:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802094:	e8 33 fd ff ff       	call   801dcc <_pipeisclosed>
+  802099:	83 c4 10             	add    $0x10,%esp
+}
+  80209c:	c9                   	leave
+  80209d:	c3                   	ret
+
+0080209e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80209e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a3:	c3                   	ret
+
+008020a4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020a4:	55                   	push   %ebp
+  8020a5:	89 e5                	mov    %esp,%ebp
+  8020a7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8020aa:	68 a7 2c 80 00       	push   $0x802ca7
+  8020af:	ff 75 0c             	push   0xc(%ebp)
+  8020b2:	e8 27 e7 ff ff       	call   8007de <strcpy>
+	return 0;
+}
+  8020b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020bc:	c9                   	leave
+  8020bd:	c3                   	ret
+
+008020be <devcons_write>:
+{
+  8020be:	55                   	push   %ebp
+  8020bf:	89 e5                	mov    %esp,%ebp
+  8020c1:	57                   	push   %edi
+  8020c2:	56                   	push   %esi
+  8020c3:	53                   	push   %ebx
+  8020c4:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8020ca:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8020cf:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8020d5:	eb 2e                	jmp    802105 <devcons_write+0x47>
+		m = n - tot;
+  8020d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020da:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8020dc:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8020e1:	39 c3                	cmp    %eax,%ebx
+  8020e3:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8020e6:	83 ec 04             	sub    $0x4,%esp
+  8020e9:	53                   	push   %ebx
+  8020ea:	89 f0                	mov    %esi,%eax
+  8020ec:	03 45 0c             	add    0xc(%ebp),%eax
+  8020ef:	50                   	push   %eax
+  8020f0:	57                   	push   %edi
+  8020f1:	e8 6e e8 ff ff       	call   800964 <memmove>
+		sys_cputs(buf, m);
+  8020f6:	83 c4 08             	add    $0x8,%esp
+  8020f9:	53                   	push   %ebx
+  8020fa:	57                   	push   %edi
+  8020fb:	e8 0e ea ff ff       	call   800b0e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802100:	01 de                	add    %ebx,%esi
+  802102:	83 c4 10             	add    $0x10,%esp
+  802105:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802108:	72 cd                	jb     8020d7 <devcons_write+0x19>
+}
+  80210a:	89 f0                	mov    %esi,%eax
+  80210c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80210f:	5b                   	pop    %ebx
+  802110:	5e                   	pop    %esi
+  802111:	5f                   	pop    %edi
+  802112:	5d                   	pop    %ebp
+  802113:	c3                   	ret
+
+00802114 <devcons_read>:
+{
+  802114:	55                   	push   %ebp
+  802115:	89 e5                	mov    %esp,%ebp
+  802117:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80211a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802123:	75 07                	jne    80212c <devcons_read+0x18>
+  802125:	eb 1f                	jmp    802146 <devcons_read+0x32>
+		sys_yield();
+  802127:	e8 9f ea ff ff       	call   800bcb <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80212c:	e8 fb e9 ff ff       	call   800b2c <sys_cgetc>
+  802131:	85 c0                	test   %eax,%eax
+  802133:	74 f2                	je     802127 <devcons_read+0x13>
+	if (c < 0)
+  802135:	78 0f                	js     802146 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802137:	83 f8 04             	cmp    $0x4,%eax
+  80213a:	74 0c                	je     802148 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80213c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80213f:	88 02                	mov    %al,(%edx)
+	return 1;
+  802141:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802146:	c9                   	leave
+  802147:	c3                   	ret
+		return 0;
+  802148:	b8 00 00 00 00       	mov    $0x0,%eax
+  80214d:	eb f7                	jmp    802146 <devcons_read+0x32>
+
+0080214f <cputchar>:
+{
+  80214f:	55                   	push   %ebp
+  802150:	89 e5                	mov    %esp,%ebp
+  802152:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802155:	8b 45 08             	mov    0x8(%ebp),%eax
+  802158:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80215b:	6a 01                	push   $0x1
+  80215d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802160:	50                   	push   %eax
+  802161:	e8 a8 e9 ff ff       	call   800b0e <sys_cputs>
+}
+  802166:	83 c4 10             	add    $0x10,%esp
+  802169:	c9                   	leave
+  80216a:	c3                   	ret
+
+0080216b <getchar>:
+{
+  80216b:	55                   	push   %ebp
+  80216c:	89 e5                	mov    %esp,%ebp
+  80216e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802171:	6a 01                	push   $0x1
+  802173:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802176:	50                   	push   %eax
+  802177:	6a 00                	push   $0x0
+  802179:	e8 66 f2 ff ff       	call   8013e4 <read>
+	if (r < 0)
+  80217e:	83 c4 10             	add    $0x10,%esp
+  802181:	85 c0                	test   %eax,%eax
+  802183:	78 06                	js     80218b <getchar+0x20>
+	if (r < 1)
+  802185:	74 06                	je     80218d <getchar+0x22>
+	return c;
+  802187:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80218b:	c9                   	leave
+  80218c:	c3                   	ret
+		return -E_EOF;
+  80218d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802192:	eb f7                	jmp    80218b <getchar+0x20>
+
+00802194 <iscons>:
+{
+  802194:	55                   	push   %ebp
+  802195:	89 e5                	mov    %esp,%ebp
+  802197:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80219a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80219d:	50                   	push   %eax
+  80219e:	ff 75 08             	push   0x8(%ebp)
+  8021a1:	e8 d8 ef ff ff       	call   80117e <fd_lookup>
+  8021a6:	83 c4 10             	add    $0x10,%esp
+  8021a9:	85 c0                	test   %eax,%eax
+  8021ab:	78 11                	js     8021be <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8021ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b0:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8021b6:	39 10                	cmp    %edx,(%eax)
+  8021b8:	0f 94 c0             	sete   %al
+  8021bb:	0f b6 c0             	movzbl %al,%eax
+}
+  8021be:	c9                   	leave
+  8021bf:	c3                   	ret
+
+008021c0 <opencons>:
+{
+  8021c0:	55                   	push   %ebp
+  8021c1:	89 e5                	mov    %esp,%ebp
+  8021c3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8021c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c9:	50                   	push   %eax
+  8021ca:	e8 59 ef ff ff       	call   801128 <fd_alloc>
+  8021cf:	83 c4 10             	add    $0x10,%esp
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	78 3a                	js     802210 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8021d6:	83 ec 04             	sub    $0x4,%esp
+  8021d9:	68 07 04 00 00       	push   $0x407
+  8021de:	ff 75 f4             	push   -0xc(%ebp)
+  8021e1:	6a 00                	push   $0x0
+  8021e3:	e8 63 ea ff ff       	call   800c4b <sys_page_alloc>
+  8021e8:	83 c4 10             	add    $0x10,%esp
+  8021eb:	85 c0                	test   %eax,%eax
+  8021ed:	78 21                	js     802210 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8021ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021f2:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8021f8:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8021fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021fd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802204:	83 ec 0c             	sub    $0xc,%esp
+  802207:	50                   	push   %eax
+  802208:	e8 f4 ee ff ff       	call   801101 <fd2num>
+  80220d:	83 c4 10             	add    $0x10,%esp
+}
+  802210:	c9                   	leave
+  802211:	c3                   	ret
+
+00802212 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802212:	55                   	push   %ebp
+  802213:	89 e5                	mov    %esp,%ebp
+  802215:	57                   	push   %edi
+  802216:	56                   	push   %esi
+  802217:	53                   	push   %ebx
+  802218:	83 ec 18             	sub    $0x18,%esp
+  80221b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80221e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802221:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802224:	85 db                	test   %ebx,%ebx
+  802226:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80222b:	0f 45 c3             	cmovne %ebx,%eax
+  80222e:	50                   	push   %eax
+  80222f:	e8 9a ed ff ff       	call   800fce <sys_ipc_recv>
+
+	if (from_env_store)
+  802234:	83 c4 10             	add    $0x10,%esp
+  802237:	85 ff                	test   %edi,%edi
+  802239:	74 17                	je     802252 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80223b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802240:	85 c0                	test   %eax,%eax
+  802242:	75 0c                	jne    802250 <ipc_recv+0x3e>
+  802244:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80224a:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802250:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802252:	85 f6                	test   %esi,%esi
+  802254:	74 2e                	je     802284 <ipc_recv+0x72>
+		if (!r && pg)
+  802256:	85 c0                	test   %eax,%eax
+  802258:	75 24                	jne    80227e <ipc_recv+0x6c>
+  80225a:	85 db                	test   %ebx,%ebx
+  80225c:	74 20                	je     80227e <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  80225e:	a1 08 40 80 00       	mov    0x804008,%eax
+  802263:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802269:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80226b:	a1 08 40 80 00       	mov    0x804008,%eax
+  802270:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802279:	5b                   	pop    %ebx
+  80227a:	5e                   	pop    %esi
+  80227b:	5f                   	pop    %edi
+  80227c:	5d                   	pop    %ebp
+  80227d:	c3                   	ret
+			*perm_store = 0;
+  80227e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802284:	85 c0                	test   %eax,%eax
+  802286:	75 ee                	jne    802276 <ipc_recv+0x64>
+  802288:	eb e1                	jmp    80226b <ipc_recv+0x59>
+
+0080228a <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80228a:	55                   	push   %ebp
+  80228b:	89 e5                	mov    %esp,%ebp
+  80228d:	57                   	push   %edi
+  80228e:	56                   	push   %esi
+  80228f:	53                   	push   %ebx
+  802290:	83 ec 0c             	sub    $0xc,%esp
+  802293:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802296:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802299:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80229c:	85 db                	test   %ebx,%ebx
+  80229e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8022a3:	0f 44 d8             	cmove  %eax,%ebx
+  8022a6:	ff 75 14             	push   0x14(%ebp)
+  8022a9:	53                   	push   %ebx
+  8022aa:	56                   	push   %esi
+  8022ab:	57                   	push   %edi
+  8022ac:	e8 fa ec ff ff       	call   800fab <sys_ipc_try_send_yield>
+  8022b1:	83 c4 10             	add    $0x10,%esp
+  8022b4:	85 c0                	test   %eax,%eax
+  8022b6:	79 1e                	jns    8022d6 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8022b8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8022bb:	75 07                	jne    8022c4 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8022bd:	e8 09 e9 ff ff       	call   800bcb <sys_yield>
+  8022c2:	eb e2                	jmp    8022a6 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8022c4:	50                   	push   %eax
+  8022c5:	68 b3 2c 80 00       	push   $0x802cb3
+  8022ca:	6a 3d                	push   $0x3d
+  8022cc:	68 c8 2c 80 00       	push   $0x802cc8
+  8022d1:	e8 3f de ff ff       	call   800115 <_panic>
+	}
+}
+  8022d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d9:	5b                   	pop    %ebx
+  8022da:	5e                   	pop    %esi
+  8022db:	5f                   	pop    %edi
+  8022dc:	5d                   	pop    %ebp
+  8022dd:	c3                   	ret
+
+008022de <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8022de:	55                   	push   %ebp
+  8022df:	89 e5                	mov    %esp,%ebp
+  8022e1:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8022e4:	ff 75 08             	push   0x8(%ebp)
+  8022e7:	e8 5f e8 ff ff       	call   800b4b <sys_env_find>
+}
+  8022ec:	c9                   	leave
+  8022ed:	c3                   	ret
+
+008022ee <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8022ee:	55                   	push   %ebp
+  8022ef:	89 e5                	mov    %esp,%ebp
+  8022f1:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8022f4:	89 c2                	mov    %eax,%edx
+  8022f6:	c1 ea 16             	shr    $0x16,%edx
+  8022f9:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802300:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802305:	f6 c1 01             	test   $0x1,%cl
+  802308:	74 22                	je     80232c <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80230a:	c1 e8 0c             	shr    $0xc,%eax
+  80230d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802314:	a8 01                	test   $0x1,%al
+  802316:	74 14                	je     80232c <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802318:	c1 e8 0c             	shr    $0xc,%eax
+  80231b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80231e:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802325:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802329:	0f b7 d2             	movzwl %dx,%edx
+}
+  80232c:	89 d0                	mov    %edx,%eax
+  80232e:	5d                   	pop    %ebp
+  80232f:	c3                   	ret
+
+00802330 <__udivmoddi4>:
+  802330:	55                   	push   %ebp
+  802331:	57                   	push   %edi
+  802332:	56                   	push   %esi
+  802333:	53                   	push   %ebx
+  802334:	83 ec 14             	sub    $0x14,%esp
+  802337:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80233b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80233f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802343:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802347:	89 f1                	mov    %esi,%ecx
+  802349:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80234d:	09 d9                	or     %ebx,%ecx
+  80234f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802353:	0f 84 92 00 00 00    	je     8023eb <__udivmoddi4+0xbb>
+  802359:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802360:	00 
+  802361:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802366:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80236d:	00 
+  80236e:	89 1c 24             	mov    %ebx,(%esp)
+  802371:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802375:	8d 76 00             	lea    0x0(%esi),%esi
+  802378:	89 e9                	mov    %ebp,%ecx
+  80237a:	89 c3                	mov    %eax,%ebx
+  80237c:	89 d6                	mov    %edx,%esi
+  80237e:	31 ff                	xor    %edi,%edi
+  802380:	d3 ee                	shr    %cl,%esi
+  802382:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802385:	f6 c1 20             	test   $0x20,%cl
+  802388:	0f 45 de             	cmovne %esi,%ebx
+  80238b:	0f 45 f7             	cmovne %edi,%esi
+  80238e:	8b 3c 24             	mov    (%esp),%edi
+  802391:	39 fb                	cmp    %edi,%ebx
+  802393:	89 f7                	mov    %esi,%edi
+  802395:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802399:	8b 1c 24             	mov    (%esp),%ebx
+  80239c:	19 f7                	sbb    %esi,%edi
+  80239e:	72 39                	jb     8023d9 <__udivmoddi4+0xa9>
+  8023a0:	89 e9                	mov    %ebp,%ecx
+  8023a2:	89 f7                	mov    %esi,%edi
+  8023a4:	89 de                	mov    %ebx,%esi
+  8023a6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8023a9:	d3 e6                	shl    %cl,%esi
+  8023ab:	31 db                	xor    %ebx,%ebx
+  8023ad:	f6 c1 20             	test   $0x20,%cl
+  8023b0:	0f 45 fe             	cmovne %esi,%edi
+  8023b3:	0f 45 f3             	cmovne %ebx,%esi
+  8023b6:	29 f0                	sub    %esi,%eax
+  8023b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8023bd:	19 fa                	sbb    %edi,%edx
+  8023bf:	31 ff                	xor    %edi,%edi
+  8023c1:	31 db                	xor    %ebx,%ebx
+  8023c3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023c6:	d3 e6                	shl    %cl,%esi
+  8023c8:	f6 c1 20             	test   $0x20,%cl
+  8023cb:	0f 45 fe             	cmovne %esi,%edi
+  8023ce:	0f 45 f3             	cmovne %ebx,%esi
+  8023d1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023d5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023d9:	83 ed 01             	sub    $0x1,%ebp
+  8023dc:	73 9a                	jae    802378 <__udivmoddi4+0x48>
+  8023de:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8023e2:	85 ff                	test   %edi,%edi
+  8023e4:	74 05                	je     8023eb <__udivmoddi4+0xbb>
+  8023e6:	89 07                	mov    %eax,(%edi)
+  8023e8:	89 57 04             	mov    %edx,0x4(%edi)
+  8023eb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023ef:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023f3:	83 c4 14             	add    $0x14,%esp
+  8023f6:	5b                   	pop    %ebx
+  8023f7:	5e                   	pop    %esi
+  8023f8:	5f                   	pop    %edi
+  8023f9:	5d                   	pop    %ebp
+  8023fa:	c3                   	ret
+  8023fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8023ff:	90                   	nop
+
+00802400 <__udivdi3>:
+  802400:	55                   	push   %ebp
+  802401:	57                   	push   %edi
+  802402:	56                   	push   %esi
+  802403:	53                   	push   %ebx
+  802404:	83 ec 14             	sub    $0x14,%esp
+  802407:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80240b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80240f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802413:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802417:	89 fb                	mov    %edi,%ebx
+  802419:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80241d:	09 f3                	or     %esi,%ebx
+  80241f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802423:	0f 84 85 00 00 00    	je     8024ae <__udivdi3+0xae>
+  802429:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802430:	00 
+  802431:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802436:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80243d:	00 
+  80243e:	89 34 24             	mov    %esi,(%esp)
+  802441:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802445:	8d 76 00             	lea    0x0(%esi),%esi
+  802448:	89 e9                	mov    %ebp,%ecx
+  80244a:	89 c3                	mov    %eax,%ebx
+  80244c:	89 d6                	mov    %edx,%esi
+  80244e:	31 ff                	xor    %edi,%edi
+  802450:	d3 ee                	shr    %cl,%esi
+  802452:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802455:	f6 c1 20             	test   $0x20,%cl
+  802458:	0f 45 de             	cmovne %esi,%ebx
+  80245b:	0f 45 f7             	cmovne %edi,%esi
+  80245e:	8b 3c 24             	mov    (%esp),%edi
+  802461:	39 fb                	cmp    %edi,%ebx
+  802463:	89 f7                	mov    %esi,%edi
+  802465:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802469:	8b 1c 24             	mov    (%esp),%ebx
+  80246c:	19 f7                	sbb    %esi,%edi
+  80246e:	72 39                	jb     8024a9 <__udivdi3+0xa9>
+  802470:	89 e9                	mov    %ebp,%ecx
+  802472:	89 f7                	mov    %esi,%edi
+  802474:	89 de                	mov    %ebx,%esi
+  802476:	0f a5 df             	shld   %cl,%ebx,%edi
+  802479:	d3 e6                	shl    %cl,%esi
+  80247b:	31 db                	xor    %ebx,%ebx
+  80247d:	f6 c1 20             	test   $0x20,%cl
+  802480:	0f 45 fe             	cmovne %esi,%edi
+  802483:	0f 45 f3             	cmovne %ebx,%esi
+  802486:	29 f0                	sub    %esi,%eax
+  802488:	be 01 00 00 00       	mov    $0x1,%esi
+  80248d:	19 fa                	sbb    %edi,%edx
+  80248f:	31 ff                	xor    %edi,%edi
+  802491:	31 db                	xor    %ebx,%ebx
+  802493:	0f a5 f7             	shld   %cl,%esi,%edi
+  802496:	d3 e6                	shl    %cl,%esi
+  802498:	f6 c1 20             	test   $0x20,%cl
+  80249b:	0f 45 fe             	cmovne %esi,%edi
+  80249e:	0f 45 f3             	cmovne %ebx,%esi
+  8024a1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8024a5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8024a9:	83 ed 01             	sub    $0x1,%ebp
+  8024ac:	73 9a                	jae    802448 <__udivdi3+0x48>
+  8024ae:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024b2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8024b6:	83 c4 14             	add    $0x14,%esp
+  8024b9:	5b                   	pop    %ebx
+  8024ba:	5e                   	pop    %esi
+  8024bb:	5f                   	pop    %edi
+  8024bc:	5d                   	pop    %ebp
+  8024bd:	c3                   	ret
+  8024be:	66 90                	xchg   %ax,%ax
+
+008024c0 <__umoddi3>:
+  8024c0:	57                   	push   %edi
+  8024c1:	56                   	push   %esi
+  8024c2:	53                   	push   %ebx
+  8024c3:	83 ec 08             	sub    $0x8,%esp
+  8024c6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8024ca:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8024ce:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8024d2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8024d6:	89 f9                	mov    %edi,%ecx
+  8024d8:	89 34 24             	mov    %esi,(%esp)
+  8024db:	09 f1                	or     %esi,%ecx
+  8024dd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8024e1:	74 53                	je     802536 <__umoddi3+0x76>
+  8024e3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024ef:	90                   	nop
+  8024f0:	89 c6                	mov    %eax,%esi
+  8024f2:	89 d7                	mov    %edx,%edi
+  8024f4:	31 db                	xor    %ebx,%ebx
+  8024f6:	d3 ef                	shr    %cl,%edi
+  8024f8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8024fb:	f6 c1 20             	test   $0x20,%cl
+  8024fe:	0f 45 f7             	cmovne %edi,%esi
+  802501:	0f 45 fb             	cmovne %ebx,%edi
+  802504:	8b 1c 24             	mov    (%esp),%ebx
+  802507:	39 de                	cmp    %ebx,%esi
+  802509:	89 fb                	mov    %edi,%ebx
+  80250b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80250f:	8b 34 24             	mov    (%esp),%esi
+  802512:	19 fb                	sbb    %edi,%ebx
+  802514:	72 14                	jb     80252a <__umoddi3+0x6a>
+  802516:	0f a5 f7             	shld   %cl,%esi,%edi
+  802519:	31 db                	xor    %ebx,%ebx
+  80251b:	d3 e6                	shl    %cl,%esi
+  80251d:	f6 c1 20             	test   $0x20,%cl
+  802520:	0f 45 fe             	cmovne %esi,%edi
+  802523:	0f 45 f3             	cmovne %ebx,%esi
+  802526:	29 f0                	sub    %esi,%eax
+  802528:	19 fa                	sbb    %edi,%edx
+  80252a:	83 e9 01             	sub    $0x1,%ecx
+  80252d:	73 c1                	jae    8024f0 <__umoddi3+0x30>
+  80252f:	83 c4 08             	add    $0x8,%esp
+  802532:	5b                   	pop    %ebx
+  802533:	5e                   	pop    %esi
+  802534:	5f                   	pop    %edi
+  802535:	c3                   	ret
+  802536:	83 c4 08             	add    $0x8,%esp
+  802539:	31 c0                	xor    %eax,%eax
+  80253b:	31 d2                	xor    %edx,%edx
+  80253d:	5b                   	pop    %ebx
+  80253e:	5e                   	pop    %esi
+  80253f:	5f                   	pop    %edi
+  802540:	c3                   	ret
+  802541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802548:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80254f:	90                   	nop
+
+00802550 <__divdi3>:
+  802550:	55                   	push   %ebp
+  802551:	57                   	push   %edi
+  802552:	56                   	push   %esi
+  802553:	53                   	push   %ebx
+  802554:	83 ec 1c             	sub    $0x1c,%esp
+  802557:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80255b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80255f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802563:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802567:	85 ff                	test   %edi,%edi
+  802569:	0f 88 da 00 00 00    	js     802649 <__divdi3+0xf9>
+  80256f:	85 db                	test   %ebx,%ebx
+  802571:	78 16                	js     802589 <__divdi3+0x39>
+  802573:	89 dd                	mov    %ebx,%ebp
+  802575:	89 c8                	mov    %ecx,%eax
+  802577:	89 da                	mov    %ebx,%edx
+  802579:	09 cd                	or     %ecx,%ebp
+  80257b:	0f 85 fd 00 00 00    	jne    80267e <__divdi3+0x12e>
+  802581:	83 c4 1c             	add    $0x1c,%esp
+  802584:	5b                   	pop    %ebx
+  802585:	5e                   	pop    %esi
+  802586:	5f                   	pop    %edi
+  802587:	5d                   	pop    %ebp
+  802588:	c3                   	ret
+  802589:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80258e:	f7 d9                	neg    %ecx
+  802590:	89 f0                	mov    %esi,%eax
+  802592:	89 fa                	mov    %edi,%edx
+  802594:	83 d3 00             	adc    $0x0,%ebx
+  802597:	89 0c 24             	mov    %ecx,(%esp)
+  80259a:	f7 db                	neg    %ebx
+  80259c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8025a0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8025a7:	00 
+  8025a8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025ad:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8025b4:	00 
+  8025b5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8025b9:	89 cd                	mov    %ecx,%ebp
+  8025bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8025bf:	90                   	nop
+  8025c0:	89 e9                	mov    %ebp,%ecx
+  8025c2:	89 c3                	mov    %eax,%ebx
+  8025c4:	89 d6                	mov    %edx,%esi
+  8025c6:	31 ff                	xor    %edi,%edi
+  8025c8:	d3 ee                	shr    %cl,%esi
+  8025ca:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025cd:	f6 c1 20             	test   $0x20,%cl
+  8025d0:	0f 45 de             	cmovne %esi,%ebx
+  8025d3:	0f 45 f7             	cmovne %edi,%esi
+  8025d6:	8b 3c 24             	mov    (%esp),%edi
+  8025d9:	39 fb                	cmp    %edi,%ebx
+  8025db:	89 f7                	mov    %esi,%edi
+  8025dd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8025e1:	8b 1c 24             	mov    (%esp),%ebx
+  8025e4:	19 f7                	sbb    %esi,%edi
+  8025e6:	72 39                	jb     802621 <__divdi3+0xd1>
+  8025e8:	89 e9                	mov    %ebp,%ecx
+  8025ea:	89 f7                	mov    %esi,%edi
+  8025ec:	89 de                	mov    %ebx,%esi
+  8025ee:	0f a5 df             	shld   %cl,%ebx,%edi
+  8025f1:	d3 e6                	shl    %cl,%esi
+  8025f3:	31 db                	xor    %ebx,%ebx
+  8025f5:	f6 c1 20             	test   $0x20,%cl
+  8025f8:	0f 45 fe             	cmovne %esi,%edi
+  8025fb:	0f 45 f3             	cmovne %ebx,%esi
+  8025fe:	29 f0                	sub    %esi,%eax
+  802600:	be 01 00 00 00       	mov    $0x1,%esi
+  802605:	19 fa                	sbb    %edi,%edx
+  802607:	31 ff                	xor    %edi,%edi
+  802609:	31 db                	xor    %ebx,%ebx
+  80260b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80260e:	d3 e6                	shl    %cl,%esi
+  802610:	f6 c1 20             	test   $0x20,%cl
+  802613:	0f 45 fe             	cmovne %esi,%edi
+  802616:	0f 45 f3             	cmovne %ebx,%esi
+  802619:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80261d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802621:	83 ed 01             	sub    $0x1,%ebp
+  802624:	73 9a                	jae    8025c0 <__divdi3+0x70>
+  802626:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80262a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80262e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802632:	85 ed                	test   %ebp,%ebp
+  802634:	0f 84 47 ff ff ff    	je     802581 <__divdi3+0x31>
+  80263a:	f7 d8                	neg    %eax
+  80263c:	83 d2 00             	adc    $0x0,%edx
+  80263f:	83 c4 1c             	add    $0x1c,%esp
+  802642:	5b                   	pop    %ebx
+  802643:	f7 da                	neg    %edx
+  802645:	5e                   	pop    %esi
+  802646:	5f                   	pop    %edi
+  802647:	5d                   	pop    %ebp
+  802648:	c3                   	ret
+  802649:	f7 de                	neg    %esi
+  80264b:	83 d7 00             	adc    $0x0,%edi
+  80264e:	f7 df                	neg    %edi
+  802650:	85 db                	test   %ebx,%ebx
+  802652:	78 23                	js     802677 <__divdi3+0x127>
+  802654:	89 dd                	mov    %ebx,%ebp
+  802656:	89 c8                	mov    %ecx,%eax
+  802658:	89 da                	mov    %ebx,%edx
+  80265a:	09 cd                	or     %ecx,%ebp
+  80265c:	0f 84 1f ff ff ff    	je     802581 <__divdi3+0x31>
+  802662:	89 0c 24             	mov    %ecx,(%esp)
+  802665:	89 f0                	mov    %esi,%eax
+  802667:	89 fa                	mov    %edi,%edx
+  802669:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80266e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802672:	e9 29 ff ff ff       	jmp    8025a0 <__divdi3+0x50>
+  802677:	31 ed                	xor    %ebp,%ebp
+  802679:	e9 10 ff ff ff       	jmp    80258e <__divdi3+0x3e>
+  80267e:	89 0c 24             	mov    %ecx,(%esp)
+  802681:	89 f0                	mov    %esi,%eax
+  802683:	89 fa                	mov    %edi,%edx
+  802685:	31 ed                	xor    %ebp,%ebp
+  802687:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80268b:	e9 10 ff ff ff       	jmp    8025a0 <__divdi3+0x50>
+
+00802690 <__moddi3>:
+  802690:	55                   	push   %ebp
+  802691:	57                   	push   %edi
+  802692:	56                   	push   %esi
+  802693:	53                   	push   %ebx
+  802694:	83 ec 14             	sub    $0x14,%esp
+  802697:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80269b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80269f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8026a3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8026a7:	85 d2                	test   %edx,%edx
+  8026a9:	0f 88 9b 00 00 00    	js     80274a <__moddi3+0xba>
+  8026af:	89 f7                	mov    %esi,%edi
+  8026b1:	31 ed                	xor    %ebp,%ebp
+  8026b3:	09 cf                	or     %ecx,%edi
+  8026b5:	0f 84 83 00 00 00    	je     80273e <__moddi3+0xae>
+  8026bb:	89 cb                	mov    %ecx,%ebx
+  8026bd:	89 f7                	mov    %esi,%edi
+  8026bf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8026c3:	f7 db                	neg    %ebx
+  8026c5:	83 d7 00             	adc    $0x0,%edi
+  8026c8:	f7 df                	neg    %edi
+  8026ca:	0f 49 f7             	cmovns %edi,%esi
+  8026cd:	0f 49 cb             	cmovns %ebx,%ecx
+  8026d0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8026d4:	89 0c 24             	mov    %ecx,(%esp)
+  8026d7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026dc:	89 cd                	mov    %ecx,%ebp
+  8026de:	66 90                	xchg   %ax,%ax
+  8026e0:	89 e9                	mov    %ebp,%ecx
+  8026e2:	89 c3                	mov    %eax,%ebx
+  8026e4:	89 d6                	mov    %edx,%esi
+  8026e6:	31 ff                	xor    %edi,%edi
+  8026e8:	d3 ee                	shr    %cl,%esi
+  8026ea:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8026ed:	f6 c1 20             	test   $0x20,%cl
+  8026f0:	0f 45 de             	cmovne %esi,%ebx
+  8026f3:	0f 45 f7             	cmovne %edi,%esi
+  8026f6:	8b 3c 24             	mov    (%esp),%edi
+  8026f9:	39 fb                	cmp    %edi,%ebx
+  8026fb:	89 f7                	mov    %esi,%edi
+  8026fd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802701:	8b 1c 24             	mov    (%esp),%ebx
+  802704:	19 f7                	sbb    %esi,%edi
+  802706:	72 1a                	jb     802722 <__moddi3+0x92>
+  802708:	89 e9                	mov    %ebp,%ecx
+  80270a:	89 f7                	mov    %esi,%edi
+  80270c:	89 de                	mov    %ebx,%esi
+  80270e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802711:	d3 e6                	shl    %cl,%esi
+  802713:	31 db                	xor    %ebx,%ebx
+  802715:	f6 c1 20             	test   $0x20,%cl
+  802718:	0f 45 fe             	cmovne %esi,%edi
+  80271b:	0f 45 f3             	cmovne %ebx,%esi
+  80271e:	29 f0                	sub    %esi,%eax
+  802720:	19 fa                	sbb    %edi,%edx
+  802722:	83 ed 01             	sub    $0x1,%ebp
+  802725:	73 b9                	jae    8026e0 <__moddi3+0x50>
+  802727:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80272b:	85 ed                	test   %ebp,%ebp
+  80272d:	74 07                	je     802736 <__moddi3+0xa6>
+  80272f:	f7 d8                	neg    %eax
+  802731:	83 d2 00             	adc    $0x0,%edx
+  802734:	f7 da                	neg    %edx
+  802736:	83 c4 14             	add    $0x14,%esp
+  802739:	5b                   	pop    %ebx
+  80273a:	5e                   	pop    %esi
+  80273b:	5f                   	pop    %edi
+  80273c:	5d                   	pop    %ebp
+  80273d:	c3                   	ret
+  80273e:	83 c4 14             	add    $0x14,%esp
+  802741:	31 c0                	xor    %eax,%eax
+  802743:	31 d2                	xor    %edx,%edx
+  802745:	5b                   	pop    %ebx
+  802746:	5e                   	pop    %esi
+  802747:	5f                   	pop    %edi
+  802748:	5d                   	pop    %ebp
+  802749:	c3                   	ret
+  80274a:	89 f7                	mov    %esi,%edi
+  80274c:	09 cf                	or     %ecx,%edi
+  80274e:	74 11                	je     802761 <__moddi3+0xd1>
+  802750:	f7 d8                	neg    %eax
+  802752:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802757:	83 d2 00             	adc    $0x0,%edx
+  80275a:	f7 da                	neg    %edx
+  80275c:	e9 5a ff ff ff       	jmp    8026bb <__moddi3+0x2b>
+  802761:	31 c0                	xor    %eax,%eax
+  802763:	31 d2                	xor    %edx,%edx
+  802765:	eb c8                	jmp    80272f <__moddi3+0x9f>
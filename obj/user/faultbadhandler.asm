@@ -0,0 +1,5568 @@
+
+obj/user/faultbadhandler.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 34 00 00 00       	call   800065 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+	sys_page_alloc(0, (void*) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W);
+  800039:	6a 07                	push   $0x7
+  80003b:	68 00 f0 bf ee       	push   $0xeebff000
+  800040:	6a 00                	push   $0x0
+  800042:	e8 bb 01 00 00       	call   800202 <sys_page_alloc>
+	sys_env_set_pgfault_upcall(0, (void*) 0xDeadBeef);
+  800047:	83 c4 08             	add    $0x8,%esp
+  80004a:	68 ef be ad de       	push   $0xdeadbeef
+  80004f:	6a 00                	push   $0x0
+  800051:	e8 a7 04 00 00       	call   8004fd <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800056:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80005d:	00 00 00 
+}
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	c9                   	leave
+  800064:	c3                   	ret
+
+00800065 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800065:	55                   	push   %ebp
+  800066:	89 e5                	mov    %esp,%ebp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80006d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800070:	e8 ee 00 00 00       	call   800163 <sys_getenvid>
+  800075:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80007a:	c1 e0 09             	shl    $0x9,%eax
+  80007d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800082:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800087:	85 db                	test   %ebx,%ebx
+  800089:	7e 07                	jle    800092 <libmain+0x2d>
+		binaryname = argv[0];
+  80008b:	8b 06                	mov    (%esi),%eax
+  80008d:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800092:	83 ec 08             	sub    $0x8,%esp
+  800095:	56                   	push   %esi
+  800096:	53                   	push   %ebx
+  800097:	e8 97 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80009c:	e8 0a 00 00 00       	call   8000ab <exit>
+}
+  8000a1:	83 c4 10             	add    $0x10,%esp
+  8000a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000a7:	5b                   	pop    %ebx
+  8000a8:	5e                   	pop    %esi
+  8000a9:	5d                   	pop    %ebp
+  8000aa:	c3                   	ret
+
+008000ab <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ab:	55                   	push   %ebp
+  8000ac:	89 e5                	mov    %esp,%ebp
+  8000ae:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000b1:	e8 45 07 00 00       	call   8007fb <close_all>
+	sys_env_destroy(0);
+  8000b6:	83 ec 0c             	sub    $0xc,%esp
+  8000b9:	6a 00                	push   $0x0
+  8000bb:	e8 62 00 00 00       	call   800122 <sys_env_destroy>
+}
+  8000c0:	83 c4 10             	add    $0x10,%esp
+  8000c3:	c9                   	leave
+  8000c4:	c3                   	ret
+
+008000c5 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000c5:	55                   	push   %ebp
+  8000c6:	89 e5                	mov    %esp,%ebp
+  8000c8:	57                   	push   %edi
+  8000c9:	56                   	push   %esi
+  8000ca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000d6:	89 c3                	mov    %eax,%ebx
+  8000d8:	89 c7                	mov    %eax,%edi
+  8000da:	89 c6                	mov    %eax,%esi
+  8000dc:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000de:	5b                   	pop    %ebx
+  8000df:	5e                   	pop    %esi
+  8000e0:	5f                   	pop    %edi
+  8000e1:	5d                   	pop    %ebp
+  8000e2:	c3                   	ret
+
+008000e3 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	57                   	push   %edi
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000f3:	89 d1                	mov    %edx,%ecx
+  8000f5:	89 d3                	mov    %edx,%ebx
+  8000f7:	89 d7                	mov    %edx,%edi
+  8000f9:	89 d6                	mov    %edx,%esi
+  8000fb:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000fd:	5b                   	pop    %ebx
+  8000fe:	5e                   	pop    %esi
+  8000ff:	5f                   	pop    %edi
+  800100:	5d                   	pop    %ebp
+  800101:	c3                   	ret
+
+00800102 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800102:	55                   	push   %ebp
+  800103:	89 e5                	mov    %esp,%ebp
+  800105:	57                   	push   %edi
+  800106:	56                   	push   %esi
+  800107:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800108:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80010d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800110:	b8 04 00 00 00       	mov    $0x4,%eax
+  800115:	89 cb                	mov    %ecx,%ebx
+  800117:	89 cf                	mov    %ecx,%edi
+  800119:	89 ce                	mov    %ecx,%esi
+  80011b:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  80011d:	5b                   	pop    %ebx
+  80011e:	5e                   	pop    %esi
+  80011f:	5f                   	pop    %edi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+
+00800122 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800122:	55                   	push   %ebp
+  800123:	89 e5                	mov    %esp,%ebp
+  800125:	57                   	push   %edi
+  800126:	56                   	push   %esi
+  800127:	53                   	push   %ebx
+  800128:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80012b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800130:	8b 55 08             	mov    0x8(%ebp),%edx
+  800133:	b8 03 00 00 00       	mov    $0x3,%eax
+  800138:	89 cb                	mov    %ecx,%ebx
+  80013a:	89 cf                	mov    %ecx,%edi
+  80013c:	89 ce                	mov    %ecx,%esi
+  80013e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800140:	85 c0                	test   %eax,%eax
+  800142:	7f 08                	jg     80014c <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800144:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800147:	5b                   	pop    %ebx
+  800148:	5e                   	pop    %esi
+  800149:	5f                   	pop    %edi
+  80014a:	5d                   	pop    %ebp
+  80014b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80014c:	83 ec 0c             	sub    $0xc,%esp
+  80014f:	50                   	push   %eax
+  800150:	6a 03                	push   $0x3
+  800152:	68 aa 26 80 00       	push   $0x8026aa
+  800157:	6a 23                	push   $0x23
+  800159:	68 c7 26 80 00       	push   $0x8026c7
+  80015e:	e8 d5 15 00 00       	call   801738 <_panic>
+
+00800163 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800163:	55                   	push   %ebp
+  800164:	89 e5                	mov    %esp,%ebp
+  800166:	57                   	push   %edi
+  800167:	56                   	push   %esi
+  800168:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800169:	ba 00 00 00 00       	mov    $0x0,%edx
+  80016e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800173:	89 d1                	mov    %edx,%ecx
+  800175:	89 d3                	mov    %edx,%ebx
+  800177:	89 d7                	mov    %edx,%edi
+  800179:	89 d6                	mov    %edx,%esi
+  80017b:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80017d:	5b                   	pop    %ebx
+  80017e:	5e                   	pop    %esi
+  80017f:	5f                   	pop    %edi
+  800180:	5d                   	pop    %ebp
+  800181:	c3                   	ret
+
+00800182 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800182:	55                   	push   %ebp
+  800183:	89 e5                	mov    %esp,%ebp
+  800185:	57                   	push   %edi
+  800186:	56                   	push   %esi
+  800187:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800188:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018d:	b8 16 00 00 00       	mov    $0x16,%eax
+  800192:	89 d1                	mov    %edx,%ecx
+  800194:	89 d3                	mov    %edx,%ebx
+  800196:	89 d7                	mov    %edx,%edi
+  800198:	89 d6                	mov    %edx,%esi
+  80019a:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80019c:	5b                   	pop    %ebx
+  80019d:	5e                   	pop    %esi
+  80019e:	5f                   	pop    %edi
+  80019f:	5d                   	pop    %ebp
+  8001a0:	c3                   	ret
+
+008001a1 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  8001a1:	55                   	push   %ebp
+  8001a2:	89 e5                	mov    %esp,%ebp
+  8001a4:	57                   	push   %edi
+  8001a5:	56                   	push   %esi
+  8001a6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8001a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ac:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8001b1:	89 d1                	mov    %edx,%ecx
+  8001b3:	89 d3                	mov    %edx,%ebx
+  8001b5:	89 d7                	mov    %edx,%edi
+  8001b7:	89 d6                	mov    %edx,%esi
+  8001b9:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  8001bb:	5b                   	pop    %ebx
+  8001bc:	5e                   	pop    %esi
+  8001bd:	5f                   	pop    %edi
+  8001be:	5d                   	pop    %ebp
+  8001bf:	c3                   	ret
+
+008001c0 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  8001c0:	55                   	push   %ebp
+  8001c1:	89 e5                	mov    %esp,%ebp
+  8001c3:	57                   	push   %edi
+  8001c4:	56                   	push   %esi
+  8001c5:	53                   	push   %ebx
+  8001c6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001d4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8001d9:	89 df                	mov    %ebx,%edi
+  8001db:	89 de                	mov    %ebx,%esi
+  8001dd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001df:	85 c0                	test   %eax,%eax
+  8001e1:	7f 08                	jg     8001eb <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  8001e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001e6:	5b                   	pop    %ebx
+  8001e7:	5e                   	pop    %esi
+  8001e8:	5f                   	pop    %edi
+  8001e9:	5d                   	pop    %ebp
+  8001ea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001eb:	83 ec 0c             	sub    $0xc,%esp
+  8001ee:	50                   	push   %eax
+  8001ef:	6a 15                	push   $0x15
+  8001f1:	68 aa 26 80 00       	push   $0x8026aa
+  8001f6:	6a 23                	push   $0x23
+  8001f8:	68 c7 26 80 00       	push   $0x8026c7
+  8001fd:	e8 36 15 00 00       	call   801738 <_panic>
+
+00800202 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800202:	55                   	push   %ebp
+  800203:	89 e5                	mov    %esp,%ebp
+  800205:	57                   	push   %edi
+  800206:	56                   	push   %esi
+  800207:	53                   	push   %ebx
+  800208:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80020b:	be 00 00 00 00       	mov    $0x0,%esi
+  800210:	8b 55 08             	mov    0x8(%ebp),%edx
+  800213:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800216:	b8 05 00 00 00       	mov    $0x5,%eax
+  80021b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80021e:	89 f7                	mov    %esi,%edi
+  800220:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800222:	85 c0                	test   %eax,%eax
+  800224:	7f 08                	jg     80022e <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800226:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800229:	5b                   	pop    %ebx
+  80022a:	5e                   	pop    %esi
+  80022b:	5f                   	pop    %edi
+  80022c:	5d                   	pop    %ebp
+  80022d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80022e:	83 ec 0c             	sub    $0xc,%esp
+  800231:	50                   	push   %eax
+  800232:	6a 05                	push   $0x5
+  800234:	68 aa 26 80 00       	push   $0x8026aa
+  800239:	6a 23                	push   $0x23
+  80023b:	68 c7 26 80 00       	push   $0x8026c7
+  800240:	e8 f3 14 00 00       	call   801738 <_panic>
+
+00800245 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800245:	55                   	push   %ebp
+  800246:	89 e5                	mov    %esp,%ebp
+  800248:	57                   	push   %edi
+  800249:	56                   	push   %esi
+  80024a:	53                   	push   %ebx
+  80024b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80024e:	be 00 00 00 00       	mov    $0x0,%esi
+  800253:	8b 55 08             	mov    0x8(%ebp),%edx
+  800256:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800259:	b8 06 00 00 00       	mov    $0x6,%eax
+  80025e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800261:	89 f7                	mov    %esi,%edi
+  800263:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800265:	85 c0                	test   %eax,%eax
+  800267:	7f 08                	jg     800271 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800269:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026c:	5b                   	pop    %ebx
+  80026d:	5e                   	pop    %esi
+  80026e:	5f                   	pop    %edi
+  80026f:	5d                   	pop    %ebp
+  800270:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800271:	83 ec 0c             	sub    $0xc,%esp
+  800274:	50                   	push   %eax
+  800275:	6a 06                	push   $0x6
+  800277:	68 aa 26 80 00       	push   $0x8026aa
+  80027c:	6a 23                	push   $0x23
+  80027e:	68 c7 26 80 00       	push   $0x8026c7
+  800283:	e8 b0 14 00 00       	call   801738 <_panic>
+
+00800288 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800288:	55                   	push   %ebp
+  800289:	89 e5                	mov    %esp,%ebp
+  80028b:	57                   	push   %edi
+  80028c:	56                   	push   %esi
+  80028d:	53                   	push   %ebx
+  80028e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800291:	8b 55 08             	mov    0x8(%ebp),%edx
+  800294:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800297:	b8 07 00 00 00       	mov    $0x7,%eax
+  80029c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80029f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002a2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8002a5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002a7:	85 c0                	test   %eax,%eax
+  8002a9:	7f 08                	jg     8002b3 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8002ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ae:	5b                   	pop    %ebx
+  8002af:	5e                   	pop    %esi
+  8002b0:	5f                   	pop    %edi
+  8002b1:	5d                   	pop    %ebp
+  8002b2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002b3:	83 ec 0c             	sub    $0xc,%esp
+  8002b6:	50                   	push   %eax
+  8002b7:	6a 07                	push   $0x7
+  8002b9:	68 aa 26 80 00       	push   $0x8026aa
+  8002be:	6a 23                	push   $0x23
+  8002c0:	68 c7 26 80 00       	push   $0x8026c7
+  8002c5:	e8 6e 14 00 00       	call   801738 <_panic>
+
+008002ca <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8002ca:	55                   	push   %ebp
+  8002cb:	89 e5                	mov    %esp,%ebp
+  8002cd:	57                   	push   %edi
+  8002ce:	56                   	push   %esi
+  8002cf:	53                   	push   %ebx
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002de:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002e3:	89 df                	mov    %ebx,%edi
+  8002e5:	89 de                	mov    %ebx,%esi
+  8002e7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002e9:	85 c0                	test   %eax,%eax
+  8002eb:	7f 08                	jg     8002f5 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f0:	5b                   	pop    %ebx
+  8002f1:	5e                   	pop    %esi
+  8002f2:	5f                   	pop    %edi
+  8002f3:	5d                   	pop    %ebp
+  8002f4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002f5:	83 ec 0c             	sub    $0xc,%esp
+  8002f8:	50                   	push   %eax
+  8002f9:	6a 08                	push   $0x8
+  8002fb:	68 aa 26 80 00       	push   $0x8026aa
+  800300:	6a 23                	push   $0x23
+  800302:	68 c7 26 80 00       	push   $0x8026c7
+  800307:	e8 2c 14 00 00       	call   801738 <_panic>
+
+0080030c <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	57                   	push   %edi
+  800310:	56                   	push   %esi
+  800311:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800312:	8b 55 08             	mov    0x8(%ebp),%edx
+  800315:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800318:	b8 09 00 00 00       	mov    $0x9,%eax
+  80031d:	be 00 00 00 00       	mov    $0x0,%esi
+  800322:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800325:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800328:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  80032a:	5b                   	pop    %ebx
+  80032b:	5e                   	pop    %esi
+  80032c:	5f                   	pop    %edi
+  80032d:	5d                   	pop    %ebp
+  80032e:	c3                   	ret
+
+0080032f <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  80032f:	55                   	push   %ebp
+  800330:	89 e5                	mov    %esp,%ebp
+  800332:	57                   	push   %edi
+  800333:	56                   	push   %esi
+  800334:	53                   	push   %ebx
+  800335:	8b 45 18             	mov    0x18(%ebp),%eax
+  800338:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  80033b:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800340:	77 27                	ja     800369 <sys_page_map_range+0x3a>
+  800342:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800348:	77 1f                	ja     800369 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  80034a:	c1 e0 0c             	shl    $0xc,%eax
+  80034d:	89 c6                	mov    %eax,%esi
+  80034f:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800351:	8b 55 08             	mov    0x8(%ebp),%edx
+  800354:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800357:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80035c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80035f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800362:	cd 30                	int    $0x30
+}
+  800364:	5b                   	pop    %ebx
+  800365:	5e                   	pop    %esi
+  800366:	5f                   	pop    %edi
+  800367:	5d                   	pop    %ebp
+  800368:	c3                   	ret
+		return -E_INVAL;
+  800369:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80036e:	eb f4                	jmp    800364 <sys_page_map_range+0x35>
+
+00800370 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800370:	55                   	push   %ebp
+  800371:	89 e5                	mov    %esp,%ebp
+  800373:	57                   	push   %edi
+  800374:	56                   	push   %esi
+  800375:	53                   	push   %ebx
+  800376:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800379:	8b 55 08             	mov    0x8(%ebp),%edx
+  80037c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80037f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800384:	be 00 00 00 00       	mov    $0x0,%esi
+  800389:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80038c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80038f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800391:	85 c0                	test   %eax,%eax
+  800393:	7f 08                	jg     80039d <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800395:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800398:	5b                   	pop    %ebx
+  800399:	5e                   	pop    %esi
+  80039a:	5f                   	pop    %edi
+  80039b:	5d                   	pop    %ebp
+  80039c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80039d:	83 ec 0c             	sub    $0xc,%esp
+  8003a0:	50                   	push   %eax
+  8003a1:	6a 0c                	push   $0xc
+  8003a3:	68 aa 26 80 00       	push   $0x8026aa
+  8003a8:	6a 23                	push   $0x23
+  8003aa:	68 c7 26 80 00       	push   $0x8026c7
+  8003af:	e8 84 13 00 00       	call   801738 <_panic>
+
+008003b4 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8003b4:	55                   	push   %ebp
+  8003b5:	89 e5                	mov    %esp,%ebp
+  8003b7:	57                   	push   %edi
+  8003b8:	56                   	push   %esi
+  8003b9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8003bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8003ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003cd:	89 f7                	mov    %esi,%edi
+  8003cf:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003d1:	5b                   	pop    %ebx
+  8003d2:	5e                   	pop    %esi
+  8003d3:	5f                   	pop    %edi
+  8003d4:	5d                   	pop    %ebp
+  8003d5:	c3                   	ret
+
+008003d6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003d6:	55                   	push   %ebp
+  8003d7:	89 e5                	mov    %esp,%ebp
+  8003d9:	57                   	push   %edi
+  8003da:	56                   	push   %esi
+  8003db:	53                   	push   %ebx
+  8003dc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ea:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003ef:	89 df                	mov    %ebx,%edi
+  8003f1:	89 de                	mov    %ebx,%esi
+  8003f3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003f5:	85 c0                	test   %eax,%eax
+  8003f7:	7f 08                	jg     800401 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003fc:	5b                   	pop    %ebx
+  8003fd:	5e                   	pop    %esi
+  8003fe:	5f                   	pop    %edi
+  8003ff:	5d                   	pop    %ebp
+  800400:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800401:	83 ec 0c             	sub    $0xc,%esp
+  800404:	50                   	push   %eax
+  800405:	6a 0f                	push   $0xf
+  800407:	68 aa 26 80 00       	push   $0x8026aa
+  80040c:	6a 23                	push   $0x23
+  80040e:	68 c7 26 80 00       	push   $0x8026c7
+  800413:	e8 20 13 00 00       	call   801738 <_panic>
+
+00800418 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800418:	55                   	push   %ebp
+  800419:	89 e5                	mov    %esp,%ebp
+  80041b:	57                   	push   %edi
+  80041c:	56                   	push   %esi
+  80041d:	53                   	push   %ebx
+  80041e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800421:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800426:	8b 55 08             	mov    0x8(%ebp),%edx
+  800429:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80042c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800431:	89 df                	mov    %ebx,%edi
+  800433:	89 de                	mov    %ebx,%esi
+  800435:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800437:	85 c0                	test   %eax,%eax
+  800439:	7f 08                	jg     800443 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  80043b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80043e:	5b                   	pop    %ebx
+  80043f:	5e                   	pop    %esi
+  800440:	5f                   	pop    %edi
+  800441:	5d                   	pop    %ebp
+  800442:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800443:	83 ec 0c             	sub    $0xc,%esp
+  800446:	50                   	push   %eax
+  800447:	6a 10                	push   $0x10
+  800449:	68 aa 26 80 00       	push   $0x8026aa
+  80044e:	6a 23                	push   $0x23
+  800450:	68 c7 26 80 00       	push   $0x8026c7
+  800455:	e8 de 12 00 00       	call   801738 <_panic>
+
+0080045a <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80045a:	55                   	push   %ebp
+  80045b:	89 e5                	mov    %esp,%ebp
+  80045d:	57                   	push   %edi
+  80045e:	56                   	push   %esi
+  80045f:	53                   	push   %ebx
+  800460:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800463:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800468:	8b 55 08             	mov    0x8(%ebp),%edx
+  80046b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80046e:	b8 11 00 00 00       	mov    $0x11,%eax
+  800473:	89 df                	mov    %ebx,%edi
+  800475:	89 de                	mov    %ebx,%esi
+  800477:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800479:	85 c0                	test   %eax,%eax
+  80047b:	7f 08                	jg     800485 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  80047d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800480:	5b                   	pop    %ebx
+  800481:	5e                   	pop    %esi
+  800482:	5f                   	pop    %edi
+  800483:	5d                   	pop    %ebp
+  800484:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800485:	83 ec 0c             	sub    $0xc,%esp
+  800488:	50                   	push   %eax
+  800489:	6a 11                	push   $0x11
+  80048b:	68 aa 26 80 00       	push   $0x8026aa
+  800490:	6a 23                	push   $0x23
+  800492:	68 c7 26 80 00       	push   $0x8026c7
+  800497:	e8 9c 12 00 00       	call   801738 <_panic>
+
+0080049c <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  80049c:	55                   	push   %ebp
+  80049d:	89 e5                	mov    %esp,%ebp
+  80049f:	57                   	push   %edi
+  8004a0:	56                   	push   %esi
+  8004a1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004ac:	89 d1                	mov    %edx,%ecx
+  8004ae:	89 d3                	mov    %edx,%ebx
+  8004b0:	89 d7                	mov    %edx,%edi
+  8004b2:	89 d6                	mov    %edx,%esi
+  8004b4:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  8004b6:	5b                   	pop    %ebx
+  8004b7:	5e                   	pop    %esi
+  8004b8:	5f                   	pop    %edi
+  8004b9:	5d                   	pop    %ebp
+  8004ba:	c3                   	ret
+
+008004bb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8004bb:	55                   	push   %ebp
+  8004bc:	89 e5                	mov    %esp,%ebp
+  8004be:	57                   	push   %edi
+  8004bf:	56                   	push   %esi
+  8004c0:	53                   	push   %ebx
+  8004c1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004cf:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004d4:	89 df                	mov    %ebx,%edi
+  8004d6:	89 de                	mov    %ebx,%esi
+  8004d8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004da:	85 c0                	test   %eax,%eax
+  8004dc:	7f 08                	jg     8004e6 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8004de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004e1:	5b                   	pop    %ebx
+  8004e2:	5e                   	pop    %esi
+  8004e3:	5f                   	pop    %edi
+  8004e4:	5d                   	pop    %ebp
+  8004e5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004e6:	83 ec 0c             	sub    $0xc,%esp
+  8004e9:	50                   	push   %eax
+  8004ea:	6a 13                	push   $0x13
+  8004ec:	68 aa 26 80 00       	push   $0x8026aa
+  8004f1:	6a 23                	push   $0x23
+  8004f3:	68 c7 26 80 00       	push   $0x8026c7
+  8004f8:	e8 3b 12 00 00       	call   801738 <_panic>
+
+008004fd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004fd:	55                   	push   %ebp
+  8004fe:	89 e5                	mov    %esp,%ebp
+  800500:	57                   	push   %edi
+  800501:	56                   	push   %esi
+  800502:	53                   	push   %ebx
+  800503:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800506:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80050b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80050e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800511:	b8 14 00 00 00       	mov    $0x14,%eax
+  800516:	89 df                	mov    %ebx,%edi
+  800518:	89 de                	mov    %ebx,%esi
+  80051a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80051c:	85 c0                	test   %eax,%eax
+  80051e:	7f 08                	jg     800528 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800523:	5b                   	pop    %ebx
+  800524:	5e                   	pop    %esi
+  800525:	5f                   	pop    %edi
+  800526:	5d                   	pop    %ebp
+  800527:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800528:	83 ec 0c             	sub    $0xc,%esp
+  80052b:	50                   	push   %eax
+  80052c:	6a 14                	push   $0x14
+  80052e:	68 aa 26 80 00       	push   $0x8026aa
+  800533:	6a 23                	push   $0x23
+  800535:	68 c7 26 80 00       	push   $0x8026c7
+  80053a:	e8 f9 11 00 00       	call   801738 <_panic>
+
+0080053f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80053f:	55                   	push   %ebp
+  800540:	89 e5                	mov    %esp,%ebp
+  800542:	57                   	push   %edi
+  800543:	56                   	push   %esi
+  800544:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800545:	8b 55 08             	mov    0x8(%ebp),%edx
+  800548:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80054b:	b8 17 00 00 00       	mov    $0x17,%eax
+  800550:	be 00 00 00 00       	mov    $0x0,%esi
+  800555:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800558:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80055b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80055d:	5b                   	pop    %ebx
+  80055e:	5e                   	pop    %esi
+  80055f:	5f                   	pop    %edi
+  800560:	5d                   	pop    %ebp
+  800561:	c3                   	ret
+
+00800562 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800562:	55                   	push   %ebp
+  800563:	89 e5                	mov    %esp,%ebp
+  800565:	57                   	push   %edi
+  800566:	56                   	push   %esi
+  800567:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800568:	8b 55 08             	mov    0x8(%ebp),%edx
+  80056b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80056e:	b8 18 00 00 00       	mov    $0x18,%eax
+  800573:	be 00 00 00 00       	mov    $0x0,%esi
+  800578:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80057b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80057e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800580:	5b                   	pop    %ebx
+  800581:	5e                   	pop    %esi
+  800582:	5f                   	pop    %edi
+  800583:	5d                   	pop    %ebp
+  800584:	c3                   	ret
+
+00800585 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800585:	55                   	push   %ebp
+  800586:	89 e5                	mov    %esp,%ebp
+  800588:	57                   	push   %edi
+  800589:	56                   	push   %esi
+  80058a:	53                   	push   %ebx
+  80058b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80058e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800593:	8b 55 08             	mov    0x8(%ebp),%edx
+  800596:	b8 19 00 00 00       	mov    $0x19,%eax
+  80059b:	89 cb                	mov    %ecx,%ebx
+  80059d:	89 cf                	mov    %ecx,%edi
+  80059f:	89 ce                	mov    %ecx,%esi
+  8005a1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005a3:	85 c0                	test   %eax,%eax
+  8005a5:	7f 08                	jg     8005af <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8005a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005aa:	5b                   	pop    %ebx
+  8005ab:	5e                   	pop    %esi
+  8005ac:	5f                   	pop    %edi
+  8005ad:	5d                   	pop    %ebp
+  8005ae:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005af:	83 ec 0c             	sub    $0xc,%esp
+  8005b2:	50                   	push   %eax
+  8005b3:	6a 19                	push   $0x19
+  8005b5:	68 aa 26 80 00       	push   $0x8026aa
+  8005ba:	6a 23                	push   $0x23
+  8005bc:	68 c7 26 80 00       	push   $0x8026c7
+  8005c1:	e8 72 11 00 00       	call   801738 <_panic>
+
+008005c6 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8005c6:	55                   	push   %ebp
+  8005c7:	89 e5                	mov    %esp,%ebp
+  8005c9:	57                   	push   %edi
+  8005ca:	56                   	push   %esi
+  8005cb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005d6:	89 d1                	mov    %edx,%ecx
+  8005d8:	89 d3                	mov    %edx,%ebx
+  8005da:	89 d7                	mov    %edx,%edi
+  8005dc:	89 d6                	mov    %edx,%esi
+  8005de:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8005e0:	5b                   	pop    %ebx
+  8005e1:	5e                   	pop    %esi
+  8005e2:	5f                   	pop    %edi
+  8005e3:	5d                   	pop    %ebp
+  8005e4:	c3                   	ret
+
+008005e5 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8005e5:	55                   	push   %ebp
+  8005e6:	89 e5                	mov    %esp,%ebp
+  8005e8:	57                   	push   %edi
+  8005e9:	56                   	push   %esi
+  8005ea:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005f6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005fb:	89 df                	mov    %ebx,%edi
+  8005fd:	89 de                	mov    %ebx,%esi
+  8005ff:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  800601:	5b                   	pop    %ebx
+  800602:	5e                   	pop    %esi
+  800603:	5f                   	pop    %edi
+  800604:	5d                   	pop    %ebp
+  800605:	c3                   	ret
+
+00800606 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  800606:	55                   	push   %ebp
+  800607:	89 e5                	mov    %esp,%ebp
+  800609:	57                   	push   %edi
+  80060a:	56                   	push   %esi
+  80060b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80060c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800611:	8b 55 08             	mov    0x8(%ebp),%edx
+  800614:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800617:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80061c:	89 df                	mov    %ebx,%edi
+  80061e:	89 de                	mov    %ebx,%esi
+  800620:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  800622:	5b                   	pop    %ebx
+  800623:	5e                   	pop    %esi
+  800624:	5f                   	pop    %edi
+  800625:	5d                   	pop    %ebp
+  800626:	c3                   	ret
+
+00800627 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800627:	55                   	push   %ebp
+  800628:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80062a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80062d:	05 00 00 00 30       	add    $0x30000000,%eax
+  800632:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800635:	5d                   	pop    %ebp
+  800636:	c3                   	ret
+
+00800637 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800637:	55                   	push   %ebp
+  800638:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80063a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80063d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800642:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800647:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80064c:	5d                   	pop    %ebp
+  80064d:	c3                   	ret
+
+0080064e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80064e:	55                   	push   %ebp
+  80064f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800651:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800656:	eb 02                	jmp    80065a <fd_alloc+0xc>
+  800658:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80065a:	89 c2                	mov    %eax,%edx
+  80065c:	c1 ea 16             	shr    $0x16,%edx
+  80065f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800666:	f6 c2 01             	test   $0x1,%dl
+  800669:	74 2b                	je     800696 <fd_alloc+0x48>
+  80066b:	89 c2                	mov    %eax,%edx
+  80066d:	c1 ea 0c             	shr    $0xc,%edx
+  800670:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800677:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80067d:	f6 c1 01             	test   $0x1,%cl
+  800680:	74 14                	je     800696 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800682:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800688:	75 ce                	jne    800658 <fd_alloc+0xa>
+  80068a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80068f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800694:	eb 05                	jmp    80069b <fd_alloc+0x4d>
+			return 0;
+  800696:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80069b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80069e:	89 02                	mov    %eax,(%edx)
+}
+  8006a0:	89 c8                	mov    %ecx,%eax
+  8006a2:	5d                   	pop    %ebp
+  8006a3:	c3                   	ret
+
+008006a4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006a4:	55                   	push   %ebp
+  8006a5:	89 e5                	mov    %esp,%ebp
+  8006a7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8006aa:	83 f8 1f             	cmp    $0x1f,%eax
+  8006ad:	77 30                	ja     8006df <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8006af:	c1 e0 0c             	shl    $0xc,%eax
+  8006b2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8006b7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006bd:	f6 c2 01             	test   $0x1,%dl
+  8006c0:	74 24                	je     8006e6 <fd_lookup+0x42>
+  8006c2:	89 c2                	mov    %eax,%edx
+  8006c4:	c1 ea 0c             	shr    $0xc,%edx
+  8006c7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006ce:	f6 c2 01             	test   $0x1,%dl
+  8006d1:	74 1a                	je     8006ed <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006d6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006dd:	5d                   	pop    %ebp
+  8006de:	c3                   	ret
+		return -E_INVAL;
+  8006df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006e4:	eb f7                	jmp    8006dd <fd_lookup+0x39>
+		return -E_INVAL;
+  8006e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006eb:	eb f0                	jmp    8006dd <fd_lookup+0x39>
+  8006ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006f2:	eb e9                	jmp    8006dd <fd_lookup+0x39>
+
+008006f4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006f4:	55                   	push   %ebp
+  8006f5:	89 e5                	mov    %esp,%ebp
+  8006f7:	53                   	push   %ebx
+  8006f8:	83 ec 04             	sub    $0x4,%esp
+  8006fb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800703:	eb 03                	jmp    800708 <dev_lookup+0x14>
+  800705:	83 c0 01             	add    $0x1,%eax
+  800708:	8b 1c 85 54 27 80 00 	mov    0x802754(,%eax,4),%ebx
+  80070f:	85 db                	test   %ebx,%ebx
+  800711:	74 0b                	je     80071e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800713:	39 13                	cmp    %edx,(%ebx)
+  800715:	75 ee                	jne    800705 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800717:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071c:	eb 1f                	jmp    80073d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80071e:	a1 08 40 80 00       	mov    0x804008,%eax
+  800723:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800726:	83 ec 04             	sub    $0x4,%esp
+  800729:	52                   	push   %edx
+  80072a:	50                   	push   %eax
+  80072b:	68 d8 26 80 00       	push   $0x8026d8
+  800730:	e8 de 10 00 00       	call   801813 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800735:	83 c4 10             	add    $0x10,%esp
+  800738:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80073d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800740:	89 1a                	mov    %ebx,(%edx)
+}
+  800742:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800745:	c9                   	leave
+  800746:	c3                   	ret
+
+00800747 <fd_close>:
+{
+  800747:	55                   	push   %ebp
+  800748:	89 e5                	mov    %esp,%ebp
+  80074a:	57                   	push   %edi
+  80074b:	56                   	push   %esi
+  80074c:	53                   	push   %ebx
+  80074d:	83 ec 24             	sub    $0x24,%esp
+  800750:	8b 75 08             	mov    0x8(%ebp),%esi
+  800753:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800756:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800759:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80075a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800760:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800763:	50                   	push   %eax
+  800764:	e8 3b ff ff ff       	call   8006a4 <fd_lookup>
+  800769:	89 c3                	mov    %eax,%ebx
+  80076b:	83 c4 10             	add    $0x10,%esp
+  80076e:	85 c0                	test   %eax,%eax
+  800770:	78 05                	js     800777 <fd_close+0x30>
+	    || fd != fd2)
+  800772:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800775:	74 16                	je     80078d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800777:	89 f8                	mov    %edi,%eax
+  800779:	84 c0                	test   %al,%al
+  80077b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800780:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800783:	89 d8                	mov    %ebx,%eax
+  800785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800788:	5b                   	pop    %ebx
+  800789:	5e                   	pop    %esi
+  80078a:	5f                   	pop    %edi
+  80078b:	5d                   	pop    %ebp
+  80078c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80078d:	83 ec 08             	sub    $0x8,%esp
+  800790:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800793:	50                   	push   %eax
+  800794:	ff 36                	push   (%esi)
+  800796:	e8 59 ff ff ff       	call   8006f4 <dev_lookup>
+  80079b:	89 c3                	mov    %eax,%ebx
+  80079d:	83 c4 10             	add    $0x10,%esp
+  8007a0:	85 c0                	test   %eax,%eax
+  8007a2:	78 1a                	js     8007be <fd_close+0x77>
+		if (dev->dev_close)
+  8007a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8007aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8007af:	85 c0                	test   %eax,%eax
+  8007b1:	74 0b                	je     8007be <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8007b3:	83 ec 0c             	sub    $0xc,%esp
+  8007b6:	56                   	push   %esi
+  8007b7:	ff d0                	call   *%eax
+  8007b9:	89 c3                	mov    %eax,%ebx
+  8007bb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007be:	83 ec 08             	sub    $0x8,%esp
+  8007c1:	56                   	push   %esi
+  8007c2:	6a 00                	push   $0x0
+  8007c4:	e8 01 fb ff ff       	call   8002ca <sys_page_unmap>
+	return r;
+  8007c9:	83 c4 10             	add    $0x10,%esp
+  8007cc:	eb b5                	jmp    800783 <fd_close+0x3c>
+
+008007ce <close>:
+
+int
+close(int fdnum)
+{
+  8007ce:	55                   	push   %ebp
+  8007cf:	89 e5                	mov    %esp,%ebp
+  8007d1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007d7:	50                   	push   %eax
+  8007d8:	ff 75 08             	push   0x8(%ebp)
+  8007db:	e8 c4 fe ff ff       	call   8006a4 <fd_lookup>
+  8007e0:	83 c4 10             	add    $0x10,%esp
+  8007e3:	85 c0                	test   %eax,%eax
+  8007e5:	79 02                	jns    8007e9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007e7:	c9                   	leave
+  8007e8:	c3                   	ret
+		return fd_close(fd, 1);
+  8007e9:	83 ec 08             	sub    $0x8,%esp
+  8007ec:	6a 01                	push   $0x1
+  8007ee:	ff 75 f4             	push   -0xc(%ebp)
+  8007f1:	e8 51 ff ff ff       	call   800747 <fd_close>
+  8007f6:	83 c4 10             	add    $0x10,%esp
+  8007f9:	eb ec                	jmp    8007e7 <close+0x19>
+
+008007fb <close_all>:
+
+void
+close_all(void)
+{
+  8007fb:	55                   	push   %ebp
+  8007fc:	89 e5                	mov    %esp,%ebp
+  8007fe:	53                   	push   %ebx
+  8007ff:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800802:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800807:	83 ec 0c             	sub    $0xc,%esp
+  80080a:	53                   	push   %ebx
+  80080b:	e8 be ff ff ff       	call   8007ce <close>
+	for (i = 0; i < MAXFD; i++)
+  800810:	83 c3 01             	add    $0x1,%ebx
+  800813:	83 c4 10             	add    $0x10,%esp
+  800816:	83 fb 20             	cmp    $0x20,%ebx
+  800819:	75 ec                	jne    800807 <close_all+0xc>
+}
+  80081b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80081e:	c9                   	leave
+  80081f:	c3                   	ret
+
+00800820 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800820:	55                   	push   %ebp
+  800821:	89 e5                	mov    %esp,%ebp
+  800823:	57                   	push   %edi
+  800824:	56                   	push   %esi
+  800825:	53                   	push   %ebx
+  800826:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800829:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80082c:	50                   	push   %eax
+  80082d:	ff 75 08             	push   0x8(%ebp)
+  800830:	e8 6f fe ff ff       	call   8006a4 <fd_lookup>
+  800835:	89 c3                	mov    %eax,%ebx
+  800837:	83 c4 10             	add    $0x10,%esp
+  80083a:	85 c0                	test   %eax,%eax
+  80083c:	78 7f                	js     8008bd <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80083e:	83 ec 0c             	sub    $0xc,%esp
+  800841:	ff 75 0c             	push   0xc(%ebp)
+  800844:	e8 85 ff ff ff       	call   8007ce <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800849:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80084c:	c1 e6 0c             	shl    $0xc,%esi
+  80084f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800855:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800858:	89 3c 24             	mov    %edi,(%esp)
+  80085b:	e8 d7 fd ff ff       	call   800637 <fd2data>
+  800860:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800862:	89 34 24             	mov    %esi,(%esp)
+  800865:	e8 cd fd ff ff       	call   800637 <fd2data>
+  80086a:	83 c4 10             	add    $0x10,%esp
+  80086d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800870:	89 d8                	mov    %ebx,%eax
+  800872:	c1 e8 16             	shr    $0x16,%eax
+  800875:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80087c:	a8 01                	test   $0x1,%al
+  80087e:	74 11                	je     800891 <dup+0x71>
+  800880:	89 d8                	mov    %ebx,%eax
+  800882:	c1 e8 0c             	shr    $0xc,%eax
+  800885:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80088c:	f6 c2 01             	test   $0x1,%dl
+  80088f:	75 36                	jne    8008c7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800891:	89 f8                	mov    %edi,%eax
+  800893:	c1 e8 0c             	shr    $0xc,%eax
+  800896:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80089d:	83 ec 0c             	sub    $0xc,%esp
+  8008a0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008a5:	50                   	push   %eax
+  8008a6:	56                   	push   %esi
+  8008a7:	6a 00                	push   $0x0
+  8008a9:	57                   	push   %edi
+  8008aa:	6a 00                	push   $0x0
+  8008ac:	e8 d7 f9 ff ff       	call   800288 <sys_page_map>
+  8008b1:	89 c3                	mov    %eax,%ebx
+  8008b3:	83 c4 20             	add    $0x20,%esp
+  8008b6:	85 c0                	test   %eax,%eax
+  8008b8:	78 33                	js     8008ed <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008bd:	89 d8                	mov    %ebx,%eax
+  8008bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008c2:	5b                   	pop    %ebx
+  8008c3:	5e                   	pop    %esi
+  8008c4:	5f                   	pop    %edi
+  8008c5:	5d                   	pop    %ebp
+  8008c6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008ce:	83 ec 0c             	sub    $0xc,%esp
+  8008d1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008d6:	50                   	push   %eax
+  8008d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8008da:	6a 00                	push   $0x0
+  8008dc:	53                   	push   %ebx
+  8008dd:	6a 00                	push   $0x0
+  8008df:	e8 a4 f9 ff ff       	call   800288 <sys_page_map>
+  8008e4:	89 c3                	mov    %eax,%ebx
+  8008e6:	83 c4 20             	add    $0x20,%esp
+  8008e9:	85 c0                	test   %eax,%eax
+  8008eb:	79 a4                	jns    800891 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008ed:	83 ec 08             	sub    $0x8,%esp
+  8008f0:	56                   	push   %esi
+  8008f1:	6a 00                	push   $0x0
+  8008f3:	e8 d2 f9 ff ff       	call   8002ca <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008f8:	83 c4 08             	add    $0x8,%esp
+  8008fb:	ff 75 d4             	push   -0x2c(%ebp)
+  8008fe:	6a 00                	push   $0x0
+  800900:	e8 c5 f9 ff ff       	call   8002ca <sys_page_unmap>
+	return r;
+  800905:	83 c4 10             	add    $0x10,%esp
+  800908:	eb b3                	jmp    8008bd <dup+0x9d>
+
+0080090a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	56                   	push   %esi
+  80090e:	53                   	push   %ebx
+  80090f:	83 ec 18             	sub    $0x18,%esp
+  800912:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800915:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800918:	50                   	push   %eax
+  800919:	56                   	push   %esi
+  80091a:	e8 85 fd ff ff       	call   8006a4 <fd_lookup>
+  80091f:	83 c4 10             	add    $0x10,%esp
+  800922:	85 c0                	test   %eax,%eax
+  800924:	78 3c                	js     800962 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800926:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800929:	83 ec 08             	sub    $0x8,%esp
+  80092c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80092f:	50                   	push   %eax
+  800930:	ff 33                	push   (%ebx)
+  800932:	e8 bd fd ff ff       	call   8006f4 <dev_lookup>
+  800937:	83 c4 10             	add    $0x10,%esp
+  80093a:	85 c0                	test   %eax,%eax
+  80093c:	78 24                	js     800962 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80093e:	8b 43 08             	mov    0x8(%ebx),%eax
+  800941:	83 e0 03             	and    $0x3,%eax
+  800944:	83 f8 01             	cmp    $0x1,%eax
+  800947:	74 20                	je     800969 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800949:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80094c:	8b 40 08             	mov    0x8(%eax),%eax
+  80094f:	85 c0                	test   %eax,%eax
+  800951:	74 37                	je     80098a <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800953:	83 ec 04             	sub    $0x4,%esp
+  800956:	ff 75 10             	push   0x10(%ebp)
+  800959:	ff 75 0c             	push   0xc(%ebp)
+  80095c:	53                   	push   %ebx
+  80095d:	ff d0                	call   *%eax
+  80095f:	83 c4 10             	add    $0x10,%esp
+}
+  800962:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800965:	5b                   	pop    %ebx
+  800966:	5e                   	pop    %esi
+  800967:	5d                   	pop    %ebp
+  800968:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800969:	a1 08 40 80 00       	mov    0x804008,%eax
+  80096e:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800971:	83 ec 04             	sub    $0x4,%esp
+  800974:	56                   	push   %esi
+  800975:	50                   	push   %eax
+  800976:	68 19 27 80 00       	push   $0x802719
+  80097b:	e8 93 0e 00 00       	call   801813 <cprintf>
+		return -E_INVAL;
+  800980:	83 c4 10             	add    $0x10,%esp
+  800983:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800988:	eb d8                	jmp    800962 <read+0x58>
+		return -E_NOT_SUPP;
+  80098a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80098f:	eb d1                	jmp    800962 <read+0x58>
+
+00800991 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800991:	55                   	push   %ebp
+  800992:	89 e5                	mov    %esp,%ebp
+  800994:	57                   	push   %edi
+  800995:	56                   	push   %esi
+  800996:	53                   	push   %ebx
+  800997:	83 ec 0c             	sub    $0xc,%esp
+  80099a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80099d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8009a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009a5:	eb 02                	jmp    8009a9 <readn+0x18>
+  8009a7:	01 c3                	add    %eax,%ebx
+  8009a9:	39 f3                	cmp    %esi,%ebx
+  8009ab:	73 21                	jae    8009ce <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009ad:	83 ec 04             	sub    $0x4,%esp
+  8009b0:	89 f0                	mov    %esi,%eax
+  8009b2:	29 d8                	sub    %ebx,%eax
+  8009b4:	50                   	push   %eax
+  8009b5:	89 d8                	mov    %ebx,%eax
+  8009b7:	03 45 0c             	add    0xc(%ebp),%eax
+  8009ba:	50                   	push   %eax
+  8009bb:	57                   	push   %edi
+  8009bc:	e8 49 ff ff ff       	call   80090a <read>
+		if (m < 0)
+  8009c1:	83 c4 10             	add    $0x10,%esp
+  8009c4:	85 c0                	test   %eax,%eax
+  8009c6:	78 04                	js     8009cc <readn+0x3b>
+			return m;
+		if (m == 0)
+  8009c8:	75 dd                	jne    8009a7 <readn+0x16>
+  8009ca:	eb 02                	jmp    8009ce <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009cc:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8009ce:	89 d8                	mov    %ebx,%eax
+  8009d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009d3:	5b                   	pop    %ebx
+  8009d4:	5e                   	pop    %esi
+  8009d5:	5f                   	pop    %edi
+  8009d6:	5d                   	pop    %ebp
+  8009d7:	c3                   	ret
+
+008009d8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009d8:	55                   	push   %ebp
+  8009d9:	89 e5                	mov    %esp,%ebp
+  8009db:	56                   	push   %esi
+  8009dc:	53                   	push   %ebx
+  8009dd:	83 ec 18             	sub    $0x18,%esp
+  8009e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009e6:	50                   	push   %eax
+  8009e7:	53                   	push   %ebx
+  8009e8:	e8 b7 fc ff ff       	call   8006a4 <fd_lookup>
+  8009ed:	83 c4 10             	add    $0x10,%esp
+  8009f0:	85 c0                	test   %eax,%eax
+  8009f2:	78 37                	js     800a2b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009f4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009f7:	83 ec 08             	sub    $0x8,%esp
+  8009fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009fd:	50                   	push   %eax
+  8009fe:	ff 36                	push   (%esi)
+  800a00:	e8 ef fc ff ff       	call   8006f4 <dev_lookup>
+  800a05:	83 c4 10             	add    $0x10,%esp
+  800a08:	85 c0                	test   %eax,%eax
+  800a0a:	78 1f                	js     800a2b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a0c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a10:	74 20                	je     800a32 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800a12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a15:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a18:	85 c0                	test   %eax,%eax
+  800a1a:	74 37                	je     800a53 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a1c:	83 ec 04             	sub    $0x4,%esp
+  800a1f:	ff 75 10             	push   0x10(%ebp)
+  800a22:	ff 75 0c             	push   0xc(%ebp)
+  800a25:	56                   	push   %esi
+  800a26:	ff d0                	call   *%eax
+  800a28:	83 c4 10             	add    $0x10,%esp
+}
+  800a2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a2e:	5b                   	pop    %ebx
+  800a2f:	5e                   	pop    %esi
+  800a30:	5d                   	pop    %ebp
+  800a31:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a32:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a37:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800a3a:	83 ec 04             	sub    $0x4,%esp
+  800a3d:	53                   	push   %ebx
+  800a3e:	50                   	push   %eax
+  800a3f:	68 35 27 80 00       	push   $0x802735
+  800a44:	e8 ca 0d 00 00       	call   801813 <cprintf>
+		return -E_INVAL;
+  800a49:	83 c4 10             	add    $0x10,%esp
+  800a4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a51:	eb d8                	jmp    800a2b <write+0x53>
+		return -E_NOT_SUPP;
+  800a53:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a58:	eb d1                	jmp    800a2b <write+0x53>
+
+00800a5a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a5a:	55                   	push   %ebp
+  800a5b:	89 e5                	mov    %esp,%ebp
+  800a5d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a63:	50                   	push   %eax
+  800a64:	ff 75 08             	push   0x8(%ebp)
+  800a67:	e8 38 fc ff ff       	call   8006a4 <fd_lookup>
+  800a6c:	83 c4 10             	add    $0x10,%esp
+  800a6f:	85 c0                	test   %eax,%eax
+  800a71:	78 0e                	js     800a81 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800a73:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a79:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a81:	c9                   	leave
+  800a82:	c3                   	ret
+
+00800a83 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a83:	55                   	push   %ebp
+  800a84:	89 e5                	mov    %esp,%ebp
+  800a86:	56                   	push   %esi
+  800a87:	53                   	push   %ebx
+  800a88:	83 ec 18             	sub    $0x18,%esp
+  800a8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a8e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a91:	50                   	push   %eax
+  800a92:	53                   	push   %ebx
+  800a93:	e8 0c fc ff ff       	call   8006a4 <fd_lookup>
+  800a98:	83 c4 10             	add    $0x10,%esp
+  800a9b:	85 c0                	test   %eax,%eax
+  800a9d:	78 34                	js     800ad3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a9f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800aa2:	83 ec 08             	sub    $0x8,%esp
+  800aa5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800aa8:	50                   	push   %eax
+  800aa9:	ff 36                	push   (%esi)
+  800aab:	e8 44 fc ff ff       	call   8006f4 <dev_lookup>
+  800ab0:	83 c4 10             	add    $0x10,%esp
+  800ab3:	85 c0                	test   %eax,%eax
+  800ab5:	78 1c                	js     800ad3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ab7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800abb:	74 1d                	je     800ada <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800abd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ac0:	8b 40 18             	mov    0x18(%eax),%eax
+  800ac3:	85 c0                	test   %eax,%eax
+  800ac5:	74 34                	je     800afb <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800ac7:	83 ec 08             	sub    $0x8,%esp
+  800aca:	ff 75 0c             	push   0xc(%ebp)
+  800acd:	56                   	push   %esi
+  800ace:	ff d0                	call   *%eax
+  800ad0:	83 c4 10             	add    $0x10,%esp
+}
+  800ad3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ad6:	5b                   	pop    %ebx
+  800ad7:	5e                   	pop    %esi
+  800ad8:	5d                   	pop    %ebp
+  800ad9:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800ada:	a1 08 40 80 00       	mov    0x804008,%eax
+  800adf:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ae2:	83 ec 04             	sub    $0x4,%esp
+  800ae5:	53                   	push   %ebx
+  800ae6:	50                   	push   %eax
+  800ae7:	68 f8 26 80 00       	push   $0x8026f8
+  800aec:	e8 22 0d 00 00       	call   801813 <cprintf>
+		return -E_INVAL;
+  800af1:	83 c4 10             	add    $0x10,%esp
+  800af4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af9:	eb d8                	jmp    800ad3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800afb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b00:	eb d1                	jmp    800ad3 <ftruncate+0x50>
+
+00800b02 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b02:	55                   	push   %ebp
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	56                   	push   %esi
+  800b06:	53                   	push   %ebx
+  800b07:	83 ec 18             	sub    $0x18,%esp
+  800b0a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b0d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b10:	50                   	push   %eax
+  800b11:	ff 75 08             	push   0x8(%ebp)
+  800b14:	e8 8b fb ff ff       	call   8006a4 <fd_lookup>
+  800b19:	83 c4 10             	add    $0x10,%esp
+  800b1c:	85 c0                	test   %eax,%eax
+  800b1e:	78 49                	js     800b69 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b20:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b23:	83 ec 08             	sub    $0x8,%esp
+  800b26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b29:	50                   	push   %eax
+  800b2a:	ff 36                	push   (%esi)
+  800b2c:	e8 c3 fb ff ff       	call   8006f4 <dev_lookup>
+  800b31:	83 c4 10             	add    $0x10,%esp
+  800b34:	85 c0                	test   %eax,%eax
+  800b36:	78 31                	js     800b69 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b3b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b3f:	74 2f                	je     800b70 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b41:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b44:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b4b:	00 00 00 
+	stat->st_isdir = 0;
+  800b4e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b55:	00 00 00 
+	stat->st_dev = dev;
+  800b58:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b5e:	83 ec 08             	sub    $0x8,%esp
+  800b61:	53                   	push   %ebx
+  800b62:	56                   	push   %esi
+  800b63:	ff 50 14             	call   *0x14(%eax)
+  800b66:	83 c4 10             	add    $0x10,%esp
+}
+  800b69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b6c:	5b                   	pop    %ebx
+  800b6d:	5e                   	pop    %esi
+  800b6e:	5d                   	pop    %ebp
+  800b6f:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b70:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b75:	eb f2                	jmp    800b69 <fstat+0x67>
+
+00800b77 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	56                   	push   %esi
+  800b7b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800b7c:	83 ec 08             	sub    $0x8,%esp
+  800b7f:	6a 00                	push   $0x0
+  800b81:	ff 75 08             	push   0x8(%ebp)
+  800b84:	e8 e4 01 00 00       	call   800d6d <open>
+  800b89:	89 c3                	mov    %eax,%ebx
+  800b8b:	83 c4 10             	add    $0x10,%esp
+  800b8e:	85 c0                	test   %eax,%eax
+  800b90:	78 1b                	js     800bad <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800b92:	83 ec 08             	sub    $0x8,%esp
+  800b95:	ff 75 0c             	push   0xc(%ebp)
+  800b98:	50                   	push   %eax
+  800b99:	e8 64 ff ff ff       	call   800b02 <fstat>
+  800b9e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800ba0:	89 1c 24             	mov    %ebx,(%esp)
+  800ba3:	e8 26 fc ff ff       	call   8007ce <close>
+	return r;
+  800ba8:	83 c4 10             	add    $0x10,%esp
+  800bab:	89 f3                	mov    %esi,%ebx
+}
+  800bad:	89 d8                	mov    %ebx,%eax
+  800baf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bb2:	5b                   	pop    %ebx
+  800bb3:	5e                   	pop    %esi
+  800bb4:	5d                   	pop    %ebp
+  800bb5:	c3                   	ret
+
+00800bb6 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800bb6:	55                   	push   %ebp
+  800bb7:	89 e5                	mov    %esp,%ebp
+  800bb9:	56                   	push   %esi
+  800bba:	53                   	push   %ebx
+  800bbb:	89 c6                	mov    %eax,%esi
+  800bbd:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800bbf:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800bc6:	74 27                	je     800bef <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800bc8:	6a 07                	push   $0x7
+  800bca:	68 00 50 80 00       	push   $0x805000
+  800bcf:	56                   	push   %esi
+  800bd0:	ff 35 00 40 80 00    	push   0x804000
+  800bd6:	e8 ce 15 00 00       	call   8021a9 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800bdb:	83 c4 0c             	add    $0xc,%esp
+  800bde:	6a 00                	push   $0x0
+  800be0:	53                   	push   %ebx
+  800be1:	6a 00                	push   $0x0
+  800be3:	e8 49 15 00 00       	call   802131 <ipc_recv>
+}
+  800be8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800beb:	5b                   	pop    %ebx
+  800bec:	5e                   	pop    %esi
+  800bed:	5d                   	pop    %ebp
+  800bee:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bef:	83 ec 0c             	sub    $0xc,%esp
+  800bf2:	6a 01                	push   $0x1
+  800bf4:	e8 04 16 00 00       	call   8021fd <ipc_find_env>
+  800bf9:	a3 00 40 80 00       	mov    %eax,0x804000
+  800bfe:	83 c4 10             	add    $0x10,%esp
+  800c01:	eb c5                	jmp    800bc8 <fsipc+0x12>
+
+00800c03 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800c03:	55                   	push   %ebp
+  800c04:	89 e5                	mov    %esp,%ebp
+  800c06:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800c09:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c0f:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800c14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c17:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800c1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c21:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c26:	e8 8b ff ff ff       	call   800bb6 <fsipc>
+}
+  800c2b:	c9                   	leave
+  800c2c:	c3                   	ret
+
+00800c2d <devfile_flush>:
+{
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800c33:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c36:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c39:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800c3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c43:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c48:	e8 69 ff ff ff       	call   800bb6 <fsipc>
+}
+  800c4d:	c9                   	leave
+  800c4e:	c3                   	ret
+
+00800c4f <devfile_stat>:
+{
+  800c4f:	55                   	push   %ebp
+  800c50:	89 e5                	mov    %esp,%ebp
+  800c52:	53                   	push   %ebx
+  800c53:	83 ec 04             	sub    $0x4,%esp
+  800c56:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800c59:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c5c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c5f:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800c64:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c69:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c6e:	e8 43 ff ff ff       	call   800bb6 <fsipc>
+  800c73:	85 c0                	test   %eax,%eax
+  800c75:	78 2c                	js     800ca3 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800c77:	83 ec 08             	sub    $0x8,%esp
+  800c7a:	68 00 50 80 00       	push   $0x805000
+  800c7f:	53                   	push   %ebx
+  800c80:	e8 7c 11 00 00       	call   801e01 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800c85:	a1 80 50 80 00       	mov    0x805080,%eax
+  800c8a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800c90:	a1 84 50 80 00       	mov    0x805084,%eax
+  800c95:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800c9b:	83 c4 10             	add    $0x10,%esp
+  800c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ca6:	c9                   	leave
+  800ca7:	c3                   	ret
+
+00800ca8 <devfile_write>:
+{
+  800ca8:	55                   	push   %ebp
+  800ca9:	89 e5                	mov    %esp,%ebp
+  800cab:	83 ec 0c             	sub    $0xc,%esp
+  800cae:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800cb1:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800cb6:	39 d0                	cmp    %edx,%eax
+  800cb8:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbe:	8b 52 0c             	mov    0xc(%edx),%edx
+  800cc1:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800cc7:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800ccc:	50                   	push   %eax
+  800ccd:	ff 75 0c             	push   0xc(%ebp)
+  800cd0:	68 08 50 80 00       	push   $0x805008
+  800cd5:	e8 ad 12 00 00       	call   801f87 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800cda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cdf:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ce4:	e8 cd fe ff ff       	call   800bb6 <fsipc>
+}
+  800ce9:	c9                   	leave
+  800cea:	c3                   	ret
+
+00800ceb <devfile_read>:
+{
+  800ceb:	55                   	push   %ebp
+  800cec:	89 e5                	mov    %esp,%ebp
+  800cee:	56                   	push   %esi
+  800cef:	53                   	push   %ebx
+  800cf0:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800cf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cf9:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800cfe:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d09:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d0e:	e8 a3 fe ff ff       	call   800bb6 <fsipc>
+  800d13:	89 c3                	mov    %eax,%ebx
+  800d15:	85 c0                	test   %eax,%eax
+  800d17:	78 1f                	js     800d38 <devfile_read+0x4d>
+	assert(r <= n);
+  800d19:	39 c6                	cmp    %eax,%esi
+  800d1b:	72 24                	jb     800d41 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  800d1d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800d22:	7f 33                	jg     800d57 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800d24:	83 ec 04             	sub    $0x4,%esp
+  800d27:	50                   	push   %eax
+  800d28:	68 00 50 80 00       	push   $0x805000
+  800d2d:	ff 75 0c             	push   0xc(%ebp)
+  800d30:	e8 52 12 00 00       	call   801f87 <memmove>
+	return r;
+  800d35:	83 c4 10             	add    $0x10,%esp
+}
+  800d38:	89 d8                	mov    %ebx,%eax
+  800d3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d3d:	5b                   	pop    %ebx
+  800d3e:	5e                   	pop    %esi
+  800d3f:	5d                   	pop    %ebp
+  800d40:	c3                   	ret
+	assert(r <= n);
+  800d41:	68 68 27 80 00       	push   $0x802768
+  800d46:	68 6f 27 80 00       	push   $0x80276f
+  800d4b:	6a 7c                	push   $0x7c
+  800d4d:	68 84 27 80 00       	push   $0x802784
+  800d52:	e8 e1 09 00 00       	call   801738 <_panic>
+	assert(r <= PGSIZE);
+  800d57:	68 8f 27 80 00       	push   $0x80278f
+  800d5c:	68 6f 27 80 00       	push   $0x80276f
+  800d61:	6a 7d                	push   $0x7d
+  800d63:	68 84 27 80 00       	push   $0x802784
+  800d68:	e8 cb 09 00 00       	call   801738 <_panic>
+
+00800d6d <open>:
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	56                   	push   %esi
+  800d71:	53                   	push   %ebx
+  800d72:	83 ec 1c             	sub    $0x1c,%esp
+  800d75:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800d78:	56                   	push   %esi
+  800d79:	e8 48 10 00 00       	call   801dc6 <strlen>
+  800d7e:	83 c4 10             	add    $0x10,%esp
+  800d81:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800d86:	7f 6c                	jg     800df4 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800d88:	83 ec 0c             	sub    $0xc,%esp
+  800d8b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d8e:	50                   	push   %eax
+  800d8f:	e8 ba f8 ff ff       	call   80064e <fd_alloc>
+  800d94:	89 c3                	mov    %eax,%ebx
+  800d96:	83 c4 10             	add    $0x10,%esp
+  800d99:	85 c0                	test   %eax,%eax
+  800d9b:	78 3c                	js     800dd9 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800d9d:	83 ec 08             	sub    $0x8,%esp
+  800da0:	56                   	push   %esi
+  800da1:	68 00 50 80 00       	push   $0x805000
+  800da6:	e8 56 10 00 00       	call   801e01 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800dab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dae:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800db3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800db6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dbb:	e8 f6 fd ff ff       	call   800bb6 <fsipc>
+  800dc0:	89 c3                	mov    %eax,%ebx
+  800dc2:	83 c4 10             	add    $0x10,%esp
+  800dc5:	85 c0                	test   %eax,%eax
+  800dc7:	78 19                	js     800de2 <open+0x75>
+	return fd2num(fd);
+  800dc9:	83 ec 0c             	sub    $0xc,%esp
+  800dcc:	ff 75 f4             	push   -0xc(%ebp)
+  800dcf:	e8 53 f8 ff ff       	call   800627 <fd2num>
+  800dd4:	89 c3                	mov    %eax,%ebx
+  800dd6:	83 c4 10             	add    $0x10,%esp
+}
+  800dd9:	89 d8                	mov    %ebx,%eax
+  800ddb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dde:	5b                   	pop    %ebx
+  800ddf:	5e                   	pop    %esi
+  800de0:	5d                   	pop    %ebp
+  800de1:	c3                   	ret
+		fd_close(fd, 0);
+  800de2:	83 ec 08             	sub    $0x8,%esp
+  800de5:	6a 00                	push   $0x0
+  800de7:	ff 75 f4             	push   -0xc(%ebp)
+  800dea:	e8 58 f9 ff ff       	call   800747 <fd_close>
+		return r;
+  800def:	83 c4 10             	add    $0x10,%esp
+  800df2:	eb e5                	jmp    800dd9 <open+0x6c>
+		return -E_BAD_PATH;
+  800df4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800df9:	eb de                	jmp    800dd9 <open+0x6c>
+
+00800dfb <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800dfb:	55                   	push   %ebp
+  800dfc:	89 e5                	mov    %esp,%ebp
+  800dfe:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800e01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e06:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e0b:	e8 a6 fd ff ff       	call   800bb6 <fsipc>
+}
+  800e10:	c9                   	leave
+  800e11:	c3                   	ret
+
+00800e12 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800e12:	55                   	push   %ebp
+  800e13:	89 e5                	mov    %esp,%ebp
+  800e15:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800e18:	68 9b 27 80 00       	push   $0x80279b
+  800e1d:	ff 75 0c             	push   0xc(%ebp)
+  800e20:	e8 dc 0f 00 00       	call   801e01 <strcpy>
+	return 0;
+}
+  800e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2a:	c9                   	leave
+  800e2b:	c3                   	ret
+
+00800e2c <devsock_close>:
+{
+  800e2c:	55                   	push   %ebp
+  800e2d:	89 e5                	mov    %esp,%ebp
+  800e2f:	53                   	push   %ebx
+  800e30:	83 ec 10             	sub    $0x10,%esp
+  800e33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800e36:	53                   	push   %ebx
+  800e37:	e8 d1 13 00 00       	call   80220d <pageref>
+  800e3c:	89 c2                	mov    %eax,%edx
+  800e3e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e41:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800e46:	83 fa 01             	cmp    $0x1,%edx
+  800e49:	74 05                	je     800e50 <devsock_close+0x24>
+}
+  800e4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e4e:	c9                   	leave
+  800e4f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800e50:	83 ec 0c             	sub    $0xc,%esp
+  800e53:	ff 73 0c             	push   0xc(%ebx)
+  800e56:	e8 b7 02 00 00       	call   801112 <nsipc_close>
+  800e5b:	83 c4 10             	add    $0x10,%esp
+  800e5e:	eb eb                	jmp    800e4b <devsock_close+0x1f>
+
+00800e60 <devsock_write>:
+{
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800e66:	6a 00                	push   $0x0
+  800e68:	ff 75 10             	push   0x10(%ebp)
+  800e6b:	ff 75 0c             	push   0xc(%ebp)
+  800e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e71:	ff 70 0c             	push   0xc(%eax)
+  800e74:	e8 79 03 00 00       	call   8011f2 <nsipc_send>
+}
+  800e79:	c9                   	leave
+  800e7a:	c3                   	ret
+
+00800e7b <devsock_read>:
+{
+  800e7b:	55                   	push   %ebp
+  800e7c:	89 e5                	mov    %esp,%ebp
+  800e7e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800e81:	6a 00                	push   $0x0
+  800e83:	ff 75 10             	push   0x10(%ebp)
+  800e86:	ff 75 0c             	push   0xc(%ebp)
+  800e89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e8c:	ff 70 0c             	push   0xc(%eax)
+  800e8f:	e8 ef 02 00 00       	call   801183 <nsipc_recv>
+}
+  800e94:	c9                   	leave
+  800e95:	c3                   	ret
+
+00800e96 <fd2sockid>:
+{
+  800e96:	55                   	push   %ebp
+  800e97:	89 e5                	mov    %esp,%ebp
+  800e99:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800e9c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800e9f:	52                   	push   %edx
+  800ea0:	50                   	push   %eax
+  800ea1:	e8 fe f7 ff ff       	call   8006a4 <fd_lookup>
+  800ea6:	83 c4 10             	add    $0x10,%esp
+  800ea9:	85 c0                	test   %eax,%eax
+  800eab:	78 10                	js     800ebd <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800ead:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eb0:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800eb6:	39 08                	cmp    %ecx,(%eax)
+  800eb8:	75 05                	jne    800ebf <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800eba:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800ebd:	c9                   	leave
+  800ebe:	c3                   	ret
+		return -E_NOT_SUPP;
+  800ebf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ec4:	eb f7                	jmp    800ebd <fd2sockid+0x27>
+
+00800ec6 <alloc_sockfd>:
+{
+  800ec6:	55                   	push   %ebp
+  800ec7:	89 e5                	mov    %esp,%ebp
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+  800ecb:	83 ec 1c             	sub    $0x1c,%esp
+  800ece:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800ed0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ed3:	50                   	push   %eax
+  800ed4:	e8 75 f7 ff ff       	call   80064e <fd_alloc>
+  800ed9:	89 c3                	mov    %eax,%ebx
+  800edb:	83 c4 10             	add    $0x10,%esp
+  800ede:	85 c0                	test   %eax,%eax
+  800ee0:	78 43                	js     800f25 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800ee2:	83 ec 04             	sub    $0x4,%esp
+  800ee5:	68 07 04 00 00       	push   $0x407
+  800eea:	ff 75 f4             	push   -0xc(%ebp)
+  800eed:	6a 00                	push   $0x0
+  800eef:	e8 0e f3 ff ff       	call   800202 <sys_page_alloc>
+  800ef4:	89 c3                	mov    %eax,%ebx
+  800ef6:	83 c4 10             	add    $0x10,%esp
+  800ef9:	85 c0                	test   %eax,%eax
+  800efb:	78 28                	js     800f25 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800efd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f00:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800f06:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800f08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f0b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800f12:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800f15:	83 ec 0c             	sub    $0xc,%esp
+  800f18:	50                   	push   %eax
+  800f19:	e8 09 f7 ff ff       	call   800627 <fd2num>
+  800f1e:	89 c3                	mov    %eax,%ebx
+  800f20:	83 c4 10             	add    $0x10,%esp
+  800f23:	eb 0c                	jmp    800f31 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800f25:	83 ec 0c             	sub    $0xc,%esp
+  800f28:	56                   	push   %esi
+  800f29:	e8 e4 01 00 00       	call   801112 <nsipc_close>
+		return r;
+  800f2e:	83 c4 10             	add    $0x10,%esp
+}
+  800f31:	89 d8                	mov    %ebx,%eax
+  800f33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5d                   	pop    %ebp
+  800f39:	c3                   	ret
+
+00800f3a <accept>:
+{
+  800f3a:	55                   	push   %ebp
+  800f3b:	89 e5                	mov    %esp,%ebp
+  800f3d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f43:	e8 4e ff ff ff       	call   800e96 <fd2sockid>
+  800f48:	85 c0                	test   %eax,%eax
+  800f4a:	78 1b                	js     800f67 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800f4c:	83 ec 04             	sub    $0x4,%esp
+  800f4f:	ff 75 10             	push   0x10(%ebp)
+  800f52:	ff 75 0c             	push   0xc(%ebp)
+  800f55:	50                   	push   %eax
+  800f56:	e8 0e 01 00 00       	call   801069 <nsipc_accept>
+  800f5b:	83 c4 10             	add    $0x10,%esp
+  800f5e:	85 c0                	test   %eax,%eax
+  800f60:	78 05                	js     800f67 <accept+0x2d>
+	return alloc_sockfd(r);
+  800f62:	e8 5f ff ff ff       	call   800ec6 <alloc_sockfd>
+}
+  800f67:	c9                   	leave
+  800f68:	c3                   	ret
+
+00800f69 <bind>:
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f72:	e8 1f ff ff ff       	call   800e96 <fd2sockid>
+  800f77:	85 c0                	test   %eax,%eax
+  800f79:	78 12                	js     800f8d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800f7b:	83 ec 04             	sub    $0x4,%esp
+  800f7e:	ff 75 10             	push   0x10(%ebp)
+  800f81:	ff 75 0c             	push   0xc(%ebp)
+  800f84:	50                   	push   %eax
+  800f85:	e8 31 01 00 00       	call   8010bb <nsipc_bind>
+  800f8a:	83 c4 10             	add    $0x10,%esp
+}
+  800f8d:	c9                   	leave
+  800f8e:	c3                   	ret
+
+00800f8f <shutdown>:
+{
+  800f8f:	55                   	push   %ebp
+  800f90:	89 e5                	mov    %esp,%ebp
+  800f92:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f98:	e8 f9 fe ff ff       	call   800e96 <fd2sockid>
+  800f9d:	85 c0                	test   %eax,%eax
+  800f9f:	78 0f                	js     800fb0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800fa1:	83 ec 08             	sub    $0x8,%esp
+  800fa4:	ff 75 0c             	push   0xc(%ebp)
+  800fa7:	50                   	push   %eax
+  800fa8:	e8 43 01 00 00       	call   8010f0 <nsipc_shutdown>
+  800fad:	83 c4 10             	add    $0x10,%esp
+}
+  800fb0:	c9                   	leave
+  800fb1:	c3                   	ret
+
+00800fb2 <connect>:
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800fb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fbb:	e8 d6 fe ff ff       	call   800e96 <fd2sockid>
+  800fc0:	85 c0                	test   %eax,%eax
+  800fc2:	78 12                	js     800fd6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800fc4:	83 ec 04             	sub    $0x4,%esp
+  800fc7:	ff 75 10             	push   0x10(%ebp)
+  800fca:	ff 75 0c             	push   0xc(%ebp)
+  800fcd:	50                   	push   %eax
+  800fce:	e8 59 01 00 00       	call   80112c <nsipc_connect>
+  800fd3:	83 c4 10             	add    $0x10,%esp
+}
+  800fd6:	c9                   	leave
+  800fd7:	c3                   	ret
+
+00800fd8 <listen>:
+{
+  800fd8:	55                   	push   %ebp
+  800fd9:	89 e5                	mov    %esp,%ebp
+  800fdb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800fde:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe1:	e8 b0 fe ff ff       	call   800e96 <fd2sockid>
+  800fe6:	85 c0                	test   %eax,%eax
+  800fe8:	78 0f                	js     800ff9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800fea:	83 ec 08             	sub    $0x8,%esp
+  800fed:	ff 75 0c             	push   0xc(%ebp)
+  800ff0:	50                   	push   %eax
+  800ff1:	e8 6b 01 00 00       	call   801161 <nsipc_listen>
+  800ff6:	83 c4 10             	add    $0x10,%esp
+}
+  800ff9:	c9                   	leave
+  800ffa:	c3                   	ret
+
+00800ffb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801001:	ff 75 10             	push   0x10(%ebp)
+  801004:	ff 75 0c             	push   0xc(%ebp)
+  801007:	ff 75 08             	push   0x8(%ebp)
+  80100a:	e8 41 02 00 00       	call   801250 <nsipc_socket>
+  80100f:	83 c4 10             	add    $0x10,%esp
+  801012:	85 c0                	test   %eax,%eax
+  801014:	78 05                	js     80101b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801016:	e8 ab fe ff ff       	call   800ec6 <alloc_sockfd>
+}
+  80101b:	c9                   	leave
+  80101c:	c3                   	ret
+
+0080101d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	53                   	push   %ebx
+  801021:	83 ec 04             	sub    $0x4,%esp
+  801024:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801026:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80102d:	74 26                	je     801055 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80102f:	6a 07                	push   $0x7
+  801031:	68 00 60 80 00       	push   $0x806000
+  801036:	53                   	push   %ebx
+  801037:	ff 35 04 40 80 00    	push   0x804004
+  80103d:	e8 67 11 00 00       	call   8021a9 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801042:	83 c4 0c             	add    $0xc,%esp
+  801045:	6a 00                	push   $0x0
+  801047:	6a 00                	push   $0x0
+  801049:	6a 00                	push   $0x0
+  80104b:	e8 e1 10 00 00       	call   802131 <ipc_recv>
+}
+  801050:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801053:	c9                   	leave
+  801054:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801055:	83 ec 0c             	sub    $0xc,%esp
+  801058:	6a 02                	push   $0x2
+  80105a:	e8 9e 11 00 00       	call   8021fd <ipc_find_env>
+  80105f:	a3 04 40 80 00       	mov    %eax,0x804004
+  801064:	83 c4 10             	add    $0x10,%esp
+  801067:	eb c6                	jmp    80102f <nsipc+0x12>
+
+00801069 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801069:	55                   	push   %ebp
+  80106a:	89 e5                	mov    %esp,%ebp
+  80106c:	56                   	push   %esi
+  80106d:	53                   	push   %ebx
+  80106e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801071:	8b 45 08             	mov    0x8(%ebp),%eax
+  801074:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801079:	8b 06                	mov    (%esi),%eax
+  80107b:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801080:	b8 01 00 00 00       	mov    $0x1,%eax
+  801085:	e8 93 ff ff ff       	call   80101d <nsipc>
+  80108a:	89 c3                	mov    %eax,%ebx
+  80108c:	85 c0                	test   %eax,%eax
+  80108e:	79 09                	jns    801099 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801090:	89 d8                	mov    %ebx,%eax
+  801092:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801095:	5b                   	pop    %ebx
+  801096:	5e                   	pop    %esi
+  801097:	5d                   	pop    %ebp
+  801098:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801099:	83 ec 04             	sub    $0x4,%esp
+  80109c:	ff 35 10 60 80 00    	push   0x806010
+  8010a2:	68 00 60 80 00       	push   $0x806000
+  8010a7:	ff 75 0c             	push   0xc(%ebp)
+  8010aa:	e8 d8 0e 00 00       	call   801f87 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8010af:	a1 10 60 80 00       	mov    0x806010,%eax
+  8010b4:	89 06                	mov    %eax,(%esi)
+  8010b6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8010b9:	eb d5                	jmp    801090 <nsipc_accept+0x27>
+
+008010bb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8010bb:	55                   	push   %ebp
+  8010bc:	89 e5                	mov    %esp,%ebp
+  8010be:	53                   	push   %ebx
+  8010bf:	83 ec 08             	sub    $0x8,%esp
+  8010c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8010c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010c8:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8010cd:	53                   	push   %ebx
+  8010ce:	ff 75 0c             	push   0xc(%ebp)
+  8010d1:	68 04 60 80 00       	push   $0x806004
+  8010d6:	e8 ac 0e 00 00       	call   801f87 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8010db:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8010e1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010e6:	e8 32 ff ff ff       	call   80101d <nsipc>
+}
+  8010eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010ee:	c9                   	leave
+  8010ef:	c3                   	ret
+
+008010f0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8010f0:	55                   	push   %ebp
+  8010f1:	89 e5                	mov    %esp,%ebp
+  8010f3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8010f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f9:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8010fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801101:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801106:	b8 03 00 00 00       	mov    $0x3,%eax
+  80110b:	e8 0d ff ff ff       	call   80101d <nsipc>
+}
+  801110:	c9                   	leave
+  801111:	c3                   	ret
+
+00801112 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801112:	55                   	push   %ebp
+  801113:	89 e5                	mov    %esp,%ebp
+  801115:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801118:	8b 45 08             	mov    0x8(%ebp),%eax
+  80111b:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801120:	b8 04 00 00 00       	mov    $0x4,%eax
+  801125:	e8 f3 fe ff ff       	call   80101d <nsipc>
+}
+  80112a:	c9                   	leave
+  80112b:	c3                   	ret
+
+0080112c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80112c:	55                   	push   %ebp
+  80112d:	89 e5                	mov    %esp,%ebp
+  80112f:	53                   	push   %ebx
+  801130:	83 ec 08             	sub    $0x8,%esp
+  801133:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801136:	8b 45 08             	mov    0x8(%ebp),%eax
+  801139:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80113e:	53                   	push   %ebx
+  80113f:	ff 75 0c             	push   0xc(%ebp)
+  801142:	68 04 60 80 00       	push   $0x806004
+  801147:	e8 3b 0e 00 00       	call   801f87 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80114c:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801152:	b8 05 00 00 00       	mov    $0x5,%eax
+  801157:	e8 c1 fe ff ff       	call   80101d <nsipc>
+}
+  80115c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80115f:	c9                   	leave
+  801160:	c3                   	ret
+
+00801161 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801161:	55                   	push   %ebp
+  801162:	89 e5                	mov    %esp,%ebp
+  801164:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801167:	8b 45 08             	mov    0x8(%ebp),%eax
+  80116a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  80116f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801172:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801177:	b8 06 00 00 00       	mov    $0x6,%eax
+  80117c:	e8 9c fe ff ff       	call   80101d <nsipc>
+}
+  801181:	c9                   	leave
+  801182:	c3                   	ret
+
+00801183 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801183:	55                   	push   %ebp
+  801184:	89 e5                	mov    %esp,%ebp
+  801186:	56                   	push   %esi
+  801187:	53                   	push   %ebx
+  801188:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80118b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80118e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801193:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801199:	8b 45 14             	mov    0x14(%ebp),%eax
+  80119c:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8011a1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8011a6:	e8 72 fe ff ff       	call   80101d <nsipc>
+  8011ab:	89 c3                	mov    %eax,%ebx
+  8011ad:	85 c0                	test   %eax,%eax
+  8011af:	78 22                	js     8011d3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8011b1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8011b6:	39 c6                	cmp    %eax,%esi
+  8011b8:	0f 4e c6             	cmovle %esi,%eax
+  8011bb:	39 c3                	cmp    %eax,%ebx
+  8011bd:	7f 1d                	jg     8011dc <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8011bf:	83 ec 04             	sub    $0x4,%esp
+  8011c2:	53                   	push   %ebx
+  8011c3:	68 00 60 80 00       	push   $0x806000
+  8011c8:	ff 75 0c             	push   0xc(%ebp)
+  8011cb:	e8 b7 0d 00 00       	call   801f87 <memmove>
+  8011d0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8011d3:	89 d8                	mov    %ebx,%eax
+  8011d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011d8:	5b                   	pop    %ebx
+  8011d9:	5e                   	pop    %esi
+  8011da:	5d                   	pop    %ebp
+  8011db:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8011dc:	68 a7 27 80 00       	push   $0x8027a7
+  8011e1:	68 6f 27 80 00       	push   $0x80276f
+  8011e6:	6a 62                	push   $0x62
+  8011e8:	68 bc 27 80 00       	push   $0x8027bc
+  8011ed:	e8 46 05 00 00       	call   801738 <_panic>
+
+008011f2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	53                   	push   %ebx
+  8011f6:	83 ec 04             	sub    $0x4,%esp
+  8011f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8011fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ff:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801204:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80120a:	7f 2e                	jg     80123a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80120c:	83 ec 04             	sub    $0x4,%esp
+  80120f:	53                   	push   %ebx
+  801210:	ff 75 0c             	push   0xc(%ebp)
+  801213:	68 0c 60 80 00       	push   $0x80600c
+  801218:	e8 6a 0d 00 00       	call   801f87 <memmove>
+	nsipcbuf.send.req_size = size;
+  80121d:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801223:	8b 45 14             	mov    0x14(%ebp),%eax
+  801226:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  80122b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801230:	e8 e8 fd ff ff       	call   80101d <nsipc>
+}
+  801235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801238:	c9                   	leave
+  801239:	c3                   	ret
+	assert(size < 1600);
+  80123a:	68 c8 27 80 00       	push   $0x8027c8
+  80123f:	68 6f 27 80 00       	push   $0x80276f
+  801244:	6a 6d                	push   $0x6d
+  801246:	68 bc 27 80 00       	push   $0x8027bc
+  80124b:	e8 e8 04 00 00       	call   801738 <_panic>
+
+00801250 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801250:	55                   	push   %ebp
+  801251:	89 e5                	mov    %esp,%ebp
+  801253:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801256:	8b 45 08             	mov    0x8(%ebp),%eax
+  801259:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  80125e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801261:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801266:	8b 45 10             	mov    0x10(%ebp),%eax
+  801269:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  80126e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801273:	e8 a5 fd ff ff       	call   80101d <nsipc>
+}
+  801278:	c9                   	leave
+  801279:	c3                   	ret
+
+0080127a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80127a:	55                   	push   %ebp
+  80127b:	89 e5                	mov    %esp,%ebp
+  80127d:	56                   	push   %esi
+  80127e:	53                   	push   %ebx
+  80127f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801282:	83 ec 0c             	sub    $0xc,%esp
+  801285:	ff 75 08             	push   0x8(%ebp)
+  801288:	e8 aa f3 ff ff       	call   800637 <fd2data>
+  80128d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80128f:	83 c4 08             	add    $0x8,%esp
+  801292:	68 d4 27 80 00       	push   $0x8027d4
+  801297:	53                   	push   %ebx
+  801298:	e8 64 0b 00 00       	call   801e01 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80129d:	8b 46 04             	mov    0x4(%esi),%eax
+  8012a0:	2b 06                	sub    (%esi),%eax
+  8012a2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8012a8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8012af:	00 00 00 
+	stat->st_dev = &devpipe;
+  8012b2:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8012b9:	30 80 00 
+	return 0;
+}
+  8012bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012c4:	5b                   	pop    %ebx
+  8012c5:	5e                   	pop    %esi
+  8012c6:	5d                   	pop    %ebp
+  8012c7:	c3                   	ret
+
+008012c8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8012c8:	55                   	push   %ebp
+  8012c9:	89 e5                	mov    %esp,%ebp
+  8012cb:	53                   	push   %ebx
+  8012cc:	83 ec 0c             	sub    $0xc,%esp
+  8012cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8012d2:	53                   	push   %ebx
+  8012d3:	6a 00                	push   $0x0
+  8012d5:	e8 f0 ef ff ff       	call   8002ca <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8012da:	89 1c 24             	mov    %ebx,(%esp)
+  8012dd:	e8 55 f3 ff ff       	call   800637 <fd2data>
+  8012e2:	83 c4 08             	add    $0x8,%esp
+  8012e5:	50                   	push   %eax
+  8012e6:	6a 00                	push   $0x0
+  8012e8:	e8 dd ef ff ff       	call   8002ca <sys_page_unmap>
+}
+  8012ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f0:	c9                   	leave
+  8012f1:	c3                   	ret
+
+008012f2 <_pipeisclosed>:
+{
+  8012f2:	55                   	push   %ebp
+  8012f3:	89 e5                	mov    %esp,%ebp
+  8012f5:	57                   	push   %edi
+  8012f6:	56                   	push   %esi
+  8012f7:	53                   	push   %ebx
+  8012f8:	83 ec 1c             	sub    $0x1c,%esp
+  8012fb:	89 c7                	mov    %eax,%edi
+  8012fd:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8012ff:	a1 08 40 80 00       	mov    0x804008,%eax
+  801304:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801307:	83 ec 0c             	sub    $0xc,%esp
+  80130a:	57                   	push   %edi
+  80130b:	e8 fd 0e 00 00       	call   80220d <pageref>
+  801310:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801313:	89 34 24             	mov    %esi,(%esp)
+  801316:	e8 f2 0e 00 00       	call   80220d <pageref>
+		nn = thisenv->env_runs;
+  80131b:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801321:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801324:	83 c4 10             	add    $0x10,%esp
+  801327:	39 cb                	cmp    %ecx,%ebx
+  801329:	74 1b                	je     801346 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80132b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80132e:	75 cf                	jne    8012ff <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801330:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801333:	6a 01                	push   $0x1
+  801335:	50                   	push   %eax
+  801336:	53                   	push   %ebx
+  801337:	68 db 27 80 00       	push   $0x8027db
+  80133c:	e8 d2 04 00 00       	call   801813 <cprintf>
+  801341:	83 c4 10             	add    $0x10,%esp
+  801344:	eb b9                	jmp    8012ff <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801346:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801349:	0f 94 c0             	sete   %al
+  80134c:	0f b6 c0             	movzbl %al,%eax
+}
+  80134f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801352:	5b                   	pop    %ebx
+  801353:	5e                   	pop    %esi
+  801354:	5f                   	pop    %edi
+  801355:	5d                   	pop    %ebp
+  801356:	c3                   	ret
+
+00801357 <devpipe_write>:
+{
+  801357:	55                   	push   %ebp
+  801358:	89 e5                	mov    %esp,%ebp
+  80135a:	57                   	push   %edi
+  80135b:	56                   	push   %esi
+  80135c:	53                   	push   %ebx
+  80135d:	83 ec 28             	sub    $0x28,%esp
+  801360:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801363:	56                   	push   %esi
+  801364:	e8 ce f2 ff ff       	call   800637 <fd2data>
+  801369:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80136b:	83 c4 10             	add    $0x10,%esp
+  80136e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801373:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801376:	75 09                	jne    801381 <devpipe_write+0x2a>
+	return i;
+  801378:	89 f8                	mov    %edi,%eax
+  80137a:	eb 23                	jmp    80139f <devpipe_write+0x48>
+			sys_yield();
+  80137c:	e8 01 ee ff ff       	call   800182 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801381:	8b 43 04             	mov    0x4(%ebx),%eax
+  801384:	8b 0b                	mov    (%ebx),%ecx
+  801386:	8d 51 20             	lea    0x20(%ecx),%edx
+  801389:	39 d0                	cmp    %edx,%eax
+  80138b:	72 1a                	jb     8013a7 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80138d:	89 da                	mov    %ebx,%edx
+  80138f:	89 f0                	mov    %esi,%eax
+  801391:	e8 5c ff ff ff       	call   8012f2 <_pipeisclosed>
+  801396:	85 c0                	test   %eax,%eax
+  801398:	74 e2                	je     80137c <devpipe_write+0x25>
+				return 0;
+  80139a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80139f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a2:	5b                   	pop    %ebx
+  8013a3:	5e                   	pop    %esi
+  8013a4:	5f                   	pop    %edi
+  8013a5:	5d                   	pop    %ebp
+  8013a6:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8013a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013aa:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8013ae:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8013b1:	89 c2                	mov    %eax,%edx
+  8013b3:	c1 fa 1f             	sar    $0x1f,%edx
+  8013b6:	89 d1                	mov    %edx,%ecx
+  8013b8:	c1 e9 1b             	shr    $0x1b,%ecx
+  8013bb:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8013be:	83 e2 1f             	and    $0x1f,%edx
+  8013c1:	29 ca                	sub    %ecx,%edx
+  8013c3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8013c7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8013cb:	83 c0 01             	add    $0x1,%eax
+  8013ce:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8013d1:	83 c7 01             	add    $0x1,%edi
+  8013d4:	eb 9d                	jmp    801373 <devpipe_write+0x1c>
+
+008013d6 <devpipe_read>:
+{
+  8013d6:	55                   	push   %ebp
+  8013d7:	89 e5                	mov    %esp,%ebp
+  8013d9:	57                   	push   %edi
+  8013da:	56                   	push   %esi
+  8013db:	53                   	push   %ebx
+  8013dc:	83 ec 18             	sub    $0x18,%esp
+  8013df:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8013e2:	57                   	push   %edi
+  8013e3:	e8 4f f2 ff ff       	call   800637 <fd2data>
+  8013e8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8013ea:	83 c4 10             	add    $0x10,%esp
+  8013ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8013f5:	75 13                	jne    80140a <devpipe_read+0x34>
+	return i;
+  8013f7:	89 f0                	mov    %esi,%eax
+  8013f9:	eb 02                	jmp    8013fd <devpipe_read+0x27>
+				return i;
+  8013fb:	89 f0                	mov    %esi,%eax
+}
+  8013fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801400:	5b                   	pop    %ebx
+  801401:	5e                   	pop    %esi
+  801402:	5f                   	pop    %edi
+  801403:	5d                   	pop    %ebp
+  801404:	c3                   	ret
+			sys_yield();
+  801405:	e8 78 ed ff ff       	call   800182 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80140a:	8b 03                	mov    (%ebx),%eax
+  80140c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80140f:	75 18                	jne    801429 <devpipe_read+0x53>
+			if (i > 0)
+  801411:	85 f6                	test   %esi,%esi
+  801413:	75 e6                	jne    8013fb <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801415:	89 da                	mov    %ebx,%edx
+  801417:	89 f8                	mov    %edi,%eax
+  801419:	e8 d4 fe ff ff       	call   8012f2 <_pipeisclosed>
+  80141e:	85 c0                	test   %eax,%eax
+  801420:	74 e3                	je     801405 <devpipe_read+0x2f>
+				return 0;
+  801422:	b8 00 00 00 00       	mov    $0x0,%eax
+  801427:	eb d4                	jmp    8013fd <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801429:	99                   	cltd
+  80142a:	c1 ea 1b             	shr    $0x1b,%edx
+  80142d:	01 d0                	add    %edx,%eax
+  80142f:	83 e0 1f             	and    $0x1f,%eax
+  801432:	29 d0                	sub    %edx,%eax
+  801434:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801439:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80143f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801442:	83 c6 01             	add    $0x1,%esi
+  801445:	eb ab                	jmp    8013f2 <devpipe_read+0x1c>
+
+00801447 <pipe>:
+{
+  801447:	55                   	push   %ebp
+  801448:	89 e5                	mov    %esp,%ebp
+  80144a:	56                   	push   %esi
+  80144b:	53                   	push   %ebx
+  80144c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80144f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801452:	50                   	push   %eax
+  801453:	e8 f6 f1 ff ff       	call   80064e <fd_alloc>
+  801458:	89 c3                	mov    %eax,%ebx
+  80145a:	83 c4 10             	add    $0x10,%esp
+  80145d:	85 c0                	test   %eax,%eax
+  80145f:	0f 88 23 01 00 00    	js     801588 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801465:	83 ec 04             	sub    $0x4,%esp
+  801468:	68 07 04 00 00       	push   $0x407
+  80146d:	ff 75 f4             	push   -0xc(%ebp)
+  801470:	6a 00                	push   $0x0
+  801472:	e8 8b ed ff ff       	call   800202 <sys_page_alloc>
+  801477:	89 c3                	mov    %eax,%ebx
+  801479:	83 c4 10             	add    $0x10,%esp
+  80147c:	85 c0                	test   %eax,%eax
+  80147e:	0f 88 04 01 00 00    	js     801588 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801484:	83 ec 0c             	sub    $0xc,%esp
+  801487:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80148a:	50                   	push   %eax
+  80148b:	e8 be f1 ff ff       	call   80064e <fd_alloc>
+  801490:	89 c3                	mov    %eax,%ebx
+  801492:	83 c4 10             	add    $0x10,%esp
+  801495:	85 c0                	test   %eax,%eax
+  801497:	0f 88 db 00 00 00    	js     801578 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80149d:	83 ec 04             	sub    $0x4,%esp
+  8014a0:	68 07 04 00 00       	push   $0x407
+  8014a5:	ff 75 f0             	push   -0x10(%ebp)
+  8014a8:	6a 00                	push   $0x0
+  8014aa:	e8 53 ed ff ff       	call   800202 <sys_page_alloc>
+  8014af:	89 c3                	mov    %eax,%ebx
+  8014b1:	83 c4 10             	add    $0x10,%esp
+  8014b4:	85 c0                	test   %eax,%eax
+  8014b6:	0f 88 bc 00 00 00    	js     801578 <pipe+0x131>
+	va = fd2data(fd0);
+  8014bc:	83 ec 0c             	sub    $0xc,%esp
+  8014bf:	ff 75 f4             	push   -0xc(%ebp)
+  8014c2:	e8 70 f1 ff ff       	call   800637 <fd2data>
+  8014c7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014c9:	83 c4 0c             	add    $0xc,%esp
+  8014cc:	68 07 04 00 00       	push   $0x407
+  8014d1:	50                   	push   %eax
+  8014d2:	6a 00                	push   $0x0
+  8014d4:	e8 29 ed ff ff       	call   800202 <sys_page_alloc>
+  8014d9:	89 c3                	mov    %eax,%ebx
+  8014db:	83 c4 10             	add    $0x10,%esp
+  8014de:	85 c0                	test   %eax,%eax
+  8014e0:	0f 88 82 00 00 00    	js     801568 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014e6:	83 ec 0c             	sub    $0xc,%esp
+  8014e9:	ff 75 f0             	push   -0x10(%ebp)
+  8014ec:	e8 46 f1 ff ff       	call   800637 <fd2data>
+  8014f1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014f8:	50                   	push   %eax
+  8014f9:	6a 00                	push   $0x0
+  8014fb:	56                   	push   %esi
+  8014fc:	6a 00                	push   $0x0
+  8014fe:	e8 85 ed ff ff       	call   800288 <sys_page_map>
+  801503:	89 c3                	mov    %eax,%ebx
+  801505:	83 c4 20             	add    $0x20,%esp
+  801508:	85 c0                	test   %eax,%eax
+  80150a:	78 4e                	js     80155a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80150c:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801511:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801514:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801516:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801519:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801520:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801523:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801525:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801528:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80152f:	83 ec 0c             	sub    $0xc,%esp
+  801532:	ff 75 f4             	push   -0xc(%ebp)
+  801535:	e8 ed f0 ff ff       	call   800627 <fd2num>
+  80153a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80153d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80153f:	83 c4 04             	add    $0x4,%esp
+  801542:	ff 75 f0             	push   -0x10(%ebp)
+  801545:	e8 dd f0 ff ff       	call   800627 <fd2num>
+  80154a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80154d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801550:	83 c4 10             	add    $0x10,%esp
+  801553:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801558:	eb 2e                	jmp    801588 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80155a:	83 ec 08             	sub    $0x8,%esp
+  80155d:	56                   	push   %esi
+  80155e:	6a 00                	push   $0x0
+  801560:	e8 65 ed ff ff       	call   8002ca <sys_page_unmap>
+  801565:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801568:	83 ec 08             	sub    $0x8,%esp
+  80156b:	ff 75 f0             	push   -0x10(%ebp)
+  80156e:	6a 00                	push   $0x0
+  801570:	e8 55 ed ff ff       	call   8002ca <sys_page_unmap>
+  801575:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801578:	83 ec 08             	sub    $0x8,%esp
+  80157b:	ff 75 f4             	push   -0xc(%ebp)
+  80157e:	6a 00                	push   $0x0
+  801580:	e8 45 ed ff ff       	call   8002ca <sys_page_unmap>
+  801585:	83 c4 10             	add    $0x10,%esp
+}
+  801588:	89 d8                	mov    %ebx,%eax
+  80158a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80158d:	5b                   	pop    %ebx
+  80158e:	5e                   	pop    %esi
+  80158f:	5d                   	pop    %ebp
+  801590:	c3                   	ret
+
+00801591 <pipeisclosed>:
+{
+  801591:	55                   	push   %ebp
+  801592:	89 e5                	mov    %esp,%ebp
+  801594:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801597:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80159a:	50                   	push   %eax
+  80159b:	ff 75 08             	push   0x8(%ebp)
+  80159e:	e8 01 f1 ff ff       	call   8006a4 <fd_lookup>
+  8015a3:	83 c4 10             	add    $0x10,%esp
+  8015a6:	85 c0                	test   %eax,%eax
+  8015a8:	78 18                	js     8015c2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8015aa:	83 ec 0c             	sub    $0xc,%esp
+  8015ad:	ff 75 f4             	push   -0xc(%ebp)
+  8015b0:	e8 82 f0 ff ff       	call   800637 <fd2data>
+  8015b5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8015b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ba:	e8 33 fd ff ff       	call   8012f2 <_pipeisclosed>
+  8015bf:	83 c4 10             	add    $0x10,%esp
+}
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+
+008015c4 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8015c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c9:	c3                   	ret
+
+008015ca <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015ca:	55                   	push   %ebp
+  8015cb:	89 e5                	mov    %esp,%ebp
+  8015cd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015d0:	68 f3 27 80 00       	push   $0x8027f3
+  8015d5:	ff 75 0c             	push   0xc(%ebp)
+  8015d8:	e8 24 08 00 00       	call   801e01 <strcpy>
+	return 0;
+}
+  8015dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e2:	c9                   	leave
+  8015e3:	c3                   	ret
+
+008015e4 <devcons_write>:
+{
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	57                   	push   %edi
+  8015e8:	56                   	push   %esi
+  8015e9:	53                   	push   %ebx
+  8015ea:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015f0:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015f5:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015fb:	eb 2e                	jmp    80162b <devcons_write+0x47>
+		m = n - tot;
+  8015fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801600:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801602:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801607:	39 c3                	cmp    %eax,%ebx
+  801609:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80160c:	83 ec 04             	sub    $0x4,%esp
+  80160f:	53                   	push   %ebx
+  801610:	89 f0                	mov    %esi,%eax
+  801612:	03 45 0c             	add    0xc(%ebp),%eax
+  801615:	50                   	push   %eax
+  801616:	57                   	push   %edi
+  801617:	e8 6b 09 00 00       	call   801f87 <memmove>
+		sys_cputs(buf, m);
+  80161c:	83 c4 08             	add    $0x8,%esp
+  80161f:	53                   	push   %ebx
+  801620:	57                   	push   %edi
+  801621:	e8 9f ea ff ff       	call   8000c5 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801626:	01 de                	add    %ebx,%esi
+  801628:	83 c4 10             	add    $0x10,%esp
+  80162b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80162e:	72 cd                	jb     8015fd <devcons_write+0x19>
+}
+  801630:	89 f0                	mov    %esi,%eax
+  801632:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801635:	5b                   	pop    %ebx
+  801636:	5e                   	pop    %esi
+  801637:	5f                   	pop    %edi
+  801638:	5d                   	pop    %ebp
+  801639:	c3                   	ret
+
+0080163a <devcons_read>:
+{
+  80163a:	55                   	push   %ebp
+  80163b:	89 e5                	mov    %esp,%ebp
+  80163d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801640:	b8 00 00 00 00       	mov    $0x0,%eax
+  801645:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801649:	75 07                	jne    801652 <devcons_read+0x18>
+  80164b:	eb 1f                	jmp    80166c <devcons_read+0x32>
+		sys_yield();
+  80164d:	e8 30 eb ff ff       	call   800182 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801652:	e8 8c ea ff ff       	call   8000e3 <sys_cgetc>
+  801657:	85 c0                	test   %eax,%eax
+  801659:	74 f2                	je     80164d <devcons_read+0x13>
+	if (c < 0)
+  80165b:	78 0f                	js     80166c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80165d:	83 f8 04             	cmp    $0x4,%eax
+  801660:	74 0c                	je     80166e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801662:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801665:	88 02                	mov    %al,(%edx)
+	return 1;
+  801667:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80166c:	c9                   	leave
+  80166d:	c3                   	ret
+		return 0;
+  80166e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801673:	eb f7                	jmp    80166c <devcons_read+0x32>
+
+00801675 <cputchar>:
+{
+  801675:	55                   	push   %ebp
+  801676:	89 e5                	mov    %esp,%ebp
+  801678:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80167b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80167e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801681:	6a 01                	push   $0x1
+  801683:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801686:	50                   	push   %eax
+  801687:	e8 39 ea ff ff       	call   8000c5 <sys_cputs>
+}
+  80168c:	83 c4 10             	add    $0x10,%esp
+  80168f:	c9                   	leave
+  801690:	c3                   	ret
+
+00801691 <getchar>:
+{
+  801691:	55                   	push   %ebp
+  801692:	89 e5                	mov    %esp,%ebp
+  801694:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801697:	6a 01                	push   $0x1
+  801699:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80169c:	50                   	push   %eax
+  80169d:	6a 00                	push   $0x0
+  80169f:	e8 66 f2 ff ff       	call   80090a <read>
+	if (r < 0)
+  8016a4:	83 c4 10             	add    $0x10,%esp
+  8016a7:	85 c0                	test   %eax,%eax
+  8016a9:	78 06                	js     8016b1 <getchar+0x20>
+	if (r < 1)
+  8016ab:	74 06                	je     8016b3 <getchar+0x22>
+	return c;
+  8016ad:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8016b1:	c9                   	leave
+  8016b2:	c3                   	ret
+		return -E_EOF;
+  8016b3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8016b8:	eb f7                	jmp    8016b1 <getchar+0x20>
+
+008016ba <iscons>:
+{
+  8016ba:	55                   	push   %ebp
+  8016bb:	89 e5                	mov    %esp,%ebp
+  8016bd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c3:	50                   	push   %eax
+  8016c4:	ff 75 08             	push   0x8(%ebp)
+  8016c7:	e8 d8 ef ff ff       	call   8006a4 <fd_lookup>
+  8016cc:	83 c4 10             	add    $0x10,%esp
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	78 11                	js     8016e4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016d6:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8016dc:	39 10                	cmp    %edx,(%eax)
+  8016de:	0f 94 c0             	sete   %al
+  8016e1:	0f b6 c0             	movzbl %al,%eax
+}
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+
+008016e6 <opencons>:
+{
+  8016e6:	55                   	push   %ebp
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ef:	50                   	push   %eax
+  8016f0:	e8 59 ef ff ff       	call   80064e <fd_alloc>
+  8016f5:	83 c4 10             	add    $0x10,%esp
+  8016f8:	85 c0                	test   %eax,%eax
+  8016fa:	78 3a                	js     801736 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016fc:	83 ec 04             	sub    $0x4,%esp
+  8016ff:	68 07 04 00 00       	push   $0x407
+  801704:	ff 75 f4             	push   -0xc(%ebp)
+  801707:	6a 00                	push   $0x0
+  801709:	e8 f4 ea ff ff       	call   800202 <sys_page_alloc>
+  80170e:	83 c4 10             	add    $0x10,%esp
+  801711:	85 c0                	test   %eax,%eax
+  801713:	78 21                	js     801736 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801715:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801718:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80171e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801720:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801723:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80172a:	83 ec 0c             	sub    $0xc,%esp
+  80172d:	50                   	push   %eax
+  80172e:	e8 f4 ee ff ff       	call   800627 <fd2num>
+  801733:	83 c4 10             	add    $0x10,%esp
+}
+  801736:	c9                   	leave
+  801737:	c3                   	ret
+
+00801738 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801738:	55                   	push   %ebp
+  801739:	89 e5                	mov    %esp,%ebp
+  80173b:	56                   	push   %esi
+  80173c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80173d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801740:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801746:	e8 18 ea ff ff       	call   800163 <sys_getenvid>
+  80174b:	83 ec 0c             	sub    $0xc,%esp
+  80174e:	ff 75 0c             	push   0xc(%ebp)
+  801751:	ff 75 08             	push   0x8(%ebp)
+  801754:	56                   	push   %esi
+  801755:	50                   	push   %eax
+  801756:	68 00 28 80 00       	push   $0x802800
+  80175b:	e8 b3 00 00 00       	call   801813 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801760:	83 c4 18             	add    $0x18,%esp
+  801763:	53                   	push   %ebx
+  801764:	ff 75 10             	push   0x10(%ebp)
+  801767:	e8 56 00 00 00       	call   8017c2 <vcprintf>
+	cprintf("\n");
+  80176c:	c7 04 24 ec 27 80 00 	movl   $0x8027ec,(%esp)
+  801773:	e8 9b 00 00 00       	call   801813 <cprintf>
+  801778:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80177b:	cc                   	int3
+	while (1)
+  80177c:	eb fd                	jmp    80177b <_panic+0x43>
+
+0080177e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80177e:	55                   	push   %ebp
+  80177f:	89 e5                	mov    %esp,%ebp
+  801781:	53                   	push   %ebx
+  801782:	83 ec 04             	sub    $0x4,%esp
+  801785:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801788:	8b 13                	mov    (%ebx),%edx
+  80178a:	8d 42 01             	lea    0x1(%edx),%eax
+  80178d:	89 03                	mov    %eax,(%ebx)
+  80178f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801792:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801796:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80179b:	74 09                	je     8017a6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80179d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8017a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017a4:	c9                   	leave
+  8017a5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8017a6:	83 ec 08             	sub    $0x8,%esp
+  8017a9:	68 ff 00 00 00       	push   $0xff
+  8017ae:	8d 43 08             	lea    0x8(%ebx),%eax
+  8017b1:	50                   	push   %eax
+  8017b2:	e8 0e e9 ff ff       	call   8000c5 <sys_cputs>
+		b->idx = 0;
+  8017b7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8017bd:	83 c4 10             	add    $0x10,%esp
+  8017c0:	eb db                	jmp    80179d <putch+0x1f>
+
+008017c2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8017c2:	55                   	push   %ebp
+  8017c3:	89 e5                	mov    %esp,%ebp
+  8017c5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017cb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017d2:	00 00 00 
+	b.cnt = 0;
+  8017d5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017dc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017df:	ff 75 0c             	push   0xc(%ebp)
+  8017e2:	ff 75 08             	push   0x8(%ebp)
+  8017e5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017eb:	50                   	push   %eax
+  8017ec:	68 7e 17 80 00       	push   $0x80177e
+  8017f1:	e8 14 01 00 00       	call   80190a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017f6:	83 c4 08             	add    $0x8,%esp
+  8017f9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017ff:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801805:	50                   	push   %eax
+  801806:	e8 ba e8 ff ff       	call   8000c5 <sys_cputs>
+
+	return b.cnt;
+}
+  80180b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801811:	c9                   	leave
+  801812:	c3                   	ret
+
+00801813 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801813:	55                   	push   %ebp
+  801814:	89 e5                	mov    %esp,%ebp
+  801816:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801819:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80181c:	50                   	push   %eax
+  80181d:	ff 75 08             	push   0x8(%ebp)
+  801820:	e8 9d ff ff ff       	call   8017c2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801825:	c9                   	leave
+  801826:	c3                   	ret
+
+00801827 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801827:	55                   	push   %ebp
+  801828:	89 e5                	mov    %esp,%ebp
+  80182a:	57                   	push   %edi
+  80182b:	56                   	push   %esi
+  80182c:	53                   	push   %ebx
+  80182d:	83 ec 1c             	sub    $0x1c,%esp
+  801830:	89 c7                	mov    %eax,%edi
+  801832:	89 d6                	mov    %edx,%esi
+  801834:	8b 45 08             	mov    0x8(%ebp),%eax
+  801837:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80183a:	89 d1                	mov    %edx,%ecx
+  80183c:	89 c2                	mov    %eax,%edx
+  80183e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801841:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801844:	8b 45 10             	mov    0x10(%ebp),%eax
+  801847:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80184a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80184d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801854:	39 c2                	cmp    %eax,%edx
+  801856:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801859:	72 3e                	jb     801899 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80185b:	83 ec 0c             	sub    $0xc,%esp
+  80185e:	ff 75 18             	push   0x18(%ebp)
+  801861:	83 eb 01             	sub    $0x1,%ebx
+  801864:	53                   	push   %ebx
+  801865:	50                   	push   %eax
+  801866:	83 ec 08             	sub    $0x8,%esp
+  801869:	ff 75 e4             	push   -0x1c(%ebp)
+  80186c:	ff 75 e0             	push   -0x20(%ebp)
+  80186f:	ff 75 dc             	push   -0x24(%ebp)
+  801872:	ff 75 d8             	push   -0x28(%ebp)
+  801875:	e8 a6 0a 00 00       	call   802320 <__udivdi3>
+  80187a:	83 c4 18             	add    $0x18,%esp
+  80187d:	52                   	push   %edx
+  80187e:	50                   	push   %eax
+  80187f:	89 f2                	mov    %esi,%edx
+  801881:	89 f8                	mov    %edi,%eax
+  801883:	e8 9f ff ff ff       	call   801827 <printnum>
+  801888:	83 c4 20             	add    $0x20,%esp
+  80188b:	eb 13                	jmp    8018a0 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80188d:	83 ec 08             	sub    $0x8,%esp
+  801890:	56                   	push   %esi
+  801891:	ff 75 18             	push   0x18(%ebp)
+  801894:	ff d7                	call   *%edi
+  801896:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801899:	83 eb 01             	sub    $0x1,%ebx
+  80189c:	85 db                	test   %ebx,%ebx
+  80189e:	7f ed                	jg     80188d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8018a0:	83 ec 08             	sub    $0x8,%esp
+  8018a3:	56                   	push   %esi
+  8018a4:	83 ec 04             	sub    $0x4,%esp
+  8018a7:	ff 75 e4             	push   -0x1c(%ebp)
+  8018aa:	ff 75 e0             	push   -0x20(%ebp)
+  8018ad:	ff 75 dc             	push   -0x24(%ebp)
+  8018b0:	ff 75 d8             	push   -0x28(%ebp)
+  8018b3:	e8 28 0b 00 00       	call   8023e0 <__umoddi3>
+  8018b8:	83 c4 14             	add    $0x14,%esp
+  8018bb:	0f be 80 23 28 80 00 	movsbl 0x802823(%eax),%eax
+  8018c2:	50                   	push   %eax
+  8018c3:	ff d7                	call   *%edi
+}
+  8018c5:	83 c4 10             	add    $0x10,%esp
+  8018c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018cb:	5b                   	pop    %ebx
+  8018cc:	5e                   	pop    %esi
+  8018cd:	5f                   	pop    %edi
+  8018ce:	5d                   	pop    %ebp
+  8018cf:	c3                   	ret
+
+008018d0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018d0:	55                   	push   %ebp
+  8018d1:	89 e5                	mov    %esp,%ebp
+  8018d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018d6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018da:	8b 10                	mov    (%eax),%edx
+  8018dc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018df:	73 0a                	jae    8018eb <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018e1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018e4:	89 08                	mov    %ecx,(%eax)
+  8018e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e9:	88 02                	mov    %al,(%edx)
+}
+  8018eb:	5d                   	pop    %ebp
+  8018ec:	c3                   	ret
+
+008018ed <printfmt>:
+{
+  8018ed:	55                   	push   %ebp
+  8018ee:	89 e5                	mov    %esp,%ebp
+  8018f0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018f3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018f6:	50                   	push   %eax
+  8018f7:	ff 75 10             	push   0x10(%ebp)
+  8018fa:	ff 75 0c             	push   0xc(%ebp)
+  8018fd:	ff 75 08             	push   0x8(%ebp)
+  801900:	e8 05 00 00 00       	call   80190a <vprintfmt>
+}
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	c9                   	leave
+  801909:	c3                   	ret
+
+0080190a <vprintfmt>:
+{
+  80190a:	55                   	push   %ebp
+  80190b:	89 e5                	mov    %esp,%ebp
+  80190d:	57                   	push   %edi
+  80190e:	56                   	push   %esi
+  80190f:	53                   	push   %ebx
+  801910:	83 ec 2c             	sub    $0x2c,%esp
+  801913:	8b 75 08             	mov    0x8(%ebp),%esi
+  801916:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801919:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80191c:	eb 0a                	jmp    801928 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80191e:	83 ec 08             	sub    $0x8,%esp
+  801921:	53                   	push   %ebx
+  801922:	50                   	push   %eax
+  801923:	ff d6                	call   *%esi
+  801925:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801928:	83 c7 01             	add    $0x1,%edi
+  80192b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80192f:	83 f8 25             	cmp    $0x25,%eax
+  801932:	74 0c                	je     801940 <vprintfmt+0x36>
+			if (ch == '\0')
+  801934:	85 c0                	test   %eax,%eax
+  801936:	75 e6                	jne    80191e <vprintfmt+0x14>
+}
+  801938:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80193b:	5b                   	pop    %ebx
+  80193c:	5e                   	pop    %esi
+  80193d:	5f                   	pop    %edi
+  80193e:	5d                   	pop    %ebp
+  80193f:	c3                   	ret
+		padc = ' ';
+  801940:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801944:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80194b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801952:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801959:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80195e:	8d 47 01             	lea    0x1(%edi),%eax
+  801961:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801964:	0f b6 17             	movzbl (%edi),%edx
+  801967:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80196a:	3c 55                	cmp    $0x55,%al
+  80196c:	0f 87 cf 03 00 00    	ja     801d41 <vprintfmt+0x437>
+  801972:	0f b6 c0             	movzbl %al,%eax
+  801975:	ff 24 85 60 29 80 00 	jmp    *0x802960(,%eax,4)
+  80197c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80197f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801983:	eb d9                	jmp    80195e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801985:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801988:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80198c:	eb d0                	jmp    80195e <vprintfmt+0x54>
+  80198e:	0f b6 d2             	movzbl %dl,%edx
+  801991:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801994:	b8 00 00 00 00       	mov    $0x0,%eax
+  801999:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80199c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80199f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8019a3:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8019a6:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8019a9:	83 f9 09             	cmp    $0x9,%ecx
+  8019ac:	77 55                	ja     801a03 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8019ae:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8019b1:	eb e9                	jmp    80199c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8019b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019b6:	8b 00                	mov    (%eax),%eax
+  8019b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019be:	8d 40 04             	lea    0x4(%eax),%eax
+  8019c1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8019c7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019cb:	79 91                	jns    80195e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019cd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019d3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019da:	eb 82                	jmp    80195e <vprintfmt+0x54>
+			if (width < 0)
+  8019dc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019df:	85 d2                	test   %edx,%edx
+  8019e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e6:	0f 49 c2             	cmovns %edx,%eax
+  8019e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019ef:	e9 6a ff ff ff       	jmp    80195e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019f7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019fe:	e9 5b ff ff ff       	jmp    80195e <vprintfmt+0x54>
+  801a03:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801a06:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801a09:	eb bc                	jmp    8019c7 <vprintfmt+0xbd>
+			lflag++;
+  801a0b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801a0e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801a11:	e9 48 ff ff ff       	jmp    80195e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801a16:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a19:	8d 78 04             	lea    0x4(%eax),%edi
+  801a1c:	83 ec 08             	sub    $0x8,%esp
+  801a1f:	53                   	push   %ebx
+  801a20:	ff 30                	push   (%eax)
+  801a22:	ff d6                	call   *%esi
+			break;
+  801a24:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801a27:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801a2a:	e9 b1 02 00 00       	jmp    801ce0 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801a2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a32:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a35:	8b 10                	mov    (%eax),%edx
+  801a37:	89 d0                	mov    %edx,%eax
+  801a39:	f7 d8                	neg    %eax
+  801a3b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a3e:	83 f8 0f             	cmp    $0xf,%eax
+  801a41:	7f 23                	jg     801a66 <vprintfmt+0x15c>
+  801a43:	8b 14 85 c0 2a 80 00 	mov    0x802ac0(,%eax,4),%edx
+  801a4a:	85 d2                	test   %edx,%edx
+  801a4c:	74 18                	je     801a66 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a4e:	52                   	push   %edx
+  801a4f:	68 81 27 80 00       	push   $0x802781
+  801a54:	53                   	push   %ebx
+  801a55:	56                   	push   %esi
+  801a56:	e8 92 fe ff ff       	call   8018ed <printfmt>
+  801a5b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a5e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a61:	e9 7a 02 00 00       	jmp    801ce0 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801a66:	50                   	push   %eax
+  801a67:	68 3b 28 80 00       	push   $0x80283b
+  801a6c:	53                   	push   %ebx
+  801a6d:	56                   	push   %esi
+  801a6e:	e8 7a fe ff ff       	call   8018ed <printfmt>
+  801a73:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a76:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a79:	e9 62 02 00 00       	jmp    801ce0 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a81:	83 c0 04             	add    $0x4,%eax
+  801a84:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a87:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a8a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a8c:	85 c9                	test   %ecx,%ecx
+  801a8e:	b8 34 28 80 00       	mov    $0x802834,%eax
+  801a93:	0f 45 c1             	cmovne %ecx,%eax
+  801a96:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a99:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a9d:	7e 06                	jle    801aa5 <vprintfmt+0x19b>
+  801a9f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801aa3:	75 0b                	jne    801ab0 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aa5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801aa8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801aab:	89 75 08             	mov    %esi,0x8(%ebp)
+  801aae:	eb 5c                	jmp    801b0c <vprintfmt+0x202>
+  801ab0:	83 ec 08             	sub    $0x8,%esp
+  801ab3:	ff 75 d0             	push   -0x30(%ebp)
+  801ab6:	ff 75 cc             	push   -0x34(%ebp)
+  801ab9:	e8 20 03 00 00       	call   801dde <strnlen>
+  801abe:	89 c2                	mov    %eax,%edx
+  801ac0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ac3:	29 d0                	sub    %edx,%eax
+  801ac5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801ac8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801acc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801acf:	89 75 08             	mov    %esi,0x8(%ebp)
+  801ad2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ad4:	eb 0e                	jmp    801ae4 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801ad6:	83 ec 08             	sub    $0x8,%esp
+  801ad9:	53                   	push   %ebx
+  801ada:	57                   	push   %edi
+  801adb:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ade:	83 ee 01             	sub    $0x1,%esi
+  801ae1:	83 c4 10             	add    $0x10,%esp
+  801ae4:	85 f6                	test   %esi,%esi
+  801ae6:	7f ee                	jg     801ad6 <vprintfmt+0x1cc>
+  801ae8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aeb:	8b 75 08             	mov    0x8(%ebp),%esi
+  801aee:	85 c0                	test   %eax,%eax
+  801af0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af5:	0f 49 d0             	cmovns %eax,%edx
+  801af8:	29 d0                	sub    %edx,%eax
+  801afa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801afd:	eb a6                	jmp    801aa5 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801aff:	83 ec 08             	sub    $0x8,%esp
+  801b02:	53                   	push   %ebx
+  801b03:	52                   	push   %edx
+  801b04:	ff 55 08             	call   *0x8(%ebp)
+  801b07:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801b0a:	89 f1                	mov    %esi,%ecx
+  801b0c:	8d 71 01             	lea    0x1(%ecx),%esi
+  801b0f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801b13:	0f be d0             	movsbl %al,%edx
+  801b16:	85 d2                	test   %edx,%edx
+  801b18:	74 28                	je     801b42 <vprintfmt+0x238>
+  801b1a:	85 ff                	test   %edi,%edi
+  801b1c:	78 05                	js     801b23 <vprintfmt+0x219>
+  801b1e:	83 ef 01             	sub    $0x1,%edi
+  801b21:	78 30                	js     801b53 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801b23:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801b27:	74 d6                	je     801aff <vprintfmt+0x1f5>
+  801b29:	0f be c0             	movsbl %al,%eax
+  801b2c:	83 e8 20             	sub    $0x20,%eax
+  801b2f:	83 f8 5e             	cmp    $0x5e,%eax
+  801b32:	76 cb                	jbe    801aff <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b34:	83 ec 08             	sub    $0x8,%esp
+  801b37:	53                   	push   %ebx
+  801b38:	6a 3f                	push   $0x3f
+  801b3a:	ff 55 08             	call   *0x8(%ebp)
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  801b40:	eb c8                	jmp    801b0a <vprintfmt+0x200>
+  801b42:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b45:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b48:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b4b:	01 d0                	add    %edx,%eax
+  801b4d:	29 c8                	sub    %ecx,%eax
+  801b4f:	89 c7                	mov    %eax,%edi
+  801b51:	eb 13                	jmp    801b66 <vprintfmt+0x25c>
+  801b53:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b56:	eb ed                	jmp    801b45 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b58:	83 ec 08             	sub    $0x8,%esp
+  801b5b:	53                   	push   %ebx
+  801b5c:	6a 20                	push   $0x20
+  801b5e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b60:	83 ef 01             	sub    $0x1,%edi
+  801b63:	83 c4 10             	add    $0x10,%esp
+  801b66:	85 ff                	test   %edi,%edi
+  801b68:	7f ee                	jg     801b58 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b6a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b6d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b70:	e9 6b 01 00 00       	jmp    801ce0 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801b75:	83 f9 01             	cmp    $0x1,%ecx
+  801b78:	7f 1f                	jg     801b99 <vprintfmt+0x28f>
+	else if (lflag)
+  801b7a:	85 c9                	test   %ecx,%ecx
+  801b7c:	74 67                	je     801be5 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801b7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b81:	8b 00                	mov    (%eax),%eax
+  801b83:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b86:	89 c1                	mov    %eax,%ecx
+  801b88:	c1 f9 1f             	sar    $0x1f,%ecx
+  801b8b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801b8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b91:	8d 40 04             	lea    0x4(%eax),%eax
+  801b94:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b97:	eb 17                	jmp    801bb0 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801b99:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b9c:	8b 50 04             	mov    0x4(%eax),%edx
+  801b9f:	8b 00                	mov    (%eax),%eax
+  801ba1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801ba4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801ba7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801baa:	8d 40 08             	lea    0x8(%eax),%eax
+  801bad:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801bb0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801bb3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801bb6:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801bbb:	85 c9                	test   %ecx,%ecx
+  801bbd:	0f 89 03 01 00 00    	jns    801cc6 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  801bc3:	83 ec 08             	sub    $0x8,%esp
+  801bc6:	53                   	push   %ebx
+  801bc7:	6a 2d                	push   $0x2d
+  801bc9:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801bcb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801bce:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801bd1:	f7 da                	neg    %edx
+  801bd3:	83 d1 00             	adc    $0x0,%ecx
+  801bd6:	f7 d9                	neg    %ecx
+  801bd8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bdb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801be0:	e9 e1 00 00 00       	jmp    801cc6 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  801be5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801be8:	8b 00                	mov    (%eax),%eax
+  801bea:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bed:	89 c1                	mov    %eax,%ecx
+  801bef:	c1 f9 1f             	sar    $0x1f,%ecx
+  801bf2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801bf5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bf8:	8d 40 04             	lea    0x4(%eax),%eax
+  801bfb:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bfe:	eb b0                	jmp    801bb0 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801c00:	83 f9 01             	cmp    $0x1,%ecx
+  801c03:	7f 1e                	jg     801c23 <vprintfmt+0x319>
+	else if (lflag)
+  801c05:	85 c9                	test   %ecx,%ecx
+  801c07:	74 32                	je     801c3b <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  801c09:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c0c:	8b 10                	mov    (%eax),%edx
+  801c0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c13:	8d 40 04             	lea    0x4(%eax),%eax
+  801c16:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c19:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801c1e:	e9 a3 00 00 00       	jmp    801cc6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c23:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c26:	8b 10                	mov    (%eax),%edx
+  801c28:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c2b:	8d 40 08             	lea    0x8(%eax),%eax
+  801c2e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c31:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c36:	e9 8b 00 00 00       	jmp    801cc6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c3e:	8b 10                	mov    (%eax),%edx
+  801c40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c45:	8d 40 04             	lea    0x4(%eax),%eax
+  801c48:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c4b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c50:	eb 74                	jmp    801cc6 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  801c52:	83 f9 01             	cmp    $0x1,%ecx
+  801c55:	7f 1b                	jg     801c72 <vprintfmt+0x368>
+	else if (lflag)
+  801c57:	85 c9                	test   %ecx,%ecx
+  801c59:	74 2c                	je     801c87 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  801c5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c5e:	8b 10                	mov    (%eax),%edx
+  801c60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c65:	8d 40 04             	lea    0x4(%eax),%eax
+  801c68:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c6b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  801c70:	eb 54                	jmp    801cc6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c72:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c75:	8b 10                	mov    (%eax),%edx
+  801c77:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c7a:	8d 40 08             	lea    0x8(%eax),%eax
+  801c7d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c80:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  801c85:	eb 3f                	jmp    801cc6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c87:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c8a:	8b 10                	mov    (%eax),%edx
+  801c8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c91:	8d 40 04             	lea    0x4(%eax),%eax
+  801c94:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c97:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  801c9c:	eb 28                	jmp    801cc6 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  801c9e:	83 ec 08             	sub    $0x8,%esp
+  801ca1:	53                   	push   %ebx
+  801ca2:	6a 30                	push   $0x30
+  801ca4:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801ca6:	83 c4 08             	add    $0x8,%esp
+  801ca9:	53                   	push   %ebx
+  801caa:	6a 78                	push   $0x78
+  801cac:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801cae:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cb1:	8b 10                	mov    (%eax),%edx
+  801cb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801cb8:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801cbb:	8d 40 04             	lea    0x4(%eax),%eax
+  801cbe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cc1:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801cc6:	83 ec 0c             	sub    $0xc,%esp
+  801cc9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801ccd:	50                   	push   %eax
+  801cce:	ff 75 e0             	push   -0x20(%ebp)
+  801cd1:	57                   	push   %edi
+  801cd2:	51                   	push   %ecx
+  801cd3:	52                   	push   %edx
+  801cd4:	89 da                	mov    %ebx,%edx
+  801cd6:	89 f0                	mov    %esi,%eax
+  801cd8:	e8 4a fb ff ff       	call   801827 <printnum>
+			break;
+  801cdd:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801ce0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ce3:	e9 40 fc ff ff       	jmp    801928 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801ce8:	83 f9 01             	cmp    $0x1,%ecx
+  801ceb:	7f 1b                	jg     801d08 <vprintfmt+0x3fe>
+	else if (lflag)
+  801ced:	85 c9                	test   %ecx,%ecx
+  801cef:	74 2c                	je     801d1d <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  801cf1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf4:	8b 10                	mov    (%eax),%edx
+  801cf6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cfb:	8d 40 04             	lea    0x4(%eax),%eax
+  801cfe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d01:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801d06:	eb be                	jmp    801cc6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801d08:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d0b:	8b 10                	mov    (%eax),%edx
+  801d0d:	8b 48 04             	mov    0x4(%eax),%ecx
+  801d10:	8d 40 08             	lea    0x8(%eax),%eax
+  801d13:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d16:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801d1b:	eb a9                	jmp    801cc6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801d1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d20:	8b 10                	mov    (%eax),%edx
+  801d22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d27:	8d 40 04             	lea    0x4(%eax),%eax
+  801d2a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d2d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d32:	eb 92                	jmp    801cc6 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  801d34:	83 ec 08             	sub    $0x8,%esp
+  801d37:	53                   	push   %ebx
+  801d38:	6a 25                	push   $0x25
+  801d3a:	ff d6                	call   *%esi
+			break;
+  801d3c:	83 c4 10             	add    $0x10,%esp
+  801d3f:	eb 9f                	jmp    801ce0 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  801d41:	83 ec 08             	sub    $0x8,%esp
+  801d44:	53                   	push   %ebx
+  801d45:	6a 25                	push   $0x25
+  801d47:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d49:	83 c4 10             	add    $0x10,%esp
+  801d4c:	89 f8                	mov    %edi,%eax
+  801d4e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d52:	74 05                	je     801d59 <vprintfmt+0x44f>
+  801d54:	83 e8 01             	sub    $0x1,%eax
+  801d57:	eb f5                	jmp    801d4e <vprintfmt+0x444>
+  801d59:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d5c:	eb 82                	jmp    801ce0 <vprintfmt+0x3d6>
+
+00801d5e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d5e:	55                   	push   %ebp
+  801d5f:	89 e5                	mov    %esp,%ebp
+  801d61:	83 ec 18             	sub    $0x18,%esp
+  801d64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d67:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d6a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d6d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d71:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d74:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d7b:	85 c0                	test   %eax,%eax
+  801d7d:	74 26                	je     801da5 <vsnprintf+0x47>
+  801d7f:	85 d2                	test   %edx,%edx
+  801d81:	7e 22                	jle    801da5 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d83:	ff 75 14             	push   0x14(%ebp)
+  801d86:	ff 75 10             	push   0x10(%ebp)
+  801d89:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d8c:	50                   	push   %eax
+  801d8d:	68 d0 18 80 00       	push   $0x8018d0
+  801d92:	e8 73 fb ff ff       	call   80190a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d97:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d9a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801da0:	83 c4 10             	add    $0x10,%esp
+}
+  801da3:	c9                   	leave
+  801da4:	c3                   	ret
+		return -E_INVAL;
+  801da5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801daa:	eb f7                	jmp    801da3 <vsnprintf+0x45>
+
+00801dac <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801dac:	55                   	push   %ebp
+  801dad:	89 e5                	mov    %esp,%ebp
+  801daf:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801db2:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801db5:	50                   	push   %eax
+  801db6:	ff 75 10             	push   0x10(%ebp)
+  801db9:	ff 75 0c             	push   0xc(%ebp)
+  801dbc:	ff 75 08             	push   0x8(%ebp)
+  801dbf:	e8 9a ff ff ff       	call   801d5e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801dc4:	c9                   	leave
+  801dc5:	c3                   	ret
+
+00801dc6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801dc6:	55                   	push   %ebp
+  801dc7:	89 e5                	mov    %esp,%ebp
+  801dc9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd1:	eb 03                	jmp    801dd6 <strlen+0x10>
+		n++;
+  801dd3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801dd6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801dda:	75 f7                	jne    801dd3 <strlen+0xd>
+	return n;
+}
+  801ddc:	5d                   	pop    %ebp
+  801ddd:	c3                   	ret
+
+00801dde <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801dde:	55                   	push   %ebp
+  801ddf:	89 e5                	mov    %esp,%ebp
+  801de1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801de4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dec:	eb 03                	jmp    801df1 <strnlen+0x13>
+		n++;
+  801dee:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801df1:	39 d0                	cmp    %edx,%eax
+  801df3:	74 08                	je     801dfd <strnlen+0x1f>
+  801df5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801df9:	75 f3                	jne    801dee <strnlen+0x10>
+  801dfb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801dfd:	89 d0                	mov    %edx,%eax
+  801dff:	5d                   	pop    %ebp
+  801e00:	c3                   	ret
+
+00801e01 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801e01:	55                   	push   %ebp
+  801e02:	89 e5                	mov    %esp,%ebp
+  801e04:	53                   	push   %ebx
+  801e05:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e08:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e10:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801e14:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801e17:	83 c0 01             	add    $0x1,%eax
+  801e1a:	84 d2                	test   %dl,%dl
+  801e1c:	75 f2                	jne    801e10 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801e1e:	89 c8                	mov    %ecx,%eax
+  801e20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e23:	c9                   	leave
+  801e24:	c3                   	ret
+
+00801e25 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801e25:	55                   	push   %ebp
+  801e26:	89 e5                	mov    %esp,%ebp
+  801e28:	53                   	push   %ebx
+  801e29:	83 ec 10             	sub    $0x10,%esp
+  801e2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e2f:	53                   	push   %ebx
+  801e30:	e8 91 ff ff ff       	call   801dc6 <strlen>
+  801e35:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e38:	ff 75 0c             	push   0xc(%ebp)
+  801e3b:	01 d8                	add    %ebx,%eax
+  801e3d:	50                   	push   %eax
+  801e3e:	e8 be ff ff ff       	call   801e01 <strcpy>
+	return dst;
+}
+  801e43:	89 d8                	mov    %ebx,%eax
+  801e45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e48:	c9                   	leave
+  801e49:	c3                   	ret
+
+00801e4a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e4a:	55                   	push   %ebp
+  801e4b:	89 e5                	mov    %esp,%ebp
+  801e4d:	56                   	push   %esi
+  801e4e:	53                   	push   %ebx
+  801e4f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e52:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e55:	89 f3                	mov    %esi,%ebx
+  801e57:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e5a:	89 f0                	mov    %esi,%eax
+  801e5c:	eb 0f                	jmp    801e6d <strncpy+0x23>
+		*dst++ = *src;
+  801e5e:	83 c0 01             	add    $0x1,%eax
+  801e61:	0f b6 0a             	movzbl (%edx),%ecx
+  801e64:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e67:	80 f9 01             	cmp    $0x1,%cl
+  801e6a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e6d:	39 d8                	cmp    %ebx,%eax
+  801e6f:	75 ed                	jne    801e5e <strncpy+0x14>
+	}
+	return ret;
+}
+  801e71:	89 f0                	mov    %esi,%eax
+  801e73:	5b                   	pop    %ebx
+  801e74:	5e                   	pop    %esi
+  801e75:	5d                   	pop    %ebp
+  801e76:	c3                   	ret
+
+00801e77 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e77:	55                   	push   %ebp
+  801e78:	89 e5                	mov    %esp,%ebp
+  801e7a:	56                   	push   %esi
+  801e7b:	53                   	push   %ebx
+  801e7c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e82:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e85:	89 f0                	mov    %esi,%eax
+  801e87:	85 d2                	test   %edx,%edx
+  801e89:	74 21                	je     801eac <strlcpy+0x35>
+  801e8b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e8f:	89 f2                	mov    %esi,%edx
+  801e91:	eb 09                	jmp    801e9c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e93:	83 c1 01             	add    $0x1,%ecx
+  801e96:	83 c2 01             	add    $0x1,%edx
+  801e99:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e9c:	39 c2                	cmp    %eax,%edx
+  801e9e:	74 09                	je     801ea9 <strlcpy+0x32>
+  801ea0:	0f b6 19             	movzbl (%ecx),%ebx
+  801ea3:	84 db                	test   %bl,%bl
+  801ea5:	75 ec                	jne    801e93 <strlcpy+0x1c>
+  801ea7:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801ea9:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801eac:	29 f0                	sub    %esi,%eax
+}
+  801eae:	5b                   	pop    %ebx
+  801eaf:	5e                   	pop    %esi
+  801eb0:	5d                   	pop    %ebp
+  801eb1:	c3                   	ret
+
+00801eb2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801eb2:	55                   	push   %ebp
+  801eb3:	89 e5                	mov    %esp,%ebp
+  801eb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801eb8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801ebb:	eb 06                	jmp    801ec3 <strcmp+0x11>
+		p++, q++;
+  801ebd:	83 c1 01             	add    $0x1,%ecx
+  801ec0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801ec3:	0f b6 01             	movzbl (%ecx),%eax
+  801ec6:	84 c0                	test   %al,%al
+  801ec8:	74 04                	je     801ece <strcmp+0x1c>
+  801eca:	3a 02                	cmp    (%edx),%al
+  801ecc:	74 ef                	je     801ebd <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ece:	0f b6 c0             	movzbl %al,%eax
+  801ed1:	0f b6 12             	movzbl (%edx),%edx
+  801ed4:	29 d0                	sub    %edx,%eax
+}
+  801ed6:	5d                   	pop    %ebp
+  801ed7:	c3                   	ret
+
+00801ed8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ed8:	55                   	push   %ebp
+  801ed9:	89 e5                	mov    %esp,%ebp
+  801edb:	53                   	push   %ebx
+  801edc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801edf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ee2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801ee5:	eb 09                	jmp    801ef0 <strncmp+0x18>
+		n--, p++, q++;
+  801ee7:	83 ea 01             	sub    $0x1,%edx
+  801eea:	83 c0 01             	add    $0x1,%eax
+  801eed:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ef0:	85 d2                	test   %edx,%edx
+  801ef2:	74 18                	je     801f0c <strncmp+0x34>
+  801ef4:	0f b6 18             	movzbl (%eax),%ebx
+  801ef7:	84 db                	test   %bl,%bl
+  801ef9:	74 04                	je     801eff <strncmp+0x27>
+  801efb:	3a 19                	cmp    (%ecx),%bl
+  801efd:	74 e8                	je     801ee7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801eff:	0f b6 00             	movzbl (%eax),%eax
+  801f02:	0f b6 11             	movzbl (%ecx),%edx
+  801f05:	29 d0                	sub    %edx,%eax
+}
+  801f07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f0a:	c9                   	leave
+  801f0b:	c3                   	ret
+		return 0;
+  801f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f11:	eb f4                	jmp    801f07 <strncmp+0x2f>
+
+00801f13 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801f13:	55                   	push   %ebp
+  801f14:	89 e5                	mov    %esp,%ebp
+  801f16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f19:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f1d:	eb 03                	jmp    801f22 <strchr+0xf>
+  801f1f:	83 c0 01             	add    $0x1,%eax
+  801f22:	0f b6 10             	movzbl (%eax),%edx
+  801f25:	84 d2                	test   %dl,%dl
+  801f27:	74 06                	je     801f2f <strchr+0x1c>
+		if (*s == c)
+  801f29:	38 ca                	cmp    %cl,%dl
+  801f2b:	75 f2                	jne    801f1f <strchr+0xc>
+  801f2d:	eb 05                	jmp    801f34 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f34:	5d                   	pop    %ebp
+  801f35:	c3                   	ret
+
+00801f36 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f36:	55                   	push   %ebp
+  801f37:	89 e5                	mov    %esp,%ebp
+  801f39:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f40:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f43:	38 ca                	cmp    %cl,%dl
+  801f45:	74 09                	je     801f50 <strfind+0x1a>
+  801f47:	84 d2                	test   %dl,%dl
+  801f49:	74 05                	je     801f50 <strfind+0x1a>
+	for (; *s; s++)
+  801f4b:	83 c0 01             	add    $0x1,%eax
+  801f4e:	eb f0                	jmp    801f40 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f50:	5d                   	pop    %ebp
+  801f51:	c3                   	ret
+
+00801f52 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f52:	55                   	push   %ebp
+  801f53:	89 e5                	mov    %esp,%ebp
+  801f55:	57                   	push   %edi
+  801f56:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f59:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f5c:	85 c9                	test   %ecx,%ecx
+  801f5e:	74 20                	je     801f80 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f60:	89 f8                	mov    %edi,%eax
+  801f62:	09 c8                	or     %ecx,%eax
+  801f64:	a8 03                	test   $0x3,%al
+  801f66:	75 12                	jne    801f7a <memset+0x28>
+		c &= 0xFF;
+  801f68:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f6c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f72:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f75:	fc                   	cld
+  801f76:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f78:	eb 06                	jmp    801f80 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f7d:	fc                   	cld
+  801f7e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f80:	89 f8                	mov    %edi,%eax
+  801f82:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f85:	c9                   	leave
+  801f86:	c3                   	ret
+
+00801f87 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f87:	55                   	push   %ebp
+  801f88:	89 e5                	mov    %esp,%ebp
+  801f8a:	57                   	push   %edi
+  801f8b:	56                   	push   %esi
+  801f8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f92:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f95:	39 c6                	cmp    %eax,%esi
+  801f97:	73 32                	jae    801fcb <memmove+0x44>
+  801f99:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f9c:	39 d0                	cmp    %edx,%eax
+  801f9e:	73 2b                	jae    801fcb <memmove+0x44>
+		s += n;
+		d += n;
+  801fa0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fa3:	89 d6                	mov    %edx,%esi
+  801fa5:	09 fe                	or     %edi,%esi
+  801fa7:	09 ce                	or     %ecx,%esi
+  801fa9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801faf:	75 0e                	jne    801fbf <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801fb1:	83 ef 04             	sub    $0x4,%edi
+  801fb4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801fb7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801fba:	fd                   	std
+  801fbb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fbd:	eb 09                	jmp    801fc8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801fbf:	83 ef 01             	sub    $0x1,%edi
+  801fc2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801fc5:	fd                   	std
+  801fc6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801fc8:	fc                   	cld
+  801fc9:	eb 1a                	jmp    801fe5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fcb:	89 f2                	mov    %esi,%edx
+  801fcd:	09 c2                	or     %eax,%edx
+  801fcf:	09 ca                	or     %ecx,%edx
+  801fd1:	f6 c2 03             	test   $0x3,%dl
+  801fd4:	75 0a                	jne    801fe0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fd6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fd9:	89 c7                	mov    %eax,%edi
+  801fdb:	fc                   	cld
+  801fdc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fde:	eb 05                	jmp    801fe5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fe0:	89 c7                	mov    %eax,%edi
+  801fe2:	fc                   	cld
+  801fe3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fe5:	5e                   	pop    %esi
+  801fe6:	5f                   	pop    %edi
+  801fe7:	5d                   	pop    %ebp
+  801fe8:	c3                   	ret
+
+00801fe9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fe9:	55                   	push   %ebp
+  801fea:	89 e5                	mov    %esp,%ebp
+  801fec:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fef:	ff 75 10             	push   0x10(%ebp)
+  801ff2:	ff 75 0c             	push   0xc(%ebp)
+  801ff5:	ff 75 08             	push   0x8(%ebp)
+  801ff8:	e8 8a ff ff ff       	call   801f87 <memmove>
+}
+  801ffd:	c9                   	leave
+  801ffe:	c3                   	ret
+
+00801fff <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fff:	55                   	push   %ebp
+  802000:	89 e5                	mov    %esp,%ebp
+  802002:	56                   	push   %esi
+  802003:	53                   	push   %ebx
+  802004:	8b 45 08             	mov    0x8(%ebp),%eax
+  802007:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80200a:	89 c6                	mov    %eax,%esi
+  80200c:	03 75 10             	add    0x10(%ebp),%esi
+  80200f:	eb 06                	jmp    802017 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802011:	83 c0 01             	add    $0x1,%eax
+  802014:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802017:	39 f0                	cmp    %esi,%eax
+  802019:	74 14                	je     80202f <memcmp+0x30>
+		if (*s1 != *s2)
+  80201b:	0f b6 08             	movzbl (%eax),%ecx
+  80201e:	0f b6 1a             	movzbl (%edx),%ebx
+  802021:	38 d9                	cmp    %bl,%cl
+  802023:	74 ec                	je     802011 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802025:	0f b6 c1             	movzbl %cl,%eax
+  802028:	0f b6 db             	movzbl %bl,%ebx
+  80202b:	29 d8                	sub    %ebx,%eax
+  80202d:	eb 05                	jmp    802034 <memcmp+0x35>
+	}
+
+	return 0;
+  80202f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802034:	5b                   	pop    %ebx
+  802035:	5e                   	pop    %esi
+  802036:	5d                   	pop    %ebp
+  802037:	c3                   	ret
+
+00802038 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802038:	55                   	push   %ebp
+  802039:	89 e5                	mov    %esp,%ebp
+  80203b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802041:	89 c2                	mov    %eax,%edx
+  802043:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802046:	eb 03                	jmp    80204b <memfind+0x13>
+  802048:	83 c0 01             	add    $0x1,%eax
+  80204b:	39 d0                	cmp    %edx,%eax
+  80204d:	73 04                	jae    802053 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80204f:	38 08                	cmp    %cl,(%eax)
+  802051:	75 f5                	jne    802048 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802053:	5d                   	pop    %ebp
+  802054:	c3                   	ret
+
+00802055 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802055:	55                   	push   %ebp
+  802056:	89 e5                	mov    %esp,%ebp
+  802058:	57                   	push   %edi
+  802059:	56                   	push   %esi
+  80205a:	53                   	push   %ebx
+  80205b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80205e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802061:	eb 03                	jmp    802066 <strtol+0x11>
+		s++;
+  802063:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802066:	0f b6 02             	movzbl (%edx),%eax
+  802069:	3c 20                	cmp    $0x20,%al
+  80206b:	74 f6                	je     802063 <strtol+0xe>
+  80206d:	3c 09                	cmp    $0x9,%al
+  80206f:	74 f2                	je     802063 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802071:	3c 2b                	cmp    $0x2b,%al
+  802073:	74 2a                	je     80209f <strtol+0x4a>
+	int neg = 0;
+  802075:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80207a:	3c 2d                	cmp    $0x2d,%al
+  80207c:	74 2b                	je     8020a9 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80207e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802084:	75 0f                	jne    802095 <strtol+0x40>
+  802086:	80 3a 30             	cmpb   $0x30,(%edx)
+  802089:	74 28                	je     8020b3 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80208b:	85 db                	test   %ebx,%ebx
+  80208d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802092:	0f 44 d8             	cmove  %eax,%ebx
+  802095:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80209a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80209d:	eb 46                	jmp    8020e5 <strtol+0x90>
+		s++;
+  80209f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8020a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020a7:	eb d5                	jmp    80207e <strtol+0x29>
+		s++, neg = 1;
+  8020a9:	83 c2 01             	add    $0x1,%edx
+  8020ac:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020b1:	eb cb                	jmp    80207e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8020b3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8020b7:	74 0e                	je     8020c7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8020b9:	85 db                	test   %ebx,%ebx
+  8020bb:	75 d8                	jne    802095 <strtol+0x40>
+		s++, base = 8;
+  8020bd:	83 c2 01             	add    $0x1,%edx
+  8020c0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8020c5:	eb ce                	jmp    802095 <strtol+0x40>
+		s += 2, base = 16;
+  8020c7:	83 c2 02             	add    $0x2,%edx
+  8020ca:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020cf:	eb c4                	jmp    802095 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020d1:	0f be c0             	movsbl %al,%eax
+  8020d4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020d7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020da:	7d 3a                	jge    802116 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020dc:	83 c2 01             	add    $0x1,%edx
+  8020df:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020e3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020e5:	0f b6 02             	movzbl (%edx),%eax
+  8020e8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020eb:	89 f3                	mov    %esi,%ebx
+  8020ed:	80 fb 09             	cmp    $0x9,%bl
+  8020f0:	76 df                	jbe    8020d1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020f2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020f5:	89 f3                	mov    %esi,%ebx
+  8020f7:	80 fb 19             	cmp    $0x19,%bl
+  8020fa:	77 08                	ja     802104 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020fc:	0f be c0             	movsbl %al,%eax
+  8020ff:	83 e8 57             	sub    $0x57,%eax
+  802102:	eb d3                	jmp    8020d7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802104:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802107:	89 f3                	mov    %esi,%ebx
+  802109:	80 fb 19             	cmp    $0x19,%bl
+  80210c:	77 08                	ja     802116 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80210e:	0f be c0             	movsbl %al,%eax
+  802111:	83 e8 37             	sub    $0x37,%eax
+  802114:	eb c1                	jmp    8020d7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802116:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80211a:	74 05                	je     802121 <strtol+0xcc>
+		*endptr = (char *) s;
+  80211c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80211f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802121:	89 c8                	mov    %ecx,%eax
+  802123:	f7 d8                	neg    %eax
+  802125:	85 ff                	test   %edi,%edi
+  802127:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80212a:	89 c8                	mov    %ecx,%eax
+  80212c:	5b                   	pop    %ebx
+  80212d:	5e                   	pop    %esi
+  80212e:	5f                   	pop    %edi
+  80212f:	5d                   	pop    %ebp
+  802130:	c3                   	ret
+
+00802131 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802131:	55                   	push   %ebp
+  802132:	89 e5                	mov    %esp,%ebp
+  802134:	57                   	push   %edi
+  802135:	56                   	push   %esi
+  802136:	53                   	push   %ebx
+  802137:	83 ec 18             	sub    $0x18,%esp
+  80213a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80213d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802140:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802143:	85 db                	test   %ebx,%ebx
+  802145:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80214a:	0f 45 c3             	cmovne %ebx,%eax
+  80214d:	50                   	push   %eax
+  80214e:	e8 32 e4 ff ff       	call   800585 <sys_ipc_recv>
+
+	if (from_env_store)
+  802153:	83 c4 10             	add    $0x10,%esp
+  802156:	85 ff                	test   %edi,%edi
+  802158:	74 17                	je     802171 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80215a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80215f:	85 c0                	test   %eax,%eax
+  802161:	75 0c                	jne    80216f <ipc_recv+0x3e>
+  802163:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802169:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  80216f:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802171:	85 f6                	test   %esi,%esi
+  802173:	74 2e                	je     8021a3 <ipc_recv+0x72>
+		if (!r && pg)
+  802175:	85 c0                	test   %eax,%eax
+  802177:	75 24                	jne    80219d <ipc_recv+0x6c>
+  802179:	85 db                	test   %ebx,%ebx
+  80217b:	74 20                	je     80219d <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  80217d:	a1 08 40 80 00       	mov    0x804008,%eax
+  802182:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802188:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80218a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80218f:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802195:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802198:	5b                   	pop    %ebx
+  802199:	5e                   	pop    %esi
+  80219a:	5f                   	pop    %edi
+  80219b:	5d                   	pop    %ebp
+  80219c:	c3                   	ret
+			*perm_store = 0;
+  80219d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  8021a3:	85 c0                	test   %eax,%eax
+  8021a5:	75 ee                	jne    802195 <ipc_recv+0x64>
+  8021a7:	eb e1                	jmp    80218a <ipc_recv+0x59>
+
+008021a9 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8021a9:	55                   	push   %ebp
+  8021aa:	89 e5                	mov    %esp,%ebp
+  8021ac:	57                   	push   %edi
+  8021ad:	56                   	push   %esi
+  8021ae:	53                   	push   %ebx
+  8021af:	83 ec 0c             	sub    $0xc,%esp
+  8021b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8021bb:	85 db                	test   %ebx,%ebx
+  8021bd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021c2:	0f 44 d8             	cmove  %eax,%ebx
+  8021c5:	ff 75 14             	push   0x14(%ebp)
+  8021c8:	53                   	push   %ebx
+  8021c9:	56                   	push   %esi
+  8021ca:	57                   	push   %edi
+  8021cb:	e8 92 e3 ff ff       	call   800562 <sys_ipc_try_send_yield>
+  8021d0:	83 c4 10             	add    $0x10,%esp
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	79 1e                	jns    8021f5 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8021d7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021da:	75 07                	jne    8021e3 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8021dc:	e8 a1 df ff ff       	call   800182 <sys_yield>
+  8021e1:	eb e2                	jmp    8021c5 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8021e3:	50                   	push   %eax
+  8021e4:	68 1f 2b 80 00       	push   $0x802b1f
+  8021e9:	6a 3d                	push   $0x3d
+  8021eb:	68 34 2b 80 00       	push   $0x802b34
+  8021f0:	e8 43 f5 ff ff       	call   801738 <_panic>
+	}
+}
+  8021f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f8:	5b                   	pop    %ebx
+  8021f9:	5e                   	pop    %esi
+  8021fa:	5f                   	pop    %edi
+  8021fb:	5d                   	pop    %ebp
+  8021fc:	c3                   	ret
+
+008021fd <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8021fd:	55                   	push   %ebp
+  8021fe:	89 e5                	mov    %esp,%ebp
+  802200:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802203:	ff 75 08             	push   0x8(%ebp)
+  802206:	e8 f7 de ff ff       	call   800102 <sys_env_find>
+}
+  80220b:	c9                   	leave
+  80220c:	c3                   	ret
+
+0080220d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80220d:	55                   	push   %ebp
+  80220e:	89 e5                	mov    %esp,%ebp
+  802210:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802213:	89 c2                	mov    %eax,%edx
+  802215:	c1 ea 16             	shr    $0x16,%edx
+  802218:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80221f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802224:	f6 c1 01             	test   $0x1,%cl
+  802227:	74 22                	je     80224b <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802229:	c1 e8 0c             	shr    $0xc,%eax
+  80222c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802233:	a8 01                	test   $0x1,%al
+  802235:	74 14                	je     80224b <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802237:	c1 e8 0c             	shr    $0xc,%eax
+  80223a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80223d:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802244:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802248:	0f b7 d2             	movzwl %dx,%edx
+}
+  80224b:	89 d0                	mov    %edx,%eax
+  80224d:	5d                   	pop    %ebp
+  80224e:	c3                   	ret
+  80224f:	90                   	nop
+
+00802250 <__udivmoddi4>:
+  802250:	55                   	push   %ebp
+  802251:	57                   	push   %edi
+  802252:	56                   	push   %esi
+  802253:	53                   	push   %ebx
+  802254:	83 ec 14             	sub    $0x14,%esp
+  802257:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80225b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80225f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802263:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802267:	89 f1                	mov    %esi,%ecx
+  802269:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80226d:	09 d9                	or     %ebx,%ecx
+  80226f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802273:	0f 84 92 00 00 00    	je     80230b <__udivmoddi4+0xbb>
+  802279:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802280:	00 
+  802281:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802286:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80228d:	00 
+  80228e:	89 1c 24             	mov    %ebx,(%esp)
+  802291:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802295:	8d 76 00             	lea    0x0(%esi),%esi
+  802298:	89 e9                	mov    %ebp,%ecx
+  80229a:	89 c3                	mov    %eax,%ebx
+  80229c:	89 d6                	mov    %edx,%esi
+  80229e:	31 ff                	xor    %edi,%edi
+  8022a0:	d3 ee                	shr    %cl,%esi
+  8022a2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8022a5:	f6 c1 20             	test   $0x20,%cl
+  8022a8:	0f 45 de             	cmovne %esi,%ebx
+  8022ab:	0f 45 f7             	cmovne %edi,%esi
+  8022ae:	8b 3c 24             	mov    (%esp),%edi
+  8022b1:	39 fb                	cmp    %edi,%ebx
+  8022b3:	89 f7                	mov    %esi,%edi
+  8022b5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8022b9:	8b 1c 24             	mov    (%esp),%ebx
+  8022bc:	19 f7                	sbb    %esi,%edi
+  8022be:	72 39                	jb     8022f9 <__udivmoddi4+0xa9>
+  8022c0:	89 e9                	mov    %ebp,%ecx
+  8022c2:	89 f7                	mov    %esi,%edi
+  8022c4:	89 de                	mov    %ebx,%esi
+  8022c6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8022c9:	d3 e6                	shl    %cl,%esi
+  8022cb:	31 db                	xor    %ebx,%ebx
+  8022cd:	f6 c1 20             	test   $0x20,%cl
+  8022d0:	0f 45 fe             	cmovne %esi,%edi
+  8022d3:	0f 45 f3             	cmovne %ebx,%esi
+  8022d6:	29 f0                	sub    %esi,%eax
+  8022d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022dd:	19 fa                	sbb    %edi,%edx
+  8022df:	31 ff                	xor    %edi,%edi
+  8022e1:	31 db                	xor    %ebx,%ebx
+  8022e3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8022e6:	d3 e6                	shl    %cl,%esi
+  8022e8:	f6 c1 20             	test   $0x20,%cl
+  8022eb:	0f 45 fe             	cmovne %esi,%edi
+  8022ee:	0f 45 f3             	cmovne %ebx,%esi
+  8022f1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8022f5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8022f9:	83 ed 01             	sub    $0x1,%ebp
+  8022fc:	73 9a                	jae    802298 <__udivmoddi4+0x48>
+  8022fe:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802302:	85 ff                	test   %edi,%edi
+  802304:	74 05                	je     80230b <__udivmoddi4+0xbb>
+  802306:	89 07                	mov    %eax,(%edi)
+  802308:	89 57 04             	mov    %edx,0x4(%edi)
+  80230b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80230f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802313:	83 c4 14             	add    $0x14,%esp
+  802316:	5b                   	pop    %ebx
+  802317:	5e                   	pop    %esi
+  802318:	5f                   	pop    %edi
+  802319:	5d                   	pop    %ebp
+  80231a:	c3                   	ret
+  80231b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80231f:	90                   	nop
+
+00802320 <__udivdi3>:
+  802320:	55                   	push   %ebp
+  802321:	57                   	push   %edi
+  802322:	56                   	push   %esi
+  802323:	53                   	push   %ebx
+  802324:	83 ec 14             	sub    $0x14,%esp
+  802327:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80232b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80232f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802333:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802337:	89 fb                	mov    %edi,%ebx
+  802339:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80233d:	09 f3                	or     %esi,%ebx
+  80233f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802343:	0f 84 85 00 00 00    	je     8023ce <__udivdi3+0xae>
+  802349:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802350:	00 
+  802351:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802356:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80235d:	00 
+  80235e:	89 34 24             	mov    %esi,(%esp)
+  802361:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802365:	8d 76 00             	lea    0x0(%esi),%esi
+  802368:	89 e9                	mov    %ebp,%ecx
+  80236a:	89 c3                	mov    %eax,%ebx
+  80236c:	89 d6                	mov    %edx,%esi
+  80236e:	31 ff                	xor    %edi,%edi
+  802370:	d3 ee                	shr    %cl,%esi
+  802372:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802375:	f6 c1 20             	test   $0x20,%cl
+  802378:	0f 45 de             	cmovne %esi,%ebx
+  80237b:	0f 45 f7             	cmovne %edi,%esi
+  80237e:	8b 3c 24             	mov    (%esp),%edi
+  802381:	39 fb                	cmp    %edi,%ebx
+  802383:	89 f7                	mov    %esi,%edi
+  802385:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802389:	8b 1c 24             	mov    (%esp),%ebx
+  80238c:	19 f7                	sbb    %esi,%edi
+  80238e:	72 39                	jb     8023c9 <__udivdi3+0xa9>
+  802390:	89 e9                	mov    %ebp,%ecx
+  802392:	89 f7                	mov    %esi,%edi
+  802394:	89 de                	mov    %ebx,%esi
+  802396:	0f a5 df             	shld   %cl,%ebx,%edi
+  802399:	d3 e6                	shl    %cl,%esi
+  80239b:	31 db                	xor    %ebx,%ebx
+  80239d:	f6 c1 20             	test   $0x20,%cl
+  8023a0:	0f 45 fe             	cmovne %esi,%edi
+  8023a3:	0f 45 f3             	cmovne %ebx,%esi
+  8023a6:	29 f0                	sub    %esi,%eax
+  8023a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ad:	19 fa                	sbb    %edi,%edx
+  8023af:	31 ff                	xor    %edi,%edi
+  8023b1:	31 db                	xor    %ebx,%ebx
+  8023b3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023b6:	d3 e6                	shl    %cl,%esi
+  8023b8:	f6 c1 20             	test   $0x20,%cl
+  8023bb:	0f 45 fe             	cmovne %esi,%edi
+  8023be:	0f 45 f3             	cmovne %ebx,%esi
+  8023c1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023c5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023c9:	83 ed 01             	sub    $0x1,%ebp
+  8023cc:	73 9a                	jae    802368 <__udivdi3+0x48>
+  8023ce:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023d2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023d6:	83 c4 14             	add    $0x14,%esp
+  8023d9:	5b                   	pop    %ebx
+  8023da:	5e                   	pop    %esi
+  8023db:	5f                   	pop    %edi
+  8023dc:	5d                   	pop    %ebp
+  8023dd:	c3                   	ret
+  8023de:	66 90                	xchg   %ax,%ax
+
+008023e0 <__umoddi3>:
+  8023e0:	57                   	push   %edi
+  8023e1:	56                   	push   %esi
+  8023e2:	53                   	push   %ebx
+  8023e3:	83 ec 08             	sub    $0x8,%esp
+  8023e6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8023ea:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8023ee:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023f2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023f6:	89 f9                	mov    %edi,%ecx
+  8023f8:	89 34 24             	mov    %esi,(%esp)
+  8023fb:	09 f1                	or     %esi,%ecx
+  8023fd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802401:	74 53                	je     802456 <__umoddi3+0x76>
+  802403:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802408:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80240f:	90                   	nop
+  802410:	89 c6                	mov    %eax,%esi
+  802412:	89 d7                	mov    %edx,%edi
+  802414:	31 db                	xor    %ebx,%ebx
+  802416:	d3 ef                	shr    %cl,%edi
+  802418:	0f ad d6             	shrd   %cl,%edx,%esi
+  80241b:	f6 c1 20             	test   $0x20,%cl
+  80241e:	0f 45 f7             	cmovne %edi,%esi
+  802421:	0f 45 fb             	cmovne %ebx,%edi
+  802424:	8b 1c 24             	mov    (%esp),%ebx
+  802427:	39 de                	cmp    %ebx,%esi
+  802429:	89 fb                	mov    %edi,%ebx
+  80242b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80242f:	8b 34 24             	mov    (%esp),%esi
+  802432:	19 fb                	sbb    %edi,%ebx
+  802434:	72 14                	jb     80244a <__umoddi3+0x6a>
+  802436:	0f a5 f7             	shld   %cl,%esi,%edi
+  802439:	31 db                	xor    %ebx,%ebx
+  80243b:	d3 e6                	shl    %cl,%esi
+  80243d:	f6 c1 20             	test   $0x20,%cl
+  802440:	0f 45 fe             	cmovne %esi,%edi
+  802443:	0f 45 f3             	cmovne %ebx,%esi
+  802446:	29 f0                	sub    %esi,%eax
+  802448:	19 fa                	sbb    %edi,%edx
+  80244a:	83 e9 01             	sub    $0x1,%ecx
+  80244d:	73 c1                	jae    802410 <__umoddi3+0x30>
+  80244f:	83 c4 08             	add    $0x8,%esp
+  802452:	5b                   	pop    %ebx
+  802453:	5e                   	pop    %esi
+  802454:	5f                   	pop    %edi
+  802455:	c3                   	ret
+  802456:	83 c4 08             	add    $0x8,%esp
+  802459:	31 c0                	xor    %eax,%eax
+  80245b:	31 d2                	xor    %edx,%edx
+  80245d:	5b                   	pop    %ebx
+  80245e:	5e                   	pop    %esi
+  80245f:	5f                   	pop    %edi
+  802460:	c3                   	ret
+  802461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802468:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80246f:	90                   	nop
+
+00802470 <__divdi3>:
+  802470:	55                   	push   %ebp
+  802471:	57                   	push   %edi
+  802472:	56                   	push   %esi
+  802473:	53                   	push   %ebx
+  802474:	83 ec 1c             	sub    $0x1c,%esp
+  802477:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80247b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80247f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802483:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802487:	85 ff                	test   %edi,%edi
+  802489:	0f 88 da 00 00 00    	js     802569 <__divdi3+0xf9>
+  80248f:	85 db                	test   %ebx,%ebx
+  802491:	78 16                	js     8024a9 <__divdi3+0x39>
+  802493:	89 dd                	mov    %ebx,%ebp
+  802495:	89 c8                	mov    %ecx,%eax
+  802497:	89 da                	mov    %ebx,%edx
+  802499:	09 cd                	or     %ecx,%ebp
+  80249b:	0f 85 fd 00 00 00    	jne    80259e <__divdi3+0x12e>
+  8024a1:	83 c4 1c             	add    $0x1c,%esp
+  8024a4:	5b                   	pop    %ebx
+  8024a5:	5e                   	pop    %esi
+  8024a6:	5f                   	pop    %edi
+  8024a7:	5d                   	pop    %ebp
+  8024a8:	c3                   	ret
+  8024a9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8024ae:	f7 d9                	neg    %ecx
+  8024b0:	89 f0                	mov    %esi,%eax
+  8024b2:	89 fa                	mov    %edi,%edx
+  8024b4:	83 d3 00             	adc    $0x0,%ebx
+  8024b7:	89 0c 24             	mov    %ecx,(%esp)
+  8024ba:	f7 db                	neg    %ebx
+  8024bc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8024c0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024c7:	00 
+  8024c8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024cd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024d4:	00 
+  8024d5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024d9:	89 cd                	mov    %ecx,%ebp
+  8024db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024df:	90                   	nop
+  8024e0:	89 e9                	mov    %ebp,%ecx
+  8024e2:	89 c3                	mov    %eax,%ebx
+  8024e4:	89 d6                	mov    %edx,%esi
+  8024e6:	31 ff                	xor    %edi,%edi
+  8024e8:	d3 ee                	shr    %cl,%esi
+  8024ea:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024ed:	f6 c1 20             	test   $0x20,%cl
+  8024f0:	0f 45 de             	cmovne %esi,%ebx
+  8024f3:	0f 45 f7             	cmovne %edi,%esi
+  8024f6:	8b 3c 24             	mov    (%esp),%edi
+  8024f9:	39 fb                	cmp    %edi,%ebx
+  8024fb:	89 f7                	mov    %esi,%edi
+  8024fd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802501:	8b 1c 24             	mov    (%esp),%ebx
+  802504:	19 f7                	sbb    %esi,%edi
+  802506:	72 39                	jb     802541 <__divdi3+0xd1>
+  802508:	89 e9                	mov    %ebp,%ecx
+  80250a:	89 f7                	mov    %esi,%edi
+  80250c:	89 de                	mov    %ebx,%esi
+  80250e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802511:	d3 e6                	shl    %cl,%esi
+  802513:	31 db                	xor    %ebx,%ebx
+  802515:	f6 c1 20             	test   $0x20,%cl
+  802518:	0f 45 fe             	cmovne %esi,%edi
+  80251b:	0f 45 f3             	cmovne %ebx,%esi
+  80251e:	29 f0                	sub    %esi,%eax
+  802520:	be 01 00 00 00       	mov    $0x1,%esi
+  802525:	19 fa                	sbb    %edi,%edx
+  802527:	31 ff                	xor    %edi,%edi
+  802529:	31 db                	xor    %ebx,%ebx
+  80252b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80252e:	d3 e6                	shl    %cl,%esi
+  802530:	f6 c1 20             	test   $0x20,%cl
+  802533:	0f 45 fe             	cmovne %esi,%edi
+  802536:	0f 45 f3             	cmovne %ebx,%esi
+  802539:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80253d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802541:	83 ed 01             	sub    $0x1,%ebp
+  802544:	73 9a                	jae    8024e0 <__divdi3+0x70>
+  802546:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80254a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80254e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802552:	85 ed                	test   %ebp,%ebp
+  802554:	0f 84 47 ff ff ff    	je     8024a1 <__divdi3+0x31>
+  80255a:	f7 d8                	neg    %eax
+  80255c:	83 d2 00             	adc    $0x0,%edx
+  80255f:	83 c4 1c             	add    $0x1c,%esp
+  802562:	5b                   	pop    %ebx
+  802563:	f7 da                	neg    %edx
+  802565:	5e                   	pop    %esi
+  802566:	5f                   	pop    %edi
+  802567:	5d                   	pop    %ebp
+  802568:	c3                   	ret
+  802569:	f7 de                	neg    %esi
+  80256b:	83 d7 00             	adc    $0x0,%edi
+  80256e:	f7 df                	neg    %edi
+  802570:	85 db                	test   %ebx,%ebx
+  802572:	78 23                	js     802597 <__divdi3+0x127>
+  802574:	89 dd                	mov    %ebx,%ebp
+  802576:	89 c8                	mov    %ecx,%eax
+  802578:	89 da                	mov    %ebx,%edx
+  80257a:	09 cd                	or     %ecx,%ebp
+  80257c:	0f 84 1f ff ff ff    	je     8024a1 <__divdi3+0x31>
+  802582:	89 0c 24             	mov    %ecx,(%esp)
+  802585:	89 f0                	mov    %esi,%eax
+  802587:	89 fa                	mov    %edi,%edx
+  802589:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80258e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802592:	e9 29 ff ff ff       	jmp    8024c0 <__divdi3+0x50>
+  802597:	31 ed                	xor    %ebp,%ebp
+  802599:	e9 10 ff ff ff       	jmp    8024ae <__divdi3+0x3e>
+  80259e:	89 0c 24             	mov    %ecx,(%esp)
+  8025a1:	89 f0                	mov    %esi,%eax
+  8025a3:	89 fa                	mov    %edi,%edx
+  8025a5:	31 ed                	xor    %ebp,%ebp
+  8025a7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8025ab:	e9 10 ff ff ff       	jmp    8024c0 <__divdi3+0x50>
+
+008025b0 <__moddi3>:
+  8025b0:	55                   	push   %ebp
+  8025b1:	57                   	push   %edi
+  8025b2:	56                   	push   %esi
+  8025b3:	53                   	push   %ebx
+  8025b4:	83 ec 14             	sub    $0x14,%esp
+  8025b7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025bb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025bf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8025c3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8025c7:	85 d2                	test   %edx,%edx
+  8025c9:	0f 88 9b 00 00 00    	js     80266a <__moddi3+0xba>
+  8025cf:	89 f7                	mov    %esi,%edi
+  8025d1:	31 ed                	xor    %ebp,%ebp
+  8025d3:	09 cf                	or     %ecx,%edi
+  8025d5:	0f 84 83 00 00 00    	je     80265e <__moddi3+0xae>
+  8025db:	89 cb                	mov    %ecx,%ebx
+  8025dd:	89 f7                	mov    %esi,%edi
+  8025df:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8025e3:	f7 db                	neg    %ebx
+  8025e5:	83 d7 00             	adc    $0x0,%edi
+  8025e8:	f7 df                	neg    %edi
+  8025ea:	0f 49 f7             	cmovns %edi,%esi
+  8025ed:	0f 49 cb             	cmovns %ebx,%ecx
+  8025f0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025f4:	89 0c 24             	mov    %ecx,(%esp)
+  8025f7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025fc:	89 cd                	mov    %ecx,%ebp
+  8025fe:	66 90                	xchg   %ax,%ax
+  802600:	89 e9                	mov    %ebp,%ecx
+  802602:	89 c3                	mov    %eax,%ebx
+  802604:	89 d6                	mov    %edx,%esi
+  802606:	31 ff                	xor    %edi,%edi
+  802608:	d3 ee                	shr    %cl,%esi
+  80260a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80260d:	f6 c1 20             	test   $0x20,%cl
+  802610:	0f 45 de             	cmovne %esi,%ebx
+  802613:	0f 45 f7             	cmovne %edi,%esi
+  802616:	8b 3c 24             	mov    (%esp),%edi
+  802619:	39 fb                	cmp    %edi,%ebx
+  80261b:	89 f7                	mov    %esi,%edi
+  80261d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802621:	8b 1c 24             	mov    (%esp),%ebx
+  802624:	19 f7                	sbb    %esi,%edi
+  802626:	72 1a                	jb     802642 <__moddi3+0x92>
+  802628:	89 e9                	mov    %ebp,%ecx
+  80262a:	89 f7                	mov    %esi,%edi
+  80262c:	89 de                	mov    %ebx,%esi
+  80262e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802631:	d3 e6                	shl    %cl,%esi
+  802633:	31 db                	xor    %ebx,%ebx
+  802635:	f6 c1 20             	test   $0x20,%cl
+  802638:	0f 45 fe             	cmovne %esi,%edi
+  80263b:	0f 45 f3             	cmovne %ebx,%esi
+  80263e:	29 f0                	sub    %esi,%eax
+  802640:	19 fa                	sbb    %edi,%edx
+  802642:	83 ed 01             	sub    $0x1,%ebp
+  802645:	73 b9                	jae    802600 <__moddi3+0x50>
+  802647:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80264b:	85 ed                	test   %ebp,%ebp
+  80264d:	74 07                	je     802656 <__moddi3+0xa6>
+  80264f:	f7 d8                	neg    %eax
+  802651:	83 d2 00             	adc    $0x0,%edx
+  802654:	f7 da                	neg    %edx
+  802656:	83 c4 14             	add    $0x14,%esp
+  802659:	5b                   	pop    %ebx
+  80265a:	5e                   	pop    %esi
+  80265b:	5f                   	pop    %edi
+  80265c:	5d                   	pop    %ebp
+  80265d:	c3                   	ret
+  80265e:	83 c4 14             	add    $0x14,%esp
+  802661:	31 c0                	xor    %eax,%eax
+  802663:	31 d2                	xor    %edx,%edx
+  802665:	5b                   	pop    %ebx
+  802666:	5e                   	pop    %esi
+  802667:	5f                   	pop    %edi
+  802668:	5d                   	pop    %ebp
+  802669:	c3                   	ret
+  80266a:	89 f7                	mov    %esi,%edi
+  80266c:	09 cf                	or     %ecx,%edi
+  80266e:	74 11                	je     802681 <__moddi3+0xd1>
+  802670:	f7 d8                	neg    %eax
+  802672:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802677:	83 d2 00             	adc    $0x0,%edx
+  80267a:	f7 da                	neg    %edx
+  80267c:	e9 5a ff ff ff       	jmp    8025db <__moddi3+0x2b>
+  802681:	31 c0                	xor    %eax,%eax
+  802683:	31 d2                	xor    %edx,%edx
+  802685:	eb c8                	jmp    80264f <__moddi3+0x9f>
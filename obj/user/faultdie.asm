@@ -0,0 +1,5703 @@
+
+obj/user/faultdie.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4f 00 00 00       	call   800080 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void*)utf->utf_fault_va;
+	uint32_t err = utf->utf_err;
+	cprintf("i faulted at va %x, err %x\n", addr, err & 7);
+  80003c:	8b 42 04             	mov    0x4(%edx),%eax
+  80003f:	83 e0 07             	and    $0x7,%eax
+  800042:	50                   	push   %eax
+  800043:	ff 32                	push   (%edx)
+  800045:	68 40 27 80 00       	push   $0x802740
+  80004a:	e8 26 01 00 00       	call   800175 <cprintf>
+	sys_env_destroy(sys_getenvid());
+  80004f:	e8 dd 0a 00 00       	call   800b31 <sys_getenvid>
+  800054:	89 04 24             	mov    %eax,(%esp)
+  800057:	e8 94 0a 00 00       	call   800af0 <sys_env_destroy>
+}
+  80005c:	83 c4 10             	add    $0x10,%esp
+  80005f:	c9                   	leave
+  800060:	c3                   	ret
+
+00800061 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800061:	55                   	push   %ebp
+  800062:	89 e5                	mov    %esp,%ebp
+  800064:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800067:	68 33 00 80 00       	push   $0x800033
+  80006c:	e8 84 0f 00 00       	call   800ff5 <set_pgfault_handler>
+	*(int*)0xDeadBeef = 0;
+  800071:	c7 05 ef be ad de 00 	movl   $0x0,0xdeadbeef
+  800078:	00 00 00 
+}
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	c9                   	leave
+  80007f:	c3                   	ret
+
+00800080 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	56                   	push   %esi
+  800084:	53                   	push   %ebx
+  800085:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800088:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80008b:	e8 a1 0a 00 00       	call   800b31 <sys_getenvid>
+  800090:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800095:	c1 e0 09             	shl    $0x9,%eax
+  800098:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80009d:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a2:	85 db                	test   %ebx,%ebx
+  8000a4:	7e 07                	jle    8000ad <libmain+0x2d>
+		binaryname = argv[0];
+  8000a6:	8b 06                	mov    (%esi),%eax
+  8000a8:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ad:	83 ec 08             	sub    $0x8,%esp
+  8000b0:	56                   	push   %esi
+  8000b1:	53                   	push   %ebx
+  8000b2:	e8 aa ff ff ff       	call   800061 <umain>
+
+	// exit gracefully
+	exit();
+  8000b7:	e8 0a 00 00 00       	call   8000c6 <exit>
+}
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c2:	5b                   	pop    %ebx
+  8000c3:	5e                   	pop    %esi
+  8000c4:	5d                   	pop    %ebp
+  8000c5:	c3                   	ret
+
+008000c6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c6:	55                   	push   %ebp
+  8000c7:	89 e5                	mov    %esp,%ebp
+  8000c9:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000cc:	e8 89 11 00 00       	call   80125a <close_all>
+	sys_env_destroy(0);
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	6a 00                	push   $0x0
+  8000d6:	e8 15 0a 00 00       	call   800af0 <sys_env_destroy>
+}
+  8000db:	83 c4 10             	add    $0x10,%esp
+  8000de:	c9                   	leave
+  8000df:	c3                   	ret
+
+008000e0 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000e0:	55                   	push   %ebp
+  8000e1:	89 e5                	mov    %esp,%ebp
+  8000e3:	53                   	push   %ebx
+  8000e4:	83 ec 04             	sub    $0x4,%esp
+  8000e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000ea:	8b 13                	mov    (%ebx),%edx
+  8000ec:	8d 42 01             	lea    0x1(%edx),%eax
+  8000ef:	89 03                	mov    %eax,(%ebx)
+  8000f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000f4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000f8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000fd:	74 09                	je     800108 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000ff:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800103:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800106:	c9                   	leave
+  800107:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800108:	83 ec 08             	sub    $0x8,%esp
+  80010b:	68 ff 00 00 00       	push   $0xff
+  800110:	8d 43 08             	lea    0x8(%ebx),%eax
+  800113:	50                   	push   %eax
+  800114:	e8 7a 09 00 00       	call   800a93 <sys_cputs>
+		b->idx = 0;
+  800119:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80011f:	83 c4 10             	add    $0x10,%esp
+  800122:	eb db                	jmp    8000ff <putch+0x1f>
+
+00800124 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800124:	55                   	push   %ebp
+  800125:	89 e5                	mov    %esp,%ebp
+  800127:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80012d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800134:	00 00 00 
+	b.cnt = 0;
+  800137:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80013e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800141:	ff 75 0c             	push   0xc(%ebp)
+  800144:	ff 75 08             	push   0x8(%ebp)
+  800147:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80014d:	50                   	push   %eax
+  80014e:	68 e0 00 80 00       	push   $0x8000e0
+  800153:	e8 14 01 00 00       	call   80026c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800158:	83 c4 08             	add    $0x8,%esp
+  80015b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800161:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800167:	50                   	push   %eax
+  800168:	e8 26 09 00 00       	call   800a93 <sys_cputs>
+
+	return b.cnt;
+}
+  80016d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800173:	c9                   	leave
+  800174:	c3                   	ret
+
+00800175 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800175:	55                   	push   %ebp
+  800176:	89 e5                	mov    %esp,%ebp
+  800178:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80017b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80017e:	50                   	push   %eax
+  80017f:	ff 75 08             	push   0x8(%ebp)
+  800182:	e8 9d ff ff ff       	call   800124 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800187:	c9                   	leave
+  800188:	c3                   	ret
+
+00800189 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800189:	55                   	push   %ebp
+  80018a:	89 e5                	mov    %esp,%ebp
+  80018c:	57                   	push   %edi
+  80018d:	56                   	push   %esi
+  80018e:	53                   	push   %ebx
+  80018f:	83 ec 1c             	sub    $0x1c,%esp
+  800192:	89 c7                	mov    %eax,%edi
+  800194:	89 d6                	mov    %edx,%esi
+  800196:	8b 45 08             	mov    0x8(%ebp),%eax
+  800199:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80019c:	89 d1                	mov    %edx,%ecx
+  80019e:	89 c2                	mov    %eax,%edx
+  8001a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001a3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001a6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001a9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001af:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001b6:	39 c2                	cmp    %eax,%edx
+  8001b8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001bb:	72 3e                	jb     8001fb <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001bd:	83 ec 0c             	sub    $0xc,%esp
+  8001c0:	ff 75 18             	push   0x18(%ebp)
+  8001c3:	83 eb 01             	sub    $0x1,%ebx
+  8001c6:	53                   	push   %ebx
+  8001c7:	50                   	push   %eax
+  8001c8:	83 ec 08             	sub    $0x8,%esp
+  8001cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8001ce:	ff 75 e0             	push   -0x20(%ebp)
+  8001d1:	ff 75 dc             	push   -0x24(%ebp)
+  8001d4:	ff 75 d8             	push   -0x28(%ebp)
+  8001d7:	e8 f4 21 00 00       	call   8023d0 <__udivdi3>
+  8001dc:	83 c4 18             	add    $0x18,%esp
+  8001df:	52                   	push   %edx
+  8001e0:	50                   	push   %eax
+  8001e1:	89 f2                	mov    %esi,%edx
+  8001e3:	89 f8                	mov    %edi,%eax
+  8001e5:	e8 9f ff ff ff       	call   800189 <printnum>
+  8001ea:	83 c4 20             	add    $0x20,%esp
+  8001ed:	eb 13                	jmp    800202 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001ef:	83 ec 08             	sub    $0x8,%esp
+  8001f2:	56                   	push   %esi
+  8001f3:	ff 75 18             	push   0x18(%ebp)
+  8001f6:	ff d7                	call   *%edi
+  8001f8:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001fb:	83 eb 01             	sub    $0x1,%ebx
+  8001fe:	85 db                	test   %ebx,%ebx
+  800200:	7f ed                	jg     8001ef <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800202:	83 ec 08             	sub    $0x8,%esp
+  800205:	56                   	push   %esi
+  800206:	83 ec 04             	sub    $0x4,%esp
+  800209:	ff 75 e4             	push   -0x1c(%ebp)
+  80020c:	ff 75 e0             	push   -0x20(%ebp)
+  80020f:	ff 75 dc             	push   -0x24(%ebp)
+  800212:	ff 75 d8             	push   -0x28(%ebp)
+  800215:	e8 76 22 00 00       	call   802490 <__umoddi3>
+  80021a:	83 c4 14             	add    $0x14,%esp
+  80021d:	0f be 80 66 27 80 00 	movsbl 0x802766(%eax),%eax
+  800224:	50                   	push   %eax
+  800225:	ff d7                	call   *%edi
+}
+  800227:	83 c4 10             	add    $0x10,%esp
+  80022a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80022d:	5b                   	pop    %ebx
+  80022e:	5e                   	pop    %esi
+  80022f:	5f                   	pop    %edi
+  800230:	5d                   	pop    %ebp
+  800231:	c3                   	ret
+
+00800232 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800232:	55                   	push   %ebp
+  800233:	89 e5                	mov    %esp,%ebp
+  800235:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800238:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80023c:	8b 10                	mov    (%eax),%edx
+  80023e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800241:	73 0a                	jae    80024d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800243:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800246:	89 08                	mov    %ecx,(%eax)
+  800248:	8b 45 08             	mov    0x8(%ebp),%eax
+  80024b:	88 02                	mov    %al,(%edx)
+}
+  80024d:	5d                   	pop    %ebp
+  80024e:	c3                   	ret
+
+0080024f <printfmt>:
+{
+  80024f:	55                   	push   %ebp
+  800250:	89 e5                	mov    %esp,%ebp
+  800252:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800255:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800258:	50                   	push   %eax
+  800259:	ff 75 10             	push   0x10(%ebp)
+  80025c:	ff 75 0c             	push   0xc(%ebp)
+  80025f:	ff 75 08             	push   0x8(%ebp)
+  800262:	e8 05 00 00 00       	call   80026c <vprintfmt>
+}
+  800267:	83 c4 10             	add    $0x10,%esp
+  80026a:	c9                   	leave
+  80026b:	c3                   	ret
+
+0080026c <vprintfmt>:
+{
+  80026c:	55                   	push   %ebp
+  80026d:	89 e5                	mov    %esp,%ebp
+  80026f:	57                   	push   %edi
+  800270:	56                   	push   %esi
+  800271:	53                   	push   %ebx
+  800272:	83 ec 2c             	sub    $0x2c,%esp
+  800275:	8b 75 08             	mov    0x8(%ebp),%esi
+  800278:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80027b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80027e:	eb 0a                	jmp    80028a <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800280:	83 ec 08             	sub    $0x8,%esp
+  800283:	53                   	push   %ebx
+  800284:	50                   	push   %eax
+  800285:	ff d6                	call   *%esi
+  800287:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80028a:	83 c7 01             	add    $0x1,%edi
+  80028d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800291:	83 f8 25             	cmp    $0x25,%eax
+  800294:	74 0c                	je     8002a2 <vprintfmt+0x36>
+			if (ch == '\0')
+  800296:	85 c0                	test   %eax,%eax
+  800298:	75 e6                	jne    800280 <vprintfmt+0x14>
+}
+  80029a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80029d:	5b                   	pop    %ebx
+  80029e:	5e                   	pop    %esi
+  80029f:	5f                   	pop    %edi
+  8002a0:	5d                   	pop    %ebp
+  8002a1:	c3                   	ret
+		padc = ' ';
+  8002a2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002a6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002ad:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002b4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002c0:	8d 47 01             	lea    0x1(%edi),%eax
+  8002c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002c6:	0f b6 17             	movzbl (%edi),%edx
+  8002c9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002cc:	3c 55                	cmp    $0x55,%al
+  8002ce:	0f 87 cf 03 00 00    	ja     8006a3 <vprintfmt+0x437>
+  8002d4:	0f b6 c0             	movzbl %al,%eax
+  8002d7:	ff 24 85 a0 28 80 00 	jmp    *0x8028a0(,%eax,4)
+  8002de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002e1:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002e5:	eb d9                	jmp    8002c0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002ea:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002ee:	eb d0                	jmp    8002c0 <vprintfmt+0x54>
+  8002f0:	0f b6 d2             	movzbl %dl,%edx
+  8002f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002fe:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800301:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800305:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800308:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80030b:	83 f9 09             	cmp    $0x9,%ecx
+  80030e:	77 55                	ja     800365 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800310:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800313:	eb e9                	jmp    8002fe <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800315:	8b 45 14             	mov    0x14(%ebp),%eax
+  800318:	8b 00                	mov    (%eax),%eax
+  80031a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80031d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800320:	8d 40 04             	lea    0x4(%eax),%eax
+  800323:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800326:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800329:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80032d:	79 91                	jns    8002c0 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80032f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800332:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800335:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80033c:	eb 82                	jmp    8002c0 <vprintfmt+0x54>
+			if (width < 0)
+  80033e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800341:	85 d2                	test   %edx,%edx
+  800343:	b8 00 00 00 00       	mov    $0x0,%eax
+  800348:	0f 49 c2             	cmovns %edx,%eax
+  80034b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80034e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800351:	e9 6a ff ff ff       	jmp    8002c0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800356:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800359:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800360:	e9 5b ff ff ff       	jmp    8002c0 <vprintfmt+0x54>
+  800365:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800368:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80036b:	eb bc                	jmp    800329 <vprintfmt+0xbd>
+			lflag++;
+  80036d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800370:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800373:	e9 48 ff ff ff       	jmp    8002c0 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800378:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037b:	8d 78 04             	lea    0x4(%eax),%edi
+  80037e:	83 ec 08             	sub    $0x8,%esp
+  800381:	53                   	push   %ebx
+  800382:	ff 30                	push   (%eax)
+  800384:	ff d6                	call   *%esi
+			break;
+  800386:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800389:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80038c:	e9 b1 02 00 00       	jmp    800642 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800391:	8b 45 14             	mov    0x14(%ebp),%eax
+  800394:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800397:	8b 10                	mov    (%eax),%edx
+  800399:	89 d0                	mov    %edx,%eax
+  80039b:	f7 d8                	neg    %eax
+  80039d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003a0:	83 f8 0f             	cmp    $0xf,%eax
+  8003a3:	7f 23                	jg     8003c8 <vprintfmt+0x15c>
+  8003a5:	8b 14 85 00 2a 80 00 	mov    0x802a00(,%eax,4),%edx
+  8003ac:	85 d2                	test   %edx,%edx
+  8003ae:	74 18                	je     8003c8 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003b0:	52                   	push   %edx
+  8003b1:	68 75 2b 80 00       	push   $0x802b75
+  8003b6:	53                   	push   %ebx
+  8003b7:	56                   	push   %esi
+  8003b8:	e8 92 fe ff ff       	call   80024f <printfmt>
+  8003bd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003c0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003c3:	e9 7a 02 00 00       	jmp    800642 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003c8:	50                   	push   %eax
+  8003c9:	68 7e 27 80 00       	push   $0x80277e
+  8003ce:	53                   	push   %ebx
+  8003cf:	56                   	push   %esi
+  8003d0:	e8 7a fe ff ff       	call   80024f <printfmt>
+  8003d5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003d8:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003db:	e9 62 02 00 00       	jmp    800642 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e3:	83 c0 04             	add    $0x4,%eax
+  8003e6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ec:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003ee:	85 c9                	test   %ecx,%ecx
+  8003f0:	b8 77 27 80 00       	mov    $0x802777,%eax
+  8003f5:	0f 45 c1             	cmovne %ecx,%eax
+  8003f8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003fb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ff:	7e 06                	jle    800407 <vprintfmt+0x19b>
+  800401:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800405:	75 0b                	jne    800412 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800407:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80040a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80040d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800410:	eb 5c                	jmp    80046e <vprintfmt+0x202>
+  800412:	83 ec 08             	sub    $0x8,%esp
+  800415:	ff 75 d0             	push   -0x30(%ebp)
+  800418:	ff 75 cc             	push   -0x34(%ebp)
+  80041b:	e8 20 03 00 00       	call   800740 <strnlen>
+  800420:	89 c2                	mov    %eax,%edx
+  800422:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800425:	29 d0                	sub    %edx,%eax
+  800427:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80042a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80042e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800431:	89 75 08             	mov    %esi,0x8(%ebp)
+  800434:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800436:	eb 0e                	jmp    800446 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800438:	83 ec 08             	sub    $0x8,%esp
+  80043b:	53                   	push   %ebx
+  80043c:	57                   	push   %edi
+  80043d:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800440:	83 ee 01             	sub    $0x1,%esi
+  800443:	83 c4 10             	add    $0x10,%esp
+  800446:	85 f6                	test   %esi,%esi
+  800448:	7f ee                	jg     800438 <vprintfmt+0x1cc>
+  80044a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80044d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800450:	85 c0                	test   %eax,%eax
+  800452:	ba 00 00 00 00       	mov    $0x0,%edx
+  800457:	0f 49 d0             	cmovns %eax,%edx
+  80045a:	29 d0                	sub    %edx,%eax
+  80045c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80045f:	eb a6                	jmp    800407 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800461:	83 ec 08             	sub    $0x8,%esp
+  800464:	53                   	push   %ebx
+  800465:	52                   	push   %edx
+  800466:	ff 55 08             	call   *0x8(%ebp)
+  800469:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80046c:	89 f1                	mov    %esi,%ecx
+  80046e:	8d 71 01             	lea    0x1(%ecx),%esi
+  800471:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800475:	0f be d0             	movsbl %al,%edx
+  800478:	85 d2                	test   %edx,%edx
+  80047a:	74 28                	je     8004a4 <vprintfmt+0x238>
+  80047c:	85 ff                	test   %edi,%edi
+  80047e:	78 05                	js     800485 <vprintfmt+0x219>
+  800480:	83 ef 01             	sub    $0x1,%edi
+  800483:	78 30                	js     8004b5 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800485:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800489:	74 d6                	je     800461 <vprintfmt+0x1f5>
+  80048b:	0f be c0             	movsbl %al,%eax
+  80048e:	83 e8 20             	sub    $0x20,%eax
+  800491:	83 f8 5e             	cmp    $0x5e,%eax
+  800494:	76 cb                	jbe    800461 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800496:	83 ec 08             	sub    $0x8,%esp
+  800499:	53                   	push   %ebx
+  80049a:	6a 3f                	push   $0x3f
+  80049c:	ff 55 08             	call   *0x8(%ebp)
+  80049f:	83 c4 10             	add    $0x10,%esp
+  8004a2:	eb c8                	jmp    80046c <vprintfmt+0x200>
+  8004a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004a7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004aa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ad:	01 d0                	add    %edx,%eax
+  8004af:	29 c8                	sub    %ecx,%eax
+  8004b1:	89 c7                	mov    %eax,%edi
+  8004b3:	eb 13                	jmp    8004c8 <vprintfmt+0x25c>
+  8004b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004b8:	eb ed                	jmp    8004a7 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004ba:	83 ec 08             	sub    $0x8,%esp
+  8004bd:	53                   	push   %ebx
+  8004be:	6a 20                	push   $0x20
+  8004c0:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004c2:	83 ef 01             	sub    $0x1,%edi
+  8004c5:	83 c4 10             	add    $0x10,%esp
+  8004c8:	85 ff                	test   %edi,%edi
+  8004ca:	7f ee                	jg     8004ba <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004cc:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d2:	e9 6b 01 00 00       	jmp    800642 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004d7:	83 f9 01             	cmp    $0x1,%ecx
+  8004da:	7f 1f                	jg     8004fb <vprintfmt+0x28f>
+	else if (lflag)
+  8004dc:	85 c9                	test   %ecx,%ecx
+  8004de:	74 67                	je     800547 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e3:	8b 00                	mov    (%eax),%eax
+  8004e5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004e8:	89 c1                	mov    %eax,%ecx
+  8004ea:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004ed:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8004f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004f9:	eb 17                	jmp    800512 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fe:	8b 50 04             	mov    0x4(%eax),%edx
+  800501:	8b 00                	mov    (%eax),%eax
+  800503:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800506:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800509:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050c:	8d 40 08             	lea    0x8(%eax),%eax
+  80050f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800512:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800515:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800518:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80051d:	85 c9                	test   %ecx,%ecx
+  80051f:	0f 89 03 01 00 00    	jns    800628 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800525:	83 ec 08             	sub    $0x8,%esp
+  800528:	53                   	push   %ebx
+  800529:	6a 2d                	push   $0x2d
+  80052b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80052d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800530:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800533:	f7 da                	neg    %edx
+  800535:	83 d1 00             	adc    $0x0,%ecx
+  800538:	f7 d9                	neg    %ecx
+  80053a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80053d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800542:	e9 e1 00 00 00       	jmp    800628 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800547:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054a:	8b 00                	mov    (%eax),%eax
+  80054c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80054f:	89 c1                	mov    %eax,%ecx
+  800551:	c1 f9 1f             	sar    $0x1f,%ecx
+  800554:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800557:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055a:	8d 40 04             	lea    0x4(%eax),%eax
+  80055d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800560:	eb b0                	jmp    800512 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800562:	83 f9 01             	cmp    $0x1,%ecx
+  800565:	7f 1e                	jg     800585 <vprintfmt+0x319>
+	else if (lflag)
+  800567:	85 c9                	test   %ecx,%ecx
+  800569:	74 32                	je     80059d <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80056b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056e:	8b 10                	mov    (%eax),%edx
+  800570:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800575:	8d 40 04             	lea    0x4(%eax),%eax
+  800578:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80057b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800580:	e9 a3 00 00 00       	jmp    800628 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	8b 10                	mov    (%eax),%edx
+  80058a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80058d:	8d 40 08             	lea    0x8(%eax),%eax
+  800590:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800593:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800598:	e9 8b 00 00 00       	jmp    800628 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80059d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a0:	8b 10                	mov    (%eax),%edx
+  8005a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ad:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005b2:	eb 74                	jmp    800628 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005b4:	83 f9 01             	cmp    $0x1,%ecx
+  8005b7:	7f 1b                	jg     8005d4 <vprintfmt+0x368>
+	else if (lflag)
+  8005b9:	85 c9                	test   %ecx,%ecx
+  8005bb:	74 2c                	je     8005e9 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8b 10                	mov    (%eax),%edx
+  8005c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005cd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005d2:	eb 54                	jmp    800628 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d7:	8b 10                	mov    (%eax),%edx
+  8005d9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005dc:	8d 40 08             	lea    0x8(%eax),%eax
+  8005df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005e2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005e7:	eb 3f                	jmp    800628 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 10                	mov    (%eax),%edx
+  8005ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005f9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005fe:	eb 28                	jmp    800628 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800600:	83 ec 08             	sub    $0x8,%esp
+  800603:	53                   	push   %ebx
+  800604:	6a 30                	push   $0x30
+  800606:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800608:	83 c4 08             	add    $0x8,%esp
+  80060b:	53                   	push   %ebx
+  80060c:	6a 78                	push   $0x78
+  80060e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800610:	8b 45 14             	mov    0x14(%ebp),%eax
+  800613:	8b 10                	mov    (%eax),%edx
+  800615:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80061a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80061d:	8d 40 04             	lea    0x4(%eax),%eax
+  800620:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800623:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800628:	83 ec 0c             	sub    $0xc,%esp
+  80062b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80062f:	50                   	push   %eax
+  800630:	ff 75 e0             	push   -0x20(%ebp)
+  800633:	57                   	push   %edi
+  800634:	51                   	push   %ecx
+  800635:	52                   	push   %edx
+  800636:	89 da                	mov    %ebx,%edx
+  800638:	89 f0                	mov    %esi,%eax
+  80063a:	e8 4a fb ff ff       	call   800189 <printnum>
+			break;
+  80063f:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800642:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800645:	e9 40 fc ff ff       	jmp    80028a <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80064a:	83 f9 01             	cmp    $0x1,%ecx
+  80064d:	7f 1b                	jg     80066a <vprintfmt+0x3fe>
+	else if (lflag)
+  80064f:	85 c9                	test   %ecx,%ecx
+  800651:	74 2c                	je     80067f <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800653:	8b 45 14             	mov    0x14(%ebp),%eax
+  800656:	8b 10                	mov    (%eax),%edx
+  800658:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065d:	8d 40 04             	lea    0x4(%eax),%eax
+  800660:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800663:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800668:	eb be                	jmp    800628 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80066a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066d:	8b 10                	mov    (%eax),%edx
+  80066f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800672:	8d 40 08             	lea    0x8(%eax),%eax
+  800675:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800678:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80067d:	eb a9                	jmp    800628 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8b 10                	mov    (%eax),%edx
+  800684:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800689:	8d 40 04             	lea    0x4(%eax),%eax
+  80068c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80068f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800694:	eb 92                	jmp    800628 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800696:	83 ec 08             	sub    $0x8,%esp
+  800699:	53                   	push   %ebx
+  80069a:	6a 25                	push   $0x25
+  80069c:	ff d6                	call   *%esi
+			break;
+  80069e:	83 c4 10             	add    $0x10,%esp
+  8006a1:	eb 9f                	jmp    800642 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006a3:	83 ec 08             	sub    $0x8,%esp
+  8006a6:	53                   	push   %ebx
+  8006a7:	6a 25                	push   $0x25
+  8006a9:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006ab:	83 c4 10             	add    $0x10,%esp
+  8006ae:	89 f8                	mov    %edi,%eax
+  8006b0:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006b4:	74 05                	je     8006bb <vprintfmt+0x44f>
+  8006b6:	83 e8 01             	sub    $0x1,%eax
+  8006b9:	eb f5                	jmp    8006b0 <vprintfmt+0x444>
+  8006bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006be:	eb 82                	jmp    800642 <vprintfmt+0x3d6>
+
+008006c0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006c0:	55                   	push   %ebp
+  8006c1:	89 e5                	mov    %esp,%ebp
+  8006c3:	83 ec 18             	sub    $0x18,%esp
+  8006c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006cc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006cf:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006d3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006d6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006dd:	85 c0                	test   %eax,%eax
+  8006df:	74 26                	je     800707 <vsnprintf+0x47>
+  8006e1:	85 d2                	test   %edx,%edx
+  8006e3:	7e 22                	jle    800707 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006e5:	ff 75 14             	push   0x14(%ebp)
+  8006e8:	ff 75 10             	push   0x10(%ebp)
+  8006eb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006ee:	50                   	push   %eax
+  8006ef:	68 32 02 80 00       	push   $0x800232
+  8006f4:	e8 73 fb ff ff       	call   80026c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006f9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006fc:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800702:	83 c4 10             	add    $0x10,%esp
+}
+  800705:	c9                   	leave
+  800706:	c3                   	ret
+		return -E_INVAL;
+  800707:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80070c:	eb f7                	jmp    800705 <vsnprintf+0x45>
+
+0080070e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80070e:	55                   	push   %ebp
+  80070f:	89 e5                	mov    %esp,%ebp
+  800711:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800714:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800717:	50                   	push   %eax
+  800718:	ff 75 10             	push   0x10(%ebp)
+  80071b:	ff 75 0c             	push   0xc(%ebp)
+  80071e:	ff 75 08             	push   0x8(%ebp)
+  800721:	e8 9a ff ff ff       	call   8006c0 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800726:	c9                   	leave
+  800727:	c3                   	ret
+
+00800728 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800728:	55                   	push   %ebp
+  800729:	89 e5                	mov    %esp,%ebp
+  80072b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80072e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800733:	eb 03                	jmp    800738 <strlen+0x10>
+		n++;
+  800735:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800738:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80073c:	75 f7                	jne    800735 <strlen+0xd>
+	return n;
+}
+  80073e:	5d                   	pop    %ebp
+  80073f:	c3                   	ret
+
+00800740 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800740:	55                   	push   %ebp
+  800741:	89 e5                	mov    %esp,%ebp
+  800743:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800746:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074e:	eb 03                	jmp    800753 <strnlen+0x13>
+		n++;
+  800750:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800753:	39 d0                	cmp    %edx,%eax
+  800755:	74 08                	je     80075f <strnlen+0x1f>
+  800757:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80075b:	75 f3                	jne    800750 <strnlen+0x10>
+  80075d:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80075f:	89 d0                	mov    %edx,%eax
+  800761:	5d                   	pop    %ebp
+  800762:	c3                   	ret
+
+00800763 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800763:	55                   	push   %ebp
+  800764:	89 e5                	mov    %esp,%ebp
+  800766:	53                   	push   %ebx
+  800767:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80076a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80076d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800772:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800776:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800779:	83 c0 01             	add    $0x1,%eax
+  80077c:	84 d2                	test   %dl,%dl
+  80077e:	75 f2                	jne    800772 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800780:	89 c8                	mov    %ecx,%eax
+  800782:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800785:	c9                   	leave
+  800786:	c3                   	ret
+
+00800787 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800787:	55                   	push   %ebp
+  800788:	89 e5                	mov    %esp,%ebp
+  80078a:	53                   	push   %ebx
+  80078b:	83 ec 10             	sub    $0x10,%esp
+  80078e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800791:	53                   	push   %ebx
+  800792:	e8 91 ff ff ff       	call   800728 <strlen>
+  800797:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80079a:	ff 75 0c             	push   0xc(%ebp)
+  80079d:	01 d8                	add    %ebx,%eax
+  80079f:	50                   	push   %eax
+  8007a0:	e8 be ff ff ff       	call   800763 <strcpy>
+	return dst;
+}
+  8007a5:	89 d8                	mov    %ebx,%eax
+  8007a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007aa:	c9                   	leave
+  8007ab:	c3                   	ret
+
+008007ac <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007ac:	55                   	push   %ebp
+  8007ad:	89 e5                	mov    %esp,%ebp
+  8007af:	56                   	push   %esi
+  8007b0:	53                   	push   %ebx
+  8007b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007b7:	89 f3                	mov    %esi,%ebx
+  8007b9:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007bc:	89 f0                	mov    %esi,%eax
+  8007be:	eb 0f                	jmp    8007cf <strncpy+0x23>
+		*dst++ = *src;
+  8007c0:	83 c0 01             	add    $0x1,%eax
+  8007c3:	0f b6 0a             	movzbl (%edx),%ecx
+  8007c6:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007c9:	80 f9 01             	cmp    $0x1,%cl
+  8007cc:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007cf:	39 d8                	cmp    %ebx,%eax
+  8007d1:	75 ed                	jne    8007c0 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007d3:	89 f0                	mov    %esi,%eax
+  8007d5:	5b                   	pop    %ebx
+  8007d6:	5e                   	pop    %esi
+  8007d7:	5d                   	pop    %ebp
+  8007d8:	c3                   	ret
+
+008007d9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007d9:	55                   	push   %ebp
+  8007da:	89 e5                	mov    %esp,%ebp
+  8007dc:	56                   	push   %esi
+  8007dd:	53                   	push   %ebx
+  8007de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007e4:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007e7:	89 f0                	mov    %esi,%eax
+  8007e9:	85 d2                	test   %edx,%edx
+  8007eb:	74 21                	je     80080e <strlcpy+0x35>
+  8007ed:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007f1:	89 f2                	mov    %esi,%edx
+  8007f3:	eb 09                	jmp    8007fe <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007f5:	83 c1 01             	add    $0x1,%ecx
+  8007f8:	83 c2 01             	add    $0x1,%edx
+  8007fb:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007fe:	39 c2                	cmp    %eax,%edx
+  800800:	74 09                	je     80080b <strlcpy+0x32>
+  800802:	0f b6 19             	movzbl (%ecx),%ebx
+  800805:	84 db                	test   %bl,%bl
+  800807:	75 ec                	jne    8007f5 <strlcpy+0x1c>
+  800809:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80080b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80080e:	29 f0                	sub    %esi,%eax
+}
+  800810:	5b                   	pop    %ebx
+  800811:	5e                   	pop    %esi
+  800812:	5d                   	pop    %ebp
+  800813:	c3                   	ret
+
+00800814 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800814:	55                   	push   %ebp
+  800815:	89 e5                	mov    %esp,%ebp
+  800817:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80081a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80081d:	eb 06                	jmp    800825 <strcmp+0x11>
+		p++, q++;
+  80081f:	83 c1 01             	add    $0x1,%ecx
+  800822:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800825:	0f b6 01             	movzbl (%ecx),%eax
+  800828:	84 c0                	test   %al,%al
+  80082a:	74 04                	je     800830 <strcmp+0x1c>
+  80082c:	3a 02                	cmp    (%edx),%al
+  80082e:	74 ef                	je     80081f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800830:	0f b6 c0             	movzbl %al,%eax
+  800833:	0f b6 12             	movzbl (%edx),%edx
+  800836:	29 d0                	sub    %edx,%eax
+}
+  800838:	5d                   	pop    %ebp
+  800839:	c3                   	ret
+
+0080083a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80083a:	55                   	push   %ebp
+  80083b:	89 e5                	mov    %esp,%ebp
+  80083d:	53                   	push   %ebx
+  80083e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800841:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800844:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800847:	eb 09                	jmp    800852 <strncmp+0x18>
+		n--, p++, q++;
+  800849:	83 ea 01             	sub    $0x1,%edx
+  80084c:	83 c0 01             	add    $0x1,%eax
+  80084f:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800852:	85 d2                	test   %edx,%edx
+  800854:	74 18                	je     80086e <strncmp+0x34>
+  800856:	0f b6 18             	movzbl (%eax),%ebx
+  800859:	84 db                	test   %bl,%bl
+  80085b:	74 04                	je     800861 <strncmp+0x27>
+  80085d:	3a 19                	cmp    (%ecx),%bl
+  80085f:	74 e8                	je     800849 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800861:	0f b6 00             	movzbl (%eax),%eax
+  800864:	0f b6 11             	movzbl (%ecx),%edx
+  800867:	29 d0                	sub    %edx,%eax
+}
+  800869:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80086c:	c9                   	leave
+  80086d:	c3                   	ret
+		return 0;
+  80086e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800873:	eb f4                	jmp    800869 <strncmp+0x2f>
+
+00800875 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800875:	55                   	push   %ebp
+  800876:	89 e5                	mov    %esp,%ebp
+  800878:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80087f:	eb 03                	jmp    800884 <strchr+0xf>
+  800881:	83 c0 01             	add    $0x1,%eax
+  800884:	0f b6 10             	movzbl (%eax),%edx
+  800887:	84 d2                	test   %dl,%dl
+  800889:	74 06                	je     800891 <strchr+0x1c>
+		if (*s == c)
+  80088b:	38 ca                	cmp    %cl,%dl
+  80088d:	75 f2                	jne    800881 <strchr+0xc>
+  80088f:	eb 05                	jmp    800896 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800891:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800896:	5d                   	pop    %ebp
+  800897:	c3                   	ret
+
+00800898 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800898:	55                   	push   %ebp
+  800899:	89 e5                	mov    %esp,%ebp
+  80089b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008a2:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008a5:	38 ca                	cmp    %cl,%dl
+  8008a7:	74 09                	je     8008b2 <strfind+0x1a>
+  8008a9:	84 d2                	test   %dl,%dl
+  8008ab:	74 05                	je     8008b2 <strfind+0x1a>
+	for (; *s; s++)
+  8008ad:	83 c0 01             	add    $0x1,%eax
+  8008b0:	eb f0                	jmp    8008a2 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008b2:	5d                   	pop    %ebp
+  8008b3:	c3                   	ret
+
+008008b4 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008b4:	55                   	push   %ebp
+  8008b5:	89 e5                	mov    %esp,%ebp
+  8008b7:	57                   	push   %edi
+  8008b8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008bb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008be:	85 c9                	test   %ecx,%ecx
+  8008c0:	74 20                	je     8008e2 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008c2:	89 f8                	mov    %edi,%eax
+  8008c4:	09 c8                	or     %ecx,%eax
+  8008c6:	a8 03                	test   $0x3,%al
+  8008c8:	75 12                	jne    8008dc <memset+0x28>
+		c &= 0xFF;
+  8008ca:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008ce:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008d4:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008d7:	fc                   	cld
+  8008d8:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008da:	eb 06                	jmp    8008e2 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008df:	fc                   	cld
+  8008e0:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008e2:	89 f8                	mov    %edi,%eax
+  8008e4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008e7:	c9                   	leave
+  8008e8:	c3                   	ret
+
+008008e9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008e9:	55                   	push   %ebp
+  8008ea:	89 e5                	mov    %esp,%ebp
+  8008ec:	57                   	push   %edi
+  8008ed:	56                   	push   %esi
+  8008ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008f4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008f7:	39 c6                	cmp    %eax,%esi
+  8008f9:	73 32                	jae    80092d <memmove+0x44>
+  8008fb:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008fe:	39 d0                	cmp    %edx,%eax
+  800900:	73 2b                	jae    80092d <memmove+0x44>
+		s += n;
+		d += n;
+  800902:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800905:	89 d6                	mov    %edx,%esi
+  800907:	09 fe                	or     %edi,%esi
+  800909:	09 ce                	or     %ecx,%esi
+  80090b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800911:	75 0e                	jne    800921 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800913:	83 ef 04             	sub    $0x4,%edi
+  800916:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800919:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80091c:	fd                   	std
+  80091d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80091f:	eb 09                	jmp    80092a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800921:	83 ef 01             	sub    $0x1,%edi
+  800924:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800927:	fd                   	std
+  800928:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80092a:	fc                   	cld
+  80092b:	eb 1a                	jmp    800947 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80092d:	89 f2                	mov    %esi,%edx
+  80092f:	09 c2                	or     %eax,%edx
+  800931:	09 ca                	or     %ecx,%edx
+  800933:	f6 c2 03             	test   $0x3,%dl
+  800936:	75 0a                	jne    800942 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800938:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80093b:	89 c7                	mov    %eax,%edi
+  80093d:	fc                   	cld
+  80093e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800940:	eb 05                	jmp    800947 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800942:	89 c7                	mov    %eax,%edi
+  800944:	fc                   	cld
+  800945:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800947:	5e                   	pop    %esi
+  800948:	5f                   	pop    %edi
+  800949:	5d                   	pop    %ebp
+  80094a:	c3                   	ret
+
+0080094b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80094b:	55                   	push   %ebp
+  80094c:	89 e5                	mov    %esp,%ebp
+  80094e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800951:	ff 75 10             	push   0x10(%ebp)
+  800954:	ff 75 0c             	push   0xc(%ebp)
+  800957:	ff 75 08             	push   0x8(%ebp)
+  80095a:	e8 8a ff ff ff       	call   8008e9 <memmove>
+}
+  80095f:	c9                   	leave
+  800960:	c3                   	ret
+
+00800961 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800961:	55                   	push   %ebp
+  800962:	89 e5                	mov    %esp,%ebp
+  800964:	56                   	push   %esi
+  800965:	53                   	push   %ebx
+  800966:	8b 45 08             	mov    0x8(%ebp),%eax
+  800969:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80096c:	89 c6                	mov    %eax,%esi
+  80096e:	03 75 10             	add    0x10(%ebp),%esi
+  800971:	eb 06                	jmp    800979 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800973:	83 c0 01             	add    $0x1,%eax
+  800976:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800979:	39 f0                	cmp    %esi,%eax
+  80097b:	74 14                	je     800991 <memcmp+0x30>
+		if (*s1 != *s2)
+  80097d:	0f b6 08             	movzbl (%eax),%ecx
+  800980:	0f b6 1a             	movzbl (%edx),%ebx
+  800983:	38 d9                	cmp    %bl,%cl
+  800985:	74 ec                	je     800973 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800987:	0f b6 c1             	movzbl %cl,%eax
+  80098a:	0f b6 db             	movzbl %bl,%ebx
+  80098d:	29 d8                	sub    %ebx,%eax
+  80098f:	eb 05                	jmp    800996 <memcmp+0x35>
+	}
+
+	return 0;
+  800991:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800996:	5b                   	pop    %ebx
+  800997:	5e                   	pop    %esi
+  800998:	5d                   	pop    %ebp
+  800999:	c3                   	ret
+
+0080099a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80099a:	55                   	push   %ebp
+  80099b:	89 e5                	mov    %esp,%ebp
+  80099d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009a3:	89 c2                	mov    %eax,%edx
+  8009a5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009a8:	eb 03                	jmp    8009ad <memfind+0x13>
+  8009aa:	83 c0 01             	add    $0x1,%eax
+  8009ad:	39 d0                	cmp    %edx,%eax
+  8009af:	73 04                	jae    8009b5 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009b1:	38 08                	cmp    %cl,(%eax)
+  8009b3:	75 f5                	jne    8009aa <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009b5:	5d                   	pop    %ebp
+  8009b6:	c3                   	ret
+
+008009b7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009b7:	55                   	push   %ebp
+  8009b8:	89 e5                	mov    %esp,%ebp
+  8009ba:	57                   	push   %edi
+  8009bb:	56                   	push   %esi
+  8009bc:	53                   	push   %ebx
+  8009bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009c3:	eb 03                	jmp    8009c8 <strtol+0x11>
+		s++;
+  8009c5:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009c8:	0f b6 02             	movzbl (%edx),%eax
+  8009cb:	3c 20                	cmp    $0x20,%al
+  8009cd:	74 f6                	je     8009c5 <strtol+0xe>
+  8009cf:	3c 09                	cmp    $0x9,%al
+  8009d1:	74 f2                	je     8009c5 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009d3:	3c 2b                	cmp    $0x2b,%al
+  8009d5:	74 2a                	je     800a01 <strtol+0x4a>
+	int neg = 0;
+  8009d7:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009dc:	3c 2d                	cmp    $0x2d,%al
+  8009de:	74 2b                	je     800a0b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009e0:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009e6:	75 0f                	jne    8009f7 <strtol+0x40>
+  8009e8:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009eb:	74 28                	je     800a15 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009ed:	85 db                	test   %ebx,%ebx
+  8009ef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009f4:	0f 44 d8             	cmove  %eax,%ebx
+  8009f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009fc:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009ff:	eb 46                	jmp    800a47 <strtol+0x90>
+		s++;
+  800a01:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a04:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a09:	eb d5                	jmp    8009e0 <strtol+0x29>
+		s++, neg = 1;
+  800a0b:	83 c2 01             	add    $0x1,%edx
+  800a0e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a13:	eb cb                	jmp    8009e0 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a15:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a19:	74 0e                	je     800a29 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a1b:	85 db                	test   %ebx,%ebx
+  800a1d:	75 d8                	jne    8009f7 <strtol+0x40>
+		s++, base = 8;
+  800a1f:	83 c2 01             	add    $0x1,%edx
+  800a22:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a27:	eb ce                	jmp    8009f7 <strtol+0x40>
+		s += 2, base = 16;
+  800a29:	83 c2 02             	add    $0x2,%edx
+  800a2c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a31:	eb c4                	jmp    8009f7 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a33:	0f be c0             	movsbl %al,%eax
+  800a36:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a39:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a3c:	7d 3a                	jge    800a78 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a3e:	83 c2 01             	add    $0x1,%edx
+  800a41:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a45:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a47:	0f b6 02             	movzbl (%edx),%eax
+  800a4a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a4d:	89 f3                	mov    %esi,%ebx
+  800a4f:	80 fb 09             	cmp    $0x9,%bl
+  800a52:	76 df                	jbe    800a33 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a54:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a57:	89 f3                	mov    %esi,%ebx
+  800a59:	80 fb 19             	cmp    $0x19,%bl
+  800a5c:	77 08                	ja     800a66 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a5e:	0f be c0             	movsbl %al,%eax
+  800a61:	83 e8 57             	sub    $0x57,%eax
+  800a64:	eb d3                	jmp    800a39 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a66:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a69:	89 f3                	mov    %esi,%ebx
+  800a6b:	80 fb 19             	cmp    $0x19,%bl
+  800a6e:	77 08                	ja     800a78 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a70:	0f be c0             	movsbl %al,%eax
+  800a73:	83 e8 37             	sub    $0x37,%eax
+  800a76:	eb c1                	jmp    800a39 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a78:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a7c:	74 05                	je     800a83 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a81:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a83:	89 c8                	mov    %ecx,%eax
+  800a85:	f7 d8                	neg    %eax
+  800a87:	85 ff                	test   %edi,%edi
+  800a89:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a8c:	89 c8                	mov    %ecx,%eax
+  800a8e:	5b                   	pop    %ebx
+  800a8f:	5e                   	pop    %esi
+  800a90:	5f                   	pop    %edi
+  800a91:	5d                   	pop    %ebp
+  800a92:	c3                   	ret
+
+00800a93 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a93:	55                   	push   %ebp
+  800a94:	89 e5                	mov    %esp,%ebp
+  800a96:	57                   	push   %edi
+  800a97:	56                   	push   %esi
+  800a98:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aa1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aa4:	89 c3                	mov    %eax,%ebx
+  800aa6:	89 c7                	mov    %eax,%edi
+  800aa8:	89 c6                	mov    %eax,%esi
+  800aaa:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800aac:	5b                   	pop    %ebx
+  800aad:	5e                   	pop    %esi
+  800aae:	5f                   	pop    %edi
+  800aaf:	5d                   	pop    %ebp
+  800ab0:	c3                   	ret
+
+00800ab1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	57                   	push   %edi
+  800ab5:	56                   	push   %esi
+  800ab6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ab7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800abc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ac1:	89 d1                	mov    %edx,%ecx
+  800ac3:	89 d3                	mov    %edx,%ebx
+  800ac5:	89 d7                	mov    %edx,%edi
+  800ac7:	89 d6                	mov    %edx,%esi
+  800ac9:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800acb:	5b                   	pop    %ebx
+  800acc:	5e                   	pop    %esi
+  800acd:	5f                   	pop    %edi
+  800ace:	5d                   	pop    %ebp
+  800acf:	c3                   	ret
+
+00800ad0 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800ad0:	55                   	push   %ebp
+  800ad1:	89 e5                	mov    %esp,%ebp
+  800ad3:	57                   	push   %edi
+  800ad4:	56                   	push   %esi
+  800ad5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ad6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800adb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ade:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ae3:	89 cb                	mov    %ecx,%ebx
+  800ae5:	89 cf                	mov    %ecx,%edi
+  800ae7:	89 ce                	mov    %ecx,%esi
+  800ae9:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800aeb:	5b                   	pop    %ebx
+  800aec:	5e                   	pop    %esi
+  800aed:	5f                   	pop    %edi
+  800aee:	5d                   	pop    %ebp
+  800aef:	c3                   	ret
+
+00800af0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800af0:	55                   	push   %ebp
+  800af1:	89 e5                	mov    %esp,%ebp
+  800af3:	57                   	push   %edi
+  800af4:	56                   	push   %esi
+  800af5:	53                   	push   %ebx
+  800af6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800af9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800afe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b01:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b06:	89 cb                	mov    %ecx,%ebx
+  800b08:	89 cf                	mov    %ecx,%edi
+  800b0a:	89 ce                	mov    %ecx,%esi
+  800b0c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b0e:	85 c0                	test   %eax,%eax
+  800b10:	7f 08                	jg     800b1a <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b15:	5b                   	pop    %ebx
+  800b16:	5e                   	pop    %esi
+  800b17:	5f                   	pop    %edi
+  800b18:	5d                   	pop    %ebp
+  800b19:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b1a:	83 ec 0c             	sub    $0xc,%esp
+  800b1d:	50                   	push   %eax
+  800b1e:	6a 03                	push   $0x3
+  800b20:	68 5f 2a 80 00       	push   $0x802a5f
+  800b25:	6a 23                	push   $0x23
+  800b27:	68 7c 2a 80 00       	push   $0x802a7c
+  800b2c:	e8 66 16 00 00       	call   802197 <_panic>
+
+00800b31 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	57                   	push   %edi
+  800b35:	56                   	push   %esi
+  800b36:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b37:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b3c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b41:	89 d1                	mov    %edx,%ecx
+  800b43:	89 d3                	mov    %edx,%ebx
+  800b45:	89 d7                	mov    %edx,%edi
+  800b47:	89 d6                	mov    %edx,%esi
+  800b49:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b4b:	5b                   	pop    %ebx
+  800b4c:	5e                   	pop    %esi
+  800b4d:	5f                   	pop    %edi
+  800b4e:	5d                   	pop    %ebp
+  800b4f:	c3                   	ret
+
+00800b50 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b50:	55                   	push   %ebp
+  800b51:	89 e5                	mov    %esp,%ebp
+  800b53:	57                   	push   %edi
+  800b54:	56                   	push   %esi
+  800b55:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b5b:	b8 16 00 00 00       	mov    $0x16,%eax
+  800b60:	89 d1                	mov    %edx,%ecx
+  800b62:	89 d3                	mov    %edx,%ebx
+  800b64:	89 d7                	mov    %edx,%edi
+  800b66:	89 d6                	mov    %edx,%esi
+  800b68:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b6a:	5b                   	pop    %ebx
+  800b6b:	5e                   	pop    %esi
+  800b6c:	5f                   	pop    %edi
+  800b6d:	5d                   	pop    %ebp
+  800b6e:	c3                   	ret
+
+00800b6f <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800b6f:	55                   	push   %ebp
+  800b70:	89 e5                	mov    %esp,%ebp
+  800b72:	57                   	push   %edi
+  800b73:	56                   	push   %esi
+  800b74:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800b7f:	89 d1                	mov    %edx,%ecx
+  800b81:	89 d3                	mov    %edx,%ebx
+  800b83:	89 d7                	mov    %edx,%edi
+  800b85:	89 d6                	mov    %edx,%esi
+  800b87:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800b89:	5b                   	pop    %ebx
+  800b8a:	5e                   	pop    %esi
+  800b8b:	5f                   	pop    %edi
+  800b8c:	5d                   	pop    %ebp
+  800b8d:	c3                   	ret
+
+00800b8e <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	57                   	push   %edi
+  800b92:	56                   	push   %esi
+  800b93:	53                   	push   %ebx
+  800b94:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba2:	b8 15 00 00 00       	mov    $0x15,%eax
+  800ba7:	89 df                	mov    %ebx,%edi
+  800ba9:	89 de                	mov    %ebx,%esi
+  800bab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bad:	85 c0                	test   %eax,%eax
+  800baf:	7f 08                	jg     800bb9 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800bb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb4:	5b                   	pop    %ebx
+  800bb5:	5e                   	pop    %esi
+  800bb6:	5f                   	pop    %edi
+  800bb7:	5d                   	pop    %ebp
+  800bb8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bb9:	83 ec 0c             	sub    $0xc,%esp
+  800bbc:	50                   	push   %eax
+  800bbd:	6a 15                	push   $0x15
+  800bbf:	68 5f 2a 80 00       	push   $0x802a5f
+  800bc4:	6a 23                	push   $0x23
+  800bc6:	68 7c 2a 80 00       	push   $0x802a7c
+  800bcb:	e8 c7 15 00 00       	call   802197 <_panic>
+
+00800bd0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bd0:	55                   	push   %ebp
+  800bd1:	89 e5                	mov    %esp,%ebp
+  800bd3:	57                   	push   %edi
+  800bd4:	56                   	push   %esi
+  800bd5:	53                   	push   %ebx
+  800bd6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bd9:	be 00 00 00 00       	mov    $0x0,%esi
+  800bde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800be9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bec:	89 f7                	mov    %esi,%edi
+  800bee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bf0:	85 c0                	test   %eax,%eax
+  800bf2:	7f 08                	jg     800bfc <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bf4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bf7:	5b                   	pop    %ebx
+  800bf8:	5e                   	pop    %esi
+  800bf9:	5f                   	pop    %edi
+  800bfa:	5d                   	pop    %ebp
+  800bfb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bfc:	83 ec 0c             	sub    $0xc,%esp
+  800bff:	50                   	push   %eax
+  800c00:	6a 05                	push   $0x5
+  800c02:	68 5f 2a 80 00       	push   $0x802a5f
+  800c07:	6a 23                	push   $0x23
+  800c09:	68 7c 2a 80 00       	push   $0x802a7c
+  800c0e:	e8 84 15 00 00       	call   802197 <_panic>
+
+00800c13 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	57                   	push   %edi
+  800c17:	56                   	push   %esi
+  800c18:	53                   	push   %ebx
+  800c19:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c1c:	be 00 00 00 00       	mov    $0x0,%esi
+  800c21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c27:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c2f:	89 f7                	mov    %esi,%edi
+  800c31:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c33:	85 c0                	test   %eax,%eax
+  800c35:	7f 08                	jg     800c3f <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c3a:	5b                   	pop    %ebx
+  800c3b:	5e                   	pop    %esi
+  800c3c:	5f                   	pop    %edi
+  800c3d:	5d                   	pop    %ebp
+  800c3e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c3f:	83 ec 0c             	sub    $0xc,%esp
+  800c42:	50                   	push   %eax
+  800c43:	6a 06                	push   $0x6
+  800c45:	68 5f 2a 80 00       	push   $0x802a5f
+  800c4a:	6a 23                	push   $0x23
+  800c4c:	68 7c 2a 80 00       	push   $0x802a7c
+  800c51:	e8 41 15 00 00       	call   802197 <_panic>
+
+00800c56 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c56:	55                   	push   %ebp
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	57                   	push   %edi
+  800c5a:	56                   	push   %esi
+  800c5b:	53                   	push   %ebx
+  800c5c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c65:	b8 07 00 00 00       	mov    $0x7,%eax
+  800c6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c6d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c70:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c73:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c75:	85 c0                	test   %eax,%eax
+  800c77:	7f 08                	jg     800c81 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c7c:	5b                   	pop    %ebx
+  800c7d:	5e                   	pop    %esi
+  800c7e:	5f                   	pop    %edi
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c81:	83 ec 0c             	sub    $0xc,%esp
+  800c84:	50                   	push   %eax
+  800c85:	6a 07                	push   $0x7
+  800c87:	68 5f 2a 80 00       	push   $0x802a5f
+  800c8c:	6a 23                	push   $0x23
+  800c8e:	68 7c 2a 80 00       	push   $0x802a7c
+  800c93:	e8 ff 14 00 00       	call   802197 <_panic>
+
+00800c98 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c98:	55                   	push   %ebp
+  800c99:	89 e5                	mov    %esp,%ebp
+  800c9b:	57                   	push   %edi
+  800c9c:	56                   	push   %esi
+  800c9d:	53                   	push   %ebx
+  800c9e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ca1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ca6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cac:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cb1:	89 df                	mov    %ebx,%edi
+  800cb3:	89 de                	mov    %ebx,%esi
+  800cb5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cb7:	85 c0                	test   %eax,%eax
+  800cb9:	7f 08                	jg     800cc3 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbe:	5b                   	pop    %ebx
+  800cbf:	5e                   	pop    %esi
+  800cc0:	5f                   	pop    %edi
+  800cc1:	5d                   	pop    %ebp
+  800cc2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc3:	83 ec 0c             	sub    $0xc,%esp
+  800cc6:	50                   	push   %eax
+  800cc7:	6a 08                	push   $0x8
+  800cc9:	68 5f 2a 80 00       	push   $0x802a5f
+  800cce:	6a 23                	push   $0x23
+  800cd0:	68 7c 2a 80 00       	push   $0x802a7c
+  800cd5:	e8 bd 14 00 00       	call   802197 <_panic>
+
+00800cda <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800cda:	55                   	push   %ebp
+  800cdb:	89 e5                	mov    %esp,%ebp
+  800cdd:	57                   	push   %edi
+  800cde:	56                   	push   %esi
+  800cdf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ce0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce6:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ceb:	be 00 00 00 00       	mov    $0x0,%esi
+  800cf0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cf3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cf6:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800cf8:	5b                   	pop    %ebx
+  800cf9:	5e                   	pop    %esi
+  800cfa:	5f                   	pop    %edi
+  800cfb:	5d                   	pop    %ebp
+  800cfc:	c3                   	ret
+
+00800cfd <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800cfd:	55                   	push   %ebp
+  800cfe:	89 e5                	mov    %esp,%ebp
+  800d00:	57                   	push   %edi
+  800d01:	56                   	push   %esi
+  800d02:	53                   	push   %ebx
+  800d03:	8b 45 18             	mov    0x18(%ebp),%eax
+  800d06:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800d09:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800d0e:	77 27                	ja     800d37 <sys_page_map_range+0x3a>
+  800d10:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800d16:	77 1f                	ja     800d37 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800d18:	c1 e0 0c             	shl    $0xc,%eax
+  800d1b:	89 c6                	mov    %eax,%esi
+  800d1d:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800d1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d25:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d2d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d30:	cd 30                	int    $0x30
+}
+  800d32:	5b                   	pop    %ebx
+  800d33:	5e                   	pop    %esi
+  800d34:	5f                   	pop    %edi
+  800d35:	5d                   	pop    %ebp
+  800d36:	c3                   	ret
+		return -E_INVAL;
+  800d37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d3c:	eb f4                	jmp    800d32 <sys_page_map_range+0x35>
+
+00800d3e <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	57                   	push   %edi
+  800d42:	56                   	push   %esi
+  800d43:	53                   	push   %ebx
+  800d44:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d52:	be 00 00 00 00       	mov    $0x0,%esi
+  800d57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d5a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d5d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d5f:	85 c0                	test   %eax,%eax
+  800d61:	7f 08                	jg     800d6b <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800d63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d66:	5b                   	pop    %ebx
+  800d67:	5e                   	pop    %esi
+  800d68:	5f                   	pop    %edi
+  800d69:	5d                   	pop    %ebp
+  800d6a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6b:	83 ec 0c             	sub    $0xc,%esp
+  800d6e:	50                   	push   %eax
+  800d6f:	6a 0c                	push   $0xc
+  800d71:	68 5f 2a 80 00       	push   $0x802a5f
+  800d76:	6a 23                	push   $0x23
+  800d78:	68 7c 2a 80 00       	push   $0x802a7c
+  800d7d:	e8 15 14 00 00       	call   802197 <_panic>
+
+00800d82 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800d82:	55                   	push   %ebp
+  800d83:	89 e5                	mov    %esp,%ebp
+  800d85:	57                   	push   %edi
+  800d86:	56                   	push   %esi
+  800d87:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d88:	be 00 00 00 00       	mov    $0x0,%esi
+  800d8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d93:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9b:	89 f7                	mov    %esi,%edi
+  800d9d:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800d9f:	5b                   	pop    %ebx
+  800da0:	5e                   	pop    %esi
+  800da1:	5f                   	pop    %edi
+  800da2:	5d                   	pop    %ebp
+  800da3:	c3                   	ret
+
+00800da4 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	57                   	push   %edi
+  800da8:	56                   	push   %esi
+  800da9:	53                   	push   %ebx
+  800daa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dbd:	89 df                	mov    %ebx,%edi
+  800dbf:	89 de                	mov    %ebx,%esi
+  800dc1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc3:	85 c0                	test   %eax,%eax
+  800dc5:	7f 08                	jg     800dcf <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800dc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dca:	5b                   	pop    %ebx
+  800dcb:	5e                   	pop    %esi
+  800dcc:	5f                   	pop    %edi
+  800dcd:	5d                   	pop    %ebp
+  800dce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dcf:	83 ec 0c             	sub    $0xc,%esp
+  800dd2:	50                   	push   %eax
+  800dd3:	6a 0f                	push   $0xf
+  800dd5:	68 5f 2a 80 00       	push   $0x802a5f
+  800dda:	6a 23                	push   $0x23
+  800ddc:	68 7c 2a 80 00       	push   $0x802a7c
+  800de1:	e8 b1 13 00 00       	call   802197 <_panic>
+
+00800de6 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800de6:	55                   	push   %ebp
+  800de7:	89 e5                	mov    %esp,%ebp
+  800de9:	57                   	push   %edi
+  800dea:	56                   	push   %esi
+  800deb:	53                   	push   %ebx
+  800dec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800def:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfa:	b8 10 00 00 00       	mov    $0x10,%eax
+  800dff:	89 df                	mov    %ebx,%edi
+  800e01:	89 de                	mov    %ebx,%esi
+  800e03:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e05:	85 c0                	test   %eax,%eax
+  800e07:	7f 08                	jg     800e11 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800e09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5f                   	pop    %edi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e11:	83 ec 0c             	sub    $0xc,%esp
+  800e14:	50                   	push   %eax
+  800e15:	6a 10                	push   $0x10
+  800e17:	68 5f 2a 80 00       	push   $0x802a5f
+  800e1c:	6a 23                	push   $0x23
+  800e1e:	68 7c 2a 80 00       	push   $0x802a7c
+  800e23:	e8 6f 13 00 00       	call   802197 <_panic>
+
+00800e28 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800e28:	55                   	push   %ebp
+  800e29:	89 e5                	mov    %esp,%ebp
+  800e2b:	57                   	push   %edi
+  800e2c:	56                   	push   %esi
+  800e2d:	53                   	push   %ebx
+  800e2e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e41:	89 df                	mov    %ebx,%edi
+  800e43:	89 de                	mov    %ebx,%esi
+  800e45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	7f 08                	jg     800e53 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  800e56:	50                   	push   %eax
+  800e57:	6a 11                	push   $0x11
+  800e59:	68 5f 2a 80 00       	push   $0x802a5f
+  800e5e:	6a 23                	push   $0x23
+  800e60:	68 7c 2a 80 00       	push   $0x802a7c
+  800e65:	e8 2d 13 00 00       	call   802197 <_panic>
+
+00800e6a <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	57                   	push   %edi
+  800e6e:	56                   	push   %esi
+  800e6f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e75:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e7a:	89 d1                	mov    %edx,%ecx
+  800e7c:	89 d3                	mov    %edx,%ebx
+  800e7e:	89 d7                	mov    %edx,%edi
+  800e80:	89 d6                	mov    %edx,%esi
+  800e82:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800e84:	5b                   	pop    %ebx
+  800e85:	5e                   	pop    %esi
+  800e86:	5f                   	pop    %edi
+  800e87:	5d                   	pop    %ebp
+  800e88:	c3                   	ret
+
+00800e89 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	57                   	push   %edi
+  800e8d:	56                   	push   %esi
+  800e8e:	53                   	push   %ebx
+  800e8f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9d:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ea2:	89 df                	mov    %ebx,%edi
+  800ea4:	89 de                	mov    %ebx,%esi
+  800ea6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea8:	85 c0                	test   %eax,%eax
+  800eaa:	7f 08                	jg     800eb4 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800eac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eaf:	5b                   	pop    %ebx
+  800eb0:	5e                   	pop    %esi
+  800eb1:	5f                   	pop    %edi
+  800eb2:	5d                   	pop    %ebp
+  800eb3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb4:	83 ec 0c             	sub    $0xc,%esp
+  800eb7:	50                   	push   %eax
+  800eb8:	6a 13                	push   $0x13
+  800eba:	68 5f 2a 80 00       	push   $0x802a5f
+  800ebf:	6a 23                	push   $0x23
+  800ec1:	68 7c 2a 80 00       	push   $0x802a7c
+  800ec6:	e8 cc 12 00 00       	call   802197 <_panic>
+
+00800ecb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ecb:	55                   	push   %ebp
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	57                   	push   %edi
+  800ecf:	56                   	push   %esi
+  800ed0:	53                   	push   %ebx
+  800ed1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edf:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ee4:	89 df                	mov    %ebx,%edi
+  800ee6:	89 de                	mov    %ebx,%esi
+  800ee8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eea:	85 c0                	test   %eax,%eax
+  800eec:	7f 08                	jg     800ef6 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800eee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef1:	5b                   	pop    %ebx
+  800ef2:	5e                   	pop    %esi
+  800ef3:	5f                   	pop    %edi
+  800ef4:	5d                   	pop    %ebp
+  800ef5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef6:	83 ec 0c             	sub    $0xc,%esp
+  800ef9:	50                   	push   %eax
+  800efa:	6a 14                	push   $0x14
+  800efc:	68 5f 2a 80 00       	push   $0x802a5f
+  800f01:	6a 23                	push   $0x23
+  800f03:	68 7c 2a 80 00       	push   $0x802a7c
+  800f08:	e8 8a 12 00 00       	call   802197 <_panic>
+
+00800f0d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f0d:	55                   	push   %ebp
+  800f0e:	89 e5                	mov    %esp,%ebp
+  800f10:	57                   	push   %edi
+  800f11:	56                   	push   %esi
+  800f12:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f19:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f1e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f26:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f29:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f2b:	5b                   	pop    %ebx
+  800f2c:	5e                   	pop    %esi
+  800f2d:	5f                   	pop    %edi
+  800f2e:	5d                   	pop    %ebp
+  800f2f:	c3                   	ret
+
+00800f30 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	56                   	push   %esi
+  800f35:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3c:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f41:	be 00 00 00 00       	mov    $0x0,%esi
+  800f46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f49:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f4c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5e                   	pop    %esi
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+
+00800f53 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f53:	55                   	push   %ebp
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	57                   	push   %edi
+  800f57:	56                   	push   %esi
+  800f58:	53                   	push   %ebx
+  800f59:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f64:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f69:	89 cb                	mov    %ecx,%ebx
+  800f6b:	89 cf                	mov    %ecx,%edi
+  800f6d:	89 ce                	mov    %ecx,%esi
+  800f6f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f71:	85 c0                	test   %eax,%eax
+  800f73:	7f 08                	jg     800f7d <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f78:	5b                   	pop    %ebx
+  800f79:	5e                   	pop    %esi
+  800f7a:	5f                   	pop    %edi
+  800f7b:	5d                   	pop    %ebp
+  800f7c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f7d:	83 ec 0c             	sub    $0xc,%esp
+  800f80:	50                   	push   %eax
+  800f81:	6a 19                	push   $0x19
+  800f83:	68 5f 2a 80 00       	push   $0x802a5f
+  800f88:	6a 23                	push   $0x23
+  800f8a:	68 7c 2a 80 00       	push   $0x802a7c
+  800f8f:	e8 03 12 00 00       	call   802197 <_panic>
+
+00800f94 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	57                   	push   %edi
+  800f98:	56                   	push   %esi
+  800f99:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f9f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fa4:	89 d1                	mov    %edx,%ecx
+  800fa6:	89 d3                	mov    %edx,%ebx
+  800fa8:	89 d7                	mov    %edx,%edi
+  800faa:	89 d6                	mov    %edx,%esi
+  800fac:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fae:	5b                   	pop    %ebx
+  800faf:	5e                   	pop    %esi
+  800fb0:	5f                   	pop    %edi
+  800fb1:	5d                   	pop    %ebp
+  800fb2:	c3                   	ret
+
+00800fb3 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	57                   	push   %edi
+  800fb7:	56                   	push   %esi
+  800fb8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fc9:	89 df                	mov    %ebx,%edi
+  800fcb:	89 de                	mov    %ebx,%esi
+  800fcd:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  800fcf:	5b                   	pop    %ebx
+  800fd0:	5e                   	pop    %esi
+  800fd1:	5f                   	pop    %edi
+  800fd2:	5d                   	pop    %ebp
+  800fd3:	c3                   	ret
+
+00800fd4 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  800fd4:	55                   	push   %ebp
+  800fd5:	89 e5                	mov    %esp,%ebp
+  800fd7:	57                   	push   %edi
+  800fd8:	56                   	push   %esi
+  800fd9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800fea:	89 df                	mov    %ebx,%edi
+  800fec:	89 de                	mov    %ebx,%esi
+  800fee:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5f                   	pop    %edi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+
+00800ff5 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  800ffb:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801002:	74 0a                	je     80100e <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801004:	8b 45 08             	mov    0x8(%ebp),%eax
+  801007:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  80100c:	c9                   	leave
+  80100d:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  80100e:	83 ec 04             	sub    $0x4,%esp
+  801011:	6a 07                	push   $0x7
+  801013:	68 00 f0 bf ee       	push   $0xeebff000
+  801018:	6a 00                	push   $0x0
+  80101a:	e8 b1 fb ff ff       	call   800bd0 <sys_page_alloc>
+  80101f:	83 c4 10             	add    $0x10,%esp
+  801022:	85 c0                	test   %eax,%eax
+  801024:	78 28                	js     80104e <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  801026:	83 ec 08             	sub    $0x8,%esp
+  801029:	68 60 10 80 00       	push   $0x801060
+  80102e:	6a 00                	push   $0x0
+  801030:	e8 96 fe ff ff       	call   800ecb <sys_env_set_pgfault_upcall>
+  801035:	83 c4 10             	add    $0x10,%esp
+  801038:	85 c0                	test   %eax,%eax
+  80103a:	79 c8                	jns    801004 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  80103c:	50                   	push   %eax
+  80103d:	68 ab 2a 80 00       	push   $0x802aab
+  801042:	6a 24                	push   $0x24
+  801044:	68 9d 2a 80 00       	push   $0x802a9d
+  801049:	e8 49 11 00 00       	call   802197 <_panic>
+			panic("sys_page_alloc: %e", r);
+  80104e:	50                   	push   %eax
+  80104f:	68 8a 2a 80 00       	push   $0x802a8a
+  801054:	6a 21                	push   $0x21
+  801056:	68 9d 2a 80 00       	push   $0x802a9d
+  80105b:	e8 37 11 00 00       	call   802197 <_panic>
+
+00801060 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801060:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801061:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  801066:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801068:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  80106b:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  80106e:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  801072:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  801075:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  801079:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  80107d:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  80107f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  801080:	83 c4 04             	add    $0x4,%esp
+	popf
+  801083:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  801084:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801085:	c3                   	ret
+
+00801086 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801089:	8b 45 08             	mov    0x8(%ebp),%eax
+  80108c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801091:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801094:	5d                   	pop    %ebp
+  801095:	c3                   	ret
+
+00801096 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801096:	55                   	push   %ebp
+  801097:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801099:	8b 45 08             	mov    0x8(%ebp),%eax
+  80109c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8010a1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8010a6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8010ab:	5d                   	pop    %ebp
+  8010ac:	c3                   	ret
+
+008010ad <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8010b0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8010b5:	eb 02                	jmp    8010b9 <fd_alloc+0xc>
+  8010b7:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8010b9:	89 c2                	mov    %eax,%edx
+  8010bb:	c1 ea 16             	shr    $0x16,%edx
+  8010be:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010c5:	f6 c2 01             	test   $0x1,%dl
+  8010c8:	74 2b                	je     8010f5 <fd_alloc+0x48>
+  8010ca:	89 c2                	mov    %eax,%edx
+  8010cc:	c1 ea 0c             	shr    $0xc,%edx
+  8010cf:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8010d6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010dc:	f6 c1 01             	test   $0x1,%cl
+  8010df:	74 14                	je     8010f5 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8010e1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010e7:	75 ce                	jne    8010b7 <fd_alloc+0xa>
+  8010e9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8010ee:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8010f3:	eb 05                	jmp    8010fa <fd_alloc+0x4d>
+			return 0;
+  8010f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8010fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fd:	89 02                	mov    %eax,(%edx)
+}
+  8010ff:	89 c8                	mov    %ecx,%eax
+  801101:	5d                   	pop    %ebp
+  801102:	c3                   	ret
+
+00801103 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801103:	55                   	push   %ebp
+  801104:	89 e5                	mov    %esp,%ebp
+  801106:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801109:	83 f8 1f             	cmp    $0x1f,%eax
+  80110c:	77 30                	ja     80113e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80110e:	c1 e0 0c             	shl    $0xc,%eax
+  801111:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801116:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80111c:	f6 c2 01             	test   $0x1,%dl
+  80111f:	74 24                	je     801145 <fd_lookup+0x42>
+  801121:	89 c2                	mov    %eax,%edx
+  801123:	c1 ea 0c             	shr    $0xc,%edx
+  801126:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80112d:	f6 c2 01             	test   $0x1,%dl
+  801130:	74 1a                	je     80114c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801132:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801135:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801137:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80113c:	5d                   	pop    %ebp
+  80113d:	c3                   	ret
+		return -E_INVAL;
+  80113e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801143:	eb f7                	jmp    80113c <fd_lookup+0x39>
+		return -E_INVAL;
+  801145:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80114a:	eb f0                	jmp    80113c <fd_lookup+0x39>
+  80114c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801151:	eb e9                	jmp    80113c <fd_lookup+0x39>
+
+00801153 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801153:	55                   	push   %ebp
+  801154:	89 e5                	mov    %esp,%ebp
+  801156:	53                   	push   %ebx
+  801157:	83 ec 04             	sub    $0x4,%esp
+  80115a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80115d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801162:	eb 03                	jmp    801167 <dev_lookup+0x14>
+  801164:	83 c0 01             	add    $0x1,%eax
+  801167:	8b 1c 85 48 2b 80 00 	mov    0x802b48(,%eax,4),%ebx
+  80116e:	85 db                	test   %ebx,%ebx
+  801170:	74 0b                	je     80117d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801172:	39 13                	cmp    %edx,(%ebx)
+  801174:	75 ee                	jne    801164 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117b:	eb 1f                	jmp    80119c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80117d:	a1 08 40 80 00       	mov    0x804008,%eax
+  801182:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801185:	83 ec 04             	sub    $0x4,%esp
+  801188:	52                   	push   %edx
+  801189:	50                   	push   %eax
+  80118a:	68 cc 2a 80 00       	push   $0x802acc
+  80118f:	e8 e1 ef ff ff       	call   800175 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801194:	83 c4 10             	add    $0x10,%esp
+  801197:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80119c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80119f:	89 1a                	mov    %ebx,(%edx)
+}
+  8011a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011a4:	c9                   	leave
+  8011a5:	c3                   	ret
+
+008011a6 <fd_close>:
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	57                   	push   %edi
+  8011aa:	56                   	push   %esi
+  8011ab:	53                   	push   %ebx
+  8011ac:	83 ec 24             	sub    $0x24,%esp
+  8011af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011b2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011b5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011b8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011b9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011bf:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011c2:	50                   	push   %eax
+  8011c3:	e8 3b ff ff ff       	call   801103 <fd_lookup>
+  8011c8:	89 c3                	mov    %eax,%ebx
+  8011ca:	83 c4 10             	add    $0x10,%esp
+  8011cd:	85 c0                	test   %eax,%eax
+  8011cf:	78 05                	js     8011d6 <fd_close+0x30>
+	    || fd != fd2)
+  8011d1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011d4:	74 16                	je     8011ec <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8011d6:	89 f8                	mov    %edi,%eax
+  8011d8:	84 c0                	test   %al,%al
+  8011da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011df:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8011e2:	89 d8                	mov    %ebx,%eax
+  8011e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e7:	5b                   	pop    %ebx
+  8011e8:	5e                   	pop    %esi
+  8011e9:	5f                   	pop    %edi
+  8011ea:	5d                   	pop    %ebp
+  8011eb:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8011ec:	83 ec 08             	sub    $0x8,%esp
+  8011ef:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8011f2:	50                   	push   %eax
+  8011f3:	ff 36                	push   (%esi)
+  8011f5:	e8 59 ff ff ff       	call   801153 <dev_lookup>
+  8011fa:	89 c3                	mov    %eax,%ebx
+  8011fc:	83 c4 10             	add    $0x10,%esp
+  8011ff:	85 c0                	test   %eax,%eax
+  801201:	78 1a                	js     80121d <fd_close+0x77>
+		if (dev->dev_close)
+  801203:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801206:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801209:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80120e:	85 c0                	test   %eax,%eax
+  801210:	74 0b                	je     80121d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801212:	83 ec 0c             	sub    $0xc,%esp
+  801215:	56                   	push   %esi
+  801216:	ff d0                	call   *%eax
+  801218:	89 c3                	mov    %eax,%ebx
+  80121a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80121d:	83 ec 08             	sub    $0x8,%esp
+  801220:	56                   	push   %esi
+  801221:	6a 00                	push   $0x0
+  801223:	e8 70 fa ff ff       	call   800c98 <sys_page_unmap>
+	return r;
+  801228:	83 c4 10             	add    $0x10,%esp
+  80122b:	eb b5                	jmp    8011e2 <fd_close+0x3c>
+
+0080122d <close>:
+
+int
+close(int fdnum)
+{
+  80122d:	55                   	push   %ebp
+  80122e:	89 e5                	mov    %esp,%ebp
+  801230:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801233:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801236:	50                   	push   %eax
+  801237:	ff 75 08             	push   0x8(%ebp)
+  80123a:	e8 c4 fe ff ff       	call   801103 <fd_lookup>
+  80123f:	83 c4 10             	add    $0x10,%esp
+  801242:	85 c0                	test   %eax,%eax
+  801244:	79 02                	jns    801248 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801246:	c9                   	leave
+  801247:	c3                   	ret
+		return fd_close(fd, 1);
+  801248:	83 ec 08             	sub    $0x8,%esp
+  80124b:	6a 01                	push   $0x1
+  80124d:	ff 75 f4             	push   -0xc(%ebp)
+  801250:	e8 51 ff ff ff       	call   8011a6 <fd_close>
+  801255:	83 c4 10             	add    $0x10,%esp
+  801258:	eb ec                	jmp    801246 <close+0x19>
+
+0080125a <close_all>:
+
+void
+close_all(void)
+{
+  80125a:	55                   	push   %ebp
+  80125b:	89 e5                	mov    %esp,%ebp
+  80125d:	53                   	push   %ebx
+  80125e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801261:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801266:	83 ec 0c             	sub    $0xc,%esp
+  801269:	53                   	push   %ebx
+  80126a:	e8 be ff ff ff       	call   80122d <close>
+	for (i = 0; i < MAXFD; i++)
+  80126f:	83 c3 01             	add    $0x1,%ebx
+  801272:	83 c4 10             	add    $0x10,%esp
+  801275:	83 fb 20             	cmp    $0x20,%ebx
+  801278:	75 ec                	jne    801266 <close_all+0xc>
+}
+  80127a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80127d:	c9                   	leave
+  80127e:	c3                   	ret
+
+0080127f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80127f:	55                   	push   %ebp
+  801280:	89 e5                	mov    %esp,%ebp
+  801282:	57                   	push   %edi
+  801283:	56                   	push   %esi
+  801284:	53                   	push   %ebx
+  801285:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801288:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80128b:	50                   	push   %eax
+  80128c:	ff 75 08             	push   0x8(%ebp)
+  80128f:	e8 6f fe ff ff       	call   801103 <fd_lookup>
+  801294:	89 c3                	mov    %eax,%ebx
+  801296:	83 c4 10             	add    $0x10,%esp
+  801299:	85 c0                	test   %eax,%eax
+  80129b:	78 7f                	js     80131c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80129d:	83 ec 0c             	sub    $0xc,%esp
+  8012a0:	ff 75 0c             	push   0xc(%ebp)
+  8012a3:	e8 85 ff ff ff       	call   80122d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8012a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8012ab:	c1 e6 0c             	shl    $0xc,%esi
+  8012ae:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8012b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8012b7:	89 3c 24             	mov    %edi,(%esp)
+  8012ba:	e8 d7 fd ff ff       	call   801096 <fd2data>
+  8012bf:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012c1:	89 34 24             	mov    %esi,(%esp)
+  8012c4:	e8 cd fd ff ff       	call   801096 <fd2data>
+  8012c9:	83 c4 10             	add    $0x10,%esp
+  8012cc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012cf:	89 d8                	mov    %ebx,%eax
+  8012d1:	c1 e8 16             	shr    $0x16,%eax
+  8012d4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012db:	a8 01                	test   $0x1,%al
+  8012dd:	74 11                	je     8012f0 <dup+0x71>
+  8012df:	89 d8                	mov    %ebx,%eax
+  8012e1:	c1 e8 0c             	shr    $0xc,%eax
+  8012e4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012eb:	f6 c2 01             	test   $0x1,%dl
+  8012ee:	75 36                	jne    801326 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8012f0:	89 f8                	mov    %edi,%eax
+  8012f2:	c1 e8 0c             	shr    $0xc,%eax
+  8012f5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012fc:	83 ec 0c             	sub    $0xc,%esp
+  8012ff:	25 07 0e 00 00       	and    $0xe07,%eax
+  801304:	50                   	push   %eax
+  801305:	56                   	push   %esi
+  801306:	6a 00                	push   $0x0
+  801308:	57                   	push   %edi
+  801309:	6a 00                	push   $0x0
+  80130b:	e8 46 f9 ff ff       	call   800c56 <sys_page_map>
+  801310:	89 c3                	mov    %eax,%ebx
+  801312:	83 c4 20             	add    $0x20,%esp
+  801315:	85 c0                	test   %eax,%eax
+  801317:	78 33                	js     80134c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801319:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80131c:	89 d8                	mov    %ebx,%eax
+  80131e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801321:	5b                   	pop    %ebx
+  801322:	5e                   	pop    %esi
+  801323:	5f                   	pop    %edi
+  801324:	5d                   	pop    %ebp
+  801325:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801326:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80132d:	83 ec 0c             	sub    $0xc,%esp
+  801330:	25 07 0e 00 00       	and    $0xe07,%eax
+  801335:	50                   	push   %eax
+  801336:	ff 75 d4             	push   -0x2c(%ebp)
+  801339:	6a 00                	push   $0x0
+  80133b:	53                   	push   %ebx
+  80133c:	6a 00                	push   $0x0
+  80133e:	e8 13 f9 ff ff       	call   800c56 <sys_page_map>
+  801343:	89 c3                	mov    %eax,%ebx
+  801345:	83 c4 20             	add    $0x20,%esp
+  801348:	85 c0                	test   %eax,%eax
+  80134a:	79 a4                	jns    8012f0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80134c:	83 ec 08             	sub    $0x8,%esp
+  80134f:	56                   	push   %esi
+  801350:	6a 00                	push   $0x0
+  801352:	e8 41 f9 ff ff       	call   800c98 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801357:	83 c4 08             	add    $0x8,%esp
+  80135a:	ff 75 d4             	push   -0x2c(%ebp)
+  80135d:	6a 00                	push   $0x0
+  80135f:	e8 34 f9 ff ff       	call   800c98 <sys_page_unmap>
+	return r;
+  801364:	83 c4 10             	add    $0x10,%esp
+  801367:	eb b3                	jmp    80131c <dup+0x9d>
+
+00801369 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801369:	55                   	push   %ebp
+  80136a:	89 e5                	mov    %esp,%ebp
+  80136c:	56                   	push   %esi
+  80136d:	53                   	push   %ebx
+  80136e:	83 ec 18             	sub    $0x18,%esp
+  801371:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801374:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801377:	50                   	push   %eax
+  801378:	56                   	push   %esi
+  801379:	e8 85 fd ff ff       	call   801103 <fd_lookup>
+  80137e:	83 c4 10             	add    $0x10,%esp
+  801381:	85 c0                	test   %eax,%eax
+  801383:	78 3c                	js     8013c1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801385:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801388:	83 ec 08             	sub    $0x8,%esp
+  80138b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80138e:	50                   	push   %eax
+  80138f:	ff 33                	push   (%ebx)
+  801391:	e8 bd fd ff ff       	call   801153 <dev_lookup>
+  801396:	83 c4 10             	add    $0x10,%esp
+  801399:	85 c0                	test   %eax,%eax
+  80139b:	78 24                	js     8013c1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80139d:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013a0:	83 e0 03             	and    $0x3,%eax
+  8013a3:	83 f8 01             	cmp    $0x1,%eax
+  8013a6:	74 20                	je     8013c8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8013a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013ab:	8b 40 08             	mov    0x8(%eax),%eax
+  8013ae:	85 c0                	test   %eax,%eax
+  8013b0:	74 37                	je     8013e9 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8013b2:	83 ec 04             	sub    $0x4,%esp
+  8013b5:	ff 75 10             	push   0x10(%ebp)
+  8013b8:	ff 75 0c             	push   0xc(%ebp)
+  8013bb:	53                   	push   %ebx
+  8013bc:	ff d0                	call   *%eax
+  8013be:	83 c4 10             	add    $0x10,%esp
+}
+  8013c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013c4:	5b                   	pop    %ebx
+  8013c5:	5e                   	pop    %esi
+  8013c6:	5d                   	pop    %ebp
+  8013c7:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013c8:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013cd:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8013d0:	83 ec 04             	sub    $0x4,%esp
+  8013d3:	56                   	push   %esi
+  8013d4:	50                   	push   %eax
+  8013d5:	68 0d 2b 80 00       	push   $0x802b0d
+  8013da:	e8 96 ed ff ff       	call   800175 <cprintf>
+		return -E_INVAL;
+  8013df:	83 c4 10             	add    $0x10,%esp
+  8013e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013e7:	eb d8                	jmp    8013c1 <read+0x58>
+		return -E_NOT_SUPP;
+  8013e9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013ee:	eb d1                	jmp    8013c1 <read+0x58>
+
+008013f0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8013f0:	55                   	push   %ebp
+  8013f1:	89 e5                	mov    %esp,%ebp
+  8013f3:	57                   	push   %edi
+  8013f4:	56                   	push   %esi
+  8013f5:	53                   	push   %ebx
+  8013f6:	83 ec 0c             	sub    $0xc,%esp
+  8013f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013fc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8013ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801404:	eb 02                	jmp    801408 <readn+0x18>
+  801406:	01 c3                	add    %eax,%ebx
+  801408:	39 f3                	cmp    %esi,%ebx
+  80140a:	73 21                	jae    80142d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80140c:	83 ec 04             	sub    $0x4,%esp
+  80140f:	89 f0                	mov    %esi,%eax
+  801411:	29 d8                	sub    %ebx,%eax
+  801413:	50                   	push   %eax
+  801414:	89 d8                	mov    %ebx,%eax
+  801416:	03 45 0c             	add    0xc(%ebp),%eax
+  801419:	50                   	push   %eax
+  80141a:	57                   	push   %edi
+  80141b:	e8 49 ff ff ff       	call   801369 <read>
+		if (m < 0)
+  801420:	83 c4 10             	add    $0x10,%esp
+  801423:	85 c0                	test   %eax,%eax
+  801425:	78 04                	js     80142b <readn+0x3b>
+			return m;
+		if (m == 0)
+  801427:	75 dd                	jne    801406 <readn+0x16>
+  801429:	eb 02                	jmp    80142d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80142b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80142d:	89 d8                	mov    %ebx,%eax
+  80142f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801432:	5b                   	pop    %ebx
+  801433:	5e                   	pop    %esi
+  801434:	5f                   	pop    %edi
+  801435:	5d                   	pop    %ebp
+  801436:	c3                   	ret
+
+00801437 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	56                   	push   %esi
+  80143b:	53                   	push   %ebx
+  80143c:	83 ec 18             	sub    $0x18,%esp
+  80143f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801442:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801445:	50                   	push   %eax
+  801446:	53                   	push   %ebx
+  801447:	e8 b7 fc ff ff       	call   801103 <fd_lookup>
+  80144c:	83 c4 10             	add    $0x10,%esp
+  80144f:	85 c0                	test   %eax,%eax
+  801451:	78 37                	js     80148a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801453:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801456:	83 ec 08             	sub    $0x8,%esp
+  801459:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80145c:	50                   	push   %eax
+  80145d:	ff 36                	push   (%esi)
+  80145f:	e8 ef fc ff ff       	call   801153 <dev_lookup>
+  801464:	83 c4 10             	add    $0x10,%esp
+  801467:	85 c0                	test   %eax,%eax
+  801469:	78 1f                	js     80148a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80146b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80146f:	74 20                	je     801491 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801471:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801474:	8b 40 0c             	mov    0xc(%eax),%eax
+  801477:	85 c0                	test   %eax,%eax
+  801479:	74 37                	je     8014b2 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80147b:	83 ec 04             	sub    $0x4,%esp
+  80147e:	ff 75 10             	push   0x10(%ebp)
+  801481:	ff 75 0c             	push   0xc(%ebp)
+  801484:	56                   	push   %esi
+  801485:	ff d0                	call   *%eax
+  801487:	83 c4 10             	add    $0x10,%esp
+}
+  80148a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80148d:	5b                   	pop    %ebx
+  80148e:	5e                   	pop    %esi
+  80148f:	5d                   	pop    %ebp
+  801490:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801491:	a1 08 40 80 00       	mov    0x804008,%eax
+  801496:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801499:	83 ec 04             	sub    $0x4,%esp
+  80149c:	53                   	push   %ebx
+  80149d:	50                   	push   %eax
+  80149e:	68 29 2b 80 00       	push   $0x802b29
+  8014a3:	e8 cd ec ff ff       	call   800175 <cprintf>
+		return -E_INVAL;
+  8014a8:	83 c4 10             	add    $0x10,%esp
+  8014ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b0:	eb d8                	jmp    80148a <write+0x53>
+		return -E_NOT_SUPP;
+  8014b2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014b7:	eb d1                	jmp    80148a <write+0x53>
+
+008014b9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8014b9:	55                   	push   %ebp
+  8014ba:	89 e5                	mov    %esp,%ebp
+  8014bc:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c2:	50                   	push   %eax
+  8014c3:	ff 75 08             	push   0x8(%ebp)
+  8014c6:	e8 38 fc ff ff       	call   801103 <fd_lookup>
+  8014cb:	83 c4 10             	add    $0x10,%esp
+  8014ce:	85 c0                	test   %eax,%eax
+  8014d0:	78 0e                	js     8014e0 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8014d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014d8:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8014db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+
+008014e2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8014e2:	55                   	push   %ebp
+  8014e3:	89 e5                	mov    %esp,%ebp
+  8014e5:	56                   	push   %esi
+  8014e6:	53                   	push   %ebx
+  8014e7:	83 ec 18             	sub    $0x18,%esp
+  8014ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014f0:	50                   	push   %eax
+  8014f1:	53                   	push   %ebx
+  8014f2:	e8 0c fc ff ff       	call   801103 <fd_lookup>
+  8014f7:	83 c4 10             	add    $0x10,%esp
+  8014fa:	85 c0                	test   %eax,%eax
+  8014fc:	78 34                	js     801532 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014fe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801501:	83 ec 08             	sub    $0x8,%esp
+  801504:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801507:	50                   	push   %eax
+  801508:	ff 36                	push   (%esi)
+  80150a:	e8 44 fc ff ff       	call   801153 <dev_lookup>
+  80150f:	83 c4 10             	add    $0x10,%esp
+  801512:	85 c0                	test   %eax,%eax
+  801514:	78 1c                	js     801532 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801516:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80151a:	74 1d                	je     801539 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80151c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80151f:	8b 40 18             	mov    0x18(%eax),%eax
+  801522:	85 c0                	test   %eax,%eax
+  801524:	74 34                	je     80155a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801526:	83 ec 08             	sub    $0x8,%esp
+  801529:	ff 75 0c             	push   0xc(%ebp)
+  80152c:	56                   	push   %esi
+  80152d:	ff d0                	call   *%eax
+  80152f:	83 c4 10             	add    $0x10,%esp
+}
+  801532:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801535:	5b                   	pop    %ebx
+  801536:	5e                   	pop    %esi
+  801537:	5d                   	pop    %ebp
+  801538:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801539:	a1 08 40 80 00       	mov    0x804008,%eax
+  80153e:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801541:	83 ec 04             	sub    $0x4,%esp
+  801544:	53                   	push   %ebx
+  801545:	50                   	push   %eax
+  801546:	68 ec 2a 80 00       	push   $0x802aec
+  80154b:	e8 25 ec ff ff       	call   800175 <cprintf>
+		return -E_INVAL;
+  801550:	83 c4 10             	add    $0x10,%esp
+  801553:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801558:	eb d8                	jmp    801532 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80155a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80155f:	eb d1                	jmp    801532 <ftruncate+0x50>
+
+00801561 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801561:	55                   	push   %ebp
+  801562:	89 e5                	mov    %esp,%ebp
+  801564:	56                   	push   %esi
+  801565:	53                   	push   %ebx
+  801566:	83 ec 18             	sub    $0x18,%esp
+  801569:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80156c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80156f:	50                   	push   %eax
+  801570:	ff 75 08             	push   0x8(%ebp)
+  801573:	e8 8b fb ff ff       	call   801103 <fd_lookup>
+  801578:	83 c4 10             	add    $0x10,%esp
+  80157b:	85 c0                	test   %eax,%eax
+  80157d:	78 49                	js     8015c8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80157f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801582:	83 ec 08             	sub    $0x8,%esp
+  801585:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801588:	50                   	push   %eax
+  801589:	ff 36                	push   (%esi)
+  80158b:	e8 c3 fb ff ff       	call   801153 <dev_lookup>
+  801590:	83 c4 10             	add    $0x10,%esp
+  801593:	85 c0                	test   %eax,%eax
+  801595:	78 31                	js     8015c8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801597:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80159a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80159e:	74 2f                	je     8015cf <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8015a0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8015a3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8015aa:	00 00 00 
+	stat->st_isdir = 0;
+  8015ad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8015b4:	00 00 00 
+	stat->st_dev = dev;
+  8015b7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8015bd:	83 ec 08             	sub    $0x8,%esp
+  8015c0:	53                   	push   %ebx
+  8015c1:	56                   	push   %esi
+  8015c2:	ff 50 14             	call   *0x14(%eax)
+  8015c5:	83 c4 10             	add    $0x10,%esp
+}
+  8015c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015cb:	5b                   	pop    %ebx
+  8015cc:	5e                   	pop    %esi
+  8015cd:	5d                   	pop    %ebp
+  8015ce:	c3                   	ret
+		return -E_NOT_SUPP;
+  8015cf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015d4:	eb f2                	jmp    8015c8 <fstat+0x67>
+
+008015d6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8015d6:	55                   	push   %ebp
+  8015d7:	89 e5                	mov    %esp,%ebp
+  8015d9:	56                   	push   %esi
+  8015da:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8015db:	83 ec 08             	sub    $0x8,%esp
+  8015de:	6a 00                	push   $0x0
+  8015e0:	ff 75 08             	push   0x8(%ebp)
+  8015e3:	e8 e4 01 00 00       	call   8017cc <open>
+  8015e8:	89 c3                	mov    %eax,%ebx
+  8015ea:	83 c4 10             	add    $0x10,%esp
+  8015ed:	85 c0                	test   %eax,%eax
+  8015ef:	78 1b                	js     80160c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8015f1:	83 ec 08             	sub    $0x8,%esp
+  8015f4:	ff 75 0c             	push   0xc(%ebp)
+  8015f7:	50                   	push   %eax
+  8015f8:	e8 64 ff ff ff       	call   801561 <fstat>
+  8015fd:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8015ff:	89 1c 24             	mov    %ebx,(%esp)
+  801602:	e8 26 fc ff ff       	call   80122d <close>
+	return r;
+  801607:	83 c4 10             	add    $0x10,%esp
+  80160a:	89 f3                	mov    %esi,%ebx
+}
+  80160c:	89 d8                	mov    %ebx,%eax
+  80160e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801611:	5b                   	pop    %ebx
+  801612:	5e                   	pop    %esi
+  801613:	5d                   	pop    %ebp
+  801614:	c3                   	ret
+
+00801615 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801615:	55                   	push   %ebp
+  801616:	89 e5                	mov    %esp,%ebp
+  801618:	56                   	push   %esi
+  801619:	53                   	push   %ebx
+  80161a:	89 c6                	mov    %eax,%esi
+  80161c:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80161e:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801625:	74 27                	je     80164e <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801627:	6a 07                	push   $0x7
+  801629:	68 00 50 80 00       	push   $0x805000
+  80162e:	56                   	push   %esi
+  80162f:	ff 35 00 40 80 00    	push   0x804000
+  801635:	e8 1b 0c 00 00       	call   802255 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80163a:	83 c4 0c             	add    $0xc,%esp
+  80163d:	6a 00                	push   $0x0
+  80163f:	53                   	push   %ebx
+  801640:	6a 00                	push   $0x0
+  801642:	e8 96 0b 00 00       	call   8021dd <ipc_recv>
+}
+  801647:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80164a:	5b                   	pop    %ebx
+  80164b:	5e                   	pop    %esi
+  80164c:	5d                   	pop    %ebp
+  80164d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80164e:	83 ec 0c             	sub    $0xc,%esp
+  801651:	6a 01                	push   $0x1
+  801653:	e8 51 0c 00 00       	call   8022a9 <ipc_find_env>
+  801658:	a3 00 40 80 00       	mov    %eax,0x804000
+  80165d:	83 c4 10             	add    $0x10,%esp
+  801660:	eb c5                	jmp    801627 <fsipc+0x12>
+
+00801662 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801662:	55                   	push   %ebp
+  801663:	89 e5                	mov    %esp,%ebp
+  801665:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801668:	8b 45 08             	mov    0x8(%ebp),%eax
+  80166b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80166e:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  801673:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801676:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80167b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801680:	b8 02 00 00 00       	mov    $0x2,%eax
+  801685:	e8 8b ff ff ff       	call   801615 <fsipc>
+}
+  80168a:	c9                   	leave
+  80168b:	c3                   	ret
+
+0080168c <devfile_flush>:
+{
+  80168c:	55                   	push   %ebp
+  80168d:	89 e5                	mov    %esp,%ebp
+  80168f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801692:	8b 45 08             	mov    0x8(%ebp),%eax
+  801695:	8b 40 0c             	mov    0xc(%eax),%eax
+  801698:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80169d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8016a7:	e8 69 ff ff ff       	call   801615 <fsipc>
+}
+  8016ac:	c9                   	leave
+  8016ad:	c3                   	ret
+
+008016ae <devfile_stat>:
+{
+  8016ae:	55                   	push   %ebp
+  8016af:	89 e5                	mov    %esp,%ebp
+  8016b1:	53                   	push   %ebx
+  8016b2:	83 ec 04             	sub    $0x4,%esp
+  8016b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8016b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016bb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016be:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8016c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8016cd:	e8 43 ff ff ff       	call   801615 <fsipc>
+  8016d2:	85 c0                	test   %eax,%eax
+  8016d4:	78 2c                	js     801702 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8016d6:	83 ec 08             	sub    $0x8,%esp
+  8016d9:	68 00 50 80 00       	push   $0x805000
+  8016de:	53                   	push   %ebx
+  8016df:	e8 7f f0 ff ff       	call   800763 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8016e4:	a1 80 50 80 00       	mov    0x805080,%eax
+  8016e9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8016ef:	a1 84 50 80 00       	mov    0x805084,%eax
+  8016f4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8016fa:	83 c4 10             	add    $0x10,%esp
+  8016fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801702:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801705:	c9                   	leave
+  801706:	c3                   	ret
+
+00801707 <devfile_write>:
+{
+  801707:	55                   	push   %ebp
+  801708:	89 e5                	mov    %esp,%ebp
+  80170a:	83 ec 0c             	sub    $0xc,%esp
+  80170d:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801710:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801715:	39 d0                	cmp    %edx,%eax
+  801717:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80171a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171d:	8b 52 0c             	mov    0xc(%edx),%edx
+  801720:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801726:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80172b:	50                   	push   %eax
+  80172c:	ff 75 0c             	push   0xc(%ebp)
+  80172f:	68 08 50 80 00       	push   $0x805008
+  801734:	e8 b0 f1 ff ff       	call   8008e9 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801739:	ba 00 00 00 00       	mov    $0x0,%edx
+  80173e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801743:	e8 cd fe ff ff       	call   801615 <fsipc>
+}
+  801748:	c9                   	leave
+  801749:	c3                   	ret
+
+0080174a <devfile_read>:
+{
+  80174a:	55                   	push   %ebp
+  80174b:	89 e5                	mov    %esp,%ebp
+  80174d:	56                   	push   %esi
+  80174e:	53                   	push   %ebx
+  80174f:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801752:	8b 45 08             	mov    0x8(%ebp),%eax
+  801755:	8b 40 0c             	mov    0xc(%eax),%eax
+  801758:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  80175d:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801763:	ba 00 00 00 00       	mov    $0x0,%edx
+  801768:	b8 03 00 00 00       	mov    $0x3,%eax
+  80176d:	e8 a3 fe ff ff       	call   801615 <fsipc>
+  801772:	89 c3                	mov    %eax,%ebx
+  801774:	85 c0                	test   %eax,%eax
+  801776:	78 1f                	js     801797 <devfile_read+0x4d>
+	assert(r <= n);
+  801778:	39 c6                	cmp    %eax,%esi
+  80177a:	72 24                	jb     8017a0 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80177c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801781:	7f 33                	jg     8017b6 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801783:	83 ec 04             	sub    $0x4,%esp
+  801786:	50                   	push   %eax
+  801787:	68 00 50 80 00       	push   $0x805000
+  80178c:	ff 75 0c             	push   0xc(%ebp)
+  80178f:	e8 55 f1 ff ff       	call   8008e9 <memmove>
+	return r;
+  801794:	83 c4 10             	add    $0x10,%esp
+}
+  801797:	89 d8                	mov    %ebx,%eax
+  801799:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80179c:	5b                   	pop    %ebx
+  80179d:	5e                   	pop    %esi
+  80179e:	5d                   	pop    %ebp
+  80179f:	c3                   	ret
+	assert(r <= n);
+  8017a0:	68 5c 2b 80 00       	push   $0x802b5c
+  8017a5:	68 63 2b 80 00       	push   $0x802b63
+  8017aa:	6a 7c                	push   $0x7c
+  8017ac:	68 78 2b 80 00       	push   $0x802b78
+  8017b1:	e8 e1 09 00 00       	call   802197 <_panic>
+	assert(r <= PGSIZE);
+  8017b6:	68 83 2b 80 00       	push   $0x802b83
+  8017bb:	68 63 2b 80 00       	push   $0x802b63
+  8017c0:	6a 7d                	push   $0x7d
+  8017c2:	68 78 2b 80 00       	push   $0x802b78
+  8017c7:	e8 cb 09 00 00       	call   802197 <_panic>
+
+008017cc <open>:
+{
+  8017cc:	55                   	push   %ebp
+  8017cd:	89 e5                	mov    %esp,%ebp
+  8017cf:	56                   	push   %esi
+  8017d0:	53                   	push   %ebx
+  8017d1:	83 ec 1c             	sub    $0x1c,%esp
+  8017d4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8017d7:	56                   	push   %esi
+  8017d8:	e8 4b ef ff ff       	call   800728 <strlen>
+  8017dd:	83 c4 10             	add    $0x10,%esp
+  8017e0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8017e5:	7f 6c                	jg     801853 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8017e7:	83 ec 0c             	sub    $0xc,%esp
+  8017ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ed:	50                   	push   %eax
+  8017ee:	e8 ba f8 ff ff       	call   8010ad <fd_alloc>
+  8017f3:	89 c3                	mov    %eax,%ebx
+  8017f5:	83 c4 10             	add    $0x10,%esp
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	78 3c                	js     801838 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8017fc:	83 ec 08             	sub    $0x8,%esp
+  8017ff:	56                   	push   %esi
+  801800:	68 00 50 80 00       	push   $0x805000
+  801805:	e8 59 ef ff ff       	call   800763 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80180a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80180d:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801812:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801815:	b8 01 00 00 00       	mov    $0x1,%eax
+  80181a:	e8 f6 fd ff ff       	call   801615 <fsipc>
+  80181f:	89 c3                	mov    %eax,%ebx
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	85 c0                	test   %eax,%eax
+  801826:	78 19                	js     801841 <open+0x75>
+	return fd2num(fd);
+  801828:	83 ec 0c             	sub    $0xc,%esp
+  80182b:	ff 75 f4             	push   -0xc(%ebp)
+  80182e:	e8 53 f8 ff ff       	call   801086 <fd2num>
+  801833:	89 c3                	mov    %eax,%ebx
+  801835:	83 c4 10             	add    $0x10,%esp
+}
+  801838:	89 d8                	mov    %ebx,%eax
+  80183a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80183d:	5b                   	pop    %ebx
+  80183e:	5e                   	pop    %esi
+  80183f:	5d                   	pop    %ebp
+  801840:	c3                   	ret
+		fd_close(fd, 0);
+  801841:	83 ec 08             	sub    $0x8,%esp
+  801844:	6a 00                	push   $0x0
+  801846:	ff 75 f4             	push   -0xc(%ebp)
+  801849:	e8 58 f9 ff ff       	call   8011a6 <fd_close>
+		return r;
+  80184e:	83 c4 10             	add    $0x10,%esp
+  801851:	eb e5                	jmp    801838 <open+0x6c>
+		return -E_BAD_PATH;
+  801853:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801858:	eb de                	jmp    801838 <open+0x6c>
+
+0080185a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80185a:	55                   	push   %ebp
+  80185b:	89 e5                	mov    %esp,%ebp
+  80185d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801860:	ba 00 00 00 00       	mov    $0x0,%edx
+  801865:	b8 08 00 00 00       	mov    $0x8,%eax
+  80186a:	e8 a6 fd ff ff       	call   801615 <fsipc>
+}
+  80186f:	c9                   	leave
+  801870:	c3                   	ret
+
+00801871 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801871:	55                   	push   %ebp
+  801872:	89 e5                	mov    %esp,%ebp
+  801874:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801877:	68 8f 2b 80 00       	push   $0x802b8f
+  80187c:	ff 75 0c             	push   0xc(%ebp)
+  80187f:	e8 df ee ff ff       	call   800763 <strcpy>
+	return 0;
+}
+  801884:	b8 00 00 00 00       	mov    $0x0,%eax
+  801889:	c9                   	leave
+  80188a:	c3                   	ret
+
+0080188b <devsock_close>:
+{
+  80188b:	55                   	push   %ebp
+  80188c:	89 e5                	mov    %esp,%ebp
+  80188e:	53                   	push   %ebx
+  80188f:	83 ec 10             	sub    $0x10,%esp
+  801892:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801895:	53                   	push   %ebx
+  801896:	e8 1e 0a 00 00       	call   8022b9 <pageref>
+  80189b:	89 c2                	mov    %eax,%edx
+  80189d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8018a0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8018a5:	83 fa 01             	cmp    $0x1,%edx
+  8018a8:	74 05                	je     8018af <devsock_close+0x24>
+}
+  8018aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ad:	c9                   	leave
+  8018ae:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8018af:	83 ec 0c             	sub    $0xc,%esp
+  8018b2:	ff 73 0c             	push   0xc(%ebx)
+  8018b5:	e8 b7 02 00 00       	call   801b71 <nsipc_close>
+  8018ba:	83 c4 10             	add    $0x10,%esp
+  8018bd:	eb eb                	jmp    8018aa <devsock_close+0x1f>
+
+008018bf <devsock_write>:
+{
+  8018bf:	55                   	push   %ebp
+  8018c0:	89 e5                	mov    %esp,%ebp
+  8018c2:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8018c5:	6a 00                	push   $0x0
+  8018c7:	ff 75 10             	push   0x10(%ebp)
+  8018ca:	ff 75 0c             	push   0xc(%ebp)
+  8018cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d0:	ff 70 0c             	push   0xc(%eax)
+  8018d3:	e8 79 03 00 00       	call   801c51 <nsipc_send>
+}
+  8018d8:	c9                   	leave
+  8018d9:	c3                   	ret
+
+008018da <devsock_read>:
+{
+  8018da:	55                   	push   %ebp
+  8018db:	89 e5                	mov    %esp,%ebp
+  8018dd:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8018e0:	6a 00                	push   $0x0
+  8018e2:	ff 75 10             	push   0x10(%ebp)
+  8018e5:	ff 75 0c             	push   0xc(%ebp)
+  8018e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018eb:	ff 70 0c             	push   0xc(%eax)
+  8018ee:	e8 ef 02 00 00       	call   801be2 <nsipc_recv>
+}
+  8018f3:	c9                   	leave
+  8018f4:	c3                   	ret
+
+008018f5 <fd2sockid>:
+{
+  8018f5:	55                   	push   %ebp
+  8018f6:	89 e5                	mov    %esp,%ebp
+  8018f8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8018fb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8018fe:	52                   	push   %edx
+  8018ff:	50                   	push   %eax
+  801900:	e8 fe f7 ff ff       	call   801103 <fd_lookup>
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	85 c0                	test   %eax,%eax
+  80190a:	78 10                	js     80191c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80190c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80190f:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801915:	39 08                	cmp    %ecx,(%eax)
+  801917:	75 05                	jne    80191e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801919:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80191c:	c9                   	leave
+  80191d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80191e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801923:	eb f7                	jmp    80191c <fd2sockid+0x27>
+
+00801925 <alloc_sockfd>:
+{
+  801925:	55                   	push   %ebp
+  801926:	89 e5                	mov    %esp,%ebp
+  801928:	56                   	push   %esi
+  801929:	53                   	push   %ebx
+  80192a:	83 ec 1c             	sub    $0x1c,%esp
+  80192d:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80192f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801932:	50                   	push   %eax
+  801933:	e8 75 f7 ff ff       	call   8010ad <fd_alloc>
+  801938:	89 c3                	mov    %eax,%ebx
+  80193a:	83 c4 10             	add    $0x10,%esp
+  80193d:	85 c0                	test   %eax,%eax
+  80193f:	78 43                	js     801984 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801941:	83 ec 04             	sub    $0x4,%esp
+  801944:	68 07 04 00 00       	push   $0x407
+  801949:	ff 75 f4             	push   -0xc(%ebp)
+  80194c:	6a 00                	push   $0x0
+  80194e:	e8 7d f2 ff ff       	call   800bd0 <sys_page_alloc>
+  801953:	89 c3                	mov    %eax,%ebx
+  801955:	83 c4 10             	add    $0x10,%esp
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	78 28                	js     801984 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80195c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80195f:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801965:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801967:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80196a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801971:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801974:	83 ec 0c             	sub    $0xc,%esp
+  801977:	50                   	push   %eax
+  801978:	e8 09 f7 ff ff       	call   801086 <fd2num>
+  80197d:	89 c3                	mov    %eax,%ebx
+  80197f:	83 c4 10             	add    $0x10,%esp
+  801982:	eb 0c                	jmp    801990 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801984:	83 ec 0c             	sub    $0xc,%esp
+  801987:	56                   	push   %esi
+  801988:	e8 e4 01 00 00       	call   801b71 <nsipc_close>
+		return r;
+  80198d:	83 c4 10             	add    $0x10,%esp
+}
+  801990:	89 d8                	mov    %ebx,%eax
+  801992:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801995:	5b                   	pop    %ebx
+  801996:	5e                   	pop    %esi
+  801997:	5d                   	pop    %ebp
+  801998:	c3                   	ret
+
+00801999 <accept>:
+{
+  801999:	55                   	push   %ebp
+  80199a:	89 e5                	mov    %esp,%ebp
+  80199c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80199f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a2:	e8 4e ff ff ff       	call   8018f5 <fd2sockid>
+  8019a7:	85 c0                	test   %eax,%eax
+  8019a9:	78 1b                	js     8019c6 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8019ab:	83 ec 04             	sub    $0x4,%esp
+  8019ae:	ff 75 10             	push   0x10(%ebp)
+  8019b1:	ff 75 0c             	push   0xc(%ebp)
+  8019b4:	50                   	push   %eax
+  8019b5:	e8 0e 01 00 00       	call   801ac8 <nsipc_accept>
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	85 c0                	test   %eax,%eax
+  8019bf:	78 05                	js     8019c6 <accept+0x2d>
+	return alloc_sockfd(r);
+  8019c1:	e8 5f ff ff ff       	call   801925 <alloc_sockfd>
+}
+  8019c6:	c9                   	leave
+  8019c7:	c3                   	ret
+
+008019c8 <bind>:
+{
+  8019c8:	55                   	push   %ebp
+  8019c9:	89 e5                	mov    %esp,%ebp
+  8019cb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d1:	e8 1f ff ff ff       	call   8018f5 <fd2sockid>
+  8019d6:	85 c0                	test   %eax,%eax
+  8019d8:	78 12                	js     8019ec <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8019da:	83 ec 04             	sub    $0x4,%esp
+  8019dd:	ff 75 10             	push   0x10(%ebp)
+  8019e0:	ff 75 0c             	push   0xc(%ebp)
+  8019e3:	50                   	push   %eax
+  8019e4:	e8 31 01 00 00       	call   801b1a <nsipc_bind>
+  8019e9:	83 c4 10             	add    $0x10,%esp
+}
+  8019ec:	c9                   	leave
+  8019ed:	c3                   	ret
+
+008019ee <shutdown>:
+{
+  8019ee:	55                   	push   %ebp
+  8019ef:	89 e5                	mov    %esp,%ebp
+  8019f1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f7:	e8 f9 fe ff ff       	call   8018f5 <fd2sockid>
+  8019fc:	85 c0                	test   %eax,%eax
+  8019fe:	78 0f                	js     801a0f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801a00:	83 ec 08             	sub    $0x8,%esp
+  801a03:	ff 75 0c             	push   0xc(%ebp)
+  801a06:	50                   	push   %eax
+  801a07:	e8 43 01 00 00       	call   801b4f <nsipc_shutdown>
+  801a0c:	83 c4 10             	add    $0x10,%esp
+}
+  801a0f:	c9                   	leave
+  801a10:	c3                   	ret
+
+00801a11 <connect>:
+{
+  801a11:	55                   	push   %ebp
+  801a12:	89 e5                	mov    %esp,%ebp
+  801a14:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a17:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a1a:	e8 d6 fe ff ff       	call   8018f5 <fd2sockid>
+  801a1f:	85 c0                	test   %eax,%eax
+  801a21:	78 12                	js     801a35 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801a23:	83 ec 04             	sub    $0x4,%esp
+  801a26:	ff 75 10             	push   0x10(%ebp)
+  801a29:	ff 75 0c             	push   0xc(%ebp)
+  801a2c:	50                   	push   %eax
+  801a2d:	e8 59 01 00 00       	call   801b8b <nsipc_connect>
+  801a32:	83 c4 10             	add    $0x10,%esp
+}
+  801a35:	c9                   	leave
+  801a36:	c3                   	ret
+
+00801a37 <listen>:
+{
+  801a37:	55                   	push   %ebp
+  801a38:	89 e5                	mov    %esp,%ebp
+  801a3a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a40:	e8 b0 fe ff ff       	call   8018f5 <fd2sockid>
+  801a45:	85 c0                	test   %eax,%eax
+  801a47:	78 0f                	js     801a58 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801a49:	83 ec 08             	sub    $0x8,%esp
+  801a4c:	ff 75 0c             	push   0xc(%ebp)
+  801a4f:	50                   	push   %eax
+  801a50:	e8 6b 01 00 00       	call   801bc0 <nsipc_listen>
+  801a55:	83 c4 10             	add    $0x10,%esp
+}
+  801a58:	c9                   	leave
+  801a59:	c3                   	ret
+
+00801a5a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801a5a:	55                   	push   %ebp
+  801a5b:	89 e5                	mov    %esp,%ebp
+  801a5d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801a60:	ff 75 10             	push   0x10(%ebp)
+  801a63:	ff 75 0c             	push   0xc(%ebp)
+  801a66:	ff 75 08             	push   0x8(%ebp)
+  801a69:	e8 41 02 00 00       	call   801caf <nsipc_socket>
+  801a6e:	83 c4 10             	add    $0x10,%esp
+  801a71:	85 c0                	test   %eax,%eax
+  801a73:	78 05                	js     801a7a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801a75:	e8 ab fe ff ff       	call   801925 <alloc_sockfd>
+}
+  801a7a:	c9                   	leave
+  801a7b:	c3                   	ret
+
+00801a7c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801a7c:	55                   	push   %ebp
+  801a7d:	89 e5                	mov    %esp,%ebp
+  801a7f:	53                   	push   %ebx
+  801a80:	83 ec 04             	sub    $0x4,%esp
+  801a83:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801a85:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a8c:	74 26                	je     801ab4 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801a8e:	6a 07                	push   $0x7
+  801a90:	68 00 60 80 00       	push   $0x806000
+  801a95:	53                   	push   %ebx
+  801a96:	ff 35 04 40 80 00    	push   0x804004
+  801a9c:	e8 b4 07 00 00       	call   802255 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801aa1:	83 c4 0c             	add    $0xc,%esp
+  801aa4:	6a 00                	push   $0x0
+  801aa6:	6a 00                	push   $0x0
+  801aa8:	6a 00                	push   $0x0
+  801aaa:	e8 2e 07 00 00       	call   8021dd <ipc_recv>
+}
+  801aaf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ab2:	c9                   	leave
+  801ab3:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ab4:	83 ec 0c             	sub    $0xc,%esp
+  801ab7:	6a 02                	push   $0x2
+  801ab9:	e8 eb 07 00 00       	call   8022a9 <ipc_find_env>
+  801abe:	a3 04 40 80 00       	mov    %eax,0x804004
+  801ac3:	83 c4 10             	add    $0x10,%esp
+  801ac6:	eb c6                	jmp    801a8e <nsipc+0x12>
+
+00801ac8 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ac8:	55                   	push   %ebp
+  801ac9:	89 e5                	mov    %esp,%ebp
+  801acb:	56                   	push   %esi
+  801acc:	53                   	push   %ebx
+  801acd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ad0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad3:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ad8:	8b 06                	mov    (%esi),%eax
+  801ada:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801adf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ae4:	e8 93 ff ff ff       	call   801a7c <nsipc>
+  801ae9:	89 c3                	mov    %eax,%ebx
+  801aeb:	85 c0                	test   %eax,%eax
+  801aed:	79 09                	jns    801af8 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801aef:	89 d8                	mov    %ebx,%eax
+  801af1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801af4:	5b                   	pop    %ebx
+  801af5:	5e                   	pop    %esi
+  801af6:	5d                   	pop    %ebp
+  801af7:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801af8:	83 ec 04             	sub    $0x4,%esp
+  801afb:	ff 35 10 60 80 00    	push   0x806010
+  801b01:	68 00 60 80 00       	push   $0x806000
+  801b06:	ff 75 0c             	push   0xc(%ebp)
+  801b09:	e8 db ed ff ff       	call   8008e9 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801b0e:	a1 10 60 80 00       	mov    0x806010,%eax
+  801b13:	89 06                	mov    %eax,(%esi)
+  801b15:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801b18:	eb d5                	jmp    801aef <nsipc_accept+0x27>
+
+00801b1a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801b1a:	55                   	push   %ebp
+  801b1b:	89 e5                	mov    %esp,%ebp
+  801b1d:	53                   	push   %ebx
+  801b1e:	83 ec 08             	sub    $0x8,%esp
+  801b21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801b24:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b27:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801b2c:	53                   	push   %ebx
+  801b2d:	ff 75 0c             	push   0xc(%ebp)
+  801b30:	68 04 60 80 00       	push   $0x806004
+  801b35:	e8 af ed ff ff       	call   8008e9 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801b3a:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801b40:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b45:	e8 32 ff ff ff       	call   801a7c <nsipc>
+}
+  801b4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b4d:	c9                   	leave
+  801b4e:	c3                   	ret
+
+00801b4f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801b4f:	55                   	push   %ebp
+  801b50:	89 e5                	mov    %esp,%ebp
+  801b52:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801b55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b58:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801b5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b60:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801b65:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b6a:	e8 0d ff ff ff       	call   801a7c <nsipc>
+}
+  801b6f:	c9                   	leave
+  801b70:	c3                   	ret
+
+00801b71 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801b71:	55                   	push   %ebp
+  801b72:	89 e5                	mov    %esp,%ebp
+  801b74:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801b77:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b7a:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801b7f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b84:	e8 f3 fe ff ff       	call   801a7c <nsipc>
+}
+  801b89:	c9                   	leave
+  801b8a:	c3                   	ret
+
+00801b8b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801b8b:	55                   	push   %ebp
+  801b8c:	89 e5                	mov    %esp,%ebp
+  801b8e:	53                   	push   %ebx
+  801b8f:	83 ec 08             	sub    $0x8,%esp
+  801b92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801b95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b98:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801b9d:	53                   	push   %ebx
+  801b9e:	ff 75 0c             	push   0xc(%ebp)
+  801ba1:	68 04 60 80 00       	push   $0x806004
+  801ba6:	e8 3e ed ff ff       	call   8008e9 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801bab:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801bb1:	b8 05 00 00 00       	mov    $0x5,%eax
+  801bb6:	e8 c1 fe ff ff       	call   801a7c <nsipc>
+}
+  801bbb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bbe:	c9                   	leave
+  801bbf:	c3                   	ret
+
+00801bc0 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801bc0:	55                   	push   %ebp
+  801bc1:	89 e5                	mov    %esp,%ebp
+  801bc3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801bc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc9:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801bce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bd1:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801bd6:	b8 06 00 00 00       	mov    $0x6,%eax
+  801bdb:	e8 9c fe ff ff       	call   801a7c <nsipc>
+}
+  801be0:	c9                   	leave
+  801be1:	c3                   	ret
+
+00801be2 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801be2:	55                   	push   %ebp
+  801be3:	89 e5                	mov    %esp,%ebp
+  801be5:	56                   	push   %esi
+  801be6:	53                   	push   %ebx
+  801be7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801bea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bed:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801bf2:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801bf8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bfb:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801c00:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c05:	e8 72 fe ff ff       	call   801a7c <nsipc>
+  801c0a:	89 c3                	mov    %eax,%ebx
+  801c0c:	85 c0                	test   %eax,%eax
+  801c0e:	78 22                	js     801c32 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801c10:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801c15:	39 c6                	cmp    %eax,%esi
+  801c17:	0f 4e c6             	cmovle %esi,%eax
+  801c1a:	39 c3                	cmp    %eax,%ebx
+  801c1c:	7f 1d                	jg     801c3b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801c1e:	83 ec 04             	sub    $0x4,%esp
+  801c21:	53                   	push   %ebx
+  801c22:	68 00 60 80 00       	push   $0x806000
+  801c27:	ff 75 0c             	push   0xc(%ebp)
+  801c2a:	e8 ba ec ff ff       	call   8008e9 <memmove>
+  801c2f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801c32:	89 d8                	mov    %ebx,%eax
+  801c34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c37:	5b                   	pop    %ebx
+  801c38:	5e                   	pop    %esi
+  801c39:	5d                   	pop    %ebp
+  801c3a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801c3b:	68 9b 2b 80 00       	push   $0x802b9b
+  801c40:	68 63 2b 80 00       	push   $0x802b63
+  801c45:	6a 62                	push   $0x62
+  801c47:	68 b0 2b 80 00       	push   $0x802bb0
+  801c4c:	e8 46 05 00 00       	call   802197 <_panic>
+
+00801c51 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	53                   	push   %ebx
+  801c55:	83 ec 04             	sub    $0x4,%esp
+  801c58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801c5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c5e:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801c63:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801c69:	7f 2e                	jg     801c99 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801c6b:	83 ec 04             	sub    $0x4,%esp
+  801c6e:	53                   	push   %ebx
+  801c6f:	ff 75 0c             	push   0xc(%ebp)
+  801c72:	68 0c 60 80 00       	push   $0x80600c
+  801c77:	e8 6d ec ff ff       	call   8008e9 <memmove>
+	nsipcbuf.send.req_size = size;
+  801c7c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801c82:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c85:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801c8a:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c8f:	e8 e8 fd ff ff       	call   801a7c <nsipc>
+}
+  801c94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c97:	c9                   	leave
+  801c98:	c3                   	ret
+	assert(size < 1600);
+  801c99:	68 bc 2b 80 00       	push   $0x802bbc
+  801c9e:	68 63 2b 80 00       	push   $0x802b63
+  801ca3:	6a 6d                	push   $0x6d
+  801ca5:	68 b0 2b 80 00       	push   $0x802bb0
+  801caa:	e8 e8 04 00 00       	call   802197 <_panic>
+
+00801caf <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801caf:	55                   	push   %ebp
+  801cb0:	89 e5                	mov    %esp,%ebp
+  801cb2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801cb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb8:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801cbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cc0:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801cc5:	8b 45 10             	mov    0x10(%ebp),%eax
+  801cc8:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801ccd:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cd2:	e8 a5 fd ff ff       	call   801a7c <nsipc>
+}
+  801cd7:	c9                   	leave
+  801cd8:	c3                   	ret
+
+00801cd9 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cd9:	55                   	push   %ebp
+  801cda:	89 e5                	mov    %esp,%ebp
+  801cdc:	56                   	push   %esi
+  801cdd:	53                   	push   %ebx
+  801cde:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801ce1:	83 ec 0c             	sub    $0xc,%esp
+  801ce4:	ff 75 08             	push   0x8(%ebp)
+  801ce7:	e8 aa f3 ff ff       	call   801096 <fd2data>
+  801cec:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801cee:	83 c4 08             	add    $0x8,%esp
+  801cf1:	68 c8 2b 80 00       	push   $0x802bc8
+  801cf6:	53                   	push   %ebx
+  801cf7:	e8 67 ea ff ff       	call   800763 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801cfc:	8b 46 04             	mov    0x4(%esi),%eax
+  801cff:	2b 06                	sub    (%esi),%eax
+  801d01:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801d07:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d0e:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d11:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801d18:	30 80 00 
+	return 0;
+}
+  801d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d23:	5b                   	pop    %ebx
+  801d24:	5e                   	pop    %esi
+  801d25:	5d                   	pop    %ebp
+  801d26:	c3                   	ret
+
+00801d27 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d27:	55                   	push   %ebp
+  801d28:	89 e5                	mov    %esp,%ebp
+  801d2a:	53                   	push   %ebx
+  801d2b:	83 ec 0c             	sub    $0xc,%esp
+  801d2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d31:	53                   	push   %ebx
+  801d32:	6a 00                	push   $0x0
+  801d34:	e8 5f ef ff ff       	call   800c98 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d39:	89 1c 24             	mov    %ebx,(%esp)
+  801d3c:	e8 55 f3 ff ff       	call   801096 <fd2data>
+  801d41:	83 c4 08             	add    $0x8,%esp
+  801d44:	50                   	push   %eax
+  801d45:	6a 00                	push   $0x0
+  801d47:	e8 4c ef ff ff       	call   800c98 <sys_page_unmap>
+}
+  801d4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d4f:	c9                   	leave
+  801d50:	c3                   	ret
+
+00801d51 <_pipeisclosed>:
+{
+  801d51:	55                   	push   %ebp
+  801d52:	89 e5                	mov    %esp,%ebp
+  801d54:	57                   	push   %edi
+  801d55:	56                   	push   %esi
+  801d56:	53                   	push   %ebx
+  801d57:	83 ec 1c             	sub    $0x1c,%esp
+  801d5a:	89 c7                	mov    %eax,%edi
+  801d5c:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d5e:	a1 08 40 80 00       	mov    0x804008,%eax
+  801d63:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801d66:	83 ec 0c             	sub    $0xc,%esp
+  801d69:	57                   	push   %edi
+  801d6a:	e8 4a 05 00 00       	call   8022b9 <pageref>
+  801d6f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d72:	89 34 24             	mov    %esi,(%esp)
+  801d75:	e8 3f 05 00 00       	call   8022b9 <pageref>
+		nn = thisenv->env_runs;
+  801d7a:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801d80:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801d83:	83 c4 10             	add    $0x10,%esp
+  801d86:	39 cb                	cmp    %ecx,%ebx
+  801d88:	74 1b                	je     801da5 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801d8a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d8d:	75 cf                	jne    801d5e <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801d8f:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801d92:	6a 01                	push   $0x1
+  801d94:	50                   	push   %eax
+  801d95:	53                   	push   %ebx
+  801d96:	68 cf 2b 80 00       	push   $0x802bcf
+  801d9b:	e8 d5 e3 ff ff       	call   800175 <cprintf>
+  801da0:	83 c4 10             	add    $0x10,%esp
+  801da3:	eb b9                	jmp    801d5e <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801da5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801da8:	0f 94 c0             	sete   %al
+  801dab:	0f b6 c0             	movzbl %al,%eax
+}
+  801dae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801db1:	5b                   	pop    %ebx
+  801db2:	5e                   	pop    %esi
+  801db3:	5f                   	pop    %edi
+  801db4:	5d                   	pop    %ebp
+  801db5:	c3                   	ret
+
+00801db6 <devpipe_write>:
+{
+  801db6:	55                   	push   %ebp
+  801db7:	89 e5                	mov    %esp,%ebp
+  801db9:	57                   	push   %edi
+  801dba:	56                   	push   %esi
+  801dbb:	53                   	push   %ebx
+  801dbc:	83 ec 28             	sub    $0x28,%esp
+  801dbf:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801dc2:	56                   	push   %esi
+  801dc3:	e8 ce f2 ff ff       	call   801096 <fd2data>
+  801dc8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801dca:	83 c4 10             	add    $0x10,%esp
+  801dcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dd2:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801dd5:	75 09                	jne    801de0 <devpipe_write+0x2a>
+	return i;
+  801dd7:	89 f8                	mov    %edi,%eax
+  801dd9:	eb 23                	jmp    801dfe <devpipe_write+0x48>
+			sys_yield();
+  801ddb:	e8 70 ed ff ff       	call   800b50 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801de0:	8b 43 04             	mov    0x4(%ebx),%eax
+  801de3:	8b 0b                	mov    (%ebx),%ecx
+  801de5:	8d 51 20             	lea    0x20(%ecx),%edx
+  801de8:	39 d0                	cmp    %edx,%eax
+  801dea:	72 1a                	jb     801e06 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801dec:	89 da                	mov    %ebx,%edx
+  801dee:	89 f0                	mov    %esi,%eax
+  801df0:	e8 5c ff ff ff       	call   801d51 <_pipeisclosed>
+  801df5:	85 c0                	test   %eax,%eax
+  801df7:	74 e2                	je     801ddb <devpipe_write+0x25>
+				return 0;
+  801df9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e01:	5b                   	pop    %ebx
+  801e02:	5e                   	pop    %esi
+  801e03:	5f                   	pop    %edi
+  801e04:	5d                   	pop    %ebp
+  801e05:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801e06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e09:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801e0d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801e10:	89 c2                	mov    %eax,%edx
+  801e12:	c1 fa 1f             	sar    $0x1f,%edx
+  801e15:	89 d1                	mov    %edx,%ecx
+  801e17:	c1 e9 1b             	shr    $0x1b,%ecx
+  801e1a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801e1d:	83 e2 1f             	and    $0x1f,%edx
+  801e20:	29 ca                	sub    %ecx,%edx
+  801e22:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801e26:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801e2a:	83 c0 01             	add    $0x1,%eax
+  801e2d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801e30:	83 c7 01             	add    $0x1,%edi
+  801e33:	eb 9d                	jmp    801dd2 <devpipe_write+0x1c>
+
+00801e35 <devpipe_read>:
+{
+  801e35:	55                   	push   %ebp
+  801e36:	89 e5                	mov    %esp,%ebp
+  801e38:	57                   	push   %edi
+  801e39:	56                   	push   %esi
+  801e3a:	53                   	push   %ebx
+  801e3b:	83 ec 18             	sub    $0x18,%esp
+  801e3e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801e41:	57                   	push   %edi
+  801e42:	e8 4f f2 ff ff       	call   801096 <fd2data>
+  801e47:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801e49:	83 c4 10             	add    $0x10,%esp
+  801e4c:	be 00 00 00 00       	mov    $0x0,%esi
+  801e51:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801e54:	75 13                	jne    801e69 <devpipe_read+0x34>
+	return i;
+  801e56:	89 f0                	mov    %esi,%eax
+  801e58:	eb 02                	jmp    801e5c <devpipe_read+0x27>
+				return i;
+  801e5a:	89 f0                	mov    %esi,%eax
+}
+  801e5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e5f:	5b                   	pop    %ebx
+  801e60:	5e                   	pop    %esi
+  801e61:	5f                   	pop    %edi
+  801e62:	5d                   	pop    %ebp
+  801e63:	c3                   	ret
+			sys_yield();
+  801e64:	e8 e7 ec ff ff       	call   800b50 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801e69:	8b 03                	mov    (%ebx),%eax
+  801e6b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801e6e:	75 18                	jne    801e88 <devpipe_read+0x53>
+			if (i > 0)
+  801e70:	85 f6                	test   %esi,%esi
+  801e72:	75 e6                	jne    801e5a <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801e74:	89 da                	mov    %ebx,%edx
+  801e76:	89 f8                	mov    %edi,%eax
+  801e78:	e8 d4 fe ff ff       	call   801d51 <_pipeisclosed>
+  801e7d:	85 c0                	test   %eax,%eax
+  801e7f:	74 e3                	je     801e64 <devpipe_read+0x2f>
+				return 0;
+  801e81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e86:	eb d4                	jmp    801e5c <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e88:	99                   	cltd
+  801e89:	c1 ea 1b             	shr    $0x1b,%edx
+  801e8c:	01 d0                	add    %edx,%eax
+  801e8e:	83 e0 1f             	and    $0x1f,%eax
+  801e91:	29 d0                	sub    %edx,%eax
+  801e93:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801e98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e9b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801e9e:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801ea1:	83 c6 01             	add    $0x1,%esi
+  801ea4:	eb ab                	jmp    801e51 <devpipe_read+0x1c>
+
+00801ea6 <pipe>:
+{
+  801ea6:	55                   	push   %ebp
+  801ea7:	89 e5                	mov    %esp,%ebp
+  801ea9:	56                   	push   %esi
+  801eaa:	53                   	push   %ebx
+  801eab:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801eae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eb1:	50                   	push   %eax
+  801eb2:	e8 f6 f1 ff ff       	call   8010ad <fd_alloc>
+  801eb7:	89 c3                	mov    %eax,%ebx
+  801eb9:	83 c4 10             	add    $0x10,%esp
+  801ebc:	85 c0                	test   %eax,%eax
+  801ebe:	0f 88 23 01 00 00    	js     801fe7 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ec4:	83 ec 04             	sub    $0x4,%esp
+  801ec7:	68 07 04 00 00       	push   $0x407
+  801ecc:	ff 75 f4             	push   -0xc(%ebp)
+  801ecf:	6a 00                	push   $0x0
+  801ed1:	e8 fa ec ff ff       	call   800bd0 <sys_page_alloc>
+  801ed6:	89 c3                	mov    %eax,%ebx
+  801ed8:	83 c4 10             	add    $0x10,%esp
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	0f 88 04 01 00 00    	js     801fe7 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801ee3:	83 ec 0c             	sub    $0xc,%esp
+  801ee6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ee9:	50                   	push   %eax
+  801eea:	e8 be f1 ff ff       	call   8010ad <fd_alloc>
+  801eef:	89 c3                	mov    %eax,%ebx
+  801ef1:	83 c4 10             	add    $0x10,%esp
+  801ef4:	85 c0                	test   %eax,%eax
+  801ef6:	0f 88 db 00 00 00    	js     801fd7 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801efc:	83 ec 04             	sub    $0x4,%esp
+  801eff:	68 07 04 00 00       	push   $0x407
+  801f04:	ff 75 f0             	push   -0x10(%ebp)
+  801f07:	6a 00                	push   $0x0
+  801f09:	e8 c2 ec ff ff       	call   800bd0 <sys_page_alloc>
+  801f0e:	89 c3                	mov    %eax,%ebx
+  801f10:	83 c4 10             	add    $0x10,%esp
+  801f13:	85 c0                	test   %eax,%eax
+  801f15:	0f 88 bc 00 00 00    	js     801fd7 <pipe+0x131>
+	va = fd2data(fd0);
+  801f1b:	83 ec 0c             	sub    $0xc,%esp
+  801f1e:	ff 75 f4             	push   -0xc(%ebp)
+  801f21:	e8 70 f1 ff ff       	call   801096 <fd2data>
+  801f26:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f28:	83 c4 0c             	add    $0xc,%esp
+  801f2b:	68 07 04 00 00       	push   $0x407
+  801f30:	50                   	push   %eax
+  801f31:	6a 00                	push   $0x0
+  801f33:	e8 98 ec ff ff       	call   800bd0 <sys_page_alloc>
+  801f38:	89 c3                	mov    %eax,%ebx
+  801f3a:	83 c4 10             	add    $0x10,%esp
+  801f3d:	85 c0                	test   %eax,%eax
+  801f3f:	0f 88 82 00 00 00    	js     801fc7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f45:	83 ec 0c             	sub    $0xc,%esp
+  801f48:	ff 75 f0             	push   -0x10(%ebp)
+  801f4b:	e8 46 f1 ff ff       	call   801096 <fd2data>
+  801f50:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801f57:	50                   	push   %eax
+  801f58:	6a 00                	push   $0x0
+  801f5a:	56                   	push   %esi
+  801f5b:	6a 00                	push   $0x0
+  801f5d:	e8 f4 ec ff ff       	call   800c56 <sys_page_map>
+  801f62:	89 c3                	mov    %eax,%ebx
+  801f64:	83 c4 20             	add    $0x20,%esp
+  801f67:	85 c0                	test   %eax,%eax
+  801f69:	78 4e                	js     801fb9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801f6b:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801f70:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f73:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801f75:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f78:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801f7f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801f82:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801f84:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801f87:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801f8e:	83 ec 0c             	sub    $0xc,%esp
+  801f91:	ff 75 f4             	push   -0xc(%ebp)
+  801f94:	e8 ed f0 ff ff       	call   801086 <fd2num>
+  801f99:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f9c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801f9e:	83 c4 04             	add    $0x4,%esp
+  801fa1:	ff 75 f0             	push   -0x10(%ebp)
+  801fa4:	e8 dd f0 ff ff       	call   801086 <fd2num>
+  801fa9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fac:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801faf:	83 c4 10             	add    $0x10,%esp
+  801fb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fb7:	eb 2e                	jmp    801fe7 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801fb9:	83 ec 08             	sub    $0x8,%esp
+  801fbc:	56                   	push   %esi
+  801fbd:	6a 00                	push   $0x0
+  801fbf:	e8 d4 ec ff ff       	call   800c98 <sys_page_unmap>
+  801fc4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801fc7:	83 ec 08             	sub    $0x8,%esp
+  801fca:	ff 75 f0             	push   -0x10(%ebp)
+  801fcd:	6a 00                	push   $0x0
+  801fcf:	e8 c4 ec ff ff       	call   800c98 <sys_page_unmap>
+  801fd4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801fd7:	83 ec 08             	sub    $0x8,%esp
+  801fda:	ff 75 f4             	push   -0xc(%ebp)
+  801fdd:	6a 00                	push   $0x0
+  801fdf:	e8 b4 ec ff ff       	call   800c98 <sys_page_unmap>
+  801fe4:	83 c4 10             	add    $0x10,%esp
+}
+  801fe7:	89 d8                	mov    %ebx,%eax
+  801fe9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fec:	5b                   	pop    %ebx
+  801fed:	5e                   	pop    %esi
+  801fee:	5d                   	pop    %ebp
+  801fef:	c3                   	ret
+
+00801ff0 <pipeisclosed>:
+{
+  801ff0:	55                   	push   %ebp
+  801ff1:	89 e5                	mov    %esp,%ebp
+  801ff3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ff6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ff9:	50                   	push   %eax
+  801ffa:	ff 75 08             	push   0x8(%ebp)
+  801ffd:	e8 01 f1 ff ff       	call   801103 <fd_lookup>
+  802002:	83 c4 10             	add    $0x10,%esp
+  802005:	85 c0                	test   %eax,%eax
+  802007:	78 18                	js     802021 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802009:	83 ec 0c             	sub    $0xc,%esp
+  80200c:	ff 75 f4             	push   -0xc(%ebp)
+  80200f:	e8 82 f0 ff ff       	call   801096 <fd2data>
+  802014:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802016:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802019:	e8 33 fd ff ff       	call   801d51 <_pipeisclosed>
+  80201e:	83 c4 10             	add    $0x10,%esp
+}
+  802021:	c9                   	leave
+  802022:	c3                   	ret
+
+00802023 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802023:	b8 00 00 00 00       	mov    $0x0,%eax
+  802028:	c3                   	ret
+
+00802029 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802029:	55                   	push   %ebp
+  80202a:	89 e5                	mov    %esp,%ebp
+  80202c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80202f:	68 e7 2b 80 00       	push   $0x802be7
+  802034:	ff 75 0c             	push   0xc(%ebp)
+  802037:	e8 27 e7 ff ff       	call   800763 <strcpy>
+	return 0;
+}
+  80203c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802041:	c9                   	leave
+  802042:	c3                   	ret
+
+00802043 <devcons_write>:
+{
+  802043:	55                   	push   %ebp
+  802044:	89 e5                	mov    %esp,%ebp
+  802046:	57                   	push   %edi
+  802047:	56                   	push   %esi
+  802048:	53                   	push   %ebx
+  802049:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80204f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802054:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80205a:	eb 2e                	jmp    80208a <devcons_write+0x47>
+		m = n - tot;
+  80205c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80205f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802061:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802066:	39 c3                	cmp    %eax,%ebx
+  802068:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80206b:	83 ec 04             	sub    $0x4,%esp
+  80206e:	53                   	push   %ebx
+  80206f:	89 f0                	mov    %esi,%eax
+  802071:	03 45 0c             	add    0xc(%ebp),%eax
+  802074:	50                   	push   %eax
+  802075:	57                   	push   %edi
+  802076:	e8 6e e8 ff ff       	call   8008e9 <memmove>
+		sys_cputs(buf, m);
+  80207b:	83 c4 08             	add    $0x8,%esp
+  80207e:	53                   	push   %ebx
+  80207f:	57                   	push   %edi
+  802080:	e8 0e ea ff ff       	call   800a93 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802085:	01 de                	add    %ebx,%esi
+  802087:	83 c4 10             	add    $0x10,%esp
+  80208a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80208d:	72 cd                	jb     80205c <devcons_write+0x19>
+}
+  80208f:	89 f0                	mov    %esi,%eax
+  802091:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802094:	5b                   	pop    %ebx
+  802095:	5e                   	pop    %esi
+  802096:	5f                   	pop    %edi
+  802097:	5d                   	pop    %ebp
+  802098:	c3                   	ret
+
+00802099 <devcons_read>:
+{
+  802099:	55                   	push   %ebp
+  80209a:	89 e5                	mov    %esp,%ebp
+  80209c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80209f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8020a8:	75 07                	jne    8020b1 <devcons_read+0x18>
+  8020aa:	eb 1f                	jmp    8020cb <devcons_read+0x32>
+		sys_yield();
+  8020ac:	e8 9f ea ff ff       	call   800b50 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8020b1:	e8 fb e9 ff ff       	call   800ab1 <sys_cgetc>
+  8020b6:	85 c0                	test   %eax,%eax
+  8020b8:	74 f2                	je     8020ac <devcons_read+0x13>
+	if (c < 0)
+  8020ba:	78 0f                	js     8020cb <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8020bc:	83 f8 04             	cmp    $0x4,%eax
+  8020bf:	74 0c                	je     8020cd <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8020c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020c4:	88 02                	mov    %al,(%edx)
+	return 1;
+  8020c6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8020cb:	c9                   	leave
+  8020cc:	c3                   	ret
+		return 0;
+  8020cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d2:	eb f7                	jmp    8020cb <devcons_read+0x32>
+
+008020d4 <cputchar>:
+{
+  8020d4:	55                   	push   %ebp
+  8020d5:	89 e5                	mov    %esp,%ebp
+  8020d7:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8020da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020dd:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8020e0:	6a 01                	push   $0x1
+  8020e2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020e5:	50                   	push   %eax
+  8020e6:	e8 a8 e9 ff ff       	call   800a93 <sys_cputs>
+}
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	c9                   	leave
+  8020ef:	c3                   	ret
+
+008020f0 <getchar>:
+{
+  8020f0:	55                   	push   %ebp
+  8020f1:	89 e5                	mov    %esp,%ebp
+  8020f3:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8020f6:	6a 01                	push   $0x1
+  8020f8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020fb:	50                   	push   %eax
+  8020fc:	6a 00                	push   $0x0
+  8020fe:	e8 66 f2 ff ff       	call   801369 <read>
+	if (r < 0)
+  802103:	83 c4 10             	add    $0x10,%esp
+  802106:	85 c0                	test   %eax,%eax
+  802108:	78 06                	js     802110 <getchar+0x20>
+	if (r < 1)
+  80210a:	74 06                	je     802112 <getchar+0x22>
+	return c;
+  80210c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802110:	c9                   	leave
+  802111:	c3                   	ret
+		return -E_EOF;
+  802112:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802117:	eb f7                	jmp    802110 <getchar+0x20>
+
+00802119 <iscons>:
+{
+  802119:	55                   	push   %ebp
+  80211a:	89 e5                	mov    %esp,%ebp
+  80211c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80211f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802122:	50                   	push   %eax
+  802123:	ff 75 08             	push   0x8(%ebp)
+  802126:	e8 d8 ef ff ff       	call   801103 <fd_lookup>
+  80212b:	83 c4 10             	add    $0x10,%esp
+  80212e:	85 c0                	test   %eax,%eax
+  802130:	78 11                	js     802143 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802132:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802135:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80213b:	39 10                	cmp    %edx,(%eax)
+  80213d:	0f 94 c0             	sete   %al
+  802140:	0f b6 c0             	movzbl %al,%eax
+}
+  802143:	c9                   	leave
+  802144:	c3                   	ret
+
+00802145 <opencons>:
+{
+  802145:	55                   	push   %ebp
+  802146:	89 e5                	mov    %esp,%ebp
+  802148:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80214b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80214e:	50                   	push   %eax
+  80214f:	e8 59 ef ff ff       	call   8010ad <fd_alloc>
+  802154:	83 c4 10             	add    $0x10,%esp
+  802157:	85 c0                	test   %eax,%eax
+  802159:	78 3a                	js     802195 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80215b:	83 ec 04             	sub    $0x4,%esp
+  80215e:	68 07 04 00 00       	push   $0x407
+  802163:	ff 75 f4             	push   -0xc(%ebp)
+  802166:	6a 00                	push   $0x0
+  802168:	e8 63 ea ff ff       	call   800bd0 <sys_page_alloc>
+  80216d:	83 c4 10             	add    $0x10,%esp
+  802170:	85 c0                	test   %eax,%eax
+  802172:	78 21                	js     802195 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802174:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802177:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80217d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80217f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802182:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802189:	83 ec 0c             	sub    $0xc,%esp
+  80218c:	50                   	push   %eax
+  80218d:	e8 f4 ee ff ff       	call   801086 <fd2num>
+  802192:	83 c4 10             	add    $0x10,%esp
+}
+  802195:	c9                   	leave
+  802196:	c3                   	ret
+
+00802197 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802197:	55                   	push   %ebp
+  802198:	89 e5                	mov    %esp,%ebp
+  80219a:	56                   	push   %esi
+  80219b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80219c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80219f:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8021a5:	e8 87 e9 ff ff       	call   800b31 <sys_getenvid>
+  8021aa:	83 ec 0c             	sub    $0xc,%esp
+  8021ad:	ff 75 0c             	push   0xc(%ebp)
+  8021b0:	ff 75 08             	push   0x8(%ebp)
+  8021b3:	56                   	push   %esi
+  8021b4:	50                   	push   %eax
+  8021b5:	68 f4 2b 80 00       	push   $0x802bf4
+  8021ba:	e8 b6 df ff ff       	call   800175 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8021bf:	83 c4 18             	add    $0x18,%esp
+  8021c2:	53                   	push   %ebx
+  8021c3:	ff 75 10             	push   0x10(%ebp)
+  8021c6:	e8 59 df ff ff       	call   800124 <vcprintf>
+	cprintf("\n");
+  8021cb:	c7 04 24 e0 2b 80 00 	movl   $0x802be0,(%esp)
+  8021d2:	e8 9e df ff ff       	call   800175 <cprintf>
+  8021d7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8021da:	cc                   	int3
+	while (1)
+  8021db:	eb fd                	jmp    8021da <_panic+0x43>
+
+008021dd <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8021dd:	55                   	push   %ebp
+  8021de:	89 e5                	mov    %esp,%ebp
+  8021e0:	57                   	push   %edi
+  8021e1:	56                   	push   %esi
+  8021e2:	53                   	push   %ebx
+  8021e3:	83 ec 18             	sub    $0x18,%esp
+  8021e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021ec:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8021ef:	85 db                	test   %ebx,%ebx
+  8021f1:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021f6:	0f 45 c3             	cmovne %ebx,%eax
+  8021f9:	50                   	push   %eax
+  8021fa:	e8 54 ed ff ff       	call   800f53 <sys_ipc_recv>
+
+	if (from_env_store)
+  8021ff:	83 c4 10             	add    $0x10,%esp
+  802202:	85 ff                	test   %edi,%edi
+  802204:	74 17                	je     80221d <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802206:	ba 00 00 00 00       	mov    $0x0,%edx
+  80220b:	85 c0                	test   %eax,%eax
+  80220d:	75 0c                	jne    80221b <ipc_recv+0x3e>
+  80220f:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802215:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  80221b:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  80221d:	85 f6                	test   %esi,%esi
+  80221f:	74 2e                	je     80224f <ipc_recv+0x72>
+		if (!r && pg)
+  802221:	85 c0                	test   %eax,%eax
+  802223:	75 24                	jne    802249 <ipc_recv+0x6c>
+  802225:	85 db                	test   %ebx,%ebx
+  802227:	74 20                	je     802249 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802229:	a1 08 40 80 00       	mov    0x804008,%eax
+  80222e:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802234:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802236:	a1 08 40 80 00       	mov    0x804008,%eax
+  80223b:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802241:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802244:	5b                   	pop    %ebx
+  802245:	5e                   	pop    %esi
+  802246:	5f                   	pop    %edi
+  802247:	5d                   	pop    %ebp
+  802248:	c3                   	ret
+			*perm_store = 0;
+  802249:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80224f:	85 c0                	test   %eax,%eax
+  802251:	75 ee                	jne    802241 <ipc_recv+0x64>
+  802253:	eb e1                	jmp    802236 <ipc_recv+0x59>
+
+00802255 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802255:	55                   	push   %ebp
+  802256:	89 e5                	mov    %esp,%ebp
+  802258:	57                   	push   %edi
+  802259:	56                   	push   %esi
+  80225a:	53                   	push   %ebx
+  80225b:	83 ec 0c             	sub    $0xc,%esp
+  80225e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802261:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802264:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802267:	85 db                	test   %ebx,%ebx
+  802269:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80226e:	0f 44 d8             	cmove  %eax,%ebx
+  802271:	ff 75 14             	push   0x14(%ebp)
+  802274:	53                   	push   %ebx
+  802275:	56                   	push   %esi
+  802276:	57                   	push   %edi
+  802277:	e8 b4 ec ff ff       	call   800f30 <sys_ipc_try_send_yield>
+  80227c:	83 c4 10             	add    $0x10,%esp
+  80227f:	85 c0                	test   %eax,%eax
+  802281:	79 1e                	jns    8022a1 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802283:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802286:	75 07                	jne    80228f <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802288:	e8 c3 e8 ff ff       	call   800b50 <sys_yield>
+  80228d:	eb e2                	jmp    802271 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  80228f:	50                   	push   %eax
+  802290:	68 17 2c 80 00       	push   $0x802c17
+  802295:	6a 3d                	push   $0x3d
+  802297:	68 2c 2c 80 00       	push   $0x802c2c
+  80229c:	e8 f6 fe ff ff       	call   802197 <_panic>
+	}
+}
+  8022a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022a4:	5b                   	pop    %ebx
+  8022a5:	5e                   	pop    %esi
+  8022a6:	5f                   	pop    %edi
+  8022a7:	5d                   	pop    %ebp
+  8022a8:	c3                   	ret
+
+008022a9 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8022a9:	55                   	push   %ebp
+  8022aa:	89 e5                	mov    %esp,%ebp
+  8022ac:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8022af:	ff 75 08             	push   0x8(%ebp)
+  8022b2:	e8 19 e8 ff ff       	call   800ad0 <sys_env_find>
+}
+  8022b7:	c9                   	leave
+  8022b8:	c3                   	ret
+
+008022b9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8022b9:	55                   	push   %ebp
+  8022ba:	89 e5                	mov    %esp,%ebp
+  8022bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8022bf:	89 c2                	mov    %eax,%edx
+  8022c1:	c1 ea 16             	shr    $0x16,%edx
+  8022c4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8022cb:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8022d0:	f6 c1 01             	test   $0x1,%cl
+  8022d3:	74 22                	je     8022f7 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8022d5:	c1 e8 0c             	shr    $0xc,%eax
+  8022d8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8022df:	a8 01                	test   $0x1,%al
+  8022e1:	74 14                	je     8022f7 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8022e3:	c1 e8 0c             	shr    $0xc,%eax
+  8022e6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8022e9:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8022f0:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8022f4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8022f7:	89 d0                	mov    %edx,%eax
+  8022f9:	5d                   	pop    %ebp
+  8022fa:	c3                   	ret
+  8022fb:	66 90                	xchg   %ax,%ax
+  8022fd:	66 90                	xchg   %ax,%ax
+  8022ff:	90                   	nop
+
+00802300 <__udivmoddi4>:
+  802300:	55                   	push   %ebp
+  802301:	57                   	push   %edi
+  802302:	56                   	push   %esi
+  802303:	53                   	push   %ebx
+  802304:	83 ec 14             	sub    $0x14,%esp
+  802307:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80230b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80230f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802313:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802317:	89 f1                	mov    %esi,%ecx
+  802319:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80231d:	09 d9                	or     %ebx,%ecx
+  80231f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802323:	0f 84 92 00 00 00    	je     8023bb <__udivmoddi4+0xbb>
+  802329:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802330:	00 
+  802331:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802336:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80233d:	00 
+  80233e:	89 1c 24             	mov    %ebx,(%esp)
+  802341:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802345:	8d 76 00             	lea    0x0(%esi),%esi
+  802348:	89 e9                	mov    %ebp,%ecx
+  80234a:	89 c3                	mov    %eax,%ebx
+  80234c:	89 d6                	mov    %edx,%esi
+  80234e:	31 ff                	xor    %edi,%edi
+  802350:	d3 ee                	shr    %cl,%esi
+  802352:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802355:	f6 c1 20             	test   $0x20,%cl
+  802358:	0f 45 de             	cmovne %esi,%ebx
+  80235b:	0f 45 f7             	cmovne %edi,%esi
+  80235e:	8b 3c 24             	mov    (%esp),%edi
+  802361:	39 fb                	cmp    %edi,%ebx
+  802363:	89 f7                	mov    %esi,%edi
+  802365:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802369:	8b 1c 24             	mov    (%esp),%ebx
+  80236c:	19 f7                	sbb    %esi,%edi
+  80236e:	72 39                	jb     8023a9 <__udivmoddi4+0xa9>
+  802370:	89 e9                	mov    %ebp,%ecx
+  802372:	89 f7                	mov    %esi,%edi
+  802374:	89 de                	mov    %ebx,%esi
+  802376:	0f a5 df             	shld   %cl,%ebx,%edi
+  802379:	d3 e6                	shl    %cl,%esi
+  80237b:	31 db                	xor    %ebx,%ebx
+  80237d:	f6 c1 20             	test   $0x20,%cl
+  802380:	0f 45 fe             	cmovne %esi,%edi
+  802383:	0f 45 f3             	cmovne %ebx,%esi
+  802386:	29 f0                	sub    %esi,%eax
+  802388:	be 01 00 00 00       	mov    $0x1,%esi
+  80238d:	19 fa                	sbb    %edi,%edx
+  80238f:	31 ff                	xor    %edi,%edi
+  802391:	31 db                	xor    %ebx,%ebx
+  802393:	0f a5 f7             	shld   %cl,%esi,%edi
+  802396:	d3 e6                	shl    %cl,%esi
+  802398:	f6 c1 20             	test   $0x20,%cl
+  80239b:	0f 45 fe             	cmovne %esi,%edi
+  80239e:	0f 45 f3             	cmovne %ebx,%esi
+  8023a1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023a5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023a9:	83 ed 01             	sub    $0x1,%ebp
+  8023ac:	73 9a                	jae    802348 <__udivmoddi4+0x48>
+  8023ae:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8023b2:	85 ff                	test   %edi,%edi
+  8023b4:	74 05                	je     8023bb <__udivmoddi4+0xbb>
+  8023b6:	89 07                	mov    %eax,(%edi)
+  8023b8:	89 57 04             	mov    %edx,0x4(%edi)
+  8023bb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023bf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023c3:	83 c4 14             	add    $0x14,%esp
+  8023c6:	5b                   	pop    %ebx
+  8023c7:	5e                   	pop    %esi
+  8023c8:	5f                   	pop    %edi
+  8023c9:	5d                   	pop    %ebp
+  8023ca:	c3                   	ret
+  8023cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8023cf:	90                   	nop
+
+008023d0 <__udivdi3>:
+  8023d0:	55                   	push   %ebp
+  8023d1:	57                   	push   %edi
+  8023d2:	56                   	push   %esi
+  8023d3:	53                   	push   %ebx
+  8023d4:	83 ec 14             	sub    $0x14,%esp
+  8023d7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8023db:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8023df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8023e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8023e7:	89 fb                	mov    %edi,%ebx
+  8023e9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8023ed:	09 f3                	or     %esi,%ebx
+  8023ef:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8023f3:	0f 84 85 00 00 00    	je     80247e <__udivdi3+0xae>
+  8023f9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802400:	00 
+  802401:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802406:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80240d:	00 
+  80240e:	89 34 24             	mov    %esi,(%esp)
+  802411:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802415:	8d 76 00             	lea    0x0(%esi),%esi
+  802418:	89 e9                	mov    %ebp,%ecx
+  80241a:	89 c3                	mov    %eax,%ebx
+  80241c:	89 d6                	mov    %edx,%esi
+  80241e:	31 ff                	xor    %edi,%edi
+  802420:	d3 ee                	shr    %cl,%esi
+  802422:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802425:	f6 c1 20             	test   $0x20,%cl
+  802428:	0f 45 de             	cmovne %esi,%ebx
+  80242b:	0f 45 f7             	cmovne %edi,%esi
+  80242e:	8b 3c 24             	mov    (%esp),%edi
+  802431:	39 fb                	cmp    %edi,%ebx
+  802433:	89 f7                	mov    %esi,%edi
+  802435:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802439:	8b 1c 24             	mov    (%esp),%ebx
+  80243c:	19 f7                	sbb    %esi,%edi
+  80243e:	72 39                	jb     802479 <__udivdi3+0xa9>
+  802440:	89 e9                	mov    %ebp,%ecx
+  802442:	89 f7                	mov    %esi,%edi
+  802444:	89 de                	mov    %ebx,%esi
+  802446:	0f a5 df             	shld   %cl,%ebx,%edi
+  802449:	d3 e6                	shl    %cl,%esi
+  80244b:	31 db                	xor    %ebx,%ebx
+  80244d:	f6 c1 20             	test   $0x20,%cl
+  802450:	0f 45 fe             	cmovne %esi,%edi
+  802453:	0f 45 f3             	cmovne %ebx,%esi
+  802456:	29 f0                	sub    %esi,%eax
+  802458:	be 01 00 00 00       	mov    $0x1,%esi
+  80245d:	19 fa                	sbb    %edi,%edx
+  80245f:	31 ff                	xor    %edi,%edi
+  802461:	31 db                	xor    %ebx,%ebx
+  802463:	0f a5 f7             	shld   %cl,%esi,%edi
+  802466:	d3 e6                	shl    %cl,%esi
+  802468:	f6 c1 20             	test   $0x20,%cl
+  80246b:	0f 45 fe             	cmovne %esi,%edi
+  80246e:	0f 45 f3             	cmovne %ebx,%esi
+  802471:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802475:	09 74 24 08          	or     %esi,0x8(%esp)
+  802479:	83 ed 01             	sub    $0x1,%ebp
+  80247c:	73 9a                	jae    802418 <__udivdi3+0x48>
+  80247e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802482:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802486:	83 c4 14             	add    $0x14,%esp
+  802489:	5b                   	pop    %ebx
+  80248a:	5e                   	pop    %esi
+  80248b:	5f                   	pop    %edi
+  80248c:	5d                   	pop    %ebp
+  80248d:	c3                   	ret
+  80248e:	66 90                	xchg   %ax,%ax
+
+00802490 <__umoddi3>:
+  802490:	57                   	push   %edi
+  802491:	56                   	push   %esi
+  802492:	53                   	push   %ebx
+  802493:	83 ec 08             	sub    $0x8,%esp
+  802496:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80249a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80249e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8024a2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8024a6:	89 f9                	mov    %edi,%ecx
+  8024a8:	89 34 24             	mov    %esi,(%esp)
+  8024ab:	09 f1                	or     %esi,%ecx
+  8024ad:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8024b1:	74 53                	je     802506 <__umoddi3+0x76>
+  8024b3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024bf:	90                   	nop
+  8024c0:	89 c6                	mov    %eax,%esi
+  8024c2:	89 d7                	mov    %edx,%edi
+  8024c4:	31 db                	xor    %ebx,%ebx
+  8024c6:	d3 ef                	shr    %cl,%edi
+  8024c8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8024cb:	f6 c1 20             	test   $0x20,%cl
+  8024ce:	0f 45 f7             	cmovne %edi,%esi
+  8024d1:	0f 45 fb             	cmovne %ebx,%edi
+  8024d4:	8b 1c 24             	mov    (%esp),%ebx
+  8024d7:	39 de                	cmp    %ebx,%esi
+  8024d9:	89 fb                	mov    %edi,%ebx
+  8024db:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8024df:	8b 34 24             	mov    (%esp),%esi
+  8024e2:	19 fb                	sbb    %edi,%ebx
+  8024e4:	72 14                	jb     8024fa <__umoddi3+0x6a>
+  8024e6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8024e9:	31 db                	xor    %ebx,%ebx
+  8024eb:	d3 e6                	shl    %cl,%esi
+  8024ed:	f6 c1 20             	test   $0x20,%cl
+  8024f0:	0f 45 fe             	cmovne %esi,%edi
+  8024f3:	0f 45 f3             	cmovne %ebx,%esi
+  8024f6:	29 f0                	sub    %esi,%eax
+  8024f8:	19 fa                	sbb    %edi,%edx
+  8024fa:	83 e9 01             	sub    $0x1,%ecx
+  8024fd:	73 c1                	jae    8024c0 <__umoddi3+0x30>
+  8024ff:	83 c4 08             	add    $0x8,%esp
+  802502:	5b                   	pop    %ebx
+  802503:	5e                   	pop    %esi
+  802504:	5f                   	pop    %edi
+  802505:	c3                   	ret
+  802506:	83 c4 08             	add    $0x8,%esp
+  802509:	31 c0                	xor    %eax,%eax
+  80250b:	31 d2                	xor    %edx,%edx
+  80250d:	5b                   	pop    %ebx
+  80250e:	5e                   	pop    %esi
+  80250f:	5f                   	pop    %edi
+  802510:	c3                   	ret
+  802511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80251f:	90                   	nop
+
+00802520 <__divdi3>:
+  802520:	55                   	push   %ebp
+  802521:	57                   	push   %edi
+  802522:	56                   	push   %esi
+  802523:	53                   	push   %ebx
+  802524:	83 ec 1c             	sub    $0x1c,%esp
+  802527:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80252b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80252f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802533:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802537:	85 ff                	test   %edi,%edi
+  802539:	0f 88 da 00 00 00    	js     802619 <__divdi3+0xf9>
+  80253f:	85 db                	test   %ebx,%ebx
+  802541:	78 16                	js     802559 <__divdi3+0x39>
+  802543:	89 dd                	mov    %ebx,%ebp
+  802545:	89 c8                	mov    %ecx,%eax
+  802547:	89 da                	mov    %ebx,%edx
+  802549:	09 cd                	or     %ecx,%ebp
+  80254b:	0f 85 fd 00 00 00    	jne    80264e <__divdi3+0x12e>
+  802551:	83 c4 1c             	add    $0x1c,%esp
+  802554:	5b                   	pop    %ebx
+  802555:	5e                   	pop    %esi
+  802556:	5f                   	pop    %edi
+  802557:	5d                   	pop    %ebp
+  802558:	c3                   	ret
+  802559:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80255e:	f7 d9                	neg    %ecx
+  802560:	89 f0                	mov    %esi,%eax
+  802562:	89 fa                	mov    %edi,%edx
+  802564:	83 d3 00             	adc    $0x0,%ebx
+  802567:	89 0c 24             	mov    %ecx,(%esp)
+  80256a:	f7 db                	neg    %ebx
+  80256c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802570:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802577:	00 
+  802578:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80257d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802584:	00 
+  802585:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802589:	89 cd                	mov    %ecx,%ebp
+  80258b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80258f:	90                   	nop
+  802590:	89 e9                	mov    %ebp,%ecx
+  802592:	89 c3                	mov    %eax,%ebx
+  802594:	89 d6                	mov    %edx,%esi
+  802596:	31 ff                	xor    %edi,%edi
+  802598:	d3 ee                	shr    %cl,%esi
+  80259a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80259d:	f6 c1 20             	test   $0x20,%cl
+  8025a0:	0f 45 de             	cmovne %esi,%ebx
+  8025a3:	0f 45 f7             	cmovne %edi,%esi
+  8025a6:	8b 3c 24             	mov    (%esp),%edi
+  8025a9:	39 fb                	cmp    %edi,%ebx
+  8025ab:	89 f7                	mov    %esi,%edi
+  8025ad:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8025b1:	8b 1c 24             	mov    (%esp),%ebx
+  8025b4:	19 f7                	sbb    %esi,%edi
+  8025b6:	72 39                	jb     8025f1 <__divdi3+0xd1>
+  8025b8:	89 e9                	mov    %ebp,%ecx
+  8025ba:	89 f7                	mov    %esi,%edi
+  8025bc:	89 de                	mov    %ebx,%esi
+  8025be:	0f a5 df             	shld   %cl,%ebx,%edi
+  8025c1:	d3 e6                	shl    %cl,%esi
+  8025c3:	31 db                	xor    %ebx,%ebx
+  8025c5:	f6 c1 20             	test   $0x20,%cl
+  8025c8:	0f 45 fe             	cmovne %esi,%edi
+  8025cb:	0f 45 f3             	cmovne %ebx,%esi
+  8025ce:	29 f0                	sub    %esi,%eax
+  8025d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8025d5:	19 fa                	sbb    %edi,%edx
+  8025d7:	31 ff                	xor    %edi,%edi
+  8025d9:	31 db                	xor    %ebx,%ebx
+  8025db:	0f a5 f7             	shld   %cl,%esi,%edi
+  8025de:	d3 e6                	shl    %cl,%esi
+  8025e0:	f6 c1 20             	test   $0x20,%cl
+  8025e3:	0f 45 fe             	cmovne %esi,%edi
+  8025e6:	0f 45 f3             	cmovne %ebx,%esi
+  8025e9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8025ed:	09 74 24 08          	or     %esi,0x8(%esp)
+  8025f1:	83 ed 01             	sub    $0x1,%ebp
+  8025f4:	73 9a                	jae    802590 <__divdi3+0x70>
+  8025f6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8025fa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025fe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802602:	85 ed                	test   %ebp,%ebp
+  802604:	0f 84 47 ff ff ff    	je     802551 <__divdi3+0x31>
+  80260a:	f7 d8                	neg    %eax
+  80260c:	83 d2 00             	adc    $0x0,%edx
+  80260f:	83 c4 1c             	add    $0x1c,%esp
+  802612:	5b                   	pop    %ebx
+  802613:	f7 da                	neg    %edx
+  802615:	5e                   	pop    %esi
+  802616:	5f                   	pop    %edi
+  802617:	5d                   	pop    %ebp
+  802618:	c3                   	ret
+  802619:	f7 de                	neg    %esi
+  80261b:	83 d7 00             	adc    $0x0,%edi
+  80261e:	f7 df                	neg    %edi
+  802620:	85 db                	test   %ebx,%ebx
+  802622:	78 23                	js     802647 <__divdi3+0x127>
+  802624:	89 dd                	mov    %ebx,%ebp
+  802626:	89 c8                	mov    %ecx,%eax
+  802628:	89 da                	mov    %ebx,%edx
+  80262a:	09 cd                	or     %ecx,%ebp
+  80262c:	0f 84 1f ff ff ff    	je     802551 <__divdi3+0x31>
+  802632:	89 0c 24             	mov    %ecx,(%esp)
+  802635:	89 f0                	mov    %esi,%eax
+  802637:	89 fa                	mov    %edi,%edx
+  802639:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80263e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802642:	e9 29 ff ff ff       	jmp    802570 <__divdi3+0x50>
+  802647:	31 ed                	xor    %ebp,%ebp
+  802649:	e9 10 ff ff ff       	jmp    80255e <__divdi3+0x3e>
+  80264e:	89 0c 24             	mov    %ecx,(%esp)
+  802651:	89 f0                	mov    %esi,%eax
+  802653:	89 fa                	mov    %edi,%edx
+  802655:	31 ed                	xor    %ebp,%ebp
+  802657:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80265b:	e9 10 ff ff ff       	jmp    802570 <__divdi3+0x50>
+
+00802660 <__moddi3>:
+  802660:	55                   	push   %ebp
+  802661:	57                   	push   %edi
+  802662:	56                   	push   %esi
+  802663:	53                   	push   %ebx
+  802664:	83 ec 14             	sub    $0x14,%esp
+  802667:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80266b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80266f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802673:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802677:	85 d2                	test   %edx,%edx
+  802679:	0f 88 9b 00 00 00    	js     80271a <__moddi3+0xba>
+  80267f:	89 f7                	mov    %esi,%edi
+  802681:	31 ed                	xor    %ebp,%ebp
+  802683:	09 cf                	or     %ecx,%edi
+  802685:	0f 84 83 00 00 00    	je     80270e <__moddi3+0xae>
+  80268b:	89 cb                	mov    %ecx,%ebx
+  80268d:	89 f7                	mov    %esi,%edi
+  80268f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802693:	f7 db                	neg    %ebx
+  802695:	83 d7 00             	adc    $0x0,%edi
+  802698:	f7 df                	neg    %edi
+  80269a:	0f 49 f7             	cmovns %edi,%esi
+  80269d:	0f 49 cb             	cmovns %ebx,%ecx
+  8026a0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8026a4:	89 0c 24             	mov    %ecx,(%esp)
+  8026a7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026ac:	89 cd                	mov    %ecx,%ebp
+  8026ae:	66 90                	xchg   %ax,%ax
+  8026b0:	89 e9                	mov    %ebp,%ecx
+  8026b2:	89 c3                	mov    %eax,%ebx
+  8026b4:	89 d6                	mov    %edx,%esi
+  8026b6:	31 ff                	xor    %edi,%edi
+  8026b8:	d3 ee                	shr    %cl,%esi
+  8026ba:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8026bd:	f6 c1 20             	test   $0x20,%cl
+  8026c0:	0f 45 de             	cmovne %esi,%ebx
+  8026c3:	0f 45 f7             	cmovne %edi,%esi
+  8026c6:	8b 3c 24             	mov    (%esp),%edi
+  8026c9:	39 fb                	cmp    %edi,%ebx
+  8026cb:	89 f7                	mov    %esi,%edi
+  8026cd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8026d1:	8b 1c 24             	mov    (%esp),%ebx
+  8026d4:	19 f7                	sbb    %esi,%edi
+  8026d6:	72 1a                	jb     8026f2 <__moddi3+0x92>
+  8026d8:	89 e9                	mov    %ebp,%ecx
+  8026da:	89 f7                	mov    %esi,%edi
+  8026dc:	89 de                	mov    %ebx,%esi
+  8026de:	0f a5 df             	shld   %cl,%ebx,%edi
+  8026e1:	d3 e6                	shl    %cl,%esi
+  8026e3:	31 db                	xor    %ebx,%ebx
+  8026e5:	f6 c1 20             	test   $0x20,%cl
+  8026e8:	0f 45 fe             	cmovne %esi,%edi
+  8026eb:	0f 45 f3             	cmovne %ebx,%esi
+  8026ee:	29 f0                	sub    %esi,%eax
+  8026f0:	19 fa                	sbb    %edi,%edx
+  8026f2:	83 ed 01             	sub    $0x1,%ebp
+  8026f5:	73 b9                	jae    8026b0 <__moddi3+0x50>
+  8026f7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  8026fb:	85 ed                	test   %ebp,%ebp
+  8026fd:	74 07                	je     802706 <__moddi3+0xa6>
+  8026ff:	f7 d8                	neg    %eax
+  802701:	83 d2 00             	adc    $0x0,%edx
+  802704:	f7 da                	neg    %edx
+  802706:	83 c4 14             	add    $0x14,%esp
+  802709:	5b                   	pop    %ebx
+  80270a:	5e                   	pop    %esi
+  80270b:	5f                   	pop    %edi
+  80270c:	5d                   	pop    %ebp
+  80270d:	c3                   	ret
+  80270e:	83 c4 14             	add    $0x14,%esp
+  802711:	31 c0                	xor    %eax,%eax
+  802713:	31 d2                	xor    %edx,%edx
+  802715:	5b                   	pop    %ebx
+  802716:	5e                   	pop    %esi
+  802717:	5f                   	pop    %edi
+  802718:	5d                   	pop    %ebp
+  802719:	c3                   	ret
+  80271a:	89 f7                	mov    %esi,%edi
+  80271c:	09 cf                	or     %ecx,%edi
+  80271e:	74 11                	je     802731 <__moddi3+0xd1>
+  802720:	f7 d8                	neg    %eax
+  802722:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802727:	83 d2 00             	adc    $0x0,%edx
+  80272a:	f7 da                	neg    %edx
+  80272c:	e9 5a ff ff ff       	jmp    80268b <__moddi3+0x2b>
+  802731:	31 c0                	xor    %eax,%eax
+  802733:	31 d2                	xor    %edx,%edx
+  802735:	eb c8                	jmp    8026ff <__moddi3+0x9f>
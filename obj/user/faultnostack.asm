@@ -0,0 +1,5675 @@
+
+obj/user/faultnostack.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_env_set_pgfault_upcall(0, (void*) _pgfault_upcall);
+  800039:	68 16 06 80 00       	push   $0x800616
+  80003e:	6a 00                	push   $0x0
+  800040:	e8 a7 04 00 00       	call   8004ec <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800045:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80004c:	00 00 00 
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80005f:	e8 ee 00 00 00       	call   800152 <sys_getenvid>
+  800064:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800069:	c1 e0 09             	shl    $0x9,%eax
+  80006c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800071:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800076:	85 db                	test   %ebx,%ebx
+  800078:	7e 07                	jle    800081 <libmain+0x2d>
+		binaryname = argv[0];
+  80007a:	8b 06                	mov    (%esi),%eax
+  80007c:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800081:	83 ec 08             	sub    $0x8,%esp
+  800084:	56                   	push   %esi
+  800085:	53                   	push   %ebx
+  800086:	e8 a8 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80008b:	e8 0a 00 00 00       	call   80009a <exit>
+}
+  800090:	83 c4 10             	add    $0x10,%esp
+  800093:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800096:	5b                   	pop    %ebx
+  800097:	5e                   	pop    %esi
+  800098:	5d                   	pop    %ebp
+  800099:	c3                   	ret
+
+0080009a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000a0:	e8 6b 07 00 00       	call   800810 <close_all>
+	sys_env_destroy(0);
+  8000a5:	83 ec 0c             	sub    $0xc,%esp
+  8000a8:	6a 00                	push   $0x0
+  8000aa:	e8 62 00 00 00       	call   800111 <sys_env_destroy>
+}
+  8000af:	83 c4 10             	add    $0x10,%esp
+  8000b2:	c9                   	leave
+  8000b3:	c3                   	ret
+
+008000b4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000b4:	55                   	push   %ebp
+  8000b5:	89 e5                	mov    %esp,%ebp
+  8000b7:	57                   	push   %edi
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c5:	89 c3                	mov    %eax,%ebx
+  8000c7:	89 c7                	mov    %eax,%edi
+  8000c9:	89 c6                	mov    %eax,%esi
+  8000cb:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000cd:	5b                   	pop    %ebx
+  8000ce:	5e                   	pop    %esi
+  8000cf:	5f                   	pop    %edi
+  8000d0:	5d                   	pop    %ebp
+  8000d1:	c3                   	ret
+
+008000d2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000d2:	55                   	push   %ebp
+  8000d3:	89 e5                	mov    %esp,%ebp
+  8000d5:	57                   	push   %edi
+  8000d6:	56                   	push   %esi
+  8000d7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e2:	89 d1                	mov    %edx,%ecx
+  8000e4:	89 d3                	mov    %edx,%ebx
+  8000e6:	89 d7                	mov    %edx,%edi
+  8000e8:	89 d6                	mov    %edx,%esi
+  8000ea:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000ec:	5b                   	pop    %ebx
+  8000ed:	5e                   	pop    %esi
+  8000ee:	5f                   	pop    %edi
+  8000ef:	5d                   	pop    %ebp
+  8000f0:	c3                   	ret
+
+008000f1 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8000f1:	55                   	push   %ebp
+  8000f2:	89 e5                	mov    %esp,%ebp
+  8000f4:	57                   	push   %edi
+  8000f5:	56                   	push   %esi
+  8000f6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ff:	b8 04 00 00 00       	mov    $0x4,%eax
+  800104:	89 cb                	mov    %ecx,%ebx
+  800106:	89 cf                	mov    %ecx,%edi
+  800108:	89 ce                	mov    %ecx,%esi
+  80010a:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+
+00800111 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	57                   	push   %edi
+  800115:	56                   	push   %esi
+  800116:	53                   	push   %ebx
+  800117:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80011a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80011f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800122:	b8 03 00 00 00       	mov    $0x3,%eax
+  800127:	89 cb                	mov    %ecx,%ebx
+  800129:	89 cf                	mov    %ecx,%edi
+  80012b:	89 ce                	mov    %ecx,%esi
+  80012d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80012f:	85 c0                	test   %eax,%eax
+  800131:	7f 08                	jg     80013b <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800133:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800136:	5b                   	pop    %ebx
+  800137:	5e                   	pop    %esi
+  800138:	5f                   	pop    %edi
+  800139:	5d                   	pop    %ebp
+  80013a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80013b:	83 ec 0c             	sub    $0xc,%esp
+  80013e:	50                   	push   %eax
+  80013f:	6a 03                	push   $0x3
+  800141:	68 2a 27 80 00       	push   $0x80272a
+  800146:	6a 23                	push   $0x23
+  800148:	68 47 27 80 00       	push   $0x802747
+  80014d:	e8 fb 15 00 00       	call   80174d <_panic>
+
+00800152 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800152:	55                   	push   %ebp
+  800153:	89 e5                	mov    %esp,%ebp
+  800155:	57                   	push   %edi
+  800156:	56                   	push   %esi
+  800157:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800162:	89 d1                	mov    %edx,%ecx
+  800164:	89 d3                	mov    %edx,%ebx
+  800166:	89 d7                	mov    %edx,%edi
+  800168:	89 d6                	mov    %edx,%esi
+  80016a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80016c:	5b                   	pop    %ebx
+  80016d:	5e                   	pop    %esi
+  80016e:	5f                   	pop    %edi
+  80016f:	5d                   	pop    %ebp
+  800170:	c3                   	ret
+
+00800171 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800171:	55                   	push   %ebp
+  800172:	89 e5                	mov    %esp,%ebp
+  800174:	57                   	push   %edi
+  800175:	56                   	push   %esi
+  800176:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800177:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800181:	89 d1                	mov    %edx,%ecx
+  800183:	89 d3                	mov    %edx,%ebx
+  800185:	89 d7                	mov    %edx,%edi
+  800187:	89 d6                	mov    %edx,%esi
+  800189:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80018b:	5b                   	pop    %ebx
+  80018c:	5e                   	pop    %esi
+  80018d:	5f                   	pop    %edi
+  80018e:	5d                   	pop    %ebp
+  80018f:	c3                   	ret
+
+00800190 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800190:	55                   	push   %ebp
+  800191:	89 e5                	mov    %esp,%ebp
+  800193:	57                   	push   %edi
+  800194:	56                   	push   %esi
+  800195:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800196:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8001a0:	89 d1                	mov    %edx,%ecx
+  8001a2:	89 d3                	mov    %edx,%ebx
+  8001a4:	89 d7                	mov    %edx,%edi
+  8001a6:	89 d6                	mov    %edx,%esi
+  8001a8:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  8001aa:	5b                   	pop    %ebx
+  8001ab:	5e                   	pop    %esi
+  8001ac:	5f                   	pop    %edi
+  8001ad:	5d                   	pop    %ebp
+  8001ae:	c3                   	ret
+
+008001af <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  8001af:	55                   	push   %ebp
+  8001b0:	89 e5                	mov    %esp,%ebp
+  8001b2:	57                   	push   %edi
+  8001b3:	56                   	push   %esi
+  8001b4:	53                   	push   %ebx
+  8001b5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001c3:	b8 15 00 00 00       	mov    $0x15,%eax
+  8001c8:	89 df                	mov    %ebx,%edi
+  8001ca:	89 de                	mov    %ebx,%esi
+  8001cc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001ce:	85 c0                	test   %eax,%eax
+  8001d0:	7f 08                	jg     8001da <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  8001d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d5:	5b                   	pop    %ebx
+  8001d6:	5e                   	pop    %esi
+  8001d7:	5f                   	pop    %edi
+  8001d8:	5d                   	pop    %ebp
+  8001d9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001da:	83 ec 0c             	sub    $0xc,%esp
+  8001dd:	50                   	push   %eax
+  8001de:	6a 15                	push   $0x15
+  8001e0:	68 2a 27 80 00       	push   $0x80272a
+  8001e5:	6a 23                	push   $0x23
+  8001e7:	68 47 27 80 00       	push   $0x802747
+  8001ec:	e8 5c 15 00 00       	call   80174d <_panic>
+
+008001f1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001f1:	55                   	push   %ebp
+  8001f2:	89 e5                	mov    %esp,%ebp
+  8001f4:	57                   	push   %edi
+  8001f5:	56                   	push   %esi
+  8001f6:	53                   	push   %ebx
+  8001f7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800202:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800205:	b8 05 00 00 00       	mov    $0x5,%eax
+  80020a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80020d:	89 f7                	mov    %esi,%edi
+  80020f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800211:	85 c0                	test   %eax,%eax
+  800213:	7f 08                	jg     80021d <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800215:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800218:	5b                   	pop    %ebx
+  800219:	5e                   	pop    %esi
+  80021a:	5f                   	pop    %edi
+  80021b:	5d                   	pop    %ebp
+  80021c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80021d:	83 ec 0c             	sub    $0xc,%esp
+  800220:	50                   	push   %eax
+  800221:	6a 05                	push   $0x5
+  800223:	68 2a 27 80 00       	push   $0x80272a
+  800228:	6a 23                	push   $0x23
+  80022a:	68 47 27 80 00       	push   $0x802747
+  80022f:	e8 19 15 00 00       	call   80174d <_panic>
+
+00800234 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800234:	55                   	push   %ebp
+  800235:	89 e5                	mov    %esp,%ebp
+  800237:	57                   	push   %edi
+  800238:	56                   	push   %esi
+  800239:	53                   	push   %ebx
+  80023a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80023d:	be 00 00 00 00       	mov    $0x0,%esi
+  800242:	8b 55 08             	mov    0x8(%ebp),%edx
+  800245:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800248:	b8 06 00 00 00       	mov    $0x6,%eax
+  80024d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800250:	89 f7                	mov    %esi,%edi
+  800252:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800254:	85 c0                	test   %eax,%eax
+  800256:	7f 08                	jg     800260 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800258:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80025b:	5b                   	pop    %ebx
+  80025c:	5e                   	pop    %esi
+  80025d:	5f                   	pop    %edi
+  80025e:	5d                   	pop    %ebp
+  80025f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800260:	83 ec 0c             	sub    $0xc,%esp
+  800263:	50                   	push   %eax
+  800264:	6a 06                	push   $0x6
+  800266:	68 2a 27 80 00       	push   $0x80272a
+  80026b:	6a 23                	push   $0x23
+  80026d:	68 47 27 80 00       	push   $0x802747
+  800272:	e8 d6 14 00 00       	call   80174d <_panic>
+
+00800277 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800277:	55                   	push   %ebp
+  800278:	89 e5                	mov    %esp,%ebp
+  80027a:	57                   	push   %edi
+  80027b:	56                   	push   %esi
+  80027c:	53                   	push   %ebx
+  80027d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800280:	8b 55 08             	mov    0x8(%ebp),%edx
+  800283:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800286:	b8 07 00 00 00       	mov    $0x7,%eax
+  80028b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80028e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800291:	8b 75 18             	mov    0x18(%ebp),%esi
+  800294:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800296:	85 c0                	test   %eax,%eax
+  800298:	7f 08                	jg     8002a2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80029a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80029d:	5b                   	pop    %ebx
+  80029e:	5e                   	pop    %esi
+  80029f:	5f                   	pop    %edi
+  8002a0:	5d                   	pop    %ebp
+  8002a1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002a2:	83 ec 0c             	sub    $0xc,%esp
+  8002a5:	50                   	push   %eax
+  8002a6:	6a 07                	push   $0x7
+  8002a8:	68 2a 27 80 00       	push   $0x80272a
+  8002ad:	6a 23                	push   $0x23
+  8002af:	68 47 27 80 00       	push   $0x802747
+  8002b4:	e8 94 14 00 00       	call   80174d <_panic>
+
+008002b9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8002b9:	55                   	push   %ebp
+  8002ba:	89 e5                	mov    %esp,%ebp
+  8002bc:	57                   	push   %edi
+  8002bd:	56                   	push   %esi
+  8002be:	53                   	push   %ebx
+  8002bf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002cd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002d2:	89 df                	mov    %ebx,%edi
+  8002d4:	89 de                	mov    %ebx,%esi
+  8002d6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002d8:	85 c0                	test   %eax,%eax
+  8002da:	7f 08                	jg     8002e4 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002df:	5b                   	pop    %ebx
+  8002e0:	5e                   	pop    %esi
+  8002e1:	5f                   	pop    %edi
+  8002e2:	5d                   	pop    %ebp
+  8002e3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002e4:	83 ec 0c             	sub    $0xc,%esp
+  8002e7:	50                   	push   %eax
+  8002e8:	6a 08                	push   $0x8
+  8002ea:	68 2a 27 80 00       	push   $0x80272a
+  8002ef:	6a 23                	push   $0x23
+  8002f1:	68 47 27 80 00       	push   $0x802747
+  8002f6:	e8 52 14 00 00       	call   80174d <_panic>
+
+008002fb <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002fb:	55                   	push   %ebp
+  8002fc:	89 e5                	mov    %esp,%ebp
+  8002fe:	57                   	push   %edi
+  8002ff:	56                   	push   %esi
+  800300:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800301:	8b 55 08             	mov    0x8(%ebp),%edx
+  800304:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800307:	b8 09 00 00 00       	mov    $0x9,%eax
+  80030c:	be 00 00 00 00       	mov    $0x0,%esi
+  800311:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800314:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800317:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800319:	5b                   	pop    %ebx
+  80031a:	5e                   	pop    %esi
+  80031b:	5f                   	pop    %edi
+  80031c:	5d                   	pop    %ebp
+  80031d:	c3                   	ret
+
+0080031e <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  80031e:	55                   	push   %ebp
+  80031f:	89 e5                	mov    %esp,%ebp
+  800321:	57                   	push   %edi
+  800322:	56                   	push   %esi
+  800323:	53                   	push   %ebx
+  800324:	8b 45 18             	mov    0x18(%ebp),%eax
+  800327:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  80032a:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  80032f:	77 27                	ja     800358 <sys_page_map_range+0x3a>
+  800331:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800337:	77 1f                	ja     800358 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800339:	c1 e0 0c             	shl    $0xc,%eax
+  80033c:	89 c6                	mov    %eax,%esi
+  80033e:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800340:	8b 55 08             	mov    0x8(%ebp),%edx
+  800343:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800346:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80034b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80034e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800351:	cd 30                	int    $0x30
+}
+  800353:	5b                   	pop    %ebx
+  800354:	5e                   	pop    %esi
+  800355:	5f                   	pop    %edi
+  800356:	5d                   	pop    %ebp
+  800357:	c3                   	ret
+		return -E_INVAL;
+  800358:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80035d:	eb f4                	jmp    800353 <sys_page_map_range+0x35>
+
+0080035f <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80035f:	55                   	push   %ebp
+  800360:	89 e5                	mov    %esp,%ebp
+  800362:	57                   	push   %edi
+  800363:	56                   	push   %esi
+  800364:	53                   	push   %ebx
+  800365:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800368:	8b 55 08             	mov    0x8(%ebp),%edx
+  80036b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80036e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800373:	be 00 00 00 00       	mov    $0x0,%esi
+  800378:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80037b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80037e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800380:	85 c0                	test   %eax,%eax
+  800382:	7f 08                	jg     80038c <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800387:	5b                   	pop    %ebx
+  800388:	5e                   	pop    %esi
+  800389:	5f                   	pop    %edi
+  80038a:	5d                   	pop    %ebp
+  80038b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80038c:	83 ec 0c             	sub    $0xc,%esp
+  80038f:	50                   	push   %eax
+  800390:	6a 0c                	push   $0xc
+  800392:	68 2a 27 80 00       	push   $0x80272a
+  800397:	6a 23                	push   $0x23
+  800399:	68 47 27 80 00       	push   $0x802747
+  80039e:	e8 aa 13 00 00       	call   80174d <_panic>
+
+008003a3 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8003a3:	55                   	push   %ebp
+  8003a4:	89 e5                	mov    %esp,%ebp
+  8003a6:	57                   	push   %edi
+  8003a7:	56                   	push   %esi
+  8003a8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003b4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8003b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003bc:	89 f7                	mov    %esi,%edi
+  8003be:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003c0:	5b                   	pop    %ebx
+  8003c1:	5e                   	pop    %esi
+  8003c2:	5f                   	pop    %edi
+  8003c3:	5d                   	pop    %ebp
+  8003c4:	c3                   	ret
+
+008003c5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003c5:	55                   	push   %ebp
+  8003c6:	89 e5                	mov    %esp,%ebp
+  8003c8:	57                   	push   %edi
+  8003c9:	56                   	push   %esi
+  8003ca:	53                   	push   %ebx
+  8003cb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003de:	89 df                	mov    %ebx,%edi
+  8003e0:	89 de                	mov    %ebx,%esi
+  8003e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003e4:	85 c0                	test   %eax,%eax
+  8003e6:	7f 08                	jg     8003f0 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003eb:	5b                   	pop    %ebx
+  8003ec:	5e                   	pop    %esi
+  8003ed:	5f                   	pop    %edi
+  8003ee:	5d                   	pop    %ebp
+  8003ef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003f0:	83 ec 0c             	sub    $0xc,%esp
+  8003f3:	50                   	push   %eax
+  8003f4:	6a 0f                	push   $0xf
+  8003f6:	68 2a 27 80 00       	push   $0x80272a
+  8003fb:	6a 23                	push   $0x23
+  8003fd:	68 47 27 80 00       	push   $0x802747
+  800402:	e8 46 13 00 00       	call   80174d <_panic>
+
+00800407 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	57                   	push   %edi
+  80040b:	56                   	push   %esi
+  80040c:	53                   	push   %ebx
+  80040d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800410:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800415:	8b 55 08             	mov    0x8(%ebp),%edx
+  800418:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80041b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800420:	89 df                	mov    %ebx,%edi
+  800422:	89 de                	mov    %ebx,%esi
+  800424:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800426:	85 c0                	test   %eax,%eax
+  800428:	7f 08                	jg     800432 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  80042a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042d:	5b                   	pop    %ebx
+  80042e:	5e                   	pop    %esi
+  80042f:	5f                   	pop    %edi
+  800430:	5d                   	pop    %ebp
+  800431:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800432:	83 ec 0c             	sub    $0xc,%esp
+  800435:	50                   	push   %eax
+  800436:	6a 10                	push   $0x10
+  800438:	68 2a 27 80 00       	push   $0x80272a
+  80043d:	6a 23                	push   $0x23
+  80043f:	68 47 27 80 00       	push   $0x802747
+  800444:	e8 04 13 00 00       	call   80174d <_panic>
+
+00800449 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800449:	55                   	push   %ebp
+  80044a:	89 e5                	mov    %esp,%ebp
+  80044c:	57                   	push   %edi
+  80044d:	56                   	push   %esi
+  80044e:	53                   	push   %ebx
+  80044f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800452:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800457:	8b 55 08             	mov    0x8(%ebp),%edx
+  80045a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80045d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800462:	89 df                	mov    %ebx,%edi
+  800464:	89 de                	mov    %ebx,%esi
+  800466:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800468:	85 c0                	test   %eax,%eax
+  80046a:	7f 08                	jg     800474 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  80046c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80046f:	5b                   	pop    %ebx
+  800470:	5e                   	pop    %esi
+  800471:	5f                   	pop    %edi
+  800472:	5d                   	pop    %ebp
+  800473:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800474:	83 ec 0c             	sub    $0xc,%esp
+  800477:	50                   	push   %eax
+  800478:	6a 11                	push   $0x11
+  80047a:	68 2a 27 80 00       	push   $0x80272a
+  80047f:	6a 23                	push   $0x23
+  800481:	68 47 27 80 00       	push   $0x802747
+  800486:	e8 c2 12 00 00       	call   80174d <_panic>
+
+0080048b <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  80048b:	55                   	push   %ebp
+  80048c:	89 e5                	mov    %esp,%ebp
+  80048e:	57                   	push   %edi
+  80048f:	56                   	push   %esi
+  800490:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800491:	ba 00 00 00 00       	mov    $0x0,%edx
+  800496:	b8 12 00 00 00       	mov    $0x12,%eax
+  80049b:	89 d1                	mov    %edx,%ecx
+  80049d:	89 d3                	mov    %edx,%ebx
+  80049f:	89 d7                	mov    %edx,%edi
+  8004a1:	89 d6                	mov    %edx,%esi
+  8004a3:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  8004a5:	5b                   	pop    %ebx
+  8004a6:	5e                   	pop    %esi
+  8004a7:	5f                   	pop    %edi
+  8004a8:	5d                   	pop    %ebp
+  8004a9:	c3                   	ret
+
+008004aa <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8004aa:	55                   	push   %ebp
+  8004ab:	89 e5                	mov    %esp,%ebp
+  8004ad:	57                   	push   %edi
+  8004ae:	56                   	push   %esi
+  8004af:	53                   	push   %ebx
+  8004b0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004be:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004c3:	89 df                	mov    %ebx,%edi
+  8004c5:	89 de                	mov    %ebx,%esi
+  8004c7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004c9:	85 c0                	test   %eax,%eax
+  8004cb:	7f 08                	jg     8004d5 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8004cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004d0:	5b                   	pop    %ebx
+  8004d1:	5e                   	pop    %esi
+  8004d2:	5f                   	pop    %edi
+  8004d3:	5d                   	pop    %ebp
+  8004d4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004d5:	83 ec 0c             	sub    $0xc,%esp
+  8004d8:	50                   	push   %eax
+  8004d9:	6a 13                	push   $0x13
+  8004db:	68 2a 27 80 00       	push   $0x80272a
+  8004e0:	6a 23                	push   $0x23
+  8004e2:	68 47 27 80 00       	push   $0x802747
+  8004e7:	e8 61 12 00 00       	call   80174d <_panic>
+
+008004ec <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004ec:	55                   	push   %ebp
+  8004ed:	89 e5                	mov    %esp,%ebp
+  8004ef:	57                   	push   %edi
+  8004f0:	56                   	push   %esi
+  8004f1:	53                   	push   %ebx
+  8004f2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800500:	b8 14 00 00 00       	mov    $0x14,%eax
+  800505:	89 df                	mov    %ebx,%edi
+  800507:	89 de                	mov    %ebx,%esi
+  800509:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80050b:	85 c0                	test   %eax,%eax
+  80050d:	7f 08                	jg     800517 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80050f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800512:	5b                   	pop    %ebx
+  800513:	5e                   	pop    %esi
+  800514:	5f                   	pop    %edi
+  800515:	5d                   	pop    %ebp
+  800516:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800517:	83 ec 0c             	sub    $0xc,%esp
+  80051a:	50                   	push   %eax
+  80051b:	6a 14                	push   $0x14
+  80051d:	68 2a 27 80 00       	push   $0x80272a
+  800522:	6a 23                	push   $0x23
+  800524:	68 47 27 80 00       	push   $0x802747
+  800529:	e8 1f 12 00 00       	call   80174d <_panic>
+
+0080052e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80052e:	55                   	push   %ebp
+  80052f:	89 e5                	mov    %esp,%ebp
+  800531:	57                   	push   %edi
+  800532:	56                   	push   %esi
+  800533:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800534:	8b 55 08             	mov    0x8(%ebp),%edx
+  800537:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80053a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80053f:	be 00 00 00 00       	mov    $0x0,%esi
+  800544:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800547:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80054a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80054c:	5b                   	pop    %ebx
+  80054d:	5e                   	pop    %esi
+  80054e:	5f                   	pop    %edi
+  80054f:	5d                   	pop    %ebp
+  800550:	c3                   	ret
+
+00800551 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800551:	55                   	push   %ebp
+  800552:	89 e5                	mov    %esp,%ebp
+  800554:	57                   	push   %edi
+  800555:	56                   	push   %esi
+  800556:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800557:	8b 55 08             	mov    0x8(%ebp),%edx
+  80055a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80055d:	b8 18 00 00 00       	mov    $0x18,%eax
+  800562:	be 00 00 00 00       	mov    $0x0,%esi
+  800567:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80056a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80056d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80056f:	5b                   	pop    %ebx
+  800570:	5e                   	pop    %esi
+  800571:	5f                   	pop    %edi
+  800572:	5d                   	pop    %ebp
+  800573:	c3                   	ret
+
+00800574 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800574:	55                   	push   %ebp
+  800575:	89 e5                	mov    %esp,%ebp
+  800577:	57                   	push   %edi
+  800578:	56                   	push   %esi
+  800579:	53                   	push   %ebx
+  80057a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80057d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800582:	8b 55 08             	mov    0x8(%ebp),%edx
+  800585:	b8 19 00 00 00       	mov    $0x19,%eax
+  80058a:	89 cb                	mov    %ecx,%ebx
+  80058c:	89 cf                	mov    %ecx,%edi
+  80058e:	89 ce                	mov    %ecx,%esi
+  800590:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800592:	85 c0                	test   %eax,%eax
+  800594:	7f 08                	jg     80059e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800596:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800599:	5b                   	pop    %ebx
+  80059a:	5e                   	pop    %esi
+  80059b:	5f                   	pop    %edi
+  80059c:	5d                   	pop    %ebp
+  80059d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80059e:	83 ec 0c             	sub    $0xc,%esp
+  8005a1:	50                   	push   %eax
+  8005a2:	6a 19                	push   $0x19
+  8005a4:	68 2a 27 80 00       	push   $0x80272a
+  8005a9:	6a 23                	push   $0x23
+  8005ab:	68 47 27 80 00       	push   $0x802747
+  8005b0:	e8 98 11 00 00       	call   80174d <_panic>
+
+008005b5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8005b5:	55                   	push   %ebp
+  8005b6:	89 e5                	mov    %esp,%ebp
+  8005b8:	57                   	push   %edi
+  8005b9:	56                   	push   %esi
+  8005ba:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005c5:	89 d1                	mov    %edx,%ecx
+  8005c7:	89 d3                	mov    %edx,%ebx
+  8005c9:	89 d7                	mov    %edx,%edi
+  8005cb:	89 d6                	mov    %edx,%esi
+  8005cd:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8005cf:	5b                   	pop    %ebx
+  8005d0:	5e                   	pop    %esi
+  8005d1:	5f                   	pop    %edi
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+
+008005d4 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8005d4:	55                   	push   %ebp
+  8005d5:	89 e5                	mov    %esp,%ebp
+  8005d7:	57                   	push   %edi
+  8005d8:	56                   	push   %esi
+  8005d9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005e5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005ea:	89 df                	mov    %ebx,%edi
+  8005ec:	89 de                	mov    %ebx,%esi
+  8005ee:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8005f0:	5b                   	pop    %ebx
+  8005f1:	5e                   	pop    %esi
+  8005f2:	5f                   	pop    %edi
+  8005f3:	5d                   	pop    %ebp
+  8005f4:	c3                   	ret
+
+008005f5 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8005f5:	55                   	push   %ebp
+  8005f6:	89 e5                	mov    %esp,%ebp
+  8005f8:	57                   	push   %edi
+  8005f9:	56                   	push   %esi
+  8005fa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800600:	8b 55 08             	mov    0x8(%ebp),%edx
+  800603:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800606:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80060b:	89 df                	mov    %ebx,%edi
+  80060d:	89 de                	mov    %ebx,%esi
+  80060f:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  800611:	5b                   	pop    %ebx
+  800612:	5e                   	pop    %esi
+  800613:	5f                   	pop    %edi
+  800614:	5d                   	pop    %ebp
+  800615:	c3                   	ret
+
+00800616 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  800616:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  800617:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  80061c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80061e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  800621:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  800624:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  800628:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  80062b:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  80062f:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  800633:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  800635:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  800636:	83 c4 04             	add    $0x4,%esp
+	popf
+  800639:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80063a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80063b:	c3                   	ret
+
+0080063c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80063c:	55                   	push   %ebp
+  80063d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80063f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800642:	05 00 00 00 30       	add    $0x30000000,%eax
+  800647:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80064a:	5d                   	pop    %ebp
+  80064b:	c3                   	ret
+
+0080064c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80064c:	55                   	push   %ebp
+  80064d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80064f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800652:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800657:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80065c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800661:	5d                   	pop    %ebp
+  800662:	c3                   	ret
+
+00800663 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800663:	55                   	push   %ebp
+  800664:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800666:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80066b:	eb 02                	jmp    80066f <fd_alloc+0xc>
+  80066d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80066f:	89 c2                	mov    %eax,%edx
+  800671:	c1 ea 16             	shr    $0x16,%edx
+  800674:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80067b:	f6 c2 01             	test   $0x1,%dl
+  80067e:	74 2b                	je     8006ab <fd_alloc+0x48>
+  800680:	89 c2                	mov    %eax,%edx
+  800682:	c1 ea 0c             	shr    $0xc,%edx
+  800685:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80068c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800692:	f6 c1 01             	test   $0x1,%cl
+  800695:	74 14                	je     8006ab <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800697:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80069d:	75 ce                	jne    80066d <fd_alloc+0xa>
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8006a4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006a9:	eb 05                	jmp    8006b0 <fd_alloc+0x4d>
+			return 0;
+  8006ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8006b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006b3:	89 02                	mov    %eax,(%edx)
+}
+  8006b5:	89 c8                	mov    %ecx,%eax
+  8006b7:	5d                   	pop    %ebp
+  8006b8:	c3                   	ret
+
+008006b9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006b9:	55                   	push   %ebp
+  8006ba:	89 e5                	mov    %esp,%ebp
+  8006bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8006bf:	83 f8 1f             	cmp    $0x1f,%eax
+  8006c2:	77 30                	ja     8006f4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8006c4:	c1 e0 0c             	shl    $0xc,%eax
+  8006c7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8006cc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006d2:	f6 c2 01             	test   $0x1,%dl
+  8006d5:	74 24                	je     8006fb <fd_lookup+0x42>
+  8006d7:	89 c2                	mov    %eax,%edx
+  8006d9:	c1 ea 0c             	shr    $0xc,%edx
+  8006dc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006e3:	f6 c2 01             	test   $0x1,%dl
+  8006e6:	74 1a                	je     800702 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006eb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006f2:	5d                   	pop    %ebp
+  8006f3:	c3                   	ret
+		return -E_INVAL;
+  8006f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006f9:	eb f7                	jmp    8006f2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8006fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800700:	eb f0                	jmp    8006f2 <fd_lookup+0x39>
+  800702:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800707:	eb e9                	jmp    8006f2 <fd_lookup+0x39>
+
+00800709 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800709:	55                   	push   %ebp
+  80070a:	89 e5                	mov    %esp,%ebp
+  80070c:	53                   	push   %ebx
+  80070d:	83 ec 04             	sub    $0x4,%esp
+  800710:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800713:	b8 00 00 00 00       	mov    $0x0,%eax
+  800718:	eb 03                	jmp    80071d <dev_lookup+0x14>
+  80071a:	83 c0 01             	add    $0x1,%eax
+  80071d:	8b 1c 85 d4 27 80 00 	mov    0x8027d4(,%eax,4),%ebx
+  800724:	85 db                	test   %ebx,%ebx
+  800726:	74 0b                	je     800733 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800728:	39 13                	cmp    %edx,(%ebx)
+  80072a:	75 ee                	jne    80071a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80072c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800731:	eb 1f                	jmp    800752 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800733:	a1 08 40 80 00       	mov    0x804008,%eax
+  800738:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80073b:	83 ec 04             	sub    $0x4,%esp
+  80073e:	52                   	push   %edx
+  80073f:	50                   	push   %eax
+  800740:	68 58 27 80 00       	push   $0x802758
+  800745:	e8 de 10 00 00       	call   801828 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80074a:	83 c4 10             	add    $0x10,%esp
+  80074d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800752:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800755:	89 1a                	mov    %ebx,(%edx)
+}
+  800757:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80075a:	c9                   	leave
+  80075b:	c3                   	ret
+
+0080075c <fd_close>:
+{
+  80075c:	55                   	push   %ebp
+  80075d:	89 e5                	mov    %esp,%ebp
+  80075f:	57                   	push   %edi
+  800760:	56                   	push   %esi
+  800761:	53                   	push   %ebx
+  800762:	83 ec 24             	sub    $0x24,%esp
+  800765:	8b 75 08             	mov    0x8(%ebp),%esi
+  800768:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80076b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80076e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80076f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800775:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800778:	50                   	push   %eax
+  800779:	e8 3b ff ff ff       	call   8006b9 <fd_lookup>
+  80077e:	89 c3                	mov    %eax,%ebx
+  800780:	83 c4 10             	add    $0x10,%esp
+  800783:	85 c0                	test   %eax,%eax
+  800785:	78 05                	js     80078c <fd_close+0x30>
+	    || fd != fd2)
+  800787:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80078a:	74 16                	je     8007a2 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80078c:	89 f8                	mov    %edi,%eax
+  80078e:	84 c0                	test   %al,%al
+  800790:	b8 00 00 00 00       	mov    $0x0,%eax
+  800795:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800798:	89 d8                	mov    %ebx,%eax
+  80079a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80079d:	5b                   	pop    %ebx
+  80079e:	5e                   	pop    %esi
+  80079f:	5f                   	pop    %edi
+  8007a0:	5d                   	pop    %ebp
+  8007a1:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007a2:	83 ec 08             	sub    $0x8,%esp
+  8007a5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007a8:	50                   	push   %eax
+  8007a9:	ff 36                	push   (%esi)
+  8007ab:	e8 59 ff ff ff       	call   800709 <dev_lookup>
+  8007b0:	89 c3                	mov    %eax,%ebx
+  8007b2:	83 c4 10             	add    $0x10,%esp
+  8007b5:	85 c0                	test   %eax,%eax
+  8007b7:	78 1a                	js     8007d3 <fd_close+0x77>
+		if (dev->dev_close)
+  8007b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007bc:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8007bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8007c4:	85 c0                	test   %eax,%eax
+  8007c6:	74 0b                	je     8007d3 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8007c8:	83 ec 0c             	sub    $0xc,%esp
+  8007cb:	56                   	push   %esi
+  8007cc:	ff d0                	call   *%eax
+  8007ce:	89 c3                	mov    %eax,%ebx
+  8007d0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007d3:	83 ec 08             	sub    $0x8,%esp
+  8007d6:	56                   	push   %esi
+  8007d7:	6a 00                	push   $0x0
+  8007d9:	e8 db fa ff ff       	call   8002b9 <sys_page_unmap>
+	return r;
+  8007de:	83 c4 10             	add    $0x10,%esp
+  8007e1:	eb b5                	jmp    800798 <fd_close+0x3c>
+
+008007e3 <close>:
+
+int
+close(int fdnum)
+{
+  8007e3:	55                   	push   %ebp
+  8007e4:	89 e5                	mov    %esp,%ebp
+  8007e6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007ec:	50                   	push   %eax
+  8007ed:	ff 75 08             	push   0x8(%ebp)
+  8007f0:	e8 c4 fe ff ff       	call   8006b9 <fd_lookup>
+  8007f5:	83 c4 10             	add    $0x10,%esp
+  8007f8:	85 c0                	test   %eax,%eax
+  8007fa:	79 02                	jns    8007fe <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007fc:	c9                   	leave
+  8007fd:	c3                   	ret
+		return fd_close(fd, 1);
+  8007fe:	83 ec 08             	sub    $0x8,%esp
+  800801:	6a 01                	push   $0x1
+  800803:	ff 75 f4             	push   -0xc(%ebp)
+  800806:	e8 51 ff ff ff       	call   80075c <fd_close>
+  80080b:	83 c4 10             	add    $0x10,%esp
+  80080e:	eb ec                	jmp    8007fc <close+0x19>
+
+00800810 <close_all>:
+
+void
+close_all(void)
+{
+  800810:	55                   	push   %ebp
+  800811:	89 e5                	mov    %esp,%ebp
+  800813:	53                   	push   %ebx
+  800814:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800817:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80081c:	83 ec 0c             	sub    $0xc,%esp
+  80081f:	53                   	push   %ebx
+  800820:	e8 be ff ff ff       	call   8007e3 <close>
+	for (i = 0; i < MAXFD; i++)
+  800825:	83 c3 01             	add    $0x1,%ebx
+  800828:	83 c4 10             	add    $0x10,%esp
+  80082b:	83 fb 20             	cmp    $0x20,%ebx
+  80082e:	75 ec                	jne    80081c <close_all+0xc>
+}
+  800830:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800833:	c9                   	leave
+  800834:	c3                   	ret
+
+00800835 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800835:	55                   	push   %ebp
+  800836:	89 e5                	mov    %esp,%ebp
+  800838:	57                   	push   %edi
+  800839:	56                   	push   %esi
+  80083a:	53                   	push   %ebx
+  80083b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80083e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800841:	50                   	push   %eax
+  800842:	ff 75 08             	push   0x8(%ebp)
+  800845:	e8 6f fe ff ff       	call   8006b9 <fd_lookup>
+  80084a:	89 c3                	mov    %eax,%ebx
+  80084c:	83 c4 10             	add    $0x10,%esp
+  80084f:	85 c0                	test   %eax,%eax
+  800851:	78 7f                	js     8008d2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800853:	83 ec 0c             	sub    $0xc,%esp
+  800856:	ff 75 0c             	push   0xc(%ebp)
+  800859:	e8 85 ff ff ff       	call   8007e3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80085e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800861:	c1 e6 0c             	shl    $0xc,%esi
+  800864:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80086a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80086d:	89 3c 24             	mov    %edi,(%esp)
+  800870:	e8 d7 fd ff ff       	call   80064c <fd2data>
+  800875:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800877:	89 34 24             	mov    %esi,(%esp)
+  80087a:	e8 cd fd ff ff       	call   80064c <fd2data>
+  80087f:	83 c4 10             	add    $0x10,%esp
+  800882:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800885:	89 d8                	mov    %ebx,%eax
+  800887:	c1 e8 16             	shr    $0x16,%eax
+  80088a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800891:	a8 01                	test   $0x1,%al
+  800893:	74 11                	je     8008a6 <dup+0x71>
+  800895:	89 d8                	mov    %ebx,%eax
+  800897:	c1 e8 0c             	shr    $0xc,%eax
+  80089a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8008a1:	f6 c2 01             	test   $0x1,%dl
+  8008a4:	75 36                	jne    8008dc <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8008a6:	89 f8                	mov    %edi,%eax
+  8008a8:	c1 e8 0c             	shr    $0xc,%eax
+  8008ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008b2:	83 ec 0c             	sub    $0xc,%esp
+  8008b5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008ba:	50                   	push   %eax
+  8008bb:	56                   	push   %esi
+  8008bc:	6a 00                	push   $0x0
+  8008be:	57                   	push   %edi
+  8008bf:	6a 00                	push   $0x0
+  8008c1:	e8 b1 f9 ff ff       	call   800277 <sys_page_map>
+  8008c6:	89 c3                	mov    %eax,%ebx
+  8008c8:	83 c4 20             	add    $0x20,%esp
+  8008cb:	85 c0                	test   %eax,%eax
+  8008cd:	78 33                	js     800902 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008d2:	89 d8                	mov    %ebx,%eax
+  8008d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008d7:	5b                   	pop    %ebx
+  8008d8:	5e                   	pop    %esi
+  8008d9:	5f                   	pop    %edi
+  8008da:	5d                   	pop    %ebp
+  8008db:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008e3:	83 ec 0c             	sub    $0xc,%esp
+  8008e6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008eb:	50                   	push   %eax
+  8008ec:	ff 75 d4             	push   -0x2c(%ebp)
+  8008ef:	6a 00                	push   $0x0
+  8008f1:	53                   	push   %ebx
+  8008f2:	6a 00                	push   $0x0
+  8008f4:	e8 7e f9 ff ff       	call   800277 <sys_page_map>
+  8008f9:	89 c3                	mov    %eax,%ebx
+  8008fb:	83 c4 20             	add    $0x20,%esp
+  8008fe:	85 c0                	test   %eax,%eax
+  800900:	79 a4                	jns    8008a6 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800902:	83 ec 08             	sub    $0x8,%esp
+  800905:	56                   	push   %esi
+  800906:	6a 00                	push   $0x0
+  800908:	e8 ac f9 ff ff       	call   8002b9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80090d:	83 c4 08             	add    $0x8,%esp
+  800910:	ff 75 d4             	push   -0x2c(%ebp)
+  800913:	6a 00                	push   $0x0
+  800915:	e8 9f f9 ff ff       	call   8002b9 <sys_page_unmap>
+	return r;
+  80091a:	83 c4 10             	add    $0x10,%esp
+  80091d:	eb b3                	jmp    8008d2 <dup+0x9d>
+
+0080091f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80091f:	55                   	push   %ebp
+  800920:	89 e5                	mov    %esp,%ebp
+  800922:	56                   	push   %esi
+  800923:	53                   	push   %ebx
+  800924:	83 ec 18             	sub    $0x18,%esp
+  800927:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80092a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80092d:	50                   	push   %eax
+  80092e:	56                   	push   %esi
+  80092f:	e8 85 fd ff ff       	call   8006b9 <fd_lookup>
+  800934:	83 c4 10             	add    $0x10,%esp
+  800937:	85 c0                	test   %eax,%eax
+  800939:	78 3c                	js     800977 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80093b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80093e:	83 ec 08             	sub    $0x8,%esp
+  800941:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800944:	50                   	push   %eax
+  800945:	ff 33                	push   (%ebx)
+  800947:	e8 bd fd ff ff       	call   800709 <dev_lookup>
+  80094c:	83 c4 10             	add    $0x10,%esp
+  80094f:	85 c0                	test   %eax,%eax
+  800951:	78 24                	js     800977 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800953:	8b 43 08             	mov    0x8(%ebx),%eax
+  800956:	83 e0 03             	and    $0x3,%eax
+  800959:	83 f8 01             	cmp    $0x1,%eax
+  80095c:	74 20                	je     80097e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80095e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800961:	8b 40 08             	mov    0x8(%eax),%eax
+  800964:	85 c0                	test   %eax,%eax
+  800966:	74 37                	je     80099f <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800968:	83 ec 04             	sub    $0x4,%esp
+  80096b:	ff 75 10             	push   0x10(%ebp)
+  80096e:	ff 75 0c             	push   0xc(%ebp)
+  800971:	53                   	push   %ebx
+  800972:	ff d0                	call   *%eax
+  800974:	83 c4 10             	add    $0x10,%esp
+}
+  800977:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80097a:	5b                   	pop    %ebx
+  80097b:	5e                   	pop    %esi
+  80097c:	5d                   	pop    %ebp
+  80097d:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80097e:	a1 08 40 80 00       	mov    0x804008,%eax
+  800983:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800986:	83 ec 04             	sub    $0x4,%esp
+  800989:	56                   	push   %esi
+  80098a:	50                   	push   %eax
+  80098b:	68 99 27 80 00       	push   $0x802799
+  800990:	e8 93 0e 00 00       	call   801828 <cprintf>
+		return -E_INVAL;
+  800995:	83 c4 10             	add    $0x10,%esp
+  800998:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80099d:	eb d8                	jmp    800977 <read+0x58>
+		return -E_NOT_SUPP;
+  80099f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009a4:	eb d1                	jmp    800977 <read+0x58>
+
+008009a6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8009a6:	55                   	push   %ebp
+  8009a7:	89 e5                	mov    %esp,%ebp
+  8009a9:	57                   	push   %edi
+  8009aa:	56                   	push   %esi
+  8009ab:	53                   	push   %ebx
+  8009ac:	83 ec 0c             	sub    $0xc,%esp
+  8009af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009b2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8009b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009ba:	eb 02                	jmp    8009be <readn+0x18>
+  8009bc:	01 c3                	add    %eax,%ebx
+  8009be:	39 f3                	cmp    %esi,%ebx
+  8009c0:	73 21                	jae    8009e3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009c2:	83 ec 04             	sub    $0x4,%esp
+  8009c5:	89 f0                	mov    %esi,%eax
+  8009c7:	29 d8                	sub    %ebx,%eax
+  8009c9:	50                   	push   %eax
+  8009ca:	89 d8                	mov    %ebx,%eax
+  8009cc:	03 45 0c             	add    0xc(%ebp),%eax
+  8009cf:	50                   	push   %eax
+  8009d0:	57                   	push   %edi
+  8009d1:	e8 49 ff ff ff       	call   80091f <read>
+		if (m < 0)
+  8009d6:	83 c4 10             	add    $0x10,%esp
+  8009d9:	85 c0                	test   %eax,%eax
+  8009db:	78 04                	js     8009e1 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8009dd:	75 dd                	jne    8009bc <readn+0x16>
+  8009df:	eb 02                	jmp    8009e3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009e1:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8009e3:	89 d8                	mov    %ebx,%eax
+  8009e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009e8:	5b                   	pop    %ebx
+  8009e9:	5e                   	pop    %esi
+  8009ea:	5f                   	pop    %edi
+  8009eb:	5d                   	pop    %ebp
+  8009ec:	c3                   	ret
+
+008009ed <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009ed:	55                   	push   %ebp
+  8009ee:	89 e5                	mov    %esp,%ebp
+  8009f0:	56                   	push   %esi
+  8009f1:	53                   	push   %ebx
+  8009f2:	83 ec 18             	sub    $0x18,%esp
+  8009f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009f8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009fb:	50                   	push   %eax
+  8009fc:	53                   	push   %ebx
+  8009fd:	e8 b7 fc ff ff       	call   8006b9 <fd_lookup>
+  800a02:	83 c4 10             	add    $0x10,%esp
+  800a05:	85 c0                	test   %eax,%eax
+  800a07:	78 37                	js     800a40 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a09:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a0c:	83 ec 08             	sub    $0x8,%esp
+  800a0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a12:	50                   	push   %eax
+  800a13:	ff 36                	push   (%esi)
+  800a15:	e8 ef fc ff ff       	call   800709 <dev_lookup>
+  800a1a:	83 c4 10             	add    $0x10,%esp
+  800a1d:	85 c0                	test   %eax,%eax
+  800a1f:	78 1f                	js     800a40 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a21:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a25:	74 20                	je     800a47 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800a27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a2a:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a2d:	85 c0                	test   %eax,%eax
+  800a2f:	74 37                	je     800a68 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a31:	83 ec 04             	sub    $0x4,%esp
+  800a34:	ff 75 10             	push   0x10(%ebp)
+  800a37:	ff 75 0c             	push   0xc(%ebp)
+  800a3a:	56                   	push   %esi
+  800a3b:	ff d0                	call   *%eax
+  800a3d:	83 c4 10             	add    $0x10,%esp
+}
+  800a40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a43:	5b                   	pop    %ebx
+  800a44:	5e                   	pop    %esi
+  800a45:	5d                   	pop    %ebp
+  800a46:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a47:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a4c:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800a4f:	83 ec 04             	sub    $0x4,%esp
+  800a52:	53                   	push   %ebx
+  800a53:	50                   	push   %eax
+  800a54:	68 b5 27 80 00       	push   $0x8027b5
+  800a59:	e8 ca 0d 00 00       	call   801828 <cprintf>
+		return -E_INVAL;
+  800a5e:	83 c4 10             	add    $0x10,%esp
+  800a61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a66:	eb d8                	jmp    800a40 <write+0x53>
+		return -E_NOT_SUPP;
+  800a68:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a6d:	eb d1                	jmp    800a40 <write+0x53>
+
+00800a6f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a6f:	55                   	push   %ebp
+  800a70:	89 e5                	mov    %esp,%ebp
+  800a72:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a78:	50                   	push   %eax
+  800a79:	ff 75 08             	push   0x8(%ebp)
+  800a7c:	e8 38 fc ff ff       	call   8006b9 <fd_lookup>
+  800a81:	83 c4 10             	add    $0x10,%esp
+  800a84:	85 c0                	test   %eax,%eax
+  800a86:	78 0e                	js     800a96 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800a88:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a8e:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800a91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a96:	c9                   	leave
+  800a97:	c3                   	ret
+
+00800a98 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a98:	55                   	push   %ebp
+  800a99:	89 e5                	mov    %esp,%ebp
+  800a9b:	56                   	push   %esi
+  800a9c:	53                   	push   %ebx
+  800a9d:	83 ec 18             	sub    $0x18,%esp
+  800aa0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800aa3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800aa6:	50                   	push   %eax
+  800aa7:	53                   	push   %ebx
+  800aa8:	e8 0c fc ff ff       	call   8006b9 <fd_lookup>
+  800aad:	83 c4 10             	add    $0x10,%esp
+  800ab0:	85 c0                	test   %eax,%eax
+  800ab2:	78 34                	js     800ae8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800ab4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ab7:	83 ec 08             	sub    $0x8,%esp
+  800aba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800abd:	50                   	push   %eax
+  800abe:	ff 36                	push   (%esi)
+  800ac0:	e8 44 fc ff ff       	call   800709 <dev_lookup>
+  800ac5:	83 c4 10             	add    $0x10,%esp
+  800ac8:	85 c0                	test   %eax,%eax
+  800aca:	78 1c                	js     800ae8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800acc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ad0:	74 1d                	je     800aef <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800ad2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ad5:	8b 40 18             	mov    0x18(%eax),%eax
+  800ad8:	85 c0                	test   %eax,%eax
+  800ada:	74 34                	je     800b10 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800adc:	83 ec 08             	sub    $0x8,%esp
+  800adf:	ff 75 0c             	push   0xc(%ebp)
+  800ae2:	56                   	push   %esi
+  800ae3:	ff d0                	call   *%eax
+  800ae5:	83 c4 10             	add    $0x10,%esp
+}
+  800ae8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aeb:	5b                   	pop    %ebx
+  800aec:	5e                   	pop    %esi
+  800aed:	5d                   	pop    %ebp
+  800aee:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800aef:	a1 08 40 80 00       	mov    0x804008,%eax
+  800af4:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800af7:	83 ec 04             	sub    $0x4,%esp
+  800afa:	53                   	push   %ebx
+  800afb:	50                   	push   %eax
+  800afc:	68 78 27 80 00       	push   $0x802778
+  800b01:	e8 22 0d 00 00       	call   801828 <cprintf>
+		return -E_INVAL;
+  800b06:	83 c4 10             	add    $0x10,%esp
+  800b09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b0e:	eb d8                	jmp    800ae8 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800b10:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b15:	eb d1                	jmp    800ae8 <ftruncate+0x50>
+
+00800b17 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b17:	55                   	push   %ebp
+  800b18:	89 e5                	mov    %esp,%ebp
+  800b1a:	56                   	push   %esi
+  800b1b:	53                   	push   %ebx
+  800b1c:	83 ec 18             	sub    $0x18,%esp
+  800b1f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b22:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b25:	50                   	push   %eax
+  800b26:	ff 75 08             	push   0x8(%ebp)
+  800b29:	e8 8b fb ff ff       	call   8006b9 <fd_lookup>
+  800b2e:	83 c4 10             	add    $0x10,%esp
+  800b31:	85 c0                	test   %eax,%eax
+  800b33:	78 49                	js     800b7e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b35:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b38:	83 ec 08             	sub    $0x8,%esp
+  800b3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b3e:	50                   	push   %eax
+  800b3f:	ff 36                	push   (%esi)
+  800b41:	e8 c3 fb ff ff       	call   800709 <dev_lookup>
+  800b46:	83 c4 10             	add    $0x10,%esp
+  800b49:	85 c0                	test   %eax,%eax
+  800b4b:	78 31                	js     800b7e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b50:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b54:	74 2f                	je     800b85 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b56:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b59:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b60:	00 00 00 
+	stat->st_isdir = 0;
+  800b63:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b6a:	00 00 00 
+	stat->st_dev = dev;
+  800b6d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b73:	83 ec 08             	sub    $0x8,%esp
+  800b76:	53                   	push   %ebx
+  800b77:	56                   	push   %esi
+  800b78:	ff 50 14             	call   *0x14(%eax)
+  800b7b:	83 c4 10             	add    $0x10,%esp
+}
+  800b7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b81:	5b                   	pop    %ebx
+  800b82:	5e                   	pop    %esi
+  800b83:	5d                   	pop    %ebp
+  800b84:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b85:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b8a:	eb f2                	jmp    800b7e <fstat+0x67>
+
+00800b8c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b8c:	55                   	push   %ebp
+  800b8d:	89 e5                	mov    %esp,%ebp
+  800b8f:	56                   	push   %esi
+  800b90:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800b91:	83 ec 08             	sub    $0x8,%esp
+  800b94:	6a 00                	push   $0x0
+  800b96:	ff 75 08             	push   0x8(%ebp)
+  800b99:	e8 e4 01 00 00       	call   800d82 <open>
+  800b9e:	89 c3                	mov    %eax,%ebx
+  800ba0:	83 c4 10             	add    $0x10,%esp
+  800ba3:	85 c0                	test   %eax,%eax
+  800ba5:	78 1b                	js     800bc2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800ba7:	83 ec 08             	sub    $0x8,%esp
+  800baa:	ff 75 0c             	push   0xc(%ebp)
+  800bad:	50                   	push   %eax
+  800bae:	e8 64 ff ff ff       	call   800b17 <fstat>
+  800bb3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800bb5:	89 1c 24             	mov    %ebx,(%esp)
+  800bb8:	e8 26 fc ff ff       	call   8007e3 <close>
+	return r;
+  800bbd:	83 c4 10             	add    $0x10,%esp
+  800bc0:	89 f3                	mov    %esi,%ebx
+}
+  800bc2:	89 d8                	mov    %ebx,%eax
+  800bc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bc7:	5b                   	pop    %ebx
+  800bc8:	5e                   	pop    %esi
+  800bc9:	5d                   	pop    %ebp
+  800bca:	c3                   	ret
+
+00800bcb <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800bcb:	55                   	push   %ebp
+  800bcc:	89 e5                	mov    %esp,%ebp
+  800bce:	56                   	push   %esi
+  800bcf:	53                   	push   %ebx
+  800bd0:	89 c6                	mov    %eax,%esi
+  800bd2:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800bd4:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800bdb:	74 27                	je     800c04 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800bdd:	6a 07                	push   $0x7
+  800bdf:	68 00 50 80 00       	push   $0x805000
+  800be4:	56                   	push   %esi
+  800be5:	ff 35 00 40 80 00    	push   0x804000
+  800beb:	e8 39 16 00 00       	call   802229 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800bf0:	83 c4 0c             	add    $0xc,%esp
+  800bf3:	6a 00                	push   $0x0
+  800bf5:	53                   	push   %ebx
+  800bf6:	6a 00                	push   $0x0
+  800bf8:	e8 b4 15 00 00       	call   8021b1 <ipc_recv>
+}
+  800bfd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c00:	5b                   	pop    %ebx
+  800c01:	5e                   	pop    %esi
+  800c02:	5d                   	pop    %ebp
+  800c03:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800c04:	83 ec 0c             	sub    $0xc,%esp
+  800c07:	6a 01                	push   $0x1
+  800c09:	e8 6f 16 00 00       	call   80227d <ipc_find_env>
+  800c0e:	a3 00 40 80 00       	mov    %eax,0x804000
+  800c13:	83 c4 10             	add    $0x10,%esp
+  800c16:	eb c5                	jmp    800bdd <fsipc+0x12>
+
+00800c18 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800c18:	55                   	push   %ebp
+  800c19:	89 e5                	mov    %esp,%ebp
+  800c1b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800c1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c21:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c24:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800c29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c2c:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800c31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c36:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c3b:	e8 8b ff ff ff       	call   800bcb <fsipc>
+}
+  800c40:	c9                   	leave
+  800c41:	c3                   	ret
+
+00800c42 <devfile_flush>:
+{
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800c48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c4e:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800c53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c58:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c5d:	e8 69 ff ff ff       	call   800bcb <fsipc>
+}
+  800c62:	c9                   	leave
+  800c63:	c3                   	ret
+
+00800c64 <devfile_stat>:
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	53                   	push   %ebx
+  800c68:	83 ec 04             	sub    $0x4,%esp
+  800c6b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800c6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c71:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c74:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800c79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c83:	e8 43 ff ff ff       	call   800bcb <fsipc>
+  800c88:	85 c0                	test   %eax,%eax
+  800c8a:	78 2c                	js     800cb8 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800c8c:	83 ec 08             	sub    $0x8,%esp
+  800c8f:	68 00 50 80 00       	push   $0x805000
+  800c94:	53                   	push   %ebx
+  800c95:	e8 7c 11 00 00       	call   801e16 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800c9a:	a1 80 50 80 00       	mov    0x805080,%eax
+  800c9f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800ca5:	a1 84 50 80 00       	mov    0x805084,%eax
+  800caa:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800cb0:	83 c4 10             	add    $0x10,%esp
+  800cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cbb:	c9                   	leave
+  800cbc:	c3                   	ret
+
+00800cbd <devfile_write>:
+{
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	83 ec 0c             	sub    $0xc,%esp
+  800cc3:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800cc6:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800ccb:	39 d0                	cmp    %edx,%eax
+  800ccd:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800cd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd3:	8b 52 0c             	mov    0xc(%edx),%edx
+  800cd6:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800cdc:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800ce1:	50                   	push   %eax
+  800ce2:	ff 75 0c             	push   0xc(%ebp)
+  800ce5:	68 08 50 80 00       	push   $0x805008
+  800cea:	e8 ad 12 00 00       	call   801f9c <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800cef:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cf9:	e8 cd fe ff ff       	call   800bcb <fsipc>
+}
+  800cfe:	c9                   	leave
+  800cff:	c3                   	ret
+
+00800d00 <devfile_read>:
+{
+  800d00:	55                   	push   %ebp
+  800d01:	89 e5                	mov    %esp,%ebp
+  800d03:	56                   	push   %esi
+  800d04:	53                   	push   %ebx
+  800d05:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800d08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d0e:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800d13:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800d19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d23:	e8 a3 fe ff ff       	call   800bcb <fsipc>
+  800d28:	89 c3                	mov    %eax,%ebx
+  800d2a:	85 c0                	test   %eax,%eax
+  800d2c:	78 1f                	js     800d4d <devfile_read+0x4d>
+	assert(r <= n);
+  800d2e:	39 c6                	cmp    %eax,%esi
+  800d30:	72 24                	jb     800d56 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  800d32:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800d37:	7f 33                	jg     800d6c <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800d39:	83 ec 04             	sub    $0x4,%esp
+  800d3c:	50                   	push   %eax
+  800d3d:	68 00 50 80 00       	push   $0x805000
+  800d42:	ff 75 0c             	push   0xc(%ebp)
+  800d45:	e8 52 12 00 00       	call   801f9c <memmove>
+	return r;
+  800d4a:	83 c4 10             	add    $0x10,%esp
+}
+  800d4d:	89 d8                	mov    %ebx,%eax
+  800d4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d52:	5b                   	pop    %ebx
+  800d53:	5e                   	pop    %esi
+  800d54:	5d                   	pop    %ebp
+  800d55:	c3                   	ret
+	assert(r <= n);
+  800d56:	68 e8 27 80 00       	push   $0x8027e8
+  800d5b:	68 ef 27 80 00       	push   $0x8027ef
+  800d60:	6a 7c                	push   $0x7c
+  800d62:	68 04 28 80 00       	push   $0x802804
+  800d67:	e8 e1 09 00 00       	call   80174d <_panic>
+	assert(r <= PGSIZE);
+  800d6c:	68 0f 28 80 00       	push   $0x80280f
+  800d71:	68 ef 27 80 00       	push   $0x8027ef
+  800d76:	6a 7d                	push   $0x7d
+  800d78:	68 04 28 80 00       	push   $0x802804
+  800d7d:	e8 cb 09 00 00       	call   80174d <_panic>
+
+00800d82 <open>:
+{
+  800d82:	55                   	push   %ebp
+  800d83:	89 e5                	mov    %esp,%ebp
+  800d85:	56                   	push   %esi
+  800d86:	53                   	push   %ebx
+  800d87:	83 ec 1c             	sub    $0x1c,%esp
+  800d8a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800d8d:	56                   	push   %esi
+  800d8e:	e8 48 10 00 00       	call   801ddb <strlen>
+  800d93:	83 c4 10             	add    $0x10,%esp
+  800d96:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800d9b:	7f 6c                	jg     800e09 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800d9d:	83 ec 0c             	sub    $0xc,%esp
+  800da0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800da3:	50                   	push   %eax
+  800da4:	e8 ba f8 ff ff       	call   800663 <fd_alloc>
+  800da9:	89 c3                	mov    %eax,%ebx
+  800dab:	83 c4 10             	add    $0x10,%esp
+  800dae:	85 c0                	test   %eax,%eax
+  800db0:	78 3c                	js     800dee <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800db2:	83 ec 08             	sub    $0x8,%esp
+  800db5:	56                   	push   %esi
+  800db6:	68 00 50 80 00       	push   $0x805000
+  800dbb:	e8 56 10 00 00       	call   801e16 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800dc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dc3:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800dc8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800dcb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd0:	e8 f6 fd ff ff       	call   800bcb <fsipc>
+  800dd5:	89 c3                	mov    %eax,%ebx
+  800dd7:	83 c4 10             	add    $0x10,%esp
+  800dda:	85 c0                	test   %eax,%eax
+  800ddc:	78 19                	js     800df7 <open+0x75>
+	return fd2num(fd);
+  800dde:	83 ec 0c             	sub    $0xc,%esp
+  800de1:	ff 75 f4             	push   -0xc(%ebp)
+  800de4:	e8 53 f8 ff ff       	call   80063c <fd2num>
+  800de9:	89 c3                	mov    %eax,%ebx
+  800deb:	83 c4 10             	add    $0x10,%esp
+}
+  800dee:	89 d8                	mov    %ebx,%eax
+  800df0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800df3:	5b                   	pop    %ebx
+  800df4:	5e                   	pop    %esi
+  800df5:	5d                   	pop    %ebp
+  800df6:	c3                   	ret
+		fd_close(fd, 0);
+  800df7:	83 ec 08             	sub    $0x8,%esp
+  800dfa:	6a 00                	push   $0x0
+  800dfc:	ff 75 f4             	push   -0xc(%ebp)
+  800dff:	e8 58 f9 ff ff       	call   80075c <fd_close>
+		return r;
+  800e04:	83 c4 10             	add    $0x10,%esp
+  800e07:	eb e5                	jmp    800dee <open+0x6c>
+		return -E_BAD_PATH;
+  800e09:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800e0e:	eb de                	jmp    800dee <open+0x6c>
+
+00800e10 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800e10:	55                   	push   %ebp
+  800e11:	89 e5                	mov    %esp,%ebp
+  800e13:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800e16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1b:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e20:	e8 a6 fd ff ff       	call   800bcb <fsipc>
+}
+  800e25:	c9                   	leave
+  800e26:	c3                   	ret
+
+00800e27 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800e2d:	68 1b 28 80 00       	push   $0x80281b
+  800e32:	ff 75 0c             	push   0xc(%ebp)
+  800e35:	e8 dc 0f 00 00       	call   801e16 <strcpy>
+	return 0;
+}
+  800e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3f:	c9                   	leave
+  800e40:	c3                   	ret
+
+00800e41 <devsock_close>:
+{
+  800e41:	55                   	push   %ebp
+  800e42:	89 e5                	mov    %esp,%ebp
+  800e44:	53                   	push   %ebx
+  800e45:	83 ec 10             	sub    $0x10,%esp
+  800e48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800e4b:	53                   	push   %ebx
+  800e4c:	e8 3c 14 00 00       	call   80228d <pageref>
+  800e51:	89 c2                	mov    %eax,%edx
+  800e53:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e56:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800e5b:	83 fa 01             	cmp    $0x1,%edx
+  800e5e:	74 05                	je     800e65 <devsock_close+0x24>
+}
+  800e60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e63:	c9                   	leave
+  800e64:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+  800e68:	ff 73 0c             	push   0xc(%ebx)
+  800e6b:	e8 b7 02 00 00       	call   801127 <nsipc_close>
+  800e70:	83 c4 10             	add    $0x10,%esp
+  800e73:	eb eb                	jmp    800e60 <devsock_close+0x1f>
+
+00800e75 <devsock_write>:
+{
+  800e75:	55                   	push   %ebp
+  800e76:	89 e5                	mov    %esp,%ebp
+  800e78:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800e7b:	6a 00                	push   $0x0
+  800e7d:	ff 75 10             	push   0x10(%ebp)
+  800e80:	ff 75 0c             	push   0xc(%ebp)
+  800e83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e86:	ff 70 0c             	push   0xc(%eax)
+  800e89:	e8 79 03 00 00       	call   801207 <nsipc_send>
+}
+  800e8e:	c9                   	leave
+  800e8f:	c3                   	ret
+
+00800e90 <devsock_read>:
+{
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800e96:	6a 00                	push   $0x0
+  800e98:	ff 75 10             	push   0x10(%ebp)
+  800e9b:	ff 75 0c             	push   0xc(%ebp)
+  800e9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ea1:	ff 70 0c             	push   0xc(%eax)
+  800ea4:	e8 ef 02 00 00       	call   801198 <nsipc_recv>
+}
+  800ea9:	c9                   	leave
+  800eaa:	c3                   	ret
+
+00800eab <fd2sockid>:
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800eb1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800eb4:	52                   	push   %edx
+  800eb5:	50                   	push   %eax
+  800eb6:	e8 fe f7 ff ff       	call   8006b9 <fd_lookup>
+  800ebb:	83 c4 10             	add    $0x10,%esp
+  800ebe:	85 c0                	test   %eax,%eax
+  800ec0:	78 10                	js     800ed2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800ec2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ec5:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800ecb:	39 08                	cmp    %ecx,(%eax)
+  800ecd:	75 05                	jne    800ed4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800ecf:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800ed2:	c9                   	leave
+  800ed3:	c3                   	ret
+		return -E_NOT_SUPP;
+  800ed4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ed9:	eb f7                	jmp    800ed2 <fd2sockid+0x27>
+
+00800edb <alloc_sockfd>:
+{
+  800edb:	55                   	push   %ebp
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  800ee0:	83 ec 1c             	sub    $0x1c,%esp
+  800ee3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800ee5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ee8:	50                   	push   %eax
+  800ee9:	e8 75 f7 ff ff       	call   800663 <fd_alloc>
+  800eee:	89 c3                	mov    %eax,%ebx
+  800ef0:	83 c4 10             	add    $0x10,%esp
+  800ef3:	85 c0                	test   %eax,%eax
+  800ef5:	78 43                	js     800f3a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800ef7:	83 ec 04             	sub    $0x4,%esp
+  800efa:	68 07 04 00 00       	push   $0x407
+  800eff:	ff 75 f4             	push   -0xc(%ebp)
+  800f02:	6a 00                	push   $0x0
+  800f04:	e8 e8 f2 ff ff       	call   8001f1 <sys_page_alloc>
+  800f09:	89 c3                	mov    %eax,%ebx
+  800f0b:	83 c4 10             	add    $0x10,%esp
+  800f0e:	85 c0                	test   %eax,%eax
+  800f10:	78 28                	js     800f3a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800f12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f15:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800f1b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800f1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f20:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800f27:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800f2a:	83 ec 0c             	sub    $0xc,%esp
+  800f2d:	50                   	push   %eax
+  800f2e:	e8 09 f7 ff ff       	call   80063c <fd2num>
+  800f33:	89 c3                	mov    %eax,%ebx
+  800f35:	83 c4 10             	add    $0x10,%esp
+  800f38:	eb 0c                	jmp    800f46 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800f3a:	83 ec 0c             	sub    $0xc,%esp
+  800f3d:	56                   	push   %esi
+  800f3e:	e8 e4 01 00 00       	call   801127 <nsipc_close>
+		return r;
+  800f43:	83 c4 10             	add    $0x10,%esp
+}
+  800f46:	89 d8                	mov    %ebx,%eax
+  800f48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f4b:	5b                   	pop    %ebx
+  800f4c:	5e                   	pop    %esi
+  800f4d:	5d                   	pop    %ebp
+  800f4e:	c3                   	ret
+
+00800f4f <accept>:
+{
+  800f4f:	55                   	push   %ebp
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f58:	e8 4e ff ff ff       	call   800eab <fd2sockid>
+  800f5d:	85 c0                	test   %eax,%eax
+  800f5f:	78 1b                	js     800f7c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800f61:	83 ec 04             	sub    $0x4,%esp
+  800f64:	ff 75 10             	push   0x10(%ebp)
+  800f67:	ff 75 0c             	push   0xc(%ebp)
+  800f6a:	50                   	push   %eax
+  800f6b:	e8 0e 01 00 00       	call   80107e <nsipc_accept>
+  800f70:	83 c4 10             	add    $0x10,%esp
+  800f73:	85 c0                	test   %eax,%eax
+  800f75:	78 05                	js     800f7c <accept+0x2d>
+	return alloc_sockfd(r);
+  800f77:	e8 5f ff ff ff       	call   800edb <alloc_sockfd>
+}
+  800f7c:	c9                   	leave
+  800f7d:	c3                   	ret
+
+00800f7e <bind>:
+{
+  800f7e:	55                   	push   %ebp
+  800f7f:	89 e5                	mov    %esp,%ebp
+  800f81:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f84:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f87:	e8 1f ff ff ff       	call   800eab <fd2sockid>
+  800f8c:	85 c0                	test   %eax,%eax
+  800f8e:	78 12                	js     800fa2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800f90:	83 ec 04             	sub    $0x4,%esp
+  800f93:	ff 75 10             	push   0x10(%ebp)
+  800f96:	ff 75 0c             	push   0xc(%ebp)
+  800f99:	50                   	push   %eax
+  800f9a:	e8 31 01 00 00       	call   8010d0 <nsipc_bind>
+  800f9f:	83 c4 10             	add    $0x10,%esp
+}
+  800fa2:	c9                   	leave
+  800fa3:	c3                   	ret
+
+00800fa4 <shutdown>:
+{
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800faa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fad:	e8 f9 fe ff ff       	call   800eab <fd2sockid>
+  800fb2:	85 c0                	test   %eax,%eax
+  800fb4:	78 0f                	js     800fc5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800fb6:	83 ec 08             	sub    $0x8,%esp
+  800fb9:	ff 75 0c             	push   0xc(%ebp)
+  800fbc:	50                   	push   %eax
+  800fbd:	e8 43 01 00 00       	call   801105 <nsipc_shutdown>
+  800fc2:	83 c4 10             	add    $0x10,%esp
+}
+  800fc5:	c9                   	leave
+  800fc6:	c3                   	ret
+
+00800fc7 <connect>:
+{
+  800fc7:	55                   	push   %ebp
+  800fc8:	89 e5                	mov    %esp,%ebp
+  800fca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800fcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fd0:	e8 d6 fe ff ff       	call   800eab <fd2sockid>
+  800fd5:	85 c0                	test   %eax,%eax
+  800fd7:	78 12                	js     800feb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800fd9:	83 ec 04             	sub    $0x4,%esp
+  800fdc:	ff 75 10             	push   0x10(%ebp)
+  800fdf:	ff 75 0c             	push   0xc(%ebp)
+  800fe2:	50                   	push   %eax
+  800fe3:	e8 59 01 00 00       	call   801141 <nsipc_connect>
+  800fe8:	83 c4 10             	add    $0x10,%esp
+}
+  800feb:	c9                   	leave
+  800fec:	c3                   	ret
+
+00800fed <listen>:
+{
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800ff3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ff6:	e8 b0 fe ff ff       	call   800eab <fd2sockid>
+  800ffb:	85 c0                	test   %eax,%eax
+  800ffd:	78 0f                	js     80100e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800fff:	83 ec 08             	sub    $0x8,%esp
+  801002:	ff 75 0c             	push   0xc(%ebp)
+  801005:	50                   	push   %eax
+  801006:	e8 6b 01 00 00       	call   801176 <nsipc_listen>
+  80100b:	83 c4 10             	add    $0x10,%esp
+}
+  80100e:	c9                   	leave
+  80100f:	c3                   	ret
+
+00801010 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801010:	55                   	push   %ebp
+  801011:	89 e5                	mov    %esp,%ebp
+  801013:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801016:	ff 75 10             	push   0x10(%ebp)
+  801019:	ff 75 0c             	push   0xc(%ebp)
+  80101c:	ff 75 08             	push   0x8(%ebp)
+  80101f:	e8 41 02 00 00       	call   801265 <nsipc_socket>
+  801024:	83 c4 10             	add    $0x10,%esp
+  801027:	85 c0                	test   %eax,%eax
+  801029:	78 05                	js     801030 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80102b:	e8 ab fe ff ff       	call   800edb <alloc_sockfd>
+}
+  801030:	c9                   	leave
+  801031:	c3                   	ret
+
+00801032 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801032:	55                   	push   %ebp
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	53                   	push   %ebx
+  801036:	83 ec 04             	sub    $0x4,%esp
+  801039:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80103b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801042:	74 26                	je     80106a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801044:	6a 07                	push   $0x7
+  801046:	68 00 60 80 00       	push   $0x806000
+  80104b:	53                   	push   %ebx
+  80104c:	ff 35 04 40 80 00    	push   0x804004
+  801052:	e8 d2 11 00 00       	call   802229 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801057:	83 c4 0c             	add    $0xc,%esp
+  80105a:	6a 00                	push   $0x0
+  80105c:	6a 00                	push   $0x0
+  80105e:	6a 00                	push   $0x0
+  801060:	e8 4c 11 00 00       	call   8021b1 <ipc_recv>
+}
+  801065:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801068:	c9                   	leave
+  801069:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80106a:	83 ec 0c             	sub    $0xc,%esp
+  80106d:	6a 02                	push   $0x2
+  80106f:	e8 09 12 00 00       	call   80227d <ipc_find_env>
+  801074:	a3 04 40 80 00       	mov    %eax,0x804004
+  801079:	83 c4 10             	add    $0x10,%esp
+  80107c:	eb c6                	jmp    801044 <nsipc+0x12>
+
+0080107e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80107e:	55                   	push   %ebp
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+  801083:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801086:	8b 45 08             	mov    0x8(%ebp),%eax
+  801089:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80108e:	8b 06                	mov    (%esi),%eax
+  801090:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801095:	b8 01 00 00 00       	mov    $0x1,%eax
+  80109a:	e8 93 ff ff ff       	call   801032 <nsipc>
+  80109f:	89 c3                	mov    %eax,%ebx
+  8010a1:	85 c0                	test   %eax,%eax
+  8010a3:	79 09                	jns    8010ae <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8010a5:	89 d8                	mov    %ebx,%eax
+  8010a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5e                   	pop    %esi
+  8010ac:	5d                   	pop    %ebp
+  8010ad:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8010ae:	83 ec 04             	sub    $0x4,%esp
+  8010b1:	ff 35 10 60 80 00    	push   0x806010
+  8010b7:	68 00 60 80 00       	push   $0x806000
+  8010bc:	ff 75 0c             	push   0xc(%ebp)
+  8010bf:	e8 d8 0e 00 00       	call   801f9c <memmove>
+		*addrlen = ret->ret_addrlen;
+  8010c4:	a1 10 60 80 00       	mov    0x806010,%eax
+  8010c9:	89 06                	mov    %eax,(%esi)
+  8010cb:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8010ce:	eb d5                	jmp    8010a5 <nsipc_accept+0x27>
+
+008010d0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8010d0:	55                   	push   %ebp
+  8010d1:	89 e5                	mov    %esp,%ebp
+  8010d3:	53                   	push   %ebx
+  8010d4:	83 ec 08             	sub    $0x8,%esp
+  8010d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8010da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010dd:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8010e2:	53                   	push   %ebx
+  8010e3:	ff 75 0c             	push   0xc(%ebp)
+  8010e6:	68 04 60 80 00       	push   $0x806004
+  8010eb:	e8 ac 0e 00 00       	call   801f9c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8010f0:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8010f6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010fb:	e8 32 ff ff ff       	call   801032 <nsipc>
+}
+  801100:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801103:	c9                   	leave
+  801104:	c3                   	ret
+
+00801105 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80110b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80110e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801113:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801116:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  80111b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801120:	e8 0d ff ff ff       	call   801032 <nsipc>
+}
+  801125:	c9                   	leave
+  801126:	c3                   	ret
+
+00801127 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801127:	55                   	push   %ebp
+  801128:	89 e5                	mov    %esp,%ebp
+  80112a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80112d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801130:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801135:	b8 04 00 00 00       	mov    $0x4,%eax
+  80113a:	e8 f3 fe ff ff       	call   801032 <nsipc>
+}
+  80113f:	c9                   	leave
+  801140:	c3                   	ret
+
+00801141 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801141:	55                   	push   %ebp
+  801142:	89 e5                	mov    %esp,%ebp
+  801144:	53                   	push   %ebx
+  801145:	83 ec 08             	sub    $0x8,%esp
+  801148:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80114b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80114e:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801153:	53                   	push   %ebx
+  801154:	ff 75 0c             	push   0xc(%ebp)
+  801157:	68 04 60 80 00       	push   $0x806004
+  80115c:	e8 3b 0e 00 00       	call   801f9c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801161:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801167:	b8 05 00 00 00       	mov    $0x5,%eax
+  80116c:	e8 c1 fe ff ff       	call   801032 <nsipc>
+}
+  801171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801174:	c9                   	leave
+  801175:	c3                   	ret
+
+00801176 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801176:	55                   	push   %ebp
+  801177:	89 e5                	mov    %esp,%ebp
+  801179:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80117c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80117f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801184:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801187:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  80118c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801191:	e8 9c fe ff ff       	call   801032 <nsipc>
+}
+  801196:	c9                   	leave
+  801197:	c3                   	ret
+
+00801198 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801198:	55                   	push   %ebp
+  801199:	89 e5                	mov    %esp,%ebp
+  80119b:	56                   	push   %esi
+  80119c:	53                   	push   %ebx
+  80119d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8011a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011a3:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  8011a8:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  8011ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011b1:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8011b6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8011bb:	e8 72 fe ff ff       	call   801032 <nsipc>
+  8011c0:	89 c3                	mov    %eax,%ebx
+  8011c2:	85 c0                	test   %eax,%eax
+  8011c4:	78 22                	js     8011e8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8011c6:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8011cb:	39 c6                	cmp    %eax,%esi
+  8011cd:	0f 4e c6             	cmovle %esi,%eax
+  8011d0:	39 c3                	cmp    %eax,%ebx
+  8011d2:	7f 1d                	jg     8011f1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8011d4:	83 ec 04             	sub    $0x4,%esp
+  8011d7:	53                   	push   %ebx
+  8011d8:	68 00 60 80 00       	push   $0x806000
+  8011dd:	ff 75 0c             	push   0xc(%ebp)
+  8011e0:	e8 b7 0d 00 00       	call   801f9c <memmove>
+  8011e5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8011e8:	89 d8                	mov    %ebx,%eax
+  8011ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011ed:	5b                   	pop    %ebx
+  8011ee:	5e                   	pop    %esi
+  8011ef:	5d                   	pop    %ebp
+  8011f0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8011f1:	68 27 28 80 00       	push   $0x802827
+  8011f6:	68 ef 27 80 00       	push   $0x8027ef
+  8011fb:	6a 62                	push   $0x62
+  8011fd:	68 3c 28 80 00       	push   $0x80283c
+  801202:	e8 46 05 00 00       	call   80174d <_panic>
+
+00801207 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801207:	55                   	push   %ebp
+  801208:	89 e5                	mov    %esp,%ebp
+  80120a:	53                   	push   %ebx
+  80120b:	83 ec 04             	sub    $0x4,%esp
+  80120e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801211:	8b 45 08             	mov    0x8(%ebp),%eax
+  801214:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801219:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80121f:	7f 2e                	jg     80124f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801221:	83 ec 04             	sub    $0x4,%esp
+  801224:	53                   	push   %ebx
+  801225:	ff 75 0c             	push   0xc(%ebp)
+  801228:	68 0c 60 80 00       	push   $0x80600c
+  80122d:	e8 6a 0d 00 00       	call   801f9c <memmove>
+	nsipcbuf.send.req_size = size;
+  801232:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801238:	8b 45 14             	mov    0x14(%ebp),%eax
+  80123b:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801240:	b8 08 00 00 00       	mov    $0x8,%eax
+  801245:	e8 e8 fd ff ff       	call   801032 <nsipc>
+}
+  80124a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80124d:	c9                   	leave
+  80124e:	c3                   	ret
+	assert(size < 1600);
+  80124f:	68 48 28 80 00       	push   $0x802848
+  801254:	68 ef 27 80 00       	push   $0x8027ef
+  801259:	6a 6d                	push   $0x6d
+  80125b:	68 3c 28 80 00       	push   $0x80283c
+  801260:	e8 e8 04 00 00       	call   80174d <_panic>
+
+00801265 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801265:	55                   	push   %ebp
+  801266:	89 e5                	mov    %esp,%ebp
+  801268:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80126b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80126e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801273:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801276:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  80127b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80127e:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801283:	b8 09 00 00 00       	mov    $0x9,%eax
+  801288:	e8 a5 fd ff ff       	call   801032 <nsipc>
+}
+  80128d:	c9                   	leave
+  80128e:	c3                   	ret
+
+0080128f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80128f:	55                   	push   %ebp
+  801290:	89 e5                	mov    %esp,%ebp
+  801292:	56                   	push   %esi
+  801293:	53                   	push   %ebx
+  801294:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801297:	83 ec 0c             	sub    $0xc,%esp
+  80129a:	ff 75 08             	push   0x8(%ebp)
+  80129d:	e8 aa f3 ff ff       	call   80064c <fd2data>
+  8012a2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8012a4:	83 c4 08             	add    $0x8,%esp
+  8012a7:	68 54 28 80 00       	push   $0x802854
+  8012ac:	53                   	push   %ebx
+  8012ad:	e8 64 0b 00 00       	call   801e16 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8012b2:	8b 46 04             	mov    0x4(%esi),%eax
+  8012b5:	2b 06                	sub    (%esi),%eax
+  8012b7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8012bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8012c4:	00 00 00 
+	stat->st_dev = &devpipe;
+  8012c7:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8012ce:	30 80 00 
+	return 0;
+}
+  8012d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012d9:	5b                   	pop    %ebx
+  8012da:	5e                   	pop    %esi
+  8012db:	5d                   	pop    %ebp
+  8012dc:	c3                   	ret
+
+008012dd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8012dd:	55                   	push   %ebp
+  8012de:	89 e5                	mov    %esp,%ebp
+  8012e0:	53                   	push   %ebx
+  8012e1:	83 ec 0c             	sub    $0xc,%esp
+  8012e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8012e7:	53                   	push   %ebx
+  8012e8:	6a 00                	push   $0x0
+  8012ea:	e8 ca ef ff ff       	call   8002b9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8012ef:	89 1c 24             	mov    %ebx,(%esp)
+  8012f2:	e8 55 f3 ff ff       	call   80064c <fd2data>
+  8012f7:	83 c4 08             	add    $0x8,%esp
+  8012fa:	50                   	push   %eax
+  8012fb:	6a 00                	push   $0x0
+  8012fd:	e8 b7 ef ff ff       	call   8002b9 <sys_page_unmap>
+}
+  801302:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801305:	c9                   	leave
+  801306:	c3                   	ret
+
+00801307 <_pipeisclosed>:
+{
+  801307:	55                   	push   %ebp
+  801308:	89 e5                	mov    %esp,%ebp
+  80130a:	57                   	push   %edi
+  80130b:	56                   	push   %esi
+  80130c:	53                   	push   %ebx
+  80130d:	83 ec 1c             	sub    $0x1c,%esp
+  801310:	89 c7                	mov    %eax,%edi
+  801312:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801314:	a1 08 40 80 00       	mov    0x804008,%eax
+  801319:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80131c:	83 ec 0c             	sub    $0xc,%esp
+  80131f:	57                   	push   %edi
+  801320:	e8 68 0f 00 00       	call   80228d <pageref>
+  801325:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801328:	89 34 24             	mov    %esi,(%esp)
+  80132b:	e8 5d 0f 00 00       	call   80228d <pageref>
+		nn = thisenv->env_runs;
+  801330:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801336:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801339:	83 c4 10             	add    $0x10,%esp
+  80133c:	39 cb                	cmp    %ecx,%ebx
+  80133e:	74 1b                	je     80135b <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801340:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801343:	75 cf                	jne    801314 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801345:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801348:	6a 01                	push   $0x1
+  80134a:	50                   	push   %eax
+  80134b:	53                   	push   %ebx
+  80134c:	68 5b 28 80 00       	push   $0x80285b
+  801351:	e8 d2 04 00 00       	call   801828 <cprintf>
+  801356:	83 c4 10             	add    $0x10,%esp
+  801359:	eb b9                	jmp    801314 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80135b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80135e:	0f 94 c0             	sete   %al
+  801361:	0f b6 c0             	movzbl %al,%eax
+}
+  801364:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801367:	5b                   	pop    %ebx
+  801368:	5e                   	pop    %esi
+  801369:	5f                   	pop    %edi
+  80136a:	5d                   	pop    %ebp
+  80136b:	c3                   	ret
+
+0080136c <devpipe_write>:
+{
+  80136c:	55                   	push   %ebp
+  80136d:	89 e5                	mov    %esp,%ebp
+  80136f:	57                   	push   %edi
+  801370:	56                   	push   %esi
+  801371:	53                   	push   %ebx
+  801372:	83 ec 28             	sub    $0x28,%esp
+  801375:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801378:	56                   	push   %esi
+  801379:	e8 ce f2 ff ff       	call   80064c <fd2data>
+  80137e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801380:	83 c4 10             	add    $0x10,%esp
+  801383:	bf 00 00 00 00       	mov    $0x0,%edi
+  801388:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80138b:	75 09                	jne    801396 <devpipe_write+0x2a>
+	return i;
+  80138d:	89 f8                	mov    %edi,%eax
+  80138f:	eb 23                	jmp    8013b4 <devpipe_write+0x48>
+			sys_yield();
+  801391:	e8 db ed ff ff       	call   800171 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801396:	8b 43 04             	mov    0x4(%ebx),%eax
+  801399:	8b 0b                	mov    (%ebx),%ecx
+  80139b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80139e:	39 d0                	cmp    %edx,%eax
+  8013a0:	72 1a                	jb     8013bc <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8013a2:	89 da                	mov    %ebx,%edx
+  8013a4:	89 f0                	mov    %esi,%eax
+  8013a6:	e8 5c ff ff ff       	call   801307 <_pipeisclosed>
+  8013ab:	85 c0                	test   %eax,%eax
+  8013ad:	74 e2                	je     801391 <devpipe_write+0x25>
+				return 0;
+  8013af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b7:	5b                   	pop    %ebx
+  8013b8:	5e                   	pop    %esi
+  8013b9:	5f                   	pop    %edi
+  8013ba:	5d                   	pop    %ebp
+  8013bb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8013bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bf:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8013c3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8013c6:	89 c2                	mov    %eax,%edx
+  8013c8:	c1 fa 1f             	sar    $0x1f,%edx
+  8013cb:	89 d1                	mov    %edx,%ecx
+  8013cd:	c1 e9 1b             	shr    $0x1b,%ecx
+  8013d0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8013d3:	83 e2 1f             	and    $0x1f,%edx
+  8013d6:	29 ca                	sub    %ecx,%edx
+  8013d8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8013dc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8013e0:	83 c0 01             	add    $0x1,%eax
+  8013e3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8013e6:	83 c7 01             	add    $0x1,%edi
+  8013e9:	eb 9d                	jmp    801388 <devpipe_write+0x1c>
+
+008013eb <devpipe_read>:
+{
+  8013eb:	55                   	push   %ebp
+  8013ec:	89 e5                	mov    %esp,%ebp
+  8013ee:	57                   	push   %edi
+  8013ef:	56                   	push   %esi
+  8013f0:	53                   	push   %ebx
+  8013f1:	83 ec 18             	sub    $0x18,%esp
+  8013f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8013f7:	57                   	push   %edi
+  8013f8:	e8 4f f2 ff ff       	call   80064c <fd2data>
+  8013fd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8013ff:	83 c4 10             	add    $0x10,%esp
+  801402:	be 00 00 00 00       	mov    $0x0,%esi
+  801407:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80140a:	75 13                	jne    80141f <devpipe_read+0x34>
+	return i;
+  80140c:	89 f0                	mov    %esi,%eax
+  80140e:	eb 02                	jmp    801412 <devpipe_read+0x27>
+				return i;
+  801410:	89 f0                	mov    %esi,%eax
+}
+  801412:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801415:	5b                   	pop    %ebx
+  801416:	5e                   	pop    %esi
+  801417:	5f                   	pop    %edi
+  801418:	5d                   	pop    %ebp
+  801419:	c3                   	ret
+			sys_yield();
+  80141a:	e8 52 ed ff ff       	call   800171 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80141f:	8b 03                	mov    (%ebx),%eax
+  801421:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801424:	75 18                	jne    80143e <devpipe_read+0x53>
+			if (i > 0)
+  801426:	85 f6                	test   %esi,%esi
+  801428:	75 e6                	jne    801410 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80142a:	89 da                	mov    %ebx,%edx
+  80142c:	89 f8                	mov    %edi,%eax
+  80142e:	e8 d4 fe ff ff       	call   801307 <_pipeisclosed>
+  801433:	85 c0                	test   %eax,%eax
+  801435:	74 e3                	je     80141a <devpipe_read+0x2f>
+				return 0;
+  801437:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143c:	eb d4                	jmp    801412 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80143e:	99                   	cltd
+  80143f:	c1 ea 1b             	shr    $0x1b,%edx
+  801442:	01 d0                	add    %edx,%eax
+  801444:	83 e0 1f             	and    $0x1f,%eax
+  801447:	29 d0                	sub    %edx,%eax
+  801449:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80144e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801451:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801454:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801457:	83 c6 01             	add    $0x1,%esi
+  80145a:	eb ab                	jmp    801407 <devpipe_read+0x1c>
+
+0080145c <pipe>:
+{
+  80145c:	55                   	push   %ebp
+  80145d:	89 e5                	mov    %esp,%ebp
+  80145f:	56                   	push   %esi
+  801460:	53                   	push   %ebx
+  801461:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801464:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801467:	50                   	push   %eax
+  801468:	e8 f6 f1 ff ff       	call   800663 <fd_alloc>
+  80146d:	89 c3                	mov    %eax,%ebx
+  80146f:	83 c4 10             	add    $0x10,%esp
+  801472:	85 c0                	test   %eax,%eax
+  801474:	0f 88 23 01 00 00    	js     80159d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80147a:	83 ec 04             	sub    $0x4,%esp
+  80147d:	68 07 04 00 00       	push   $0x407
+  801482:	ff 75 f4             	push   -0xc(%ebp)
+  801485:	6a 00                	push   $0x0
+  801487:	e8 65 ed ff ff       	call   8001f1 <sys_page_alloc>
+  80148c:	89 c3                	mov    %eax,%ebx
+  80148e:	83 c4 10             	add    $0x10,%esp
+  801491:	85 c0                	test   %eax,%eax
+  801493:	0f 88 04 01 00 00    	js     80159d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801499:	83 ec 0c             	sub    $0xc,%esp
+  80149c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80149f:	50                   	push   %eax
+  8014a0:	e8 be f1 ff ff       	call   800663 <fd_alloc>
+  8014a5:	89 c3                	mov    %eax,%ebx
+  8014a7:	83 c4 10             	add    $0x10,%esp
+  8014aa:	85 c0                	test   %eax,%eax
+  8014ac:	0f 88 db 00 00 00    	js     80158d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014b2:	83 ec 04             	sub    $0x4,%esp
+  8014b5:	68 07 04 00 00       	push   $0x407
+  8014ba:	ff 75 f0             	push   -0x10(%ebp)
+  8014bd:	6a 00                	push   $0x0
+  8014bf:	e8 2d ed ff ff       	call   8001f1 <sys_page_alloc>
+  8014c4:	89 c3                	mov    %eax,%ebx
+  8014c6:	83 c4 10             	add    $0x10,%esp
+  8014c9:	85 c0                	test   %eax,%eax
+  8014cb:	0f 88 bc 00 00 00    	js     80158d <pipe+0x131>
+	va = fd2data(fd0);
+  8014d1:	83 ec 0c             	sub    $0xc,%esp
+  8014d4:	ff 75 f4             	push   -0xc(%ebp)
+  8014d7:	e8 70 f1 ff ff       	call   80064c <fd2data>
+  8014dc:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014de:	83 c4 0c             	add    $0xc,%esp
+  8014e1:	68 07 04 00 00       	push   $0x407
+  8014e6:	50                   	push   %eax
+  8014e7:	6a 00                	push   $0x0
+  8014e9:	e8 03 ed ff ff       	call   8001f1 <sys_page_alloc>
+  8014ee:	89 c3                	mov    %eax,%ebx
+  8014f0:	83 c4 10             	add    $0x10,%esp
+  8014f3:	85 c0                	test   %eax,%eax
+  8014f5:	0f 88 82 00 00 00    	js     80157d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014fb:	83 ec 0c             	sub    $0xc,%esp
+  8014fe:	ff 75 f0             	push   -0x10(%ebp)
+  801501:	e8 46 f1 ff ff       	call   80064c <fd2data>
+  801506:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80150d:	50                   	push   %eax
+  80150e:	6a 00                	push   $0x0
+  801510:	56                   	push   %esi
+  801511:	6a 00                	push   $0x0
+  801513:	e8 5f ed ff ff       	call   800277 <sys_page_map>
+  801518:	89 c3                	mov    %eax,%ebx
+  80151a:	83 c4 20             	add    $0x20,%esp
+  80151d:	85 c0                	test   %eax,%eax
+  80151f:	78 4e                	js     80156f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801521:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801526:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801529:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80152b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80152e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801535:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801538:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80153a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80153d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801544:	83 ec 0c             	sub    $0xc,%esp
+  801547:	ff 75 f4             	push   -0xc(%ebp)
+  80154a:	e8 ed f0 ff ff       	call   80063c <fd2num>
+  80154f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801552:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801554:	83 c4 04             	add    $0x4,%esp
+  801557:	ff 75 f0             	push   -0x10(%ebp)
+  80155a:	e8 dd f0 ff ff       	call   80063c <fd2num>
+  80155f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801562:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801565:	83 c4 10             	add    $0x10,%esp
+  801568:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156d:	eb 2e                	jmp    80159d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80156f:	83 ec 08             	sub    $0x8,%esp
+  801572:	56                   	push   %esi
+  801573:	6a 00                	push   $0x0
+  801575:	e8 3f ed ff ff       	call   8002b9 <sys_page_unmap>
+  80157a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80157d:	83 ec 08             	sub    $0x8,%esp
+  801580:	ff 75 f0             	push   -0x10(%ebp)
+  801583:	6a 00                	push   $0x0
+  801585:	e8 2f ed ff ff       	call   8002b9 <sys_page_unmap>
+  80158a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80158d:	83 ec 08             	sub    $0x8,%esp
+  801590:	ff 75 f4             	push   -0xc(%ebp)
+  801593:	6a 00                	push   $0x0
+  801595:	e8 1f ed ff ff       	call   8002b9 <sys_page_unmap>
+  80159a:	83 c4 10             	add    $0x10,%esp
+}
+  80159d:	89 d8                	mov    %ebx,%eax
+  80159f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015a2:	5b                   	pop    %ebx
+  8015a3:	5e                   	pop    %esi
+  8015a4:	5d                   	pop    %ebp
+  8015a5:	c3                   	ret
+
+008015a6 <pipeisclosed>:
+{
+  8015a6:	55                   	push   %ebp
+  8015a7:	89 e5                	mov    %esp,%ebp
+  8015a9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015af:	50                   	push   %eax
+  8015b0:	ff 75 08             	push   0x8(%ebp)
+  8015b3:	e8 01 f1 ff ff       	call   8006b9 <fd_lookup>
+  8015b8:	83 c4 10             	add    $0x10,%esp
+  8015bb:	85 c0                	test   %eax,%eax
+  8015bd:	78 18                	js     8015d7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8015bf:	83 ec 0c             	sub    $0xc,%esp
+  8015c2:	ff 75 f4             	push   -0xc(%ebp)
+  8015c5:	e8 82 f0 ff ff       	call   80064c <fd2data>
+  8015ca:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8015cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015cf:	e8 33 fd ff ff       	call   801307 <_pipeisclosed>
+  8015d4:	83 c4 10             	add    $0x10,%esp
+}
+  8015d7:	c9                   	leave
+  8015d8:	c3                   	ret
+
+008015d9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8015d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015de:	c3                   	ret
+
+008015df <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015df:	55                   	push   %ebp
+  8015e0:	89 e5                	mov    %esp,%ebp
+  8015e2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015e5:	68 73 28 80 00       	push   $0x802873
+  8015ea:	ff 75 0c             	push   0xc(%ebp)
+  8015ed:	e8 24 08 00 00       	call   801e16 <strcpy>
+	return 0;
+}
+  8015f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f7:	c9                   	leave
+  8015f8:	c3                   	ret
+
+008015f9 <devcons_write>:
+{
+  8015f9:	55                   	push   %ebp
+  8015fa:	89 e5                	mov    %esp,%ebp
+  8015fc:	57                   	push   %edi
+  8015fd:	56                   	push   %esi
+  8015fe:	53                   	push   %ebx
+  8015ff:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801605:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80160a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801610:	eb 2e                	jmp    801640 <devcons_write+0x47>
+		m = n - tot;
+  801612:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801615:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801617:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80161c:	39 c3                	cmp    %eax,%ebx
+  80161e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801621:	83 ec 04             	sub    $0x4,%esp
+  801624:	53                   	push   %ebx
+  801625:	89 f0                	mov    %esi,%eax
+  801627:	03 45 0c             	add    0xc(%ebp),%eax
+  80162a:	50                   	push   %eax
+  80162b:	57                   	push   %edi
+  80162c:	e8 6b 09 00 00       	call   801f9c <memmove>
+		sys_cputs(buf, m);
+  801631:	83 c4 08             	add    $0x8,%esp
+  801634:	53                   	push   %ebx
+  801635:	57                   	push   %edi
+  801636:	e8 79 ea ff ff       	call   8000b4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80163b:	01 de                	add    %ebx,%esi
+  80163d:	83 c4 10             	add    $0x10,%esp
+  801640:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801643:	72 cd                	jb     801612 <devcons_write+0x19>
+}
+  801645:	89 f0                	mov    %esi,%eax
+  801647:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164a:	5b                   	pop    %ebx
+  80164b:	5e                   	pop    %esi
+  80164c:	5f                   	pop    %edi
+  80164d:	5d                   	pop    %ebp
+  80164e:	c3                   	ret
+
+0080164f <devcons_read>:
+{
+  80164f:	55                   	push   %ebp
+  801650:	89 e5                	mov    %esp,%ebp
+  801652:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80165e:	75 07                	jne    801667 <devcons_read+0x18>
+  801660:	eb 1f                	jmp    801681 <devcons_read+0x32>
+		sys_yield();
+  801662:	e8 0a eb ff ff       	call   800171 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801667:	e8 66 ea ff ff       	call   8000d2 <sys_cgetc>
+  80166c:	85 c0                	test   %eax,%eax
+  80166e:	74 f2                	je     801662 <devcons_read+0x13>
+	if (c < 0)
+  801670:	78 0f                	js     801681 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801672:	83 f8 04             	cmp    $0x4,%eax
+  801675:	74 0c                	je     801683 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801677:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80167a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80167c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801681:	c9                   	leave
+  801682:	c3                   	ret
+		return 0;
+  801683:	b8 00 00 00 00       	mov    $0x0,%eax
+  801688:	eb f7                	jmp    801681 <devcons_read+0x32>
+
+0080168a <cputchar>:
+{
+  80168a:	55                   	push   %ebp
+  80168b:	89 e5                	mov    %esp,%ebp
+  80168d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801690:	8b 45 08             	mov    0x8(%ebp),%eax
+  801693:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801696:	6a 01                	push   $0x1
+  801698:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80169b:	50                   	push   %eax
+  80169c:	e8 13 ea ff ff       	call   8000b4 <sys_cputs>
+}
+  8016a1:	83 c4 10             	add    $0x10,%esp
+  8016a4:	c9                   	leave
+  8016a5:	c3                   	ret
+
+008016a6 <getchar>:
+{
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8016ac:	6a 01                	push   $0x1
+  8016ae:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8016b1:	50                   	push   %eax
+  8016b2:	6a 00                	push   $0x0
+  8016b4:	e8 66 f2 ff ff       	call   80091f <read>
+	if (r < 0)
+  8016b9:	83 c4 10             	add    $0x10,%esp
+  8016bc:	85 c0                	test   %eax,%eax
+  8016be:	78 06                	js     8016c6 <getchar+0x20>
+	if (r < 1)
+  8016c0:	74 06                	je     8016c8 <getchar+0x22>
+	return c;
+  8016c2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8016c6:	c9                   	leave
+  8016c7:	c3                   	ret
+		return -E_EOF;
+  8016c8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8016cd:	eb f7                	jmp    8016c6 <getchar+0x20>
+
+008016cf <iscons>:
+{
+  8016cf:	55                   	push   %ebp
+  8016d0:	89 e5                	mov    %esp,%ebp
+  8016d2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d8:	50                   	push   %eax
+  8016d9:	ff 75 08             	push   0x8(%ebp)
+  8016dc:	e8 d8 ef ff ff       	call   8006b9 <fd_lookup>
+  8016e1:	83 c4 10             	add    $0x10,%esp
+  8016e4:	85 c0                	test   %eax,%eax
+  8016e6:	78 11                	js     8016f9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016eb:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8016f1:	39 10                	cmp    %edx,(%eax)
+  8016f3:	0f 94 c0             	sete   %al
+  8016f6:	0f b6 c0             	movzbl %al,%eax
+}
+  8016f9:	c9                   	leave
+  8016fa:	c3                   	ret
+
+008016fb <opencons>:
+{
+  8016fb:	55                   	push   %ebp
+  8016fc:	89 e5                	mov    %esp,%ebp
+  8016fe:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801701:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801704:	50                   	push   %eax
+  801705:	e8 59 ef ff ff       	call   800663 <fd_alloc>
+  80170a:	83 c4 10             	add    $0x10,%esp
+  80170d:	85 c0                	test   %eax,%eax
+  80170f:	78 3a                	js     80174b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801711:	83 ec 04             	sub    $0x4,%esp
+  801714:	68 07 04 00 00       	push   $0x407
+  801719:	ff 75 f4             	push   -0xc(%ebp)
+  80171c:	6a 00                	push   $0x0
+  80171e:	e8 ce ea ff ff       	call   8001f1 <sys_page_alloc>
+  801723:	83 c4 10             	add    $0x10,%esp
+  801726:	85 c0                	test   %eax,%eax
+  801728:	78 21                	js     80174b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80172a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80172d:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801733:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801735:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801738:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80173f:	83 ec 0c             	sub    $0xc,%esp
+  801742:	50                   	push   %eax
+  801743:	e8 f4 ee ff ff       	call   80063c <fd2num>
+  801748:	83 c4 10             	add    $0x10,%esp
+}
+  80174b:	c9                   	leave
+  80174c:	c3                   	ret
+
+0080174d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80174d:	55                   	push   %ebp
+  80174e:	89 e5                	mov    %esp,%ebp
+  801750:	56                   	push   %esi
+  801751:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801752:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801755:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80175b:	e8 f2 e9 ff ff       	call   800152 <sys_getenvid>
+  801760:	83 ec 0c             	sub    $0xc,%esp
+  801763:	ff 75 0c             	push   0xc(%ebp)
+  801766:	ff 75 08             	push   0x8(%ebp)
+  801769:	56                   	push   %esi
+  80176a:	50                   	push   %eax
+  80176b:	68 80 28 80 00       	push   $0x802880
+  801770:	e8 b3 00 00 00       	call   801828 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801775:	83 c4 18             	add    $0x18,%esp
+  801778:	53                   	push   %ebx
+  801779:	ff 75 10             	push   0x10(%ebp)
+  80177c:	e8 56 00 00 00       	call   8017d7 <vcprintf>
+	cprintf("\n");
+  801781:	c7 04 24 6c 28 80 00 	movl   $0x80286c,(%esp)
+  801788:	e8 9b 00 00 00       	call   801828 <cprintf>
+  80178d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801790:	cc                   	int3
+	while (1)
+  801791:	eb fd                	jmp    801790 <_panic+0x43>
+
+00801793 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	53                   	push   %ebx
+  801797:	83 ec 04             	sub    $0x4,%esp
+  80179a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80179d:	8b 13                	mov    (%ebx),%edx
+  80179f:	8d 42 01             	lea    0x1(%edx),%eax
+  8017a2:	89 03                	mov    %eax,(%ebx)
+  8017a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8017a7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8017ab:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8017b0:	74 09                	je     8017bb <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8017b2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8017b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017b9:	c9                   	leave
+  8017ba:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8017bb:	83 ec 08             	sub    $0x8,%esp
+  8017be:	68 ff 00 00 00       	push   $0xff
+  8017c3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8017c6:	50                   	push   %eax
+  8017c7:	e8 e8 e8 ff ff       	call   8000b4 <sys_cputs>
+		b->idx = 0;
+  8017cc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8017d2:	83 c4 10             	add    $0x10,%esp
+  8017d5:	eb db                	jmp    8017b2 <putch+0x1f>
+
+008017d7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8017d7:	55                   	push   %ebp
+  8017d8:	89 e5                	mov    %esp,%ebp
+  8017da:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017e0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017e7:	00 00 00 
+	b.cnt = 0;
+  8017ea:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017f1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017f4:	ff 75 0c             	push   0xc(%ebp)
+  8017f7:	ff 75 08             	push   0x8(%ebp)
+  8017fa:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  801800:	50                   	push   %eax
+  801801:	68 93 17 80 00       	push   $0x801793
+  801806:	e8 14 01 00 00       	call   80191f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80180b:	83 c4 08             	add    $0x8,%esp
+  80180e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801814:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80181a:	50                   	push   %eax
+  80181b:	e8 94 e8 ff ff       	call   8000b4 <sys_cputs>
+
+	return b.cnt;
+}
+  801820:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801826:	c9                   	leave
+  801827:	c3                   	ret
+
+00801828 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801828:	55                   	push   %ebp
+  801829:	89 e5                	mov    %esp,%ebp
+  80182b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80182e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801831:	50                   	push   %eax
+  801832:	ff 75 08             	push   0x8(%ebp)
+  801835:	e8 9d ff ff ff       	call   8017d7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80183a:	c9                   	leave
+  80183b:	c3                   	ret
+
+0080183c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80183c:	55                   	push   %ebp
+  80183d:	89 e5                	mov    %esp,%ebp
+  80183f:	57                   	push   %edi
+  801840:	56                   	push   %esi
+  801841:	53                   	push   %ebx
+  801842:	83 ec 1c             	sub    $0x1c,%esp
+  801845:	89 c7                	mov    %eax,%edi
+  801847:	89 d6                	mov    %edx,%esi
+  801849:	8b 45 08             	mov    0x8(%ebp),%eax
+  80184c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80184f:	89 d1                	mov    %edx,%ecx
+  801851:	89 c2                	mov    %eax,%edx
+  801853:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801856:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801859:	8b 45 10             	mov    0x10(%ebp),%eax
+  80185c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80185f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801862:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801869:	39 c2                	cmp    %eax,%edx
+  80186b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80186e:	72 3e                	jb     8018ae <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801870:	83 ec 0c             	sub    $0xc,%esp
+  801873:	ff 75 18             	push   0x18(%ebp)
+  801876:	83 eb 01             	sub    $0x1,%ebx
+  801879:	53                   	push   %ebx
+  80187a:	50                   	push   %eax
+  80187b:	83 ec 08             	sub    $0x8,%esp
+  80187e:	ff 75 e4             	push   -0x1c(%ebp)
+  801881:	ff 75 e0             	push   -0x20(%ebp)
+  801884:	ff 75 dc             	push   -0x24(%ebp)
+  801887:	ff 75 d8             	push   -0x28(%ebp)
+  80188a:	e8 11 0b 00 00       	call   8023a0 <__udivdi3>
+  80188f:	83 c4 18             	add    $0x18,%esp
+  801892:	52                   	push   %edx
+  801893:	50                   	push   %eax
+  801894:	89 f2                	mov    %esi,%edx
+  801896:	89 f8                	mov    %edi,%eax
+  801898:	e8 9f ff ff ff       	call   80183c <printnum>
+  80189d:	83 c4 20             	add    $0x20,%esp
+  8018a0:	eb 13                	jmp    8018b5 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8018a2:	83 ec 08             	sub    $0x8,%esp
+  8018a5:	56                   	push   %esi
+  8018a6:	ff 75 18             	push   0x18(%ebp)
+  8018a9:	ff d7                	call   *%edi
+  8018ab:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8018ae:	83 eb 01             	sub    $0x1,%ebx
+  8018b1:	85 db                	test   %ebx,%ebx
+  8018b3:	7f ed                	jg     8018a2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8018b5:	83 ec 08             	sub    $0x8,%esp
+  8018b8:	56                   	push   %esi
+  8018b9:	83 ec 04             	sub    $0x4,%esp
+  8018bc:	ff 75 e4             	push   -0x1c(%ebp)
+  8018bf:	ff 75 e0             	push   -0x20(%ebp)
+  8018c2:	ff 75 dc             	push   -0x24(%ebp)
+  8018c5:	ff 75 d8             	push   -0x28(%ebp)
+  8018c8:	e8 93 0b 00 00       	call   802460 <__umoddi3>
+  8018cd:	83 c4 14             	add    $0x14,%esp
+  8018d0:	0f be 80 a3 28 80 00 	movsbl 0x8028a3(%eax),%eax
+  8018d7:	50                   	push   %eax
+  8018d8:	ff d7                	call   *%edi
+}
+  8018da:	83 c4 10             	add    $0x10,%esp
+  8018dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e0:	5b                   	pop    %ebx
+  8018e1:	5e                   	pop    %esi
+  8018e2:	5f                   	pop    %edi
+  8018e3:	5d                   	pop    %ebp
+  8018e4:	c3                   	ret
+
+008018e5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018e5:	55                   	push   %ebp
+  8018e6:	89 e5                	mov    %esp,%ebp
+  8018e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018eb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018ef:	8b 10                	mov    (%eax),%edx
+  8018f1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018f4:	73 0a                	jae    801900 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018f6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018f9:	89 08                	mov    %ecx,(%eax)
+  8018fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018fe:	88 02                	mov    %al,(%edx)
+}
+  801900:	5d                   	pop    %ebp
+  801901:	c3                   	ret
+
+00801902 <printfmt>:
+{
+  801902:	55                   	push   %ebp
+  801903:	89 e5                	mov    %esp,%ebp
+  801905:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801908:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80190b:	50                   	push   %eax
+  80190c:	ff 75 10             	push   0x10(%ebp)
+  80190f:	ff 75 0c             	push   0xc(%ebp)
+  801912:	ff 75 08             	push   0x8(%ebp)
+  801915:	e8 05 00 00 00       	call   80191f <vprintfmt>
+}
+  80191a:	83 c4 10             	add    $0x10,%esp
+  80191d:	c9                   	leave
+  80191e:	c3                   	ret
+
+0080191f <vprintfmt>:
+{
+  80191f:	55                   	push   %ebp
+  801920:	89 e5                	mov    %esp,%ebp
+  801922:	57                   	push   %edi
+  801923:	56                   	push   %esi
+  801924:	53                   	push   %ebx
+  801925:	83 ec 2c             	sub    $0x2c,%esp
+  801928:	8b 75 08             	mov    0x8(%ebp),%esi
+  80192b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80192e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801931:	eb 0a                	jmp    80193d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801933:	83 ec 08             	sub    $0x8,%esp
+  801936:	53                   	push   %ebx
+  801937:	50                   	push   %eax
+  801938:	ff d6                	call   *%esi
+  80193a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80193d:	83 c7 01             	add    $0x1,%edi
+  801940:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801944:	83 f8 25             	cmp    $0x25,%eax
+  801947:	74 0c                	je     801955 <vprintfmt+0x36>
+			if (ch == '\0')
+  801949:	85 c0                	test   %eax,%eax
+  80194b:	75 e6                	jne    801933 <vprintfmt+0x14>
+}
+  80194d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801950:	5b                   	pop    %ebx
+  801951:	5e                   	pop    %esi
+  801952:	5f                   	pop    %edi
+  801953:	5d                   	pop    %ebp
+  801954:	c3                   	ret
+		padc = ' ';
+  801955:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801959:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801960:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801967:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80196e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801973:	8d 47 01             	lea    0x1(%edi),%eax
+  801976:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801979:	0f b6 17             	movzbl (%edi),%edx
+  80197c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80197f:	3c 55                	cmp    $0x55,%al
+  801981:	0f 87 cf 03 00 00    	ja     801d56 <vprintfmt+0x437>
+  801987:	0f b6 c0             	movzbl %al,%eax
+  80198a:	ff 24 85 e0 29 80 00 	jmp    *0x8029e0(,%eax,4)
+  801991:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801994:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801998:	eb d9                	jmp    801973 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80199a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80199d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8019a1:	eb d0                	jmp    801973 <vprintfmt+0x54>
+  8019a3:	0f b6 d2             	movzbl %dl,%edx
+  8019a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8019a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ae:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8019b1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8019b4:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8019b8:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8019bb:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8019be:	83 f9 09             	cmp    $0x9,%ecx
+  8019c1:	77 55                	ja     801a18 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8019c3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8019c6:	eb e9                	jmp    8019b1 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8019c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019cb:	8b 00                	mov    (%eax),%eax
+  8019cd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8019d6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8019dc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019e0:	79 91                	jns    801973 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019e2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019e8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019ef:	eb 82                	jmp    801973 <vprintfmt+0x54>
+			if (width < 0)
+  8019f1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019f4:	85 d2                	test   %edx,%edx
+  8019f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fb:	0f 49 c2             	cmovns %edx,%eax
+  8019fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801a01:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801a04:	e9 6a ff ff ff       	jmp    801973 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801a09:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801a0c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801a13:	e9 5b ff ff ff       	jmp    801973 <vprintfmt+0x54>
+  801a18:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801a1b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801a1e:	eb bc                	jmp    8019dc <vprintfmt+0xbd>
+			lflag++;
+  801a20:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801a23:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801a26:	e9 48 ff ff ff       	jmp    801973 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801a2b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a2e:	8d 78 04             	lea    0x4(%eax),%edi
+  801a31:	83 ec 08             	sub    $0x8,%esp
+  801a34:	53                   	push   %ebx
+  801a35:	ff 30                	push   (%eax)
+  801a37:	ff d6                	call   *%esi
+			break;
+  801a39:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801a3c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801a3f:	e9 b1 02 00 00       	jmp    801cf5 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801a44:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a47:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a4a:	8b 10                	mov    (%eax),%edx
+  801a4c:	89 d0                	mov    %edx,%eax
+  801a4e:	f7 d8                	neg    %eax
+  801a50:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a53:	83 f8 0f             	cmp    $0xf,%eax
+  801a56:	7f 23                	jg     801a7b <vprintfmt+0x15c>
+  801a58:	8b 14 85 40 2b 80 00 	mov    0x802b40(,%eax,4),%edx
+  801a5f:	85 d2                	test   %edx,%edx
+  801a61:	74 18                	je     801a7b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a63:	52                   	push   %edx
+  801a64:	68 01 28 80 00       	push   $0x802801
+  801a69:	53                   	push   %ebx
+  801a6a:	56                   	push   %esi
+  801a6b:	e8 92 fe ff ff       	call   801902 <printfmt>
+  801a70:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a73:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a76:	e9 7a 02 00 00       	jmp    801cf5 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801a7b:	50                   	push   %eax
+  801a7c:	68 bb 28 80 00       	push   $0x8028bb
+  801a81:	53                   	push   %ebx
+  801a82:	56                   	push   %esi
+  801a83:	e8 7a fe ff ff       	call   801902 <printfmt>
+  801a88:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a8b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a8e:	e9 62 02 00 00       	jmp    801cf5 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a93:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a96:	83 c0 04             	add    $0x4,%eax
+  801a99:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a9f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801aa1:	85 c9                	test   %ecx,%ecx
+  801aa3:	b8 b4 28 80 00       	mov    $0x8028b4,%eax
+  801aa8:	0f 45 c1             	cmovne %ecx,%eax
+  801aab:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801aae:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801ab2:	7e 06                	jle    801aba <vprintfmt+0x19b>
+  801ab4:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801ab8:	75 0b                	jne    801ac5 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aba:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801abd:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801ac0:	89 75 08             	mov    %esi,0x8(%ebp)
+  801ac3:	eb 5c                	jmp    801b21 <vprintfmt+0x202>
+  801ac5:	83 ec 08             	sub    $0x8,%esp
+  801ac8:	ff 75 d0             	push   -0x30(%ebp)
+  801acb:	ff 75 cc             	push   -0x34(%ebp)
+  801ace:	e8 20 03 00 00       	call   801df3 <strnlen>
+  801ad3:	89 c2                	mov    %eax,%edx
+  801ad5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ad8:	29 d0                	sub    %edx,%eax
+  801ada:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801add:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801ae1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ae4:	89 75 08             	mov    %esi,0x8(%ebp)
+  801ae7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ae9:	eb 0e                	jmp    801af9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801aeb:	83 ec 08             	sub    $0x8,%esp
+  801aee:	53                   	push   %ebx
+  801aef:	57                   	push   %edi
+  801af0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801af3:	83 ee 01             	sub    $0x1,%esi
+  801af6:	83 c4 10             	add    $0x10,%esp
+  801af9:	85 f6                	test   %esi,%esi
+  801afb:	7f ee                	jg     801aeb <vprintfmt+0x1cc>
+  801afd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b00:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b0a:	0f 49 d0             	cmovns %eax,%edx
+  801b0d:	29 d0                	sub    %edx,%eax
+  801b0f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801b12:	eb a6                	jmp    801aba <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801b14:	83 ec 08             	sub    $0x8,%esp
+  801b17:	53                   	push   %ebx
+  801b18:	52                   	push   %edx
+  801b19:	ff 55 08             	call   *0x8(%ebp)
+  801b1c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801b1f:	89 f1                	mov    %esi,%ecx
+  801b21:	8d 71 01             	lea    0x1(%ecx),%esi
+  801b24:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801b28:	0f be d0             	movsbl %al,%edx
+  801b2b:	85 d2                	test   %edx,%edx
+  801b2d:	74 28                	je     801b57 <vprintfmt+0x238>
+  801b2f:	85 ff                	test   %edi,%edi
+  801b31:	78 05                	js     801b38 <vprintfmt+0x219>
+  801b33:	83 ef 01             	sub    $0x1,%edi
+  801b36:	78 30                	js     801b68 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801b38:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801b3c:	74 d6                	je     801b14 <vprintfmt+0x1f5>
+  801b3e:	0f be c0             	movsbl %al,%eax
+  801b41:	83 e8 20             	sub    $0x20,%eax
+  801b44:	83 f8 5e             	cmp    $0x5e,%eax
+  801b47:	76 cb                	jbe    801b14 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b49:	83 ec 08             	sub    $0x8,%esp
+  801b4c:	53                   	push   %ebx
+  801b4d:	6a 3f                	push   $0x3f
+  801b4f:	ff 55 08             	call   *0x8(%ebp)
+  801b52:	83 c4 10             	add    $0x10,%esp
+  801b55:	eb c8                	jmp    801b1f <vprintfmt+0x200>
+  801b57:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b5a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b5d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b60:	01 d0                	add    %edx,%eax
+  801b62:	29 c8                	sub    %ecx,%eax
+  801b64:	89 c7                	mov    %eax,%edi
+  801b66:	eb 13                	jmp    801b7b <vprintfmt+0x25c>
+  801b68:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b6b:	eb ed                	jmp    801b5a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b6d:	83 ec 08             	sub    $0x8,%esp
+  801b70:	53                   	push   %ebx
+  801b71:	6a 20                	push   $0x20
+  801b73:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b75:	83 ef 01             	sub    $0x1,%edi
+  801b78:	83 c4 10             	add    $0x10,%esp
+  801b7b:	85 ff                	test   %edi,%edi
+  801b7d:	7f ee                	jg     801b6d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b7f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b82:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b85:	e9 6b 01 00 00       	jmp    801cf5 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801b8a:	83 f9 01             	cmp    $0x1,%ecx
+  801b8d:	7f 1f                	jg     801bae <vprintfmt+0x28f>
+	else if (lflag)
+  801b8f:	85 c9                	test   %ecx,%ecx
+  801b91:	74 67                	je     801bfa <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801b93:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b96:	8b 00                	mov    (%eax),%eax
+  801b98:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b9b:	89 c1                	mov    %eax,%ecx
+  801b9d:	c1 f9 1f             	sar    $0x1f,%ecx
+  801ba0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801ba3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ba6:	8d 40 04             	lea    0x4(%eax),%eax
+  801ba9:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bac:	eb 17                	jmp    801bc5 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801bae:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bb1:	8b 50 04             	mov    0x4(%eax),%edx
+  801bb4:	8b 00                	mov    (%eax),%eax
+  801bb6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bb9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801bbc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bbf:	8d 40 08             	lea    0x8(%eax),%eax
+  801bc2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801bc5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801bc8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801bcb:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801bd0:	85 c9                	test   %ecx,%ecx
+  801bd2:	0f 89 03 01 00 00    	jns    801cdb <vprintfmt+0x3bc>
+				putch('-', putdat);
+  801bd8:	83 ec 08             	sub    $0x8,%esp
+  801bdb:	53                   	push   %ebx
+  801bdc:	6a 2d                	push   $0x2d
+  801bde:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801be0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801be3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801be6:	f7 da                	neg    %edx
+  801be8:	83 d1 00             	adc    $0x0,%ecx
+  801beb:	f7 d9                	neg    %ecx
+  801bed:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bf0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bf5:	e9 e1 00 00 00       	jmp    801cdb <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  801bfa:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bfd:	8b 00                	mov    (%eax),%eax
+  801bff:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801c02:	89 c1                	mov    %eax,%ecx
+  801c04:	c1 f9 1f             	sar    $0x1f,%ecx
+  801c07:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801c0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c0d:	8d 40 04             	lea    0x4(%eax),%eax
+  801c10:	89 45 14             	mov    %eax,0x14(%ebp)
+  801c13:	eb b0                	jmp    801bc5 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801c15:	83 f9 01             	cmp    $0x1,%ecx
+  801c18:	7f 1e                	jg     801c38 <vprintfmt+0x319>
+	else if (lflag)
+  801c1a:	85 c9                	test   %ecx,%ecx
+  801c1c:	74 32                	je     801c50 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  801c1e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c21:	8b 10                	mov    (%eax),%edx
+  801c23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c28:	8d 40 04             	lea    0x4(%eax),%eax
+  801c2b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c2e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801c33:	e9 a3 00 00 00       	jmp    801cdb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c38:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c3b:	8b 10                	mov    (%eax),%edx
+  801c3d:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c40:	8d 40 08             	lea    0x8(%eax),%eax
+  801c43:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c46:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c4b:	e9 8b 00 00 00       	jmp    801cdb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c50:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c53:	8b 10                	mov    (%eax),%edx
+  801c55:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c5a:	8d 40 04             	lea    0x4(%eax),%eax
+  801c5d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c60:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c65:	eb 74                	jmp    801cdb <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  801c67:	83 f9 01             	cmp    $0x1,%ecx
+  801c6a:	7f 1b                	jg     801c87 <vprintfmt+0x368>
+	else if (lflag)
+  801c6c:	85 c9                	test   %ecx,%ecx
+  801c6e:	74 2c                	je     801c9c <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  801c70:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c73:	8b 10                	mov    (%eax),%edx
+  801c75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c7a:	8d 40 04             	lea    0x4(%eax),%eax
+  801c7d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c80:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  801c85:	eb 54                	jmp    801cdb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c87:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c8a:	8b 10                	mov    (%eax),%edx
+  801c8c:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c8f:	8d 40 08             	lea    0x8(%eax),%eax
+  801c92:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c95:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  801c9a:	eb 3f                	jmp    801cdb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c9f:	8b 10                	mov    (%eax),%edx
+  801ca1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ca6:	8d 40 04             	lea    0x4(%eax),%eax
+  801ca9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801cac:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  801cb1:	eb 28                	jmp    801cdb <vprintfmt+0x3bc>
+			putch('0', putdat);
+  801cb3:	83 ec 08             	sub    $0x8,%esp
+  801cb6:	53                   	push   %ebx
+  801cb7:	6a 30                	push   $0x30
+  801cb9:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801cbb:	83 c4 08             	add    $0x8,%esp
+  801cbe:	53                   	push   %ebx
+  801cbf:	6a 78                	push   $0x78
+  801cc1:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801cc3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cc6:	8b 10                	mov    (%eax),%edx
+  801cc8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801ccd:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801cd0:	8d 40 04             	lea    0x4(%eax),%eax
+  801cd3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cd6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801cdb:	83 ec 0c             	sub    $0xc,%esp
+  801cde:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801ce2:	50                   	push   %eax
+  801ce3:	ff 75 e0             	push   -0x20(%ebp)
+  801ce6:	57                   	push   %edi
+  801ce7:	51                   	push   %ecx
+  801ce8:	52                   	push   %edx
+  801ce9:	89 da                	mov    %ebx,%edx
+  801ceb:	89 f0                	mov    %esi,%eax
+  801ced:	e8 4a fb ff ff       	call   80183c <printnum>
+			break;
+  801cf2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801cf5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801cf8:	e9 40 fc ff ff       	jmp    80193d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801cfd:	83 f9 01             	cmp    $0x1,%ecx
+  801d00:	7f 1b                	jg     801d1d <vprintfmt+0x3fe>
+	else if (lflag)
+  801d02:	85 c9                	test   %ecx,%ecx
+  801d04:	74 2c                	je     801d32 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  801d06:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d09:	8b 10                	mov    (%eax),%edx
+  801d0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d10:	8d 40 04             	lea    0x4(%eax),%eax
+  801d13:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d16:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801d1b:	eb be                	jmp    801cdb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801d1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d20:	8b 10                	mov    (%eax),%edx
+  801d22:	8b 48 04             	mov    0x4(%eax),%ecx
+  801d25:	8d 40 08             	lea    0x8(%eax),%eax
+  801d28:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d2b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801d30:	eb a9                	jmp    801cdb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801d32:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d35:	8b 10                	mov    (%eax),%edx
+  801d37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d3c:	8d 40 04             	lea    0x4(%eax),%eax
+  801d3f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d42:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d47:	eb 92                	jmp    801cdb <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  801d49:	83 ec 08             	sub    $0x8,%esp
+  801d4c:	53                   	push   %ebx
+  801d4d:	6a 25                	push   $0x25
+  801d4f:	ff d6                	call   *%esi
+			break;
+  801d51:	83 c4 10             	add    $0x10,%esp
+  801d54:	eb 9f                	jmp    801cf5 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  801d56:	83 ec 08             	sub    $0x8,%esp
+  801d59:	53                   	push   %ebx
+  801d5a:	6a 25                	push   $0x25
+  801d5c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d5e:	83 c4 10             	add    $0x10,%esp
+  801d61:	89 f8                	mov    %edi,%eax
+  801d63:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d67:	74 05                	je     801d6e <vprintfmt+0x44f>
+  801d69:	83 e8 01             	sub    $0x1,%eax
+  801d6c:	eb f5                	jmp    801d63 <vprintfmt+0x444>
+  801d6e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d71:	eb 82                	jmp    801cf5 <vprintfmt+0x3d6>
+
+00801d73 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d73:	55                   	push   %ebp
+  801d74:	89 e5                	mov    %esp,%ebp
+  801d76:	83 ec 18             	sub    $0x18,%esp
+  801d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d7f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d82:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d86:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d89:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d90:	85 c0                	test   %eax,%eax
+  801d92:	74 26                	je     801dba <vsnprintf+0x47>
+  801d94:	85 d2                	test   %edx,%edx
+  801d96:	7e 22                	jle    801dba <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d98:	ff 75 14             	push   0x14(%ebp)
+  801d9b:	ff 75 10             	push   0x10(%ebp)
+  801d9e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801da1:	50                   	push   %eax
+  801da2:	68 e5 18 80 00       	push   $0x8018e5
+  801da7:	e8 73 fb ff ff       	call   80191f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801dac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801daf:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801db2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801db5:	83 c4 10             	add    $0x10,%esp
+}
+  801db8:	c9                   	leave
+  801db9:	c3                   	ret
+		return -E_INVAL;
+  801dba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dbf:	eb f7                	jmp    801db8 <vsnprintf+0x45>
+
+00801dc1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801dc1:	55                   	push   %ebp
+  801dc2:	89 e5                	mov    %esp,%ebp
+  801dc4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801dc7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801dca:	50                   	push   %eax
+  801dcb:	ff 75 10             	push   0x10(%ebp)
+  801dce:	ff 75 0c             	push   0xc(%ebp)
+  801dd1:	ff 75 08             	push   0x8(%ebp)
+  801dd4:	e8 9a ff ff ff       	call   801d73 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801dd9:	c9                   	leave
+  801dda:	c3                   	ret
+
+00801ddb <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801ddb:	55                   	push   %ebp
+  801ddc:	89 e5                	mov    %esp,%ebp
+  801dde:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de6:	eb 03                	jmp    801deb <strlen+0x10>
+		n++;
+  801de8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801deb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801def:	75 f7                	jne    801de8 <strlen+0xd>
+	return n;
+}
+  801df1:	5d                   	pop    %ebp
+  801df2:	c3                   	ret
+
+00801df3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801df3:	55                   	push   %ebp
+  801df4:	89 e5                	mov    %esp,%ebp
+  801df6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801df9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e01:	eb 03                	jmp    801e06 <strnlen+0x13>
+		n++;
+  801e03:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801e06:	39 d0                	cmp    %edx,%eax
+  801e08:	74 08                	je     801e12 <strnlen+0x1f>
+  801e0a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801e0e:	75 f3                	jne    801e03 <strnlen+0x10>
+  801e10:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801e12:	89 d0                	mov    %edx,%eax
+  801e14:	5d                   	pop    %ebp
+  801e15:	c3                   	ret
+
+00801e16 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801e16:	55                   	push   %ebp
+  801e17:	89 e5                	mov    %esp,%ebp
+  801e19:	53                   	push   %ebx
+  801e1a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e1d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e25:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801e29:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801e2c:	83 c0 01             	add    $0x1,%eax
+  801e2f:	84 d2                	test   %dl,%dl
+  801e31:	75 f2                	jne    801e25 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801e33:	89 c8                	mov    %ecx,%eax
+  801e35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e38:	c9                   	leave
+  801e39:	c3                   	ret
+
+00801e3a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801e3a:	55                   	push   %ebp
+  801e3b:	89 e5                	mov    %esp,%ebp
+  801e3d:	53                   	push   %ebx
+  801e3e:	83 ec 10             	sub    $0x10,%esp
+  801e41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e44:	53                   	push   %ebx
+  801e45:	e8 91 ff ff ff       	call   801ddb <strlen>
+  801e4a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e4d:	ff 75 0c             	push   0xc(%ebp)
+  801e50:	01 d8                	add    %ebx,%eax
+  801e52:	50                   	push   %eax
+  801e53:	e8 be ff ff ff       	call   801e16 <strcpy>
+	return dst;
+}
+  801e58:	89 d8                	mov    %ebx,%eax
+  801e5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e5d:	c9                   	leave
+  801e5e:	c3                   	ret
+
+00801e5f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e5f:	55                   	push   %ebp
+  801e60:	89 e5                	mov    %esp,%ebp
+  801e62:	56                   	push   %esi
+  801e63:	53                   	push   %ebx
+  801e64:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e67:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e6a:	89 f3                	mov    %esi,%ebx
+  801e6c:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e6f:	89 f0                	mov    %esi,%eax
+  801e71:	eb 0f                	jmp    801e82 <strncpy+0x23>
+		*dst++ = *src;
+  801e73:	83 c0 01             	add    $0x1,%eax
+  801e76:	0f b6 0a             	movzbl (%edx),%ecx
+  801e79:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e7c:	80 f9 01             	cmp    $0x1,%cl
+  801e7f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e82:	39 d8                	cmp    %ebx,%eax
+  801e84:	75 ed                	jne    801e73 <strncpy+0x14>
+	}
+	return ret;
+}
+  801e86:	89 f0                	mov    %esi,%eax
+  801e88:	5b                   	pop    %ebx
+  801e89:	5e                   	pop    %esi
+  801e8a:	5d                   	pop    %ebp
+  801e8b:	c3                   	ret
+
+00801e8c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e8c:	55                   	push   %ebp
+  801e8d:	89 e5                	mov    %esp,%ebp
+  801e8f:	56                   	push   %esi
+  801e90:	53                   	push   %ebx
+  801e91:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e97:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e9a:	89 f0                	mov    %esi,%eax
+  801e9c:	85 d2                	test   %edx,%edx
+  801e9e:	74 21                	je     801ec1 <strlcpy+0x35>
+  801ea0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801ea4:	89 f2                	mov    %esi,%edx
+  801ea6:	eb 09                	jmp    801eb1 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801ea8:	83 c1 01             	add    $0x1,%ecx
+  801eab:	83 c2 01             	add    $0x1,%edx
+  801eae:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801eb1:	39 c2                	cmp    %eax,%edx
+  801eb3:	74 09                	je     801ebe <strlcpy+0x32>
+  801eb5:	0f b6 19             	movzbl (%ecx),%ebx
+  801eb8:	84 db                	test   %bl,%bl
+  801eba:	75 ec                	jne    801ea8 <strlcpy+0x1c>
+  801ebc:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801ebe:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801ec1:	29 f0                	sub    %esi,%eax
+}
+  801ec3:	5b                   	pop    %ebx
+  801ec4:	5e                   	pop    %esi
+  801ec5:	5d                   	pop    %ebp
+  801ec6:	c3                   	ret
+
+00801ec7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801ec7:	55                   	push   %ebp
+  801ec8:	89 e5                	mov    %esp,%ebp
+  801eca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ecd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801ed0:	eb 06                	jmp    801ed8 <strcmp+0x11>
+		p++, q++;
+  801ed2:	83 c1 01             	add    $0x1,%ecx
+  801ed5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801ed8:	0f b6 01             	movzbl (%ecx),%eax
+  801edb:	84 c0                	test   %al,%al
+  801edd:	74 04                	je     801ee3 <strcmp+0x1c>
+  801edf:	3a 02                	cmp    (%edx),%al
+  801ee1:	74 ef                	je     801ed2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ee3:	0f b6 c0             	movzbl %al,%eax
+  801ee6:	0f b6 12             	movzbl (%edx),%edx
+  801ee9:	29 d0                	sub    %edx,%eax
+}
+  801eeb:	5d                   	pop    %ebp
+  801eec:	c3                   	ret
+
+00801eed <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801eed:	55                   	push   %ebp
+  801eee:	89 e5                	mov    %esp,%ebp
+  801ef0:	53                   	push   %ebx
+  801ef1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ef7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801efa:	eb 09                	jmp    801f05 <strncmp+0x18>
+		n--, p++, q++;
+  801efc:	83 ea 01             	sub    $0x1,%edx
+  801eff:	83 c0 01             	add    $0x1,%eax
+  801f02:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801f05:	85 d2                	test   %edx,%edx
+  801f07:	74 18                	je     801f21 <strncmp+0x34>
+  801f09:	0f b6 18             	movzbl (%eax),%ebx
+  801f0c:	84 db                	test   %bl,%bl
+  801f0e:	74 04                	je     801f14 <strncmp+0x27>
+  801f10:	3a 19                	cmp    (%ecx),%bl
+  801f12:	74 e8                	je     801efc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801f14:	0f b6 00             	movzbl (%eax),%eax
+  801f17:	0f b6 11             	movzbl (%ecx),%edx
+  801f1a:	29 d0                	sub    %edx,%eax
+}
+  801f1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f1f:	c9                   	leave
+  801f20:	c3                   	ret
+		return 0;
+  801f21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f26:	eb f4                	jmp    801f1c <strncmp+0x2f>
+
+00801f28 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801f28:	55                   	push   %ebp
+  801f29:	89 e5                	mov    %esp,%ebp
+  801f2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f32:	eb 03                	jmp    801f37 <strchr+0xf>
+  801f34:	83 c0 01             	add    $0x1,%eax
+  801f37:	0f b6 10             	movzbl (%eax),%edx
+  801f3a:	84 d2                	test   %dl,%dl
+  801f3c:	74 06                	je     801f44 <strchr+0x1c>
+		if (*s == c)
+  801f3e:	38 ca                	cmp    %cl,%dl
+  801f40:	75 f2                	jne    801f34 <strchr+0xc>
+  801f42:	eb 05                	jmp    801f49 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f49:	5d                   	pop    %ebp
+  801f4a:	c3                   	ret
+
+00801f4b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f4b:	55                   	push   %ebp
+  801f4c:	89 e5                	mov    %esp,%ebp
+  801f4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f51:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f55:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f58:	38 ca                	cmp    %cl,%dl
+  801f5a:	74 09                	je     801f65 <strfind+0x1a>
+  801f5c:	84 d2                	test   %dl,%dl
+  801f5e:	74 05                	je     801f65 <strfind+0x1a>
+	for (; *s; s++)
+  801f60:	83 c0 01             	add    $0x1,%eax
+  801f63:	eb f0                	jmp    801f55 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f65:	5d                   	pop    %ebp
+  801f66:	c3                   	ret
+
+00801f67 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f67:	55                   	push   %ebp
+  801f68:	89 e5                	mov    %esp,%ebp
+  801f6a:	57                   	push   %edi
+  801f6b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f6e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f71:	85 c9                	test   %ecx,%ecx
+  801f73:	74 20                	je     801f95 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f75:	89 f8                	mov    %edi,%eax
+  801f77:	09 c8                	or     %ecx,%eax
+  801f79:	a8 03                	test   $0x3,%al
+  801f7b:	75 12                	jne    801f8f <memset+0x28>
+		c &= 0xFF;
+  801f7d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f81:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f87:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f8a:	fc                   	cld
+  801f8b:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f8d:	eb 06                	jmp    801f95 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f92:	fc                   	cld
+  801f93:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f95:	89 f8                	mov    %edi,%eax
+  801f97:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f9a:	c9                   	leave
+  801f9b:	c3                   	ret
+
+00801f9c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f9c:	55                   	push   %ebp
+  801f9d:	89 e5                	mov    %esp,%ebp
+  801f9f:	57                   	push   %edi
+  801fa0:	56                   	push   %esi
+  801fa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801fa7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801faa:	39 c6                	cmp    %eax,%esi
+  801fac:	73 32                	jae    801fe0 <memmove+0x44>
+  801fae:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801fb1:	39 d0                	cmp    %edx,%eax
+  801fb3:	73 2b                	jae    801fe0 <memmove+0x44>
+		s += n;
+		d += n;
+  801fb5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fb8:	89 d6                	mov    %edx,%esi
+  801fba:	09 fe                	or     %edi,%esi
+  801fbc:	09 ce                	or     %ecx,%esi
+  801fbe:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801fc4:	75 0e                	jne    801fd4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801fc6:	83 ef 04             	sub    $0x4,%edi
+  801fc9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801fcc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801fcf:	fd                   	std
+  801fd0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fd2:	eb 09                	jmp    801fdd <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801fd4:	83 ef 01             	sub    $0x1,%edi
+  801fd7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801fda:	fd                   	std
+  801fdb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801fdd:	fc                   	cld
+  801fde:	eb 1a                	jmp    801ffa <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fe0:	89 f2                	mov    %esi,%edx
+  801fe2:	09 c2                	or     %eax,%edx
+  801fe4:	09 ca                	or     %ecx,%edx
+  801fe6:	f6 c2 03             	test   $0x3,%dl
+  801fe9:	75 0a                	jne    801ff5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801feb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fee:	89 c7                	mov    %eax,%edi
+  801ff0:	fc                   	cld
+  801ff1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801ff3:	eb 05                	jmp    801ffa <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801ff5:	89 c7                	mov    %eax,%edi
+  801ff7:	fc                   	cld
+  801ff8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801ffa:	5e                   	pop    %esi
+  801ffb:	5f                   	pop    %edi
+  801ffc:	5d                   	pop    %ebp
+  801ffd:	c3                   	ret
+
+00801ffe <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801ffe:	55                   	push   %ebp
+  801fff:	89 e5                	mov    %esp,%ebp
+  802001:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802004:	ff 75 10             	push   0x10(%ebp)
+  802007:	ff 75 0c             	push   0xc(%ebp)
+  80200a:	ff 75 08             	push   0x8(%ebp)
+  80200d:	e8 8a ff ff ff       	call   801f9c <memmove>
+}
+  802012:	c9                   	leave
+  802013:	c3                   	ret
+
+00802014 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802014:	55                   	push   %ebp
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	56                   	push   %esi
+  802018:	53                   	push   %ebx
+  802019:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80201f:	89 c6                	mov    %eax,%esi
+  802021:	03 75 10             	add    0x10(%ebp),%esi
+  802024:	eb 06                	jmp    80202c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802026:	83 c0 01             	add    $0x1,%eax
+  802029:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80202c:	39 f0                	cmp    %esi,%eax
+  80202e:	74 14                	je     802044 <memcmp+0x30>
+		if (*s1 != *s2)
+  802030:	0f b6 08             	movzbl (%eax),%ecx
+  802033:	0f b6 1a             	movzbl (%edx),%ebx
+  802036:	38 d9                	cmp    %bl,%cl
+  802038:	74 ec                	je     802026 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80203a:	0f b6 c1             	movzbl %cl,%eax
+  80203d:	0f b6 db             	movzbl %bl,%ebx
+  802040:	29 d8                	sub    %ebx,%eax
+  802042:	eb 05                	jmp    802049 <memcmp+0x35>
+	}
+
+	return 0;
+  802044:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802049:	5b                   	pop    %ebx
+  80204a:	5e                   	pop    %esi
+  80204b:	5d                   	pop    %ebp
+  80204c:	c3                   	ret
+
+0080204d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80204d:	55                   	push   %ebp
+  80204e:	89 e5                	mov    %esp,%ebp
+  802050:	8b 45 08             	mov    0x8(%ebp),%eax
+  802053:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802056:	89 c2                	mov    %eax,%edx
+  802058:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80205b:	eb 03                	jmp    802060 <memfind+0x13>
+  80205d:	83 c0 01             	add    $0x1,%eax
+  802060:	39 d0                	cmp    %edx,%eax
+  802062:	73 04                	jae    802068 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802064:	38 08                	cmp    %cl,(%eax)
+  802066:	75 f5                	jne    80205d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802068:	5d                   	pop    %ebp
+  802069:	c3                   	ret
+
+0080206a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80206a:	55                   	push   %ebp
+  80206b:	89 e5                	mov    %esp,%ebp
+  80206d:	57                   	push   %edi
+  80206e:	56                   	push   %esi
+  80206f:	53                   	push   %ebx
+  802070:	8b 55 08             	mov    0x8(%ebp),%edx
+  802073:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802076:	eb 03                	jmp    80207b <strtol+0x11>
+		s++;
+  802078:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80207b:	0f b6 02             	movzbl (%edx),%eax
+  80207e:	3c 20                	cmp    $0x20,%al
+  802080:	74 f6                	je     802078 <strtol+0xe>
+  802082:	3c 09                	cmp    $0x9,%al
+  802084:	74 f2                	je     802078 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802086:	3c 2b                	cmp    $0x2b,%al
+  802088:	74 2a                	je     8020b4 <strtol+0x4a>
+	int neg = 0;
+  80208a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80208f:	3c 2d                	cmp    $0x2d,%al
+  802091:	74 2b                	je     8020be <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802093:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802099:	75 0f                	jne    8020aa <strtol+0x40>
+  80209b:	80 3a 30             	cmpb   $0x30,(%edx)
+  80209e:	74 28                	je     8020c8 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8020a0:	85 db                	test   %ebx,%ebx
+  8020a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8020a7:	0f 44 d8             	cmove  %eax,%ebx
+  8020aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020af:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8020b2:	eb 46                	jmp    8020fa <strtol+0x90>
+		s++;
+  8020b4:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8020b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020bc:	eb d5                	jmp    802093 <strtol+0x29>
+		s++, neg = 1;
+  8020be:	83 c2 01             	add    $0x1,%edx
+  8020c1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020c6:	eb cb                	jmp    802093 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8020c8:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8020cc:	74 0e                	je     8020dc <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8020ce:	85 db                	test   %ebx,%ebx
+  8020d0:	75 d8                	jne    8020aa <strtol+0x40>
+		s++, base = 8;
+  8020d2:	83 c2 01             	add    $0x1,%edx
+  8020d5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8020da:	eb ce                	jmp    8020aa <strtol+0x40>
+		s += 2, base = 16;
+  8020dc:	83 c2 02             	add    $0x2,%edx
+  8020df:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020e4:	eb c4                	jmp    8020aa <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020e6:	0f be c0             	movsbl %al,%eax
+  8020e9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020ec:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020ef:	7d 3a                	jge    80212b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020f1:	83 c2 01             	add    $0x1,%edx
+  8020f4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020f8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020fa:	0f b6 02             	movzbl (%edx),%eax
+  8020fd:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802100:	89 f3                	mov    %esi,%ebx
+  802102:	80 fb 09             	cmp    $0x9,%bl
+  802105:	76 df                	jbe    8020e6 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802107:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80210a:	89 f3                	mov    %esi,%ebx
+  80210c:	80 fb 19             	cmp    $0x19,%bl
+  80210f:	77 08                	ja     802119 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802111:	0f be c0             	movsbl %al,%eax
+  802114:	83 e8 57             	sub    $0x57,%eax
+  802117:	eb d3                	jmp    8020ec <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802119:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80211c:	89 f3                	mov    %esi,%ebx
+  80211e:	80 fb 19             	cmp    $0x19,%bl
+  802121:	77 08                	ja     80212b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802123:	0f be c0             	movsbl %al,%eax
+  802126:	83 e8 37             	sub    $0x37,%eax
+  802129:	eb c1                	jmp    8020ec <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80212b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80212f:	74 05                	je     802136 <strtol+0xcc>
+		*endptr = (char *) s;
+  802131:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802134:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802136:	89 c8                	mov    %ecx,%eax
+  802138:	f7 d8                	neg    %eax
+  80213a:	85 ff                	test   %edi,%edi
+  80213c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80213f:	89 c8                	mov    %ecx,%eax
+  802141:	5b                   	pop    %ebx
+  802142:	5e                   	pop    %esi
+  802143:	5f                   	pop    %edi
+  802144:	5d                   	pop    %ebp
+  802145:	c3                   	ret
+
+00802146 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802146:	55                   	push   %ebp
+  802147:	89 e5                	mov    %esp,%ebp
+  802149:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80214c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  802153:	74 0a                	je     80215f <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802155:	8b 45 08             	mov    0x8(%ebp),%eax
+  802158:	a3 00 70 80 00       	mov    %eax,0x807000
+}
+  80215d:	c9                   	leave
+  80215e:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  80215f:	83 ec 04             	sub    $0x4,%esp
+  802162:	6a 07                	push   $0x7
+  802164:	68 00 f0 bf ee       	push   $0xeebff000
+  802169:	6a 00                	push   $0x0
+  80216b:	e8 81 e0 ff ff       	call   8001f1 <sys_page_alloc>
+  802170:	83 c4 10             	add    $0x10,%esp
+  802173:	85 c0                	test   %eax,%eax
+  802175:	78 28                	js     80219f <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802177:	83 ec 08             	sub    $0x8,%esp
+  80217a:	68 16 06 80 00       	push   $0x800616
+  80217f:	6a 00                	push   $0x0
+  802181:	e8 66 e3 ff ff       	call   8004ec <sys_env_set_pgfault_upcall>
+  802186:	83 c4 10             	add    $0x10,%esp
+  802189:	85 c0                	test   %eax,%eax
+  80218b:	79 c8                	jns    802155 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  80218d:	50                   	push   %eax
+  80218e:	68 c0 2b 80 00       	push   $0x802bc0
+  802193:	6a 24                	push   $0x24
+  802195:	68 b2 2b 80 00       	push   $0x802bb2
+  80219a:	e8 ae f5 ff ff       	call   80174d <_panic>
+			panic("sys_page_alloc: %e", r);
+  80219f:	50                   	push   %eax
+  8021a0:	68 9f 2b 80 00       	push   $0x802b9f
+  8021a5:	6a 21                	push   $0x21
+  8021a7:	68 b2 2b 80 00       	push   $0x802bb2
+  8021ac:	e8 9c f5 ff ff       	call   80174d <_panic>
+
+008021b1 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8021b1:	55                   	push   %ebp
+  8021b2:	89 e5                	mov    %esp,%ebp
+  8021b4:	57                   	push   %edi
+  8021b5:	56                   	push   %esi
+  8021b6:	53                   	push   %ebx
+  8021b7:	83 ec 18             	sub    $0x18,%esp
+  8021ba:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021c0:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8021c3:	85 db                	test   %ebx,%ebx
+  8021c5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021ca:	0f 45 c3             	cmovne %ebx,%eax
+  8021cd:	50                   	push   %eax
+  8021ce:	e8 a1 e3 ff ff       	call   800574 <sys_ipc_recv>
+
+	if (from_env_store)
+  8021d3:	83 c4 10             	add    $0x10,%esp
+  8021d6:	85 ff                	test   %edi,%edi
+  8021d8:	74 17                	je     8021f1 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8021da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021df:	85 c0                	test   %eax,%eax
+  8021e1:	75 0c                	jne    8021ef <ipc_recv+0x3e>
+  8021e3:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  8021e9:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8021ef:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8021f1:	85 f6                	test   %esi,%esi
+  8021f3:	74 2e                	je     802223 <ipc_recv+0x72>
+		if (!r && pg)
+  8021f5:	85 c0                	test   %eax,%eax
+  8021f7:	75 24                	jne    80221d <ipc_recv+0x6c>
+  8021f9:	85 db                	test   %ebx,%ebx
+  8021fb:	74 20                	je     80221d <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8021fd:	a1 08 40 80 00       	mov    0x804008,%eax
+  802202:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802208:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80220a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80220f:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802215:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802218:	5b                   	pop    %ebx
+  802219:	5e                   	pop    %esi
+  80221a:	5f                   	pop    %edi
+  80221b:	5d                   	pop    %ebp
+  80221c:	c3                   	ret
+			*perm_store = 0;
+  80221d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802223:	85 c0                	test   %eax,%eax
+  802225:	75 ee                	jne    802215 <ipc_recv+0x64>
+  802227:	eb e1                	jmp    80220a <ipc_recv+0x59>
+
+00802229 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802229:	55                   	push   %ebp
+  80222a:	89 e5                	mov    %esp,%ebp
+  80222c:	57                   	push   %edi
+  80222d:	56                   	push   %esi
+  80222e:	53                   	push   %ebx
+  80222f:	83 ec 0c             	sub    $0xc,%esp
+  802232:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802235:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802238:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80223b:	85 db                	test   %ebx,%ebx
+  80223d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802242:	0f 44 d8             	cmove  %eax,%ebx
+  802245:	ff 75 14             	push   0x14(%ebp)
+  802248:	53                   	push   %ebx
+  802249:	56                   	push   %esi
+  80224a:	57                   	push   %edi
+  80224b:	e8 01 e3 ff ff       	call   800551 <sys_ipc_try_send_yield>
+  802250:	83 c4 10             	add    $0x10,%esp
+  802253:	85 c0                	test   %eax,%eax
+  802255:	79 1e                	jns    802275 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802257:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80225a:	75 07                	jne    802263 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80225c:	e8 10 df ff ff       	call   800171 <sys_yield>
+  802261:	eb e2                	jmp    802245 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802263:	50                   	push   %eax
+  802264:	68 de 2b 80 00       	push   $0x802bde
+  802269:	6a 3d                	push   $0x3d
+  80226b:	68 f3 2b 80 00       	push   $0x802bf3
+  802270:	e8 d8 f4 ff ff       	call   80174d <_panic>
+	}
+}
+  802275:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802278:	5b                   	pop    %ebx
+  802279:	5e                   	pop    %esi
+  80227a:	5f                   	pop    %edi
+  80227b:	5d                   	pop    %ebp
+  80227c:	c3                   	ret
+
+0080227d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80227d:	55                   	push   %ebp
+  80227e:	89 e5                	mov    %esp,%ebp
+  802280:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802283:	ff 75 08             	push   0x8(%ebp)
+  802286:	e8 66 de ff ff       	call   8000f1 <sys_env_find>
+}
+  80228b:	c9                   	leave
+  80228c:	c3                   	ret
+
+0080228d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80228d:	55                   	push   %ebp
+  80228e:	89 e5                	mov    %esp,%ebp
+  802290:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802293:	89 c2                	mov    %eax,%edx
+  802295:	c1 ea 16             	shr    $0x16,%edx
+  802298:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80229f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8022a4:	f6 c1 01             	test   $0x1,%cl
+  8022a7:	74 22                	je     8022cb <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8022a9:	c1 e8 0c             	shr    $0xc,%eax
+  8022ac:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8022b3:	a8 01                	test   $0x1,%al
+  8022b5:	74 14                	je     8022cb <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8022b7:	c1 e8 0c             	shr    $0xc,%eax
+  8022ba:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8022bd:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8022c4:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8022c8:	0f b7 d2             	movzwl %dx,%edx
+}
+  8022cb:	89 d0                	mov    %edx,%eax
+  8022cd:	5d                   	pop    %ebp
+  8022ce:	c3                   	ret
+  8022cf:	90                   	nop
+
+008022d0 <__udivmoddi4>:
+  8022d0:	55                   	push   %ebp
+  8022d1:	57                   	push   %edi
+  8022d2:	56                   	push   %esi
+  8022d3:	53                   	push   %ebx
+  8022d4:	83 ec 14             	sub    $0x14,%esp
+  8022d7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8022db:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8022df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022e7:	89 f1                	mov    %esi,%ecx
+  8022e9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022ed:	09 d9                	or     %ebx,%ecx
+  8022ef:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022f3:	0f 84 92 00 00 00    	je     80238b <__udivmoddi4+0xbb>
+  8022f9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802300:	00 
+  802301:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802306:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80230d:	00 
+  80230e:	89 1c 24             	mov    %ebx,(%esp)
+  802311:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802315:	8d 76 00             	lea    0x0(%esi),%esi
+  802318:	89 e9                	mov    %ebp,%ecx
+  80231a:	89 c3                	mov    %eax,%ebx
+  80231c:	89 d6                	mov    %edx,%esi
+  80231e:	31 ff                	xor    %edi,%edi
+  802320:	d3 ee                	shr    %cl,%esi
+  802322:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802325:	f6 c1 20             	test   $0x20,%cl
+  802328:	0f 45 de             	cmovne %esi,%ebx
+  80232b:	0f 45 f7             	cmovne %edi,%esi
+  80232e:	8b 3c 24             	mov    (%esp),%edi
+  802331:	39 fb                	cmp    %edi,%ebx
+  802333:	89 f7                	mov    %esi,%edi
+  802335:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802339:	8b 1c 24             	mov    (%esp),%ebx
+  80233c:	19 f7                	sbb    %esi,%edi
+  80233e:	72 39                	jb     802379 <__udivmoddi4+0xa9>
+  802340:	89 e9                	mov    %ebp,%ecx
+  802342:	89 f7                	mov    %esi,%edi
+  802344:	89 de                	mov    %ebx,%esi
+  802346:	0f a5 df             	shld   %cl,%ebx,%edi
+  802349:	d3 e6                	shl    %cl,%esi
+  80234b:	31 db                	xor    %ebx,%ebx
+  80234d:	f6 c1 20             	test   $0x20,%cl
+  802350:	0f 45 fe             	cmovne %esi,%edi
+  802353:	0f 45 f3             	cmovne %ebx,%esi
+  802356:	29 f0                	sub    %esi,%eax
+  802358:	be 01 00 00 00       	mov    $0x1,%esi
+  80235d:	19 fa                	sbb    %edi,%edx
+  80235f:	31 ff                	xor    %edi,%edi
+  802361:	31 db                	xor    %ebx,%ebx
+  802363:	0f a5 f7             	shld   %cl,%esi,%edi
+  802366:	d3 e6                	shl    %cl,%esi
+  802368:	f6 c1 20             	test   $0x20,%cl
+  80236b:	0f 45 fe             	cmovne %esi,%edi
+  80236e:	0f 45 f3             	cmovne %ebx,%esi
+  802371:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802375:	09 74 24 08          	or     %esi,0x8(%esp)
+  802379:	83 ed 01             	sub    $0x1,%ebp
+  80237c:	73 9a                	jae    802318 <__udivmoddi4+0x48>
+  80237e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802382:	85 ff                	test   %edi,%edi
+  802384:	74 05                	je     80238b <__udivmoddi4+0xbb>
+  802386:	89 07                	mov    %eax,(%edi)
+  802388:	89 57 04             	mov    %edx,0x4(%edi)
+  80238b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80238f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802393:	83 c4 14             	add    $0x14,%esp
+  802396:	5b                   	pop    %ebx
+  802397:	5e                   	pop    %esi
+  802398:	5f                   	pop    %edi
+  802399:	5d                   	pop    %ebp
+  80239a:	c3                   	ret
+  80239b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80239f:	90                   	nop
+
+008023a0 <__udivdi3>:
+  8023a0:	55                   	push   %ebp
+  8023a1:	57                   	push   %edi
+  8023a2:	56                   	push   %esi
+  8023a3:	53                   	push   %ebx
+  8023a4:	83 ec 14             	sub    $0x14,%esp
+  8023a7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8023ab:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8023af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8023b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8023b7:	89 fb                	mov    %edi,%ebx
+  8023b9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8023bd:	09 f3                	or     %esi,%ebx
+  8023bf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8023c3:	0f 84 85 00 00 00    	je     80244e <__udivdi3+0xae>
+  8023c9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8023d0:	00 
+  8023d1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8023d6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8023dd:	00 
+  8023de:	89 34 24             	mov    %esi,(%esp)
+  8023e1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023e5:	8d 76 00             	lea    0x0(%esi),%esi
+  8023e8:	89 e9                	mov    %ebp,%ecx
+  8023ea:	89 c3                	mov    %eax,%ebx
+  8023ec:	89 d6                	mov    %edx,%esi
+  8023ee:	31 ff                	xor    %edi,%edi
+  8023f0:	d3 ee                	shr    %cl,%esi
+  8023f2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8023f5:	f6 c1 20             	test   $0x20,%cl
+  8023f8:	0f 45 de             	cmovne %esi,%ebx
+  8023fb:	0f 45 f7             	cmovne %edi,%esi
+  8023fe:	8b 3c 24             	mov    (%esp),%edi
+  802401:	39 fb                	cmp    %edi,%ebx
+  802403:	89 f7                	mov    %esi,%edi
+  802405:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802409:	8b 1c 24             	mov    (%esp),%ebx
+  80240c:	19 f7                	sbb    %esi,%edi
+  80240e:	72 39                	jb     802449 <__udivdi3+0xa9>
+  802410:	89 e9                	mov    %ebp,%ecx
+  802412:	89 f7                	mov    %esi,%edi
+  802414:	89 de                	mov    %ebx,%esi
+  802416:	0f a5 df             	shld   %cl,%ebx,%edi
+  802419:	d3 e6                	shl    %cl,%esi
+  80241b:	31 db                	xor    %ebx,%ebx
+  80241d:	f6 c1 20             	test   $0x20,%cl
+  802420:	0f 45 fe             	cmovne %esi,%edi
+  802423:	0f 45 f3             	cmovne %ebx,%esi
+  802426:	29 f0                	sub    %esi,%eax
+  802428:	be 01 00 00 00       	mov    $0x1,%esi
+  80242d:	19 fa                	sbb    %edi,%edx
+  80242f:	31 ff                	xor    %edi,%edi
+  802431:	31 db                	xor    %ebx,%ebx
+  802433:	0f a5 f7             	shld   %cl,%esi,%edi
+  802436:	d3 e6                	shl    %cl,%esi
+  802438:	f6 c1 20             	test   $0x20,%cl
+  80243b:	0f 45 fe             	cmovne %esi,%edi
+  80243e:	0f 45 f3             	cmovne %ebx,%esi
+  802441:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802445:	09 74 24 08          	or     %esi,0x8(%esp)
+  802449:	83 ed 01             	sub    $0x1,%ebp
+  80244c:	73 9a                	jae    8023e8 <__udivdi3+0x48>
+  80244e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802452:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802456:	83 c4 14             	add    $0x14,%esp
+  802459:	5b                   	pop    %ebx
+  80245a:	5e                   	pop    %esi
+  80245b:	5f                   	pop    %edi
+  80245c:	5d                   	pop    %ebp
+  80245d:	c3                   	ret
+  80245e:	66 90                	xchg   %ax,%ax
+
+00802460 <__umoddi3>:
+  802460:	57                   	push   %edi
+  802461:	56                   	push   %esi
+  802462:	53                   	push   %ebx
+  802463:	83 ec 08             	sub    $0x8,%esp
+  802466:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80246a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80246e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802472:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802476:	89 f9                	mov    %edi,%ecx
+  802478:	89 34 24             	mov    %esi,(%esp)
+  80247b:	09 f1                	or     %esi,%ecx
+  80247d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802481:	74 53                	je     8024d6 <__umoddi3+0x76>
+  802483:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802488:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80248f:	90                   	nop
+  802490:	89 c6                	mov    %eax,%esi
+  802492:	89 d7                	mov    %edx,%edi
+  802494:	31 db                	xor    %ebx,%ebx
+  802496:	d3 ef                	shr    %cl,%edi
+  802498:	0f ad d6             	shrd   %cl,%edx,%esi
+  80249b:	f6 c1 20             	test   $0x20,%cl
+  80249e:	0f 45 f7             	cmovne %edi,%esi
+  8024a1:	0f 45 fb             	cmovne %ebx,%edi
+  8024a4:	8b 1c 24             	mov    (%esp),%ebx
+  8024a7:	39 de                	cmp    %ebx,%esi
+  8024a9:	89 fb                	mov    %edi,%ebx
+  8024ab:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8024af:	8b 34 24             	mov    (%esp),%esi
+  8024b2:	19 fb                	sbb    %edi,%ebx
+  8024b4:	72 14                	jb     8024ca <__umoddi3+0x6a>
+  8024b6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8024b9:	31 db                	xor    %ebx,%ebx
+  8024bb:	d3 e6                	shl    %cl,%esi
+  8024bd:	f6 c1 20             	test   $0x20,%cl
+  8024c0:	0f 45 fe             	cmovne %esi,%edi
+  8024c3:	0f 45 f3             	cmovne %ebx,%esi
+  8024c6:	29 f0                	sub    %esi,%eax
+  8024c8:	19 fa                	sbb    %edi,%edx
+  8024ca:	83 e9 01             	sub    $0x1,%ecx
+  8024cd:	73 c1                	jae    802490 <__umoddi3+0x30>
+  8024cf:	83 c4 08             	add    $0x8,%esp
+  8024d2:	5b                   	pop    %ebx
+  8024d3:	5e                   	pop    %esi
+  8024d4:	5f                   	pop    %edi
+  8024d5:	c3                   	ret
+  8024d6:	83 c4 08             	add    $0x8,%esp
+  8024d9:	31 c0                	xor    %eax,%eax
+  8024db:	31 d2                	xor    %edx,%edx
+  8024dd:	5b                   	pop    %ebx
+  8024de:	5e                   	pop    %esi
+  8024df:	5f                   	pop    %edi
+  8024e0:	c3                   	ret
+  8024e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024ef:	90                   	nop
+
+008024f0 <__divdi3>:
+  8024f0:	55                   	push   %ebp
+  8024f1:	57                   	push   %edi
+  8024f2:	56                   	push   %esi
+  8024f3:	53                   	push   %ebx
+  8024f4:	83 ec 1c             	sub    $0x1c,%esp
+  8024f7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8024fb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8024ff:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802503:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802507:	85 ff                	test   %edi,%edi
+  802509:	0f 88 da 00 00 00    	js     8025e9 <__divdi3+0xf9>
+  80250f:	85 db                	test   %ebx,%ebx
+  802511:	78 16                	js     802529 <__divdi3+0x39>
+  802513:	89 dd                	mov    %ebx,%ebp
+  802515:	89 c8                	mov    %ecx,%eax
+  802517:	89 da                	mov    %ebx,%edx
+  802519:	09 cd                	or     %ecx,%ebp
+  80251b:	0f 85 fd 00 00 00    	jne    80261e <__divdi3+0x12e>
+  802521:	83 c4 1c             	add    $0x1c,%esp
+  802524:	5b                   	pop    %ebx
+  802525:	5e                   	pop    %esi
+  802526:	5f                   	pop    %edi
+  802527:	5d                   	pop    %ebp
+  802528:	c3                   	ret
+  802529:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80252e:	f7 d9                	neg    %ecx
+  802530:	89 f0                	mov    %esi,%eax
+  802532:	89 fa                	mov    %edi,%edx
+  802534:	83 d3 00             	adc    $0x0,%ebx
+  802537:	89 0c 24             	mov    %ecx,(%esp)
+  80253a:	f7 db                	neg    %ebx
+  80253c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802540:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802547:	00 
+  802548:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80254d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802554:	00 
+  802555:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802559:	89 cd                	mov    %ecx,%ebp
+  80255b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80255f:	90                   	nop
+  802560:	89 e9                	mov    %ebp,%ecx
+  802562:	89 c3                	mov    %eax,%ebx
+  802564:	89 d6                	mov    %edx,%esi
+  802566:	31 ff                	xor    %edi,%edi
+  802568:	d3 ee                	shr    %cl,%esi
+  80256a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80256d:	f6 c1 20             	test   $0x20,%cl
+  802570:	0f 45 de             	cmovne %esi,%ebx
+  802573:	0f 45 f7             	cmovne %edi,%esi
+  802576:	8b 3c 24             	mov    (%esp),%edi
+  802579:	39 fb                	cmp    %edi,%ebx
+  80257b:	89 f7                	mov    %esi,%edi
+  80257d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802581:	8b 1c 24             	mov    (%esp),%ebx
+  802584:	19 f7                	sbb    %esi,%edi
+  802586:	72 39                	jb     8025c1 <__divdi3+0xd1>
+  802588:	89 e9                	mov    %ebp,%ecx
+  80258a:	89 f7                	mov    %esi,%edi
+  80258c:	89 de                	mov    %ebx,%esi
+  80258e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802591:	d3 e6                	shl    %cl,%esi
+  802593:	31 db                	xor    %ebx,%ebx
+  802595:	f6 c1 20             	test   $0x20,%cl
+  802598:	0f 45 fe             	cmovne %esi,%edi
+  80259b:	0f 45 f3             	cmovne %ebx,%esi
+  80259e:	29 f0                	sub    %esi,%eax
+  8025a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8025a5:	19 fa                	sbb    %edi,%edx
+  8025a7:	31 ff                	xor    %edi,%edi
+  8025a9:	31 db                	xor    %ebx,%ebx
+  8025ab:	0f a5 f7             	shld   %cl,%esi,%edi
+  8025ae:	d3 e6                	shl    %cl,%esi
+  8025b0:	f6 c1 20             	test   $0x20,%cl
+  8025b3:	0f 45 fe             	cmovne %esi,%edi
+  8025b6:	0f 45 f3             	cmovne %ebx,%esi
+  8025b9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8025bd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8025c1:	83 ed 01             	sub    $0x1,%ebp
+  8025c4:	73 9a                	jae    802560 <__divdi3+0x70>
+  8025c6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8025ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025d2:	85 ed                	test   %ebp,%ebp
+  8025d4:	0f 84 47 ff ff ff    	je     802521 <__divdi3+0x31>
+  8025da:	f7 d8                	neg    %eax
+  8025dc:	83 d2 00             	adc    $0x0,%edx
+  8025df:	83 c4 1c             	add    $0x1c,%esp
+  8025e2:	5b                   	pop    %ebx
+  8025e3:	f7 da                	neg    %edx
+  8025e5:	5e                   	pop    %esi
+  8025e6:	5f                   	pop    %edi
+  8025e7:	5d                   	pop    %ebp
+  8025e8:	c3                   	ret
+  8025e9:	f7 de                	neg    %esi
+  8025eb:	83 d7 00             	adc    $0x0,%edi
+  8025ee:	f7 df                	neg    %edi
+  8025f0:	85 db                	test   %ebx,%ebx
+  8025f2:	78 23                	js     802617 <__divdi3+0x127>
+  8025f4:	89 dd                	mov    %ebx,%ebp
+  8025f6:	89 c8                	mov    %ecx,%eax
+  8025f8:	89 da                	mov    %ebx,%edx
+  8025fa:	09 cd                	or     %ecx,%ebp
+  8025fc:	0f 84 1f ff ff ff    	je     802521 <__divdi3+0x31>
+  802602:	89 0c 24             	mov    %ecx,(%esp)
+  802605:	89 f0                	mov    %esi,%eax
+  802607:	89 fa                	mov    %edi,%edx
+  802609:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80260e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802612:	e9 29 ff ff ff       	jmp    802540 <__divdi3+0x50>
+  802617:	31 ed                	xor    %ebp,%ebp
+  802619:	e9 10 ff ff ff       	jmp    80252e <__divdi3+0x3e>
+  80261e:	89 0c 24             	mov    %ecx,(%esp)
+  802621:	89 f0                	mov    %esi,%eax
+  802623:	89 fa                	mov    %edi,%edx
+  802625:	31 ed                	xor    %ebp,%ebp
+  802627:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80262b:	e9 10 ff ff ff       	jmp    802540 <__divdi3+0x50>
+
+00802630 <__moddi3>:
+  802630:	55                   	push   %ebp
+  802631:	57                   	push   %edi
+  802632:	56                   	push   %esi
+  802633:	53                   	push   %ebx
+  802634:	83 ec 14             	sub    $0x14,%esp
+  802637:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80263b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80263f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802643:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802647:	85 d2                	test   %edx,%edx
+  802649:	0f 88 9b 00 00 00    	js     8026ea <__moddi3+0xba>
+  80264f:	89 f7                	mov    %esi,%edi
+  802651:	31 ed                	xor    %ebp,%ebp
+  802653:	09 cf                	or     %ecx,%edi
+  802655:	0f 84 83 00 00 00    	je     8026de <__moddi3+0xae>
+  80265b:	89 cb                	mov    %ecx,%ebx
+  80265d:	89 f7                	mov    %esi,%edi
+  80265f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802663:	f7 db                	neg    %ebx
+  802665:	83 d7 00             	adc    $0x0,%edi
+  802668:	f7 df                	neg    %edi
+  80266a:	0f 49 f7             	cmovns %edi,%esi
+  80266d:	0f 49 cb             	cmovns %ebx,%ecx
+  802670:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802674:	89 0c 24             	mov    %ecx,(%esp)
+  802677:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80267c:	89 cd                	mov    %ecx,%ebp
+  80267e:	66 90                	xchg   %ax,%ax
+  802680:	89 e9                	mov    %ebp,%ecx
+  802682:	89 c3                	mov    %eax,%ebx
+  802684:	89 d6                	mov    %edx,%esi
+  802686:	31 ff                	xor    %edi,%edi
+  802688:	d3 ee                	shr    %cl,%esi
+  80268a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80268d:	f6 c1 20             	test   $0x20,%cl
+  802690:	0f 45 de             	cmovne %esi,%ebx
+  802693:	0f 45 f7             	cmovne %edi,%esi
+  802696:	8b 3c 24             	mov    (%esp),%edi
+  802699:	39 fb                	cmp    %edi,%ebx
+  80269b:	89 f7                	mov    %esi,%edi
+  80269d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8026a1:	8b 1c 24             	mov    (%esp),%ebx
+  8026a4:	19 f7                	sbb    %esi,%edi
+  8026a6:	72 1a                	jb     8026c2 <__moddi3+0x92>
+  8026a8:	89 e9                	mov    %ebp,%ecx
+  8026aa:	89 f7                	mov    %esi,%edi
+  8026ac:	89 de                	mov    %ebx,%esi
+  8026ae:	0f a5 df             	shld   %cl,%ebx,%edi
+  8026b1:	d3 e6                	shl    %cl,%esi
+  8026b3:	31 db                	xor    %ebx,%ebx
+  8026b5:	f6 c1 20             	test   $0x20,%cl
+  8026b8:	0f 45 fe             	cmovne %esi,%edi
+  8026bb:	0f 45 f3             	cmovne %ebx,%esi
+  8026be:	29 f0                	sub    %esi,%eax
+  8026c0:	19 fa                	sbb    %edi,%edx
+  8026c2:	83 ed 01             	sub    $0x1,%ebp
+  8026c5:	73 b9                	jae    802680 <__moddi3+0x50>
+  8026c7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  8026cb:	85 ed                	test   %ebp,%ebp
+  8026cd:	74 07                	je     8026d6 <__moddi3+0xa6>
+  8026cf:	f7 d8                	neg    %eax
+  8026d1:	83 d2 00             	adc    $0x0,%edx
+  8026d4:	f7 da                	neg    %edx
+  8026d6:	83 c4 14             	add    $0x14,%esp
+  8026d9:	5b                   	pop    %ebx
+  8026da:	5e                   	pop    %esi
+  8026db:	5f                   	pop    %edi
+  8026dc:	5d                   	pop    %ebp
+  8026dd:	c3                   	ret
+  8026de:	83 c4 14             	add    $0x14,%esp
+  8026e1:	31 c0                	xor    %eax,%eax
+  8026e3:	31 d2                	xor    %edx,%edx
+  8026e5:	5b                   	pop    %ebx
+  8026e6:	5e                   	pop    %esi
+  8026e7:	5f                   	pop    %edi
+  8026e8:	5d                   	pop    %ebp
+  8026e9:	c3                   	ret
+  8026ea:	89 f7                	mov    %esi,%edi
+  8026ec:	09 cf                	or     %ecx,%edi
+  8026ee:	74 11                	je     802701 <__moddi3+0xd1>
+  8026f0:	f7 d8                	neg    %eax
+  8026f2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8026f7:	83 d2 00             	adc    $0x0,%edx
+  8026fa:	f7 da                	neg    %edx
+  8026fc:	e9 5a ff ff ff       	jmp    80265b <__moddi3+0x2b>
+  802701:	31 c0                	xor    %eax,%eax
+  802703:	31 d2                	xor    %edx,%edx
+  802705:	eb c8                	jmp    8026cf <__moddi3+0x9f>
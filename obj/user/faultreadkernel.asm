@@ -0,0 +1,5562 @@
+
+obj/user/faultreadkernel.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("I read %08x from location 0xf0100000!\n", *(unsigned*)0xf0100000);
+  800039:	ff 35 00 00 10 f0    	push   0xf0100000
+  80003f:	68 80 26 80 00       	push   $0x802680
+  800044:	e8 fa 00 00 00       	call   800143 <cprintf>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800059:	e8 a1 0a 00 00       	call   800aff <sys_getenvid>
+  80005e:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800063:	c1 e0 09             	shl    $0x9,%eax
+  800066:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006b:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800070:	85 db                	test   %ebx,%ebx
+  800072:	7e 07                	jle    80007b <libmain+0x2d>
+		binaryname = argv[0];
+  800074:	8b 06                	mov    (%esi),%eax
+  800076:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80007b:	83 ec 08             	sub    $0x8,%esp
+  80007e:	56                   	push   %esi
+  80007f:	53                   	push   %ebx
+  800080:	e8 ae ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800085:	e8 0a 00 00 00       	call   800094 <exit>
+}
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800090:	5b                   	pop    %ebx
+  800091:	5e                   	pop    %esi
+  800092:	5d                   	pop    %ebp
+  800093:	c3                   	ret
+
+00800094 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800094:	55                   	push   %ebp
+  800095:	89 e5                	mov    %esp,%ebp
+  800097:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80009a:	e8 f8 10 00 00       	call   801197 <close_all>
+	sys_env_destroy(0);
+  80009f:	83 ec 0c             	sub    $0xc,%esp
+  8000a2:	6a 00                	push   $0x0
+  8000a4:	e8 15 0a 00 00       	call   800abe <sys_env_destroy>
+}
+  8000a9:	83 c4 10             	add    $0x10,%esp
+  8000ac:	c9                   	leave
+  8000ad:	c3                   	ret
+
+008000ae <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000ae:	55                   	push   %ebp
+  8000af:	89 e5                	mov    %esp,%ebp
+  8000b1:	53                   	push   %ebx
+  8000b2:	83 ec 04             	sub    $0x4,%esp
+  8000b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000b8:	8b 13                	mov    (%ebx),%edx
+  8000ba:	8d 42 01             	lea    0x1(%edx),%eax
+  8000bd:	89 03                	mov    %eax,(%ebx)
+  8000bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000c2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000c6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000cb:	74 09                	je     8000d6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000cd:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000d4:	c9                   	leave
+  8000d5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000d6:	83 ec 08             	sub    $0x8,%esp
+  8000d9:	68 ff 00 00 00       	push   $0xff
+  8000de:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000e1:	50                   	push   %eax
+  8000e2:	e8 7a 09 00 00       	call   800a61 <sys_cputs>
+		b->idx = 0;
+  8000e7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000ed:	83 c4 10             	add    $0x10,%esp
+  8000f0:	eb db                	jmp    8000cd <putch+0x1f>
+
+008000f2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000f2:	55                   	push   %ebp
+  8000f3:	89 e5                	mov    %esp,%ebp
+  8000f5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8000fb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800102:	00 00 00 
+	b.cnt = 0;
+  800105:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80010c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80010f:	ff 75 0c             	push   0xc(%ebp)
+  800112:	ff 75 08             	push   0x8(%ebp)
+  800115:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80011b:	50                   	push   %eax
+  80011c:	68 ae 00 80 00       	push   $0x8000ae
+  800121:	e8 14 01 00 00       	call   80023a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800126:	83 c4 08             	add    $0x8,%esp
+  800129:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80012f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800135:	50                   	push   %eax
+  800136:	e8 26 09 00 00       	call   800a61 <sys_cputs>
+
+	return b.cnt;
+}
+  80013b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800141:	c9                   	leave
+  800142:	c3                   	ret
+
+00800143 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800143:	55                   	push   %ebp
+  800144:	89 e5                	mov    %esp,%ebp
+  800146:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800149:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80014c:	50                   	push   %eax
+  80014d:	ff 75 08             	push   0x8(%ebp)
+  800150:	e8 9d ff ff ff       	call   8000f2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800155:	c9                   	leave
+  800156:	c3                   	ret
+
+00800157 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800157:	55                   	push   %ebp
+  800158:	89 e5                	mov    %esp,%ebp
+  80015a:	57                   	push   %edi
+  80015b:	56                   	push   %esi
+  80015c:	53                   	push   %ebx
+  80015d:	83 ec 1c             	sub    $0x1c,%esp
+  800160:	89 c7                	mov    %eax,%edi
+  800162:	89 d6                	mov    %edx,%esi
+  800164:	8b 45 08             	mov    0x8(%ebp),%eax
+  800167:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80016a:	89 d1                	mov    %edx,%ecx
+  80016c:	89 c2                	mov    %eax,%edx
+  80016e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800171:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800174:	8b 45 10             	mov    0x10(%ebp),%eax
+  800177:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80017a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80017d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800184:	39 c2                	cmp    %eax,%edx
+  800186:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800189:	72 3e                	jb     8001c9 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80018b:	83 ec 0c             	sub    $0xc,%esp
+  80018e:	ff 75 18             	push   0x18(%ebp)
+  800191:	83 eb 01             	sub    $0x1,%ebx
+  800194:	53                   	push   %ebx
+  800195:	50                   	push   %eax
+  800196:	83 ec 08             	sub    $0x8,%esp
+  800199:	ff 75 e4             	push   -0x1c(%ebp)
+  80019c:	ff 75 e0             	push   -0x20(%ebp)
+  80019f:	ff 75 dc             	push   -0x24(%ebp)
+  8001a2:	ff 75 d8             	push   -0x28(%ebp)
+  8001a5:	e8 66 21 00 00       	call   802310 <__udivdi3>
+  8001aa:	83 c4 18             	add    $0x18,%esp
+  8001ad:	52                   	push   %edx
+  8001ae:	50                   	push   %eax
+  8001af:	89 f2                	mov    %esi,%edx
+  8001b1:	89 f8                	mov    %edi,%eax
+  8001b3:	e8 9f ff ff ff       	call   800157 <printnum>
+  8001b8:	83 c4 20             	add    $0x20,%esp
+  8001bb:	eb 13                	jmp    8001d0 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001bd:	83 ec 08             	sub    $0x8,%esp
+  8001c0:	56                   	push   %esi
+  8001c1:	ff 75 18             	push   0x18(%ebp)
+  8001c4:	ff d7                	call   *%edi
+  8001c6:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001c9:	83 eb 01             	sub    $0x1,%ebx
+  8001cc:	85 db                	test   %ebx,%ebx
+  8001ce:	7f ed                	jg     8001bd <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001d0:	83 ec 08             	sub    $0x8,%esp
+  8001d3:	56                   	push   %esi
+  8001d4:	83 ec 04             	sub    $0x4,%esp
+  8001d7:	ff 75 e4             	push   -0x1c(%ebp)
+  8001da:	ff 75 e0             	push   -0x20(%ebp)
+  8001dd:	ff 75 dc             	push   -0x24(%ebp)
+  8001e0:	ff 75 d8             	push   -0x28(%ebp)
+  8001e3:	e8 e8 21 00 00       	call   8023d0 <__umoddi3>
+  8001e8:	83 c4 14             	add    $0x14,%esp
+  8001eb:	0f be 80 b1 26 80 00 	movsbl 0x8026b1(%eax),%eax
+  8001f2:	50                   	push   %eax
+  8001f3:	ff d7                	call   *%edi
+}
+  8001f5:	83 c4 10             	add    $0x10,%esp
+  8001f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fb:	5b                   	pop    %ebx
+  8001fc:	5e                   	pop    %esi
+  8001fd:	5f                   	pop    %edi
+  8001fe:	5d                   	pop    %ebp
+  8001ff:	c3                   	ret
+
+00800200 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800200:	55                   	push   %ebp
+  800201:	89 e5                	mov    %esp,%ebp
+  800203:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800206:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80020a:	8b 10                	mov    (%eax),%edx
+  80020c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80020f:	73 0a                	jae    80021b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800211:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800214:	89 08                	mov    %ecx,(%eax)
+  800216:	8b 45 08             	mov    0x8(%ebp),%eax
+  800219:	88 02                	mov    %al,(%edx)
+}
+  80021b:	5d                   	pop    %ebp
+  80021c:	c3                   	ret
+
+0080021d <printfmt>:
+{
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800223:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800226:	50                   	push   %eax
+  800227:	ff 75 10             	push   0x10(%ebp)
+  80022a:	ff 75 0c             	push   0xc(%ebp)
+  80022d:	ff 75 08             	push   0x8(%ebp)
+  800230:	e8 05 00 00 00       	call   80023a <vprintfmt>
+}
+  800235:	83 c4 10             	add    $0x10,%esp
+  800238:	c9                   	leave
+  800239:	c3                   	ret
+
+0080023a <vprintfmt>:
+{
+  80023a:	55                   	push   %ebp
+  80023b:	89 e5                	mov    %esp,%ebp
+  80023d:	57                   	push   %edi
+  80023e:	56                   	push   %esi
+  80023f:	53                   	push   %ebx
+  800240:	83 ec 2c             	sub    $0x2c,%esp
+  800243:	8b 75 08             	mov    0x8(%ebp),%esi
+  800246:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800249:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80024c:	eb 0a                	jmp    800258 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80024e:	83 ec 08             	sub    $0x8,%esp
+  800251:	53                   	push   %ebx
+  800252:	50                   	push   %eax
+  800253:	ff d6                	call   *%esi
+  800255:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800258:	83 c7 01             	add    $0x1,%edi
+  80025b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80025f:	83 f8 25             	cmp    $0x25,%eax
+  800262:	74 0c                	je     800270 <vprintfmt+0x36>
+			if (ch == '\0')
+  800264:	85 c0                	test   %eax,%eax
+  800266:	75 e6                	jne    80024e <vprintfmt+0x14>
+}
+  800268:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026b:	5b                   	pop    %ebx
+  80026c:	5e                   	pop    %esi
+  80026d:	5f                   	pop    %edi
+  80026e:	5d                   	pop    %ebp
+  80026f:	c3                   	ret
+		padc = ' ';
+  800270:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800274:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80027b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800282:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800289:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80028e:	8d 47 01             	lea    0x1(%edi),%eax
+  800291:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800294:	0f b6 17             	movzbl (%edi),%edx
+  800297:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80029a:	3c 55                	cmp    $0x55,%al
+  80029c:	0f 87 cf 03 00 00    	ja     800671 <vprintfmt+0x437>
+  8002a2:	0f b6 c0             	movzbl %al,%eax
+  8002a5:	ff 24 85 00 28 80 00 	jmp    *0x802800(,%eax,4)
+  8002ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002af:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002b3:	eb d9                	jmp    80028e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002b8:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002bc:	eb d0                	jmp    80028e <vprintfmt+0x54>
+  8002be:	0f b6 d2             	movzbl %dl,%edx
+  8002c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002cc:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002cf:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002d3:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002d6:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002d9:	83 f9 09             	cmp    $0x9,%ecx
+  8002dc:	77 55                	ja     800333 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002de:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002e1:	eb e9                	jmp    8002cc <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002e6:	8b 00                	mov    (%eax),%eax
+  8002e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8002f1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8002f7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8002fb:	79 91                	jns    80028e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8002fd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800300:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800303:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80030a:	eb 82                	jmp    80028e <vprintfmt+0x54>
+			if (width < 0)
+  80030c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80030f:	85 d2                	test   %edx,%edx
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	0f 49 c2             	cmovns %edx,%eax
+  800319:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80031c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80031f:	e9 6a ff ff ff       	jmp    80028e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800324:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800327:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80032e:	e9 5b ff ff ff       	jmp    80028e <vprintfmt+0x54>
+  800333:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800336:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800339:	eb bc                	jmp    8002f7 <vprintfmt+0xbd>
+			lflag++;
+  80033b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80033e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800341:	e9 48 ff ff ff       	jmp    80028e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800346:	8b 45 14             	mov    0x14(%ebp),%eax
+  800349:	8d 78 04             	lea    0x4(%eax),%edi
+  80034c:	83 ec 08             	sub    $0x8,%esp
+  80034f:	53                   	push   %ebx
+  800350:	ff 30                	push   (%eax)
+  800352:	ff d6                	call   *%esi
+			break;
+  800354:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800357:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80035a:	e9 b1 02 00 00       	jmp    800610 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80035f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800362:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800365:	8b 10                	mov    (%eax),%edx
+  800367:	89 d0                	mov    %edx,%eax
+  800369:	f7 d8                	neg    %eax
+  80036b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80036e:	83 f8 0f             	cmp    $0xf,%eax
+  800371:	7f 23                	jg     800396 <vprintfmt+0x15c>
+  800373:	8b 14 85 60 29 80 00 	mov    0x802960(,%eax,4),%edx
+  80037a:	85 d2                	test   %edx,%edx
+  80037c:	74 18                	je     800396 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80037e:	52                   	push   %edx
+  80037f:	68 95 2a 80 00       	push   $0x802a95
+  800384:	53                   	push   %ebx
+  800385:	56                   	push   %esi
+  800386:	e8 92 fe ff ff       	call   80021d <printfmt>
+  80038b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80038e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800391:	e9 7a 02 00 00       	jmp    800610 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800396:	50                   	push   %eax
+  800397:	68 c9 26 80 00       	push   $0x8026c9
+  80039c:	53                   	push   %ebx
+  80039d:	56                   	push   %esi
+  80039e:	e8 7a fe ff ff       	call   80021d <printfmt>
+  8003a3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003a6:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003a9:	e9 62 02 00 00       	jmp    800610 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b1:	83 c0 04             	add    $0x4,%eax
+  8003b4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ba:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003bc:	85 c9                	test   %ecx,%ecx
+  8003be:	b8 c2 26 80 00       	mov    $0x8026c2,%eax
+  8003c3:	0f 45 c1             	cmovne %ecx,%eax
+  8003c6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003c9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003cd:	7e 06                	jle    8003d5 <vprintfmt+0x19b>
+  8003cf:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003d3:	75 0b                	jne    8003e0 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003d5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003d8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003db:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003de:	eb 5c                	jmp    80043c <vprintfmt+0x202>
+  8003e0:	83 ec 08             	sub    $0x8,%esp
+  8003e3:	ff 75 d0             	push   -0x30(%ebp)
+  8003e6:	ff 75 cc             	push   -0x34(%ebp)
+  8003e9:	e8 20 03 00 00       	call   80070e <strnlen>
+  8003ee:	89 c2                	mov    %eax,%edx
+  8003f0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003f3:	29 d0                	sub    %edx,%eax
+  8003f5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8003f8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8003fc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ff:	89 75 08             	mov    %esi,0x8(%ebp)
+  800402:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800404:	eb 0e                	jmp    800414 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800406:	83 ec 08             	sub    $0x8,%esp
+  800409:	53                   	push   %ebx
+  80040a:	57                   	push   %edi
+  80040b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040e:	83 ee 01             	sub    $0x1,%esi
+  800411:	83 c4 10             	add    $0x10,%esp
+  800414:	85 f6                	test   %esi,%esi
+  800416:	7f ee                	jg     800406 <vprintfmt+0x1cc>
+  800418:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80041b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80041e:	85 c0                	test   %eax,%eax
+  800420:	ba 00 00 00 00       	mov    $0x0,%edx
+  800425:	0f 49 d0             	cmovns %eax,%edx
+  800428:	29 d0                	sub    %edx,%eax
+  80042a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042d:	eb a6                	jmp    8003d5 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80042f:	83 ec 08             	sub    $0x8,%esp
+  800432:	53                   	push   %ebx
+  800433:	52                   	push   %edx
+  800434:	ff 55 08             	call   *0x8(%ebp)
+  800437:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80043a:	89 f1                	mov    %esi,%ecx
+  80043c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80043f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800443:	0f be d0             	movsbl %al,%edx
+  800446:	85 d2                	test   %edx,%edx
+  800448:	74 28                	je     800472 <vprintfmt+0x238>
+  80044a:	85 ff                	test   %edi,%edi
+  80044c:	78 05                	js     800453 <vprintfmt+0x219>
+  80044e:	83 ef 01             	sub    $0x1,%edi
+  800451:	78 30                	js     800483 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800453:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800457:	74 d6                	je     80042f <vprintfmt+0x1f5>
+  800459:	0f be c0             	movsbl %al,%eax
+  80045c:	83 e8 20             	sub    $0x20,%eax
+  80045f:	83 f8 5e             	cmp    $0x5e,%eax
+  800462:	76 cb                	jbe    80042f <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800464:	83 ec 08             	sub    $0x8,%esp
+  800467:	53                   	push   %ebx
+  800468:	6a 3f                	push   $0x3f
+  80046a:	ff 55 08             	call   *0x8(%ebp)
+  80046d:	83 c4 10             	add    $0x10,%esp
+  800470:	eb c8                	jmp    80043a <vprintfmt+0x200>
+  800472:	8b 75 08             	mov    0x8(%ebp),%esi
+  800475:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800478:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80047b:	01 d0                	add    %edx,%eax
+  80047d:	29 c8                	sub    %ecx,%eax
+  80047f:	89 c7                	mov    %eax,%edi
+  800481:	eb 13                	jmp    800496 <vprintfmt+0x25c>
+  800483:	8b 75 08             	mov    0x8(%ebp),%esi
+  800486:	eb ed                	jmp    800475 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800488:	83 ec 08             	sub    $0x8,%esp
+  80048b:	53                   	push   %ebx
+  80048c:	6a 20                	push   $0x20
+  80048e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800490:	83 ef 01             	sub    $0x1,%edi
+  800493:	83 c4 10             	add    $0x10,%esp
+  800496:	85 ff                	test   %edi,%edi
+  800498:	7f ee                	jg     800488 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80049d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a0:	e9 6b 01 00 00       	jmp    800610 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004a5:	83 f9 01             	cmp    $0x1,%ecx
+  8004a8:	7f 1f                	jg     8004c9 <vprintfmt+0x28f>
+	else if (lflag)
+  8004aa:	85 c9                	test   %ecx,%ecx
+  8004ac:	74 67                	je     800515 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b1:	8b 00                	mov    (%eax),%eax
+  8004b3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004b6:	89 c1                	mov    %eax,%ecx
+  8004b8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004bb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8004c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004c7:	eb 17                	jmp    8004e0 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cc:	8b 50 04             	mov    0x4(%eax),%edx
+  8004cf:	8b 00                	mov    (%eax),%eax
+  8004d1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004d4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004da:	8d 40 08             	lea    0x8(%eax),%eax
+  8004dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004e0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004e3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004e6:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004eb:	85 c9                	test   %ecx,%ecx
+  8004ed:	0f 89 03 01 00 00    	jns    8005f6 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8004f3:	83 ec 08             	sub    $0x8,%esp
+  8004f6:	53                   	push   %ebx
+  8004f7:	6a 2d                	push   $0x2d
+  8004f9:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8004fb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004fe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800501:	f7 da                	neg    %edx
+  800503:	83 d1 00             	adc    $0x0,%ecx
+  800506:	f7 d9                	neg    %ecx
+  800508:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80050b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800510:	e9 e1 00 00 00       	jmp    8005f6 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800515:	8b 45 14             	mov    0x14(%ebp),%eax
+  800518:	8b 00                	mov    (%eax),%eax
+  80051a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80051d:	89 c1                	mov    %eax,%ecx
+  80051f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800522:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800525:	8b 45 14             	mov    0x14(%ebp),%eax
+  800528:	8d 40 04             	lea    0x4(%eax),%eax
+  80052b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80052e:	eb b0                	jmp    8004e0 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800530:	83 f9 01             	cmp    $0x1,%ecx
+  800533:	7f 1e                	jg     800553 <vprintfmt+0x319>
+	else if (lflag)
+  800535:	85 c9                	test   %ecx,%ecx
+  800537:	74 32                	je     80056b <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800539:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053c:	8b 10                	mov    (%eax),%edx
+  80053e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800543:	8d 40 04             	lea    0x4(%eax),%eax
+  800546:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800549:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80054e:	e9 a3 00 00 00       	jmp    8005f6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800553:	8b 45 14             	mov    0x14(%ebp),%eax
+  800556:	8b 10                	mov    (%eax),%edx
+  800558:	8b 48 04             	mov    0x4(%eax),%ecx
+  80055b:	8d 40 08             	lea    0x8(%eax),%eax
+  80055e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800561:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800566:	e9 8b 00 00 00       	jmp    8005f6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80056b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056e:	8b 10                	mov    (%eax),%edx
+  800570:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800575:	8d 40 04             	lea    0x4(%eax),%eax
+  800578:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80057b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800580:	eb 74                	jmp    8005f6 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800582:	83 f9 01             	cmp    $0x1,%ecx
+  800585:	7f 1b                	jg     8005a2 <vprintfmt+0x368>
+	else if (lflag)
+  800587:	85 c9                	test   %ecx,%ecx
+  800589:	74 2c                	je     8005b7 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	8b 10                	mov    (%eax),%edx
+  800590:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800595:	8d 40 04             	lea    0x4(%eax),%eax
+  800598:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80059b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005a0:	eb 54                	jmp    8005f6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a5:	8b 10                	mov    (%eax),%edx
+  8005a7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005aa:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005b0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005b5:	eb 3f                	jmp    8005f6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ba:	8b 10                	mov    (%eax),%edx
+  8005bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005c7:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005cc:	eb 28                	jmp    8005f6 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005ce:	83 ec 08             	sub    $0x8,%esp
+  8005d1:	53                   	push   %ebx
+  8005d2:	6a 30                	push   $0x30
+  8005d4:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005d6:	83 c4 08             	add    $0x8,%esp
+  8005d9:	53                   	push   %ebx
+  8005da:	6a 78                	push   $0x78
+  8005dc:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e1:	8b 10                	mov    (%eax),%edx
+  8005e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005e8:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005f1:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005f6:	83 ec 0c             	sub    $0xc,%esp
+  8005f9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005fd:	50                   	push   %eax
+  8005fe:	ff 75 e0             	push   -0x20(%ebp)
+  800601:	57                   	push   %edi
+  800602:	51                   	push   %ecx
+  800603:	52                   	push   %edx
+  800604:	89 da                	mov    %ebx,%edx
+  800606:	89 f0                	mov    %esi,%eax
+  800608:	e8 4a fb ff ff       	call   800157 <printnum>
+			break;
+  80060d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800610:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800613:	e9 40 fc ff ff       	jmp    800258 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800618:	83 f9 01             	cmp    $0x1,%ecx
+  80061b:	7f 1b                	jg     800638 <vprintfmt+0x3fe>
+	else if (lflag)
+  80061d:	85 c9                	test   %ecx,%ecx
+  80061f:	74 2c                	je     80064d <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8b 10                	mov    (%eax),%edx
+  800626:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062b:	8d 40 04             	lea    0x4(%eax),%eax
+  80062e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800631:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800636:	eb be                	jmp    8005f6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800638:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063b:	8b 10                	mov    (%eax),%edx
+  80063d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800640:	8d 40 08             	lea    0x8(%eax),%eax
+  800643:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800646:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80064b:	eb a9                	jmp    8005f6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8b 10                	mov    (%eax),%edx
+  800652:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800657:	8d 40 04             	lea    0x4(%eax),%eax
+  80065a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80065d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800662:	eb 92                	jmp    8005f6 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800664:	83 ec 08             	sub    $0x8,%esp
+  800667:	53                   	push   %ebx
+  800668:	6a 25                	push   $0x25
+  80066a:	ff d6                	call   *%esi
+			break;
+  80066c:	83 c4 10             	add    $0x10,%esp
+  80066f:	eb 9f                	jmp    800610 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800671:	83 ec 08             	sub    $0x8,%esp
+  800674:	53                   	push   %ebx
+  800675:	6a 25                	push   $0x25
+  800677:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800679:	83 c4 10             	add    $0x10,%esp
+  80067c:	89 f8                	mov    %edi,%eax
+  80067e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800682:	74 05                	je     800689 <vprintfmt+0x44f>
+  800684:	83 e8 01             	sub    $0x1,%eax
+  800687:	eb f5                	jmp    80067e <vprintfmt+0x444>
+  800689:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80068c:	eb 82                	jmp    800610 <vprintfmt+0x3d6>
+
+0080068e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80068e:	55                   	push   %ebp
+  80068f:	89 e5                	mov    %esp,%ebp
+  800691:	83 ec 18             	sub    $0x18,%esp
+  800694:	8b 45 08             	mov    0x8(%ebp),%eax
+  800697:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80069a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80069d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006a1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006a4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006ab:	85 c0                	test   %eax,%eax
+  8006ad:	74 26                	je     8006d5 <vsnprintf+0x47>
+  8006af:	85 d2                	test   %edx,%edx
+  8006b1:	7e 22                	jle    8006d5 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006b3:	ff 75 14             	push   0x14(%ebp)
+  8006b6:	ff 75 10             	push   0x10(%ebp)
+  8006b9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006bc:	50                   	push   %eax
+  8006bd:	68 00 02 80 00       	push   $0x800200
+  8006c2:	e8 73 fb ff ff       	call   80023a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006c7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006ca:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006d0:	83 c4 10             	add    $0x10,%esp
+}
+  8006d3:	c9                   	leave
+  8006d4:	c3                   	ret
+		return -E_INVAL;
+  8006d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006da:	eb f7                	jmp    8006d3 <vsnprintf+0x45>
+
+008006dc <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006dc:	55                   	push   %ebp
+  8006dd:	89 e5                	mov    %esp,%ebp
+  8006df:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006e2:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006e5:	50                   	push   %eax
+  8006e6:	ff 75 10             	push   0x10(%ebp)
+  8006e9:	ff 75 0c             	push   0xc(%ebp)
+  8006ec:	ff 75 08             	push   0x8(%ebp)
+  8006ef:	e8 9a ff ff ff       	call   80068e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006f4:	c9                   	leave
+  8006f5:	c3                   	ret
+
+008006f6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006f6:	55                   	push   %ebp
+  8006f7:	89 e5                	mov    %esp,%ebp
+  8006f9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8006fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800701:	eb 03                	jmp    800706 <strlen+0x10>
+		n++;
+  800703:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800706:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80070a:	75 f7                	jne    800703 <strlen+0xd>
+	return n;
+}
+  80070c:	5d                   	pop    %ebp
+  80070d:	c3                   	ret
+
+0080070e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80070e:	55                   	push   %ebp
+  80070f:	89 e5                	mov    %esp,%ebp
+  800711:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800714:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800717:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071c:	eb 03                	jmp    800721 <strnlen+0x13>
+		n++;
+  80071e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800721:	39 d0                	cmp    %edx,%eax
+  800723:	74 08                	je     80072d <strnlen+0x1f>
+  800725:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800729:	75 f3                	jne    80071e <strnlen+0x10>
+  80072b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80072d:	89 d0                	mov    %edx,%eax
+  80072f:	5d                   	pop    %ebp
+  800730:	c3                   	ret
+
+00800731 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800731:	55                   	push   %ebp
+  800732:	89 e5                	mov    %esp,%ebp
+  800734:	53                   	push   %ebx
+  800735:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800738:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80073b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800740:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800744:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800747:	83 c0 01             	add    $0x1,%eax
+  80074a:	84 d2                	test   %dl,%dl
+  80074c:	75 f2                	jne    800740 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80074e:	89 c8                	mov    %ecx,%eax
+  800750:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800753:	c9                   	leave
+  800754:	c3                   	ret
+
+00800755 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800755:	55                   	push   %ebp
+  800756:	89 e5                	mov    %esp,%ebp
+  800758:	53                   	push   %ebx
+  800759:	83 ec 10             	sub    $0x10,%esp
+  80075c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80075f:	53                   	push   %ebx
+  800760:	e8 91 ff ff ff       	call   8006f6 <strlen>
+  800765:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800768:	ff 75 0c             	push   0xc(%ebp)
+  80076b:	01 d8                	add    %ebx,%eax
+  80076d:	50                   	push   %eax
+  80076e:	e8 be ff ff ff       	call   800731 <strcpy>
+	return dst;
+}
+  800773:	89 d8                	mov    %ebx,%eax
+  800775:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800778:	c9                   	leave
+  800779:	c3                   	ret
+
+0080077a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80077a:	55                   	push   %ebp
+  80077b:	89 e5                	mov    %esp,%ebp
+  80077d:	56                   	push   %esi
+  80077e:	53                   	push   %ebx
+  80077f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800782:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800785:	89 f3                	mov    %esi,%ebx
+  800787:	03 5d 10             	add    0x10(%ebp),%ebx
+  80078a:	89 f0                	mov    %esi,%eax
+  80078c:	eb 0f                	jmp    80079d <strncpy+0x23>
+		*dst++ = *src;
+  80078e:	83 c0 01             	add    $0x1,%eax
+  800791:	0f b6 0a             	movzbl (%edx),%ecx
+  800794:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800797:	80 f9 01             	cmp    $0x1,%cl
+  80079a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80079d:	39 d8                	cmp    %ebx,%eax
+  80079f:	75 ed                	jne    80078e <strncpy+0x14>
+	}
+	return ret;
+}
+  8007a1:	89 f0                	mov    %esi,%eax
+  8007a3:	5b                   	pop    %ebx
+  8007a4:	5e                   	pop    %esi
+  8007a5:	5d                   	pop    %ebp
+  8007a6:	c3                   	ret
+
+008007a7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007a7:	55                   	push   %ebp
+  8007a8:	89 e5                	mov    %esp,%ebp
+  8007aa:	56                   	push   %esi
+  8007ab:	53                   	push   %ebx
+  8007ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b2:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007b5:	89 f0                	mov    %esi,%eax
+  8007b7:	85 d2                	test   %edx,%edx
+  8007b9:	74 21                	je     8007dc <strlcpy+0x35>
+  8007bb:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007bf:	89 f2                	mov    %esi,%edx
+  8007c1:	eb 09                	jmp    8007cc <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007c3:	83 c1 01             	add    $0x1,%ecx
+  8007c6:	83 c2 01             	add    $0x1,%edx
+  8007c9:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007cc:	39 c2                	cmp    %eax,%edx
+  8007ce:	74 09                	je     8007d9 <strlcpy+0x32>
+  8007d0:	0f b6 19             	movzbl (%ecx),%ebx
+  8007d3:	84 db                	test   %bl,%bl
+  8007d5:	75 ec                	jne    8007c3 <strlcpy+0x1c>
+  8007d7:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007d9:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007dc:	29 f0                	sub    %esi,%eax
+}
+  8007de:	5b                   	pop    %ebx
+  8007df:	5e                   	pop    %esi
+  8007e0:	5d                   	pop    %ebp
+  8007e1:	c3                   	ret
+
+008007e2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007e2:	55                   	push   %ebp
+  8007e3:	89 e5                	mov    %esp,%ebp
+  8007e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007eb:	eb 06                	jmp    8007f3 <strcmp+0x11>
+		p++, q++;
+  8007ed:	83 c1 01             	add    $0x1,%ecx
+  8007f0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007f3:	0f b6 01             	movzbl (%ecx),%eax
+  8007f6:	84 c0                	test   %al,%al
+  8007f8:	74 04                	je     8007fe <strcmp+0x1c>
+  8007fa:	3a 02                	cmp    (%edx),%al
+  8007fc:	74 ef                	je     8007ed <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8007fe:	0f b6 c0             	movzbl %al,%eax
+  800801:	0f b6 12             	movzbl (%edx),%edx
+  800804:	29 d0                	sub    %edx,%eax
+}
+  800806:	5d                   	pop    %ebp
+  800807:	c3                   	ret
+
+00800808 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800808:	55                   	push   %ebp
+  800809:	89 e5                	mov    %esp,%ebp
+  80080b:	53                   	push   %ebx
+  80080c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800812:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800815:	eb 09                	jmp    800820 <strncmp+0x18>
+		n--, p++, q++;
+  800817:	83 ea 01             	sub    $0x1,%edx
+  80081a:	83 c0 01             	add    $0x1,%eax
+  80081d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800820:	85 d2                	test   %edx,%edx
+  800822:	74 18                	je     80083c <strncmp+0x34>
+  800824:	0f b6 18             	movzbl (%eax),%ebx
+  800827:	84 db                	test   %bl,%bl
+  800829:	74 04                	je     80082f <strncmp+0x27>
+  80082b:	3a 19                	cmp    (%ecx),%bl
+  80082d:	74 e8                	je     800817 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80082f:	0f b6 00             	movzbl (%eax),%eax
+  800832:	0f b6 11             	movzbl (%ecx),%edx
+  800835:	29 d0                	sub    %edx,%eax
+}
+  800837:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083a:	c9                   	leave
+  80083b:	c3                   	ret
+		return 0;
+  80083c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800841:	eb f4                	jmp    800837 <strncmp+0x2f>
+
+00800843 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800843:	55                   	push   %ebp
+  800844:	89 e5                	mov    %esp,%ebp
+  800846:	8b 45 08             	mov    0x8(%ebp),%eax
+  800849:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80084d:	eb 03                	jmp    800852 <strchr+0xf>
+  80084f:	83 c0 01             	add    $0x1,%eax
+  800852:	0f b6 10             	movzbl (%eax),%edx
+  800855:	84 d2                	test   %dl,%dl
+  800857:	74 06                	je     80085f <strchr+0x1c>
+		if (*s == c)
+  800859:	38 ca                	cmp    %cl,%dl
+  80085b:	75 f2                	jne    80084f <strchr+0xc>
+  80085d:	eb 05                	jmp    800864 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80085f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800864:	5d                   	pop    %ebp
+  800865:	c3                   	ret
+
+00800866 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800866:	55                   	push   %ebp
+  800867:	89 e5                	mov    %esp,%ebp
+  800869:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800870:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800873:	38 ca                	cmp    %cl,%dl
+  800875:	74 09                	je     800880 <strfind+0x1a>
+  800877:	84 d2                	test   %dl,%dl
+  800879:	74 05                	je     800880 <strfind+0x1a>
+	for (; *s; s++)
+  80087b:	83 c0 01             	add    $0x1,%eax
+  80087e:	eb f0                	jmp    800870 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800880:	5d                   	pop    %ebp
+  800881:	c3                   	ret
+
+00800882 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	57                   	push   %edi
+  800886:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800889:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80088c:	85 c9                	test   %ecx,%ecx
+  80088e:	74 20                	je     8008b0 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800890:	89 f8                	mov    %edi,%eax
+  800892:	09 c8                	or     %ecx,%eax
+  800894:	a8 03                	test   $0x3,%al
+  800896:	75 12                	jne    8008aa <memset+0x28>
+		c &= 0xFF;
+  800898:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80089c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008a2:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008a5:	fc                   	cld
+  8008a6:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008a8:	eb 06                	jmp    8008b0 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008ad:	fc                   	cld
+  8008ae:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008b0:	89 f8                	mov    %edi,%eax
+  8008b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008b5:	c9                   	leave
+  8008b6:	c3                   	ret
+
+008008b7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008b7:	55                   	push   %ebp
+  8008b8:	89 e5                	mov    %esp,%ebp
+  8008ba:	57                   	push   %edi
+  8008bb:	56                   	push   %esi
+  8008bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008c2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008c5:	39 c6                	cmp    %eax,%esi
+  8008c7:	73 32                	jae    8008fb <memmove+0x44>
+  8008c9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008cc:	39 d0                	cmp    %edx,%eax
+  8008ce:	73 2b                	jae    8008fb <memmove+0x44>
+		s += n;
+		d += n;
+  8008d0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008d3:	89 d6                	mov    %edx,%esi
+  8008d5:	09 fe                	or     %edi,%esi
+  8008d7:	09 ce                	or     %ecx,%esi
+  8008d9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008df:	75 0e                	jne    8008ef <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008e1:	83 ef 04             	sub    $0x4,%edi
+  8008e4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008e7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008ea:	fd                   	std
+  8008eb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008ed:	eb 09                	jmp    8008f8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008ef:	83 ef 01             	sub    $0x1,%edi
+  8008f2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008f5:	fd                   	std
+  8008f6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008f8:	fc                   	cld
+  8008f9:	eb 1a                	jmp    800915 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008fb:	89 f2                	mov    %esi,%edx
+  8008fd:	09 c2                	or     %eax,%edx
+  8008ff:	09 ca                	or     %ecx,%edx
+  800901:	f6 c2 03             	test   $0x3,%dl
+  800904:	75 0a                	jne    800910 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800906:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800909:	89 c7                	mov    %eax,%edi
+  80090b:	fc                   	cld
+  80090c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80090e:	eb 05                	jmp    800915 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800910:	89 c7                	mov    %eax,%edi
+  800912:	fc                   	cld
+  800913:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800915:	5e                   	pop    %esi
+  800916:	5f                   	pop    %edi
+  800917:	5d                   	pop    %ebp
+  800918:	c3                   	ret
+
+00800919 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800919:	55                   	push   %ebp
+  80091a:	89 e5                	mov    %esp,%ebp
+  80091c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80091f:	ff 75 10             	push   0x10(%ebp)
+  800922:	ff 75 0c             	push   0xc(%ebp)
+  800925:	ff 75 08             	push   0x8(%ebp)
+  800928:	e8 8a ff ff ff       	call   8008b7 <memmove>
+}
+  80092d:	c9                   	leave
+  80092e:	c3                   	ret
+
+0080092f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	56                   	push   %esi
+  800933:	53                   	push   %ebx
+  800934:	8b 45 08             	mov    0x8(%ebp),%eax
+  800937:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80093a:	89 c6                	mov    %eax,%esi
+  80093c:	03 75 10             	add    0x10(%ebp),%esi
+  80093f:	eb 06                	jmp    800947 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800941:	83 c0 01             	add    $0x1,%eax
+  800944:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800947:	39 f0                	cmp    %esi,%eax
+  800949:	74 14                	je     80095f <memcmp+0x30>
+		if (*s1 != *s2)
+  80094b:	0f b6 08             	movzbl (%eax),%ecx
+  80094e:	0f b6 1a             	movzbl (%edx),%ebx
+  800951:	38 d9                	cmp    %bl,%cl
+  800953:	74 ec                	je     800941 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800955:	0f b6 c1             	movzbl %cl,%eax
+  800958:	0f b6 db             	movzbl %bl,%ebx
+  80095b:	29 d8                	sub    %ebx,%eax
+  80095d:	eb 05                	jmp    800964 <memcmp+0x35>
+	}
+
+	return 0;
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800964:	5b                   	pop    %ebx
+  800965:	5e                   	pop    %esi
+  800966:	5d                   	pop    %ebp
+  800967:	c3                   	ret
+
+00800968 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800971:	89 c2                	mov    %eax,%edx
+  800973:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800976:	eb 03                	jmp    80097b <memfind+0x13>
+  800978:	83 c0 01             	add    $0x1,%eax
+  80097b:	39 d0                	cmp    %edx,%eax
+  80097d:	73 04                	jae    800983 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80097f:	38 08                	cmp    %cl,(%eax)
+  800981:	75 f5                	jne    800978 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800983:	5d                   	pop    %ebp
+  800984:	c3                   	ret
+
+00800985 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800985:	55                   	push   %ebp
+  800986:	89 e5                	mov    %esp,%ebp
+  800988:	57                   	push   %edi
+  800989:	56                   	push   %esi
+  80098a:	53                   	push   %ebx
+  80098b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80098e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800991:	eb 03                	jmp    800996 <strtol+0x11>
+		s++;
+  800993:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800996:	0f b6 02             	movzbl (%edx),%eax
+  800999:	3c 20                	cmp    $0x20,%al
+  80099b:	74 f6                	je     800993 <strtol+0xe>
+  80099d:	3c 09                	cmp    $0x9,%al
+  80099f:	74 f2                	je     800993 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009a1:	3c 2b                	cmp    $0x2b,%al
+  8009a3:	74 2a                	je     8009cf <strtol+0x4a>
+	int neg = 0;
+  8009a5:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009aa:	3c 2d                	cmp    $0x2d,%al
+  8009ac:	74 2b                	je     8009d9 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009ae:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009b4:	75 0f                	jne    8009c5 <strtol+0x40>
+  8009b6:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009b9:	74 28                	je     8009e3 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009bb:	85 db                	test   %ebx,%ebx
+  8009bd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009c2:	0f 44 d8             	cmove  %eax,%ebx
+  8009c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ca:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009cd:	eb 46                	jmp    800a15 <strtol+0x90>
+		s++;
+  8009cf:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d7:	eb d5                	jmp    8009ae <strtol+0x29>
+		s++, neg = 1;
+  8009d9:	83 c2 01             	add    $0x1,%edx
+  8009dc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009e1:	eb cb                	jmp    8009ae <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009e3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009e7:	74 0e                	je     8009f7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009e9:	85 db                	test   %ebx,%ebx
+  8009eb:	75 d8                	jne    8009c5 <strtol+0x40>
+		s++, base = 8;
+  8009ed:	83 c2 01             	add    $0x1,%edx
+  8009f0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009f5:	eb ce                	jmp    8009c5 <strtol+0x40>
+		s += 2, base = 16;
+  8009f7:	83 c2 02             	add    $0x2,%edx
+  8009fa:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8009ff:	eb c4                	jmp    8009c5 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a01:	0f be c0             	movsbl %al,%eax
+  800a04:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a07:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a0a:	7d 3a                	jge    800a46 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a0c:	83 c2 01             	add    $0x1,%edx
+  800a0f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a13:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a15:	0f b6 02             	movzbl (%edx),%eax
+  800a18:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a1b:	89 f3                	mov    %esi,%ebx
+  800a1d:	80 fb 09             	cmp    $0x9,%bl
+  800a20:	76 df                	jbe    800a01 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a22:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a25:	89 f3                	mov    %esi,%ebx
+  800a27:	80 fb 19             	cmp    $0x19,%bl
+  800a2a:	77 08                	ja     800a34 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a2c:	0f be c0             	movsbl %al,%eax
+  800a2f:	83 e8 57             	sub    $0x57,%eax
+  800a32:	eb d3                	jmp    800a07 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a34:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a37:	89 f3                	mov    %esi,%ebx
+  800a39:	80 fb 19             	cmp    $0x19,%bl
+  800a3c:	77 08                	ja     800a46 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a3e:	0f be c0             	movsbl %al,%eax
+  800a41:	83 e8 37             	sub    $0x37,%eax
+  800a44:	eb c1                	jmp    800a07 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a46:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a4a:	74 05                	je     800a51 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a4f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a51:	89 c8                	mov    %ecx,%eax
+  800a53:	f7 d8                	neg    %eax
+  800a55:	85 ff                	test   %edi,%edi
+  800a57:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a5a:	89 c8                	mov    %ecx,%eax
+  800a5c:	5b                   	pop    %ebx
+  800a5d:	5e                   	pop    %esi
+  800a5e:	5f                   	pop    %edi
+  800a5f:	5d                   	pop    %ebp
+  800a60:	c3                   	ret
+
+00800a61 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a61:	55                   	push   %ebp
+  800a62:	89 e5                	mov    %esp,%ebp
+  800a64:	57                   	push   %edi
+  800a65:	56                   	push   %esi
+  800a66:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a72:	89 c3                	mov    %eax,%ebx
+  800a74:	89 c7                	mov    %eax,%edi
+  800a76:	89 c6                	mov    %eax,%esi
+  800a78:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800a7a:	5b                   	pop    %ebx
+  800a7b:	5e                   	pop    %esi
+  800a7c:	5f                   	pop    %edi
+  800a7d:	5d                   	pop    %ebp
+  800a7e:	c3                   	ret
+
+00800a7f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	57                   	push   %edi
+  800a83:	56                   	push   %esi
+  800a84:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a85:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a8a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a8f:	89 d1                	mov    %edx,%ecx
+  800a91:	89 d3                	mov    %edx,%ebx
+  800a93:	89 d7                	mov    %edx,%edi
+  800a95:	89 d6                	mov    %edx,%esi
+  800a97:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800a99:	5b                   	pop    %ebx
+  800a9a:	5e                   	pop    %esi
+  800a9b:	5f                   	pop    %edi
+  800a9c:	5d                   	pop    %ebp
+  800a9d:	c3                   	ret
+
+00800a9e <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800a9e:	55                   	push   %ebp
+  800a9f:	89 e5                	mov    %esp,%ebp
+  800aa1:	57                   	push   %edi
+  800aa2:	56                   	push   %esi
+  800aa3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800aa4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aac:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ab1:	89 cb                	mov    %ecx,%ebx
+  800ab3:	89 cf                	mov    %ecx,%edi
+  800ab5:	89 ce                	mov    %ecx,%esi
+  800ab7:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800ab9:	5b                   	pop    %ebx
+  800aba:	5e                   	pop    %esi
+  800abb:	5f                   	pop    %edi
+  800abc:	5d                   	pop    %ebp
+  800abd:	c3                   	ret
+
+00800abe <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800abe:	55                   	push   %ebp
+  800abf:	89 e5                	mov    %esp,%ebp
+  800ac1:	57                   	push   %edi
+  800ac2:	56                   	push   %esi
+  800ac3:	53                   	push   %ebx
+  800ac4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ac7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800acc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800acf:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ad4:	89 cb                	mov    %ecx,%ebx
+  800ad6:	89 cf                	mov    %ecx,%edi
+  800ad8:	89 ce                	mov    %ecx,%esi
+  800ada:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800adc:	85 c0                	test   %eax,%eax
+  800ade:	7f 08                	jg     800ae8 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ae0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ae3:	5b                   	pop    %ebx
+  800ae4:	5e                   	pop    %esi
+  800ae5:	5f                   	pop    %edi
+  800ae6:	5d                   	pop    %ebp
+  800ae7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ae8:	83 ec 0c             	sub    $0xc,%esp
+  800aeb:	50                   	push   %eax
+  800aec:	6a 03                	push   $0x3
+  800aee:	68 bf 29 80 00       	push   $0x8029bf
+  800af3:	6a 23                	push   $0x23
+  800af5:	68 dc 29 80 00       	push   $0x8029dc
+  800afa:	e8 d5 15 00 00       	call   8020d4 <_panic>
+
+00800aff <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800aff:	55                   	push   %ebp
+  800b00:	89 e5                	mov    %esp,%ebp
+  800b02:	57                   	push   %edi
+  800b03:	56                   	push   %esi
+  800b04:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b05:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b0a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b0f:	89 d1                	mov    %edx,%ecx
+  800b11:	89 d3                	mov    %edx,%ebx
+  800b13:	89 d7                	mov    %edx,%edi
+  800b15:	89 d6                	mov    %edx,%esi
+  800b17:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b19:	5b                   	pop    %ebx
+  800b1a:	5e                   	pop    %esi
+  800b1b:	5f                   	pop    %edi
+  800b1c:	5d                   	pop    %ebp
+  800b1d:	c3                   	ret
+
+00800b1e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	57                   	push   %edi
+  800b22:	56                   	push   %esi
+  800b23:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b24:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b29:	b8 16 00 00 00       	mov    $0x16,%eax
+  800b2e:	89 d1                	mov    %edx,%ecx
+  800b30:	89 d3                	mov    %edx,%ebx
+  800b32:	89 d7                	mov    %edx,%edi
+  800b34:	89 d6                	mov    %edx,%esi
+  800b36:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b38:	5b                   	pop    %ebx
+  800b39:	5e                   	pop    %esi
+  800b3a:	5f                   	pop    %edi
+  800b3b:	5d                   	pop    %ebp
+  800b3c:	c3                   	ret
+
+00800b3d <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800b3d:	55                   	push   %ebp
+  800b3e:	89 e5                	mov    %esp,%ebp
+  800b40:	57                   	push   %edi
+  800b41:	56                   	push   %esi
+  800b42:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b43:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b48:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800b4d:	89 d1                	mov    %edx,%ecx
+  800b4f:	89 d3                	mov    %edx,%ebx
+  800b51:	89 d7                	mov    %edx,%edi
+  800b53:	89 d6                	mov    %edx,%esi
+  800b55:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800b57:	5b                   	pop    %ebx
+  800b58:	5e                   	pop    %esi
+  800b59:	5f                   	pop    %edi
+  800b5a:	5d                   	pop    %ebp
+  800b5b:	c3                   	ret
+
+00800b5c <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	57                   	push   %edi
+  800b60:	56                   	push   %esi
+  800b61:	53                   	push   %ebx
+  800b62:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b70:	b8 15 00 00 00       	mov    $0x15,%eax
+  800b75:	89 df                	mov    %ebx,%edi
+  800b77:	89 de                	mov    %ebx,%esi
+  800b79:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b7b:	85 c0                	test   %eax,%eax
+  800b7d:	7f 08                	jg     800b87 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800b7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b82:	5b                   	pop    %ebx
+  800b83:	5e                   	pop    %esi
+  800b84:	5f                   	pop    %edi
+  800b85:	5d                   	pop    %ebp
+  800b86:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b87:	83 ec 0c             	sub    $0xc,%esp
+  800b8a:	50                   	push   %eax
+  800b8b:	6a 15                	push   $0x15
+  800b8d:	68 bf 29 80 00       	push   $0x8029bf
+  800b92:	6a 23                	push   $0x23
+  800b94:	68 dc 29 80 00       	push   $0x8029dc
+  800b99:	e8 36 15 00 00       	call   8020d4 <_panic>
+
+00800b9e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b9e:	55                   	push   %ebp
+  800b9f:	89 e5                	mov    %esp,%ebp
+  800ba1:	57                   	push   %edi
+  800ba2:	56                   	push   %esi
+  800ba3:	53                   	push   %ebx
+  800ba4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ba7:	be 00 00 00 00       	mov    $0x0,%esi
+  800bac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800baf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bb7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bba:	89 f7                	mov    %esi,%edi
+  800bbc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bbe:	85 c0                	test   %eax,%eax
+  800bc0:	7f 08                	jg     800bca <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc5:	5b                   	pop    %ebx
+  800bc6:	5e                   	pop    %esi
+  800bc7:	5f                   	pop    %edi
+  800bc8:	5d                   	pop    %ebp
+  800bc9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bca:	83 ec 0c             	sub    $0xc,%esp
+  800bcd:	50                   	push   %eax
+  800bce:	6a 05                	push   $0x5
+  800bd0:	68 bf 29 80 00       	push   $0x8029bf
+  800bd5:	6a 23                	push   $0x23
+  800bd7:	68 dc 29 80 00       	push   $0x8029dc
+  800bdc:	e8 f3 14 00 00       	call   8020d4 <_panic>
+
+00800be1 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800be1:	55                   	push   %ebp
+  800be2:	89 e5                	mov    %esp,%ebp
+  800be4:	57                   	push   %edi
+  800be5:	56                   	push   %esi
+  800be6:	53                   	push   %ebx
+  800be7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bea:	be 00 00 00 00       	mov    $0x0,%esi
+  800bef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800bfa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bfd:	89 f7                	mov    %esi,%edi
+  800bff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c01:	85 c0                	test   %eax,%eax
+  800c03:	7f 08                	jg     800c0d <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c08:	5b                   	pop    %ebx
+  800c09:	5e                   	pop    %esi
+  800c0a:	5f                   	pop    %edi
+  800c0b:	5d                   	pop    %ebp
+  800c0c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c0d:	83 ec 0c             	sub    $0xc,%esp
+  800c10:	50                   	push   %eax
+  800c11:	6a 06                	push   $0x6
+  800c13:	68 bf 29 80 00       	push   $0x8029bf
+  800c18:	6a 23                	push   $0x23
+  800c1a:	68 dc 29 80 00       	push   $0x8029dc
+  800c1f:	e8 b0 14 00 00       	call   8020d4 <_panic>
+
+00800c24 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	56                   	push   %esi
+  800c29:	53                   	push   %ebx
+  800c2a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c33:	b8 07 00 00 00       	mov    $0x7,%eax
+  800c38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c3b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c3e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c41:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c43:	85 c0                	test   %eax,%eax
+  800c45:	7f 08                	jg     800c4f <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4a:	5b                   	pop    %ebx
+  800c4b:	5e                   	pop    %esi
+  800c4c:	5f                   	pop    %edi
+  800c4d:	5d                   	pop    %ebp
+  800c4e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c4f:	83 ec 0c             	sub    $0xc,%esp
+  800c52:	50                   	push   %eax
+  800c53:	6a 07                	push   $0x7
+  800c55:	68 bf 29 80 00       	push   $0x8029bf
+  800c5a:	6a 23                	push   $0x23
+  800c5c:	68 dc 29 80 00       	push   $0x8029dc
+  800c61:	e8 6e 14 00 00       	call   8020d4 <_panic>
+
+00800c66 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	57                   	push   %edi
+  800c6a:	56                   	push   %esi
+  800c6b:	53                   	push   %ebx
+  800c6c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c7f:	89 df                	mov    %ebx,%edi
+  800c81:	89 de                	mov    %ebx,%esi
+  800c83:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c85:	85 c0                	test   %eax,%eax
+  800c87:	7f 08                	jg     800c91 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8c:	5b                   	pop    %ebx
+  800c8d:	5e                   	pop    %esi
+  800c8e:	5f                   	pop    %edi
+  800c8f:	5d                   	pop    %ebp
+  800c90:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c91:	83 ec 0c             	sub    $0xc,%esp
+  800c94:	50                   	push   %eax
+  800c95:	6a 08                	push   $0x8
+  800c97:	68 bf 29 80 00       	push   $0x8029bf
+  800c9c:	6a 23                	push   $0x23
+  800c9e:	68 dc 29 80 00       	push   $0x8029dc
+  800ca3:	e8 2c 14 00 00       	call   8020d4 <_panic>
+
+00800ca8 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800ca8:	55                   	push   %ebp
+  800ca9:	89 e5                	mov    %esp,%ebp
+  800cab:	57                   	push   %edi
+  800cac:	56                   	push   %esi
+  800cad:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb4:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cb9:	be 00 00 00 00       	mov    $0x0,%esi
+  800cbe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cc1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cc4:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800cc6:	5b                   	pop    %ebx
+  800cc7:	5e                   	pop    %esi
+  800cc8:	5f                   	pop    %edi
+  800cc9:	5d                   	pop    %ebp
+  800cca:	c3                   	ret
+
+00800ccb <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	57                   	push   %edi
+  800ccf:	56                   	push   %esi
+  800cd0:	53                   	push   %ebx
+  800cd1:	8b 45 18             	mov    0x18(%ebp),%eax
+  800cd4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800cd7:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800cdc:	77 27                	ja     800d05 <sys_page_map_range+0x3a>
+  800cde:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800ce4:	77 1f                	ja     800d05 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800ce6:	c1 e0 0c             	shl    $0xc,%eax
+  800ce9:	89 c6                	mov    %eax,%esi
+  800ceb:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800ced:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cf8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cfb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cfe:	cd 30                	int    $0x30
+}
+  800d00:	5b                   	pop    %ebx
+  800d01:	5e                   	pop    %esi
+  800d02:	5f                   	pop    %edi
+  800d03:	5d                   	pop    %ebp
+  800d04:	c3                   	ret
+		return -E_INVAL;
+  800d05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d0a:	eb f4                	jmp    800d00 <sys_page_map_range+0x35>
+
+00800d0c <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800d0c:	55                   	push   %ebp
+  800d0d:	89 e5                	mov    %esp,%ebp
+  800d0f:	57                   	push   %edi
+  800d10:	56                   	push   %esi
+  800d11:	53                   	push   %ebx
+  800d12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d20:	be 00 00 00 00       	mov    $0x0,%esi
+  800d25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d28:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d2b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d2d:	85 c0                	test   %eax,%eax
+  800d2f:	7f 08                	jg     800d39 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800d31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d34:	5b                   	pop    %ebx
+  800d35:	5e                   	pop    %esi
+  800d36:	5f                   	pop    %edi
+  800d37:	5d                   	pop    %ebp
+  800d38:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d39:	83 ec 0c             	sub    $0xc,%esp
+  800d3c:	50                   	push   %eax
+  800d3d:	6a 0c                	push   $0xc
+  800d3f:	68 bf 29 80 00       	push   $0x8029bf
+  800d44:	6a 23                	push   $0x23
+  800d46:	68 dc 29 80 00       	push   $0x8029dc
+  800d4b:	e8 84 13 00 00       	call   8020d4 <_panic>
+
+00800d50 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800d50:	55                   	push   %ebp
+  800d51:	89 e5                	mov    %esp,%ebp
+  800d53:	57                   	push   %edi
+  800d54:	56                   	push   %esi
+  800d55:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d56:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d61:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d69:	89 f7                	mov    %esi,%edi
+  800d6b:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800d6d:	5b                   	pop    %ebx
+  800d6e:	5e                   	pop    %esi
+  800d6f:	5f                   	pop    %edi
+  800d70:	5d                   	pop    %ebp
+  800d71:	c3                   	ret
+
+00800d72 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	57                   	push   %edi
+  800d76:	56                   	push   %esi
+  800d77:	53                   	push   %ebx
+  800d78:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d86:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d8b:	89 df                	mov    %ebx,%edi
+  800d8d:	89 de                	mov    %ebx,%esi
+  800d8f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d91:	85 c0                	test   %eax,%eax
+  800d93:	7f 08                	jg     800d9d <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d98:	5b                   	pop    %ebx
+  800d99:	5e                   	pop    %esi
+  800d9a:	5f                   	pop    %edi
+  800d9b:	5d                   	pop    %ebp
+  800d9c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d9d:	83 ec 0c             	sub    $0xc,%esp
+  800da0:	50                   	push   %eax
+  800da1:	6a 0f                	push   $0xf
+  800da3:	68 bf 29 80 00       	push   $0x8029bf
+  800da8:	6a 23                	push   $0x23
+  800daa:	68 dc 29 80 00       	push   $0x8029dc
+  800daf:	e8 20 13 00 00       	call   8020d4 <_panic>
+
+00800db4 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800db4:	55                   	push   %ebp
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	57                   	push   %edi
+  800db8:	56                   	push   %esi
+  800db9:	53                   	push   %ebx
+  800dba:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc8:	b8 10 00 00 00       	mov    $0x10,%eax
+  800dcd:	89 df                	mov    %ebx,%edi
+  800dcf:	89 de                	mov    %ebx,%esi
+  800dd1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dd3:	85 c0                	test   %eax,%eax
+  800dd5:	7f 08                	jg     800ddf <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800dd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dda:	5b                   	pop    %ebx
+  800ddb:	5e                   	pop    %esi
+  800ddc:	5f                   	pop    %edi
+  800ddd:	5d                   	pop    %ebp
+  800dde:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ddf:	83 ec 0c             	sub    $0xc,%esp
+  800de2:	50                   	push   %eax
+  800de3:	6a 10                	push   $0x10
+  800de5:	68 bf 29 80 00       	push   $0x8029bf
+  800dea:	6a 23                	push   $0x23
+  800dec:	68 dc 29 80 00       	push   $0x8029dc
+  800df1:	e8 de 12 00 00       	call   8020d4 <_panic>
+
+00800df6 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800df6:	55                   	push   %ebp
+  800df7:	89 e5                	mov    %esp,%ebp
+  800df9:	57                   	push   %edi
+  800dfa:	56                   	push   %esi
+  800dfb:	53                   	push   %ebx
+  800dfc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0a:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e0f:	89 df                	mov    %ebx,%edi
+  800e11:	89 de                	mov    %ebx,%esi
+  800e13:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e15:	85 c0                	test   %eax,%eax
+  800e17:	7f 08                	jg     800e21 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800e19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1c:	5b                   	pop    %ebx
+  800e1d:	5e                   	pop    %esi
+  800e1e:	5f                   	pop    %edi
+  800e1f:	5d                   	pop    %ebp
+  800e20:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e21:	83 ec 0c             	sub    $0xc,%esp
+  800e24:	50                   	push   %eax
+  800e25:	6a 11                	push   $0x11
+  800e27:	68 bf 29 80 00       	push   $0x8029bf
+  800e2c:	6a 23                	push   $0x23
+  800e2e:	68 dc 29 80 00       	push   $0x8029dc
+  800e33:	e8 9c 12 00 00       	call   8020d4 <_panic>
+
+00800e38 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800e38:	55                   	push   %ebp
+  800e39:	89 e5                	mov    %esp,%ebp
+  800e3b:	57                   	push   %edi
+  800e3c:	56                   	push   %esi
+  800e3d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e43:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e48:	89 d1                	mov    %edx,%ecx
+  800e4a:	89 d3                	mov    %edx,%ebx
+  800e4c:	89 d7                	mov    %edx,%edi
+  800e4e:	89 d6                	mov    %edx,%esi
+  800e50:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800e52:	5b                   	pop    %ebx
+  800e53:	5e                   	pop    %esi
+  800e54:	5f                   	pop    %edi
+  800e55:	5d                   	pop    %ebp
+  800e56:	c3                   	ret
+
+00800e57 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	57                   	push   %edi
+  800e5b:	56                   	push   %esi
+  800e5c:	53                   	push   %ebx
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6b:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e70:	89 df                	mov    %ebx,%edi
+  800e72:	89 de                	mov    %ebx,%esi
+  800e74:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e76:	85 c0                	test   %eax,%eax
+  800e78:	7f 08                	jg     800e82 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7d:	5b                   	pop    %ebx
+  800e7e:	5e                   	pop    %esi
+  800e7f:	5f                   	pop    %edi
+  800e80:	5d                   	pop    %ebp
+  800e81:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e82:	83 ec 0c             	sub    $0xc,%esp
+  800e85:	50                   	push   %eax
+  800e86:	6a 13                	push   $0x13
+  800e88:	68 bf 29 80 00       	push   $0x8029bf
+  800e8d:	6a 23                	push   $0x23
+  800e8f:	68 dc 29 80 00       	push   $0x8029dc
+  800e94:	e8 3b 12 00 00       	call   8020d4 <_panic>
+
+00800e99 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	57                   	push   %edi
+  800e9d:	56                   	push   %esi
+  800e9e:	53                   	push   %ebx
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ead:	b8 14 00 00 00       	mov    $0x14,%eax
+  800eb2:	89 df                	mov    %ebx,%edi
+  800eb4:	89 de                	mov    %ebx,%esi
+  800eb6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb8:	85 c0                	test   %eax,%eax
+  800eba:	7f 08                	jg     800ec4 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ebc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebf:	5b                   	pop    %ebx
+  800ec0:	5e                   	pop    %esi
+  800ec1:	5f                   	pop    %edi
+  800ec2:	5d                   	pop    %ebp
+  800ec3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec4:	83 ec 0c             	sub    $0xc,%esp
+  800ec7:	50                   	push   %eax
+  800ec8:	6a 14                	push   $0x14
+  800eca:	68 bf 29 80 00       	push   $0x8029bf
+  800ecf:	6a 23                	push   $0x23
+  800ed1:	68 dc 29 80 00       	push   $0x8029dc
+  800ed6:	e8 f9 11 00 00       	call   8020d4 <_panic>
+
+00800edb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800edb:	55                   	push   %ebp
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	57                   	push   %edi
+  800edf:	56                   	push   %esi
+  800ee0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee7:	b8 17 00 00 00       	mov    $0x17,%eax
+  800eec:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ef9:	5b                   	pop    %ebx
+  800efa:	5e                   	pop    %esi
+  800efb:	5f                   	pop    %edi
+  800efc:	5d                   	pop    %ebp
+  800efd:	c3                   	ret
+
+00800efe <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800efe:	55                   	push   %ebp
+  800eff:	89 e5                	mov    %esp,%ebp
+  800f01:	57                   	push   %edi
+  800f02:	56                   	push   %esi
+  800f03:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0a:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f0f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f14:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f17:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f1a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5e                   	pop    %esi
+  800f1e:	5f                   	pop    %edi
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+
+00800f21 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f21:	55                   	push   %ebp
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	57                   	push   %edi
+  800f25:	56                   	push   %esi
+  800f26:	53                   	push   %ebx
+  800f27:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f32:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f37:	89 cb                	mov    %ecx,%ebx
+  800f39:	89 cf                	mov    %ecx,%edi
+  800f3b:	89 ce                	mov    %ecx,%esi
+  800f3d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f3f:	85 c0                	test   %eax,%eax
+  800f41:	7f 08                	jg     800f4b <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f46:	5b                   	pop    %ebx
+  800f47:	5e                   	pop    %esi
+  800f48:	5f                   	pop    %edi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4b:	83 ec 0c             	sub    $0xc,%esp
+  800f4e:	50                   	push   %eax
+  800f4f:	6a 19                	push   $0x19
+  800f51:	68 bf 29 80 00       	push   $0x8029bf
+  800f56:	6a 23                	push   $0x23
+  800f58:	68 dc 29 80 00       	push   $0x8029dc
+  800f5d:	e8 72 11 00 00       	call   8020d4 <_panic>
+
+00800f62 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	57                   	push   %edi
+  800f66:	56                   	push   %esi
+  800f67:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f72:	89 d1                	mov    %edx,%ecx
+  800f74:	89 d3                	mov    %edx,%ebx
+  800f76:	89 d7                	mov    %edx,%edi
+  800f78:	89 d6                	mov    %edx,%esi
+  800f7a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f7c:	5b                   	pop    %ebx
+  800f7d:	5e                   	pop    %esi
+  800f7e:	5f                   	pop    %edi
+  800f7f:	5d                   	pop    %ebp
+  800f80:	c3                   	ret
+
+00800f81 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  800f81:	55                   	push   %ebp
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	57                   	push   %edi
+  800f85:	56                   	push   %esi
+  800f86:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f92:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800f97:	89 df                	mov    %ebx,%edi
+  800f99:	89 de                	mov    %ebx,%esi
+  800f9b:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  800f9d:	5b                   	pop    %ebx
+  800f9e:	5e                   	pop    %esi
+  800f9f:	5f                   	pop    %edi
+  800fa0:	5d                   	pop    %ebp
+  800fa1:	c3                   	ret
+
+00800fa2 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	57                   	push   %edi
+  800fa6:	56                   	push   %esi
+  800fa7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800fb8:	89 df                	mov    %ebx,%edi
+  800fba:	89 de                	mov    %ebx,%esi
+  800fbc:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  800fbe:	5b                   	pop    %ebx
+  800fbf:	5e                   	pop    %esi
+  800fc0:	5f                   	pop    %edi
+  800fc1:	5d                   	pop    %ebp
+  800fc2:	c3                   	ret
+
+00800fc3 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800fc3:	55                   	push   %ebp
+  800fc4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fc9:	05 00 00 00 30       	add    $0x30000000,%eax
+  800fce:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+
+00800fd3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fd9:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800fde:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800fe3:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800fe8:	5d                   	pop    %ebp
+  800fe9:	c3                   	ret
+
+00800fea <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800fea:	55                   	push   %ebp
+  800feb:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800fed:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800ff2:	eb 02                	jmp    800ff6 <fd_alloc+0xc>
+  800ff4:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800ff6:	89 c2                	mov    %eax,%edx
+  800ff8:	c1 ea 16             	shr    $0x16,%edx
+  800ffb:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801002:	f6 c2 01             	test   $0x1,%dl
+  801005:	74 2b                	je     801032 <fd_alloc+0x48>
+  801007:	89 c2                	mov    %eax,%edx
+  801009:	c1 ea 0c             	shr    $0xc,%edx
+  80100c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801013:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801019:	f6 c1 01             	test   $0x1,%cl
+  80101c:	74 14                	je     801032 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80101e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801024:	75 ce                	jne    800ff4 <fd_alloc+0xa>
+  801026:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80102b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801030:	eb 05                	jmp    801037 <fd_alloc+0x4d>
+			return 0;
+  801032:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801037:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103a:	89 02                	mov    %eax,(%edx)
+}
+  80103c:	89 c8                	mov    %ecx,%eax
+  80103e:	5d                   	pop    %ebp
+  80103f:	c3                   	ret
+
+00801040 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801040:	55                   	push   %ebp
+  801041:	89 e5                	mov    %esp,%ebp
+  801043:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801046:	83 f8 1f             	cmp    $0x1f,%eax
+  801049:	77 30                	ja     80107b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80104b:	c1 e0 0c             	shl    $0xc,%eax
+  80104e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801053:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801059:	f6 c2 01             	test   $0x1,%dl
+  80105c:	74 24                	je     801082 <fd_lookup+0x42>
+  80105e:	89 c2                	mov    %eax,%edx
+  801060:	c1 ea 0c             	shr    $0xc,%edx
+  801063:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80106a:	f6 c2 01             	test   $0x1,%dl
+  80106d:	74 1a                	je     801089 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80106f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801072:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801074:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801079:	5d                   	pop    %ebp
+  80107a:	c3                   	ret
+		return -E_INVAL;
+  80107b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801080:	eb f7                	jmp    801079 <fd_lookup+0x39>
+		return -E_INVAL;
+  801082:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801087:	eb f0                	jmp    801079 <fd_lookup+0x39>
+  801089:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80108e:	eb e9                	jmp    801079 <fd_lookup+0x39>
+
+00801090 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801090:	55                   	push   %ebp
+  801091:	89 e5                	mov    %esp,%ebp
+  801093:	53                   	push   %ebx
+  801094:	83 ec 04             	sub    $0x4,%esp
+  801097:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80109a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109f:	eb 03                	jmp    8010a4 <dev_lookup+0x14>
+  8010a1:	83 c0 01             	add    $0x1,%eax
+  8010a4:	8b 1c 85 68 2a 80 00 	mov    0x802a68(,%eax,4),%ebx
+  8010ab:	85 db                	test   %ebx,%ebx
+  8010ad:	74 0b                	je     8010ba <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8010af:	39 13                	cmp    %edx,(%ebx)
+  8010b1:	75 ee                	jne    8010a1 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8010b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b8:	eb 1f                	jmp    8010d9 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8010ba:	a1 08 40 80 00       	mov    0x804008,%eax
+  8010bf:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8010c2:	83 ec 04             	sub    $0x4,%esp
+  8010c5:	52                   	push   %edx
+  8010c6:	50                   	push   %eax
+  8010c7:	68 ec 29 80 00       	push   $0x8029ec
+  8010cc:	e8 72 f0 ff ff       	call   800143 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8010d1:	83 c4 10             	add    $0x10,%esp
+  8010d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8010d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010dc:	89 1a                	mov    %ebx,(%edx)
+}
+  8010de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010e1:	c9                   	leave
+  8010e2:	c3                   	ret
+
+008010e3 <fd_close>:
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	83 ec 24             	sub    $0x24,%esp
+  8010ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010ef:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8010f2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8010f5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010f6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8010fc:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8010ff:	50                   	push   %eax
+  801100:	e8 3b ff ff ff       	call   801040 <fd_lookup>
+  801105:	89 c3                	mov    %eax,%ebx
+  801107:	83 c4 10             	add    $0x10,%esp
+  80110a:	85 c0                	test   %eax,%eax
+  80110c:	78 05                	js     801113 <fd_close+0x30>
+	    || fd != fd2)
+  80110e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801111:	74 16                	je     801129 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801113:	89 f8                	mov    %edi,%eax
+  801115:	84 c0                	test   %al,%al
+  801117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80111c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80111f:	89 d8                	mov    %ebx,%eax
+  801121:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801124:	5b                   	pop    %ebx
+  801125:	5e                   	pop    %esi
+  801126:	5f                   	pop    %edi
+  801127:	5d                   	pop    %ebp
+  801128:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801129:	83 ec 08             	sub    $0x8,%esp
+  80112c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80112f:	50                   	push   %eax
+  801130:	ff 36                	push   (%esi)
+  801132:	e8 59 ff ff ff       	call   801090 <dev_lookup>
+  801137:	89 c3                	mov    %eax,%ebx
+  801139:	83 c4 10             	add    $0x10,%esp
+  80113c:	85 c0                	test   %eax,%eax
+  80113e:	78 1a                	js     80115a <fd_close+0x77>
+		if (dev->dev_close)
+  801140:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801143:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801146:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80114b:	85 c0                	test   %eax,%eax
+  80114d:	74 0b                	je     80115a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80114f:	83 ec 0c             	sub    $0xc,%esp
+  801152:	56                   	push   %esi
+  801153:	ff d0                	call   *%eax
+  801155:	89 c3                	mov    %eax,%ebx
+  801157:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80115a:	83 ec 08             	sub    $0x8,%esp
+  80115d:	56                   	push   %esi
+  80115e:	6a 00                	push   $0x0
+  801160:	e8 01 fb ff ff       	call   800c66 <sys_page_unmap>
+	return r;
+  801165:	83 c4 10             	add    $0x10,%esp
+  801168:	eb b5                	jmp    80111f <fd_close+0x3c>
+
+0080116a <close>:
+
+int
+close(int fdnum)
+{
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+  80116d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801170:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801173:	50                   	push   %eax
+  801174:	ff 75 08             	push   0x8(%ebp)
+  801177:	e8 c4 fe ff ff       	call   801040 <fd_lookup>
+  80117c:	83 c4 10             	add    $0x10,%esp
+  80117f:	85 c0                	test   %eax,%eax
+  801181:	79 02                	jns    801185 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801183:	c9                   	leave
+  801184:	c3                   	ret
+		return fd_close(fd, 1);
+  801185:	83 ec 08             	sub    $0x8,%esp
+  801188:	6a 01                	push   $0x1
+  80118a:	ff 75 f4             	push   -0xc(%ebp)
+  80118d:	e8 51 ff ff ff       	call   8010e3 <fd_close>
+  801192:	83 c4 10             	add    $0x10,%esp
+  801195:	eb ec                	jmp    801183 <close+0x19>
+
+00801197 <close_all>:
+
+void
+close_all(void)
+{
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+  80119a:	53                   	push   %ebx
+  80119b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80119e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8011a3:	83 ec 0c             	sub    $0xc,%esp
+  8011a6:	53                   	push   %ebx
+  8011a7:	e8 be ff ff ff       	call   80116a <close>
+	for (i = 0; i < MAXFD; i++)
+  8011ac:	83 c3 01             	add    $0x1,%ebx
+  8011af:	83 c4 10             	add    $0x10,%esp
+  8011b2:	83 fb 20             	cmp    $0x20,%ebx
+  8011b5:	75 ec                	jne    8011a3 <close_all+0xc>
+}
+  8011b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011ba:	c9                   	leave
+  8011bb:	c3                   	ret
+
+008011bc <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+  8011c2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8011c5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011c8:	50                   	push   %eax
+  8011c9:	ff 75 08             	push   0x8(%ebp)
+  8011cc:	e8 6f fe ff ff       	call   801040 <fd_lookup>
+  8011d1:	89 c3                	mov    %eax,%ebx
+  8011d3:	83 c4 10             	add    $0x10,%esp
+  8011d6:	85 c0                	test   %eax,%eax
+  8011d8:	78 7f                	js     801259 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8011da:	83 ec 0c             	sub    $0xc,%esp
+  8011dd:	ff 75 0c             	push   0xc(%ebp)
+  8011e0:	e8 85 ff ff ff       	call   80116a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8011e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8011e8:	c1 e6 0c             	shl    $0xc,%esi
+  8011eb:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8011f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8011f4:	89 3c 24             	mov    %edi,(%esp)
+  8011f7:	e8 d7 fd ff ff       	call   800fd3 <fd2data>
+  8011fc:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8011fe:	89 34 24             	mov    %esi,(%esp)
+  801201:	e8 cd fd ff ff       	call   800fd3 <fd2data>
+  801206:	83 c4 10             	add    $0x10,%esp
+  801209:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80120c:	89 d8                	mov    %ebx,%eax
+  80120e:	c1 e8 16             	shr    $0x16,%eax
+  801211:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801218:	a8 01                	test   $0x1,%al
+  80121a:	74 11                	je     80122d <dup+0x71>
+  80121c:	89 d8                	mov    %ebx,%eax
+  80121e:	c1 e8 0c             	shr    $0xc,%eax
+  801221:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801228:	f6 c2 01             	test   $0x1,%dl
+  80122b:	75 36                	jne    801263 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80122d:	89 f8                	mov    %edi,%eax
+  80122f:	c1 e8 0c             	shr    $0xc,%eax
+  801232:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801239:	83 ec 0c             	sub    $0xc,%esp
+  80123c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801241:	50                   	push   %eax
+  801242:	56                   	push   %esi
+  801243:	6a 00                	push   $0x0
+  801245:	57                   	push   %edi
+  801246:	6a 00                	push   $0x0
+  801248:	e8 d7 f9 ff ff       	call   800c24 <sys_page_map>
+  80124d:	89 c3                	mov    %eax,%ebx
+  80124f:	83 c4 20             	add    $0x20,%esp
+  801252:	85 c0                	test   %eax,%eax
+  801254:	78 33                	js     801289 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801256:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801259:	89 d8                	mov    %ebx,%eax
+  80125b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125e:	5b                   	pop    %ebx
+  80125f:	5e                   	pop    %esi
+  801260:	5f                   	pop    %edi
+  801261:	5d                   	pop    %ebp
+  801262:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801263:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80126a:	83 ec 0c             	sub    $0xc,%esp
+  80126d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801272:	50                   	push   %eax
+  801273:	ff 75 d4             	push   -0x2c(%ebp)
+  801276:	6a 00                	push   $0x0
+  801278:	53                   	push   %ebx
+  801279:	6a 00                	push   $0x0
+  80127b:	e8 a4 f9 ff ff       	call   800c24 <sys_page_map>
+  801280:	89 c3                	mov    %eax,%ebx
+  801282:	83 c4 20             	add    $0x20,%esp
+  801285:	85 c0                	test   %eax,%eax
+  801287:	79 a4                	jns    80122d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801289:	83 ec 08             	sub    $0x8,%esp
+  80128c:	56                   	push   %esi
+  80128d:	6a 00                	push   $0x0
+  80128f:	e8 d2 f9 ff ff       	call   800c66 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801294:	83 c4 08             	add    $0x8,%esp
+  801297:	ff 75 d4             	push   -0x2c(%ebp)
+  80129a:	6a 00                	push   $0x0
+  80129c:	e8 c5 f9 ff ff       	call   800c66 <sys_page_unmap>
+	return r;
+  8012a1:	83 c4 10             	add    $0x10,%esp
+  8012a4:	eb b3                	jmp    801259 <dup+0x9d>
+
+008012a6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8012a6:	55                   	push   %ebp
+  8012a7:	89 e5                	mov    %esp,%ebp
+  8012a9:	56                   	push   %esi
+  8012aa:	53                   	push   %ebx
+  8012ab:	83 ec 18             	sub    $0x18,%esp
+  8012ae:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012b1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012b4:	50                   	push   %eax
+  8012b5:	56                   	push   %esi
+  8012b6:	e8 85 fd ff ff       	call   801040 <fd_lookup>
+  8012bb:	83 c4 10             	add    $0x10,%esp
+  8012be:	85 c0                	test   %eax,%eax
+  8012c0:	78 3c                	js     8012fe <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012c2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8012c5:	83 ec 08             	sub    $0x8,%esp
+  8012c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012cb:	50                   	push   %eax
+  8012cc:	ff 33                	push   (%ebx)
+  8012ce:	e8 bd fd ff ff       	call   801090 <dev_lookup>
+  8012d3:	83 c4 10             	add    $0x10,%esp
+  8012d6:	85 c0                	test   %eax,%eax
+  8012d8:	78 24                	js     8012fe <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8012da:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012dd:	83 e0 03             	and    $0x3,%eax
+  8012e0:	83 f8 01             	cmp    $0x1,%eax
+  8012e3:	74 20                	je     801305 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8012e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012e8:	8b 40 08             	mov    0x8(%eax),%eax
+  8012eb:	85 c0                	test   %eax,%eax
+  8012ed:	74 37                	je     801326 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8012ef:	83 ec 04             	sub    $0x4,%esp
+  8012f2:	ff 75 10             	push   0x10(%ebp)
+  8012f5:	ff 75 0c             	push   0xc(%ebp)
+  8012f8:	53                   	push   %ebx
+  8012f9:	ff d0                	call   *%eax
+  8012fb:	83 c4 10             	add    $0x10,%esp
+}
+  8012fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801301:	5b                   	pop    %ebx
+  801302:	5e                   	pop    %esi
+  801303:	5d                   	pop    %ebp
+  801304:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801305:	a1 08 40 80 00       	mov    0x804008,%eax
+  80130a:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80130d:	83 ec 04             	sub    $0x4,%esp
+  801310:	56                   	push   %esi
+  801311:	50                   	push   %eax
+  801312:	68 2d 2a 80 00       	push   $0x802a2d
+  801317:	e8 27 ee ff ff       	call   800143 <cprintf>
+		return -E_INVAL;
+  80131c:	83 c4 10             	add    $0x10,%esp
+  80131f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801324:	eb d8                	jmp    8012fe <read+0x58>
+		return -E_NOT_SUPP;
+  801326:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80132b:	eb d1                	jmp    8012fe <read+0x58>
+
+0080132d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80132d:	55                   	push   %ebp
+  80132e:	89 e5                	mov    %esp,%ebp
+  801330:	57                   	push   %edi
+  801331:	56                   	push   %esi
+  801332:	53                   	push   %ebx
+  801333:	83 ec 0c             	sub    $0xc,%esp
+  801336:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801339:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80133c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801341:	eb 02                	jmp    801345 <readn+0x18>
+  801343:	01 c3                	add    %eax,%ebx
+  801345:	39 f3                	cmp    %esi,%ebx
+  801347:	73 21                	jae    80136a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801349:	83 ec 04             	sub    $0x4,%esp
+  80134c:	89 f0                	mov    %esi,%eax
+  80134e:	29 d8                	sub    %ebx,%eax
+  801350:	50                   	push   %eax
+  801351:	89 d8                	mov    %ebx,%eax
+  801353:	03 45 0c             	add    0xc(%ebp),%eax
+  801356:	50                   	push   %eax
+  801357:	57                   	push   %edi
+  801358:	e8 49 ff ff ff       	call   8012a6 <read>
+		if (m < 0)
+  80135d:	83 c4 10             	add    $0x10,%esp
+  801360:	85 c0                	test   %eax,%eax
+  801362:	78 04                	js     801368 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801364:	75 dd                	jne    801343 <readn+0x16>
+  801366:	eb 02                	jmp    80136a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801368:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80136a:	89 d8                	mov    %ebx,%eax
+  80136c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136f:	5b                   	pop    %ebx
+  801370:	5e                   	pop    %esi
+  801371:	5f                   	pop    %edi
+  801372:	5d                   	pop    %ebp
+  801373:	c3                   	ret
+
+00801374 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	56                   	push   %esi
+  801378:	53                   	push   %ebx
+  801379:	83 ec 18             	sub    $0x18,%esp
+  80137c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80137f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801382:	50                   	push   %eax
+  801383:	53                   	push   %ebx
+  801384:	e8 b7 fc ff ff       	call   801040 <fd_lookup>
+  801389:	83 c4 10             	add    $0x10,%esp
+  80138c:	85 c0                	test   %eax,%eax
+  80138e:	78 37                	js     8013c7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801390:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801393:	83 ec 08             	sub    $0x8,%esp
+  801396:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801399:	50                   	push   %eax
+  80139a:	ff 36                	push   (%esi)
+  80139c:	e8 ef fc ff ff       	call   801090 <dev_lookup>
+  8013a1:	83 c4 10             	add    $0x10,%esp
+  8013a4:	85 c0                	test   %eax,%eax
+  8013a6:	78 1f                	js     8013c7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013a8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013ac:	74 20                	je     8013ce <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8013ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013b1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013b4:	85 c0                	test   %eax,%eax
+  8013b6:	74 37                	je     8013ef <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8013b8:	83 ec 04             	sub    $0x4,%esp
+  8013bb:	ff 75 10             	push   0x10(%ebp)
+  8013be:	ff 75 0c             	push   0xc(%ebp)
+  8013c1:	56                   	push   %esi
+  8013c2:	ff d0                	call   *%eax
+  8013c4:	83 c4 10             	add    $0x10,%esp
+}
+  8013c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013ca:	5b                   	pop    %ebx
+  8013cb:	5e                   	pop    %esi
+  8013cc:	5d                   	pop    %ebp
+  8013cd:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013ce:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013d3:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8013d6:	83 ec 04             	sub    $0x4,%esp
+  8013d9:	53                   	push   %ebx
+  8013da:	50                   	push   %eax
+  8013db:	68 49 2a 80 00       	push   $0x802a49
+  8013e0:	e8 5e ed ff ff       	call   800143 <cprintf>
+		return -E_INVAL;
+  8013e5:	83 c4 10             	add    $0x10,%esp
+  8013e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ed:	eb d8                	jmp    8013c7 <write+0x53>
+		return -E_NOT_SUPP;
+  8013ef:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013f4:	eb d1                	jmp    8013c7 <write+0x53>
+
+008013f6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8013f6:	55                   	push   %ebp
+  8013f7:	89 e5                	mov    %esp,%ebp
+  8013f9:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013ff:	50                   	push   %eax
+  801400:	ff 75 08             	push   0x8(%ebp)
+  801403:	e8 38 fc ff ff       	call   801040 <fd_lookup>
+  801408:	83 c4 10             	add    $0x10,%esp
+  80140b:	85 c0                	test   %eax,%eax
+  80140d:	78 0e                	js     80141d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80140f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801412:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801415:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801418:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80141d:	c9                   	leave
+  80141e:	c3                   	ret
+
+0080141f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	56                   	push   %esi
+  801423:	53                   	push   %ebx
+  801424:	83 ec 18             	sub    $0x18,%esp
+  801427:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80142a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80142d:	50                   	push   %eax
+  80142e:	53                   	push   %ebx
+  80142f:	e8 0c fc ff ff       	call   801040 <fd_lookup>
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	85 c0                	test   %eax,%eax
+  801439:	78 34                	js     80146f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80143b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80143e:	83 ec 08             	sub    $0x8,%esp
+  801441:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801444:	50                   	push   %eax
+  801445:	ff 36                	push   (%esi)
+  801447:	e8 44 fc ff ff       	call   801090 <dev_lookup>
+  80144c:	83 c4 10             	add    $0x10,%esp
+  80144f:	85 c0                	test   %eax,%eax
+  801451:	78 1c                	js     80146f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801453:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801457:	74 1d                	je     801476 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801459:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80145c:	8b 40 18             	mov    0x18(%eax),%eax
+  80145f:	85 c0                	test   %eax,%eax
+  801461:	74 34                	je     801497 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801463:	83 ec 08             	sub    $0x8,%esp
+  801466:	ff 75 0c             	push   0xc(%ebp)
+  801469:	56                   	push   %esi
+  80146a:	ff d0                	call   *%eax
+  80146c:	83 c4 10             	add    $0x10,%esp
+}
+  80146f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801472:	5b                   	pop    %ebx
+  801473:	5e                   	pop    %esi
+  801474:	5d                   	pop    %ebp
+  801475:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801476:	a1 08 40 80 00       	mov    0x804008,%eax
+  80147b:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80147e:	83 ec 04             	sub    $0x4,%esp
+  801481:	53                   	push   %ebx
+  801482:	50                   	push   %eax
+  801483:	68 0c 2a 80 00       	push   $0x802a0c
+  801488:	e8 b6 ec ff ff       	call   800143 <cprintf>
+		return -E_INVAL;
+  80148d:	83 c4 10             	add    $0x10,%esp
+  801490:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801495:	eb d8                	jmp    80146f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801497:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80149c:	eb d1                	jmp    80146f <ftruncate+0x50>
+
+0080149e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80149e:	55                   	push   %ebp
+  80149f:	89 e5                	mov    %esp,%ebp
+  8014a1:	56                   	push   %esi
+  8014a2:	53                   	push   %ebx
+  8014a3:	83 ec 18             	sub    $0x18,%esp
+  8014a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014a9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014ac:	50                   	push   %eax
+  8014ad:	ff 75 08             	push   0x8(%ebp)
+  8014b0:	e8 8b fb ff ff       	call   801040 <fd_lookup>
+  8014b5:	83 c4 10             	add    $0x10,%esp
+  8014b8:	85 c0                	test   %eax,%eax
+  8014ba:	78 49                	js     801505 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014bc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014bf:	83 ec 08             	sub    $0x8,%esp
+  8014c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c5:	50                   	push   %eax
+  8014c6:	ff 36                	push   (%esi)
+  8014c8:	e8 c3 fb ff ff       	call   801090 <dev_lookup>
+  8014cd:	83 c4 10             	add    $0x10,%esp
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	78 31                	js     801505 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8014d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014d7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8014db:	74 2f                	je     80150c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8014dd:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8014e0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8014e7:	00 00 00 
+	stat->st_isdir = 0;
+  8014ea:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8014f1:	00 00 00 
+	stat->st_dev = dev;
+  8014f4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8014fa:	83 ec 08             	sub    $0x8,%esp
+  8014fd:	53                   	push   %ebx
+  8014fe:	56                   	push   %esi
+  8014ff:	ff 50 14             	call   *0x14(%eax)
+  801502:	83 c4 10             	add    $0x10,%esp
+}
+  801505:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801508:	5b                   	pop    %ebx
+  801509:	5e                   	pop    %esi
+  80150a:	5d                   	pop    %ebp
+  80150b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80150c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801511:	eb f2                	jmp    801505 <fstat+0x67>
+
+00801513 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801513:	55                   	push   %ebp
+  801514:	89 e5                	mov    %esp,%ebp
+  801516:	56                   	push   %esi
+  801517:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801518:	83 ec 08             	sub    $0x8,%esp
+  80151b:	6a 00                	push   $0x0
+  80151d:	ff 75 08             	push   0x8(%ebp)
+  801520:	e8 e4 01 00 00       	call   801709 <open>
+  801525:	89 c3                	mov    %eax,%ebx
+  801527:	83 c4 10             	add    $0x10,%esp
+  80152a:	85 c0                	test   %eax,%eax
+  80152c:	78 1b                	js     801549 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80152e:	83 ec 08             	sub    $0x8,%esp
+  801531:	ff 75 0c             	push   0xc(%ebp)
+  801534:	50                   	push   %eax
+  801535:	e8 64 ff ff ff       	call   80149e <fstat>
+  80153a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80153c:	89 1c 24             	mov    %ebx,(%esp)
+  80153f:	e8 26 fc ff ff       	call   80116a <close>
+	return r;
+  801544:	83 c4 10             	add    $0x10,%esp
+  801547:	89 f3                	mov    %esi,%ebx
+}
+  801549:	89 d8                	mov    %ebx,%eax
+  80154b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80154e:	5b                   	pop    %ebx
+  80154f:	5e                   	pop    %esi
+  801550:	5d                   	pop    %ebp
+  801551:	c3                   	ret
+
+00801552 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801552:	55                   	push   %ebp
+  801553:	89 e5                	mov    %esp,%ebp
+  801555:	56                   	push   %esi
+  801556:	53                   	push   %ebx
+  801557:	89 c6                	mov    %eax,%esi
+  801559:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80155b:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801562:	74 27                	je     80158b <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801564:	6a 07                	push   $0x7
+  801566:	68 00 50 80 00       	push   $0x805000
+  80156b:	56                   	push   %esi
+  80156c:	ff 35 00 40 80 00    	push   0x804000
+  801572:	e8 1b 0c 00 00       	call   802192 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801577:	83 c4 0c             	add    $0xc,%esp
+  80157a:	6a 00                	push   $0x0
+  80157c:	53                   	push   %ebx
+  80157d:	6a 00                	push   $0x0
+  80157f:	e8 96 0b 00 00       	call   80211a <ipc_recv>
+}
+  801584:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801587:	5b                   	pop    %ebx
+  801588:	5e                   	pop    %esi
+  801589:	5d                   	pop    %ebp
+  80158a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80158b:	83 ec 0c             	sub    $0xc,%esp
+  80158e:	6a 01                	push   $0x1
+  801590:	e8 51 0c 00 00       	call   8021e6 <ipc_find_env>
+  801595:	a3 00 40 80 00       	mov    %eax,0x804000
+  80159a:	83 c4 10             	add    $0x10,%esp
+  80159d:	eb c5                	jmp    801564 <fsipc+0x12>
+
+0080159f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80159f:	55                   	push   %ebp
+  8015a0:	89 e5                	mov    %esp,%ebp
+  8015a2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8015a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015a8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015ab:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8015b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015b3:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8015b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015bd:	b8 02 00 00 00       	mov    $0x2,%eax
+  8015c2:	e8 8b ff ff ff       	call   801552 <fsipc>
+}
+  8015c7:	c9                   	leave
+  8015c8:	c3                   	ret
+
+008015c9 <devfile_flush>:
+{
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8015cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015d2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015d5:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8015da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015df:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015e4:	e8 69 ff ff ff       	call   801552 <fsipc>
+}
+  8015e9:	c9                   	leave
+  8015ea:	c3                   	ret
+
+008015eb <devfile_stat>:
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	53                   	push   %ebx
+  8015ef:	83 ec 04             	sub    $0x4,%esp
+  8015f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8015f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015fb:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801600:	ba 00 00 00 00       	mov    $0x0,%edx
+  801605:	b8 05 00 00 00       	mov    $0x5,%eax
+  80160a:	e8 43 ff ff ff       	call   801552 <fsipc>
+  80160f:	85 c0                	test   %eax,%eax
+  801611:	78 2c                	js     80163f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801613:	83 ec 08             	sub    $0x8,%esp
+  801616:	68 00 50 80 00       	push   $0x805000
+  80161b:	53                   	push   %ebx
+  80161c:	e8 10 f1 ff ff       	call   800731 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801621:	a1 80 50 80 00       	mov    0x805080,%eax
+  801626:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80162c:	a1 84 50 80 00       	mov    0x805084,%eax
+  801631:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801637:	83 c4 10             	add    $0x10,%esp
+  80163a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80163f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801642:	c9                   	leave
+  801643:	c3                   	ret
+
+00801644 <devfile_write>:
+{
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	83 ec 0c             	sub    $0xc,%esp
+  80164a:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80164d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801652:	39 d0                	cmp    %edx,%eax
+  801654:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801657:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165a:	8b 52 0c             	mov    0xc(%edx),%edx
+  80165d:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801663:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801668:	50                   	push   %eax
+  801669:	ff 75 0c             	push   0xc(%ebp)
+  80166c:	68 08 50 80 00       	push   $0x805008
+  801671:	e8 41 f2 ff ff       	call   8008b7 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801676:	ba 00 00 00 00       	mov    $0x0,%edx
+  80167b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801680:	e8 cd fe ff ff       	call   801552 <fsipc>
+}
+  801685:	c9                   	leave
+  801686:	c3                   	ret
+
+00801687 <devfile_read>:
+{
+  801687:	55                   	push   %ebp
+  801688:	89 e5                	mov    %esp,%ebp
+  80168a:	56                   	push   %esi
+  80168b:	53                   	push   %ebx
+  80168c:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80168f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801692:	8b 40 0c             	mov    0xc(%eax),%eax
+  801695:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  80169a:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8016a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8016aa:	e8 a3 fe ff ff       	call   801552 <fsipc>
+  8016af:	89 c3                	mov    %eax,%ebx
+  8016b1:	85 c0                	test   %eax,%eax
+  8016b3:	78 1f                	js     8016d4 <devfile_read+0x4d>
+	assert(r <= n);
+  8016b5:	39 c6                	cmp    %eax,%esi
+  8016b7:	72 24                	jb     8016dd <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8016b9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8016be:	7f 33                	jg     8016f3 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8016c0:	83 ec 04             	sub    $0x4,%esp
+  8016c3:	50                   	push   %eax
+  8016c4:	68 00 50 80 00       	push   $0x805000
+  8016c9:	ff 75 0c             	push   0xc(%ebp)
+  8016cc:	e8 e6 f1 ff ff       	call   8008b7 <memmove>
+	return r;
+  8016d1:	83 c4 10             	add    $0x10,%esp
+}
+  8016d4:	89 d8                	mov    %ebx,%eax
+  8016d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016d9:	5b                   	pop    %ebx
+  8016da:	5e                   	pop    %esi
+  8016db:	5d                   	pop    %ebp
+  8016dc:	c3                   	ret
+	assert(r <= n);
+  8016dd:	68 7c 2a 80 00       	push   $0x802a7c
+  8016e2:	68 83 2a 80 00       	push   $0x802a83
+  8016e7:	6a 7c                	push   $0x7c
+  8016e9:	68 98 2a 80 00       	push   $0x802a98
+  8016ee:	e8 e1 09 00 00       	call   8020d4 <_panic>
+	assert(r <= PGSIZE);
+  8016f3:	68 a3 2a 80 00       	push   $0x802aa3
+  8016f8:	68 83 2a 80 00       	push   $0x802a83
+  8016fd:	6a 7d                	push   $0x7d
+  8016ff:	68 98 2a 80 00       	push   $0x802a98
+  801704:	e8 cb 09 00 00       	call   8020d4 <_panic>
+
+00801709 <open>:
+{
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	56                   	push   %esi
+  80170d:	53                   	push   %ebx
+  80170e:	83 ec 1c             	sub    $0x1c,%esp
+  801711:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801714:	56                   	push   %esi
+  801715:	e8 dc ef ff ff       	call   8006f6 <strlen>
+  80171a:	83 c4 10             	add    $0x10,%esp
+  80171d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801722:	7f 6c                	jg     801790 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801724:	83 ec 0c             	sub    $0xc,%esp
+  801727:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80172a:	50                   	push   %eax
+  80172b:	e8 ba f8 ff ff       	call   800fea <fd_alloc>
+  801730:	89 c3                	mov    %eax,%ebx
+  801732:	83 c4 10             	add    $0x10,%esp
+  801735:	85 c0                	test   %eax,%eax
+  801737:	78 3c                	js     801775 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801739:	83 ec 08             	sub    $0x8,%esp
+  80173c:	56                   	push   %esi
+  80173d:	68 00 50 80 00       	push   $0x805000
+  801742:	e8 ea ef ff ff       	call   800731 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801747:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80174a:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80174f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801752:	b8 01 00 00 00       	mov    $0x1,%eax
+  801757:	e8 f6 fd ff ff       	call   801552 <fsipc>
+  80175c:	89 c3                	mov    %eax,%ebx
+  80175e:	83 c4 10             	add    $0x10,%esp
+  801761:	85 c0                	test   %eax,%eax
+  801763:	78 19                	js     80177e <open+0x75>
+	return fd2num(fd);
+  801765:	83 ec 0c             	sub    $0xc,%esp
+  801768:	ff 75 f4             	push   -0xc(%ebp)
+  80176b:	e8 53 f8 ff ff       	call   800fc3 <fd2num>
+  801770:	89 c3                	mov    %eax,%ebx
+  801772:	83 c4 10             	add    $0x10,%esp
+}
+  801775:	89 d8                	mov    %ebx,%eax
+  801777:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80177a:	5b                   	pop    %ebx
+  80177b:	5e                   	pop    %esi
+  80177c:	5d                   	pop    %ebp
+  80177d:	c3                   	ret
+		fd_close(fd, 0);
+  80177e:	83 ec 08             	sub    $0x8,%esp
+  801781:	6a 00                	push   $0x0
+  801783:	ff 75 f4             	push   -0xc(%ebp)
+  801786:	e8 58 f9 ff ff       	call   8010e3 <fd_close>
+		return r;
+  80178b:	83 c4 10             	add    $0x10,%esp
+  80178e:	eb e5                	jmp    801775 <open+0x6c>
+		return -E_BAD_PATH;
+  801790:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801795:	eb de                	jmp    801775 <open+0x6c>
+
+00801797 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801797:	55                   	push   %ebp
+  801798:	89 e5                	mov    %esp,%ebp
+  80179a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80179d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017a7:	e8 a6 fd ff ff       	call   801552 <fsipc>
+}
+  8017ac:	c9                   	leave
+  8017ad:	c3                   	ret
+
+008017ae <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8017ae:	55                   	push   %ebp
+  8017af:	89 e5                	mov    %esp,%ebp
+  8017b1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8017b4:	68 af 2a 80 00       	push   $0x802aaf
+  8017b9:	ff 75 0c             	push   0xc(%ebp)
+  8017bc:	e8 70 ef ff ff       	call   800731 <strcpy>
+	return 0;
+}
+  8017c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c6:	c9                   	leave
+  8017c7:	c3                   	ret
+
+008017c8 <devsock_close>:
+{
+  8017c8:	55                   	push   %ebp
+  8017c9:	89 e5                	mov    %esp,%ebp
+  8017cb:	53                   	push   %ebx
+  8017cc:	83 ec 10             	sub    $0x10,%esp
+  8017cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8017d2:	53                   	push   %ebx
+  8017d3:	e8 1e 0a 00 00       	call   8021f6 <pageref>
+  8017d8:	89 c2                	mov    %eax,%edx
+  8017da:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8017dd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8017e2:	83 fa 01             	cmp    $0x1,%edx
+  8017e5:	74 05                	je     8017ec <devsock_close+0x24>
+}
+  8017e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ea:	c9                   	leave
+  8017eb:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8017ec:	83 ec 0c             	sub    $0xc,%esp
+  8017ef:	ff 73 0c             	push   0xc(%ebx)
+  8017f2:	e8 b7 02 00 00       	call   801aae <nsipc_close>
+  8017f7:	83 c4 10             	add    $0x10,%esp
+  8017fa:	eb eb                	jmp    8017e7 <devsock_close+0x1f>
+
+008017fc <devsock_write>:
+{
+  8017fc:	55                   	push   %ebp
+  8017fd:	89 e5                	mov    %esp,%ebp
+  8017ff:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801802:	6a 00                	push   $0x0
+  801804:	ff 75 10             	push   0x10(%ebp)
+  801807:	ff 75 0c             	push   0xc(%ebp)
+  80180a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180d:	ff 70 0c             	push   0xc(%eax)
+  801810:	e8 79 03 00 00       	call   801b8e <nsipc_send>
+}
+  801815:	c9                   	leave
+  801816:	c3                   	ret
+
+00801817 <devsock_read>:
+{
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80181d:	6a 00                	push   $0x0
+  80181f:	ff 75 10             	push   0x10(%ebp)
+  801822:	ff 75 0c             	push   0xc(%ebp)
+  801825:	8b 45 08             	mov    0x8(%ebp),%eax
+  801828:	ff 70 0c             	push   0xc(%eax)
+  80182b:	e8 ef 02 00 00       	call   801b1f <nsipc_recv>
+}
+  801830:	c9                   	leave
+  801831:	c3                   	ret
+
+00801832 <fd2sockid>:
+{
+  801832:	55                   	push   %ebp
+  801833:	89 e5                	mov    %esp,%ebp
+  801835:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801838:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80183b:	52                   	push   %edx
+  80183c:	50                   	push   %eax
+  80183d:	e8 fe f7 ff ff       	call   801040 <fd_lookup>
+  801842:	83 c4 10             	add    $0x10,%esp
+  801845:	85 c0                	test   %eax,%eax
+  801847:	78 10                	js     801859 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801849:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80184c:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801852:	39 08                	cmp    %ecx,(%eax)
+  801854:	75 05                	jne    80185b <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801856:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801859:	c9                   	leave
+  80185a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80185b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801860:	eb f7                	jmp    801859 <fd2sockid+0x27>
+
+00801862 <alloc_sockfd>:
+{
+  801862:	55                   	push   %ebp
+  801863:	89 e5                	mov    %esp,%ebp
+  801865:	56                   	push   %esi
+  801866:	53                   	push   %ebx
+  801867:	83 ec 1c             	sub    $0x1c,%esp
+  80186a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80186c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80186f:	50                   	push   %eax
+  801870:	e8 75 f7 ff ff       	call   800fea <fd_alloc>
+  801875:	89 c3                	mov    %eax,%ebx
+  801877:	83 c4 10             	add    $0x10,%esp
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	78 43                	js     8018c1 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80187e:	83 ec 04             	sub    $0x4,%esp
+  801881:	68 07 04 00 00       	push   $0x407
+  801886:	ff 75 f4             	push   -0xc(%ebp)
+  801889:	6a 00                	push   $0x0
+  80188b:	e8 0e f3 ff ff       	call   800b9e <sys_page_alloc>
+  801890:	89 c3                	mov    %eax,%ebx
+  801892:	83 c4 10             	add    $0x10,%esp
+  801895:	85 c0                	test   %eax,%eax
+  801897:	78 28                	js     8018c1 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801899:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80189c:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8018a2:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8018a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018a7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8018ae:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8018b1:	83 ec 0c             	sub    $0xc,%esp
+  8018b4:	50                   	push   %eax
+  8018b5:	e8 09 f7 ff ff       	call   800fc3 <fd2num>
+  8018ba:	89 c3                	mov    %eax,%ebx
+  8018bc:	83 c4 10             	add    $0x10,%esp
+  8018bf:	eb 0c                	jmp    8018cd <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8018c1:	83 ec 0c             	sub    $0xc,%esp
+  8018c4:	56                   	push   %esi
+  8018c5:	e8 e4 01 00 00       	call   801aae <nsipc_close>
+		return r;
+  8018ca:	83 c4 10             	add    $0x10,%esp
+}
+  8018cd:	89 d8                	mov    %ebx,%eax
+  8018cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018d2:	5b                   	pop    %ebx
+  8018d3:	5e                   	pop    %esi
+  8018d4:	5d                   	pop    %ebp
+  8018d5:	c3                   	ret
+
+008018d6 <accept>:
+{
+  8018d6:	55                   	push   %ebp
+  8018d7:	89 e5                	mov    %esp,%ebp
+  8018d9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8018dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018df:	e8 4e ff ff ff       	call   801832 <fd2sockid>
+  8018e4:	85 c0                	test   %eax,%eax
+  8018e6:	78 1b                	js     801903 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8018e8:	83 ec 04             	sub    $0x4,%esp
+  8018eb:	ff 75 10             	push   0x10(%ebp)
+  8018ee:	ff 75 0c             	push   0xc(%ebp)
+  8018f1:	50                   	push   %eax
+  8018f2:	e8 0e 01 00 00       	call   801a05 <nsipc_accept>
+  8018f7:	83 c4 10             	add    $0x10,%esp
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	78 05                	js     801903 <accept+0x2d>
+	return alloc_sockfd(r);
+  8018fe:	e8 5f ff ff ff       	call   801862 <alloc_sockfd>
+}
+  801903:	c9                   	leave
+  801904:	c3                   	ret
+
+00801905 <bind>:
+{
+  801905:	55                   	push   %ebp
+  801906:	89 e5                	mov    %esp,%ebp
+  801908:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80190b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190e:	e8 1f ff ff ff       	call   801832 <fd2sockid>
+  801913:	85 c0                	test   %eax,%eax
+  801915:	78 12                	js     801929 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801917:	83 ec 04             	sub    $0x4,%esp
+  80191a:	ff 75 10             	push   0x10(%ebp)
+  80191d:	ff 75 0c             	push   0xc(%ebp)
+  801920:	50                   	push   %eax
+  801921:	e8 31 01 00 00       	call   801a57 <nsipc_bind>
+  801926:	83 c4 10             	add    $0x10,%esp
+}
+  801929:	c9                   	leave
+  80192a:	c3                   	ret
+
+0080192b <shutdown>:
+{
+  80192b:	55                   	push   %ebp
+  80192c:	89 e5                	mov    %esp,%ebp
+  80192e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801931:	8b 45 08             	mov    0x8(%ebp),%eax
+  801934:	e8 f9 fe ff ff       	call   801832 <fd2sockid>
+  801939:	85 c0                	test   %eax,%eax
+  80193b:	78 0f                	js     80194c <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80193d:	83 ec 08             	sub    $0x8,%esp
+  801940:	ff 75 0c             	push   0xc(%ebp)
+  801943:	50                   	push   %eax
+  801944:	e8 43 01 00 00       	call   801a8c <nsipc_shutdown>
+  801949:	83 c4 10             	add    $0x10,%esp
+}
+  80194c:	c9                   	leave
+  80194d:	c3                   	ret
+
+0080194e <connect>:
+{
+  80194e:	55                   	push   %ebp
+  80194f:	89 e5                	mov    %esp,%ebp
+  801951:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801954:	8b 45 08             	mov    0x8(%ebp),%eax
+  801957:	e8 d6 fe ff ff       	call   801832 <fd2sockid>
+  80195c:	85 c0                	test   %eax,%eax
+  80195e:	78 12                	js     801972 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801960:	83 ec 04             	sub    $0x4,%esp
+  801963:	ff 75 10             	push   0x10(%ebp)
+  801966:	ff 75 0c             	push   0xc(%ebp)
+  801969:	50                   	push   %eax
+  80196a:	e8 59 01 00 00       	call   801ac8 <nsipc_connect>
+  80196f:	83 c4 10             	add    $0x10,%esp
+}
+  801972:	c9                   	leave
+  801973:	c3                   	ret
+
+00801974 <listen>:
+{
+  801974:	55                   	push   %ebp
+  801975:	89 e5                	mov    %esp,%ebp
+  801977:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80197a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80197d:	e8 b0 fe ff ff       	call   801832 <fd2sockid>
+  801982:	85 c0                	test   %eax,%eax
+  801984:	78 0f                	js     801995 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801986:	83 ec 08             	sub    $0x8,%esp
+  801989:	ff 75 0c             	push   0xc(%ebp)
+  80198c:	50                   	push   %eax
+  80198d:	e8 6b 01 00 00       	call   801afd <nsipc_listen>
+  801992:	83 c4 10             	add    $0x10,%esp
+}
+  801995:	c9                   	leave
+  801996:	c3                   	ret
+
+00801997 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801997:	55                   	push   %ebp
+  801998:	89 e5                	mov    %esp,%ebp
+  80199a:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80199d:	ff 75 10             	push   0x10(%ebp)
+  8019a0:	ff 75 0c             	push   0xc(%ebp)
+  8019a3:	ff 75 08             	push   0x8(%ebp)
+  8019a6:	e8 41 02 00 00       	call   801bec <nsipc_socket>
+  8019ab:	83 c4 10             	add    $0x10,%esp
+  8019ae:	85 c0                	test   %eax,%eax
+  8019b0:	78 05                	js     8019b7 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8019b2:	e8 ab fe ff ff       	call   801862 <alloc_sockfd>
+}
+  8019b7:	c9                   	leave
+  8019b8:	c3                   	ret
+
+008019b9 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8019b9:	55                   	push   %ebp
+  8019ba:	89 e5                	mov    %esp,%ebp
+  8019bc:	53                   	push   %ebx
+  8019bd:	83 ec 04             	sub    $0x4,%esp
+  8019c0:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8019c2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019c9:	74 26                	je     8019f1 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8019cb:	6a 07                	push   $0x7
+  8019cd:	68 00 60 80 00       	push   $0x806000
+  8019d2:	53                   	push   %ebx
+  8019d3:	ff 35 04 40 80 00    	push   0x804004
+  8019d9:	e8 b4 07 00 00       	call   802192 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8019de:	83 c4 0c             	add    $0xc,%esp
+  8019e1:	6a 00                	push   $0x0
+  8019e3:	6a 00                	push   $0x0
+  8019e5:	6a 00                	push   $0x0
+  8019e7:	e8 2e 07 00 00       	call   80211a <ipc_recv>
+}
+  8019ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ef:	c9                   	leave
+  8019f0:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8019f1:	83 ec 0c             	sub    $0xc,%esp
+  8019f4:	6a 02                	push   $0x2
+  8019f6:	e8 eb 07 00 00       	call   8021e6 <ipc_find_env>
+  8019fb:	a3 04 40 80 00       	mov    %eax,0x804004
+  801a00:	83 c4 10             	add    $0x10,%esp
+  801a03:	eb c6                	jmp    8019cb <nsipc+0x12>
+
+00801a05 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801a05:	55                   	push   %ebp
+  801a06:	89 e5                	mov    %esp,%ebp
+  801a08:	56                   	push   %esi
+  801a09:	53                   	push   %ebx
+  801a0a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a10:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801a15:	8b 06                	mov    (%esi),%eax
+  801a17:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801a1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a21:	e8 93 ff ff ff       	call   8019b9 <nsipc>
+  801a26:	89 c3                	mov    %eax,%ebx
+  801a28:	85 c0                	test   %eax,%eax
+  801a2a:	79 09                	jns    801a35 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801a2c:	89 d8                	mov    %ebx,%eax
+  801a2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a31:	5b                   	pop    %ebx
+  801a32:	5e                   	pop    %esi
+  801a33:	5d                   	pop    %ebp
+  801a34:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801a35:	83 ec 04             	sub    $0x4,%esp
+  801a38:	ff 35 10 60 80 00    	push   0x806010
+  801a3e:	68 00 60 80 00       	push   $0x806000
+  801a43:	ff 75 0c             	push   0xc(%ebp)
+  801a46:	e8 6c ee ff ff       	call   8008b7 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801a4b:	a1 10 60 80 00       	mov    0x806010,%eax
+  801a50:	89 06                	mov    %eax,(%esi)
+  801a52:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801a55:	eb d5                	jmp    801a2c <nsipc_accept+0x27>
+
+00801a57 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801a57:	55                   	push   %ebp
+  801a58:	89 e5                	mov    %esp,%ebp
+  801a5a:	53                   	push   %ebx
+  801a5b:	83 ec 08             	sub    $0x8,%esp
+  801a5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801a61:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a64:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801a69:	53                   	push   %ebx
+  801a6a:	ff 75 0c             	push   0xc(%ebp)
+  801a6d:	68 04 60 80 00       	push   $0x806004
+  801a72:	e8 40 ee ff ff       	call   8008b7 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801a77:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801a7d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a82:	e8 32 ff ff ff       	call   8019b9 <nsipc>
+}
+  801a87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a8a:	c9                   	leave
+  801a8b:	c3                   	ret
+
+00801a8c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801a8c:	55                   	push   %ebp
+  801a8d:	89 e5                	mov    %esp,%ebp
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801a92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a95:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801a9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a9d:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801aa2:	b8 03 00 00 00       	mov    $0x3,%eax
+  801aa7:	e8 0d ff ff ff       	call   8019b9 <nsipc>
+}
+  801aac:	c9                   	leave
+  801aad:	c3                   	ret
+
+00801aae <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801aae:	55                   	push   %ebp
+  801aaf:	89 e5                	mov    %esp,%ebp
+  801ab1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801ab4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab7:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801abc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ac1:	e8 f3 fe ff ff       	call   8019b9 <nsipc>
+}
+  801ac6:	c9                   	leave
+  801ac7:	c3                   	ret
+
+00801ac8 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801ac8:	55                   	push   %ebp
+  801ac9:	89 e5                	mov    %esp,%ebp
+  801acb:	53                   	push   %ebx
+  801acc:	83 ec 08             	sub    $0x8,%esp
+  801acf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad5:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801ada:	53                   	push   %ebx
+  801adb:	ff 75 0c             	push   0xc(%ebp)
+  801ade:	68 04 60 80 00       	push   $0x806004
+  801ae3:	e8 cf ed ff ff       	call   8008b7 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801ae8:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801aee:	b8 05 00 00 00       	mov    $0x5,%eax
+  801af3:	e8 c1 fe ff ff       	call   8019b9 <nsipc>
+}
+  801af8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801afb:	c9                   	leave
+  801afc:	c3                   	ret
+
+00801afd <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801afd:	55                   	push   %ebp
+  801afe:	89 e5                	mov    %esp,%ebp
+  801b00:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801b03:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b06:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801b0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b0e:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801b13:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b18:	e8 9c fe ff ff       	call   8019b9 <nsipc>
+}
+  801b1d:	c9                   	leave
+  801b1e:	c3                   	ret
+
+00801b1f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801b1f:	55                   	push   %ebp
+  801b20:	89 e5                	mov    %esp,%ebp
+  801b22:	56                   	push   %esi
+  801b23:	53                   	push   %ebx
+  801b24:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801b27:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b2a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801b2f:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801b35:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b38:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801b3d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b42:	e8 72 fe ff ff       	call   8019b9 <nsipc>
+  801b47:	89 c3                	mov    %eax,%ebx
+  801b49:	85 c0                	test   %eax,%eax
+  801b4b:	78 22                	js     801b6f <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801b4d:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801b52:	39 c6                	cmp    %eax,%esi
+  801b54:	0f 4e c6             	cmovle %esi,%eax
+  801b57:	39 c3                	cmp    %eax,%ebx
+  801b59:	7f 1d                	jg     801b78 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801b5b:	83 ec 04             	sub    $0x4,%esp
+  801b5e:	53                   	push   %ebx
+  801b5f:	68 00 60 80 00       	push   $0x806000
+  801b64:	ff 75 0c             	push   0xc(%ebp)
+  801b67:	e8 4b ed ff ff       	call   8008b7 <memmove>
+  801b6c:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801b6f:	89 d8                	mov    %ebx,%eax
+  801b71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b74:	5b                   	pop    %ebx
+  801b75:	5e                   	pop    %esi
+  801b76:	5d                   	pop    %ebp
+  801b77:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801b78:	68 bb 2a 80 00       	push   $0x802abb
+  801b7d:	68 83 2a 80 00       	push   $0x802a83
+  801b82:	6a 62                	push   $0x62
+  801b84:	68 d0 2a 80 00       	push   $0x802ad0
+  801b89:	e8 46 05 00 00       	call   8020d4 <_panic>
+
+00801b8e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801b8e:	55                   	push   %ebp
+  801b8f:	89 e5                	mov    %esp,%ebp
+  801b91:	53                   	push   %ebx
+  801b92:	83 ec 04             	sub    $0x4,%esp
+  801b95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801b98:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b9b:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801ba0:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801ba6:	7f 2e                	jg     801bd6 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801ba8:	83 ec 04             	sub    $0x4,%esp
+  801bab:	53                   	push   %ebx
+  801bac:	ff 75 0c             	push   0xc(%ebp)
+  801baf:	68 0c 60 80 00       	push   $0x80600c
+  801bb4:	e8 fe ec ff ff       	call   8008b7 <memmove>
+	nsipcbuf.send.req_size = size;
+  801bb9:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801bbf:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bc2:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801bc7:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bcc:	e8 e8 fd ff ff       	call   8019b9 <nsipc>
+}
+  801bd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd4:	c9                   	leave
+  801bd5:	c3                   	ret
+	assert(size < 1600);
+  801bd6:	68 dc 2a 80 00       	push   $0x802adc
+  801bdb:	68 83 2a 80 00       	push   $0x802a83
+  801be0:	6a 6d                	push   $0x6d
+  801be2:	68 d0 2a 80 00       	push   $0x802ad0
+  801be7:	e8 e8 04 00 00       	call   8020d4 <_panic>
+
+00801bec <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801bec:	55                   	push   %ebp
+  801bed:	89 e5                	mov    %esp,%ebp
+  801bef:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801bf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf5:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801bfa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bfd:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801c02:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c05:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801c0a:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c0f:	e8 a5 fd ff ff       	call   8019b9 <nsipc>
+}
+  801c14:	c9                   	leave
+  801c15:	c3                   	ret
+
+00801c16 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c16:	55                   	push   %ebp
+  801c17:	89 e5                	mov    %esp,%ebp
+  801c19:	56                   	push   %esi
+  801c1a:	53                   	push   %ebx
+  801c1b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801c1e:	83 ec 0c             	sub    $0xc,%esp
+  801c21:	ff 75 08             	push   0x8(%ebp)
+  801c24:	e8 aa f3 ff ff       	call   800fd3 <fd2data>
+  801c29:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801c2b:	83 c4 08             	add    $0x8,%esp
+  801c2e:	68 e8 2a 80 00       	push   $0x802ae8
+  801c33:	53                   	push   %ebx
+  801c34:	e8 f8 ea ff ff       	call   800731 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801c39:	8b 46 04             	mov    0x4(%esi),%eax
+  801c3c:	2b 06                	sub    (%esi),%eax
+  801c3e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801c44:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c4b:	00 00 00 
+	stat->st_dev = &devpipe;
+  801c4e:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801c55:	30 80 00 
+	return 0;
+}
+  801c58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c60:	5b                   	pop    %ebx
+  801c61:	5e                   	pop    %esi
+  801c62:	5d                   	pop    %ebp
+  801c63:	c3                   	ret
+
+00801c64 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801c64:	55                   	push   %ebp
+  801c65:	89 e5                	mov    %esp,%ebp
+  801c67:	53                   	push   %ebx
+  801c68:	83 ec 0c             	sub    $0xc,%esp
+  801c6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801c6e:	53                   	push   %ebx
+  801c6f:	6a 00                	push   $0x0
+  801c71:	e8 f0 ef ff ff       	call   800c66 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801c76:	89 1c 24             	mov    %ebx,(%esp)
+  801c79:	e8 55 f3 ff ff       	call   800fd3 <fd2data>
+  801c7e:	83 c4 08             	add    $0x8,%esp
+  801c81:	50                   	push   %eax
+  801c82:	6a 00                	push   $0x0
+  801c84:	e8 dd ef ff ff       	call   800c66 <sys_page_unmap>
+}
+  801c89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c8c:	c9                   	leave
+  801c8d:	c3                   	ret
+
+00801c8e <_pipeisclosed>:
+{
+  801c8e:	55                   	push   %ebp
+  801c8f:	89 e5                	mov    %esp,%ebp
+  801c91:	57                   	push   %edi
+  801c92:	56                   	push   %esi
+  801c93:	53                   	push   %ebx
+  801c94:	83 ec 1c             	sub    $0x1c,%esp
+  801c97:	89 c7                	mov    %eax,%edi
+  801c99:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801c9b:	a1 08 40 80 00       	mov    0x804008,%eax
+  801ca0:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801ca3:	83 ec 0c             	sub    $0xc,%esp
+  801ca6:	57                   	push   %edi
+  801ca7:	e8 4a 05 00 00       	call   8021f6 <pageref>
+  801cac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801caf:	89 34 24             	mov    %esi,(%esp)
+  801cb2:	e8 3f 05 00 00       	call   8021f6 <pageref>
+		nn = thisenv->env_runs;
+  801cb7:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801cbd:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801cc0:	83 c4 10             	add    $0x10,%esp
+  801cc3:	39 cb                	cmp    %ecx,%ebx
+  801cc5:	74 1b                	je     801ce2 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801cc7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801cca:	75 cf                	jne    801c9b <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801ccc:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801ccf:	6a 01                	push   $0x1
+  801cd1:	50                   	push   %eax
+  801cd2:	53                   	push   %ebx
+  801cd3:	68 ef 2a 80 00       	push   $0x802aef
+  801cd8:	e8 66 e4 ff ff       	call   800143 <cprintf>
+  801cdd:	83 c4 10             	add    $0x10,%esp
+  801ce0:	eb b9                	jmp    801c9b <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801ce2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ce5:	0f 94 c0             	sete   %al
+  801ce8:	0f b6 c0             	movzbl %al,%eax
+}
+  801ceb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cee:	5b                   	pop    %ebx
+  801cef:	5e                   	pop    %esi
+  801cf0:	5f                   	pop    %edi
+  801cf1:	5d                   	pop    %ebp
+  801cf2:	c3                   	ret
+
+00801cf3 <devpipe_write>:
+{
+  801cf3:	55                   	push   %ebp
+  801cf4:	89 e5                	mov    %esp,%ebp
+  801cf6:	57                   	push   %edi
+  801cf7:	56                   	push   %esi
+  801cf8:	53                   	push   %ebx
+  801cf9:	83 ec 28             	sub    $0x28,%esp
+  801cfc:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801cff:	56                   	push   %esi
+  801d00:	e8 ce f2 ff ff       	call   800fd3 <fd2data>
+  801d05:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d07:	83 c4 10             	add    $0x10,%esp
+  801d0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d0f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801d12:	75 09                	jne    801d1d <devpipe_write+0x2a>
+	return i;
+  801d14:	89 f8                	mov    %edi,%eax
+  801d16:	eb 23                	jmp    801d3b <devpipe_write+0x48>
+			sys_yield();
+  801d18:	e8 01 ee ff ff       	call   800b1e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801d1d:	8b 43 04             	mov    0x4(%ebx),%eax
+  801d20:	8b 0b                	mov    (%ebx),%ecx
+  801d22:	8d 51 20             	lea    0x20(%ecx),%edx
+  801d25:	39 d0                	cmp    %edx,%eax
+  801d27:	72 1a                	jb     801d43 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801d29:	89 da                	mov    %ebx,%edx
+  801d2b:	89 f0                	mov    %esi,%eax
+  801d2d:	e8 5c ff ff ff       	call   801c8e <_pipeisclosed>
+  801d32:	85 c0                	test   %eax,%eax
+  801d34:	74 e2                	je     801d18 <devpipe_write+0x25>
+				return 0;
+  801d36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d3e:	5b                   	pop    %ebx
+  801d3f:	5e                   	pop    %esi
+  801d40:	5f                   	pop    %edi
+  801d41:	5d                   	pop    %ebp
+  801d42:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d46:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801d4a:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801d4d:	89 c2                	mov    %eax,%edx
+  801d4f:	c1 fa 1f             	sar    $0x1f,%edx
+  801d52:	89 d1                	mov    %edx,%ecx
+  801d54:	c1 e9 1b             	shr    $0x1b,%ecx
+  801d57:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801d5a:	83 e2 1f             	and    $0x1f,%edx
+  801d5d:	29 ca                	sub    %ecx,%edx
+  801d5f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801d63:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801d67:	83 c0 01             	add    $0x1,%eax
+  801d6a:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801d6d:	83 c7 01             	add    $0x1,%edi
+  801d70:	eb 9d                	jmp    801d0f <devpipe_write+0x1c>
+
+00801d72 <devpipe_read>:
+{
+  801d72:	55                   	push   %ebp
+  801d73:	89 e5                	mov    %esp,%ebp
+  801d75:	57                   	push   %edi
+  801d76:	56                   	push   %esi
+  801d77:	53                   	push   %ebx
+  801d78:	83 ec 18             	sub    $0x18,%esp
+  801d7b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801d7e:	57                   	push   %edi
+  801d7f:	e8 4f f2 ff ff       	call   800fd3 <fd2data>
+  801d84:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d86:	83 c4 10             	add    $0x10,%esp
+  801d89:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801d91:	75 13                	jne    801da6 <devpipe_read+0x34>
+	return i;
+  801d93:	89 f0                	mov    %esi,%eax
+  801d95:	eb 02                	jmp    801d99 <devpipe_read+0x27>
+				return i;
+  801d97:	89 f0                	mov    %esi,%eax
+}
+  801d99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d9c:	5b                   	pop    %ebx
+  801d9d:	5e                   	pop    %esi
+  801d9e:	5f                   	pop    %edi
+  801d9f:	5d                   	pop    %ebp
+  801da0:	c3                   	ret
+			sys_yield();
+  801da1:	e8 78 ed ff ff       	call   800b1e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801da6:	8b 03                	mov    (%ebx),%eax
+  801da8:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801dab:	75 18                	jne    801dc5 <devpipe_read+0x53>
+			if (i > 0)
+  801dad:	85 f6                	test   %esi,%esi
+  801daf:	75 e6                	jne    801d97 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801db1:	89 da                	mov    %ebx,%edx
+  801db3:	89 f8                	mov    %edi,%eax
+  801db5:	e8 d4 fe ff ff       	call   801c8e <_pipeisclosed>
+  801dba:	85 c0                	test   %eax,%eax
+  801dbc:	74 e3                	je     801da1 <devpipe_read+0x2f>
+				return 0;
+  801dbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc3:	eb d4                	jmp    801d99 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801dc5:	99                   	cltd
+  801dc6:	c1 ea 1b             	shr    $0x1b,%edx
+  801dc9:	01 d0                	add    %edx,%eax
+  801dcb:	83 e0 1f             	and    $0x1f,%eax
+  801dce:	29 d0                	sub    %edx,%eax
+  801dd0:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801dd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dd8:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801ddb:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801dde:	83 c6 01             	add    $0x1,%esi
+  801de1:	eb ab                	jmp    801d8e <devpipe_read+0x1c>
+
+00801de3 <pipe>:
+{
+  801de3:	55                   	push   %ebp
+  801de4:	89 e5                	mov    %esp,%ebp
+  801de6:	56                   	push   %esi
+  801de7:	53                   	push   %ebx
+  801de8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801deb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dee:	50                   	push   %eax
+  801def:	e8 f6 f1 ff ff       	call   800fea <fd_alloc>
+  801df4:	89 c3                	mov    %eax,%ebx
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	85 c0                	test   %eax,%eax
+  801dfb:	0f 88 23 01 00 00    	js     801f24 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e01:	83 ec 04             	sub    $0x4,%esp
+  801e04:	68 07 04 00 00       	push   $0x407
+  801e09:	ff 75 f4             	push   -0xc(%ebp)
+  801e0c:	6a 00                	push   $0x0
+  801e0e:	e8 8b ed ff ff       	call   800b9e <sys_page_alloc>
+  801e13:	89 c3                	mov    %eax,%ebx
+  801e15:	83 c4 10             	add    $0x10,%esp
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	0f 88 04 01 00 00    	js     801f24 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801e20:	83 ec 0c             	sub    $0xc,%esp
+  801e23:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e26:	50                   	push   %eax
+  801e27:	e8 be f1 ff ff       	call   800fea <fd_alloc>
+  801e2c:	89 c3                	mov    %eax,%ebx
+  801e2e:	83 c4 10             	add    $0x10,%esp
+  801e31:	85 c0                	test   %eax,%eax
+  801e33:	0f 88 db 00 00 00    	js     801f14 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e39:	83 ec 04             	sub    $0x4,%esp
+  801e3c:	68 07 04 00 00       	push   $0x407
+  801e41:	ff 75 f0             	push   -0x10(%ebp)
+  801e44:	6a 00                	push   $0x0
+  801e46:	e8 53 ed ff ff       	call   800b9e <sys_page_alloc>
+  801e4b:	89 c3                	mov    %eax,%ebx
+  801e4d:	83 c4 10             	add    $0x10,%esp
+  801e50:	85 c0                	test   %eax,%eax
+  801e52:	0f 88 bc 00 00 00    	js     801f14 <pipe+0x131>
+	va = fd2data(fd0);
+  801e58:	83 ec 0c             	sub    $0xc,%esp
+  801e5b:	ff 75 f4             	push   -0xc(%ebp)
+  801e5e:	e8 70 f1 ff ff       	call   800fd3 <fd2data>
+  801e63:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e65:	83 c4 0c             	add    $0xc,%esp
+  801e68:	68 07 04 00 00       	push   $0x407
+  801e6d:	50                   	push   %eax
+  801e6e:	6a 00                	push   $0x0
+  801e70:	e8 29 ed ff ff       	call   800b9e <sys_page_alloc>
+  801e75:	89 c3                	mov    %eax,%ebx
+  801e77:	83 c4 10             	add    $0x10,%esp
+  801e7a:	85 c0                	test   %eax,%eax
+  801e7c:	0f 88 82 00 00 00    	js     801f04 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e82:	83 ec 0c             	sub    $0xc,%esp
+  801e85:	ff 75 f0             	push   -0x10(%ebp)
+  801e88:	e8 46 f1 ff ff       	call   800fd3 <fd2data>
+  801e8d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801e94:	50                   	push   %eax
+  801e95:	6a 00                	push   $0x0
+  801e97:	56                   	push   %esi
+  801e98:	6a 00                	push   $0x0
+  801e9a:	e8 85 ed ff ff       	call   800c24 <sys_page_map>
+  801e9f:	89 c3                	mov    %eax,%ebx
+  801ea1:	83 c4 20             	add    $0x20,%esp
+  801ea4:	85 c0                	test   %eax,%eax
+  801ea6:	78 4e                	js     801ef6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801ea8:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801ead:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801eb0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801eb2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801eb5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801ebc:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801ebf:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801ec1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801ec4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801ecb:	83 ec 0c             	sub    $0xc,%esp
+  801ece:	ff 75 f4             	push   -0xc(%ebp)
+  801ed1:	e8 ed f0 ff ff       	call   800fc3 <fd2num>
+  801ed6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ed9:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801edb:	83 c4 04             	add    $0x4,%esp
+  801ede:	ff 75 f0             	push   -0x10(%ebp)
+  801ee1:	e8 dd f0 ff ff       	call   800fc3 <fd2num>
+  801ee6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ee9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801eec:	83 c4 10             	add    $0x10,%esp
+  801eef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ef4:	eb 2e                	jmp    801f24 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801ef6:	83 ec 08             	sub    $0x8,%esp
+  801ef9:	56                   	push   %esi
+  801efa:	6a 00                	push   $0x0
+  801efc:	e8 65 ed ff ff       	call   800c66 <sys_page_unmap>
+  801f01:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801f04:	83 ec 08             	sub    $0x8,%esp
+  801f07:	ff 75 f0             	push   -0x10(%ebp)
+  801f0a:	6a 00                	push   $0x0
+  801f0c:	e8 55 ed ff ff       	call   800c66 <sys_page_unmap>
+  801f11:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801f14:	83 ec 08             	sub    $0x8,%esp
+  801f17:	ff 75 f4             	push   -0xc(%ebp)
+  801f1a:	6a 00                	push   $0x0
+  801f1c:	e8 45 ed ff ff       	call   800c66 <sys_page_unmap>
+  801f21:	83 c4 10             	add    $0x10,%esp
+}
+  801f24:	89 d8                	mov    %ebx,%eax
+  801f26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f29:	5b                   	pop    %ebx
+  801f2a:	5e                   	pop    %esi
+  801f2b:	5d                   	pop    %ebp
+  801f2c:	c3                   	ret
+
+00801f2d <pipeisclosed>:
+{
+  801f2d:	55                   	push   %ebp
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f33:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f36:	50                   	push   %eax
+  801f37:	ff 75 08             	push   0x8(%ebp)
+  801f3a:	e8 01 f1 ff ff       	call   801040 <fd_lookup>
+  801f3f:	83 c4 10             	add    $0x10,%esp
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	78 18                	js     801f5e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801f46:	83 ec 0c             	sub    $0xc,%esp
+  801f49:	ff 75 f4             	push   -0xc(%ebp)
+  801f4c:	e8 82 f0 ff ff       	call   800fd3 <fd2data>
+  801f51:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801f53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f56:	e8 33 fd ff ff       	call   801c8e <_pipeisclosed>
+  801f5b:	83 c4 10             	add    $0x10,%esp
+}
+  801f5e:	c9                   	leave
+  801f5f:	c3                   	ret
+
+00801f60 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801f60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f65:	c3                   	ret
+
+00801f66 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f66:	55                   	push   %ebp
+  801f67:	89 e5                	mov    %esp,%ebp
+  801f69:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801f6c:	68 07 2b 80 00       	push   $0x802b07
+  801f71:	ff 75 0c             	push   0xc(%ebp)
+  801f74:	e8 b8 e7 ff ff       	call   800731 <strcpy>
+	return 0;
+}
+  801f79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7e:	c9                   	leave
+  801f7f:	c3                   	ret
+
+00801f80 <devcons_write>:
+{
+  801f80:	55                   	push   %ebp
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	57                   	push   %edi
+  801f84:	56                   	push   %esi
+  801f85:	53                   	push   %ebx
+  801f86:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801f8c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801f91:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801f97:	eb 2e                	jmp    801fc7 <devcons_write+0x47>
+		m = n - tot;
+  801f99:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f9c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801f9e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801fa3:	39 c3                	cmp    %eax,%ebx
+  801fa5:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801fa8:	83 ec 04             	sub    $0x4,%esp
+  801fab:	53                   	push   %ebx
+  801fac:	89 f0                	mov    %esi,%eax
+  801fae:	03 45 0c             	add    0xc(%ebp),%eax
+  801fb1:	50                   	push   %eax
+  801fb2:	57                   	push   %edi
+  801fb3:	e8 ff e8 ff ff       	call   8008b7 <memmove>
+		sys_cputs(buf, m);
+  801fb8:	83 c4 08             	add    $0x8,%esp
+  801fbb:	53                   	push   %ebx
+  801fbc:	57                   	push   %edi
+  801fbd:	e8 9f ea ff ff       	call   800a61 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801fc2:	01 de                	add    %ebx,%esi
+  801fc4:	83 c4 10             	add    $0x10,%esp
+  801fc7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801fca:	72 cd                	jb     801f99 <devcons_write+0x19>
+}
+  801fcc:	89 f0                	mov    %esi,%eax
+  801fce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fd1:	5b                   	pop    %ebx
+  801fd2:	5e                   	pop    %esi
+  801fd3:	5f                   	pop    %edi
+  801fd4:	5d                   	pop    %ebp
+  801fd5:	c3                   	ret
+
+00801fd6 <devcons_read>:
+{
+  801fd6:	55                   	push   %ebp
+  801fd7:	89 e5                	mov    %esp,%ebp
+  801fd9:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801fe5:	75 07                	jne    801fee <devcons_read+0x18>
+  801fe7:	eb 1f                	jmp    802008 <devcons_read+0x32>
+		sys_yield();
+  801fe9:	e8 30 eb ff ff       	call   800b1e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801fee:	e8 8c ea ff ff       	call   800a7f <sys_cgetc>
+  801ff3:	85 c0                	test   %eax,%eax
+  801ff5:	74 f2                	je     801fe9 <devcons_read+0x13>
+	if (c < 0)
+  801ff7:	78 0f                	js     802008 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801ff9:	83 f8 04             	cmp    $0x4,%eax
+  801ffc:	74 0c                	je     80200a <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801ffe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802001:	88 02                	mov    %al,(%edx)
+	return 1;
+  802003:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802008:	c9                   	leave
+  802009:	c3                   	ret
+		return 0;
+  80200a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200f:	eb f7                	jmp    802008 <devcons_read+0x32>
+
+00802011 <cputchar>:
+{
+  802011:	55                   	push   %ebp
+  802012:	89 e5                	mov    %esp,%ebp
+  802014:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802017:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80201d:	6a 01                	push   $0x1
+  80201f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802022:	50                   	push   %eax
+  802023:	e8 39 ea ff ff       	call   800a61 <sys_cputs>
+}
+  802028:	83 c4 10             	add    $0x10,%esp
+  80202b:	c9                   	leave
+  80202c:	c3                   	ret
+
+0080202d <getchar>:
+{
+  80202d:	55                   	push   %ebp
+  80202e:	89 e5                	mov    %esp,%ebp
+  802030:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802033:	6a 01                	push   $0x1
+  802035:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802038:	50                   	push   %eax
+  802039:	6a 00                	push   $0x0
+  80203b:	e8 66 f2 ff ff       	call   8012a6 <read>
+	if (r < 0)
+  802040:	83 c4 10             	add    $0x10,%esp
+  802043:	85 c0                	test   %eax,%eax
+  802045:	78 06                	js     80204d <getchar+0x20>
+	if (r < 1)
+  802047:	74 06                	je     80204f <getchar+0x22>
+	return c;
+  802049:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80204d:	c9                   	leave
+  80204e:	c3                   	ret
+		return -E_EOF;
+  80204f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802054:	eb f7                	jmp    80204d <getchar+0x20>
+
+00802056 <iscons>:
+{
+  802056:	55                   	push   %ebp
+  802057:	89 e5                	mov    %esp,%ebp
+  802059:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80205c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80205f:	50                   	push   %eax
+  802060:	ff 75 08             	push   0x8(%ebp)
+  802063:	e8 d8 ef ff ff       	call   801040 <fd_lookup>
+  802068:	83 c4 10             	add    $0x10,%esp
+  80206b:	85 c0                	test   %eax,%eax
+  80206d:	78 11                	js     802080 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80206f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802072:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802078:	39 10                	cmp    %edx,(%eax)
+  80207a:	0f 94 c0             	sete   %al
+  80207d:	0f b6 c0             	movzbl %al,%eax
+}
+  802080:	c9                   	leave
+  802081:	c3                   	ret
+
+00802082 <opencons>:
+{
+  802082:	55                   	push   %ebp
+  802083:	89 e5                	mov    %esp,%ebp
+  802085:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802088:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80208b:	50                   	push   %eax
+  80208c:	e8 59 ef ff ff       	call   800fea <fd_alloc>
+  802091:	83 c4 10             	add    $0x10,%esp
+  802094:	85 c0                	test   %eax,%eax
+  802096:	78 3a                	js     8020d2 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802098:	83 ec 04             	sub    $0x4,%esp
+  80209b:	68 07 04 00 00       	push   $0x407
+  8020a0:	ff 75 f4             	push   -0xc(%ebp)
+  8020a3:	6a 00                	push   $0x0
+  8020a5:	e8 f4 ea ff ff       	call   800b9e <sys_page_alloc>
+  8020aa:	83 c4 10             	add    $0x10,%esp
+  8020ad:	85 c0                	test   %eax,%eax
+  8020af:	78 21                	js     8020d2 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8020b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020b4:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8020ba:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8020bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020bf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8020c6:	83 ec 0c             	sub    $0xc,%esp
+  8020c9:	50                   	push   %eax
+  8020ca:	e8 f4 ee ff ff       	call   800fc3 <fd2num>
+  8020cf:	83 c4 10             	add    $0x10,%esp
+}
+  8020d2:	c9                   	leave
+  8020d3:	c3                   	ret
+
+008020d4 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8020d4:	55                   	push   %ebp
+  8020d5:	89 e5                	mov    %esp,%ebp
+  8020d7:	56                   	push   %esi
+  8020d8:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8020d9:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8020dc:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8020e2:	e8 18 ea ff ff       	call   800aff <sys_getenvid>
+  8020e7:	83 ec 0c             	sub    $0xc,%esp
+  8020ea:	ff 75 0c             	push   0xc(%ebp)
+  8020ed:	ff 75 08             	push   0x8(%ebp)
+  8020f0:	56                   	push   %esi
+  8020f1:	50                   	push   %eax
+  8020f2:	68 14 2b 80 00       	push   $0x802b14
+  8020f7:	e8 47 e0 ff ff       	call   800143 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8020fc:	83 c4 18             	add    $0x18,%esp
+  8020ff:	53                   	push   %ebx
+  802100:	ff 75 10             	push   0x10(%ebp)
+  802103:	e8 ea df ff ff       	call   8000f2 <vcprintf>
+	cprintf("\n");
+  802108:	c7 04 24 00 2b 80 00 	movl   $0x802b00,(%esp)
+  80210f:	e8 2f e0 ff ff       	call   800143 <cprintf>
+  802114:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802117:	cc                   	int3
+	while (1)
+  802118:	eb fd                	jmp    802117 <_panic+0x43>
+
+0080211a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80211a:	55                   	push   %ebp
+  80211b:	89 e5                	mov    %esp,%ebp
+  80211d:	57                   	push   %edi
+  80211e:	56                   	push   %esi
+  80211f:	53                   	push   %ebx
+  802120:	83 ec 18             	sub    $0x18,%esp
+  802123:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802126:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802129:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80212c:	85 db                	test   %ebx,%ebx
+  80212e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802133:	0f 45 c3             	cmovne %ebx,%eax
+  802136:	50                   	push   %eax
+  802137:	e8 e5 ed ff ff       	call   800f21 <sys_ipc_recv>
+
+	if (from_env_store)
+  80213c:	83 c4 10             	add    $0x10,%esp
+  80213f:	85 ff                	test   %edi,%edi
+  802141:	74 17                	je     80215a <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802143:	ba 00 00 00 00       	mov    $0x0,%edx
+  802148:	85 c0                	test   %eax,%eax
+  80214a:	75 0c                	jne    802158 <ipc_recv+0x3e>
+  80214c:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802152:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802158:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  80215a:	85 f6                	test   %esi,%esi
+  80215c:	74 2e                	je     80218c <ipc_recv+0x72>
+		if (!r && pg)
+  80215e:	85 c0                	test   %eax,%eax
+  802160:	75 24                	jne    802186 <ipc_recv+0x6c>
+  802162:	85 db                	test   %ebx,%ebx
+  802164:	74 20                	je     802186 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802166:	a1 08 40 80 00       	mov    0x804008,%eax
+  80216b:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802171:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802173:	a1 08 40 80 00       	mov    0x804008,%eax
+  802178:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80217e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802181:	5b                   	pop    %ebx
+  802182:	5e                   	pop    %esi
+  802183:	5f                   	pop    %edi
+  802184:	5d                   	pop    %ebp
+  802185:	c3                   	ret
+			*perm_store = 0;
+  802186:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80218c:	85 c0                	test   %eax,%eax
+  80218e:	75 ee                	jne    80217e <ipc_recv+0x64>
+  802190:	eb e1                	jmp    802173 <ipc_recv+0x59>
+
+00802192 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802192:	55                   	push   %ebp
+  802193:	89 e5                	mov    %esp,%ebp
+  802195:	57                   	push   %edi
+  802196:	56                   	push   %esi
+  802197:	53                   	push   %ebx
+  802198:	83 ec 0c             	sub    $0xc,%esp
+  80219b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80219e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8021a4:	85 db                	test   %ebx,%ebx
+  8021a6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021ab:	0f 44 d8             	cmove  %eax,%ebx
+  8021ae:	ff 75 14             	push   0x14(%ebp)
+  8021b1:	53                   	push   %ebx
+  8021b2:	56                   	push   %esi
+  8021b3:	57                   	push   %edi
+  8021b4:	e8 45 ed ff ff       	call   800efe <sys_ipc_try_send_yield>
+  8021b9:	83 c4 10             	add    $0x10,%esp
+  8021bc:	85 c0                	test   %eax,%eax
+  8021be:	79 1e                	jns    8021de <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8021c0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021c3:	75 07                	jne    8021cc <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8021c5:	e8 54 e9 ff ff       	call   800b1e <sys_yield>
+  8021ca:	eb e2                	jmp    8021ae <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8021cc:	50                   	push   %eax
+  8021cd:	68 37 2b 80 00       	push   $0x802b37
+  8021d2:	6a 3d                	push   $0x3d
+  8021d4:	68 4c 2b 80 00       	push   $0x802b4c
+  8021d9:	e8 f6 fe ff ff       	call   8020d4 <_panic>
+	}
+}
+  8021de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021e1:	5b                   	pop    %ebx
+  8021e2:	5e                   	pop    %esi
+  8021e3:	5f                   	pop    %edi
+  8021e4:	5d                   	pop    %ebp
+  8021e5:	c3                   	ret
+
+008021e6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8021e6:	55                   	push   %ebp
+  8021e7:	89 e5                	mov    %esp,%ebp
+  8021e9:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8021ec:	ff 75 08             	push   0x8(%ebp)
+  8021ef:	e8 aa e8 ff ff       	call   800a9e <sys_env_find>
+}
+  8021f4:	c9                   	leave
+  8021f5:	c3                   	ret
+
+008021f6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8021f6:	55                   	push   %ebp
+  8021f7:	89 e5                	mov    %esp,%ebp
+  8021f9:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021fc:	89 c2                	mov    %eax,%edx
+  8021fe:	c1 ea 16             	shr    $0x16,%edx
+  802201:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802208:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80220d:	f6 c1 01             	test   $0x1,%cl
+  802210:	74 22                	je     802234 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802212:	c1 e8 0c             	shr    $0xc,%eax
+  802215:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80221c:	a8 01                	test   $0x1,%al
+  80221e:	74 14                	je     802234 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802220:	c1 e8 0c             	shr    $0xc,%eax
+  802223:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802226:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80222d:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802231:	0f b7 d2             	movzwl %dx,%edx
+}
+  802234:	89 d0                	mov    %edx,%eax
+  802236:	5d                   	pop    %ebp
+  802237:	c3                   	ret
+  802238:	66 90                	xchg   %ax,%ax
+  80223a:	66 90                	xchg   %ax,%ax
+  80223c:	66 90                	xchg   %ax,%ax
+  80223e:	66 90                	xchg   %ax,%ax
+
+00802240 <__udivmoddi4>:
+  802240:	55                   	push   %ebp
+  802241:	57                   	push   %edi
+  802242:	56                   	push   %esi
+  802243:	53                   	push   %ebx
+  802244:	83 ec 14             	sub    $0x14,%esp
+  802247:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80224b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80224f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802253:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802257:	89 f1                	mov    %esi,%ecx
+  802259:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80225d:	09 d9                	or     %ebx,%ecx
+  80225f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802263:	0f 84 92 00 00 00    	je     8022fb <__udivmoddi4+0xbb>
+  802269:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802270:	00 
+  802271:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802276:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80227d:	00 
+  80227e:	89 1c 24             	mov    %ebx,(%esp)
+  802281:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802285:	8d 76 00             	lea    0x0(%esi),%esi
+  802288:	89 e9                	mov    %ebp,%ecx
+  80228a:	89 c3                	mov    %eax,%ebx
+  80228c:	89 d6                	mov    %edx,%esi
+  80228e:	31 ff                	xor    %edi,%edi
+  802290:	d3 ee                	shr    %cl,%esi
+  802292:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802295:	f6 c1 20             	test   $0x20,%cl
+  802298:	0f 45 de             	cmovne %esi,%ebx
+  80229b:	0f 45 f7             	cmovne %edi,%esi
+  80229e:	8b 3c 24             	mov    (%esp),%edi
+  8022a1:	39 fb                	cmp    %edi,%ebx
+  8022a3:	89 f7                	mov    %esi,%edi
+  8022a5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8022a9:	8b 1c 24             	mov    (%esp),%ebx
+  8022ac:	19 f7                	sbb    %esi,%edi
+  8022ae:	72 39                	jb     8022e9 <__udivmoddi4+0xa9>
+  8022b0:	89 e9                	mov    %ebp,%ecx
+  8022b2:	89 f7                	mov    %esi,%edi
+  8022b4:	89 de                	mov    %ebx,%esi
+  8022b6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8022b9:	d3 e6                	shl    %cl,%esi
+  8022bb:	31 db                	xor    %ebx,%ebx
+  8022bd:	f6 c1 20             	test   $0x20,%cl
+  8022c0:	0f 45 fe             	cmovne %esi,%edi
+  8022c3:	0f 45 f3             	cmovne %ebx,%esi
+  8022c6:	29 f0                	sub    %esi,%eax
+  8022c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022cd:	19 fa                	sbb    %edi,%edx
+  8022cf:	31 ff                	xor    %edi,%edi
+  8022d1:	31 db                	xor    %ebx,%ebx
+  8022d3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8022d6:	d3 e6                	shl    %cl,%esi
+  8022d8:	f6 c1 20             	test   $0x20,%cl
+  8022db:	0f 45 fe             	cmovne %esi,%edi
+  8022de:	0f 45 f3             	cmovne %ebx,%esi
+  8022e1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8022e5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8022e9:	83 ed 01             	sub    $0x1,%ebp
+  8022ec:	73 9a                	jae    802288 <__udivmoddi4+0x48>
+  8022ee:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8022f2:	85 ff                	test   %edi,%edi
+  8022f4:	74 05                	je     8022fb <__udivmoddi4+0xbb>
+  8022f6:	89 07                	mov    %eax,(%edi)
+  8022f8:	89 57 04             	mov    %edx,0x4(%edi)
+  8022fb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022ff:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802303:	83 c4 14             	add    $0x14,%esp
+  802306:	5b                   	pop    %ebx
+  802307:	5e                   	pop    %esi
+  802308:	5f                   	pop    %edi
+  802309:	5d                   	pop    %ebp
+  80230a:	c3                   	ret
+  80230b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80230f:	90                   	nop
+
+00802310 <__udivdi3>:
+  802310:	55                   	push   %ebp
+  802311:	57                   	push   %edi
+  802312:	56                   	push   %esi
+  802313:	53                   	push   %ebx
+  802314:	83 ec 14             	sub    $0x14,%esp
+  802317:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80231b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80231f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802323:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802327:	89 fb                	mov    %edi,%ebx
+  802329:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80232d:	09 f3                	or     %esi,%ebx
+  80232f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802333:	0f 84 85 00 00 00    	je     8023be <__udivdi3+0xae>
+  802339:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802340:	00 
+  802341:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802346:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80234d:	00 
+  80234e:	89 34 24             	mov    %esi,(%esp)
+  802351:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802355:	8d 76 00             	lea    0x0(%esi),%esi
+  802358:	89 e9                	mov    %ebp,%ecx
+  80235a:	89 c3                	mov    %eax,%ebx
+  80235c:	89 d6                	mov    %edx,%esi
+  80235e:	31 ff                	xor    %edi,%edi
+  802360:	d3 ee                	shr    %cl,%esi
+  802362:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802365:	f6 c1 20             	test   $0x20,%cl
+  802368:	0f 45 de             	cmovne %esi,%ebx
+  80236b:	0f 45 f7             	cmovne %edi,%esi
+  80236e:	8b 3c 24             	mov    (%esp),%edi
+  802371:	39 fb                	cmp    %edi,%ebx
+  802373:	89 f7                	mov    %esi,%edi
+  802375:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802379:	8b 1c 24             	mov    (%esp),%ebx
+  80237c:	19 f7                	sbb    %esi,%edi
+  80237e:	72 39                	jb     8023b9 <__udivdi3+0xa9>
+  802380:	89 e9                	mov    %ebp,%ecx
+  802382:	89 f7                	mov    %esi,%edi
+  802384:	89 de                	mov    %ebx,%esi
+  802386:	0f a5 df             	shld   %cl,%ebx,%edi
+  802389:	d3 e6                	shl    %cl,%esi
+  80238b:	31 db                	xor    %ebx,%ebx
+  80238d:	f6 c1 20             	test   $0x20,%cl
+  802390:	0f 45 fe             	cmovne %esi,%edi
+  802393:	0f 45 f3             	cmovne %ebx,%esi
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	be 01 00 00 00       	mov    $0x1,%esi
+  80239d:	19 fa                	sbb    %edi,%edx
+  80239f:	31 ff                	xor    %edi,%edi
+  8023a1:	31 db                	xor    %ebx,%ebx
+  8023a3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023a6:	d3 e6                	shl    %cl,%esi
+  8023a8:	f6 c1 20             	test   $0x20,%cl
+  8023ab:	0f 45 fe             	cmovne %esi,%edi
+  8023ae:	0f 45 f3             	cmovne %ebx,%esi
+  8023b1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023b5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023b9:	83 ed 01             	sub    $0x1,%ebp
+  8023bc:	73 9a                	jae    802358 <__udivdi3+0x48>
+  8023be:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023c2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023c6:	83 c4 14             	add    $0x14,%esp
+  8023c9:	5b                   	pop    %ebx
+  8023ca:	5e                   	pop    %esi
+  8023cb:	5f                   	pop    %edi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+  8023ce:	66 90                	xchg   %ax,%ax
+
+008023d0 <__umoddi3>:
+  8023d0:	57                   	push   %edi
+  8023d1:	56                   	push   %esi
+  8023d2:	53                   	push   %ebx
+  8023d3:	83 ec 08             	sub    $0x8,%esp
+  8023d6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8023da:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8023de:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023e2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023e6:	89 f9                	mov    %edi,%ecx
+  8023e8:	89 34 24             	mov    %esi,(%esp)
+  8023eb:	09 f1                	or     %esi,%ecx
+  8023ed:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023f1:	74 53                	je     802446 <__umoddi3+0x76>
+  8023f3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023ff:	90                   	nop
+  802400:	89 c6                	mov    %eax,%esi
+  802402:	89 d7                	mov    %edx,%edi
+  802404:	31 db                	xor    %ebx,%ebx
+  802406:	d3 ef                	shr    %cl,%edi
+  802408:	0f ad d6             	shrd   %cl,%edx,%esi
+  80240b:	f6 c1 20             	test   $0x20,%cl
+  80240e:	0f 45 f7             	cmovne %edi,%esi
+  802411:	0f 45 fb             	cmovne %ebx,%edi
+  802414:	8b 1c 24             	mov    (%esp),%ebx
+  802417:	39 de                	cmp    %ebx,%esi
+  802419:	89 fb                	mov    %edi,%ebx
+  80241b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80241f:	8b 34 24             	mov    (%esp),%esi
+  802422:	19 fb                	sbb    %edi,%ebx
+  802424:	72 14                	jb     80243a <__umoddi3+0x6a>
+  802426:	0f a5 f7             	shld   %cl,%esi,%edi
+  802429:	31 db                	xor    %ebx,%ebx
+  80242b:	d3 e6                	shl    %cl,%esi
+  80242d:	f6 c1 20             	test   $0x20,%cl
+  802430:	0f 45 fe             	cmovne %esi,%edi
+  802433:	0f 45 f3             	cmovne %ebx,%esi
+  802436:	29 f0                	sub    %esi,%eax
+  802438:	19 fa                	sbb    %edi,%edx
+  80243a:	83 e9 01             	sub    $0x1,%ecx
+  80243d:	73 c1                	jae    802400 <__umoddi3+0x30>
+  80243f:	83 c4 08             	add    $0x8,%esp
+  802442:	5b                   	pop    %ebx
+  802443:	5e                   	pop    %esi
+  802444:	5f                   	pop    %edi
+  802445:	c3                   	ret
+  802446:	83 c4 08             	add    $0x8,%esp
+  802449:	31 c0                	xor    %eax,%eax
+  80244b:	31 d2                	xor    %edx,%edx
+  80244d:	5b                   	pop    %ebx
+  80244e:	5e                   	pop    %esi
+  80244f:	5f                   	pop    %edi
+  802450:	c3                   	ret
+  802451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80245f:	90                   	nop
+
+00802460 <__divdi3>:
+  802460:	55                   	push   %ebp
+  802461:	57                   	push   %edi
+  802462:	56                   	push   %esi
+  802463:	53                   	push   %ebx
+  802464:	83 ec 1c             	sub    $0x1c,%esp
+  802467:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80246b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80246f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802473:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802477:	85 ff                	test   %edi,%edi
+  802479:	0f 88 da 00 00 00    	js     802559 <__divdi3+0xf9>
+  80247f:	85 db                	test   %ebx,%ebx
+  802481:	78 16                	js     802499 <__divdi3+0x39>
+  802483:	89 dd                	mov    %ebx,%ebp
+  802485:	89 c8                	mov    %ecx,%eax
+  802487:	89 da                	mov    %ebx,%edx
+  802489:	09 cd                	or     %ecx,%ebp
+  80248b:	0f 85 fd 00 00 00    	jne    80258e <__divdi3+0x12e>
+  802491:	83 c4 1c             	add    $0x1c,%esp
+  802494:	5b                   	pop    %ebx
+  802495:	5e                   	pop    %esi
+  802496:	5f                   	pop    %edi
+  802497:	5d                   	pop    %ebp
+  802498:	c3                   	ret
+  802499:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80249e:	f7 d9                	neg    %ecx
+  8024a0:	89 f0                	mov    %esi,%eax
+  8024a2:	89 fa                	mov    %edi,%edx
+  8024a4:	83 d3 00             	adc    $0x0,%ebx
+  8024a7:	89 0c 24             	mov    %ecx,(%esp)
+  8024aa:	f7 db                	neg    %ebx
+  8024ac:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8024b0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024b7:	00 
+  8024b8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024bd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024c4:	00 
+  8024c5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024c9:	89 cd                	mov    %ecx,%ebp
+  8024cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024cf:	90                   	nop
+  8024d0:	89 e9                	mov    %ebp,%ecx
+  8024d2:	89 c3                	mov    %eax,%ebx
+  8024d4:	89 d6                	mov    %edx,%esi
+  8024d6:	31 ff                	xor    %edi,%edi
+  8024d8:	d3 ee                	shr    %cl,%esi
+  8024da:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024dd:	f6 c1 20             	test   $0x20,%cl
+  8024e0:	0f 45 de             	cmovne %esi,%ebx
+  8024e3:	0f 45 f7             	cmovne %edi,%esi
+  8024e6:	8b 3c 24             	mov    (%esp),%edi
+  8024e9:	39 fb                	cmp    %edi,%ebx
+  8024eb:	89 f7                	mov    %esi,%edi
+  8024ed:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8024f1:	8b 1c 24             	mov    (%esp),%ebx
+  8024f4:	19 f7                	sbb    %esi,%edi
+  8024f6:	72 39                	jb     802531 <__divdi3+0xd1>
+  8024f8:	89 e9                	mov    %ebp,%ecx
+  8024fa:	89 f7                	mov    %esi,%edi
+  8024fc:	89 de                	mov    %ebx,%esi
+  8024fe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802501:	d3 e6                	shl    %cl,%esi
+  802503:	31 db                	xor    %ebx,%ebx
+  802505:	f6 c1 20             	test   $0x20,%cl
+  802508:	0f 45 fe             	cmovne %esi,%edi
+  80250b:	0f 45 f3             	cmovne %ebx,%esi
+  80250e:	29 f0                	sub    %esi,%eax
+  802510:	be 01 00 00 00       	mov    $0x1,%esi
+  802515:	19 fa                	sbb    %edi,%edx
+  802517:	31 ff                	xor    %edi,%edi
+  802519:	31 db                	xor    %ebx,%ebx
+  80251b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80251e:	d3 e6                	shl    %cl,%esi
+  802520:	f6 c1 20             	test   $0x20,%cl
+  802523:	0f 45 fe             	cmovne %esi,%edi
+  802526:	0f 45 f3             	cmovne %ebx,%esi
+  802529:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80252d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802531:	83 ed 01             	sub    $0x1,%ebp
+  802534:	73 9a                	jae    8024d0 <__divdi3+0x70>
+  802536:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80253a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80253e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802542:	85 ed                	test   %ebp,%ebp
+  802544:	0f 84 47 ff ff ff    	je     802491 <__divdi3+0x31>
+  80254a:	f7 d8                	neg    %eax
+  80254c:	83 d2 00             	adc    $0x0,%edx
+  80254f:	83 c4 1c             	add    $0x1c,%esp
+  802552:	5b                   	pop    %ebx
+  802553:	f7 da                	neg    %edx
+  802555:	5e                   	pop    %esi
+  802556:	5f                   	pop    %edi
+  802557:	5d                   	pop    %ebp
+  802558:	c3                   	ret
+  802559:	f7 de                	neg    %esi
+  80255b:	83 d7 00             	adc    $0x0,%edi
+  80255e:	f7 df                	neg    %edi
+  802560:	85 db                	test   %ebx,%ebx
+  802562:	78 23                	js     802587 <__divdi3+0x127>
+  802564:	89 dd                	mov    %ebx,%ebp
+  802566:	89 c8                	mov    %ecx,%eax
+  802568:	89 da                	mov    %ebx,%edx
+  80256a:	09 cd                	or     %ecx,%ebp
+  80256c:	0f 84 1f ff ff ff    	je     802491 <__divdi3+0x31>
+  802572:	89 0c 24             	mov    %ecx,(%esp)
+  802575:	89 f0                	mov    %esi,%eax
+  802577:	89 fa                	mov    %edi,%edx
+  802579:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80257e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802582:	e9 29 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+  802587:	31 ed                	xor    %ebp,%ebp
+  802589:	e9 10 ff ff ff       	jmp    80249e <__divdi3+0x3e>
+  80258e:	89 0c 24             	mov    %ecx,(%esp)
+  802591:	89 f0                	mov    %esi,%eax
+  802593:	89 fa                	mov    %edi,%edx
+  802595:	31 ed                	xor    %ebp,%ebp
+  802597:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80259b:	e9 10 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+
+008025a0 <__moddi3>:
+  8025a0:	55                   	push   %ebp
+  8025a1:	57                   	push   %edi
+  8025a2:	56                   	push   %esi
+  8025a3:	53                   	push   %ebx
+  8025a4:	83 ec 14             	sub    $0x14,%esp
+  8025a7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025ab:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025af:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8025b3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8025b7:	85 d2                	test   %edx,%edx
+  8025b9:	0f 88 9b 00 00 00    	js     80265a <__moddi3+0xba>
+  8025bf:	89 f7                	mov    %esi,%edi
+  8025c1:	31 ed                	xor    %ebp,%ebp
+  8025c3:	09 cf                	or     %ecx,%edi
+  8025c5:	0f 84 83 00 00 00    	je     80264e <__moddi3+0xae>
+  8025cb:	89 cb                	mov    %ecx,%ebx
+  8025cd:	89 f7                	mov    %esi,%edi
+  8025cf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8025d3:	f7 db                	neg    %ebx
+  8025d5:	83 d7 00             	adc    $0x0,%edi
+  8025d8:	f7 df                	neg    %edi
+  8025da:	0f 49 f7             	cmovns %edi,%esi
+  8025dd:	0f 49 cb             	cmovns %ebx,%ecx
+  8025e0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025e4:	89 0c 24             	mov    %ecx,(%esp)
+  8025e7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025ec:	89 cd                	mov    %ecx,%ebp
+  8025ee:	66 90                	xchg   %ax,%ax
+  8025f0:	89 e9                	mov    %ebp,%ecx
+  8025f2:	89 c3                	mov    %eax,%ebx
+  8025f4:	89 d6                	mov    %edx,%esi
+  8025f6:	31 ff                	xor    %edi,%edi
+  8025f8:	d3 ee                	shr    %cl,%esi
+  8025fa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025fd:	f6 c1 20             	test   $0x20,%cl
+  802600:	0f 45 de             	cmovne %esi,%ebx
+  802603:	0f 45 f7             	cmovne %edi,%esi
+  802606:	8b 3c 24             	mov    (%esp),%edi
+  802609:	39 fb                	cmp    %edi,%ebx
+  80260b:	89 f7                	mov    %esi,%edi
+  80260d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802611:	8b 1c 24             	mov    (%esp),%ebx
+  802614:	19 f7                	sbb    %esi,%edi
+  802616:	72 1a                	jb     802632 <__moddi3+0x92>
+  802618:	89 e9                	mov    %ebp,%ecx
+  80261a:	89 f7                	mov    %esi,%edi
+  80261c:	89 de                	mov    %ebx,%esi
+  80261e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802621:	d3 e6                	shl    %cl,%esi
+  802623:	31 db                	xor    %ebx,%ebx
+  802625:	f6 c1 20             	test   $0x20,%cl
+  802628:	0f 45 fe             	cmovne %esi,%edi
+  80262b:	0f 45 f3             	cmovne %ebx,%esi
+  80262e:	29 f0                	sub    %esi,%eax
+  802630:	19 fa                	sbb    %edi,%edx
+  802632:	83 ed 01             	sub    $0x1,%ebp
+  802635:	73 b9                	jae    8025f0 <__moddi3+0x50>
+  802637:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80263b:	85 ed                	test   %ebp,%ebp
+  80263d:	74 07                	je     802646 <__moddi3+0xa6>
+  80263f:	f7 d8                	neg    %eax
+  802641:	83 d2 00             	adc    $0x0,%edx
+  802644:	f7 da                	neg    %edx
+  802646:	83 c4 14             	add    $0x14,%esp
+  802649:	5b                   	pop    %ebx
+  80264a:	5e                   	pop    %esi
+  80264b:	5f                   	pop    %edi
+  80264c:	5d                   	pop    %ebp
+  80264d:	c3                   	ret
+  80264e:	83 c4 14             	add    $0x14,%esp
+  802651:	31 c0                	xor    %eax,%eax
+  802653:	31 d2                	xor    %edx,%edx
+  802655:	5b                   	pop    %ebx
+  802656:	5e                   	pop    %esi
+  802657:	5f                   	pop    %edi
+  802658:	5d                   	pop    %ebp
+  802659:	c3                   	ret
+  80265a:	89 f7                	mov    %esi,%edi
+  80265c:	09 cf                	or     %ecx,%edi
+  80265e:	74 11                	je     802671 <__moddi3+0xd1>
+  802660:	f7 d8                	neg    %eax
+  802662:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802667:	83 d2 00             	adc    $0x0,%edx
+  80266a:	f7 da                	neg    %edx
+  80266c:	e9 5a ff ff ff       	jmp    8025cb <__moddi3+0x2b>
+  802671:	31 c0                	xor    %eax,%eax
+  802673:	31 d2                	xor    %edx,%edx
+  802675:	eb c8                	jmp    80263f <__moddi3+0x9f>
@@ -0,0 +1,6120 @@
+
+obj/user/faultregs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 aa 05 00 00       	call   8005db <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check_regs>:
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs* a, const char *an, struct regs* b, const char *bn,
+	   const char *testname)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  80003e:	89 cb                	mov    %ecx,%ebx
+	int mismatch = 0;
+
+	cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  800040:	ff 75 08             	push   0x8(%ebp)
+  800043:	52                   	push   %edx
+  800044:	68 d1 2c 80 00       	push   $0x802cd1
+  800049:	68 a0 2c 80 00       	push   $0x802ca0
+  80004e:	e8 c3 06 00 00       	call   800716 <cprintf>
+			cprintf("MISMATCH\n");				\
+			mismatch = 1;					\
+		}							\
+	} while (0)
+
+	CHECK(edi, regs.reg_edi);
+  800053:	ff 33                	push   (%ebx)
+  800055:	ff 36                	push   (%esi)
+  800057:	68 b0 2c 80 00       	push   $0x802cb0
+  80005c:	68 b4 2c 80 00       	push   $0x802cb4
+  800061:	e8 b0 06 00 00       	call   800716 <cprintf>
+  800066:	83 c4 20             	add    $0x20,%esp
+  800069:	8b 03                	mov    (%ebx),%eax
+  80006b:	39 06                	cmp    %eax,(%esi)
+  80006d:	0f 84 2e 02 00 00    	je     8002a1 <check_regs+0x26e>
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	68 c8 2c 80 00       	push   $0x802cc8
+  80007b:	e8 96 06 00 00       	call   800716 <cprintf>
+  800080:	83 c4 10             	add    $0x10,%esp
+  800083:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(esi, regs.reg_esi);
+  800088:	ff 73 04             	push   0x4(%ebx)
+  80008b:	ff 76 04             	push   0x4(%esi)
+  80008e:	68 d2 2c 80 00       	push   $0x802cd2
+  800093:	68 b4 2c 80 00       	push   $0x802cb4
+  800098:	e8 79 06 00 00       	call   800716 <cprintf>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8000a3:	39 46 04             	cmp    %eax,0x4(%esi)
+  8000a6:	0f 84 0f 02 00 00    	je     8002bb <check_regs+0x288>
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	68 c8 2c 80 00       	push   $0x802cc8
+  8000b4:	e8 5d 06 00 00       	call   800716 <cprintf>
+  8000b9:	83 c4 10             	add    $0x10,%esp
+  8000bc:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebp, regs.reg_ebp);
+  8000c1:	ff 73 08             	push   0x8(%ebx)
+  8000c4:	ff 76 08             	push   0x8(%esi)
+  8000c7:	68 d6 2c 80 00       	push   $0x802cd6
+  8000cc:	68 b4 2c 80 00       	push   $0x802cb4
+  8000d1:	e8 40 06 00 00       	call   800716 <cprintf>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8000dc:	39 46 08             	cmp    %eax,0x8(%esi)
+  8000df:	0f 84 eb 01 00 00    	je     8002d0 <check_regs+0x29d>
+  8000e5:	83 ec 0c             	sub    $0xc,%esp
+  8000e8:	68 c8 2c 80 00       	push   $0x802cc8
+  8000ed:	e8 24 06 00 00       	call   800716 <cprintf>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebx, regs.reg_ebx);
+  8000fa:	ff 73 10             	push   0x10(%ebx)
+  8000fd:	ff 76 10             	push   0x10(%esi)
+  800100:	68 da 2c 80 00       	push   $0x802cda
+  800105:	68 b4 2c 80 00       	push   $0x802cb4
+  80010a:	e8 07 06 00 00       	call   800716 <cprintf>
+  80010f:	83 c4 10             	add    $0x10,%esp
+  800112:	8b 43 10             	mov    0x10(%ebx),%eax
+  800115:	39 46 10             	cmp    %eax,0x10(%esi)
+  800118:	0f 84 c7 01 00 00    	je     8002e5 <check_regs+0x2b2>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	68 c8 2c 80 00       	push   $0x802cc8
+  800126:	e8 eb 05 00 00       	call   800716 <cprintf>
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(edx, regs.reg_edx);
+  800133:	ff 73 14             	push   0x14(%ebx)
+  800136:	ff 76 14             	push   0x14(%esi)
+  800139:	68 de 2c 80 00       	push   $0x802cde
+  80013e:	68 b4 2c 80 00       	push   $0x802cb4
+  800143:	e8 ce 05 00 00       	call   800716 <cprintf>
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80014e:	39 46 14             	cmp    %eax,0x14(%esi)
+  800151:	0f 84 a3 01 00 00    	je     8002fa <check_regs+0x2c7>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	68 c8 2c 80 00       	push   $0x802cc8
+  80015f:	e8 b2 05 00 00       	call   800716 <cprintf>
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ecx, regs.reg_ecx);
+  80016c:	ff 73 18             	push   0x18(%ebx)
+  80016f:	ff 76 18             	push   0x18(%esi)
+  800172:	68 e2 2c 80 00       	push   $0x802ce2
+  800177:	68 b4 2c 80 00       	push   $0x802cb4
+  80017c:	e8 95 05 00 00       	call   800716 <cprintf>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	8b 43 18             	mov    0x18(%ebx),%eax
+  800187:	39 46 18             	cmp    %eax,0x18(%esi)
+  80018a:	0f 84 7f 01 00 00    	je     80030f <check_regs+0x2dc>
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	68 c8 2c 80 00       	push   $0x802cc8
+  800198:	e8 79 05 00 00       	call   800716 <cprintf>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eax, regs.reg_eax);
+  8001a5:	ff 73 1c             	push   0x1c(%ebx)
+  8001a8:	ff 76 1c             	push   0x1c(%esi)
+  8001ab:	68 e6 2c 80 00       	push   $0x802ce6
+  8001b0:	68 b4 2c 80 00       	push   $0x802cb4
+  8001b5:	e8 5c 05 00 00       	call   800716 <cprintf>
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8001c0:	39 46 1c             	cmp    %eax,0x1c(%esi)
+  8001c3:	0f 84 5b 01 00 00    	je     800324 <check_regs+0x2f1>
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	68 c8 2c 80 00       	push   $0x802cc8
+  8001d1:	e8 40 05 00 00       	call   800716 <cprintf>
+  8001d6:	83 c4 10             	add    $0x10,%esp
+  8001d9:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eip, eip);
+  8001de:	ff 73 20             	push   0x20(%ebx)
+  8001e1:	ff 76 20             	push   0x20(%esi)
+  8001e4:	68 ea 2c 80 00       	push   $0x802cea
+  8001e9:	68 b4 2c 80 00       	push   $0x802cb4
+  8001ee:	e8 23 05 00 00       	call   800716 <cprintf>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8001f9:	39 46 20             	cmp    %eax,0x20(%esi)
+  8001fc:	0f 84 37 01 00 00    	je     800339 <check_regs+0x306>
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	68 c8 2c 80 00       	push   $0x802cc8
+  80020a:	e8 07 05 00 00       	call   800716 <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eflags, eflags);
+  800217:	ff 73 24             	push   0x24(%ebx)
+  80021a:	ff 76 24             	push   0x24(%esi)
+  80021d:	68 ee 2c 80 00       	push   $0x802cee
+  800222:	68 b4 2c 80 00       	push   $0x802cb4
+  800227:	e8 ea 04 00 00       	call   800716 <cprintf>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	8b 43 24             	mov    0x24(%ebx),%eax
+  800232:	39 46 24             	cmp    %eax,0x24(%esi)
+  800235:	0f 84 13 01 00 00    	je     80034e <check_regs+0x31b>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	68 c8 2c 80 00       	push   $0x802cc8
+  800243:	e8 ce 04 00 00       	call   800716 <cprintf>
+	CHECK(esp, esp);
+  800248:	ff 73 28             	push   0x28(%ebx)
+  80024b:	ff 76 28             	push   0x28(%esi)
+  80024e:	68 f5 2c 80 00       	push   $0x802cf5
+  800253:	68 b4 2c 80 00       	push   $0x802cb4
+  800258:	e8 b9 04 00 00       	call   800716 <cprintf>
+  80025d:	83 c4 20             	add    $0x20,%esp
+  800260:	8b 43 28             	mov    0x28(%ebx),%eax
+  800263:	39 46 28             	cmp    %eax,0x28(%esi)
+  800266:	0f 84 53 01 00 00    	je     8003bf <check_regs+0x38c>
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	68 c8 2c 80 00       	push   $0x802cc8
+  800274:	e8 9d 04 00 00       	call   800716 <cprintf>
+
+#undef CHECK
+
+	cprintf("Registers %s ", testname);
+  800279:	83 c4 08             	add    $0x8,%esp
+  80027c:	ff 75 0c             	push   0xc(%ebp)
+  80027f:	68 f9 2c 80 00       	push   $0x802cf9
+  800284:	e8 8d 04 00 00       	call   800716 <cprintf>
+  800289:	83 c4 10             	add    $0x10,%esp
+	if (!mismatch)
+		cprintf("OK\n");
+	else
+		cprintf("MISMATCH\n");
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	68 c8 2c 80 00       	push   $0x802cc8
+  800294:	e8 7d 04 00 00       	call   800716 <cprintf>
+  800299:	83 c4 10             	add    $0x10,%esp
+}
+  80029c:	e9 16 01 00 00       	jmp    8003b7 <check_regs+0x384>
+	CHECK(edi, regs.reg_edi);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	68 c4 2c 80 00       	push   $0x802cc4
+  8002a9:	e8 68 04 00 00       	call   800716 <cprintf>
+  8002ae:	83 c4 10             	add    $0x10,%esp
+	int mismatch = 0;
+  8002b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b6:	e9 cd fd ff ff       	jmp    800088 <check_regs+0x55>
+	CHECK(esi, regs.reg_esi);
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	68 c4 2c 80 00       	push   $0x802cc4
+  8002c3:	e8 4e 04 00 00       	call   800716 <cprintf>
+  8002c8:	83 c4 10             	add    $0x10,%esp
+  8002cb:	e9 f1 fd ff ff       	jmp    8000c1 <check_regs+0x8e>
+	CHECK(ebp, regs.reg_ebp);
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	68 c4 2c 80 00       	push   $0x802cc4
+  8002d8:	e8 39 04 00 00       	call   800716 <cprintf>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	e9 15 fe ff ff       	jmp    8000fa <check_regs+0xc7>
+	CHECK(ebx, regs.reg_ebx);
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+  8002e8:	68 c4 2c 80 00       	push   $0x802cc4
+  8002ed:	e8 24 04 00 00       	call   800716 <cprintf>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	e9 39 fe ff ff       	jmp    800133 <check_regs+0x100>
+	CHECK(edx, regs.reg_edx);
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	68 c4 2c 80 00       	push   $0x802cc4
+  800302:	e8 0f 04 00 00       	call   800716 <cprintf>
+  800307:	83 c4 10             	add    $0x10,%esp
+  80030a:	e9 5d fe ff ff       	jmp    80016c <check_regs+0x139>
+	CHECK(ecx, regs.reg_ecx);
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	68 c4 2c 80 00       	push   $0x802cc4
+  800317:	e8 fa 03 00 00       	call   800716 <cprintf>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	e9 81 fe ff ff       	jmp    8001a5 <check_regs+0x172>
+	CHECK(eax, regs.reg_eax);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	68 c4 2c 80 00       	push   $0x802cc4
+  80032c:	e8 e5 03 00 00       	call   800716 <cprintf>
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	e9 a5 fe ff ff       	jmp    8001de <check_regs+0x1ab>
+	CHECK(eip, eip);
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	68 c4 2c 80 00       	push   $0x802cc4
+  800341:	e8 d0 03 00 00       	call   800716 <cprintf>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	e9 c9 fe ff ff       	jmp    800217 <check_regs+0x1e4>
+	CHECK(eflags, eflags);
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	68 c4 2c 80 00       	push   $0x802cc4
+  800356:	e8 bb 03 00 00       	call   800716 <cprintf>
+	CHECK(esp, esp);
+  80035b:	ff 73 28             	push   0x28(%ebx)
+  80035e:	ff 76 28             	push   0x28(%esi)
+  800361:	68 f5 2c 80 00       	push   $0x802cf5
+  800366:	68 b4 2c 80 00       	push   $0x802cb4
+  80036b:	e8 a6 03 00 00       	call   800716 <cprintf>
+  800370:	83 c4 20             	add    $0x20,%esp
+  800373:	8b 43 28             	mov    0x28(%ebx),%eax
+  800376:	39 46 28             	cmp    %eax,0x28(%esi)
+  800379:	0f 85 ed fe ff ff    	jne    80026c <check_regs+0x239>
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	68 c4 2c 80 00       	push   $0x802cc4
+  800387:	e8 8a 03 00 00       	call   800716 <cprintf>
+	cprintf("Registers %s ", testname);
+  80038c:	83 c4 08             	add    $0x8,%esp
+  80038f:	ff 75 0c             	push   0xc(%ebp)
+  800392:	68 f9 2c 80 00       	push   $0x802cf9
+  800397:	e8 7a 03 00 00       	call   800716 <cprintf>
+	if (!mismatch)
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	85 ff                	test   %edi,%edi
+  8003a1:	0f 85 e5 fe ff ff    	jne    80028c <check_regs+0x259>
+		cprintf("OK\n");
+  8003a7:	83 ec 0c             	sub    $0xc,%esp
+  8003aa:	68 c4 2c 80 00       	push   $0x802cc4
+  8003af:	e8 62 03 00 00       	call   800716 <cprintf>
+  8003b4:	83 c4 10             	add    $0x10,%esp
+}
+  8003b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+	CHECK(esp, esp);
+  8003bf:	83 ec 0c             	sub    $0xc,%esp
+  8003c2:	68 c4 2c 80 00       	push   $0x802cc4
+  8003c7:	e8 4a 03 00 00       	call   800716 <cprintf>
+	cprintf("Registers %s ", testname);
+  8003cc:	83 c4 08             	add    $0x8,%esp
+  8003cf:	ff 75 0c             	push   0xc(%ebp)
+  8003d2:	68 f9 2c 80 00       	push   $0x802cf9
+  8003d7:	e8 3a 03 00 00       	call   800716 <cprintf>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	e9 a8 fe ff ff       	jmp    80028c <check_regs+0x259>
+
+008003e4 <pgfault>:
+
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8003e4:	55                   	push   %ebp
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	int r;
+
+	if (utf->utf_fault_va != (uint32_t)UTEMP)
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	81 fa 00 00 40 00    	cmp    $0x400000,%edx
+  8003f5:	0f 85 9d 00 00 00    	jne    800498 <pgfault+0xb4>
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+		      utf->utf_fault_va, utf->utf_eip);
+
+	// Check registers in UTrapframe
+	during.regs = utf->utf_regs;
+  8003fb:	8b 50 08             	mov    0x8(%eax),%edx
+  8003fe:	89 15 40 50 80 00    	mov    %edx,0x805040
+  800404:	8b 50 0c             	mov    0xc(%eax),%edx
+  800407:	89 15 44 50 80 00    	mov    %edx,0x805044
+  80040d:	8b 50 10             	mov    0x10(%eax),%edx
+  800410:	89 15 48 50 80 00    	mov    %edx,0x805048
+  800416:	8b 50 14             	mov    0x14(%eax),%edx
+  800419:	89 15 4c 50 80 00    	mov    %edx,0x80504c
+  80041f:	8b 50 18             	mov    0x18(%eax),%edx
+  800422:	89 15 50 50 80 00    	mov    %edx,0x805050
+  800428:	8b 50 1c             	mov    0x1c(%eax),%edx
+  80042b:	89 15 54 50 80 00    	mov    %edx,0x805054
+  800431:	8b 50 20             	mov    0x20(%eax),%edx
+  800434:	89 15 58 50 80 00    	mov    %edx,0x805058
+  80043a:	8b 50 24             	mov    0x24(%eax),%edx
+  80043d:	89 15 5c 50 80 00    	mov    %edx,0x80505c
+	during.eip = utf->utf_eip;
+  800443:	8b 50 28             	mov    0x28(%eax),%edx
+  800446:	89 15 60 50 80 00    	mov    %edx,0x805060
+	during.eflags = utf->utf_eflags;
+  80044c:	8b 50 2c             	mov    0x2c(%eax),%edx
+  80044f:	89 15 64 50 80 00    	mov    %edx,0x805064
+	during.esp = utf->utf_esp;
+  800455:	8b 40 30             	mov    0x30(%eax),%eax
+  800458:	a3 68 50 80 00       	mov    %eax,0x805068
+	check_regs(&before, "before", &during, "during", "in UTrapframe");
+  80045d:	83 ec 08             	sub    $0x8,%esp
+  800460:	68 1f 2d 80 00       	push   $0x802d1f
+  800465:	68 2d 2d 80 00       	push   $0x802d2d
+  80046a:	b9 40 50 80 00       	mov    $0x805040,%ecx
+  80046f:	ba 18 2d 80 00       	mov    $0x802d18,%edx
+  800474:	b8 80 50 80 00       	mov    $0x805080,%eax
+  800479:	e8 b5 fb ff ff       	call   800033 <check_regs>
+
+	// Map UTEMP so the write succeeds
+	if ((r = sys_page_alloc(0, UTEMP, PTE_U|PTE_P|PTE_W)) < 0)
+  80047e:	83 c4 0c             	add    $0xc,%esp
+  800481:	6a 07                	push   $0x7
+  800483:	68 00 00 40 00       	push   $0x400000
+  800488:	6a 00                	push   $0x0
+  80048a:	e8 e2 0c 00 00       	call   801171 <sys_page_alloc>
+  80048f:	83 c4 10             	add    $0x10,%esp
+  800492:	85 c0                	test   %eax,%eax
+  800494:	78 1a                	js     8004b0 <pgfault+0xcc>
+		panic("sys_page_alloc: %e", r);
+}
+  800496:	c9                   	leave
+  800497:	c3                   	ret
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+  800498:	83 ec 0c             	sub    $0xc,%esp
+  80049b:	ff 70 28             	push   0x28(%eax)
+  80049e:	52                   	push   %edx
+  80049f:	68 60 2d 80 00       	push   $0x802d60
+  8004a4:	6a 50                	push   $0x50
+  8004a6:	68 07 2d 80 00       	push   $0x802d07
+  8004ab:	e8 8b 01 00 00       	call   80063b <_panic>
+		panic("sys_page_alloc: %e", r);
+  8004b0:	50                   	push   %eax
+  8004b1:	68 34 2d 80 00       	push   $0x802d34
+  8004b6:	6a 5c                	push   $0x5c
+  8004b8:	68 07 2d 80 00       	push   $0x802d07
+  8004bd:	e8 79 01 00 00       	call   80063b <_panic>
+
+008004c2 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8004c2:	55                   	push   %ebp
+  8004c3:	89 e5                	mov    %esp,%ebp
+  8004c5:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8004c8:	68 e4 03 80 00       	push   $0x8003e4
+  8004cd:	e8 c4 10 00 00       	call   801596 <set_pgfault_handler>
+
+	__asm __volatile(
+  8004d2:	50                   	push   %eax
+  8004d3:	9c                   	pushf
+  8004d4:	58                   	pop    %eax
+  8004d5:	0d d5 08 00 00       	or     $0x8d5,%eax
+  8004da:	50                   	push   %eax
+  8004db:	9d                   	popf
+  8004dc:	a3 a4 50 80 00       	mov    %eax,0x8050a4
+  8004e1:	8d 05 1c 05 80 00    	lea    0x80051c,%eax
+  8004e7:	a3 a0 50 80 00       	mov    %eax,0x8050a0
+  8004ec:	58                   	pop    %eax
+  8004ed:	89 3d 80 50 80 00    	mov    %edi,0x805080
+  8004f3:	89 35 84 50 80 00    	mov    %esi,0x805084
+  8004f9:	89 2d 88 50 80 00    	mov    %ebp,0x805088
+  8004ff:	89 1d 90 50 80 00    	mov    %ebx,0x805090
+  800505:	89 15 94 50 80 00    	mov    %edx,0x805094
+  80050b:	89 0d 98 50 80 00    	mov    %ecx,0x805098
+  800511:	a3 9c 50 80 00       	mov    %eax,0x80509c
+  800516:	89 25 a8 50 80 00    	mov    %esp,0x8050a8
+  80051c:	c7 05 00 00 40 00 2a 	movl   $0x2a,0x400000
+  800523:	00 00 00 
+  800526:	89 3d 00 50 80 00    	mov    %edi,0x805000
+  80052c:	89 35 04 50 80 00    	mov    %esi,0x805004
+  800532:	89 2d 08 50 80 00    	mov    %ebp,0x805008
+  800538:	89 1d 10 50 80 00    	mov    %ebx,0x805010
+  80053e:	89 15 14 50 80 00    	mov    %edx,0x805014
+  800544:	89 0d 18 50 80 00    	mov    %ecx,0x805018
+  80054a:	a3 1c 50 80 00       	mov    %eax,0x80501c
+  80054f:	89 25 28 50 80 00    	mov    %esp,0x805028
+  800555:	8b 3d 80 50 80 00    	mov    0x805080,%edi
+  80055b:	8b 35 84 50 80 00    	mov    0x805084,%esi
+  800561:	8b 2d 88 50 80 00    	mov    0x805088,%ebp
+  800567:	8b 1d 90 50 80 00    	mov    0x805090,%ebx
+  80056d:	8b 15 94 50 80 00    	mov    0x805094,%edx
+  800573:	8b 0d 98 50 80 00    	mov    0x805098,%ecx
+  800579:	a1 9c 50 80 00       	mov    0x80509c,%eax
+  80057e:	8b 25 a8 50 80 00    	mov    0x8050a8,%esp
+  800584:	50                   	push   %eax
+  800585:	9c                   	pushf
+  800586:	58                   	pop    %eax
+  800587:	a3 24 50 80 00       	mov    %eax,0x805024
+  80058c:	58                   	pop    %eax
+		: : "m" (before), "m" (after) : "memory", "cc");
+
+	// Check UTEMP to roughly determine that EIP was restored
+	// correctly (of course, we probably wouldn't get this far if
+	// it weren't)
+	if (*(int*)UTEMP != 42)
+  80058d:	83 c4 10             	add    $0x10,%esp
+  800590:	83 3d 00 00 40 00 2a 	cmpl   $0x2a,0x400000
+  800597:	75 30                	jne    8005c9 <umain+0x107>
+		cprintf("EIP after page-fault MISMATCH\n");
+	after.eip = before.eip;
+  800599:	a1 a0 50 80 00       	mov    0x8050a0,%eax
+  80059e:	a3 20 50 80 00       	mov    %eax,0x805020
+
+	check_regs(&before, "before", &after, "after", "after page-fault");
+  8005a3:	83 ec 08             	sub    $0x8,%esp
+  8005a6:	68 47 2d 80 00       	push   $0x802d47
+  8005ab:	68 58 2d 80 00       	push   $0x802d58
+  8005b0:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  8005b5:	ba 18 2d 80 00       	mov    $0x802d18,%edx
+  8005ba:	b8 80 50 80 00       	mov    $0x805080,%eax
+  8005bf:	e8 6f fa ff ff       	call   800033 <check_regs>
+}
+  8005c4:	83 c4 10             	add    $0x10,%esp
+  8005c7:	c9                   	leave
+  8005c8:	c3                   	ret
+		cprintf("EIP after page-fault MISMATCH\n");
+  8005c9:	83 ec 0c             	sub    $0xc,%esp
+  8005cc:	68 94 2d 80 00       	push   $0x802d94
+  8005d1:	e8 40 01 00 00       	call   800716 <cprintf>
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	eb be                	jmp    800599 <umain+0xd7>
+
+008005db <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8005db:	55                   	push   %ebp
+  8005dc:	89 e5                	mov    %esp,%ebp
+  8005de:	56                   	push   %esi
+  8005df:	53                   	push   %ebx
+  8005e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8005e6:	e8 e7 0a 00 00       	call   8010d2 <sys_getenvid>
+  8005eb:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8005f0:	c1 e0 09             	shl    $0x9,%eax
+  8005f3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8005f8:	a3 b4 50 80 00       	mov    %eax,0x8050b4
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8005fd:	85 db                	test   %ebx,%ebx
+  8005ff:	7e 07                	jle    800608 <libmain+0x2d>
+		binaryname = argv[0];
+  800601:	8b 06                	mov    (%esi),%eax
+  800603:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800608:	83 ec 08             	sub    $0x8,%esp
+  80060b:	56                   	push   %esi
+  80060c:	53                   	push   %ebx
+  80060d:	e8 b0 fe ff ff       	call   8004c2 <umain>
+
+	// exit gracefully
+	exit();
+  800612:	e8 0a 00 00 00       	call   800621 <exit>
+}
+  800617:	83 c4 10             	add    $0x10,%esp
+  80061a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80061d:	5b                   	pop    %ebx
+  80061e:	5e                   	pop    %esi
+  80061f:	5d                   	pop    %ebp
+  800620:	c3                   	ret
+
+00800621 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800621:	55                   	push   %ebp
+  800622:	89 e5                	mov    %esp,%ebp
+  800624:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800627:	e8 cf 11 00 00       	call   8017fb <close_all>
+	sys_env_destroy(0);
+  80062c:	83 ec 0c             	sub    $0xc,%esp
+  80062f:	6a 00                	push   $0x0
+  800631:	e8 5b 0a 00 00       	call   801091 <sys_env_destroy>
+}
+  800636:	83 c4 10             	add    $0x10,%esp
+  800639:	c9                   	leave
+  80063a:	c3                   	ret
+
+0080063b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80063b:	55                   	push   %ebp
+  80063c:	89 e5                	mov    %esp,%ebp
+  80063e:	56                   	push   %esi
+  80063f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800640:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800643:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800649:	e8 84 0a 00 00       	call   8010d2 <sys_getenvid>
+  80064e:	83 ec 0c             	sub    $0xc,%esp
+  800651:	ff 75 0c             	push   0xc(%ebp)
+  800654:	ff 75 08             	push   0x8(%ebp)
+  800657:	56                   	push   %esi
+  800658:	50                   	push   %eax
+  800659:	68 c0 2d 80 00       	push   $0x802dc0
+  80065e:	e8 b3 00 00 00       	call   800716 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800663:	83 c4 18             	add    $0x18,%esp
+  800666:	53                   	push   %ebx
+  800667:	ff 75 10             	push   0x10(%ebp)
+  80066a:	e8 56 00 00 00       	call   8006c5 <vcprintf>
+	cprintf("\n");
+  80066f:	c7 04 24 d0 2c 80 00 	movl   $0x802cd0,(%esp)
+  800676:	e8 9b 00 00 00       	call   800716 <cprintf>
+  80067b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80067e:	cc                   	int3
+	while (1)
+  80067f:	eb fd                	jmp    80067e <_panic+0x43>
+
+00800681 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800681:	55                   	push   %ebp
+  800682:	89 e5                	mov    %esp,%ebp
+  800684:	53                   	push   %ebx
+  800685:	83 ec 04             	sub    $0x4,%esp
+  800688:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80068b:	8b 13                	mov    (%ebx),%edx
+  80068d:	8d 42 01             	lea    0x1(%edx),%eax
+  800690:	89 03                	mov    %eax,(%ebx)
+  800692:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800695:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800699:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80069e:	74 09                	je     8006a9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006a0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8006a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006a7:	c9                   	leave
+  8006a8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006a9:	83 ec 08             	sub    $0x8,%esp
+  8006ac:	68 ff 00 00 00       	push   $0xff
+  8006b1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006b4:	50                   	push   %eax
+  8006b5:	e8 7a 09 00 00       	call   801034 <sys_cputs>
+		b->idx = 0;
+  8006ba:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8006c0:	83 c4 10             	add    $0x10,%esp
+  8006c3:	eb db                	jmp    8006a0 <putch+0x1f>
+
+008006c5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8006c5:	55                   	push   %ebp
+  8006c6:	89 e5                	mov    %esp,%ebp
+  8006c8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8006ce:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8006d5:	00 00 00 
+	b.cnt = 0;
+  8006d8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8006df:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8006e2:	ff 75 0c             	push   0xc(%ebp)
+  8006e5:	ff 75 08             	push   0x8(%ebp)
+  8006e8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8006ee:	50                   	push   %eax
+  8006ef:	68 81 06 80 00       	push   $0x800681
+  8006f4:	e8 14 01 00 00       	call   80080d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8006f9:	83 c4 08             	add    $0x8,%esp
+  8006fc:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800702:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800708:	50                   	push   %eax
+  800709:	e8 26 09 00 00       	call   801034 <sys_cputs>
+
+	return b.cnt;
+}
+  80070e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800714:	c9                   	leave
+  800715:	c3                   	ret
+
+00800716 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800716:	55                   	push   %ebp
+  800717:	89 e5                	mov    %esp,%ebp
+  800719:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80071c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80071f:	50                   	push   %eax
+  800720:	ff 75 08             	push   0x8(%ebp)
+  800723:	e8 9d ff ff ff       	call   8006c5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800728:	c9                   	leave
+  800729:	c3                   	ret
+
+0080072a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80072a:	55                   	push   %ebp
+  80072b:	89 e5                	mov    %esp,%ebp
+  80072d:	57                   	push   %edi
+  80072e:	56                   	push   %esi
+  80072f:	53                   	push   %ebx
+  800730:	83 ec 1c             	sub    $0x1c,%esp
+  800733:	89 c7                	mov    %eax,%edi
+  800735:	89 d6                	mov    %edx,%esi
+  800737:	8b 45 08             	mov    0x8(%ebp),%eax
+  80073a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80073d:	89 d1                	mov    %edx,%ecx
+  80073f:	89 c2                	mov    %eax,%edx
+  800741:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800744:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800747:	8b 45 10             	mov    0x10(%ebp),%eax
+  80074a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80074d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800750:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800757:	39 c2                	cmp    %eax,%edx
+  800759:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80075c:	72 3e                	jb     80079c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80075e:	83 ec 0c             	sub    $0xc,%esp
+  800761:	ff 75 18             	push   0x18(%ebp)
+  800764:	83 eb 01             	sub    $0x1,%ebx
+  800767:	53                   	push   %ebx
+  800768:	50                   	push   %eax
+  800769:	83 ec 08             	sub    $0x8,%esp
+  80076c:	ff 75 e4             	push   -0x1c(%ebp)
+  80076f:	ff 75 e0             	push   -0x20(%ebp)
+  800772:	ff 75 dc             	push   -0x24(%ebp)
+  800775:	ff 75 d8             	push   -0x28(%ebp)
+  800778:	e8 b3 21 00 00       	call   802930 <__udivdi3>
+  80077d:	83 c4 18             	add    $0x18,%esp
+  800780:	52                   	push   %edx
+  800781:	50                   	push   %eax
+  800782:	89 f2                	mov    %esi,%edx
+  800784:	89 f8                	mov    %edi,%eax
+  800786:	e8 9f ff ff ff       	call   80072a <printnum>
+  80078b:	83 c4 20             	add    $0x20,%esp
+  80078e:	eb 13                	jmp    8007a3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800790:	83 ec 08             	sub    $0x8,%esp
+  800793:	56                   	push   %esi
+  800794:	ff 75 18             	push   0x18(%ebp)
+  800797:	ff d7                	call   *%edi
+  800799:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80079c:	83 eb 01             	sub    $0x1,%ebx
+  80079f:	85 db                	test   %ebx,%ebx
+  8007a1:	7f ed                	jg     800790 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007a3:	83 ec 08             	sub    $0x8,%esp
+  8007a6:	56                   	push   %esi
+  8007a7:	83 ec 04             	sub    $0x4,%esp
+  8007aa:	ff 75 e4             	push   -0x1c(%ebp)
+  8007ad:	ff 75 e0             	push   -0x20(%ebp)
+  8007b0:	ff 75 dc             	push   -0x24(%ebp)
+  8007b3:	ff 75 d8             	push   -0x28(%ebp)
+  8007b6:	e8 35 22 00 00       	call   8029f0 <__umoddi3>
+  8007bb:	83 c4 14             	add    $0x14,%esp
+  8007be:	0f be 80 e3 2d 80 00 	movsbl 0x802de3(%eax),%eax
+  8007c5:	50                   	push   %eax
+  8007c6:	ff d7                	call   *%edi
+}
+  8007c8:	83 c4 10             	add    $0x10,%esp
+  8007cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ce:	5b                   	pop    %ebx
+  8007cf:	5e                   	pop    %esi
+  8007d0:	5f                   	pop    %edi
+  8007d1:	5d                   	pop    %ebp
+  8007d2:	c3                   	ret
+
+008007d3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8007d3:	55                   	push   %ebp
+  8007d4:	89 e5                	mov    %esp,%ebp
+  8007d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8007d9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8007dd:	8b 10                	mov    (%eax),%edx
+  8007df:	3b 50 04             	cmp    0x4(%eax),%edx
+  8007e2:	73 0a                	jae    8007ee <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8007e4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8007e7:	89 08                	mov    %ecx,(%eax)
+  8007e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007ec:	88 02                	mov    %al,(%edx)
+}
+  8007ee:	5d                   	pop    %ebp
+  8007ef:	c3                   	ret
+
+008007f0 <printfmt>:
+{
+  8007f0:	55                   	push   %ebp
+  8007f1:	89 e5                	mov    %esp,%ebp
+  8007f3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8007f6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8007f9:	50                   	push   %eax
+  8007fa:	ff 75 10             	push   0x10(%ebp)
+  8007fd:	ff 75 0c             	push   0xc(%ebp)
+  800800:	ff 75 08             	push   0x8(%ebp)
+  800803:	e8 05 00 00 00       	call   80080d <vprintfmt>
+}
+  800808:	83 c4 10             	add    $0x10,%esp
+  80080b:	c9                   	leave
+  80080c:	c3                   	ret
+
+0080080d <vprintfmt>:
+{
+  80080d:	55                   	push   %ebp
+  80080e:	89 e5                	mov    %esp,%ebp
+  800810:	57                   	push   %edi
+  800811:	56                   	push   %esi
+  800812:	53                   	push   %ebx
+  800813:	83 ec 2c             	sub    $0x2c,%esp
+  800816:	8b 75 08             	mov    0x8(%ebp),%esi
+  800819:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80081c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80081f:	eb 0a                	jmp    80082b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800821:	83 ec 08             	sub    $0x8,%esp
+  800824:	53                   	push   %ebx
+  800825:	50                   	push   %eax
+  800826:	ff d6                	call   *%esi
+  800828:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80082b:	83 c7 01             	add    $0x1,%edi
+  80082e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800832:	83 f8 25             	cmp    $0x25,%eax
+  800835:	74 0c                	je     800843 <vprintfmt+0x36>
+			if (ch == '\0')
+  800837:	85 c0                	test   %eax,%eax
+  800839:	75 e6                	jne    800821 <vprintfmt+0x14>
+}
+  80083b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80083e:	5b                   	pop    %ebx
+  80083f:	5e                   	pop    %esi
+  800840:	5f                   	pop    %edi
+  800841:	5d                   	pop    %ebp
+  800842:	c3                   	ret
+		padc = ' ';
+  800843:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800847:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80084e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800855:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80085c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800861:	8d 47 01             	lea    0x1(%edi),%eax
+  800864:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800867:	0f b6 17             	movzbl (%edi),%edx
+  80086a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80086d:	3c 55                	cmp    $0x55,%al
+  80086f:	0f 87 cf 03 00 00    	ja     800c44 <vprintfmt+0x437>
+  800875:	0f b6 c0             	movzbl %al,%eax
+  800878:	ff 24 85 20 2f 80 00 	jmp    *0x802f20(,%eax,4)
+  80087f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800882:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800886:	eb d9                	jmp    800861 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800888:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80088b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80088f:	eb d0                	jmp    800861 <vprintfmt+0x54>
+  800891:	0f b6 d2             	movzbl %dl,%edx
+  800894:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800897:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80089f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8008a2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8008a6:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8008a9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8008ac:	83 f9 09             	cmp    $0x9,%ecx
+  8008af:	77 55                	ja     800906 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8008b1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8008b4:	eb e9                	jmp    80089f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8008b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b9:	8b 00                	mov    (%eax),%eax
+  8008bb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008c7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8008ca:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8008ce:	79 91                	jns    800861 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8008d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008d6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8008dd:	eb 82                	jmp    800861 <vprintfmt+0x54>
+			if (width < 0)
+  8008df:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008e2:	85 d2                	test   %edx,%edx
+  8008e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e9:	0f 49 c2             	cmovns %edx,%eax
+  8008ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8008f2:	e9 6a ff ff ff       	jmp    800861 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8008fa:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800901:	e9 5b ff ff ff       	jmp    800861 <vprintfmt+0x54>
+  800906:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800909:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80090c:	eb bc                	jmp    8008ca <vprintfmt+0xbd>
+			lflag++;
+  80090e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800911:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800914:	e9 48 ff ff ff       	jmp    800861 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800919:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091c:	8d 78 04             	lea    0x4(%eax),%edi
+  80091f:	83 ec 08             	sub    $0x8,%esp
+  800922:	53                   	push   %ebx
+  800923:	ff 30                	push   (%eax)
+  800925:	ff d6                	call   *%esi
+			break;
+  800927:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80092a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80092d:	e9 b1 02 00 00       	jmp    800be3 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800932:	8b 45 14             	mov    0x14(%ebp),%eax
+  800935:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800938:	8b 10                	mov    (%eax),%edx
+  80093a:	89 d0                	mov    %edx,%eax
+  80093c:	f7 d8                	neg    %eax
+  80093e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800941:	83 f8 0f             	cmp    $0xf,%eax
+  800944:	7f 23                	jg     800969 <vprintfmt+0x15c>
+  800946:	8b 14 85 80 30 80 00 	mov    0x803080(,%eax,4),%edx
+  80094d:	85 d2                	test   %edx,%edx
+  80094f:	74 18                	je     800969 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800951:	52                   	push   %edx
+  800952:	68 e1 31 80 00       	push   $0x8031e1
+  800957:	53                   	push   %ebx
+  800958:	56                   	push   %esi
+  800959:	e8 92 fe ff ff       	call   8007f0 <printfmt>
+  80095e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800961:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800964:	e9 7a 02 00 00       	jmp    800be3 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800969:	50                   	push   %eax
+  80096a:	68 fb 2d 80 00       	push   $0x802dfb
+  80096f:	53                   	push   %ebx
+  800970:	56                   	push   %esi
+  800971:	e8 7a fe ff ff       	call   8007f0 <printfmt>
+  800976:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800979:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80097c:	e9 62 02 00 00       	jmp    800be3 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800981:	8b 45 14             	mov    0x14(%ebp),%eax
+  800984:	83 c0 04             	add    $0x4,%eax
+  800987:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80098a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80098f:	85 c9                	test   %ecx,%ecx
+  800991:	b8 f4 2d 80 00       	mov    $0x802df4,%eax
+  800996:	0f 45 c1             	cmovne %ecx,%eax
+  800999:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80099c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009a0:	7e 06                	jle    8009a8 <vprintfmt+0x19b>
+  8009a2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8009a6:	75 0b                	jne    8009b3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009a8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8009ab:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8009ae:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009b1:	eb 5c                	jmp    800a0f <vprintfmt+0x202>
+  8009b3:	83 ec 08             	sub    $0x8,%esp
+  8009b6:	ff 75 d0             	push   -0x30(%ebp)
+  8009b9:	ff 75 cc             	push   -0x34(%ebp)
+  8009bc:	e8 20 03 00 00       	call   800ce1 <strnlen>
+  8009c1:	89 c2                	mov    %eax,%edx
+  8009c3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009c6:	29 d0                	sub    %edx,%eax
+  8009c8:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8009cb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8009cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009d2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009d5:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009d7:	eb 0e                	jmp    8009e7 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8009d9:	83 ec 08             	sub    $0x8,%esp
+  8009dc:	53                   	push   %ebx
+  8009dd:	57                   	push   %edi
+  8009de:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009e1:	83 ee 01             	sub    $0x1,%esi
+  8009e4:	83 c4 10             	add    $0x10,%esp
+  8009e7:	85 f6                	test   %esi,%esi
+  8009e9:	7f ee                	jg     8009d9 <vprintfmt+0x1cc>
+  8009eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009f1:	85 c0                	test   %eax,%eax
+  8009f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009f8:	0f 49 d0             	cmovns %eax,%edx
+  8009fb:	29 d0                	sub    %edx,%eax
+  8009fd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a00:	eb a6                	jmp    8009a8 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800a02:	83 ec 08             	sub    $0x8,%esp
+  800a05:	53                   	push   %ebx
+  800a06:	52                   	push   %edx
+  800a07:	ff 55 08             	call   *0x8(%ebp)
+  800a0a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a0d:	89 f1                	mov    %esi,%ecx
+  800a0f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800a12:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a16:	0f be d0             	movsbl %al,%edx
+  800a19:	85 d2                	test   %edx,%edx
+  800a1b:	74 28                	je     800a45 <vprintfmt+0x238>
+  800a1d:	85 ff                	test   %edi,%edi
+  800a1f:	78 05                	js     800a26 <vprintfmt+0x219>
+  800a21:	83 ef 01             	sub    $0x1,%edi
+  800a24:	78 30                	js     800a56 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800a26:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a2a:	74 d6                	je     800a02 <vprintfmt+0x1f5>
+  800a2c:	0f be c0             	movsbl %al,%eax
+  800a2f:	83 e8 20             	sub    $0x20,%eax
+  800a32:	83 f8 5e             	cmp    $0x5e,%eax
+  800a35:	76 cb                	jbe    800a02 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800a37:	83 ec 08             	sub    $0x8,%esp
+  800a3a:	53                   	push   %ebx
+  800a3b:	6a 3f                	push   $0x3f
+  800a3d:	ff 55 08             	call   *0x8(%ebp)
+  800a40:	83 c4 10             	add    $0x10,%esp
+  800a43:	eb c8                	jmp    800a0d <vprintfmt+0x200>
+  800a45:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a48:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a4b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a4e:	01 d0                	add    %edx,%eax
+  800a50:	29 c8                	sub    %ecx,%eax
+  800a52:	89 c7                	mov    %eax,%edi
+  800a54:	eb 13                	jmp    800a69 <vprintfmt+0x25c>
+  800a56:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a59:	eb ed                	jmp    800a48 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800a5b:	83 ec 08             	sub    $0x8,%esp
+  800a5e:	53                   	push   %ebx
+  800a5f:	6a 20                	push   $0x20
+  800a61:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800a63:	83 ef 01             	sub    $0x1,%edi
+  800a66:	83 c4 10             	add    $0x10,%esp
+  800a69:	85 ff                	test   %edi,%edi
+  800a6b:	7f ee                	jg     800a5b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a6d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800a70:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a73:	e9 6b 01 00 00       	jmp    800be3 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800a78:	83 f9 01             	cmp    $0x1,%ecx
+  800a7b:	7f 1f                	jg     800a9c <vprintfmt+0x28f>
+	else if (lflag)
+  800a7d:	85 c9                	test   %ecx,%ecx
+  800a7f:	74 67                	je     800ae8 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800a81:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a84:	8b 00                	mov    (%eax),%eax
+  800a86:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a89:	89 c1                	mov    %eax,%ecx
+  800a8b:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a8e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a91:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a94:	8d 40 04             	lea    0x4(%eax),%eax
+  800a97:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a9a:	eb 17                	jmp    800ab3 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800a9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9f:	8b 50 04             	mov    0x4(%eax),%edx
+  800aa2:	8b 00                	mov    (%eax),%eax
+  800aa4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800aa7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800aaa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aad:	8d 40 08             	lea    0x8(%eax),%eax
+  800ab0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800ab3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ab6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800ab9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800abe:	85 c9                	test   %ecx,%ecx
+  800ac0:	0f 89 03 01 00 00    	jns    800bc9 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800ac6:	83 ec 08             	sub    $0x8,%esp
+  800ac9:	53                   	push   %ebx
+  800aca:	6a 2d                	push   $0x2d
+  800acc:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800ace:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ad1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ad4:	f7 da                	neg    %edx
+  800ad6:	83 d1 00             	adc    $0x0,%ecx
+  800ad9:	f7 d9                	neg    %ecx
+  800adb:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800ade:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800ae3:	e9 e1 00 00 00       	jmp    800bc9 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800ae8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aeb:	8b 00                	mov    (%eax),%eax
+  800aed:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800af0:	89 c1                	mov    %eax,%ecx
+  800af2:	c1 f9 1f             	sar    $0x1f,%ecx
+  800af5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800af8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afb:	8d 40 04             	lea    0x4(%eax),%eax
+  800afe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b01:	eb b0                	jmp    800ab3 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800b03:	83 f9 01             	cmp    $0x1,%ecx
+  800b06:	7f 1e                	jg     800b26 <vprintfmt+0x319>
+	else if (lflag)
+  800b08:	85 c9                	test   %ecx,%ecx
+  800b0a:	74 32                	je     800b3e <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800b0c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b0f:	8b 10                	mov    (%eax),%edx
+  800b11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b16:	8d 40 04             	lea    0x4(%eax),%eax
+  800b19:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b1c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800b21:	e9 a3 00 00 00       	jmp    800bc9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800b26:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b29:	8b 10                	mov    (%eax),%edx
+  800b2b:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b2e:	8d 40 08             	lea    0x8(%eax),%eax
+  800b31:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b34:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800b39:	e9 8b 00 00 00       	jmp    800bc9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800b3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b41:	8b 10                	mov    (%eax),%edx
+  800b43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b48:	8d 40 04             	lea    0x4(%eax),%eax
+  800b4b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b4e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800b53:	eb 74                	jmp    800bc9 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800b55:	83 f9 01             	cmp    $0x1,%ecx
+  800b58:	7f 1b                	jg     800b75 <vprintfmt+0x368>
+	else if (lflag)
+  800b5a:	85 c9                	test   %ecx,%ecx
+  800b5c:	74 2c                	je     800b8a <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800b5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b61:	8b 10                	mov    (%eax),%edx
+  800b63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b68:	8d 40 04             	lea    0x4(%eax),%eax
+  800b6b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b6e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800b73:	eb 54                	jmp    800bc9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800b75:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b78:	8b 10                	mov    (%eax),%edx
+  800b7a:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b7d:	8d 40 08             	lea    0x8(%eax),%eax
+  800b80:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b83:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800b88:	eb 3f                	jmp    800bc9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800b8a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b8d:	8b 10                	mov    (%eax),%edx
+  800b8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b94:	8d 40 04             	lea    0x4(%eax),%eax
+  800b97:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b9a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800b9f:	eb 28                	jmp    800bc9 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800ba1:	83 ec 08             	sub    $0x8,%esp
+  800ba4:	53                   	push   %ebx
+  800ba5:	6a 30                	push   $0x30
+  800ba7:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800ba9:	83 c4 08             	add    $0x8,%esp
+  800bac:	53                   	push   %ebx
+  800bad:	6a 78                	push   $0x78
+  800baf:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800bb1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb4:	8b 10                	mov    (%eax),%edx
+  800bb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800bbb:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800bbe:	8d 40 04             	lea    0x4(%eax),%eax
+  800bc1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bc4:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800bc9:	83 ec 0c             	sub    $0xc,%esp
+  800bcc:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800bd0:	50                   	push   %eax
+  800bd1:	ff 75 e0             	push   -0x20(%ebp)
+  800bd4:	57                   	push   %edi
+  800bd5:	51                   	push   %ecx
+  800bd6:	52                   	push   %edx
+  800bd7:	89 da                	mov    %ebx,%edx
+  800bd9:	89 f0                	mov    %esi,%eax
+  800bdb:	e8 4a fb ff ff       	call   80072a <printnum>
+			break;
+  800be0:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800be3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800be6:	e9 40 fc ff ff       	jmp    80082b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800beb:	83 f9 01             	cmp    $0x1,%ecx
+  800bee:	7f 1b                	jg     800c0b <vprintfmt+0x3fe>
+	else if (lflag)
+  800bf0:	85 c9                	test   %ecx,%ecx
+  800bf2:	74 2c                	je     800c20 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800bf4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bf7:	8b 10                	mov    (%eax),%edx
+  800bf9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bfe:	8d 40 04             	lea    0x4(%eax),%eax
+  800c01:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c04:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800c09:	eb be                	jmp    800bc9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800c0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c0e:	8b 10                	mov    (%eax),%edx
+  800c10:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c13:	8d 40 08             	lea    0x8(%eax),%eax
+  800c16:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c19:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800c1e:	eb a9                	jmp    800bc9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800c20:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c23:	8b 10                	mov    (%eax),%edx
+  800c25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c2a:	8d 40 04             	lea    0x4(%eax),%eax
+  800c2d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c30:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800c35:	eb 92                	jmp    800bc9 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800c37:	83 ec 08             	sub    $0x8,%esp
+  800c3a:	53                   	push   %ebx
+  800c3b:	6a 25                	push   $0x25
+  800c3d:	ff d6                	call   *%esi
+			break;
+  800c3f:	83 c4 10             	add    $0x10,%esp
+  800c42:	eb 9f                	jmp    800be3 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800c44:	83 ec 08             	sub    $0x8,%esp
+  800c47:	53                   	push   %ebx
+  800c48:	6a 25                	push   $0x25
+  800c4a:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c4c:	83 c4 10             	add    $0x10,%esp
+  800c4f:	89 f8                	mov    %edi,%eax
+  800c51:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c55:	74 05                	je     800c5c <vprintfmt+0x44f>
+  800c57:	83 e8 01             	sub    $0x1,%eax
+  800c5a:	eb f5                	jmp    800c51 <vprintfmt+0x444>
+  800c5c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c5f:	eb 82                	jmp    800be3 <vprintfmt+0x3d6>
+
+00800c61 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c61:	55                   	push   %ebp
+  800c62:	89 e5                	mov    %esp,%ebp
+  800c64:	83 ec 18             	sub    $0x18,%esp
+  800c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c6d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c70:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c74:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c77:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c7e:	85 c0                	test   %eax,%eax
+  800c80:	74 26                	je     800ca8 <vsnprintf+0x47>
+  800c82:	85 d2                	test   %edx,%edx
+  800c84:	7e 22                	jle    800ca8 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c86:	ff 75 14             	push   0x14(%ebp)
+  800c89:	ff 75 10             	push   0x10(%ebp)
+  800c8c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c8f:	50                   	push   %eax
+  800c90:	68 d3 07 80 00       	push   $0x8007d3
+  800c95:	e8 73 fb ff ff       	call   80080d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c9a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c9d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ca0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ca3:	83 c4 10             	add    $0x10,%esp
+}
+  800ca6:	c9                   	leave
+  800ca7:	c3                   	ret
+		return -E_INVAL;
+  800ca8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cad:	eb f7                	jmp    800ca6 <vsnprintf+0x45>
+
+00800caf <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800caf:	55                   	push   %ebp
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800cb5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800cb8:	50                   	push   %eax
+  800cb9:	ff 75 10             	push   0x10(%ebp)
+  800cbc:	ff 75 0c             	push   0xc(%ebp)
+  800cbf:	ff 75 08             	push   0x8(%ebp)
+  800cc2:	e8 9a ff ff ff       	call   800c61 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800cc7:	c9                   	leave
+  800cc8:	c3                   	ret
+
+00800cc9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd4:	eb 03                	jmp    800cd9 <strlen+0x10>
+		n++;
+  800cd6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800cd9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800cdd:	75 f7                	jne    800cd6 <strlen+0xd>
+	return n;
+}
+  800cdf:	5d                   	pop    %ebp
+  800ce0:	c3                   	ret
+
+00800ce1 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ce7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cef:	eb 03                	jmp    800cf4 <strnlen+0x13>
+		n++;
+  800cf1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cf4:	39 d0                	cmp    %edx,%eax
+  800cf6:	74 08                	je     800d00 <strnlen+0x1f>
+  800cf8:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800cfc:	75 f3                	jne    800cf1 <strnlen+0x10>
+  800cfe:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800d00:	89 d0                	mov    %edx,%eax
+  800d02:	5d                   	pop    %ebp
+  800d03:	c3                   	ret
+
+00800d04 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d04:	55                   	push   %ebp
+  800d05:	89 e5                	mov    %esp,%ebp
+  800d07:	53                   	push   %ebx
+  800d08:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d0b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d13:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d17:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d1a:	83 c0 01             	add    $0x1,%eax
+  800d1d:	84 d2                	test   %dl,%dl
+  800d1f:	75 f2                	jne    800d13 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d21:	89 c8                	mov    %ecx,%eax
+  800d23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d26:	c9                   	leave
+  800d27:	c3                   	ret
+
+00800d28 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d28:	55                   	push   %ebp
+  800d29:	89 e5                	mov    %esp,%ebp
+  800d2b:	53                   	push   %ebx
+  800d2c:	83 ec 10             	sub    $0x10,%esp
+  800d2f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d32:	53                   	push   %ebx
+  800d33:	e8 91 ff ff ff       	call   800cc9 <strlen>
+  800d38:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d3b:	ff 75 0c             	push   0xc(%ebp)
+  800d3e:	01 d8                	add    %ebx,%eax
+  800d40:	50                   	push   %eax
+  800d41:	e8 be ff ff ff       	call   800d04 <strcpy>
+	return dst;
+}
+  800d46:	89 d8                	mov    %ebx,%eax
+  800d48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d4b:	c9                   	leave
+  800d4c:	c3                   	ret
+
+00800d4d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	56                   	push   %esi
+  800d51:	53                   	push   %ebx
+  800d52:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d55:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d58:	89 f3                	mov    %esi,%ebx
+  800d5a:	03 5d 10             	add    0x10(%ebp),%ebx
+  800d5d:	89 f0                	mov    %esi,%eax
+  800d5f:	eb 0f                	jmp    800d70 <strncpy+0x23>
+		*dst++ = *src;
+  800d61:	83 c0 01             	add    $0x1,%eax
+  800d64:	0f b6 0a             	movzbl (%edx),%ecx
+  800d67:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d6a:	80 f9 01             	cmp    $0x1,%cl
+  800d6d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d70:	39 d8                	cmp    %ebx,%eax
+  800d72:	75 ed                	jne    800d61 <strncpy+0x14>
+	}
+	return ret;
+}
+  800d74:	89 f0                	mov    %esi,%eax
+  800d76:	5b                   	pop    %ebx
+  800d77:	5e                   	pop    %esi
+  800d78:	5d                   	pop    %ebp
+  800d79:	c3                   	ret
+
+00800d7a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d7a:	55                   	push   %ebp
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	56                   	push   %esi
+  800d7e:	53                   	push   %ebx
+  800d7f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d85:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d88:	89 f0                	mov    %esi,%eax
+  800d8a:	85 d2                	test   %edx,%edx
+  800d8c:	74 21                	je     800daf <strlcpy+0x35>
+  800d8e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800d92:	89 f2                	mov    %esi,%edx
+  800d94:	eb 09                	jmp    800d9f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800d96:	83 c1 01             	add    $0x1,%ecx
+  800d99:	83 c2 01             	add    $0x1,%edx
+  800d9c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800d9f:	39 c2                	cmp    %eax,%edx
+  800da1:	74 09                	je     800dac <strlcpy+0x32>
+  800da3:	0f b6 19             	movzbl (%ecx),%ebx
+  800da6:	84 db                	test   %bl,%bl
+  800da8:	75 ec                	jne    800d96 <strlcpy+0x1c>
+  800daa:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800dac:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800daf:	29 f0                	sub    %esi,%eax
+}
+  800db1:	5b                   	pop    %ebx
+  800db2:	5e                   	pop    %esi
+  800db3:	5d                   	pop    %ebp
+  800db4:	c3                   	ret
+
+00800db5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800db5:	55                   	push   %ebp
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800dbe:	eb 06                	jmp    800dc6 <strcmp+0x11>
+		p++, q++;
+  800dc0:	83 c1 01             	add    $0x1,%ecx
+  800dc3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800dc6:	0f b6 01             	movzbl (%ecx),%eax
+  800dc9:	84 c0                	test   %al,%al
+  800dcb:	74 04                	je     800dd1 <strcmp+0x1c>
+  800dcd:	3a 02                	cmp    (%edx),%al
+  800dcf:	74 ef                	je     800dc0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800dd1:	0f b6 c0             	movzbl %al,%eax
+  800dd4:	0f b6 12             	movzbl (%edx),%edx
+  800dd7:	29 d0                	sub    %edx,%eax
+}
+  800dd9:	5d                   	pop    %ebp
+  800dda:	c3                   	ret
+
+00800ddb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	53                   	push   %ebx
+  800ddf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de5:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800de8:	eb 09                	jmp    800df3 <strncmp+0x18>
+		n--, p++, q++;
+  800dea:	83 ea 01             	sub    $0x1,%edx
+  800ded:	83 c0 01             	add    $0x1,%eax
+  800df0:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800df3:	85 d2                	test   %edx,%edx
+  800df5:	74 18                	je     800e0f <strncmp+0x34>
+  800df7:	0f b6 18             	movzbl (%eax),%ebx
+  800dfa:	84 db                	test   %bl,%bl
+  800dfc:	74 04                	je     800e02 <strncmp+0x27>
+  800dfe:	3a 19                	cmp    (%ecx),%bl
+  800e00:	74 e8                	je     800dea <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e02:	0f b6 00             	movzbl (%eax),%eax
+  800e05:	0f b6 11             	movzbl (%ecx),%edx
+  800e08:	29 d0                	sub    %edx,%eax
+}
+  800e0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e0d:	c9                   	leave
+  800e0e:	c3                   	ret
+		return 0;
+  800e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e14:	eb f4                	jmp    800e0a <strncmp+0x2f>
+
+00800e16 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e16:	55                   	push   %ebp
+  800e17:	89 e5                	mov    %esp,%ebp
+  800e19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e1c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e20:	eb 03                	jmp    800e25 <strchr+0xf>
+  800e22:	83 c0 01             	add    $0x1,%eax
+  800e25:	0f b6 10             	movzbl (%eax),%edx
+  800e28:	84 d2                	test   %dl,%dl
+  800e2a:	74 06                	je     800e32 <strchr+0x1c>
+		if (*s == c)
+  800e2c:	38 ca                	cmp    %cl,%dl
+  800e2e:	75 f2                	jne    800e22 <strchr+0xc>
+  800e30:	eb 05                	jmp    800e37 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800e32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e37:	5d                   	pop    %ebp
+  800e38:	c3                   	ret
+
+00800e39 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e39:	55                   	push   %ebp
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e3f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e43:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e46:	38 ca                	cmp    %cl,%dl
+  800e48:	74 09                	je     800e53 <strfind+0x1a>
+  800e4a:	84 d2                	test   %dl,%dl
+  800e4c:	74 05                	je     800e53 <strfind+0x1a>
+	for (; *s; s++)
+  800e4e:	83 c0 01             	add    $0x1,%eax
+  800e51:	eb f0                	jmp    800e43 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800e53:	5d                   	pop    %ebp
+  800e54:	c3                   	ret
+
+00800e55 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e5c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e5f:	85 c9                	test   %ecx,%ecx
+  800e61:	74 20                	je     800e83 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800e63:	89 f8                	mov    %edi,%eax
+  800e65:	09 c8                	or     %ecx,%eax
+  800e67:	a8 03                	test   $0x3,%al
+  800e69:	75 12                	jne    800e7d <memset+0x28>
+		c &= 0xFF;
+  800e6b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e6f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800e75:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800e78:	fc                   	cld
+  800e79:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e7b:	eb 06                	jmp    800e83 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800e7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e80:	fc                   	cld
+  800e81:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800e83:	89 f8                	mov    %edi,%eax
+  800e85:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e88:	c9                   	leave
+  800e89:	c3                   	ret
+
+00800e8a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	57                   	push   %edi
+  800e8e:	56                   	push   %esi
+  800e8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e92:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e95:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e98:	39 c6                	cmp    %eax,%esi
+  800e9a:	73 32                	jae    800ece <memmove+0x44>
+  800e9c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e9f:	39 d0                	cmp    %edx,%eax
+  800ea1:	73 2b                	jae    800ece <memmove+0x44>
+		s += n;
+		d += n;
+  800ea3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ea6:	89 d6                	mov    %edx,%esi
+  800ea8:	09 fe                	or     %edi,%esi
+  800eaa:	09 ce                	or     %ecx,%esi
+  800eac:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800eb2:	75 0e                	jne    800ec2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800eb4:	83 ef 04             	sub    $0x4,%edi
+  800eb7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800eba:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ebd:	fd                   	std
+  800ebe:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ec0:	eb 09                	jmp    800ecb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ec2:	83 ef 01             	sub    $0x1,%edi
+  800ec5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ec8:	fd                   	std
+  800ec9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ecb:	fc                   	cld
+  800ecc:	eb 1a                	jmp    800ee8 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ece:	89 f2                	mov    %esi,%edx
+  800ed0:	09 c2                	or     %eax,%edx
+  800ed2:	09 ca                	or     %ecx,%edx
+  800ed4:	f6 c2 03             	test   $0x3,%dl
+  800ed7:	75 0a                	jne    800ee3 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ed9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800edc:	89 c7                	mov    %eax,%edi
+  800ede:	fc                   	cld
+  800edf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ee1:	eb 05                	jmp    800ee8 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ee3:	89 c7                	mov    %eax,%edi
+  800ee5:	fc                   	cld
+  800ee6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ee8:	5e                   	pop    %esi
+  800ee9:	5f                   	pop    %edi
+  800eea:	5d                   	pop    %ebp
+  800eeb:	c3                   	ret
+
+00800eec <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ef2:	ff 75 10             	push   0x10(%ebp)
+  800ef5:	ff 75 0c             	push   0xc(%ebp)
+  800ef8:	ff 75 08             	push   0x8(%ebp)
+  800efb:	e8 8a ff ff ff       	call   800e8a <memmove>
+}
+  800f00:	c9                   	leave
+  800f01:	c3                   	ret
+
+00800f02 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f02:	55                   	push   %ebp
+  800f03:	89 e5                	mov    %esp,%ebp
+  800f05:	56                   	push   %esi
+  800f06:	53                   	push   %ebx
+  800f07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f0d:	89 c6                	mov    %eax,%esi
+  800f0f:	03 75 10             	add    0x10(%ebp),%esi
+  800f12:	eb 06                	jmp    800f1a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800f14:	83 c0 01             	add    $0x1,%eax
+  800f17:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800f1a:	39 f0                	cmp    %esi,%eax
+  800f1c:	74 14                	je     800f32 <memcmp+0x30>
+		if (*s1 != *s2)
+  800f1e:	0f b6 08             	movzbl (%eax),%ecx
+  800f21:	0f b6 1a             	movzbl (%edx),%ebx
+  800f24:	38 d9                	cmp    %bl,%cl
+  800f26:	74 ec                	je     800f14 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800f28:	0f b6 c1             	movzbl %cl,%eax
+  800f2b:	0f b6 db             	movzbl %bl,%ebx
+  800f2e:	29 d8                	sub    %ebx,%eax
+  800f30:	eb 05                	jmp    800f37 <memcmp+0x35>
+	}
+
+	return 0;
+  800f32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f37:	5b                   	pop    %ebx
+  800f38:	5e                   	pop    %esi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+
+00800f3b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f44:	89 c2                	mov    %eax,%edx
+  800f46:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f49:	eb 03                	jmp    800f4e <memfind+0x13>
+  800f4b:	83 c0 01             	add    $0x1,%eax
+  800f4e:	39 d0                	cmp    %edx,%eax
+  800f50:	73 04                	jae    800f56 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f52:	38 08                	cmp    %cl,(%eax)
+  800f54:	75 f5                	jne    800f4b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+
+00800f58 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f58:	55                   	push   %ebp
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	57                   	push   %edi
+  800f5c:	56                   	push   %esi
+  800f5d:	53                   	push   %ebx
+  800f5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800f64:	eb 03                	jmp    800f69 <strtol+0x11>
+		s++;
+  800f66:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800f69:	0f b6 02             	movzbl (%edx),%eax
+  800f6c:	3c 20                	cmp    $0x20,%al
+  800f6e:	74 f6                	je     800f66 <strtol+0xe>
+  800f70:	3c 09                	cmp    $0x9,%al
+  800f72:	74 f2                	je     800f66 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f74:	3c 2b                	cmp    $0x2b,%al
+  800f76:	74 2a                	je     800fa2 <strtol+0x4a>
+	int neg = 0;
+  800f78:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800f7d:	3c 2d                	cmp    $0x2d,%al
+  800f7f:	74 2b                	je     800fac <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f81:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f87:	75 0f                	jne    800f98 <strtol+0x40>
+  800f89:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f8c:	74 28                	je     800fb6 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f8e:	85 db                	test   %ebx,%ebx
+  800f90:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f95:	0f 44 d8             	cmove  %eax,%ebx
+  800f98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f9d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800fa0:	eb 46                	jmp    800fe8 <strtol+0x90>
+		s++;
+  800fa2:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800fa5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800faa:	eb d5                	jmp    800f81 <strtol+0x29>
+		s++, neg = 1;
+  800fac:	83 c2 01             	add    $0x1,%edx
+  800faf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800fb4:	eb cb                	jmp    800f81 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fb6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800fba:	74 0e                	je     800fca <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800fbc:	85 db                	test   %ebx,%ebx
+  800fbe:	75 d8                	jne    800f98 <strtol+0x40>
+		s++, base = 8;
+  800fc0:	83 c2 01             	add    $0x1,%edx
+  800fc3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800fc8:	eb ce                	jmp    800f98 <strtol+0x40>
+		s += 2, base = 16;
+  800fca:	83 c2 02             	add    $0x2,%edx
+  800fcd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800fd2:	eb c4                	jmp    800f98 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800fd4:	0f be c0             	movsbl %al,%eax
+  800fd7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800fda:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800fdd:	7d 3a                	jge    801019 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800fdf:	83 c2 01             	add    $0x1,%edx
+  800fe2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800fe6:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800fe8:	0f b6 02             	movzbl (%edx),%eax
+  800feb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800fee:	89 f3                	mov    %esi,%ebx
+  800ff0:	80 fb 09             	cmp    $0x9,%bl
+  800ff3:	76 df                	jbe    800fd4 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ff5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ff8:	89 f3                	mov    %esi,%ebx
+  800ffa:	80 fb 19             	cmp    $0x19,%bl
+  800ffd:	77 08                	ja     801007 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800fff:	0f be c0             	movsbl %al,%eax
+  801002:	83 e8 57             	sub    $0x57,%eax
+  801005:	eb d3                	jmp    800fda <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801007:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80100a:	89 f3                	mov    %esi,%ebx
+  80100c:	80 fb 19             	cmp    $0x19,%bl
+  80100f:	77 08                	ja     801019 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801011:	0f be c0             	movsbl %al,%eax
+  801014:	83 e8 37             	sub    $0x37,%eax
+  801017:	eb c1                	jmp    800fda <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801019:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80101d:	74 05                	je     801024 <strtol+0xcc>
+		*endptr = (char *) s;
+  80101f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801022:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801024:	89 c8                	mov    %ecx,%eax
+  801026:	f7 d8                	neg    %eax
+  801028:	85 ff                	test   %edi,%edi
+  80102a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80102d:	89 c8                	mov    %ecx,%eax
+  80102f:	5b                   	pop    %ebx
+  801030:	5e                   	pop    %esi
+  801031:	5f                   	pop    %edi
+  801032:	5d                   	pop    %ebp
+  801033:	c3                   	ret
+
+00801034 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	57                   	push   %edi
+  801038:	56                   	push   %esi
+  801039:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80103f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801042:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801045:	89 c3                	mov    %eax,%ebx
+  801047:	89 c7                	mov    %eax,%edi
+  801049:	89 c6                	mov    %eax,%esi
+  80104b:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80104d:	5b                   	pop    %ebx
+  80104e:	5e                   	pop    %esi
+  80104f:	5f                   	pop    %edi
+  801050:	5d                   	pop    %ebp
+  801051:	c3                   	ret
+
+00801052 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801052:	55                   	push   %ebp
+  801053:	89 e5                	mov    %esp,%ebp
+  801055:	57                   	push   %edi
+  801056:	56                   	push   %esi
+  801057:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801058:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801062:	89 d1                	mov    %edx,%ecx
+  801064:	89 d3                	mov    %edx,%ebx
+  801066:	89 d7                	mov    %edx,%edi
+  801068:	89 d6                	mov    %edx,%esi
+  80106a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80106c:	5b                   	pop    %ebx
+  80106d:	5e                   	pop    %esi
+  80106e:	5f                   	pop    %edi
+  80106f:	5d                   	pop    %ebp
+  801070:	c3                   	ret
+
+00801071 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  801071:	55                   	push   %ebp
+  801072:	89 e5                	mov    %esp,%ebp
+  801074:	57                   	push   %edi
+  801075:	56                   	push   %esi
+  801076:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801077:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80107c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801084:	89 cb                	mov    %ecx,%ebx
+  801086:	89 cf                	mov    %ecx,%edi
+  801088:	89 ce                	mov    %ecx,%esi
+  80108a:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  80108c:	5b                   	pop    %ebx
+  80108d:	5e                   	pop    %esi
+  80108e:	5f                   	pop    %edi
+  80108f:	5d                   	pop    %ebp
+  801090:	c3                   	ret
+
+00801091 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801091:	55                   	push   %ebp
+  801092:	89 e5                	mov    %esp,%ebp
+  801094:	57                   	push   %edi
+  801095:	56                   	push   %esi
+  801096:	53                   	push   %ebx
+  801097:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80109a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80109f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010a7:	89 cb                	mov    %ecx,%ebx
+  8010a9:	89 cf                	mov    %ecx,%edi
+  8010ab:	89 ce                	mov    %ecx,%esi
+  8010ad:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010af:	85 c0                	test   %eax,%eax
+  8010b1:	7f 08                	jg     8010bb <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8010b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b6:	5b                   	pop    %ebx
+  8010b7:	5e                   	pop    %esi
+  8010b8:	5f                   	pop    %edi
+  8010b9:	5d                   	pop    %ebp
+  8010ba:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010bb:	83 ec 0c             	sub    $0xc,%esp
+  8010be:	50                   	push   %eax
+  8010bf:	6a 03                	push   $0x3
+  8010c1:	68 df 30 80 00       	push   $0x8030df
+  8010c6:	6a 23                	push   $0x23
+  8010c8:	68 fc 30 80 00       	push   $0x8030fc
+  8010cd:	e8 69 f5 ff ff       	call   80063b <_panic>
+
+008010d2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8010d2:	55                   	push   %ebp
+  8010d3:	89 e5                	mov    %esp,%ebp
+  8010d5:	57                   	push   %edi
+  8010d6:	56                   	push   %esi
+  8010d7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010dd:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010e2:	89 d1                	mov    %edx,%ecx
+  8010e4:	89 d3                	mov    %edx,%ebx
+  8010e6:	89 d7                	mov    %edx,%edi
+  8010e8:	89 d6                	mov    %edx,%esi
+  8010ea:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8010ec:	5b                   	pop    %ebx
+  8010ed:	5e                   	pop    %esi
+  8010ee:	5f                   	pop    %edi
+  8010ef:	5d                   	pop    %ebp
+  8010f0:	c3                   	ret
+
+008010f1 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8010f1:	55                   	push   %ebp
+  8010f2:	89 e5                	mov    %esp,%ebp
+  8010f4:	57                   	push   %edi
+  8010f5:	56                   	push   %esi
+  8010f6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fc:	b8 16 00 00 00       	mov    $0x16,%eax
+  801101:	89 d1                	mov    %edx,%ecx
+  801103:	89 d3                	mov    %edx,%ebx
+  801105:	89 d7                	mov    %edx,%edi
+  801107:	89 d6                	mov    %edx,%esi
+  801109:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80110b:	5b                   	pop    %ebx
+  80110c:	5e                   	pop    %esi
+  80110d:	5f                   	pop    %edi
+  80110e:	5d                   	pop    %ebp
+  80110f:	c3                   	ret
+
+00801110 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	57                   	push   %edi
+  801114:	56                   	push   %esi
+  801115:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801120:	89 d1                	mov    %edx,%ecx
+  801122:	89 d3                	mov    %edx,%ebx
+  801124:	89 d7                	mov    %edx,%edi
+  801126:	89 d6                	mov    %edx,%esi
+  801128:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  80112a:	5b                   	pop    %ebx
+  80112b:	5e                   	pop    %esi
+  80112c:	5f                   	pop    %edi
+  80112d:	5d                   	pop    %ebp
+  80112e:	c3                   	ret
+
+0080112f <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  80112f:	55                   	push   %ebp
+  801130:	89 e5                	mov    %esp,%ebp
+  801132:	57                   	push   %edi
+  801133:	56                   	push   %esi
+  801134:	53                   	push   %ebx
+  801135:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801138:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801140:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801143:	b8 15 00 00 00       	mov    $0x15,%eax
+  801148:	89 df                	mov    %ebx,%edi
+  80114a:	89 de                	mov    %ebx,%esi
+  80114c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80114e:	85 c0                	test   %eax,%eax
+  801150:	7f 08                	jg     80115a <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  801152:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801155:	5b                   	pop    %ebx
+  801156:	5e                   	pop    %esi
+  801157:	5f                   	pop    %edi
+  801158:	5d                   	pop    %ebp
+  801159:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80115a:	83 ec 0c             	sub    $0xc,%esp
+  80115d:	50                   	push   %eax
+  80115e:	6a 15                	push   $0x15
+  801160:	68 df 30 80 00       	push   $0x8030df
+  801165:	6a 23                	push   $0x23
+  801167:	68 fc 30 80 00       	push   $0x8030fc
+  80116c:	e8 ca f4 ff ff       	call   80063b <_panic>
+
+00801171 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801171:	55                   	push   %ebp
+  801172:	89 e5                	mov    %esp,%ebp
+  801174:	57                   	push   %edi
+  801175:	56                   	push   %esi
+  801176:	53                   	push   %ebx
+  801177:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80117a:	be 00 00 00 00       	mov    $0x0,%esi
+  80117f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801182:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801185:	b8 05 00 00 00       	mov    $0x5,%eax
+  80118a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80118d:	89 f7                	mov    %esi,%edi
+  80118f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801191:	85 c0                	test   %eax,%eax
+  801193:	7f 08                	jg     80119d <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801195:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801198:	5b                   	pop    %ebx
+  801199:	5e                   	pop    %esi
+  80119a:	5f                   	pop    %edi
+  80119b:	5d                   	pop    %ebp
+  80119c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119d:	83 ec 0c             	sub    $0xc,%esp
+  8011a0:	50                   	push   %eax
+  8011a1:	6a 05                	push   $0x5
+  8011a3:	68 df 30 80 00       	push   $0x8030df
+  8011a8:	6a 23                	push   $0x23
+  8011aa:	68 fc 30 80 00       	push   $0x8030fc
+  8011af:	e8 87 f4 ff ff       	call   80063b <_panic>
+
+008011b4 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  8011b4:	55                   	push   %ebp
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	57                   	push   %edi
+  8011b8:	56                   	push   %esi
+  8011b9:	53                   	push   %ebx
+  8011ba:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d0:	89 f7                	mov    %esi,%edi
+  8011d2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d4:	85 c0                	test   %eax,%eax
+  8011d6:	7f 08                	jg     8011e0 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8011d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011db:	5b                   	pop    %ebx
+  8011dc:	5e                   	pop    %esi
+  8011dd:	5f                   	pop    %edi
+  8011de:	5d                   	pop    %ebp
+  8011df:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e0:	83 ec 0c             	sub    $0xc,%esp
+  8011e3:	50                   	push   %eax
+  8011e4:	6a 06                	push   $0x6
+  8011e6:	68 df 30 80 00       	push   $0x8030df
+  8011eb:	6a 23                	push   $0x23
+  8011ed:	68 fc 30 80 00       	push   $0x8030fc
+  8011f2:	e8 44 f4 ff ff       	call   80063b <_panic>
+
+008011f7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8011f7:	55                   	push   %ebp
+  8011f8:	89 e5                	mov    %esp,%ebp
+  8011fa:	57                   	push   %edi
+  8011fb:	56                   	push   %esi
+  8011fc:	53                   	push   %ebx
+  8011fd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801200:	8b 55 08             	mov    0x8(%ebp),%edx
+  801203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801206:	b8 07 00 00 00       	mov    $0x7,%eax
+  80120b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801211:	8b 75 18             	mov    0x18(%ebp),%esi
+  801214:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801216:	85 c0                	test   %eax,%eax
+  801218:	7f 08                	jg     801222 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80121a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121d:	5b                   	pop    %ebx
+  80121e:	5e                   	pop    %esi
+  80121f:	5f                   	pop    %edi
+  801220:	5d                   	pop    %ebp
+  801221:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801222:	83 ec 0c             	sub    $0xc,%esp
+  801225:	50                   	push   %eax
+  801226:	6a 07                	push   $0x7
+  801228:	68 df 30 80 00       	push   $0x8030df
+  80122d:	6a 23                	push   $0x23
+  80122f:	68 fc 30 80 00       	push   $0x8030fc
+  801234:	e8 02 f4 ff ff       	call   80063b <_panic>
+
+00801239 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801239:	55                   	push   %ebp
+  80123a:	89 e5                	mov    %esp,%ebp
+  80123c:	57                   	push   %edi
+  80123d:	56                   	push   %esi
+  80123e:	53                   	push   %ebx
+  80123f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801242:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801247:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801252:	89 df                	mov    %ebx,%edi
+  801254:	89 de                	mov    %ebx,%esi
+  801256:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801258:	85 c0                	test   %eax,%eax
+  80125a:	7f 08                	jg     801264 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80125c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125f:	5b                   	pop    %ebx
+  801260:	5e                   	pop    %esi
+  801261:	5f                   	pop    %edi
+  801262:	5d                   	pop    %ebp
+  801263:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801264:	83 ec 0c             	sub    $0xc,%esp
+  801267:	50                   	push   %eax
+  801268:	6a 08                	push   $0x8
+  80126a:	68 df 30 80 00       	push   $0x8030df
+  80126f:	6a 23                	push   $0x23
+  801271:	68 fc 30 80 00       	push   $0x8030fc
+  801276:	e8 c0 f3 ff ff       	call   80063b <_panic>
+
+0080127b <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  80127b:	55                   	push   %ebp
+  80127c:	89 e5                	mov    %esp,%ebp
+  80127e:	57                   	push   %edi
+  80127f:	56                   	push   %esi
+  801280:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801281:	8b 55 08             	mov    0x8(%ebp),%edx
+  801284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801287:	b8 09 00 00 00       	mov    $0x9,%eax
+  80128c:	be 00 00 00 00       	mov    $0x0,%esi
+  801291:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801294:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801297:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5f                   	pop    %edi
+  80129c:	5d                   	pop    %ebp
+  80129d:	c3                   	ret
+
+0080129e <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  80129e:	55                   	push   %ebp
+  80129f:	89 e5                	mov    %esp,%ebp
+  8012a1:	57                   	push   %edi
+  8012a2:	56                   	push   %esi
+  8012a3:	53                   	push   %ebx
+  8012a4:	8b 45 18             	mov    0x18(%ebp),%eax
+  8012a7:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  8012aa:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  8012af:	77 27                	ja     8012d8 <sys_page_map_range+0x3a>
+  8012b1:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8012b7:	77 1f                	ja     8012d8 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  8012b9:	c1 e0 0c             	shl    $0xc,%eax
+  8012bc:	89 c6                	mov    %eax,%esi
+  8012be:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  8012c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ce:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012d1:	cd 30                	int    $0x30
+}
+  8012d3:	5b                   	pop    %ebx
+  8012d4:	5e                   	pop    %esi
+  8012d5:	5f                   	pop    %edi
+  8012d6:	5d                   	pop    %ebp
+  8012d7:	c3                   	ret
+		return -E_INVAL;
+  8012d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012dd:	eb f4                	jmp    8012d3 <sys_page_map_range+0x35>
+
+008012df <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+  8012e2:	57                   	push   %edi
+  8012e3:	56                   	push   %esi
+  8012e4:	53                   	push   %ebx
+  8012e5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012fe:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801300:	85 c0                	test   %eax,%eax
+  801302:	7f 08                	jg     80130c <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801304:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801307:	5b                   	pop    %ebx
+  801308:	5e                   	pop    %esi
+  801309:	5f                   	pop    %edi
+  80130a:	5d                   	pop    %ebp
+  80130b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80130c:	83 ec 0c             	sub    $0xc,%esp
+  80130f:	50                   	push   %eax
+  801310:	6a 0c                	push   $0xc
+  801312:	68 df 30 80 00       	push   $0x8030df
+  801317:	6a 23                	push   $0x23
+  801319:	68 fc 30 80 00       	push   $0x8030fc
+  80131e:	e8 18 f3 ff ff       	call   80063b <_panic>
+
+00801323 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  801323:	55                   	push   %ebp
+  801324:	89 e5                	mov    %esp,%ebp
+  801326:	57                   	push   %edi
+  801327:	56                   	push   %esi
+  801328:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801329:	be 00 00 00 00       	mov    $0x0,%esi
+  80132e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801331:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801334:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801339:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80133c:	89 f7                	mov    %esi,%edi
+  80133e:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  801340:	5b                   	pop    %ebx
+  801341:	5e                   	pop    %esi
+  801342:	5f                   	pop    %edi
+  801343:	5d                   	pop    %ebp
+  801344:	c3                   	ret
+
+00801345 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80134e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801353:	8b 55 08             	mov    0x8(%ebp),%edx
+  801356:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801359:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80135e:	89 df                	mov    %ebx,%edi
+  801360:	89 de                	mov    %ebx,%esi
+  801362:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801364:	85 c0                	test   %eax,%eax
+  801366:	7f 08                	jg     801370 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801368:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136b:	5b                   	pop    %ebx
+  80136c:	5e                   	pop    %esi
+  80136d:	5f                   	pop    %edi
+  80136e:	5d                   	pop    %ebp
+  80136f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801370:	83 ec 0c             	sub    $0xc,%esp
+  801373:	50                   	push   %eax
+  801374:	6a 0f                	push   $0xf
+  801376:	68 df 30 80 00       	push   $0x8030df
+  80137b:	6a 23                	push   $0x23
+  80137d:	68 fc 30 80 00       	push   $0x8030fc
+  801382:	e8 b4 f2 ff ff       	call   80063b <_panic>
+
+00801387 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	57                   	push   %edi
+  80138b:	56                   	push   %esi
+  80138c:	53                   	push   %ebx
+  80138d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801390:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139b:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013a0:	89 df                	mov    %ebx,%edi
+  8013a2:	89 de                	mov    %ebx,%esi
+  8013a4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013a6:	85 c0                	test   %eax,%eax
+  8013a8:	7f 08                	jg     8013b2 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  8013aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ad:	5b                   	pop    %ebx
+  8013ae:	5e                   	pop    %esi
+  8013af:	5f                   	pop    %edi
+  8013b0:	5d                   	pop    %ebp
+  8013b1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b2:	83 ec 0c             	sub    $0xc,%esp
+  8013b5:	50                   	push   %eax
+  8013b6:	6a 10                	push   $0x10
+  8013b8:	68 df 30 80 00       	push   $0x8030df
+  8013bd:	6a 23                	push   $0x23
+  8013bf:	68 fc 30 80 00       	push   $0x8030fc
+  8013c4:	e8 72 f2 ff ff       	call   80063b <_panic>
+
+008013c9 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8013c9:	55                   	push   %ebp
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	57                   	push   %edi
+  8013cd:	56                   	push   %esi
+  8013ce:	53                   	push   %ebx
+  8013cf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013dd:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013e2:	89 df                	mov    %ebx,%edi
+  8013e4:	89 de                	mov    %ebx,%esi
+  8013e6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013e8:	85 c0                	test   %eax,%eax
+  8013ea:	7f 08                	jg     8013f4 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  8013ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ef:	5b                   	pop    %ebx
+  8013f0:	5e                   	pop    %esi
+  8013f1:	5f                   	pop    %edi
+  8013f2:	5d                   	pop    %ebp
+  8013f3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f4:	83 ec 0c             	sub    $0xc,%esp
+  8013f7:	50                   	push   %eax
+  8013f8:	6a 11                	push   $0x11
+  8013fa:	68 df 30 80 00       	push   $0x8030df
+  8013ff:	6a 23                	push   $0x23
+  801401:	68 fc 30 80 00       	push   $0x8030fc
+  801406:	e8 30 f2 ff ff       	call   80063b <_panic>
+
+0080140b <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  80140b:	55                   	push   %ebp
+  80140c:	89 e5                	mov    %esp,%ebp
+  80140e:	57                   	push   %edi
+  80140f:	56                   	push   %esi
+  801410:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801411:	ba 00 00 00 00       	mov    $0x0,%edx
+  801416:	b8 12 00 00 00       	mov    $0x12,%eax
+  80141b:	89 d1                	mov    %edx,%ecx
+  80141d:	89 d3                	mov    %edx,%ebx
+  80141f:	89 d7                	mov    %edx,%edi
+  801421:	89 d6                	mov    %edx,%esi
+  801423:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  801425:	5b                   	pop    %ebx
+  801426:	5e                   	pop    %esi
+  801427:	5f                   	pop    %edi
+  801428:	5d                   	pop    %ebp
+  801429:	c3                   	ret
+
+0080142a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80142a:	55                   	push   %ebp
+  80142b:	89 e5                	mov    %esp,%ebp
+  80142d:	57                   	push   %edi
+  80142e:	56                   	push   %esi
+  80142f:	53                   	push   %ebx
+  801430:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801433:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801438:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801443:	89 df                	mov    %ebx,%edi
+  801445:	89 de                	mov    %ebx,%esi
+  801447:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801449:	85 c0                	test   %eax,%eax
+  80144b:	7f 08                	jg     801455 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80144d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801450:	5b                   	pop    %ebx
+  801451:	5e                   	pop    %esi
+  801452:	5f                   	pop    %edi
+  801453:	5d                   	pop    %ebp
+  801454:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801455:	83 ec 0c             	sub    $0xc,%esp
+  801458:	50                   	push   %eax
+  801459:	6a 13                	push   $0x13
+  80145b:	68 df 30 80 00       	push   $0x8030df
+  801460:	6a 23                	push   $0x23
+  801462:	68 fc 30 80 00       	push   $0x8030fc
+  801467:	e8 cf f1 ff ff       	call   80063b <_panic>
+
+0080146c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80146c:	55                   	push   %ebp
+  80146d:	89 e5                	mov    %esp,%ebp
+  80146f:	57                   	push   %edi
+  801470:	56                   	push   %esi
+  801471:	53                   	push   %ebx
+  801472:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801475:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80147a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801480:	b8 14 00 00 00       	mov    $0x14,%eax
+  801485:	89 df                	mov    %ebx,%edi
+  801487:	89 de                	mov    %ebx,%esi
+  801489:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80148b:	85 c0                	test   %eax,%eax
+  80148d:	7f 08                	jg     801497 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80148f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801492:	5b                   	pop    %ebx
+  801493:	5e                   	pop    %esi
+  801494:	5f                   	pop    %edi
+  801495:	5d                   	pop    %ebp
+  801496:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801497:	83 ec 0c             	sub    $0xc,%esp
+  80149a:	50                   	push   %eax
+  80149b:	6a 14                	push   $0x14
+  80149d:	68 df 30 80 00       	push   $0x8030df
+  8014a2:	6a 23                	push   $0x23
+  8014a4:	68 fc 30 80 00       	push   $0x8030fc
+  8014a9:	e8 8d f1 ff ff       	call   80063b <_panic>
+
+008014ae <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8014ae:	55                   	push   %ebp
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	57                   	push   %edi
+  8014b2:	56                   	push   %esi
+  8014b3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ba:	b8 17 00 00 00       	mov    $0x17,%eax
+  8014bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014ca:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8014cc:	5b                   	pop    %ebx
+  8014cd:	5e                   	pop    %esi
+  8014ce:	5f                   	pop    %edi
+  8014cf:	5d                   	pop    %ebp
+  8014d0:	c3                   	ret
+
+008014d1 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8014d1:	55                   	push   %ebp
+  8014d2:	89 e5                	mov    %esp,%ebp
+  8014d4:	57                   	push   %edi
+  8014d5:	56                   	push   %esi
+  8014d6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014dd:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014ed:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8014ef:	5b                   	pop    %ebx
+  8014f0:	5e                   	pop    %esi
+  8014f1:	5f                   	pop    %edi
+  8014f2:	5d                   	pop    %ebp
+  8014f3:	c3                   	ret
+
+008014f4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8014f4:	55                   	push   %ebp
+  8014f5:	89 e5                	mov    %esp,%ebp
+  8014f7:	57                   	push   %edi
+  8014f8:	56                   	push   %esi
+  8014f9:	53                   	push   %ebx
+  8014fa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8014fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801502:	8b 55 08             	mov    0x8(%ebp),%edx
+  801505:	b8 19 00 00 00       	mov    $0x19,%eax
+  80150a:	89 cb                	mov    %ecx,%ebx
+  80150c:	89 cf                	mov    %ecx,%edi
+  80150e:	89 ce                	mov    %ecx,%esi
+  801510:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801512:	85 c0                	test   %eax,%eax
+  801514:	7f 08                	jg     80151e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801516:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801519:	5b                   	pop    %ebx
+  80151a:	5e                   	pop    %esi
+  80151b:	5f                   	pop    %edi
+  80151c:	5d                   	pop    %ebp
+  80151d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80151e:	83 ec 0c             	sub    $0xc,%esp
+  801521:	50                   	push   %eax
+  801522:	6a 19                	push   $0x19
+  801524:	68 df 30 80 00       	push   $0x8030df
+  801529:	6a 23                	push   $0x23
+  80152b:	68 fc 30 80 00       	push   $0x8030fc
+  801530:	e8 06 f1 ff ff       	call   80063b <_panic>
+
+00801535 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+  801538:	57                   	push   %edi
+  801539:	56                   	push   %esi
+  80153a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80153b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801540:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801545:	89 d1                	mov    %edx,%ecx
+  801547:	89 d3                	mov    %edx,%ebx
+  801549:	89 d7                	mov    %edx,%edi
+  80154b:	89 d6                	mov    %edx,%esi
+  80154d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80154f:	5b                   	pop    %ebx
+  801550:	5e                   	pop    %esi
+  801551:	5f                   	pop    %edi
+  801552:	5d                   	pop    %ebp
+  801553:	c3                   	ret
+
+00801554 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801554:	55                   	push   %ebp
+  801555:	89 e5                	mov    %esp,%ebp
+  801557:	57                   	push   %edi
+  801558:	56                   	push   %esi
+  801559:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80155a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801562:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801565:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80156a:	89 df                	mov    %ebx,%edi
+  80156c:	89 de                	mov    %ebx,%esi
+  80156e:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801570:	5b                   	pop    %ebx
+  801571:	5e                   	pop    %esi
+  801572:	5f                   	pop    %edi
+  801573:	5d                   	pop    %ebp
+  801574:	c3                   	ret
+
+00801575 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801575:	55                   	push   %ebp
+  801576:	89 e5                	mov    %esp,%ebp
+  801578:	57                   	push   %edi
+  801579:	56                   	push   %esi
+  80157a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80157b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801580:	8b 55 08             	mov    0x8(%ebp),%edx
+  801583:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801586:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80158b:	89 df                	mov    %ebx,%edi
+  80158d:	89 de                	mov    %ebx,%esi
+  80158f:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801591:	5b                   	pop    %ebx
+  801592:	5e                   	pop    %esi
+  801593:	5f                   	pop    %edi
+  801594:	5d                   	pop    %ebp
+  801595:	c3                   	ret
+
+00801596 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801596:	55                   	push   %ebp
+  801597:	89 e5                	mov    %esp,%ebp
+  801599:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80159c:	83 3d b8 50 80 00 00 	cmpl   $0x0,0x8050b8
+  8015a3:	74 0a                	je     8015af <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8015a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015a8:	a3 b8 50 80 00       	mov    %eax,0x8050b8
+}
+  8015ad:	c9                   	leave
+  8015ae:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  8015af:	83 ec 04             	sub    $0x4,%esp
+  8015b2:	6a 07                	push   $0x7
+  8015b4:	68 00 f0 bf ee       	push   $0xeebff000
+  8015b9:	6a 00                	push   $0x0
+  8015bb:	e8 b1 fb ff ff       	call   801171 <sys_page_alloc>
+  8015c0:	83 c4 10             	add    $0x10,%esp
+  8015c3:	85 c0                	test   %eax,%eax
+  8015c5:	78 28                	js     8015ef <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  8015c7:	83 ec 08             	sub    $0x8,%esp
+  8015ca:	68 01 16 80 00       	push   $0x801601
+  8015cf:	6a 00                	push   $0x0
+  8015d1:	e8 96 fe ff ff       	call   80146c <sys_env_set_pgfault_upcall>
+  8015d6:	83 c4 10             	add    $0x10,%esp
+  8015d9:	85 c0                	test   %eax,%eax
+  8015db:	79 c8                	jns    8015a5 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  8015dd:	50                   	push   %eax
+  8015de:	68 18 31 80 00       	push   $0x803118
+  8015e3:	6a 24                	push   $0x24
+  8015e5:	68 0a 31 80 00       	push   $0x80310a
+  8015ea:	e8 4c f0 ff ff       	call   80063b <_panic>
+			panic("sys_page_alloc: %e", r);
+  8015ef:	50                   	push   %eax
+  8015f0:	68 34 2d 80 00       	push   $0x802d34
+  8015f5:	6a 21                	push   $0x21
+  8015f7:	68 0a 31 80 00       	push   $0x80310a
+  8015fc:	e8 3a f0 ff ff       	call   80063b <_panic>
+
+00801601 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801601:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801602:	a1 b8 50 80 00       	mov    0x8050b8,%eax
+	call *%eax
+  801607:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801609:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  80160c:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  80160f:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  801613:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  801616:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  80161a:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  80161e:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  801620:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  801621:	83 c4 04             	add    $0x4,%esp
+	popf
+  801624:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  801625:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801626:	c3                   	ret
+
+00801627 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801627:	55                   	push   %ebp
+  801628:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80162a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80162d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801632:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801635:	5d                   	pop    %ebp
+  801636:	c3                   	ret
+
+00801637 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801637:	55                   	push   %ebp
+  801638:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80163a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80163d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801642:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801647:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80164c:	5d                   	pop    %ebp
+  80164d:	c3                   	ret
+
+0080164e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80164e:	55                   	push   %ebp
+  80164f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801651:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801656:	eb 02                	jmp    80165a <fd_alloc+0xc>
+  801658:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80165a:	89 c2                	mov    %eax,%edx
+  80165c:	c1 ea 16             	shr    $0x16,%edx
+  80165f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801666:	f6 c2 01             	test   $0x1,%dl
+  801669:	74 2b                	je     801696 <fd_alloc+0x48>
+  80166b:	89 c2                	mov    %eax,%edx
+  80166d:	c1 ea 0c             	shr    $0xc,%edx
+  801670:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801677:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80167d:	f6 c1 01             	test   $0x1,%cl
+  801680:	74 14                	je     801696 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801682:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801688:	75 ce                	jne    801658 <fd_alloc+0xa>
+  80168a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80168f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801694:	eb 05                	jmp    80169b <fd_alloc+0x4d>
+			return 0;
+  801696:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80169b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169e:	89 02                	mov    %eax,(%edx)
+}
+  8016a0:	89 c8                	mov    %ecx,%eax
+  8016a2:	5d                   	pop    %ebp
+  8016a3:	c3                   	ret
+
+008016a4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8016a4:	55                   	push   %ebp
+  8016a5:	89 e5                	mov    %esp,%ebp
+  8016a7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8016aa:	83 f8 1f             	cmp    $0x1f,%eax
+  8016ad:	77 30                	ja     8016df <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8016af:	c1 e0 0c             	shl    $0xc,%eax
+  8016b2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8016b7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8016bd:	f6 c2 01             	test   $0x1,%dl
+  8016c0:	74 24                	je     8016e6 <fd_lookup+0x42>
+  8016c2:	89 c2                	mov    %eax,%edx
+  8016c4:	c1 ea 0c             	shr    $0xc,%edx
+  8016c7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016ce:	f6 c2 01             	test   $0x1,%dl
+  8016d1:	74 1a                	je     8016ed <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8016d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016d6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8016d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016dd:	5d                   	pop    %ebp
+  8016de:	c3                   	ret
+		return -E_INVAL;
+  8016df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e4:	eb f7                	jmp    8016dd <fd_lookup+0x39>
+		return -E_INVAL;
+  8016e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016eb:	eb f0                	jmp    8016dd <fd_lookup+0x39>
+  8016ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f2:	eb e9                	jmp    8016dd <fd_lookup+0x39>
+
+008016f4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8016f4:	55                   	push   %ebp
+  8016f5:	89 e5                	mov    %esp,%ebp
+  8016f7:	53                   	push   %ebx
+  8016f8:	83 ec 04             	sub    $0x4,%esp
+  8016fb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8016fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801703:	eb 03                	jmp    801708 <dev_lookup+0x14>
+  801705:	83 c0 01             	add    $0x1,%eax
+  801708:	8b 1c 85 b4 31 80 00 	mov    0x8031b4(,%eax,4),%ebx
+  80170f:	85 db                	test   %ebx,%ebx
+  801711:	74 0b                	je     80171e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801713:	39 13                	cmp    %edx,(%ebx)
+  801715:	75 ee                	jne    801705 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801717:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171c:	eb 1f                	jmp    80173d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80171e:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  801723:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801726:	83 ec 04             	sub    $0x4,%esp
+  801729:	52                   	push   %edx
+  80172a:	50                   	push   %eax
+  80172b:	68 38 31 80 00       	push   $0x803138
+  801730:	e8 e1 ef ff ff       	call   800716 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801735:	83 c4 10             	add    $0x10,%esp
+  801738:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80173d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801740:	89 1a                	mov    %ebx,(%edx)
+}
+  801742:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801745:	c9                   	leave
+  801746:	c3                   	ret
+
+00801747 <fd_close>:
+{
+  801747:	55                   	push   %ebp
+  801748:	89 e5                	mov    %esp,%ebp
+  80174a:	57                   	push   %edi
+  80174b:	56                   	push   %esi
+  80174c:	53                   	push   %ebx
+  80174d:	83 ec 24             	sub    $0x24,%esp
+  801750:	8b 75 08             	mov    0x8(%ebp),%esi
+  801753:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801756:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801759:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80175a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801760:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801763:	50                   	push   %eax
+  801764:	e8 3b ff ff ff       	call   8016a4 <fd_lookup>
+  801769:	89 c3                	mov    %eax,%ebx
+  80176b:	83 c4 10             	add    $0x10,%esp
+  80176e:	85 c0                	test   %eax,%eax
+  801770:	78 05                	js     801777 <fd_close+0x30>
+	    || fd != fd2)
+  801772:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801775:	74 16                	je     80178d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801777:	89 f8                	mov    %edi,%eax
+  801779:	84 c0                	test   %al,%al
+  80177b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801780:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801783:	89 d8                	mov    %ebx,%eax
+  801785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801788:	5b                   	pop    %ebx
+  801789:	5e                   	pop    %esi
+  80178a:	5f                   	pop    %edi
+  80178b:	5d                   	pop    %ebp
+  80178c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80178d:	83 ec 08             	sub    $0x8,%esp
+  801790:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801793:	50                   	push   %eax
+  801794:	ff 36                	push   (%esi)
+  801796:	e8 59 ff ff ff       	call   8016f4 <dev_lookup>
+  80179b:	89 c3                	mov    %eax,%ebx
+  80179d:	83 c4 10             	add    $0x10,%esp
+  8017a0:	85 c0                	test   %eax,%eax
+  8017a2:	78 1a                	js     8017be <fd_close+0x77>
+		if (dev->dev_close)
+  8017a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017a7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8017aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	74 0b                	je     8017be <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8017b3:	83 ec 0c             	sub    $0xc,%esp
+  8017b6:	56                   	push   %esi
+  8017b7:	ff d0                	call   *%eax
+  8017b9:	89 c3                	mov    %eax,%ebx
+  8017bb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8017be:	83 ec 08             	sub    $0x8,%esp
+  8017c1:	56                   	push   %esi
+  8017c2:	6a 00                	push   $0x0
+  8017c4:	e8 70 fa ff ff       	call   801239 <sys_page_unmap>
+	return r;
+  8017c9:	83 c4 10             	add    $0x10,%esp
+  8017cc:	eb b5                	jmp    801783 <fd_close+0x3c>
+
+008017ce <close>:
+
+int
+close(int fdnum)
+{
+  8017ce:	55                   	push   %ebp
+  8017cf:	89 e5                	mov    %esp,%ebp
+  8017d1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017d7:	50                   	push   %eax
+  8017d8:	ff 75 08             	push   0x8(%ebp)
+  8017db:	e8 c4 fe ff ff       	call   8016a4 <fd_lookup>
+  8017e0:	83 c4 10             	add    $0x10,%esp
+  8017e3:	85 c0                	test   %eax,%eax
+  8017e5:	79 02                	jns    8017e9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8017e7:	c9                   	leave
+  8017e8:	c3                   	ret
+		return fd_close(fd, 1);
+  8017e9:	83 ec 08             	sub    $0x8,%esp
+  8017ec:	6a 01                	push   $0x1
+  8017ee:	ff 75 f4             	push   -0xc(%ebp)
+  8017f1:	e8 51 ff ff ff       	call   801747 <fd_close>
+  8017f6:	83 c4 10             	add    $0x10,%esp
+  8017f9:	eb ec                	jmp    8017e7 <close+0x19>
+
+008017fb <close_all>:
+
+void
+close_all(void)
+{
+  8017fb:	55                   	push   %ebp
+  8017fc:	89 e5                	mov    %esp,%ebp
+  8017fe:	53                   	push   %ebx
+  8017ff:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801802:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801807:	83 ec 0c             	sub    $0xc,%esp
+  80180a:	53                   	push   %ebx
+  80180b:	e8 be ff ff ff       	call   8017ce <close>
+	for (i = 0; i < MAXFD; i++)
+  801810:	83 c3 01             	add    $0x1,%ebx
+  801813:	83 c4 10             	add    $0x10,%esp
+  801816:	83 fb 20             	cmp    $0x20,%ebx
+  801819:	75 ec                	jne    801807 <close_all+0xc>
+}
+  80181b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80181e:	c9                   	leave
+  80181f:	c3                   	ret
+
+00801820 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801820:	55                   	push   %ebp
+  801821:	89 e5                	mov    %esp,%ebp
+  801823:	57                   	push   %edi
+  801824:	56                   	push   %esi
+  801825:	53                   	push   %ebx
+  801826:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801829:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80182c:	50                   	push   %eax
+  80182d:	ff 75 08             	push   0x8(%ebp)
+  801830:	e8 6f fe ff ff       	call   8016a4 <fd_lookup>
+  801835:	89 c3                	mov    %eax,%ebx
+  801837:	83 c4 10             	add    $0x10,%esp
+  80183a:	85 c0                	test   %eax,%eax
+  80183c:	78 7f                	js     8018bd <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80183e:	83 ec 0c             	sub    $0xc,%esp
+  801841:	ff 75 0c             	push   0xc(%ebp)
+  801844:	e8 85 ff ff ff       	call   8017ce <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801849:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80184c:	c1 e6 0c             	shl    $0xc,%esi
+  80184f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801855:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801858:	89 3c 24             	mov    %edi,(%esp)
+  80185b:	e8 d7 fd ff ff       	call   801637 <fd2data>
+  801860:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801862:	89 34 24             	mov    %esi,(%esp)
+  801865:	e8 cd fd ff ff       	call   801637 <fd2data>
+  80186a:	83 c4 10             	add    $0x10,%esp
+  80186d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801870:	89 d8                	mov    %ebx,%eax
+  801872:	c1 e8 16             	shr    $0x16,%eax
+  801875:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80187c:	a8 01                	test   $0x1,%al
+  80187e:	74 11                	je     801891 <dup+0x71>
+  801880:	89 d8                	mov    %ebx,%eax
+  801882:	c1 e8 0c             	shr    $0xc,%eax
+  801885:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80188c:	f6 c2 01             	test   $0x1,%dl
+  80188f:	75 36                	jne    8018c7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801891:	89 f8                	mov    %edi,%eax
+  801893:	c1 e8 0c             	shr    $0xc,%eax
+  801896:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80189d:	83 ec 0c             	sub    $0xc,%esp
+  8018a0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018a5:	50                   	push   %eax
+  8018a6:	56                   	push   %esi
+  8018a7:	6a 00                	push   $0x0
+  8018a9:	57                   	push   %edi
+  8018aa:	6a 00                	push   $0x0
+  8018ac:	e8 46 f9 ff ff       	call   8011f7 <sys_page_map>
+  8018b1:	89 c3                	mov    %eax,%ebx
+  8018b3:	83 c4 20             	add    $0x20,%esp
+  8018b6:	85 c0                	test   %eax,%eax
+  8018b8:	78 33                	js     8018ed <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8018ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8018bd:	89 d8                	mov    %ebx,%eax
+  8018bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c2:	5b                   	pop    %ebx
+  8018c3:	5e                   	pop    %esi
+  8018c4:	5f                   	pop    %edi
+  8018c5:	5d                   	pop    %ebp
+  8018c6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8018c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018ce:	83 ec 0c             	sub    $0xc,%esp
+  8018d1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018d6:	50                   	push   %eax
+  8018d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8018da:	6a 00                	push   $0x0
+  8018dc:	53                   	push   %ebx
+  8018dd:	6a 00                	push   $0x0
+  8018df:	e8 13 f9 ff ff       	call   8011f7 <sys_page_map>
+  8018e4:	89 c3                	mov    %eax,%ebx
+  8018e6:	83 c4 20             	add    $0x20,%esp
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	79 a4                	jns    801891 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8018ed:	83 ec 08             	sub    $0x8,%esp
+  8018f0:	56                   	push   %esi
+  8018f1:	6a 00                	push   $0x0
+  8018f3:	e8 41 f9 ff ff       	call   801239 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8018f8:	83 c4 08             	add    $0x8,%esp
+  8018fb:	ff 75 d4             	push   -0x2c(%ebp)
+  8018fe:	6a 00                	push   $0x0
+  801900:	e8 34 f9 ff ff       	call   801239 <sys_page_unmap>
+	return r;
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	eb b3                	jmp    8018bd <dup+0x9d>
+
+0080190a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80190a:	55                   	push   %ebp
+  80190b:	89 e5                	mov    %esp,%ebp
+  80190d:	56                   	push   %esi
+  80190e:	53                   	push   %ebx
+  80190f:	83 ec 18             	sub    $0x18,%esp
+  801912:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801915:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801918:	50                   	push   %eax
+  801919:	56                   	push   %esi
+  80191a:	e8 85 fd ff ff       	call   8016a4 <fd_lookup>
+  80191f:	83 c4 10             	add    $0x10,%esp
+  801922:	85 c0                	test   %eax,%eax
+  801924:	78 3c                	js     801962 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801926:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801929:	83 ec 08             	sub    $0x8,%esp
+  80192c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80192f:	50                   	push   %eax
+  801930:	ff 33                	push   (%ebx)
+  801932:	e8 bd fd ff ff       	call   8016f4 <dev_lookup>
+  801937:	83 c4 10             	add    $0x10,%esp
+  80193a:	85 c0                	test   %eax,%eax
+  80193c:	78 24                	js     801962 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80193e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801941:	83 e0 03             	and    $0x3,%eax
+  801944:	83 f8 01             	cmp    $0x1,%eax
+  801947:	74 20                	je     801969 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801949:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80194c:	8b 40 08             	mov    0x8(%eax),%eax
+  80194f:	85 c0                	test   %eax,%eax
+  801951:	74 37                	je     80198a <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801953:	83 ec 04             	sub    $0x4,%esp
+  801956:	ff 75 10             	push   0x10(%ebp)
+  801959:	ff 75 0c             	push   0xc(%ebp)
+  80195c:	53                   	push   %ebx
+  80195d:	ff d0                	call   *%eax
+  80195f:	83 c4 10             	add    $0x10,%esp
+}
+  801962:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801965:	5b                   	pop    %ebx
+  801966:	5e                   	pop    %esi
+  801967:	5d                   	pop    %ebp
+  801968:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801969:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  80196e:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801971:	83 ec 04             	sub    $0x4,%esp
+  801974:	56                   	push   %esi
+  801975:	50                   	push   %eax
+  801976:	68 79 31 80 00       	push   $0x803179
+  80197b:	e8 96 ed ff ff       	call   800716 <cprintf>
+		return -E_INVAL;
+  801980:	83 c4 10             	add    $0x10,%esp
+  801983:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801988:	eb d8                	jmp    801962 <read+0x58>
+		return -E_NOT_SUPP;
+  80198a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80198f:	eb d1                	jmp    801962 <read+0x58>
+
+00801991 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801991:	55                   	push   %ebp
+  801992:	89 e5                	mov    %esp,%ebp
+  801994:	57                   	push   %edi
+  801995:	56                   	push   %esi
+  801996:	53                   	push   %ebx
+  801997:	83 ec 0c             	sub    $0xc,%esp
+  80199a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80199d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8019a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a5:	eb 02                	jmp    8019a9 <readn+0x18>
+  8019a7:	01 c3                	add    %eax,%ebx
+  8019a9:	39 f3                	cmp    %esi,%ebx
+  8019ab:	73 21                	jae    8019ce <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8019ad:	83 ec 04             	sub    $0x4,%esp
+  8019b0:	89 f0                	mov    %esi,%eax
+  8019b2:	29 d8                	sub    %ebx,%eax
+  8019b4:	50                   	push   %eax
+  8019b5:	89 d8                	mov    %ebx,%eax
+  8019b7:	03 45 0c             	add    0xc(%ebp),%eax
+  8019ba:	50                   	push   %eax
+  8019bb:	57                   	push   %edi
+  8019bc:	e8 49 ff ff ff       	call   80190a <read>
+		if (m < 0)
+  8019c1:	83 c4 10             	add    $0x10,%esp
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	78 04                	js     8019cc <readn+0x3b>
+			return m;
+		if (m == 0)
+  8019c8:	75 dd                	jne    8019a7 <readn+0x16>
+  8019ca:	eb 02                	jmp    8019ce <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8019cc:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8019ce:	89 d8                	mov    %ebx,%eax
+  8019d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d3:	5b                   	pop    %ebx
+  8019d4:	5e                   	pop    %esi
+  8019d5:	5f                   	pop    %edi
+  8019d6:	5d                   	pop    %ebp
+  8019d7:	c3                   	ret
+
+008019d8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8019d8:	55                   	push   %ebp
+  8019d9:	89 e5                	mov    %esp,%ebp
+  8019db:	56                   	push   %esi
+  8019dc:	53                   	push   %ebx
+  8019dd:	83 ec 18             	sub    $0x18,%esp
+  8019e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019e6:	50                   	push   %eax
+  8019e7:	53                   	push   %ebx
+  8019e8:	e8 b7 fc ff ff       	call   8016a4 <fd_lookup>
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	78 37                	js     801a2b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019f4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019f7:	83 ec 08             	sub    $0x8,%esp
+  8019fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019fd:	50                   	push   %eax
+  8019fe:	ff 36                	push   (%esi)
+  801a00:	e8 ef fc ff ff       	call   8016f4 <dev_lookup>
+  801a05:	83 c4 10             	add    $0x10,%esp
+  801a08:	85 c0                	test   %eax,%eax
+  801a0a:	78 1f                	js     801a2b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a0c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a10:	74 20                	je     801a32 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801a12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a15:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a18:	85 c0                	test   %eax,%eax
+  801a1a:	74 37                	je     801a53 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801a1c:	83 ec 04             	sub    $0x4,%esp
+  801a1f:	ff 75 10             	push   0x10(%ebp)
+  801a22:	ff 75 0c             	push   0xc(%ebp)
+  801a25:	56                   	push   %esi
+  801a26:	ff d0                	call   *%eax
+  801a28:	83 c4 10             	add    $0x10,%esp
+}
+  801a2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a2e:	5b                   	pop    %ebx
+  801a2f:	5e                   	pop    %esi
+  801a30:	5d                   	pop    %ebp
+  801a31:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a32:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  801a37:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801a3a:	83 ec 04             	sub    $0x4,%esp
+  801a3d:	53                   	push   %ebx
+  801a3e:	50                   	push   %eax
+  801a3f:	68 95 31 80 00       	push   $0x803195
+  801a44:	e8 cd ec ff ff       	call   800716 <cprintf>
+		return -E_INVAL;
+  801a49:	83 c4 10             	add    $0x10,%esp
+  801a4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a51:	eb d8                	jmp    801a2b <write+0x53>
+		return -E_NOT_SUPP;
+  801a53:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a58:	eb d1                	jmp    801a2b <write+0x53>
+
+00801a5a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a5a:	55                   	push   %ebp
+  801a5b:	89 e5                	mov    %esp,%ebp
+  801a5d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a63:	50                   	push   %eax
+  801a64:	ff 75 08             	push   0x8(%ebp)
+  801a67:	e8 38 fc ff ff       	call   8016a4 <fd_lookup>
+  801a6c:	83 c4 10             	add    $0x10,%esp
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 0e                	js     801a81 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801a73:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a79:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a81:	c9                   	leave
+  801a82:	c3                   	ret
+
+00801a83 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a83:	55                   	push   %ebp
+  801a84:	89 e5                	mov    %esp,%ebp
+  801a86:	56                   	push   %esi
+  801a87:	53                   	push   %ebx
+  801a88:	83 ec 18             	sub    $0x18,%esp
+  801a8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a8e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a91:	50                   	push   %eax
+  801a92:	53                   	push   %ebx
+  801a93:	e8 0c fc ff ff       	call   8016a4 <fd_lookup>
+  801a98:	83 c4 10             	add    $0x10,%esp
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	78 34                	js     801ad3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a9f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801aa2:	83 ec 08             	sub    $0x8,%esp
+  801aa5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa8:	50                   	push   %eax
+  801aa9:	ff 36                	push   (%esi)
+  801aab:	e8 44 fc ff ff       	call   8016f4 <dev_lookup>
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	78 1c                	js     801ad3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ab7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801abb:	74 1d                	je     801ada <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801abd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ac0:	8b 40 18             	mov    0x18(%eax),%eax
+  801ac3:	85 c0                	test   %eax,%eax
+  801ac5:	74 34                	je     801afb <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ac7:	83 ec 08             	sub    $0x8,%esp
+  801aca:	ff 75 0c             	push   0xc(%ebp)
+  801acd:	56                   	push   %esi
+  801ace:	ff d0                	call   *%eax
+  801ad0:	83 c4 10             	add    $0x10,%esp
+}
+  801ad3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ad6:	5b                   	pop    %ebx
+  801ad7:	5e                   	pop    %esi
+  801ad8:	5d                   	pop    %ebp
+  801ad9:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801ada:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  801adf:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ae2:	83 ec 04             	sub    $0x4,%esp
+  801ae5:	53                   	push   %ebx
+  801ae6:	50                   	push   %eax
+  801ae7:	68 58 31 80 00       	push   $0x803158
+  801aec:	e8 25 ec ff ff       	call   800716 <cprintf>
+		return -E_INVAL;
+  801af1:	83 c4 10             	add    $0x10,%esp
+  801af4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af9:	eb d8                	jmp    801ad3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801afb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b00:	eb d1                	jmp    801ad3 <ftruncate+0x50>
+
+00801b02 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b02:	55                   	push   %ebp
+  801b03:	89 e5                	mov    %esp,%ebp
+  801b05:	56                   	push   %esi
+  801b06:	53                   	push   %ebx
+  801b07:	83 ec 18             	sub    $0x18,%esp
+  801b0a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b0d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b10:	50                   	push   %eax
+  801b11:	ff 75 08             	push   0x8(%ebp)
+  801b14:	e8 8b fb ff ff       	call   8016a4 <fd_lookup>
+  801b19:	83 c4 10             	add    $0x10,%esp
+  801b1c:	85 c0                	test   %eax,%eax
+  801b1e:	78 49                	js     801b69 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b20:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b23:	83 ec 08             	sub    $0x8,%esp
+  801b26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b29:	50                   	push   %eax
+  801b2a:	ff 36                	push   (%esi)
+  801b2c:	e8 c3 fb ff ff       	call   8016f4 <dev_lookup>
+  801b31:	83 c4 10             	add    $0x10,%esp
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	78 31                	js     801b69 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801b38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b3b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b3f:	74 2f                	je     801b70 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801b41:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801b44:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b4b:	00 00 00 
+	stat->st_isdir = 0;
+  801b4e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b55:	00 00 00 
+	stat->st_dev = dev;
+  801b58:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801b5e:	83 ec 08             	sub    $0x8,%esp
+  801b61:	53                   	push   %ebx
+  801b62:	56                   	push   %esi
+  801b63:	ff 50 14             	call   *0x14(%eax)
+  801b66:	83 c4 10             	add    $0x10,%esp
+}
+  801b69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b6c:	5b                   	pop    %ebx
+  801b6d:	5e                   	pop    %esi
+  801b6e:	5d                   	pop    %ebp
+  801b6f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b70:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b75:	eb f2                	jmp    801b69 <fstat+0x67>
+
+00801b77 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b77:	55                   	push   %ebp
+  801b78:	89 e5                	mov    %esp,%ebp
+  801b7a:	56                   	push   %esi
+  801b7b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801b7c:	83 ec 08             	sub    $0x8,%esp
+  801b7f:	6a 00                	push   $0x0
+  801b81:	ff 75 08             	push   0x8(%ebp)
+  801b84:	e8 e4 01 00 00       	call   801d6d <open>
+  801b89:	89 c3                	mov    %eax,%ebx
+  801b8b:	83 c4 10             	add    $0x10,%esp
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	78 1b                	js     801bad <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801b92:	83 ec 08             	sub    $0x8,%esp
+  801b95:	ff 75 0c             	push   0xc(%ebp)
+  801b98:	50                   	push   %eax
+  801b99:	e8 64 ff ff ff       	call   801b02 <fstat>
+  801b9e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ba0:	89 1c 24             	mov    %ebx,(%esp)
+  801ba3:	e8 26 fc ff ff       	call   8017ce <close>
+	return r;
+  801ba8:	83 c4 10             	add    $0x10,%esp
+  801bab:	89 f3                	mov    %esi,%ebx
+}
+  801bad:	89 d8                	mov    %ebx,%eax
+  801baf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb2:	5b                   	pop    %ebx
+  801bb3:	5e                   	pop    %esi
+  801bb4:	5d                   	pop    %ebp
+  801bb5:	c3                   	ret
+
+00801bb6 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801bb6:	55                   	push   %ebp
+  801bb7:	89 e5                	mov    %esp,%ebp
+  801bb9:	56                   	push   %esi
+  801bba:	53                   	push   %ebx
+  801bbb:	89 c6                	mov    %eax,%esi
+  801bbd:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801bbf:	83 3d ac 50 80 00 00 	cmpl   $0x0,0x8050ac
+  801bc6:	74 27                	je     801bef <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801bc8:	6a 07                	push   $0x7
+  801bca:	68 00 60 80 00       	push   $0x806000
+  801bcf:	56                   	push   %esi
+  801bd0:	ff 35 ac 50 80 00    	push   0x8050ac
+  801bd6:	e8 d5 0b 00 00       	call   8027b0 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801bdb:	83 c4 0c             	add    $0xc,%esp
+  801bde:	6a 00                	push   $0x0
+  801be0:	53                   	push   %ebx
+  801be1:	6a 00                	push   $0x0
+  801be3:	e8 50 0b 00 00       	call   802738 <ipc_recv>
+}
+  801be8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801beb:	5b                   	pop    %ebx
+  801bec:	5e                   	pop    %esi
+  801bed:	5d                   	pop    %ebp
+  801bee:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bef:	83 ec 0c             	sub    $0xc,%esp
+  801bf2:	6a 01                	push   $0x1
+  801bf4:	e8 0b 0c 00 00       	call   802804 <ipc_find_env>
+  801bf9:	a3 ac 50 80 00       	mov    %eax,0x8050ac
+  801bfe:	83 c4 10             	add    $0x10,%esp
+  801c01:	eb c5                	jmp    801bc8 <fsipc+0x12>
+
+00801c03 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801c03:	55                   	push   %ebp
+  801c04:	89 e5                	mov    %esp,%ebp
+  801c06:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801c09:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c0c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c0f:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801c14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c17:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801c1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c21:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c26:	e8 8b ff ff ff       	call   801bb6 <fsipc>
+}
+  801c2b:	c9                   	leave
+  801c2c:	c3                   	ret
+
+00801c2d <devfile_flush>:
+{
+  801c2d:	55                   	push   %ebp
+  801c2e:	89 e5                	mov    %esp,%ebp
+  801c30:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801c33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c36:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c39:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801c3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c43:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c48:	e8 69 ff ff ff       	call   801bb6 <fsipc>
+}
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+
+00801c4f <devfile_stat>:
+{
+  801c4f:	55                   	push   %ebp
+  801c50:	89 e5                	mov    %esp,%ebp
+  801c52:	53                   	push   %ebx
+  801c53:	83 ec 04             	sub    $0x4,%esp
+  801c56:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c59:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c5c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c5f:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c64:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c69:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c6e:	e8 43 ff ff ff       	call   801bb6 <fsipc>
+  801c73:	85 c0                	test   %eax,%eax
+  801c75:	78 2c                	js     801ca3 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c77:	83 ec 08             	sub    $0x8,%esp
+  801c7a:	68 00 60 80 00       	push   $0x806000
+  801c7f:	53                   	push   %ebx
+  801c80:	e8 7f f0 ff ff       	call   800d04 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801c85:	a1 80 60 80 00       	mov    0x806080,%eax
+  801c8a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c90:	a1 84 60 80 00       	mov    0x806084,%eax
+  801c95:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801c9b:	83 c4 10             	add    $0x10,%esp
+  801c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ca3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca6:	c9                   	leave
+  801ca7:	c3                   	ret
+
+00801ca8 <devfile_write>:
+{
+  801ca8:	55                   	push   %ebp
+  801ca9:	89 e5                	mov    %esp,%ebp
+  801cab:	83 ec 0c             	sub    $0xc,%esp
+  801cae:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801cb1:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801cb6:	39 d0                	cmp    %edx,%eax
+  801cb8:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cbe:	8b 52 0c             	mov    0xc(%edx),%edx
+  801cc1:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801cc7:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801ccc:	50                   	push   %eax
+  801ccd:	ff 75 0c             	push   0xc(%ebp)
+  801cd0:	68 08 60 80 00       	push   $0x806008
+  801cd5:	e8 b0 f1 ff ff       	call   800e8a <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801cda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdf:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ce4:	e8 cd fe ff ff       	call   801bb6 <fsipc>
+}
+  801ce9:	c9                   	leave
+  801cea:	c3                   	ret
+
+00801ceb <devfile_read>:
+{
+  801ceb:	55                   	push   %ebp
+  801cec:	89 e5                	mov    %esp,%ebp
+  801cee:	56                   	push   %esi
+  801cef:	53                   	push   %ebx
+  801cf0:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801cf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cf6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cf9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801cfe:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d09:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d0e:	e8 a3 fe ff ff       	call   801bb6 <fsipc>
+  801d13:	89 c3                	mov    %eax,%ebx
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	78 1f                	js     801d38 <devfile_read+0x4d>
+	assert(r <= n);
+  801d19:	39 c6                	cmp    %eax,%esi
+  801d1b:	72 24                	jb     801d41 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801d1d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801d22:	7f 33                	jg     801d57 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801d24:	83 ec 04             	sub    $0x4,%esp
+  801d27:	50                   	push   %eax
+  801d28:	68 00 60 80 00       	push   $0x806000
+  801d2d:	ff 75 0c             	push   0xc(%ebp)
+  801d30:	e8 55 f1 ff ff       	call   800e8a <memmove>
+	return r;
+  801d35:	83 c4 10             	add    $0x10,%esp
+}
+  801d38:	89 d8                	mov    %ebx,%eax
+  801d3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d3d:	5b                   	pop    %ebx
+  801d3e:	5e                   	pop    %esi
+  801d3f:	5d                   	pop    %ebp
+  801d40:	c3                   	ret
+	assert(r <= n);
+  801d41:	68 c8 31 80 00       	push   $0x8031c8
+  801d46:	68 cf 31 80 00       	push   $0x8031cf
+  801d4b:	6a 7c                	push   $0x7c
+  801d4d:	68 e4 31 80 00       	push   $0x8031e4
+  801d52:	e8 e4 e8 ff ff       	call   80063b <_panic>
+	assert(r <= PGSIZE);
+  801d57:	68 ef 31 80 00       	push   $0x8031ef
+  801d5c:	68 cf 31 80 00       	push   $0x8031cf
+  801d61:	6a 7d                	push   $0x7d
+  801d63:	68 e4 31 80 00       	push   $0x8031e4
+  801d68:	e8 ce e8 ff ff       	call   80063b <_panic>
+
+00801d6d <open>:
+{
+  801d6d:	55                   	push   %ebp
+  801d6e:	89 e5                	mov    %esp,%ebp
+  801d70:	56                   	push   %esi
+  801d71:	53                   	push   %ebx
+  801d72:	83 ec 1c             	sub    $0x1c,%esp
+  801d75:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801d78:	56                   	push   %esi
+  801d79:	e8 4b ef ff ff       	call   800cc9 <strlen>
+  801d7e:	83 c4 10             	add    $0x10,%esp
+  801d81:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d86:	7f 6c                	jg     801df4 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d88:	83 ec 0c             	sub    $0xc,%esp
+  801d8b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d8e:	50                   	push   %eax
+  801d8f:	e8 ba f8 ff ff       	call   80164e <fd_alloc>
+  801d94:	89 c3                	mov    %eax,%ebx
+  801d96:	83 c4 10             	add    $0x10,%esp
+  801d99:	85 c0                	test   %eax,%eax
+  801d9b:	78 3c                	js     801dd9 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d9d:	83 ec 08             	sub    $0x8,%esp
+  801da0:	56                   	push   %esi
+  801da1:	68 00 60 80 00       	push   $0x806000
+  801da6:	e8 59 ef ff ff       	call   800d04 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801dab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dae:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801db3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801db6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dbb:	e8 f6 fd ff ff       	call   801bb6 <fsipc>
+  801dc0:	89 c3                	mov    %eax,%ebx
+  801dc2:	83 c4 10             	add    $0x10,%esp
+  801dc5:	85 c0                	test   %eax,%eax
+  801dc7:	78 19                	js     801de2 <open+0x75>
+	return fd2num(fd);
+  801dc9:	83 ec 0c             	sub    $0xc,%esp
+  801dcc:	ff 75 f4             	push   -0xc(%ebp)
+  801dcf:	e8 53 f8 ff ff       	call   801627 <fd2num>
+  801dd4:	89 c3                	mov    %eax,%ebx
+  801dd6:	83 c4 10             	add    $0x10,%esp
+}
+  801dd9:	89 d8                	mov    %ebx,%eax
+  801ddb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dde:	5b                   	pop    %ebx
+  801ddf:	5e                   	pop    %esi
+  801de0:	5d                   	pop    %ebp
+  801de1:	c3                   	ret
+		fd_close(fd, 0);
+  801de2:	83 ec 08             	sub    $0x8,%esp
+  801de5:	6a 00                	push   $0x0
+  801de7:	ff 75 f4             	push   -0xc(%ebp)
+  801dea:	e8 58 f9 ff ff       	call   801747 <fd_close>
+		return r;
+  801def:	83 c4 10             	add    $0x10,%esp
+  801df2:	eb e5                	jmp    801dd9 <open+0x6c>
+		return -E_BAD_PATH;
+  801df4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801df9:	eb de                	jmp    801dd9 <open+0x6c>
+
+00801dfb <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801dfb:	55                   	push   %ebp
+  801dfc:	89 e5                	mov    %esp,%ebp
+  801dfe:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801e01:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e06:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e0b:	e8 a6 fd ff ff       	call   801bb6 <fsipc>
+}
+  801e10:	c9                   	leave
+  801e11:	c3                   	ret
+
+00801e12 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e12:	55                   	push   %ebp
+  801e13:	89 e5                	mov    %esp,%ebp
+  801e15:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801e18:	68 fb 31 80 00       	push   $0x8031fb
+  801e1d:	ff 75 0c             	push   0xc(%ebp)
+  801e20:	e8 df ee ff ff       	call   800d04 <strcpy>
+	return 0;
+}
+  801e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2a:	c9                   	leave
+  801e2b:	c3                   	ret
+
+00801e2c <devsock_close>:
+{
+  801e2c:	55                   	push   %ebp
+  801e2d:	89 e5                	mov    %esp,%ebp
+  801e2f:	53                   	push   %ebx
+  801e30:	83 ec 10             	sub    $0x10,%esp
+  801e33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801e36:	53                   	push   %ebx
+  801e37:	e8 d8 09 00 00       	call   802814 <pageref>
+  801e3c:	89 c2                	mov    %eax,%edx
+  801e3e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801e41:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801e46:	83 fa 01             	cmp    $0x1,%edx
+  801e49:	74 05                	je     801e50 <devsock_close+0x24>
+}
+  801e4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e4e:	c9                   	leave
+  801e4f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801e50:	83 ec 0c             	sub    $0xc,%esp
+  801e53:	ff 73 0c             	push   0xc(%ebx)
+  801e56:	e8 b7 02 00 00       	call   802112 <nsipc_close>
+  801e5b:	83 c4 10             	add    $0x10,%esp
+  801e5e:	eb eb                	jmp    801e4b <devsock_close+0x1f>
+
+00801e60 <devsock_write>:
+{
+  801e60:	55                   	push   %ebp
+  801e61:	89 e5                	mov    %esp,%ebp
+  801e63:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801e66:	6a 00                	push   $0x0
+  801e68:	ff 75 10             	push   0x10(%ebp)
+  801e6b:	ff 75 0c             	push   0xc(%ebp)
+  801e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e71:	ff 70 0c             	push   0xc(%eax)
+  801e74:	e8 79 03 00 00       	call   8021f2 <nsipc_send>
+}
+  801e79:	c9                   	leave
+  801e7a:	c3                   	ret
+
+00801e7b <devsock_read>:
+{
+  801e7b:	55                   	push   %ebp
+  801e7c:	89 e5                	mov    %esp,%ebp
+  801e7e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801e81:	6a 00                	push   $0x0
+  801e83:	ff 75 10             	push   0x10(%ebp)
+  801e86:	ff 75 0c             	push   0xc(%ebp)
+  801e89:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e8c:	ff 70 0c             	push   0xc(%eax)
+  801e8f:	e8 ef 02 00 00       	call   802183 <nsipc_recv>
+}
+  801e94:	c9                   	leave
+  801e95:	c3                   	ret
+
+00801e96 <fd2sockid>:
+{
+  801e96:	55                   	push   %ebp
+  801e97:	89 e5                	mov    %esp,%ebp
+  801e99:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801e9c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e9f:	52                   	push   %edx
+  801ea0:	50                   	push   %eax
+  801ea1:	e8 fe f7 ff ff       	call   8016a4 <fd_lookup>
+  801ea6:	83 c4 10             	add    $0x10,%esp
+  801ea9:	85 c0                	test   %eax,%eax
+  801eab:	78 10                	js     801ebd <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801ead:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb0:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801eb6:	39 08                	cmp    %ecx,(%eax)
+  801eb8:	75 05                	jne    801ebf <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801eba:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801ebd:	c9                   	leave
+  801ebe:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ebf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ec4:	eb f7                	jmp    801ebd <fd2sockid+0x27>
+
+00801ec6 <alloc_sockfd>:
+{
+  801ec6:	55                   	push   %ebp
+  801ec7:	89 e5                	mov    %esp,%ebp
+  801ec9:	56                   	push   %esi
+  801eca:	53                   	push   %ebx
+  801ecb:	83 ec 1c             	sub    $0x1c,%esp
+  801ece:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801ed0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed3:	50                   	push   %eax
+  801ed4:	e8 75 f7 ff ff       	call   80164e <fd_alloc>
+  801ed9:	89 c3                	mov    %eax,%ebx
+  801edb:	83 c4 10             	add    $0x10,%esp
+  801ede:	85 c0                	test   %eax,%eax
+  801ee0:	78 43                	js     801f25 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ee2:	83 ec 04             	sub    $0x4,%esp
+  801ee5:	68 07 04 00 00       	push   $0x407
+  801eea:	ff 75 f4             	push   -0xc(%ebp)
+  801eed:	6a 00                	push   $0x0
+  801eef:	e8 7d f2 ff ff       	call   801171 <sys_page_alloc>
+  801ef4:	89 c3                	mov    %eax,%ebx
+  801ef6:	83 c4 10             	add    $0x10,%esp
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	78 28                	js     801f25 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801efd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f00:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801f06:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801f08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f0b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801f12:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801f15:	83 ec 0c             	sub    $0xc,%esp
+  801f18:	50                   	push   %eax
+  801f19:	e8 09 f7 ff ff       	call   801627 <fd2num>
+  801f1e:	89 c3                	mov    %eax,%ebx
+  801f20:	83 c4 10             	add    $0x10,%esp
+  801f23:	eb 0c                	jmp    801f31 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801f25:	83 ec 0c             	sub    $0xc,%esp
+  801f28:	56                   	push   %esi
+  801f29:	e8 e4 01 00 00       	call   802112 <nsipc_close>
+		return r;
+  801f2e:	83 c4 10             	add    $0x10,%esp
+}
+  801f31:	89 d8                	mov    %ebx,%eax
+  801f33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f36:	5b                   	pop    %ebx
+  801f37:	5e                   	pop    %esi
+  801f38:	5d                   	pop    %ebp
+  801f39:	c3                   	ret
+
+00801f3a <accept>:
+{
+  801f3a:	55                   	push   %ebp
+  801f3b:	89 e5                	mov    %esp,%ebp
+  801f3d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f40:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f43:	e8 4e ff ff ff       	call   801e96 <fd2sockid>
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	78 1b                	js     801f67 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801f4c:	83 ec 04             	sub    $0x4,%esp
+  801f4f:	ff 75 10             	push   0x10(%ebp)
+  801f52:	ff 75 0c             	push   0xc(%ebp)
+  801f55:	50                   	push   %eax
+  801f56:	e8 0e 01 00 00       	call   802069 <nsipc_accept>
+  801f5b:	83 c4 10             	add    $0x10,%esp
+  801f5e:	85 c0                	test   %eax,%eax
+  801f60:	78 05                	js     801f67 <accept+0x2d>
+	return alloc_sockfd(r);
+  801f62:	e8 5f ff ff ff       	call   801ec6 <alloc_sockfd>
+}
+  801f67:	c9                   	leave
+  801f68:	c3                   	ret
+
+00801f69 <bind>:
+{
+  801f69:	55                   	push   %ebp
+  801f6a:	89 e5                	mov    %esp,%ebp
+  801f6c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f72:	e8 1f ff ff ff       	call   801e96 <fd2sockid>
+  801f77:	85 c0                	test   %eax,%eax
+  801f79:	78 12                	js     801f8d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801f7b:	83 ec 04             	sub    $0x4,%esp
+  801f7e:	ff 75 10             	push   0x10(%ebp)
+  801f81:	ff 75 0c             	push   0xc(%ebp)
+  801f84:	50                   	push   %eax
+  801f85:	e8 31 01 00 00       	call   8020bb <nsipc_bind>
+  801f8a:	83 c4 10             	add    $0x10,%esp
+}
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+00801f8f <shutdown>:
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f98:	e8 f9 fe ff ff       	call   801e96 <fd2sockid>
+  801f9d:	85 c0                	test   %eax,%eax
+  801f9f:	78 0f                	js     801fb0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801fa1:	83 ec 08             	sub    $0x8,%esp
+  801fa4:	ff 75 0c             	push   0xc(%ebp)
+  801fa7:	50                   	push   %eax
+  801fa8:	e8 43 01 00 00       	call   8020f0 <nsipc_shutdown>
+  801fad:	83 c4 10             	add    $0x10,%esp
+}
+  801fb0:	c9                   	leave
+  801fb1:	c3                   	ret
+
+00801fb2 <connect>:
+{
+  801fb2:	55                   	push   %ebp
+  801fb3:	89 e5                	mov    %esp,%ebp
+  801fb5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbb:	e8 d6 fe ff ff       	call   801e96 <fd2sockid>
+  801fc0:	85 c0                	test   %eax,%eax
+  801fc2:	78 12                	js     801fd6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801fc4:	83 ec 04             	sub    $0x4,%esp
+  801fc7:	ff 75 10             	push   0x10(%ebp)
+  801fca:	ff 75 0c             	push   0xc(%ebp)
+  801fcd:	50                   	push   %eax
+  801fce:	e8 59 01 00 00       	call   80212c <nsipc_connect>
+  801fd3:	83 c4 10             	add    $0x10,%esp
+}
+  801fd6:	c9                   	leave
+  801fd7:	c3                   	ret
+
+00801fd8 <listen>:
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fde:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe1:	e8 b0 fe ff ff       	call   801e96 <fd2sockid>
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	78 0f                	js     801ff9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801fea:	83 ec 08             	sub    $0x8,%esp
+  801fed:	ff 75 0c             	push   0xc(%ebp)
+  801ff0:	50                   	push   %eax
+  801ff1:	e8 6b 01 00 00       	call   802161 <nsipc_listen>
+  801ff6:	83 c4 10             	add    $0x10,%esp
+}
+  801ff9:	c9                   	leave
+  801ffa:	c3                   	ret
+
+00801ffb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801ffb:	55                   	push   %ebp
+  801ffc:	89 e5                	mov    %esp,%ebp
+  801ffe:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802001:	ff 75 10             	push   0x10(%ebp)
+  802004:	ff 75 0c             	push   0xc(%ebp)
+  802007:	ff 75 08             	push   0x8(%ebp)
+  80200a:	e8 41 02 00 00       	call   802250 <nsipc_socket>
+  80200f:	83 c4 10             	add    $0x10,%esp
+  802012:	85 c0                	test   %eax,%eax
+  802014:	78 05                	js     80201b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802016:	e8 ab fe ff ff       	call   801ec6 <alloc_sockfd>
+}
+  80201b:	c9                   	leave
+  80201c:	c3                   	ret
+
+0080201d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	53                   	push   %ebx
+  802021:	83 ec 04             	sub    $0x4,%esp
+  802024:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802026:	83 3d b0 50 80 00 00 	cmpl   $0x0,0x8050b0
+  80202d:	74 26                	je     802055 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80202f:	6a 07                	push   $0x7
+  802031:	68 00 70 80 00       	push   $0x807000
+  802036:	53                   	push   %ebx
+  802037:	ff 35 b0 50 80 00    	push   0x8050b0
+  80203d:	e8 6e 07 00 00       	call   8027b0 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802042:	83 c4 0c             	add    $0xc,%esp
+  802045:	6a 00                	push   $0x0
+  802047:	6a 00                	push   $0x0
+  802049:	6a 00                	push   $0x0
+  80204b:	e8 e8 06 00 00       	call   802738 <ipc_recv>
+}
+  802050:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802053:	c9                   	leave
+  802054:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802055:	83 ec 0c             	sub    $0xc,%esp
+  802058:	6a 02                	push   $0x2
+  80205a:	e8 a5 07 00 00       	call   802804 <ipc_find_env>
+  80205f:	a3 b0 50 80 00       	mov    %eax,0x8050b0
+  802064:	83 c4 10             	add    $0x10,%esp
+  802067:	eb c6                	jmp    80202f <nsipc+0x12>
+
+00802069 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802069:	55                   	push   %ebp
+  80206a:	89 e5                	mov    %esp,%ebp
+  80206c:	56                   	push   %esi
+  80206d:	53                   	push   %ebx
+  80206e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802071:	8b 45 08             	mov    0x8(%ebp),%eax
+  802074:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802079:	8b 06                	mov    (%esi),%eax
+  80207b:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802080:	b8 01 00 00 00       	mov    $0x1,%eax
+  802085:	e8 93 ff ff ff       	call   80201d <nsipc>
+  80208a:	89 c3                	mov    %eax,%ebx
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	79 09                	jns    802099 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802090:	89 d8                	mov    %ebx,%eax
+  802092:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802095:	5b                   	pop    %ebx
+  802096:	5e                   	pop    %esi
+  802097:	5d                   	pop    %ebp
+  802098:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802099:	83 ec 04             	sub    $0x4,%esp
+  80209c:	ff 35 10 70 80 00    	push   0x807010
+  8020a2:	68 00 70 80 00       	push   $0x807000
+  8020a7:	ff 75 0c             	push   0xc(%ebp)
+  8020aa:	e8 db ed ff ff       	call   800e8a <memmove>
+		*addrlen = ret->ret_addrlen;
+  8020af:	a1 10 70 80 00       	mov    0x807010,%eax
+  8020b4:	89 06                	mov    %eax,(%esi)
+  8020b6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8020b9:	eb d5                	jmp    802090 <nsipc_accept+0x27>
+
+008020bb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8020bb:	55                   	push   %ebp
+  8020bc:	89 e5                	mov    %esp,%ebp
+  8020be:	53                   	push   %ebx
+  8020bf:	83 ec 08             	sub    $0x8,%esp
+  8020c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8020c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c8:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8020cd:	53                   	push   %ebx
+  8020ce:	ff 75 0c             	push   0xc(%ebp)
+  8020d1:	68 04 70 80 00       	push   $0x807004
+  8020d6:	e8 af ed ff ff       	call   800e8a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8020db:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8020e1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020e6:	e8 32 ff ff ff       	call   80201d <nsipc>
+}
+  8020eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020ee:	c9                   	leave
+  8020ef:	c3                   	ret
+
+008020f0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8020f0:	55                   	push   %ebp
+  8020f1:	89 e5                	mov    %esp,%ebp
+  8020f3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8020f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8020fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802101:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802106:	b8 03 00 00 00       	mov    $0x3,%eax
+  80210b:	e8 0d ff ff ff       	call   80201d <nsipc>
+}
+  802110:	c9                   	leave
+  802111:	c3                   	ret
+
+00802112 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802112:	55                   	push   %ebp
+  802113:	89 e5                	mov    %esp,%ebp
+  802115:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802118:	8b 45 08             	mov    0x8(%ebp),%eax
+  80211b:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802120:	b8 04 00 00 00       	mov    $0x4,%eax
+  802125:	e8 f3 fe ff ff       	call   80201d <nsipc>
+}
+  80212a:	c9                   	leave
+  80212b:	c3                   	ret
+
+0080212c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80212c:	55                   	push   %ebp
+  80212d:	89 e5                	mov    %esp,%ebp
+  80212f:	53                   	push   %ebx
+  802130:	83 ec 08             	sub    $0x8,%esp
+  802133:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802136:	8b 45 08             	mov    0x8(%ebp),%eax
+  802139:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80213e:	53                   	push   %ebx
+  80213f:	ff 75 0c             	push   0xc(%ebp)
+  802142:	68 04 70 80 00       	push   $0x807004
+  802147:	e8 3e ed ff ff       	call   800e8a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80214c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802152:	b8 05 00 00 00       	mov    $0x5,%eax
+  802157:	e8 c1 fe ff ff       	call   80201d <nsipc>
+}
+  80215c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80215f:	c9                   	leave
+  802160:	c3                   	ret
+
+00802161 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802161:	55                   	push   %ebp
+  802162:	89 e5                	mov    %esp,%ebp
+  802164:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802167:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80216f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802172:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802177:	b8 06 00 00 00       	mov    $0x6,%eax
+  80217c:	e8 9c fe ff ff       	call   80201d <nsipc>
+}
+  802181:	c9                   	leave
+  802182:	c3                   	ret
+
+00802183 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802183:	55                   	push   %ebp
+  802184:	89 e5                	mov    %esp,%ebp
+  802186:	56                   	push   %esi
+  802187:	53                   	push   %ebx
+  802188:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80218b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80218e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802193:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802199:	8b 45 14             	mov    0x14(%ebp),%eax
+  80219c:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8021a1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8021a6:	e8 72 fe ff ff       	call   80201d <nsipc>
+  8021ab:	89 c3                	mov    %eax,%ebx
+  8021ad:	85 c0                	test   %eax,%eax
+  8021af:	78 22                	js     8021d3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8021b1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8021b6:	39 c6                	cmp    %eax,%esi
+  8021b8:	0f 4e c6             	cmovle %esi,%eax
+  8021bb:	39 c3                	cmp    %eax,%ebx
+  8021bd:	7f 1d                	jg     8021dc <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8021bf:	83 ec 04             	sub    $0x4,%esp
+  8021c2:	53                   	push   %ebx
+  8021c3:	68 00 70 80 00       	push   $0x807000
+  8021c8:	ff 75 0c             	push   0xc(%ebp)
+  8021cb:	e8 ba ec ff ff       	call   800e8a <memmove>
+  8021d0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8021d3:	89 d8                	mov    %ebx,%eax
+  8021d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021d8:	5b                   	pop    %ebx
+  8021d9:	5e                   	pop    %esi
+  8021da:	5d                   	pop    %ebp
+  8021db:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8021dc:	68 07 32 80 00       	push   $0x803207
+  8021e1:	68 cf 31 80 00       	push   $0x8031cf
+  8021e6:	6a 62                	push   $0x62
+  8021e8:	68 1c 32 80 00       	push   $0x80321c
+  8021ed:	e8 49 e4 ff ff       	call   80063b <_panic>
+
+008021f2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8021f2:	55                   	push   %ebp
+  8021f3:	89 e5                	mov    %esp,%ebp
+  8021f5:	53                   	push   %ebx
+  8021f6:	83 ec 04             	sub    $0x4,%esp
+  8021f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8021fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ff:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802204:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80220a:	7f 2e                	jg     80223a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80220c:	83 ec 04             	sub    $0x4,%esp
+  80220f:	53                   	push   %ebx
+  802210:	ff 75 0c             	push   0xc(%ebp)
+  802213:	68 0c 70 80 00       	push   $0x80700c
+  802218:	e8 6d ec ff ff       	call   800e8a <memmove>
+	nsipcbuf.send.req_size = size;
+  80221d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802223:	8b 45 14             	mov    0x14(%ebp),%eax
+  802226:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80222b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802230:	e8 e8 fd ff ff       	call   80201d <nsipc>
+}
+  802235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802238:	c9                   	leave
+  802239:	c3                   	ret
+	assert(size < 1600);
+  80223a:	68 28 32 80 00       	push   $0x803228
+  80223f:	68 cf 31 80 00       	push   $0x8031cf
+  802244:	6a 6d                	push   $0x6d
+  802246:	68 1c 32 80 00       	push   $0x80321c
+  80224b:	e8 eb e3 ff ff       	call   80063b <_panic>
+
+00802250 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802250:	55                   	push   %ebp
+  802251:	89 e5                	mov    %esp,%ebp
+  802253:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802256:	8b 45 08             	mov    0x8(%ebp),%eax
+  802259:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80225e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802261:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802266:	8b 45 10             	mov    0x10(%ebp),%eax
+  802269:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80226e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802273:	e8 a5 fd ff ff       	call   80201d <nsipc>
+}
+  802278:	c9                   	leave
+  802279:	c3                   	ret
+
+0080227a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80227a:	55                   	push   %ebp
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	56                   	push   %esi
+  80227e:	53                   	push   %ebx
+  80227f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802282:	83 ec 0c             	sub    $0xc,%esp
+  802285:	ff 75 08             	push   0x8(%ebp)
+  802288:	e8 aa f3 ff ff       	call   801637 <fd2data>
+  80228d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80228f:	83 c4 08             	add    $0x8,%esp
+  802292:	68 34 32 80 00       	push   $0x803234
+  802297:	53                   	push   %ebx
+  802298:	e8 67 ea ff ff       	call   800d04 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80229d:	8b 46 04             	mov    0x4(%esi),%eax
+  8022a0:	2b 06                	sub    (%esi),%eax
+  8022a2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8022a8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022af:	00 00 00 
+	stat->st_dev = &devpipe;
+  8022b2:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8022b9:	40 80 00 
+	return 0;
+}
+  8022bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c4:	5b                   	pop    %ebx
+  8022c5:	5e                   	pop    %esi
+  8022c6:	5d                   	pop    %ebp
+  8022c7:	c3                   	ret
+
+008022c8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8022c8:	55                   	push   %ebp
+  8022c9:	89 e5                	mov    %esp,%ebp
+  8022cb:	53                   	push   %ebx
+  8022cc:	83 ec 0c             	sub    $0xc,%esp
+  8022cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8022d2:	53                   	push   %ebx
+  8022d3:	6a 00                	push   $0x0
+  8022d5:	e8 5f ef ff ff       	call   801239 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8022da:	89 1c 24             	mov    %ebx,(%esp)
+  8022dd:	e8 55 f3 ff ff       	call   801637 <fd2data>
+  8022e2:	83 c4 08             	add    $0x8,%esp
+  8022e5:	50                   	push   %eax
+  8022e6:	6a 00                	push   $0x0
+  8022e8:	e8 4c ef ff ff       	call   801239 <sys_page_unmap>
+}
+  8022ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022f0:	c9                   	leave
+  8022f1:	c3                   	ret
+
+008022f2 <_pipeisclosed>:
+{
+  8022f2:	55                   	push   %ebp
+  8022f3:	89 e5                	mov    %esp,%ebp
+  8022f5:	57                   	push   %edi
+  8022f6:	56                   	push   %esi
+  8022f7:	53                   	push   %ebx
+  8022f8:	83 ec 1c             	sub    $0x1c,%esp
+  8022fb:	89 c7                	mov    %eax,%edi
+  8022fd:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8022ff:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  802304:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802307:	83 ec 0c             	sub    $0xc,%esp
+  80230a:	57                   	push   %edi
+  80230b:	e8 04 05 00 00       	call   802814 <pageref>
+  802310:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802313:	89 34 24             	mov    %esi,(%esp)
+  802316:	e8 f9 04 00 00       	call   802814 <pageref>
+		nn = thisenv->env_runs;
+  80231b:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+  802321:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802324:	83 c4 10             	add    $0x10,%esp
+  802327:	39 cb                	cmp    %ecx,%ebx
+  802329:	74 1b                	je     802346 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80232b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80232e:	75 cf                	jne    8022ff <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802330:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802333:	6a 01                	push   $0x1
+  802335:	50                   	push   %eax
+  802336:	53                   	push   %ebx
+  802337:	68 3b 32 80 00       	push   $0x80323b
+  80233c:	e8 d5 e3 ff ff       	call   800716 <cprintf>
+  802341:	83 c4 10             	add    $0x10,%esp
+  802344:	eb b9                	jmp    8022ff <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802346:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802349:	0f 94 c0             	sete   %al
+  80234c:	0f b6 c0             	movzbl %al,%eax
+}
+  80234f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802352:	5b                   	pop    %ebx
+  802353:	5e                   	pop    %esi
+  802354:	5f                   	pop    %edi
+  802355:	5d                   	pop    %ebp
+  802356:	c3                   	ret
+
+00802357 <devpipe_write>:
+{
+  802357:	55                   	push   %ebp
+  802358:	89 e5                	mov    %esp,%ebp
+  80235a:	57                   	push   %edi
+  80235b:	56                   	push   %esi
+  80235c:	53                   	push   %ebx
+  80235d:	83 ec 28             	sub    $0x28,%esp
+  802360:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802363:	56                   	push   %esi
+  802364:	e8 ce f2 ff ff       	call   801637 <fd2data>
+  802369:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80236b:	83 c4 10             	add    $0x10,%esp
+  80236e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802373:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802376:	75 09                	jne    802381 <devpipe_write+0x2a>
+	return i;
+  802378:	89 f8                	mov    %edi,%eax
+  80237a:	eb 23                	jmp    80239f <devpipe_write+0x48>
+			sys_yield();
+  80237c:	e8 70 ed ff ff       	call   8010f1 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802381:	8b 43 04             	mov    0x4(%ebx),%eax
+  802384:	8b 0b                	mov    (%ebx),%ecx
+  802386:	8d 51 20             	lea    0x20(%ecx),%edx
+  802389:	39 d0                	cmp    %edx,%eax
+  80238b:	72 1a                	jb     8023a7 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80238d:	89 da                	mov    %ebx,%edx
+  80238f:	89 f0                	mov    %esi,%eax
+  802391:	e8 5c ff ff ff       	call   8022f2 <_pipeisclosed>
+  802396:	85 c0                	test   %eax,%eax
+  802398:	74 e2                	je     80237c <devpipe_write+0x25>
+				return 0;
+  80239a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80239f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023a2:	5b                   	pop    %ebx
+  8023a3:	5e                   	pop    %esi
+  8023a4:	5f                   	pop    %edi
+  8023a5:	5d                   	pop    %ebp
+  8023a6:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8023a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023aa:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8023ae:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8023b1:	89 c2                	mov    %eax,%edx
+  8023b3:	c1 fa 1f             	sar    $0x1f,%edx
+  8023b6:	89 d1                	mov    %edx,%ecx
+  8023b8:	c1 e9 1b             	shr    $0x1b,%ecx
+  8023bb:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8023be:	83 e2 1f             	and    $0x1f,%edx
+  8023c1:	29 ca                	sub    %ecx,%edx
+  8023c3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8023c7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8023cb:	83 c0 01             	add    $0x1,%eax
+  8023ce:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8023d1:	83 c7 01             	add    $0x1,%edi
+  8023d4:	eb 9d                	jmp    802373 <devpipe_write+0x1c>
+
+008023d6 <devpipe_read>:
+{
+  8023d6:	55                   	push   %ebp
+  8023d7:	89 e5                	mov    %esp,%ebp
+  8023d9:	57                   	push   %edi
+  8023da:	56                   	push   %esi
+  8023db:	53                   	push   %ebx
+  8023dc:	83 ec 18             	sub    $0x18,%esp
+  8023df:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8023e2:	57                   	push   %edi
+  8023e3:	e8 4f f2 ff ff       	call   801637 <fd2data>
+  8023e8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8023ea:	83 c4 10             	add    $0x10,%esp
+  8023ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8023f5:	75 13                	jne    80240a <devpipe_read+0x34>
+	return i;
+  8023f7:	89 f0                	mov    %esi,%eax
+  8023f9:	eb 02                	jmp    8023fd <devpipe_read+0x27>
+				return i;
+  8023fb:	89 f0                	mov    %esi,%eax
+}
+  8023fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802400:	5b                   	pop    %ebx
+  802401:	5e                   	pop    %esi
+  802402:	5f                   	pop    %edi
+  802403:	5d                   	pop    %ebp
+  802404:	c3                   	ret
+			sys_yield();
+  802405:	e8 e7 ec ff ff       	call   8010f1 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80240a:	8b 03                	mov    (%ebx),%eax
+  80240c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80240f:	75 18                	jne    802429 <devpipe_read+0x53>
+			if (i > 0)
+  802411:	85 f6                	test   %esi,%esi
+  802413:	75 e6                	jne    8023fb <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802415:	89 da                	mov    %ebx,%edx
+  802417:	89 f8                	mov    %edi,%eax
+  802419:	e8 d4 fe ff ff       	call   8022f2 <_pipeisclosed>
+  80241e:	85 c0                	test   %eax,%eax
+  802420:	74 e3                	je     802405 <devpipe_read+0x2f>
+				return 0;
+  802422:	b8 00 00 00 00       	mov    $0x0,%eax
+  802427:	eb d4                	jmp    8023fd <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802429:	99                   	cltd
+  80242a:	c1 ea 1b             	shr    $0x1b,%edx
+  80242d:	01 d0                	add    %edx,%eax
+  80242f:	83 e0 1f             	and    $0x1f,%eax
+  802432:	29 d0                	sub    %edx,%eax
+  802434:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802439:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80243c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80243f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802442:	83 c6 01             	add    $0x1,%esi
+  802445:	eb ab                	jmp    8023f2 <devpipe_read+0x1c>
+
+00802447 <pipe>:
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	56                   	push   %esi
+  80244b:	53                   	push   %ebx
+  80244c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80244f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802452:	50                   	push   %eax
+  802453:	e8 f6 f1 ff ff       	call   80164e <fd_alloc>
+  802458:	89 c3                	mov    %eax,%ebx
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	0f 88 23 01 00 00    	js     802588 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802465:	83 ec 04             	sub    $0x4,%esp
+  802468:	68 07 04 00 00       	push   $0x407
+  80246d:	ff 75 f4             	push   -0xc(%ebp)
+  802470:	6a 00                	push   $0x0
+  802472:	e8 fa ec ff ff       	call   801171 <sys_page_alloc>
+  802477:	89 c3                	mov    %eax,%ebx
+  802479:	83 c4 10             	add    $0x10,%esp
+  80247c:	85 c0                	test   %eax,%eax
+  80247e:	0f 88 04 01 00 00    	js     802588 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802484:	83 ec 0c             	sub    $0xc,%esp
+  802487:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80248a:	50                   	push   %eax
+  80248b:	e8 be f1 ff ff       	call   80164e <fd_alloc>
+  802490:	89 c3                	mov    %eax,%ebx
+  802492:	83 c4 10             	add    $0x10,%esp
+  802495:	85 c0                	test   %eax,%eax
+  802497:	0f 88 db 00 00 00    	js     802578 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80249d:	83 ec 04             	sub    $0x4,%esp
+  8024a0:	68 07 04 00 00       	push   $0x407
+  8024a5:	ff 75 f0             	push   -0x10(%ebp)
+  8024a8:	6a 00                	push   $0x0
+  8024aa:	e8 c2 ec ff ff       	call   801171 <sys_page_alloc>
+  8024af:	89 c3                	mov    %eax,%ebx
+  8024b1:	83 c4 10             	add    $0x10,%esp
+  8024b4:	85 c0                	test   %eax,%eax
+  8024b6:	0f 88 bc 00 00 00    	js     802578 <pipe+0x131>
+	va = fd2data(fd0);
+  8024bc:	83 ec 0c             	sub    $0xc,%esp
+  8024bf:	ff 75 f4             	push   -0xc(%ebp)
+  8024c2:	e8 70 f1 ff ff       	call   801637 <fd2data>
+  8024c7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024c9:	83 c4 0c             	add    $0xc,%esp
+  8024cc:	68 07 04 00 00       	push   $0x407
+  8024d1:	50                   	push   %eax
+  8024d2:	6a 00                	push   $0x0
+  8024d4:	e8 98 ec ff ff       	call   801171 <sys_page_alloc>
+  8024d9:	89 c3                	mov    %eax,%ebx
+  8024db:	83 c4 10             	add    $0x10,%esp
+  8024de:	85 c0                	test   %eax,%eax
+  8024e0:	0f 88 82 00 00 00    	js     802568 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024e6:	83 ec 0c             	sub    $0xc,%esp
+  8024e9:	ff 75 f0             	push   -0x10(%ebp)
+  8024ec:	e8 46 f1 ff ff       	call   801637 <fd2data>
+  8024f1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8024f8:	50                   	push   %eax
+  8024f9:	6a 00                	push   $0x0
+  8024fb:	56                   	push   %esi
+  8024fc:	6a 00                	push   $0x0
+  8024fe:	e8 f4 ec ff ff       	call   8011f7 <sys_page_map>
+  802503:	89 c3                	mov    %eax,%ebx
+  802505:	83 c4 20             	add    $0x20,%esp
+  802508:	85 c0                	test   %eax,%eax
+  80250a:	78 4e                	js     80255a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80250c:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802511:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802514:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802516:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802519:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802520:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802523:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802525:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802528:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80252f:	83 ec 0c             	sub    $0xc,%esp
+  802532:	ff 75 f4             	push   -0xc(%ebp)
+  802535:	e8 ed f0 ff ff       	call   801627 <fd2num>
+  80253a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80253d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80253f:	83 c4 04             	add    $0x4,%esp
+  802542:	ff 75 f0             	push   -0x10(%ebp)
+  802545:	e8 dd f0 ff ff       	call   801627 <fd2num>
+  80254a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80254d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802550:	83 c4 10             	add    $0x10,%esp
+  802553:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802558:	eb 2e                	jmp    802588 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80255a:	83 ec 08             	sub    $0x8,%esp
+  80255d:	56                   	push   %esi
+  80255e:	6a 00                	push   $0x0
+  802560:	e8 d4 ec ff ff       	call   801239 <sys_page_unmap>
+  802565:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802568:	83 ec 08             	sub    $0x8,%esp
+  80256b:	ff 75 f0             	push   -0x10(%ebp)
+  80256e:	6a 00                	push   $0x0
+  802570:	e8 c4 ec ff ff       	call   801239 <sys_page_unmap>
+  802575:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802578:	83 ec 08             	sub    $0x8,%esp
+  80257b:	ff 75 f4             	push   -0xc(%ebp)
+  80257e:	6a 00                	push   $0x0
+  802580:	e8 b4 ec ff ff       	call   801239 <sys_page_unmap>
+  802585:	83 c4 10             	add    $0x10,%esp
+}
+  802588:	89 d8                	mov    %ebx,%eax
+  80258a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80258d:	5b                   	pop    %ebx
+  80258e:	5e                   	pop    %esi
+  80258f:	5d                   	pop    %ebp
+  802590:	c3                   	ret
+
+00802591 <pipeisclosed>:
+{
+  802591:	55                   	push   %ebp
+  802592:	89 e5                	mov    %esp,%ebp
+  802594:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802597:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80259a:	50                   	push   %eax
+  80259b:	ff 75 08             	push   0x8(%ebp)
+  80259e:	e8 01 f1 ff ff       	call   8016a4 <fd_lookup>
+  8025a3:	83 c4 10             	add    $0x10,%esp
+  8025a6:	85 c0                	test   %eax,%eax
+  8025a8:	78 18                	js     8025c2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8025aa:	83 ec 0c             	sub    $0xc,%esp
+  8025ad:	ff 75 f4             	push   -0xc(%ebp)
+  8025b0:	e8 82 f0 ff ff       	call   801637 <fd2data>
+  8025b5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8025b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025ba:	e8 33 fd ff ff       	call   8022f2 <_pipeisclosed>
+  8025bf:	83 c4 10             	add    $0x10,%esp
+}
+  8025c2:	c9                   	leave
+  8025c3:	c3                   	ret
+
+008025c4 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8025c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c9:	c3                   	ret
+
+008025ca <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025ca:	55                   	push   %ebp
+  8025cb:	89 e5                	mov    %esp,%ebp
+  8025cd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8025d0:	68 53 32 80 00       	push   $0x803253
+  8025d5:	ff 75 0c             	push   0xc(%ebp)
+  8025d8:	e8 27 e7 ff ff       	call   800d04 <strcpy>
+	return 0;
+}
+  8025dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e2:	c9                   	leave
+  8025e3:	c3                   	ret
+
+008025e4 <devcons_write>:
+{
+  8025e4:	55                   	push   %ebp
+  8025e5:	89 e5                	mov    %esp,%ebp
+  8025e7:	57                   	push   %edi
+  8025e8:	56                   	push   %esi
+  8025e9:	53                   	push   %ebx
+  8025ea:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8025f0:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8025f5:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8025fb:	eb 2e                	jmp    80262b <devcons_write+0x47>
+		m = n - tot;
+  8025fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802600:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802602:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802607:	39 c3                	cmp    %eax,%ebx
+  802609:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80260c:	83 ec 04             	sub    $0x4,%esp
+  80260f:	53                   	push   %ebx
+  802610:	89 f0                	mov    %esi,%eax
+  802612:	03 45 0c             	add    0xc(%ebp),%eax
+  802615:	50                   	push   %eax
+  802616:	57                   	push   %edi
+  802617:	e8 6e e8 ff ff       	call   800e8a <memmove>
+		sys_cputs(buf, m);
+  80261c:	83 c4 08             	add    $0x8,%esp
+  80261f:	53                   	push   %ebx
+  802620:	57                   	push   %edi
+  802621:	e8 0e ea ff ff       	call   801034 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802626:	01 de                	add    %ebx,%esi
+  802628:	83 c4 10             	add    $0x10,%esp
+  80262b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80262e:	72 cd                	jb     8025fd <devcons_write+0x19>
+}
+  802630:	89 f0                	mov    %esi,%eax
+  802632:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802635:	5b                   	pop    %ebx
+  802636:	5e                   	pop    %esi
+  802637:	5f                   	pop    %edi
+  802638:	5d                   	pop    %ebp
+  802639:	c3                   	ret
+
+0080263a <devcons_read>:
+{
+  80263a:	55                   	push   %ebp
+  80263b:	89 e5                	mov    %esp,%ebp
+  80263d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802640:	b8 00 00 00 00       	mov    $0x0,%eax
+  802645:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802649:	75 07                	jne    802652 <devcons_read+0x18>
+  80264b:	eb 1f                	jmp    80266c <devcons_read+0x32>
+		sys_yield();
+  80264d:	e8 9f ea ff ff       	call   8010f1 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802652:	e8 fb e9 ff ff       	call   801052 <sys_cgetc>
+  802657:	85 c0                	test   %eax,%eax
+  802659:	74 f2                	je     80264d <devcons_read+0x13>
+	if (c < 0)
+  80265b:	78 0f                	js     80266c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80265d:	83 f8 04             	cmp    $0x4,%eax
+  802660:	74 0c                	je     80266e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802662:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802665:	88 02                	mov    %al,(%edx)
+	return 1;
+  802667:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80266c:	c9                   	leave
+  80266d:	c3                   	ret
+		return 0;
+  80266e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802673:	eb f7                	jmp    80266c <devcons_read+0x32>
+
+00802675 <cputchar>:
+{
+  802675:	55                   	push   %ebp
+  802676:	89 e5                	mov    %esp,%ebp
+  802678:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80267b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80267e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802681:	6a 01                	push   $0x1
+  802683:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802686:	50                   	push   %eax
+  802687:	e8 a8 e9 ff ff       	call   801034 <sys_cputs>
+}
+  80268c:	83 c4 10             	add    $0x10,%esp
+  80268f:	c9                   	leave
+  802690:	c3                   	ret
+
+00802691 <getchar>:
+{
+  802691:	55                   	push   %ebp
+  802692:	89 e5                	mov    %esp,%ebp
+  802694:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802697:	6a 01                	push   $0x1
+  802699:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80269c:	50                   	push   %eax
+  80269d:	6a 00                	push   $0x0
+  80269f:	e8 66 f2 ff ff       	call   80190a <read>
+	if (r < 0)
+  8026a4:	83 c4 10             	add    $0x10,%esp
+  8026a7:	85 c0                	test   %eax,%eax
+  8026a9:	78 06                	js     8026b1 <getchar+0x20>
+	if (r < 1)
+  8026ab:	74 06                	je     8026b3 <getchar+0x22>
+	return c;
+  8026ad:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8026b1:	c9                   	leave
+  8026b2:	c3                   	ret
+		return -E_EOF;
+  8026b3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8026b8:	eb f7                	jmp    8026b1 <getchar+0x20>
+
+008026ba <iscons>:
+{
+  8026ba:	55                   	push   %ebp
+  8026bb:	89 e5                	mov    %esp,%ebp
+  8026bd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026c3:	50                   	push   %eax
+  8026c4:	ff 75 08             	push   0x8(%ebp)
+  8026c7:	e8 d8 ef ff ff       	call   8016a4 <fd_lookup>
+  8026cc:	83 c4 10             	add    $0x10,%esp
+  8026cf:	85 c0                	test   %eax,%eax
+  8026d1:	78 11                	js     8026e4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8026d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026d6:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8026dc:	39 10                	cmp    %edx,(%eax)
+  8026de:	0f 94 c0             	sete   %al
+  8026e1:	0f b6 c0             	movzbl %al,%eax
+}
+  8026e4:	c9                   	leave
+  8026e5:	c3                   	ret
+
+008026e6 <opencons>:
+{
+  8026e6:	55                   	push   %ebp
+  8026e7:	89 e5                	mov    %esp,%ebp
+  8026e9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8026ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026ef:	50                   	push   %eax
+  8026f0:	e8 59 ef ff ff       	call   80164e <fd_alloc>
+  8026f5:	83 c4 10             	add    $0x10,%esp
+  8026f8:	85 c0                	test   %eax,%eax
+  8026fa:	78 3a                	js     802736 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8026fc:	83 ec 04             	sub    $0x4,%esp
+  8026ff:	68 07 04 00 00       	push   $0x407
+  802704:	ff 75 f4             	push   -0xc(%ebp)
+  802707:	6a 00                	push   $0x0
+  802709:	e8 63 ea ff ff       	call   801171 <sys_page_alloc>
+  80270e:	83 c4 10             	add    $0x10,%esp
+  802711:	85 c0                	test   %eax,%eax
+  802713:	78 21                	js     802736 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802715:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802718:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80271e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802720:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802723:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80272a:	83 ec 0c             	sub    $0xc,%esp
+  80272d:	50                   	push   %eax
+  80272e:	e8 f4 ee ff ff       	call   801627 <fd2num>
+  802733:	83 c4 10             	add    $0x10,%esp
+}
+  802736:	c9                   	leave
+  802737:	c3                   	ret
+
+00802738 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802738:	55                   	push   %ebp
+  802739:	89 e5                	mov    %esp,%ebp
+  80273b:	57                   	push   %edi
+  80273c:	56                   	push   %esi
+  80273d:	53                   	push   %ebx
+  80273e:	83 ec 18             	sub    $0x18,%esp
+  802741:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802744:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802747:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80274a:	85 db                	test   %ebx,%ebx
+  80274c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802751:	0f 45 c3             	cmovne %ebx,%eax
+  802754:	50                   	push   %eax
+  802755:	e8 9a ed ff ff       	call   8014f4 <sys_ipc_recv>
+
+	if (from_env_store)
+  80275a:	83 c4 10             	add    $0x10,%esp
+  80275d:	85 ff                	test   %edi,%edi
+  80275f:	74 17                	je     802778 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802761:	ba 00 00 00 00       	mov    $0x0,%edx
+  802766:	85 c0                	test   %eax,%eax
+  802768:	75 0c                	jne    802776 <ipc_recv+0x3e>
+  80276a:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+  802770:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802776:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802778:	85 f6                	test   %esi,%esi
+  80277a:	74 2e                	je     8027aa <ipc_recv+0x72>
+		if (!r && pg)
+  80277c:	85 c0                	test   %eax,%eax
+  80277e:	75 24                	jne    8027a4 <ipc_recv+0x6c>
+  802780:	85 db                	test   %ebx,%ebx
+  802782:	74 20                	je     8027a4 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802784:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  802789:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  80278f:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802791:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  802796:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80279c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80279f:	5b                   	pop    %ebx
+  8027a0:	5e                   	pop    %esi
+  8027a1:	5f                   	pop    %edi
+  8027a2:	5d                   	pop    %ebp
+  8027a3:	c3                   	ret
+			*perm_store = 0;
+  8027a4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  8027aa:	85 c0                	test   %eax,%eax
+  8027ac:	75 ee                	jne    80279c <ipc_recv+0x64>
+  8027ae:	eb e1                	jmp    802791 <ipc_recv+0x59>
+
+008027b0 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8027b0:	55                   	push   %ebp
+  8027b1:	89 e5                	mov    %esp,%ebp
+  8027b3:	57                   	push   %edi
+  8027b4:	56                   	push   %esi
+  8027b5:	53                   	push   %ebx
+  8027b6:	83 ec 0c             	sub    $0xc,%esp
+  8027b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027bc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8027bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8027c2:	85 db                	test   %ebx,%ebx
+  8027c4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8027c9:	0f 44 d8             	cmove  %eax,%ebx
+  8027cc:	ff 75 14             	push   0x14(%ebp)
+  8027cf:	53                   	push   %ebx
+  8027d0:	56                   	push   %esi
+  8027d1:	57                   	push   %edi
+  8027d2:	e8 fa ec ff ff       	call   8014d1 <sys_ipc_try_send_yield>
+  8027d7:	83 c4 10             	add    $0x10,%esp
+  8027da:	85 c0                	test   %eax,%eax
+  8027dc:	79 1e                	jns    8027fc <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8027de:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8027e1:	75 07                	jne    8027ea <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8027e3:	e8 09 e9 ff ff       	call   8010f1 <sys_yield>
+  8027e8:	eb e2                	jmp    8027cc <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8027ea:	50                   	push   %eax
+  8027eb:	68 5f 32 80 00       	push   $0x80325f
+  8027f0:	6a 3d                	push   $0x3d
+  8027f2:	68 74 32 80 00       	push   $0x803274
+  8027f7:	e8 3f de ff ff       	call   80063b <_panic>
+	}
+}
+  8027fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027ff:	5b                   	pop    %ebx
+  802800:	5e                   	pop    %esi
+  802801:	5f                   	pop    %edi
+  802802:	5d                   	pop    %ebp
+  802803:	c3                   	ret
+
+00802804 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802804:	55                   	push   %ebp
+  802805:	89 e5                	mov    %esp,%ebp
+  802807:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  80280a:	ff 75 08             	push   0x8(%ebp)
+  80280d:	e8 5f e8 ff ff       	call   801071 <sys_env_find>
+}
+  802812:	c9                   	leave
+  802813:	c3                   	ret
+
+00802814 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802814:	55                   	push   %ebp
+  802815:	89 e5                	mov    %esp,%ebp
+  802817:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80281a:	89 c2                	mov    %eax,%edx
+  80281c:	c1 ea 16             	shr    $0x16,%edx
+  80281f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802826:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80282b:	f6 c1 01             	test   $0x1,%cl
+  80282e:	74 22                	je     802852 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802830:	c1 e8 0c             	shr    $0xc,%eax
+  802833:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80283a:	a8 01                	test   $0x1,%al
+  80283c:	74 14                	je     802852 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80283e:	c1 e8 0c             	shr    $0xc,%eax
+  802841:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802844:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80284b:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80284f:	0f b7 d2             	movzwl %dx,%edx
+}
+  802852:	89 d0                	mov    %edx,%eax
+  802854:	5d                   	pop    %ebp
+  802855:	c3                   	ret
+  802856:	66 90                	xchg   %ax,%ax
+  802858:	66 90                	xchg   %ax,%ax
+  80285a:	66 90                	xchg   %ax,%ax
+  80285c:	66 90                	xchg   %ax,%ax
+  80285e:	66 90                	xchg   %ax,%ax
+
+00802860 <__udivmoddi4>:
+  802860:	55                   	push   %ebp
+  802861:	57                   	push   %edi
+  802862:	56                   	push   %esi
+  802863:	53                   	push   %ebx
+  802864:	83 ec 14             	sub    $0x14,%esp
+  802867:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80286b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80286f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802873:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802877:	89 f1                	mov    %esi,%ecx
+  802879:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80287d:	09 d9                	or     %ebx,%ecx
+  80287f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802883:	0f 84 92 00 00 00    	je     80291b <__udivmoddi4+0xbb>
+  802889:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802890:	00 
+  802891:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802896:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80289d:	00 
+  80289e:	89 1c 24             	mov    %ebx,(%esp)
+  8028a1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8028a5:	8d 76 00             	lea    0x0(%esi),%esi
+  8028a8:	89 e9                	mov    %ebp,%ecx
+  8028aa:	89 c3                	mov    %eax,%ebx
+  8028ac:	89 d6                	mov    %edx,%esi
+  8028ae:	31 ff                	xor    %edi,%edi
+  8028b0:	d3 ee                	shr    %cl,%esi
+  8028b2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8028b5:	f6 c1 20             	test   $0x20,%cl
+  8028b8:	0f 45 de             	cmovne %esi,%ebx
+  8028bb:	0f 45 f7             	cmovne %edi,%esi
+  8028be:	8b 3c 24             	mov    (%esp),%edi
+  8028c1:	39 fb                	cmp    %edi,%ebx
+  8028c3:	89 f7                	mov    %esi,%edi
+  8028c5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8028c9:	8b 1c 24             	mov    (%esp),%ebx
+  8028cc:	19 f7                	sbb    %esi,%edi
+  8028ce:	72 39                	jb     802909 <__udivmoddi4+0xa9>
+  8028d0:	89 e9                	mov    %ebp,%ecx
+  8028d2:	89 f7                	mov    %esi,%edi
+  8028d4:	89 de                	mov    %ebx,%esi
+  8028d6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8028d9:	d3 e6                	shl    %cl,%esi
+  8028db:	31 db                	xor    %ebx,%ebx
+  8028dd:	f6 c1 20             	test   $0x20,%cl
+  8028e0:	0f 45 fe             	cmovne %esi,%edi
+  8028e3:	0f 45 f3             	cmovne %ebx,%esi
+  8028e6:	29 f0                	sub    %esi,%eax
+  8028e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8028ed:	19 fa                	sbb    %edi,%edx
+  8028ef:	31 ff                	xor    %edi,%edi
+  8028f1:	31 db                	xor    %ebx,%ebx
+  8028f3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8028f6:	d3 e6                	shl    %cl,%esi
+  8028f8:	f6 c1 20             	test   $0x20,%cl
+  8028fb:	0f 45 fe             	cmovne %esi,%edi
+  8028fe:	0f 45 f3             	cmovne %ebx,%esi
+  802901:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802905:	09 74 24 08          	or     %esi,0x8(%esp)
+  802909:	83 ed 01             	sub    $0x1,%ebp
+  80290c:	73 9a                	jae    8028a8 <__udivmoddi4+0x48>
+  80290e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802912:	85 ff                	test   %edi,%edi
+  802914:	74 05                	je     80291b <__udivmoddi4+0xbb>
+  802916:	89 07                	mov    %eax,(%edi)
+  802918:	89 57 04             	mov    %edx,0x4(%edi)
+  80291b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80291f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802923:	83 c4 14             	add    $0x14,%esp
+  802926:	5b                   	pop    %ebx
+  802927:	5e                   	pop    %esi
+  802928:	5f                   	pop    %edi
+  802929:	5d                   	pop    %ebp
+  80292a:	c3                   	ret
+  80292b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80292f:	90                   	nop
+
+00802930 <__udivdi3>:
+  802930:	55                   	push   %ebp
+  802931:	57                   	push   %edi
+  802932:	56                   	push   %esi
+  802933:	53                   	push   %ebx
+  802934:	83 ec 14             	sub    $0x14,%esp
+  802937:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80293b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80293f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802943:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802947:	89 fb                	mov    %edi,%ebx
+  802949:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80294d:	09 f3                	or     %esi,%ebx
+  80294f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802953:	0f 84 85 00 00 00    	je     8029de <__udivdi3+0xae>
+  802959:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802960:	00 
+  802961:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802966:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80296d:	00 
+  80296e:	89 34 24             	mov    %esi,(%esp)
+  802971:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802975:	8d 76 00             	lea    0x0(%esi),%esi
+  802978:	89 e9                	mov    %ebp,%ecx
+  80297a:	89 c3                	mov    %eax,%ebx
+  80297c:	89 d6                	mov    %edx,%esi
+  80297e:	31 ff                	xor    %edi,%edi
+  802980:	d3 ee                	shr    %cl,%esi
+  802982:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802985:	f6 c1 20             	test   $0x20,%cl
+  802988:	0f 45 de             	cmovne %esi,%ebx
+  80298b:	0f 45 f7             	cmovne %edi,%esi
+  80298e:	8b 3c 24             	mov    (%esp),%edi
+  802991:	39 fb                	cmp    %edi,%ebx
+  802993:	89 f7                	mov    %esi,%edi
+  802995:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802999:	8b 1c 24             	mov    (%esp),%ebx
+  80299c:	19 f7                	sbb    %esi,%edi
+  80299e:	72 39                	jb     8029d9 <__udivdi3+0xa9>
+  8029a0:	89 e9                	mov    %ebp,%ecx
+  8029a2:	89 f7                	mov    %esi,%edi
+  8029a4:	89 de                	mov    %ebx,%esi
+  8029a6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8029a9:	d3 e6                	shl    %cl,%esi
+  8029ab:	31 db                	xor    %ebx,%ebx
+  8029ad:	f6 c1 20             	test   $0x20,%cl
+  8029b0:	0f 45 fe             	cmovne %esi,%edi
+  8029b3:	0f 45 f3             	cmovne %ebx,%esi
+  8029b6:	29 f0                	sub    %esi,%eax
+  8029b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8029bd:	19 fa                	sbb    %edi,%edx
+  8029bf:	31 ff                	xor    %edi,%edi
+  8029c1:	31 db                	xor    %ebx,%ebx
+  8029c3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029c6:	d3 e6                	shl    %cl,%esi
+  8029c8:	f6 c1 20             	test   $0x20,%cl
+  8029cb:	0f 45 fe             	cmovne %esi,%edi
+  8029ce:	0f 45 f3             	cmovne %ebx,%esi
+  8029d1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8029d5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8029d9:	83 ed 01             	sub    $0x1,%ebp
+  8029dc:	73 9a                	jae    802978 <__udivdi3+0x48>
+  8029de:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029e2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029e6:	83 c4 14             	add    $0x14,%esp
+  8029e9:	5b                   	pop    %ebx
+  8029ea:	5e                   	pop    %esi
+  8029eb:	5f                   	pop    %edi
+  8029ec:	5d                   	pop    %ebp
+  8029ed:	c3                   	ret
+  8029ee:	66 90                	xchg   %ax,%ax
+
+008029f0 <__umoddi3>:
+  8029f0:	57                   	push   %edi
+  8029f1:	56                   	push   %esi
+  8029f2:	53                   	push   %ebx
+  8029f3:	83 ec 08             	sub    $0x8,%esp
+  8029f6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8029fa:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8029fe:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a02:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a06:	89 f9                	mov    %edi,%ecx
+  802a08:	89 34 24             	mov    %esi,(%esp)
+  802a0b:	09 f1                	or     %esi,%ecx
+  802a0d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802a11:	74 53                	je     802a66 <__umoddi3+0x76>
+  802a13:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a1f:	90                   	nop
+  802a20:	89 c6                	mov    %eax,%esi
+  802a22:	89 d7                	mov    %edx,%edi
+  802a24:	31 db                	xor    %ebx,%ebx
+  802a26:	d3 ef                	shr    %cl,%edi
+  802a28:	0f ad d6             	shrd   %cl,%edx,%esi
+  802a2b:	f6 c1 20             	test   $0x20,%cl
+  802a2e:	0f 45 f7             	cmovne %edi,%esi
+  802a31:	0f 45 fb             	cmovne %ebx,%edi
+  802a34:	8b 1c 24             	mov    (%esp),%ebx
+  802a37:	39 de                	cmp    %ebx,%esi
+  802a39:	89 fb                	mov    %edi,%ebx
+  802a3b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  802a3f:	8b 34 24             	mov    (%esp),%esi
+  802a42:	19 fb                	sbb    %edi,%ebx
+  802a44:	72 14                	jb     802a5a <__umoddi3+0x6a>
+  802a46:	0f a5 f7             	shld   %cl,%esi,%edi
+  802a49:	31 db                	xor    %ebx,%ebx
+  802a4b:	d3 e6                	shl    %cl,%esi
+  802a4d:	f6 c1 20             	test   $0x20,%cl
+  802a50:	0f 45 fe             	cmovne %esi,%edi
+  802a53:	0f 45 f3             	cmovne %ebx,%esi
+  802a56:	29 f0                	sub    %esi,%eax
+  802a58:	19 fa                	sbb    %edi,%edx
+  802a5a:	83 e9 01             	sub    $0x1,%ecx
+  802a5d:	73 c1                	jae    802a20 <__umoddi3+0x30>
+  802a5f:	83 c4 08             	add    $0x8,%esp
+  802a62:	5b                   	pop    %ebx
+  802a63:	5e                   	pop    %esi
+  802a64:	5f                   	pop    %edi
+  802a65:	c3                   	ret
+  802a66:	83 c4 08             	add    $0x8,%esp
+  802a69:	31 c0                	xor    %eax,%eax
+  802a6b:	31 d2                	xor    %edx,%edx
+  802a6d:	5b                   	pop    %ebx
+  802a6e:	5e                   	pop    %esi
+  802a6f:	5f                   	pop    %edi
+  802a70:	c3                   	ret
+  802a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a7f:	90                   	nop
+
+00802a80 <__divdi3>:
+  802a80:	55                   	push   %ebp
+  802a81:	57                   	push   %edi
+  802a82:	56                   	push   %esi
+  802a83:	53                   	push   %ebx
+  802a84:	83 ec 1c             	sub    $0x1c,%esp
+  802a87:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802a8b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802a8f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802a93:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802a97:	85 ff                	test   %edi,%edi
+  802a99:	0f 88 da 00 00 00    	js     802b79 <__divdi3+0xf9>
+  802a9f:	85 db                	test   %ebx,%ebx
+  802aa1:	78 16                	js     802ab9 <__divdi3+0x39>
+  802aa3:	89 dd                	mov    %ebx,%ebp
+  802aa5:	89 c8                	mov    %ecx,%eax
+  802aa7:	89 da                	mov    %ebx,%edx
+  802aa9:	09 cd                	or     %ecx,%ebp
+  802aab:	0f 85 fd 00 00 00    	jne    802bae <__divdi3+0x12e>
+  802ab1:	83 c4 1c             	add    $0x1c,%esp
+  802ab4:	5b                   	pop    %ebx
+  802ab5:	5e                   	pop    %esi
+  802ab6:	5f                   	pop    %edi
+  802ab7:	5d                   	pop    %ebp
+  802ab8:	c3                   	ret
+  802ab9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802abe:	f7 d9                	neg    %ecx
+  802ac0:	89 f0                	mov    %esi,%eax
+  802ac2:	89 fa                	mov    %edi,%edx
+  802ac4:	83 d3 00             	adc    $0x0,%ebx
+  802ac7:	89 0c 24             	mov    %ecx,(%esp)
+  802aca:	f7 db                	neg    %ebx
+  802acc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802ad0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802ad7:	00 
+  802ad8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802add:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802ae4:	00 
+  802ae5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802ae9:	89 cd                	mov    %ecx,%ebp
+  802aeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802aef:	90                   	nop
+  802af0:	89 e9                	mov    %ebp,%ecx
+  802af2:	89 c3                	mov    %eax,%ebx
+  802af4:	89 d6                	mov    %edx,%esi
+  802af6:	31 ff                	xor    %edi,%edi
+  802af8:	d3 ee                	shr    %cl,%esi
+  802afa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802afd:	f6 c1 20             	test   $0x20,%cl
+  802b00:	0f 45 de             	cmovne %esi,%ebx
+  802b03:	0f 45 f7             	cmovne %edi,%esi
+  802b06:	8b 3c 24             	mov    (%esp),%edi
+  802b09:	39 fb                	cmp    %edi,%ebx
+  802b0b:	89 f7                	mov    %esi,%edi
+  802b0d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802b11:	8b 1c 24             	mov    (%esp),%ebx
+  802b14:	19 f7                	sbb    %esi,%edi
+  802b16:	72 39                	jb     802b51 <__divdi3+0xd1>
+  802b18:	89 e9                	mov    %ebp,%ecx
+  802b1a:	89 f7                	mov    %esi,%edi
+  802b1c:	89 de                	mov    %ebx,%esi
+  802b1e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802b21:	d3 e6                	shl    %cl,%esi
+  802b23:	31 db                	xor    %ebx,%ebx
+  802b25:	f6 c1 20             	test   $0x20,%cl
+  802b28:	0f 45 fe             	cmovne %esi,%edi
+  802b2b:	0f 45 f3             	cmovne %ebx,%esi
+  802b2e:	29 f0                	sub    %esi,%eax
+  802b30:	be 01 00 00 00       	mov    $0x1,%esi
+  802b35:	19 fa                	sbb    %edi,%edx
+  802b37:	31 ff                	xor    %edi,%edi
+  802b39:	31 db                	xor    %ebx,%ebx
+  802b3b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802b3e:	d3 e6                	shl    %cl,%esi
+  802b40:	f6 c1 20             	test   $0x20,%cl
+  802b43:	0f 45 fe             	cmovne %esi,%edi
+  802b46:	0f 45 f3             	cmovne %ebx,%esi
+  802b49:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802b4d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802b51:	83 ed 01             	sub    $0x1,%ebp
+  802b54:	73 9a                	jae    802af0 <__divdi3+0x70>
+  802b56:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802b5a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b5e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b62:	85 ed                	test   %ebp,%ebp
+  802b64:	0f 84 47 ff ff ff    	je     802ab1 <__divdi3+0x31>
+  802b6a:	f7 d8                	neg    %eax
+  802b6c:	83 d2 00             	adc    $0x0,%edx
+  802b6f:	83 c4 1c             	add    $0x1c,%esp
+  802b72:	5b                   	pop    %ebx
+  802b73:	f7 da                	neg    %edx
+  802b75:	5e                   	pop    %esi
+  802b76:	5f                   	pop    %edi
+  802b77:	5d                   	pop    %ebp
+  802b78:	c3                   	ret
+  802b79:	f7 de                	neg    %esi
+  802b7b:	83 d7 00             	adc    $0x0,%edi
+  802b7e:	f7 df                	neg    %edi
+  802b80:	85 db                	test   %ebx,%ebx
+  802b82:	78 23                	js     802ba7 <__divdi3+0x127>
+  802b84:	89 dd                	mov    %ebx,%ebp
+  802b86:	89 c8                	mov    %ecx,%eax
+  802b88:	89 da                	mov    %ebx,%edx
+  802b8a:	09 cd                	or     %ecx,%ebp
+  802b8c:	0f 84 1f ff ff ff    	je     802ab1 <__divdi3+0x31>
+  802b92:	89 0c 24             	mov    %ecx,(%esp)
+  802b95:	89 f0                	mov    %esi,%eax
+  802b97:	89 fa                	mov    %edi,%edx
+  802b99:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802b9e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802ba2:	e9 29 ff ff ff       	jmp    802ad0 <__divdi3+0x50>
+  802ba7:	31 ed                	xor    %ebp,%ebp
+  802ba9:	e9 10 ff ff ff       	jmp    802abe <__divdi3+0x3e>
+  802bae:	89 0c 24             	mov    %ecx,(%esp)
+  802bb1:	89 f0                	mov    %esi,%eax
+  802bb3:	89 fa                	mov    %edi,%edx
+  802bb5:	31 ed                	xor    %ebp,%ebp
+  802bb7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802bbb:	e9 10 ff ff ff       	jmp    802ad0 <__divdi3+0x50>
+
+00802bc0 <__moddi3>:
+  802bc0:	55                   	push   %ebp
+  802bc1:	57                   	push   %edi
+  802bc2:	56                   	push   %esi
+  802bc3:	53                   	push   %ebx
+  802bc4:	83 ec 14             	sub    $0x14,%esp
+  802bc7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802bcb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802bcf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802bd3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802bd7:	85 d2                	test   %edx,%edx
+  802bd9:	0f 88 9b 00 00 00    	js     802c7a <__moddi3+0xba>
+  802bdf:	89 f7                	mov    %esi,%edi
+  802be1:	31 ed                	xor    %ebp,%ebp
+  802be3:	09 cf                	or     %ecx,%edi
+  802be5:	0f 84 83 00 00 00    	je     802c6e <__moddi3+0xae>
+  802beb:	89 cb                	mov    %ecx,%ebx
+  802bed:	89 f7                	mov    %esi,%edi
+  802bef:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802bf3:	f7 db                	neg    %ebx
+  802bf5:	83 d7 00             	adc    $0x0,%edi
+  802bf8:	f7 df                	neg    %edi
+  802bfa:	0f 49 f7             	cmovns %edi,%esi
+  802bfd:	0f 49 cb             	cmovns %ebx,%ecx
+  802c00:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802c04:	89 0c 24             	mov    %ecx,(%esp)
+  802c07:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c0c:	89 cd                	mov    %ecx,%ebp
+  802c0e:	66 90                	xchg   %ax,%ax
+  802c10:	89 e9                	mov    %ebp,%ecx
+  802c12:	89 c3                	mov    %eax,%ebx
+  802c14:	89 d6                	mov    %edx,%esi
+  802c16:	31 ff                	xor    %edi,%edi
+  802c18:	d3 ee                	shr    %cl,%esi
+  802c1a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802c1d:	f6 c1 20             	test   $0x20,%cl
+  802c20:	0f 45 de             	cmovne %esi,%ebx
+  802c23:	0f 45 f7             	cmovne %edi,%esi
+  802c26:	8b 3c 24             	mov    (%esp),%edi
+  802c29:	39 fb                	cmp    %edi,%ebx
+  802c2b:	89 f7                	mov    %esi,%edi
+  802c2d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c31:	8b 1c 24             	mov    (%esp),%ebx
+  802c34:	19 f7                	sbb    %esi,%edi
+  802c36:	72 1a                	jb     802c52 <__moddi3+0x92>
+  802c38:	89 e9                	mov    %ebp,%ecx
+  802c3a:	89 f7                	mov    %esi,%edi
+  802c3c:	89 de                	mov    %ebx,%esi
+  802c3e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802c41:	d3 e6                	shl    %cl,%esi
+  802c43:	31 db                	xor    %ebx,%ebx
+  802c45:	f6 c1 20             	test   $0x20,%cl
+  802c48:	0f 45 fe             	cmovne %esi,%edi
+  802c4b:	0f 45 f3             	cmovne %ebx,%esi
+  802c4e:	29 f0                	sub    %esi,%eax
+  802c50:	19 fa                	sbb    %edi,%edx
+  802c52:	83 ed 01             	sub    $0x1,%ebp
+  802c55:	73 b9                	jae    802c10 <__moddi3+0x50>
+  802c57:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802c5b:	85 ed                	test   %ebp,%ebp
+  802c5d:	74 07                	je     802c66 <__moddi3+0xa6>
+  802c5f:	f7 d8                	neg    %eax
+  802c61:	83 d2 00             	adc    $0x0,%edx
+  802c64:	f7 da                	neg    %edx
+  802c66:	83 c4 14             	add    $0x14,%esp
+  802c69:	5b                   	pop    %ebx
+  802c6a:	5e                   	pop    %esi
+  802c6b:	5f                   	pop    %edi
+  802c6c:	5d                   	pop    %ebp
+  802c6d:	c3                   	ret
+  802c6e:	83 c4 14             	add    $0x14,%esp
+  802c71:	31 c0                	xor    %eax,%eax
+  802c73:	31 d2                	xor    %edx,%edx
+  802c75:	5b                   	pop    %ebx
+  802c76:	5e                   	pop    %esi
+  802c77:	5f                   	pop    %edi
+  802c78:	5d                   	pop    %ebp
+  802c79:	c3                   	ret
+  802c7a:	89 f7                	mov    %esi,%edi
+  802c7c:	09 cf                	or     %ecx,%edi
+  802c7e:	74 11                	je     802c91 <__moddi3+0xd1>
+  802c80:	f7 d8                	neg    %eax
+  802c82:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802c87:	83 d2 00             	adc    $0x0,%edx
+  802c8a:	f7 da                	neg    %edx
+  802c8c:	e9 5a ff ff ff       	jmp    802beb <__moddi3+0x2b>
+  802c91:	31 c0                	xor    %eax,%eax
+  802c93:	31 d2                	xor    %edx,%edx
+  802c95:	eb c8                	jmp    802c5f <__moddi3+0x9f>
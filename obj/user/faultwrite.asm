@@ -0,0 +1,5555 @@
+
+obj/user/faultwrite.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0d 00 00 00       	call   80003e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	*(unsigned*)0 = 0;
+  800033:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80003a:	00 00 00 
+}
+  80003d:	c3                   	ret
+
+0080003e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003e:	55                   	push   %ebp
+  80003f:	89 e5                	mov    %esp,%ebp
+  800041:	56                   	push   %esi
+  800042:	53                   	push   %ebx
+  800043:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800046:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800049:	e8 ee 00 00 00       	call   80013c <sys_getenvid>
+  80004e:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800053:	c1 e0 09             	shl    $0x9,%eax
+  800056:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005b:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800060:	85 db                	test   %ebx,%ebx
+  800062:	7e 07                	jle    80006b <libmain+0x2d>
+		binaryname = argv[0];
+  800064:	8b 06                	mov    (%esi),%eax
+  800066:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80006b:	83 ec 08             	sub    $0x8,%esp
+  80006e:	56                   	push   %esi
+  80006f:	53                   	push   %ebx
+  800070:	e8 be ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800075:	e8 0a 00 00 00       	call   800084 <exit>
+}
+  80007a:	83 c4 10             	add    $0x10,%esp
+  80007d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800080:	5b                   	pop    %ebx
+  800081:	5e                   	pop    %esi
+  800082:	5d                   	pop    %ebp
+  800083:	c3                   	ret
+
+00800084 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800084:	55                   	push   %ebp
+  800085:	89 e5                	mov    %esp,%ebp
+  800087:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80008a:	e8 45 07 00 00       	call   8007d4 <close_all>
+	sys_env_destroy(0);
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	6a 00                	push   $0x0
+  800094:	e8 62 00 00 00       	call   8000fb <sys_env_destroy>
+}
+  800099:	83 c4 10             	add    $0x10,%esp
+  80009c:	c9                   	leave
+  80009d:	c3                   	ret
+
+0080009e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80009e:	55                   	push   %ebp
+  80009f:	89 e5                	mov    %esp,%ebp
+  8000a1:	57                   	push   %edi
+  8000a2:	56                   	push   %esi
+  8000a3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000af:	89 c3                	mov    %eax,%ebx
+  8000b1:	89 c7                	mov    %eax,%edi
+  8000b3:	89 c6                	mov    %eax,%esi
+  8000b5:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000b7:	5b                   	pop    %ebx
+  8000b8:	5e                   	pop    %esi
+  8000b9:	5f                   	pop    %edi
+  8000ba:	5d                   	pop    %ebp
+  8000bb:	c3                   	ret
+
+008000bc <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000bc:	55                   	push   %ebp
+  8000bd:	89 e5                	mov    %esp,%ebp
+  8000bf:	57                   	push   %edi
+  8000c0:	56                   	push   %esi
+  8000c1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000cc:	89 d1                	mov    %edx,%ecx
+  8000ce:	89 d3                	mov    %edx,%ebx
+  8000d0:	89 d7                	mov    %edx,%edi
+  8000d2:	89 d6                	mov    %edx,%esi
+  8000d4:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000d6:	5b                   	pop    %ebx
+  8000d7:	5e                   	pop    %esi
+  8000d8:	5f                   	pop    %edi
+  8000d9:	5d                   	pop    %ebp
+  8000da:	c3                   	ret
+
+008000db <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8000db:	55                   	push   %ebp
+  8000dc:	89 e5                	mov    %esp,%ebp
+  8000de:	57                   	push   %edi
+  8000df:	56                   	push   %esi
+  8000e0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8000ee:	89 cb                	mov    %ecx,%ebx
+  8000f0:	89 cf                	mov    %ecx,%edi
+  8000f2:	89 ce                	mov    %ecx,%esi
+  8000f4:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  8000f6:	5b                   	pop    %ebx
+  8000f7:	5e                   	pop    %esi
+  8000f8:	5f                   	pop    %edi
+  8000f9:	5d                   	pop    %ebp
+  8000fa:	c3                   	ret
+
+008000fb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000fb:	55                   	push   %ebp
+  8000fc:	89 e5                	mov    %esp,%ebp
+  8000fe:	57                   	push   %edi
+  8000ff:	56                   	push   %esi
+  800100:	53                   	push   %ebx
+  800101:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800104:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800109:	8b 55 08             	mov    0x8(%ebp),%edx
+  80010c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800111:	89 cb                	mov    %ecx,%ebx
+  800113:	89 cf                	mov    %ecx,%edi
+  800115:	89 ce                	mov    %ecx,%esi
+  800117:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800119:	85 c0                	test   %eax,%eax
+  80011b:	7f 08                	jg     800125 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80011d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800120:	5b                   	pop    %ebx
+  800121:	5e                   	pop    %esi
+  800122:	5f                   	pop    %edi
+  800123:	5d                   	pop    %ebp
+  800124:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800125:	83 ec 0c             	sub    $0xc,%esp
+  800128:	50                   	push   %eax
+  800129:	6a 03                	push   $0x3
+  80012b:	68 8a 26 80 00       	push   $0x80268a
+  800130:	6a 23                	push   $0x23
+  800132:	68 a7 26 80 00       	push   $0x8026a7
+  800137:	e8 d5 15 00 00       	call   801711 <_panic>
+
+0080013c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80013c:	55                   	push   %ebp
+  80013d:	89 e5                	mov    %esp,%ebp
+  80013f:	57                   	push   %edi
+  800140:	56                   	push   %esi
+  800141:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800142:	ba 00 00 00 00       	mov    $0x0,%edx
+  800147:	b8 02 00 00 00       	mov    $0x2,%eax
+  80014c:	89 d1                	mov    %edx,%ecx
+  80014e:	89 d3                	mov    %edx,%ebx
+  800150:	89 d7                	mov    %edx,%edi
+  800152:	89 d6                	mov    %edx,%esi
+  800154:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800156:	5b                   	pop    %ebx
+  800157:	5e                   	pop    %esi
+  800158:	5f                   	pop    %edi
+  800159:	5d                   	pop    %ebp
+  80015a:	c3                   	ret
+
+0080015b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80015b:	55                   	push   %ebp
+  80015c:	89 e5                	mov    %esp,%ebp
+  80015e:	57                   	push   %edi
+  80015f:	56                   	push   %esi
+  800160:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800161:	ba 00 00 00 00       	mov    $0x0,%edx
+  800166:	b8 16 00 00 00       	mov    $0x16,%eax
+  80016b:	89 d1                	mov    %edx,%ecx
+  80016d:	89 d3                	mov    %edx,%ebx
+  80016f:	89 d7                	mov    %edx,%edi
+  800171:	89 d6                	mov    %edx,%esi
+  800173:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800175:	5b                   	pop    %ebx
+  800176:	5e                   	pop    %esi
+  800177:	5f                   	pop    %edi
+  800178:	5d                   	pop    %ebp
+  800179:	c3                   	ret
+
+0080017a <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  80017a:	55                   	push   %ebp
+  80017b:	89 e5                	mov    %esp,%ebp
+  80017d:	57                   	push   %edi
+  80017e:	56                   	push   %esi
+  80017f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800180:	ba 00 00 00 00       	mov    $0x0,%edx
+  800185:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80018a:	89 d1                	mov    %edx,%ecx
+  80018c:	89 d3                	mov    %edx,%ebx
+  80018e:	89 d7                	mov    %edx,%edi
+  800190:	89 d6                	mov    %edx,%esi
+  800192:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800194:	5b                   	pop    %ebx
+  800195:	5e                   	pop    %esi
+  800196:	5f                   	pop    %edi
+  800197:	5d                   	pop    %ebp
+  800198:	c3                   	ret
+
+00800199 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800199:	55                   	push   %ebp
+  80019a:	89 e5                	mov    %esp,%ebp
+  80019c:	57                   	push   %edi
+  80019d:	56                   	push   %esi
+  80019e:	53                   	push   %ebx
+  80019f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ad:	b8 15 00 00 00       	mov    $0x15,%eax
+  8001b2:	89 df                	mov    %ebx,%edi
+  8001b4:	89 de                	mov    %ebx,%esi
+  8001b6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001b8:	85 c0                	test   %eax,%eax
+  8001ba:	7f 08                	jg     8001c4 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  8001bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001bf:	5b                   	pop    %ebx
+  8001c0:	5e                   	pop    %esi
+  8001c1:	5f                   	pop    %edi
+  8001c2:	5d                   	pop    %ebp
+  8001c3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001c4:	83 ec 0c             	sub    $0xc,%esp
+  8001c7:	50                   	push   %eax
+  8001c8:	6a 15                	push   $0x15
+  8001ca:	68 8a 26 80 00       	push   $0x80268a
+  8001cf:	6a 23                	push   $0x23
+  8001d1:	68 a7 26 80 00       	push   $0x8026a7
+  8001d6:	e8 36 15 00 00       	call   801711 <_panic>
+
+008001db <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001db:	55                   	push   %ebp
+  8001dc:	89 e5                	mov    %esp,%ebp
+  8001de:	57                   	push   %edi
+  8001df:	56                   	push   %esi
+  8001e0:	53                   	push   %ebx
+  8001e1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ef:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001f7:	89 f7                	mov    %esi,%edi
+  8001f9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001fb:	85 c0                	test   %eax,%eax
+  8001fd:	7f 08                	jg     800207 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800202:	5b                   	pop    %ebx
+  800203:	5e                   	pop    %esi
+  800204:	5f                   	pop    %edi
+  800205:	5d                   	pop    %ebp
+  800206:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800207:	83 ec 0c             	sub    $0xc,%esp
+  80020a:	50                   	push   %eax
+  80020b:	6a 05                	push   $0x5
+  80020d:	68 8a 26 80 00       	push   $0x80268a
+  800212:	6a 23                	push   $0x23
+  800214:	68 a7 26 80 00       	push   $0x8026a7
+  800219:	e8 f3 14 00 00       	call   801711 <_panic>
+
+0080021e <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  80021e:	55                   	push   %ebp
+  80021f:	89 e5                	mov    %esp,%ebp
+  800221:	57                   	push   %edi
+  800222:	56                   	push   %esi
+  800223:	53                   	push   %ebx
+  800224:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800227:	be 00 00 00 00       	mov    $0x0,%esi
+  80022c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80022f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800232:	b8 06 00 00 00       	mov    $0x6,%eax
+  800237:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80023a:	89 f7                	mov    %esi,%edi
+  80023c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80023e:	85 c0                	test   %eax,%eax
+  800240:	7f 08                	jg     80024a <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800242:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800245:	5b                   	pop    %ebx
+  800246:	5e                   	pop    %esi
+  800247:	5f                   	pop    %edi
+  800248:	5d                   	pop    %ebp
+  800249:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80024a:	83 ec 0c             	sub    $0xc,%esp
+  80024d:	50                   	push   %eax
+  80024e:	6a 06                	push   $0x6
+  800250:	68 8a 26 80 00       	push   $0x80268a
+  800255:	6a 23                	push   $0x23
+  800257:	68 a7 26 80 00       	push   $0x8026a7
+  80025c:	e8 b0 14 00 00       	call   801711 <_panic>
+
+00800261 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800261:	55                   	push   %ebp
+  800262:	89 e5                	mov    %esp,%ebp
+  800264:	57                   	push   %edi
+  800265:	56                   	push   %esi
+  800266:	53                   	push   %ebx
+  800267:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80026a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80026d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800270:	b8 07 00 00 00       	mov    $0x7,%eax
+  800275:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800278:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80027b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80027e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800280:	85 c0                	test   %eax,%eax
+  800282:	7f 08                	jg     80028c <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800284:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800287:	5b                   	pop    %ebx
+  800288:	5e                   	pop    %esi
+  800289:	5f                   	pop    %edi
+  80028a:	5d                   	pop    %ebp
+  80028b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	50                   	push   %eax
+  800290:	6a 07                	push   $0x7
+  800292:	68 8a 26 80 00       	push   $0x80268a
+  800297:	6a 23                	push   $0x23
+  800299:	68 a7 26 80 00       	push   $0x8026a7
+  80029e:	e8 6e 14 00 00       	call   801711 <_panic>
+
+008002a3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8002a3:	55                   	push   %ebp
+  8002a4:	89 e5                	mov    %esp,%ebp
+  8002a6:	57                   	push   %edi
+  8002a7:	56                   	push   %esi
+  8002a8:	53                   	push   %ebx
+  8002a9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002b7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002bc:	89 df                	mov    %ebx,%edi
+  8002be:	89 de                	mov    %ebx,%esi
+  8002c0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002c2:	85 c0                	test   %eax,%eax
+  8002c4:	7f 08                	jg     8002ce <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c9:	5b                   	pop    %ebx
+  8002ca:	5e                   	pop    %esi
+  8002cb:	5f                   	pop    %edi
+  8002cc:	5d                   	pop    %ebp
+  8002cd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002ce:	83 ec 0c             	sub    $0xc,%esp
+  8002d1:	50                   	push   %eax
+  8002d2:	6a 08                	push   $0x8
+  8002d4:	68 8a 26 80 00       	push   $0x80268a
+  8002d9:	6a 23                	push   $0x23
+  8002db:	68 a7 26 80 00       	push   $0x8026a7
+  8002e0:	e8 2c 14 00 00       	call   801711 <_panic>
+
+008002e5 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002e5:	55                   	push   %ebp
+  8002e6:	89 e5                	mov    %esp,%ebp
+  8002e8:	57                   	push   %edi
+  8002e9:	56                   	push   %esi
+  8002ea:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8002fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002fe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800301:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800303:	5b                   	pop    %ebx
+  800304:	5e                   	pop    %esi
+  800305:	5f                   	pop    %edi
+  800306:	5d                   	pop    %ebp
+  800307:	c3                   	ret
+
+00800308 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800308:	55                   	push   %ebp
+  800309:	89 e5                	mov    %esp,%ebp
+  80030b:	57                   	push   %edi
+  80030c:	56                   	push   %esi
+  80030d:	53                   	push   %ebx
+  80030e:	8b 45 18             	mov    0x18(%ebp),%eax
+  800311:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800314:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800319:	77 27                	ja     800342 <sys_page_map_range+0x3a>
+  80031b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800321:	77 1f                	ja     800342 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800323:	c1 e0 0c             	shl    $0xc,%eax
+  800326:	89 c6                	mov    %eax,%esi
+  800328:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  80032a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80032d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800330:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800335:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800338:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80033b:	cd 30                	int    $0x30
+}
+  80033d:	5b                   	pop    %ebx
+  80033e:	5e                   	pop    %esi
+  80033f:	5f                   	pop    %edi
+  800340:	5d                   	pop    %ebp
+  800341:	c3                   	ret
+		return -E_INVAL;
+  800342:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800347:	eb f4                	jmp    80033d <sys_page_map_range+0x35>
+
+00800349 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800349:	55                   	push   %ebp
+  80034a:	89 e5                	mov    %esp,%ebp
+  80034c:	57                   	push   %edi
+  80034d:	56                   	push   %esi
+  80034e:	53                   	push   %ebx
+  80034f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800352:	8b 55 08             	mov    0x8(%ebp),%edx
+  800355:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800358:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80035d:	be 00 00 00 00       	mov    $0x0,%esi
+  800362:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800365:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800368:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80036a:	85 c0                	test   %eax,%eax
+  80036c:	7f 08                	jg     800376 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80036e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800371:	5b                   	pop    %ebx
+  800372:	5e                   	pop    %esi
+  800373:	5f                   	pop    %edi
+  800374:	5d                   	pop    %ebp
+  800375:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800376:	83 ec 0c             	sub    $0xc,%esp
+  800379:	50                   	push   %eax
+  80037a:	6a 0c                	push   $0xc
+  80037c:	68 8a 26 80 00       	push   $0x80268a
+  800381:	6a 23                	push   $0x23
+  800383:	68 a7 26 80 00       	push   $0x8026a7
+  800388:	e8 84 13 00 00       	call   801711 <_panic>
+
+0080038d <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  80038d:	55                   	push   %ebp
+  80038e:	89 e5                	mov    %esp,%ebp
+  800390:	57                   	push   %edi
+  800391:	56                   	push   %esi
+  800392:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800393:	be 00 00 00 00       	mov    $0x0,%esi
+  800398:	8b 55 08             	mov    0x8(%ebp),%edx
+  80039b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80039e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8003a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003a6:	89 f7                	mov    %esi,%edi
+  8003a8:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003aa:	5b                   	pop    %ebx
+  8003ab:	5e                   	pop    %esi
+  8003ac:	5f                   	pop    %edi
+  8003ad:	5d                   	pop    %ebp
+  8003ae:	c3                   	ret
+
+008003af <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003af:	55                   	push   %ebp
+  8003b0:	89 e5                	mov    %esp,%ebp
+  8003b2:	57                   	push   %edi
+  8003b3:	56                   	push   %esi
+  8003b4:	53                   	push   %ebx
+  8003b5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003c8:	89 df                	mov    %ebx,%edi
+  8003ca:	89 de                	mov    %ebx,%esi
+  8003cc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003ce:	85 c0                	test   %eax,%eax
+  8003d0:	7f 08                	jg     8003da <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d5:	5b                   	pop    %ebx
+  8003d6:	5e                   	pop    %esi
+  8003d7:	5f                   	pop    %edi
+  8003d8:	5d                   	pop    %ebp
+  8003d9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003da:	83 ec 0c             	sub    $0xc,%esp
+  8003dd:	50                   	push   %eax
+  8003de:	6a 0f                	push   $0xf
+  8003e0:	68 8a 26 80 00       	push   $0x80268a
+  8003e5:	6a 23                	push   $0x23
+  8003e7:	68 a7 26 80 00       	push   $0x8026a7
+  8003ec:	e8 20 13 00 00       	call   801711 <_panic>
+
+008003f1 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8003f1:	55                   	push   %ebp
+  8003f2:	89 e5                	mov    %esp,%ebp
+  8003f4:	57                   	push   %edi
+  8003f5:	56                   	push   %esi
+  8003f6:	53                   	push   %ebx
+  8003f7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800402:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800405:	b8 10 00 00 00       	mov    $0x10,%eax
+  80040a:	89 df                	mov    %ebx,%edi
+  80040c:	89 de                	mov    %ebx,%esi
+  80040e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800410:	85 c0                	test   %eax,%eax
+  800412:	7f 08                	jg     80041c <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800414:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800417:	5b                   	pop    %ebx
+  800418:	5e                   	pop    %esi
+  800419:	5f                   	pop    %edi
+  80041a:	5d                   	pop    %ebp
+  80041b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80041c:	83 ec 0c             	sub    $0xc,%esp
+  80041f:	50                   	push   %eax
+  800420:	6a 10                	push   $0x10
+  800422:	68 8a 26 80 00       	push   $0x80268a
+  800427:	6a 23                	push   $0x23
+  800429:	68 a7 26 80 00       	push   $0x8026a7
+  80042e:	e8 de 12 00 00       	call   801711 <_panic>
+
+00800433 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	57                   	push   %edi
+  800437:	56                   	push   %esi
+  800438:	53                   	push   %ebx
+  800439:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80043c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800441:	8b 55 08             	mov    0x8(%ebp),%edx
+  800444:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800447:	b8 11 00 00 00       	mov    $0x11,%eax
+  80044c:	89 df                	mov    %ebx,%edi
+  80044e:	89 de                	mov    %ebx,%esi
+  800450:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800452:	85 c0                	test   %eax,%eax
+  800454:	7f 08                	jg     80045e <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800456:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800459:	5b                   	pop    %ebx
+  80045a:	5e                   	pop    %esi
+  80045b:	5f                   	pop    %edi
+  80045c:	5d                   	pop    %ebp
+  80045d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80045e:	83 ec 0c             	sub    $0xc,%esp
+  800461:	50                   	push   %eax
+  800462:	6a 11                	push   $0x11
+  800464:	68 8a 26 80 00       	push   $0x80268a
+  800469:	6a 23                	push   $0x23
+  80046b:	68 a7 26 80 00       	push   $0x8026a7
+  800470:	e8 9c 12 00 00       	call   801711 <_panic>
+
+00800475 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800475:	55                   	push   %ebp
+  800476:	89 e5                	mov    %esp,%ebp
+  800478:	57                   	push   %edi
+  800479:	56                   	push   %esi
+  80047a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80047b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800480:	b8 12 00 00 00       	mov    $0x12,%eax
+  800485:	89 d1                	mov    %edx,%ecx
+  800487:	89 d3                	mov    %edx,%ebx
+  800489:	89 d7                	mov    %edx,%edi
+  80048b:	89 d6                	mov    %edx,%esi
+  80048d:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  80048f:	5b                   	pop    %ebx
+  800490:	5e                   	pop    %esi
+  800491:	5f                   	pop    %edi
+  800492:	5d                   	pop    %ebp
+  800493:	c3                   	ret
+
+00800494 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800494:	55                   	push   %ebp
+  800495:	89 e5                	mov    %esp,%ebp
+  800497:	57                   	push   %edi
+  800498:	56                   	push   %esi
+  800499:	53                   	push   %ebx
+  80049a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80049d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004ad:	89 df                	mov    %ebx,%edi
+  8004af:	89 de                	mov    %ebx,%esi
+  8004b1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004b3:	85 c0                	test   %eax,%eax
+  8004b5:	7f 08                	jg     8004bf <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8004b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004ba:	5b                   	pop    %ebx
+  8004bb:	5e                   	pop    %esi
+  8004bc:	5f                   	pop    %edi
+  8004bd:	5d                   	pop    %ebp
+  8004be:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004bf:	83 ec 0c             	sub    $0xc,%esp
+  8004c2:	50                   	push   %eax
+  8004c3:	6a 13                	push   $0x13
+  8004c5:	68 8a 26 80 00       	push   $0x80268a
+  8004ca:	6a 23                	push   $0x23
+  8004cc:	68 a7 26 80 00       	push   $0x8026a7
+  8004d1:	e8 3b 12 00 00       	call   801711 <_panic>
+
+008004d6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004d6:	55                   	push   %ebp
+  8004d7:	89 e5                	mov    %esp,%ebp
+  8004d9:	57                   	push   %edi
+  8004da:	56                   	push   %esi
+  8004db:	53                   	push   %ebx
+  8004dc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ea:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004ef:	89 df                	mov    %ebx,%edi
+  8004f1:	89 de                	mov    %ebx,%esi
+  8004f3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004f5:	85 c0                	test   %eax,%eax
+  8004f7:	7f 08                	jg     800501 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8004f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004fc:	5b                   	pop    %ebx
+  8004fd:	5e                   	pop    %esi
+  8004fe:	5f                   	pop    %edi
+  8004ff:	5d                   	pop    %ebp
+  800500:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800501:	83 ec 0c             	sub    $0xc,%esp
+  800504:	50                   	push   %eax
+  800505:	6a 14                	push   $0x14
+  800507:	68 8a 26 80 00       	push   $0x80268a
+  80050c:	6a 23                	push   $0x23
+  80050e:	68 a7 26 80 00       	push   $0x8026a7
+  800513:	e8 f9 11 00 00       	call   801711 <_panic>
+
+00800518 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800518:	55                   	push   %ebp
+  800519:	89 e5                	mov    %esp,%ebp
+  80051b:	57                   	push   %edi
+  80051c:	56                   	push   %esi
+  80051d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80051e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800521:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800524:	b8 17 00 00 00       	mov    $0x17,%eax
+  800529:	be 00 00 00 00       	mov    $0x0,%esi
+  80052e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800531:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800534:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800536:	5b                   	pop    %ebx
+  800537:	5e                   	pop    %esi
+  800538:	5f                   	pop    %edi
+  800539:	5d                   	pop    %ebp
+  80053a:	c3                   	ret
+
+0080053b <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80053b:	55                   	push   %ebp
+  80053c:	89 e5                	mov    %esp,%ebp
+  80053e:	57                   	push   %edi
+  80053f:	56                   	push   %esi
+  800540:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800541:	8b 55 08             	mov    0x8(%ebp),%edx
+  800544:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800547:	b8 18 00 00 00       	mov    $0x18,%eax
+  80054c:	be 00 00 00 00       	mov    $0x0,%esi
+  800551:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800554:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800557:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800559:	5b                   	pop    %ebx
+  80055a:	5e                   	pop    %esi
+  80055b:	5f                   	pop    %edi
+  80055c:	5d                   	pop    %ebp
+  80055d:	c3                   	ret
+
+0080055e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80055e:	55                   	push   %ebp
+  80055f:	89 e5                	mov    %esp,%ebp
+  800561:	57                   	push   %edi
+  800562:	56                   	push   %esi
+  800563:	53                   	push   %ebx
+  800564:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800567:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80056c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80056f:	b8 19 00 00 00       	mov    $0x19,%eax
+  800574:	89 cb                	mov    %ecx,%ebx
+  800576:	89 cf                	mov    %ecx,%edi
+  800578:	89 ce                	mov    %ecx,%esi
+  80057a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80057c:	85 c0                	test   %eax,%eax
+  80057e:	7f 08                	jg     800588 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800583:	5b                   	pop    %ebx
+  800584:	5e                   	pop    %esi
+  800585:	5f                   	pop    %edi
+  800586:	5d                   	pop    %ebp
+  800587:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800588:	83 ec 0c             	sub    $0xc,%esp
+  80058b:	50                   	push   %eax
+  80058c:	6a 19                	push   $0x19
+  80058e:	68 8a 26 80 00       	push   $0x80268a
+  800593:	6a 23                	push   $0x23
+  800595:	68 a7 26 80 00       	push   $0x8026a7
+  80059a:	e8 72 11 00 00       	call   801711 <_panic>
+
+0080059f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80059f:	55                   	push   %ebp
+  8005a0:	89 e5                	mov    %esp,%ebp
+  8005a2:	57                   	push   %edi
+  8005a3:	56                   	push   %esi
+  8005a4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005aa:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005af:	89 d1                	mov    %edx,%ecx
+  8005b1:	89 d3                	mov    %edx,%ebx
+  8005b3:	89 d7                	mov    %edx,%edi
+  8005b5:	89 d6                	mov    %edx,%esi
+  8005b7:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8005b9:	5b                   	pop    %ebx
+  8005ba:	5e                   	pop    %esi
+  8005bb:	5f                   	pop    %edi
+  8005bc:	5d                   	pop    %ebp
+  8005bd:	c3                   	ret
+
+008005be <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8005be:	55                   	push   %ebp
+  8005bf:	89 e5                	mov    %esp,%ebp
+  8005c1:	57                   	push   %edi
+  8005c2:	56                   	push   %esi
+  8005c3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005cf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005d4:	89 df                	mov    %ebx,%edi
+  8005d6:	89 de                	mov    %ebx,%esi
+  8005d8:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8005da:	5b                   	pop    %ebx
+  8005db:	5e                   	pop    %esi
+  8005dc:	5f                   	pop    %edi
+  8005dd:	5d                   	pop    %ebp
+  8005de:	c3                   	ret
+
+008005df <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8005df:	55                   	push   %ebp
+  8005e0:	89 e5                	mov    %esp,%ebp
+  8005e2:	57                   	push   %edi
+  8005e3:	56                   	push   %esi
+  8005e4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005f0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005f5:	89 df                	mov    %ebx,%edi
+  8005f7:	89 de                	mov    %ebx,%esi
+  8005f9:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  8005fb:	5b                   	pop    %ebx
+  8005fc:	5e                   	pop    %esi
+  8005fd:	5f                   	pop    %edi
+  8005fe:	5d                   	pop    %ebp
+  8005ff:	c3                   	ret
+
+00800600 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800600:	55                   	push   %ebp
+  800601:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800603:	8b 45 08             	mov    0x8(%ebp),%eax
+  800606:	05 00 00 00 30       	add    $0x30000000,%eax
+  80060b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80060e:	5d                   	pop    %ebp
+  80060f:	c3                   	ret
+
+00800610 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800610:	55                   	push   %ebp
+  800611:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800613:	8b 45 08             	mov    0x8(%ebp),%eax
+  800616:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80061b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800620:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800625:	5d                   	pop    %ebp
+  800626:	c3                   	ret
+
+00800627 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800627:	55                   	push   %ebp
+  800628:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80062a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80062f:	eb 02                	jmp    800633 <fd_alloc+0xc>
+  800631:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800633:	89 c2                	mov    %eax,%edx
+  800635:	c1 ea 16             	shr    $0x16,%edx
+  800638:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80063f:	f6 c2 01             	test   $0x1,%dl
+  800642:	74 2b                	je     80066f <fd_alloc+0x48>
+  800644:	89 c2                	mov    %eax,%edx
+  800646:	c1 ea 0c             	shr    $0xc,%edx
+  800649:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800650:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800656:	f6 c1 01             	test   $0x1,%cl
+  800659:	74 14                	je     80066f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80065b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800661:	75 ce                	jne    800631 <fd_alloc+0xa>
+  800663:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800668:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80066d:	eb 05                	jmp    800674 <fd_alloc+0x4d>
+			return 0;
+  80066f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800674:	8b 55 08             	mov    0x8(%ebp),%edx
+  800677:	89 02                	mov    %eax,(%edx)
+}
+  800679:	89 c8                	mov    %ecx,%eax
+  80067b:	5d                   	pop    %ebp
+  80067c:	c3                   	ret
+
+0080067d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80067d:	55                   	push   %ebp
+  80067e:	89 e5                	mov    %esp,%ebp
+  800680:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800683:	83 f8 1f             	cmp    $0x1f,%eax
+  800686:	77 30                	ja     8006b8 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800688:	c1 e0 0c             	shl    $0xc,%eax
+  80068b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800690:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800696:	f6 c2 01             	test   $0x1,%dl
+  800699:	74 24                	je     8006bf <fd_lookup+0x42>
+  80069b:	89 c2                	mov    %eax,%edx
+  80069d:	c1 ea 0c             	shr    $0xc,%edx
+  8006a0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006a7:	f6 c2 01             	test   $0x1,%dl
+  8006aa:	74 1a                	je     8006c6 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006af:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006b6:	5d                   	pop    %ebp
+  8006b7:	c3                   	ret
+		return -E_INVAL;
+  8006b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006bd:	eb f7                	jmp    8006b6 <fd_lookup+0x39>
+		return -E_INVAL;
+  8006bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c4:	eb f0                	jmp    8006b6 <fd_lookup+0x39>
+  8006c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006cb:	eb e9                	jmp    8006b6 <fd_lookup+0x39>
+
+008006cd <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006cd:	55                   	push   %ebp
+  8006ce:	89 e5                	mov    %esp,%ebp
+  8006d0:	53                   	push   %ebx
+  8006d1:	83 ec 04             	sub    $0x4,%esp
+  8006d4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006dc:	eb 03                	jmp    8006e1 <dev_lookup+0x14>
+  8006de:	83 c0 01             	add    $0x1,%eax
+  8006e1:	8b 1c 85 34 27 80 00 	mov    0x802734(,%eax,4),%ebx
+  8006e8:	85 db                	test   %ebx,%ebx
+  8006ea:	74 0b                	je     8006f7 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8006ec:	39 13                	cmp    %edx,(%ebx)
+  8006ee:	75 ee                	jne    8006de <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8006f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f5:	eb 1f                	jmp    800716 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8006f7:	a1 08 40 80 00       	mov    0x804008,%eax
+  8006fc:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8006ff:	83 ec 04             	sub    $0x4,%esp
+  800702:	52                   	push   %edx
+  800703:	50                   	push   %eax
+  800704:	68 b8 26 80 00       	push   $0x8026b8
+  800709:	e8 de 10 00 00       	call   8017ec <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80070e:	83 c4 10             	add    $0x10,%esp
+  800711:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800716:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800719:	89 1a                	mov    %ebx,(%edx)
+}
+  80071b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80071e:	c9                   	leave
+  80071f:	c3                   	ret
+
+00800720 <fd_close>:
+{
+  800720:	55                   	push   %ebp
+  800721:	89 e5                	mov    %esp,%ebp
+  800723:	57                   	push   %edi
+  800724:	56                   	push   %esi
+  800725:	53                   	push   %ebx
+  800726:	83 ec 24             	sub    $0x24,%esp
+  800729:	8b 75 08             	mov    0x8(%ebp),%esi
+  80072c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80072f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800732:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800733:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800739:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80073c:	50                   	push   %eax
+  80073d:	e8 3b ff ff ff       	call   80067d <fd_lookup>
+  800742:	89 c3                	mov    %eax,%ebx
+  800744:	83 c4 10             	add    $0x10,%esp
+  800747:	85 c0                	test   %eax,%eax
+  800749:	78 05                	js     800750 <fd_close+0x30>
+	    || fd != fd2)
+  80074b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80074e:	74 16                	je     800766 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800750:	89 f8                	mov    %edi,%eax
+  800752:	84 c0                	test   %al,%al
+  800754:	b8 00 00 00 00       	mov    $0x0,%eax
+  800759:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80075c:	89 d8                	mov    %ebx,%eax
+  80075e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800761:	5b                   	pop    %ebx
+  800762:	5e                   	pop    %esi
+  800763:	5f                   	pop    %edi
+  800764:	5d                   	pop    %ebp
+  800765:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800766:	83 ec 08             	sub    $0x8,%esp
+  800769:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80076c:	50                   	push   %eax
+  80076d:	ff 36                	push   (%esi)
+  80076f:	e8 59 ff ff ff       	call   8006cd <dev_lookup>
+  800774:	89 c3                	mov    %eax,%ebx
+  800776:	83 c4 10             	add    $0x10,%esp
+  800779:	85 c0                	test   %eax,%eax
+  80077b:	78 1a                	js     800797 <fd_close+0x77>
+		if (dev->dev_close)
+  80077d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800780:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800783:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800788:	85 c0                	test   %eax,%eax
+  80078a:	74 0b                	je     800797 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80078c:	83 ec 0c             	sub    $0xc,%esp
+  80078f:	56                   	push   %esi
+  800790:	ff d0                	call   *%eax
+  800792:	89 c3                	mov    %eax,%ebx
+  800794:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800797:	83 ec 08             	sub    $0x8,%esp
+  80079a:	56                   	push   %esi
+  80079b:	6a 00                	push   $0x0
+  80079d:	e8 01 fb ff ff       	call   8002a3 <sys_page_unmap>
+	return r;
+  8007a2:	83 c4 10             	add    $0x10,%esp
+  8007a5:	eb b5                	jmp    80075c <fd_close+0x3c>
+
+008007a7 <close>:
+
+int
+close(int fdnum)
+{
+  8007a7:	55                   	push   %ebp
+  8007a8:	89 e5                	mov    %esp,%ebp
+  8007aa:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007b0:	50                   	push   %eax
+  8007b1:	ff 75 08             	push   0x8(%ebp)
+  8007b4:	e8 c4 fe ff ff       	call   80067d <fd_lookup>
+  8007b9:	83 c4 10             	add    $0x10,%esp
+  8007bc:	85 c0                	test   %eax,%eax
+  8007be:	79 02                	jns    8007c2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007c0:	c9                   	leave
+  8007c1:	c3                   	ret
+		return fd_close(fd, 1);
+  8007c2:	83 ec 08             	sub    $0x8,%esp
+  8007c5:	6a 01                	push   $0x1
+  8007c7:	ff 75 f4             	push   -0xc(%ebp)
+  8007ca:	e8 51 ff ff ff       	call   800720 <fd_close>
+  8007cf:	83 c4 10             	add    $0x10,%esp
+  8007d2:	eb ec                	jmp    8007c0 <close+0x19>
+
+008007d4 <close_all>:
+
+void
+close_all(void)
+{
+  8007d4:	55                   	push   %ebp
+  8007d5:	89 e5                	mov    %esp,%ebp
+  8007d7:	53                   	push   %ebx
+  8007d8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8007db:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8007e0:	83 ec 0c             	sub    $0xc,%esp
+  8007e3:	53                   	push   %ebx
+  8007e4:	e8 be ff ff ff       	call   8007a7 <close>
+	for (i = 0; i < MAXFD; i++)
+  8007e9:	83 c3 01             	add    $0x1,%ebx
+  8007ec:	83 c4 10             	add    $0x10,%esp
+  8007ef:	83 fb 20             	cmp    $0x20,%ebx
+  8007f2:	75 ec                	jne    8007e0 <close_all+0xc>
+}
+  8007f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f7:	c9                   	leave
+  8007f8:	c3                   	ret
+
+008007f9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8007f9:	55                   	push   %ebp
+  8007fa:	89 e5                	mov    %esp,%ebp
+  8007fc:	57                   	push   %edi
+  8007fd:	56                   	push   %esi
+  8007fe:	53                   	push   %ebx
+  8007ff:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800802:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800805:	50                   	push   %eax
+  800806:	ff 75 08             	push   0x8(%ebp)
+  800809:	e8 6f fe ff ff       	call   80067d <fd_lookup>
+  80080e:	89 c3                	mov    %eax,%ebx
+  800810:	83 c4 10             	add    $0x10,%esp
+  800813:	85 c0                	test   %eax,%eax
+  800815:	78 7f                	js     800896 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800817:	83 ec 0c             	sub    $0xc,%esp
+  80081a:	ff 75 0c             	push   0xc(%ebp)
+  80081d:	e8 85 ff ff ff       	call   8007a7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800822:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800825:	c1 e6 0c             	shl    $0xc,%esi
+  800828:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80082e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800831:	89 3c 24             	mov    %edi,(%esp)
+  800834:	e8 d7 fd ff ff       	call   800610 <fd2data>
+  800839:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80083b:	89 34 24             	mov    %esi,(%esp)
+  80083e:	e8 cd fd ff ff       	call   800610 <fd2data>
+  800843:	83 c4 10             	add    $0x10,%esp
+  800846:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800849:	89 d8                	mov    %ebx,%eax
+  80084b:	c1 e8 16             	shr    $0x16,%eax
+  80084e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800855:	a8 01                	test   $0x1,%al
+  800857:	74 11                	je     80086a <dup+0x71>
+  800859:	89 d8                	mov    %ebx,%eax
+  80085b:	c1 e8 0c             	shr    $0xc,%eax
+  80085e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800865:	f6 c2 01             	test   $0x1,%dl
+  800868:	75 36                	jne    8008a0 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80086a:	89 f8                	mov    %edi,%eax
+  80086c:	c1 e8 0c             	shr    $0xc,%eax
+  80086f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800876:	83 ec 0c             	sub    $0xc,%esp
+  800879:	25 07 0e 00 00       	and    $0xe07,%eax
+  80087e:	50                   	push   %eax
+  80087f:	56                   	push   %esi
+  800880:	6a 00                	push   $0x0
+  800882:	57                   	push   %edi
+  800883:	6a 00                	push   $0x0
+  800885:	e8 d7 f9 ff ff       	call   800261 <sys_page_map>
+  80088a:	89 c3                	mov    %eax,%ebx
+  80088c:	83 c4 20             	add    $0x20,%esp
+  80088f:	85 c0                	test   %eax,%eax
+  800891:	78 33                	js     8008c6 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800893:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800896:	89 d8                	mov    %ebx,%eax
+  800898:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80089b:	5b                   	pop    %ebx
+  80089c:	5e                   	pop    %esi
+  80089d:	5f                   	pop    %edi
+  80089e:	5d                   	pop    %ebp
+  80089f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008a0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008a7:	83 ec 0c             	sub    $0xc,%esp
+  8008aa:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008af:	50                   	push   %eax
+  8008b0:	ff 75 d4             	push   -0x2c(%ebp)
+  8008b3:	6a 00                	push   $0x0
+  8008b5:	53                   	push   %ebx
+  8008b6:	6a 00                	push   $0x0
+  8008b8:	e8 a4 f9 ff ff       	call   800261 <sys_page_map>
+  8008bd:	89 c3                	mov    %eax,%ebx
+  8008bf:	83 c4 20             	add    $0x20,%esp
+  8008c2:	85 c0                	test   %eax,%eax
+  8008c4:	79 a4                	jns    80086a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008c6:	83 ec 08             	sub    $0x8,%esp
+  8008c9:	56                   	push   %esi
+  8008ca:	6a 00                	push   $0x0
+  8008cc:	e8 d2 f9 ff ff       	call   8002a3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008d1:	83 c4 08             	add    $0x8,%esp
+  8008d4:	ff 75 d4             	push   -0x2c(%ebp)
+  8008d7:	6a 00                	push   $0x0
+  8008d9:	e8 c5 f9 ff ff       	call   8002a3 <sys_page_unmap>
+	return r;
+  8008de:	83 c4 10             	add    $0x10,%esp
+  8008e1:	eb b3                	jmp    800896 <dup+0x9d>
+
+008008e3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8008e3:	55                   	push   %ebp
+  8008e4:	89 e5                	mov    %esp,%ebp
+  8008e6:	56                   	push   %esi
+  8008e7:	53                   	push   %ebx
+  8008e8:	83 ec 18             	sub    $0x18,%esp
+  8008eb:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8008f1:	50                   	push   %eax
+  8008f2:	56                   	push   %esi
+  8008f3:	e8 85 fd ff ff       	call   80067d <fd_lookup>
+  8008f8:	83 c4 10             	add    $0x10,%esp
+  8008fb:	85 c0                	test   %eax,%eax
+  8008fd:	78 3c                	js     80093b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008ff:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800902:	83 ec 08             	sub    $0x8,%esp
+  800905:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800908:	50                   	push   %eax
+  800909:	ff 33                	push   (%ebx)
+  80090b:	e8 bd fd ff ff       	call   8006cd <dev_lookup>
+  800910:	83 c4 10             	add    $0x10,%esp
+  800913:	85 c0                	test   %eax,%eax
+  800915:	78 24                	js     80093b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800917:	8b 43 08             	mov    0x8(%ebx),%eax
+  80091a:	83 e0 03             	and    $0x3,%eax
+  80091d:	83 f8 01             	cmp    $0x1,%eax
+  800920:	74 20                	je     800942 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800922:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800925:	8b 40 08             	mov    0x8(%eax),%eax
+  800928:	85 c0                	test   %eax,%eax
+  80092a:	74 37                	je     800963 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80092c:	83 ec 04             	sub    $0x4,%esp
+  80092f:	ff 75 10             	push   0x10(%ebp)
+  800932:	ff 75 0c             	push   0xc(%ebp)
+  800935:	53                   	push   %ebx
+  800936:	ff d0                	call   *%eax
+  800938:	83 c4 10             	add    $0x10,%esp
+}
+  80093b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80093e:	5b                   	pop    %ebx
+  80093f:	5e                   	pop    %esi
+  800940:	5d                   	pop    %ebp
+  800941:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800942:	a1 08 40 80 00       	mov    0x804008,%eax
+  800947:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80094a:	83 ec 04             	sub    $0x4,%esp
+  80094d:	56                   	push   %esi
+  80094e:	50                   	push   %eax
+  80094f:	68 f9 26 80 00       	push   $0x8026f9
+  800954:	e8 93 0e 00 00       	call   8017ec <cprintf>
+		return -E_INVAL;
+  800959:	83 c4 10             	add    $0x10,%esp
+  80095c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800961:	eb d8                	jmp    80093b <read+0x58>
+		return -E_NOT_SUPP;
+  800963:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800968:	eb d1                	jmp    80093b <read+0x58>
+
+0080096a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80096a:	55                   	push   %ebp
+  80096b:	89 e5                	mov    %esp,%ebp
+  80096d:	57                   	push   %edi
+  80096e:	56                   	push   %esi
+  80096f:	53                   	push   %ebx
+  800970:	83 ec 0c             	sub    $0xc,%esp
+  800973:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800976:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800979:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80097e:	eb 02                	jmp    800982 <readn+0x18>
+  800980:	01 c3                	add    %eax,%ebx
+  800982:	39 f3                	cmp    %esi,%ebx
+  800984:	73 21                	jae    8009a7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800986:	83 ec 04             	sub    $0x4,%esp
+  800989:	89 f0                	mov    %esi,%eax
+  80098b:	29 d8                	sub    %ebx,%eax
+  80098d:	50                   	push   %eax
+  80098e:	89 d8                	mov    %ebx,%eax
+  800990:	03 45 0c             	add    0xc(%ebp),%eax
+  800993:	50                   	push   %eax
+  800994:	57                   	push   %edi
+  800995:	e8 49 ff ff ff       	call   8008e3 <read>
+		if (m < 0)
+  80099a:	83 c4 10             	add    $0x10,%esp
+  80099d:	85 c0                	test   %eax,%eax
+  80099f:	78 04                	js     8009a5 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8009a1:	75 dd                	jne    800980 <readn+0x16>
+  8009a3:	eb 02                	jmp    8009a7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009a5:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8009a7:	89 d8                	mov    %ebx,%eax
+  8009a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009ac:	5b                   	pop    %ebx
+  8009ad:	5e                   	pop    %esi
+  8009ae:	5f                   	pop    %edi
+  8009af:	5d                   	pop    %ebp
+  8009b0:	c3                   	ret
+
+008009b1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	56                   	push   %esi
+  8009b5:	53                   	push   %ebx
+  8009b6:	83 ec 18             	sub    $0x18,%esp
+  8009b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009bc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009bf:	50                   	push   %eax
+  8009c0:	53                   	push   %ebx
+  8009c1:	e8 b7 fc ff ff       	call   80067d <fd_lookup>
+  8009c6:	83 c4 10             	add    $0x10,%esp
+  8009c9:	85 c0                	test   %eax,%eax
+  8009cb:	78 37                	js     800a04 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009cd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009d0:	83 ec 08             	sub    $0x8,%esp
+  8009d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009d6:	50                   	push   %eax
+  8009d7:	ff 36                	push   (%esi)
+  8009d9:	e8 ef fc ff ff       	call   8006cd <dev_lookup>
+  8009de:	83 c4 10             	add    $0x10,%esp
+  8009e1:	85 c0                	test   %eax,%eax
+  8009e3:	78 1f                	js     800a04 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8009e5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8009e9:	74 20                	je     800a0b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8009eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009ee:	8b 40 0c             	mov    0xc(%eax),%eax
+  8009f1:	85 c0                	test   %eax,%eax
+  8009f3:	74 37                	je     800a2c <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8009f5:	83 ec 04             	sub    $0x4,%esp
+  8009f8:	ff 75 10             	push   0x10(%ebp)
+  8009fb:	ff 75 0c             	push   0xc(%ebp)
+  8009fe:	56                   	push   %esi
+  8009ff:	ff d0                	call   *%eax
+  800a01:	83 c4 10             	add    $0x10,%esp
+}
+  800a04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a07:	5b                   	pop    %ebx
+  800a08:	5e                   	pop    %esi
+  800a09:	5d                   	pop    %ebp
+  800a0a:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a0b:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a10:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800a13:	83 ec 04             	sub    $0x4,%esp
+  800a16:	53                   	push   %ebx
+  800a17:	50                   	push   %eax
+  800a18:	68 15 27 80 00       	push   $0x802715
+  800a1d:	e8 ca 0d 00 00       	call   8017ec <cprintf>
+		return -E_INVAL;
+  800a22:	83 c4 10             	add    $0x10,%esp
+  800a25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a2a:	eb d8                	jmp    800a04 <write+0x53>
+		return -E_NOT_SUPP;
+  800a2c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a31:	eb d1                	jmp    800a04 <write+0x53>
+
+00800a33 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a33:	55                   	push   %ebp
+  800a34:	89 e5                	mov    %esp,%ebp
+  800a36:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a3c:	50                   	push   %eax
+  800a3d:	ff 75 08             	push   0x8(%ebp)
+  800a40:	e8 38 fc ff ff       	call   80067d <fd_lookup>
+  800a45:	83 c4 10             	add    $0x10,%esp
+  800a48:	85 c0                	test   %eax,%eax
+  800a4a:	78 0e                	js     800a5a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800a4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a52:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800a55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a5a:	c9                   	leave
+  800a5b:	c3                   	ret
+
+00800a5c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a5c:	55                   	push   %ebp
+  800a5d:	89 e5                	mov    %esp,%ebp
+  800a5f:	56                   	push   %esi
+  800a60:	53                   	push   %ebx
+  800a61:	83 ec 18             	sub    $0x18,%esp
+  800a64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a67:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a6a:	50                   	push   %eax
+  800a6b:	53                   	push   %ebx
+  800a6c:	e8 0c fc ff ff       	call   80067d <fd_lookup>
+  800a71:	83 c4 10             	add    $0x10,%esp
+  800a74:	85 c0                	test   %eax,%eax
+  800a76:	78 34                	js     800aac <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a78:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a7b:	83 ec 08             	sub    $0x8,%esp
+  800a7e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a81:	50                   	push   %eax
+  800a82:	ff 36                	push   (%esi)
+  800a84:	e8 44 fc ff ff       	call   8006cd <dev_lookup>
+  800a89:	83 c4 10             	add    $0x10,%esp
+  800a8c:	85 c0                	test   %eax,%eax
+  800a8e:	78 1c                	js     800aac <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a90:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a94:	74 1d                	je     800ab3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800a96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a99:	8b 40 18             	mov    0x18(%eax),%eax
+  800a9c:	85 c0                	test   %eax,%eax
+  800a9e:	74 34                	je     800ad4 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800aa0:	83 ec 08             	sub    $0x8,%esp
+  800aa3:	ff 75 0c             	push   0xc(%ebp)
+  800aa6:	56                   	push   %esi
+  800aa7:	ff d0                	call   *%eax
+  800aa9:	83 c4 10             	add    $0x10,%esp
+}
+  800aac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aaf:	5b                   	pop    %ebx
+  800ab0:	5e                   	pop    %esi
+  800ab1:	5d                   	pop    %ebp
+  800ab2:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800ab3:	a1 08 40 80 00       	mov    0x804008,%eax
+  800ab8:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800abb:	83 ec 04             	sub    $0x4,%esp
+  800abe:	53                   	push   %ebx
+  800abf:	50                   	push   %eax
+  800ac0:	68 d8 26 80 00       	push   $0x8026d8
+  800ac5:	e8 22 0d 00 00       	call   8017ec <cprintf>
+		return -E_INVAL;
+  800aca:	83 c4 10             	add    $0x10,%esp
+  800acd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad2:	eb d8                	jmp    800aac <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800ad4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ad9:	eb d1                	jmp    800aac <ftruncate+0x50>
+
+00800adb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800adb:	55                   	push   %ebp
+  800adc:	89 e5                	mov    %esp,%ebp
+  800ade:	56                   	push   %esi
+  800adf:	53                   	push   %ebx
+  800ae0:	83 ec 18             	sub    $0x18,%esp
+  800ae3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ae6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ae9:	50                   	push   %eax
+  800aea:	ff 75 08             	push   0x8(%ebp)
+  800aed:	e8 8b fb ff ff       	call   80067d <fd_lookup>
+  800af2:	83 c4 10             	add    $0x10,%esp
+  800af5:	85 c0                	test   %eax,%eax
+  800af7:	78 49                	js     800b42 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800af9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800afc:	83 ec 08             	sub    $0x8,%esp
+  800aff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b02:	50                   	push   %eax
+  800b03:	ff 36                	push   (%esi)
+  800b05:	e8 c3 fb ff ff       	call   8006cd <dev_lookup>
+  800b0a:	83 c4 10             	add    $0x10,%esp
+  800b0d:	85 c0                	test   %eax,%eax
+  800b0f:	78 31                	js     800b42 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b14:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b18:	74 2f                	je     800b49 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b1a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b1d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b24:	00 00 00 
+	stat->st_isdir = 0;
+  800b27:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b2e:	00 00 00 
+	stat->st_dev = dev;
+  800b31:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b37:	83 ec 08             	sub    $0x8,%esp
+  800b3a:	53                   	push   %ebx
+  800b3b:	56                   	push   %esi
+  800b3c:	ff 50 14             	call   *0x14(%eax)
+  800b3f:	83 c4 10             	add    $0x10,%esp
+}
+  800b42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b45:	5b                   	pop    %ebx
+  800b46:	5e                   	pop    %esi
+  800b47:	5d                   	pop    %ebp
+  800b48:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b49:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b4e:	eb f2                	jmp    800b42 <fstat+0x67>
+
+00800b50 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b50:	55                   	push   %ebp
+  800b51:	89 e5                	mov    %esp,%ebp
+  800b53:	56                   	push   %esi
+  800b54:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800b55:	83 ec 08             	sub    $0x8,%esp
+  800b58:	6a 00                	push   $0x0
+  800b5a:	ff 75 08             	push   0x8(%ebp)
+  800b5d:	e8 e4 01 00 00       	call   800d46 <open>
+  800b62:	89 c3                	mov    %eax,%ebx
+  800b64:	83 c4 10             	add    $0x10,%esp
+  800b67:	85 c0                	test   %eax,%eax
+  800b69:	78 1b                	js     800b86 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800b6b:	83 ec 08             	sub    $0x8,%esp
+  800b6e:	ff 75 0c             	push   0xc(%ebp)
+  800b71:	50                   	push   %eax
+  800b72:	e8 64 ff ff ff       	call   800adb <fstat>
+  800b77:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b79:	89 1c 24             	mov    %ebx,(%esp)
+  800b7c:	e8 26 fc ff ff       	call   8007a7 <close>
+	return r;
+  800b81:	83 c4 10             	add    $0x10,%esp
+  800b84:	89 f3                	mov    %esi,%ebx
+}
+  800b86:	89 d8                	mov    %ebx,%eax
+  800b88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b8b:	5b                   	pop    %ebx
+  800b8c:	5e                   	pop    %esi
+  800b8d:	5d                   	pop    %ebp
+  800b8e:	c3                   	ret
+
+00800b8f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800b8f:	55                   	push   %ebp
+  800b90:	89 e5                	mov    %esp,%ebp
+  800b92:	56                   	push   %esi
+  800b93:	53                   	push   %ebx
+  800b94:	89 c6                	mov    %eax,%esi
+  800b96:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800b98:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800b9f:	74 27                	je     800bc8 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ba1:	6a 07                	push   $0x7
+  800ba3:	68 00 50 80 00       	push   $0x805000
+  800ba8:	56                   	push   %esi
+  800ba9:	ff 35 00 40 80 00    	push   0x804000
+  800baf:	e8 ce 15 00 00       	call   802182 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800bb4:	83 c4 0c             	add    $0xc,%esp
+  800bb7:	6a 00                	push   $0x0
+  800bb9:	53                   	push   %ebx
+  800bba:	6a 00                	push   $0x0
+  800bbc:	e8 49 15 00 00       	call   80210a <ipc_recv>
+}
+  800bc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bc4:	5b                   	pop    %ebx
+  800bc5:	5e                   	pop    %esi
+  800bc6:	5d                   	pop    %ebp
+  800bc7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bc8:	83 ec 0c             	sub    $0xc,%esp
+  800bcb:	6a 01                	push   $0x1
+  800bcd:	e8 04 16 00 00       	call   8021d6 <ipc_find_env>
+  800bd2:	a3 00 40 80 00       	mov    %eax,0x804000
+  800bd7:	83 c4 10             	add    $0x10,%esp
+  800bda:	eb c5                	jmp    800ba1 <fsipc+0x12>
+
+00800bdc <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800bdc:	55                   	push   %ebp
+  800bdd:	89 e5                	mov    %esp,%ebp
+  800bdf:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800be2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be5:	8b 40 0c             	mov    0xc(%eax),%eax
+  800be8:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800bed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bf0:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800bf5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfa:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bff:	e8 8b ff ff ff       	call   800b8f <fsipc>
+}
+  800c04:	c9                   	leave
+  800c05:	c3                   	ret
+
+00800c06 <devfile_flush>:
+{
+  800c06:	55                   	push   %ebp
+  800c07:	89 e5                	mov    %esp,%ebp
+  800c09:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800c0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c12:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800c17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c21:	e8 69 ff ff ff       	call   800b8f <fsipc>
+}
+  800c26:	c9                   	leave
+  800c27:	c3                   	ret
+
+00800c28 <devfile_stat>:
+{
+  800c28:	55                   	push   %ebp
+  800c29:	89 e5                	mov    %esp,%ebp
+  800c2b:	53                   	push   %ebx
+  800c2c:	83 ec 04             	sub    $0x4,%esp
+  800c2f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800c32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c35:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c38:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800c3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c42:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c47:	e8 43 ff ff ff       	call   800b8f <fsipc>
+  800c4c:	85 c0                	test   %eax,%eax
+  800c4e:	78 2c                	js     800c7c <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800c50:	83 ec 08             	sub    $0x8,%esp
+  800c53:	68 00 50 80 00       	push   $0x805000
+  800c58:	53                   	push   %ebx
+  800c59:	e8 7c 11 00 00       	call   801dda <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800c5e:	a1 80 50 80 00       	mov    0x805080,%eax
+  800c63:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800c69:	a1 84 50 80 00       	mov    0x805084,%eax
+  800c6e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800c74:	83 c4 10             	add    $0x10,%esp
+  800c77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c7f:	c9                   	leave
+  800c80:	c3                   	ret
+
+00800c81 <devfile_write>:
+{
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	83 ec 0c             	sub    $0xc,%esp
+  800c87:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800c8a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800c8f:	39 d0                	cmp    %edx,%eax
+  800c91:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800c94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c97:	8b 52 0c             	mov    0xc(%edx),%edx
+  800c9a:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800ca0:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800ca5:	50                   	push   %eax
+  800ca6:	ff 75 0c             	push   0xc(%ebp)
+  800ca9:	68 08 50 80 00       	push   $0x805008
+  800cae:	e8 ad 12 00 00       	call   801f60 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800cb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cbd:	e8 cd fe ff ff       	call   800b8f <fsipc>
+}
+  800cc2:	c9                   	leave
+  800cc3:	c3                   	ret
+
+00800cc4 <devfile_read>:
+{
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	56                   	push   %esi
+  800cc8:	53                   	push   %ebx
+  800cc9:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ccc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ccf:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cd2:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800cd7:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ce7:	e8 a3 fe ff ff       	call   800b8f <fsipc>
+  800cec:	89 c3                	mov    %eax,%ebx
+  800cee:	85 c0                	test   %eax,%eax
+  800cf0:	78 1f                	js     800d11 <devfile_read+0x4d>
+	assert(r <= n);
+  800cf2:	39 c6                	cmp    %eax,%esi
+  800cf4:	72 24                	jb     800d1a <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  800cf6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800cfb:	7f 33                	jg     800d30 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800cfd:	83 ec 04             	sub    $0x4,%esp
+  800d00:	50                   	push   %eax
+  800d01:	68 00 50 80 00       	push   $0x805000
+  800d06:	ff 75 0c             	push   0xc(%ebp)
+  800d09:	e8 52 12 00 00       	call   801f60 <memmove>
+	return r;
+  800d0e:	83 c4 10             	add    $0x10,%esp
+}
+  800d11:	89 d8                	mov    %ebx,%eax
+  800d13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d16:	5b                   	pop    %ebx
+  800d17:	5e                   	pop    %esi
+  800d18:	5d                   	pop    %ebp
+  800d19:	c3                   	ret
+	assert(r <= n);
+  800d1a:	68 48 27 80 00       	push   $0x802748
+  800d1f:	68 4f 27 80 00       	push   $0x80274f
+  800d24:	6a 7c                	push   $0x7c
+  800d26:	68 64 27 80 00       	push   $0x802764
+  800d2b:	e8 e1 09 00 00       	call   801711 <_panic>
+	assert(r <= PGSIZE);
+  800d30:	68 6f 27 80 00       	push   $0x80276f
+  800d35:	68 4f 27 80 00       	push   $0x80274f
+  800d3a:	6a 7d                	push   $0x7d
+  800d3c:	68 64 27 80 00       	push   $0x802764
+  800d41:	e8 cb 09 00 00       	call   801711 <_panic>
+
+00800d46 <open>:
+{
+  800d46:	55                   	push   %ebp
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	56                   	push   %esi
+  800d4a:	53                   	push   %ebx
+  800d4b:	83 ec 1c             	sub    $0x1c,%esp
+  800d4e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800d51:	56                   	push   %esi
+  800d52:	e8 48 10 00 00       	call   801d9f <strlen>
+  800d57:	83 c4 10             	add    $0x10,%esp
+  800d5a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800d5f:	7f 6c                	jg     800dcd <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800d61:	83 ec 0c             	sub    $0xc,%esp
+  800d64:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d67:	50                   	push   %eax
+  800d68:	e8 ba f8 ff ff       	call   800627 <fd_alloc>
+  800d6d:	89 c3                	mov    %eax,%ebx
+  800d6f:	83 c4 10             	add    $0x10,%esp
+  800d72:	85 c0                	test   %eax,%eax
+  800d74:	78 3c                	js     800db2 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800d76:	83 ec 08             	sub    $0x8,%esp
+  800d79:	56                   	push   %esi
+  800d7a:	68 00 50 80 00       	push   $0x805000
+  800d7f:	e8 56 10 00 00       	call   801dda <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800d84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d87:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800d8c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800d8f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d94:	e8 f6 fd ff ff       	call   800b8f <fsipc>
+  800d99:	89 c3                	mov    %eax,%ebx
+  800d9b:	83 c4 10             	add    $0x10,%esp
+  800d9e:	85 c0                	test   %eax,%eax
+  800da0:	78 19                	js     800dbb <open+0x75>
+	return fd2num(fd);
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+  800da5:	ff 75 f4             	push   -0xc(%ebp)
+  800da8:	e8 53 f8 ff ff       	call   800600 <fd2num>
+  800dad:	89 c3                	mov    %eax,%ebx
+  800daf:	83 c4 10             	add    $0x10,%esp
+}
+  800db2:	89 d8                	mov    %ebx,%eax
+  800db4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800db7:	5b                   	pop    %ebx
+  800db8:	5e                   	pop    %esi
+  800db9:	5d                   	pop    %ebp
+  800dba:	c3                   	ret
+		fd_close(fd, 0);
+  800dbb:	83 ec 08             	sub    $0x8,%esp
+  800dbe:	6a 00                	push   $0x0
+  800dc0:	ff 75 f4             	push   -0xc(%ebp)
+  800dc3:	e8 58 f9 ff ff       	call   800720 <fd_close>
+		return r;
+  800dc8:	83 c4 10             	add    $0x10,%esp
+  800dcb:	eb e5                	jmp    800db2 <open+0x6c>
+		return -E_BAD_PATH;
+  800dcd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800dd2:	eb de                	jmp    800db2 <open+0x6c>
+
+00800dd4 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800dd4:	55                   	push   %ebp
+  800dd5:	89 e5                	mov    %esp,%ebp
+  800dd7:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800dda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ddf:	b8 08 00 00 00       	mov    $0x8,%eax
+  800de4:	e8 a6 fd ff ff       	call   800b8f <fsipc>
+}
+  800de9:	c9                   	leave
+  800dea:	c3                   	ret
+
+00800deb <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+  800dee:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800df1:	68 7b 27 80 00       	push   $0x80277b
+  800df6:	ff 75 0c             	push   0xc(%ebp)
+  800df9:	e8 dc 0f 00 00       	call   801dda <strcpy>
+	return 0;
+}
+  800dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e03:	c9                   	leave
+  800e04:	c3                   	ret
+
+00800e05 <devsock_close>:
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	53                   	push   %ebx
+  800e09:	83 ec 10             	sub    $0x10,%esp
+  800e0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800e0f:	53                   	push   %ebx
+  800e10:	e8 d1 13 00 00       	call   8021e6 <pageref>
+  800e15:	89 c2                	mov    %eax,%edx
+  800e17:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800e1f:	83 fa 01             	cmp    $0x1,%edx
+  800e22:	74 05                	je     800e29 <devsock_close+0x24>
+}
+  800e24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e27:	c9                   	leave
+  800e28:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+  800e2c:	ff 73 0c             	push   0xc(%ebx)
+  800e2f:	e8 b7 02 00 00       	call   8010eb <nsipc_close>
+  800e34:	83 c4 10             	add    $0x10,%esp
+  800e37:	eb eb                	jmp    800e24 <devsock_close+0x1f>
+
+00800e39 <devsock_write>:
+{
+  800e39:	55                   	push   %ebp
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800e3f:	6a 00                	push   $0x0
+  800e41:	ff 75 10             	push   0x10(%ebp)
+  800e44:	ff 75 0c             	push   0xc(%ebp)
+  800e47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e4a:	ff 70 0c             	push   0xc(%eax)
+  800e4d:	e8 79 03 00 00       	call   8011cb <nsipc_send>
+}
+  800e52:	c9                   	leave
+  800e53:	c3                   	ret
+
+00800e54 <devsock_read>:
+{
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800e5a:	6a 00                	push   $0x0
+  800e5c:	ff 75 10             	push   0x10(%ebp)
+  800e5f:	ff 75 0c             	push   0xc(%ebp)
+  800e62:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e65:	ff 70 0c             	push   0xc(%eax)
+  800e68:	e8 ef 02 00 00       	call   80115c <nsipc_recv>
+}
+  800e6d:	c9                   	leave
+  800e6e:	c3                   	ret
+
+00800e6f <fd2sockid>:
+{
+  800e6f:	55                   	push   %ebp
+  800e70:	89 e5                	mov    %esp,%ebp
+  800e72:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800e75:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800e78:	52                   	push   %edx
+  800e79:	50                   	push   %eax
+  800e7a:	e8 fe f7 ff ff       	call   80067d <fd_lookup>
+  800e7f:	83 c4 10             	add    $0x10,%esp
+  800e82:	85 c0                	test   %eax,%eax
+  800e84:	78 10                	js     800e96 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800e86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e89:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800e8f:	39 08                	cmp    %ecx,(%eax)
+  800e91:	75 05                	jne    800e98 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800e93:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800e96:	c9                   	leave
+  800e97:	c3                   	ret
+		return -E_NOT_SUPP;
+  800e98:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e9d:	eb f7                	jmp    800e96 <fd2sockid+0x27>
+
+00800e9f <alloc_sockfd>:
+{
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	56                   	push   %esi
+  800ea3:	53                   	push   %ebx
+  800ea4:	83 ec 1c             	sub    $0x1c,%esp
+  800ea7:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800ea9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800eac:	50                   	push   %eax
+  800ead:	e8 75 f7 ff ff       	call   800627 <fd_alloc>
+  800eb2:	89 c3                	mov    %eax,%ebx
+  800eb4:	83 c4 10             	add    $0x10,%esp
+  800eb7:	85 c0                	test   %eax,%eax
+  800eb9:	78 43                	js     800efe <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800ebb:	83 ec 04             	sub    $0x4,%esp
+  800ebe:	68 07 04 00 00       	push   $0x407
+  800ec3:	ff 75 f4             	push   -0xc(%ebp)
+  800ec6:	6a 00                	push   $0x0
+  800ec8:	e8 0e f3 ff ff       	call   8001db <sys_page_alloc>
+  800ecd:	89 c3                	mov    %eax,%ebx
+  800ecf:	83 c4 10             	add    $0x10,%esp
+  800ed2:	85 c0                	test   %eax,%eax
+  800ed4:	78 28                	js     800efe <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800ed6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ed9:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800edf:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800ee1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ee4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800eeb:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800eee:	83 ec 0c             	sub    $0xc,%esp
+  800ef1:	50                   	push   %eax
+  800ef2:	e8 09 f7 ff ff       	call   800600 <fd2num>
+  800ef7:	89 c3                	mov    %eax,%ebx
+  800ef9:	83 c4 10             	add    $0x10,%esp
+  800efc:	eb 0c                	jmp    800f0a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800efe:	83 ec 0c             	sub    $0xc,%esp
+  800f01:	56                   	push   %esi
+  800f02:	e8 e4 01 00 00       	call   8010eb <nsipc_close>
+		return r;
+  800f07:	83 c4 10             	add    $0x10,%esp
+}
+  800f0a:	89 d8                	mov    %ebx,%eax
+  800f0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f0f:	5b                   	pop    %ebx
+  800f10:	5e                   	pop    %esi
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+
+00800f13 <accept>:
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f1c:	e8 4e ff ff ff       	call   800e6f <fd2sockid>
+  800f21:	85 c0                	test   %eax,%eax
+  800f23:	78 1b                	js     800f40 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800f25:	83 ec 04             	sub    $0x4,%esp
+  800f28:	ff 75 10             	push   0x10(%ebp)
+  800f2b:	ff 75 0c             	push   0xc(%ebp)
+  800f2e:	50                   	push   %eax
+  800f2f:	e8 0e 01 00 00       	call   801042 <nsipc_accept>
+  800f34:	83 c4 10             	add    $0x10,%esp
+  800f37:	85 c0                	test   %eax,%eax
+  800f39:	78 05                	js     800f40 <accept+0x2d>
+	return alloc_sockfd(r);
+  800f3b:	e8 5f ff ff ff       	call   800e9f <alloc_sockfd>
+}
+  800f40:	c9                   	leave
+  800f41:	c3                   	ret
+
+00800f42 <bind>:
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4b:	e8 1f ff ff ff       	call   800e6f <fd2sockid>
+  800f50:	85 c0                	test   %eax,%eax
+  800f52:	78 12                	js     800f66 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800f54:	83 ec 04             	sub    $0x4,%esp
+  800f57:	ff 75 10             	push   0x10(%ebp)
+  800f5a:	ff 75 0c             	push   0xc(%ebp)
+  800f5d:	50                   	push   %eax
+  800f5e:	e8 31 01 00 00       	call   801094 <nsipc_bind>
+  800f63:	83 c4 10             	add    $0x10,%esp
+}
+  800f66:	c9                   	leave
+  800f67:	c3                   	ret
+
+00800f68 <shutdown>:
+{
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+  800f6b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f71:	e8 f9 fe ff ff       	call   800e6f <fd2sockid>
+  800f76:	85 c0                	test   %eax,%eax
+  800f78:	78 0f                	js     800f89 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800f7a:	83 ec 08             	sub    $0x8,%esp
+  800f7d:	ff 75 0c             	push   0xc(%ebp)
+  800f80:	50                   	push   %eax
+  800f81:	e8 43 01 00 00       	call   8010c9 <nsipc_shutdown>
+  800f86:	83 c4 10             	add    $0x10,%esp
+}
+  800f89:	c9                   	leave
+  800f8a:	c3                   	ret
+
+00800f8b <connect>:
+{
+  800f8b:	55                   	push   %ebp
+  800f8c:	89 e5                	mov    %esp,%ebp
+  800f8e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f91:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f94:	e8 d6 fe ff ff       	call   800e6f <fd2sockid>
+  800f99:	85 c0                	test   %eax,%eax
+  800f9b:	78 12                	js     800faf <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800f9d:	83 ec 04             	sub    $0x4,%esp
+  800fa0:	ff 75 10             	push   0x10(%ebp)
+  800fa3:	ff 75 0c             	push   0xc(%ebp)
+  800fa6:	50                   	push   %eax
+  800fa7:	e8 59 01 00 00       	call   801105 <nsipc_connect>
+  800fac:	83 c4 10             	add    $0x10,%esp
+}
+  800faf:	c9                   	leave
+  800fb0:	c3                   	ret
+
+00800fb1 <listen>:
+{
+  800fb1:	55                   	push   %ebp
+  800fb2:	89 e5                	mov    %esp,%ebp
+  800fb4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800fb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fba:	e8 b0 fe ff ff       	call   800e6f <fd2sockid>
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	78 0f                	js     800fd2 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800fc3:	83 ec 08             	sub    $0x8,%esp
+  800fc6:	ff 75 0c             	push   0xc(%ebp)
+  800fc9:	50                   	push   %eax
+  800fca:	e8 6b 01 00 00       	call   80113a <nsipc_listen>
+  800fcf:	83 c4 10             	add    $0x10,%esp
+}
+  800fd2:	c9                   	leave
+  800fd3:	c3                   	ret
+
+00800fd4 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800fd4:	55                   	push   %ebp
+  800fd5:	89 e5                	mov    %esp,%ebp
+  800fd7:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800fda:	ff 75 10             	push   0x10(%ebp)
+  800fdd:	ff 75 0c             	push   0xc(%ebp)
+  800fe0:	ff 75 08             	push   0x8(%ebp)
+  800fe3:	e8 41 02 00 00       	call   801229 <nsipc_socket>
+  800fe8:	83 c4 10             	add    $0x10,%esp
+  800feb:	85 c0                	test   %eax,%eax
+  800fed:	78 05                	js     800ff4 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800fef:	e8 ab fe ff ff       	call   800e9f <alloc_sockfd>
+}
+  800ff4:	c9                   	leave
+  800ff5:	c3                   	ret
+
+00800ff6 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	53                   	push   %ebx
+  800ffa:	83 ec 04             	sub    $0x4,%esp
+  800ffd:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800fff:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801006:	74 26                	je     80102e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801008:	6a 07                	push   $0x7
+  80100a:	68 00 60 80 00       	push   $0x806000
+  80100f:	53                   	push   %ebx
+  801010:	ff 35 04 40 80 00    	push   0x804004
+  801016:	e8 67 11 00 00       	call   802182 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80101b:	83 c4 0c             	add    $0xc,%esp
+  80101e:	6a 00                	push   $0x0
+  801020:	6a 00                	push   $0x0
+  801022:	6a 00                	push   $0x0
+  801024:	e8 e1 10 00 00       	call   80210a <ipc_recv>
+}
+  801029:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80102c:	c9                   	leave
+  80102d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80102e:	83 ec 0c             	sub    $0xc,%esp
+  801031:	6a 02                	push   $0x2
+  801033:	e8 9e 11 00 00       	call   8021d6 <ipc_find_env>
+  801038:	a3 04 40 80 00       	mov    %eax,0x804004
+  80103d:	83 c4 10             	add    $0x10,%esp
+  801040:	eb c6                	jmp    801008 <nsipc+0x12>
+
+00801042 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801042:	55                   	push   %ebp
+  801043:	89 e5                	mov    %esp,%ebp
+  801045:	56                   	push   %esi
+  801046:	53                   	push   %ebx
+  801047:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80104a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80104d:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801052:	8b 06                	mov    (%esi),%eax
+  801054:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801059:	b8 01 00 00 00       	mov    $0x1,%eax
+  80105e:	e8 93 ff ff ff       	call   800ff6 <nsipc>
+  801063:	89 c3                	mov    %eax,%ebx
+  801065:	85 c0                	test   %eax,%eax
+  801067:	79 09                	jns    801072 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801069:	89 d8                	mov    %ebx,%eax
+  80106b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80106e:	5b                   	pop    %ebx
+  80106f:	5e                   	pop    %esi
+  801070:	5d                   	pop    %ebp
+  801071:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801072:	83 ec 04             	sub    $0x4,%esp
+  801075:	ff 35 10 60 80 00    	push   0x806010
+  80107b:	68 00 60 80 00       	push   $0x806000
+  801080:	ff 75 0c             	push   0xc(%ebp)
+  801083:	e8 d8 0e 00 00       	call   801f60 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801088:	a1 10 60 80 00       	mov    0x806010,%eax
+  80108d:	89 06                	mov    %eax,(%esi)
+  80108f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801092:	eb d5                	jmp    801069 <nsipc_accept+0x27>
+
+00801094 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	53                   	push   %ebx
+  801098:	83 ec 08             	sub    $0x8,%esp
+  80109b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80109e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010a1:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8010a6:	53                   	push   %ebx
+  8010a7:	ff 75 0c             	push   0xc(%ebp)
+  8010aa:	68 04 60 80 00       	push   $0x806004
+  8010af:	e8 ac 0e 00 00       	call   801f60 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8010b4:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8010ba:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010bf:	e8 32 ff ff ff       	call   800ff6 <nsipc>
+}
+  8010c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010c7:	c9                   	leave
+  8010c8:	c3                   	ret
+
+008010c9 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8010c9:	55                   	push   %ebp
+  8010ca:	89 e5                	mov    %esp,%ebp
+  8010cc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8010cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010d2:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8010d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010da:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8010df:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010e4:	e8 0d ff ff ff       	call   800ff6 <nsipc>
+}
+  8010e9:	c9                   	leave
+  8010ea:	c3                   	ret
+
+008010eb <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8010eb:	55                   	push   %ebp
+  8010ec:	89 e5                	mov    %esp,%ebp
+  8010ee:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8010f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f4:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  8010f9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010fe:	e8 f3 fe ff ff       	call   800ff6 <nsipc>
+}
+  801103:	c9                   	leave
+  801104:	c3                   	ret
+
+00801105 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	53                   	push   %ebx
+  801109:	83 ec 08             	sub    $0x8,%esp
+  80110c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80110f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801112:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801117:	53                   	push   %ebx
+  801118:	ff 75 0c             	push   0xc(%ebp)
+  80111b:	68 04 60 80 00       	push   $0x806004
+  801120:	e8 3b 0e 00 00       	call   801f60 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801125:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  80112b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801130:	e8 c1 fe ff ff       	call   800ff6 <nsipc>
+}
+  801135:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801138:	c9                   	leave
+  801139:	c3                   	ret
+
+0080113a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801140:	8b 45 08             	mov    0x8(%ebp),%eax
+  801143:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801148:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80114b:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801150:	b8 06 00 00 00       	mov    $0x6,%eax
+  801155:	e8 9c fe ff ff       	call   800ff6 <nsipc>
+}
+  80115a:	c9                   	leave
+  80115b:	c3                   	ret
+
+0080115c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	56                   	push   %esi
+  801160:	53                   	push   %ebx
+  801161:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801164:	8b 45 08             	mov    0x8(%ebp),%eax
+  801167:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  80116c:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801172:	8b 45 14             	mov    0x14(%ebp),%eax
+  801175:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80117a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80117f:	e8 72 fe ff ff       	call   800ff6 <nsipc>
+  801184:	89 c3                	mov    %eax,%ebx
+  801186:	85 c0                	test   %eax,%eax
+  801188:	78 22                	js     8011ac <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80118a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80118f:	39 c6                	cmp    %eax,%esi
+  801191:	0f 4e c6             	cmovle %esi,%eax
+  801194:	39 c3                	cmp    %eax,%ebx
+  801196:	7f 1d                	jg     8011b5 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801198:	83 ec 04             	sub    $0x4,%esp
+  80119b:	53                   	push   %ebx
+  80119c:	68 00 60 80 00       	push   $0x806000
+  8011a1:	ff 75 0c             	push   0xc(%ebp)
+  8011a4:	e8 b7 0d 00 00       	call   801f60 <memmove>
+  8011a9:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8011ac:	89 d8                	mov    %ebx,%eax
+  8011ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011b1:	5b                   	pop    %ebx
+  8011b2:	5e                   	pop    %esi
+  8011b3:	5d                   	pop    %ebp
+  8011b4:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8011b5:	68 87 27 80 00       	push   $0x802787
+  8011ba:	68 4f 27 80 00       	push   $0x80274f
+  8011bf:	6a 62                	push   $0x62
+  8011c1:	68 9c 27 80 00       	push   $0x80279c
+  8011c6:	e8 46 05 00 00       	call   801711 <_panic>
+
+008011cb <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8011cb:	55                   	push   %ebp
+  8011cc:	89 e5                	mov    %esp,%ebp
+  8011ce:	53                   	push   %ebx
+  8011cf:	83 ec 04             	sub    $0x4,%esp
+  8011d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8011d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d8:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  8011dd:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8011e3:	7f 2e                	jg     801213 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8011e5:	83 ec 04             	sub    $0x4,%esp
+  8011e8:	53                   	push   %ebx
+  8011e9:	ff 75 0c             	push   0xc(%ebp)
+  8011ec:	68 0c 60 80 00       	push   $0x80600c
+  8011f1:	e8 6a 0d 00 00       	call   801f60 <memmove>
+	nsipcbuf.send.req_size = size;
+  8011f6:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  8011fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011ff:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801204:	b8 08 00 00 00       	mov    $0x8,%eax
+  801209:	e8 e8 fd ff ff       	call   800ff6 <nsipc>
+}
+  80120e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801211:	c9                   	leave
+  801212:	c3                   	ret
+	assert(size < 1600);
+  801213:	68 a8 27 80 00       	push   $0x8027a8
+  801218:	68 4f 27 80 00       	push   $0x80274f
+  80121d:	6a 6d                	push   $0x6d
+  80121f:	68 9c 27 80 00       	push   $0x80279c
+  801224:	e8 e8 04 00 00       	call   801711 <_panic>
+
+00801229 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801229:	55                   	push   %ebp
+  80122a:	89 e5                	mov    %esp,%ebp
+  80122c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80122f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801232:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801237:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80123a:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  80123f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801242:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801247:	b8 09 00 00 00       	mov    $0x9,%eax
+  80124c:	e8 a5 fd ff ff       	call   800ff6 <nsipc>
+}
+  801251:	c9                   	leave
+  801252:	c3                   	ret
+
+00801253 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801253:	55                   	push   %ebp
+  801254:	89 e5                	mov    %esp,%ebp
+  801256:	56                   	push   %esi
+  801257:	53                   	push   %ebx
+  801258:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80125b:	83 ec 0c             	sub    $0xc,%esp
+  80125e:	ff 75 08             	push   0x8(%ebp)
+  801261:	e8 aa f3 ff ff       	call   800610 <fd2data>
+  801266:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801268:	83 c4 08             	add    $0x8,%esp
+  80126b:	68 b4 27 80 00       	push   $0x8027b4
+  801270:	53                   	push   %ebx
+  801271:	e8 64 0b 00 00       	call   801dda <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801276:	8b 46 04             	mov    0x4(%esi),%eax
+  801279:	2b 06                	sub    (%esi),%eax
+  80127b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801281:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801288:	00 00 00 
+	stat->st_dev = &devpipe;
+  80128b:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801292:	30 80 00 
+	return 0;
+}
+  801295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80129d:	5b                   	pop    %ebx
+  80129e:	5e                   	pop    %esi
+  80129f:	5d                   	pop    %ebp
+  8012a0:	c3                   	ret
+
+008012a1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8012a1:	55                   	push   %ebp
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	53                   	push   %ebx
+  8012a5:	83 ec 0c             	sub    $0xc,%esp
+  8012a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8012ab:	53                   	push   %ebx
+  8012ac:	6a 00                	push   $0x0
+  8012ae:	e8 f0 ef ff ff       	call   8002a3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8012b3:	89 1c 24             	mov    %ebx,(%esp)
+  8012b6:	e8 55 f3 ff ff       	call   800610 <fd2data>
+  8012bb:	83 c4 08             	add    $0x8,%esp
+  8012be:	50                   	push   %eax
+  8012bf:	6a 00                	push   $0x0
+  8012c1:	e8 dd ef ff ff       	call   8002a3 <sys_page_unmap>
+}
+  8012c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012c9:	c9                   	leave
+  8012ca:	c3                   	ret
+
+008012cb <_pipeisclosed>:
+{
+  8012cb:	55                   	push   %ebp
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	57                   	push   %edi
+  8012cf:	56                   	push   %esi
+  8012d0:	53                   	push   %ebx
+  8012d1:	83 ec 1c             	sub    $0x1c,%esp
+  8012d4:	89 c7                	mov    %eax,%edi
+  8012d6:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8012d8:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012dd:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8012e0:	83 ec 0c             	sub    $0xc,%esp
+  8012e3:	57                   	push   %edi
+  8012e4:	e8 fd 0e 00 00       	call   8021e6 <pageref>
+  8012e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012ec:	89 34 24             	mov    %esi,(%esp)
+  8012ef:	e8 f2 0e 00 00       	call   8021e6 <pageref>
+		nn = thisenv->env_runs;
+  8012f4:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  8012fa:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8012fd:	83 c4 10             	add    $0x10,%esp
+  801300:	39 cb                	cmp    %ecx,%ebx
+  801302:	74 1b                	je     80131f <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801304:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801307:	75 cf                	jne    8012d8 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801309:	8b 42 5c             	mov    0x5c(%edx),%eax
+  80130c:	6a 01                	push   $0x1
+  80130e:	50                   	push   %eax
+  80130f:	53                   	push   %ebx
+  801310:	68 bb 27 80 00       	push   $0x8027bb
+  801315:	e8 d2 04 00 00       	call   8017ec <cprintf>
+  80131a:	83 c4 10             	add    $0x10,%esp
+  80131d:	eb b9                	jmp    8012d8 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80131f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801322:	0f 94 c0             	sete   %al
+  801325:	0f b6 c0             	movzbl %al,%eax
+}
+  801328:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132b:	5b                   	pop    %ebx
+  80132c:	5e                   	pop    %esi
+  80132d:	5f                   	pop    %edi
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+
+00801330 <devpipe_write>:
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	57                   	push   %edi
+  801334:	56                   	push   %esi
+  801335:	53                   	push   %ebx
+  801336:	83 ec 28             	sub    $0x28,%esp
+  801339:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80133c:	56                   	push   %esi
+  80133d:	e8 ce f2 ff ff       	call   800610 <fd2data>
+  801342:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801344:	83 c4 10             	add    $0x10,%esp
+  801347:	bf 00 00 00 00       	mov    $0x0,%edi
+  80134c:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80134f:	75 09                	jne    80135a <devpipe_write+0x2a>
+	return i;
+  801351:	89 f8                	mov    %edi,%eax
+  801353:	eb 23                	jmp    801378 <devpipe_write+0x48>
+			sys_yield();
+  801355:	e8 01 ee ff ff       	call   80015b <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80135a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80135d:	8b 0b                	mov    (%ebx),%ecx
+  80135f:	8d 51 20             	lea    0x20(%ecx),%edx
+  801362:	39 d0                	cmp    %edx,%eax
+  801364:	72 1a                	jb     801380 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801366:	89 da                	mov    %ebx,%edx
+  801368:	89 f0                	mov    %esi,%eax
+  80136a:	e8 5c ff ff ff       	call   8012cb <_pipeisclosed>
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	74 e2                	je     801355 <devpipe_write+0x25>
+				return 0;
+  801373:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801378:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137b:	5b                   	pop    %ebx
+  80137c:	5e                   	pop    %esi
+  80137d:	5f                   	pop    %edi
+  80137e:	5d                   	pop    %ebp
+  80137f:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801380:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801383:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801387:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80138a:	89 c2                	mov    %eax,%edx
+  80138c:	c1 fa 1f             	sar    $0x1f,%edx
+  80138f:	89 d1                	mov    %edx,%ecx
+  801391:	c1 e9 1b             	shr    $0x1b,%ecx
+  801394:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801397:	83 e2 1f             	and    $0x1f,%edx
+  80139a:	29 ca                	sub    %ecx,%edx
+  80139c:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8013a0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8013a4:	83 c0 01             	add    $0x1,%eax
+  8013a7:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8013aa:	83 c7 01             	add    $0x1,%edi
+  8013ad:	eb 9d                	jmp    80134c <devpipe_write+0x1c>
+
+008013af <devpipe_read>:
+{
+  8013af:	55                   	push   %ebp
+  8013b0:	89 e5                	mov    %esp,%ebp
+  8013b2:	57                   	push   %edi
+  8013b3:	56                   	push   %esi
+  8013b4:	53                   	push   %ebx
+  8013b5:	83 ec 18             	sub    $0x18,%esp
+  8013b8:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8013bb:	57                   	push   %edi
+  8013bc:	e8 4f f2 ff ff       	call   800610 <fd2data>
+  8013c1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8013c3:	83 c4 10             	add    $0x10,%esp
+  8013c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013cb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8013ce:	75 13                	jne    8013e3 <devpipe_read+0x34>
+	return i;
+  8013d0:	89 f0                	mov    %esi,%eax
+  8013d2:	eb 02                	jmp    8013d6 <devpipe_read+0x27>
+				return i;
+  8013d4:	89 f0                	mov    %esi,%eax
+}
+  8013d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d9:	5b                   	pop    %ebx
+  8013da:	5e                   	pop    %esi
+  8013db:	5f                   	pop    %edi
+  8013dc:	5d                   	pop    %ebp
+  8013dd:	c3                   	ret
+			sys_yield();
+  8013de:	e8 78 ed ff ff       	call   80015b <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8013e3:	8b 03                	mov    (%ebx),%eax
+  8013e5:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8013e8:	75 18                	jne    801402 <devpipe_read+0x53>
+			if (i > 0)
+  8013ea:	85 f6                	test   %esi,%esi
+  8013ec:	75 e6                	jne    8013d4 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8013ee:	89 da                	mov    %ebx,%edx
+  8013f0:	89 f8                	mov    %edi,%eax
+  8013f2:	e8 d4 fe ff ff       	call   8012cb <_pipeisclosed>
+  8013f7:	85 c0                	test   %eax,%eax
+  8013f9:	74 e3                	je     8013de <devpipe_read+0x2f>
+				return 0;
+  8013fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801400:	eb d4                	jmp    8013d6 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801402:	99                   	cltd
+  801403:	c1 ea 1b             	shr    $0x1b,%edx
+  801406:	01 d0                	add    %edx,%eax
+  801408:	83 e0 1f             	and    $0x1f,%eax
+  80140b:	29 d0                	sub    %edx,%eax
+  80140d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801412:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801415:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801418:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80141b:	83 c6 01             	add    $0x1,%esi
+  80141e:	eb ab                	jmp    8013cb <devpipe_read+0x1c>
+
+00801420 <pipe>:
+{
+  801420:	55                   	push   %ebp
+  801421:	89 e5                	mov    %esp,%ebp
+  801423:	56                   	push   %esi
+  801424:	53                   	push   %ebx
+  801425:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801428:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80142b:	50                   	push   %eax
+  80142c:	e8 f6 f1 ff ff       	call   800627 <fd_alloc>
+  801431:	89 c3                	mov    %eax,%ebx
+  801433:	83 c4 10             	add    $0x10,%esp
+  801436:	85 c0                	test   %eax,%eax
+  801438:	0f 88 23 01 00 00    	js     801561 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80143e:	83 ec 04             	sub    $0x4,%esp
+  801441:	68 07 04 00 00       	push   $0x407
+  801446:	ff 75 f4             	push   -0xc(%ebp)
+  801449:	6a 00                	push   $0x0
+  80144b:	e8 8b ed ff ff       	call   8001db <sys_page_alloc>
+  801450:	89 c3                	mov    %eax,%ebx
+  801452:	83 c4 10             	add    $0x10,%esp
+  801455:	85 c0                	test   %eax,%eax
+  801457:	0f 88 04 01 00 00    	js     801561 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80145d:	83 ec 0c             	sub    $0xc,%esp
+  801460:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801463:	50                   	push   %eax
+  801464:	e8 be f1 ff ff       	call   800627 <fd_alloc>
+  801469:	89 c3                	mov    %eax,%ebx
+  80146b:	83 c4 10             	add    $0x10,%esp
+  80146e:	85 c0                	test   %eax,%eax
+  801470:	0f 88 db 00 00 00    	js     801551 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801476:	83 ec 04             	sub    $0x4,%esp
+  801479:	68 07 04 00 00       	push   $0x407
+  80147e:	ff 75 f0             	push   -0x10(%ebp)
+  801481:	6a 00                	push   $0x0
+  801483:	e8 53 ed ff ff       	call   8001db <sys_page_alloc>
+  801488:	89 c3                	mov    %eax,%ebx
+  80148a:	83 c4 10             	add    $0x10,%esp
+  80148d:	85 c0                	test   %eax,%eax
+  80148f:	0f 88 bc 00 00 00    	js     801551 <pipe+0x131>
+	va = fd2data(fd0);
+  801495:	83 ec 0c             	sub    $0xc,%esp
+  801498:	ff 75 f4             	push   -0xc(%ebp)
+  80149b:	e8 70 f1 ff ff       	call   800610 <fd2data>
+  8014a0:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014a2:	83 c4 0c             	add    $0xc,%esp
+  8014a5:	68 07 04 00 00       	push   $0x407
+  8014aa:	50                   	push   %eax
+  8014ab:	6a 00                	push   $0x0
+  8014ad:	e8 29 ed ff ff       	call   8001db <sys_page_alloc>
+  8014b2:	89 c3                	mov    %eax,%ebx
+  8014b4:	83 c4 10             	add    $0x10,%esp
+  8014b7:	85 c0                	test   %eax,%eax
+  8014b9:	0f 88 82 00 00 00    	js     801541 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014bf:	83 ec 0c             	sub    $0xc,%esp
+  8014c2:	ff 75 f0             	push   -0x10(%ebp)
+  8014c5:	e8 46 f1 ff ff       	call   800610 <fd2data>
+  8014ca:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014d1:	50                   	push   %eax
+  8014d2:	6a 00                	push   $0x0
+  8014d4:	56                   	push   %esi
+  8014d5:	6a 00                	push   $0x0
+  8014d7:	e8 85 ed ff ff       	call   800261 <sys_page_map>
+  8014dc:	89 c3                	mov    %eax,%ebx
+  8014de:	83 c4 20             	add    $0x20,%esp
+  8014e1:	85 c0                	test   %eax,%eax
+  8014e3:	78 4e                	js     801533 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014e5:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8014ea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014ed:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014ef:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014f2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8014f9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8014fc:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8014fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801501:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801508:	83 ec 0c             	sub    $0xc,%esp
+  80150b:	ff 75 f4             	push   -0xc(%ebp)
+  80150e:	e8 ed f0 ff ff       	call   800600 <fd2num>
+  801513:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801516:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801518:	83 c4 04             	add    $0x4,%esp
+  80151b:	ff 75 f0             	push   -0x10(%ebp)
+  80151e:	e8 dd f0 ff ff       	call   800600 <fd2num>
+  801523:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801526:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801529:	83 c4 10             	add    $0x10,%esp
+  80152c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801531:	eb 2e                	jmp    801561 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801533:	83 ec 08             	sub    $0x8,%esp
+  801536:	56                   	push   %esi
+  801537:	6a 00                	push   $0x0
+  801539:	e8 65 ed ff ff       	call   8002a3 <sys_page_unmap>
+  80153e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801541:	83 ec 08             	sub    $0x8,%esp
+  801544:	ff 75 f0             	push   -0x10(%ebp)
+  801547:	6a 00                	push   $0x0
+  801549:	e8 55 ed ff ff       	call   8002a3 <sys_page_unmap>
+  80154e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801551:	83 ec 08             	sub    $0x8,%esp
+  801554:	ff 75 f4             	push   -0xc(%ebp)
+  801557:	6a 00                	push   $0x0
+  801559:	e8 45 ed ff ff       	call   8002a3 <sys_page_unmap>
+  80155e:	83 c4 10             	add    $0x10,%esp
+}
+  801561:	89 d8                	mov    %ebx,%eax
+  801563:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801566:	5b                   	pop    %ebx
+  801567:	5e                   	pop    %esi
+  801568:	5d                   	pop    %ebp
+  801569:	c3                   	ret
+
+0080156a <pipeisclosed>:
+{
+  80156a:	55                   	push   %ebp
+  80156b:	89 e5                	mov    %esp,%ebp
+  80156d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801570:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801573:	50                   	push   %eax
+  801574:	ff 75 08             	push   0x8(%ebp)
+  801577:	e8 01 f1 ff ff       	call   80067d <fd_lookup>
+  80157c:	83 c4 10             	add    $0x10,%esp
+  80157f:	85 c0                	test   %eax,%eax
+  801581:	78 18                	js     80159b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801583:	83 ec 0c             	sub    $0xc,%esp
+  801586:	ff 75 f4             	push   -0xc(%ebp)
+  801589:	e8 82 f0 ff ff       	call   800610 <fd2data>
+  80158e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801590:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801593:	e8 33 fd ff ff       	call   8012cb <_pipeisclosed>
+  801598:	83 c4 10             	add    $0x10,%esp
+}
+  80159b:	c9                   	leave
+  80159c:	c3                   	ret
+
+0080159d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80159d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a2:	c3                   	ret
+
+008015a3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015a3:	55                   	push   %ebp
+  8015a4:	89 e5                	mov    %esp,%ebp
+  8015a6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015a9:	68 d3 27 80 00       	push   $0x8027d3
+  8015ae:	ff 75 0c             	push   0xc(%ebp)
+  8015b1:	e8 24 08 00 00       	call   801dda <strcpy>
+	return 0;
+}
+  8015b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bb:	c9                   	leave
+  8015bc:	c3                   	ret
+
+008015bd <devcons_write>:
+{
+  8015bd:	55                   	push   %ebp
+  8015be:	89 e5                	mov    %esp,%ebp
+  8015c0:	57                   	push   %edi
+  8015c1:	56                   	push   %esi
+  8015c2:	53                   	push   %ebx
+  8015c3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015c9:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015ce:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015d4:	eb 2e                	jmp    801604 <devcons_write+0x47>
+		m = n - tot;
+  8015d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015d9:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015db:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015e0:	39 c3                	cmp    %eax,%ebx
+  8015e2:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015e5:	83 ec 04             	sub    $0x4,%esp
+  8015e8:	53                   	push   %ebx
+  8015e9:	89 f0                	mov    %esi,%eax
+  8015eb:	03 45 0c             	add    0xc(%ebp),%eax
+  8015ee:	50                   	push   %eax
+  8015ef:	57                   	push   %edi
+  8015f0:	e8 6b 09 00 00       	call   801f60 <memmove>
+		sys_cputs(buf, m);
+  8015f5:	83 c4 08             	add    $0x8,%esp
+  8015f8:	53                   	push   %ebx
+  8015f9:	57                   	push   %edi
+  8015fa:	e8 9f ea ff ff       	call   80009e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8015ff:	01 de                	add    %ebx,%esi
+  801601:	83 c4 10             	add    $0x10,%esp
+  801604:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801607:	72 cd                	jb     8015d6 <devcons_write+0x19>
+}
+  801609:	89 f0                	mov    %esi,%eax
+  80160b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160e:	5b                   	pop    %ebx
+  80160f:	5e                   	pop    %esi
+  801610:	5f                   	pop    %edi
+  801611:	5d                   	pop    %ebp
+  801612:	c3                   	ret
+
+00801613 <devcons_read>:
+{
+  801613:	55                   	push   %ebp
+  801614:	89 e5                	mov    %esp,%ebp
+  801616:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801622:	75 07                	jne    80162b <devcons_read+0x18>
+  801624:	eb 1f                	jmp    801645 <devcons_read+0x32>
+		sys_yield();
+  801626:	e8 30 eb ff ff       	call   80015b <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80162b:	e8 8c ea ff ff       	call   8000bc <sys_cgetc>
+  801630:	85 c0                	test   %eax,%eax
+  801632:	74 f2                	je     801626 <devcons_read+0x13>
+	if (c < 0)
+  801634:	78 0f                	js     801645 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801636:	83 f8 04             	cmp    $0x4,%eax
+  801639:	74 0c                	je     801647 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80163b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80163e:	88 02                	mov    %al,(%edx)
+	return 1;
+  801640:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801645:	c9                   	leave
+  801646:	c3                   	ret
+		return 0;
+  801647:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164c:	eb f7                	jmp    801645 <devcons_read+0x32>
+
+0080164e <cputchar>:
+{
+  80164e:	55                   	push   %ebp
+  80164f:	89 e5                	mov    %esp,%ebp
+  801651:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801654:	8b 45 08             	mov    0x8(%ebp),%eax
+  801657:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80165a:	6a 01                	push   $0x1
+  80165c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80165f:	50                   	push   %eax
+  801660:	e8 39 ea ff ff       	call   80009e <sys_cputs>
+}
+  801665:	83 c4 10             	add    $0x10,%esp
+  801668:	c9                   	leave
+  801669:	c3                   	ret
+
+0080166a <getchar>:
+{
+  80166a:	55                   	push   %ebp
+  80166b:	89 e5                	mov    %esp,%ebp
+  80166d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801670:	6a 01                	push   $0x1
+  801672:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801675:	50                   	push   %eax
+  801676:	6a 00                	push   $0x0
+  801678:	e8 66 f2 ff ff       	call   8008e3 <read>
+	if (r < 0)
+  80167d:	83 c4 10             	add    $0x10,%esp
+  801680:	85 c0                	test   %eax,%eax
+  801682:	78 06                	js     80168a <getchar+0x20>
+	if (r < 1)
+  801684:	74 06                	je     80168c <getchar+0x22>
+	return c;
+  801686:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80168a:	c9                   	leave
+  80168b:	c3                   	ret
+		return -E_EOF;
+  80168c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801691:	eb f7                	jmp    80168a <getchar+0x20>
+
+00801693 <iscons>:
+{
+  801693:	55                   	push   %ebp
+  801694:	89 e5                	mov    %esp,%ebp
+  801696:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801699:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80169c:	50                   	push   %eax
+  80169d:	ff 75 08             	push   0x8(%ebp)
+  8016a0:	e8 d8 ef ff ff       	call   80067d <fd_lookup>
+  8016a5:	83 c4 10             	add    $0x10,%esp
+  8016a8:	85 c0                	test   %eax,%eax
+  8016aa:	78 11                	js     8016bd <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016af:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8016b5:	39 10                	cmp    %edx,(%eax)
+  8016b7:	0f 94 c0             	sete   %al
+  8016ba:	0f b6 c0             	movzbl %al,%eax
+}
+  8016bd:	c9                   	leave
+  8016be:	c3                   	ret
+
+008016bf <opencons>:
+{
+  8016bf:	55                   	push   %ebp
+  8016c0:	89 e5                	mov    %esp,%ebp
+  8016c2:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c8:	50                   	push   %eax
+  8016c9:	e8 59 ef ff ff       	call   800627 <fd_alloc>
+  8016ce:	83 c4 10             	add    $0x10,%esp
+  8016d1:	85 c0                	test   %eax,%eax
+  8016d3:	78 3a                	js     80170f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016d5:	83 ec 04             	sub    $0x4,%esp
+  8016d8:	68 07 04 00 00       	push   $0x407
+  8016dd:	ff 75 f4             	push   -0xc(%ebp)
+  8016e0:	6a 00                	push   $0x0
+  8016e2:	e8 f4 ea ff ff       	call   8001db <sys_page_alloc>
+  8016e7:	83 c4 10             	add    $0x10,%esp
+  8016ea:	85 c0                	test   %eax,%eax
+  8016ec:	78 21                	js     80170f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f1:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8016f7:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8016f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016fc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801703:	83 ec 0c             	sub    $0xc,%esp
+  801706:	50                   	push   %eax
+  801707:	e8 f4 ee ff ff       	call   800600 <fd2num>
+  80170c:	83 c4 10             	add    $0x10,%esp
+}
+  80170f:	c9                   	leave
+  801710:	c3                   	ret
+
+00801711 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801711:	55                   	push   %ebp
+  801712:	89 e5                	mov    %esp,%ebp
+  801714:	56                   	push   %esi
+  801715:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801716:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801719:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80171f:	e8 18 ea ff ff       	call   80013c <sys_getenvid>
+  801724:	83 ec 0c             	sub    $0xc,%esp
+  801727:	ff 75 0c             	push   0xc(%ebp)
+  80172a:	ff 75 08             	push   0x8(%ebp)
+  80172d:	56                   	push   %esi
+  80172e:	50                   	push   %eax
+  80172f:	68 e0 27 80 00       	push   $0x8027e0
+  801734:	e8 b3 00 00 00       	call   8017ec <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801739:	83 c4 18             	add    $0x18,%esp
+  80173c:	53                   	push   %ebx
+  80173d:	ff 75 10             	push   0x10(%ebp)
+  801740:	e8 56 00 00 00       	call   80179b <vcprintf>
+	cprintf("\n");
+  801745:	c7 04 24 cc 27 80 00 	movl   $0x8027cc,(%esp)
+  80174c:	e8 9b 00 00 00       	call   8017ec <cprintf>
+  801751:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801754:	cc                   	int3
+	while (1)
+  801755:	eb fd                	jmp    801754 <_panic+0x43>
+
+00801757 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801757:	55                   	push   %ebp
+  801758:	89 e5                	mov    %esp,%ebp
+  80175a:	53                   	push   %ebx
+  80175b:	83 ec 04             	sub    $0x4,%esp
+  80175e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801761:	8b 13                	mov    (%ebx),%edx
+  801763:	8d 42 01             	lea    0x1(%edx),%eax
+  801766:	89 03                	mov    %eax,(%ebx)
+  801768:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80176b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80176f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801774:	74 09                	je     80177f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801776:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80177a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80177d:	c9                   	leave
+  80177e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80177f:	83 ec 08             	sub    $0x8,%esp
+  801782:	68 ff 00 00 00       	push   $0xff
+  801787:	8d 43 08             	lea    0x8(%ebx),%eax
+  80178a:	50                   	push   %eax
+  80178b:	e8 0e e9 ff ff       	call   80009e <sys_cputs>
+		b->idx = 0;
+  801790:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801796:	83 c4 10             	add    $0x10,%esp
+  801799:	eb db                	jmp    801776 <putch+0x1f>
+
+0080179b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80179b:	55                   	push   %ebp
+  80179c:	89 e5                	mov    %esp,%ebp
+  80179e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017a4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017ab:	00 00 00 
+	b.cnt = 0;
+  8017ae:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017b5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017b8:	ff 75 0c             	push   0xc(%ebp)
+  8017bb:	ff 75 08             	push   0x8(%ebp)
+  8017be:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017c4:	50                   	push   %eax
+  8017c5:	68 57 17 80 00       	push   $0x801757
+  8017ca:	e8 14 01 00 00       	call   8018e3 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017cf:	83 c4 08             	add    $0x8,%esp
+  8017d2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017d8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017de:	50                   	push   %eax
+  8017df:	e8 ba e8 ff ff       	call   80009e <sys_cputs>
+
+	return b.cnt;
+}
+  8017e4:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017ea:	c9                   	leave
+  8017eb:	c3                   	ret
+
+008017ec <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017ec:	55                   	push   %ebp
+  8017ed:	89 e5                	mov    %esp,%ebp
+  8017ef:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017f2:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8017f5:	50                   	push   %eax
+  8017f6:	ff 75 08             	push   0x8(%ebp)
+  8017f9:	e8 9d ff ff ff       	call   80179b <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8017fe:	c9                   	leave
+  8017ff:	c3                   	ret
+
+00801800 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801800:	55                   	push   %ebp
+  801801:	89 e5                	mov    %esp,%ebp
+  801803:	57                   	push   %edi
+  801804:	56                   	push   %esi
+  801805:	53                   	push   %ebx
+  801806:	83 ec 1c             	sub    $0x1c,%esp
+  801809:	89 c7                	mov    %eax,%edi
+  80180b:	89 d6                	mov    %edx,%esi
+  80180d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801810:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801813:	89 d1                	mov    %edx,%ecx
+  801815:	89 c2                	mov    %eax,%edx
+  801817:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80181a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80181d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801820:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801823:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801826:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80182d:	39 c2                	cmp    %eax,%edx
+  80182f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801832:	72 3e                	jb     801872 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801834:	83 ec 0c             	sub    $0xc,%esp
+  801837:	ff 75 18             	push   0x18(%ebp)
+  80183a:	83 eb 01             	sub    $0x1,%ebx
+  80183d:	53                   	push   %ebx
+  80183e:	50                   	push   %eax
+  80183f:	83 ec 08             	sub    $0x8,%esp
+  801842:	ff 75 e4             	push   -0x1c(%ebp)
+  801845:	ff 75 e0             	push   -0x20(%ebp)
+  801848:	ff 75 dc             	push   -0x24(%ebp)
+  80184b:	ff 75 d8             	push   -0x28(%ebp)
+  80184e:	e8 ad 0a 00 00       	call   802300 <__udivdi3>
+  801853:	83 c4 18             	add    $0x18,%esp
+  801856:	52                   	push   %edx
+  801857:	50                   	push   %eax
+  801858:	89 f2                	mov    %esi,%edx
+  80185a:	89 f8                	mov    %edi,%eax
+  80185c:	e8 9f ff ff ff       	call   801800 <printnum>
+  801861:	83 c4 20             	add    $0x20,%esp
+  801864:	eb 13                	jmp    801879 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801866:	83 ec 08             	sub    $0x8,%esp
+  801869:	56                   	push   %esi
+  80186a:	ff 75 18             	push   0x18(%ebp)
+  80186d:	ff d7                	call   *%edi
+  80186f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801872:	83 eb 01             	sub    $0x1,%ebx
+  801875:	85 db                	test   %ebx,%ebx
+  801877:	7f ed                	jg     801866 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801879:	83 ec 08             	sub    $0x8,%esp
+  80187c:	56                   	push   %esi
+  80187d:	83 ec 04             	sub    $0x4,%esp
+  801880:	ff 75 e4             	push   -0x1c(%ebp)
+  801883:	ff 75 e0             	push   -0x20(%ebp)
+  801886:	ff 75 dc             	push   -0x24(%ebp)
+  801889:	ff 75 d8             	push   -0x28(%ebp)
+  80188c:	e8 2f 0b 00 00       	call   8023c0 <__umoddi3>
+  801891:	83 c4 14             	add    $0x14,%esp
+  801894:	0f be 80 03 28 80 00 	movsbl 0x802803(%eax),%eax
+  80189b:	50                   	push   %eax
+  80189c:	ff d7                	call   *%edi
+}
+  80189e:	83 c4 10             	add    $0x10,%esp
+  8018a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a4:	5b                   	pop    %ebx
+  8018a5:	5e                   	pop    %esi
+  8018a6:	5f                   	pop    %edi
+  8018a7:	5d                   	pop    %ebp
+  8018a8:	c3                   	ret
+
+008018a9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+  8018ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018af:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018b3:	8b 10                	mov    (%eax),%edx
+  8018b5:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018b8:	73 0a                	jae    8018c4 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018ba:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018bd:	89 08                	mov    %ecx,(%eax)
+  8018bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c2:	88 02                	mov    %al,(%edx)
+}
+  8018c4:	5d                   	pop    %ebp
+  8018c5:	c3                   	ret
+
+008018c6 <printfmt>:
+{
+  8018c6:	55                   	push   %ebp
+  8018c7:	89 e5                	mov    %esp,%ebp
+  8018c9:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018cc:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018cf:	50                   	push   %eax
+  8018d0:	ff 75 10             	push   0x10(%ebp)
+  8018d3:	ff 75 0c             	push   0xc(%ebp)
+  8018d6:	ff 75 08             	push   0x8(%ebp)
+  8018d9:	e8 05 00 00 00       	call   8018e3 <vprintfmt>
+}
+  8018de:	83 c4 10             	add    $0x10,%esp
+  8018e1:	c9                   	leave
+  8018e2:	c3                   	ret
+
+008018e3 <vprintfmt>:
+{
+  8018e3:	55                   	push   %ebp
+  8018e4:	89 e5                	mov    %esp,%ebp
+  8018e6:	57                   	push   %edi
+  8018e7:	56                   	push   %esi
+  8018e8:	53                   	push   %ebx
+  8018e9:	83 ec 2c             	sub    $0x2c,%esp
+  8018ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018f2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8018f5:	eb 0a                	jmp    801901 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8018f7:	83 ec 08             	sub    $0x8,%esp
+  8018fa:	53                   	push   %ebx
+  8018fb:	50                   	push   %eax
+  8018fc:	ff d6                	call   *%esi
+  8018fe:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801901:	83 c7 01             	add    $0x1,%edi
+  801904:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801908:	83 f8 25             	cmp    $0x25,%eax
+  80190b:	74 0c                	je     801919 <vprintfmt+0x36>
+			if (ch == '\0')
+  80190d:	85 c0                	test   %eax,%eax
+  80190f:	75 e6                	jne    8018f7 <vprintfmt+0x14>
+}
+  801911:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801914:	5b                   	pop    %ebx
+  801915:	5e                   	pop    %esi
+  801916:	5f                   	pop    %edi
+  801917:	5d                   	pop    %ebp
+  801918:	c3                   	ret
+		padc = ' ';
+  801919:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80191d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801924:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80192b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801932:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801937:	8d 47 01             	lea    0x1(%edi),%eax
+  80193a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80193d:	0f b6 17             	movzbl (%edi),%edx
+  801940:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801943:	3c 55                	cmp    $0x55,%al
+  801945:	0f 87 cf 03 00 00    	ja     801d1a <vprintfmt+0x437>
+  80194b:	0f b6 c0             	movzbl %al,%eax
+  80194e:	ff 24 85 40 29 80 00 	jmp    *0x802940(,%eax,4)
+  801955:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801958:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80195c:	eb d9                	jmp    801937 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80195e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801961:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801965:	eb d0                	jmp    801937 <vprintfmt+0x54>
+  801967:	0f b6 d2             	movzbl %dl,%edx
+  80196a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80196d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801972:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801975:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801978:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80197c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80197f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801982:	83 f9 09             	cmp    $0x9,%ecx
+  801985:	77 55                	ja     8019dc <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801987:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80198a:	eb e9                	jmp    801975 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80198c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80198f:	8b 00                	mov    (%eax),%eax
+  801991:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801994:	8b 45 14             	mov    0x14(%ebp),%eax
+  801997:	8d 40 04             	lea    0x4(%eax),%eax
+  80199a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80199d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8019a0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019a4:	79 91                	jns    801937 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019a6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019ac:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019b3:	eb 82                	jmp    801937 <vprintfmt+0x54>
+			if (width < 0)
+  8019b5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019b8:	85 d2                	test   %edx,%edx
+  8019ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019bf:	0f 49 c2             	cmovns %edx,%eax
+  8019c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019c8:	e9 6a ff ff ff       	jmp    801937 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019d0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019d7:	e9 5b ff ff ff       	jmp    801937 <vprintfmt+0x54>
+  8019dc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019df:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019e2:	eb bc                	jmp    8019a0 <vprintfmt+0xbd>
+			lflag++;
+  8019e4:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019ea:	e9 48 ff ff ff       	jmp    801937 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019f2:	8d 78 04             	lea    0x4(%eax),%edi
+  8019f5:	83 ec 08             	sub    $0x8,%esp
+  8019f8:	53                   	push   %ebx
+  8019f9:	ff 30                	push   (%eax)
+  8019fb:	ff d6                	call   *%esi
+			break;
+  8019fd:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801a00:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801a03:	e9 b1 02 00 00       	jmp    801cb9 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801a08:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a0b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a0e:	8b 10                	mov    (%eax),%edx
+  801a10:	89 d0                	mov    %edx,%eax
+  801a12:	f7 d8                	neg    %eax
+  801a14:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a17:	83 f8 0f             	cmp    $0xf,%eax
+  801a1a:	7f 23                	jg     801a3f <vprintfmt+0x15c>
+  801a1c:	8b 14 85 a0 2a 80 00 	mov    0x802aa0(,%eax,4),%edx
+  801a23:	85 d2                	test   %edx,%edx
+  801a25:	74 18                	je     801a3f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a27:	52                   	push   %edx
+  801a28:	68 61 27 80 00       	push   $0x802761
+  801a2d:	53                   	push   %ebx
+  801a2e:	56                   	push   %esi
+  801a2f:	e8 92 fe ff ff       	call   8018c6 <printfmt>
+  801a34:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a37:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a3a:	e9 7a 02 00 00       	jmp    801cb9 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801a3f:	50                   	push   %eax
+  801a40:	68 1b 28 80 00       	push   $0x80281b
+  801a45:	53                   	push   %ebx
+  801a46:	56                   	push   %esi
+  801a47:	e8 7a fe ff ff       	call   8018c6 <printfmt>
+  801a4c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a4f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a52:	e9 62 02 00 00       	jmp    801cb9 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a57:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a5a:	83 c0 04             	add    $0x4,%eax
+  801a5d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a60:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a63:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a65:	85 c9                	test   %ecx,%ecx
+  801a67:	b8 14 28 80 00       	mov    $0x802814,%eax
+  801a6c:	0f 45 c1             	cmovne %ecx,%eax
+  801a6f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a72:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a76:	7e 06                	jle    801a7e <vprintfmt+0x19b>
+  801a78:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a7c:	75 0b                	jne    801a89 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a7e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a81:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a84:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a87:	eb 5c                	jmp    801ae5 <vprintfmt+0x202>
+  801a89:	83 ec 08             	sub    $0x8,%esp
+  801a8c:	ff 75 d0             	push   -0x30(%ebp)
+  801a8f:	ff 75 cc             	push   -0x34(%ebp)
+  801a92:	e8 20 03 00 00       	call   801db7 <strnlen>
+  801a97:	89 c2                	mov    %eax,%edx
+  801a99:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a9c:	29 d0                	sub    %edx,%eax
+  801a9e:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801aa1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801aa5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801aa8:	89 75 08             	mov    %esi,0x8(%ebp)
+  801aab:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aad:	eb 0e                	jmp    801abd <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801aaf:	83 ec 08             	sub    $0x8,%esp
+  801ab2:	53                   	push   %ebx
+  801ab3:	57                   	push   %edi
+  801ab4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ab7:	83 ee 01             	sub    $0x1,%esi
+  801aba:	83 c4 10             	add    $0x10,%esp
+  801abd:	85 f6                	test   %esi,%esi
+  801abf:	7f ee                	jg     801aaf <vprintfmt+0x1cc>
+  801ac1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ac4:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ac7:	85 c0                	test   %eax,%eax
+  801ac9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ace:	0f 49 d0             	cmovns %eax,%edx
+  801ad1:	29 d0                	sub    %edx,%eax
+  801ad3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ad6:	eb a6                	jmp    801a7e <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ad8:	83 ec 08             	sub    $0x8,%esp
+  801adb:	53                   	push   %ebx
+  801adc:	52                   	push   %edx
+  801add:	ff 55 08             	call   *0x8(%ebp)
+  801ae0:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801ae3:	89 f1                	mov    %esi,%ecx
+  801ae5:	8d 71 01             	lea    0x1(%ecx),%esi
+  801ae8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801aec:	0f be d0             	movsbl %al,%edx
+  801aef:	85 d2                	test   %edx,%edx
+  801af1:	74 28                	je     801b1b <vprintfmt+0x238>
+  801af3:	85 ff                	test   %edi,%edi
+  801af5:	78 05                	js     801afc <vprintfmt+0x219>
+  801af7:	83 ef 01             	sub    $0x1,%edi
+  801afa:	78 30                	js     801b2c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801afc:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801b00:	74 d6                	je     801ad8 <vprintfmt+0x1f5>
+  801b02:	0f be c0             	movsbl %al,%eax
+  801b05:	83 e8 20             	sub    $0x20,%eax
+  801b08:	83 f8 5e             	cmp    $0x5e,%eax
+  801b0b:	76 cb                	jbe    801ad8 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b0d:	83 ec 08             	sub    $0x8,%esp
+  801b10:	53                   	push   %ebx
+  801b11:	6a 3f                	push   $0x3f
+  801b13:	ff 55 08             	call   *0x8(%ebp)
+  801b16:	83 c4 10             	add    $0x10,%esp
+  801b19:	eb c8                	jmp    801ae3 <vprintfmt+0x200>
+  801b1b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b1e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b21:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b24:	01 d0                	add    %edx,%eax
+  801b26:	29 c8                	sub    %ecx,%eax
+  801b28:	89 c7                	mov    %eax,%edi
+  801b2a:	eb 13                	jmp    801b3f <vprintfmt+0x25c>
+  801b2c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b2f:	eb ed                	jmp    801b1e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b31:	83 ec 08             	sub    $0x8,%esp
+  801b34:	53                   	push   %ebx
+  801b35:	6a 20                	push   $0x20
+  801b37:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b39:	83 ef 01             	sub    $0x1,%edi
+  801b3c:	83 c4 10             	add    $0x10,%esp
+  801b3f:	85 ff                	test   %edi,%edi
+  801b41:	7f ee                	jg     801b31 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b43:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b46:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b49:	e9 6b 01 00 00       	jmp    801cb9 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801b4e:	83 f9 01             	cmp    $0x1,%ecx
+  801b51:	7f 1f                	jg     801b72 <vprintfmt+0x28f>
+	else if (lflag)
+  801b53:	85 c9                	test   %ecx,%ecx
+  801b55:	74 67                	je     801bbe <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801b57:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b5a:	8b 00                	mov    (%eax),%eax
+  801b5c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b5f:	89 c1                	mov    %eax,%ecx
+  801b61:	c1 f9 1f             	sar    $0x1f,%ecx
+  801b64:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801b67:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b6a:	8d 40 04             	lea    0x4(%eax),%eax
+  801b6d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b70:	eb 17                	jmp    801b89 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801b72:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b75:	8b 50 04             	mov    0x4(%eax),%edx
+  801b78:	8b 00                	mov    (%eax),%eax
+  801b7a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b7d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b80:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b83:	8d 40 08             	lea    0x8(%eax),%eax
+  801b86:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b89:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b8c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b8f:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801b94:	85 c9                	test   %ecx,%ecx
+  801b96:	0f 89 03 01 00 00    	jns    801c9f <vprintfmt+0x3bc>
+				putch('-', putdat);
+  801b9c:	83 ec 08             	sub    $0x8,%esp
+  801b9f:	53                   	push   %ebx
+  801ba0:	6a 2d                	push   $0x2d
+  801ba2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801ba4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801ba7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801baa:	f7 da                	neg    %edx
+  801bac:	83 d1 00             	adc    $0x0,%ecx
+  801baf:	f7 d9                	neg    %ecx
+  801bb1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bb4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bb9:	e9 e1 00 00 00       	jmp    801c9f <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  801bbe:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bc1:	8b 00                	mov    (%eax),%eax
+  801bc3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bc6:	89 c1                	mov    %eax,%ecx
+  801bc8:	c1 f9 1f             	sar    $0x1f,%ecx
+  801bcb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801bce:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bd1:	8d 40 04             	lea    0x4(%eax),%eax
+  801bd4:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bd7:	eb b0                	jmp    801b89 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801bd9:	83 f9 01             	cmp    $0x1,%ecx
+  801bdc:	7f 1e                	jg     801bfc <vprintfmt+0x319>
+	else if (lflag)
+  801bde:	85 c9                	test   %ecx,%ecx
+  801be0:	74 32                	je     801c14 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  801be2:	8b 45 14             	mov    0x14(%ebp),%eax
+  801be5:	8b 10                	mov    (%eax),%edx
+  801be7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bec:	8d 40 04             	lea    0x4(%eax),%eax
+  801bef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bf2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801bf7:	e9 a3 00 00 00       	jmp    801c9f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801bfc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bff:	8b 10                	mov    (%eax),%edx
+  801c01:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c04:	8d 40 08             	lea    0x8(%eax),%eax
+  801c07:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c0a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c0f:	e9 8b 00 00 00       	jmp    801c9f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c14:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c17:	8b 10                	mov    (%eax),%edx
+  801c19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c1e:	8d 40 04             	lea    0x4(%eax),%eax
+  801c21:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c24:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c29:	eb 74                	jmp    801c9f <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  801c2b:	83 f9 01             	cmp    $0x1,%ecx
+  801c2e:	7f 1b                	jg     801c4b <vprintfmt+0x368>
+	else if (lflag)
+  801c30:	85 c9                	test   %ecx,%ecx
+  801c32:	74 2c                	je     801c60 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  801c34:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c37:	8b 10                	mov    (%eax),%edx
+  801c39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c3e:	8d 40 04             	lea    0x4(%eax),%eax
+  801c41:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c44:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  801c49:	eb 54                	jmp    801c9f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c4b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c4e:	8b 10                	mov    (%eax),%edx
+  801c50:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c53:	8d 40 08             	lea    0x8(%eax),%eax
+  801c56:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c59:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  801c5e:	eb 3f                	jmp    801c9f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c60:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c63:	8b 10                	mov    (%eax),%edx
+  801c65:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c6a:	8d 40 04             	lea    0x4(%eax),%eax
+  801c6d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c70:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  801c75:	eb 28                	jmp    801c9f <vprintfmt+0x3bc>
+			putch('0', putdat);
+  801c77:	83 ec 08             	sub    $0x8,%esp
+  801c7a:	53                   	push   %ebx
+  801c7b:	6a 30                	push   $0x30
+  801c7d:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c7f:	83 c4 08             	add    $0x8,%esp
+  801c82:	53                   	push   %ebx
+  801c83:	6a 78                	push   $0x78
+  801c85:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c87:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c8a:	8b 10                	mov    (%eax),%edx
+  801c8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801c91:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801c94:	8d 40 04             	lea    0x4(%eax),%eax
+  801c97:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801c9a:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801c9f:	83 ec 0c             	sub    $0xc,%esp
+  801ca2:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801ca6:	50                   	push   %eax
+  801ca7:	ff 75 e0             	push   -0x20(%ebp)
+  801caa:	57                   	push   %edi
+  801cab:	51                   	push   %ecx
+  801cac:	52                   	push   %edx
+  801cad:	89 da                	mov    %ebx,%edx
+  801caf:	89 f0                	mov    %esi,%eax
+  801cb1:	e8 4a fb ff ff       	call   801800 <printnum>
+			break;
+  801cb6:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801cb9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801cbc:	e9 40 fc ff ff       	jmp    801901 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801cc1:	83 f9 01             	cmp    $0x1,%ecx
+  801cc4:	7f 1b                	jg     801ce1 <vprintfmt+0x3fe>
+	else if (lflag)
+  801cc6:	85 c9                	test   %ecx,%ecx
+  801cc8:	74 2c                	je     801cf6 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  801cca:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ccd:	8b 10                	mov    (%eax),%edx
+  801ccf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cd4:	8d 40 04             	lea    0x4(%eax),%eax
+  801cd7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cda:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801cdf:	eb be                	jmp    801c9f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801ce1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ce4:	8b 10                	mov    (%eax),%edx
+  801ce6:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ce9:	8d 40 08             	lea    0x8(%eax),%eax
+  801cec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cef:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801cf4:	eb a9                	jmp    801c9f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801cf6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf9:	8b 10                	mov    (%eax),%edx
+  801cfb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d00:	8d 40 04             	lea    0x4(%eax),%eax
+  801d03:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d06:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d0b:	eb 92                	jmp    801c9f <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  801d0d:	83 ec 08             	sub    $0x8,%esp
+  801d10:	53                   	push   %ebx
+  801d11:	6a 25                	push   $0x25
+  801d13:	ff d6                	call   *%esi
+			break;
+  801d15:	83 c4 10             	add    $0x10,%esp
+  801d18:	eb 9f                	jmp    801cb9 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  801d1a:	83 ec 08             	sub    $0x8,%esp
+  801d1d:	53                   	push   %ebx
+  801d1e:	6a 25                	push   $0x25
+  801d20:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d22:	83 c4 10             	add    $0x10,%esp
+  801d25:	89 f8                	mov    %edi,%eax
+  801d27:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d2b:	74 05                	je     801d32 <vprintfmt+0x44f>
+  801d2d:	83 e8 01             	sub    $0x1,%eax
+  801d30:	eb f5                	jmp    801d27 <vprintfmt+0x444>
+  801d32:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d35:	eb 82                	jmp    801cb9 <vprintfmt+0x3d6>
+
+00801d37 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d37:	55                   	push   %ebp
+  801d38:	89 e5                	mov    %esp,%ebp
+  801d3a:	83 ec 18             	sub    $0x18,%esp
+  801d3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d40:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d43:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d46:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d4a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d4d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	74 26                	je     801d7e <vsnprintf+0x47>
+  801d58:	85 d2                	test   %edx,%edx
+  801d5a:	7e 22                	jle    801d7e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d5c:	ff 75 14             	push   0x14(%ebp)
+  801d5f:	ff 75 10             	push   0x10(%ebp)
+  801d62:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d65:	50                   	push   %eax
+  801d66:	68 a9 18 80 00       	push   $0x8018a9
+  801d6b:	e8 73 fb ff ff       	call   8018e3 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d70:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d73:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d79:	83 c4 10             	add    $0x10,%esp
+}
+  801d7c:	c9                   	leave
+  801d7d:	c3                   	ret
+		return -E_INVAL;
+  801d7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d83:	eb f7                	jmp    801d7c <vsnprintf+0x45>
+
+00801d85 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d85:	55                   	push   %ebp
+  801d86:	89 e5                	mov    %esp,%ebp
+  801d88:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d8b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d8e:	50                   	push   %eax
+  801d8f:	ff 75 10             	push   0x10(%ebp)
+  801d92:	ff 75 0c             	push   0xc(%ebp)
+  801d95:	ff 75 08             	push   0x8(%ebp)
+  801d98:	e8 9a ff ff ff       	call   801d37 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801d9d:	c9                   	leave
+  801d9e:	c3                   	ret
+
+00801d9f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801d9f:	55                   	push   %ebp
+  801da0:	89 e5                	mov    %esp,%ebp
+  801da2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801da5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801daa:	eb 03                	jmp    801daf <strlen+0x10>
+		n++;
+  801dac:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801daf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801db3:	75 f7                	jne    801dac <strlen+0xd>
+	return n;
+}
+  801db5:	5d                   	pop    %ebp
+  801db6:	c3                   	ret
+
+00801db7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801db7:	55                   	push   %ebp
+  801db8:	89 e5                	mov    %esp,%ebp
+  801dba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dbd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc5:	eb 03                	jmp    801dca <strnlen+0x13>
+		n++;
+  801dc7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dca:	39 d0                	cmp    %edx,%eax
+  801dcc:	74 08                	je     801dd6 <strnlen+0x1f>
+  801dce:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801dd2:	75 f3                	jne    801dc7 <strnlen+0x10>
+  801dd4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801dd6:	89 d0                	mov    %edx,%eax
+  801dd8:	5d                   	pop    %ebp
+  801dd9:	c3                   	ret
+
+00801dda <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801dda:	55                   	push   %ebp
+  801ddb:	89 e5                	mov    %esp,%ebp
+  801ddd:	53                   	push   %ebx
+  801dde:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801de1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801ded:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801df0:	83 c0 01             	add    $0x1,%eax
+  801df3:	84 d2                	test   %dl,%dl
+  801df5:	75 f2                	jne    801de9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801df7:	89 c8                	mov    %ecx,%eax
+  801df9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dfc:	c9                   	leave
+  801dfd:	c3                   	ret
+
+00801dfe <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801dfe:	55                   	push   %ebp
+  801dff:	89 e5                	mov    %esp,%ebp
+  801e01:	53                   	push   %ebx
+  801e02:	83 ec 10             	sub    $0x10,%esp
+  801e05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e08:	53                   	push   %ebx
+  801e09:	e8 91 ff ff ff       	call   801d9f <strlen>
+  801e0e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e11:	ff 75 0c             	push   0xc(%ebp)
+  801e14:	01 d8                	add    %ebx,%eax
+  801e16:	50                   	push   %eax
+  801e17:	e8 be ff ff ff       	call   801dda <strcpy>
+	return dst;
+}
+  801e1c:	89 d8                	mov    %ebx,%eax
+  801e1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e21:	c9                   	leave
+  801e22:	c3                   	ret
+
+00801e23 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e23:	55                   	push   %ebp
+  801e24:	89 e5                	mov    %esp,%ebp
+  801e26:	56                   	push   %esi
+  801e27:	53                   	push   %ebx
+  801e28:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e2e:	89 f3                	mov    %esi,%ebx
+  801e30:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e33:	89 f0                	mov    %esi,%eax
+  801e35:	eb 0f                	jmp    801e46 <strncpy+0x23>
+		*dst++ = *src;
+  801e37:	83 c0 01             	add    $0x1,%eax
+  801e3a:	0f b6 0a             	movzbl (%edx),%ecx
+  801e3d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e40:	80 f9 01             	cmp    $0x1,%cl
+  801e43:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e46:	39 d8                	cmp    %ebx,%eax
+  801e48:	75 ed                	jne    801e37 <strncpy+0x14>
+	}
+	return ret;
+}
+  801e4a:	89 f0                	mov    %esi,%eax
+  801e4c:	5b                   	pop    %ebx
+  801e4d:	5e                   	pop    %esi
+  801e4e:	5d                   	pop    %ebp
+  801e4f:	c3                   	ret
+
+00801e50 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e50:	55                   	push   %ebp
+  801e51:	89 e5                	mov    %esp,%ebp
+  801e53:	56                   	push   %esi
+  801e54:	53                   	push   %ebx
+  801e55:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e5b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e5e:	89 f0                	mov    %esi,%eax
+  801e60:	85 d2                	test   %edx,%edx
+  801e62:	74 21                	je     801e85 <strlcpy+0x35>
+  801e64:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e68:	89 f2                	mov    %esi,%edx
+  801e6a:	eb 09                	jmp    801e75 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e6c:	83 c1 01             	add    $0x1,%ecx
+  801e6f:	83 c2 01             	add    $0x1,%edx
+  801e72:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e75:	39 c2                	cmp    %eax,%edx
+  801e77:	74 09                	je     801e82 <strlcpy+0x32>
+  801e79:	0f b6 19             	movzbl (%ecx),%ebx
+  801e7c:	84 db                	test   %bl,%bl
+  801e7e:	75 ec                	jne    801e6c <strlcpy+0x1c>
+  801e80:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e82:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e85:	29 f0                	sub    %esi,%eax
+}
+  801e87:	5b                   	pop    %ebx
+  801e88:	5e                   	pop    %esi
+  801e89:	5d                   	pop    %ebp
+  801e8a:	c3                   	ret
+
+00801e8b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e8b:	55                   	push   %ebp
+  801e8c:	89 e5                	mov    %esp,%ebp
+  801e8e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e91:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801e94:	eb 06                	jmp    801e9c <strcmp+0x11>
+		p++, q++;
+  801e96:	83 c1 01             	add    $0x1,%ecx
+  801e99:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801e9c:	0f b6 01             	movzbl (%ecx),%eax
+  801e9f:	84 c0                	test   %al,%al
+  801ea1:	74 04                	je     801ea7 <strcmp+0x1c>
+  801ea3:	3a 02                	cmp    (%edx),%al
+  801ea5:	74 ef                	je     801e96 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ea7:	0f b6 c0             	movzbl %al,%eax
+  801eaa:	0f b6 12             	movzbl (%edx),%edx
+  801ead:	29 d0                	sub    %edx,%eax
+}
+  801eaf:	5d                   	pop    %ebp
+  801eb0:	c3                   	ret
+
+00801eb1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801eb1:	55                   	push   %ebp
+  801eb2:	89 e5                	mov    %esp,%ebp
+  801eb4:	53                   	push   %ebx
+  801eb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ebb:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801ebe:	eb 09                	jmp    801ec9 <strncmp+0x18>
+		n--, p++, q++;
+  801ec0:	83 ea 01             	sub    $0x1,%edx
+  801ec3:	83 c0 01             	add    $0x1,%eax
+  801ec6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ec9:	85 d2                	test   %edx,%edx
+  801ecb:	74 18                	je     801ee5 <strncmp+0x34>
+  801ecd:	0f b6 18             	movzbl (%eax),%ebx
+  801ed0:	84 db                	test   %bl,%bl
+  801ed2:	74 04                	je     801ed8 <strncmp+0x27>
+  801ed4:	3a 19                	cmp    (%ecx),%bl
+  801ed6:	74 e8                	je     801ec0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ed8:	0f b6 00             	movzbl (%eax),%eax
+  801edb:	0f b6 11             	movzbl (%ecx),%edx
+  801ede:	29 d0                	sub    %edx,%eax
+}
+  801ee0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee3:	c9                   	leave
+  801ee4:	c3                   	ret
+		return 0;
+  801ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eea:	eb f4                	jmp    801ee0 <strncmp+0x2f>
+
+00801eec <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801eec:	55                   	push   %ebp
+  801eed:	89 e5                	mov    %esp,%ebp
+  801eef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801ef6:	eb 03                	jmp    801efb <strchr+0xf>
+  801ef8:	83 c0 01             	add    $0x1,%eax
+  801efb:	0f b6 10             	movzbl (%eax),%edx
+  801efe:	84 d2                	test   %dl,%dl
+  801f00:	74 06                	je     801f08 <strchr+0x1c>
+		if (*s == c)
+  801f02:	38 ca                	cmp    %cl,%dl
+  801f04:	75 f2                	jne    801ef8 <strchr+0xc>
+  801f06:	eb 05                	jmp    801f0d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f0d:	5d                   	pop    %ebp
+  801f0e:	c3                   	ret
+
+00801f0f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f0f:	55                   	push   %ebp
+  801f10:	89 e5                	mov    %esp,%ebp
+  801f12:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f15:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f19:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f1c:	38 ca                	cmp    %cl,%dl
+  801f1e:	74 09                	je     801f29 <strfind+0x1a>
+  801f20:	84 d2                	test   %dl,%dl
+  801f22:	74 05                	je     801f29 <strfind+0x1a>
+	for (; *s; s++)
+  801f24:	83 c0 01             	add    $0x1,%eax
+  801f27:	eb f0                	jmp    801f19 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f29:	5d                   	pop    %ebp
+  801f2a:	c3                   	ret
+
+00801f2b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	57                   	push   %edi
+  801f2f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f32:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f35:	85 c9                	test   %ecx,%ecx
+  801f37:	74 20                	je     801f59 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f39:	89 f8                	mov    %edi,%eax
+  801f3b:	09 c8                	or     %ecx,%eax
+  801f3d:	a8 03                	test   $0x3,%al
+  801f3f:	75 12                	jne    801f53 <memset+0x28>
+		c &= 0xFF;
+  801f41:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f45:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f4b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f4e:	fc                   	cld
+  801f4f:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f51:	eb 06                	jmp    801f59 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f53:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f56:	fc                   	cld
+  801f57:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f59:	89 f8                	mov    %edi,%eax
+  801f5b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f5e:	c9                   	leave
+  801f5f:	c3                   	ret
+
+00801f60 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f60:	55                   	push   %ebp
+  801f61:	89 e5                	mov    %esp,%ebp
+  801f63:	57                   	push   %edi
+  801f64:	56                   	push   %esi
+  801f65:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f68:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f6b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f6e:	39 c6                	cmp    %eax,%esi
+  801f70:	73 32                	jae    801fa4 <memmove+0x44>
+  801f72:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f75:	39 d0                	cmp    %edx,%eax
+  801f77:	73 2b                	jae    801fa4 <memmove+0x44>
+		s += n;
+		d += n;
+  801f79:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f7c:	89 d6                	mov    %edx,%esi
+  801f7e:	09 fe                	or     %edi,%esi
+  801f80:	09 ce                	or     %ecx,%esi
+  801f82:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f88:	75 0e                	jne    801f98 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f8a:	83 ef 04             	sub    $0x4,%edi
+  801f8d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f90:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f93:	fd                   	std
+  801f94:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f96:	eb 09                	jmp    801fa1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801f98:	83 ef 01             	sub    $0x1,%edi
+  801f9b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801f9e:	fd                   	std
+  801f9f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801fa1:	fc                   	cld
+  801fa2:	eb 1a                	jmp    801fbe <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fa4:	89 f2                	mov    %esi,%edx
+  801fa6:	09 c2                	or     %eax,%edx
+  801fa8:	09 ca                	or     %ecx,%edx
+  801faa:	f6 c2 03             	test   $0x3,%dl
+  801fad:	75 0a                	jne    801fb9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801faf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fb2:	89 c7                	mov    %eax,%edi
+  801fb4:	fc                   	cld
+  801fb5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fb7:	eb 05                	jmp    801fbe <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fb9:	89 c7                	mov    %eax,%edi
+  801fbb:	fc                   	cld
+  801fbc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fbe:	5e                   	pop    %esi
+  801fbf:	5f                   	pop    %edi
+  801fc0:	5d                   	pop    %ebp
+  801fc1:	c3                   	ret
+
+00801fc2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fc2:	55                   	push   %ebp
+  801fc3:	89 e5                	mov    %esp,%ebp
+  801fc5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fc8:	ff 75 10             	push   0x10(%ebp)
+  801fcb:	ff 75 0c             	push   0xc(%ebp)
+  801fce:	ff 75 08             	push   0x8(%ebp)
+  801fd1:	e8 8a ff ff ff       	call   801f60 <memmove>
+}
+  801fd6:	c9                   	leave
+  801fd7:	c3                   	ret
+
+00801fd8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	56                   	push   %esi
+  801fdc:	53                   	push   %ebx
+  801fdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fe3:	89 c6                	mov    %eax,%esi
+  801fe5:	03 75 10             	add    0x10(%ebp),%esi
+  801fe8:	eb 06                	jmp    801ff0 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801fea:	83 c0 01             	add    $0x1,%eax
+  801fed:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801ff0:	39 f0                	cmp    %esi,%eax
+  801ff2:	74 14                	je     802008 <memcmp+0x30>
+		if (*s1 != *s2)
+  801ff4:	0f b6 08             	movzbl (%eax),%ecx
+  801ff7:	0f b6 1a             	movzbl (%edx),%ebx
+  801ffa:	38 d9                	cmp    %bl,%cl
+  801ffc:	74 ec                	je     801fea <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801ffe:	0f b6 c1             	movzbl %cl,%eax
+  802001:	0f b6 db             	movzbl %bl,%ebx
+  802004:	29 d8                	sub    %ebx,%eax
+  802006:	eb 05                	jmp    80200d <memcmp+0x35>
+	}
+
+	return 0;
+  802008:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80200d:	5b                   	pop    %ebx
+  80200e:	5e                   	pop    %esi
+  80200f:	5d                   	pop    %ebp
+  802010:	c3                   	ret
+
+00802011 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802011:	55                   	push   %ebp
+  802012:	89 e5                	mov    %esp,%ebp
+  802014:	8b 45 08             	mov    0x8(%ebp),%eax
+  802017:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80201a:	89 c2                	mov    %eax,%edx
+  80201c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80201f:	eb 03                	jmp    802024 <memfind+0x13>
+  802021:	83 c0 01             	add    $0x1,%eax
+  802024:	39 d0                	cmp    %edx,%eax
+  802026:	73 04                	jae    80202c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802028:	38 08                	cmp    %cl,(%eax)
+  80202a:	75 f5                	jne    802021 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80202c:	5d                   	pop    %ebp
+  80202d:	c3                   	ret
+
+0080202e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80202e:	55                   	push   %ebp
+  80202f:	89 e5                	mov    %esp,%ebp
+  802031:	57                   	push   %edi
+  802032:	56                   	push   %esi
+  802033:	53                   	push   %ebx
+  802034:	8b 55 08             	mov    0x8(%ebp),%edx
+  802037:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80203a:	eb 03                	jmp    80203f <strtol+0x11>
+		s++;
+  80203c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80203f:	0f b6 02             	movzbl (%edx),%eax
+  802042:	3c 20                	cmp    $0x20,%al
+  802044:	74 f6                	je     80203c <strtol+0xe>
+  802046:	3c 09                	cmp    $0x9,%al
+  802048:	74 f2                	je     80203c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80204a:	3c 2b                	cmp    $0x2b,%al
+  80204c:	74 2a                	je     802078 <strtol+0x4a>
+	int neg = 0;
+  80204e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802053:	3c 2d                	cmp    $0x2d,%al
+  802055:	74 2b                	je     802082 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802057:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80205d:	75 0f                	jne    80206e <strtol+0x40>
+  80205f:	80 3a 30             	cmpb   $0x30,(%edx)
+  802062:	74 28                	je     80208c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802064:	85 db                	test   %ebx,%ebx
+  802066:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80206b:	0f 44 d8             	cmove  %eax,%ebx
+  80206e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802073:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802076:	eb 46                	jmp    8020be <strtol+0x90>
+		s++;
+  802078:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80207b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802080:	eb d5                	jmp    802057 <strtol+0x29>
+		s++, neg = 1;
+  802082:	83 c2 01             	add    $0x1,%edx
+  802085:	bf 01 00 00 00       	mov    $0x1,%edi
+  80208a:	eb cb                	jmp    802057 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80208c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802090:	74 0e                	je     8020a0 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802092:	85 db                	test   %ebx,%ebx
+  802094:	75 d8                	jne    80206e <strtol+0x40>
+		s++, base = 8;
+  802096:	83 c2 01             	add    $0x1,%edx
+  802099:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80209e:	eb ce                	jmp    80206e <strtol+0x40>
+		s += 2, base = 16;
+  8020a0:	83 c2 02             	add    $0x2,%edx
+  8020a3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020a8:	eb c4                	jmp    80206e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020aa:	0f be c0             	movsbl %al,%eax
+  8020ad:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020b0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020b3:	7d 3a                	jge    8020ef <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020b5:	83 c2 01             	add    $0x1,%edx
+  8020b8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020bc:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020be:	0f b6 02             	movzbl (%edx),%eax
+  8020c1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020c4:	89 f3                	mov    %esi,%ebx
+  8020c6:	80 fb 09             	cmp    $0x9,%bl
+  8020c9:	76 df                	jbe    8020aa <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020cb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020ce:	89 f3                	mov    %esi,%ebx
+  8020d0:	80 fb 19             	cmp    $0x19,%bl
+  8020d3:	77 08                	ja     8020dd <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020d5:	0f be c0             	movsbl %al,%eax
+  8020d8:	83 e8 57             	sub    $0x57,%eax
+  8020db:	eb d3                	jmp    8020b0 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020dd:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020e0:	89 f3                	mov    %esi,%ebx
+  8020e2:	80 fb 19             	cmp    $0x19,%bl
+  8020e5:	77 08                	ja     8020ef <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020e7:	0f be c0             	movsbl %al,%eax
+  8020ea:	83 e8 37             	sub    $0x37,%eax
+  8020ed:	eb c1                	jmp    8020b0 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020ef:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020f3:	74 05                	je     8020fa <strtol+0xcc>
+		*endptr = (char *) s;
+  8020f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020f8:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8020fa:	89 c8                	mov    %ecx,%eax
+  8020fc:	f7 d8                	neg    %eax
+  8020fe:	85 ff                	test   %edi,%edi
+  802100:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802103:	89 c8                	mov    %ecx,%eax
+  802105:	5b                   	pop    %ebx
+  802106:	5e                   	pop    %esi
+  802107:	5f                   	pop    %edi
+  802108:	5d                   	pop    %ebp
+  802109:	c3                   	ret
+
+0080210a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80210a:	55                   	push   %ebp
+  80210b:	89 e5                	mov    %esp,%ebp
+  80210d:	57                   	push   %edi
+  80210e:	56                   	push   %esi
+  80210f:	53                   	push   %ebx
+  802110:	83 ec 18             	sub    $0x18,%esp
+  802113:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802116:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802119:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80211c:	85 db                	test   %ebx,%ebx
+  80211e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802123:	0f 45 c3             	cmovne %ebx,%eax
+  802126:	50                   	push   %eax
+  802127:	e8 32 e4 ff ff       	call   80055e <sys_ipc_recv>
+
+	if (from_env_store)
+  80212c:	83 c4 10             	add    $0x10,%esp
+  80212f:	85 ff                	test   %edi,%edi
+  802131:	74 17                	je     80214a <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802133:	ba 00 00 00 00       	mov    $0x0,%edx
+  802138:	85 c0                	test   %eax,%eax
+  80213a:	75 0c                	jne    802148 <ipc_recv+0x3e>
+  80213c:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802142:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802148:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  80214a:	85 f6                	test   %esi,%esi
+  80214c:	74 2e                	je     80217c <ipc_recv+0x72>
+		if (!r && pg)
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	75 24                	jne    802176 <ipc_recv+0x6c>
+  802152:	85 db                	test   %ebx,%ebx
+  802154:	74 20                	je     802176 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802156:	a1 08 40 80 00       	mov    0x804008,%eax
+  80215b:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802161:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802163:	a1 08 40 80 00       	mov    0x804008,%eax
+  802168:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80216e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802171:	5b                   	pop    %ebx
+  802172:	5e                   	pop    %esi
+  802173:	5f                   	pop    %edi
+  802174:	5d                   	pop    %ebp
+  802175:	c3                   	ret
+			*perm_store = 0;
+  802176:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80217c:	85 c0                	test   %eax,%eax
+  80217e:	75 ee                	jne    80216e <ipc_recv+0x64>
+  802180:	eb e1                	jmp    802163 <ipc_recv+0x59>
+
+00802182 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802182:	55                   	push   %ebp
+  802183:	89 e5                	mov    %esp,%ebp
+  802185:	57                   	push   %edi
+  802186:	56                   	push   %esi
+  802187:	53                   	push   %ebx
+  802188:	83 ec 0c             	sub    $0xc,%esp
+  80218b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80218e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802191:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802194:	85 db                	test   %ebx,%ebx
+  802196:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80219b:	0f 44 d8             	cmove  %eax,%ebx
+  80219e:	ff 75 14             	push   0x14(%ebp)
+  8021a1:	53                   	push   %ebx
+  8021a2:	56                   	push   %esi
+  8021a3:	57                   	push   %edi
+  8021a4:	e8 92 e3 ff ff       	call   80053b <sys_ipc_try_send_yield>
+  8021a9:	83 c4 10             	add    $0x10,%esp
+  8021ac:	85 c0                	test   %eax,%eax
+  8021ae:	79 1e                	jns    8021ce <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8021b0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021b3:	75 07                	jne    8021bc <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8021b5:	e8 a1 df ff ff       	call   80015b <sys_yield>
+  8021ba:	eb e2                	jmp    80219e <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8021bc:	50                   	push   %eax
+  8021bd:	68 ff 2a 80 00       	push   $0x802aff
+  8021c2:	6a 3d                	push   $0x3d
+  8021c4:	68 14 2b 80 00       	push   $0x802b14
+  8021c9:	e8 43 f5 ff ff       	call   801711 <_panic>
+	}
+}
+  8021ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021d1:	5b                   	pop    %ebx
+  8021d2:	5e                   	pop    %esi
+  8021d3:	5f                   	pop    %edi
+  8021d4:	5d                   	pop    %ebp
+  8021d5:	c3                   	ret
+
+008021d6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8021d6:	55                   	push   %ebp
+  8021d7:	89 e5                	mov    %esp,%ebp
+  8021d9:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8021dc:	ff 75 08             	push   0x8(%ebp)
+  8021df:	e8 f7 de ff ff       	call   8000db <sys_env_find>
+}
+  8021e4:	c9                   	leave
+  8021e5:	c3                   	ret
+
+008021e6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8021e6:	55                   	push   %ebp
+  8021e7:	89 e5                	mov    %esp,%ebp
+  8021e9:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021ec:	89 c2                	mov    %eax,%edx
+  8021ee:	c1 ea 16             	shr    $0x16,%edx
+  8021f1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8021f8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021fd:	f6 c1 01             	test   $0x1,%cl
+  802200:	74 22                	je     802224 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802202:	c1 e8 0c             	shr    $0xc,%eax
+  802205:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80220c:	a8 01                	test   $0x1,%al
+  80220e:	74 14                	je     802224 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802210:	c1 e8 0c             	shr    $0xc,%eax
+  802213:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802216:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80221d:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802221:	0f b7 d2             	movzwl %dx,%edx
+}
+  802224:	89 d0                	mov    %edx,%eax
+  802226:	5d                   	pop    %ebp
+  802227:	c3                   	ret
+  802228:	66 90                	xchg   %ax,%ax
+  80222a:	66 90                	xchg   %ax,%ax
+  80222c:	66 90                	xchg   %ax,%ax
+  80222e:	66 90                	xchg   %ax,%ax
+
+00802230 <__udivmoddi4>:
+  802230:	55                   	push   %ebp
+  802231:	57                   	push   %edi
+  802232:	56                   	push   %esi
+  802233:	53                   	push   %ebx
+  802234:	83 ec 14             	sub    $0x14,%esp
+  802237:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80223b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80223f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802243:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802247:	89 f1                	mov    %esi,%ecx
+  802249:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80224d:	09 d9                	or     %ebx,%ecx
+  80224f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802253:	0f 84 92 00 00 00    	je     8022eb <__udivmoddi4+0xbb>
+  802259:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802260:	00 
+  802261:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802266:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80226d:	00 
+  80226e:	89 1c 24             	mov    %ebx,(%esp)
+  802271:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802275:	8d 76 00             	lea    0x0(%esi),%esi
+  802278:	89 e9                	mov    %ebp,%ecx
+  80227a:	89 c3                	mov    %eax,%ebx
+  80227c:	89 d6                	mov    %edx,%esi
+  80227e:	31 ff                	xor    %edi,%edi
+  802280:	d3 ee                	shr    %cl,%esi
+  802282:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802285:	f6 c1 20             	test   $0x20,%cl
+  802288:	0f 45 de             	cmovne %esi,%ebx
+  80228b:	0f 45 f7             	cmovne %edi,%esi
+  80228e:	8b 3c 24             	mov    (%esp),%edi
+  802291:	39 fb                	cmp    %edi,%ebx
+  802293:	89 f7                	mov    %esi,%edi
+  802295:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802299:	8b 1c 24             	mov    (%esp),%ebx
+  80229c:	19 f7                	sbb    %esi,%edi
+  80229e:	72 39                	jb     8022d9 <__udivmoddi4+0xa9>
+  8022a0:	89 e9                	mov    %ebp,%ecx
+  8022a2:	89 f7                	mov    %esi,%edi
+  8022a4:	89 de                	mov    %ebx,%esi
+  8022a6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8022a9:	d3 e6                	shl    %cl,%esi
+  8022ab:	31 db                	xor    %ebx,%ebx
+  8022ad:	f6 c1 20             	test   $0x20,%cl
+  8022b0:	0f 45 fe             	cmovne %esi,%edi
+  8022b3:	0f 45 f3             	cmovne %ebx,%esi
+  8022b6:	29 f0                	sub    %esi,%eax
+  8022b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022bd:	19 fa                	sbb    %edi,%edx
+  8022bf:	31 ff                	xor    %edi,%edi
+  8022c1:	31 db                	xor    %ebx,%ebx
+  8022c3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8022c6:	d3 e6                	shl    %cl,%esi
+  8022c8:	f6 c1 20             	test   $0x20,%cl
+  8022cb:	0f 45 fe             	cmovne %esi,%edi
+  8022ce:	0f 45 f3             	cmovne %ebx,%esi
+  8022d1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8022d5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8022d9:	83 ed 01             	sub    $0x1,%ebp
+  8022dc:	73 9a                	jae    802278 <__udivmoddi4+0x48>
+  8022de:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8022e2:	85 ff                	test   %edi,%edi
+  8022e4:	74 05                	je     8022eb <__udivmoddi4+0xbb>
+  8022e6:	89 07                	mov    %eax,(%edi)
+  8022e8:	89 57 04             	mov    %edx,0x4(%edi)
+  8022eb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022ef:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022f3:	83 c4 14             	add    $0x14,%esp
+  8022f6:	5b                   	pop    %ebx
+  8022f7:	5e                   	pop    %esi
+  8022f8:	5f                   	pop    %edi
+  8022f9:	5d                   	pop    %ebp
+  8022fa:	c3                   	ret
+  8022fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8022ff:	90                   	nop
+
+00802300 <__udivdi3>:
+  802300:	55                   	push   %ebp
+  802301:	57                   	push   %edi
+  802302:	56                   	push   %esi
+  802303:	53                   	push   %ebx
+  802304:	83 ec 14             	sub    $0x14,%esp
+  802307:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80230b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80230f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802313:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802317:	89 fb                	mov    %edi,%ebx
+  802319:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80231d:	09 f3                	or     %esi,%ebx
+  80231f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802323:	0f 84 85 00 00 00    	je     8023ae <__udivdi3+0xae>
+  802329:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802330:	00 
+  802331:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802336:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80233d:	00 
+  80233e:	89 34 24             	mov    %esi,(%esp)
+  802341:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802345:	8d 76 00             	lea    0x0(%esi),%esi
+  802348:	89 e9                	mov    %ebp,%ecx
+  80234a:	89 c3                	mov    %eax,%ebx
+  80234c:	89 d6                	mov    %edx,%esi
+  80234e:	31 ff                	xor    %edi,%edi
+  802350:	d3 ee                	shr    %cl,%esi
+  802352:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802355:	f6 c1 20             	test   $0x20,%cl
+  802358:	0f 45 de             	cmovne %esi,%ebx
+  80235b:	0f 45 f7             	cmovne %edi,%esi
+  80235e:	8b 3c 24             	mov    (%esp),%edi
+  802361:	39 fb                	cmp    %edi,%ebx
+  802363:	89 f7                	mov    %esi,%edi
+  802365:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802369:	8b 1c 24             	mov    (%esp),%ebx
+  80236c:	19 f7                	sbb    %esi,%edi
+  80236e:	72 39                	jb     8023a9 <__udivdi3+0xa9>
+  802370:	89 e9                	mov    %ebp,%ecx
+  802372:	89 f7                	mov    %esi,%edi
+  802374:	89 de                	mov    %ebx,%esi
+  802376:	0f a5 df             	shld   %cl,%ebx,%edi
+  802379:	d3 e6                	shl    %cl,%esi
+  80237b:	31 db                	xor    %ebx,%ebx
+  80237d:	f6 c1 20             	test   $0x20,%cl
+  802380:	0f 45 fe             	cmovne %esi,%edi
+  802383:	0f 45 f3             	cmovne %ebx,%esi
+  802386:	29 f0                	sub    %esi,%eax
+  802388:	be 01 00 00 00       	mov    $0x1,%esi
+  80238d:	19 fa                	sbb    %edi,%edx
+  80238f:	31 ff                	xor    %edi,%edi
+  802391:	31 db                	xor    %ebx,%ebx
+  802393:	0f a5 f7             	shld   %cl,%esi,%edi
+  802396:	d3 e6                	shl    %cl,%esi
+  802398:	f6 c1 20             	test   $0x20,%cl
+  80239b:	0f 45 fe             	cmovne %esi,%edi
+  80239e:	0f 45 f3             	cmovne %ebx,%esi
+  8023a1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023a5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023a9:	83 ed 01             	sub    $0x1,%ebp
+  8023ac:	73 9a                	jae    802348 <__udivdi3+0x48>
+  8023ae:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023b2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023b6:	83 c4 14             	add    $0x14,%esp
+  8023b9:	5b                   	pop    %ebx
+  8023ba:	5e                   	pop    %esi
+  8023bb:	5f                   	pop    %edi
+  8023bc:	5d                   	pop    %ebp
+  8023bd:	c3                   	ret
+  8023be:	66 90                	xchg   %ax,%ax
+
+008023c0 <__umoddi3>:
+  8023c0:	57                   	push   %edi
+  8023c1:	56                   	push   %esi
+  8023c2:	53                   	push   %ebx
+  8023c3:	83 ec 08             	sub    $0x8,%esp
+  8023c6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8023ca:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8023ce:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023d2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023d6:	89 f9                	mov    %edi,%ecx
+  8023d8:	89 34 24             	mov    %esi,(%esp)
+  8023db:	09 f1                	or     %esi,%ecx
+  8023dd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023e1:	74 53                	je     802436 <__umoddi3+0x76>
+  8023e3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023ef:	90                   	nop
+  8023f0:	89 c6                	mov    %eax,%esi
+  8023f2:	89 d7                	mov    %edx,%edi
+  8023f4:	31 db                	xor    %ebx,%ebx
+  8023f6:	d3 ef                	shr    %cl,%edi
+  8023f8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8023fb:	f6 c1 20             	test   $0x20,%cl
+  8023fe:	0f 45 f7             	cmovne %edi,%esi
+  802401:	0f 45 fb             	cmovne %ebx,%edi
+  802404:	8b 1c 24             	mov    (%esp),%ebx
+  802407:	39 de                	cmp    %ebx,%esi
+  802409:	89 fb                	mov    %edi,%ebx
+  80240b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80240f:	8b 34 24             	mov    (%esp),%esi
+  802412:	19 fb                	sbb    %edi,%ebx
+  802414:	72 14                	jb     80242a <__umoddi3+0x6a>
+  802416:	0f a5 f7             	shld   %cl,%esi,%edi
+  802419:	31 db                	xor    %ebx,%ebx
+  80241b:	d3 e6                	shl    %cl,%esi
+  80241d:	f6 c1 20             	test   $0x20,%cl
+  802420:	0f 45 fe             	cmovne %esi,%edi
+  802423:	0f 45 f3             	cmovne %ebx,%esi
+  802426:	29 f0                	sub    %esi,%eax
+  802428:	19 fa                	sbb    %edi,%edx
+  80242a:	83 e9 01             	sub    $0x1,%ecx
+  80242d:	73 c1                	jae    8023f0 <__umoddi3+0x30>
+  80242f:	83 c4 08             	add    $0x8,%esp
+  802432:	5b                   	pop    %ebx
+  802433:	5e                   	pop    %esi
+  802434:	5f                   	pop    %edi
+  802435:	c3                   	ret
+  802436:	83 c4 08             	add    $0x8,%esp
+  802439:	31 c0                	xor    %eax,%eax
+  80243b:	31 d2                	xor    %edx,%edx
+  80243d:	5b                   	pop    %ebx
+  80243e:	5e                   	pop    %esi
+  80243f:	5f                   	pop    %edi
+  802440:	c3                   	ret
+  802441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80244f:	90                   	nop
+
+00802450 <__divdi3>:
+  802450:	55                   	push   %ebp
+  802451:	57                   	push   %edi
+  802452:	56                   	push   %esi
+  802453:	53                   	push   %ebx
+  802454:	83 ec 1c             	sub    $0x1c,%esp
+  802457:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80245b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80245f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802463:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802467:	85 ff                	test   %edi,%edi
+  802469:	0f 88 da 00 00 00    	js     802549 <__divdi3+0xf9>
+  80246f:	85 db                	test   %ebx,%ebx
+  802471:	78 16                	js     802489 <__divdi3+0x39>
+  802473:	89 dd                	mov    %ebx,%ebp
+  802475:	89 c8                	mov    %ecx,%eax
+  802477:	89 da                	mov    %ebx,%edx
+  802479:	09 cd                	or     %ecx,%ebp
+  80247b:	0f 85 fd 00 00 00    	jne    80257e <__divdi3+0x12e>
+  802481:	83 c4 1c             	add    $0x1c,%esp
+  802484:	5b                   	pop    %ebx
+  802485:	5e                   	pop    %esi
+  802486:	5f                   	pop    %edi
+  802487:	5d                   	pop    %ebp
+  802488:	c3                   	ret
+  802489:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80248e:	f7 d9                	neg    %ecx
+  802490:	89 f0                	mov    %esi,%eax
+  802492:	89 fa                	mov    %edi,%edx
+  802494:	83 d3 00             	adc    $0x0,%ebx
+  802497:	89 0c 24             	mov    %ecx,(%esp)
+  80249a:	f7 db                	neg    %ebx
+  80249c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8024a0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024a7:	00 
+  8024a8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024ad:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024b4:	00 
+  8024b5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024b9:	89 cd                	mov    %ecx,%ebp
+  8024bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024bf:	90                   	nop
+  8024c0:	89 e9                	mov    %ebp,%ecx
+  8024c2:	89 c3                	mov    %eax,%ebx
+  8024c4:	89 d6                	mov    %edx,%esi
+  8024c6:	31 ff                	xor    %edi,%edi
+  8024c8:	d3 ee                	shr    %cl,%esi
+  8024ca:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024cd:	f6 c1 20             	test   $0x20,%cl
+  8024d0:	0f 45 de             	cmovne %esi,%ebx
+  8024d3:	0f 45 f7             	cmovne %edi,%esi
+  8024d6:	8b 3c 24             	mov    (%esp),%edi
+  8024d9:	39 fb                	cmp    %edi,%ebx
+  8024db:	89 f7                	mov    %esi,%edi
+  8024dd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8024e1:	8b 1c 24             	mov    (%esp),%ebx
+  8024e4:	19 f7                	sbb    %esi,%edi
+  8024e6:	72 39                	jb     802521 <__divdi3+0xd1>
+  8024e8:	89 e9                	mov    %ebp,%ecx
+  8024ea:	89 f7                	mov    %esi,%edi
+  8024ec:	89 de                	mov    %ebx,%esi
+  8024ee:	0f a5 df             	shld   %cl,%ebx,%edi
+  8024f1:	d3 e6                	shl    %cl,%esi
+  8024f3:	31 db                	xor    %ebx,%ebx
+  8024f5:	f6 c1 20             	test   $0x20,%cl
+  8024f8:	0f 45 fe             	cmovne %esi,%edi
+  8024fb:	0f 45 f3             	cmovne %ebx,%esi
+  8024fe:	29 f0                	sub    %esi,%eax
+  802500:	be 01 00 00 00       	mov    $0x1,%esi
+  802505:	19 fa                	sbb    %edi,%edx
+  802507:	31 ff                	xor    %edi,%edi
+  802509:	31 db                	xor    %ebx,%ebx
+  80250b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80250e:	d3 e6                	shl    %cl,%esi
+  802510:	f6 c1 20             	test   $0x20,%cl
+  802513:	0f 45 fe             	cmovne %esi,%edi
+  802516:	0f 45 f3             	cmovne %ebx,%esi
+  802519:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80251d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802521:	83 ed 01             	sub    $0x1,%ebp
+  802524:	73 9a                	jae    8024c0 <__divdi3+0x70>
+  802526:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80252a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80252e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802532:	85 ed                	test   %ebp,%ebp
+  802534:	0f 84 47 ff ff ff    	je     802481 <__divdi3+0x31>
+  80253a:	f7 d8                	neg    %eax
+  80253c:	83 d2 00             	adc    $0x0,%edx
+  80253f:	83 c4 1c             	add    $0x1c,%esp
+  802542:	5b                   	pop    %ebx
+  802543:	f7 da                	neg    %edx
+  802545:	5e                   	pop    %esi
+  802546:	5f                   	pop    %edi
+  802547:	5d                   	pop    %ebp
+  802548:	c3                   	ret
+  802549:	f7 de                	neg    %esi
+  80254b:	83 d7 00             	adc    $0x0,%edi
+  80254e:	f7 df                	neg    %edi
+  802550:	85 db                	test   %ebx,%ebx
+  802552:	78 23                	js     802577 <__divdi3+0x127>
+  802554:	89 dd                	mov    %ebx,%ebp
+  802556:	89 c8                	mov    %ecx,%eax
+  802558:	89 da                	mov    %ebx,%edx
+  80255a:	09 cd                	or     %ecx,%ebp
+  80255c:	0f 84 1f ff ff ff    	je     802481 <__divdi3+0x31>
+  802562:	89 0c 24             	mov    %ecx,(%esp)
+  802565:	89 f0                	mov    %esi,%eax
+  802567:	89 fa                	mov    %edi,%edx
+  802569:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80256e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802572:	e9 29 ff ff ff       	jmp    8024a0 <__divdi3+0x50>
+  802577:	31 ed                	xor    %ebp,%ebp
+  802579:	e9 10 ff ff ff       	jmp    80248e <__divdi3+0x3e>
+  80257e:	89 0c 24             	mov    %ecx,(%esp)
+  802581:	89 f0                	mov    %esi,%eax
+  802583:	89 fa                	mov    %edi,%edx
+  802585:	31 ed                	xor    %ebp,%ebp
+  802587:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80258b:	e9 10 ff ff ff       	jmp    8024a0 <__divdi3+0x50>
+
+00802590 <__moddi3>:
+  802590:	55                   	push   %ebp
+  802591:	57                   	push   %edi
+  802592:	56                   	push   %esi
+  802593:	53                   	push   %ebx
+  802594:	83 ec 14             	sub    $0x14,%esp
+  802597:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80259b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80259f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8025a3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8025a7:	85 d2                	test   %edx,%edx
+  8025a9:	0f 88 9b 00 00 00    	js     80264a <__moddi3+0xba>
+  8025af:	89 f7                	mov    %esi,%edi
+  8025b1:	31 ed                	xor    %ebp,%ebp
+  8025b3:	09 cf                	or     %ecx,%edi
+  8025b5:	0f 84 83 00 00 00    	je     80263e <__moddi3+0xae>
+  8025bb:	89 cb                	mov    %ecx,%ebx
+  8025bd:	89 f7                	mov    %esi,%edi
+  8025bf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8025c3:	f7 db                	neg    %ebx
+  8025c5:	83 d7 00             	adc    $0x0,%edi
+  8025c8:	f7 df                	neg    %edi
+  8025ca:	0f 49 f7             	cmovns %edi,%esi
+  8025cd:	0f 49 cb             	cmovns %ebx,%ecx
+  8025d0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025d4:	89 0c 24             	mov    %ecx,(%esp)
+  8025d7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025dc:	89 cd                	mov    %ecx,%ebp
+  8025de:	66 90                	xchg   %ax,%ax
+  8025e0:	89 e9                	mov    %ebp,%ecx
+  8025e2:	89 c3                	mov    %eax,%ebx
+  8025e4:	89 d6                	mov    %edx,%esi
+  8025e6:	31 ff                	xor    %edi,%edi
+  8025e8:	d3 ee                	shr    %cl,%esi
+  8025ea:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025ed:	f6 c1 20             	test   $0x20,%cl
+  8025f0:	0f 45 de             	cmovne %esi,%ebx
+  8025f3:	0f 45 f7             	cmovne %edi,%esi
+  8025f6:	8b 3c 24             	mov    (%esp),%edi
+  8025f9:	39 fb                	cmp    %edi,%ebx
+  8025fb:	89 f7                	mov    %esi,%edi
+  8025fd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802601:	8b 1c 24             	mov    (%esp),%ebx
+  802604:	19 f7                	sbb    %esi,%edi
+  802606:	72 1a                	jb     802622 <__moddi3+0x92>
+  802608:	89 e9                	mov    %ebp,%ecx
+  80260a:	89 f7                	mov    %esi,%edi
+  80260c:	89 de                	mov    %ebx,%esi
+  80260e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802611:	d3 e6                	shl    %cl,%esi
+  802613:	31 db                	xor    %ebx,%ebx
+  802615:	f6 c1 20             	test   $0x20,%cl
+  802618:	0f 45 fe             	cmovne %esi,%edi
+  80261b:	0f 45 f3             	cmovne %ebx,%esi
+  80261e:	29 f0                	sub    %esi,%eax
+  802620:	19 fa                	sbb    %edi,%edx
+  802622:	83 ed 01             	sub    $0x1,%ebp
+  802625:	73 b9                	jae    8025e0 <__moddi3+0x50>
+  802627:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80262b:	85 ed                	test   %ebp,%ebp
+  80262d:	74 07                	je     802636 <__moddi3+0xa6>
+  80262f:	f7 d8                	neg    %eax
+  802631:	83 d2 00             	adc    $0x0,%edx
+  802634:	f7 da                	neg    %edx
+  802636:	83 c4 14             	add    $0x14,%esp
+  802639:	5b                   	pop    %ebx
+  80263a:	5e                   	pop    %esi
+  80263b:	5f                   	pop    %edi
+  80263c:	5d                   	pop    %ebp
+  80263d:	c3                   	ret
+  80263e:	83 c4 14             	add    $0x14,%esp
+  802641:	31 c0                	xor    %eax,%eax
+  802643:	31 d2                	xor    %edx,%edx
+  802645:	5b                   	pop    %ebx
+  802646:	5e                   	pop    %esi
+  802647:	5f                   	pop    %edi
+  802648:	5d                   	pop    %ebp
+  802649:	c3                   	ret
+  80264a:	89 f7                	mov    %esi,%edi
+  80264c:	09 cf                	or     %ecx,%edi
+  80264e:	74 11                	je     802661 <__moddi3+0xd1>
+  802650:	f7 d8                	neg    %eax
+  802652:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802657:	83 d2 00             	adc    $0x0,%edx
+  80265a:	f7 da                	neg    %edx
+  80265c:	e9 5a ff ff ff       	jmp    8025bb <__moddi3+0x2b>
+  802661:	31 c0                	xor    %eax,%eax
+  802663:	31 d2                	xor    %edx,%edx
+  802665:	eb c8                	jmp    80262f <__moddi3+0x9f>
@@ -0,0 +1,6142 @@
+
+obj/user/forktree.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b2 00 00 00       	call   8000e3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <forktree>:
+	}
+}
+
+void
+forktree(const char *cur)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80003d:	e8 52 0b 00 00       	call   800b94 <sys_getenvid>
+  800042:	83 ec 04             	sub    $0x4,%esp
+  800045:	53                   	push   %ebx
+  800046:	50                   	push   %eax
+  800047:	68 00 2b 80 00       	push   $0x802b00
+  80004c:	e8 87 01 00 00       	call   8001d8 <cprintf>
+
+	forkchild(cur, '0');
+  800051:	83 c4 08             	add    $0x8,%esp
+  800054:	6a 30                	push   $0x30
+  800056:	53                   	push   %ebx
+  800057:	e8 13 00 00 00       	call   80006f <forkchild>
+	forkchild(cur, '1');
+  80005c:	83 c4 08             	add    $0x8,%esp
+  80005f:	6a 31                	push   $0x31
+  800061:	53                   	push   %ebx
+  800062:	e8 08 00 00 00       	call   80006f <forkchild>
+}
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80006d:	c9                   	leave
+  80006e:	c3                   	ret
+
+0080006f <forkchild>:
+{
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	83 ec 1c             	sub    $0x1c,%esp
+  800077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (strlen(cur) >= DEPTH)
+  80007d:	53                   	push   %ebx
+  80007e:	e8 08 07 00 00       	call   80078b <strlen>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 f8 02             	cmp    $0x2,%eax
+  800089:	7e 07                	jle    800092 <forkchild+0x23>
+}
+  80008b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008e:	5b                   	pop    %ebx
+  80008f:	5e                   	pop    %esi
+  800090:	5d                   	pop    %ebp
+  800091:	c3                   	ret
+	snprintf(nxt, DEPTH+1, "%s%c", cur, branch);
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	89 f0                	mov    %esi,%eax
+  800097:	0f be f0             	movsbl %al,%esi
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	68 11 2b 80 00       	push   $0x802b11
+  8000a1:	6a 04                	push   $0x4
+  8000a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a6:	50                   	push   %eax
+  8000a7:	e8 c5 06 00 00       	call   800771 <snprintf>
+	if (fork() == 0) {
+  8000ac:	83 c4 20             	add    $0x20,%esp
+  8000af:	e8 7f 10 00 00       	call   801133 <fork>
+  8000b4:	85 c0                	test   %eax,%eax
+  8000b6:	75 d3                	jne    80008b <forkchild+0x1c>
+		forktree(nxt);
+  8000b8:	83 ec 0c             	sub    $0xc,%esp
+  8000bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000be:	50                   	push   %eax
+  8000bf:	e8 6f ff ff ff       	call   800033 <forktree>
+		exit();
+  8000c4:	e8 60 00 00 00       	call   800129 <exit>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	eb bd                	jmp    80008b <forkchild+0x1c>
+
+008000ce <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 14             	sub    $0x14,%esp
+	forktree("");
+  8000d4:	68 10 2b 80 00       	push   $0x802b10
+  8000d9:	e8 55 ff ff ff       	call   800033 <forktree>
+}
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	56                   	push   %esi
+  8000e7:	53                   	push   %ebx
+  8000e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000ee:	e8 a1 0a 00 00       	call   800b94 <sys_getenvid>
+  8000f3:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000f8:	c1 e0 09             	shl    $0x9,%eax
+  8000fb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800100:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800105:	85 db                	test   %ebx,%ebx
+  800107:	7e 07                	jle    800110 <libmain+0x2d>
+		binaryname = argv[0];
+  800109:	8b 06                	mov    (%esi),%eax
+  80010b:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800110:	83 ec 08             	sub    $0x8,%esp
+  800113:	56                   	push   %esi
+  800114:	53                   	push   %ebx
+  800115:	e8 b4 ff ff ff       	call   8000ce <umain>
+
+	// exit gracefully
+	exit();
+  80011a:	e8 0a 00 00 00       	call   800129 <exit>
+}
+  80011f:	83 c4 10             	add    $0x10,%esp
+  800122:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800125:	5b                   	pop    %ebx
+  800126:	5e                   	pop    %esi
+  800127:	5d                   	pop    %ebp
+  800128:	c3                   	ret
+
+00800129 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800129:	55                   	push   %ebp
+  80012a:	89 e5                	mov    %esp,%ebp
+  80012c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80012f:	e8 5a 14 00 00       	call   80158e <close_all>
+	sys_env_destroy(0);
+  800134:	83 ec 0c             	sub    $0xc,%esp
+  800137:	6a 00                	push   $0x0
+  800139:	e8 15 0a 00 00       	call   800b53 <sys_env_destroy>
+}
+  80013e:	83 c4 10             	add    $0x10,%esp
+  800141:	c9                   	leave
+  800142:	c3                   	ret
+
+00800143 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800143:	55                   	push   %ebp
+  800144:	89 e5                	mov    %esp,%ebp
+  800146:	53                   	push   %ebx
+  800147:	83 ec 04             	sub    $0x4,%esp
+  80014a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80014d:	8b 13                	mov    (%ebx),%edx
+  80014f:	8d 42 01             	lea    0x1(%edx),%eax
+  800152:	89 03                	mov    %eax,(%ebx)
+  800154:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800157:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80015b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800160:	74 09                	je     80016b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800162:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800166:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800169:	c9                   	leave
+  80016a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80016b:	83 ec 08             	sub    $0x8,%esp
+  80016e:	68 ff 00 00 00       	push   $0xff
+  800173:	8d 43 08             	lea    0x8(%ebx),%eax
+  800176:	50                   	push   %eax
+  800177:	e8 7a 09 00 00       	call   800af6 <sys_cputs>
+		b->idx = 0;
+  80017c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800182:	83 c4 10             	add    $0x10,%esp
+  800185:	eb db                	jmp    800162 <putch+0x1f>
+
+00800187 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800187:	55                   	push   %ebp
+  800188:	89 e5                	mov    %esp,%ebp
+  80018a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800190:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800197:	00 00 00 
+	b.cnt = 0;
+  80019a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001a1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001a4:	ff 75 0c             	push   0xc(%ebp)
+  8001a7:	ff 75 08             	push   0x8(%ebp)
+  8001aa:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001b0:	50                   	push   %eax
+  8001b1:	68 43 01 80 00       	push   $0x800143
+  8001b6:	e8 14 01 00 00       	call   8002cf <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001bb:	83 c4 08             	add    $0x8,%esp
+  8001be:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001c4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ca:	50                   	push   %eax
+  8001cb:	e8 26 09 00 00       	call   800af6 <sys_cputs>
+
+	return b.cnt;
+}
+  8001d0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001d6:	c9                   	leave
+  8001d7:	c3                   	ret
+
+008001d8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001d8:	55                   	push   %ebp
+  8001d9:	89 e5                	mov    %esp,%ebp
+  8001db:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001de:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001e1:	50                   	push   %eax
+  8001e2:	ff 75 08             	push   0x8(%ebp)
+  8001e5:	e8 9d ff ff ff       	call   800187 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ea:	c9                   	leave
+  8001eb:	c3                   	ret
+
+008001ec <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001ec:	55                   	push   %ebp
+  8001ed:	89 e5                	mov    %esp,%ebp
+  8001ef:	57                   	push   %edi
+  8001f0:	56                   	push   %esi
+  8001f1:	53                   	push   %ebx
+  8001f2:	83 ec 1c             	sub    $0x1c,%esp
+  8001f5:	89 c7                	mov    %eax,%edi
+  8001f7:	89 d6                	mov    %edx,%esi
+  8001f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001ff:	89 d1                	mov    %edx,%ecx
+  800201:	89 c2                	mov    %eax,%edx
+  800203:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800206:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800209:	8b 45 10             	mov    0x10(%ebp),%eax
+  80020c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80020f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800212:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800219:	39 c2                	cmp    %eax,%edx
+  80021b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80021e:	72 3e                	jb     80025e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800220:	83 ec 0c             	sub    $0xc,%esp
+  800223:	ff 75 18             	push   0x18(%ebp)
+  800226:	83 eb 01             	sub    $0x1,%ebx
+  800229:	53                   	push   %ebx
+  80022a:	50                   	push   %eax
+  80022b:	83 ec 08             	sub    $0x8,%esp
+  80022e:	ff 75 e4             	push   -0x1c(%ebp)
+  800231:	ff 75 e0             	push   -0x20(%ebp)
+  800234:	ff 75 dc             	push   -0x24(%ebp)
+  800237:	ff 75 d8             	push   -0x28(%ebp)
+  80023a:	e8 51 25 00 00       	call   802790 <__udivdi3>
+  80023f:	83 c4 18             	add    $0x18,%esp
+  800242:	52                   	push   %edx
+  800243:	50                   	push   %eax
+  800244:	89 f2                	mov    %esi,%edx
+  800246:	89 f8                	mov    %edi,%eax
+  800248:	e8 9f ff ff ff       	call   8001ec <printnum>
+  80024d:	83 c4 20             	add    $0x20,%esp
+  800250:	eb 13                	jmp    800265 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800252:	83 ec 08             	sub    $0x8,%esp
+  800255:	56                   	push   %esi
+  800256:	ff 75 18             	push   0x18(%ebp)
+  800259:	ff d7                	call   *%edi
+  80025b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80025e:	83 eb 01             	sub    $0x1,%ebx
+  800261:	85 db                	test   %ebx,%ebx
+  800263:	7f ed                	jg     800252 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800265:	83 ec 08             	sub    $0x8,%esp
+  800268:	56                   	push   %esi
+  800269:	83 ec 04             	sub    $0x4,%esp
+  80026c:	ff 75 e4             	push   -0x1c(%ebp)
+  80026f:	ff 75 e0             	push   -0x20(%ebp)
+  800272:	ff 75 dc             	push   -0x24(%ebp)
+  800275:	ff 75 d8             	push   -0x28(%ebp)
+  800278:	e8 d3 25 00 00       	call   802850 <__umoddi3>
+  80027d:	83 c4 14             	add    $0x14,%esp
+  800280:	0f be 80 20 2b 80 00 	movsbl 0x802b20(%eax),%eax
+  800287:	50                   	push   %eax
+  800288:	ff d7                	call   *%edi
+}
+  80028a:	83 c4 10             	add    $0x10,%esp
+  80028d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800290:	5b                   	pop    %ebx
+  800291:	5e                   	pop    %esi
+  800292:	5f                   	pop    %edi
+  800293:	5d                   	pop    %ebp
+  800294:	c3                   	ret
+
+00800295 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800295:	55                   	push   %ebp
+  800296:	89 e5                	mov    %esp,%ebp
+  800298:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80029b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80029f:	8b 10                	mov    (%eax),%edx
+  8002a1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002a4:	73 0a                	jae    8002b0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002a6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002a9:	89 08                	mov    %ecx,(%eax)
+  8002ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ae:	88 02                	mov    %al,(%edx)
+}
+  8002b0:	5d                   	pop    %ebp
+  8002b1:	c3                   	ret
+
+008002b2 <printfmt>:
+{
+  8002b2:	55                   	push   %ebp
+  8002b3:	89 e5                	mov    %esp,%ebp
+  8002b5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002b8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002bb:	50                   	push   %eax
+  8002bc:	ff 75 10             	push   0x10(%ebp)
+  8002bf:	ff 75 0c             	push   0xc(%ebp)
+  8002c2:	ff 75 08             	push   0x8(%ebp)
+  8002c5:	e8 05 00 00 00       	call   8002cf <vprintfmt>
+}
+  8002ca:	83 c4 10             	add    $0x10,%esp
+  8002cd:	c9                   	leave
+  8002ce:	c3                   	ret
+
+008002cf <vprintfmt>:
+{
+  8002cf:	55                   	push   %ebp
+  8002d0:	89 e5                	mov    %esp,%ebp
+  8002d2:	57                   	push   %edi
+  8002d3:	56                   	push   %esi
+  8002d4:	53                   	push   %ebx
+  8002d5:	83 ec 2c             	sub    $0x2c,%esp
+  8002d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002de:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002e1:	eb 0a                	jmp    8002ed <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002e3:	83 ec 08             	sub    $0x8,%esp
+  8002e6:	53                   	push   %ebx
+  8002e7:	50                   	push   %eax
+  8002e8:	ff d6                	call   *%esi
+  8002ea:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ed:	83 c7 01             	add    $0x1,%edi
+  8002f0:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002f4:	83 f8 25             	cmp    $0x25,%eax
+  8002f7:	74 0c                	je     800305 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002f9:	85 c0                	test   %eax,%eax
+  8002fb:	75 e6                	jne    8002e3 <vprintfmt+0x14>
+}
+  8002fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800300:	5b                   	pop    %ebx
+  800301:	5e                   	pop    %esi
+  800302:	5f                   	pop    %edi
+  800303:	5d                   	pop    %ebp
+  800304:	c3                   	ret
+		padc = ' ';
+  800305:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800309:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800310:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800317:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80031e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800323:	8d 47 01             	lea    0x1(%edi),%eax
+  800326:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800329:	0f b6 17             	movzbl (%edi),%edx
+  80032c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80032f:	3c 55                	cmp    $0x55,%al
+  800331:	0f 87 cf 03 00 00    	ja     800706 <vprintfmt+0x437>
+  800337:	0f b6 c0             	movzbl %al,%eax
+  80033a:	ff 24 85 60 2c 80 00 	jmp    *0x802c60(,%eax,4)
+  800341:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800344:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800348:	eb d9                	jmp    800323 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80034a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80034d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800351:	eb d0                	jmp    800323 <vprintfmt+0x54>
+  800353:	0f b6 d2             	movzbl %dl,%edx
+  800356:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800359:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800361:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800364:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800368:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80036b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80036e:	83 f9 09             	cmp    $0x9,%ecx
+  800371:	77 55                	ja     8003c8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800373:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800376:	eb e9                	jmp    800361 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800378:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037b:	8b 00                	mov    (%eax),%eax
+  80037d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800380:	8b 45 14             	mov    0x14(%ebp),%eax
+  800383:	8d 40 04             	lea    0x4(%eax),%eax
+  800386:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800389:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80038c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800390:	79 91                	jns    800323 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800392:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800395:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800398:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80039f:	eb 82                	jmp    800323 <vprintfmt+0x54>
+			if (width < 0)
+  8003a1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003a4:	85 d2                	test   %edx,%edx
+  8003a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ab:	0f 49 c2             	cmovns %edx,%eax
+  8003ae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b4:	e9 6a ff ff ff       	jmp    800323 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003bc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003c3:	e9 5b ff ff ff       	jmp    800323 <vprintfmt+0x54>
+  8003c8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003cb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ce:	eb bc                	jmp    80038c <vprintfmt+0xbd>
+			lflag++;
+  8003d0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d6:	e9 48 ff ff ff       	jmp    800323 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003de:	8d 78 04             	lea    0x4(%eax),%edi
+  8003e1:	83 ec 08             	sub    $0x8,%esp
+  8003e4:	53                   	push   %ebx
+  8003e5:	ff 30                	push   (%eax)
+  8003e7:	ff d6                	call   *%esi
+			break;
+  8003e9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003ec:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003ef:	e9 b1 02 00 00       	jmp    8006a5 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f7:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003fa:	8b 10                	mov    (%eax),%edx
+  8003fc:	89 d0                	mov    %edx,%eax
+  8003fe:	f7 d8                	neg    %eax
+  800400:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800403:	83 f8 0f             	cmp    $0xf,%eax
+  800406:	7f 23                	jg     80042b <vprintfmt+0x15c>
+  800408:	8b 14 85 c0 2d 80 00 	mov    0x802dc0(,%eax,4),%edx
+  80040f:	85 d2                	test   %edx,%edx
+  800411:	74 18                	je     80042b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800413:	52                   	push   %edx
+  800414:	68 e9 2f 80 00       	push   $0x802fe9
+  800419:	53                   	push   %ebx
+  80041a:	56                   	push   %esi
+  80041b:	e8 92 fe ff ff       	call   8002b2 <printfmt>
+  800420:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800423:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800426:	e9 7a 02 00 00       	jmp    8006a5 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80042b:	50                   	push   %eax
+  80042c:	68 38 2b 80 00       	push   $0x802b38
+  800431:	53                   	push   %ebx
+  800432:	56                   	push   %esi
+  800433:	e8 7a fe ff ff       	call   8002b2 <printfmt>
+  800438:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80043e:	e9 62 02 00 00       	jmp    8006a5 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800443:	8b 45 14             	mov    0x14(%ebp),%eax
+  800446:	83 c0 04             	add    $0x4,%eax
+  800449:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80044c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800451:	85 c9                	test   %ecx,%ecx
+  800453:	b8 31 2b 80 00       	mov    $0x802b31,%eax
+  800458:	0f 45 c1             	cmovne %ecx,%eax
+  80045b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80045e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800462:	7e 06                	jle    80046a <vprintfmt+0x19b>
+  800464:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800468:	75 0b                	jne    800475 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80046a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80046d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800470:	89 75 08             	mov    %esi,0x8(%ebp)
+  800473:	eb 5c                	jmp    8004d1 <vprintfmt+0x202>
+  800475:	83 ec 08             	sub    $0x8,%esp
+  800478:	ff 75 d0             	push   -0x30(%ebp)
+  80047b:	ff 75 cc             	push   -0x34(%ebp)
+  80047e:	e8 20 03 00 00       	call   8007a3 <strnlen>
+  800483:	89 c2                	mov    %eax,%edx
+  800485:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800488:	29 d0                	sub    %edx,%eax
+  80048a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80048d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800491:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800494:	89 75 08             	mov    %esi,0x8(%ebp)
+  800497:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800499:	eb 0e                	jmp    8004a9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80049b:	83 ec 08             	sub    $0x8,%esp
+  80049e:	53                   	push   %ebx
+  80049f:	57                   	push   %edi
+  8004a0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004a3:	83 ee 01             	sub    $0x1,%esi
+  8004a6:	83 c4 10             	add    $0x10,%esp
+  8004a9:	85 f6                	test   %esi,%esi
+  8004ab:	7f ee                	jg     80049b <vprintfmt+0x1cc>
+  8004ad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004b3:	85 c0                	test   %eax,%eax
+  8004b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004ba:	0f 49 d0             	cmovns %eax,%edx
+  8004bd:	29 d0                	sub    %edx,%eax
+  8004bf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c2:	eb a6                	jmp    80046a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004c4:	83 ec 08             	sub    $0x8,%esp
+  8004c7:	53                   	push   %ebx
+  8004c8:	52                   	push   %edx
+  8004c9:	ff 55 08             	call   *0x8(%ebp)
+  8004cc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004cf:	89 f1                	mov    %esi,%ecx
+  8004d1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004d4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004d8:	0f be d0             	movsbl %al,%edx
+  8004db:	85 d2                	test   %edx,%edx
+  8004dd:	74 28                	je     800507 <vprintfmt+0x238>
+  8004df:	85 ff                	test   %edi,%edi
+  8004e1:	78 05                	js     8004e8 <vprintfmt+0x219>
+  8004e3:	83 ef 01             	sub    $0x1,%edi
+  8004e6:	78 30                	js     800518 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004e8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004ec:	74 d6                	je     8004c4 <vprintfmt+0x1f5>
+  8004ee:	0f be c0             	movsbl %al,%eax
+  8004f1:	83 e8 20             	sub    $0x20,%eax
+  8004f4:	83 f8 5e             	cmp    $0x5e,%eax
+  8004f7:	76 cb                	jbe    8004c4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004f9:	83 ec 08             	sub    $0x8,%esp
+  8004fc:	53                   	push   %ebx
+  8004fd:	6a 3f                	push   $0x3f
+  8004ff:	ff 55 08             	call   *0x8(%ebp)
+  800502:	83 c4 10             	add    $0x10,%esp
+  800505:	eb c8                	jmp    8004cf <vprintfmt+0x200>
+  800507:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80050d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800510:	01 d0                	add    %edx,%eax
+  800512:	29 c8                	sub    %ecx,%eax
+  800514:	89 c7                	mov    %eax,%edi
+  800516:	eb 13                	jmp    80052b <vprintfmt+0x25c>
+  800518:	8b 75 08             	mov    0x8(%ebp),%esi
+  80051b:	eb ed                	jmp    80050a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80051d:	83 ec 08             	sub    $0x8,%esp
+  800520:	53                   	push   %ebx
+  800521:	6a 20                	push   $0x20
+  800523:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800525:	83 ef 01             	sub    $0x1,%edi
+  800528:	83 c4 10             	add    $0x10,%esp
+  80052b:	85 ff                	test   %edi,%edi
+  80052d:	7f ee                	jg     80051d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80052f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800532:	89 45 14             	mov    %eax,0x14(%ebp)
+  800535:	e9 6b 01 00 00       	jmp    8006a5 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80053a:	83 f9 01             	cmp    $0x1,%ecx
+  80053d:	7f 1f                	jg     80055e <vprintfmt+0x28f>
+	else if (lflag)
+  80053f:	85 c9                	test   %ecx,%ecx
+  800541:	74 67                	je     8005aa <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800543:	8b 45 14             	mov    0x14(%ebp),%eax
+  800546:	8b 00                	mov    (%eax),%eax
+  800548:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80054b:	89 c1                	mov    %eax,%ecx
+  80054d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800550:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800553:	8b 45 14             	mov    0x14(%ebp),%eax
+  800556:	8d 40 04             	lea    0x4(%eax),%eax
+  800559:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055c:	eb 17                	jmp    800575 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80055e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800561:	8b 50 04             	mov    0x4(%eax),%edx
+  800564:	8b 00                	mov    (%eax),%eax
+  800566:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800569:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80056c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056f:	8d 40 08             	lea    0x8(%eax),%eax
+  800572:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800575:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800578:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80057b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800580:	85 c9                	test   %ecx,%ecx
+  800582:	0f 89 03 01 00 00    	jns    80068b <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	53                   	push   %ebx
+  80058c:	6a 2d                	push   $0x2d
+  80058e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800590:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800593:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800596:	f7 da                	neg    %edx
+  800598:	83 d1 00             	adc    $0x0,%ecx
+  80059b:	f7 d9                	neg    %ecx
+  80059d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005a0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005a5:	e9 e1 00 00 00       	jmp    80068b <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8b 00                	mov    (%eax),%eax
+  8005af:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b2:	89 c1                	mov    %eax,%ecx
+  8005b4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005b7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c3:	eb b0                	jmp    800575 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005c5:	83 f9 01             	cmp    $0x1,%ecx
+  8005c8:	7f 1e                	jg     8005e8 <vprintfmt+0x319>
+	else if (lflag)
+  8005ca:	85 c9                	test   %ecx,%ecx
+  8005cc:	74 32                	je     800600 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d1:	8b 10                	mov    (%eax),%edx
+  8005d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005de:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005e3:	e9 a3 00 00 00       	jmp    80068b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005eb:	8b 10                	mov    (%eax),%edx
+  8005ed:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005f0:	8d 40 08             	lea    0x8(%eax),%eax
+  8005f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005fb:	e9 8b 00 00 00       	jmp    80068b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800600:	8b 45 14             	mov    0x14(%ebp),%eax
+  800603:	8b 10                	mov    (%eax),%edx
+  800605:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80060a:	8d 40 04             	lea    0x4(%eax),%eax
+  80060d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800610:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800615:	eb 74                	jmp    80068b <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800617:	83 f9 01             	cmp    $0x1,%ecx
+  80061a:	7f 1b                	jg     800637 <vprintfmt+0x368>
+	else if (lflag)
+  80061c:	85 c9                	test   %ecx,%ecx
+  80061e:	74 2c                	je     80064c <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8b 10                	mov    (%eax),%edx
+  800625:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062a:	8d 40 04             	lea    0x4(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800630:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800635:	eb 54                	jmp    80068b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800637:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063a:	8b 10                	mov    (%eax),%edx
+  80063c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80063f:	8d 40 08             	lea    0x8(%eax),%eax
+  800642:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800645:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80064a:	eb 3f                	jmp    80068b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8b 10                	mov    (%eax),%edx
+  800651:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800656:	8d 40 04             	lea    0x4(%eax),%eax
+  800659:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80065c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800661:	eb 28                	jmp    80068b <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800663:	83 ec 08             	sub    $0x8,%esp
+  800666:	53                   	push   %ebx
+  800667:	6a 30                	push   $0x30
+  800669:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80066b:	83 c4 08             	add    $0x8,%esp
+  80066e:	53                   	push   %ebx
+  80066f:	6a 78                	push   $0x78
+  800671:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8b 10                	mov    (%eax),%edx
+  800678:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80067d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800680:	8d 40 04             	lea    0x4(%eax),%eax
+  800683:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800686:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80068b:	83 ec 0c             	sub    $0xc,%esp
+  80068e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800692:	50                   	push   %eax
+  800693:	ff 75 e0             	push   -0x20(%ebp)
+  800696:	57                   	push   %edi
+  800697:	51                   	push   %ecx
+  800698:	52                   	push   %edx
+  800699:	89 da                	mov    %ebx,%edx
+  80069b:	89 f0                	mov    %esi,%eax
+  80069d:	e8 4a fb ff ff       	call   8001ec <printnum>
+			break;
+  8006a2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006a8:	e9 40 fc ff ff       	jmp    8002ed <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006ad:	83 f9 01             	cmp    $0x1,%ecx
+  8006b0:	7f 1b                	jg     8006cd <vprintfmt+0x3fe>
+	else if (lflag)
+  8006b2:	85 c9                	test   %ecx,%ecx
+  8006b4:	74 2c                	je     8006e2 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b9:	8b 10                	mov    (%eax),%edx
+  8006bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006cb:	eb be                	jmp    80068b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8b 10                	mov    (%eax),%edx
+  8006d2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006db:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006e0:	eb a9                	jmp    80068b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e5:	8b 10                	mov    (%eax),%edx
+  8006e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006f7:	eb 92                	jmp    80068b <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006f9:	83 ec 08             	sub    $0x8,%esp
+  8006fc:	53                   	push   %ebx
+  8006fd:	6a 25                	push   $0x25
+  8006ff:	ff d6                	call   *%esi
+			break;
+  800701:	83 c4 10             	add    $0x10,%esp
+  800704:	eb 9f                	jmp    8006a5 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800706:	83 ec 08             	sub    $0x8,%esp
+  800709:	53                   	push   %ebx
+  80070a:	6a 25                	push   $0x25
+  80070c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80070e:	83 c4 10             	add    $0x10,%esp
+  800711:	89 f8                	mov    %edi,%eax
+  800713:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800717:	74 05                	je     80071e <vprintfmt+0x44f>
+  800719:	83 e8 01             	sub    $0x1,%eax
+  80071c:	eb f5                	jmp    800713 <vprintfmt+0x444>
+  80071e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800721:	eb 82                	jmp    8006a5 <vprintfmt+0x3d6>
+
+00800723 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800723:	55                   	push   %ebp
+  800724:	89 e5                	mov    %esp,%ebp
+  800726:	83 ec 18             	sub    $0x18,%esp
+  800729:	8b 45 08             	mov    0x8(%ebp),%eax
+  80072c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80072f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800732:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800736:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800739:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800740:	85 c0                	test   %eax,%eax
+  800742:	74 26                	je     80076a <vsnprintf+0x47>
+  800744:	85 d2                	test   %edx,%edx
+  800746:	7e 22                	jle    80076a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800748:	ff 75 14             	push   0x14(%ebp)
+  80074b:	ff 75 10             	push   0x10(%ebp)
+  80074e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800751:	50                   	push   %eax
+  800752:	68 95 02 80 00       	push   $0x800295
+  800757:	e8 73 fb ff ff       	call   8002cf <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80075c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80075f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800762:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800765:	83 c4 10             	add    $0x10,%esp
+}
+  800768:	c9                   	leave
+  800769:	c3                   	ret
+		return -E_INVAL;
+  80076a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80076f:	eb f7                	jmp    800768 <vsnprintf+0x45>
+
+00800771 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800771:	55                   	push   %ebp
+  800772:	89 e5                	mov    %esp,%ebp
+  800774:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800777:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80077a:	50                   	push   %eax
+  80077b:	ff 75 10             	push   0x10(%ebp)
+  80077e:	ff 75 0c             	push   0xc(%ebp)
+  800781:	ff 75 08             	push   0x8(%ebp)
+  800784:	e8 9a ff ff ff       	call   800723 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800789:	c9                   	leave
+  80078a:	c3                   	ret
+
+0080078b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80078b:	55                   	push   %ebp
+  80078c:	89 e5                	mov    %esp,%ebp
+  80078e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800791:	b8 00 00 00 00       	mov    $0x0,%eax
+  800796:	eb 03                	jmp    80079b <strlen+0x10>
+		n++;
+  800798:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80079b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80079f:	75 f7                	jne    800798 <strlen+0xd>
+	return n;
+}
+  8007a1:	5d                   	pop    %ebp
+  8007a2:	c3                   	ret
+
+008007a3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007a3:	55                   	push   %ebp
+  8007a4:	89 e5                	mov    %esp,%ebp
+  8007a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b1:	eb 03                	jmp    8007b6 <strnlen+0x13>
+		n++;
+  8007b3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007b6:	39 d0                	cmp    %edx,%eax
+  8007b8:	74 08                	je     8007c2 <strnlen+0x1f>
+  8007ba:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007be:	75 f3                	jne    8007b3 <strnlen+0x10>
+  8007c0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007c2:	89 d0                	mov    %edx,%eax
+  8007c4:	5d                   	pop    %ebp
+  8007c5:	c3                   	ret
+
+008007c6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007c6:	55                   	push   %ebp
+  8007c7:	89 e5                	mov    %esp,%ebp
+  8007c9:	53                   	push   %ebx
+  8007ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007cd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007d9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007dc:	83 c0 01             	add    $0x1,%eax
+  8007df:	84 d2                	test   %dl,%dl
+  8007e1:	75 f2                	jne    8007d5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007e3:	89 c8                	mov    %ecx,%eax
+  8007e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e8:	c9                   	leave
+  8007e9:	c3                   	ret
+
+008007ea <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007ea:	55                   	push   %ebp
+  8007eb:	89 e5                	mov    %esp,%ebp
+  8007ed:	53                   	push   %ebx
+  8007ee:	83 ec 10             	sub    $0x10,%esp
+  8007f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007f4:	53                   	push   %ebx
+  8007f5:	e8 91 ff ff ff       	call   80078b <strlen>
+  8007fa:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007fd:	ff 75 0c             	push   0xc(%ebp)
+  800800:	01 d8                	add    %ebx,%eax
+  800802:	50                   	push   %eax
+  800803:	e8 be ff ff ff       	call   8007c6 <strcpy>
+	return dst;
+}
+  800808:	89 d8                	mov    %ebx,%eax
+  80080a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80080d:	c9                   	leave
+  80080e:	c3                   	ret
+
+0080080f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80080f:	55                   	push   %ebp
+  800810:	89 e5                	mov    %esp,%ebp
+  800812:	56                   	push   %esi
+  800813:	53                   	push   %ebx
+  800814:	8b 75 08             	mov    0x8(%ebp),%esi
+  800817:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80081a:	89 f3                	mov    %esi,%ebx
+  80081c:	03 5d 10             	add    0x10(%ebp),%ebx
+  80081f:	89 f0                	mov    %esi,%eax
+  800821:	eb 0f                	jmp    800832 <strncpy+0x23>
+		*dst++ = *src;
+  800823:	83 c0 01             	add    $0x1,%eax
+  800826:	0f b6 0a             	movzbl (%edx),%ecx
+  800829:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80082c:	80 f9 01             	cmp    $0x1,%cl
+  80082f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800832:	39 d8                	cmp    %ebx,%eax
+  800834:	75 ed                	jne    800823 <strncpy+0x14>
+	}
+	return ret;
+}
+  800836:	89 f0                	mov    %esi,%eax
+  800838:	5b                   	pop    %ebx
+  800839:	5e                   	pop    %esi
+  80083a:	5d                   	pop    %ebp
+  80083b:	c3                   	ret
+
+0080083c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80083c:	55                   	push   %ebp
+  80083d:	89 e5                	mov    %esp,%ebp
+  80083f:	56                   	push   %esi
+  800840:	53                   	push   %ebx
+  800841:	8b 75 08             	mov    0x8(%ebp),%esi
+  800844:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800847:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80084a:	89 f0                	mov    %esi,%eax
+  80084c:	85 d2                	test   %edx,%edx
+  80084e:	74 21                	je     800871 <strlcpy+0x35>
+  800850:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800854:	89 f2                	mov    %esi,%edx
+  800856:	eb 09                	jmp    800861 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800858:	83 c1 01             	add    $0x1,%ecx
+  80085b:	83 c2 01             	add    $0x1,%edx
+  80085e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800861:	39 c2                	cmp    %eax,%edx
+  800863:	74 09                	je     80086e <strlcpy+0x32>
+  800865:	0f b6 19             	movzbl (%ecx),%ebx
+  800868:	84 db                	test   %bl,%bl
+  80086a:	75 ec                	jne    800858 <strlcpy+0x1c>
+  80086c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80086e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800871:	29 f0                	sub    %esi,%eax
+}
+  800873:	5b                   	pop    %ebx
+  800874:	5e                   	pop    %esi
+  800875:	5d                   	pop    %ebp
+  800876:	c3                   	ret
+
+00800877 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800877:	55                   	push   %ebp
+  800878:	89 e5                	mov    %esp,%ebp
+  80087a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80087d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800880:	eb 06                	jmp    800888 <strcmp+0x11>
+		p++, q++;
+  800882:	83 c1 01             	add    $0x1,%ecx
+  800885:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800888:	0f b6 01             	movzbl (%ecx),%eax
+  80088b:	84 c0                	test   %al,%al
+  80088d:	74 04                	je     800893 <strcmp+0x1c>
+  80088f:	3a 02                	cmp    (%edx),%al
+  800891:	74 ef                	je     800882 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800893:	0f b6 c0             	movzbl %al,%eax
+  800896:	0f b6 12             	movzbl (%edx),%edx
+  800899:	29 d0                	sub    %edx,%eax
+}
+  80089b:	5d                   	pop    %ebp
+  80089c:	c3                   	ret
+
+0080089d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80089d:	55                   	push   %ebp
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	53                   	push   %ebx
+  8008a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008aa:	eb 09                	jmp    8008b5 <strncmp+0x18>
+		n--, p++, q++;
+  8008ac:	83 ea 01             	sub    $0x1,%edx
+  8008af:	83 c0 01             	add    $0x1,%eax
+  8008b2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008b5:	85 d2                	test   %edx,%edx
+  8008b7:	74 18                	je     8008d1 <strncmp+0x34>
+  8008b9:	0f b6 18             	movzbl (%eax),%ebx
+  8008bc:	84 db                	test   %bl,%bl
+  8008be:	74 04                	je     8008c4 <strncmp+0x27>
+  8008c0:	3a 19                	cmp    (%ecx),%bl
+  8008c2:	74 e8                	je     8008ac <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008c4:	0f b6 00             	movzbl (%eax),%eax
+  8008c7:	0f b6 11             	movzbl (%ecx),%edx
+  8008ca:	29 d0                	sub    %edx,%eax
+}
+  8008cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008cf:	c9                   	leave
+  8008d0:	c3                   	ret
+		return 0;
+  8008d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d6:	eb f4                	jmp    8008cc <strncmp+0x2f>
+
+008008d8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008d8:	55                   	push   %ebp
+  8008d9:	89 e5                	mov    %esp,%ebp
+  8008db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008de:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008e2:	eb 03                	jmp    8008e7 <strchr+0xf>
+  8008e4:	83 c0 01             	add    $0x1,%eax
+  8008e7:	0f b6 10             	movzbl (%eax),%edx
+  8008ea:	84 d2                	test   %dl,%dl
+  8008ec:	74 06                	je     8008f4 <strchr+0x1c>
+		if (*s == c)
+  8008ee:	38 ca                	cmp    %cl,%dl
+  8008f0:	75 f2                	jne    8008e4 <strchr+0xc>
+  8008f2:	eb 05                	jmp    8008f9 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008f9:	5d                   	pop    %ebp
+  8008fa:	c3                   	ret
+
+008008fb <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008fb:	55                   	push   %ebp
+  8008fc:	89 e5                	mov    %esp,%ebp
+  8008fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800901:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800905:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800908:	38 ca                	cmp    %cl,%dl
+  80090a:	74 09                	je     800915 <strfind+0x1a>
+  80090c:	84 d2                	test   %dl,%dl
+  80090e:	74 05                	je     800915 <strfind+0x1a>
+	for (; *s; s++)
+  800910:	83 c0 01             	add    $0x1,%eax
+  800913:	eb f0                	jmp    800905 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800915:	5d                   	pop    %ebp
+  800916:	c3                   	ret
+
+00800917 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	57                   	push   %edi
+  80091b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80091e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800921:	85 c9                	test   %ecx,%ecx
+  800923:	74 20                	je     800945 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800925:	89 f8                	mov    %edi,%eax
+  800927:	09 c8                	or     %ecx,%eax
+  800929:	a8 03                	test   $0x3,%al
+  80092b:	75 12                	jne    80093f <memset+0x28>
+		c &= 0xFF;
+  80092d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800931:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800937:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80093a:	fc                   	cld
+  80093b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80093d:	eb 06                	jmp    800945 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80093f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800942:	fc                   	cld
+  800943:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800945:	89 f8                	mov    %edi,%eax
+  800947:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80094a:	c9                   	leave
+  80094b:	c3                   	ret
+
+0080094c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80094c:	55                   	push   %ebp
+  80094d:	89 e5                	mov    %esp,%ebp
+  80094f:	57                   	push   %edi
+  800950:	56                   	push   %esi
+  800951:	8b 45 08             	mov    0x8(%ebp),%eax
+  800954:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800957:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80095a:	39 c6                	cmp    %eax,%esi
+  80095c:	73 32                	jae    800990 <memmove+0x44>
+  80095e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800961:	39 d0                	cmp    %edx,%eax
+  800963:	73 2b                	jae    800990 <memmove+0x44>
+		s += n;
+		d += n;
+  800965:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800968:	89 d6                	mov    %edx,%esi
+  80096a:	09 fe                	or     %edi,%esi
+  80096c:	09 ce                	or     %ecx,%esi
+  80096e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800974:	75 0e                	jne    800984 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800976:	83 ef 04             	sub    $0x4,%edi
+  800979:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80097c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80097f:	fd                   	std
+  800980:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800982:	eb 09                	jmp    80098d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800984:	83 ef 01             	sub    $0x1,%edi
+  800987:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80098a:	fd                   	std
+  80098b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80098d:	fc                   	cld
+  80098e:	eb 1a                	jmp    8009aa <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800990:	89 f2                	mov    %esi,%edx
+  800992:	09 c2                	or     %eax,%edx
+  800994:	09 ca                	or     %ecx,%edx
+  800996:	f6 c2 03             	test   $0x3,%dl
+  800999:	75 0a                	jne    8009a5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80099b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80099e:	89 c7                	mov    %eax,%edi
+  8009a0:	fc                   	cld
+  8009a1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009a3:	eb 05                	jmp    8009aa <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009a5:	89 c7                	mov    %eax,%edi
+  8009a7:	fc                   	cld
+  8009a8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009aa:	5e                   	pop    %esi
+  8009ab:	5f                   	pop    %edi
+  8009ac:	5d                   	pop    %ebp
+  8009ad:	c3                   	ret
+
+008009ae <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009ae:	55                   	push   %ebp
+  8009af:	89 e5                	mov    %esp,%ebp
+  8009b1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009b4:	ff 75 10             	push   0x10(%ebp)
+  8009b7:	ff 75 0c             	push   0xc(%ebp)
+  8009ba:	ff 75 08             	push   0x8(%ebp)
+  8009bd:	e8 8a ff ff ff       	call   80094c <memmove>
+}
+  8009c2:	c9                   	leave
+  8009c3:	c3                   	ret
+
+008009c4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009c4:	55                   	push   %ebp
+  8009c5:	89 e5                	mov    %esp,%ebp
+  8009c7:	56                   	push   %esi
+  8009c8:	53                   	push   %ebx
+  8009c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009cf:	89 c6                	mov    %eax,%esi
+  8009d1:	03 75 10             	add    0x10(%ebp),%esi
+  8009d4:	eb 06                	jmp    8009dc <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009d6:	83 c0 01             	add    $0x1,%eax
+  8009d9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009dc:	39 f0                	cmp    %esi,%eax
+  8009de:	74 14                	je     8009f4 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009e0:	0f b6 08             	movzbl (%eax),%ecx
+  8009e3:	0f b6 1a             	movzbl (%edx),%ebx
+  8009e6:	38 d9                	cmp    %bl,%cl
+  8009e8:	74 ec                	je     8009d6 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009ea:	0f b6 c1             	movzbl %cl,%eax
+  8009ed:	0f b6 db             	movzbl %bl,%ebx
+  8009f0:	29 d8                	sub    %ebx,%eax
+  8009f2:	eb 05                	jmp    8009f9 <memcmp+0x35>
+	}
+
+	return 0;
+  8009f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f9:	5b                   	pop    %ebx
+  8009fa:	5e                   	pop    %esi
+  8009fb:	5d                   	pop    %ebp
+  8009fc:	c3                   	ret
+
+008009fd <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009fd:	55                   	push   %ebp
+  8009fe:	89 e5                	mov    %esp,%ebp
+  800a00:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a06:	89 c2                	mov    %eax,%edx
+  800a08:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a0b:	eb 03                	jmp    800a10 <memfind+0x13>
+  800a0d:	83 c0 01             	add    $0x1,%eax
+  800a10:	39 d0                	cmp    %edx,%eax
+  800a12:	73 04                	jae    800a18 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a14:	38 08                	cmp    %cl,(%eax)
+  800a16:	75 f5                	jne    800a0d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a18:	5d                   	pop    %ebp
+  800a19:	c3                   	ret
+
+00800a1a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	57                   	push   %edi
+  800a1e:	56                   	push   %esi
+  800a1f:	53                   	push   %ebx
+  800a20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a26:	eb 03                	jmp    800a2b <strtol+0x11>
+		s++;
+  800a28:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a2b:	0f b6 02             	movzbl (%edx),%eax
+  800a2e:	3c 20                	cmp    $0x20,%al
+  800a30:	74 f6                	je     800a28 <strtol+0xe>
+  800a32:	3c 09                	cmp    $0x9,%al
+  800a34:	74 f2                	je     800a28 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a36:	3c 2b                	cmp    $0x2b,%al
+  800a38:	74 2a                	je     800a64 <strtol+0x4a>
+	int neg = 0;
+  800a3a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a3f:	3c 2d                	cmp    $0x2d,%al
+  800a41:	74 2b                	je     800a6e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a43:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a49:	75 0f                	jne    800a5a <strtol+0x40>
+  800a4b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a4e:	74 28                	je     800a78 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a50:	85 db                	test   %ebx,%ebx
+  800a52:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a57:	0f 44 d8             	cmove  %eax,%ebx
+  800a5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a5f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a62:	eb 46                	jmp    800aaa <strtol+0x90>
+		s++;
+  800a64:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a67:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a6c:	eb d5                	jmp    800a43 <strtol+0x29>
+		s++, neg = 1;
+  800a6e:	83 c2 01             	add    $0x1,%edx
+  800a71:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a76:	eb cb                	jmp    800a43 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a78:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a7c:	74 0e                	je     800a8c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a7e:	85 db                	test   %ebx,%ebx
+  800a80:	75 d8                	jne    800a5a <strtol+0x40>
+		s++, base = 8;
+  800a82:	83 c2 01             	add    $0x1,%edx
+  800a85:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a8a:	eb ce                	jmp    800a5a <strtol+0x40>
+		s += 2, base = 16;
+  800a8c:	83 c2 02             	add    $0x2,%edx
+  800a8f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a94:	eb c4                	jmp    800a5a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a96:	0f be c0             	movsbl %al,%eax
+  800a99:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a9c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a9f:	7d 3a                	jge    800adb <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800aa1:	83 c2 01             	add    $0x1,%edx
+  800aa4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800aa8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aaa:	0f b6 02             	movzbl (%edx),%eax
+  800aad:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ab0:	89 f3                	mov    %esi,%ebx
+  800ab2:	80 fb 09             	cmp    $0x9,%bl
+  800ab5:	76 df                	jbe    800a96 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ab7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800aba:	89 f3                	mov    %esi,%ebx
+  800abc:	80 fb 19             	cmp    $0x19,%bl
+  800abf:	77 08                	ja     800ac9 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ac1:	0f be c0             	movsbl %al,%eax
+  800ac4:	83 e8 57             	sub    $0x57,%eax
+  800ac7:	eb d3                	jmp    800a9c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ac9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800acc:	89 f3                	mov    %esi,%ebx
+  800ace:	80 fb 19             	cmp    $0x19,%bl
+  800ad1:	77 08                	ja     800adb <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ad3:	0f be c0             	movsbl %al,%eax
+  800ad6:	83 e8 37             	sub    $0x37,%eax
+  800ad9:	eb c1                	jmp    800a9c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800adb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800adf:	74 05                	je     800ae6 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ae1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ae4:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ae6:	89 c8                	mov    %ecx,%eax
+  800ae8:	f7 d8                	neg    %eax
+  800aea:	85 ff                	test   %edi,%edi
+  800aec:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aef:	89 c8                	mov    %ecx,%eax
+  800af1:	5b                   	pop    %ebx
+  800af2:	5e                   	pop    %esi
+  800af3:	5f                   	pop    %edi
+  800af4:	5d                   	pop    %ebp
+  800af5:	c3                   	ret
+
+00800af6 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800af6:	55                   	push   %ebp
+  800af7:	89 e5                	mov    %esp,%ebp
+  800af9:	57                   	push   %edi
+  800afa:	56                   	push   %esi
+  800afb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800afc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b07:	89 c3                	mov    %eax,%ebx
+  800b09:	89 c7                	mov    %eax,%edi
+  800b0b:	89 c6                	mov    %eax,%esi
+  800b0d:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b0f:	5b                   	pop    %ebx
+  800b10:	5e                   	pop    %esi
+  800b11:	5f                   	pop    %edi
+  800b12:	5d                   	pop    %ebp
+  800b13:	c3                   	ret
+
+00800b14 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b14:	55                   	push   %ebp
+  800b15:	89 e5                	mov    %esp,%ebp
+  800b17:	57                   	push   %edi
+  800b18:	56                   	push   %esi
+  800b19:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b1f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b24:	89 d1                	mov    %edx,%ecx
+  800b26:	89 d3                	mov    %edx,%ebx
+  800b28:	89 d7                	mov    %edx,%edi
+  800b2a:	89 d6                	mov    %edx,%esi
+  800b2c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b2e:	5b                   	pop    %ebx
+  800b2f:	5e                   	pop    %esi
+  800b30:	5f                   	pop    %edi
+  800b31:	5d                   	pop    %ebp
+  800b32:	c3                   	ret
+
+00800b33 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	57                   	push   %edi
+  800b37:	56                   	push   %esi
+  800b38:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b41:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b46:	89 cb                	mov    %ecx,%ebx
+  800b48:	89 cf                	mov    %ecx,%edi
+  800b4a:	89 ce                	mov    %ecx,%esi
+  800b4c:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b4e:	5b                   	pop    %ebx
+  800b4f:	5e                   	pop    %esi
+  800b50:	5f                   	pop    %edi
+  800b51:	5d                   	pop    %ebp
+  800b52:	c3                   	ret
+
+00800b53 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	57                   	push   %edi
+  800b57:	56                   	push   %esi
+  800b58:	53                   	push   %ebx
+  800b59:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b64:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b69:	89 cb                	mov    %ecx,%ebx
+  800b6b:	89 cf                	mov    %ecx,%edi
+  800b6d:	89 ce                	mov    %ecx,%esi
+  800b6f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b71:	85 c0                	test   %eax,%eax
+  800b73:	7f 08                	jg     800b7d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b78:	5b                   	pop    %ebx
+  800b79:	5e                   	pop    %esi
+  800b7a:	5f                   	pop    %edi
+  800b7b:	5d                   	pop    %ebp
+  800b7c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b7d:	83 ec 0c             	sub    $0xc,%esp
+  800b80:	50                   	push   %eax
+  800b81:	6a 03                	push   $0x3
+  800b83:	68 1f 2e 80 00       	push   $0x802e1f
+  800b88:	6a 23                	push   $0x23
+  800b8a:	68 3c 2e 80 00       	push   $0x802e3c
+  800b8f:	e8 37 19 00 00       	call   8024cb <_panic>
+
+00800b94 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b94:	55                   	push   %ebp
+  800b95:	89 e5                	mov    %esp,%ebp
+  800b97:	57                   	push   %edi
+  800b98:	56                   	push   %esi
+  800b99:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b9f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ba4:	89 d1                	mov    %edx,%ecx
+  800ba6:	89 d3                	mov    %edx,%ebx
+  800ba8:	89 d7                	mov    %edx,%edi
+  800baa:	89 d6                	mov    %edx,%esi
+  800bac:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bae:	5b                   	pop    %ebx
+  800baf:	5e                   	pop    %esi
+  800bb0:	5f                   	pop    %edi
+  800bb1:	5d                   	pop    %ebp
+  800bb2:	c3                   	ret
+
+00800bb3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bb3:	55                   	push   %ebp
+  800bb4:	89 e5                	mov    %esp,%ebp
+  800bb6:	57                   	push   %edi
+  800bb7:	56                   	push   %esi
+  800bb8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bbe:	b8 16 00 00 00       	mov    $0x16,%eax
+  800bc3:	89 d1                	mov    %edx,%ecx
+  800bc5:	89 d3                	mov    %edx,%ebx
+  800bc7:	89 d7                	mov    %edx,%edi
+  800bc9:	89 d6                	mov    %edx,%esi
+  800bcb:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bcd:	5b                   	pop    %ebx
+  800bce:	5e                   	pop    %esi
+  800bcf:	5f                   	pop    %edi
+  800bd0:	5d                   	pop    %ebp
+  800bd1:	c3                   	ret
+
+00800bd2 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800bd2:	55                   	push   %ebp
+  800bd3:	89 e5                	mov    %esp,%ebp
+  800bd5:	57                   	push   %edi
+  800bd6:	56                   	push   %esi
+  800bd7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bdd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800be2:	89 d1                	mov    %edx,%ecx
+  800be4:	89 d3                	mov    %edx,%ebx
+  800be6:	89 d7                	mov    %edx,%edi
+  800be8:	89 d6                	mov    %edx,%esi
+  800bea:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800bec:	5b                   	pop    %ebx
+  800bed:	5e                   	pop    %esi
+  800bee:	5f                   	pop    %edi
+  800bef:	5d                   	pop    %ebp
+  800bf0:	c3                   	ret
+
+00800bf1 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	57                   	push   %edi
+  800bf5:	56                   	push   %esi
+  800bf6:	53                   	push   %ebx
+  800bf7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bfa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c05:	b8 15 00 00 00       	mov    $0x15,%eax
+  800c0a:	89 df                	mov    %ebx,%edi
+  800c0c:	89 de                	mov    %ebx,%esi
+  800c0e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c10:	85 c0                	test   %eax,%eax
+  800c12:	7f 08                	jg     800c1c <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800c14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c17:	5b                   	pop    %ebx
+  800c18:	5e                   	pop    %esi
+  800c19:	5f                   	pop    %edi
+  800c1a:	5d                   	pop    %ebp
+  800c1b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c1c:	83 ec 0c             	sub    $0xc,%esp
+  800c1f:	50                   	push   %eax
+  800c20:	6a 15                	push   $0x15
+  800c22:	68 1f 2e 80 00       	push   $0x802e1f
+  800c27:	6a 23                	push   $0x23
+  800c29:	68 3c 2e 80 00       	push   $0x802e3c
+  800c2e:	e8 98 18 00 00       	call   8024cb <_panic>
+
+00800c33 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c33:	55                   	push   %ebp
+  800c34:	89 e5                	mov    %esp,%ebp
+  800c36:	57                   	push   %edi
+  800c37:	56                   	push   %esi
+  800c38:	53                   	push   %ebx
+  800c39:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c3c:	be 00 00 00 00       	mov    $0x0,%esi
+  800c41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c47:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c4f:	89 f7                	mov    %esi,%edi
+  800c51:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c53:	85 c0                	test   %eax,%eax
+  800c55:	7f 08                	jg     800c5f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5a:	5b                   	pop    %ebx
+  800c5b:	5e                   	pop    %esi
+  800c5c:	5f                   	pop    %edi
+  800c5d:	5d                   	pop    %ebp
+  800c5e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c5f:	83 ec 0c             	sub    $0xc,%esp
+  800c62:	50                   	push   %eax
+  800c63:	6a 05                	push   $0x5
+  800c65:	68 1f 2e 80 00       	push   $0x802e1f
+  800c6a:	6a 23                	push   $0x23
+  800c6c:	68 3c 2e 80 00       	push   $0x802e3c
+  800c71:	e8 55 18 00 00       	call   8024cb <_panic>
+
+00800c76 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800c76:	55                   	push   %ebp
+  800c77:	89 e5                	mov    %esp,%ebp
+  800c79:	57                   	push   %edi
+  800c7a:	56                   	push   %esi
+  800c7b:	53                   	push   %ebx
+  800c7c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c7f:	be 00 00 00 00       	mov    $0x0,%esi
+  800c84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c92:	89 f7                	mov    %esi,%edi
+  800c94:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c96:	85 c0                	test   %eax,%eax
+  800c98:	7f 08                	jg     800ca2 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9d:	5b                   	pop    %ebx
+  800c9e:	5e                   	pop    %esi
+  800c9f:	5f                   	pop    %edi
+  800ca0:	5d                   	pop    %ebp
+  800ca1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca2:	83 ec 0c             	sub    $0xc,%esp
+  800ca5:	50                   	push   %eax
+  800ca6:	6a 06                	push   $0x6
+  800ca8:	68 1f 2e 80 00       	push   $0x802e1f
+  800cad:	6a 23                	push   $0x23
+  800caf:	68 3c 2e 80 00       	push   $0x802e3c
+  800cb4:	e8 12 18 00 00       	call   8024cb <_panic>
+
+00800cb9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cb9:	55                   	push   %ebp
+  800cba:	89 e5                	mov    %esp,%ebp
+  800cbc:	57                   	push   %edi
+  800cbd:	56                   	push   %esi
+  800cbe:	53                   	push   %ebx
+  800cbf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc8:	b8 07 00 00 00       	mov    $0x7,%eax
+  800ccd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cd0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cd3:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cd6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd8:	85 c0                	test   %eax,%eax
+  800cda:	7f 08                	jg     800ce4 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdf:	5b                   	pop    %ebx
+  800ce0:	5e                   	pop    %esi
+  800ce1:	5f                   	pop    %edi
+  800ce2:	5d                   	pop    %ebp
+  800ce3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce4:	83 ec 0c             	sub    $0xc,%esp
+  800ce7:	50                   	push   %eax
+  800ce8:	6a 07                	push   $0x7
+  800cea:	68 1f 2e 80 00       	push   $0x802e1f
+  800cef:	6a 23                	push   $0x23
+  800cf1:	68 3c 2e 80 00       	push   $0x802e3c
+  800cf6:	e8 d0 17 00 00       	call   8024cb <_panic>
+
+00800cfb <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cfb:	55                   	push   %ebp
+  800cfc:	89 e5                	mov    %esp,%ebp
+  800cfe:	57                   	push   %edi
+  800cff:	56                   	push   %esi
+  800d00:	53                   	push   %ebx
+  800d01:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d14:	89 df                	mov    %ebx,%edi
+  800d16:	89 de                	mov    %ebx,%esi
+  800d18:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d1a:	85 c0                	test   %eax,%eax
+  800d1c:	7f 08                	jg     800d26 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d21:	5b                   	pop    %ebx
+  800d22:	5e                   	pop    %esi
+  800d23:	5f                   	pop    %edi
+  800d24:	5d                   	pop    %ebp
+  800d25:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d26:	83 ec 0c             	sub    $0xc,%esp
+  800d29:	50                   	push   %eax
+  800d2a:	6a 08                	push   $0x8
+  800d2c:	68 1f 2e 80 00       	push   $0x802e1f
+  800d31:	6a 23                	push   $0x23
+  800d33:	68 3c 2e 80 00       	push   $0x802e3c
+  800d38:	e8 8e 17 00 00       	call   8024cb <_panic>
+
+00800d3d <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d3d:	55                   	push   %ebp
+  800d3e:	89 e5                	mov    %esp,%ebp
+  800d40:	57                   	push   %edi
+  800d41:	56                   	push   %esi
+  800d42:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d49:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d4e:	be 00 00 00 00       	mov    $0x0,%esi
+  800d53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d56:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d59:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d5b:	5b                   	pop    %ebx
+  800d5c:	5e                   	pop    %esi
+  800d5d:	5f                   	pop    %edi
+  800d5e:	5d                   	pop    %ebp
+  800d5f:	c3                   	ret
+
+00800d60 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d60:	55                   	push   %ebp
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	57                   	push   %edi
+  800d64:	56                   	push   %esi
+  800d65:	53                   	push   %ebx
+  800d66:	8b 45 18             	mov    0x18(%ebp),%eax
+  800d69:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800d6c:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800d71:	77 27                	ja     800d9a <sys_page_map_range+0x3a>
+  800d73:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800d79:	77 1f                	ja     800d9a <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800d7b:	c1 e0 0c             	shl    $0xc,%eax
+  800d7e:	89 c6                	mov    %eax,%esi
+  800d80:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800d82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d88:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d90:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d93:	cd 30                	int    $0x30
+}
+  800d95:	5b                   	pop    %ebx
+  800d96:	5e                   	pop    %esi
+  800d97:	5f                   	pop    %edi
+  800d98:	5d                   	pop    %ebp
+  800d99:	c3                   	ret
+		return -E_INVAL;
+  800d9a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d9f:	eb f4                	jmp    800d95 <sys_page_map_range+0x35>
+
+00800da1 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800da1:	55                   	push   %ebp
+  800da2:	89 e5                	mov    %esp,%ebp
+  800da4:	57                   	push   %edi
+  800da5:	56                   	push   %esi
+  800da6:	53                   	push   %ebx
+  800da7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800db5:	be 00 00 00 00       	mov    $0x0,%esi
+  800dba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc2:	85 c0                	test   %eax,%eax
+  800dc4:	7f 08                	jg     800dce <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800dc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc9:	5b                   	pop    %ebx
+  800dca:	5e                   	pop    %esi
+  800dcb:	5f                   	pop    %edi
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dce:	83 ec 0c             	sub    $0xc,%esp
+  800dd1:	50                   	push   %eax
+  800dd2:	6a 0c                	push   $0xc
+  800dd4:	68 1f 2e 80 00       	push   $0x802e1f
+  800dd9:	6a 23                	push   $0x23
+  800ddb:	68 3c 2e 80 00       	push   $0x802e3c
+  800de0:	e8 e6 16 00 00       	call   8024cb <_panic>
+
+00800de5 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800deb:	be 00 00 00 00       	mov    $0x0,%esi
+  800df0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dfb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfe:	89 f7                	mov    %esi,%edi
+  800e00:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e02:	5b                   	pop    %ebx
+  800e03:	5e                   	pop    %esi
+  800e04:	5f                   	pop    %edi
+  800e05:	5d                   	pop    %ebp
+  800e06:	c3                   	ret
+
+00800e07 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e07:	55                   	push   %ebp
+  800e08:	89 e5                	mov    %esp,%ebp
+  800e0a:	57                   	push   %edi
+  800e0b:	56                   	push   %esi
+  800e0c:	53                   	push   %ebx
+  800e0d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e20:	89 df                	mov    %ebx,%edi
+  800e22:	89 de                	mov    %ebx,%esi
+  800e24:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e26:	85 c0                	test   %eax,%eax
+  800e28:	7f 08                	jg     800e32 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2d:	5b                   	pop    %ebx
+  800e2e:	5e                   	pop    %esi
+  800e2f:	5f                   	pop    %edi
+  800e30:	5d                   	pop    %ebp
+  800e31:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e32:	83 ec 0c             	sub    $0xc,%esp
+  800e35:	50                   	push   %eax
+  800e36:	6a 0f                	push   $0xf
+  800e38:	68 1f 2e 80 00       	push   $0x802e1f
+  800e3d:	6a 23                	push   $0x23
+  800e3f:	68 3c 2e 80 00       	push   $0x802e3c
+  800e44:	e8 82 16 00 00       	call   8024cb <_panic>
+
+00800e49 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	57                   	push   %edi
+  800e4d:	56                   	push   %esi
+  800e4e:	53                   	push   %ebx
+  800e4f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e62:	89 df                	mov    %ebx,%edi
+  800e64:	89 de                	mov    %ebx,%esi
+  800e66:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e68:	85 c0                	test   %eax,%eax
+  800e6a:	7f 08                	jg     800e74 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800e6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6f:	5b                   	pop    %ebx
+  800e70:	5e                   	pop    %esi
+  800e71:	5f                   	pop    %edi
+  800e72:	5d                   	pop    %ebp
+  800e73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e74:	83 ec 0c             	sub    $0xc,%esp
+  800e77:	50                   	push   %eax
+  800e78:	6a 10                	push   $0x10
+  800e7a:	68 1f 2e 80 00       	push   $0x802e1f
+  800e7f:	6a 23                	push   $0x23
+  800e81:	68 3c 2e 80 00       	push   $0x802e3c
+  800e86:	e8 40 16 00 00       	call   8024cb <_panic>
+
+00800e8b <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800e8b:	55                   	push   %ebp
+  800e8c:	89 e5                	mov    %esp,%ebp
+  800e8e:	57                   	push   %edi
+  800e8f:	56                   	push   %esi
+  800e90:	53                   	push   %ebx
+  800e91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ea4:	89 df                	mov    %ebx,%edi
+  800ea6:	89 de                	mov    %ebx,%esi
+  800ea8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eaa:	85 c0                	test   %eax,%eax
+  800eac:	7f 08                	jg     800eb6 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800eae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb1:	5b                   	pop    %ebx
+  800eb2:	5e                   	pop    %esi
+  800eb3:	5f                   	pop    %edi
+  800eb4:	5d                   	pop    %ebp
+  800eb5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb6:	83 ec 0c             	sub    $0xc,%esp
+  800eb9:	50                   	push   %eax
+  800eba:	6a 11                	push   $0x11
+  800ebc:	68 1f 2e 80 00       	push   $0x802e1f
+  800ec1:	6a 23                	push   $0x23
+  800ec3:	68 3c 2e 80 00       	push   $0x802e3c
+  800ec8:	e8 fe 15 00 00       	call   8024cb <_panic>
+
+00800ecd <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800ecd:	55                   	push   %ebp
+  800ece:	89 e5                	mov    %esp,%ebp
+  800ed0:	57                   	push   %edi
+  800ed1:	56                   	push   %esi
+  800ed2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ed3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed8:	b8 12 00 00 00       	mov    $0x12,%eax
+  800edd:	89 d1                	mov    %edx,%ecx
+  800edf:	89 d3                	mov    %edx,%ebx
+  800ee1:	89 d7                	mov    %edx,%edi
+  800ee3:	89 d6                	mov    %edx,%esi
+  800ee5:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800ee7:	5b                   	pop    %ebx
+  800ee8:	5e                   	pop    %esi
+  800ee9:	5f                   	pop    %edi
+  800eea:	5d                   	pop    %ebp
+  800eeb:	c3                   	ret
+
+00800eec <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	57                   	push   %edi
+  800ef0:	56                   	push   %esi
+  800ef1:	53                   	push   %ebx
+  800ef2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f00:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f05:	89 df                	mov    %ebx,%edi
+  800f07:	89 de                	mov    %ebx,%esi
+  800f09:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0b:	85 c0                	test   %eax,%eax
+  800f0d:	7f 08                	jg     800f17 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f12:	5b                   	pop    %ebx
+  800f13:	5e                   	pop    %esi
+  800f14:	5f                   	pop    %edi
+  800f15:	5d                   	pop    %ebp
+  800f16:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f17:	83 ec 0c             	sub    $0xc,%esp
+  800f1a:	50                   	push   %eax
+  800f1b:	6a 13                	push   $0x13
+  800f1d:	68 1f 2e 80 00       	push   $0x802e1f
+  800f22:	6a 23                	push   $0x23
+  800f24:	68 3c 2e 80 00       	push   $0x802e3c
+  800f29:	e8 9d 15 00 00       	call   8024cb <_panic>
+
+00800f2e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f2e:	55                   	push   %ebp
+  800f2f:	89 e5                	mov    %esp,%ebp
+  800f31:	57                   	push   %edi
+  800f32:	56                   	push   %esi
+  800f33:	53                   	push   %ebx
+  800f34:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f42:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f47:	89 df                	mov    %ebx,%edi
+  800f49:	89 de                	mov    %ebx,%esi
+  800f4b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4d:	85 c0                	test   %eax,%eax
+  800f4f:	7f 08                	jg     800f59 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f54:	5b                   	pop    %ebx
+  800f55:	5e                   	pop    %esi
+  800f56:	5f                   	pop    %edi
+  800f57:	5d                   	pop    %ebp
+  800f58:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f59:	83 ec 0c             	sub    $0xc,%esp
+  800f5c:	50                   	push   %eax
+  800f5d:	6a 14                	push   $0x14
+  800f5f:	68 1f 2e 80 00       	push   $0x802e1f
+  800f64:	6a 23                	push   $0x23
+  800f66:	68 3c 2e 80 00       	push   $0x802e3c
+  800f6b:	e8 5b 15 00 00       	call   8024cb <_panic>
+
+00800f70 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	57                   	push   %edi
+  800f74:	56                   	push   %esi
+  800f75:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7c:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f81:	be 00 00 00 00       	mov    $0x0,%esi
+  800f86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f89:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f8c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f8e:	5b                   	pop    %ebx
+  800f8f:	5e                   	pop    %esi
+  800f90:	5f                   	pop    %edi
+  800f91:	5d                   	pop    %ebp
+  800f92:	c3                   	ret
+
+00800f93 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f93:	55                   	push   %ebp
+  800f94:	89 e5                	mov    %esp,%ebp
+  800f96:	57                   	push   %edi
+  800f97:	56                   	push   %esi
+  800f98:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9f:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fa4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800faf:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fb1:	5b                   	pop    %ebx
+  800fb2:	5e                   	pop    %esi
+  800fb3:	5f                   	pop    %edi
+  800fb4:	5d                   	pop    %ebp
+  800fb5:	c3                   	ret
+
+00800fb6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800fb6:	55                   	push   %ebp
+  800fb7:	89 e5                	mov    %esp,%ebp
+  800fb9:	57                   	push   %edi
+  800fba:	56                   	push   %esi
+  800fbb:	53                   	push   %ebx
+  800fbc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fbf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc7:	b8 19 00 00 00       	mov    $0x19,%eax
+  800fcc:	89 cb                	mov    %ecx,%ebx
+  800fce:	89 cf                	mov    %ecx,%edi
+  800fd0:	89 ce                	mov    %ecx,%esi
+  800fd2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd4:	85 c0                	test   %eax,%eax
+  800fd6:	7f 08                	jg     800fe0 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800fd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdb:	5b                   	pop    %ebx
+  800fdc:	5e                   	pop    %esi
+  800fdd:	5f                   	pop    %edi
+  800fde:	5d                   	pop    %ebp
+  800fdf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe0:	83 ec 0c             	sub    $0xc,%esp
+  800fe3:	50                   	push   %eax
+  800fe4:	6a 19                	push   $0x19
+  800fe6:	68 1f 2e 80 00       	push   $0x802e1f
+  800feb:	6a 23                	push   $0x23
+  800fed:	68 3c 2e 80 00       	push   $0x802e3c
+  800ff2:	e8 d4 14 00 00       	call   8024cb <_panic>
+
+00800ff7 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ff7:	55                   	push   %ebp
+  800ff8:	89 e5                	mov    %esp,%ebp
+  800ffa:	57                   	push   %edi
+  800ffb:	56                   	push   %esi
+  800ffc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ffd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801002:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801007:	89 d1                	mov    %edx,%ecx
+  801009:	89 d3                	mov    %edx,%ebx
+  80100b:	89 d7                	mov    %edx,%edi
+  80100d:	89 d6                	mov    %edx,%esi
+  80100f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801011:	5b                   	pop    %ebx
+  801012:	5e                   	pop    %esi
+  801013:	5f                   	pop    %edi
+  801014:	5d                   	pop    %ebp
+  801015:	c3                   	ret
+
+00801016 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	57                   	push   %edi
+  80101a:	56                   	push   %esi
+  80101b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801021:	8b 55 08             	mov    0x8(%ebp),%edx
+  801024:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801027:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80102c:	89 df                	mov    %ebx,%edi
+  80102e:	89 de                	mov    %ebx,%esi
+  801030:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801032:	5b                   	pop    %ebx
+  801033:	5e                   	pop    %esi
+  801034:	5f                   	pop    %edi
+  801035:	5d                   	pop    %ebp
+  801036:	c3                   	ret
+
+00801037 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801042:	8b 55 08             	mov    0x8(%ebp),%edx
+  801045:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801048:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80104d:	89 df                	mov    %ebx,%edi
+  80104f:	89 de                	mov    %ebx,%esi
+  801051:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801053:	5b                   	pop    %ebx
+  801054:	5e                   	pop    %esi
+  801055:	5f                   	pop    %edi
+  801056:	5d                   	pop    %ebp
+  801057:	c3                   	ret
+
+00801058 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801058:	55                   	push   %ebp
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	53                   	push   %ebx
+  80105c:	83 ec 04             	sub    $0x4,%esp
+  80105f:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801062:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  801064:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  801067:	f6 c2 02             	test   $0x2,%dl
+  80106a:	74 7b                	je     8010e7 <pgfault+0x8f>
+  80106c:	89 c1                	mov    %eax,%ecx
+  80106e:	c1 e9 0c             	shr    $0xc,%ecx
+  801071:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  801078:	f6 c5 08             	test   $0x8,%ch
+  80107b:	74 6a                	je     8010e7 <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80107d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801082:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801084:	83 ec 04             	sub    $0x4,%esp
+  801087:	6a 07                	push   $0x7
+  801089:	68 00 f0 7f 00       	push   $0x7ff000
+  80108e:	6a 00                	push   $0x0
+  801090:	e8 9e fb ff ff       	call   800c33 <sys_page_alloc>
+  801095:	83 c4 10             	add    $0x10,%esp
+  801098:	85 c0                	test   %eax,%eax
+  80109a:	78 61                	js     8010fd <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  80109c:	83 ec 04             	sub    $0x4,%esp
+  80109f:	68 00 10 00 00       	push   $0x1000
+  8010a4:	53                   	push   %ebx
+  8010a5:	68 00 f0 7f 00       	push   $0x7ff000
+  8010aa:	e8 9d f8 ff ff       	call   80094c <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  8010af:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8010b6:	53                   	push   %ebx
+  8010b7:	6a 00                	push   $0x0
+  8010b9:	68 00 f0 7f 00       	push   $0x7ff000
+  8010be:	6a 00                	push   $0x0
+  8010c0:	e8 f4 fb ff ff       	call   800cb9 <sys_page_map>
+  8010c5:	83 c4 20             	add    $0x20,%esp
+  8010c8:	85 c0                	test   %eax,%eax
+  8010ca:	78 43                	js     80110f <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  8010cc:	83 ec 08             	sub    $0x8,%esp
+  8010cf:	68 00 f0 7f 00       	push   $0x7ff000
+  8010d4:	6a 00                	push   $0x0
+  8010d6:	e8 20 fc ff ff       	call   800cfb <sys_page_unmap>
+  8010db:	83 c4 10             	add    $0x10,%esp
+  8010de:	85 c0                	test   %eax,%eax
+  8010e0:	78 3f                	js     801121 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  8010e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010e5:	c9                   	leave
+  8010e6:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  8010e7:	83 ec 0c             	sub    $0xc,%esp
+  8010ea:	50                   	push   %eax
+  8010eb:	52                   	push   %edx
+  8010ec:	68 4a 2e 80 00       	push   $0x802e4a
+  8010f1:	6a 19                	push   $0x19
+  8010f3:	68 5b 2e 80 00       	push   $0x802e5b
+  8010f8:	e8 ce 13 00 00       	call   8024cb <_panic>
+		panic("sys_page_alloc: %e", r);
+  8010fd:	50                   	push   %eax
+  8010fe:	68 66 2e 80 00       	push   $0x802e66
+  801103:	6a 24                	push   $0x24
+  801105:	68 5b 2e 80 00       	push   $0x802e5b
+  80110a:	e8 bc 13 00 00       	call   8024cb <_panic>
+		panic("sys_page_map: %e", r);
+  80110f:	50                   	push   %eax
+  801110:	68 79 2e 80 00       	push   $0x802e79
+  801115:	6a 29                	push   $0x29
+  801117:	68 5b 2e 80 00       	push   $0x802e5b
+  80111c:	e8 aa 13 00 00       	call   8024cb <_panic>
+		panic("sys_page_unmap: %e", r);
+  801121:	50                   	push   %eax
+  801122:	68 8a 2e 80 00       	push   $0x802e8a
+  801127:	6a 2c                	push   $0x2c
+  801129:	68 5b 2e 80 00       	push   $0x802e5b
+  80112e:	e8 98 13 00 00       	call   8024cb <_panic>
+
+00801133 <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  801133:	55                   	push   %ebp
+  801134:	89 e5                	mov    %esp,%ebp
+  801136:	57                   	push   %edi
+  801137:	56                   	push   %esi
+  801138:	53                   	push   %ebx
+  801139:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80113c:	68 58 10 80 00       	push   $0x801058
+  801141:	e8 cb 13 00 00       	call   802511 <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  801146:	83 c4 08             	add    $0x8,%esp
+  801149:	6a 01                	push   $0x1
+  80114b:	6a 00                	push   $0x0
+  80114d:	e8 9f fa ff ff       	call   800bf1 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  801152:	e8 7b fa ff ff       	call   800bd2 <sys_fork_cow>
+  801157:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  80115a:	83 c4 10             	add    $0x10,%esp
+  80115d:	85 c0                	test   %eax,%eax
+  80115f:	74 2c                	je     80118d <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  801161:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  801165:	0f 85 8b 01 00 00    	jne    8012f6 <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80116b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801170:	cd 30                	int    $0x30
+  801172:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  801175:	85 c0                	test   %eax,%eax
+  801177:	78 30                	js     8011a9 <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  801179:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80117e:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  801183:	74 36                	je     8011bb <fork+0x88>
+  801185:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801188:	e9 99 00 00 00       	jmp    801226 <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80118d:	e8 02 fa ff ff       	call   800b94 <sys_getenvid>
+  801192:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801197:	c1 e0 09             	shl    $0x9,%eax
+  80119a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80119f:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  8011a4:	e9 4d 01 00 00       	jmp    8012f6 <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  8011a9:	50                   	push   %eax
+  8011aa:	68 9d 2e 80 00       	push   $0x802e9d
+  8011af:	6a 7d                	push   $0x7d
+  8011b1:	68 5b 2e 80 00       	push   $0x802e5b
+  8011b6:	e8 10 13 00 00       	call   8024cb <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8011bb:	e8 d4 f9 ff ff       	call   800b94 <sys_getenvid>
+  8011c0:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8011c5:	c1 e0 09             	shl    $0x9,%eax
+  8011c8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8011cd:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  8011d2:	e9 1f 01 00 00       	jmp    8012f6 <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  8011d7:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8011de:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8011e1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8011e9:	83 ec 0c             	sub    $0xc,%esp
+  8011ec:	50                   	push   %eax
+  8011ed:	56                   	push   %esi
+  8011ee:	ff 75 e4             	push   -0x1c(%ebp)
+  8011f1:	56                   	push   %esi
+  8011f2:	6a 00                	push   $0x0
+  8011f4:	e8 c0 fa ff ff       	call   800cb9 <sys_page_map>
+  8011f9:	83 c4 20             	add    $0x20,%esp
+  8011fc:	85 c0                	test   %eax,%eax
+  8011fe:	0f 88 98 00 00 00    	js     80129c <fork+0x169>
+	if (perm & PTE_COW) {
+  801204:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  80120b:	0f 85 61 01 00 00    	jne    801372 <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801211:	83 c7 01             	add    $0x1,%edi
+  801214:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80121a:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  801220:	0f 84 88 00 00 00    	je     8012ae <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  801226:	89 f0                	mov    %esi,%eax
+  801228:	c1 e8 16             	shr    $0x16,%eax
+  80122b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801232:	25 81 00 00 00       	and    $0x81,%eax
+  801237:	83 f8 01             	cmp    $0x1,%eax
+  80123a:	75 d5                	jne    801211 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  80123c:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  801243:	a8 01                	test   $0x1,%al
+  801245:	74 ca                	je     801211 <fork+0xde>
+  801247:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  80124d:	74 c2                	je     801211 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  80124f:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  801251:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801258:	f6 c4 04             	test   $0x4,%ah
+  80125b:	0f 85 76 ff ff ff    	jne    8011d7 <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  801261:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801268:	a8 02                	test   $0x2,%al
+  80126a:	0f 85 dc 00 00 00    	jne    80134c <fork+0x219>
+  801270:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801277:	f6 c4 08             	test   $0x8,%ah
+  80127a:	0f 85 cc 00 00 00    	jne    80134c <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801280:	83 ec 0c             	sub    $0xc,%esp
+  801283:	6a 05                	push   $0x5
+  801285:	56                   	push   %esi
+  801286:	ff 75 e4             	push   -0x1c(%ebp)
+  801289:	56                   	push   %esi
+  80128a:	6a 00                	push   $0x0
+  80128c:	e8 28 fa ff ff       	call   800cb9 <sys_page_map>
+  801291:	83 c4 20             	add    $0x20,%esp
+  801294:	85 c0                	test   %eax,%eax
+  801296:	0f 89 75 ff ff ff    	jns    801211 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  80129c:	50                   	push   %eax
+  80129d:	68 79 2e 80 00       	push   $0x802e79
+  8012a2:	6a 48                	push   $0x48
+  8012a4:	68 5b 2e 80 00       	push   $0x802e5b
+  8012a9:	e8 1d 12 00 00       	call   8024cb <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  8012ae:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8012b1:	83 ec 04             	sub    $0x4,%esp
+  8012b4:	6a 07                	push   $0x7
+  8012b6:	68 00 f0 bf ee       	push   $0xeebff000
+  8012bb:	53                   	push   %ebx
+  8012bc:	e8 72 f9 ff ff       	call   800c33 <sys_page_alloc>
+  8012c1:	83 c4 10             	add    $0x10,%esp
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	78 39                	js     801301 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8012c8:	a1 08 50 80 00       	mov    0x805008,%eax
+  8012cd:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  8012d3:	83 ec 08             	sub    $0x8,%esp
+  8012d6:	50                   	push   %eax
+  8012d7:	53                   	push   %ebx
+  8012d8:	e8 51 fc ff ff       	call   800f2e <sys_env_set_pgfault_upcall>
+  8012dd:	83 c4 10             	add    $0x10,%esp
+  8012e0:	85 c0                	test   %eax,%eax
+  8012e2:	78 36                	js     80131a <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8012e4:	83 ec 08             	sub    $0x8,%esp
+  8012e7:	6a 02                	push   $0x2
+  8012e9:	53                   	push   %ebx
+  8012ea:	e8 18 fb ff ff       	call   800e07 <sys_env_set_status>
+  8012ef:	83 c4 10             	add    $0x10,%esp
+  8012f2:	85 c0                	test   %eax,%eax
+  8012f4:	78 3d                	js     801333 <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  8012f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fc:	5b                   	pop    %ebx
+  8012fd:	5e                   	pop    %esi
+  8012fe:	5f                   	pop    %edi
+  8012ff:	5d                   	pop    %ebp
+  801300:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  801301:	83 ec 0c             	sub    $0xc,%esp
+  801304:	53                   	push   %ebx
+  801305:	50                   	push   %eax
+  801306:	68 c4 2e 80 00       	push   $0x802ec4
+  80130b:	68 92 00 00 00       	push   $0x92
+  801310:	68 5b 2e 80 00       	push   $0x802e5b
+  801315:	e8 b1 11 00 00       	call   8024cb <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  80131a:	83 ec 0c             	sub    $0xc,%esp
+  80131d:	53                   	push   %ebx
+  80131e:	50                   	push   %eax
+  80131f:	68 e8 2e 80 00       	push   $0x802ee8
+  801324:	68 95 00 00 00       	push   $0x95
+  801329:	68 5b 2e 80 00       	push   $0x802e5b
+  80132e:	e8 98 11 00 00       	call   8024cb <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  801333:	83 ec 0c             	sub    $0xc,%esp
+  801336:	53                   	push   %ebx
+  801337:	50                   	push   %eax
+  801338:	68 18 2f 80 00       	push   $0x802f18
+  80133d:	68 98 00 00 00       	push   $0x98
+  801342:	68 5b 2e 80 00       	push   $0x802e5b
+  801347:	e8 7f 11 00 00       	call   8024cb <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  80134c:	83 ec 0c             	sub    $0xc,%esp
+  80134f:	68 05 08 00 00       	push   $0x805
+  801354:	53                   	push   %ebx
+  801355:	ff 75 e4             	push   -0x1c(%ebp)
+  801358:	53                   	push   %ebx
+  801359:	6a 00                	push   $0x0
+  80135b:	e8 59 f9 ff ff       	call   800cb9 <sys_page_map>
+  801360:	83 c4 20             	add    $0x20,%esp
+  801363:	85 c0                	test   %eax,%eax
+  801365:	0f 88 31 ff ff ff    	js     80129c <fork+0x169>
+		perm |= PTE_COW;
+  80136b:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  801372:	83 ec 0c             	sub    $0xc,%esp
+  801375:	ff 75 e0             	push   -0x20(%ebp)
+  801378:	53                   	push   %ebx
+  801379:	6a 00                	push   $0x0
+  80137b:	53                   	push   %ebx
+  80137c:	6a 00                	push   $0x0
+  80137e:	e8 36 f9 ff ff       	call   800cb9 <sys_page_map>
+  801383:	83 c4 20             	add    $0x20,%esp
+  801386:	85 c0                	test   %eax,%eax
+  801388:	0f 89 83 fe ff ff    	jns    801211 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  80138e:	50                   	push   %eax
+  80138f:	68 79 2e 80 00       	push   $0x802e79
+  801394:	6a 4c                	push   $0x4c
+  801396:	68 5b 2e 80 00       	push   $0x802e5b
+  80139b:	e8 2b 11 00 00       	call   8024cb <_panic>
+
+008013a0 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8013a0:	55                   	push   %ebp
+  8013a1:	89 e5                	mov    %esp,%ebp
+  8013a3:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8013a6:	68 ad 2e 80 00       	push   $0x802ead
+  8013ab:	68 a0 00 00 00       	push   $0xa0
+  8013b0:	68 5b 2e 80 00       	push   $0x802e5b
+  8013b5:	e8 11 11 00 00       	call   8024cb <_panic>
+
+008013ba <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013ba:	55                   	push   %ebp
+  8013bb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013c0:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013c5:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013c8:	5d                   	pop    %ebp
+  8013c9:	c3                   	ret
+
+008013ca <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013ca:	55                   	push   %ebp
+  8013cb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013d0:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013d5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013da:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013df:	5d                   	pop    %ebp
+  8013e0:	c3                   	ret
+
+008013e1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013e1:	55                   	push   %ebp
+  8013e2:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8013e4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013e9:	eb 02                	jmp    8013ed <fd_alloc+0xc>
+  8013eb:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013ed:	89 c2                	mov    %eax,%edx
+  8013ef:	c1 ea 16             	shr    $0x16,%edx
+  8013f2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8013f9:	f6 c2 01             	test   $0x1,%dl
+  8013fc:	74 2b                	je     801429 <fd_alloc+0x48>
+  8013fe:	89 c2                	mov    %eax,%edx
+  801400:	c1 ea 0c             	shr    $0xc,%edx
+  801403:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80140a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801410:	f6 c1 01             	test   $0x1,%cl
+  801413:	74 14                	je     801429 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801415:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80141b:	75 ce                	jne    8013eb <fd_alloc+0xa>
+  80141d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801422:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801427:	eb 05                	jmp    80142e <fd_alloc+0x4d>
+			return 0;
+  801429:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80142e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801431:	89 02                	mov    %eax,(%edx)
+}
+  801433:	89 c8                	mov    %ecx,%eax
+  801435:	5d                   	pop    %ebp
+  801436:	c3                   	ret
+
+00801437 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80143d:	83 f8 1f             	cmp    $0x1f,%eax
+  801440:	77 30                	ja     801472 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801442:	c1 e0 0c             	shl    $0xc,%eax
+  801445:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80144a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801450:	f6 c2 01             	test   $0x1,%dl
+  801453:	74 24                	je     801479 <fd_lookup+0x42>
+  801455:	89 c2                	mov    %eax,%edx
+  801457:	c1 ea 0c             	shr    $0xc,%edx
+  80145a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801461:	f6 c2 01             	test   $0x1,%dl
+  801464:	74 1a                	je     801480 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801466:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801469:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80146b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801470:	5d                   	pop    %ebp
+  801471:	c3                   	ret
+		return -E_INVAL;
+  801472:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801477:	eb f7                	jmp    801470 <fd_lookup+0x39>
+		return -E_INVAL;
+  801479:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80147e:	eb f0                	jmp    801470 <fd_lookup+0x39>
+  801480:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801485:	eb e9                	jmp    801470 <fd_lookup+0x39>
+
+00801487 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801487:	55                   	push   %ebp
+  801488:	89 e5                	mov    %esp,%ebp
+  80148a:	53                   	push   %ebx
+  80148b:	83 ec 04             	sub    $0x4,%esp
+  80148e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801491:	b8 00 00 00 00       	mov    $0x0,%eax
+  801496:	eb 03                	jmp    80149b <dev_lookup+0x14>
+  801498:	83 c0 01             	add    $0x1,%eax
+  80149b:	8b 1c 85 bc 2f 80 00 	mov    0x802fbc(,%eax,4),%ebx
+  8014a2:	85 db                	test   %ebx,%ebx
+  8014a4:	74 0b                	je     8014b1 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8014a6:	39 13                	cmp    %edx,(%ebx)
+  8014a8:	75 ee                	jne    801498 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8014aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014af:	eb 1f                	jmp    8014d0 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014b1:	a1 08 50 80 00       	mov    0x805008,%eax
+  8014b6:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8014b9:	83 ec 04             	sub    $0x4,%esp
+  8014bc:	52                   	push   %edx
+  8014bd:	50                   	push   %eax
+  8014be:	68 40 2f 80 00       	push   $0x802f40
+  8014c3:	e8 10 ed ff ff       	call   8001d8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8014c8:	83 c4 10             	add    $0x10,%esp
+  8014cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014d3:	89 1a                	mov    %ebx,(%edx)
+}
+  8014d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014d8:	c9                   	leave
+  8014d9:	c3                   	ret
+
+008014da <fd_close>:
+{
+  8014da:	55                   	push   %ebp
+  8014db:	89 e5                	mov    %esp,%ebp
+  8014dd:	57                   	push   %edi
+  8014de:	56                   	push   %esi
+  8014df:	53                   	push   %ebx
+  8014e0:	83 ec 24             	sub    $0x24,%esp
+  8014e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014e6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014e9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014ec:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014ed:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014f3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014f6:	50                   	push   %eax
+  8014f7:	e8 3b ff ff ff       	call   801437 <fd_lookup>
+  8014fc:	89 c3                	mov    %eax,%ebx
+  8014fe:	83 c4 10             	add    $0x10,%esp
+  801501:	85 c0                	test   %eax,%eax
+  801503:	78 05                	js     80150a <fd_close+0x30>
+	    || fd != fd2)
+  801505:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801508:	74 16                	je     801520 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80150a:	89 f8                	mov    %edi,%eax
+  80150c:	84 c0                	test   %al,%al
+  80150e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801513:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801516:	89 d8                	mov    %ebx,%eax
+  801518:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80151b:	5b                   	pop    %ebx
+  80151c:	5e                   	pop    %esi
+  80151d:	5f                   	pop    %edi
+  80151e:	5d                   	pop    %ebp
+  80151f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801520:	83 ec 08             	sub    $0x8,%esp
+  801523:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801526:	50                   	push   %eax
+  801527:	ff 36                	push   (%esi)
+  801529:	e8 59 ff ff ff       	call   801487 <dev_lookup>
+  80152e:	89 c3                	mov    %eax,%ebx
+  801530:	83 c4 10             	add    $0x10,%esp
+  801533:	85 c0                	test   %eax,%eax
+  801535:	78 1a                	js     801551 <fd_close+0x77>
+		if (dev->dev_close)
+  801537:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80153a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80153d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801542:	85 c0                	test   %eax,%eax
+  801544:	74 0b                	je     801551 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801546:	83 ec 0c             	sub    $0xc,%esp
+  801549:	56                   	push   %esi
+  80154a:	ff d0                	call   *%eax
+  80154c:	89 c3                	mov    %eax,%ebx
+  80154e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801551:	83 ec 08             	sub    $0x8,%esp
+  801554:	56                   	push   %esi
+  801555:	6a 00                	push   $0x0
+  801557:	e8 9f f7 ff ff       	call   800cfb <sys_page_unmap>
+	return r;
+  80155c:	83 c4 10             	add    $0x10,%esp
+  80155f:	eb b5                	jmp    801516 <fd_close+0x3c>
+
+00801561 <close>:
+
+int
+close(int fdnum)
+{
+  801561:	55                   	push   %ebp
+  801562:	89 e5                	mov    %esp,%ebp
+  801564:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801567:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80156a:	50                   	push   %eax
+  80156b:	ff 75 08             	push   0x8(%ebp)
+  80156e:	e8 c4 fe ff ff       	call   801437 <fd_lookup>
+  801573:	83 c4 10             	add    $0x10,%esp
+  801576:	85 c0                	test   %eax,%eax
+  801578:	79 02                	jns    80157c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80157a:	c9                   	leave
+  80157b:	c3                   	ret
+		return fd_close(fd, 1);
+  80157c:	83 ec 08             	sub    $0x8,%esp
+  80157f:	6a 01                	push   $0x1
+  801581:	ff 75 f4             	push   -0xc(%ebp)
+  801584:	e8 51 ff ff ff       	call   8014da <fd_close>
+  801589:	83 c4 10             	add    $0x10,%esp
+  80158c:	eb ec                	jmp    80157a <close+0x19>
+
+0080158e <close_all>:
+
+void
+close_all(void)
+{
+  80158e:	55                   	push   %ebp
+  80158f:	89 e5                	mov    %esp,%ebp
+  801591:	53                   	push   %ebx
+  801592:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801595:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80159a:	83 ec 0c             	sub    $0xc,%esp
+  80159d:	53                   	push   %ebx
+  80159e:	e8 be ff ff ff       	call   801561 <close>
+	for (i = 0; i < MAXFD; i++)
+  8015a3:	83 c3 01             	add    $0x1,%ebx
+  8015a6:	83 c4 10             	add    $0x10,%esp
+  8015a9:	83 fb 20             	cmp    $0x20,%ebx
+  8015ac:	75 ec                	jne    80159a <close_all+0xc>
+}
+  8015ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b1:	c9                   	leave
+  8015b2:	c3                   	ret
+
+008015b3 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015b3:	55                   	push   %ebp
+  8015b4:	89 e5                	mov    %esp,%ebp
+  8015b6:	57                   	push   %edi
+  8015b7:	56                   	push   %esi
+  8015b8:	53                   	push   %ebx
+  8015b9:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015bc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015bf:	50                   	push   %eax
+  8015c0:	ff 75 08             	push   0x8(%ebp)
+  8015c3:	e8 6f fe ff ff       	call   801437 <fd_lookup>
+  8015c8:	89 c3                	mov    %eax,%ebx
+  8015ca:	83 c4 10             	add    $0x10,%esp
+  8015cd:	85 c0                	test   %eax,%eax
+  8015cf:	78 7f                	js     801650 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015d1:	83 ec 0c             	sub    $0xc,%esp
+  8015d4:	ff 75 0c             	push   0xc(%ebp)
+  8015d7:	e8 85 ff ff ff       	call   801561 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8015dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015df:	c1 e6 0c             	shl    $0xc,%esi
+  8015e2:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015e8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015eb:	89 3c 24             	mov    %edi,(%esp)
+  8015ee:	e8 d7 fd ff ff       	call   8013ca <fd2data>
+  8015f3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015f5:	89 34 24             	mov    %esi,(%esp)
+  8015f8:	e8 cd fd ff ff       	call   8013ca <fd2data>
+  8015fd:	83 c4 10             	add    $0x10,%esp
+  801600:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801603:	89 d8                	mov    %ebx,%eax
+  801605:	c1 e8 16             	shr    $0x16,%eax
+  801608:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80160f:	a8 01                	test   $0x1,%al
+  801611:	74 11                	je     801624 <dup+0x71>
+  801613:	89 d8                	mov    %ebx,%eax
+  801615:	c1 e8 0c             	shr    $0xc,%eax
+  801618:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80161f:	f6 c2 01             	test   $0x1,%dl
+  801622:	75 36                	jne    80165a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801624:	89 f8                	mov    %edi,%eax
+  801626:	c1 e8 0c             	shr    $0xc,%eax
+  801629:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801630:	83 ec 0c             	sub    $0xc,%esp
+  801633:	25 07 0e 00 00       	and    $0xe07,%eax
+  801638:	50                   	push   %eax
+  801639:	56                   	push   %esi
+  80163a:	6a 00                	push   $0x0
+  80163c:	57                   	push   %edi
+  80163d:	6a 00                	push   $0x0
+  80163f:	e8 75 f6 ff ff       	call   800cb9 <sys_page_map>
+  801644:	89 c3                	mov    %eax,%ebx
+  801646:	83 c4 20             	add    $0x20,%esp
+  801649:	85 c0                	test   %eax,%eax
+  80164b:	78 33                	js     801680 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80164d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801650:	89 d8                	mov    %ebx,%eax
+  801652:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801655:	5b                   	pop    %ebx
+  801656:	5e                   	pop    %esi
+  801657:	5f                   	pop    %edi
+  801658:	5d                   	pop    %ebp
+  801659:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80165a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801661:	83 ec 0c             	sub    $0xc,%esp
+  801664:	25 07 0e 00 00       	and    $0xe07,%eax
+  801669:	50                   	push   %eax
+  80166a:	ff 75 d4             	push   -0x2c(%ebp)
+  80166d:	6a 00                	push   $0x0
+  80166f:	53                   	push   %ebx
+  801670:	6a 00                	push   $0x0
+  801672:	e8 42 f6 ff ff       	call   800cb9 <sys_page_map>
+  801677:	89 c3                	mov    %eax,%ebx
+  801679:	83 c4 20             	add    $0x20,%esp
+  80167c:	85 c0                	test   %eax,%eax
+  80167e:	79 a4                	jns    801624 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801680:	83 ec 08             	sub    $0x8,%esp
+  801683:	56                   	push   %esi
+  801684:	6a 00                	push   $0x0
+  801686:	e8 70 f6 ff ff       	call   800cfb <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80168b:	83 c4 08             	add    $0x8,%esp
+  80168e:	ff 75 d4             	push   -0x2c(%ebp)
+  801691:	6a 00                	push   $0x0
+  801693:	e8 63 f6 ff ff       	call   800cfb <sys_page_unmap>
+	return r;
+  801698:	83 c4 10             	add    $0x10,%esp
+  80169b:	eb b3                	jmp    801650 <dup+0x9d>
+
+0080169d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80169d:	55                   	push   %ebp
+  80169e:	89 e5                	mov    %esp,%ebp
+  8016a0:	56                   	push   %esi
+  8016a1:	53                   	push   %ebx
+  8016a2:	83 ec 18             	sub    $0x18,%esp
+  8016a5:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016a8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016ab:	50                   	push   %eax
+  8016ac:	56                   	push   %esi
+  8016ad:	e8 85 fd ff ff       	call   801437 <fd_lookup>
+  8016b2:	83 c4 10             	add    $0x10,%esp
+  8016b5:	85 c0                	test   %eax,%eax
+  8016b7:	78 3c                	js     8016f5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016b9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016bc:	83 ec 08             	sub    $0x8,%esp
+  8016bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c2:	50                   	push   %eax
+  8016c3:	ff 33                	push   (%ebx)
+  8016c5:	e8 bd fd ff ff       	call   801487 <dev_lookup>
+  8016ca:	83 c4 10             	add    $0x10,%esp
+  8016cd:	85 c0                	test   %eax,%eax
+  8016cf:	78 24                	js     8016f5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016d1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016d4:	83 e0 03             	and    $0x3,%eax
+  8016d7:	83 f8 01             	cmp    $0x1,%eax
+  8016da:	74 20                	je     8016fc <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8016dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016df:	8b 40 08             	mov    0x8(%eax),%eax
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	74 37                	je     80171d <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016e6:	83 ec 04             	sub    $0x4,%esp
+  8016e9:	ff 75 10             	push   0x10(%ebp)
+  8016ec:	ff 75 0c             	push   0xc(%ebp)
+  8016ef:	53                   	push   %ebx
+  8016f0:	ff d0                	call   *%eax
+  8016f2:	83 c4 10             	add    $0x10,%esp
+}
+  8016f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f8:	5b                   	pop    %ebx
+  8016f9:	5e                   	pop    %esi
+  8016fa:	5d                   	pop    %ebp
+  8016fb:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016fc:	a1 08 50 80 00       	mov    0x805008,%eax
+  801701:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801704:	83 ec 04             	sub    $0x4,%esp
+  801707:	56                   	push   %esi
+  801708:	50                   	push   %eax
+  801709:	68 81 2f 80 00       	push   $0x802f81
+  80170e:	e8 c5 ea ff ff       	call   8001d8 <cprintf>
+		return -E_INVAL;
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80171b:	eb d8                	jmp    8016f5 <read+0x58>
+		return -E_NOT_SUPP;
+  80171d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801722:	eb d1                	jmp    8016f5 <read+0x58>
+
+00801724 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801724:	55                   	push   %ebp
+  801725:	89 e5                	mov    %esp,%ebp
+  801727:	57                   	push   %edi
+  801728:	56                   	push   %esi
+  801729:	53                   	push   %ebx
+  80172a:	83 ec 0c             	sub    $0xc,%esp
+  80172d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801730:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801733:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801738:	eb 02                	jmp    80173c <readn+0x18>
+  80173a:	01 c3                	add    %eax,%ebx
+  80173c:	39 f3                	cmp    %esi,%ebx
+  80173e:	73 21                	jae    801761 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801740:	83 ec 04             	sub    $0x4,%esp
+  801743:	89 f0                	mov    %esi,%eax
+  801745:	29 d8                	sub    %ebx,%eax
+  801747:	50                   	push   %eax
+  801748:	89 d8                	mov    %ebx,%eax
+  80174a:	03 45 0c             	add    0xc(%ebp),%eax
+  80174d:	50                   	push   %eax
+  80174e:	57                   	push   %edi
+  80174f:	e8 49 ff ff ff       	call   80169d <read>
+		if (m < 0)
+  801754:	83 c4 10             	add    $0x10,%esp
+  801757:	85 c0                	test   %eax,%eax
+  801759:	78 04                	js     80175f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80175b:	75 dd                	jne    80173a <readn+0x16>
+  80175d:	eb 02                	jmp    801761 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80175f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801761:	89 d8                	mov    %ebx,%eax
+  801763:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801766:	5b                   	pop    %ebx
+  801767:	5e                   	pop    %esi
+  801768:	5f                   	pop    %edi
+  801769:	5d                   	pop    %ebp
+  80176a:	c3                   	ret
+
+0080176b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80176b:	55                   	push   %ebp
+  80176c:	89 e5                	mov    %esp,%ebp
+  80176e:	56                   	push   %esi
+  80176f:	53                   	push   %ebx
+  801770:	83 ec 18             	sub    $0x18,%esp
+  801773:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801776:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801779:	50                   	push   %eax
+  80177a:	53                   	push   %ebx
+  80177b:	e8 b7 fc ff ff       	call   801437 <fd_lookup>
+  801780:	83 c4 10             	add    $0x10,%esp
+  801783:	85 c0                	test   %eax,%eax
+  801785:	78 37                	js     8017be <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801787:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80178a:	83 ec 08             	sub    $0x8,%esp
+  80178d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801790:	50                   	push   %eax
+  801791:	ff 36                	push   (%esi)
+  801793:	e8 ef fc ff ff       	call   801487 <dev_lookup>
+  801798:	83 c4 10             	add    $0x10,%esp
+  80179b:	85 c0                	test   %eax,%eax
+  80179d:	78 1f                	js     8017be <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80179f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017a3:	74 20                	je     8017c5 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8017a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017a8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017ab:	85 c0                	test   %eax,%eax
+  8017ad:	74 37                	je     8017e6 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8017af:	83 ec 04             	sub    $0x4,%esp
+  8017b2:	ff 75 10             	push   0x10(%ebp)
+  8017b5:	ff 75 0c             	push   0xc(%ebp)
+  8017b8:	56                   	push   %esi
+  8017b9:	ff d0                	call   *%eax
+  8017bb:	83 c4 10             	add    $0x10,%esp
+}
+  8017be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c1:	5b                   	pop    %ebx
+  8017c2:	5e                   	pop    %esi
+  8017c3:	5d                   	pop    %ebp
+  8017c4:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017c5:	a1 08 50 80 00       	mov    0x805008,%eax
+  8017ca:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8017cd:	83 ec 04             	sub    $0x4,%esp
+  8017d0:	53                   	push   %ebx
+  8017d1:	50                   	push   %eax
+  8017d2:	68 9d 2f 80 00       	push   $0x802f9d
+  8017d7:	e8 fc e9 ff ff       	call   8001d8 <cprintf>
+		return -E_INVAL;
+  8017dc:	83 c4 10             	add    $0x10,%esp
+  8017df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e4:	eb d8                	jmp    8017be <write+0x53>
+		return -E_NOT_SUPP;
+  8017e6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017eb:	eb d1                	jmp    8017be <write+0x53>
+
+008017ed <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017ed:	55                   	push   %ebp
+  8017ee:	89 e5                	mov    %esp,%ebp
+  8017f0:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f6:	50                   	push   %eax
+  8017f7:	ff 75 08             	push   0x8(%ebp)
+  8017fa:	e8 38 fc ff ff       	call   801437 <fd_lookup>
+  8017ff:	83 c4 10             	add    $0x10,%esp
+  801802:	85 c0                	test   %eax,%eax
+  801804:	78 0e                	js     801814 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801806:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801809:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80180f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801814:	c9                   	leave
+  801815:	c3                   	ret
+
+00801816 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801816:	55                   	push   %ebp
+  801817:	89 e5                	mov    %esp,%ebp
+  801819:	56                   	push   %esi
+  80181a:	53                   	push   %ebx
+  80181b:	83 ec 18             	sub    $0x18,%esp
+  80181e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801821:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801824:	50                   	push   %eax
+  801825:	53                   	push   %ebx
+  801826:	e8 0c fc ff ff       	call   801437 <fd_lookup>
+  80182b:	83 c4 10             	add    $0x10,%esp
+  80182e:	85 c0                	test   %eax,%eax
+  801830:	78 34                	js     801866 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801832:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801835:	83 ec 08             	sub    $0x8,%esp
+  801838:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80183b:	50                   	push   %eax
+  80183c:	ff 36                	push   (%esi)
+  80183e:	e8 44 fc ff ff       	call   801487 <dev_lookup>
+  801843:	83 c4 10             	add    $0x10,%esp
+  801846:	85 c0                	test   %eax,%eax
+  801848:	78 1c                	js     801866 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80184a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80184e:	74 1d                	je     80186d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801850:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801853:	8b 40 18             	mov    0x18(%eax),%eax
+  801856:	85 c0                	test   %eax,%eax
+  801858:	74 34                	je     80188e <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80185a:	83 ec 08             	sub    $0x8,%esp
+  80185d:	ff 75 0c             	push   0xc(%ebp)
+  801860:	56                   	push   %esi
+  801861:	ff d0                	call   *%eax
+  801863:	83 c4 10             	add    $0x10,%esp
+}
+  801866:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801869:	5b                   	pop    %ebx
+  80186a:	5e                   	pop    %esi
+  80186b:	5d                   	pop    %ebp
+  80186c:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80186d:	a1 08 50 80 00       	mov    0x805008,%eax
+  801872:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801875:	83 ec 04             	sub    $0x4,%esp
+  801878:	53                   	push   %ebx
+  801879:	50                   	push   %eax
+  80187a:	68 60 2f 80 00       	push   $0x802f60
+  80187f:	e8 54 e9 ff ff       	call   8001d8 <cprintf>
+		return -E_INVAL;
+  801884:	83 c4 10             	add    $0x10,%esp
+  801887:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80188c:	eb d8                	jmp    801866 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80188e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801893:	eb d1                	jmp    801866 <ftruncate+0x50>
+
+00801895 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801895:	55                   	push   %ebp
+  801896:	89 e5                	mov    %esp,%ebp
+  801898:	56                   	push   %esi
+  801899:	53                   	push   %ebx
+  80189a:	83 ec 18             	sub    $0x18,%esp
+  80189d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018a0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018a3:	50                   	push   %eax
+  8018a4:	ff 75 08             	push   0x8(%ebp)
+  8018a7:	e8 8b fb ff ff       	call   801437 <fd_lookup>
+  8018ac:	83 c4 10             	add    $0x10,%esp
+  8018af:	85 c0                	test   %eax,%eax
+  8018b1:	78 49                	js     8018fc <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018b3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018b6:	83 ec 08             	sub    $0x8,%esp
+  8018b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018bc:	50                   	push   %eax
+  8018bd:	ff 36                	push   (%esi)
+  8018bf:	e8 c3 fb ff ff       	call   801487 <dev_lookup>
+  8018c4:	83 c4 10             	add    $0x10,%esp
+  8018c7:	85 c0                	test   %eax,%eax
+  8018c9:	78 31                	js     8018fc <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8018cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018ce:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018d2:	74 2f                	je     801903 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018d4:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018d7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018de:	00 00 00 
+	stat->st_isdir = 0;
+  8018e1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018e8:	00 00 00 
+	stat->st_dev = dev;
+  8018eb:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018f1:	83 ec 08             	sub    $0x8,%esp
+  8018f4:	53                   	push   %ebx
+  8018f5:	56                   	push   %esi
+  8018f6:	ff 50 14             	call   *0x14(%eax)
+  8018f9:	83 c4 10             	add    $0x10,%esp
+}
+  8018fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ff:	5b                   	pop    %ebx
+  801900:	5e                   	pop    %esi
+  801901:	5d                   	pop    %ebp
+  801902:	c3                   	ret
+		return -E_NOT_SUPP;
+  801903:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801908:	eb f2                	jmp    8018fc <fstat+0x67>
+
+0080190a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80190a:	55                   	push   %ebp
+  80190b:	89 e5                	mov    %esp,%ebp
+  80190d:	56                   	push   %esi
+  80190e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80190f:	83 ec 08             	sub    $0x8,%esp
+  801912:	6a 00                	push   $0x0
+  801914:	ff 75 08             	push   0x8(%ebp)
+  801917:	e8 e4 01 00 00       	call   801b00 <open>
+  80191c:	89 c3                	mov    %eax,%ebx
+  80191e:	83 c4 10             	add    $0x10,%esp
+  801921:	85 c0                	test   %eax,%eax
+  801923:	78 1b                	js     801940 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801925:	83 ec 08             	sub    $0x8,%esp
+  801928:	ff 75 0c             	push   0xc(%ebp)
+  80192b:	50                   	push   %eax
+  80192c:	e8 64 ff ff ff       	call   801895 <fstat>
+  801931:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801933:	89 1c 24             	mov    %ebx,(%esp)
+  801936:	e8 26 fc ff ff       	call   801561 <close>
+	return r;
+  80193b:	83 c4 10             	add    $0x10,%esp
+  80193e:	89 f3                	mov    %esi,%ebx
+}
+  801940:	89 d8                	mov    %ebx,%eax
+  801942:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801945:	5b                   	pop    %ebx
+  801946:	5e                   	pop    %esi
+  801947:	5d                   	pop    %ebp
+  801948:	c3                   	ret
+
+00801949 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	56                   	push   %esi
+  80194d:	53                   	push   %ebx
+  80194e:	89 c6                	mov    %eax,%esi
+  801950:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801952:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801959:	74 27                	je     801982 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80195b:	6a 07                	push   $0x7
+  80195d:	68 00 60 80 00       	push   $0x806000
+  801962:	56                   	push   %esi
+  801963:	ff 35 00 50 80 00    	push   0x805000
+  801969:	e8 ac 0c 00 00       	call   80261a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80196e:	83 c4 0c             	add    $0xc,%esp
+  801971:	6a 00                	push   $0x0
+  801973:	53                   	push   %ebx
+  801974:	6a 00                	push   $0x0
+  801976:	e8 27 0c 00 00       	call   8025a2 <ipc_recv>
+}
+  80197b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80197e:	5b                   	pop    %ebx
+  80197f:	5e                   	pop    %esi
+  801980:	5d                   	pop    %ebp
+  801981:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801982:	83 ec 0c             	sub    $0xc,%esp
+  801985:	6a 01                	push   $0x1
+  801987:	e8 e2 0c 00 00       	call   80266e <ipc_find_env>
+  80198c:	a3 00 50 80 00       	mov    %eax,0x805000
+  801991:	83 c4 10             	add    $0x10,%esp
+  801994:	eb c5                	jmp    80195b <fsipc+0x12>
+
+00801996 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801996:	55                   	push   %ebp
+  801997:	89 e5                	mov    %esp,%ebp
+  801999:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80199c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80199f:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019a2:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8019a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019aa:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019b9:	e8 8b ff ff ff       	call   801949 <fsipc>
+}
+  8019be:	c9                   	leave
+  8019bf:	c3                   	ret
+
+008019c0 <devfile_flush>:
+{
+  8019c0:	55                   	push   %ebp
+  8019c1:	89 e5                	mov    %esp,%ebp
+  8019c3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019cc:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8019d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019db:	e8 69 ff ff ff       	call   801949 <fsipc>
+}
+  8019e0:	c9                   	leave
+  8019e1:	c3                   	ret
+
+008019e2 <devfile_stat>:
+{
+  8019e2:	55                   	push   %ebp
+  8019e3:	89 e5                	mov    %esp,%ebp
+  8019e5:	53                   	push   %ebx
+  8019e6:	83 ec 04             	sub    $0x4,%esp
+  8019e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019f2:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019fc:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a01:	e8 43 ff ff ff       	call   801949 <fsipc>
+  801a06:	85 c0                	test   %eax,%eax
+  801a08:	78 2c                	js     801a36 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a0a:	83 ec 08             	sub    $0x8,%esp
+  801a0d:	68 00 60 80 00       	push   $0x806000
+  801a12:	53                   	push   %ebx
+  801a13:	e8 ae ed ff ff       	call   8007c6 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a18:	a1 80 60 80 00       	mov    0x806080,%eax
+  801a1d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a23:	a1 84 60 80 00       	mov    0x806084,%eax
+  801a28:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801a2e:	83 c4 10             	add    $0x10,%esp
+  801a31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a39:	c9                   	leave
+  801a3a:	c3                   	ret
+
+00801a3b <devfile_write>:
+{
+  801a3b:	55                   	push   %ebp
+  801a3c:	89 e5                	mov    %esp,%ebp
+  801a3e:	83 ec 0c             	sub    $0xc,%esp
+  801a41:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a44:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a49:	39 d0                	cmp    %edx,%eax
+  801a4b:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a51:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a54:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801a5a:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a5f:	50                   	push   %eax
+  801a60:	ff 75 0c             	push   0xc(%ebp)
+  801a63:	68 08 60 80 00       	push   $0x806008
+  801a68:	e8 df ee ff ff       	call   80094c <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a72:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a77:	e8 cd fe ff ff       	call   801949 <fsipc>
+}
+  801a7c:	c9                   	leave
+  801a7d:	c3                   	ret
+
+00801a7e <devfile_read>:
+{
+  801a7e:	55                   	push   %ebp
+  801a7f:	89 e5                	mov    %esp,%ebp
+  801a81:	56                   	push   %esi
+  801a82:	53                   	push   %ebx
+  801a83:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a86:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a89:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a8c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801a91:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a9c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801aa1:	e8 a3 fe ff ff       	call   801949 <fsipc>
+  801aa6:	89 c3                	mov    %eax,%ebx
+  801aa8:	85 c0                	test   %eax,%eax
+  801aaa:	78 1f                	js     801acb <devfile_read+0x4d>
+	assert(r <= n);
+  801aac:	39 c6                	cmp    %eax,%esi
+  801aae:	72 24                	jb     801ad4 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801ab0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ab5:	7f 33                	jg     801aea <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ab7:	83 ec 04             	sub    $0x4,%esp
+  801aba:	50                   	push   %eax
+  801abb:	68 00 60 80 00       	push   $0x806000
+  801ac0:	ff 75 0c             	push   0xc(%ebp)
+  801ac3:	e8 84 ee ff ff       	call   80094c <memmove>
+	return r;
+  801ac8:	83 c4 10             	add    $0x10,%esp
+}
+  801acb:	89 d8                	mov    %ebx,%eax
+  801acd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ad0:	5b                   	pop    %ebx
+  801ad1:	5e                   	pop    %esi
+  801ad2:	5d                   	pop    %ebp
+  801ad3:	c3                   	ret
+	assert(r <= n);
+  801ad4:	68 d0 2f 80 00       	push   $0x802fd0
+  801ad9:	68 d7 2f 80 00       	push   $0x802fd7
+  801ade:	6a 7c                	push   $0x7c
+  801ae0:	68 ec 2f 80 00       	push   $0x802fec
+  801ae5:	e8 e1 09 00 00       	call   8024cb <_panic>
+	assert(r <= PGSIZE);
+  801aea:	68 f7 2f 80 00       	push   $0x802ff7
+  801aef:	68 d7 2f 80 00       	push   $0x802fd7
+  801af4:	6a 7d                	push   $0x7d
+  801af6:	68 ec 2f 80 00       	push   $0x802fec
+  801afb:	e8 cb 09 00 00       	call   8024cb <_panic>
+
+00801b00 <open>:
+{
+  801b00:	55                   	push   %ebp
+  801b01:	89 e5                	mov    %esp,%ebp
+  801b03:	56                   	push   %esi
+  801b04:	53                   	push   %ebx
+  801b05:	83 ec 1c             	sub    $0x1c,%esp
+  801b08:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b0b:	56                   	push   %esi
+  801b0c:	e8 7a ec ff ff       	call   80078b <strlen>
+  801b11:	83 c4 10             	add    $0x10,%esp
+  801b14:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b19:	7f 6c                	jg     801b87 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b1b:	83 ec 0c             	sub    $0xc,%esp
+  801b1e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b21:	50                   	push   %eax
+  801b22:	e8 ba f8 ff ff       	call   8013e1 <fd_alloc>
+  801b27:	89 c3                	mov    %eax,%ebx
+  801b29:	83 c4 10             	add    $0x10,%esp
+  801b2c:	85 c0                	test   %eax,%eax
+  801b2e:	78 3c                	js     801b6c <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b30:	83 ec 08             	sub    $0x8,%esp
+  801b33:	56                   	push   %esi
+  801b34:	68 00 60 80 00       	push   $0x806000
+  801b39:	e8 88 ec ff ff       	call   8007c6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b41:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b46:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b49:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b4e:	e8 f6 fd ff ff       	call   801949 <fsipc>
+  801b53:	89 c3                	mov    %eax,%ebx
+  801b55:	83 c4 10             	add    $0x10,%esp
+  801b58:	85 c0                	test   %eax,%eax
+  801b5a:	78 19                	js     801b75 <open+0x75>
+	return fd2num(fd);
+  801b5c:	83 ec 0c             	sub    $0xc,%esp
+  801b5f:	ff 75 f4             	push   -0xc(%ebp)
+  801b62:	e8 53 f8 ff ff       	call   8013ba <fd2num>
+  801b67:	89 c3                	mov    %eax,%ebx
+  801b69:	83 c4 10             	add    $0x10,%esp
+}
+  801b6c:	89 d8                	mov    %ebx,%eax
+  801b6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b71:	5b                   	pop    %ebx
+  801b72:	5e                   	pop    %esi
+  801b73:	5d                   	pop    %ebp
+  801b74:	c3                   	ret
+		fd_close(fd, 0);
+  801b75:	83 ec 08             	sub    $0x8,%esp
+  801b78:	6a 00                	push   $0x0
+  801b7a:	ff 75 f4             	push   -0xc(%ebp)
+  801b7d:	e8 58 f9 ff ff       	call   8014da <fd_close>
+		return r;
+  801b82:	83 c4 10             	add    $0x10,%esp
+  801b85:	eb e5                	jmp    801b6c <open+0x6c>
+		return -E_BAD_PATH;
+  801b87:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b8c:	eb de                	jmp    801b6c <open+0x6c>
+
+00801b8e <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b8e:	55                   	push   %ebp
+  801b8f:	89 e5                	mov    %esp,%ebp
+  801b91:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b94:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b99:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b9e:	e8 a6 fd ff ff       	call   801949 <fsipc>
+}
+  801ba3:	c9                   	leave
+  801ba4:	c3                   	ret
+
+00801ba5 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ba5:	55                   	push   %ebp
+  801ba6:	89 e5                	mov    %esp,%ebp
+  801ba8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801bab:	68 03 30 80 00       	push   $0x803003
+  801bb0:	ff 75 0c             	push   0xc(%ebp)
+  801bb3:	e8 0e ec ff ff       	call   8007c6 <strcpy>
+	return 0;
+}
+  801bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bbd:	c9                   	leave
+  801bbe:	c3                   	ret
+
+00801bbf <devsock_close>:
+{
+  801bbf:	55                   	push   %ebp
+  801bc0:	89 e5                	mov    %esp,%ebp
+  801bc2:	53                   	push   %ebx
+  801bc3:	83 ec 10             	sub    $0x10,%esp
+  801bc6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801bc9:	53                   	push   %ebx
+  801bca:	e8 af 0a 00 00       	call   80267e <pageref>
+  801bcf:	89 c2                	mov    %eax,%edx
+  801bd1:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801bd9:	83 fa 01             	cmp    $0x1,%edx
+  801bdc:	74 05                	je     801be3 <devsock_close+0x24>
+}
+  801bde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be1:	c9                   	leave
+  801be2:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801be3:	83 ec 0c             	sub    $0xc,%esp
+  801be6:	ff 73 0c             	push   0xc(%ebx)
+  801be9:	e8 b7 02 00 00       	call   801ea5 <nsipc_close>
+  801bee:	83 c4 10             	add    $0x10,%esp
+  801bf1:	eb eb                	jmp    801bde <devsock_close+0x1f>
+
+00801bf3 <devsock_write>:
+{
+  801bf3:	55                   	push   %ebp
+  801bf4:	89 e5                	mov    %esp,%ebp
+  801bf6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801bf9:	6a 00                	push   $0x0
+  801bfb:	ff 75 10             	push   0x10(%ebp)
+  801bfe:	ff 75 0c             	push   0xc(%ebp)
+  801c01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c04:	ff 70 0c             	push   0xc(%eax)
+  801c07:	e8 79 03 00 00       	call   801f85 <nsipc_send>
+}
+  801c0c:	c9                   	leave
+  801c0d:	c3                   	ret
+
+00801c0e <devsock_read>:
+{
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+  801c11:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c14:	6a 00                	push   $0x0
+  801c16:	ff 75 10             	push   0x10(%ebp)
+  801c19:	ff 75 0c             	push   0xc(%ebp)
+  801c1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c1f:	ff 70 0c             	push   0xc(%eax)
+  801c22:	e8 ef 02 00 00       	call   801f16 <nsipc_recv>
+}
+  801c27:	c9                   	leave
+  801c28:	c3                   	ret
+
+00801c29 <fd2sockid>:
+{
+  801c29:	55                   	push   %ebp
+  801c2a:	89 e5                	mov    %esp,%ebp
+  801c2c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c2f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c32:	52                   	push   %edx
+  801c33:	50                   	push   %eax
+  801c34:	e8 fe f7 ff ff       	call   801437 <fd_lookup>
+  801c39:	83 c4 10             	add    $0x10,%esp
+  801c3c:	85 c0                	test   %eax,%eax
+  801c3e:	78 10                	js     801c50 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c43:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801c49:	39 08                	cmp    %ecx,(%eax)
+  801c4b:	75 05                	jne    801c52 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801c4d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801c50:	c9                   	leave
+  801c51:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c52:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c57:	eb f7                	jmp    801c50 <fd2sockid+0x27>
+
+00801c59 <alloc_sockfd>:
+{
+  801c59:	55                   	push   %ebp
+  801c5a:	89 e5                	mov    %esp,%ebp
+  801c5c:	56                   	push   %esi
+  801c5d:	53                   	push   %ebx
+  801c5e:	83 ec 1c             	sub    $0x1c,%esp
+  801c61:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801c63:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c66:	50                   	push   %eax
+  801c67:	e8 75 f7 ff ff       	call   8013e1 <fd_alloc>
+  801c6c:	89 c3                	mov    %eax,%ebx
+  801c6e:	83 c4 10             	add    $0x10,%esp
+  801c71:	85 c0                	test   %eax,%eax
+  801c73:	78 43                	js     801cb8 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801c75:	83 ec 04             	sub    $0x4,%esp
+  801c78:	68 07 04 00 00       	push   $0x407
+  801c7d:	ff 75 f4             	push   -0xc(%ebp)
+  801c80:	6a 00                	push   $0x0
+  801c82:	e8 ac ef ff ff       	call   800c33 <sys_page_alloc>
+  801c87:	89 c3                	mov    %eax,%ebx
+  801c89:	83 c4 10             	add    $0x10,%esp
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	78 28                	js     801cb8 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801c90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c93:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801c99:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801c9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c9e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801ca5:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801ca8:	83 ec 0c             	sub    $0xc,%esp
+  801cab:	50                   	push   %eax
+  801cac:	e8 09 f7 ff ff       	call   8013ba <fd2num>
+  801cb1:	89 c3                	mov    %eax,%ebx
+  801cb3:	83 c4 10             	add    $0x10,%esp
+  801cb6:	eb 0c                	jmp    801cc4 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801cb8:	83 ec 0c             	sub    $0xc,%esp
+  801cbb:	56                   	push   %esi
+  801cbc:	e8 e4 01 00 00       	call   801ea5 <nsipc_close>
+		return r;
+  801cc1:	83 c4 10             	add    $0x10,%esp
+}
+  801cc4:	89 d8                	mov    %ebx,%eax
+  801cc6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cc9:	5b                   	pop    %ebx
+  801cca:	5e                   	pop    %esi
+  801ccb:	5d                   	pop    %ebp
+  801ccc:	c3                   	ret
+
+00801ccd <accept>:
+{
+  801ccd:	55                   	push   %ebp
+  801cce:	89 e5                	mov    %esp,%ebp
+  801cd0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd6:	e8 4e ff ff ff       	call   801c29 <fd2sockid>
+  801cdb:	85 c0                	test   %eax,%eax
+  801cdd:	78 1b                	js     801cfa <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801cdf:	83 ec 04             	sub    $0x4,%esp
+  801ce2:	ff 75 10             	push   0x10(%ebp)
+  801ce5:	ff 75 0c             	push   0xc(%ebp)
+  801ce8:	50                   	push   %eax
+  801ce9:	e8 0e 01 00 00       	call   801dfc <nsipc_accept>
+  801cee:	83 c4 10             	add    $0x10,%esp
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	78 05                	js     801cfa <accept+0x2d>
+	return alloc_sockfd(r);
+  801cf5:	e8 5f ff ff ff       	call   801c59 <alloc_sockfd>
+}
+  801cfa:	c9                   	leave
+  801cfb:	c3                   	ret
+
+00801cfc <bind>:
+{
+  801cfc:	55                   	push   %ebp
+  801cfd:	89 e5                	mov    %esp,%ebp
+  801cff:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d05:	e8 1f ff ff ff       	call   801c29 <fd2sockid>
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	78 12                	js     801d20 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d0e:	83 ec 04             	sub    $0x4,%esp
+  801d11:	ff 75 10             	push   0x10(%ebp)
+  801d14:	ff 75 0c             	push   0xc(%ebp)
+  801d17:	50                   	push   %eax
+  801d18:	e8 31 01 00 00       	call   801e4e <nsipc_bind>
+  801d1d:	83 c4 10             	add    $0x10,%esp
+}
+  801d20:	c9                   	leave
+  801d21:	c3                   	ret
+
+00801d22 <shutdown>:
+{
+  801d22:	55                   	push   %ebp
+  801d23:	89 e5                	mov    %esp,%ebp
+  801d25:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d28:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d2b:	e8 f9 fe ff ff       	call   801c29 <fd2sockid>
+  801d30:	85 c0                	test   %eax,%eax
+  801d32:	78 0f                	js     801d43 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d34:	83 ec 08             	sub    $0x8,%esp
+  801d37:	ff 75 0c             	push   0xc(%ebp)
+  801d3a:	50                   	push   %eax
+  801d3b:	e8 43 01 00 00       	call   801e83 <nsipc_shutdown>
+  801d40:	83 c4 10             	add    $0x10,%esp
+}
+  801d43:	c9                   	leave
+  801d44:	c3                   	ret
+
+00801d45 <connect>:
+{
+  801d45:	55                   	push   %ebp
+  801d46:	89 e5                	mov    %esp,%ebp
+  801d48:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d4e:	e8 d6 fe ff ff       	call   801c29 <fd2sockid>
+  801d53:	85 c0                	test   %eax,%eax
+  801d55:	78 12                	js     801d69 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801d57:	83 ec 04             	sub    $0x4,%esp
+  801d5a:	ff 75 10             	push   0x10(%ebp)
+  801d5d:	ff 75 0c             	push   0xc(%ebp)
+  801d60:	50                   	push   %eax
+  801d61:	e8 59 01 00 00       	call   801ebf <nsipc_connect>
+  801d66:	83 c4 10             	add    $0x10,%esp
+}
+  801d69:	c9                   	leave
+  801d6a:	c3                   	ret
+
+00801d6b <listen>:
+{
+  801d6b:	55                   	push   %ebp
+  801d6c:	89 e5                	mov    %esp,%ebp
+  801d6e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d71:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d74:	e8 b0 fe ff ff       	call   801c29 <fd2sockid>
+  801d79:	85 c0                	test   %eax,%eax
+  801d7b:	78 0f                	js     801d8c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801d7d:	83 ec 08             	sub    $0x8,%esp
+  801d80:	ff 75 0c             	push   0xc(%ebp)
+  801d83:	50                   	push   %eax
+  801d84:	e8 6b 01 00 00       	call   801ef4 <nsipc_listen>
+  801d89:	83 c4 10             	add    $0x10,%esp
+}
+  801d8c:	c9                   	leave
+  801d8d:	c3                   	ret
+
+00801d8e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801d8e:	55                   	push   %ebp
+  801d8f:	89 e5                	mov    %esp,%ebp
+  801d91:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801d94:	ff 75 10             	push   0x10(%ebp)
+  801d97:	ff 75 0c             	push   0xc(%ebp)
+  801d9a:	ff 75 08             	push   0x8(%ebp)
+  801d9d:	e8 41 02 00 00       	call   801fe3 <nsipc_socket>
+  801da2:	83 c4 10             	add    $0x10,%esp
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	78 05                	js     801dae <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801da9:	e8 ab fe ff ff       	call   801c59 <alloc_sockfd>
+}
+  801dae:	c9                   	leave
+  801daf:	c3                   	ret
+
+00801db0 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801db0:	55                   	push   %ebp
+  801db1:	89 e5                	mov    %esp,%ebp
+  801db3:	53                   	push   %ebx
+  801db4:	83 ec 04             	sub    $0x4,%esp
+  801db7:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801db9:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801dc0:	74 26                	je     801de8 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801dc2:	6a 07                	push   $0x7
+  801dc4:	68 00 70 80 00       	push   $0x807000
+  801dc9:	53                   	push   %ebx
+  801dca:	ff 35 04 50 80 00    	push   0x805004
+  801dd0:	e8 45 08 00 00       	call   80261a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801dd5:	83 c4 0c             	add    $0xc,%esp
+  801dd8:	6a 00                	push   $0x0
+  801dda:	6a 00                	push   $0x0
+  801ddc:	6a 00                	push   $0x0
+  801dde:	e8 bf 07 00 00       	call   8025a2 <ipc_recv>
+}
+  801de3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801de6:	c9                   	leave
+  801de7:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801de8:	83 ec 0c             	sub    $0xc,%esp
+  801deb:	6a 02                	push   $0x2
+  801ded:	e8 7c 08 00 00       	call   80266e <ipc_find_env>
+  801df2:	a3 04 50 80 00       	mov    %eax,0x805004
+  801df7:	83 c4 10             	add    $0x10,%esp
+  801dfa:	eb c6                	jmp    801dc2 <nsipc+0x12>
+
+00801dfc <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801dfc:	55                   	push   %ebp
+  801dfd:	89 e5                	mov    %esp,%ebp
+  801dff:	56                   	push   %esi
+  801e00:	53                   	push   %ebx
+  801e01:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e04:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e07:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e0c:	8b 06                	mov    (%esi),%eax
+  801e0e:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e13:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e18:	e8 93 ff ff ff       	call   801db0 <nsipc>
+  801e1d:	89 c3                	mov    %eax,%ebx
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	79 09                	jns    801e2c <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e23:	89 d8                	mov    %ebx,%eax
+  801e25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e28:	5b                   	pop    %ebx
+  801e29:	5e                   	pop    %esi
+  801e2a:	5d                   	pop    %ebp
+  801e2b:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801e2c:	83 ec 04             	sub    $0x4,%esp
+  801e2f:	ff 35 10 70 80 00    	push   0x807010
+  801e35:	68 00 70 80 00       	push   $0x807000
+  801e3a:	ff 75 0c             	push   0xc(%ebp)
+  801e3d:	e8 0a eb ff ff       	call   80094c <memmove>
+		*addrlen = ret->ret_addrlen;
+  801e42:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e47:	89 06                	mov    %eax,(%esi)
+  801e49:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801e4c:	eb d5                	jmp    801e23 <nsipc_accept+0x27>
+
+00801e4e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801e4e:	55                   	push   %ebp
+  801e4f:	89 e5                	mov    %esp,%ebp
+  801e51:	53                   	push   %ebx
+  801e52:	83 ec 08             	sub    $0x8,%esp
+  801e55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801e58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e5b:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801e60:	53                   	push   %ebx
+  801e61:	ff 75 0c             	push   0xc(%ebp)
+  801e64:	68 04 70 80 00       	push   $0x807004
+  801e69:	e8 de ea ff ff       	call   80094c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801e6e:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801e74:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e79:	e8 32 ff ff ff       	call   801db0 <nsipc>
+}
+  801e7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e81:	c9                   	leave
+  801e82:	c3                   	ret
+
+00801e83 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801e83:	55                   	push   %ebp
+  801e84:	89 e5                	mov    %esp,%ebp
+  801e86:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801e89:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e8c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801e91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e94:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801e99:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e9e:	e8 0d ff ff ff       	call   801db0 <nsipc>
+}
+  801ea3:	c9                   	leave
+  801ea4:	c3                   	ret
+
+00801ea5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801ea5:	55                   	push   %ebp
+  801ea6:	89 e5                	mov    %esp,%ebp
+  801ea8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801eab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eae:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801eb3:	b8 04 00 00 00       	mov    $0x4,%eax
+  801eb8:	e8 f3 fe ff ff       	call   801db0 <nsipc>
+}
+  801ebd:	c9                   	leave
+  801ebe:	c3                   	ret
+
+00801ebf <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801ebf:	55                   	push   %ebp
+  801ec0:	89 e5                	mov    %esp,%ebp
+  801ec2:	53                   	push   %ebx
+  801ec3:	83 ec 08             	sub    $0x8,%esp
+  801ec6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801ec9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ecc:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801ed1:	53                   	push   %ebx
+  801ed2:	ff 75 0c             	push   0xc(%ebp)
+  801ed5:	68 04 70 80 00       	push   $0x807004
+  801eda:	e8 6d ea ff ff       	call   80094c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801edf:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801ee5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801eea:	e8 c1 fe ff ff       	call   801db0 <nsipc>
+}
+  801eef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef2:	c9                   	leave
+  801ef3:	c3                   	ret
+
+00801ef4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801ef4:	55                   	push   %ebp
+  801ef5:	89 e5                	mov    %esp,%ebp
+  801ef7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801efa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801efd:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f05:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801f0a:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f0f:	e8 9c fe ff ff       	call   801db0 <nsipc>
+}
+  801f14:	c9                   	leave
+  801f15:	c3                   	ret
+
+00801f16 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f16:	55                   	push   %ebp
+  801f17:	89 e5                	mov    %esp,%ebp
+  801f19:	56                   	push   %esi
+  801f1a:	53                   	push   %ebx
+  801f1b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f21:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801f26:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801f2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f2f:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801f34:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f39:	e8 72 fe ff ff       	call   801db0 <nsipc>
+  801f3e:	89 c3                	mov    %eax,%ebx
+  801f40:	85 c0                	test   %eax,%eax
+  801f42:	78 22                	js     801f66 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801f44:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801f49:	39 c6                	cmp    %eax,%esi
+  801f4b:	0f 4e c6             	cmovle %esi,%eax
+  801f4e:	39 c3                	cmp    %eax,%ebx
+  801f50:	7f 1d                	jg     801f6f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801f52:	83 ec 04             	sub    $0x4,%esp
+  801f55:	53                   	push   %ebx
+  801f56:	68 00 70 80 00       	push   $0x807000
+  801f5b:	ff 75 0c             	push   0xc(%ebp)
+  801f5e:	e8 e9 e9 ff ff       	call   80094c <memmove>
+  801f63:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801f66:	89 d8                	mov    %ebx,%eax
+  801f68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f6b:	5b                   	pop    %ebx
+  801f6c:	5e                   	pop    %esi
+  801f6d:	5d                   	pop    %ebp
+  801f6e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801f6f:	68 0f 30 80 00       	push   $0x80300f
+  801f74:	68 d7 2f 80 00       	push   $0x802fd7
+  801f79:	6a 62                	push   $0x62
+  801f7b:	68 24 30 80 00       	push   $0x803024
+  801f80:	e8 46 05 00 00       	call   8024cb <_panic>
+
+00801f85 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	53                   	push   %ebx
+  801f89:	83 ec 04             	sub    $0x4,%esp
+  801f8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801f8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f92:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801f97:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801f9d:	7f 2e                	jg     801fcd <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801f9f:	83 ec 04             	sub    $0x4,%esp
+  801fa2:	53                   	push   %ebx
+  801fa3:	ff 75 0c             	push   0xc(%ebp)
+  801fa6:	68 0c 70 80 00       	push   $0x80700c
+  801fab:	e8 9c e9 ff ff       	call   80094c <memmove>
+	nsipcbuf.send.req_size = size;
+  801fb0:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801fb6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fb9:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801fbe:	b8 08 00 00 00       	mov    $0x8,%eax
+  801fc3:	e8 e8 fd ff ff       	call   801db0 <nsipc>
+}
+  801fc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fcb:	c9                   	leave
+  801fcc:	c3                   	ret
+	assert(size < 1600);
+  801fcd:	68 30 30 80 00       	push   $0x803030
+  801fd2:	68 d7 2f 80 00       	push   $0x802fd7
+  801fd7:	6a 6d                	push   $0x6d
+  801fd9:	68 24 30 80 00       	push   $0x803024
+  801fde:	e8 e8 04 00 00       	call   8024cb <_panic>
+
+00801fe3 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801fe3:	55                   	push   %ebp
+  801fe4:	89 e5                	mov    %esp,%ebp
+  801fe6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801fe9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fec:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801ff1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ff4:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801ff9:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ffc:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802001:	b8 09 00 00 00       	mov    $0x9,%eax
+  802006:	e8 a5 fd ff ff       	call   801db0 <nsipc>
+}
+  80200b:	c9                   	leave
+  80200c:	c3                   	ret
+
+0080200d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80200d:	55                   	push   %ebp
+  80200e:	89 e5                	mov    %esp,%ebp
+  802010:	56                   	push   %esi
+  802011:	53                   	push   %ebx
+  802012:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802015:	83 ec 0c             	sub    $0xc,%esp
+  802018:	ff 75 08             	push   0x8(%ebp)
+  80201b:	e8 aa f3 ff ff       	call   8013ca <fd2data>
+  802020:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802022:	83 c4 08             	add    $0x8,%esp
+  802025:	68 3c 30 80 00       	push   $0x80303c
+  80202a:	53                   	push   %ebx
+  80202b:	e8 96 e7 ff ff       	call   8007c6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802030:	8b 46 04             	mov    0x4(%esi),%eax
+  802033:	2b 06                	sub    (%esi),%eax
+  802035:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80203b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802042:	00 00 00 
+	stat->st_dev = &devpipe;
+  802045:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80204c:	40 80 00 
+	return 0;
+}
+  80204f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802054:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802057:	5b                   	pop    %ebx
+  802058:	5e                   	pop    %esi
+  802059:	5d                   	pop    %ebp
+  80205a:	c3                   	ret
+
+0080205b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80205b:	55                   	push   %ebp
+  80205c:	89 e5                	mov    %esp,%ebp
+  80205e:	53                   	push   %ebx
+  80205f:	83 ec 0c             	sub    $0xc,%esp
+  802062:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802065:	53                   	push   %ebx
+  802066:	6a 00                	push   $0x0
+  802068:	e8 8e ec ff ff       	call   800cfb <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80206d:	89 1c 24             	mov    %ebx,(%esp)
+  802070:	e8 55 f3 ff ff       	call   8013ca <fd2data>
+  802075:	83 c4 08             	add    $0x8,%esp
+  802078:	50                   	push   %eax
+  802079:	6a 00                	push   $0x0
+  80207b:	e8 7b ec ff ff       	call   800cfb <sys_page_unmap>
+}
+  802080:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802083:	c9                   	leave
+  802084:	c3                   	ret
+
+00802085 <_pipeisclosed>:
+{
+  802085:	55                   	push   %ebp
+  802086:	89 e5                	mov    %esp,%ebp
+  802088:	57                   	push   %edi
+  802089:	56                   	push   %esi
+  80208a:	53                   	push   %ebx
+  80208b:	83 ec 1c             	sub    $0x1c,%esp
+  80208e:	89 c7                	mov    %eax,%edi
+  802090:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802092:	a1 08 50 80 00       	mov    0x805008,%eax
+  802097:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80209a:	83 ec 0c             	sub    $0xc,%esp
+  80209d:	57                   	push   %edi
+  80209e:	e8 db 05 00 00       	call   80267e <pageref>
+  8020a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020a6:	89 34 24             	mov    %esi,(%esp)
+  8020a9:	e8 d0 05 00 00       	call   80267e <pageref>
+		nn = thisenv->env_runs;
+  8020ae:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8020b4:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8020b7:	83 c4 10             	add    $0x10,%esp
+  8020ba:	39 cb                	cmp    %ecx,%ebx
+  8020bc:	74 1b                	je     8020d9 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8020be:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020c1:	75 cf                	jne    802092 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8020c3:	8b 42 5c             	mov    0x5c(%edx),%eax
+  8020c6:	6a 01                	push   $0x1
+  8020c8:	50                   	push   %eax
+  8020c9:	53                   	push   %ebx
+  8020ca:	68 43 30 80 00       	push   $0x803043
+  8020cf:	e8 04 e1 ff ff       	call   8001d8 <cprintf>
+  8020d4:	83 c4 10             	add    $0x10,%esp
+  8020d7:	eb b9                	jmp    802092 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8020d9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020dc:	0f 94 c0             	sete   %al
+  8020df:	0f b6 c0             	movzbl %al,%eax
+}
+  8020e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e5:	5b                   	pop    %ebx
+  8020e6:	5e                   	pop    %esi
+  8020e7:	5f                   	pop    %edi
+  8020e8:	5d                   	pop    %ebp
+  8020e9:	c3                   	ret
+
+008020ea <devpipe_write>:
+{
+  8020ea:	55                   	push   %ebp
+  8020eb:	89 e5                	mov    %esp,%ebp
+  8020ed:	57                   	push   %edi
+  8020ee:	56                   	push   %esi
+  8020ef:	53                   	push   %ebx
+  8020f0:	83 ec 28             	sub    $0x28,%esp
+  8020f3:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8020f6:	56                   	push   %esi
+  8020f7:	e8 ce f2 ff ff       	call   8013ca <fd2data>
+  8020fc:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8020fe:	83 c4 10             	add    $0x10,%esp
+  802101:	bf 00 00 00 00       	mov    $0x0,%edi
+  802106:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802109:	75 09                	jne    802114 <devpipe_write+0x2a>
+	return i;
+  80210b:	89 f8                	mov    %edi,%eax
+  80210d:	eb 23                	jmp    802132 <devpipe_write+0x48>
+			sys_yield();
+  80210f:	e8 9f ea ff ff       	call   800bb3 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802114:	8b 43 04             	mov    0x4(%ebx),%eax
+  802117:	8b 0b                	mov    (%ebx),%ecx
+  802119:	8d 51 20             	lea    0x20(%ecx),%edx
+  80211c:	39 d0                	cmp    %edx,%eax
+  80211e:	72 1a                	jb     80213a <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802120:	89 da                	mov    %ebx,%edx
+  802122:	89 f0                	mov    %esi,%eax
+  802124:	e8 5c ff ff ff       	call   802085 <_pipeisclosed>
+  802129:	85 c0                	test   %eax,%eax
+  80212b:	74 e2                	je     80210f <devpipe_write+0x25>
+				return 0;
+  80212d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802132:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802135:	5b                   	pop    %ebx
+  802136:	5e                   	pop    %esi
+  802137:	5f                   	pop    %edi
+  802138:	5d                   	pop    %ebp
+  802139:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80213a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80213d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802141:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802144:	89 c2                	mov    %eax,%edx
+  802146:	c1 fa 1f             	sar    $0x1f,%edx
+  802149:	89 d1                	mov    %edx,%ecx
+  80214b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80214e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802151:	83 e2 1f             	and    $0x1f,%edx
+  802154:	29 ca                	sub    %ecx,%edx
+  802156:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80215a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80215e:	83 c0 01             	add    $0x1,%eax
+  802161:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802164:	83 c7 01             	add    $0x1,%edi
+  802167:	eb 9d                	jmp    802106 <devpipe_write+0x1c>
+
+00802169 <devpipe_read>:
+{
+  802169:	55                   	push   %ebp
+  80216a:	89 e5                	mov    %esp,%ebp
+  80216c:	57                   	push   %edi
+  80216d:	56                   	push   %esi
+  80216e:	53                   	push   %ebx
+  80216f:	83 ec 18             	sub    $0x18,%esp
+  802172:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802175:	57                   	push   %edi
+  802176:	e8 4f f2 ff ff       	call   8013ca <fd2data>
+  80217b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80217d:	83 c4 10             	add    $0x10,%esp
+  802180:	be 00 00 00 00       	mov    $0x0,%esi
+  802185:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802188:	75 13                	jne    80219d <devpipe_read+0x34>
+	return i;
+  80218a:	89 f0                	mov    %esi,%eax
+  80218c:	eb 02                	jmp    802190 <devpipe_read+0x27>
+				return i;
+  80218e:	89 f0                	mov    %esi,%eax
+}
+  802190:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802193:	5b                   	pop    %ebx
+  802194:	5e                   	pop    %esi
+  802195:	5f                   	pop    %edi
+  802196:	5d                   	pop    %ebp
+  802197:	c3                   	ret
+			sys_yield();
+  802198:	e8 16 ea ff ff       	call   800bb3 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80219d:	8b 03                	mov    (%ebx),%eax
+  80219f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8021a2:	75 18                	jne    8021bc <devpipe_read+0x53>
+			if (i > 0)
+  8021a4:	85 f6                	test   %esi,%esi
+  8021a6:	75 e6                	jne    80218e <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8021a8:	89 da                	mov    %ebx,%edx
+  8021aa:	89 f8                	mov    %edi,%eax
+  8021ac:	e8 d4 fe ff ff       	call   802085 <_pipeisclosed>
+  8021b1:	85 c0                	test   %eax,%eax
+  8021b3:	74 e3                	je     802198 <devpipe_read+0x2f>
+				return 0;
+  8021b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ba:	eb d4                	jmp    802190 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8021bc:	99                   	cltd
+  8021bd:	c1 ea 1b             	shr    $0x1b,%edx
+  8021c0:	01 d0                	add    %edx,%eax
+  8021c2:	83 e0 1f             	and    $0x1f,%eax
+  8021c5:	29 d0                	sub    %edx,%eax
+  8021c7:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8021cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021cf:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8021d2:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8021d5:	83 c6 01             	add    $0x1,%esi
+  8021d8:	eb ab                	jmp    802185 <devpipe_read+0x1c>
+
+008021da <pipe>:
+{
+  8021da:	55                   	push   %ebp
+  8021db:	89 e5                	mov    %esp,%ebp
+  8021dd:	56                   	push   %esi
+  8021de:	53                   	push   %ebx
+  8021df:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8021e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021e5:	50                   	push   %eax
+  8021e6:	e8 f6 f1 ff ff       	call   8013e1 <fd_alloc>
+  8021eb:	89 c3                	mov    %eax,%ebx
+  8021ed:	83 c4 10             	add    $0x10,%esp
+  8021f0:	85 c0                	test   %eax,%eax
+  8021f2:	0f 88 23 01 00 00    	js     80231b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021f8:	83 ec 04             	sub    $0x4,%esp
+  8021fb:	68 07 04 00 00       	push   $0x407
+  802200:	ff 75 f4             	push   -0xc(%ebp)
+  802203:	6a 00                	push   $0x0
+  802205:	e8 29 ea ff ff       	call   800c33 <sys_page_alloc>
+  80220a:	89 c3                	mov    %eax,%ebx
+  80220c:	83 c4 10             	add    $0x10,%esp
+  80220f:	85 c0                	test   %eax,%eax
+  802211:	0f 88 04 01 00 00    	js     80231b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802217:	83 ec 0c             	sub    $0xc,%esp
+  80221a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80221d:	50                   	push   %eax
+  80221e:	e8 be f1 ff ff       	call   8013e1 <fd_alloc>
+  802223:	89 c3                	mov    %eax,%ebx
+  802225:	83 c4 10             	add    $0x10,%esp
+  802228:	85 c0                	test   %eax,%eax
+  80222a:	0f 88 db 00 00 00    	js     80230b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802230:	83 ec 04             	sub    $0x4,%esp
+  802233:	68 07 04 00 00       	push   $0x407
+  802238:	ff 75 f0             	push   -0x10(%ebp)
+  80223b:	6a 00                	push   $0x0
+  80223d:	e8 f1 e9 ff ff       	call   800c33 <sys_page_alloc>
+  802242:	89 c3                	mov    %eax,%ebx
+  802244:	83 c4 10             	add    $0x10,%esp
+  802247:	85 c0                	test   %eax,%eax
+  802249:	0f 88 bc 00 00 00    	js     80230b <pipe+0x131>
+	va = fd2data(fd0);
+  80224f:	83 ec 0c             	sub    $0xc,%esp
+  802252:	ff 75 f4             	push   -0xc(%ebp)
+  802255:	e8 70 f1 ff ff       	call   8013ca <fd2data>
+  80225a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80225c:	83 c4 0c             	add    $0xc,%esp
+  80225f:	68 07 04 00 00       	push   $0x407
+  802264:	50                   	push   %eax
+  802265:	6a 00                	push   $0x0
+  802267:	e8 c7 e9 ff ff       	call   800c33 <sys_page_alloc>
+  80226c:	89 c3                	mov    %eax,%ebx
+  80226e:	83 c4 10             	add    $0x10,%esp
+  802271:	85 c0                	test   %eax,%eax
+  802273:	0f 88 82 00 00 00    	js     8022fb <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802279:	83 ec 0c             	sub    $0xc,%esp
+  80227c:	ff 75 f0             	push   -0x10(%ebp)
+  80227f:	e8 46 f1 ff ff       	call   8013ca <fd2data>
+  802284:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80228b:	50                   	push   %eax
+  80228c:	6a 00                	push   $0x0
+  80228e:	56                   	push   %esi
+  80228f:	6a 00                	push   $0x0
+  802291:	e8 23 ea ff ff       	call   800cb9 <sys_page_map>
+  802296:	89 c3                	mov    %eax,%ebx
+  802298:	83 c4 20             	add    $0x20,%esp
+  80229b:	85 c0                	test   %eax,%eax
+  80229d:	78 4e                	js     8022ed <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80229f:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8022a4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022a7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8022a9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022ac:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8022b3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8022b6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8022b8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8022bb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8022c2:	83 ec 0c             	sub    $0xc,%esp
+  8022c5:	ff 75 f4             	push   -0xc(%ebp)
+  8022c8:	e8 ed f0 ff ff       	call   8013ba <fd2num>
+  8022cd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022d0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8022d2:	83 c4 04             	add    $0x4,%esp
+  8022d5:	ff 75 f0             	push   -0x10(%ebp)
+  8022d8:	e8 dd f0 ff ff       	call   8013ba <fd2num>
+  8022dd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022e0:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8022e3:	83 c4 10             	add    $0x10,%esp
+  8022e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022eb:	eb 2e                	jmp    80231b <pipe+0x141>
+	sys_page_unmap(0, va);
+  8022ed:	83 ec 08             	sub    $0x8,%esp
+  8022f0:	56                   	push   %esi
+  8022f1:	6a 00                	push   $0x0
+  8022f3:	e8 03 ea ff ff       	call   800cfb <sys_page_unmap>
+  8022f8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8022fb:	83 ec 08             	sub    $0x8,%esp
+  8022fe:	ff 75 f0             	push   -0x10(%ebp)
+  802301:	6a 00                	push   $0x0
+  802303:	e8 f3 e9 ff ff       	call   800cfb <sys_page_unmap>
+  802308:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80230b:	83 ec 08             	sub    $0x8,%esp
+  80230e:	ff 75 f4             	push   -0xc(%ebp)
+  802311:	6a 00                	push   $0x0
+  802313:	e8 e3 e9 ff ff       	call   800cfb <sys_page_unmap>
+  802318:	83 c4 10             	add    $0x10,%esp
+}
+  80231b:	89 d8                	mov    %ebx,%eax
+  80231d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802320:	5b                   	pop    %ebx
+  802321:	5e                   	pop    %esi
+  802322:	5d                   	pop    %ebp
+  802323:	c3                   	ret
+
+00802324 <pipeisclosed>:
+{
+  802324:	55                   	push   %ebp
+  802325:	89 e5                	mov    %esp,%ebp
+  802327:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80232a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80232d:	50                   	push   %eax
+  80232e:	ff 75 08             	push   0x8(%ebp)
+  802331:	e8 01 f1 ff ff       	call   801437 <fd_lookup>
+  802336:	83 c4 10             	add    $0x10,%esp
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	78 18                	js     802355 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80233d:	83 ec 0c             	sub    $0xc,%esp
+  802340:	ff 75 f4             	push   -0xc(%ebp)
+  802343:	e8 82 f0 ff ff       	call   8013ca <fd2data>
+  802348:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80234a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80234d:	e8 33 fd ff ff       	call   802085 <_pipeisclosed>
+  802352:	83 c4 10             	add    $0x10,%esp
+}
+  802355:	c9                   	leave
+  802356:	c3                   	ret
+
+00802357 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802357:	b8 00 00 00 00       	mov    $0x0,%eax
+  80235c:	c3                   	ret
+
+0080235d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80235d:	55                   	push   %ebp
+  80235e:	89 e5                	mov    %esp,%ebp
+  802360:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802363:	68 5b 30 80 00       	push   $0x80305b
+  802368:	ff 75 0c             	push   0xc(%ebp)
+  80236b:	e8 56 e4 ff ff       	call   8007c6 <strcpy>
+	return 0;
+}
+  802370:	b8 00 00 00 00       	mov    $0x0,%eax
+  802375:	c9                   	leave
+  802376:	c3                   	ret
+
+00802377 <devcons_write>:
+{
+  802377:	55                   	push   %ebp
+  802378:	89 e5                	mov    %esp,%ebp
+  80237a:	57                   	push   %edi
+  80237b:	56                   	push   %esi
+  80237c:	53                   	push   %ebx
+  80237d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802383:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802388:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80238e:	eb 2e                	jmp    8023be <devcons_write+0x47>
+		m = n - tot;
+  802390:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802393:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802395:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80239a:	39 c3                	cmp    %eax,%ebx
+  80239c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80239f:	83 ec 04             	sub    $0x4,%esp
+  8023a2:	53                   	push   %ebx
+  8023a3:	89 f0                	mov    %esi,%eax
+  8023a5:	03 45 0c             	add    0xc(%ebp),%eax
+  8023a8:	50                   	push   %eax
+  8023a9:	57                   	push   %edi
+  8023aa:	e8 9d e5 ff ff       	call   80094c <memmove>
+		sys_cputs(buf, m);
+  8023af:	83 c4 08             	add    $0x8,%esp
+  8023b2:	53                   	push   %ebx
+  8023b3:	57                   	push   %edi
+  8023b4:	e8 3d e7 ff ff       	call   800af6 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8023b9:	01 de                	add    %ebx,%esi
+  8023bb:	83 c4 10             	add    $0x10,%esp
+  8023be:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8023c1:	72 cd                	jb     802390 <devcons_write+0x19>
+}
+  8023c3:	89 f0                	mov    %esi,%eax
+  8023c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023c8:	5b                   	pop    %ebx
+  8023c9:	5e                   	pop    %esi
+  8023ca:	5f                   	pop    %edi
+  8023cb:	5d                   	pop    %ebp
+  8023cc:	c3                   	ret
+
+008023cd <devcons_read>:
+{
+  8023cd:	55                   	push   %ebp
+  8023ce:	89 e5                	mov    %esp,%ebp
+  8023d0:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8023d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8023dc:	75 07                	jne    8023e5 <devcons_read+0x18>
+  8023de:	eb 1f                	jmp    8023ff <devcons_read+0x32>
+		sys_yield();
+  8023e0:	e8 ce e7 ff ff       	call   800bb3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8023e5:	e8 2a e7 ff ff       	call   800b14 <sys_cgetc>
+  8023ea:	85 c0                	test   %eax,%eax
+  8023ec:	74 f2                	je     8023e0 <devcons_read+0x13>
+	if (c < 0)
+  8023ee:	78 0f                	js     8023ff <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8023f0:	83 f8 04             	cmp    $0x4,%eax
+  8023f3:	74 0c                	je     802401 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8023f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023f8:	88 02                	mov    %al,(%edx)
+	return 1;
+  8023fa:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8023ff:	c9                   	leave
+  802400:	c3                   	ret
+		return 0;
+  802401:	b8 00 00 00 00       	mov    $0x0,%eax
+  802406:	eb f7                	jmp    8023ff <devcons_read+0x32>
+
+00802408 <cputchar>:
+{
+  802408:	55                   	push   %ebp
+  802409:	89 e5                	mov    %esp,%ebp
+  80240b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80240e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802411:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802414:	6a 01                	push   $0x1
+  802416:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802419:	50                   	push   %eax
+  80241a:	e8 d7 e6 ff ff       	call   800af6 <sys_cputs>
+}
+  80241f:	83 c4 10             	add    $0x10,%esp
+  802422:	c9                   	leave
+  802423:	c3                   	ret
+
+00802424 <getchar>:
+{
+  802424:	55                   	push   %ebp
+  802425:	89 e5                	mov    %esp,%ebp
+  802427:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80242a:	6a 01                	push   $0x1
+  80242c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80242f:	50                   	push   %eax
+  802430:	6a 00                	push   $0x0
+  802432:	e8 66 f2 ff ff       	call   80169d <read>
+	if (r < 0)
+  802437:	83 c4 10             	add    $0x10,%esp
+  80243a:	85 c0                	test   %eax,%eax
+  80243c:	78 06                	js     802444 <getchar+0x20>
+	if (r < 1)
+  80243e:	74 06                	je     802446 <getchar+0x22>
+	return c;
+  802440:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802444:	c9                   	leave
+  802445:	c3                   	ret
+		return -E_EOF;
+  802446:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80244b:	eb f7                	jmp    802444 <getchar+0x20>
+
+0080244d <iscons>:
+{
+  80244d:	55                   	push   %ebp
+  80244e:	89 e5                	mov    %esp,%ebp
+  802450:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802453:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802456:	50                   	push   %eax
+  802457:	ff 75 08             	push   0x8(%ebp)
+  80245a:	e8 d8 ef ff ff       	call   801437 <fd_lookup>
+  80245f:	83 c4 10             	add    $0x10,%esp
+  802462:	85 c0                	test   %eax,%eax
+  802464:	78 11                	js     802477 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802466:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802469:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80246f:	39 10                	cmp    %edx,(%eax)
+  802471:	0f 94 c0             	sete   %al
+  802474:	0f b6 c0             	movzbl %al,%eax
+}
+  802477:	c9                   	leave
+  802478:	c3                   	ret
+
+00802479 <opencons>:
+{
+  802479:	55                   	push   %ebp
+  80247a:	89 e5                	mov    %esp,%ebp
+  80247c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80247f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802482:	50                   	push   %eax
+  802483:	e8 59 ef ff ff       	call   8013e1 <fd_alloc>
+  802488:	83 c4 10             	add    $0x10,%esp
+  80248b:	85 c0                	test   %eax,%eax
+  80248d:	78 3a                	js     8024c9 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80248f:	83 ec 04             	sub    $0x4,%esp
+  802492:	68 07 04 00 00       	push   $0x407
+  802497:	ff 75 f4             	push   -0xc(%ebp)
+  80249a:	6a 00                	push   $0x0
+  80249c:	e8 92 e7 ff ff       	call   800c33 <sys_page_alloc>
+  8024a1:	83 c4 10             	add    $0x10,%esp
+  8024a4:	85 c0                	test   %eax,%eax
+  8024a6:	78 21                	js     8024c9 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8024a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024ab:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8024b1:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8024b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024b6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8024bd:	83 ec 0c             	sub    $0xc,%esp
+  8024c0:	50                   	push   %eax
+  8024c1:	e8 f4 ee ff ff       	call   8013ba <fd2num>
+  8024c6:	83 c4 10             	add    $0x10,%esp
+}
+  8024c9:	c9                   	leave
+  8024ca:	c3                   	ret
+
+008024cb <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8024cb:	55                   	push   %ebp
+  8024cc:	89 e5                	mov    %esp,%ebp
+  8024ce:	56                   	push   %esi
+  8024cf:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8024d0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8024d3:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8024d9:	e8 b6 e6 ff ff       	call   800b94 <sys_getenvid>
+  8024de:	83 ec 0c             	sub    $0xc,%esp
+  8024e1:	ff 75 0c             	push   0xc(%ebp)
+  8024e4:	ff 75 08             	push   0x8(%ebp)
+  8024e7:	56                   	push   %esi
+  8024e8:	50                   	push   %eax
+  8024e9:	68 68 30 80 00       	push   $0x803068
+  8024ee:	e8 e5 dc ff ff       	call   8001d8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8024f3:	83 c4 18             	add    $0x18,%esp
+  8024f6:	53                   	push   %ebx
+  8024f7:	ff 75 10             	push   0x10(%ebp)
+  8024fa:	e8 88 dc ff ff       	call   800187 <vcprintf>
+	cprintf("\n");
+  8024ff:	c7 04 24 0f 2b 80 00 	movl   $0x802b0f,(%esp)
+  802506:	e8 cd dc ff ff       	call   8001d8 <cprintf>
+  80250b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80250e:	cc                   	int3
+	while (1)
+  80250f:	eb fd                	jmp    80250e <_panic+0x43>
+
+00802511 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802511:	55                   	push   %ebp
+  802512:	89 e5                	mov    %esp,%ebp
+  802514:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802517:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80251e:	74 0a                	je     80252a <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802520:	8b 45 08             	mov    0x8(%ebp),%eax
+  802523:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  802528:	c9                   	leave
+  802529:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  80252a:	83 ec 04             	sub    $0x4,%esp
+  80252d:	6a 07                	push   $0x7
+  80252f:	68 00 f0 bf ee       	push   $0xeebff000
+  802534:	6a 00                	push   $0x0
+  802536:	e8 f8 e6 ff ff       	call   800c33 <sys_page_alloc>
+  80253b:	83 c4 10             	add    $0x10,%esp
+  80253e:	85 c0                	test   %eax,%eax
+  802540:	78 28                	js     80256a <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802542:	83 ec 08             	sub    $0x8,%esp
+  802545:	68 7c 25 80 00       	push   $0x80257c
+  80254a:	6a 00                	push   $0x0
+  80254c:	e8 dd e9 ff ff       	call   800f2e <sys_env_set_pgfault_upcall>
+  802551:	83 c4 10             	add    $0x10,%esp
+  802554:	85 c0                	test   %eax,%eax
+  802556:	79 c8                	jns    802520 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  802558:	50                   	push   %eax
+  802559:	68 99 30 80 00       	push   $0x803099
+  80255e:	6a 24                	push   $0x24
+  802560:	68 8b 30 80 00       	push   $0x80308b
+  802565:	e8 61 ff ff ff       	call   8024cb <_panic>
+			panic("sys_page_alloc: %e", r);
+  80256a:	50                   	push   %eax
+  80256b:	68 66 2e 80 00       	push   $0x802e66
+  802570:	6a 21                	push   $0x21
+  802572:	68 8b 30 80 00       	push   $0x80308b
+  802577:	e8 4f ff ff ff       	call   8024cb <_panic>
+
+0080257c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80257c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80257d:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802582:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802584:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802587:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  80258a:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  80258e:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  802591:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  802595:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  802599:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  80259b:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80259c:	83 c4 04             	add    $0x4,%esp
+	popf
+  80259f:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8025a0:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8025a1:	c3                   	ret
+
+008025a2 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8025a2:	55                   	push   %ebp
+  8025a3:	89 e5                	mov    %esp,%ebp
+  8025a5:	57                   	push   %edi
+  8025a6:	56                   	push   %esi
+  8025a7:	53                   	push   %ebx
+  8025a8:	83 ec 18             	sub    $0x18,%esp
+  8025ab:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025b1:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8025b4:	85 db                	test   %ebx,%ebx
+  8025b6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8025bb:	0f 45 c3             	cmovne %ebx,%eax
+  8025be:	50                   	push   %eax
+  8025bf:	e8 f2 e9 ff ff       	call   800fb6 <sys_ipc_recv>
+
+	if (from_env_store)
+  8025c4:	83 c4 10             	add    $0x10,%esp
+  8025c7:	85 ff                	test   %edi,%edi
+  8025c9:	74 17                	je     8025e2 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8025cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d0:	85 c0                	test   %eax,%eax
+  8025d2:	75 0c                	jne    8025e0 <ipc_recv+0x3e>
+  8025d4:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8025da:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8025e0:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8025e2:	85 f6                	test   %esi,%esi
+  8025e4:	74 2e                	je     802614 <ipc_recv+0x72>
+		if (!r && pg)
+  8025e6:	85 c0                	test   %eax,%eax
+  8025e8:	75 24                	jne    80260e <ipc_recv+0x6c>
+  8025ea:	85 db                	test   %ebx,%ebx
+  8025ec:	74 20                	je     80260e <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8025ee:	a1 08 50 80 00       	mov    0x805008,%eax
+  8025f3:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8025f9:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8025fb:	a1 08 50 80 00       	mov    0x805008,%eax
+  802600:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802606:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802609:	5b                   	pop    %ebx
+  80260a:	5e                   	pop    %esi
+  80260b:	5f                   	pop    %edi
+  80260c:	5d                   	pop    %ebp
+  80260d:	c3                   	ret
+			*perm_store = 0;
+  80260e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802614:	85 c0                	test   %eax,%eax
+  802616:	75 ee                	jne    802606 <ipc_recv+0x64>
+  802618:	eb e1                	jmp    8025fb <ipc_recv+0x59>
+
+0080261a <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80261a:	55                   	push   %ebp
+  80261b:	89 e5                	mov    %esp,%ebp
+  80261d:	57                   	push   %edi
+  80261e:	56                   	push   %esi
+  80261f:	53                   	push   %ebx
+  802620:	83 ec 0c             	sub    $0xc,%esp
+  802623:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802626:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802629:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80262c:	85 db                	test   %ebx,%ebx
+  80262e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802633:	0f 44 d8             	cmove  %eax,%ebx
+  802636:	ff 75 14             	push   0x14(%ebp)
+  802639:	53                   	push   %ebx
+  80263a:	56                   	push   %esi
+  80263b:	57                   	push   %edi
+  80263c:	e8 52 e9 ff ff       	call   800f93 <sys_ipc_try_send_yield>
+  802641:	83 c4 10             	add    $0x10,%esp
+  802644:	85 c0                	test   %eax,%eax
+  802646:	79 1e                	jns    802666 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802648:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80264b:	75 07                	jne    802654 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80264d:	e8 61 e5 ff ff       	call   800bb3 <sys_yield>
+  802652:	eb e2                	jmp    802636 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802654:	50                   	push   %eax
+  802655:	68 b7 30 80 00       	push   $0x8030b7
+  80265a:	6a 3d                	push   $0x3d
+  80265c:	68 cc 30 80 00       	push   $0x8030cc
+  802661:	e8 65 fe ff ff       	call   8024cb <_panic>
+	}
+}
+  802666:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802669:	5b                   	pop    %ebx
+  80266a:	5e                   	pop    %esi
+  80266b:	5f                   	pop    %edi
+  80266c:	5d                   	pop    %ebp
+  80266d:	c3                   	ret
+
+0080266e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80266e:	55                   	push   %ebp
+  80266f:	89 e5                	mov    %esp,%ebp
+  802671:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802674:	ff 75 08             	push   0x8(%ebp)
+  802677:	e8 b7 e4 ff ff       	call   800b33 <sys_env_find>
+}
+  80267c:	c9                   	leave
+  80267d:	c3                   	ret
+
+0080267e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80267e:	55                   	push   %ebp
+  80267f:	89 e5                	mov    %esp,%ebp
+  802681:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802684:	89 c2                	mov    %eax,%edx
+  802686:	c1 ea 16             	shr    $0x16,%edx
+  802689:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802690:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802695:	f6 c1 01             	test   $0x1,%cl
+  802698:	74 22                	je     8026bc <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80269a:	c1 e8 0c             	shr    $0xc,%eax
+  80269d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8026a4:	a8 01                	test   $0x1,%al
+  8026a6:	74 14                	je     8026bc <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8026a8:	c1 e8 0c             	shr    $0xc,%eax
+  8026ab:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026ae:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8026b5:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8026b9:	0f b7 d2             	movzwl %dx,%edx
+}
+  8026bc:	89 d0                	mov    %edx,%eax
+  8026be:	5d                   	pop    %ebp
+  8026bf:	c3                   	ret
+
+008026c0 <__udivmoddi4>:
+  8026c0:	55                   	push   %ebp
+  8026c1:	57                   	push   %edi
+  8026c2:	56                   	push   %esi
+  8026c3:	53                   	push   %ebx
+  8026c4:	83 ec 14             	sub    $0x14,%esp
+  8026c7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8026cb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8026cf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026d3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026d7:	89 f1                	mov    %esi,%ecx
+  8026d9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8026dd:	09 d9                	or     %ebx,%ecx
+  8026df:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8026e3:	0f 84 92 00 00 00    	je     80277b <__udivmoddi4+0xbb>
+  8026e9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8026f0:	00 
+  8026f1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8026f6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8026fd:	00 
+  8026fe:	89 1c 24             	mov    %ebx,(%esp)
+  802701:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802705:	8d 76 00             	lea    0x0(%esi),%esi
+  802708:	89 e9                	mov    %ebp,%ecx
+  80270a:	89 c3                	mov    %eax,%ebx
+  80270c:	89 d6                	mov    %edx,%esi
+  80270e:	31 ff                	xor    %edi,%edi
+  802710:	d3 ee                	shr    %cl,%esi
+  802712:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802715:	f6 c1 20             	test   $0x20,%cl
+  802718:	0f 45 de             	cmovne %esi,%ebx
+  80271b:	0f 45 f7             	cmovne %edi,%esi
+  80271e:	8b 3c 24             	mov    (%esp),%edi
+  802721:	39 fb                	cmp    %edi,%ebx
+  802723:	89 f7                	mov    %esi,%edi
+  802725:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802729:	8b 1c 24             	mov    (%esp),%ebx
+  80272c:	19 f7                	sbb    %esi,%edi
+  80272e:	72 39                	jb     802769 <__udivmoddi4+0xa9>
+  802730:	89 e9                	mov    %ebp,%ecx
+  802732:	89 f7                	mov    %esi,%edi
+  802734:	89 de                	mov    %ebx,%esi
+  802736:	0f a5 df             	shld   %cl,%ebx,%edi
+  802739:	d3 e6                	shl    %cl,%esi
+  80273b:	31 db                	xor    %ebx,%ebx
+  80273d:	f6 c1 20             	test   $0x20,%cl
+  802740:	0f 45 fe             	cmovne %esi,%edi
+  802743:	0f 45 f3             	cmovne %ebx,%esi
+  802746:	29 f0                	sub    %esi,%eax
+  802748:	be 01 00 00 00       	mov    $0x1,%esi
+  80274d:	19 fa                	sbb    %edi,%edx
+  80274f:	31 ff                	xor    %edi,%edi
+  802751:	31 db                	xor    %ebx,%ebx
+  802753:	0f a5 f7             	shld   %cl,%esi,%edi
+  802756:	d3 e6                	shl    %cl,%esi
+  802758:	f6 c1 20             	test   $0x20,%cl
+  80275b:	0f 45 fe             	cmovne %esi,%edi
+  80275e:	0f 45 f3             	cmovne %ebx,%esi
+  802761:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802765:	09 74 24 08          	or     %esi,0x8(%esp)
+  802769:	83 ed 01             	sub    $0x1,%ebp
+  80276c:	73 9a                	jae    802708 <__udivmoddi4+0x48>
+  80276e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802772:	85 ff                	test   %edi,%edi
+  802774:	74 05                	je     80277b <__udivmoddi4+0xbb>
+  802776:	89 07                	mov    %eax,(%edi)
+  802778:	89 57 04             	mov    %edx,0x4(%edi)
+  80277b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80277f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802783:	83 c4 14             	add    $0x14,%esp
+  802786:	5b                   	pop    %ebx
+  802787:	5e                   	pop    %esi
+  802788:	5f                   	pop    %edi
+  802789:	5d                   	pop    %ebp
+  80278a:	c3                   	ret
+  80278b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80278f:	90                   	nop
+
+00802790 <__udivdi3>:
+  802790:	55                   	push   %ebp
+  802791:	57                   	push   %edi
+  802792:	56                   	push   %esi
+  802793:	53                   	push   %ebx
+  802794:	83 ec 14             	sub    $0x14,%esp
+  802797:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80279b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80279f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027a3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027a7:	89 fb                	mov    %edi,%ebx
+  8027a9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8027ad:	09 f3                	or     %esi,%ebx
+  8027af:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8027b3:	0f 84 85 00 00 00    	je     80283e <__udivdi3+0xae>
+  8027b9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027c0:	00 
+  8027c1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8027c6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027cd:	00 
+  8027ce:	89 34 24             	mov    %esi,(%esp)
+  8027d1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8027d5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027d8:	89 e9                	mov    %ebp,%ecx
+  8027da:	89 c3                	mov    %eax,%ebx
+  8027dc:	89 d6                	mov    %edx,%esi
+  8027de:	31 ff                	xor    %edi,%edi
+  8027e0:	d3 ee                	shr    %cl,%esi
+  8027e2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8027e5:	f6 c1 20             	test   $0x20,%cl
+  8027e8:	0f 45 de             	cmovne %esi,%ebx
+  8027eb:	0f 45 f7             	cmovne %edi,%esi
+  8027ee:	8b 3c 24             	mov    (%esp),%edi
+  8027f1:	39 fb                	cmp    %edi,%ebx
+  8027f3:	89 f7                	mov    %esi,%edi
+  8027f5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8027f9:	8b 1c 24             	mov    (%esp),%ebx
+  8027fc:	19 f7                	sbb    %esi,%edi
+  8027fe:	72 39                	jb     802839 <__udivdi3+0xa9>
+  802800:	89 e9                	mov    %ebp,%ecx
+  802802:	89 f7                	mov    %esi,%edi
+  802804:	89 de                	mov    %ebx,%esi
+  802806:	0f a5 df             	shld   %cl,%ebx,%edi
+  802809:	d3 e6                	shl    %cl,%esi
+  80280b:	31 db                	xor    %ebx,%ebx
+  80280d:	f6 c1 20             	test   $0x20,%cl
+  802810:	0f 45 fe             	cmovne %esi,%edi
+  802813:	0f 45 f3             	cmovne %ebx,%esi
+  802816:	29 f0                	sub    %esi,%eax
+  802818:	be 01 00 00 00       	mov    $0x1,%esi
+  80281d:	19 fa                	sbb    %edi,%edx
+  80281f:	31 ff                	xor    %edi,%edi
+  802821:	31 db                	xor    %ebx,%ebx
+  802823:	0f a5 f7             	shld   %cl,%esi,%edi
+  802826:	d3 e6                	shl    %cl,%esi
+  802828:	f6 c1 20             	test   $0x20,%cl
+  80282b:	0f 45 fe             	cmovne %esi,%edi
+  80282e:	0f 45 f3             	cmovne %ebx,%esi
+  802831:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802835:	09 74 24 08          	or     %esi,0x8(%esp)
+  802839:	83 ed 01             	sub    $0x1,%ebp
+  80283c:	73 9a                	jae    8027d8 <__udivdi3+0x48>
+  80283e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802842:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802846:	83 c4 14             	add    $0x14,%esp
+  802849:	5b                   	pop    %ebx
+  80284a:	5e                   	pop    %esi
+  80284b:	5f                   	pop    %edi
+  80284c:	5d                   	pop    %ebp
+  80284d:	c3                   	ret
+  80284e:	66 90                	xchg   %ax,%ax
+
+00802850 <__umoddi3>:
+  802850:	57                   	push   %edi
+  802851:	56                   	push   %esi
+  802852:	53                   	push   %ebx
+  802853:	83 ec 08             	sub    $0x8,%esp
+  802856:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80285a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80285e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802862:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802866:	89 f9                	mov    %edi,%ecx
+  802868:	89 34 24             	mov    %esi,(%esp)
+  80286b:	09 f1                	or     %esi,%ecx
+  80286d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802871:	74 53                	je     8028c6 <__umoddi3+0x76>
+  802873:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80287f:	90                   	nop
+  802880:	89 c6                	mov    %eax,%esi
+  802882:	89 d7                	mov    %edx,%edi
+  802884:	31 db                	xor    %ebx,%ebx
+  802886:	d3 ef                	shr    %cl,%edi
+  802888:	0f ad d6             	shrd   %cl,%edx,%esi
+  80288b:	f6 c1 20             	test   $0x20,%cl
+  80288e:	0f 45 f7             	cmovne %edi,%esi
+  802891:	0f 45 fb             	cmovne %ebx,%edi
+  802894:	8b 1c 24             	mov    (%esp),%ebx
+  802897:	39 de                	cmp    %ebx,%esi
+  802899:	89 fb                	mov    %edi,%ebx
+  80289b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80289f:	8b 34 24             	mov    (%esp),%esi
+  8028a2:	19 fb                	sbb    %edi,%ebx
+  8028a4:	72 14                	jb     8028ba <__umoddi3+0x6a>
+  8028a6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8028a9:	31 db                	xor    %ebx,%ebx
+  8028ab:	d3 e6                	shl    %cl,%esi
+  8028ad:	f6 c1 20             	test   $0x20,%cl
+  8028b0:	0f 45 fe             	cmovne %esi,%edi
+  8028b3:	0f 45 f3             	cmovne %ebx,%esi
+  8028b6:	29 f0                	sub    %esi,%eax
+  8028b8:	19 fa                	sbb    %edi,%edx
+  8028ba:	83 e9 01             	sub    $0x1,%ecx
+  8028bd:	73 c1                	jae    802880 <__umoddi3+0x30>
+  8028bf:	83 c4 08             	add    $0x8,%esp
+  8028c2:	5b                   	pop    %ebx
+  8028c3:	5e                   	pop    %esi
+  8028c4:	5f                   	pop    %edi
+  8028c5:	c3                   	ret
+  8028c6:	83 c4 08             	add    $0x8,%esp
+  8028c9:	31 c0                	xor    %eax,%eax
+  8028cb:	31 d2                	xor    %edx,%edx
+  8028cd:	5b                   	pop    %ebx
+  8028ce:	5e                   	pop    %esi
+  8028cf:	5f                   	pop    %edi
+  8028d0:	c3                   	ret
+  8028d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028df:	90                   	nop
+
+008028e0 <__divdi3>:
+  8028e0:	55                   	push   %ebp
+  8028e1:	57                   	push   %edi
+  8028e2:	56                   	push   %esi
+  8028e3:	53                   	push   %ebx
+  8028e4:	83 ec 1c             	sub    $0x1c,%esp
+  8028e7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8028eb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8028ef:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8028f3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8028f7:	85 ff                	test   %edi,%edi
+  8028f9:	0f 88 da 00 00 00    	js     8029d9 <__divdi3+0xf9>
+  8028ff:	85 db                	test   %ebx,%ebx
+  802901:	78 16                	js     802919 <__divdi3+0x39>
+  802903:	89 dd                	mov    %ebx,%ebp
+  802905:	89 c8                	mov    %ecx,%eax
+  802907:	89 da                	mov    %ebx,%edx
+  802909:	09 cd                	or     %ecx,%ebp
+  80290b:	0f 85 fd 00 00 00    	jne    802a0e <__divdi3+0x12e>
+  802911:	83 c4 1c             	add    $0x1c,%esp
+  802914:	5b                   	pop    %ebx
+  802915:	5e                   	pop    %esi
+  802916:	5f                   	pop    %edi
+  802917:	5d                   	pop    %ebp
+  802918:	c3                   	ret
+  802919:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80291e:	f7 d9                	neg    %ecx
+  802920:	89 f0                	mov    %esi,%eax
+  802922:	89 fa                	mov    %edi,%edx
+  802924:	83 d3 00             	adc    $0x0,%ebx
+  802927:	89 0c 24             	mov    %ecx,(%esp)
+  80292a:	f7 db                	neg    %ebx
+  80292c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802930:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802937:	00 
+  802938:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80293d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802944:	00 
+  802945:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802949:	89 cd                	mov    %ecx,%ebp
+  80294b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80294f:	90                   	nop
+  802950:	89 e9                	mov    %ebp,%ecx
+  802952:	89 c3                	mov    %eax,%ebx
+  802954:	89 d6                	mov    %edx,%esi
+  802956:	31 ff                	xor    %edi,%edi
+  802958:	d3 ee                	shr    %cl,%esi
+  80295a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80295d:	f6 c1 20             	test   $0x20,%cl
+  802960:	0f 45 de             	cmovne %esi,%ebx
+  802963:	0f 45 f7             	cmovne %edi,%esi
+  802966:	8b 3c 24             	mov    (%esp),%edi
+  802969:	39 fb                	cmp    %edi,%ebx
+  80296b:	89 f7                	mov    %esi,%edi
+  80296d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802971:	8b 1c 24             	mov    (%esp),%ebx
+  802974:	19 f7                	sbb    %esi,%edi
+  802976:	72 39                	jb     8029b1 <__divdi3+0xd1>
+  802978:	89 e9                	mov    %ebp,%ecx
+  80297a:	89 f7                	mov    %esi,%edi
+  80297c:	89 de                	mov    %ebx,%esi
+  80297e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802981:	d3 e6                	shl    %cl,%esi
+  802983:	31 db                	xor    %ebx,%ebx
+  802985:	f6 c1 20             	test   $0x20,%cl
+  802988:	0f 45 fe             	cmovne %esi,%edi
+  80298b:	0f 45 f3             	cmovne %ebx,%esi
+  80298e:	29 f0                	sub    %esi,%eax
+  802990:	be 01 00 00 00       	mov    $0x1,%esi
+  802995:	19 fa                	sbb    %edi,%edx
+  802997:	31 ff                	xor    %edi,%edi
+  802999:	31 db                	xor    %ebx,%ebx
+  80299b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80299e:	d3 e6                	shl    %cl,%esi
+  8029a0:	f6 c1 20             	test   $0x20,%cl
+  8029a3:	0f 45 fe             	cmovne %esi,%edi
+  8029a6:	0f 45 f3             	cmovne %ebx,%esi
+  8029a9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8029ad:	09 74 24 08          	or     %esi,0x8(%esp)
+  8029b1:	83 ed 01             	sub    $0x1,%ebp
+  8029b4:	73 9a                	jae    802950 <__divdi3+0x70>
+  8029b6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8029ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029c2:	85 ed                	test   %ebp,%ebp
+  8029c4:	0f 84 47 ff ff ff    	je     802911 <__divdi3+0x31>
+  8029ca:	f7 d8                	neg    %eax
+  8029cc:	83 d2 00             	adc    $0x0,%edx
+  8029cf:	83 c4 1c             	add    $0x1c,%esp
+  8029d2:	5b                   	pop    %ebx
+  8029d3:	f7 da                	neg    %edx
+  8029d5:	5e                   	pop    %esi
+  8029d6:	5f                   	pop    %edi
+  8029d7:	5d                   	pop    %ebp
+  8029d8:	c3                   	ret
+  8029d9:	f7 de                	neg    %esi
+  8029db:	83 d7 00             	adc    $0x0,%edi
+  8029de:	f7 df                	neg    %edi
+  8029e0:	85 db                	test   %ebx,%ebx
+  8029e2:	78 23                	js     802a07 <__divdi3+0x127>
+  8029e4:	89 dd                	mov    %ebx,%ebp
+  8029e6:	89 c8                	mov    %ecx,%eax
+  8029e8:	89 da                	mov    %ebx,%edx
+  8029ea:	09 cd                	or     %ecx,%ebp
+  8029ec:	0f 84 1f ff ff ff    	je     802911 <__divdi3+0x31>
+  8029f2:	89 0c 24             	mov    %ecx,(%esp)
+  8029f5:	89 f0                	mov    %esi,%eax
+  8029f7:	89 fa                	mov    %edi,%edx
+  8029f9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8029fe:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a02:	e9 29 ff ff ff       	jmp    802930 <__divdi3+0x50>
+  802a07:	31 ed                	xor    %ebp,%ebp
+  802a09:	e9 10 ff ff ff       	jmp    80291e <__divdi3+0x3e>
+  802a0e:	89 0c 24             	mov    %ecx,(%esp)
+  802a11:	89 f0                	mov    %esi,%eax
+  802a13:	89 fa                	mov    %edi,%edx
+  802a15:	31 ed                	xor    %ebp,%ebp
+  802a17:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a1b:	e9 10 ff ff ff       	jmp    802930 <__divdi3+0x50>
+
+00802a20 <__moddi3>:
+  802a20:	55                   	push   %ebp
+  802a21:	57                   	push   %edi
+  802a22:	56                   	push   %esi
+  802a23:	53                   	push   %ebx
+  802a24:	83 ec 14             	sub    $0x14,%esp
+  802a27:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a2b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a2f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802a33:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802a37:	85 d2                	test   %edx,%edx
+  802a39:	0f 88 9b 00 00 00    	js     802ada <__moddi3+0xba>
+  802a3f:	89 f7                	mov    %esi,%edi
+  802a41:	31 ed                	xor    %ebp,%ebp
+  802a43:	09 cf                	or     %ecx,%edi
+  802a45:	0f 84 83 00 00 00    	je     802ace <__moddi3+0xae>
+  802a4b:	89 cb                	mov    %ecx,%ebx
+  802a4d:	89 f7                	mov    %esi,%edi
+  802a4f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802a53:	f7 db                	neg    %ebx
+  802a55:	83 d7 00             	adc    $0x0,%edi
+  802a58:	f7 df                	neg    %edi
+  802a5a:	0f 49 f7             	cmovns %edi,%esi
+  802a5d:	0f 49 cb             	cmovns %ebx,%ecx
+  802a60:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802a64:	89 0c 24             	mov    %ecx,(%esp)
+  802a67:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a6c:	89 cd                	mov    %ecx,%ebp
+  802a6e:	66 90                	xchg   %ax,%ax
+  802a70:	89 e9                	mov    %ebp,%ecx
+  802a72:	89 c3                	mov    %eax,%ebx
+  802a74:	89 d6                	mov    %edx,%esi
+  802a76:	31 ff                	xor    %edi,%edi
+  802a78:	d3 ee                	shr    %cl,%esi
+  802a7a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a7d:	f6 c1 20             	test   $0x20,%cl
+  802a80:	0f 45 de             	cmovne %esi,%ebx
+  802a83:	0f 45 f7             	cmovne %edi,%esi
+  802a86:	8b 3c 24             	mov    (%esp),%edi
+  802a89:	39 fb                	cmp    %edi,%ebx
+  802a8b:	89 f7                	mov    %esi,%edi
+  802a8d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802a91:	8b 1c 24             	mov    (%esp),%ebx
+  802a94:	19 f7                	sbb    %esi,%edi
+  802a96:	72 1a                	jb     802ab2 <__moddi3+0x92>
+  802a98:	89 e9                	mov    %ebp,%ecx
+  802a9a:	89 f7                	mov    %esi,%edi
+  802a9c:	89 de                	mov    %ebx,%esi
+  802a9e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802aa1:	d3 e6                	shl    %cl,%esi
+  802aa3:	31 db                	xor    %ebx,%ebx
+  802aa5:	f6 c1 20             	test   $0x20,%cl
+  802aa8:	0f 45 fe             	cmovne %esi,%edi
+  802aab:	0f 45 f3             	cmovne %ebx,%esi
+  802aae:	29 f0                	sub    %esi,%eax
+  802ab0:	19 fa                	sbb    %edi,%edx
+  802ab2:	83 ed 01             	sub    $0x1,%ebp
+  802ab5:	73 b9                	jae    802a70 <__moddi3+0x50>
+  802ab7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802abb:	85 ed                	test   %ebp,%ebp
+  802abd:	74 07                	je     802ac6 <__moddi3+0xa6>
+  802abf:	f7 d8                	neg    %eax
+  802ac1:	83 d2 00             	adc    $0x0,%edx
+  802ac4:	f7 da                	neg    %edx
+  802ac6:	83 c4 14             	add    $0x14,%esp
+  802ac9:	5b                   	pop    %ebx
+  802aca:	5e                   	pop    %esi
+  802acb:	5f                   	pop    %edi
+  802acc:	5d                   	pop    %ebp
+  802acd:	c3                   	ret
+  802ace:	83 c4 14             	add    $0x14,%esp
+  802ad1:	31 c0                	xor    %eax,%eax
+  802ad3:	31 d2                	xor    %edx,%edx
+  802ad5:	5b                   	pop    %ebx
+  802ad6:	5e                   	pop    %esi
+  802ad7:	5f                   	pop    %edi
+  802ad8:	5d                   	pop    %ebp
+  802ad9:	c3                   	ret
+  802ada:	89 f7                	mov    %esi,%edi
+  802adc:	09 cf                	or     %ecx,%edi
+  802ade:	74 11                	je     802af1 <__moddi3+0xd1>
+  802ae0:	f7 d8                	neg    %eax
+  802ae2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802ae7:	83 d2 00             	adc    $0x0,%edx
+  802aea:	f7 da                	neg    %edx
+  802aec:	e9 5a ff ff ff       	jmp    802a4b <__moddi3+0x2b>
+  802af1:	31 c0                	xor    %eax,%eax
+  802af3:	31 d2                	xor    %edx,%edx
+  802af5:	eb c8                	jmp    802abf <__moddi3+0x9f>
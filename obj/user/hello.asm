@@ -0,0 +1,5568 @@
+
+obj/user/hello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2d 00 00 00       	call   80005e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("hello, world\n");
+  800039:	68 a0 26 80 00       	push   $0x8026a0
+  80003e:	e8 10 01 00 00       	call   800153 <cprintf>
+	cprintf("i am environment %08x\n", thisenv->env_id);
+  800043:	a1 08 40 80 00       	mov    0x804008,%eax
+  800048:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80004b:	83 c4 08             	add    $0x8,%esp
+  80004e:	50                   	push   %eax
+  80004f:	68 ae 26 80 00       	push   $0x8026ae
+  800054:	e8 fa 00 00 00       	call   800153 <cprintf>
+}
+  800059:	83 c4 10             	add    $0x10,%esp
+  80005c:	c9                   	leave
+  80005d:	c3                   	ret
+
+0080005e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80005e:	55                   	push   %ebp
+  80005f:	89 e5                	mov    %esp,%ebp
+  800061:	56                   	push   %esi
+  800062:	53                   	push   %ebx
+  800063:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800066:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800069:	e8 a1 0a 00 00       	call   800b0f <sys_getenvid>
+  80006e:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800073:	c1 e0 09             	shl    $0x9,%eax
+  800076:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80007b:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800080:	85 db                	test   %ebx,%ebx
+  800082:	7e 07                	jle    80008b <libmain+0x2d>
+		binaryname = argv[0];
+  800084:	8b 06                	mov    (%esi),%eax
+  800086:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80008b:	83 ec 08             	sub    $0x8,%esp
+  80008e:	56                   	push   %esi
+  80008f:	53                   	push   %ebx
+  800090:	e8 9e ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800095:	e8 0a 00 00 00       	call   8000a4 <exit>
+}
+  80009a:	83 c4 10             	add    $0x10,%esp
+  80009d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000a0:	5b                   	pop    %ebx
+  8000a1:	5e                   	pop    %esi
+  8000a2:	5d                   	pop    %ebp
+  8000a3:	c3                   	ret
+
+008000a4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000a4:	55                   	push   %ebp
+  8000a5:	89 e5                	mov    %esp,%ebp
+  8000a7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000aa:	e8 f8 10 00 00       	call   8011a7 <close_all>
+	sys_env_destroy(0);
+  8000af:	83 ec 0c             	sub    $0xc,%esp
+  8000b2:	6a 00                	push   $0x0
+  8000b4:	e8 15 0a 00 00       	call   800ace <sys_env_destroy>
+}
+  8000b9:	83 c4 10             	add    $0x10,%esp
+  8000bc:	c9                   	leave
+  8000bd:	c3                   	ret
+
+008000be <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000be:	55                   	push   %ebp
+  8000bf:	89 e5                	mov    %esp,%ebp
+  8000c1:	53                   	push   %ebx
+  8000c2:	83 ec 04             	sub    $0x4,%esp
+  8000c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000c8:	8b 13                	mov    (%ebx),%edx
+  8000ca:	8d 42 01             	lea    0x1(%edx),%eax
+  8000cd:	89 03                	mov    %eax,(%ebx)
+  8000cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000d2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000d6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000db:	74 09                	je     8000e6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000dd:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000e4:	c9                   	leave
+  8000e5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000e6:	83 ec 08             	sub    $0x8,%esp
+  8000e9:	68 ff 00 00 00       	push   $0xff
+  8000ee:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000f1:	50                   	push   %eax
+  8000f2:	e8 7a 09 00 00       	call   800a71 <sys_cputs>
+		b->idx = 0;
+  8000f7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000fd:	83 c4 10             	add    $0x10,%esp
+  800100:	eb db                	jmp    8000dd <putch+0x1f>
+
+00800102 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800102:	55                   	push   %ebp
+  800103:	89 e5                	mov    %esp,%ebp
+  800105:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80010b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800112:	00 00 00 
+	b.cnt = 0;
+  800115:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80011c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80011f:	ff 75 0c             	push   0xc(%ebp)
+  800122:	ff 75 08             	push   0x8(%ebp)
+  800125:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80012b:	50                   	push   %eax
+  80012c:	68 be 00 80 00       	push   $0x8000be
+  800131:	e8 14 01 00 00       	call   80024a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800136:	83 c4 08             	add    $0x8,%esp
+  800139:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80013f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800145:	50                   	push   %eax
+  800146:	e8 26 09 00 00       	call   800a71 <sys_cputs>
+
+	return b.cnt;
+}
+  80014b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800151:	c9                   	leave
+  800152:	c3                   	ret
+
+00800153 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800153:	55                   	push   %ebp
+  800154:	89 e5                	mov    %esp,%ebp
+  800156:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800159:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80015c:	50                   	push   %eax
+  80015d:	ff 75 08             	push   0x8(%ebp)
+  800160:	e8 9d ff ff ff       	call   800102 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800165:	c9                   	leave
+  800166:	c3                   	ret
+
+00800167 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	57                   	push   %edi
+  80016b:	56                   	push   %esi
+  80016c:	53                   	push   %ebx
+  80016d:	83 ec 1c             	sub    $0x1c,%esp
+  800170:	89 c7                	mov    %eax,%edi
+  800172:	89 d6                	mov    %edx,%esi
+  800174:	8b 45 08             	mov    0x8(%ebp),%eax
+  800177:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80017a:	89 d1                	mov    %edx,%ecx
+  80017c:	89 c2                	mov    %eax,%edx
+  80017e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800181:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800184:	8b 45 10             	mov    0x10(%ebp),%eax
+  800187:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80018a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80018d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800194:	39 c2                	cmp    %eax,%edx
+  800196:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800199:	72 3e                	jb     8001d9 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80019b:	83 ec 0c             	sub    $0xc,%esp
+  80019e:	ff 75 18             	push   0x18(%ebp)
+  8001a1:	83 eb 01             	sub    $0x1,%ebx
+  8001a4:	53                   	push   %ebx
+  8001a5:	50                   	push   %eax
+  8001a6:	83 ec 08             	sub    $0x8,%esp
+  8001a9:	ff 75 e4             	push   -0x1c(%ebp)
+  8001ac:	ff 75 e0             	push   -0x20(%ebp)
+  8001af:	ff 75 dc             	push   -0x24(%ebp)
+  8001b2:	ff 75 d8             	push   -0x28(%ebp)
+  8001b5:	e8 66 21 00 00       	call   802320 <__udivdi3>
+  8001ba:	83 c4 18             	add    $0x18,%esp
+  8001bd:	52                   	push   %edx
+  8001be:	50                   	push   %eax
+  8001bf:	89 f2                	mov    %esi,%edx
+  8001c1:	89 f8                	mov    %edi,%eax
+  8001c3:	e8 9f ff ff ff       	call   800167 <printnum>
+  8001c8:	83 c4 20             	add    $0x20,%esp
+  8001cb:	eb 13                	jmp    8001e0 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001cd:	83 ec 08             	sub    $0x8,%esp
+  8001d0:	56                   	push   %esi
+  8001d1:	ff 75 18             	push   0x18(%ebp)
+  8001d4:	ff d7                	call   *%edi
+  8001d6:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001d9:	83 eb 01             	sub    $0x1,%ebx
+  8001dc:	85 db                	test   %ebx,%ebx
+  8001de:	7f ed                	jg     8001cd <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001e0:	83 ec 08             	sub    $0x8,%esp
+  8001e3:	56                   	push   %esi
+  8001e4:	83 ec 04             	sub    $0x4,%esp
+  8001e7:	ff 75 e4             	push   -0x1c(%ebp)
+  8001ea:	ff 75 e0             	push   -0x20(%ebp)
+  8001ed:	ff 75 dc             	push   -0x24(%ebp)
+  8001f0:	ff 75 d8             	push   -0x28(%ebp)
+  8001f3:	e8 e8 21 00 00       	call   8023e0 <__umoddi3>
+  8001f8:	83 c4 14             	add    $0x14,%esp
+  8001fb:	0f be 80 cf 26 80 00 	movsbl 0x8026cf(%eax),%eax
+  800202:	50                   	push   %eax
+  800203:	ff d7                	call   *%edi
+}
+  800205:	83 c4 10             	add    $0x10,%esp
+  800208:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020b:	5b                   	pop    %ebx
+  80020c:	5e                   	pop    %esi
+  80020d:	5f                   	pop    %edi
+  80020e:	5d                   	pop    %ebp
+  80020f:	c3                   	ret
+
+00800210 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800210:	55                   	push   %ebp
+  800211:	89 e5                	mov    %esp,%ebp
+  800213:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800216:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80021a:	8b 10                	mov    (%eax),%edx
+  80021c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80021f:	73 0a                	jae    80022b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800221:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800224:	89 08                	mov    %ecx,(%eax)
+  800226:	8b 45 08             	mov    0x8(%ebp),%eax
+  800229:	88 02                	mov    %al,(%edx)
+}
+  80022b:	5d                   	pop    %ebp
+  80022c:	c3                   	ret
+
+0080022d <printfmt>:
+{
+  80022d:	55                   	push   %ebp
+  80022e:	89 e5                	mov    %esp,%ebp
+  800230:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800233:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800236:	50                   	push   %eax
+  800237:	ff 75 10             	push   0x10(%ebp)
+  80023a:	ff 75 0c             	push   0xc(%ebp)
+  80023d:	ff 75 08             	push   0x8(%ebp)
+  800240:	e8 05 00 00 00       	call   80024a <vprintfmt>
+}
+  800245:	83 c4 10             	add    $0x10,%esp
+  800248:	c9                   	leave
+  800249:	c3                   	ret
+
+0080024a <vprintfmt>:
+{
+  80024a:	55                   	push   %ebp
+  80024b:	89 e5                	mov    %esp,%ebp
+  80024d:	57                   	push   %edi
+  80024e:	56                   	push   %esi
+  80024f:	53                   	push   %ebx
+  800250:	83 ec 2c             	sub    $0x2c,%esp
+  800253:	8b 75 08             	mov    0x8(%ebp),%esi
+  800256:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800259:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80025c:	eb 0a                	jmp    800268 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80025e:	83 ec 08             	sub    $0x8,%esp
+  800261:	53                   	push   %ebx
+  800262:	50                   	push   %eax
+  800263:	ff d6                	call   *%esi
+  800265:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800268:	83 c7 01             	add    $0x1,%edi
+  80026b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80026f:	83 f8 25             	cmp    $0x25,%eax
+  800272:	74 0c                	je     800280 <vprintfmt+0x36>
+			if (ch == '\0')
+  800274:	85 c0                	test   %eax,%eax
+  800276:	75 e6                	jne    80025e <vprintfmt+0x14>
+}
+  800278:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027b:	5b                   	pop    %ebx
+  80027c:	5e                   	pop    %esi
+  80027d:	5f                   	pop    %edi
+  80027e:	5d                   	pop    %ebp
+  80027f:	c3                   	ret
+		padc = ' ';
+  800280:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800284:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80028b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800292:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800299:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80029e:	8d 47 01             	lea    0x1(%edi),%eax
+  8002a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002a4:	0f b6 17             	movzbl (%edi),%edx
+  8002a7:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002aa:	3c 55                	cmp    $0x55,%al
+  8002ac:	0f 87 cf 03 00 00    	ja     800681 <vprintfmt+0x437>
+  8002b2:	0f b6 c0             	movzbl %al,%eax
+  8002b5:	ff 24 85 20 28 80 00 	jmp    *0x802820(,%eax,4)
+  8002bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002bf:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002c3:	eb d9                	jmp    80029e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002c8:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002cc:	eb d0                	jmp    80029e <vprintfmt+0x54>
+  8002ce:	0f b6 d2             	movzbl %dl,%edx
+  8002d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002dc:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002df:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002e3:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002e6:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002e9:	83 f9 09             	cmp    $0x9,%ecx
+  8002ec:	77 55                	ja     800343 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002ee:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002f1:	eb e9                	jmp    8002dc <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f6:	8b 00                	mov    (%eax),%eax
+  8002f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002fe:	8d 40 04             	lea    0x4(%eax),%eax
+  800301:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800304:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800307:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80030b:	79 91                	jns    80029e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80030d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800310:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800313:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80031a:	eb 82                	jmp    80029e <vprintfmt+0x54>
+			if (width < 0)
+  80031c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80031f:	85 d2                	test   %edx,%edx
+  800321:	b8 00 00 00 00       	mov    $0x0,%eax
+  800326:	0f 49 c2             	cmovns %edx,%eax
+  800329:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80032c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80032f:	e9 6a ff ff ff       	jmp    80029e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800334:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800337:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80033e:	e9 5b ff ff ff       	jmp    80029e <vprintfmt+0x54>
+  800343:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800346:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800349:	eb bc                	jmp    800307 <vprintfmt+0xbd>
+			lflag++;
+  80034b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80034e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800351:	e9 48 ff ff ff       	jmp    80029e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800356:	8b 45 14             	mov    0x14(%ebp),%eax
+  800359:	8d 78 04             	lea    0x4(%eax),%edi
+  80035c:	83 ec 08             	sub    $0x8,%esp
+  80035f:	53                   	push   %ebx
+  800360:	ff 30                	push   (%eax)
+  800362:	ff d6                	call   *%esi
+			break;
+  800364:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800367:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80036a:	e9 b1 02 00 00       	jmp    800620 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80036f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800372:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800375:	8b 10                	mov    (%eax),%edx
+  800377:	89 d0                	mov    %edx,%eax
+  800379:	f7 d8                	neg    %eax
+  80037b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80037e:	83 f8 0f             	cmp    $0xf,%eax
+  800381:	7f 23                	jg     8003a6 <vprintfmt+0x15c>
+  800383:	8b 14 85 80 29 80 00 	mov    0x802980(,%eax,4),%edx
+  80038a:	85 d2                	test   %edx,%edx
+  80038c:	74 18                	je     8003a6 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80038e:	52                   	push   %edx
+  80038f:	68 b5 2a 80 00       	push   $0x802ab5
+  800394:	53                   	push   %ebx
+  800395:	56                   	push   %esi
+  800396:	e8 92 fe ff ff       	call   80022d <printfmt>
+  80039b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80039e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003a1:	e9 7a 02 00 00       	jmp    800620 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003a6:	50                   	push   %eax
+  8003a7:	68 e7 26 80 00       	push   $0x8026e7
+  8003ac:	53                   	push   %ebx
+  8003ad:	56                   	push   %esi
+  8003ae:	e8 7a fe ff ff       	call   80022d <printfmt>
+  8003b3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003b6:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003b9:	e9 62 02 00 00       	jmp    800620 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c1:	83 c0 04             	add    $0x4,%eax
+  8003c4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ca:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003cc:	85 c9                	test   %ecx,%ecx
+  8003ce:	b8 e0 26 80 00       	mov    $0x8026e0,%eax
+  8003d3:	0f 45 c1             	cmovne %ecx,%eax
+  8003d6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003d9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003dd:	7e 06                	jle    8003e5 <vprintfmt+0x19b>
+  8003df:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003e3:	75 0b                	jne    8003f0 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003e5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003e8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003eb:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003ee:	eb 5c                	jmp    80044c <vprintfmt+0x202>
+  8003f0:	83 ec 08             	sub    $0x8,%esp
+  8003f3:	ff 75 d0             	push   -0x30(%ebp)
+  8003f6:	ff 75 cc             	push   -0x34(%ebp)
+  8003f9:	e8 20 03 00 00       	call   80071e <strnlen>
+  8003fe:	89 c2                	mov    %eax,%edx
+  800400:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800403:	29 d0                	sub    %edx,%eax
+  800405:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800408:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80040c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80040f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800412:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800414:	eb 0e                	jmp    800424 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800416:	83 ec 08             	sub    $0x8,%esp
+  800419:	53                   	push   %ebx
+  80041a:	57                   	push   %edi
+  80041b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80041e:	83 ee 01             	sub    $0x1,%esi
+  800421:	83 c4 10             	add    $0x10,%esp
+  800424:	85 f6                	test   %esi,%esi
+  800426:	7f ee                	jg     800416 <vprintfmt+0x1cc>
+  800428:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80042b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80042e:	85 c0                	test   %eax,%eax
+  800430:	ba 00 00 00 00       	mov    $0x0,%edx
+  800435:	0f 49 d0             	cmovns %eax,%edx
+  800438:	29 d0                	sub    %edx,%eax
+  80043a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80043d:	eb a6                	jmp    8003e5 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80043f:	83 ec 08             	sub    $0x8,%esp
+  800442:	53                   	push   %ebx
+  800443:	52                   	push   %edx
+  800444:	ff 55 08             	call   *0x8(%ebp)
+  800447:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80044a:	89 f1                	mov    %esi,%ecx
+  80044c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80044f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800453:	0f be d0             	movsbl %al,%edx
+  800456:	85 d2                	test   %edx,%edx
+  800458:	74 28                	je     800482 <vprintfmt+0x238>
+  80045a:	85 ff                	test   %edi,%edi
+  80045c:	78 05                	js     800463 <vprintfmt+0x219>
+  80045e:	83 ef 01             	sub    $0x1,%edi
+  800461:	78 30                	js     800493 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800463:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800467:	74 d6                	je     80043f <vprintfmt+0x1f5>
+  800469:	0f be c0             	movsbl %al,%eax
+  80046c:	83 e8 20             	sub    $0x20,%eax
+  80046f:	83 f8 5e             	cmp    $0x5e,%eax
+  800472:	76 cb                	jbe    80043f <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800474:	83 ec 08             	sub    $0x8,%esp
+  800477:	53                   	push   %ebx
+  800478:	6a 3f                	push   $0x3f
+  80047a:	ff 55 08             	call   *0x8(%ebp)
+  80047d:	83 c4 10             	add    $0x10,%esp
+  800480:	eb c8                	jmp    80044a <vprintfmt+0x200>
+  800482:	8b 75 08             	mov    0x8(%ebp),%esi
+  800485:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800488:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80048b:	01 d0                	add    %edx,%eax
+  80048d:	29 c8                	sub    %ecx,%eax
+  80048f:	89 c7                	mov    %eax,%edi
+  800491:	eb 13                	jmp    8004a6 <vprintfmt+0x25c>
+  800493:	8b 75 08             	mov    0x8(%ebp),%esi
+  800496:	eb ed                	jmp    800485 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800498:	83 ec 08             	sub    $0x8,%esp
+  80049b:	53                   	push   %ebx
+  80049c:	6a 20                	push   $0x20
+  80049e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004a0:	83 ef 01             	sub    $0x1,%edi
+  8004a3:	83 c4 10             	add    $0x10,%esp
+  8004a6:	85 ff                	test   %edi,%edi
+  8004a8:	7f ee                	jg     800498 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004aa:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004b0:	e9 6b 01 00 00       	jmp    800620 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004b5:	83 f9 01             	cmp    $0x1,%ecx
+  8004b8:	7f 1f                	jg     8004d9 <vprintfmt+0x28f>
+	else if (lflag)
+  8004ba:	85 c9                	test   %ecx,%ecx
+  8004bc:	74 67                	je     800525 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c1:	8b 00                	mov    (%eax),%eax
+  8004c3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004c6:	89 c1                	mov    %eax,%ecx
+  8004c8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004cb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8004d4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d7:	eb 17                	jmp    8004f0 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dc:	8b 50 04             	mov    0x4(%eax),%edx
+  8004df:	8b 00                	mov    (%eax),%eax
+  8004e1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004e4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ea:	8d 40 08             	lea    0x8(%eax),%eax
+  8004ed:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004f0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004f3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004fb:	85 c9                	test   %ecx,%ecx
+  8004fd:	0f 89 03 01 00 00    	jns    800606 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800503:	83 ec 08             	sub    $0x8,%esp
+  800506:	53                   	push   %ebx
+  800507:	6a 2d                	push   $0x2d
+  800509:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80050b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80050e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800511:	f7 da                	neg    %edx
+  800513:	83 d1 00             	adc    $0x0,%ecx
+  800516:	f7 d9                	neg    %ecx
+  800518:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80051b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800520:	e9 e1 00 00 00       	jmp    800606 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800525:	8b 45 14             	mov    0x14(%ebp),%eax
+  800528:	8b 00                	mov    (%eax),%eax
+  80052a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052d:	89 c1                	mov    %eax,%ecx
+  80052f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800532:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800535:	8b 45 14             	mov    0x14(%ebp),%eax
+  800538:	8d 40 04             	lea    0x4(%eax),%eax
+  80053b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053e:	eb b0                	jmp    8004f0 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800540:	83 f9 01             	cmp    $0x1,%ecx
+  800543:	7f 1e                	jg     800563 <vprintfmt+0x319>
+	else if (lflag)
+  800545:	85 c9                	test   %ecx,%ecx
+  800547:	74 32                	je     80057b <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800549:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054c:	8b 10                	mov    (%eax),%edx
+  80054e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800553:	8d 40 04             	lea    0x4(%eax),%eax
+  800556:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800559:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80055e:	e9 a3 00 00 00       	jmp    800606 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800563:	8b 45 14             	mov    0x14(%ebp),%eax
+  800566:	8b 10                	mov    (%eax),%edx
+  800568:	8b 48 04             	mov    0x4(%eax),%ecx
+  80056b:	8d 40 08             	lea    0x8(%eax),%eax
+  80056e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800571:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800576:	e9 8b 00 00 00       	jmp    800606 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80057b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057e:	8b 10                	mov    (%eax),%edx
+  800580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800585:	8d 40 04             	lea    0x4(%eax),%eax
+  800588:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80058b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800590:	eb 74                	jmp    800606 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800592:	83 f9 01             	cmp    $0x1,%ecx
+  800595:	7f 1b                	jg     8005b2 <vprintfmt+0x368>
+	else if (lflag)
+  800597:	85 c9                	test   %ecx,%ecx
+  800599:	74 2c                	je     8005c7 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80059b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059e:	8b 10                	mov    (%eax),%edx
+  8005a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005ab:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005b0:	eb 54                	jmp    800606 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8b 10                	mov    (%eax),%edx
+  8005b7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005ba:	8d 40 08             	lea    0x8(%eax),%eax
+  8005bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005c0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005c5:	eb 3f                	jmp    800606 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ca:	8b 10                	mov    (%eax),%edx
+  8005cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005d7:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005dc:	eb 28                	jmp    800606 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005de:	83 ec 08             	sub    $0x8,%esp
+  8005e1:	53                   	push   %ebx
+  8005e2:	6a 30                	push   $0x30
+  8005e4:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005e6:	83 c4 08             	add    $0x8,%esp
+  8005e9:	53                   	push   %ebx
+  8005ea:	6a 78                	push   $0x78
+  8005ec:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f1:	8b 10                	mov    (%eax),%edx
+  8005f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005f8:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800601:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800606:	83 ec 0c             	sub    $0xc,%esp
+  800609:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80060d:	50                   	push   %eax
+  80060e:	ff 75 e0             	push   -0x20(%ebp)
+  800611:	57                   	push   %edi
+  800612:	51                   	push   %ecx
+  800613:	52                   	push   %edx
+  800614:	89 da                	mov    %ebx,%edx
+  800616:	89 f0                	mov    %esi,%eax
+  800618:	e8 4a fb ff ff       	call   800167 <printnum>
+			break;
+  80061d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800620:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800623:	e9 40 fc ff ff       	jmp    800268 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800628:	83 f9 01             	cmp    $0x1,%ecx
+  80062b:	7f 1b                	jg     800648 <vprintfmt+0x3fe>
+	else if (lflag)
+  80062d:	85 c9                	test   %ecx,%ecx
+  80062f:	74 2c                	je     80065d <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800631:	8b 45 14             	mov    0x14(%ebp),%eax
+  800634:	8b 10                	mov    (%eax),%edx
+  800636:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063b:	8d 40 04             	lea    0x4(%eax),%eax
+  80063e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800641:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800646:	eb be                	jmp    800606 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800648:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064b:	8b 10                	mov    (%eax),%edx
+  80064d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800650:	8d 40 08             	lea    0x8(%eax),%eax
+  800653:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800656:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80065b:	eb a9                	jmp    800606 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80065d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800660:	8b 10                	mov    (%eax),%edx
+  800662:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800667:	8d 40 04             	lea    0x4(%eax),%eax
+  80066a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80066d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800672:	eb 92                	jmp    800606 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800674:	83 ec 08             	sub    $0x8,%esp
+  800677:	53                   	push   %ebx
+  800678:	6a 25                	push   $0x25
+  80067a:	ff d6                	call   *%esi
+			break;
+  80067c:	83 c4 10             	add    $0x10,%esp
+  80067f:	eb 9f                	jmp    800620 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800681:	83 ec 08             	sub    $0x8,%esp
+  800684:	53                   	push   %ebx
+  800685:	6a 25                	push   $0x25
+  800687:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800689:	83 c4 10             	add    $0x10,%esp
+  80068c:	89 f8                	mov    %edi,%eax
+  80068e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800692:	74 05                	je     800699 <vprintfmt+0x44f>
+  800694:	83 e8 01             	sub    $0x1,%eax
+  800697:	eb f5                	jmp    80068e <vprintfmt+0x444>
+  800699:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80069c:	eb 82                	jmp    800620 <vprintfmt+0x3d6>
+
+0080069e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80069e:	55                   	push   %ebp
+  80069f:	89 e5                	mov    %esp,%ebp
+  8006a1:	83 ec 18             	sub    $0x18,%esp
+  8006a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006aa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006ad:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006b1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006b4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006bb:	85 c0                	test   %eax,%eax
+  8006bd:	74 26                	je     8006e5 <vsnprintf+0x47>
+  8006bf:	85 d2                	test   %edx,%edx
+  8006c1:	7e 22                	jle    8006e5 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006c3:	ff 75 14             	push   0x14(%ebp)
+  8006c6:	ff 75 10             	push   0x10(%ebp)
+  8006c9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006cc:	50                   	push   %eax
+  8006cd:	68 10 02 80 00       	push   $0x800210
+  8006d2:	e8 73 fb ff ff       	call   80024a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006d7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006da:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006e0:	83 c4 10             	add    $0x10,%esp
+}
+  8006e3:	c9                   	leave
+  8006e4:	c3                   	ret
+		return -E_INVAL;
+  8006e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006ea:	eb f7                	jmp    8006e3 <vsnprintf+0x45>
+
+008006ec <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006ec:	55                   	push   %ebp
+  8006ed:	89 e5                	mov    %esp,%ebp
+  8006ef:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006f2:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006f5:	50                   	push   %eax
+  8006f6:	ff 75 10             	push   0x10(%ebp)
+  8006f9:	ff 75 0c             	push   0xc(%ebp)
+  8006fc:	ff 75 08             	push   0x8(%ebp)
+  8006ff:	e8 9a ff ff ff       	call   80069e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800704:	c9                   	leave
+  800705:	c3                   	ret
+
+00800706 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800706:	55                   	push   %ebp
+  800707:	89 e5                	mov    %esp,%ebp
+  800709:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80070c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800711:	eb 03                	jmp    800716 <strlen+0x10>
+		n++;
+  800713:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800716:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80071a:	75 f7                	jne    800713 <strlen+0xd>
+	return n;
+}
+  80071c:	5d                   	pop    %ebp
+  80071d:	c3                   	ret
+
+0080071e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80071e:	55                   	push   %ebp
+  80071f:	89 e5                	mov    %esp,%ebp
+  800721:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800724:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80072c:	eb 03                	jmp    800731 <strnlen+0x13>
+		n++;
+  80072e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800731:	39 d0                	cmp    %edx,%eax
+  800733:	74 08                	je     80073d <strnlen+0x1f>
+  800735:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800739:	75 f3                	jne    80072e <strnlen+0x10>
+  80073b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80073d:	89 d0                	mov    %edx,%eax
+  80073f:	5d                   	pop    %ebp
+  800740:	c3                   	ret
+
+00800741 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800741:	55                   	push   %ebp
+  800742:	89 e5                	mov    %esp,%ebp
+  800744:	53                   	push   %ebx
+  800745:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800748:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800754:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800757:	83 c0 01             	add    $0x1,%eax
+  80075a:	84 d2                	test   %dl,%dl
+  80075c:	75 f2                	jne    800750 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80075e:	89 c8                	mov    %ecx,%eax
+  800760:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800763:	c9                   	leave
+  800764:	c3                   	ret
+
+00800765 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800765:	55                   	push   %ebp
+  800766:	89 e5                	mov    %esp,%ebp
+  800768:	53                   	push   %ebx
+  800769:	83 ec 10             	sub    $0x10,%esp
+  80076c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80076f:	53                   	push   %ebx
+  800770:	e8 91 ff ff ff       	call   800706 <strlen>
+  800775:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800778:	ff 75 0c             	push   0xc(%ebp)
+  80077b:	01 d8                	add    %ebx,%eax
+  80077d:	50                   	push   %eax
+  80077e:	e8 be ff ff ff       	call   800741 <strcpy>
+	return dst;
+}
+  800783:	89 d8                	mov    %ebx,%eax
+  800785:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800788:	c9                   	leave
+  800789:	c3                   	ret
+
+0080078a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80078a:	55                   	push   %ebp
+  80078b:	89 e5                	mov    %esp,%ebp
+  80078d:	56                   	push   %esi
+  80078e:	53                   	push   %ebx
+  80078f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800792:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800795:	89 f3                	mov    %esi,%ebx
+  800797:	03 5d 10             	add    0x10(%ebp),%ebx
+  80079a:	89 f0                	mov    %esi,%eax
+  80079c:	eb 0f                	jmp    8007ad <strncpy+0x23>
+		*dst++ = *src;
+  80079e:	83 c0 01             	add    $0x1,%eax
+  8007a1:	0f b6 0a             	movzbl (%edx),%ecx
+  8007a4:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007a7:	80 f9 01             	cmp    $0x1,%cl
+  8007aa:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007ad:	39 d8                	cmp    %ebx,%eax
+  8007af:	75 ed                	jne    80079e <strncpy+0x14>
+	}
+	return ret;
+}
+  8007b1:	89 f0                	mov    %esi,%eax
+  8007b3:	5b                   	pop    %ebx
+  8007b4:	5e                   	pop    %esi
+  8007b5:	5d                   	pop    %ebp
+  8007b6:	c3                   	ret
+
+008007b7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007b7:	55                   	push   %ebp
+  8007b8:	89 e5                	mov    %esp,%ebp
+  8007ba:	56                   	push   %esi
+  8007bb:	53                   	push   %ebx
+  8007bc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007c2:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007c5:	89 f0                	mov    %esi,%eax
+  8007c7:	85 d2                	test   %edx,%edx
+  8007c9:	74 21                	je     8007ec <strlcpy+0x35>
+  8007cb:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007cf:	89 f2                	mov    %esi,%edx
+  8007d1:	eb 09                	jmp    8007dc <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007d3:	83 c1 01             	add    $0x1,%ecx
+  8007d6:	83 c2 01             	add    $0x1,%edx
+  8007d9:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007dc:	39 c2                	cmp    %eax,%edx
+  8007de:	74 09                	je     8007e9 <strlcpy+0x32>
+  8007e0:	0f b6 19             	movzbl (%ecx),%ebx
+  8007e3:	84 db                	test   %bl,%bl
+  8007e5:	75 ec                	jne    8007d3 <strlcpy+0x1c>
+  8007e7:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007e9:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007ec:	29 f0                	sub    %esi,%eax
+}
+  8007ee:	5b                   	pop    %ebx
+  8007ef:	5e                   	pop    %esi
+  8007f0:	5d                   	pop    %ebp
+  8007f1:	c3                   	ret
+
+008007f2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007f2:	55                   	push   %ebp
+  8007f3:	89 e5                	mov    %esp,%ebp
+  8007f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007fb:	eb 06                	jmp    800803 <strcmp+0x11>
+		p++, q++;
+  8007fd:	83 c1 01             	add    $0x1,%ecx
+  800800:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800803:	0f b6 01             	movzbl (%ecx),%eax
+  800806:	84 c0                	test   %al,%al
+  800808:	74 04                	je     80080e <strcmp+0x1c>
+  80080a:	3a 02                	cmp    (%edx),%al
+  80080c:	74 ef                	je     8007fd <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80080e:	0f b6 c0             	movzbl %al,%eax
+  800811:	0f b6 12             	movzbl (%edx),%edx
+  800814:	29 d0                	sub    %edx,%eax
+}
+  800816:	5d                   	pop    %ebp
+  800817:	c3                   	ret
+
+00800818 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800818:	55                   	push   %ebp
+  800819:	89 e5                	mov    %esp,%ebp
+  80081b:	53                   	push   %ebx
+  80081c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80081f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800822:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800825:	eb 09                	jmp    800830 <strncmp+0x18>
+		n--, p++, q++;
+  800827:	83 ea 01             	sub    $0x1,%edx
+  80082a:	83 c0 01             	add    $0x1,%eax
+  80082d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800830:	85 d2                	test   %edx,%edx
+  800832:	74 18                	je     80084c <strncmp+0x34>
+  800834:	0f b6 18             	movzbl (%eax),%ebx
+  800837:	84 db                	test   %bl,%bl
+  800839:	74 04                	je     80083f <strncmp+0x27>
+  80083b:	3a 19                	cmp    (%ecx),%bl
+  80083d:	74 e8                	je     800827 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80083f:	0f b6 00             	movzbl (%eax),%eax
+  800842:	0f b6 11             	movzbl (%ecx),%edx
+  800845:	29 d0                	sub    %edx,%eax
+}
+  800847:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084a:	c9                   	leave
+  80084b:	c3                   	ret
+		return 0;
+  80084c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800851:	eb f4                	jmp    800847 <strncmp+0x2f>
+
+00800853 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800853:	55                   	push   %ebp
+  800854:	89 e5                	mov    %esp,%ebp
+  800856:	8b 45 08             	mov    0x8(%ebp),%eax
+  800859:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80085d:	eb 03                	jmp    800862 <strchr+0xf>
+  80085f:	83 c0 01             	add    $0x1,%eax
+  800862:	0f b6 10             	movzbl (%eax),%edx
+  800865:	84 d2                	test   %dl,%dl
+  800867:	74 06                	je     80086f <strchr+0x1c>
+		if (*s == c)
+  800869:	38 ca                	cmp    %cl,%dl
+  80086b:	75 f2                	jne    80085f <strchr+0xc>
+  80086d:	eb 05                	jmp    800874 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80086f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800874:	5d                   	pop    %ebp
+  800875:	c3                   	ret
+
+00800876 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800880:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800883:	38 ca                	cmp    %cl,%dl
+  800885:	74 09                	je     800890 <strfind+0x1a>
+  800887:	84 d2                	test   %dl,%dl
+  800889:	74 05                	je     800890 <strfind+0x1a>
+	for (; *s; s++)
+  80088b:	83 c0 01             	add    $0x1,%eax
+  80088e:	eb f0                	jmp    800880 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800890:	5d                   	pop    %ebp
+  800891:	c3                   	ret
+
+00800892 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800892:	55                   	push   %ebp
+  800893:	89 e5                	mov    %esp,%ebp
+  800895:	57                   	push   %edi
+  800896:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800899:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80089c:	85 c9                	test   %ecx,%ecx
+  80089e:	74 20                	je     8008c0 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008a0:	89 f8                	mov    %edi,%eax
+  8008a2:	09 c8                	or     %ecx,%eax
+  8008a4:	a8 03                	test   $0x3,%al
+  8008a6:	75 12                	jne    8008ba <memset+0x28>
+		c &= 0xFF;
+  8008a8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008ac:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008b2:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008b5:	fc                   	cld
+  8008b6:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008b8:	eb 06                	jmp    8008c0 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008bd:	fc                   	cld
+  8008be:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008c0:	89 f8                	mov    %edi,%eax
+  8008c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008c5:	c9                   	leave
+  8008c6:	c3                   	ret
+
+008008c7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008c7:	55                   	push   %ebp
+  8008c8:	89 e5                	mov    %esp,%ebp
+  8008ca:	57                   	push   %edi
+  8008cb:	56                   	push   %esi
+  8008cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008cf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008d2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008d5:	39 c6                	cmp    %eax,%esi
+  8008d7:	73 32                	jae    80090b <memmove+0x44>
+  8008d9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008dc:	39 d0                	cmp    %edx,%eax
+  8008de:	73 2b                	jae    80090b <memmove+0x44>
+		s += n;
+		d += n;
+  8008e0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008e3:	89 d6                	mov    %edx,%esi
+  8008e5:	09 fe                	or     %edi,%esi
+  8008e7:	09 ce                	or     %ecx,%esi
+  8008e9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008ef:	75 0e                	jne    8008ff <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008f1:	83 ef 04             	sub    $0x4,%edi
+  8008f4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008f7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008fa:	fd                   	std
+  8008fb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008fd:	eb 09                	jmp    800908 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008ff:	83 ef 01             	sub    $0x1,%edi
+  800902:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800905:	fd                   	std
+  800906:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800908:	fc                   	cld
+  800909:	eb 1a                	jmp    800925 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80090b:	89 f2                	mov    %esi,%edx
+  80090d:	09 c2                	or     %eax,%edx
+  80090f:	09 ca                	or     %ecx,%edx
+  800911:	f6 c2 03             	test   $0x3,%dl
+  800914:	75 0a                	jne    800920 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800916:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800919:	89 c7                	mov    %eax,%edi
+  80091b:	fc                   	cld
+  80091c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80091e:	eb 05                	jmp    800925 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800920:	89 c7                	mov    %eax,%edi
+  800922:	fc                   	cld
+  800923:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800925:	5e                   	pop    %esi
+  800926:	5f                   	pop    %edi
+  800927:	5d                   	pop    %ebp
+  800928:	c3                   	ret
+
+00800929 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800929:	55                   	push   %ebp
+  80092a:	89 e5                	mov    %esp,%ebp
+  80092c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80092f:	ff 75 10             	push   0x10(%ebp)
+  800932:	ff 75 0c             	push   0xc(%ebp)
+  800935:	ff 75 08             	push   0x8(%ebp)
+  800938:	e8 8a ff ff ff       	call   8008c7 <memmove>
+}
+  80093d:	c9                   	leave
+  80093e:	c3                   	ret
+
+0080093f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	56                   	push   %esi
+  800943:	53                   	push   %ebx
+  800944:	8b 45 08             	mov    0x8(%ebp),%eax
+  800947:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80094a:	89 c6                	mov    %eax,%esi
+  80094c:	03 75 10             	add    0x10(%ebp),%esi
+  80094f:	eb 06                	jmp    800957 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800951:	83 c0 01             	add    $0x1,%eax
+  800954:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800957:	39 f0                	cmp    %esi,%eax
+  800959:	74 14                	je     80096f <memcmp+0x30>
+		if (*s1 != *s2)
+  80095b:	0f b6 08             	movzbl (%eax),%ecx
+  80095e:	0f b6 1a             	movzbl (%edx),%ebx
+  800961:	38 d9                	cmp    %bl,%cl
+  800963:	74 ec                	je     800951 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800965:	0f b6 c1             	movzbl %cl,%eax
+  800968:	0f b6 db             	movzbl %bl,%ebx
+  80096b:	29 d8                	sub    %ebx,%eax
+  80096d:	eb 05                	jmp    800974 <memcmp+0x35>
+	}
+
+	return 0;
+  80096f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800974:	5b                   	pop    %ebx
+  800975:	5e                   	pop    %esi
+  800976:	5d                   	pop    %ebp
+  800977:	c3                   	ret
+
+00800978 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800978:	55                   	push   %ebp
+  800979:	89 e5                	mov    %esp,%ebp
+  80097b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800981:	89 c2                	mov    %eax,%edx
+  800983:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800986:	eb 03                	jmp    80098b <memfind+0x13>
+  800988:	83 c0 01             	add    $0x1,%eax
+  80098b:	39 d0                	cmp    %edx,%eax
+  80098d:	73 04                	jae    800993 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80098f:	38 08                	cmp    %cl,(%eax)
+  800991:	75 f5                	jne    800988 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800993:	5d                   	pop    %ebp
+  800994:	c3                   	ret
+
+00800995 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800995:	55                   	push   %ebp
+  800996:	89 e5                	mov    %esp,%ebp
+  800998:	57                   	push   %edi
+  800999:	56                   	push   %esi
+  80099a:	53                   	push   %ebx
+  80099b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80099e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009a1:	eb 03                	jmp    8009a6 <strtol+0x11>
+		s++;
+  8009a3:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009a6:	0f b6 02             	movzbl (%edx),%eax
+  8009a9:	3c 20                	cmp    $0x20,%al
+  8009ab:	74 f6                	je     8009a3 <strtol+0xe>
+  8009ad:	3c 09                	cmp    $0x9,%al
+  8009af:	74 f2                	je     8009a3 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009b1:	3c 2b                	cmp    $0x2b,%al
+  8009b3:	74 2a                	je     8009df <strtol+0x4a>
+	int neg = 0;
+  8009b5:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009ba:	3c 2d                	cmp    $0x2d,%al
+  8009bc:	74 2b                	je     8009e9 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009be:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009c4:	75 0f                	jne    8009d5 <strtol+0x40>
+  8009c6:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009c9:	74 28                	je     8009f3 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009cb:	85 db                	test   %ebx,%ebx
+  8009cd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009d2:	0f 44 d8             	cmove  %eax,%ebx
+  8009d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009da:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009dd:	eb 46                	jmp    800a25 <strtol+0x90>
+		s++;
+  8009df:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009e7:	eb d5                	jmp    8009be <strtol+0x29>
+		s++, neg = 1;
+  8009e9:	83 c2 01             	add    $0x1,%edx
+  8009ec:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009f1:	eb cb                	jmp    8009be <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009f3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009f7:	74 0e                	je     800a07 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009f9:	85 db                	test   %ebx,%ebx
+  8009fb:	75 d8                	jne    8009d5 <strtol+0x40>
+		s++, base = 8;
+  8009fd:	83 c2 01             	add    $0x1,%edx
+  800a00:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a05:	eb ce                	jmp    8009d5 <strtol+0x40>
+		s += 2, base = 16;
+  800a07:	83 c2 02             	add    $0x2,%edx
+  800a0a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a0f:	eb c4                	jmp    8009d5 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a11:	0f be c0             	movsbl %al,%eax
+  800a14:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a17:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a1a:	7d 3a                	jge    800a56 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a1c:	83 c2 01             	add    $0x1,%edx
+  800a1f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a23:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a25:	0f b6 02             	movzbl (%edx),%eax
+  800a28:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a2b:	89 f3                	mov    %esi,%ebx
+  800a2d:	80 fb 09             	cmp    $0x9,%bl
+  800a30:	76 df                	jbe    800a11 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a32:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a35:	89 f3                	mov    %esi,%ebx
+  800a37:	80 fb 19             	cmp    $0x19,%bl
+  800a3a:	77 08                	ja     800a44 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a3c:	0f be c0             	movsbl %al,%eax
+  800a3f:	83 e8 57             	sub    $0x57,%eax
+  800a42:	eb d3                	jmp    800a17 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a44:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a47:	89 f3                	mov    %esi,%ebx
+  800a49:	80 fb 19             	cmp    $0x19,%bl
+  800a4c:	77 08                	ja     800a56 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a4e:	0f be c0             	movsbl %al,%eax
+  800a51:	83 e8 37             	sub    $0x37,%eax
+  800a54:	eb c1                	jmp    800a17 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a56:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a5a:	74 05                	je     800a61 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a5f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a61:	89 c8                	mov    %ecx,%eax
+  800a63:	f7 d8                	neg    %eax
+  800a65:	85 ff                	test   %edi,%edi
+  800a67:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a6a:	89 c8                	mov    %ecx,%eax
+  800a6c:	5b                   	pop    %ebx
+  800a6d:	5e                   	pop    %esi
+  800a6e:	5f                   	pop    %edi
+  800a6f:	5d                   	pop    %ebp
+  800a70:	c3                   	ret
+
+00800a71 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a71:	55                   	push   %ebp
+  800a72:	89 e5                	mov    %esp,%ebp
+  800a74:	57                   	push   %edi
+  800a75:	56                   	push   %esi
+  800a76:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a82:	89 c3                	mov    %eax,%ebx
+  800a84:	89 c7                	mov    %eax,%edi
+  800a86:	89 c6                	mov    %eax,%esi
+  800a88:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800a8a:	5b                   	pop    %ebx
+  800a8b:	5e                   	pop    %esi
+  800a8c:	5f                   	pop    %edi
+  800a8d:	5d                   	pop    %ebp
+  800a8e:	c3                   	ret
+
+00800a8f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800a8f:	55                   	push   %ebp
+  800a90:	89 e5                	mov    %esp,%ebp
+  800a92:	57                   	push   %edi
+  800a93:	56                   	push   %esi
+  800a94:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a95:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a9f:	89 d1                	mov    %edx,%ecx
+  800aa1:	89 d3                	mov    %edx,%ebx
+  800aa3:	89 d7                	mov    %edx,%edi
+  800aa5:	89 d6                	mov    %edx,%esi
+  800aa7:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800aa9:	5b                   	pop    %ebx
+  800aaa:	5e                   	pop    %esi
+  800aab:	5f                   	pop    %edi
+  800aac:	5d                   	pop    %ebp
+  800aad:	c3                   	ret
+
+00800aae <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800aae:	55                   	push   %ebp
+  800aaf:	89 e5                	mov    %esp,%ebp
+  800ab1:	57                   	push   %edi
+  800ab2:	56                   	push   %esi
+  800ab3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ab4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800abc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ac1:	89 cb                	mov    %ecx,%ebx
+  800ac3:	89 cf                	mov    %ecx,%edi
+  800ac5:	89 ce                	mov    %ecx,%esi
+  800ac7:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800ac9:	5b                   	pop    %ebx
+  800aca:	5e                   	pop    %esi
+  800acb:	5f                   	pop    %edi
+  800acc:	5d                   	pop    %ebp
+  800acd:	c3                   	ret
+
+00800ace <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	57                   	push   %edi
+  800ad2:	56                   	push   %esi
+  800ad3:	53                   	push   %ebx
+  800ad4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ad7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800adc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800adf:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ae4:	89 cb                	mov    %ecx,%ebx
+  800ae6:	89 cf                	mov    %ecx,%edi
+  800ae8:	89 ce                	mov    %ecx,%esi
+  800aea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800aec:	85 c0                	test   %eax,%eax
+  800aee:	7f 08                	jg     800af8 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800af0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800af3:	5b                   	pop    %ebx
+  800af4:	5e                   	pop    %esi
+  800af5:	5f                   	pop    %edi
+  800af6:	5d                   	pop    %ebp
+  800af7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800af8:	83 ec 0c             	sub    $0xc,%esp
+  800afb:	50                   	push   %eax
+  800afc:	6a 03                	push   $0x3
+  800afe:	68 df 29 80 00       	push   $0x8029df
+  800b03:	6a 23                	push   $0x23
+  800b05:	68 fc 29 80 00       	push   $0x8029fc
+  800b0a:	e8 d5 15 00 00       	call   8020e4 <_panic>
+
+00800b0f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b0f:	55                   	push   %ebp
+  800b10:	89 e5                	mov    %esp,%ebp
+  800b12:	57                   	push   %edi
+  800b13:	56                   	push   %esi
+  800b14:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b1a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b1f:	89 d1                	mov    %edx,%ecx
+  800b21:	89 d3                	mov    %edx,%ebx
+  800b23:	89 d7                	mov    %edx,%edi
+  800b25:	89 d6                	mov    %edx,%esi
+  800b27:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b29:	5b                   	pop    %ebx
+  800b2a:	5e                   	pop    %esi
+  800b2b:	5f                   	pop    %edi
+  800b2c:	5d                   	pop    %ebp
+  800b2d:	c3                   	ret
+
+00800b2e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b2e:	55                   	push   %ebp
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	57                   	push   %edi
+  800b32:	56                   	push   %esi
+  800b33:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b39:	b8 16 00 00 00       	mov    $0x16,%eax
+  800b3e:	89 d1                	mov    %edx,%ecx
+  800b40:	89 d3                	mov    %edx,%ebx
+  800b42:	89 d7                	mov    %edx,%edi
+  800b44:	89 d6                	mov    %edx,%esi
+  800b46:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b48:	5b                   	pop    %ebx
+  800b49:	5e                   	pop    %esi
+  800b4a:	5f                   	pop    %edi
+  800b4b:	5d                   	pop    %ebp
+  800b4c:	c3                   	ret
+
+00800b4d <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	57                   	push   %edi
+  800b51:	56                   	push   %esi
+  800b52:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b58:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800b5d:	89 d1                	mov    %edx,%ecx
+  800b5f:	89 d3                	mov    %edx,%ebx
+  800b61:	89 d7                	mov    %edx,%edi
+  800b63:	89 d6                	mov    %edx,%esi
+  800b65:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800b67:	5b                   	pop    %ebx
+  800b68:	5e                   	pop    %esi
+  800b69:	5f                   	pop    %edi
+  800b6a:	5d                   	pop    %ebp
+  800b6b:	c3                   	ret
+
+00800b6c <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800b6c:	55                   	push   %ebp
+  800b6d:	89 e5                	mov    %esp,%ebp
+  800b6f:	57                   	push   %edi
+  800b70:	56                   	push   %esi
+  800b71:	53                   	push   %ebx
+  800b72:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b80:	b8 15 00 00 00       	mov    $0x15,%eax
+  800b85:	89 df                	mov    %ebx,%edi
+  800b87:	89 de                	mov    %ebx,%esi
+  800b89:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b8b:	85 c0                	test   %eax,%eax
+  800b8d:	7f 08                	jg     800b97 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800b8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b92:	5b                   	pop    %ebx
+  800b93:	5e                   	pop    %esi
+  800b94:	5f                   	pop    %edi
+  800b95:	5d                   	pop    %ebp
+  800b96:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b97:	83 ec 0c             	sub    $0xc,%esp
+  800b9a:	50                   	push   %eax
+  800b9b:	6a 15                	push   $0x15
+  800b9d:	68 df 29 80 00       	push   $0x8029df
+  800ba2:	6a 23                	push   $0x23
+  800ba4:	68 fc 29 80 00       	push   $0x8029fc
+  800ba9:	e8 36 15 00 00       	call   8020e4 <_panic>
+
+00800bae <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	57                   	push   %edi
+  800bb2:	56                   	push   %esi
+  800bb3:	53                   	push   %ebx
+  800bb4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bb7:	be 00 00 00 00       	mov    $0x0,%esi
+  800bbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bca:	89 f7                	mov    %esi,%edi
+  800bcc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bce:	85 c0                	test   %eax,%eax
+  800bd0:	7f 08                	jg     800bda <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd5:	5b                   	pop    %ebx
+  800bd6:	5e                   	pop    %esi
+  800bd7:	5f                   	pop    %edi
+  800bd8:	5d                   	pop    %ebp
+  800bd9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bda:	83 ec 0c             	sub    $0xc,%esp
+  800bdd:	50                   	push   %eax
+  800bde:	6a 05                	push   $0x5
+  800be0:	68 df 29 80 00       	push   $0x8029df
+  800be5:	6a 23                	push   $0x23
+  800be7:	68 fc 29 80 00       	push   $0x8029fc
+  800bec:	e8 f3 14 00 00       	call   8020e4 <_panic>
+
+00800bf1 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	57                   	push   %edi
+  800bf5:	56                   	push   %esi
+  800bf6:	53                   	push   %ebx
+  800bf7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bfa:	be 00 00 00 00       	mov    $0x0,%esi
+  800bff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c05:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c0d:	89 f7                	mov    %esi,%edi
+  800c0f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c11:	85 c0                	test   %eax,%eax
+  800c13:	7f 08                	jg     800c1d <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c18:	5b                   	pop    %ebx
+  800c19:	5e                   	pop    %esi
+  800c1a:	5f                   	pop    %edi
+  800c1b:	5d                   	pop    %ebp
+  800c1c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c1d:	83 ec 0c             	sub    $0xc,%esp
+  800c20:	50                   	push   %eax
+  800c21:	6a 06                	push   $0x6
+  800c23:	68 df 29 80 00       	push   $0x8029df
+  800c28:	6a 23                	push   $0x23
+  800c2a:	68 fc 29 80 00       	push   $0x8029fc
+  800c2f:	e8 b0 14 00 00       	call   8020e4 <_panic>
+
+00800c34 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	57                   	push   %edi
+  800c38:	56                   	push   %esi
+  800c39:	53                   	push   %ebx
+  800c3a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c43:	b8 07 00 00 00       	mov    $0x7,%eax
+  800c48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c4b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c4e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c51:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c53:	85 c0                	test   %eax,%eax
+  800c55:	7f 08                	jg     800c5f <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5a:	5b                   	pop    %ebx
+  800c5b:	5e                   	pop    %esi
+  800c5c:	5f                   	pop    %edi
+  800c5d:	5d                   	pop    %ebp
+  800c5e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c5f:	83 ec 0c             	sub    $0xc,%esp
+  800c62:	50                   	push   %eax
+  800c63:	6a 07                	push   $0x7
+  800c65:	68 df 29 80 00       	push   $0x8029df
+  800c6a:	6a 23                	push   $0x23
+  800c6c:	68 fc 29 80 00       	push   $0x8029fc
+  800c71:	e8 6e 14 00 00       	call   8020e4 <_panic>
+
+00800c76 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c76:	55                   	push   %ebp
+  800c77:	89 e5                	mov    %esp,%ebp
+  800c79:	57                   	push   %edi
+  800c7a:	56                   	push   %esi
+  800c7b:	53                   	push   %ebx
+  800c7c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c8f:	89 df                	mov    %ebx,%edi
+  800c91:	89 de                	mov    %ebx,%esi
+  800c93:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c95:	85 c0                	test   %eax,%eax
+  800c97:	7f 08                	jg     800ca1 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9c:	5b                   	pop    %ebx
+  800c9d:	5e                   	pop    %esi
+  800c9e:	5f                   	pop    %edi
+  800c9f:	5d                   	pop    %ebp
+  800ca0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca1:	83 ec 0c             	sub    $0xc,%esp
+  800ca4:	50                   	push   %eax
+  800ca5:	6a 08                	push   $0x8
+  800ca7:	68 df 29 80 00       	push   $0x8029df
+  800cac:	6a 23                	push   $0x23
+  800cae:	68 fc 29 80 00       	push   $0x8029fc
+  800cb3:	e8 2c 14 00 00       	call   8020e4 <_panic>
+
+00800cb8 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	57                   	push   %edi
+  800cbc:	56                   	push   %esi
+  800cbd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc4:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cc9:	be 00 00 00 00       	mov    $0x0,%esi
+  800cce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cd1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cd4:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800cd6:	5b                   	pop    %ebx
+  800cd7:	5e                   	pop    %esi
+  800cd8:	5f                   	pop    %edi
+  800cd9:	5d                   	pop    %ebp
+  800cda:	c3                   	ret
+
+00800cdb <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800cdb:	55                   	push   %ebp
+  800cdc:	89 e5                	mov    %esp,%ebp
+  800cde:	57                   	push   %edi
+  800cdf:	56                   	push   %esi
+  800ce0:	53                   	push   %ebx
+  800ce1:	8b 45 18             	mov    0x18(%ebp),%eax
+  800ce4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800ce7:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800cec:	77 27                	ja     800d15 <sys_page_map_range+0x3a>
+  800cee:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800cf4:	77 1f                	ja     800d15 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800cf6:	c1 e0 0c             	shl    $0xc,%eax
+  800cf9:	89 c6                	mov    %eax,%esi
+  800cfb:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800cfd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d03:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d0b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d0e:	cd 30                	int    $0x30
+}
+  800d10:	5b                   	pop    %ebx
+  800d11:	5e                   	pop    %esi
+  800d12:	5f                   	pop    %edi
+  800d13:	5d                   	pop    %ebp
+  800d14:	c3                   	ret
+		return -E_INVAL;
+  800d15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d1a:	eb f4                	jmp    800d10 <sys_page_map_range+0x35>
+
+00800d1c <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800d1c:	55                   	push   %ebp
+  800d1d:	89 e5                	mov    %esp,%ebp
+  800d1f:	57                   	push   %edi
+  800d20:	56                   	push   %esi
+  800d21:	53                   	push   %ebx
+  800d22:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d30:	be 00 00 00 00       	mov    $0x0,%esi
+  800d35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d38:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d3b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d3d:	85 c0                	test   %eax,%eax
+  800d3f:	7f 08                	jg     800d49 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800d41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d44:	5b                   	pop    %ebx
+  800d45:	5e                   	pop    %esi
+  800d46:	5f                   	pop    %edi
+  800d47:	5d                   	pop    %ebp
+  800d48:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d49:	83 ec 0c             	sub    $0xc,%esp
+  800d4c:	50                   	push   %eax
+  800d4d:	6a 0c                	push   $0xc
+  800d4f:	68 df 29 80 00       	push   $0x8029df
+  800d54:	6a 23                	push   $0x23
+  800d56:	68 fc 29 80 00       	push   $0x8029fc
+  800d5b:	e8 84 13 00 00       	call   8020e4 <_panic>
+
+00800d60 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800d60:	55                   	push   %ebp
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	57                   	push   %edi
+  800d64:	56                   	push   %esi
+  800d65:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d66:	be 00 00 00 00       	mov    $0x0,%esi
+  800d6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d71:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d79:	89 f7                	mov    %esi,%edi
+  800d7b:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800d7d:	5b                   	pop    %ebx
+  800d7e:	5e                   	pop    %esi
+  800d7f:	5f                   	pop    %edi
+  800d80:	5d                   	pop    %ebp
+  800d81:	c3                   	ret
+
+00800d82 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d82:	55                   	push   %ebp
+  800d83:	89 e5                	mov    %esp,%ebp
+  800d85:	57                   	push   %edi
+  800d86:	56                   	push   %esi
+  800d87:	53                   	push   %ebx
+  800d88:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d96:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d9b:	89 df                	mov    %ebx,%edi
+  800d9d:	89 de                	mov    %ebx,%esi
+  800d9f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da1:	85 c0                	test   %eax,%eax
+  800da3:	7f 08                	jg     800dad <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800da5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da8:	5b                   	pop    %ebx
+  800da9:	5e                   	pop    %esi
+  800daa:	5f                   	pop    %edi
+  800dab:	5d                   	pop    %ebp
+  800dac:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dad:	83 ec 0c             	sub    $0xc,%esp
+  800db0:	50                   	push   %eax
+  800db1:	6a 0f                	push   $0xf
+  800db3:	68 df 29 80 00       	push   $0x8029df
+  800db8:	6a 23                	push   $0x23
+  800dba:	68 fc 29 80 00       	push   $0x8029fc
+  800dbf:	e8 20 13 00 00       	call   8020e4 <_panic>
+
+00800dc4 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+  800dca:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd8:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ddd:	89 df                	mov    %ebx,%edi
+  800ddf:	89 de                	mov    %ebx,%esi
+  800de1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de3:	85 c0                	test   %eax,%eax
+  800de5:	7f 08                	jg     800def <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800de7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dea:	5b                   	pop    %ebx
+  800deb:	5e                   	pop    %esi
+  800dec:	5f                   	pop    %edi
+  800ded:	5d                   	pop    %ebp
+  800dee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800def:	83 ec 0c             	sub    $0xc,%esp
+  800df2:	50                   	push   %eax
+  800df3:	6a 10                	push   $0x10
+  800df5:	68 df 29 80 00       	push   $0x8029df
+  800dfa:	6a 23                	push   $0x23
+  800dfc:	68 fc 29 80 00       	push   $0x8029fc
+  800e01:	e8 de 12 00 00       	call   8020e4 <_panic>
+
+00800e06 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800e06:	55                   	push   %ebp
+  800e07:	89 e5                	mov    %esp,%ebp
+  800e09:	57                   	push   %edi
+  800e0a:	56                   	push   %esi
+  800e0b:	53                   	push   %ebx
+  800e0c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e1f:	89 df                	mov    %ebx,%edi
+  800e21:	89 de                	mov    %ebx,%esi
+  800e23:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e25:	85 c0                	test   %eax,%eax
+  800e27:	7f 08                	jg     800e31 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800e29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2c:	5b                   	pop    %ebx
+  800e2d:	5e                   	pop    %esi
+  800e2e:	5f                   	pop    %edi
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e31:	83 ec 0c             	sub    $0xc,%esp
+  800e34:	50                   	push   %eax
+  800e35:	6a 11                	push   $0x11
+  800e37:	68 df 29 80 00       	push   $0x8029df
+  800e3c:	6a 23                	push   $0x23
+  800e3e:	68 fc 29 80 00       	push   $0x8029fc
+  800e43:	e8 9c 12 00 00       	call   8020e4 <_panic>
+
+00800e48 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800e48:	55                   	push   %ebp
+  800e49:	89 e5                	mov    %esp,%ebp
+  800e4b:	57                   	push   %edi
+  800e4c:	56                   	push   %esi
+  800e4d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e53:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e58:	89 d1                	mov    %edx,%ecx
+  800e5a:	89 d3                	mov    %edx,%ebx
+  800e5c:	89 d7                	mov    %edx,%edi
+  800e5e:	89 d6                	mov    %edx,%esi
+  800e60:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800e62:	5b                   	pop    %ebx
+  800e63:	5e                   	pop    %esi
+  800e64:	5f                   	pop    %edi
+  800e65:	5d                   	pop    %ebp
+  800e66:	c3                   	ret
+
+00800e67 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	57                   	push   %edi
+  800e6b:	56                   	push   %esi
+  800e6c:	53                   	push   %ebx
+  800e6d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7b:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e80:	89 df                	mov    %ebx,%edi
+  800e82:	89 de                	mov    %ebx,%esi
+  800e84:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e86:	85 c0                	test   %eax,%eax
+  800e88:	7f 08                	jg     800e92 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8d:	5b                   	pop    %ebx
+  800e8e:	5e                   	pop    %esi
+  800e8f:	5f                   	pop    %edi
+  800e90:	5d                   	pop    %ebp
+  800e91:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e92:	83 ec 0c             	sub    $0xc,%esp
+  800e95:	50                   	push   %eax
+  800e96:	6a 13                	push   $0x13
+  800e98:	68 df 29 80 00       	push   $0x8029df
+  800e9d:	6a 23                	push   $0x23
+  800e9f:	68 fc 29 80 00       	push   $0x8029fc
+  800ea4:	e8 3b 12 00 00       	call   8020e4 <_panic>
+
+00800ea9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ea9:	55                   	push   %ebp
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	57                   	push   %edi
+  800ead:	56                   	push   %esi
+  800eae:	53                   	push   %ebx
+  800eaf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebd:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ec2:	89 df                	mov    %ebx,%edi
+  800ec4:	89 de                	mov    %ebx,%esi
+  800ec6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec8:	85 c0                	test   %eax,%eax
+  800eca:	7f 08                	jg     800ed4 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ecc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5f                   	pop    %edi
+  800ed2:	5d                   	pop    %ebp
+  800ed3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+  800ed7:	50                   	push   %eax
+  800ed8:	6a 14                	push   $0x14
+  800eda:	68 df 29 80 00       	push   $0x8029df
+  800edf:	6a 23                	push   $0x23
+  800ee1:	68 fc 29 80 00       	push   $0x8029fc
+  800ee6:	e8 f9 11 00 00       	call   8020e4 <_panic>
+
+00800eeb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	57                   	push   %edi
+  800eef:	56                   	push   %esi
+  800ef0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef7:	b8 17 00 00 00       	mov    $0x17,%eax
+  800efc:	be 00 00 00 00       	mov    $0x0,%esi
+  800f01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f04:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f07:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f09:	5b                   	pop    %ebx
+  800f0a:	5e                   	pop    %esi
+  800f0b:	5f                   	pop    %edi
+  800f0c:	5d                   	pop    %ebp
+  800f0d:	c3                   	ret
+
+00800f0e <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f0e:	55                   	push   %ebp
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	57                   	push   %edi
+  800f12:	56                   	push   %esi
+  800f13:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1a:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f1f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f27:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f2a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f2c:	5b                   	pop    %ebx
+  800f2d:	5e                   	pop    %esi
+  800f2e:	5f                   	pop    %edi
+  800f2f:	5d                   	pop    %ebp
+  800f30:	c3                   	ret
+
+00800f31 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f31:	55                   	push   %ebp
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	57                   	push   %edi
+  800f35:	56                   	push   %esi
+  800f36:	53                   	push   %ebx
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f42:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f47:	89 cb                	mov    %ecx,%ebx
+  800f49:	89 cf                	mov    %ecx,%edi
+  800f4b:	89 ce                	mov    %ecx,%esi
+  800f4d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4f:	85 c0                	test   %eax,%eax
+  800f51:	7f 08                	jg     800f5b <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f56:	5b                   	pop    %ebx
+  800f57:	5e                   	pop    %esi
+  800f58:	5f                   	pop    %edi
+  800f59:	5d                   	pop    %ebp
+  800f5a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5b:	83 ec 0c             	sub    $0xc,%esp
+  800f5e:	50                   	push   %eax
+  800f5f:	6a 19                	push   $0x19
+  800f61:	68 df 29 80 00       	push   $0x8029df
+  800f66:	6a 23                	push   $0x23
+  800f68:	68 fc 29 80 00       	push   $0x8029fc
+  800f6d:	e8 72 11 00 00       	call   8020e4 <_panic>
+
+00800f72 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f72:	55                   	push   %ebp
+  800f73:	89 e5                	mov    %esp,%ebp
+  800f75:	57                   	push   %edi
+  800f76:	56                   	push   %esi
+  800f77:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f82:	89 d1                	mov    %edx,%ecx
+  800f84:	89 d3                	mov    %edx,%ebx
+  800f86:	89 d7                	mov    %edx,%edi
+  800f88:	89 d6                	mov    %edx,%esi
+  800f8a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f8c:	5b                   	pop    %ebx
+  800f8d:	5e                   	pop    %esi
+  800f8e:	5f                   	pop    %edi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	c3                   	ret
+
+00800f91 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  800f91:	55                   	push   %ebp
+  800f92:	89 e5                	mov    %esp,%ebp
+  800f94:	57                   	push   %edi
+  800f95:	56                   	push   %esi
+  800f96:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fa7:	89 df                	mov    %ebx,%edi
+  800fa9:	89 de                	mov    %ebx,%esi
+  800fab:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  800fad:	5b                   	pop    %ebx
+  800fae:	5e                   	pop    %esi
+  800faf:	5f                   	pop    %edi
+  800fb0:	5d                   	pop    %ebp
+  800fb1:	c3                   	ret
+
+00800fb2 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	57                   	push   %edi
+  800fb6:	56                   	push   %esi
+  800fb7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800fc8:	89 df                	mov    %ebx,%edi
+  800fca:	89 de                	mov    %ebx,%esi
+  800fcc:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  800fce:	5b                   	pop    %ebx
+  800fcf:	5e                   	pop    %esi
+  800fd0:	5f                   	pop    %edi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+
+00800fd3 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fd9:	05 00 00 00 30       	add    $0x30000000,%eax
+  800fde:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+
+00800fe3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800fe3:	55                   	push   %ebp
+  800fe4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fe6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe9:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800fee:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ff3:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800ff8:	5d                   	pop    %ebp
+  800ff9:	c3                   	ret
+
+00800ffa <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800ffd:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801002:	eb 02                	jmp    801006 <fd_alloc+0xc>
+  801004:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801006:	89 c2                	mov    %eax,%edx
+  801008:	c1 ea 16             	shr    $0x16,%edx
+  80100b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801012:	f6 c2 01             	test   $0x1,%dl
+  801015:	74 2b                	je     801042 <fd_alloc+0x48>
+  801017:	89 c2                	mov    %eax,%edx
+  801019:	c1 ea 0c             	shr    $0xc,%edx
+  80101c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801023:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801029:	f6 c1 01             	test   $0x1,%cl
+  80102c:	74 14                	je     801042 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80102e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801034:	75 ce                	jne    801004 <fd_alloc+0xa>
+  801036:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80103b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801040:	eb 05                	jmp    801047 <fd_alloc+0x4d>
+			return 0;
+  801042:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801047:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104a:	89 02                	mov    %eax,(%edx)
+}
+  80104c:	89 c8                	mov    %ecx,%eax
+  80104e:	5d                   	pop    %ebp
+  80104f:	c3                   	ret
+
+00801050 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801050:	55                   	push   %ebp
+  801051:	89 e5                	mov    %esp,%ebp
+  801053:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801056:	83 f8 1f             	cmp    $0x1f,%eax
+  801059:	77 30                	ja     80108b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80105b:	c1 e0 0c             	shl    $0xc,%eax
+  80105e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801063:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801069:	f6 c2 01             	test   $0x1,%dl
+  80106c:	74 24                	je     801092 <fd_lookup+0x42>
+  80106e:	89 c2                	mov    %eax,%edx
+  801070:	c1 ea 0c             	shr    $0xc,%edx
+  801073:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80107a:	f6 c2 01             	test   $0x1,%dl
+  80107d:	74 1a                	je     801099 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80107f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801082:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801084:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801089:	5d                   	pop    %ebp
+  80108a:	c3                   	ret
+		return -E_INVAL;
+  80108b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801090:	eb f7                	jmp    801089 <fd_lookup+0x39>
+		return -E_INVAL;
+  801092:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801097:	eb f0                	jmp    801089 <fd_lookup+0x39>
+  801099:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80109e:	eb e9                	jmp    801089 <fd_lookup+0x39>
+
+008010a0 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	53                   	push   %ebx
+  8010a4:	83 ec 04             	sub    $0x4,%esp
+  8010a7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8010aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010af:	eb 03                	jmp    8010b4 <dev_lookup+0x14>
+  8010b1:	83 c0 01             	add    $0x1,%eax
+  8010b4:	8b 1c 85 88 2a 80 00 	mov    0x802a88(,%eax,4),%ebx
+  8010bb:	85 db                	test   %ebx,%ebx
+  8010bd:	74 0b                	je     8010ca <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8010bf:	39 13                	cmp    %edx,(%ebx)
+  8010c1:	75 ee                	jne    8010b1 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8010c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c8:	eb 1f                	jmp    8010e9 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8010ca:	a1 08 40 80 00       	mov    0x804008,%eax
+  8010cf:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8010d2:	83 ec 04             	sub    $0x4,%esp
+  8010d5:	52                   	push   %edx
+  8010d6:	50                   	push   %eax
+  8010d7:	68 0c 2a 80 00       	push   $0x802a0c
+  8010dc:	e8 72 f0 ff ff       	call   800153 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8010e1:	83 c4 10             	add    $0x10,%esp
+  8010e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8010e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010ec:	89 1a                	mov    %ebx,(%edx)
+}
+  8010ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f1:	c9                   	leave
+  8010f2:	c3                   	ret
+
+008010f3 <fd_close>:
+{
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	57                   	push   %edi
+  8010f7:	56                   	push   %esi
+  8010f8:	53                   	push   %ebx
+  8010f9:	83 ec 24             	sub    $0x24,%esp
+  8010fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010ff:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801102:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801105:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801106:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80110c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80110f:	50                   	push   %eax
+  801110:	e8 3b ff ff ff       	call   801050 <fd_lookup>
+  801115:	89 c3                	mov    %eax,%ebx
+  801117:	83 c4 10             	add    $0x10,%esp
+  80111a:	85 c0                	test   %eax,%eax
+  80111c:	78 05                	js     801123 <fd_close+0x30>
+	    || fd != fd2)
+  80111e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801121:	74 16                	je     801139 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801123:	89 f8                	mov    %edi,%eax
+  801125:	84 c0                	test   %al,%al
+  801127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80112f:	89 d8                	mov    %ebx,%eax
+  801131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801134:	5b                   	pop    %ebx
+  801135:	5e                   	pop    %esi
+  801136:	5f                   	pop    %edi
+  801137:	5d                   	pop    %ebp
+  801138:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801139:	83 ec 08             	sub    $0x8,%esp
+  80113c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80113f:	50                   	push   %eax
+  801140:	ff 36                	push   (%esi)
+  801142:	e8 59 ff ff ff       	call   8010a0 <dev_lookup>
+  801147:	89 c3                	mov    %eax,%ebx
+  801149:	83 c4 10             	add    $0x10,%esp
+  80114c:	85 c0                	test   %eax,%eax
+  80114e:	78 1a                	js     80116a <fd_close+0x77>
+		if (dev->dev_close)
+  801150:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801153:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801156:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80115b:	85 c0                	test   %eax,%eax
+  80115d:	74 0b                	je     80116a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80115f:	83 ec 0c             	sub    $0xc,%esp
+  801162:	56                   	push   %esi
+  801163:	ff d0                	call   *%eax
+  801165:	89 c3                	mov    %eax,%ebx
+  801167:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80116a:	83 ec 08             	sub    $0x8,%esp
+  80116d:	56                   	push   %esi
+  80116e:	6a 00                	push   $0x0
+  801170:	e8 01 fb ff ff       	call   800c76 <sys_page_unmap>
+	return r;
+  801175:	83 c4 10             	add    $0x10,%esp
+  801178:	eb b5                	jmp    80112f <fd_close+0x3c>
+
+0080117a <close>:
+
+int
+close(int fdnum)
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801180:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801183:	50                   	push   %eax
+  801184:	ff 75 08             	push   0x8(%ebp)
+  801187:	e8 c4 fe ff ff       	call   801050 <fd_lookup>
+  80118c:	83 c4 10             	add    $0x10,%esp
+  80118f:	85 c0                	test   %eax,%eax
+  801191:	79 02                	jns    801195 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801193:	c9                   	leave
+  801194:	c3                   	ret
+		return fd_close(fd, 1);
+  801195:	83 ec 08             	sub    $0x8,%esp
+  801198:	6a 01                	push   $0x1
+  80119a:	ff 75 f4             	push   -0xc(%ebp)
+  80119d:	e8 51 ff ff ff       	call   8010f3 <fd_close>
+  8011a2:	83 c4 10             	add    $0x10,%esp
+  8011a5:	eb ec                	jmp    801193 <close+0x19>
+
+008011a7 <close_all>:
+
+void
+close_all(void)
+{
+  8011a7:	55                   	push   %ebp
+  8011a8:	89 e5                	mov    %esp,%ebp
+  8011aa:	53                   	push   %ebx
+  8011ab:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8011ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8011b3:	83 ec 0c             	sub    $0xc,%esp
+  8011b6:	53                   	push   %ebx
+  8011b7:	e8 be ff ff ff       	call   80117a <close>
+	for (i = 0; i < MAXFD; i++)
+  8011bc:	83 c3 01             	add    $0x1,%ebx
+  8011bf:	83 c4 10             	add    $0x10,%esp
+  8011c2:	83 fb 20             	cmp    $0x20,%ebx
+  8011c5:	75 ec                	jne    8011b3 <close_all+0xc>
+}
+  8011c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011ca:	c9                   	leave
+  8011cb:	c3                   	ret
+
+008011cc <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8011cc:	55                   	push   %ebp
+  8011cd:	89 e5                	mov    %esp,%ebp
+  8011cf:	57                   	push   %edi
+  8011d0:	56                   	push   %esi
+  8011d1:	53                   	push   %ebx
+  8011d2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8011d5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011d8:	50                   	push   %eax
+  8011d9:	ff 75 08             	push   0x8(%ebp)
+  8011dc:	e8 6f fe ff ff       	call   801050 <fd_lookup>
+  8011e1:	89 c3                	mov    %eax,%ebx
+  8011e3:	83 c4 10             	add    $0x10,%esp
+  8011e6:	85 c0                	test   %eax,%eax
+  8011e8:	78 7f                	js     801269 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8011ea:	83 ec 0c             	sub    $0xc,%esp
+  8011ed:	ff 75 0c             	push   0xc(%ebp)
+  8011f0:	e8 85 ff ff ff       	call   80117a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8011f5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8011f8:	c1 e6 0c             	shl    $0xc,%esi
+  8011fb:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801201:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801204:	89 3c 24             	mov    %edi,(%esp)
+  801207:	e8 d7 fd ff ff       	call   800fe3 <fd2data>
+  80120c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80120e:	89 34 24             	mov    %esi,(%esp)
+  801211:	e8 cd fd ff ff       	call   800fe3 <fd2data>
+  801216:	83 c4 10             	add    $0x10,%esp
+  801219:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80121c:	89 d8                	mov    %ebx,%eax
+  80121e:	c1 e8 16             	shr    $0x16,%eax
+  801221:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801228:	a8 01                	test   $0x1,%al
+  80122a:	74 11                	je     80123d <dup+0x71>
+  80122c:	89 d8                	mov    %ebx,%eax
+  80122e:	c1 e8 0c             	shr    $0xc,%eax
+  801231:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801238:	f6 c2 01             	test   $0x1,%dl
+  80123b:	75 36                	jne    801273 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80123d:	89 f8                	mov    %edi,%eax
+  80123f:	c1 e8 0c             	shr    $0xc,%eax
+  801242:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801249:	83 ec 0c             	sub    $0xc,%esp
+  80124c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801251:	50                   	push   %eax
+  801252:	56                   	push   %esi
+  801253:	6a 00                	push   $0x0
+  801255:	57                   	push   %edi
+  801256:	6a 00                	push   $0x0
+  801258:	e8 d7 f9 ff ff       	call   800c34 <sys_page_map>
+  80125d:	89 c3                	mov    %eax,%ebx
+  80125f:	83 c4 20             	add    $0x20,%esp
+  801262:	85 c0                	test   %eax,%eax
+  801264:	78 33                	js     801299 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801266:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801269:	89 d8                	mov    %ebx,%eax
+  80126b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126e:	5b                   	pop    %ebx
+  80126f:	5e                   	pop    %esi
+  801270:	5f                   	pop    %edi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801273:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80127a:	83 ec 0c             	sub    $0xc,%esp
+  80127d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801282:	50                   	push   %eax
+  801283:	ff 75 d4             	push   -0x2c(%ebp)
+  801286:	6a 00                	push   $0x0
+  801288:	53                   	push   %ebx
+  801289:	6a 00                	push   $0x0
+  80128b:	e8 a4 f9 ff ff       	call   800c34 <sys_page_map>
+  801290:	89 c3                	mov    %eax,%ebx
+  801292:	83 c4 20             	add    $0x20,%esp
+  801295:	85 c0                	test   %eax,%eax
+  801297:	79 a4                	jns    80123d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801299:	83 ec 08             	sub    $0x8,%esp
+  80129c:	56                   	push   %esi
+  80129d:	6a 00                	push   $0x0
+  80129f:	e8 d2 f9 ff ff       	call   800c76 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8012a4:	83 c4 08             	add    $0x8,%esp
+  8012a7:	ff 75 d4             	push   -0x2c(%ebp)
+  8012aa:	6a 00                	push   $0x0
+  8012ac:	e8 c5 f9 ff ff       	call   800c76 <sys_page_unmap>
+	return r;
+  8012b1:	83 c4 10             	add    $0x10,%esp
+  8012b4:	eb b3                	jmp    801269 <dup+0x9d>
+
+008012b6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8012b6:	55                   	push   %ebp
+  8012b7:	89 e5                	mov    %esp,%ebp
+  8012b9:	56                   	push   %esi
+  8012ba:	53                   	push   %ebx
+  8012bb:	83 ec 18             	sub    $0x18,%esp
+  8012be:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012c1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012c4:	50                   	push   %eax
+  8012c5:	56                   	push   %esi
+  8012c6:	e8 85 fd ff ff       	call   801050 <fd_lookup>
+  8012cb:	83 c4 10             	add    $0x10,%esp
+  8012ce:	85 c0                	test   %eax,%eax
+  8012d0:	78 3c                	js     80130e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012d2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8012d5:	83 ec 08             	sub    $0x8,%esp
+  8012d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012db:	50                   	push   %eax
+  8012dc:	ff 33                	push   (%ebx)
+  8012de:	e8 bd fd ff ff       	call   8010a0 <dev_lookup>
+  8012e3:	83 c4 10             	add    $0x10,%esp
+  8012e6:	85 c0                	test   %eax,%eax
+  8012e8:	78 24                	js     80130e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8012ea:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012ed:	83 e0 03             	and    $0x3,%eax
+  8012f0:	83 f8 01             	cmp    $0x1,%eax
+  8012f3:	74 20                	je     801315 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8012f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012f8:	8b 40 08             	mov    0x8(%eax),%eax
+  8012fb:	85 c0                	test   %eax,%eax
+  8012fd:	74 37                	je     801336 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8012ff:	83 ec 04             	sub    $0x4,%esp
+  801302:	ff 75 10             	push   0x10(%ebp)
+  801305:	ff 75 0c             	push   0xc(%ebp)
+  801308:	53                   	push   %ebx
+  801309:	ff d0                	call   *%eax
+  80130b:	83 c4 10             	add    $0x10,%esp
+}
+  80130e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801311:	5b                   	pop    %ebx
+  801312:	5e                   	pop    %esi
+  801313:	5d                   	pop    %ebp
+  801314:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801315:	a1 08 40 80 00       	mov    0x804008,%eax
+  80131a:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80131d:	83 ec 04             	sub    $0x4,%esp
+  801320:	56                   	push   %esi
+  801321:	50                   	push   %eax
+  801322:	68 4d 2a 80 00       	push   $0x802a4d
+  801327:	e8 27 ee ff ff       	call   800153 <cprintf>
+		return -E_INVAL;
+  80132c:	83 c4 10             	add    $0x10,%esp
+  80132f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801334:	eb d8                	jmp    80130e <read+0x58>
+		return -E_NOT_SUPP;
+  801336:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80133b:	eb d1                	jmp    80130e <read+0x58>
+
+0080133d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80133d:	55                   	push   %ebp
+  80133e:	89 e5                	mov    %esp,%ebp
+  801340:	57                   	push   %edi
+  801341:	56                   	push   %esi
+  801342:	53                   	push   %ebx
+  801343:	83 ec 0c             	sub    $0xc,%esp
+  801346:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801349:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80134c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801351:	eb 02                	jmp    801355 <readn+0x18>
+  801353:	01 c3                	add    %eax,%ebx
+  801355:	39 f3                	cmp    %esi,%ebx
+  801357:	73 21                	jae    80137a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801359:	83 ec 04             	sub    $0x4,%esp
+  80135c:	89 f0                	mov    %esi,%eax
+  80135e:	29 d8                	sub    %ebx,%eax
+  801360:	50                   	push   %eax
+  801361:	89 d8                	mov    %ebx,%eax
+  801363:	03 45 0c             	add    0xc(%ebp),%eax
+  801366:	50                   	push   %eax
+  801367:	57                   	push   %edi
+  801368:	e8 49 ff ff ff       	call   8012b6 <read>
+		if (m < 0)
+  80136d:	83 c4 10             	add    $0x10,%esp
+  801370:	85 c0                	test   %eax,%eax
+  801372:	78 04                	js     801378 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801374:	75 dd                	jne    801353 <readn+0x16>
+  801376:	eb 02                	jmp    80137a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801378:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80137a:	89 d8                	mov    %ebx,%eax
+  80137c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137f:	5b                   	pop    %ebx
+  801380:	5e                   	pop    %esi
+  801381:	5f                   	pop    %edi
+  801382:	5d                   	pop    %ebp
+  801383:	c3                   	ret
+
+00801384 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801384:	55                   	push   %ebp
+  801385:	89 e5                	mov    %esp,%ebp
+  801387:	56                   	push   %esi
+  801388:	53                   	push   %ebx
+  801389:	83 ec 18             	sub    $0x18,%esp
+  80138c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80138f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801392:	50                   	push   %eax
+  801393:	53                   	push   %ebx
+  801394:	e8 b7 fc ff ff       	call   801050 <fd_lookup>
+  801399:	83 c4 10             	add    $0x10,%esp
+  80139c:	85 c0                	test   %eax,%eax
+  80139e:	78 37                	js     8013d7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013a0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013a3:	83 ec 08             	sub    $0x8,%esp
+  8013a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013a9:	50                   	push   %eax
+  8013aa:	ff 36                	push   (%esi)
+  8013ac:	e8 ef fc ff ff       	call   8010a0 <dev_lookup>
+  8013b1:	83 c4 10             	add    $0x10,%esp
+  8013b4:	85 c0                	test   %eax,%eax
+  8013b6:	78 1f                	js     8013d7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013b8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013bc:	74 20                	je     8013de <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8013be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013c1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013c4:	85 c0                	test   %eax,%eax
+  8013c6:	74 37                	je     8013ff <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8013c8:	83 ec 04             	sub    $0x4,%esp
+  8013cb:	ff 75 10             	push   0x10(%ebp)
+  8013ce:	ff 75 0c             	push   0xc(%ebp)
+  8013d1:	56                   	push   %esi
+  8013d2:	ff d0                	call   *%eax
+  8013d4:	83 c4 10             	add    $0x10,%esp
+}
+  8013d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013da:	5b                   	pop    %ebx
+  8013db:	5e                   	pop    %esi
+  8013dc:	5d                   	pop    %ebp
+  8013dd:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013de:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013e3:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8013e6:	83 ec 04             	sub    $0x4,%esp
+  8013e9:	53                   	push   %ebx
+  8013ea:	50                   	push   %eax
+  8013eb:	68 69 2a 80 00       	push   $0x802a69
+  8013f0:	e8 5e ed ff ff       	call   800153 <cprintf>
+		return -E_INVAL;
+  8013f5:	83 c4 10             	add    $0x10,%esp
+  8013f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013fd:	eb d8                	jmp    8013d7 <write+0x53>
+		return -E_NOT_SUPP;
+  8013ff:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801404:	eb d1                	jmp    8013d7 <write+0x53>
+
+00801406 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801406:	55                   	push   %ebp
+  801407:	89 e5                	mov    %esp,%ebp
+  801409:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80140c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80140f:	50                   	push   %eax
+  801410:	ff 75 08             	push   0x8(%ebp)
+  801413:	e8 38 fc ff ff       	call   801050 <fd_lookup>
+  801418:	83 c4 10             	add    $0x10,%esp
+  80141b:	85 c0                	test   %eax,%eax
+  80141d:	78 0e                	js     80142d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80141f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801422:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801425:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801428:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80142d:	c9                   	leave
+  80142e:	c3                   	ret
+
+0080142f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80142f:	55                   	push   %ebp
+  801430:	89 e5                	mov    %esp,%ebp
+  801432:	56                   	push   %esi
+  801433:	53                   	push   %ebx
+  801434:	83 ec 18             	sub    $0x18,%esp
+  801437:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80143a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80143d:	50                   	push   %eax
+  80143e:	53                   	push   %ebx
+  80143f:	e8 0c fc ff ff       	call   801050 <fd_lookup>
+  801444:	83 c4 10             	add    $0x10,%esp
+  801447:	85 c0                	test   %eax,%eax
+  801449:	78 34                	js     80147f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80144b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80144e:	83 ec 08             	sub    $0x8,%esp
+  801451:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801454:	50                   	push   %eax
+  801455:	ff 36                	push   (%esi)
+  801457:	e8 44 fc ff ff       	call   8010a0 <dev_lookup>
+  80145c:	83 c4 10             	add    $0x10,%esp
+  80145f:	85 c0                	test   %eax,%eax
+  801461:	78 1c                	js     80147f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801463:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801467:	74 1d                	je     801486 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801469:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80146c:	8b 40 18             	mov    0x18(%eax),%eax
+  80146f:	85 c0                	test   %eax,%eax
+  801471:	74 34                	je     8014a7 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801473:	83 ec 08             	sub    $0x8,%esp
+  801476:	ff 75 0c             	push   0xc(%ebp)
+  801479:	56                   	push   %esi
+  80147a:	ff d0                	call   *%eax
+  80147c:	83 c4 10             	add    $0x10,%esp
+}
+  80147f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801482:	5b                   	pop    %ebx
+  801483:	5e                   	pop    %esi
+  801484:	5d                   	pop    %ebp
+  801485:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801486:	a1 08 40 80 00       	mov    0x804008,%eax
+  80148b:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80148e:	83 ec 04             	sub    $0x4,%esp
+  801491:	53                   	push   %ebx
+  801492:	50                   	push   %eax
+  801493:	68 2c 2a 80 00       	push   $0x802a2c
+  801498:	e8 b6 ec ff ff       	call   800153 <cprintf>
+		return -E_INVAL;
+  80149d:	83 c4 10             	add    $0x10,%esp
+  8014a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014a5:	eb d8                	jmp    80147f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8014a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014ac:	eb d1                	jmp    80147f <ftruncate+0x50>
+
+008014ae <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8014ae:	55                   	push   %ebp
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	56                   	push   %esi
+  8014b2:	53                   	push   %ebx
+  8014b3:	83 ec 18             	sub    $0x18,%esp
+  8014b6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014b9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014bc:	50                   	push   %eax
+  8014bd:	ff 75 08             	push   0x8(%ebp)
+  8014c0:	e8 8b fb ff ff       	call   801050 <fd_lookup>
+  8014c5:	83 c4 10             	add    $0x10,%esp
+  8014c8:	85 c0                	test   %eax,%eax
+  8014ca:	78 49                	js     801515 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014cc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014cf:	83 ec 08             	sub    $0x8,%esp
+  8014d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d5:	50                   	push   %eax
+  8014d6:	ff 36                	push   (%esi)
+  8014d8:	e8 c3 fb ff ff       	call   8010a0 <dev_lookup>
+  8014dd:	83 c4 10             	add    $0x10,%esp
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	78 31                	js     801515 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8014e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014e7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8014eb:	74 2f                	je     80151c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8014ed:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8014f0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8014f7:	00 00 00 
+	stat->st_isdir = 0;
+  8014fa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801501:	00 00 00 
+	stat->st_dev = dev;
+  801504:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80150a:	83 ec 08             	sub    $0x8,%esp
+  80150d:	53                   	push   %ebx
+  80150e:	56                   	push   %esi
+  80150f:	ff 50 14             	call   *0x14(%eax)
+  801512:	83 c4 10             	add    $0x10,%esp
+}
+  801515:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801518:	5b                   	pop    %ebx
+  801519:	5e                   	pop    %esi
+  80151a:	5d                   	pop    %ebp
+  80151b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80151c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801521:	eb f2                	jmp    801515 <fstat+0x67>
+
+00801523 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801523:	55                   	push   %ebp
+  801524:	89 e5                	mov    %esp,%ebp
+  801526:	56                   	push   %esi
+  801527:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801528:	83 ec 08             	sub    $0x8,%esp
+  80152b:	6a 00                	push   $0x0
+  80152d:	ff 75 08             	push   0x8(%ebp)
+  801530:	e8 e4 01 00 00       	call   801719 <open>
+  801535:	89 c3                	mov    %eax,%ebx
+  801537:	83 c4 10             	add    $0x10,%esp
+  80153a:	85 c0                	test   %eax,%eax
+  80153c:	78 1b                	js     801559 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80153e:	83 ec 08             	sub    $0x8,%esp
+  801541:	ff 75 0c             	push   0xc(%ebp)
+  801544:	50                   	push   %eax
+  801545:	e8 64 ff ff ff       	call   8014ae <fstat>
+  80154a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80154c:	89 1c 24             	mov    %ebx,(%esp)
+  80154f:	e8 26 fc ff ff       	call   80117a <close>
+	return r;
+  801554:	83 c4 10             	add    $0x10,%esp
+  801557:	89 f3                	mov    %esi,%ebx
+}
+  801559:	89 d8                	mov    %ebx,%eax
+  80155b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80155e:	5b                   	pop    %ebx
+  80155f:	5e                   	pop    %esi
+  801560:	5d                   	pop    %ebp
+  801561:	c3                   	ret
+
+00801562 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+  801565:	56                   	push   %esi
+  801566:	53                   	push   %ebx
+  801567:	89 c6                	mov    %eax,%esi
+  801569:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80156b:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801572:	74 27                	je     80159b <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801574:	6a 07                	push   $0x7
+  801576:	68 00 50 80 00       	push   $0x805000
+  80157b:	56                   	push   %esi
+  80157c:	ff 35 00 40 80 00    	push   0x804000
+  801582:	e8 1b 0c 00 00       	call   8021a2 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801587:	83 c4 0c             	add    $0xc,%esp
+  80158a:	6a 00                	push   $0x0
+  80158c:	53                   	push   %ebx
+  80158d:	6a 00                	push   $0x0
+  80158f:	e8 96 0b 00 00       	call   80212a <ipc_recv>
+}
+  801594:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801597:	5b                   	pop    %ebx
+  801598:	5e                   	pop    %esi
+  801599:	5d                   	pop    %ebp
+  80159a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80159b:	83 ec 0c             	sub    $0xc,%esp
+  80159e:	6a 01                	push   $0x1
+  8015a0:	e8 51 0c 00 00       	call   8021f6 <ipc_find_env>
+  8015a5:	a3 00 40 80 00       	mov    %eax,0x804000
+  8015aa:	83 c4 10             	add    $0x10,%esp
+  8015ad:	eb c5                	jmp    801574 <fsipc+0x12>
+
+008015af <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8015af:	55                   	push   %ebp
+  8015b0:	89 e5                	mov    %esp,%ebp
+  8015b2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8015b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015b8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015bb:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8015c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015c3:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8015c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015cd:	b8 02 00 00 00       	mov    $0x2,%eax
+  8015d2:	e8 8b ff ff ff       	call   801562 <fsipc>
+}
+  8015d7:	c9                   	leave
+  8015d8:	c3                   	ret
+
+008015d9 <devfile_flush>:
+{
+  8015d9:	55                   	push   %ebp
+  8015da:	89 e5                	mov    %esp,%ebp
+  8015dc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8015df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015e5:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8015ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ef:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015f4:	e8 69 ff ff ff       	call   801562 <fsipc>
+}
+  8015f9:	c9                   	leave
+  8015fa:	c3                   	ret
+
+008015fb <devfile_stat>:
+{
+  8015fb:	55                   	push   %ebp
+  8015fc:	89 e5                	mov    %esp,%ebp
+  8015fe:	53                   	push   %ebx
+  8015ff:	83 ec 04             	sub    $0x4,%esp
+  801602:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801605:	8b 45 08             	mov    0x8(%ebp),%eax
+  801608:	8b 40 0c             	mov    0xc(%eax),%eax
+  80160b:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801610:	ba 00 00 00 00       	mov    $0x0,%edx
+  801615:	b8 05 00 00 00       	mov    $0x5,%eax
+  80161a:	e8 43 ff ff ff       	call   801562 <fsipc>
+  80161f:	85 c0                	test   %eax,%eax
+  801621:	78 2c                	js     80164f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801623:	83 ec 08             	sub    $0x8,%esp
+  801626:	68 00 50 80 00       	push   $0x805000
+  80162b:	53                   	push   %ebx
+  80162c:	e8 10 f1 ff ff       	call   800741 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801631:	a1 80 50 80 00       	mov    0x805080,%eax
+  801636:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80163c:	a1 84 50 80 00       	mov    0x805084,%eax
+  801641:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801647:	83 c4 10             	add    $0x10,%esp
+  80164a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80164f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801652:	c9                   	leave
+  801653:	c3                   	ret
+
+00801654 <devfile_write>:
+{
+  801654:	55                   	push   %ebp
+  801655:	89 e5                	mov    %esp,%ebp
+  801657:	83 ec 0c             	sub    $0xc,%esp
+  80165a:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80165d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801662:	39 d0                	cmp    %edx,%eax
+  801664:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801667:	8b 55 08             	mov    0x8(%ebp),%edx
+  80166a:	8b 52 0c             	mov    0xc(%edx),%edx
+  80166d:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801673:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801678:	50                   	push   %eax
+  801679:	ff 75 0c             	push   0xc(%ebp)
+  80167c:	68 08 50 80 00       	push   $0x805008
+  801681:	e8 41 f2 ff ff       	call   8008c7 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801686:	ba 00 00 00 00       	mov    $0x0,%edx
+  80168b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801690:	e8 cd fe ff ff       	call   801562 <fsipc>
+}
+  801695:	c9                   	leave
+  801696:	c3                   	ret
+
+00801697 <devfile_read>:
+{
+  801697:	55                   	push   %ebp
+  801698:	89 e5                	mov    %esp,%ebp
+  80169a:	56                   	push   %esi
+  80169b:	53                   	push   %ebx
+  80169c:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80169f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016a2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016a5:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  8016aa:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8016b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8016ba:	e8 a3 fe ff ff       	call   801562 <fsipc>
+  8016bf:	89 c3                	mov    %eax,%ebx
+  8016c1:	85 c0                	test   %eax,%eax
+  8016c3:	78 1f                	js     8016e4 <devfile_read+0x4d>
+	assert(r <= n);
+  8016c5:	39 c6                	cmp    %eax,%esi
+  8016c7:	72 24                	jb     8016ed <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8016c9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8016ce:	7f 33                	jg     801703 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8016d0:	83 ec 04             	sub    $0x4,%esp
+  8016d3:	50                   	push   %eax
+  8016d4:	68 00 50 80 00       	push   $0x805000
+  8016d9:	ff 75 0c             	push   0xc(%ebp)
+  8016dc:	e8 e6 f1 ff ff       	call   8008c7 <memmove>
+	return r;
+  8016e1:	83 c4 10             	add    $0x10,%esp
+}
+  8016e4:	89 d8                	mov    %ebx,%eax
+  8016e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016e9:	5b                   	pop    %ebx
+  8016ea:	5e                   	pop    %esi
+  8016eb:	5d                   	pop    %ebp
+  8016ec:	c3                   	ret
+	assert(r <= n);
+  8016ed:	68 9c 2a 80 00       	push   $0x802a9c
+  8016f2:	68 a3 2a 80 00       	push   $0x802aa3
+  8016f7:	6a 7c                	push   $0x7c
+  8016f9:	68 b8 2a 80 00       	push   $0x802ab8
+  8016fe:	e8 e1 09 00 00       	call   8020e4 <_panic>
+	assert(r <= PGSIZE);
+  801703:	68 c3 2a 80 00       	push   $0x802ac3
+  801708:	68 a3 2a 80 00       	push   $0x802aa3
+  80170d:	6a 7d                	push   $0x7d
+  80170f:	68 b8 2a 80 00       	push   $0x802ab8
+  801714:	e8 cb 09 00 00       	call   8020e4 <_panic>
+
+00801719 <open>:
+{
+  801719:	55                   	push   %ebp
+  80171a:	89 e5                	mov    %esp,%ebp
+  80171c:	56                   	push   %esi
+  80171d:	53                   	push   %ebx
+  80171e:	83 ec 1c             	sub    $0x1c,%esp
+  801721:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801724:	56                   	push   %esi
+  801725:	e8 dc ef ff ff       	call   800706 <strlen>
+  80172a:	83 c4 10             	add    $0x10,%esp
+  80172d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801732:	7f 6c                	jg     8017a0 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80173a:	50                   	push   %eax
+  80173b:	e8 ba f8 ff ff       	call   800ffa <fd_alloc>
+  801740:	89 c3                	mov    %eax,%ebx
+  801742:	83 c4 10             	add    $0x10,%esp
+  801745:	85 c0                	test   %eax,%eax
+  801747:	78 3c                	js     801785 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801749:	83 ec 08             	sub    $0x8,%esp
+  80174c:	56                   	push   %esi
+  80174d:	68 00 50 80 00       	push   $0x805000
+  801752:	e8 ea ef ff ff       	call   800741 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801757:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80175a:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80175f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801762:	b8 01 00 00 00       	mov    $0x1,%eax
+  801767:	e8 f6 fd ff ff       	call   801562 <fsipc>
+  80176c:	89 c3                	mov    %eax,%ebx
+  80176e:	83 c4 10             	add    $0x10,%esp
+  801771:	85 c0                	test   %eax,%eax
+  801773:	78 19                	js     80178e <open+0x75>
+	return fd2num(fd);
+  801775:	83 ec 0c             	sub    $0xc,%esp
+  801778:	ff 75 f4             	push   -0xc(%ebp)
+  80177b:	e8 53 f8 ff ff       	call   800fd3 <fd2num>
+  801780:	89 c3                	mov    %eax,%ebx
+  801782:	83 c4 10             	add    $0x10,%esp
+}
+  801785:	89 d8                	mov    %ebx,%eax
+  801787:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80178a:	5b                   	pop    %ebx
+  80178b:	5e                   	pop    %esi
+  80178c:	5d                   	pop    %ebp
+  80178d:	c3                   	ret
+		fd_close(fd, 0);
+  80178e:	83 ec 08             	sub    $0x8,%esp
+  801791:	6a 00                	push   $0x0
+  801793:	ff 75 f4             	push   -0xc(%ebp)
+  801796:	e8 58 f9 ff ff       	call   8010f3 <fd_close>
+		return r;
+  80179b:	83 c4 10             	add    $0x10,%esp
+  80179e:	eb e5                	jmp    801785 <open+0x6c>
+		return -E_BAD_PATH;
+  8017a0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8017a5:	eb de                	jmp    801785 <open+0x6c>
+
+008017a7 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8017a7:	55                   	push   %ebp
+  8017a8:	89 e5                	mov    %esp,%ebp
+  8017aa:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8017ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017b7:	e8 a6 fd ff ff       	call   801562 <fsipc>
+}
+  8017bc:	c9                   	leave
+  8017bd:	c3                   	ret
+
+008017be <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8017be:	55                   	push   %ebp
+  8017bf:	89 e5                	mov    %esp,%ebp
+  8017c1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8017c4:	68 cf 2a 80 00       	push   $0x802acf
+  8017c9:	ff 75 0c             	push   0xc(%ebp)
+  8017cc:	e8 70 ef ff ff       	call   800741 <strcpy>
+	return 0;
+}
+  8017d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d6:	c9                   	leave
+  8017d7:	c3                   	ret
+
+008017d8 <devsock_close>:
+{
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	53                   	push   %ebx
+  8017dc:	83 ec 10             	sub    $0x10,%esp
+  8017df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8017e2:	53                   	push   %ebx
+  8017e3:	e8 1e 0a 00 00       	call   802206 <pageref>
+  8017e8:	89 c2                	mov    %eax,%edx
+  8017ea:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8017ed:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8017f2:	83 fa 01             	cmp    $0x1,%edx
+  8017f5:	74 05                	je     8017fc <devsock_close+0x24>
+}
+  8017f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017fa:	c9                   	leave
+  8017fb:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8017fc:	83 ec 0c             	sub    $0xc,%esp
+  8017ff:	ff 73 0c             	push   0xc(%ebx)
+  801802:	e8 b7 02 00 00       	call   801abe <nsipc_close>
+  801807:	83 c4 10             	add    $0x10,%esp
+  80180a:	eb eb                	jmp    8017f7 <devsock_close+0x1f>
+
+0080180c <devsock_write>:
+{
+  80180c:	55                   	push   %ebp
+  80180d:	89 e5                	mov    %esp,%ebp
+  80180f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801812:	6a 00                	push   $0x0
+  801814:	ff 75 10             	push   0x10(%ebp)
+  801817:	ff 75 0c             	push   0xc(%ebp)
+  80181a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80181d:	ff 70 0c             	push   0xc(%eax)
+  801820:	e8 79 03 00 00       	call   801b9e <nsipc_send>
+}
+  801825:	c9                   	leave
+  801826:	c3                   	ret
+
+00801827 <devsock_read>:
+{
+  801827:	55                   	push   %ebp
+  801828:	89 e5                	mov    %esp,%ebp
+  80182a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80182d:	6a 00                	push   $0x0
+  80182f:	ff 75 10             	push   0x10(%ebp)
+  801832:	ff 75 0c             	push   0xc(%ebp)
+  801835:	8b 45 08             	mov    0x8(%ebp),%eax
+  801838:	ff 70 0c             	push   0xc(%eax)
+  80183b:	e8 ef 02 00 00       	call   801b2f <nsipc_recv>
+}
+  801840:	c9                   	leave
+  801841:	c3                   	ret
+
+00801842 <fd2sockid>:
+{
+  801842:	55                   	push   %ebp
+  801843:	89 e5                	mov    %esp,%ebp
+  801845:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801848:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80184b:	52                   	push   %edx
+  80184c:	50                   	push   %eax
+  80184d:	e8 fe f7 ff ff       	call   801050 <fd_lookup>
+  801852:	83 c4 10             	add    $0x10,%esp
+  801855:	85 c0                	test   %eax,%eax
+  801857:	78 10                	js     801869 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801859:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185c:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801862:	39 08                	cmp    %ecx,(%eax)
+  801864:	75 05                	jne    80186b <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801866:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801869:	c9                   	leave
+  80186a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80186b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801870:	eb f7                	jmp    801869 <fd2sockid+0x27>
+
+00801872 <alloc_sockfd>:
+{
+  801872:	55                   	push   %ebp
+  801873:	89 e5                	mov    %esp,%ebp
+  801875:	56                   	push   %esi
+  801876:	53                   	push   %ebx
+  801877:	83 ec 1c             	sub    $0x1c,%esp
+  80187a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80187c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80187f:	50                   	push   %eax
+  801880:	e8 75 f7 ff ff       	call   800ffa <fd_alloc>
+  801885:	89 c3                	mov    %eax,%ebx
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	85 c0                	test   %eax,%eax
+  80188c:	78 43                	js     8018d1 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80188e:	83 ec 04             	sub    $0x4,%esp
+  801891:	68 07 04 00 00       	push   $0x407
+  801896:	ff 75 f4             	push   -0xc(%ebp)
+  801899:	6a 00                	push   $0x0
+  80189b:	e8 0e f3 ff ff       	call   800bae <sys_page_alloc>
+  8018a0:	89 c3                	mov    %eax,%ebx
+  8018a2:	83 c4 10             	add    $0x10,%esp
+  8018a5:	85 c0                	test   %eax,%eax
+  8018a7:	78 28                	js     8018d1 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8018a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018ac:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8018b2:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8018b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018b7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8018be:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8018c1:	83 ec 0c             	sub    $0xc,%esp
+  8018c4:	50                   	push   %eax
+  8018c5:	e8 09 f7 ff ff       	call   800fd3 <fd2num>
+  8018ca:	89 c3                	mov    %eax,%ebx
+  8018cc:	83 c4 10             	add    $0x10,%esp
+  8018cf:	eb 0c                	jmp    8018dd <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8018d1:	83 ec 0c             	sub    $0xc,%esp
+  8018d4:	56                   	push   %esi
+  8018d5:	e8 e4 01 00 00       	call   801abe <nsipc_close>
+		return r;
+  8018da:	83 c4 10             	add    $0x10,%esp
+}
+  8018dd:	89 d8                	mov    %ebx,%eax
+  8018df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018e2:	5b                   	pop    %ebx
+  8018e3:	5e                   	pop    %esi
+  8018e4:	5d                   	pop    %ebp
+  8018e5:	c3                   	ret
+
+008018e6 <accept>:
+{
+  8018e6:	55                   	push   %ebp
+  8018e7:	89 e5                	mov    %esp,%ebp
+  8018e9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8018ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ef:	e8 4e ff ff ff       	call   801842 <fd2sockid>
+  8018f4:	85 c0                	test   %eax,%eax
+  8018f6:	78 1b                	js     801913 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8018f8:	83 ec 04             	sub    $0x4,%esp
+  8018fb:	ff 75 10             	push   0x10(%ebp)
+  8018fe:	ff 75 0c             	push   0xc(%ebp)
+  801901:	50                   	push   %eax
+  801902:	e8 0e 01 00 00       	call   801a15 <nsipc_accept>
+  801907:	83 c4 10             	add    $0x10,%esp
+  80190a:	85 c0                	test   %eax,%eax
+  80190c:	78 05                	js     801913 <accept+0x2d>
+	return alloc_sockfd(r);
+  80190e:	e8 5f ff ff ff       	call   801872 <alloc_sockfd>
+}
+  801913:	c9                   	leave
+  801914:	c3                   	ret
+
+00801915 <bind>:
+{
+  801915:	55                   	push   %ebp
+  801916:	89 e5                	mov    %esp,%ebp
+  801918:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80191b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80191e:	e8 1f ff ff ff       	call   801842 <fd2sockid>
+  801923:	85 c0                	test   %eax,%eax
+  801925:	78 12                	js     801939 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801927:	83 ec 04             	sub    $0x4,%esp
+  80192a:	ff 75 10             	push   0x10(%ebp)
+  80192d:	ff 75 0c             	push   0xc(%ebp)
+  801930:	50                   	push   %eax
+  801931:	e8 31 01 00 00       	call   801a67 <nsipc_bind>
+  801936:	83 c4 10             	add    $0x10,%esp
+}
+  801939:	c9                   	leave
+  80193a:	c3                   	ret
+
+0080193b <shutdown>:
+{
+  80193b:	55                   	push   %ebp
+  80193c:	89 e5                	mov    %esp,%ebp
+  80193e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801941:	8b 45 08             	mov    0x8(%ebp),%eax
+  801944:	e8 f9 fe ff ff       	call   801842 <fd2sockid>
+  801949:	85 c0                	test   %eax,%eax
+  80194b:	78 0f                	js     80195c <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80194d:	83 ec 08             	sub    $0x8,%esp
+  801950:	ff 75 0c             	push   0xc(%ebp)
+  801953:	50                   	push   %eax
+  801954:	e8 43 01 00 00       	call   801a9c <nsipc_shutdown>
+  801959:	83 c4 10             	add    $0x10,%esp
+}
+  80195c:	c9                   	leave
+  80195d:	c3                   	ret
+
+0080195e <connect>:
+{
+  80195e:	55                   	push   %ebp
+  80195f:	89 e5                	mov    %esp,%ebp
+  801961:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801964:	8b 45 08             	mov    0x8(%ebp),%eax
+  801967:	e8 d6 fe ff ff       	call   801842 <fd2sockid>
+  80196c:	85 c0                	test   %eax,%eax
+  80196e:	78 12                	js     801982 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801970:	83 ec 04             	sub    $0x4,%esp
+  801973:	ff 75 10             	push   0x10(%ebp)
+  801976:	ff 75 0c             	push   0xc(%ebp)
+  801979:	50                   	push   %eax
+  80197a:	e8 59 01 00 00       	call   801ad8 <nsipc_connect>
+  80197f:	83 c4 10             	add    $0x10,%esp
+}
+  801982:	c9                   	leave
+  801983:	c3                   	ret
+
+00801984 <listen>:
+{
+  801984:	55                   	push   %ebp
+  801985:	89 e5                	mov    %esp,%ebp
+  801987:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80198a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80198d:	e8 b0 fe ff ff       	call   801842 <fd2sockid>
+  801992:	85 c0                	test   %eax,%eax
+  801994:	78 0f                	js     8019a5 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801996:	83 ec 08             	sub    $0x8,%esp
+  801999:	ff 75 0c             	push   0xc(%ebp)
+  80199c:	50                   	push   %eax
+  80199d:	e8 6b 01 00 00       	call   801b0d <nsipc_listen>
+  8019a2:	83 c4 10             	add    $0x10,%esp
+}
+  8019a5:	c9                   	leave
+  8019a6:	c3                   	ret
+
+008019a7 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8019a7:	55                   	push   %ebp
+  8019a8:	89 e5                	mov    %esp,%ebp
+  8019aa:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8019ad:	ff 75 10             	push   0x10(%ebp)
+  8019b0:	ff 75 0c             	push   0xc(%ebp)
+  8019b3:	ff 75 08             	push   0x8(%ebp)
+  8019b6:	e8 41 02 00 00       	call   801bfc <nsipc_socket>
+  8019bb:	83 c4 10             	add    $0x10,%esp
+  8019be:	85 c0                	test   %eax,%eax
+  8019c0:	78 05                	js     8019c7 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8019c2:	e8 ab fe ff ff       	call   801872 <alloc_sockfd>
+}
+  8019c7:	c9                   	leave
+  8019c8:	c3                   	ret
+
+008019c9 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8019c9:	55                   	push   %ebp
+  8019ca:	89 e5                	mov    %esp,%ebp
+  8019cc:	53                   	push   %ebx
+  8019cd:	83 ec 04             	sub    $0x4,%esp
+  8019d0:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8019d2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019d9:	74 26                	je     801a01 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8019db:	6a 07                	push   $0x7
+  8019dd:	68 00 60 80 00       	push   $0x806000
+  8019e2:	53                   	push   %ebx
+  8019e3:	ff 35 04 40 80 00    	push   0x804004
+  8019e9:	e8 b4 07 00 00       	call   8021a2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8019ee:	83 c4 0c             	add    $0xc,%esp
+  8019f1:	6a 00                	push   $0x0
+  8019f3:	6a 00                	push   $0x0
+  8019f5:	6a 00                	push   $0x0
+  8019f7:	e8 2e 07 00 00       	call   80212a <ipc_recv>
+}
+  8019fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ff:	c9                   	leave
+  801a00:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a01:	83 ec 0c             	sub    $0xc,%esp
+  801a04:	6a 02                	push   $0x2
+  801a06:	e8 eb 07 00 00       	call   8021f6 <ipc_find_env>
+  801a0b:	a3 04 40 80 00       	mov    %eax,0x804004
+  801a10:	83 c4 10             	add    $0x10,%esp
+  801a13:	eb c6                	jmp    8019db <nsipc+0x12>
+
+00801a15 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801a15:	55                   	push   %ebp
+  801a16:	89 e5                	mov    %esp,%ebp
+  801a18:	56                   	push   %esi
+  801a19:	53                   	push   %ebx
+  801a1a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801a1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a20:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801a25:	8b 06                	mov    (%esi),%eax
+  801a27:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801a2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a31:	e8 93 ff ff ff       	call   8019c9 <nsipc>
+  801a36:	89 c3                	mov    %eax,%ebx
+  801a38:	85 c0                	test   %eax,%eax
+  801a3a:	79 09                	jns    801a45 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801a3c:	89 d8                	mov    %ebx,%eax
+  801a3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a41:	5b                   	pop    %ebx
+  801a42:	5e                   	pop    %esi
+  801a43:	5d                   	pop    %ebp
+  801a44:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801a45:	83 ec 04             	sub    $0x4,%esp
+  801a48:	ff 35 10 60 80 00    	push   0x806010
+  801a4e:	68 00 60 80 00       	push   $0x806000
+  801a53:	ff 75 0c             	push   0xc(%ebp)
+  801a56:	e8 6c ee ff ff       	call   8008c7 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801a5b:	a1 10 60 80 00       	mov    0x806010,%eax
+  801a60:	89 06                	mov    %eax,(%esi)
+  801a62:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801a65:	eb d5                	jmp    801a3c <nsipc_accept+0x27>
+
+00801a67 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801a67:	55                   	push   %ebp
+  801a68:	89 e5                	mov    %esp,%ebp
+  801a6a:	53                   	push   %ebx
+  801a6b:	83 ec 08             	sub    $0x8,%esp
+  801a6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a74:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801a79:	53                   	push   %ebx
+  801a7a:	ff 75 0c             	push   0xc(%ebp)
+  801a7d:	68 04 60 80 00       	push   $0x806004
+  801a82:	e8 40 ee ff ff       	call   8008c7 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801a87:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801a8d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a92:	e8 32 ff ff ff       	call   8019c9 <nsipc>
+}
+  801a97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a9a:	c9                   	leave
+  801a9b:	c3                   	ret
+
+00801a9c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801a9c:	55                   	push   %ebp
+  801a9d:	89 e5                	mov    %esp,%ebp
+  801a9f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aa5:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801aaa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aad:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801ab2:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ab7:	e8 0d ff ff ff       	call   8019c9 <nsipc>
+}
+  801abc:	c9                   	leave
+  801abd:	c3                   	ret
+
+00801abe <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801abe:	55                   	push   %ebp
+  801abf:	89 e5                	mov    %esp,%ebp
+  801ac1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac7:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801acc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ad1:	e8 f3 fe ff ff       	call   8019c9 <nsipc>
+}
+  801ad6:	c9                   	leave
+  801ad7:	c3                   	ret
+
+00801ad8 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801ad8:	55                   	push   %ebp
+  801ad9:	89 e5                	mov    %esp,%ebp
+  801adb:	53                   	push   %ebx
+  801adc:	83 ec 08             	sub    $0x8,%esp
+  801adf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801ae2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae5:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801aea:	53                   	push   %ebx
+  801aeb:	ff 75 0c             	push   0xc(%ebp)
+  801aee:	68 04 60 80 00       	push   $0x806004
+  801af3:	e8 cf ed ff ff       	call   8008c7 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801af8:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801afe:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b03:	e8 c1 fe ff ff       	call   8019c9 <nsipc>
+}
+  801b08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b0b:	c9                   	leave
+  801b0c:	c3                   	ret
+
+00801b0d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801b0d:	55                   	push   %ebp
+  801b0e:	89 e5                	mov    %esp,%ebp
+  801b10:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801b13:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b16:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801b1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b1e:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801b23:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b28:	e8 9c fe ff ff       	call   8019c9 <nsipc>
+}
+  801b2d:	c9                   	leave
+  801b2e:	c3                   	ret
+
+00801b2f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801b2f:	55                   	push   %ebp
+  801b30:	89 e5                	mov    %esp,%ebp
+  801b32:	56                   	push   %esi
+  801b33:	53                   	push   %ebx
+  801b34:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801b37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b3a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801b3f:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801b45:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b48:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801b4d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b52:	e8 72 fe ff ff       	call   8019c9 <nsipc>
+  801b57:	89 c3                	mov    %eax,%ebx
+  801b59:	85 c0                	test   %eax,%eax
+  801b5b:	78 22                	js     801b7f <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801b5d:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801b62:	39 c6                	cmp    %eax,%esi
+  801b64:	0f 4e c6             	cmovle %esi,%eax
+  801b67:	39 c3                	cmp    %eax,%ebx
+  801b69:	7f 1d                	jg     801b88 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801b6b:	83 ec 04             	sub    $0x4,%esp
+  801b6e:	53                   	push   %ebx
+  801b6f:	68 00 60 80 00       	push   $0x806000
+  801b74:	ff 75 0c             	push   0xc(%ebp)
+  801b77:	e8 4b ed ff ff       	call   8008c7 <memmove>
+  801b7c:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801b7f:	89 d8                	mov    %ebx,%eax
+  801b81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b84:	5b                   	pop    %ebx
+  801b85:	5e                   	pop    %esi
+  801b86:	5d                   	pop    %ebp
+  801b87:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801b88:	68 db 2a 80 00       	push   $0x802adb
+  801b8d:	68 a3 2a 80 00       	push   $0x802aa3
+  801b92:	6a 62                	push   $0x62
+  801b94:	68 f0 2a 80 00       	push   $0x802af0
+  801b99:	e8 46 05 00 00       	call   8020e4 <_panic>
+
+00801b9e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801b9e:	55                   	push   %ebp
+  801b9f:	89 e5                	mov    %esp,%ebp
+  801ba1:	53                   	push   %ebx
+  801ba2:	83 ec 04             	sub    $0x4,%esp
+  801ba5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ba8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bab:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801bb0:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801bb6:	7f 2e                	jg     801be6 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801bb8:	83 ec 04             	sub    $0x4,%esp
+  801bbb:	53                   	push   %ebx
+  801bbc:	ff 75 0c             	push   0xc(%ebp)
+  801bbf:	68 0c 60 80 00       	push   $0x80600c
+  801bc4:	e8 fe ec ff ff       	call   8008c7 <memmove>
+	nsipcbuf.send.req_size = size;
+  801bc9:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801bcf:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bd2:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801bd7:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bdc:	e8 e8 fd ff ff       	call   8019c9 <nsipc>
+}
+  801be1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be4:	c9                   	leave
+  801be5:	c3                   	ret
+	assert(size < 1600);
+  801be6:	68 fc 2a 80 00       	push   $0x802afc
+  801beb:	68 a3 2a 80 00       	push   $0x802aa3
+  801bf0:	6a 6d                	push   $0x6d
+  801bf2:	68 f0 2a 80 00       	push   $0x802af0
+  801bf7:	e8 e8 04 00 00       	call   8020e4 <_panic>
+
+00801bfc <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801bfc:	55                   	push   %ebp
+  801bfd:	89 e5                	mov    %esp,%ebp
+  801bff:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801c02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c05:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801c0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c0d:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801c12:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c15:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801c1a:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c1f:	e8 a5 fd ff ff       	call   8019c9 <nsipc>
+}
+  801c24:	c9                   	leave
+  801c25:	c3                   	ret
+
+00801c26 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	56                   	push   %esi
+  801c2a:	53                   	push   %ebx
+  801c2b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801c2e:	83 ec 0c             	sub    $0xc,%esp
+  801c31:	ff 75 08             	push   0x8(%ebp)
+  801c34:	e8 aa f3 ff ff       	call   800fe3 <fd2data>
+  801c39:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801c3b:	83 c4 08             	add    $0x8,%esp
+  801c3e:	68 08 2b 80 00       	push   $0x802b08
+  801c43:	53                   	push   %ebx
+  801c44:	e8 f8 ea ff ff       	call   800741 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801c49:	8b 46 04             	mov    0x4(%esi),%eax
+  801c4c:	2b 06                	sub    (%esi),%eax
+  801c4e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801c54:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c5b:	00 00 00 
+	stat->st_dev = &devpipe;
+  801c5e:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801c65:	30 80 00 
+	return 0;
+}
+  801c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c70:	5b                   	pop    %ebx
+  801c71:	5e                   	pop    %esi
+  801c72:	5d                   	pop    %ebp
+  801c73:	c3                   	ret
+
+00801c74 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801c74:	55                   	push   %ebp
+  801c75:	89 e5                	mov    %esp,%ebp
+  801c77:	53                   	push   %ebx
+  801c78:	83 ec 0c             	sub    $0xc,%esp
+  801c7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801c7e:	53                   	push   %ebx
+  801c7f:	6a 00                	push   $0x0
+  801c81:	e8 f0 ef ff ff       	call   800c76 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801c86:	89 1c 24             	mov    %ebx,(%esp)
+  801c89:	e8 55 f3 ff ff       	call   800fe3 <fd2data>
+  801c8e:	83 c4 08             	add    $0x8,%esp
+  801c91:	50                   	push   %eax
+  801c92:	6a 00                	push   $0x0
+  801c94:	e8 dd ef ff ff       	call   800c76 <sys_page_unmap>
+}
+  801c99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c9c:	c9                   	leave
+  801c9d:	c3                   	ret
+
+00801c9e <_pipeisclosed>:
+{
+  801c9e:	55                   	push   %ebp
+  801c9f:	89 e5                	mov    %esp,%ebp
+  801ca1:	57                   	push   %edi
+  801ca2:	56                   	push   %esi
+  801ca3:	53                   	push   %ebx
+  801ca4:	83 ec 1c             	sub    $0x1c,%esp
+  801ca7:	89 c7                	mov    %eax,%edi
+  801ca9:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801cab:	a1 08 40 80 00       	mov    0x804008,%eax
+  801cb0:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801cb3:	83 ec 0c             	sub    $0xc,%esp
+  801cb6:	57                   	push   %edi
+  801cb7:	e8 4a 05 00 00       	call   802206 <pageref>
+  801cbc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801cbf:	89 34 24             	mov    %esi,(%esp)
+  801cc2:	e8 3f 05 00 00       	call   802206 <pageref>
+		nn = thisenv->env_runs;
+  801cc7:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801ccd:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801cd0:	83 c4 10             	add    $0x10,%esp
+  801cd3:	39 cb                	cmp    %ecx,%ebx
+  801cd5:	74 1b                	je     801cf2 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801cd7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801cda:	75 cf                	jne    801cab <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801cdc:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801cdf:	6a 01                	push   $0x1
+  801ce1:	50                   	push   %eax
+  801ce2:	53                   	push   %ebx
+  801ce3:	68 0f 2b 80 00       	push   $0x802b0f
+  801ce8:	e8 66 e4 ff ff       	call   800153 <cprintf>
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	eb b9                	jmp    801cab <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801cf2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801cf5:	0f 94 c0             	sete   %al
+  801cf8:	0f b6 c0             	movzbl %al,%eax
+}
+  801cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cfe:	5b                   	pop    %ebx
+  801cff:	5e                   	pop    %esi
+  801d00:	5f                   	pop    %edi
+  801d01:	5d                   	pop    %ebp
+  801d02:	c3                   	ret
+
+00801d03 <devpipe_write>:
+{
+  801d03:	55                   	push   %ebp
+  801d04:	89 e5                	mov    %esp,%ebp
+  801d06:	57                   	push   %edi
+  801d07:	56                   	push   %esi
+  801d08:	53                   	push   %ebx
+  801d09:	83 ec 28             	sub    $0x28,%esp
+  801d0c:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801d0f:	56                   	push   %esi
+  801d10:	e8 ce f2 ff ff       	call   800fe3 <fd2data>
+  801d15:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d17:	83 c4 10             	add    $0x10,%esp
+  801d1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d1f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801d22:	75 09                	jne    801d2d <devpipe_write+0x2a>
+	return i;
+  801d24:	89 f8                	mov    %edi,%eax
+  801d26:	eb 23                	jmp    801d4b <devpipe_write+0x48>
+			sys_yield();
+  801d28:	e8 01 ee ff ff       	call   800b2e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801d2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  801d30:	8b 0b                	mov    (%ebx),%ecx
+  801d32:	8d 51 20             	lea    0x20(%ecx),%edx
+  801d35:	39 d0                	cmp    %edx,%eax
+  801d37:	72 1a                	jb     801d53 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801d39:	89 da                	mov    %ebx,%edx
+  801d3b:	89 f0                	mov    %esi,%eax
+  801d3d:	e8 5c ff ff ff       	call   801c9e <_pipeisclosed>
+  801d42:	85 c0                	test   %eax,%eax
+  801d44:	74 e2                	je     801d28 <devpipe_write+0x25>
+				return 0;
+  801d46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d4e:	5b                   	pop    %ebx
+  801d4f:	5e                   	pop    %esi
+  801d50:	5f                   	pop    %edi
+  801d51:	5d                   	pop    %ebp
+  801d52:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d56:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801d5a:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801d5d:	89 c2                	mov    %eax,%edx
+  801d5f:	c1 fa 1f             	sar    $0x1f,%edx
+  801d62:	89 d1                	mov    %edx,%ecx
+  801d64:	c1 e9 1b             	shr    $0x1b,%ecx
+  801d67:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801d6a:	83 e2 1f             	and    $0x1f,%edx
+  801d6d:	29 ca                	sub    %ecx,%edx
+  801d6f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801d73:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801d77:	83 c0 01             	add    $0x1,%eax
+  801d7a:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801d7d:	83 c7 01             	add    $0x1,%edi
+  801d80:	eb 9d                	jmp    801d1f <devpipe_write+0x1c>
+
+00801d82 <devpipe_read>:
+{
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	57                   	push   %edi
+  801d86:	56                   	push   %esi
+  801d87:	53                   	push   %ebx
+  801d88:	83 ec 18             	sub    $0x18,%esp
+  801d8b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801d8e:	57                   	push   %edi
+  801d8f:	e8 4f f2 ff ff       	call   800fe3 <fd2data>
+  801d94:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d96:	83 c4 10             	add    $0x10,%esp
+  801d99:	be 00 00 00 00       	mov    $0x0,%esi
+  801d9e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801da1:	75 13                	jne    801db6 <devpipe_read+0x34>
+	return i;
+  801da3:	89 f0                	mov    %esi,%eax
+  801da5:	eb 02                	jmp    801da9 <devpipe_read+0x27>
+				return i;
+  801da7:	89 f0                	mov    %esi,%eax
+}
+  801da9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dac:	5b                   	pop    %ebx
+  801dad:	5e                   	pop    %esi
+  801dae:	5f                   	pop    %edi
+  801daf:	5d                   	pop    %ebp
+  801db0:	c3                   	ret
+			sys_yield();
+  801db1:	e8 78 ed ff ff       	call   800b2e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801db6:	8b 03                	mov    (%ebx),%eax
+  801db8:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801dbb:	75 18                	jne    801dd5 <devpipe_read+0x53>
+			if (i > 0)
+  801dbd:	85 f6                	test   %esi,%esi
+  801dbf:	75 e6                	jne    801da7 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801dc1:	89 da                	mov    %ebx,%edx
+  801dc3:	89 f8                	mov    %edi,%eax
+  801dc5:	e8 d4 fe ff ff       	call   801c9e <_pipeisclosed>
+  801dca:	85 c0                	test   %eax,%eax
+  801dcc:	74 e3                	je     801db1 <devpipe_read+0x2f>
+				return 0;
+  801dce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd3:	eb d4                	jmp    801da9 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801dd5:	99                   	cltd
+  801dd6:	c1 ea 1b             	shr    $0x1b,%edx
+  801dd9:	01 d0                	add    %edx,%eax
+  801ddb:	83 e0 1f             	and    $0x1f,%eax
+  801dde:	29 d0                	sub    %edx,%eax
+  801de0:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801de5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801de8:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801deb:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801dee:	83 c6 01             	add    $0x1,%esi
+  801df1:	eb ab                	jmp    801d9e <devpipe_read+0x1c>
+
+00801df3 <pipe>:
+{
+  801df3:	55                   	push   %ebp
+  801df4:	89 e5                	mov    %esp,%ebp
+  801df6:	56                   	push   %esi
+  801df7:	53                   	push   %ebx
+  801df8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801dfb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dfe:	50                   	push   %eax
+  801dff:	e8 f6 f1 ff ff       	call   800ffa <fd_alloc>
+  801e04:	89 c3                	mov    %eax,%ebx
+  801e06:	83 c4 10             	add    $0x10,%esp
+  801e09:	85 c0                	test   %eax,%eax
+  801e0b:	0f 88 23 01 00 00    	js     801f34 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e11:	83 ec 04             	sub    $0x4,%esp
+  801e14:	68 07 04 00 00       	push   $0x407
+  801e19:	ff 75 f4             	push   -0xc(%ebp)
+  801e1c:	6a 00                	push   $0x0
+  801e1e:	e8 8b ed ff ff       	call   800bae <sys_page_alloc>
+  801e23:	89 c3                	mov    %eax,%ebx
+  801e25:	83 c4 10             	add    $0x10,%esp
+  801e28:	85 c0                	test   %eax,%eax
+  801e2a:	0f 88 04 01 00 00    	js     801f34 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801e30:	83 ec 0c             	sub    $0xc,%esp
+  801e33:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e36:	50                   	push   %eax
+  801e37:	e8 be f1 ff ff       	call   800ffa <fd_alloc>
+  801e3c:	89 c3                	mov    %eax,%ebx
+  801e3e:	83 c4 10             	add    $0x10,%esp
+  801e41:	85 c0                	test   %eax,%eax
+  801e43:	0f 88 db 00 00 00    	js     801f24 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e49:	83 ec 04             	sub    $0x4,%esp
+  801e4c:	68 07 04 00 00       	push   $0x407
+  801e51:	ff 75 f0             	push   -0x10(%ebp)
+  801e54:	6a 00                	push   $0x0
+  801e56:	e8 53 ed ff ff       	call   800bae <sys_page_alloc>
+  801e5b:	89 c3                	mov    %eax,%ebx
+  801e5d:	83 c4 10             	add    $0x10,%esp
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	0f 88 bc 00 00 00    	js     801f24 <pipe+0x131>
+	va = fd2data(fd0);
+  801e68:	83 ec 0c             	sub    $0xc,%esp
+  801e6b:	ff 75 f4             	push   -0xc(%ebp)
+  801e6e:	e8 70 f1 ff ff       	call   800fe3 <fd2data>
+  801e73:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e75:	83 c4 0c             	add    $0xc,%esp
+  801e78:	68 07 04 00 00       	push   $0x407
+  801e7d:	50                   	push   %eax
+  801e7e:	6a 00                	push   $0x0
+  801e80:	e8 29 ed ff ff       	call   800bae <sys_page_alloc>
+  801e85:	89 c3                	mov    %eax,%ebx
+  801e87:	83 c4 10             	add    $0x10,%esp
+  801e8a:	85 c0                	test   %eax,%eax
+  801e8c:	0f 88 82 00 00 00    	js     801f14 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e92:	83 ec 0c             	sub    $0xc,%esp
+  801e95:	ff 75 f0             	push   -0x10(%ebp)
+  801e98:	e8 46 f1 ff ff       	call   800fe3 <fd2data>
+  801e9d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801ea4:	50                   	push   %eax
+  801ea5:	6a 00                	push   $0x0
+  801ea7:	56                   	push   %esi
+  801ea8:	6a 00                	push   $0x0
+  801eaa:	e8 85 ed ff ff       	call   800c34 <sys_page_map>
+  801eaf:	89 c3                	mov    %eax,%ebx
+  801eb1:	83 c4 20             	add    $0x20,%esp
+  801eb4:	85 c0                	test   %eax,%eax
+  801eb6:	78 4e                	js     801f06 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801eb8:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801ebd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ec0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801ec2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ec5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801ecc:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801ecf:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801ed1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801ed4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801edb:	83 ec 0c             	sub    $0xc,%esp
+  801ede:	ff 75 f4             	push   -0xc(%ebp)
+  801ee1:	e8 ed f0 ff ff       	call   800fd3 <fd2num>
+  801ee6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ee9:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801eeb:	83 c4 04             	add    $0x4,%esp
+  801eee:	ff 75 f0             	push   -0x10(%ebp)
+  801ef1:	e8 dd f0 ff ff       	call   800fd3 <fd2num>
+  801ef6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ef9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f04:	eb 2e                	jmp    801f34 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801f06:	83 ec 08             	sub    $0x8,%esp
+  801f09:	56                   	push   %esi
+  801f0a:	6a 00                	push   $0x0
+  801f0c:	e8 65 ed ff ff       	call   800c76 <sys_page_unmap>
+  801f11:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801f14:	83 ec 08             	sub    $0x8,%esp
+  801f17:	ff 75 f0             	push   -0x10(%ebp)
+  801f1a:	6a 00                	push   $0x0
+  801f1c:	e8 55 ed ff ff       	call   800c76 <sys_page_unmap>
+  801f21:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801f24:	83 ec 08             	sub    $0x8,%esp
+  801f27:	ff 75 f4             	push   -0xc(%ebp)
+  801f2a:	6a 00                	push   $0x0
+  801f2c:	e8 45 ed ff ff       	call   800c76 <sys_page_unmap>
+  801f31:	83 c4 10             	add    $0x10,%esp
+}
+  801f34:	89 d8                	mov    %ebx,%eax
+  801f36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f39:	5b                   	pop    %ebx
+  801f3a:	5e                   	pop    %esi
+  801f3b:	5d                   	pop    %ebp
+  801f3c:	c3                   	ret
+
+00801f3d <pipeisclosed>:
+{
+  801f3d:	55                   	push   %ebp
+  801f3e:	89 e5                	mov    %esp,%ebp
+  801f40:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f43:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f46:	50                   	push   %eax
+  801f47:	ff 75 08             	push   0x8(%ebp)
+  801f4a:	e8 01 f1 ff ff       	call   801050 <fd_lookup>
+  801f4f:	83 c4 10             	add    $0x10,%esp
+  801f52:	85 c0                	test   %eax,%eax
+  801f54:	78 18                	js     801f6e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801f56:	83 ec 0c             	sub    $0xc,%esp
+  801f59:	ff 75 f4             	push   -0xc(%ebp)
+  801f5c:	e8 82 f0 ff ff       	call   800fe3 <fd2data>
+  801f61:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801f63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f66:	e8 33 fd ff ff       	call   801c9e <_pipeisclosed>
+  801f6b:	83 c4 10             	add    $0x10,%esp
+}
+  801f6e:	c9                   	leave
+  801f6f:	c3                   	ret
+
+00801f70 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801f70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f75:	c3                   	ret
+
+00801f76 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f76:	55                   	push   %ebp
+  801f77:	89 e5                	mov    %esp,%ebp
+  801f79:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801f7c:	68 27 2b 80 00       	push   $0x802b27
+  801f81:	ff 75 0c             	push   0xc(%ebp)
+  801f84:	e8 b8 e7 ff ff       	call   800741 <strcpy>
+	return 0;
+}
+  801f89:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f8e:	c9                   	leave
+  801f8f:	c3                   	ret
+
+00801f90 <devcons_write>:
+{
+  801f90:	55                   	push   %ebp
+  801f91:	89 e5                	mov    %esp,%ebp
+  801f93:	57                   	push   %edi
+  801f94:	56                   	push   %esi
+  801f95:	53                   	push   %ebx
+  801f96:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801f9c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801fa1:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801fa7:	eb 2e                	jmp    801fd7 <devcons_write+0x47>
+		m = n - tot;
+  801fa9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fac:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801fae:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801fb3:	39 c3                	cmp    %eax,%ebx
+  801fb5:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801fb8:	83 ec 04             	sub    $0x4,%esp
+  801fbb:	53                   	push   %ebx
+  801fbc:	89 f0                	mov    %esi,%eax
+  801fbe:	03 45 0c             	add    0xc(%ebp),%eax
+  801fc1:	50                   	push   %eax
+  801fc2:	57                   	push   %edi
+  801fc3:	e8 ff e8 ff ff       	call   8008c7 <memmove>
+		sys_cputs(buf, m);
+  801fc8:	83 c4 08             	add    $0x8,%esp
+  801fcb:	53                   	push   %ebx
+  801fcc:	57                   	push   %edi
+  801fcd:	e8 9f ea ff ff       	call   800a71 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801fd2:	01 de                	add    %ebx,%esi
+  801fd4:	83 c4 10             	add    $0x10,%esp
+  801fd7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801fda:	72 cd                	jb     801fa9 <devcons_write+0x19>
+}
+  801fdc:	89 f0                	mov    %esi,%eax
+  801fde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fe1:	5b                   	pop    %ebx
+  801fe2:	5e                   	pop    %esi
+  801fe3:	5f                   	pop    %edi
+  801fe4:	5d                   	pop    %ebp
+  801fe5:	c3                   	ret
+
+00801fe6 <devcons_read>:
+{
+  801fe6:	55                   	push   %ebp
+  801fe7:	89 e5                	mov    %esp,%ebp
+  801fe9:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801ff5:	75 07                	jne    801ffe <devcons_read+0x18>
+  801ff7:	eb 1f                	jmp    802018 <devcons_read+0x32>
+		sys_yield();
+  801ff9:	e8 30 eb ff ff       	call   800b2e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801ffe:	e8 8c ea ff ff       	call   800a8f <sys_cgetc>
+  802003:	85 c0                	test   %eax,%eax
+  802005:	74 f2                	je     801ff9 <devcons_read+0x13>
+	if (c < 0)
+  802007:	78 0f                	js     802018 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802009:	83 f8 04             	cmp    $0x4,%eax
+  80200c:	74 0c                	je     80201a <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80200e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802011:	88 02                	mov    %al,(%edx)
+	return 1;
+  802013:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802018:	c9                   	leave
+  802019:	c3                   	ret
+		return 0;
+  80201a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201f:	eb f7                	jmp    802018 <devcons_read+0x32>
+
+00802021 <cputchar>:
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802027:	8b 45 08             	mov    0x8(%ebp),%eax
+  80202a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80202d:	6a 01                	push   $0x1
+  80202f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802032:	50                   	push   %eax
+  802033:	e8 39 ea ff ff       	call   800a71 <sys_cputs>
+}
+  802038:	83 c4 10             	add    $0x10,%esp
+  80203b:	c9                   	leave
+  80203c:	c3                   	ret
+
+0080203d <getchar>:
+{
+  80203d:	55                   	push   %ebp
+  80203e:	89 e5                	mov    %esp,%ebp
+  802040:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802043:	6a 01                	push   $0x1
+  802045:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802048:	50                   	push   %eax
+  802049:	6a 00                	push   $0x0
+  80204b:	e8 66 f2 ff ff       	call   8012b6 <read>
+	if (r < 0)
+  802050:	83 c4 10             	add    $0x10,%esp
+  802053:	85 c0                	test   %eax,%eax
+  802055:	78 06                	js     80205d <getchar+0x20>
+	if (r < 1)
+  802057:	74 06                	je     80205f <getchar+0x22>
+	return c;
+  802059:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80205d:	c9                   	leave
+  80205e:	c3                   	ret
+		return -E_EOF;
+  80205f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802064:	eb f7                	jmp    80205d <getchar+0x20>
+
+00802066 <iscons>:
+{
+  802066:	55                   	push   %ebp
+  802067:	89 e5                	mov    %esp,%ebp
+  802069:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80206c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80206f:	50                   	push   %eax
+  802070:	ff 75 08             	push   0x8(%ebp)
+  802073:	e8 d8 ef ff ff       	call   801050 <fd_lookup>
+  802078:	83 c4 10             	add    $0x10,%esp
+  80207b:	85 c0                	test   %eax,%eax
+  80207d:	78 11                	js     802090 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80207f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802082:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802088:	39 10                	cmp    %edx,(%eax)
+  80208a:	0f 94 c0             	sete   %al
+  80208d:	0f b6 c0             	movzbl %al,%eax
+}
+  802090:	c9                   	leave
+  802091:	c3                   	ret
+
+00802092 <opencons>:
+{
+  802092:	55                   	push   %ebp
+  802093:	89 e5                	mov    %esp,%ebp
+  802095:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802098:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80209b:	50                   	push   %eax
+  80209c:	e8 59 ef ff ff       	call   800ffa <fd_alloc>
+  8020a1:	83 c4 10             	add    $0x10,%esp
+  8020a4:	85 c0                	test   %eax,%eax
+  8020a6:	78 3a                	js     8020e2 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8020a8:	83 ec 04             	sub    $0x4,%esp
+  8020ab:	68 07 04 00 00       	push   $0x407
+  8020b0:	ff 75 f4             	push   -0xc(%ebp)
+  8020b3:	6a 00                	push   $0x0
+  8020b5:	e8 f4 ea ff ff       	call   800bae <sys_page_alloc>
+  8020ba:	83 c4 10             	add    $0x10,%esp
+  8020bd:	85 c0                	test   %eax,%eax
+  8020bf:	78 21                	js     8020e2 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8020c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c4:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8020ca:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8020cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020cf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8020d6:	83 ec 0c             	sub    $0xc,%esp
+  8020d9:	50                   	push   %eax
+  8020da:	e8 f4 ee ff ff       	call   800fd3 <fd2num>
+  8020df:	83 c4 10             	add    $0x10,%esp
+}
+  8020e2:	c9                   	leave
+  8020e3:	c3                   	ret
+
+008020e4 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8020e4:	55                   	push   %ebp
+  8020e5:	89 e5                	mov    %esp,%ebp
+  8020e7:	56                   	push   %esi
+  8020e8:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8020e9:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8020ec:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8020f2:	e8 18 ea ff ff       	call   800b0f <sys_getenvid>
+  8020f7:	83 ec 0c             	sub    $0xc,%esp
+  8020fa:	ff 75 0c             	push   0xc(%ebp)
+  8020fd:	ff 75 08             	push   0x8(%ebp)
+  802100:	56                   	push   %esi
+  802101:	50                   	push   %eax
+  802102:	68 34 2b 80 00       	push   $0x802b34
+  802107:	e8 47 e0 ff ff       	call   800153 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80210c:	83 c4 18             	add    $0x18,%esp
+  80210f:	53                   	push   %ebx
+  802110:	ff 75 10             	push   0x10(%ebp)
+  802113:	e8 ea df ff ff       	call   800102 <vcprintf>
+	cprintf("\n");
+  802118:	c7 04 24 20 2b 80 00 	movl   $0x802b20,(%esp)
+  80211f:	e8 2f e0 ff ff       	call   800153 <cprintf>
+  802124:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802127:	cc                   	int3
+	while (1)
+  802128:	eb fd                	jmp    802127 <_panic+0x43>
+
+0080212a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80212a:	55                   	push   %ebp
+  80212b:	89 e5                	mov    %esp,%ebp
+  80212d:	57                   	push   %edi
+  80212e:	56                   	push   %esi
+  80212f:	53                   	push   %ebx
+  802130:	83 ec 18             	sub    $0x18,%esp
+  802133:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802136:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802139:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80213c:	85 db                	test   %ebx,%ebx
+  80213e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802143:	0f 45 c3             	cmovne %ebx,%eax
+  802146:	50                   	push   %eax
+  802147:	e8 e5 ed ff ff       	call   800f31 <sys_ipc_recv>
+
+	if (from_env_store)
+  80214c:	83 c4 10             	add    $0x10,%esp
+  80214f:	85 ff                	test   %edi,%edi
+  802151:	74 17                	je     80216a <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802153:	ba 00 00 00 00       	mov    $0x0,%edx
+  802158:	85 c0                	test   %eax,%eax
+  80215a:	75 0c                	jne    802168 <ipc_recv+0x3e>
+  80215c:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802162:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802168:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  80216a:	85 f6                	test   %esi,%esi
+  80216c:	74 2e                	je     80219c <ipc_recv+0x72>
+		if (!r && pg)
+  80216e:	85 c0                	test   %eax,%eax
+  802170:	75 24                	jne    802196 <ipc_recv+0x6c>
+  802172:	85 db                	test   %ebx,%ebx
+  802174:	74 20                	je     802196 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802176:	a1 08 40 80 00       	mov    0x804008,%eax
+  80217b:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802181:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802183:	a1 08 40 80 00       	mov    0x804008,%eax
+  802188:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80218e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802191:	5b                   	pop    %ebx
+  802192:	5e                   	pop    %esi
+  802193:	5f                   	pop    %edi
+  802194:	5d                   	pop    %ebp
+  802195:	c3                   	ret
+			*perm_store = 0;
+  802196:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80219c:	85 c0                	test   %eax,%eax
+  80219e:	75 ee                	jne    80218e <ipc_recv+0x64>
+  8021a0:	eb e1                	jmp    802183 <ipc_recv+0x59>
+
+008021a2 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8021a2:	55                   	push   %ebp
+  8021a3:	89 e5                	mov    %esp,%ebp
+  8021a5:	57                   	push   %edi
+  8021a6:	56                   	push   %esi
+  8021a7:	53                   	push   %ebx
+  8021a8:	83 ec 0c             	sub    $0xc,%esp
+  8021ab:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021ae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8021b4:	85 db                	test   %ebx,%ebx
+  8021b6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021bb:	0f 44 d8             	cmove  %eax,%ebx
+  8021be:	ff 75 14             	push   0x14(%ebp)
+  8021c1:	53                   	push   %ebx
+  8021c2:	56                   	push   %esi
+  8021c3:	57                   	push   %edi
+  8021c4:	e8 45 ed ff ff       	call   800f0e <sys_ipc_try_send_yield>
+  8021c9:	83 c4 10             	add    $0x10,%esp
+  8021cc:	85 c0                	test   %eax,%eax
+  8021ce:	79 1e                	jns    8021ee <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8021d0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021d3:	75 07                	jne    8021dc <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8021d5:	e8 54 e9 ff ff       	call   800b2e <sys_yield>
+  8021da:	eb e2                	jmp    8021be <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8021dc:	50                   	push   %eax
+  8021dd:	68 57 2b 80 00       	push   $0x802b57
+  8021e2:	6a 3d                	push   $0x3d
+  8021e4:	68 6c 2b 80 00       	push   $0x802b6c
+  8021e9:	e8 f6 fe ff ff       	call   8020e4 <_panic>
+	}
+}
+  8021ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f1:	5b                   	pop    %ebx
+  8021f2:	5e                   	pop    %esi
+  8021f3:	5f                   	pop    %edi
+  8021f4:	5d                   	pop    %ebp
+  8021f5:	c3                   	ret
+
+008021f6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8021f6:	55                   	push   %ebp
+  8021f7:	89 e5                	mov    %esp,%ebp
+  8021f9:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8021fc:	ff 75 08             	push   0x8(%ebp)
+  8021ff:	e8 aa e8 ff ff       	call   800aae <sys_env_find>
+}
+  802204:	c9                   	leave
+  802205:	c3                   	ret
+
+00802206 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802206:	55                   	push   %ebp
+  802207:	89 e5                	mov    %esp,%ebp
+  802209:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80220c:	89 c2                	mov    %eax,%edx
+  80220e:	c1 ea 16             	shr    $0x16,%edx
+  802211:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802218:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80221d:	f6 c1 01             	test   $0x1,%cl
+  802220:	74 22                	je     802244 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802222:	c1 e8 0c             	shr    $0xc,%eax
+  802225:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80222c:	a8 01                	test   $0x1,%al
+  80222e:	74 14                	je     802244 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802230:	c1 e8 0c             	shr    $0xc,%eax
+  802233:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802236:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80223d:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802241:	0f b7 d2             	movzwl %dx,%edx
+}
+  802244:	89 d0                	mov    %edx,%eax
+  802246:	5d                   	pop    %ebp
+  802247:	c3                   	ret
+  802248:	66 90                	xchg   %ax,%ax
+  80224a:	66 90                	xchg   %ax,%ax
+  80224c:	66 90                	xchg   %ax,%ax
+  80224e:	66 90                	xchg   %ax,%ax
+
+00802250 <__udivmoddi4>:
+  802250:	55                   	push   %ebp
+  802251:	57                   	push   %edi
+  802252:	56                   	push   %esi
+  802253:	53                   	push   %ebx
+  802254:	83 ec 14             	sub    $0x14,%esp
+  802257:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80225b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80225f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802263:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802267:	89 f1                	mov    %esi,%ecx
+  802269:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80226d:	09 d9                	or     %ebx,%ecx
+  80226f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802273:	0f 84 92 00 00 00    	je     80230b <__udivmoddi4+0xbb>
+  802279:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802280:	00 
+  802281:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802286:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80228d:	00 
+  80228e:	89 1c 24             	mov    %ebx,(%esp)
+  802291:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802295:	8d 76 00             	lea    0x0(%esi),%esi
+  802298:	89 e9                	mov    %ebp,%ecx
+  80229a:	89 c3                	mov    %eax,%ebx
+  80229c:	89 d6                	mov    %edx,%esi
+  80229e:	31 ff                	xor    %edi,%edi
+  8022a0:	d3 ee                	shr    %cl,%esi
+  8022a2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8022a5:	f6 c1 20             	test   $0x20,%cl
+  8022a8:	0f 45 de             	cmovne %esi,%ebx
+  8022ab:	0f 45 f7             	cmovne %edi,%esi
+  8022ae:	8b 3c 24             	mov    (%esp),%edi
+  8022b1:	39 fb                	cmp    %edi,%ebx
+  8022b3:	89 f7                	mov    %esi,%edi
+  8022b5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8022b9:	8b 1c 24             	mov    (%esp),%ebx
+  8022bc:	19 f7                	sbb    %esi,%edi
+  8022be:	72 39                	jb     8022f9 <__udivmoddi4+0xa9>
+  8022c0:	89 e9                	mov    %ebp,%ecx
+  8022c2:	89 f7                	mov    %esi,%edi
+  8022c4:	89 de                	mov    %ebx,%esi
+  8022c6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8022c9:	d3 e6                	shl    %cl,%esi
+  8022cb:	31 db                	xor    %ebx,%ebx
+  8022cd:	f6 c1 20             	test   $0x20,%cl
+  8022d0:	0f 45 fe             	cmovne %esi,%edi
+  8022d3:	0f 45 f3             	cmovne %ebx,%esi
+  8022d6:	29 f0                	sub    %esi,%eax
+  8022d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022dd:	19 fa                	sbb    %edi,%edx
+  8022df:	31 ff                	xor    %edi,%edi
+  8022e1:	31 db                	xor    %ebx,%ebx
+  8022e3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8022e6:	d3 e6                	shl    %cl,%esi
+  8022e8:	f6 c1 20             	test   $0x20,%cl
+  8022eb:	0f 45 fe             	cmovne %esi,%edi
+  8022ee:	0f 45 f3             	cmovne %ebx,%esi
+  8022f1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8022f5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8022f9:	83 ed 01             	sub    $0x1,%ebp
+  8022fc:	73 9a                	jae    802298 <__udivmoddi4+0x48>
+  8022fe:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802302:	85 ff                	test   %edi,%edi
+  802304:	74 05                	je     80230b <__udivmoddi4+0xbb>
+  802306:	89 07                	mov    %eax,(%edi)
+  802308:	89 57 04             	mov    %edx,0x4(%edi)
+  80230b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80230f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802313:	83 c4 14             	add    $0x14,%esp
+  802316:	5b                   	pop    %ebx
+  802317:	5e                   	pop    %esi
+  802318:	5f                   	pop    %edi
+  802319:	5d                   	pop    %ebp
+  80231a:	c3                   	ret
+  80231b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80231f:	90                   	nop
+
+00802320 <__udivdi3>:
+  802320:	55                   	push   %ebp
+  802321:	57                   	push   %edi
+  802322:	56                   	push   %esi
+  802323:	53                   	push   %ebx
+  802324:	83 ec 14             	sub    $0x14,%esp
+  802327:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80232b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80232f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802333:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802337:	89 fb                	mov    %edi,%ebx
+  802339:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80233d:	09 f3                	or     %esi,%ebx
+  80233f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802343:	0f 84 85 00 00 00    	je     8023ce <__udivdi3+0xae>
+  802349:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802350:	00 
+  802351:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802356:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80235d:	00 
+  80235e:	89 34 24             	mov    %esi,(%esp)
+  802361:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802365:	8d 76 00             	lea    0x0(%esi),%esi
+  802368:	89 e9                	mov    %ebp,%ecx
+  80236a:	89 c3                	mov    %eax,%ebx
+  80236c:	89 d6                	mov    %edx,%esi
+  80236e:	31 ff                	xor    %edi,%edi
+  802370:	d3 ee                	shr    %cl,%esi
+  802372:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802375:	f6 c1 20             	test   $0x20,%cl
+  802378:	0f 45 de             	cmovne %esi,%ebx
+  80237b:	0f 45 f7             	cmovne %edi,%esi
+  80237e:	8b 3c 24             	mov    (%esp),%edi
+  802381:	39 fb                	cmp    %edi,%ebx
+  802383:	89 f7                	mov    %esi,%edi
+  802385:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802389:	8b 1c 24             	mov    (%esp),%ebx
+  80238c:	19 f7                	sbb    %esi,%edi
+  80238e:	72 39                	jb     8023c9 <__udivdi3+0xa9>
+  802390:	89 e9                	mov    %ebp,%ecx
+  802392:	89 f7                	mov    %esi,%edi
+  802394:	89 de                	mov    %ebx,%esi
+  802396:	0f a5 df             	shld   %cl,%ebx,%edi
+  802399:	d3 e6                	shl    %cl,%esi
+  80239b:	31 db                	xor    %ebx,%ebx
+  80239d:	f6 c1 20             	test   $0x20,%cl
+  8023a0:	0f 45 fe             	cmovne %esi,%edi
+  8023a3:	0f 45 f3             	cmovne %ebx,%esi
+  8023a6:	29 f0                	sub    %esi,%eax
+  8023a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ad:	19 fa                	sbb    %edi,%edx
+  8023af:	31 ff                	xor    %edi,%edi
+  8023b1:	31 db                	xor    %ebx,%ebx
+  8023b3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023b6:	d3 e6                	shl    %cl,%esi
+  8023b8:	f6 c1 20             	test   $0x20,%cl
+  8023bb:	0f 45 fe             	cmovne %esi,%edi
+  8023be:	0f 45 f3             	cmovne %ebx,%esi
+  8023c1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023c5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023c9:	83 ed 01             	sub    $0x1,%ebp
+  8023cc:	73 9a                	jae    802368 <__udivdi3+0x48>
+  8023ce:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023d2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023d6:	83 c4 14             	add    $0x14,%esp
+  8023d9:	5b                   	pop    %ebx
+  8023da:	5e                   	pop    %esi
+  8023db:	5f                   	pop    %edi
+  8023dc:	5d                   	pop    %ebp
+  8023dd:	c3                   	ret
+  8023de:	66 90                	xchg   %ax,%ax
+
+008023e0 <__umoddi3>:
+  8023e0:	57                   	push   %edi
+  8023e1:	56                   	push   %esi
+  8023e2:	53                   	push   %ebx
+  8023e3:	83 ec 08             	sub    $0x8,%esp
+  8023e6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8023ea:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8023ee:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023f2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023f6:	89 f9                	mov    %edi,%ecx
+  8023f8:	89 34 24             	mov    %esi,(%esp)
+  8023fb:	09 f1                	or     %esi,%ecx
+  8023fd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802401:	74 53                	je     802456 <__umoddi3+0x76>
+  802403:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802408:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80240f:	90                   	nop
+  802410:	89 c6                	mov    %eax,%esi
+  802412:	89 d7                	mov    %edx,%edi
+  802414:	31 db                	xor    %ebx,%ebx
+  802416:	d3 ef                	shr    %cl,%edi
+  802418:	0f ad d6             	shrd   %cl,%edx,%esi
+  80241b:	f6 c1 20             	test   $0x20,%cl
+  80241e:	0f 45 f7             	cmovne %edi,%esi
+  802421:	0f 45 fb             	cmovne %ebx,%edi
+  802424:	8b 1c 24             	mov    (%esp),%ebx
+  802427:	39 de                	cmp    %ebx,%esi
+  802429:	89 fb                	mov    %edi,%ebx
+  80242b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80242f:	8b 34 24             	mov    (%esp),%esi
+  802432:	19 fb                	sbb    %edi,%ebx
+  802434:	72 14                	jb     80244a <__umoddi3+0x6a>
+  802436:	0f a5 f7             	shld   %cl,%esi,%edi
+  802439:	31 db                	xor    %ebx,%ebx
+  80243b:	d3 e6                	shl    %cl,%esi
+  80243d:	f6 c1 20             	test   $0x20,%cl
+  802440:	0f 45 fe             	cmovne %esi,%edi
+  802443:	0f 45 f3             	cmovne %ebx,%esi
+  802446:	29 f0                	sub    %esi,%eax
+  802448:	19 fa                	sbb    %edi,%edx
+  80244a:	83 e9 01             	sub    $0x1,%ecx
+  80244d:	73 c1                	jae    802410 <__umoddi3+0x30>
+  80244f:	83 c4 08             	add    $0x8,%esp
+  802452:	5b                   	pop    %ebx
+  802453:	5e                   	pop    %esi
+  802454:	5f                   	pop    %edi
+  802455:	c3                   	ret
+  802456:	83 c4 08             	add    $0x8,%esp
+  802459:	31 c0                	xor    %eax,%eax
+  80245b:	31 d2                	xor    %edx,%edx
+  80245d:	5b                   	pop    %ebx
+  80245e:	5e                   	pop    %esi
+  80245f:	5f                   	pop    %edi
+  802460:	c3                   	ret
+  802461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802468:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80246f:	90                   	nop
+
+00802470 <__divdi3>:
+  802470:	55                   	push   %ebp
+  802471:	57                   	push   %edi
+  802472:	56                   	push   %esi
+  802473:	53                   	push   %ebx
+  802474:	83 ec 1c             	sub    $0x1c,%esp
+  802477:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80247b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80247f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802483:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802487:	85 ff                	test   %edi,%edi
+  802489:	0f 88 da 00 00 00    	js     802569 <__divdi3+0xf9>
+  80248f:	85 db                	test   %ebx,%ebx
+  802491:	78 16                	js     8024a9 <__divdi3+0x39>
+  802493:	89 dd                	mov    %ebx,%ebp
+  802495:	89 c8                	mov    %ecx,%eax
+  802497:	89 da                	mov    %ebx,%edx
+  802499:	09 cd                	or     %ecx,%ebp
+  80249b:	0f 85 fd 00 00 00    	jne    80259e <__divdi3+0x12e>
+  8024a1:	83 c4 1c             	add    $0x1c,%esp
+  8024a4:	5b                   	pop    %ebx
+  8024a5:	5e                   	pop    %esi
+  8024a6:	5f                   	pop    %edi
+  8024a7:	5d                   	pop    %ebp
+  8024a8:	c3                   	ret
+  8024a9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8024ae:	f7 d9                	neg    %ecx
+  8024b0:	89 f0                	mov    %esi,%eax
+  8024b2:	89 fa                	mov    %edi,%edx
+  8024b4:	83 d3 00             	adc    $0x0,%ebx
+  8024b7:	89 0c 24             	mov    %ecx,(%esp)
+  8024ba:	f7 db                	neg    %ebx
+  8024bc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8024c0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024c7:	00 
+  8024c8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024cd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024d4:	00 
+  8024d5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024d9:	89 cd                	mov    %ecx,%ebp
+  8024db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024df:	90                   	nop
+  8024e0:	89 e9                	mov    %ebp,%ecx
+  8024e2:	89 c3                	mov    %eax,%ebx
+  8024e4:	89 d6                	mov    %edx,%esi
+  8024e6:	31 ff                	xor    %edi,%edi
+  8024e8:	d3 ee                	shr    %cl,%esi
+  8024ea:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024ed:	f6 c1 20             	test   $0x20,%cl
+  8024f0:	0f 45 de             	cmovne %esi,%ebx
+  8024f3:	0f 45 f7             	cmovne %edi,%esi
+  8024f6:	8b 3c 24             	mov    (%esp),%edi
+  8024f9:	39 fb                	cmp    %edi,%ebx
+  8024fb:	89 f7                	mov    %esi,%edi
+  8024fd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802501:	8b 1c 24             	mov    (%esp),%ebx
+  802504:	19 f7                	sbb    %esi,%edi
+  802506:	72 39                	jb     802541 <__divdi3+0xd1>
+  802508:	89 e9                	mov    %ebp,%ecx
+  80250a:	89 f7                	mov    %esi,%edi
+  80250c:	89 de                	mov    %ebx,%esi
+  80250e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802511:	d3 e6                	shl    %cl,%esi
+  802513:	31 db                	xor    %ebx,%ebx
+  802515:	f6 c1 20             	test   $0x20,%cl
+  802518:	0f 45 fe             	cmovne %esi,%edi
+  80251b:	0f 45 f3             	cmovne %ebx,%esi
+  80251e:	29 f0                	sub    %esi,%eax
+  802520:	be 01 00 00 00       	mov    $0x1,%esi
+  802525:	19 fa                	sbb    %edi,%edx
+  802527:	31 ff                	xor    %edi,%edi
+  802529:	31 db                	xor    %ebx,%ebx
+  80252b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80252e:	d3 e6                	shl    %cl,%esi
+  802530:	f6 c1 20             	test   $0x20,%cl
+  802533:	0f 45 fe             	cmovne %esi,%edi
+  802536:	0f 45 f3             	cmovne %ebx,%esi
+  802539:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80253d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802541:	83 ed 01             	sub    $0x1,%ebp
+  802544:	73 9a                	jae    8024e0 <__divdi3+0x70>
+  802546:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80254a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80254e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802552:	85 ed                	test   %ebp,%ebp
+  802554:	0f 84 47 ff ff ff    	je     8024a1 <__divdi3+0x31>
+  80255a:	f7 d8                	neg    %eax
+  80255c:	83 d2 00             	adc    $0x0,%edx
+  80255f:	83 c4 1c             	add    $0x1c,%esp
+  802562:	5b                   	pop    %ebx
+  802563:	f7 da                	neg    %edx
+  802565:	5e                   	pop    %esi
+  802566:	5f                   	pop    %edi
+  802567:	5d                   	pop    %ebp
+  802568:	c3                   	ret
+  802569:	f7 de                	neg    %esi
+  80256b:	83 d7 00             	adc    $0x0,%edi
+  80256e:	f7 df                	neg    %edi
+  802570:	85 db                	test   %ebx,%ebx
+  802572:	78 23                	js     802597 <__divdi3+0x127>
+  802574:	89 dd                	mov    %ebx,%ebp
+  802576:	89 c8                	mov    %ecx,%eax
+  802578:	89 da                	mov    %ebx,%edx
+  80257a:	09 cd                	or     %ecx,%ebp
+  80257c:	0f 84 1f ff ff ff    	je     8024a1 <__divdi3+0x31>
+  802582:	89 0c 24             	mov    %ecx,(%esp)
+  802585:	89 f0                	mov    %esi,%eax
+  802587:	89 fa                	mov    %edi,%edx
+  802589:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80258e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802592:	e9 29 ff ff ff       	jmp    8024c0 <__divdi3+0x50>
+  802597:	31 ed                	xor    %ebp,%ebp
+  802599:	e9 10 ff ff ff       	jmp    8024ae <__divdi3+0x3e>
+  80259e:	89 0c 24             	mov    %ecx,(%esp)
+  8025a1:	89 f0                	mov    %esi,%eax
+  8025a3:	89 fa                	mov    %edi,%edx
+  8025a5:	31 ed                	xor    %ebp,%ebp
+  8025a7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8025ab:	e9 10 ff ff ff       	jmp    8024c0 <__divdi3+0x50>
+
+008025b0 <__moddi3>:
+  8025b0:	55                   	push   %ebp
+  8025b1:	57                   	push   %edi
+  8025b2:	56                   	push   %esi
+  8025b3:	53                   	push   %ebx
+  8025b4:	83 ec 14             	sub    $0x14,%esp
+  8025b7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025bb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025bf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8025c3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8025c7:	85 d2                	test   %edx,%edx
+  8025c9:	0f 88 9b 00 00 00    	js     80266a <__moddi3+0xba>
+  8025cf:	89 f7                	mov    %esi,%edi
+  8025d1:	31 ed                	xor    %ebp,%ebp
+  8025d3:	09 cf                	or     %ecx,%edi
+  8025d5:	0f 84 83 00 00 00    	je     80265e <__moddi3+0xae>
+  8025db:	89 cb                	mov    %ecx,%ebx
+  8025dd:	89 f7                	mov    %esi,%edi
+  8025df:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8025e3:	f7 db                	neg    %ebx
+  8025e5:	83 d7 00             	adc    $0x0,%edi
+  8025e8:	f7 df                	neg    %edi
+  8025ea:	0f 49 f7             	cmovns %edi,%esi
+  8025ed:	0f 49 cb             	cmovns %ebx,%ecx
+  8025f0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025f4:	89 0c 24             	mov    %ecx,(%esp)
+  8025f7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025fc:	89 cd                	mov    %ecx,%ebp
+  8025fe:	66 90                	xchg   %ax,%ax
+  802600:	89 e9                	mov    %ebp,%ecx
+  802602:	89 c3                	mov    %eax,%ebx
+  802604:	89 d6                	mov    %edx,%esi
+  802606:	31 ff                	xor    %edi,%edi
+  802608:	d3 ee                	shr    %cl,%esi
+  80260a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80260d:	f6 c1 20             	test   $0x20,%cl
+  802610:	0f 45 de             	cmovne %esi,%ebx
+  802613:	0f 45 f7             	cmovne %edi,%esi
+  802616:	8b 3c 24             	mov    (%esp),%edi
+  802619:	39 fb                	cmp    %edi,%ebx
+  80261b:	89 f7                	mov    %esi,%edi
+  80261d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802621:	8b 1c 24             	mov    (%esp),%ebx
+  802624:	19 f7                	sbb    %esi,%edi
+  802626:	72 1a                	jb     802642 <__moddi3+0x92>
+  802628:	89 e9                	mov    %ebp,%ecx
+  80262a:	89 f7                	mov    %esi,%edi
+  80262c:	89 de                	mov    %ebx,%esi
+  80262e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802631:	d3 e6                	shl    %cl,%esi
+  802633:	31 db                	xor    %ebx,%ebx
+  802635:	f6 c1 20             	test   $0x20,%cl
+  802638:	0f 45 fe             	cmovne %esi,%edi
+  80263b:	0f 45 f3             	cmovne %ebx,%esi
+  80263e:	29 f0                	sub    %esi,%eax
+  802640:	19 fa                	sbb    %edi,%edx
+  802642:	83 ed 01             	sub    $0x1,%ebp
+  802645:	73 b9                	jae    802600 <__moddi3+0x50>
+  802647:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80264b:	85 ed                	test   %ebp,%ebp
+  80264d:	74 07                	je     802656 <__moddi3+0xa6>
+  80264f:	f7 d8                	neg    %eax
+  802651:	83 d2 00             	adc    $0x0,%edx
+  802654:	f7 da                	neg    %edx
+  802656:	83 c4 14             	add    $0x14,%esp
+  802659:	5b                   	pop    %ebx
+  80265a:	5e                   	pop    %esi
+  80265b:	5f                   	pop    %edi
+  80265c:	5d                   	pop    %ebp
+  80265d:	c3                   	ret
+  80265e:	83 c4 14             	add    $0x14,%esp
+  802661:	31 c0                	xor    %eax,%eax
+  802663:	31 d2                	xor    %edx,%edx
+  802665:	5b                   	pop    %ebx
+  802666:	5e                   	pop    %esi
+  802667:	5f                   	pop    %edi
+  802668:	5d                   	pop    %ebp
+  802669:	c3                   	ret
+  80266a:	89 f7                	mov    %esi,%edi
+  80266c:	09 cf                	or     %ecx,%edi
+  80266e:	74 11                	je     802681 <__moddi3+0xd1>
+  802670:	f7 d8                	neg    %eax
+  802672:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802677:	83 d2 00             	adc    $0x0,%edx
+  80267a:	f7 da                	neg    %edx
+  80267c:	e9 5a ff ff ff       	jmp    8025db <__moddi3+0x2b>
+  802681:	31 c0                	xor    %eax,%eax
+  802683:	31 d2                	xor    %edx,%edx
+  802685:	eb c8                	jmp    80264f <__moddi3+0x9f>
@@ -0,0 +1,6745 @@
+
+obj/user/httpd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 7f 07 00 00       	call   8007b0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+	{404, "Not Found"},
+};
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 60 30 80 00       	push   $0x803060
+  80003f:	e8 a7 08 00 00       	call   8008eb <cprintf>
+	exit();
+  800044:	e8 ad 07 00 00       	call   8007f6 <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <send_error>:
+	return 0;
+}
+
+static int
+send_error(struct http_request *req, int code)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	81 ec 0c 02 00 00    	sub    $0x20c,%esp
+  80005a:	89 c3                	mov    %eax,%ebx
+	char buf[512];
+	int r;
+
+	struct error_messages *e = errors;
+  80005c:	b8 00 40 80 00       	mov    $0x804000,%eax
+	while (e->code != 0 && e->msg != 0) {
+  800061:	8b 08                	mov    (%eax),%ecx
+  800063:	85 c9                	test   %ecx,%ecx
+  800065:	74 0f                	je     800076 <send_error+0x28>
+		if (e->code == code)
+  800067:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  80006b:	74 10                	je     80007d <send_error+0x2f>
+  80006d:	39 d1                	cmp    %edx,%ecx
+  80006f:	74 0c                	je     80007d <send_error+0x2f>
+			break;
+		e++;
+  800071:	83 c0 08             	add    $0x8,%eax
+  800074:	eb eb                	jmp    800061 <send_error+0x13>
+	}
+
+	if (e->code == 0)
+		return -1;
+  800076:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80007b:	eb 3b                	jmp    8000b8 <send_error+0x6a>
+
+	r = snprintf(buf, 512, "HTTP/" HTTP_VERSION" %d %s\r\n"
+  80007d:	8b 40 04             	mov    0x4(%eax),%eax
+  800080:	83 ec 04             	sub    $0x4,%esp
+  800083:	50                   	push   %eax
+  800084:	51                   	push   %ecx
+  800085:	50                   	push   %eax
+  800086:	51                   	push   %ecx
+  800087:	68 00 31 80 00       	push   $0x803100
+  80008c:	68 00 02 00 00       	push   $0x200
+  800091:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+  800097:	57                   	push   %edi
+  800098:	e8 e7 0d 00 00       	call   800e84 <snprintf>
+  80009d:	89 c6                	mov    %eax,%esi
+			       "Content-type: text/html\r\n"
+			       "\r\n"
+			       "<html><body><p>%d - %s</p></body></html>\r\n",
+			       e->code, e->msg, e->code, e->msg);
+
+	if (write(req->sock, buf, r) != r)
+  80009f:	83 c4 1c             	add    $0x1c,%esp
+  8000a2:	50                   	push   %eax
+  8000a3:	57                   	push   %edi
+  8000a4:	ff 33                	push   (%ebx)
+  8000a6:	e8 71 1a 00 00       	call   801b1c <write>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	39 f0                	cmp    %esi,%eax
+  8000b0:	0f 95 c0             	setne  %al
+  8000b3:	0f b6 c0             	movzbl %al,%eax
+  8000b6:	f7 d8                	neg    %eax
+		return -1;
+
+	return 0;
+}
+  8000b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000bb:	5b                   	pop    %ebx
+  8000bc:	5e                   	pop    %esi
+  8000bd:	5f                   	pop    %edi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+
+008000c0 <handle_client>:
+	return r;
+}
+
+static void
+handle_client(int sock)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	57                   	push   %edi
+  8000c4:	56                   	push   %esi
+  8000c5:	53                   	push   %ebx
+  8000c6:	81 ec c0 04 00 00    	sub    $0x4c0,%esp
+  8000cc:	89 c6                	mov    %eax,%esi
+	struct http_request *req = &con_d;
+
+	while (1)
+	{
+		// Receive message
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  8000ce:	68 00 02 00 00       	push   $0x200
+  8000d3:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  8000d9:	50                   	push   %eax
+  8000da:	56                   	push   %esi
+  8000db:	e8 6e 19 00 00       	call   801a4e <read>
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	85 c0                	test   %eax,%eax
+  8000e5:	78 3c                	js     800123 <handle_client+0x63>
+			panic("failed to read");
+
+		memset(req, 0, sizeof(req));
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	6a 04                	push   $0x4
+  8000ec:	6a 00                	push   $0x0
+  8000ee:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8000f1:	50                   	push   %eax
+  8000f2:	e8 33 0f 00 00       	call   80102a <memset>
+
+		req->sock = sock;
+  8000f7:	89 75 dc             	mov    %esi,-0x24(%ebp)
+	if (strncmp(request, "GET ", 4) != 0)
+  8000fa:	83 c4 0c             	add    $0xc,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	68 80 30 80 00       	push   $0x803080
+  800104:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  80010a:	50                   	push   %eax
+  80010b:	e8 a0 0e 00 00       	call   800fb0 <strncmp>
+  800110:	83 c4 10             	add    $0x10,%esp
+  800113:	85 c0                	test   %eax,%eax
+  800115:	0f 85 82 01 00 00    	jne    80029d <handle_client+0x1dd>
+	request += 4;
+  80011b:	8d 9d e0 fd ff ff    	lea    -0x220(%ebp),%ebx
+  800121:	eb 1a                	jmp    80013d <handle_client+0x7d>
+			panic("failed to read");
+  800123:	83 ec 04             	sub    $0x4,%esp
+  800126:	68 64 30 80 00       	push   $0x803064
+  80012b:	68 1c 01 00 00       	push   $0x11c
+  800130:	68 73 30 80 00       	push   $0x803073
+  800135:	e8 d6 06 00 00       	call   800810 <_panic>
+		request++;
+  80013a:	83 c3 01             	add    $0x1,%ebx
+	while (*request && *request != ' ')
+  80013d:	f6 03 df             	testb  $0xdf,(%ebx)
+  800140:	75 f8                	jne    80013a <handle_client+0x7a>
+	url_len = request - url;
+  800142:	89 df                	mov    %ebx,%edi
+  800144:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+  80014a:	29 c7                	sub    %eax,%edi
+	req->url = malloc(url_len + 1);
+  80014c:	83 ec 0c             	sub    $0xc,%esp
+  80014f:	8d 47 01             	lea    0x1(%edi),%eax
+  800152:	50                   	push   %eax
+  800153:	e8 17 23 00 00       	call   80246f <malloc>
+  800158:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	memmove(req->url, url, url_len);
+  80015b:	83 c4 0c             	add    $0xc,%esp
+  80015e:	57                   	push   %edi
+  80015f:	8d 8d e0 fd ff ff    	lea    -0x220(%ebp),%ecx
+  800165:	51                   	push   %ecx
+  800166:	50                   	push   %eax
+  800167:	e8 f3 0e 00 00       	call   80105f <memmove>
+	req->url[url_len] = '\0';
+  80016c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80016f:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	request++;
+  800173:	83 c3 01             	add    $0x1,%ebx
+	while (*request && *request != '\n')
+  800176:	83 c4 10             	add    $0x10,%esp
+	request++;
+  800179:	89 d8                	mov    %ebx,%eax
+	while (*request && *request != '\n')
+  80017b:	eb 03                	jmp    800180 <handle_client+0xc0>
+		request++;
+  80017d:	83 c0 01             	add    $0x1,%eax
+	while (*request && *request != '\n')
+  800180:	0f b6 10             	movzbl (%eax),%edx
+  800183:	84 d2                	test   %dl,%dl
+  800185:	74 05                	je     80018c <handle_client+0xcc>
+  800187:	80 fa 0a             	cmp    $0xa,%dl
+  80018a:	75 f1                	jne    80017d <handle_client+0xbd>
+	version_len = request - version;
+  80018c:	29 d8                	sub    %ebx,%eax
+  80018e:	89 c7                	mov    %eax,%edi
+	req->version = malloc(version_len + 1);
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	8d 40 01             	lea    0x1(%eax),%eax
+  800196:	50                   	push   %eax
+  800197:	e8 d3 22 00 00       	call   80246f <malloc>
+  80019c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	memmove(req->version, version, version_len);
+  80019f:	83 c4 0c             	add    $0xc,%esp
+  8001a2:	57                   	push   %edi
+  8001a3:	53                   	push   %ebx
+  8001a4:	50                   	push   %eax
+  8001a5:	e8 b5 0e 00 00       	call   80105f <memmove>
+	req->version[version_len] = '\0';
+  8001aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8001ad:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	if ((r = open(req->url, O_RDONLY)) < 0) {
+  8001b1:	83 c4 08             	add    $0x8,%esp
+  8001b4:	6a 00                	push   $0x0
+  8001b6:	ff 75 e0             	push   -0x20(%ebp)
+  8001b9:	e8 f3 1c 00 00       	call   801eb1 <open>
+  8001be:	89 c7                	mov    %eax,%edi
+  8001c0:	83 c4 10             	add    $0x10,%esp
+  8001c3:	85 c0                	test   %eax,%eax
+  8001c5:	78 51                	js     800218 <handle_client+0x158>
+	if ((r = fstat(fd, &st)) < 0)
+  8001c7:	83 ec 08             	sub    $0x8,%esp
+  8001ca:	8d 85 50 fb ff ff    	lea    -0x4b0(%ebp),%eax
+  8001d0:	50                   	push   %eax
+  8001d1:	57                   	push   %edi
+  8001d2:	e8 6f 1a 00 00       	call   801c46 <fstat>
+  8001d7:	83 c4 10             	add    $0x10,%esp
+  8001da:	85 c0                	test   %eax,%eax
+  8001dc:	78 56                	js     800234 <handle_client+0x174>
+	if (st.st_isdir) {
+  8001de:	83 bd d4 fb ff ff 00 	cmpl   $0x0,-0x42c(%ebp)
+  8001e5:	75 40                	jne    800227 <handle_client+0x167>
+	file_size = st.st_size;
+  8001e7:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+  8001ed:	89 85 40 fb ff ff    	mov    %eax,-0x4c0(%ebp)
+	struct responce_header *h = headers;
+  8001f3:	bb 10 40 80 00       	mov    $0x804010,%ebx
+	while (h->code != 0 && h->header!= 0) {
+  8001f8:	8b 03                	mov    (%ebx),%eax
+  8001fa:	85 c0                	test   %eax,%eax
+  8001fc:	74 36                	je     800234 <handle_client+0x174>
+		if (h->code == code)
+  8001fe:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  800202:	0f 84 a4 00 00 00    	je     8002ac <handle_client+0x1ec>
+  800208:	3d c8 00 00 00       	cmp    $0xc8,%eax
+  80020d:	0f 84 99 00 00 00    	je     8002ac <handle_client+0x1ec>
+		h++;
+  800213:	83 c3 08             	add    $0x8,%ebx
+  800216:	eb e0                	jmp    8001f8 <handle_client+0x138>
+		send_error(req, 404);
+  800218:	ba 94 01 00 00       	mov    $0x194,%edx
+  80021d:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800220:	e8 29 fe ff ff       	call   80004e <send_error>
+		return r;
+  800225:	eb 19                	jmp    800240 <handle_client+0x180>
+		send_error(req, 404);
+  800227:	ba 94 01 00 00       	mov    $0x194,%edx
+  80022c:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80022f:	e8 1a fe ff ff       	call   80004e <send_error>
+	close(fd);
+  800234:	83 ec 0c             	sub    $0xc,%esp
+  800237:	57                   	push   %edi
+  800238:	e8 d5 16 00 00       	call   801912 <close>
+	return r;
+  80023d:	83 c4 10             	add    $0x10,%esp
+	free(req->url);
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  800243:	ff 75 e0             	push   -0x20(%ebp)
+  800246:	e8 73 21 00 00       	call   8023be <free>
+	free(req->version);
+  80024b:	83 c4 04             	add    $0x4,%esp
+  80024e:	ff 75 e4             	push   -0x1c(%ebp)
+  800251:	e8 68 21 00 00       	call   8023be <free>
+
+		// no keep alive
+		break;
+	}
+
+	close(sock);
+  800256:	89 34 24             	mov    %esi,(%esp)
+  800259:	e8 b4 16 00 00       	call   801912 <close>
+}
+  80025e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800261:	5b                   	pop    %ebx
+  800262:	5e                   	pop    %esi
+  800263:	5f                   	pop    %edi
+  800264:	5d                   	pop    %ebp
+  800265:	c3                   	ret
+		die("Failed to send bytes to client");
+  800266:	b8 7c 31 80 00       	mov    $0x80317c,%eax
+  80026b:	e8 c3 fd ff ff       	call   800033 <die>
+  800270:	eb 65                	jmp    8002d7 <handle_client+0x217>
+		panic("buffer too small!");
+  800272:	83 ec 04             	sub    $0x4,%esp
+  800275:	68 85 30 80 00       	push   $0x803085
+  80027a:	6a 64                	push   $0x64
+  80027c:	68 73 30 80 00       	push   $0x803073
+  800281:	e8 8a 05 00 00       	call   800810 <_panic>
+		panic("buffer too small!");
+  800286:	83 ec 04             	sub    $0x4,%esp
+  800289:	68 85 30 80 00       	push   $0x803085
+  80028e:	68 80 00 00 00       	push   $0x80
+  800293:	68 73 30 80 00       	push   $0x803073
+  800298:	e8 73 05 00 00       	call   800810 <_panic>
+			send_error(req, 400);
+  80029d:	ba 90 01 00 00       	mov    $0x190,%edx
+  8002a2:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8002a5:	e8 a4 fd ff ff       	call   80004e <send_error>
+  8002aa:	eb 94                	jmp    800240 <handle_client+0x180>
+	int len = strlen(h->header);
+  8002ac:	83 ec 0c             	sub    $0xc,%esp
+  8002af:	ff 73 04             	push   0x4(%ebx)
+  8002b2:	e8 e7 0b 00 00       	call   800e9e <strlen>
+	if (write(req->sock, h->header, len) != len) {
+  8002b7:	83 c4 0c             	add    $0xc,%esp
+  8002ba:	89 85 44 fb ff ff    	mov    %eax,-0x4bc(%ebp)
+  8002c0:	50                   	push   %eax
+  8002c1:	ff 73 04             	push   0x4(%ebx)
+  8002c4:	ff 75 dc             	push   -0x24(%ebp)
+  8002c7:	e8 50 18 00 00       	call   801b1c <write>
+  8002cc:	83 c4 10             	add    $0x10,%esp
+  8002cf:	39 85 44 fb ff ff    	cmp    %eax,-0x4bc(%ebp)
+  8002d5:	75 8f                	jne    800266 <handle_client+0x1a6>
+	r = snprintf(buf, 64, "Content-Length: %ld\r\n", (long)size);
+  8002d7:	ff b5 40 fb ff ff    	push   -0x4c0(%ebp)
+  8002dd:	68 b4 30 80 00       	push   $0x8030b4
+  8002e2:	6a 40                	push   $0x40
+  8002e4:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8002ea:	50                   	push   %eax
+  8002eb:	e8 94 0b 00 00       	call   800e84 <snprintf>
+  8002f0:	89 c3                	mov    %eax,%ebx
+	if (r > 63)
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	83 f8 3f             	cmp    $0x3f,%eax
+  8002f8:	0f 8f 74 ff ff ff    	jg     800272 <handle_client+0x1b2>
+	if (write(req->sock, buf, r) != r)
+  8002fe:	83 ec 04             	sub    $0x4,%esp
+  800301:	53                   	push   %ebx
+  800302:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  800308:	50                   	push   %eax
+  800309:	ff 75 dc             	push   -0x24(%ebp)
+  80030c:	e8 0b 18 00 00       	call   801b1c <write>
+	if ((r = send_size(req, file_size)) < 0)
+  800311:	83 c4 10             	add    $0x10,%esp
+  800314:	39 c3                	cmp    %eax,%ebx
+  800316:	0f 85 18 ff ff ff    	jne    800234 <handle_client+0x174>
+	r = snprintf(buf, 128, "Content-Type: %s\r\n", type);
+  80031c:	68 97 30 80 00       	push   $0x803097
+  800321:	68 a1 30 80 00       	push   $0x8030a1
+  800326:	68 80 00 00 00       	push   $0x80
+  80032b:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  800331:	50                   	push   %eax
+  800332:	e8 4d 0b 00 00       	call   800e84 <snprintf>
+  800337:	89 c3                	mov    %eax,%ebx
+	if (r > 127)
+  800339:	83 c4 10             	add    $0x10,%esp
+  80033c:	83 f8 7f             	cmp    $0x7f,%eax
+  80033f:	0f 8f 41 ff ff ff    	jg     800286 <handle_client+0x1c6>
+	if (write(req->sock, buf, r) != r)
+  800345:	83 ec 04             	sub    $0x4,%esp
+  800348:	50                   	push   %eax
+  800349:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  80034f:	50                   	push   %eax
+  800350:	ff 75 dc             	push   -0x24(%ebp)
+  800353:	e8 c4 17 00 00       	call   801b1c <write>
+	if ((r = send_content_type(req)) < 0)
+  800358:	83 c4 10             	add    $0x10,%esp
+  80035b:	39 c3                	cmp    %eax,%ebx
+  80035d:	0f 85 d1 fe ff ff    	jne    800234 <handle_client+0x174>
+	int fin_len = strlen(fin);
+  800363:	83 ec 0c             	sub    $0xc,%esp
+  800366:	68 c7 30 80 00       	push   $0x8030c7
+  80036b:	e8 2e 0b 00 00       	call   800e9e <strlen>
+  800370:	89 c3                	mov    %eax,%ebx
+	if (write(req->sock, fin, fin_len) != fin_len)
+  800372:	83 c4 0c             	add    $0xc,%esp
+  800375:	50                   	push   %eax
+  800376:	68 c7 30 80 00       	push   $0x8030c7
+  80037b:	ff 75 dc             	push   -0x24(%ebp)
+  80037e:	e8 99 17 00 00       	call   801b1c <write>
+	if ((r = send_header_fin(req)) < 0)
+  800383:	83 c4 10             	add    $0x10,%esp
+  800386:	39 c3                	cmp    %eax,%ebx
+  800388:	0f 85 a6 fe ff ff    	jne    800234 <handle_client+0x174>
+		if ((r = read(fd, buffer, BUFFSIZE)) < 0)
+  80038e:	8d 9d dc fb ff ff    	lea    -0x424(%ebp),%ebx
+  800394:	83 ec 04             	sub    $0x4,%esp
+  800397:	68 00 02 00 00       	push   $0x200
+  80039c:	53                   	push   %ebx
+  80039d:	57                   	push   %edi
+  80039e:	e8 ab 16 00 00       	call   801a4e <read>
+  8003a3:	83 c4 10             	add    $0x10,%esp
+  8003a6:	85 c0                	test   %eax,%eax
+  8003a8:	0f 88 86 fe ff ff    	js     800234 <handle_client+0x174>
+		if ((r = write(req->sock, buffer, r) < 0))
+  8003ae:	83 ec 04             	sub    $0x4,%esp
+  8003b1:	50                   	push   %eax
+  8003b2:	53                   	push   %ebx
+  8003b3:	ff 75 dc             	push   -0x24(%ebp)
+  8003b6:	e8 61 17 00 00       	call   801b1c <write>
+  8003bb:	83 c4 10             	add    $0x10,%esp
+  8003be:	85 c0                	test   %eax,%eax
+  8003c0:	79 d2                	jns    800394 <handle_client+0x2d4>
+  8003c2:	e9 6d fe ff ff       	jmp    800234 <handle_client+0x174>
+
+008003c7 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8003c7:	55                   	push   %ebp
+  8003c8:	89 e5                	mov    %esp,%ebp
+  8003ca:	57                   	push   %edi
+  8003cb:	56                   	push   %esi
+  8003cc:	53                   	push   %ebx
+  8003cd:	83 ec 40             	sub    $0x40,%esp
+	int serversock, clientsock;
+	struct sockaddr_in server, client;
+
+	binaryname = "jhttpd";
+  8003d0:	c7 05 20 40 80 00 ca 	movl   $0x8030ca,0x804020
+  8003d7:	30 80 00 
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  8003da:	6a 06                	push   $0x6
+  8003dc:	6a 01                	push   $0x1
+  8003de:	6a 02                	push   $0x2
+  8003e0:	e8 5a 1d 00 00       	call   80213f <socket>
+  8003e5:	89 c6                	mov    %eax,%esi
+  8003e7:	83 c4 10             	add    $0x10,%esp
+  8003ea:	85 c0                	test   %eax,%eax
+  8003ec:	78 6d                	js     80045b <umain+0x94>
+		die("Failed to create socket");
+
+	// Construct the server sockaddr_in structure
+	memset(&server, 0, sizeof(server));		// Clear struct
+  8003ee:	83 ec 04             	sub    $0x4,%esp
+  8003f1:	6a 10                	push   $0x10
+  8003f3:	6a 00                	push   $0x0
+  8003f5:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8003f8:	53                   	push   %ebx
+  8003f9:	e8 2c 0c 00 00       	call   80102a <memset>
+	server.sin_family = AF_INET;			// Internet/IP
+  8003fe:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	server.sin_addr.s_addr = htonl(INADDR_ANY);	// IP address
+  800402:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800409:	e8 64 01 00 00       	call   800572 <htonl>
+  80040e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	server.sin_port = htons(PORT);			// server port
+  800411:	c7 04 24 50 00 00 00 	movl   $0x50,(%esp)
+  800418:	e8 3b 01 00 00       	call   800558 <htons>
+  80041d:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &server,
+  800421:	83 c4 0c             	add    $0xc,%esp
+  800424:	6a 10                	push   $0x10
+  800426:	53                   	push   %ebx
+  800427:	56                   	push   %esi
+  800428:	e8 80 1c 00 00       	call   8020ad <bind>
+  80042d:	83 c4 10             	add    $0x10,%esp
+  800430:	85 c0                	test   %eax,%eax
+  800432:	78 33                	js     800467 <umain+0xa0>
+	{
+		die("Failed to bind the server socket");
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  800434:	83 ec 08             	sub    $0x8,%esp
+  800437:	6a 05                	push   $0x5
+  800439:	56                   	push   %esi
+  80043a:	e8 dd 1c 00 00       	call   80211c <listen>
+  80043f:	83 c4 10             	add    $0x10,%esp
+  800442:	85 c0                	test   %eax,%eax
+  800444:	78 2d                	js     800473 <umain+0xac>
+		die("Failed to listen on server socket");
+
+	cprintf("Waiting for http connections...\n");
+  800446:	83 ec 0c             	sub    $0xc,%esp
+  800449:	68 e4 31 80 00       	push   $0x8031e4
+  80044e:	e8 98 04 00 00       	call   8008eb <cprintf>
+  800453:	83 c4 10             	add    $0x10,%esp
+
+	while (1) {
+		unsigned int clientlen = sizeof(client);
+		// Wait for client connection
+		if ((clientsock = accept(serversock,
+  800456:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  800459:	eb 35                	jmp    800490 <umain+0xc9>
+		die("Failed to create socket");
+  80045b:	b8 d1 30 80 00       	mov    $0x8030d1,%eax
+  800460:	e8 ce fb ff ff       	call   800033 <die>
+  800465:	eb 87                	jmp    8003ee <umain+0x27>
+		die("Failed to bind the server socket");
+  800467:	b8 9c 31 80 00       	mov    $0x80319c,%eax
+  80046c:	e8 c2 fb ff ff       	call   800033 <die>
+  800471:	eb c1                	jmp    800434 <umain+0x6d>
+		die("Failed to listen on server socket");
+  800473:	b8 c0 31 80 00       	mov    $0x8031c0,%eax
+  800478:	e8 b6 fb ff ff       	call   800033 <die>
+  80047d:	eb c7                	jmp    800446 <umain+0x7f>
+					 (struct sockaddr *) &client,
+					 &clientlen)) < 0)
+		{
+			die("Failed to accept client connection");
+  80047f:	b8 08 32 80 00       	mov    $0x803208,%eax
+  800484:	e8 aa fb ff ff       	call   800033 <die>
+		}
+		handle_client(clientsock);
+  800489:	89 d8                	mov    %ebx,%eax
+  80048b:	e8 30 fc ff ff       	call   8000c0 <handle_client>
+		unsigned int clientlen = sizeof(client);
+  800490:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+		if ((clientsock = accept(serversock,
+  800497:	83 ec 04             	sub    $0x4,%esp
+  80049a:	57                   	push   %edi
+  80049b:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80049e:	50                   	push   %eax
+  80049f:	56                   	push   %esi
+  8004a0:	e8 d9 1b 00 00       	call   80207e <accept>
+  8004a5:	89 c3                	mov    %eax,%ebx
+  8004a7:	83 c4 10             	add    $0x10,%esp
+  8004aa:	85 c0                	test   %eax,%eax
+  8004ac:	78 d1                	js     80047f <umain+0xb8>
+  8004ae:	eb d9                	jmp    800489 <umain+0xc2>
+
+008004b0 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8004b0:	55                   	push   %ebp
+  8004b1:	89 e5                	mov    %esp,%ebp
+  8004b3:	57                   	push   %edi
+  8004b4:	56                   	push   %esi
+  8004b5:	53                   	push   %ebx
+  8004b6:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8004b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004bc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8004bf:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  8004c2:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  8004c7:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  8004cc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004cf:	eb 31                	jmp    800502 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  8004d1:	0f b6 c8             	movzbl %al,%ecx
+  8004d4:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  8004d9:	88 0a                	mov    %cl,(%edx)
+  8004db:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  8004de:	83 e8 01             	sub    $0x1,%eax
+  8004e1:	3c ff                	cmp    $0xff,%al
+  8004e3:	75 ec                	jne    8004d1 <inet_ntoa+0x21>
+  8004e5:	0f b6 db             	movzbl %bl,%ebx
+  8004e8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8004eb:	01 d8                	add    %ebx,%eax
+  8004ed:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  8004ef:	8d 40 01             	lea    0x1(%eax),%eax
+  8004f2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8004f5:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  8004f8:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  8004fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004fe:	39 c7                	cmp    %eax,%edi
+  800500:	74 46                	je     800548 <inet_ntoa+0x98>
+  800502:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800505:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80050a:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  80050d:	89 f0                	mov    %esi,%eax
+  80050f:	f6 e2                	mul    %dl
+  800511:	66 c1 e8 0b          	shr    $0xb,%ax
+  800515:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  800518:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  80051b:	01 c9                	add    %ecx,%ecx
+  80051d:	89 d0                	mov    %edx,%eax
+  80051f:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800521:	89 d7                	mov    %edx,%edi
+  800523:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800527:	89 d9                	mov    %ebx,%ecx
+  800529:	83 c3 01             	add    $0x1,%ebx
+  80052c:	0f b6 c9             	movzbl %cl,%ecx
+  80052f:	83 c0 30             	add    $0x30,%eax
+  800532:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  800536:	89 f8                	mov    %edi,%eax
+  800538:	3c 09                	cmp    $0x9,%al
+  80053a:	77 d1                	ja     80050d <inet_ntoa+0x5d>
+  80053c:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80053f:	88 17                	mov    %dl,(%edi)
+  800541:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800544:	89 d8                	mov    %ebx,%eax
+  800546:	eb 96                	jmp    8004de <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  800548:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  80054b:	b8 00 50 80 00       	mov    $0x805000,%eax
+  800550:	83 c4 1c             	add    $0x1c,%esp
+  800553:	5b                   	pop    %ebx
+  800554:	5e                   	pop    %esi
+  800555:	5f                   	pop    %edi
+  800556:	5d                   	pop    %ebp
+  800557:	c3                   	ret
+
+00800558 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  800558:	55                   	push   %ebp
+  800559:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80055b:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80055f:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  800563:	5d                   	pop    %ebp
+  800564:	c3                   	ret
+
+00800565 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  800565:	55                   	push   %ebp
+  800566:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  800568:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80056c:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  800570:	5d                   	pop    %ebp
+  800571:	c3                   	ret
+
+00800572 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  800572:	55                   	push   %ebp
+  800573:	89 e5                	mov    %esp,%ebp
+  800575:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  800578:	89 d0                	mov    %edx,%eax
+  80057a:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  80057d:	89 d1                	mov    %edx,%ecx
+  80057f:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  800582:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  800584:	89 d1                	mov    %edx,%ecx
+  800586:	c1 e1 08             	shl    $0x8,%ecx
+  800589:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  80058f:	09 c8                	or     %ecx,%eax
+  800591:	c1 ea 08             	shr    $0x8,%edx
+  800594:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  80059a:	09 d0                	or     %edx,%eax
+}
+  80059c:	5d                   	pop    %ebp
+  80059d:	c3                   	ret
+
+0080059e <inet_aton>:
+{
+  80059e:	55                   	push   %ebp
+  80059f:	89 e5                	mov    %esp,%ebp
+  8005a1:	57                   	push   %edi
+  8005a2:	56                   	push   %esi
+  8005a3:	53                   	push   %ebx
+  8005a4:	83 ec 2c             	sub    $0x2c,%esp
+  8005a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8005aa:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8005ad:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8005b0:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8005b3:	e9 9b 00 00 00       	jmp    800653 <inet_aton+0xb5>
+      c = *++cp;
+  8005b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8005bc:	89 c1                	mov    %eax,%ecx
+  8005be:	83 e1 df             	and    $0xffffffdf,%ecx
+  8005c1:	80 f9 58             	cmp    $0x58,%cl
+  8005c4:	74 10                	je     8005d6 <inet_aton+0x38>
+      c = *++cp;
+  8005c6:	83 c2 01             	add    $0x1,%edx
+  8005c9:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  8005cc:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005d1:	e9 97 00 00 00       	jmp    80066d <inet_aton+0xcf>
+        c = *++cp;
+  8005d6:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  8005da:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  8005dd:	bf 10 00 00 00       	mov    $0x10,%edi
+  8005e2:	e9 86 00 00 00       	jmp    80066d <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  8005e7:	0f af d7             	imul   %edi,%edx
+  8005ea:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  8005ee:	0f be 01             	movsbl (%ecx),%eax
+  8005f1:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  8005f4:	88 45 d7             	mov    %al,-0x29(%ebp)
+  8005f7:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  8005fa:	80 fb 09             	cmp    $0x9,%bl
+  8005fd:	76 e8                	jbe    8005e7 <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  8005ff:	83 ff 10             	cmp    $0x10,%edi
+  800602:	75 2e                	jne    800632 <inet_aton+0x94>
+  800604:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  800608:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80060b:	83 e3 df             	and    $0xffffffdf,%ebx
+  80060e:	83 eb 41             	sub    $0x41,%ebx
+  800611:	80 fb 05             	cmp    $0x5,%bl
+  800614:	77 1c                	ja     800632 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800616:	c1 e2 04             	shl    $0x4,%edx
+  800619:	83 c0 0a             	add    $0xa,%eax
+  80061c:	89 f3                	mov    %esi,%ebx
+  80061e:	80 fb 1a             	cmp    $0x1a,%bl
+  800621:	19 db                	sbb    %ebx,%ebx
+  800623:	83 e3 20             	and    $0x20,%ebx
+  800626:	83 c3 41             	add    $0x41,%ebx
+  800629:	29 d8                	sub    %ebx,%eax
+  80062b:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  80062d:	0f be 01             	movsbl (%ecx),%eax
+  800630:	eb bf                	jmp    8005f1 <inet_aton+0x53>
+    if (c == '.') {
+  800632:	83 f8 2e             	cmp    $0x2e,%eax
+  800635:	75 43                	jne    80067a <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  800637:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80063a:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80063d:	39 f0                	cmp    %esi,%eax
+  80063f:	0f 84 22 01 00 00    	je     800767 <inet_aton+0x1c9>
+      *pp++ = val;
+  800645:	83 c0 04             	add    $0x4,%eax
+  800648:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80064b:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  80064e:	89 ca                	mov    %ecx,%edx
+  800650:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  800653:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800656:	80 f9 09             	cmp    $0x9,%cl
+  800659:	0f 87 01 01 00 00    	ja     800760 <inet_aton+0x1c2>
+    base = 10;
+  80065f:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  800664:	83 f8 30             	cmp    $0x30,%eax
+  800667:	0f 84 4b ff ff ff    	je     8005b8 <inet_aton+0x1a>
+  80066d:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  800670:	ba 00 00 00 00       	mov    $0x0,%edx
+  800675:	e9 7a ff ff ff       	jmp    8005f4 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80067a:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  80067e:	89 d6                	mov    %edx,%esi
+  800680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  800683:	85 c0                	test   %eax,%eax
+  800685:	74 2e                	je     8006b5 <inet_aton+0x117>
+    return (0);
+  800687:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80068c:	89 fa                	mov    %edi,%edx
+  80068e:	80 fa 1f             	cmp    $0x1f,%dl
+  800691:	0f 86 d5 00 00 00    	jbe    80076c <inet_aton+0x1ce>
+  800697:	84 c0                	test   %al,%al
+  800699:	0f 88 cd 00 00 00    	js     80076c <inet_aton+0x1ce>
+  80069f:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8006a2:	83 f9 04             	cmp    $0x4,%ecx
+  8006a5:	76 0e                	jbe    8006b5 <inet_aton+0x117>
+    return (0);
+  8006a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8006ac:	83 f8 20             	cmp    $0x20,%eax
+  8006af:	0f 85 b7 00 00 00    	jne    80076c <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8006b5:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8006b8:	89 d8                	mov    %ebx,%eax
+  8006ba:	29 c8                	sub    %ecx,%eax
+  8006bc:	c1 f8 02             	sar    $0x2,%eax
+  8006bf:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  8006c2:	83 f8 02             	cmp    $0x2,%eax
+  8006c5:	74 7a                	je     800741 <inet_aton+0x1a3>
+  8006c7:	83 f9 03             	cmp    $0x3,%ecx
+  8006ca:	7f 49                	jg     800715 <inet_aton+0x177>
+  8006cc:	85 c9                	test   %ecx,%ecx
+  8006ce:	0f 84 98 00 00 00    	je     80076c <inet_aton+0x1ce>
+  8006d4:	83 f9 02             	cmp    $0x2,%ecx
+  8006d7:	75 19                	jne    8006f2 <inet_aton+0x154>
+      return (0);
+  8006d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  8006de:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  8006e4:	0f 87 82 00 00 00    	ja     80076c <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  8006ea:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8006ed:	c1 e0 18             	shl    $0x18,%eax
+  8006f0:	09 c6                	or     %eax,%esi
+  return (1);
+  8006f2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  8006f7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8006fb:	74 6f                	je     80076c <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  8006fd:	83 ec 0c             	sub    $0xc,%esp
+  800700:	56                   	push   %esi
+  800701:	e8 6c fe ff ff       	call   800572 <htonl>
+  800706:	83 c4 10             	add    $0x10,%esp
+  800709:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80070c:	89 06                	mov    %eax,(%esi)
+  return (1);
+  80070e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800713:	eb 57                	jmp    80076c <inet_aton+0x1ce>
+  switch (n) {
+  800715:	83 f9 04             	cmp    $0x4,%ecx
+  800718:	75 d8                	jne    8006f2 <inet_aton+0x154>
+      return (0);
+  80071a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  80071f:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800725:	77 45                	ja     80076c <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  800727:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80072a:	c1 e0 18             	shl    $0x18,%eax
+  80072d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800730:	c1 e1 10             	shl    $0x10,%ecx
+  800733:	09 c8                	or     %ecx,%eax
+  800735:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800738:	c1 e1 08             	shl    $0x8,%ecx
+  80073b:	09 c8                	or     %ecx,%eax
+  80073d:	09 c6                	or     %eax,%esi
+    break;
+  80073f:	eb b1                	jmp    8006f2 <inet_aton+0x154>
+      return (0);
+  800741:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  800746:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  80074c:	77 1e                	ja     80076c <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  80074e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800751:	c1 e0 18             	shl    $0x18,%eax
+  800754:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800757:	c1 e1 10             	shl    $0x10,%ecx
+  80075a:	09 c8                	or     %ecx,%eax
+  80075c:	09 c6                	or     %eax,%esi
+    break;
+  80075e:	eb 92                	jmp    8006f2 <inet_aton+0x154>
+      return (0);
+  800760:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800765:	eb 05                	jmp    80076c <inet_aton+0x1ce>
+        return (0);
+  800767:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  80076c:	89 c8                	mov    %ecx,%eax
+  80076e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800771:	5b                   	pop    %ebx
+  800772:	5e                   	pop    %esi
+  800773:	5f                   	pop    %edi
+  800774:	5d                   	pop    %ebp
+  800775:	c3                   	ret
+
+00800776 <inet_addr>:
+{
+  800776:	55                   	push   %ebp
+  800777:	89 e5                	mov    %esp,%ebp
+  800779:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  80077c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80077f:	50                   	push   %eax
+  800780:	ff 75 08             	push   0x8(%ebp)
+  800783:	e8 16 fe ff ff       	call   80059e <inet_aton>
+  800788:	89 c2                	mov    %eax,%edx
+  80078a:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  80078d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  800792:	85 d2                	test   %edx,%edx
+  800794:	75 02                	jne    800798 <inet_addr+0x22>
+}
+  800796:	c9                   	leave
+  800797:	c3                   	ret
+    return (val.s_addr);
+  800798:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80079b:	eb f9                	jmp    800796 <inet_addr+0x20>
+
+0080079d <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  80079d:	55                   	push   %ebp
+  80079e:	89 e5                	mov    %esp,%ebp
+  8007a0:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8007a3:	ff 75 08             	push   0x8(%ebp)
+  8007a6:	e8 c7 fd ff ff       	call   800572 <htonl>
+  8007ab:	83 c4 10             	add    $0x10,%esp
+}
+  8007ae:	c9                   	leave
+  8007af:	c3                   	ret
+
+008007b0 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	56                   	push   %esi
+  8007b4:	53                   	push   %ebx
+  8007b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8007b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8007bb:	e8 e7 0a 00 00       	call   8012a7 <sys_getenvid>
+  8007c0:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8007c5:	c1 e0 09             	shl    $0x9,%eax
+  8007c8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8007cd:	a3 1c 50 80 00       	mov    %eax,0x80501c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8007d2:	85 db                	test   %ebx,%ebx
+  8007d4:	7e 07                	jle    8007dd <libmain+0x2d>
+		binaryname = argv[0];
+  8007d6:	8b 06                	mov    (%esi),%eax
+  8007d8:	a3 20 40 80 00       	mov    %eax,0x804020
+
+	// call user main routine
+	umain(argc, argv);
+  8007dd:	83 ec 08             	sub    $0x8,%esp
+  8007e0:	56                   	push   %esi
+  8007e1:	53                   	push   %ebx
+  8007e2:	e8 e0 fb ff ff       	call   8003c7 <umain>
+
+	// exit gracefully
+	exit();
+  8007e7:	e8 0a 00 00 00       	call   8007f6 <exit>
+}
+  8007ec:	83 c4 10             	add    $0x10,%esp
+  8007ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8007f2:	5b                   	pop    %ebx
+  8007f3:	5e                   	pop    %esi
+  8007f4:	5d                   	pop    %ebp
+  8007f5:	c3                   	ret
+
+008007f6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8007f6:	55                   	push   %ebp
+  8007f7:	89 e5                	mov    %esp,%ebp
+  8007f9:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8007fc:	e8 3e 11 00 00       	call   80193f <close_all>
+	sys_env_destroy(0);
+  800801:	83 ec 0c             	sub    $0xc,%esp
+  800804:	6a 00                	push   $0x0
+  800806:	e8 5b 0a 00 00       	call   801266 <sys_env_destroy>
+}
+  80080b:	83 c4 10             	add    $0x10,%esp
+  80080e:	c9                   	leave
+  80080f:	c3                   	ret
+
+00800810 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800810:	55                   	push   %ebp
+  800811:	89 e5                	mov    %esp,%ebp
+  800813:	56                   	push   %esi
+  800814:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800815:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800818:	8b 35 20 40 80 00    	mov    0x804020,%esi
+  80081e:	e8 84 0a 00 00       	call   8012a7 <sys_getenvid>
+  800823:	83 ec 0c             	sub    $0xc,%esp
+  800826:	ff 75 0c             	push   0xc(%ebp)
+  800829:	ff 75 08             	push   0x8(%ebp)
+  80082c:	56                   	push   %esi
+  80082d:	50                   	push   %eax
+  80082e:	68 5c 32 80 00       	push   $0x80325c
+  800833:	e8 b3 00 00 00       	call   8008eb <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800838:	83 c4 18             	add    $0x18,%esp
+  80083b:	53                   	push   %ebx
+  80083c:	ff 75 10             	push   0x10(%ebp)
+  80083f:	e8 56 00 00 00       	call   80089a <vcprintf>
+	cprintf("\n");
+  800844:	c7 04 24 c8 30 80 00 	movl   $0x8030c8,(%esp)
+  80084b:	e8 9b 00 00 00       	call   8008eb <cprintf>
+  800850:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800853:	cc                   	int3
+	while (1)
+  800854:	eb fd                	jmp    800853 <_panic+0x43>
+
+00800856 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800856:	55                   	push   %ebp
+  800857:	89 e5                	mov    %esp,%ebp
+  800859:	53                   	push   %ebx
+  80085a:	83 ec 04             	sub    $0x4,%esp
+  80085d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800860:	8b 13                	mov    (%ebx),%edx
+  800862:	8d 42 01             	lea    0x1(%edx),%eax
+  800865:	89 03                	mov    %eax,(%ebx)
+  800867:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80086a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80086e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800873:	74 09                	je     80087e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800875:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800879:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80087c:	c9                   	leave
+  80087d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80087e:	83 ec 08             	sub    $0x8,%esp
+  800881:	68 ff 00 00 00       	push   $0xff
+  800886:	8d 43 08             	lea    0x8(%ebx),%eax
+  800889:	50                   	push   %eax
+  80088a:	e8 7a 09 00 00       	call   801209 <sys_cputs>
+		b->idx = 0;
+  80088f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800895:	83 c4 10             	add    $0x10,%esp
+  800898:	eb db                	jmp    800875 <putch+0x1f>
+
+0080089a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80089a:	55                   	push   %ebp
+  80089b:	89 e5                	mov    %esp,%ebp
+  80089d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8008a3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8008aa:	00 00 00 
+	b.cnt = 0;
+  8008ad:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8008b4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8008b7:	ff 75 0c             	push   0xc(%ebp)
+  8008ba:	ff 75 08             	push   0x8(%ebp)
+  8008bd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8008c3:	50                   	push   %eax
+  8008c4:	68 56 08 80 00       	push   $0x800856
+  8008c9:	e8 14 01 00 00       	call   8009e2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8008ce:	83 c4 08             	add    $0x8,%esp
+  8008d1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8008d7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8008dd:	50                   	push   %eax
+  8008de:	e8 26 09 00 00       	call   801209 <sys_cputs>
+
+	return b.cnt;
+}
+  8008e3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8008e9:	c9                   	leave
+  8008ea:	c3                   	ret
+
+008008eb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8008eb:	55                   	push   %ebp
+  8008ec:	89 e5                	mov    %esp,%ebp
+  8008ee:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8008f1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8008f4:	50                   	push   %eax
+  8008f5:	ff 75 08             	push   0x8(%ebp)
+  8008f8:	e8 9d ff ff ff       	call   80089a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8008fd:	c9                   	leave
+  8008fe:	c3                   	ret
+
+008008ff <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8008ff:	55                   	push   %ebp
+  800900:	89 e5                	mov    %esp,%ebp
+  800902:	57                   	push   %edi
+  800903:	56                   	push   %esi
+  800904:	53                   	push   %ebx
+  800905:	83 ec 1c             	sub    $0x1c,%esp
+  800908:	89 c7                	mov    %eax,%edi
+  80090a:	89 d6                	mov    %edx,%esi
+  80090c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800912:	89 d1                	mov    %edx,%ecx
+  800914:	89 c2                	mov    %eax,%edx
+  800916:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800919:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80091c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80091f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800922:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800925:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80092c:	39 c2                	cmp    %eax,%edx
+  80092e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800931:	72 3e                	jb     800971 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800933:	83 ec 0c             	sub    $0xc,%esp
+  800936:	ff 75 18             	push   0x18(%ebp)
+  800939:	83 eb 01             	sub    $0x1,%ebx
+  80093c:	53                   	push   %ebx
+  80093d:	50                   	push   %eax
+  80093e:	83 ec 08             	sub    $0x8,%esp
+  800941:	ff 75 e4             	push   -0x1c(%ebp)
+  800944:	ff 75 e0             	push   -0x20(%ebp)
+  800947:	ff 75 dc             	push   -0x24(%ebp)
+  80094a:	ff 75 d8             	push   -0x28(%ebp)
+  80094d:	e8 8e 23 00 00       	call   802ce0 <__udivdi3>
+  800952:	83 c4 18             	add    $0x18,%esp
+  800955:	52                   	push   %edx
+  800956:	50                   	push   %eax
+  800957:	89 f2                	mov    %esi,%edx
+  800959:	89 f8                	mov    %edi,%eax
+  80095b:	e8 9f ff ff ff       	call   8008ff <printnum>
+  800960:	83 c4 20             	add    $0x20,%esp
+  800963:	eb 13                	jmp    800978 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800965:	83 ec 08             	sub    $0x8,%esp
+  800968:	56                   	push   %esi
+  800969:	ff 75 18             	push   0x18(%ebp)
+  80096c:	ff d7                	call   *%edi
+  80096e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800971:	83 eb 01             	sub    $0x1,%ebx
+  800974:	85 db                	test   %ebx,%ebx
+  800976:	7f ed                	jg     800965 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800978:	83 ec 08             	sub    $0x8,%esp
+  80097b:	56                   	push   %esi
+  80097c:	83 ec 04             	sub    $0x4,%esp
+  80097f:	ff 75 e4             	push   -0x1c(%ebp)
+  800982:	ff 75 e0             	push   -0x20(%ebp)
+  800985:	ff 75 dc             	push   -0x24(%ebp)
+  800988:	ff 75 d8             	push   -0x28(%ebp)
+  80098b:	e8 10 24 00 00       	call   802da0 <__umoddi3>
+  800990:	83 c4 14             	add    $0x14,%esp
+  800993:	0f be 80 7f 32 80 00 	movsbl 0x80327f(%eax),%eax
+  80099a:	50                   	push   %eax
+  80099b:	ff d7                	call   *%edi
+}
+  80099d:	83 c4 10             	add    $0x10,%esp
+  8009a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009a3:	5b                   	pop    %ebx
+  8009a4:	5e                   	pop    %esi
+  8009a5:	5f                   	pop    %edi
+  8009a6:	5d                   	pop    %ebp
+  8009a7:	c3                   	ret
+
+008009a8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8009a8:	55                   	push   %ebp
+  8009a9:	89 e5                	mov    %esp,%ebp
+  8009ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8009ae:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8009b2:	8b 10                	mov    (%eax),%edx
+  8009b4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8009b7:	73 0a                	jae    8009c3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8009b9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8009bc:	89 08                	mov    %ecx,(%eax)
+  8009be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c1:	88 02                	mov    %al,(%edx)
+}
+  8009c3:	5d                   	pop    %ebp
+  8009c4:	c3                   	ret
+
+008009c5 <printfmt>:
+{
+  8009c5:	55                   	push   %ebp
+  8009c6:	89 e5                	mov    %esp,%ebp
+  8009c8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8009cb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8009ce:	50                   	push   %eax
+  8009cf:	ff 75 10             	push   0x10(%ebp)
+  8009d2:	ff 75 0c             	push   0xc(%ebp)
+  8009d5:	ff 75 08             	push   0x8(%ebp)
+  8009d8:	e8 05 00 00 00       	call   8009e2 <vprintfmt>
+}
+  8009dd:	83 c4 10             	add    $0x10,%esp
+  8009e0:	c9                   	leave
+  8009e1:	c3                   	ret
+
+008009e2 <vprintfmt>:
+{
+  8009e2:	55                   	push   %ebp
+  8009e3:	89 e5                	mov    %esp,%ebp
+  8009e5:	57                   	push   %edi
+  8009e6:	56                   	push   %esi
+  8009e7:	53                   	push   %ebx
+  8009e8:	83 ec 2c             	sub    $0x2c,%esp
+  8009eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009f1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8009f4:	eb 0a                	jmp    800a00 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8009f6:	83 ec 08             	sub    $0x8,%esp
+  8009f9:	53                   	push   %ebx
+  8009fa:	50                   	push   %eax
+  8009fb:	ff d6                	call   *%esi
+  8009fd:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a00:	83 c7 01             	add    $0x1,%edi
+  800a03:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800a07:	83 f8 25             	cmp    $0x25,%eax
+  800a0a:	74 0c                	je     800a18 <vprintfmt+0x36>
+			if (ch == '\0')
+  800a0c:	85 c0                	test   %eax,%eax
+  800a0e:	75 e6                	jne    8009f6 <vprintfmt+0x14>
+}
+  800a10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a13:	5b                   	pop    %ebx
+  800a14:	5e                   	pop    %esi
+  800a15:	5f                   	pop    %edi
+  800a16:	5d                   	pop    %ebp
+  800a17:	c3                   	ret
+		padc = ' ';
+  800a18:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800a1c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800a23:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800a2a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800a31:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800a36:	8d 47 01             	lea    0x1(%edi),%eax
+  800a39:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a3c:	0f b6 17             	movzbl (%edi),%edx
+  800a3f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800a42:	3c 55                	cmp    $0x55,%al
+  800a44:	0f 87 cf 03 00 00    	ja     800e19 <vprintfmt+0x437>
+  800a4a:	0f b6 c0             	movzbl %al,%eax
+  800a4d:	ff 24 85 c0 33 80 00 	jmp    *0x8033c0(,%eax,4)
+  800a54:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800a57:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800a5b:	eb d9                	jmp    800a36 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800a5d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800a60:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800a64:	eb d0                	jmp    800a36 <vprintfmt+0x54>
+  800a66:	0f b6 d2             	movzbl %dl,%edx
+  800a69:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a71:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800a74:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800a77:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800a7b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800a7e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800a81:	83 f9 09             	cmp    $0x9,%ecx
+  800a84:	77 55                	ja     800adb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800a86:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800a89:	eb e9                	jmp    800a74 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800a8b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a8e:	8b 00                	mov    (%eax),%eax
+  800a90:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800a93:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a96:	8d 40 04             	lea    0x4(%eax),%eax
+  800a99:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800a9c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800a9f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800aa3:	79 91                	jns    800a36 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800aa5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800aa8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800aab:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800ab2:	eb 82                	jmp    800a36 <vprintfmt+0x54>
+			if (width < 0)
+  800ab4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800ab7:	85 d2                	test   %edx,%edx
+  800ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abe:	0f 49 c2             	cmovns %edx,%eax
+  800ac1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800ac4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800ac7:	e9 6a ff ff ff       	jmp    800a36 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800acc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800acf:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800ad6:	e9 5b ff ff ff       	jmp    800a36 <vprintfmt+0x54>
+  800adb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800ade:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800ae1:	eb bc                	jmp    800a9f <vprintfmt+0xbd>
+			lflag++;
+  800ae3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800ae6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800ae9:	e9 48 ff ff ff       	jmp    800a36 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800aee:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af1:	8d 78 04             	lea    0x4(%eax),%edi
+  800af4:	83 ec 08             	sub    $0x8,%esp
+  800af7:	53                   	push   %ebx
+  800af8:	ff 30                	push   (%eax)
+  800afa:	ff d6                	call   *%esi
+			break;
+  800afc:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800aff:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800b02:	e9 b1 02 00 00       	jmp    800db8 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800b07:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b0a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800b0d:	8b 10                	mov    (%eax),%edx
+  800b0f:	89 d0                	mov    %edx,%eax
+  800b11:	f7 d8                	neg    %eax
+  800b13:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b16:	83 f8 0f             	cmp    $0xf,%eax
+  800b19:	7f 23                	jg     800b3e <vprintfmt+0x15c>
+  800b1b:	8b 14 85 20 35 80 00 	mov    0x803520(,%eax,4),%edx
+  800b22:	85 d2                	test   %edx,%edx
+  800b24:	74 18                	je     800b3e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800b26:	52                   	push   %edx
+  800b27:	68 55 36 80 00       	push   $0x803655
+  800b2c:	53                   	push   %ebx
+  800b2d:	56                   	push   %esi
+  800b2e:	e8 92 fe ff ff       	call   8009c5 <printfmt>
+  800b33:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800b36:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800b39:	e9 7a 02 00 00       	jmp    800db8 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800b3e:	50                   	push   %eax
+  800b3f:	68 97 32 80 00       	push   $0x803297
+  800b44:	53                   	push   %ebx
+  800b45:	56                   	push   %esi
+  800b46:	e8 7a fe ff ff       	call   8009c5 <printfmt>
+  800b4b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800b4e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800b51:	e9 62 02 00 00       	jmp    800db8 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800b56:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b59:	83 c0 04             	add    $0x4,%eax
+  800b5c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800b5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b62:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800b64:	85 c9                	test   %ecx,%ecx
+  800b66:	b8 90 32 80 00       	mov    $0x803290,%eax
+  800b6b:	0f 45 c1             	cmovne %ecx,%eax
+  800b6e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800b71:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800b75:	7e 06                	jle    800b7d <vprintfmt+0x19b>
+  800b77:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800b7b:	75 0b                	jne    800b88 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b7d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800b80:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800b83:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b86:	eb 5c                	jmp    800be4 <vprintfmt+0x202>
+  800b88:	83 ec 08             	sub    $0x8,%esp
+  800b8b:	ff 75 d0             	push   -0x30(%ebp)
+  800b8e:	ff 75 cc             	push   -0x34(%ebp)
+  800b91:	e8 20 03 00 00       	call   800eb6 <strnlen>
+  800b96:	89 c2                	mov    %eax,%edx
+  800b98:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b9b:	29 d0                	sub    %edx,%eax
+  800b9d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800ba0:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800ba4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800ba7:	89 75 08             	mov    %esi,0x8(%ebp)
+  800baa:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800bac:	eb 0e                	jmp    800bbc <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800bae:	83 ec 08             	sub    $0x8,%esp
+  800bb1:	53                   	push   %ebx
+  800bb2:	57                   	push   %edi
+  800bb3:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800bb6:	83 ee 01             	sub    $0x1,%esi
+  800bb9:	83 c4 10             	add    $0x10,%esp
+  800bbc:	85 f6                	test   %esi,%esi
+  800bbe:	7f ee                	jg     800bae <vprintfmt+0x1cc>
+  800bc0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800bc3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bc6:	85 c0                	test   %eax,%eax
+  800bc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bcd:	0f 49 d0             	cmovns %eax,%edx
+  800bd0:	29 d0                	sub    %edx,%eax
+  800bd2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800bd5:	eb a6                	jmp    800b7d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800bd7:	83 ec 08             	sub    $0x8,%esp
+  800bda:	53                   	push   %ebx
+  800bdb:	52                   	push   %edx
+  800bdc:	ff 55 08             	call   *0x8(%ebp)
+  800bdf:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800be2:	89 f1                	mov    %esi,%ecx
+  800be4:	8d 71 01             	lea    0x1(%ecx),%esi
+  800be7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800beb:	0f be d0             	movsbl %al,%edx
+  800bee:	85 d2                	test   %edx,%edx
+  800bf0:	74 28                	je     800c1a <vprintfmt+0x238>
+  800bf2:	85 ff                	test   %edi,%edi
+  800bf4:	78 05                	js     800bfb <vprintfmt+0x219>
+  800bf6:	83 ef 01             	sub    $0x1,%edi
+  800bf9:	78 30                	js     800c2b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800bfb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800bff:	74 d6                	je     800bd7 <vprintfmt+0x1f5>
+  800c01:	0f be c0             	movsbl %al,%eax
+  800c04:	83 e8 20             	sub    $0x20,%eax
+  800c07:	83 f8 5e             	cmp    $0x5e,%eax
+  800c0a:	76 cb                	jbe    800bd7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800c0c:	83 ec 08             	sub    $0x8,%esp
+  800c0f:	53                   	push   %ebx
+  800c10:	6a 3f                	push   $0x3f
+  800c12:	ff 55 08             	call   *0x8(%ebp)
+  800c15:	83 c4 10             	add    $0x10,%esp
+  800c18:	eb c8                	jmp    800be2 <vprintfmt+0x200>
+  800c1a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c1d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c20:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800c23:	01 d0                	add    %edx,%eax
+  800c25:	29 c8                	sub    %ecx,%eax
+  800c27:	89 c7                	mov    %eax,%edi
+  800c29:	eb 13                	jmp    800c3e <vprintfmt+0x25c>
+  800c2b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c2e:	eb ed                	jmp    800c1d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800c30:	83 ec 08             	sub    $0x8,%esp
+  800c33:	53                   	push   %ebx
+  800c34:	6a 20                	push   $0x20
+  800c36:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800c38:	83 ef 01             	sub    $0x1,%edi
+  800c3b:	83 c4 10             	add    $0x10,%esp
+  800c3e:	85 ff                	test   %edi,%edi
+  800c40:	7f ee                	jg     800c30 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800c42:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800c45:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c48:	e9 6b 01 00 00       	jmp    800db8 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800c4d:	83 f9 01             	cmp    $0x1,%ecx
+  800c50:	7f 1f                	jg     800c71 <vprintfmt+0x28f>
+	else if (lflag)
+  800c52:	85 c9                	test   %ecx,%ecx
+  800c54:	74 67                	je     800cbd <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800c56:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c59:	8b 00                	mov    (%eax),%eax
+  800c5b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800c5e:	89 c1                	mov    %eax,%ecx
+  800c60:	c1 f9 1f             	sar    $0x1f,%ecx
+  800c63:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c66:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c69:	8d 40 04             	lea    0x4(%eax),%eax
+  800c6c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c6f:	eb 17                	jmp    800c88 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800c71:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c74:	8b 50 04             	mov    0x4(%eax),%edx
+  800c77:	8b 00                	mov    (%eax),%eax
+  800c79:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800c7c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800c7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c82:	8d 40 08             	lea    0x8(%eax),%eax
+  800c85:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800c88:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800c8b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800c8e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800c93:	85 c9                	test   %ecx,%ecx
+  800c95:	0f 89 03 01 00 00    	jns    800d9e <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800c9b:	83 ec 08             	sub    $0x8,%esp
+  800c9e:	53                   	push   %ebx
+  800c9f:	6a 2d                	push   $0x2d
+  800ca1:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800ca3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ca6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ca9:	f7 da                	neg    %edx
+  800cab:	83 d1 00             	adc    $0x0,%ecx
+  800cae:	f7 d9                	neg    %ecx
+  800cb0:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800cb3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800cb8:	e9 e1 00 00 00       	jmp    800d9e <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800cbd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cc0:	8b 00                	mov    (%eax),%eax
+  800cc2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cc5:	89 c1                	mov    %eax,%ecx
+  800cc7:	c1 f9 1f             	sar    $0x1f,%ecx
+  800cca:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ccd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cd0:	8d 40 04             	lea    0x4(%eax),%eax
+  800cd3:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cd6:	eb b0                	jmp    800c88 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800cd8:	83 f9 01             	cmp    $0x1,%ecx
+  800cdb:	7f 1e                	jg     800cfb <vprintfmt+0x319>
+	else if (lflag)
+  800cdd:	85 c9                	test   %ecx,%ecx
+  800cdf:	74 32                	je     800d13 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800ce1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ce4:	8b 10                	mov    (%eax),%edx
+  800ce6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ceb:	8d 40 04             	lea    0x4(%eax),%eax
+  800cee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800cf1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800cf6:	e9 a3 00 00 00       	jmp    800d9e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800cfb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cfe:	8b 10                	mov    (%eax),%edx
+  800d00:	8b 48 04             	mov    0x4(%eax),%ecx
+  800d03:	8d 40 08             	lea    0x8(%eax),%eax
+  800d06:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d09:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800d0e:	e9 8b 00 00 00       	jmp    800d9e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800d13:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d16:	8b 10                	mov    (%eax),%edx
+  800d18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d1d:	8d 40 04             	lea    0x4(%eax),%eax
+  800d20:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d23:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800d28:	eb 74                	jmp    800d9e <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800d2a:	83 f9 01             	cmp    $0x1,%ecx
+  800d2d:	7f 1b                	jg     800d4a <vprintfmt+0x368>
+	else if (lflag)
+  800d2f:	85 c9                	test   %ecx,%ecx
+  800d31:	74 2c                	je     800d5f <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800d33:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d36:	8b 10                	mov    (%eax),%edx
+  800d38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d3d:	8d 40 04             	lea    0x4(%eax),%eax
+  800d40:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800d43:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800d48:	eb 54                	jmp    800d9e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800d4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d4d:	8b 10                	mov    (%eax),%edx
+  800d4f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800d52:	8d 40 08             	lea    0x8(%eax),%eax
+  800d55:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800d58:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800d5d:	eb 3f                	jmp    800d9e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800d5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d62:	8b 10                	mov    (%eax),%edx
+  800d64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d69:	8d 40 04             	lea    0x4(%eax),%eax
+  800d6c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800d6f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800d74:	eb 28                	jmp    800d9e <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800d76:	83 ec 08             	sub    $0x8,%esp
+  800d79:	53                   	push   %ebx
+  800d7a:	6a 30                	push   $0x30
+  800d7c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800d7e:	83 c4 08             	add    $0x8,%esp
+  800d81:	53                   	push   %ebx
+  800d82:	6a 78                	push   $0x78
+  800d84:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800d86:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d89:	8b 10                	mov    (%eax),%edx
+  800d8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800d90:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800d93:	8d 40 04             	lea    0x4(%eax),%eax
+  800d96:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d99:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800d9e:	83 ec 0c             	sub    $0xc,%esp
+  800da1:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800da5:	50                   	push   %eax
+  800da6:	ff 75 e0             	push   -0x20(%ebp)
+  800da9:	57                   	push   %edi
+  800daa:	51                   	push   %ecx
+  800dab:	52                   	push   %edx
+  800dac:	89 da                	mov    %ebx,%edx
+  800dae:	89 f0                	mov    %esi,%eax
+  800db0:	e8 4a fb ff ff       	call   8008ff <printnum>
+			break;
+  800db5:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800db8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800dbb:	e9 40 fc ff ff       	jmp    800a00 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800dc0:	83 f9 01             	cmp    $0x1,%ecx
+  800dc3:	7f 1b                	jg     800de0 <vprintfmt+0x3fe>
+	else if (lflag)
+  800dc5:	85 c9                	test   %ecx,%ecx
+  800dc7:	74 2c                	je     800df5 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800dc9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dcc:	8b 10                	mov    (%eax),%edx
+  800dce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd3:	8d 40 04             	lea    0x4(%eax),%eax
+  800dd6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800dd9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800dde:	eb be                	jmp    800d9e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800de0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800de3:	8b 10                	mov    (%eax),%edx
+  800de5:	8b 48 04             	mov    0x4(%eax),%ecx
+  800de8:	8d 40 08             	lea    0x8(%eax),%eax
+  800deb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800dee:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800df3:	eb a9                	jmp    800d9e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800df5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800df8:	8b 10                	mov    (%eax),%edx
+  800dfa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dff:	8d 40 04             	lea    0x4(%eax),%eax
+  800e02:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e05:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800e0a:	eb 92                	jmp    800d9e <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800e0c:	83 ec 08             	sub    $0x8,%esp
+  800e0f:	53                   	push   %ebx
+  800e10:	6a 25                	push   $0x25
+  800e12:	ff d6                	call   *%esi
+			break;
+  800e14:	83 c4 10             	add    $0x10,%esp
+  800e17:	eb 9f                	jmp    800db8 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800e19:	83 ec 08             	sub    $0x8,%esp
+  800e1c:	53                   	push   %ebx
+  800e1d:	6a 25                	push   $0x25
+  800e1f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e21:	83 c4 10             	add    $0x10,%esp
+  800e24:	89 f8                	mov    %edi,%eax
+  800e26:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800e2a:	74 05                	je     800e31 <vprintfmt+0x44f>
+  800e2c:	83 e8 01             	sub    $0x1,%eax
+  800e2f:	eb f5                	jmp    800e26 <vprintfmt+0x444>
+  800e31:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800e34:	eb 82                	jmp    800db8 <vprintfmt+0x3d6>
+
+00800e36 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e36:	55                   	push   %ebp
+  800e37:	89 e5                	mov    %esp,%ebp
+  800e39:	83 ec 18             	sub    $0x18,%esp
+  800e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800e42:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800e45:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800e49:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800e4c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800e53:	85 c0                	test   %eax,%eax
+  800e55:	74 26                	je     800e7d <vsnprintf+0x47>
+  800e57:	85 d2                	test   %edx,%edx
+  800e59:	7e 22                	jle    800e7d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800e5b:	ff 75 14             	push   0x14(%ebp)
+  800e5e:	ff 75 10             	push   0x10(%ebp)
+  800e61:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800e64:	50                   	push   %eax
+  800e65:	68 a8 09 80 00       	push   $0x8009a8
+  800e6a:	e8 73 fb ff ff       	call   8009e2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800e6f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800e72:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800e75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e78:	83 c4 10             	add    $0x10,%esp
+}
+  800e7b:	c9                   	leave
+  800e7c:	c3                   	ret
+		return -E_INVAL;
+  800e7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e82:	eb f7                	jmp    800e7b <vsnprintf+0x45>
+
+00800e84 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800e84:	55                   	push   %ebp
+  800e85:	89 e5                	mov    %esp,%ebp
+  800e87:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800e8a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800e8d:	50                   	push   %eax
+  800e8e:	ff 75 10             	push   0x10(%ebp)
+  800e91:	ff 75 0c             	push   0xc(%ebp)
+  800e94:	ff 75 08             	push   0x8(%ebp)
+  800e97:	e8 9a ff ff ff       	call   800e36 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800e9c:	c9                   	leave
+  800e9d:	c3                   	ret
+
+00800e9e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea9:	eb 03                	jmp    800eae <strlen+0x10>
+		n++;
+  800eab:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800eae:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800eb2:	75 f7                	jne    800eab <strlen+0xd>
+	return n;
+}
+  800eb4:	5d                   	pop    %ebp
+  800eb5:	c3                   	ret
+
+00800eb6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800eb6:	55                   	push   %ebp
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ebc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec4:	eb 03                	jmp    800ec9 <strnlen+0x13>
+		n++;
+  800ec6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ec9:	39 d0                	cmp    %edx,%eax
+  800ecb:	74 08                	je     800ed5 <strnlen+0x1f>
+  800ecd:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ed1:	75 f3                	jne    800ec6 <strnlen+0x10>
+  800ed3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800ed5:	89 d0                	mov    %edx,%eax
+  800ed7:	5d                   	pop    %ebp
+  800ed8:	c3                   	ret
+
+00800ed9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ed9:	55                   	push   %ebp
+  800eda:	89 e5                	mov    %esp,%ebp
+  800edc:	53                   	push   %ebx
+  800edd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ee0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800eec:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800eef:	83 c0 01             	add    $0x1,%eax
+  800ef2:	84 d2                	test   %dl,%dl
+  800ef4:	75 f2                	jne    800ee8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ef6:	89 c8                	mov    %ecx,%eax
+  800ef8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800efb:	c9                   	leave
+  800efc:	c3                   	ret
+
+00800efd <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800efd:	55                   	push   %ebp
+  800efe:	89 e5                	mov    %esp,%ebp
+  800f00:	53                   	push   %ebx
+  800f01:	83 ec 10             	sub    $0x10,%esp
+  800f04:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800f07:	53                   	push   %ebx
+  800f08:	e8 91 ff ff ff       	call   800e9e <strlen>
+  800f0d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800f10:	ff 75 0c             	push   0xc(%ebp)
+  800f13:	01 d8                	add    %ebx,%eax
+  800f15:	50                   	push   %eax
+  800f16:	e8 be ff ff ff       	call   800ed9 <strcpy>
+	return dst;
+}
+  800f1b:	89 d8                	mov    %ebx,%eax
+  800f1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f20:	c9                   	leave
+  800f21:	c3                   	ret
+
+00800f22 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f22:	55                   	push   %ebp
+  800f23:	89 e5                	mov    %esp,%ebp
+  800f25:	56                   	push   %esi
+  800f26:	53                   	push   %ebx
+  800f27:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800f2d:	89 f3                	mov    %esi,%ebx
+  800f2f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800f32:	89 f0                	mov    %esi,%eax
+  800f34:	eb 0f                	jmp    800f45 <strncpy+0x23>
+		*dst++ = *src;
+  800f36:	83 c0 01             	add    $0x1,%eax
+  800f39:	0f b6 0a             	movzbl (%edx),%ecx
+  800f3c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800f3f:	80 f9 01             	cmp    $0x1,%cl
+  800f42:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800f45:	39 d8                	cmp    %ebx,%eax
+  800f47:	75 ed                	jne    800f36 <strncpy+0x14>
+	}
+	return ret;
+}
+  800f49:	89 f0                	mov    %esi,%eax
+  800f4b:	5b                   	pop    %ebx
+  800f4c:	5e                   	pop    %esi
+  800f4d:	5d                   	pop    %ebp
+  800f4e:	c3                   	ret
+
+00800f4f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800f4f:	55                   	push   %ebp
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+  800f54:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800f5d:	89 f0                	mov    %esi,%eax
+  800f5f:	85 d2                	test   %edx,%edx
+  800f61:	74 21                	je     800f84 <strlcpy+0x35>
+  800f63:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800f67:	89 f2                	mov    %esi,%edx
+  800f69:	eb 09                	jmp    800f74 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800f6b:	83 c1 01             	add    $0x1,%ecx
+  800f6e:	83 c2 01             	add    $0x1,%edx
+  800f71:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800f74:	39 c2                	cmp    %eax,%edx
+  800f76:	74 09                	je     800f81 <strlcpy+0x32>
+  800f78:	0f b6 19             	movzbl (%ecx),%ebx
+  800f7b:	84 db                	test   %bl,%bl
+  800f7d:	75 ec                	jne    800f6b <strlcpy+0x1c>
+  800f7f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800f81:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800f84:	29 f0                	sub    %esi,%eax
+}
+  800f86:	5b                   	pop    %ebx
+  800f87:	5e                   	pop    %esi
+  800f88:	5d                   	pop    %ebp
+  800f89:	c3                   	ret
+
+00800f8a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800f8a:	55                   	push   %ebp
+  800f8b:	89 e5                	mov    %esp,%ebp
+  800f8d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f90:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800f93:	eb 06                	jmp    800f9b <strcmp+0x11>
+		p++, q++;
+  800f95:	83 c1 01             	add    $0x1,%ecx
+  800f98:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800f9b:	0f b6 01             	movzbl (%ecx),%eax
+  800f9e:	84 c0                	test   %al,%al
+  800fa0:	74 04                	je     800fa6 <strcmp+0x1c>
+  800fa2:	3a 02                	cmp    (%edx),%al
+  800fa4:	74 ef                	je     800f95 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800fa6:	0f b6 c0             	movzbl %al,%eax
+  800fa9:	0f b6 12             	movzbl (%edx),%edx
+  800fac:	29 d0                	sub    %edx,%eax
+}
+  800fae:	5d                   	pop    %ebp
+  800faf:	c3                   	ret
+
+00800fb0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800fb0:	55                   	push   %ebp
+  800fb1:	89 e5                	mov    %esp,%ebp
+  800fb3:	53                   	push   %ebx
+  800fb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fba:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800fbd:	eb 09                	jmp    800fc8 <strncmp+0x18>
+		n--, p++, q++;
+  800fbf:	83 ea 01             	sub    $0x1,%edx
+  800fc2:	83 c0 01             	add    $0x1,%eax
+  800fc5:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800fc8:	85 d2                	test   %edx,%edx
+  800fca:	74 18                	je     800fe4 <strncmp+0x34>
+  800fcc:	0f b6 18             	movzbl (%eax),%ebx
+  800fcf:	84 db                	test   %bl,%bl
+  800fd1:	74 04                	je     800fd7 <strncmp+0x27>
+  800fd3:	3a 19                	cmp    (%ecx),%bl
+  800fd5:	74 e8                	je     800fbf <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800fd7:	0f b6 00             	movzbl (%eax),%eax
+  800fda:	0f b6 11             	movzbl (%ecx),%edx
+  800fdd:	29 d0                	sub    %edx,%eax
+}
+  800fdf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fe2:	c9                   	leave
+  800fe3:	c3                   	ret
+		return 0;
+  800fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe9:	eb f4                	jmp    800fdf <strncmp+0x2f>
+
+00800feb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800feb:	55                   	push   %ebp
+  800fec:	89 e5                	mov    %esp,%ebp
+  800fee:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ff1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ff5:	eb 03                	jmp    800ffa <strchr+0xf>
+  800ff7:	83 c0 01             	add    $0x1,%eax
+  800ffa:	0f b6 10             	movzbl (%eax),%edx
+  800ffd:	84 d2                	test   %dl,%dl
+  800fff:	74 06                	je     801007 <strchr+0x1c>
+		if (*s == c)
+  801001:	38 ca                	cmp    %cl,%dl
+  801003:	75 f2                	jne    800ff7 <strchr+0xc>
+  801005:	eb 05                	jmp    80100c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801007:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80100c:	5d                   	pop    %ebp
+  80100d:	c3                   	ret
+
+0080100e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80100e:	55                   	push   %ebp
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	8b 45 08             	mov    0x8(%ebp),%eax
+  801014:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801018:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80101b:	38 ca                	cmp    %cl,%dl
+  80101d:	74 09                	je     801028 <strfind+0x1a>
+  80101f:	84 d2                	test   %dl,%dl
+  801021:	74 05                	je     801028 <strfind+0x1a>
+	for (; *s; s++)
+  801023:	83 c0 01             	add    $0x1,%eax
+  801026:	eb f0                	jmp    801018 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801028:	5d                   	pop    %ebp
+  801029:	c3                   	ret
+
+0080102a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80102a:	55                   	push   %ebp
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	57                   	push   %edi
+  80102e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801031:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801034:	85 c9                	test   %ecx,%ecx
+  801036:	74 20                	je     801058 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801038:	89 f8                	mov    %edi,%eax
+  80103a:	09 c8                	or     %ecx,%eax
+  80103c:	a8 03                	test   $0x3,%al
+  80103e:	75 12                	jne    801052 <memset+0x28>
+		c &= 0xFF;
+  801040:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801044:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80104a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80104d:	fc                   	cld
+  80104e:	f3 ab                	rep stos %eax,%es:(%edi)
+  801050:	eb 06                	jmp    801058 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801052:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801055:	fc                   	cld
+  801056:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801058:	89 f8                	mov    %edi,%eax
+  80105a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80105d:	c9                   	leave
+  80105e:	c3                   	ret
+
+0080105f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80105f:	55                   	push   %ebp
+  801060:	89 e5                	mov    %esp,%ebp
+  801062:	57                   	push   %edi
+  801063:	56                   	push   %esi
+  801064:	8b 45 08             	mov    0x8(%ebp),%eax
+  801067:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80106a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80106d:	39 c6                	cmp    %eax,%esi
+  80106f:	73 32                	jae    8010a3 <memmove+0x44>
+  801071:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801074:	39 d0                	cmp    %edx,%eax
+  801076:	73 2b                	jae    8010a3 <memmove+0x44>
+		s += n;
+		d += n;
+  801078:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80107b:	89 d6                	mov    %edx,%esi
+  80107d:	09 fe                	or     %edi,%esi
+  80107f:	09 ce                	or     %ecx,%esi
+  801081:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801087:	75 0e                	jne    801097 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801089:	83 ef 04             	sub    $0x4,%edi
+  80108c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80108f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801092:	fd                   	std
+  801093:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801095:	eb 09                	jmp    8010a0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801097:	83 ef 01             	sub    $0x1,%edi
+  80109a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80109d:	fd                   	std
+  80109e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8010a0:	fc                   	cld
+  8010a1:	eb 1a                	jmp    8010bd <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8010a3:	89 f2                	mov    %esi,%edx
+  8010a5:	09 c2                	or     %eax,%edx
+  8010a7:	09 ca                	or     %ecx,%edx
+  8010a9:	f6 c2 03             	test   $0x3,%dl
+  8010ac:	75 0a                	jne    8010b8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8010ae:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8010b1:	89 c7                	mov    %eax,%edi
+  8010b3:	fc                   	cld
+  8010b4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8010b6:	eb 05                	jmp    8010bd <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8010b8:	89 c7                	mov    %eax,%edi
+  8010ba:	fc                   	cld
+  8010bb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8010bd:	5e                   	pop    %esi
+  8010be:	5f                   	pop    %edi
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	c3                   	ret
+
+008010c1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+  8010c4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8010c7:	ff 75 10             	push   0x10(%ebp)
+  8010ca:	ff 75 0c             	push   0xc(%ebp)
+  8010cd:	ff 75 08             	push   0x8(%ebp)
+  8010d0:	e8 8a ff ff ff       	call   80105f <memmove>
+}
+  8010d5:	c9                   	leave
+  8010d6:	c3                   	ret
+
+008010d7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	56                   	push   %esi
+  8010db:	53                   	push   %ebx
+  8010dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010df:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8010e2:	89 c6                	mov    %eax,%esi
+  8010e4:	03 75 10             	add    0x10(%ebp),%esi
+  8010e7:	eb 06                	jmp    8010ef <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8010e9:	83 c0 01             	add    $0x1,%eax
+  8010ec:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8010ef:	39 f0                	cmp    %esi,%eax
+  8010f1:	74 14                	je     801107 <memcmp+0x30>
+		if (*s1 != *s2)
+  8010f3:	0f b6 08             	movzbl (%eax),%ecx
+  8010f6:	0f b6 1a             	movzbl (%edx),%ebx
+  8010f9:	38 d9                	cmp    %bl,%cl
+  8010fb:	74 ec                	je     8010e9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8010fd:	0f b6 c1             	movzbl %cl,%eax
+  801100:	0f b6 db             	movzbl %bl,%ebx
+  801103:	29 d8                	sub    %ebx,%eax
+  801105:	eb 05                	jmp    80110c <memcmp+0x35>
+	}
+
+	return 0;
+  801107:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80110c:	5b                   	pop    %ebx
+  80110d:	5e                   	pop    %esi
+  80110e:	5d                   	pop    %ebp
+  80110f:	c3                   	ret
+
+00801110 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	8b 45 08             	mov    0x8(%ebp),%eax
+  801116:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801119:	89 c2                	mov    %eax,%edx
+  80111b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80111e:	eb 03                	jmp    801123 <memfind+0x13>
+  801120:	83 c0 01             	add    $0x1,%eax
+  801123:	39 d0                	cmp    %edx,%eax
+  801125:	73 04                	jae    80112b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801127:	38 08                	cmp    %cl,(%eax)
+  801129:	75 f5                	jne    801120 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80112b:	5d                   	pop    %ebp
+  80112c:	c3                   	ret
+
+0080112d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	57                   	push   %edi
+  801131:	56                   	push   %esi
+  801132:	53                   	push   %ebx
+  801133:	8b 55 08             	mov    0x8(%ebp),%edx
+  801136:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801139:	eb 03                	jmp    80113e <strtol+0x11>
+		s++;
+  80113b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80113e:	0f b6 02             	movzbl (%edx),%eax
+  801141:	3c 20                	cmp    $0x20,%al
+  801143:	74 f6                	je     80113b <strtol+0xe>
+  801145:	3c 09                	cmp    $0x9,%al
+  801147:	74 f2                	je     80113b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801149:	3c 2b                	cmp    $0x2b,%al
+  80114b:	74 2a                	je     801177 <strtol+0x4a>
+	int neg = 0;
+  80114d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801152:	3c 2d                	cmp    $0x2d,%al
+  801154:	74 2b                	je     801181 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801156:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80115c:	75 0f                	jne    80116d <strtol+0x40>
+  80115e:	80 3a 30             	cmpb   $0x30,(%edx)
+  801161:	74 28                	je     80118b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801163:	85 db                	test   %ebx,%ebx
+  801165:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80116a:	0f 44 d8             	cmove  %eax,%ebx
+  80116d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801172:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801175:	eb 46                	jmp    8011bd <strtol+0x90>
+		s++;
+  801177:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80117a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80117f:	eb d5                	jmp    801156 <strtol+0x29>
+		s++, neg = 1;
+  801181:	83 c2 01             	add    $0x1,%edx
+  801184:	bf 01 00 00 00       	mov    $0x1,%edi
+  801189:	eb cb                	jmp    801156 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80118b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80118f:	74 0e                	je     80119f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801191:	85 db                	test   %ebx,%ebx
+  801193:	75 d8                	jne    80116d <strtol+0x40>
+		s++, base = 8;
+  801195:	83 c2 01             	add    $0x1,%edx
+  801198:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80119d:	eb ce                	jmp    80116d <strtol+0x40>
+		s += 2, base = 16;
+  80119f:	83 c2 02             	add    $0x2,%edx
+  8011a2:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8011a7:	eb c4                	jmp    80116d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8011a9:	0f be c0             	movsbl %al,%eax
+  8011ac:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8011af:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8011b2:	7d 3a                	jge    8011ee <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8011b4:	83 c2 01             	add    $0x1,%edx
+  8011b7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8011bb:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8011bd:	0f b6 02             	movzbl (%edx),%eax
+  8011c0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8011c3:	89 f3                	mov    %esi,%ebx
+  8011c5:	80 fb 09             	cmp    $0x9,%bl
+  8011c8:	76 df                	jbe    8011a9 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8011ca:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8011cd:	89 f3                	mov    %esi,%ebx
+  8011cf:	80 fb 19             	cmp    $0x19,%bl
+  8011d2:	77 08                	ja     8011dc <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8011d4:	0f be c0             	movsbl %al,%eax
+  8011d7:	83 e8 57             	sub    $0x57,%eax
+  8011da:	eb d3                	jmp    8011af <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8011dc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8011df:	89 f3                	mov    %esi,%ebx
+  8011e1:	80 fb 19             	cmp    $0x19,%bl
+  8011e4:	77 08                	ja     8011ee <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8011e6:	0f be c0             	movsbl %al,%eax
+  8011e9:	83 e8 37             	sub    $0x37,%eax
+  8011ec:	eb c1                	jmp    8011af <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8011ee:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8011f2:	74 05                	je     8011f9 <strtol+0xcc>
+		*endptr = (char *) s;
+  8011f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011f7:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8011f9:	89 c8                	mov    %ecx,%eax
+  8011fb:	f7 d8                	neg    %eax
+  8011fd:	85 ff                	test   %edi,%edi
+  8011ff:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801202:	89 c8                	mov    %ecx,%eax
+  801204:	5b                   	pop    %ebx
+  801205:	5e                   	pop    %esi
+  801206:	5f                   	pop    %edi
+  801207:	5d                   	pop    %ebp
+  801208:	c3                   	ret
+
+00801209 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801209:	55                   	push   %ebp
+  80120a:	89 e5                	mov    %esp,%ebp
+  80120c:	57                   	push   %edi
+  80120d:	56                   	push   %esi
+  80120e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80120f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801214:	8b 55 08             	mov    0x8(%ebp),%edx
+  801217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121a:	89 c3                	mov    %eax,%ebx
+  80121c:	89 c7                	mov    %eax,%edi
+  80121e:	89 c6                	mov    %eax,%esi
+  801220:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801222:	5b                   	pop    %ebx
+  801223:	5e                   	pop    %esi
+  801224:	5f                   	pop    %edi
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+
+00801227 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	57                   	push   %edi
+  80122b:	56                   	push   %esi
+  80122c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80122d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801232:	b8 01 00 00 00       	mov    $0x1,%eax
+  801237:	89 d1                	mov    %edx,%ecx
+  801239:	89 d3                	mov    %edx,%ebx
+  80123b:	89 d7                	mov    %edx,%edi
+  80123d:	89 d6                	mov    %edx,%esi
+  80123f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801241:	5b                   	pop    %ebx
+  801242:	5e                   	pop    %esi
+  801243:	5f                   	pop    %edi
+  801244:	5d                   	pop    %ebp
+  801245:	c3                   	ret
+
+00801246 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  801246:	55                   	push   %ebp
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	57                   	push   %edi
+  80124a:	56                   	push   %esi
+  80124b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80124c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801251:	8b 55 08             	mov    0x8(%ebp),%edx
+  801254:	b8 04 00 00 00       	mov    $0x4,%eax
+  801259:	89 cb                	mov    %ecx,%ebx
+  80125b:	89 cf                	mov    %ecx,%edi
+  80125d:	89 ce                	mov    %ecx,%esi
+  80125f:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  801261:	5b                   	pop    %ebx
+  801262:	5e                   	pop    %esi
+  801263:	5f                   	pop    %edi
+  801264:	5d                   	pop    %ebp
+  801265:	c3                   	ret
+
+00801266 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	56                   	push   %esi
+  80126b:	53                   	push   %ebx
+  80126c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80126f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801274:	8b 55 08             	mov    0x8(%ebp),%edx
+  801277:	b8 03 00 00 00       	mov    $0x3,%eax
+  80127c:	89 cb                	mov    %ecx,%ebx
+  80127e:	89 cf                	mov    %ecx,%edi
+  801280:	89 ce                	mov    %ecx,%esi
+  801282:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801284:	85 c0                	test   %eax,%eax
+  801286:	7f 08                	jg     801290 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801288:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128b:	5b                   	pop    %ebx
+  80128c:	5e                   	pop    %esi
+  80128d:	5f                   	pop    %edi
+  80128e:	5d                   	pop    %ebp
+  80128f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801290:	83 ec 0c             	sub    $0xc,%esp
+  801293:	50                   	push   %eax
+  801294:	6a 03                	push   $0x3
+  801296:	68 7f 35 80 00       	push   $0x80357f
+  80129b:	6a 23                	push   $0x23
+  80129d:	68 9c 35 80 00       	push   $0x80359c
+  8012a2:	e8 69 f5 ff ff       	call   800810 <_panic>
+
+008012a7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8012a7:	55                   	push   %ebp
+  8012a8:	89 e5                	mov    %esp,%ebp
+  8012aa:	57                   	push   %edi
+  8012ab:	56                   	push   %esi
+  8012ac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8012b7:	89 d1                	mov    %edx,%ecx
+  8012b9:	89 d3                	mov    %edx,%ebx
+  8012bb:	89 d7                	mov    %edx,%edi
+  8012bd:	89 d6                	mov    %edx,%esi
+  8012bf:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8012c1:	5b                   	pop    %ebx
+  8012c2:	5e                   	pop    %esi
+  8012c3:	5f                   	pop    %edi
+  8012c4:	5d                   	pop    %ebp
+  8012c5:	c3                   	ret
+
+008012c6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8012c6:	55                   	push   %ebp
+  8012c7:	89 e5                	mov    %esp,%ebp
+  8012c9:	57                   	push   %edi
+  8012ca:	56                   	push   %esi
+  8012cb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012d6:	89 d1                	mov    %edx,%ecx
+  8012d8:	89 d3                	mov    %edx,%ebx
+  8012da:	89 d7                	mov    %edx,%edi
+  8012dc:	89 d6                	mov    %edx,%esi
+  8012de:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8012e0:	5b                   	pop    %ebx
+  8012e1:	5e                   	pop    %esi
+  8012e2:	5f                   	pop    %edi
+  8012e3:	5d                   	pop    %ebp
+  8012e4:	c3                   	ret
+
+008012e5 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  8012e5:	55                   	push   %ebp
+  8012e6:	89 e5                	mov    %esp,%ebp
+  8012e8:	57                   	push   %edi
+  8012e9:	56                   	push   %esi
+  8012ea:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012f5:	89 d1                	mov    %edx,%ecx
+  8012f7:	89 d3                	mov    %edx,%ebx
+  8012f9:	89 d7                	mov    %edx,%edi
+  8012fb:	89 d6                	mov    %edx,%esi
+  8012fd:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  8012ff:	5b                   	pop    %ebx
+  801300:	5e                   	pop    %esi
+  801301:	5f                   	pop    %edi
+  801302:	5d                   	pop    %ebp
+  801303:	c3                   	ret
+
+00801304 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  801304:	55                   	push   %ebp
+  801305:	89 e5                	mov    %esp,%ebp
+  801307:	57                   	push   %edi
+  801308:	56                   	push   %esi
+  801309:	53                   	push   %ebx
+  80130a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80130d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801312:	8b 55 08             	mov    0x8(%ebp),%edx
+  801315:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801318:	b8 15 00 00 00       	mov    $0x15,%eax
+  80131d:	89 df                	mov    %ebx,%edi
+  80131f:	89 de                	mov    %ebx,%esi
+  801321:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801323:	85 c0                	test   %eax,%eax
+  801325:	7f 08                	jg     80132f <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  801327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132a:	5b                   	pop    %ebx
+  80132b:	5e                   	pop    %esi
+  80132c:	5f                   	pop    %edi
+  80132d:	5d                   	pop    %ebp
+  80132e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80132f:	83 ec 0c             	sub    $0xc,%esp
+  801332:	50                   	push   %eax
+  801333:	6a 15                	push   $0x15
+  801335:	68 7f 35 80 00       	push   $0x80357f
+  80133a:	6a 23                	push   $0x23
+  80133c:	68 9c 35 80 00       	push   $0x80359c
+  801341:	e8 ca f4 ff ff       	call   800810 <_panic>
+
+00801346 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801346:	55                   	push   %ebp
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	57                   	push   %edi
+  80134a:	56                   	push   %esi
+  80134b:	53                   	push   %ebx
+  80134c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80134f:	be 00 00 00 00       	mov    $0x0,%esi
+  801354:	8b 55 08             	mov    0x8(%ebp),%edx
+  801357:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80135f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801362:	89 f7                	mov    %esi,%edi
+  801364:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801366:	85 c0                	test   %eax,%eax
+  801368:	7f 08                	jg     801372 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80136a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136d:	5b                   	pop    %ebx
+  80136e:	5e                   	pop    %esi
+  80136f:	5f                   	pop    %edi
+  801370:	5d                   	pop    %ebp
+  801371:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801372:	83 ec 0c             	sub    $0xc,%esp
+  801375:	50                   	push   %eax
+  801376:	6a 05                	push   $0x5
+  801378:	68 7f 35 80 00       	push   $0x80357f
+  80137d:	6a 23                	push   $0x23
+  80137f:	68 9c 35 80 00       	push   $0x80359c
+  801384:	e8 87 f4 ff ff       	call   800810 <_panic>
+
+00801389 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  801389:	55                   	push   %ebp
+  80138a:	89 e5                	mov    %esp,%ebp
+  80138c:	57                   	push   %edi
+  80138d:	56                   	push   %esi
+  80138e:	53                   	push   %ebx
+  80138f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801392:	be 00 00 00 00       	mov    $0x0,%esi
+  801397:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139d:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a5:	89 f7                	mov    %esi,%edi
+  8013a7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013a9:	85 c0                	test   %eax,%eax
+  8013ab:	7f 08                	jg     8013b5 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8013ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b0:	5b                   	pop    %ebx
+  8013b1:	5e                   	pop    %esi
+  8013b2:	5f                   	pop    %edi
+  8013b3:	5d                   	pop    %ebp
+  8013b4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b5:	83 ec 0c             	sub    $0xc,%esp
+  8013b8:	50                   	push   %eax
+  8013b9:	6a 06                	push   $0x6
+  8013bb:	68 7f 35 80 00       	push   $0x80357f
+  8013c0:	6a 23                	push   $0x23
+  8013c2:	68 9c 35 80 00       	push   $0x80359c
+  8013c7:	e8 44 f4 ff ff       	call   800810 <_panic>
+
+008013cc <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8013cc:	55                   	push   %ebp
+  8013cd:	89 e5                	mov    %esp,%ebp
+  8013cf:	57                   	push   %edi
+  8013d0:	56                   	push   %esi
+  8013d1:	53                   	push   %ebx
+  8013d2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013db:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013e6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013e9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013eb:	85 c0                	test   %eax,%eax
+  8013ed:	7f 08                	jg     8013f7 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8013ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f2:	5b                   	pop    %ebx
+  8013f3:	5e                   	pop    %esi
+  8013f4:	5f                   	pop    %edi
+  8013f5:	5d                   	pop    %ebp
+  8013f6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f7:	83 ec 0c             	sub    $0xc,%esp
+  8013fa:	50                   	push   %eax
+  8013fb:	6a 07                	push   $0x7
+  8013fd:	68 7f 35 80 00       	push   $0x80357f
+  801402:	6a 23                	push   $0x23
+  801404:	68 9c 35 80 00       	push   $0x80359c
+  801409:	e8 02 f4 ff ff       	call   800810 <_panic>
+
+0080140e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80140e:	55                   	push   %ebp
+  80140f:	89 e5                	mov    %esp,%ebp
+  801411:	57                   	push   %edi
+  801412:	56                   	push   %esi
+  801413:	53                   	push   %ebx
+  801414:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801417:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801422:	b8 08 00 00 00       	mov    $0x8,%eax
+  801427:	89 df                	mov    %ebx,%edi
+  801429:	89 de                	mov    %ebx,%esi
+  80142b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80142d:	85 c0                	test   %eax,%eax
+  80142f:	7f 08                	jg     801439 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801434:	5b                   	pop    %ebx
+  801435:	5e                   	pop    %esi
+  801436:	5f                   	pop    %edi
+  801437:	5d                   	pop    %ebp
+  801438:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801439:	83 ec 0c             	sub    $0xc,%esp
+  80143c:	50                   	push   %eax
+  80143d:	6a 08                	push   $0x8
+  80143f:	68 7f 35 80 00       	push   $0x80357f
+  801444:	6a 23                	push   $0x23
+  801446:	68 9c 35 80 00       	push   $0x80359c
+  80144b:	e8 c0 f3 ff ff       	call   800810 <_panic>
+
+00801450 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  801450:	55                   	push   %ebp
+  801451:	89 e5                	mov    %esp,%ebp
+  801453:	57                   	push   %edi
+  801454:	56                   	push   %esi
+  801455:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801456:	8b 55 08             	mov    0x8(%ebp),%edx
+  801459:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801461:	be 00 00 00 00       	mov    $0x0,%esi
+  801466:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801469:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80146c:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  80146e:	5b                   	pop    %ebx
+  80146f:	5e                   	pop    %esi
+  801470:	5f                   	pop    %edi
+  801471:	5d                   	pop    %ebp
+  801472:	c3                   	ret
+
+00801473 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801473:	55                   	push   %ebp
+  801474:	89 e5                	mov    %esp,%ebp
+  801476:	57                   	push   %edi
+  801477:	56                   	push   %esi
+  801478:	53                   	push   %ebx
+  801479:	8b 45 18             	mov    0x18(%ebp),%eax
+  80147c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  80147f:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  801484:	77 27                	ja     8014ad <sys_page_map_range+0x3a>
+  801486:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80148c:	77 1f                	ja     8014ad <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  80148e:	c1 e0 0c             	shl    $0xc,%eax
+  801491:	89 c6                	mov    %eax,%esi
+  801493:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  801495:	8b 55 08             	mov    0x8(%ebp),%edx
+  801498:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014a6:	cd 30                	int    $0x30
+}
+  8014a8:	5b                   	pop    %ebx
+  8014a9:	5e                   	pop    %esi
+  8014aa:	5f                   	pop    %edi
+  8014ab:	5d                   	pop    %ebp
+  8014ac:	c3                   	ret
+		return -E_INVAL;
+  8014ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b2:	eb f4                	jmp    8014a8 <sys_page_map_range+0x35>
+
+008014b4 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8014b4:	55                   	push   %ebp
+  8014b5:	89 e5                	mov    %esp,%ebp
+  8014b7:	57                   	push   %edi
+  8014b8:	56                   	push   %esi
+  8014b9:	53                   	push   %ebx
+  8014ba:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8014bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014d3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	7f 08                	jg     8014e1 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8014d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014dc:	5b                   	pop    %ebx
+  8014dd:	5e                   	pop    %esi
+  8014de:	5f                   	pop    %edi
+  8014df:	5d                   	pop    %ebp
+  8014e0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014e1:	83 ec 0c             	sub    $0xc,%esp
+  8014e4:	50                   	push   %eax
+  8014e5:	6a 0c                	push   $0xc
+  8014e7:	68 7f 35 80 00       	push   $0x80357f
+  8014ec:	6a 23                	push   $0x23
+  8014ee:	68 9c 35 80 00       	push   $0x80359c
+  8014f3:	e8 18 f3 ff ff       	call   800810 <_panic>
+
+008014f8 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8014f8:	55                   	push   %ebp
+  8014f9:	89 e5                	mov    %esp,%ebp
+  8014fb:	57                   	push   %edi
+  8014fc:	56                   	push   %esi
+  8014fd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801503:	8b 55 08             	mov    0x8(%ebp),%edx
+  801506:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801509:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80150e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801511:	89 f7                	mov    %esi,%edi
+  801513:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  801515:	5b                   	pop    %ebx
+  801516:	5e                   	pop    %esi
+  801517:	5f                   	pop    %edi
+  801518:	5d                   	pop    %ebp
+  801519:	c3                   	ret
+
+0080151a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80151a:	55                   	push   %ebp
+  80151b:	89 e5                	mov    %esp,%ebp
+  80151d:	57                   	push   %edi
+  80151e:	56                   	push   %esi
+  80151f:	53                   	push   %ebx
+  801520:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801523:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801528:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801533:	89 df                	mov    %ebx,%edi
+  801535:	89 de                	mov    %ebx,%esi
+  801537:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801539:	85 c0                	test   %eax,%eax
+  80153b:	7f 08                	jg     801545 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80153d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801540:	5b                   	pop    %ebx
+  801541:	5e                   	pop    %esi
+  801542:	5f                   	pop    %edi
+  801543:	5d                   	pop    %ebp
+  801544:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801545:	83 ec 0c             	sub    $0xc,%esp
+  801548:	50                   	push   %eax
+  801549:	6a 0f                	push   $0xf
+  80154b:	68 7f 35 80 00       	push   $0x80357f
+  801550:	6a 23                	push   $0x23
+  801552:	68 9c 35 80 00       	push   $0x80359c
+  801557:	e8 b4 f2 ff ff       	call   800810 <_panic>
+
+0080155c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80155c:	55                   	push   %ebp
+  80155d:	89 e5                	mov    %esp,%ebp
+  80155f:	57                   	push   %edi
+  801560:	56                   	push   %esi
+  801561:	53                   	push   %ebx
+  801562:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801565:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801570:	b8 10 00 00 00       	mov    $0x10,%eax
+  801575:	89 df                	mov    %ebx,%edi
+  801577:	89 de                	mov    %ebx,%esi
+  801579:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80157b:	85 c0                	test   %eax,%eax
+  80157d:	7f 08                	jg     801587 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  80157f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801582:	5b                   	pop    %ebx
+  801583:	5e                   	pop    %esi
+  801584:	5f                   	pop    %edi
+  801585:	5d                   	pop    %ebp
+  801586:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801587:	83 ec 0c             	sub    $0xc,%esp
+  80158a:	50                   	push   %eax
+  80158b:	6a 10                	push   $0x10
+  80158d:	68 7f 35 80 00       	push   $0x80357f
+  801592:	6a 23                	push   $0x23
+  801594:	68 9c 35 80 00       	push   $0x80359c
+  801599:	e8 72 f2 ff ff       	call   800810 <_panic>
+
+0080159e <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80159e:	55                   	push   %ebp
+  80159f:	89 e5                	mov    %esp,%ebp
+  8015a1:	57                   	push   %edi
+  8015a2:	56                   	push   %esi
+  8015a3:	53                   	push   %ebx
+  8015a4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8015a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b2:	b8 11 00 00 00       	mov    $0x11,%eax
+  8015b7:	89 df                	mov    %ebx,%edi
+  8015b9:	89 de                	mov    %ebx,%esi
+  8015bb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015bd:	85 c0                	test   %eax,%eax
+  8015bf:	7f 08                	jg     8015c9 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  8015c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c4:	5b                   	pop    %ebx
+  8015c5:	5e                   	pop    %esi
+  8015c6:	5f                   	pop    %edi
+  8015c7:	5d                   	pop    %ebp
+  8015c8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015c9:	83 ec 0c             	sub    $0xc,%esp
+  8015cc:	50                   	push   %eax
+  8015cd:	6a 11                	push   $0x11
+  8015cf:	68 7f 35 80 00       	push   $0x80357f
+  8015d4:	6a 23                	push   $0x23
+  8015d6:	68 9c 35 80 00       	push   $0x80359c
+  8015db:	e8 30 f2 ff ff       	call   800810 <_panic>
+
+008015e0 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  8015e0:	55                   	push   %ebp
+  8015e1:	89 e5                	mov    %esp,%ebp
+  8015e3:	57                   	push   %edi
+  8015e4:	56                   	push   %esi
+  8015e5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015eb:	b8 12 00 00 00       	mov    $0x12,%eax
+  8015f0:	89 d1                	mov    %edx,%ecx
+  8015f2:	89 d3                	mov    %edx,%ebx
+  8015f4:	89 d7                	mov    %edx,%edi
+  8015f6:	89 d6                	mov    %edx,%esi
+  8015f8:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  8015fa:	5b                   	pop    %ebx
+  8015fb:	5e                   	pop    %esi
+  8015fc:	5f                   	pop    %edi
+  8015fd:	5d                   	pop    %ebp
+  8015fe:	c3                   	ret
+
+008015ff <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8015ff:	55                   	push   %ebp
+  801600:	89 e5                	mov    %esp,%ebp
+  801602:	57                   	push   %edi
+  801603:	56                   	push   %esi
+  801604:	53                   	push   %ebx
+  801605:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801608:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801610:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801613:	b8 13 00 00 00       	mov    $0x13,%eax
+  801618:	89 df                	mov    %ebx,%edi
+  80161a:	89 de                	mov    %ebx,%esi
+  80161c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80161e:	85 c0                	test   %eax,%eax
+  801620:	7f 08                	jg     80162a <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801622:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801625:	5b                   	pop    %ebx
+  801626:	5e                   	pop    %esi
+  801627:	5f                   	pop    %edi
+  801628:	5d                   	pop    %ebp
+  801629:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80162a:	83 ec 0c             	sub    $0xc,%esp
+  80162d:	50                   	push   %eax
+  80162e:	6a 13                	push   $0x13
+  801630:	68 7f 35 80 00       	push   $0x80357f
+  801635:	6a 23                	push   $0x23
+  801637:	68 9c 35 80 00       	push   $0x80359c
+  80163c:	e8 cf f1 ff ff       	call   800810 <_panic>
+
+00801641 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801641:	55                   	push   %ebp
+  801642:	89 e5                	mov    %esp,%ebp
+  801644:	57                   	push   %edi
+  801645:	56                   	push   %esi
+  801646:	53                   	push   %ebx
+  801647:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80164a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801652:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801655:	b8 14 00 00 00       	mov    $0x14,%eax
+  80165a:	89 df                	mov    %ebx,%edi
+  80165c:	89 de                	mov    %ebx,%esi
+  80165e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801660:	85 c0                	test   %eax,%eax
+  801662:	7f 08                	jg     80166c <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801664:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801667:	5b                   	pop    %ebx
+  801668:	5e                   	pop    %esi
+  801669:	5f                   	pop    %edi
+  80166a:	5d                   	pop    %ebp
+  80166b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80166c:	83 ec 0c             	sub    $0xc,%esp
+  80166f:	50                   	push   %eax
+  801670:	6a 14                	push   $0x14
+  801672:	68 7f 35 80 00       	push   $0x80357f
+  801677:	6a 23                	push   $0x23
+  801679:	68 9c 35 80 00       	push   $0x80359c
+  80167e:	e8 8d f1 ff ff       	call   800810 <_panic>
+
+00801683 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801683:	55                   	push   %ebp
+  801684:	89 e5                	mov    %esp,%ebp
+  801686:	57                   	push   %edi
+  801687:	56                   	push   %esi
+  801688:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801689:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801694:	be 00 00 00 00       	mov    $0x0,%esi
+  801699:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80169c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80169f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8016a1:	5b                   	pop    %ebx
+  8016a2:	5e                   	pop    %esi
+  8016a3:	5f                   	pop    %edi
+  8016a4:	5d                   	pop    %ebp
+  8016a5:	c3                   	ret
+
+008016a6 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	57                   	push   %edi
+  8016aa:	56                   	push   %esi
+  8016ab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8016ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8016b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016bf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016c2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8016c4:	5b                   	pop    %ebx
+  8016c5:	5e                   	pop    %esi
+  8016c6:	5f                   	pop    %edi
+  8016c7:	5d                   	pop    %ebp
+  8016c8:	c3                   	ret
+
+008016c9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8016c9:	55                   	push   %ebp
+  8016ca:	89 e5                	mov    %esp,%ebp
+  8016cc:	57                   	push   %edi
+  8016cd:	56                   	push   %esi
+  8016ce:	53                   	push   %ebx
+  8016cf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8016d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016da:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016df:	89 cb                	mov    %ecx,%ebx
+  8016e1:	89 cf                	mov    %ecx,%edi
+  8016e3:	89 ce                	mov    %ecx,%esi
+  8016e5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016e7:	85 c0                	test   %eax,%eax
+  8016e9:	7f 08                	jg     8016f3 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8016eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ee:	5b                   	pop    %ebx
+  8016ef:	5e                   	pop    %esi
+  8016f0:	5f                   	pop    %edi
+  8016f1:	5d                   	pop    %ebp
+  8016f2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016f3:	83 ec 0c             	sub    $0xc,%esp
+  8016f6:	50                   	push   %eax
+  8016f7:	6a 19                	push   $0x19
+  8016f9:	68 7f 35 80 00       	push   $0x80357f
+  8016fe:	6a 23                	push   $0x23
+  801700:	68 9c 35 80 00       	push   $0x80359c
+  801705:	e8 06 f1 ff ff       	call   800810 <_panic>
+
+0080170a <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80170a:	55                   	push   %ebp
+  80170b:	89 e5                	mov    %esp,%ebp
+  80170d:	57                   	push   %edi
+  80170e:	56                   	push   %esi
+  80170f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801710:	ba 00 00 00 00       	mov    $0x0,%edx
+  801715:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80171a:	89 d1                	mov    %edx,%ecx
+  80171c:	89 d3                	mov    %edx,%ebx
+  80171e:	89 d7                	mov    %edx,%edi
+  801720:	89 d6                	mov    %edx,%esi
+  801722:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801724:	5b                   	pop    %ebx
+  801725:	5e                   	pop    %esi
+  801726:	5f                   	pop    %edi
+  801727:	5d                   	pop    %ebp
+  801728:	c3                   	ret
+
+00801729 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801729:	55                   	push   %ebp
+  80172a:	89 e5                	mov    %esp,%ebp
+  80172c:	57                   	push   %edi
+  80172d:	56                   	push   %esi
+  80172e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80172f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801734:	8b 55 08             	mov    0x8(%ebp),%edx
+  801737:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80173f:	89 df                	mov    %ebx,%edi
+  801741:	89 de                	mov    %ebx,%esi
+  801743:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801745:	5b                   	pop    %ebx
+  801746:	5e                   	pop    %esi
+  801747:	5f                   	pop    %edi
+  801748:	5d                   	pop    %ebp
+  801749:	c3                   	ret
+
+0080174a <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  80174a:	55                   	push   %ebp
+  80174b:	89 e5                	mov    %esp,%ebp
+  80174d:	57                   	push   %edi
+  80174e:	56                   	push   %esi
+  80174f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801750:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801755:	8b 55 08             	mov    0x8(%ebp),%edx
+  801758:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801760:	89 df                	mov    %ebx,%edi
+  801762:	89 de                	mov    %ebx,%esi
+  801764:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801766:	5b                   	pop    %ebx
+  801767:	5e                   	pop    %esi
+  801768:	5f                   	pop    %edi
+  801769:	5d                   	pop    %ebp
+  80176a:	c3                   	ret
+
+0080176b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80176b:	55                   	push   %ebp
+  80176c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80176e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801771:	05 00 00 00 30       	add    $0x30000000,%eax
+  801776:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801779:	5d                   	pop    %ebp
+  80177a:	c3                   	ret
+
+0080177b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80177b:	55                   	push   %ebp
+  80177c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80177e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801781:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801786:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80178b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801790:	5d                   	pop    %ebp
+  801791:	c3                   	ret
+
+00801792 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801795:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80179a:	eb 02                	jmp    80179e <fd_alloc+0xc>
+  80179c:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80179e:	89 c2                	mov    %eax,%edx
+  8017a0:	c1 ea 16             	shr    $0x16,%edx
+  8017a3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017aa:	f6 c2 01             	test   $0x1,%dl
+  8017ad:	74 2b                	je     8017da <fd_alloc+0x48>
+  8017af:	89 c2                	mov    %eax,%edx
+  8017b1:	c1 ea 0c             	shr    $0xc,%edx
+  8017b4:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017bb:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017c1:	f6 c1 01             	test   $0x1,%cl
+  8017c4:	74 14                	je     8017da <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8017c6:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8017cc:	75 ce                	jne    80179c <fd_alloc+0xa>
+  8017ce:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8017d3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8017d8:	eb 05                	jmp    8017df <fd_alloc+0x4d>
+			return 0;
+  8017da:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8017df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e2:	89 02                	mov    %eax,(%edx)
+}
+  8017e4:	89 c8                	mov    %ecx,%eax
+  8017e6:	5d                   	pop    %ebp
+  8017e7:	c3                   	ret
+
+008017e8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8017ee:	83 f8 1f             	cmp    $0x1f,%eax
+  8017f1:	77 30                	ja     801823 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8017f3:	c1 e0 0c             	shl    $0xc,%eax
+  8017f6:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8017fb:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801801:	f6 c2 01             	test   $0x1,%dl
+  801804:	74 24                	je     80182a <fd_lookup+0x42>
+  801806:	89 c2                	mov    %eax,%edx
+  801808:	c1 ea 0c             	shr    $0xc,%edx
+  80180b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801812:	f6 c2 01             	test   $0x1,%dl
+  801815:	74 1a                	je     801831 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801817:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80181a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80181c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801821:	5d                   	pop    %ebp
+  801822:	c3                   	ret
+		return -E_INVAL;
+  801823:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801828:	eb f7                	jmp    801821 <fd_lookup+0x39>
+		return -E_INVAL;
+  80182a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80182f:	eb f0                	jmp    801821 <fd_lookup+0x39>
+  801831:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801836:	eb e9                	jmp    801821 <fd_lookup+0x39>
+
+00801838 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	53                   	push   %ebx
+  80183c:	83 ec 04             	sub    $0x4,%esp
+  80183f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801842:	b8 00 00 00 00       	mov    $0x0,%eax
+  801847:	eb 03                	jmp    80184c <dev_lookup+0x14>
+  801849:	83 c0 01             	add    $0x1,%eax
+  80184c:	8b 1c 85 28 36 80 00 	mov    0x803628(,%eax,4),%ebx
+  801853:	85 db                	test   %ebx,%ebx
+  801855:	74 0b                	je     801862 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801857:	39 13                	cmp    %edx,(%ebx)
+  801859:	75 ee                	jne    801849 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80185b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801860:	eb 1f                	jmp    801881 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801862:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  801867:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80186a:	83 ec 04             	sub    $0x4,%esp
+  80186d:	52                   	push   %edx
+  80186e:	50                   	push   %eax
+  80186f:	68 ac 35 80 00       	push   $0x8035ac
+  801874:	e8 72 f0 ff ff       	call   8008eb <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801879:	83 c4 10             	add    $0x10,%esp
+  80187c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801881:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801884:	89 1a                	mov    %ebx,(%edx)
+}
+  801886:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801889:	c9                   	leave
+  80188a:	c3                   	ret
+
+0080188b <fd_close>:
+{
+  80188b:	55                   	push   %ebp
+  80188c:	89 e5                	mov    %esp,%ebp
+  80188e:	57                   	push   %edi
+  80188f:	56                   	push   %esi
+  801890:	53                   	push   %ebx
+  801891:	83 ec 24             	sub    $0x24,%esp
+  801894:	8b 75 08             	mov    0x8(%ebp),%esi
+  801897:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80189a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80189d:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80189e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018a4:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018a7:	50                   	push   %eax
+  8018a8:	e8 3b ff ff ff       	call   8017e8 <fd_lookup>
+  8018ad:	89 c3                	mov    %eax,%ebx
+  8018af:	83 c4 10             	add    $0x10,%esp
+  8018b2:	85 c0                	test   %eax,%eax
+  8018b4:	78 05                	js     8018bb <fd_close+0x30>
+	    || fd != fd2)
+  8018b6:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8018b9:	74 16                	je     8018d1 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8018bb:	89 f8                	mov    %edi,%eax
+  8018bd:	84 c0                	test   %al,%al
+  8018bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c4:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8018c7:	89 d8                	mov    %ebx,%eax
+  8018c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018cc:	5b                   	pop    %ebx
+  8018cd:	5e                   	pop    %esi
+  8018ce:	5f                   	pop    %edi
+  8018cf:	5d                   	pop    %ebp
+  8018d0:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018d1:	83 ec 08             	sub    $0x8,%esp
+  8018d4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8018d7:	50                   	push   %eax
+  8018d8:	ff 36                	push   (%esi)
+  8018da:	e8 59 ff ff ff       	call   801838 <dev_lookup>
+  8018df:	89 c3                	mov    %eax,%ebx
+  8018e1:	83 c4 10             	add    $0x10,%esp
+  8018e4:	85 c0                	test   %eax,%eax
+  8018e6:	78 1a                	js     801902 <fd_close+0x77>
+		if (dev->dev_close)
+  8018e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018eb:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8018ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8018f3:	85 c0                	test   %eax,%eax
+  8018f5:	74 0b                	je     801902 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8018f7:	83 ec 0c             	sub    $0xc,%esp
+  8018fa:	56                   	push   %esi
+  8018fb:	ff d0                	call   *%eax
+  8018fd:	89 c3                	mov    %eax,%ebx
+  8018ff:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801902:	83 ec 08             	sub    $0x8,%esp
+  801905:	56                   	push   %esi
+  801906:	6a 00                	push   $0x0
+  801908:	e8 01 fb ff ff       	call   80140e <sys_page_unmap>
+	return r;
+  80190d:	83 c4 10             	add    $0x10,%esp
+  801910:	eb b5                	jmp    8018c7 <fd_close+0x3c>
+
+00801912 <close>:
+
+int
+close(int fdnum)
+{
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801918:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80191b:	50                   	push   %eax
+  80191c:	ff 75 08             	push   0x8(%ebp)
+  80191f:	e8 c4 fe ff ff       	call   8017e8 <fd_lookup>
+  801924:	83 c4 10             	add    $0x10,%esp
+  801927:	85 c0                	test   %eax,%eax
+  801929:	79 02                	jns    80192d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80192b:	c9                   	leave
+  80192c:	c3                   	ret
+		return fd_close(fd, 1);
+  80192d:	83 ec 08             	sub    $0x8,%esp
+  801930:	6a 01                	push   $0x1
+  801932:	ff 75 f4             	push   -0xc(%ebp)
+  801935:	e8 51 ff ff ff       	call   80188b <fd_close>
+  80193a:	83 c4 10             	add    $0x10,%esp
+  80193d:	eb ec                	jmp    80192b <close+0x19>
+
+0080193f <close_all>:
+
+void
+close_all(void)
+{
+  80193f:	55                   	push   %ebp
+  801940:	89 e5                	mov    %esp,%ebp
+  801942:	53                   	push   %ebx
+  801943:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801946:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80194b:	83 ec 0c             	sub    $0xc,%esp
+  80194e:	53                   	push   %ebx
+  80194f:	e8 be ff ff ff       	call   801912 <close>
+	for (i = 0; i < MAXFD; i++)
+  801954:	83 c3 01             	add    $0x1,%ebx
+  801957:	83 c4 10             	add    $0x10,%esp
+  80195a:	83 fb 20             	cmp    $0x20,%ebx
+  80195d:	75 ec                	jne    80194b <close_all+0xc>
+}
+  80195f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801962:	c9                   	leave
+  801963:	c3                   	ret
+
+00801964 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801964:	55                   	push   %ebp
+  801965:	89 e5                	mov    %esp,%ebp
+  801967:	57                   	push   %edi
+  801968:	56                   	push   %esi
+  801969:	53                   	push   %ebx
+  80196a:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80196d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801970:	50                   	push   %eax
+  801971:	ff 75 08             	push   0x8(%ebp)
+  801974:	e8 6f fe ff ff       	call   8017e8 <fd_lookup>
+  801979:	89 c3                	mov    %eax,%ebx
+  80197b:	83 c4 10             	add    $0x10,%esp
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	78 7f                	js     801a01 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801982:	83 ec 0c             	sub    $0xc,%esp
+  801985:	ff 75 0c             	push   0xc(%ebp)
+  801988:	e8 85 ff ff ff       	call   801912 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80198d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801990:	c1 e6 0c             	shl    $0xc,%esi
+  801993:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801999:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80199c:	89 3c 24             	mov    %edi,(%esp)
+  80199f:	e8 d7 fd ff ff       	call   80177b <fd2data>
+  8019a4:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019a6:	89 34 24             	mov    %esi,(%esp)
+  8019a9:	e8 cd fd ff ff       	call   80177b <fd2data>
+  8019ae:	83 c4 10             	add    $0x10,%esp
+  8019b1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8019b4:	89 d8                	mov    %ebx,%eax
+  8019b6:	c1 e8 16             	shr    $0x16,%eax
+  8019b9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8019c0:	a8 01                	test   $0x1,%al
+  8019c2:	74 11                	je     8019d5 <dup+0x71>
+  8019c4:	89 d8                	mov    %ebx,%eax
+  8019c6:	c1 e8 0c             	shr    $0xc,%eax
+  8019c9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8019d0:	f6 c2 01             	test   $0x1,%dl
+  8019d3:	75 36                	jne    801a0b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8019d5:	89 f8                	mov    %edi,%eax
+  8019d7:	c1 e8 0c             	shr    $0xc,%eax
+  8019da:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019e1:	83 ec 0c             	sub    $0xc,%esp
+  8019e4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019e9:	50                   	push   %eax
+  8019ea:	56                   	push   %esi
+  8019eb:	6a 00                	push   $0x0
+  8019ed:	57                   	push   %edi
+  8019ee:	6a 00                	push   $0x0
+  8019f0:	e8 d7 f9 ff ff       	call   8013cc <sys_page_map>
+  8019f5:	89 c3                	mov    %eax,%ebx
+  8019f7:	83 c4 20             	add    $0x20,%esp
+  8019fa:	85 c0                	test   %eax,%eax
+  8019fc:	78 33                	js     801a31 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8019fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a01:	89 d8                	mov    %ebx,%eax
+  801a03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a06:	5b                   	pop    %ebx
+  801a07:	5e                   	pop    %esi
+  801a08:	5f                   	pop    %edi
+  801a09:	5d                   	pop    %ebp
+  801a0a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a0b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a12:	83 ec 0c             	sub    $0xc,%esp
+  801a15:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a1a:	50                   	push   %eax
+  801a1b:	ff 75 d4             	push   -0x2c(%ebp)
+  801a1e:	6a 00                	push   $0x0
+  801a20:	53                   	push   %ebx
+  801a21:	6a 00                	push   $0x0
+  801a23:	e8 a4 f9 ff ff       	call   8013cc <sys_page_map>
+  801a28:	89 c3                	mov    %eax,%ebx
+  801a2a:	83 c4 20             	add    $0x20,%esp
+  801a2d:	85 c0                	test   %eax,%eax
+  801a2f:	79 a4                	jns    8019d5 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a31:	83 ec 08             	sub    $0x8,%esp
+  801a34:	56                   	push   %esi
+  801a35:	6a 00                	push   $0x0
+  801a37:	e8 d2 f9 ff ff       	call   80140e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a3c:	83 c4 08             	add    $0x8,%esp
+  801a3f:	ff 75 d4             	push   -0x2c(%ebp)
+  801a42:	6a 00                	push   $0x0
+  801a44:	e8 c5 f9 ff ff       	call   80140e <sys_page_unmap>
+	return r;
+  801a49:	83 c4 10             	add    $0x10,%esp
+  801a4c:	eb b3                	jmp    801a01 <dup+0x9d>
+
+00801a4e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a4e:	55                   	push   %ebp
+  801a4f:	89 e5                	mov    %esp,%ebp
+  801a51:	56                   	push   %esi
+  801a52:	53                   	push   %ebx
+  801a53:	83 ec 18             	sub    $0x18,%esp
+  801a56:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a59:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a5c:	50                   	push   %eax
+  801a5d:	56                   	push   %esi
+  801a5e:	e8 85 fd ff ff       	call   8017e8 <fd_lookup>
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	78 3c                	js     801aa6 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a6a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801a6d:	83 ec 08             	sub    $0x8,%esp
+  801a70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a73:	50                   	push   %eax
+  801a74:	ff 33                	push   (%ebx)
+  801a76:	e8 bd fd ff ff       	call   801838 <dev_lookup>
+  801a7b:	83 c4 10             	add    $0x10,%esp
+  801a7e:	85 c0                	test   %eax,%eax
+  801a80:	78 24                	js     801aa6 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a82:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a85:	83 e0 03             	and    $0x3,%eax
+  801a88:	83 f8 01             	cmp    $0x1,%eax
+  801a8b:	74 20                	je     801aad <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801a8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a90:	8b 40 08             	mov    0x8(%eax),%eax
+  801a93:	85 c0                	test   %eax,%eax
+  801a95:	74 37                	je     801ace <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801a97:	83 ec 04             	sub    $0x4,%esp
+  801a9a:	ff 75 10             	push   0x10(%ebp)
+  801a9d:	ff 75 0c             	push   0xc(%ebp)
+  801aa0:	53                   	push   %ebx
+  801aa1:	ff d0                	call   *%eax
+  801aa3:	83 c4 10             	add    $0x10,%esp
+}
+  801aa6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa9:	5b                   	pop    %ebx
+  801aaa:	5e                   	pop    %esi
+  801aab:	5d                   	pop    %ebp
+  801aac:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801aad:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  801ab2:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801ab5:	83 ec 04             	sub    $0x4,%esp
+  801ab8:	56                   	push   %esi
+  801ab9:	50                   	push   %eax
+  801aba:	68 ed 35 80 00       	push   $0x8035ed
+  801abf:	e8 27 ee ff ff       	call   8008eb <cprintf>
+		return -E_INVAL;
+  801ac4:	83 c4 10             	add    $0x10,%esp
+  801ac7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801acc:	eb d8                	jmp    801aa6 <read+0x58>
+		return -E_NOT_SUPP;
+  801ace:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ad3:	eb d1                	jmp    801aa6 <read+0x58>
+
+00801ad5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801ad5:	55                   	push   %ebp
+  801ad6:	89 e5                	mov    %esp,%ebp
+  801ad8:	57                   	push   %edi
+  801ad9:	56                   	push   %esi
+  801ada:	53                   	push   %ebx
+  801adb:	83 ec 0c             	sub    $0xc,%esp
+  801ade:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ae1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801ae4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae9:	eb 02                	jmp    801aed <readn+0x18>
+  801aeb:	01 c3                	add    %eax,%ebx
+  801aed:	39 f3                	cmp    %esi,%ebx
+  801aef:	73 21                	jae    801b12 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801af1:	83 ec 04             	sub    $0x4,%esp
+  801af4:	89 f0                	mov    %esi,%eax
+  801af6:	29 d8                	sub    %ebx,%eax
+  801af8:	50                   	push   %eax
+  801af9:	89 d8                	mov    %ebx,%eax
+  801afb:	03 45 0c             	add    0xc(%ebp),%eax
+  801afe:	50                   	push   %eax
+  801aff:	57                   	push   %edi
+  801b00:	e8 49 ff ff ff       	call   801a4e <read>
+		if (m < 0)
+  801b05:	83 c4 10             	add    $0x10,%esp
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 04                	js     801b10 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b0c:	75 dd                	jne    801aeb <readn+0x16>
+  801b0e:	eb 02                	jmp    801b12 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b10:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b12:	89 d8                	mov    %ebx,%eax
+  801b14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b17:	5b                   	pop    %ebx
+  801b18:	5e                   	pop    %esi
+  801b19:	5f                   	pop    %edi
+  801b1a:	5d                   	pop    %ebp
+  801b1b:	c3                   	ret
+
+00801b1c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b1c:	55                   	push   %ebp
+  801b1d:	89 e5                	mov    %esp,%ebp
+  801b1f:	56                   	push   %esi
+  801b20:	53                   	push   %ebx
+  801b21:	83 ec 18             	sub    $0x18,%esp
+  801b24:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b27:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b2a:	50                   	push   %eax
+  801b2b:	53                   	push   %ebx
+  801b2c:	e8 b7 fc ff ff       	call   8017e8 <fd_lookup>
+  801b31:	83 c4 10             	add    $0x10,%esp
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	78 37                	js     801b6f <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b38:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b3b:	83 ec 08             	sub    $0x8,%esp
+  801b3e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b41:	50                   	push   %eax
+  801b42:	ff 36                	push   (%esi)
+  801b44:	e8 ef fc ff ff       	call   801838 <dev_lookup>
+  801b49:	83 c4 10             	add    $0x10,%esp
+  801b4c:	85 c0                	test   %eax,%eax
+  801b4e:	78 1f                	js     801b6f <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b50:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b54:	74 20                	je     801b76 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801b56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b59:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	74 37                	je     801b97 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801b60:	83 ec 04             	sub    $0x4,%esp
+  801b63:	ff 75 10             	push   0x10(%ebp)
+  801b66:	ff 75 0c             	push   0xc(%ebp)
+  801b69:	56                   	push   %esi
+  801b6a:	ff d0                	call   *%eax
+  801b6c:	83 c4 10             	add    $0x10,%esp
+}
+  801b6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b72:	5b                   	pop    %ebx
+  801b73:	5e                   	pop    %esi
+  801b74:	5d                   	pop    %ebp
+  801b75:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b76:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  801b7b:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801b7e:	83 ec 04             	sub    $0x4,%esp
+  801b81:	53                   	push   %ebx
+  801b82:	50                   	push   %eax
+  801b83:	68 09 36 80 00       	push   $0x803609
+  801b88:	e8 5e ed ff ff       	call   8008eb <cprintf>
+		return -E_INVAL;
+  801b8d:	83 c4 10             	add    $0x10,%esp
+  801b90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b95:	eb d8                	jmp    801b6f <write+0x53>
+		return -E_NOT_SUPP;
+  801b97:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b9c:	eb d1                	jmp    801b6f <write+0x53>
+
+00801b9e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801b9e:	55                   	push   %ebp
+  801b9f:	89 e5                	mov    %esp,%ebp
+  801ba1:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ba4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ba7:	50                   	push   %eax
+  801ba8:	ff 75 08             	push   0x8(%ebp)
+  801bab:	e8 38 fc ff ff       	call   8017e8 <fd_lookup>
+  801bb0:	83 c4 10             	add    $0x10,%esp
+  801bb3:	85 c0                	test   %eax,%eax
+  801bb5:	78 0e                	js     801bc5 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801bb7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bbd:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bc5:	c9                   	leave
+  801bc6:	c3                   	ret
+
+00801bc7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801bc7:	55                   	push   %ebp
+  801bc8:	89 e5                	mov    %esp,%ebp
+  801bca:	56                   	push   %esi
+  801bcb:	53                   	push   %ebx
+  801bcc:	83 ec 18             	sub    $0x18,%esp
+  801bcf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bd2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bd5:	50                   	push   %eax
+  801bd6:	53                   	push   %ebx
+  801bd7:	e8 0c fc ff ff       	call   8017e8 <fd_lookup>
+  801bdc:	83 c4 10             	add    $0x10,%esp
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	78 34                	js     801c17 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801be3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801be6:	83 ec 08             	sub    $0x8,%esp
+  801be9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bec:	50                   	push   %eax
+  801bed:	ff 36                	push   (%esi)
+  801bef:	e8 44 fc ff ff       	call   801838 <dev_lookup>
+  801bf4:	83 c4 10             	add    $0x10,%esp
+  801bf7:	85 c0                	test   %eax,%eax
+  801bf9:	78 1c                	js     801c17 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bfb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bff:	74 1d                	je     801c1e <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c04:	8b 40 18             	mov    0x18(%eax),%eax
+  801c07:	85 c0                	test   %eax,%eax
+  801c09:	74 34                	je     801c3f <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c0b:	83 ec 08             	sub    $0x8,%esp
+  801c0e:	ff 75 0c             	push   0xc(%ebp)
+  801c11:	56                   	push   %esi
+  801c12:	ff d0                	call   *%eax
+  801c14:	83 c4 10             	add    $0x10,%esp
+}
+  801c17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c1a:	5b                   	pop    %ebx
+  801c1b:	5e                   	pop    %esi
+  801c1c:	5d                   	pop    %ebp
+  801c1d:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801c1e:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  801c23:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c26:	83 ec 04             	sub    $0x4,%esp
+  801c29:	53                   	push   %ebx
+  801c2a:	50                   	push   %eax
+  801c2b:	68 cc 35 80 00       	push   $0x8035cc
+  801c30:	e8 b6 ec ff ff       	call   8008eb <cprintf>
+		return -E_INVAL;
+  801c35:	83 c4 10             	add    $0x10,%esp
+  801c38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c3d:	eb d8                	jmp    801c17 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801c3f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c44:	eb d1                	jmp    801c17 <ftruncate+0x50>
+
+00801c46 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801c46:	55                   	push   %ebp
+  801c47:	89 e5                	mov    %esp,%ebp
+  801c49:	56                   	push   %esi
+  801c4a:	53                   	push   %ebx
+  801c4b:	83 ec 18             	sub    $0x18,%esp
+  801c4e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c51:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c54:	50                   	push   %eax
+  801c55:	ff 75 08             	push   0x8(%ebp)
+  801c58:	e8 8b fb ff ff       	call   8017e8 <fd_lookup>
+  801c5d:	83 c4 10             	add    $0x10,%esp
+  801c60:	85 c0                	test   %eax,%eax
+  801c62:	78 49                	js     801cad <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c64:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c67:	83 ec 08             	sub    $0x8,%esp
+  801c6a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c6d:	50                   	push   %eax
+  801c6e:	ff 36                	push   (%esi)
+  801c70:	e8 c3 fb ff ff       	call   801838 <dev_lookup>
+  801c75:	83 c4 10             	add    $0x10,%esp
+  801c78:	85 c0                	test   %eax,%eax
+  801c7a:	78 31                	js     801cad <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801c7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c7f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801c83:	74 2f                	je     801cb4 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801c85:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801c88:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c8f:	00 00 00 
+	stat->st_isdir = 0;
+  801c92:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c99:	00 00 00 
+	stat->st_dev = dev;
+  801c9c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801ca2:	83 ec 08             	sub    $0x8,%esp
+  801ca5:	53                   	push   %ebx
+  801ca6:	56                   	push   %esi
+  801ca7:	ff 50 14             	call   *0x14(%eax)
+  801caa:	83 c4 10             	add    $0x10,%esp
+}
+  801cad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb0:	5b                   	pop    %ebx
+  801cb1:	5e                   	pop    %esi
+  801cb2:	5d                   	pop    %ebp
+  801cb3:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cb4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cb9:	eb f2                	jmp    801cad <fstat+0x67>
+
+00801cbb <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801cbb:	55                   	push   %ebp
+  801cbc:	89 e5                	mov    %esp,%ebp
+  801cbe:	56                   	push   %esi
+  801cbf:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801cc0:	83 ec 08             	sub    $0x8,%esp
+  801cc3:	6a 00                	push   $0x0
+  801cc5:	ff 75 08             	push   0x8(%ebp)
+  801cc8:	e8 e4 01 00 00       	call   801eb1 <open>
+  801ccd:	89 c3                	mov    %eax,%ebx
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  801cd2:	85 c0                	test   %eax,%eax
+  801cd4:	78 1b                	js     801cf1 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801cd6:	83 ec 08             	sub    $0x8,%esp
+  801cd9:	ff 75 0c             	push   0xc(%ebp)
+  801cdc:	50                   	push   %eax
+  801cdd:	e8 64 ff ff ff       	call   801c46 <fstat>
+  801ce2:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ce4:	89 1c 24             	mov    %ebx,(%esp)
+  801ce7:	e8 26 fc ff ff       	call   801912 <close>
+	return r;
+  801cec:	83 c4 10             	add    $0x10,%esp
+  801cef:	89 f3                	mov    %esi,%ebx
+}
+  801cf1:	89 d8                	mov    %ebx,%eax
+  801cf3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf6:	5b                   	pop    %ebx
+  801cf7:	5e                   	pop    %esi
+  801cf8:	5d                   	pop    %ebp
+  801cf9:	c3                   	ret
+
+00801cfa <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801cfa:	55                   	push   %ebp
+  801cfb:	89 e5                	mov    %esp,%ebp
+  801cfd:	56                   	push   %esi
+  801cfe:	53                   	push   %ebx
+  801cff:	89 c6                	mov    %eax,%esi
+  801d01:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801d03:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  801d0a:	74 27                	je     801d33 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d0c:	6a 07                	push   $0x7
+  801d0e:	68 00 60 80 00       	push   $0x806000
+  801d13:	56                   	push   %esi
+  801d14:	ff 35 10 50 80 00    	push   0x805010
+  801d1a:	e8 44 0e 00 00       	call   802b63 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801d1f:	83 c4 0c             	add    $0xc,%esp
+  801d22:	6a 00                	push   $0x0
+  801d24:	53                   	push   %ebx
+  801d25:	6a 00                	push   $0x0
+  801d27:	e8 bf 0d 00 00       	call   802aeb <ipc_recv>
+}
+  801d2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2f:	5b                   	pop    %ebx
+  801d30:	5e                   	pop    %esi
+  801d31:	5d                   	pop    %ebp
+  801d32:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d33:	83 ec 0c             	sub    $0xc,%esp
+  801d36:	6a 01                	push   $0x1
+  801d38:	e8 7a 0e 00 00       	call   802bb7 <ipc_find_env>
+  801d3d:	a3 10 50 80 00       	mov    %eax,0x805010
+  801d42:	83 c4 10             	add    $0x10,%esp
+  801d45:	eb c5                	jmp    801d0c <fsipc+0x12>
+
+00801d47 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d47:	55                   	push   %ebp
+  801d48:	89 e5                	mov    %esp,%ebp
+  801d4a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d50:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d53:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801d58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d5b:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801d60:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d65:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d6a:	e8 8b ff ff ff       	call   801cfa <fsipc>
+}
+  801d6f:	c9                   	leave
+  801d70:	c3                   	ret
+
+00801d71 <devfile_flush>:
+{
+  801d71:	55                   	push   %ebp
+  801d72:	89 e5                	mov    %esp,%ebp
+  801d74:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d77:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d7d:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801d82:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d87:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d8c:	e8 69 ff ff ff       	call   801cfa <fsipc>
+}
+  801d91:	c9                   	leave
+  801d92:	c3                   	ret
+
+00801d93 <devfile_stat>:
+{
+  801d93:	55                   	push   %ebp
+  801d94:	89 e5                	mov    %esp,%ebp
+  801d96:	53                   	push   %ebx
+  801d97:	83 ec 04             	sub    $0x4,%esp
+  801d9a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801da3:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801da8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dad:	b8 05 00 00 00       	mov    $0x5,%eax
+  801db2:	e8 43 ff ff ff       	call   801cfa <fsipc>
+  801db7:	85 c0                	test   %eax,%eax
+  801db9:	78 2c                	js     801de7 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dbb:	83 ec 08             	sub    $0x8,%esp
+  801dbe:	68 00 60 80 00       	push   $0x806000
+  801dc3:	53                   	push   %ebx
+  801dc4:	e8 10 f1 ff ff       	call   800ed9 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801dc9:	a1 80 60 80 00       	mov    0x806080,%eax
+  801dce:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801dd4:	a1 84 60 80 00       	mov    0x806084,%eax
+  801dd9:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801ddf:	83 c4 10             	add    $0x10,%esp
+  801de2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801de7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dea:	c9                   	leave
+  801deb:	c3                   	ret
+
+00801dec <devfile_write>:
+{
+  801dec:	55                   	push   %ebp
+  801ded:	89 e5                	mov    %esp,%ebp
+  801def:	83 ec 0c             	sub    $0xc,%esp
+  801df2:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801df5:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801dfa:	39 d0                	cmp    %edx,%eax
+  801dfc:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801dff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e02:	8b 52 0c             	mov    0xc(%edx),%edx
+  801e05:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801e0b:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801e10:	50                   	push   %eax
+  801e11:	ff 75 0c             	push   0xc(%ebp)
+  801e14:	68 08 60 80 00       	push   $0x806008
+  801e19:	e8 41 f2 ff ff       	call   80105f <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801e1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e23:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e28:	e8 cd fe ff ff       	call   801cfa <fsipc>
+}
+  801e2d:	c9                   	leave
+  801e2e:	c3                   	ret
+
+00801e2f <devfile_read>:
+{
+  801e2f:	55                   	push   %ebp
+  801e30:	89 e5                	mov    %esp,%ebp
+  801e32:	56                   	push   %esi
+  801e33:	53                   	push   %ebx
+  801e34:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e3d:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801e42:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e52:	e8 a3 fe ff ff       	call   801cfa <fsipc>
+  801e57:	89 c3                	mov    %eax,%ebx
+  801e59:	85 c0                	test   %eax,%eax
+  801e5b:	78 1f                	js     801e7c <devfile_read+0x4d>
+	assert(r <= n);
+  801e5d:	39 c6                	cmp    %eax,%esi
+  801e5f:	72 24                	jb     801e85 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801e61:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e66:	7f 33                	jg     801e9b <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e68:	83 ec 04             	sub    $0x4,%esp
+  801e6b:	50                   	push   %eax
+  801e6c:	68 00 60 80 00       	push   $0x806000
+  801e71:	ff 75 0c             	push   0xc(%ebp)
+  801e74:	e8 e6 f1 ff ff       	call   80105f <memmove>
+	return r;
+  801e79:	83 c4 10             	add    $0x10,%esp
+}
+  801e7c:	89 d8                	mov    %ebx,%eax
+  801e7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e81:	5b                   	pop    %ebx
+  801e82:	5e                   	pop    %esi
+  801e83:	5d                   	pop    %ebp
+  801e84:	c3                   	ret
+	assert(r <= n);
+  801e85:	68 3c 36 80 00       	push   $0x80363c
+  801e8a:	68 43 36 80 00       	push   $0x803643
+  801e8f:	6a 7c                	push   $0x7c
+  801e91:	68 58 36 80 00       	push   $0x803658
+  801e96:	e8 75 e9 ff ff       	call   800810 <_panic>
+	assert(r <= PGSIZE);
+  801e9b:	68 63 36 80 00       	push   $0x803663
+  801ea0:	68 43 36 80 00       	push   $0x803643
+  801ea5:	6a 7d                	push   $0x7d
+  801ea7:	68 58 36 80 00       	push   $0x803658
+  801eac:	e8 5f e9 ff ff       	call   800810 <_panic>
+
+00801eb1 <open>:
+{
+  801eb1:	55                   	push   %ebp
+  801eb2:	89 e5                	mov    %esp,%ebp
+  801eb4:	56                   	push   %esi
+  801eb5:	53                   	push   %ebx
+  801eb6:	83 ec 1c             	sub    $0x1c,%esp
+  801eb9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ebc:	56                   	push   %esi
+  801ebd:	e8 dc ef ff ff       	call   800e9e <strlen>
+  801ec2:	83 c4 10             	add    $0x10,%esp
+  801ec5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801eca:	7f 6c                	jg     801f38 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801ecc:	83 ec 0c             	sub    $0xc,%esp
+  801ecf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed2:	50                   	push   %eax
+  801ed3:	e8 ba f8 ff ff       	call   801792 <fd_alloc>
+  801ed8:	89 c3                	mov    %eax,%ebx
+  801eda:	83 c4 10             	add    $0x10,%esp
+  801edd:	85 c0                	test   %eax,%eax
+  801edf:	78 3c                	js     801f1d <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801ee1:	83 ec 08             	sub    $0x8,%esp
+  801ee4:	56                   	push   %esi
+  801ee5:	68 00 60 80 00       	push   $0x806000
+  801eea:	e8 ea ef ff ff       	call   800ed9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801eef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ef2:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ef7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801efa:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eff:	e8 f6 fd ff ff       	call   801cfa <fsipc>
+  801f04:	89 c3                	mov    %eax,%ebx
+  801f06:	83 c4 10             	add    $0x10,%esp
+  801f09:	85 c0                	test   %eax,%eax
+  801f0b:	78 19                	js     801f26 <open+0x75>
+	return fd2num(fd);
+  801f0d:	83 ec 0c             	sub    $0xc,%esp
+  801f10:	ff 75 f4             	push   -0xc(%ebp)
+  801f13:	e8 53 f8 ff ff       	call   80176b <fd2num>
+  801f18:	89 c3                	mov    %eax,%ebx
+  801f1a:	83 c4 10             	add    $0x10,%esp
+}
+  801f1d:	89 d8                	mov    %ebx,%eax
+  801f1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f22:	5b                   	pop    %ebx
+  801f23:	5e                   	pop    %esi
+  801f24:	5d                   	pop    %ebp
+  801f25:	c3                   	ret
+		fd_close(fd, 0);
+  801f26:	83 ec 08             	sub    $0x8,%esp
+  801f29:	6a 00                	push   $0x0
+  801f2b:	ff 75 f4             	push   -0xc(%ebp)
+  801f2e:	e8 58 f9 ff ff       	call   80188b <fd_close>
+		return r;
+  801f33:	83 c4 10             	add    $0x10,%esp
+  801f36:	eb e5                	jmp    801f1d <open+0x6c>
+		return -E_BAD_PATH;
+  801f38:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f3d:	eb de                	jmp    801f1d <open+0x6c>
+
+00801f3f <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801f3f:	55                   	push   %ebp
+  801f40:	89 e5                	mov    %esp,%ebp
+  801f42:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801f45:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4a:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f4f:	e8 a6 fd ff ff       	call   801cfa <fsipc>
+}
+  801f54:	c9                   	leave
+  801f55:	c3                   	ret
+
+00801f56 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f56:	55                   	push   %ebp
+  801f57:	89 e5                	mov    %esp,%ebp
+  801f59:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801f5c:	68 6f 36 80 00       	push   $0x80366f
+  801f61:	ff 75 0c             	push   0xc(%ebp)
+  801f64:	e8 70 ef ff ff       	call   800ed9 <strcpy>
+	return 0;
+}
+  801f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6e:	c9                   	leave
+  801f6f:	c3                   	ret
+
+00801f70 <devsock_close>:
+{
+  801f70:	55                   	push   %ebp
+  801f71:	89 e5                	mov    %esp,%ebp
+  801f73:	53                   	push   %ebx
+  801f74:	83 ec 10             	sub    $0x10,%esp
+  801f77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801f7a:	53                   	push   %ebx
+  801f7b:	e8 47 0c 00 00       	call   802bc7 <pageref>
+  801f80:	89 c2                	mov    %eax,%edx
+  801f82:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801f85:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801f8a:	83 fa 01             	cmp    $0x1,%edx
+  801f8d:	74 05                	je     801f94 <devsock_close+0x24>
+}
+  801f8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f92:	c9                   	leave
+  801f93:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801f94:	83 ec 0c             	sub    $0xc,%esp
+  801f97:	ff 73 0c             	push   0xc(%ebx)
+  801f9a:	e8 b7 02 00 00       	call   802256 <nsipc_close>
+  801f9f:	83 c4 10             	add    $0x10,%esp
+  801fa2:	eb eb                	jmp    801f8f <devsock_close+0x1f>
+
+00801fa4 <devsock_write>:
+{
+  801fa4:	55                   	push   %ebp
+  801fa5:	89 e5                	mov    %esp,%ebp
+  801fa7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801faa:	6a 00                	push   $0x0
+  801fac:	ff 75 10             	push   0x10(%ebp)
+  801faf:	ff 75 0c             	push   0xc(%ebp)
+  801fb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb5:	ff 70 0c             	push   0xc(%eax)
+  801fb8:	e8 79 03 00 00       	call   802336 <nsipc_send>
+}
+  801fbd:	c9                   	leave
+  801fbe:	c3                   	ret
+
+00801fbf <devsock_read>:
+{
+  801fbf:	55                   	push   %ebp
+  801fc0:	89 e5                	mov    %esp,%ebp
+  801fc2:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801fc5:	6a 00                	push   $0x0
+  801fc7:	ff 75 10             	push   0x10(%ebp)
+  801fca:	ff 75 0c             	push   0xc(%ebp)
+  801fcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd0:	ff 70 0c             	push   0xc(%eax)
+  801fd3:	e8 ef 02 00 00       	call   8022c7 <nsipc_recv>
+}
+  801fd8:	c9                   	leave
+  801fd9:	c3                   	ret
+
+00801fda <fd2sockid>:
+{
+  801fda:	55                   	push   %ebp
+  801fdb:	89 e5                	mov    %esp,%ebp
+  801fdd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801fe0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801fe3:	52                   	push   %edx
+  801fe4:	50                   	push   %eax
+  801fe5:	e8 fe f7 ff ff       	call   8017e8 <fd_lookup>
+  801fea:	83 c4 10             	add    $0x10,%esp
+  801fed:	85 c0                	test   %eax,%eax
+  801fef:	78 10                	js     802001 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801ff1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ff4:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801ffa:	39 08                	cmp    %ecx,(%eax)
+  801ffc:	75 05                	jne    802003 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801ffe:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802001:	c9                   	leave
+  802002:	c3                   	ret
+		return -E_NOT_SUPP;
+  802003:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802008:	eb f7                	jmp    802001 <fd2sockid+0x27>
+
+0080200a <alloc_sockfd>:
+{
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	56                   	push   %esi
+  80200e:	53                   	push   %ebx
+  80200f:	83 ec 1c             	sub    $0x1c,%esp
+  802012:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802014:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802017:	50                   	push   %eax
+  802018:	e8 75 f7 ff ff       	call   801792 <fd_alloc>
+  80201d:	89 c3                	mov    %eax,%ebx
+  80201f:	83 c4 10             	add    $0x10,%esp
+  802022:	85 c0                	test   %eax,%eax
+  802024:	78 43                	js     802069 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802026:	83 ec 04             	sub    $0x4,%esp
+  802029:	68 07 04 00 00       	push   $0x407
+  80202e:	ff 75 f4             	push   -0xc(%ebp)
+  802031:	6a 00                	push   $0x0
+  802033:	e8 0e f3 ff ff       	call   801346 <sys_page_alloc>
+  802038:	89 c3                	mov    %eax,%ebx
+  80203a:	83 c4 10             	add    $0x10,%esp
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	78 28                	js     802069 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802041:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802044:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  80204a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80204c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80204f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802056:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802059:	83 ec 0c             	sub    $0xc,%esp
+  80205c:	50                   	push   %eax
+  80205d:	e8 09 f7 ff ff       	call   80176b <fd2num>
+  802062:	89 c3                	mov    %eax,%ebx
+  802064:	83 c4 10             	add    $0x10,%esp
+  802067:	eb 0c                	jmp    802075 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802069:	83 ec 0c             	sub    $0xc,%esp
+  80206c:	56                   	push   %esi
+  80206d:	e8 e4 01 00 00       	call   802256 <nsipc_close>
+		return r;
+  802072:	83 c4 10             	add    $0x10,%esp
+}
+  802075:	89 d8                	mov    %ebx,%eax
+  802077:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80207a:	5b                   	pop    %ebx
+  80207b:	5e                   	pop    %esi
+  80207c:	5d                   	pop    %ebp
+  80207d:	c3                   	ret
+
+0080207e <accept>:
+{
+  80207e:	55                   	push   %ebp
+  80207f:	89 e5                	mov    %esp,%ebp
+  802081:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802084:	8b 45 08             	mov    0x8(%ebp),%eax
+  802087:	e8 4e ff ff ff       	call   801fda <fd2sockid>
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	78 1b                	js     8020ab <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802090:	83 ec 04             	sub    $0x4,%esp
+  802093:	ff 75 10             	push   0x10(%ebp)
+  802096:	ff 75 0c             	push   0xc(%ebp)
+  802099:	50                   	push   %eax
+  80209a:	e8 0e 01 00 00       	call   8021ad <nsipc_accept>
+  80209f:	83 c4 10             	add    $0x10,%esp
+  8020a2:	85 c0                	test   %eax,%eax
+  8020a4:	78 05                	js     8020ab <accept+0x2d>
+	return alloc_sockfd(r);
+  8020a6:	e8 5f ff ff ff       	call   80200a <alloc_sockfd>
+}
+  8020ab:	c9                   	leave
+  8020ac:	c3                   	ret
+
+008020ad <bind>:
+{
+  8020ad:	55                   	push   %ebp
+  8020ae:	89 e5                	mov    %esp,%ebp
+  8020b0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8020b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b6:	e8 1f ff ff ff       	call   801fda <fd2sockid>
+  8020bb:	85 c0                	test   %eax,%eax
+  8020bd:	78 12                	js     8020d1 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8020bf:	83 ec 04             	sub    $0x4,%esp
+  8020c2:	ff 75 10             	push   0x10(%ebp)
+  8020c5:	ff 75 0c             	push   0xc(%ebp)
+  8020c8:	50                   	push   %eax
+  8020c9:	e8 31 01 00 00       	call   8021ff <nsipc_bind>
+  8020ce:	83 c4 10             	add    $0x10,%esp
+}
+  8020d1:	c9                   	leave
+  8020d2:	c3                   	ret
+
+008020d3 <shutdown>:
+{
+  8020d3:	55                   	push   %ebp
+  8020d4:	89 e5                	mov    %esp,%ebp
+  8020d6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8020d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020dc:	e8 f9 fe ff ff       	call   801fda <fd2sockid>
+  8020e1:	85 c0                	test   %eax,%eax
+  8020e3:	78 0f                	js     8020f4 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8020e5:	83 ec 08             	sub    $0x8,%esp
+  8020e8:	ff 75 0c             	push   0xc(%ebp)
+  8020eb:	50                   	push   %eax
+  8020ec:	e8 43 01 00 00       	call   802234 <nsipc_shutdown>
+  8020f1:	83 c4 10             	add    $0x10,%esp
+}
+  8020f4:	c9                   	leave
+  8020f5:	c3                   	ret
+
+008020f6 <connect>:
+{
+  8020f6:	55                   	push   %ebp
+  8020f7:	89 e5                	mov    %esp,%ebp
+  8020f9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8020fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ff:	e8 d6 fe ff ff       	call   801fda <fd2sockid>
+  802104:	85 c0                	test   %eax,%eax
+  802106:	78 12                	js     80211a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802108:	83 ec 04             	sub    $0x4,%esp
+  80210b:	ff 75 10             	push   0x10(%ebp)
+  80210e:	ff 75 0c             	push   0xc(%ebp)
+  802111:	50                   	push   %eax
+  802112:	e8 59 01 00 00       	call   802270 <nsipc_connect>
+  802117:	83 c4 10             	add    $0x10,%esp
+}
+  80211a:	c9                   	leave
+  80211b:	c3                   	ret
+
+0080211c <listen>:
+{
+  80211c:	55                   	push   %ebp
+  80211d:	89 e5                	mov    %esp,%ebp
+  80211f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802122:	8b 45 08             	mov    0x8(%ebp),%eax
+  802125:	e8 b0 fe ff ff       	call   801fda <fd2sockid>
+  80212a:	85 c0                	test   %eax,%eax
+  80212c:	78 0f                	js     80213d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80212e:	83 ec 08             	sub    $0x8,%esp
+  802131:	ff 75 0c             	push   0xc(%ebp)
+  802134:	50                   	push   %eax
+  802135:	e8 6b 01 00 00       	call   8022a5 <nsipc_listen>
+  80213a:	83 c4 10             	add    $0x10,%esp
+}
+  80213d:	c9                   	leave
+  80213e:	c3                   	ret
+
+0080213f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80213f:	55                   	push   %ebp
+  802140:	89 e5                	mov    %esp,%ebp
+  802142:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802145:	ff 75 10             	push   0x10(%ebp)
+  802148:	ff 75 0c             	push   0xc(%ebp)
+  80214b:	ff 75 08             	push   0x8(%ebp)
+  80214e:	e8 41 02 00 00       	call   802394 <nsipc_socket>
+  802153:	83 c4 10             	add    $0x10,%esp
+  802156:	85 c0                	test   %eax,%eax
+  802158:	78 05                	js     80215f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80215a:	e8 ab fe ff ff       	call   80200a <alloc_sockfd>
+}
+  80215f:	c9                   	leave
+  802160:	c3                   	ret
+
+00802161 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802161:	55                   	push   %ebp
+  802162:	89 e5                	mov    %esp,%ebp
+  802164:	53                   	push   %ebx
+  802165:	83 ec 04             	sub    $0x4,%esp
+  802168:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80216a:	83 3d 14 50 80 00 00 	cmpl   $0x0,0x805014
+  802171:	74 26                	je     802199 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802173:	6a 07                	push   $0x7
+  802175:	68 00 70 80 00       	push   $0x807000
+  80217a:	53                   	push   %ebx
+  80217b:	ff 35 14 50 80 00    	push   0x805014
+  802181:	e8 dd 09 00 00       	call   802b63 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802186:	83 c4 0c             	add    $0xc,%esp
+  802189:	6a 00                	push   $0x0
+  80218b:	6a 00                	push   $0x0
+  80218d:	6a 00                	push   $0x0
+  80218f:	e8 57 09 00 00       	call   802aeb <ipc_recv>
+}
+  802194:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802197:	c9                   	leave
+  802198:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802199:	83 ec 0c             	sub    $0xc,%esp
+  80219c:	6a 02                	push   $0x2
+  80219e:	e8 14 0a 00 00       	call   802bb7 <ipc_find_env>
+  8021a3:	a3 14 50 80 00       	mov    %eax,0x805014
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	eb c6                	jmp    802173 <nsipc+0x12>
+
+008021ad <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8021ad:	55                   	push   %ebp
+  8021ae:	89 e5                	mov    %esp,%ebp
+  8021b0:	56                   	push   %esi
+  8021b1:	53                   	push   %ebx
+  8021b2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8021b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8021bd:	8b 06                	mov    (%esi),%eax
+  8021bf:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8021c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021c9:	e8 93 ff ff ff       	call   802161 <nsipc>
+  8021ce:	89 c3                	mov    %eax,%ebx
+  8021d0:	85 c0                	test   %eax,%eax
+  8021d2:	79 09                	jns    8021dd <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8021d4:	89 d8                	mov    %ebx,%eax
+  8021d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021d9:	5b                   	pop    %ebx
+  8021da:	5e                   	pop    %esi
+  8021db:	5d                   	pop    %ebp
+  8021dc:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8021dd:	83 ec 04             	sub    $0x4,%esp
+  8021e0:	ff 35 10 70 80 00    	push   0x807010
+  8021e6:	68 00 70 80 00       	push   $0x807000
+  8021eb:	ff 75 0c             	push   0xc(%ebp)
+  8021ee:	e8 6c ee ff ff       	call   80105f <memmove>
+		*addrlen = ret->ret_addrlen;
+  8021f3:	a1 10 70 80 00       	mov    0x807010,%eax
+  8021f8:	89 06                	mov    %eax,(%esi)
+  8021fa:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8021fd:	eb d5                	jmp    8021d4 <nsipc_accept+0x27>
+
+008021ff <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8021ff:	55                   	push   %ebp
+  802200:	89 e5                	mov    %esp,%ebp
+  802202:	53                   	push   %ebx
+  802203:	83 ec 08             	sub    $0x8,%esp
+  802206:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802209:	8b 45 08             	mov    0x8(%ebp),%eax
+  80220c:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802211:	53                   	push   %ebx
+  802212:	ff 75 0c             	push   0xc(%ebp)
+  802215:	68 04 70 80 00       	push   $0x807004
+  80221a:	e8 40 ee ff ff       	call   80105f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80221f:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802225:	b8 02 00 00 00       	mov    $0x2,%eax
+  80222a:	e8 32 ff ff ff       	call   802161 <nsipc>
+}
+  80222f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802232:	c9                   	leave
+  802233:	c3                   	ret
+
+00802234 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802234:	55                   	push   %ebp
+  802235:	89 e5                	mov    %esp,%ebp
+  802237:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80223a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80223d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802242:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802245:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80224a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80224f:	e8 0d ff ff ff       	call   802161 <nsipc>
+}
+  802254:	c9                   	leave
+  802255:	c3                   	ret
+
+00802256 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802256:	55                   	push   %ebp
+  802257:	89 e5                	mov    %esp,%ebp
+  802259:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80225c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80225f:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802264:	b8 04 00 00 00       	mov    $0x4,%eax
+  802269:	e8 f3 fe ff ff       	call   802161 <nsipc>
+}
+  80226e:	c9                   	leave
+  80226f:	c3                   	ret
+
+00802270 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802270:	55                   	push   %ebp
+  802271:	89 e5                	mov    %esp,%ebp
+  802273:	53                   	push   %ebx
+  802274:	83 ec 08             	sub    $0x8,%esp
+  802277:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80227a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227d:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802282:	53                   	push   %ebx
+  802283:	ff 75 0c             	push   0xc(%ebp)
+  802286:	68 04 70 80 00       	push   $0x807004
+  80228b:	e8 cf ed ff ff       	call   80105f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802290:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802296:	b8 05 00 00 00       	mov    $0x5,%eax
+  80229b:	e8 c1 fe ff ff       	call   802161 <nsipc>
+}
+  8022a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022a3:	c9                   	leave
+  8022a4:	c3                   	ret
+
+008022a5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8022a5:	55                   	push   %ebp
+  8022a6:	89 e5                	mov    %esp,%ebp
+  8022a8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8022ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ae:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8022b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022b6:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8022bb:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022c0:	e8 9c fe ff ff       	call   802161 <nsipc>
+}
+  8022c5:	c9                   	leave
+  8022c6:	c3                   	ret
+
+008022c7 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8022c7:	55                   	push   %ebp
+  8022c8:	89 e5                	mov    %esp,%ebp
+  8022ca:	56                   	push   %esi
+  8022cb:	53                   	push   %ebx
+  8022cc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8022cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8022d7:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8022dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022e0:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8022e5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8022ea:	e8 72 fe ff ff       	call   802161 <nsipc>
+  8022ef:	89 c3                	mov    %eax,%ebx
+  8022f1:	85 c0                	test   %eax,%eax
+  8022f3:	78 22                	js     802317 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8022f5:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8022fa:	39 c6                	cmp    %eax,%esi
+  8022fc:	0f 4e c6             	cmovle %esi,%eax
+  8022ff:	39 c3                	cmp    %eax,%ebx
+  802301:	7f 1d                	jg     802320 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802303:	83 ec 04             	sub    $0x4,%esp
+  802306:	53                   	push   %ebx
+  802307:	68 00 70 80 00       	push   $0x807000
+  80230c:	ff 75 0c             	push   0xc(%ebp)
+  80230f:	e8 4b ed ff ff       	call   80105f <memmove>
+  802314:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802317:	89 d8                	mov    %ebx,%eax
+  802319:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80231c:	5b                   	pop    %ebx
+  80231d:	5e                   	pop    %esi
+  80231e:	5d                   	pop    %ebp
+  80231f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802320:	68 7b 36 80 00       	push   $0x80367b
+  802325:	68 43 36 80 00       	push   $0x803643
+  80232a:	6a 62                	push   $0x62
+  80232c:	68 90 36 80 00       	push   $0x803690
+  802331:	e8 da e4 ff ff       	call   800810 <_panic>
+
+00802336 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802336:	55                   	push   %ebp
+  802337:	89 e5                	mov    %esp,%ebp
+  802339:	53                   	push   %ebx
+  80233a:	83 ec 04             	sub    $0x4,%esp
+  80233d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802340:	8b 45 08             	mov    0x8(%ebp),%eax
+  802343:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802348:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80234e:	7f 2e                	jg     80237e <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802350:	83 ec 04             	sub    $0x4,%esp
+  802353:	53                   	push   %ebx
+  802354:	ff 75 0c             	push   0xc(%ebp)
+  802357:	68 0c 70 80 00       	push   $0x80700c
+  80235c:	e8 fe ec ff ff       	call   80105f <memmove>
+	nsipcbuf.send.req_size = size;
+  802361:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802367:	8b 45 14             	mov    0x14(%ebp),%eax
+  80236a:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80236f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802374:	e8 e8 fd ff ff       	call   802161 <nsipc>
+}
+  802379:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80237c:	c9                   	leave
+  80237d:	c3                   	ret
+	assert(size < 1600);
+  80237e:	68 9c 36 80 00       	push   $0x80369c
+  802383:	68 43 36 80 00       	push   $0x803643
+  802388:	6a 6d                	push   $0x6d
+  80238a:	68 90 36 80 00       	push   $0x803690
+  80238f:	e8 7c e4 ff ff       	call   800810 <_panic>
+
+00802394 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802394:	55                   	push   %ebp
+  802395:	89 e5                	mov    %esp,%ebp
+  802397:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80239a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  8023a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a5:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8023aa:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023ad:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8023b2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8023b7:	e8 a5 fd ff ff       	call   802161 <nsipc>
+}
+  8023bc:	c9                   	leave
+  8023bd:	c3                   	ret
+
+008023be <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8023be:	55                   	push   %ebp
+  8023bf:	89 e5                	mov    %esp,%ebp
+  8023c1:	53                   	push   %ebx
+  8023c2:	83 ec 04             	sub    $0x4,%esp
+  8023c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint8_t *c;
+	uint32_t *ref;
+	int npages;
+
+	if (v == 0)
+  8023c8:	85 db                	test   %ebx,%ebx
+  8023ca:	0f 84 8a 00 00 00    	je     80245a <free+0x9c>
+		return;
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8023d0:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8023d6:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8023db:	77 45                	ja     802422 <free+0x64>
+
+	c = ROUNDDOWN(v, PGSIZE);
+  8023dd:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8023e3:	89 d9                	mov    %ebx,%ecx
+
+	for (npages = 0; uvpt[PGNUM(c + npages * PGSIZE)] & PTE_CONTINUED; npages++)
+  8023e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ea:	89 da                	mov    %ebx,%edx
+  8023ec:	c1 ea 0c             	shr    $0xc,%edx
+  8023ef:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8023f6:	f6 c6 02             	test   $0x2,%dh
+  8023f9:	74 3d                	je     802438 <free+0x7a>
+		assert(c + (npages + 1) * PGSIZE < mend);
+  8023fb:	83 c0 01             	add    $0x1,%eax
+  8023fe:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802404:	81 fb ff ff ff 0f    	cmp    $0xfffffff,%ebx
+  80240a:	76 de                	jbe    8023ea <free+0x2c>
+  80240c:	68 d8 36 80 00       	push   $0x8036d8
+  802411:	68 43 36 80 00       	push   $0x803643
+  802416:	6a 7f                	push   $0x7f
+  802418:	68 f9 36 80 00       	push   $0x8036f9
+  80241d:	e8 ee e3 ff ff       	call   800810 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802422:	68 a8 36 80 00       	push   $0x8036a8
+  802427:	68 43 36 80 00       	push   $0x803643
+  80242c:	6a 7a                	push   $0x7a
+  80242e:	68 f9 36 80 00       	push   $0x8036f9
+  802433:	e8 d8 e3 ff ff       	call   800810 <_panic>
+	sys_page_unmap_range(0, c, npages);
+  802438:	83 ec 04             	sub    $0x4,%esp
+  80243b:	50                   	push   %eax
+  80243c:	51                   	push   %ecx
+  80243d:	6a 00                	push   $0x0
+  80243f:	e8 b4 f0 ff ff       	call   8014f8 <sys_page_unmap_range>
+	/*
+	 * c is just a piece of this page, so dec the ref count
+	 * and maybe free the page.
+	 */
+	ref = (uint32_t*) (c + PGSIZE - 4);
+	if (--(*ref) == 0)
+  802444:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  80244a:	83 e8 01             	sub    $0x1,%eax
+  80244d:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802453:	83 c4 10             	add    $0x10,%esp
+  802456:	85 c0                	test   %eax,%eax
+  802458:	74 05                	je     80245f <free+0xa1>
+		sys_page_unmap(0, c);
+}
+  80245a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80245d:	c9                   	leave
+  80245e:	c3                   	ret
+		sys_page_unmap(0, c);
+  80245f:	83 ec 08             	sub    $0x8,%esp
+  802462:	53                   	push   %ebx
+  802463:	6a 00                	push   $0x0
+  802465:	e8 a4 ef ff ff       	call   80140e <sys_page_unmap>
+  80246a:	83 c4 10             	add    $0x10,%esp
+  80246d:	eb eb                	jmp    80245a <free+0x9c>
+
+0080246f <malloc>:
+{
+  80246f:	55                   	push   %ebp
+  802470:	89 e5                	mov    %esp,%ebp
+  802472:	57                   	push   %edi
+  802473:	56                   	push   %esi
+  802474:	53                   	push   %ebx
+  802475:	83 ec 1c             	sub    $0x1c,%esp
+	if (mptr == 0)
+  802478:	a1 18 50 80 00       	mov    0x805018,%eax
+  80247d:	85 c0                	test   %eax,%eax
+  80247f:	74 6d                	je     8024ee <malloc+0x7f>
+	n = ROUNDUP(n, 4);
+  802481:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802484:	8d 5f 03             	lea    0x3(%edi),%ebx
+  802487:	83 e3 fc             	and    $0xfffffffc,%ebx
+	if (n >= MAXMALLOC)
+  80248a:	81 fb ff ff 0f 00    	cmp    $0xfffff,%ebx
+  802490:	0f 87 90 01 00 00    	ja     802626 <malloc+0x1b7>
+	if ((uintptr_t) mptr % PGSIZE){
+  802496:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80249b:	74 30                	je     8024cd <malloc+0x5e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  80249d:	89 c6                	mov    %eax,%esi
+  80249f:	c1 ee 0c             	shr    $0xc,%esi
+  8024a2:	8d 54 18 03          	lea    0x3(%eax,%ebx,1),%edx
+  8024a6:	c1 ea 0c             	shr    $0xc,%edx
+  8024a9:	39 d6                	cmp    %edx,%esi
+  8024ab:	74 61                	je     80250e <malloc+0x9f>
+		free(mptr);	/* drop reference to this page */
+  8024ad:	83 ec 0c             	sub    $0xc,%esp
+  8024b0:	50                   	push   %eax
+  8024b1:	e8 08 ff ff ff       	call   8023be <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8024b6:	a1 18 50 80 00       	mov    0x805018,%eax
+  8024bb:	05 00 10 00 00       	add    $0x1000,%eax
+  8024c0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8024c5:	a3 18 50 80 00       	mov    %eax,0x805018
+  8024ca:	83 c4 10             	add    $0x10,%esp
+  8024cd:	8b 0d 18 50 80 00    	mov    0x805018,%ecx
+{
+  8024d3:	c7 45 e0 02 00 00 00 	movl   $0x2,-0x20(%ebp)
+  8024da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024df:	8d 53 04             	lea    0x4(%ebx),%edx
+  8024e2:	89 ce                	mov    %ecx,%esi
+  8024e4:	01 d1                	add    %edx,%ecx
+  8024e6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8024e9:	e9 88 00 00 00       	jmp    802576 <malloc+0x107>
+		mptr = mbegin;
+  8024ee:	c7 05 18 50 80 00 00 	movl   $0x8000000,0x805018
+  8024f5:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8024f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024fb:	8d 5f 03             	lea    0x3(%edi),%ebx
+  8024fe:	83 e3 fc             	and    $0xfffffffc,%ebx
+	if (n >= MAXMALLOC)
+  802501:	81 fb ff ff 0f 00    	cmp    $0xfffff,%ebx
+  802507:	76 c4                	jbe    8024cd <malloc+0x5e>
+  802509:	e9 f5 00 00 00       	jmp    802603 <malloc+0x194>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  80250e:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  802514:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+			(*ref)++;
+  80251a:	83 42 fc 01          	addl   $0x1,-0x4(%edx)
+			mptr += n;
+  80251e:	01 c3                	add    %eax,%ebx
+  802520:	89 1d 18 50 80 00    	mov    %ebx,0x805018
+			return v;
+  802526:	e9 d8 00 00 00       	jmp    802603 <malloc+0x194>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80252b:	05 00 10 00 00       	add    $0x1000,%eax
+  802530:	39 c8                	cmp    %ecx,%eax
+  802532:	73 69                	jae    80259d <malloc+0x12e>
+		if (va >= (uintptr_t) mend
+  802534:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802539:	77 22                	ja     80255d <malloc+0xee>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  80253b:	89 c2                	mov    %eax,%edx
+  80253d:	c1 ea 16             	shr    $0x16,%edx
+  802540:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802547:	f6 c2 01             	test   $0x1,%dl
+  80254a:	74 df                	je     80252b <malloc+0xbc>
+  80254c:	89 c2                	mov    %eax,%edx
+  80254e:	c1 ea 0c             	shr    $0xc,%edx
+  802551:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802558:	f6 c2 01             	test   $0x1,%dl
+  80255b:	74 ce                	je     80252b <malloc+0xbc>
+		if (mptr == mend) {
+  80255d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802563:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802569:	bf 01 00 00 00       	mov    $0x1,%edi
+  80256e:	81 fe 00 00 00 10    	cmp    $0x10000000,%esi
+  802574:	74 04                	je     80257a <malloc+0x10b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802576:	89 f0                	mov    %esi,%eax
+  802578:	eb b6                	jmp    802530 <malloc+0xc1>
+			mptr = mbegin;
+  80257a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80257d:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+			if (++nwrap == 2)
+  802582:	83 6d e0 01          	subl   $0x1,-0x20(%ebp)
+  802586:	0f 85 56 ff ff ff    	jne    8024e2 <malloc+0x73>
+  80258c:	c7 05 18 50 80 00 00 	movl   $0x8000000,0x805018
+  802593:	00 00 08 
+				return 0;	/* out of address space */
+  802596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259b:	eb 66                	jmp    802603 <malloc+0x194>
+  80259d:	89 f0                	mov    %esi,%eax
+  80259f:	89 f9                	mov    %edi,%ecx
+  8025a1:	84 c9                	test   %cl,%cl
+  8025a3:	74 06                	je     8025ab <malloc+0x13c>
+  8025a5:	89 35 18 50 80 00    	mov    %esi,0x805018
+	npages = ROUNDUP(n + 4, PGSIZE) / PGSIZE;
+  8025ab:	8d bb 03 10 00 00    	lea    0x1003(%ebx),%edi
+  8025b1:	c1 ef 0c             	shr    $0xc,%edi
+	if (sys_page_alloc_range(0, mptr, npages - 1, PTE_P|PTE_U|PTE_W|PTE_CONTINUED) != npages - 1
+  8025b4:	8d 77 ff             	lea    -0x1(%edi),%esi
+  8025b7:	68 07 02 00 00       	push   $0x207
+  8025bc:	56                   	push   %esi
+  8025bd:	50                   	push   %eax
+  8025be:	6a 00                	push   $0x0
+  8025c0:	e8 8b ee ff ff       	call   801450 <sys_page_alloc_range>
+  8025c5:	83 c4 10             	add    $0x10,%esp
+  8025c8:	39 c6                	cmp    %eax,%esi
+  8025ca:	75 3f                	jne    80260b <malloc+0x19c>
+	    || sys_page_alloc(0, mptr + (npages - 1) * PGSIZE, PTE_P|PTE_U|PTE_W) < 0) {
+  8025cc:	c1 e6 0c             	shl    $0xc,%esi
+  8025cf:	83 ec 04             	sub    $0x4,%esp
+  8025d2:	6a 07                	push   $0x7
+  8025d4:	89 f0                	mov    %esi,%eax
+  8025d6:	03 05 18 50 80 00    	add    0x805018,%eax
+  8025dc:	50                   	push   %eax
+  8025dd:	6a 00                	push   $0x0
+  8025df:	e8 62 ed ff ff       	call   801346 <sys_page_alloc>
+  8025e4:	83 c4 10             	add    $0x10,%esp
+  8025e7:	85 c0                	test   %eax,%eax
+  8025e9:	78 20                	js     80260b <malloc+0x19c>
+	ref = (uint32_t*) (mptr + npages * PGSIZE - 4);
+  8025eb:	a1 18 50 80 00       	mov    0x805018,%eax
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  8025f0:	c7 84 30 fc 0f 00 00 	movl   $0x2,0xffc(%eax,%esi,1)
+  8025f7:	02 00 00 00 
+	mptr += n;
+  8025fb:	01 c3                	add    %eax,%ebx
+  8025fd:	89 1d 18 50 80 00    	mov    %ebx,0x805018
+}
+  802603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802606:	5b                   	pop    %ebx
+  802607:	5e                   	pop    %esi
+  802608:	5f                   	pop    %edi
+  802609:	5d                   	pop    %ebp
+  80260a:	c3                   	ret
+		sys_page_unmap_range(0, mptr, npages);
+  80260b:	83 ec 04             	sub    $0x4,%esp
+  80260e:	57                   	push   %edi
+  80260f:	ff 35 18 50 80 00    	push   0x805018
+  802615:	6a 00                	push   $0x0
+  802617:	e8 dc ee ff ff       	call   8014f8 <sys_page_unmap_range>
+		return 0;	/* out of physical memory */
+  80261c:	83 c4 10             	add    $0x10,%esp
+  80261f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802624:	eb dd                	jmp    802603 <malloc+0x194>
+		return 0;
+  802626:	b8 00 00 00 00       	mov    $0x0,%eax
+  80262b:	eb d6                	jmp    802603 <malloc+0x194>
+
+0080262d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80262d:	55                   	push   %ebp
+  80262e:	89 e5                	mov    %esp,%ebp
+  802630:	56                   	push   %esi
+  802631:	53                   	push   %ebx
+  802632:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802635:	83 ec 0c             	sub    $0xc,%esp
+  802638:	ff 75 08             	push   0x8(%ebp)
+  80263b:	e8 3b f1 ff ff       	call   80177b <fd2data>
+  802640:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802642:	83 c4 08             	add    $0x8,%esp
+  802645:	68 06 37 80 00       	push   $0x803706
+  80264a:	53                   	push   %ebx
+  80264b:	e8 89 e8 ff ff       	call   800ed9 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802650:	8b 46 04             	mov    0x4(%esi),%eax
+  802653:	2b 06                	sub    (%esi),%eax
+  802655:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80265b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802662:	00 00 00 
+	stat->st_dev = &devpipe;
+  802665:	c7 83 88 00 00 00 5c 	movl   $0x80405c,0x88(%ebx)
+  80266c:	40 80 00 
+	return 0;
+}
+  80266f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802674:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802677:	5b                   	pop    %ebx
+  802678:	5e                   	pop    %esi
+  802679:	5d                   	pop    %ebp
+  80267a:	c3                   	ret
+
+0080267b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80267b:	55                   	push   %ebp
+  80267c:	89 e5                	mov    %esp,%ebp
+  80267e:	53                   	push   %ebx
+  80267f:	83 ec 0c             	sub    $0xc,%esp
+  802682:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802685:	53                   	push   %ebx
+  802686:	6a 00                	push   $0x0
+  802688:	e8 81 ed ff ff       	call   80140e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80268d:	89 1c 24             	mov    %ebx,(%esp)
+  802690:	e8 e6 f0 ff ff       	call   80177b <fd2data>
+  802695:	83 c4 08             	add    $0x8,%esp
+  802698:	50                   	push   %eax
+  802699:	6a 00                	push   $0x0
+  80269b:	e8 6e ed ff ff       	call   80140e <sys_page_unmap>
+}
+  8026a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026a3:	c9                   	leave
+  8026a4:	c3                   	ret
+
+008026a5 <_pipeisclosed>:
+{
+  8026a5:	55                   	push   %ebp
+  8026a6:	89 e5                	mov    %esp,%ebp
+  8026a8:	57                   	push   %edi
+  8026a9:	56                   	push   %esi
+  8026aa:	53                   	push   %ebx
+  8026ab:	83 ec 1c             	sub    $0x1c,%esp
+  8026ae:	89 c7                	mov    %eax,%edi
+  8026b0:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8026b2:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  8026b7:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8026ba:	83 ec 0c             	sub    $0xc,%esp
+  8026bd:	57                   	push   %edi
+  8026be:	e8 04 05 00 00       	call   802bc7 <pageref>
+  8026c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026c6:	89 34 24             	mov    %esi,(%esp)
+  8026c9:	e8 f9 04 00 00       	call   802bc7 <pageref>
+		nn = thisenv->env_runs;
+  8026ce:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+  8026d4:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8026d7:	83 c4 10             	add    $0x10,%esp
+  8026da:	39 cb                	cmp    %ecx,%ebx
+  8026dc:	74 1b                	je     8026f9 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8026de:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8026e1:	75 cf                	jne    8026b2 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8026e3:	8b 42 5c             	mov    0x5c(%edx),%eax
+  8026e6:	6a 01                	push   $0x1
+  8026e8:	50                   	push   %eax
+  8026e9:	53                   	push   %ebx
+  8026ea:	68 0d 37 80 00       	push   $0x80370d
+  8026ef:	e8 f7 e1 ff ff       	call   8008eb <cprintf>
+  8026f4:	83 c4 10             	add    $0x10,%esp
+  8026f7:	eb b9                	jmp    8026b2 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8026f9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8026fc:	0f 94 c0             	sete   %al
+  8026ff:	0f b6 c0             	movzbl %al,%eax
+}
+  802702:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802705:	5b                   	pop    %ebx
+  802706:	5e                   	pop    %esi
+  802707:	5f                   	pop    %edi
+  802708:	5d                   	pop    %ebp
+  802709:	c3                   	ret
+
+0080270a <devpipe_write>:
+{
+  80270a:	55                   	push   %ebp
+  80270b:	89 e5                	mov    %esp,%ebp
+  80270d:	57                   	push   %edi
+  80270e:	56                   	push   %esi
+  80270f:	53                   	push   %ebx
+  802710:	83 ec 28             	sub    $0x28,%esp
+  802713:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802716:	56                   	push   %esi
+  802717:	e8 5f f0 ff ff       	call   80177b <fd2data>
+  80271c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80271e:	83 c4 10             	add    $0x10,%esp
+  802721:	bf 00 00 00 00       	mov    $0x0,%edi
+  802726:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802729:	75 09                	jne    802734 <devpipe_write+0x2a>
+	return i;
+  80272b:	89 f8                	mov    %edi,%eax
+  80272d:	eb 23                	jmp    802752 <devpipe_write+0x48>
+			sys_yield();
+  80272f:	e8 92 eb ff ff       	call   8012c6 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802734:	8b 43 04             	mov    0x4(%ebx),%eax
+  802737:	8b 0b                	mov    (%ebx),%ecx
+  802739:	8d 51 20             	lea    0x20(%ecx),%edx
+  80273c:	39 d0                	cmp    %edx,%eax
+  80273e:	72 1a                	jb     80275a <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802740:	89 da                	mov    %ebx,%edx
+  802742:	89 f0                	mov    %esi,%eax
+  802744:	e8 5c ff ff ff       	call   8026a5 <_pipeisclosed>
+  802749:	85 c0                	test   %eax,%eax
+  80274b:	74 e2                	je     80272f <devpipe_write+0x25>
+				return 0;
+  80274d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802755:	5b                   	pop    %ebx
+  802756:	5e                   	pop    %esi
+  802757:	5f                   	pop    %edi
+  802758:	5d                   	pop    %ebp
+  802759:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80275a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80275d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802761:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802764:	89 c2                	mov    %eax,%edx
+  802766:	c1 fa 1f             	sar    $0x1f,%edx
+  802769:	89 d1                	mov    %edx,%ecx
+  80276b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80276e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802771:	83 e2 1f             	and    $0x1f,%edx
+  802774:	29 ca                	sub    %ecx,%edx
+  802776:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80277a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80277e:	83 c0 01             	add    $0x1,%eax
+  802781:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802784:	83 c7 01             	add    $0x1,%edi
+  802787:	eb 9d                	jmp    802726 <devpipe_write+0x1c>
+
+00802789 <devpipe_read>:
+{
+  802789:	55                   	push   %ebp
+  80278a:	89 e5                	mov    %esp,%ebp
+  80278c:	57                   	push   %edi
+  80278d:	56                   	push   %esi
+  80278e:	53                   	push   %ebx
+  80278f:	83 ec 18             	sub    $0x18,%esp
+  802792:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802795:	57                   	push   %edi
+  802796:	e8 e0 ef ff ff       	call   80177b <fd2data>
+  80279b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80279d:	83 c4 10             	add    $0x10,%esp
+  8027a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8027a8:	75 13                	jne    8027bd <devpipe_read+0x34>
+	return i;
+  8027aa:	89 f0                	mov    %esi,%eax
+  8027ac:	eb 02                	jmp    8027b0 <devpipe_read+0x27>
+				return i;
+  8027ae:	89 f0                	mov    %esi,%eax
+}
+  8027b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027b3:	5b                   	pop    %ebx
+  8027b4:	5e                   	pop    %esi
+  8027b5:	5f                   	pop    %edi
+  8027b6:	5d                   	pop    %ebp
+  8027b7:	c3                   	ret
+			sys_yield();
+  8027b8:	e8 09 eb ff ff       	call   8012c6 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8027bd:	8b 03                	mov    (%ebx),%eax
+  8027bf:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8027c2:	75 18                	jne    8027dc <devpipe_read+0x53>
+			if (i > 0)
+  8027c4:	85 f6                	test   %esi,%esi
+  8027c6:	75 e6                	jne    8027ae <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8027c8:	89 da                	mov    %ebx,%edx
+  8027ca:	89 f8                	mov    %edi,%eax
+  8027cc:	e8 d4 fe ff ff       	call   8026a5 <_pipeisclosed>
+  8027d1:	85 c0                	test   %eax,%eax
+  8027d3:	74 e3                	je     8027b8 <devpipe_read+0x2f>
+				return 0;
+  8027d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027da:	eb d4                	jmp    8027b0 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8027dc:	99                   	cltd
+  8027dd:	c1 ea 1b             	shr    $0x1b,%edx
+  8027e0:	01 d0                	add    %edx,%eax
+  8027e2:	83 e0 1f             	and    $0x1f,%eax
+  8027e5:	29 d0                	sub    %edx,%eax
+  8027e7:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8027ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027ef:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8027f2:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8027f5:	83 c6 01             	add    $0x1,%esi
+  8027f8:	eb ab                	jmp    8027a5 <devpipe_read+0x1c>
+
+008027fa <pipe>:
+{
+  8027fa:	55                   	push   %ebp
+  8027fb:	89 e5                	mov    %esp,%ebp
+  8027fd:	56                   	push   %esi
+  8027fe:	53                   	push   %ebx
+  8027ff:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802802:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802805:	50                   	push   %eax
+  802806:	e8 87 ef ff ff       	call   801792 <fd_alloc>
+  80280b:	89 c3                	mov    %eax,%ebx
+  80280d:	83 c4 10             	add    $0x10,%esp
+  802810:	85 c0                	test   %eax,%eax
+  802812:	0f 88 23 01 00 00    	js     80293b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802818:	83 ec 04             	sub    $0x4,%esp
+  80281b:	68 07 04 00 00       	push   $0x407
+  802820:	ff 75 f4             	push   -0xc(%ebp)
+  802823:	6a 00                	push   $0x0
+  802825:	e8 1c eb ff ff       	call   801346 <sys_page_alloc>
+  80282a:	89 c3                	mov    %eax,%ebx
+  80282c:	83 c4 10             	add    $0x10,%esp
+  80282f:	85 c0                	test   %eax,%eax
+  802831:	0f 88 04 01 00 00    	js     80293b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802837:	83 ec 0c             	sub    $0xc,%esp
+  80283a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80283d:	50                   	push   %eax
+  80283e:	e8 4f ef ff ff       	call   801792 <fd_alloc>
+  802843:	89 c3                	mov    %eax,%ebx
+  802845:	83 c4 10             	add    $0x10,%esp
+  802848:	85 c0                	test   %eax,%eax
+  80284a:	0f 88 db 00 00 00    	js     80292b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802850:	83 ec 04             	sub    $0x4,%esp
+  802853:	68 07 04 00 00       	push   $0x407
+  802858:	ff 75 f0             	push   -0x10(%ebp)
+  80285b:	6a 00                	push   $0x0
+  80285d:	e8 e4 ea ff ff       	call   801346 <sys_page_alloc>
+  802862:	89 c3                	mov    %eax,%ebx
+  802864:	83 c4 10             	add    $0x10,%esp
+  802867:	85 c0                	test   %eax,%eax
+  802869:	0f 88 bc 00 00 00    	js     80292b <pipe+0x131>
+	va = fd2data(fd0);
+  80286f:	83 ec 0c             	sub    $0xc,%esp
+  802872:	ff 75 f4             	push   -0xc(%ebp)
+  802875:	e8 01 ef ff ff       	call   80177b <fd2data>
+  80287a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80287c:	83 c4 0c             	add    $0xc,%esp
+  80287f:	68 07 04 00 00       	push   $0x407
+  802884:	50                   	push   %eax
+  802885:	6a 00                	push   $0x0
+  802887:	e8 ba ea ff ff       	call   801346 <sys_page_alloc>
+  80288c:	89 c3                	mov    %eax,%ebx
+  80288e:	83 c4 10             	add    $0x10,%esp
+  802891:	85 c0                	test   %eax,%eax
+  802893:	0f 88 82 00 00 00    	js     80291b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802899:	83 ec 0c             	sub    $0xc,%esp
+  80289c:	ff 75 f0             	push   -0x10(%ebp)
+  80289f:	e8 d7 ee ff ff       	call   80177b <fd2data>
+  8028a4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8028ab:	50                   	push   %eax
+  8028ac:	6a 00                	push   $0x0
+  8028ae:	56                   	push   %esi
+  8028af:	6a 00                	push   $0x0
+  8028b1:	e8 16 eb ff ff       	call   8013cc <sys_page_map>
+  8028b6:	89 c3                	mov    %eax,%ebx
+  8028b8:	83 c4 20             	add    $0x20,%esp
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	78 4e                	js     80290d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8028bf:	a1 5c 40 80 00       	mov    0x80405c,%eax
+  8028c4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028c7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8028c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028cc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8028d3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8028d6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8028d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8028db:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8028e2:	83 ec 0c             	sub    $0xc,%esp
+  8028e5:	ff 75 f4             	push   -0xc(%ebp)
+  8028e8:	e8 7e ee ff ff       	call   80176b <fd2num>
+  8028ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028f0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8028f2:	83 c4 04             	add    $0x4,%esp
+  8028f5:	ff 75 f0             	push   -0x10(%ebp)
+  8028f8:	e8 6e ee ff ff       	call   80176b <fd2num>
+  8028fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802900:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802903:	83 c4 10             	add    $0x10,%esp
+  802906:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80290b:	eb 2e                	jmp    80293b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80290d:	83 ec 08             	sub    $0x8,%esp
+  802910:	56                   	push   %esi
+  802911:	6a 00                	push   $0x0
+  802913:	e8 f6 ea ff ff       	call   80140e <sys_page_unmap>
+  802918:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80291b:	83 ec 08             	sub    $0x8,%esp
+  80291e:	ff 75 f0             	push   -0x10(%ebp)
+  802921:	6a 00                	push   $0x0
+  802923:	e8 e6 ea ff ff       	call   80140e <sys_page_unmap>
+  802928:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80292b:	83 ec 08             	sub    $0x8,%esp
+  80292e:	ff 75 f4             	push   -0xc(%ebp)
+  802931:	6a 00                	push   $0x0
+  802933:	e8 d6 ea ff ff       	call   80140e <sys_page_unmap>
+  802938:	83 c4 10             	add    $0x10,%esp
+}
+  80293b:	89 d8                	mov    %ebx,%eax
+  80293d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802940:	5b                   	pop    %ebx
+  802941:	5e                   	pop    %esi
+  802942:	5d                   	pop    %ebp
+  802943:	c3                   	ret
+
+00802944 <pipeisclosed>:
+{
+  802944:	55                   	push   %ebp
+  802945:	89 e5                	mov    %esp,%ebp
+  802947:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80294a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80294d:	50                   	push   %eax
+  80294e:	ff 75 08             	push   0x8(%ebp)
+  802951:	e8 92 ee ff ff       	call   8017e8 <fd_lookup>
+  802956:	83 c4 10             	add    $0x10,%esp
+  802959:	85 c0                	test   %eax,%eax
+  80295b:	78 18                	js     802975 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80295d:	83 ec 0c             	sub    $0xc,%esp
+  802960:	ff 75 f4             	push   -0xc(%ebp)
+  802963:	e8 13 ee ff ff       	call   80177b <fd2data>
+  802968:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80296a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80296d:	e8 33 fd ff ff       	call   8026a5 <_pipeisclosed>
+  802972:	83 c4 10             	add    $0x10,%esp
+}
+  802975:	c9                   	leave
+  802976:	c3                   	ret
+
+00802977 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802977:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297c:	c3                   	ret
+
+0080297d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80297d:	55                   	push   %ebp
+  80297e:	89 e5                	mov    %esp,%ebp
+  802980:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802983:	68 25 37 80 00       	push   $0x803725
+  802988:	ff 75 0c             	push   0xc(%ebp)
+  80298b:	e8 49 e5 ff ff       	call   800ed9 <strcpy>
+	return 0;
+}
+  802990:	b8 00 00 00 00       	mov    $0x0,%eax
+  802995:	c9                   	leave
+  802996:	c3                   	ret
+
+00802997 <devcons_write>:
+{
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	57                   	push   %edi
+  80299b:	56                   	push   %esi
+  80299c:	53                   	push   %ebx
+  80299d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8029a3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8029a8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8029ae:	eb 2e                	jmp    8029de <devcons_write+0x47>
+		m = n - tot;
+  8029b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029b3:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8029b5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8029ba:	39 c3                	cmp    %eax,%ebx
+  8029bc:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8029bf:	83 ec 04             	sub    $0x4,%esp
+  8029c2:	53                   	push   %ebx
+  8029c3:	89 f0                	mov    %esi,%eax
+  8029c5:	03 45 0c             	add    0xc(%ebp),%eax
+  8029c8:	50                   	push   %eax
+  8029c9:	57                   	push   %edi
+  8029ca:	e8 90 e6 ff ff       	call   80105f <memmove>
+		sys_cputs(buf, m);
+  8029cf:	83 c4 08             	add    $0x8,%esp
+  8029d2:	53                   	push   %ebx
+  8029d3:	57                   	push   %edi
+  8029d4:	e8 30 e8 ff ff       	call   801209 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8029d9:	01 de                	add    %ebx,%esi
+  8029db:	83 c4 10             	add    $0x10,%esp
+  8029de:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8029e1:	72 cd                	jb     8029b0 <devcons_write+0x19>
+}
+  8029e3:	89 f0                	mov    %esi,%eax
+  8029e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029e8:	5b                   	pop    %ebx
+  8029e9:	5e                   	pop    %esi
+  8029ea:	5f                   	pop    %edi
+  8029eb:	5d                   	pop    %ebp
+  8029ec:	c3                   	ret
+
+008029ed <devcons_read>:
+{
+  8029ed:	55                   	push   %ebp
+  8029ee:	89 e5                	mov    %esp,%ebp
+  8029f0:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8029f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8029fc:	75 07                	jne    802a05 <devcons_read+0x18>
+  8029fe:	eb 1f                	jmp    802a1f <devcons_read+0x32>
+		sys_yield();
+  802a00:	e8 c1 e8 ff ff       	call   8012c6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802a05:	e8 1d e8 ff ff       	call   801227 <sys_cgetc>
+  802a0a:	85 c0                	test   %eax,%eax
+  802a0c:	74 f2                	je     802a00 <devcons_read+0x13>
+	if (c < 0)
+  802a0e:	78 0f                	js     802a1f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802a10:	83 f8 04             	cmp    $0x4,%eax
+  802a13:	74 0c                	je     802a21 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802a15:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a18:	88 02                	mov    %al,(%edx)
+	return 1;
+  802a1a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802a1f:	c9                   	leave
+  802a20:	c3                   	ret
+		return 0;
+  802a21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a26:	eb f7                	jmp    802a1f <devcons_read+0x32>
+
+00802a28 <cputchar>:
+{
+  802a28:	55                   	push   %ebp
+  802a29:	89 e5                	mov    %esp,%ebp
+  802a2b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a31:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802a34:	6a 01                	push   $0x1
+  802a36:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a39:	50                   	push   %eax
+  802a3a:	e8 ca e7 ff ff       	call   801209 <sys_cputs>
+}
+  802a3f:	83 c4 10             	add    $0x10,%esp
+  802a42:	c9                   	leave
+  802a43:	c3                   	ret
+
+00802a44 <getchar>:
+{
+  802a44:	55                   	push   %ebp
+  802a45:	89 e5                	mov    %esp,%ebp
+  802a47:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802a4a:	6a 01                	push   $0x1
+  802a4c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a4f:	50                   	push   %eax
+  802a50:	6a 00                	push   $0x0
+  802a52:	e8 f7 ef ff ff       	call   801a4e <read>
+	if (r < 0)
+  802a57:	83 c4 10             	add    $0x10,%esp
+  802a5a:	85 c0                	test   %eax,%eax
+  802a5c:	78 06                	js     802a64 <getchar+0x20>
+	if (r < 1)
+  802a5e:	74 06                	je     802a66 <getchar+0x22>
+	return c;
+  802a60:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802a64:	c9                   	leave
+  802a65:	c3                   	ret
+		return -E_EOF;
+  802a66:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802a6b:	eb f7                	jmp    802a64 <getchar+0x20>
+
+00802a6d <iscons>:
+{
+  802a6d:	55                   	push   %ebp
+  802a6e:	89 e5                	mov    %esp,%ebp
+  802a70:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a76:	50                   	push   %eax
+  802a77:	ff 75 08             	push   0x8(%ebp)
+  802a7a:	e8 69 ed ff ff       	call   8017e8 <fd_lookup>
+  802a7f:	83 c4 10             	add    $0x10,%esp
+  802a82:	85 c0                	test   %eax,%eax
+  802a84:	78 11                	js     802a97 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802a86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a89:	8b 15 78 40 80 00    	mov    0x804078,%edx
+  802a8f:	39 10                	cmp    %edx,(%eax)
+  802a91:	0f 94 c0             	sete   %al
+  802a94:	0f b6 c0             	movzbl %al,%eax
+}
+  802a97:	c9                   	leave
+  802a98:	c3                   	ret
+
+00802a99 <opencons>:
+{
+  802a99:	55                   	push   %ebp
+  802a9a:	89 e5                	mov    %esp,%ebp
+  802a9c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802a9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aa2:	50                   	push   %eax
+  802aa3:	e8 ea ec ff ff       	call   801792 <fd_alloc>
+  802aa8:	83 c4 10             	add    $0x10,%esp
+  802aab:	85 c0                	test   %eax,%eax
+  802aad:	78 3a                	js     802ae9 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802aaf:	83 ec 04             	sub    $0x4,%esp
+  802ab2:	68 07 04 00 00       	push   $0x407
+  802ab7:	ff 75 f4             	push   -0xc(%ebp)
+  802aba:	6a 00                	push   $0x0
+  802abc:	e8 85 e8 ff ff       	call   801346 <sys_page_alloc>
+  802ac1:	83 c4 10             	add    $0x10,%esp
+  802ac4:	85 c0                	test   %eax,%eax
+  802ac6:	78 21                	js     802ae9 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802ac8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802acb:	8b 15 78 40 80 00    	mov    0x804078,%edx
+  802ad1:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802ad3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ad6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802add:	83 ec 0c             	sub    $0xc,%esp
+  802ae0:	50                   	push   %eax
+  802ae1:	e8 85 ec ff ff       	call   80176b <fd2num>
+  802ae6:	83 c4 10             	add    $0x10,%esp
+}
+  802ae9:	c9                   	leave
+  802aea:	c3                   	ret
+
+00802aeb <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802aeb:	55                   	push   %ebp
+  802aec:	89 e5                	mov    %esp,%ebp
+  802aee:	57                   	push   %edi
+  802aef:	56                   	push   %esi
+  802af0:	53                   	push   %ebx
+  802af1:	83 ec 18             	sub    $0x18,%esp
+  802af4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802af7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802afa:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802afd:	85 db                	test   %ebx,%ebx
+  802aff:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b04:	0f 45 c3             	cmovne %ebx,%eax
+  802b07:	50                   	push   %eax
+  802b08:	e8 bc eb ff ff       	call   8016c9 <sys_ipc_recv>
+
+	if (from_env_store)
+  802b0d:	83 c4 10             	add    $0x10,%esp
+  802b10:	85 ff                	test   %edi,%edi
+  802b12:	74 17                	je     802b2b <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802b14:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b19:	85 c0                	test   %eax,%eax
+  802b1b:	75 0c                	jne    802b29 <ipc_recv+0x3e>
+  802b1d:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+  802b23:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802b29:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802b2b:	85 f6                	test   %esi,%esi
+  802b2d:	74 2e                	je     802b5d <ipc_recv+0x72>
+		if (!r && pg)
+  802b2f:	85 c0                	test   %eax,%eax
+  802b31:	75 24                	jne    802b57 <ipc_recv+0x6c>
+  802b33:	85 db                	test   %ebx,%ebx
+  802b35:	74 20                	je     802b57 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802b37:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  802b3c:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802b42:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802b44:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  802b49:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802b4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b52:	5b                   	pop    %ebx
+  802b53:	5e                   	pop    %esi
+  802b54:	5f                   	pop    %edi
+  802b55:	5d                   	pop    %ebp
+  802b56:	c3                   	ret
+			*perm_store = 0;
+  802b57:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802b5d:	85 c0                	test   %eax,%eax
+  802b5f:	75 ee                	jne    802b4f <ipc_recv+0x64>
+  802b61:	eb e1                	jmp    802b44 <ipc_recv+0x59>
+
+00802b63 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b63:	55                   	push   %ebp
+  802b64:	89 e5                	mov    %esp,%ebp
+  802b66:	57                   	push   %edi
+  802b67:	56                   	push   %esi
+  802b68:	53                   	push   %ebx
+  802b69:	83 ec 0c             	sub    $0xc,%esp
+  802b6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b6f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802b75:	85 db                	test   %ebx,%ebx
+  802b77:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b7c:	0f 44 d8             	cmove  %eax,%ebx
+  802b7f:	ff 75 14             	push   0x14(%ebp)
+  802b82:	53                   	push   %ebx
+  802b83:	56                   	push   %esi
+  802b84:	57                   	push   %edi
+  802b85:	e8 1c eb ff ff       	call   8016a6 <sys_ipc_try_send_yield>
+  802b8a:	83 c4 10             	add    $0x10,%esp
+  802b8d:	85 c0                	test   %eax,%eax
+  802b8f:	79 1e                	jns    802baf <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802b91:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b94:	75 07                	jne    802b9d <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802b96:	e8 2b e7 ff ff       	call   8012c6 <sys_yield>
+  802b9b:	eb e2                	jmp    802b7f <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802b9d:	50                   	push   %eax
+  802b9e:	68 31 37 80 00       	push   $0x803731
+  802ba3:	6a 3d                	push   $0x3d
+  802ba5:	68 46 37 80 00       	push   $0x803746
+  802baa:	e8 61 dc ff ff       	call   800810 <_panic>
+	}
+}
+  802baf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bb2:	5b                   	pop    %ebx
+  802bb3:	5e                   	pop    %esi
+  802bb4:	5f                   	pop    %edi
+  802bb5:	5d                   	pop    %ebp
+  802bb6:	c3                   	ret
+
+00802bb7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802bb7:	55                   	push   %ebp
+  802bb8:	89 e5                	mov    %esp,%ebp
+  802bba:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802bbd:	ff 75 08             	push   0x8(%ebp)
+  802bc0:	e8 81 e6 ff ff       	call   801246 <sys_env_find>
+}
+  802bc5:	c9                   	leave
+  802bc6:	c3                   	ret
+
+00802bc7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bc7:	55                   	push   %ebp
+  802bc8:	89 e5                	mov    %esp,%ebp
+  802bca:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bcd:	89 c2                	mov    %eax,%edx
+  802bcf:	c1 ea 16             	shr    $0x16,%edx
+  802bd2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802bd9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bde:	f6 c1 01             	test   $0x1,%cl
+  802be1:	74 22                	je     802c05 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802be3:	c1 e8 0c             	shr    $0xc,%eax
+  802be6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802bed:	a8 01                	test   $0x1,%al
+  802bef:	74 14                	je     802c05 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802bf1:	c1 e8 0c             	shr    $0xc,%eax
+  802bf4:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802bf7:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802bfe:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802c02:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c05:	89 d0                	mov    %edx,%eax
+  802c07:	5d                   	pop    %ebp
+  802c08:	c3                   	ret
+  802c09:	66 90                	xchg   %ax,%ax
+  802c0b:	66 90                	xchg   %ax,%ax
+  802c0d:	66 90                	xchg   %ax,%ax
+  802c0f:	90                   	nop
+
+00802c10 <__udivmoddi4>:
+  802c10:	55                   	push   %ebp
+  802c11:	57                   	push   %edi
+  802c12:	56                   	push   %esi
+  802c13:	53                   	push   %ebx
+  802c14:	83 ec 14             	sub    $0x14,%esp
+  802c17:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802c1b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802c1f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802c23:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802c27:	89 f1                	mov    %esi,%ecx
+  802c29:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  802c2d:	09 d9                	or     %ebx,%ecx
+  802c2f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802c33:	0f 84 92 00 00 00    	je     802ccb <__udivmoddi4+0xbb>
+  802c39:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c40:	00 
+  802c41:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802c46:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c4d:	00 
+  802c4e:	89 1c 24             	mov    %ebx,(%esp)
+  802c51:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802c55:	8d 76 00             	lea    0x0(%esi),%esi
+  802c58:	89 e9                	mov    %ebp,%ecx
+  802c5a:	89 c3                	mov    %eax,%ebx
+  802c5c:	89 d6                	mov    %edx,%esi
+  802c5e:	31 ff                	xor    %edi,%edi
+  802c60:	d3 ee                	shr    %cl,%esi
+  802c62:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802c65:	f6 c1 20             	test   $0x20,%cl
+  802c68:	0f 45 de             	cmovne %esi,%ebx
+  802c6b:	0f 45 f7             	cmovne %edi,%esi
+  802c6e:	8b 3c 24             	mov    (%esp),%edi
+  802c71:	39 fb                	cmp    %edi,%ebx
+  802c73:	89 f7                	mov    %esi,%edi
+  802c75:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c79:	8b 1c 24             	mov    (%esp),%ebx
+  802c7c:	19 f7                	sbb    %esi,%edi
+  802c7e:	72 39                	jb     802cb9 <__udivmoddi4+0xa9>
+  802c80:	89 e9                	mov    %ebp,%ecx
+  802c82:	89 f7                	mov    %esi,%edi
+  802c84:	89 de                	mov    %ebx,%esi
+  802c86:	0f a5 df             	shld   %cl,%ebx,%edi
+  802c89:	d3 e6                	shl    %cl,%esi
+  802c8b:	31 db                	xor    %ebx,%ebx
+  802c8d:	f6 c1 20             	test   $0x20,%cl
+  802c90:	0f 45 fe             	cmovne %esi,%edi
+  802c93:	0f 45 f3             	cmovne %ebx,%esi
+  802c96:	29 f0                	sub    %esi,%eax
+  802c98:	be 01 00 00 00       	mov    $0x1,%esi
+  802c9d:	19 fa                	sbb    %edi,%edx
+  802c9f:	31 ff                	xor    %edi,%edi
+  802ca1:	31 db                	xor    %ebx,%ebx
+  802ca3:	0f a5 f7             	shld   %cl,%esi,%edi
+  802ca6:	d3 e6                	shl    %cl,%esi
+  802ca8:	f6 c1 20             	test   $0x20,%cl
+  802cab:	0f 45 fe             	cmovne %esi,%edi
+  802cae:	0f 45 f3             	cmovne %ebx,%esi
+  802cb1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802cb5:	09 74 24 08          	or     %esi,0x8(%esp)
+  802cb9:	83 ed 01             	sub    $0x1,%ebp
+  802cbc:	73 9a                	jae    802c58 <__udivmoddi4+0x48>
+  802cbe:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802cc2:	85 ff                	test   %edi,%edi
+  802cc4:	74 05                	je     802ccb <__udivmoddi4+0xbb>
+  802cc6:	89 07                	mov    %eax,(%edi)
+  802cc8:	89 57 04             	mov    %edx,0x4(%edi)
+  802ccb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ccf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cd3:	83 c4 14             	add    $0x14,%esp
+  802cd6:	5b                   	pop    %ebx
+  802cd7:	5e                   	pop    %esi
+  802cd8:	5f                   	pop    %edi
+  802cd9:	5d                   	pop    %ebp
+  802cda:	c3                   	ret
+  802cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802cdf:	90                   	nop
+
+00802ce0 <__udivdi3>:
+  802ce0:	55                   	push   %ebp
+  802ce1:	57                   	push   %edi
+  802ce2:	56                   	push   %esi
+  802ce3:	53                   	push   %ebx
+  802ce4:	83 ec 14             	sub    $0x14,%esp
+  802ce7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802ceb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802cef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cf3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802cf7:	89 fb                	mov    %edi,%ebx
+  802cf9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802cfd:	09 f3                	or     %esi,%ebx
+  802cff:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802d03:	0f 84 85 00 00 00    	je     802d8e <__udivdi3+0xae>
+  802d09:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802d10:	00 
+  802d11:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802d16:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802d1d:	00 
+  802d1e:	89 34 24             	mov    %esi,(%esp)
+  802d21:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802d25:	8d 76 00             	lea    0x0(%esi),%esi
+  802d28:	89 e9                	mov    %ebp,%ecx
+  802d2a:	89 c3                	mov    %eax,%ebx
+  802d2c:	89 d6                	mov    %edx,%esi
+  802d2e:	31 ff                	xor    %edi,%edi
+  802d30:	d3 ee                	shr    %cl,%esi
+  802d32:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802d35:	f6 c1 20             	test   $0x20,%cl
+  802d38:	0f 45 de             	cmovne %esi,%ebx
+  802d3b:	0f 45 f7             	cmovne %edi,%esi
+  802d3e:	8b 3c 24             	mov    (%esp),%edi
+  802d41:	39 fb                	cmp    %edi,%ebx
+  802d43:	89 f7                	mov    %esi,%edi
+  802d45:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802d49:	8b 1c 24             	mov    (%esp),%ebx
+  802d4c:	19 f7                	sbb    %esi,%edi
+  802d4e:	72 39                	jb     802d89 <__udivdi3+0xa9>
+  802d50:	89 e9                	mov    %ebp,%ecx
+  802d52:	89 f7                	mov    %esi,%edi
+  802d54:	89 de                	mov    %ebx,%esi
+  802d56:	0f a5 df             	shld   %cl,%ebx,%edi
+  802d59:	d3 e6                	shl    %cl,%esi
+  802d5b:	31 db                	xor    %ebx,%ebx
+  802d5d:	f6 c1 20             	test   $0x20,%cl
+  802d60:	0f 45 fe             	cmovne %esi,%edi
+  802d63:	0f 45 f3             	cmovne %ebx,%esi
+  802d66:	29 f0                	sub    %esi,%eax
+  802d68:	be 01 00 00 00       	mov    $0x1,%esi
+  802d6d:	19 fa                	sbb    %edi,%edx
+  802d6f:	31 ff                	xor    %edi,%edi
+  802d71:	31 db                	xor    %ebx,%ebx
+  802d73:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d76:	d3 e6                	shl    %cl,%esi
+  802d78:	f6 c1 20             	test   $0x20,%cl
+  802d7b:	0f 45 fe             	cmovne %esi,%edi
+  802d7e:	0f 45 f3             	cmovne %ebx,%esi
+  802d81:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802d85:	09 74 24 08          	or     %esi,0x8(%esp)
+  802d89:	83 ed 01             	sub    $0x1,%ebp
+  802d8c:	73 9a                	jae    802d28 <__udivdi3+0x48>
+  802d8e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d92:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d96:	83 c4 14             	add    $0x14,%esp
+  802d99:	5b                   	pop    %ebx
+  802d9a:	5e                   	pop    %esi
+  802d9b:	5f                   	pop    %edi
+  802d9c:	5d                   	pop    %ebp
+  802d9d:	c3                   	ret
+  802d9e:	66 90                	xchg   %ax,%ax
+
+00802da0 <__umoddi3>:
+  802da0:	57                   	push   %edi
+  802da1:	56                   	push   %esi
+  802da2:	53                   	push   %ebx
+  802da3:	83 ec 08             	sub    $0x8,%esp
+  802da6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  802daa:	8b 74 24 20          	mov    0x20(%esp),%esi
+  802dae:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802db2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802db6:	89 f9                	mov    %edi,%ecx
+  802db8:	89 34 24             	mov    %esi,(%esp)
+  802dbb:	09 f1                	or     %esi,%ecx
+  802dbd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802dc1:	74 53                	je     802e16 <__umoddi3+0x76>
+  802dc3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802dcf:	90                   	nop
+  802dd0:	89 c6                	mov    %eax,%esi
+  802dd2:	89 d7                	mov    %edx,%edi
+  802dd4:	31 db                	xor    %ebx,%ebx
+  802dd6:	d3 ef                	shr    %cl,%edi
+  802dd8:	0f ad d6             	shrd   %cl,%edx,%esi
+  802ddb:	f6 c1 20             	test   $0x20,%cl
+  802dde:	0f 45 f7             	cmovne %edi,%esi
+  802de1:	0f 45 fb             	cmovne %ebx,%edi
+  802de4:	8b 1c 24             	mov    (%esp),%ebx
+  802de7:	39 de                	cmp    %ebx,%esi
+  802de9:	89 fb                	mov    %edi,%ebx
+  802deb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  802def:	8b 34 24             	mov    (%esp),%esi
+  802df2:	19 fb                	sbb    %edi,%ebx
+  802df4:	72 14                	jb     802e0a <__umoddi3+0x6a>
+  802df6:	0f a5 f7             	shld   %cl,%esi,%edi
+  802df9:	31 db                	xor    %ebx,%ebx
+  802dfb:	d3 e6                	shl    %cl,%esi
+  802dfd:	f6 c1 20             	test   $0x20,%cl
+  802e00:	0f 45 fe             	cmovne %esi,%edi
+  802e03:	0f 45 f3             	cmovne %ebx,%esi
+  802e06:	29 f0                	sub    %esi,%eax
+  802e08:	19 fa                	sbb    %edi,%edx
+  802e0a:	83 e9 01             	sub    $0x1,%ecx
+  802e0d:	73 c1                	jae    802dd0 <__umoddi3+0x30>
+  802e0f:	83 c4 08             	add    $0x8,%esp
+  802e12:	5b                   	pop    %ebx
+  802e13:	5e                   	pop    %esi
+  802e14:	5f                   	pop    %edi
+  802e15:	c3                   	ret
+  802e16:	83 c4 08             	add    $0x8,%esp
+  802e19:	31 c0                	xor    %eax,%eax
+  802e1b:	31 d2                	xor    %edx,%edx
+  802e1d:	5b                   	pop    %ebx
+  802e1e:	5e                   	pop    %esi
+  802e1f:	5f                   	pop    %edi
+  802e20:	c3                   	ret
+  802e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802e2f:	90                   	nop
+
+00802e30 <__divdi3>:
+  802e30:	55                   	push   %ebp
+  802e31:	57                   	push   %edi
+  802e32:	56                   	push   %esi
+  802e33:	53                   	push   %ebx
+  802e34:	83 ec 1c             	sub    $0x1c,%esp
+  802e37:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802e3b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802e3f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802e43:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802e47:	85 ff                	test   %edi,%edi
+  802e49:	0f 88 da 00 00 00    	js     802f29 <__divdi3+0xf9>
+  802e4f:	85 db                	test   %ebx,%ebx
+  802e51:	78 16                	js     802e69 <__divdi3+0x39>
+  802e53:	89 dd                	mov    %ebx,%ebp
+  802e55:	89 c8                	mov    %ecx,%eax
+  802e57:	89 da                	mov    %ebx,%edx
+  802e59:	09 cd                	or     %ecx,%ebp
+  802e5b:	0f 85 fd 00 00 00    	jne    802f5e <__divdi3+0x12e>
+  802e61:	83 c4 1c             	add    $0x1c,%esp
+  802e64:	5b                   	pop    %ebx
+  802e65:	5e                   	pop    %esi
+  802e66:	5f                   	pop    %edi
+  802e67:	5d                   	pop    %ebp
+  802e68:	c3                   	ret
+  802e69:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802e6e:	f7 d9                	neg    %ecx
+  802e70:	89 f0                	mov    %esi,%eax
+  802e72:	89 fa                	mov    %edi,%edx
+  802e74:	83 d3 00             	adc    $0x0,%ebx
+  802e77:	89 0c 24             	mov    %ecx,(%esp)
+  802e7a:	f7 db                	neg    %ebx
+  802e7c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802e80:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802e87:	00 
+  802e88:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e8d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802e94:	00 
+  802e95:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802e99:	89 cd                	mov    %ecx,%ebp
+  802e9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802e9f:	90                   	nop
+  802ea0:	89 e9                	mov    %ebp,%ecx
+  802ea2:	89 c3                	mov    %eax,%ebx
+  802ea4:	89 d6                	mov    %edx,%esi
+  802ea6:	31 ff                	xor    %edi,%edi
+  802ea8:	d3 ee                	shr    %cl,%esi
+  802eaa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802ead:	f6 c1 20             	test   $0x20,%cl
+  802eb0:	0f 45 de             	cmovne %esi,%ebx
+  802eb3:	0f 45 f7             	cmovne %edi,%esi
+  802eb6:	8b 3c 24             	mov    (%esp),%edi
+  802eb9:	39 fb                	cmp    %edi,%ebx
+  802ebb:	89 f7                	mov    %esi,%edi
+  802ebd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ec1:	8b 1c 24             	mov    (%esp),%ebx
+  802ec4:	19 f7                	sbb    %esi,%edi
+  802ec6:	72 39                	jb     802f01 <__divdi3+0xd1>
+  802ec8:	89 e9                	mov    %ebp,%ecx
+  802eca:	89 f7                	mov    %esi,%edi
+  802ecc:	89 de                	mov    %ebx,%esi
+  802ece:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ed1:	d3 e6                	shl    %cl,%esi
+  802ed3:	31 db                	xor    %ebx,%ebx
+  802ed5:	f6 c1 20             	test   $0x20,%cl
+  802ed8:	0f 45 fe             	cmovne %esi,%edi
+  802edb:	0f 45 f3             	cmovne %ebx,%esi
+  802ede:	29 f0                	sub    %esi,%eax
+  802ee0:	be 01 00 00 00       	mov    $0x1,%esi
+  802ee5:	19 fa                	sbb    %edi,%edx
+  802ee7:	31 ff                	xor    %edi,%edi
+  802ee9:	31 db                	xor    %ebx,%ebx
+  802eeb:	0f a5 f7             	shld   %cl,%esi,%edi
+  802eee:	d3 e6                	shl    %cl,%esi
+  802ef0:	f6 c1 20             	test   $0x20,%cl
+  802ef3:	0f 45 fe             	cmovne %esi,%edi
+  802ef6:	0f 45 f3             	cmovne %ebx,%esi
+  802ef9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802efd:	09 74 24 08          	or     %esi,0x8(%esp)
+  802f01:	83 ed 01             	sub    $0x1,%ebp
+  802f04:	73 9a                	jae    802ea0 <__divdi3+0x70>
+  802f06:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802f0a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f0e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f12:	85 ed                	test   %ebp,%ebp
+  802f14:	0f 84 47 ff ff ff    	je     802e61 <__divdi3+0x31>
+  802f1a:	f7 d8                	neg    %eax
+  802f1c:	83 d2 00             	adc    $0x0,%edx
+  802f1f:	83 c4 1c             	add    $0x1c,%esp
+  802f22:	5b                   	pop    %ebx
+  802f23:	f7 da                	neg    %edx
+  802f25:	5e                   	pop    %esi
+  802f26:	5f                   	pop    %edi
+  802f27:	5d                   	pop    %ebp
+  802f28:	c3                   	ret
+  802f29:	f7 de                	neg    %esi
+  802f2b:	83 d7 00             	adc    $0x0,%edi
+  802f2e:	f7 df                	neg    %edi
+  802f30:	85 db                	test   %ebx,%ebx
+  802f32:	78 23                	js     802f57 <__divdi3+0x127>
+  802f34:	89 dd                	mov    %ebx,%ebp
+  802f36:	89 c8                	mov    %ecx,%eax
+  802f38:	89 da                	mov    %ebx,%edx
+  802f3a:	09 cd                	or     %ecx,%ebp
+  802f3c:	0f 84 1f ff ff ff    	je     802e61 <__divdi3+0x31>
+  802f42:	89 0c 24             	mov    %ecx,(%esp)
+  802f45:	89 f0                	mov    %esi,%eax
+  802f47:	89 fa                	mov    %edi,%edx
+  802f49:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802f4e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802f52:	e9 29 ff ff ff       	jmp    802e80 <__divdi3+0x50>
+  802f57:	31 ed                	xor    %ebp,%ebp
+  802f59:	e9 10 ff ff ff       	jmp    802e6e <__divdi3+0x3e>
+  802f5e:	89 0c 24             	mov    %ecx,(%esp)
+  802f61:	89 f0                	mov    %esi,%eax
+  802f63:	89 fa                	mov    %edi,%edx
+  802f65:	31 ed                	xor    %ebp,%ebp
+  802f67:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802f6b:	e9 10 ff ff ff       	jmp    802e80 <__divdi3+0x50>
+
+00802f70 <__moddi3>:
+  802f70:	55                   	push   %ebp
+  802f71:	57                   	push   %edi
+  802f72:	56                   	push   %esi
+  802f73:	53                   	push   %ebx
+  802f74:	83 ec 14             	sub    $0x14,%esp
+  802f77:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f7b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f7f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802f83:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802f87:	85 d2                	test   %edx,%edx
+  802f89:	0f 88 9b 00 00 00    	js     80302a <__moddi3+0xba>
+  802f8f:	89 f7                	mov    %esi,%edi
+  802f91:	31 ed                	xor    %ebp,%ebp
+  802f93:	09 cf                	or     %ecx,%edi
+  802f95:	0f 84 83 00 00 00    	je     80301e <__moddi3+0xae>
+  802f9b:	89 cb                	mov    %ecx,%ebx
+  802f9d:	89 f7                	mov    %esi,%edi
+  802f9f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802fa3:	f7 db                	neg    %ebx
+  802fa5:	83 d7 00             	adc    $0x0,%edi
+  802fa8:	f7 df                	neg    %edi
+  802faa:	0f 49 f7             	cmovns %edi,%esi
+  802fad:	0f 49 cb             	cmovns %ebx,%ecx
+  802fb0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802fb4:	89 0c 24             	mov    %ecx,(%esp)
+  802fb7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802fbc:	89 cd                	mov    %ecx,%ebp
+  802fbe:	66 90                	xchg   %ax,%ax
+  802fc0:	89 e9                	mov    %ebp,%ecx
+  802fc2:	89 c3                	mov    %eax,%ebx
+  802fc4:	89 d6                	mov    %edx,%esi
+  802fc6:	31 ff                	xor    %edi,%edi
+  802fc8:	d3 ee                	shr    %cl,%esi
+  802fca:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802fcd:	f6 c1 20             	test   $0x20,%cl
+  802fd0:	0f 45 de             	cmovne %esi,%ebx
+  802fd3:	0f 45 f7             	cmovne %edi,%esi
+  802fd6:	8b 3c 24             	mov    (%esp),%edi
+  802fd9:	39 fb                	cmp    %edi,%ebx
+  802fdb:	89 f7                	mov    %esi,%edi
+  802fdd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802fe1:	8b 1c 24             	mov    (%esp),%ebx
+  802fe4:	19 f7                	sbb    %esi,%edi
+  802fe6:	72 1a                	jb     803002 <__moddi3+0x92>
+  802fe8:	89 e9                	mov    %ebp,%ecx
+  802fea:	89 f7                	mov    %esi,%edi
+  802fec:	89 de                	mov    %ebx,%esi
+  802fee:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ff1:	d3 e6                	shl    %cl,%esi
+  802ff3:	31 db                	xor    %ebx,%ebx
+  802ff5:	f6 c1 20             	test   $0x20,%cl
+  802ff8:	0f 45 fe             	cmovne %esi,%edi
+  802ffb:	0f 45 f3             	cmovne %ebx,%esi
+  802ffe:	29 f0                	sub    %esi,%eax
+  803000:	19 fa                	sbb    %edi,%edx
+  803002:	83 ed 01             	sub    $0x1,%ebp
+  803005:	73 b9                	jae    802fc0 <__moddi3+0x50>
+  803007:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80300b:	85 ed                	test   %ebp,%ebp
+  80300d:	74 07                	je     803016 <__moddi3+0xa6>
+  80300f:	f7 d8                	neg    %eax
+  803011:	83 d2 00             	adc    $0x0,%edx
+  803014:	f7 da                	neg    %edx
+  803016:	83 c4 14             	add    $0x14,%esp
+  803019:	5b                   	pop    %ebx
+  80301a:	5e                   	pop    %esi
+  80301b:	5f                   	pop    %edi
+  80301c:	5d                   	pop    %ebp
+  80301d:	c3                   	ret
+  80301e:	83 c4 14             	add    $0x14,%esp
+  803021:	31 c0                	xor    %eax,%eax
+  803023:	31 d2                	xor    %edx,%edx
+  803025:	5b                   	pop    %ebx
+  803026:	5e                   	pop    %esi
+  803027:	5f                   	pop    %edi
+  803028:	5d                   	pop    %ebp
+  803029:	c3                   	ret
+  80302a:	89 f7                	mov    %esi,%edi
+  80302c:	09 cf                	or     %ecx,%edi
+  80302e:	74 11                	je     803041 <__moddi3+0xd1>
+  803030:	f7 d8                	neg    %eax
+  803032:	bd 01 00 00 00       	mov    $0x1,%ebp
+  803037:	83 d2 00             	adc    $0x0,%edx
+  80303a:	f7 da                	neg    %edx
+  80303c:	e9 5a ff ff ff       	jmp    802f9b <__moddi3+0x2b>
+  803041:	31 c0                	xor    %eax,%eax
+  803043:	31 d2                	xor    %edx,%edx
+  803045:	eb c8                	jmp    80300f <__moddi3+0x9f>
@@ -0,0 +1,6303 @@
+
+obj/user/icode.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 03 01 00 00       	call   800134 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+	int fd, n, r;
+	char buf[512+1];
+
+	binaryname = "icode";
+  80003e:	c7 05 00 40 80 00 00 	movl   $0x802e00,0x804000
+  800045:	2e 80 00 
+
+	cprintf("icode startup\n");
+  800048:	68 06 2e 80 00       	push   $0x802e06
+  80004d:	e8 1d 02 00 00       	call   80026f <cprintf>
+
+	cprintf("icode: open /motd\n");
+  800052:	c7 04 24 15 2e 80 00 	movl   $0x802e15,(%esp)
+  800059:	e8 11 02 00 00       	call   80026f <cprintf>
+	if ((fd = open("/motd", O_RDONLY)) < 0)
+  80005e:	83 c4 08             	add    $0x8,%esp
+  800061:	6a 00                	push   $0x0
+  800063:	68 28 2e 80 00       	push   $0x802e28
+  800068:	e8 c8 17 00 00       	call   801835 <open>
+  80006d:	89 c6                	mov    %eax,%esi
+  80006f:	83 c4 10             	add    $0x10,%esp
+  800072:	85 c0                	test   %eax,%eax
+  800074:	78 18                	js     80008e <umain+0x5b>
+		panic("icode: open /motd: %e", fd);
+
+	cprintf("icode: read /motd\n");
+  800076:	83 ec 0c             	sub    $0xc,%esp
+  800079:	68 51 2e 80 00       	push   $0x802e51
+  80007e:	e8 ec 01 00 00       	call   80026f <cprintf>
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	8d 9d f7 fd ff ff    	lea    -0x209(%ebp),%ebx
+  80008c:	eb 1f                	jmp    8000ad <umain+0x7a>
+		panic("icode: open /motd: %e", fd);
+  80008e:	50                   	push   %eax
+  80008f:	68 2e 2e 80 00       	push   $0x802e2e
+  800094:	6a 0f                	push   $0xf
+  800096:	68 44 2e 80 00       	push   $0x802e44
+  80009b:	e8 f4 00 00 00       	call   800194 <_panic>
+		sys_cputs(buf, n);
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	50                   	push   %eax
+  8000a4:	53                   	push   %ebx
+  8000a5:	e8 e3 0a 00 00       	call   800b8d <sys_cputs>
+  8000aa:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  8000ad:	83 ec 04             	sub    $0x4,%esp
+  8000b0:	68 00 02 00 00       	push   $0x200
+  8000b5:	53                   	push   %ebx
+  8000b6:	56                   	push   %esi
+  8000b7:	e8 16 13 00 00       	call   8013d2 <read>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	7f dd                	jg     8000a0 <umain+0x6d>
+
+	cprintf("icode: close /motd\n");
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	68 64 2e 80 00       	push   $0x802e64
+  8000cb:	e8 9f 01 00 00       	call   80026f <cprintf>
+	close(fd);
+  8000d0:	89 34 24             	mov    %esi,(%esp)
+  8000d3:	e8 be 11 00 00       	call   801296 <close>
+
+	cprintf("icode: spawn /init\n");
+  8000d8:	c7 04 24 78 2e 80 00 	movl   $0x802e78,(%esp)
+  8000df:	e8 8b 01 00 00       	call   80026f <cprintf>
+	if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char*)0)) < 0)
+  8000e4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000eb:	68 8c 2e 80 00       	push   $0x802e8c
+  8000f0:	68 95 2e 80 00       	push   $0x802e95
+  8000f5:	68 9f 2e 80 00       	push   $0x802e9f
+  8000fa:	68 9e 2e 80 00       	push   $0x802e9e
+  8000ff:	e8 02 1e 00 00       	call   801f06 <spawnl>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	78 17                	js     800122 <umain+0xef>
+		panic("icode: spawn /init: %e", r);
+
+	cprintf("icode: exiting\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 bb 2e 80 00       	push   $0x802ebb
+  800113:	e8 57 01 00 00       	call   80026f <cprintf>
+}
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011e:	5b                   	pop    %ebx
+  80011f:	5e                   	pop    %esi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+		panic("icode: spawn /init: %e", r);
+  800122:	50                   	push   %eax
+  800123:	68 a4 2e 80 00       	push   $0x802ea4
+  800128:	6a 1a                	push   $0x1a
+  80012a:	68 44 2e 80 00       	push   $0x802e44
+  80012f:	e8 60 00 00 00       	call   800194 <_panic>
+
+00800134 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	56                   	push   %esi
+  800138:	53                   	push   %ebx
+  800139:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80013c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80013f:	e8 e7 0a 00 00       	call   800c2b <sys_getenvid>
+  800144:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800149:	c1 e0 09             	shl    $0x9,%eax
+  80014c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800151:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800156:	85 db                	test   %ebx,%ebx
+  800158:	7e 07                	jle    800161 <libmain+0x2d>
+		binaryname = argv[0];
+  80015a:	8b 06                	mov    (%esi),%eax
+  80015c:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800161:	83 ec 08             	sub    $0x8,%esp
+  800164:	56                   	push   %esi
+  800165:	53                   	push   %ebx
+  800166:	e8 c8 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80016b:	e8 0a 00 00 00       	call   80017a <exit>
+}
+  800170:	83 c4 10             	add    $0x10,%esp
+  800173:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800176:	5b                   	pop    %ebx
+  800177:	5e                   	pop    %esi
+  800178:	5d                   	pop    %ebp
+  800179:	c3                   	ret
+
+0080017a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80017a:	55                   	push   %ebp
+  80017b:	89 e5                	mov    %esp,%ebp
+  80017d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800180:	e8 3e 11 00 00       	call   8012c3 <close_all>
+	sys_env_destroy(0);
+  800185:	83 ec 0c             	sub    $0xc,%esp
+  800188:	6a 00                	push   $0x0
+  80018a:	e8 5b 0a 00 00       	call   800bea <sys_env_destroy>
+}
+  80018f:	83 c4 10             	add    $0x10,%esp
+  800192:	c9                   	leave
+  800193:	c3                   	ret
+
+00800194 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	56                   	push   %esi
+  800198:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800199:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80019c:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001a2:	e8 84 0a 00 00       	call   800c2b <sys_getenvid>
+  8001a7:	83 ec 0c             	sub    $0xc,%esp
+  8001aa:	ff 75 0c             	push   0xc(%ebp)
+  8001ad:	ff 75 08             	push   0x8(%ebp)
+  8001b0:	56                   	push   %esi
+  8001b1:	50                   	push   %eax
+  8001b2:	68 d8 2e 80 00       	push   $0x802ed8
+  8001b7:	e8 b3 00 00 00       	call   80026f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001bc:	83 c4 18             	add    $0x18,%esp
+  8001bf:	53                   	push   %ebx
+  8001c0:	ff 75 10             	push   0x10(%ebp)
+  8001c3:	e8 56 00 00 00       	call   80021e <vcprintf>
+	cprintf("\n");
+  8001c8:	c7 04 24 fc 33 80 00 	movl   $0x8033fc,(%esp)
+  8001cf:	e8 9b 00 00 00       	call   80026f <cprintf>
+  8001d4:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001d7:	cc                   	int3
+	while (1)
+  8001d8:	eb fd                	jmp    8001d7 <_panic+0x43>
+
+008001da <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001da:	55                   	push   %ebp
+  8001db:	89 e5                	mov    %esp,%ebp
+  8001dd:	53                   	push   %ebx
+  8001de:	83 ec 04             	sub    $0x4,%esp
+  8001e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001e4:	8b 13                	mov    (%ebx),%edx
+  8001e6:	8d 42 01             	lea    0x1(%edx),%eax
+  8001e9:	89 03                	mov    %eax,(%ebx)
+  8001eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001ee:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001f2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001f7:	74 09                	je     800202 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001f9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800200:	c9                   	leave
+  800201:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800202:	83 ec 08             	sub    $0x8,%esp
+  800205:	68 ff 00 00 00       	push   $0xff
+  80020a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80020d:	50                   	push   %eax
+  80020e:	e8 7a 09 00 00       	call   800b8d <sys_cputs>
+		b->idx = 0;
+  800213:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800219:	83 c4 10             	add    $0x10,%esp
+  80021c:	eb db                	jmp    8001f9 <putch+0x1f>
+
+0080021e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80021e:	55                   	push   %ebp
+  80021f:	89 e5                	mov    %esp,%ebp
+  800221:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800227:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80022e:	00 00 00 
+	b.cnt = 0;
+  800231:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800238:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80023b:	ff 75 0c             	push   0xc(%ebp)
+  80023e:	ff 75 08             	push   0x8(%ebp)
+  800241:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800247:	50                   	push   %eax
+  800248:	68 da 01 80 00       	push   $0x8001da
+  80024d:	e8 14 01 00 00       	call   800366 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800252:	83 c4 08             	add    $0x8,%esp
+  800255:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80025b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800261:	50                   	push   %eax
+  800262:	e8 26 09 00 00       	call   800b8d <sys_cputs>
+
+	return b.cnt;
+}
+  800267:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80026d:	c9                   	leave
+  80026e:	c3                   	ret
+
+0080026f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80026f:	55                   	push   %ebp
+  800270:	89 e5                	mov    %esp,%ebp
+  800272:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800275:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800278:	50                   	push   %eax
+  800279:	ff 75 08             	push   0x8(%ebp)
+  80027c:	e8 9d ff ff ff       	call   80021e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800281:	c9                   	leave
+  800282:	c3                   	ret
+
+00800283 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800283:	55                   	push   %ebp
+  800284:	89 e5                	mov    %esp,%ebp
+  800286:	57                   	push   %edi
+  800287:	56                   	push   %esi
+  800288:	53                   	push   %ebx
+  800289:	83 ec 1c             	sub    $0x1c,%esp
+  80028c:	89 c7                	mov    %eax,%edi
+  80028e:	89 d6                	mov    %edx,%esi
+  800290:	8b 45 08             	mov    0x8(%ebp),%eax
+  800293:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800296:	89 d1                	mov    %edx,%ecx
+  800298:	89 c2                	mov    %eax,%edx
+  80029a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80029d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002a0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002a3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002a9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002b0:	39 c2                	cmp    %eax,%edx
+  8002b2:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002b5:	72 3e                	jb     8002f5 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002b7:	83 ec 0c             	sub    $0xc,%esp
+  8002ba:	ff 75 18             	push   0x18(%ebp)
+  8002bd:	83 eb 01             	sub    $0x1,%ebx
+  8002c0:	53                   	push   %ebx
+  8002c1:	50                   	push   %eax
+  8002c2:	83 ec 08             	sub    $0x8,%esp
+  8002c5:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c8:	ff 75 e0             	push   -0x20(%ebp)
+  8002cb:	ff 75 dc             	push   -0x24(%ebp)
+  8002ce:	ff 75 d8             	push   -0x28(%ebp)
+  8002d1:	e8 ba 27 00 00       	call   802a90 <__udivdi3>
+  8002d6:	83 c4 18             	add    $0x18,%esp
+  8002d9:	52                   	push   %edx
+  8002da:	50                   	push   %eax
+  8002db:	89 f2                	mov    %esi,%edx
+  8002dd:	89 f8                	mov    %edi,%eax
+  8002df:	e8 9f ff ff ff       	call   800283 <printnum>
+  8002e4:	83 c4 20             	add    $0x20,%esp
+  8002e7:	eb 13                	jmp    8002fc <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002e9:	83 ec 08             	sub    $0x8,%esp
+  8002ec:	56                   	push   %esi
+  8002ed:	ff 75 18             	push   0x18(%ebp)
+  8002f0:	ff d7                	call   *%edi
+  8002f2:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002f5:	83 eb 01             	sub    $0x1,%ebx
+  8002f8:	85 db                	test   %ebx,%ebx
+  8002fa:	7f ed                	jg     8002e9 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002fc:	83 ec 08             	sub    $0x8,%esp
+  8002ff:	56                   	push   %esi
+  800300:	83 ec 04             	sub    $0x4,%esp
+  800303:	ff 75 e4             	push   -0x1c(%ebp)
+  800306:	ff 75 e0             	push   -0x20(%ebp)
+  800309:	ff 75 dc             	push   -0x24(%ebp)
+  80030c:	ff 75 d8             	push   -0x28(%ebp)
+  80030f:	e8 3c 28 00 00       	call   802b50 <__umoddi3>
+  800314:	83 c4 14             	add    $0x14,%esp
+  800317:	0f be 80 fb 2e 80 00 	movsbl 0x802efb(%eax),%eax
+  80031e:	50                   	push   %eax
+  80031f:	ff d7                	call   *%edi
+}
+  800321:	83 c4 10             	add    $0x10,%esp
+  800324:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800327:	5b                   	pop    %ebx
+  800328:	5e                   	pop    %esi
+  800329:	5f                   	pop    %edi
+  80032a:	5d                   	pop    %ebp
+  80032b:	c3                   	ret
+
+0080032c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800332:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800336:	8b 10                	mov    (%eax),%edx
+  800338:	3b 50 04             	cmp    0x4(%eax),%edx
+  80033b:	73 0a                	jae    800347 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80033d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800340:	89 08                	mov    %ecx,(%eax)
+  800342:	8b 45 08             	mov    0x8(%ebp),%eax
+  800345:	88 02                	mov    %al,(%edx)
+}
+  800347:	5d                   	pop    %ebp
+  800348:	c3                   	ret
+
+00800349 <printfmt>:
+{
+  800349:	55                   	push   %ebp
+  80034a:	89 e5                	mov    %esp,%ebp
+  80034c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80034f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800352:	50                   	push   %eax
+  800353:	ff 75 10             	push   0x10(%ebp)
+  800356:	ff 75 0c             	push   0xc(%ebp)
+  800359:	ff 75 08             	push   0x8(%ebp)
+  80035c:	e8 05 00 00 00       	call   800366 <vprintfmt>
+}
+  800361:	83 c4 10             	add    $0x10,%esp
+  800364:	c9                   	leave
+  800365:	c3                   	ret
+
+00800366 <vprintfmt>:
+{
+  800366:	55                   	push   %ebp
+  800367:	89 e5                	mov    %esp,%ebp
+  800369:	57                   	push   %edi
+  80036a:	56                   	push   %esi
+  80036b:	53                   	push   %ebx
+  80036c:	83 ec 2c             	sub    $0x2c,%esp
+  80036f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800372:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800375:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800378:	eb 0a                	jmp    800384 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80037a:	83 ec 08             	sub    $0x8,%esp
+  80037d:	53                   	push   %ebx
+  80037e:	50                   	push   %eax
+  80037f:	ff d6                	call   *%esi
+  800381:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800384:	83 c7 01             	add    $0x1,%edi
+  800387:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80038b:	83 f8 25             	cmp    $0x25,%eax
+  80038e:	74 0c                	je     80039c <vprintfmt+0x36>
+			if (ch == '\0')
+  800390:	85 c0                	test   %eax,%eax
+  800392:	75 e6                	jne    80037a <vprintfmt+0x14>
+}
+  800394:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800397:	5b                   	pop    %ebx
+  800398:	5e                   	pop    %esi
+  800399:	5f                   	pop    %edi
+  80039a:	5d                   	pop    %ebp
+  80039b:	c3                   	ret
+		padc = ' ';
+  80039c:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003a0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003a7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003ae:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ba:	8d 47 01             	lea    0x1(%edi),%eax
+  8003bd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003c0:	0f b6 17             	movzbl (%edi),%edx
+  8003c3:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003c6:	3c 55                	cmp    $0x55,%al
+  8003c8:	0f 87 cf 03 00 00    	ja     80079d <vprintfmt+0x437>
+  8003ce:	0f b6 c0             	movzbl %al,%eax
+  8003d1:	ff 24 85 40 30 80 00 	jmp    *0x803040(,%eax,4)
+  8003d8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003db:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003df:	eb d9                	jmp    8003ba <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003e4:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003e8:	eb d0                	jmp    8003ba <vprintfmt+0x54>
+  8003ea:	0f b6 d2             	movzbl %dl,%edx
+  8003ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003f8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003fb:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003ff:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800402:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800405:	83 f9 09             	cmp    $0x9,%ecx
+  800408:	77 55                	ja     80045f <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80040a:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80040d:	eb e9                	jmp    8003f8 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80040f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800412:	8b 00                	mov    (%eax),%eax
+  800414:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800417:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041a:	8d 40 04             	lea    0x4(%eax),%eax
+  80041d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800420:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800423:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800427:	79 91                	jns    8003ba <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800429:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80042c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800436:	eb 82                	jmp    8003ba <vprintfmt+0x54>
+			if (width < 0)
+  800438:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80043b:	85 d2                	test   %edx,%edx
+  80043d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800442:	0f 49 c2             	cmovns %edx,%eax
+  800445:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800448:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80044b:	e9 6a ff ff ff       	jmp    8003ba <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800450:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800453:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80045a:	e9 5b ff ff ff       	jmp    8003ba <vprintfmt+0x54>
+  80045f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800462:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800465:	eb bc                	jmp    800423 <vprintfmt+0xbd>
+			lflag++;
+  800467:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80046a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80046d:	e9 48 ff ff ff       	jmp    8003ba <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800472:	8b 45 14             	mov    0x14(%ebp),%eax
+  800475:	8d 78 04             	lea    0x4(%eax),%edi
+  800478:	83 ec 08             	sub    $0x8,%esp
+  80047b:	53                   	push   %ebx
+  80047c:	ff 30                	push   (%eax)
+  80047e:	ff d6                	call   *%esi
+			break;
+  800480:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800483:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800486:	e9 b1 02 00 00       	jmp    80073c <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80048b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048e:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800491:	8b 10                	mov    (%eax),%edx
+  800493:	89 d0                	mov    %edx,%eax
+  800495:	f7 d8                	neg    %eax
+  800497:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80049a:	83 f8 0f             	cmp    $0xf,%eax
+  80049d:	7f 23                	jg     8004c2 <vprintfmt+0x15c>
+  80049f:	8b 14 85 a0 31 80 00 	mov    0x8031a0(,%eax,4),%edx
+  8004a6:	85 d2                	test   %edx,%edx
+  8004a8:	74 18                	je     8004c2 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004aa:	52                   	push   %edx
+  8004ab:	68 d5 32 80 00       	push   $0x8032d5
+  8004b0:	53                   	push   %ebx
+  8004b1:	56                   	push   %esi
+  8004b2:	e8 92 fe ff ff       	call   800349 <printfmt>
+  8004b7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004ba:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004bd:	e9 7a 02 00 00       	jmp    80073c <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8004c2:	50                   	push   %eax
+  8004c3:	68 13 2f 80 00       	push   $0x802f13
+  8004c8:	53                   	push   %ebx
+  8004c9:	56                   	push   %esi
+  8004ca:	e8 7a fe ff ff       	call   800349 <printfmt>
+  8004cf:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004d2:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d5:	e9 62 02 00 00       	jmp    80073c <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dd:	83 c0 04             	add    $0x4,%eax
+  8004e0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e6:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004e8:	85 c9                	test   %ecx,%ecx
+  8004ea:	b8 0c 2f 80 00       	mov    $0x802f0c,%eax
+  8004ef:	0f 45 c1             	cmovne %ecx,%eax
+  8004f2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004f5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f9:	7e 06                	jle    800501 <vprintfmt+0x19b>
+  8004fb:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004ff:	75 0b                	jne    80050c <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800501:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800504:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800507:	89 75 08             	mov    %esi,0x8(%ebp)
+  80050a:	eb 5c                	jmp    800568 <vprintfmt+0x202>
+  80050c:	83 ec 08             	sub    $0x8,%esp
+  80050f:	ff 75 d0             	push   -0x30(%ebp)
+  800512:	ff 75 cc             	push   -0x34(%ebp)
+  800515:	e8 20 03 00 00       	call   80083a <strnlen>
+  80051a:	89 c2                	mov    %eax,%edx
+  80051c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80051f:	29 d0                	sub    %edx,%eax
+  800521:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800524:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800528:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80052b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80052e:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800530:	eb 0e                	jmp    800540 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800532:	83 ec 08             	sub    $0x8,%esp
+  800535:	53                   	push   %ebx
+  800536:	57                   	push   %edi
+  800537:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80053a:	83 ee 01             	sub    $0x1,%esi
+  80053d:	83 c4 10             	add    $0x10,%esp
+  800540:	85 f6                	test   %esi,%esi
+  800542:	7f ee                	jg     800532 <vprintfmt+0x1cc>
+  800544:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800547:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054a:	85 c0                	test   %eax,%eax
+  80054c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800551:	0f 49 d0             	cmovns %eax,%edx
+  800554:	29 d0                	sub    %edx,%eax
+  800556:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800559:	eb a6                	jmp    800501 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80055b:	83 ec 08             	sub    $0x8,%esp
+  80055e:	53                   	push   %ebx
+  80055f:	52                   	push   %edx
+  800560:	ff 55 08             	call   *0x8(%ebp)
+  800563:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800566:	89 f1                	mov    %esi,%ecx
+  800568:	8d 71 01             	lea    0x1(%ecx),%esi
+  80056b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80056f:	0f be d0             	movsbl %al,%edx
+  800572:	85 d2                	test   %edx,%edx
+  800574:	74 28                	je     80059e <vprintfmt+0x238>
+  800576:	85 ff                	test   %edi,%edi
+  800578:	78 05                	js     80057f <vprintfmt+0x219>
+  80057a:	83 ef 01             	sub    $0x1,%edi
+  80057d:	78 30                	js     8005af <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80057f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800583:	74 d6                	je     80055b <vprintfmt+0x1f5>
+  800585:	0f be c0             	movsbl %al,%eax
+  800588:	83 e8 20             	sub    $0x20,%eax
+  80058b:	83 f8 5e             	cmp    $0x5e,%eax
+  80058e:	76 cb                	jbe    80055b <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800590:	83 ec 08             	sub    $0x8,%esp
+  800593:	53                   	push   %ebx
+  800594:	6a 3f                	push   $0x3f
+  800596:	ff 55 08             	call   *0x8(%ebp)
+  800599:	83 c4 10             	add    $0x10,%esp
+  80059c:	eb c8                	jmp    800566 <vprintfmt+0x200>
+  80059e:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005a1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005a4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005a7:	01 d0                	add    %edx,%eax
+  8005a9:	29 c8                	sub    %ecx,%eax
+  8005ab:	89 c7                	mov    %eax,%edi
+  8005ad:	eb 13                	jmp    8005c2 <vprintfmt+0x25c>
+  8005af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005b2:	eb ed                	jmp    8005a1 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005b4:	83 ec 08             	sub    $0x8,%esp
+  8005b7:	53                   	push   %ebx
+  8005b8:	6a 20                	push   $0x20
+  8005ba:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005bc:	83 ef 01             	sub    $0x1,%edi
+  8005bf:	83 c4 10             	add    $0x10,%esp
+  8005c2:	85 ff                	test   %edi,%edi
+  8005c4:	7f ee                	jg     8005b4 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005c6:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005c9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005cc:	e9 6b 01 00 00       	jmp    80073c <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8005d1:	83 f9 01             	cmp    $0x1,%ecx
+  8005d4:	7f 1f                	jg     8005f5 <vprintfmt+0x28f>
+	else if (lflag)
+  8005d6:	85 c9                	test   %ecx,%ecx
+  8005d8:	74 67                	je     800641 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8b 00                	mov    (%eax),%eax
+  8005df:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e2:	89 c1                	mov    %eax,%ecx
+  8005e4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f3:	eb 17                	jmp    80060c <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f8:	8b 50 04             	mov    0x4(%eax),%edx
+  8005fb:	8b 00                	mov    (%eax),%eax
+  8005fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800600:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8d 40 08             	lea    0x8(%eax),%eax
+  800609:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80060c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80060f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800612:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800617:	85 c9                	test   %ecx,%ecx
+  800619:	0f 89 03 01 00 00    	jns    800722 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80061f:	83 ec 08             	sub    $0x8,%esp
+  800622:	53                   	push   %ebx
+  800623:	6a 2d                	push   $0x2d
+  800625:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800627:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80062a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80062d:	f7 da                	neg    %edx
+  80062f:	83 d1 00             	adc    $0x0,%ecx
+  800632:	f7 d9                	neg    %ecx
+  800634:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800637:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80063c:	e9 e1 00 00 00       	jmp    800722 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800641:	8b 45 14             	mov    0x14(%ebp),%eax
+  800644:	8b 00                	mov    (%eax),%eax
+  800646:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800649:	89 c1                	mov    %eax,%ecx
+  80064b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80064e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800651:	8b 45 14             	mov    0x14(%ebp),%eax
+  800654:	8d 40 04             	lea    0x4(%eax),%eax
+  800657:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065a:	eb b0                	jmp    80060c <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80065c:	83 f9 01             	cmp    $0x1,%ecx
+  80065f:	7f 1e                	jg     80067f <vprintfmt+0x319>
+	else if (lflag)
+  800661:	85 c9                	test   %ecx,%ecx
+  800663:	74 32                	je     800697 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800665:	8b 45 14             	mov    0x14(%ebp),%eax
+  800668:	8b 10                	mov    (%eax),%edx
+  80066a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066f:	8d 40 04             	lea    0x4(%eax),%eax
+  800672:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800675:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80067a:	e9 a3 00 00 00       	jmp    800722 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8b 10                	mov    (%eax),%edx
+  800684:	8b 48 04             	mov    0x4(%eax),%ecx
+  800687:	8d 40 08             	lea    0x8(%eax),%eax
+  80068a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80068d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800692:	e9 8b 00 00 00       	jmp    800722 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 10                	mov    (%eax),%edx
+  80069c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006ac:	eb 74                	jmp    800722 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8006ae:	83 f9 01             	cmp    $0x1,%ecx
+  8006b1:	7f 1b                	jg     8006ce <vprintfmt+0x368>
+	else if (lflag)
+  8006b3:	85 c9                	test   %ecx,%ecx
+  8006b5:	74 2c                	je     8006e3 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8006b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ba:	8b 10                	mov    (%eax),%edx
+  8006bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c7:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006cc:	eb 54                	jmp    800722 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d1:	8b 10                	mov    (%eax),%edx
+  8006d3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d6:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006dc:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006e1:	eb 3f                	jmp    800722 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8b 10                	mov    (%eax),%edx
+  8006e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006f3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006f8:	eb 28                	jmp    800722 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006fa:	83 ec 08             	sub    $0x8,%esp
+  8006fd:	53                   	push   %ebx
+  8006fe:	6a 30                	push   $0x30
+  800700:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800702:	83 c4 08             	add    $0x8,%esp
+  800705:	53                   	push   %ebx
+  800706:	6a 78                	push   $0x78
+  800708:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80070a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070d:	8b 10                	mov    (%eax),%edx
+  80070f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800714:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800717:	8d 40 04             	lea    0x4(%eax),%eax
+  80071a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071d:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800722:	83 ec 0c             	sub    $0xc,%esp
+  800725:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800729:	50                   	push   %eax
+  80072a:	ff 75 e0             	push   -0x20(%ebp)
+  80072d:	57                   	push   %edi
+  80072e:	51                   	push   %ecx
+  80072f:	52                   	push   %edx
+  800730:	89 da                	mov    %ebx,%edx
+  800732:	89 f0                	mov    %esi,%eax
+  800734:	e8 4a fb ff ff       	call   800283 <printnum>
+			break;
+  800739:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80073c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80073f:	e9 40 fc ff ff       	jmp    800384 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800744:	83 f9 01             	cmp    $0x1,%ecx
+  800747:	7f 1b                	jg     800764 <vprintfmt+0x3fe>
+	else if (lflag)
+  800749:	85 c9                	test   %ecx,%ecx
+  80074b:	74 2c                	je     800779 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80074d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800750:	8b 10                	mov    (%eax),%edx
+  800752:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800757:	8d 40 04             	lea    0x4(%eax),%eax
+  80075a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80075d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800762:	eb be                	jmp    800722 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800764:	8b 45 14             	mov    0x14(%ebp),%eax
+  800767:	8b 10                	mov    (%eax),%edx
+  800769:	8b 48 04             	mov    0x4(%eax),%ecx
+  80076c:	8d 40 08             	lea    0x8(%eax),%eax
+  80076f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800772:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800777:	eb a9                	jmp    800722 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077c:	8b 10                	mov    (%eax),%edx
+  80077e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800783:	8d 40 04             	lea    0x4(%eax),%eax
+  800786:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800789:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80078e:	eb 92                	jmp    800722 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800790:	83 ec 08             	sub    $0x8,%esp
+  800793:	53                   	push   %ebx
+  800794:	6a 25                	push   $0x25
+  800796:	ff d6                	call   *%esi
+			break;
+  800798:	83 c4 10             	add    $0x10,%esp
+  80079b:	eb 9f                	jmp    80073c <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80079d:	83 ec 08             	sub    $0x8,%esp
+  8007a0:	53                   	push   %ebx
+  8007a1:	6a 25                	push   $0x25
+  8007a3:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007a5:	83 c4 10             	add    $0x10,%esp
+  8007a8:	89 f8                	mov    %edi,%eax
+  8007aa:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007ae:	74 05                	je     8007b5 <vprintfmt+0x44f>
+  8007b0:	83 e8 01             	sub    $0x1,%eax
+  8007b3:	eb f5                	jmp    8007aa <vprintfmt+0x444>
+  8007b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007b8:	eb 82                	jmp    80073c <vprintfmt+0x3d6>
+
+008007ba <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007ba:	55                   	push   %ebp
+  8007bb:	89 e5                	mov    %esp,%ebp
+  8007bd:	83 ec 18             	sub    $0x18,%esp
+  8007c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007c6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007c9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007cd:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007d0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007d7:	85 c0                	test   %eax,%eax
+  8007d9:	74 26                	je     800801 <vsnprintf+0x47>
+  8007db:	85 d2                	test   %edx,%edx
+  8007dd:	7e 22                	jle    800801 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007df:	ff 75 14             	push   0x14(%ebp)
+  8007e2:	ff 75 10             	push   0x10(%ebp)
+  8007e5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007e8:	50                   	push   %eax
+  8007e9:	68 2c 03 80 00       	push   $0x80032c
+  8007ee:	e8 73 fb ff ff       	call   800366 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007f3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007f6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007fc:	83 c4 10             	add    $0x10,%esp
+}
+  8007ff:	c9                   	leave
+  800800:	c3                   	ret
+		return -E_INVAL;
+  800801:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800806:	eb f7                	jmp    8007ff <vsnprintf+0x45>
+
+00800808 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800808:	55                   	push   %ebp
+  800809:	89 e5                	mov    %esp,%ebp
+  80080b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80080e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800811:	50                   	push   %eax
+  800812:	ff 75 10             	push   0x10(%ebp)
+  800815:	ff 75 0c             	push   0xc(%ebp)
+  800818:	ff 75 08             	push   0x8(%ebp)
+  80081b:	e8 9a ff ff ff       	call   8007ba <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800820:	c9                   	leave
+  800821:	c3                   	ret
+
+00800822 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800822:	55                   	push   %ebp
+  800823:	89 e5                	mov    %esp,%ebp
+  800825:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082d:	eb 03                	jmp    800832 <strlen+0x10>
+		n++;
+  80082f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800832:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800836:	75 f7                	jne    80082f <strlen+0xd>
+	return n;
+}
+  800838:	5d                   	pop    %ebp
+  800839:	c3                   	ret
+
+0080083a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80083a:	55                   	push   %ebp
+  80083b:	89 e5                	mov    %esp,%ebp
+  80083d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800840:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800843:	b8 00 00 00 00       	mov    $0x0,%eax
+  800848:	eb 03                	jmp    80084d <strnlen+0x13>
+		n++;
+  80084a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80084d:	39 d0                	cmp    %edx,%eax
+  80084f:	74 08                	je     800859 <strnlen+0x1f>
+  800851:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800855:	75 f3                	jne    80084a <strnlen+0x10>
+  800857:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800859:	89 d0                	mov    %edx,%eax
+  80085b:	5d                   	pop    %ebp
+  80085c:	c3                   	ret
+
+0080085d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80085d:	55                   	push   %ebp
+  80085e:	89 e5                	mov    %esp,%ebp
+  800860:	53                   	push   %ebx
+  800861:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800864:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800867:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800870:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800873:	83 c0 01             	add    $0x1,%eax
+  800876:	84 d2                	test   %dl,%dl
+  800878:	75 f2                	jne    80086c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80087a:	89 c8                	mov    %ecx,%eax
+  80087c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80087f:	c9                   	leave
+  800880:	c3                   	ret
+
+00800881 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800881:	55                   	push   %ebp
+  800882:	89 e5                	mov    %esp,%ebp
+  800884:	53                   	push   %ebx
+  800885:	83 ec 10             	sub    $0x10,%esp
+  800888:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80088b:	53                   	push   %ebx
+  80088c:	e8 91 ff ff ff       	call   800822 <strlen>
+  800891:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800894:	ff 75 0c             	push   0xc(%ebp)
+  800897:	01 d8                	add    %ebx,%eax
+  800899:	50                   	push   %eax
+  80089a:	e8 be ff ff ff       	call   80085d <strcpy>
+	return dst;
+}
+  80089f:	89 d8                	mov    %ebx,%eax
+  8008a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a4:	c9                   	leave
+  8008a5:	c3                   	ret
+
+008008a6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	56                   	push   %esi
+  8008aa:	53                   	push   %ebx
+  8008ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008b1:	89 f3                	mov    %esi,%ebx
+  8008b3:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008b6:	89 f0                	mov    %esi,%eax
+  8008b8:	eb 0f                	jmp    8008c9 <strncpy+0x23>
+		*dst++ = *src;
+  8008ba:	83 c0 01             	add    $0x1,%eax
+  8008bd:	0f b6 0a             	movzbl (%edx),%ecx
+  8008c0:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008c3:	80 f9 01             	cmp    $0x1,%cl
+  8008c6:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008c9:	39 d8                	cmp    %ebx,%eax
+  8008cb:	75 ed                	jne    8008ba <strncpy+0x14>
+	}
+	return ret;
+}
+  8008cd:	89 f0                	mov    %esi,%eax
+  8008cf:	5b                   	pop    %ebx
+  8008d0:	5e                   	pop    %esi
+  8008d1:	5d                   	pop    %ebp
+  8008d2:	c3                   	ret
+
+008008d3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008d3:	55                   	push   %ebp
+  8008d4:	89 e5                	mov    %esp,%ebp
+  8008d6:	56                   	push   %esi
+  8008d7:	53                   	push   %ebx
+  8008d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008de:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008e1:	89 f0                	mov    %esi,%eax
+  8008e3:	85 d2                	test   %edx,%edx
+  8008e5:	74 21                	je     800908 <strlcpy+0x35>
+  8008e7:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008eb:	89 f2                	mov    %esi,%edx
+  8008ed:	eb 09                	jmp    8008f8 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008ef:	83 c1 01             	add    $0x1,%ecx
+  8008f2:	83 c2 01             	add    $0x1,%edx
+  8008f5:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008f8:	39 c2                	cmp    %eax,%edx
+  8008fa:	74 09                	je     800905 <strlcpy+0x32>
+  8008fc:	0f b6 19             	movzbl (%ecx),%ebx
+  8008ff:	84 db                	test   %bl,%bl
+  800901:	75 ec                	jne    8008ef <strlcpy+0x1c>
+  800903:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800905:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800908:	29 f0                	sub    %esi,%eax
+}
+  80090a:	5b                   	pop    %ebx
+  80090b:	5e                   	pop    %esi
+  80090c:	5d                   	pop    %ebp
+  80090d:	c3                   	ret
+
+0080090e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800914:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800917:	eb 06                	jmp    80091f <strcmp+0x11>
+		p++, q++;
+  800919:	83 c1 01             	add    $0x1,%ecx
+  80091c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80091f:	0f b6 01             	movzbl (%ecx),%eax
+  800922:	84 c0                	test   %al,%al
+  800924:	74 04                	je     80092a <strcmp+0x1c>
+  800926:	3a 02                	cmp    (%edx),%al
+  800928:	74 ef                	je     800919 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80092a:	0f b6 c0             	movzbl %al,%eax
+  80092d:	0f b6 12             	movzbl (%edx),%edx
+  800930:	29 d0                	sub    %edx,%eax
+}
+  800932:	5d                   	pop    %ebp
+  800933:	c3                   	ret
+
+00800934 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800934:	55                   	push   %ebp
+  800935:	89 e5                	mov    %esp,%ebp
+  800937:	53                   	push   %ebx
+  800938:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80093e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800941:	eb 09                	jmp    80094c <strncmp+0x18>
+		n--, p++, q++;
+  800943:	83 ea 01             	sub    $0x1,%edx
+  800946:	83 c0 01             	add    $0x1,%eax
+  800949:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80094c:	85 d2                	test   %edx,%edx
+  80094e:	74 18                	je     800968 <strncmp+0x34>
+  800950:	0f b6 18             	movzbl (%eax),%ebx
+  800953:	84 db                	test   %bl,%bl
+  800955:	74 04                	je     80095b <strncmp+0x27>
+  800957:	3a 19                	cmp    (%ecx),%bl
+  800959:	74 e8                	je     800943 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80095b:	0f b6 00             	movzbl (%eax),%eax
+  80095e:	0f b6 11             	movzbl (%ecx),%edx
+  800961:	29 d0                	sub    %edx,%eax
+}
+  800963:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800966:	c9                   	leave
+  800967:	c3                   	ret
+		return 0;
+  800968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096d:	eb f4                	jmp    800963 <strncmp+0x2f>
+
+0080096f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80096f:	55                   	push   %ebp
+  800970:	89 e5                	mov    %esp,%ebp
+  800972:	8b 45 08             	mov    0x8(%ebp),%eax
+  800975:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800979:	eb 03                	jmp    80097e <strchr+0xf>
+  80097b:	83 c0 01             	add    $0x1,%eax
+  80097e:	0f b6 10             	movzbl (%eax),%edx
+  800981:	84 d2                	test   %dl,%dl
+  800983:	74 06                	je     80098b <strchr+0x1c>
+		if (*s == c)
+  800985:	38 ca                	cmp    %cl,%dl
+  800987:	75 f2                	jne    80097b <strchr+0xc>
+  800989:	eb 05                	jmp    800990 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80098b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800990:	5d                   	pop    %ebp
+  800991:	c3                   	ret
+
+00800992 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800992:	55                   	push   %ebp
+  800993:	89 e5                	mov    %esp,%ebp
+  800995:	8b 45 08             	mov    0x8(%ebp),%eax
+  800998:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80099c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80099f:	38 ca                	cmp    %cl,%dl
+  8009a1:	74 09                	je     8009ac <strfind+0x1a>
+  8009a3:	84 d2                	test   %dl,%dl
+  8009a5:	74 05                	je     8009ac <strfind+0x1a>
+	for (; *s; s++)
+  8009a7:	83 c0 01             	add    $0x1,%eax
+  8009aa:	eb f0                	jmp    80099c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009ac:	5d                   	pop    %ebp
+  8009ad:	c3                   	ret
+
+008009ae <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009ae:	55                   	push   %ebp
+  8009af:	89 e5                	mov    %esp,%ebp
+  8009b1:	57                   	push   %edi
+  8009b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009b5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009b8:	85 c9                	test   %ecx,%ecx
+  8009ba:	74 20                	je     8009dc <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009bc:	89 f8                	mov    %edi,%eax
+  8009be:	09 c8                	or     %ecx,%eax
+  8009c0:	a8 03                	test   $0x3,%al
+  8009c2:	75 12                	jne    8009d6 <memset+0x28>
+		c &= 0xFF;
+  8009c4:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009c8:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009ce:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009d1:	fc                   	cld
+  8009d2:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009d4:	eb 06                	jmp    8009dc <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009d9:	fc                   	cld
+  8009da:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009dc:	89 f8                	mov    %edi,%eax
+  8009de:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009e1:	c9                   	leave
+  8009e2:	c3                   	ret
+
+008009e3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009e3:	55                   	push   %ebp
+  8009e4:	89 e5                	mov    %esp,%ebp
+  8009e6:	57                   	push   %edi
+  8009e7:	56                   	push   %esi
+  8009e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009ee:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009f1:	39 c6                	cmp    %eax,%esi
+  8009f3:	73 32                	jae    800a27 <memmove+0x44>
+  8009f5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009f8:	39 d0                	cmp    %edx,%eax
+  8009fa:	73 2b                	jae    800a27 <memmove+0x44>
+		s += n;
+		d += n;
+  8009fc:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ff:	89 d6                	mov    %edx,%esi
+  800a01:	09 fe                	or     %edi,%esi
+  800a03:	09 ce                	or     %ecx,%esi
+  800a05:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a0b:	75 0e                	jne    800a1b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a0d:	83 ef 04             	sub    $0x4,%edi
+  800a10:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a13:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a16:	fd                   	std
+  800a17:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a19:	eb 09                	jmp    800a24 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a1b:	83 ef 01             	sub    $0x1,%edi
+  800a1e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a21:	fd                   	std
+  800a22:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a24:	fc                   	cld
+  800a25:	eb 1a                	jmp    800a41 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a27:	89 f2                	mov    %esi,%edx
+  800a29:	09 c2                	or     %eax,%edx
+  800a2b:	09 ca                	or     %ecx,%edx
+  800a2d:	f6 c2 03             	test   $0x3,%dl
+  800a30:	75 0a                	jne    800a3c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a32:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a35:	89 c7                	mov    %eax,%edi
+  800a37:	fc                   	cld
+  800a38:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a3a:	eb 05                	jmp    800a41 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a3c:	89 c7                	mov    %eax,%edi
+  800a3e:	fc                   	cld
+  800a3f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a41:	5e                   	pop    %esi
+  800a42:	5f                   	pop    %edi
+  800a43:	5d                   	pop    %ebp
+  800a44:	c3                   	ret
+
+00800a45 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a4b:	ff 75 10             	push   0x10(%ebp)
+  800a4e:	ff 75 0c             	push   0xc(%ebp)
+  800a51:	ff 75 08             	push   0x8(%ebp)
+  800a54:	e8 8a ff ff ff       	call   8009e3 <memmove>
+}
+  800a59:	c9                   	leave
+  800a5a:	c3                   	ret
+
+00800a5b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a5b:	55                   	push   %ebp
+  800a5c:	89 e5                	mov    %esp,%ebp
+  800a5e:	56                   	push   %esi
+  800a5f:	53                   	push   %ebx
+  800a60:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a63:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a66:	89 c6                	mov    %eax,%esi
+  800a68:	03 75 10             	add    0x10(%ebp),%esi
+  800a6b:	eb 06                	jmp    800a73 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a6d:	83 c0 01             	add    $0x1,%eax
+  800a70:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a73:	39 f0                	cmp    %esi,%eax
+  800a75:	74 14                	je     800a8b <memcmp+0x30>
+		if (*s1 != *s2)
+  800a77:	0f b6 08             	movzbl (%eax),%ecx
+  800a7a:	0f b6 1a             	movzbl (%edx),%ebx
+  800a7d:	38 d9                	cmp    %bl,%cl
+  800a7f:	74 ec                	je     800a6d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a81:	0f b6 c1             	movzbl %cl,%eax
+  800a84:	0f b6 db             	movzbl %bl,%ebx
+  800a87:	29 d8                	sub    %ebx,%eax
+  800a89:	eb 05                	jmp    800a90 <memcmp+0x35>
+	}
+
+	return 0;
+  800a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a90:	5b                   	pop    %ebx
+  800a91:	5e                   	pop    %esi
+  800a92:	5d                   	pop    %ebp
+  800a93:	c3                   	ret
+
+00800a94 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a94:	55                   	push   %ebp
+  800a95:	89 e5                	mov    %esp,%ebp
+  800a97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a9d:	89 c2                	mov    %eax,%edx
+  800a9f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800aa2:	eb 03                	jmp    800aa7 <memfind+0x13>
+  800aa4:	83 c0 01             	add    $0x1,%eax
+  800aa7:	39 d0                	cmp    %edx,%eax
+  800aa9:	73 04                	jae    800aaf <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aab:	38 08                	cmp    %cl,(%eax)
+  800aad:	75 f5                	jne    800aa4 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aaf:	5d                   	pop    %ebp
+  800ab0:	c3                   	ret
+
+00800ab1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	57                   	push   %edi
+  800ab5:	56                   	push   %esi
+  800ab6:	53                   	push   %ebx
+  800ab7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800abd:	eb 03                	jmp    800ac2 <strtol+0x11>
+		s++;
+  800abf:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ac2:	0f b6 02             	movzbl (%edx),%eax
+  800ac5:	3c 20                	cmp    $0x20,%al
+  800ac7:	74 f6                	je     800abf <strtol+0xe>
+  800ac9:	3c 09                	cmp    $0x9,%al
+  800acb:	74 f2                	je     800abf <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800acd:	3c 2b                	cmp    $0x2b,%al
+  800acf:	74 2a                	je     800afb <strtol+0x4a>
+	int neg = 0;
+  800ad1:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ad6:	3c 2d                	cmp    $0x2d,%al
+  800ad8:	74 2b                	je     800b05 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ada:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ae0:	75 0f                	jne    800af1 <strtol+0x40>
+  800ae2:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ae5:	74 28                	je     800b0f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ae7:	85 db                	test   %ebx,%ebx
+  800ae9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aee:	0f 44 d8             	cmove  %eax,%ebx
+  800af1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800af9:	eb 46                	jmp    800b41 <strtol+0x90>
+		s++;
+  800afb:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800afe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b03:	eb d5                	jmp    800ada <strtol+0x29>
+		s++, neg = 1;
+  800b05:	83 c2 01             	add    $0x1,%edx
+  800b08:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b0d:	eb cb                	jmp    800ada <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b0f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b13:	74 0e                	je     800b23 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b15:	85 db                	test   %ebx,%ebx
+  800b17:	75 d8                	jne    800af1 <strtol+0x40>
+		s++, base = 8;
+  800b19:	83 c2 01             	add    $0x1,%edx
+  800b1c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b21:	eb ce                	jmp    800af1 <strtol+0x40>
+		s += 2, base = 16;
+  800b23:	83 c2 02             	add    $0x2,%edx
+  800b26:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b2b:	eb c4                	jmp    800af1 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b2d:	0f be c0             	movsbl %al,%eax
+  800b30:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b33:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b36:	7d 3a                	jge    800b72 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b38:	83 c2 01             	add    $0x1,%edx
+  800b3b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b3f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b41:	0f b6 02             	movzbl (%edx),%eax
+  800b44:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b47:	89 f3                	mov    %esi,%ebx
+  800b49:	80 fb 09             	cmp    $0x9,%bl
+  800b4c:	76 df                	jbe    800b2d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b4e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b51:	89 f3                	mov    %esi,%ebx
+  800b53:	80 fb 19             	cmp    $0x19,%bl
+  800b56:	77 08                	ja     800b60 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b58:	0f be c0             	movsbl %al,%eax
+  800b5b:	83 e8 57             	sub    $0x57,%eax
+  800b5e:	eb d3                	jmp    800b33 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b60:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b63:	89 f3                	mov    %esi,%ebx
+  800b65:	80 fb 19             	cmp    $0x19,%bl
+  800b68:	77 08                	ja     800b72 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b6a:	0f be c0             	movsbl %al,%eax
+  800b6d:	83 e8 37             	sub    $0x37,%eax
+  800b70:	eb c1                	jmp    800b33 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b72:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b76:	74 05                	je     800b7d <strtol+0xcc>
+		*endptr = (char *) s;
+  800b78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b7b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b7d:	89 c8                	mov    %ecx,%eax
+  800b7f:	f7 d8                	neg    %eax
+  800b81:	85 ff                	test   %edi,%edi
+  800b83:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b86:	89 c8                	mov    %ecx,%eax
+  800b88:	5b                   	pop    %ebx
+  800b89:	5e                   	pop    %esi
+  800b8a:	5f                   	pop    %edi
+  800b8b:	5d                   	pop    %ebp
+  800b8c:	c3                   	ret
+
+00800b8d <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b8d:	55                   	push   %ebp
+  800b8e:	89 e5                	mov    %esp,%ebp
+  800b90:	57                   	push   %edi
+  800b91:	56                   	push   %esi
+  800b92:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b9e:	89 c3                	mov    %eax,%ebx
+  800ba0:	89 c7                	mov    %eax,%edi
+  800ba2:	89 c6                	mov    %eax,%esi
+  800ba4:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ba6:	5b                   	pop    %ebx
+  800ba7:	5e                   	pop    %esi
+  800ba8:	5f                   	pop    %edi
+  800ba9:	5d                   	pop    %ebp
+  800baa:	c3                   	ret
+
+00800bab <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bab:	55                   	push   %ebp
+  800bac:	89 e5                	mov    %esp,%ebp
+  800bae:	57                   	push   %edi
+  800baf:	56                   	push   %esi
+  800bb0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bbb:	89 d1                	mov    %edx,%ecx
+  800bbd:	89 d3                	mov    %edx,%ebx
+  800bbf:	89 d7                	mov    %edx,%edi
+  800bc1:	89 d6                	mov    %edx,%esi
+  800bc3:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bc5:	5b                   	pop    %ebx
+  800bc6:	5e                   	pop    %esi
+  800bc7:	5f                   	pop    %edi
+  800bc8:	5d                   	pop    %ebp
+  800bc9:	c3                   	ret
+
+00800bca <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800bca:	55                   	push   %ebp
+  800bcb:	89 e5                	mov    %esp,%ebp
+  800bcd:	57                   	push   %edi
+  800bce:	56                   	push   %esi
+  800bcf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bdd:	89 cb                	mov    %ecx,%ebx
+  800bdf:	89 cf                	mov    %ecx,%edi
+  800be1:	89 ce                	mov    %ecx,%esi
+  800be3:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800be5:	5b                   	pop    %ebx
+  800be6:	5e                   	pop    %esi
+  800be7:	5f                   	pop    %edi
+  800be8:	5d                   	pop    %ebp
+  800be9:	c3                   	ret
+
+00800bea <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	57                   	push   %edi
+  800bee:	56                   	push   %esi
+  800bef:	53                   	push   %ebx
+  800bf0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bf3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c00:	89 cb                	mov    %ecx,%ebx
+  800c02:	89 cf                	mov    %ecx,%edi
+  800c04:	89 ce                	mov    %ecx,%esi
+  800c06:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c08:	85 c0                	test   %eax,%eax
+  800c0a:	7f 08                	jg     800c14 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c0f:	5b                   	pop    %ebx
+  800c10:	5e                   	pop    %esi
+  800c11:	5f                   	pop    %edi
+  800c12:	5d                   	pop    %ebp
+  800c13:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c14:	83 ec 0c             	sub    $0xc,%esp
+  800c17:	50                   	push   %eax
+  800c18:	6a 03                	push   $0x3
+  800c1a:	68 ff 31 80 00       	push   $0x8031ff
+  800c1f:	6a 23                	push   $0x23
+  800c21:	68 1c 32 80 00       	push   $0x80321c
+  800c26:	e8 69 f5 ff ff       	call   800194 <_panic>
+
+00800c2b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c2b:	55                   	push   %ebp
+  800c2c:	89 e5                	mov    %esp,%ebp
+  800c2e:	57                   	push   %edi
+  800c2f:	56                   	push   %esi
+  800c30:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c36:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c3b:	89 d1                	mov    %edx,%ecx
+  800c3d:	89 d3                	mov    %edx,%ebx
+  800c3f:	89 d7                	mov    %edx,%edi
+  800c41:	89 d6                	mov    %edx,%esi
+  800c43:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c45:	5b                   	pop    %ebx
+  800c46:	5e                   	pop    %esi
+  800c47:	5f                   	pop    %edi
+  800c48:	5d                   	pop    %ebp
+  800c49:	c3                   	ret
+
+00800c4a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c4a:	55                   	push   %ebp
+  800c4b:	89 e5                	mov    %esp,%ebp
+  800c4d:	57                   	push   %edi
+  800c4e:	56                   	push   %esi
+  800c4f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c55:	b8 16 00 00 00       	mov    $0x16,%eax
+  800c5a:	89 d1                	mov    %edx,%ecx
+  800c5c:	89 d3                	mov    %edx,%ebx
+  800c5e:	89 d7                	mov    %edx,%edi
+  800c60:	89 d6                	mov    %edx,%esi
+  800c62:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c64:	5b                   	pop    %ebx
+  800c65:	5e                   	pop    %esi
+  800c66:	5f                   	pop    %edi
+  800c67:	5d                   	pop    %ebp
+  800c68:	c3                   	ret
+
+00800c69 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800c69:	55                   	push   %ebp
+  800c6a:	89 e5                	mov    %esp,%ebp
+  800c6c:	57                   	push   %edi
+  800c6d:	56                   	push   %esi
+  800c6e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c74:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800c79:	89 d1                	mov    %edx,%ecx
+  800c7b:	89 d3                	mov    %edx,%ebx
+  800c7d:	89 d7                	mov    %edx,%edi
+  800c7f:	89 d6                	mov    %edx,%esi
+  800c81:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800c83:	5b                   	pop    %ebx
+  800c84:	5e                   	pop    %esi
+  800c85:	5f                   	pop    %edi
+  800c86:	5d                   	pop    %ebp
+  800c87:	c3                   	ret
+
+00800c88 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	57                   	push   %edi
+  800c8c:	56                   	push   %esi
+  800c8d:	53                   	push   %ebx
+  800c8e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9c:	b8 15 00 00 00       	mov    $0x15,%eax
+  800ca1:	89 df                	mov    %ebx,%edi
+  800ca3:	89 de                	mov    %ebx,%esi
+  800ca5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ca7:	85 c0                	test   %eax,%eax
+  800ca9:	7f 08                	jg     800cb3 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800cab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cae:	5b                   	pop    %ebx
+  800caf:	5e                   	pop    %esi
+  800cb0:	5f                   	pop    %edi
+  800cb1:	5d                   	pop    %ebp
+  800cb2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb3:	83 ec 0c             	sub    $0xc,%esp
+  800cb6:	50                   	push   %eax
+  800cb7:	6a 15                	push   $0x15
+  800cb9:	68 ff 31 80 00       	push   $0x8031ff
+  800cbe:	6a 23                	push   $0x23
+  800cc0:	68 1c 32 80 00       	push   $0x80321c
+  800cc5:	e8 ca f4 ff ff       	call   800194 <_panic>
+
+00800cca <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	57                   	push   %edi
+  800cce:	56                   	push   %esi
+  800ccf:	53                   	push   %ebx
+  800cd0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cd3:	be 00 00 00 00       	mov    $0x0,%esi
+  800cd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cde:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ce3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ce6:	89 f7                	mov    %esi,%edi
+  800ce8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cea:	85 c0                	test   %eax,%eax
+  800cec:	7f 08                	jg     800cf6 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf1:	5b                   	pop    %ebx
+  800cf2:	5e                   	pop    %esi
+  800cf3:	5f                   	pop    %edi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf6:	83 ec 0c             	sub    $0xc,%esp
+  800cf9:	50                   	push   %eax
+  800cfa:	6a 05                	push   $0x5
+  800cfc:	68 ff 31 80 00       	push   $0x8031ff
+  800d01:	6a 23                	push   $0x23
+  800d03:	68 1c 32 80 00       	push   $0x80321c
+  800d08:	e8 87 f4 ff ff       	call   800194 <_panic>
+
+00800d0d <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+  800d13:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d16:	be 00 00 00 00       	mov    $0x0,%esi
+  800d1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d21:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d29:	89 f7                	mov    %esi,%edi
+  800d2b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d2d:	85 c0                	test   %eax,%eax
+  800d2f:	7f 08                	jg     800d39 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d34:	5b                   	pop    %ebx
+  800d35:	5e                   	pop    %esi
+  800d36:	5f                   	pop    %edi
+  800d37:	5d                   	pop    %ebp
+  800d38:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d39:	83 ec 0c             	sub    $0xc,%esp
+  800d3c:	50                   	push   %eax
+  800d3d:	6a 06                	push   $0x6
+  800d3f:	68 ff 31 80 00       	push   $0x8031ff
+  800d44:	6a 23                	push   $0x23
+  800d46:	68 1c 32 80 00       	push   $0x80321c
+  800d4b:	e8 44 f4 ff ff       	call   800194 <_panic>
+
+00800d50 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d50:	55                   	push   %ebp
+  800d51:	89 e5                	mov    %esp,%ebp
+  800d53:	57                   	push   %edi
+  800d54:	56                   	push   %esi
+  800d55:	53                   	push   %ebx
+  800d56:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5f:	b8 07 00 00 00       	mov    $0x7,%eax
+  800d64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d67:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d6a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d6d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d6f:	85 c0                	test   %eax,%eax
+  800d71:	7f 08                	jg     800d7b <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d76:	5b                   	pop    %ebx
+  800d77:	5e                   	pop    %esi
+  800d78:	5f                   	pop    %edi
+  800d79:	5d                   	pop    %ebp
+  800d7a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d7b:	83 ec 0c             	sub    $0xc,%esp
+  800d7e:	50                   	push   %eax
+  800d7f:	6a 07                	push   $0x7
+  800d81:	68 ff 31 80 00       	push   $0x8031ff
+  800d86:	6a 23                	push   $0x23
+  800d88:	68 1c 32 80 00       	push   $0x80321c
+  800d8d:	e8 02 f4 ff ff       	call   800194 <_panic>
+
+00800d92 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d92:	55                   	push   %ebp
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	57                   	push   %edi
+  800d96:	56                   	push   %esi
+  800d97:	53                   	push   %ebx
+  800d98:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da6:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dab:	89 df                	mov    %ebx,%edi
+  800dad:	89 de                	mov    %ebx,%esi
+  800daf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800db1:	85 c0                	test   %eax,%eax
+  800db3:	7f 08                	jg     800dbd <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800db5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db8:	5b                   	pop    %ebx
+  800db9:	5e                   	pop    %esi
+  800dba:	5f                   	pop    %edi
+  800dbb:	5d                   	pop    %ebp
+  800dbc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dbd:	83 ec 0c             	sub    $0xc,%esp
+  800dc0:	50                   	push   %eax
+  800dc1:	6a 08                	push   $0x8
+  800dc3:	68 ff 31 80 00       	push   $0x8031ff
+  800dc8:	6a 23                	push   $0x23
+  800dca:	68 1c 32 80 00       	push   $0x80321c
+  800dcf:	e8 c0 f3 ff ff       	call   800194 <_panic>
+
+00800dd4 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800dd4:	55                   	push   %ebp
+  800dd5:	89 e5                	mov    %esp,%ebp
+  800dd7:	57                   	push   %edi
+  800dd8:	56                   	push   %esi
+  800dd9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de0:	b8 09 00 00 00       	mov    $0x9,%eax
+  800de5:	be 00 00 00 00       	mov    $0x0,%esi
+  800dea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ded:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df0:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800df2:	5b                   	pop    %ebx
+  800df3:	5e                   	pop    %esi
+  800df4:	5f                   	pop    %edi
+  800df5:	5d                   	pop    %ebp
+  800df6:	c3                   	ret
+
+00800df7 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800df7:	55                   	push   %ebp
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	57                   	push   %edi
+  800dfb:	56                   	push   %esi
+  800dfc:	53                   	push   %ebx
+  800dfd:	8b 45 18             	mov    0x18(%ebp),%eax
+  800e00:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800e03:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800e08:	77 27                	ja     800e31 <sys_page_map_range+0x3a>
+  800e0a:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800e10:	77 1f                	ja     800e31 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800e12:	c1 e0 0c             	shl    $0xc,%eax
+  800e15:	89 c6                	mov    %eax,%esi
+  800e17:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800e19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e27:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e2a:	cd 30                	int    $0x30
+}
+  800e2c:	5b                   	pop    %ebx
+  800e2d:	5e                   	pop    %esi
+  800e2e:	5f                   	pop    %edi
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+		return -E_INVAL;
+  800e31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e36:	eb f4                	jmp    800e2c <sys_page_map_range+0x35>
+
+00800e38 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800e38:	55                   	push   %ebp
+  800e39:	89 e5                	mov    %esp,%ebp
+  800e3b:	57                   	push   %edi
+  800e3c:	56                   	push   %esi
+  800e3d:	53                   	push   %ebx
+  800e3e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e47:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e4c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e54:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e57:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e59:	85 c0                	test   %eax,%eax
+  800e5b:	7f 08                	jg     800e65 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e60:	5b                   	pop    %ebx
+  800e61:	5e                   	pop    %esi
+  800e62:	5f                   	pop    %edi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+  800e68:	50                   	push   %eax
+  800e69:	6a 0c                	push   $0xc
+  800e6b:	68 ff 31 80 00       	push   $0x8031ff
+  800e70:	6a 23                	push   $0x23
+  800e72:	68 1c 32 80 00       	push   $0x80321c
+  800e77:	e8 18 f3 ff ff       	call   800194 <_panic>
+
+00800e7c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	57                   	push   %edi
+  800e80:	56                   	push   %esi
+  800e81:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e82:	be 00 00 00 00       	mov    $0x0,%esi
+  800e87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e95:	89 f7                	mov    %esi,%edi
+  800e97:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e99:	5b                   	pop    %ebx
+  800e9a:	5e                   	pop    %esi
+  800e9b:	5f                   	pop    %edi
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	c3                   	ret
+
+00800e9e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	57                   	push   %edi
+  800ea2:	56                   	push   %esi
+  800ea3:	53                   	push   %ebx
+  800ea4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800eb7:	89 df                	mov    %ebx,%edi
+  800eb9:	89 de                	mov    %ebx,%esi
+  800ebb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ebd:	85 c0                	test   %eax,%eax
+  800ebf:	7f 08                	jg     800ec9 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ec1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec4:	5b                   	pop    %ebx
+  800ec5:	5e                   	pop    %esi
+  800ec6:	5f                   	pop    %edi
+  800ec7:	5d                   	pop    %ebp
+  800ec8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec9:	83 ec 0c             	sub    $0xc,%esp
+  800ecc:	50                   	push   %eax
+  800ecd:	6a 0f                	push   $0xf
+  800ecf:	68 ff 31 80 00       	push   $0x8031ff
+  800ed4:	6a 23                	push   $0x23
+  800ed6:	68 1c 32 80 00       	push   $0x80321c
+  800edb:	e8 b4 f2 ff ff       	call   800194 <_panic>
+
+00800ee0 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800ee0:	55                   	push   %ebp
+  800ee1:	89 e5                	mov    %esp,%ebp
+  800ee3:	57                   	push   %edi
+  800ee4:	56                   	push   %esi
+  800ee5:	53                   	push   %ebx
+  800ee6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ee9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef4:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ef9:	89 df                	mov    %ebx,%edi
+  800efb:	89 de                	mov    %ebx,%esi
+  800efd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eff:	85 c0                	test   %eax,%eax
+  800f01:	7f 08                	jg     800f0b <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800f03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f06:	5b                   	pop    %ebx
+  800f07:	5e                   	pop    %esi
+  800f08:	5f                   	pop    %edi
+  800f09:	5d                   	pop    %ebp
+  800f0a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0b:	83 ec 0c             	sub    $0xc,%esp
+  800f0e:	50                   	push   %eax
+  800f0f:	6a 10                	push   $0x10
+  800f11:	68 ff 31 80 00       	push   $0x8031ff
+  800f16:	6a 23                	push   $0x23
+  800f18:	68 1c 32 80 00       	push   $0x80321c
+  800f1d:	e8 72 f2 ff ff       	call   800194 <_panic>
+
+00800f22 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800f22:	55                   	push   %ebp
+  800f23:	89 e5                	mov    %esp,%ebp
+  800f25:	57                   	push   %edi
+  800f26:	56                   	push   %esi
+  800f27:	53                   	push   %ebx
+  800f28:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f36:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f3b:	89 df                	mov    %ebx,%edi
+  800f3d:	89 de                	mov    %ebx,%esi
+  800f3f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f41:	85 c0                	test   %eax,%eax
+  800f43:	7f 08                	jg     800f4d <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800f45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f48:	5b                   	pop    %ebx
+  800f49:	5e                   	pop    %esi
+  800f4a:	5f                   	pop    %edi
+  800f4b:	5d                   	pop    %ebp
+  800f4c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4d:	83 ec 0c             	sub    $0xc,%esp
+  800f50:	50                   	push   %eax
+  800f51:	6a 11                	push   $0x11
+  800f53:	68 ff 31 80 00       	push   $0x8031ff
+  800f58:	6a 23                	push   $0x23
+  800f5a:	68 1c 32 80 00       	push   $0x80321c
+  800f5f:	e8 30 f2 ff ff       	call   800194 <_panic>
+
+00800f64 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	57                   	push   %edi
+  800f68:	56                   	push   %esi
+  800f69:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f74:	89 d1                	mov    %edx,%ecx
+  800f76:	89 d3                	mov    %edx,%ebx
+  800f78:	89 d7                	mov    %edx,%edi
+  800f7a:	89 d6                	mov    %edx,%esi
+  800f7c:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800f7e:	5b                   	pop    %ebx
+  800f7f:	5e                   	pop    %esi
+  800f80:	5f                   	pop    %edi
+  800f81:	5d                   	pop    %ebp
+  800f82:	c3                   	ret
+
+00800f83 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	57                   	push   %edi
+  800f87:	56                   	push   %esi
+  800f88:	53                   	push   %ebx
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f97:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f9c:	89 df                	mov    %ebx,%edi
+  800f9e:	89 de                	mov    %ebx,%esi
+  800fa0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa2:	85 c0                	test   %eax,%eax
+  800fa4:	7f 08                	jg     800fae <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fa6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa9:	5b                   	pop    %ebx
+  800faa:	5e                   	pop    %esi
+  800fab:	5f                   	pop    %edi
+  800fac:	5d                   	pop    %ebp
+  800fad:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fae:	83 ec 0c             	sub    $0xc,%esp
+  800fb1:	50                   	push   %eax
+  800fb2:	6a 13                	push   $0x13
+  800fb4:	68 ff 31 80 00       	push   $0x8031ff
+  800fb9:	6a 23                	push   $0x23
+  800fbb:	68 1c 32 80 00       	push   $0x80321c
+  800fc0:	e8 cf f1 ff ff       	call   800194 <_panic>
+
+00800fc5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fc5:	55                   	push   %ebp
+  800fc6:	89 e5                	mov    %esp,%ebp
+  800fc8:	57                   	push   %edi
+  800fc9:	56                   	push   %esi
+  800fca:	53                   	push   %ebx
+  800fcb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd9:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fde:	89 df                	mov    %ebx,%edi
+  800fe0:	89 de                	mov    %ebx,%esi
+  800fe2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe4:	85 c0                	test   %eax,%eax
+  800fe6:	7f 08                	jg     800ff0 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fe8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800feb:	5b                   	pop    %ebx
+  800fec:	5e                   	pop    %esi
+  800fed:	5f                   	pop    %edi
+  800fee:	5d                   	pop    %ebp
+  800fef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff0:	83 ec 0c             	sub    $0xc,%esp
+  800ff3:	50                   	push   %eax
+  800ff4:	6a 14                	push   $0x14
+  800ff6:	68 ff 31 80 00       	push   $0x8031ff
+  800ffb:	6a 23                	push   $0x23
+  800ffd:	68 1c 32 80 00       	push   $0x80321c
+  801002:	e8 8d f1 ff ff       	call   800194 <_panic>
+
+00801007 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801007:	55                   	push   %ebp
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	57                   	push   %edi
+  80100b:	56                   	push   %esi
+  80100c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80100d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801010:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801013:	b8 17 00 00 00       	mov    $0x17,%eax
+  801018:	be 00 00 00 00       	mov    $0x0,%esi
+  80101d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801020:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801023:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801025:	5b                   	pop    %ebx
+  801026:	5e                   	pop    %esi
+  801027:	5f                   	pop    %edi
+  801028:	5d                   	pop    %ebp
+  801029:	c3                   	ret
+
+0080102a <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80102a:	55                   	push   %ebp
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	57                   	push   %edi
+  80102e:	56                   	push   %esi
+  80102f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801030:	8b 55 08             	mov    0x8(%ebp),%edx
+  801033:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801036:	b8 18 00 00 00       	mov    $0x18,%eax
+  80103b:	be 00 00 00 00       	mov    $0x0,%esi
+  801040:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801043:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801046:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801048:	5b                   	pop    %ebx
+  801049:	5e                   	pop    %esi
+  80104a:	5f                   	pop    %edi
+  80104b:	5d                   	pop    %ebp
+  80104c:	c3                   	ret
+
+0080104d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80104d:	55                   	push   %ebp
+  80104e:	89 e5                	mov    %esp,%ebp
+  801050:	57                   	push   %edi
+  801051:	56                   	push   %esi
+  801052:	53                   	push   %ebx
+  801053:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801056:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80105b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105e:	b8 19 00 00 00       	mov    $0x19,%eax
+  801063:	89 cb                	mov    %ecx,%ebx
+  801065:	89 cf                	mov    %ecx,%edi
+  801067:	89 ce                	mov    %ecx,%esi
+  801069:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80106b:	85 c0                	test   %eax,%eax
+  80106d:	7f 08                	jg     801077 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80106f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801072:	5b                   	pop    %ebx
+  801073:	5e                   	pop    %esi
+  801074:	5f                   	pop    %edi
+  801075:	5d                   	pop    %ebp
+  801076:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801077:	83 ec 0c             	sub    $0xc,%esp
+  80107a:	50                   	push   %eax
+  80107b:	6a 19                	push   $0x19
+  80107d:	68 ff 31 80 00       	push   $0x8031ff
+  801082:	6a 23                	push   $0x23
+  801084:	68 1c 32 80 00       	push   $0x80321c
+  801089:	e8 06 f1 ff ff       	call   800194 <_panic>
+
+0080108e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	57                   	push   %edi
+  801092:	56                   	push   %esi
+  801093:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801094:	ba 00 00 00 00       	mov    $0x0,%edx
+  801099:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80109e:	89 d1                	mov    %edx,%ecx
+  8010a0:	89 d3                	mov    %edx,%ebx
+  8010a2:	89 d7                	mov    %edx,%edi
+  8010a4:	89 d6                	mov    %edx,%esi
+  8010a6:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010a8:	5b                   	pop    %ebx
+  8010a9:	5e                   	pop    %esi
+  8010aa:	5f                   	pop    %edi
+  8010ab:	5d                   	pop    %ebp
+  8010ac:	c3                   	ret
+
+008010ad <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	57                   	push   %edi
+  8010b1:	56                   	push   %esi
+  8010b2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010be:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010c3:	89 df                	mov    %ebx,%edi
+  8010c5:	89 de                	mov    %ebx,%esi
+  8010c7:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8010c9:	5b                   	pop    %ebx
+  8010ca:	5e                   	pop    %esi
+  8010cb:	5f                   	pop    %edi
+  8010cc:	5d                   	pop    %ebp
+  8010cd:	c3                   	ret
+
+008010ce <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	57                   	push   %edi
+  8010d2:	56                   	push   %esi
+  8010d3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010df:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010e4:	89 df                	mov    %ebx,%edi
+  8010e6:	89 de                	mov    %ebx,%esi
+  8010e8:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  8010ea:	5b                   	pop    %ebx
+  8010eb:	5e                   	pop    %esi
+  8010ec:	5f                   	pop    %edi
+  8010ed:	5d                   	pop    %ebp
+  8010ee:	c3                   	ret
+
+008010ef <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8010ef:	55                   	push   %ebp
+  8010f0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010fa:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8010fd:	5d                   	pop    %ebp
+  8010fe:	c3                   	ret
+
+008010ff <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8010ff:	55                   	push   %ebp
+  801100:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801102:	8b 45 08             	mov    0x8(%ebp),%eax
+  801105:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80110a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80110f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801114:	5d                   	pop    %ebp
+  801115:	c3                   	ret
+
+00801116 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801116:	55                   	push   %ebp
+  801117:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801119:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80111e:	eb 02                	jmp    801122 <fd_alloc+0xc>
+  801120:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801122:	89 c2                	mov    %eax,%edx
+  801124:	c1 ea 16             	shr    $0x16,%edx
+  801127:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80112e:	f6 c2 01             	test   $0x1,%dl
+  801131:	74 2b                	je     80115e <fd_alloc+0x48>
+  801133:	89 c2                	mov    %eax,%edx
+  801135:	c1 ea 0c             	shr    $0xc,%edx
+  801138:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80113f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801145:	f6 c1 01             	test   $0x1,%cl
+  801148:	74 14                	je     80115e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80114a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801150:	75 ce                	jne    801120 <fd_alloc+0xa>
+  801152:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801157:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80115c:	eb 05                	jmp    801163 <fd_alloc+0x4d>
+			return 0;
+  80115e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801163:	8b 55 08             	mov    0x8(%ebp),%edx
+  801166:	89 02                	mov    %eax,(%edx)
+}
+  801168:	89 c8                	mov    %ecx,%eax
+  80116a:	5d                   	pop    %ebp
+  80116b:	c3                   	ret
+
+0080116c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80116c:	55                   	push   %ebp
+  80116d:	89 e5                	mov    %esp,%ebp
+  80116f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801172:	83 f8 1f             	cmp    $0x1f,%eax
+  801175:	77 30                	ja     8011a7 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801177:	c1 e0 0c             	shl    $0xc,%eax
+  80117a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80117f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801185:	f6 c2 01             	test   $0x1,%dl
+  801188:	74 24                	je     8011ae <fd_lookup+0x42>
+  80118a:	89 c2                	mov    %eax,%edx
+  80118c:	c1 ea 0c             	shr    $0xc,%edx
+  80118f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801196:	f6 c2 01             	test   $0x1,%dl
+  801199:	74 1a                	je     8011b5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80119b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80119e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a5:	5d                   	pop    %ebp
+  8011a6:	c3                   	ret
+		return -E_INVAL;
+  8011a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ac:	eb f7                	jmp    8011a5 <fd_lookup+0x39>
+		return -E_INVAL;
+  8011ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011b3:	eb f0                	jmp    8011a5 <fd_lookup+0x39>
+  8011b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ba:	eb e9                	jmp    8011a5 <fd_lookup+0x39>
+
+008011bc <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	53                   	push   %ebx
+  8011c0:	83 ec 04             	sub    $0x4,%esp
+  8011c3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011cb:	eb 03                	jmp    8011d0 <dev_lookup+0x14>
+  8011cd:	83 c0 01             	add    $0x1,%eax
+  8011d0:	8b 1c 85 a8 32 80 00 	mov    0x8032a8(,%eax,4),%ebx
+  8011d7:	85 db                	test   %ebx,%ebx
+  8011d9:	74 0b                	je     8011e6 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8011db:	39 13                	cmp    %edx,(%ebx)
+  8011dd:	75 ee                	jne    8011cd <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8011df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e4:	eb 1f                	jmp    801205 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8011e6:	a1 08 50 80 00       	mov    0x805008,%eax
+  8011eb:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8011ee:	83 ec 04             	sub    $0x4,%esp
+  8011f1:	52                   	push   %edx
+  8011f2:	50                   	push   %eax
+  8011f3:	68 2c 32 80 00       	push   $0x80322c
+  8011f8:	e8 72 f0 ff ff       	call   80026f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8011fd:	83 c4 10             	add    $0x10,%esp
+  801200:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801205:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801208:	89 1a                	mov    %ebx,(%edx)
+}
+  80120a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80120d:	c9                   	leave
+  80120e:	c3                   	ret
+
+0080120f <fd_close>:
+{
+  80120f:	55                   	push   %ebp
+  801210:	89 e5                	mov    %esp,%ebp
+  801212:	57                   	push   %edi
+  801213:	56                   	push   %esi
+  801214:	53                   	push   %ebx
+  801215:	83 ec 24             	sub    $0x24,%esp
+  801218:	8b 75 08             	mov    0x8(%ebp),%esi
+  80121b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80121e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801221:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801222:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801228:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80122b:	50                   	push   %eax
+  80122c:	e8 3b ff ff ff       	call   80116c <fd_lookup>
+  801231:	89 c3                	mov    %eax,%ebx
+  801233:	83 c4 10             	add    $0x10,%esp
+  801236:	85 c0                	test   %eax,%eax
+  801238:	78 05                	js     80123f <fd_close+0x30>
+	    || fd != fd2)
+  80123a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80123d:	74 16                	je     801255 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80123f:	89 f8                	mov    %edi,%eax
+  801241:	84 c0                	test   %al,%al
+  801243:	b8 00 00 00 00       	mov    $0x0,%eax
+  801248:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80124b:	89 d8                	mov    %ebx,%eax
+  80124d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801250:	5b                   	pop    %ebx
+  801251:	5e                   	pop    %esi
+  801252:	5f                   	pop    %edi
+  801253:	5d                   	pop    %ebp
+  801254:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801255:	83 ec 08             	sub    $0x8,%esp
+  801258:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80125b:	50                   	push   %eax
+  80125c:	ff 36                	push   (%esi)
+  80125e:	e8 59 ff ff ff       	call   8011bc <dev_lookup>
+  801263:	89 c3                	mov    %eax,%ebx
+  801265:	83 c4 10             	add    $0x10,%esp
+  801268:	85 c0                	test   %eax,%eax
+  80126a:	78 1a                	js     801286 <fd_close+0x77>
+		if (dev->dev_close)
+  80126c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80126f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801272:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801277:	85 c0                	test   %eax,%eax
+  801279:	74 0b                	je     801286 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80127b:	83 ec 0c             	sub    $0xc,%esp
+  80127e:	56                   	push   %esi
+  80127f:	ff d0                	call   *%eax
+  801281:	89 c3                	mov    %eax,%ebx
+  801283:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801286:	83 ec 08             	sub    $0x8,%esp
+  801289:	56                   	push   %esi
+  80128a:	6a 00                	push   $0x0
+  80128c:	e8 01 fb ff ff       	call   800d92 <sys_page_unmap>
+	return r;
+  801291:	83 c4 10             	add    $0x10,%esp
+  801294:	eb b5                	jmp    80124b <fd_close+0x3c>
+
+00801296 <close>:
+
+int
+close(int fdnum)
+{
+  801296:	55                   	push   %ebp
+  801297:	89 e5                	mov    %esp,%ebp
+  801299:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80129c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80129f:	50                   	push   %eax
+  8012a0:	ff 75 08             	push   0x8(%ebp)
+  8012a3:	e8 c4 fe ff ff       	call   80116c <fd_lookup>
+  8012a8:	83 c4 10             	add    $0x10,%esp
+  8012ab:	85 c0                	test   %eax,%eax
+  8012ad:	79 02                	jns    8012b1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012af:	c9                   	leave
+  8012b0:	c3                   	ret
+		return fd_close(fd, 1);
+  8012b1:	83 ec 08             	sub    $0x8,%esp
+  8012b4:	6a 01                	push   $0x1
+  8012b6:	ff 75 f4             	push   -0xc(%ebp)
+  8012b9:	e8 51 ff ff ff       	call   80120f <fd_close>
+  8012be:	83 c4 10             	add    $0x10,%esp
+  8012c1:	eb ec                	jmp    8012af <close+0x19>
+
+008012c3 <close_all>:
+
+void
+close_all(void)
+{
+  8012c3:	55                   	push   %ebp
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	53                   	push   %ebx
+  8012c7:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8012ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8012cf:	83 ec 0c             	sub    $0xc,%esp
+  8012d2:	53                   	push   %ebx
+  8012d3:	e8 be ff ff ff       	call   801296 <close>
+	for (i = 0; i < MAXFD; i++)
+  8012d8:	83 c3 01             	add    $0x1,%ebx
+  8012db:	83 c4 10             	add    $0x10,%esp
+  8012de:	83 fb 20             	cmp    $0x20,%ebx
+  8012e1:	75 ec                	jne    8012cf <close_all+0xc>
+}
+  8012e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012e6:	c9                   	leave
+  8012e7:	c3                   	ret
+
+008012e8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8012e8:	55                   	push   %ebp
+  8012e9:	89 e5                	mov    %esp,%ebp
+  8012eb:	57                   	push   %edi
+  8012ec:	56                   	push   %esi
+  8012ed:	53                   	push   %ebx
+  8012ee:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8012f1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012f4:	50                   	push   %eax
+  8012f5:	ff 75 08             	push   0x8(%ebp)
+  8012f8:	e8 6f fe ff ff       	call   80116c <fd_lookup>
+  8012fd:	89 c3                	mov    %eax,%ebx
+  8012ff:	83 c4 10             	add    $0x10,%esp
+  801302:	85 c0                	test   %eax,%eax
+  801304:	78 7f                	js     801385 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801306:	83 ec 0c             	sub    $0xc,%esp
+  801309:	ff 75 0c             	push   0xc(%ebp)
+  80130c:	e8 85 ff ff ff       	call   801296 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801311:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801314:	c1 e6 0c             	shl    $0xc,%esi
+  801317:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80131d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801320:	89 3c 24             	mov    %edi,(%esp)
+  801323:	e8 d7 fd ff ff       	call   8010ff <fd2data>
+  801328:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80132a:	89 34 24             	mov    %esi,(%esp)
+  80132d:	e8 cd fd ff ff       	call   8010ff <fd2data>
+  801332:	83 c4 10             	add    $0x10,%esp
+  801335:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801338:	89 d8                	mov    %ebx,%eax
+  80133a:	c1 e8 16             	shr    $0x16,%eax
+  80133d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801344:	a8 01                	test   $0x1,%al
+  801346:	74 11                	je     801359 <dup+0x71>
+  801348:	89 d8                	mov    %ebx,%eax
+  80134a:	c1 e8 0c             	shr    $0xc,%eax
+  80134d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801354:	f6 c2 01             	test   $0x1,%dl
+  801357:	75 36                	jne    80138f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801359:	89 f8                	mov    %edi,%eax
+  80135b:	c1 e8 0c             	shr    $0xc,%eax
+  80135e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801365:	83 ec 0c             	sub    $0xc,%esp
+  801368:	25 07 0e 00 00       	and    $0xe07,%eax
+  80136d:	50                   	push   %eax
+  80136e:	56                   	push   %esi
+  80136f:	6a 00                	push   $0x0
+  801371:	57                   	push   %edi
+  801372:	6a 00                	push   $0x0
+  801374:	e8 d7 f9 ff ff       	call   800d50 <sys_page_map>
+  801379:	89 c3                	mov    %eax,%ebx
+  80137b:	83 c4 20             	add    $0x20,%esp
+  80137e:	85 c0                	test   %eax,%eax
+  801380:	78 33                	js     8013b5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801382:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801385:	89 d8                	mov    %ebx,%eax
+  801387:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138a:	5b                   	pop    %ebx
+  80138b:	5e                   	pop    %esi
+  80138c:	5f                   	pop    %edi
+  80138d:	5d                   	pop    %ebp
+  80138e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80138f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801396:	83 ec 0c             	sub    $0xc,%esp
+  801399:	25 07 0e 00 00       	and    $0xe07,%eax
+  80139e:	50                   	push   %eax
+  80139f:	ff 75 d4             	push   -0x2c(%ebp)
+  8013a2:	6a 00                	push   $0x0
+  8013a4:	53                   	push   %ebx
+  8013a5:	6a 00                	push   $0x0
+  8013a7:	e8 a4 f9 ff ff       	call   800d50 <sys_page_map>
+  8013ac:	89 c3                	mov    %eax,%ebx
+  8013ae:	83 c4 20             	add    $0x20,%esp
+  8013b1:	85 c0                	test   %eax,%eax
+  8013b3:	79 a4                	jns    801359 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013b5:	83 ec 08             	sub    $0x8,%esp
+  8013b8:	56                   	push   %esi
+  8013b9:	6a 00                	push   $0x0
+  8013bb:	e8 d2 f9 ff ff       	call   800d92 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8013c0:	83 c4 08             	add    $0x8,%esp
+  8013c3:	ff 75 d4             	push   -0x2c(%ebp)
+  8013c6:	6a 00                	push   $0x0
+  8013c8:	e8 c5 f9 ff ff       	call   800d92 <sys_page_unmap>
+	return r;
+  8013cd:	83 c4 10             	add    $0x10,%esp
+  8013d0:	eb b3                	jmp    801385 <dup+0x9d>
+
+008013d2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013d2:	55                   	push   %ebp
+  8013d3:	89 e5                	mov    %esp,%ebp
+  8013d5:	56                   	push   %esi
+  8013d6:	53                   	push   %ebx
+  8013d7:	83 ec 18             	sub    $0x18,%esp
+  8013da:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013dd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013e0:	50                   	push   %eax
+  8013e1:	56                   	push   %esi
+  8013e2:	e8 85 fd ff ff       	call   80116c <fd_lookup>
+  8013e7:	83 c4 10             	add    $0x10,%esp
+  8013ea:	85 c0                	test   %eax,%eax
+  8013ec:	78 3c                	js     80142a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013ee:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013f1:	83 ec 08             	sub    $0x8,%esp
+  8013f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013f7:	50                   	push   %eax
+  8013f8:	ff 33                	push   (%ebx)
+  8013fa:	e8 bd fd ff ff       	call   8011bc <dev_lookup>
+  8013ff:	83 c4 10             	add    $0x10,%esp
+  801402:	85 c0                	test   %eax,%eax
+  801404:	78 24                	js     80142a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801406:	8b 43 08             	mov    0x8(%ebx),%eax
+  801409:	83 e0 03             	and    $0x3,%eax
+  80140c:	83 f8 01             	cmp    $0x1,%eax
+  80140f:	74 20                	je     801431 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801411:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801414:	8b 40 08             	mov    0x8(%eax),%eax
+  801417:	85 c0                	test   %eax,%eax
+  801419:	74 37                	je     801452 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80141b:	83 ec 04             	sub    $0x4,%esp
+  80141e:	ff 75 10             	push   0x10(%ebp)
+  801421:	ff 75 0c             	push   0xc(%ebp)
+  801424:	53                   	push   %ebx
+  801425:	ff d0                	call   *%eax
+  801427:	83 c4 10             	add    $0x10,%esp
+}
+  80142a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80142d:	5b                   	pop    %ebx
+  80142e:	5e                   	pop    %esi
+  80142f:	5d                   	pop    %ebp
+  801430:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801431:	a1 08 50 80 00       	mov    0x805008,%eax
+  801436:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801439:	83 ec 04             	sub    $0x4,%esp
+  80143c:	56                   	push   %esi
+  80143d:	50                   	push   %eax
+  80143e:	68 6d 32 80 00       	push   $0x80326d
+  801443:	e8 27 ee ff ff       	call   80026f <cprintf>
+		return -E_INVAL;
+  801448:	83 c4 10             	add    $0x10,%esp
+  80144b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801450:	eb d8                	jmp    80142a <read+0x58>
+		return -E_NOT_SUPP;
+  801452:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801457:	eb d1                	jmp    80142a <read+0x58>
+
+00801459 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	57                   	push   %edi
+  80145d:	56                   	push   %esi
+  80145e:	53                   	push   %ebx
+  80145f:	83 ec 0c             	sub    $0xc,%esp
+  801462:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801465:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801468:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146d:	eb 02                	jmp    801471 <readn+0x18>
+  80146f:	01 c3                	add    %eax,%ebx
+  801471:	39 f3                	cmp    %esi,%ebx
+  801473:	73 21                	jae    801496 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801475:	83 ec 04             	sub    $0x4,%esp
+  801478:	89 f0                	mov    %esi,%eax
+  80147a:	29 d8                	sub    %ebx,%eax
+  80147c:	50                   	push   %eax
+  80147d:	89 d8                	mov    %ebx,%eax
+  80147f:	03 45 0c             	add    0xc(%ebp),%eax
+  801482:	50                   	push   %eax
+  801483:	57                   	push   %edi
+  801484:	e8 49 ff ff ff       	call   8013d2 <read>
+		if (m < 0)
+  801489:	83 c4 10             	add    $0x10,%esp
+  80148c:	85 c0                	test   %eax,%eax
+  80148e:	78 04                	js     801494 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801490:	75 dd                	jne    80146f <readn+0x16>
+  801492:	eb 02                	jmp    801496 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801494:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801496:	89 d8                	mov    %ebx,%eax
+  801498:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149b:	5b                   	pop    %ebx
+  80149c:	5e                   	pop    %esi
+  80149d:	5f                   	pop    %edi
+  80149e:	5d                   	pop    %ebp
+  80149f:	c3                   	ret
+
+008014a0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014a0:	55                   	push   %ebp
+  8014a1:	89 e5                	mov    %esp,%ebp
+  8014a3:	56                   	push   %esi
+  8014a4:	53                   	push   %ebx
+  8014a5:	83 ec 18             	sub    $0x18,%esp
+  8014a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014ab:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014ae:	50                   	push   %eax
+  8014af:	53                   	push   %ebx
+  8014b0:	e8 b7 fc ff ff       	call   80116c <fd_lookup>
+  8014b5:	83 c4 10             	add    $0x10,%esp
+  8014b8:	85 c0                	test   %eax,%eax
+  8014ba:	78 37                	js     8014f3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014bc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014bf:	83 ec 08             	sub    $0x8,%esp
+  8014c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c5:	50                   	push   %eax
+  8014c6:	ff 36                	push   (%esi)
+  8014c8:	e8 ef fc ff ff       	call   8011bc <dev_lookup>
+  8014cd:	83 c4 10             	add    $0x10,%esp
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	78 1f                	js     8014f3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014d4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014d8:	74 20                	je     8014fa <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8014da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014dd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	74 37                	je     80151b <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8014e4:	83 ec 04             	sub    $0x4,%esp
+  8014e7:	ff 75 10             	push   0x10(%ebp)
+  8014ea:	ff 75 0c             	push   0xc(%ebp)
+  8014ed:	56                   	push   %esi
+  8014ee:	ff d0                	call   *%eax
+  8014f0:	83 c4 10             	add    $0x10,%esp
+}
+  8014f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014f6:	5b                   	pop    %ebx
+  8014f7:	5e                   	pop    %esi
+  8014f8:	5d                   	pop    %ebp
+  8014f9:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014fa:	a1 08 50 80 00       	mov    0x805008,%eax
+  8014ff:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801502:	83 ec 04             	sub    $0x4,%esp
+  801505:	53                   	push   %ebx
+  801506:	50                   	push   %eax
+  801507:	68 89 32 80 00       	push   $0x803289
+  80150c:	e8 5e ed ff ff       	call   80026f <cprintf>
+		return -E_INVAL;
+  801511:	83 c4 10             	add    $0x10,%esp
+  801514:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801519:	eb d8                	jmp    8014f3 <write+0x53>
+		return -E_NOT_SUPP;
+  80151b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801520:	eb d1                	jmp    8014f3 <write+0x53>
+
+00801522 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801522:	55                   	push   %ebp
+  801523:	89 e5                	mov    %esp,%ebp
+  801525:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801528:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80152b:	50                   	push   %eax
+  80152c:	ff 75 08             	push   0x8(%ebp)
+  80152f:	e8 38 fc ff ff       	call   80116c <fd_lookup>
+  801534:	83 c4 10             	add    $0x10,%esp
+  801537:	85 c0                	test   %eax,%eax
+  801539:	78 0e                	js     801549 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80153b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80153e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801541:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801544:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801549:	c9                   	leave
+  80154a:	c3                   	ret
+
+0080154b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80154b:	55                   	push   %ebp
+  80154c:	89 e5                	mov    %esp,%ebp
+  80154e:	56                   	push   %esi
+  80154f:	53                   	push   %ebx
+  801550:	83 ec 18             	sub    $0x18,%esp
+  801553:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801556:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801559:	50                   	push   %eax
+  80155a:	53                   	push   %ebx
+  80155b:	e8 0c fc ff ff       	call   80116c <fd_lookup>
+  801560:	83 c4 10             	add    $0x10,%esp
+  801563:	85 c0                	test   %eax,%eax
+  801565:	78 34                	js     80159b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801567:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80156a:	83 ec 08             	sub    $0x8,%esp
+  80156d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801570:	50                   	push   %eax
+  801571:	ff 36                	push   (%esi)
+  801573:	e8 44 fc ff ff       	call   8011bc <dev_lookup>
+  801578:	83 c4 10             	add    $0x10,%esp
+  80157b:	85 c0                	test   %eax,%eax
+  80157d:	78 1c                	js     80159b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80157f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801583:	74 1d                	je     8015a2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801585:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801588:	8b 40 18             	mov    0x18(%eax),%eax
+  80158b:	85 c0                	test   %eax,%eax
+  80158d:	74 34                	je     8015c3 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80158f:	83 ec 08             	sub    $0x8,%esp
+  801592:	ff 75 0c             	push   0xc(%ebp)
+  801595:	56                   	push   %esi
+  801596:	ff d0                	call   *%eax
+  801598:	83 c4 10             	add    $0x10,%esp
+}
+  80159b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80159e:	5b                   	pop    %ebx
+  80159f:	5e                   	pop    %esi
+  8015a0:	5d                   	pop    %ebp
+  8015a1:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015a2:	a1 08 50 80 00       	mov    0x805008,%eax
+  8015a7:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015aa:	83 ec 04             	sub    $0x4,%esp
+  8015ad:	53                   	push   %ebx
+  8015ae:	50                   	push   %eax
+  8015af:	68 4c 32 80 00       	push   $0x80324c
+  8015b4:	e8 b6 ec ff ff       	call   80026f <cprintf>
+		return -E_INVAL;
+  8015b9:	83 c4 10             	add    $0x10,%esp
+  8015bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c1:	eb d8                	jmp    80159b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015c3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015c8:	eb d1                	jmp    80159b <ftruncate+0x50>
+
+008015ca <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015ca:	55                   	push   %ebp
+  8015cb:	89 e5                	mov    %esp,%ebp
+  8015cd:	56                   	push   %esi
+  8015ce:	53                   	push   %ebx
+  8015cf:	83 ec 18             	sub    $0x18,%esp
+  8015d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015d5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015d8:	50                   	push   %eax
+  8015d9:	ff 75 08             	push   0x8(%ebp)
+  8015dc:	e8 8b fb ff ff       	call   80116c <fd_lookup>
+  8015e1:	83 c4 10             	add    $0x10,%esp
+  8015e4:	85 c0                	test   %eax,%eax
+  8015e6:	78 49                	js     801631 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015e8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015eb:	83 ec 08             	sub    $0x8,%esp
+  8015ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f1:	50                   	push   %eax
+  8015f2:	ff 36                	push   (%esi)
+  8015f4:	e8 c3 fb ff ff       	call   8011bc <dev_lookup>
+  8015f9:	83 c4 10             	add    $0x10,%esp
+  8015fc:	85 c0                	test   %eax,%eax
+  8015fe:	78 31                	js     801631 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801600:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801603:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801607:	74 2f                	je     801638 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801609:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80160c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801613:	00 00 00 
+	stat->st_isdir = 0;
+  801616:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80161d:	00 00 00 
+	stat->st_dev = dev;
+  801620:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801626:	83 ec 08             	sub    $0x8,%esp
+  801629:	53                   	push   %ebx
+  80162a:	56                   	push   %esi
+  80162b:	ff 50 14             	call   *0x14(%eax)
+  80162e:	83 c4 10             	add    $0x10,%esp
+}
+  801631:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801634:	5b                   	pop    %ebx
+  801635:	5e                   	pop    %esi
+  801636:	5d                   	pop    %ebp
+  801637:	c3                   	ret
+		return -E_NOT_SUPP;
+  801638:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80163d:	eb f2                	jmp    801631 <fstat+0x67>
+
+0080163f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80163f:	55                   	push   %ebp
+  801640:	89 e5                	mov    %esp,%ebp
+  801642:	56                   	push   %esi
+  801643:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801644:	83 ec 08             	sub    $0x8,%esp
+  801647:	6a 00                	push   $0x0
+  801649:	ff 75 08             	push   0x8(%ebp)
+  80164c:	e8 e4 01 00 00       	call   801835 <open>
+  801651:	89 c3                	mov    %eax,%ebx
+  801653:	83 c4 10             	add    $0x10,%esp
+  801656:	85 c0                	test   %eax,%eax
+  801658:	78 1b                	js     801675 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80165a:	83 ec 08             	sub    $0x8,%esp
+  80165d:	ff 75 0c             	push   0xc(%ebp)
+  801660:	50                   	push   %eax
+  801661:	e8 64 ff ff ff       	call   8015ca <fstat>
+  801666:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801668:	89 1c 24             	mov    %ebx,(%esp)
+  80166b:	e8 26 fc ff ff       	call   801296 <close>
+	return r;
+  801670:	83 c4 10             	add    $0x10,%esp
+  801673:	89 f3                	mov    %esi,%ebx
+}
+  801675:	89 d8                	mov    %ebx,%eax
+  801677:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80167a:	5b                   	pop    %ebx
+  80167b:	5e                   	pop    %esi
+  80167c:	5d                   	pop    %ebp
+  80167d:	c3                   	ret
+
+0080167e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80167e:	55                   	push   %ebp
+  80167f:	89 e5                	mov    %esp,%ebp
+  801681:	56                   	push   %esi
+  801682:	53                   	push   %ebx
+  801683:	89 c6                	mov    %eax,%esi
+  801685:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801687:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  80168e:	74 27                	je     8016b7 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801690:	6a 07                	push   $0x7
+  801692:	68 00 60 80 00       	push   $0x806000
+  801697:	56                   	push   %esi
+  801698:	ff 35 00 50 80 00    	push   0x805000
+  80169e:	e8 75 12 00 00       	call   802918 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8016a3:	83 c4 0c             	add    $0xc,%esp
+  8016a6:	6a 00                	push   $0x0
+  8016a8:	53                   	push   %ebx
+  8016a9:	6a 00                	push   $0x0
+  8016ab:	e8 f0 11 00 00       	call   8028a0 <ipc_recv>
+}
+  8016b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016b3:	5b                   	pop    %ebx
+  8016b4:	5e                   	pop    %esi
+  8016b5:	5d                   	pop    %ebp
+  8016b6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016b7:	83 ec 0c             	sub    $0xc,%esp
+  8016ba:	6a 01                	push   $0x1
+  8016bc:	e8 ab 12 00 00       	call   80296c <ipc_find_env>
+  8016c1:	a3 00 50 80 00       	mov    %eax,0x805000
+  8016c6:	83 c4 10             	add    $0x10,%esp
+  8016c9:	eb c5                	jmp    801690 <fsipc+0x12>
+
+008016cb <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8016cb:	55                   	push   %ebp
+  8016cc:	89 e5                	mov    %esp,%ebp
+  8016ce:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8016d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016d4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016d7:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8016dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016df:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8016e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016e9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8016ee:	e8 8b ff ff ff       	call   80167e <fsipc>
+}
+  8016f3:	c9                   	leave
+  8016f4:	c3                   	ret
+
+008016f5 <devfile_flush>:
+{
+  8016f5:	55                   	push   %ebp
+  8016f6:	89 e5                	mov    %esp,%ebp
+  8016f8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8016fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016fe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801701:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801706:	ba 00 00 00 00       	mov    $0x0,%edx
+  80170b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801710:	e8 69 ff ff ff       	call   80167e <fsipc>
+}
+  801715:	c9                   	leave
+  801716:	c3                   	ret
+
+00801717 <devfile_stat>:
+{
+  801717:	55                   	push   %ebp
+  801718:	89 e5                	mov    %esp,%ebp
+  80171a:	53                   	push   %ebx
+  80171b:	83 ec 04             	sub    $0x4,%esp
+  80171e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801721:	8b 45 08             	mov    0x8(%ebp),%eax
+  801724:	8b 40 0c             	mov    0xc(%eax),%eax
+  801727:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80172c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801731:	b8 05 00 00 00       	mov    $0x5,%eax
+  801736:	e8 43 ff ff ff       	call   80167e <fsipc>
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	78 2c                	js     80176b <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80173f:	83 ec 08             	sub    $0x8,%esp
+  801742:	68 00 60 80 00       	push   $0x806000
+  801747:	53                   	push   %ebx
+  801748:	e8 10 f1 ff ff       	call   80085d <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80174d:	a1 80 60 80 00       	mov    0x806080,%eax
+  801752:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801758:	a1 84 60 80 00       	mov    0x806084,%eax
+  80175d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801763:	83 c4 10             	add    $0x10,%esp
+  801766:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80176b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80176e:	c9                   	leave
+  80176f:	c3                   	ret
+
+00801770 <devfile_write>:
+{
+  801770:	55                   	push   %ebp
+  801771:	89 e5                	mov    %esp,%ebp
+  801773:	83 ec 0c             	sub    $0xc,%esp
+  801776:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801779:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80177e:	39 d0                	cmp    %edx,%eax
+  801780:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801783:	8b 55 08             	mov    0x8(%ebp),%edx
+  801786:	8b 52 0c             	mov    0xc(%edx),%edx
+  801789:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  80178f:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801794:	50                   	push   %eax
+  801795:	ff 75 0c             	push   0xc(%ebp)
+  801798:	68 08 60 80 00       	push   $0x806008
+  80179d:	e8 41 f2 ff ff       	call   8009e3 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8017a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017ac:	e8 cd fe ff ff       	call   80167e <fsipc>
+}
+  8017b1:	c9                   	leave
+  8017b2:	c3                   	ret
+
+008017b3 <devfile_read>:
+{
+  8017b3:	55                   	push   %ebp
+  8017b4:	89 e5                	mov    %esp,%ebp
+  8017b6:	56                   	push   %esi
+  8017b7:	53                   	push   %ebx
+  8017b8:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8017bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017be:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017c1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8017c6:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8017cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8017d6:	e8 a3 fe ff ff       	call   80167e <fsipc>
+  8017db:	89 c3                	mov    %eax,%ebx
+  8017dd:	85 c0                	test   %eax,%eax
+  8017df:	78 1f                	js     801800 <devfile_read+0x4d>
+	assert(r <= n);
+  8017e1:	39 c6                	cmp    %eax,%esi
+  8017e3:	72 24                	jb     801809 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8017e5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8017ea:	7f 33                	jg     80181f <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8017ec:	83 ec 04             	sub    $0x4,%esp
+  8017ef:	50                   	push   %eax
+  8017f0:	68 00 60 80 00       	push   $0x806000
+  8017f5:	ff 75 0c             	push   0xc(%ebp)
+  8017f8:	e8 e6 f1 ff ff       	call   8009e3 <memmove>
+	return r;
+  8017fd:	83 c4 10             	add    $0x10,%esp
+}
+  801800:	89 d8                	mov    %ebx,%eax
+  801802:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801805:	5b                   	pop    %ebx
+  801806:	5e                   	pop    %esi
+  801807:	5d                   	pop    %ebp
+  801808:	c3                   	ret
+	assert(r <= n);
+  801809:	68 bc 32 80 00       	push   $0x8032bc
+  80180e:	68 c3 32 80 00       	push   $0x8032c3
+  801813:	6a 7c                	push   $0x7c
+  801815:	68 d8 32 80 00       	push   $0x8032d8
+  80181a:	e8 75 e9 ff ff       	call   800194 <_panic>
+	assert(r <= PGSIZE);
+  80181f:	68 e3 32 80 00       	push   $0x8032e3
+  801824:	68 c3 32 80 00       	push   $0x8032c3
+  801829:	6a 7d                	push   $0x7d
+  80182b:	68 d8 32 80 00       	push   $0x8032d8
+  801830:	e8 5f e9 ff ff       	call   800194 <_panic>
+
+00801835 <open>:
+{
+  801835:	55                   	push   %ebp
+  801836:	89 e5                	mov    %esp,%ebp
+  801838:	56                   	push   %esi
+  801839:	53                   	push   %ebx
+  80183a:	83 ec 1c             	sub    $0x1c,%esp
+  80183d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801840:	56                   	push   %esi
+  801841:	e8 dc ef ff ff       	call   800822 <strlen>
+  801846:	83 c4 10             	add    $0x10,%esp
+  801849:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80184e:	7f 6c                	jg     8018bc <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801850:	83 ec 0c             	sub    $0xc,%esp
+  801853:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801856:	50                   	push   %eax
+  801857:	e8 ba f8 ff ff       	call   801116 <fd_alloc>
+  80185c:	89 c3                	mov    %eax,%ebx
+  80185e:	83 c4 10             	add    $0x10,%esp
+  801861:	85 c0                	test   %eax,%eax
+  801863:	78 3c                	js     8018a1 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801865:	83 ec 08             	sub    $0x8,%esp
+  801868:	56                   	push   %esi
+  801869:	68 00 60 80 00       	push   $0x806000
+  80186e:	e8 ea ef ff ff       	call   80085d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801873:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801876:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80187b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80187e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801883:	e8 f6 fd ff ff       	call   80167e <fsipc>
+  801888:	89 c3                	mov    %eax,%ebx
+  80188a:	83 c4 10             	add    $0x10,%esp
+  80188d:	85 c0                	test   %eax,%eax
+  80188f:	78 19                	js     8018aa <open+0x75>
+	return fd2num(fd);
+  801891:	83 ec 0c             	sub    $0xc,%esp
+  801894:	ff 75 f4             	push   -0xc(%ebp)
+  801897:	e8 53 f8 ff ff       	call   8010ef <fd2num>
+  80189c:	89 c3                	mov    %eax,%ebx
+  80189e:	83 c4 10             	add    $0x10,%esp
+}
+  8018a1:	89 d8                	mov    %ebx,%eax
+  8018a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018a6:	5b                   	pop    %ebx
+  8018a7:	5e                   	pop    %esi
+  8018a8:	5d                   	pop    %ebp
+  8018a9:	c3                   	ret
+		fd_close(fd, 0);
+  8018aa:	83 ec 08             	sub    $0x8,%esp
+  8018ad:	6a 00                	push   $0x0
+  8018af:	ff 75 f4             	push   -0xc(%ebp)
+  8018b2:	e8 58 f9 ff ff       	call   80120f <fd_close>
+		return r;
+  8018b7:	83 c4 10             	add    $0x10,%esp
+  8018ba:	eb e5                	jmp    8018a1 <open+0x6c>
+		return -E_BAD_PATH;
+  8018bc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8018c1:	eb de                	jmp    8018a1 <open+0x6c>
+
+008018c3 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8018c3:	55                   	push   %ebp
+  8018c4:	89 e5                	mov    %esp,%ebp
+  8018c6:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8018c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ce:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018d3:	e8 a6 fd ff ff       	call   80167e <fsipc>
+}
+  8018d8:	c9                   	leave
+  8018d9:	c3                   	ret
+
+008018da <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8018da:	55                   	push   %ebp
+  8018db:	89 e5                	mov    %esp,%ebp
+  8018dd:	57                   	push   %edi
+  8018de:	56                   	push   %esi
+  8018df:	53                   	push   %ebx
+  8018e0:	81 ec 94 02 00 00    	sub    $0x294,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  8018e6:	6a 00                	push   $0x0
+  8018e8:	ff 75 08             	push   0x8(%ebp)
+  8018eb:	e8 45 ff ff ff       	call   801835 <open>
+  8018f0:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  8018f6:	83 c4 10             	add    $0x10,%esp
+  8018f9:	85 c0                	test   %eax,%eax
+  8018fb:	0f 88 d0 05 00 00    	js     801ed1 <spawn+0x5f7>
+  801901:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801903:	83 ec 04             	sub    $0x4,%esp
+  801906:	68 00 02 00 00       	push   $0x200
+  80190b:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801911:	50                   	push   %eax
+  801912:	51                   	push   %ecx
+  801913:	e8 41 fb ff ff       	call   801459 <readn>
+  801918:	83 c4 10             	add    $0x10,%esp
+  80191b:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801920:	75 73                	jne    801995 <spawn+0xbb>
+	    || elf->e_magic != ELF_MAGIC) {
+  801922:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801929:	45 4c 46 
+  80192c:	75 67                	jne    801995 <spawn+0xbb>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80192e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801933:	cd 30                	int    $0x30
+  801935:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  80193b:	85 c0                	test   %eax,%eax
+  80193d:	0f 88 82 05 00 00    	js     801ec5 <spawn+0x5eb>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  801943:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801948:	89 c6                	mov    %eax,%esi
+  80194a:	c1 e6 09             	shl    $0x9,%esi
+  80194d:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801953:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  801959:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80195e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  801960:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  801966:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  80196c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  801971:	be 00 00 00 00       	mov    $0x0,%esi
+  801976:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801979:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	74 4d                	je     8019cd <spawn+0xf3>
+		string_size += strlen(argv[argc]) + 1;
+  801980:	83 ec 0c             	sub    $0xc,%esp
+  801983:	50                   	push   %eax
+  801984:	e8 99 ee ff ff       	call   800822 <strlen>
+  801989:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  80198d:	83 c3 01             	add    $0x1,%ebx
+  801990:	83 c4 10             	add    $0x10,%esp
+  801993:	eb e4                	jmp    801979 <spawn+0x9f>
+		close(fd);
+  801995:	83 ec 0c             	sub    $0xc,%esp
+  801998:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  80199e:	e8 f3 f8 ff ff       	call   801296 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8019a3:	83 c4 0c             	add    $0xc,%esp
+  8019a6:	68 7f 45 4c 46       	push   $0x464c457f
+  8019ab:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8019b1:	68 ef 32 80 00       	push   $0x8032ef
+  8019b6:	e8 b4 e8 ff ff       	call   80026f <cprintf>
+		return -E_NOT_EXEC;
+  8019bb:	83 c4 10             	add    $0x10,%esp
+  8019be:	c7 85 80 fd ff ff f2 	movl   $0xfffffff2,-0x280(%ebp)
+  8019c5:	ff ff ff 
+  8019c8:	e9 04 05 00 00       	jmp    801ed1 <spawn+0x5f7>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  8019cd:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  8019d3:	bf 00 10 40 00       	mov    $0x401000,%edi
+  8019d8:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  8019da:	89 fa                	mov    %edi,%edx
+  8019dc:	83 e2 fc             	and    $0xfffffffc,%edx
+  8019df:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  8019e6:	29 c2                	sub    %eax,%edx
+  8019e8:	89 95 90 fd ff ff    	mov    %edx,-0x270(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  8019ee:	8d 42 f8             	lea    -0x8(%edx),%eax
+  8019f1:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  8019f6:	0f 86 e3 04 00 00    	jbe    801edf <spawn+0x605>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8019fc:	83 ec 04             	sub    $0x4,%esp
+  8019ff:	6a 07                	push   $0x7
+  801a01:	68 00 00 40 00       	push   $0x400000
+  801a06:	6a 00                	push   $0x0
+  801a08:	e8 bd f2 ff ff       	call   800cca <sys_page_alloc>
+  801a0d:	83 c4 10             	add    $0x10,%esp
+  801a10:	85 c0                	test   %eax,%eax
+  801a12:	0f 88 cc 04 00 00    	js     801ee4 <spawn+0x60a>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  801a18:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1d:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  801a23:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a26:	eb 30                	jmp    801a58 <spawn+0x17e>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  801a28:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801a2e:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  801a34:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  801a37:	83 ec 08             	sub    $0x8,%esp
+  801a3a:	ff 34 b3             	push   (%ebx,%esi,4)
+  801a3d:	57                   	push   %edi
+  801a3e:	e8 1a ee ff ff       	call   80085d <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  801a43:	83 c4 04             	add    $0x4,%esp
+  801a46:	ff 34 b3             	push   (%ebx,%esi,4)
+  801a49:	e8 d4 ed ff ff       	call   800822 <strlen>
+  801a4e:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  801a52:	83 c6 01             	add    $0x1,%esi
+  801a55:	83 c4 10             	add    $0x10,%esp
+  801a58:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  801a5e:	7f c8                	jg     801a28 <spawn+0x14e>
+	}
+	argv_store[argc] = 0;
+  801a60:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  801a66:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  801a6c:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801a73:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  801a79:	0f 85 81 00 00 00    	jne    801b00 <spawn+0x226>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  801a7f:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  801a85:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  801a8b:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  801a8e:	89 c8                	mov    %ecx,%eax
+  801a90:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  801a96:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  801a99:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  801a9e:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  801aa4:	83 ec 0c             	sub    $0xc,%esp
+  801aa7:	6a 07                	push   $0x7
+  801aa9:	68 00 d0 bf ee       	push   $0xeebfd000
+  801aae:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801ab4:	68 00 00 40 00       	push   $0x400000
+  801ab9:	6a 00                	push   $0x0
+  801abb:	e8 90 f2 ff ff       	call   800d50 <sys_page_map>
+  801ac0:	89 c3                	mov    %eax,%ebx
+  801ac2:	83 c4 20             	add    $0x20,%esp
+  801ac5:	85 c0                	test   %eax,%eax
+  801ac7:	0f 88 1f 04 00 00    	js     801eec <spawn+0x612>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801acd:	83 ec 08             	sub    $0x8,%esp
+  801ad0:	68 00 00 40 00       	push   $0x400000
+  801ad5:	6a 00                	push   $0x0
+  801ad7:	e8 b6 f2 ff ff       	call   800d92 <sys_page_unmap>
+  801adc:	89 c3                	mov    %eax,%ebx
+  801ade:	83 c4 10             	add    $0x10,%esp
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	0f 88 03 04 00 00    	js     801eec <spawn+0x612>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  801ae9:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  801aef:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801af6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801afb:	e9 87 01 00 00       	jmp    801c87 <spawn+0x3ad>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801b00:	68 60 33 80 00       	push   $0x803360
+  801b05:	68 c3 32 80 00       	push   $0x8032c3
+  801b0a:	68 f1 00 00 00       	push   $0xf1
+  801b0f:	68 09 33 80 00       	push   $0x803309
+  801b14:	e8 7b e6 ff ff       	call   800194 <_panic>
+	}
+
+	// from file, as many pages at a time as fit below PFTEMP
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+		for (j = 0; j < n; j += r)
+  801b19:	01 c6                	add    %eax,%esi
+  801b1b:	39 f3                	cmp    %esi,%ebx
+  801b1d:	7e 4c                	jle    801b6b <spawn+0x291>
+			if ((r = sys_page_alloc_range(0, UTEMP + j * PGSIZE, n - j, PTE_P|PTE_U|PTE_W)) < 0)
+  801b1f:	6a 07                	push   $0x7
+  801b21:	89 d8                	mov    %ebx,%eax
+  801b23:	29 f0                	sub    %esi,%eax
+  801b25:	50                   	push   %eax
+  801b26:	89 f0                	mov    %esi,%eax
+  801b28:	c1 e0 0c             	shl    $0xc,%eax
+  801b2b:	05 00 00 40 00       	add    $0x400000,%eax
+  801b30:	50                   	push   %eax
+  801b31:	6a 00                	push   $0x0
+  801b33:	e8 9c f2 ff ff       	call   800dd4 <sys_page_alloc_range>
+  801b38:	83 c4 10             	add    $0x10,%esp
+  801b3b:	85 c0                	test   %eax,%eax
+  801b3d:	79 da                	jns    801b19 <spawn+0x23f>
+  801b3f:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  801b41:	83 ec 0c             	sub    $0xc,%esp
+  801b44:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801b4a:	e8 9b f0 ff ff       	call   800bea <sys_env_destroy>
+	close(fd);
+  801b4f:	83 c4 04             	add    $0x4,%esp
+  801b52:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  801b58:	e8 39 f7 ff ff       	call   801296 <close>
+	return r;
+  801b5d:	83 c4 10             	add    $0x10,%esp
+  801b60:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  801b66:	e9 66 03 00 00       	jmp    801ed1 <spawn+0x5f7>
+				return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  801b6b:	83 ec 08             	sub    $0x8,%esp
+  801b6e:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  801b74:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  801b7a:	01 c8                	add    %ecx,%eax
+  801b7c:	50                   	push   %eax
+  801b7d:	8b b5 80 fd ff ff    	mov    -0x280(%ebp),%esi
+  801b83:	56                   	push   %esi
+  801b84:	e8 99 f9 ff ff       	call   801522 <seek>
+  801b89:	83 c4 10             	add    $0x10,%esp
+  801b8c:	85 c0                	test   %eax,%eax
+  801b8e:	0f 88 cd 01 00 00    	js     801d61 <spawn+0x487>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  801b94:	89 d8                	mov    %ebx,%eax
+  801b96:	c1 e0 0c             	shl    $0xc,%eax
+  801b99:	89 85 74 fd ff ff    	mov    %eax,-0x28c(%ebp)
+  801b9f:	83 ec 04             	sub    $0x4,%esp
+  801ba2:	39 f8                	cmp    %edi,%eax
+  801ba4:	0f 46 f8             	cmovbe %eax,%edi
+  801ba7:	57                   	push   %edi
+  801ba8:	68 00 00 40 00       	push   $0x400000
+  801bad:	56                   	push   %esi
+  801bae:	e8 a6 f8 ff ff       	call   801459 <readn>
+  801bb3:	83 c4 10             	add    $0x10,%esp
+  801bb6:	85 c0                	test   %eax,%eax
+  801bb8:	0f 88 aa 01 00 00    	js     801d68 <spawn+0x48e>
+			return r;
+		for (j = 0; j < n; j += r)
+  801bbe:	be 00 00 00 00       	mov    $0x0,%esi
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  801bc3:	8b bd 84 fd ff ff    	mov    -0x27c(%ebp),%edi
+  801bc9:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  801bcf:	01 c7                	add    %eax,%edi
+		for (j = 0; j < n; j += r)
+  801bd1:	39 f3                	cmp    %esi,%ebx
+  801bd3:	7e 4a                	jle    801c1f <spawn+0x345>
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  801bd5:	89 f0                	mov    %esi,%eax
+  801bd7:	c1 e0 0c             	shl    $0xc,%eax
+  801bda:	83 ec 08             	sub    $0x8,%esp
+  801bdd:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  801be3:	89 da                	mov    %ebx,%edx
+  801be5:	29 f2                	sub    %esi,%edx
+  801be7:	52                   	push   %edx
+  801be8:	8d 14 07             	lea    (%edi,%eax,1),%edx
+  801beb:	52                   	push   %edx
+  801bec:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801bf2:	05 00 00 40 00       	add    $0x400000,%eax
+  801bf7:	50                   	push   %eax
+  801bf8:	6a 00                	push   $0x0
+  801bfa:	e8 f8 f1 ff ff       	call   800df7 <sys_page_map_range>
+  801bff:	83 c4 20             	add    $0x20,%esp
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	78 04                	js     801c0a <spawn+0x330>
+		for (j = 0; j < n; j += r)
+  801c06:	01 c6                	add    %eax,%esi
+  801c08:	eb c7                	jmp    801bd1 <spawn+0x2f7>
+				panic("spawn: sys_page_map_range data: %e", r);
+  801c0a:	50                   	push   %eax
+  801c0b:	68 88 33 80 00       	push   $0x803388
+  801c10:	68 22 01 00 00       	push   $0x122
+  801c15:	68 09 33 80 00       	push   $0x803309
+  801c1a:	e8 75 e5 ff ff       	call   800194 <_panic>
+		sys_page_unmap_range(0, UTEMP, n);
+  801c1f:	83 ec 04             	sub    $0x4,%esp
+  801c22:	53                   	push   %ebx
+  801c23:	68 00 00 40 00       	push   $0x400000
+  801c28:	6a 00                	push   $0x0
+  801c2a:	e8 4d f2 ff ff       	call   800e7c <sys_page_unmap_range>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  801c2f:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  801c35:	01 8d 8c fd ff ff    	add    %ecx,-0x274(%ebp)
+  801c3b:	83 c4 10             	add    $0x10,%esp
+  801c3e:	e9 c4 00 00 00       	jmp    801d07 <spawn+0x42d>
+	}
+
+	// the rest is zero-filled on demand
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  801c43:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  801c49:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  801c4f:	8b 9d 6c fd ff ff    	mov    -0x294(%ebp),%ebx
+  801c55:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  801c5b:	39 c8                	cmp    %ecx,%eax
+  801c5d:	73 22                	jae    801c81 <spawn+0x3a7>
+  801c5f:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  801c65:	29 c1                	sub    %eax,%ecx
+  801c67:	51                   	push   %ecx
+  801c68:	01 d0                	add    %edx,%eax
+  801c6a:	50                   	push   %eax
+  801c6b:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801c71:	e8 c2 f1 ff ff       	call   800e38 <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  801c76:	83 c4 10             	add    $0x10,%esp
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	0f 88 d1 00 00 00    	js     801d52 <spawn+0x478>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801c81:	83 c3 01             	add    $0x1,%ebx
+  801c84:	83 c6 20             	add    $0x20,%esi
+  801c87:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  801c8e:	39 d8                	cmp    %ebx,%eax
+  801c90:	0f 8e d9 00 00 00    	jle    801d6f <spawn+0x495>
+		if (ph->p_type != ELF_PROG_LOAD)
+  801c96:	83 3e 01             	cmpl   $0x1,(%esi)
+  801c99:	75 e6                	jne    801c81 <spawn+0x3a7>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  801c9b:	8b 46 18             	mov    0x18(%esi),%eax
+  801c9e:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  801ca1:	83 f8 01             	cmp    $0x1,%eax
+  801ca4:	19 c0                	sbb    %eax,%eax
+  801ca6:	83 e0 fe             	and    $0xfffffffe,%eax
+  801ca9:	83 c0 07             	add    $0x7,%eax
+  801cac:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  801cb2:	8b 7e 04             	mov    0x4(%esi),%edi
+  801cb5:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  801cbb:	8b 46 10             	mov    0x10(%esi),%eax
+  801cbe:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  801cc4:	8b 4e 14             	mov    0x14(%esi),%ecx
+  801cc7:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  801cca:	89 d0                	mov    %edx,%eax
+  801ccc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801cd1:	74 12                	je     801ce5 <spawn+0x40b>
+		va -= i;
+  801cd3:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  801cd5:	01 c1                	add    %eax,%ecx
+		filesz += i;
+  801cd7:	01 85 88 fd ff ff    	add    %eax,-0x278(%ebp)
+		fileoffset -= i;
+  801cdd:	29 c7                	sub    %eax,%edi
+  801cdf:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  801ce5:	c7 85 8c fd ff ff 00 	movl   $0x0,-0x274(%ebp)
+  801cec:	00 00 00 
+  801cef:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  801cf5:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  801cfb:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  801d01:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  801d07:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  801d0d:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  801d13:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  801d19:	39 c8                	cmp    %ecx,%eax
+  801d1b:	0f 83 22 ff ff ff    	jae    801c43 <spawn+0x369>
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+  801d21:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  801d27:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  801d2d:	29 c7                	sub    %eax,%edi
+  801d2f:	8d 9f ff 0f 00 00    	lea    0xfff(%edi),%ebx
+  801d35:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  801d3b:	b8 00 f0 3f 00       	mov    $0x3ff000,%eax
+  801d40:	39 c3                	cmp    %eax,%ebx
+  801d42:	0f 47 d8             	cmova  %eax,%ebx
+  801d45:	c1 eb 0c             	shr    $0xc,%ebx
+		for (j = 0; j < n; j += r)
+  801d48:	be 00 00 00 00       	mov    $0x0,%esi
+  801d4d:	e9 c9 fd ff ff       	jmp    801b1b <spawn+0x241>
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  801d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d57:	89 d7                	mov    %edx,%edi
+  801d59:	0f 4e f8             	cmovle %eax,%edi
+  801d5c:	e9 e0 fd ff ff       	jmp    801b41 <spawn+0x267>
+  801d61:	89 c7                	mov    %eax,%edi
+  801d63:	e9 d9 fd ff ff       	jmp    801b41 <spawn+0x267>
+  801d68:	89 c7                	mov    %eax,%edi
+  801d6a:	e9 d2 fd ff ff       	jmp    801b41 <spawn+0x267>
+	close(fd);
+  801d6f:	83 ec 0c             	sub    $0xc,%esp
+  801d72:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  801d78:	e8 19 f5 ff ff       	call   801296 <close>
+  801d7d:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	uint32_t pn, n;
+	void *va;
+	int perm, r;
+
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  801d80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d85:	e9 82 00 00 00       	jmp    801e0c <spawn+0x532>
+		// in one go.
+		perm = uvpt[pn] & PTE_SYSCALL;
+		while (pn + n < PGNUM(UTOP)
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+			n++;
+  801d8a:	83 c6 01             	add    $0x1,%esi
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  801d8d:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  801d92:	74 2e                	je     801dc2 <spawn+0x4e8>
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+  801d94:	89 c2                	mov    %eax,%edx
+  801d96:	c1 e2 0c             	shl    $0xc,%edx
+  801d99:	c1 ea 16             	shr    $0x16,%edx
+  801d9c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801da3:	81 e2 81 00 00 00    	and    $0x81,%edx
+  801da9:	83 fa 01             	cmp    $0x1,%edx
+  801dac:	75 14                	jne    801dc2 <spawn+0x4e8>
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  801dae:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801db5:	83 c0 01             	add    $0x1,%eax
+  801db8:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  801dbe:	39 d7                	cmp    %edx,%edi
+  801dc0:	74 c8                	je     801d8a <spawn+0x4b0>
+		if ((r = sys_page_map_range(0, va, child, va, n, perm)) != n)
+  801dc2:	83 ec 08             	sub    $0x8,%esp
+  801dc5:	57                   	push   %edi
+  801dc6:	56                   	push   %esi
+  801dc7:	51                   	push   %ecx
+  801dc8:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801dce:	51                   	push   %ecx
+  801dcf:	6a 00                	push   $0x0
+  801dd1:	e8 21 f0 ff ff       	call   800df7 <sys_page_map_range>
+  801dd6:	89 c2                	mov    %eax,%edx
+  801dd8:	83 c4 20             	add    $0x20,%esp
+  801ddb:	39 c6                	cmp    %eax,%esi
+  801ddd:	74 23                	je     801e02 <spawn+0x528>
+			panic("sys_page_map_range: %e", r < 0 ? r : -E_NO_MEM);
+  801ddf:	85 c0                	test   %eax,%eax
+  801de1:	78 05                	js     801de8 <spawn+0x50e>
+  801de3:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  801de8:	50                   	push   %eax
+  801de9:	68 15 33 80 00       	push   $0x803315
+  801dee:	68 47 01 00 00       	push   $0x147
+  801df3:	68 09 33 80 00       	push   $0x803309
+  801df8:	e8 97 e3 ff ff       	call   800194 <_panic>
+		n = 1;
+  801dfd:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  801e02:	01 d3                	add    %edx,%ebx
+  801e04:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801e0a:	77 4e                	ja     801e5a <spawn+0x580>
+		va = (void *) (pn << PGSHIFT);
+  801e0c:	89 d9                	mov    %ebx,%ecx
+  801e0e:	c1 e1 0c             	shl    $0xc,%ecx
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  801e11:	89 c8                	mov    %ecx,%eax
+  801e13:	c1 e8 16             	shr    $0x16,%eax
+  801e16:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e1d:	25 81 00 00 00       	and    $0x81,%eax
+  801e22:	83 f8 01             	cmp    $0x1,%eax
+  801e25:	75 d6                	jne    801dfd <spawn+0x523>
+		if (!(uvpt[pn] & PTE_P))
+  801e27:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  801e2e:	83 e2 01             	and    $0x1,%edx
+  801e31:	74 23                	je     801e56 <spawn+0x57c>
+		if (!(uvpt[pn] & PTE_SHARE))
+  801e33:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801e3a:	f6 c4 04             	test   $0x4,%ah
+  801e3d:	74 c3                	je     801e02 <spawn+0x528>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  801e3f:	8b 3c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edi
+  801e46:	81 e7 07 0e 00 00    	and    $0xe07,%edi
+		while (pn + n < PGNUM(UTOP)
+  801e4c:	8d 43 01             	lea    0x1(%ebx),%eax
+		n = 1;
+  801e4f:	89 d6                	mov    %edx,%esi
+		while (pn + n < PGNUM(UTOP)
+  801e51:	e9 37 ff ff ff       	jmp    801d8d <spawn+0x4b3>
+		n = 1;
+  801e56:	89 c2                	mov    %eax,%edx
+  801e58:	eb a8                	jmp    801e02 <spawn+0x528>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  801e5a:	83 ec 08             	sub    $0x8,%esp
+  801e5d:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  801e63:	50                   	push   %eax
+  801e64:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801e6a:	e8 14 f1 ff ff       	call   800f83 <sys_env_set_trapframe>
+  801e6f:	83 c4 10             	add    $0x10,%esp
+  801e72:	85 c0                	test   %eax,%eax
+  801e74:	78 25                	js     801e9b <spawn+0x5c1>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  801e76:	83 ec 08             	sub    $0x8,%esp
+  801e79:	6a 02                	push   $0x2
+  801e7b:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801e81:	e8 18 f0 ff ff       	call   800e9e <sys_env_set_status>
+  801e86:	83 c4 10             	add    $0x10,%esp
+  801e89:	85 c0                	test   %eax,%eax
+  801e8b:	78 23                	js     801eb0 <spawn+0x5d6>
+	return child;
+  801e8d:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801e93:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  801e99:	eb 36                	jmp    801ed1 <spawn+0x5f7>
+		panic("sys_env_set_trapframe: %e", r);
+  801e9b:	50                   	push   %eax
+  801e9c:	68 2c 33 80 00       	push   $0x80332c
+  801ea1:	68 85 00 00 00       	push   $0x85
+  801ea6:	68 09 33 80 00       	push   $0x803309
+  801eab:	e8 e4 e2 ff ff       	call   800194 <_panic>
+		panic("sys_env_set_status: %e", r);
+  801eb0:	50                   	push   %eax
+  801eb1:	68 46 33 80 00       	push   $0x803346
+  801eb6:	68 88 00 00 00       	push   $0x88
+  801ebb:	68 09 33 80 00       	push   $0x803309
+  801ec0:	e8 cf e2 ff ff       	call   800194 <_panic>
+		return r;
+  801ec5:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801ecb:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+}
+  801ed1:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  801ed7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eda:	5b                   	pop    %ebx
+  801edb:	5e                   	pop    %esi
+  801edc:	5f                   	pop    %edi
+  801edd:	5d                   	pop    %ebp
+  801ede:	c3                   	ret
+		return -E_NO_MEM;
+  801edf:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  801ee4:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  801eea:	eb e5                	jmp    801ed1 <spawn+0x5f7>
+	sys_page_unmap(0, UTEMP);
+  801eec:	83 ec 08             	sub    $0x8,%esp
+  801eef:	68 00 00 40 00       	push   $0x400000
+  801ef4:	6a 00                	push   $0x0
+  801ef6:	e8 97 ee ff ff       	call   800d92 <sys_page_unmap>
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  801f04:	eb cb                	jmp    801ed1 <spawn+0x5f7>
+
+00801f06 <spawnl>:
+{
+  801f06:	55                   	push   %ebp
+  801f07:	89 e5                	mov    %esp,%ebp
+  801f09:	56                   	push   %esi
+  801f0a:	53                   	push   %ebx
+	va_start(vl, arg0);
+  801f0b:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  801f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  801f13:	eb 05                	jmp    801f1a <spawnl+0x14>
+		argc++;
+  801f15:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  801f18:	89 ca                	mov    %ecx,%edx
+  801f1a:	8d 4a 04             	lea    0x4(%edx),%ecx
+  801f1d:	83 3a 00             	cmpl   $0x0,(%edx)
+  801f20:	75 f3                	jne    801f15 <spawnl+0xf>
+	const char *argv[argc+2];
+  801f22:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  801f29:	83 e2 f0             	and    $0xfffffff0,%edx
+  801f2c:	29 d4                	sub    %edx,%esp
+  801f2e:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  801f32:	89 da                	mov    %ebx,%edx
+  801f34:	c1 ea 02             	shr    $0x2,%edx
+  801f37:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  801f3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f3d:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  801f44:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  801f4b:	00 
+	va_start(vl, arg0);
+  801f4c:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  801f4f:	89 c2                	mov    %eax,%edx
+  801f51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f56:	eb 0b                	jmp    801f63 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  801f58:	83 c0 01             	add    $0x1,%eax
+  801f5b:	8b 31                	mov    (%ecx),%esi
+  801f5d:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  801f60:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  801f63:	39 d0                	cmp    %edx,%eax
+  801f65:	75 f1                	jne    801f58 <spawnl+0x52>
+	return spawn(prog, argv);
+  801f67:	83 ec 08             	sub    $0x8,%esp
+  801f6a:	53                   	push   %ebx
+  801f6b:	ff 75 08             	push   0x8(%ebp)
+  801f6e:	e8 67 f9 ff ff       	call   8018da <spawn>
+}
+  801f73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f76:	5b                   	pop    %ebx
+  801f77:	5e                   	pop    %esi
+  801f78:	5d                   	pop    %ebp
+  801f79:	c3                   	ret
+
+00801f7a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f7a:	55                   	push   %ebp
+  801f7b:	89 e5                	mov    %esp,%ebp
+  801f7d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801f80:	68 ab 33 80 00       	push   $0x8033ab
+  801f85:	ff 75 0c             	push   0xc(%ebp)
+  801f88:	e8 d0 e8 ff ff       	call   80085d <strcpy>
+	return 0;
+}
+  801f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f92:	c9                   	leave
+  801f93:	c3                   	ret
+
+00801f94 <devsock_close>:
+{
+  801f94:	55                   	push   %ebp
+  801f95:	89 e5                	mov    %esp,%ebp
+  801f97:	53                   	push   %ebx
+  801f98:	83 ec 10             	sub    $0x10,%esp
+  801f9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801f9e:	53                   	push   %ebx
+  801f9f:	e8 d8 09 00 00       	call   80297c <pageref>
+  801fa4:	89 c2                	mov    %eax,%edx
+  801fa6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801fae:	83 fa 01             	cmp    $0x1,%edx
+  801fb1:	74 05                	je     801fb8 <devsock_close+0x24>
+}
+  801fb3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb6:	c9                   	leave
+  801fb7:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801fb8:	83 ec 0c             	sub    $0xc,%esp
+  801fbb:	ff 73 0c             	push   0xc(%ebx)
+  801fbe:	e8 b7 02 00 00       	call   80227a <nsipc_close>
+  801fc3:	83 c4 10             	add    $0x10,%esp
+  801fc6:	eb eb                	jmp    801fb3 <devsock_close+0x1f>
+
+00801fc8 <devsock_write>:
+{
+  801fc8:	55                   	push   %ebp
+  801fc9:	89 e5                	mov    %esp,%ebp
+  801fcb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801fce:	6a 00                	push   $0x0
+  801fd0:	ff 75 10             	push   0x10(%ebp)
+  801fd3:	ff 75 0c             	push   0xc(%ebp)
+  801fd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd9:	ff 70 0c             	push   0xc(%eax)
+  801fdc:	e8 79 03 00 00       	call   80235a <nsipc_send>
+}
+  801fe1:	c9                   	leave
+  801fe2:	c3                   	ret
+
+00801fe3 <devsock_read>:
+{
+  801fe3:	55                   	push   %ebp
+  801fe4:	89 e5                	mov    %esp,%ebp
+  801fe6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801fe9:	6a 00                	push   $0x0
+  801feb:	ff 75 10             	push   0x10(%ebp)
+  801fee:	ff 75 0c             	push   0xc(%ebp)
+  801ff1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff4:	ff 70 0c             	push   0xc(%eax)
+  801ff7:	e8 ef 02 00 00       	call   8022eb <nsipc_recv>
+}
+  801ffc:	c9                   	leave
+  801ffd:	c3                   	ret
+
+00801ffe <fd2sockid>:
+{
+  801ffe:	55                   	push   %ebp
+  801fff:	89 e5                	mov    %esp,%ebp
+  802001:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802004:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802007:	52                   	push   %edx
+  802008:	50                   	push   %eax
+  802009:	e8 5e f1 ff ff       	call   80116c <fd_lookup>
+  80200e:	83 c4 10             	add    $0x10,%esp
+  802011:	85 c0                	test   %eax,%eax
+  802013:	78 10                	js     802025 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802015:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802018:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80201e:	39 08                	cmp    %ecx,(%eax)
+  802020:	75 05                	jne    802027 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802022:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802025:	c9                   	leave
+  802026:	c3                   	ret
+		return -E_NOT_SUPP;
+  802027:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80202c:	eb f7                	jmp    802025 <fd2sockid+0x27>
+
+0080202e <alloc_sockfd>:
+{
+  80202e:	55                   	push   %ebp
+  80202f:	89 e5                	mov    %esp,%ebp
+  802031:	56                   	push   %esi
+  802032:	53                   	push   %ebx
+  802033:	83 ec 1c             	sub    $0x1c,%esp
+  802036:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802038:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80203b:	50                   	push   %eax
+  80203c:	e8 d5 f0 ff ff       	call   801116 <fd_alloc>
+  802041:	89 c3                	mov    %eax,%ebx
+  802043:	83 c4 10             	add    $0x10,%esp
+  802046:	85 c0                	test   %eax,%eax
+  802048:	78 43                	js     80208d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80204a:	83 ec 04             	sub    $0x4,%esp
+  80204d:	68 07 04 00 00       	push   $0x407
+  802052:	ff 75 f4             	push   -0xc(%ebp)
+  802055:	6a 00                	push   $0x0
+  802057:	e8 6e ec ff ff       	call   800cca <sys_page_alloc>
+  80205c:	89 c3                	mov    %eax,%ebx
+  80205e:	83 c4 10             	add    $0x10,%esp
+  802061:	85 c0                	test   %eax,%eax
+  802063:	78 28                	js     80208d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802065:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802068:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80206e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802070:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802073:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80207a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80207d:	83 ec 0c             	sub    $0xc,%esp
+  802080:	50                   	push   %eax
+  802081:	e8 69 f0 ff ff       	call   8010ef <fd2num>
+  802086:	89 c3                	mov    %eax,%ebx
+  802088:	83 c4 10             	add    $0x10,%esp
+  80208b:	eb 0c                	jmp    802099 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80208d:	83 ec 0c             	sub    $0xc,%esp
+  802090:	56                   	push   %esi
+  802091:	e8 e4 01 00 00       	call   80227a <nsipc_close>
+		return r;
+  802096:	83 c4 10             	add    $0x10,%esp
+}
+  802099:	89 d8                	mov    %ebx,%eax
+  80209b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80209e:	5b                   	pop    %ebx
+  80209f:	5e                   	pop    %esi
+  8020a0:	5d                   	pop    %ebp
+  8020a1:	c3                   	ret
+
+008020a2 <accept>:
+{
+  8020a2:	55                   	push   %ebp
+  8020a3:	89 e5                	mov    %esp,%ebp
+  8020a5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8020a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ab:	e8 4e ff ff ff       	call   801ffe <fd2sockid>
+  8020b0:	85 c0                	test   %eax,%eax
+  8020b2:	78 1b                	js     8020cf <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8020b4:	83 ec 04             	sub    $0x4,%esp
+  8020b7:	ff 75 10             	push   0x10(%ebp)
+  8020ba:	ff 75 0c             	push   0xc(%ebp)
+  8020bd:	50                   	push   %eax
+  8020be:	e8 0e 01 00 00       	call   8021d1 <nsipc_accept>
+  8020c3:	83 c4 10             	add    $0x10,%esp
+  8020c6:	85 c0                	test   %eax,%eax
+  8020c8:	78 05                	js     8020cf <accept+0x2d>
+	return alloc_sockfd(r);
+  8020ca:	e8 5f ff ff ff       	call   80202e <alloc_sockfd>
+}
+  8020cf:	c9                   	leave
+  8020d0:	c3                   	ret
+
+008020d1 <bind>:
+{
+  8020d1:	55                   	push   %ebp
+  8020d2:	89 e5                	mov    %esp,%ebp
+  8020d4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8020d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020da:	e8 1f ff ff ff       	call   801ffe <fd2sockid>
+  8020df:	85 c0                	test   %eax,%eax
+  8020e1:	78 12                	js     8020f5 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8020e3:	83 ec 04             	sub    $0x4,%esp
+  8020e6:	ff 75 10             	push   0x10(%ebp)
+  8020e9:	ff 75 0c             	push   0xc(%ebp)
+  8020ec:	50                   	push   %eax
+  8020ed:	e8 31 01 00 00       	call   802223 <nsipc_bind>
+  8020f2:	83 c4 10             	add    $0x10,%esp
+}
+  8020f5:	c9                   	leave
+  8020f6:	c3                   	ret
+
+008020f7 <shutdown>:
+{
+  8020f7:	55                   	push   %ebp
+  8020f8:	89 e5                	mov    %esp,%ebp
+  8020fa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8020fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802100:	e8 f9 fe ff ff       	call   801ffe <fd2sockid>
+  802105:	85 c0                	test   %eax,%eax
+  802107:	78 0f                	js     802118 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802109:	83 ec 08             	sub    $0x8,%esp
+  80210c:	ff 75 0c             	push   0xc(%ebp)
+  80210f:	50                   	push   %eax
+  802110:	e8 43 01 00 00       	call   802258 <nsipc_shutdown>
+  802115:	83 c4 10             	add    $0x10,%esp
+}
+  802118:	c9                   	leave
+  802119:	c3                   	ret
+
+0080211a <connect>:
+{
+  80211a:	55                   	push   %ebp
+  80211b:	89 e5                	mov    %esp,%ebp
+  80211d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802120:	8b 45 08             	mov    0x8(%ebp),%eax
+  802123:	e8 d6 fe ff ff       	call   801ffe <fd2sockid>
+  802128:	85 c0                	test   %eax,%eax
+  80212a:	78 12                	js     80213e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80212c:	83 ec 04             	sub    $0x4,%esp
+  80212f:	ff 75 10             	push   0x10(%ebp)
+  802132:	ff 75 0c             	push   0xc(%ebp)
+  802135:	50                   	push   %eax
+  802136:	e8 59 01 00 00       	call   802294 <nsipc_connect>
+  80213b:	83 c4 10             	add    $0x10,%esp
+}
+  80213e:	c9                   	leave
+  80213f:	c3                   	ret
+
+00802140 <listen>:
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802146:	8b 45 08             	mov    0x8(%ebp),%eax
+  802149:	e8 b0 fe ff ff       	call   801ffe <fd2sockid>
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	78 0f                	js     802161 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802152:	83 ec 08             	sub    $0x8,%esp
+  802155:	ff 75 0c             	push   0xc(%ebp)
+  802158:	50                   	push   %eax
+  802159:	e8 6b 01 00 00       	call   8022c9 <nsipc_listen>
+  80215e:	83 c4 10             	add    $0x10,%esp
+}
+  802161:	c9                   	leave
+  802162:	c3                   	ret
+
+00802163 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802163:	55                   	push   %ebp
+  802164:	89 e5                	mov    %esp,%ebp
+  802166:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802169:	ff 75 10             	push   0x10(%ebp)
+  80216c:	ff 75 0c             	push   0xc(%ebp)
+  80216f:	ff 75 08             	push   0x8(%ebp)
+  802172:	e8 41 02 00 00       	call   8023b8 <nsipc_socket>
+  802177:	83 c4 10             	add    $0x10,%esp
+  80217a:	85 c0                	test   %eax,%eax
+  80217c:	78 05                	js     802183 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80217e:	e8 ab fe ff ff       	call   80202e <alloc_sockfd>
+}
+  802183:	c9                   	leave
+  802184:	c3                   	ret
+
+00802185 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802185:	55                   	push   %ebp
+  802186:	89 e5                	mov    %esp,%ebp
+  802188:	53                   	push   %ebx
+  802189:	83 ec 04             	sub    $0x4,%esp
+  80218c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80218e:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802195:	74 26                	je     8021bd <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802197:	6a 07                	push   $0x7
+  802199:	68 00 70 80 00       	push   $0x807000
+  80219e:	53                   	push   %ebx
+  80219f:	ff 35 04 50 80 00    	push   0x805004
+  8021a5:	e8 6e 07 00 00       	call   802918 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8021aa:	83 c4 0c             	add    $0xc,%esp
+  8021ad:	6a 00                	push   $0x0
+  8021af:	6a 00                	push   $0x0
+  8021b1:	6a 00                	push   $0x0
+  8021b3:	e8 e8 06 00 00       	call   8028a0 <ipc_recv>
+}
+  8021b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021bb:	c9                   	leave
+  8021bc:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8021bd:	83 ec 0c             	sub    $0xc,%esp
+  8021c0:	6a 02                	push   $0x2
+  8021c2:	e8 a5 07 00 00       	call   80296c <ipc_find_env>
+  8021c7:	a3 04 50 80 00       	mov    %eax,0x805004
+  8021cc:	83 c4 10             	add    $0x10,%esp
+  8021cf:	eb c6                	jmp    802197 <nsipc+0x12>
+
+008021d1 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8021d1:	55                   	push   %ebp
+  8021d2:	89 e5                	mov    %esp,%ebp
+  8021d4:	56                   	push   %esi
+  8021d5:	53                   	push   %ebx
+  8021d6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8021d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021dc:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8021e1:	8b 06                	mov    (%esi),%eax
+  8021e3:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8021e8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021ed:	e8 93 ff ff ff       	call   802185 <nsipc>
+  8021f2:	89 c3                	mov    %eax,%ebx
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	79 09                	jns    802201 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8021f8:	89 d8                	mov    %ebx,%eax
+  8021fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021fd:	5b                   	pop    %ebx
+  8021fe:	5e                   	pop    %esi
+  8021ff:	5d                   	pop    %ebp
+  802200:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802201:	83 ec 04             	sub    $0x4,%esp
+  802204:	ff 35 10 70 80 00    	push   0x807010
+  80220a:	68 00 70 80 00       	push   $0x807000
+  80220f:	ff 75 0c             	push   0xc(%ebp)
+  802212:	e8 cc e7 ff ff       	call   8009e3 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802217:	a1 10 70 80 00       	mov    0x807010,%eax
+  80221c:	89 06                	mov    %eax,(%esi)
+  80221e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802221:	eb d5                	jmp    8021f8 <nsipc_accept+0x27>
+
+00802223 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802223:	55                   	push   %ebp
+  802224:	89 e5                	mov    %esp,%ebp
+  802226:	53                   	push   %ebx
+  802227:	83 ec 08             	sub    $0x8,%esp
+  80222a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80222d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802230:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802235:	53                   	push   %ebx
+  802236:	ff 75 0c             	push   0xc(%ebp)
+  802239:	68 04 70 80 00       	push   $0x807004
+  80223e:	e8 a0 e7 ff ff       	call   8009e3 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802243:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802249:	b8 02 00 00 00       	mov    $0x2,%eax
+  80224e:	e8 32 ff ff ff       	call   802185 <nsipc>
+}
+  802253:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802256:	c9                   	leave
+  802257:	c3                   	ret
+
+00802258 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802258:	55                   	push   %ebp
+  802259:	89 e5                	mov    %esp,%ebp
+  80225b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80225e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802261:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802266:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802269:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80226e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802273:	e8 0d ff ff ff       	call   802185 <nsipc>
+}
+  802278:	c9                   	leave
+  802279:	c3                   	ret
+
+0080227a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80227a:	55                   	push   %ebp
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802280:	8b 45 08             	mov    0x8(%ebp),%eax
+  802283:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802288:	b8 04 00 00 00       	mov    $0x4,%eax
+  80228d:	e8 f3 fe ff ff       	call   802185 <nsipc>
+}
+  802292:	c9                   	leave
+  802293:	c3                   	ret
+
+00802294 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802294:	55                   	push   %ebp
+  802295:	89 e5                	mov    %esp,%ebp
+  802297:	53                   	push   %ebx
+  802298:	83 ec 08             	sub    $0x8,%esp
+  80229b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80229e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a1:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8022a6:	53                   	push   %ebx
+  8022a7:	ff 75 0c             	push   0xc(%ebp)
+  8022aa:	68 04 70 80 00       	push   $0x807004
+  8022af:	e8 2f e7 ff ff       	call   8009e3 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8022b4:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8022ba:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022bf:	e8 c1 fe ff ff       	call   802185 <nsipc>
+}
+  8022c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c7:	c9                   	leave
+  8022c8:	c3                   	ret
+
+008022c9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8022c9:	55                   	push   %ebp
+  8022ca:	89 e5                	mov    %esp,%ebp
+  8022cc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8022cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8022d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022da:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8022df:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022e4:	e8 9c fe ff ff       	call   802185 <nsipc>
+}
+  8022e9:	c9                   	leave
+  8022ea:	c3                   	ret
+
+008022eb <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8022eb:	55                   	push   %ebp
+  8022ec:	89 e5                	mov    %esp,%ebp
+  8022ee:	56                   	push   %esi
+  8022ef:	53                   	push   %ebx
+  8022f0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8022f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8022fb:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802301:	8b 45 14             	mov    0x14(%ebp),%eax
+  802304:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802309:	b8 07 00 00 00       	mov    $0x7,%eax
+  80230e:	e8 72 fe ff ff       	call   802185 <nsipc>
+  802313:	89 c3                	mov    %eax,%ebx
+  802315:	85 c0                	test   %eax,%eax
+  802317:	78 22                	js     80233b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802319:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80231e:	39 c6                	cmp    %eax,%esi
+  802320:	0f 4e c6             	cmovle %esi,%eax
+  802323:	39 c3                	cmp    %eax,%ebx
+  802325:	7f 1d                	jg     802344 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802327:	83 ec 04             	sub    $0x4,%esp
+  80232a:	53                   	push   %ebx
+  80232b:	68 00 70 80 00       	push   $0x807000
+  802330:	ff 75 0c             	push   0xc(%ebp)
+  802333:	e8 ab e6 ff ff       	call   8009e3 <memmove>
+  802338:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80233b:	89 d8                	mov    %ebx,%eax
+  80233d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802340:	5b                   	pop    %ebx
+  802341:	5e                   	pop    %esi
+  802342:	5d                   	pop    %ebp
+  802343:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802344:	68 b7 33 80 00       	push   $0x8033b7
+  802349:	68 c3 32 80 00       	push   $0x8032c3
+  80234e:	6a 62                	push   $0x62
+  802350:	68 cc 33 80 00       	push   $0x8033cc
+  802355:	e8 3a de ff ff       	call   800194 <_panic>
+
+0080235a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80235a:	55                   	push   %ebp
+  80235b:	89 e5                	mov    %esp,%ebp
+  80235d:	53                   	push   %ebx
+  80235e:	83 ec 04             	sub    $0x4,%esp
+  802361:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802364:	8b 45 08             	mov    0x8(%ebp),%eax
+  802367:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80236c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802372:	7f 2e                	jg     8023a2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802374:	83 ec 04             	sub    $0x4,%esp
+  802377:	53                   	push   %ebx
+  802378:	ff 75 0c             	push   0xc(%ebp)
+  80237b:	68 0c 70 80 00       	push   $0x80700c
+  802380:	e8 5e e6 ff ff       	call   8009e3 <memmove>
+	nsipcbuf.send.req_size = size;
+  802385:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80238b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80238e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802393:	b8 08 00 00 00       	mov    $0x8,%eax
+  802398:	e8 e8 fd ff ff       	call   802185 <nsipc>
+}
+  80239d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023a0:	c9                   	leave
+  8023a1:	c3                   	ret
+	assert(size < 1600);
+  8023a2:	68 d8 33 80 00       	push   $0x8033d8
+  8023a7:	68 c3 32 80 00       	push   $0x8032c3
+  8023ac:	6a 6d                	push   $0x6d
+  8023ae:	68 cc 33 80 00       	push   $0x8033cc
+  8023b3:	e8 dc dd ff ff       	call   800194 <_panic>
+
+008023b8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8023b8:	55                   	push   %ebp
+  8023b9:	89 e5                	mov    %esp,%ebp
+  8023bb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8023be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  8023c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023c9:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8023ce:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023d1:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8023d6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8023db:	e8 a5 fd ff ff       	call   802185 <nsipc>
+}
+  8023e0:	c9                   	leave
+  8023e1:	c3                   	ret
+
+008023e2 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023e2:	55                   	push   %ebp
+  8023e3:	89 e5                	mov    %esp,%ebp
+  8023e5:	56                   	push   %esi
+  8023e6:	53                   	push   %ebx
+  8023e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023ea:	83 ec 0c             	sub    $0xc,%esp
+  8023ed:	ff 75 08             	push   0x8(%ebp)
+  8023f0:	e8 0a ed ff ff       	call   8010ff <fd2data>
+  8023f5:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023f7:	83 c4 08             	add    $0x8,%esp
+  8023fa:	68 e4 33 80 00       	push   $0x8033e4
+  8023ff:	53                   	push   %ebx
+  802400:	e8 58 e4 ff ff       	call   80085d <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802405:	8b 46 04             	mov    0x4(%esi),%eax
+  802408:	2b 06                	sub    (%esi),%eax
+  80240a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802410:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802417:	00 00 00 
+	stat->st_dev = &devpipe;
+  80241a:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802421:	40 80 00 
+	return 0;
+}
+  802424:	b8 00 00 00 00       	mov    $0x0,%eax
+  802429:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80242c:	5b                   	pop    %ebx
+  80242d:	5e                   	pop    %esi
+  80242e:	5d                   	pop    %ebp
+  80242f:	c3                   	ret
+
+00802430 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802430:	55                   	push   %ebp
+  802431:	89 e5                	mov    %esp,%ebp
+  802433:	53                   	push   %ebx
+  802434:	83 ec 0c             	sub    $0xc,%esp
+  802437:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80243a:	53                   	push   %ebx
+  80243b:	6a 00                	push   $0x0
+  80243d:	e8 50 e9 ff ff       	call   800d92 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802442:	89 1c 24             	mov    %ebx,(%esp)
+  802445:	e8 b5 ec ff ff       	call   8010ff <fd2data>
+  80244a:	83 c4 08             	add    $0x8,%esp
+  80244d:	50                   	push   %eax
+  80244e:	6a 00                	push   $0x0
+  802450:	e8 3d e9 ff ff       	call   800d92 <sys_page_unmap>
+}
+  802455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802458:	c9                   	leave
+  802459:	c3                   	ret
+
+0080245a <_pipeisclosed>:
+{
+  80245a:	55                   	push   %ebp
+  80245b:	89 e5                	mov    %esp,%ebp
+  80245d:	57                   	push   %edi
+  80245e:	56                   	push   %esi
+  80245f:	53                   	push   %ebx
+  802460:	83 ec 1c             	sub    $0x1c,%esp
+  802463:	89 c7                	mov    %eax,%edi
+  802465:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802467:	a1 08 50 80 00       	mov    0x805008,%eax
+  80246c:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80246f:	83 ec 0c             	sub    $0xc,%esp
+  802472:	57                   	push   %edi
+  802473:	e8 04 05 00 00       	call   80297c <pageref>
+  802478:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80247b:	89 34 24             	mov    %esi,(%esp)
+  80247e:	e8 f9 04 00 00       	call   80297c <pageref>
+		nn = thisenv->env_runs;
+  802483:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802489:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  80248c:	83 c4 10             	add    $0x10,%esp
+  80248f:	39 cb                	cmp    %ecx,%ebx
+  802491:	74 1b                	je     8024ae <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802493:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802496:	75 cf                	jne    802467 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802498:	8b 42 5c             	mov    0x5c(%edx),%eax
+  80249b:	6a 01                	push   $0x1
+  80249d:	50                   	push   %eax
+  80249e:	53                   	push   %ebx
+  80249f:	68 eb 33 80 00       	push   $0x8033eb
+  8024a4:	e8 c6 dd ff ff       	call   80026f <cprintf>
+  8024a9:	83 c4 10             	add    $0x10,%esp
+  8024ac:	eb b9                	jmp    802467 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8024ae:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024b1:	0f 94 c0             	sete   %al
+  8024b4:	0f b6 c0             	movzbl %al,%eax
+}
+  8024b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ba:	5b                   	pop    %ebx
+  8024bb:	5e                   	pop    %esi
+  8024bc:	5f                   	pop    %edi
+  8024bd:	5d                   	pop    %ebp
+  8024be:	c3                   	ret
+
+008024bf <devpipe_write>:
+{
+  8024bf:	55                   	push   %ebp
+  8024c0:	89 e5                	mov    %esp,%ebp
+  8024c2:	57                   	push   %edi
+  8024c3:	56                   	push   %esi
+  8024c4:	53                   	push   %ebx
+  8024c5:	83 ec 28             	sub    $0x28,%esp
+  8024c8:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8024cb:	56                   	push   %esi
+  8024cc:	e8 2e ec ff ff       	call   8010ff <fd2data>
+  8024d1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8024d3:	83 c4 10             	add    $0x10,%esp
+  8024d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024db:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8024de:	75 09                	jne    8024e9 <devpipe_write+0x2a>
+	return i;
+  8024e0:	89 f8                	mov    %edi,%eax
+  8024e2:	eb 23                	jmp    802507 <devpipe_write+0x48>
+			sys_yield();
+  8024e4:	e8 61 e7 ff ff       	call   800c4a <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8024e9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8024ec:	8b 0b                	mov    (%ebx),%ecx
+  8024ee:	8d 51 20             	lea    0x20(%ecx),%edx
+  8024f1:	39 d0                	cmp    %edx,%eax
+  8024f3:	72 1a                	jb     80250f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8024f5:	89 da                	mov    %ebx,%edx
+  8024f7:	89 f0                	mov    %esi,%eax
+  8024f9:	e8 5c ff ff ff       	call   80245a <_pipeisclosed>
+  8024fe:	85 c0                	test   %eax,%eax
+  802500:	74 e2                	je     8024e4 <devpipe_write+0x25>
+				return 0;
+  802502:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802507:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80250a:	5b                   	pop    %ebx
+  80250b:	5e                   	pop    %esi
+  80250c:	5f                   	pop    %edi
+  80250d:	5d                   	pop    %ebp
+  80250e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80250f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802512:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802516:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802519:	89 c2                	mov    %eax,%edx
+  80251b:	c1 fa 1f             	sar    $0x1f,%edx
+  80251e:	89 d1                	mov    %edx,%ecx
+  802520:	c1 e9 1b             	shr    $0x1b,%ecx
+  802523:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802526:	83 e2 1f             	and    $0x1f,%edx
+  802529:	29 ca                	sub    %ecx,%edx
+  80252b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80252f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802533:	83 c0 01             	add    $0x1,%eax
+  802536:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802539:	83 c7 01             	add    $0x1,%edi
+  80253c:	eb 9d                	jmp    8024db <devpipe_write+0x1c>
+
+0080253e <devpipe_read>:
+{
+  80253e:	55                   	push   %ebp
+  80253f:	89 e5                	mov    %esp,%ebp
+  802541:	57                   	push   %edi
+  802542:	56                   	push   %esi
+  802543:	53                   	push   %ebx
+  802544:	83 ec 18             	sub    $0x18,%esp
+  802547:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80254a:	57                   	push   %edi
+  80254b:	e8 af eb ff ff       	call   8010ff <fd2data>
+  802550:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802552:	83 c4 10             	add    $0x10,%esp
+  802555:	be 00 00 00 00       	mov    $0x0,%esi
+  80255a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80255d:	75 13                	jne    802572 <devpipe_read+0x34>
+	return i;
+  80255f:	89 f0                	mov    %esi,%eax
+  802561:	eb 02                	jmp    802565 <devpipe_read+0x27>
+				return i;
+  802563:	89 f0                	mov    %esi,%eax
+}
+  802565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802568:	5b                   	pop    %ebx
+  802569:	5e                   	pop    %esi
+  80256a:	5f                   	pop    %edi
+  80256b:	5d                   	pop    %ebp
+  80256c:	c3                   	ret
+			sys_yield();
+  80256d:	e8 d8 e6 ff ff       	call   800c4a <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802572:	8b 03                	mov    (%ebx),%eax
+  802574:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802577:	75 18                	jne    802591 <devpipe_read+0x53>
+			if (i > 0)
+  802579:	85 f6                	test   %esi,%esi
+  80257b:	75 e6                	jne    802563 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80257d:	89 da                	mov    %ebx,%edx
+  80257f:	89 f8                	mov    %edi,%eax
+  802581:	e8 d4 fe ff ff       	call   80245a <_pipeisclosed>
+  802586:	85 c0                	test   %eax,%eax
+  802588:	74 e3                	je     80256d <devpipe_read+0x2f>
+				return 0;
+  80258a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80258f:	eb d4                	jmp    802565 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802591:	99                   	cltd
+  802592:	c1 ea 1b             	shr    $0x1b,%edx
+  802595:	01 d0                	add    %edx,%eax
+  802597:	83 e0 1f             	and    $0x1f,%eax
+  80259a:	29 d0                	sub    %edx,%eax
+  80259c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8025a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025a4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8025a7:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8025aa:	83 c6 01             	add    $0x1,%esi
+  8025ad:	eb ab                	jmp    80255a <devpipe_read+0x1c>
+
+008025af <pipe>:
+{
+  8025af:	55                   	push   %ebp
+  8025b0:	89 e5                	mov    %esp,%ebp
+  8025b2:	56                   	push   %esi
+  8025b3:	53                   	push   %ebx
+  8025b4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8025b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025ba:	50                   	push   %eax
+  8025bb:	e8 56 eb ff ff       	call   801116 <fd_alloc>
+  8025c0:	89 c3                	mov    %eax,%ebx
+  8025c2:	83 c4 10             	add    $0x10,%esp
+  8025c5:	85 c0                	test   %eax,%eax
+  8025c7:	0f 88 23 01 00 00    	js     8026f0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025cd:	83 ec 04             	sub    $0x4,%esp
+  8025d0:	68 07 04 00 00       	push   $0x407
+  8025d5:	ff 75 f4             	push   -0xc(%ebp)
+  8025d8:	6a 00                	push   $0x0
+  8025da:	e8 eb e6 ff ff       	call   800cca <sys_page_alloc>
+  8025df:	89 c3                	mov    %eax,%ebx
+  8025e1:	83 c4 10             	add    $0x10,%esp
+  8025e4:	85 c0                	test   %eax,%eax
+  8025e6:	0f 88 04 01 00 00    	js     8026f0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8025ec:	83 ec 0c             	sub    $0xc,%esp
+  8025ef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025f2:	50                   	push   %eax
+  8025f3:	e8 1e eb ff ff       	call   801116 <fd_alloc>
+  8025f8:	89 c3                	mov    %eax,%ebx
+  8025fa:	83 c4 10             	add    $0x10,%esp
+  8025fd:	85 c0                	test   %eax,%eax
+  8025ff:	0f 88 db 00 00 00    	js     8026e0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802605:	83 ec 04             	sub    $0x4,%esp
+  802608:	68 07 04 00 00       	push   $0x407
+  80260d:	ff 75 f0             	push   -0x10(%ebp)
+  802610:	6a 00                	push   $0x0
+  802612:	e8 b3 e6 ff ff       	call   800cca <sys_page_alloc>
+  802617:	89 c3                	mov    %eax,%ebx
+  802619:	83 c4 10             	add    $0x10,%esp
+  80261c:	85 c0                	test   %eax,%eax
+  80261e:	0f 88 bc 00 00 00    	js     8026e0 <pipe+0x131>
+	va = fd2data(fd0);
+  802624:	83 ec 0c             	sub    $0xc,%esp
+  802627:	ff 75 f4             	push   -0xc(%ebp)
+  80262a:	e8 d0 ea ff ff       	call   8010ff <fd2data>
+  80262f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802631:	83 c4 0c             	add    $0xc,%esp
+  802634:	68 07 04 00 00       	push   $0x407
+  802639:	50                   	push   %eax
+  80263a:	6a 00                	push   $0x0
+  80263c:	e8 89 e6 ff ff       	call   800cca <sys_page_alloc>
+  802641:	89 c3                	mov    %eax,%ebx
+  802643:	83 c4 10             	add    $0x10,%esp
+  802646:	85 c0                	test   %eax,%eax
+  802648:	0f 88 82 00 00 00    	js     8026d0 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80264e:	83 ec 0c             	sub    $0xc,%esp
+  802651:	ff 75 f0             	push   -0x10(%ebp)
+  802654:	e8 a6 ea ff ff       	call   8010ff <fd2data>
+  802659:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802660:	50                   	push   %eax
+  802661:	6a 00                	push   $0x0
+  802663:	56                   	push   %esi
+  802664:	6a 00                	push   $0x0
+  802666:	e8 e5 e6 ff ff       	call   800d50 <sys_page_map>
+  80266b:	89 c3                	mov    %eax,%ebx
+  80266d:	83 c4 20             	add    $0x20,%esp
+  802670:	85 c0                	test   %eax,%eax
+  802672:	78 4e                	js     8026c2 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802674:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802679:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80267c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80267e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802681:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802688:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80268b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80268d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802690:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802697:	83 ec 0c             	sub    $0xc,%esp
+  80269a:	ff 75 f4             	push   -0xc(%ebp)
+  80269d:	e8 4d ea ff ff       	call   8010ef <fd2num>
+  8026a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026a5:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8026a7:	83 c4 04             	add    $0x4,%esp
+  8026aa:	ff 75 f0             	push   -0x10(%ebp)
+  8026ad:	e8 3d ea ff ff       	call   8010ef <fd2num>
+  8026b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026b5:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8026b8:	83 c4 10             	add    $0x10,%esp
+  8026bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026c0:	eb 2e                	jmp    8026f0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8026c2:	83 ec 08             	sub    $0x8,%esp
+  8026c5:	56                   	push   %esi
+  8026c6:	6a 00                	push   $0x0
+  8026c8:	e8 c5 e6 ff ff       	call   800d92 <sys_page_unmap>
+  8026cd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8026d0:	83 ec 08             	sub    $0x8,%esp
+  8026d3:	ff 75 f0             	push   -0x10(%ebp)
+  8026d6:	6a 00                	push   $0x0
+  8026d8:	e8 b5 e6 ff ff       	call   800d92 <sys_page_unmap>
+  8026dd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8026e0:	83 ec 08             	sub    $0x8,%esp
+  8026e3:	ff 75 f4             	push   -0xc(%ebp)
+  8026e6:	6a 00                	push   $0x0
+  8026e8:	e8 a5 e6 ff ff       	call   800d92 <sys_page_unmap>
+  8026ed:	83 c4 10             	add    $0x10,%esp
+}
+  8026f0:	89 d8                	mov    %ebx,%eax
+  8026f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026f5:	5b                   	pop    %ebx
+  8026f6:	5e                   	pop    %esi
+  8026f7:	5d                   	pop    %ebp
+  8026f8:	c3                   	ret
+
+008026f9 <pipeisclosed>:
+{
+  8026f9:	55                   	push   %ebp
+  8026fa:	89 e5                	mov    %esp,%ebp
+  8026fc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802702:	50                   	push   %eax
+  802703:	ff 75 08             	push   0x8(%ebp)
+  802706:	e8 61 ea ff ff       	call   80116c <fd_lookup>
+  80270b:	83 c4 10             	add    $0x10,%esp
+  80270e:	85 c0                	test   %eax,%eax
+  802710:	78 18                	js     80272a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802712:	83 ec 0c             	sub    $0xc,%esp
+  802715:	ff 75 f4             	push   -0xc(%ebp)
+  802718:	e8 e2 e9 ff ff       	call   8010ff <fd2data>
+  80271d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80271f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802722:	e8 33 fd ff ff       	call   80245a <_pipeisclosed>
+  802727:	83 c4 10             	add    $0x10,%esp
+}
+  80272a:	c9                   	leave
+  80272b:	c3                   	ret
+
+0080272c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80272c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802731:	c3                   	ret
+
+00802732 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802732:	55                   	push   %ebp
+  802733:	89 e5                	mov    %esp,%ebp
+  802735:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802738:	68 03 34 80 00       	push   $0x803403
+  80273d:	ff 75 0c             	push   0xc(%ebp)
+  802740:	e8 18 e1 ff ff       	call   80085d <strcpy>
+	return 0;
+}
+  802745:	b8 00 00 00 00       	mov    $0x0,%eax
+  80274a:	c9                   	leave
+  80274b:	c3                   	ret
+
+0080274c <devcons_write>:
+{
+  80274c:	55                   	push   %ebp
+  80274d:	89 e5                	mov    %esp,%ebp
+  80274f:	57                   	push   %edi
+  802750:	56                   	push   %esi
+  802751:	53                   	push   %ebx
+  802752:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802758:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80275d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802763:	eb 2e                	jmp    802793 <devcons_write+0x47>
+		m = n - tot;
+  802765:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802768:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80276a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80276f:	39 c3                	cmp    %eax,%ebx
+  802771:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802774:	83 ec 04             	sub    $0x4,%esp
+  802777:	53                   	push   %ebx
+  802778:	89 f0                	mov    %esi,%eax
+  80277a:	03 45 0c             	add    0xc(%ebp),%eax
+  80277d:	50                   	push   %eax
+  80277e:	57                   	push   %edi
+  80277f:	e8 5f e2 ff ff       	call   8009e3 <memmove>
+		sys_cputs(buf, m);
+  802784:	83 c4 08             	add    $0x8,%esp
+  802787:	53                   	push   %ebx
+  802788:	57                   	push   %edi
+  802789:	e8 ff e3 ff ff       	call   800b8d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80278e:	01 de                	add    %ebx,%esi
+  802790:	83 c4 10             	add    $0x10,%esp
+  802793:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802796:	72 cd                	jb     802765 <devcons_write+0x19>
+}
+  802798:	89 f0                	mov    %esi,%eax
+  80279a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80279d:	5b                   	pop    %ebx
+  80279e:	5e                   	pop    %esi
+  80279f:	5f                   	pop    %edi
+  8027a0:	5d                   	pop    %ebp
+  8027a1:	c3                   	ret
+
+008027a2 <devcons_read>:
+{
+  8027a2:	55                   	push   %ebp
+  8027a3:	89 e5                	mov    %esp,%ebp
+  8027a5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8027a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ad:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8027b1:	75 07                	jne    8027ba <devcons_read+0x18>
+  8027b3:	eb 1f                	jmp    8027d4 <devcons_read+0x32>
+		sys_yield();
+  8027b5:	e8 90 e4 ff ff       	call   800c4a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8027ba:	e8 ec e3 ff ff       	call   800bab <sys_cgetc>
+  8027bf:	85 c0                	test   %eax,%eax
+  8027c1:	74 f2                	je     8027b5 <devcons_read+0x13>
+	if (c < 0)
+  8027c3:	78 0f                	js     8027d4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8027c5:	83 f8 04             	cmp    $0x4,%eax
+  8027c8:	74 0c                	je     8027d6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8027ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027cd:	88 02                	mov    %al,(%edx)
+	return 1;
+  8027cf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8027d4:	c9                   	leave
+  8027d5:	c3                   	ret
+		return 0;
+  8027d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027db:	eb f7                	jmp    8027d4 <devcons_read+0x32>
+
+008027dd <cputchar>:
+{
+  8027dd:	55                   	push   %ebp
+  8027de:	89 e5                	mov    %esp,%ebp
+  8027e0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8027e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8027e9:	6a 01                	push   $0x1
+  8027eb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8027ee:	50                   	push   %eax
+  8027ef:	e8 99 e3 ff ff       	call   800b8d <sys_cputs>
+}
+  8027f4:	83 c4 10             	add    $0x10,%esp
+  8027f7:	c9                   	leave
+  8027f8:	c3                   	ret
+
+008027f9 <getchar>:
+{
+  8027f9:	55                   	push   %ebp
+  8027fa:	89 e5                	mov    %esp,%ebp
+  8027fc:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8027ff:	6a 01                	push   $0x1
+  802801:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802804:	50                   	push   %eax
+  802805:	6a 00                	push   $0x0
+  802807:	e8 c6 eb ff ff       	call   8013d2 <read>
+	if (r < 0)
+  80280c:	83 c4 10             	add    $0x10,%esp
+  80280f:	85 c0                	test   %eax,%eax
+  802811:	78 06                	js     802819 <getchar+0x20>
+	if (r < 1)
+  802813:	74 06                	je     80281b <getchar+0x22>
+	return c;
+  802815:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802819:	c9                   	leave
+  80281a:	c3                   	ret
+		return -E_EOF;
+  80281b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802820:	eb f7                	jmp    802819 <getchar+0x20>
+
+00802822 <iscons>:
+{
+  802822:	55                   	push   %ebp
+  802823:	89 e5                	mov    %esp,%ebp
+  802825:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802828:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80282b:	50                   	push   %eax
+  80282c:	ff 75 08             	push   0x8(%ebp)
+  80282f:	e8 38 e9 ff ff       	call   80116c <fd_lookup>
+  802834:	83 c4 10             	add    $0x10,%esp
+  802837:	85 c0                	test   %eax,%eax
+  802839:	78 11                	js     80284c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80283b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80283e:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802844:	39 10                	cmp    %edx,(%eax)
+  802846:	0f 94 c0             	sete   %al
+  802849:	0f b6 c0             	movzbl %al,%eax
+}
+  80284c:	c9                   	leave
+  80284d:	c3                   	ret
+
+0080284e <opencons>:
+{
+  80284e:	55                   	push   %ebp
+  80284f:	89 e5                	mov    %esp,%ebp
+  802851:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802854:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802857:	50                   	push   %eax
+  802858:	e8 b9 e8 ff ff       	call   801116 <fd_alloc>
+  80285d:	83 c4 10             	add    $0x10,%esp
+  802860:	85 c0                	test   %eax,%eax
+  802862:	78 3a                	js     80289e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802864:	83 ec 04             	sub    $0x4,%esp
+  802867:	68 07 04 00 00       	push   $0x407
+  80286c:	ff 75 f4             	push   -0xc(%ebp)
+  80286f:	6a 00                	push   $0x0
+  802871:	e8 54 e4 ff ff       	call   800cca <sys_page_alloc>
+  802876:	83 c4 10             	add    $0x10,%esp
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	78 21                	js     80289e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80287d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802880:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802886:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802888:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80288b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802892:	83 ec 0c             	sub    $0xc,%esp
+  802895:	50                   	push   %eax
+  802896:	e8 54 e8 ff ff       	call   8010ef <fd2num>
+  80289b:	83 c4 10             	add    $0x10,%esp
+}
+  80289e:	c9                   	leave
+  80289f:	c3                   	ret
+
+008028a0 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8028a0:	55                   	push   %ebp
+  8028a1:	89 e5                	mov    %esp,%ebp
+  8028a3:	57                   	push   %edi
+  8028a4:	56                   	push   %esi
+  8028a5:	53                   	push   %ebx
+  8028a6:	83 ec 18             	sub    $0x18,%esp
+  8028a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8028ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8028af:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8028b2:	85 db                	test   %ebx,%ebx
+  8028b4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8028b9:	0f 45 c3             	cmovne %ebx,%eax
+  8028bc:	50                   	push   %eax
+  8028bd:	e8 8b e7 ff ff       	call   80104d <sys_ipc_recv>
+
+	if (from_env_store)
+  8028c2:	83 c4 10             	add    $0x10,%esp
+  8028c5:	85 ff                	test   %edi,%edi
+  8028c7:	74 17                	je     8028e0 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8028c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ce:	85 c0                	test   %eax,%eax
+  8028d0:	75 0c                	jne    8028de <ipc_recv+0x3e>
+  8028d2:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8028d8:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8028de:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8028e0:	85 f6                	test   %esi,%esi
+  8028e2:	74 2e                	je     802912 <ipc_recv+0x72>
+		if (!r && pg)
+  8028e4:	85 c0                	test   %eax,%eax
+  8028e6:	75 24                	jne    80290c <ipc_recv+0x6c>
+  8028e8:	85 db                	test   %ebx,%ebx
+  8028ea:	74 20                	je     80290c <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8028ec:	a1 08 50 80 00       	mov    0x805008,%eax
+  8028f1:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8028f7:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8028f9:	a1 08 50 80 00       	mov    0x805008,%eax
+  8028fe:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802904:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802907:	5b                   	pop    %ebx
+  802908:	5e                   	pop    %esi
+  802909:	5f                   	pop    %edi
+  80290a:	5d                   	pop    %ebp
+  80290b:	c3                   	ret
+			*perm_store = 0;
+  80290c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802912:	85 c0                	test   %eax,%eax
+  802914:	75 ee                	jne    802904 <ipc_recv+0x64>
+  802916:	eb e1                	jmp    8028f9 <ipc_recv+0x59>
+
+00802918 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802918:	55                   	push   %ebp
+  802919:	89 e5                	mov    %esp,%ebp
+  80291b:	57                   	push   %edi
+  80291c:	56                   	push   %esi
+  80291d:	53                   	push   %ebx
+  80291e:	83 ec 0c             	sub    $0xc,%esp
+  802921:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802924:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802927:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80292a:	85 db                	test   %ebx,%ebx
+  80292c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802931:	0f 44 d8             	cmove  %eax,%ebx
+  802934:	ff 75 14             	push   0x14(%ebp)
+  802937:	53                   	push   %ebx
+  802938:	56                   	push   %esi
+  802939:	57                   	push   %edi
+  80293a:	e8 eb e6 ff ff       	call   80102a <sys_ipc_try_send_yield>
+  80293f:	83 c4 10             	add    $0x10,%esp
+  802942:	85 c0                	test   %eax,%eax
+  802944:	79 1e                	jns    802964 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802946:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802949:	75 07                	jne    802952 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80294b:	e8 fa e2 ff ff       	call   800c4a <sys_yield>
+  802950:	eb e2                	jmp    802934 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802952:	50                   	push   %eax
+  802953:	68 0f 34 80 00       	push   $0x80340f
+  802958:	6a 3d                	push   $0x3d
+  80295a:	68 24 34 80 00       	push   $0x803424
+  80295f:	e8 30 d8 ff ff       	call   800194 <_panic>
+	}
+}
+  802964:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802967:	5b                   	pop    %ebx
+  802968:	5e                   	pop    %esi
+  802969:	5f                   	pop    %edi
+  80296a:	5d                   	pop    %ebp
+  80296b:	c3                   	ret
+
+0080296c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80296c:	55                   	push   %ebp
+  80296d:	89 e5                	mov    %esp,%ebp
+  80296f:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802972:	ff 75 08             	push   0x8(%ebp)
+  802975:	e8 50 e2 ff ff       	call   800bca <sys_env_find>
+}
+  80297a:	c9                   	leave
+  80297b:	c3                   	ret
+
+0080297c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80297c:	55                   	push   %ebp
+  80297d:	89 e5                	mov    %esp,%ebp
+  80297f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802982:	89 c2                	mov    %eax,%edx
+  802984:	c1 ea 16             	shr    $0x16,%edx
+  802987:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80298e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802993:	f6 c1 01             	test   $0x1,%cl
+  802996:	74 22                	je     8029ba <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802998:	c1 e8 0c             	shr    $0xc,%eax
+  80299b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8029a2:	a8 01                	test   $0x1,%al
+  8029a4:	74 14                	je     8029ba <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8029a6:	c1 e8 0c             	shr    $0xc,%eax
+  8029a9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8029ac:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8029b3:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8029b7:	0f b7 d2             	movzwl %dx,%edx
+}
+  8029ba:	89 d0                	mov    %edx,%eax
+  8029bc:	5d                   	pop    %ebp
+  8029bd:	c3                   	ret
+  8029be:	66 90                	xchg   %ax,%ax
+
+008029c0 <__udivmoddi4>:
+  8029c0:	55                   	push   %ebp
+  8029c1:	57                   	push   %edi
+  8029c2:	56                   	push   %esi
+  8029c3:	53                   	push   %ebx
+  8029c4:	83 ec 14             	sub    $0x14,%esp
+  8029c7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8029cb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8029cf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8029d3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8029d7:	89 f1                	mov    %esi,%ecx
+  8029d9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8029dd:	09 d9                	or     %ebx,%ecx
+  8029df:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8029e3:	0f 84 92 00 00 00    	je     802a7b <__udivmoddi4+0xbb>
+  8029e9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8029f0:	00 
+  8029f1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8029f6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8029fd:	00 
+  8029fe:	89 1c 24             	mov    %ebx,(%esp)
+  802a01:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802a05:	8d 76 00             	lea    0x0(%esi),%esi
+  802a08:	89 e9                	mov    %ebp,%ecx
+  802a0a:	89 c3                	mov    %eax,%ebx
+  802a0c:	89 d6                	mov    %edx,%esi
+  802a0e:	31 ff                	xor    %edi,%edi
+  802a10:	d3 ee                	shr    %cl,%esi
+  802a12:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a15:	f6 c1 20             	test   $0x20,%cl
+  802a18:	0f 45 de             	cmovne %esi,%ebx
+  802a1b:	0f 45 f7             	cmovne %edi,%esi
+  802a1e:	8b 3c 24             	mov    (%esp),%edi
+  802a21:	39 fb                	cmp    %edi,%ebx
+  802a23:	89 f7                	mov    %esi,%edi
+  802a25:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802a29:	8b 1c 24             	mov    (%esp),%ebx
+  802a2c:	19 f7                	sbb    %esi,%edi
+  802a2e:	72 39                	jb     802a69 <__udivmoddi4+0xa9>
+  802a30:	89 e9                	mov    %ebp,%ecx
+  802a32:	89 f7                	mov    %esi,%edi
+  802a34:	89 de                	mov    %ebx,%esi
+  802a36:	0f a5 df             	shld   %cl,%ebx,%edi
+  802a39:	d3 e6                	shl    %cl,%esi
+  802a3b:	31 db                	xor    %ebx,%ebx
+  802a3d:	f6 c1 20             	test   $0x20,%cl
+  802a40:	0f 45 fe             	cmovne %esi,%edi
+  802a43:	0f 45 f3             	cmovne %ebx,%esi
+  802a46:	29 f0                	sub    %esi,%eax
+  802a48:	be 01 00 00 00       	mov    $0x1,%esi
+  802a4d:	19 fa                	sbb    %edi,%edx
+  802a4f:	31 ff                	xor    %edi,%edi
+  802a51:	31 db                	xor    %ebx,%ebx
+  802a53:	0f a5 f7             	shld   %cl,%esi,%edi
+  802a56:	d3 e6                	shl    %cl,%esi
+  802a58:	f6 c1 20             	test   $0x20,%cl
+  802a5b:	0f 45 fe             	cmovne %esi,%edi
+  802a5e:	0f 45 f3             	cmovne %ebx,%esi
+  802a61:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802a65:	09 74 24 08          	or     %esi,0x8(%esp)
+  802a69:	83 ed 01             	sub    $0x1,%ebp
+  802a6c:	73 9a                	jae    802a08 <__udivmoddi4+0x48>
+  802a6e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802a72:	85 ff                	test   %edi,%edi
+  802a74:	74 05                	je     802a7b <__udivmoddi4+0xbb>
+  802a76:	89 07                	mov    %eax,(%edi)
+  802a78:	89 57 04             	mov    %edx,0x4(%edi)
+  802a7b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802a7f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802a83:	83 c4 14             	add    $0x14,%esp
+  802a86:	5b                   	pop    %ebx
+  802a87:	5e                   	pop    %esi
+  802a88:	5f                   	pop    %edi
+  802a89:	5d                   	pop    %ebp
+  802a8a:	c3                   	ret
+  802a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802a8f:	90                   	nop
+
+00802a90 <__udivdi3>:
+  802a90:	55                   	push   %ebp
+  802a91:	57                   	push   %edi
+  802a92:	56                   	push   %esi
+  802a93:	53                   	push   %ebx
+  802a94:	83 ec 14             	sub    $0x14,%esp
+  802a97:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802a9b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802a9f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802aa3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802aa7:	89 fb                	mov    %edi,%ebx
+  802aa9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802aad:	09 f3                	or     %esi,%ebx
+  802aaf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802ab3:	0f 84 85 00 00 00    	je     802b3e <__udivdi3+0xae>
+  802ab9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802ac0:	00 
+  802ac1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802ac6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802acd:	00 
+  802ace:	89 34 24             	mov    %esi,(%esp)
+  802ad1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802ad5:	8d 76 00             	lea    0x0(%esi),%esi
+  802ad8:	89 e9                	mov    %ebp,%ecx
+  802ada:	89 c3                	mov    %eax,%ebx
+  802adc:	89 d6                	mov    %edx,%esi
+  802ade:	31 ff                	xor    %edi,%edi
+  802ae0:	d3 ee                	shr    %cl,%esi
+  802ae2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802ae5:	f6 c1 20             	test   $0x20,%cl
+  802ae8:	0f 45 de             	cmovne %esi,%ebx
+  802aeb:	0f 45 f7             	cmovne %edi,%esi
+  802aee:	8b 3c 24             	mov    (%esp),%edi
+  802af1:	39 fb                	cmp    %edi,%ebx
+  802af3:	89 f7                	mov    %esi,%edi
+  802af5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802af9:	8b 1c 24             	mov    (%esp),%ebx
+  802afc:	19 f7                	sbb    %esi,%edi
+  802afe:	72 39                	jb     802b39 <__udivdi3+0xa9>
+  802b00:	89 e9                	mov    %ebp,%ecx
+  802b02:	89 f7                	mov    %esi,%edi
+  802b04:	89 de                	mov    %ebx,%esi
+  802b06:	0f a5 df             	shld   %cl,%ebx,%edi
+  802b09:	d3 e6                	shl    %cl,%esi
+  802b0b:	31 db                	xor    %ebx,%ebx
+  802b0d:	f6 c1 20             	test   $0x20,%cl
+  802b10:	0f 45 fe             	cmovne %esi,%edi
+  802b13:	0f 45 f3             	cmovne %ebx,%esi
+  802b16:	29 f0                	sub    %esi,%eax
+  802b18:	be 01 00 00 00       	mov    $0x1,%esi
+  802b1d:	19 fa                	sbb    %edi,%edx
+  802b1f:	31 ff                	xor    %edi,%edi
+  802b21:	31 db                	xor    %ebx,%ebx
+  802b23:	0f a5 f7             	shld   %cl,%esi,%edi
+  802b26:	d3 e6                	shl    %cl,%esi
+  802b28:	f6 c1 20             	test   $0x20,%cl
+  802b2b:	0f 45 fe             	cmovne %esi,%edi
+  802b2e:	0f 45 f3             	cmovne %ebx,%esi
+  802b31:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802b35:	09 74 24 08          	or     %esi,0x8(%esp)
+  802b39:	83 ed 01             	sub    $0x1,%ebp
+  802b3c:	73 9a                	jae    802ad8 <__udivdi3+0x48>
+  802b3e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b42:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b46:	83 c4 14             	add    $0x14,%esp
+  802b49:	5b                   	pop    %ebx
+  802b4a:	5e                   	pop    %esi
+  802b4b:	5f                   	pop    %edi
+  802b4c:	5d                   	pop    %ebp
+  802b4d:	c3                   	ret
+  802b4e:	66 90                	xchg   %ax,%ax
+
+00802b50 <__umoddi3>:
+  802b50:	57                   	push   %edi
+  802b51:	56                   	push   %esi
+  802b52:	53                   	push   %ebx
+  802b53:	83 ec 08             	sub    $0x8,%esp
+  802b56:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  802b5a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  802b5e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b62:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b66:	89 f9                	mov    %edi,%ecx
+  802b68:	89 34 24             	mov    %esi,(%esp)
+  802b6b:	09 f1                	or     %esi,%ecx
+  802b6d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802b71:	74 53                	je     802bc6 <__umoddi3+0x76>
+  802b73:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802b7f:	90                   	nop
+  802b80:	89 c6                	mov    %eax,%esi
+  802b82:	89 d7                	mov    %edx,%edi
+  802b84:	31 db                	xor    %ebx,%ebx
+  802b86:	d3 ef                	shr    %cl,%edi
+  802b88:	0f ad d6             	shrd   %cl,%edx,%esi
+  802b8b:	f6 c1 20             	test   $0x20,%cl
+  802b8e:	0f 45 f7             	cmovne %edi,%esi
+  802b91:	0f 45 fb             	cmovne %ebx,%edi
+  802b94:	8b 1c 24             	mov    (%esp),%ebx
+  802b97:	39 de                	cmp    %ebx,%esi
+  802b99:	89 fb                	mov    %edi,%ebx
+  802b9b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  802b9f:	8b 34 24             	mov    (%esp),%esi
+  802ba2:	19 fb                	sbb    %edi,%ebx
+  802ba4:	72 14                	jb     802bba <__umoddi3+0x6a>
+  802ba6:	0f a5 f7             	shld   %cl,%esi,%edi
+  802ba9:	31 db                	xor    %ebx,%ebx
+  802bab:	d3 e6                	shl    %cl,%esi
+  802bad:	f6 c1 20             	test   $0x20,%cl
+  802bb0:	0f 45 fe             	cmovne %esi,%edi
+  802bb3:	0f 45 f3             	cmovne %ebx,%esi
+  802bb6:	29 f0                	sub    %esi,%eax
+  802bb8:	19 fa                	sbb    %edi,%edx
+  802bba:	83 e9 01             	sub    $0x1,%ecx
+  802bbd:	73 c1                	jae    802b80 <__umoddi3+0x30>
+  802bbf:	83 c4 08             	add    $0x8,%esp
+  802bc2:	5b                   	pop    %ebx
+  802bc3:	5e                   	pop    %esi
+  802bc4:	5f                   	pop    %edi
+  802bc5:	c3                   	ret
+  802bc6:	83 c4 08             	add    $0x8,%esp
+  802bc9:	31 c0                	xor    %eax,%eax
+  802bcb:	31 d2                	xor    %edx,%edx
+  802bcd:	5b                   	pop    %ebx
+  802bce:	5e                   	pop    %esi
+  802bcf:	5f                   	pop    %edi
+  802bd0:	c3                   	ret
+  802bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802bd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802bdf:	90                   	nop
+
+00802be0 <__divdi3>:
+  802be0:	55                   	push   %ebp
+  802be1:	57                   	push   %edi
+  802be2:	56                   	push   %esi
+  802be3:	53                   	push   %ebx
+  802be4:	83 ec 1c             	sub    $0x1c,%esp
+  802be7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802beb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802bef:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802bf3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802bf7:	85 ff                	test   %edi,%edi
+  802bf9:	0f 88 da 00 00 00    	js     802cd9 <__divdi3+0xf9>
+  802bff:	85 db                	test   %ebx,%ebx
+  802c01:	78 16                	js     802c19 <__divdi3+0x39>
+  802c03:	89 dd                	mov    %ebx,%ebp
+  802c05:	89 c8                	mov    %ecx,%eax
+  802c07:	89 da                	mov    %ebx,%edx
+  802c09:	09 cd                	or     %ecx,%ebp
+  802c0b:	0f 85 fd 00 00 00    	jne    802d0e <__divdi3+0x12e>
+  802c11:	83 c4 1c             	add    $0x1c,%esp
+  802c14:	5b                   	pop    %ebx
+  802c15:	5e                   	pop    %esi
+  802c16:	5f                   	pop    %edi
+  802c17:	5d                   	pop    %ebp
+  802c18:	c3                   	ret
+  802c19:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802c1e:	f7 d9                	neg    %ecx
+  802c20:	89 f0                	mov    %esi,%eax
+  802c22:	89 fa                	mov    %edi,%edx
+  802c24:	83 d3 00             	adc    $0x0,%ebx
+  802c27:	89 0c 24             	mov    %ecx,(%esp)
+  802c2a:	f7 db                	neg    %ebx
+  802c2c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802c30:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c37:	00 
+  802c38:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c3d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c44:	00 
+  802c45:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802c49:	89 cd                	mov    %ecx,%ebp
+  802c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802c4f:	90                   	nop
+  802c50:	89 e9                	mov    %ebp,%ecx
+  802c52:	89 c3                	mov    %eax,%ebx
+  802c54:	89 d6                	mov    %edx,%esi
+  802c56:	31 ff                	xor    %edi,%edi
+  802c58:	d3 ee                	shr    %cl,%esi
+  802c5a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802c5d:	f6 c1 20             	test   $0x20,%cl
+  802c60:	0f 45 de             	cmovne %esi,%ebx
+  802c63:	0f 45 f7             	cmovne %edi,%esi
+  802c66:	8b 3c 24             	mov    (%esp),%edi
+  802c69:	39 fb                	cmp    %edi,%ebx
+  802c6b:	89 f7                	mov    %esi,%edi
+  802c6d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c71:	8b 1c 24             	mov    (%esp),%ebx
+  802c74:	19 f7                	sbb    %esi,%edi
+  802c76:	72 39                	jb     802cb1 <__divdi3+0xd1>
+  802c78:	89 e9                	mov    %ebp,%ecx
+  802c7a:	89 f7                	mov    %esi,%edi
+  802c7c:	89 de                	mov    %ebx,%esi
+  802c7e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802c81:	d3 e6                	shl    %cl,%esi
+  802c83:	31 db                	xor    %ebx,%ebx
+  802c85:	f6 c1 20             	test   $0x20,%cl
+  802c88:	0f 45 fe             	cmovne %esi,%edi
+  802c8b:	0f 45 f3             	cmovne %ebx,%esi
+  802c8e:	29 f0                	sub    %esi,%eax
+  802c90:	be 01 00 00 00       	mov    $0x1,%esi
+  802c95:	19 fa                	sbb    %edi,%edx
+  802c97:	31 ff                	xor    %edi,%edi
+  802c99:	31 db                	xor    %ebx,%ebx
+  802c9b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c9e:	d3 e6                	shl    %cl,%esi
+  802ca0:	f6 c1 20             	test   $0x20,%cl
+  802ca3:	0f 45 fe             	cmovne %esi,%edi
+  802ca6:	0f 45 f3             	cmovne %ebx,%esi
+  802ca9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802cad:	09 74 24 08          	or     %esi,0x8(%esp)
+  802cb1:	83 ed 01             	sub    $0x1,%ebp
+  802cb4:	73 9a                	jae    802c50 <__divdi3+0x70>
+  802cb6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802cba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cbe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cc2:	85 ed                	test   %ebp,%ebp
+  802cc4:	0f 84 47 ff ff ff    	je     802c11 <__divdi3+0x31>
+  802cca:	f7 d8                	neg    %eax
+  802ccc:	83 d2 00             	adc    $0x0,%edx
+  802ccf:	83 c4 1c             	add    $0x1c,%esp
+  802cd2:	5b                   	pop    %ebx
+  802cd3:	f7 da                	neg    %edx
+  802cd5:	5e                   	pop    %esi
+  802cd6:	5f                   	pop    %edi
+  802cd7:	5d                   	pop    %ebp
+  802cd8:	c3                   	ret
+  802cd9:	f7 de                	neg    %esi
+  802cdb:	83 d7 00             	adc    $0x0,%edi
+  802cde:	f7 df                	neg    %edi
+  802ce0:	85 db                	test   %ebx,%ebx
+  802ce2:	78 23                	js     802d07 <__divdi3+0x127>
+  802ce4:	89 dd                	mov    %ebx,%ebp
+  802ce6:	89 c8                	mov    %ecx,%eax
+  802ce8:	89 da                	mov    %ebx,%edx
+  802cea:	09 cd                	or     %ecx,%ebp
+  802cec:	0f 84 1f ff ff ff    	je     802c11 <__divdi3+0x31>
+  802cf2:	89 0c 24             	mov    %ecx,(%esp)
+  802cf5:	89 f0                	mov    %esi,%eax
+  802cf7:	89 fa                	mov    %edi,%edx
+  802cf9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802cfe:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802d02:	e9 29 ff ff ff       	jmp    802c30 <__divdi3+0x50>
+  802d07:	31 ed                	xor    %ebp,%ebp
+  802d09:	e9 10 ff ff ff       	jmp    802c1e <__divdi3+0x3e>
+  802d0e:	89 0c 24             	mov    %ecx,(%esp)
+  802d11:	89 f0                	mov    %esi,%eax
+  802d13:	89 fa                	mov    %edi,%edx
+  802d15:	31 ed                	xor    %ebp,%ebp
+  802d17:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802d1b:	e9 10 ff ff ff       	jmp    802c30 <__divdi3+0x50>
+
+00802d20 <__moddi3>:
+  802d20:	55                   	push   %ebp
+  802d21:	57                   	push   %edi
+  802d22:	56                   	push   %esi
+  802d23:	53                   	push   %ebx
+  802d24:	83 ec 14             	sub    $0x14,%esp
+  802d27:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d2b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d2f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802d33:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802d37:	85 d2                	test   %edx,%edx
+  802d39:	0f 88 9b 00 00 00    	js     802dda <__moddi3+0xba>
+  802d3f:	89 f7                	mov    %esi,%edi
+  802d41:	31 ed                	xor    %ebp,%ebp
+  802d43:	09 cf                	or     %ecx,%edi
+  802d45:	0f 84 83 00 00 00    	je     802dce <__moddi3+0xae>
+  802d4b:	89 cb                	mov    %ecx,%ebx
+  802d4d:	89 f7                	mov    %esi,%edi
+  802d4f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802d53:	f7 db                	neg    %ebx
+  802d55:	83 d7 00             	adc    $0x0,%edi
+  802d58:	f7 df                	neg    %edi
+  802d5a:	0f 49 f7             	cmovns %edi,%esi
+  802d5d:	0f 49 cb             	cmovns %ebx,%ecx
+  802d60:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802d64:	89 0c 24             	mov    %ecx,(%esp)
+  802d67:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d6c:	89 cd                	mov    %ecx,%ebp
+  802d6e:	66 90                	xchg   %ax,%ax
+  802d70:	89 e9                	mov    %ebp,%ecx
+  802d72:	89 c3                	mov    %eax,%ebx
+  802d74:	89 d6                	mov    %edx,%esi
+  802d76:	31 ff                	xor    %edi,%edi
+  802d78:	d3 ee                	shr    %cl,%esi
+  802d7a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802d7d:	f6 c1 20             	test   $0x20,%cl
+  802d80:	0f 45 de             	cmovne %esi,%ebx
+  802d83:	0f 45 f7             	cmovne %edi,%esi
+  802d86:	8b 3c 24             	mov    (%esp),%edi
+  802d89:	39 fb                	cmp    %edi,%ebx
+  802d8b:	89 f7                	mov    %esi,%edi
+  802d8d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802d91:	8b 1c 24             	mov    (%esp),%ebx
+  802d94:	19 f7                	sbb    %esi,%edi
+  802d96:	72 1a                	jb     802db2 <__moddi3+0x92>
+  802d98:	89 e9                	mov    %ebp,%ecx
+  802d9a:	89 f7                	mov    %esi,%edi
+  802d9c:	89 de                	mov    %ebx,%esi
+  802d9e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802da1:	d3 e6                	shl    %cl,%esi
+  802da3:	31 db                	xor    %ebx,%ebx
+  802da5:	f6 c1 20             	test   $0x20,%cl
+  802da8:	0f 45 fe             	cmovne %esi,%edi
+  802dab:	0f 45 f3             	cmovne %ebx,%esi
+  802dae:	29 f0                	sub    %esi,%eax
+  802db0:	19 fa                	sbb    %edi,%edx
+  802db2:	83 ed 01             	sub    $0x1,%ebp
+  802db5:	73 b9                	jae    802d70 <__moddi3+0x50>
+  802db7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802dbb:	85 ed                	test   %ebp,%ebp
+  802dbd:	74 07                	je     802dc6 <__moddi3+0xa6>
+  802dbf:	f7 d8                	neg    %eax
+  802dc1:	83 d2 00             	adc    $0x0,%edx
+  802dc4:	f7 da                	neg    %edx
+  802dc6:	83 c4 14             	add    $0x14,%esp
+  802dc9:	5b                   	pop    %ebx
+  802dca:	5e                   	pop    %esi
+  802dcb:	5f                   	pop    %edi
+  802dcc:	5d                   	pop    %ebp
+  802dcd:	c3                   	ret
+  802dce:	83 c4 14             	add    $0x14,%esp
+  802dd1:	31 c0                	xor    %eax,%eax
+  802dd3:	31 d2                	xor    %edx,%edx
+  802dd5:	5b                   	pop    %ebx
+  802dd6:	5e                   	pop    %esi
+  802dd7:	5f                   	pop    %edi
+  802dd8:	5d                   	pop    %ebp
+  802dd9:	c3                   	ret
+  802dda:	89 f7                	mov    %esi,%edi
+  802ddc:	09 cf                	or     %ecx,%edi
+  802dde:	74 11                	je     802df1 <__moddi3+0xd1>
+  802de0:	f7 d8                	neg    %eax
+  802de2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802de7:	83 d2 00             	adc    $0x0,%edx
+  802dea:	f7 da                	neg    %edx
+  802dec:	e9 5a ff ff ff       	jmp    802d4b <__moddi3+0x2b>
+  802df1:	31 c0                	xor    %eax,%eax
+  802df3:	31 d2                	xor    %edx,%edx
+  802df5:	eb c8                	jmp    802dbf <__moddi3+0x9f>
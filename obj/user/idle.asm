@@ -0,0 +1,5568 @@
+
+obj/user/idle.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 19 00 00 00       	call   80004a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+	binaryname = "idle";
+  800039:	c7 05 00 30 80 00 80 	movl   $0x802680,0x803000
+  800040:	26 80 00 
+	// Instead of busy-waiting like this,
+	// a better way would be to use the processor's HLT instruction
+	// to cause the processor to stop executing until the next interrupt -
+	// doing so allows the processor to conserve power more effectively.
+	while (1) {
+		sys_yield();
+  800043:	e8 1f 01 00 00       	call   800167 <sys_yield>
+	while (1) {
+  800048:	eb f9                	jmp    800043 <umain+0x10>
+
+0080004a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004a:	55                   	push   %ebp
+  80004b:	89 e5                	mov    %esp,%ebp
+  80004d:	56                   	push   %esi
+  80004e:	53                   	push   %ebx
+  80004f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800052:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800055:	e8 ee 00 00 00       	call   800148 <sys_getenvid>
+  80005a:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80005f:	c1 e0 09             	shl    $0x9,%eax
+  800062:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800067:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80006c:	85 db                	test   %ebx,%ebx
+  80006e:	7e 07                	jle    800077 <libmain+0x2d>
+		binaryname = argv[0];
+  800070:	8b 06                	mov    (%esi),%eax
+  800072:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800077:	83 ec 08             	sub    $0x8,%esp
+  80007a:	56                   	push   %esi
+  80007b:	53                   	push   %ebx
+  80007c:	e8 b2 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800081:	e8 0a 00 00 00       	call   800090 <exit>
+}
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008c:	5b                   	pop    %ebx
+  80008d:	5e                   	pop    %esi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+
+00800090 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800096:	e8 45 07 00 00       	call   8007e0 <close_all>
+	sys_env_destroy(0);
+  80009b:	83 ec 0c             	sub    $0xc,%esp
+  80009e:	6a 00                	push   $0x0
+  8000a0:	e8 62 00 00 00       	call   800107 <sys_env_destroy>
+}
+  8000a5:	83 c4 10             	add    $0x10,%esp
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+
+008000aa <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000aa:	55                   	push   %ebp
+  8000ab:	89 e5                	mov    %esp,%ebp
+  8000ad:	57                   	push   %edi
+  8000ae:	56                   	push   %esi
+  8000af:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000bb:	89 c3                	mov    %eax,%ebx
+  8000bd:	89 c7                	mov    %eax,%edi
+  8000bf:	89 c6                	mov    %eax,%esi
+  8000c1:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000c3:	5b                   	pop    %ebx
+  8000c4:	5e                   	pop    %esi
+  8000c5:	5f                   	pop    %edi
+  8000c6:	5d                   	pop    %ebp
+  8000c7:	c3                   	ret
+
+008000c8 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000c8:	55                   	push   %ebp
+  8000c9:	89 e5                	mov    %esp,%ebp
+  8000cb:	57                   	push   %edi
+  8000cc:	56                   	push   %esi
+  8000cd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d8:	89 d1                	mov    %edx,%ecx
+  8000da:	89 d3                	mov    %edx,%ebx
+  8000dc:	89 d7                	mov    %edx,%edi
+  8000de:	89 d6                	mov    %edx,%esi
+  8000e0:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000e2:	5b                   	pop    %ebx
+  8000e3:	5e                   	pop    %esi
+  8000e4:	5f                   	pop    %edi
+  8000e5:	5d                   	pop    %ebp
+  8000e6:	c3                   	ret
+
+008000e7 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8000e7:	55                   	push   %ebp
+  8000e8:	89 e5                	mov    %esp,%ebp
+  8000ea:	57                   	push   %edi
+  8000eb:	56                   	push   %esi
+  8000ec:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8000fa:	89 cb                	mov    %ecx,%ebx
+  8000fc:	89 cf                	mov    %ecx,%edi
+  8000fe:	89 ce                	mov    %ecx,%esi
+  800100:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800102:	5b                   	pop    %ebx
+  800103:	5e                   	pop    %esi
+  800104:	5f                   	pop    %edi
+  800105:	5d                   	pop    %ebp
+  800106:	c3                   	ret
+
+00800107 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800107:	55                   	push   %ebp
+  800108:	89 e5                	mov    %esp,%ebp
+  80010a:	57                   	push   %edi
+  80010b:	56                   	push   %esi
+  80010c:	53                   	push   %ebx
+  80010d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800110:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800115:	8b 55 08             	mov    0x8(%ebp),%edx
+  800118:	b8 03 00 00 00       	mov    $0x3,%eax
+  80011d:	89 cb                	mov    %ecx,%ebx
+  80011f:	89 cf                	mov    %ecx,%edi
+  800121:	89 ce                	mov    %ecx,%esi
+  800123:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800125:	85 c0                	test   %eax,%eax
+  800127:	7f 08                	jg     800131 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80012c:	5b                   	pop    %ebx
+  80012d:	5e                   	pop    %esi
+  80012e:	5f                   	pop    %edi
+  80012f:	5d                   	pop    %ebp
+  800130:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800131:	83 ec 0c             	sub    $0xc,%esp
+  800134:	50                   	push   %eax
+  800135:	6a 03                	push   $0x3
+  800137:	68 8f 26 80 00       	push   $0x80268f
+  80013c:	6a 23                	push   $0x23
+  80013e:	68 ac 26 80 00       	push   $0x8026ac
+  800143:	e8 d5 15 00 00       	call   80171d <_panic>
+
+00800148 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800148:	55                   	push   %ebp
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	57                   	push   %edi
+  80014c:	56                   	push   %esi
+  80014d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80014e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800153:	b8 02 00 00 00       	mov    $0x2,%eax
+  800158:	89 d1                	mov    %edx,%ecx
+  80015a:	89 d3                	mov    %edx,%ebx
+  80015c:	89 d7                	mov    %edx,%edi
+  80015e:	89 d6                	mov    %edx,%esi
+  800160:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800162:	5b                   	pop    %ebx
+  800163:	5e                   	pop    %esi
+  800164:	5f                   	pop    %edi
+  800165:	5d                   	pop    %ebp
+  800166:	c3                   	ret
+
+00800167 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	57                   	push   %edi
+  80016b:	56                   	push   %esi
+  80016c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80016d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800172:	b8 16 00 00 00       	mov    $0x16,%eax
+  800177:	89 d1                	mov    %edx,%ecx
+  800179:	89 d3                	mov    %edx,%ebx
+  80017b:	89 d7                	mov    %edx,%edi
+  80017d:	89 d6                	mov    %edx,%esi
+  80017f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800181:	5b                   	pop    %ebx
+  800182:	5e                   	pop    %esi
+  800183:	5f                   	pop    %edi
+  800184:	5d                   	pop    %ebp
+  800185:	c3                   	ret
+
+00800186 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800186:	55                   	push   %ebp
+  800187:	89 e5                	mov    %esp,%ebp
+  800189:	57                   	push   %edi
+  80018a:	56                   	push   %esi
+  80018b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80018c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800191:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800196:	89 d1                	mov    %edx,%ecx
+  800198:	89 d3                	mov    %edx,%ebx
+  80019a:	89 d7                	mov    %edx,%edi
+  80019c:	89 d6                	mov    %edx,%esi
+  80019e:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  8001a0:	5b                   	pop    %ebx
+  8001a1:	5e                   	pop    %esi
+  8001a2:	5f                   	pop    %edi
+  8001a3:	5d                   	pop    %ebp
+  8001a4:	c3                   	ret
+
+008001a5 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  8001a5:	55                   	push   %ebp
+  8001a6:	89 e5                	mov    %esp,%ebp
+  8001a8:	57                   	push   %edi
+  8001a9:	56                   	push   %esi
+  8001aa:	53                   	push   %ebx
+  8001ab:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8001be:	89 df                	mov    %ebx,%edi
+  8001c0:	89 de                	mov    %ebx,%esi
+  8001c2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001c4:	85 c0                	test   %eax,%eax
+  8001c6:	7f 08                	jg     8001d0 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  8001c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001cb:	5b                   	pop    %ebx
+  8001cc:	5e                   	pop    %esi
+  8001cd:	5f                   	pop    %edi
+  8001ce:	5d                   	pop    %ebp
+  8001cf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001d0:	83 ec 0c             	sub    $0xc,%esp
+  8001d3:	50                   	push   %eax
+  8001d4:	6a 15                	push   $0x15
+  8001d6:	68 8f 26 80 00       	push   $0x80268f
+  8001db:	6a 23                	push   $0x23
+  8001dd:	68 ac 26 80 00       	push   $0x8026ac
+  8001e2:	e8 36 15 00 00       	call   80171d <_panic>
+
+008001e7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001e7:	55                   	push   %ebp
+  8001e8:	89 e5                	mov    %esp,%ebp
+  8001ea:	57                   	push   %edi
+  8001eb:	56                   	push   %esi
+  8001ec:	53                   	push   %ebx
+  8001ed:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8001f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001fb:	b8 05 00 00 00       	mov    $0x5,%eax
+  800200:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800203:	89 f7                	mov    %esi,%edi
+  800205:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800207:	85 c0                	test   %eax,%eax
+  800209:	7f 08                	jg     800213 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80020b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020e:	5b                   	pop    %ebx
+  80020f:	5e                   	pop    %esi
+  800210:	5f                   	pop    %edi
+  800211:	5d                   	pop    %ebp
+  800212:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800213:	83 ec 0c             	sub    $0xc,%esp
+  800216:	50                   	push   %eax
+  800217:	6a 05                	push   $0x5
+  800219:	68 8f 26 80 00       	push   $0x80268f
+  80021e:	6a 23                	push   $0x23
+  800220:	68 ac 26 80 00       	push   $0x8026ac
+  800225:	e8 f3 14 00 00       	call   80171d <_panic>
+
+0080022a <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  80022a:	55                   	push   %ebp
+  80022b:	89 e5                	mov    %esp,%ebp
+  80022d:	57                   	push   %edi
+  80022e:	56                   	push   %esi
+  80022f:	53                   	push   %ebx
+  800230:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800233:	be 00 00 00 00       	mov    $0x0,%esi
+  800238:	8b 55 08             	mov    0x8(%ebp),%edx
+  80023b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80023e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800243:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800246:	89 f7                	mov    %esi,%edi
+  800248:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80024a:	85 c0                	test   %eax,%eax
+  80024c:	7f 08                	jg     800256 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80024e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800251:	5b                   	pop    %ebx
+  800252:	5e                   	pop    %esi
+  800253:	5f                   	pop    %edi
+  800254:	5d                   	pop    %ebp
+  800255:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800256:	83 ec 0c             	sub    $0xc,%esp
+  800259:	50                   	push   %eax
+  80025a:	6a 06                	push   $0x6
+  80025c:	68 8f 26 80 00       	push   $0x80268f
+  800261:	6a 23                	push   $0x23
+  800263:	68 ac 26 80 00       	push   $0x8026ac
+  800268:	e8 b0 14 00 00       	call   80171d <_panic>
+
+0080026d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80026d:	55                   	push   %ebp
+  80026e:	89 e5                	mov    %esp,%ebp
+  800270:	57                   	push   %edi
+  800271:	56                   	push   %esi
+  800272:	53                   	push   %ebx
+  800273:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800276:	8b 55 08             	mov    0x8(%ebp),%edx
+  800279:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027c:	b8 07 00 00 00       	mov    $0x7,%eax
+  800281:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800284:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800287:	8b 75 18             	mov    0x18(%ebp),%esi
+  80028a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80028c:	85 c0                	test   %eax,%eax
+  80028e:	7f 08                	jg     800298 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800293:	5b                   	pop    %ebx
+  800294:	5e                   	pop    %esi
+  800295:	5f                   	pop    %edi
+  800296:	5d                   	pop    %ebp
+  800297:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800298:	83 ec 0c             	sub    $0xc,%esp
+  80029b:	50                   	push   %eax
+  80029c:	6a 07                	push   $0x7
+  80029e:	68 8f 26 80 00       	push   $0x80268f
+  8002a3:	6a 23                	push   $0x23
+  8002a5:	68 ac 26 80 00       	push   $0x8026ac
+  8002aa:	e8 6e 14 00 00       	call   80171d <_panic>
+
+008002af <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8002af:	55                   	push   %ebp
+  8002b0:	89 e5                	mov    %esp,%ebp
+  8002b2:	57                   	push   %edi
+  8002b3:	56                   	push   %esi
+  8002b4:	53                   	push   %ebx
+  8002b5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002c8:	89 df                	mov    %ebx,%edi
+  8002ca:	89 de                	mov    %ebx,%esi
+  8002cc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002ce:	85 c0                	test   %eax,%eax
+  8002d0:	7f 08                	jg     8002da <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d5:	5b                   	pop    %ebx
+  8002d6:	5e                   	pop    %esi
+  8002d7:	5f                   	pop    %edi
+  8002d8:	5d                   	pop    %ebp
+  8002d9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002da:	83 ec 0c             	sub    $0xc,%esp
+  8002dd:	50                   	push   %eax
+  8002de:	6a 08                	push   $0x8
+  8002e0:	68 8f 26 80 00       	push   $0x80268f
+  8002e5:	6a 23                	push   $0x23
+  8002e7:	68 ac 26 80 00       	push   $0x8026ac
+  8002ec:	e8 2c 14 00 00       	call   80171d <_panic>
+
+008002f1 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002f1:	55                   	push   %ebp
+  8002f2:	89 e5                	mov    %esp,%ebp
+  8002f4:	57                   	push   %edi
+  8002f5:	56                   	push   %esi
+  8002f6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002fd:	b8 09 00 00 00       	mov    $0x9,%eax
+  800302:	be 00 00 00 00       	mov    $0x0,%esi
+  800307:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80030a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80030d:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  80030f:	5b                   	pop    %ebx
+  800310:	5e                   	pop    %esi
+  800311:	5f                   	pop    %edi
+  800312:	5d                   	pop    %ebp
+  800313:	c3                   	ret
+
+00800314 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800314:	55                   	push   %ebp
+  800315:	89 e5                	mov    %esp,%ebp
+  800317:	57                   	push   %edi
+  800318:	56                   	push   %esi
+  800319:	53                   	push   %ebx
+  80031a:	8b 45 18             	mov    0x18(%ebp),%eax
+  80031d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800320:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800325:	77 27                	ja     80034e <sys_page_map_range+0x3a>
+  800327:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80032d:	77 1f                	ja     80034e <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  80032f:	c1 e0 0c             	shl    $0xc,%eax
+  800332:	89 c6                	mov    %eax,%esi
+  800334:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800336:	8b 55 08             	mov    0x8(%ebp),%edx
+  800339:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80033c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800341:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800344:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800347:	cd 30                	int    $0x30
+}
+  800349:	5b                   	pop    %ebx
+  80034a:	5e                   	pop    %esi
+  80034b:	5f                   	pop    %edi
+  80034c:	5d                   	pop    %ebp
+  80034d:	c3                   	ret
+		return -E_INVAL;
+  80034e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800353:	eb f4                	jmp    800349 <sys_page_map_range+0x35>
+
+00800355 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800355:	55                   	push   %ebp
+  800356:	89 e5                	mov    %esp,%ebp
+  800358:	57                   	push   %edi
+  800359:	56                   	push   %esi
+  80035a:	53                   	push   %ebx
+  80035b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80035e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800361:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800364:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800369:	be 00 00 00 00       	mov    $0x0,%esi
+  80036e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800371:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800374:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800376:	85 c0                	test   %eax,%eax
+  800378:	7f 08                	jg     800382 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80037a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80037d:	5b                   	pop    %ebx
+  80037e:	5e                   	pop    %esi
+  80037f:	5f                   	pop    %edi
+  800380:	5d                   	pop    %ebp
+  800381:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800382:	83 ec 0c             	sub    $0xc,%esp
+  800385:	50                   	push   %eax
+  800386:	6a 0c                	push   $0xc
+  800388:	68 8f 26 80 00       	push   $0x80268f
+  80038d:	6a 23                	push   $0x23
+  80038f:	68 ac 26 80 00       	push   $0x8026ac
+  800394:	e8 84 13 00 00       	call   80171d <_panic>
+
+00800399 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800399:	55                   	push   %ebp
+  80039a:	89 e5                	mov    %esp,%ebp
+  80039c:	57                   	push   %edi
+  80039d:	56                   	push   %esi
+  80039e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80039f:	be 00 00 00 00       	mov    $0x0,%esi
+  8003a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003aa:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8003af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003b2:	89 f7                	mov    %esi,%edi
+  8003b4:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003b6:	5b                   	pop    %ebx
+  8003b7:	5e                   	pop    %esi
+  8003b8:	5f                   	pop    %edi
+  8003b9:	5d                   	pop    %ebp
+  8003ba:	c3                   	ret
+
+008003bb <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003bb:	55                   	push   %ebp
+  8003bc:	89 e5                	mov    %esp,%ebp
+  8003be:	57                   	push   %edi
+  8003bf:	56                   	push   %esi
+  8003c0:	53                   	push   %ebx
+  8003c1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003cf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003d4:	89 df                	mov    %ebx,%edi
+  8003d6:	89 de                	mov    %ebx,%esi
+  8003d8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003da:	85 c0                	test   %eax,%eax
+  8003dc:	7f 08                	jg     8003e6 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e1:	5b                   	pop    %ebx
+  8003e2:	5e                   	pop    %esi
+  8003e3:	5f                   	pop    %edi
+  8003e4:	5d                   	pop    %ebp
+  8003e5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003e6:	83 ec 0c             	sub    $0xc,%esp
+  8003e9:	50                   	push   %eax
+  8003ea:	6a 0f                	push   $0xf
+  8003ec:	68 8f 26 80 00       	push   $0x80268f
+  8003f1:	6a 23                	push   $0x23
+  8003f3:	68 ac 26 80 00       	push   $0x8026ac
+  8003f8:	e8 20 13 00 00       	call   80171d <_panic>
+
+008003fd <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8003fd:	55                   	push   %ebp
+  8003fe:	89 e5                	mov    %esp,%ebp
+  800400:	57                   	push   %edi
+  800401:	56                   	push   %esi
+  800402:	53                   	push   %ebx
+  800403:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800406:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80040b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80040e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800411:	b8 10 00 00 00       	mov    $0x10,%eax
+  800416:	89 df                	mov    %ebx,%edi
+  800418:	89 de                	mov    %ebx,%esi
+  80041a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80041c:	85 c0                	test   %eax,%eax
+  80041e:	7f 08                	jg     800428 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800420:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800423:	5b                   	pop    %ebx
+  800424:	5e                   	pop    %esi
+  800425:	5f                   	pop    %edi
+  800426:	5d                   	pop    %ebp
+  800427:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800428:	83 ec 0c             	sub    $0xc,%esp
+  80042b:	50                   	push   %eax
+  80042c:	6a 10                	push   $0x10
+  80042e:	68 8f 26 80 00       	push   $0x80268f
+  800433:	6a 23                	push   $0x23
+  800435:	68 ac 26 80 00       	push   $0x8026ac
+  80043a:	e8 de 12 00 00       	call   80171d <_panic>
+
+0080043f <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80043f:	55                   	push   %ebp
+  800440:	89 e5                	mov    %esp,%ebp
+  800442:	57                   	push   %edi
+  800443:	56                   	push   %esi
+  800444:	53                   	push   %ebx
+  800445:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800448:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80044d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800450:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800453:	b8 11 00 00 00       	mov    $0x11,%eax
+  800458:	89 df                	mov    %ebx,%edi
+  80045a:	89 de                	mov    %ebx,%esi
+  80045c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80045e:	85 c0                	test   %eax,%eax
+  800460:	7f 08                	jg     80046a <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800462:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800465:	5b                   	pop    %ebx
+  800466:	5e                   	pop    %esi
+  800467:	5f                   	pop    %edi
+  800468:	5d                   	pop    %ebp
+  800469:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80046a:	83 ec 0c             	sub    $0xc,%esp
+  80046d:	50                   	push   %eax
+  80046e:	6a 11                	push   $0x11
+  800470:	68 8f 26 80 00       	push   $0x80268f
+  800475:	6a 23                	push   $0x23
+  800477:	68 ac 26 80 00       	push   $0x8026ac
+  80047c:	e8 9c 12 00 00       	call   80171d <_panic>
+
+00800481 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800481:	55                   	push   %ebp
+  800482:	89 e5                	mov    %esp,%ebp
+  800484:	57                   	push   %edi
+  800485:	56                   	push   %esi
+  800486:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800487:	ba 00 00 00 00       	mov    $0x0,%edx
+  80048c:	b8 12 00 00 00       	mov    $0x12,%eax
+  800491:	89 d1                	mov    %edx,%ecx
+  800493:	89 d3                	mov    %edx,%ebx
+  800495:	89 d7                	mov    %edx,%edi
+  800497:	89 d6                	mov    %edx,%esi
+  800499:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  80049b:	5b                   	pop    %ebx
+  80049c:	5e                   	pop    %esi
+  80049d:	5f                   	pop    %edi
+  80049e:	5d                   	pop    %ebp
+  80049f:	c3                   	ret
+
+008004a0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8004a0:	55                   	push   %ebp
+  8004a1:	89 e5                	mov    %esp,%ebp
+  8004a3:	57                   	push   %edi
+  8004a4:	56                   	push   %esi
+  8004a5:	53                   	push   %ebx
+  8004a6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004b4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004b9:	89 df                	mov    %ebx,%edi
+  8004bb:	89 de                	mov    %ebx,%esi
+  8004bd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004bf:	85 c0                	test   %eax,%eax
+  8004c1:	7f 08                	jg     8004cb <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8004c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c6:	5b                   	pop    %ebx
+  8004c7:	5e                   	pop    %esi
+  8004c8:	5f                   	pop    %edi
+  8004c9:	5d                   	pop    %ebp
+  8004ca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004cb:	83 ec 0c             	sub    $0xc,%esp
+  8004ce:	50                   	push   %eax
+  8004cf:	6a 13                	push   $0x13
+  8004d1:	68 8f 26 80 00       	push   $0x80268f
+  8004d6:	6a 23                	push   $0x23
+  8004d8:	68 ac 26 80 00       	push   $0x8026ac
+  8004dd:	e8 3b 12 00 00       	call   80171d <_panic>
+
+008004e2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004e2:	55                   	push   %ebp
+  8004e3:	89 e5                	mov    %esp,%ebp
+  8004e5:	57                   	push   %edi
+  8004e6:	56                   	push   %esi
+  8004e7:	53                   	push   %ebx
+  8004e8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004fb:	89 df                	mov    %ebx,%edi
+  8004fd:	89 de                	mov    %ebx,%esi
+  8004ff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800501:	85 c0                	test   %eax,%eax
+  800503:	7f 08                	jg     80050d <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800508:	5b                   	pop    %ebx
+  800509:	5e                   	pop    %esi
+  80050a:	5f                   	pop    %edi
+  80050b:	5d                   	pop    %ebp
+  80050c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80050d:	83 ec 0c             	sub    $0xc,%esp
+  800510:	50                   	push   %eax
+  800511:	6a 14                	push   $0x14
+  800513:	68 8f 26 80 00       	push   $0x80268f
+  800518:	6a 23                	push   $0x23
+  80051a:	68 ac 26 80 00       	push   $0x8026ac
+  80051f:	e8 f9 11 00 00       	call   80171d <_panic>
+
+00800524 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800524:	55                   	push   %ebp
+  800525:	89 e5                	mov    %esp,%ebp
+  800527:	57                   	push   %edi
+  800528:	56                   	push   %esi
+  800529:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80052a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80052d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800530:	b8 17 00 00 00       	mov    $0x17,%eax
+  800535:	be 00 00 00 00       	mov    $0x0,%esi
+  80053a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80053d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800540:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800542:	5b                   	pop    %ebx
+  800543:	5e                   	pop    %esi
+  800544:	5f                   	pop    %edi
+  800545:	5d                   	pop    %ebp
+  800546:	c3                   	ret
+
+00800547 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800547:	55                   	push   %ebp
+  800548:	89 e5                	mov    %esp,%ebp
+  80054a:	57                   	push   %edi
+  80054b:	56                   	push   %esi
+  80054c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80054d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800550:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800553:	b8 18 00 00 00       	mov    $0x18,%eax
+  800558:	be 00 00 00 00       	mov    $0x0,%esi
+  80055d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800560:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800563:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800565:	5b                   	pop    %ebx
+  800566:	5e                   	pop    %esi
+  800567:	5f                   	pop    %edi
+  800568:	5d                   	pop    %ebp
+  800569:	c3                   	ret
+
+0080056a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80056a:	55                   	push   %ebp
+  80056b:	89 e5                	mov    %esp,%ebp
+  80056d:	57                   	push   %edi
+  80056e:	56                   	push   %esi
+  80056f:	53                   	push   %ebx
+  800570:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800578:	8b 55 08             	mov    0x8(%ebp),%edx
+  80057b:	b8 19 00 00 00       	mov    $0x19,%eax
+  800580:	89 cb                	mov    %ecx,%ebx
+  800582:	89 cf                	mov    %ecx,%edi
+  800584:	89 ce                	mov    %ecx,%esi
+  800586:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800588:	85 c0                	test   %eax,%eax
+  80058a:	7f 08                	jg     800594 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80058c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80058f:	5b                   	pop    %ebx
+  800590:	5e                   	pop    %esi
+  800591:	5f                   	pop    %edi
+  800592:	5d                   	pop    %ebp
+  800593:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800594:	83 ec 0c             	sub    $0xc,%esp
+  800597:	50                   	push   %eax
+  800598:	6a 19                	push   $0x19
+  80059a:	68 8f 26 80 00       	push   $0x80268f
+  80059f:	6a 23                	push   $0x23
+  8005a1:	68 ac 26 80 00       	push   $0x8026ac
+  8005a6:	e8 72 11 00 00       	call   80171d <_panic>
+
+008005ab <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8005ab:	55                   	push   %ebp
+  8005ac:	89 e5                	mov    %esp,%ebp
+  8005ae:	57                   	push   %edi
+  8005af:	56                   	push   %esi
+  8005b0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005bb:	89 d1                	mov    %edx,%ecx
+  8005bd:	89 d3                	mov    %edx,%ebx
+  8005bf:	89 d7                	mov    %edx,%edi
+  8005c1:	89 d6                	mov    %edx,%esi
+  8005c3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8005c5:	5b                   	pop    %ebx
+  8005c6:	5e                   	pop    %esi
+  8005c7:	5f                   	pop    %edi
+  8005c8:	5d                   	pop    %ebp
+  8005c9:	c3                   	ret
+
+008005ca <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8005ca:	55                   	push   %ebp
+  8005cb:	89 e5                	mov    %esp,%ebp
+  8005cd:	57                   	push   %edi
+  8005ce:	56                   	push   %esi
+  8005cf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005e0:	89 df                	mov    %ebx,%edi
+  8005e2:	89 de                	mov    %ebx,%esi
+  8005e4:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8005e6:	5b                   	pop    %ebx
+  8005e7:	5e                   	pop    %esi
+  8005e8:	5f                   	pop    %edi
+  8005e9:	5d                   	pop    %ebp
+  8005ea:	c3                   	ret
+
+008005eb <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8005eb:	55                   	push   %ebp
+  8005ec:	89 e5                	mov    %esp,%ebp
+  8005ee:	57                   	push   %edi
+  8005ef:	56                   	push   %esi
+  8005f0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005fc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800601:	89 df                	mov    %ebx,%edi
+  800603:	89 de                	mov    %ebx,%esi
+  800605:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  800607:	5b                   	pop    %ebx
+  800608:	5e                   	pop    %esi
+  800609:	5f                   	pop    %edi
+  80060a:	5d                   	pop    %ebp
+  80060b:	c3                   	ret
+
+0080060c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80060c:	55                   	push   %ebp
+  80060d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80060f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800612:	05 00 00 00 30       	add    $0x30000000,%eax
+  800617:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80061a:	5d                   	pop    %ebp
+  80061b:	c3                   	ret
+
+0080061c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80061c:	55                   	push   %ebp
+  80061d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80061f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800622:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800627:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80062c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800631:	5d                   	pop    %ebp
+  800632:	c3                   	ret
+
+00800633 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800633:	55                   	push   %ebp
+  800634:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800636:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80063b:	eb 02                	jmp    80063f <fd_alloc+0xc>
+  80063d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80063f:	89 c2                	mov    %eax,%edx
+  800641:	c1 ea 16             	shr    $0x16,%edx
+  800644:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80064b:	f6 c2 01             	test   $0x1,%dl
+  80064e:	74 2b                	je     80067b <fd_alloc+0x48>
+  800650:	89 c2                	mov    %eax,%edx
+  800652:	c1 ea 0c             	shr    $0xc,%edx
+  800655:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80065c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800662:	f6 c1 01             	test   $0x1,%cl
+  800665:	74 14                	je     80067b <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800667:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80066d:	75 ce                	jne    80063d <fd_alloc+0xa>
+  80066f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800674:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800679:	eb 05                	jmp    800680 <fd_alloc+0x4d>
+			return 0;
+  80067b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800680:	8b 55 08             	mov    0x8(%ebp),%edx
+  800683:	89 02                	mov    %eax,(%edx)
+}
+  800685:	89 c8                	mov    %ecx,%eax
+  800687:	5d                   	pop    %ebp
+  800688:	c3                   	ret
+
+00800689 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800689:	55                   	push   %ebp
+  80068a:	89 e5                	mov    %esp,%ebp
+  80068c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80068f:	83 f8 1f             	cmp    $0x1f,%eax
+  800692:	77 30                	ja     8006c4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800694:	c1 e0 0c             	shl    $0xc,%eax
+  800697:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80069c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006a2:	f6 c2 01             	test   $0x1,%dl
+  8006a5:	74 24                	je     8006cb <fd_lookup+0x42>
+  8006a7:	89 c2                	mov    %eax,%edx
+  8006a9:	c1 ea 0c             	shr    $0xc,%edx
+  8006ac:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006b3:	f6 c2 01             	test   $0x1,%dl
+  8006b6:	74 1a                	je     8006d2 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006bb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006c2:	5d                   	pop    %ebp
+  8006c3:	c3                   	ret
+		return -E_INVAL;
+  8006c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c9:	eb f7                	jmp    8006c2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8006cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006d0:	eb f0                	jmp    8006c2 <fd_lookup+0x39>
+  8006d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006d7:	eb e9                	jmp    8006c2 <fd_lookup+0x39>
+
+008006d9 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006d9:	55                   	push   %ebp
+  8006da:	89 e5                	mov    %esp,%ebp
+  8006dc:	53                   	push   %ebx
+  8006dd:	83 ec 04             	sub    $0x4,%esp
+  8006e0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e8:	eb 03                	jmp    8006ed <dev_lookup+0x14>
+  8006ea:	83 c0 01             	add    $0x1,%eax
+  8006ed:	8b 1c 85 38 27 80 00 	mov    0x802738(,%eax,4),%ebx
+  8006f4:	85 db                	test   %ebx,%ebx
+  8006f6:	74 0b                	je     800703 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8006f8:	39 13                	cmp    %edx,(%ebx)
+  8006fa:	75 ee                	jne    8006ea <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8006fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800701:	eb 1f                	jmp    800722 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800703:	a1 08 40 80 00       	mov    0x804008,%eax
+  800708:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80070b:	83 ec 04             	sub    $0x4,%esp
+  80070e:	52                   	push   %edx
+  80070f:	50                   	push   %eax
+  800710:	68 bc 26 80 00       	push   $0x8026bc
+  800715:	e8 de 10 00 00       	call   8017f8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80071a:	83 c4 10             	add    $0x10,%esp
+  80071d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800722:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800725:	89 1a                	mov    %ebx,(%edx)
+}
+  800727:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80072a:	c9                   	leave
+  80072b:	c3                   	ret
+
+0080072c <fd_close>:
+{
+  80072c:	55                   	push   %ebp
+  80072d:	89 e5                	mov    %esp,%ebp
+  80072f:	57                   	push   %edi
+  800730:	56                   	push   %esi
+  800731:	53                   	push   %ebx
+  800732:	83 ec 24             	sub    $0x24,%esp
+  800735:	8b 75 08             	mov    0x8(%ebp),%esi
+  800738:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80073b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80073e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80073f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800745:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800748:	50                   	push   %eax
+  800749:	e8 3b ff ff ff       	call   800689 <fd_lookup>
+  80074e:	89 c3                	mov    %eax,%ebx
+  800750:	83 c4 10             	add    $0x10,%esp
+  800753:	85 c0                	test   %eax,%eax
+  800755:	78 05                	js     80075c <fd_close+0x30>
+	    || fd != fd2)
+  800757:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80075a:	74 16                	je     800772 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80075c:	89 f8                	mov    %edi,%eax
+  80075e:	84 c0                	test   %al,%al
+  800760:	b8 00 00 00 00       	mov    $0x0,%eax
+  800765:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800768:	89 d8                	mov    %ebx,%eax
+  80076a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80076d:	5b                   	pop    %ebx
+  80076e:	5e                   	pop    %esi
+  80076f:	5f                   	pop    %edi
+  800770:	5d                   	pop    %ebp
+  800771:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800772:	83 ec 08             	sub    $0x8,%esp
+  800775:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800778:	50                   	push   %eax
+  800779:	ff 36                	push   (%esi)
+  80077b:	e8 59 ff ff ff       	call   8006d9 <dev_lookup>
+  800780:	89 c3                	mov    %eax,%ebx
+  800782:	83 c4 10             	add    $0x10,%esp
+  800785:	85 c0                	test   %eax,%eax
+  800787:	78 1a                	js     8007a3 <fd_close+0x77>
+		if (dev->dev_close)
+  800789:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80078c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80078f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800794:	85 c0                	test   %eax,%eax
+  800796:	74 0b                	je     8007a3 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800798:	83 ec 0c             	sub    $0xc,%esp
+  80079b:	56                   	push   %esi
+  80079c:	ff d0                	call   *%eax
+  80079e:	89 c3                	mov    %eax,%ebx
+  8007a0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007a3:	83 ec 08             	sub    $0x8,%esp
+  8007a6:	56                   	push   %esi
+  8007a7:	6a 00                	push   $0x0
+  8007a9:	e8 01 fb ff ff       	call   8002af <sys_page_unmap>
+	return r;
+  8007ae:	83 c4 10             	add    $0x10,%esp
+  8007b1:	eb b5                	jmp    800768 <fd_close+0x3c>
+
+008007b3 <close>:
+
+int
+close(int fdnum)
+{
+  8007b3:	55                   	push   %ebp
+  8007b4:	89 e5                	mov    %esp,%ebp
+  8007b6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007bc:	50                   	push   %eax
+  8007bd:	ff 75 08             	push   0x8(%ebp)
+  8007c0:	e8 c4 fe ff ff       	call   800689 <fd_lookup>
+  8007c5:	83 c4 10             	add    $0x10,%esp
+  8007c8:	85 c0                	test   %eax,%eax
+  8007ca:	79 02                	jns    8007ce <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007cc:	c9                   	leave
+  8007cd:	c3                   	ret
+		return fd_close(fd, 1);
+  8007ce:	83 ec 08             	sub    $0x8,%esp
+  8007d1:	6a 01                	push   $0x1
+  8007d3:	ff 75 f4             	push   -0xc(%ebp)
+  8007d6:	e8 51 ff ff ff       	call   80072c <fd_close>
+  8007db:	83 c4 10             	add    $0x10,%esp
+  8007de:	eb ec                	jmp    8007cc <close+0x19>
+
+008007e0 <close_all>:
+
+void
+close_all(void)
+{
+  8007e0:	55                   	push   %ebp
+  8007e1:	89 e5                	mov    %esp,%ebp
+  8007e3:	53                   	push   %ebx
+  8007e4:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8007e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8007ec:	83 ec 0c             	sub    $0xc,%esp
+  8007ef:	53                   	push   %ebx
+  8007f0:	e8 be ff ff ff       	call   8007b3 <close>
+	for (i = 0; i < MAXFD; i++)
+  8007f5:	83 c3 01             	add    $0x1,%ebx
+  8007f8:	83 c4 10             	add    $0x10,%esp
+  8007fb:	83 fb 20             	cmp    $0x20,%ebx
+  8007fe:	75 ec                	jne    8007ec <close_all+0xc>
+}
+  800800:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800803:	c9                   	leave
+  800804:	c3                   	ret
+
+00800805 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800805:	55                   	push   %ebp
+  800806:	89 e5                	mov    %esp,%ebp
+  800808:	57                   	push   %edi
+  800809:	56                   	push   %esi
+  80080a:	53                   	push   %ebx
+  80080b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80080e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800811:	50                   	push   %eax
+  800812:	ff 75 08             	push   0x8(%ebp)
+  800815:	e8 6f fe ff ff       	call   800689 <fd_lookup>
+  80081a:	89 c3                	mov    %eax,%ebx
+  80081c:	83 c4 10             	add    $0x10,%esp
+  80081f:	85 c0                	test   %eax,%eax
+  800821:	78 7f                	js     8008a2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800823:	83 ec 0c             	sub    $0xc,%esp
+  800826:	ff 75 0c             	push   0xc(%ebp)
+  800829:	e8 85 ff ff ff       	call   8007b3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80082e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800831:	c1 e6 0c             	shl    $0xc,%esi
+  800834:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80083a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80083d:	89 3c 24             	mov    %edi,(%esp)
+  800840:	e8 d7 fd ff ff       	call   80061c <fd2data>
+  800845:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800847:	89 34 24             	mov    %esi,(%esp)
+  80084a:	e8 cd fd ff ff       	call   80061c <fd2data>
+  80084f:	83 c4 10             	add    $0x10,%esp
+  800852:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800855:	89 d8                	mov    %ebx,%eax
+  800857:	c1 e8 16             	shr    $0x16,%eax
+  80085a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800861:	a8 01                	test   $0x1,%al
+  800863:	74 11                	je     800876 <dup+0x71>
+  800865:	89 d8                	mov    %ebx,%eax
+  800867:	c1 e8 0c             	shr    $0xc,%eax
+  80086a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800871:	f6 c2 01             	test   $0x1,%dl
+  800874:	75 36                	jne    8008ac <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800876:	89 f8                	mov    %edi,%eax
+  800878:	c1 e8 0c             	shr    $0xc,%eax
+  80087b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800882:	83 ec 0c             	sub    $0xc,%esp
+  800885:	25 07 0e 00 00       	and    $0xe07,%eax
+  80088a:	50                   	push   %eax
+  80088b:	56                   	push   %esi
+  80088c:	6a 00                	push   $0x0
+  80088e:	57                   	push   %edi
+  80088f:	6a 00                	push   $0x0
+  800891:	e8 d7 f9 ff ff       	call   80026d <sys_page_map>
+  800896:	89 c3                	mov    %eax,%ebx
+  800898:	83 c4 20             	add    $0x20,%esp
+  80089b:	85 c0                	test   %eax,%eax
+  80089d:	78 33                	js     8008d2 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80089f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008a2:	89 d8                	mov    %ebx,%eax
+  8008a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008a7:	5b                   	pop    %ebx
+  8008a8:	5e                   	pop    %esi
+  8008a9:	5f                   	pop    %edi
+  8008aa:	5d                   	pop    %ebp
+  8008ab:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008ac:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008b3:	83 ec 0c             	sub    $0xc,%esp
+  8008b6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008bb:	50                   	push   %eax
+  8008bc:	ff 75 d4             	push   -0x2c(%ebp)
+  8008bf:	6a 00                	push   $0x0
+  8008c1:	53                   	push   %ebx
+  8008c2:	6a 00                	push   $0x0
+  8008c4:	e8 a4 f9 ff ff       	call   80026d <sys_page_map>
+  8008c9:	89 c3                	mov    %eax,%ebx
+  8008cb:	83 c4 20             	add    $0x20,%esp
+  8008ce:	85 c0                	test   %eax,%eax
+  8008d0:	79 a4                	jns    800876 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008d2:	83 ec 08             	sub    $0x8,%esp
+  8008d5:	56                   	push   %esi
+  8008d6:	6a 00                	push   $0x0
+  8008d8:	e8 d2 f9 ff ff       	call   8002af <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008dd:	83 c4 08             	add    $0x8,%esp
+  8008e0:	ff 75 d4             	push   -0x2c(%ebp)
+  8008e3:	6a 00                	push   $0x0
+  8008e5:	e8 c5 f9 ff ff       	call   8002af <sys_page_unmap>
+	return r;
+  8008ea:	83 c4 10             	add    $0x10,%esp
+  8008ed:	eb b3                	jmp    8008a2 <dup+0x9d>
+
+008008ef <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8008ef:	55                   	push   %ebp
+  8008f0:	89 e5                	mov    %esp,%ebp
+  8008f2:	56                   	push   %esi
+  8008f3:	53                   	push   %ebx
+  8008f4:	83 ec 18             	sub    $0x18,%esp
+  8008f7:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8008fd:	50                   	push   %eax
+  8008fe:	56                   	push   %esi
+  8008ff:	e8 85 fd ff ff       	call   800689 <fd_lookup>
+  800904:	83 c4 10             	add    $0x10,%esp
+  800907:	85 c0                	test   %eax,%eax
+  800909:	78 3c                	js     800947 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80090b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80090e:	83 ec 08             	sub    $0x8,%esp
+  800911:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800914:	50                   	push   %eax
+  800915:	ff 33                	push   (%ebx)
+  800917:	e8 bd fd ff ff       	call   8006d9 <dev_lookup>
+  80091c:	83 c4 10             	add    $0x10,%esp
+  80091f:	85 c0                	test   %eax,%eax
+  800921:	78 24                	js     800947 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800923:	8b 43 08             	mov    0x8(%ebx),%eax
+  800926:	83 e0 03             	and    $0x3,%eax
+  800929:	83 f8 01             	cmp    $0x1,%eax
+  80092c:	74 20                	je     80094e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80092e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800931:	8b 40 08             	mov    0x8(%eax),%eax
+  800934:	85 c0                	test   %eax,%eax
+  800936:	74 37                	je     80096f <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800938:	83 ec 04             	sub    $0x4,%esp
+  80093b:	ff 75 10             	push   0x10(%ebp)
+  80093e:	ff 75 0c             	push   0xc(%ebp)
+  800941:	53                   	push   %ebx
+  800942:	ff d0                	call   *%eax
+  800944:	83 c4 10             	add    $0x10,%esp
+}
+  800947:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80094a:	5b                   	pop    %ebx
+  80094b:	5e                   	pop    %esi
+  80094c:	5d                   	pop    %ebp
+  80094d:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80094e:	a1 08 40 80 00       	mov    0x804008,%eax
+  800953:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800956:	83 ec 04             	sub    $0x4,%esp
+  800959:	56                   	push   %esi
+  80095a:	50                   	push   %eax
+  80095b:	68 fd 26 80 00       	push   $0x8026fd
+  800960:	e8 93 0e 00 00       	call   8017f8 <cprintf>
+		return -E_INVAL;
+  800965:	83 c4 10             	add    $0x10,%esp
+  800968:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80096d:	eb d8                	jmp    800947 <read+0x58>
+		return -E_NOT_SUPP;
+  80096f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800974:	eb d1                	jmp    800947 <read+0x58>
+
+00800976 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	57                   	push   %edi
+  80097a:	56                   	push   %esi
+  80097b:	53                   	push   %ebx
+  80097c:	83 ec 0c             	sub    $0xc,%esp
+  80097f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800982:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800985:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80098a:	eb 02                	jmp    80098e <readn+0x18>
+  80098c:	01 c3                	add    %eax,%ebx
+  80098e:	39 f3                	cmp    %esi,%ebx
+  800990:	73 21                	jae    8009b3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800992:	83 ec 04             	sub    $0x4,%esp
+  800995:	89 f0                	mov    %esi,%eax
+  800997:	29 d8                	sub    %ebx,%eax
+  800999:	50                   	push   %eax
+  80099a:	89 d8                	mov    %ebx,%eax
+  80099c:	03 45 0c             	add    0xc(%ebp),%eax
+  80099f:	50                   	push   %eax
+  8009a0:	57                   	push   %edi
+  8009a1:	e8 49 ff ff ff       	call   8008ef <read>
+		if (m < 0)
+  8009a6:	83 c4 10             	add    $0x10,%esp
+  8009a9:	85 c0                	test   %eax,%eax
+  8009ab:	78 04                	js     8009b1 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8009ad:	75 dd                	jne    80098c <readn+0x16>
+  8009af:	eb 02                	jmp    8009b3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009b1:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8009b3:	89 d8                	mov    %ebx,%eax
+  8009b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009b8:	5b                   	pop    %ebx
+  8009b9:	5e                   	pop    %esi
+  8009ba:	5f                   	pop    %edi
+  8009bb:	5d                   	pop    %ebp
+  8009bc:	c3                   	ret
+
+008009bd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009bd:	55                   	push   %ebp
+  8009be:	89 e5                	mov    %esp,%ebp
+  8009c0:	56                   	push   %esi
+  8009c1:	53                   	push   %ebx
+  8009c2:	83 ec 18             	sub    $0x18,%esp
+  8009c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009c8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009cb:	50                   	push   %eax
+  8009cc:	53                   	push   %ebx
+  8009cd:	e8 b7 fc ff ff       	call   800689 <fd_lookup>
+  8009d2:	83 c4 10             	add    $0x10,%esp
+  8009d5:	85 c0                	test   %eax,%eax
+  8009d7:	78 37                	js     800a10 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009d9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009dc:	83 ec 08             	sub    $0x8,%esp
+  8009df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009e2:	50                   	push   %eax
+  8009e3:	ff 36                	push   (%esi)
+  8009e5:	e8 ef fc ff ff       	call   8006d9 <dev_lookup>
+  8009ea:	83 c4 10             	add    $0x10,%esp
+  8009ed:	85 c0                	test   %eax,%eax
+  8009ef:	78 1f                	js     800a10 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8009f1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8009f5:	74 20                	je     800a17 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8009f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009fa:	8b 40 0c             	mov    0xc(%eax),%eax
+  8009fd:	85 c0                	test   %eax,%eax
+  8009ff:	74 37                	je     800a38 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a01:	83 ec 04             	sub    $0x4,%esp
+  800a04:	ff 75 10             	push   0x10(%ebp)
+  800a07:	ff 75 0c             	push   0xc(%ebp)
+  800a0a:	56                   	push   %esi
+  800a0b:	ff d0                	call   *%eax
+  800a0d:	83 c4 10             	add    $0x10,%esp
+}
+  800a10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a13:	5b                   	pop    %ebx
+  800a14:	5e                   	pop    %esi
+  800a15:	5d                   	pop    %ebp
+  800a16:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a17:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a1c:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800a1f:	83 ec 04             	sub    $0x4,%esp
+  800a22:	53                   	push   %ebx
+  800a23:	50                   	push   %eax
+  800a24:	68 19 27 80 00       	push   $0x802719
+  800a29:	e8 ca 0d 00 00       	call   8017f8 <cprintf>
+		return -E_INVAL;
+  800a2e:	83 c4 10             	add    $0x10,%esp
+  800a31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a36:	eb d8                	jmp    800a10 <write+0x53>
+		return -E_NOT_SUPP;
+  800a38:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a3d:	eb d1                	jmp    800a10 <write+0x53>
+
+00800a3f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a3f:	55                   	push   %ebp
+  800a40:	89 e5                	mov    %esp,%ebp
+  800a42:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a45:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a48:	50                   	push   %eax
+  800a49:	ff 75 08             	push   0x8(%ebp)
+  800a4c:	e8 38 fc ff ff       	call   800689 <fd_lookup>
+  800a51:	83 c4 10             	add    $0x10,%esp
+  800a54:	85 c0                	test   %eax,%eax
+  800a56:	78 0e                	js     800a66 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800a58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a5e:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800a61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a66:	c9                   	leave
+  800a67:	c3                   	ret
+
+00800a68 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a68:	55                   	push   %ebp
+  800a69:	89 e5                	mov    %esp,%ebp
+  800a6b:	56                   	push   %esi
+  800a6c:	53                   	push   %ebx
+  800a6d:	83 ec 18             	sub    $0x18,%esp
+  800a70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a73:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a76:	50                   	push   %eax
+  800a77:	53                   	push   %ebx
+  800a78:	e8 0c fc ff ff       	call   800689 <fd_lookup>
+  800a7d:	83 c4 10             	add    $0x10,%esp
+  800a80:	85 c0                	test   %eax,%eax
+  800a82:	78 34                	js     800ab8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a84:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a87:	83 ec 08             	sub    $0x8,%esp
+  800a8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a8d:	50                   	push   %eax
+  800a8e:	ff 36                	push   (%esi)
+  800a90:	e8 44 fc ff ff       	call   8006d9 <dev_lookup>
+  800a95:	83 c4 10             	add    $0x10,%esp
+  800a98:	85 c0                	test   %eax,%eax
+  800a9a:	78 1c                	js     800ab8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a9c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800aa0:	74 1d                	je     800abf <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800aa2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800aa5:	8b 40 18             	mov    0x18(%eax),%eax
+  800aa8:	85 c0                	test   %eax,%eax
+  800aaa:	74 34                	je     800ae0 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800aac:	83 ec 08             	sub    $0x8,%esp
+  800aaf:	ff 75 0c             	push   0xc(%ebp)
+  800ab2:	56                   	push   %esi
+  800ab3:	ff d0                	call   *%eax
+  800ab5:	83 c4 10             	add    $0x10,%esp
+}
+  800ab8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800abb:	5b                   	pop    %ebx
+  800abc:	5e                   	pop    %esi
+  800abd:	5d                   	pop    %ebp
+  800abe:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800abf:	a1 08 40 80 00       	mov    0x804008,%eax
+  800ac4:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ac7:	83 ec 04             	sub    $0x4,%esp
+  800aca:	53                   	push   %ebx
+  800acb:	50                   	push   %eax
+  800acc:	68 dc 26 80 00       	push   $0x8026dc
+  800ad1:	e8 22 0d 00 00       	call   8017f8 <cprintf>
+		return -E_INVAL;
+  800ad6:	83 c4 10             	add    $0x10,%esp
+  800ad9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ade:	eb d8                	jmp    800ab8 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800ae0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ae5:	eb d1                	jmp    800ab8 <ftruncate+0x50>
+
+00800ae7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800ae7:	55                   	push   %ebp
+  800ae8:	89 e5                	mov    %esp,%ebp
+  800aea:	56                   	push   %esi
+  800aeb:	53                   	push   %ebx
+  800aec:	83 ec 18             	sub    $0x18,%esp
+  800aef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800af2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800af5:	50                   	push   %eax
+  800af6:	ff 75 08             	push   0x8(%ebp)
+  800af9:	e8 8b fb ff ff       	call   800689 <fd_lookup>
+  800afe:	83 c4 10             	add    $0x10,%esp
+  800b01:	85 c0                	test   %eax,%eax
+  800b03:	78 49                	js     800b4e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b05:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b08:	83 ec 08             	sub    $0x8,%esp
+  800b0b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b0e:	50                   	push   %eax
+  800b0f:	ff 36                	push   (%esi)
+  800b11:	e8 c3 fb ff ff       	call   8006d9 <dev_lookup>
+  800b16:	83 c4 10             	add    $0x10,%esp
+  800b19:	85 c0                	test   %eax,%eax
+  800b1b:	78 31                	js     800b4e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b20:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b24:	74 2f                	je     800b55 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b26:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b29:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b30:	00 00 00 
+	stat->st_isdir = 0;
+  800b33:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b3a:	00 00 00 
+	stat->st_dev = dev;
+  800b3d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b43:	83 ec 08             	sub    $0x8,%esp
+  800b46:	53                   	push   %ebx
+  800b47:	56                   	push   %esi
+  800b48:	ff 50 14             	call   *0x14(%eax)
+  800b4b:	83 c4 10             	add    $0x10,%esp
+}
+  800b4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b51:	5b                   	pop    %ebx
+  800b52:	5e                   	pop    %esi
+  800b53:	5d                   	pop    %ebp
+  800b54:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b55:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b5a:	eb f2                	jmp    800b4e <fstat+0x67>
+
+00800b5c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	56                   	push   %esi
+  800b60:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800b61:	83 ec 08             	sub    $0x8,%esp
+  800b64:	6a 00                	push   $0x0
+  800b66:	ff 75 08             	push   0x8(%ebp)
+  800b69:	e8 e4 01 00 00       	call   800d52 <open>
+  800b6e:	89 c3                	mov    %eax,%ebx
+  800b70:	83 c4 10             	add    $0x10,%esp
+  800b73:	85 c0                	test   %eax,%eax
+  800b75:	78 1b                	js     800b92 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800b77:	83 ec 08             	sub    $0x8,%esp
+  800b7a:	ff 75 0c             	push   0xc(%ebp)
+  800b7d:	50                   	push   %eax
+  800b7e:	e8 64 ff ff ff       	call   800ae7 <fstat>
+  800b83:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b85:	89 1c 24             	mov    %ebx,(%esp)
+  800b88:	e8 26 fc ff ff       	call   8007b3 <close>
+	return r;
+  800b8d:	83 c4 10             	add    $0x10,%esp
+  800b90:	89 f3                	mov    %esi,%ebx
+}
+  800b92:	89 d8                	mov    %ebx,%eax
+  800b94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b97:	5b                   	pop    %ebx
+  800b98:	5e                   	pop    %esi
+  800b99:	5d                   	pop    %ebp
+  800b9a:	c3                   	ret
+
+00800b9b <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800b9b:	55                   	push   %ebp
+  800b9c:	89 e5                	mov    %esp,%ebp
+  800b9e:	56                   	push   %esi
+  800b9f:	53                   	push   %ebx
+  800ba0:	89 c6                	mov    %eax,%esi
+  800ba2:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800ba4:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800bab:	74 27                	je     800bd4 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800bad:	6a 07                	push   $0x7
+  800baf:	68 00 50 80 00       	push   $0x805000
+  800bb4:	56                   	push   %esi
+  800bb5:	ff 35 00 40 80 00    	push   0x804000
+  800bbb:	e8 ce 15 00 00       	call   80218e <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800bc0:	83 c4 0c             	add    $0xc,%esp
+  800bc3:	6a 00                	push   $0x0
+  800bc5:	53                   	push   %ebx
+  800bc6:	6a 00                	push   $0x0
+  800bc8:	e8 49 15 00 00       	call   802116 <ipc_recv>
+}
+  800bcd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bd0:	5b                   	pop    %ebx
+  800bd1:	5e                   	pop    %esi
+  800bd2:	5d                   	pop    %ebp
+  800bd3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bd4:	83 ec 0c             	sub    $0xc,%esp
+  800bd7:	6a 01                	push   $0x1
+  800bd9:	e8 04 16 00 00       	call   8021e2 <ipc_find_env>
+  800bde:	a3 00 40 80 00       	mov    %eax,0x804000
+  800be3:	83 c4 10             	add    $0x10,%esp
+  800be6:	eb c5                	jmp    800bad <fsipc+0x12>
+
+00800be8 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800be8:	55                   	push   %ebp
+  800be9:	89 e5                	mov    %esp,%ebp
+  800beb:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800bee:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf1:	8b 40 0c             	mov    0xc(%eax),%eax
+  800bf4:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800bf9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bfc:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800c01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c06:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c0b:	e8 8b ff ff ff       	call   800b9b <fsipc>
+}
+  800c10:	c9                   	leave
+  800c11:	c3                   	ret
+
+00800c12 <devfile_flush>:
+{
+  800c12:	55                   	push   %ebp
+  800c13:	89 e5                	mov    %esp,%ebp
+  800c15:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800c18:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c1b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c1e:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800c23:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c28:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c2d:	e8 69 ff ff ff       	call   800b9b <fsipc>
+}
+  800c32:	c9                   	leave
+  800c33:	c3                   	ret
+
+00800c34 <devfile_stat>:
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	53                   	push   %ebx
+  800c38:	83 ec 04             	sub    $0x4,%esp
+  800c3b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800c3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c41:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c44:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800c49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c53:	e8 43 ff ff ff       	call   800b9b <fsipc>
+  800c58:	85 c0                	test   %eax,%eax
+  800c5a:	78 2c                	js     800c88 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800c5c:	83 ec 08             	sub    $0x8,%esp
+  800c5f:	68 00 50 80 00       	push   $0x805000
+  800c64:	53                   	push   %ebx
+  800c65:	e8 7c 11 00 00       	call   801de6 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800c6a:	a1 80 50 80 00       	mov    0x805080,%eax
+  800c6f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800c75:	a1 84 50 80 00       	mov    0x805084,%eax
+  800c7a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800c80:	83 c4 10             	add    $0x10,%esp
+  800c83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c8b:	c9                   	leave
+  800c8c:	c3                   	ret
+
+00800c8d <devfile_write>:
+{
+  800c8d:	55                   	push   %ebp
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	83 ec 0c             	sub    $0xc,%esp
+  800c93:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800c96:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800c9b:	39 d0                	cmp    %edx,%eax
+  800c9d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ca0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca3:	8b 52 0c             	mov    0xc(%edx),%edx
+  800ca6:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800cac:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800cb1:	50                   	push   %eax
+  800cb2:	ff 75 0c             	push   0xc(%ebp)
+  800cb5:	68 08 50 80 00       	push   $0x805008
+  800cba:	e8 ad 12 00 00       	call   801f6c <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800cbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cc9:	e8 cd fe ff ff       	call   800b9b <fsipc>
+}
+  800cce:	c9                   	leave
+  800ccf:	c3                   	ret
+
+00800cd0 <devfile_read>:
+{
+  800cd0:	55                   	push   %ebp
+  800cd1:	89 e5                	mov    %esp,%ebp
+  800cd3:	56                   	push   %esi
+  800cd4:	53                   	push   %ebx
+  800cd5:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800cd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cdb:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cde:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800ce3:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cee:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cf3:	e8 a3 fe ff ff       	call   800b9b <fsipc>
+  800cf8:	89 c3                	mov    %eax,%ebx
+  800cfa:	85 c0                	test   %eax,%eax
+  800cfc:	78 1f                	js     800d1d <devfile_read+0x4d>
+	assert(r <= n);
+  800cfe:	39 c6                	cmp    %eax,%esi
+  800d00:	72 24                	jb     800d26 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  800d02:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800d07:	7f 33                	jg     800d3c <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800d09:	83 ec 04             	sub    $0x4,%esp
+  800d0c:	50                   	push   %eax
+  800d0d:	68 00 50 80 00       	push   $0x805000
+  800d12:	ff 75 0c             	push   0xc(%ebp)
+  800d15:	e8 52 12 00 00       	call   801f6c <memmove>
+	return r;
+  800d1a:	83 c4 10             	add    $0x10,%esp
+}
+  800d1d:	89 d8                	mov    %ebx,%eax
+  800d1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d22:	5b                   	pop    %ebx
+  800d23:	5e                   	pop    %esi
+  800d24:	5d                   	pop    %ebp
+  800d25:	c3                   	ret
+	assert(r <= n);
+  800d26:	68 4c 27 80 00       	push   $0x80274c
+  800d2b:	68 53 27 80 00       	push   $0x802753
+  800d30:	6a 7c                	push   $0x7c
+  800d32:	68 68 27 80 00       	push   $0x802768
+  800d37:	e8 e1 09 00 00       	call   80171d <_panic>
+	assert(r <= PGSIZE);
+  800d3c:	68 73 27 80 00       	push   $0x802773
+  800d41:	68 53 27 80 00       	push   $0x802753
+  800d46:	6a 7d                	push   $0x7d
+  800d48:	68 68 27 80 00       	push   $0x802768
+  800d4d:	e8 cb 09 00 00       	call   80171d <_panic>
+
+00800d52 <open>:
+{
+  800d52:	55                   	push   %ebp
+  800d53:	89 e5                	mov    %esp,%ebp
+  800d55:	56                   	push   %esi
+  800d56:	53                   	push   %ebx
+  800d57:	83 ec 1c             	sub    $0x1c,%esp
+  800d5a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800d5d:	56                   	push   %esi
+  800d5e:	e8 48 10 00 00       	call   801dab <strlen>
+  800d63:	83 c4 10             	add    $0x10,%esp
+  800d66:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800d6b:	7f 6c                	jg     800dd9 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800d6d:	83 ec 0c             	sub    $0xc,%esp
+  800d70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d73:	50                   	push   %eax
+  800d74:	e8 ba f8 ff ff       	call   800633 <fd_alloc>
+  800d79:	89 c3                	mov    %eax,%ebx
+  800d7b:	83 c4 10             	add    $0x10,%esp
+  800d7e:	85 c0                	test   %eax,%eax
+  800d80:	78 3c                	js     800dbe <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800d82:	83 ec 08             	sub    $0x8,%esp
+  800d85:	56                   	push   %esi
+  800d86:	68 00 50 80 00       	push   $0x805000
+  800d8b:	e8 56 10 00 00       	call   801de6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800d90:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d93:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800d98:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800d9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da0:	e8 f6 fd ff ff       	call   800b9b <fsipc>
+  800da5:	89 c3                	mov    %eax,%ebx
+  800da7:	83 c4 10             	add    $0x10,%esp
+  800daa:	85 c0                	test   %eax,%eax
+  800dac:	78 19                	js     800dc7 <open+0x75>
+	return fd2num(fd);
+  800dae:	83 ec 0c             	sub    $0xc,%esp
+  800db1:	ff 75 f4             	push   -0xc(%ebp)
+  800db4:	e8 53 f8 ff ff       	call   80060c <fd2num>
+  800db9:	89 c3                	mov    %eax,%ebx
+  800dbb:	83 c4 10             	add    $0x10,%esp
+}
+  800dbe:	89 d8                	mov    %ebx,%eax
+  800dc0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dc3:	5b                   	pop    %ebx
+  800dc4:	5e                   	pop    %esi
+  800dc5:	5d                   	pop    %ebp
+  800dc6:	c3                   	ret
+		fd_close(fd, 0);
+  800dc7:	83 ec 08             	sub    $0x8,%esp
+  800dca:	6a 00                	push   $0x0
+  800dcc:	ff 75 f4             	push   -0xc(%ebp)
+  800dcf:	e8 58 f9 ff ff       	call   80072c <fd_close>
+		return r;
+  800dd4:	83 c4 10             	add    $0x10,%esp
+  800dd7:	eb e5                	jmp    800dbe <open+0x6c>
+		return -E_BAD_PATH;
+  800dd9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800dde:	eb de                	jmp    800dbe <open+0x6c>
+
+00800de0 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800de6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800deb:	b8 08 00 00 00       	mov    $0x8,%eax
+  800df0:	e8 a6 fd ff ff       	call   800b9b <fsipc>
+}
+  800df5:	c9                   	leave
+  800df6:	c3                   	ret
+
+00800df7 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800df7:	55                   	push   %ebp
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800dfd:	68 7f 27 80 00       	push   $0x80277f
+  800e02:	ff 75 0c             	push   0xc(%ebp)
+  800e05:	e8 dc 0f 00 00       	call   801de6 <strcpy>
+	return 0;
+}
+  800e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0f:	c9                   	leave
+  800e10:	c3                   	ret
+
+00800e11 <devsock_close>:
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	53                   	push   %ebx
+  800e15:	83 ec 10             	sub    $0x10,%esp
+  800e18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800e1b:	53                   	push   %ebx
+  800e1c:	e8 d1 13 00 00       	call   8021f2 <pageref>
+  800e21:	89 c2                	mov    %eax,%edx
+  800e23:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e26:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800e2b:	83 fa 01             	cmp    $0x1,%edx
+  800e2e:	74 05                	je     800e35 <devsock_close+0x24>
+}
+  800e30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e33:	c9                   	leave
+  800e34:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800e35:	83 ec 0c             	sub    $0xc,%esp
+  800e38:	ff 73 0c             	push   0xc(%ebx)
+  800e3b:	e8 b7 02 00 00       	call   8010f7 <nsipc_close>
+  800e40:	83 c4 10             	add    $0x10,%esp
+  800e43:	eb eb                	jmp    800e30 <devsock_close+0x1f>
+
+00800e45 <devsock_write>:
+{
+  800e45:	55                   	push   %ebp
+  800e46:	89 e5                	mov    %esp,%ebp
+  800e48:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800e4b:	6a 00                	push   $0x0
+  800e4d:	ff 75 10             	push   0x10(%ebp)
+  800e50:	ff 75 0c             	push   0xc(%ebp)
+  800e53:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e56:	ff 70 0c             	push   0xc(%eax)
+  800e59:	e8 79 03 00 00       	call   8011d7 <nsipc_send>
+}
+  800e5e:	c9                   	leave
+  800e5f:	c3                   	ret
+
+00800e60 <devsock_read>:
+{
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800e66:	6a 00                	push   $0x0
+  800e68:	ff 75 10             	push   0x10(%ebp)
+  800e6b:	ff 75 0c             	push   0xc(%ebp)
+  800e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e71:	ff 70 0c             	push   0xc(%eax)
+  800e74:	e8 ef 02 00 00       	call   801168 <nsipc_recv>
+}
+  800e79:	c9                   	leave
+  800e7a:	c3                   	ret
+
+00800e7b <fd2sockid>:
+{
+  800e7b:	55                   	push   %ebp
+  800e7c:	89 e5                	mov    %esp,%ebp
+  800e7e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800e81:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800e84:	52                   	push   %edx
+  800e85:	50                   	push   %eax
+  800e86:	e8 fe f7 ff ff       	call   800689 <fd_lookup>
+  800e8b:	83 c4 10             	add    $0x10,%esp
+  800e8e:	85 c0                	test   %eax,%eax
+  800e90:	78 10                	js     800ea2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800e92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e95:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800e9b:	39 08                	cmp    %ecx,(%eax)
+  800e9d:	75 05                	jne    800ea4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800e9f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800ea2:	c9                   	leave
+  800ea3:	c3                   	ret
+		return -E_NOT_SUPP;
+  800ea4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ea9:	eb f7                	jmp    800ea2 <fd2sockid+0x27>
+
+00800eab <alloc_sockfd>:
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	56                   	push   %esi
+  800eaf:	53                   	push   %ebx
+  800eb0:	83 ec 1c             	sub    $0x1c,%esp
+  800eb3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800eb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800eb8:	50                   	push   %eax
+  800eb9:	e8 75 f7 ff ff       	call   800633 <fd_alloc>
+  800ebe:	89 c3                	mov    %eax,%ebx
+  800ec0:	83 c4 10             	add    $0x10,%esp
+  800ec3:	85 c0                	test   %eax,%eax
+  800ec5:	78 43                	js     800f0a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800ec7:	83 ec 04             	sub    $0x4,%esp
+  800eca:	68 07 04 00 00       	push   $0x407
+  800ecf:	ff 75 f4             	push   -0xc(%ebp)
+  800ed2:	6a 00                	push   $0x0
+  800ed4:	e8 0e f3 ff ff       	call   8001e7 <sys_page_alloc>
+  800ed9:	89 c3                	mov    %eax,%ebx
+  800edb:	83 c4 10             	add    $0x10,%esp
+  800ede:	85 c0                	test   %eax,%eax
+  800ee0:	78 28                	js     800f0a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800ee2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ee5:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800eeb:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800eed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ef0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800ef7:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800efa:	83 ec 0c             	sub    $0xc,%esp
+  800efd:	50                   	push   %eax
+  800efe:	e8 09 f7 ff ff       	call   80060c <fd2num>
+  800f03:	89 c3                	mov    %eax,%ebx
+  800f05:	83 c4 10             	add    $0x10,%esp
+  800f08:	eb 0c                	jmp    800f16 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800f0a:	83 ec 0c             	sub    $0xc,%esp
+  800f0d:	56                   	push   %esi
+  800f0e:	e8 e4 01 00 00       	call   8010f7 <nsipc_close>
+		return r;
+  800f13:	83 c4 10             	add    $0x10,%esp
+}
+  800f16:	89 d8                	mov    %ebx,%eax
+  800f18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f1b:	5b                   	pop    %ebx
+  800f1c:	5e                   	pop    %esi
+  800f1d:	5d                   	pop    %ebp
+  800f1e:	c3                   	ret
+
+00800f1f <accept>:
+{
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f25:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f28:	e8 4e ff ff ff       	call   800e7b <fd2sockid>
+  800f2d:	85 c0                	test   %eax,%eax
+  800f2f:	78 1b                	js     800f4c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800f31:	83 ec 04             	sub    $0x4,%esp
+  800f34:	ff 75 10             	push   0x10(%ebp)
+  800f37:	ff 75 0c             	push   0xc(%ebp)
+  800f3a:	50                   	push   %eax
+  800f3b:	e8 0e 01 00 00       	call   80104e <nsipc_accept>
+  800f40:	83 c4 10             	add    $0x10,%esp
+  800f43:	85 c0                	test   %eax,%eax
+  800f45:	78 05                	js     800f4c <accept+0x2d>
+	return alloc_sockfd(r);
+  800f47:	e8 5f ff ff ff       	call   800eab <alloc_sockfd>
+}
+  800f4c:	c9                   	leave
+  800f4d:	c3                   	ret
+
+00800f4e <bind>:
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f57:	e8 1f ff ff ff       	call   800e7b <fd2sockid>
+  800f5c:	85 c0                	test   %eax,%eax
+  800f5e:	78 12                	js     800f72 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800f60:	83 ec 04             	sub    $0x4,%esp
+  800f63:	ff 75 10             	push   0x10(%ebp)
+  800f66:	ff 75 0c             	push   0xc(%ebp)
+  800f69:	50                   	push   %eax
+  800f6a:	e8 31 01 00 00       	call   8010a0 <nsipc_bind>
+  800f6f:	83 c4 10             	add    $0x10,%esp
+}
+  800f72:	c9                   	leave
+  800f73:	c3                   	ret
+
+00800f74 <shutdown>:
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7d:	e8 f9 fe ff ff       	call   800e7b <fd2sockid>
+  800f82:	85 c0                	test   %eax,%eax
+  800f84:	78 0f                	js     800f95 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800f86:	83 ec 08             	sub    $0x8,%esp
+  800f89:	ff 75 0c             	push   0xc(%ebp)
+  800f8c:	50                   	push   %eax
+  800f8d:	e8 43 01 00 00       	call   8010d5 <nsipc_shutdown>
+  800f92:	83 c4 10             	add    $0x10,%esp
+}
+  800f95:	c9                   	leave
+  800f96:	c3                   	ret
+
+00800f97 <connect>:
+{
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa0:	e8 d6 fe ff ff       	call   800e7b <fd2sockid>
+  800fa5:	85 c0                	test   %eax,%eax
+  800fa7:	78 12                	js     800fbb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800fa9:	83 ec 04             	sub    $0x4,%esp
+  800fac:	ff 75 10             	push   0x10(%ebp)
+  800faf:	ff 75 0c             	push   0xc(%ebp)
+  800fb2:	50                   	push   %eax
+  800fb3:	e8 59 01 00 00       	call   801111 <nsipc_connect>
+  800fb8:	83 c4 10             	add    $0x10,%esp
+}
+  800fbb:	c9                   	leave
+  800fbc:	c3                   	ret
+
+00800fbd <listen>:
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800fc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fc6:	e8 b0 fe ff ff       	call   800e7b <fd2sockid>
+  800fcb:	85 c0                	test   %eax,%eax
+  800fcd:	78 0f                	js     800fde <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800fcf:	83 ec 08             	sub    $0x8,%esp
+  800fd2:	ff 75 0c             	push   0xc(%ebp)
+  800fd5:	50                   	push   %eax
+  800fd6:	e8 6b 01 00 00       	call   801146 <nsipc_listen>
+  800fdb:	83 c4 10             	add    $0x10,%esp
+}
+  800fde:	c9                   	leave
+  800fdf:	c3                   	ret
+
+00800fe0 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800fe0:	55                   	push   %ebp
+  800fe1:	89 e5                	mov    %esp,%ebp
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800fe6:	ff 75 10             	push   0x10(%ebp)
+  800fe9:	ff 75 0c             	push   0xc(%ebp)
+  800fec:	ff 75 08             	push   0x8(%ebp)
+  800fef:	e8 41 02 00 00       	call   801235 <nsipc_socket>
+  800ff4:	83 c4 10             	add    $0x10,%esp
+  800ff7:	85 c0                	test   %eax,%eax
+  800ff9:	78 05                	js     801000 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800ffb:	e8 ab fe ff ff       	call   800eab <alloc_sockfd>
+}
+  801000:	c9                   	leave
+  801001:	c3                   	ret
+
+00801002 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801002:	55                   	push   %ebp
+  801003:	89 e5                	mov    %esp,%ebp
+  801005:	53                   	push   %ebx
+  801006:	83 ec 04             	sub    $0x4,%esp
+  801009:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80100b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801012:	74 26                	je     80103a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801014:	6a 07                	push   $0x7
+  801016:	68 00 60 80 00       	push   $0x806000
+  80101b:	53                   	push   %ebx
+  80101c:	ff 35 04 40 80 00    	push   0x804004
+  801022:	e8 67 11 00 00       	call   80218e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801027:	83 c4 0c             	add    $0xc,%esp
+  80102a:	6a 00                	push   $0x0
+  80102c:	6a 00                	push   $0x0
+  80102e:	6a 00                	push   $0x0
+  801030:	e8 e1 10 00 00       	call   802116 <ipc_recv>
+}
+  801035:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801038:	c9                   	leave
+  801039:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80103a:	83 ec 0c             	sub    $0xc,%esp
+  80103d:	6a 02                	push   $0x2
+  80103f:	e8 9e 11 00 00       	call   8021e2 <ipc_find_env>
+  801044:	a3 04 40 80 00       	mov    %eax,0x804004
+  801049:	83 c4 10             	add    $0x10,%esp
+  80104c:	eb c6                	jmp    801014 <nsipc+0x12>
+
+0080104e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80104e:	55                   	push   %ebp
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	56                   	push   %esi
+  801052:	53                   	push   %ebx
+  801053:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801056:	8b 45 08             	mov    0x8(%ebp),%eax
+  801059:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80105e:	8b 06                	mov    (%esi),%eax
+  801060:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801065:	b8 01 00 00 00       	mov    $0x1,%eax
+  80106a:	e8 93 ff ff ff       	call   801002 <nsipc>
+  80106f:	89 c3                	mov    %eax,%ebx
+  801071:	85 c0                	test   %eax,%eax
+  801073:	79 09                	jns    80107e <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801075:	89 d8                	mov    %ebx,%eax
+  801077:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80107a:	5b                   	pop    %ebx
+  80107b:	5e                   	pop    %esi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80107e:	83 ec 04             	sub    $0x4,%esp
+  801081:	ff 35 10 60 80 00    	push   0x806010
+  801087:	68 00 60 80 00       	push   $0x806000
+  80108c:	ff 75 0c             	push   0xc(%ebp)
+  80108f:	e8 d8 0e 00 00       	call   801f6c <memmove>
+		*addrlen = ret->ret_addrlen;
+  801094:	a1 10 60 80 00       	mov    0x806010,%eax
+  801099:	89 06                	mov    %eax,(%esi)
+  80109b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80109e:	eb d5                	jmp    801075 <nsipc_accept+0x27>
+
+008010a0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	53                   	push   %ebx
+  8010a4:	83 ec 08             	sub    $0x8,%esp
+  8010a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8010aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ad:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8010b2:	53                   	push   %ebx
+  8010b3:	ff 75 0c             	push   0xc(%ebp)
+  8010b6:	68 04 60 80 00       	push   $0x806004
+  8010bb:	e8 ac 0e 00 00       	call   801f6c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8010c0:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8010c6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010cb:	e8 32 ff ff ff       	call   801002 <nsipc>
+}
+  8010d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010d3:	c9                   	leave
+  8010d4:	c3                   	ret
+
+008010d5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8010d5:	55                   	push   %ebp
+  8010d6:	89 e5                	mov    %esp,%ebp
+  8010d8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8010db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010de:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8010e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010e6:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8010eb:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010f0:	e8 0d ff ff ff       	call   801002 <nsipc>
+}
+  8010f5:	c9                   	leave
+  8010f6:	c3                   	ret
+
+008010f7 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8010fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801100:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801105:	b8 04 00 00 00       	mov    $0x4,%eax
+  80110a:	e8 f3 fe ff ff       	call   801002 <nsipc>
+}
+  80110f:	c9                   	leave
+  801110:	c3                   	ret
+
+00801111 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+  801114:	53                   	push   %ebx
+  801115:	83 ec 08             	sub    $0x8,%esp
+  801118:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80111b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80111e:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801123:	53                   	push   %ebx
+  801124:	ff 75 0c             	push   0xc(%ebp)
+  801127:	68 04 60 80 00       	push   $0x806004
+  80112c:	e8 3b 0e 00 00       	call   801f6c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801131:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801137:	b8 05 00 00 00       	mov    $0x5,%eax
+  80113c:	e8 c1 fe ff ff       	call   801002 <nsipc>
+}
+  801141:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801144:	c9                   	leave
+  801145:	c3                   	ret
+
+00801146 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+  801149:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80114c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80114f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801154:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801157:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  80115c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801161:	e8 9c fe ff ff       	call   801002 <nsipc>
+}
+  801166:	c9                   	leave
+  801167:	c3                   	ret
+
+00801168 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801168:	55                   	push   %ebp
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	56                   	push   %esi
+  80116c:	53                   	push   %ebx
+  80116d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801170:	8b 45 08             	mov    0x8(%ebp),%eax
+  801173:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801178:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  80117e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801181:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801186:	b8 07 00 00 00       	mov    $0x7,%eax
+  80118b:	e8 72 fe ff ff       	call   801002 <nsipc>
+  801190:	89 c3                	mov    %eax,%ebx
+  801192:	85 c0                	test   %eax,%eax
+  801194:	78 22                	js     8011b8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801196:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80119b:	39 c6                	cmp    %eax,%esi
+  80119d:	0f 4e c6             	cmovle %esi,%eax
+  8011a0:	39 c3                	cmp    %eax,%ebx
+  8011a2:	7f 1d                	jg     8011c1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8011a4:	83 ec 04             	sub    $0x4,%esp
+  8011a7:	53                   	push   %ebx
+  8011a8:	68 00 60 80 00       	push   $0x806000
+  8011ad:	ff 75 0c             	push   0xc(%ebp)
+  8011b0:	e8 b7 0d 00 00       	call   801f6c <memmove>
+  8011b5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8011b8:	89 d8                	mov    %ebx,%eax
+  8011ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011bd:	5b                   	pop    %ebx
+  8011be:	5e                   	pop    %esi
+  8011bf:	5d                   	pop    %ebp
+  8011c0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8011c1:	68 8b 27 80 00       	push   $0x80278b
+  8011c6:	68 53 27 80 00       	push   $0x802753
+  8011cb:	6a 62                	push   $0x62
+  8011cd:	68 a0 27 80 00       	push   $0x8027a0
+  8011d2:	e8 46 05 00 00       	call   80171d <_panic>
+
+008011d7 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+  8011da:	53                   	push   %ebx
+  8011db:	83 ec 04             	sub    $0x4,%esp
+  8011de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8011e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e4:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  8011e9:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8011ef:	7f 2e                	jg     80121f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8011f1:	83 ec 04             	sub    $0x4,%esp
+  8011f4:	53                   	push   %ebx
+  8011f5:	ff 75 0c             	push   0xc(%ebp)
+  8011f8:	68 0c 60 80 00       	push   $0x80600c
+  8011fd:	e8 6a 0d 00 00       	call   801f6c <memmove>
+	nsipcbuf.send.req_size = size;
+  801202:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801208:	8b 45 14             	mov    0x14(%ebp),%eax
+  80120b:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801210:	b8 08 00 00 00       	mov    $0x8,%eax
+  801215:	e8 e8 fd ff ff       	call   801002 <nsipc>
+}
+  80121a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80121d:	c9                   	leave
+  80121e:	c3                   	ret
+	assert(size < 1600);
+  80121f:	68 ac 27 80 00       	push   $0x8027ac
+  801224:	68 53 27 80 00       	push   $0x802753
+  801229:	6a 6d                	push   $0x6d
+  80122b:	68 a0 27 80 00       	push   $0x8027a0
+  801230:	e8 e8 04 00 00       	call   80171d <_panic>
+
+00801235 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80123b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80123e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801243:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801246:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  80124b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80124e:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801253:	b8 09 00 00 00       	mov    $0x9,%eax
+  801258:	e8 a5 fd ff ff       	call   801002 <nsipc>
+}
+  80125d:	c9                   	leave
+  80125e:	c3                   	ret
+
+0080125f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80125f:	55                   	push   %ebp
+  801260:	89 e5                	mov    %esp,%ebp
+  801262:	56                   	push   %esi
+  801263:	53                   	push   %ebx
+  801264:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801267:	83 ec 0c             	sub    $0xc,%esp
+  80126a:	ff 75 08             	push   0x8(%ebp)
+  80126d:	e8 aa f3 ff ff       	call   80061c <fd2data>
+  801272:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801274:	83 c4 08             	add    $0x8,%esp
+  801277:	68 b8 27 80 00       	push   $0x8027b8
+  80127c:	53                   	push   %ebx
+  80127d:	e8 64 0b 00 00       	call   801de6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801282:	8b 46 04             	mov    0x4(%esi),%eax
+  801285:	2b 06                	sub    (%esi),%eax
+  801287:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80128d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801294:	00 00 00 
+	stat->st_dev = &devpipe;
+  801297:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  80129e:	30 80 00 
+	return 0;
+}
+  8012a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012a9:	5b                   	pop    %ebx
+  8012aa:	5e                   	pop    %esi
+  8012ab:	5d                   	pop    %ebp
+  8012ac:	c3                   	ret
+
+008012ad <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8012ad:	55                   	push   %ebp
+  8012ae:	89 e5                	mov    %esp,%ebp
+  8012b0:	53                   	push   %ebx
+  8012b1:	83 ec 0c             	sub    $0xc,%esp
+  8012b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8012b7:	53                   	push   %ebx
+  8012b8:	6a 00                	push   $0x0
+  8012ba:	e8 f0 ef ff ff       	call   8002af <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8012bf:	89 1c 24             	mov    %ebx,(%esp)
+  8012c2:	e8 55 f3 ff ff       	call   80061c <fd2data>
+  8012c7:	83 c4 08             	add    $0x8,%esp
+  8012ca:	50                   	push   %eax
+  8012cb:	6a 00                	push   $0x0
+  8012cd:	e8 dd ef ff ff       	call   8002af <sys_page_unmap>
+}
+  8012d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012d5:	c9                   	leave
+  8012d6:	c3                   	ret
+
+008012d7 <_pipeisclosed>:
+{
+  8012d7:	55                   	push   %ebp
+  8012d8:	89 e5                	mov    %esp,%ebp
+  8012da:	57                   	push   %edi
+  8012db:	56                   	push   %esi
+  8012dc:	53                   	push   %ebx
+  8012dd:	83 ec 1c             	sub    $0x1c,%esp
+  8012e0:	89 c7                	mov    %eax,%edi
+  8012e2:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8012e4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012e9:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8012ec:	83 ec 0c             	sub    $0xc,%esp
+  8012ef:	57                   	push   %edi
+  8012f0:	e8 fd 0e 00 00       	call   8021f2 <pageref>
+  8012f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012f8:	89 34 24             	mov    %esi,(%esp)
+  8012fb:	e8 f2 0e 00 00       	call   8021f2 <pageref>
+		nn = thisenv->env_runs;
+  801300:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801306:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801309:	83 c4 10             	add    $0x10,%esp
+  80130c:	39 cb                	cmp    %ecx,%ebx
+  80130e:	74 1b                	je     80132b <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801310:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801313:	75 cf                	jne    8012e4 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801315:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801318:	6a 01                	push   $0x1
+  80131a:	50                   	push   %eax
+  80131b:	53                   	push   %ebx
+  80131c:	68 bf 27 80 00       	push   $0x8027bf
+  801321:	e8 d2 04 00 00       	call   8017f8 <cprintf>
+  801326:	83 c4 10             	add    $0x10,%esp
+  801329:	eb b9                	jmp    8012e4 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80132b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80132e:	0f 94 c0             	sete   %al
+  801331:	0f b6 c0             	movzbl %al,%eax
+}
+  801334:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801337:	5b                   	pop    %ebx
+  801338:	5e                   	pop    %esi
+  801339:	5f                   	pop    %edi
+  80133a:	5d                   	pop    %ebp
+  80133b:	c3                   	ret
+
+0080133c <devpipe_write>:
+{
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	57                   	push   %edi
+  801340:	56                   	push   %esi
+  801341:	53                   	push   %ebx
+  801342:	83 ec 28             	sub    $0x28,%esp
+  801345:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801348:	56                   	push   %esi
+  801349:	e8 ce f2 ff ff       	call   80061c <fd2data>
+  80134e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801350:	83 c4 10             	add    $0x10,%esp
+  801353:	bf 00 00 00 00       	mov    $0x0,%edi
+  801358:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80135b:	75 09                	jne    801366 <devpipe_write+0x2a>
+	return i;
+  80135d:	89 f8                	mov    %edi,%eax
+  80135f:	eb 23                	jmp    801384 <devpipe_write+0x48>
+			sys_yield();
+  801361:	e8 01 ee ff ff       	call   800167 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801366:	8b 43 04             	mov    0x4(%ebx),%eax
+  801369:	8b 0b                	mov    (%ebx),%ecx
+  80136b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80136e:	39 d0                	cmp    %edx,%eax
+  801370:	72 1a                	jb     80138c <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801372:	89 da                	mov    %ebx,%edx
+  801374:	89 f0                	mov    %esi,%eax
+  801376:	e8 5c ff ff ff       	call   8012d7 <_pipeisclosed>
+  80137b:	85 c0                	test   %eax,%eax
+  80137d:	74 e2                	je     801361 <devpipe_write+0x25>
+				return 0;
+  80137f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801387:	5b                   	pop    %ebx
+  801388:	5e                   	pop    %esi
+  801389:	5f                   	pop    %edi
+  80138a:	5d                   	pop    %ebp
+  80138b:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80138c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801393:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801396:	89 c2                	mov    %eax,%edx
+  801398:	c1 fa 1f             	sar    $0x1f,%edx
+  80139b:	89 d1                	mov    %edx,%ecx
+  80139d:	c1 e9 1b             	shr    $0x1b,%ecx
+  8013a0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8013a3:	83 e2 1f             	and    $0x1f,%edx
+  8013a6:	29 ca                	sub    %ecx,%edx
+  8013a8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8013ac:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8013b0:	83 c0 01             	add    $0x1,%eax
+  8013b3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8013b6:	83 c7 01             	add    $0x1,%edi
+  8013b9:	eb 9d                	jmp    801358 <devpipe_write+0x1c>
+
+008013bb <devpipe_read>:
+{
+  8013bb:	55                   	push   %ebp
+  8013bc:	89 e5                	mov    %esp,%ebp
+  8013be:	57                   	push   %edi
+  8013bf:	56                   	push   %esi
+  8013c0:	53                   	push   %ebx
+  8013c1:	83 ec 18             	sub    $0x18,%esp
+  8013c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8013c7:	57                   	push   %edi
+  8013c8:	e8 4f f2 ff ff       	call   80061c <fd2data>
+  8013cd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8013cf:	83 c4 10             	add    $0x10,%esp
+  8013d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8013da:	75 13                	jne    8013ef <devpipe_read+0x34>
+	return i;
+  8013dc:	89 f0                	mov    %esi,%eax
+  8013de:	eb 02                	jmp    8013e2 <devpipe_read+0x27>
+				return i;
+  8013e0:	89 f0                	mov    %esi,%eax
+}
+  8013e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e5:	5b                   	pop    %ebx
+  8013e6:	5e                   	pop    %esi
+  8013e7:	5f                   	pop    %edi
+  8013e8:	5d                   	pop    %ebp
+  8013e9:	c3                   	ret
+			sys_yield();
+  8013ea:	e8 78 ed ff ff       	call   800167 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8013ef:	8b 03                	mov    (%ebx),%eax
+  8013f1:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8013f4:	75 18                	jne    80140e <devpipe_read+0x53>
+			if (i > 0)
+  8013f6:	85 f6                	test   %esi,%esi
+  8013f8:	75 e6                	jne    8013e0 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8013fa:	89 da                	mov    %ebx,%edx
+  8013fc:	89 f8                	mov    %edi,%eax
+  8013fe:	e8 d4 fe ff ff       	call   8012d7 <_pipeisclosed>
+  801403:	85 c0                	test   %eax,%eax
+  801405:	74 e3                	je     8013ea <devpipe_read+0x2f>
+				return 0;
+  801407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140c:	eb d4                	jmp    8013e2 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80140e:	99                   	cltd
+  80140f:	c1 ea 1b             	shr    $0x1b,%edx
+  801412:	01 d0                	add    %edx,%eax
+  801414:	83 e0 1f             	and    $0x1f,%eax
+  801417:	29 d0                	sub    %edx,%eax
+  801419:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80141e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801421:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801424:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801427:	83 c6 01             	add    $0x1,%esi
+  80142a:	eb ab                	jmp    8013d7 <devpipe_read+0x1c>
+
+0080142c <pipe>:
+{
+  80142c:	55                   	push   %ebp
+  80142d:	89 e5                	mov    %esp,%ebp
+  80142f:	56                   	push   %esi
+  801430:	53                   	push   %ebx
+  801431:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801434:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801437:	50                   	push   %eax
+  801438:	e8 f6 f1 ff ff       	call   800633 <fd_alloc>
+  80143d:	89 c3                	mov    %eax,%ebx
+  80143f:	83 c4 10             	add    $0x10,%esp
+  801442:	85 c0                	test   %eax,%eax
+  801444:	0f 88 23 01 00 00    	js     80156d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80144a:	83 ec 04             	sub    $0x4,%esp
+  80144d:	68 07 04 00 00       	push   $0x407
+  801452:	ff 75 f4             	push   -0xc(%ebp)
+  801455:	6a 00                	push   $0x0
+  801457:	e8 8b ed ff ff       	call   8001e7 <sys_page_alloc>
+  80145c:	89 c3                	mov    %eax,%ebx
+  80145e:	83 c4 10             	add    $0x10,%esp
+  801461:	85 c0                	test   %eax,%eax
+  801463:	0f 88 04 01 00 00    	js     80156d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801469:	83 ec 0c             	sub    $0xc,%esp
+  80146c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80146f:	50                   	push   %eax
+  801470:	e8 be f1 ff ff       	call   800633 <fd_alloc>
+  801475:	89 c3                	mov    %eax,%ebx
+  801477:	83 c4 10             	add    $0x10,%esp
+  80147a:	85 c0                	test   %eax,%eax
+  80147c:	0f 88 db 00 00 00    	js     80155d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801482:	83 ec 04             	sub    $0x4,%esp
+  801485:	68 07 04 00 00       	push   $0x407
+  80148a:	ff 75 f0             	push   -0x10(%ebp)
+  80148d:	6a 00                	push   $0x0
+  80148f:	e8 53 ed ff ff       	call   8001e7 <sys_page_alloc>
+  801494:	89 c3                	mov    %eax,%ebx
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	85 c0                	test   %eax,%eax
+  80149b:	0f 88 bc 00 00 00    	js     80155d <pipe+0x131>
+	va = fd2data(fd0);
+  8014a1:	83 ec 0c             	sub    $0xc,%esp
+  8014a4:	ff 75 f4             	push   -0xc(%ebp)
+  8014a7:	e8 70 f1 ff ff       	call   80061c <fd2data>
+  8014ac:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014ae:	83 c4 0c             	add    $0xc,%esp
+  8014b1:	68 07 04 00 00       	push   $0x407
+  8014b6:	50                   	push   %eax
+  8014b7:	6a 00                	push   $0x0
+  8014b9:	e8 29 ed ff ff       	call   8001e7 <sys_page_alloc>
+  8014be:	89 c3                	mov    %eax,%ebx
+  8014c0:	83 c4 10             	add    $0x10,%esp
+  8014c3:	85 c0                	test   %eax,%eax
+  8014c5:	0f 88 82 00 00 00    	js     80154d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014cb:	83 ec 0c             	sub    $0xc,%esp
+  8014ce:	ff 75 f0             	push   -0x10(%ebp)
+  8014d1:	e8 46 f1 ff ff       	call   80061c <fd2data>
+  8014d6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014dd:	50                   	push   %eax
+  8014de:	6a 00                	push   $0x0
+  8014e0:	56                   	push   %esi
+  8014e1:	6a 00                	push   $0x0
+  8014e3:	e8 85 ed ff ff       	call   80026d <sys_page_map>
+  8014e8:	89 c3                	mov    %eax,%ebx
+  8014ea:	83 c4 20             	add    $0x20,%esp
+  8014ed:	85 c0                	test   %eax,%eax
+  8014ef:	78 4e                	js     80153f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014f1:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8014f6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014f9:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014fb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014fe:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801505:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801508:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80150a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80150d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801514:	83 ec 0c             	sub    $0xc,%esp
+  801517:	ff 75 f4             	push   -0xc(%ebp)
+  80151a:	e8 ed f0 ff ff       	call   80060c <fd2num>
+  80151f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801522:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801524:	83 c4 04             	add    $0x4,%esp
+  801527:	ff 75 f0             	push   -0x10(%ebp)
+  80152a:	e8 dd f0 ff ff       	call   80060c <fd2num>
+  80152f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801532:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801535:	83 c4 10             	add    $0x10,%esp
+  801538:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153d:	eb 2e                	jmp    80156d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80153f:	83 ec 08             	sub    $0x8,%esp
+  801542:	56                   	push   %esi
+  801543:	6a 00                	push   $0x0
+  801545:	e8 65 ed ff ff       	call   8002af <sys_page_unmap>
+  80154a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80154d:	83 ec 08             	sub    $0x8,%esp
+  801550:	ff 75 f0             	push   -0x10(%ebp)
+  801553:	6a 00                	push   $0x0
+  801555:	e8 55 ed ff ff       	call   8002af <sys_page_unmap>
+  80155a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80155d:	83 ec 08             	sub    $0x8,%esp
+  801560:	ff 75 f4             	push   -0xc(%ebp)
+  801563:	6a 00                	push   $0x0
+  801565:	e8 45 ed ff ff       	call   8002af <sys_page_unmap>
+  80156a:	83 c4 10             	add    $0x10,%esp
+}
+  80156d:	89 d8                	mov    %ebx,%eax
+  80156f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801572:	5b                   	pop    %ebx
+  801573:	5e                   	pop    %esi
+  801574:	5d                   	pop    %ebp
+  801575:	c3                   	ret
+
+00801576 <pipeisclosed>:
+{
+  801576:	55                   	push   %ebp
+  801577:	89 e5                	mov    %esp,%ebp
+  801579:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80157c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80157f:	50                   	push   %eax
+  801580:	ff 75 08             	push   0x8(%ebp)
+  801583:	e8 01 f1 ff ff       	call   800689 <fd_lookup>
+  801588:	83 c4 10             	add    $0x10,%esp
+  80158b:	85 c0                	test   %eax,%eax
+  80158d:	78 18                	js     8015a7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80158f:	83 ec 0c             	sub    $0xc,%esp
+  801592:	ff 75 f4             	push   -0xc(%ebp)
+  801595:	e8 82 f0 ff ff       	call   80061c <fd2data>
+  80159a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80159c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80159f:	e8 33 fd ff ff       	call   8012d7 <_pipeisclosed>
+  8015a4:	83 c4 10             	add    $0x10,%esp
+}
+  8015a7:	c9                   	leave
+  8015a8:	c3                   	ret
+
+008015a9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8015a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ae:	c3                   	ret
+
+008015af <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015af:	55                   	push   %ebp
+  8015b0:	89 e5                	mov    %esp,%ebp
+  8015b2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015b5:	68 d7 27 80 00       	push   $0x8027d7
+  8015ba:	ff 75 0c             	push   0xc(%ebp)
+  8015bd:	e8 24 08 00 00       	call   801de6 <strcpy>
+	return 0;
+}
+  8015c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c7:	c9                   	leave
+  8015c8:	c3                   	ret
+
+008015c9 <devcons_write>:
+{
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	57                   	push   %edi
+  8015cd:	56                   	push   %esi
+  8015ce:	53                   	push   %ebx
+  8015cf:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015d5:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015da:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015e0:	eb 2e                	jmp    801610 <devcons_write+0x47>
+		m = n - tot;
+  8015e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e5:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015e7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015ec:	39 c3                	cmp    %eax,%ebx
+  8015ee:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015f1:	83 ec 04             	sub    $0x4,%esp
+  8015f4:	53                   	push   %ebx
+  8015f5:	89 f0                	mov    %esi,%eax
+  8015f7:	03 45 0c             	add    0xc(%ebp),%eax
+  8015fa:	50                   	push   %eax
+  8015fb:	57                   	push   %edi
+  8015fc:	e8 6b 09 00 00       	call   801f6c <memmove>
+		sys_cputs(buf, m);
+  801601:	83 c4 08             	add    $0x8,%esp
+  801604:	53                   	push   %ebx
+  801605:	57                   	push   %edi
+  801606:	e8 9f ea ff ff       	call   8000aa <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80160b:	01 de                	add    %ebx,%esi
+  80160d:	83 c4 10             	add    $0x10,%esp
+  801610:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801613:	72 cd                	jb     8015e2 <devcons_write+0x19>
+}
+  801615:	89 f0                	mov    %esi,%eax
+  801617:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161a:	5b                   	pop    %ebx
+  80161b:	5e                   	pop    %esi
+  80161c:	5f                   	pop    %edi
+  80161d:	5d                   	pop    %ebp
+  80161e:	c3                   	ret
+
+0080161f <devcons_read>:
+{
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80162e:	75 07                	jne    801637 <devcons_read+0x18>
+  801630:	eb 1f                	jmp    801651 <devcons_read+0x32>
+		sys_yield();
+  801632:	e8 30 eb ff ff       	call   800167 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801637:	e8 8c ea ff ff       	call   8000c8 <sys_cgetc>
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	74 f2                	je     801632 <devcons_read+0x13>
+	if (c < 0)
+  801640:	78 0f                	js     801651 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801642:	83 f8 04             	cmp    $0x4,%eax
+  801645:	74 0c                	je     801653 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801647:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80164a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80164c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801651:	c9                   	leave
+  801652:	c3                   	ret
+		return 0;
+  801653:	b8 00 00 00 00       	mov    $0x0,%eax
+  801658:	eb f7                	jmp    801651 <devcons_read+0x32>
+
+0080165a <cputchar>:
+{
+  80165a:	55                   	push   %ebp
+  80165b:	89 e5                	mov    %esp,%ebp
+  80165d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801660:	8b 45 08             	mov    0x8(%ebp),%eax
+  801663:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801666:	6a 01                	push   $0x1
+  801668:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80166b:	50                   	push   %eax
+  80166c:	e8 39 ea ff ff       	call   8000aa <sys_cputs>
+}
+  801671:	83 c4 10             	add    $0x10,%esp
+  801674:	c9                   	leave
+  801675:	c3                   	ret
+
+00801676 <getchar>:
+{
+  801676:	55                   	push   %ebp
+  801677:	89 e5                	mov    %esp,%ebp
+  801679:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80167c:	6a 01                	push   $0x1
+  80167e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801681:	50                   	push   %eax
+  801682:	6a 00                	push   $0x0
+  801684:	e8 66 f2 ff ff       	call   8008ef <read>
+	if (r < 0)
+  801689:	83 c4 10             	add    $0x10,%esp
+  80168c:	85 c0                	test   %eax,%eax
+  80168e:	78 06                	js     801696 <getchar+0x20>
+	if (r < 1)
+  801690:	74 06                	je     801698 <getchar+0x22>
+	return c;
+  801692:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801696:	c9                   	leave
+  801697:	c3                   	ret
+		return -E_EOF;
+  801698:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80169d:	eb f7                	jmp    801696 <getchar+0x20>
+
+0080169f <iscons>:
+{
+  80169f:	55                   	push   %ebp
+  8016a0:	89 e5                	mov    %esp,%ebp
+  8016a2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016a8:	50                   	push   %eax
+  8016a9:	ff 75 08             	push   0x8(%ebp)
+  8016ac:	e8 d8 ef ff ff       	call   800689 <fd_lookup>
+  8016b1:	83 c4 10             	add    $0x10,%esp
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	78 11                	js     8016c9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016bb:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8016c1:	39 10                	cmp    %edx,(%eax)
+  8016c3:	0f 94 c0             	sete   %al
+  8016c6:	0f b6 c0             	movzbl %al,%eax
+}
+  8016c9:	c9                   	leave
+  8016ca:	c3                   	ret
+
+008016cb <opencons>:
+{
+  8016cb:	55                   	push   %ebp
+  8016cc:	89 e5                	mov    %esp,%ebp
+  8016ce:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d4:	50                   	push   %eax
+  8016d5:	e8 59 ef ff ff       	call   800633 <fd_alloc>
+  8016da:	83 c4 10             	add    $0x10,%esp
+  8016dd:	85 c0                	test   %eax,%eax
+  8016df:	78 3a                	js     80171b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016e1:	83 ec 04             	sub    $0x4,%esp
+  8016e4:	68 07 04 00 00       	push   $0x407
+  8016e9:	ff 75 f4             	push   -0xc(%ebp)
+  8016ec:	6a 00                	push   $0x0
+  8016ee:	e8 f4 ea ff ff       	call   8001e7 <sys_page_alloc>
+  8016f3:	83 c4 10             	add    $0x10,%esp
+  8016f6:	85 c0                	test   %eax,%eax
+  8016f8:	78 21                	js     80171b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016fd:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801703:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801705:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801708:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80170f:	83 ec 0c             	sub    $0xc,%esp
+  801712:	50                   	push   %eax
+  801713:	e8 f4 ee ff ff       	call   80060c <fd2num>
+  801718:	83 c4 10             	add    $0x10,%esp
+}
+  80171b:	c9                   	leave
+  80171c:	c3                   	ret
+
+0080171d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80171d:	55                   	push   %ebp
+  80171e:	89 e5                	mov    %esp,%ebp
+  801720:	56                   	push   %esi
+  801721:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801722:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801725:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80172b:	e8 18 ea ff ff       	call   800148 <sys_getenvid>
+  801730:	83 ec 0c             	sub    $0xc,%esp
+  801733:	ff 75 0c             	push   0xc(%ebp)
+  801736:	ff 75 08             	push   0x8(%ebp)
+  801739:	56                   	push   %esi
+  80173a:	50                   	push   %eax
+  80173b:	68 e4 27 80 00       	push   $0x8027e4
+  801740:	e8 b3 00 00 00       	call   8017f8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801745:	83 c4 18             	add    $0x18,%esp
+  801748:	53                   	push   %ebx
+  801749:	ff 75 10             	push   0x10(%ebp)
+  80174c:	e8 56 00 00 00       	call   8017a7 <vcprintf>
+	cprintf("\n");
+  801751:	c7 04 24 d0 27 80 00 	movl   $0x8027d0,(%esp)
+  801758:	e8 9b 00 00 00       	call   8017f8 <cprintf>
+  80175d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801760:	cc                   	int3
+	while (1)
+  801761:	eb fd                	jmp    801760 <_panic+0x43>
+
+00801763 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801763:	55                   	push   %ebp
+  801764:	89 e5                	mov    %esp,%ebp
+  801766:	53                   	push   %ebx
+  801767:	83 ec 04             	sub    $0x4,%esp
+  80176a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80176d:	8b 13                	mov    (%ebx),%edx
+  80176f:	8d 42 01             	lea    0x1(%edx),%eax
+  801772:	89 03                	mov    %eax,(%ebx)
+  801774:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801777:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80177b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801780:	74 09                	je     80178b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801782:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801786:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801789:	c9                   	leave
+  80178a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80178b:	83 ec 08             	sub    $0x8,%esp
+  80178e:	68 ff 00 00 00       	push   $0xff
+  801793:	8d 43 08             	lea    0x8(%ebx),%eax
+  801796:	50                   	push   %eax
+  801797:	e8 0e e9 ff ff       	call   8000aa <sys_cputs>
+		b->idx = 0;
+  80179c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8017a2:	83 c4 10             	add    $0x10,%esp
+  8017a5:	eb db                	jmp    801782 <putch+0x1f>
+
+008017a7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8017a7:	55                   	push   %ebp
+  8017a8:	89 e5                	mov    %esp,%ebp
+  8017aa:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017b0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017b7:	00 00 00 
+	b.cnt = 0;
+  8017ba:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017c1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017c4:	ff 75 0c             	push   0xc(%ebp)
+  8017c7:	ff 75 08             	push   0x8(%ebp)
+  8017ca:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017d0:	50                   	push   %eax
+  8017d1:	68 63 17 80 00       	push   $0x801763
+  8017d6:	e8 14 01 00 00       	call   8018ef <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017db:	83 c4 08             	add    $0x8,%esp
+  8017de:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017e4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017ea:	50                   	push   %eax
+  8017eb:	e8 ba e8 ff ff       	call   8000aa <sys_cputs>
+
+	return b.cnt;
+}
+  8017f0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017f6:	c9                   	leave
+  8017f7:	c3                   	ret
+
+008017f8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017f8:	55                   	push   %ebp
+  8017f9:	89 e5                	mov    %esp,%ebp
+  8017fb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017fe:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801801:	50                   	push   %eax
+  801802:	ff 75 08             	push   0x8(%ebp)
+  801805:	e8 9d ff ff ff       	call   8017a7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80180a:	c9                   	leave
+  80180b:	c3                   	ret
+
+0080180c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80180c:	55                   	push   %ebp
+  80180d:	89 e5                	mov    %esp,%ebp
+  80180f:	57                   	push   %edi
+  801810:	56                   	push   %esi
+  801811:	53                   	push   %ebx
+  801812:	83 ec 1c             	sub    $0x1c,%esp
+  801815:	89 c7                	mov    %eax,%edi
+  801817:	89 d6                	mov    %edx,%esi
+  801819:	8b 45 08             	mov    0x8(%ebp),%eax
+  80181c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80181f:	89 d1                	mov    %edx,%ecx
+  801821:	89 c2                	mov    %eax,%edx
+  801823:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801826:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801829:	8b 45 10             	mov    0x10(%ebp),%eax
+  80182c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80182f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801832:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801839:	39 c2                	cmp    %eax,%edx
+  80183b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80183e:	72 3e                	jb     80187e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801840:	83 ec 0c             	sub    $0xc,%esp
+  801843:	ff 75 18             	push   0x18(%ebp)
+  801846:	83 eb 01             	sub    $0x1,%ebx
+  801849:	53                   	push   %ebx
+  80184a:	50                   	push   %eax
+  80184b:	83 ec 08             	sub    $0x8,%esp
+  80184e:	ff 75 e4             	push   -0x1c(%ebp)
+  801851:	ff 75 e0             	push   -0x20(%ebp)
+  801854:	ff 75 dc             	push   -0x24(%ebp)
+  801857:	ff 75 d8             	push   -0x28(%ebp)
+  80185a:	e8 b1 0a 00 00       	call   802310 <__udivdi3>
+  80185f:	83 c4 18             	add    $0x18,%esp
+  801862:	52                   	push   %edx
+  801863:	50                   	push   %eax
+  801864:	89 f2                	mov    %esi,%edx
+  801866:	89 f8                	mov    %edi,%eax
+  801868:	e8 9f ff ff ff       	call   80180c <printnum>
+  80186d:	83 c4 20             	add    $0x20,%esp
+  801870:	eb 13                	jmp    801885 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801872:	83 ec 08             	sub    $0x8,%esp
+  801875:	56                   	push   %esi
+  801876:	ff 75 18             	push   0x18(%ebp)
+  801879:	ff d7                	call   *%edi
+  80187b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80187e:	83 eb 01             	sub    $0x1,%ebx
+  801881:	85 db                	test   %ebx,%ebx
+  801883:	7f ed                	jg     801872 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801885:	83 ec 08             	sub    $0x8,%esp
+  801888:	56                   	push   %esi
+  801889:	83 ec 04             	sub    $0x4,%esp
+  80188c:	ff 75 e4             	push   -0x1c(%ebp)
+  80188f:	ff 75 e0             	push   -0x20(%ebp)
+  801892:	ff 75 dc             	push   -0x24(%ebp)
+  801895:	ff 75 d8             	push   -0x28(%ebp)
+  801898:	e8 33 0b 00 00       	call   8023d0 <__umoddi3>
+  80189d:	83 c4 14             	add    $0x14,%esp
+  8018a0:	0f be 80 07 28 80 00 	movsbl 0x802807(%eax),%eax
+  8018a7:	50                   	push   %eax
+  8018a8:	ff d7                	call   *%edi
+}
+  8018aa:	83 c4 10             	add    $0x10,%esp
+  8018ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b0:	5b                   	pop    %ebx
+  8018b1:	5e                   	pop    %esi
+  8018b2:	5f                   	pop    %edi
+  8018b3:	5d                   	pop    %ebp
+  8018b4:	c3                   	ret
+
+008018b5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018b5:	55                   	push   %ebp
+  8018b6:	89 e5                	mov    %esp,%ebp
+  8018b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018bb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018bf:	8b 10                	mov    (%eax),%edx
+  8018c1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018c4:	73 0a                	jae    8018d0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018c6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018c9:	89 08                	mov    %ecx,(%eax)
+  8018cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ce:	88 02                	mov    %al,(%edx)
+}
+  8018d0:	5d                   	pop    %ebp
+  8018d1:	c3                   	ret
+
+008018d2 <printfmt>:
+{
+  8018d2:	55                   	push   %ebp
+  8018d3:	89 e5                	mov    %esp,%ebp
+  8018d5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018d8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018db:	50                   	push   %eax
+  8018dc:	ff 75 10             	push   0x10(%ebp)
+  8018df:	ff 75 0c             	push   0xc(%ebp)
+  8018e2:	ff 75 08             	push   0x8(%ebp)
+  8018e5:	e8 05 00 00 00       	call   8018ef <vprintfmt>
+}
+  8018ea:	83 c4 10             	add    $0x10,%esp
+  8018ed:	c9                   	leave
+  8018ee:	c3                   	ret
+
+008018ef <vprintfmt>:
+{
+  8018ef:	55                   	push   %ebp
+  8018f0:	89 e5                	mov    %esp,%ebp
+  8018f2:	57                   	push   %edi
+  8018f3:	56                   	push   %esi
+  8018f4:	53                   	push   %ebx
+  8018f5:	83 ec 2c             	sub    $0x2c,%esp
+  8018f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018fe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801901:	eb 0a                	jmp    80190d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801903:	83 ec 08             	sub    $0x8,%esp
+  801906:	53                   	push   %ebx
+  801907:	50                   	push   %eax
+  801908:	ff d6                	call   *%esi
+  80190a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80190d:	83 c7 01             	add    $0x1,%edi
+  801910:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801914:	83 f8 25             	cmp    $0x25,%eax
+  801917:	74 0c                	je     801925 <vprintfmt+0x36>
+			if (ch == '\0')
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	75 e6                	jne    801903 <vprintfmt+0x14>
+}
+  80191d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801920:	5b                   	pop    %ebx
+  801921:	5e                   	pop    %esi
+  801922:	5f                   	pop    %edi
+  801923:	5d                   	pop    %ebp
+  801924:	c3                   	ret
+		padc = ' ';
+  801925:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801929:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801930:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801937:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80193e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801943:	8d 47 01             	lea    0x1(%edi),%eax
+  801946:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801949:	0f b6 17             	movzbl (%edi),%edx
+  80194c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80194f:	3c 55                	cmp    $0x55,%al
+  801951:	0f 87 cf 03 00 00    	ja     801d26 <vprintfmt+0x437>
+  801957:	0f b6 c0             	movzbl %al,%eax
+  80195a:	ff 24 85 40 29 80 00 	jmp    *0x802940(,%eax,4)
+  801961:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801964:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801968:	eb d9                	jmp    801943 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80196a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80196d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801971:	eb d0                	jmp    801943 <vprintfmt+0x54>
+  801973:	0f b6 d2             	movzbl %dl,%edx
+  801976:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801981:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801984:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801988:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80198b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80198e:	83 f9 09             	cmp    $0x9,%ecx
+  801991:	77 55                	ja     8019e8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801993:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801996:	eb e9                	jmp    801981 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199b:	8b 00                	mov    (%eax),%eax
+  80199d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8019a6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019a9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8019ac:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019b0:	79 91                	jns    801943 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019b2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019b8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019bf:	eb 82                	jmp    801943 <vprintfmt+0x54>
+			if (width < 0)
+  8019c1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019c4:	85 d2                	test   %edx,%edx
+  8019c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cb:	0f 49 c2             	cmovns %edx,%eax
+  8019ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019d4:	e9 6a ff ff ff       	jmp    801943 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019dc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019e3:	e9 5b ff ff ff       	jmp    801943 <vprintfmt+0x54>
+  8019e8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019ee:	eb bc                	jmp    8019ac <vprintfmt+0xbd>
+			lflag++;
+  8019f0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019f6:	e9 48 ff ff ff       	jmp    801943 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019fe:	8d 78 04             	lea    0x4(%eax),%edi
+  801a01:	83 ec 08             	sub    $0x8,%esp
+  801a04:	53                   	push   %ebx
+  801a05:	ff 30                	push   (%eax)
+  801a07:	ff d6                	call   *%esi
+			break;
+  801a09:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801a0c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801a0f:	e9 b1 02 00 00       	jmp    801cc5 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801a14:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a17:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a1a:	8b 10                	mov    (%eax),%edx
+  801a1c:	89 d0                	mov    %edx,%eax
+  801a1e:	f7 d8                	neg    %eax
+  801a20:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a23:	83 f8 0f             	cmp    $0xf,%eax
+  801a26:	7f 23                	jg     801a4b <vprintfmt+0x15c>
+  801a28:	8b 14 85 a0 2a 80 00 	mov    0x802aa0(,%eax,4),%edx
+  801a2f:	85 d2                	test   %edx,%edx
+  801a31:	74 18                	je     801a4b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a33:	52                   	push   %edx
+  801a34:	68 65 27 80 00       	push   $0x802765
+  801a39:	53                   	push   %ebx
+  801a3a:	56                   	push   %esi
+  801a3b:	e8 92 fe ff ff       	call   8018d2 <printfmt>
+  801a40:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a43:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a46:	e9 7a 02 00 00       	jmp    801cc5 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801a4b:	50                   	push   %eax
+  801a4c:	68 1f 28 80 00       	push   $0x80281f
+  801a51:	53                   	push   %ebx
+  801a52:	56                   	push   %esi
+  801a53:	e8 7a fe ff ff       	call   8018d2 <printfmt>
+  801a58:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a5b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a5e:	e9 62 02 00 00       	jmp    801cc5 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a63:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a66:	83 c0 04             	add    $0x4,%eax
+  801a69:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a6f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a71:	85 c9                	test   %ecx,%ecx
+  801a73:	b8 18 28 80 00       	mov    $0x802818,%eax
+  801a78:	0f 45 c1             	cmovne %ecx,%eax
+  801a7b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a7e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a82:	7e 06                	jle    801a8a <vprintfmt+0x19b>
+  801a84:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a88:	75 0b                	jne    801a95 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a8a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a8d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a90:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a93:	eb 5c                	jmp    801af1 <vprintfmt+0x202>
+  801a95:	83 ec 08             	sub    $0x8,%esp
+  801a98:	ff 75 d0             	push   -0x30(%ebp)
+  801a9b:	ff 75 cc             	push   -0x34(%ebp)
+  801a9e:	e8 20 03 00 00       	call   801dc3 <strnlen>
+  801aa3:	89 c2                	mov    %eax,%edx
+  801aa5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aa8:	29 d0                	sub    %edx,%eax
+  801aaa:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801aad:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801ab1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ab4:	89 75 08             	mov    %esi,0x8(%ebp)
+  801ab7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ab9:	eb 0e                	jmp    801ac9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801abb:	83 ec 08             	sub    $0x8,%esp
+  801abe:	53                   	push   %ebx
+  801abf:	57                   	push   %edi
+  801ac0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ac3:	83 ee 01             	sub    $0x1,%esi
+  801ac6:	83 c4 10             	add    $0x10,%esp
+  801ac9:	85 f6                	test   %esi,%esi
+  801acb:	7f ee                	jg     801abb <vprintfmt+0x1cc>
+  801acd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ad0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ad3:	85 c0                	test   %eax,%eax
+  801ad5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ada:	0f 49 d0             	cmovns %eax,%edx
+  801add:	29 d0                	sub    %edx,%eax
+  801adf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ae2:	eb a6                	jmp    801a8a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ae4:	83 ec 08             	sub    $0x8,%esp
+  801ae7:	53                   	push   %ebx
+  801ae8:	52                   	push   %edx
+  801ae9:	ff 55 08             	call   *0x8(%ebp)
+  801aec:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801aef:	89 f1                	mov    %esi,%ecx
+  801af1:	8d 71 01             	lea    0x1(%ecx),%esi
+  801af4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801af8:	0f be d0             	movsbl %al,%edx
+  801afb:	85 d2                	test   %edx,%edx
+  801afd:	74 28                	je     801b27 <vprintfmt+0x238>
+  801aff:	85 ff                	test   %edi,%edi
+  801b01:	78 05                	js     801b08 <vprintfmt+0x219>
+  801b03:	83 ef 01             	sub    $0x1,%edi
+  801b06:	78 30                	js     801b38 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801b08:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801b0c:	74 d6                	je     801ae4 <vprintfmt+0x1f5>
+  801b0e:	0f be c0             	movsbl %al,%eax
+  801b11:	83 e8 20             	sub    $0x20,%eax
+  801b14:	83 f8 5e             	cmp    $0x5e,%eax
+  801b17:	76 cb                	jbe    801ae4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b19:	83 ec 08             	sub    $0x8,%esp
+  801b1c:	53                   	push   %ebx
+  801b1d:	6a 3f                	push   $0x3f
+  801b1f:	ff 55 08             	call   *0x8(%ebp)
+  801b22:	83 c4 10             	add    $0x10,%esp
+  801b25:	eb c8                	jmp    801aef <vprintfmt+0x200>
+  801b27:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b2a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b2d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b30:	01 d0                	add    %edx,%eax
+  801b32:	29 c8                	sub    %ecx,%eax
+  801b34:	89 c7                	mov    %eax,%edi
+  801b36:	eb 13                	jmp    801b4b <vprintfmt+0x25c>
+  801b38:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b3b:	eb ed                	jmp    801b2a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b3d:	83 ec 08             	sub    $0x8,%esp
+  801b40:	53                   	push   %ebx
+  801b41:	6a 20                	push   $0x20
+  801b43:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b45:	83 ef 01             	sub    $0x1,%edi
+  801b48:	83 c4 10             	add    $0x10,%esp
+  801b4b:	85 ff                	test   %edi,%edi
+  801b4d:	7f ee                	jg     801b3d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b4f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b52:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b55:	e9 6b 01 00 00       	jmp    801cc5 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801b5a:	83 f9 01             	cmp    $0x1,%ecx
+  801b5d:	7f 1f                	jg     801b7e <vprintfmt+0x28f>
+	else if (lflag)
+  801b5f:	85 c9                	test   %ecx,%ecx
+  801b61:	74 67                	je     801bca <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801b63:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b66:	8b 00                	mov    (%eax),%eax
+  801b68:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b6b:	89 c1                	mov    %eax,%ecx
+  801b6d:	c1 f9 1f             	sar    $0x1f,%ecx
+  801b70:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801b73:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b76:	8d 40 04             	lea    0x4(%eax),%eax
+  801b79:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b7c:	eb 17                	jmp    801b95 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801b7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b81:	8b 50 04             	mov    0x4(%eax),%edx
+  801b84:	8b 00                	mov    (%eax),%eax
+  801b86:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b89:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b8f:	8d 40 08             	lea    0x8(%eax),%eax
+  801b92:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b95:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b98:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b9b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801ba0:	85 c9                	test   %ecx,%ecx
+  801ba2:	0f 89 03 01 00 00    	jns    801cab <vprintfmt+0x3bc>
+				putch('-', putdat);
+  801ba8:	83 ec 08             	sub    $0x8,%esp
+  801bab:	53                   	push   %ebx
+  801bac:	6a 2d                	push   $0x2d
+  801bae:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801bb0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801bb3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801bb6:	f7 da                	neg    %edx
+  801bb8:	83 d1 00             	adc    $0x0,%ecx
+  801bbb:	f7 d9                	neg    %ecx
+  801bbd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bc0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bc5:	e9 e1 00 00 00       	jmp    801cab <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  801bca:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bcd:	8b 00                	mov    (%eax),%eax
+  801bcf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bd2:	89 c1                	mov    %eax,%ecx
+  801bd4:	c1 f9 1f             	sar    $0x1f,%ecx
+  801bd7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801bda:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bdd:	8d 40 04             	lea    0x4(%eax),%eax
+  801be0:	89 45 14             	mov    %eax,0x14(%ebp)
+  801be3:	eb b0                	jmp    801b95 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801be5:	83 f9 01             	cmp    $0x1,%ecx
+  801be8:	7f 1e                	jg     801c08 <vprintfmt+0x319>
+	else if (lflag)
+  801bea:	85 c9                	test   %ecx,%ecx
+  801bec:	74 32                	je     801c20 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  801bee:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bf1:	8b 10                	mov    (%eax),%edx
+  801bf3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bf8:	8d 40 04             	lea    0x4(%eax),%eax
+  801bfb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bfe:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801c03:	e9 a3 00 00 00       	jmp    801cab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c08:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c0b:	8b 10                	mov    (%eax),%edx
+  801c0d:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c10:	8d 40 08             	lea    0x8(%eax),%eax
+  801c13:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c16:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c1b:	e9 8b 00 00 00       	jmp    801cab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c20:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c23:	8b 10                	mov    (%eax),%edx
+  801c25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c2a:	8d 40 04             	lea    0x4(%eax),%eax
+  801c2d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c30:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c35:	eb 74                	jmp    801cab <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  801c37:	83 f9 01             	cmp    $0x1,%ecx
+  801c3a:	7f 1b                	jg     801c57 <vprintfmt+0x368>
+	else if (lflag)
+  801c3c:	85 c9                	test   %ecx,%ecx
+  801c3e:	74 2c                	je     801c6c <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  801c40:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c43:	8b 10                	mov    (%eax),%edx
+  801c45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c4a:	8d 40 04             	lea    0x4(%eax),%eax
+  801c4d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c50:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  801c55:	eb 54                	jmp    801cab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c57:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c5a:	8b 10                	mov    (%eax),%edx
+  801c5c:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c5f:	8d 40 08             	lea    0x8(%eax),%eax
+  801c62:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c65:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  801c6a:	eb 3f                	jmp    801cab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c6f:	8b 10                	mov    (%eax),%edx
+  801c71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c76:	8d 40 04             	lea    0x4(%eax),%eax
+  801c79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c7c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  801c81:	eb 28                	jmp    801cab <vprintfmt+0x3bc>
+			putch('0', putdat);
+  801c83:	83 ec 08             	sub    $0x8,%esp
+  801c86:	53                   	push   %ebx
+  801c87:	6a 30                	push   $0x30
+  801c89:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c8b:	83 c4 08             	add    $0x8,%esp
+  801c8e:	53                   	push   %ebx
+  801c8f:	6a 78                	push   $0x78
+  801c91:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c93:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c96:	8b 10                	mov    (%eax),%edx
+  801c98:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801c9d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801ca0:	8d 40 04             	lea    0x4(%eax),%eax
+  801ca3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ca6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801cab:	83 ec 0c             	sub    $0xc,%esp
+  801cae:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801cb2:	50                   	push   %eax
+  801cb3:	ff 75 e0             	push   -0x20(%ebp)
+  801cb6:	57                   	push   %edi
+  801cb7:	51                   	push   %ecx
+  801cb8:	52                   	push   %edx
+  801cb9:	89 da                	mov    %ebx,%edx
+  801cbb:	89 f0                	mov    %esi,%eax
+  801cbd:	e8 4a fb ff ff       	call   80180c <printnum>
+			break;
+  801cc2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801cc5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801cc8:	e9 40 fc ff ff       	jmp    80190d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801ccd:	83 f9 01             	cmp    $0x1,%ecx
+  801cd0:	7f 1b                	jg     801ced <vprintfmt+0x3fe>
+	else if (lflag)
+  801cd2:	85 c9                	test   %ecx,%ecx
+  801cd4:	74 2c                	je     801d02 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  801cd6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cd9:	8b 10                	mov    (%eax),%edx
+  801cdb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ce0:	8d 40 04             	lea    0x4(%eax),%eax
+  801ce3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ce6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801ceb:	eb be                	jmp    801cab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801ced:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf0:	8b 10                	mov    (%eax),%edx
+  801cf2:	8b 48 04             	mov    0x4(%eax),%ecx
+  801cf5:	8d 40 08             	lea    0x8(%eax),%eax
+  801cf8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cfb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801d00:	eb a9                	jmp    801cab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801d02:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d05:	8b 10                	mov    (%eax),%edx
+  801d07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d0c:	8d 40 04             	lea    0x4(%eax),%eax
+  801d0f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d12:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d17:	eb 92                	jmp    801cab <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  801d19:	83 ec 08             	sub    $0x8,%esp
+  801d1c:	53                   	push   %ebx
+  801d1d:	6a 25                	push   $0x25
+  801d1f:	ff d6                	call   *%esi
+			break;
+  801d21:	83 c4 10             	add    $0x10,%esp
+  801d24:	eb 9f                	jmp    801cc5 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  801d26:	83 ec 08             	sub    $0x8,%esp
+  801d29:	53                   	push   %ebx
+  801d2a:	6a 25                	push   $0x25
+  801d2c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d2e:	83 c4 10             	add    $0x10,%esp
+  801d31:	89 f8                	mov    %edi,%eax
+  801d33:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d37:	74 05                	je     801d3e <vprintfmt+0x44f>
+  801d39:	83 e8 01             	sub    $0x1,%eax
+  801d3c:	eb f5                	jmp    801d33 <vprintfmt+0x444>
+  801d3e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d41:	eb 82                	jmp    801cc5 <vprintfmt+0x3d6>
+
+00801d43 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d43:	55                   	push   %ebp
+  801d44:	89 e5                	mov    %esp,%ebp
+  801d46:	83 ec 18             	sub    $0x18,%esp
+  801d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d4f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d52:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d56:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d59:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d60:	85 c0                	test   %eax,%eax
+  801d62:	74 26                	je     801d8a <vsnprintf+0x47>
+  801d64:	85 d2                	test   %edx,%edx
+  801d66:	7e 22                	jle    801d8a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d68:	ff 75 14             	push   0x14(%ebp)
+  801d6b:	ff 75 10             	push   0x10(%ebp)
+  801d6e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d71:	50                   	push   %eax
+  801d72:	68 b5 18 80 00       	push   $0x8018b5
+  801d77:	e8 73 fb ff ff       	call   8018ef <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d7c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d7f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d85:	83 c4 10             	add    $0x10,%esp
+}
+  801d88:	c9                   	leave
+  801d89:	c3                   	ret
+		return -E_INVAL;
+  801d8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d8f:	eb f7                	jmp    801d88 <vsnprintf+0x45>
+
+00801d91 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d91:	55                   	push   %ebp
+  801d92:	89 e5                	mov    %esp,%ebp
+  801d94:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d97:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d9a:	50                   	push   %eax
+  801d9b:	ff 75 10             	push   0x10(%ebp)
+  801d9e:	ff 75 0c             	push   0xc(%ebp)
+  801da1:	ff 75 08             	push   0x8(%ebp)
+  801da4:	e8 9a ff ff ff       	call   801d43 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801da9:	c9                   	leave
+  801daa:	c3                   	ret
+
+00801dab <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801dab:	55                   	push   %ebp
+  801dac:	89 e5                	mov    %esp,%ebp
+  801dae:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801db1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db6:	eb 03                	jmp    801dbb <strlen+0x10>
+		n++;
+  801db8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801dbb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801dbf:	75 f7                	jne    801db8 <strlen+0xd>
+	return n;
+}
+  801dc1:	5d                   	pop    %ebp
+  801dc2:	c3                   	ret
+
+00801dc3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801dc3:	55                   	push   %ebp
+  801dc4:	89 e5                	mov    %esp,%ebp
+  801dc6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dc9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd1:	eb 03                	jmp    801dd6 <strnlen+0x13>
+		n++;
+  801dd3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dd6:	39 d0                	cmp    %edx,%eax
+  801dd8:	74 08                	je     801de2 <strnlen+0x1f>
+  801dda:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801dde:	75 f3                	jne    801dd3 <strnlen+0x10>
+  801de0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801de2:	89 d0                	mov    %edx,%eax
+  801de4:	5d                   	pop    %ebp
+  801de5:	c3                   	ret
+
+00801de6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801de6:	55                   	push   %ebp
+  801de7:	89 e5                	mov    %esp,%ebp
+  801de9:	53                   	push   %ebx
+  801dea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ded:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801df0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801df9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801dfc:	83 c0 01             	add    $0x1,%eax
+  801dff:	84 d2                	test   %dl,%dl
+  801e01:	75 f2                	jne    801df5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801e03:	89 c8                	mov    %ecx,%eax
+  801e05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e08:	c9                   	leave
+  801e09:	c3                   	ret
+
+00801e0a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801e0a:	55                   	push   %ebp
+  801e0b:	89 e5                	mov    %esp,%ebp
+  801e0d:	53                   	push   %ebx
+  801e0e:	83 ec 10             	sub    $0x10,%esp
+  801e11:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e14:	53                   	push   %ebx
+  801e15:	e8 91 ff ff ff       	call   801dab <strlen>
+  801e1a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e1d:	ff 75 0c             	push   0xc(%ebp)
+  801e20:	01 d8                	add    %ebx,%eax
+  801e22:	50                   	push   %eax
+  801e23:	e8 be ff ff ff       	call   801de6 <strcpy>
+	return dst;
+}
+  801e28:	89 d8                	mov    %ebx,%eax
+  801e2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e2d:	c9                   	leave
+  801e2e:	c3                   	ret
+
+00801e2f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e2f:	55                   	push   %ebp
+  801e30:	89 e5                	mov    %esp,%ebp
+  801e32:	56                   	push   %esi
+  801e33:	53                   	push   %ebx
+  801e34:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e37:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e3a:	89 f3                	mov    %esi,%ebx
+  801e3c:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e3f:	89 f0                	mov    %esi,%eax
+  801e41:	eb 0f                	jmp    801e52 <strncpy+0x23>
+		*dst++ = *src;
+  801e43:	83 c0 01             	add    $0x1,%eax
+  801e46:	0f b6 0a             	movzbl (%edx),%ecx
+  801e49:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e4c:	80 f9 01             	cmp    $0x1,%cl
+  801e4f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e52:	39 d8                	cmp    %ebx,%eax
+  801e54:	75 ed                	jne    801e43 <strncpy+0x14>
+	}
+	return ret;
+}
+  801e56:	89 f0                	mov    %esi,%eax
+  801e58:	5b                   	pop    %ebx
+  801e59:	5e                   	pop    %esi
+  801e5a:	5d                   	pop    %ebp
+  801e5b:	c3                   	ret
+
+00801e5c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	56                   	push   %esi
+  801e60:	53                   	push   %ebx
+  801e61:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e67:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e6a:	89 f0                	mov    %esi,%eax
+  801e6c:	85 d2                	test   %edx,%edx
+  801e6e:	74 21                	je     801e91 <strlcpy+0x35>
+  801e70:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e74:	89 f2                	mov    %esi,%edx
+  801e76:	eb 09                	jmp    801e81 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e78:	83 c1 01             	add    $0x1,%ecx
+  801e7b:	83 c2 01             	add    $0x1,%edx
+  801e7e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e81:	39 c2                	cmp    %eax,%edx
+  801e83:	74 09                	je     801e8e <strlcpy+0x32>
+  801e85:	0f b6 19             	movzbl (%ecx),%ebx
+  801e88:	84 db                	test   %bl,%bl
+  801e8a:	75 ec                	jne    801e78 <strlcpy+0x1c>
+  801e8c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e8e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e91:	29 f0                	sub    %esi,%eax
+}
+  801e93:	5b                   	pop    %ebx
+  801e94:	5e                   	pop    %esi
+  801e95:	5d                   	pop    %ebp
+  801e96:	c3                   	ret
+
+00801e97 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e97:	55                   	push   %ebp
+  801e98:	89 e5                	mov    %esp,%ebp
+  801e9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801ea0:	eb 06                	jmp    801ea8 <strcmp+0x11>
+		p++, q++;
+  801ea2:	83 c1 01             	add    $0x1,%ecx
+  801ea5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801ea8:	0f b6 01             	movzbl (%ecx),%eax
+  801eab:	84 c0                	test   %al,%al
+  801ead:	74 04                	je     801eb3 <strcmp+0x1c>
+  801eaf:	3a 02                	cmp    (%edx),%al
+  801eb1:	74 ef                	je     801ea2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801eb3:	0f b6 c0             	movzbl %al,%eax
+  801eb6:	0f b6 12             	movzbl (%edx),%edx
+  801eb9:	29 d0                	sub    %edx,%eax
+}
+  801ebb:	5d                   	pop    %ebp
+  801ebc:	c3                   	ret
+
+00801ebd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ebd:	55                   	push   %ebp
+  801ebe:	89 e5                	mov    %esp,%ebp
+  801ec0:	53                   	push   %ebx
+  801ec1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ec7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801eca:	eb 09                	jmp    801ed5 <strncmp+0x18>
+		n--, p++, q++;
+  801ecc:	83 ea 01             	sub    $0x1,%edx
+  801ecf:	83 c0 01             	add    $0x1,%eax
+  801ed2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ed5:	85 d2                	test   %edx,%edx
+  801ed7:	74 18                	je     801ef1 <strncmp+0x34>
+  801ed9:	0f b6 18             	movzbl (%eax),%ebx
+  801edc:	84 db                	test   %bl,%bl
+  801ede:	74 04                	je     801ee4 <strncmp+0x27>
+  801ee0:	3a 19                	cmp    (%ecx),%bl
+  801ee2:	74 e8                	je     801ecc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ee4:	0f b6 00             	movzbl (%eax),%eax
+  801ee7:	0f b6 11             	movzbl (%ecx),%edx
+  801eea:	29 d0                	sub    %edx,%eax
+}
+  801eec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eef:	c9                   	leave
+  801ef0:	c3                   	ret
+		return 0;
+  801ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef6:	eb f4                	jmp    801eec <strncmp+0x2f>
+
+00801ef8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801ef8:	55                   	push   %ebp
+  801ef9:	89 e5                	mov    %esp,%ebp
+  801efb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801efe:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f02:	eb 03                	jmp    801f07 <strchr+0xf>
+  801f04:	83 c0 01             	add    $0x1,%eax
+  801f07:	0f b6 10             	movzbl (%eax),%edx
+  801f0a:	84 d2                	test   %dl,%dl
+  801f0c:	74 06                	je     801f14 <strchr+0x1c>
+		if (*s == c)
+  801f0e:	38 ca                	cmp    %cl,%dl
+  801f10:	75 f2                	jne    801f04 <strchr+0xc>
+  801f12:	eb 05                	jmp    801f19 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f19:	5d                   	pop    %ebp
+  801f1a:	c3                   	ret
+
+00801f1b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f1b:	55                   	push   %ebp
+  801f1c:	89 e5                	mov    %esp,%ebp
+  801f1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f21:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f25:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f28:	38 ca                	cmp    %cl,%dl
+  801f2a:	74 09                	je     801f35 <strfind+0x1a>
+  801f2c:	84 d2                	test   %dl,%dl
+  801f2e:	74 05                	je     801f35 <strfind+0x1a>
+	for (; *s; s++)
+  801f30:	83 c0 01             	add    $0x1,%eax
+  801f33:	eb f0                	jmp    801f25 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f35:	5d                   	pop    %ebp
+  801f36:	c3                   	ret
+
+00801f37 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f37:	55                   	push   %ebp
+  801f38:	89 e5                	mov    %esp,%ebp
+  801f3a:	57                   	push   %edi
+  801f3b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f3e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f41:	85 c9                	test   %ecx,%ecx
+  801f43:	74 20                	je     801f65 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f45:	89 f8                	mov    %edi,%eax
+  801f47:	09 c8                	or     %ecx,%eax
+  801f49:	a8 03                	test   $0x3,%al
+  801f4b:	75 12                	jne    801f5f <memset+0x28>
+		c &= 0xFF;
+  801f4d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f51:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f57:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f5a:	fc                   	cld
+  801f5b:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f5d:	eb 06                	jmp    801f65 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f62:	fc                   	cld
+  801f63:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f65:	89 f8                	mov    %edi,%eax
+  801f67:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f6a:	c9                   	leave
+  801f6b:	c3                   	ret
+
+00801f6c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f6c:	55                   	push   %ebp
+  801f6d:	89 e5                	mov    %esp,%ebp
+  801f6f:	57                   	push   %edi
+  801f70:	56                   	push   %esi
+  801f71:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f74:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f77:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f7a:	39 c6                	cmp    %eax,%esi
+  801f7c:	73 32                	jae    801fb0 <memmove+0x44>
+  801f7e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f81:	39 d0                	cmp    %edx,%eax
+  801f83:	73 2b                	jae    801fb0 <memmove+0x44>
+		s += n;
+		d += n;
+  801f85:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f88:	89 d6                	mov    %edx,%esi
+  801f8a:	09 fe                	or     %edi,%esi
+  801f8c:	09 ce                	or     %ecx,%esi
+  801f8e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f94:	75 0e                	jne    801fa4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f96:	83 ef 04             	sub    $0x4,%edi
+  801f99:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f9c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f9f:	fd                   	std
+  801fa0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fa2:	eb 09                	jmp    801fad <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801fa4:	83 ef 01             	sub    $0x1,%edi
+  801fa7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801faa:	fd                   	std
+  801fab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801fad:	fc                   	cld
+  801fae:	eb 1a                	jmp    801fca <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fb0:	89 f2                	mov    %esi,%edx
+  801fb2:	09 c2                	or     %eax,%edx
+  801fb4:	09 ca                	or     %ecx,%edx
+  801fb6:	f6 c2 03             	test   $0x3,%dl
+  801fb9:	75 0a                	jne    801fc5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fbb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fbe:	89 c7                	mov    %eax,%edi
+  801fc0:	fc                   	cld
+  801fc1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fc3:	eb 05                	jmp    801fca <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fc5:	89 c7                	mov    %eax,%edi
+  801fc7:	fc                   	cld
+  801fc8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fca:	5e                   	pop    %esi
+  801fcb:	5f                   	pop    %edi
+  801fcc:	5d                   	pop    %ebp
+  801fcd:	c3                   	ret
+
+00801fce <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fce:	55                   	push   %ebp
+  801fcf:	89 e5                	mov    %esp,%ebp
+  801fd1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fd4:	ff 75 10             	push   0x10(%ebp)
+  801fd7:	ff 75 0c             	push   0xc(%ebp)
+  801fda:	ff 75 08             	push   0x8(%ebp)
+  801fdd:	e8 8a ff ff ff       	call   801f6c <memmove>
+}
+  801fe2:	c9                   	leave
+  801fe3:	c3                   	ret
+
+00801fe4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fe4:	55                   	push   %ebp
+  801fe5:	89 e5                	mov    %esp,%ebp
+  801fe7:	56                   	push   %esi
+  801fe8:	53                   	push   %ebx
+  801fe9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fec:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fef:	89 c6                	mov    %eax,%esi
+  801ff1:	03 75 10             	add    0x10(%ebp),%esi
+  801ff4:	eb 06                	jmp    801ffc <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801ff6:	83 c0 01             	add    $0x1,%eax
+  801ff9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801ffc:	39 f0                	cmp    %esi,%eax
+  801ffe:	74 14                	je     802014 <memcmp+0x30>
+		if (*s1 != *s2)
+  802000:	0f b6 08             	movzbl (%eax),%ecx
+  802003:	0f b6 1a             	movzbl (%edx),%ebx
+  802006:	38 d9                	cmp    %bl,%cl
+  802008:	74 ec                	je     801ff6 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80200a:	0f b6 c1             	movzbl %cl,%eax
+  80200d:	0f b6 db             	movzbl %bl,%ebx
+  802010:	29 d8                	sub    %ebx,%eax
+  802012:	eb 05                	jmp    802019 <memcmp+0x35>
+	}
+
+	return 0;
+  802014:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802019:	5b                   	pop    %ebx
+  80201a:	5e                   	pop    %esi
+  80201b:	5d                   	pop    %ebp
+  80201c:	c3                   	ret
+
+0080201d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	8b 45 08             	mov    0x8(%ebp),%eax
+  802023:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802026:	89 c2                	mov    %eax,%edx
+  802028:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80202b:	eb 03                	jmp    802030 <memfind+0x13>
+  80202d:	83 c0 01             	add    $0x1,%eax
+  802030:	39 d0                	cmp    %edx,%eax
+  802032:	73 04                	jae    802038 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802034:	38 08                	cmp    %cl,(%eax)
+  802036:	75 f5                	jne    80202d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802038:	5d                   	pop    %ebp
+  802039:	c3                   	ret
+
+0080203a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80203a:	55                   	push   %ebp
+  80203b:	89 e5                	mov    %esp,%ebp
+  80203d:	57                   	push   %edi
+  80203e:	56                   	push   %esi
+  80203f:	53                   	push   %ebx
+  802040:	8b 55 08             	mov    0x8(%ebp),%edx
+  802043:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802046:	eb 03                	jmp    80204b <strtol+0x11>
+		s++;
+  802048:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80204b:	0f b6 02             	movzbl (%edx),%eax
+  80204e:	3c 20                	cmp    $0x20,%al
+  802050:	74 f6                	je     802048 <strtol+0xe>
+  802052:	3c 09                	cmp    $0x9,%al
+  802054:	74 f2                	je     802048 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802056:	3c 2b                	cmp    $0x2b,%al
+  802058:	74 2a                	je     802084 <strtol+0x4a>
+	int neg = 0;
+  80205a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80205f:	3c 2d                	cmp    $0x2d,%al
+  802061:	74 2b                	je     80208e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802063:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802069:	75 0f                	jne    80207a <strtol+0x40>
+  80206b:	80 3a 30             	cmpb   $0x30,(%edx)
+  80206e:	74 28                	je     802098 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802070:	85 db                	test   %ebx,%ebx
+  802072:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802077:	0f 44 d8             	cmove  %eax,%ebx
+  80207a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80207f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802082:	eb 46                	jmp    8020ca <strtol+0x90>
+		s++;
+  802084:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802087:	bf 00 00 00 00       	mov    $0x0,%edi
+  80208c:	eb d5                	jmp    802063 <strtol+0x29>
+		s++, neg = 1;
+  80208e:	83 c2 01             	add    $0x1,%edx
+  802091:	bf 01 00 00 00       	mov    $0x1,%edi
+  802096:	eb cb                	jmp    802063 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802098:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80209c:	74 0e                	je     8020ac <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80209e:	85 db                	test   %ebx,%ebx
+  8020a0:	75 d8                	jne    80207a <strtol+0x40>
+		s++, base = 8;
+  8020a2:	83 c2 01             	add    $0x1,%edx
+  8020a5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8020aa:	eb ce                	jmp    80207a <strtol+0x40>
+		s += 2, base = 16;
+  8020ac:	83 c2 02             	add    $0x2,%edx
+  8020af:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020b4:	eb c4                	jmp    80207a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020b6:	0f be c0             	movsbl %al,%eax
+  8020b9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020bc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020bf:	7d 3a                	jge    8020fb <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020c1:	83 c2 01             	add    $0x1,%edx
+  8020c4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020c8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020ca:	0f b6 02             	movzbl (%edx),%eax
+  8020cd:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020d0:	89 f3                	mov    %esi,%ebx
+  8020d2:	80 fb 09             	cmp    $0x9,%bl
+  8020d5:	76 df                	jbe    8020b6 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020d7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020da:	89 f3                	mov    %esi,%ebx
+  8020dc:	80 fb 19             	cmp    $0x19,%bl
+  8020df:	77 08                	ja     8020e9 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020e1:	0f be c0             	movsbl %al,%eax
+  8020e4:	83 e8 57             	sub    $0x57,%eax
+  8020e7:	eb d3                	jmp    8020bc <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020e9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020ec:	89 f3                	mov    %esi,%ebx
+  8020ee:	80 fb 19             	cmp    $0x19,%bl
+  8020f1:	77 08                	ja     8020fb <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020f3:	0f be c0             	movsbl %al,%eax
+  8020f6:	83 e8 37             	sub    $0x37,%eax
+  8020f9:	eb c1                	jmp    8020bc <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020fb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020ff:	74 05                	je     802106 <strtol+0xcc>
+		*endptr = (char *) s;
+  802101:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802104:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802106:	89 c8                	mov    %ecx,%eax
+  802108:	f7 d8                	neg    %eax
+  80210a:	85 ff                	test   %edi,%edi
+  80210c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80210f:	89 c8                	mov    %ecx,%eax
+  802111:	5b                   	pop    %ebx
+  802112:	5e                   	pop    %esi
+  802113:	5f                   	pop    %edi
+  802114:	5d                   	pop    %ebp
+  802115:	c3                   	ret
+
+00802116 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802116:	55                   	push   %ebp
+  802117:	89 e5                	mov    %esp,%ebp
+  802119:	57                   	push   %edi
+  80211a:	56                   	push   %esi
+  80211b:	53                   	push   %ebx
+  80211c:	83 ec 18             	sub    $0x18,%esp
+  80211f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802122:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802125:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802128:	85 db                	test   %ebx,%ebx
+  80212a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80212f:	0f 45 c3             	cmovne %ebx,%eax
+  802132:	50                   	push   %eax
+  802133:	e8 32 e4 ff ff       	call   80056a <sys_ipc_recv>
+
+	if (from_env_store)
+  802138:	83 c4 10             	add    $0x10,%esp
+  80213b:	85 ff                	test   %edi,%edi
+  80213d:	74 17                	je     802156 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80213f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802144:	85 c0                	test   %eax,%eax
+  802146:	75 0c                	jne    802154 <ipc_recv+0x3e>
+  802148:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80214e:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802154:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802156:	85 f6                	test   %esi,%esi
+  802158:	74 2e                	je     802188 <ipc_recv+0x72>
+		if (!r && pg)
+  80215a:	85 c0                	test   %eax,%eax
+  80215c:	75 24                	jne    802182 <ipc_recv+0x6c>
+  80215e:	85 db                	test   %ebx,%ebx
+  802160:	74 20                	je     802182 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802162:	a1 08 40 80 00       	mov    0x804008,%eax
+  802167:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  80216d:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80216f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802174:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80217a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80217d:	5b                   	pop    %ebx
+  80217e:	5e                   	pop    %esi
+  80217f:	5f                   	pop    %edi
+  802180:	5d                   	pop    %ebp
+  802181:	c3                   	ret
+			*perm_store = 0;
+  802182:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802188:	85 c0                	test   %eax,%eax
+  80218a:	75 ee                	jne    80217a <ipc_recv+0x64>
+  80218c:	eb e1                	jmp    80216f <ipc_recv+0x59>
+
+0080218e <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80218e:	55                   	push   %ebp
+  80218f:	89 e5                	mov    %esp,%ebp
+  802191:	57                   	push   %edi
+  802192:	56                   	push   %esi
+  802193:	53                   	push   %ebx
+  802194:	83 ec 0c             	sub    $0xc,%esp
+  802197:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80219a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80219d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8021a0:	85 db                	test   %ebx,%ebx
+  8021a2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021a7:	0f 44 d8             	cmove  %eax,%ebx
+  8021aa:	ff 75 14             	push   0x14(%ebp)
+  8021ad:	53                   	push   %ebx
+  8021ae:	56                   	push   %esi
+  8021af:	57                   	push   %edi
+  8021b0:	e8 92 e3 ff ff       	call   800547 <sys_ipc_try_send_yield>
+  8021b5:	83 c4 10             	add    $0x10,%esp
+  8021b8:	85 c0                	test   %eax,%eax
+  8021ba:	79 1e                	jns    8021da <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8021bc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021bf:	75 07                	jne    8021c8 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8021c1:	e8 a1 df ff ff       	call   800167 <sys_yield>
+  8021c6:	eb e2                	jmp    8021aa <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8021c8:	50                   	push   %eax
+  8021c9:	68 ff 2a 80 00       	push   $0x802aff
+  8021ce:	6a 3d                	push   $0x3d
+  8021d0:	68 14 2b 80 00       	push   $0x802b14
+  8021d5:	e8 43 f5 ff ff       	call   80171d <_panic>
+	}
+}
+  8021da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021dd:	5b                   	pop    %ebx
+  8021de:	5e                   	pop    %esi
+  8021df:	5f                   	pop    %edi
+  8021e0:	5d                   	pop    %ebp
+  8021e1:	c3                   	ret
+
+008021e2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8021e2:	55                   	push   %ebp
+  8021e3:	89 e5                	mov    %esp,%ebp
+  8021e5:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8021e8:	ff 75 08             	push   0x8(%ebp)
+  8021eb:	e8 f7 de ff ff       	call   8000e7 <sys_env_find>
+}
+  8021f0:	c9                   	leave
+  8021f1:	c3                   	ret
+
+008021f2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8021f2:	55                   	push   %ebp
+  8021f3:	89 e5                	mov    %esp,%ebp
+  8021f5:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021f8:	89 c2                	mov    %eax,%edx
+  8021fa:	c1 ea 16             	shr    $0x16,%edx
+  8021fd:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802204:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802209:	f6 c1 01             	test   $0x1,%cl
+  80220c:	74 22                	je     802230 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80220e:	c1 e8 0c             	shr    $0xc,%eax
+  802211:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802218:	a8 01                	test   $0x1,%al
+  80221a:	74 14                	je     802230 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80221c:	c1 e8 0c             	shr    $0xc,%eax
+  80221f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802222:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802229:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80222d:	0f b7 d2             	movzwl %dx,%edx
+}
+  802230:	89 d0                	mov    %edx,%eax
+  802232:	5d                   	pop    %ebp
+  802233:	c3                   	ret
+  802234:	66 90                	xchg   %ax,%ax
+  802236:	66 90                	xchg   %ax,%ax
+  802238:	66 90                	xchg   %ax,%ax
+  80223a:	66 90                	xchg   %ax,%ax
+  80223c:	66 90                	xchg   %ax,%ax
+  80223e:	66 90                	xchg   %ax,%ax
+
+00802240 <__udivmoddi4>:
+  802240:	55                   	push   %ebp
+  802241:	57                   	push   %edi
+  802242:	56                   	push   %esi
+  802243:	53                   	push   %ebx
+  802244:	83 ec 14             	sub    $0x14,%esp
+  802247:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80224b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80224f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802253:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802257:	89 f1                	mov    %esi,%ecx
+  802259:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80225d:	09 d9                	or     %ebx,%ecx
+  80225f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802263:	0f 84 92 00 00 00    	je     8022fb <__udivmoddi4+0xbb>
+  802269:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802270:	00 
+  802271:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802276:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80227d:	00 
+  80227e:	89 1c 24             	mov    %ebx,(%esp)
+  802281:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802285:	8d 76 00             	lea    0x0(%esi),%esi
+  802288:	89 e9                	mov    %ebp,%ecx
+  80228a:	89 c3                	mov    %eax,%ebx
+  80228c:	89 d6                	mov    %edx,%esi
+  80228e:	31 ff                	xor    %edi,%edi
+  802290:	d3 ee                	shr    %cl,%esi
+  802292:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802295:	f6 c1 20             	test   $0x20,%cl
+  802298:	0f 45 de             	cmovne %esi,%ebx
+  80229b:	0f 45 f7             	cmovne %edi,%esi
+  80229e:	8b 3c 24             	mov    (%esp),%edi
+  8022a1:	39 fb                	cmp    %edi,%ebx
+  8022a3:	89 f7                	mov    %esi,%edi
+  8022a5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8022a9:	8b 1c 24             	mov    (%esp),%ebx
+  8022ac:	19 f7                	sbb    %esi,%edi
+  8022ae:	72 39                	jb     8022e9 <__udivmoddi4+0xa9>
+  8022b0:	89 e9                	mov    %ebp,%ecx
+  8022b2:	89 f7                	mov    %esi,%edi
+  8022b4:	89 de                	mov    %ebx,%esi
+  8022b6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8022b9:	d3 e6                	shl    %cl,%esi
+  8022bb:	31 db                	xor    %ebx,%ebx
+  8022bd:	f6 c1 20             	test   $0x20,%cl
+  8022c0:	0f 45 fe             	cmovne %esi,%edi
+  8022c3:	0f 45 f3             	cmovne %ebx,%esi
+  8022c6:	29 f0                	sub    %esi,%eax
+  8022c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022cd:	19 fa                	sbb    %edi,%edx
+  8022cf:	31 ff                	xor    %edi,%edi
+  8022d1:	31 db                	xor    %ebx,%ebx
+  8022d3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8022d6:	d3 e6                	shl    %cl,%esi
+  8022d8:	f6 c1 20             	test   $0x20,%cl
+  8022db:	0f 45 fe             	cmovne %esi,%edi
+  8022de:	0f 45 f3             	cmovne %ebx,%esi
+  8022e1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8022e5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8022e9:	83 ed 01             	sub    $0x1,%ebp
+  8022ec:	73 9a                	jae    802288 <__udivmoddi4+0x48>
+  8022ee:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8022f2:	85 ff                	test   %edi,%edi
+  8022f4:	74 05                	je     8022fb <__udivmoddi4+0xbb>
+  8022f6:	89 07                	mov    %eax,(%edi)
+  8022f8:	89 57 04             	mov    %edx,0x4(%edi)
+  8022fb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022ff:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802303:	83 c4 14             	add    $0x14,%esp
+  802306:	5b                   	pop    %ebx
+  802307:	5e                   	pop    %esi
+  802308:	5f                   	pop    %edi
+  802309:	5d                   	pop    %ebp
+  80230a:	c3                   	ret
+  80230b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80230f:	90                   	nop
+
+00802310 <__udivdi3>:
+  802310:	55                   	push   %ebp
+  802311:	57                   	push   %edi
+  802312:	56                   	push   %esi
+  802313:	53                   	push   %ebx
+  802314:	83 ec 14             	sub    $0x14,%esp
+  802317:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80231b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80231f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802323:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802327:	89 fb                	mov    %edi,%ebx
+  802329:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80232d:	09 f3                	or     %esi,%ebx
+  80232f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802333:	0f 84 85 00 00 00    	je     8023be <__udivdi3+0xae>
+  802339:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802340:	00 
+  802341:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802346:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80234d:	00 
+  80234e:	89 34 24             	mov    %esi,(%esp)
+  802351:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802355:	8d 76 00             	lea    0x0(%esi),%esi
+  802358:	89 e9                	mov    %ebp,%ecx
+  80235a:	89 c3                	mov    %eax,%ebx
+  80235c:	89 d6                	mov    %edx,%esi
+  80235e:	31 ff                	xor    %edi,%edi
+  802360:	d3 ee                	shr    %cl,%esi
+  802362:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802365:	f6 c1 20             	test   $0x20,%cl
+  802368:	0f 45 de             	cmovne %esi,%ebx
+  80236b:	0f 45 f7             	cmovne %edi,%esi
+  80236e:	8b 3c 24             	mov    (%esp),%edi
+  802371:	39 fb                	cmp    %edi,%ebx
+  802373:	89 f7                	mov    %esi,%edi
+  802375:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802379:	8b 1c 24             	mov    (%esp),%ebx
+  80237c:	19 f7                	sbb    %esi,%edi
+  80237e:	72 39                	jb     8023b9 <__udivdi3+0xa9>
+  802380:	89 e9                	mov    %ebp,%ecx
+  802382:	89 f7                	mov    %esi,%edi
+  802384:	89 de                	mov    %ebx,%esi
+  802386:	0f a5 df             	shld   %cl,%ebx,%edi
+  802389:	d3 e6                	shl    %cl,%esi
+  80238b:	31 db                	xor    %ebx,%ebx
+  80238d:	f6 c1 20             	test   $0x20,%cl
+  802390:	0f 45 fe             	cmovne %esi,%edi
+  802393:	0f 45 f3             	cmovne %ebx,%esi
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	be 01 00 00 00       	mov    $0x1,%esi
+  80239d:	19 fa                	sbb    %edi,%edx
+  80239f:	31 ff                	xor    %edi,%edi
+  8023a1:	31 db                	xor    %ebx,%ebx
+  8023a3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023a6:	d3 e6                	shl    %cl,%esi
+  8023a8:	f6 c1 20             	test   $0x20,%cl
+  8023ab:	0f 45 fe             	cmovne %esi,%edi
+  8023ae:	0f 45 f3             	cmovne %ebx,%esi
+  8023b1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8023b5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8023b9:	83 ed 01             	sub    $0x1,%ebp
+  8023bc:	73 9a                	jae    802358 <__udivdi3+0x48>
+  8023be:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023c2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023c6:	83 c4 14             	add    $0x14,%esp
+  8023c9:	5b                   	pop    %ebx
+  8023ca:	5e                   	pop    %esi
+  8023cb:	5f                   	pop    %edi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+  8023ce:	66 90                	xchg   %ax,%ax
+
+008023d0 <__umoddi3>:
+  8023d0:	57                   	push   %edi
+  8023d1:	56                   	push   %esi
+  8023d2:	53                   	push   %ebx
+  8023d3:	83 ec 08             	sub    $0x8,%esp
+  8023d6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8023da:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8023de:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023e2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023e6:	89 f9                	mov    %edi,%ecx
+  8023e8:	89 34 24             	mov    %esi,(%esp)
+  8023eb:	09 f1                	or     %esi,%ecx
+  8023ed:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023f1:	74 53                	je     802446 <__umoddi3+0x76>
+  8023f3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023ff:	90                   	nop
+  802400:	89 c6                	mov    %eax,%esi
+  802402:	89 d7                	mov    %edx,%edi
+  802404:	31 db                	xor    %ebx,%ebx
+  802406:	d3 ef                	shr    %cl,%edi
+  802408:	0f ad d6             	shrd   %cl,%edx,%esi
+  80240b:	f6 c1 20             	test   $0x20,%cl
+  80240e:	0f 45 f7             	cmovne %edi,%esi
+  802411:	0f 45 fb             	cmovne %ebx,%edi
+  802414:	8b 1c 24             	mov    (%esp),%ebx
+  802417:	39 de                	cmp    %ebx,%esi
+  802419:	89 fb                	mov    %edi,%ebx
+  80241b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80241f:	8b 34 24             	mov    (%esp),%esi
+  802422:	19 fb                	sbb    %edi,%ebx
+  802424:	72 14                	jb     80243a <__umoddi3+0x6a>
+  802426:	0f a5 f7             	shld   %cl,%esi,%edi
+  802429:	31 db                	xor    %ebx,%ebx
+  80242b:	d3 e6                	shl    %cl,%esi
+  80242d:	f6 c1 20             	test   $0x20,%cl
+  802430:	0f 45 fe             	cmovne %esi,%edi
+  802433:	0f 45 f3             	cmovne %ebx,%esi
+  802436:	29 f0                	sub    %esi,%eax
+  802438:	19 fa                	sbb    %edi,%edx
+  80243a:	83 e9 01             	sub    $0x1,%ecx
+  80243d:	73 c1                	jae    802400 <__umoddi3+0x30>
+  80243f:	83 c4 08             	add    $0x8,%esp
+  802442:	5b                   	pop    %ebx
+  802443:	5e                   	pop    %esi
+  802444:	5f                   	pop    %edi
+  802445:	c3                   	ret
+  802446:	83 c4 08             	add    $0x8,%esp
+  802449:	31 c0                	xor    %eax,%eax
+  80244b:	31 d2                	xor    %edx,%edx
+  80244d:	5b                   	pop    %ebx
+  80244e:	5e                   	pop    %esi
+  80244f:	5f                   	pop    %edi
+  802450:	c3                   	ret
+  802451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80245f:	90                   	nop
+
+00802460 <__divdi3>:
+  802460:	55                   	push   %ebp
+  802461:	57                   	push   %edi
+  802462:	56                   	push   %esi
+  802463:	53                   	push   %ebx
+  802464:	83 ec 1c             	sub    $0x1c,%esp
+  802467:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80246b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80246f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802473:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802477:	85 ff                	test   %edi,%edi
+  802479:	0f 88 da 00 00 00    	js     802559 <__divdi3+0xf9>
+  80247f:	85 db                	test   %ebx,%ebx
+  802481:	78 16                	js     802499 <__divdi3+0x39>
+  802483:	89 dd                	mov    %ebx,%ebp
+  802485:	89 c8                	mov    %ecx,%eax
+  802487:	89 da                	mov    %ebx,%edx
+  802489:	09 cd                	or     %ecx,%ebp
+  80248b:	0f 85 fd 00 00 00    	jne    80258e <__divdi3+0x12e>
+  802491:	83 c4 1c             	add    $0x1c,%esp
+  802494:	5b                   	pop    %ebx
+  802495:	5e                   	pop    %esi
+  802496:	5f                   	pop    %edi
+  802497:	5d                   	pop    %ebp
+  802498:	c3                   	ret
+  802499:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80249e:	f7 d9                	neg    %ecx
+  8024a0:	89 f0                	mov    %esi,%eax
+  8024a2:	89 fa                	mov    %edi,%edx
+  8024a4:	83 d3 00             	adc    $0x0,%ebx
+  8024a7:	89 0c 24             	mov    %ecx,(%esp)
+  8024aa:	f7 db                	neg    %ebx
+  8024ac:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8024b0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024b7:	00 
+  8024b8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024bd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024c4:	00 
+  8024c5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024c9:	89 cd                	mov    %ecx,%ebp
+  8024cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024cf:	90                   	nop
+  8024d0:	89 e9                	mov    %ebp,%ecx
+  8024d2:	89 c3                	mov    %eax,%ebx
+  8024d4:	89 d6                	mov    %edx,%esi
+  8024d6:	31 ff                	xor    %edi,%edi
+  8024d8:	d3 ee                	shr    %cl,%esi
+  8024da:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024dd:	f6 c1 20             	test   $0x20,%cl
+  8024e0:	0f 45 de             	cmovne %esi,%ebx
+  8024e3:	0f 45 f7             	cmovne %edi,%esi
+  8024e6:	8b 3c 24             	mov    (%esp),%edi
+  8024e9:	39 fb                	cmp    %edi,%ebx
+  8024eb:	89 f7                	mov    %esi,%edi
+  8024ed:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8024f1:	8b 1c 24             	mov    (%esp),%ebx
+  8024f4:	19 f7                	sbb    %esi,%edi
+  8024f6:	72 39                	jb     802531 <__divdi3+0xd1>
+  8024f8:	89 e9                	mov    %ebp,%ecx
+  8024fa:	89 f7                	mov    %esi,%edi
+  8024fc:	89 de                	mov    %ebx,%esi
+  8024fe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802501:	d3 e6                	shl    %cl,%esi
+  802503:	31 db                	xor    %ebx,%ebx
+  802505:	f6 c1 20             	test   $0x20,%cl
+  802508:	0f 45 fe             	cmovne %esi,%edi
+  80250b:	0f 45 f3             	cmovne %ebx,%esi
+  80250e:	29 f0                	sub    %esi,%eax
+  802510:	be 01 00 00 00       	mov    $0x1,%esi
+  802515:	19 fa                	sbb    %edi,%edx
+  802517:	31 ff                	xor    %edi,%edi
+  802519:	31 db                	xor    %ebx,%ebx
+  80251b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80251e:	d3 e6                	shl    %cl,%esi
+  802520:	f6 c1 20             	test   $0x20,%cl
+  802523:	0f 45 fe             	cmovne %esi,%edi
+  802526:	0f 45 f3             	cmovne %ebx,%esi
+  802529:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80252d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802531:	83 ed 01             	sub    $0x1,%ebp
+  802534:	73 9a                	jae    8024d0 <__divdi3+0x70>
+  802536:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80253a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80253e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802542:	85 ed                	test   %ebp,%ebp
+  802544:	0f 84 47 ff ff ff    	je     802491 <__divdi3+0x31>
+  80254a:	f7 d8                	neg    %eax
+  80254c:	83 d2 00             	adc    $0x0,%edx
+  80254f:	83 c4 1c             	add    $0x1c,%esp
+  802552:	5b                   	pop    %ebx
+  802553:	f7 da                	neg    %edx
+  802555:	5e                   	pop    %esi
+  802556:	5f                   	pop    %edi
+  802557:	5d                   	pop    %ebp
+  802558:	c3                   	ret
+  802559:	f7 de                	neg    %esi
+  80255b:	83 d7 00             	adc    $0x0,%edi
+  80255e:	f7 df                	neg    %edi
+  802560:	85 db                	test   %ebx,%ebx
+  802562:	78 23                	js     802587 <__divdi3+0x127>
+  802564:	89 dd                	mov    %ebx,%ebp
+  802566:	89 c8                	mov    %ecx,%eax
+  802568:	89 da                	mov    %ebx,%edx
+  80256a:	09 cd                	or     %ecx,%ebp
+  80256c:	0f 84 1f ff ff ff    	je     802491 <__divdi3+0x31>
+  802572:	89 0c 24             	mov    %ecx,(%esp)
+  802575:	89 f0                	mov    %esi,%eax
+  802577:	89 fa                	mov    %edi,%edx
+  802579:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80257e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802582:	e9 29 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+  802587:	31 ed                	xor    %ebp,%ebp
+  802589:	e9 10 ff ff ff       	jmp    80249e <__divdi3+0x3e>
+  80258e:	89 0c 24             	mov    %ecx,(%esp)
+  802591:	89 f0                	mov    %esi,%eax
+  802593:	89 fa                	mov    %edi,%edx
+  802595:	31 ed                	xor    %ebp,%ebp
+  802597:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80259b:	e9 10 ff ff ff       	jmp    8024b0 <__divdi3+0x50>
+
+008025a0 <__moddi3>:
+  8025a0:	55                   	push   %ebp
+  8025a1:	57                   	push   %edi
+  8025a2:	56                   	push   %esi
+  8025a3:	53                   	push   %ebx
+  8025a4:	83 ec 14             	sub    $0x14,%esp
+  8025a7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025ab:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025af:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8025b3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8025b7:	85 d2                	test   %edx,%edx
+  8025b9:	0f 88 9b 00 00 00    	js     80265a <__moddi3+0xba>
+  8025bf:	89 f7                	mov    %esi,%edi
+  8025c1:	31 ed                	xor    %ebp,%ebp
+  8025c3:	09 cf                	or     %ecx,%edi
+  8025c5:	0f 84 83 00 00 00    	je     80264e <__moddi3+0xae>
+  8025cb:	89 cb                	mov    %ecx,%ebx
+  8025cd:	89 f7                	mov    %esi,%edi
+  8025cf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8025d3:	f7 db                	neg    %ebx
+  8025d5:	83 d7 00             	adc    $0x0,%edi
+  8025d8:	f7 df                	neg    %edi
+  8025da:	0f 49 f7             	cmovns %edi,%esi
+  8025dd:	0f 49 cb             	cmovns %ebx,%ecx
+  8025e0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025e4:	89 0c 24             	mov    %ecx,(%esp)
+  8025e7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025ec:	89 cd                	mov    %ecx,%ebp
+  8025ee:	66 90                	xchg   %ax,%ax
+  8025f0:	89 e9                	mov    %ebp,%ecx
+  8025f2:	89 c3                	mov    %eax,%ebx
+  8025f4:	89 d6                	mov    %edx,%esi
+  8025f6:	31 ff                	xor    %edi,%edi
+  8025f8:	d3 ee                	shr    %cl,%esi
+  8025fa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025fd:	f6 c1 20             	test   $0x20,%cl
+  802600:	0f 45 de             	cmovne %esi,%ebx
+  802603:	0f 45 f7             	cmovne %edi,%esi
+  802606:	8b 3c 24             	mov    (%esp),%edi
+  802609:	39 fb                	cmp    %edi,%ebx
+  80260b:	89 f7                	mov    %esi,%edi
+  80260d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802611:	8b 1c 24             	mov    (%esp),%ebx
+  802614:	19 f7                	sbb    %esi,%edi
+  802616:	72 1a                	jb     802632 <__moddi3+0x92>
+  802618:	89 e9                	mov    %ebp,%ecx
+  80261a:	89 f7                	mov    %esi,%edi
+  80261c:	89 de                	mov    %ebx,%esi
+  80261e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802621:	d3 e6                	shl    %cl,%esi
+  802623:	31 db                	xor    %ebx,%ebx
+  802625:	f6 c1 20             	test   $0x20,%cl
+  802628:	0f 45 fe             	cmovne %esi,%edi
+  80262b:	0f 45 f3             	cmovne %ebx,%esi
+  80262e:	29 f0                	sub    %esi,%eax
+  802630:	19 fa                	sbb    %edi,%edx
+  802632:	83 ed 01             	sub    $0x1,%ebp
+  802635:	73 b9                	jae    8025f0 <__moddi3+0x50>
+  802637:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80263b:	85 ed                	test   %ebp,%ebp
+  80263d:	74 07                	je     802646 <__moddi3+0xa6>
+  80263f:	f7 d8                	neg    %eax
+  802641:	83 d2 00             	adc    $0x0,%edx
+  802644:	f7 da                	neg    %edx
+  802646:	83 c4 14             	add    $0x14,%esp
+  802649:	5b                   	pop    %ebx
+  80264a:	5e                   	pop    %esi
+  80264b:	5f                   	pop    %edi
+  80264c:	5d                   	pop    %ebp
+  80264d:	c3                   	ret
+  80264e:	83 c4 14             	add    $0x14,%esp
+  802651:	31 c0                	xor    %eax,%eax
+  802653:	31 d2                	xor    %edx,%edx
+  802655:	5b                   	pop    %ebx
+  802656:	5e                   	pop    %esi
+  802657:	5f                   	pop    %edi
+  802658:	5d                   	pop    %ebp
+  802659:	c3                   	ret
+  80265a:	89 f7                	mov    %esi,%edi
+  80265c:	09 cf                	or     %ecx,%edi
+  80265e:	74 11                	je     802671 <__moddi3+0xd1>
+  802660:	f7 d8                	neg    %eax
+  802662:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802667:	83 d2 00             	adc    $0x0,%edx
+  80266a:	f7 da                	neg    %edx
+  80266c:	e9 5a ff ff ff       	jmp    8025cb <__moddi3+0x2b>
+  802671:	31 c0                	xor    %eax,%eax
+  802673:	31 d2                	xor    %edx,%edx
+  802675:	eb c8                	jmp    80263f <__moddi3+0x9f>
@@ -0,0 +1,6466 @@
+
+obj/user/init.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5f 03 00 00       	call   800390 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sum>:
+
+char bss[6000];
+
+int
+sum(const char *s, int n)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int i, tot = 0;
+  80003e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (i = 0; i < n; i++)
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	eb 0c                	jmp    800056 <sum+0x23>
+		tot ^= i * s[i];
+  80004a:	0f be 14 06          	movsbl (%esi,%eax,1),%edx
+  80004e:	0f af d0             	imul   %eax,%edx
+  800051:	31 d1                	xor    %edx,%ecx
+	for (i = 0; i < n; i++)
+  800053:	83 c0 01             	add    $0x1,%eax
+  800056:	39 d8                	cmp    %ebx,%eax
+  800058:	7c f0                	jl     80004a <sum+0x17>
+	return tot;
+}
+  80005a:	89 c8                	mov    %ecx,%eax
+  80005c:	5b                   	pop    %ebx
+  80005d:	5e                   	pop    %esi
+  80005e:	5d                   	pop    %ebp
+  80005f:	c3                   	ret
+
+00800060 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800060:	55                   	push   %ebp
+  800061:	89 e5                	mov    %esp,%ebp
+  800063:	57                   	push   %edi
+  800064:	56                   	push   %esi
+  800065:	53                   	push   %ebx
+  800066:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80006c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	int i, r, x, want;
+	char args[256];
+
+	cprintf("init: running\n");
+  80006f:	68 40 2f 80 00       	push   $0x802f40
+  800074:	e8 52 04 00 00       	call   8004cb <cprintf>
+
+	want = 0xf989e;
+	if ((x = sum((char*)&data, sizeof data)) != want)
+  800079:	83 c4 08             	add    $0x8,%esp
+  80007c:	68 70 17 00 00       	push   $0x1770
+  800081:	68 00 40 80 00       	push   $0x804000
+  800086:	e8 a8 ff ff ff       	call   800033 <sum>
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  800093:	74 64                	je     8000f9 <umain+0x99>
+		cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  800095:	83 ec 04             	sub    $0x4,%esp
+  800098:	68 9e 98 0f 00       	push   $0xf989e
+  80009d:	50                   	push   %eax
+  80009e:	68 08 30 80 00       	push   $0x803008
+  8000a3:	e8 23 04 00 00       	call   8004cb <cprintf>
+  8000a8:	83 c4 10             	add    $0x10,%esp
+			x, want);
+	else
+		cprintf("init: data seems okay\n");
+	if ((x = sum(bss, sizeof bss)) != 0)
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	68 70 17 00 00       	push   $0x1770
+  8000b3:	68 20 60 80 00       	push   $0x806020
+  8000b8:	e8 76 ff ff ff       	call   800033 <sum>
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	74 47                	je     80010b <umain+0xab>
+		cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000c4:	83 ec 08             	sub    $0x8,%esp
+  8000c7:	50                   	push   %eax
+  8000c8:	68 44 30 80 00       	push   $0x803044
+  8000cd:	e8 f9 03 00 00       	call   8004cb <cprintf>
+  8000d2:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("init: bss seems okay\n");
+
+	// output in one syscall per line to avoid output interleaving 
+	strcat(args, "init: args:");
+  8000d5:	83 ec 08             	sub    $0x8,%esp
+  8000d8:	68 7c 2f 80 00       	push   $0x802f7c
+  8000dd:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8000e3:	50                   	push   %eax
+  8000e4:	e8 f4 09 00 00       	call   800add <strcat>
+	for (i = 0; i < argc; i++) {
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+		strcat(args, " '");
+  8000f1:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+	for (i = 0; i < argc; i++) {
+  8000f7:	eb 55                	jmp    80014e <umain+0xee>
+		cprintf("init: data seems okay\n");
+  8000f9:	83 ec 0c             	sub    $0xc,%esp
+  8000fc:	68 4f 2f 80 00       	push   $0x802f4f
+  800101:	e8 c5 03 00 00       	call   8004cb <cprintf>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	eb a0                	jmp    8000ab <umain+0x4b>
+		cprintf("init: bss seems okay\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 66 2f 80 00       	push   $0x802f66
+  800113:	e8 b3 03 00 00       	call   8004cb <cprintf>
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	eb b8                	jmp    8000d5 <umain+0x75>
+		strcat(args, " '");
+  80011d:	83 ec 08             	sub    $0x8,%esp
+  800120:	68 88 2f 80 00       	push   $0x802f88
+  800125:	56                   	push   %esi
+  800126:	e8 b2 09 00 00       	call   800add <strcat>
+		strcat(args, argv[i]);
+  80012b:	83 c4 08             	add    $0x8,%esp
+  80012e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800131:	ff 34 98             	push   (%eax,%ebx,4)
+  800134:	56                   	push   %esi
+  800135:	e8 a3 09 00 00       	call   800add <strcat>
+		strcat(args, "'");
+  80013a:	83 c4 08             	add    $0x8,%esp
+  80013d:	68 89 2f 80 00       	push   $0x802f89
+  800142:	56                   	push   %esi
+  800143:	e8 95 09 00 00       	call   800add <strcat>
+	for (i = 0; i < argc; i++) {
+  800148:	83 c3 01             	add    $0x1,%ebx
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	39 fb                	cmp    %edi,%ebx
+  800150:	7c cb                	jl     80011d <umain+0xbd>
+	}
+	cprintf("%s\n", args);
+  800152:	83 ec 08             	sub    $0x8,%esp
+  800155:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80015b:	50                   	push   %eax
+  80015c:	68 8b 2f 80 00       	push   $0x802f8b
+  800161:	e8 65 03 00 00       	call   8004cb <cprintf>
+
+	cprintf("init: running sh\n");
+  800166:	c7 04 24 8f 2f 80 00 	movl   $0x802f8f,(%esp)
+  80016d:	e8 59 03 00 00       	call   8004cb <cprintf>
+
+	// being run directly from kernel, so no file descriptors open yet
+	close(0);
+  800172:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800179:	e8 74 13 00 00       	call   8014f2 <close>
+	if ((r = opencons()) < 0)
+  80017e:	e8 bb 01 00 00       	call   80033e <opencons>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 14                	js     80019e <umain+0x13e>
+		panic("opencons: %e", r);
+	if (r != 0)
+  80018a:	74 24                	je     8001b0 <umain+0x150>
+		panic("first opencons used fd %d", r);
+  80018c:	50                   	push   %eax
+  80018d:	68 ba 2f 80 00       	push   $0x802fba
+  800192:	6a 39                	push   $0x39
+  800194:	68 ae 2f 80 00       	push   $0x802fae
+  800199:	e8 52 02 00 00       	call   8003f0 <_panic>
+		panic("opencons: %e", r);
+  80019e:	50                   	push   %eax
+  80019f:	68 a1 2f 80 00       	push   $0x802fa1
+  8001a4:	6a 37                	push   $0x37
+  8001a6:	68 ae 2f 80 00       	push   $0x802fae
+  8001ab:	e8 40 02 00 00       	call   8003f0 <_panic>
+	if ((r = dup(0, 1)) < 0)
+  8001b0:	83 ec 08             	sub    $0x8,%esp
+  8001b3:	6a 01                	push   $0x1
+  8001b5:	6a 00                	push   $0x0
+  8001b7:	e8 88 13 00 00       	call   801544 <dup>
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	79 23                	jns    8001e6 <umain+0x186>
+		panic("dup: %e", r);
+  8001c3:	50                   	push   %eax
+  8001c4:	68 d4 2f 80 00       	push   $0x802fd4
+  8001c9:	6a 3b                	push   $0x3b
+  8001cb:	68 ae 2f 80 00       	push   $0x802fae
+  8001d0:	e8 1b 02 00 00       	call   8003f0 <_panic>
+	while (1) {
+		cprintf("init: starting sh\n");
+		r = spawnl("/sh", "sh", (char*)0);
+		if (r < 0) {
+			cprintf("init: spawn sh: %e\n", r);
+  8001d5:	83 ec 08             	sub    $0x8,%esp
+  8001d8:	50                   	push   %eax
+  8001d9:	68 f3 2f 80 00       	push   $0x802ff3
+  8001de:	e8 e8 02 00 00       	call   8004cb <cprintf>
+			continue;
+  8001e3:	83 c4 10             	add    $0x10,%esp
+		cprintf("init: starting sh\n");
+  8001e6:	83 ec 0c             	sub    $0xc,%esp
+  8001e9:	68 dc 2f 80 00       	push   $0x802fdc
+  8001ee:	e8 d8 02 00 00       	call   8004cb <cprintf>
+		r = spawnl("/sh", "sh", (char*)0);
+  8001f3:	83 c4 0c             	add    $0xc,%esp
+  8001f6:	6a 00                	push   $0x0
+  8001f8:	68 f0 2f 80 00       	push   $0x802ff0
+  8001fd:	68 ef 2f 80 00       	push   $0x802fef
+  800202:	e8 5b 1f 00 00       	call   802162 <spawnl>
+		if (r < 0) {
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	78 c7                	js     8001d5 <umain+0x175>
+		}
+		wait(r);
+  80020e:	83 ec 0c             	sub    $0xc,%esp
+  800211:	50                   	push   %eax
+  800212:	e8 71 27 00 00       	call   802988 <wait>
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	eb ca                	jmp    8001e6 <umain+0x186>
+
+0080021c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80021c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800221:	c3                   	ret
+
+00800222 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  800228:	68 73 30 80 00       	push   $0x803073
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	e8 84 08 00 00       	call   800ab9 <strcpy>
+	return 0;
+}
+  800235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <devcons_write>:
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	57                   	push   %edi
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+  800242:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800248:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80024d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800253:	eb 2e                	jmp    800283 <devcons_write+0x47>
+		m = n - tot;
+  800255:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800258:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80025a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80025f:	39 c3                	cmp    %eax,%ebx
+  800261:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800264:	83 ec 04             	sub    $0x4,%esp
+  800267:	53                   	push   %ebx
+  800268:	89 f0                	mov    %esi,%eax
+  80026a:	03 45 0c             	add    0xc(%ebp),%eax
+  80026d:	50                   	push   %eax
+  80026e:	57                   	push   %edi
+  80026f:	e8 cb 09 00 00       	call   800c3f <memmove>
+		sys_cputs(buf, m);
+  800274:	83 c4 08             	add    $0x8,%esp
+  800277:	53                   	push   %ebx
+  800278:	57                   	push   %edi
+  800279:	e8 6b 0b 00 00       	call   800de9 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80027e:	01 de                	add    %ebx,%esi
+  800280:	83 c4 10             	add    $0x10,%esp
+  800283:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800286:	72 cd                	jb     800255 <devcons_write+0x19>
+}
+  800288:	89 f0                	mov    %esi,%eax
+  80028a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028d:	5b                   	pop    %ebx
+  80028e:	5e                   	pop    %esi
+  80028f:	5f                   	pop    %edi
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <devcons_read>:
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002a1:	75 07                	jne    8002aa <devcons_read+0x18>
+  8002a3:	eb 1f                	jmp    8002c4 <devcons_read+0x32>
+		sys_yield();
+  8002a5:	e8 fc 0b 00 00       	call   800ea6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8002aa:	e8 58 0b 00 00       	call   800e07 <sys_cgetc>
+  8002af:	85 c0                	test   %eax,%eax
+  8002b1:	74 f2                	je     8002a5 <devcons_read+0x13>
+	if (c < 0)
+  8002b3:	78 0f                	js     8002c4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8002b5:	83 f8 04             	cmp    $0x4,%eax
+  8002b8:	74 0c                	je     8002c6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8002ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002bd:	88 02                	mov    %al,(%edx)
+	return 1;
+  8002bf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+		return 0;
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	eb f7                	jmp    8002c4 <devcons_read+0x32>
+
+008002cd <cputchar>:
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8002d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8002d9:	6a 01                	push   $0x1
+  8002db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	e8 05 0b 00 00       	call   800de9 <sys_cputs>
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+008002e9 <getchar>:
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8002ef:	6a 01                	push   $0x1
+  8002f1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	6a 00                	push   $0x0
+  8002f7:	e8 32 13 00 00       	call   80162e <read>
+	if (r < 0)
+  8002fc:	83 c4 10             	add    $0x10,%esp
+  8002ff:	85 c0                	test   %eax,%eax
+  800301:	78 06                	js     800309 <getchar+0x20>
+	if (r < 1)
+  800303:	74 06                	je     80030b <getchar+0x22>
+	return c;
+  800305:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+		return -E_EOF;
+  80030b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800310:	eb f7                	jmp    800309 <getchar+0x20>
+
+00800312 <iscons>:
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800318:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80031b:	50                   	push   %eax
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 a4 10 00 00       	call   8013c8 <fd_lookup>
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	85 c0                	test   %eax,%eax
+  800329:	78 11                	js     80033c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80032b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80032e:	8b 15 70 57 80 00    	mov    0x805770,%edx
+  800334:	39 10                	cmp    %edx,(%eax)
+  800336:	0f 94 c0             	sete   %al
+  800339:	0f b6 c0             	movzbl %al,%eax
+}
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+
+0080033e <opencons>:
+{
+  80033e:	55                   	push   %ebp
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800344:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800347:	50                   	push   %eax
+  800348:	e8 25 10 00 00       	call   801372 <fd_alloc>
+  80034d:	83 c4 10             	add    $0x10,%esp
+  800350:	85 c0                	test   %eax,%eax
+  800352:	78 3a                	js     80038e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800354:	83 ec 04             	sub    $0x4,%esp
+  800357:	68 07 04 00 00       	push   $0x407
+  80035c:	ff 75 f4             	push   -0xc(%ebp)
+  80035f:	6a 00                	push   $0x0
+  800361:	e8 c0 0b 00 00       	call   800f26 <sys_page_alloc>
+  800366:	83 c4 10             	add    $0x10,%esp
+  800369:	85 c0                	test   %eax,%eax
+  80036b:	78 21                	js     80038e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80036d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800370:	8b 15 70 57 80 00    	mov    0x805770,%edx
+  800376:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800378:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80037b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800382:	83 ec 0c             	sub    $0xc,%esp
+  800385:	50                   	push   %eax
+  800386:	e8 c0 0f 00 00       	call   80134b <fd2num>
+  80038b:	83 c4 10             	add    $0x10,%esp
+}
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+00800390 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	56                   	push   %esi
+  800394:	53                   	push   %ebx
+  800395:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800398:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80039b:	e8 e7 0a 00 00       	call   800e87 <sys_getenvid>
+  8003a0:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8003a5:	c1 e0 09             	shl    $0x9,%eax
+  8003a8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003ad:	a3 90 77 80 00       	mov    %eax,0x807790
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003b2:	85 db                	test   %ebx,%ebx
+  8003b4:	7e 07                	jle    8003bd <libmain+0x2d>
+		binaryname = argv[0];
+  8003b6:	8b 06                	mov    (%esi),%eax
+  8003b8:	a3 8c 57 80 00       	mov    %eax,0x80578c
+
+	// call user main routine
+	umain(argc, argv);
+  8003bd:	83 ec 08             	sub    $0x8,%esp
+  8003c0:	56                   	push   %esi
+  8003c1:	53                   	push   %ebx
+  8003c2:	e8 99 fc ff ff       	call   800060 <umain>
+
+	// exit gracefully
+	exit();
+  8003c7:	e8 0a 00 00 00       	call   8003d6 <exit>
+}
+  8003cc:	83 c4 10             	add    $0x10,%esp
+  8003cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003d2:	5b                   	pop    %ebx
+  8003d3:	5e                   	pop    %esi
+  8003d4:	5d                   	pop    %ebp
+  8003d5:	c3                   	ret
+
+008003d6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003d6:	55                   	push   %ebp
+  8003d7:	89 e5                	mov    %esp,%ebp
+  8003d9:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8003dc:	e8 3e 11 00 00       	call   80151f <close_all>
+	sys_env_destroy(0);
+  8003e1:	83 ec 0c             	sub    $0xc,%esp
+  8003e4:	6a 00                	push   $0x0
+  8003e6:	e8 5b 0a 00 00       	call   800e46 <sys_env_destroy>
+}
+  8003eb:	83 c4 10             	add    $0x10,%esp
+  8003ee:	c9                   	leave
+  8003ef:	c3                   	ret
+
+008003f0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003f0:	55                   	push   %ebp
+  8003f1:	89 e5                	mov    %esp,%ebp
+  8003f3:	56                   	push   %esi
+  8003f4:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003f5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003f8:	8b 35 8c 57 80 00    	mov    0x80578c,%esi
+  8003fe:	e8 84 0a 00 00       	call   800e87 <sys_getenvid>
+  800403:	83 ec 0c             	sub    $0xc,%esp
+  800406:	ff 75 0c             	push   0xc(%ebp)
+  800409:	ff 75 08             	push   0x8(%ebp)
+  80040c:	56                   	push   %esi
+  80040d:	50                   	push   %eax
+  80040e:	68 8c 30 80 00       	push   $0x80308c
+  800413:	e8 b3 00 00 00       	call   8004cb <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800418:	83 c4 18             	add    $0x18,%esp
+  80041b:	53                   	push   %ebx
+  80041c:	ff 75 10             	push   0x10(%ebp)
+  80041f:	e8 56 00 00 00       	call   80047a <vcprintf>
+	cprintf("\n");
+  800424:	c7 04 24 bc 35 80 00 	movl   $0x8035bc,(%esp)
+  80042b:	e8 9b 00 00 00       	call   8004cb <cprintf>
+  800430:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800433:	cc                   	int3
+	while (1)
+  800434:	eb fd                	jmp    800433 <_panic+0x43>
+
+00800436 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800436:	55                   	push   %ebp
+  800437:	89 e5                	mov    %esp,%ebp
+  800439:	53                   	push   %ebx
+  80043a:	83 ec 04             	sub    $0x4,%esp
+  80043d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800440:	8b 13                	mov    (%ebx),%edx
+  800442:	8d 42 01             	lea    0x1(%edx),%eax
+  800445:	89 03                	mov    %eax,(%ebx)
+  800447:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80044a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80044e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800453:	74 09                	je     80045e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800455:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800459:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80045c:	c9                   	leave
+  80045d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80045e:	83 ec 08             	sub    $0x8,%esp
+  800461:	68 ff 00 00 00       	push   $0xff
+  800466:	8d 43 08             	lea    0x8(%ebx),%eax
+  800469:	50                   	push   %eax
+  80046a:	e8 7a 09 00 00       	call   800de9 <sys_cputs>
+		b->idx = 0;
+  80046f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800475:	83 c4 10             	add    $0x10,%esp
+  800478:	eb db                	jmp    800455 <putch+0x1f>
+
+0080047a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80047a:	55                   	push   %ebp
+  80047b:	89 e5                	mov    %esp,%ebp
+  80047d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800483:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80048a:	00 00 00 
+	b.cnt = 0;
+  80048d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800494:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800497:	ff 75 0c             	push   0xc(%ebp)
+  80049a:	ff 75 08             	push   0x8(%ebp)
+  80049d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004a3:	50                   	push   %eax
+  8004a4:	68 36 04 80 00       	push   $0x800436
+  8004a9:	e8 14 01 00 00       	call   8005c2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004ae:	83 c4 08             	add    $0x8,%esp
+  8004b1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004b7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004bd:	50                   	push   %eax
+  8004be:	e8 26 09 00 00       	call   800de9 <sys_cputs>
+
+	return b.cnt;
+}
+  8004c3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004c9:	c9                   	leave
+  8004ca:	c3                   	ret
+
+008004cb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004cb:	55                   	push   %ebp
+  8004cc:	89 e5                	mov    %esp,%ebp
+  8004ce:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004d1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004d4:	50                   	push   %eax
+  8004d5:	ff 75 08             	push   0x8(%ebp)
+  8004d8:	e8 9d ff ff ff       	call   80047a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004dd:	c9                   	leave
+  8004de:	c3                   	ret
+
+008004df <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004df:	55                   	push   %ebp
+  8004e0:	89 e5                	mov    %esp,%ebp
+  8004e2:	57                   	push   %edi
+  8004e3:	56                   	push   %esi
+  8004e4:	53                   	push   %ebx
+  8004e5:	83 ec 1c             	sub    $0x1c,%esp
+  8004e8:	89 c7                	mov    %eax,%edi
+  8004ea:	89 d6                	mov    %edx,%esi
+  8004ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004f2:	89 d1                	mov    %edx,%ecx
+  8004f4:	89 c2                	mov    %eax,%edx
+  8004f6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004f9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004ff:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800502:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800505:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80050c:	39 c2                	cmp    %eax,%edx
+  80050e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800511:	72 3e                	jb     800551 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800513:	83 ec 0c             	sub    $0xc,%esp
+  800516:	ff 75 18             	push   0x18(%ebp)
+  800519:	83 eb 01             	sub    $0x1,%ebx
+  80051c:	53                   	push   %ebx
+  80051d:	50                   	push   %eax
+  80051e:	83 ec 08             	sub    $0x8,%esp
+  800521:	ff 75 e4             	push   -0x1c(%ebp)
+  800524:	ff 75 e0             	push   -0x20(%ebp)
+  800527:	ff 75 dc             	push   -0x24(%ebp)
+  80052a:	ff 75 d8             	push   -0x28(%ebp)
+  80052d:	e8 9e 26 00 00       	call   802bd0 <__udivdi3>
+  800532:	83 c4 18             	add    $0x18,%esp
+  800535:	52                   	push   %edx
+  800536:	50                   	push   %eax
+  800537:	89 f2                	mov    %esi,%edx
+  800539:	89 f8                	mov    %edi,%eax
+  80053b:	e8 9f ff ff ff       	call   8004df <printnum>
+  800540:	83 c4 20             	add    $0x20,%esp
+  800543:	eb 13                	jmp    800558 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800545:	83 ec 08             	sub    $0x8,%esp
+  800548:	56                   	push   %esi
+  800549:	ff 75 18             	push   0x18(%ebp)
+  80054c:	ff d7                	call   *%edi
+  80054e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800551:	83 eb 01             	sub    $0x1,%ebx
+  800554:	85 db                	test   %ebx,%ebx
+  800556:	7f ed                	jg     800545 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800558:	83 ec 08             	sub    $0x8,%esp
+  80055b:	56                   	push   %esi
+  80055c:	83 ec 04             	sub    $0x4,%esp
+  80055f:	ff 75 e4             	push   -0x1c(%ebp)
+  800562:	ff 75 e0             	push   -0x20(%ebp)
+  800565:	ff 75 dc             	push   -0x24(%ebp)
+  800568:	ff 75 d8             	push   -0x28(%ebp)
+  80056b:	e8 20 27 00 00       	call   802c90 <__umoddi3>
+  800570:	83 c4 14             	add    $0x14,%esp
+  800573:	0f be 80 af 30 80 00 	movsbl 0x8030af(%eax),%eax
+  80057a:	50                   	push   %eax
+  80057b:	ff d7                	call   *%edi
+}
+  80057d:	83 c4 10             	add    $0x10,%esp
+  800580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800583:	5b                   	pop    %ebx
+  800584:	5e                   	pop    %esi
+  800585:	5f                   	pop    %edi
+  800586:	5d                   	pop    %ebp
+  800587:	c3                   	ret
+
+00800588 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800588:	55                   	push   %ebp
+  800589:	89 e5                	mov    %esp,%ebp
+  80058b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80058e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800592:	8b 10                	mov    (%eax),%edx
+  800594:	3b 50 04             	cmp    0x4(%eax),%edx
+  800597:	73 0a                	jae    8005a3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800599:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80059c:	89 08                	mov    %ecx,(%eax)
+  80059e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a1:	88 02                	mov    %al,(%edx)
+}
+  8005a3:	5d                   	pop    %ebp
+  8005a4:	c3                   	ret
+
+008005a5 <printfmt>:
+{
+  8005a5:	55                   	push   %ebp
+  8005a6:	89 e5                	mov    %esp,%ebp
+  8005a8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005ab:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005ae:	50                   	push   %eax
+  8005af:	ff 75 10             	push   0x10(%ebp)
+  8005b2:	ff 75 0c             	push   0xc(%ebp)
+  8005b5:	ff 75 08             	push   0x8(%ebp)
+  8005b8:	e8 05 00 00 00       	call   8005c2 <vprintfmt>
+}
+  8005bd:	83 c4 10             	add    $0x10,%esp
+  8005c0:	c9                   	leave
+  8005c1:	c3                   	ret
+
+008005c2 <vprintfmt>:
+{
+  8005c2:	55                   	push   %ebp
+  8005c3:	89 e5                	mov    %esp,%ebp
+  8005c5:	57                   	push   %edi
+  8005c6:	56                   	push   %esi
+  8005c7:	53                   	push   %ebx
+  8005c8:	83 ec 2c             	sub    $0x2c,%esp
+  8005cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005d1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005d4:	eb 0a                	jmp    8005e0 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8005d6:	83 ec 08             	sub    $0x8,%esp
+  8005d9:	53                   	push   %ebx
+  8005da:	50                   	push   %eax
+  8005db:	ff d6                	call   *%esi
+  8005dd:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005e0:	83 c7 01             	add    $0x1,%edi
+  8005e3:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8005e7:	83 f8 25             	cmp    $0x25,%eax
+  8005ea:	74 0c                	je     8005f8 <vprintfmt+0x36>
+			if (ch == '\0')
+  8005ec:	85 c0                	test   %eax,%eax
+  8005ee:	75 e6                	jne    8005d6 <vprintfmt+0x14>
+}
+  8005f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005f3:	5b                   	pop    %ebx
+  8005f4:	5e                   	pop    %esi
+  8005f5:	5f                   	pop    %edi
+  8005f6:	5d                   	pop    %ebp
+  8005f7:	c3                   	ret
+		padc = ' ';
+  8005f8:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8005fc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800603:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80060a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800611:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800616:	8d 47 01             	lea    0x1(%edi),%eax
+  800619:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80061c:	0f b6 17             	movzbl (%edi),%edx
+  80061f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800622:	3c 55                	cmp    $0x55,%al
+  800624:	0f 87 cf 03 00 00    	ja     8009f9 <vprintfmt+0x437>
+  80062a:	0f b6 c0             	movzbl %al,%eax
+  80062d:	ff 24 85 00 32 80 00 	jmp    *0x803200(,%eax,4)
+  800634:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800637:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80063b:	eb d9                	jmp    800616 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80063d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800640:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800644:	eb d0                	jmp    800616 <vprintfmt+0x54>
+  800646:	0f b6 d2             	movzbl %dl,%edx
+  800649:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80064c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800651:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800654:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800657:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80065b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80065e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800661:	83 f9 09             	cmp    $0x9,%ecx
+  800664:	77 55                	ja     8006bb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800666:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800669:	eb e9                	jmp    800654 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80066b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066e:	8b 00                	mov    (%eax),%eax
+  800670:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8d 40 04             	lea    0x4(%eax),%eax
+  800679:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80067c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80067f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800683:	79 91                	jns    800616 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800685:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800688:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80068b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800692:	eb 82                	jmp    800616 <vprintfmt+0x54>
+			if (width < 0)
+  800694:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800697:	85 d2                	test   %edx,%edx
+  800699:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069e:	0f 49 c2             	cmovns %edx,%eax
+  8006a1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006a7:	e9 6a ff ff ff       	jmp    800616 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8006af:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006b6:	e9 5b ff ff ff       	jmp    800616 <vprintfmt+0x54>
+  8006bb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006be:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006c1:	eb bc                	jmp    80067f <vprintfmt+0xbd>
+			lflag++;
+  8006c3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006c6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006c9:	e9 48 ff ff ff       	jmp    800616 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d1:	8d 78 04             	lea    0x4(%eax),%edi
+  8006d4:	83 ec 08             	sub    $0x8,%esp
+  8006d7:	53                   	push   %ebx
+  8006d8:	ff 30                	push   (%eax)
+  8006da:	ff d6                	call   *%esi
+			break;
+  8006dc:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006df:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8006e2:	e9 b1 02 00 00       	jmp    800998 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8006e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ea:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8006ed:	8b 10                	mov    (%eax),%edx
+  8006ef:	89 d0                	mov    %edx,%eax
+  8006f1:	f7 d8                	neg    %eax
+  8006f3:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006f6:	83 f8 0f             	cmp    $0xf,%eax
+  8006f9:	7f 23                	jg     80071e <vprintfmt+0x15c>
+  8006fb:	8b 14 85 60 33 80 00 	mov    0x803360(,%eax,4),%edx
+  800702:	85 d2                	test   %edx,%edx
+  800704:	74 18                	je     80071e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800706:	52                   	push   %edx
+  800707:	68 95 34 80 00       	push   $0x803495
+  80070c:	53                   	push   %ebx
+  80070d:	56                   	push   %esi
+  80070e:	e8 92 fe ff ff       	call   8005a5 <printfmt>
+  800713:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800716:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800719:	e9 7a 02 00 00       	jmp    800998 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80071e:	50                   	push   %eax
+  80071f:	68 c7 30 80 00       	push   $0x8030c7
+  800724:	53                   	push   %ebx
+  800725:	56                   	push   %esi
+  800726:	e8 7a fe ff ff       	call   8005a5 <printfmt>
+  80072b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80072e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800731:	e9 62 02 00 00       	jmp    800998 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800736:	8b 45 14             	mov    0x14(%ebp),%eax
+  800739:	83 c0 04             	add    $0x4,%eax
+  80073c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80073f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800742:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800744:	85 c9                	test   %ecx,%ecx
+  800746:	b8 c0 30 80 00       	mov    $0x8030c0,%eax
+  80074b:	0f 45 c1             	cmovne %ecx,%eax
+  80074e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800751:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800755:	7e 06                	jle    80075d <vprintfmt+0x19b>
+  800757:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80075b:	75 0b                	jne    800768 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80075d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800760:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800763:	89 75 08             	mov    %esi,0x8(%ebp)
+  800766:	eb 5c                	jmp    8007c4 <vprintfmt+0x202>
+  800768:	83 ec 08             	sub    $0x8,%esp
+  80076b:	ff 75 d0             	push   -0x30(%ebp)
+  80076e:	ff 75 cc             	push   -0x34(%ebp)
+  800771:	e8 20 03 00 00       	call   800a96 <strnlen>
+  800776:	89 c2                	mov    %eax,%edx
+  800778:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80077b:	29 d0                	sub    %edx,%eax
+  80077d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800780:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800784:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800787:	89 75 08             	mov    %esi,0x8(%ebp)
+  80078a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80078c:	eb 0e                	jmp    80079c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80078e:	83 ec 08             	sub    $0x8,%esp
+  800791:	53                   	push   %ebx
+  800792:	57                   	push   %edi
+  800793:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800796:	83 ee 01             	sub    $0x1,%esi
+  800799:	83 c4 10             	add    $0x10,%esp
+  80079c:	85 f6                	test   %esi,%esi
+  80079e:	7f ee                	jg     80078e <vprintfmt+0x1cc>
+  8007a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a6:	85 c0                	test   %eax,%eax
+  8007a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007ad:	0f 49 d0             	cmovns %eax,%edx
+  8007b0:	29 d0                	sub    %edx,%eax
+  8007b2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007b5:	eb a6                	jmp    80075d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8007b7:	83 ec 08             	sub    $0x8,%esp
+  8007ba:	53                   	push   %ebx
+  8007bb:	52                   	push   %edx
+  8007bc:	ff 55 08             	call   *0x8(%ebp)
+  8007bf:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007c2:	89 f1                	mov    %esi,%ecx
+  8007c4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007c7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007cb:	0f be d0             	movsbl %al,%edx
+  8007ce:	85 d2                	test   %edx,%edx
+  8007d0:	74 28                	je     8007fa <vprintfmt+0x238>
+  8007d2:	85 ff                	test   %edi,%edi
+  8007d4:	78 05                	js     8007db <vprintfmt+0x219>
+  8007d6:	83 ef 01             	sub    $0x1,%edi
+  8007d9:	78 30                	js     80080b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007db:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007df:	74 d6                	je     8007b7 <vprintfmt+0x1f5>
+  8007e1:	0f be c0             	movsbl %al,%eax
+  8007e4:	83 e8 20             	sub    $0x20,%eax
+  8007e7:	83 f8 5e             	cmp    $0x5e,%eax
+  8007ea:	76 cb                	jbe    8007b7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8007ec:	83 ec 08             	sub    $0x8,%esp
+  8007ef:	53                   	push   %ebx
+  8007f0:	6a 3f                	push   $0x3f
+  8007f2:	ff 55 08             	call   *0x8(%ebp)
+  8007f5:	83 c4 10             	add    $0x10,%esp
+  8007f8:	eb c8                	jmp    8007c2 <vprintfmt+0x200>
+  8007fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007fd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800800:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800803:	01 d0                	add    %edx,%eax
+  800805:	29 c8                	sub    %ecx,%eax
+  800807:	89 c7                	mov    %eax,%edi
+  800809:	eb 13                	jmp    80081e <vprintfmt+0x25c>
+  80080b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80080e:	eb ed                	jmp    8007fd <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800810:	83 ec 08             	sub    $0x8,%esp
+  800813:	53                   	push   %ebx
+  800814:	6a 20                	push   $0x20
+  800816:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800818:	83 ef 01             	sub    $0x1,%edi
+  80081b:	83 c4 10             	add    $0x10,%esp
+  80081e:	85 ff                	test   %edi,%edi
+  800820:	7f ee                	jg     800810 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800822:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800825:	89 45 14             	mov    %eax,0x14(%ebp)
+  800828:	e9 6b 01 00 00       	jmp    800998 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80082d:	83 f9 01             	cmp    $0x1,%ecx
+  800830:	7f 1f                	jg     800851 <vprintfmt+0x28f>
+	else if (lflag)
+  800832:	85 c9                	test   %ecx,%ecx
+  800834:	74 67                	je     80089d <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800836:	8b 45 14             	mov    0x14(%ebp),%eax
+  800839:	8b 00                	mov    (%eax),%eax
+  80083b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80083e:	89 c1                	mov    %eax,%ecx
+  800840:	c1 f9 1f             	sar    $0x1f,%ecx
+  800843:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800846:	8b 45 14             	mov    0x14(%ebp),%eax
+  800849:	8d 40 04             	lea    0x4(%eax),%eax
+  80084c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084f:	eb 17                	jmp    800868 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800851:	8b 45 14             	mov    0x14(%ebp),%eax
+  800854:	8b 50 04             	mov    0x4(%eax),%edx
+  800857:	8b 00                	mov    (%eax),%eax
+  800859:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80085c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80085f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800862:	8d 40 08             	lea    0x8(%eax),%eax
+  800865:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800868:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80086b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80086e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800873:	85 c9                	test   %ecx,%ecx
+  800875:	0f 89 03 01 00 00    	jns    80097e <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80087b:	83 ec 08             	sub    $0x8,%esp
+  80087e:	53                   	push   %ebx
+  80087f:	6a 2d                	push   $0x2d
+  800881:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800883:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800886:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800889:	f7 da                	neg    %edx
+  80088b:	83 d1 00             	adc    $0x0,%ecx
+  80088e:	f7 d9                	neg    %ecx
+  800890:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800893:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800898:	e9 e1 00 00 00       	jmp    80097e <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80089d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a0:	8b 00                	mov    (%eax),%eax
+  8008a2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008a5:	89 c1                	mov    %eax,%ecx
+  8008a7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008aa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b6:	eb b0                	jmp    800868 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8008b8:	83 f9 01             	cmp    $0x1,%ecx
+  8008bb:	7f 1e                	jg     8008db <vprintfmt+0x319>
+	else if (lflag)
+  8008bd:	85 c9                	test   %ecx,%ecx
+  8008bf:	74 32                	je     8008f3 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8008c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c4:	8b 10                	mov    (%eax),%edx
+  8008c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8008d6:	e9 a3 00 00 00       	jmp    80097e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008de:	8b 10                	mov    (%eax),%edx
+  8008e0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008e3:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008e9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8008ee:	e9 8b 00 00 00       	jmp    80097e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f6:	8b 10                	mov    (%eax),%edx
+  8008f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800900:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800903:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800908:	eb 74                	jmp    80097e <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80090a:	83 f9 01             	cmp    $0x1,%ecx
+  80090d:	7f 1b                	jg     80092a <vprintfmt+0x368>
+	else if (lflag)
+  80090f:	85 c9                	test   %ecx,%ecx
+  800911:	74 2c                	je     80093f <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800913:	8b 45 14             	mov    0x14(%ebp),%eax
+  800916:	8b 10                	mov    (%eax),%edx
+  800918:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80091d:	8d 40 04             	lea    0x4(%eax),%eax
+  800920:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800923:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800928:	eb 54                	jmp    80097e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80092a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092d:	8b 10                	mov    (%eax),%edx
+  80092f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800932:	8d 40 08             	lea    0x8(%eax),%eax
+  800935:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800938:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80093d:	eb 3f                	jmp    80097e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80093f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800942:	8b 10                	mov    (%eax),%edx
+  800944:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800949:	8d 40 04             	lea    0x4(%eax),%eax
+  80094c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80094f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800954:	eb 28                	jmp    80097e <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800956:	83 ec 08             	sub    $0x8,%esp
+  800959:	53                   	push   %ebx
+  80095a:	6a 30                	push   $0x30
+  80095c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80095e:	83 c4 08             	add    $0x8,%esp
+  800961:	53                   	push   %ebx
+  800962:	6a 78                	push   $0x78
+  800964:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800966:	8b 45 14             	mov    0x14(%ebp),%eax
+  800969:	8b 10                	mov    (%eax),%edx
+  80096b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800970:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800973:	8d 40 04             	lea    0x4(%eax),%eax
+  800976:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800979:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80097e:	83 ec 0c             	sub    $0xc,%esp
+  800981:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800985:	50                   	push   %eax
+  800986:	ff 75 e0             	push   -0x20(%ebp)
+  800989:	57                   	push   %edi
+  80098a:	51                   	push   %ecx
+  80098b:	52                   	push   %edx
+  80098c:	89 da                	mov    %ebx,%edx
+  80098e:	89 f0                	mov    %esi,%eax
+  800990:	e8 4a fb ff ff       	call   8004df <printnum>
+			break;
+  800995:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800998:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80099b:	e9 40 fc ff ff       	jmp    8005e0 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8009a0:	83 f9 01             	cmp    $0x1,%ecx
+  8009a3:	7f 1b                	jg     8009c0 <vprintfmt+0x3fe>
+	else if (lflag)
+  8009a5:	85 c9                	test   %ecx,%ecx
+  8009a7:	74 2c                	je     8009d5 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8009a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ac:	8b 10                	mov    (%eax),%edx
+  8009ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009b9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8009be:	eb be                	jmp    80097e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c3:	8b 10                	mov    (%eax),%edx
+  8009c5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009c8:	8d 40 08             	lea    0x8(%eax),%eax
+  8009cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009ce:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8009d3:	eb a9                	jmp    80097e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8009d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d8:	8b 10                	mov    (%eax),%edx
+  8009da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009df:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009e5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8009ea:	eb 92                	jmp    80097e <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8009ec:	83 ec 08             	sub    $0x8,%esp
+  8009ef:	53                   	push   %ebx
+  8009f0:	6a 25                	push   $0x25
+  8009f2:	ff d6                	call   *%esi
+			break;
+  8009f4:	83 c4 10             	add    $0x10,%esp
+  8009f7:	eb 9f                	jmp    800998 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8009f9:	83 ec 08             	sub    $0x8,%esp
+  8009fc:	53                   	push   %ebx
+  8009fd:	6a 25                	push   $0x25
+  8009ff:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a01:	83 c4 10             	add    $0x10,%esp
+  800a04:	89 f8                	mov    %edi,%eax
+  800a06:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a0a:	74 05                	je     800a11 <vprintfmt+0x44f>
+  800a0c:	83 e8 01             	sub    $0x1,%eax
+  800a0f:	eb f5                	jmp    800a06 <vprintfmt+0x444>
+  800a11:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a14:	eb 82                	jmp    800998 <vprintfmt+0x3d6>
+
+00800a16 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	83 ec 18             	sub    $0x18,%esp
+  800a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a22:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a25:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a29:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a2c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a33:	85 c0                	test   %eax,%eax
+  800a35:	74 26                	je     800a5d <vsnprintf+0x47>
+  800a37:	85 d2                	test   %edx,%edx
+  800a39:	7e 22                	jle    800a5d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a3b:	ff 75 14             	push   0x14(%ebp)
+  800a3e:	ff 75 10             	push   0x10(%ebp)
+  800a41:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a44:	50                   	push   %eax
+  800a45:	68 88 05 80 00       	push   $0x800588
+  800a4a:	e8 73 fb ff ff       	call   8005c2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a4f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a52:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a58:	83 c4 10             	add    $0x10,%esp
+}
+  800a5b:	c9                   	leave
+  800a5c:	c3                   	ret
+		return -E_INVAL;
+  800a5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a62:	eb f7                	jmp    800a5b <vsnprintf+0x45>
+
+00800a64 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a64:	55                   	push   %ebp
+  800a65:	89 e5                	mov    %esp,%ebp
+  800a67:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a6a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a6d:	50                   	push   %eax
+  800a6e:	ff 75 10             	push   0x10(%ebp)
+  800a71:	ff 75 0c             	push   0xc(%ebp)
+  800a74:	ff 75 08             	push   0x8(%ebp)
+  800a77:	e8 9a ff ff ff       	call   800a16 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a7c:	c9                   	leave
+  800a7d:	c3                   	ret
+
+00800a7e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a7e:	55                   	push   %ebp
+  800a7f:	89 e5                	mov    %esp,%ebp
+  800a81:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a89:	eb 03                	jmp    800a8e <strlen+0x10>
+		n++;
+  800a8b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a8e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a92:	75 f7                	jne    800a8b <strlen+0xd>
+	return n;
+}
+  800a94:	5d                   	pop    %ebp
+  800a95:	c3                   	ret
+
+00800a96 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a96:	55                   	push   %ebp
+  800a97:	89 e5                	mov    %esp,%ebp
+  800a99:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa4:	eb 03                	jmp    800aa9 <strnlen+0x13>
+		n++;
+  800aa6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800aa9:	39 d0                	cmp    %edx,%eax
+  800aab:	74 08                	je     800ab5 <strnlen+0x1f>
+  800aad:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ab1:	75 f3                	jne    800aa6 <strnlen+0x10>
+  800ab3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800ab5:	89 d0                	mov    %edx,%eax
+  800ab7:	5d                   	pop    %ebp
+  800ab8:	c3                   	ret
+
+00800ab9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ab9:	55                   	push   %ebp
+  800aba:	89 e5                	mov    %esp,%ebp
+  800abc:	53                   	push   %ebx
+  800abd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ac0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800acc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800acf:	83 c0 01             	add    $0x1,%eax
+  800ad2:	84 d2                	test   %dl,%dl
+  800ad4:	75 f2                	jne    800ac8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ad6:	89 c8                	mov    %ecx,%eax
+  800ad8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800adb:	c9                   	leave
+  800adc:	c3                   	ret
+
+00800add <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800add:	55                   	push   %ebp
+  800ade:	89 e5                	mov    %esp,%ebp
+  800ae0:	53                   	push   %ebx
+  800ae1:	83 ec 10             	sub    $0x10,%esp
+  800ae4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800ae7:	53                   	push   %ebx
+  800ae8:	e8 91 ff ff ff       	call   800a7e <strlen>
+  800aed:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800af0:	ff 75 0c             	push   0xc(%ebp)
+  800af3:	01 d8                	add    %ebx,%eax
+  800af5:	50                   	push   %eax
+  800af6:	e8 be ff ff ff       	call   800ab9 <strcpy>
+	return dst;
+}
+  800afb:	89 d8                	mov    %ebx,%eax
+  800afd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b00:	c9                   	leave
+  800b01:	c3                   	ret
+
+00800b02 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b02:	55                   	push   %ebp
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	56                   	push   %esi
+  800b06:	53                   	push   %ebx
+  800b07:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b0d:	89 f3                	mov    %esi,%ebx
+  800b0f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b12:	89 f0                	mov    %esi,%eax
+  800b14:	eb 0f                	jmp    800b25 <strncpy+0x23>
+		*dst++ = *src;
+  800b16:	83 c0 01             	add    $0x1,%eax
+  800b19:	0f b6 0a             	movzbl (%edx),%ecx
+  800b1c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b1f:	80 f9 01             	cmp    $0x1,%cl
+  800b22:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b25:	39 d8                	cmp    %ebx,%eax
+  800b27:	75 ed                	jne    800b16 <strncpy+0x14>
+	}
+	return ret;
+}
+  800b29:	89 f0                	mov    %esi,%eax
+  800b2b:	5b                   	pop    %ebx
+  800b2c:	5e                   	pop    %esi
+  800b2d:	5d                   	pop    %ebp
+  800b2e:	c3                   	ret
+
+00800b2f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b2f:	55                   	push   %ebp
+  800b30:	89 e5                	mov    %esp,%ebp
+  800b32:	56                   	push   %esi
+  800b33:	53                   	push   %ebx
+  800b34:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b3a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b3d:	89 f0                	mov    %esi,%eax
+  800b3f:	85 d2                	test   %edx,%edx
+  800b41:	74 21                	je     800b64 <strlcpy+0x35>
+  800b43:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b47:	89 f2                	mov    %esi,%edx
+  800b49:	eb 09                	jmp    800b54 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b4b:	83 c1 01             	add    $0x1,%ecx
+  800b4e:	83 c2 01             	add    $0x1,%edx
+  800b51:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b54:	39 c2                	cmp    %eax,%edx
+  800b56:	74 09                	je     800b61 <strlcpy+0x32>
+  800b58:	0f b6 19             	movzbl (%ecx),%ebx
+  800b5b:	84 db                	test   %bl,%bl
+  800b5d:	75 ec                	jne    800b4b <strlcpy+0x1c>
+  800b5f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b61:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b64:	29 f0                	sub    %esi,%eax
+}
+  800b66:	5b                   	pop    %ebx
+  800b67:	5e                   	pop    %esi
+  800b68:	5d                   	pop    %ebp
+  800b69:	c3                   	ret
+
+00800b6a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b6a:	55                   	push   %ebp
+  800b6b:	89 e5                	mov    %esp,%ebp
+  800b6d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b70:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b73:	eb 06                	jmp    800b7b <strcmp+0x11>
+		p++, q++;
+  800b75:	83 c1 01             	add    $0x1,%ecx
+  800b78:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b7b:	0f b6 01             	movzbl (%ecx),%eax
+  800b7e:	84 c0                	test   %al,%al
+  800b80:	74 04                	je     800b86 <strcmp+0x1c>
+  800b82:	3a 02                	cmp    (%edx),%al
+  800b84:	74 ef                	je     800b75 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b86:	0f b6 c0             	movzbl %al,%eax
+  800b89:	0f b6 12             	movzbl (%edx),%edx
+  800b8c:	29 d0                	sub    %edx,%eax
+}
+  800b8e:	5d                   	pop    %ebp
+  800b8f:	c3                   	ret
+
+00800b90 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b90:	55                   	push   %ebp
+  800b91:	89 e5                	mov    %esp,%ebp
+  800b93:	53                   	push   %ebx
+  800b94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b9a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b9d:	eb 09                	jmp    800ba8 <strncmp+0x18>
+		n--, p++, q++;
+  800b9f:	83 ea 01             	sub    $0x1,%edx
+  800ba2:	83 c0 01             	add    $0x1,%eax
+  800ba5:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ba8:	85 d2                	test   %edx,%edx
+  800baa:	74 18                	je     800bc4 <strncmp+0x34>
+  800bac:	0f b6 18             	movzbl (%eax),%ebx
+  800baf:	84 db                	test   %bl,%bl
+  800bb1:	74 04                	je     800bb7 <strncmp+0x27>
+  800bb3:	3a 19                	cmp    (%ecx),%bl
+  800bb5:	74 e8                	je     800b9f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bb7:	0f b6 00             	movzbl (%eax),%eax
+  800bba:	0f b6 11             	movzbl (%ecx),%edx
+  800bbd:	29 d0                	sub    %edx,%eax
+}
+  800bbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bc2:	c9                   	leave
+  800bc3:	c3                   	ret
+		return 0;
+  800bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc9:	eb f4                	jmp    800bbf <strncmp+0x2f>
+
+00800bcb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bcb:	55                   	push   %ebp
+  800bcc:	89 e5                	mov    %esp,%ebp
+  800bce:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bd5:	eb 03                	jmp    800bda <strchr+0xf>
+  800bd7:	83 c0 01             	add    $0x1,%eax
+  800bda:	0f b6 10             	movzbl (%eax),%edx
+  800bdd:	84 d2                	test   %dl,%dl
+  800bdf:	74 06                	je     800be7 <strchr+0x1c>
+		if (*s == c)
+  800be1:	38 ca                	cmp    %cl,%dl
+  800be3:	75 f2                	jne    800bd7 <strchr+0xc>
+  800be5:	eb 05                	jmp    800bec <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800be7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bec:	5d                   	pop    %ebp
+  800bed:	c3                   	ret
+
+00800bee <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bee:	55                   	push   %ebp
+  800bef:	89 e5                	mov    %esp,%ebp
+  800bf1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bf8:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bfb:	38 ca                	cmp    %cl,%dl
+  800bfd:	74 09                	je     800c08 <strfind+0x1a>
+  800bff:	84 d2                	test   %dl,%dl
+  800c01:	74 05                	je     800c08 <strfind+0x1a>
+	for (; *s; s++)
+  800c03:	83 c0 01             	add    $0x1,%eax
+  800c06:	eb f0                	jmp    800bf8 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c08:	5d                   	pop    %ebp
+  800c09:	c3                   	ret
+
+00800c0a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c0a:	55                   	push   %ebp
+  800c0b:	89 e5                	mov    %esp,%ebp
+  800c0d:	57                   	push   %edi
+  800c0e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c11:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c14:	85 c9                	test   %ecx,%ecx
+  800c16:	74 20                	je     800c38 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c18:	89 f8                	mov    %edi,%eax
+  800c1a:	09 c8                	or     %ecx,%eax
+  800c1c:	a8 03                	test   $0x3,%al
+  800c1e:	75 12                	jne    800c32 <memset+0x28>
+		c &= 0xFF;
+  800c20:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c24:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c2a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c2d:	fc                   	cld
+  800c2e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c30:	eb 06                	jmp    800c38 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c32:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c35:	fc                   	cld
+  800c36:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c38:	89 f8                	mov    %edi,%eax
+  800c3a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c3d:	c9                   	leave
+  800c3e:	c3                   	ret
+
+00800c3f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c3f:	55                   	push   %ebp
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	57                   	push   %edi
+  800c43:	56                   	push   %esi
+  800c44:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c47:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c4a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c4d:	39 c6                	cmp    %eax,%esi
+  800c4f:	73 32                	jae    800c83 <memmove+0x44>
+  800c51:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c54:	39 d0                	cmp    %edx,%eax
+  800c56:	73 2b                	jae    800c83 <memmove+0x44>
+		s += n;
+		d += n;
+  800c58:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c5b:	89 d6                	mov    %edx,%esi
+  800c5d:	09 fe                	or     %edi,%esi
+  800c5f:	09 ce                	or     %ecx,%esi
+  800c61:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c67:	75 0e                	jne    800c77 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c69:	83 ef 04             	sub    $0x4,%edi
+  800c6c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c6f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c72:	fd                   	std
+  800c73:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c75:	eb 09                	jmp    800c80 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c77:	83 ef 01             	sub    $0x1,%edi
+  800c7a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c7d:	fd                   	std
+  800c7e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c80:	fc                   	cld
+  800c81:	eb 1a                	jmp    800c9d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c83:	89 f2                	mov    %esi,%edx
+  800c85:	09 c2                	or     %eax,%edx
+  800c87:	09 ca                	or     %ecx,%edx
+  800c89:	f6 c2 03             	test   $0x3,%dl
+  800c8c:	75 0a                	jne    800c98 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c8e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c91:	89 c7                	mov    %eax,%edi
+  800c93:	fc                   	cld
+  800c94:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c96:	eb 05                	jmp    800c9d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c98:	89 c7                	mov    %eax,%edi
+  800c9a:	fc                   	cld
+  800c9b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c9d:	5e                   	pop    %esi
+  800c9e:	5f                   	pop    %edi
+  800c9f:	5d                   	pop    %ebp
+  800ca0:	c3                   	ret
+
+00800ca1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ca1:	55                   	push   %ebp
+  800ca2:	89 e5                	mov    %esp,%ebp
+  800ca4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ca7:	ff 75 10             	push   0x10(%ebp)
+  800caa:	ff 75 0c             	push   0xc(%ebp)
+  800cad:	ff 75 08             	push   0x8(%ebp)
+  800cb0:	e8 8a ff ff ff       	call   800c3f <memmove>
+}
+  800cb5:	c9                   	leave
+  800cb6:	c3                   	ret
+
+00800cb7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cb7:	55                   	push   %ebp
+  800cb8:	89 e5                	mov    %esp,%ebp
+  800cba:	56                   	push   %esi
+  800cbb:	53                   	push   %ebx
+  800cbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cc2:	89 c6                	mov    %eax,%esi
+  800cc4:	03 75 10             	add    0x10(%ebp),%esi
+  800cc7:	eb 06                	jmp    800ccf <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cc9:	83 c0 01             	add    $0x1,%eax
+  800ccc:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ccf:	39 f0                	cmp    %esi,%eax
+  800cd1:	74 14                	je     800ce7 <memcmp+0x30>
+		if (*s1 != *s2)
+  800cd3:	0f b6 08             	movzbl (%eax),%ecx
+  800cd6:	0f b6 1a             	movzbl (%edx),%ebx
+  800cd9:	38 d9                	cmp    %bl,%cl
+  800cdb:	74 ec                	je     800cc9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800cdd:	0f b6 c1             	movzbl %cl,%eax
+  800ce0:	0f b6 db             	movzbl %bl,%ebx
+  800ce3:	29 d8                	sub    %ebx,%eax
+  800ce5:	eb 05                	jmp    800cec <memcmp+0x35>
+	}
+
+	return 0;
+  800ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cec:	5b                   	pop    %ebx
+  800ced:	5e                   	pop    %esi
+  800cee:	5d                   	pop    %ebp
+  800cef:	c3                   	ret
+
+00800cf0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cf9:	89 c2                	mov    %eax,%edx
+  800cfb:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cfe:	eb 03                	jmp    800d03 <memfind+0x13>
+  800d00:	83 c0 01             	add    $0x1,%eax
+  800d03:	39 d0                	cmp    %edx,%eax
+  800d05:	73 04                	jae    800d0b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d07:	38 08                	cmp    %cl,(%eax)
+  800d09:	75 f5                	jne    800d00 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+
+00800d0d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+  800d13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d19:	eb 03                	jmp    800d1e <strtol+0x11>
+		s++;
+  800d1b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d1e:	0f b6 02             	movzbl (%edx),%eax
+  800d21:	3c 20                	cmp    $0x20,%al
+  800d23:	74 f6                	je     800d1b <strtol+0xe>
+  800d25:	3c 09                	cmp    $0x9,%al
+  800d27:	74 f2                	je     800d1b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d29:	3c 2b                	cmp    $0x2b,%al
+  800d2b:	74 2a                	je     800d57 <strtol+0x4a>
+	int neg = 0;
+  800d2d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d32:	3c 2d                	cmp    $0x2d,%al
+  800d34:	74 2b                	je     800d61 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d36:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d3c:	75 0f                	jne    800d4d <strtol+0x40>
+  800d3e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d41:	74 28                	je     800d6b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d43:	85 db                	test   %ebx,%ebx
+  800d45:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d4a:	0f 44 d8             	cmove  %eax,%ebx
+  800d4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d52:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d55:	eb 46                	jmp    800d9d <strtol+0x90>
+		s++;
+  800d57:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d5f:	eb d5                	jmp    800d36 <strtol+0x29>
+		s++, neg = 1;
+  800d61:	83 c2 01             	add    $0x1,%edx
+  800d64:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d69:	eb cb                	jmp    800d36 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d6b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d6f:	74 0e                	je     800d7f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d71:	85 db                	test   %ebx,%ebx
+  800d73:	75 d8                	jne    800d4d <strtol+0x40>
+		s++, base = 8;
+  800d75:	83 c2 01             	add    $0x1,%edx
+  800d78:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d7d:	eb ce                	jmp    800d4d <strtol+0x40>
+		s += 2, base = 16;
+  800d7f:	83 c2 02             	add    $0x2,%edx
+  800d82:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d87:	eb c4                	jmp    800d4d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d89:	0f be c0             	movsbl %al,%eax
+  800d8c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d8f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d92:	7d 3a                	jge    800dce <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d94:	83 c2 01             	add    $0x1,%edx
+  800d97:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d9b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d9d:	0f b6 02             	movzbl (%edx),%eax
+  800da0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800da3:	89 f3                	mov    %esi,%ebx
+  800da5:	80 fb 09             	cmp    $0x9,%bl
+  800da8:	76 df                	jbe    800d89 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800daa:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800dad:	89 f3                	mov    %esi,%ebx
+  800daf:	80 fb 19             	cmp    $0x19,%bl
+  800db2:	77 08                	ja     800dbc <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800db4:	0f be c0             	movsbl %al,%eax
+  800db7:	83 e8 57             	sub    $0x57,%eax
+  800dba:	eb d3                	jmp    800d8f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800dbc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dbf:	89 f3                	mov    %esi,%ebx
+  800dc1:	80 fb 19             	cmp    $0x19,%bl
+  800dc4:	77 08                	ja     800dce <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800dc6:	0f be c0             	movsbl %al,%eax
+  800dc9:	83 e8 37             	sub    $0x37,%eax
+  800dcc:	eb c1                	jmp    800d8f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dce:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dd2:	74 05                	je     800dd9 <strtol+0xcc>
+		*endptr = (char *) s;
+  800dd4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dd7:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800dd9:	89 c8                	mov    %ecx,%eax
+  800ddb:	f7 d8                	neg    %eax
+  800ddd:	85 ff                	test   %edi,%edi
+  800ddf:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800de2:	89 c8                	mov    %ecx,%eax
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+
+00800de9 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	57                   	push   %edi
+  800ded:	56                   	push   %esi
+  800dee:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800def:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfa:	89 c3                	mov    %eax,%ebx
+  800dfc:	89 c7                	mov    %eax,%edi
+  800dfe:	89 c6                	mov    %eax,%esi
+  800e00:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e02:	5b                   	pop    %ebx
+  800e03:	5e                   	pop    %esi
+  800e04:	5f                   	pop    %edi
+  800e05:	5d                   	pop    %ebp
+  800e06:	c3                   	ret
+
+00800e07 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e07:	55                   	push   %ebp
+  800e08:	89 e5                	mov    %esp,%ebp
+  800e0a:	57                   	push   %edi
+  800e0b:	56                   	push   %esi
+  800e0c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e12:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e17:	89 d1                	mov    %edx,%ecx
+  800e19:	89 d3                	mov    %edx,%ebx
+  800e1b:	89 d7                	mov    %edx,%edi
+  800e1d:	89 d6                	mov    %edx,%esi
+  800e1f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e21:	5b                   	pop    %ebx
+  800e22:	5e                   	pop    %esi
+  800e23:	5f                   	pop    %edi
+  800e24:	5d                   	pop    %ebp
+  800e25:	c3                   	ret
+
+00800e26 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	57                   	push   %edi
+  800e2a:	56                   	push   %esi
+  800e2b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e34:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e39:	89 cb                	mov    %ecx,%ebx
+  800e3b:	89 cf                	mov    %ecx,%edi
+  800e3d:	89 ce                	mov    %ecx,%esi
+  800e3f:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5f                   	pop    %edi
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+
+00800e46 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	57                   	push   %edi
+  800e4a:	56                   	push   %esi
+  800e4b:	53                   	push   %ebx
+  800e4c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e57:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e5c:	89 cb                	mov    %ecx,%ebx
+  800e5e:	89 cf                	mov    %ecx,%edi
+  800e60:	89 ce                	mov    %ecx,%esi
+  800e62:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e64:	85 c0                	test   %eax,%eax
+  800e66:	7f 08                	jg     800e70 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6b:	5b                   	pop    %ebx
+  800e6c:	5e                   	pop    %esi
+  800e6d:	5f                   	pop    %edi
+  800e6e:	5d                   	pop    %ebp
+  800e6f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e70:	83 ec 0c             	sub    $0xc,%esp
+  800e73:	50                   	push   %eax
+  800e74:	6a 03                	push   $0x3
+  800e76:	68 bf 33 80 00       	push   $0x8033bf
+  800e7b:	6a 23                	push   $0x23
+  800e7d:	68 dc 33 80 00       	push   $0x8033dc
+  800e82:	e8 69 f5 ff ff       	call   8003f0 <_panic>
+
+00800e87 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e87:	55                   	push   %ebp
+  800e88:	89 e5                	mov    %esp,%ebp
+  800e8a:	57                   	push   %edi
+  800e8b:	56                   	push   %esi
+  800e8c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e92:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e97:	89 d1                	mov    %edx,%ecx
+  800e99:	89 d3                	mov    %edx,%ebx
+  800e9b:	89 d7                	mov    %edx,%edi
+  800e9d:	89 d6                	mov    %edx,%esi
+  800e9f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ea1:	5b                   	pop    %ebx
+  800ea2:	5e                   	pop    %esi
+  800ea3:	5f                   	pop    %edi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+
+00800ea6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	57                   	push   %edi
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb1:	b8 16 00 00 00       	mov    $0x16,%eax
+  800eb6:	89 d1                	mov    %edx,%ecx
+  800eb8:	89 d3                	mov    %edx,%ebx
+  800eba:	89 d7                	mov    %edx,%edi
+  800ebc:	89 d6                	mov    %edx,%esi
+  800ebe:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5f                   	pop    %edi
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+
+00800ec5 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ecb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ed5:	89 d1                	mov    %edx,%ecx
+  800ed7:	89 d3                	mov    %edx,%ebx
+  800ed9:	89 d7                	mov    %edx,%edi
+  800edb:	89 d6                	mov    %edx,%esi
+  800edd:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800edf:	5b                   	pop    %ebx
+  800ee0:	5e                   	pop    %esi
+  800ee1:	5f                   	pop    %edi
+  800ee2:	5d                   	pop    %ebp
+  800ee3:	c3                   	ret
+
+00800ee4 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	57                   	push   %edi
+  800ee8:	56                   	push   %esi
+  800ee9:	53                   	push   %ebx
+  800eea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef8:	b8 15 00 00 00       	mov    $0x15,%eax
+  800efd:	89 df                	mov    %ebx,%edi
+  800eff:	89 de                	mov    %ebx,%esi
+  800f01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f03:	85 c0                	test   %eax,%eax
+  800f05:	7f 08                	jg     800f0f <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800f07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0a:	5b                   	pop    %ebx
+  800f0b:	5e                   	pop    %esi
+  800f0c:	5f                   	pop    %edi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0f:	83 ec 0c             	sub    $0xc,%esp
+  800f12:	50                   	push   %eax
+  800f13:	6a 15                	push   $0x15
+  800f15:	68 bf 33 80 00       	push   $0x8033bf
+  800f1a:	6a 23                	push   $0x23
+  800f1c:	68 dc 33 80 00       	push   $0x8033dc
+  800f21:	e8 ca f4 ff ff       	call   8003f0 <_panic>
+
+00800f26 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f26:	55                   	push   %ebp
+  800f27:	89 e5                	mov    %esp,%ebp
+  800f29:	57                   	push   %edi
+  800f2a:	56                   	push   %esi
+  800f2b:	53                   	push   %ebx
+  800f2c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f2f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f42:	89 f7                	mov    %esi,%edi
+  800f44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f46:	85 c0                	test   %eax,%eax
+  800f48:	7f 08                	jg     800f52 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+  800f55:	50                   	push   %eax
+  800f56:	6a 05                	push   $0x5
+  800f58:	68 bf 33 80 00       	push   $0x8033bf
+  800f5d:	6a 23                	push   $0x23
+  800f5f:	68 dc 33 80 00       	push   $0x8033dc
+  800f64:	e8 87 f4 ff ff       	call   8003f0 <_panic>
+
+00800f69 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	57                   	push   %edi
+  800f6d:	56                   	push   %esi
+  800f6e:	53                   	push   %ebx
+  800f6f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f72:	be 00 00 00 00       	mov    $0x0,%esi
+  800f77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f85:	89 f7                	mov    %esi,%edi
+  800f87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f89:	85 c0                	test   %eax,%eax
+  800f8b:	7f 08                	jg     800f95 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f90:	5b                   	pop    %ebx
+  800f91:	5e                   	pop    %esi
+  800f92:	5f                   	pop    %edi
+  800f93:	5d                   	pop    %ebp
+  800f94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f95:	83 ec 0c             	sub    $0xc,%esp
+  800f98:	50                   	push   %eax
+  800f99:	6a 06                	push   $0x6
+  800f9b:	68 bf 33 80 00       	push   $0x8033bf
+  800fa0:	6a 23                	push   $0x23
+  800fa2:	68 dc 33 80 00       	push   $0x8033dc
+  800fa7:	e8 44 f4 ff ff       	call   8003f0 <_panic>
+
+00800fac <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fac:	55                   	push   %ebp
+  800fad:	89 e5                	mov    %esp,%ebp
+  800faf:	57                   	push   %edi
+  800fb0:	56                   	push   %esi
+  800fb1:	53                   	push   %ebx
+  800fb2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbb:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fc0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc6:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fc9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fcb:	85 c0                	test   %eax,%eax
+  800fcd:	7f 08                	jg     800fd7 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd2:	5b                   	pop    %ebx
+  800fd3:	5e                   	pop    %esi
+  800fd4:	5f                   	pop    %edi
+  800fd5:	5d                   	pop    %ebp
+  800fd6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd7:	83 ec 0c             	sub    $0xc,%esp
+  800fda:	50                   	push   %eax
+  800fdb:	6a 07                	push   $0x7
+  800fdd:	68 bf 33 80 00       	push   $0x8033bf
+  800fe2:	6a 23                	push   $0x23
+  800fe4:	68 dc 33 80 00       	push   $0x8033dc
+  800fe9:	e8 02 f4 ff ff       	call   8003f0 <_panic>
+
+00800fee <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	57                   	push   %edi
+  800ff2:	56                   	push   %esi
+  800ff3:	53                   	push   %ebx
+  800ff4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ff7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801002:	b8 08 00 00 00       	mov    $0x8,%eax
+  801007:	89 df                	mov    %ebx,%edi
+  801009:	89 de                	mov    %ebx,%esi
+  80100b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80100d:	85 c0                	test   %eax,%eax
+  80100f:	7f 08                	jg     801019 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801011:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801014:	5b                   	pop    %ebx
+  801015:	5e                   	pop    %esi
+  801016:	5f                   	pop    %edi
+  801017:	5d                   	pop    %ebp
+  801018:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801019:	83 ec 0c             	sub    $0xc,%esp
+  80101c:	50                   	push   %eax
+  80101d:	6a 08                	push   $0x8
+  80101f:	68 bf 33 80 00       	push   $0x8033bf
+  801024:	6a 23                	push   $0x23
+  801026:	68 dc 33 80 00       	push   $0x8033dc
+  80102b:	e8 c0 f3 ff ff       	call   8003f0 <_panic>
+
+00801030 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  801030:	55                   	push   %ebp
+  801031:	89 e5                	mov    %esp,%ebp
+  801033:	57                   	push   %edi
+  801034:	56                   	push   %esi
+  801035:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801041:	be 00 00 00 00       	mov    $0x0,%esi
+  801046:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801049:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80104c:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  80104e:	5b                   	pop    %ebx
+  80104f:	5e                   	pop    %esi
+  801050:	5f                   	pop    %edi
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+
+00801053 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	56                   	push   %esi
+  801058:	53                   	push   %ebx
+  801059:	8b 45 18             	mov    0x18(%ebp),%eax
+  80105c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  80105f:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  801064:	77 27                	ja     80108d <sys_page_map_range+0x3a>
+  801066:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80106c:	77 1f                	ja     80108d <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  80106e:	c1 e0 0c             	shl    $0xc,%eax
+  801071:	89 c6                	mov    %eax,%esi
+  801073:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  801075:	8b 55 08             	mov    0x8(%ebp),%edx
+  801078:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801080:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801083:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801086:	cd 30                	int    $0x30
+}
+  801088:	5b                   	pop    %ebx
+  801089:	5e                   	pop    %esi
+  80108a:	5f                   	pop    %edi
+  80108b:	5d                   	pop    %ebp
+  80108c:	c3                   	ret
+		return -E_INVAL;
+  80108d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801092:	eb f4                	jmp    801088 <sys_page_map_range+0x35>
+
+00801094 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	57                   	push   %edi
+  801098:	56                   	push   %esi
+  801099:	53                   	push   %ebx
+  80109a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80109d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010b5:	85 c0                	test   %eax,%eax
+  8010b7:	7f 08                	jg     8010c1 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8010b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010bc:	5b                   	pop    %ebx
+  8010bd:	5e                   	pop    %esi
+  8010be:	5f                   	pop    %edi
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c1:	83 ec 0c             	sub    $0xc,%esp
+  8010c4:	50                   	push   %eax
+  8010c5:	6a 0c                	push   $0xc
+  8010c7:	68 bf 33 80 00       	push   $0x8033bf
+  8010cc:	6a 23                	push   $0x23
+  8010ce:	68 dc 33 80 00       	push   $0x8033dc
+  8010d3:	e8 18 f3 ff ff       	call   8003f0 <_panic>
+
+008010d8 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010de:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f1:	89 f7                	mov    %esi,%edi
+  8010f3:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8010f5:	5b                   	pop    %ebx
+  8010f6:	5e                   	pop    %esi
+  8010f7:	5f                   	pop    %edi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+
+008010fa <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	57                   	push   %edi
+  8010fe:	56                   	push   %esi
+  8010ff:	53                   	push   %ebx
+  801100:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801103:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801108:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801113:	89 df                	mov    %ebx,%edi
+  801115:	89 de                	mov    %ebx,%esi
+  801117:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801119:	85 c0                	test   %eax,%eax
+  80111b:	7f 08                	jg     801125 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80111d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801120:	5b                   	pop    %ebx
+  801121:	5e                   	pop    %esi
+  801122:	5f                   	pop    %edi
+  801123:	5d                   	pop    %ebp
+  801124:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801125:	83 ec 0c             	sub    $0xc,%esp
+  801128:	50                   	push   %eax
+  801129:	6a 0f                	push   $0xf
+  80112b:	68 bf 33 80 00       	push   $0x8033bf
+  801130:	6a 23                	push   $0x23
+  801132:	68 dc 33 80 00       	push   $0x8033dc
+  801137:	e8 b4 f2 ff ff       	call   8003f0 <_panic>
+
+0080113c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	57                   	push   %edi
+  801140:	56                   	push   %esi
+  801141:	53                   	push   %ebx
+  801142:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801145:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801150:	b8 10 00 00 00       	mov    $0x10,%eax
+  801155:	89 df                	mov    %ebx,%edi
+  801157:	89 de                	mov    %ebx,%esi
+  801159:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80115b:	85 c0                	test   %eax,%eax
+  80115d:	7f 08                	jg     801167 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  80115f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801162:	5b                   	pop    %ebx
+  801163:	5e                   	pop    %esi
+  801164:	5f                   	pop    %edi
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801167:	83 ec 0c             	sub    $0xc,%esp
+  80116a:	50                   	push   %eax
+  80116b:	6a 10                	push   $0x10
+  80116d:	68 bf 33 80 00       	push   $0x8033bf
+  801172:	6a 23                	push   $0x23
+  801174:	68 dc 33 80 00       	push   $0x8033dc
+  801179:	e8 72 f2 ff ff       	call   8003f0 <_panic>
+
+0080117e <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	57                   	push   %edi
+  801182:	56                   	push   %esi
+  801183:	53                   	push   %ebx
+  801184:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801187:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801192:	b8 11 00 00 00       	mov    $0x11,%eax
+  801197:	89 df                	mov    %ebx,%edi
+  801199:	89 de                	mov    %ebx,%esi
+  80119b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80119d:	85 c0                	test   %eax,%eax
+  80119f:	7f 08                	jg     8011a9 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  8011a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a4:	5b                   	pop    %ebx
+  8011a5:	5e                   	pop    %esi
+  8011a6:	5f                   	pop    %edi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a9:	83 ec 0c             	sub    $0xc,%esp
+  8011ac:	50                   	push   %eax
+  8011ad:	6a 11                	push   $0x11
+  8011af:	68 bf 33 80 00       	push   $0x8033bf
+  8011b4:	6a 23                	push   $0x23
+  8011b6:	68 dc 33 80 00       	push   $0x8033dc
+  8011bb:	e8 30 f2 ff ff       	call   8003f0 <_panic>
+
+008011c0 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  8011c0:	55                   	push   %ebp
+  8011c1:	89 e5                	mov    %esp,%ebp
+  8011c3:	57                   	push   %edi
+  8011c4:	56                   	push   %esi
+  8011c5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011cb:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011d0:	89 d1                	mov    %edx,%ecx
+  8011d2:	89 d3                	mov    %edx,%ebx
+  8011d4:	89 d7                	mov    %edx,%edi
+  8011d6:	89 d6                	mov    %edx,%esi
+  8011d8:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  8011da:	5b                   	pop    %ebx
+  8011db:	5e                   	pop    %esi
+  8011dc:	5f                   	pop    %edi
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+
+008011df <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	57                   	push   %edi
+  8011e3:	56                   	push   %esi
+  8011e4:	53                   	push   %ebx
+  8011e5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011f8:	89 df                	mov    %ebx,%edi
+  8011fa:	89 de                	mov    %ebx,%esi
+  8011fc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011fe:	85 c0                	test   %eax,%eax
+  801200:	7f 08                	jg     80120a <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801202:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801205:	5b                   	pop    %ebx
+  801206:	5e                   	pop    %esi
+  801207:	5f                   	pop    %edi
+  801208:	5d                   	pop    %ebp
+  801209:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80120a:	83 ec 0c             	sub    $0xc,%esp
+  80120d:	50                   	push   %eax
+  80120e:	6a 13                	push   $0x13
+  801210:	68 bf 33 80 00       	push   $0x8033bf
+  801215:	6a 23                	push   $0x23
+  801217:	68 dc 33 80 00       	push   $0x8033dc
+  80121c:	e8 cf f1 ff ff       	call   8003f0 <_panic>
+
+00801221 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	57                   	push   %edi
+  801225:	56                   	push   %esi
+  801226:	53                   	push   %ebx
+  801227:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80122a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801232:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801235:	b8 14 00 00 00       	mov    $0x14,%eax
+  80123a:	89 df                	mov    %ebx,%edi
+  80123c:	89 de                	mov    %ebx,%esi
+  80123e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801240:	85 c0                	test   %eax,%eax
+  801242:	7f 08                	jg     80124c <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801244:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801247:	5b                   	pop    %ebx
+  801248:	5e                   	pop    %esi
+  801249:	5f                   	pop    %edi
+  80124a:	5d                   	pop    %ebp
+  80124b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80124c:	83 ec 0c             	sub    $0xc,%esp
+  80124f:	50                   	push   %eax
+  801250:	6a 14                	push   $0x14
+  801252:	68 bf 33 80 00       	push   $0x8033bf
+  801257:	6a 23                	push   $0x23
+  801259:	68 dc 33 80 00       	push   $0x8033dc
+  80125e:	e8 8d f1 ff ff       	call   8003f0 <_panic>
+
+00801263 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	57                   	push   %edi
+  801267:	56                   	push   %esi
+  801268:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801269:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801274:	be 00 00 00 00       	mov    $0x0,%esi
+  801279:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80127c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80127f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801281:	5b                   	pop    %ebx
+  801282:	5e                   	pop    %esi
+  801283:	5f                   	pop    %edi
+  801284:	5d                   	pop    %ebp
+  801285:	c3                   	ret
+
+00801286 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801286:	55                   	push   %ebp
+  801287:	89 e5                	mov    %esp,%ebp
+  801289:	57                   	push   %edi
+  80128a:	56                   	push   %esi
+  80128b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80128c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801292:	b8 18 00 00 00       	mov    $0x18,%eax
+  801297:	be 00 00 00 00       	mov    $0x0,%esi
+  80129c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80129f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012a2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8012a4:	5b                   	pop    %ebx
+  8012a5:	5e                   	pop    %esi
+  8012a6:	5f                   	pop    %edi
+  8012a7:	5d                   	pop    %ebp
+  8012a8:	c3                   	ret
+
+008012a9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8012a9:	55                   	push   %ebp
+  8012aa:	89 e5                	mov    %esp,%ebp
+  8012ac:	57                   	push   %edi
+  8012ad:	56                   	push   %esi
+  8012ae:	53                   	push   %ebx
+  8012af:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ba:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012bf:	89 cb                	mov    %ecx,%ebx
+  8012c1:	89 cf                	mov    %ecx,%edi
+  8012c3:	89 ce                	mov    %ecx,%esi
+  8012c5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012c7:	85 c0                	test   %eax,%eax
+  8012c9:	7f 08                	jg     8012d3 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8012cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ce:	5b                   	pop    %ebx
+  8012cf:	5e                   	pop    %esi
+  8012d0:	5f                   	pop    %edi
+  8012d1:	5d                   	pop    %ebp
+  8012d2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d3:	83 ec 0c             	sub    $0xc,%esp
+  8012d6:	50                   	push   %eax
+  8012d7:	6a 19                	push   $0x19
+  8012d9:	68 bf 33 80 00       	push   $0x8033bf
+  8012de:	6a 23                	push   $0x23
+  8012e0:	68 dc 33 80 00       	push   $0x8033dc
+  8012e5:	e8 06 f1 ff ff       	call   8003f0 <_panic>
+
+008012ea <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	57                   	push   %edi
+  8012ee:	56                   	push   %esi
+  8012ef:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8012fa:	89 d1                	mov    %edx,%ecx
+  8012fc:	89 d3                	mov    %edx,%ebx
+  8012fe:	89 d7                	mov    %edx,%edi
+  801300:	89 d6                	mov    %edx,%esi
+  801302:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801304:	5b                   	pop    %ebx
+  801305:	5e                   	pop    %esi
+  801306:	5f                   	pop    %edi
+  801307:	5d                   	pop    %ebp
+  801308:	c3                   	ret
+
+00801309 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801309:	55                   	push   %ebp
+  80130a:	89 e5                	mov    %esp,%ebp
+  80130c:	57                   	push   %edi
+  80130d:	56                   	push   %esi
+  80130e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80130f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801314:	8b 55 08             	mov    0x8(%ebp),%edx
+  801317:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80131f:	89 df                	mov    %ebx,%edi
+  801321:	89 de                	mov    %ebx,%esi
+  801323:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801325:	5b                   	pop    %ebx
+  801326:	5e                   	pop    %esi
+  801327:	5f                   	pop    %edi
+  801328:	5d                   	pop    %ebp
+  801329:	c3                   	ret
+
+0080132a <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  80132a:	55                   	push   %ebp
+  80132b:	89 e5                	mov    %esp,%ebp
+  80132d:	57                   	push   %edi
+  80132e:	56                   	push   %esi
+  80132f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801330:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801335:	8b 55 08             	mov    0x8(%ebp),%edx
+  801338:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801340:	89 df                	mov    %ebx,%edi
+  801342:	89 de                	mov    %ebx,%esi
+  801344:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801346:	5b                   	pop    %ebx
+  801347:	5e                   	pop    %esi
+  801348:	5f                   	pop    %edi
+  801349:	5d                   	pop    %ebp
+  80134a:	c3                   	ret
+
+0080134b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80134b:	55                   	push   %ebp
+  80134c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80134e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801351:	05 00 00 00 30       	add    $0x30000000,%eax
+  801356:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801359:	5d                   	pop    %ebp
+  80135a:	c3                   	ret
+
+0080135b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80135b:	55                   	push   %ebp
+  80135c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80135e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801361:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801366:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80136b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801370:	5d                   	pop    %ebp
+  801371:	c3                   	ret
+
+00801372 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801372:	55                   	push   %ebp
+  801373:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801375:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80137a:	eb 02                	jmp    80137e <fd_alloc+0xc>
+  80137c:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80137e:	89 c2                	mov    %eax,%edx
+  801380:	c1 ea 16             	shr    $0x16,%edx
+  801383:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80138a:	f6 c2 01             	test   $0x1,%dl
+  80138d:	74 2b                	je     8013ba <fd_alloc+0x48>
+  80138f:	89 c2                	mov    %eax,%edx
+  801391:	c1 ea 0c             	shr    $0xc,%edx
+  801394:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80139b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8013a1:	f6 c1 01             	test   $0x1,%cl
+  8013a4:	74 14                	je     8013ba <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8013a6:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8013ac:	75 ce                	jne    80137c <fd_alloc+0xa>
+  8013ae:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013b3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8013b8:	eb 05                	jmp    8013bf <fd_alloc+0x4d>
+			return 0;
+  8013ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8013bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c2:	89 02                	mov    %eax,(%edx)
+}
+  8013c4:	89 c8                	mov    %ecx,%eax
+  8013c6:	5d                   	pop    %ebp
+  8013c7:	c3                   	ret
+
+008013c8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013c8:	55                   	push   %ebp
+  8013c9:	89 e5                	mov    %esp,%ebp
+  8013cb:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8013ce:	83 f8 1f             	cmp    $0x1f,%eax
+  8013d1:	77 30                	ja     801403 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8013d3:	c1 e0 0c             	shl    $0xc,%eax
+  8013d6:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013db:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013e1:	f6 c2 01             	test   $0x1,%dl
+  8013e4:	74 24                	je     80140a <fd_lookup+0x42>
+  8013e6:	89 c2                	mov    %eax,%edx
+  8013e8:	c1 ea 0c             	shr    $0xc,%edx
+  8013eb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013f2:	f6 c2 01             	test   $0x1,%dl
+  8013f5:	74 1a                	je     801411 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013fa:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801401:	5d                   	pop    %ebp
+  801402:	c3                   	ret
+		return -E_INVAL;
+  801403:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801408:	eb f7                	jmp    801401 <fd_lookup+0x39>
+		return -E_INVAL;
+  80140a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80140f:	eb f0                	jmp    801401 <fd_lookup+0x39>
+  801411:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801416:	eb e9                	jmp    801401 <fd_lookup+0x39>
+
+00801418 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801418:	55                   	push   %ebp
+  801419:	89 e5                	mov    %esp,%ebp
+  80141b:	53                   	push   %ebx
+  80141c:	83 ec 04             	sub    $0x4,%esp
+  80141f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801422:	b8 00 00 00 00       	mov    $0x0,%eax
+  801427:	eb 03                	jmp    80142c <dev_lookup+0x14>
+  801429:	83 c0 01             	add    $0x1,%eax
+  80142c:	8b 1c 85 68 34 80 00 	mov    0x803468(,%eax,4),%ebx
+  801433:	85 db                	test   %ebx,%ebx
+  801435:	74 0b                	je     801442 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801437:	39 13                	cmp    %edx,(%ebx)
+  801439:	75 ee                	jne    801429 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80143b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801440:	eb 1f                	jmp    801461 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801442:	a1 90 77 80 00       	mov    0x807790,%eax
+  801447:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80144a:	83 ec 04             	sub    $0x4,%esp
+  80144d:	52                   	push   %edx
+  80144e:	50                   	push   %eax
+  80144f:	68 ec 33 80 00       	push   $0x8033ec
+  801454:	e8 72 f0 ff ff       	call   8004cb <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801459:	83 c4 10             	add    $0x10,%esp
+  80145c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801461:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801464:	89 1a                	mov    %ebx,(%edx)
+}
+  801466:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801469:	c9                   	leave
+  80146a:	c3                   	ret
+
+0080146b <fd_close>:
+{
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	57                   	push   %edi
+  80146f:	56                   	push   %esi
+  801470:	53                   	push   %ebx
+  801471:	83 ec 24             	sub    $0x24,%esp
+  801474:	8b 75 08             	mov    0x8(%ebp),%esi
+  801477:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80147a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80147d:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80147e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801484:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801487:	50                   	push   %eax
+  801488:	e8 3b ff ff ff       	call   8013c8 <fd_lookup>
+  80148d:	89 c3                	mov    %eax,%ebx
+  80148f:	83 c4 10             	add    $0x10,%esp
+  801492:	85 c0                	test   %eax,%eax
+  801494:	78 05                	js     80149b <fd_close+0x30>
+	    || fd != fd2)
+  801496:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801499:	74 16                	je     8014b1 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80149b:	89 f8                	mov    %edi,%eax
+  80149d:	84 c0                	test   %al,%al
+  80149f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a4:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014a7:	89 d8                	mov    %ebx,%eax
+  8014a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ac:	5b                   	pop    %ebx
+  8014ad:	5e                   	pop    %esi
+  8014ae:	5f                   	pop    %edi
+  8014af:	5d                   	pop    %ebp
+  8014b0:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014b1:	83 ec 08             	sub    $0x8,%esp
+  8014b4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014b7:	50                   	push   %eax
+  8014b8:	ff 36                	push   (%esi)
+  8014ba:	e8 59 ff ff ff       	call   801418 <dev_lookup>
+  8014bf:	89 c3                	mov    %eax,%ebx
+  8014c1:	83 c4 10             	add    $0x10,%esp
+  8014c4:	85 c0                	test   %eax,%eax
+  8014c6:	78 1a                	js     8014e2 <fd_close+0x77>
+		if (dev->dev_close)
+  8014c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014cb:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014d3:	85 c0                	test   %eax,%eax
+  8014d5:	74 0b                	je     8014e2 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8014d7:	83 ec 0c             	sub    $0xc,%esp
+  8014da:	56                   	push   %esi
+  8014db:	ff d0                	call   *%eax
+  8014dd:	89 c3                	mov    %eax,%ebx
+  8014df:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014e2:	83 ec 08             	sub    $0x8,%esp
+  8014e5:	56                   	push   %esi
+  8014e6:	6a 00                	push   $0x0
+  8014e8:	e8 01 fb ff ff       	call   800fee <sys_page_unmap>
+	return r;
+  8014ed:	83 c4 10             	add    $0x10,%esp
+  8014f0:	eb b5                	jmp    8014a7 <fd_close+0x3c>
+
+008014f2 <close>:
+
+int
+close(int fdnum)
+{
+  8014f2:	55                   	push   %ebp
+  8014f3:	89 e5                	mov    %esp,%ebp
+  8014f5:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014fb:	50                   	push   %eax
+  8014fc:	ff 75 08             	push   0x8(%ebp)
+  8014ff:	e8 c4 fe ff ff       	call   8013c8 <fd_lookup>
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	85 c0                	test   %eax,%eax
+  801509:	79 02                	jns    80150d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80150b:	c9                   	leave
+  80150c:	c3                   	ret
+		return fd_close(fd, 1);
+  80150d:	83 ec 08             	sub    $0x8,%esp
+  801510:	6a 01                	push   $0x1
+  801512:	ff 75 f4             	push   -0xc(%ebp)
+  801515:	e8 51 ff ff ff       	call   80146b <fd_close>
+  80151a:	83 c4 10             	add    $0x10,%esp
+  80151d:	eb ec                	jmp    80150b <close+0x19>
+
+0080151f <close_all>:
+
+void
+close_all(void)
+{
+  80151f:	55                   	push   %ebp
+  801520:	89 e5                	mov    %esp,%ebp
+  801522:	53                   	push   %ebx
+  801523:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801526:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80152b:	83 ec 0c             	sub    $0xc,%esp
+  80152e:	53                   	push   %ebx
+  80152f:	e8 be ff ff ff       	call   8014f2 <close>
+	for (i = 0; i < MAXFD; i++)
+  801534:	83 c3 01             	add    $0x1,%ebx
+  801537:	83 c4 10             	add    $0x10,%esp
+  80153a:	83 fb 20             	cmp    $0x20,%ebx
+  80153d:	75 ec                	jne    80152b <close_all+0xc>
+}
+  80153f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801542:	c9                   	leave
+  801543:	c3                   	ret
+
+00801544 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801544:	55                   	push   %ebp
+  801545:	89 e5                	mov    %esp,%ebp
+  801547:	57                   	push   %edi
+  801548:	56                   	push   %esi
+  801549:	53                   	push   %ebx
+  80154a:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80154d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801550:	50                   	push   %eax
+  801551:	ff 75 08             	push   0x8(%ebp)
+  801554:	e8 6f fe ff ff       	call   8013c8 <fd_lookup>
+  801559:	89 c3                	mov    %eax,%ebx
+  80155b:	83 c4 10             	add    $0x10,%esp
+  80155e:	85 c0                	test   %eax,%eax
+  801560:	78 7f                	js     8015e1 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801562:	83 ec 0c             	sub    $0xc,%esp
+  801565:	ff 75 0c             	push   0xc(%ebp)
+  801568:	e8 85 ff ff ff       	call   8014f2 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80156d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801570:	c1 e6 0c             	shl    $0xc,%esi
+  801573:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801579:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80157c:	89 3c 24             	mov    %edi,(%esp)
+  80157f:	e8 d7 fd ff ff       	call   80135b <fd2data>
+  801584:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801586:	89 34 24             	mov    %esi,(%esp)
+  801589:	e8 cd fd ff ff       	call   80135b <fd2data>
+  80158e:	83 c4 10             	add    $0x10,%esp
+  801591:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801594:	89 d8                	mov    %ebx,%eax
+  801596:	c1 e8 16             	shr    $0x16,%eax
+  801599:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015a0:	a8 01                	test   $0x1,%al
+  8015a2:	74 11                	je     8015b5 <dup+0x71>
+  8015a4:	89 d8                	mov    %ebx,%eax
+  8015a6:	c1 e8 0c             	shr    $0xc,%eax
+  8015a9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015b0:	f6 c2 01             	test   $0x1,%dl
+  8015b3:	75 36                	jne    8015eb <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015b5:	89 f8                	mov    %edi,%eax
+  8015b7:	c1 e8 0c             	shr    $0xc,%eax
+  8015ba:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015c1:	83 ec 0c             	sub    $0xc,%esp
+  8015c4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015c9:	50                   	push   %eax
+  8015ca:	56                   	push   %esi
+  8015cb:	6a 00                	push   $0x0
+  8015cd:	57                   	push   %edi
+  8015ce:	6a 00                	push   $0x0
+  8015d0:	e8 d7 f9 ff ff       	call   800fac <sys_page_map>
+  8015d5:	89 c3                	mov    %eax,%ebx
+  8015d7:	83 c4 20             	add    $0x20,%esp
+  8015da:	85 c0                	test   %eax,%eax
+  8015dc:	78 33                	js     801611 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015e1:	89 d8                	mov    %ebx,%eax
+  8015e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e6:	5b                   	pop    %ebx
+  8015e7:	5e                   	pop    %esi
+  8015e8:	5f                   	pop    %edi
+  8015e9:	5d                   	pop    %ebp
+  8015ea:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015eb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015f2:	83 ec 0c             	sub    $0xc,%esp
+  8015f5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015fa:	50                   	push   %eax
+  8015fb:	ff 75 d4             	push   -0x2c(%ebp)
+  8015fe:	6a 00                	push   $0x0
+  801600:	53                   	push   %ebx
+  801601:	6a 00                	push   $0x0
+  801603:	e8 a4 f9 ff ff       	call   800fac <sys_page_map>
+  801608:	89 c3                	mov    %eax,%ebx
+  80160a:	83 c4 20             	add    $0x20,%esp
+  80160d:	85 c0                	test   %eax,%eax
+  80160f:	79 a4                	jns    8015b5 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801611:	83 ec 08             	sub    $0x8,%esp
+  801614:	56                   	push   %esi
+  801615:	6a 00                	push   $0x0
+  801617:	e8 d2 f9 ff ff       	call   800fee <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80161c:	83 c4 08             	add    $0x8,%esp
+  80161f:	ff 75 d4             	push   -0x2c(%ebp)
+  801622:	6a 00                	push   $0x0
+  801624:	e8 c5 f9 ff ff       	call   800fee <sys_page_unmap>
+	return r;
+  801629:	83 c4 10             	add    $0x10,%esp
+  80162c:	eb b3                	jmp    8015e1 <dup+0x9d>
+
+0080162e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80162e:	55                   	push   %ebp
+  80162f:	89 e5                	mov    %esp,%ebp
+  801631:	56                   	push   %esi
+  801632:	53                   	push   %ebx
+  801633:	83 ec 18             	sub    $0x18,%esp
+  801636:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801639:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80163c:	50                   	push   %eax
+  80163d:	56                   	push   %esi
+  80163e:	e8 85 fd ff ff       	call   8013c8 <fd_lookup>
+  801643:	83 c4 10             	add    $0x10,%esp
+  801646:	85 c0                	test   %eax,%eax
+  801648:	78 3c                	js     801686 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80164a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80164d:	83 ec 08             	sub    $0x8,%esp
+  801650:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801653:	50                   	push   %eax
+  801654:	ff 33                	push   (%ebx)
+  801656:	e8 bd fd ff ff       	call   801418 <dev_lookup>
+  80165b:	83 c4 10             	add    $0x10,%esp
+  80165e:	85 c0                	test   %eax,%eax
+  801660:	78 24                	js     801686 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801662:	8b 43 08             	mov    0x8(%ebx),%eax
+  801665:	83 e0 03             	and    $0x3,%eax
+  801668:	83 f8 01             	cmp    $0x1,%eax
+  80166b:	74 20                	je     80168d <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80166d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801670:	8b 40 08             	mov    0x8(%eax),%eax
+  801673:	85 c0                	test   %eax,%eax
+  801675:	74 37                	je     8016ae <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801677:	83 ec 04             	sub    $0x4,%esp
+  80167a:	ff 75 10             	push   0x10(%ebp)
+  80167d:	ff 75 0c             	push   0xc(%ebp)
+  801680:	53                   	push   %ebx
+  801681:	ff d0                	call   *%eax
+  801683:	83 c4 10             	add    $0x10,%esp
+}
+  801686:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801689:	5b                   	pop    %ebx
+  80168a:	5e                   	pop    %esi
+  80168b:	5d                   	pop    %ebp
+  80168c:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80168d:	a1 90 77 80 00       	mov    0x807790,%eax
+  801692:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801695:	83 ec 04             	sub    $0x4,%esp
+  801698:	56                   	push   %esi
+  801699:	50                   	push   %eax
+  80169a:	68 2d 34 80 00       	push   $0x80342d
+  80169f:	e8 27 ee ff ff       	call   8004cb <cprintf>
+		return -E_INVAL;
+  8016a4:	83 c4 10             	add    $0x10,%esp
+  8016a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ac:	eb d8                	jmp    801686 <read+0x58>
+		return -E_NOT_SUPP;
+  8016ae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016b3:	eb d1                	jmp    801686 <read+0x58>
+
+008016b5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016b5:	55                   	push   %ebp
+  8016b6:	89 e5                	mov    %esp,%ebp
+  8016b8:	57                   	push   %edi
+  8016b9:	56                   	push   %esi
+  8016ba:	53                   	push   %ebx
+  8016bb:	83 ec 0c             	sub    $0xc,%esp
+  8016be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016c1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c9:	eb 02                	jmp    8016cd <readn+0x18>
+  8016cb:	01 c3                	add    %eax,%ebx
+  8016cd:	39 f3                	cmp    %esi,%ebx
+  8016cf:	73 21                	jae    8016f2 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016d1:	83 ec 04             	sub    $0x4,%esp
+  8016d4:	89 f0                	mov    %esi,%eax
+  8016d6:	29 d8                	sub    %ebx,%eax
+  8016d8:	50                   	push   %eax
+  8016d9:	89 d8                	mov    %ebx,%eax
+  8016db:	03 45 0c             	add    0xc(%ebp),%eax
+  8016de:	50                   	push   %eax
+  8016df:	57                   	push   %edi
+  8016e0:	e8 49 ff ff ff       	call   80162e <read>
+		if (m < 0)
+  8016e5:	83 c4 10             	add    $0x10,%esp
+  8016e8:	85 c0                	test   %eax,%eax
+  8016ea:	78 04                	js     8016f0 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8016ec:	75 dd                	jne    8016cb <readn+0x16>
+  8016ee:	eb 02                	jmp    8016f2 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016f0:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8016f2:	89 d8                	mov    %ebx,%eax
+  8016f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f7:	5b                   	pop    %ebx
+  8016f8:	5e                   	pop    %esi
+  8016f9:	5f                   	pop    %edi
+  8016fa:	5d                   	pop    %ebp
+  8016fb:	c3                   	ret
+
+008016fc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016fc:	55                   	push   %ebp
+  8016fd:	89 e5                	mov    %esp,%ebp
+  8016ff:	56                   	push   %esi
+  801700:	53                   	push   %ebx
+  801701:	83 ec 18             	sub    $0x18,%esp
+  801704:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801707:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80170a:	50                   	push   %eax
+  80170b:	53                   	push   %ebx
+  80170c:	e8 b7 fc ff ff       	call   8013c8 <fd_lookup>
+  801711:	83 c4 10             	add    $0x10,%esp
+  801714:	85 c0                	test   %eax,%eax
+  801716:	78 37                	js     80174f <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801718:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80171b:	83 ec 08             	sub    $0x8,%esp
+  80171e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801721:	50                   	push   %eax
+  801722:	ff 36                	push   (%esi)
+  801724:	e8 ef fc ff ff       	call   801418 <dev_lookup>
+  801729:	83 c4 10             	add    $0x10,%esp
+  80172c:	85 c0                	test   %eax,%eax
+  80172e:	78 1f                	js     80174f <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801730:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801734:	74 20                	je     801756 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801736:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801739:	8b 40 0c             	mov    0xc(%eax),%eax
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	74 37                	je     801777 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801740:	83 ec 04             	sub    $0x4,%esp
+  801743:	ff 75 10             	push   0x10(%ebp)
+  801746:	ff 75 0c             	push   0xc(%ebp)
+  801749:	56                   	push   %esi
+  80174a:	ff d0                	call   *%eax
+  80174c:	83 c4 10             	add    $0x10,%esp
+}
+  80174f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801752:	5b                   	pop    %ebx
+  801753:	5e                   	pop    %esi
+  801754:	5d                   	pop    %ebp
+  801755:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801756:	a1 90 77 80 00       	mov    0x807790,%eax
+  80175b:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80175e:	83 ec 04             	sub    $0x4,%esp
+  801761:	53                   	push   %ebx
+  801762:	50                   	push   %eax
+  801763:	68 49 34 80 00       	push   $0x803449
+  801768:	e8 5e ed ff ff       	call   8004cb <cprintf>
+		return -E_INVAL;
+  80176d:	83 c4 10             	add    $0x10,%esp
+  801770:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801775:	eb d8                	jmp    80174f <write+0x53>
+		return -E_NOT_SUPP;
+  801777:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80177c:	eb d1                	jmp    80174f <write+0x53>
+
+0080177e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80177e:	55                   	push   %ebp
+  80177f:	89 e5                	mov    %esp,%ebp
+  801781:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801784:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801787:	50                   	push   %eax
+  801788:	ff 75 08             	push   0x8(%ebp)
+  80178b:	e8 38 fc ff ff       	call   8013c8 <fd_lookup>
+  801790:	83 c4 10             	add    $0x10,%esp
+  801793:	85 c0                	test   %eax,%eax
+  801795:	78 0e                	js     8017a5 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801797:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80179a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80179d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017a5:	c9                   	leave
+  8017a6:	c3                   	ret
+
+008017a7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017a7:	55                   	push   %ebp
+  8017a8:	89 e5                	mov    %esp,%ebp
+  8017aa:	56                   	push   %esi
+  8017ab:	53                   	push   %ebx
+  8017ac:	83 ec 18             	sub    $0x18,%esp
+  8017af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017b2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017b5:	50                   	push   %eax
+  8017b6:	53                   	push   %ebx
+  8017b7:	e8 0c fc ff ff       	call   8013c8 <fd_lookup>
+  8017bc:	83 c4 10             	add    $0x10,%esp
+  8017bf:	85 c0                	test   %eax,%eax
+  8017c1:	78 34                	js     8017f7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017c3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017c6:	83 ec 08             	sub    $0x8,%esp
+  8017c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017cc:	50                   	push   %eax
+  8017cd:	ff 36                	push   (%esi)
+  8017cf:	e8 44 fc ff ff       	call   801418 <dev_lookup>
+  8017d4:	83 c4 10             	add    $0x10,%esp
+  8017d7:	85 c0                	test   %eax,%eax
+  8017d9:	78 1c                	js     8017f7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017db:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017df:	74 1d                	je     8017fe <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8017e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017e4:	8b 40 18             	mov    0x18(%eax),%eax
+  8017e7:	85 c0                	test   %eax,%eax
+  8017e9:	74 34                	je     80181f <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017eb:	83 ec 08             	sub    $0x8,%esp
+  8017ee:	ff 75 0c             	push   0xc(%ebp)
+  8017f1:	56                   	push   %esi
+  8017f2:	ff d0                	call   *%eax
+  8017f4:	83 c4 10             	add    $0x10,%esp
+}
+  8017f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017fa:	5b                   	pop    %ebx
+  8017fb:	5e                   	pop    %esi
+  8017fc:	5d                   	pop    %ebp
+  8017fd:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8017fe:	a1 90 77 80 00       	mov    0x807790,%eax
+  801803:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801806:	83 ec 04             	sub    $0x4,%esp
+  801809:	53                   	push   %ebx
+  80180a:	50                   	push   %eax
+  80180b:	68 0c 34 80 00       	push   $0x80340c
+  801810:	e8 b6 ec ff ff       	call   8004cb <cprintf>
+		return -E_INVAL;
+  801815:	83 c4 10             	add    $0x10,%esp
+  801818:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80181d:	eb d8                	jmp    8017f7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80181f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801824:	eb d1                	jmp    8017f7 <ftruncate+0x50>
+
+00801826 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801826:	55                   	push   %ebp
+  801827:	89 e5                	mov    %esp,%ebp
+  801829:	56                   	push   %esi
+  80182a:	53                   	push   %ebx
+  80182b:	83 ec 18             	sub    $0x18,%esp
+  80182e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801831:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801834:	50                   	push   %eax
+  801835:	ff 75 08             	push   0x8(%ebp)
+  801838:	e8 8b fb ff ff       	call   8013c8 <fd_lookup>
+  80183d:	83 c4 10             	add    $0x10,%esp
+  801840:	85 c0                	test   %eax,%eax
+  801842:	78 49                	js     80188d <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801844:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801847:	83 ec 08             	sub    $0x8,%esp
+  80184a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80184d:	50                   	push   %eax
+  80184e:	ff 36                	push   (%esi)
+  801850:	e8 c3 fb ff ff       	call   801418 <dev_lookup>
+  801855:	83 c4 10             	add    $0x10,%esp
+  801858:	85 c0                	test   %eax,%eax
+  80185a:	78 31                	js     80188d <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80185c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801863:	74 2f                	je     801894 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801865:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801868:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80186f:	00 00 00 
+	stat->st_isdir = 0;
+  801872:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801879:	00 00 00 
+	stat->st_dev = dev;
+  80187c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801882:	83 ec 08             	sub    $0x8,%esp
+  801885:	53                   	push   %ebx
+  801886:	56                   	push   %esi
+  801887:	ff 50 14             	call   *0x14(%eax)
+  80188a:	83 c4 10             	add    $0x10,%esp
+}
+  80188d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801890:	5b                   	pop    %ebx
+  801891:	5e                   	pop    %esi
+  801892:	5d                   	pop    %ebp
+  801893:	c3                   	ret
+		return -E_NOT_SUPP;
+  801894:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801899:	eb f2                	jmp    80188d <fstat+0x67>
+
+0080189b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80189b:	55                   	push   %ebp
+  80189c:	89 e5                	mov    %esp,%ebp
+  80189e:	56                   	push   %esi
+  80189f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018a0:	83 ec 08             	sub    $0x8,%esp
+  8018a3:	6a 00                	push   $0x0
+  8018a5:	ff 75 08             	push   0x8(%ebp)
+  8018a8:	e8 e4 01 00 00       	call   801a91 <open>
+  8018ad:	89 c3                	mov    %eax,%ebx
+  8018af:	83 c4 10             	add    $0x10,%esp
+  8018b2:	85 c0                	test   %eax,%eax
+  8018b4:	78 1b                	js     8018d1 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018b6:	83 ec 08             	sub    $0x8,%esp
+  8018b9:	ff 75 0c             	push   0xc(%ebp)
+  8018bc:	50                   	push   %eax
+  8018bd:	e8 64 ff ff ff       	call   801826 <fstat>
+  8018c2:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018c4:	89 1c 24             	mov    %ebx,(%esp)
+  8018c7:	e8 26 fc ff ff       	call   8014f2 <close>
+	return r;
+  8018cc:	83 c4 10             	add    $0x10,%esp
+  8018cf:	89 f3                	mov    %esi,%ebx
+}
+  8018d1:	89 d8                	mov    %ebx,%eax
+  8018d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018d6:	5b                   	pop    %ebx
+  8018d7:	5e                   	pop    %esi
+  8018d8:	5d                   	pop    %ebp
+  8018d9:	c3                   	ret
+
+008018da <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8018da:	55                   	push   %ebp
+  8018db:	89 e5                	mov    %esp,%ebp
+  8018dd:	56                   	push   %esi
+  8018de:	53                   	push   %ebx
+  8018df:	89 c6                	mov    %eax,%esi
+  8018e1:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8018e3:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8018ea:	74 27                	je     801913 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018ec:	6a 07                	push   $0x7
+  8018ee:	68 00 80 80 00       	push   $0x808000
+  8018f3:	56                   	push   %esi
+  8018f4:	ff 35 00 60 80 00    	push   0x806000
+  8018fa:	e8 50 11 00 00       	call   802a4f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8018ff:	83 c4 0c             	add    $0xc,%esp
+  801902:	6a 00                	push   $0x0
+  801904:	53                   	push   %ebx
+  801905:	6a 00                	push   $0x0
+  801907:	e8 cb 10 00 00       	call   8029d7 <ipc_recv>
+}
+  80190c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80190f:	5b                   	pop    %ebx
+  801910:	5e                   	pop    %esi
+  801911:	5d                   	pop    %ebp
+  801912:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801913:	83 ec 0c             	sub    $0xc,%esp
+  801916:	6a 01                	push   $0x1
+  801918:	e8 86 11 00 00       	call   802aa3 <ipc_find_env>
+  80191d:	a3 00 60 80 00       	mov    %eax,0x806000
+  801922:	83 c4 10             	add    $0x10,%esp
+  801925:	eb c5                	jmp    8018ec <fsipc+0x12>
+
+00801927 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801927:	55                   	push   %ebp
+  801928:	89 e5                	mov    %esp,%ebp
+  80192a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80192d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801930:	8b 40 0c             	mov    0xc(%eax),%eax
+  801933:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801938:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80193b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801940:	ba 00 00 00 00       	mov    $0x0,%edx
+  801945:	b8 02 00 00 00       	mov    $0x2,%eax
+  80194a:	e8 8b ff ff ff       	call   8018da <fsipc>
+}
+  80194f:	c9                   	leave
+  801950:	c3                   	ret
+
+00801951 <devfile_flush>:
+{
+  801951:	55                   	push   %ebp
+  801952:	89 e5                	mov    %esp,%ebp
+  801954:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801957:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80195d:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801962:	ba 00 00 00 00       	mov    $0x0,%edx
+  801967:	b8 06 00 00 00       	mov    $0x6,%eax
+  80196c:	e8 69 ff ff ff       	call   8018da <fsipc>
+}
+  801971:	c9                   	leave
+  801972:	c3                   	ret
+
+00801973 <devfile_stat>:
+{
+  801973:	55                   	push   %ebp
+  801974:	89 e5                	mov    %esp,%ebp
+  801976:	53                   	push   %ebx
+  801977:	83 ec 04             	sub    $0x4,%esp
+  80197a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80197d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801980:	8b 40 0c             	mov    0xc(%eax),%eax
+  801983:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801988:	ba 00 00 00 00       	mov    $0x0,%edx
+  80198d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801992:	e8 43 ff ff ff       	call   8018da <fsipc>
+  801997:	85 c0                	test   %eax,%eax
+  801999:	78 2c                	js     8019c7 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80199b:	83 ec 08             	sub    $0x8,%esp
+  80199e:	68 00 80 80 00       	push   $0x808000
+  8019a3:	53                   	push   %ebx
+  8019a4:	e8 10 f1 ff ff       	call   800ab9 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019a9:	a1 80 80 80 00       	mov    0x808080,%eax
+  8019ae:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019b4:	a1 84 80 80 00       	mov    0x808084,%eax
+  8019b9:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8019bf:	83 c4 10             	add    $0x10,%esp
+  8019c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ca:	c9                   	leave
+  8019cb:	c3                   	ret
+
+008019cc <devfile_write>:
+{
+  8019cc:	55                   	push   %ebp
+  8019cd:	89 e5                	mov    %esp,%ebp
+  8019cf:	83 ec 0c             	sub    $0xc,%esp
+  8019d2:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8019d5:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8019da:	39 d0                	cmp    %edx,%eax
+  8019dc:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e2:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019e5:	89 15 00 80 80 00    	mov    %edx,0x808000
+	fsipcbuf.write.req_n = n;
+  8019eb:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8019f0:	50                   	push   %eax
+  8019f1:	ff 75 0c             	push   0xc(%ebp)
+  8019f4:	68 08 80 80 00       	push   $0x808008
+  8019f9:	e8 41 f2 ff ff       	call   800c3f <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8019fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a03:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a08:	e8 cd fe ff ff       	call   8018da <fsipc>
+}
+  801a0d:	c9                   	leave
+  801a0e:	c3                   	ret
+
+00801a0f <devfile_read>:
+{
+  801a0f:	55                   	push   %ebp
+  801a10:	89 e5                	mov    %esp,%ebp
+  801a12:	56                   	push   %esi
+  801a13:	53                   	push   %ebx
+  801a14:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a17:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a1a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a1d:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801a22:	89 35 04 80 80 00    	mov    %esi,0x808004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a32:	e8 a3 fe ff ff       	call   8018da <fsipc>
+  801a37:	89 c3                	mov    %eax,%ebx
+  801a39:	85 c0                	test   %eax,%eax
+  801a3b:	78 1f                	js     801a5c <devfile_read+0x4d>
+	assert(r <= n);
+  801a3d:	39 c6                	cmp    %eax,%esi
+  801a3f:	72 24                	jb     801a65 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801a41:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a46:	7f 33                	jg     801a7b <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a48:	83 ec 04             	sub    $0x4,%esp
+  801a4b:	50                   	push   %eax
+  801a4c:	68 00 80 80 00       	push   $0x808000
+  801a51:	ff 75 0c             	push   0xc(%ebp)
+  801a54:	e8 e6 f1 ff ff       	call   800c3f <memmove>
+	return r;
+  801a59:	83 c4 10             	add    $0x10,%esp
+}
+  801a5c:	89 d8                	mov    %ebx,%eax
+  801a5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a61:	5b                   	pop    %ebx
+  801a62:	5e                   	pop    %esi
+  801a63:	5d                   	pop    %ebp
+  801a64:	c3                   	ret
+	assert(r <= n);
+  801a65:	68 7c 34 80 00       	push   $0x80347c
+  801a6a:	68 83 34 80 00       	push   $0x803483
+  801a6f:	6a 7c                	push   $0x7c
+  801a71:	68 98 34 80 00       	push   $0x803498
+  801a76:	e8 75 e9 ff ff       	call   8003f0 <_panic>
+	assert(r <= PGSIZE);
+  801a7b:	68 a3 34 80 00       	push   $0x8034a3
+  801a80:	68 83 34 80 00       	push   $0x803483
+  801a85:	6a 7d                	push   $0x7d
+  801a87:	68 98 34 80 00       	push   $0x803498
+  801a8c:	e8 5f e9 ff ff       	call   8003f0 <_panic>
+
+00801a91 <open>:
+{
+  801a91:	55                   	push   %ebp
+  801a92:	89 e5                	mov    %esp,%ebp
+  801a94:	56                   	push   %esi
+  801a95:	53                   	push   %ebx
+  801a96:	83 ec 1c             	sub    $0x1c,%esp
+  801a99:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a9c:	56                   	push   %esi
+  801a9d:	e8 dc ef ff ff       	call   800a7e <strlen>
+  801aa2:	83 c4 10             	add    $0x10,%esp
+  801aa5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801aaa:	7f 6c                	jg     801b18 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801aac:	83 ec 0c             	sub    $0xc,%esp
+  801aaf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ab2:	50                   	push   %eax
+  801ab3:	e8 ba f8 ff ff       	call   801372 <fd_alloc>
+  801ab8:	89 c3                	mov    %eax,%ebx
+  801aba:	83 c4 10             	add    $0x10,%esp
+  801abd:	85 c0                	test   %eax,%eax
+  801abf:	78 3c                	js     801afd <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801ac1:	83 ec 08             	sub    $0x8,%esp
+  801ac4:	56                   	push   %esi
+  801ac5:	68 00 80 80 00       	push   $0x808000
+  801aca:	e8 ea ef ff ff       	call   800ab9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801acf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ad2:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ad7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ada:	b8 01 00 00 00       	mov    $0x1,%eax
+  801adf:	e8 f6 fd ff ff       	call   8018da <fsipc>
+  801ae4:	89 c3                	mov    %eax,%ebx
+  801ae6:	83 c4 10             	add    $0x10,%esp
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	78 19                	js     801b06 <open+0x75>
+	return fd2num(fd);
+  801aed:	83 ec 0c             	sub    $0xc,%esp
+  801af0:	ff 75 f4             	push   -0xc(%ebp)
+  801af3:	e8 53 f8 ff ff       	call   80134b <fd2num>
+  801af8:	89 c3                	mov    %eax,%ebx
+  801afa:	83 c4 10             	add    $0x10,%esp
+}
+  801afd:	89 d8                	mov    %ebx,%eax
+  801aff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b02:	5b                   	pop    %ebx
+  801b03:	5e                   	pop    %esi
+  801b04:	5d                   	pop    %ebp
+  801b05:	c3                   	ret
+		fd_close(fd, 0);
+  801b06:	83 ec 08             	sub    $0x8,%esp
+  801b09:	6a 00                	push   $0x0
+  801b0b:	ff 75 f4             	push   -0xc(%ebp)
+  801b0e:	e8 58 f9 ff ff       	call   80146b <fd_close>
+		return r;
+  801b13:	83 c4 10             	add    $0x10,%esp
+  801b16:	eb e5                	jmp    801afd <open+0x6c>
+		return -E_BAD_PATH;
+  801b18:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b1d:	eb de                	jmp    801afd <open+0x6c>
+
+00801b1f <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b1f:	55                   	push   %ebp
+  801b20:	89 e5                	mov    %esp,%ebp
+  801b22:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2a:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b2f:	e8 a6 fd ff ff       	call   8018da <fsipc>
+}
+  801b34:	c9                   	leave
+  801b35:	c3                   	ret
+
+00801b36 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  801b36:	55                   	push   %ebp
+  801b37:	89 e5                	mov    %esp,%ebp
+  801b39:	57                   	push   %edi
+  801b3a:	56                   	push   %esi
+  801b3b:	53                   	push   %ebx
+  801b3c:	81 ec 94 02 00 00    	sub    $0x294,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  801b42:	6a 00                	push   $0x0
+  801b44:	ff 75 08             	push   0x8(%ebp)
+  801b47:	e8 45 ff ff ff       	call   801a91 <open>
+  801b4c:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  801b52:	83 c4 10             	add    $0x10,%esp
+  801b55:	85 c0                	test   %eax,%eax
+  801b57:	0f 88 d0 05 00 00    	js     80212d <spawn+0x5f7>
+  801b5d:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801b5f:	83 ec 04             	sub    $0x4,%esp
+  801b62:	68 00 02 00 00       	push   $0x200
+  801b67:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801b6d:	50                   	push   %eax
+  801b6e:	51                   	push   %ecx
+  801b6f:	e8 41 fb ff ff       	call   8016b5 <readn>
+  801b74:	83 c4 10             	add    $0x10,%esp
+  801b77:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801b7c:	75 73                	jne    801bf1 <spawn+0xbb>
+	    || elf->e_magic != ELF_MAGIC) {
+  801b7e:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801b85:	45 4c 46 
+  801b88:	75 67                	jne    801bf1 <spawn+0xbb>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801b8a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b8f:	cd 30                	int    $0x30
+  801b91:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  801b97:	85 c0                	test   %eax,%eax
+  801b99:	0f 88 82 05 00 00    	js     802121 <spawn+0x5eb>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  801b9f:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801ba4:	89 c6                	mov    %eax,%esi
+  801ba6:	c1 e6 09             	shl    $0x9,%esi
+  801ba9:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801baf:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  801bb5:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801bba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  801bbc:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  801bc2:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  801bc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  801bcd:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801bd5:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  801bd8:	85 c0                	test   %eax,%eax
+  801bda:	74 4d                	je     801c29 <spawn+0xf3>
+		string_size += strlen(argv[argc]) + 1;
+  801bdc:	83 ec 0c             	sub    $0xc,%esp
+  801bdf:	50                   	push   %eax
+  801be0:	e8 99 ee ff ff       	call   800a7e <strlen>
+  801be5:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801be9:	83 c3 01             	add    $0x1,%ebx
+  801bec:	83 c4 10             	add    $0x10,%esp
+  801bef:	eb e4                	jmp    801bd5 <spawn+0x9f>
+		close(fd);
+  801bf1:	83 ec 0c             	sub    $0xc,%esp
+  801bf4:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  801bfa:	e8 f3 f8 ff ff       	call   8014f2 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  801bff:	83 c4 0c             	add    $0xc,%esp
+  801c02:	68 7f 45 4c 46       	push   $0x464c457f
+  801c07:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  801c0d:	68 af 34 80 00       	push   $0x8034af
+  801c12:	e8 b4 e8 ff ff       	call   8004cb <cprintf>
+		return -E_NOT_EXEC;
+  801c17:	83 c4 10             	add    $0x10,%esp
+  801c1a:	c7 85 80 fd ff ff f2 	movl   $0xfffffff2,-0x280(%ebp)
+  801c21:	ff ff ff 
+  801c24:	e9 04 05 00 00       	jmp    80212d <spawn+0x5f7>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  801c29:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  801c2f:	bf 00 10 40 00       	mov    $0x401000,%edi
+  801c34:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  801c36:	89 fa                	mov    %edi,%edx
+  801c38:	83 e2 fc             	and    $0xfffffffc,%edx
+  801c3b:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  801c42:	29 c2                	sub    %eax,%edx
+  801c44:	89 95 90 fd ff ff    	mov    %edx,-0x270(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  801c4a:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801c4d:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  801c52:	0f 86 e3 04 00 00    	jbe    80213b <spawn+0x605>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801c58:	83 ec 04             	sub    $0x4,%esp
+  801c5b:	6a 07                	push   $0x7
+  801c5d:	68 00 00 40 00       	push   $0x400000
+  801c62:	6a 00                	push   $0x0
+  801c64:	e8 bd f2 ff ff       	call   800f26 <sys_page_alloc>
+  801c69:	83 c4 10             	add    $0x10,%esp
+  801c6c:	85 c0                	test   %eax,%eax
+  801c6e:	0f 88 cc 04 00 00    	js     802140 <spawn+0x60a>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  801c74:	be 00 00 00 00       	mov    $0x0,%esi
+  801c79:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  801c7f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c82:	eb 30                	jmp    801cb4 <spawn+0x17e>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  801c84:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801c8a:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  801c90:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  801c93:	83 ec 08             	sub    $0x8,%esp
+  801c96:	ff 34 b3             	push   (%ebx,%esi,4)
+  801c99:	57                   	push   %edi
+  801c9a:	e8 1a ee ff ff       	call   800ab9 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  801c9f:	83 c4 04             	add    $0x4,%esp
+  801ca2:	ff 34 b3             	push   (%ebx,%esi,4)
+  801ca5:	e8 d4 ed ff ff       	call   800a7e <strlen>
+  801caa:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  801cae:	83 c6 01             	add    $0x1,%esi
+  801cb1:	83 c4 10             	add    $0x10,%esp
+  801cb4:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  801cba:	7f c8                	jg     801c84 <spawn+0x14e>
+	}
+	argv_store[argc] = 0;
+  801cbc:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  801cc2:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  801cc8:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801ccf:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  801cd5:	0f 85 81 00 00 00    	jne    801d5c <spawn+0x226>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  801cdb:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  801ce1:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  801ce7:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  801cea:	89 c8                	mov    %ecx,%eax
+  801cec:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  801cf2:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  801cf5:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  801cfa:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  801d00:	83 ec 0c             	sub    $0xc,%esp
+  801d03:	6a 07                	push   $0x7
+  801d05:	68 00 d0 bf ee       	push   $0xeebfd000
+  801d0a:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801d10:	68 00 00 40 00       	push   $0x400000
+  801d15:	6a 00                	push   $0x0
+  801d17:	e8 90 f2 ff ff       	call   800fac <sys_page_map>
+  801d1c:	89 c3                	mov    %eax,%ebx
+  801d1e:	83 c4 20             	add    $0x20,%esp
+  801d21:	85 c0                	test   %eax,%eax
+  801d23:	0f 88 1f 04 00 00    	js     802148 <spawn+0x612>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801d29:	83 ec 08             	sub    $0x8,%esp
+  801d2c:	68 00 00 40 00       	push   $0x400000
+  801d31:	6a 00                	push   $0x0
+  801d33:	e8 b6 f2 ff ff       	call   800fee <sys_page_unmap>
+  801d38:	89 c3                	mov    %eax,%ebx
+  801d3a:	83 c4 10             	add    $0x10,%esp
+  801d3d:	85 c0                	test   %eax,%eax
+  801d3f:	0f 88 03 04 00 00    	js     802148 <spawn+0x612>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  801d45:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  801d4b:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801d52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d57:	e9 87 01 00 00       	jmp    801ee3 <spawn+0x3ad>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801d5c:	68 20 35 80 00       	push   $0x803520
+  801d61:	68 83 34 80 00       	push   $0x803483
+  801d66:	68 f1 00 00 00       	push   $0xf1
+  801d6b:	68 c9 34 80 00       	push   $0x8034c9
+  801d70:	e8 7b e6 ff ff       	call   8003f0 <_panic>
+	}
+
+	// from file, as many pages at a time as fit below PFTEMP
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+		for (j = 0; j < n; j += r)
+  801d75:	01 c6                	add    %eax,%esi
+  801d77:	39 f3                	cmp    %esi,%ebx
+  801d79:	7e 4c                	jle    801dc7 <spawn+0x291>
+			if ((r = sys_page_alloc_range(0, UTEMP + j * PGSIZE, n - j, PTE_P|PTE_U|PTE_W)) < 0)
+  801d7b:	6a 07                	push   $0x7
+  801d7d:	89 d8                	mov    %ebx,%eax
+  801d7f:	29 f0                	sub    %esi,%eax
+  801d81:	50                   	push   %eax
+  801d82:	89 f0                	mov    %esi,%eax
+  801d84:	c1 e0 0c             	shl    $0xc,%eax
+  801d87:	05 00 00 40 00       	add    $0x400000,%eax
+  801d8c:	50                   	push   %eax
+  801d8d:	6a 00                	push   $0x0
+  801d8f:	e8 9c f2 ff ff       	call   801030 <sys_page_alloc_range>
+  801d94:	83 c4 10             	add    $0x10,%esp
+  801d97:	85 c0                	test   %eax,%eax
+  801d99:	79 da                	jns    801d75 <spawn+0x23f>
+  801d9b:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  801d9d:	83 ec 0c             	sub    $0xc,%esp
+  801da0:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801da6:	e8 9b f0 ff ff       	call   800e46 <sys_env_destroy>
+	close(fd);
+  801dab:	83 c4 04             	add    $0x4,%esp
+  801dae:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  801db4:	e8 39 f7 ff ff       	call   8014f2 <close>
+	return r;
+  801db9:	83 c4 10             	add    $0x10,%esp
+  801dbc:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  801dc2:	e9 66 03 00 00       	jmp    80212d <spawn+0x5f7>
+				return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  801dc7:	83 ec 08             	sub    $0x8,%esp
+  801dca:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  801dd0:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  801dd6:	01 c8                	add    %ecx,%eax
+  801dd8:	50                   	push   %eax
+  801dd9:	8b b5 80 fd ff ff    	mov    -0x280(%ebp),%esi
+  801ddf:	56                   	push   %esi
+  801de0:	e8 99 f9 ff ff       	call   80177e <seek>
+  801de5:	83 c4 10             	add    $0x10,%esp
+  801de8:	85 c0                	test   %eax,%eax
+  801dea:	0f 88 cd 01 00 00    	js     801fbd <spawn+0x487>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  801df0:	89 d8                	mov    %ebx,%eax
+  801df2:	c1 e0 0c             	shl    $0xc,%eax
+  801df5:	89 85 74 fd ff ff    	mov    %eax,-0x28c(%ebp)
+  801dfb:	83 ec 04             	sub    $0x4,%esp
+  801dfe:	39 f8                	cmp    %edi,%eax
+  801e00:	0f 46 f8             	cmovbe %eax,%edi
+  801e03:	57                   	push   %edi
+  801e04:	68 00 00 40 00       	push   $0x400000
+  801e09:	56                   	push   %esi
+  801e0a:	e8 a6 f8 ff ff       	call   8016b5 <readn>
+  801e0f:	83 c4 10             	add    $0x10,%esp
+  801e12:	85 c0                	test   %eax,%eax
+  801e14:	0f 88 aa 01 00 00    	js     801fc4 <spawn+0x48e>
+			return r;
+		for (j = 0; j < n; j += r)
+  801e1a:	be 00 00 00 00       	mov    $0x0,%esi
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  801e1f:	8b bd 84 fd ff ff    	mov    -0x27c(%ebp),%edi
+  801e25:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  801e2b:	01 c7                	add    %eax,%edi
+		for (j = 0; j < n; j += r)
+  801e2d:	39 f3                	cmp    %esi,%ebx
+  801e2f:	7e 4a                	jle    801e7b <spawn+0x345>
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  801e31:	89 f0                	mov    %esi,%eax
+  801e33:	c1 e0 0c             	shl    $0xc,%eax
+  801e36:	83 ec 08             	sub    $0x8,%esp
+  801e39:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  801e3f:	89 da                	mov    %ebx,%edx
+  801e41:	29 f2                	sub    %esi,%edx
+  801e43:	52                   	push   %edx
+  801e44:	8d 14 07             	lea    (%edi,%eax,1),%edx
+  801e47:	52                   	push   %edx
+  801e48:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801e4e:	05 00 00 40 00       	add    $0x400000,%eax
+  801e53:	50                   	push   %eax
+  801e54:	6a 00                	push   $0x0
+  801e56:	e8 f8 f1 ff ff       	call   801053 <sys_page_map_range>
+  801e5b:	83 c4 20             	add    $0x20,%esp
+  801e5e:	85 c0                	test   %eax,%eax
+  801e60:	78 04                	js     801e66 <spawn+0x330>
+		for (j = 0; j < n; j += r)
+  801e62:	01 c6                	add    %eax,%esi
+  801e64:	eb c7                	jmp    801e2d <spawn+0x2f7>
+				panic("spawn: sys_page_map_range data: %e", r);
+  801e66:	50                   	push   %eax
+  801e67:	68 48 35 80 00       	push   $0x803548
+  801e6c:	68 22 01 00 00       	push   $0x122
+  801e71:	68 c9 34 80 00       	push   $0x8034c9
+  801e76:	e8 75 e5 ff ff       	call   8003f0 <_panic>
+		sys_page_unmap_range(0, UTEMP, n);
+  801e7b:	83 ec 04             	sub    $0x4,%esp
+  801e7e:	53                   	push   %ebx
+  801e7f:	68 00 00 40 00       	push   $0x400000
+  801e84:	6a 00                	push   $0x0
+  801e86:	e8 4d f2 ff ff       	call   8010d8 <sys_page_unmap_range>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  801e8b:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  801e91:	01 8d 8c fd ff ff    	add    %ecx,-0x274(%ebp)
+  801e97:	83 c4 10             	add    $0x10,%esp
+  801e9a:	e9 c4 00 00 00       	jmp    801f63 <spawn+0x42d>
+	}
+
+	// the rest is zero-filled on demand
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  801e9f:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  801ea5:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  801eab:	8b 9d 6c fd ff ff    	mov    -0x294(%ebp),%ebx
+  801eb1:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  801eb7:	39 c8                	cmp    %ecx,%eax
+  801eb9:	73 22                	jae    801edd <spawn+0x3a7>
+  801ebb:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  801ec1:	29 c1                	sub    %eax,%ecx
+  801ec3:	51                   	push   %ecx
+  801ec4:	01 d0                	add    %edx,%eax
+  801ec6:	50                   	push   %eax
+  801ec7:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801ecd:	e8 c2 f1 ff ff       	call   801094 <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  801ed2:	83 c4 10             	add    $0x10,%esp
+  801ed5:	85 c0                	test   %eax,%eax
+  801ed7:	0f 88 d1 00 00 00    	js     801fae <spawn+0x478>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801edd:	83 c3 01             	add    $0x1,%ebx
+  801ee0:	83 c6 20             	add    $0x20,%esi
+  801ee3:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  801eea:	39 d8                	cmp    %ebx,%eax
+  801eec:	0f 8e d9 00 00 00    	jle    801fcb <spawn+0x495>
+		if (ph->p_type != ELF_PROG_LOAD)
+  801ef2:	83 3e 01             	cmpl   $0x1,(%esi)
+  801ef5:	75 e6                	jne    801edd <spawn+0x3a7>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  801ef7:	8b 46 18             	mov    0x18(%esi),%eax
+  801efa:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  801efd:	83 f8 01             	cmp    $0x1,%eax
+  801f00:	19 c0                	sbb    %eax,%eax
+  801f02:	83 e0 fe             	and    $0xfffffffe,%eax
+  801f05:	83 c0 07             	add    $0x7,%eax
+  801f08:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  801f0e:	8b 7e 04             	mov    0x4(%esi),%edi
+  801f11:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  801f17:	8b 46 10             	mov    0x10(%esi),%eax
+  801f1a:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  801f20:	8b 4e 14             	mov    0x14(%esi),%ecx
+  801f23:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  801f26:	89 d0                	mov    %edx,%eax
+  801f28:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f2d:	74 12                	je     801f41 <spawn+0x40b>
+		va -= i;
+  801f2f:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  801f31:	01 c1                	add    %eax,%ecx
+		filesz += i;
+  801f33:	01 85 88 fd ff ff    	add    %eax,-0x278(%ebp)
+		fileoffset -= i;
+  801f39:	29 c7                	sub    %eax,%edi
+  801f3b:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  801f41:	c7 85 8c fd ff ff 00 	movl   $0x0,-0x274(%ebp)
+  801f48:	00 00 00 
+  801f4b:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  801f51:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  801f57:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  801f5d:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  801f63:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  801f69:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  801f6f:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  801f75:	39 c8                	cmp    %ecx,%eax
+  801f77:	0f 83 22 ff ff ff    	jae    801e9f <spawn+0x369>
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+  801f7d:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  801f83:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  801f89:	29 c7                	sub    %eax,%edi
+  801f8b:	8d 9f ff 0f 00 00    	lea    0xfff(%edi),%ebx
+  801f91:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  801f97:	b8 00 f0 3f 00       	mov    $0x3ff000,%eax
+  801f9c:	39 c3                	cmp    %eax,%ebx
+  801f9e:	0f 47 d8             	cmova  %eax,%ebx
+  801fa1:	c1 eb 0c             	shr    $0xc,%ebx
+		for (j = 0; j < n; j += r)
+  801fa4:	be 00 00 00 00       	mov    $0x0,%esi
+  801fa9:	e9 c9 fd ff ff       	jmp    801d77 <spawn+0x241>
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  801fae:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb3:	89 d7                	mov    %edx,%edi
+  801fb5:	0f 4e f8             	cmovle %eax,%edi
+  801fb8:	e9 e0 fd ff ff       	jmp    801d9d <spawn+0x267>
+  801fbd:	89 c7                	mov    %eax,%edi
+  801fbf:	e9 d9 fd ff ff       	jmp    801d9d <spawn+0x267>
+  801fc4:	89 c7                	mov    %eax,%edi
+  801fc6:	e9 d2 fd ff ff       	jmp    801d9d <spawn+0x267>
+	close(fd);
+  801fcb:	83 ec 0c             	sub    $0xc,%esp
+  801fce:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  801fd4:	e8 19 f5 ff ff       	call   8014f2 <close>
+  801fd9:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	uint32_t pn, n;
+	void *va;
+	int perm, r;
+
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  801fdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fe1:	e9 82 00 00 00       	jmp    802068 <spawn+0x532>
+		// in one go.
+		perm = uvpt[pn] & PTE_SYSCALL;
+		while (pn + n < PGNUM(UTOP)
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+			n++;
+  801fe6:	83 c6 01             	add    $0x1,%esi
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  801fe9:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  801fee:	74 2e                	je     80201e <spawn+0x4e8>
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+  801ff0:	89 c2                	mov    %eax,%edx
+  801ff2:	c1 e2 0c             	shl    $0xc,%edx
+  801ff5:	c1 ea 16             	shr    $0x16,%edx
+  801ff8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801fff:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802005:	83 fa 01             	cmp    $0x1,%edx
+  802008:	75 14                	jne    80201e <spawn+0x4e8>
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  80200a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802011:	83 c0 01             	add    $0x1,%eax
+  802014:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  80201a:	39 d7                	cmp    %edx,%edi
+  80201c:	74 c8                	je     801fe6 <spawn+0x4b0>
+		if ((r = sys_page_map_range(0, va, child, va, n, perm)) != n)
+  80201e:	83 ec 08             	sub    $0x8,%esp
+  802021:	57                   	push   %edi
+  802022:	56                   	push   %esi
+  802023:	51                   	push   %ecx
+  802024:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  80202a:	51                   	push   %ecx
+  80202b:	6a 00                	push   $0x0
+  80202d:	e8 21 f0 ff ff       	call   801053 <sys_page_map_range>
+  802032:	89 c2                	mov    %eax,%edx
+  802034:	83 c4 20             	add    $0x20,%esp
+  802037:	39 c6                	cmp    %eax,%esi
+  802039:	74 23                	je     80205e <spawn+0x528>
+			panic("sys_page_map_range: %e", r < 0 ? r : -E_NO_MEM);
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	78 05                	js     802044 <spawn+0x50e>
+  80203f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802044:	50                   	push   %eax
+  802045:	68 d5 34 80 00       	push   $0x8034d5
+  80204a:	68 47 01 00 00       	push   $0x147
+  80204f:	68 c9 34 80 00       	push   $0x8034c9
+  802054:	e8 97 e3 ff ff       	call   8003f0 <_panic>
+		n = 1;
+  802059:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  80205e:	01 d3                	add    %edx,%ebx
+  802060:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802066:	77 4e                	ja     8020b6 <spawn+0x580>
+		va = (void *) (pn << PGSHIFT);
+  802068:	89 d9                	mov    %ebx,%ecx
+  80206a:	c1 e1 0c             	shl    $0xc,%ecx
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  80206d:	89 c8                	mov    %ecx,%eax
+  80206f:	c1 e8 16             	shr    $0x16,%eax
+  802072:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802079:	25 81 00 00 00       	and    $0x81,%eax
+  80207e:	83 f8 01             	cmp    $0x1,%eax
+  802081:	75 d6                	jne    802059 <spawn+0x523>
+		if (!(uvpt[pn] & PTE_P))
+  802083:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  80208a:	83 e2 01             	and    $0x1,%edx
+  80208d:	74 23                	je     8020b2 <spawn+0x57c>
+		if (!(uvpt[pn] & PTE_SHARE))
+  80208f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802096:	f6 c4 04             	test   $0x4,%ah
+  802099:	74 c3                	je     80205e <spawn+0x528>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  80209b:	8b 3c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edi
+  8020a2:	81 e7 07 0e 00 00    	and    $0xe07,%edi
+		while (pn + n < PGNUM(UTOP)
+  8020a8:	8d 43 01             	lea    0x1(%ebx),%eax
+		n = 1;
+  8020ab:	89 d6                	mov    %edx,%esi
+		while (pn + n < PGNUM(UTOP)
+  8020ad:	e9 37 ff ff ff       	jmp    801fe9 <spawn+0x4b3>
+		n = 1;
+  8020b2:	89 c2                	mov    %eax,%edx
+  8020b4:	eb a8                	jmp    80205e <spawn+0x528>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8020b6:	83 ec 08             	sub    $0x8,%esp
+  8020b9:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8020bf:	50                   	push   %eax
+  8020c0:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  8020c6:	e8 14 f1 ff ff       	call   8011df <sys_env_set_trapframe>
+  8020cb:	83 c4 10             	add    $0x10,%esp
+  8020ce:	85 c0                	test   %eax,%eax
+  8020d0:	78 25                	js     8020f7 <spawn+0x5c1>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8020d2:	83 ec 08             	sub    $0x8,%esp
+  8020d5:	6a 02                	push   $0x2
+  8020d7:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  8020dd:	e8 18 f0 ff ff       	call   8010fa <sys_env_set_status>
+  8020e2:	83 c4 10             	add    $0x10,%esp
+  8020e5:	85 c0                	test   %eax,%eax
+  8020e7:	78 23                	js     80210c <spawn+0x5d6>
+	return child;
+  8020e9:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8020ef:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  8020f5:	eb 36                	jmp    80212d <spawn+0x5f7>
+		panic("sys_env_set_trapframe: %e", r);
+  8020f7:	50                   	push   %eax
+  8020f8:	68 ec 34 80 00       	push   $0x8034ec
+  8020fd:	68 85 00 00 00       	push   $0x85
+  802102:	68 c9 34 80 00       	push   $0x8034c9
+  802107:	e8 e4 e2 ff ff       	call   8003f0 <_panic>
+		panic("sys_env_set_status: %e", r);
+  80210c:	50                   	push   %eax
+  80210d:	68 06 35 80 00       	push   $0x803506
+  802112:	68 88 00 00 00       	push   $0x88
+  802117:	68 c9 34 80 00       	push   $0x8034c9
+  80211c:	e8 cf e2 ff ff       	call   8003f0 <_panic>
+		return r;
+  802121:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802127:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+}
+  80212d:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802133:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802136:	5b                   	pop    %ebx
+  802137:	5e                   	pop    %esi
+  802138:	5f                   	pop    %edi
+  802139:	5d                   	pop    %ebp
+  80213a:	c3                   	ret
+		return -E_NO_MEM;
+  80213b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802140:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802146:	eb e5                	jmp    80212d <spawn+0x5f7>
+	sys_page_unmap(0, UTEMP);
+  802148:	83 ec 08             	sub    $0x8,%esp
+  80214b:	68 00 00 40 00       	push   $0x400000
+  802150:	6a 00                	push   $0x0
+  802152:	e8 97 ee ff ff       	call   800fee <sys_page_unmap>
+  802157:	83 c4 10             	add    $0x10,%esp
+  80215a:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  802160:	eb cb                	jmp    80212d <spawn+0x5f7>
+
+00802162 <spawnl>:
+{
+  802162:	55                   	push   %ebp
+  802163:	89 e5                	mov    %esp,%ebp
+  802165:	56                   	push   %esi
+  802166:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802167:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  80216a:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  80216f:	eb 05                	jmp    802176 <spawnl+0x14>
+		argc++;
+  802171:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802174:	89 ca                	mov    %ecx,%edx
+  802176:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802179:	83 3a 00             	cmpl   $0x0,(%edx)
+  80217c:	75 f3                	jne    802171 <spawnl+0xf>
+	const char *argv[argc+2];
+  80217e:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802185:	83 e2 f0             	and    $0xfffffff0,%edx
+  802188:	29 d4                	sub    %edx,%esp
+  80218a:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  80218e:	89 da                	mov    %ebx,%edx
+  802190:	c1 ea 02             	shr    $0x2,%edx
+  802193:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802196:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802199:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  8021a0:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  8021a7:	00 
+	va_start(vl, arg0);
+  8021a8:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  8021ab:	89 c2                	mov    %eax,%edx
+  8021ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b2:	eb 0b                	jmp    8021bf <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  8021b4:	83 c0 01             	add    $0x1,%eax
+  8021b7:	8b 31                	mov    (%ecx),%esi
+  8021b9:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  8021bc:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  8021bf:	39 d0                	cmp    %edx,%eax
+  8021c1:	75 f1                	jne    8021b4 <spawnl+0x52>
+	return spawn(prog, argv);
+  8021c3:	83 ec 08             	sub    $0x8,%esp
+  8021c6:	53                   	push   %ebx
+  8021c7:	ff 75 08             	push   0x8(%ebp)
+  8021ca:	e8 67 f9 ff ff       	call   801b36 <spawn>
+}
+  8021cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021d2:	5b                   	pop    %ebx
+  8021d3:	5e                   	pop    %esi
+  8021d4:	5d                   	pop    %ebp
+  8021d5:	c3                   	ret
+
+008021d6 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8021d6:	55                   	push   %ebp
+  8021d7:	89 e5                	mov    %esp,%ebp
+  8021d9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8021dc:	68 6b 35 80 00       	push   $0x80356b
+  8021e1:	ff 75 0c             	push   0xc(%ebp)
+  8021e4:	e8 d0 e8 ff ff       	call   800ab9 <strcpy>
+	return 0;
+}
+  8021e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ee:	c9                   	leave
+  8021ef:	c3                   	ret
+
+008021f0 <devsock_close>:
+{
+  8021f0:	55                   	push   %ebp
+  8021f1:	89 e5                	mov    %esp,%ebp
+  8021f3:	53                   	push   %ebx
+  8021f4:	83 ec 10             	sub    $0x10,%esp
+  8021f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8021fa:	53                   	push   %ebx
+  8021fb:	e8 b3 08 00 00       	call   802ab3 <pageref>
+  802200:	89 c2                	mov    %eax,%edx
+  802202:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802205:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80220a:	83 fa 01             	cmp    $0x1,%edx
+  80220d:	74 05                	je     802214 <devsock_close+0x24>
+}
+  80220f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802212:	c9                   	leave
+  802213:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802214:	83 ec 0c             	sub    $0xc,%esp
+  802217:	ff 73 0c             	push   0xc(%ebx)
+  80221a:	e8 b7 02 00 00       	call   8024d6 <nsipc_close>
+  80221f:	83 c4 10             	add    $0x10,%esp
+  802222:	eb eb                	jmp    80220f <devsock_close+0x1f>
+
+00802224 <devsock_write>:
+{
+  802224:	55                   	push   %ebp
+  802225:	89 e5                	mov    %esp,%ebp
+  802227:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80222a:	6a 00                	push   $0x0
+  80222c:	ff 75 10             	push   0x10(%ebp)
+  80222f:	ff 75 0c             	push   0xc(%ebp)
+  802232:	8b 45 08             	mov    0x8(%ebp),%eax
+  802235:	ff 70 0c             	push   0xc(%eax)
+  802238:	e8 79 03 00 00       	call   8025b6 <nsipc_send>
+}
+  80223d:	c9                   	leave
+  80223e:	c3                   	ret
+
+0080223f <devsock_read>:
+{
+  80223f:	55                   	push   %ebp
+  802240:	89 e5                	mov    %esp,%ebp
+  802242:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802245:	6a 00                	push   $0x0
+  802247:	ff 75 10             	push   0x10(%ebp)
+  80224a:	ff 75 0c             	push   0xc(%ebp)
+  80224d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802250:	ff 70 0c             	push   0xc(%eax)
+  802253:	e8 ef 02 00 00       	call   802547 <nsipc_recv>
+}
+  802258:	c9                   	leave
+  802259:	c3                   	ret
+
+0080225a <fd2sockid>:
+{
+  80225a:	55                   	push   %ebp
+  80225b:	89 e5                	mov    %esp,%ebp
+  80225d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802260:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802263:	52                   	push   %edx
+  802264:	50                   	push   %eax
+  802265:	e8 5e f1 ff ff       	call   8013c8 <fd_lookup>
+  80226a:	83 c4 10             	add    $0x10,%esp
+  80226d:	85 c0                	test   %eax,%eax
+  80226f:	78 10                	js     802281 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802271:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802274:	8b 0d ac 57 80 00    	mov    0x8057ac,%ecx
+  80227a:	39 08                	cmp    %ecx,(%eax)
+  80227c:	75 05                	jne    802283 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80227e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802281:	c9                   	leave
+  802282:	c3                   	ret
+		return -E_NOT_SUPP;
+  802283:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802288:	eb f7                	jmp    802281 <fd2sockid+0x27>
+
+0080228a <alloc_sockfd>:
+{
+  80228a:	55                   	push   %ebp
+  80228b:	89 e5                	mov    %esp,%ebp
+  80228d:	56                   	push   %esi
+  80228e:	53                   	push   %ebx
+  80228f:	83 ec 1c             	sub    $0x1c,%esp
+  802292:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802294:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802297:	50                   	push   %eax
+  802298:	e8 d5 f0 ff ff       	call   801372 <fd_alloc>
+  80229d:	89 c3                	mov    %eax,%ebx
+  80229f:	83 c4 10             	add    $0x10,%esp
+  8022a2:	85 c0                	test   %eax,%eax
+  8022a4:	78 43                	js     8022e9 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8022a6:	83 ec 04             	sub    $0x4,%esp
+  8022a9:	68 07 04 00 00       	push   $0x407
+  8022ae:	ff 75 f4             	push   -0xc(%ebp)
+  8022b1:	6a 00                	push   $0x0
+  8022b3:	e8 6e ec ff ff       	call   800f26 <sys_page_alloc>
+  8022b8:	89 c3                	mov    %eax,%ebx
+  8022ba:	83 c4 10             	add    $0x10,%esp
+  8022bd:	85 c0                	test   %eax,%eax
+  8022bf:	78 28                	js     8022e9 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8022c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022c4:	8b 15 ac 57 80 00    	mov    0x8057ac,%edx
+  8022ca:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8022cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022cf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8022d6:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8022d9:	83 ec 0c             	sub    $0xc,%esp
+  8022dc:	50                   	push   %eax
+  8022dd:	e8 69 f0 ff ff       	call   80134b <fd2num>
+  8022e2:	89 c3                	mov    %eax,%ebx
+  8022e4:	83 c4 10             	add    $0x10,%esp
+  8022e7:	eb 0c                	jmp    8022f5 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8022e9:	83 ec 0c             	sub    $0xc,%esp
+  8022ec:	56                   	push   %esi
+  8022ed:	e8 e4 01 00 00       	call   8024d6 <nsipc_close>
+		return r;
+  8022f2:	83 c4 10             	add    $0x10,%esp
+}
+  8022f5:	89 d8                	mov    %ebx,%eax
+  8022f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022fa:	5b                   	pop    %ebx
+  8022fb:	5e                   	pop    %esi
+  8022fc:	5d                   	pop    %ebp
+  8022fd:	c3                   	ret
+
+008022fe <accept>:
+{
+  8022fe:	55                   	push   %ebp
+  8022ff:	89 e5                	mov    %esp,%ebp
+  802301:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802304:	8b 45 08             	mov    0x8(%ebp),%eax
+  802307:	e8 4e ff ff ff       	call   80225a <fd2sockid>
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	78 1b                	js     80232b <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802310:	83 ec 04             	sub    $0x4,%esp
+  802313:	ff 75 10             	push   0x10(%ebp)
+  802316:	ff 75 0c             	push   0xc(%ebp)
+  802319:	50                   	push   %eax
+  80231a:	e8 0e 01 00 00       	call   80242d <nsipc_accept>
+  80231f:	83 c4 10             	add    $0x10,%esp
+  802322:	85 c0                	test   %eax,%eax
+  802324:	78 05                	js     80232b <accept+0x2d>
+	return alloc_sockfd(r);
+  802326:	e8 5f ff ff ff       	call   80228a <alloc_sockfd>
+}
+  80232b:	c9                   	leave
+  80232c:	c3                   	ret
+
+0080232d <bind>:
+{
+  80232d:	55                   	push   %ebp
+  80232e:	89 e5                	mov    %esp,%ebp
+  802330:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802333:	8b 45 08             	mov    0x8(%ebp),%eax
+  802336:	e8 1f ff ff ff       	call   80225a <fd2sockid>
+  80233b:	85 c0                	test   %eax,%eax
+  80233d:	78 12                	js     802351 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80233f:	83 ec 04             	sub    $0x4,%esp
+  802342:	ff 75 10             	push   0x10(%ebp)
+  802345:	ff 75 0c             	push   0xc(%ebp)
+  802348:	50                   	push   %eax
+  802349:	e8 31 01 00 00       	call   80247f <nsipc_bind>
+  80234e:	83 c4 10             	add    $0x10,%esp
+}
+  802351:	c9                   	leave
+  802352:	c3                   	ret
+
+00802353 <shutdown>:
+{
+  802353:	55                   	push   %ebp
+  802354:	89 e5                	mov    %esp,%ebp
+  802356:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802359:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235c:	e8 f9 fe ff ff       	call   80225a <fd2sockid>
+  802361:	85 c0                	test   %eax,%eax
+  802363:	78 0f                	js     802374 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802365:	83 ec 08             	sub    $0x8,%esp
+  802368:	ff 75 0c             	push   0xc(%ebp)
+  80236b:	50                   	push   %eax
+  80236c:	e8 43 01 00 00       	call   8024b4 <nsipc_shutdown>
+  802371:	83 c4 10             	add    $0x10,%esp
+}
+  802374:	c9                   	leave
+  802375:	c3                   	ret
+
+00802376 <connect>:
+{
+  802376:	55                   	push   %ebp
+  802377:	89 e5                	mov    %esp,%ebp
+  802379:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80237c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237f:	e8 d6 fe ff ff       	call   80225a <fd2sockid>
+  802384:	85 c0                	test   %eax,%eax
+  802386:	78 12                	js     80239a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802388:	83 ec 04             	sub    $0x4,%esp
+  80238b:	ff 75 10             	push   0x10(%ebp)
+  80238e:	ff 75 0c             	push   0xc(%ebp)
+  802391:	50                   	push   %eax
+  802392:	e8 59 01 00 00       	call   8024f0 <nsipc_connect>
+  802397:	83 c4 10             	add    $0x10,%esp
+}
+  80239a:	c9                   	leave
+  80239b:	c3                   	ret
+
+0080239c <listen>:
+{
+  80239c:	55                   	push   %ebp
+  80239d:	89 e5                	mov    %esp,%ebp
+  80239f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a5:	e8 b0 fe ff ff       	call   80225a <fd2sockid>
+  8023aa:	85 c0                	test   %eax,%eax
+  8023ac:	78 0f                	js     8023bd <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8023ae:	83 ec 08             	sub    $0x8,%esp
+  8023b1:	ff 75 0c             	push   0xc(%ebp)
+  8023b4:	50                   	push   %eax
+  8023b5:	e8 6b 01 00 00       	call   802525 <nsipc_listen>
+  8023ba:	83 c4 10             	add    $0x10,%esp
+}
+  8023bd:	c9                   	leave
+  8023be:	c3                   	ret
+
+008023bf <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8023bf:	55                   	push   %ebp
+  8023c0:	89 e5                	mov    %esp,%ebp
+  8023c2:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8023c5:	ff 75 10             	push   0x10(%ebp)
+  8023c8:	ff 75 0c             	push   0xc(%ebp)
+  8023cb:	ff 75 08             	push   0x8(%ebp)
+  8023ce:	e8 41 02 00 00       	call   802614 <nsipc_socket>
+  8023d3:	83 c4 10             	add    $0x10,%esp
+  8023d6:	85 c0                	test   %eax,%eax
+  8023d8:	78 05                	js     8023df <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8023da:	e8 ab fe ff ff       	call   80228a <alloc_sockfd>
+}
+  8023df:	c9                   	leave
+  8023e0:	c3                   	ret
+
+008023e1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8023e1:	55                   	push   %ebp
+  8023e2:	89 e5                	mov    %esp,%ebp
+  8023e4:	53                   	push   %ebx
+  8023e5:	83 ec 04             	sub    $0x4,%esp
+  8023e8:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8023ea:	83 3d 04 60 80 00 00 	cmpl   $0x0,0x806004
+  8023f1:	74 26                	je     802419 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8023f3:	6a 07                	push   $0x7
+  8023f5:	68 00 90 80 00       	push   $0x809000
+  8023fa:	53                   	push   %ebx
+  8023fb:	ff 35 04 60 80 00    	push   0x806004
+  802401:	e8 49 06 00 00       	call   802a4f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802406:	83 c4 0c             	add    $0xc,%esp
+  802409:	6a 00                	push   $0x0
+  80240b:	6a 00                	push   $0x0
+  80240d:	6a 00                	push   $0x0
+  80240f:	e8 c3 05 00 00       	call   8029d7 <ipc_recv>
+}
+  802414:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802417:	c9                   	leave
+  802418:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802419:	83 ec 0c             	sub    $0xc,%esp
+  80241c:	6a 02                	push   $0x2
+  80241e:	e8 80 06 00 00       	call   802aa3 <ipc_find_env>
+  802423:	a3 04 60 80 00       	mov    %eax,0x806004
+  802428:	83 c4 10             	add    $0x10,%esp
+  80242b:	eb c6                	jmp    8023f3 <nsipc+0x12>
+
+0080242d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80242d:	55                   	push   %ebp
+  80242e:	89 e5                	mov    %esp,%ebp
+  802430:	56                   	push   %esi
+  802431:	53                   	push   %ebx
+  802432:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802435:	8b 45 08             	mov    0x8(%ebp),%eax
+  802438:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80243d:	8b 06                	mov    (%esi),%eax
+  80243f:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802444:	b8 01 00 00 00       	mov    $0x1,%eax
+  802449:	e8 93 ff ff ff       	call   8023e1 <nsipc>
+  80244e:	89 c3                	mov    %eax,%ebx
+  802450:	85 c0                	test   %eax,%eax
+  802452:	79 09                	jns    80245d <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802454:	89 d8                	mov    %ebx,%eax
+  802456:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802459:	5b                   	pop    %ebx
+  80245a:	5e                   	pop    %esi
+  80245b:	5d                   	pop    %ebp
+  80245c:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80245d:	83 ec 04             	sub    $0x4,%esp
+  802460:	ff 35 10 90 80 00    	push   0x809010
+  802466:	68 00 90 80 00       	push   $0x809000
+  80246b:	ff 75 0c             	push   0xc(%ebp)
+  80246e:	e8 cc e7 ff ff       	call   800c3f <memmove>
+		*addrlen = ret->ret_addrlen;
+  802473:	a1 10 90 80 00       	mov    0x809010,%eax
+  802478:	89 06                	mov    %eax,(%esi)
+  80247a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80247d:	eb d5                	jmp    802454 <nsipc_accept+0x27>
+
+0080247f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80247f:	55                   	push   %ebp
+  802480:	89 e5                	mov    %esp,%ebp
+  802482:	53                   	push   %ebx
+  802483:	83 ec 08             	sub    $0x8,%esp
+  802486:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802489:	8b 45 08             	mov    0x8(%ebp),%eax
+  80248c:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802491:	53                   	push   %ebx
+  802492:	ff 75 0c             	push   0xc(%ebp)
+  802495:	68 04 90 80 00       	push   $0x809004
+  80249a:	e8 a0 e7 ff ff       	call   800c3f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80249f:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  8024a5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8024aa:	e8 32 ff ff ff       	call   8023e1 <nsipc>
+}
+  8024af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024b2:	c9                   	leave
+  8024b3:	c3                   	ret
+
+008024b4 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8024b4:	55                   	push   %ebp
+  8024b5:	89 e5                	mov    %esp,%ebp
+  8024b7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8024ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024bd:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  8024c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024c5:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  8024ca:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024cf:	e8 0d ff ff ff       	call   8023e1 <nsipc>
+}
+  8024d4:	c9                   	leave
+  8024d5:	c3                   	ret
+
+008024d6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8024d6:	55                   	push   %ebp
+  8024d7:	89 e5                	mov    %esp,%ebp
+  8024d9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8024dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024df:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  8024e4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024e9:	e8 f3 fe ff ff       	call   8023e1 <nsipc>
+}
+  8024ee:	c9                   	leave
+  8024ef:	c3                   	ret
+
+008024f0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8024f0:	55                   	push   %ebp
+  8024f1:	89 e5                	mov    %esp,%ebp
+  8024f3:	53                   	push   %ebx
+  8024f4:	83 ec 08             	sub    $0x8,%esp
+  8024f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8024fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024fd:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802502:	53                   	push   %ebx
+  802503:	ff 75 0c             	push   0xc(%ebp)
+  802506:	68 04 90 80 00       	push   $0x809004
+  80250b:	e8 2f e7 ff ff       	call   800c3f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802510:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802516:	b8 05 00 00 00       	mov    $0x5,%eax
+  80251b:	e8 c1 fe ff ff       	call   8023e1 <nsipc>
+}
+  802520:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802523:	c9                   	leave
+  802524:	c3                   	ret
+
+00802525 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802525:	55                   	push   %ebp
+  802526:	89 e5                	mov    %esp,%ebp
+  802528:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80252b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80252e:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802533:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802536:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  80253b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802540:	e8 9c fe ff ff       	call   8023e1 <nsipc>
+}
+  802545:	c9                   	leave
+  802546:	c3                   	ret
+
+00802547 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802547:	55                   	push   %ebp
+  802548:	89 e5                	mov    %esp,%ebp
+  80254a:	56                   	push   %esi
+  80254b:	53                   	push   %ebx
+  80254c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80254f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802552:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802557:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  80255d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802560:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802565:	b8 07 00 00 00       	mov    $0x7,%eax
+  80256a:	e8 72 fe ff ff       	call   8023e1 <nsipc>
+  80256f:	89 c3                	mov    %eax,%ebx
+  802571:	85 c0                	test   %eax,%eax
+  802573:	78 22                	js     802597 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802575:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80257a:	39 c6                	cmp    %eax,%esi
+  80257c:	0f 4e c6             	cmovle %esi,%eax
+  80257f:	39 c3                	cmp    %eax,%ebx
+  802581:	7f 1d                	jg     8025a0 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802583:	83 ec 04             	sub    $0x4,%esp
+  802586:	53                   	push   %ebx
+  802587:	68 00 90 80 00       	push   $0x809000
+  80258c:	ff 75 0c             	push   0xc(%ebp)
+  80258f:	e8 ab e6 ff ff       	call   800c3f <memmove>
+  802594:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802597:	89 d8                	mov    %ebx,%eax
+  802599:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80259c:	5b                   	pop    %ebx
+  80259d:	5e                   	pop    %esi
+  80259e:	5d                   	pop    %ebp
+  80259f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8025a0:	68 77 35 80 00       	push   $0x803577
+  8025a5:	68 83 34 80 00       	push   $0x803483
+  8025aa:	6a 62                	push   $0x62
+  8025ac:	68 8c 35 80 00       	push   $0x80358c
+  8025b1:	e8 3a de ff ff       	call   8003f0 <_panic>
+
+008025b6 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8025b6:	55                   	push   %ebp
+  8025b7:	89 e5                	mov    %esp,%ebp
+  8025b9:	53                   	push   %ebx
+  8025ba:	83 ec 04             	sub    $0x4,%esp
+  8025bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8025c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025c3:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  8025c8:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8025ce:	7f 2e                	jg     8025fe <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8025d0:	83 ec 04             	sub    $0x4,%esp
+  8025d3:	53                   	push   %ebx
+  8025d4:	ff 75 0c             	push   0xc(%ebp)
+  8025d7:	68 0c 90 80 00       	push   $0x80900c
+  8025dc:	e8 5e e6 ff ff       	call   800c3f <memmove>
+	nsipcbuf.send.req_size = size;
+  8025e1:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  8025e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025ea:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  8025ef:	b8 08 00 00 00       	mov    $0x8,%eax
+  8025f4:	e8 e8 fd ff ff       	call   8023e1 <nsipc>
+}
+  8025f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025fc:	c9                   	leave
+  8025fd:	c3                   	ret
+	assert(size < 1600);
+  8025fe:	68 98 35 80 00       	push   $0x803598
+  802603:	68 83 34 80 00       	push   $0x803483
+  802608:	6a 6d                	push   $0x6d
+  80260a:	68 8c 35 80 00       	push   $0x80358c
+  80260f:	e8 dc dd ff ff       	call   8003f0 <_panic>
+
+00802614 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802614:	55                   	push   %ebp
+  802615:	89 e5                	mov    %esp,%ebp
+  802617:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80261a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802622:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802625:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  80262a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80262d:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802632:	b8 09 00 00 00       	mov    $0x9,%eax
+  802637:	e8 a5 fd ff ff       	call   8023e1 <nsipc>
+}
+  80263c:	c9                   	leave
+  80263d:	c3                   	ret
+
+0080263e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80263e:	55                   	push   %ebp
+  80263f:	89 e5                	mov    %esp,%ebp
+  802641:	56                   	push   %esi
+  802642:	53                   	push   %ebx
+  802643:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802646:	83 ec 0c             	sub    $0xc,%esp
+  802649:	ff 75 08             	push   0x8(%ebp)
+  80264c:	e8 0a ed ff ff       	call   80135b <fd2data>
+  802651:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802653:	83 c4 08             	add    $0x8,%esp
+  802656:	68 a4 35 80 00       	push   $0x8035a4
+  80265b:	53                   	push   %ebx
+  80265c:	e8 58 e4 ff ff       	call   800ab9 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802661:	8b 46 04             	mov    0x4(%esi),%eax
+  802664:	2b 06                	sub    (%esi),%eax
+  802666:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80266c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802673:	00 00 00 
+	stat->st_dev = &devpipe;
+  802676:	c7 83 88 00 00 00 c8 	movl   $0x8057c8,0x88(%ebx)
+  80267d:	57 80 00 
+	return 0;
+}
+  802680:	b8 00 00 00 00       	mov    $0x0,%eax
+  802685:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802688:	5b                   	pop    %ebx
+  802689:	5e                   	pop    %esi
+  80268a:	5d                   	pop    %ebp
+  80268b:	c3                   	ret
+
+0080268c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80268c:	55                   	push   %ebp
+  80268d:	89 e5                	mov    %esp,%ebp
+  80268f:	53                   	push   %ebx
+  802690:	83 ec 0c             	sub    $0xc,%esp
+  802693:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802696:	53                   	push   %ebx
+  802697:	6a 00                	push   $0x0
+  802699:	e8 50 e9 ff ff       	call   800fee <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80269e:	89 1c 24             	mov    %ebx,(%esp)
+  8026a1:	e8 b5 ec ff ff       	call   80135b <fd2data>
+  8026a6:	83 c4 08             	add    $0x8,%esp
+  8026a9:	50                   	push   %eax
+  8026aa:	6a 00                	push   $0x0
+  8026ac:	e8 3d e9 ff ff       	call   800fee <sys_page_unmap>
+}
+  8026b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026b4:	c9                   	leave
+  8026b5:	c3                   	ret
+
+008026b6 <_pipeisclosed>:
+{
+  8026b6:	55                   	push   %ebp
+  8026b7:	89 e5                	mov    %esp,%ebp
+  8026b9:	57                   	push   %edi
+  8026ba:	56                   	push   %esi
+  8026bb:	53                   	push   %ebx
+  8026bc:	83 ec 1c             	sub    $0x1c,%esp
+  8026bf:	89 c7                	mov    %eax,%edi
+  8026c1:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8026c3:	a1 90 77 80 00       	mov    0x807790,%eax
+  8026c8:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8026cb:	83 ec 0c             	sub    $0xc,%esp
+  8026ce:	57                   	push   %edi
+  8026cf:	e8 df 03 00 00       	call   802ab3 <pageref>
+  8026d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026d7:	89 34 24             	mov    %esi,(%esp)
+  8026da:	e8 d4 03 00 00       	call   802ab3 <pageref>
+		nn = thisenv->env_runs;
+  8026df:	8b 15 90 77 80 00    	mov    0x807790,%edx
+  8026e5:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8026e8:	83 c4 10             	add    $0x10,%esp
+  8026eb:	39 cb                	cmp    %ecx,%ebx
+  8026ed:	74 1b                	je     80270a <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8026ef:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8026f2:	75 cf                	jne    8026c3 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8026f4:	8b 42 5c             	mov    0x5c(%edx),%eax
+  8026f7:	6a 01                	push   $0x1
+  8026f9:	50                   	push   %eax
+  8026fa:	53                   	push   %ebx
+  8026fb:	68 ab 35 80 00       	push   $0x8035ab
+  802700:	e8 c6 dd ff ff       	call   8004cb <cprintf>
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	eb b9                	jmp    8026c3 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80270a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80270d:	0f 94 c0             	sete   %al
+  802710:	0f b6 c0             	movzbl %al,%eax
+}
+  802713:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802716:	5b                   	pop    %ebx
+  802717:	5e                   	pop    %esi
+  802718:	5f                   	pop    %edi
+  802719:	5d                   	pop    %ebp
+  80271a:	c3                   	ret
+
+0080271b <devpipe_write>:
+{
+  80271b:	55                   	push   %ebp
+  80271c:	89 e5                	mov    %esp,%ebp
+  80271e:	57                   	push   %edi
+  80271f:	56                   	push   %esi
+  802720:	53                   	push   %ebx
+  802721:	83 ec 28             	sub    $0x28,%esp
+  802724:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802727:	56                   	push   %esi
+  802728:	e8 2e ec ff ff       	call   80135b <fd2data>
+  80272d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80272f:	83 c4 10             	add    $0x10,%esp
+  802732:	bf 00 00 00 00       	mov    $0x0,%edi
+  802737:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80273a:	75 09                	jne    802745 <devpipe_write+0x2a>
+	return i;
+  80273c:	89 f8                	mov    %edi,%eax
+  80273e:	eb 23                	jmp    802763 <devpipe_write+0x48>
+			sys_yield();
+  802740:	e8 61 e7 ff ff       	call   800ea6 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802745:	8b 43 04             	mov    0x4(%ebx),%eax
+  802748:	8b 0b                	mov    (%ebx),%ecx
+  80274a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80274d:	39 d0                	cmp    %edx,%eax
+  80274f:	72 1a                	jb     80276b <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802751:	89 da                	mov    %ebx,%edx
+  802753:	89 f0                	mov    %esi,%eax
+  802755:	e8 5c ff ff ff       	call   8026b6 <_pipeisclosed>
+  80275a:	85 c0                	test   %eax,%eax
+  80275c:	74 e2                	je     802740 <devpipe_write+0x25>
+				return 0;
+  80275e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802763:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802766:	5b                   	pop    %ebx
+  802767:	5e                   	pop    %esi
+  802768:	5f                   	pop    %edi
+  802769:	5d                   	pop    %ebp
+  80276a:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80276b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80276e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802772:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802775:	89 c2                	mov    %eax,%edx
+  802777:	c1 fa 1f             	sar    $0x1f,%edx
+  80277a:	89 d1                	mov    %edx,%ecx
+  80277c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80277f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802782:	83 e2 1f             	and    $0x1f,%edx
+  802785:	29 ca                	sub    %ecx,%edx
+  802787:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80278b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80278f:	83 c0 01             	add    $0x1,%eax
+  802792:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802795:	83 c7 01             	add    $0x1,%edi
+  802798:	eb 9d                	jmp    802737 <devpipe_write+0x1c>
+
+0080279a <devpipe_read>:
+{
+  80279a:	55                   	push   %ebp
+  80279b:	89 e5                	mov    %esp,%ebp
+  80279d:	57                   	push   %edi
+  80279e:	56                   	push   %esi
+  80279f:	53                   	push   %ebx
+  8027a0:	83 ec 18             	sub    $0x18,%esp
+  8027a3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8027a6:	57                   	push   %edi
+  8027a7:	e8 af eb ff ff       	call   80135b <fd2data>
+  8027ac:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8027ae:	83 c4 10             	add    $0x10,%esp
+  8027b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8027b9:	75 13                	jne    8027ce <devpipe_read+0x34>
+	return i;
+  8027bb:	89 f0                	mov    %esi,%eax
+  8027bd:	eb 02                	jmp    8027c1 <devpipe_read+0x27>
+				return i;
+  8027bf:	89 f0                	mov    %esi,%eax
+}
+  8027c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c4:	5b                   	pop    %ebx
+  8027c5:	5e                   	pop    %esi
+  8027c6:	5f                   	pop    %edi
+  8027c7:	5d                   	pop    %ebp
+  8027c8:	c3                   	ret
+			sys_yield();
+  8027c9:	e8 d8 e6 ff ff       	call   800ea6 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8027ce:	8b 03                	mov    (%ebx),%eax
+  8027d0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8027d3:	75 18                	jne    8027ed <devpipe_read+0x53>
+			if (i > 0)
+  8027d5:	85 f6                	test   %esi,%esi
+  8027d7:	75 e6                	jne    8027bf <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8027d9:	89 da                	mov    %ebx,%edx
+  8027db:	89 f8                	mov    %edi,%eax
+  8027dd:	e8 d4 fe ff ff       	call   8026b6 <_pipeisclosed>
+  8027e2:	85 c0                	test   %eax,%eax
+  8027e4:	74 e3                	je     8027c9 <devpipe_read+0x2f>
+				return 0;
+  8027e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027eb:	eb d4                	jmp    8027c1 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8027ed:	99                   	cltd
+  8027ee:	c1 ea 1b             	shr    $0x1b,%edx
+  8027f1:	01 d0                	add    %edx,%eax
+  8027f3:	83 e0 1f             	and    $0x1f,%eax
+  8027f6:	29 d0                	sub    %edx,%eax
+  8027f8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8027fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802800:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802803:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802806:	83 c6 01             	add    $0x1,%esi
+  802809:	eb ab                	jmp    8027b6 <devpipe_read+0x1c>
+
+0080280b <pipe>:
+{
+  80280b:	55                   	push   %ebp
+  80280c:	89 e5                	mov    %esp,%ebp
+  80280e:	56                   	push   %esi
+  80280f:	53                   	push   %ebx
+  802810:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802813:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802816:	50                   	push   %eax
+  802817:	e8 56 eb ff ff       	call   801372 <fd_alloc>
+  80281c:	89 c3                	mov    %eax,%ebx
+  80281e:	83 c4 10             	add    $0x10,%esp
+  802821:	85 c0                	test   %eax,%eax
+  802823:	0f 88 23 01 00 00    	js     80294c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802829:	83 ec 04             	sub    $0x4,%esp
+  80282c:	68 07 04 00 00       	push   $0x407
+  802831:	ff 75 f4             	push   -0xc(%ebp)
+  802834:	6a 00                	push   $0x0
+  802836:	e8 eb e6 ff ff       	call   800f26 <sys_page_alloc>
+  80283b:	89 c3                	mov    %eax,%ebx
+  80283d:	83 c4 10             	add    $0x10,%esp
+  802840:	85 c0                	test   %eax,%eax
+  802842:	0f 88 04 01 00 00    	js     80294c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802848:	83 ec 0c             	sub    $0xc,%esp
+  80284b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80284e:	50                   	push   %eax
+  80284f:	e8 1e eb ff ff       	call   801372 <fd_alloc>
+  802854:	89 c3                	mov    %eax,%ebx
+  802856:	83 c4 10             	add    $0x10,%esp
+  802859:	85 c0                	test   %eax,%eax
+  80285b:	0f 88 db 00 00 00    	js     80293c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802861:	83 ec 04             	sub    $0x4,%esp
+  802864:	68 07 04 00 00       	push   $0x407
+  802869:	ff 75 f0             	push   -0x10(%ebp)
+  80286c:	6a 00                	push   $0x0
+  80286e:	e8 b3 e6 ff ff       	call   800f26 <sys_page_alloc>
+  802873:	89 c3                	mov    %eax,%ebx
+  802875:	83 c4 10             	add    $0x10,%esp
+  802878:	85 c0                	test   %eax,%eax
+  80287a:	0f 88 bc 00 00 00    	js     80293c <pipe+0x131>
+	va = fd2data(fd0);
+  802880:	83 ec 0c             	sub    $0xc,%esp
+  802883:	ff 75 f4             	push   -0xc(%ebp)
+  802886:	e8 d0 ea ff ff       	call   80135b <fd2data>
+  80288b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80288d:	83 c4 0c             	add    $0xc,%esp
+  802890:	68 07 04 00 00       	push   $0x407
+  802895:	50                   	push   %eax
+  802896:	6a 00                	push   $0x0
+  802898:	e8 89 e6 ff ff       	call   800f26 <sys_page_alloc>
+  80289d:	89 c3                	mov    %eax,%ebx
+  80289f:	83 c4 10             	add    $0x10,%esp
+  8028a2:	85 c0                	test   %eax,%eax
+  8028a4:	0f 88 82 00 00 00    	js     80292c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028aa:	83 ec 0c             	sub    $0xc,%esp
+  8028ad:	ff 75 f0             	push   -0x10(%ebp)
+  8028b0:	e8 a6 ea ff ff       	call   80135b <fd2data>
+  8028b5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8028bc:	50                   	push   %eax
+  8028bd:	6a 00                	push   $0x0
+  8028bf:	56                   	push   %esi
+  8028c0:	6a 00                	push   $0x0
+  8028c2:	e8 e5 e6 ff ff       	call   800fac <sys_page_map>
+  8028c7:	89 c3                	mov    %eax,%ebx
+  8028c9:	83 c4 20             	add    $0x20,%esp
+  8028cc:	85 c0                	test   %eax,%eax
+  8028ce:	78 4e                	js     80291e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8028d0:	a1 c8 57 80 00       	mov    0x8057c8,%eax
+  8028d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028d8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8028da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028dd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8028e4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8028e7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8028e9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8028ec:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8028f3:	83 ec 0c             	sub    $0xc,%esp
+  8028f6:	ff 75 f4             	push   -0xc(%ebp)
+  8028f9:	e8 4d ea ff ff       	call   80134b <fd2num>
+  8028fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802901:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802903:	83 c4 04             	add    $0x4,%esp
+  802906:	ff 75 f0             	push   -0x10(%ebp)
+  802909:	e8 3d ea ff ff       	call   80134b <fd2num>
+  80290e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802911:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802914:	83 c4 10             	add    $0x10,%esp
+  802917:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80291c:	eb 2e                	jmp    80294c <pipe+0x141>
+	sys_page_unmap(0, va);
+  80291e:	83 ec 08             	sub    $0x8,%esp
+  802921:	56                   	push   %esi
+  802922:	6a 00                	push   $0x0
+  802924:	e8 c5 e6 ff ff       	call   800fee <sys_page_unmap>
+  802929:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80292c:	83 ec 08             	sub    $0x8,%esp
+  80292f:	ff 75 f0             	push   -0x10(%ebp)
+  802932:	6a 00                	push   $0x0
+  802934:	e8 b5 e6 ff ff       	call   800fee <sys_page_unmap>
+  802939:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80293c:	83 ec 08             	sub    $0x8,%esp
+  80293f:	ff 75 f4             	push   -0xc(%ebp)
+  802942:	6a 00                	push   $0x0
+  802944:	e8 a5 e6 ff ff       	call   800fee <sys_page_unmap>
+  802949:	83 c4 10             	add    $0x10,%esp
+}
+  80294c:	89 d8                	mov    %ebx,%eax
+  80294e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802951:	5b                   	pop    %ebx
+  802952:	5e                   	pop    %esi
+  802953:	5d                   	pop    %ebp
+  802954:	c3                   	ret
+
+00802955 <pipeisclosed>:
+{
+  802955:	55                   	push   %ebp
+  802956:	89 e5                	mov    %esp,%ebp
+  802958:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80295b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80295e:	50                   	push   %eax
+  80295f:	ff 75 08             	push   0x8(%ebp)
+  802962:	e8 61 ea ff ff       	call   8013c8 <fd_lookup>
+  802967:	83 c4 10             	add    $0x10,%esp
+  80296a:	85 c0                	test   %eax,%eax
+  80296c:	78 18                	js     802986 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80296e:	83 ec 0c             	sub    $0xc,%esp
+  802971:	ff 75 f4             	push   -0xc(%ebp)
+  802974:	e8 e2 e9 ff ff       	call   80135b <fd2data>
+  802979:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80297b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80297e:	e8 33 fd ff ff       	call   8026b6 <_pipeisclosed>
+  802983:	83 c4 10             	add    $0x10,%esp
+}
+  802986:	c9                   	leave
+  802987:	c3                   	ret
+
+00802988 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802988:	55                   	push   %ebp
+  802989:	89 e5                	mov    %esp,%ebp
+  80298b:	56                   	push   %esi
+  80298c:	53                   	push   %ebx
+  80298d:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  802990:	85 f6                	test   %esi,%esi
+  802992:	74 13                	je     8029a7 <wait+0x1f>
+	e = &envs[ENVX(envid)];
+  802994:	89 f3                	mov    %esi,%ebx
+  802996:	81 e3 ff 1f 00 00    	and    $0x1fff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80299c:	c1 e3 09             	shl    $0x9,%ebx
+  80299f:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8029a5:	eb 1b                	jmp    8029c2 <wait+0x3a>
+	assert(envid != 0);
+  8029a7:	68 c3 35 80 00       	push   $0x8035c3
+  8029ac:	68 83 34 80 00       	push   $0x803483
+  8029b1:	6a 09                	push   $0x9
+  8029b3:	68 ce 35 80 00       	push   $0x8035ce
+  8029b8:	e8 33 da ff ff       	call   8003f0 <_panic>
+		sys_yield();
+  8029bd:	e8 e4 e4 ff ff       	call   800ea6 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8029c2:	8b 43 4c             	mov    0x4c(%ebx),%eax
+  8029c5:	39 f0                	cmp    %esi,%eax
+  8029c7:	75 07                	jne    8029d0 <wait+0x48>
+  8029c9:	8b 43 58             	mov    0x58(%ebx),%eax
+  8029cc:	85 c0                	test   %eax,%eax
+  8029ce:	75 ed                	jne    8029bd <wait+0x35>
+}
+  8029d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029d3:	5b                   	pop    %ebx
+  8029d4:	5e                   	pop    %esi
+  8029d5:	5d                   	pop    %ebp
+  8029d6:	c3                   	ret
+
+008029d7 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8029d7:	55                   	push   %ebp
+  8029d8:	89 e5                	mov    %esp,%ebp
+  8029da:	57                   	push   %edi
+  8029db:	56                   	push   %esi
+  8029dc:	53                   	push   %ebx
+  8029dd:	83 ec 18             	sub    $0x18,%esp
+  8029e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029e3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8029e6:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8029e9:	85 db                	test   %ebx,%ebx
+  8029eb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8029f0:	0f 45 c3             	cmovne %ebx,%eax
+  8029f3:	50                   	push   %eax
+  8029f4:	e8 b0 e8 ff ff       	call   8012a9 <sys_ipc_recv>
+
+	if (from_env_store)
+  8029f9:	83 c4 10             	add    $0x10,%esp
+  8029fc:	85 ff                	test   %edi,%edi
+  8029fe:	74 17                	je     802a17 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802a00:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a05:	85 c0                	test   %eax,%eax
+  802a07:	75 0c                	jne    802a15 <ipc_recv+0x3e>
+  802a09:	8b 15 90 77 80 00    	mov    0x807790,%edx
+  802a0f:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802a15:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802a17:	85 f6                	test   %esi,%esi
+  802a19:	74 2e                	je     802a49 <ipc_recv+0x72>
+		if (!r && pg)
+  802a1b:	85 c0                	test   %eax,%eax
+  802a1d:	75 24                	jne    802a43 <ipc_recv+0x6c>
+  802a1f:	85 db                	test   %ebx,%ebx
+  802a21:	74 20                	je     802a43 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802a23:	a1 90 77 80 00       	mov    0x807790,%eax
+  802a28:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802a2e:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802a30:	a1 90 77 80 00       	mov    0x807790,%eax
+  802a35:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802a3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a3e:	5b                   	pop    %ebx
+  802a3f:	5e                   	pop    %esi
+  802a40:	5f                   	pop    %edi
+  802a41:	5d                   	pop    %ebp
+  802a42:	c3                   	ret
+			*perm_store = 0;
+  802a43:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802a49:	85 c0                	test   %eax,%eax
+  802a4b:	75 ee                	jne    802a3b <ipc_recv+0x64>
+  802a4d:	eb e1                	jmp    802a30 <ipc_recv+0x59>
+
+00802a4f <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a4f:	55                   	push   %ebp
+  802a50:	89 e5                	mov    %esp,%ebp
+  802a52:	57                   	push   %edi
+  802a53:	56                   	push   %esi
+  802a54:	53                   	push   %ebx
+  802a55:	83 ec 0c             	sub    $0xc,%esp
+  802a58:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a5b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802a61:	85 db                	test   %ebx,%ebx
+  802a63:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a68:	0f 44 d8             	cmove  %eax,%ebx
+  802a6b:	ff 75 14             	push   0x14(%ebp)
+  802a6e:	53                   	push   %ebx
+  802a6f:	56                   	push   %esi
+  802a70:	57                   	push   %edi
+  802a71:	e8 10 e8 ff ff       	call   801286 <sys_ipc_try_send_yield>
+  802a76:	83 c4 10             	add    $0x10,%esp
+  802a79:	85 c0                	test   %eax,%eax
+  802a7b:	79 1e                	jns    802a9b <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802a7d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802a80:	75 07                	jne    802a89 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802a82:	e8 1f e4 ff ff       	call   800ea6 <sys_yield>
+  802a87:	eb e2                	jmp    802a6b <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802a89:	50                   	push   %eax
+  802a8a:	68 d9 35 80 00       	push   $0x8035d9
+  802a8f:	6a 3d                	push   $0x3d
+  802a91:	68 ee 35 80 00       	push   $0x8035ee
+  802a96:	e8 55 d9 ff ff       	call   8003f0 <_panic>
+	}
+}
+  802a9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a9e:	5b                   	pop    %ebx
+  802a9f:	5e                   	pop    %esi
+  802aa0:	5f                   	pop    %edi
+  802aa1:	5d                   	pop    %ebp
+  802aa2:	c3                   	ret
+
+00802aa3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802aa3:	55                   	push   %ebp
+  802aa4:	89 e5                	mov    %esp,%ebp
+  802aa6:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802aa9:	ff 75 08             	push   0x8(%ebp)
+  802aac:	e8 75 e3 ff ff       	call   800e26 <sys_env_find>
+}
+  802ab1:	c9                   	leave
+  802ab2:	c3                   	ret
+
+00802ab3 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802ab3:	55                   	push   %ebp
+  802ab4:	89 e5                	mov    %esp,%ebp
+  802ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802ab9:	89 c2                	mov    %eax,%edx
+  802abb:	c1 ea 16             	shr    $0x16,%edx
+  802abe:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802ac5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802aca:	f6 c1 01             	test   $0x1,%cl
+  802acd:	74 22                	je     802af1 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802acf:	c1 e8 0c             	shr    $0xc,%eax
+  802ad2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802ad9:	a8 01                	test   $0x1,%al
+  802adb:	74 14                	je     802af1 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802add:	c1 e8 0c             	shr    $0xc,%eax
+  802ae0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802ae3:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802aea:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802aee:	0f b7 d2             	movzwl %dx,%edx
+}
+  802af1:	89 d0                	mov    %edx,%eax
+  802af3:	5d                   	pop    %ebp
+  802af4:	c3                   	ret
+  802af5:	66 90                	xchg   %ax,%ax
+  802af7:	66 90                	xchg   %ax,%ax
+  802af9:	66 90                	xchg   %ax,%ax
+  802afb:	66 90                	xchg   %ax,%ax
+  802afd:	66 90                	xchg   %ax,%ax
+  802aff:	90                   	nop
+
+00802b00 <__udivmoddi4>:
+  802b00:	55                   	push   %ebp
+  802b01:	57                   	push   %edi
+  802b02:	56                   	push   %esi
+  802b03:	53                   	push   %ebx
+  802b04:	83 ec 14             	sub    $0x14,%esp
+  802b07:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802b0b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802b0f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802b13:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802b17:	89 f1                	mov    %esi,%ecx
+  802b19:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  802b1d:	09 d9                	or     %ebx,%ecx
+  802b1f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802b23:	0f 84 92 00 00 00    	je     802bbb <__udivmoddi4+0xbb>
+  802b29:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802b30:	00 
+  802b31:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802b36:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802b3d:	00 
+  802b3e:	89 1c 24             	mov    %ebx,(%esp)
+  802b41:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802b45:	8d 76 00             	lea    0x0(%esi),%esi
+  802b48:	89 e9                	mov    %ebp,%ecx
+  802b4a:	89 c3                	mov    %eax,%ebx
+  802b4c:	89 d6                	mov    %edx,%esi
+  802b4e:	31 ff                	xor    %edi,%edi
+  802b50:	d3 ee                	shr    %cl,%esi
+  802b52:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802b55:	f6 c1 20             	test   $0x20,%cl
+  802b58:	0f 45 de             	cmovne %esi,%ebx
+  802b5b:	0f 45 f7             	cmovne %edi,%esi
+  802b5e:	8b 3c 24             	mov    (%esp),%edi
+  802b61:	39 fb                	cmp    %edi,%ebx
+  802b63:	89 f7                	mov    %esi,%edi
+  802b65:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802b69:	8b 1c 24             	mov    (%esp),%ebx
+  802b6c:	19 f7                	sbb    %esi,%edi
+  802b6e:	72 39                	jb     802ba9 <__udivmoddi4+0xa9>
+  802b70:	89 e9                	mov    %ebp,%ecx
+  802b72:	89 f7                	mov    %esi,%edi
+  802b74:	89 de                	mov    %ebx,%esi
+  802b76:	0f a5 df             	shld   %cl,%ebx,%edi
+  802b79:	d3 e6                	shl    %cl,%esi
+  802b7b:	31 db                	xor    %ebx,%ebx
+  802b7d:	f6 c1 20             	test   $0x20,%cl
+  802b80:	0f 45 fe             	cmovne %esi,%edi
+  802b83:	0f 45 f3             	cmovne %ebx,%esi
+  802b86:	29 f0                	sub    %esi,%eax
+  802b88:	be 01 00 00 00       	mov    $0x1,%esi
+  802b8d:	19 fa                	sbb    %edi,%edx
+  802b8f:	31 ff                	xor    %edi,%edi
+  802b91:	31 db                	xor    %ebx,%ebx
+  802b93:	0f a5 f7             	shld   %cl,%esi,%edi
+  802b96:	d3 e6                	shl    %cl,%esi
+  802b98:	f6 c1 20             	test   $0x20,%cl
+  802b9b:	0f 45 fe             	cmovne %esi,%edi
+  802b9e:	0f 45 f3             	cmovne %ebx,%esi
+  802ba1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802ba5:	09 74 24 08          	or     %esi,0x8(%esp)
+  802ba9:	83 ed 01             	sub    $0x1,%ebp
+  802bac:	73 9a                	jae    802b48 <__udivmoddi4+0x48>
+  802bae:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802bb2:	85 ff                	test   %edi,%edi
+  802bb4:	74 05                	je     802bbb <__udivmoddi4+0xbb>
+  802bb6:	89 07                	mov    %eax,(%edi)
+  802bb8:	89 57 04             	mov    %edx,0x4(%edi)
+  802bbb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802bbf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802bc3:	83 c4 14             	add    $0x14,%esp
+  802bc6:	5b                   	pop    %ebx
+  802bc7:	5e                   	pop    %esi
+  802bc8:	5f                   	pop    %edi
+  802bc9:	5d                   	pop    %ebp
+  802bca:	c3                   	ret
+  802bcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802bcf:	90                   	nop
+
+00802bd0 <__udivdi3>:
+  802bd0:	55                   	push   %ebp
+  802bd1:	57                   	push   %edi
+  802bd2:	56                   	push   %esi
+  802bd3:	53                   	push   %ebx
+  802bd4:	83 ec 14             	sub    $0x14,%esp
+  802bd7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802bdb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802bdf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802be3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802be7:	89 fb                	mov    %edi,%ebx
+  802be9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802bed:	09 f3                	or     %esi,%ebx
+  802bef:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802bf3:	0f 84 85 00 00 00    	je     802c7e <__udivdi3+0xae>
+  802bf9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c00:	00 
+  802c01:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802c06:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c0d:	00 
+  802c0e:	89 34 24             	mov    %esi,(%esp)
+  802c11:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c15:	8d 76 00             	lea    0x0(%esi),%esi
+  802c18:	89 e9                	mov    %ebp,%ecx
+  802c1a:	89 c3                	mov    %eax,%ebx
+  802c1c:	89 d6                	mov    %edx,%esi
+  802c1e:	31 ff                	xor    %edi,%edi
+  802c20:	d3 ee                	shr    %cl,%esi
+  802c22:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802c25:	f6 c1 20             	test   $0x20,%cl
+  802c28:	0f 45 de             	cmovne %esi,%ebx
+  802c2b:	0f 45 f7             	cmovne %edi,%esi
+  802c2e:	8b 3c 24             	mov    (%esp),%edi
+  802c31:	39 fb                	cmp    %edi,%ebx
+  802c33:	89 f7                	mov    %esi,%edi
+  802c35:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c39:	8b 1c 24             	mov    (%esp),%ebx
+  802c3c:	19 f7                	sbb    %esi,%edi
+  802c3e:	72 39                	jb     802c79 <__udivdi3+0xa9>
+  802c40:	89 e9                	mov    %ebp,%ecx
+  802c42:	89 f7                	mov    %esi,%edi
+  802c44:	89 de                	mov    %ebx,%esi
+  802c46:	0f a5 df             	shld   %cl,%ebx,%edi
+  802c49:	d3 e6                	shl    %cl,%esi
+  802c4b:	31 db                	xor    %ebx,%ebx
+  802c4d:	f6 c1 20             	test   $0x20,%cl
+  802c50:	0f 45 fe             	cmovne %esi,%edi
+  802c53:	0f 45 f3             	cmovne %ebx,%esi
+  802c56:	29 f0                	sub    %esi,%eax
+  802c58:	be 01 00 00 00       	mov    $0x1,%esi
+  802c5d:	19 fa                	sbb    %edi,%edx
+  802c5f:	31 ff                	xor    %edi,%edi
+  802c61:	31 db                	xor    %ebx,%ebx
+  802c63:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c66:	d3 e6                	shl    %cl,%esi
+  802c68:	f6 c1 20             	test   $0x20,%cl
+  802c6b:	0f 45 fe             	cmovne %esi,%edi
+  802c6e:	0f 45 f3             	cmovne %ebx,%esi
+  802c71:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802c75:	09 74 24 08          	or     %esi,0x8(%esp)
+  802c79:	83 ed 01             	sub    $0x1,%ebp
+  802c7c:	73 9a                	jae    802c18 <__udivdi3+0x48>
+  802c7e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c82:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c86:	83 c4 14             	add    $0x14,%esp
+  802c89:	5b                   	pop    %ebx
+  802c8a:	5e                   	pop    %esi
+  802c8b:	5f                   	pop    %edi
+  802c8c:	5d                   	pop    %ebp
+  802c8d:	c3                   	ret
+  802c8e:	66 90                	xchg   %ax,%ax
+
+00802c90 <__umoddi3>:
+  802c90:	57                   	push   %edi
+  802c91:	56                   	push   %esi
+  802c92:	53                   	push   %ebx
+  802c93:	83 ec 08             	sub    $0x8,%esp
+  802c96:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  802c9a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  802c9e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802ca2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ca6:	89 f9                	mov    %edi,%ecx
+  802ca8:	89 34 24             	mov    %esi,(%esp)
+  802cab:	09 f1                	or     %esi,%ecx
+  802cad:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802cb1:	74 53                	je     802d06 <__umoddi3+0x76>
+  802cb3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802cb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802cbf:	90                   	nop
+  802cc0:	89 c6                	mov    %eax,%esi
+  802cc2:	89 d7                	mov    %edx,%edi
+  802cc4:	31 db                	xor    %ebx,%ebx
+  802cc6:	d3 ef                	shr    %cl,%edi
+  802cc8:	0f ad d6             	shrd   %cl,%edx,%esi
+  802ccb:	f6 c1 20             	test   $0x20,%cl
+  802cce:	0f 45 f7             	cmovne %edi,%esi
+  802cd1:	0f 45 fb             	cmovne %ebx,%edi
+  802cd4:	8b 1c 24             	mov    (%esp),%ebx
+  802cd7:	39 de                	cmp    %ebx,%esi
+  802cd9:	89 fb                	mov    %edi,%ebx
+  802cdb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  802cdf:	8b 34 24             	mov    (%esp),%esi
+  802ce2:	19 fb                	sbb    %edi,%ebx
+  802ce4:	72 14                	jb     802cfa <__umoddi3+0x6a>
+  802ce6:	0f a5 f7             	shld   %cl,%esi,%edi
+  802ce9:	31 db                	xor    %ebx,%ebx
+  802ceb:	d3 e6                	shl    %cl,%esi
+  802ced:	f6 c1 20             	test   $0x20,%cl
+  802cf0:	0f 45 fe             	cmovne %esi,%edi
+  802cf3:	0f 45 f3             	cmovne %ebx,%esi
+  802cf6:	29 f0                	sub    %esi,%eax
+  802cf8:	19 fa                	sbb    %edi,%edx
+  802cfa:	83 e9 01             	sub    $0x1,%ecx
+  802cfd:	73 c1                	jae    802cc0 <__umoddi3+0x30>
+  802cff:	83 c4 08             	add    $0x8,%esp
+  802d02:	5b                   	pop    %ebx
+  802d03:	5e                   	pop    %esi
+  802d04:	5f                   	pop    %edi
+  802d05:	c3                   	ret
+  802d06:	83 c4 08             	add    $0x8,%esp
+  802d09:	31 c0                	xor    %eax,%eax
+  802d0b:	31 d2                	xor    %edx,%edx
+  802d0d:	5b                   	pop    %ebx
+  802d0e:	5e                   	pop    %esi
+  802d0f:	5f                   	pop    %edi
+  802d10:	c3                   	ret
+  802d11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802d1f:	90                   	nop
+
+00802d20 <__divdi3>:
+  802d20:	55                   	push   %ebp
+  802d21:	57                   	push   %edi
+  802d22:	56                   	push   %esi
+  802d23:	53                   	push   %ebx
+  802d24:	83 ec 1c             	sub    $0x1c,%esp
+  802d27:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802d2b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802d2f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802d33:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802d37:	85 ff                	test   %edi,%edi
+  802d39:	0f 88 da 00 00 00    	js     802e19 <__divdi3+0xf9>
+  802d3f:	85 db                	test   %ebx,%ebx
+  802d41:	78 16                	js     802d59 <__divdi3+0x39>
+  802d43:	89 dd                	mov    %ebx,%ebp
+  802d45:	89 c8                	mov    %ecx,%eax
+  802d47:	89 da                	mov    %ebx,%edx
+  802d49:	09 cd                	or     %ecx,%ebp
+  802d4b:	0f 85 fd 00 00 00    	jne    802e4e <__divdi3+0x12e>
+  802d51:	83 c4 1c             	add    $0x1c,%esp
+  802d54:	5b                   	pop    %ebx
+  802d55:	5e                   	pop    %esi
+  802d56:	5f                   	pop    %edi
+  802d57:	5d                   	pop    %ebp
+  802d58:	c3                   	ret
+  802d59:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802d5e:	f7 d9                	neg    %ecx
+  802d60:	89 f0                	mov    %esi,%eax
+  802d62:	89 fa                	mov    %edi,%edx
+  802d64:	83 d3 00             	adc    $0x0,%ebx
+  802d67:	89 0c 24             	mov    %ecx,(%esp)
+  802d6a:	f7 db                	neg    %ebx
+  802d6c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802d70:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802d77:	00 
+  802d78:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d7d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802d84:	00 
+  802d85:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802d89:	89 cd                	mov    %ecx,%ebp
+  802d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802d8f:	90                   	nop
+  802d90:	89 e9                	mov    %ebp,%ecx
+  802d92:	89 c3                	mov    %eax,%ebx
+  802d94:	89 d6                	mov    %edx,%esi
+  802d96:	31 ff                	xor    %edi,%edi
+  802d98:	d3 ee                	shr    %cl,%esi
+  802d9a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802d9d:	f6 c1 20             	test   $0x20,%cl
+  802da0:	0f 45 de             	cmovne %esi,%ebx
+  802da3:	0f 45 f7             	cmovne %edi,%esi
+  802da6:	8b 3c 24             	mov    (%esp),%edi
+  802da9:	39 fb                	cmp    %edi,%ebx
+  802dab:	89 f7                	mov    %esi,%edi
+  802dad:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802db1:	8b 1c 24             	mov    (%esp),%ebx
+  802db4:	19 f7                	sbb    %esi,%edi
+  802db6:	72 39                	jb     802df1 <__divdi3+0xd1>
+  802db8:	89 e9                	mov    %ebp,%ecx
+  802dba:	89 f7                	mov    %esi,%edi
+  802dbc:	89 de                	mov    %ebx,%esi
+  802dbe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802dc1:	d3 e6                	shl    %cl,%esi
+  802dc3:	31 db                	xor    %ebx,%ebx
+  802dc5:	f6 c1 20             	test   $0x20,%cl
+  802dc8:	0f 45 fe             	cmovne %esi,%edi
+  802dcb:	0f 45 f3             	cmovne %ebx,%esi
+  802dce:	29 f0                	sub    %esi,%eax
+  802dd0:	be 01 00 00 00       	mov    $0x1,%esi
+  802dd5:	19 fa                	sbb    %edi,%edx
+  802dd7:	31 ff                	xor    %edi,%edi
+  802dd9:	31 db                	xor    %ebx,%ebx
+  802ddb:	0f a5 f7             	shld   %cl,%esi,%edi
+  802dde:	d3 e6                	shl    %cl,%esi
+  802de0:	f6 c1 20             	test   $0x20,%cl
+  802de3:	0f 45 fe             	cmovne %esi,%edi
+  802de6:	0f 45 f3             	cmovne %ebx,%esi
+  802de9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802ded:	09 74 24 08          	or     %esi,0x8(%esp)
+  802df1:	83 ed 01             	sub    $0x1,%ebp
+  802df4:	73 9a                	jae    802d90 <__divdi3+0x70>
+  802df6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802dfa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802dfe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e02:	85 ed                	test   %ebp,%ebp
+  802e04:	0f 84 47 ff ff ff    	je     802d51 <__divdi3+0x31>
+  802e0a:	f7 d8                	neg    %eax
+  802e0c:	83 d2 00             	adc    $0x0,%edx
+  802e0f:	83 c4 1c             	add    $0x1c,%esp
+  802e12:	5b                   	pop    %ebx
+  802e13:	f7 da                	neg    %edx
+  802e15:	5e                   	pop    %esi
+  802e16:	5f                   	pop    %edi
+  802e17:	5d                   	pop    %ebp
+  802e18:	c3                   	ret
+  802e19:	f7 de                	neg    %esi
+  802e1b:	83 d7 00             	adc    $0x0,%edi
+  802e1e:	f7 df                	neg    %edi
+  802e20:	85 db                	test   %ebx,%ebx
+  802e22:	78 23                	js     802e47 <__divdi3+0x127>
+  802e24:	89 dd                	mov    %ebx,%ebp
+  802e26:	89 c8                	mov    %ecx,%eax
+  802e28:	89 da                	mov    %ebx,%edx
+  802e2a:	09 cd                	or     %ecx,%ebp
+  802e2c:	0f 84 1f ff ff ff    	je     802d51 <__divdi3+0x31>
+  802e32:	89 0c 24             	mov    %ecx,(%esp)
+  802e35:	89 f0                	mov    %esi,%eax
+  802e37:	89 fa                	mov    %edi,%edx
+  802e39:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802e3e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802e42:	e9 29 ff ff ff       	jmp    802d70 <__divdi3+0x50>
+  802e47:	31 ed                	xor    %ebp,%ebp
+  802e49:	e9 10 ff ff ff       	jmp    802d5e <__divdi3+0x3e>
+  802e4e:	89 0c 24             	mov    %ecx,(%esp)
+  802e51:	89 f0                	mov    %esi,%eax
+  802e53:	89 fa                	mov    %edi,%edx
+  802e55:	31 ed                	xor    %ebp,%ebp
+  802e57:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802e5b:	e9 10 ff ff ff       	jmp    802d70 <__divdi3+0x50>
+
+00802e60 <__moddi3>:
+  802e60:	55                   	push   %ebp
+  802e61:	57                   	push   %edi
+  802e62:	56                   	push   %esi
+  802e63:	53                   	push   %ebx
+  802e64:	83 ec 14             	sub    $0x14,%esp
+  802e67:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e6b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e6f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802e73:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802e77:	85 d2                	test   %edx,%edx
+  802e79:	0f 88 9b 00 00 00    	js     802f1a <__moddi3+0xba>
+  802e7f:	89 f7                	mov    %esi,%edi
+  802e81:	31 ed                	xor    %ebp,%ebp
+  802e83:	09 cf                	or     %ecx,%edi
+  802e85:	0f 84 83 00 00 00    	je     802f0e <__moddi3+0xae>
+  802e8b:	89 cb                	mov    %ecx,%ebx
+  802e8d:	89 f7                	mov    %esi,%edi
+  802e8f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802e93:	f7 db                	neg    %ebx
+  802e95:	83 d7 00             	adc    $0x0,%edi
+  802e98:	f7 df                	neg    %edi
+  802e9a:	0f 49 f7             	cmovns %edi,%esi
+  802e9d:	0f 49 cb             	cmovns %ebx,%ecx
+  802ea0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802ea4:	89 0c 24             	mov    %ecx,(%esp)
+  802ea7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802eac:	89 cd                	mov    %ecx,%ebp
+  802eae:	66 90                	xchg   %ax,%ax
+  802eb0:	89 e9                	mov    %ebp,%ecx
+  802eb2:	89 c3                	mov    %eax,%ebx
+  802eb4:	89 d6                	mov    %edx,%esi
+  802eb6:	31 ff                	xor    %edi,%edi
+  802eb8:	d3 ee                	shr    %cl,%esi
+  802eba:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802ebd:	f6 c1 20             	test   $0x20,%cl
+  802ec0:	0f 45 de             	cmovne %esi,%ebx
+  802ec3:	0f 45 f7             	cmovne %edi,%esi
+  802ec6:	8b 3c 24             	mov    (%esp),%edi
+  802ec9:	39 fb                	cmp    %edi,%ebx
+  802ecb:	89 f7                	mov    %esi,%edi
+  802ecd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ed1:	8b 1c 24             	mov    (%esp),%ebx
+  802ed4:	19 f7                	sbb    %esi,%edi
+  802ed6:	72 1a                	jb     802ef2 <__moddi3+0x92>
+  802ed8:	89 e9                	mov    %ebp,%ecx
+  802eda:	89 f7                	mov    %esi,%edi
+  802edc:	89 de                	mov    %ebx,%esi
+  802ede:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ee1:	d3 e6                	shl    %cl,%esi
+  802ee3:	31 db                	xor    %ebx,%ebx
+  802ee5:	f6 c1 20             	test   $0x20,%cl
+  802ee8:	0f 45 fe             	cmovne %esi,%edi
+  802eeb:	0f 45 f3             	cmovne %ebx,%esi
+  802eee:	29 f0                	sub    %esi,%eax
+  802ef0:	19 fa                	sbb    %edi,%edx
+  802ef2:	83 ed 01             	sub    $0x1,%ebp
+  802ef5:	73 b9                	jae    802eb0 <__moddi3+0x50>
+  802ef7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802efb:	85 ed                	test   %ebp,%ebp
+  802efd:	74 07                	je     802f06 <__moddi3+0xa6>
+  802eff:	f7 d8                	neg    %eax
+  802f01:	83 d2 00             	adc    $0x0,%edx
+  802f04:	f7 da                	neg    %edx
+  802f06:	83 c4 14             	add    $0x14,%esp
+  802f09:	5b                   	pop    %ebx
+  802f0a:	5e                   	pop    %esi
+  802f0b:	5f                   	pop    %edi
+  802f0c:	5d                   	pop    %ebp
+  802f0d:	c3                   	ret
+  802f0e:	83 c4 14             	add    $0x14,%esp
+  802f11:	31 c0                	xor    %eax,%eax
+  802f13:	31 d2                	xor    %edx,%edx
+  802f15:	5b                   	pop    %ebx
+  802f16:	5e                   	pop    %esi
+  802f17:	5f                   	pop    %edi
+  802f18:	5d                   	pop    %ebp
+  802f19:	c3                   	ret
+  802f1a:	89 f7                	mov    %esi,%edi
+  802f1c:	09 cf                	or     %ecx,%edi
+  802f1e:	74 11                	je     802f31 <__moddi3+0xd1>
+  802f20:	f7 d8                	neg    %eax
+  802f22:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802f27:	83 d2 00             	adc    $0x0,%edx
+  802f2a:	f7 da                	neg    %edx
+  802f2c:	e9 5a ff ff ff       	jmp    802e8b <__moddi3+0x2b>
+  802f31:	31 c0                	xor    %eax,%eax
+  802f33:	31 d2                	xor    %edx,%edx
+  802f35:	eb c8                	jmp    802eff <__moddi3+0x9f>
@@ -0,0 +1,6250 @@
+
+obj/user/ls.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9b 02 00 00       	call   8002cc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ls1>:
+		panic("error reading directory %s: %e", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	const char *sep;
+
+	if(flag['l'])
+  80003e:	83 3d d0 51 80 00 00 	cmpl   $0x0,0x8051d0
+  800045:	74 20                	je     800067 <ls1+0x34>
+		printf("%11d %c ", size, isdir ? 'd' : '-');
+  800047:	89 f0                	mov    %esi,%eax
+  800049:	3c 01                	cmp    $0x1,%al
+  80004b:	19 c0                	sbb    %eax,%eax
+  80004d:	83 e0 c9             	and    $0xffffffc9,%eax
+  800050:	83 c0 64             	add    $0x64,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	ff 75 10             	push   0x10(%ebp)
+  80005a:	68 62 2b 80 00       	push   $0x802b62
+  80005f:	e8 5b 1c 00 00       	call   801cbf <printf>
+  800064:	83 c4 10             	add    $0x10,%esp
+	if(prefix) {
+  800067:	85 db                	test   %ebx,%ebx
+  800069:	74 1c                	je     800087 <ls1+0x54>
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+			sep = "/";
+		else
+			sep = "";
+  80006b:	b8 c8 2b 80 00       	mov    $0x802bc8,%eax
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  800070:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800073:	75 4b                	jne    8000c0 <ls1+0x8d>
+		printf("%s%s", prefix, sep);
+  800075:	83 ec 04             	sub    $0x4,%esp
+  800078:	50                   	push   %eax
+  800079:	53                   	push   %ebx
+  80007a:	68 6b 2b 80 00       	push   $0x802b6b
+  80007f:	e8 3b 1c 00 00       	call   801cbf <printf>
+  800084:	83 c4 10             	add    $0x10,%esp
+	}
+	printf("%s", name);
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	ff 75 14             	push   0x14(%ebp)
+  80008d:	68 f5 2f 80 00       	push   $0x802ff5
+  800092:	e8 28 1c 00 00       	call   801cbf <printf>
+	if(flag['F'] && isdir)
+  800097:	83 c4 10             	add    $0x10,%esp
+  80009a:	83 3d 38 51 80 00 00 	cmpl   $0x0,0x805138
+  8000a1:	74 06                	je     8000a9 <ls1+0x76>
+  8000a3:	89 f0                	mov    %esi,%eax
+  8000a5:	84 c0                	test   %al,%al
+  8000a7:	75 37                	jne    8000e0 <ls1+0xad>
+		printf("/");
+	printf("\n");
+  8000a9:	83 ec 0c             	sub    $0xc,%esp
+  8000ac:	68 c7 2b 80 00       	push   $0x802bc7
+  8000b1:	e8 09 1c 00 00       	call   801cbf <printf>
+}
+  8000b6:	83 c4 10             	add    $0x10,%esp
+  8000b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000bc:	5b                   	pop    %ebx
+  8000bd:	5e                   	pop    %esi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  8000c0:	83 ec 0c             	sub    $0xc,%esp
+  8000c3:	53                   	push   %ebx
+  8000c4:	e8 f1 08 00 00       	call   8009ba <strlen>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+			sep = "/";
+  8000cc:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%ebx,%eax,1)
+  8000d1:	b8 c8 2b 80 00       	mov    $0x802bc8,%eax
+  8000d6:	ba 60 2b 80 00       	mov    $0x802b60,%edx
+  8000db:	0f 45 c2             	cmovne %edx,%eax
+  8000de:	eb 95                	jmp    800075 <ls1+0x42>
+		printf("/");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 60 2b 80 00       	push   $0x802b60
+  8000e8:	e8 d2 1b 00 00       	call   801cbf <printf>
+  8000ed:	83 c4 10             	add    $0x10,%esp
+  8000f0:	eb b7                	jmp    8000a9 <ls1+0x76>
+
+008000f2 <lsdir>:
+{
+  8000f2:	55                   	push   %ebp
+  8000f3:	89 e5                	mov    %esp,%ebp
+  8000f5:	57                   	push   %edi
+  8000f6:	56                   	push   %esi
+  8000f7:	53                   	push   %ebx
+  8000f8:	81 ec 14 01 00 00    	sub    $0x114,%esp
+  8000fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800101:	6a 00                	push   $0x0
+  800103:	57                   	push   %edi
+  800104:	e8 13 1a 00 00       	call   801b1c <open>
+  800109:	89 c3                	mov    %eax,%ebx
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	85 c0                	test   %eax,%eax
+  800110:	78 50                	js     800162 <lsdir+0x70>
+	while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  800112:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800118:	83 ec 04             	sub    $0x4,%esp
+  80011b:	68 00 01 00 00       	push   $0x100
+  800120:	56                   	push   %esi
+  800121:	53                   	push   %ebx
+  800122:	e8 19 16 00 00       	call   801740 <readn>
+  800127:	83 c4 10             	add    $0x10,%esp
+  80012a:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80012f:	75 47                	jne    800178 <lsdir+0x86>
+		if (f.f_name[0])
+  800131:	80 bd e8 fe ff ff 00 	cmpb   $0x0,-0x118(%ebp)
+  800138:	74 de                	je     800118 <lsdir+0x26>
+			ls1(prefix, f.f_type==FTYPE_DIR, f.f_size, f.f_name);
+  80013a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  800140:	50                   	push   %eax
+  800141:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+  800147:	83 bd 6c ff ff ff 01 	cmpl   $0x1,-0x94(%ebp)
+  80014e:	0f 94 c0             	sete   %al
+  800151:	0f b6 c0             	movzbl %al,%eax
+  800154:	50                   	push   %eax
+  800155:	ff 75 0c             	push   0xc(%ebp)
+  800158:	e8 d6 fe ff ff       	call   800033 <ls1>
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	eb b6                	jmp    800118 <lsdir+0x26>
+		panic("open %s: %e", path, fd);
+  800162:	83 ec 0c             	sub    $0xc,%esp
+  800165:	50                   	push   %eax
+  800166:	57                   	push   %edi
+  800167:	68 70 2b 80 00       	push   $0x802b70
+  80016c:	6a 1d                	push   $0x1d
+  80016e:	68 7c 2b 80 00       	push   $0x802b7c
+  800173:	e8 b4 01 00 00       	call   80032c <_panic>
+	if (n > 0)
+  800178:	85 c0                	test   %eax,%eax
+  80017a:	7f 0a                	jg     800186 <lsdir+0x94>
+	if (n < 0)
+  80017c:	78 1a                	js     800198 <lsdir+0xa6>
+}
+  80017e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800181:	5b                   	pop    %ebx
+  800182:	5e                   	pop    %esi
+  800183:	5f                   	pop    %edi
+  800184:	5d                   	pop    %ebp
+  800185:	c3                   	ret
+		panic("short read in directory %s", path);
+  800186:	57                   	push   %edi
+  800187:	68 86 2b 80 00       	push   $0x802b86
+  80018c:	6a 22                	push   $0x22
+  80018e:	68 7c 2b 80 00       	push   $0x802b7c
+  800193:	e8 94 01 00 00       	call   80032c <_panic>
+		panic("error reading directory %s: %e", path, n);
+  800198:	83 ec 0c             	sub    $0xc,%esp
+  80019b:	50                   	push   %eax
+  80019c:	57                   	push   %edi
+  80019d:	68 cc 2b 80 00       	push   $0x802bcc
+  8001a2:	6a 24                	push   $0x24
+  8001a4:	68 7c 2b 80 00       	push   $0x802b7c
+  8001a9:	e8 7e 01 00 00       	call   80032c <_panic>
+
+008001ae <ls>:
+{
+  8001ae:	55                   	push   %ebp
+  8001af:	89 e5                	mov    %esp,%ebp
+  8001b1:	53                   	push   %ebx
+  8001b2:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8001b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = stat(path, &st)) < 0)
+  8001bb:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  8001c1:	50                   	push   %eax
+  8001c2:	53                   	push   %ebx
+  8001c3:	e8 5e 17 00 00       	call   801926 <stat>
+  8001c8:	83 c4 10             	add    $0x10,%esp
+  8001cb:	85 c0                	test   %eax,%eax
+  8001cd:	78 2c                	js     8001fb <ls+0x4d>
+	if (st.st_isdir && !flag['d'])
+  8001cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8001d2:	85 c0                	test   %eax,%eax
+  8001d4:	74 09                	je     8001df <ls+0x31>
+  8001d6:	83 3d b0 51 80 00 00 	cmpl   $0x0,0x8051b0
+  8001dd:	74 32                	je     800211 <ls+0x63>
+		ls1(0, st.st_isdir, st.st_size, path);
+  8001df:	53                   	push   %ebx
+  8001e0:	ff 75 ec             	push   -0x14(%ebp)
+  8001e3:	85 c0                	test   %eax,%eax
+  8001e5:	0f 95 c0             	setne  %al
+  8001e8:	0f b6 c0             	movzbl %al,%eax
+  8001eb:	50                   	push   %eax
+  8001ec:	6a 00                	push   $0x0
+  8001ee:	e8 40 fe ff ff       	call   800033 <ls1>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+}
+  8001f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f9:	c9                   	leave
+  8001fa:	c3                   	ret
+		panic("stat %s: %e", path, r);
+  8001fb:	83 ec 0c             	sub    $0xc,%esp
+  8001fe:	50                   	push   %eax
+  8001ff:	53                   	push   %ebx
+  800200:	68 a1 2b 80 00       	push   $0x802ba1
+  800205:	6a 0f                	push   $0xf
+  800207:	68 7c 2b 80 00       	push   $0x802b7c
+  80020c:	e8 1b 01 00 00       	call   80032c <_panic>
+		lsdir(path, prefix);
+  800211:	83 ec 08             	sub    $0x8,%esp
+  800214:	ff 75 0c             	push   0xc(%ebp)
+  800217:	53                   	push   %ebx
+  800218:	e8 d5 fe ff ff       	call   8000f2 <lsdir>
+  80021d:	83 c4 10             	add    $0x10,%esp
+  800220:	eb d4                	jmp    8001f6 <ls+0x48>
+
+00800222 <usage>:
+
+void
+usage(void)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 14             	sub    $0x14,%esp
+	printf("usage: ls [-dFl] [file...]\n");
+  800228:	68 ad 2b 80 00       	push   $0x802bad
+  80022d:	e8 8d 1a 00 00       	call   801cbf <printf>
+	exit();
+  800232:	e8 db 00 00 00       	call   800312 <exit>
+}
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	56                   	push   %esi
+  800240:	53                   	push   %ebx
+  800241:	83 ec 14             	sub    $0x14,%esp
+  800244:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800247:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  80024a:	50                   	push   %eax
+  80024b:	56                   	push   %esi
+  80024c:	8d 45 08             	lea    0x8(%ebp),%eax
+  80024f:	50                   	push   %eax
+  800250:	e8 32 10 00 00       	call   801287 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+  80025b:	eb 08                	jmp    800265 <umain+0x29>
+		switch (i) {
+		case 'd':
+		case 'F':
+		case 'l':
+			flag[i]++;
+  80025d:	83 04 85 20 50 80 00 	addl   $0x1,0x805020(,%eax,4)
+  800264:	01 
+	while ((i = argnext(&args)) >= 0)
+  800265:	83 ec 0c             	sub    $0xc,%esp
+  800268:	53                   	push   %ebx
+  800269:	e8 49 10 00 00       	call   8012b7 <argnext>
+  80026e:	83 c4 10             	add    $0x10,%esp
+  800271:	85 c0                	test   %eax,%eax
+  800273:	78 16                	js     80028b <umain+0x4f>
+		switch (i) {
+  800275:	89 c2                	mov    %eax,%edx
+  800277:	83 e2 f7             	and    $0xfffffff7,%edx
+  80027a:	83 fa 64             	cmp    $0x64,%edx
+  80027d:	74 de                	je     80025d <umain+0x21>
+  80027f:	83 f8 46             	cmp    $0x46,%eax
+  800282:	74 d9                	je     80025d <umain+0x21>
+			break;
+		default:
+			usage();
+  800284:	e8 99 ff ff ff       	call   800222 <usage>
+  800289:	eb da                	jmp    800265 <umain+0x29>
+		}
+
+	if (argc == 1)
+		ls("/", "");
+	else {
+		for (i = 1; i < argc; i++)
+  80028b:	bb 01 00 00 00       	mov    $0x1,%ebx
+	if (argc == 1)
+  800290:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800294:	75 2a                	jne    8002c0 <umain+0x84>
+		ls("/", "");
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	68 c8 2b 80 00       	push   $0x802bc8
+  80029e:	68 60 2b 80 00       	push   $0x802b60
+  8002a3:	e8 06 ff ff ff       	call   8001ae <ls>
+  8002a8:	83 c4 10             	add    $0x10,%esp
+  8002ab:	eb 18                	jmp    8002c5 <umain+0x89>
+			ls(argv[i], argv[i]);
+  8002ad:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8002b0:	83 ec 08             	sub    $0x8,%esp
+  8002b3:	50                   	push   %eax
+  8002b4:	50                   	push   %eax
+  8002b5:	e8 f4 fe ff ff       	call   8001ae <ls>
+		for (i = 1; i < argc; i++)
+  8002ba:	83 c3 01             	add    $0x1,%ebx
+  8002bd:	83 c4 10             	add    $0x10,%esp
+  8002c0:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  8002c3:	7f e8                	jg     8002ad <umain+0x71>
+	}
+}
+  8002c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002c8:	5b                   	pop    %ebx
+  8002c9:	5e                   	pop    %esi
+  8002ca:	5d                   	pop    %ebp
+  8002cb:	c3                   	ret
+
+008002cc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	56                   	push   %esi
+  8002d0:	53                   	push   %ebx
+  8002d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002d4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8002d7:	e8 e7 0a 00 00       	call   800dc3 <sys_getenvid>
+  8002dc:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8002e1:	c1 e0 09             	shl    $0x9,%eax
+  8002e4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002e9:	a3 20 54 80 00       	mov    %eax,0x805420
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002ee:	85 db                	test   %ebx,%ebx
+  8002f0:	7e 07                	jle    8002f9 <libmain+0x2d>
+		binaryname = argv[0];
+  8002f2:	8b 06                	mov    (%esi),%eax
+  8002f4:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8002f9:	83 ec 08             	sub    $0x8,%esp
+  8002fc:	56                   	push   %esi
+  8002fd:	53                   	push   %ebx
+  8002fe:	e8 39 ff ff ff       	call   80023c <umain>
+
+	// exit gracefully
+	exit();
+  800303:	e8 0a 00 00 00       	call   800312 <exit>
+}
+  800308:	83 c4 10             	add    $0x10,%esp
+  80030b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80030e:	5b                   	pop    %ebx
+  80030f:	5e                   	pop    %esi
+  800310:	5d                   	pop    %ebp
+  800311:	c3                   	ret
+
+00800312 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800318:	e8 8d 12 00 00       	call   8015aa <close_all>
+	sys_env_destroy(0);
+  80031d:	83 ec 0c             	sub    $0xc,%esp
+  800320:	6a 00                	push   $0x0
+  800322:	e8 5b 0a 00 00       	call   800d82 <sys_env_destroy>
+}
+  800327:	83 c4 10             	add    $0x10,%esp
+  80032a:	c9                   	leave
+  80032b:	c3                   	ret
+
+0080032c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	56                   	push   %esi
+  800330:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800331:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800334:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80033a:	e8 84 0a 00 00       	call   800dc3 <sys_getenvid>
+  80033f:	83 ec 0c             	sub    $0xc,%esp
+  800342:	ff 75 0c             	push   0xc(%ebp)
+  800345:	ff 75 08             	push   0x8(%ebp)
+  800348:	56                   	push   %esi
+  800349:	50                   	push   %eax
+  80034a:	68 f8 2b 80 00       	push   $0x802bf8
+  80034f:	e8 b3 00 00 00       	call   800407 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800354:	83 c4 18             	add    $0x18,%esp
+  800357:	53                   	push   %ebx
+  800358:	ff 75 10             	push   0x10(%ebp)
+  80035b:	e8 56 00 00 00       	call   8003b6 <vcprintf>
+	cprintf("\n");
+  800360:	c7 04 24 c7 2b 80 00 	movl   $0x802bc7,(%esp)
+  800367:	e8 9b 00 00 00       	call   800407 <cprintf>
+  80036c:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80036f:	cc                   	int3
+	while (1)
+  800370:	eb fd                	jmp    80036f <_panic+0x43>
+
+00800372 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800372:	55                   	push   %ebp
+  800373:	89 e5                	mov    %esp,%ebp
+  800375:	53                   	push   %ebx
+  800376:	83 ec 04             	sub    $0x4,%esp
+  800379:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80037c:	8b 13                	mov    (%ebx),%edx
+  80037e:	8d 42 01             	lea    0x1(%edx),%eax
+  800381:	89 03                	mov    %eax,(%ebx)
+  800383:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800386:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80038a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80038f:	74 09                	je     80039a <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800391:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800398:	c9                   	leave
+  800399:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80039a:	83 ec 08             	sub    $0x8,%esp
+  80039d:	68 ff 00 00 00       	push   $0xff
+  8003a2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003a5:	50                   	push   %eax
+  8003a6:	e8 7a 09 00 00       	call   800d25 <sys_cputs>
+		b->idx = 0;
+  8003ab:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003b1:	83 c4 10             	add    $0x10,%esp
+  8003b4:	eb db                	jmp    800391 <putch+0x1f>
+
+008003b6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003b6:	55                   	push   %ebp
+  8003b7:	89 e5                	mov    %esp,%ebp
+  8003b9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003bf:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003c6:	00 00 00 
+	b.cnt = 0;
+  8003c9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003d0:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003d3:	ff 75 0c             	push   0xc(%ebp)
+  8003d6:	ff 75 08             	push   0x8(%ebp)
+  8003d9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003df:	50                   	push   %eax
+  8003e0:	68 72 03 80 00       	push   $0x800372
+  8003e5:	e8 14 01 00 00       	call   8004fe <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003ea:	83 c4 08             	add    $0x8,%esp
+  8003ed:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003f3:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003f9:	50                   	push   %eax
+  8003fa:	e8 26 09 00 00       	call   800d25 <sys_cputs>
+
+	return b.cnt;
+}
+  8003ff:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800405:	c9                   	leave
+  800406:	c3                   	ret
+
+00800407 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80040d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800410:	50                   	push   %eax
+  800411:	ff 75 08             	push   0x8(%ebp)
+  800414:	e8 9d ff ff ff       	call   8003b6 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800419:	c9                   	leave
+  80041a:	c3                   	ret
+
+0080041b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80041b:	55                   	push   %ebp
+  80041c:	89 e5                	mov    %esp,%ebp
+  80041e:	57                   	push   %edi
+  80041f:	56                   	push   %esi
+  800420:	53                   	push   %ebx
+  800421:	83 ec 1c             	sub    $0x1c,%esp
+  800424:	89 c7                	mov    %eax,%edi
+  800426:	89 d6                	mov    %edx,%esi
+  800428:	8b 45 08             	mov    0x8(%ebp),%eax
+  80042b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80042e:	89 d1                	mov    %edx,%ecx
+  800430:	89 c2                	mov    %eax,%edx
+  800432:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800435:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800438:	8b 45 10             	mov    0x10(%ebp),%eax
+  80043b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80043e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800441:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800448:	39 c2                	cmp    %eax,%edx
+  80044a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80044d:	72 3e                	jb     80048d <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80044f:	83 ec 0c             	sub    $0xc,%esp
+  800452:	ff 75 18             	push   0x18(%ebp)
+  800455:	83 eb 01             	sub    $0x1,%ebx
+  800458:	53                   	push   %ebx
+  800459:	50                   	push   %eax
+  80045a:	83 ec 08             	sub    $0x8,%esp
+  80045d:	ff 75 e4             	push   -0x1c(%ebp)
+  800460:	ff 75 e0             	push   -0x20(%ebp)
+  800463:	ff 75 dc             	push   -0x24(%ebp)
+  800466:	ff 75 d8             	push   -0x28(%ebp)
+  800469:	e8 82 23 00 00       	call   8027f0 <__udivdi3>
+  80046e:	83 c4 18             	add    $0x18,%esp
+  800471:	52                   	push   %edx
+  800472:	50                   	push   %eax
+  800473:	89 f2                	mov    %esi,%edx
+  800475:	89 f8                	mov    %edi,%eax
+  800477:	e8 9f ff ff ff       	call   80041b <printnum>
+  80047c:	83 c4 20             	add    $0x20,%esp
+  80047f:	eb 13                	jmp    800494 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800481:	83 ec 08             	sub    $0x8,%esp
+  800484:	56                   	push   %esi
+  800485:	ff 75 18             	push   0x18(%ebp)
+  800488:	ff d7                	call   *%edi
+  80048a:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80048d:	83 eb 01             	sub    $0x1,%ebx
+  800490:	85 db                	test   %ebx,%ebx
+  800492:	7f ed                	jg     800481 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800494:	83 ec 08             	sub    $0x8,%esp
+  800497:	56                   	push   %esi
+  800498:	83 ec 04             	sub    $0x4,%esp
+  80049b:	ff 75 e4             	push   -0x1c(%ebp)
+  80049e:	ff 75 e0             	push   -0x20(%ebp)
+  8004a1:	ff 75 dc             	push   -0x24(%ebp)
+  8004a4:	ff 75 d8             	push   -0x28(%ebp)
+  8004a7:	e8 04 24 00 00       	call   8028b0 <__umoddi3>
+  8004ac:	83 c4 14             	add    $0x14,%esp
+  8004af:	0f be 80 1b 2c 80 00 	movsbl 0x802c1b(%eax),%eax
+  8004b6:	50                   	push   %eax
+  8004b7:	ff d7                	call   *%edi
+}
+  8004b9:	83 c4 10             	add    $0x10,%esp
+  8004bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004bf:	5b                   	pop    %ebx
+  8004c0:	5e                   	pop    %esi
+  8004c1:	5f                   	pop    %edi
+  8004c2:	5d                   	pop    %ebp
+  8004c3:	c3                   	ret
+
+008004c4 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004c4:	55                   	push   %ebp
+  8004c5:	89 e5                	mov    %esp,%ebp
+  8004c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004ca:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004ce:	8b 10                	mov    (%eax),%edx
+  8004d0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004d3:	73 0a                	jae    8004df <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004d5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004d8:	89 08                	mov    %ecx,(%eax)
+  8004da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004dd:	88 02                	mov    %al,(%edx)
+}
+  8004df:	5d                   	pop    %ebp
+  8004e0:	c3                   	ret
+
+008004e1 <printfmt>:
+{
+  8004e1:	55                   	push   %ebp
+  8004e2:	89 e5                	mov    %esp,%ebp
+  8004e4:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004e7:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004ea:	50                   	push   %eax
+  8004eb:	ff 75 10             	push   0x10(%ebp)
+  8004ee:	ff 75 0c             	push   0xc(%ebp)
+  8004f1:	ff 75 08             	push   0x8(%ebp)
+  8004f4:	e8 05 00 00 00       	call   8004fe <vprintfmt>
+}
+  8004f9:	83 c4 10             	add    $0x10,%esp
+  8004fc:	c9                   	leave
+  8004fd:	c3                   	ret
+
+008004fe <vprintfmt>:
+{
+  8004fe:	55                   	push   %ebp
+  8004ff:	89 e5                	mov    %esp,%ebp
+  800501:	57                   	push   %edi
+  800502:	56                   	push   %esi
+  800503:	53                   	push   %ebx
+  800504:	83 ec 2c             	sub    $0x2c,%esp
+  800507:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80050d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800510:	eb 0a                	jmp    80051c <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800512:	83 ec 08             	sub    $0x8,%esp
+  800515:	53                   	push   %ebx
+  800516:	50                   	push   %eax
+  800517:	ff d6                	call   *%esi
+  800519:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80051c:	83 c7 01             	add    $0x1,%edi
+  80051f:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800523:	83 f8 25             	cmp    $0x25,%eax
+  800526:	74 0c                	je     800534 <vprintfmt+0x36>
+			if (ch == '\0')
+  800528:	85 c0                	test   %eax,%eax
+  80052a:	75 e6                	jne    800512 <vprintfmt+0x14>
+}
+  80052c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80052f:	5b                   	pop    %ebx
+  800530:	5e                   	pop    %esi
+  800531:	5f                   	pop    %edi
+  800532:	5d                   	pop    %ebp
+  800533:	c3                   	ret
+		padc = ' ';
+  800534:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800538:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80053f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800546:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80054d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800552:	8d 47 01             	lea    0x1(%edi),%eax
+  800555:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800558:	0f b6 17             	movzbl (%edi),%edx
+  80055b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80055e:	3c 55                	cmp    $0x55,%al
+  800560:	0f 87 cf 03 00 00    	ja     800935 <vprintfmt+0x437>
+  800566:	0f b6 c0             	movzbl %al,%eax
+  800569:	ff 24 85 60 2d 80 00 	jmp    *0x802d60(,%eax,4)
+  800570:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800573:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800577:	eb d9                	jmp    800552 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800579:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80057c:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800580:	eb d0                	jmp    800552 <vprintfmt+0x54>
+  800582:	0f b6 d2             	movzbl %dl,%edx
+  800585:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800588:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800590:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800593:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800597:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80059a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80059d:	83 f9 09             	cmp    $0x9,%ecx
+  8005a0:	77 55                	ja     8005f7 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005a2:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005a5:	eb e9                	jmp    800590 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005aa:	8b 00                	mov    (%eax),%eax
+  8005ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b5:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005bb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005bf:	79 91                	jns    800552 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005c1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005ce:	eb 82                	jmp    800552 <vprintfmt+0x54>
+			if (width < 0)
+  8005d0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005d3:	85 d2                	test   %edx,%edx
+  8005d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005da:	0f 49 c2             	cmovns %edx,%eax
+  8005dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005e3:	e9 6a ff ff ff       	jmp    800552 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005eb:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005f2:	e9 5b ff ff ff       	jmp    800552 <vprintfmt+0x54>
+  8005f7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005fa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005fd:	eb bc                	jmp    8005bb <vprintfmt+0xbd>
+			lflag++;
+  8005ff:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800602:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800605:	e9 48 ff ff ff       	jmp    800552 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	8d 78 04             	lea    0x4(%eax),%edi
+  800610:	83 ec 08             	sub    $0x8,%esp
+  800613:	53                   	push   %ebx
+  800614:	ff 30                	push   (%eax)
+  800616:	ff d6                	call   *%esi
+			break;
+  800618:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80061b:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80061e:	e9 b1 02 00 00       	jmp    8008d4 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800623:	8b 45 14             	mov    0x14(%ebp),%eax
+  800626:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800629:	8b 10                	mov    (%eax),%edx
+  80062b:	89 d0                	mov    %edx,%eax
+  80062d:	f7 d8                	neg    %eax
+  80062f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800632:	83 f8 0f             	cmp    $0xf,%eax
+  800635:	7f 23                	jg     80065a <vprintfmt+0x15c>
+  800637:	8b 14 85 c0 2e 80 00 	mov    0x802ec0(,%eax,4),%edx
+  80063e:	85 d2                	test   %edx,%edx
+  800640:	74 18                	je     80065a <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800642:	52                   	push   %edx
+  800643:	68 f5 2f 80 00       	push   $0x802ff5
+  800648:	53                   	push   %ebx
+  800649:	56                   	push   %esi
+  80064a:	e8 92 fe ff ff       	call   8004e1 <printfmt>
+  80064f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800652:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800655:	e9 7a 02 00 00       	jmp    8008d4 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80065a:	50                   	push   %eax
+  80065b:	68 33 2c 80 00       	push   $0x802c33
+  800660:	53                   	push   %ebx
+  800661:	56                   	push   %esi
+  800662:	e8 7a fe ff ff       	call   8004e1 <printfmt>
+  800667:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80066a:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80066d:	e9 62 02 00 00       	jmp    8008d4 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800672:	8b 45 14             	mov    0x14(%ebp),%eax
+  800675:	83 c0 04             	add    $0x4,%eax
+  800678:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800680:	85 c9                	test   %ecx,%ecx
+  800682:	b8 2c 2c 80 00       	mov    $0x802c2c,%eax
+  800687:	0f 45 c1             	cmovne %ecx,%eax
+  80068a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80068d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800691:	7e 06                	jle    800699 <vprintfmt+0x19b>
+  800693:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800697:	75 0b                	jne    8006a4 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800699:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80069c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80069f:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006a2:	eb 5c                	jmp    800700 <vprintfmt+0x202>
+  8006a4:	83 ec 08             	sub    $0x8,%esp
+  8006a7:	ff 75 d0             	push   -0x30(%ebp)
+  8006aa:	ff 75 cc             	push   -0x34(%ebp)
+  8006ad:	e8 20 03 00 00       	call   8009d2 <strnlen>
+  8006b2:	89 c2                	mov    %eax,%edx
+  8006b4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006b7:	29 d0                	sub    %edx,%eax
+  8006b9:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006bc:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006c3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006c6:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006c8:	eb 0e                	jmp    8006d8 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8006ca:	83 ec 08             	sub    $0x8,%esp
+  8006cd:	53                   	push   %ebx
+  8006ce:	57                   	push   %edi
+  8006cf:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d2:	83 ee 01             	sub    $0x1,%esi
+  8006d5:	83 c4 10             	add    $0x10,%esp
+  8006d8:	85 f6                	test   %esi,%esi
+  8006da:	7f ee                	jg     8006ca <vprintfmt+0x1cc>
+  8006dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006df:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006e2:	85 c0                	test   %eax,%eax
+  8006e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e9:	0f 49 d0             	cmovns %eax,%edx
+  8006ec:	29 d0                	sub    %edx,%eax
+  8006ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006f1:	eb a6                	jmp    800699 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8006f3:	83 ec 08             	sub    $0x8,%esp
+  8006f6:	53                   	push   %ebx
+  8006f7:	52                   	push   %edx
+  8006f8:	ff 55 08             	call   *0x8(%ebp)
+  8006fb:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006fe:	89 f1                	mov    %esi,%ecx
+  800700:	8d 71 01             	lea    0x1(%ecx),%esi
+  800703:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800707:	0f be d0             	movsbl %al,%edx
+  80070a:	85 d2                	test   %edx,%edx
+  80070c:	74 28                	je     800736 <vprintfmt+0x238>
+  80070e:	85 ff                	test   %edi,%edi
+  800710:	78 05                	js     800717 <vprintfmt+0x219>
+  800712:	83 ef 01             	sub    $0x1,%edi
+  800715:	78 30                	js     800747 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800717:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80071b:	74 d6                	je     8006f3 <vprintfmt+0x1f5>
+  80071d:	0f be c0             	movsbl %al,%eax
+  800720:	83 e8 20             	sub    $0x20,%eax
+  800723:	83 f8 5e             	cmp    $0x5e,%eax
+  800726:	76 cb                	jbe    8006f3 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800728:	83 ec 08             	sub    $0x8,%esp
+  80072b:	53                   	push   %ebx
+  80072c:	6a 3f                	push   $0x3f
+  80072e:	ff 55 08             	call   *0x8(%ebp)
+  800731:	83 c4 10             	add    $0x10,%esp
+  800734:	eb c8                	jmp    8006fe <vprintfmt+0x200>
+  800736:	8b 75 08             	mov    0x8(%ebp),%esi
+  800739:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80073c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80073f:	01 d0                	add    %edx,%eax
+  800741:	29 c8                	sub    %ecx,%eax
+  800743:	89 c7                	mov    %eax,%edi
+  800745:	eb 13                	jmp    80075a <vprintfmt+0x25c>
+  800747:	8b 75 08             	mov    0x8(%ebp),%esi
+  80074a:	eb ed                	jmp    800739 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80074c:	83 ec 08             	sub    $0x8,%esp
+  80074f:	53                   	push   %ebx
+  800750:	6a 20                	push   $0x20
+  800752:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800754:	83 ef 01             	sub    $0x1,%edi
+  800757:	83 c4 10             	add    $0x10,%esp
+  80075a:	85 ff                	test   %edi,%edi
+  80075c:	7f ee                	jg     80074c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80075e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800761:	89 45 14             	mov    %eax,0x14(%ebp)
+  800764:	e9 6b 01 00 00       	jmp    8008d4 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800769:	83 f9 01             	cmp    $0x1,%ecx
+  80076c:	7f 1f                	jg     80078d <vprintfmt+0x28f>
+	else if (lflag)
+  80076e:	85 c9                	test   %ecx,%ecx
+  800770:	74 67                	je     8007d9 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800772:	8b 45 14             	mov    0x14(%ebp),%eax
+  800775:	8b 00                	mov    (%eax),%eax
+  800777:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80077a:	89 c1                	mov    %eax,%ecx
+  80077c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80077f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800782:	8b 45 14             	mov    0x14(%ebp),%eax
+  800785:	8d 40 04             	lea    0x4(%eax),%eax
+  800788:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078b:	eb 17                	jmp    8007a4 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80078d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800790:	8b 50 04             	mov    0x4(%eax),%edx
+  800793:	8b 00                	mov    (%eax),%eax
+  800795:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800798:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80079b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079e:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007a4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007a7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007aa:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007af:	85 c9                	test   %ecx,%ecx
+  8007b1:	0f 89 03 01 00 00    	jns    8008ba <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8007b7:	83 ec 08             	sub    $0x8,%esp
+  8007ba:	53                   	push   %ebx
+  8007bb:	6a 2d                	push   $0x2d
+  8007bd:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007bf:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007c2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007c5:	f7 da                	neg    %edx
+  8007c7:	83 d1 00             	adc    $0x0,%ecx
+  8007ca:	f7 d9                	neg    %ecx
+  8007cc:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007cf:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007d4:	e9 e1 00 00 00       	jmp    8008ba <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8007d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007dc:	8b 00                	mov    (%eax),%eax
+  8007de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007e1:	89 c1                	mov    %eax,%ecx
+  8007e3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007e6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f2:	eb b0                	jmp    8007a4 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8007f4:	83 f9 01             	cmp    $0x1,%ecx
+  8007f7:	7f 1e                	jg     800817 <vprintfmt+0x319>
+	else if (lflag)
+  8007f9:	85 c9                	test   %ecx,%ecx
+  8007fb:	74 32                	je     80082f <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8007fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800800:	8b 10                	mov    (%eax),%edx
+  800802:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800807:	8d 40 04             	lea    0x4(%eax),%eax
+  80080a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80080d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800812:	e9 a3 00 00 00       	jmp    8008ba <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800817:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081a:	8b 10                	mov    (%eax),%edx
+  80081c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80081f:	8d 40 08             	lea    0x8(%eax),%eax
+  800822:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800825:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80082a:	e9 8b 00 00 00       	jmp    8008ba <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80082f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800832:	8b 10                	mov    (%eax),%edx
+  800834:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800839:	8d 40 04             	lea    0x4(%eax),%eax
+  80083c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80083f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800844:	eb 74                	jmp    8008ba <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800846:	83 f9 01             	cmp    $0x1,%ecx
+  800849:	7f 1b                	jg     800866 <vprintfmt+0x368>
+	else if (lflag)
+  80084b:	85 c9                	test   %ecx,%ecx
+  80084d:	74 2c                	je     80087b <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80084f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800852:	8b 10                	mov    (%eax),%edx
+  800854:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800859:	8d 40 04             	lea    0x4(%eax),%eax
+  80085c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80085f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800864:	eb 54                	jmp    8008ba <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800866:	8b 45 14             	mov    0x14(%ebp),%eax
+  800869:	8b 10                	mov    (%eax),%edx
+  80086b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80086e:	8d 40 08             	lea    0x8(%eax),%eax
+  800871:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800874:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800879:	eb 3f                	jmp    8008ba <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80087b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087e:	8b 10                	mov    (%eax),%edx
+  800880:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800885:	8d 40 04             	lea    0x4(%eax),%eax
+  800888:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80088b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800890:	eb 28                	jmp    8008ba <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800892:	83 ec 08             	sub    $0x8,%esp
+  800895:	53                   	push   %ebx
+  800896:	6a 30                	push   $0x30
+  800898:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80089a:	83 c4 08             	add    $0x8,%esp
+  80089d:	53                   	push   %ebx
+  80089e:	6a 78                	push   $0x78
+  8008a0:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a5:	8b 10                	mov    (%eax),%edx
+  8008a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008ac:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008af:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008b5:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8008ba:	83 ec 0c             	sub    $0xc,%esp
+  8008bd:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008c1:	50                   	push   %eax
+  8008c2:	ff 75 e0             	push   -0x20(%ebp)
+  8008c5:	57                   	push   %edi
+  8008c6:	51                   	push   %ecx
+  8008c7:	52                   	push   %edx
+  8008c8:	89 da                	mov    %ebx,%edx
+  8008ca:	89 f0                	mov    %esi,%eax
+  8008cc:	e8 4a fb ff ff       	call   80041b <printnum>
+			break;
+  8008d1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8008d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008d7:	e9 40 fc ff ff       	jmp    80051c <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8008dc:	83 f9 01             	cmp    $0x1,%ecx
+  8008df:	7f 1b                	jg     8008fc <vprintfmt+0x3fe>
+	else if (lflag)
+  8008e1:	85 c9                	test   %ecx,%ecx
+  8008e3:	74 2c                	je     800911 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8008e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e8:	8b 10                	mov    (%eax),%edx
+  8008ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008f5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8008fa:	eb be                	jmp    8008ba <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ff:	8b 10                	mov    (%eax),%edx
+  800901:	8b 48 04             	mov    0x4(%eax),%ecx
+  800904:	8d 40 08             	lea    0x8(%eax),%eax
+  800907:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80090a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80090f:	eb a9                	jmp    8008ba <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800911:	8b 45 14             	mov    0x14(%ebp),%eax
+  800914:	8b 10                	mov    (%eax),%edx
+  800916:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80091b:	8d 40 04             	lea    0x4(%eax),%eax
+  80091e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800921:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800926:	eb 92                	jmp    8008ba <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800928:	83 ec 08             	sub    $0x8,%esp
+  80092b:	53                   	push   %ebx
+  80092c:	6a 25                	push   $0x25
+  80092e:	ff d6                	call   *%esi
+			break;
+  800930:	83 c4 10             	add    $0x10,%esp
+  800933:	eb 9f                	jmp    8008d4 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800935:	83 ec 08             	sub    $0x8,%esp
+  800938:	53                   	push   %ebx
+  800939:	6a 25                	push   $0x25
+  80093b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80093d:	83 c4 10             	add    $0x10,%esp
+  800940:	89 f8                	mov    %edi,%eax
+  800942:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800946:	74 05                	je     80094d <vprintfmt+0x44f>
+  800948:	83 e8 01             	sub    $0x1,%eax
+  80094b:	eb f5                	jmp    800942 <vprintfmt+0x444>
+  80094d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800950:	eb 82                	jmp    8008d4 <vprintfmt+0x3d6>
+
+00800952 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800952:	55                   	push   %ebp
+  800953:	89 e5                	mov    %esp,%ebp
+  800955:	83 ec 18             	sub    $0x18,%esp
+  800958:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80095e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800961:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800965:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800968:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80096f:	85 c0                	test   %eax,%eax
+  800971:	74 26                	je     800999 <vsnprintf+0x47>
+  800973:	85 d2                	test   %edx,%edx
+  800975:	7e 22                	jle    800999 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800977:	ff 75 14             	push   0x14(%ebp)
+  80097a:	ff 75 10             	push   0x10(%ebp)
+  80097d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800980:	50                   	push   %eax
+  800981:	68 c4 04 80 00       	push   $0x8004c4
+  800986:	e8 73 fb ff ff       	call   8004fe <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80098b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80098e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800991:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800994:	83 c4 10             	add    $0x10,%esp
+}
+  800997:	c9                   	leave
+  800998:	c3                   	ret
+		return -E_INVAL;
+  800999:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80099e:	eb f7                	jmp    800997 <vsnprintf+0x45>
+
+008009a0 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009a0:	55                   	push   %ebp
+  8009a1:	89 e5                	mov    %esp,%ebp
+  8009a3:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009a6:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009a9:	50                   	push   %eax
+  8009aa:	ff 75 10             	push   0x10(%ebp)
+  8009ad:	ff 75 0c             	push   0xc(%ebp)
+  8009b0:	ff 75 08             	push   0x8(%ebp)
+  8009b3:	e8 9a ff ff ff       	call   800952 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009b8:	c9                   	leave
+  8009b9:	c3                   	ret
+
+008009ba <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009ba:	55                   	push   %ebp
+  8009bb:	89 e5                	mov    %esp,%ebp
+  8009bd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c5:	eb 03                	jmp    8009ca <strlen+0x10>
+		n++;
+  8009c7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009ca:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009ce:	75 f7                	jne    8009c7 <strlen+0xd>
+	return n;
+}
+  8009d0:	5d                   	pop    %ebp
+  8009d1:	c3                   	ret
+
+008009d2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009d2:	55                   	push   %ebp
+  8009d3:	89 e5                	mov    %esp,%ebp
+  8009d5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e0:	eb 03                	jmp    8009e5 <strnlen+0x13>
+		n++;
+  8009e2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009e5:	39 d0                	cmp    %edx,%eax
+  8009e7:	74 08                	je     8009f1 <strnlen+0x1f>
+  8009e9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009ed:	75 f3                	jne    8009e2 <strnlen+0x10>
+  8009ef:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009f1:	89 d0                	mov    %edx,%eax
+  8009f3:	5d                   	pop    %ebp
+  8009f4:	c3                   	ret
+
+008009f5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009f5:	55                   	push   %ebp
+  8009f6:	89 e5                	mov    %esp,%ebp
+  8009f8:	53                   	push   %ebx
+  8009f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a04:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a08:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a0b:	83 c0 01             	add    $0x1,%eax
+  800a0e:	84 d2                	test   %dl,%dl
+  800a10:	75 f2                	jne    800a04 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a12:	89 c8                	mov    %ecx,%eax
+  800a14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a17:	c9                   	leave
+  800a18:	c3                   	ret
+
+00800a19 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	53                   	push   %ebx
+  800a1d:	83 ec 10             	sub    $0x10,%esp
+  800a20:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a23:	53                   	push   %ebx
+  800a24:	e8 91 ff ff ff       	call   8009ba <strlen>
+  800a29:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a2c:	ff 75 0c             	push   0xc(%ebp)
+  800a2f:	01 d8                	add    %ebx,%eax
+  800a31:	50                   	push   %eax
+  800a32:	e8 be ff ff ff       	call   8009f5 <strcpy>
+	return dst;
+}
+  800a37:	89 d8                	mov    %ebx,%eax
+  800a39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a3c:	c9                   	leave
+  800a3d:	c3                   	ret
+
+00800a3e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a3e:	55                   	push   %ebp
+  800a3f:	89 e5                	mov    %esp,%ebp
+  800a41:	56                   	push   %esi
+  800a42:	53                   	push   %ebx
+  800a43:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a46:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a49:	89 f3                	mov    %esi,%ebx
+  800a4b:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a4e:	89 f0                	mov    %esi,%eax
+  800a50:	eb 0f                	jmp    800a61 <strncpy+0x23>
+		*dst++ = *src;
+  800a52:	83 c0 01             	add    $0x1,%eax
+  800a55:	0f b6 0a             	movzbl (%edx),%ecx
+  800a58:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a5b:	80 f9 01             	cmp    $0x1,%cl
+  800a5e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a61:	39 d8                	cmp    %ebx,%eax
+  800a63:	75 ed                	jne    800a52 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a65:	89 f0                	mov    %esi,%eax
+  800a67:	5b                   	pop    %ebx
+  800a68:	5e                   	pop    %esi
+  800a69:	5d                   	pop    %ebp
+  800a6a:	c3                   	ret
+
+00800a6b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a6b:	55                   	push   %ebp
+  800a6c:	89 e5                	mov    %esp,%ebp
+  800a6e:	56                   	push   %esi
+  800a6f:	53                   	push   %ebx
+  800a70:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a76:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a79:	89 f0                	mov    %esi,%eax
+  800a7b:	85 d2                	test   %edx,%edx
+  800a7d:	74 21                	je     800aa0 <strlcpy+0x35>
+  800a7f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a83:	89 f2                	mov    %esi,%edx
+  800a85:	eb 09                	jmp    800a90 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a87:	83 c1 01             	add    $0x1,%ecx
+  800a8a:	83 c2 01             	add    $0x1,%edx
+  800a8d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a90:	39 c2                	cmp    %eax,%edx
+  800a92:	74 09                	je     800a9d <strlcpy+0x32>
+  800a94:	0f b6 19             	movzbl (%ecx),%ebx
+  800a97:	84 db                	test   %bl,%bl
+  800a99:	75 ec                	jne    800a87 <strlcpy+0x1c>
+  800a9b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a9d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800aa0:	29 f0                	sub    %esi,%eax
+}
+  800aa2:	5b                   	pop    %ebx
+  800aa3:	5e                   	pop    %esi
+  800aa4:	5d                   	pop    %ebp
+  800aa5:	c3                   	ret
+
+00800aa6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800aa6:	55                   	push   %ebp
+  800aa7:	89 e5                	mov    %esp,%ebp
+  800aa9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aac:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800aaf:	eb 06                	jmp    800ab7 <strcmp+0x11>
+		p++, q++;
+  800ab1:	83 c1 01             	add    $0x1,%ecx
+  800ab4:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ab7:	0f b6 01             	movzbl (%ecx),%eax
+  800aba:	84 c0                	test   %al,%al
+  800abc:	74 04                	je     800ac2 <strcmp+0x1c>
+  800abe:	3a 02                	cmp    (%edx),%al
+  800ac0:	74 ef                	je     800ab1 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ac2:	0f b6 c0             	movzbl %al,%eax
+  800ac5:	0f b6 12             	movzbl (%edx),%edx
+  800ac8:	29 d0                	sub    %edx,%eax
+}
+  800aca:	5d                   	pop    %ebp
+  800acb:	c3                   	ret
+
+00800acc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	53                   	push   %ebx
+  800ad0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ad6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ad9:	eb 09                	jmp    800ae4 <strncmp+0x18>
+		n--, p++, q++;
+  800adb:	83 ea 01             	sub    $0x1,%edx
+  800ade:	83 c0 01             	add    $0x1,%eax
+  800ae1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ae4:	85 d2                	test   %edx,%edx
+  800ae6:	74 18                	je     800b00 <strncmp+0x34>
+  800ae8:	0f b6 18             	movzbl (%eax),%ebx
+  800aeb:	84 db                	test   %bl,%bl
+  800aed:	74 04                	je     800af3 <strncmp+0x27>
+  800aef:	3a 19                	cmp    (%ecx),%bl
+  800af1:	74 e8                	je     800adb <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800af3:	0f b6 00             	movzbl (%eax),%eax
+  800af6:	0f b6 11             	movzbl (%ecx),%edx
+  800af9:	29 d0                	sub    %edx,%eax
+}
+  800afb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800afe:	c9                   	leave
+  800aff:	c3                   	ret
+		return 0;
+  800b00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b05:	eb f4                	jmp    800afb <strncmp+0x2f>
+
+00800b07 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b07:	55                   	push   %ebp
+  800b08:	89 e5                	mov    %esp,%ebp
+  800b0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b11:	eb 03                	jmp    800b16 <strchr+0xf>
+  800b13:	83 c0 01             	add    $0x1,%eax
+  800b16:	0f b6 10             	movzbl (%eax),%edx
+  800b19:	84 d2                	test   %dl,%dl
+  800b1b:	74 06                	je     800b23 <strchr+0x1c>
+		if (*s == c)
+  800b1d:	38 ca                	cmp    %cl,%dl
+  800b1f:	75 f2                	jne    800b13 <strchr+0xc>
+  800b21:	eb 05                	jmp    800b28 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b23:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b28:	5d                   	pop    %ebp
+  800b29:	c3                   	ret
+
+00800b2a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b30:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b34:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b37:	38 ca                	cmp    %cl,%dl
+  800b39:	74 09                	je     800b44 <strfind+0x1a>
+  800b3b:	84 d2                	test   %dl,%dl
+  800b3d:	74 05                	je     800b44 <strfind+0x1a>
+	for (; *s; s++)
+  800b3f:	83 c0 01             	add    $0x1,%eax
+  800b42:	eb f0                	jmp    800b34 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b44:	5d                   	pop    %ebp
+  800b45:	c3                   	ret
+
+00800b46 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b46:	55                   	push   %ebp
+  800b47:	89 e5                	mov    %esp,%ebp
+  800b49:	57                   	push   %edi
+  800b4a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b4d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b50:	85 c9                	test   %ecx,%ecx
+  800b52:	74 20                	je     800b74 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b54:	89 f8                	mov    %edi,%eax
+  800b56:	09 c8                	or     %ecx,%eax
+  800b58:	a8 03                	test   $0x3,%al
+  800b5a:	75 12                	jne    800b6e <memset+0x28>
+		c &= 0xFF;
+  800b5c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b60:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b66:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b69:	fc                   	cld
+  800b6a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b6c:	eb 06                	jmp    800b74 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b71:	fc                   	cld
+  800b72:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b74:	89 f8                	mov    %edi,%eax
+  800b76:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b79:	c9                   	leave
+  800b7a:	c3                   	ret
+
+00800b7b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b7b:	55                   	push   %ebp
+  800b7c:	89 e5                	mov    %esp,%ebp
+  800b7e:	57                   	push   %edi
+  800b7f:	56                   	push   %esi
+  800b80:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b83:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b86:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b89:	39 c6                	cmp    %eax,%esi
+  800b8b:	73 32                	jae    800bbf <memmove+0x44>
+  800b8d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b90:	39 d0                	cmp    %edx,%eax
+  800b92:	73 2b                	jae    800bbf <memmove+0x44>
+		s += n;
+		d += n;
+  800b94:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b97:	89 d6                	mov    %edx,%esi
+  800b99:	09 fe                	or     %edi,%esi
+  800b9b:	09 ce                	or     %ecx,%esi
+  800b9d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ba3:	75 0e                	jne    800bb3 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ba5:	83 ef 04             	sub    $0x4,%edi
+  800ba8:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bab:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bae:	fd                   	std
+  800baf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bb1:	eb 09                	jmp    800bbc <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bb3:	83 ef 01             	sub    $0x1,%edi
+  800bb6:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bb9:	fd                   	std
+  800bba:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bbc:	fc                   	cld
+  800bbd:	eb 1a                	jmp    800bd9 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bbf:	89 f2                	mov    %esi,%edx
+  800bc1:	09 c2                	or     %eax,%edx
+  800bc3:	09 ca                	or     %ecx,%edx
+  800bc5:	f6 c2 03             	test   $0x3,%dl
+  800bc8:	75 0a                	jne    800bd4 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bca:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bcd:	89 c7                	mov    %eax,%edi
+  800bcf:	fc                   	cld
+  800bd0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bd2:	eb 05                	jmp    800bd9 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bd4:	89 c7                	mov    %eax,%edi
+  800bd6:	fc                   	cld
+  800bd7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bd9:	5e                   	pop    %esi
+  800bda:	5f                   	pop    %edi
+  800bdb:	5d                   	pop    %ebp
+  800bdc:	c3                   	ret
+
+00800bdd <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bdd:	55                   	push   %ebp
+  800bde:	89 e5                	mov    %esp,%ebp
+  800be0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800be3:	ff 75 10             	push   0x10(%ebp)
+  800be6:	ff 75 0c             	push   0xc(%ebp)
+  800be9:	ff 75 08             	push   0x8(%ebp)
+  800bec:	e8 8a ff ff ff       	call   800b7b <memmove>
+}
+  800bf1:	c9                   	leave
+  800bf2:	c3                   	ret
+
+00800bf3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bf3:	55                   	push   %ebp
+  800bf4:	89 e5                	mov    %esp,%ebp
+  800bf6:	56                   	push   %esi
+  800bf7:	53                   	push   %ebx
+  800bf8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bfb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bfe:	89 c6                	mov    %eax,%esi
+  800c00:	03 75 10             	add    0x10(%ebp),%esi
+  800c03:	eb 06                	jmp    800c0b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c05:	83 c0 01             	add    $0x1,%eax
+  800c08:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c0b:	39 f0                	cmp    %esi,%eax
+  800c0d:	74 14                	je     800c23 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c0f:	0f b6 08             	movzbl (%eax),%ecx
+  800c12:	0f b6 1a             	movzbl (%edx),%ebx
+  800c15:	38 d9                	cmp    %bl,%cl
+  800c17:	74 ec                	je     800c05 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c19:	0f b6 c1             	movzbl %cl,%eax
+  800c1c:	0f b6 db             	movzbl %bl,%ebx
+  800c1f:	29 d8                	sub    %ebx,%eax
+  800c21:	eb 05                	jmp    800c28 <memcmp+0x35>
+	}
+
+	return 0;
+  800c23:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c28:	5b                   	pop    %ebx
+  800c29:	5e                   	pop    %esi
+  800c2a:	5d                   	pop    %ebp
+  800c2b:	c3                   	ret
+
+00800c2c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c2c:	55                   	push   %ebp
+  800c2d:	89 e5                	mov    %esp,%ebp
+  800c2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c35:	89 c2                	mov    %eax,%edx
+  800c37:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c3a:	eb 03                	jmp    800c3f <memfind+0x13>
+  800c3c:	83 c0 01             	add    $0x1,%eax
+  800c3f:	39 d0                	cmp    %edx,%eax
+  800c41:	73 04                	jae    800c47 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c43:	38 08                	cmp    %cl,(%eax)
+  800c45:	75 f5                	jne    800c3c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c47:	5d                   	pop    %ebp
+  800c48:	c3                   	ret
+
+00800c49 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c49:	55                   	push   %ebp
+  800c4a:	89 e5                	mov    %esp,%ebp
+  800c4c:	57                   	push   %edi
+  800c4d:	56                   	push   %esi
+  800c4e:	53                   	push   %ebx
+  800c4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c52:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c55:	eb 03                	jmp    800c5a <strtol+0x11>
+		s++;
+  800c57:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c5a:	0f b6 02             	movzbl (%edx),%eax
+  800c5d:	3c 20                	cmp    $0x20,%al
+  800c5f:	74 f6                	je     800c57 <strtol+0xe>
+  800c61:	3c 09                	cmp    $0x9,%al
+  800c63:	74 f2                	je     800c57 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c65:	3c 2b                	cmp    $0x2b,%al
+  800c67:	74 2a                	je     800c93 <strtol+0x4a>
+	int neg = 0;
+  800c69:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c6e:	3c 2d                	cmp    $0x2d,%al
+  800c70:	74 2b                	je     800c9d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c72:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c78:	75 0f                	jne    800c89 <strtol+0x40>
+  800c7a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c7d:	74 28                	je     800ca7 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c7f:	85 db                	test   %ebx,%ebx
+  800c81:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c86:	0f 44 d8             	cmove  %eax,%ebx
+  800c89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c91:	eb 46                	jmp    800cd9 <strtol+0x90>
+		s++;
+  800c93:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c96:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c9b:	eb d5                	jmp    800c72 <strtol+0x29>
+		s++, neg = 1;
+  800c9d:	83 c2 01             	add    $0x1,%edx
+  800ca0:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ca5:	eb cb                	jmp    800c72 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ca7:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cab:	74 0e                	je     800cbb <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800cad:	85 db                	test   %ebx,%ebx
+  800caf:	75 d8                	jne    800c89 <strtol+0x40>
+		s++, base = 8;
+  800cb1:	83 c2 01             	add    $0x1,%edx
+  800cb4:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cb9:	eb ce                	jmp    800c89 <strtol+0x40>
+		s += 2, base = 16;
+  800cbb:	83 c2 02             	add    $0x2,%edx
+  800cbe:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cc3:	eb c4                	jmp    800c89 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cc5:	0f be c0             	movsbl %al,%eax
+  800cc8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ccb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cce:	7d 3a                	jge    800d0a <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800cd0:	83 c2 01             	add    $0x1,%edx
+  800cd3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cd7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800cd9:	0f b6 02             	movzbl (%edx),%eax
+  800cdc:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cdf:	89 f3                	mov    %esi,%ebx
+  800ce1:	80 fb 09             	cmp    $0x9,%bl
+  800ce4:	76 df                	jbe    800cc5 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ce6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ce9:	89 f3                	mov    %esi,%ebx
+  800ceb:	80 fb 19             	cmp    $0x19,%bl
+  800cee:	77 08                	ja     800cf8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800cf0:	0f be c0             	movsbl %al,%eax
+  800cf3:	83 e8 57             	sub    $0x57,%eax
+  800cf6:	eb d3                	jmp    800ccb <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cf8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cfb:	89 f3                	mov    %esi,%ebx
+  800cfd:	80 fb 19             	cmp    $0x19,%bl
+  800d00:	77 08                	ja     800d0a <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d02:	0f be c0             	movsbl %al,%eax
+  800d05:	83 e8 37             	sub    $0x37,%eax
+  800d08:	eb c1                	jmp    800ccb <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d0a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d0e:	74 05                	je     800d15 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d10:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d13:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d15:	89 c8                	mov    %ecx,%eax
+  800d17:	f7 d8                	neg    %eax
+  800d19:	85 ff                	test   %edi,%edi
+  800d1b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d1e:	89 c8                	mov    %ecx,%eax
+  800d20:	5b                   	pop    %ebx
+  800d21:	5e                   	pop    %esi
+  800d22:	5f                   	pop    %edi
+  800d23:	5d                   	pop    %ebp
+  800d24:	c3                   	ret
+
+00800d25 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	57                   	push   %edi
+  800d29:	56                   	push   %esi
+  800d2a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d36:	89 c3                	mov    %eax,%ebx
+  800d38:	89 c7                	mov    %eax,%edi
+  800d3a:	89 c6                	mov    %eax,%esi
+  800d3c:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d3e:	5b                   	pop    %ebx
+  800d3f:	5e                   	pop    %esi
+  800d40:	5f                   	pop    %edi
+  800d41:	5d                   	pop    %ebp
+  800d42:	c3                   	ret
+
+00800d43 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	57                   	push   %edi
+  800d47:	56                   	push   %esi
+  800d48:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d53:	89 d1                	mov    %edx,%ecx
+  800d55:	89 d3                	mov    %edx,%ebx
+  800d57:	89 d7                	mov    %edx,%edi
+  800d59:	89 d6                	mov    %edx,%esi
+  800d5b:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d5d:	5b                   	pop    %ebx
+  800d5e:	5e                   	pop    %esi
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+
+00800d62 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	57                   	push   %edi
+  800d66:	56                   	push   %esi
+  800d67:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d70:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d75:	89 cb                	mov    %ecx,%ebx
+  800d77:	89 cf                	mov    %ecx,%edi
+  800d79:	89 ce                	mov    %ecx,%esi
+  800d7b:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800d7d:	5b                   	pop    %ebx
+  800d7e:	5e                   	pop    %esi
+  800d7f:	5f                   	pop    %edi
+  800d80:	5d                   	pop    %ebp
+  800d81:	c3                   	ret
+
+00800d82 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d82:	55                   	push   %ebp
+  800d83:	89 e5                	mov    %esp,%ebp
+  800d85:	57                   	push   %edi
+  800d86:	56                   	push   %esi
+  800d87:	53                   	push   %ebx
+  800d88:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d93:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d98:	89 cb                	mov    %ecx,%ebx
+  800d9a:	89 cf                	mov    %ecx,%edi
+  800d9c:	89 ce                	mov    %ecx,%esi
+  800d9e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da0:	85 c0                	test   %eax,%eax
+  800da2:	7f 08                	jg     800dac <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800da4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da7:	5b                   	pop    %ebx
+  800da8:	5e                   	pop    %esi
+  800da9:	5f                   	pop    %edi
+  800daa:	5d                   	pop    %ebp
+  800dab:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dac:	83 ec 0c             	sub    $0xc,%esp
+  800daf:	50                   	push   %eax
+  800db0:	6a 03                	push   $0x3
+  800db2:	68 1f 2f 80 00       	push   $0x802f1f
+  800db7:	6a 23                	push   $0x23
+  800db9:	68 3c 2f 80 00       	push   $0x802f3c
+  800dbe:	e8 69 f5 ff ff       	call   80032c <_panic>
+
+00800dc3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dc3:	55                   	push   %ebp
+  800dc4:	89 e5                	mov    %esp,%ebp
+  800dc6:	57                   	push   %edi
+  800dc7:	56                   	push   %esi
+  800dc8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dce:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dd3:	89 d1                	mov    %edx,%ecx
+  800dd5:	89 d3                	mov    %edx,%ebx
+  800dd7:	89 d7                	mov    %edx,%edi
+  800dd9:	89 d6                	mov    %edx,%esi
+  800ddb:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ddd:	5b                   	pop    %ebx
+  800dde:	5e                   	pop    %esi
+  800ddf:	5f                   	pop    %edi
+  800de0:	5d                   	pop    %ebp
+  800de1:	c3                   	ret
+
+00800de2 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800de2:	55                   	push   %ebp
+  800de3:	89 e5                	mov    %esp,%ebp
+  800de5:	57                   	push   %edi
+  800de6:	56                   	push   %esi
+  800de7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800de8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ded:	b8 16 00 00 00       	mov    $0x16,%eax
+  800df2:	89 d1                	mov    %edx,%ecx
+  800df4:	89 d3                	mov    %edx,%ebx
+  800df6:	89 d7                	mov    %edx,%edi
+  800df8:	89 d6                	mov    %edx,%esi
+  800dfa:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dfc:	5b                   	pop    %ebx
+  800dfd:	5e                   	pop    %esi
+  800dfe:	5f                   	pop    %edi
+  800dff:	5d                   	pop    %ebp
+  800e00:	c3                   	ret
+
+00800e01 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	57                   	push   %edi
+  800e05:	56                   	push   %esi
+  800e06:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e07:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e11:	89 d1                	mov    %edx,%ecx
+  800e13:	89 d3                	mov    %edx,%ebx
+  800e15:	89 d7                	mov    %edx,%edi
+  800e17:	89 d6                	mov    %edx,%esi
+  800e19:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800e1b:	5b                   	pop    %ebx
+  800e1c:	5e                   	pop    %esi
+  800e1d:	5f                   	pop    %edi
+  800e1e:	5d                   	pop    %ebp
+  800e1f:	c3                   	ret
+
+00800e20 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800e20:	55                   	push   %ebp
+  800e21:	89 e5                	mov    %esp,%ebp
+  800e23:	57                   	push   %edi
+  800e24:	56                   	push   %esi
+  800e25:	53                   	push   %ebx
+  800e26:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e34:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e39:	89 df                	mov    %ebx,%edi
+  800e3b:	89 de                	mov    %ebx,%esi
+  800e3d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e3f:	85 c0                	test   %eax,%eax
+  800e41:	7f 08                	jg     800e4b <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800e43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e46:	5b                   	pop    %ebx
+  800e47:	5e                   	pop    %esi
+  800e48:	5f                   	pop    %edi
+  800e49:	5d                   	pop    %ebp
+  800e4a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e4b:	83 ec 0c             	sub    $0xc,%esp
+  800e4e:	50                   	push   %eax
+  800e4f:	6a 15                	push   $0x15
+  800e51:	68 1f 2f 80 00       	push   $0x802f1f
+  800e56:	6a 23                	push   $0x23
+  800e58:	68 3c 2f 80 00       	push   $0x802f3c
+  800e5d:	e8 ca f4 ff ff       	call   80032c <_panic>
+
+00800e62 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e62:	55                   	push   %ebp
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	57                   	push   %edi
+  800e66:	56                   	push   %esi
+  800e67:	53                   	push   %ebx
+  800e68:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e6b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e76:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e7e:	89 f7                	mov    %esi,%edi
+  800e80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e82:	85 c0                	test   %eax,%eax
+  800e84:	7f 08                	jg     800e8e <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e89:	5b                   	pop    %ebx
+  800e8a:	5e                   	pop    %esi
+  800e8b:	5f                   	pop    %edi
+  800e8c:	5d                   	pop    %ebp
+  800e8d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+  800e91:	50                   	push   %eax
+  800e92:	6a 05                	push   $0x5
+  800e94:	68 1f 2f 80 00       	push   $0x802f1f
+  800e99:	6a 23                	push   $0x23
+  800e9b:	68 3c 2f 80 00       	push   $0x802f3c
+  800ea0:	e8 87 f4 ff ff       	call   80032c <_panic>
+
+00800ea5 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800ea5:	55                   	push   %ebp
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	57                   	push   %edi
+  800ea9:	56                   	push   %esi
+  800eaa:	53                   	push   %ebx
+  800eab:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eae:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ebe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec1:	89 f7                	mov    %esi,%edi
+  800ec3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec5:	85 c0                	test   %eax,%eax
+  800ec7:	7f 08                	jg     800ed1 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ec9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5e                   	pop    %esi
+  800ece:	5f                   	pop    %edi
+  800ecf:	5d                   	pop    %ebp
+  800ed0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed1:	83 ec 0c             	sub    $0xc,%esp
+  800ed4:	50                   	push   %eax
+  800ed5:	6a 06                	push   $0x6
+  800ed7:	68 1f 2f 80 00       	push   $0x802f1f
+  800edc:	6a 23                	push   $0x23
+  800ede:	68 3c 2f 80 00       	push   $0x802f3c
+  800ee3:	e8 44 f4 ff ff       	call   80032c <_panic>
+
+00800ee8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ee8:	55                   	push   %ebp
+  800ee9:	89 e5                	mov    %esp,%ebp
+  800eeb:	57                   	push   %edi
+  800eec:	56                   	push   %esi
+  800eed:	53                   	push   %ebx
+  800eee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef7:	b8 07 00 00 00       	mov    $0x7,%eax
+  800efc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f02:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f05:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f07:	85 c0                	test   %eax,%eax
+  800f09:	7f 08                	jg     800f13 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0e:	5b                   	pop    %ebx
+  800f0f:	5e                   	pop    %esi
+  800f10:	5f                   	pop    %edi
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f13:	83 ec 0c             	sub    $0xc,%esp
+  800f16:	50                   	push   %eax
+  800f17:	6a 07                	push   $0x7
+  800f19:	68 1f 2f 80 00       	push   $0x802f1f
+  800f1e:	6a 23                	push   $0x23
+  800f20:	68 3c 2f 80 00       	push   $0x802f3c
+  800f25:	e8 02 f4 ff ff       	call   80032c <_panic>
+
+00800f2a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	57                   	push   %edi
+  800f2e:	56                   	push   %esi
+  800f2f:	53                   	push   %ebx
+  800f30:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f43:	89 df                	mov    %ebx,%edi
+  800f45:	89 de                	mov    %ebx,%esi
+  800f47:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f49:	85 c0                	test   %eax,%eax
+  800f4b:	7f 08                	jg     800f55 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f50:	5b                   	pop    %ebx
+  800f51:	5e                   	pop    %esi
+  800f52:	5f                   	pop    %edi
+  800f53:	5d                   	pop    %ebp
+  800f54:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f55:	83 ec 0c             	sub    $0xc,%esp
+  800f58:	50                   	push   %eax
+  800f59:	6a 08                	push   $0x8
+  800f5b:	68 1f 2f 80 00       	push   $0x802f1f
+  800f60:	6a 23                	push   $0x23
+  800f62:	68 3c 2f 80 00       	push   $0x802f3c
+  800f67:	e8 c0 f3 ff ff       	call   80032c <_panic>
+
+00800f6c <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	57                   	push   %edi
+  800f70:	56                   	push   %esi
+  800f71:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f78:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f85:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f88:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f8a:	5b                   	pop    %ebx
+  800f8b:	5e                   	pop    %esi
+  800f8c:	5f                   	pop    %edi
+  800f8d:	5d                   	pop    %ebp
+  800f8e:	c3                   	ret
+
+00800f8f <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f8f:	55                   	push   %ebp
+  800f90:	89 e5                	mov    %esp,%ebp
+  800f92:	57                   	push   %edi
+  800f93:	56                   	push   %esi
+  800f94:	53                   	push   %ebx
+  800f95:	8b 45 18             	mov    0x18(%ebp),%eax
+  800f98:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800f9b:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800fa0:	77 27                	ja     800fc9 <sys_page_map_range+0x3a>
+  800fa2:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800fa8:	77 1f                	ja     800fc9 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800faa:	c1 e0 0c             	shl    $0xc,%eax
+  800fad:	89 c6                	mov    %eax,%esi
+  800faf:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800fb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fbc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fbf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc2:	cd 30                	int    $0x30
+}
+  800fc4:	5b                   	pop    %ebx
+  800fc5:	5e                   	pop    %esi
+  800fc6:	5f                   	pop    %edi
+  800fc7:	5d                   	pop    %ebp
+  800fc8:	c3                   	ret
+		return -E_INVAL;
+  800fc9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fce:	eb f4                	jmp    800fc4 <sys_page_map_range+0x35>
+
+00800fd0 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	57                   	push   %edi
+  800fd4:	56                   	push   %esi
+  800fd5:	53                   	push   %ebx
+  800fd6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fe4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff1:	85 c0                	test   %eax,%eax
+  800ff3:	7f 08                	jg     800ffd <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800ff5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff8:	5b                   	pop    %ebx
+  800ff9:	5e                   	pop    %esi
+  800ffa:	5f                   	pop    %edi
+  800ffb:	5d                   	pop    %ebp
+  800ffc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffd:	83 ec 0c             	sub    $0xc,%esp
+  801000:	50                   	push   %eax
+  801001:	6a 0c                	push   $0xc
+  801003:	68 1f 2f 80 00       	push   $0x802f1f
+  801008:	6a 23                	push   $0x23
+  80100a:	68 3c 2f 80 00       	push   $0x802f3c
+  80100f:	e8 18 f3 ff ff       	call   80032c <_panic>
+
+00801014 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	57                   	push   %edi
+  801018:	56                   	push   %esi
+  801019:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101a:	be 00 00 00 00       	mov    $0x0,%esi
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801025:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80102a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80102d:	89 f7                	mov    %esi,%edi
+  80102f:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  801031:	5b                   	pop    %ebx
+  801032:	5e                   	pop    %esi
+  801033:	5f                   	pop    %edi
+  801034:	5d                   	pop    %ebp
+  801035:	c3                   	ret
+
+00801036 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801036:	55                   	push   %ebp
+  801037:	89 e5                	mov    %esp,%ebp
+  801039:	57                   	push   %edi
+  80103a:	56                   	push   %esi
+  80103b:	53                   	push   %ebx
+  80103c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80103f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801044:	8b 55 08             	mov    0x8(%ebp),%edx
+  801047:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80104f:	89 df                	mov    %ebx,%edi
+  801051:	89 de                	mov    %ebx,%esi
+  801053:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801055:	85 c0                	test   %eax,%eax
+  801057:	7f 08                	jg     801061 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801059:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105c:	5b                   	pop    %ebx
+  80105d:	5e                   	pop    %esi
+  80105e:	5f                   	pop    %edi
+  80105f:	5d                   	pop    %ebp
+  801060:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801061:	83 ec 0c             	sub    $0xc,%esp
+  801064:	50                   	push   %eax
+  801065:	6a 0f                	push   $0xf
+  801067:	68 1f 2f 80 00       	push   $0x802f1f
+  80106c:	6a 23                	push   $0x23
+  80106e:	68 3c 2f 80 00       	push   $0x802f3c
+  801073:	e8 b4 f2 ff ff       	call   80032c <_panic>
+
+00801078 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  801078:	55                   	push   %ebp
+  801079:	89 e5                	mov    %esp,%ebp
+  80107b:	57                   	push   %edi
+  80107c:	56                   	push   %esi
+  80107d:	53                   	push   %ebx
+  80107e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801081:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801086:	8b 55 08             	mov    0x8(%ebp),%edx
+  801089:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801091:	89 df                	mov    %ebx,%edi
+  801093:	89 de                	mov    %ebx,%esi
+  801095:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801097:	85 c0                	test   %eax,%eax
+  801099:	7f 08                	jg     8010a3 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  80109b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109e:	5b                   	pop    %ebx
+  80109f:	5e                   	pop    %esi
+  8010a0:	5f                   	pop    %edi
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a3:	83 ec 0c             	sub    $0xc,%esp
+  8010a6:	50                   	push   %eax
+  8010a7:	6a 10                	push   $0x10
+  8010a9:	68 1f 2f 80 00       	push   $0x802f1f
+  8010ae:	6a 23                	push   $0x23
+  8010b0:	68 3c 2f 80 00       	push   $0x802f3c
+  8010b5:	e8 72 f2 ff ff       	call   80032c <_panic>
+
+008010ba <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	57                   	push   %edi
+  8010be:	56                   	push   %esi
+  8010bf:	53                   	push   %ebx
+  8010c0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ce:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010d3:	89 df                	mov    %ebx,%edi
+  8010d5:	89 de                	mov    %ebx,%esi
+  8010d7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d9:	85 c0                	test   %eax,%eax
+  8010db:	7f 08                	jg     8010e5 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  8010dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e0:	5b                   	pop    %ebx
+  8010e1:	5e                   	pop    %esi
+  8010e2:	5f                   	pop    %edi
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+  8010e8:	50                   	push   %eax
+  8010e9:	6a 11                	push   $0x11
+  8010eb:	68 1f 2f 80 00       	push   $0x802f1f
+  8010f0:	6a 23                	push   $0x23
+  8010f2:	68 3c 2f 80 00       	push   $0x802f3c
+  8010f7:	e8 30 f2 ff ff       	call   80032c <_panic>
+
+008010fc <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  8010fc:	55                   	push   %ebp
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	57                   	push   %edi
+  801100:	56                   	push   %esi
+  801101:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801102:	ba 00 00 00 00       	mov    $0x0,%edx
+  801107:	b8 12 00 00 00       	mov    $0x12,%eax
+  80110c:	89 d1                	mov    %edx,%ecx
+  80110e:	89 d3                	mov    %edx,%ebx
+  801110:	89 d7                	mov    %edx,%edi
+  801112:	89 d6                	mov    %edx,%esi
+  801114:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  801116:	5b                   	pop    %ebx
+  801117:	5e                   	pop    %esi
+  801118:	5f                   	pop    %edi
+  801119:	5d                   	pop    %ebp
+  80111a:	c3                   	ret
+
+0080111b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80111b:	55                   	push   %ebp
+  80111c:	89 e5                	mov    %esp,%ebp
+  80111e:	57                   	push   %edi
+  80111f:	56                   	push   %esi
+  801120:	53                   	push   %ebx
+  801121:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801124:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801129:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801134:	89 df                	mov    %ebx,%edi
+  801136:	89 de                	mov    %ebx,%esi
+  801138:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80113a:	85 c0                	test   %eax,%eax
+  80113c:	7f 08                	jg     801146 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80113e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801141:	5b                   	pop    %ebx
+  801142:	5e                   	pop    %esi
+  801143:	5f                   	pop    %edi
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801146:	83 ec 0c             	sub    $0xc,%esp
+  801149:	50                   	push   %eax
+  80114a:	6a 13                	push   $0x13
+  80114c:	68 1f 2f 80 00       	push   $0x802f1f
+  801151:	6a 23                	push   $0x23
+  801153:	68 3c 2f 80 00       	push   $0x802f3c
+  801158:	e8 cf f1 ff ff       	call   80032c <_panic>
+
+0080115d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	57                   	push   %edi
+  801161:	56                   	push   %esi
+  801162:	53                   	push   %ebx
+  801163:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801166:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801171:	b8 14 00 00 00       	mov    $0x14,%eax
+  801176:	89 df                	mov    %ebx,%edi
+  801178:	89 de                	mov    %ebx,%esi
+  80117a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80117c:	85 c0                	test   %eax,%eax
+  80117e:	7f 08                	jg     801188 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801180:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801183:	5b                   	pop    %ebx
+  801184:	5e                   	pop    %esi
+  801185:	5f                   	pop    %edi
+  801186:	5d                   	pop    %ebp
+  801187:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801188:	83 ec 0c             	sub    $0xc,%esp
+  80118b:	50                   	push   %eax
+  80118c:	6a 14                	push   $0x14
+  80118e:	68 1f 2f 80 00       	push   $0x802f1f
+  801193:	6a 23                	push   $0x23
+  801195:	68 3c 2f 80 00       	push   $0x802f3c
+  80119a:	e8 8d f1 ff ff       	call   80032c <_panic>
+
+0080119f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	57                   	push   %edi
+  8011a3:	56                   	push   %esi
+  8011a4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011bb:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011bd:	5b                   	pop    %ebx
+  8011be:	5e                   	pop    %esi
+  8011bf:	5f                   	pop    %edi
+  8011c0:	5d                   	pop    %ebp
+  8011c1:	c3                   	ret
+
+008011c2 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011c2:	55                   	push   %ebp
+  8011c3:	89 e5                	mov    %esp,%ebp
+  8011c5:	57                   	push   %edi
+  8011c6:	56                   	push   %esi
+  8011c7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ce:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011db:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011de:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011e0:	5b                   	pop    %ebx
+  8011e1:	5e                   	pop    %esi
+  8011e2:	5f                   	pop    %edi
+  8011e3:	5d                   	pop    %ebp
+  8011e4:	c3                   	ret
+
+008011e5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011e5:	55                   	push   %ebp
+  8011e6:	89 e5                	mov    %esp,%ebp
+  8011e8:	57                   	push   %edi
+  8011e9:	56                   	push   %esi
+  8011ea:	53                   	push   %ebx
+  8011eb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f6:	b8 19 00 00 00       	mov    $0x19,%eax
+  8011fb:	89 cb                	mov    %ecx,%ebx
+  8011fd:	89 cf                	mov    %ecx,%edi
+  8011ff:	89 ce                	mov    %ecx,%esi
+  801201:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801203:	85 c0                	test   %eax,%eax
+  801205:	7f 08                	jg     80120f <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801207:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120a:	5b                   	pop    %ebx
+  80120b:	5e                   	pop    %esi
+  80120c:	5f                   	pop    %edi
+  80120d:	5d                   	pop    %ebp
+  80120e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80120f:	83 ec 0c             	sub    $0xc,%esp
+  801212:	50                   	push   %eax
+  801213:	6a 19                	push   $0x19
+  801215:	68 1f 2f 80 00       	push   $0x802f1f
+  80121a:	6a 23                	push   $0x23
+  80121c:	68 3c 2f 80 00       	push   $0x802f3c
+  801221:	e8 06 f1 ff ff       	call   80032c <_panic>
+
+00801226 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801226:	55                   	push   %ebp
+  801227:	89 e5                	mov    %esp,%ebp
+  801229:	57                   	push   %edi
+  80122a:	56                   	push   %esi
+  80122b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80122c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801231:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801236:	89 d1                	mov    %edx,%ecx
+  801238:	89 d3                	mov    %edx,%ebx
+  80123a:	89 d7                	mov    %edx,%edi
+  80123c:	89 d6                	mov    %edx,%esi
+  80123e:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801240:	5b                   	pop    %ebx
+  801241:	5e                   	pop    %esi
+  801242:	5f                   	pop    %edi
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+
+00801245 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801245:	55                   	push   %ebp
+  801246:	89 e5                	mov    %esp,%ebp
+  801248:	57                   	push   %edi
+  801249:	56                   	push   %esi
+  80124a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80124b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801250:	8b 55 08             	mov    0x8(%ebp),%edx
+  801253:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801256:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80125b:	89 df                	mov    %ebx,%edi
+  80125d:	89 de                	mov    %ebx,%esi
+  80125f:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801261:	5b                   	pop    %ebx
+  801262:	5e                   	pop    %esi
+  801263:	5f                   	pop    %edi
+  801264:	5d                   	pop    %ebp
+  801265:	c3                   	ret
+
+00801266 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	56                   	push   %esi
+  80126b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80126c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801277:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80127c:	89 df                	mov    %ebx,%edi
+  80127e:	89 de                	mov    %ebx,%esi
+  801280:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801282:	5b                   	pop    %ebx
+  801283:	5e                   	pop    %esi
+  801284:	5f                   	pop    %edi
+  801285:	5d                   	pop    %ebp
+  801286:	c3                   	ret
+
+00801287 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801287:	55                   	push   %ebp
+  801288:	89 e5                	mov    %esp,%ebp
+  80128a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801290:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  801293:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  801295:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  801298:	83 3a 01             	cmpl   $0x1,(%edx)
+  80129b:	7e 09                	jle    8012a6 <argstart+0x1f>
+  80129d:	ba c8 2b 80 00       	mov    $0x802bc8,%edx
+  8012a2:	85 c9                	test   %ecx,%ecx
+  8012a4:	75 05                	jne    8012ab <argstart+0x24>
+  8012a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ab:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  8012ae:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  8012b5:	5d                   	pop    %ebp
+  8012b6:	c3                   	ret
+
+008012b7 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  8012b7:	55                   	push   %ebp
+  8012b8:	89 e5                	mov    %esp,%ebp
+  8012ba:	53                   	push   %ebx
+  8012bb:	83 ec 04             	sub    $0x4,%esp
+  8012be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  8012c1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  8012c8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	74 74                	je     801343 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  8012cf:	80 38 00             	cmpb   $0x0,(%eax)
+  8012d2:	75 48                	jne    80131c <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  8012d4:	8b 0b                	mov    (%ebx),%ecx
+  8012d6:	83 39 01             	cmpl   $0x1,(%ecx)
+  8012d9:	74 5a                	je     801335 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  8012db:	8b 53 04             	mov    0x4(%ebx),%edx
+  8012de:	8b 42 04             	mov    0x4(%edx),%eax
+  8012e1:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8012e4:	75 4f                	jne    801335 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  8012e6:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8012ea:	74 49                	je     801335 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  8012ec:	83 c0 01             	add    $0x1,%eax
+  8012ef:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8012f2:	83 ec 04             	sub    $0x4,%esp
+  8012f5:	8b 01                	mov    (%ecx),%eax
+  8012f7:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8012fe:	50                   	push   %eax
+  8012ff:	8d 42 08             	lea    0x8(%edx),%eax
+  801302:	50                   	push   %eax
+  801303:	83 c2 04             	add    $0x4,%edx
+  801306:	52                   	push   %edx
+  801307:	e8 6f f8 ff ff       	call   800b7b <memmove>
+		(*args->argc)--;
+  80130c:	8b 03                	mov    (%ebx),%eax
+  80130e:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801311:	8b 43 08             	mov    0x8(%ebx),%eax
+  801314:	83 c4 10             	add    $0x10,%esp
+  801317:	80 38 2d             	cmpb   $0x2d,(%eax)
+  80131a:	74 13                	je     80132f <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  80131c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80131f:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  801322:	83 c0 01             	add    $0x1,%eax
+  801325:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801328:	89 d0                	mov    %edx,%eax
+  80132a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80132d:	c9                   	leave
+  80132e:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  80132f:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801333:	75 e7                	jne    80131c <argnext+0x65>
+	args->curarg = 0;
+  801335:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  80133c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801341:	eb e5                	jmp    801328 <argnext+0x71>
+		return -1;
+  801343:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801348:	eb de                	jmp    801328 <argnext+0x71>
+
+0080134a <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  80134a:	55                   	push   %ebp
+  80134b:	89 e5                	mov    %esp,%ebp
+  80134d:	53                   	push   %ebx
+  80134e:	83 ec 04             	sub    $0x4,%esp
+  801351:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  801354:	8b 43 08             	mov    0x8(%ebx),%eax
+  801357:	85 c0                	test   %eax,%eax
+  801359:	74 12                	je     80136d <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  80135b:	80 38 00             	cmpb   $0x0,(%eax)
+  80135e:	74 12                	je     801372 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  801360:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  801363:	c7 43 08 c8 2b 80 00 	movl   $0x802bc8,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  80136a:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  80136d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801370:	c9                   	leave
+  801371:	c3                   	ret
+	} else if (*args->argc > 1) {
+  801372:	8b 13                	mov    (%ebx),%edx
+  801374:	83 3a 01             	cmpl   $0x1,(%edx)
+  801377:	7f 10                	jg     801389 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  801379:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  801380:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801387:	eb e1                	jmp    80136a <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801389:	8b 43 04             	mov    0x4(%ebx),%eax
+  80138c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80138f:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801392:	83 ec 04             	sub    $0x4,%esp
+  801395:	8b 12                	mov    (%edx),%edx
+  801397:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  80139e:	52                   	push   %edx
+  80139f:	8d 50 08             	lea    0x8(%eax),%edx
+  8013a2:	52                   	push   %edx
+  8013a3:	83 c0 04             	add    $0x4,%eax
+  8013a6:	50                   	push   %eax
+  8013a7:	e8 cf f7 ff ff       	call   800b7b <memmove>
+		(*args->argc)--;
+  8013ac:	8b 03                	mov    (%ebx),%eax
+  8013ae:	83 28 01             	subl   $0x1,(%eax)
+  8013b1:	83 c4 10             	add    $0x10,%esp
+  8013b4:	eb b4                	jmp    80136a <argnextvalue+0x20>
+
+008013b6 <argvalue>:
+{
+  8013b6:	55                   	push   %ebp
+  8013b7:	89 e5                	mov    %esp,%ebp
+  8013b9:	83 ec 08             	sub    $0x8,%esp
+  8013bc:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8013bf:	8b 42 0c             	mov    0xc(%edx),%eax
+  8013c2:	85 c0                	test   %eax,%eax
+  8013c4:	74 02                	je     8013c8 <argvalue+0x12>
+}
+  8013c6:	c9                   	leave
+  8013c7:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8013c8:	83 ec 0c             	sub    $0xc,%esp
+  8013cb:	52                   	push   %edx
+  8013cc:	e8 79 ff ff ff       	call   80134a <argnextvalue>
+  8013d1:	83 c4 10             	add    $0x10,%esp
+  8013d4:	eb f0                	jmp    8013c6 <argvalue+0x10>
+
+008013d6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013d6:	55                   	push   %ebp
+  8013d7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013dc:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013e1:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013e4:	5d                   	pop    %ebp
+  8013e5:	c3                   	ret
+
+008013e6 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013e6:	55                   	push   %ebp
+  8013e7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013ec:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013f1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013f6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013fb:	5d                   	pop    %ebp
+  8013fc:	c3                   	ret
+
+008013fd <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013fd:	55                   	push   %ebp
+  8013fe:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801400:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801405:	eb 02                	jmp    801409 <fd_alloc+0xc>
+  801407:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801409:	89 c2                	mov    %eax,%edx
+  80140b:	c1 ea 16             	shr    $0x16,%edx
+  80140e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801415:	f6 c2 01             	test   $0x1,%dl
+  801418:	74 2b                	je     801445 <fd_alloc+0x48>
+  80141a:	89 c2                	mov    %eax,%edx
+  80141c:	c1 ea 0c             	shr    $0xc,%edx
+  80141f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801426:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80142c:	f6 c1 01             	test   $0x1,%cl
+  80142f:	74 14                	je     801445 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801431:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801437:	75 ce                	jne    801407 <fd_alloc+0xa>
+  801439:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80143e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801443:	eb 05                	jmp    80144a <fd_alloc+0x4d>
+			return 0;
+  801445:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80144a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144d:	89 02                	mov    %eax,(%edx)
+}
+  80144f:	89 c8                	mov    %ecx,%eax
+  801451:	5d                   	pop    %ebp
+  801452:	c3                   	ret
+
+00801453 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801453:	55                   	push   %ebp
+  801454:	89 e5                	mov    %esp,%ebp
+  801456:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801459:	83 f8 1f             	cmp    $0x1f,%eax
+  80145c:	77 30                	ja     80148e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80145e:	c1 e0 0c             	shl    $0xc,%eax
+  801461:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801466:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80146c:	f6 c2 01             	test   $0x1,%dl
+  80146f:	74 24                	je     801495 <fd_lookup+0x42>
+  801471:	89 c2                	mov    %eax,%edx
+  801473:	c1 ea 0c             	shr    $0xc,%edx
+  801476:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80147d:	f6 c2 01             	test   $0x1,%dl
+  801480:	74 1a                	je     80149c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801482:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801485:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801487:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80148c:	5d                   	pop    %ebp
+  80148d:	c3                   	ret
+		return -E_INVAL;
+  80148e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801493:	eb f7                	jmp    80148c <fd_lookup+0x39>
+		return -E_INVAL;
+  801495:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149a:	eb f0                	jmp    80148c <fd_lookup+0x39>
+  80149c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014a1:	eb e9                	jmp    80148c <fd_lookup+0x39>
+
+008014a3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8014a3:	55                   	push   %ebp
+  8014a4:	89 e5                	mov    %esp,%ebp
+  8014a6:	53                   	push   %ebx
+  8014a7:	83 ec 04             	sub    $0x4,%esp
+  8014aa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b2:	eb 03                	jmp    8014b7 <dev_lookup+0x14>
+  8014b4:	83 c0 01             	add    $0x1,%eax
+  8014b7:	8b 1c 85 c8 2f 80 00 	mov    0x802fc8(,%eax,4),%ebx
+  8014be:	85 db                	test   %ebx,%ebx
+  8014c0:	74 0b                	je     8014cd <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8014c2:	39 13                	cmp    %edx,(%ebx)
+  8014c4:	75 ee                	jne    8014b4 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8014c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cb:	eb 1f                	jmp    8014ec <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014cd:	a1 20 54 80 00       	mov    0x805420,%eax
+  8014d2:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8014d5:	83 ec 04             	sub    $0x4,%esp
+  8014d8:	52                   	push   %edx
+  8014d9:	50                   	push   %eax
+  8014da:	68 4c 2f 80 00       	push   $0x802f4c
+  8014df:	e8 23 ef ff ff       	call   800407 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8014e4:	83 c4 10             	add    $0x10,%esp
+  8014e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014ef:	89 1a                	mov    %ebx,(%edx)
+}
+  8014f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014f4:	c9                   	leave
+  8014f5:	c3                   	ret
+
+008014f6 <fd_close>:
+{
+  8014f6:	55                   	push   %ebp
+  8014f7:	89 e5                	mov    %esp,%ebp
+  8014f9:	57                   	push   %edi
+  8014fa:	56                   	push   %esi
+  8014fb:	53                   	push   %ebx
+  8014fc:	83 ec 24             	sub    $0x24,%esp
+  8014ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  801502:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801505:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801508:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801509:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80150f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801512:	50                   	push   %eax
+  801513:	e8 3b ff ff ff       	call   801453 <fd_lookup>
+  801518:	89 c3                	mov    %eax,%ebx
+  80151a:	83 c4 10             	add    $0x10,%esp
+  80151d:	85 c0                	test   %eax,%eax
+  80151f:	78 05                	js     801526 <fd_close+0x30>
+	    || fd != fd2)
+  801521:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801524:	74 16                	je     80153c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801526:	89 f8                	mov    %edi,%eax
+  801528:	84 c0                	test   %al,%al
+  80152a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801532:	89 d8                	mov    %ebx,%eax
+  801534:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801537:	5b                   	pop    %ebx
+  801538:	5e                   	pop    %esi
+  801539:	5f                   	pop    %edi
+  80153a:	5d                   	pop    %ebp
+  80153b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80153c:	83 ec 08             	sub    $0x8,%esp
+  80153f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801542:	50                   	push   %eax
+  801543:	ff 36                	push   (%esi)
+  801545:	e8 59 ff ff ff       	call   8014a3 <dev_lookup>
+  80154a:	89 c3                	mov    %eax,%ebx
+  80154c:	83 c4 10             	add    $0x10,%esp
+  80154f:	85 c0                	test   %eax,%eax
+  801551:	78 1a                	js     80156d <fd_close+0x77>
+		if (dev->dev_close)
+  801553:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801556:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801559:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80155e:	85 c0                	test   %eax,%eax
+  801560:	74 0b                	je     80156d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801562:	83 ec 0c             	sub    $0xc,%esp
+  801565:	56                   	push   %esi
+  801566:	ff d0                	call   *%eax
+  801568:	89 c3                	mov    %eax,%ebx
+  80156a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80156d:	83 ec 08             	sub    $0x8,%esp
+  801570:	56                   	push   %esi
+  801571:	6a 00                	push   $0x0
+  801573:	e8 b2 f9 ff ff       	call   800f2a <sys_page_unmap>
+	return r;
+  801578:	83 c4 10             	add    $0x10,%esp
+  80157b:	eb b5                	jmp    801532 <fd_close+0x3c>
+
+0080157d <close>:
+
+int
+close(int fdnum)
+{
+  80157d:	55                   	push   %ebp
+  80157e:	89 e5                	mov    %esp,%ebp
+  801580:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801583:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801586:	50                   	push   %eax
+  801587:	ff 75 08             	push   0x8(%ebp)
+  80158a:	e8 c4 fe ff ff       	call   801453 <fd_lookup>
+  80158f:	83 c4 10             	add    $0x10,%esp
+  801592:	85 c0                	test   %eax,%eax
+  801594:	79 02                	jns    801598 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801596:	c9                   	leave
+  801597:	c3                   	ret
+		return fd_close(fd, 1);
+  801598:	83 ec 08             	sub    $0x8,%esp
+  80159b:	6a 01                	push   $0x1
+  80159d:	ff 75 f4             	push   -0xc(%ebp)
+  8015a0:	e8 51 ff ff ff       	call   8014f6 <fd_close>
+  8015a5:	83 c4 10             	add    $0x10,%esp
+  8015a8:	eb ec                	jmp    801596 <close+0x19>
+
+008015aa <close_all>:
+
+void
+close_all(void)
+{
+  8015aa:	55                   	push   %ebp
+  8015ab:	89 e5                	mov    %esp,%ebp
+  8015ad:	53                   	push   %ebx
+  8015ae:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8015b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015b6:	83 ec 0c             	sub    $0xc,%esp
+  8015b9:	53                   	push   %ebx
+  8015ba:	e8 be ff ff ff       	call   80157d <close>
+	for (i = 0; i < MAXFD; i++)
+  8015bf:	83 c3 01             	add    $0x1,%ebx
+  8015c2:	83 c4 10             	add    $0x10,%esp
+  8015c5:	83 fb 20             	cmp    $0x20,%ebx
+  8015c8:	75 ec                	jne    8015b6 <close_all+0xc>
+}
+  8015ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015cd:	c9                   	leave
+  8015ce:	c3                   	ret
+
+008015cf <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015cf:	55                   	push   %ebp
+  8015d0:	89 e5                	mov    %esp,%ebp
+  8015d2:	57                   	push   %edi
+  8015d3:	56                   	push   %esi
+  8015d4:	53                   	push   %ebx
+  8015d5:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015d8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015db:	50                   	push   %eax
+  8015dc:	ff 75 08             	push   0x8(%ebp)
+  8015df:	e8 6f fe ff ff       	call   801453 <fd_lookup>
+  8015e4:	89 c3                	mov    %eax,%ebx
+  8015e6:	83 c4 10             	add    $0x10,%esp
+  8015e9:	85 c0                	test   %eax,%eax
+  8015eb:	78 7f                	js     80166c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015ed:	83 ec 0c             	sub    $0xc,%esp
+  8015f0:	ff 75 0c             	push   0xc(%ebp)
+  8015f3:	e8 85 ff ff ff       	call   80157d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8015f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015fb:	c1 e6 0c             	shl    $0xc,%esi
+  8015fe:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801604:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801607:	89 3c 24             	mov    %edi,(%esp)
+  80160a:	e8 d7 fd ff ff       	call   8013e6 <fd2data>
+  80160f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801611:	89 34 24             	mov    %esi,(%esp)
+  801614:	e8 cd fd ff ff       	call   8013e6 <fd2data>
+  801619:	83 c4 10             	add    $0x10,%esp
+  80161c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80161f:	89 d8                	mov    %ebx,%eax
+  801621:	c1 e8 16             	shr    $0x16,%eax
+  801624:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80162b:	a8 01                	test   $0x1,%al
+  80162d:	74 11                	je     801640 <dup+0x71>
+  80162f:	89 d8                	mov    %ebx,%eax
+  801631:	c1 e8 0c             	shr    $0xc,%eax
+  801634:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80163b:	f6 c2 01             	test   $0x1,%dl
+  80163e:	75 36                	jne    801676 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801640:	89 f8                	mov    %edi,%eax
+  801642:	c1 e8 0c             	shr    $0xc,%eax
+  801645:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80164c:	83 ec 0c             	sub    $0xc,%esp
+  80164f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801654:	50                   	push   %eax
+  801655:	56                   	push   %esi
+  801656:	6a 00                	push   $0x0
+  801658:	57                   	push   %edi
+  801659:	6a 00                	push   $0x0
+  80165b:	e8 88 f8 ff ff       	call   800ee8 <sys_page_map>
+  801660:	89 c3                	mov    %eax,%ebx
+  801662:	83 c4 20             	add    $0x20,%esp
+  801665:	85 c0                	test   %eax,%eax
+  801667:	78 33                	js     80169c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801669:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80166c:	89 d8                	mov    %ebx,%eax
+  80166e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801671:	5b                   	pop    %ebx
+  801672:	5e                   	pop    %esi
+  801673:	5f                   	pop    %edi
+  801674:	5d                   	pop    %ebp
+  801675:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801676:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80167d:	83 ec 0c             	sub    $0xc,%esp
+  801680:	25 07 0e 00 00       	and    $0xe07,%eax
+  801685:	50                   	push   %eax
+  801686:	ff 75 d4             	push   -0x2c(%ebp)
+  801689:	6a 00                	push   $0x0
+  80168b:	53                   	push   %ebx
+  80168c:	6a 00                	push   $0x0
+  80168e:	e8 55 f8 ff ff       	call   800ee8 <sys_page_map>
+  801693:	89 c3                	mov    %eax,%ebx
+  801695:	83 c4 20             	add    $0x20,%esp
+  801698:	85 c0                	test   %eax,%eax
+  80169a:	79 a4                	jns    801640 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80169c:	83 ec 08             	sub    $0x8,%esp
+  80169f:	56                   	push   %esi
+  8016a0:	6a 00                	push   $0x0
+  8016a2:	e8 83 f8 ff ff       	call   800f2a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8016a7:	83 c4 08             	add    $0x8,%esp
+  8016aa:	ff 75 d4             	push   -0x2c(%ebp)
+  8016ad:	6a 00                	push   $0x0
+  8016af:	e8 76 f8 ff ff       	call   800f2a <sys_page_unmap>
+	return r;
+  8016b4:	83 c4 10             	add    $0x10,%esp
+  8016b7:	eb b3                	jmp    80166c <dup+0x9d>
+
+008016b9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016b9:	55                   	push   %ebp
+  8016ba:	89 e5                	mov    %esp,%ebp
+  8016bc:	56                   	push   %esi
+  8016bd:	53                   	push   %ebx
+  8016be:	83 ec 18             	sub    $0x18,%esp
+  8016c1:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016c4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016c7:	50                   	push   %eax
+  8016c8:	56                   	push   %esi
+  8016c9:	e8 85 fd ff ff       	call   801453 <fd_lookup>
+  8016ce:	83 c4 10             	add    $0x10,%esp
+  8016d1:	85 c0                	test   %eax,%eax
+  8016d3:	78 3c                	js     801711 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016d5:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016d8:	83 ec 08             	sub    $0x8,%esp
+  8016db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016de:	50                   	push   %eax
+  8016df:	ff 33                	push   (%ebx)
+  8016e1:	e8 bd fd ff ff       	call   8014a3 <dev_lookup>
+  8016e6:	83 c4 10             	add    $0x10,%esp
+  8016e9:	85 c0                	test   %eax,%eax
+  8016eb:	78 24                	js     801711 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016ed:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016f0:	83 e0 03             	and    $0x3,%eax
+  8016f3:	83 f8 01             	cmp    $0x1,%eax
+  8016f6:	74 20                	je     801718 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8016f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016fb:	8b 40 08             	mov    0x8(%eax),%eax
+  8016fe:	85 c0                	test   %eax,%eax
+  801700:	74 37                	je     801739 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801702:	83 ec 04             	sub    $0x4,%esp
+  801705:	ff 75 10             	push   0x10(%ebp)
+  801708:	ff 75 0c             	push   0xc(%ebp)
+  80170b:	53                   	push   %ebx
+  80170c:	ff d0                	call   *%eax
+  80170e:	83 c4 10             	add    $0x10,%esp
+}
+  801711:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801714:	5b                   	pop    %ebx
+  801715:	5e                   	pop    %esi
+  801716:	5d                   	pop    %ebp
+  801717:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801718:	a1 20 54 80 00       	mov    0x805420,%eax
+  80171d:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801720:	83 ec 04             	sub    $0x4,%esp
+  801723:	56                   	push   %esi
+  801724:	50                   	push   %eax
+  801725:	68 8d 2f 80 00       	push   $0x802f8d
+  80172a:	e8 d8 ec ff ff       	call   800407 <cprintf>
+		return -E_INVAL;
+  80172f:	83 c4 10             	add    $0x10,%esp
+  801732:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801737:	eb d8                	jmp    801711 <read+0x58>
+		return -E_NOT_SUPP;
+  801739:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80173e:	eb d1                	jmp    801711 <read+0x58>
+
+00801740 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801740:	55                   	push   %ebp
+  801741:	89 e5                	mov    %esp,%ebp
+  801743:	57                   	push   %edi
+  801744:	56                   	push   %esi
+  801745:	53                   	push   %ebx
+  801746:	83 ec 0c             	sub    $0xc,%esp
+  801749:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80174c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80174f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801754:	eb 02                	jmp    801758 <readn+0x18>
+  801756:	01 c3                	add    %eax,%ebx
+  801758:	39 f3                	cmp    %esi,%ebx
+  80175a:	73 21                	jae    80177d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80175c:	83 ec 04             	sub    $0x4,%esp
+  80175f:	89 f0                	mov    %esi,%eax
+  801761:	29 d8                	sub    %ebx,%eax
+  801763:	50                   	push   %eax
+  801764:	89 d8                	mov    %ebx,%eax
+  801766:	03 45 0c             	add    0xc(%ebp),%eax
+  801769:	50                   	push   %eax
+  80176a:	57                   	push   %edi
+  80176b:	e8 49 ff ff ff       	call   8016b9 <read>
+		if (m < 0)
+  801770:	83 c4 10             	add    $0x10,%esp
+  801773:	85 c0                	test   %eax,%eax
+  801775:	78 04                	js     80177b <readn+0x3b>
+			return m;
+		if (m == 0)
+  801777:	75 dd                	jne    801756 <readn+0x16>
+  801779:	eb 02                	jmp    80177d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80177b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80177d:	89 d8                	mov    %ebx,%eax
+  80177f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801782:	5b                   	pop    %ebx
+  801783:	5e                   	pop    %esi
+  801784:	5f                   	pop    %edi
+  801785:	5d                   	pop    %ebp
+  801786:	c3                   	ret
+
+00801787 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801787:	55                   	push   %ebp
+  801788:	89 e5                	mov    %esp,%ebp
+  80178a:	56                   	push   %esi
+  80178b:	53                   	push   %ebx
+  80178c:	83 ec 18             	sub    $0x18,%esp
+  80178f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801792:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801795:	50                   	push   %eax
+  801796:	53                   	push   %ebx
+  801797:	e8 b7 fc ff ff       	call   801453 <fd_lookup>
+  80179c:	83 c4 10             	add    $0x10,%esp
+  80179f:	85 c0                	test   %eax,%eax
+  8017a1:	78 37                	js     8017da <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017a3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017a6:	83 ec 08             	sub    $0x8,%esp
+  8017a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ac:	50                   	push   %eax
+  8017ad:	ff 36                	push   (%esi)
+  8017af:	e8 ef fc ff ff       	call   8014a3 <dev_lookup>
+  8017b4:	83 c4 10             	add    $0x10,%esp
+  8017b7:	85 c0                	test   %eax,%eax
+  8017b9:	78 1f                	js     8017da <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017bb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017bf:	74 20                	je     8017e1 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8017c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017c4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017c7:	85 c0                	test   %eax,%eax
+  8017c9:	74 37                	je     801802 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8017cb:	83 ec 04             	sub    $0x4,%esp
+  8017ce:	ff 75 10             	push   0x10(%ebp)
+  8017d1:	ff 75 0c             	push   0xc(%ebp)
+  8017d4:	56                   	push   %esi
+  8017d5:	ff d0                	call   *%eax
+  8017d7:	83 c4 10             	add    $0x10,%esp
+}
+  8017da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017dd:	5b                   	pop    %ebx
+  8017de:	5e                   	pop    %esi
+  8017df:	5d                   	pop    %ebp
+  8017e0:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017e1:	a1 20 54 80 00       	mov    0x805420,%eax
+  8017e6:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8017e9:	83 ec 04             	sub    $0x4,%esp
+  8017ec:	53                   	push   %ebx
+  8017ed:	50                   	push   %eax
+  8017ee:	68 a9 2f 80 00       	push   $0x802fa9
+  8017f3:	e8 0f ec ff ff       	call   800407 <cprintf>
+		return -E_INVAL;
+  8017f8:	83 c4 10             	add    $0x10,%esp
+  8017fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801800:	eb d8                	jmp    8017da <write+0x53>
+		return -E_NOT_SUPP;
+  801802:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801807:	eb d1                	jmp    8017da <write+0x53>
+
+00801809 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801809:	55                   	push   %ebp
+  80180a:	89 e5                	mov    %esp,%ebp
+  80180c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80180f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801812:	50                   	push   %eax
+  801813:	ff 75 08             	push   0x8(%ebp)
+  801816:	e8 38 fc ff ff       	call   801453 <fd_lookup>
+  80181b:	83 c4 10             	add    $0x10,%esp
+  80181e:	85 c0                	test   %eax,%eax
+  801820:	78 0e                	js     801830 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801822:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801825:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801828:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80182b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801830:	c9                   	leave
+  801831:	c3                   	ret
+
+00801832 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801832:	55                   	push   %ebp
+  801833:	89 e5                	mov    %esp,%ebp
+  801835:	56                   	push   %esi
+  801836:	53                   	push   %ebx
+  801837:	83 ec 18             	sub    $0x18,%esp
+  80183a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80183d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801840:	50                   	push   %eax
+  801841:	53                   	push   %ebx
+  801842:	e8 0c fc ff ff       	call   801453 <fd_lookup>
+  801847:	83 c4 10             	add    $0x10,%esp
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	78 34                	js     801882 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80184e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801851:	83 ec 08             	sub    $0x8,%esp
+  801854:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801857:	50                   	push   %eax
+  801858:	ff 36                	push   (%esi)
+  80185a:	e8 44 fc ff ff       	call   8014a3 <dev_lookup>
+  80185f:	83 c4 10             	add    $0x10,%esp
+  801862:	85 c0                	test   %eax,%eax
+  801864:	78 1c                	js     801882 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801866:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80186a:	74 1d                	je     801889 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80186c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80186f:	8b 40 18             	mov    0x18(%eax),%eax
+  801872:	85 c0                	test   %eax,%eax
+  801874:	74 34                	je     8018aa <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801876:	83 ec 08             	sub    $0x8,%esp
+  801879:	ff 75 0c             	push   0xc(%ebp)
+  80187c:	56                   	push   %esi
+  80187d:	ff d0                	call   *%eax
+  80187f:	83 c4 10             	add    $0x10,%esp
+}
+  801882:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801885:	5b                   	pop    %ebx
+  801886:	5e                   	pop    %esi
+  801887:	5d                   	pop    %ebp
+  801888:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801889:	a1 20 54 80 00       	mov    0x805420,%eax
+  80188e:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801891:	83 ec 04             	sub    $0x4,%esp
+  801894:	53                   	push   %ebx
+  801895:	50                   	push   %eax
+  801896:	68 6c 2f 80 00       	push   $0x802f6c
+  80189b:	e8 67 eb ff ff       	call   800407 <cprintf>
+		return -E_INVAL;
+  8018a0:	83 c4 10             	add    $0x10,%esp
+  8018a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018a8:	eb d8                	jmp    801882 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8018aa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018af:	eb d1                	jmp    801882 <ftruncate+0x50>
+
+008018b1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018b1:	55                   	push   %ebp
+  8018b2:	89 e5                	mov    %esp,%ebp
+  8018b4:	56                   	push   %esi
+  8018b5:	53                   	push   %ebx
+  8018b6:	83 ec 18             	sub    $0x18,%esp
+  8018b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018bc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018bf:	50                   	push   %eax
+  8018c0:	ff 75 08             	push   0x8(%ebp)
+  8018c3:	e8 8b fb ff ff       	call   801453 <fd_lookup>
+  8018c8:	83 c4 10             	add    $0x10,%esp
+  8018cb:	85 c0                	test   %eax,%eax
+  8018cd:	78 49                	js     801918 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018cf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018d2:	83 ec 08             	sub    $0x8,%esp
+  8018d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018d8:	50                   	push   %eax
+  8018d9:	ff 36                	push   (%esi)
+  8018db:	e8 c3 fb ff ff       	call   8014a3 <dev_lookup>
+  8018e0:	83 c4 10             	add    $0x10,%esp
+  8018e3:	85 c0                	test   %eax,%eax
+  8018e5:	78 31                	js     801918 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8018e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018ea:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018ee:	74 2f                	je     80191f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018f0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018f3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018fa:	00 00 00 
+	stat->st_isdir = 0;
+  8018fd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801904:	00 00 00 
+	stat->st_dev = dev;
+  801907:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80190d:	83 ec 08             	sub    $0x8,%esp
+  801910:	53                   	push   %ebx
+  801911:	56                   	push   %esi
+  801912:	ff 50 14             	call   *0x14(%eax)
+  801915:	83 c4 10             	add    $0x10,%esp
+}
+  801918:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80191b:	5b                   	pop    %ebx
+  80191c:	5e                   	pop    %esi
+  80191d:	5d                   	pop    %ebp
+  80191e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80191f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801924:	eb f2                	jmp    801918 <fstat+0x67>
+
+00801926 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801926:	55                   	push   %ebp
+  801927:	89 e5                	mov    %esp,%ebp
+  801929:	56                   	push   %esi
+  80192a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80192b:	83 ec 08             	sub    $0x8,%esp
+  80192e:	6a 00                	push   $0x0
+  801930:	ff 75 08             	push   0x8(%ebp)
+  801933:	e8 e4 01 00 00       	call   801b1c <open>
+  801938:	89 c3                	mov    %eax,%ebx
+  80193a:	83 c4 10             	add    $0x10,%esp
+  80193d:	85 c0                	test   %eax,%eax
+  80193f:	78 1b                	js     80195c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801941:	83 ec 08             	sub    $0x8,%esp
+  801944:	ff 75 0c             	push   0xc(%ebp)
+  801947:	50                   	push   %eax
+  801948:	e8 64 ff ff ff       	call   8018b1 <fstat>
+  80194d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80194f:	89 1c 24             	mov    %ebx,(%esp)
+  801952:	e8 26 fc ff ff       	call   80157d <close>
+	return r;
+  801957:	83 c4 10             	add    $0x10,%esp
+  80195a:	89 f3                	mov    %esi,%ebx
+}
+  80195c:	89 d8                	mov    %ebx,%eax
+  80195e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801961:	5b                   	pop    %ebx
+  801962:	5e                   	pop    %esi
+  801963:	5d                   	pop    %ebp
+  801964:	c3                   	ret
+
+00801965 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801965:	55                   	push   %ebp
+  801966:	89 e5                	mov    %esp,%ebp
+  801968:	56                   	push   %esi
+  801969:	53                   	push   %ebx
+  80196a:	89 c6                	mov    %eax,%esi
+  80196c:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80196e:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801975:	74 27                	je     80199e <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801977:	6a 07                	push   $0x7
+  801979:	68 00 60 80 00       	push   $0x806000
+  80197e:	56                   	push   %esi
+  80197f:	ff 35 00 50 80 00    	push   0x805000
+  801985:	e8 e9 0c 00 00       	call   802673 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80198a:	83 c4 0c             	add    $0xc,%esp
+  80198d:	6a 00                	push   $0x0
+  80198f:	53                   	push   %ebx
+  801990:	6a 00                	push   $0x0
+  801992:	e8 64 0c 00 00       	call   8025fb <ipc_recv>
+}
+  801997:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80199a:	5b                   	pop    %ebx
+  80199b:	5e                   	pop    %esi
+  80199c:	5d                   	pop    %ebp
+  80199d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80199e:	83 ec 0c             	sub    $0xc,%esp
+  8019a1:	6a 01                	push   $0x1
+  8019a3:	e8 1f 0d 00 00       	call   8026c7 <ipc_find_env>
+  8019a8:	a3 00 50 80 00       	mov    %eax,0x805000
+  8019ad:	83 c4 10             	add    $0x10,%esp
+  8019b0:	eb c5                	jmp    801977 <fsipc+0x12>
+
+008019b2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019b2:	55                   	push   %ebp
+  8019b3:	89 e5                	mov    %esp,%ebp
+  8019b5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019bb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019be:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8019c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019c6:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019d5:	e8 8b ff ff ff       	call   801965 <fsipc>
+}
+  8019da:	c9                   	leave
+  8019db:	c3                   	ret
+
+008019dc <devfile_flush>:
+{
+  8019dc:	55                   	push   %ebp
+  8019dd:	89 e5                	mov    %esp,%ebp
+  8019df:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019e8:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8019ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019f7:	e8 69 ff ff ff       	call   801965 <fsipc>
+}
+  8019fc:	c9                   	leave
+  8019fd:	c3                   	ret
+
+008019fe <devfile_stat>:
+{
+  8019fe:	55                   	push   %ebp
+  8019ff:	89 e5                	mov    %esp,%ebp
+  801a01:	53                   	push   %ebx
+  801a02:	83 ec 04             	sub    $0x4,%esp
+  801a05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a08:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a0b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a0e:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a13:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a18:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a1d:	e8 43 ff ff ff       	call   801965 <fsipc>
+  801a22:	85 c0                	test   %eax,%eax
+  801a24:	78 2c                	js     801a52 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a26:	83 ec 08             	sub    $0x8,%esp
+  801a29:	68 00 60 80 00       	push   $0x806000
+  801a2e:	53                   	push   %ebx
+  801a2f:	e8 c1 ef ff ff       	call   8009f5 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a34:	a1 80 60 80 00       	mov    0x806080,%eax
+  801a39:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a3f:	a1 84 60 80 00       	mov    0x806084,%eax
+  801a44:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801a4a:	83 c4 10             	add    $0x10,%esp
+  801a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a55:	c9                   	leave
+  801a56:	c3                   	ret
+
+00801a57 <devfile_write>:
+{
+  801a57:	55                   	push   %ebp
+  801a58:	89 e5                	mov    %esp,%ebp
+  801a5a:	83 ec 0c             	sub    $0xc,%esp
+  801a5d:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a60:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a65:	39 d0                	cmp    %edx,%eax
+  801a67:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a6d:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a70:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801a76:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a7b:	50                   	push   %eax
+  801a7c:	ff 75 0c             	push   0xc(%ebp)
+  801a7f:	68 08 60 80 00       	push   $0x806008
+  801a84:	e8 f2 f0 ff ff       	call   800b7b <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a8e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a93:	e8 cd fe ff ff       	call   801965 <fsipc>
+}
+  801a98:	c9                   	leave
+  801a99:	c3                   	ret
+
+00801a9a <devfile_read>:
+{
+  801a9a:	55                   	push   %ebp
+  801a9b:	89 e5                	mov    %esp,%ebp
+  801a9d:	56                   	push   %esi
+  801a9e:	53                   	push   %ebx
+  801a9f:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aa5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aa8:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801aad:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ab3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab8:	b8 03 00 00 00       	mov    $0x3,%eax
+  801abd:	e8 a3 fe ff ff       	call   801965 <fsipc>
+  801ac2:	89 c3                	mov    %eax,%ebx
+  801ac4:	85 c0                	test   %eax,%eax
+  801ac6:	78 1f                	js     801ae7 <devfile_read+0x4d>
+	assert(r <= n);
+  801ac8:	39 c6                	cmp    %eax,%esi
+  801aca:	72 24                	jb     801af0 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801acc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ad1:	7f 33                	jg     801b06 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ad3:	83 ec 04             	sub    $0x4,%esp
+  801ad6:	50                   	push   %eax
+  801ad7:	68 00 60 80 00       	push   $0x806000
+  801adc:	ff 75 0c             	push   0xc(%ebp)
+  801adf:	e8 97 f0 ff ff       	call   800b7b <memmove>
+	return r;
+  801ae4:	83 c4 10             	add    $0x10,%esp
+}
+  801ae7:	89 d8                	mov    %ebx,%eax
+  801ae9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aec:	5b                   	pop    %ebx
+  801aed:	5e                   	pop    %esi
+  801aee:	5d                   	pop    %ebp
+  801aef:	c3                   	ret
+	assert(r <= n);
+  801af0:	68 dc 2f 80 00       	push   $0x802fdc
+  801af5:	68 e3 2f 80 00       	push   $0x802fe3
+  801afa:	6a 7c                	push   $0x7c
+  801afc:	68 f8 2f 80 00       	push   $0x802ff8
+  801b01:	e8 26 e8 ff ff       	call   80032c <_panic>
+	assert(r <= PGSIZE);
+  801b06:	68 03 30 80 00       	push   $0x803003
+  801b0b:	68 e3 2f 80 00       	push   $0x802fe3
+  801b10:	6a 7d                	push   $0x7d
+  801b12:	68 f8 2f 80 00       	push   $0x802ff8
+  801b17:	e8 10 e8 ff ff       	call   80032c <_panic>
+
+00801b1c <open>:
+{
+  801b1c:	55                   	push   %ebp
+  801b1d:	89 e5                	mov    %esp,%ebp
+  801b1f:	56                   	push   %esi
+  801b20:	53                   	push   %ebx
+  801b21:	83 ec 1c             	sub    $0x1c,%esp
+  801b24:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b27:	56                   	push   %esi
+  801b28:	e8 8d ee ff ff       	call   8009ba <strlen>
+  801b2d:	83 c4 10             	add    $0x10,%esp
+  801b30:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b35:	7f 6c                	jg     801ba3 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b37:	83 ec 0c             	sub    $0xc,%esp
+  801b3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b3d:	50                   	push   %eax
+  801b3e:	e8 ba f8 ff ff       	call   8013fd <fd_alloc>
+  801b43:	89 c3                	mov    %eax,%ebx
+  801b45:	83 c4 10             	add    $0x10,%esp
+  801b48:	85 c0                	test   %eax,%eax
+  801b4a:	78 3c                	js     801b88 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b4c:	83 ec 08             	sub    $0x8,%esp
+  801b4f:	56                   	push   %esi
+  801b50:	68 00 60 80 00       	push   $0x806000
+  801b55:	e8 9b ee ff ff       	call   8009f5 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b5d:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b62:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b65:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b6a:	e8 f6 fd ff ff       	call   801965 <fsipc>
+  801b6f:	89 c3                	mov    %eax,%ebx
+  801b71:	83 c4 10             	add    $0x10,%esp
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	78 19                	js     801b91 <open+0x75>
+	return fd2num(fd);
+  801b78:	83 ec 0c             	sub    $0xc,%esp
+  801b7b:	ff 75 f4             	push   -0xc(%ebp)
+  801b7e:	e8 53 f8 ff ff       	call   8013d6 <fd2num>
+  801b83:	89 c3                	mov    %eax,%ebx
+  801b85:	83 c4 10             	add    $0x10,%esp
+}
+  801b88:	89 d8                	mov    %ebx,%eax
+  801b8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b8d:	5b                   	pop    %ebx
+  801b8e:	5e                   	pop    %esi
+  801b8f:	5d                   	pop    %ebp
+  801b90:	c3                   	ret
+		fd_close(fd, 0);
+  801b91:	83 ec 08             	sub    $0x8,%esp
+  801b94:	6a 00                	push   $0x0
+  801b96:	ff 75 f4             	push   -0xc(%ebp)
+  801b99:	e8 58 f9 ff ff       	call   8014f6 <fd_close>
+		return r;
+  801b9e:	83 c4 10             	add    $0x10,%esp
+  801ba1:	eb e5                	jmp    801b88 <open+0x6c>
+		return -E_BAD_PATH;
+  801ba3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ba8:	eb de                	jmp    801b88 <open+0x6c>
+
+00801baa <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801baa:	55                   	push   %ebp
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801bb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb5:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bba:	e8 a6 fd ff ff       	call   801965 <fsipc>
+}
+  801bbf:	c9                   	leave
+  801bc0:	c3                   	ret
+
+00801bc1 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801bc1:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801bc5:	7f 01                	jg     801bc8 <writebuf+0x7>
+  801bc7:	c3                   	ret
+{
+  801bc8:	55                   	push   %ebp
+  801bc9:	89 e5                	mov    %esp,%ebp
+  801bcb:	53                   	push   %ebx
+  801bcc:	83 ec 08             	sub    $0x8,%esp
+  801bcf:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801bd1:	ff 70 04             	push   0x4(%eax)
+  801bd4:	8d 40 10             	lea    0x10(%eax),%eax
+  801bd7:	50                   	push   %eax
+  801bd8:	ff 33                	push   (%ebx)
+  801bda:	e8 a8 fb ff ff       	call   801787 <write>
+		if (result > 0)
+  801bdf:	83 c4 10             	add    $0x10,%esp
+  801be2:	85 c0                	test   %eax,%eax
+  801be4:	7e 03                	jle    801be9 <writebuf+0x28>
+			b->result += result;
+  801be6:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801be9:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801bec:	74 0d                	je     801bfb <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801bee:	85 c0                	test   %eax,%eax
+  801bf0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf5:	0f 4f c2             	cmovg  %edx,%eax
+  801bf8:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801bfb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bfe:	c9                   	leave
+  801bff:	c3                   	ret
+
+00801c00 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801c00:	55                   	push   %ebp
+  801c01:	89 e5                	mov    %esp,%ebp
+  801c03:	53                   	push   %ebx
+  801c04:	83 ec 04             	sub    $0x4,%esp
+  801c07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801c0a:	8b 53 04             	mov    0x4(%ebx),%edx
+  801c0d:	8d 42 01             	lea    0x1(%edx),%eax
+  801c10:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c13:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c16:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801c1a:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801c1f:	74 05                	je     801c26 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801c21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c24:	c9                   	leave
+  801c25:	c3                   	ret
+		writebuf(b);
+  801c26:	89 d8                	mov    %ebx,%eax
+  801c28:	e8 94 ff ff ff       	call   801bc1 <writebuf>
+		b->idx = 0;
+  801c2d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801c34:	eb eb                	jmp    801c21 <putch+0x21>
+
+00801c36 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801c36:	55                   	push   %ebp
+  801c37:	89 e5                	mov    %esp,%ebp
+  801c39:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801c3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c42:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801c48:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801c4f:	00 00 00 
+	b.result = 0;
+  801c52:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801c59:	00 00 00 
+	b.error = 1;
+  801c5c:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801c63:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801c66:	ff 75 10             	push   0x10(%ebp)
+  801c69:	ff 75 0c             	push   0xc(%ebp)
+  801c6c:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801c72:	50                   	push   %eax
+  801c73:	68 00 1c 80 00       	push   $0x801c00
+  801c78:	e8 81 e8 ff ff       	call   8004fe <vprintfmt>
+	if (b.idx > 0)
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801c87:	7f 12                	jg     801c9b <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801c89:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801c8f:	85 c0                	test   %eax,%eax
+  801c91:	75 06                	jne    801c99 <vfprintf+0x63>
+  801c93:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801c99:	c9                   	leave
+  801c9a:	c3                   	ret
+		writebuf(&b);
+  801c9b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801ca1:	e8 1b ff ff ff       	call   801bc1 <writebuf>
+  801ca6:	eb e1                	jmp    801c89 <vfprintf+0x53>
+
+00801ca8 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801ca8:	55                   	push   %ebp
+  801ca9:	89 e5                	mov    %esp,%ebp
+  801cab:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801cae:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801cb1:	50                   	push   %eax
+  801cb2:	ff 75 0c             	push   0xc(%ebp)
+  801cb5:	ff 75 08             	push   0x8(%ebp)
+  801cb8:	e8 79 ff ff ff       	call   801c36 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801cbd:	c9                   	leave
+  801cbe:	c3                   	ret
+
+00801cbf <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801cbf:	55                   	push   %ebp
+  801cc0:	89 e5                	mov    %esp,%ebp
+  801cc2:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801cc5:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801cc8:	50                   	push   %eax
+  801cc9:	ff 75 08             	push   0x8(%ebp)
+  801ccc:	6a 01                	push   $0x1
+  801cce:	e8 63 ff ff ff       	call   801c36 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801cd3:	c9                   	leave
+  801cd4:	c3                   	ret
+
+00801cd5 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cd5:	55                   	push   %ebp
+  801cd6:	89 e5                	mov    %esp,%ebp
+  801cd8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801cdb:	68 0f 30 80 00       	push   $0x80300f
+  801ce0:	ff 75 0c             	push   0xc(%ebp)
+  801ce3:	e8 0d ed ff ff       	call   8009f5 <strcpy>
+	return 0;
+}
+  801ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ced:	c9                   	leave
+  801cee:	c3                   	ret
+
+00801cef <devsock_close>:
+{
+  801cef:	55                   	push   %ebp
+  801cf0:	89 e5                	mov    %esp,%ebp
+  801cf2:	53                   	push   %ebx
+  801cf3:	83 ec 10             	sub    $0x10,%esp
+  801cf6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801cf9:	53                   	push   %ebx
+  801cfa:	e8 d8 09 00 00       	call   8026d7 <pageref>
+  801cff:	89 c2                	mov    %eax,%edx
+  801d01:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d04:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801d09:	83 fa 01             	cmp    $0x1,%edx
+  801d0c:	74 05                	je     801d13 <devsock_close+0x24>
+}
+  801d0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d11:	c9                   	leave
+  801d12:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801d13:	83 ec 0c             	sub    $0xc,%esp
+  801d16:	ff 73 0c             	push   0xc(%ebx)
+  801d19:	e8 b7 02 00 00       	call   801fd5 <nsipc_close>
+  801d1e:	83 c4 10             	add    $0x10,%esp
+  801d21:	eb eb                	jmp    801d0e <devsock_close+0x1f>
+
+00801d23 <devsock_write>:
+{
+  801d23:	55                   	push   %ebp
+  801d24:	89 e5                	mov    %esp,%ebp
+  801d26:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801d29:	6a 00                	push   $0x0
+  801d2b:	ff 75 10             	push   0x10(%ebp)
+  801d2e:	ff 75 0c             	push   0xc(%ebp)
+  801d31:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d34:	ff 70 0c             	push   0xc(%eax)
+  801d37:	e8 79 03 00 00       	call   8020b5 <nsipc_send>
+}
+  801d3c:	c9                   	leave
+  801d3d:	c3                   	ret
+
+00801d3e <devsock_read>:
+{
+  801d3e:	55                   	push   %ebp
+  801d3f:	89 e5                	mov    %esp,%ebp
+  801d41:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801d44:	6a 00                	push   $0x0
+  801d46:	ff 75 10             	push   0x10(%ebp)
+  801d49:	ff 75 0c             	push   0xc(%ebp)
+  801d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d4f:	ff 70 0c             	push   0xc(%eax)
+  801d52:	e8 ef 02 00 00       	call   802046 <nsipc_recv>
+}
+  801d57:	c9                   	leave
+  801d58:	c3                   	ret
+
+00801d59 <fd2sockid>:
+{
+  801d59:	55                   	push   %ebp
+  801d5a:	89 e5                	mov    %esp,%ebp
+  801d5c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d5f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d62:	52                   	push   %edx
+  801d63:	50                   	push   %eax
+  801d64:	e8 ea f6 ff ff       	call   801453 <fd_lookup>
+  801d69:	83 c4 10             	add    $0x10,%esp
+  801d6c:	85 c0                	test   %eax,%eax
+  801d6e:	78 10                	js     801d80 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d73:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801d79:	39 08                	cmp    %ecx,(%eax)
+  801d7b:	75 05                	jne    801d82 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d7d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d80:	c9                   	leave
+  801d81:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d82:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d87:	eb f7                	jmp    801d80 <fd2sockid+0x27>
+
+00801d89 <alloc_sockfd>:
+{
+  801d89:	55                   	push   %ebp
+  801d8a:	89 e5                	mov    %esp,%ebp
+  801d8c:	56                   	push   %esi
+  801d8d:	53                   	push   %ebx
+  801d8e:	83 ec 1c             	sub    $0x1c,%esp
+  801d91:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d96:	50                   	push   %eax
+  801d97:	e8 61 f6 ff ff       	call   8013fd <fd_alloc>
+  801d9c:	89 c3                	mov    %eax,%ebx
+  801d9e:	83 c4 10             	add    $0x10,%esp
+  801da1:	85 c0                	test   %eax,%eax
+  801da3:	78 43                	js     801de8 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801da5:	83 ec 04             	sub    $0x4,%esp
+  801da8:	68 07 04 00 00       	push   $0x407
+  801dad:	ff 75 f4             	push   -0xc(%ebp)
+  801db0:	6a 00                	push   $0x0
+  801db2:	e8 ab f0 ff ff       	call   800e62 <sys_page_alloc>
+  801db7:	89 c3                	mov    %eax,%ebx
+  801db9:	83 c4 10             	add    $0x10,%esp
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	78 28                	js     801de8 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801dc0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc3:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801dc9:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801dcb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dce:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801dd5:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801dd8:	83 ec 0c             	sub    $0xc,%esp
+  801ddb:	50                   	push   %eax
+  801ddc:	e8 f5 f5 ff ff       	call   8013d6 <fd2num>
+  801de1:	89 c3                	mov    %eax,%ebx
+  801de3:	83 c4 10             	add    $0x10,%esp
+  801de6:	eb 0c                	jmp    801df4 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801de8:	83 ec 0c             	sub    $0xc,%esp
+  801deb:	56                   	push   %esi
+  801dec:	e8 e4 01 00 00       	call   801fd5 <nsipc_close>
+		return r;
+  801df1:	83 c4 10             	add    $0x10,%esp
+}
+  801df4:	89 d8                	mov    %ebx,%eax
+  801df6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df9:	5b                   	pop    %ebx
+  801dfa:	5e                   	pop    %esi
+  801dfb:	5d                   	pop    %ebp
+  801dfc:	c3                   	ret
+
+00801dfd <accept>:
+{
+  801dfd:	55                   	push   %ebp
+  801dfe:	89 e5                	mov    %esp,%ebp
+  801e00:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e03:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e06:	e8 4e ff ff ff       	call   801d59 <fd2sockid>
+  801e0b:	85 c0                	test   %eax,%eax
+  801e0d:	78 1b                	js     801e2a <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801e0f:	83 ec 04             	sub    $0x4,%esp
+  801e12:	ff 75 10             	push   0x10(%ebp)
+  801e15:	ff 75 0c             	push   0xc(%ebp)
+  801e18:	50                   	push   %eax
+  801e19:	e8 0e 01 00 00       	call   801f2c <nsipc_accept>
+  801e1e:	83 c4 10             	add    $0x10,%esp
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	78 05                	js     801e2a <accept+0x2d>
+	return alloc_sockfd(r);
+  801e25:	e8 5f ff ff ff       	call   801d89 <alloc_sockfd>
+}
+  801e2a:	c9                   	leave
+  801e2b:	c3                   	ret
+
+00801e2c <bind>:
+{
+  801e2c:	55                   	push   %ebp
+  801e2d:	89 e5                	mov    %esp,%ebp
+  801e2f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e35:	e8 1f ff ff ff       	call   801d59 <fd2sockid>
+  801e3a:	85 c0                	test   %eax,%eax
+  801e3c:	78 12                	js     801e50 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e3e:	83 ec 04             	sub    $0x4,%esp
+  801e41:	ff 75 10             	push   0x10(%ebp)
+  801e44:	ff 75 0c             	push   0xc(%ebp)
+  801e47:	50                   	push   %eax
+  801e48:	e8 31 01 00 00       	call   801f7e <nsipc_bind>
+  801e4d:	83 c4 10             	add    $0x10,%esp
+}
+  801e50:	c9                   	leave
+  801e51:	c3                   	ret
+
+00801e52 <shutdown>:
+{
+  801e52:	55                   	push   %ebp
+  801e53:	89 e5                	mov    %esp,%ebp
+  801e55:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e5b:	e8 f9 fe ff ff       	call   801d59 <fd2sockid>
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	78 0f                	js     801e73 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e64:	83 ec 08             	sub    $0x8,%esp
+  801e67:	ff 75 0c             	push   0xc(%ebp)
+  801e6a:	50                   	push   %eax
+  801e6b:	e8 43 01 00 00       	call   801fb3 <nsipc_shutdown>
+  801e70:	83 c4 10             	add    $0x10,%esp
+}
+  801e73:	c9                   	leave
+  801e74:	c3                   	ret
+
+00801e75 <connect>:
+{
+  801e75:	55                   	push   %ebp
+  801e76:	89 e5                	mov    %esp,%ebp
+  801e78:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e7e:	e8 d6 fe ff ff       	call   801d59 <fd2sockid>
+  801e83:	85 c0                	test   %eax,%eax
+  801e85:	78 12                	js     801e99 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e87:	83 ec 04             	sub    $0x4,%esp
+  801e8a:	ff 75 10             	push   0x10(%ebp)
+  801e8d:	ff 75 0c             	push   0xc(%ebp)
+  801e90:	50                   	push   %eax
+  801e91:	e8 59 01 00 00       	call   801fef <nsipc_connect>
+  801e96:	83 c4 10             	add    $0x10,%esp
+}
+  801e99:	c9                   	leave
+  801e9a:	c3                   	ret
+
+00801e9b <listen>:
+{
+  801e9b:	55                   	push   %ebp
+  801e9c:	89 e5                	mov    %esp,%ebp
+  801e9e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ea1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea4:	e8 b0 fe ff ff       	call   801d59 <fd2sockid>
+  801ea9:	85 c0                	test   %eax,%eax
+  801eab:	78 0f                	js     801ebc <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801ead:	83 ec 08             	sub    $0x8,%esp
+  801eb0:	ff 75 0c             	push   0xc(%ebp)
+  801eb3:	50                   	push   %eax
+  801eb4:	e8 6b 01 00 00       	call   802024 <nsipc_listen>
+  801eb9:	83 c4 10             	add    $0x10,%esp
+}
+  801ebc:	c9                   	leave
+  801ebd:	c3                   	ret
+
+00801ebe <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801ebe:	55                   	push   %ebp
+  801ebf:	89 e5                	mov    %esp,%ebp
+  801ec1:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801ec4:	ff 75 10             	push   0x10(%ebp)
+  801ec7:	ff 75 0c             	push   0xc(%ebp)
+  801eca:	ff 75 08             	push   0x8(%ebp)
+  801ecd:	e8 41 02 00 00       	call   802113 <nsipc_socket>
+  801ed2:	83 c4 10             	add    $0x10,%esp
+  801ed5:	85 c0                	test   %eax,%eax
+  801ed7:	78 05                	js     801ede <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801ed9:	e8 ab fe ff ff       	call   801d89 <alloc_sockfd>
+}
+  801ede:	c9                   	leave
+  801edf:	c3                   	ret
+
+00801ee0 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801ee0:	55                   	push   %ebp
+  801ee1:	89 e5                	mov    %esp,%ebp
+  801ee3:	53                   	push   %ebx
+  801ee4:	83 ec 04             	sub    $0x4,%esp
+  801ee7:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801ee9:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801ef0:	74 26                	je     801f18 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801ef2:	6a 07                	push   $0x7
+  801ef4:	68 00 70 80 00       	push   $0x807000
+  801ef9:	53                   	push   %ebx
+  801efa:	ff 35 04 50 80 00    	push   0x805004
+  801f00:	e8 6e 07 00 00       	call   802673 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f05:	83 c4 0c             	add    $0xc,%esp
+  801f08:	6a 00                	push   $0x0
+  801f0a:	6a 00                	push   $0x0
+  801f0c:	6a 00                	push   $0x0
+  801f0e:	e8 e8 06 00 00       	call   8025fb <ipc_recv>
+}
+  801f13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f16:	c9                   	leave
+  801f17:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f18:	83 ec 0c             	sub    $0xc,%esp
+  801f1b:	6a 02                	push   $0x2
+  801f1d:	e8 a5 07 00 00       	call   8026c7 <ipc_find_env>
+  801f22:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	eb c6                	jmp    801ef2 <nsipc+0x12>
+
+00801f2c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801f2c:	55                   	push   %ebp
+  801f2d:	89 e5                	mov    %esp,%ebp
+  801f2f:	56                   	push   %esi
+  801f30:	53                   	push   %ebx
+  801f31:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801f34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f37:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801f3c:	8b 06                	mov    (%esi),%eax
+  801f3e:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801f43:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f48:	e8 93 ff ff ff       	call   801ee0 <nsipc>
+  801f4d:	89 c3                	mov    %eax,%ebx
+  801f4f:	85 c0                	test   %eax,%eax
+  801f51:	79 09                	jns    801f5c <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801f53:	89 d8                	mov    %ebx,%eax
+  801f55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f58:	5b                   	pop    %ebx
+  801f59:	5e                   	pop    %esi
+  801f5a:	5d                   	pop    %ebp
+  801f5b:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801f5c:	83 ec 04             	sub    $0x4,%esp
+  801f5f:	ff 35 10 70 80 00    	push   0x807010
+  801f65:	68 00 70 80 00       	push   $0x807000
+  801f6a:	ff 75 0c             	push   0xc(%ebp)
+  801f6d:	e8 09 ec ff ff       	call   800b7b <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f72:	a1 10 70 80 00       	mov    0x807010,%eax
+  801f77:	89 06                	mov    %eax,(%esi)
+  801f79:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f7c:	eb d5                	jmp    801f53 <nsipc_accept+0x27>
+
+00801f7e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f7e:	55                   	push   %ebp
+  801f7f:	89 e5                	mov    %esp,%ebp
+  801f81:	53                   	push   %ebx
+  801f82:	83 ec 08             	sub    $0x8,%esp
+  801f85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f88:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8b:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f90:	53                   	push   %ebx
+  801f91:	ff 75 0c             	push   0xc(%ebp)
+  801f94:	68 04 70 80 00       	push   $0x807004
+  801f99:	e8 dd eb ff ff       	call   800b7b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f9e:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801fa4:	b8 02 00 00 00       	mov    $0x2,%eax
+  801fa9:	e8 32 ff ff ff       	call   801ee0 <nsipc>
+}
+  801fae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb1:	c9                   	leave
+  801fb2:	c3                   	ret
+
+00801fb3 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801fb3:	55                   	push   %ebp
+  801fb4:	89 e5                	mov    %esp,%ebp
+  801fb6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801fb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbc:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801fc1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc4:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801fc9:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fce:	e8 0d ff ff ff       	call   801ee0 <nsipc>
+}
+  801fd3:	c9                   	leave
+  801fd4:	c3                   	ret
+
+00801fd5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801fd5:	55                   	push   %ebp
+  801fd6:	89 e5                	mov    %esp,%ebp
+  801fd8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801fdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fde:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801fe3:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fe8:	e8 f3 fe ff ff       	call   801ee0 <nsipc>
+}
+  801fed:	c9                   	leave
+  801fee:	c3                   	ret
+
+00801fef <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801fef:	55                   	push   %ebp
+  801ff0:	89 e5                	mov    %esp,%ebp
+  801ff2:	53                   	push   %ebx
+  801ff3:	83 ec 08             	sub    $0x8,%esp
+  801ff6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801ff9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ffc:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802001:	53                   	push   %ebx
+  802002:	ff 75 0c             	push   0xc(%ebp)
+  802005:	68 04 70 80 00       	push   $0x807004
+  80200a:	e8 6c eb ff ff       	call   800b7b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80200f:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802015:	b8 05 00 00 00       	mov    $0x5,%eax
+  80201a:	e8 c1 fe ff ff       	call   801ee0 <nsipc>
+}
+  80201f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802022:	c9                   	leave
+  802023:	c3                   	ret
+
+00802024 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802024:	55                   	push   %ebp
+  802025:	89 e5                	mov    %esp,%ebp
+  802027:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80202a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80202d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802032:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802035:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80203a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80203f:	e8 9c fe ff ff       	call   801ee0 <nsipc>
+}
+  802044:	c9                   	leave
+  802045:	c3                   	ret
+
+00802046 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802046:	55                   	push   %ebp
+  802047:	89 e5                	mov    %esp,%ebp
+  802049:	56                   	push   %esi
+  80204a:	53                   	push   %ebx
+  80204b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80204e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802051:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802056:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80205c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80205f:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802064:	b8 07 00 00 00       	mov    $0x7,%eax
+  802069:	e8 72 fe ff ff       	call   801ee0 <nsipc>
+  80206e:	89 c3                	mov    %eax,%ebx
+  802070:	85 c0                	test   %eax,%eax
+  802072:	78 22                	js     802096 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802074:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802079:	39 c6                	cmp    %eax,%esi
+  80207b:	0f 4e c6             	cmovle %esi,%eax
+  80207e:	39 c3                	cmp    %eax,%ebx
+  802080:	7f 1d                	jg     80209f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802082:	83 ec 04             	sub    $0x4,%esp
+  802085:	53                   	push   %ebx
+  802086:	68 00 70 80 00       	push   $0x807000
+  80208b:	ff 75 0c             	push   0xc(%ebp)
+  80208e:	e8 e8 ea ff ff       	call   800b7b <memmove>
+  802093:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802096:	89 d8                	mov    %ebx,%eax
+  802098:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80209b:	5b                   	pop    %ebx
+  80209c:	5e                   	pop    %esi
+  80209d:	5d                   	pop    %ebp
+  80209e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80209f:	68 1b 30 80 00       	push   $0x80301b
+  8020a4:	68 e3 2f 80 00       	push   $0x802fe3
+  8020a9:	6a 62                	push   $0x62
+  8020ab:	68 30 30 80 00       	push   $0x803030
+  8020b0:	e8 77 e2 ff ff       	call   80032c <_panic>
+
+008020b5 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8020b5:	55                   	push   %ebp
+  8020b6:	89 e5                	mov    %esp,%ebp
+  8020b8:	53                   	push   %ebx
+  8020b9:	83 ec 04             	sub    $0x4,%esp
+  8020bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8020bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c2:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8020c7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8020cd:	7f 2e                	jg     8020fd <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8020cf:	83 ec 04             	sub    $0x4,%esp
+  8020d2:	53                   	push   %ebx
+  8020d3:	ff 75 0c             	push   0xc(%ebp)
+  8020d6:	68 0c 70 80 00       	push   $0x80700c
+  8020db:	e8 9b ea ff ff       	call   800b7b <memmove>
+	nsipcbuf.send.req_size = size;
+  8020e0:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8020e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020e9:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8020ee:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020f3:	e8 e8 fd ff ff       	call   801ee0 <nsipc>
+}
+  8020f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020fb:	c9                   	leave
+  8020fc:	c3                   	ret
+	assert(size < 1600);
+  8020fd:	68 3c 30 80 00       	push   $0x80303c
+  802102:	68 e3 2f 80 00       	push   $0x802fe3
+  802107:	6a 6d                	push   $0x6d
+  802109:	68 30 30 80 00       	push   $0x803030
+  80210e:	e8 19 e2 ff ff       	call   80032c <_panic>
+
+00802113 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802113:	55                   	push   %ebp
+  802114:	89 e5                	mov    %esp,%ebp
+  802116:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802119:	8b 45 08             	mov    0x8(%ebp),%eax
+  80211c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802121:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802124:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802129:	8b 45 10             	mov    0x10(%ebp),%eax
+  80212c:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802131:	b8 09 00 00 00       	mov    $0x9,%eax
+  802136:	e8 a5 fd ff ff       	call   801ee0 <nsipc>
+}
+  80213b:	c9                   	leave
+  80213c:	c3                   	ret
+
+0080213d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80213d:	55                   	push   %ebp
+  80213e:	89 e5                	mov    %esp,%ebp
+  802140:	56                   	push   %esi
+  802141:	53                   	push   %ebx
+  802142:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802145:	83 ec 0c             	sub    $0xc,%esp
+  802148:	ff 75 08             	push   0x8(%ebp)
+  80214b:	e8 96 f2 ff ff       	call   8013e6 <fd2data>
+  802150:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802152:	83 c4 08             	add    $0x8,%esp
+  802155:	68 48 30 80 00       	push   $0x803048
+  80215a:	53                   	push   %ebx
+  80215b:	e8 95 e8 ff ff       	call   8009f5 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802160:	8b 46 04             	mov    0x4(%esi),%eax
+  802163:	2b 06                	sub    (%esi),%eax
+  802165:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80216b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802172:	00 00 00 
+	stat->st_dev = &devpipe;
+  802175:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80217c:	40 80 00 
+	return 0;
+}
+  80217f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802184:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802187:	5b                   	pop    %ebx
+  802188:	5e                   	pop    %esi
+  802189:	5d                   	pop    %ebp
+  80218a:	c3                   	ret
+
+0080218b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80218b:	55                   	push   %ebp
+  80218c:	89 e5                	mov    %esp,%ebp
+  80218e:	53                   	push   %ebx
+  80218f:	83 ec 0c             	sub    $0xc,%esp
+  802192:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802195:	53                   	push   %ebx
+  802196:	6a 00                	push   $0x0
+  802198:	e8 8d ed ff ff       	call   800f2a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80219d:	89 1c 24             	mov    %ebx,(%esp)
+  8021a0:	e8 41 f2 ff ff       	call   8013e6 <fd2data>
+  8021a5:	83 c4 08             	add    $0x8,%esp
+  8021a8:	50                   	push   %eax
+  8021a9:	6a 00                	push   $0x0
+  8021ab:	e8 7a ed ff ff       	call   800f2a <sys_page_unmap>
+}
+  8021b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b3:	c9                   	leave
+  8021b4:	c3                   	ret
+
+008021b5 <_pipeisclosed>:
+{
+  8021b5:	55                   	push   %ebp
+  8021b6:	89 e5                	mov    %esp,%ebp
+  8021b8:	57                   	push   %edi
+  8021b9:	56                   	push   %esi
+  8021ba:	53                   	push   %ebx
+  8021bb:	83 ec 1c             	sub    $0x1c,%esp
+  8021be:	89 c7                	mov    %eax,%edi
+  8021c0:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8021c2:	a1 20 54 80 00       	mov    0x805420,%eax
+  8021c7:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8021ca:	83 ec 0c             	sub    $0xc,%esp
+  8021cd:	57                   	push   %edi
+  8021ce:	e8 04 05 00 00       	call   8026d7 <pageref>
+  8021d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021d6:	89 34 24             	mov    %esi,(%esp)
+  8021d9:	e8 f9 04 00 00       	call   8026d7 <pageref>
+		nn = thisenv->env_runs;
+  8021de:	8b 15 20 54 80 00    	mov    0x805420,%edx
+  8021e4:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8021e7:	83 c4 10             	add    $0x10,%esp
+  8021ea:	39 cb                	cmp    %ecx,%ebx
+  8021ec:	74 1b                	je     802209 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8021ee:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021f1:	75 cf                	jne    8021c2 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8021f3:	8b 42 5c             	mov    0x5c(%edx),%eax
+  8021f6:	6a 01                	push   $0x1
+  8021f8:	50                   	push   %eax
+  8021f9:	53                   	push   %ebx
+  8021fa:	68 4f 30 80 00       	push   $0x80304f
+  8021ff:	e8 03 e2 ff ff       	call   800407 <cprintf>
+  802204:	83 c4 10             	add    $0x10,%esp
+  802207:	eb b9                	jmp    8021c2 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802209:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80220c:	0f 94 c0             	sete   %al
+  80220f:	0f b6 c0             	movzbl %al,%eax
+}
+  802212:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802215:	5b                   	pop    %ebx
+  802216:	5e                   	pop    %esi
+  802217:	5f                   	pop    %edi
+  802218:	5d                   	pop    %ebp
+  802219:	c3                   	ret
+
+0080221a <devpipe_write>:
+{
+  80221a:	55                   	push   %ebp
+  80221b:	89 e5                	mov    %esp,%ebp
+  80221d:	57                   	push   %edi
+  80221e:	56                   	push   %esi
+  80221f:	53                   	push   %ebx
+  802220:	83 ec 28             	sub    $0x28,%esp
+  802223:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802226:	56                   	push   %esi
+  802227:	e8 ba f1 ff ff       	call   8013e6 <fd2data>
+  80222c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80222e:	83 c4 10             	add    $0x10,%esp
+  802231:	bf 00 00 00 00       	mov    $0x0,%edi
+  802236:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802239:	75 09                	jne    802244 <devpipe_write+0x2a>
+	return i;
+  80223b:	89 f8                	mov    %edi,%eax
+  80223d:	eb 23                	jmp    802262 <devpipe_write+0x48>
+			sys_yield();
+  80223f:	e8 9e eb ff ff       	call   800de2 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802244:	8b 43 04             	mov    0x4(%ebx),%eax
+  802247:	8b 0b                	mov    (%ebx),%ecx
+  802249:	8d 51 20             	lea    0x20(%ecx),%edx
+  80224c:	39 d0                	cmp    %edx,%eax
+  80224e:	72 1a                	jb     80226a <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802250:	89 da                	mov    %ebx,%edx
+  802252:	89 f0                	mov    %esi,%eax
+  802254:	e8 5c ff ff ff       	call   8021b5 <_pipeisclosed>
+  802259:	85 c0                	test   %eax,%eax
+  80225b:	74 e2                	je     80223f <devpipe_write+0x25>
+				return 0;
+  80225d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802265:	5b                   	pop    %ebx
+  802266:	5e                   	pop    %esi
+  802267:	5f                   	pop    %edi
+  802268:	5d                   	pop    %ebp
+  802269:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80226a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80226d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802271:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802274:	89 c2                	mov    %eax,%edx
+  802276:	c1 fa 1f             	sar    $0x1f,%edx
+  802279:	89 d1                	mov    %edx,%ecx
+  80227b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80227e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802281:	83 e2 1f             	and    $0x1f,%edx
+  802284:	29 ca                	sub    %ecx,%edx
+  802286:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80228a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80228e:	83 c0 01             	add    $0x1,%eax
+  802291:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802294:	83 c7 01             	add    $0x1,%edi
+  802297:	eb 9d                	jmp    802236 <devpipe_write+0x1c>
+
+00802299 <devpipe_read>:
+{
+  802299:	55                   	push   %ebp
+  80229a:	89 e5                	mov    %esp,%ebp
+  80229c:	57                   	push   %edi
+  80229d:	56                   	push   %esi
+  80229e:	53                   	push   %ebx
+  80229f:	83 ec 18             	sub    $0x18,%esp
+  8022a2:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8022a5:	57                   	push   %edi
+  8022a6:	e8 3b f1 ff ff       	call   8013e6 <fd2data>
+  8022ab:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8022ad:	83 c4 10             	add    $0x10,%esp
+  8022b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022b8:	75 13                	jne    8022cd <devpipe_read+0x34>
+	return i;
+  8022ba:	89 f0                	mov    %esi,%eax
+  8022bc:	eb 02                	jmp    8022c0 <devpipe_read+0x27>
+				return i;
+  8022be:	89 f0                	mov    %esi,%eax
+}
+  8022c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c3:	5b                   	pop    %ebx
+  8022c4:	5e                   	pop    %esi
+  8022c5:	5f                   	pop    %edi
+  8022c6:	5d                   	pop    %ebp
+  8022c7:	c3                   	ret
+			sys_yield();
+  8022c8:	e8 15 eb ff ff       	call   800de2 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8022cd:	8b 03                	mov    (%ebx),%eax
+  8022cf:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8022d2:	75 18                	jne    8022ec <devpipe_read+0x53>
+			if (i > 0)
+  8022d4:	85 f6                	test   %esi,%esi
+  8022d6:	75 e6                	jne    8022be <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8022d8:	89 da                	mov    %ebx,%edx
+  8022da:	89 f8                	mov    %edi,%eax
+  8022dc:	e8 d4 fe ff ff       	call   8021b5 <_pipeisclosed>
+  8022e1:	85 c0                	test   %eax,%eax
+  8022e3:	74 e3                	je     8022c8 <devpipe_read+0x2f>
+				return 0;
+  8022e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ea:	eb d4                	jmp    8022c0 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8022ec:	99                   	cltd
+  8022ed:	c1 ea 1b             	shr    $0x1b,%edx
+  8022f0:	01 d0                	add    %edx,%eax
+  8022f2:	83 e0 1f             	and    $0x1f,%eax
+  8022f5:	29 d0                	sub    %edx,%eax
+  8022f7:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8022fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022ff:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802302:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802305:	83 c6 01             	add    $0x1,%esi
+  802308:	eb ab                	jmp    8022b5 <devpipe_read+0x1c>
+
+0080230a <pipe>:
+{
+  80230a:	55                   	push   %ebp
+  80230b:	89 e5                	mov    %esp,%ebp
+  80230d:	56                   	push   %esi
+  80230e:	53                   	push   %ebx
+  80230f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802312:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802315:	50                   	push   %eax
+  802316:	e8 e2 f0 ff ff       	call   8013fd <fd_alloc>
+  80231b:	89 c3                	mov    %eax,%ebx
+  80231d:	83 c4 10             	add    $0x10,%esp
+  802320:	85 c0                	test   %eax,%eax
+  802322:	0f 88 23 01 00 00    	js     80244b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802328:	83 ec 04             	sub    $0x4,%esp
+  80232b:	68 07 04 00 00       	push   $0x407
+  802330:	ff 75 f4             	push   -0xc(%ebp)
+  802333:	6a 00                	push   $0x0
+  802335:	e8 28 eb ff ff       	call   800e62 <sys_page_alloc>
+  80233a:	89 c3                	mov    %eax,%ebx
+  80233c:	83 c4 10             	add    $0x10,%esp
+  80233f:	85 c0                	test   %eax,%eax
+  802341:	0f 88 04 01 00 00    	js     80244b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802347:	83 ec 0c             	sub    $0xc,%esp
+  80234a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80234d:	50                   	push   %eax
+  80234e:	e8 aa f0 ff ff       	call   8013fd <fd_alloc>
+  802353:	89 c3                	mov    %eax,%ebx
+  802355:	83 c4 10             	add    $0x10,%esp
+  802358:	85 c0                	test   %eax,%eax
+  80235a:	0f 88 db 00 00 00    	js     80243b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802360:	83 ec 04             	sub    $0x4,%esp
+  802363:	68 07 04 00 00       	push   $0x407
+  802368:	ff 75 f0             	push   -0x10(%ebp)
+  80236b:	6a 00                	push   $0x0
+  80236d:	e8 f0 ea ff ff       	call   800e62 <sys_page_alloc>
+  802372:	89 c3                	mov    %eax,%ebx
+  802374:	83 c4 10             	add    $0x10,%esp
+  802377:	85 c0                	test   %eax,%eax
+  802379:	0f 88 bc 00 00 00    	js     80243b <pipe+0x131>
+	va = fd2data(fd0);
+  80237f:	83 ec 0c             	sub    $0xc,%esp
+  802382:	ff 75 f4             	push   -0xc(%ebp)
+  802385:	e8 5c f0 ff ff       	call   8013e6 <fd2data>
+  80238a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80238c:	83 c4 0c             	add    $0xc,%esp
+  80238f:	68 07 04 00 00       	push   $0x407
+  802394:	50                   	push   %eax
+  802395:	6a 00                	push   $0x0
+  802397:	e8 c6 ea ff ff       	call   800e62 <sys_page_alloc>
+  80239c:	89 c3                	mov    %eax,%ebx
+  80239e:	83 c4 10             	add    $0x10,%esp
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	0f 88 82 00 00 00    	js     80242b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023a9:	83 ec 0c             	sub    $0xc,%esp
+  8023ac:	ff 75 f0             	push   -0x10(%ebp)
+  8023af:	e8 32 f0 ff ff       	call   8013e6 <fd2data>
+  8023b4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8023bb:	50                   	push   %eax
+  8023bc:	6a 00                	push   $0x0
+  8023be:	56                   	push   %esi
+  8023bf:	6a 00                	push   $0x0
+  8023c1:	e8 22 eb ff ff       	call   800ee8 <sys_page_map>
+  8023c6:	89 c3                	mov    %eax,%ebx
+  8023c8:	83 c4 20             	add    $0x20,%esp
+  8023cb:	85 c0                	test   %eax,%eax
+  8023cd:	78 4e                	js     80241d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8023cf:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8023d4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023d7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8023d9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023dc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8023e3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8023e6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8023e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8023eb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8023f2:	83 ec 0c             	sub    $0xc,%esp
+  8023f5:	ff 75 f4             	push   -0xc(%ebp)
+  8023f8:	e8 d9 ef ff ff       	call   8013d6 <fd2num>
+  8023fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802400:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802402:	83 c4 04             	add    $0x4,%esp
+  802405:	ff 75 f0             	push   -0x10(%ebp)
+  802408:	e8 c9 ef ff ff       	call   8013d6 <fd2num>
+  80240d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802410:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802413:	83 c4 10             	add    $0x10,%esp
+  802416:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80241b:	eb 2e                	jmp    80244b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80241d:	83 ec 08             	sub    $0x8,%esp
+  802420:	56                   	push   %esi
+  802421:	6a 00                	push   $0x0
+  802423:	e8 02 eb ff ff       	call   800f2a <sys_page_unmap>
+  802428:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80242b:	83 ec 08             	sub    $0x8,%esp
+  80242e:	ff 75 f0             	push   -0x10(%ebp)
+  802431:	6a 00                	push   $0x0
+  802433:	e8 f2 ea ff ff       	call   800f2a <sys_page_unmap>
+  802438:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80243b:	83 ec 08             	sub    $0x8,%esp
+  80243e:	ff 75 f4             	push   -0xc(%ebp)
+  802441:	6a 00                	push   $0x0
+  802443:	e8 e2 ea ff ff       	call   800f2a <sys_page_unmap>
+  802448:	83 c4 10             	add    $0x10,%esp
+}
+  80244b:	89 d8                	mov    %ebx,%eax
+  80244d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802450:	5b                   	pop    %ebx
+  802451:	5e                   	pop    %esi
+  802452:	5d                   	pop    %ebp
+  802453:	c3                   	ret
+
+00802454 <pipeisclosed>:
+{
+  802454:	55                   	push   %ebp
+  802455:	89 e5                	mov    %esp,%ebp
+  802457:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80245a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80245d:	50                   	push   %eax
+  80245e:	ff 75 08             	push   0x8(%ebp)
+  802461:	e8 ed ef ff ff       	call   801453 <fd_lookup>
+  802466:	83 c4 10             	add    $0x10,%esp
+  802469:	85 c0                	test   %eax,%eax
+  80246b:	78 18                	js     802485 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80246d:	83 ec 0c             	sub    $0xc,%esp
+  802470:	ff 75 f4             	push   -0xc(%ebp)
+  802473:	e8 6e ef ff ff       	call   8013e6 <fd2data>
+  802478:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80247a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80247d:	e8 33 fd ff ff       	call   8021b5 <_pipeisclosed>
+  802482:	83 c4 10             	add    $0x10,%esp
+}
+  802485:	c9                   	leave
+  802486:	c3                   	ret
+
+00802487 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80248c:	c3                   	ret
+
+0080248d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80248d:	55                   	push   %ebp
+  80248e:	89 e5                	mov    %esp,%ebp
+  802490:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802493:	68 67 30 80 00       	push   $0x803067
+  802498:	ff 75 0c             	push   0xc(%ebp)
+  80249b:	e8 55 e5 ff ff       	call   8009f5 <strcpy>
+	return 0;
+}
+  8024a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a5:	c9                   	leave
+  8024a6:	c3                   	ret
+
+008024a7 <devcons_write>:
+{
+  8024a7:	55                   	push   %ebp
+  8024a8:	89 e5                	mov    %esp,%ebp
+  8024aa:	57                   	push   %edi
+  8024ab:	56                   	push   %esi
+  8024ac:	53                   	push   %ebx
+  8024ad:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8024b3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8024b8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8024be:	eb 2e                	jmp    8024ee <devcons_write+0x47>
+		m = n - tot;
+  8024c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8024c3:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8024c5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8024ca:	39 c3                	cmp    %eax,%ebx
+  8024cc:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8024cf:	83 ec 04             	sub    $0x4,%esp
+  8024d2:	53                   	push   %ebx
+  8024d3:	89 f0                	mov    %esi,%eax
+  8024d5:	03 45 0c             	add    0xc(%ebp),%eax
+  8024d8:	50                   	push   %eax
+  8024d9:	57                   	push   %edi
+  8024da:	e8 9c e6 ff ff       	call   800b7b <memmove>
+		sys_cputs(buf, m);
+  8024df:	83 c4 08             	add    $0x8,%esp
+  8024e2:	53                   	push   %ebx
+  8024e3:	57                   	push   %edi
+  8024e4:	e8 3c e8 ff ff       	call   800d25 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8024e9:	01 de                	add    %ebx,%esi
+  8024eb:	83 c4 10             	add    $0x10,%esp
+  8024ee:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8024f1:	72 cd                	jb     8024c0 <devcons_write+0x19>
+}
+  8024f3:	89 f0                	mov    %esi,%eax
+  8024f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024f8:	5b                   	pop    %ebx
+  8024f9:	5e                   	pop    %esi
+  8024fa:	5f                   	pop    %edi
+  8024fb:	5d                   	pop    %ebp
+  8024fc:	c3                   	ret
+
+008024fd <devcons_read>:
+{
+  8024fd:	55                   	push   %ebp
+  8024fe:	89 e5                	mov    %esp,%ebp
+  802500:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802503:	b8 00 00 00 00       	mov    $0x0,%eax
+  802508:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80250c:	75 07                	jne    802515 <devcons_read+0x18>
+  80250e:	eb 1f                	jmp    80252f <devcons_read+0x32>
+		sys_yield();
+  802510:	e8 cd e8 ff ff       	call   800de2 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802515:	e8 29 e8 ff ff       	call   800d43 <sys_cgetc>
+  80251a:	85 c0                	test   %eax,%eax
+  80251c:	74 f2                	je     802510 <devcons_read+0x13>
+	if (c < 0)
+  80251e:	78 0f                	js     80252f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802520:	83 f8 04             	cmp    $0x4,%eax
+  802523:	74 0c                	je     802531 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802525:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802528:	88 02                	mov    %al,(%edx)
+	return 1;
+  80252a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80252f:	c9                   	leave
+  802530:	c3                   	ret
+		return 0;
+  802531:	b8 00 00 00 00       	mov    $0x0,%eax
+  802536:	eb f7                	jmp    80252f <devcons_read+0x32>
+
+00802538 <cputchar>:
+{
+  802538:	55                   	push   %ebp
+  802539:	89 e5                	mov    %esp,%ebp
+  80253b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80253e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802541:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802544:	6a 01                	push   $0x1
+  802546:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802549:	50                   	push   %eax
+  80254a:	e8 d6 e7 ff ff       	call   800d25 <sys_cputs>
+}
+  80254f:	83 c4 10             	add    $0x10,%esp
+  802552:	c9                   	leave
+  802553:	c3                   	ret
+
+00802554 <getchar>:
+{
+  802554:	55                   	push   %ebp
+  802555:	89 e5                	mov    %esp,%ebp
+  802557:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80255a:	6a 01                	push   $0x1
+  80255c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80255f:	50                   	push   %eax
+  802560:	6a 00                	push   $0x0
+  802562:	e8 52 f1 ff ff       	call   8016b9 <read>
+	if (r < 0)
+  802567:	83 c4 10             	add    $0x10,%esp
+  80256a:	85 c0                	test   %eax,%eax
+  80256c:	78 06                	js     802574 <getchar+0x20>
+	if (r < 1)
+  80256e:	74 06                	je     802576 <getchar+0x22>
+	return c;
+  802570:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802574:	c9                   	leave
+  802575:	c3                   	ret
+		return -E_EOF;
+  802576:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80257b:	eb f7                	jmp    802574 <getchar+0x20>
+
+0080257d <iscons>:
+{
+  80257d:	55                   	push   %ebp
+  80257e:	89 e5                	mov    %esp,%ebp
+  802580:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802583:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802586:	50                   	push   %eax
+  802587:	ff 75 08             	push   0x8(%ebp)
+  80258a:	e8 c4 ee ff ff       	call   801453 <fd_lookup>
+  80258f:	83 c4 10             	add    $0x10,%esp
+  802592:	85 c0                	test   %eax,%eax
+  802594:	78 11                	js     8025a7 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802596:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802599:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80259f:	39 10                	cmp    %edx,(%eax)
+  8025a1:	0f 94 c0             	sete   %al
+  8025a4:	0f b6 c0             	movzbl %al,%eax
+}
+  8025a7:	c9                   	leave
+  8025a8:	c3                   	ret
+
+008025a9 <opencons>:
+{
+  8025a9:	55                   	push   %ebp
+  8025aa:	89 e5                	mov    %esp,%ebp
+  8025ac:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8025af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025b2:	50                   	push   %eax
+  8025b3:	e8 45 ee ff ff       	call   8013fd <fd_alloc>
+  8025b8:	83 c4 10             	add    $0x10,%esp
+  8025bb:	85 c0                	test   %eax,%eax
+  8025bd:	78 3a                	js     8025f9 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8025bf:	83 ec 04             	sub    $0x4,%esp
+  8025c2:	68 07 04 00 00       	push   $0x407
+  8025c7:	ff 75 f4             	push   -0xc(%ebp)
+  8025ca:	6a 00                	push   $0x0
+  8025cc:	e8 91 e8 ff ff       	call   800e62 <sys_page_alloc>
+  8025d1:	83 c4 10             	add    $0x10,%esp
+  8025d4:	85 c0                	test   %eax,%eax
+  8025d6:	78 21                	js     8025f9 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8025d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025db:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8025e1:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8025e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025e6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8025ed:	83 ec 0c             	sub    $0xc,%esp
+  8025f0:	50                   	push   %eax
+  8025f1:	e8 e0 ed ff ff       	call   8013d6 <fd2num>
+  8025f6:	83 c4 10             	add    $0x10,%esp
+}
+  8025f9:	c9                   	leave
+  8025fa:	c3                   	ret
+
+008025fb <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8025fb:	55                   	push   %ebp
+  8025fc:	89 e5                	mov    %esp,%ebp
+  8025fe:	57                   	push   %edi
+  8025ff:	56                   	push   %esi
+  802600:	53                   	push   %ebx
+  802601:	83 ec 18             	sub    $0x18,%esp
+  802604:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802607:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80260a:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80260d:	85 db                	test   %ebx,%ebx
+  80260f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802614:	0f 45 c3             	cmovne %ebx,%eax
+  802617:	50                   	push   %eax
+  802618:	e8 c8 eb ff ff       	call   8011e5 <sys_ipc_recv>
+
+	if (from_env_store)
+  80261d:	83 c4 10             	add    $0x10,%esp
+  802620:	85 ff                	test   %edi,%edi
+  802622:	74 17                	je     80263b <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802624:	ba 00 00 00 00       	mov    $0x0,%edx
+  802629:	85 c0                	test   %eax,%eax
+  80262b:	75 0c                	jne    802639 <ipc_recv+0x3e>
+  80262d:	8b 15 20 54 80 00    	mov    0x805420,%edx
+  802633:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802639:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  80263b:	85 f6                	test   %esi,%esi
+  80263d:	74 2e                	je     80266d <ipc_recv+0x72>
+		if (!r && pg)
+  80263f:	85 c0                	test   %eax,%eax
+  802641:	75 24                	jne    802667 <ipc_recv+0x6c>
+  802643:	85 db                	test   %ebx,%ebx
+  802645:	74 20                	je     802667 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802647:	a1 20 54 80 00       	mov    0x805420,%eax
+  80264c:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802652:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802654:	a1 20 54 80 00       	mov    0x805420,%eax
+  802659:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80265f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802662:	5b                   	pop    %ebx
+  802663:	5e                   	pop    %esi
+  802664:	5f                   	pop    %edi
+  802665:	5d                   	pop    %ebp
+  802666:	c3                   	ret
+			*perm_store = 0;
+  802667:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80266d:	85 c0                	test   %eax,%eax
+  80266f:	75 ee                	jne    80265f <ipc_recv+0x64>
+  802671:	eb e1                	jmp    802654 <ipc_recv+0x59>
+
+00802673 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802673:	55                   	push   %ebp
+  802674:	89 e5                	mov    %esp,%ebp
+  802676:	57                   	push   %edi
+  802677:	56                   	push   %esi
+  802678:	53                   	push   %ebx
+  802679:	83 ec 0c             	sub    $0xc,%esp
+  80267c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80267f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802682:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802685:	85 db                	test   %ebx,%ebx
+  802687:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80268c:	0f 44 d8             	cmove  %eax,%ebx
+  80268f:	ff 75 14             	push   0x14(%ebp)
+  802692:	53                   	push   %ebx
+  802693:	56                   	push   %esi
+  802694:	57                   	push   %edi
+  802695:	e8 28 eb ff ff       	call   8011c2 <sys_ipc_try_send_yield>
+  80269a:	83 c4 10             	add    $0x10,%esp
+  80269d:	85 c0                	test   %eax,%eax
+  80269f:	79 1e                	jns    8026bf <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8026a1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8026a4:	75 07                	jne    8026ad <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8026a6:	e8 37 e7 ff ff       	call   800de2 <sys_yield>
+  8026ab:	eb e2                	jmp    80268f <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8026ad:	50                   	push   %eax
+  8026ae:	68 73 30 80 00       	push   $0x803073
+  8026b3:	6a 3d                	push   $0x3d
+  8026b5:	68 88 30 80 00       	push   $0x803088
+  8026ba:	e8 6d dc ff ff       	call   80032c <_panic>
+	}
+}
+  8026bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c2:	5b                   	pop    %ebx
+  8026c3:	5e                   	pop    %esi
+  8026c4:	5f                   	pop    %edi
+  8026c5:	5d                   	pop    %ebp
+  8026c6:	c3                   	ret
+
+008026c7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8026c7:	55                   	push   %ebp
+  8026c8:	89 e5                	mov    %esp,%ebp
+  8026ca:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8026cd:	ff 75 08             	push   0x8(%ebp)
+  8026d0:	e8 8d e6 ff ff       	call   800d62 <sys_env_find>
+}
+  8026d5:	c9                   	leave
+  8026d6:	c3                   	ret
+
+008026d7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8026d7:	55                   	push   %ebp
+  8026d8:	89 e5                	mov    %esp,%ebp
+  8026da:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8026dd:	89 c2                	mov    %eax,%edx
+  8026df:	c1 ea 16             	shr    $0x16,%edx
+  8026e2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8026e9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8026ee:	f6 c1 01             	test   $0x1,%cl
+  8026f1:	74 22                	je     802715 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8026f3:	c1 e8 0c             	shr    $0xc,%eax
+  8026f6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8026fd:	a8 01                	test   $0x1,%al
+  8026ff:	74 14                	je     802715 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802701:	c1 e8 0c             	shr    $0xc,%eax
+  802704:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802707:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80270e:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802712:	0f b7 d2             	movzwl %dx,%edx
+}
+  802715:	89 d0                	mov    %edx,%eax
+  802717:	5d                   	pop    %ebp
+  802718:	c3                   	ret
+  802719:	66 90                	xchg   %ax,%ax
+  80271b:	66 90                	xchg   %ax,%ax
+  80271d:	66 90                	xchg   %ax,%ax
+  80271f:	90                   	nop
+
+00802720 <__udivmoddi4>:
+  802720:	55                   	push   %ebp
+  802721:	57                   	push   %edi
+  802722:	56                   	push   %esi
+  802723:	53                   	push   %ebx
+  802724:	83 ec 14             	sub    $0x14,%esp
+  802727:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80272b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80272f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802733:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802737:	89 f1                	mov    %esi,%ecx
+  802739:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80273d:	09 d9                	or     %ebx,%ecx
+  80273f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802743:	0f 84 92 00 00 00    	je     8027db <__udivmoddi4+0xbb>
+  802749:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802750:	00 
+  802751:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802756:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80275d:	00 
+  80275e:	89 1c 24             	mov    %ebx,(%esp)
+  802761:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802765:	8d 76 00             	lea    0x0(%esi),%esi
+  802768:	89 e9                	mov    %ebp,%ecx
+  80276a:	89 c3                	mov    %eax,%ebx
+  80276c:	89 d6                	mov    %edx,%esi
+  80276e:	31 ff                	xor    %edi,%edi
+  802770:	d3 ee                	shr    %cl,%esi
+  802772:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802775:	f6 c1 20             	test   $0x20,%cl
+  802778:	0f 45 de             	cmovne %esi,%ebx
+  80277b:	0f 45 f7             	cmovne %edi,%esi
+  80277e:	8b 3c 24             	mov    (%esp),%edi
+  802781:	39 fb                	cmp    %edi,%ebx
+  802783:	89 f7                	mov    %esi,%edi
+  802785:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802789:	8b 1c 24             	mov    (%esp),%ebx
+  80278c:	19 f7                	sbb    %esi,%edi
+  80278e:	72 39                	jb     8027c9 <__udivmoddi4+0xa9>
+  802790:	89 e9                	mov    %ebp,%ecx
+  802792:	89 f7                	mov    %esi,%edi
+  802794:	89 de                	mov    %ebx,%esi
+  802796:	0f a5 df             	shld   %cl,%ebx,%edi
+  802799:	d3 e6                	shl    %cl,%esi
+  80279b:	31 db                	xor    %ebx,%ebx
+  80279d:	f6 c1 20             	test   $0x20,%cl
+  8027a0:	0f 45 fe             	cmovne %esi,%edi
+  8027a3:	0f 45 f3             	cmovne %ebx,%esi
+  8027a6:	29 f0                	sub    %esi,%eax
+  8027a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8027ad:	19 fa                	sbb    %edi,%edx
+  8027af:	31 ff                	xor    %edi,%edi
+  8027b1:	31 db                	xor    %ebx,%ebx
+  8027b3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8027b6:	d3 e6                	shl    %cl,%esi
+  8027b8:	f6 c1 20             	test   $0x20,%cl
+  8027bb:	0f 45 fe             	cmovne %esi,%edi
+  8027be:	0f 45 f3             	cmovne %ebx,%esi
+  8027c1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8027c5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8027c9:	83 ed 01             	sub    $0x1,%ebp
+  8027cc:	73 9a                	jae    802768 <__udivmoddi4+0x48>
+  8027ce:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8027d2:	85 ff                	test   %edi,%edi
+  8027d4:	74 05                	je     8027db <__udivmoddi4+0xbb>
+  8027d6:	89 07                	mov    %eax,(%edi)
+  8027d8:	89 57 04             	mov    %edx,0x4(%edi)
+  8027db:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027df:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027e3:	83 c4 14             	add    $0x14,%esp
+  8027e6:	5b                   	pop    %ebx
+  8027e7:	5e                   	pop    %esi
+  8027e8:	5f                   	pop    %edi
+  8027e9:	5d                   	pop    %ebp
+  8027ea:	c3                   	ret
+  8027eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8027ef:	90                   	nop
+
+008027f0 <__udivdi3>:
+  8027f0:	55                   	push   %ebp
+  8027f1:	57                   	push   %edi
+  8027f2:	56                   	push   %esi
+  8027f3:	53                   	push   %ebx
+  8027f4:	83 ec 14             	sub    $0x14,%esp
+  8027f7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8027fb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8027ff:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802803:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802807:	89 fb                	mov    %edi,%ebx
+  802809:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80280d:	09 f3                	or     %esi,%ebx
+  80280f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802813:	0f 84 85 00 00 00    	je     80289e <__udivdi3+0xae>
+  802819:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802820:	00 
+  802821:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802826:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80282d:	00 
+  80282e:	89 34 24             	mov    %esi,(%esp)
+  802831:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802835:	8d 76 00             	lea    0x0(%esi),%esi
+  802838:	89 e9                	mov    %ebp,%ecx
+  80283a:	89 c3                	mov    %eax,%ebx
+  80283c:	89 d6                	mov    %edx,%esi
+  80283e:	31 ff                	xor    %edi,%edi
+  802840:	d3 ee                	shr    %cl,%esi
+  802842:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802845:	f6 c1 20             	test   $0x20,%cl
+  802848:	0f 45 de             	cmovne %esi,%ebx
+  80284b:	0f 45 f7             	cmovne %edi,%esi
+  80284e:	8b 3c 24             	mov    (%esp),%edi
+  802851:	39 fb                	cmp    %edi,%ebx
+  802853:	89 f7                	mov    %esi,%edi
+  802855:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802859:	8b 1c 24             	mov    (%esp),%ebx
+  80285c:	19 f7                	sbb    %esi,%edi
+  80285e:	72 39                	jb     802899 <__udivdi3+0xa9>
+  802860:	89 e9                	mov    %ebp,%ecx
+  802862:	89 f7                	mov    %esi,%edi
+  802864:	89 de                	mov    %ebx,%esi
+  802866:	0f a5 df             	shld   %cl,%ebx,%edi
+  802869:	d3 e6                	shl    %cl,%esi
+  80286b:	31 db                	xor    %ebx,%ebx
+  80286d:	f6 c1 20             	test   $0x20,%cl
+  802870:	0f 45 fe             	cmovne %esi,%edi
+  802873:	0f 45 f3             	cmovne %ebx,%esi
+  802876:	29 f0                	sub    %esi,%eax
+  802878:	be 01 00 00 00       	mov    $0x1,%esi
+  80287d:	19 fa                	sbb    %edi,%edx
+  80287f:	31 ff                	xor    %edi,%edi
+  802881:	31 db                	xor    %ebx,%ebx
+  802883:	0f a5 f7             	shld   %cl,%esi,%edi
+  802886:	d3 e6                	shl    %cl,%esi
+  802888:	f6 c1 20             	test   $0x20,%cl
+  80288b:	0f 45 fe             	cmovne %esi,%edi
+  80288e:	0f 45 f3             	cmovne %ebx,%esi
+  802891:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802895:	09 74 24 08          	or     %esi,0x8(%esp)
+  802899:	83 ed 01             	sub    $0x1,%ebp
+  80289c:	73 9a                	jae    802838 <__udivdi3+0x48>
+  80289e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028a2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028a6:	83 c4 14             	add    $0x14,%esp
+  8028a9:	5b                   	pop    %ebx
+  8028aa:	5e                   	pop    %esi
+  8028ab:	5f                   	pop    %edi
+  8028ac:	5d                   	pop    %ebp
+  8028ad:	c3                   	ret
+  8028ae:	66 90                	xchg   %ax,%ax
+
+008028b0 <__umoddi3>:
+  8028b0:	57                   	push   %edi
+  8028b1:	56                   	push   %esi
+  8028b2:	53                   	push   %ebx
+  8028b3:	83 ec 08             	sub    $0x8,%esp
+  8028b6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8028ba:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8028be:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028c2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028c6:	89 f9                	mov    %edi,%ecx
+  8028c8:	89 34 24             	mov    %esi,(%esp)
+  8028cb:	09 f1                	or     %esi,%ecx
+  8028cd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8028d1:	74 53                	je     802926 <__umoddi3+0x76>
+  8028d3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8028d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028df:	90                   	nop
+  8028e0:	89 c6                	mov    %eax,%esi
+  8028e2:	89 d7                	mov    %edx,%edi
+  8028e4:	31 db                	xor    %ebx,%ebx
+  8028e6:	d3 ef                	shr    %cl,%edi
+  8028e8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8028eb:	f6 c1 20             	test   $0x20,%cl
+  8028ee:	0f 45 f7             	cmovne %edi,%esi
+  8028f1:	0f 45 fb             	cmovne %ebx,%edi
+  8028f4:	8b 1c 24             	mov    (%esp),%ebx
+  8028f7:	39 de                	cmp    %ebx,%esi
+  8028f9:	89 fb                	mov    %edi,%ebx
+  8028fb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8028ff:	8b 34 24             	mov    (%esp),%esi
+  802902:	19 fb                	sbb    %edi,%ebx
+  802904:	72 14                	jb     80291a <__umoddi3+0x6a>
+  802906:	0f a5 f7             	shld   %cl,%esi,%edi
+  802909:	31 db                	xor    %ebx,%ebx
+  80290b:	d3 e6                	shl    %cl,%esi
+  80290d:	f6 c1 20             	test   $0x20,%cl
+  802910:	0f 45 fe             	cmovne %esi,%edi
+  802913:	0f 45 f3             	cmovne %ebx,%esi
+  802916:	29 f0                	sub    %esi,%eax
+  802918:	19 fa                	sbb    %edi,%edx
+  80291a:	83 e9 01             	sub    $0x1,%ecx
+  80291d:	73 c1                	jae    8028e0 <__umoddi3+0x30>
+  80291f:	83 c4 08             	add    $0x8,%esp
+  802922:	5b                   	pop    %ebx
+  802923:	5e                   	pop    %esi
+  802924:	5f                   	pop    %edi
+  802925:	c3                   	ret
+  802926:	83 c4 08             	add    $0x8,%esp
+  802929:	31 c0                	xor    %eax,%eax
+  80292b:	31 d2                	xor    %edx,%edx
+  80292d:	5b                   	pop    %ebx
+  80292e:	5e                   	pop    %esi
+  80292f:	5f                   	pop    %edi
+  802930:	c3                   	ret
+  802931:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80293f:	90                   	nop
+
+00802940 <__divdi3>:
+  802940:	55                   	push   %ebp
+  802941:	57                   	push   %edi
+  802942:	56                   	push   %esi
+  802943:	53                   	push   %ebx
+  802944:	83 ec 1c             	sub    $0x1c,%esp
+  802947:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80294b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80294f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802953:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802957:	85 ff                	test   %edi,%edi
+  802959:	0f 88 da 00 00 00    	js     802a39 <__divdi3+0xf9>
+  80295f:	85 db                	test   %ebx,%ebx
+  802961:	78 16                	js     802979 <__divdi3+0x39>
+  802963:	89 dd                	mov    %ebx,%ebp
+  802965:	89 c8                	mov    %ecx,%eax
+  802967:	89 da                	mov    %ebx,%edx
+  802969:	09 cd                	or     %ecx,%ebp
+  80296b:	0f 85 fd 00 00 00    	jne    802a6e <__divdi3+0x12e>
+  802971:	83 c4 1c             	add    $0x1c,%esp
+  802974:	5b                   	pop    %ebx
+  802975:	5e                   	pop    %esi
+  802976:	5f                   	pop    %edi
+  802977:	5d                   	pop    %ebp
+  802978:	c3                   	ret
+  802979:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80297e:	f7 d9                	neg    %ecx
+  802980:	89 f0                	mov    %esi,%eax
+  802982:	89 fa                	mov    %edi,%edx
+  802984:	83 d3 00             	adc    $0x0,%ebx
+  802987:	89 0c 24             	mov    %ecx,(%esp)
+  80298a:	f7 db                	neg    %ebx
+  80298c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802990:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802997:	00 
+  802998:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80299d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8029a4:	00 
+  8029a5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8029a9:	89 cd                	mov    %ecx,%ebp
+  8029ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8029af:	90                   	nop
+  8029b0:	89 e9                	mov    %ebp,%ecx
+  8029b2:	89 c3                	mov    %eax,%ebx
+  8029b4:	89 d6                	mov    %edx,%esi
+  8029b6:	31 ff                	xor    %edi,%edi
+  8029b8:	d3 ee                	shr    %cl,%esi
+  8029ba:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8029bd:	f6 c1 20             	test   $0x20,%cl
+  8029c0:	0f 45 de             	cmovne %esi,%ebx
+  8029c3:	0f 45 f7             	cmovne %edi,%esi
+  8029c6:	8b 3c 24             	mov    (%esp),%edi
+  8029c9:	39 fb                	cmp    %edi,%ebx
+  8029cb:	89 f7                	mov    %esi,%edi
+  8029cd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8029d1:	8b 1c 24             	mov    (%esp),%ebx
+  8029d4:	19 f7                	sbb    %esi,%edi
+  8029d6:	72 39                	jb     802a11 <__divdi3+0xd1>
+  8029d8:	89 e9                	mov    %ebp,%ecx
+  8029da:	89 f7                	mov    %esi,%edi
+  8029dc:	89 de                	mov    %ebx,%esi
+  8029de:	0f a5 df             	shld   %cl,%ebx,%edi
+  8029e1:	d3 e6                	shl    %cl,%esi
+  8029e3:	31 db                	xor    %ebx,%ebx
+  8029e5:	f6 c1 20             	test   $0x20,%cl
+  8029e8:	0f 45 fe             	cmovne %esi,%edi
+  8029eb:	0f 45 f3             	cmovne %ebx,%esi
+  8029ee:	29 f0                	sub    %esi,%eax
+  8029f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8029f5:	19 fa                	sbb    %edi,%edx
+  8029f7:	31 ff                	xor    %edi,%edi
+  8029f9:	31 db                	xor    %ebx,%ebx
+  8029fb:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029fe:	d3 e6                	shl    %cl,%esi
+  802a00:	f6 c1 20             	test   $0x20,%cl
+  802a03:	0f 45 fe             	cmovne %esi,%edi
+  802a06:	0f 45 f3             	cmovne %ebx,%esi
+  802a09:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802a0d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802a11:	83 ed 01             	sub    $0x1,%ebp
+  802a14:	73 9a                	jae    8029b0 <__divdi3+0x70>
+  802a16:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802a1a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802a1e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802a22:	85 ed                	test   %ebp,%ebp
+  802a24:	0f 84 47 ff ff ff    	je     802971 <__divdi3+0x31>
+  802a2a:	f7 d8                	neg    %eax
+  802a2c:	83 d2 00             	adc    $0x0,%edx
+  802a2f:	83 c4 1c             	add    $0x1c,%esp
+  802a32:	5b                   	pop    %ebx
+  802a33:	f7 da                	neg    %edx
+  802a35:	5e                   	pop    %esi
+  802a36:	5f                   	pop    %edi
+  802a37:	5d                   	pop    %ebp
+  802a38:	c3                   	ret
+  802a39:	f7 de                	neg    %esi
+  802a3b:	83 d7 00             	adc    $0x0,%edi
+  802a3e:	f7 df                	neg    %edi
+  802a40:	85 db                	test   %ebx,%ebx
+  802a42:	78 23                	js     802a67 <__divdi3+0x127>
+  802a44:	89 dd                	mov    %ebx,%ebp
+  802a46:	89 c8                	mov    %ecx,%eax
+  802a48:	89 da                	mov    %ebx,%edx
+  802a4a:	09 cd                	or     %ecx,%ebp
+  802a4c:	0f 84 1f ff ff ff    	je     802971 <__divdi3+0x31>
+  802a52:	89 0c 24             	mov    %ecx,(%esp)
+  802a55:	89 f0                	mov    %esi,%eax
+  802a57:	89 fa                	mov    %edi,%edx
+  802a59:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802a5e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a62:	e9 29 ff ff ff       	jmp    802990 <__divdi3+0x50>
+  802a67:	31 ed                	xor    %ebp,%ebp
+  802a69:	e9 10 ff ff ff       	jmp    80297e <__divdi3+0x3e>
+  802a6e:	89 0c 24             	mov    %ecx,(%esp)
+  802a71:	89 f0                	mov    %esi,%eax
+  802a73:	89 fa                	mov    %edi,%edx
+  802a75:	31 ed                	xor    %ebp,%ebp
+  802a77:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a7b:	e9 10 ff ff ff       	jmp    802990 <__divdi3+0x50>
+
+00802a80 <__moddi3>:
+  802a80:	55                   	push   %ebp
+  802a81:	57                   	push   %edi
+  802a82:	56                   	push   %esi
+  802a83:	53                   	push   %ebx
+  802a84:	83 ec 14             	sub    $0x14,%esp
+  802a87:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a8b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a8f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802a93:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802a97:	85 d2                	test   %edx,%edx
+  802a99:	0f 88 9b 00 00 00    	js     802b3a <__moddi3+0xba>
+  802a9f:	89 f7                	mov    %esi,%edi
+  802aa1:	31 ed                	xor    %ebp,%ebp
+  802aa3:	09 cf                	or     %ecx,%edi
+  802aa5:	0f 84 83 00 00 00    	je     802b2e <__moddi3+0xae>
+  802aab:	89 cb                	mov    %ecx,%ebx
+  802aad:	89 f7                	mov    %esi,%edi
+  802aaf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802ab3:	f7 db                	neg    %ebx
+  802ab5:	83 d7 00             	adc    $0x0,%edi
+  802ab8:	f7 df                	neg    %edi
+  802aba:	0f 49 f7             	cmovns %edi,%esi
+  802abd:	0f 49 cb             	cmovns %ebx,%ecx
+  802ac0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802ac4:	89 0c 24             	mov    %ecx,(%esp)
+  802ac7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802acc:	89 cd                	mov    %ecx,%ebp
+  802ace:	66 90                	xchg   %ax,%ax
+  802ad0:	89 e9                	mov    %ebp,%ecx
+  802ad2:	89 c3                	mov    %eax,%ebx
+  802ad4:	89 d6                	mov    %edx,%esi
+  802ad6:	31 ff                	xor    %edi,%edi
+  802ad8:	d3 ee                	shr    %cl,%esi
+  802ada:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802add:	f6 c1 20             	test   $0x20,%cl
+  802ae0:	0f 45 de             	cmovne %esi,%ebx
+  802ae3:	0f 45 f7             	cmovne %edi,%esi
+  802ae6:	8b 3c 24             	mov    (%esp),%edi
+  802ae9:	39 fb                	cmp    %edi,%ebx
+  802aeb:	89 f7                	mov    %esi,%edi
+  802aed:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802af1:	8b 1c 24             	mov    (%esp),%ebx
+  802af4:	19 f7                	sbb    %esi,%edi
+  802af6:	72 1a                	jb     802b12 <__moddi3+0x92>
+  802af8:	89 e9                	mov    %ebp,%ecx
+  802afa:	89 f7                	mov    %esi,%edi
+  802afc:	89 de                	mov    %ebx,%esi
+  802afe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802b01:	d3 e6                	shl    %cl,%esi
+  802b03:	31 db                	xor    %ebx,%ebx
+  802b05:	f6 c1 20             	test   $0x20,%cl
+  802b08:	0f 45 fe             	cmovne %esi,%edi
+  802b0b:	0f 45 f3             	cmovne %ebx,%esi
+  802b0e:	29 f0                	sub    %esi,%eax
+  802b10:	19 fa                	sbb    %edi,%edx
+  802b12:	83 ed 01             	sub    $0x1,%ebp
+  802b15:	73 b9                	jae    802ad0 <__moddi3+0x50>
+  802b17:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802b1b:	85 ed                	test   %ebp,%ebp
+  802b1d:	74 07                	je     802b26 <__moddi3+0xa6>
+  802b1f:	f7 d8                	neg    %eax
+  802b21:	83 d2 00             	adc    $0x0,%edx
+  802b24:	f7 da                	neg    %edx
+  802b26:	83 c4 14             	add    $0x14,%esp
+  802b29:	5b                   	pop    %ebx
+  802b2a:	5e                   	pop    %esi
+  802b2b:	5f                   	pop    %edi
+  802b2c:	5d                   	pop    %ebp
+  802b2d:	c3                   	ret
+  802b2e:	83 c4 14             	add    $0x14,%esp
+  802b31:	31 c0                	xor    %eax,%eax
+  802b33:	31 d2                	xor    %edx,%edx
+  802b35:	5b                   	pop    %ebx
+  802b36:	5e                   	pop    %esi
+  802b37:	5f                   	pop    %edi
+  802b38:	5d                   	pop    %ebp
+  802b39:	c3                   	ret
+  802b3a:	89 f7                	mov    %esi,%edi
+  802b3c:	09 cf                	or     %ecx,%edi
+  802b3e:	74 11                	je     802b51 <__moddi3+0xd1>
+  802b40:	f7 d8                	neg    %eax
+  802b42:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802b47:	83 d2 00             	adc    $0x0,%edx
+  802b4a:	f7 da                	neg    %edx
+  802b4c:	e9 5a ff ff ff       	jmp    802aab <__moddi3+0x2b>
+  802b51:	31 c0                	xor    %eax,%eax
+  802b53:	31 d2                	xor    %edx,%edx
+  802b55:	eb c8                	jmp    802b1f <__moddi3+0x9f>
@@ -0,0 +1,6051 @@
+
+obj/user/lsfd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e0 00 00 00       	call   800111 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: lsfd [-1]\n");
+  800039:	68 a0 29 80 00       	push   $0x8029a0
+  80003e:	e8 c3 01 00 00       	call   800206 <cprintf>
+	exit();
+  800043:	e8 0f 01 00 00       	call   800157 <exit>
+}
+  800048:	83 c4 10             	add    $0x10,%esp
+  80004b:	c9                   	leave
+  80004c:	c3                   	ret
+
+0080004d <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80004d:	55                   	push   %ebp
+  80004e:	89 e5                	mov    %esp,%ebp
+  800050:	57                   	push   %edi
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	81 ec b0 00 00 00    	sub    $0xb0,%esp
+	int i, usefprint = 0;
+	struct Stat st;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800059:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	ff 75 0c             	push   0xc(%ebp)
+  800063:	8d 45 08             	lea    0x8(%ebp),%eax
+  800066:	50                   	push   %eax
+  800067:	e8 1a 10 00 00       	call   801086 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  80006c:	83 c4 10             	add    $0x10,%esp
+	int i, usefprint = 0;
+  80006f:	be 00 00 00 00       	mov    $0x0,%esi
+	while ((i = argnext(&args)) >= 0)
+  800074:	8d 9d 4c ff ff ff    	lea    -0xb4(%ebp),%ebx
+		if (i == '1')
+			usefprint = 1;
+  80007a:	bf 01 00 00 00       	mov    $0x1,%edi
+	while ((i = argnext(&args)) >= 0)
+  80007f:	83 ec 0c             	sub    $0xc,%esp
+  800082:	53                   	push   %ebx
+  800083:	e8 2e 10 00 00       	call   8010b6 <argnext>
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	78 10                	js     80009f <umain+0x52>
+		if (i == '1')
+  80008f:	83 f8 31             	cmp    $0x31,%eax
+  800092:	75 04                	jne    800098 <umain+0x4b>
+			usefprint = 1;
+  800094:	89 fe                	mov    %edi,%esi
+  800096:	eb e7                	jmp    80007f <umain+0x32>
+		else
+			usage();
+  800098:	e8 96 ff ff ff       	call   800033 <usage>
+  80009d:	eb e0                	jmp    80007f <umain+0x32>
+
+	for (i = 0; i < 32; i++)
+  80009f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fstat(i, &st) >= 0) {
+  8000a4:	8d bd 5c ff ff ff    	lea    -0xa4(%ebp),%edi
+  8000aa:	eb 26                	jmp    8000d2 <umain+0x85>
+			if (usefprint)
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+			else
+				cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000ac:	83 ec 08             	sub    $0x8,%esp
+  8000af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000b2:	ff 70 04             	push   0x4(%eax)
+  8000b5:	ff 75 dc             	push   -0x24(%ebp)
+  8000b8:	ff 75 e0             	push   -0x20(%ebp)
+  8000bb:	57                   	push   %edi
+  8000bc:	53                   	push   %ebx
+  8000bd:	68 b4 29 80 00       	push   $0x8029b4
+  8000c2:	e8 3f 01 00 00       	call   800206 <cprintf>
+  8000c7:	83 c4 20             	add    $0x20,%esp
+	for (i = 0; i < 32; i++)
+  8000ca:	83 c3 01             	add    $0x1,%ebx
+  8000cd:	83 fb 20             	cmp    $0x20,%ebx
+  8000d0:	74 37                	je     800109 <umain+0xbc>
+		if (fstat(i, &st) >= 0) {
+  8000d2:	83 ec 08             	sub    $0x8,%esp
+  8000d5:	57                   	push   %edi
+  8000d6:	53                   	push   %ebx
+  8000d7:	e8 d4 15 00 00       	call   8016b0 <fstat>
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	85 c0                	test   %eax,%eax
+  8000e1:	78 e7                	js     8000ca <umain+0x7d>
+			if (usefprint)
+  8000e3:	85 f6                	test   %esi,%esi
+  8000e5:	74 c5                	je     8000ac <umain+0x5f>
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000ed:	ff 70 04             	push   0x4(%eax)
+  8000f0:	ff 75 dc             	push   -0x24(%ebp)
+  8000f3:	ff 75 e0             	push   -0x20(%ebp)
+  8000f6:	57                   	push   %edi
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 b4 29 80 00       	push   $0x8029b4
+  8000fd:	6a 01                	push   $0x1
+  8000ff:	e8 a3 19 00 00       	call   801aa7 <fprintf>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	eb c1                	jmp    8000ca <umain+0x7d>
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+		}
+}
+  800109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+
+00800111 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	56                   	push   %esi
+  800115:	53                   	push   %ebx
+  800116:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800119:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80011c:	e8 a1 0a 00 00       	call   800bc2 <sys_getenvid>
+  800121:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800126:	c1 e0 09             	shl    $0x9,%eax
+  800129:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80012e:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800133:	85 db                	test   %ebx,%ebx
+  800135:	7e 07                	jle    80013e <libmain+0x2d>
+		binaryname = argv[0];
+  800137:	8b 06                	mov    (%esi),%eax
+  800139:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80013e:	83 ec 08             	sub    $0x8,%esp
+  800141:	56                   	push   %esi
+  800142:	53                   	push   %ebx
+  800143:	e8 05 ff ff ff       	call   80004d <umain>
+
+	// exit gracefully
+	exit();
+  800148:	e8 0a 00 00 00       	call   800157 <exit>
+}
+  80014d:	83 c4 10             	add    $0x10,%esp
+  800150:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800153:	5b                   	pop    %ebx
+  800154:	5e                   	pop    %esi
+  800155:	5d                   	pop    %ebp
+  800156:	c3                   	ret
+
+00800157 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800157:	55                   	push   %ebp
+  800158:	89 e5                	mov    %esp,%ebp
+  80015a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80015d:	e8 47 12 00 00       	call   8013a9 <close_all>
+	sys_env_destroy(0);
+  800162:	83 ec 0c             	sub    $0xc,%esp
+  800165:	6a 00                	push   $0x0
+  800167:	e8 15 0a 00 00       	call   800b81 <sys_env_destroy>
+}
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	c9                   	leave
+  800170:	c3                   	ret
+
+00800171 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800171:	55                   	push   %ebp
+  800172:	89 e5                	mov    %esp,%ebp
+  800174:	53                   	push   %ebx
+  800175:	83 ec 04             	sub    $0x4,%esp
+  800178:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80017b:	8b 13                	mov    (%ebx),%edx
+  80017d:	8d 42 01             	lea    0x1(%edx),%eax
+  800180:	89 03                	mov    %eax,(%ebx)
+  800182:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800185:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800189:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80018e:	74 09                	je     800199 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800190:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800194:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800197:	c9                   	leave
+  800198:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800199:	83 ec 08             	sub    $0x8,%esp
+  80019c:	68 ff 00 00 00       	push   $0xff
+  8001a1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a4:	50                   	push   %eax
+  8001a5:	e8 7a 09 00 00       	call   800b24 <sys_cputs>
+		b->idx = 0;
+  8001aa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001b0:	83 c4 10             	add    $0x10,%esp
+  8001b3:	eb db                	jmp    800190 <putch+0x1f>
+
+008001b5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001b5:	55                   	push   %ebp
+  8001b6:	89 e5                	mov    %esp,%ebp
+  8001b8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001be:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c5:	00 00 00 
+	b.cnt = 0;
+  8001c8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001cf:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001d2:	ff 75 0c             	push   0xc(%ebp)
+  8001d5:	ff 75 08             	push   0x8(%ebp)
+  8001d8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001de:	50                   	push   %eax
+  8001df:	68 71 01 80 00       	push   $0x800171
+  8001e4:	e8 14 01 00 00       	call   8002fd <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001e9:	83 c4 08             	add    $0x8,%esp
+  8001ec:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f2:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001f8:	50                   	push   %eax
+  8001f9:	e8 26 09 00 00       	call   800b24 <sys_cputs>
+
+	return b.cnt;
+}
+  8001fe:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800204:	c9                   	leave
+  800205:	c3                   	ret
+
+00800206 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800206:	55                   	push   %ebp
+  800207:	89 e5                	mov    %esp,%ebp
+  800209:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80020c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80020f:	50                   	push   %eax
+  800210:	ff 75 08             	push   0x8(%ebp)
+  800213:	e8 9d ff ff ff       	call   8001b5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800218:	c9                   	leave
+  800219:	c3                   	ret
+
+0080021a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80021a:	55                   	push   %ebp
+  80021b:	89 e5                	mov    %esp,%ebp
+  80021d:	57                   	push   %edi
+  80021e:	56                   	push   %esi
+  80021f:	53                   	push   %ebx
+  800220:	83 ec 1c             	sub    $0x1c,%esp
+  800223:	89 c7                	mov    %eax,%edi
+  800225:	89 d6                	mov    %edx,%esi
+  800227:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80022d:	89 d1                	mov    %edx,%ecx
+  80022f:	89 c2                	mov    %eax,%edx
+  800231:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800234:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800237:	8b 45 10             	mov    0x10(%ebp),%eax
+  80023a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80023d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800240:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800247:	39 c2                	cmp    %eax,%edx
+  800249:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80024c:	72 3e                	jb     80028c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80024e:	83 ec 0c             	sub    $0xc,%esp
+  800251:	ff 75 18             	push   0x18(%ebp)
+  800254:	83 eb 01             	sub    $0x1,%ebx
+  800257:	53                   	push   %ebx
+  800258:	50                   	push   %eax
+  800259:	83 ec 08             	sub    $0x8,%esp
+  80025c:	ff 75 e4             	push   -0x1c(%ebp)
+  80025f:	ff 75 e0             	push   -0x20(%ebp)
+  800262:	ff 75 dc             	push   -0x24(%ebp)
+  800265:	ff 75 d8             	push   -0x28(%ebp)
+  800268:	e8 c3 23 00 00       	call   802630 <__udivdi3>
+  80026d:	83 c4 18             	add    $0x18,%esp
+  800270:	52                   	push   %edx
+  800271:	50                   	push   %eax
+  800272:	89 f2                	mov    %esi,%edx
+  800274:	89 f8                	mov    %edi,%eax
+  800276:	e8 9f ff ff ff       	call   80021a <printnum>
+  80027b:	83 c4 20             	add    $0x20,%esp
+  80027e:	eb 13                	jmp    800293 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800280:	83 ec 08             	sub    $0x8,%esp
+  800283:	56                   	push   %esi
+  800284:	ff 75 18             	push   0x18(%ebp)
+  800287:	ff d7                	call   *%edi
+  800289:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80028c:	83 eb 01             	sub    $0x1,%ebx
+  80028f:	85 db                	test   %ebx,%ebx
+  800291:	7f ed                	jg     800280 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800293:	83 ec 08             	sub    $0x8,%esp
+  800296:	56                   	push   %esi
+  800297:	83 ec 04             	sub    $0x4,%esp
+  80029a:	ff 75 e4             	push   -0x1c(%ebp)
+  80029d:	ff 75 e0             	push   -0x20(%ebp)
+  8002a0:	ff 75 dc             	push   -0x24(%ebp)
+  8002a3:	ff 75 d8             	push   -0x28(%ebp)
+  8002a6:	e8 45 24 00 00       	call   8026f0 <__umoddi3>
+  8002ab:	83 c4 14             	add    $0x14,%esp
+  8002ae:	0f be 80 e6 29 80 00 	movsbl 0x8029e6(%eax),%eax
+  8002b5:	50                   	push   %eax
+  8002b6:	ff d7                	call   *%edi
+}
+  8002b8:	83 c4 10             	add    $0x10,%esp
+  8002bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002be:	5b                   	pop    %ebx
+  8002bf:	5e                   	pop    %esi
+  8002c0:	5f                   	pop    %edi
+  8002c1:	5d                   	pop    %ebp
+  8002c2:	c3                   	ret
+
+008002c3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c3:	55                   	push   %ebp
+  8002c4:	89 e5                	mov    %esp,%ebp
+  8002c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002c9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002cd:	8b 10                	mov    (%eax),%edx
+  8002cf:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d2:	73 0a                	jae    8002de <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002d7:	89 08                	mov    %ecx,(%eax)
+  8002d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002dc:	88 02                	mov    %al,(%edx)
+}
+  8002de:	5d                   	pop    %ebp
+  8002df:	c3                   	ret
+
+008002e0 <printfmt>:
+{
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002e9:	50                   	push   %eax
+  8002ea:	ff 75 10             	push   0x10(%ebp)
+  8002ed:	ff 75 0c             	push   0xc(%ebp)
+  8002f0:	ff 75 08             	push   0x8(%ebp)
+  8002f3:	e8 05 00 00 00       	call   8002fd <vprintfmt>
+}
+  8002f8:	83 c4 10             	add    $0x10,%esp
+  8002fb:	c9                   	leave
+  8002fc:	c3                   	ret
+
+008002fd <vprintfmt>:
+{
+  8002fd:	55                   	push   %ebp
+  8002fe:	89 e5                	mov    %esp,%ebp
+  800300:	57                   	push   %edi
+  800301:	56                   	push   %esi
+  800302:	53                   	push   %ebx
+  800303:	83 ec 2c             	sub    $0x2c,%esp
+  800306:	8b 75 08             	mov    0x8(%ebp),%esi
+  800309:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80030c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80030f:	eb 0a                	jmp    80031b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800311:	83 ec 08             	sub    $0x8,%esp
+  800314:	53                   	push   %ebx
+  800315:	50                   	push   %eax
+  800316:	ff d6                	call   *%esi
+  800318:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80031b:	83 c7 01             	add    $0x1,%edi
+  80031e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800322:	83 f8 25             	cmp    $0x25,%eax
+  800325:	74 0c                	je     800333 <vprintfmt+0x36>
+			if (ch == '\0')
+  800327:	85 c0                	test   %eax,%eax
+  800329:	75 e6                	jne    800311 <vprintfmt+0x14>
+}
+  80032b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032e:	5b                   	pop    %ebx
+  80032f:	5e                   	pop    %esi
+  800330:	5f                   	pop    %edi
+  800331:	5d                   	pop    %ebp
+  800332:	c3                   	ret
+		padc = ' ';
+  800333:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800337:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80033e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800345:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80034c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800351:	8d 47 01             	lea    0x1(%edi),%eax
+  800354:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800357:	0f b6 17             	movzbl (%edi),%edx
+  80035a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80035d:	3c 55                	cmp    $0x55,%al
+  80035f:	0f 87 cf 03 00 00    	ja     800734 <vprintfmt+0x437>
+  800365:	0f b6 c0             	movzbl %al,%eax
+  800368:	ff 24 85 20 2b 80 00 	jmp    *0x802b20(,%eax,4)
+  80036f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800372:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800376:	eb d9                	jmp    800351 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800378:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80037b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80037f:	eb d0                	jmp    800351 <vprintfmt+0x54>
+  800381:	0f b6 d2             	movzbl %dl,%edx
+  800384:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80038f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800392:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800396:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800399:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80039c:	83 f9 09             	cmp    $0x9,%ecx
+  80039f:	77 55                	ja     8003f6 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003a1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003a4:	eb e9                	jmp    80038f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a9:	8b 00                	mov    (%eax),%eax
+  8003ab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8003b4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003ba:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003be:	79 91                	jns    800351 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003c3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003c6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003cd:	eb 82                	jmp    800351 <vprintfmt+0x54>
+			if (width < 0)
+  8003cf:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003d2:	85 d2                	test   %edx,%edx
+  8003d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d9:	0f 49 c2             	cmovns %edx,%eax
+  8003dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003e2:	e9 6a ff ff ff       	jmp    800351 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003ea:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003f1:	e9 5b ff ff ff       	jmp    800351 <vprintfmt+0x54>
+  8003f6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003f9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003fc:	eb bc                	jmp    8003ba <vprintfmt+0xbd>
+			lflag++;
+  8003fe:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800401:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800404:	e9 48 ff ff ff       	jmp    800351 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800409:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040c:	8d 78 04             	lea    0x4(%eax),%edi
+  80040f:	83 ec 08             	sub    $0x8,%esp
+  800412:	53                   	push   %ebx
+  800413:	ff 30                	push   (%eax)
+  800415:	ff d6                	call   *%esi
+			break;
+  800417:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80041a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80041d:	e9 b1 02 00 00       	jmp    8006d3 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800422:	8b 45 14             	mov    0x14(%ebp),%eax
+  800425:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800428:	8b 10                	mov    (%eax),%edx
+  80042a:	89 d0                	mov    %edx,%eax
+  80042c:	f7 d8                	neg    %eax
+  80042e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800431:	83 f8 0f             	cmp    $0xf,%eax
+  800434:	7f 23                	jg     800459 <vprintfmt+0x15c>
+  800436:	8b 14 85 80 2c 80 00 	mov    0x802c80(,%eax,4),%edx
+  80043d:	85 d2                	test   %edx,%edx
+  80043f:	74 18                	je     800459 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800441:	52                   	push   %edx
+  800442:	68 b5 2d 80 00       	push   $0x802db5
+  800447:	53                   	push   %ebx
+  800448:	56                   	push   %esi
+  800449:	e8 92 fe ff ff       	call   8002e0 <printfmt>
+  80044e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800451:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800454:	e9 7a 02 00 00       	jmp    8006d3 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800459:	50                   	push   %eax
+  80045a:	68 fe 29 80 00       	push   $0x8029fe
+  80045f:	53                   	push   %ebx
+  800460:	56                   	push   %esi
+  800461:	e8 7a fe ff ff       	call   8002e0 <printfmt>
+  800466:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800469:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80046c:	e9 62 02 00 00       	jmp    8006d3 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800471:	8b 45 14             	mov    0x14(%ebp),%eax
+  800474:	83 c0 04             	add    $0x4,%eax
+  800477:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80047a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80047f:	85 c9                	test   %ecx,%ecx
+  800481:	b8 f7 29 80 00       	mov    $0x8029f7,%eax
+  800486:	0f 45 c1             	cmovne %ecx,%eax
+  800489:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80048c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800490:	7e 06                	jle    800498 <vprintfmt+0x19b>
+  800492:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800496:	75 0b                	jne    8004a3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800498:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80049b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80049e:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a1:	eb 5c                	jmp    8004ff <vprintfmt+0x202>
+  8004a3:	83 ec 08             	sub    $0x8,%esp
+  8004a6:	ff 75 d0             	push   -0x30(%ebp)
+  8004a9:	ff 75 cc             	push   -0x34(%ebp)
+  8004ac:	e8 20 03 00 00       	call   8007d1 <strnlen>
+  8004b1:	89 c2                	mov    %eax,%edx
+  8004b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b6:	29 d0                	sub    %edx,%eax
+  8004b8:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004bb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004bf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c5:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c7:	eb 0e                	jmp    8004d7 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004c9:	83 ec 08             	sub    $0x8,%esp
+  8004cc:	53                   	push   %ebx
+  8004cd:	57                   	push   %edi
+  8004ce:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d1:	83 ee 01             	sub    $0x1,%esi
+  8004d4:	83 c4 10             	add    $0x10,%esp
+  8004d7:	85 f6                	test   %esi,%esi
+  8004d9:	7f ee                	jg     8004c9 <vprintfmt+0x1cc>
+  8004db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e1:	85 c0                	test   %eax,%eax
+  8004e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e8:	0f 49 d0             	cmovns %eax,%edx
+  8004eb:	29 d0                	sub    %edx,%eax
+  8004ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f0:	eb a6                	jmp    800498 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004f2:	83 ec 08             	sub    $0x8,%esp
+  8004f5:	53                   	push   %ebx
+  8004f6:	52                   	push   %edx
+  8004f7:	ff 55 08             	call   *0x8(%ebp)
+  8004fa:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004fd:	89 f1                	mov    %esi,%ecx
+  8004ff:	8d 71 01             	lea    0x1(%ecx),%esi
+  800502:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800506:	0f be d0             	movsbl %al,%edx
+  800509:	85 d2                	test   %edx,%edx
+  80050b:	74 28                	je     800535 <vprintfmt+0x238>
+  80050d:	85 ff                	test   %edi,%edi
+  80050f:	78 05                	js     800516 <vprintfmt+0x219>
+  800511:	83 ef 01             	sub    $0x1,%edi
+  800514:	78 30                	js     800546 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800516:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80051a:	74 d6                	je     8004f2 <vprintfmt+0x1f5>
+  80051c:	0f be c0             	movsbl %al,%eax
+  80051f:	83 e8 20             	sub    $0x20,%eax
+  800522:	83 f8 5e             	cmp    $0x5e,%eax
+  800525:	76 cb                	jbe    8004f2 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800527:	83 ec 08             	sub    $0x8,%esp
+  80052a:	53                   	push   %ebx
+  80052b:	6a 3f                	push   $0x3f
+  80052d:	ff 55 08             	call   *0x8(%ebp)
+  800530:	83 c4 10             	add    $0x10,%esp
+  800533:	eb c8                	jmp    8004fd <vprintfmt+0x200>
+  800535:	8b 75 08             	mov    0x8(%ebp),%esi
+  800538:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80053b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80053e:	01 d0                	add    %edx,%eax
+  800540:	29 c8                	sub    %ecx,%eax
+  800542:	89 c7                	mov    %eax,%edi
+  800544:	eb 13                	jmp    800559 <vprintfmt+0x25c>
+  800546:	8b 75 08             	mov    0x8(%ebp),%esi
+  800549:	eb ed                	jmp    800538 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80054b:	83 ec 08             	sub    $0x8,%esp
+  80054e:	53                   	push   %ebx
+  80054f:	6a 20                	push   $0x20
+  800551:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800553:	83 ef 01             	sub    $0x1,%edi
+  800556:	83 c4 10             	add    $0x10,%esp
+  800559:	85 ff                	test   %edi,%edi
+  80055b:	7f ee                	jg     80054b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80055d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800560:	89 45 14             	mov    %eax,0x14(%ebp)
+  800563:	e9 6b 01 00 00       	jmp    8006d3 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800568:	83 f9 01             	cmp    $0x1,%ecx
+  80056b:	7f 1f                	jg     80058c <vprintfmt+0x28f>
+	else if (lflag)
+  80056d:	85 c9                	test   %ecx,%ecx
+  80056f:	74 67                	je     8005d8 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800571:	8b 45 14             	mov    0x14(%ebp),%eax
+  800574:	8b 00                	mov    (%eax),%eax
+  800576:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800579:	89 c1                	mov    %eax,%ecx
+  80057b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80057e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800581:	8b 45 14             	mov    0x14(%ebp),%eax
+  800584:	8d 40 04             	lea    0x4(%eax),%eax
+  800587:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058a:	eb 17                	jmp    8005a3 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80058c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058f:	8b 50 04             	mov    0x4(%eax),%edx
+  800592:	8b 00                	mov    (%eax),%eax
+  800594:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800597:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80059a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059d:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005a3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005a6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005a9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005ae:	85 c9                	test   %ecx,%ecx
+  8005b0:	0f 89 03 01 00 00    	jns    8006b9 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005b6:	83 ec 08             	sub    $0x8,%esp
+  8005b9:	53                   	push   %ebx
+  8005ba:	6a 2d                	push   $0x2d
+  8005bc:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005be:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c4:	f7 da                	neg    %edx
+  8005c6:	83 d1 00             	adc    $0x0,%ecx
+  8005c9:	f7 d9                	neg    %ecx
+  8005cb:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d3:	e9 e1 00 00 00       	jmp    8006b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005db:	8b 00                	mov    (%eax),%eax
+  8005dd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e0:	89 c1                	mov    %eax,%ecx
+  8005e2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f1:	eb b0                	jmp    8005a3 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005f3:	83 f9 01             	cmp    $0x1,%ecx
+  8005f6:	7f 1e                	jg     800616 <vprintfmt+0x319>
+	else if (lflag)
+  8005f8:	85 c9                	test   %ecx,%ecx
+  8005fa:	74 32                	je     80062e <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ff:	8b 10                	mov    (%eax),%edx
+  800601:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800606:	8d 40 04             	lea    0x4(%eax),%eax
+  800609:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800611:	e9 a3 00 00 00       	jmp    8006b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8b 10                	mov    (%eax),%edx
+  80061b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80061e:	8d 40 08             	lea    0x8(%eax),%eax
+  800621:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800624:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800629:	e9 8b 00 00 00       	jmp    8006b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8b 10                	mov    (%eax),%edx
+  800633:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800638:	8d 40 04             	lea    0x4(%eax),%eax
+  80063b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80063e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800643:	eb 74                	jmp    8006b9 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800645:	83 f9 01             	cmp    $0x1,%ecx
+  800648:	7f 1b                	jg     800665 <vprintfmt+0x368>
+	else if (lflag)
+  80064a:	85 c9                	test   %ecx,%ecx
+  80064c:	74 2c                	je     80067a <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80064e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800651:	8b 10                	mov    (%eax),%edx
+  800653:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800658:	8d 40 04             	lea    0x4(%eax),%eax
+  80065b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80065e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800663:	eb 54                	jmp    8006b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800665:	8b 45 14             	mov    0x14(%ebp),%eax
+  800668:	8b 10                	mov    (%eax),%edx
+  80066a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80066d:	8d 40 08             	lea    0x8(%eax),%eax
+  800670:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800673:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800678:	eb 3f                	jmp    8006b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8b 10                	mov    (%eax),%edx
+  80067f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800684:	8d 40 04             	lea    0x4(%eax),%eax
+  800687:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80068a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80068f:	eb 28                	jmp    8006b9 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800691:	83 ec 08             	sub    $0x8,%esp
+  800694:	53                   	push   %ebx
+  800695:	6a 30                	push   $0x30
+  800697:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800699:	83 c4 08             	add    $0x8,%esp
+  80069c:	53                   	push   %ebx
+  80069d:	6a 78                	push   $0x78
+  80069f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a4:	8b 10                	mov    (%eax),%edx
+  8006a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006ab:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b4:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006b9:	83 ec 0c             	sub    $0xc,%esp
+  8006bc:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006c0:	50                   	push   %eax
+  8006c1:	ff 75 e0             	push   -0x20(%ebp)
+  8006c4:	57                   	push   %edi
+  8006c5:	51                   	push   %ecx
+  8006c6:	52                   	push   %edx
+  8006c7:	89 da                	mov    %ebx,%edx
+  8006c9:	89 f0                	mov    %esi,%eax
+  8006cb:	e8 4a fb ff ff       	call   80021a <printnum>
+			break;
+  8006d0:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006d6:	e9 40 fc ff ff       	jmp    80031b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006db:	83 f9 01             	cmp    $0x1,%ecx
+  8006de:	7f 1b                	jg     8006fb <vprintfmt+0x3fe>
+	else if (lflag)
+  8006e0:	85 c9                	test   %ecx,%ecx
+  8006e2:	74 2c                	je     800710 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e7:	8b 10                	mov    (%eax),%edx
+  8006e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006f9:	eb be                	jmp    8006b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fe:	8b 10                	mov    (%eax),%edx
+  800700:	8b 48 04             	mov    0x4(%eax),%ecx
+  800703:	8d 40 08             	lea    0x8(%eax),%eax
+  800706:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800709:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80070e:	eb a9                	jmp    8006b9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8b 10                	mov    (%eax),%edx
+  800715:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071a:	8d 40 04             	lea    0x4(%eax),%eax
+  80071d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800720:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800725:	eb 92                	jmp    8006b9 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800727:	83 ec 08             	sub    $0x8,%esp
+  80072a:	53                   	push   %ebx
+  80072b:	6a 25                	push   $0x25
+  80072d:	ff d6                	call   *%esi
+			break;
+  80072f:	83 c4 10             	add    $0x10,%esp
+  800732:	eb 9f                	jmp    8006d3 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800734:	83 ec 08             	sub    $0x8,%esp
+  800737:	53                   	push   %ebx
+  800738:	6a 25                	push   $0x25
+  80073a:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80073c:	83 c4 10             	add    $0x10,%esp
+  80073f:	89 f8                	mov    %edi,%eax
+  800741:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800745:	74 05                	je     80074c <vprintfmt+0x44f>
+  800747:	83 e8 01             	sub    $0x1,%eax
+  80074a:	eb f5                	jmp    800741 <vprintfmt+0x444>
+  80074c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80074f:	eb 82                	jmp    8006d3 <vprintfmt+0x3d6>
+
+00800751 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800751:	55                   	push   %ebp
+  800752:	89 e5                	mov    %esp,%ebp
+  800754:	83 ec 18             	sub    $0x18,%esp
+  800757:	8b 45 08             	mov    0x8(%ebp),%eax
+  80075a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80075d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800760:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800764:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800767:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80076e:	85 c0                	test   %eax,%eax
+  800770:	74 26                	je     800798 <vsnprintf+0x47>
+  800772:	85 d2                	test   %edx,%edx
+  800774:	7e 22                	jle    800798 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800776:	ff 75 14             	push   0x14(%ebp)
+  800779:	ff 75 10             	push   0x10(%ebp)
+  80077c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80077f:	50                   	push   %eax
+  800780:	68 c3 02 80 00       	push   $0x8002c3
+  800785:	e8 73 fb ff ff       	call   8002fd <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80078a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80078d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800790:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800793:	83 c4 10             	add    $0x10,%esp
+}
+  800796:	c9                   	leave
+  800797:	c3                   	ret
+		return -E_INVAL;
+  800798:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80079d:	eb f7                	jmp    800796 <vsnprintf+0x45>
+
+0080079f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80079f:	55                   	push   %ebp
+  8007a0:	89 e5                	mov    %esp,%ebp
+  8007a2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007a5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007a8:	50                   	push   %eax
+  8007a9:	ff 75 10             	push   0x10(%ebp)
+  8007ac:	ff 75 0c             	push   0xc(%ebp)
+  8007af:	ff 75 08             	push   0x8(%ebp)
+  8007b2:	e8 9a ff ff ff       	call   800751 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007b7:	c9                   	leave
+  8007b8:	c3                   	ret
+
+008007b9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007b9:	55                   	push   %ebp
+  8007ba:	89 e5                	mov    %esp,%ebp
+  8007bc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c4:	eb 03                	jmp    8007c9 <strlen+0x10>
+		n++;
+  8007c6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007c9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007cd:	75 f7                	jne    8007c6 <strlen+0xd>
+	return n;
+}
+  8007cf:	5d                   	pop    %ebp
+  8007d0:	c3                   	ret
+
+008007d1 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007d1:	55                   	push   %ebp
+  8007d2:	89 e5                	mov    %esp,%ebp
+  8007d4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007df:	eb 03                	jmp    8007e4 <strnlen+0x13>
+		n++;
+  8007e1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e4:	39 d0                	cmp    %edx,%eax
+  8007e6:	74 08                	je     8007f0 <strnlen+0x1f>
+  8007e8:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007ec:	75 f3                	jne    8007e1 <strnlen+0x10>
+  8007ee:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007f0:	89 d0                	mov    %edx,%eax
+  8007f2:	5d                   	pop    %ebp
+  8007f3:	c3                   	ret
+
+008007f4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007f4:	55                   	push   %ebp
+  8007f5:	89 e5                	mov    %esp,%ebp
+  8007f7:	53                   	push   %ebx
+  8007f8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800803:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800807:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80080a:	83 c0 01             	add    $0x1,%eax
+  80080d:	84 d2                	test   %dl,%dl
+  80080f:	75 f2                	jne    800803 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800811:	89 c8                	mov    %ecx,%eax
+  800813:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800816:	c9                   	leave
+  800817:	c3                   	ret
+
+00800818 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800818:	55                   	push   %ebp
+  800819:	89 e5                	mov    %esp,%ebp
+  80081b:	53                   	push   %ebx
+  80081c:	83 ec 10             	sub    $0x10,%esp
+  80081f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800822:	53                   	push   %ebx
+  800823:	e8 91 ff ff ff       	call   8007b9 <strlen>
+  800828:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80082b:	ff 75 0c             	push   0xc(%ebp)
+  80082e:	01 d8                	add    %ebx,%eax
+  800830:	50                   	push   %eax
+  800831:	e8 be ff ff ff       	call   8007f4 <strcpy>
+	return dst;
+}
+  800836:	89 d8                	mov    %ebx,%eax
+  800838:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083b:	c9                   	leave
+  80083c:	c3                   	ret
+
+0080083d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80083d:	55                   	push   %ebp
+  80083e:	89 e5                	mov    %esp,%ebp
+  800840:	56                   	push   %esi
+  800841:	53                   	push   %ebx
+  800842:	8b 75 08             	mov    0x8(%ebp),%esi
+  800845:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800848:	89 f3                	mov    %esi,%ebx
+  80084a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80084d:	89 f0                	mov    %esi,%eax
+  80084f:	eb 0f                	jmp    800860 <strncpy+0x23>
+		*dst++ = *src;
+  800851:	83 c0 01             	add    $0x1,%eax
+  800854:	0f b6 0a             	movzbl (%edx),%ecx
+  800857:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80085a:	80 f9 01             	cmp    $0x1,%cl
+  80085d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800860:	39 d8                	cmp    %ebx,%eax
+  800862:	75 ed                	jne    800851 <strncpy+0x14>
+	}
+	return ret;
+}
+  800864:	89 f0                	mov    %esi,%eax
+  800866:	5b                   	pop    %ebx
+  800867:	5e                   	pop    %esi
+  800868:	5d                   	pop    %ebp
+  800869:	c3                   	ret
+
+0080086a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80086a:	55                   	push   %ebp
+  80086b:	89 e5                	mov    %esp,%ebp
+  80086d:	56                   	push   %esi
+  80086e:	53                   	push   %ebx
+  80086f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800872:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800875:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800878:	89 f0                	mov    %esi,%eax
+  80087a:	85 d2                	test   %edx,%edx
+  80087c:	74 21                	je     80089f <strlcpy+0x35>
+  80087e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800882:	89 f2                	mov    %esi,%edx
+  800884:	eb 09                	jmp    80088f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800886:	83 c1 01             	add    $0x1,%ecx
+  800889:	83 c2 01             	add    $0x1,%edx
+  80088c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80088f:	39 c2                	cmp    %eax,%edx
+  800891:	74 09                	je     80089c <strlcpy+0x32>
+  800893:	0f b6 19             	movzbl (%ecx),%ebx
+  800896:	84 db                	test   %bl,%bl
+  800898:	75 ec                	jne    800886 <strlcpy+0x1c>
+  80089a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80089c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80089f:	29 f0                	sub    %esi,%eax
+}
+  8008a1:	5b                   	pop    %ebx
+  8008a2:	5e                   	pop    %esi
+  8008a3:	5d                   	pop    %ebp
+  8008a4:	c3                   	ret
+
+008008a5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008a5:	55                   	push   %ebp
+  8008a6:	89 e5                	mov    %esp,%ebp
+  8008a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008ae:	eb 06                	jmp    8008b6 <strcmp+0x11>
+		p++, q++;
+  8008b0:	83 c1 01             	add    $0x1,%ecx
+  8008b3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008b6:	0f b6 01             	movzbl (%ecx),%eax
+  8008b9:	84 c0                	test   %al,%al
+  8008bb:	74 04                	je     8008c1 <strcmp+0x1c>
+  8008bd:	3a 02                	cmp    (%edx),%al
+  8008bf:	74 ef                	je     8008b0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008c1:	0f b6 c0             	movzbl %al,%eax
+  8008c4:	0f b6 12             	movzbl (%edx),%edx
+  8008c7:	29 d0                	sub    %edx,%eax
+}
+  8008c9:	5d                   	pop    %ebp
+  8008ca:	c3                   	ret
+
+008008cb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	53                   	push   %ebx
+  8008cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d5:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008d8:	eb 09                	jmp    8008e3 <strncmp+0x18>
+		n--, p++, q++;
+  8008da:	83 ea 01             	sub    $0x1,%edx
+  8008dd:	83 c0 01             	add    $0x1,%eax
+  8008e0:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008e3:	85 d2                	test   %edx,%edx
+  8008e5:	74 18                	je     8008ff <strncmp+0x34>
+  8008e7:	0f b6 18             	movzbl (%eax),%ebx
+  8008ea:	84 db                	test   %bl,%bl
+  8008ec:	74 04                	je     8008f2 <strncmp+0x27>
+  8008ee:	3a 19                	cmp    (%ecx),%bl
+  8008f0:	74 e8                	je     8008da <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008f2:	0f b6 00             	movzbl (%eax),%eax
+  8008f5:	0f b6 11             	movzbl (%ecx),%edx
+  8008f8:	29 d0                	sub    %edx,%eax
+}
+  8008fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008fd:	c9                   	leave
+  8008fe:	c3                   	ret
+		return 0;
+  8008ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800904:	eb f4                	jmp    8008fa <strncmp+0x2f>
+
+00800906 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800906:	55                   	push   %ebp
+  800907:	89 e5                	mov    %esp,%ebp
+  800909:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800910:	eb 03                	jmp    800915 <strchr+0xf>
+  800912:	83 c0 01             	add    $0x1,%eax
+  800915:	0f b6 10             	movzbl (%eax),%edx
+  800918:	84 d2                	test   %dl,%dl
+  80091a:	74 06                	je     800922 <strchr+0x1c>
+		if (*s == c)
+  80091c:	38 ca                	cmp    %cl,%dl
+  80091e:	75 f2                	jne    800912 <strchr+0xc>
+  800920:	eb 05                	jmp    800927 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800922:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800927:	5d                   	pop    %ebp
+  800928:	c3                   	ret
+
+00800929 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800929:	55                   	push   %ebp
+  80092a:	89 e5                	mov    %esp,%ebp
+  80092c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800933:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800936:	38 ca                	cmp    %cl,%dl
+  800938:	74 09                	je     800943 <strfind+0x1a>
+  80093a:	84 d2                	test   %dl,%dl
+  80093c:	74 05                	je     800943 <strfind+0x1a>
+	for (; *s; s++)
+  80093e:	83 c0 01             	add    $0x1,%eax
+  800941:	eb f0                	jmp    800933 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800943:	5d                   	pop    %ebp
+  800944:	c3                   	ret
+
+00800945 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800945:	55                   	push   %ebp
+  800946:	89 e5                	mov    %esp,%ebp
+  800948:	57                   	push   %edi
+  800949:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80094c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80094f:	85 c9                	test   %ecx,%ecx
+  800951:	74 20                	je     800973 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800953:	89 f8                	mov    %edi,%eax
+  800955:	09 c8                	or     %ecx,%eax
+  800957:	a8 03                	test   $0x3,%al
+  800959:	75 12                	jne    80096d <memset+0x28>
+		c &= 0xFF;
+  80095b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80095f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800965:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800968:	fc                   	cld
+  800969:	f3 ab                	rep stos %eax,%es:(%edi)
+  80096b:	eb 06                	jmp    800973 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80096d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800970:	fc                   	cld
+  800971:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800973:	89 f8                	mov    %edi,%eax
+  800975:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800978:	c9                   	leave
+  800979:	c3                   	ret
+
+0080097a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80097a:	55                   	push   %ebp
+  80097b:	89 e5                	mov    %esp,%ebp
+  80097d:	57                   	push   %edi
+  80097e:	56                   	push   %esi
+  80097f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800982:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800985:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800988:	39 c6                	cmp    %eax,%esi
+  80098a:	73 32                	jae    8009be <memmove+0x44>
+  80098c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80098f:	39 d0                	cmp    %edx,%eax
+  800991:	73 2b                	jae    8009be <memmove+0x44>
+		s += n;
+		d += n;
+  800993:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800996:	89 d6                	mov    %edx,%esi
+  800998:	09 fe                	or     %edi,%esi
+  80099a:	09 ce                	or     %ecx,%esi
+  80099c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009a2:	75 0e                	jne    8009b2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009a4:	83 ef 04             	sub    $0x4,%edi
+  8009a7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009aa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009ad:	fd                   	std
+  8009ae:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009b0:	eb 09                	jmp    8009bb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009b2:	83 ef 01             	sub    $0x1,%edi
+  8009b5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009b8:	fd                   	std
+  8009b9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009bb:	fc                   	cld
+  8009bc:	eb 1a                	jmp    8009d8 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009be:	89 f2                	mov    %esi,%edx
+  8009c0:	09 c2                	or     %eax,%edx
+  8009c2:	09 ca                	or     %ecx,%edx
+  8009c4:	f6 c2 03             	test   $0x3,%dl
+  8009c7:	75 0a                	jne    8009d3 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009c9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009cc:	89 c7                	mov    %eax,%edi
+  8009ce:	fc                   	cld
+  8009cf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d1:	eb 05                	jmp    8009d8 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009d3:	89 c7                	mov    %eax,%edi
+  8009d5:	fc                   	cld
+  8009d6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009d8:	5e                   	pop    %esi
+  8009d9:	5f                   	pop    %edi
+  8009da:	5d                   	pop    %ebp
+  8009db:	c3                   	ret
+
+008009dc <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009e2:	ff 75 10             	push   0x10(%ebp)
+  8009e5:	ff 75 0c             	push   0xc(%ebp)
+  8009e8:	ff 75 08             	push   0x8(%ebp)
+  8009eb:	e8 8a ff ff ff       	call   80097a <memmove>
+}
+  8009f0:	c9                   	leave
+  8009f1:	c3                   	ret
+
+008009f2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009f2:	55                   	push   %ebp
+  8009f3:	89 e5                	mov    %esp,%ebp
+  8009f5:	56                   	push   %esi
+  8009f6:	53                   	push   %ebx
+  8009f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009fd:	89 c6                	mov    %eax,%esi
+  8009ff:	03 75 10             	add    0x10(%ebp),%esi
+  800a02:	eb 06                	jmp    800a0a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a04:	83 c0 01             	add    $0x1,%eax
+  800a07:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a0a:	39 f0                	cmp    %esi,%eax
+  800a0c:	74 14                	je     800a22 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a0e:	0f b6 08             	movzbl (%eax),%ecx
+  800a11:	0f b6 1a             	movzbl (%edx),%ebx
+  800a14:	38 d9                	cmp    %bl,%cl
+  800a16:	74 ec                	je     800a04 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a18:	0f b6 c1             	movzbl %cl,%eax
+  800a1b:	0f b6 db             	movzbl %bl,%ebx
+  800a1e:	29 d8                	sub    %ebx,%eax
+  800a20:	eb 05                	jmp    800a27 <memcmp+0x35>
+	}
+
+	return 0;
+  800a22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a27:	5b                   	pop    %ebx
+  800a28:	5e                   	pop    %esi
+  800a29:	5d                   	pop    %ebp
+  800a2a:	c3                   	ret
+
+00800a2b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a34:	89 c2                	mov    %eax,%edx
+  800a36:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a39:	eb 03                	jmp    800a3e <memfind+0x13>
+  800a3b:	83 c0 01             	add    $0x1,%eax
+  800a3e:	39 d0                	cmp    %edx,%eax
+  800a40:	73 04                	jae    800a46 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a42:	38 08                	cmp    %cl,(%eax)
+  800a44:	75 f5                	jne    800a3b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a46:	5d                   	pop    %ebp
+  800a47:	c3                   	ret
+
+00800a48 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a48:	55                   	push   %ebp
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	57                   	push   %edi
+  800a4c:	56                   	push   %esi
+  800a4d:	53                   	push   %ebx
+  800a4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a54:	eb 03                	jmp    800a59 <strtol+0x11>
+		s++;
+  800a56:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a59:	0f b6 02             	movzbl (%edx),%eax
+  800a5c:	3c 20                	cmp    $0x20,%al
+  800a5e:	74 f6                	je     800a56 <strtol+0xe>
+  800a60:	3c 09                	cmp    $0x9,%al
+  800a62:	74 f2                	je     800a56 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a64:	3c 2b                	cmp    $0x2b,%al
+  800a66:	74 2a                	je     800a92 <strtol+0x4a>
+	int neg = 0;
+  800a68:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a6d:	3c 2d                	cmp    $0x2d,%al
+  800a6f:	74 2b                	je     800a9c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a71:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a77:	75 0f                	jne    800a88 <strtol+0x40>
+  800a79:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a7c:	74 28                	je     800aa6 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a7e:	85 db                	test   %ebx,%ebx
+  800a80:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a85:	0f 44 d8             	cmove  %eax,%ebx
+  800a88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a90:	eb 46                	jmp    800ad8 <strtol+0x90>
+		s++;
+  800a92:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a95:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a9a:	eb d5                	jmp    800a71 <strtol+0x29>
+		s++, neg = 1;
+  800a9c:	83 c2 01             	add    $0x1,%edx
+  800a9f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800aa4:	eb cb                	jmp    800a71 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aaa:	74 0e                	je     800aba <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800aac:	85 db                	test   %ebx,%ebx
+  800aae:	75 d8                	jne    800a88 <strtol+0x40>
+		s++, base = 8;
+  800ab0:	83 c2 01             	add    $0x1,%edx
+  800ab3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ab8:	eb ce                	jmp    800a88 <strtol+0x40>
+		s += 2, base = 16;
+  800aba:	83 c2 02             	add    $0x2,%edx
+  800abd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ac2:	eb c4                	jmp    800a88 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ac4:	0f be c0             	movsbl %al,%eax
+  800ac7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800aca:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800acd:	7d 3a                	jge    800b09 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800acf:	83 c2 01             	add    $0x1,%edx
+  800ad2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ad6:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ad8:	0f b6 02             	movzbl (%edx),%eax
+  800adb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ade:	89 f3                	mov    %esi,%ebx
+  800ae0:	80 fb 09             	cmp    $0x9,%bl
+  800ae3:	76 df                	jbe    800ac4 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ae5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ae8:	89 f3                	mov    %esi,%ebx
+  800aea:	80 fb 19             	cmp    $0x19,%bl
+  800aed:	77 08                	ja     800af7 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800aef:	0f be c0             	movsbl %al,%eax
+  800af2:	83 e8 57             	sub    $0x57,%eax
+  800af5:	eb d3                	jmp    800aca <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800af7:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800afa:	89 f3                	mov    %esi,%ebx
+  800afc:	80 fb 19             	cmp    $0x19,%bl
+  800aff:	77 08                	ja     800b09 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b01:	0f be c0             	movsbl %al,%eax
+  800b04:	83 e8 37             	sub    $0x37,%eax
+  800b07:	eb c1                	jmp    800aca <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b09:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b0d:	74 05                	je     800b14 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b12:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b14:	89 c8                	mov    %ecx,%eax
+  800b16:	f7 d8                	neg    %eax
+  800b18:	85 ff                	test   %edi,%edi
+  800b1a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b1d:	89 c8                	mov    %ecx,%eax
+  800b1f:	5b                   	pop    %ebx
+  800b20:	5e                   	pop    %esi
+  800b21:	5f                   	pop    %edi
+  800b22:	5d                   	pop    %ebp
+  800b23:	c3                   	ret
+
+00800b24 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b24:	55                   	push   %ebp
+  800b25:	89 e5                	mov    %esp,%ebp
+  800b27:	57                   	push   %edi
+  800b28:	56                   	push   %esi
+  800b29:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b35:	89 c3                	mov    %eax,%ebx
+  800b37:	89 c7                	mov    %eax,%edi
+  800b39:	89 c6                	mov    %eax,%esi
+  800b3b:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b3d:	5b                   	pop    %ebx
+  800b3e:	5e                   	pop    %esi
+  800b3f:	5f                   	pop    %edi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	57                   	push   %edi
+  800b46:	56                   	push   %esi
+  800b47:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b52:	89 d1                	mov    %edx,%ecx
+  800b54:	89 d3                	mov    %edx,%ebx
+  800b56:	89 d7                	mov    %edx,%edi
+  800b58:	89 d6                	mov    %edx,%esi
+  800b5a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b5c:	5b                   	pop    %ebx
+  800b5d:	5e                   	pop    %esi
+  800b5e:	5f                   	pop    %edi
+  800b5f:	5d                   	pop    %ebp
+  800b60:	c3                   	ret
+
+00800b61 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	57                   	push   %edi
+  800b65:	56                   	push   %esi
+  800b66:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b74:	89 cb                	mov    %ecx,%ebx
+  800b76:	89 cf                	mov    %ecx,%edi
+  800b78:	89 ce                	mov    %ecx,%esi
+  800b7a:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b7c:	5b                   	pop    %ebx
+  800b7d:	5e                   	pop    %esi
+  800b7e:	5f                   	pop    %edi
+  800b7f:	5d                   	pop    %ebp
+  800b80:	c3                   	ret
+
+00800b81 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	57                   	push   %edi
+  800b85:	56                   	push   %esi
+  800b86:	53                   	push   %ebx
+  800b87:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b92:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b97:	89 cb                	mov    %ecx,%ebx
+  800b99:	89 cf                	mov    %ecx,%edi
+  800b9b:	89 ce                	mov    %ecx,%esi
+  800b9d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b9f:	85 c0                	test   %eax,%eax
+  800ba1:	7f 08                	jg     800bab <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ba3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba6:	5b                   	pop    %ebx
+  800ba7:	5e                   	pop    %esi
+  800ba8:	5f                   	pop    %edi
+  800ba9:	5d                   	pop    %ebp
+  800baa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bab:	83 ec 0c             	sub    $0xc,%esp
+  800bae:	50                   	push   %eax
+  800baf:	6a 03                	push   $0x3
+  800bb1:	68 df 2c 80 00       	push   $0x802cdf
+  800bb6:	6a 23                	push   $0x23
+  800bb8:	68 fc 2c 80 00       	push   $0x802cfc
+  800bbd:	e8 38 18 00 00       	call   8023fa <_panic>
+
+00800bc2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	57                   	push   %edi
+  800bc6:	56                   	push   %esi
+  800bc7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bcd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bd2:	89 d1                	mov    %edx,%ecx
+  800bd4:	89 d3                	mov    %edx,%ebx
+  800bd6:	89 d7                	mov    %edx,%edi
+  800bd8:	89 d6                	mov    %edx,%esi
+  800bda:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bdc:	5b                   	pop    %ebx
+  800bdd:	5e                   	pop    %esi
+  800bde:	5f                   	pop    %edi
+  800bdf:	5d                   	pop    %ebp
+  800be0:	c3                   	ret
+
+00800be1 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800be1:	55                   	push   %ebp
+  800be2:	89 e5                	mov    %esp,%ebp
+  800be4:	57                   	push   %edi
+  800be5:	56                   	push   %esi
+  800be6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800be7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bec:	b8 16 00 00 00       	mov    $0x16,%eax
+  800bf1:	89 d1                	mov    %edx,%ecx
+  800bf3:	89 d3                	mov    %edx,%ebx
+  800bf5:	89 d7                	mov    %edx,%edi
+  800bf7:	89 d6                	mov    %edx,%esi
+  800bf9:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bfb:	5b                   	pop    %ebx
+  800bfc:	5e                   	pop    %esi
+  800bfd:	5f                   	pop    %edi
+  800bfe:	5d                   	pop    %ebp
+  800bff:	c3                   	ret
+
+00800c00 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800c00:	55                   	push   %ebp
+  800c01:	89 e5                	mov    %esp,%ebp
+  800c03:	57                   	push   %edi
+  800c04:	56                   	push   %esi
+  800c05:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800c10:	89 d1                	mov    %edx,%ecx
+  800c12:	89 d3                	mov    %edx,%ebx
+  800c14:	89 d7                	mov    %edx,%edi
+  800c16:	89 d6                	mov    %edx,%esi
+  800c18:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800c1a:	5b                   	pop    %ebx
+  800c1b:	5e                   	pop    %esi
+  800c1c:	5f                   	pop    %edi
+  800c1d:	5d                   	pop    %ebp
+  800c1e:	c3                   	ret
+
+00800c1f <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	57                   	push   %edi
+  800c23:	56                   	push   %esi
+  800c24:	53                   	push   %ebx
+  800c25:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c33:	b8 15 00 00 00       	mov    $0x15,%eax
+  800c38:	89 df                	mov    %ebx,%edi
+  800c3a:	89 de                	mov    %ebx,%esi
+  800c3c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c3e:	85 c0                	test   %eax,%eax
+  800c40:	7f 08                	jg     800c4a <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800c42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c45:	5b                   	pop    %ebx
+  800c46:	5e                   	pop    %esi
+  800c47:	5f                   	pop    %edi
+  800c48:	5d                   	pop    %ebp
+  800c49:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c4a:	83 ec 0c             	sub    $0xc,%esp
+  800c4d:	50                   	push   %eax
+  800c4e:	6a 15                	push   $0x15
+  800c50:	68 df 2c 80 00       	push   $0x802cdf
+  800c55:	6a 23                	push   $0x23
+  800c57:	68 fc 2c 80 00       	push   $0x802cfc
+  800c5c:	e8 99 17 00 00       	call   8023fa <_panic>
+
+00800c61 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c61:	55                   	push   %ebp
+  800c62:	89 e5                	mov    %esp,%ebp
+  800c64:	57                   	push   %edi
+  800c65:	56                   	push   %esi
+  800c66:	53                   	push   %ebx
+  800c67:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c6a:	be 00 00 00 00       	mov    $0x0,%esi
+  800c6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c75:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c7d:	89 f7                	mov    %esi,%edi
+  800c7f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c81:	85 c0                	test   %eax,%eax
+  800c83:	7f 08                	jg     800c8d <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c88:	5b                   	pop    %ebx
+  800c89:	5e                   	pop    %esi
+  800c8a:	5f                   	pop    %edi
+  800c8b:	5d                   	pop    %ebp
+  800c8c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c8d:	83 ec 0c             	sub    $0xc,%esp
+  800c90:	50                   	push   %eax
+  800c91:	6a 05                	push   $0x5
+  800c93:	68 df 2c 80 00       	push   $0x802cdf
+  800c98:	6a 23                	push   $0x23
+  800c9a:	68 fc 2c 80 00       	push   $0x802cfc
+  800c9f:	e8 56 17 00 00       	call   8023fa <_panic>
+
+00800ca4 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800ca4:	55                   	push   %ebp
+  800ca5:	89 e5                	mov    %esp,%ebp
+  800ca7:	57                   	push   %edi
+  800ca8:	56                   	push   %esi
+  800ca9:	53                   	push   %ebx
+  800caa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cad:	be 00 00 00 00       	mov    $0x0,%esi
+  800cb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb8:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cc0:	89 f7                	mov    %esi,%edi
+  800cc2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cc4:	85 c0                	test   %eax,%eax
+  800cc6:	7f 08                	jg     800cd0 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccb:	5b                   	pop    %ebx
+  800ccc:	5e                   	pop    %esi
+  800ccd:	5f                   	pop    %edi
+  800cce:	5d                   	pop    %ebp
+  800ccf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cd0:	83 ec 0c             	sub    $0xc,%esp
+  800cd3:	50                   	push   %eax
+  800cd4:	6a 06                	push   $0x6
+  800cd6:	68 df 2c 80 00       	push   $0x802cdf
+  800cdb:	6a 23                	push   $0x23
+  800cdd:	68 fc 2c 80 00       	push   $0x802cfc
+  800ce2:	e8 13 17 00 00       	call   8023fa <_panic>
+
+00800ce7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	57                   	push   %edi
+  800ceb:	56                   	push   %esi
+  800cec:	53                   	push   %ebx
+  800ced:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cf0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf6:	b8 07 00 00 00       	mov    $0x7,%eax
+  800cfb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cfe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d01:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d04:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d06:	85 c0                	test   %eax,%eax
+  800d08:	7f 08                	jg     800d12 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0d:	5b                   	pop    %ebx
+  800d0e:	5e                   	pop    %esi
+  800d0f:	5f                   	pop    %edi
+  800d10:	5d                   	pop    %ebp
+  800d11:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d12:	83 ec 0c             	sub    $0xc,%esp
+  800d15:	50                   	push   %eax
+  800d16:	6a 07                	push   $0x7
+  800d18:	68 df 2c 80 00       	push   $0x802cdf
+  800d1d:	6a 23                	push   $0x23
+  800d1f:	68 fc 2c 80 00       	push   $0x802cfc
+  800d24:	e8 d1 16 00 00       	call   8023fa <_panic>
+
+00800d29 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	57                   	push   %edi
+  800d2d:	56                   	push   %esi
+  800d2e:	53                   	push   %ebx
+  800d2f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d42:	89 df                	mov    %ebx,%edi
+  800d44:	89 de                	mov    %ebx,%esi
+  800d46:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d48:	85 c0                	test   %eax,%eax
+  800d4a:	7f 08                	jg     800d54 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4f:	5b                   	pop    %ebx
+  800d50:	5e                   	pop    %esi
+  800d51:	5f                   	pop    %edi
+  800d52:	5d                   	pop    %ebp
+  800d53:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d54:	83 ec 0c             	sub    $0xc,%esp
+  800d57:	50                   	push   %eax
+  800d58:	6a 08                	push   $0x8
+  800d5a:	68 df 2c 80 00       	push   $0x802cdf
+  800d5f:	6a 23                	push   $0x23
+  800d61:	68 fc 2c 80 00       	push   $0x802cfc
+  800d66:	e8 8f 16 00 00       	call   8023fa <_panic>
+
+00800d6b <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d6b:	55                   	push   %ebp
+  800d6c:	89 e5                	mov    %esp,%ebp
+  800d6e:	57                   	push   %edi
+  800d6f:	56                   	push   %esi
+  800d70:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d77:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d7c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d84:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d87:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d89:	5b                   	pop    %ebx
+  800d8a:	5e                   	pop    %esi
+  800d8b:	5f                   	pop    %edi
+  800d8c:	5d                   	pop    %ebp
+  800d8d:	c3                   	ret
+
+00800d8e <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d8e:	55                   	push   %ebp
+  800d8f:	89 e5                	mov    %esp,%ebp
+  800d91:	57                   	push   %edi
+  800d92:	56                   	push   %esi
+  800d93:	53                   	push   %ebx
+  800d94:	8b 45 18             	mov    0x18(%ebp),%eax
+  800d97:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800d9a:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800d9f:	77 27                	ja     800dc8 <sys_page_map_range+0x3a>
+  800da1:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800da7:	77 1f                	ja     800dc8 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800da9:	c1 e0 0c             	shl    $0xc,%eax
+  800dac:	89 c6                	mov    %eax,%esi
+  800dae:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800db0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dbb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc1:	cd 30                	int    $0x30
+}
+  800dc3:	5b                   	pop    %ebx
+  800dc4:	5e                   	pop    %esi
+  800dc5:	5f                   	pop    %edi
+  800dc6:	5d                   	pop    %ebp
+  800dc7:	c3                   	ret
+		return -E_INVAL;
+  800dc8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dcd:	eb f4                	jmp    800dc3 <sys_page_map_range+0x35>
+
+00800dcf <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800dcf:	55                   	push   %ebp
+  800dd0:	89 e5                	mov    %esp,%ebp
+  800dd2:	57                   	push   %edi
+  800dd3:	56                   	push   %esi
+  800dd4:	53                   	push   %ebx
+  800dd5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dde:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800de3:	be 00 00 00 00       	mov    $0x0,%esi
+  800de8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800deb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800df0:	85 c0                	test   %eax,%eax
+  800df2:	7f 08                	jg     800dfc <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df7:	5b                   	pop    %ebx
+  800df8:	5e                   	pop    %esi
+  800df9:	5f                   	pop    %edi
+  800dfa:	5d                   	pop    %ebp
+  800dfb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfc:	83 ec 0c             	sub    $0xc,%esp
+  800dff:	50                   	push   %eax
+  800e00:	6a 0c                	push   $0xc
+  800e02:	68 df 2c 80 00       	push   $0x802cdf
+  800e07:	6a 23                	push   $0x23
+  800e09:	68 fc 2c 80 00       	push   $0x802cfc
+  800e0e:	e8 e7 15 00 00       	call   8023fa <_panic>
+
+00800e13 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e19:	be 00 00 00 00       	mov    $0x0,%esi
+  800e1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e24:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e2c:	89 f7                	mov    %esi,%edi
+  800e2e:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e30:	5b                   	pop    %ebx
+  800e31:	5e                   	pop    %esi
+  800e32:	5f                   	pop    %edi
+  800e33:	5d                   	pop    %ebp
+  800e34:	c3                   	ret
+
+00800e35 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	57                   	push   %edi
+  800e39:	56                   	push   %esi
+  800e3a:	53                   	push   %ebx
+  800e3b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e49:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e4e:	89 df                	mov    %ebx,%edi
+  800e50:	89 de                	mov    %ebx,%esi
+  800e52:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e54:	85 c0                	test   %eax,%eax
+  800e56:	7f 08                	jg     800e60 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5b:	5b                   	pop    %ebx
+  800e5c:	5e                   	pop    %esi
+  800e5d:	5f                   	pop    %edi
+  800e5e:	5d                   	pop    %ebp
+  800e5f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e60:	83 ec 0c             	sub    $0xc,%esp
+  800e63:	50                   	push   %eax
+  800e64:	6a 0f                	push   $0xf
+  800e66:	68 df 2c 80 00       	push   $0x802cdf
+  800e6b:	6a 23                	push   $0x23
+  800e6d:	68 fc 2c 80 00       	push   $0x802cfc
+  800e72:	e8 83 15 00 00       	call   8023fa <_panic>
+
+00800e77 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e77:	55                   	push   %ebp
+  800e78:	89 e5                	mov    %esp,%ebp
+  800e7a:	57                   	push   %edi
+  800e7b:	56                   	push   %esi
+  800e7c:	53                   	push   %ebx
+  800e7d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e90:	89 df                	mov    %ebx,%edi
+  800e92:	89 de                	mov    %ebx,%esi
+  800e94:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e96:	85 c0                	test   %eax,%eax
+  800e98:	7f 08                	jg     800ea2 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800e9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9d:	5b                   	pop    %ebx
+  800e9e:	5e                   	pop    %esi
+  800e9f:	5f                   	pop    %edi
+  800ea0:	5d                   	pop    %ebp
+  800ea1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea2:	83 ec 0c             	sub    $0xc,%esp
+  800ea5:	50                   	push   %eax
+  800ea6:	6a 10                	push   $0x10
+  800ea8:	68 df 2c 80 00       	push   $0x802cdf
+  800ead:	6a 23                	push   $0x23
+  800eaf:	68 fc 2c 80 00       	push   $0x802cfc
+  800eb4:	e8 41 15 00 00       	call   8023fa <_panic>
+
+00800eb9 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800eb9:	55                   	push   %ebp
+  800eba:	89 e5                	mov    %esp,%ebp
+  800ebc:	57                   	push   %edi
+  800ebd:	56                   	push   %esi
+  800ebe:	53                   	push   %ebx
+  800ebf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ec2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecd:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ed2:	89 df                	mov    %ebx,%edi
+  800ed4:	89 de                	mov    %ebx,%esi
+  800ed6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed8:	85 c0                	test   %eax,%eax
+  800eda:	7f 08                	jg     800ee4 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800edc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edf:	5b                   	pop    %ebx
+  800ee0:	5e                   	pop    %esi
+  800ee1:	5f                   	pop    %edi
+  800ee2:	5d                   	pop    %ebp
+  800ee3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee4:	83 ec 0c             	sub    $0xc,%esp
+  800ee7:	50                   	push   %eax
+  800ee8:	6a 11                	push   $0x11
+  800eea:	68 df 2c 80 00       	push   $0x802cdf
+  800eef:	6a 23                	push   $0x23
+  800ef1:	68 fc 2c 80 00       	push   $0x802cfc
+  800ef6:	e8 ff 14 00 00       	call   8023fa <_panic>
+
+00800efb <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800efb:	55                   	push   %ebp
+  800efc:	89 e5                	mov    %esp,%ebp
+  800efe:	57                   	push   %edi
+  800eff:	56                   	push   %esi
+  800f00:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f06:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f0b:	89 d1                	mov    %edx,%ecx
+  800f0d:	89 d3                	mov    %edx,%ebx
+  800f0f:	89 d7                	mov    %edx,%edi
+  800f11:	89 d6                	mov    %edx,%esi
+  800f13:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800f15:	5b                   	pop    %ebx
+  800f16:	5e                   	pop    %esi
+  800f17:	5f                   	pop    %edi
+  800f18:	5d                   	pop    %ebp
+  800f19:	c3                   	ret
+
+00800f1a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	57                   	push   %edi
+  800f1e:	56                   	push   %esi
+  800f1f:	53                   	push   %ebx
+  800f20:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2e:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f33:	89 df                	mov    %ebx,%edi
+  800f35:	89 de                	mov    %ebx,%esi
+  800f37:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f39:	85 c0                	test   %eax,%eax
+  800f3b:	7f 08                	jg     800f45 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f40:	5b                   	pop    %ebx
+  800f41:	5e                   	pop    %esi
+  800f42:	5f                   	pop    %edi
+  800f43:	5d                   	pop    %ebp
+  800f44:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f45:	83 ec 0c             	sub    $0xc,%esp
+  800f48:	50                   	push   %eax
+  800f49:	6a 13                	push   $0x13
+  800f4b:	68 df 2c 80 00       	push   $0x802cdf
+  800f50:	6a 23                	push   $0x23
+  800f52:	68 fc 2c 80 00       	push   $0x802cfc
+  800f57:	e8 9e 14 00 00       	call   8023fa <_panic>
+
+00800f5c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f5c:	55                   	push   %ebp
+  800f5d:	89 e5                	mov    %esp,%ebp
+  800f5f:	57                   	push   %edi
+  800f60:	56                   	push   %esi
+  800f61:	53                   	push   %ebx
+  800f62:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f70:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f75:	89 df                	mov    %ebx,%edi
+  800f77:	89 de                	mov    %ebx,%esi
+  800f79:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7b:	85 c0                	test   %eax,%eax
+  800f7d:	7f 08                	jg     800f87 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f82:	5b                   	pop    %ebx
+  800f83:	5e                   	pop    %esi
+  800f84:	5f                   	pop    %edi
+  800f85:	5d                   	pop    %ebp
+  800f86:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f87:	83 ec 0c             	sub    $0xc,%esp
+  800f8a:	50                   	push   %eax
+  800f8b:	6a 14                	push   $0x14
+  800f8d:	68 df 2c 80 00       	push   $0x802cdf
+  800f92:	6a 23                	push   $0x23
+  800f94:	68 fc 2c 80 00       	push   $0x802cfc
+  800f99:	e8 5c 14 00 00       	call   8023fa <_panic>
+
+00800f9e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f9e:	55                   	push   %ebp
+  800f9f:	89 e5                	mov    %esp,%ebp
+  800fa1:	57                   	push   %edi
+  800fa2:	56                   	push   %esi
+  800fa3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faa:	b8 17 00 00 00       	mov    $0x17,%eax
+  800faf:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fba:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5e                   	pop    %esi
+  800fbe:	5f                   	pop    %edi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	c3                   	ret
+
+00800fc1 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fc1:	55                   	push   %ebp
+  800fc2:	89 e5                	mov    %esp,%ebp
+  800fc4:	57                   	push   %edi
+  800fc5:	56                   	push   %esi
+  800fc6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcd:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fd2:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fda:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fdd:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fdf:	5b                   	pop    %ebx
+  800fe0:	5e                   	pop    %esi
+  800fe1:	5f                   	pop    %edi
+  800fe2:	5d                   	pop    %ebp
+  800fe3:	c3                   	ret
+
+00800fe4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800fe4:	55                   	push   %ebp
+  800fe5:	89 e5                	mov    %esp,%ebp
+  800fe7:	57                   	push   %edi
+  800fe8:	56                   	push   %esi
+  800fe9:	53                   	push   %ebx
+  800fea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ff2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff5:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ffa:	89 cb                	mov    %ecx,%ebx
+  800ffc:	89 cf                	mov    %ecx,%edi
+  800ffe:	89 ce                	mov    %ecx,%esi
+  801000:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801002:	85 c0                	test   %eax,%eax
+  801004:	7f 08                	jg     80100e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801006:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801009:	5b                   	pop    %ebx
+  80100a:	5e                   	pop    %esi
+  80100b:	5f                   	pop    %edi
+  80100c:	5d                   	pop    %ebp
+  80100d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80100e:	83 ec 0c             	sub    $0xc,%esp
+  801011:	50                   	push   %eax
+  801012:	6a 19                	push   $0x19
+  801014:	68 df 2c 80 00       	push   $0x802cdf
+  801019:	6a 23                	push   $0x23
+  80101b:	68 fc 2c 80 00       	push   $0x802cfc
+  801020:	e8 d5 13 00 00       	call   8023fa <_panic>
+
+00801025 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	57                   	push   %edi
+  801029:	56                   	push   %esi
+  80102a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80102b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801030:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801035:	89 d1                	mov    %edx,%ecx
+  801037:	89 d3                	mov    %edx,%ebx
+  801039:	89 d7                	mov    %edx,%edi
+  80103b:	89 d6                	mov    %edx,%esi
+  80103d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80103f:	5b                   	pop    %ebx
+  801040:	5e                   	pop    %esi
+  801041:	5f                   	pop    %edi
+  801042:	5d                   	pop    %ebp
+  801043:	c3                   	ret
+
+00801044 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801044:	55                   	push   %ebp
+  801045:	89 e5                	mov    %esp,%ebp
+  801047:	57                   	push   %edi
+  801048:	56                   	push   %esi
+  801049:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80104a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801052:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801055:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80105a:	89 df                	mov    %ebx,%edi
+  80105c:	89 de                	mov    %ebx,%esi
+  80105e:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801060:	5b                   	pop    %ebx
+  801061:	5e                   	pop    %esi
+  801062:	5f                   	pop    %edi
+  801063:	5d                   	pop    %ebp
+  801064:	c3                   	ret
+
+00801065 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801065:	55                   	push   %ebp
+  801066:	89 e5                	mov    %esp,%ebp
+  801068:	57                   	push   %edi
+  801069:	56                   	push   %esi
+  80106a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80106b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801070:	8b 55 08             	mov    0x8(%ebp),%edx
+  801073:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801076:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80107b:	89 df                	mov    %ebx,%edi
+  80107d:	89 de                	mov    %ebx,%esi
+  80107f:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801081:	5b                   	pop    %ebx
+  801082:	5e                   	pop    %esi
+  801083:	5f                   	pop    %edi
+  801084:	5d                   	pop    %ebp
+  801085:	c3                   	ret
+
+00801086 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108f:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  801092:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  801094:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  801097:	83 3a 01             	cmpl   $0x1,(%edx)
+  80109a:	7e 09                	jle    8010a5 <argstart+0x1f>
+  80109c:	ba b1 29 80 00       	mov    $0x8029b1,%edx
+  8010a1:	85 c9                	test   %ecx,%ecx
+  8010a3:	75 05                	jne    8010aa <argstart+0x24>
+  8010a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010aa:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  8010ad:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	c3                   	ret
+
+008010b6 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	53                   	push   %ebx
+  8010ba:	83 ec 04             	sub    $0x4,%esp
+  8010bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  8010c0:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  8010c7:	8b 43 08             	mov    0x8(%ebx),%eax
+  8010ca:	85 c0                	test   %eax,%eax
+  8010cc:	74 74                	je     801142 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  8010ce:	80 38 00             	cmpb   $0x0,(%eax)
+  8010d1:	75 48                	jne    80111b <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  8010d3:	8b 0b                	mov    (%ebx),%ecx
+  8010d5:	83 39 01             	cmpl   $0x1,(%ecx)
+  8010d8:	74 5a                	je     801134 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  8010da:	8b 53 04             	mov    0x4(%ebx),%edx
+  8010dd:	8b 42 04             	mov    0x4(%edx),%eax
+  8010e0:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8010e3:	75 4f                	jne    801134 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  8010e5:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8010e9:	74 49                	je     801134 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  8010eb:	83 c0 01             	add    $0x1,%eax
+  8010ee:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8010f1:	83 ec 04             	sub    $0x4,%esp
+  8010f4:	8b 01                	mov    (%ecx),%eax
+  8010f6:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8010fd:	50                   	push   %eax
+  8010fe:	8d 42 08             	lea    0x8(%edx),%eax
+  801101:	50                   	push   %eax
+  801102:	83 c2 04             	add    $0x4,%edx
+  801105:	52                   	push   %edx
+  801106:	e8 6f f8 ff ff       	call   80097a <memmove>
+		(*args->argc)--;
+  80110b:	8b 03                	mov    (%ebx),%eax
+  80110d:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801110:	8b 43 08             	mov    0x8(%ebx),%eax
+  801113:	83 c4 10             	add    $0x10,%esp
+  801116:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801119:	74 13                	je     80112e <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  80111b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80111e:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  801121:	83 c0 01             	add    $0x1,%eax
+  801124:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801127:	89 d0                	mov    %edx,%eax
+  801129:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80112c:	c9                   	leave
+  80112d:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  80112e:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801132:	75 e7                	jne    80111b <argnext+0x65>
+	args->curarg = 0;
+  801134:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  80113b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801140:	eb e5                	jmp    801127 <argnext+0x71>
+		return -1;
+  801142:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801147:	eb de                	jmp    801127 <argnext+0x71>
+
+00801149 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	53                   	push   %ebx
+  80114d:	83 ec 04             	sub    $0x4,%esp
+  801150:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  801153:	8b 43 08             	mov    0x8(%ebx),%eax
+  801156:	85 c0                	test   %eax,%eax
+  801158:	74 12                	je     80116c <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  80115a:	80 38 00             	cmpb   $0x0,(%eax)
+  80115d:	74 12                	je     801171 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  80115f:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  801162:	c7 43 08 b1 29 80 00 	movl   $0x8029b1,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  801169:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  80116c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80116f:	c9                   	leave
+  801170:	c3                   	ret
+	} else if (*args->argc > 1) {
+  801171:	8b 13                	mov    (%ebx),%edx
+  801173:	83 3a 01             	cmpl   $0x1,(%edx)
+  801176:	7f 10                	jg     801188 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  801178:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  80117f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801186:	eb e1                	jmp    801169 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801188:	8b 43 04             	mov    0x4(%ebx),%eax
+  80118b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80118e:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801191:	83 ec 04             	sub    $0x4,%esp
+  801194:	8b 12                	mov    (%edx),%edx
+  801196:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  80119d:	52                   	push   %edx
+  80119e:	8d 50 08             	lea    0x8(%eax),%edx
+  8011a1:	52                   	push   %edx
+  8011a2:	83 c0 04             	add    $0x4,%eax
+  8011a5:	50                   	push   %eax
+  8011a6:	e8 cf f7 ff ff       	call   80097a <memmove>
+		(*args->argc)--;
+  8011ab:	8b 03                	mov    (%ebx),%eax
+  8011ad:	83 28 01             	subl   $0x1,(%eax)
+  8011b0:	83 c4 10             	add    $0x10,%esp
+  8011b3:	eb b4                	jmp    801169 <argnextvalue+0x20>
+
+008011b5 <argvalue>:
+{
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	83 ec 08             	sub    $0x8,%esp
+  8011bb:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8011be:	8b 42 0c             	mov    0xc(%edx),%eax
+  8011c1:	85 c0                	test   %eax,%eax
+  8011c3:	74 02                	je     8011c7 <argvalue+0x12>
+}
+  8011c5:	c9                   	leave
+  8011c6:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8011c7:	83 ec 0c             	sub    $0xc,%esp
+  8011ca:	52                   	push   %edx
+  8011cb:	e8 79 ff ff ff       	call   801149 <argnextvalue>
+  8011d0:	83 c4 10             	add    $0x10,%esp
+  8011d3:	eb f0                	jmp    8011c5 <argvalue+0x10>
+
+008011d5 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011d5:	55                   	push   %ebp
+  8011d6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011db:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011e0:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011e3:	5d                   	pop    %ebp
+  8011e4:	c3                   	ret
+
+008011e5 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011e5:	55                   	push   %ebp
+  8011e6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011eb:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8011f0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011f5:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8011fa:	5d                   	pop    %ebp
+  8011fb:	c3                   	ret
+
+008011fc <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011fc:	55                   	push   %ebp
+  8011fd:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8011ff:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801204:	eb 02                	jmp    801208 <fd_alloc+0xc>
+  801206:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801208:	89 c2                	mov    %eax,%edx
+  80120a:	c1 ea 16             	shr    $0x16,%edx
+  80120d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801214:	f6 c2 01             	test   $0x1,%dl
+  801217:	74 2b                	je     801244 <fd_alloc+0x48>
+  801219:	89 c2                	mov    %eax,%edx
+  80121b:	c1 ea 0c             	shr    $0xc,%edx
+  80121e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801225:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80122b:	f6 c1 01             	test   $0x1,%cl
+  80122e:	74 14                	je     801244 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801230:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801236:	75 ce                	jne    801206 <fd_alloc+0xa>
+  801238:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80123d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801242:	eb 05                	jmp    801249 <fd_alloc+0x4d>
+			return 0;
+  801244:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801249:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124c:	89 02                	mov    %eax,(%edx)
+}
+  80124e:	89 c8                	mov    %ecx,%eax
+  801250:	5d                   	pop    %ebp
+  801251:	c3                   	ret
+
+00801252 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801252:	55                   	push   %ebp
+  801253:	89 e5                	mov    %esp,%ebp
+  801255:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801258:	83 f8 1f             	cmp    $0x1f,%eax
+  80125b:	77 30                	ja     80128d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80125d:	c1 e0 0c             	shl    $0xc,%eax
+  801260:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801265:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80126b:	f6 c2 01             	test   $0x1,%dl
+  80126e:	74 24                	je     801294 <fd_lookup+0x42>
+  801270:	89 c2                	mov    %eax,%edx
+  801272:	c1 ea 0c             	shr    $0xc,%edx
+  801275:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80127c:	f6 c2 01             	test   $0x1,%dl
+  80127f:	74 1a                	je     80129b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801281:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801284:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801286:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80128b:	5d                   	pop    %ebp
+  80128c:	c3                   	ret
+		return -E_INVAL;
+  80128d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801292:	eb f7                	jmp    80128b <fd_lookup+0x39>
+		return -E_INVAL;
+  801294:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801299:	eb f0                	jmp    80128b <fd_lookup+0x39>
+  80129b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012a0:	eb e9                	jmp    80128b <fd_lookup+0x39>
+
+008012a2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012a2:	55                   	push   %ebp
+  8012a3:	89 e5                	mov    %esp,%ebp
+  8012a5:	53                   	push   %ebx
+  8012a6:	83 ec 04             	sub    $0x4,%esp
+  8012a9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8012ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b1:	eb 03                	jmp    8012b6 <dev_lookup+0x14>
+  8012b3:	83 c0 01             	add    $0x1,%eax
+  8012b6:	8b 1c 85 88 2d 80 00 	mov    0x802d88(,%eax,4),%ebx
+  8012bd:	85 db                	test   %ebx,%ebx
+  8012bf:	74 0b                	je     8012cc <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8012c1:	39 13                	cmp    %edx,(%ebx)
+  8012c3:	75 ee                	jne    8012b3 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8012c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ca:	eb 1f                	jmp    8012eb <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012cc:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012d1:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8012d4:	83 ec 04             	sub    $0x4,%esp
+  8012d7:	52                   	push   %edx
+  8012d8:	50                   	push   %eax
+  8012d9:	68 0c 2d 80 00       	push   $0x802d0c
+  8012de:	e8 23 ef ff ff       	call   800206 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012e3:	83 c4 10             	add    $0x10,%esp
+  8012e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8012eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012ee:	89 1a                	mov    %ebx,(%edx)
+}
+  8012f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f3:	c9                   	leave
+  8012f4:	c3                   	ret
+
+008012f5 <fd_close>:
+{
+  8012f5:	55                   	push   %ebp
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	57                   	push   %edi
+  8012f9:	56                   	push   %esi
+  8012fa:	53                   	push   %ebx
+  8012fb:	83 ec 24             	sub    $0x24,%esp
+  8012fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801301:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801304:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801307:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801308:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80130e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801311:	50                   	push   %eax
+  801312:	e8 3b ff ff ff       	call   801252 <fd_lookup>
+  801317:	89 c3                	mov    %eax,%ebx
+  801319:	83 c4 10             	add    $0x10,%esp
+  80131c:	85 c0                	test   %eax,%eax
+  80131e:	78 05                	js     801325 <fd_close+0x30>
+	    || fd != fd2)
+  801320:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801323:	74 16                	je     80133b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801325:	89 f8                	mov    %edi,%eax
+  801327:	84 c0                	test   %al,%al
+  801329:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801331:	89 d8                	mov    %ebx,%eax
+  801333:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801336:	5b                   	pop    %ebx
+  801337:	5e                   	pop    %esi
+  801338:	5f                   	pop    %edi
+  801339:	5d                   	pop    %ebp
+  80133a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80133b:	83 ec 08             	sub    $0x8,%esp
+  80133e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801341:	50                   	push   %eax
+  801342:	ff 36                	push   (%esi)
+  801344:	e8 59 ff ff ff       	call   8012a2 <dev_lookup>
+  801349:	89 c3                	mov    %eax,%ebx
+  80134b:	83 c4 10             	add    $0x10,%esp
+  80134e:	85 c0                	test   %eax,%eax
+  801350:	78 1a                	js     80136c <fd_close+0x77>
+		if (dev->dev_close)
+  801352:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801355:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801358:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	74 0b                	je     80136c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801361:	83 ec 0c             	sub    $0xc,%esp
+  801364:	56                   	push   %esi
+  801365:	ff d0                	call   *%eax
+  801367:	89 c3                	mov    %eax,%ebx
+  801369:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80136c:	83 ec 08             	sub    $0x8,%esp
+  80136f:	56                   	push   %esi
+  801370:	6a 00                	push   $0x0
+  801372:	e8 b2 f9 ff ff       	call   800d29 <sys_page_unmap>
+	return r;
+  801377:	83 c4 10             	add    $0x10,%esp
+  80137a:	eb b5                	jmp    801331 <fd_close+0x3c>
+
+0080137c <close>:
+
+int
+close(int fdnum)
+{
+  80137c:	55                   	push   %ebp
+  80137d:	89 e5                	mov    %esp,%ebp
+  80137f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801382:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801385:	50                   	push   %eax
+  801386:	ff 75 08             	push   0x8(%ebp)
+  801389:	e8 c4 fe ff ff       	call   801252 <fd_lookup>
+  80138e:	83 c4 10             	add    $0x10,%esp
+  801391:	85 c0                	test   %eax,%eax
+  801393:	79 02                	jns    801397 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801395:	c9                   	leave
+  801396:	c3                   	ret
+		return fd_close(fd, 1);
+  801397:	83 ec 08             	sub    $0x8,%esp
+  80139a:	6a 01                	push   $0x1
+  80139c:	ff 75 f4             	push   -0xc(%ebp)
+  80139f:	e8 51 ff ff ff       	call   8012f5 <fd_close>
+  8013a4:	83 c4 10             	add    $0x10,%esp
+  8013a7:	eb ec                	jmp    801395 <close+0x19>
+
+008013a9 <close_all>:
+
+void
+close_all(void)
+{
+  8013a9:	55                   	push   %ebp
+  8013aa:	89 e5                	mov    %esp,%ebp
+  8013ac:	53                   	push   %ebx
+  8013ad:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8013b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8013b5:	83 ec 0c             	sub    $0xc,%esp
+  8013b8:	53                   	push   %ebx
+  8013b9:	e8 be ff ff ff       	call   80137c <close>
+	for (i = 0; i < MAXFD; i++)
+  8013be:	83 c3 01             	add    $0x1,%ebx
+  8013c1:	83 c4 10             	add    $0x10,%esp
+  8013c4:	83 fb 20             	cmp    $0x20,%ebx
+  8013c7:	75 ec                	jne    8013b5 <close_all+0xc>
+}
+  8013c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013cc:	c9                   	leave
+  8013cd:	c3                   	ret
+
+008013ce <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013ce:	55                   	push   %ebp
+  8013cf:	89 e5                	mov    %esp,%ebp
+  8013d1:	57                   	push   %edi
+  8013d2:	56                   	push   %esi
+  8013d3:	53                   	push   %ebx
+  8013d4:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013d7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013da:	50                   	push   %eax
+  8013db:	ff 75 08             	push   0x8(%ebp)
+  8013de:	e8 6f fe ff ff       	call   801252 <fd_lookup>
+  8013e3:	89 c3                	mov    %eax,%ebx
+  8013e5:	83 c4 10             	add    $0x10,%esp
+  8013e8:	85 c0                	test   %eax,%eax
+  8013ea:	78 7f                	js     80146b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8013ec:	83 ec 0c             	sub    $0xc,%esp
+  8013ef:	ff 75 0c             	push   0xc(%ebp)
+  8013f2:	e8 85 ff ff ff       	call   80137c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013f7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013fa:	c1 e6 0c             	shl    $0xc,%esi
+  8013fd:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801403:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801406:	89 3c 24             	mov    %edi,(%esp)
+  801409:	e8 d7 fd ff ff       	call   8011e5 <fd2data>
+  80140e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801410:	89 34 24             	mov    %esi,(%esp)
+  801413:	e8 cd fd ff ff       	call   8011e5 <fd2data>
+  801418:	83 c4 10             	add    $0x10,%esp
+  80141b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80141e:	89 d8                	mov    %ebx,%eax
+  801420:	c1 e8 16             	shr    $0x16,%eax
+  801423:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80142a:	a8 01                	test   $0x1,%al
+  80142c:	74 11                	je     80143f <dup+0x71>
+  80142e:	89 d8                	mov    %ebx,%eax
+  801430:	c1 e8 0c             	shr    $0xc,%eax
+  801433:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80143a:	f6 c2 01             	test   $0x1,%dl
+  80143d:	75 36                	jne    801475 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80143f:	89 f8                	mov    %edi,%eax
+  801441:	c1 e8 0c             	shr    $0xc,%eax
+  801444:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80144b:	83 ec 0c             	sub    $0xc,%esp
+  80144e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801453:	50                   	push   %eax
+  801454:	56                   	push   %esi
+  801455:	6a 00                	push   $0x0
+  801457:	57                   	push   %edi
+  801458:	6a 00                	push   $0x0
+  80145a:	e8 88 f8 ff ff       	call   800ce7 <sys_page_map>
+  80145f:	89 c3                	mov    %eax,%ebx
+  801461:	83 c4 20             	add    $0x20,%esp
+  801464:	85 c0                	test   %eax,%eax
+  801466:	78 33                	js     80149b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801468:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80146b:	89 d8                	mov    %ebx,%eax
+  80146d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801470:	5b                   	pop    %ebx
+  801471:	5e                   	pop    %esi
+  801472:	5f                   	pop    %edi
+  801473:	5d                   	pop    %ebp
+  801474:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801475:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80147c:	83 ec 0c             	sub    $0xc,%esp
+  80147f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801484:	50                   	push   %eax
+  801485:	ff 75 d4             	push   -0x2c(%ebp)
+  801488:	6a 00                	push   $0x0
+  80148a:	53                   	push   %ebx
+  80148b:	6a 00                	push   $0x0
+  80148d:	e8 55 f8 ff ff       	call   800ce7 <sys_page_map>
+  801492:	89 c3                	mov    %eax,%ebx
+  801494:	83 c4 20             	add    $0x20,%esp
+  801497:	85 c0                	test   %eax,%eax
+  801499:	79 a4                	jns    80143f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80149b:	83 ec 08             	sub    $0x8,%esp
+  80149e:	56                   	push   %esi
+  80149f:	6a 00                	push   $0x0
+  8014a1:	e8 83 f8 ff ff       	call   800d29 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8014a6:	83 c4 08             	add    $0x8,%esp
+  8014a9:	ff 75 d4             	push   -0x2c(%ebp)
+  8014ac:	6a 00                	push   $0x0
+  8014ae:	e8 76 f8 ff ff       	call   800d29 <sys_page_unmap>
+	return r;
+  8014b3:	83 c4 10             	add    $0x10,%esp
+  8014b6:	eb b3                	jmp    80146b <dup+0x9d>
+
+008014b8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014b8:	55                   	push   %ebp
+  8014b9:	89 e5                	mov    %esp,%ebp
+  8014bb:	56                   	push   %esi
+  8014bc:	53                   	push   %ebx
+  8014bd:	83 ec 18             	sub    $0x18,%esp
+  8014c0:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014c3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014c6:	50                   	push   %eax
+  8014c7:	56                   	push   %esi
+  8014c8:	e8 85 fd ff ff       	call   801252 <fd_lookup>
+  8014cd:	83 c4 10             	add    $0x10,%esp
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	78 3c                	js     801510 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014d4:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014d7:	83 ec 08             	sub    $0x8,%esp
+  8014da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014dd:	50                   	push   %eax
+  8014de:	ff 33                	push   (%ebx)
+  8014e0:	e8 bd fd ff ff       	call   8012a2 <dev_lookup>
+  8014e5:	83 c4 10             	add    $0x10,%esp
+  8014e8:	85 c0                	test   %eax,%eax
+  8014ea:	78 24                	js     801510 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014ec:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014ef:	83 e0 03             	and    $0x3,%eax
+  8014f2:	83 f8 01             	cmp    $0x1,%eax
+  8014f5:	74 20                	je     801517 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014fa:	8b 40 08             	mov    0x8(%eax),%eax
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	74 37                	je     801538 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801501:	83 ec 04             	sub    $0x4,%esp
+  801504:	ff 75 10             	push   0x10(%ebp)
+  801507:	ff 75 0c             	push   0xc(%ebp)
+  80150a:	53                   	push   %ebx
+  80150b:	ff d0                	call   *%eax
+  80150d:	83 c4 10             	add    $0x10,%esp
+}
+  801510:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801513:	5b                   	pop    %ebx
+  801514:	5e                   	pop    %esi
+  801515:	5d                   	pop    %ebp
+  801516:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801517:	a1 08 40 80 00       	mov    0x804008,%eax
+  80151c:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80151f:	83 ec 04             	sub    $0x4,%esp
+  801522:	56                   	push   %esi
+  801523:	50                   	push   %eax
+  801524:	68 4d 2d 80 00       	push   $0x802d4d
+  801529:	e8 d8 ec ff ff       	call   800206 <cprintf>
+		return -E_INVAL;
+  80152e:	83 c4 10             	add    $0x10,%esp
+  801531:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801536:	eb d8                	jmp    801510 <read+0x58>
+		return -E_NOT_SUPP;
+  801538:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80153d:	eb d1                	jmp    801510 <read+0x58>
+
+0080153f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80153f:	55                   	push   %ebp
+  801540:	89 e5                	mov    %esp,%ebp
+  801542:	57                   	push   %edi
+  801543:	56                   	push   %esi
+  801544:	53                   	push   %ebx
+  801545:	83 ec 0c             	sub    $0xc,%esp
+  801548:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80154b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80154e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801553:	eb 02                	jmp    801557 <readn+0x18>
+  801555:	01 c3                	add    %eax,%ebx
+  801557:	39 f3                	cmp    %esi,%ebx
+  801559:	73 21                	jae    80157c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80155b:	83 ec 04             	sub    $0x4,%esp
+  80155e:	89 f0                	mov    %esi,%eax
+  801560:	29 d8                	sub    %ebx,%eax
+  801562:	50                   	push   %eax
+  801563:	89 d8                	mov    %ebx,%eax
+  801565:	03 45 0c             	add    0xc(%ebp),%eax
+  801568:	50                   	push   %eax
+  801569:	57                   	push   %edi
+  80156a:	e8 49 ff ff ff       	call   8014b8 <read>
+		if (m < 0)
+  80156f:	83 c4 10             	add    $0x10,%esp
+  801572:	85 c0                	test   %eax,%eax
+  801574:	78 04                	js     80157a <readn+0x3b>
+			return m;
+		if (m == 0)
+  801576:	75 dd                	jne    801555 <readn+0x16>
+  801578:	eb 02                	jmp    80157c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80157a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80157c:	89 d8                	mov    %ebx,%eax
+  80157e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801581:	5b                   	pop    %ebx
+  801582:	5e                   	pop    %esi
+  801583:	5f                   	pop    %edi
+  801584:	5d                   	pop    %ebp
+  801585:	c3                   	ret
+
+00801586 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801586:	55                   	push   %ebp
+  801587:	89 e5                	mov    %esp,%ebp
+  801589:	56                   	push   %esi
+  80158a:	53                   	push   %ebx
+  80158b:	83 ec 18             	sub    $0x18,%esp
+  80158e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801591:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801594:	50                   	push   %eax
+  801595:	53                   	push   %ebx
+  801596:	e8 b7 fc ff ff       	call   801252 <fd_lookup>
+  80159b:	83 c4 10             	add    $0x10,%esp
+  80159e:	85 c0                	test   %eax,%eax
+  8015a0:	78 37                	js     8015d9 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015a2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015a5:	83 ec 08             	sub    $0x8,%esp
+  8015a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015ab:	50                   	push   %eax
+  8015ac:	ff 36                	push   (%esi)
+  8015ae:	e8 ef fc ff ff       	call   8012a2 <dev_lookup>
+  8015b3:	83 c4 10             	add    $0x10,%esp
+  8015b6:	85 c0                	test   %eax,%eax
+  8015b8:	78 1f                	js     8015d9 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015ba:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015be:	74 20                	je     8015e0 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015c3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015c6:	85 c0                	test   %eax,%eax
+  8015c8:	74 37                	je     801601 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015ca:	83 ec 04             	sub    $0x4,%esp
+  8015cd:	ff 75 10             	push   0x10(%ebp)
+  8015d0:	ff 75 0c             	push   0xc(%ebp)
+  8015d3:	56                   	push   %esi
+  8015d4:	ff d0                	call   *%eax
+  8015d6:	83 c4 10             	add    $0x10,%esp
+}
+  8015d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015dc:	5b                   	pop    %ebx
+  8015dd:	5e                   	pop    %esi
+  8015de:	5d                   	pop    %ebp
+  8015df:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015e0:	a1 08 40 80 00       	mov    0x804008,%eax
+  8015e5:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8015e8:	83 ec 04             	sub    $0x4,%esp
+  8015eb:	53                   	push   %ebx
+  8015ec:	50                   	push   %eax
+  8015ed:	68 69 2d 80 00       	push   $0x802d69
+  8015f2:	e8 0f ec ff ff       	call   800206 <cprintf>
+		return -E_INVAL;
+  8015f7:	83 c4 10             	add    $0x10,%esp
+  8015fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ff:	eb d8                	jmp    8015d9 <write+0x53>
+		return -E_NOT_SUPP;
+  801601:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801606:	eb d1                	jmp    8015d9 <write+0x53>
+
+00801608 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801608:	55                   	push   %ebp
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80160e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801611:	50                   	push   %eax
+  801612:	ff 75 08             	push   0x8(%ebp)
+  801615:	e8 38 fc ff ff       	call   801252 <fd_lookup>
+  80161a:	83 c4 10             	add    $0x10,%esp
+  80161d:	85 c0                	test   %eax,%eax
+  80161f:	78 0e                	js     80162f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801621:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801624:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801627:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80162a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80162f:	c9                   	leave
+  801630:	c3                   	ret
+
+00801631 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801631:	55                   	push   %ebp
+  801632:	89 e5                	mov    %esp,%ebp
+  801634:	56                   	push   %esi
+  801635:	53                   	push   %ebx
+  801636:	83 ec 18             	sub    $0x18,%esp
+  801639:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80163c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80163f:	50                   	push   %eax
+  801640:	53                   	push   %ebx
+  801641:	e8 0c fc ff ff       	call   801252 <fd_lookup>
+  801646:	83 c4 10             	add    $0x10,%esp
+  801649:	85 c0                	test   %eax,%eax
+  80164b:	78 34                	js     801681 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80164d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801650:	83 ec 08             	sub    $0x8,%esp
+  801653:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801656:	50                   	push   %eax
+  801657:	ff 36                	push   (%esi)
+  801659:	e8 44 fc ff ff       	call   8012a2 <dev_lookup>
+  80165e:	83 c4 10             	add    $0x10,%esp
+  801661:	85 c0                	test   %eax,%eax
+  801663:	78 1c                	js     801681 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801665:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801669:	74 1d                	je     801688 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80166b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80166e:	8b 40 18             	mov    0x18(%eax),%eax
+  801671:	85 c0                	test   %eax,%eax
+  801673:	74 34                	je     8016a9 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801675:	83 ec 08             	sub    $0x8,%esp
+  801678:	ff 75 0c             	push   0xc(%ebp)
+  80167b:	56                   	push   %esi
+  80167c:	ff d0                	call   *%eax
+  80167e:	83 c4 10             	add    $0x10,%esp
+}
+  801681:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801684:	5b                   	pop    %ebx
+  801685:	5e                   	pop    %esi
+  801686:	5d                   	pop    %ebp
+  801687:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801688:	a1 08 40 80 00       	mov    0x804008,%eax
+  80168d:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801690:	83 ec 04             	sub    $0x4,%esp
+  801693:	53                   	push   %ebx
+  801694:	50                   	push   %eax
+  801695:	68 2c 2d 80 00       	push   $0x802d2c
+  80169a:	e8 67 eb ff ff       	call   800206 <cprintf>
+		return -E_INVAL;
+  80169f:	83 c4 10             	add    $0x10,%esp
+  8016a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a7:	eb d8                	jmp    801681 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016a9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016ae:	eb d1                	jmp    801681 <ftruncate+0x50>
+
+008016b0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016b0:	55                   	push   %ebp
+  8016b1:	89 e5                	mov    %esp,%ebp
+  8016b3:	56                   	push   %esi
+  8016b4:	53                   	push   %ebx
+  8016b5:	83 ec 18             	sub    $0x18,%esp
+  8016b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016bb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016be:	50                   	push   %eax
+  8016bf:	ff 75 08             	push   0x8(%ebp)
+  8016c2:	e8 8b fb ff ff       	call   801252 <fd_lookup>
+  8016c7:	83 c4 10             	add    $0x10,%esp
+  8016ca:	85 c0                	test   %eax,%eax
+  8016cc:	78 49                	js     801717 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016ce:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016d1:	83 ec 08             	sub    $0x8,%esp
+  8016d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d7:	50                   	push   %eax
+  8016d8:	ff 36                	push   (%esi)
+  8016da:	e8 c3 fb ff ff       	call   8012a2 <dev_lookup>
+  8016df:	83 c4 10             	add    $0x10,%esp
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	78 31                	js     801717 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e9:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016ed:	74 2f                	je     80171e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016ef:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016f2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016f9:	00 00 00 
+	stat->st_isdir = 0;
+  8016fc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801703:	00 00 00 
+	stat->st_dev = dev;
+  801706:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80170c:	83 ec 08             	sub    $0x8,%esp
+  80170f:	53                   	push   %ebx
+  801710:	56                   	push   %esi
+  801711:	ff 50 14             	call   *0x14(%eax)
+  801714:	83 c4 10             	add    $0x10,%esp
+}
+  801717:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80171a:	5b                   	pop    %ebx
+  80171b:	5e                   	pop    %esi
+  80171c:	5d                   	pop    %ebp
+  80171d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80171e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801723:	eb f2                	jmp    801717 <fstat+0x67>
+
+00801725 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801725:	55                   	push   %ebp
+  801726:	89 e5                	mov    %esp,%ebp
+  801728:	56                   	push   %esi
+  801729:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80172a:	83 ec 08             	sub    $0x8,%esp
+  80172d:	6a 00                	push   $0x0
+  80172f:	ff 75 08             	push   0x8(%ebp)
+  801732:	e8 e4 01 00 00       	call   80191b <open>
+  801737:	89 c3                	mov    %eax,%ebx
+  801739:	83 c4 10             	add    $0x10,%esp
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	78 1b                	js     80175b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801740:	83 ec 08             	sub    $0x8,%esp
+  801743:	ff 75 0c             	push   0xc(%ebp)
+  801746:	50                   	push   %eax
+  801747:	e8 64 ff ff ff       	call   8016b0 <fstat>
+  80174c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80174e:	89 1c 24             	mov    %ebx,(%esp)
+  801751:	e8 26 fc ff ff       	call   80137c <close>
+	return r;
+  801756:	83 c4 10             	add    $0x10,%esp
+  801759:	89 f3                	mov    %esi,%ebx
+}
+  80175b:	89 d8                	mov    %ebx,%eax
+  80175d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801760:	5b                   	pop    %ebx
+  801761:	5e                   	pop    %esi
+  801762:	5d                   	pop    %ebp
+  801763:	c3                   	ret
+
+00801764 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801764:	55                   	push   %ebp
+  801765:	89 e5                	mov    %esp,%ebp
+  801767:	56                   	push   %esi
+  801768:	53                   	push   %ebx
+  801769:	89 c6                	mov    %eax,%esi
+  80176b:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80176d:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801774:	74 27                	je     80179d <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801776:	6a 07                	push   $0x7
+  801778:	68 00 50 80 00       	push   $0x805000
+  80177d:	56                   	push   %esi
+  80177e:	ff 35 00 40 80 00    	push   0x804000
+  801784:	e8 2f 0d 00 00       	call   8024b8 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801789:	83 c4 0c             	add    $0xc,%esp
+  80178c:	6a 00                	push   $0x0
+  80178e:	53                   	push   %ebx
+  80178f:	6a 00                	push   $0x0
+  801791:	e8 aa 0c 00 00       	call   802440 <ipc_recv>
+}
+  801796:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801799:	5b                   	pop    %ebx
+  80179a:	5e                   	pop    %esi
+  80179b:	5d                   	pop    %ebp
+  80179c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80179d:	83 ec 0c             	sub    $0xc,%esp
+  8017a0:	6a 01                	push   $0x1
+  8017a2:	e8 65 0d 00 00       	call   80250c <ipc_find_env>
+  8017a7:	a3 00 40 80 00       	mov    %eax,0x804000
+  8017ac:	83 c4 10             	add    $0x10,%esp
+  8017af:	eb c5                	jmp    801776 <fsipc+0x12>
+
+008017b1 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017b1:	55                   	push   %ebp
+  8017b2:	89 e5                	mov    %esp,%ebp
+  8017b4:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ba:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017bd:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8017c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017c5:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8017ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017cf:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017d4:	e8 8b ff ff ff       	call   801764 <fsipc>
+}
+  8017d9:	c9                   	leave
+  8017da:	c3                   	ret
+
+008017db <devfile_flush>:
+{
+  8017db:	55                   	push   %ebp
+  8017dc:	89 e5                	mov    %esp,%ebp
+  8017de:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017e7:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8017ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017f6:	e8 69 ff ff ff       	call   801764 <fsipc>
+}
+  8017fb:	c9                   	leave
+  8017fc:	c3                   	ret
+
+008017fd <devfile_stat>:
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+  801800:	53                   	push   %ebx
+  801801:	83 ec 04             	sub    $0x4,%esp
+  801804:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80180d:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801812:	ba 00 00 00 00       	mov    $0x0,%edx
+  801817:	b8 05 00 00 00       	mov    $0x5,%eax
+  80181c:	e8 43 ff ff ff       	call   801764 <fsipc>
+  801821:	85 c0                	test   %eax,%eax
+  801823:	78 2c                	js     801851 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801825:	83 ec 08             	sub    $0x8,%esp
+  801828:	68 00 50 80 00       	push   $0x805000
+  80182d:	53                   	push   %ebx
+  80182e:	e8 c1 ef ff ff       	call   8007f4 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801833:	a1 80 50 80 00       	mov    0x805080,%eax
+  801838:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80183e:	a1 84 50 80 00       	mov    0x805084,%eax
+  801843:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801849:	83 c4 10             	add    $0x10,%esp
+  80184c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801851:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801854:	c9                   	leave
+  801855:	c3                   	ret
+
+00801856 <devfile_write>:
+{
+  801856:	55                   	push   %ebp
+  801857:	89 e5                	mov    %esp,%ebp
+  801859:	83 ec 0c             	sub    $0xc,%esp
+  80185c:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80185f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801864:	39 d0                	cmp    %edx,%eax
+  801866:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801869:	8b 55 08             	mov    0x8(%ebp),%edx
+  80186c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80186f:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801875:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80187a:	50                   	push   %eax
+  80187b:	ff 75 0c             	push   0xc(%ebp)
+  80187e:	68 08 50 80 00       	push   $0x805008
+  801883:	e8 f2 f0 ff ff       	call   80097a <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801888:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801892:	e8 cd fe ff ff       	call   801764 <fsipc>
+}
+  801897:	c9                   	leave
+  801898:	c3                   	ret
+
+00801899 <devfile_read>:
+{
+  801899:	55                   	push   %ebp
+  80189a:	89 e5                	mov    %esp,%ebp
+  80189c:	56                   	push   %esi
+  80189d:	53                   	push   %ebx
+  80189e:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8018a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018a7:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  8018ac:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8018b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018bc:	e8 a3 fe ff ff       	call   801764 <fsipc>
+  8018c1:	89 c3                	mov    %eax,%ebx
+  8018c3:	85 c0                	test   %eax,%eax
+  8018c5:	78 1f                	js     8018e6 <devfile_read+0x4d>
+	assert(r <= n);
+  8018c7:	39 c6                	cmp    %eax,%esi
+  8018c9:	72 24                	jb     8018ef <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8018cb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8018d0:	7f 33                	jg     801905 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8018d2:	83 ec 04             	sub    $0x4,%esp
+  8018d5:	50                   	push   %eax
+  8018d6:	68 00 50 80 00       	push   $0x805000
+  8018db:	ff 75 0c             	push   0xc(%ebp)
+  8018de:	e8 97 f0 ff ff       	call   80097a <memmove>
+	return r;
+  8018e3:	83 c4 10             	add    $0x10,%esp
+}
+  8018e6:	89 d8                	mov    %ebx,%eax
+  8018e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018eb:	5b                   	pop    %ebx
+  8018ec:	5e                   	pop    %esi
+  8018ed:	5d                   	pop    %ebp
+  8018ee:	c3                   	ret
+	assert(r <= n);
+  8018ef:	68 9c 2d 80 00       	push   $0x802d9c
+  8018f4:	68 a3 2d 80 00       	push   $0x802da3
+  8018f9:	6a 7c                	push   $0x7c
+  8018fb:	68 b8 2d 80 00       	push   $0x802db8
+  801900:	e8 f5 0a 00 00       	call   8023fa <_panic>
+	assert(r <= PGSIZE);
+  801905:	68 c3 2d 80 00       	push   $0x802dc3
+  80190a:	68 a3 2d 80 00       	push   $0x802da3
+  80190f:	6a 7d                	push   $0x7d
+  801911:	68 b8 2d 80 00       	push   $0x802db8
+  801916:	e8 df 0a 00 00       	call   8023fa <_panic>
+
+0080191b <open>:
+{
+  80191b:	55                   	push   %ebp
+  80191c:	89 e5                	mov    %esp,%ebp
+  80191e:	56                   	push   %esi
+  80191f:	53                   	push   %ebx
+  801920:	83 ec 1c             	sub    $0x1c,%esp
+  801923:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801926:	56                   	push   %esi
+  801927:	e8 8d ee ff ff       	call   8007b9 <strlen>
+  80192c:	83 c4 10             	add    $0x10,%esp
+  80192f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801934:	7f 6c                	jg     8019a2 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801936:	83 ec 0c             	sub    $0xc,%esp
+  801939:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80193c:	50                   	push   %eax
+  80193d:	e8 ba f8 ff ff       	call   8011fc <fd_alloc>
+  801942:	89 c3                	mov    %eax,%ebx
+  801944:	83 c4 10             	add    $0x10,%esp
+  801947:	85 c0                	test   %eax,%eax
+  801949:	78 3c                	js     801987 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80194b:	83 ec 08             	sub    $0x8,%esp
+  80194e:	56                   	push   %esi
+  80194f:	68 00 50 80 00       	push   $0x805000
+  801954:	e8 9b ee ff ff       	call   8007f4 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801959:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80195c:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801961:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801964:	b8 01 00 00 00       	mov    $0x1,%eax
+  801969:	e8 f6 fd ff ff       	call   801764 <fsipc>
+  80196e:	89 c3                	mov    %eax,%ebx
+  801970:	83 c4 10             	add    $0x10,%esp
+  801973:	85 c0                	test   %eax,%eax
+  801975:	78 19                	js     801990 <open+0x75>
+	return fd2num(fd);
+  801977:	83 ec 0c             	sub    $0xc,%esp
+  80197a:	ff 75 f4             	push   -0xc(%ebp)
+  80197d:	e8 53 f8 ff ff       	call   8011d5 <fd2num>
+  801982:	89 c3                	mov    %eax,%ebx
+  801984:	83 c4 10             	add    $0x10,%esp
+}
+  801987:	89 d8                	mov    %ebx,%eax
+  801989:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80198c:	5b                   	pop    %ebx
+  80198d:	5e                   	pop    %esi
+  80198e:	5d                   	pop    %ebp
+  80198f:	c3                   	ret
+		fd_close(fd, 0);
+  801990:	83 ec 08             	sub    $0x8,%esp
+  801993:	6a 00                	push   $0x0
+  801995:	ff 75 f4             	push   -0xc(%ebp)
+  801998:	e8 58 f9 ff ff       	call   8012f5 <fd_close>
+		return r;
+  80199d:	83 c4 10             	add    $0x10,%esp
+  8019a0:	eb e5                	jmp    801987 <open+0x6c>
+		return -E_BAD_PATH;
+  8019a2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8019a7:	eb de                	jmp    801987 <open+0x6c>
+
+008019a9 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8019a9:	55                   	push   %ebp
+  8019aa:	89 e5                	mov    %esp,%ebp
+  8019ac:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8019af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019b9:	e8 a6 fd ff ff       	call   801764 <fsipc>
+}
+  8019be:	c9                   	leave
+  8019bf:	c3                   	ret
+
+008019c0 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8019c0:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8019c4:	7f 01                	jg     8019c7 <writebuf+0x7>
+  8019c6:	c3                   	ret
+{
+  8019c7:	55                   	push   %ebp
+  8019c8:	89 e5                	mov    %esp,%ebp
+  8019ca:	53                   	push   %ebx
+  8019cb:	83 ec 08             	sub    $0x8,%esp
+  8019ce:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8019d0:	ff 70 04             	push   0x4(%eax)
+  8019d3:	8d 40 10             	lea    0x10(%eax),%eax
+  8019d6:	50                   	push   %eax
+  8019d7:	ff 33                	push   (%ebx)
+  8019d9:	e8 a8 fb ff ff       	call   801586 <write>
+		if (result > 0)
+  8019de:	83 c4 10             	add    $0x10,%esp
+  8019e1:	85 c0                	test   %eax,%eax
+  8019e3:	7e 03                	jle    8019e8 <writebuf+0x28>
+			b->result += result;
+  8019e5:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  8019e8:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8019eb:	74 0d                	je     8019fa <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  8019ed:	85 c0                	test   %eax,%eax
+  8019ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f4:	0f 4f c2             	cmovg  %edx,%eax
+  8019f7:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  8019fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019fd:	c9                   	leave
+  8019fe:	c3                   	ret
+
+008019ff <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8019ff:	55                   	push   %ebp
+  801a00:	89 e5                	mov    %esp,%ebp
+  801a02:	53                   	push   %ebx
+  801a03:	83 ec 04             	sub    $0x4,%esp
+  801a06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801a09:	8b 53 04             	mov    0x4(%ebx),%edx
+  801a0c:	8d 42 01             	lea    0x1(%edx),%eax
+  801a0f:	89 43 04             	mov    %eax,0x4(%ebx)
+  801a12:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801a15:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801a19:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801a1e:	74 05                	je     801a25 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801a20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a23:	c9                   	leave
+  801a24:	c3                   	ret
+		writebuf(b);
+  801a25:	89 d8                	mov    %ebx,%eax
+  801a27:	e8 94 ff ff ff       	call   8019c0 <writebuf>
+		b->idx = 0;
+  801a2c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801a33:	eb eb                	jmp    801a20 <putch+0x21>
+
+00801a35 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801a35:	55                   	push   %ebp
+  801a36:	89 e5                	mov    %esp,%ebp
+  801a38:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801a3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a41:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801a47:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801a4e:	00 00 00 
+	b.result = 0;
+  801a51:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801a58:	00 00 00 
+	b.error = 1;
+  801a5b:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801a62:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801a65:	ff 75 10             	push   0x10(%ebp)
+  801a68:	ff 75 0c             	push   0xc(%ebp)
+  801a6b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801a71:	50                   	push   %eax
+  801a72:	68 ff 19 80 00       	push   $0x8019ff
+  801a77:	e8 81 e8 ff ff       	call   8002fd <vprintfmt>
+	if (b.idx > 0)
+  801a7c:	83 c4 10             	add    $0x10,%esp
+  801a7f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801a86:	7f 12                	jg     801a9a <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801a88:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801a8e:	85 c0                	test   %eax,%eax
+  801a90:	75 06                	jne    801a98 <vfprintf+0x63>
+  801a92:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801a98:	c9                   	leave
+  801a99:	c3                   	ret
+		writebuf(&b);
+  801a9a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801aa0:	e8 1b ff ff ff       	call   8019c0 <writebuf>
+  801aa5:	eb e1                	jmp    801a88 <vfprintf+0x53>
+
+00801aa7 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801aa7:	55                   	push   %ebp
+  801aa8:	89 e5                	mov    %esp,%ebp
+  801aaa:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801aad:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801ab0:	50                   	push   %eax
+  801ab1:	ff 75 0c             	push   0xc(%ebp)
+  801ab4:	ff 75 08             	push   0x8(%ebp)
+  801ab7:	e8 79 ff ff ff       	call   801a35 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801abc:	c9                   	leave
+  801abd:	c3                   	ret
+
+00801abe <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801abe:	55                   	push   %ebp
+  801abf:	89 e5                	mov    %esp,%ebp
+  801ac1:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801ac4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801ac7:	50                   	push   %eax
+  801ac8:	ff 75 08             	push   0x8(%ebp)
+  801acb:	6a 01                	push   $0x1
+  801acd:	e8 63 ff ff ff       	call   801a35 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801ad2:	c9                   	leave
+  801ad3:	c3                   	ret
+
+00801ad4 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ad4:	55                   	push   %ebp
+  801ad5:	89 e5                	mov    %esp,%ebp
+  801ad7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801ada:	68 cf 2d 80 00       	push   $0x802dcf
+  801adf:	ff 75 0c             	push   0xc(%ebp)
+  801ae2:	e8 0d ed ff ff       	call   8007f4 <strcpy>
+	return 0;
+}
+  801ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aec:	c9                   	leave
+  801aed:	c3                   	ret
+
+00801aee <devsock_close>:
+{
+  801aee:	55                   	push   %ebp
+  801aef:	89 e5                	mov    %esp,%ebp
+  801af1:	53                   	push   %ebx
+  801af2:	83 ec 10             	sub    $0x10,%esp
+  801af5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801af8:	53                   	push   %ebx
+  801af9:	e8 1e 0a 00 00       	call   80251c <pageref>
+  801afe:	89 c2                	mov    %eax,%edx
+  801b00:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801b03:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801b08:	83 fa 01             	cmp    $0x1,%edx
+  801b0b:	74 05                	je     801b12 <devsock_close+0x24>
+}
+  801b0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b10:	c9                   	leave
+  801b11:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801b12:	83 ec 0c             	sub    $0xc,%esp
+  801b15:	ff 73 0c             	push   0xc(%ebx)
+  801b18:	e8 b7 02 00 00       	call   801dd4 <nsipc_close>
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	eb eb                	jmp    801b0d <devsock_close+0x1f>
+
+00801b22 <devsock_write>:
+{
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801b28:	6a 00                	push   $0x0
+  801b2a:	ff 75 10             	push   0x10(%ebp)
+  801b2d:	ff 75 0c             	push   0xc(%ebp)
+  801b30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b33:	ff 70 0c             	push   0xc(%eax)
+  801b36:	e8 79 03 00 00       	call   801eb4 <nsipc_send>
+}
+  801b3b:	c9                   	leave
+  801b3c:	c3                   	ret
+
+00801b3d <devsock_read>:
+{
+  801b3d:	55                   	push   %ebp
+  801b3e:	89 e5                	mov    %esp,%ebp
+  801b40:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801b43:	6a 00                	push   $0x0
+  801b45:	ff 75 10             	push   0x10(%ebp)
+  801b48:	ff 75 0c             	push   0xc(%ebp)
+  801b4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4e:	ff 70 0c             	push   0xc(%eax)
+  801b51:	e8 ef 02 00 00       	call   801e45 <nsipc_recv>
+}
+  801b56:	c9                   	leave
+  801b57:	c3                   	ret
+
+00801b58 <fd2sockid>:
+{
+  801b58:	55                   	push   %ebp
+  801b59:	89 e5                	mov    %esp,%ebp
+  801b5b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801b5e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b61:	52                   	push   %edx
+  801b62:	50                   	push   %eax
+  801b63:	e8 ea f6 ff ff       	call   801252 <fd_lookup>
+  801b68:	83 c4 10             	add    $0x10,%esp
+  801b6b:	85 c0                	test   %eax,%eax
+  801b6d:	78 10                	js     801b7f <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801b6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b72:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801b78:	39 08                	cmp    %ecx,(%eax)
+  801b7a:	75 05                	jne    801b81 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801b7c:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801b7f:	c9                   	leave
+  801b80:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b81:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b86:	eb f7                	jmp    801b7f <fd2sockid+0x27>
+
+00801b88 <alloc_sockfd>:
+{
+  801b88:	55                   	push   %ebp
+  801b89:	89 e5                	mov    %esp,%ebp
+  801b8b:	56                   	push   %esi
+  801b8c:	53                   	push   %ebx
+  801b8d:	83 ec 1c             	sub    $0x1c,%esp
+  801b90:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801b92:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b95:	50                   	push   %eax
+  801b96:	e8 61 f6 ff ff       	call   8011fc <fd_alloc>
+  801b9b:	89 c3                	mov    %eax,%ebx
+  801b9d:	83 c4 10             	add    $0x10,%esp
+  801ba0:	85 c0                	test   %eax,%eax
+  801ba2:	78 43                	js     801be7 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ba4:	83 ec 04             	sub    $0x4,%esp
+  801ba7:	68 07 04 00 00       	push   $0x407
+  801bac:	ff 75 f4             	push   -0xc(%ebp)
+  801baf:	6a 00                	push   $0x0
+  801bb1:	e8 ab f0 ff ff       	call   800c61 <sys_page_alloc>
+  801bb6:	89 c3                	mov    %eax,%ebx
+  801bb8:	83 c4 10             	add    $0x10,%esp
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	78 28                	js     801be7 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801bbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bc2:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801bc8:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801bca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bcd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801bd4:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801bd7:	83 ec 0c             	sub    $0xc,%esp
+  801bda:	50                   	push   %eax
+  801bdb:	e8 f5 f5 ff ff       	call   8011d5 <fd2num>
+  801be0:	89 c3                	mov    %eax,%ebx
+  801be2:	83 c4 10             	add    $0x10,%esp
+  801be5:	eb 0c                	jmp    801bf3 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801be7:	83 ec 0c             	sub    $0xc,%esp
+  801bea:	56                   	push   %esi
+  801beb:	e8 e4 01 00 00       	call   801dd4 <nsipc_close>
+		return r;
+  801bf0:	83 c4 10             	add    $0x10,%esp
+}
+  801bf3:	89 d8                	mov    %ebx,%eax
+  801bf5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf8:	5b                   	pop    %ebx
+  801bf9:	5e                   	pop    %esi
+  801bfa:	5d                   	pop    %ebp
+  801bfb:	c3                   	ret
+
+00801bfc <accept>:
+{
+  801bfc:	55                   	push   %ebp
+  801bfd:	89 e5                	mov    %esp,%ebp
+  801bff:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c05:	e8 4e ff ff ff       	call   801b58 <fd2sockid>
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 1b                	js     801c29 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801c0e:	83 ec 04             	sub    $0x4,%esp
+  801c11:	ff 75 10             	push   0x10(%ebp)
+  801c14:	ff 75 0c             	push   0xc(%ebp)
+  801c17:	50                   	push   %eax
+  801c18:	e8 0e 01 00 00       	call   801d2b <nsipc_accept>
+  801c1d:	83 c4 10             	add    $0x10,%esp
+  801c20:	85 c0                	test   %eax,%eax
+  801c22:	78 05                	js     801c29 <accept+0x2d>
+	return alloc_sockfd(r);
+  801c24:	e8 5f ff ff ff       	call   801b88 <alloc_sockfd>
+}
+  801c29:	c9                   	leave
+  801c2a:	c3                   	ret
+
+00801c2b <bind>:
+{
+  801c2b:	55                   	push   %ebp
+  801c2c:	89 e5                	mov    %esp,%ebp
+  801c2e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c31:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c34:	e8 1f ff ff ff       	call   801b58 <fd2sockid>
+  801c39:	85 c0                	test   %eax,%eax
+  801c3b:	78 12                	js     801c4f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801c3d:	83 ec 04             	sub    $0x4,%esp
+  801c40:	ff 75 10             	push   0x10(%ebp)
+  801c43:	ff 75 0c             	push   0xc(%ebp)
+  801c46:	50                   	push   %eax
+  801c47:	e8 31 01 00 00       	call   801d7d <nsipc_bind>
+  801c4c:	83 c4 10             	add    $0x10,%esp
+}
+  801c4f:	c9                   	leave
+  801c50:	c3                   	ret
+
+00801c51 <shutdown>:
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c57:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c5a:	e8 f9 fe ff ff       	call   801b58 <fd2sockid>
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	78 0f                	js     801c72 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801c63:	83 ec 08             	sub    $0x8,%esp
+  801c66:	ff 75 0c             	push   0xc(%ebp)
+  801c69:	50                   	push   %eax
+  801c6a:	e8 43 01 00 00       	call   801db2 <nsipc_shutdown>
+  801c6f:	83 c4 10             	add    $0x10,%esp
+}
+  801c72:	c9                   	leave
+  801c73:	c3                   	ret
+
+00801c74 <connect>:
+{
+  801c74:	55                   	push   %ebp
+  801c75:	89 e5                	mov    %esp,%ebp
+  801c77:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7d:	e8 d6 fe ff ff       	call   801b58 <fd2sockid>
+  801c82:	85 c0                	test   %eax,%eax
+  801c84:	78 12                	js     801c98 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801c86:	83 ec 04             	sub    $0x4,%esp
+  801c89:	ff 75 10             	push   0x10(%ebp)
+  801c8c:	ff 75 0c             	push   0xc(%ebp)
+  801c8f:	50                   	push   %eax
+  801c90:	e8 59 01 00 00       	call   801dee <nsipc_connect>
+  801c95:	83 c4 10             	add    $0x10,%esp
+}
+  801c98:	c9                   	leave
+  801c99:	c3                   	ret
+
+00801c9a <listen>:
+{
+  801c9a:	55                   	push   %ebp
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ca0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca3:	e8 b0 fe ff ff       	call   801b58 <fd2sockid>
+  801ca8:	85 c0                	test   %eax,%eax
+  801caa:	78 0f                	js     801cbb <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801cac:	83 ec 08             	sub    $0x8,%esp
+  801caf:	ff 75 0c             	push   0xc(%ebp)
+  801cb2:	50                   	push   %eax
+  801cb3:	e8 6b 01 00 00       	call   801e23 <nsipc_listen>
+  801cb8:	83 c4 10             	add    $0x10,%esp
+}
+  801cbb:	c9                   	leave
+  801cbc:	c3                   	ret
+
+00801cbd <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801cbd:	55                   	push   %ebp
+  801cbe:	89 e5                	mov    %esp,%ebp
+  801cc0:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801cc3:	ff 75 10             	push   0x10(%ebp)
+  801cc6:	ff 75 0c             	push   0xc(%ebp)
+  801cc9:	ff 75 08             	push   0x8(%ebp)
+  801ccc:	e8 41 02 00 00       	call   801f12 <nsipc_socket>
+  801cd1:	83 c4 10             	add    $0x10,%esp
+  801cd4:	85 c0                	test   %eax,%eax
+  801cd6:	78 05                	js     801cdd <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801cd8:	e8 ab fe ff ff       	call   801b88 <alloc_sockfd>
+}
+  801cdd:	c9                   	leave
+  801cde:	c3                   	ret
+
+00801cdf <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801cdf:	55                   	push   %ebp
+  801ce0:	89 e5                	mov    %esp,%ebp
+  801ce2:	53                   	push   %ebx
+  801ce3:	83 ec 04             	sub    $0x4,%esp
+  801ce6:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801ce8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cef:	74 26                	je     801d17 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801cf1:	6a 07                	push   $0x7
+  801cf3:	68 00 60 80 00       	push   $0x806000
+  801cf8:	53                   	push   %ebx
+  801cf9:	ff 35 04 40 80 00    	push   0x804004
+  801cff:	e8 b4 07 00 00       	call   8024b8 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801d04:	83 c4 0c             	add    $0xc,%esp
+  801d07:	6a 00                	push   $0x0
+  801d09:	6a 00                	push   $0x0
+  801d0b:	6a 00                	push   $0x0
+  801d0d:	e8 2e 07 00 00       	call   802440 <ipc_recv>
+}
+  801d12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d15:	c9                   	leave
+  801d16:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801d17:	83 ec 0c             	sub    $0xc,%esp
+  801d1a:	6a 02                	push   $0x2
+  801d1c:	e8 eb 07 00 00       	call   80250c <ipc_find_env>
+  801d21:	a3 04 40 80 00       	mov    %eax,0x804004
+  801d26:	83 c4 10             	add    $0x10,%esp
+  801d29:	eb c6                	jmp    801cf1 <nsipc+0x12>
+
+00801d2b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801d2b:	55                   	push   %ebp
+  801d2c:	89 e5                	mov    %esp,%ebp
+  801d2e:	56                   	push   %esi
+  801d2f:	53                   	push   %ebx
+  801d30:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801d33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d36:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801d3b:	8b 06                	mov    (%esi),%eax
+  801d3d:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801d42:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d47:	e8 93 ff ff ff       	call   801cdf <nsipc>
+  801d4c:	89 c3                	mov    %eax,%ebx
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	79 09                	jns    801d5b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801d52:	89 d8                	mov    %ebx,%eax
+  801d54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d57:	5b                   	pop    %ebx
+  801d58:	5e                   	pop    %esi
+  801d59:	5d                   	pop    %ebp
+  801d5a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801d5b:	83 ec 04             	sub    $0x4,%esp
+  801d5e:	ff 35 10 60 80 00    	push   0x806010
+  801d64:	68 00 60 80 00       	push   $0x806000
+  801d69:	ff 75 0c             	push   0xc(%ebp)
+  801d6c:	e8 09 ec ff ff       	call   80097a <memmove>
+		*addrlen = ret->ret_addrlen;
+  801d71:	a1 10 60 80 00       	mov    0x806010,%eax
+  801d76:	89 06                	mov    %eax,(%esi)
+  801d78:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801d7b:	eb d5                	jmp    801d52 <nsipc_accept+0x27>
+
+00801d7d <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801d7d:	55                   	push   %ebp
+  801d7e:	89 e5                	mov    %esp,%ebp
+  801d80:	53                   	push   %ebx
+  801d81:	83 ec 08             	sub    $0x8,%esp
+  801d84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801d87:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8a:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801d8f:	53                   	push   %ebx
+  801d90:	ff 75 0c             	push   0xc(%ebp)
+  801d93:	68 04 60 80 00       	push   $0x806004
+  801d98:	e8 dd eb ff ff       	call   80097a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801d9d:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801da3:	b8 02 00 00 00       	mov    $0x2,%eax
+  801da8:	e8 32 ff ff ff       	call   801cdf <nsipc>
+}
+  801dad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801db0:	c9                   	leave
+  801db1:	c3                   	ret
+
+00801db2 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801db2:	55                   	push   %ebp
+  801db3:	89 e5                	mov    %esp,%ebp
+  801db5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801db8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dbb:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801dc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dc3:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801dc8:	b8 03 00 00 00       	mov    $0x3,%eax
+  801dcd:	e8 0d ff ff ff       	call   801cdf <nsipc>
+}
+  801dd2:	c9                   	leave
+  801dd3:	c3                   	ret
+
+00801dd4 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801dd4:	55                   	push   %ebp
+  801dd5:	89 e5                	mov    %esp,%ebp
+  801dd7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801dda:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ddd:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801de2:	b8 04 00 00 00       	mov    $0x4,%eax
+  801de7:	e8 f3 fe ff ff       	call   801cdf <nsipc>
+}
+  801dec:	c9                   	leave
+  801ded:	c3                   	ret
+
+00801dee <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801dee:	55                   	push   %ebp
+  801def:	89 e5                	mov    %esp,%ebp
+  801df1:	53                   	push   %ebx
+  801df2:	83 ec 08             	sub    $0x8,%esp
+  801df5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801df8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dfb:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801e00:	53                   	push   %ebx
+  801e01:	ff 75 0c             	push   0xc(%ebp)
+  801e04:	68 04 60 80 00       	push   $0x806004
+  801e09:	e8 6c eb ff ff       	call   80097a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801e0e:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801e14:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e19:	e8 c1 fe ff ff       	call   801cdf <nsipc>
+}
+  801e1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e21:	c9                   	leave
+  801e22:	c3                   	ret
+
+00801e23 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801e23:	55                   	push   %ebp
+  801e24:	89 e5                	mov    %esp,%ebp
+  801e26:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801e29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e2c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801e31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e34:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801e39:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e3e:	e8 9c fe ff ff       	call   801cdf <nsipc>
+}
+  801e43:	c9                   	leave
+  801e44:	c3                   	ret
+
+00801e45 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801e45:	55                   	push   %ebp
+  801e46:	89 e5                	mov    %esp,%ebp
+  801e48:	56                   	push   %esi
+  801e49:	53                   	push   %ebx
+  801e4a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801e4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e50:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801e55:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801e5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e5e:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801e63:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e68:	e8 72 fe ff ff       	call   801cdf <nsipc>
+  801e6d:	89 c3                	mov    %eax,%ebx
+  801e6f:	85 c0                	test   %eax,%eax
+  801e71:	78 22                	js     801e95 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801e73:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801e78:	39 c6                	cmp    %eax,%esi
+  801e7a:	0f 4e c6             	cmovle %esi,%eax
+  801e7d:	39 c3                	cmp    %eax,%ebx
+  801e7f:	7f 1d                	jg     801e9e <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801e81:	83 ec 04             	sub    $0x4,%esp
+  801e84:	53                   	push   %ebx
+  801e85:	68 00 60 80 00       	push   $0x806000
+  801e8a:	ff 75 0c             	push   0xc(%ebp)
+  801e8d:	e8 e8 ea ff ff       	call   80097a <memmove>
+  801e92:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801e95:	89 d8                	mov    %ebx,%eax
+  801e97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e9a:	5b                   	pop    %ebx
+  801e9b:	5e                   	pop    %esi
+  801e9c:	5d                   	pop    %ebp
+  801e9d:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801e9e:	68 db 2d 80 00       	push   $0x802ddb
+  801ea3:	68 a3 2d 80 00       	push   $0x802da3
+  801ea8:	6a 62                	push   $0x62
+  801eaa:	68 f0 2d 80 00       	push   $0x802df0
+  801eaf:	e8 46 05 00 00       	call   8023fa <_panic>
+
+00801eb4 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801eb4:	55                   	push   %ebp
+  801eb5:	89 e5                	mov    %esp,%ebp
+  801eb7:	53                   	push   %ebx
+  801eb8:	83 ec 04             	sub    $0x4,%esp
+  801ebb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ebe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec1:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801ec6:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801ecc:	7f 2e                	jg     801efc <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801ece:	83 ec 04             	sub    $0x4,%esp
+  801ed1:	53                   	push   %ebx
+  801ed2:	ff 75 0c             	push   0xc(%ebp)
+  801ed5:	68 0c 60 80 00       	push   $0x80600c
+  801eda:	e8 9b ea ff ff       	call   80097a <memmove>
+	nsipcbuf.send.req_size = size;
+  801edf:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801ee5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ee8:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801eed:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ef2:	e8 e8 fd ff ff       	call   801cdf <nsipc>
+}
+  801ef7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801efa:	c9                   	leave
+  801efb:	c3                   	ret
+	assert(size < 1600);
+  801efc:	68 fc 2d 80 00       	push   $0x802dfc
+  801f01:	68 a3 2d 80 00       	push   $0x802da3
+  801f06:	6a 6d                	push   $0x6d
+  801f08:	68 f0 2d 80 00       	push   $0x802df0
+  801f0d:	e8 e8 04 00 00       	call   8023fa <_panic>
+
+00801f12 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f12:	55                   	push   %ebp
+  801f13:	89 e5                	mov    %esp,%ebp
+  801f15:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f18:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801f20:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f23:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f28:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f2b:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801f30:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f35:	e8 a5 fd ff ff       	call   801cdf <nsipc>
+}
+  801f3a:	c9                   	leave
+  801f3b:	c3                   	ret
+
+00801f3c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f3c:	55                   	push   %ebp
+  801f3d:	89 e5                	mov    %esp,%ebp
+  801f3f:	56                   	push   %esi
+  801f40:	53                   	push   %ebx
+  801f41:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801f44:	83 ec 0c             	sub    $0xc,%esp
+  801f47:	ff 75 08             	push   0x8(%ebp)
+  801f4a:	e8 96 f2 ff ff       	call   8011e5 <fd2data>
+  801f4f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801f51:	83 c4 08             	add    $0x8,%esp
+  801f54:	68 08 2e 80 00       	push   $0x802e08
+  801f59:	53                   	push   %ebx
+  801f5a:	e8 95 e8 ff ff       	call   8007f4 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801f5f:	8b 46 04             	mov    0x4(%esi),%eax
+  801f62:	2b 06                	sub    (%esi),%eax
+  801f64:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801f6a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f71:	00 00 00 
+	stat->st_dev = &devpipe;
+  801f74:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801f7b:	30 80 00 
+	return 0;
+}
+  801f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f86:	5b                   	pop    %ebx
+  801f87:	5e                   	pop    %esi
+  801f88:	5d                   	pop    %ebp
+  801f89:	c3                   	ret
+
+00801f8a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801f8a:	55                   	push   %ebp
+  801f8b:	89 e5                	mov    %esp,%ebp
+  801f8d:	53                   	push   %ebx
+  801f8e:	83 ec 0c             	sub    $0xc,%esp
+  801f91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801f94:	53                   	push   %ebx
+  801f95:	6a 00                	push   $0x0
+  801f97:	e8 8d ed ff ff       	call   800d29 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801f9c:	89 1c 24             	mov    %ebx,(%esp)
+  801f9f:	e8 41 f2 ff ff       	call   8011e5 <fd2data>
+  801fa4:	83 c4 08             	add    $0x8,%esp
+  801fa7:	50                   	push   %eax
+  801fa8:	6a 00                	push   $0x0
+  801faa:	e8 7a ed ff ff       	call   800d29 <sys_page_unmap>
+}
+  801faf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb2:	c9                   	leave
+  801fb3:	c3                   	ret
+
+00801fb4 <_pipeisclosed>:
+{
+  801fb4:	55                   	push   %ebp
+  801fb5:	89 e5                	mov    %esp,%ebp
+  801fb7:	57                   	push   %edi
+  801fb8:	56                   	push   %esi
+  801fb9:	53                   	push   %ebx
+  801fba:	83 ec 1c             	sub    $0x1c,%esp
+  801fbd:	89 c7                	mov    %eax,%edi
+  801fbf:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801fc1:	a1 08 40 80 00       	mov    0x804008,%eax
+  801fc6:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801fc9:	83 ec 0c             	sub    $0xc,%esp
+  801fcc:	57                   	push   %edi
+  801fcd:	e8 4a 05 00 00       	call   80251c <pageref>
+  801fd2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fd5:	89 34 24             	mov    %esi,(%esp)
+  801fd8:	e8 3f 05 00 00       	call   80251c <pageref>
+		nn = thisenv->env_runs;
+  801fdd:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801fe3:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801fe6:	83 c4 10             	add    $0x10,%esp
+  801fe9:	39 cb                	cmp    %ecx,%ebx
+  801feb:	74 1b                	je     802008 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801fed:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ff0:	75 cf                	jne    801fc1 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801ff2:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801ff5:	6a 01                	push   $0x1
+  801ff7:	50                   	push   %eax
+  801ff8:	53                   	push   %ebx
+  801ff9:	68 0f 2e 80 00       	push   $0x802e0f
+  801ffe:	e8 03 e2 ff ff       	call   800206 <cprintf>
+  802003:	83 c4 10             	add    $0x10,%esp
+  802006:	eb b9                	jmp    801fc1 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802008:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80200b:	0f 94 c0             	sete   %al
+  80200e:	0f b6 c0             	movzbl %al,%eax
+}
+  802011:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802014:	5b                   	pop    %ebx
+  802015:	5e                   	pop    %esi
+  802016:	5f                   	pop    %edi
+  802017:	5d                   	pop    %ebp
+  802018:	c3                   	ret
+
+00802019 <devpipe_write>:
+{
+  802019:	55                   	push   %ebp
+  80201a:	89 e5                	mov    %esp,%ebp
+  80201c:	57                   	push   %edi
+  80201d:	56                   	push   %esi
+  80201e:	53                   	push   %ebx
+  80201f:	83 ec 28             	sub    $0x28,%esp
+  802022:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802025:	56                   	push   %esi
+  802026:	e8 ba f1 ff ff       	call   8011e5 <fd2data>
+  80202b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80202d:	83 c4 10             	add    $0x10,%esp
+  802030:	bf 00 00 00 00       	mov    $0x0,%edi
+  802035:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802038:	75 09                	jne    802043 <devpipe_write+0x2a>
+	return i;
+  80203a:	89 f8                	mov    %edi,%eax
+  80203c:	eb 23                	jmp    802061 <devpipe_write+0x48>
+			sys_yield();
+  80203e:	e8 9e eb ff ff       	call   800be1 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802043:	8b 43 04             	mov    0x4(%ebx),%eax
+  802046:	8b 0b                	mov    (%ebx),%ecx
+  802048:	8d 51 20             	lea    0x20(%ecx),%edx
+  80204b:	39 d0                	cmp    %edx,%eax
+  80204d:	72 1a                	jb     802069 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80204f:	89 da                	mov    %ebx,%edx
+  802051:	89 f0                	mov    %esi,%eax
+  802053:	e8 5c ff ff ff       	call   801fb4 <_pipeisclosed>
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	74 e2                	je     80203e <devpipe_write+0x25>
+				return 0;
+  80205c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802061:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802064:	5b                   	pop    %ebx
+  802065:	5e                   	pop    %esi
+  802066:	5f                   	pop    %edi
+  802067:	5d                   	pop    %ebp
+  802068:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802069:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80206c:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802070:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802073:	89 c2                	mov    %eax,%edx
+  802075:	c1 fa 1f             	sar    $0x1f,%edx
+  802078:	89 d1                	mov    %edx,%ecx
+  80207a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80207d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802080:	83 e2 1f             	and    $0x1f,%edx
+  802083:	29 ca                	sub    %ecx,%edx
+  802085:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802089:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80208d:	83 c0 01             	add    $0x1,%eax
+  802090:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802093:	83 c7 01             	add    $0x1,%edi
+  802096:	eb 9d                	jmp    802035 <devpipe_write+0x1c>
+
+00802098 <devpipe_read>:
+{
+  802098:	55                   	push   %ebp
+  802099:	89 e5                	mov    %esp,%ebp
+  80209b:	57                   	push   %edi
+  80209c:	56                   	push   %esi
+  80209d:	53                   	push   %ebx
+  80209e:	83 ec 18             	sub    $0x18,%esp
+  8020a1:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8020a4:	57                   	push   %edi
+  8020a5:	e8 3b f1 ff ff       	call   8011e5 <fd2data>
+  8020aa:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8020ac:	83 c4 10             	add    $0x10,%esp
+  8020af:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8020b7:	75 13                	jne    8020cc <devpipe_read+0x34>
+	return i;
+  8020b9:	89 f0                	mov    %esi,%eax
+  8020bb:	eb 02                	jmp    8020bf <devpipe_read+0x27>
+				return i;
+  8020bd:	89 f0                	mov    %esi,%eax
+}
+  8020bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020c2:	5b                   	pop    %ebx
+  8020c3:	5e                   	pop    %esi
+  8020c4:	5f                   	pop    %edi
+  8020c5:	5d                   	pop    %ebp
+  8020c6:	c3                   	ret
+			sys_yield();
+  8020c7:	e8 15 eb ff ff       	call   800be1 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8020cc:	8b 03                	mov    (%ebx),%eax
+  8020ce:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8020d1:	75 18                	jne    8020eb <devpipe_read+0x53>
+			if (i > 0)
+  8020d3:	85 f6                	test   %esi,%esi
+  8020d5:	75 e6                	jne    8020bd <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8020d7:	89 da                	mov    %ebx,%edx
+  8020d9:	89 f8                	mov    %edi,%eax
+  8020db:	e8 d4 fe ff ff       	call   801fb4 <_pipeisclosed>
+  8020e0:	85 c0                	test   %eax,%eax
+  8020e2:	74 e3                	je     8020c7 <devpipe_read+0x2f>
+				return 0;
+  8020e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e9:	eb d4                	jmp    8020bf <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8020eb:	99                   	cltd
+  8020ec:	c1 ea 1b             	shr    $0x1b,%edx
+  8020ef:	01 d0                	add    %edx,%eax
+  8020f1:	83 e0 1f             	and    $0x1f,%eax
+  8020f4:	29 d0                	sub    %edx,%eax
+  8020f6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8020fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020fe:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802101:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802104:	83 c6 01             	add    $0x1,%esi
+  802107:	eb ab                	jmp    8020b4 <devpipe_read+0x1c>
+
+00802109 <pipe>:
+{
+  802109:	55                   	push   %ebp
+  80210a:	89 e5                	mov    %esp,%ebp
+  80210c:	56                   	push   %esi
+  80210d:	53                   	push   %ebx
+  80210e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802111:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802114:	50                   	push   %eax
+  802115:	e8 e2 f0 ff ff       	call   8011fc <fd_alloc>
+  80211a:	89 c3                	mov    %eax,%ebx
+  80211c:	83 c4 10             	add    $0x10,%esp
+  80211f:	85 c0                	test   %eax,%eax
+  802121:	0f 88 23 01 00 00    	js     80224a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802127:	83 ec 04             	sub    $0x4,%esp
+  80212a:	68 07 04 00 00       	push   $0x407
+  80212f:	ff 75 f4             	push   -0xc(%ebp)
+  802132:	6a 00                	push   $0x0
+  802134:	e8 28 eb ff ff       	call   800c61 <sys_page_alloc>
+  802139:	89 c3                	mov    %eax,%ebx
+  80213b:	83 c4 10             	add    $0x10,%esp
+  80213e:	85 c0                	test   %eax,%eax
+  802140:	0f 88 04 01 00 00    	js     80224a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802146:	83 ec 0c             	sub    $0xc,%esp
+  802149:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80214c:	50                   	push   %eax
+  80214d:	e8 aa f0 ff ff       	call   8011fc <fd_alloc>
+  802152:	89 c3                	mov    %eax,%ebx
+  802154:	83 c4 10             	add    $0x10,%esp
+  802157:	85 c0                	test   %eax,%eax
+  802159:	0f 88 db 00 00 00    	js     80223a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80215f:	83 ec 04             	sub    $0x4,%esp
+  802162:	68 07 04 00 00       	push   $0x407
+  802167:	ff 75 f0             	push   -0x10(%ebp)
+  80216a:	6a 00                	push   $0x0
+  80216c:	e8 f0 ea ff ff       	call   800c61 <sys_page_alloc>
+  802171:	89 c3                	mov    %eax,%ebx
+  802173:	83 c4 10             	add    $0x10,%esp
+  802176:	85 c0                	test   %eax,%eax
+  802178:	0f 88 bc 00 00 00    	js     80223a <pipe+0x131>
+	va = fd2data(fd0);
+  80217e:	83 ec 0c             	sub    $0xc,%esp
+  802181:	ff 75 f4             	push   -0xc(%ebp)
+  802184:	e8 5c f0 ff ff       	call   8011e5 <fd2data>
+  802189:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80218b:	83 c4 0c             	add    $0xc,%esp
+  80218e:	68 07 04 00 00       	push   $0x407
+  802193:	50                   	push   %eax
+  802194:	6a 00                	push   $0x0
+  802196:	e8 c6 ea ff ff       	call   800c61 <sys_page_alloc>
+  80219b:	89 c3                	mov    %eax,%ebx
+  80219d:	83 c4 10             	add    $0x10,%esp
+  8021a0:	85 c0                	test   %eax,%eax
+  8021a2:	0f 88 82 00 00 00    	js     80222a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021a8:	83 ec 0c             	sub    $0xc,%esp
+  8021ab:	ff 75 f0             	push   -0x10(%ebp)
+  8021ae:	e8 32 f0 ff ff       	call   8011e5 <fd2data>
+  8021b3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8021ba:	50                   	push   %eax
+  8021bb:	6a 00                	push   $0x0
+  8021bd:	56                   	push   %esi
+  8021be:	6a 00                	push   $0x0
+  8021c0:	e8 22 eb ff ff       	call   800ce7 <sys_page_map>
+  8021c5:	89 c3                	mov    %eax,%ebx
+  8021c7:	83 c4 20             	add    $0x20,%esp
+  8021ca:	85 c0                	test   %eax,%eax
+  8021cc:	78 4e                	js     80221c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8021ce:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8021d3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021d6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8021d8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021db:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8021e2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8021e5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8021e7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8021ea:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8021f1:	83 ec 0c             	sub    $0xc,%esp
+  8021f4:	ff 75 f4             	push   -0xc(%ebp)
+  8021f7:	e8 d9 ef ff ff       	call   8011d5 <fd2num>
+  8021fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021ff:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802201:	83 c4 04             	add    $0x4,%esp
+  802204:	ff 75 f0             	push   -0x10(%ebp)
+  802207:	e8 c9 ef ff ff       	call   8011d5 <fd2num>
+  80220c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80220f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802212:	83 c4 10             	add    $0x10,%esp
+  802215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80221a:	eb 2e                	jmp    80224a <pipe+0x141>
+	sys_page_unmap(0, va);
+  80221c:	83 ec 08             	sub    $0x8,%esp
+  80221f:	56                   	push   %esi
+  802220:	6a 00                	push   $0x0
+  802222:	e8 02 eb ff ff       	call   800d29 <sys_page_unmap>
+  802227:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80222a:	83 ec 08             	sub    $0x8,%esp
+  80222d:	ff 75 f0             	push   -0x10(%ebp)
+  802230:	6a 00                	push   $0x0
+  802232:	e8 f2 ea ff ff       	call   800d29 <sys_page_unmap>
+  802237:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80223a:	83 ec 08             	sub    $0x8,%esp
+  80223d:	ff 75 f4             	push   -0xc(%ebp)
+  802240:	6a 00                	push   $0x0
+  802242:	e8 e2 ea ff ff       	call   800d29 <sys_page_unmap>
+  802247:	83 c4 10             	add    $0x10,%esp
+}
+  80224a:	89 d8                	mov    %ebx,%eax
+  80224c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80224f:	5b                   	pop    %ebx
+  802250:	5e                   	pop    %esi
+  802251:	5d                   	pop    %ebp
+  802252:	c3                   	ret
+
+00802253 <pipeisclosed>:
+{
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+  802256:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802259:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80225c:	50                   	push   %eax
+  80225d:	ff 75 08             	push   0x8(%ebp)
+  802260:	e8 ed ef ff ff       	call   801252 <fd_lookup>
+  802265:	83 c4 10             	add    $0x10,%esp
+  802268:	85 c0                	test   %eax,%eax
+  80226a:	78 18                	js     802284 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80226c:	83 ec 0c             	sub    $0xc,%esp
+  80226f:	ff 75 f4             	push   -0xc(%ebp)
+  802272:	e8 6e ef ff ff       	call   8011e5 <fd2data>
+  802277:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802279:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80227c:	e8 33 fd ff ff       	call   801fb4 <_pipeisclosed>
+  802281:	83 c4 10             	add    $0x10,%esp
+}
+  802284:	c9                   	leave
+  802285:	c3                   	ret
+
+00802286 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228b:	c3                   	ret
+
+0080228c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80228c:	55                   	push   %ebp
+  80228d:	89 e5                	mov    %esp,%ebp
+  80228f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802292:	68 27 2e 80 00       	push   $0x802e27
+  802297:	ff 75 0c             	push   0xc(%ebp)
+  80229a:	e8 55 e5 ff ff       	call   8007f4 <strcpy>
+	return 0;
+}
+  80229f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a4:	c9                   	leave
+  8022a5:	c3                   	ret
+
+008022a6 <devcons_write>:
+{
+  8022a6:	55                   	push   %ebp
+  8022a7:	89 e5                	mov    %esp,%ebp
+  8022a9:	57                   	push   %edi
+  8022aa:	56                   	push   %esi
+  8022ab:	53                   	push   %ebx
+  8022ac:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8022b2:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8022b7:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8022bd:	eb 2e                	jmp    8022ed <devcons_write+0x47>
+		m = n - tot;
+  8022bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022c2:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8022c4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8022c9:	39 c3                	cmp    %eax,%ebx
+  8022cb:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8022ce:	83 ec 04             	sub    $0x4,%esp
+  8022d1:	53                   	push   %ebx
+  8022d2:	89 f0                	mov    %esi,%eax
+  8022d4:	03 45 0c             	add    0xc(%ebp),%eax
+  8022d7:	50                   	push   %eax
+  8022d8:	57                   	push   %edi
+  8022d9:	e8 9c e6 ff ff       	call   80097a <memmove>
+		sys_cputs(buf, m);
+  8022de:	83 c4 08             	add    $0x8,%esp
+  8022e1:	53                   	push   %ebx
+  8022e2:	57                   	push   %edi
+  8022e3:	e8 3c e8 ff ff       	call   800b24 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8022e8:	01 de                	add    %ebx,%esi
+  8022ea:	83 c4 10             	add    $0x10,%esp
+  8022ed:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022f0:	72 cd                	jb     8022bf <devcons_write+0x19>
+}
+  8022f2:	89 f0                	mov    %esi,%eax
+  8022f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f7:	5b                   	pop    %ebx
+  8022f8:	5e                   	pop    %esi
+  8022f9:	5f                   	pop    %edi
+  8022fa:	5d                   	pop    %ebp
+  8022fb:	c3                   	ret
+
+008022fc <devcons_read>:
+{
+  8022fc:	55                   	push   %ebp
+  8022fd:	89 e5                	mov    %esp,%ebp
+  8022ff:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802302:	b8 00 00 00 00       	mov    $0x0,%eax
+  802307:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80230b:	75 07                	jne    802314 <devcons_read+0x18>
+  80230d:	eb 1f                	jmp    80232e <devcons_read+0x32>
+		sys_yield();
+  80230f:	e8 cd e8 ff ff       	call   800be1 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802314:	e8 29 e8 ff ff       	call   800b42 <sys_cgetc>
+  802319:	85 c0                	test   %eax,%eax
+  80231b:	74 f2                	je     80230f <devcons_read+0x13>
+	if (c < 0)
+  80231d:	78 0f                	js     80232e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80231f:	83 f8 04             	cmp    $0x4,%eax
+  802322:	74 0c                	je     802330 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802324:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802327:	88 02                	mov    %al,(%edx)
+	return 1;
+  802329:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80232e:	c9                   	leave
+  80232f:	c3                   	ret
+		return 0;
+  802330:	b8 00 00 00 00       	mov    $0x0,%eax
+  802335:	eb f7                	jmp    80232e <devcons_read+0x32>
+
+00802337 <cputchar>:
+{
+  802337:	55                   	push   %ebp
+  802338:	89 e5                	mov    %esp,%ebp
+  80233a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80233d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802340:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802343:	6a 01                	push   $0x1
+  802345:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802348:	50                   	push   %eax
+  802349:	e8 d6 e7 ff ff       	call   800b24 <sys_cputs>
+}
+  80234e:	83 c4 10             	add    $0x10,%esp
+  802351:	c9                   	leave
+  802352:	c3                   	ret
+
+00802353 <getchar>:
+{
+  802353:	55                   	push   %ebp
+  802354:	89 e5                	mov    %esp,%ebp
+  802356:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802359:	6a 01                	push   $0x1
+  80235b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80235e:	50                   	push   %eax
+  80235f:	6a 00                	push   $0x0
+  802361:	e8 52 f1 ff ff       	call   8014b8 <read>
+	if (r < 0)
+  802366:	83 c4 10             	add    $0x10,%esp
+  802369:	85 c0                	test   %eax,%eax
+  80236b:	78 06                	js     802373 <getchar+0x20>
+	if (r < 1)
+  80236d:	74 06                	je     802375 <getchar+0x22>
+	return c;
+  80236f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802373:	c9                   	leave
+  802374:	c3                   	ret
+		return -E_EOF;
+  802375:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80237a:	eb f7                	jmp    802373 <getchar+0x20>
+
+0080237c <iscons>:
+{
+  80237c:	55                   	push   %ebp
+  80237d:	89 e5                	mov    %esp,%ebp
+  80237f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802382:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802385:	50                   	push   %eax
+  802386:	ff 75 08             	push   0x8(%ebp)
+  802389:	e8 c4 ee ff ff       	call   801252 <fd_lookup>
+  80238e:	83 c4 10             	add    $0x10,%esp
+  802391:	85 c0                	test   %eax,%eax
+  802393:	78 11                	js     8023a6 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802395:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802398:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80239e:	39 10                	cmp    %edx,(%eax)
+  8023a0:	0f 94 c0             	sete   %al
+  8023a3:	0f b6 c0             	movzbl %al,%eax
+}
+  8023a6:	c9                   	leave
+  8023a7:	c3                   	ret
+
+008023a8 <opencons>:
+{
+  8023a8:	55                   	push   %ebp
+  8023a9:	89 e5                	mov    %esp,%ebp
+  8023ab:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8023ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023b1:	50                   	push   %eax
+  8023b2:	e8 45 ee ff ff       	call   8011fc <fd_alloc>
+  8023b7:	83 c4 10             	add    $0x10,%esp
+  8023ba:	85 c0                	test   %eax,%eax
+  8023bc:	78 3a                	js     8023f8 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8023be:	83 ec 04             	sub    $0x4,%esp
+  8023c1:	68 07 04 00 00       	push   $0x407
+  8023c6:	ff 75 f4             	push   -0xc(%ebp)
+  8023c9:	6a 00                	push   $0x0
+  8023cb:	e8 91 e8 ff ff       	call   800c61 <sys_page_alloc>
+  8023d0:	83 c4 10             	add    $0x10,%esp
+  8023d3:	85 c0                	test   %eax,%eax
+  8023d5:	78 21                	js     8023f8 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8023d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023da:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8023e0:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8023e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023e5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8023ec:	83 ec 0c             	sub    $0xc,%esp
+  8023ef:	50                   	push   %eax
+  8023f0:	e8 e0 ed ff ff       	call   8011d5 <fd2num>
+  8023f5:	83 c4 10             	add    $0x10,%esp
+}
+  8023f8:	c9                   	leave
+  8023f9:	c3                   	ret
+
+008023fa <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8023fa:	55                   	push   %ebp
+  8023fb:	89 e5                	mov    %esp,%ebp
+  8023fd:	56                   	push   %esi
+  8023fe:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8023ff:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802402:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  802408:	e8 b5 e7 ff ff       	call   800bc2 <sys_getenvid>
+  80240d:	83 ec 0c             	sub    $0xc,%esp
+  802410:	ff 75 0c             	push   0xc(%ebp)
+  802413:	ff 75 08             	push   0x8(%ebp)
+  802416:	56                   	push   %esi
+  802417:	50                   	push   %eax
+  802418:	68 34 2e 80 00       	push   $0x802e34
+  80241d:	e8 e4 dd ff ff       	call   800206 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802422:	83 c4 18             	add    $0x18,%esp
+  802425:	53                   	push   %ebx
+  802426:	ff 75 10             	push   0x10(%ebp)
+  802429:	e8 87 dd ff ff       	call   8001b5 <vcprintf>
+	cprintf("\n");
+  80242e:	c7 04 24 b0 29 80 00 	movl   $0x8029b0,(%esp)
+  802435:	e8 cc dd ff ff       	call   800206 <cprintf>
+  80243a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80243d:	cc                   	int3
+	while (1)
+  80243e:	eb fd                	jmp    80243d <_panic+0x43>
+
+00802440 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802440:	55                   	push   %ebp
+  802441:	89 e5                	mov    %esp,%ebp
+  802443:	57                   	push   %edi
+  802444:	56                   	push   %esi
+  802445:	53                   	push   %ebx
+  802446:	83 ec 18             	sub    $0x18,%esp
+  802449:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80244c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80244f:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802452:	85 db                	test   %ebx,%ebx
+  802454:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802459:	0f 45 c3             	cmovne %ebx,%eax
+  80245c:	50                   	push   %eax
+  80245d:	e8 82 eb ff ff       	call   800fe4 <sys_ipc_recv>
+
+	if (from_env_store)
+  802462:	83 c4 10             	add    $0x10,%esp
+  802465:	85 ff                	test   %edi,%edi
+  802467:	74 17                	je     802480 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802469:	ba 00 00 00 00       	mov    $0x0,%edx
+  80246e:	85 c0                	test   %eax,%eax
+  802470:	75 0c                	jne    80247e <ipc_recv+0x3e>
+  802472:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802478:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  80247e:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802480:	85 f6                	test   %esi,%esi
+  802482:	74 2e                	je     8024b2 <ipc_recv+0x72>
+		if (!r && pg)
+  802484:	85 c0                	test   %eax,%eax
+  802486:	75 24                	jne    8024ac <ipc_recv+0x6c>
+  802488:	85 db                	test   %ebx,%ebx
+  80248a:	74 20                	je     8024ac <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  80248c:	a1 08 40 80 00       	mov    0x804008,%eax
+  802491:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802497:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802499:	a1 08 40 80 00       	mov    0x804008,%eax
+  80249e:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  8024a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a7:	5b                   	pop    %ebx
+  8024a8:	5e                   	pop    %esi
+  8024a9:	5f                   	pop    %edi
+  8024aa:	5d                   	pop    %ebp
+  8024ab:	c3                   	ret
+			*perm_store = 0;
+  8024ac:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  8024b2:	85 c0                	test   %eax,%eax
+  8024b4:	75 ee                	jne    8024a4 <ipc_recv+0x64>
+  8024b6:	eb e1                	jmp    802499 <ipc_recv+0x59>
+
+008024b8 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8024b8:	55                   	push   %ebp
+  8024b9:	89 e5                	mov    %esp,%ebp
+  8024bb:	57                   	push   %edi
+  8024bc:	56                   	push   %esi
+  8024bd:	53                   	push   %ebx
+  8024be:	83 ec 0c             	sub    $0xc,%esp
+  8024c1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024c4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8024c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8024ca:	85 db                	test   %ebx,%ebx
+  8024cc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8024d1:	0f 44 d8             	cmove  %eax,%ebx
+  8024d4:	ff 75 14             	push   0x14(%ebp)
+  8024d7:	53                   	push   %ebx
+  8024d8:	56                   	push   %esi
+  8024d9:	57                   	push   %edi
+  8024da:	e8 e2 ea ff ff       	call   800fc1 <sys_ipc_try_send_yield>
+  8024df:	83 c4 10             	add    $0x10,%esp
+  8024e2:	85 c0                	test   %eax,%eax
+  8024e4:	79 1e                	jns    802504 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8024e6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8024e9:	75 07                	jne    8024f2 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8024eb:	e8 f1 e6 ff ff       	call   800be1 <sys_yield>
+  8024f0:	eb e2                	jmp    8024d4 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8024f2:	50                   	push   %eax
+  8024f3:	68 57 2e 80 00       	push   $0x802e57
+  8024f8:	6a 3d                	push   $0x3d
+  8024fa:	68 6c 2e 80 00       	push   $0x802e6c
+  8024ff:	e8 f6 fe ff ff       	call   8023fa <_panic>
+	}
+}
+  802504:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802507:	5b                   	pop    %ebx
+  802508:	5e                   	pop    %esi
+  802509:	5f                   	pop    %edi
+  80250a:	5d                   	pop    %ebp
+  80250b:	c3                   	ret
+
+0080250c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80250c:	55                   	push   %ebp
+  80250d:	89 e5                	mov    %esp,%ebp
+  80250f:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802512:	ff 75 08             	push   0x8(%ebp)
+  802515:	e8 47 e6 ff ff       	call   800b61 <sys_env_find>
+}
+  80251a:	c9                   	leave
+  80251b:	c3                   	ret
+
+0080251c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80251c:	55                   	push   %ebp
+  80251d:	89 e5                	mov    %esp,%ebp
+  80251f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802522:	89 c2                	mov    %eax,%edx
+  802524:	c1 ea 16             	shr    $0x16,%edx
+  802527:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80252e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802533:	f6 c1 01             	test   $0x1,%cl
+  802536:	74 22                	je     80255a <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802538:	c1 e8 0c             	shr    $0xc,%eax
+  80253b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802542:	a8 01                	test   $0x1,%al
+  802544:	74 14                	je     80255a <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802546:	c1 e8 0c             	shr    $0xc,%eax
+  802549:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80254c:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802553:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802557:	0f b7 d2             	movzwl %dx,%edx
+}
+  80255a:	89 d0                	mov    %edx,%eax
+  80255c:	5d                   	pop    %ebp
+  80255d:	c3                   	ret
+  80255e:	66 90                	xchg   %ax,%ax
+
+00802560 <__udivmoddi4>:
+  802560:	55                   	push   %ebp
+  802561:	57                   	push   %edi
+  802562:	56                   	push   %esi
+  802563:	53                   	push   %ebx
+  802564:	83 ec 14             	sub    $0x14,%esp
+  802567:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80256b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80256f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802573:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802577:	89 f1                	mov    %esi,%ecx
+  802579:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80257d:	09 d9                	or     %ebx,%ecx
+  80257f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802583:	0f 84 92 00 00 00    	je     80261b <__udivmoddi4+0xbb>
+  802589:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802590:	00 
+  802591:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802596:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80259d:	00 
+  80259e:	89 1c 24             	mov    %ebx,(%esp)
+  8025a1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025a5:	8d 76 00             	lea    0x0(%esi),%esi
+  8025a8:	89 e9                	mov    %ebp,%ecx
+  8025aa:	89 c3                	mov    %eax,%ebx
+  8025ac:	89 d6                	mov    %edx,%esi
+  8025ae:	31 ff                	xor    %edi,%edi
+  8025b0:	d3 ee                	shr    %cl,%esi
+  8025b2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025b5:	f6 c1 20             	test   $0x20,%cl
+  8025b8:	0f 45 de             	cmovne %esi,%ebx
+  8025bb:	0f 45 f7             	cmovne %edi,%esi
+  8025be:	8b 3c 24             	mov    (%esp),%edi
+  8025c1:	39 fb                	cmp    %edi,%ebx
+  8025c3:	89 f7                	mov    %esi,%edi
+  8025c5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8025c9:	8b 1c 24             	mov    (%esp),%ebx
+  8025cc:	19 f7                	sbb    %esi,%edi
+  8025ce:	72 39                	jb     802609 <__udivmoddi4+0xa9>
+  8025d0:	89 e9                	mov    %ebp,%ecx
+  8025d2:	89 f7                	mov    %esi,%edi
+  8025d4:	89 de                	mov    %ebx,%esi
+  8025d6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8025d9:	d3 e6                	shl    %cl,%esi
+  8025db:	31 db                	xor    %ebx,%ebx
+  8025dd:	f6 c1 20             	test   $0x20,%cl
+  8025e0:	0f 45 fe             	cmovne %esi,%edi
+  8025e3:	0f 45 f3             	cmovne %ebx,%esi
+  8025e6:	29 f0                	sub    %esi,%eax
+  8025e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8025ed:	19 fa                	sbb    %edi,%edx
+  8025ef:	31 ff                	xor    %edi,%edi
+  8025f1:	31 db                	xor    %ebx,%ebx
+  8025f3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8025f6:	d3 e6                	shl    %cl,%esi
+  8025f8:	f6 c1 20             	test   $0x20,%cl
+  8025fb:	0f 45 fe             	cmovne %esi,%edi
+  8025fe:	0f 45 f3             	cmovne %ebx,%esi
+  802601:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802605:	09 74 24 08          	or     %esi,0x8(%esp)
+  802609:	83 ed 01             	sub    $0x1,%ebp
+  80260c:	73 9a                	jae    8025a8 <__udivmoddi4+0x48>
+  80260e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802612:	85 ff                	test   %edi,%edi
+  802614:	74 05                	je     80261b <__udivmoddi4+0xbb>
+  802616:	89 07                	mov    %eax,(%edi)
+  802618:	89 57 04             	mov    %edx,0x4(%edi)
+  80261b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80261f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802623:	83 c4 14             	add    $0x14,%esp
+  802626:	5b                   	pop    %ebx
+  802627:	5e                   	pop    %esi
+  802628:	5f                   	pop    %edi
+  802629:	5d                   	pop    %ebp
+  80262a:	c3                   	ret
+  80262b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80262f:	90                   	nop
+
+00802630 <__udivdi3>:
+  802630:	55                   	push   %ebp
+  802631:	57                   	push   %edi
+  802632:	56                   	push   %esi
+  802633:	53                   	push   %ebx
+  802634:	83 ec 14             	sub    $0x14,%esp
+  802637:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80263b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80263f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802643:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802647:	89 fb                	mov    %edi,%ebx
+  802649:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80264d:	09 f3                	or     %esi,%ebx
+  80264f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802653:	0f 84 85 00 00 00    	je     8026de <__udivdi3+0xae>
+  802659:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802660:	00 
+  802661:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802666:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80266d:	00 
+  80266e:	89 34 24             	mov    %esi,(%esp)
+  802671:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802675:	8d 76 00             	lea    0x0(%esi),%esi
+  802678:	89 e9                	mov    %ebp,%ecx
+  80267a:	89 c3                	mov    %eax,%ebx
+  80267c:	89 d6                	mov    %edx,%esi
+  80267e:	31 ff                	xor    %edi,%edi
+  802680:	d3 ee                	shr    %cl,%esi
+  802682:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802685:	f6 c1 20             	test   $0x20,%cl
+  802688:	0f 45 de             	cmovne %esi,%ebx
+  80268b:	0f 45 f7             	cmovne %edi,%esi
+  80268e:	8b 3c 24             	mov    (%esp),%edi
+  802691:	39 fb                	cmp    %edi,%ebx
+  802693:	89 f7                	mov    %esi,%edi
+  802695:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802699:	8b 1c 24             	mov    (%esp),%ebx
+  80269c:	19 f7                	sbb    %esi,%edi
+  80269e:	72 39                	jb     8026d9 <__udivdi3+0xa9>
+  8026a0:	89 e9                	mov    %ebp,%ecx
+  8026a2:	89 f7                	mov    %esi,%edi
+  8026a4:	89 de                	mov    %ebx,%esi
+  8026a6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8026a9:	d3 e6                	shl    %cl,%esi
+  8026ab:	31 db                	xor    %ebx,%ebx
+  8026ad:	f6 c1 20             	test   $0x20,%cl
+  8026b0:	0f 45 fe             	cmovne %esi,%edi
+  8026b3:	0f 45 f3             	cmovne %ebx,%esi
+  8026b6:	29 f0                	sub    %esi,%eax
+  8026b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8026bd:	19 fa                	sbb    %edi,%edx
+  8026bf:	31 ff                	xor    %edi,%edi
+  8026c1:	31 db                	xor    %ebx,%ebx
+  8026c3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8026c6:	d3 e6                	shl    %cl,%esi
+  8026c8:	f6 c1 20             	test   $0x20,%cl
+  8026cb:	0f 45 fe             	cmovne %esi,%edi
+  8026ce:	0f 45 f3             	cmovne %ebx,%esi
+  8026d1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8026d5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8026d9:	83 ed 01             	sub    $0x1,%ebp
+  8026dc:	73 9a                	jae    802678 <__udivdi3+0x48>
+  8026de:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026e2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026e6:	83 c4 14             	add    $0x14,%esp
+  8026e9:	5b                   	pop    %ebx
+  8026ea:	5e                   	pop    %esi
+  8026eb:	5f                   	pop    %edi
+  8026ec:	5d                   	pop    %ebp
+  8026ed:	c3                   	ret
+  8026ee:	66 90                	xchg   %ax,%ax
+
+008026f0 <__umoddi3>:
+  8026f0:	57                   	push   %edi
+  8026f1:	56                   	push   %esi
+  8026f2:	53                   	push   %ebx
+  8026f3:	83 ec 08             	sub    $0x8,%esp
+  8026f6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8026fa:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8026fe:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802702:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802706:	89 f9                	mov    %edi,%ecx
+  802708:	89 34 24             	mov    %esi,(%esp)
+  80270b:	09 f1                	or     %esi,%ecx
+  80270d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802711:	74 53                	je     802766 <__umoddi3+0x76>
+  802713:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802718:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80271f:	90                   	nop
+  802720:	89 c6                	mov    %eax,%esi
+  802722:	89 d7                	mov    %edx,%edi
+  802724:	31 db                	xor    %ebx,%ebx
+  802726:	d3 ef                	shr    %cl,%edi
+  802728:	0f ad d6             	shrd   %cl,%edx,%esi
+  80272b:	f6 c1 20             	test   $0x20,%cl
+  80272e:	0f 45 f7             	cmovne %edi,%esi
+  802731:	0f 45 fb             	cmovne %ebx,%edi
+  802734:	8b 1c 24             	mov    (%esp),%ebx
+  802737:	39 de                	cmp    %ebx,%esi
+  802739:	89 fb                	mov    %edi,%ebx
+  80273b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80273f:	8b 34 24             	mov    (%esp),%esi
+  802742:	19 fb                	sbb    %edi,%ebx
+  802744:	72 14                	jb     80275a <__umoddi3+0x6a>
+  802746:	0f a5 f7             	shld   %cl,%esi,%edi
+  802749:	31 db                	xor    %ebx,%ebx
+  80274b:	d3 e6                	shl    %cl,%esi
+  80274d:	f6 c1 20             	test   $0x20,%cl
+  802750:	0f 45 fe             	cmovne %esi,%edi
+  802753:	0f 45 f3             	cmovne %ebx,%esi
+  802756:	29 f0                	sub    %esi,%eax
+  802758:	19 fa                	sbb    %edi,%edx
+  80275a:	83 e9 01             	sub    $0x1,%ecx
+  80275d:	73 c1                	jae    802720 <__umoddi3+0x30>
+  80275f:	83 c4 08             	add    $0x8,%esp
+  802762:	5b                   	pop    %ebx
+  802763:	5e                   	pop    %esi
+  802764:	5f                   	pop    %edi
+  802765:	c3                   	ret
+  802766:	83 c4 08             	add    $0x8,%esp
+  802769:	31 c0                	xor    %eax,%eax
+  80276b:	31 d2                	xor    %edx,%edx
+  80276d:	5b                   	pop    %ebx
+  80276e:	5e                   	pop    %esi
+  80276f:	5f                   	pop    %edi
+  802770:	c3                   	ret
+  802771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80277f:	90                   	nop
+
+00802780 <__divdi3>:
+  802780:	55                   	push   %ebp
+  802781:	57                   	push   %edi
+  802782:	56                   	push   %esi
+  802783:	53                   	push   %ebx
+  802784:	83 ec 1c             	sub    $0x1c,%esp
+  802787:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80278b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80278f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802793:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802797:	85 ff                	test   %edi,%edi
+  802799:	0f 88 da 00 00 00    	js     802879 <__divdi3+0xf9>
+  80279f:	85 db                	test   %ebx,%ebx
+  8027a1:	78 16                	js     8027b9 <__divdi3+0x39>
+  8027a3:	89 dd                	mov    %ebx,%ebp
+  8027a5:	89 c8                	mov    %ecx,%eax
+  8027a7:	89 da                	mov    %ebx,%edx
+  8027a9:	09 cd                	or     %ecx,%ebp
+  8027ab:	0f 85 fd 00 00 00    	jne    8028ae <__divdi3+0x12e>
+  8027b1:	83 c4 1c             	add    $0x1c,%esp
+  8027b4:	5b                   	pop    %ebx
+  8027b5:	5e                   	pop    %esi
+  8027b6:	5f                   	pop    %edi
+  8027b7:	5d                   	pop    %ebp
+  8027b8:	c3                   	ret
+  8027b9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8027be:	f7 d9                	neg    %ecx
+  8027c0:	89 f0                	mov    %esi,%eax
+  8027c2:	89 fa                	mov    %edi,%edx
+  8027c4:	83 d3 00             	adc    $0x0,%ebx
+  8027c7:	89 0c 24             	mov    %ecx,(%esp)
+  8027ca:	f7 db                	neg    %ebx
+  8027cc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8027d0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027d7:	00 
+  8027d8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027dd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027e4:	00 
+  8027e5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8027e9:	89 cd                	mov    %ecx,%ebp
+  8027eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8027ef:	90                   	nop
+  8027f0:	89 e9                	mov    %ebp,%ecx
+  8027f2:	89 c3                	mov    %eax,%ebx
+  8027f4:	89 d6                	mov    %edx,%esi
+  8027f6:	31 ff                	xor    %edi,%edi
+  8027f8:	d3 ee                	shr    %cl,%esi
+  8027fa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8027fd:	f6 c1 20             	test   $0x20,%cl
+  802800:	0f 45 de             	cmovne %esi,%ebx
+  802803:	0f 45 f7             	cmovne %edi,%esi
+  802806:	8b 3c 24             	mov    (%esp),%edi
+  802809:	39 fb                	cmp    %edi,%ebx
+  80280b:	89 f7                	mov    %esi,%edi
+  80280d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802811:	8b 1c 24             	mov    (%esp),%ebx
+  802814:	19 f7                	sbb    %esi,%edi
+  802816:	72 39                	jb     802851 <__divdi3+0xd1>
+  802818:	89 e9                	mov    %ebp,%ecx
+  80281a:	89 f7                	mov    %esi,%edi
+  80281c:	89 de                	mov    %ebx,%esi
+  80281e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802821:	d3 e6                	shl    %cl,%esi
+  802823:	31 db                	xor    %ebx,%ebx
+  802825:	f6 c1 20             	test   $0x20,%cl
+  802828:	0f 45 fe             	cmovne %esi,%edi
+  80282b:	0f 45 f3             	cmovne %ebx,%esi
+  80282e:	29 f0                	sub    %esi,%eax
+  802830:	be 01 00 00 00       	mov    $0x1,%esi
+  802835:	19 fa                	sbb    %edi,%edx
+  802837:	31 ff                	xor    %edi,%edi
+  802839:	31 db                	xor    %ebx,%ebx
+  80283b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80283e:	d3 e6                	shl    %cl,%esi
+  802840:	f6 c1 20             	test   $0x20,%cl
+  802843:	0f 45 fe             	cmovne %esi,%edi
+  802846:	0f 45 f3             	cmovne %ebx,%esi
+  802849:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80284d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802851:	83 ed 01             	sub    $0x1,%ebp
+  802854:	73 9a                	jae    8027f0 <__divdi3+0x70>
+  802856:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80285a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80285e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802862:	85 ed                	test   %ebp,%ebp
+  802864:	0f 84 47 ff ff ff    	je     8027b1 <__divdi3+0x31>
+  80286a:	f7 d8                	neg    %eax
+  80286c:	83 d2 00             	adc    $0x0,%edx
+  80286f:	83 c4 1c             	add    $0x1c,%esp
+  802872:	5b                   	pop    %ebx
+  802873:	f7 da                	neg    %edx
+  802875:	5e                   	pop    %esi
+  802876:	5f                   	pop    %edi
+  802877:	5d                   	pop    %ebp
+  802878:	c3                   	ret
+  802879:	f7 de                	neg    %esi
+  80287b:	83 d7 00             	adc    $0x0,%edi
+  80287e:	f7 df                	neg    %edi
+  802880:	85 db                	test   %ebx,%ebx
+  802882:	78 23                	js     8028a7 <__divdi3+0x127>
+  802884:	89 dd                	mov    %ebx,%ebp
+  802886:	89 c8                	mov    %ecx,%eax
+  802888:	89 da                	mov    %ebx,%edx
+  80288a:	09 cd                	or     %ecx,%ebp
+  80288c:	0f 84 1f ff ff ff    	je     8027b1 <__divdi3+0x31>
+  802892:	89 0c 24             	mov    %ecx,(%esp)
+  802895:	89 f0                	mov    %esi,%eax
+  802897:	89 fa                	mov    %edi,%edx
+  802899:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80289e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8028a2:	e9 29 ff ff ff       	jmp    8027d0 <__divdi3+0x50>
+  8028a7:	31 ed                	xor    %ebp,%ebp
+  8028a9:	e9 10 ff ff ff       	jmp    8027be <__divdi3+0x3e>
+  8028ae:	89 0c 24             	mov    %ecx,(%esp)
+  8028b1:	89 f0                	mov    %esi,%eax
+  8028b3:	89 fa                	mov    %edi,%edx
+  8028b5:	31 ed                	xor    %ebp,%ebp
+  8028b7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8028bb:	e9 10 ff ff ff       	jmp    8027d0 <__divdi3+0x50>
+
+008028c0 <__moddi3>:
+  8028c0:	55                   	push   %ebp
+  8028c1:	57                   	push   %edi
+  8028c2:	56                   	push   %esi
+  8028c3:	53                   	push   %ebx
+  8028c4:	83 ec 14             	sub    $0x14,%esp
+  8028c7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8028cb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8028cf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8028d3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8028d7:	85 d2                	test   %edx,%edx
+  8028d9:	0f 88 9b 00 00 00    	js     80297a <__moddi3+0xba>
+  8028df:	89 f7                	mov    %esi,%edi
+  8028e1:	31 ed                	xor    %ebp,%ebp
+  8028e3:	09 cf                	or     %ecx,%edi
+  8028e5:	0f 84 83 00 00 00    	je     80296e <__moddi3+0xae>
+  8028eb:	89 cb                	mov    %ecx,%ebx
+  8028ed:	89 f7                	mov    %esi,%edi
+  8028ef:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8028f3:	f7 db                	neg    %ebx
+  8028f5:	83 d7 00             	adc    $0x0,%edi
+  8028f8:	f7 df                	neg    %edi
+  8028fa:	0f 49 f7             	cmovns %edi,%esi
+  8028fd:	0f 49 cb             	cmovns %ebx,%ecx
+  802900:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802904:	89 0c 24             	mov    %ecx,(%esp)
+  802907:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80290c:	89 cd                	mov    %ecx,%ebp
+  80290e:	66 90                	xchg   %ax,%ax
+  802910:	89 e9                	mov    %ebp,%ecx
+  802912:	89 c3                	mov    %eax,%ebx
+  802914:	89 d6                	mov    %edx,%esi
+  802916:	31 ff                	xor    %edi,%edi
+  802918:	d3 ee                	shr    %cl,%esi
+  80291a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80291d:	f6 c1 20             	test   $0x20,%cl
+  802920:	0f 45 de             	cmovne %esi,%ebx
+  802923:	0f 45 f7             	cmovne %edi,%esi
+  802926:	8b 3c 24             	mov    (%esp),%edi
+  802929:	39 fb                	cmp    %edi,%ebx
+  80292b:	89 f7                	mov    %esi,%edi
+  80292d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802931:	8b 1c 24             	mov    (%esp),%ebx
+  802934:	19 f7                	sbb    %esi,%edi
+  802936:	72 1a                	jb     802952 <__moddi3+0x92>
+  802938:	89 e9                	mov    %ebp,%ecx
+  80293a:	89 f7                	mov    %esi,%edi
+  80293c:	89 de                	mov    %ebx,%esi
+  80293e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802941:	d3 e6                	shl    %cl,%esi
+  802943:	31 db                	xor    %ebx,%ebx
+  802945:	f6 c1 20             	test   $0x20,%cl
+  802948:	0f 45 fe             	cmovne %esi,%edi
+  80294b:	0f 45 f3             	cmovne %ebx,%esi
+  80294e:	29 f0                	sub    %esi,%eax
+  802950:	19 fa                	sbb    %edi,%edx
+  802952:	83 ed 01             	sub    $0x1,%ebp
+  802955:	73 b9                	jae    802910 <__moddi3+0x50>
+  802957:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80295b:	85 ed                	test   %ebp,%ebp
+  80295d:	74 07                	je     802966 <__moddi3+0xa6>
+  80295f:	f7 d8                	neg    %eax
+  802961:	83 d2 00             	adc    $0x0,%edx
+  802964:	f7 da                	neg    %edx
+  802966:	83 c4 14             	add    $0x14,%esp
+  802969:	5b                   	pop    %ebx
+  80296a:	5e                   	pop    %esi
+  80296b:	5f                   	pop    %edi
+  80296c:	5d                   	pop    %ebp
+  80296d:	c3                   	ret
+  80296e:	83 c4 14             	add    $0x14,%esp
+  802971:	31 c0                	xor    %eax,%eax
+  802973:	31 d2                	xor    %edx,%edx
+  802975:	5b                   	pop    %ebx
+  802976:	5e                   	pop    %esi
+  802977:	5f                   	pop    %edi
+  802978:	5d                   	pop    %ebp
+  802979:	c3                   	ret
+  80297a:	89 f7                	mov    %esi,%edi
+  80297c:	09 cf                	or     %ecx,%edi
+  80297e:	74 11                	je     802991 <__moddi3+0xd1>
+  802980:	f7 d8                	neg    %eax
+  802982:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802987:	83 d2 00             	adc    $0x0,%edx
+  80298a:	f7 da                	neg    %edx
+  80298c:	e9 5a ff ff ff       	jmp    8028eb <__moddi3+0x2b>
+  802991:	31 c0                	xor    %eax,%eax
+  802993:	31 d2                	xor    %edx,%edx
+  802995:	eb c8                	jmp    80295f <__moddi3+0x9f>
@@ -0,0 +1,5890 @@
+
+obj/user/num.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4a 01 00 00       	call   80017b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <num>:
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+  80003b:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+	char c;
+
+	while ((n = read(f, &c, 1)) > 0) {
+  80003e:	8d 5d f7             	lea    -0x9(%ebp),%ebx
+  800041:	eb 1b                	jmp    80005e <num+0x2b>
+		if (bol) {
+			printf("%5d ", ++line);
+			bol = 0;
+		}
+		if ((r = write(1, &c, 1)) != 1)
+  800043:	83 ec 04             	sub    $0x4,%esp
+  800046:	6a 01                	push   $0x1
+  800048:	53                   	push   %ebx
+  800049:	6a 01                	push   $0x1
+  80004b:	e8 97 14 00 00       	call   8014e7 <write>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	83 f8 01             	cmp    $0x1,%eax
+  800056:	75 4c                	jne    8000a4 <num+0x71>
+			panic("write error copying %s: %e", s, r);
+		if (c == '\n')
+  800058:	80 7d f7 0a          	cmpb   $0xa,-0x9(%ebp)
+  80005c:	74 5e                	je     8000bc <num+0x89>
+	while ((n = read(f, &c, 1)) > 0) {
+  80005e:	83 ec 04             	sub    $0x4,%esp
+  800061:	6a 01                	push   $0x1
+  800063:	53                   	push   %ebx
+  800064:	56                   	push   %esi
+  800065:	e8 af 13 00 00       	call   801419 <read>
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	85 c0                	test   %eax,%eax
+  80006f:	7e 57                	jle    8000c8 <num+0x95>
+		if (bol) {
+  800071:	83 3d 00 30 80 00 00 	cmpl   $0x0,0x803000
+  800078:	74 c9                	je     800043 <num+0x10>
+			printf("%5d ", ++line);
+  80007a:	a1 00 40 80 00       	mov    0x804000,%eax
+  80007f:	83 c0 01             	add    $0x1,%eax
+  800082:	a3 00 40 80 00       	mov    %eax,0x804000
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	50                   	push   %eax
+  80008b:	68 c0 28 80 00       	push   $0x8028c0
+  800090:	e8 8a 19 00 00       	call   801a1f <printf>
+			bol = 0;
+  800095:	c7 05 00 30 80 00 00 	movl   $0x0,0x803000
+  80009c:	00 00 00 
+  80009f:	83 c4 10             	add    $0x10,%esp
+  8000a2:	eb 9f                	jmp    800043 <num+0x10>
+			panic("write error copying %s: %e", s, r);
+  8000a4:	83 ec 0c             	sub    $0xc,%esp
+  8000a7:	50                   	push   %eax
+  8000a8:	ff 75 0c             	push   0xc(%ebp)
+  8000ab:	68 c5 28 80 00       	push   $0x8028c5
+  8000b0:	6a 13                	push   $0x13
+  8000b2:	68 e0 28 80 00       	push   $0x8028e0
+  8000b7:	e8 1f 01 00 00       	call   8001db <_panic>
+			bol = 1;
+  8000bc:	c7 05 00 30 80 00 01 	movl   $0x1,0x803000
+  8000c3:	00 00 00 
+  8000c6:	eb 96                	jmp    80005e <num+0x2b>
+	}
+	if (n < 0)
+  8000c8:	78 07                	js     8000d1 <num+0x9e>
+		panic("error reading %s: %e", s, n);
+}
+  8000ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cd:	5b                   	pop    %ebx
+  8000ce:	5e                   	pop    %esi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	50                   	push   %eax
+  8000d5:	ff 75 0c             	push   0xc(%ebp)
+  8000d8:	68 eb 28 80 00       	push   $0x8028eb
+  8000dd:	6a 18                	push   $0x18
+  8000df:	68 e0 28 80 00       	push   $0x8028e0
+  8000e4:	e8 f2 00 00 00       	call   8001db <_panic>
+
+008000e9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000e9:	55                   	push   %ebp
+  8000ea:	89 e5                	mov    %esp,%ebp
+  8000ec:	57                   	push   %edi
+  8000ed:	56                   	push   %esi
+  8000ee:	53                   	push   %ebx
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+	int f, i;
+
+	binaryname = "num";
+  8000f2:	c7 05 04 30 80 00 00 	movl   $0x802900,0x803004
+  8000f9:	29 80 00 
+	if (argc == 1)
+  8000fc:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800100:	74 0d                	je     80010f <umain+0x26>
+  800102:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800105:	8d 70 04             	lea    0x4(%eax),%esi
+		num(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  800108:	bf 01 00 00 00       	mov    $0x1,%edi
+  80010d:	eb 3b                	jmp    80014a <umain+0x61>
+		num(0, "<stdin>");
+  80010f:	83 ec 08             	sub    $0x8,%esp
+  800112:	68 04 29 80 00       	push   $0x802904
+  800117:	6a 00                	push   $0x0
+  800119:	e8 15 ff ff ff       	call   800033 <num>
+  80011e:	83 c4 10             	add    $0x10,%esp
+			else {
+				num(f, argv[i]);
+				close(f);
+			}
+		}
+	exit();
+  800121:	e8 9b 00 00 00       	call   8001c1 <exit>
+}
+  800126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5f                   	pop    %edi
+  80012c:	5d                   	pop    %ebp
+  80012d:	c3                   	ret
+				num(f, argv[i]);
+  80012e:	83 ec 08             	sub    $0x8,%esp
+  800131:	ff 36                	push   (%esi)
+  800133:	50                   	push   %eax
+  800134:	e8 fa fe ff ff       	call   800033 <num>
+				close(f);
+  800139:	89 1c 24             	mov    %ebx,(%esp)
+  80013c:	e8 9c 11 00 00       	call   8012dd <close>
+		for (i = 1; i < argc; i++) {
+  800141:	83 c7 01             	add    $0x1,%edi
+  800144:	83 c6 04             	add    $0x4,%esi
+  800147:	83 c4 10             	add    $0x10,%esp
+  80014a:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80014d:	7d d2                	jge    800121 <umain+0x38>
+			f = open(argv[i], O_RDONLY);
+  80014f:	83 ec 08             	sub    $0x8,%esp
+  800152:	6a 00                	push   $0x0
+  800154:	ff 36                	push   (%esi)
+  800156:	e8 21 17 00 00       	call   80187c <open>
+  80015b:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	85 c0                	test   %eax,%eax
+  800162:	79 ca                	jns    80012e <umain+0x45>
+				panic("can't open %s: %e", argv[i], f);
+  800164:	83 ec 0c             	sub    $0xc,%esp
+  800167:	50                   	push   %eax
+  800168:	ff 36                	push   (%esi)
+  80016a:	68 0c 29 80 00       	push   $0x80290c
+  80016f:	6a 27                	push   $0x27
+  800171:	68 e0 28 80 00       	push   $0x8028e0
+  800176:	e8 60 00 00 00       	call   8001db <_panic>
+
+0080017b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	56                   	push   %esi
+  80017f:	53                   	push   %ebx
+  800180:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800183:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800186:	e8 e7 0a 00 00       	call   800c72 <sys_getenvid>
+  80018b:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800190:	c1 e0 09             	shl    $0x9,%eax
+  800193:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800198:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80019d:	85 db                	test   %ebx,%ebx
+  80019f:	7e 07                	jle    8001a8 <libmain+0x2d>
+		binaryname = argv[0];
+  8001a1:	8b 06                	mov    (%esi),%eax
+  8001a3:	a3 04 30 80 00       	mov    %eax,0x803004
+
+	// call user main routine
+	umain(argc, argv);
+  8001a8:	83 ec 08             	sub    $0x8,%esp
+  8001ab:	56                   	push   %esi
+  8001ac:	53                   	push   %ebx
+  8001ad:	e8 37 ff ff ff       	call   8000e9 <umain>
+
+	// exit gracefully
+	exit();
+  8001b2:	e8 0a 00 00 00       	call   8001c1 <exit>
+}
+  8001b7:	83 c4 10             	add    $0x10,%esp
+  8001ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001bd:	5b                   	pop    %ebx
+  8001be:	5e                   	pop    %esi
+  8001bf:	5d                   	pop    %ebp
+  8001c0:	c3                   	ret
+
+008001c1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001c1:	55                   	push   %ebp
+  8001c2:	89 e5                	mov    %esp,%ebp
+  8001c4:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001c7:	e8 3e 11 00 00       	call   80130a <close_all>
+	sys_env_destroy(0);
+  8001cc:	83 ec 0c             	sub    $0xc,%esp
+  8001cf:	6a 00                	push   $0x0
+  8001d1:	e8 5b 0a 00 00       	call   800c31 <sys_env_destroy>
+}
+  8001d6:	83 c4 10             	add    $0x10,%esp
+  8001d9:	c9                   	leave
+  8001da:	c3                   	ret
+
+008001db <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001db:	55                   	push   %ebp
+  8001dc:	89 e5                	mov    %esp,%ebp
+  8001de:	56                   	push   %esi
+  8001df:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001e0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001e3:	8b 35 04 30 80 00    	mov    0x803004,%esi
+  8001e9:	e8 84 0a 00 00       	call   800c72 <sys_getenvid>
+  8001ee:	83 ec 0c             	sub    $0xc,%esp
+  8001f1:	ff 75 0c             	push   0xc(%ebp)
+  8001f4:	ff 75 08             	push   0x8(%ebp)
+  8001f7:	56                   	push   %esi
+  8001f8:	50                   	push   %eax
+  8001f9:	68 28 29 80 00       	push   $0x802928
+  8001fe:	e8 b3 00 00 00       	call   8002b6 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800203:	83 c4 18             	add    $0x18,%esp
+  800206:	53                   	push   %ebx
+  800207:	ff 75 10             	push   0x10(%ebp)
+  80020a:	e8 56 00 00 00       	call   800265 <vcprintf>
+	cprintf("\n");
+  80020f:	c7 04 24 80 2d 80 00 	movl   $0x802d80,(%esp)
+  800216:	e8 9b 00 00 00       	call   8002b6 <cprintf>
+  80021b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80021e:	cc                   	int3
+	while (1)
+  80021f:	eb fd                	jmp    80021e <_panic+0x43>
+
+00800221 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800221:	55                   	push   %ebp
+  800222:	89 e5                	mov    %esp,%ebp
+  800224:	53                   	push   %ebx
+  800225:	83 ec 04             	sub    $0x4,%esp
+  800228:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80022b:	8b 13                	mov    (%ebx),%edx
+  80022d:	8d 42 01             	lea    0x1(%edx),%eax
+  800230:	89 03                	mov    %eax,(%ebx)
+  800232:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800235:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800239:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80023e:	74 09                	je     800249 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800240:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800244:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800247:	c9                   	leave
+  800248:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800249:	83 ec 08             	sub    $0x8,%esp
+  80024c:	68 ff 00 00 00       	push   $0xff
+  800251:	8d 43 08             	lea    0x8(%ebx),%eax
+  800254:	50                   	push   %eax
+  800255:	e8 7a 09 00 00       	call   800bd4 <sys_cputs>
+		b->idx = 0;
+  80025a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800260:	83 c4 10             	add    $0x10,%esp
+  800263:	eb db                	jmp    800240 <putch+0x1f>
+
+00800265 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800265:	55                   	push   %ebp
+  800266:	89 e5                	mov    %esp,%ebp
+  800268:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80026e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800275:	00 00 00 
+	b.cnt = 0;
+  800278:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80027f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800282:	ff 75 0c             	push   0xc(%ebp)
+  800285:	ff 75 08             	push   0x8(%ebp)
+  800288:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80028e:	50                   	push   %eax
+  80028f:	68 21 02 80 00       	push   $0x800221
+  800294:	e8 14 01 00 00       	call   8003ad <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800299:	83 c4 08             	add    $0x8,%esp
+  80029c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002a2:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002a8:	50                   	push   %eax
+  8002a9:	e8 26 09 00 00       	call   800bd4 <sys_cputs>
+
+	return b.cnt;
+}
+  8002ae:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002b4:	c9                   	leave
+  8002b5:	c3                   	ret
+
+008002b6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002b6:	55                   	push   %ebp
+  8002b7:	89 e5                	mov    %esp,%ebp
+  8002b9:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002bc:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002bf:	50                   	push   %eax
+  8002c0:	ff 75 08             	push   0x8(%ebp)
+  8002c3:	e8 9d ff ff ff       	call   800265 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002c8:	c9                   	leave
+  8002c9:	c3                   	ret
+
+008002ca <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002ca:	55                   	push   %ebp
+  8002cb:	89 e5                	mov    %esp,%ebp
+  8002cd:	57                   	push   %edi
+  8002ce:	56                   	push   %esi
+  8002cf:	53                   	push   %ebx
+  8002d0:	83 ec 1c             	sub    $0x1c,%esp
+  8002d3:	89 c7                	mov    %eax,%edi
+  8002d5:	89 d6                	mov    %edx,%esi
+  8002d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002da:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002dd:	89 d1                	mov    %edx,%ecx
+  8002df:	89 c2                	mov    %eax,%edx
+  8002e1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002e4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002e7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002ea:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002f0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002f7:	39 c2                	cmp    %eax,%edx
+  8002f9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002fc:	72 3e                	jb     80033c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002fe:	83 ec 0c             	sub    $0xc,%esp
+  800301:	ff 75 18             	push   0x18(%ebp)
+  800304:	83 eb 01             	sub    $0x1,%ebx
+  800307:	53                   	push   %ebx
+  800308:	50                   	push   %eax
+  800309:	83 ec 08             	sub    $0x8,%esp
+  80030c:	ff 75 e4             	push   -0x1c(%ebp)
+  80030f:	ff 75 e0             	push   -0x20(%ebp)
+  800312:	ff 75 dc             	push   -0x24(%ebp)
+  800315:	ff 75 d8             	push   -0x28(%ebp)
+  800318:	e8 33 22 00 00       	call   802550 <__udivdi3>
+  80031d:	83 c4 18             	add    $0x18,%esp
+  800320:	52                   	push   %edx
+  800321:	50                   	push   %eax
+  800322:	89 f2                	mov    %esi,%edx
+  800324:	89 f8                	mov    %edi,%eax
+  800326:	e8 9f ff ff ff       	call   8002ca <printnum>
+  80032b:	83 c4 20             	add    $0x20,%esp
+  80032e:	eb 13                	jmp    800343 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800330:	83 ec 08             	sub    $0x8,%esp
+  800333:	56                   	push   %esi
+  800334:	ff 75 18             	push   0x18(%ebp)
+  800337:	ff d7                	call   *%edi
+  800339:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80033c:	83 eb 01             	sub    $0x1,%ebx
+  80033f:	85 db                	test   %ebx,%ebx
+  800341:	7f ed                	jg     800330 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800343:	83 ec 08             	sub    $0x8,%esp
+  800346:	56                   	push   %esi
+  800347:	83 ec 04             	sub    $0x4,%esp
+  80034a:	ff 75 e4             	push   -0x1c(%ebp)
+  80034d:	ff 75 e0             	push   -0x20(%ebp)
+  800350:	ff 75 dc             	push   -0x24(%ebp)
+  800353:	ff 75 d8             	push   -0x28(%ebp)
+  800356:	e8 b5 22 00 00       	call   802610 <__umoddi3>
+  80035b:	83 c4 14             	add    $0x14,%esp
+  80035e:	0f be 80 4b 29 80 00 	movsbl 0x80294b(%eax),%eax
+  800365:	50                   	push   %eax
+  800366:	ff d7                	call   *%edi
+}
+  800368:	83 c4 10             	add    $0x10,%esp
+  80036b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80036e:	5b                   	pop    %ebx
+  80036f:	5e                   	pop    %esi
+  800370:	5f                   	pop    %edi
+  800371:	5d                   	pop    %ebp
+  800372:	c3                   	ret
+
+00800373 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800373:	55                   	push   %ebp
+  800374:	89 e5                	mov    %esp,%ebp
+  800376:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800379:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80037d:	8b 10                	mov    (%eax),%edx
+  80037f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800382:	73 0a                	jae    80038e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800384:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800387:	89 08                	mov    %ecx,(%eax)
+  800389:	8b 45 08             	mov    0x8(%ebp),%eax
+  80038c:	88 02                	mov    %al,(%edx)
+}
+  80038e:	5d                   	pop    %ebp
+  80038f:	c3                   	ret
+
+00800390 <printfmt>:
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800396:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800399:	50                   	push   %eax
+  80039a:	ff 75 10             	push   0x10(%ebp)
+  80039d:	ff 75 0c             	push   0xc(%ebp)
+  8003a0:	ff 75 08             	push   0x8(%ebp)
+  8003a3:	e8 05 00 00 00       	call   8003ad <vprintfmt>
+}
+  8003a8:	83 c4 10             	add    $0x10,%esp
+  8003ab:	c9                   	leave
+  8003ac:	c3                   	ret
+
+008003ad <vprintfmt>:
+{
+  8003ad:	55                   	push   %ebp
+  8003ae:	89 e5                	mov    %esp,%ebp
+  8003b0:	57                   	push   %edi
+  8003b1:	56                   	push   %esi
+  8003b2:	53                   	push   %ebx
+  8003b3:	83 ec 2c             	sub    $0x2c,%esp
+  8003b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003bc:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003bf:	eb 0a                	jmp    8003cb <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003c1:	83 ec 08             	sub    $0x8,%esp
+  8003c4:	53                   	push   %ebx
+  8003c5:	50                   	push   %eax
+  8003c6:	ff d6                	call   *%esi
+  8003c8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003cb:	83 c7 01             	add    $0x1,%edi
+  8003ce:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003d2:	83 f8 25             	cmp    $0x25,%eax
+  8003d5:	74 0c                	je     8003e3 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003d7:	85 c0                	test   %eax,%eax
+  8003d9:	75 e6                	jne    8003c1 <vprintfmt+0x14>
+}
+  8003db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003de:	5b                   	pop    %ebx
+  8003df:	5e                   	pop    %esi
+  8003e0:	5f                   	pop    %edi
+  8003e1:	5d                   	pop    %ebp
+  8003e2:	c3                   	ret
+		padc = ' ';
+  8003e3:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003e7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003ee:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003f5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800401:	8d 47 01             	lea    0x1(%edi),%eax
+  800404:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800407:	0f b6 17             	movzbl (%edi),%edx
+  80040a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80040d:	3c 55                	cmp    $0x55,%al
+  80040f:	0f 87 cf 03 00 00    	ja     8007e4 <vprintfmt+0x437>
+  800415:	0f b6 c0             	movzbl %al,%eax
+  800418:	ff 24 85 80 2a 80 00 	jmp    *0x802a80(,%eax,4)
+  80041f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800422:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800426:	eb d9                	jmp    800401 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800428:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80042b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80042f:	eb d0                	jmp    800401 <vprintfmt+0x54>
+  800431:	0f b6 d2             	movzbl %dl,%edx
+  800434:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800437:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80043f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800442:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800446:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800449:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80044c:	83 f9 09             	cmp    $0x9,%ecx
+  80044f:	77 55                	ja     8004a6 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800451:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800454:	eb e9                	jmp    80043f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800456:	8b 45 14             	mov    0x14(%ebp),%eax
+  800459:	8b 00                	mov    (%eax),%eax
+  80045b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80045e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800461:	8d 40 04             	lea    0x4(%eax),%eax
+  800464:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800467:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80046a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80046e:	79 91                	jns    800401 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800470:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800473:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800476:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80047d:	eb 82                	jmp    800401 <vprintfmt+0x54>
+			if (width < 0)
+  80047f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800482:	85 d2                	test   %edx,%edx
+  800484:	b8 00 00 00 00       	mov    $0x0,%eax
+  800489:	0f 49 c2             	cmovns %edx,%eax
+  80048c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80048f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800492:	e9 6a ff ff ff       	jmp    800401 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800497:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80049a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004a1:	e9 5b ff ff ff       	jmp    800401 <vprintfmt+0x54>
+  8004a6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004a9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ac:	eb bc                	jmp    80046a <vprintfmt+0xbd>
+			lflag++;
+  8004ae:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004b4:	e9 48 ff ff ff       	jmp    800401 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bc:	8d 78 04             	lea    0x4(%eax),%edi
+  8004bf:	83 ec 08             	sub    $0x8,%esp
+  8004c2:	53                   	push   %ebx
+  8004c3:	ff 30                	push   (%eax)
+  8004c5:	ff d6                	call   *%esi
+			break;
+  8004c7:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004ca:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004cd:	e9 b1 02 00 00       	jmp    800783 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8004d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d5:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004d8:	8b 10                	mov    (%eax),%edx
+  8004da:	89 d0                	mov    %edx,%eax
+  8004dc:	f7 d8                	neg    %eax
+  8004de:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004e1:	83 f8 0f             	cmp    $0xf,%eax
+  8004e4:	7f 23                	jg     800509 <vprintfmt+0x15c>
+  8004e6:	8b 14 85 e0 2b 80 00 	mov    0x802be0(,%eax,4),%edx
+  8004ed:	85 d2                	test   %edx,%edx
+  8004ef:	74 18                	je     800509 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004f1:	52                   	push   %edx
+  8004f2:	68 15 2d 80 00       	push   $0x802d15
+  8004f7:	53                   	push   %ebx
+  8004f8:	56                   	push   %esi
+  8004f9:	e8 92 fe ff ff       	call   800390 <printfmt>
+  8004fe:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800501:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800504:	e9 7a 02 00 00       	jmp    800783 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800509:	50                   	push   %eax
+  80050a:	68 63 29 80 00       	push   $0x802963
+  80050f:	53                   	push   %ebx
+  800510:	56                   	push   %esi
+  800511:	e8 7a fe ff ff       	call   800390 <printfmt>
+  800516:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800519:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80051c:	e9 62 02 00 00       	jmp    800783 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800521:	8b 45 14             	mov    0x14(%ebp),%eax
+  800524:	83 c0 04             	add    $0x4,%eax
+  800527:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80052a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80052f:	85 c9                	test   %ecx,%ecx
+  800531:	b8 5c 29 80 00       	mov    $0x80295c,%eax
+  800536:	0f 45 c1             	cmovne %ecx,%eax
+  800539:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80053c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800540:	7e 06                	jle    800548 <vprintfmt+0x19b>
+  800542:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800546:	75 0b                	jne    800553 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800548:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80054b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80054e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800551:	eb 5c                	jmp    8005af <vprintfmt+0x202>
+  800553:	83 ec 08             	sub    $0x8,%esp
+  800556:	ff 75 d0             	push   -0x30(%ebp)
+  800559:	ff 75 cc             	push   -0x34(%ebp)
+  80055c:	e8 20 03 00 00       	call   800881 <strnlen>
+  800561:	89 c2                	mov    %eax,%edx
+  800563:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800566:	29 d0                	sub    %edx,%eax
+  800568:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80056b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80056f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800572:	89 75 08             	mov    %esi,0x8(%ebp)
+  800575:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800577:	eb 0e                	jmp    800587 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800579:	83 ec 08             	sub    $0x8,%esp
+  80057c:	53                   	push   %ebx
+  80057d:	57                   	push   %edi
+  80057e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800581:	83 ee 01             	sub    $0x1,%esi
+  800584:	83 c4 10             	add    $0x10,%esp
+  800587:	85 f6                	test   %esi,%esi
+  800589:	7f ee                	jg     800579 <vprintfmt+0x1cc>
+  80058b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80058e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800591:	85 c0                	test   %eax,%eax
+  800593:	ba 00 00 00 00       	mov    $0x0,%edx
+  800598:	0f 49 d0             	cmovns %eax,%edx
+  80059b:	29 d0                	sub    %edx,%eax
+  80059d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005a0:	eb a6                	jmp    800548 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005a2:	83 ec 08             	sub    $0x8,%esp
+  8005a5:	53                   	push   %ebx
+  8005a6:	52                   	push   %edx
+  8005a7:	ff 55 08             	call   *0x8(%ebp)
+  8005aa:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ad:	89 f1                	mov    %esi,%ecx
+  8005af:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005b2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005b6:	0f be d0             	movsbl %al,%edx
+  8005b9:	85 d2                	test   %edx,%edx
+  8005bb:	74 28                	je     8005e5 <vprintfmt+0x238>
+  8005bd:	85 ff                	test   %edi,%edi
+  8005bf:	78 05                	js     8005c6 <vprintfmt+0x219>
+  8005c1:	83 ef 01             	sub    $0x1,%edi
+  8005c4:	78 30                	js     8005f6 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005c6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005ca:	74 d6                	je     8005a2 <vprintfmt+0x1f5>
+  8005cc:	0f be c0             	movsbl %al,%eax
+  8005cf:	83 e8 20             	sub    $0x20,%eax
+  8005d2:	83 f8 5e             	cmp    $0x5e,%eax
+  8005d5:	76 cb                	jbe    8005a2 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+  8005da:	53                   	push   %ebx
+  8005db:	6a 3f                	push   $0x3f
+  8005dd:	ff 55 08             	call   *0x8(%ebp)
+  8005e0:	83 c4 10             	add    $0x10,%esp
+  8005e3:	eb c8                	jmp    8005ad <vprintfmt+0x200>
+  8005e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005eb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005ee:	01 d0                	add    %edx,%eax
+  8005f0:	29 c8                	sub    %ecx,%eax
+  8005f2:	89 c7                	mov    %eax,%edi
+  8005f4:	eb 13                	jmp    800609 <vprintfmt+0x25c>
+  8005f6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005f9:	eb ed                	jmp    8005e8 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005fb:	83 ec 08             	sub    $0x8,%esp
+  8005fe:	53                   	push   %ebx
+  8005ff:	6a 20                	push   $0x20
+  800601:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800603:	83 ef 01             	sub    $0x1,%edi
+  800606:	83 c4 10             	add    $0x10,%esp
+  800609:	85 ff                	test   %edi,%edi
+  80060b:	7f ee                	jg     8005fb <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80060d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800610:	89 45 14             	mov    %eax,0x14(%ebp)
+  800613:	e9 6b 01 00 00       	jmp    800783 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800618:	83 f9 01             	cmp    $0x1,%ecx
+  80061b:	7f 1f                	jg     80063c <vprintfmt+0x28f>
+	else if (lflag)
+  80061d:	85 c9                	test   %ecx,%ecx
+  80061f:	74 67                	je     800688 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8b 00                	mov    (%eax),%eax
+  800626:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800629:	89 c1                	mov    %eax,%ecx
+  80062b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80062e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800631:	8b 45 14             	mov    0x14(%ebp),%eax
+  800634:	8d 40 04             	lea    0x4(%eax),%eax
+  800637:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063a:	eb 17                	jmp    800653 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80063c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063f:	8b 50 04             	mov    0x4(%eax),%edx
+  800642:	8b 00                	mov    (%eax),%eax
+  800644:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800647:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80064a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064d:	8d 40 08             	lea    0x8(%eax),%eax
+  800650:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800653:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800656:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800659:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80065e:	85 c9                	test   %ecx,%ecx
+  800660:	0f 89 03 01 00 00    	jns    800769 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800666:	83 ec 08             	sub    $0x8,%esp
+  800669:	53                   	push   %ebx
+  80066a:	6a 2d                	push   $0x2d
+  80066c:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80066e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800671:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800674:	f7 da                	neg    %edx
+  800676:	83 d1 00             	adc    $0x0,%ecx
+  800679:	f7 d9                	neg    %ecx
+  80067b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80067e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800683:	e9 e1 00 00 00       	jmp    800769 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8b 00                	mov    (%eax),%eax
+  80068d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800690:	89 c1                	mov    %eax,%ecx
+  800692:	c1 f9 1f             	sar    $0x1f,%ecx
+  800695:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8d 40 04             	lea    0x4(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a1:	eb b0                	jmp    800653 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006a3:	83 f9 01             	cmp    $0x1,%ecx
+  8006a6:	7f 1e                	jg     8006c6 <vprintfmt+0x319>
+	else if (lflag)
+  8006a8:	85 c9                	test   %ecx,%ecx
+  8006aa:	74 32                	je     8006de <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8b 10                	mov    (%eax),%edx
+  8006b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006bc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006c1:	e9 a3 00 00 00       	jmp    800769 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c9:	8b 10                	mov    (%eax),%edx
+  8006cb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ce:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006d9:	e9 8b 00 00 00       	jmp    800769 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8b 10                	mov    (%eax),%edx
+  8006e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ee:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006f3:	eb 74                	jmp    800769 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8006f5:	83 f9 01             	cmp    $0x1,%ecx
+  8006f8:	7f 1b                	jg     800715 <vprintfmt+0x368>
+	else if (lflag)
+  8006fa:	85 c9                	test   %ecx,%ecx
+  8006fc:	74 2c                	je     80072a <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 10                	mov    (%eax),%edx
+  800703:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800708:	8d 40 04             	lea    0x4(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80070e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800713:	eb 54                	jmp    800769 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800715:	8b 45 14             	mov    0x14(%ebp),%eax
+  800718:	8b 10                	mov    (%eax),%edx
+  80071a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80071d:	8d 40 08             	lea    0x8(%eax),%eax
+  800720:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800723:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800728:	eb 3f                	jmp    800769 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80072a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072d:	8b 10                	mov    (%eax),%edx
+  80072f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800734:	8d 40 04             	lea    0x4(%eax),%eax
+  800737:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80073a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80073f:	eb 28                	jmp    800769 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800741:	83 ec 08             	sub    $0x8,%esp
+  800744:	53                   	push   %ebx
+  800745:	6a 30                	push   $0x30
+  800747:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800749:	83 c4 08             	add    $0x8,%esp
+  80074c:	53                   	push   %ebx
+  80074d:	6a 78                	push   $0x78
+  80074f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800751:	8b 45 14             	mov    0x14(%ebp),%eax
+  800754:	8b 10                	mov    (%eax),%edx
+  800756:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80075b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80075e:	8d 40 04             	lea    0x4(%eax),%eax
+  800761:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800764:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800769:	83 ec 0c             	sub    $0xc,%esp
+  80076c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800770:	50                   	push   %eax
+  800771:	ff 75 e0             	push   -0x20(%ebp)
+  800774:	57                   	push   %edi
+  800775:	51                   	push   %ecx
+  800776:	52                   	push   %edx
+  800777:	89 da                	mov    %ebx,%edx
+  800779:	89 f0                	mov    %esi,%eax
+  80077b:	e8 4a fb ff ff       	call   8002ca <printnum>
+			break;
+  800780:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800783:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800786:	e9 40 fc ff ff       	jmp    8003cb <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80078b:	83 f9 01             	cmp    $0x1,%ecx
+  80078e:	7f 1b                	jg     8007ab <vprintfmt+0x3fe>
+	else if (lflag)
+  800790:	85 c9                	test   %ecx,%ecx
+  800792:	74 2c                	je     8007c0 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800794:	8b 45 14             	mov    0x14(%ebp),%eax
+  800797:	8b 10                	mov    (%eax),%edx
+  800799:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80079e:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007a9:	eb be                	jmp    800769 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ae:	8b 10                	mov    (%eax),%edx
+  8007b0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8007b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007be:	eb a9                	jmp    800769 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c3:	8b 10                	mov    (%eax),%edx
+  8007c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8007cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007d5:	eb 92                	jmp    800769 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8007d7:	83 ec 08             	sub    $0x8,%esp
+  8007da:	53                   	push   %ebx
+  8007db:	6a 25                	push   $0x25
+  8007dd:	ff d6                	call   *%esi
+			break;
+  8007df:	83 c4 10             	add    $0x10,%esp
+  8007e2:	eb 9f                	jmp    800783 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8007e4:	83 ec 08             	sub    $0x8,%esp
+  8007e7:	53                   	push   %ebx
+  8007e8:	6a 25                	push   $0x25
+  8007ea:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007ec:	83 c4 10             	add    $0x10,%esp
+  8007ef:	89 f8                	mov    %edi,%eax
+  8007f1:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007f5:	74 05                	je     8007fc <vprintfmt+0x44f>
+  8007f7:	83 e8 01             	sub    $0x1,%eax
+  8007fa:	eb f5                	jmp    8007f1 <vprintfmt+0x444>
+  8007fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007ff:	eb 82                	jmp    800783 <vprintfmt+0x3d6>
+
+00800801 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800801:	55                   	push   %ebp
+  800802:	89 e5                	mov    %esp,%ebp
+  800804:	83 ec 18             	sub    $0x18,%esp
+  800807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80080d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800810:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800814:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800817:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80081e:	85 c0                	test   %eax,%eax
+  800820:	74 26                	je     800848 <vsnprintf+0x47>
+  800822:	85 d2                	test   %edx,%edx
+  800824:	7e 22                	jle    800848 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800826:	ff 75 14             	push   0x14(%ebp)
+  800829:	ff 75 10             	push   0x10(%ebp)
+  80082c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80082f:	50                   	push   %eax
+  800830:	68 73 03 80 00       	push   $0x800373
+  800835:	e8 73 fb ff ff       	call   8003ad <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80083a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80083d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800840:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800843:	83 c4 10             	add    $0x10,%esp
+}
+  800846:	c9                   	leave
+  800847:	c3                   	ret
+		return -E_INVAL;
+  800848:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80084d:	eb f7                	jmp    800846 <vsnprintf+0x45>
+
+0080084f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800855:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800858:	50                   	push   %eax
+  800859:	ff 75 10             	push   0x10(%ebp)
+  80085c:	ff 75 0c             	push   0xc(%ebp)
+  80085f:	ff 75 08             	push   0x8(%ebp)
+  800862:	e8 9a ff ff ff       	call   800801 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800867:	c9                   	leave
+  800868:	c3                   	ret
+
+00800869 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800869:	55                   	push   %ebp
+  80086a:	89 e5                	mov    %esp,%ebp
+  80086c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80086f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800874:	eb 03                	jmp    800879 <strlen+0x10>
+		n++;
+  800876:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800879:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80087d:	75 f7                	jne    800876 <strlen+0xd>
+	return n;
+}
+  80087f:	5d                   	pop    %ebp
+  800880:	c3                   	ret
+
+00800881 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800881:	55                   	push   %ebp
+  800882:	89 e5                	mov    %esp,%ebp
+  800884:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800887:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80088a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088f:	eb 03                	jmp    800894 <strnlen+0x13>
+		n++;
+  800891:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800894:	39 d0                	cmp    %edx,%eax
+  800896:	74 08                	je     8008a0 <strnlen+0x1f>
+  800898:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80089c:	75 f3                	jne    800891 <strnlen+0x10>
+  80089e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008a0:	89 d0                	mov    %edx,%eax
+  8008a2:	5d                   	pop    %ebp
+  8008a3:	c3                   	ret
+
+008008a4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008a4:	55                   	push   %ebp
+  8008a5:	89 e5                	mov    %esp,%ebp
+  8008a7:	53                   	push   %ebx
+  8008a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b3:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008b7:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008ba:	83 c0 01             	add    $0x1,%eax
+  8008bd:	84 d2                	test   %dl,%dl
+  8008bf:	75 f2                	jne    8008b3 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008c1:	89 c8                	mov    %ecx,%eax
+  8008c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008c6:	c9                   	leave
+  8008c7:	c3                   	ret
+
+008008c8 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	53                   	push   %ebx
+  8008cc:	83 ec 10             	sub    $0x10,%esp
+  8008cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008d2:	53                   	push   %ebx
+  8008d3:	e8 91 ff ff ff       	call   800869 <strlen>
+  8008d8:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008db:	ff 75 0c             	push   0xc(%ebp)
+  8008de:	01 d8                	add    %ebx,%eax
+  8008e0:	50                   	push   %eax
+  8008e1:	e8 be ff ff ff       	call   8008a4 <strcpy>
+	return dst;
+}
+  8008e6:	89 d8                	mov    %ebx,%eax
+  8008e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008eb:	c9                   	leave
+  8008ec:	c3                   	ret
+
+008008ed <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008ed:	55                   	push   %ebp
+  8008ee:	89 e5                	mov    %esp,%ebp
+  8008f0:	56                   	push   %esi
+  8008f1:	53                   	push   %ebx
+  8008f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008f8:	89 f3                	mov    %esi,%ebx
+  8008fa:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008fd:	89 f0                	mov    %esi,%eax
+  8008ff:	eb 0f                	jmp    800910 <strncpy+0x23>
+		*dst++ = *src;
+  800901:	83 c0 01             	add    $0x1,%eax
+  800904:	0f b6 0a             	movzbl (%edx),%ecx
+  800907:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80090a:	80 f9 01             	cmp    $0x1,%cl
+  80090d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800910:	39 d8                	cmp    %ebx,%eax
+  800912:	75 ed                	jne    800901 <strncpy+0x14>
+	}
+	return ret;
+}
+  800914:	89 f0                	mov    %esi,%eax
+  800916:	5b                   	pop    %ebx
+  800917:	5e                   	pop    %esi
+  800918:	5d                   	pop    %ebp
+  800919:	c3                   	ret
+
+0080091a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	56                   	push   %esi
+  80091e:	53                   	push   %ebx
+  80091f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800922:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800925:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800928:	89 f0                	mov    %esi,%eax
+  80092a:	85 d2                	test   %edx,%edx
+  80092c:	74 21                	je     80094f <strlcpy+0x35>
+  80092e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800932:	89 f2                	mov    %esi,%edx
+  800934:	eb 09                	jmp    80093f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800936:	83 c1 01             	add    $0x1,%ecx
+  800939:	83 c2 01             	add    $0x1,%edx
+  80093c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80093f:	39 c2                	cmp    %eax,%edx
+  800941:	74 09                	je     80094c <strlcpy+0x32>
+  800943:	0f b6 19             	movzbl (%ecx),%ebx
+  800946:	84 db                	test   %bl,%bl
+  800948:	75 ec                	jne    800936 <strlcpy+0x1c>
+  80094a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80094c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80094f:	29 f0                	sub    %esi,%eax
+}
+  800951:	5b                   	pop    %ebx
+  800952:	5e                   	pop    %esi
+  800953:	5d                   	pop    %ebp
+  800954:	c3                   	ret
+
+00800955 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800955:	55                   	push   %ebp
+  800956:	89 e5                	mov    %esp,%ebp
+  800958:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80095b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80095e:	eb 06                	jmp    800966 <strcmp+0x11>
+		p++, q++;
+  800960:	83 c1 01             	add    $0x1,%ecx
+  800963:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800966:	0f b6 01             	movzbl (%ecx),%eax
+  800969:	84 c0                	test   %al,%al
+  80096b:	74 04                	je     800971 <strcmp+0x1c>
+  80096d:	3a 02                	cmp    (%edx),%al
+  80096f:	74 ef                	je     800960 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800971:	0f b6 c0             	movzbl %al,%eax
+  800974:	0f b6 12             	movzbl (%edx),%edx
+  800977:	29 d0                	sub    %edx,%eax
+}
+  800979:	5d                   	pop    %ebp
+  80097a:	c3                   	ret
+
+0080097b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80097b:	55                   	push   %ebp
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	53                   	push   %ebx
+  80097f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800982:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800985:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800988:	eb 09                	jmp    800993 <strncmp+0x18>
+		n--, p++, q++;
+  80098a:	83 ea 01             	sub    $0x1,%edx
+  80098d:	83 c0 01             	add    $0x1,%eax
+  800990:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800993:	85 d2                	test   %edx,%edx
+  800995:	74 18                	je     8009af <strncmp+0x34>
+  800997:	0f b6 18             	movzbl (%eax),%ebx
+  80099a:	84 db                	test   %bl,%bl
+  80099c:	74 04                	je     8009a2 <strncmp+0x27>
+  80099e:	3a 19                	cmp    (%ecx),%bl
+  8009a0:	74 e8                	je     80098a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009a2:	0f b6 00             	movzbl (%eax),%eax
+  8009a5:	0f b6 11             	movzbl (%ecx),%edx
+  8009a8:	29 d0                	sub    %edx,%eax
+}
+  8009aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ad:	c9                   	leave
+  8009ae:	c3                   	ret
+		return 0;
+  8009af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b4:	eb f4                	jmp    8009aa <strncmp+0x2f>
+
+008009b6 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009b6:	55                   	push   %ebp
+  8009b7:	89 e5                	mov    %esp,%ebp
+  8009b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009c0:	eb 03                	jmp    8009c5 <strchr+0xf>
+  8009c2:	83 c0 01             	add    $0x1,%eax
+  8009c5:	0f b6 10             	movzbl (%eax),%edx
+  8009c8:	84 d2                	test   %dl,%dl
+  8009ca:	74 06                	je     8009d2 <strchr+0x1c>
+		if (*s == c)
+  8009cc:	38 ca                	cmp    %cl,%dl
+  8009ce:	75 f2                	jne    8009c2 <strchr+0xc>
+  8009d0:	eb 05                	jmp    8009d7 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009d7:	5d                   	pop    %ebp
+  8009d8:	c3                   	ret
+
+008009d9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009d9:	55                   	push   %ebp
+  8009da:	89 e5                	mov    %esp,%ebp
+  8009dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009df:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009e3:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009e6:	38 ca                	cmp    %cl,%dl
+  8009e8:	74 09                	je     8009f3 <strfind+0x1a>
+  8009ea:	84 d2                	test   %dl,%dl
+  8009ec:	74 05                	je     8009f3 <strfind+0x1a>
+	for (; *s; s++)
+  8009ee:	83 c0 01             	add    $0x1,%eax
+  8009f1:	eb f0                	jmp    8009e3 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009f3:	5d                   	pop    %ebp
+  8009f4:	c3                   	ret
+
+008009f5 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009f5:	55                   	push   %ebp
+  8009f6:	89 e5                	mov    %esp,%ebp
+  8009f8:	57                   	push   %edi
+  8009f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009fc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009ff:	85 c9                	test   %ecx,%ecx
+  800a01:	74 20                	je     800a23 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a03:	89 f8                	mov    %edi,%eax
+  800a05:	09 c8                	or     %ecx,%eax
+  800a07:	a8 03                	test   $0x3,%al
+  800a09:	75 12                	jne    800a1d <memset+0x28>
+		c &= 0xFF;
+  800a0b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a0f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a15:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a18:	fc                   	cld
+  800a19:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a1b:	eb 06                	jmp    800a23 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a20:	fc                   	cld
+  800a21:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a23:	89 f8                	mov    %edi,%eax
+  800a25:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a28:	c9                   	leave
+  800a29:	c3                   	ret
+
+00800a2a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a2a:	55                   	push   %ebp
+  800a2b:	89 e5                	mov    %esp,%ebp
+  800a2d:	57                   	push   %edi
+  800a2e:	56                   	push   %esi
+  800a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a32:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a35:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a38:	39 c6                	cmp    %eax,%esi
+  800a3a:	73 32                	jae    800a6e <memmove+0x44>
+  800a3c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a3f:	39 d0                	cmp    %edx,%eax
+  800a41:	73 2b                	jae    800a6e <memmove+0x44>
+		s += n;
+		d += n;
+  800a43:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a46:	89 d6                	mov    %edx,%esi
+  800a48:	09 fe                	or     %edi,%esi
+  800a4a:	09 ce                	or     %ecx,%esi
+  800a4c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a52:	75 0e                	jne    800a62 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a54:	83 ef 04             	sub    $0x4,%edi
+  800a57:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a5a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a5d:	fd                   	std
+  800a5e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a60:	eb 09                	jmp    800a6b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a62:	83 ef 01             	sub    $0x1,%edi
+  800a65:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a68:	fd                   	std
+  800a69:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a6b:	fc                   	cld
+  800a6c:	eb 1a                	jmp    800a88 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a6e:	89 f2                	mov    %esi,%edx
+  800a70:	09 c2                	or     %eax,%edx
+  800a72:	09 ca                	or     %ecx,%edx
+  800a74:	f6 c2 03             	test   $0x3,%dl
+  800a77:	75 0a                	jne    800a83 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a79:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a7c:	89 c7                	mov    %eax,%edi
+  800a7e:	fc                   	cld
+  800a7f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a81:	eb 05                	jmp    800a88 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a83:	89 c7                	mov    %eax,%edi
+  800a85:	fc                   	cld
+  800a86:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a88:	5e                   	pop    %esi
+  800a89:	5f                   	pop    %edi
+  800a8a:	5d                   	pop    %ebp
+  800a8b:	c3                   	ret
+
+00800a8c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a92:	ff 75 10             	push   0x10(%ebp)
+  800a95:	ff 75 0c             	push   0xc(%ebp)
+  800a98:	ff 75 08             	push   0x8(%ebp)
+  800a9b:	e8 8a ff ff ff       	call   800a2a <memmove>
+}
+  800aa0:	c9                   	leave
+  800aa1:	c3                   	ret
+
+00800aa2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800aa2:	55                   	push   %ebp
+  800aa3:	89 e5                	mov    %esp,%ebp
+  800aa5:	56                   	push   %esi
+  800aa6:	53                   	push   %ebx
+  800aa7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aaa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800aad:	89 c6                	mov    %eax,%esi
+  800aaf:	03 75 10             	add    0x10(%ebp),%esi
+  800ab2:	eb 06                	jmp    800aba <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ab4:	83 c0 01             	add    $0x1,%eax
+  800ab7:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800aba:	39 f0                	cmp    %esi,%eax
+  800abc:	74 14                	je     800ad2 <memcmp+0x30>
+		if (*s1 != *s2)
+  800abe:	0f b6 08             	movzbl (%eax),%ecx
+  800ac1:	0f b6 1a             	movzbl (%edx),%ebx
+  800ac4:	38 d9                	cmp    %bl,%cl
+  800ac6:	74 ec                	je     800ab4 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ac8:	0f b6 c1             	movzbl %cl,%eax
+  800acb:	0f b6 db             	movzbl %bl,%ebx
+  800ace:	29 d8                	sub    %ebx,%eax
+  800ad0:	eb 05                	jmp    800ad7 <memcmp+0x35>
+	}
+
+	return 0;
+  800ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ad7:	5b                   	pop    %ebx
+  800ad8:	5e                   	pop    %esi
+  800ad9:	5d                   	pop    %ebp
+  800ada:	c3                   	ret
+
+00800adb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800adb:	55                   	push   %ebp
+  800adc:	89 e5                	mov    %esp,%ebp
+  800ade:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ae4:	89 c2                	mov    %eax,%edx
+  800ae6:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ae9:	eb 03                	jmp    800aee <memfind+0x13>
+  800aeb:	83 c0 01             	add    $0x1,%eax
+  800aee:	39 d0                	cmp    %edx,%eax
+  800af0:	73 04                	jae    800af6 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800af2:	38 08                	cmp    %cl,(%eax)
+  800af4:	75 f5                	jne    800aeb <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800af6:	5d                   	pop    %ebp
+  800af7:	c3                   	ret
+
+00800af8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800af8:	55                   	push   %ebp
+  800af9:	89 e5                	mov    %esp,%ebp
+  800afb:	57                   	push   %edi
+  800afc:	56                   	push   %esi
+  800afd:	53                   	push   %ebx
+  800afe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b04:	eb 03                	jmp    800b09 <strtol+0x11>
+		s++;
+  800b06:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b09:	0f b6 02             	movzbl (%edx),%eax
+  800b0c:	3c 20                	cmp    $0x20,%al
+  800b0e:	74 f6                	je     800b06 <strtol+0xe>
+  800b10:	3c 09                	cmp    $0x9,%al
+  800b12:	74 f2                	je     800b06 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b14:	3c 2b                	cmp    $0x2b,%al
+  800b16:	74 2a                	je     800b42 <strtol+0x4a>
+	int neg = 0;
+  800b18:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b1d:	3c 2d                	cmp    $0x2d,%al
+  800b1f:	74 2b                	je     800b4c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b21:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b27:	75 0f                	jne    800b38 <strtol+0x40>
+  800b29:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b2c:	74 28                	je     800b56 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b2e:	85 db                	test   %ebx,%ebx
+  800b30:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b35:	0f 44 d8             	cmove  %eax,%ebx
+  800b38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b3d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b40:	eb 46                	jmp    800b88 <strtol+0x90>
+		s++;
+  800b42:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b45:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b4a:	eb d5                	jmp    800b21 <strtol+0x29>
+		s++, neg = 1;
+  800b4c:	83 c2 01             	add    $0x1,%edx
+  800b4f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b54:	eb cb                	jmp    800b21 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b56:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b5a:	74 0e                	je     800b6a <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b5c:	85 db                	test   %ebx,%ebx
+  800b5e:	75 d8                	jne    800b38 <strtol+0x40>
+		s++, base = 8;
+  800b60:	83 c2 01             	add    $0x1,%edx
+  800b63:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b68:	eb ce                	jmp    800b38 <strtol+0x40>
+		s += 2, base = 16;
+  800b6a:	83 c2 02             	add    $0x2,%edx
+  800b6d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b72:	eb c4                	jmp    800b38 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b74:	0f be c0             	movsbl %al,%eax
+  800b77:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b7a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b7d:	7d 3a                	jge    800bb9 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b7f:	83 c2 01             	add    $0x1,%edx
+  800b82:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b86:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b88:	0f b6 02             	movzbl (%edx),%eax
+  800b8b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b8e:	89 f3                	mov    %esi,%ebx
+  800b90:	80 fb 09             	cmp    $0x9,%bl
+  800b93:	76 df                	jbe    800b74 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b95:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b98:	89 f3                	mov    %esi,%ebx
+  800b9a:	80 fb 19             	cmp    $0x19,%bl
+  800b9d:	77 08                	ja     800ba7 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b9f:	0f be c0             	movsbl %al,%eax
+  800ba2:	83 e8 57             	sub    $0x57,%eax
+  800ba5:	eb d3                	jmp    800b7a <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ba7:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800baa:	89 f3                	mov    %esi,%ebx
+  800bac:	80 fb 19             	cmp    $0x19,%bl
+  800baf:	77 08                	ja     800bb9 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bb1:	0f be c0             	movsbl %al,%eax
+  800bb4:	83 e8 37             	sub    $0x37,%eax
+  800bb7:	eb c1                	jmp    800b7a <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bb9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bbd:	74 05                	je     800bc4 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bbf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bc2:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bc4:	89 c8                	mov    %ecx,%eax
+  800bc6:	f7 d8                	neg    %eax
+  800bc8:	85 ff                	test   %edi,%edi
+  800bca:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bcd:	89 c8                	mov    %ecx,%eax
+  800bcf:	5b                   	pop    %ebx
+  800bd0:	5e                   	pop    %esi
+  800bd1:	5f                   	pop    %edi
+  800bd2:	5d                   	pop    %ebp
+  800bd3:	c3                   	ret
+
+00800bd4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bd4:	55                   	push   %ebp
+  800bd5:	89 e5                	mov    %esp,%ebp
+  800bd7:	57                   	push   %edi
+  800bd8:	56                   	push   %esi
+  800bd9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be5:	89 c3                	mov    %eax,%ebx
+  800be7:	89 c7                	mov    %eax,%edi
+  800be9:	89 c6                	mov    %eax,%esi
+  800beb:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bed:	5b                   	pop    %ebx
+  800bee:	5e                   	pop    %esi
+  800bef:	5f                   	pop    %edi
+  800bf0:	5d                   	pop    %ebp
+  800bf1:	c3                   	ret
+
+00800bf2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	57                   	push   %edi
+  800bf6:	56                   	push   %esi
+  800bf7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c02:	89 d1                	mov    %edx,%ecx
+  800c04:	89 d3                	mov    %edx,%ebx
+  800c06:	89 d7                	mov    %edx,%edi
+  800c08:	89 d6                	mov    %edx,%esi
+  800c0a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c0c:	5b                   	pop    %ebx
+  800c0d:	5e                   	pop    %esi
+  800c0e:	5f                   	pop    %edi
+  800c0f:	5d                   	pop    %ebp
+  800c10:	c3                   	ret
+
+00800c11 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	57                   	push   %edi
+  800c15:	56                   	push   %esi
+  800c16:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c24:	89 cb                	mov    %ecx,%ebx
+  800c26:	89 cf                	mov    %ecx,%edi
+  800c28:	89 ce                	mov    %ecx,%esi
+  800c2a:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800c2c:	5b                   	pop    %ebx
+  800c2d:	5e                   	pop    %esi
+  800c2e:	5f                   	pop    %edi
+  800c2f:	5d                   	pop    %ebp
+  800c30:	c3                   	ret
+
+00800c31 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c31:	55                   	push   %ebp
+  800c32:	89 e5                	mov    %esp,%ebp
+  800c34:	57                   	push   %edi
+  800c35:	56                   	push   %esi
+  800c36:	53                   	push   %ebx
+  800c37:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c42:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c47:	89 cb                	mov    %ecx,%ebx
+  800c49:	89 cf                	mov    %ecx,%edi
+  800c4b:	89 ce                	mov    %ecx,%esi
+  800c4d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c4f:	85 c0                	test   %eax,%eax
+  800c51:	7f 08                	jg     800c5b <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c56:	5b                   	pop    %ebx
+  800c57:	5e                   	pop    %esi
+  800c58:	5f                   	pop    %edi
+  800c59:	5d                   	pop    %ebp
+  800c5a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c5b:	83 ec 0c             	sub    $0xc,%esp
+  800c5e:	50                   	push   %eax
+  800c5f:	6a 03                	push   $0x3
+  800c61:	68 3f 2c 80 00       	push   $0x802c3f
+  800c66:	6a 23                	push   $0x23
+  800c68:	68 5c 2c 80 00       	push   $0x802c5c
+  800c6d:	e8 69 f5 ff ff       	call   8001db <_panic>
+
+00800c72 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c72:	55                   	push   %ebp
+  800c73:	89 e5                	mov    %esp,%ebp
+  800c75:	57                   	push   %edi
+  800c76:	56                   	push   %esi
+  800c77:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c82:	89 d1                	mov    %edx,%ecx
+  800c84:	89 d3                	mov    %edx,%ebx
+  800c86:	89 d7                	mov    %edx,%edi
+  800c88:	89 d6                	mov    %edx,%esi
+  800c8a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c8c:	5b                   	pop    %ebx
+  800c8d:	5e                   	pop    %esi
+  800c8e:	5f                   	pop    %edi
+  800c8f:	5d                   	pop    %ebp
+  800c90:	c3                   	ret
+
+00800c91 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c91:	55                   	push   %ebp
+  800c92:	89 e5                	mov    %esp,%ebp
+  800c94:	57                   	push   %edi
+  800c95:	56                   	push   %esi
+  800c96:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800ca1:	89 d1                	mov    %edx,%ecx
+  800ca3:	89 d3                	mov    %edx,%ebx
+  800ca5:	89 d7                	mov    %edx,%edi
+  800ca7:	89 d6                	mov    %edx,%esi
+  800ca9:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cab:	5b                   	pop    %ebx
+  800cac:	5e                   	pop    %esi
+  800cad:	5f                   	pop    %edi
+  800cae:	5d                   	pop    %ebp
+  800caf:	c3                   	ret
+
+00800cb0 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800cb0:	55                   	push   %ebp
+  800cb1:	89 e5                	mov    %esp,%ebp
+  800cb3:	57                   	push   %edi
+  800cb4:	56                   	push   %esi
+  800cb5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cbb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800cc0:	89 d1                	mov    %edx,%ecx
+  800cc2:	89 d3                	mov    %edx,%ebx
+  800cc4:	89 d7                	mov    %edx,%edi
+  800cc6:	89 d6                	mov    %edx,%esi
+  800cc8:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800cca:	5b                   	pop    %ebx
+  800ccb:	5e                   	pop    %esi
+  800ccc:	5f                   	pop    %edi
+  800ccd:	5d                   	pop    %ebp
+  800cce:	c3                   	ret
+
+00800ccf <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	57                   	push   %edi
+  800cd3:	56                   	push   %esi
+  800cd4:	53                   	push   %ebx
+  800cd5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce3:	b8 15 00 00 00       	mov    $0x15,%eax
+  800ce8:	89 df                	mov    %ebx,%edi
+  800cea:	89 de                	mov    %ebx,%esi
+  800cec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cee:	85 c0                	test   %eax,%eax
+  800cf0:	7f 08                	jg     800cfa <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800cf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf5:	5b                   	pop    %ebx
+  800cf6:	5e                   	pop    %esi
+  800cf7:	5f                   	pop    %edi
+  800cf8:	5d                   	pop    %ebp
+  800cf9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cfa:	83 ec 0c             	sub    $0xc,%esp
+  800cfd:	50                   	push   %eax
+  800cfe:	6a 15                	push   $0x15
+  800d00:	68 3f 2c 80 00       	push   $0x802c3f
+  800d05:	6a 23                	push   $0x23
+  800d07:	68 5c 2c 80 00       	push   $0x802c5c
+  800d0c:	e8 ca f4 ff ff       	call   8001db <_panic>
+
+00800d11 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	57                   	push   %edi
+  800d15:	56                   	push   %esi
+  800d16:	53                   	push   %ebx
+  800d17:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d1a:	be 00 00 00 00       	mov    $0x0,%esi
+  800d1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d25:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d2d:	89 f7                	mov    %esi,%edi
+  800d2f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d31:	85 c0                	test   %eax,%eax
+  800d33:	7f 08                	jg     800d3d <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d38:	5b                   	pop    %ebx
+  800d39:	5e                   	pop    %esi
+  800d3a:	5f                   	pop    %edi
+  800d3b:	5d                   	pop    %ebp
+  800d3c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d3d:	83 ec 0c             	sub    $0xc,%esp
+  800d40:	50                   	push   %eax
+  800d41:	6a 05                	push   $0x5
+  800d43:	68 3f 2c 80 00       	push   $0x802c3f
+  800d48:	6a 23                	push   $0x23
+  800d4a:	68 5c 2c 80 00       	push   $0x802c5c
+  800d4f:	e8 87 f4 ff ff       	call   8001db <_panic>
+
+00800d54 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800d54:	55                   	push   %ebp
+  800d55:	89 e5                	mov    %esp,%ebp
+  800d57:	57                   	push   %edi
+  800d58:	56                   	push   %esi
+  800d59:	53                   	push   %ebx
+  800d5a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d5d:	be 00 00 00 00       	mov    $0x0,%esi
+  800d62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d68:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d70:	89 f7                	mov    %esi,%edi
+  800d72:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d74:	85 c0                	test   %eax,%eax
+  800d76:	7f 08                	jg     800d80 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d7b:	5b                   	pop    %ebx
+  800d7c:	5e                   	pop    %esi
+  800d7d:	5f                   	pop    %edi
+  800d7e:	5d                   	pop    %ebp
+  800d7f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d80:	83 ec 0c             	sub    $0xc,%esp
+  800d83:	50                   	push   %eax
+  800d84:	6a 06                	push   $0x6
+  800d86:	68 3f 2c 80 00       	push   $0x802c3f
+  800d8b:	6a 23                	push   $0x23
+  800d8d:	68 5c 2c 80 00       	push   $0x802c5c
+  800d92:	e8 44 f4 ff ff       	call   8001db <_panic>
+
+00800d97 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d97:	55                   	push   %ebp
+  800d98:	89 e5                	mov    %esp,%ebp
+  800d9a:	57                   	push   %edi
+  800d9b:	56                   	push   %esi
+  800d9c:	53                   	push   %ebx
+  800d9d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800da0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da6:	b8 07 00 00 00       	mov    $0x7,%eax
+  800dab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800db4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800db6:	85 c0                	test   %eax,%eax
+  800db8:	7f 08                	jg     800dc2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbd:	5b                   	pop    %ebx
+  800dbe:	5e                   	pop    %esi
+  800dbf:	5f                   	pop    %edi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc2:	83 ec 0c             	sub    $0xc,%esp
+  800dc5:	50                   	push   %eax
+  800dc6:	6a 07                	push   $0x7
+  800dc8:	68 3f 2c 80 00       	push   $0x802c3f
+  800dcd:	6a 23                	push   $0x23
+  800dcf:	68 5c 2c 80 00       	push   $0x802c5c
+  800dd4:	e8 02 f4 ff ff       	call   8001db <_panic>
+
+00800dd9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dd9:	55                   	push   %ebp
+  800dda:	89 e5                	mov    %esp,%ebp
+  800ddc:	57                   	push   %edi
+  800ddd:	56                   	push   %esi
+  800dde:	53                   	push   %ebx
+  800ddf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800de2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ded:	b8 08 00 00 00       	mov    $0x8,%eax
+  800df2:	89 df                	mov    %ebx,%edi
+  800df4:	89 de                	mov    %ebx,%esi
+  800df6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800df8:	85 c0                	test   %eax,%eax
+  800dfa:	7f 08                	jg     800e04 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dff:	5b                   	pop    %ebx
+  800e00:	5e                   	pop    %esi
+  800e01:	5f                   	pop    %edi
+  800e02:	5d                   	pop    %ebp
+  800e03:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e04:	83 ec 0c             	sub    $0xc,%esp
+  800e07:	50                   	push   %eax
+  800e08:	6a 08                	push   $0x8
+  800e0a:	68 3f 2c 80 00       	push   $0x802c3f
+  800e0f:	6a 23                	push   $0x23
+  800e11:	68 5c 2c 80 00       	push   $0x802c5c
+  800e16:	e8 c0 f3 ff ff       	call   8001db <_panic>
+
+00800e1b <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e1b:	55                   	push   %ebp
+  800e1c:	89 e5                	mov    %esp,%ebp
+  800e1e:	57                   	push   %edi
+  800e1f:	56                   	push   %esi
+  800e20:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e27:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e2c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e34:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e37:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e39:	5b                   	pop    %ebx
+  800e3a:	5e                   	pop    %esi
+  800e3b:	5f                   	pop    %edi
+  800e3c:	5d                   	pop    %ebp
+  800e3d:	c3                   	ret
+
+00800e3e <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	57                   	push   %edi
+  800e42:	56                   	push   %esi
+  800e43:	53                   	push   %ebx
+  800e44:	8b 45 18             	mov    0x18(%ebp),%eax
+  800e47:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800e4a:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800e4f:	77 27                	ja     800e78 <sys_page_map_range+0x3a>
+  800e51:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800e57:	77 1f                	ja     800e78 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800e59:	c1 e0 0c             	shl    $0xc,%eax
+  800e5c:	89 c6                	mov    %eax,%esi
+  800e5e:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800e60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e66:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e71:	cd 30                	int    $0x30
+}
+  800e73:	5b                   	pop    %ebx
+  800e74:	5e                   	pop    %esi
+  800e75:	5f                   	pop    %edi
+  800e76:	5d                   	pop    %ebp
+  800e77:	c3                   	ret
+		return -E_INVAL;
+  800e78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e7d:	eb f4                	jmp    800e73 <sys_page_map_range+0x35>
+
+00800e7f <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	57                   	push   %edi
+  800e83:	56                   	push   %esi
+  800e84:	53                   	push   %ebx
+  800e85:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e93:	be 00 00 00 00       	mov    $0x0,%esi
+  800e98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e9e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea0:	85 c0                	test   %eax,%eax
+  800ea2:	7f 08                	jg     800eac <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800ea4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea7:	5b                   	pop    %ebx
+  800ea8:	5e                   	pop    %esi
+  800ea9:	5f                   	pop    %edi
+  800eaa:	5d                   	pop    %ebp
+  800eab:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eac:	83 ec 0c             	sub    $0xc,%esp
+  800eaf:	50                   	push   %eax
+  800eb0:	6a 0c                	push   $0xc
+  800eb2:	68 3f 2c 80 00       	push   $0x802c3f
+  800eb7:	6a 23                	push   $0x23
+  800eb9:	68 5c 2c 80 00       	push   $0x802c5c
+  800ebe:	e8 18 f3 ff ff       	call   8001db <_panic>
+
+00800ec3 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800ec3:	55                   	push   %ebp
+  800ec4:	89 e5                	mov    %esp,%ebp
+  800ec6:	57                   	push   %edi
+  800ec7:	56                   	push   %esi
+  800ec8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ec9:	be 00 00 00 00       	mov    $0x0,%esi
+  800ece:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ed9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800edc:	89 f7                	mov    %esi,%edi
+  800ede:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ee0:	5b                   	pop    %ebx
+  800ee1:	5e                   	pop    %esi
+  800ee2:	5f                   	pop    %edi
+  800ee3:	5d                   	pop    %ebp
+  800ee4:	c3                   	ret
+
+00800ee5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ee5:	55                   	push   %ebp
+  800ee6:	89 e5                	mov    %esp,%ebp
+  800ee8:	57                   	push   %edi
+  800ee9:	56                   	push   %esi
+  800eea:	53                   	push   %ebx
+  800eeb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800efe:	89 df                	mov    %ebx,%edi
+  800f00:	89 de                	mov    %ebx,%esi
+  800f02:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f04:	85 c0                	test   %eax,%eax
+  800f06:	7f 08                	jg     800f10 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0b:	5b                   	pop    %ebx
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5f                   	pop    %edi
+  800f0e:	5d                   	pop    %ebp
+  800f0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f10:	83 ec 0c             	sub    $0xc,%esp
+  800f13:	50                   	push   %eax
+  800f14:	6a 0f                	push   $0xf
+  800f16:	68 3f 2c 80 00       	push   $0x802c3f
+  800f1b:	6a 23                	push   $0x23
+  800f1d:	68 5c 2c 80 00       	push   $0x802c5c
+  800f22:	e8 b4 f2 ff ff       	call   8001db <_panic>
+
+00800f27 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	57                   	push   %edi
+  800f2b:	56                   	push   %esi
+  800f2c:	53                   	push   %ebx
+  800f2d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f40:	89 df                	mov    %ebx,%edi
+  800f42:	89 de                	mov    %ebx,%esi
+  800f44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f46:	85 c0                	test   %eax,%eax
+  800f48:	7f 08                	jg     800f52 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800f4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+  800f55:	50                   	push   %eax
+  800f56:	6a 10                	push   $0x10
+  800f58:	68 3f 2c 80 00       	push   $0x802c3f
+  800f5d:	6a 23                	push   $0x23
+  800f5f:	68 5c 2c 80 00       	push   $0x802c5c
+  800f64:	e8 72 f2 ff ff       	call   8001db <_panic>
+
+00800f69 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	57                   	push   %edi
+  800f6d:	56                   	push   %esi
+  800f6e:	53                   	push   %ebx
+  800f6f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f82:	89 df                	mov    %ebx,%edi
+  800f84:	89 de                	mov    %ebx,%esi
+  800f86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f88:	85 c0                	test   %eax,%eax
+  800f8a:	7f 08                	jg     800f94 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800f8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8f:	5b                   	pop    %ebx
+  800f90:	5e                   	pop    %esi
+  800f91:	5f                   	pop    %edi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f94:	83 ec 0c             	sub    $0xc,%esp
+  800f97:	50                   	push   %eax
+  800f98:	6a 11                	push   $0x11
+  800f9a:	68 3f 2c 80 00       	push   $0x802c3f
+  800f9f:	6a 23                	push   $0x23
+  800fa1:	68 5c 2c 80 00       	push   $0x802c5c
+  800fa6:	e8 30 f2 ff ff       	call   8001db <_panic>
+
+00800fab <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800fab:	55                   	push   %ebp
+  800fac:	89 e5                	mov    %esp,%ebp
+  800fae:	57                   	push   %edi
+  800faf:	56                   	push   %esi
+  800fb0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb6:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fbb:	89 d1                	mov    %edx,%ecx
+  800fbd:	89 d3                	mov    %edx,%ebx
+  800fbf:	89 d7                	mov    %edx,%edi
+  800fc1:	89 d6                	mov    %edx,%esi
+  800fc3:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800fc5:	5b                   	pop    %ebx
+  800fc6:	5e                   	pop    %esi
+  800fc7:	5f                   	pop    %edi
+  800fc8:	5d                   	pop    %ebp
+  800fc9:	c3                   	ret
+
+00800fca <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fca:	55                   	push   %ebp
+  800fcb:	89 e5                	mov    %esp,%ebp
+  800fcd:	57                   	push   %edi
+  800fce:	56                   	push   %esi
+  800fcf:	53                   	push   %ebx
+  800fd0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fde:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fe3:	89 df                	mov    %ebx,%edi
+  800fe5:	89 de                	mov    %ebx,%esi
+  800fe7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe9:	85 c0                	test   %eax,%eax
+  800feb:	7f 08                	jg     800ff5 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5f                   	pop    %edi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff5:	83 ec 0c             	sub    $0xc,%esp
+  800ff8:	50                   	push   %eax
+  800ff9:	6a 13                	push   $0x13
+  800ffb:	68 3f 2c 80 00       	push   $0x802c3f
+  801000:	6a 23                	push   $0x23
+  801002:	68 5c 2c 80 00       	push   $0x802c5c
+  801007:	e8 cf f1 ff ff       	call   8001db <_panic>
+
+0080100c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	57                   	push   %edi
+  801010:	56                   	push   %esi
+  801011:	53                   	push   %ebx
+  801012:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801015:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801020:	b8 14 00 00 00       	mov    $0x14,%eax
+  801025:	89 df                	mov    %ebx,%edi
+  801027:	89 de                	mov    %ebx,%esi
+  801029:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80102b:	85 c0                	test   %eax,%eax
+  80102d:	7f 08                	jg     801037 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80102f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801032:	5b                   	pop    %ebx
+  801033:	5e                   	pop    %esi
+  801034:	5f                   	pop    %edi
+  801035:	5d                   	pop    %ebp
+  801036:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801037:	83 ec 0c             	sub    $0xc,%esp
+  80103a:	50                   	push   %eax
+  80103b:	6a 14                	push   $0x14
+  80103d:	68 3f 2c 80 00       	push   $0x802c3f
+  801042:	6a 23                	push   $0x23
+  801044:	68 5c 2c 80 00       	push   $0x802c5c
+  801049:	e8 8d f1 ff ff       	call   8001db <_panic>
+
+0080104e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80104e:	55                   	push   %ebp
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	57                   	push   %edi
+  801052:	56                   	push   %esi
+  801053:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801054:	8b 55 08             	mov    0x8(%ebp),%edx
+  801057:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80105f:	be 00 00 00 00       	mov    $0x0,%esi
+  801064:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801067:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80106a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80106c:	5b                   	pop    %ebx
+  80106d:	5e                   	pop    %esi
+  80106e:	5f                   	pop    %edi
+  80106f:	5d                   	pop    %ebp
+  801070:	c3                   	ret
+
+00801071 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801071:	55                   	push   %ebp
+  801072:	89 e5                	mov    %esp,%ebp
+  801074:	57                   	push   %edi
+  801075:	56                   	push   %esi
+  801076:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801077:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801082:	be 00 00 00 00       	mov    $0x0,%esi
+  801087:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80108a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80108d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80108f:	5b                   	pop    %ebx
+  801090:	5e                   	pop    %esi
+  801091:	5f                   	pop    %edi
+  801092:	5d                   	pop    %ebp
+  801093:	c3                   	ret
+
+00801094 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	57                   	push   %edi
+  801098:	56                   	push   %esi
+  801099:	53                   	push   %ebx
+  80109a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80109d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010aa:	89 cb                	mov    %ecx,%ebx
+  8010ac:	89 cf                	mov    %ecx,%edi
+  8010ae:	89 ce                	mov    %ecx,%esi
+  8010b0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010b2:	85 c0                	test   %eax,%eax
+  8010b4:	7f 08                	jg     8010be <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8010b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b9:	5b                   	pop    %ebx
+  8010ba:	5e                   	pop    %esi
+  8010bb:	5f                   	pop    %edi
+  8010bc:	5d                   	pop    %ebp
+  8010bd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010be:	83 ec 0c             	sub    $0xc,%esp
+  8010c1:	50                   	push   %eax
+  8010c2:	6a 19                	push   $0x19
+  8010c4:	68 3f 2c 80 00       	push   $0x802c3f
+  8010c9:	6a 23                	push   $0x23
+  8010cb:	68 5c 2c 80 00       	push   $0x802c5c
+  8010d0:	e8 06 f1 ff ff       	call   8001db <_panic>
+
+008010d5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010d5:	55                   	push   %ebp
+  8010d6:	89 e5                	mov    %esp,%ebp
+  8010d8:	57                   	push   %edi
+  8010d9:	56                   	push   %esi
+  8010da:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010e5:	89 d1                	mov    %edx,%ecx
+  8010e7:	89 d3                	mov    %edx,%ebx
+  8010e9:	89 d7                	mov    %edx,%edi
+  8010eb:	89 d6                	mov    %edx,%esi
+  8010ed:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010ef:	5b                   	pop    %ebx
+  8010f0:	5e                   	pop    %esi
+  8010f1:	5f                   	pop    %edi
+  8010f2:	5d                   	pop    %ebp
+  8010f3:	c3                   	ret
+
+008010f4 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8010f4:	55                   	push   %ebp
+  8010f5:	89 e5                	mov    %esp,%ebp
+  8010f7:	57                   	push   %edi
+  8010f8:	56                   	push   %esi
+  8010f9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801102:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801105:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80110a:	89 df                	mov    %ebx,%edi
+  80110c:	89 de                	mov    %ebx,%esi
+  80110e:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801110:	5b                   	pop    %ebx
+  801111:	5e                   	pop    %esi
+  801112:	5f                   	pop    %edi
+  801113:	5d                   	pop    %ebp
+  801114:	c3                   	ret
+
+00801115 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801115:	55                   	push   %ebp
+  801116:	89 e5                	mov    %esp,%ebp
+  801118:	57                   	push   %edi
+  801119:	56                   	push   %esi
+  80111a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80111b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801120:	8b 55 08             	mov    0x8(%ebp),%edx
+  801123:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801126:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80112b:	89 df                	mov    %ebx,%edi
+  80112d:	89 de                	mov    %ebx,%esi
+  80112f:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801131:	5b                   	pop    %ebx
+  801132:	5e                   	pop    %esi
+  801133:	5f                   	pop    %edi
+  801134:	5d                   	pop    %ebp
+  801135:	c3                   	ret
+
+00801136 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801136:	55                   	push   %ebp
+  801137:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801139:	8b 45 08             	mov    0x8(%ebp),%eax
+  80113c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801141:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+
+00801146 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801149:	8b 45 08             	mov    0x8(%ebp),%eax
+  80114c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801151:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801156:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80115b:	5d                   	pop    %ebp
+  80115c:	c3                   	ret
+
+0080115d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801160:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801165:	eb 02                	jmp    801169 <fd_alloc+0xc>
+  801167:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801169:	89 c2                	mov    %eax,%edx
+  80116b:	c1 ea 16             	shr    $0x16,%edx
+  80116e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801175:	f6 c2 01             	test   $0x1,%dl
+  801178:	74 2b                	je     8011a5 <fd_alloc+0x48>
+  80117a:	89 c2                	mov    %eax,%edx
+  80117c:	c1 ea 0c             	shr    $0xc,%edx
+  80117f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801186:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80118c:	f6 c1 01             	test   $0x1,%cl
+  80118f:	74 14                	je     8011a5 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801191:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801197:	75 ce                	jne    801167 <fd_alloc+0xa>
+  801199:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80119e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011a3:	eb 05                	jmp    8011aa <fd_alloc+0x4d>
+			return 0;
+  8011a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ad:	89 02                	mov    %eax,(%edx)
+}
+  8011af:	89 c8                	mov    %ecx,%eax
+  8011b1:	5d                   	pop    %ebp
+  8011b2:	c3                   	ret
+
+008011b3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011b3:	55                   	push   %ebp
+  8011b4:	89 e5                	mov    %esp,%ebp
+  8011b6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011b9:	83 f8 1f             	cmp    $0x1f,%eax
+  8011bc:	77 30                	ja     8011ee <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011be:	c1 e0 0c             	shl    $0xc,%eax
+  8011c1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011c6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011cc:	f6 c2 01             	test   $0x1,%dl
+  8011cf:	74 24                	je     8011f5 <fd_lookup+0x42>
+  8011d1:	89 c2                	mov    %eax,%edx
+  8011d3:	c1 ea 0c             	shr    $0xc,%edx
+  8011d6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011dd:	f6 c2 01             	test   $0x1,%dl
+  8011e0:	74 1a                	je     8011fc <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011e5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ec:	5d                   	pop    %ebp
+  8011ed:	c3                   	ret
+		return -E_INVAL;
+  8011ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011f3:	eb f7                	jmp    8011ec <fd_lookup+0x39>
+		return -E_INVAL;
+  8011f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011fa:	eb f0                	jmp    8011ec <fd_lookup+0x39>
+  8011fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801201:	eb e9                	jmp    8011ec <fd_lookup+0x39>
+
+00801203 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801203:	55                   	push   %ebp
+  801204:	89 e5                	mov    %esp,%ebp
+  801206:	53                   	push   %ebx
+  801207:	83 ec 04             	sub    $0x4,%esp
+  80120a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80120d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801212:	eb 03                	jmp    801217 <dev_lookup+0x14>
+  801214:	83 c0 01             	add    $0x1,%eax
+  801217:	8b 1c 85 e8 2c 80 00 	mov    0x802ce8(,%eax,4),%ebx
+  80121e:	85 db                	test   %ebx,%ebx
+  801220:	74 0b                	je     80122d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801222:	39 13                	cmp    %edx,(%ebx)
+  801224:	75 ee                	jne    801214 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801226:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122b:	eb 1f                	jmp    80124c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80122d:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801232:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801235:	83 ec 04             	sub    $0x4,%esp
+  801238:	52                   	push   %edx
+  801239:	50                   	push   %eax
+  80123a:	68 6c 2c 80 00       	push   $0x802c6c
+  80123f:	e8 72 f0 ff ff       	call   8002b6 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801244:	83 c4 10             	add    $0x10,%esp
+  801247:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80124c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80124f:	89 1a                	mov    %ebx,(%edx)
+}
+  801251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801254:	c9                   	leave
+  801255:	c3                   	ret
+
+00801256 <fd_close>:
+{
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+  801259:	57                   	push   %edi
+  80125a:	56                   	push   %esi
+  80125b:	53                   	push   %ebx
+  80125c:	83 ec 24             	sub    $0x24,%esp
+  80125f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801262:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801265:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801268:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801269:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80126f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801272:	50                   	push   %eax
+  801273:	e8 3b ff ff ff       	call   8011b3 <fd_lookup>
+  801278:	89 c3                	mov    %eax,%ebx
+  80127a:	83 c4 10             	add    $0x10,%esp
+  80127d:	85 c0                	test   %eax,%eax
+  80127f:	78 05                	js     801286 <fd_close+0x30>
+	    || fd != fd2)
+  801281:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801284:	74 16                	je     80129c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801286:	89 f8                	mov    %edi,%eax
+  801288:	84 c0                	test   %al,%al
+  80128a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80128f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801292:	89 d8                	mov    %ebx,%eax
+  801294:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801297:	5b                   	pop    %ebx
+  801298:	5e                   	pop    %esi
+  801299:	5f                   	pop    %edi
+  80129a:	5d                   	pop    %ebp
+  80129b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80129c:	83 ec 08             	sub    $0x8,%esp
+  80129f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012a2:	50                   	push   %eax
+  8012a3:	ff 36                	push   (%esi)
+  8012a5:	e8 59 ff ff ff       	call   801203 <dev_lookup>
+  8012aa:	89 c3                	mov    %eax,%ebx
+  8012ac:	83 c4 10             	add    $0x10,%esp
+  8012af:	85 c0                	test   %eax,%eax
+  8012b1:	78 1a                	js     8012cd <fd_close+0x77>
+		if (dev->dev_close)
+  8012b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012b6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012be:	85 c0                	test   %eax,%eax
+  8012c0:	74 0b                	je     8012cd <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8012c2:	83 ec 0c             	sub    $0xc,%esp
+  8012c5:	56                   	push   %esi
+  8012c6:	ff d0                	call   *%eax
+  8012c8:	89 c3                	mov    %eax,%ebx
+  8012ca:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012cd:	83 ec 08             	sub    $0x8,%esp
+  8012d0:	56                   	push   %esi
+  8012d1:	6a 00                	push   $0x0
+  8012d3:	e8 01 fb ff ff       	call   800dd9 <sys_page_unmap>
+	return r;
+  8012d8:	83 c4 10             	add    $0x10,%esp
+  8012db:	eb b5                	jmp    801292 <fd_close+0x3c>
+
+008012dd <close>:
+
+int
+close(int fdnum)
+{
+  8012dd:	55                   	push   %ebp
+  8012de:	89 e5                	mov    %esp,%ebp
+  8012e0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012e6:	50                   	push   %eax
+  8012e7:	ff 75 08             	push   0x8(%ebp)
+  8012ea:	e8 c4 fe ff ff       	call   8011b3 <fd_lookup>
+  8012ef:	83 c4 10             	add    $0x10,%esp
+  8012f2:	85 c0                	test   %eax,%eax
+  8012f4:	79 02                	jns    8012f8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012f6:	c9                   	leave
+  8012f7:	c3                   	ret
+		return fd_close(fd, 1);
+  8012f8:	83 ec 08             	sub    $0x8,%esp
+  8012fb:	6a 01                	push   $0x1
+  8012fd:	ff 75 f4             	push   -0xc(%ebp)
+  801300:	e8 51 ff ff ff       	call   801256 <fd_close>
+  801305:	83 c4 10             	add    $0x10,%esp
+  801308:	eb ec                	jmp    8012f6 <close+0x19>
+
+0080130a <close_all>:
+
+void
+close_all(void)
+{
+  80130a:	55                   	push   %ebp
+  80130b:	89 e5                	mov    %esp,%ebp
+  80130d:	53                   	push   %ebx
+  80130e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801311:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801316:	83 ec 0c             	sub    $0xc,%esp
+  801319:	53                   	push   %ebx
+  80131a:	e8 be ff ff ff       	call   8012dd <close>
+	for (i = 0; i < MAXFD; i++)
+  80131f:	83 c3 01             	add    $0x1,%ebx
+  801322:	83 c4 10             	add    $0x10,%esp
+  801325:	83 fb 20             	cmp    $0x20,%ebx
+  801328:	75 ec                	jne    801316 <close_all+0xc>
+}
+  80132a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80132d:	c9                   	leave
+  80132e:	c3                   	ret
+
+0080132f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80132f:	55                   	push   %ebp
+  801330:	89 e5                	mov    %esp,%ebp
+  801332:	57                   	push   %edi
+  801333:	56                   	push   %esi
+  801334:	53                   	push   %ebx
+  801335:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801338:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80133b:	50                   	push   %eax
+  80133c:	ff 75 08             	push   0x8(%ebp)
+  80133f:	e8 6f fe ff ff       	call   8011b3 <fd_lookup>
+  801344:	89 c3                	mov    %eax,%ebx
+  801346:	83 c4 10             	add    $0x10,%esp
+  801349:	85 c0                	test   %eax,%eax
+  80134b:	78 7f                	js     8013cc <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80134d:	83 ec 0c             	sub    $0xc,%esp
+  801350:	ff 75 0c             	push   0xc(%ebp)
+  801353:	e8 85 ff ff ff       	call   8012dd <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801358:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80135b:	c1 e6 0c             	shl    $0xc,%esi
+  80135e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801364:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801367:	89 3c 24             	mov    %edi,(%esp)
+  80136a:	e8 d7 fd ff ff       	call   801146 <fd2data>
+  80136f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801371:	89 34 24             	mov    %esi,(%esp)
+  801374:	e8 cd fd ff ff       	call   801146 <fd2data>
+  801379:	83 c4 10             	add    $0x10,%esp
+  80137c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80137f:	89 d8                	mov    %ebx,%eax
+  801381:	c1 e8 16             	shr    $0x16,%eax
+  801384:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80138b:	a8 01                	test   $0x1,%al
+  80138d:	74 11                	je     8013a0 <dup+0x71>
+  80138f:	89 d8                	mov    %ebx,%eax
+  801391:	c1 e8 0c             	shr    $0xc,%eax
+  801394:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80139b:	f6 c2 01             	test   $0x1,%dl
+  80139e:	75 36                	jne    8013d6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013a0:	89 f8                	mov    %edi,%eax
+  8013a2:	c1 e8 0c             	shr    $0xc,%eax
+  8013a5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013ac:	83 ec 0c             	sub    $0xc,%esp
+  8013af:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013b4:	50                   	push   %eax
+  8013b5:	56                   	push   %esi
+  8013b6:	6a 00                	push   $0x0
+  8013b8:	57                   	push   %edi
+  8013b9:	6a 00                	push   $0x0
+  8013bb:	e8 d7 f9 ff ff       	call   800d97 <sys_page_map>
+  8013c0:	89 c3                	mov    %eax,%ebx
+  8013c2:	83 c4 20             	add    $0x20,%esp
+  8013c5:	85 c0                	test   %eax,%eax
+  8013c7:	78 33                	js     8013fc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013cc:	89 d8                	mov    %ebx,%eax
+  8013ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d1:	5b                   	pop    %ebx
+  8013d2:	5e                   	pop    %esi
+  8013d3:	5f                   	pop    %edi
+  8013d4:	5d                   	pop    %ebp
+  8013d5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013d6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013dd:	83 ec 0c             	sub    $0xc,%esp
+  8013e0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013e5:	50                   	push   %eax
+  8013e6:	ff 75 d4             	push   -0x2c(%ebp)
+  8013e9:	6a 00                	push   $0x0
+  8013eb:	53                   	push   %ebx
+  8013ec:	6a 00                	push   $0x0
+  8013ee:	e8 a4 f9 ff ff       	call   800d97 <sys_page_map>
+  8013f3:	89 c3                	mov    %eax,%ebx
+  8013f5:	83 c4 20             	add    $0x20,%esp
+  8013f8:	85 c0                	test   %eax,%eax
+  8013fa:	79 a4                	jns    8013a0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013fc:	83 ec 08             	sub    $0x8,%esp
+  8013ff:	56                   	push   %esi
+  801400:	6a 00                	push   $0x0
+  801402:	e8 d2 f9 ff ff       	call   800dd9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801407:	83 c4 08             	add    $0x8,%esp
+  80140a:	ff 75 d4             	push   -0x2c(%ebp)
+  80140d:	6a 00                	push   $0x0
+  80140f:	e8 c5 f9 ff ff       	call   800dd9 <sys_page_unmap>
+	return r;
+  801414:	83 c4 10             	add    $0x10,%esp
+  801417:	eb b3                	jmp    8013cc <dup+0x9d>
+
+00801419 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	56                   	push   %esi
+  80141d:	53                   	push   %ebx
+  80141e:	83 ec 18             	sub    $0x18,%esp
+  801421:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801424:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801427:	50                   	push   %eax
+  801428:	56                   	push   %esi
+  801429:	e8 85 fd ff ff       	call   8011b3 <fd_lookup>
+  80142e:	83 c4 10             	add    $0x10,%esp
+  801431:	85 c0                	test   %eax,%eax
+  801433:	78 3c                	js     801471 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801435:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801438:	83 ec 08             	sub    $0x8,%esp
+  80143b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80143e:	50                   	push   %eax
+  80143f:	ff 33                	push   (%ebx)
+  801441:	e8 bd fd ff ff       	call   801203 <dev_lookup>
+  801446:	83 c4 10             	add    $0x10,%esp
+  801449:	85 c0                	test   %eax,%eax
+  80144b:	78 24                	js     801471 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80144d:	8b 43 08             	mov    0x8(%ebx),%eax
+  801450:	83 e0 03             	and    $0x3,%eax
+  801453:	83 f8 01             	cmp    $0x1,%eax
+  801456:	74 20                	je     801478 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80145b:	8b 40 08             	mov    0x8(%eax),%eax
+  80145e:	85 c0                	test   %eax,%eax
+  801460:	74 37                	je     801499 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801462:	83 ec 04             	sub    $0x4,%esp
+  801465:	ff 75 10             	push   0x10(%ebp)
+  801468:	ff 75 0c             	push   0xc(%ebp)
+  80146b:	53                   	push   %ebx
+  80146c:	ff d0                	call   *%eax
+  80146e:	83 c4 10             	add    $0x10,%esp
+}
+  801471:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801474:	5b                   	pop    %ebx
+  801475:	5e                   	pop    %esi
+  801476:	5d                   	pop    %ebp
+  801477:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801478:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80147d:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801480:	83 ec 04             	sub    $0x4,%esp
+  801483:	56                   	push   %esi
+  801484:	50                   	push   %eax
+  801485:	68 ad 2c 80 00       	push   $0x802cad
+  80148a:	e8 27 ee ff ff       	call   8002b6 <cprintf>
+		return -E_INVAL;
+  80148f:	83 c4 10             	add    $0x10,%esp
+  801492:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801497:	eb d8                	jmp    801471 <read+0x58>
+		return -E_NOT_SUPP;
+  801499:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80149e:	eb d1                	jmp    801471 <read+0x58>
+
+008014a0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014a0:	55                   	push   %ebp
+  8014a1:	89 e5                	mov    %esp,%ebp
+  8014a3:	57                   	push   %edi
+  8014a4:	56                   	push   %esi
+  8014a5:	53                   	push   %ebx
+  8014a6:	83 ec 0c             	sub    $0xc,%esp
+  8014a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014ac:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b4:	eb 02                	jmp    8014b8 <readn+0x18>
+  8014b6:	01 c3                	add    %eax,%ebx
+  8014b8:	39 f3                	cmp    %esi,%ebx
+  8014ba:	73 21                	jae    8014dd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014bc:	83 ec 04             	sub    $0x4,%esp
+  8014bf:	89 f0                	mov    %esi,%eax
+  8014c1:	29 d8                	sub    %ebx,%eax
+  8014c3:	50                   	push   %eax
+  8014c4:	89 d8                	mov    %ebx,%eax
+  8014c6:	03 45 0c             	add    0xc(%ebp),%eax
+  8014c9:	50                   	push   %eax
+  8014ca:	57                   	push   %edi
+  8014cb:	e8 49 ff ff ff       	call   801419 <read>
+		if (m < 0)
+  8014d0:	83 c4 10             	add    $0x10,%esp
+  8014d3:	85 c0                	test   %eax,%eax
+  8014d5:	78 04                	js     8014db <readn+0x3b>
+			return m;
+		if (m == 0)
+  8014d7:	75 dd                	jne    8014b6 <readn+0x16>
+  8014d9:	eb 02                	jmp    8014dd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014db:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8014dd:	89 d8                	mov    %ebx,%eax
+  8014df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e2:	5b                   	pop    %ebx
+  8014e3:	5e                   	pop    %esi
+  8014e4:	5f                   	pop    %edi
+  8014e5:	5d                   	pop    %ebp
+  8014e6:	c3                   	ret
+
+008014e7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014e7:	55                   	push   %ebp
+  8014e8:	89 e5                	mov    %esp,%ebp
+  8014ea:	56                   	push   %esi
+  8014eb:	53                   	push   %ebx
+  8014ec:	83 ec 18             	sub    $0x18,%esp
+  8014ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014f2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014f5:	50                   	push   %eax
+  8014f6:	53                   	push   %ebx
+  8014f7:	e8 b7 fc ff ff       	call   8011b3 <fd_lookup>
+  8014fc:	83 c4 10             	add    $0x10,%esp
+  8014ff:	85 c0                	test   %eax,%eax
+  801501:	78 37                	js     80153a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801503:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801506:	83 ec 08             	sub    $0x8,%esp
+  801509:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80150c:	50                   	push   %eax
+  80150d:	ff 36                	push   (%esi)
+  80150f:	e8 ef fc ff ff       	call   801203 <dev_lookup>
+  801514:	83 c4 10             	add    $0x10,%esp
+  801517:	85 c0                	test   %eax,%eax
+  801519:	78 1f                	js     80153a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80151b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80151f:	74 20                	je     801541 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801521:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801524:	8b 40 0c             	mov    0xc(%eax),%eax
+  801527:	85 c0                	test   %eax,%eax
+  801529:	74 37                	je     801562 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80152b:	83 ec 04             	sub    $0x4,%esp
+  80152e:	ff 75 10             	push   0x10(%ebp)
+  801531:	ff 75 0c             	push   0xc(%ebp)
+  801534:	56                   	push   %esi
+  801535:	ff d0                	call   *%eax
+  801537:	83 c4 10             	add    $0x10,%esp
+}
+  80153a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80153d:	5b                   	pop    %ebx
+  80153e:	5e                   	pop    %esi
+  80153f:	5d                   	pop    %ebp
+  801540:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801541:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801546:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801549:	83 ec 04             	sub    $0x4,%esp
+  80154c:	53                   	push   %ebx
+  80154d:	50                   	push   %eax
+  80154e:	68 c9 2c 80 00       	push   $0x802cc9
+  801553:	e8 5e ed ff ff       	call   8002b6 <cprintf>
+		return -E_INVAL;
+  801558:	83 c4 10             	add    $0x10,%esp
+  80155b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801560:	eb d8                	jmp    80153a <write+0x53>
+		return -E_NOT_SUPP;
+  801562:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801567:	eb d1                	jmp    80153a <write+0x53>
+
+00801569 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80156f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801572:	50                   	push   %eax
+  801573:	ff 75 08             	push   0x8(%ebp)
+  801576:	e8 38 fc ff ff       	call   8011b3 <fd_lookup>
+  80157b:	83 c4 10             	add    $0x10,%esp
+  80157e:	85 c0                	test   %eax,%eax
+  801580:	78 0e                	js     801590 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801582:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801585:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801588:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80158b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801590:	c9                   	leave
+  801591:	c3                   	ret
+
+00801592 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801592:	55                   	push   %ebp
+  801593:	89 e5                	mov    %esp,%ebp
+  801595:	56                   	push   %esi
+  801596:	53                   	push   %ebx
+  801597:	83 ec 18             	sub    $0x18,%esp
+  80159a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80159d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015a0:	50                   	push   %eax
+  8015a1:	53                   	push   %ebx
+  8015a2:	e8 0c fc ff ff       	call   8011b3 <fd_lookup>
+  8015a7:	83 c4 10             	add    $0x10,%esp
+  8015aa:	85 c0                	test   %eax,%eax
+  8015ac:	78 34                	js     8015e2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015ae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015b1:	83 ec 08             	sub    $0x8,%esp
+  8015b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b7:	50                   	push   %eax
+  8015b8:	ff 36                	push   (%esi)
+  8015ba:	e8 44 fc ff ff       	call   801203 <dev_lookup>
+  8015bf:	83 c4 10             	add    $0x10,%esp
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	78 1c                	js     8015e2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015c6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015ca:	74 1d                	je     8015e9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8015cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015cf:	8b 40 18             	mov    0x18(%eax),%eax
+  8015d2:	85 c0                	test   %eax,%eax
+  8015d4:	74 34                	je     80160a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8015d6:	83 ec 08             	sub    $0x8,%esp
+  8015d9:	ff 75 0c             	push   0xc(%ebp)
+  8015dc:	56                   	push   %esi
+  8015dd:	ff d0                	call   *%eax
+  8015df:	83 c4 10             	add    $0x10,%esp
+}
+  8015e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015e5:	5b                   	pop    %ebx
+  8015e6:	5e                   	pop    %esi
+  8015e7:	5d                   	pop    %ebp
+  8015e8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015e9:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8015ee:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015f1:	83 ec 04             	sub    $0x4,%esp
+  8015f4:	53                   	push   %ebx
+  8015f5:	50                   	push   %eax
+  8015f6:	68 8c 2c 80 00       	push   $0x802c8c
+  8015fb:	e8 b6 ec ff ff       	call   8002b6 <cprintf>
+		return -E_INVAL;
+  801600:	83 c4 10             	add    $0x10,%esp
+  801603:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801608:	eb d8                	jmp    8015e2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80160a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80160f:	eb d1                	jmp    8015e2 <ftruncate+0x50>
+
+00801611 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801611:	55                   	push   %ebp
+  801612:	89 e5                	mov    %esp,%ebp
+  801614:	56                   	push   %esi
+  801615:	53                   	push   %ebx
+  801616:	83 ec 18             	sub    $0x18,%esp
+  801619:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80161c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80161f:	50                   	push   %eax
+  801620:	ff 75 08             	push   0x8(%ebp)
+  801623:	e8 8b fb ff ff       	call   8011b3 <fd_lookup>
+  801628:	83 c4 10             	add    $0x10,%esp
+  80162b:	85 c0                	test   %eax,%eax
+  80162d:	78 49                	js     801678 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80162f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801632:	83 ec 08             	sub    $0x8,%esp
+  801635:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801638:	50                   	push   %eax
+  801639:	ff 36                	push   (%esi)
+  80163b:	e8 c3 fb ff ff       	call   801203 <dev_lookup>
+  801640:	83 c4 10             	add    $0x10,%esp
+  801643:	85 c0                	test   %eax,%eax
+  801645:	78 31                	js     801678 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801647:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80164a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80164e:	74 2f                	je     80167f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801650:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801653:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80165a:	00 00 00 
+	stat->st_isdir = 0;
+  80165d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801664:	00 00 00 
+	stat->st_dev = dev;
+  801667:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80166d:	83 ec 08             	sub    $0x8,%esp
+  801670:	53                   	push   %ebx
+  801671:	56                   	push   %esi
+  801672:	ff 50 14             	call   *0x14(%eax)
+  801675:	83 c4 10             	add    $0x10,%esp
+}
+  801678:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80167b:	5b                   	pop    %ebx
+  80167c:	5e                   	pop    %esi
+  80167d:	5d                   	pop    %ebp
+  80167e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80167f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801684:	eb f2                	jmp    801678 <fstat+0x67>
+
+00801686 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801686:	55                   	push   %ebp
+  801687:	89 e5                	mov    %esp,%ebp
+  801689:	56                   	push   %esi
+  80168a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80168b:	83 ec 08             	sub    $0x8,%esp
+  80168e:	6a 00                	push   $0x0
+  801690:	ff 75 08             	push   0x8(%ebp)
+  801693:	e8 e4 01 00 00       	call   80187c <open>
+  801698:	89 c3                	mov    %eax,%ebx
+  80169a:	83 c4 10             	add    $0x10,%esp
+  80169d:	85 c0                	test   %eax,%eax
+  80169f:	78 1b                	js     8016bc <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8016a1:	83 ec 08             	sub    $0x8,%esp
+  8016a4:	ff 75 0c             	push   0xc(%ebp)
+  8016a7:	50                   	push   %eax
+  8016a8:	e8 64 ff ff ff       	call   801611 <fstat>
+  8016ad:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8016af:	89 1c 24             	mov    %ebx,(%esp)
+  8016b2:	e8 26 fc ff ff       	call   8012dd <close>
+	return r;
+  8016b7:	83 c4 10             	add    $0x10,%esp
+  8016ba:	89 f3                	mov    %esi,%ebx
+}
+  8016bc:	89 d8                	mov    %ebx,%eax
+  8016be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c1:	5b                   	pop    %ebx
+  8016c2:	5e                   	pop    %esi
+  8016c3:	5d                   	pop    %ebp
+  8016c4:	c3                   	ret
+
+008016c5 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8016c5:	55                   	push   %ebp
+  8016c6:	89 e5                	mov    %esp,%ebp
+  8016c8:	56                   	push   %esi
+  8016c9:	53                   	push   %ebx
+  8016ca:	89 c6                	mov    %eax,%esi
+  8016cc:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8016ce:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016d5:	74 27                	je     8016fe <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016d7:	6a 07                	push   $0x7
+  8016d9:	68 00 50 80 00       	push   $0x805000
+  8016de:	56                   	push   %esi
+  8016df:	ff 35 04 40 80 00    	push   0x804004
+  8016e5:	e8 e9 0c 00 00       	call   8023d3 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8016ea:	83 c4 0c             	add    $0xc,%esp
+  8016ed:	6a 00                	push   $0x0
+  8016ef:	53                   	push   %ebx
+  8016f0:	6a 00                	push   $0x0
+  8016f2:	e8 64 0c 00 00       	call   80235b <ipc_recv>
+}
+  8016f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016fa:	5b                   	pop    %ebx
+  8016fb:	5e                   	pop    %esi
+  8016fc:	5d                   	pop    %ebp
+  8016fd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016fe:	83 ec 0c             	sub    $0xc,%esp
+  801701:	6a 01                	push   $0x1
+  801703:	e8 1f 0d 00 00       	call   802427 <ipc_find_env>
+  801708:	a3 04 40 80 00       	mov    %eax,0x804004
+  80170d:	83 c4 10             	add    $0x10,%esp
+  801710:	eb c5                	jmp    8016d7 <fsipc+0x12>
+
+00801712 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801712:	55                   	push   %ebp
+  801713:	89 e5                	mov    %esp,%ebp
+  801715:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801718:	8b 45 08             	mov    0x8(%ebp),%eax
+  80171b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80171e:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  801723:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801726:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80172b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801730:	b8 02 00 00 00       	mov    $0x2,%eax
+  801735:	e8 8b ff ff ff       	call   8016c5 <fsipc>
+}
+  80173a:	c9                   	leave
+  80173b:	c3                   	ret
+
+0080173c <devfile_flush>:
+{
+  80173c:	55                   	push   %ebp
+  80173d:	89 e5                	mov    %esp,%ebp
+  80173f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801742:	8b 45 08             	mov    0x8(%ebp),%eax
+  801745:	8b 40 0c             	mov    0xc(%eax),%eax
+  801748:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80174d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801752:	b8 06 00 00 00       	mov    $0x6,%eax
+  801757:	e8 69 ff ff ff       	call   8016c5 <fsipc>
+}
+  80175c:	c9                   	leave
+  80175d:	c3                   	ret
+
+0080175e <devfile_stat>:
+{
+  80175e:	55                   	push   %ebp
+  80175f:	89 e5                	mov    %esp,%ebp
+  801761:	53                   	push   %ebx
+  801762:	83 ec 04             	sub    $0x4,%esp
+  801765:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801768:	8b 45 08             	mov    0x8(%ebp),%eax
+  80176b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80176e:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801773:	ba 00 00 00 00       	mov    $0x0,%edx
+  801778:	b8 05 00 00 00       	mov    $0x5,%eax
+  80177d:	e8 43 ff ff ff       	call   8016c5 <fsipc>
+  801782:	85 c0                	test   %eax,%eax
+  801784:	78 2c                	js     8017b2 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801786:	83 ec 08             	sub    $0x8,%esp
+  801789:	68 00 50 80 00       	push   $0x805000
+  80178e:	53                   	push   %ebx
+  80178f:	e8 10 f1 ff ff       	call   8008a4 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801794:	a1 80 50 80 00       	mov    0x805080,%eax
+  801799:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80179f:	a1 84 50 80 00       	mov    0x805084,%eax
+  8017a4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8017aa:	83 c4 10             	add    $0x10,%esp
+  8017ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017b5:	c9                   	leave
+  8017b6:	c3                   	ret
+
+008017b7 <devfile_write>:
+{
+  8017b7:	55                   	push   %ebp
+  8017b8:	89 e5                	mov    %esp,%ebp
+  8017ba:	83 ec 0c             	sub    $0xc,%esp
+  8017bd:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8017c0:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8017c5:	39 d0                	cmp    %edx,%eax
+  8017c7:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8017ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cd:	8b 52 0c             	mov    0xc(%edx),%edx
+  8017d0:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  8017d6:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8017db:	50                   	push   %eax
+  8017dc:	ff 75 0c             	push   0xc(%ebp)
+  8017df:	68 08 50 80 00       	push   $0x805008
+  8017e4:	e8 41 f2 ff ff       	call   800a2a <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8017e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ee:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017f3:	e8 cd fe ff ff       	call   8016c5 <fsipc>
+}
+  8017f8:	c9                   	leave
+  8017f9:	c3                   	ret
+
+008017fa <devfile_read>:
+{
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	56                   	push   %esi
+  8017fe:	53                   	push   %ebx
+  8017ff:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801802:	8b 45 08             	mov    0x8(%ebp),%eax
+  801805:	8b 40 0c             	mov    0xc(%eax),%eax
+  801808:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  80180d:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801813:	ba 00 00 00 00       	mov    $0x0,%edx
+  801818:	b8 03 00 00 00       	mov    $0x3,%eax
+  80181d:	e8 a3 fe ff ff       	call   8016c5 <fsipc>
+  801822:	89 c3                	mov    %eax,%ebx
+  801824:	85 c0                	test   %eax,%eax
+  801826:	78 1f                	js     801847 <devfile_read+0x4d>
+	assert(r <= n);
+  801828:	39 c6                	cmp    %eax,%esi
+  80182a:	72 24                	jb     801850 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80182c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801831:	7f 33                	jg     801866 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801833:	83 ec 04             	sub    $0x4,%esp
+  801836:	50                   	push   %eax
+  801837:	68 00 50 80 00       	push   $0x805000
+  80183c:	ff 75 0c             	push   0xc(%ebp)
+  80183f:	e8 e6 f1 ff ff       	call   800a2a <memmove>
+	return r;
+  801844:	83 c4 10             	add    $0x10,%esp
+}
+  801847:	89 d8                	mov    %ebx,%eax
+  801849:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80184c:	5b                   	pop    %ebx
+  80184d:	5e                   	pop    %esi
+  80184e:	5d                   	pop    %ebp
+  80184f:	c3                   	ret
+	assert(r <= n);
+  801850:	68 fc 2c 80 00       	push   $0x802cfc
+  801855:	68 03 2d 80 00       	push   $0x802d03
+  80185a:	6a 7c                	push   $0x7c
+  80185c:	68 18 2d 80 00       	push   $0x802d18
+  801861:	e8 75 e9 ff ff       	call   8001db <_panic>
+	assert(r <= PGSIZE);
+  801866:	68 23 2d 80 00       	push   $0x802d23
+  80186b:	68 03 2d 80 00       	push   $0x802d03
+  801870:	6a 7d                	push   $0x7d
+  801872:	68 18 2d 80 00       	push   $0x802d18
+  801877:	e8 5f e9 ff ff       	call   8001db <_panic>
+
+0080187c <open>:
+{
+  80187c:	55                   	push   %ebp
+  80187d:	89 e5                	mov    %esp,%ebp
+  80187f:	56                   	push   %esi
+  801880:	53                   	push   %ebx
+  801881:	83 ec 1c             	sub    $0x1c,%esp
+  801884:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801887:	56                   	push   %esi
+  801888:	e8 dc ef ff ff       	call   800869 <strlen>
+  80188d:	83 c4 10             	add    $0x10,%esp
+  801890:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801895:	7f 6c                	jg     801903 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801897:	83 ec 0c             	sub    $0xc,%esp
+  80189a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80189d:	50                   	push   %eax
+  80189e:	e8 ba f8 ff ff       	call   80115d <fd_alloc>
+  8018a3:	89 c3                	mov    %eax,%ebx
+  8018a5:	83 c4 10             	add    $0x10,%esp
+  8018a8:	85 c0                	test   %eax,%eax
+  8018aa:	78 3c                	js     8018e8 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8018ac:	83 ec 08             	sub    $0x8,%esp
+  8018af:	56                   	push   %esi
+  8018b0:	68 00 50 80 00       	push   $0x805000
+  8018b5:	e8 ea ef ff ff       	call   8008a4 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8018ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018bd:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8018c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8018c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018ca:	e8 f6 fd ff ff       	call   8016c5 <fsipc>
+  8018cf:	89 c3                	mov    %eax,%ebx
+  8018d1:	83 c4 10             	add    $0x10,%esp
+  8018d4:	85 c0                	test   %eax,%eax
+  8018d6:	78 19                	js     8018f1 <open+0x75>
+	return fd2num(fd);
+  8018d8:	83 ec 0c             	sub    $0xc,%esp
+  8018db:	ff 75 f4             	push   -0xc(%ebp)
+  8018de:	e8 53 f8 ff ff       	call   801136 <fd2num>
+  8018e3:	89 c3                	mov    %eax,%ebx
+  8018e5:	83 c4 10             	add    $0x10,%esp
+}
+  8018e8:	89 d8                	mov    %ebx,%eax
+  8018ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ed:	5b                   	pop    %ebx
+  8018ee:	5e                   	pop    %esi
+  8018ef:	5d                   	pop    %ebp
+  8018f0:	c3                   	ret
+		fd_close(fd, 0);
+  8018f1:	83 ec 08             	sub    $0x8,%esp
+  8018f4:	6a 00                	push   $0x0
+  8018f6:	ff 75 f4             	push   -0xc(%ebp)
+  8018f9:	e8 58 f9 ff ff       	call   801256 <fd_close>
+		return r;
+  8018fe:	83 c4 10             	add    $0x10,%esp
+  801901:	eb e5                	jmp    8018e8 <open+0x6c>
+		return -E_BAD_PATH;
+  801903:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801908:	eb de                	jmp    8018e8 <open+0x6c>
+
+0080190a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80190a:	55                   	push   %ebp
+  80190b:	89 e5                	mov    %esp,%ebp
+  80190d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801910:	ba 00 00 00 00       	mov    $0x0,%edx
+  801915:	b8 08 00 00 00       	mov    $0x8,%eax
+  80191a:	e8 a6 fd ff ff       	call   8016c5 <fsipc>
+}
+  80191f:	c9                   	leave
+  801920:	c3                   	ret
+
+00801921 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801921:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801925:	7f 01                	jg     801928 <writebuf+0x7>
+  801927:	c3                   	ret
+{
+  801928:	55                   	push   %ebp
+  801929:	89 e5                	mov    %esp,%ebp
+  80192b:	53                   	push   %ebx
+  80192c:	83 ec 08             	sub    $0x8,%esp
+  80192f:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801931:	ff 70 04             	push   0x4(%eax)
+  801934:	8d 40 10             	lea    0x10(%eax),%eax
+  801937:	50                   	push   %eax
+  801938:	ff 33                	push   (%ebx)
+  80193a:	e8 a8 fb ff ff       	call   8014e7 <write>
+		if (result > 0)
+  80193f:	83 c4 10             	add    $0x10,%esp
+  801942:	85 c0                	test   %eax,%eax
+  801944:	7e 03                	jle    801949 <writebuf+0x28>
+			b->result += result;
+  801946:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801949:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80194c:	74 0d                	je     80195b <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  80194e:	85 c0                	test   %eax,%eax
+  801950:	ba 00 00 00 00       	mov    $0x0,%edx
+  801955:	0f 4f c2             	cmovg  %edx,%eax
+  801958:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  80195b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80195e:	c9                   	leave
+  80195f:	c3                   	ret
+
+00801960 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801960:	55                   	push   %ebp
+  801961:	89 e5                	mov    %esp,%ebp
+  801963:	53                   	push   %ebx
+  801964:	83 ec 04             	sub    $0x4,%esp
+  801967:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  80196a:	8b 53 04             	mov    0x4(%ebx),%edx
+  80196d:	8d 42 01             	lea    0x1(%edx),%eax
+  801970:	89 43 04             	mov    %eax,0x4(%ebx)
+  801973:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801976:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  80197a:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80197f:	74 05                	je     801986 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801981:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801984:	c9                   	leave
+  801985:	c3                   	ret
+		writebuf(b);
+  801986:	89 d8                	mov    %ebx,%eax
+  801988:	e8 94 ff ff ff       	call   801921 <writebuf>
+		b->idx = 0;
+  80198d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801994:	eb eb                	jmp    801981 <putch+0x21>
+
+00801996 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801996:	55                   	push   %ebp
+  801997:	89 e5                	mov    %esp,%ebp
+  801999:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  80199f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a2:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8019a8:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8019af:	00 00 00 
+	b.result = 0;
+  8019b2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8019b9:	00 00 00 
+	b.error = 1;
+  8019bc:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8019c3:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8019c6:	ff 75 10             	push   0x10(%ebp)
+  8019c9:	ff 75 0c             	push   0xc(%ebp)
+  8019cc:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8019d2:	50                   	push   %eax
+  8019d3:	68 60 19 80 00       	push   $0x801960
+  8019d8:	e8 d0 e9 ff ff       	call   8003ad <vprintfmt>
+	if (b.idx > 0)
+  8019dd:	83 c4 10             	add    $0x10,%esp
+  8019e0:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8019e7:	7f 12                	jg     8019fb <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8019e9:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8019ef:	85 c0                	test   %eax,%eax
+  8019f1:	75 06                	jne    8019f9 <vfprintf+0x63>
+  8019f3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8019f9:	c9                   	leave
+  8019fa:	c3                   	ret
+		writebuf(&b);
+  8019fb:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801a01:	e8 1b ff ff ff       	call   801921 <writebuf>
+  801a06:	eb e1                	jmp    8019e9 <vfprintf+0x53>
+
+00801a08 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801a08:	55                   	push   %ebp
+  801a09:	89 e5                	mov    %esp,%ebp
+  801a0b:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801a0e:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801a11:	50                   	push   %eax
+  801a12:	ff 75 0c             	push   0xc(%ebp)
+  801a15:	ff 75 08             	push   0x8(%ebp)
+  801a18:	e8 79 ff ff ff       	call   801996 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801a1d:	c9                   	leave
+  801a1e:	c3                   	ret
+
+00801a1f <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801a1f:	55                   	push   %ebp
+  801a20:	89 e5                	mov    %esp,%ebp
+  801a22:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801a25:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801a28:	50                   	push   %eax
+  801a29:	ff 75 08             	push   0x8(%ebp)
+  801a2c:	6a 01                	push   $0x1
+  801a2e:	e8 63 ff ff ff       	call   801996 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801a33:	c9                   	leave
+  801a34:	c3                   	ret
+
+00801a35 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a35:	55                   	push   %ebp
+  801a36:	89 e5                	mov    %esp,%ebp
+  801a38:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801a3b:	68 2f 2d 80 00       	push   $0x802d2f
+  801a40:	ff 75 0c             	push   0xc(%ebp)
+  801a43:	e8 5c ee ff ff       	call   8008a4 <strcpy>
+	return 0;
+}
+  801a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4d:	c9                   	leave
+  801a4e:	c3                   	ret
+
+00801a4f <devsock_close>:
+{
+  801a4f:	55                   	push   %ebp
+  801a50:	89 e5                	mov    %esp,%ebp
+  801a52:	53                   	push   %ebx
+  801a53:	83 ec 10             	sub    $0x10,%esp
+  801a56:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801a59:	53                   	push   %ebx
+  801a5a:	e8 d8 09 00 00       	call   802437 <pageref>
+  801a5f:	89 c2                	mov    %eax,%edx
+  801a61:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801a64:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801a69:	83 fa 01             	cmp    $0x1,%edx
+  801a6c:	74 05                	je     801a73 <devsock_close+0x24>
+}
+  801a6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a71:	c9                   	leave
+  801a72:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801a73:	83 ec 0c             	sub    $0xc,%esp
+  801a76:	ff 73 0c             	push   0xc(%ebx)
+  801a79:	e8 b7 02 00 00       	call   801d35 <nsipc_close>
+  801a7e:	83 c4 10             	add    $0x10,%esp
+  801a81:	eb eb                	jmp    801a6e <devsock_close+0x1f>
+
+00801a83 <devsock_write>:
+{
+  801a83:	55                   	push   %ebp
+  801a84:	89 e5                	mov    %esp,%ebp
+  801a86:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801a89:	6a 00                	push   $0x0
+  801a8b:	ff 75 10             	push   0x10(%ebp)
+  801a8e:	ff 75 0c             	push   0xc(%ebp)
+  801a91:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a94:	ff 70 0c             	push   0xc(%eax)
+  801a97:	e8 79 03 00 00       	call   801e15 <nsipc_send>
+}
+  801a9c:	c9                   	leave
+  801a9d:	c3                   	ret
+
+00801a9e <devsock_read>:
+{
+  801a9e:	55                   	push   %ebp
+  801a9f:	89 e5                	mov    %esp,%ebp
+  801aa1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801aa4:	6a 00                	push   $0x0
+  801aa6:	ff 75 10             	push   0x10(%ebp)
+  801aa9:	ff 75 0c             	push   0xc(%ebp)
+  801aac:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aaf:	ff 70 0c             	push   0xc(%eax)
+  801ab2:	e8 ef 02 00 00       	call   801da6 <nsipc_recv>
+}
+  801ab7:	c9                   	leave
+  801ab8:	c3                   	ret
+
+00801ab9 <fd2sockid>:
+{
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+  801abc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801abf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801ac2:	52                   	push   %edx
+  801ac3:	50                   	push   %eax
+  801ac4:	e8 ea f6 ff ff       	call   8011b3 <fd_lookup>
+  801ac9:	83 c4 10             	add    $0x10,%esp
+  801acc:	85 c0                	test   %eax,%eax
+  801ace:	78 10                	js     801ae0 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801ad0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ad3:	8b 0d 24 30 80 00    	mov    0x803024,%ecx
+  801ad9:	39 08                	cmp    %ecx,(%eax)
+  801adb:	75 05                	jne    801ae2 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801add:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801ae0:	c9                   	leave
+  801ae1:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ae2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ae7:	eb f7                	jmp    801ae0 <fd2sockid+0x27>
+
+00801ae9 <alloc_sockfd>:
+{
+  801ae9:	55                   	push   %ebp
+  801aea:	89 e5                	mov    %esp,%ebp
+  801aec:	56                   	push   %esi
+  801aed:	53                   	push   %ebx
+  801aee:	83 ec 1c             	sub    $0x1c,%esp
+  801af1:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801af3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af6:	50                   	push   %eax
+  801af7:	e8 61 f6 ff ff       	call   80115d <fd_alloc>
+  801afc:	89 c3                	mov    %eax,%ebx
+  801afe:	83 c4 10             	add    $0x10,%esp
+  801b01:	85 c0                	test   %eax,%eax
+  801b03:	78 43                	js     801b48 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801b05:	83 ec 04             	sub    $0x4,%esp
+  801b08:	68 07 04 00 00       	push   $0x407
+  801b0d:	ff 75 f4             	push   -0xc(%ebp)
+  801b10:	6a 00                	push   $0x0
+  801b12:	e8 fa f1 ff ff       	call   800d11 <sys_page_alloc>
+  801b17:	89 c3                	mov    %eax,%ebx
+  801b19:	83 c4 10             	add    $0x10,%esp
+  801b1c:	85 c0                	test   %eax,%eax
+  801b1e:	78 28                	js     801b48 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801b20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b23:	8b 15 24 30 80 00    	mov    0x803024,%edx
+  801b29:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801b2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b2e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801b35:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801b38:	83 ec 0c             	sub    $0xc,%esp
+  801b3b:	50                   	push   %eax
+  801b3c:	e8 f5 f5 ff ff       	call   801136 <fd2num>
+  801b41:	89 c3                	mov    %eax,%ebx
+  801b43:	83 c4 10             	add    $0x10,%esp
+  801b46:	eb 0c                	jmp    801b54 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801b48:	83 ec 0c             	sub    $0xc,%esp
+  801b4b:	56                   	push   %esi
+  801b4c:	e8 e4 01 00 00       	call   801d35 <nsipc_close>
+		return r;
+  801b51:	83 c4 10             	add    $0x10,%esp
+}
+  801b54:	89 d8                	mov    %ebx,%eax
+  801b56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b59:	5b                   	pop    %ebx
+  801b5a:	5e                   	pop    %esi
+  801b5b:	5d                   	pop    %ebp
+  801b5c:	c3                   	ret
+
+00801b5d <accept>:
+{
+  801b5d:	55                   	push   %ebp
+  801b5e:	89 e5                	mov    %esp,%ebp
+  801b60:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b63:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b66:	e8 4e ff ff ff       	call   801ab9 <fd2sockid>
+  801b6b:	85 c0                	test   %eax,%eax
+  801b6d:	78 1b                	js     801b8a <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801b6f:	83 ec 04             	sub    $0x4,%esp
+  801b72:	ff 75 10             	push   0x10(%ebp)
+  801b75:	ff 75 0c             	push   0xc(%ebp)
+  801b78:	50                   	push   %eax
+  801b79:	e8 0e 01 00 00       	call   801c8c <nsipc_accept>
+  801b7e:	83 c4 10             	add    $0x10,%esp
+  801b81:	85 c0                	test   %eax,%eax
+  801b83:	78 05                	js     801b8a <accept+0x2d>
+	return alloc_sockfd(r);
+  801b85:	e8 5f ff ff ff       	call   801ae9 <alloc_sockfd>
+}
+  801b8a:	c9                   	leave
+  801b8b:	c3                   	ret
+
+00801b8c <bind>:
+{
+  801b8c:	55                   	push   %ebp
+  801b8d:	89 e5                	mov    %esp,%ebp
+  801b8f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b95:	e8 1f ff ff ff       	call   801ab9 <fd2sockid>
+  801b9a:	85 c0                	test   %eax,%eax
+  801b9c:	78 12                	js     801bb0 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801b9e:	83 ec 04             	sub    $0x4,%esp
+  801ba1:	ff 75 10             	push   0x10(%ebp)
+  801ba4:	ff 75 0c             	push   0xc(%ebp)
+  801ba7:	50                   	push   %eax
+  801ba8:	e8 31 01 00 00       	call   801cde <nsipc_bind>
+  801bad:	83 c4 10             	add    $0x10,%esp
+}
+  801bb0:	c9                   	leave
+  801bb1:	c3                   	ret
+
+00801bb2 <shutdown>:
+{
+  801bb2:	55                   	push   %ebp
+  801bb3:	89 e5                	mov    %esp,%ebp
+  801bb5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bbb:	e8 f9 fe ff ff       	call   801ab9 <fd2sockid>
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	78 0f                	js     801bd3 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801bc4:	83 ec 08             	sub    $0x8,%esp
+  801bc7:	ff 75 0c             	push   0xc(%ebp)
+  801bca:	50                   	push   %eax
+  801bcb:	e8 43 01 00 00       	call   801d13 <nsipc_shutdown>
+  801bd0:	83 c4 10             	add    $0x10,%esp
+}
+  801bd3:	c9                   	leave
+  801bd4:	c3                   	ret
+
+00801bd5 <connect>:
+{
+  801bd5:	55                   	push   %ebp
+  801bd6:	89 e5                	mov    %esp,%ebp
+  801bd8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bde:	e8 d6 fe ff ff       	call   801ab9 <fd2sockid>
+  801be3:	85 c0                	test   %eax,%eax
+  801be5:	78 12                	js     801bf9 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801be7:	83 ec 04             	sub    $0x4,%esp
+  801bea:	ff 75 10             	push   0x10(%ebp)
+  801bed:	ff 75 0c             	push   0xc(%ebp)
+  801bf0:	50                   	push   %eax
+  801bf1:	e8 59 01 00 00       	call   801d4f <nsipc_connect>
+  801bf6:	83 c4 10             	add    $0x10,%esp
+}
+  801bf9:	c9                   	leave
+  801bfa:	c3                   	ret
+
+00801bfb <listen>:
+{
+  801bfb:	55                   	push   %ebp
+  801bfc:	89 e5                	mov    %esp,%ebp
+  801bfe:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c04:	e8 b0 fe ff ff       	call   801ab9 <fd2sockid>
+  801c09:	85 c0                	test   %eax,%eax
+  801c0b:	78 0f                	js     801c1c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801c0d:	83 ec 08             	sub    $0x8,%esp
+  801c10:	ff 75 0c             	push   0xc(%ebp)
+  801c13:	50                   	push   %eax
+  801c14:	e8 6b 01 00 00       	call   801d84 <nsipc_listen>
+  801c19:	83 c4 10             	add    $0x10,%esp
+}
+  801c1c:	c9                   	leave
+  801c1d:	c3                   	ret
+
+00801c1e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801c1e:	55                   	push   %ebp
+  801c1f:	89 e5                	mov    %esp,%ebp
+  801c21:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801c24:	ff 75 10             	push   0x10(%ebp)
+  801c27:	ff 75 0c             	push   0xc(%ebp)
+  801c2a:	ff 75 08             	push   0x8(%ebp)
+  801c2d:	e8 41 02 00 00       	call   801e73 <nsipc_socket>
+  801c32:	83 c4 10             	add    $0x10,%esp
+  801c35:	85 c0                	test   %eax,%eax
+  801c37:	78 05                	js     801c3e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801c39:	e8 ab fe ff ff       	call   801ae9 <alloc_sockfd>
+}
+  801c3e:	c9                   	leave
+  801c3f:	c3                   	ret
+
+00801c40 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+  801c43:	53                   	push   %ebx
+  801c44:	83 ec 04             	sub    $0x4,%esp
+  801c47:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801c49:	83 3d 08 40 80 00 00 	cmpl   $0x0,0x804008
+  801c50:	74 26                	je     801c78 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801c52:	6a 07                	push   $0x7
+  801c54:	68 00 60 80 00       	push   $0x806000
+  801c59:	53                   	push   %ebx
+  801c5a:	ff 35 08 40 80 00    	push   0x804008
+  801c60:	e8 6e 07 00 00       	call   8023d3 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801c65:	83 c4 0c             	add    $0xc,%esp
+  801c68:	6a 00                	push   $0x0
+  801c6a:	6a 00                	push   $0x0
+  801c6c:	6a 00                	push   $0x0
+  801c6e:	e8 e8 06 00 00       	call   80235b <ipc_recv>
+}
+  801c73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c76:	c9                   	leave
+  801c77:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801c78:	83 ec 0c             	sub    $0xc,%esp
+  801c7b:	6a 02                	push   $0x2
+  801c7d:	e8 a5 07 00 00       	call   802427 <ipc_find_env>
+  801c82:	a3 08 40 80 00       	mov    %eax,0x804008
+  801c87:	83 c4 10             	add    $0x10,%esp
+  801c8a:	eb c6                	jmp    801c52 <nsipc+0x12>
+
+00801c8c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801c8c:	55                   	push   %ebp
+  801c8d:	89 e5                	mov    %esp,%ebp
+  801c8f:	56                   	push   %esi
+  801c90:	53                   	push   %ebx
+  801c91:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801c94:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c97:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801c9c:	8b 06                	mov    (%esi),%eax
+  801c9e:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ca3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ca8:	e8 93 ff ff ff       	call   801c40 <nsipc>
+  801cad:	89 c3                	mov    %eax,%ebx
+  801caf:	85 c0                	test   %eax,%eax
+  801cb1:	79 09                	jns    801cbc <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801cb3:	89 d8                	mov    %ebx,%eax
+  801cb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb8:	5b                   	pop    %ebx
+  801cb9:	5e                   	pop    %esi
+  801cba:	5d                   	pop    %ebp
+  801cbb:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801cbc:	83 ec 04             	sub    $0x4,%esp
+  801cbf:	ff 35 10 60 80 00    	push   0x806010
+  801cc5:	68 00 60 80 00       	push   $0x806000
+  801cca:	ff 75 0c             	push   0xc(%ebp)
+  801ccd:	e8 58 ed ff ff       	call   800a2a <memmove>
+		*addrlen = ret->ret_addrlen;
+  801cd2:	a1 10 60 80 00       	mov    0x806010,%eax
+  801cd7:	89 06                	mov    %eax,(%esi)
+  801cd9:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801cdc:	eb d5                	jmp    801cb3 <nsipc_accept+0x27>
+
+00801cde <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801cde:	55                   	push   %ebp
+  801cdf:	89 e5                	mov    %esp,%ebp
+  801ce1:	53                   	push   %ebx
+  801ce2:	83 ec 08             	sub    $0x8,%esp
+  801ce5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ce8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ceb:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801cf0:	53                   	push   %ebx
+  801cf1:	ff 75 0c             	push   0xc(%ebp)
+  801cf4:	68 04 60 80 00       	push   $0x806004
+  801cf9:	e8 2c ed ff ff       	call   800a2a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801cfe:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801d04:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d09:	e8 32 ff ff ff       	call   801c40 <nsipc>
+}
+  801d0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d11:	c9                   	leave
+  801d12:	c3                   	ret
+
+00801d13 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801d13:	55                   	push   %ebp
+  801d14:	89 e5                	mov    %esp,%ebp
+  801d16:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d1c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801d21:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d24:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801d29:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d2e:	e8 0d ff ff ff       	call   801c40 <nsipc>
+}
+  801d33:	c9                   	leave
+  801d34:	c3                   	ret
+
+00801d35 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801d35:	55                   	push   %ebp
+  801d36:	89 e5                	mov    %esp,%ebp
+  801d38:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801d3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801d43:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d48:	e8 f3 fe ff ff       	call   801c40 <nsipc>
+}
+  801d4d:	c9                   	leave
+  801d4e:	c3                   	ret
+
+00801d4f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801d4f:	55                   	push   %ebp
+  801d50:	89 e5                	mov    %esp,%ebp
+  801d52:	53                   	push   %ebx
+  801d53:	83 ec 08             	sub    $0x8,%esp
+  801d56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801d59:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d5c:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801d61:	53                   	push   %ebx
+  801d62:	ff 75 0c             	push   0xc(%ebp)
+  801d65:	68 04 60 80 00       	push   $0x806004
+  801d6a:	e8 bb ec ff ff       	call   800a2a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801d6f:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801d75:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d7a:	e8 c1 fe ff ff       	call   801c40 <nsipc>
+}
+  801d7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d82:	c9                   	leave
+  801d83:	c3                   	ret
+
+00801d84 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801d84:	55                   	push   %ebp
+  801d85:	89 e5                	mov    %esp,%ebp
+  801d87:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801d8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8d:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801d92:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d95:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801d9a:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d9f:	e8 9c fe ff ff       	call   801c40 <nsipc>
+}
+  801da4:	c9                   	leave
+  801da5:	c3                   	ret
+
+00801da6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+  801da9:	56                   	push   %esi
+  801daa:	53                   	push   %ebx
+  801dab:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801dae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db1:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801db6:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801dbc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dbf:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801dc4:	b8 07 00 00 00       	mov    $0x7,%eax
+  801dc9:	e8 72 fe ff ff       	call   801c40 <nsipc>
+  801dce:	89 c3                	mov    %eax,%ebx
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	78 22                	js     801df6 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801dd4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801dd9:	39 c6                	cmp    %eax,%esi
+  801ddb:	0f 4e c6             	cmovle %esi,%eax
+  801dde:	39 c3                	cmp    %eax,%ebx
+  801de0:	7f 1d                	jg     801dff <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801de2:	83 ec 04             	sub    $0x4,%esp
+  801de5:	53                   	push   %ebx
+  801de6:	68 00 60 80 00       	push   $0x806000
+  801deb:	ff 75 0c             	push   0xc(%ebp)
+  801dee:	e8 37 ec ff ff       	call   800a2a <memmove>
+  801df3:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801df6:	89 d8                	mov    %ebx,%eax
+  801df8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfb:	5b                   	pop    %ebx
+  801dfc:	5e                   	pop    %esi
+  801dfd:	5d                   	pop    %ebp
+  801dfe:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801dff:	68 3b 2d 80 00       	push   $0x802d3b
+  801e04:	68 03 2d 80 00       	push   $0x802d03
+  801e09:	6a 62                	push   $0x62
+  801e0b:	68 50 2d 80 00       	push   $0x802d50
+  801e10:	e8 c6 e3 ff ff       	call   8001db <_panic>
+
+00801e15 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801e15:	55                   	push   %ebp
+  801e16:	89 e5                	mov    %esp,%ebp
+  801e18:	53                   	push   %ebx
+  801e19:	83 ec 04             	sub    $0x4,%esp
+  801e1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801e1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e22:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801e27:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801e2d:	7f 2e                	jg     801e5d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801e2f:	83 ec 04             	sub    $0x4,%esp
+  801e32:	53                   	push   %ebx
+  801e33:	ff 75 0c             	push   0xc(%ebp)
+  801e36:	68 0c 60 80 00       	push   $0x80600c
+  801e3b:	e8 ea eb ff ff       	call   800a2a <memmove>
+	nsipcbuf.send.req_size = size;
+  801e40:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801e46:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e49:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801e4e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e53:	e8 e8 fd ff ff       	call   801c40 <nsipc>
+}
+  801e58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e5b:	c9                   	leave
+  801e5c:	c3                   	ret
+	assert(size < 1600);
+  801e5d:	68 5c 2d 80 00       	push   $0x802d5c
+  801e62:	68 03 2d 80 00       	push   $0x802d03
+  801e67:	6a 6d                	push   $0x6d
+  801e69:	68 50 2d 80 00       	push   $0x802d50
+  801e6e:	e8 68 e3 ff ff       	call   8001db <_panic>
+
+00801e73 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801e73:	55                   	push   %ebp
+  801e74:	89 e5                	mov    %esp,%ebp
+  801e76:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801e79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e7c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801e81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e84:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801e89:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e8c:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801e91:	b8 09 00 00 00       	mov    $0x9,%eax
+  801e96:	e8 a5 fd ff ff       	call   801c40 <nsipc>
+}
+  801e9b:	c9                   	leave
+  801e9c:	c3                   	ret
+
+00801e9d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e9d:	55                   	push   %ebp
+  801e9e:	89 e5                	mov    %esp,%ebp
+  801ea0:	56                   	push   %esi
+  801ea1:	53                   	push   %ebx
+  801ea2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801ea5:	83 ec 0c             	sub    $0xc,%esp
+  801ea8:	ff 75 08             	push   0x8(%ebp)
+  801eab:	e8 96 f2 ff ff       	call   801146 <fd2data>
+  801eb0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801eb2:	83 c4 08             	add    $0x8,%esp
+  801eb5:	68 68 2d 80 00       	push   $0x802d68
+  801eba:	53                   	push   %ebx
+  801ebb:	e8 e4 e9 ff ff       	call   8008a4 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801ec0:	8b 46 04             	mov    0x4(%esi),%eax
+  801ec3:	2b 06                	sub    (%esi),%eax
+  801ec5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801ecb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ed2:	00 00 00 
+	stat->st_dev = &devpipe;
+  801ed5:	c7 83 88 00 00 00 40 	movl   $0x803040,0x88(%ebx)
+  801edc:	30 80 00 
+	return 0;
+}
+  801edf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee7:	5b                   	pop    %ebx
+  801ee8:	5e                   	pop    %esi
+  801ee9:	5d                   	pop    %ebp
+  801eea:	c3                   	ret
+
+00801eeb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801eeb:	55                   	push   %ebp
+  801eec:	89 e5                	mov    %esp,%ebp
+  801eee:	53                   	push   %ebx
+  801eef:	83 ec 0c             	sub    $0xc,%esp
+  801ef2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801ef5:	53                   	push   %ebx
+  801ef6:	6a 00                	push   $0x0
+  801ef8:	e8 dc ee ff ff       	call   800dd9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801efd:	89 1c 24             	mov    %ebx,(%esp)
+  801f00:	e8 41 f2 ff ff       	call   801146 <fd2data>
+  801f05:	83 c4 08             	add    $0x8,%esp
+  801f08:	50                   	push   %eax
+  801f09:	6a 00                	push   $0x0
+  801f0b:	e8 c9 ee ff ff       	call   800dd9 <sys_page_unmap>
+}
+  801f10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f13:	c9                   	leave
+  801f14:	c3                   	ret
+
+00801f15 <_pipeisclosed>:
+{
+  801f15:	55                   	push   %ebp
+  801f16:	89 e5                	mov    %esp,%ebp
+  801f18:	57                   	push   %edi
+  801f19:	56                   	push   %esi
+  801f1a:	53                   	push   %ebx
+  801f1b:	83 ec 1c             	sub    $0x1c,%esp
+  801f1e:	89 c7                	mov    %eax,%edi
+  801f20:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801f22:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801f27:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801f2a:	83 ec 0c             	sub    $0xc,%esp
+  801f2d:	57                   	push   %edi
+  801f2e:	e8 04 05 00 00       	call   802437 <pageref>
+  801f33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f36:	89 34 24             	mov    %esi,(%esp)
+  801f39:	e8 f9 04 00 00       	call   802437 <pageref>
+		nn = thisenv->env_runs;
+  801f3e:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  801f44:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801f47:	83 c4 10             	add    $0x10,%esp
+  801f4a:	39 cb                	cmp    %ecx,%ebx
+  801f4c:	74 1b                	je     801f69 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801f4e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f51:	75 cf                	jne    801f22 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801f53:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801f56:	6a 01                	push   $0x1
+  801f58:	50                   	push   %eax
+  801f59:	53                   	push   %ebx
+  801f5a:	68 6f 2d 80 00       	push   $0x802d6f
+  801f5f:	e8 52 e3 ff ff       	call   8002b6 <cprintf>
+  801f64:	83 c4 10             	add    $0x10,%esp
+  801f67:	eb b9                	jmp    801f22 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801f69:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f6c:	0f 94 c0             	sete   %al
+  801f6f:	0f b6 c0             	movzbl %al,%eax
+}
+  801f72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f75:	5b                   	pop    %ebx
+  801f76:	5e                   	pop    %esi
+  801f77:	5f                   	pop    %edi
+  801f78:	5d                   	pop    %ebp
+  801f79:	c3                   	ret
+
+00801f7a <devpipe_write>:
+{
+  801f7a:	55                   	push   %ebp
+  801f7b:	89 e5                	mov    %esp,%ebp
+  801f7d:	57                   	push   %edi
+  801f7e:	56                   	push   %esi
+  801f7f:	53                   	push   %ebx
+  801f80:	83 ec 28             	sub    $0x28,%esp
+  801f83:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801f86:	56                   	push   %esi
+  801f87:	e8 ba f1 ff ff       	call   801146 <fd2data>
+  801f8c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801f8e:	83 c4 10             	add    $0x10,%esp
+  801f91:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f96:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801f99:	75 09                	jne    801fa4 <devpipe_write+0x2a>
+	return i;
+  801f9b:	89 f8                	mov    %edi,%eax
+  801f9d:	eb 23                	jmp    801fc2 <devpipe_write+0x48>
+			sys_yield();
+  801f9f:	e8 ed ec ff ff       	call   800c91 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801fa4:	8b 43 04             	mov    0x4(%ebx),%eax
+  801fa7:	8b 0b                	mov    (%ebx),%ecx
+  801fa9:	8d 51 20             	lea    0x20(%ecx),%edx
+  801fac:	39 d0                	cmp    %edx,%eax
+  801fae:	72 1a                	jb     801fca <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801fb0:	89 da                	mov    %ebx,%edx
+  801fb2:	89 f0                	mov    %esi,%eax
+  801fb4:	e8 5c ff ff ff       	call   801f15 <_pipeisclosed>
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	74 e2                	je     801f9f <devpipe_write+0x25>
+				return 0;
+  801fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc5:	5b                   	pop    %ebx
+  801fc6:	5e                   	pop    %esi
+  801fc7:	5f                   	pop    %edi
+  801fc8:	5d                   	pop    %ebp
+  801fc9:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801fca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fcd:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801fd1:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801fd4:	89 c2                	mov    %eax,%edx
+  801fd6:	c1 fa 1f             	sar    $0x1f,%edx
+  801fd9:	89 d1                	mov    %edx,%ecx
+  801fdb:	c1 e9 1b             	shr    $0x1b,%ecx
+  801fde:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801fe1:	83 e2 1f             	and    $0x1f,%edx
+  801fe4:	29 ca                	sub    %ecx,%edx
+  801fe6:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801fea:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801fee:	83 c0 01             	add    $0x1,%eax
+  801ff1:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801ff4:	83 c7 01             	add    $0x1,%edi
+  801ff7:	eb 9d                	jmp    801f96 <devpipe_write+0x1c>
+
+00801ff9 <devpipe_read>:
+{
+  801ff9:	55                   	push   %ebp
+  801ffa:	89 e5                	mov    %esp,%ebp
+  801ffc:	57                   	push   %edi
+  801ffd:	56                   	push   %esi
+  801ffe:	53                   	push   %ebx
+  801fff:	83 ec 18             	sub    $0x18,%esp
+  802002:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802005:	57                   	push   %edi
+  802006:	e8 3b f1 ff ff       	call   801146 <fd2data>
+  80200b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80200d:	83 c4 10             	add    $0x10,%esp
+  802010:	be 00 00 00 00       	mov    $0x0,%esi
+  802015:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802018:	75 13                	jne    80202d <devpipe_read+0x34>
+	return i;
+  80201a:	89 f0                	mov    %esi,%eax
+  80201c:	eb 02                	jmp    802020 <devpipe_read+0x27>
+				return i;
+  80201e:	89 f0                	mov    %esi,%eax
+}
+  802020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802023:	5b                   	pop    %ebx
+  802024:	5e                   	pop    %esi
+  802025:	5f                   	pop    %edi
+  802026:	5d                   	pop    %ebp
+  802027:	c3                   	ret
+			sys_yield();
+  802028:	e8 64 ec ff ff       	call   800c91 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80202d:	8b 03                	mov    (%ebx),%eax
+  80202f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802032:	75 18                	jne    80204c <devpipe_read+0x53>
+			if (i > 0)
+  802034:	85 f6                	test   %esi,%esi
+  802036:	75 e6                	jne    80201e <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802038:	89 da                	mov    %ebx,%edx
+  80203a:	89 f8                	mov    %edi,%eax
+  80203c:	e8 d4 fe ff ff       	call   801f15 <_pipeisclosed>
+  802041:	85 c0                	test   %eax,%eax
+  802043:	74 e3                	je     802028 <devpipe_read+0x2f>
+				return 0;
+  802045:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204a:	eb d4                	jmp    802020 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80204c:	99                   	cltd
+  80204d:	c1 ea 1b             	shr    $0x1b,%edx
+  802050:	01 d0                	add    %edx,%eax
+  802052:	83 e0 1f             	and    $0x1f,%eax
+  802055:	29 d0                	sub    %edx,%eax
+  802057:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80205c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80205f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802062:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802065:	83 c6 01             	add    $0x1,%esi
+  802068:	eb ab                	jmp    802015 <devpipe_read+0x1c>
+
+0080206a <pipe>:
+{
+  80206a:	55                   	push   %ebp
+  80206b:	89 e5                	mov    %esp,%ebp
+  80206d:	56                   	push   %esi
+  80206e:	53                   	push   %ebx
+  80206f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802072:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802075:	50                   	push   %eax
+  802076:	e8 e2 f0 ff ff       	call   80115d <fd_alloc>
+  80207b:	89 c3                	mov    %eax,%ebx
+  80207d:	83 c4 10             	add    $0x10,%esp
+  802080:	85 c0                	test   %eax,%eax
+  802082:	0f 88 23 01 00 00    	js     8021ab <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802088:	83 ec 04             	sub    $0x4,%esp
+  80208b:	68 07 04 00 00       	push   $0x407
+  802090:	ff 75 f4             	push   -0xc(%ebp)
+  802093:	6a 00                	push   $0x0
+  802095:	e8 77 ec ff ff       	call   800d11 <sys_page_alloc>
+  80209a:	89 c3                	mov    %eax,%ebx
+  80209c:	83 c4 10             	add    $0x10,%esp
+  80209f:	85 c0                	test   %eax,%eax
+  8020a1:	0f 88 04 01 00 00    	js     8021ab <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8020a7:	83 ec 0c             	sub    $0xc,%esp
+  8020aa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020ad:	50                   	push   %eax
+  8020ae:	e8 aa f0 ff ff       	call   80115d <fd_alloc>
+  8020b3:	89 c3                	mov    %eax,%ebx
+  8020b5:	83 c4 10             	add    $0x10,%esp
+  8020b8:	85 c0                	test   %eax,%eax
+  8020ba:	0f 88 db 00 00 00    	js     80219b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020c0:	83 ec 04             	sub    $0x4,%esp
+  8020c3:	68 07 04 00 00       	push   $0x407
+  8020c8:	ff 75 f0             	push   -0x10(%ebp)
+  8020cb:	6a 00                	push   $0x0
+  8020cd:	e8 3f ec ff ff       	call   800d11 <sys_page_alloc>
+  8020d2:	89 c3                	mov    %eax,%ebx
+  8020d4:	83 c4 10             	add    $0x10,%esp
+  8020d7:	85 c0                	test   %eax,%eax
+  8020d9:	0f 88 bc 00 00 00    	js     80219b <pipe+0x131>
+	va = fd2data(fd0);
+  8020df:	83 ec 0c             	sub    $0xc,%esp
+  8020e2:	ff 75 f4             	push   -0xc(%ebp)
+  8020e5:	e8 5c f0 ff ff       	call   801146 <fd2data>
+  8020ea:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020ec:	83 c4 0c             	add    $0xc,%esp
+  8020ef:	68 07 04 00 00       	push   $0x407
+  8020f4:	50                   	push   %eax
+  8020f5:	6a 00                	push   $0x0
+  8020f7:	e8 15 ec ff ff       	call   800d11 <sys_page_alloc>
+  8020fc:	89 c3                	mov    %eax,%ebx
+  8020fe:	83 c4 10             	add    $0x10,%esp
+  802101:	85 c0                	test   %eax,%eax
+  802103:	0f 88 82 00 00 00    	js     80218b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802109:	83 ec 0c             	sub    $0xc,%esp
+  80210c:	ff 75 f0             	push   -0x10(%ebp)
+  80210f:	e8 32 f0 ff ff       	call   801146 <fd2data>
+  802114:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80211b:	50                   	push   %eax
+  80211c:	6a 00                	push   $0x0
+  80211e:	56                   	push   %esi
+  80211f:	6a 00                	push   $0x0
+  802121:	e8 71 ec ff ff       	call   800d97 <sys_page_map>
+  802126:	89 c3                	mov    %eax,%ebx
+  802128:	83 c4 20             	add    $0x20,%esp
+  80212b:	85 c0                	test   %eax,%eax
+  80212d:	78 4e                	js     80217d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80212f:	a1 40 30 80 00       	mov    0x803040,%eax
+  802134:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802137:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802139:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80213c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802143:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802146:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802148:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80214b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802152:	83 ec 0c             	sub    $0xc,%esp
+  802155:	ff 75 f4             	push   -0xc(%ebp)
+  802158:	e8 d9 ef ff ff       	call   801136 <fd2num>
+  80215d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802160:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802162:	83 c4 04             	add    $0x4,%esp
+  802165:	ff 75 f0             	push   -0x10(%ebp)
+  802168:	e8 c9 ef ff ff       	call   801136 <fd2num>
+  80216d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802170:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802173:	83 c4 10             	add    $0x10,%esp
+  802176:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80217b:	eb 2e                	jmp    8021ab <pipe+0x141>
+	sys_page_unmap(0, va);
+  80217d:	83 ec 08             	sub    $0x8,%esp
+  802180:	56                   	push   %esi
+  802181:	6a 00                	push   $0x0
+  802183:	e8 51 ec ff ff       	call   800dd9 <sys_page_unmap>
+  802188:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80218b:	83 ec 08             	sub    $0x8,%esp
+  80218e:	ff 75 f0             	push   -0x10(%ebp)
+  802191:	6a 00                	push   $0x0
+  802193:	e8 41 ec ff ff       	call   800dd9 <sys_page_unmap>
+  802198:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80219b:	83 ec 08             	sub    $0x8,%esp
+  80219e:	ff 75 f4             	push   -0xc(%ebp)
+  8021a1:	6a 00                	push   $0x0
+  8021a3:	e8 31 ec ff ff       	call   800dd9 <sys_page_unmap>
+  8021a8:	83 c4 10             	add    $0x10,%esp
+}
+  8021ab:	89 d8                	mov    %ebx,%eax
+  8021ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b0:	5b                   	pop    %ebx
+  8021b1:	5e                   	pop    %esi
+  8021b2:	5d                   	pop    %ebp
+  8021b3:	c3                   	ret
+
+008021b4 <pipeisclosed>:
+{
+  8021b4:	55                   	push   %ebp
+  8021b5:	89 e5                	mov    %esp,%ebp
+  8021b7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021bd:	50                   	push   %eax
+  8021be:	ff 75 08             	push   0x8(%ebp)
+  8021c1:	e8 ed ef ff ff       	call   8011b3 <fd_lookup>
+  8021c6:	83 c4 10             	add    $0x10,%esp
+  8021c9:	85 c0                	test   %eax,%eax
+  8021cb:	78 18                	js     8021e5 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8021cd:	83 ec 0c             	sub    $0xc,%esp
+  8021d0:	ff 75 f4             	push   -0xc(%ebp)
+  8021d3:	e8 6e ef ff ff       	call   801146 <fd2data>
+  8021d8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021dd:	e8 33 fd ff ff       	call   801f15 <_pipeisclosed>
+  8021e2:	83 c4 10             	add    $0x10,%esp
+}
+  8021e5:	c9                   	leave
+  8021e6:	c3                   	ret
+
+008021e7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8021e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ec:	c3                   	ret
+
+008021ed <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8021ed:	55                   	push   %ebp
+  8021ee:	89 e5                	mov    %esp,%ebp
+  8021f0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8021f3:	68 87 2d 80 00       	push   $0x802d87
+  8021f8:	ff 75 0c             	push   0xc(%ebp)
+  8021fb:	e8 a4 e6 ff ff       	call   8008a4 <strcpy>
+	return 0;
+}
+  802200:	b8 00 00 00 00       	mov    $0x0,%eax
+  802205:	c9                   	leave
+  802206:	c3                   	ret
+
+00802207 <devcons_write>:
+{
+  802207:	55                   	push   %ebp
+  802208:	89 e5                	mov    %esp,%ebp
+  80220a:	57                   	push   %edi
+  80220b:	56                   	push   %esi
+  80220c:	53                   	push   %ebx
+  80220d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802213:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802218:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80221e:	eb 2e                	jmp    80224e <devcons_write+0x47>
+		m = n - tot;
+  802220:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802223:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802225:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80222a:	39 c3                	cmp    %eax,%ebx
+  80222c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80222f:	83 ec 04             	sub    $0x4,%esp
+  802232:	53                   	push   %ebx
+  802233:	89 f0                	mov    %esi,%eax
+  802235:	03 45 0c             	add    0xc(%ebp),%eax
+  802238:	50                   	push   %eax
+  802239:	57                   	push   %edi
+  80223a:	e8 eb e7 ff ff       	call   800a2a <memmove>
+		sys_cputs(buf, m);
+  80223f:	83 c4 08             	add    $0x8,%esp
+  802242:	53                   	push   %ebx
+  802243:	57                   	push   %edi
+  802244:	e8 8b e9 ff ff       	call   800bd4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802249:	01 de                	add    %ebx,%esi
+  80224b:	83 c4 10             	add    $0x10,%esp
+  80224e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802251:	72 cd                	jb     802220 <devcons_write+0x19>
+}
+  802253:	89 f0                	mov    %esi,%eax
+  802255:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802258:	5b                   	pop    %ebx
+  802259:	5e                   	pop    %esi
+  80225a:	5f                   	pop    %edi
+  80225b:	5d                   	pop    %ebp
+  80225c:	c3                   	ret
+
+0080225d <devcons_read>:
+{
+  80225d:	55                   	push   %ebp
+  80225e:	89 e5                	mov    %esp,%ebp
+  802260:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802263:	b8 00 00 00 00       	mov    $0x0,%eax
+  802268:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80226c:	75 07                	jne    802275 <devcons_read+0x18>
+  80226e:	eb 1f                	jmp    80228f <devcons_read+0x32>
+		sys_yield();
+  802270:	e8 1c ea ff ff       	call   800c91 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802275:	e8 78 e9 ff ff       	call   800bf2 <sys_cgetc>
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	74 f2                	je     802270 <devcons_read+0x13>
+	if (c < 0)
+  80227e:	78 0f                	js     80228f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802280:	83 f8 04             	cmp    $0x4,%eax
+  802283:	74 0c                	je     802291 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802285:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802288:	88 02                	mov    %al,(%edx)
+	return 1;
+  80228a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80228f:	c9                   	leave
+  802290:	c3                   	ret
+		return 0;
+  802291:	b8 00 00 00 00       	mov    $0x0,%eax
+  802296:	eb f7                	jmp    80228f <devcons_read+0x32>
+
+00802298 <cputchar>:
+{
+  802298:	55                   	push   %ebp
+  802299:	89 e5                	mov    %esp,%ebp
+  80229b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80229e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8022a4:	6a 01                	push   $0x1
+  8022a6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022a9:	50                   	push   %eax
+  8022aa:	e8 25 e9 ff ff       	call   800bd4 <sys_cputs>
+}
+  8022af:	83 c4 10             	add    $0x10,%esp
+  8022b2:	c9                   	leave
+  8022b3:	c3                   	ret
+
+008022b4 <getchar>:
+{
+  8022b4:	55                   	push   %ebp
+  8022b5:	89 e5                	mov    %esp,%ebp
+  8022b7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8022ba:	6a 01                	push   $0x1
+  8022bc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022bf:	50                   	push   %eax
+  8022c0:	6a 00                	push   $0x0
+  8022c2:	e8 52 f1 ff ff       	call   801419 <read>
+	if (r < 0)
+  8022c7:	83 c4 10             	add    $0x10,%esp
+  8022ca:	85 c0                	test   %eax,%eax
+  8022cc:	78 06                	js     8022d4 <getchar+0x20>
+	if (r < 1)
+  8022ce:	74 06                	je     8022d6 <getchar+0x22>
+	return c;
+  8022d0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8022d4:	c9                   	leave
+  8022d5:	c3                   	ret
+		return -E_EOF;
+  8022d6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8022db:	eb f7                	jmp    8022d4 <getchar+0x20>
+
+008022dd <iscons>:
+{
+  8022dd:	55                   	push   %ebp
+  8022de:	89 e5                	mov    %esp,%ebp
+  8022e0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022e6:	50                   	push   %eax
+  8022e7:	ff 75 08             	push   0x8(%ebp)
+  8022ea:	e8 c4 ee ff ff       	call   8011b3 <fd_lookup>
+  8022ef:	83 c4 10             	add    $0x10,%esp
+  8022f2:	85 c0                	test   %eax,%eax
+  8022f4:	78 11                	js     802307 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8022f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022f9:	8b 15 5c 30 80 00    	mov    0x80305c,%edx
+  8022ff:	39 10                	cmp    %edx,(%eax)
+  802301:	0f 94 c0             	sete   %al
+  802304:	0f b6 c0             	movzbl %al,%eax
+}
+  802307:	c9                   	leave
+  802308:	c3                   	ret
+
+00802309 <opencons>:
+{
+  802309:	55                   	push   %ebp
+  80230a:	89 e5                	mov    %esp,%ebp
+  80230c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80230f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802312:	50                   	push   %eax
+  802313:	e8 45 ee ff ff       	call   80115d <fd_alloc>
+  802318:	83 c4 10             	add    $0x10,%esp
+  80231b:	85 c0                	test   %eax,%eax
+  80231d:	78 3a                	js     802359 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80231f:	83 ec 04             	sub    $0x4,%esp
+  802322:	68 07 04 00 00       	push   $0x407
+  802327:	ff 75 f4             	push   -0xc(%ebp)
+  80232a:	6a 00                	push   $0x0
+  80232c:	e8 e0 e9 ff ff       	call   800d11 <sys_page_alloc>
+  802331:	83 c4 10             	add    $0x10,%esp
+  802334:	85 c0                	test   %eax,%eax
+  802336:	78 21                	js     802359 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80233b:	8b 15 5c 30 80 00    	mov    0x80305c,%edx
+  802341:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802343:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802346:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80234d:	83 ec 0c             	sub    $0xc,%esp
+  802350:	50                   	push   %eax
+  802351:	e8 e0 ed ff ff       	call   801136 <fd2num>
+  802356:	83 c4 10             	add    $0x10,%esp
+}
+  802359:	c9                   	leave
+  80235a:	c3                   	ret
+
+0080235b <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80235b:	55                   	push   %ebp
+  80235c:	89 e5                	mov    %esp,%ebp
+  80235e:	57                   	push   %edi
+  80235f:	56                   	push   %esi
+  802360:	53                   	push   %ebx
+  802361:	83 ec 18             	sub    $0x18,%esp
+  802364:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802367:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80236a:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80236d:	85 db                	test   %ebx,%ebx
+  80236f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802374:	0f 45 c3             	cmovne %ebx,%eax
+  802377:	50                   	push   %eax
+  802378:	e8 17 ed ff ff       	call   801094 <sys_ipc_recv>
+
+	if (from_env_store)
+  80237d:	83 c4 10             	add    $0x10,%esp
+  802380:	85 ff                	test   %edi,%edi
+  802382:	74 17                	je     80239b <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802384:	ba 00 00 00 00       	mov    $0x0,%edx
+  802389:	85 c0                	test   %eax,%eax
+  80238b:	75 0c                	jne    802399 <ipc_recv+0x3e>
+  80238d:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  802393:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802399:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  80239b:	85 f6                	test   %esi,%esi
+  80239d:	74 2e                	je     8023cd <ipc_recv+0x72>
+		if (!r && pg)
+  80239f:	85 c0                	test   %eax,%eax
+  8023a1:	75 24                	jne    8023c7 <ipc_recv+0x6c>
+  8023a3:	85 db                	test   %ebx,%ebx
+  8023a5:	74 20                	je     8023c7 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8023a7:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023ac:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8023b2:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8023b4:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023b9:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  8023bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023c2:	5b                   	pop    %ebx
+  8023c3:	5e                   	pop    %esi
+  8023c4:	5f                   	pop    %edi
+  8023c5:	5d                   	pop    %ebp
+  8023c6:	c3                   	ret
+			*perm_store = 0;
+  8023c7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  8023cd:	85 c0                	test   %eax,%eax
+  8023cf:	75 ee                	jne    8023bf <ipc_recv+0x64>
+  8023d1:	eb e1                	jmp    8023b4 <ipc_recv+0x59>
+
+008023d3 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8023d3:	55                   	push   %ebp
+  8023d4:	89 e5                	mov    %esp,%ebp
+  8023d6:	57                   	push   %edi
+  8023d7:	56                   	push   %esi
+  8023d8:	53                   	push   %ebx
+  8023d9:	83 ec 0c             	sub    $0xc,%esp
+  8023dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023df:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8023e5:	85 db                	test   %ebx,%ebx
+  8023e7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023ec:	0f 44 d8             	cmove  %eax,%ebx
+  8023ef:	ff 75 14             	push   0x14(%ebp)
+  8023f2:	53                   	push   %ebx
+  8023f3:	56                   	push   %esi
+  8023f4:	57                   	push   %edi
+  8023f5:	e8 77 ec ff ff       	call   801071 <sys_ipc_try_send_yield>
+  8023fa:	83 c4 10             	add    $0x10,%esp
+  8023fd:	85 c0                	test   %eax,%eax
+  8023ff:	79 1e                	jns    80241f <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802401:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802404:	75 07                	jne    80240d <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802406:	e8 86 e8 ff ff       	call   800c91 <sys_yield>
+  80240b:	eb e2                	jmp    8023ef <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  80240d:	50                   	push   %eax
+  80240e:	68 93 2d 80 00       	push   $0x802d93
+  802413:	6a 3d                	push   $0x3d
+  802415:	68 a8 2d 80 00       	push   $0x802da8
+  80241a:	e8 bc dd ff ff       	call   8001db <_panic>
+	}
+}
+  80241f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802422:	5b                   	pop    %ebx
+  802423:	5e                   	pop    %esi
+  802424:	5f                   	pop    %edi
+  802425:	5d                   	pop    %ebp
+  802426:	c3                   	ret
+
+00802427 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802427:	55                   	push   %ebp
+  802428:	89 e5                	mov    %esp,%ebp
+  80242a:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  80242d:	ff 75 08             	push   0x8(%ebp)
+  802430:	e8 dc e7 ff ff       	call   800c11 <sys_env_find>
+}
+  802435:	c9                   	leave
+  802436:	c3                   	ret
+
+00802437 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802437:	55                   	push   %ebp
+  802438:	89 e5                	mov    %esp,%ebp
+  80243a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80243d:	89 c2                	mov    %eax,%edx
+  80243f:	c1 ea 16             	shr    $0x16,%edx
+  802442:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802449:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80244e:	f6 c1 01             	test   $0x1,%cl
+  802451:	74 22                	je     802475 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802453:	c1 e8 0c             	shr    $0xc,%eax
+  802456:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80245d:	a8 01                	test   $0x1,%al
+  80245f:	74 14                	je     802475 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802461:	c1 e8 0c             	shr    $0xc,%eax
+  802464:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802467:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80246e:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802472:	0f b7 d2             	movzwl %dx,%edx
+}
+  802475:	89 d0                	mov    %edx,%eax
+  802477:	5d                   	pop    %ebp
+  802478:	c3                   	ret
+  802479:	66 90                	xchg   %ax,%ax
+  80247b:	66 90                	xchg   %ax,%ax
+  80247d:	66 90                	xchg   %ax,%ax
+  80247f:	90                   	nop
+
+00802480 <__udivmoddi4>:
+  802480:	55                   	push   %ebp
+  802481:	57                   	push   %edi
+  802482:	56                   	push   %esi
+  802483:	53                   	push   %ebx
+  802484:	83 ec 14             	sub    $0x14,%esp
+  802487:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80248b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80248f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802493:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802497:	89 f1                	mov    %esi,%ecx
+  802499:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80249d:	09 d9                	or     %ebx,%ecx
+  80249f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8024a3:	0f 84 92 00 00 00    	je     80253b <__udivmoddi4+0xbb>
+  8024a9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024b0:	00 
+  8024b1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8024b6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024bd:	00 
+  8024be:	89 1c 24             	mov    %ebx,(%esp)
+  8024c1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8024c5:	8d 76 00             	lea    0x0(%esi),%esi
+  8024c8:	89 e9                	mov    %ebp,%ecx
+  8024ca:	89 c3                	mov    %eax,%ebx
+  8024cc:	89 d6                	mov    %edx,%esi
+  8024ce:	31 ff                	xor    %edi,%edi
+  8024d0:	d3 ee                	shr    %cl,%esi
+  8024d2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024d5:	f6 c1 20             	test   $0x20,%cl
+  8024d8:	0f 45 de             	cmovne %esi,%ebx
+  8024db:	0f 45 f7             	cmovne %edi,%esi
+  8024de:	8b 3c 24             	mov    (%esp),%edi
+  8024e1:	39 fb                	cmp    %edi,%ebx
+  8024e3:	89 f7                	mov    %esi,%edi
+  8024e5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8024e9:	8b 1c 24             	mov    (%esp),%ebx
+  8024ec:	19 f7                	sbb    %esi,%edi
+  8024ee:	72 39                	jb     802529 <__udivmoddi4+0xa9>
+  8024f0:	89 e9                	mov    %ebp,%ecx
+  8024f2:	89 f7                	mov    %esi,%edi
+  8024f4:	89 de                	mov    %ebx,%esi
+  8024f6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8024f9:	d3 e6                	shl    %cl,%esi
+  8024fb:	31 db                	xor    %ebx,%ebx
+  8024fd:	f6 c1 20             	test   $0x20,%cl
+  802500:	0f 45 fe             	cmovne %esi,%edi
+  802503:	0f 45 f3             	cmovne %ebx,%esi
+  802506:	29 f0                	sub    %esi,%eax
+  802508:	be 01 00 00 00       	mov    $0x1,%esi
+  80250d:	19 fa                	sbb    %edi,%edx
+  80250f:	31 ff                	xor    %edi,%edi
+  802511:	31 db                	xor    %ebx,%ebx
+  802513:	0f a5 f7             	shld   %cl,%esi,%edi
+  802516:	d3 e6                	shl    %cl,%esi
+  802518:	f6 c1 20             	test   $0x20,%cl
+  80251b:	0f 45 fe             	cmovne %esi,%edi
+  80251e:	0f 45 f3             	cmovne %ebx,%esi
+  802521:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802525:	09 74 24 08          	or     %esi,0x8(%esp)
+  802529:	83 ed 01             	sub    $0x1,%ebp
+  80252c:	73 9a                	jae    8024c8 <__udivmoddi4+0x48>
+  80252e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802532:	85 ff                	test   %edi,%edi
+  802534:	74 05                	je     80253b <__udivmoddi4+0xbb>
+  802536:	89 07                	mov    %eax,(%edi)
+  802538:	89 57 04             	mov    %edx,0x4(%edi)
+  80253b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80253f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802543:	83 c4 14             	add    $0x14,%esp
+  802546:	5b                   	pop    %ebx
+  802547:	5e                   	pop    %esi
+  802548:	5f                   	pop    %edi
+  802549:	5d                   	pop    %ebp
+  80254a:	c3                   	ret
+  80254b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80254f:	90                   	nop
+
+00802550 <__udivdi3>:
+  802550:	55                   	push   %ebp
+  802551:	57                   	push   %edi
+  802552:	56                   	push   %esi
+  802553:	53                   	push   %ebx
+  802554:	83 ec 14             	sub    $0x14,%esp
+  802557:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80255b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80255f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802563:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802567:	89 fb                	mov    %edi,%ebx
+  802569:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80256d:	09 f3                	or     %esi,%ebx
+  80256f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802573:	0f 84 85 00 00 00    	je     8025fe <__udivdi3+0xae>
+  802579:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802580:	00 
+  802581:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802586:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80258d:	00 
+  80258e:	89 34 24             	mov    %esi,(%esp)
+  802591:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802595:	8d 76 00             	lea    0x0(%esi),%esi
+  802598:	89 e9                	mov    %ebp,%ecx
+  80259a:	89 c3                	mov    %eax,%ebx
+  80259c:	89 d6                	mov    %edx,%esi
+  80259e:	31 ff                	xor    %edi,%edi
+  8025a0:	d3 ee                	shr    %cl,%esi
+  8025a2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025a5:	f6 c1 20             	test   $0x20,%cl
+  8025a8:	0f 45 de             	cmovne %esi,%ebx
+  8025ab:	0f 45 f7             	cmovne %edi,%esi
+  8025ae:	8b 3c 24             	mov    (%esp),%edi
+  8025b1:	39 fb                	cmp    %edi,%ebx
+  8025b3:	89 f7                	mov    %esi,%edi
+  8025b5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8025b9:	8b 1c 24             	mov    (%esp),%ebx
+  8025bc:	19 f7                	sbb    %esi,%edi
+  8025be:	72 39                	jb     8025f9 <__udivdi3+0xa9>
+  8025c0:	89 e9                	mov    %ebp,%ecx
+  8025c2:	89 f7                	mov    %esi,%edi
+  8025c4:	89 de                	mov    %ebx,%esi
+  8025c6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8025c9:	d3 e6                	shl    %cl,%esi
+  8025cb:	31 db                	xor    %ebx,%ebx
+  8025cd:	f6 c1 20             	test   $0x20,%cl
+  8025d0:	0f 45 fe             	cmovne %esi,%edi
+  8025d3:	0f 45 f3             	cmovne %ebx,%esi
+  8025d6:	29 f0                	sub    %esi,%eax
+  8025d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8025dd:	19 fa                	sbb    %edi,%edx
+  8025df:	31 ff                	xor    %edi,%edi
+  8025e1:	31 db                	xor    %ebx,%ebx
+  8025e3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8025e6:	d3 e6                	shl    %cl,%esi
+  8025e8:	f6 c1 20             	test   $0x20,%cl
+  8025eb:	0f 45 fe             	cmovne %esi,%edi
+  8025ee:	0f 45 f3             	cmovne %ebx,%esi
+  8025f1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8025f5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8025f9:	83 ed 01             	sub    $0x1,%ebp
+  8025fc:	73 9a                	jae    802598 <__udivdi3+0x48>
+  8025fe:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802602:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802606:	83 c4 14             	add    $0x14,%esp
+  802609:	5b                   	pop    %ebx
+  80260a:	5e                   	pop    %esi
+  80260b:	5f                   	pop    %edi
+  80260c:	5d                   	pop    %ebp
+  80260d:	c3                   	ret
+  80260e:	66 90                	xchg   %ax,%ax
+
+00802610 <__umoddi3>:
+  802610:	57                   	push   %edi
+  802611:	56                   	push   %esi
+  802612:	53                   	push   %ebx
+  802613:	83 ec 08             	sub    $0x8,%esp
+  802616:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80261a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80261e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802622:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802626:	89 f9                	mov    %edi,%ecx
+  802628:	89 34 24             	mov    %esi,(%esp)
+  80262b:	09 f1                	or     %esi,%ecx
+  80262d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802631:	74 53                	je     802686 <__umoddi3+0x76>
+  802633:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80263f:	90                   	nop
+  802640:	89 c6                	mov    %eax,%esi
+  802642:	89 d7                	mov    %edx,%edi
+  802644:	31 db                	xor    %ebx,%ebx
+  802646:	d3 ef                	shr    %cl,%edi
+  802648:	0f ad d6             	shrd   %cl,%edx,%esi
+  80264b:	f6 c1 20             	test   $0x20,%cl
+  80264e:	0f 45 f7             	cmovne %edi,%esi
+  802651:	0f 45 fb             	cmovne %ebx,%edi
+  802654:	8b 1c 24             	mov    (%esp),%ebx
+  802657:	39 de                	cmp    %ebx,%esi
+  802659:	89 fb                	mov    %edi,%ebx
+  80265b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80265f:	8b 34 24             	mov    (%esp),%esi
+  802662:	19 fb                	sbb    %edi,%ebx
+  802664:	72 14                	jb     80267a <__umoddi3+0x6a>
+  802666:	0f a5 f7             	shld   %cl,%esi,%edi
+  802669:	31 db                	xor    %ebx,%ebx
+  80266b:	d3 e6                	shl    %cl,%esi
+  80266d:	f6 c1 20             	test   $0x20,%cl
+  802670:	0f 45 fe             	cmovne %esi,%edi
+  802673:	0f 45 f3             	cmovne %ebx,%esi
+  802676:	29 f0                	sub    %esi,%eax
+  802678:	19 fa                	sbb    %edi,%edx
+  80267a:	83 e9 01             	sub    $0x1,%ecx
+  80267d:	73 c1                	jae    802640 <__umoddi3+0x30>
+  80267f:	83 c4 08             	add    $0x8,%esp
+  802682:	5b                   	pop    %ebx
+  802683:	5e                   	pop    %esi
+  802684:	5f                   	pop    %edi
+  802685:	c3                   	ret
+  802686:	83 c4 08             	add    $0x8,%esp
+  802689:	31 c0                	xor    %eax,%eax
+  80268b:	31 d2                	xor    %edx,%edx
+  80268d:	5b                   	pop    %ebx
+  80268e:	5e                   	pop    %esi
+  80268f:	5f                   	pop    %edi
+  802690:	c3                   	ret
+  802691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80269f:	90                   	nop
+
+008026a0 <__divdi3>:
+  8026a0:	55                   	push   %ebp
+  8026a1:	57                   	push   %edi
+  8026a2:	56                   	push   %esi
+  8026a3:	53                   	push   %ebx
+  8026a4:	83 ec 1c             	sub    $0x1c,%esp
+  8026a7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8026ab:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8026af:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8026b3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8026b7:	85 ff                	test   %edi,%edi
+  8026b9:	0f 88 da 00 00 00    	js     802799 <__divdi3+0xf9>
+  8026bf:	85 db                	test   %ebx,%ebx
+  8026c1:	78 16                	js     8026d9 <__divdi3+0x39>
+  8026c3:	89 dd                	mov    %ebx,%ebp
+  8026c5:	89 c8                	mov    %ecx,%eax
+  8026c7:	89 da                	mov    %ebx,%edx
+  8026c9:	09 cd                	or     %ecx,%ebp
+  8026cb:	0f 85 fd 00 00 00    	jne    8027ce <__divdi3+0x12e>
+  8026d1:	83 c4 1c             	add    $0x1c,%esp
+  8026d4:	5b                   	pop    %ebx
+  8026d5:	5e                   	pop    %esi
+  8026d6:	5f                   	pop    %edi
+  8026d7:	5d                   	pop    %ebp
+  8026d8:	c3                   	ret
+  8026d9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8026de:	f7 d9                	neg    %ecx
+  8026e0:	89 f0                	mov    %esi,%eax
+  8026e2:	89 fa                	mov    %edi,%edx
+  8026e4:	83 d3 00             	adc    $0x0,%ebx
+  8026e7:	89 0c 24             	mov    %ecx,(%esp)
+  8026ea:	f7 db                	neg    %ebx
+  8026ec:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8026f0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8026f7:	00 
+  8026f8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026fd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802704:	00 
+  802705:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802709:	89 cd                	mov    %ecx,%ebp
+  80270b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80270f:	90                   	nop
+  802710:	89 e9                	mov    %ebp,%ecx
+  802712:	89 c3                	mov    %eax,%ebx
+  802714:	89 d6                	mov    %edx,%esi
+  802716:	31 ff                	xor    %edi,%edi
+  802718:	d3 ee                	shr    %cl,%esi
+  80271a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80271d:	f6 c1 20             	test   $0x20,%cl
+  802720:	0f 45 de             	cmovne %esi,%ebx
+  802723:	0f 45 f7             	cmovne %edi,%esi
+  802726:	8b 3c 24             	mov    (%esp),%edi
+  802729:	39 fb                	cmp    %edi,%ebx
+  80272b:	89 f7                	mov    %esi,%edi
+  80272d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802731:	8b 1c 24             	mov    (%esp),%ebx
+  802734:	19 f7                	sbb    %esi,%edi
+  802736:	72 39                	jb     802771 <__divdi3+0xd1>
+  802738:	89 e9                	mov    %ebp,%ecx
+  80273a:	89 f7                	mov    %esi,%edi
+  80273c:	89 de                	mov    %ebx,%esi
+  80273e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802741:	d3 e6                	shl    %cl,%esi
+  802743:	31 db                	xor    %ebx,%ebx
+  802745:	f6 c1 20             	test   $0x20,%cl
+  802748:	0f 45 fe             	cmovne %esi,%edi
+  80274b:	0f 45 f3             	cmovne %ebx,%esi
+  80274e:	29 f0                	sub    %esi,%eax
+  802750:	be 01 00 00 00       	mov    $0x1,%esi
+  802755:	19 fa                	sbb    %edi,%edx
+  802757:	31 ff                	xor    %edi,%edi
+  802759:	31 db                	xor    %ebx,%ebx
+  80275b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80275e:	d3 e6                	shl    %cl,%esi
+  802760:	f6 c1 20             	test   $0x20,%cl
+  802763:	0f 45 fe             	cmovne %esi,%edi
+  802766:	0f 45 f3             	cmovne %ebx,%esi
+  802769:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80276d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802771:	83 ed 01             	sub    $0x1,%ebp
+  802774:	73 9a                	jae    802710 <__divdi3+0x70>
+  802776:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80277a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80277e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802782:	85 ed                	test   %ebp,%ebp
+  802784:	0f 84 47 ff ff ff    	je     8026d1 <__divdi3+0x31>
+  80278a:	f7 d8                	neg    %eax
+  80278c:	83 d2 00             	adc    $0x0,%edx
+  80278f:	83 c4 1c             	add    $0x1c,%esp
+  802792:	5b                   	pop    %ebx
+  802793:	f7 da                	neg    %edx
+  802795:	5e                   	pop    %esi
+  802796:	5f                   	pop    %edi
+  802797:	5d                   	pop    %ebp
+  802798:	c3                   	ret
+  802799:	f7 de                	neg    %esi
+  80279b:	83 d7 00             	adc    $0x0,%edi
+  80279e:	f7 df                	neg    %edi
+  8027a0:	85 db                	test   %ebx,%ebx
+  8027a2:	78 23                	js     8027c7 <__divdi3+0x127>
+  8027a4:	89 dd                	mov    %ebx,%ebp
+  8027a6:	89 c8                	mov    %ecx,%eax
+  8027a8:	89 da                	mov    %ebx,%edx
+  8027aa:	09 cd                	or     %ecx,%ebp
+  8027ac:	0f 84 1f ff ff ff    	je     8026d1 <__divdi3+0x31>
+  8027b2:	89 0c 24             	mov    %ecx,(%esp)
+  8027b5:	89 f0                	mov    %esi,%eax
+  8027b7:	89 fa                	mov    %edi,%edx
+  8027b9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8027be:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8027c2:	e9 29 ff ff ff       	jmp    8026f0 <__divdi3+0x50>
+  8027c7:	31 ed                	xor    %ebp,%ebp
+  8027c9:	e9 10 ff ff ff       	jmp    8026de <__divdi3+0x3e>
+  8027ce:	89 0c 24             	mov    %ecx,(%esp)
+  8027d1:	89 f0                	mov    %esi,%eax
+  8027d3:	89 fa                	mov    %edi,%edx
+  8027d5:	31 ed                	xor    %ebp,%ebp
+  8027d7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8027db:	e9 10 ff ff ff       	jmp    8026f0 <__divdi3+0x50>
+
+008027e0 <__moddi3>:
+  8027e0:	55                   	push   %ebp
+  8027e1:	57                   	push   %edi
+  8027e2:	56                   	push   %esi
+  8027e3:	53                   	push   %ebx
+  8027e4:	83 ec 14             	sub    $0x14,%esp
+  8027e7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027eb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027ef:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8027f3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8027f7:	85 d2                	test   %edx,%edx
+  8027f9:	0f 88 9b 00 00 00    	js     80289a <__moddi3+0xba>
+  8027ff:	89 f7                	mov    %esi,%edi
+  802801:	31 ed                	xor    %ebp,%ebp
+  802803:	09 cf                	or     %ecx,%edi
+  802805:	0f 84 83 00 00 00    	je     80288e <__moddi3+0xae>
+  80280b:	89 cb                	mov    %ecx,%ebx
+  80280d:	89 f7                	mov    %esi,%edi
+  80280f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802813:	f7 db                	neg    %ebx
+  802815:	83 d7 00             	adc    $0x0,%edi
+  802818:	f7 df                	neg    %edi
+  80281a:	0f 49 f7             	cmovns %edi,%esi
+  80281d:	0f 49 cb             	cmovns %ebx,%ecx
+  802820:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802824:	89 0c 24             	mov    %ecx,(%esp)
+  802827:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80282c:	89 cd                	mov    %ecx,%ebp
+  80282e:	66 90                	xchg   %ax,%ax
+  802830:	89 e9                	mov    %ebp,%ecx
+  802832:	89 c3                	mov    %eax,%ebx
+  802834:	89 d6                	mov    %edx,%esi
+  802836:	31 ff                	xor    %edi,%edi
+  802838:	d3 ee                	shr    %cl,%esi
+  80283a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80283d:	f6 c1 20             	test   $0x20,%cl
+  802840:	0f 45 de             	cmovne %esi,%ebx
+  802843:	0f 45 f7             	cmovne %edi,%esi
+  802846:	8b 3c 24             	mov    (%esp),%edi
+  802849:	39 fb                	cmp    %edi,%ebx
+  80284b:	89 f7                	mov    %esi,%edi
+  80284d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802851:	8b 1c 24             	mov    (%esp),%ebx
+  802854:	19 f7                	sbb    %esi,%edi
+  802856:	72 1a                	jb     802872 <__moddi3+0x92>
+  802858:	89 e9                	mov    %ebp,%ecx
+  80285a:	89 f7                	mov    %esi,%edi
+  80285c:	89 de                	mov    %ebx,%esi
+  80285e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802861:	d3 e6                	shl    %cl,%esi
+  802863:	31 db                	xor    %ebx,%ebx
+  802865:	f6 c1 20             	test   $0x20,%cl
+  802868:	0f 45 fe             	cmovne %esi,%edi
+  80286b:	0f 45 f3             	cmovne %ebx,%esi
+  80286e:	29 f0                	sub    %esi,%eax
+  802870:	19 fa                	sbb    %edi,%edx
+  802872:	83 ed 01             	sub    $0x1,%ebp
+  802875:	73 b9                	jae    802830 <__moddi3+0x50>
+  802877:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80287b:	85 ed                	test   %ebp,%ebp
+  80287d:	74 07                	je     802886 <__moddi3+0xa6>
+  80287f:	f7 d8                	neg    %eax
+  802881:	83 d2 00             	adc    $0x0,%edx
+  802884:	f7 da                	neg    %edx
+  802886:	83 c4 14             	add    $0x14,%esp
+  802889:	5b                   	pop    %ebx
+  80288a:	5e                   	pop    %esi
+  80288b:	5f                   	pop    %edi
+  80288c:	5d                   	pop    %ebp
+  80288d:	c3                   	ret
+  80288e:	83 c4 14             	add    $0x14,%esp
+  802891:	31 c0                	xor    %eax,%eax
+  802893:	31 d2                	xor    %edx,%edx
+  802895:	5b                   	pop    %ebx
+  802896:	5e                   	pop    %esi
+  802897:	5f                   	pop    %edi
+  802898:	5d                   	pop    %ebp
+  802899:	c3                   	ret
+  80289a:	89 f7                	mov    %esi,%edi
+  80289c:	09 cf                	or     %ecx,%edi
+  80289e:	74 11                	je     8028b1 <__moddi3+0xd1>
+  8028a0:	f7 d8                	neg    %eax
+  8028a2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8028a7:	83 d2 00             	adc    $0x0,%edx
+  8028aa:	f7 da                	neg    %edx
+  8028ac:	e9 5a ff ff ff       	jmp    80280b <__moddi3+0x2b>
+  8028b1:	31 c0                	xor    %eax,%eax
+  8028b3:	31 d2                	xor    %edx,%edx
+  8028b5:	eb c8                	jmp    80287f <__moddi3+0x9f>
@@ -0,0 +1,6130 @@
+
+obj/user/pingpong.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8f 00 00 00       	call   8000c0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	envid_t who;
+
+	if ((who = fork()) != 0) {
+  80003c:	e8 cf 10 00 00       	call   801110 <fork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 4f                	jne    800097 <umain+0x64>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		uint32_t i = ipc_recv(&who, 0, 0);
+  800048:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80004b:	83 ec 04             	sub    $0x4,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	6a 00                	push   $0x0
+  800052:	56                   	push   %esi
+  800053:	e8 3f 13 00 00       	call   801397 <ipc_recv>
+  800058:	89 c3                	mov    %eax,%ebx
+		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80005a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80005d:	e8 0f 0b 00 00       	call   800b71 <sys_getenvid>
+  800062:	57                   	push   %edi
+  800063:	53                   	push   %ebx
+  800064:	50                   	push   %eax
+  800065:	68 f6 2a 80 00       	push   $0x802af6
+  80006a:	e8 46 01 00 00       	call   8001b5 <cprintf>
+		if (i == 10)
+  80006f:	83 c4 20             	add    $0x20,%esp
+  800072:	83 fb 0a             	cmp    $0xa,%ebx
+  800075:	74 18                	je     80008f <umain+0x5c>
+			return;
+		i++;
+  800077:	83 c3 01             	add    $0x1,%ebx
+		ipc_send(who, i, 0, 0);
+  80007a:	6a 00                	push   $0x0
+  80007c:	6a 00                	push   $0x0
+  80007e:	53                   	push   %ebx
+  80007f:	ff 75 e4             	push   -0x1c(%ebp)
+  800082:	e8 88 13 00 00       	call   80140f <ipc_send>
+		if (i == 10)
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	83 fb 0a             	cmp    $0xa,%ebx
+  80008d:	75 bc                	jne    80004b <umain+0x18>
+			return;
+	}
+
+}
+  80008f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800092:	5b                   	pop    %ebx
+  800093:	5e                   	pop    %esi
+  800094:	5f                   	pop    %edi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+  800097:	89 c3                	mov    %eax,%ebx
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800099:	e8 d3 0a 00 00       	call   800b71 <sys_getenvid>
+  80009e:	83 ec 04             	sub    $0x4,%esp
+  8000a1:	53                   	push   %ebx
+  8000a2:	50                   	push   %eax
+  8000a3:	68 e0 2a 80 00       	push   $0x802ae0
+  8000a8:	e8 08 01 00 00       	call   8001b5 <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ad:	6a 00                	push   $0x0
+  8000af:	6a 00                	push   $0x0
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b6:	e8 54 13 00 00       	call   80140f <ipc_send>
+  8000bb:	83 c4 20             	add    $0x20,%esp
+  8000be:	eb 88                	jmp    800048 <umain+0x15>
+
+008000c0 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+  8000c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000cb:	e8 a1 0a 00 00       	call   800b71 <sys_getenvid>
+  8000d0:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000d5:	c1 e0 09             	shl    $0x9,%eax
+  8000d8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000dd:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000e2:	85 db                	test   %ebx,%ebx
+  8000e4:	7e 07                	jle    8000ed <libmain+0x2d>
+		binaryname = argv[0];
+  8000e6:	8b 06                	mov    (%esi),%eax
+  8000e8:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ed:	83 ec 08             	sub    $0x8,%esp
+  8000f0:	56                   	push   %esi
+  8000f1:	53                   	push   %ebx
+  8000f2:	e8 3c ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000f7:	e8 0a 00 00 00       	call   800106 <exit>
+}
+  8000fc:	83 c4 10             	add    $0x10,%esp
+  8000ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800102:	5b                   	pop    %ebx
+  800103:	5e                   	pop    %esi
+  800104:	5d                   	pop    %ebp
+  800105:	c3                   	ret
+
+00800106 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800106:	55                   	push   %ebp
+  800107:	89 e5                	mov    %esp,%ebp
+  800109:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80010c:	e8 36 15 00 00       	call   801647 <close_all>
+	sys_env_destroy(0);
+  800111:	83 ec 0c             	sub    $0xc,%esp
+  800114:	6a 00                	push   $0x0
+  800116:	e8 15 0a 00 00       	call   800b30 <sys_env_destroy>
+}
+  80011b:	83 c4 10             	add    $0x10,%esp
+  80011e:	c9                   	leave
+  80011f:	c3                   	ret
+
+00800120 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800120:	55                   	push   %ebp
+  800121:	89 e5                	mov    %esp,%ebp
+  800123:	53                   	push   %ebx
+  800124:	83 ec 04             	sub    $0x4,%esp
+  800127:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80012a:	8b 13                	mov    (%ebx),%edx
+  80012c:	8d 42 01             	lea    0x1(%edx),%eax
+  80012f:	89 03                	mov    %eax,(%ebx)
+  800131:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800134:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800138:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80013d:	74 09                	je     800148 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80013f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800143:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800146:	c9                   	leave
+  800147:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800148:	83 ec 08             	sub    $0x8,%esp
+  80014b:	68 ff 00 00 00       	push   $0xff
+  800150:	8d 43 08             	lea    0x8(%ebx),%eax
+  800153:	50                   	push   %eax
+  800154:	e8 7a 09 00 00       	call   800ad3 <sys_cputs>
+		b->idx = 0;
+  800159:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80015f:	83 c4 10             	add    $0x10,%esp
+  800162:	eb db                	jmp    80013f <putch+0x1f>
+
+00800164 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800164:	55                   	push   %ebp
+  800165:	89 e5                	mov    %esp,%ebp
+  800167:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80016d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800174:	00 00 00 
+	b.cnt = 0;
+  800177:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80017e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800181:	ff 75 0c             	push   0xc(%ebp)
+  800184:	ff 75 08             	push   0x8(%ebp)
+  800187:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80018d:	50                   	push   %eax
+  80018e:	68 20 01 80 00       	push   $0x800120
+  800193:	e8 14 01 00 00       	call   8002ac <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800198:	83 c4 08             	add    $0x8,%esp
+  80019b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001a7:	50                   	push   %eax
+  8001a8:	e8 26 09 00 00       	call   800ad3 <sys_cputs>
+
+	return b.cnt;
+}
+  8001ad:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b3:	c9                   	leave
+  8001b4:	c3                   	ret
+
+008001b5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b5:	55                   	push   %ebp
+  8001b6:	89 e5                	mov    %esp,%ebp
+  8001b8:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001bb:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001be:	50                   	push   %eax
+  8001bf:	ff 75 08             	push   0x8(%ebp)
+  8001c2:	e8 9d ff ff ff       	call   800164 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001c7:	c9                   	leave
+  8001c8:	c3                   	ret
+
+008001c9 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001c9:	55                   	push   %ebp
+  8001ca:	89 e5                	mov    %esp,%ebp
+  8001cc:	57                   	push   %edi
+  8001cd:	56                   	push   %esi
+  8001ce:	53                   	push   %ebx
+  8001cf:	83 ec 1c             	sub    $0x1c,%esp
+  8001d2:	89 c7                	mov    %eax,%edi
+  8001d4:	89 d6                	mov    %edx,%esi
+  8001d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001dc:	89 d1                	mov    %edx,%ecx
+  8001de:	89 c2                	mov    %eax,%edx
+  8001e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001e6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001e9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001ef:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001f6:	39 c2                	cmp    %eax,%edx
+  8001f8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001fb:	72 3e                	jb     80023b <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001fd:	83 ec 0c             	sub    $0xc,%esp
+  800200:	ff 75 18             	push   0x18(%ebp)
+  800203:	83 eb 01             	sub    $0x1,%ebx
+  800206:	53                   	push   %ebx
+  800207:	50                   	push   %eax
+  800208:	83 ec 08             	sub    $0x8,%esp
+  80020b:	ff 75 e4             	push   -0x1c(%ebp)
+  80020e:	ff 75 e0             	push   -0x20(%ebp)
+  800211:	ff 75 dc             	push   -0x24(%ebp)
+  800214:	ff 75 d8             	push   -0x28(%ebp)
+  800217:	e8 54 25 00 00       	call   802770 <__udivdi3>
+  80021c:	83 c4 18             	add    $0x18,%esp
+  80021f:	52                   	push   %edx
+  800220:	50                   	push   %eax
+  800221:	89 f2                	mov    %esi,%edx
+  800223:	89 f8                	mov    %edi,%eax
+  800225:	e8 9f ff ff ff       	call   8001c9 <printnum>
+  80022a:	83 c4 20             	add    $0x20,%esp
+  80022d:	eb 13                	jmp    800242 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80022f:	83 ec 08             	sub    $0x8,%esp
+  800232:	56                   	push   %esi
+  800233:	ff 75 18             	push   0x18(%ebp)
+  800236:	ff d7                	call   *%edi
+  800238:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80023b:	83 eb 01             	sub    $0x1,%ebx
+  80023e:	85 db                	test   %ebx,%ebx
+  800240:	7f ed                	jg     80022f <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800242:	83 ec 08             	sub    $0x8,%esp
+  800245:	56                   	push   %esi
+  800246:	83 ec 04             	sub    $0x4,%esp
+  800249:	ff 75 e4             	push   -0x1c(%ebp)
+  80024c:	ff 75 e0             	push   -0x20(%ebp)
+  80024f:	ff 75 dc             	push   -0x24(%ebp)
+  800252:	ff 75 d8             	push   -0x28(%ebp)
+  800255:	e8 d6 25 00 00       	call   802830 <__umoddi3>
+  80025a:	83 c4 14             	add    $0x14,%esp
+  80025d:	0f be 80 13 2b 80 00 	movsbl 0x802b13(%eax),%eax
+  800264:	50                   	push   %eax
+  800265:	ff d7                	call   *%edi
+}
+  800267:	83 c4 10             	add    $0x10,%esp
+  80026a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026d:	5b                   	pop    %ebx
+  80026e:	5e                   	pop    %esi
+  80026f:	5f                   	pop    %edi
+  800270:	5d                   	pop    %ebp
+  800271:	c3                   	ret
+
+00800272 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800272:	55                   	push   %ebp
+  800273:	89 e5                	mov    %esp,%ebp
+  800275:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800278:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80027c:	8b 10                	mov    (%eax),%edx
+  80027e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800281:	73 0a                	jae    80028d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800283:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800286:	89 08                	mov    %ecx,(%eax)
+  800288:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028b:	88 02                	mov    %al,(%edx)
+}
+  80028d:	5d                   	pop    %ebp
+  80028e:	c3                   	ret
+
+0080028f <printfmt>:
+{
+  80028f:	55                   	push   %ebp
+  800290:	89 e5                	mov    %esp,%ebp
+  800292:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800295:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800298:	50                   	push   %eax
+  800299:	ff 75 10             	push   0x10(%ebp)
+  80029c:	ff 75 0c             	push   0xc(%ebp)
+  80029f:	ff 75 08             	push   0x8(%ebp)
+  8002a2:	e8 05 00 00 00       	call   8002ac <vprintfmt>
+}
+  8002a7:	83 c4 10             	add    $0x10,%esp
+  8002aa:	c9                   	leave
+  8002ab:	c3                   	ret
+
+008002ac <vprintfmt>:
+{
+  8002ac:	55                   	push   %ebp
+  8002ad:	89 e5                	mov    %esp,%ebp
+  8002af:	57                   	push   %edi
+  8002b0:	56                   	push   %esi
+  8002b1:	53                   	push   %ebx
+  8002b2:	83 ec 2c             	sub    $0x2c,%esp
+  8002b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002bb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002be:	eb 0a                	jmp    8002ca <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002c0:	83 ec 08             	sub    $0x8,%esp
+  8002c3:	53                   	push   %ebx
+  8002c4:	50                   	push   %eax
+  8002c5:	ff d6                	call   *%esi
+  8002c7:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ca:	83 c7 01             	add    $0x1,%edi
+  8002cd:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002d1:	83 f8 25             	cmp    $0x25,%eax
+  8002d4:	74 0c                	je     8002e2 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002d6:	85 c0                	test   %eax,%eax
+  8002d8:	75 e6                	jne    8002c0 <vprintfmt+0x14>
+}
+  8002da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002dd:	5b                   	pop    %ebx
+  8002de:	5e                   	pop    %esi
+  8002df:	5f                   	pop    %edi
+  8002e0:	5d                   	pop    %ebp
+  8002e1:	c3                   	ret
+		padc = ' ';
+  8002e2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002e6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002ed:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002f4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800300:	8d 47 01             	lea    0x1(%edi),%eax
+  800303:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800306:	0f b6 17             	movzbl (%edi),%edx
+  800309:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80030c:	3c 55                	cmp    $0x55,%al
+  80030e:	0f 87 cf 03 00 00    	ja     8006e3 <vprintfmt+0x437>
+  800314:	0f b6 c0             	movzbl %al,%eax
+  800317:	ff 24 85 60 2c 80 00 	jmp    *0x802c60(,%eax,4)
+  80031e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800321:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800325:	eb d9                	jmp    800300 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800327:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032a:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80032e:	eb d0                	jmp    800300 <vprintfmt+0x54>
+  800330:	0f b6 d2             	movzbl %dl,%edx
+  800333:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80033e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800341:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800345:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800348:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80034b:	83 f9 09             	cmp    $0x9,%ecx
+  80034e:	77 55                	ja     8003a5 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800350:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800353:	eb e9                	jmp    80033e <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800355:	8b 45 14             	mov    0x14(%ebp),%eax
+  800358:	8b 00                	mov    (%eax),%eax
+  80035a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80035d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800360:	8d 40 04             	lea    0x4(%eax),%eax
+  800363:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800366:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800369:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80036d:	79 91                	jns    800300 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80036f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800372:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800375:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80037c:	eb 82                	jmp    800300 <vprintfmt+0x54>
+			if (width < 0)
+  80037e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800381:	85 d2                	test   %edx,%edx
+  800383:	b8 00 00 00 00       	mov    $0x0,%eax
+  800388:	0f 49 c2             	cmovns %edx,%eax
+  80038b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80038e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800391:	e9 6a ff ff ff       	jmp    800300 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800396:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800399:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003a0:	e9 5b ff ff ff       	jmp    800300 <vprintfmt+0x54>
+  8003a5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ab:	eb bc                	jmp    800369 <vprintfmt+0xbd>
+			lflag++;
+  8003ad:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b3:	e9 48 ff ff ff       	jmp    800300 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bb:	8d 78 04             	lea    0x4(%eax),%edi
+  8003be:	83 ec 08             	sub    $0x8,%esp
+  8003c1:	53                   	push   %ebx
+  8003c2:	ff 30                	push   (%eax)
+  8003c4:	ff d6                	call   *%esi
+			break;
+  8003c6:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003c9:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003cc:	e9 b1 02 00 00       	jmp    800682 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d4:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003d7:	8b 10                	mov    (%eax),%edx
+  8003d9:	89 d0                	mov    %edx,%eax
+  8003db:	f7 d8                	neg    %eax
+  8003dd:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003e0:	83 f8 0f             	cmp    $0xf,%eax
+  8003e3:	7f 23                	jg     800408 <vprintfmt+0x15c>
+  8003e5:	8b 14 85 c0 2d 80 00 	mov    0x802dc0(,%eax,4),%edx
+  8003ec:	85 d2                	test   %edx,%edx
+  8003ee:	74 18                	je     800408 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003f0:	52                   	push   %edx
+  8003f1:	68 09 30 80 00       	push   $0x803009
+  8003f6:	53                   	push   %ebx
+  8003f7:	56                   	push   %esi
+  8003f8:	e8 92 fe ff ff       	call   80028f <printfmt>
+  8003fd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800400:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800403:	e9 7a 02 00 00       	jmp    800682 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800408:	50                   	push   %eax
+  800409:	68 2b 2b 80 00       	push   $0x802b2b
+  80040e:	53                   	push   %ebx
+  80040f:	56                   	push   %esi
+  800410:	e8 7a fe ff ff       	call   80028f <printfmt>
+  800415:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800418:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80041b:	e9 62 02 00 00       	jmp    800682 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800420:	8b 45 14             	mov    0x14(%ebp),%eax
+  800423:	83 c0 04             	add    $0x4,%eax
+  800426:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800429:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80042e:	85 c9                	test   %ecx,%ecx
+  800430:	b8 24 2b 80 00       	mov    $0x802b24,%eax
+  800435:	0f 45 c1             	cmovne %ecx,%eax
+  800438:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80043b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80043f:	7e 06                	jle    800447 <vprintfmt+0x19b>
+  800441:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800445:	75 0b                	jne    800452 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800447:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80044a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80044d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800450:	eb 5c                	jmp    8004ae <vprintfmt+0x202>
+  800452:	83 ec 08             	sub    $0x8,%esp
+  800455:	ff 75 d0             	push   -0x30(%ebp)
+  800458:	ff 75 cc             	push   -0x34(%ebp)
+  80045b:	e8 20 03 00 00       	call   800780 <strnlen>
+  800460:	89 c2                	mov    %eax,%edx
+  800462:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800465:	29 d0                	sub    %edx,%eax
+  800467:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80046a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80046e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800471:	89 75 08             	mov    %esi,0x8(%ebp)
+  800474:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800476:	eb 0e                	jmp    800486 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800478:	83 ec 08             	sub    $0x8,%esp
+  80047b:	53                   	push   %ebx
+  80047c:	57                   	push   %edi
+  80047d:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800480:	83 ee 01             	sub    $0x1,%esi
+  800483:	83 c4 10             	add    $0x10,%esp
+  800486:	85 f6                	test   %esi,%esi
+  800488:	7f ee                	jg     800478 <vprintfmt+0x1cc>
+  80048a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80048d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800490:	85 c0                	test   %eax,%eax
+  800492:	ba 00 00 00 00       	mov    $0x0,%edx
+  800497:	0f 49 d0             	cmovns %eax,%edx
+  80049a:	29 d0                	sub    %edx,%eax
+  80049c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80049f:	eb a6                	jmp    800447 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004a1:	83 ec 08             	sub    $0x8,%esp
+  8004a4:	53                   	push   %ebx
+  8004a5:	52                   	push   %edx
+  8004a6:	ff 55 08             	call   *0x8(%ebp)
+  8004a9:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ac:	89 f1                	mov    %esi,%ecx
+  8004ae:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004b1:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b5:	0f be d0             	movsbl %al,%edx
+  8004b8:	85 d2                	test   %edx,%edx
+  8004ba:	74 28                	je     8004e4 <vprintfmt+0x238>
+  8004bc:	85 ff                	test   %edi,%edi
+  8004be:	78 05                	js     8004c5 <vprintfmt+0x219>
+  8004c0:	83 ef 01             	sub    $0x1,%edi
+  8004c3:	78 30                	js     8004f5 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004c5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004c9:	74 d6                	je     8004a1 <vprintfmt+0x1f5>
+  8004cb:	0f be c0             	movsbl %al,%eax
+  8004ce:	83 e8 20             	sub    $0x20,%eax
+  8004d1:	83 f8 5e             	cmp    $0x5e,%eax
+  8004d4:	76 cb                	jbe    8004a1 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004d6:	83 ec 08             	sub    $0x8,%esp
+  8004d9:	53                   	push   %ebx
+  8004da:	6a 3f                	push   $0x3f
+  8004dc:	ff 55 08             	call   *0x8(%ebp)
+  8004df:	83 c4 10             	add    $0x10,%esp
+  8004e2:	eb c8                	jmp    8004ac <vprintfmt+0x200>
+  8004e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ea:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ed:	01 d0                	add    %edx,%eax
+  8004ef:	29 c8                	sub    %ecx,%eax
+  8004f1:	89 c7                	mov    %eax,%edi
+  8004f3:	eb 13                	jmp    800508 <vprintfmt+0x25c>
+  8004f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f8:	eb ed                	jmp    8004e7 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004fa:	83 ec 08             	sub    $0x8,%esp
+  8004fd:	53                   	push   %ebx
+  8004fe:	6a 20                	push   $0x20
+  800500:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800502:	83 ef 01             	sub    $0x1,%edi
+  800505:	83 c4 10             	add    $0x10,%esp
+  800508:	85 ff                	test   %edi,%edi
+  80050a:	7f ee                	jg     8004fa <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80050c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80050f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800512:	e9 6b 01 00 00       	jmp    800682 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800517:	83 f9 01             	cmp    $0x1,%ecx
+  80051a:	7f 1f                	jg     80053b <vprintfmt+0x28f>
+	else if (lflag)
+  80051c:	85 c9                	test   %ecx,%ecx
+  80051e:	74 67                	je     800587 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800520:	8b 45 14             	mov    0x14(%ebp),%eax
+  800523:	8b 00                	mov    (%eax),%eax
+  800525:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800528:	89 c1                	mov    %eax,%ecx
+  80052a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80052d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800530:	8b 45 14             	mov    0x14(%ebp),%eax
+  800533:	8d 40 04             	lea    0x4(%eax),%eax
+  800536:	89 45 14             	mov    %eax,0x14(%ebp)
+  800539:	eb 17                	jmp    800552 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80053b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053e:	8b 50 04             	mov    0x4(%eax),%edx
+  800541:	8b 00                	mov    (%eax),%eax
+  800543:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800546:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800549:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054c:	8d 40 08             	lea    0x8(%eax),%eax
+  80054f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800552:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800555:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800558:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80055d:	85 c9                	test   %ecx,%ecx
+  80055f:	0f 89 03 01 00 00    	jns    800668 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800565:	83 ec 08             	sub    $0x8,%esp
+  800568:	53                   	push   %ebx
+  800569:	6a 2d                	push   $0x2d
+  80056b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80056d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800570:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800573:	f7 da                	neg    %edx
+  800575:	83 d1 00             	adc    $0x0,%ecx
+  800578:	f7 d9                	neg    %ecx
+  80057a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80057d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800582:	e9 e1 00 00 00       	jmp    800668 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8b 00                	mov    (%eax),%eax
+  80058c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058f:	89 c1                	mov    %eax,%ecx
+  800591:	c1 f9 1f             	sar    $0x1f,%ecx
+  800594:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	8d 40 04             	lea    0x4(%eax),%eax
+  80059d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a0:	eb b0                	jmp    800552 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005a2:	83 f9 01             	cmp    $0x1,%ecx
+  8005a5:	7f 1e                	jg     8005c5 <vprintfmt+0x319>
+	else if (lflag)
+  8005a7:	85 c9                	test   %ecx,%ecx
+  8005a9:	74 32                	je     8005dd <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ae:	8b 10                	mov    (%eax),%edx
+  8005b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005bb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005c0:	e9 a3 00 00 00       	jmp    800668 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8b 10                	mov    (%eax),%edx
+  8005ca:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005cd:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005d8:	e9 8b 00 00 00       	jmp    800668 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	8b 10                	mov    (%eax),%edx
+  8005e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ed:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005f2:	eb 74                	jmp    800668 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005f4:	83 f9 01             	cmp    $0x1,%ecx
+  8005f7:	7f 1b                	jg     800614 <vprintfmt+0x368>
+	else if (lflag)
+  8005f9:	85 c9                	test   %ecx,%ecx
+  8005fb:	74 2c                	je     800629 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800600:	8b 10                	mov    (%eax),%edx
+  800602:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800607:	8d 40 04             	lea    0x4(%eax),%eax
+  80060a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80060d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800612:	eb 54                	jmp    800668 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800614:	8b 45 14             	mov    0x14(%ebp),%eax
+  800617:	8b 10                	mov    (%eax),%edx
+  800619:	8b 48 04             	mov    0x4(%eax),%ecx
+  80061c:	8d 40 08             	lea    0x8(%eax),%eax
+  80061f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800622:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800627:	eb 3f                	jmp    800668 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800629:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062c:	8b 10                	mov    (%eax),%edx
+  80062e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800633:	8d 40 04             	lea    0x4(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800639:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80063e:	eb 28                	jmp    800668 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800640:	83 ec 08             	sub    $0x8,%esp
+  800643:	53                   	push   %ebx
+  800644:	6a 30                	push   $0x30
+  800646:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800648:	83 c4 08             	add    $0x8,%esp
+  80064b:	53                   	push   %ebx
+  80064c:	6a 78                	push   $0x78
+  80064e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800650:	8b 45 14             	mov    0x14(%ebp),%eax
+  800653:	8b 10                	mov    (%eax),%edx
+  800655:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80065a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80065d:	8d 40 04             	lea    0x4(%eax),%eax
+  800660:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800663:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800668:	83 ec 0c             	sub    $0xc,%esp
+  80066b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80066f:	50                   	push   %eax
+  800670:	ff 75 e0             	push   -0x20(%ebp)
+  800673:	57                   	push   %edi
+  800674:	51                   	push   %ecx
+  800675:	52                   	push   %edx
+  800676:	89 da                	mov    %ebx,%edx
+  800678:	89 f0                	mov    %esi,%eax
+  80067a:	e8 4a fb ff ff       	call   8001c9 <printnum>
+			break;
+  80067f:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800682:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800685:	e9 40 fc ff ff       	jmp    8002ca <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80068a:	83 f9 01             	cmp    $0x1,%ecx
+  80068d:	7f 1b                	jg     8006aa <vprintfmt+0x3fe>
+	else if (lflag)
+  80068f:	85 c9                	test   %ecx,%ecx
+  800691:	74 2c                	je     8006bf <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069d:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006a8:	eb be                	jmp    800668 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ad:	8b 10                	mov    (%eax),%edx
+  8006af:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006bd:	eb a9                	jmp    800668 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c2:	8b 10                	mov    (%eax),%edx
+  8006c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006cf:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006d4:	eb 92                	jmp    800668 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006d6:	83 ec 08             	sub    $0x8,%esp
+  8006d9:	53                   	push   %ebx
+  8006da:	6a 25                	push   $0x25
+  8006dc:	ff d6                	call   *%esi
+			break;
+  8006de:	83 c4 10             	add    $0x10,%esp
+  8006e1:	eb 9f                	jmp    800682 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006e3:	83 ec 08             	sub    $0x8,%esp
+  8006e6:	53                   	push   %ebx
+  8006e7:	6a 25                	push   $0x25
+  8006e9:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006eb:	83 c4 10             	add    $0x10,%esp
+  8006ee:	89 f8                	mov    %edi,%eax
+  8006f0:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006f4:	74 05                	je     8006fb <vprintfmt+0x44f>
+  8006f6:	83 e8 01             	sub    $0x1,%eax
+  8006f9:	eb f5                	jmp    8006f0 <vprintfmt+0x444>
+  8006fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006fe:	eb 82                	jmp    800682 <vprintfmt+0x3d6>
+
+00800700 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800700:	55                   	push   %ebp
+  800701:	89 e5                	mov    %esp,%ebp
+  800703:	83 ec 18             	sub    $0x18,%esp
+  800706:	8b 45 08             	mov    0x8(%ebp),%eax
+  800709:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80070c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80070f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800713:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800716:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80071d:	85 c0                	test   %eax,%eax
+  80071f:	74 26                	je     800747 <vsnprintf+0x47>
+  800721:	85 d2                	test   %edx,%edx
+  800723:	7e 22                	jle    800747 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800725:	ff 75 14             	push   0x14(%ebp)
+  800728:	ff 75 10             	push   0x10(%ebp)
+  80072b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80072e:	50                   	push   %eax
+  80072f:	68 72 02 80 00       	push   $0x800272
+  800734:	e8 73 fb ff ff       	call   8002ac <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800739:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80073c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80073f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800742:	83 c4 10             	add    $0x10,%esp
+}
+  800745:	c9                   	leave
+  800746:	c3                   	ret
+		return -E_INVAL;
+  800747:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80074c:	eb f7                	jmp    800745 <vsnprintf+0x45>
+
+0080074e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80074e:	55                   	push   %ebp
+  80074f:	89 e5                	mov    %esp,%ebp
+  800751:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800754:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800757:	50                   	push   %eax
+  800758:	ff 75 10             	push   0x10(%ebp)
+  80075b:	ff 75 0c             	push   0xc(%ebp)
+  80075e:	ff 75 08             	push   0x8(%ebp)
+  800761:	e8 9a ff ff ff       	call   800700 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800766:	c9                   	leave
+  800767:	c3                   	ret
+
+00800768 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800768:	55                   	push   %ebp
+  800769:	89 e5                	mov    %esp,%ebp
+  80076b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80076e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800773:	eb 03                	jmp    800778 <strlen+0x10>
+		n++;
+  800775:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800778:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80077c:	75 f7                	jne    800775 <strlen+0xd>
+	return n;
+}
+  80077e:	5d                   	pop    %ebp
+  80077f:	c3                   	ret
+
+00800780 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800780:	55                   	push   %ebp
+  800781:	89 e5                	mov    %esp,%ebp
+  800783:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800786:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078e:	eb 03                	jmp    800793 <strnlen+0x13>
+		n++;
+  800790:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800793:	39 d0                	cmp    %edx,%eax
+  800795:	74 08                	je     80079f <strnlen+0x1f>
+  800797:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80079b:	75 f3                	jne    800790 <strnlen+0x10>
+  80079d:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80079f:	89 d0                	mov    %edx,%eax
+  8007a1:	5d                   	pop    %ebp
+  8007a2:	c3                   	ret
+
+008007a3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007a3:	55                   	push   %ebp
+  8007a4:	89 e5                	mov    %esp,%ebp
+  8007a6:	53                   	push   %ebx
+  8007a7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007aa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007b6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007b9:	83 c0 01             	add    $0x1,%eax
+  8007bc:	84 d2                	test   %dl,%dl
+  8007be:	75 f2                	jne    8007b2 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007c0:	89 c8                	mov    %ecx,%eax
+  8007c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c5:	c9                   	leave
+  8007c6:	c3                   	ret
+
+008007c7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007c7:	55                   	push   %ebp
+  8007c8:	89 e5                	mov    %esp,%ebp
+  8007ca:	53                   	push   %ebx
+  8007cb:	83 ec 10             	sub    $0x10,%esp
+  8007ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007d1:	53                   	push   %ebx
+  8007d2:	e8 91 ff ff ff       	call   800768 <strlen>
+  8007d7:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007da:	ff 75 0c             	push   0xc(%ebp)
+  8007dd:	01 d8                	add    %ebx,%eax
+  8007df:	50                   	push   %eax
+  8007e0:	e8 be ff ff ff       	call   8007a3 <strcpy>
+	return dst;
+}
+  8007e5:	89 d8                	mov    %ebx,%eax
+  8007e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ea:	c9                   	leave
+  8007eb:	c3                   	ret
+
+008007ec <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007ec:	55                   	push   %ebp
+  8007ed:	89 e5                	mov    %esp,%ebp
+  8007ef:	56                   	push   %esi
+  8007f0:	53                   	push   %ebx
+  8007f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007f7:	89 f3                	mov    %esi,%ebx
+  8007f9:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007fc:	89 f0                	mov    %esi,%eax
+  8007fe:	eb 0f                	jmp    80080f <strncpy+0x23>
+		*dst++ = *src;
+  800800:	83 c0 01             	add    $0x1,%eax
+  800803:	0f b6 0a             	movzbl (%edx),%ecx
+  800806:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800809:	80 f9 01             	cmp    $0x1,%cl
+  80080c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80080f:	39 d8                	cmp    %ebx,%eax
+  800811:	75 ed                	jne    800800 <strncpy+0x14>
+	}
+	return ret;
+}
+  800813:	89 f0                	mov    %esi,%eax
+  800815:	5b                   	pop    %ebx
+  800816:	5e                   	pop    %esi
+  800817:	5d                   	pop    %ebp
+  800818:	c3                   	ret
+
+00800819 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800819:	55                   	push   %ebp
+  80081a:	89 e5                	mov    %esp,%ebp
+  80081c:	56                   	push   %esi
+  80081d:	53                   	push   %ebx
+  80081e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800821:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800824:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800827:	89 f0                	mov    %esi,%eax
+  800829:	85 d2                	test   %edx,%edx
+  80082b:	74 21                	je     80084e <strlcpy+0x35>
+  80082d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800831:	89 f2                	mov    %esi,%edx
+  800833:	eb 09                	jmp    80083e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800835:	83 c1 01             	add    $0x1,%ecx
+  800838:	83 c2 01             	add    $0x1,%edx
+  80083b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80083e:	39 c2                	cmp    %eax,%edx
+  800840:	74 09                	je     80084b <strlcpy+0x32>
+  800842:	0f b6 19             	movzbl (%ecx),%ebx
+  800845:	84 db                	test   %bl,%bl
+  800847:	75 ec                	jne    800835 <strlcpy+0x1c>
+  800849:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80084b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80084e:	29 f0                	sub    %esi,%eax
+}
+  800850:	5b                   	pop    %ebx
+  800851:	5e                   	pop    %esi
+  800852:	5d                   	pop    %ebp
+  800853:	c3                   	ret
+
+00800854 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80085d:	eb 06                	jmp    800865 <strcmp+0x11>
+		p++, q++;
+  80085f:	83 c1 01             	add    $0x1,%ecx
+  800862:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800865:	0f b6 01             	movzbl (%ecx),%eax
+  800868:	84 c0                	test   %al,%al
+  80086a:	74 04                	je     800870 <strcmp+0x1c>
+  80086c:	3a 02                	cmp    (%edx),%al
+  80086e:	74 ef                	je     80085f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800870:	0f b6 c0             	movzbl %al,%eax
+  800873:	0f b6 12             	movzbl (%edx),%edx
+  800876:	29 d0                	sub    %edx,%eax
+}
+  800878:	5d                   	pop    %ebp
+  800879:	c3                   	ret
+
+0080087a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80087a:	55                   	push   %ebp
+  80087b:	89 e5                	mov    %esp,%ebp
+  80087d:	53                   	push   %ebx
+  80087e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800881:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800884:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800887:	eb 09                	jmp    800892 <strncmp+0x18>
+		n--, p++, q++;
+  800889:	83 ea 01             	sub    $0x1,%edx
+  80088c:	83 c0 01             	add    $0x1,%eax
+  80088f:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800892:	85 d2                	test   %edx,%edx
+  800894:	74 18                	je     8008ae <strncmp+0x34>
+  800896:	0f b6 18             	movzbl (%eax),%ebx
+  800899:	84 db                	test   %bl,%bl
+  80089b:	74 04                	je     8008a1 <strncmp+0x27>
+  80089d:	3a 19                	cmp    (%ecx),%bl
+  80089f:	74 e8                	je     800889 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008a1:	0f b6 00             	movzbl (%eax),%eax
+  8008a4:	0f b6 11             	movzbl (%ecx),%edx
+  8008a7:	29 d0                	sub    %edx,%eax
+}
+  8008a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ac:	c9                   	leave
+  8008ad:	c3                   	ret
+		return 0;
+  8008ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b3:	eb f4                	jmp    8008a9 <strncmp+0x2f>
+
+008008b5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008b5:	55                   	push   %ebp
+  8008b6:	89 e5                	mov    %esp,%ebp
+  8008b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008bf:	eb 03                	jmp    8008c4 <strchr+0xf>
+  8008c1:	83 c0 01             	add    $0x1,%eax
+  8008c4:	0f b6 10             	movzbl (%eax),%edx
+  8008c7:	84 d2                	test   %dl,%dl
+  8008c9:	74 06                	je     8008d1 <strchr+0x1c>
+		if (*s == c)
+  8008cb:	38 ca                	cmp    %cl,%dl
+  8008cd:	75 f2                	jne    8008c1 <strchr+0xc>
+  8008cf:	eb 05                	jmp    8008d6 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008d6:	5d                   	pop    %ebp
+  8008d7:	c3                   	ret
+
+008008d8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008d8:	55                   	push   %ebp
+  8008d9:	89 e5                	mov    %esp,%ebp
+  8008db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008de:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008e2:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008e5:	38 ca                	cmp    %cl,%dl
+  8008e7:	74 09                	je     8008f2 <strfind+0x1a>
+  8008e9:	84 d2                	test   %dl,%dl
+  8008eb:	74 05                	je     8008f2 <strfind+0x1a>
+	for (; *s; s++)
+  8008ed:	83 c0 01             	add    $0x1,%eax
+  8008f0:	eb f0                	jmp    8008e2 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008f2:	5d                   	pop    %ebp
+  8008f3:	c3                   	ret
+
+008008f4 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008f4:	55                   	push   %ebp
+  8008f5:	89 e5                	mov    %esp,%ebp
+  8008f7:	57                   	push   %edi
+  8008f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008fb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008fe:	85 c9                	test   %ecx,%ecx
+  800900:	74 20                	je     800922 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800902:	89 f8                	mov    %edi,%eax
+  800904:	09 c8                	or     %ecx,%eax
+  800906:	a8 03                	test   $0x3,%al
+  800908:	75 12                	jne    80091c <memset+0x28>
+		c &= 0xFF;
+  80090a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80090e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800914:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800917:	fc                   	cld
+  800918:	f3 ab                	rep stos %eax,%es:(%edi)
+  80091a:	eb 06                	jmp    800922 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80091c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80091f:	fc                   	cld
+  800920:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800922:	89 f8                	mov    %edi,%eax
+  800924:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800927:	c9                   	leave
+  800928:	c3                   	ret
+
+00800929 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800929:	55                   	push   %ebp
+  80092a:	89 e5                	mov    %esp,%ebp
+  80092c:	57                   	push   %edi
+  80092d:	56                   	push   %esi
+  80092e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800931:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800934:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800937:	39 c6                	cmp    %eax,%esi
+  800939:	73 32                	jae    80096d <memmove+0x44>
+  80093b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80093e:	39 d0                	cmp    %edx,%eax
+  800940:	73 2b                	jae    80096d <memmove+0x44>
+		s += n;
+		d += n;
+  800942:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800945:	89 d6                	mov    %edx,%esi
+  800947:	09 fe                	or     %edi,%esi
+  800949:	09 ce                	or     %ecx,%esi
+  80094b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800951:	75 0e                	jne    800961 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800953:	83 ef 04             	sub    $0x4,%edi
+  800956:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800959:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80095c:	fd                   	std
+  80095d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80095f:	eb 09                	jmp    80096a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800961:	83 ef 01             	sub    $0x1,%edi
+  800964:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800967:	fd                   	std
+  800968:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80096a:	fc                   	cld
+  80096b:	eb 1a                	jmp    800987 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80096d:	89 f2                	mov    %esi,%edx
+  80096f:	09 c2                	or     %eax,%edx
+  800971:	09 ca                	or     %ecx,%edx
+  800973:	f6 c2 03             	test   $0x3,%dl
+  800976:	75 0a                	jne    800982 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800978:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80097b:	89 c7                	mov    %eax,%edi
+  80097d:	fc                   	cld
+  80097e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800980:	eb 05                	jmp    800987 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800982:	89 c7                	mov    %eax,%edi
+  800984:	fc                   	cld
+  800985:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800987:	5e                   	pop    %esi
+  800988:	5f                   	pop    %edi
+  800989:	5d                   	pop    %ebp
+  80098a:	c3                   	ret
+
+0080098b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80098b:	55                   	push   %ebp
+  80098c:	89 e5                	mov    %esp,%ebp
+  80098e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800991:	ff 75 10             	push   0x10(%ebp)
+  800994:	ff 75 0c             	push   0xc(%ebp)
+  800997:	ff 75 08             	push   0x8(%ebp)
+  80099a:	e8 8a ff ff ff       	call   800929 <memmove>
+}
+  80099f:	c9                   	leave
+  8009a0:	c3                   	ret
+
+008009a1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009a1:	55                   	push   %ebp
+  8009a2:	89 e5                	mov    %esp,%ebp
+  8009a4:	56                   	push   %esi
+  8009a5:	53                   	push   %ebx
+  8009a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009ac:	89 c6                	mov    %eax,%esi
+  8009ae:	03 75 10             	add    0x10(%ebp),%esi
+  8009b1:	eb 06                	jmp    8009b9 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009b3:	83 c0 01             	add    $0x1,%eax
+  8009b6:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009b9:	39 f0                	cmp    %esi,%eax
+  8009bb:	74 14                	je     8009d1 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009bd:	0f b6 08             	movzbl (%eax),%ecx
+  8009c0:	0f b6 1a             	movzbl (%edx),%ebx
+  8009c3:	38 d9                	cmp    %bl,%cl
+  8009c5:	74 ec                	je     8009b3 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009c7:	0f b6 c1             	movzbl %cl,%eax
+  8009ca:	0f b6 db             	movzbl %bl,%ebx
+  8009cd:	29 d8                	sub    %ebx,%eax
+  8009cf:	eb 05                	jmp    8009d6 <memcmp+0x35>
+	}
+
+	return 0;
+  8009d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009d6:	5b                   	pop    %ebx
+  8009d7:	5e                   	pop    %esi
+  8009d8:	5d                   	pop    %ebp
+  8009d9:	c3                   	ret
+
+008009da <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009da:	55                   	push   %ebp
+  8009db:	89 e5                	mov    %esp,%ebp
+  8009dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009e3:	89 c2                	mov    %eax,%edx
+  8009e5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009e8:	eb 03                	jmp    8009ed <memfind+0x13>
+  8009ea:	83 c0 01             	add    $0x1,%eax
+  8009ed:	39 d0                	cmp    %edx,%eax
+  8009ef:	73 04                	jae    8009f5 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009f1:	38 08                	cmp    %cl,(%eax)
+  8009f3:	75 f5                	jne    8009ea <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009f5:	5d                   	pop    %ebp
+  8009f6:	c3                   	ret
+
+008009f7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	57                   	push   %edi
+  8009fb:	56                   	push   %esi
+  8009fc:	53                   	push   %ebx
+  8009fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a03:	eb 03                	jmp    800a08 <strtol+0x11>
+		s++;
+  800a05:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a08:	0f b6 02             	movzbl (%edx),%eax
+  800a0b:	3c 20                	cmp    $0x20,%al
+  800a0d:	74 f6                	je     800a05 <strtol+0xe>
+  800a0f:	3c 09                	cmp    $0x9,%al
+  800a11:	74 f2                	je     800a05 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a13:	3c 2b                	cmp    $0x2b,%al
+  800a15:	74 2a                	je     800a41 <strtol+0x4a>
+	int neg = 0;
+  800a17:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a1c:	3c 2d                	cmp    $0x2d,%al
+  800a1e:	74 2b                	je     800a4b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a20:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a26:	75 0f                	jne    800a37 <strtol+0x40>
+  800a28:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a2b:	74 28                	je     800a55 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a2d:	85 db                	test   %ebx,%ebx
+  800a2f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a34:	0f 44 d8             	cmove  %eax,%ebx
+  800a37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a3c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a3f:	eb 46                	jmp    800a87 <strtol+0x90>
+		s++;
+  800a41:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a44:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a49:	eb d5                	jmp    800a20 <strtol+0x29>
+		s++, neg = 1;
+  800a4b:	83 c2 01             	add    $0x1,%edx
+  800a4e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a53:	eb cb                	jmp    800a20 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a55:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a59:	74 0e                	je     800a69 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a5b:	85 db                	test   %ebx,%ebx
+  800a5d:	75 d8                	jne    800a37 <strtol+0x40>
+		s++, base = 8;
+  800a5f:	83 c2 01             	add    $0x1,%edx
+  800a62:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a67:	eb ce                	jmp    800a37 <strtol+0x40>
+		s += 2, base = 16;
+  800a69:	83 c2 02             	add    $0x2,%edx
+  800a6c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a71:	eb c4                	jmp    800a37 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a73:	0f be c0             	movsbl %al,%eax
+  800a76:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a79:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a7c:	7d 3a                	jge    800ab8 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a7e:	83 c2 01             	add    $0x1,%edx
+  800a81:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a85:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a87:	0f b6 02             	movzbl (%edx),%eax
+  800a8a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a8d:	89 f3                	mov    %esi,%ebx
+  800a8f:	80 fb 09             	cmp    $0x9,%bl
+  800a92:	76 df                	jbe    800a73 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a94:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a97:	89 f3                	mov    %esi,%ebx
+  800a99:	80 fb 19             	cmp    $0x19,%bl
+  800a9c:	77 08                	ja     800aa6 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a9e:	0f be c0             	movsbl %al,%eax
+  800aa1:	83 e8 57             	sub    $0x57,%eax
+  800aa4:	eb d3                	jmp    800a79 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aa6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aa9:	89 f3                	mov    %esi,%ebx
+  800aab:	80 fb 19             	cmp    $0x19,%bl
+  800aae:	77 08                	ja     800ab8 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ab0:	0f be c0             	movsbl %al,%eax
+  800ab3:	83 e8 37             	sub    $0x37,%eax
+  800ab6:	eb c1                	jmp    800a79 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ab8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800abc:	74 05                	je     800ac3 <strtol+0xcc>
+		*endptr = (char *) s;
+  800abe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ac1:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ac3:	89 c8                	mov    %ecx,%eax
+  800ac5:	f7 d8                	neg    %eax
+  800ac7:	85 ff                	test   %edi,%edi
+  800ac9:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800acc:	89 c8                	mov    %ecx,%eax
+  800ace:	5b                   	pop    %ebx
+  800acf:	5e                   	pop    %esi
+  800ad0:	5f                   	pop    %edi
+  800ad1:	5d                   	pop    %ebp
+  800ad2:	c3                   	ret
+
+00800ad3 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ad3:	55                   	push   %ebp
+  800ad4:	89 e5                	mov    %esp,%ebp
+  800ad6:	57                   	push   %edi
+  800ad7:	56                   	push   %esi
+  800ad8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ade:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae4:	89 c3                	mov    %eax,%ebx
+  800ae6:	89 c7                	mov    %eax,%edi
+  800ae8:	89 c6                	mov    %eax,%esi
+  800aea:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800aec:	5b                   	pop    %ebx
+  800aed:	5e                   	pop    %esi
+  800aee:	5f                   	pop    %edi
+  800aef:	5d                   	pop    %ebp
+  800af0:	c3                   	ret
+
+00800af1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800af1:	55                   	push   %ebp
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	57                   	push   %edi
+  800af5:	56                   	push   %esi
+  800af6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800af7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800afc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b01:	89 d1                	mov    %edx,%ecx
+  800b03:	89 d3                	mov    %edx,%ebx
+  800b05:	89 d7                	mov    %edx,%edi
+  800b07:	89 d6                	mov    %edx,%esi
+  800b09:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b0b:	5b                   	pop    %ebx
+  800b0c:	5e                   	pop    %esi
+  800b0d:	5f                   	pop    %edi
+  800b0e:	5d                   	pop    %ebp
+  800b0f:	c3                   	ret
+
+00800b10 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	57                   	push   %edi
+  800b14:	56                   	push   %esi
+  800b15:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b23:	89 cb                	mov    %ecx,%ebx
+  800b25:	89 cf                	mov    %ecx,%edi
+  800b27:	89 ce                	mov    %ecx,%esi
+  800b29:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b2b:	5b                   	pop    %ebx
+  800b2c:	5e                   	pop    %esi
+  800b2d:	5f                   	pop    %edi
+  800b2e:	5d                   	pop    %ebp
+  800b2f:	c3                   	ret
+
+00800b30 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	57                   	push   %edi
+  800b34:	56                   	push   %esi
+  800b35:	53                   	push   %ebx
+  800b36:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b41:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b46:	89 cb                	mov    %ecx,%ebx
+  800b48:	89 cf                	mov    %ecx,%edi
+  800b4a:	89 ce                	mov    %ecx,%esi
+  800b4c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b4e:	85 c0                	test   %eax,%eax
+  800b50:	7f 08                	jg     800b5a <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b55:	5b                   	pop    %ebx
+  800b56:	5e                   	pop    %esi
+  800b57:	5f                   	pop    %edi
+  800b58:	5d                   	pop    %ebp
+  800b59:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b5a:	83 ec 0c             	sub    $0xc,%esp
+  800b5d:	50                   	push   %eax
+  800b5e:	6a 03                	push   $0x3
+  800b60:	68 1f 2e 80 00       	push   $0x802e1f
+  800b65:	6a 23                	push   $0x23
+  800b67:	68 3c 2e 80 00       	push   $0x802e3c
+  800b6c:	e8 13 1a 00 00       	call   802584 <_panic>
+
+00800b71 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b71:	55                   	push   %ebp
+  800b72:	89 e5                	mov    %esp,%ebp
+  800b74:	57                   	push   %edi
+  800b75:	56                   	push   %esi
+  800b76:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b77:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b81:	89 d1                	mov    %edx,%ecx
+  800b83:	89 d3                	mov    %edx,%ebx
+  800b85:	89 d7                	mov    %edx,%edi
+  800b87:	89 d6                	mov    %edx,%esi
+  800b89:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b8b:	5b                   	pop    %ebx
+  800b8c:	5e                   	pop    %esi
+  800b8d:	5f                   	pop    %edi
+  800b8e:	5d                   	pop    %ebp
+  800b8f:	c3                   	ret
+
+00800b90 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b90:	55                   	push   %ebp
+  800b91:	89 e5                	mov    %esp,%ebp
+  800b93:	57                   	push   %edi
+  800b94:	56                   	push   %esi
+  800b95:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b9b:	b8 16 00 00 00       	mov    $0x16,%eax
+  800ba0:	89 d1                	mov    %edx,%ecx
+  800ba2:	89 d3                	mov    %edx,%ebx
+  800ba4:	89 d7                	mov    %edx,%edi
+  800ba6:	89 d6                	mov    %edx,%esi
+  800ba8:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800baa:	5b                   	pop    %ebx
+  800bab:	5e                   	pop    %esi
+  800bac:	5f                   	pop    %edi
+  800bad:	5d                   	pop    %ebp
+  800bae:	c3                   	ret
+
+00800baf <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	57                   	push   %edi
+  800bb3:	56                   	push   %esi
+  800bb4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bba:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800bbf:	89 d1                	mov    %edx,%ecx
+  800bc1:	89 d3                	mov    %edx,%ebx
+  800bc3:	89 d7                	mov    %edx,%edi
+  800bc5:	89 d6                	mov    %edx,%esi
+  800bc7:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800bc9:	5b                   	pop    %ebx
+  800bca:	5e                   	pop    %esi
+  800bcb:	5f                   	pop    %edi
+  800bcc:	5d                   	pop    %ebp
+  800bcd:	c3                   	ret
+
+00800bce <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	57                   	push   %edi
+  800bd2:	56                   	push   %esi
+  800bd3:	53                   	push   %ebx
+  800bd4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be2:	b8 15 00 00 00       	mov    $0x15,%eax
+  800be7:	89 df                	mov    %ebx,%edi
+  800be9:	89 de                	mov    %ebx,%esi
+  800beb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bed:	85 c0                	test   %eax,%eax
+  800bef:	7f 08                	jg     800bf9 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800bf1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bf4:	5b                   	pop    %ebx
+  800bf5:	5e                   	pop    %esi
+  800bf6:	5f                   	pop    %edi
+  800bf7:	5d                   	pop    %ebp
+  800bf8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bf9:	83 ec 0c             	sub    $0xc,%esp
+  800bfc:	50                   	push   %eax
+  800bfd:	6a 15                	push   $0x15
+  800bff:	68 1f 2e 80 00       	push   $0x802e1f
+  800c04:	6a 23                	push   $0x23
+  800c06:	68 3c 2e 80 00       	push   $0x802e3c
+  800c0b:	e8 74 19 00 00       	call   802584 <_panic>
+
+00800c10 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c10:	55                   	push   %ebp
+  800c11:	89 e5                	mov    %esp,%ebp
+  800c13:	57                   	push   %edi
+  800c14:	56                   	push   %esi
+  800c15:	53                   	push   %ebx
+  800c16:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c19:	be 00 00 00 00       	mov    $0x0,%esi
+  800c1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c24:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c2c:	89 f7                	mov    %esi,%edi
+  800c2e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c30:	85 c0                	test   %eax,%eax
+  800c32:	7f 08                	jg     800c3c <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c37:	5b                   	pop    %ebx
+  800c38:	5e                   	pop    %esi
+  800c39:	5f                   	pop    %edi
+  800c3a:	5d                   	pop    %ebp
+  800c3b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c3c:	83 ec 0c             	sub    $0xc,%esp
+  800c3f:	50                   	push   %eax
+  800c40:	6a 05                	push   $0x5
+  800c42:	68 1f 2e 80 00       	push   $0x802e1f
+  800c47:	6a 23                	push   $0x23
+  800c49:	68 3c 2e 80 00       	push   $0x802e3c
+  800c4e:	e8 31 19 00 00       	call   802584 <_panic>
+
+00800c53 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800c53:	55                   	push   %ebp
+  800c54:	89 e5                	mov    %esp,%ebp
+  800c56:	57                   	push   %edi
+  800c57:	56                   	push   %esi
+  800c58:	53                   	push   %ebx
+  800c59:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c5c:	be 00 00 00 00       	mov    $0x0,%esi
+  800c61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c67:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c6f:	89 f7                	mov    %esi,%edi
+  800c71:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c73:	85 c0                	test   %eax,%eax
+  800c75:	7f 08                	jg     800c7f <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c7a:	5b                   	pop    %ebx
+  800c7b:	5e                   	pop    %esi
+  800c7c:	5f                   	pop    %edi
+  800c7d:	5d                   	pop    %ebp
+  800c7e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c7f:	83 ec 0c             	sub    $0xc,%esp
+  800c82:	50                   	push   %eax
+  800c83:	6a 06                	push   $0x6
+  800c85:	68 1f 2e 80 00       	push   $0x802e1f
+  800c8a:	6a 23                	push   $0x23
+  800c8c:	68 3c 2e 80 00       	push   $0x802e3c
+  800c91:	e8 ee 18 00 00       	call   802584 <_panic>
+
+00800c96 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c96:	55                   	push   %ebp
+  800c97:	89 e5                	mov    %esp,%ebp
+  800c99:	57                   	push   %edi
+  800c9a:	56                   	push   %esi
+  800c9b:	53                   	push   %ebx
+  800c9c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca5:	b8 07 00 00 00       	mov    $0x7,%eax
+  800caa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cb0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cb3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cb5:	85 c0                	test   %eax,%eax
+  800cb7:	7f 08                	jg     800cc1 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbc:	5b                   	pop    %ebx
+  800cbd:	5e                   	pop    %esi
+  800cbe:	5f                   	pop    %edi
+  800cbf:	5d                   	pop    %ebp
+  800cc0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc1:	83 ec 0c             	sub    $0xc,%esp
+  800cc4:	50                   	push   %eax
+  800cc5:	6a 07                	push   $0x7
+  800cc7:	68 1f 2e 80 00       	push   $0x802e1f
+  800ccc:	6a 23                	push   $0x23
+  800cce:	68 3c 2e 80 00       	push   $0x802e3c
+  800cd3:	e8 ac 18 00 00       	call   802584 <_panic>
+
+00800cd8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cd8:	55                   	push   %ebp
+  800cd9:	89 e5                	mov    %esp,%ebp
+  800cdb:	57                   	push   %edi
+  800cdc:	56                   	push   %esi
+  800cdd:	53                   	push   %ebx
+  800cde:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ce1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cec:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cf1:	89 df                	mov    %ebx,%edi
+  800cf3:	89 de                	mov    %ebx,%esi
+  800cf5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cf7:	85 c0                	test   %eax,%eax
+  800cf9:	7f 08                	jg     800d03 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfe:	5b                   	pop    %ebx
+  800cff:	5e                   	pop    %esi
+  800d00:	5f                   	pop    %edi
+  800d01:	5d                   	pop    %ebp
+  800d02:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d03:	83 ec 0c             	sub    $0xc,%esp
+  800d06:	50                   	push   %eax
+  800d07:	6a 08                	push   $0x8
+  800d09:	68 1f 2e 80 00       	push   $0x802e1f
+  800d0e:	6a 23                	push   $0x23
+  800d10:	68 3c 2e 80 00       	push   $0x802e3c
+  800d15:	e8 6a 18 00 00       	call   802584 <_panic>
+
+00800d1a <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d1a:	55                   	push   %ebp
+  800d1b:	89 e5                	mov    %esp,%ebp
+  800d1d:	57                   	push   %edi
+  800d1e:	56                   	push   %esi
+  800d1f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d26:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d2b:	be 00 00 00 00       	mov    $0x0,%esi
+  800d30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d33:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d36:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d38:	5b                   	pop    %ebx
+  800d39:	5e                   	pop    %esi
+  800d3a:	5f                   	pop    %edi
+  800d3b:	5d                   	pop    %ebp
+  800d3c:	c3                   	ret
+
+00800d3d <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d3d:	55                   	push   %ebp
+  800d3e:	89 e5                	mov    %esp,%ebp
+  800d40:	57                   	push   %edi
+  800d41:	56                   	push   %esi
+  800d42:	53                   	push   %ebx
+  800d43:	8b 45 18             	mov    0x18(%ebp),%eax
+  800d46:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800d49:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800d4e:	77 27                	ja     800d77 <sys_page_map_range+0x3a>
+  800d50:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800d56:	77 1f                	ja     800d77 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800d58:	c1 e0 0c             	shl    $0xc,%eax
+  800d5b:	89 c6                	mov    %eax,%esi
+  800d5d:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800d5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d65:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d6d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d70:	cd 30                	int    $0x30
+}
+  800d72:	5b                   	pop    %ebx
+  800d73:	5e                   	pop    %esi
+  800d74:	5f                   	pop    %edi
+  800d75:	5d                   	pop    %ebp
+  800d76:	c3                   	ret
+		return -E_INVAL;
+  800d77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d7c:	eb f4                	jmp    800d72 <sys_page_map_range+0x35>
+
+00800d7e <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	57                   	push   %edi
+  800d82:	56                   	push   %esi
+  800d83:	53                   	push   %ebx
+  800d84:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d92:	be 00 00 00 00       	mov    $0x0,%esi
+  800d97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d9d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d9f:	85 c0                	test   %eax,%eax
+  800da1:	7f 08                	jg     800dab <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800da3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da6:	5b                   	pop    %ebx
+  800da7:	5e                   	pop    %esi
+  800da8:	5f                   	pop    %edi
+  800da9:	5d                   	pop    %ebp
+  800daa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dab:	83 ec 0c             	sub    $0xc,%esp
+  800dae:	50                   	push   %eax
+  800daf:	6a 0c                	push   $0xc
+  800db1:	68 1f 2e 80 00       	push   $0x802e1f
+  800db6:	6a 23                	push   $0x23
+  800db8:	68 3c 2e 80 00       	push   $0x802e3c
+  800dbd:	e8 c2 17 00 00       	call   802584 <_panic>
+
+00800dc2 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	57                   	push   %edi
+  800dc6:	56                   	push   %esi
+  800dc7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dc8:	be 00 00 00 00       	mov    $0x0,%esi
+  800dcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddb:	89 f7                	mov    %esi,%edi
+  800ddd:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ddf:	5b                   	pop    %ebx
+  800de0:	5e                   	pop    %esi
+  800de1:	5f                   	pop    %edi
+  800de2:	5d                   	pop    %ebp
+  800de3:	c3                   	ret
+
+00800de4 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800de4:	55                   	push   %ebp
+  800de5:	89 e5                	mov    %esp,%ebp
+  800de7:	57                   	push   %edi
+  800de8:	56                   	push   %esi
+  800de9:	53                   	push   %ebx
+  800dea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ded:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dfd:	89 df                	mov    %ebx,%edi
+  800dff:	89 de                	mov    %ebx,%esi
+  800e01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e03:	85 c0                	test   %eax,%eax
+  800e05:	7f 08                	jg     800e0f <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0a:	5b                   	pop    %ebx
+  800e0b:	5e                   	pop    %esi
+  800e0c:	5f                   	pop    %edi
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0f:	83 ec 0c             	sub    $0xc,%esp
+  800e12:	50                   	push   %eax
+  800e13:	6a 0f                	push   $0xf
+  800e15:	68 1f 2e 80 00       	push   $0x802e1f
+  800e1a:	6a 23                	push   $0x23
+  800e1c:	68 3c 2e 80 00       	push   $0x802e3c
+  800e21:	e8 5e 17 00 00       	call   802584 <_panic>
+
+00800e26 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	57                   	push   %edi
+  800e2a:	56                   	push   %esi
+  800e2b:	53                   	push   %ebx
+  800e2c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3a:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e3f:	89 df                	mov    %ebx,%edi
+  800e41:	89 de                	mov    %ebx,%esi
+  800e43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e45:	85 c0                	test   %eax,%eax
+  800e47:	7f 08                	jg     800e51 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800e49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5e                   	pop    %esi
+  800e4e:	5f                   	pop    %edi
+  800e4f:	5d                   	pop    %ebp
+  800e50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e51:	83 ec 0c             	sub    $0xc,%esp
+  800e54:	50                   	push   %eax
+  800e55:	6a 10                	push   $0x10
+  800e57:	68 1f 2e 80 00       	push   $0x802e1f
+  800e5c:	6a 23                	push   $0x23
+  800e5e:	68 3c 2e 80 00       	push   $0x802e3c
+  800e63:	e8 1c 17 00 00       	call   802584 <_panic>
+
+00800e68 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	57                   	push   %edi
+  800e6c:	56                   	push   %esi
+  800e6d:	53                   	push   %ebx
+  800e6e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e81:	89 df                	mov    %ebx,%edi
+  800e83:	89 de                	mov    %ebx,%esi
+  800e85:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e87:	85 c0                	test   %eax,%eax
+  800e89:	7f 08                	jg     800e93 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800e8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8e:	5b                   	pop    %ebx
+  800e8f:	5e                   	pop    %esi
+  800e90:	5f                   	pop    %edi
+  800e91:	5d                   	pop    %ebp
+  800e92:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e93:	83 ec 0c             	sub    $0xc,%esp
+  800e96:	50                   	push   %eax
+  800e97:	6a 11                	push   $0x11
+  800e99:	68 1f 2e 80 00       	push   $0x802e1f
+  800e9e:	6a 23                	push   $0x23
+  800ea0:	68 3c 2e 80 00       	push   $0x802e3c
+  800ea5:	e8 da 16 00 00       	call   802584 <_panic>
+
+00800eaa <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800eaa:	55                   	push   %ebp
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	57                   	push   %edi
+  800eae:	56                   	push   %esi
+  800eaf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb5:	b8 12 00 00 00       	mov    $0x12,%eax
+  800eba:	89 d1                	mov    %edx,%ecx
+  800ebc:	89 d3                	mov    %edx,%ebx
+  800ebe:	89 d7                	mov    %edx,%edi
+  800ec0:	89 d6                	mov    %edx,%esi
+  800ec2:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800ec4:	5b                   	pop    %ebx
+  800ec5:	5e                   	pop    %esi
+  800ec6:	5f                   	pop    %edi
+  800ec7:	5d                   	pop    %ebp
+  800ec8:	c3                   	ret
+
+00800ec9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ec9:	55                   	push   %ebp
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	57                   	push   %edi
+  800ecd:	56                   	push   %esi
+  800ece:	53                   	push   %ebx
+  800ecf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edd:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ee2:	89 df                	mov    %ebx,%edi
+  800ee4:	89 de                	mov    %ebx,%esi
+  800ee6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee8:	85 c0                	test   %eax,%eax
+  800eea:	7f 08                	jg     800ef4 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800eec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef4:	83 ec 0c             	sub    $0xc,%esp
+  800ef7:	50                   	push   %eax
+  800ef8:	6a 13                	push   $0x13
+  800efa:	68 1f 2e 80 00       	push   $0x802e1f
+  800eff:	6a 23                	push   $0x23
+  800f01:	68 3c 2e 80 00       	push   $0x802e3c
+  800f06:	e8 79 16 00 00       	call   802584 <_panic>
+
+00800f0b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f0b:	55                   	push   %ebp
+  800f0c:	89 e5                	mov    %esp,%ebp
+  800f0e:	57                   	push   %edi
+  800f0f:	56                   	push   %esi
+  800f10:	53                   	push   %ebx
+  800f11:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f24:	89 df                	mov    %ebx,%edi
+  800f26:	89 de                	mov    %ebx,%esi
+  800f28:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f2a:	85 c0                	test   %eax,%eax
+  800f2c:	7f 08                	jg     800f36 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f31:	5b                   	pop    %ebx
+  800f32:	5e                   	pop    %esi
+  800f33:	5f                   	pop    %edi
+  800f34:	5d                   	pop    %ebp
+  800f35:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f36:	83 ec 0c             	sub    $0xc,%esp
+  800f39:	50                   	push   %eax
+  800f3a:	6a 14                	push   $0x14
+  800f3c:	68 1f 2e 80 00       	push   $0x802e1f
+  800f41:	6a 23                	push   $0x23
+  800f43:	68 3c 2e 80 00       	push   $0x802e3c
+  800f48:	e8 37 16 00 00       	call   802584 <_panic>
+
+00800f4d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f4d:	55                   	push   %ebp
+  800f4e:	89 e5                	mov    %esp,%ebp
+  800f50:	57                   	push   %edi
+  800f51:	56                   	push   %esi
+  800f52:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f59:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f5e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f66:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f69:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f6b:	5b                   	pop    %ebx
+  800f6c:	5e                   	pop    %esi
+  800f6d:	5f                   	pop    %edi
+  800f6e:	5d                   	pop    %ebp
+  800f6f:	c3                   	ret
+
+00800f70 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	57                   	push   %edi
+  800f74:	56                   	push   %esi
+  800f75:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7c:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f81:	be 00 00 00 00       	mov    $0x0,%esi
+  800f86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f89:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f8c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f8e:	5b                   	pop    %ebx
+  800f8f:	5e                   	pop    %esi
+  800f90:	5f                   	pop    %edi
+  800f91:	5d                   	pop    %ebp
+  800f92:	c3                   	ret
+
+00800f93 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f93:	55                   	push   %ebp
+  800f94:	89 e5                	mov    %esp,%ebp
+  800f96:	57                   	push   %edi
+  800f97:	56                   	push   %esi
+  800f98:	53                   	push   %ebx
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa4:	b8 19 00 00 00       	mov    $0x19,%eax
+  800fa9:	89 cb                	mov    %ecx,%ebx
+  800fab:	89 cf                	mov    %ecx,%edi
+  800fad:	89 ce                	mov    %ecx,%esi
+  800faf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb1:	85 c0                	test   %eax,%eax
+  800fb3:	7f 08                	jg     800fbd <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800fb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb8:	5b                   	pop    %ebx
+  800fb9:	5e                   	pop    %esi
+  800fba:	5f                   	pop    %edi
+  800fbb:	5d                   	pop    %ebp
+  800fbc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fbd:	83 ec 0c             	sub    $0xc,%esp
+  800fc0:	50                   	push   %eax
+  800fc1:	6a 19                	push   $0x19
+  800fc3:	68 1f 2e 80 00       	push   $0x802e1f
+  800fc8:	6a 23                	push   $0x23
+  800fca:	68 3c 2e 80 00       	push   $0x802e3c
+  800fcf:	e8 b0 15 00 00       	call   802584 <_panic>
+
+00800fd4 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fd4:	55                   	push   %ebp
+  800fd5:	89 e5                	mov    %esp,%ebp
+  800fd7:	57                   	push   %edi
+  800fd8:	56                   	push   %esi
+  800fd9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fdf:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fe4:	89 d1                	mov    %edx,%ecx
+  800fe6:	89 d3                	mov    %edx,%ebx
+  800fe8:	89 d7                	mov    %edx,%edi
+  800fea:	89 d6                	mov    %edx,%esi
+  800fec:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fee:	5b                   	pop    %ebx
+  800fef:	5e                   	pop    %esi
+  800ff0:	5f                   	pop    %edi
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	c3                   	ret
+
+00800ff3 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	57                   	push   %edi
+  800ff7:	56                   	push   %esi
+  800ff8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801001:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801004:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801009:	89 df                	mov    %ebx,%edi
+  80100b:	89 de                	mov    %ebx,%esi
+  80100d:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  80100f:	5b                   	pop    %ebx
+  801010:	5e                   	pop    %esi
+  801011:	5f                   	pop    %edi
+  801012:	5d                   	pop    %ebp
+  801013:	c3                   	ret
+
+00801014 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	57                   	push   %edi
+  801018:	56                   	push   %esi
+  801019:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801025:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80102a:	89 df                	mov    %ebx,%edi
+  80102c:	89 de                	mov    %ebx,%esi
+  80102e:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801030:	5b                   	pop    %ebx
+  801031:	5e                   	pop    %esi
+  801032:	5f                   	pop    %edi
+  801033:	5d                   	pop    %ebp
+  801034:	c3                   	ret
+
+00801035 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	53                   	push   %ebx
+  801039:	83 ec 04             	sub    $0x4,%esp
+  80103c:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80103f:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  801041:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  801044:	f6 c2 02             	test   $0x2,%dl
+  801047:	74 7b                	je     8010c4 <pgfault+0x8f>
+  801049:	89 c1                	mov    %eax,%ecx
+  80104b:	c1 e9 0c             	shr    $0xc,%ecx
+  80104e:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  801055:	f6 c5 08             	test   $0x8,%ch
+  801058:	74 6a                	je     8010c4 <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80105a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80105f:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801061:	83 ec 04             	sub    $0x4,%esp
+  801064:	6a 07                	push   $0x7
+  801066:	68 00 f0 7f 00       	push   $0x7ff000
+  80106b:	6a 00                	push   $0x0
+  80106d:	e8 9e fb ff ff       	call   800c10 <sys_page_alloc>
+  801072:	83 c4 10             	add    $0x10,%esp
+  801075:	85 c0                	test   %eax,%eax
+  801077:	78 61                	js     8010da <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  801079:	83 ec 04             	sub    $0x4,%esp
+  80107c:	68 00 10 00 00       	push   $0x1000
+  801081:	53                   	push   %ebx
+  801082:	68 00 f0 7f 00       	push   $0x7ff000
+  801087:	e8 9d f8 ff ff       	call   800929 <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  80108c:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801093:	53                   	push   %ebx
+  801094:	6a 00                	push   $0x0
+  801096:	68 00 f0 7f 00       	push   $0x7ff000
+  80109b:	6a 00                	push   $0x0
+  80109d:	e8 f4 fb ff ff       	call   800c96 <sys_page_map>
+  8010a2:	83 c4 20             	add    $0x20,%esp
+  8010a5:	85 c0                	test   %eax,%eax
+  8010a7:	78 43                	js     8010ec <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  8010a9:	83 ec 08             	sub    $0x8,%esp
+  8010ac:	68 00 f0 7f 00       	push   $0x7ff000
+  8010b1:	6a 00                	push   $0x0
+  8010b3:	e8 20 fc ff ff       	call   800cd8 <sys_page_unmap>
+  8010b8:	83 c4 10             	add    $0x10,%esp
+  8010bb:	85 c0                	test   %eax,%eax
+  8010bd:	78 3f                	js     8010fe <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  8010bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010c2:	c9                   	leave
+  8010c3:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  8010c4:	83 ec 0c             	sub    $0xc,%esp
+  8010c7:	50                   	push   %eax
+  8010c8:	52                   	push   %edx
+  8010c9:	68 4a 2e 80 00       	push   $0x802e4a
+  8010ce:	6a 19                	push   $0x19
+  8010d0:	68 5b 2e 80 00       	push   $0x802e5b
+  8010d5:	e8 aa 14 00 00       	call   802584 <_panic>
+		panic("sys_page_alloc: %e", r);
+  8010da:	50                   	push   %eax
+  8010db:	68 66 2e 80 00       	push   $0x802e66
+  8010e0:	6a 24                	push   $0x24
+  8010e2:	68 5b 2e 80 00       	push   $0x802e5b
+  8010e7:	e8 98 14 00 00       	call   802584 <_panic>
+		panic("sys_page_map: %e", r);
+  8010ec:	50                   	push   %eax
+  8010ed:	68 79 2e 80 00       	push   $0x802e79
+  8010f2:	6a 29                	push   $0x29
+  8010f4:	68 5b 2e 80 00       	push   $0x802e5b
+  8010f9:	e8 86 14 00 00       	call   802584 <_panic>
+		panic("sys_page_unmap: %e", r);
+  8010fe:	50                   	push   %eax
+  8010ff:	68 8a 2e 80 00       	push   $0x802e8a
+  801104:	6a 2c                	push   $0x2c
+  801106:	68 5b 2e 80 00       	push   $0x802e5b
+  80110b:	e8 74 14 00 00       	call   802584 <_panic>
+
+00801110 <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	57                   	push   %edi
+  801114:	56                   	push   %esi
+  801115:	53                   	push   %ebx
+  801116:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801119:	68 35 10 80 00       	push   $0x801035
+  80111e:	e8 a7 14 00 00       	call   8025ca <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  801123:	83 c4 08             	add    $0x8,%esp
+  801126:	6a 01                	push   $0x1
+  801128:	6a 00                	push   $0x0
+  80112a:	e8 9f fa ff ff       	call   800bce <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  80112f:	e8 7b fa ff ff       	call   800baf <sys_fork_cow>
+  801134:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  801137:	83 c4 10             	add    $0x10,%esp
+  80113a:	85 c0                	test   %eax,%eax
+  80113c:	74 2c                	je     80116a <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  80113e:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  801142:	0f 85 8b 01 00 00    	jne    8012d3 <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801148:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80114d:	cd 30                	int    $0x30
+  80114f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  801152:	85 c0                	test   %eax,%eax
+  801154:	78 30                	js     801186 <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  801156:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80115b:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  801160:	74 36                	je     801198 <fork+0x88>
+  801162:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801165:	e9 99 00 00 00       	jmp    801203 <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80116a:	e8 02 fa ff ff       	call   800b71 <sys_getenvid>
+  80116f:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801174:	c1 e0 09             	shl    $0x9,%eax
+  801177:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80117c:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801181:	e9 4d 01 00 00       	jmp    8012d3 <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  801186:	50                   	push   %eax
+  801187:	68 9d 2e 80 00       	push   $0x802e9d
+  80118c:	6a 7d                	push   $0x7d
+  80118e:	68 5b 2e 80 00       	push   $0x802e5b
+  801193:	e8 ec 13 00 00       	call   802584 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801198:	e8 d4 f9 ff ff       	call   800b71 <sys_getenvid>
+  80119d:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8011a2:	c1 e0 09             	shl    $0x9,%eax
+  8011a5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8011aa:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  8011af:	e9 1f 01 00 00       	jmp    8012d3 <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  8011b4:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8011bb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8011be:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011c3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8011c6:	83 ec 0c             	sub    $0xc,%esp
+  8011c9:	50                   	push   %eax
+  8011ca:	56                   	push   %esi
+  8011cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8011ce:	56                   	push   %esi
+  8011cf:	6a 00                	push   $0x0
+  8011d1:	e8 c0 fa ff ff       	call   800c96 <sys_page_map>
+  8011d6:	83 c4 20             	add    $0x20,%esp
+  8011d9:	85 c0                	test   %eax,%eax
+  8011db:	0f 88 98 00 00 00    	js     801279 <fork+0x169>
+	if (perm & PTE_COW) {
+  8011e1:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  8011e8:	0f 85 61 01 00 00    	jne    80134f <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8011ee:	83 c7 01             	add    $0x1,%edi
+  8011f1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8011f7:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  8011fd:	0f 84 88 00 00 00    	je     80128b <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  801203:	89 f0                	mov    %esi,%eax
+  801205:	c1 e8 16             	shr    $0x16,%eax
+  801208:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80120f:	25 81 00 00 00       	and    $0x81,%eax
+  801214:	83 f8 01             	cmp    $0x1,%eax
+  801217:	75 d5                	jne    8011ee <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  801219:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  801220:	a8 01                	test   $0x1,%al
+  801222:	74 ca                	je     8011ee <fork+0xde>
+  801224:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  80122a:	74 c2                	je     8011ee <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  80122c:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  80122e:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801235:	f6 c4 04             	test   $0x4,%ah
+  801238:	0f 85 76 ff ff ff    	jne    8011b4 <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  80123e:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801245:	a8 02                	test   $0x2,%al
+  801247:	0f 85 dc 00 00 00    	jne    801329 <fork+0x219>
+  80124d:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801254:	f6 c4 08             	test   $0x8,%ah
+  801257:	0f 85 cc 00 00 00    	jne    801329 <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  80125d:	83 ec 0c             	sub    $0xc,%esp
+  801260:	6a 05                	push   $0x5
+  801262:	56                   	push   %esi
+  801263:	ff 75 e4             	push   -0x1c(%ebp)
+  801266:	56                   	push   %esi
+  801267:	6a 00                	push   $0x0
+  801269:	e8 28 fa ff ff       	call   800c96 <sys_page_map>
+  80126e:	83 c4 20             	add    $0x20,%esp
+  801271:	85 c0                	test   %eax,%eax
+  801273:	0f 89 75 ff ff ff    	jns    8011ee <fork+0xde>
+		panic("sys_page_map: %e", r);
+  801279:	50                   	push   %eax
+  80127a:	68 79 2e 80 00       	push   $0x802e79
+  80127f:	6a 48                	push   $0x48
+  801281:	68 5b 2e 80 00       	push   $0x802e5b
+  801286:	e8 f9 12 00 00       	call   802584 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  80128b:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80128e:	83 ec 04             	sub    $0x4,%esp
+  801291:	6a 07                	push   $0x7
+  801293:	68 00 f0 bf ee       	push   $0xeebff000
+  801298:	53                   	push   %ebx
+  801299:	e8 72 f9 ff ff       	call   800c10 <sys_page_alloc>
+  80129e:	83 c4 10             	add    $0x10,%esp
+  8012a1:	85 c0                	test   %eax,%eax
+  8012a3:	78 39                	js     8012de <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8012a5:	a1 08 50 80 00       	mov    0x805008,%eax
+  8012aa:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  8012b0:	83 ec 08             	sub    $0x8,%esp
+  8012b3:	50                   	push   %eax
+  8012b4:	53                   	push   %ebx
+  8012b5:	e8 51 fc ff ff       	call   800f0b <sys_env_set_pgfault_upcall>
+  8012ba:	83 c4 10             	add    $0x10,%esp
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	78 36                	js     8012f7 <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8012c1:	83 ec 08             	sub    $0x8,%esp
+  8012c4:	6a 02                	push   $0x2
+  8012c6:	53                   	push   %ebx
+  8012c7:	e8 18 fb ff ff       	call   800de4 <sys_env_set_status>
+  8012cc:	83 c4 10             	add    $0x10,%esp
+  8012cf:	85 c0                	test   %eax,%eax
+  8012d1:	78 3d                	js     801310 <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  8012d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d9:	5b                   	pop    %ebx
+  8012da:	5e                   	pop    %esi
+  8012db:	5f                   	pop    %edi
+  8012dc:	5d                   	pop    %ebp
+  8012dd:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  8012de:	83 ec 0c             	sub    $0xc,%esp
+  8012e1:	53                   	push   %ebx
+  8012e2:	50                   	push   %eax
+  8012e3:	68 c4 2e 80 00       	push   $0x802ec4
+  8012e8:	68 92 00 00 00       	push   $0x92
+  8012ed:	68 5b 2e 80 00       	push   $0x802e5b
+  8012f2:	e8 8d 12 00 00       	call   802584 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  8012f7:	83 ec 0c             	sub    $0xc,%esp
+  8012fa:	53                   	push   %ebx
+  8012fb:	50                   	push   %eax
+  8012fc:	68 e8 2e 80 00       	push   $0x802ee8
+  801301:	68 95 00 00 00       	push   $0x95
+  801306:	68 5b 2e 80 00       	push   $0x802e5b
+  80130b:	e8 74 12 00 00       	call   802584 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  801310:	83 ec 0c             	sub    $0xc,%esp
+  801313:	53                   	push   %ebx
+  801314:	50                   	push   %eax
+  801315:	68 18 2f 80 00       	push   $0x802f18
+  80131a:	68 98 00 00 00       	push   $0x98
+  80131f:	68 5b 2e 80 00       	push   $0x802e5b
+  801324:	e8 5b 12 00 00       	call   802584 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801329:	83 ec 0c             	sub    $0xc,%esp
+  80132c:	68 05 08 00 00       	push   $0x805
+  801331:	53                   	push   %ebx
+  801332:	ff 75 e4             	push   -0x1c(%ebp)
+  801335:	53                   	push   %ebx
+  801336:	6a 00                	push   $0x0
+  801338:	e8 59 f9 ff ff       	call   800c96 <sys_page_map>
+  80133d:	83 c4 20             	add    $0x20,%esp
+  801340:	85 c0                	test   %eax,%eax
+  801342:	0f 88 31 ff ff ff    	js     801279 <fork+0x169>
+		perm |= PTE_COW;
+  801348:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  80134f:	83 ec 0c             	sub    $0xc,%esp
+  801352:	ff 75 e0             	push   -0x20(%ebp)
+  801355:	53                   	push   %ebx
+  801356:	6a 00                	push   $0x0
+  801358:	53                   	push   %ebx
+  801359:	6a 00                	push   $0x0
+  80135b:	e8 36 f9 ff ff       	call   800c96 <sys_page_map>
+  801360:	83 c4 20             	add    $0x20,%esp
+  801363:	85 c0                	test   %eax,%eax
+  801365:	0f 89 83 fe ff ff    	jns    8011ee <fork+0xde>
+			panic("sys_page_map: %e", r);
+  80136b:	50                   	push   %eax
+  80136c:	68 79 2e 80 00       	push   $0x802e79
+  801371:	6a 4c                	push   $0x4c
+  801373:	68 5b 2e 80 00       	push   $0x802e5b
+  801378:	e8 07 12 00 00       	call   802584 <_panic>
+
+0080137d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80137d:	55                   	push   %ebp
+  80137e:	89 e5                	mov    %esp,%ebp
+  801380:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801383:	68 ad 2e 80 00       	push   $0x802ead
+  801388:	68 a0 00 00 00       	push   $0xa0
+  80138d:	68 5b 2e 80 00       	push   $0x802e5b
+  801392:	e8 ed 11 00 00       	call   802584 <_panic>
+
+00801397 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801397:	55                   	push   %ebp
+  801398:	89 e5                	mov    %esp,%ebp
+  80139a:	57                   	push   %edi
+  80139b:	56                   	push   %esi
+  80139c:	53                   	push   %ebx
+  80139d:	83 ec 18             	sub    $0x18,%esp
+  8013a0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8013a6:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8013a9:	85 db                	test   %ebx,%ebx
+  8013ab:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8013b0:	0f 45 c3             	cmovne %ebx,%eax
+  8013b3:	50                   	push   %eax
+  8013b4:	e8 da fb ff ff       	call   800f93 <sys_ipc_recv>
+
+	if (from_env_store)
+  8013b9:	83 c4 10             	add    $0x10,%esp
+  8013bc:	85 ff                	test   %edi,%edi
+  8013be:	74 17                	je     8013d7 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8013c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c5:	85 c0                	test   %eax,%eax
+  8013c7:	75 0c                	jne    8013d5 <ipc_recv+0x3e>
+  8013c9:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8013cf:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8013d5:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8013d7:	85 f6                	test   %esi,%esi
+  8013d9:	74 2e                	je     801409 <ipc_recv+0x72>
+		if (!r && pg)
+  8013db:	85 c0                	test   %eax,%eax
+  8013dd:	75 24                	jne    801403 <ipc_recv+0x6c>
+  8013df:	85 db                	test   %ebx,%ebx
+  8013e1:	74 20                	je     801403 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8013e3:	a1 08 50 80 00       	mov    0x805008,%eax
+  8013e8:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8013ee:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8013f0:	a1 08 50 80 00       	mov    0x805008,%eax
+  8013f5:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  8013fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fe:	5b                   	pop    %ebx
+  8013ff:	5e                   	pop    %esi
+  801400:	5f                   	pop    %edi
+  801401:	5d                   	pop    %ebp
+  801402:	c3                   	ret
+			*perm_store = 0;
+  801403:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  801409:	85 c0                	test   %eax,%eax
+  80140b:	75 ee                	jne    8013fb <ipc_recv+0x64>
+  80140d:	eb e1                	jmp    8013f0 <ipc_recv+0x59>
+
+0080140f <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80140f:	55                   	push   %ebp
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	57                   	push   %edi
+  801413:	56                   	push   %esi
+  801414:	53                   	push   %ebx
+  801415:	83 ec 0c             	sub    $0xc,%esp
+  801418:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80141b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80141e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  801421:	85 db                	test   %ebx,%ebx
+  801423:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801428:	0f 44 d8             	cmove  %eax,%ebx
+  80142b:	ff 75 14             	push   0x14(%ebp)
+  80142e:	53                   	push   %ebx
+  80142f:	56                   	push   %esi
+  801430:	57                   	push   %edi
+  801431:	e8 3a fb ff ff       	call   800f70 <sys_ipc_try_send_yield>
+  801436:	83 c4 10             	add    $0x10,%esp
+  801439:	85 c0                	test   %eax,%eax
+  80143b:	79 1e                	jns    80145b <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80143d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801440:	75 07                	jne    801449 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  801442:	e8 49 f7 ff ff       	call   800b90 <sys_yield>
+  801447:	eb e2                	jmp    80142b <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  801449:	50                   	push   %eax
+  80144a:	68 3e 2f 80 00       	push   $0x802f3e
+  80144f:	6a 3d                	push   $0x3d
+  801451:	68 53 2f 80 00       	push   $0x802f53
+  801456:	e8 29 11 00 00       	call   802584 <_panic>
+	}
+}
+  80145b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145e:	5b                   	pop    %ebx
+  80145f:	5e                   	pop    %esi
+  801460:	5f                   	pop    %edi
+  801461:	5d                   	pop    %ebp
+  801462:	c3                   	ret
+
+00801463 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801463:	55                   	push   %ebp
+  801464:	89 e5                	mov    %esp,%ebp
+  801466:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  801469:	ff 75 08             	push   0x8(%ebp)
+  80146c:	e8 9f f6 ff ff       	call   800b10 <sys_env_find>
+}
+  801471:	c9                   	leave
+  801472:	c3                   	ret
+
+00801473 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801473:	55                   	push   %ebp
+  801474:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801476:	8b 45 08             	mov    0x8(%ebp),%eax
+  801479:	05 00 00 00 30       	add    $0x30000000,%eax
+  80147e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801481:	5d                   	pop    %ebp
+  801482:	c3                   	ret
+
+00801483 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801483:	55                   	push   %ebp
+  801484:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801486:	8b 45 08             	mov    0x8(%ebp),%eax
+  801489:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80148e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801493:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801498:	5d                   	pop    %ebp
+  801499:	c3                   	ret
+
+0080149a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80149a:	55                   	push   %ebp
+  80149b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80149d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8014a2:	eb 02                	jmp    8014a6 <fd_alloc+0xc>
+  8014a4:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014a6:	89 c2                	mov    %eax,%edx
+  8014a8:	c1 ea 16             	shr    $0x16,%edx
+  8014ab:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014b2:	f6 c2 01             	test   $0x1,%dl
+  8014b5:	74 2b                	je     8014e2 <fd_alloc+0x48>
+  8014b7:	89 c2                	mov    %eax,%edx
+  8014b9:	c1 ea 0c             	shr    $0xc,%edx
+  8014bc:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8014c3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8014c9:	f6 c1 01             	test   $0x1,%cl
+  8014cc:	74 14                	je     8014e2 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8014ce:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8014d4:	75 ce                	jne    8014a4 <fd_alloc+0xa>
+  8014d6:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8014db:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8014e0:	eb 05                	jmp    8014e7 <fd_alloc+0x4d>
+			return 0;
+  8014e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8014e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ea:	89 02                	mov    %eax,(%edx)
+}
+  8014ec:	89 c8                	mov    %ecx,%eax
+  8014ee:	5d                   	pop    %ebp
+  8014ef:	c3                   	ret
+
+008014f0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8014f0:	55                   	push   %ebp
+  8014f1:	89 e5                	mov    %esp,%ebp
+  8014f3:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8014f6:	83 f8 1f             	cmp    $0x1f,%eax
+  8014f9:	77 30                	ja     80152b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8014fb:	c1 e0 0c             	shl    $0xc,%eax
+  8014fe:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801503:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801509:	f6 c2 01             	test   $0x1,%dl
+  80150c:	74 24                	je     801532 <fd_lookup+0x42>
+  80150e:	89 c2                	mov    %eax,%edx
+  801510:	c1 ea 0c             	shr    $0xc,%edx
+  801513:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80151a:	f6 c2 01             	test   $0x1,%dl
+  80151d:	74 1a                	je     801539 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80151f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801522:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801524:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801529:	5d                   	pop    %ebp
+  80152a:	c3                   	ret
+		return -E_INVAL;
+  80152b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801530:	eb f7                	jmp    801529 <fd_lookup+0x39>
+		return -E_INVAL;
+  801532:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801537:	eb f0                	jmp    801529 <fd_lookup+0x39>
+  801539:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80153e:	eb e9                	jmp    801529 <fd_lookup+0x39>
+
+00801540 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	53                   	push   %ebx
+  801544:	83 ec 04             	sub    $0x4,%esp
+  801547:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80154a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154f:	eb 03                	jmp    801554 <dev_lookup+0x14>
+  801551:	83 c0 01             	add    $0x1,%eax
+  801554:	8b 1c 85 dc 2f 80 00 	mov    0x802fdc(,%eax,4),%ebx
+  80155b:	85 db                	test   %ebx,%ebx
+  80155d:	74 0b                	je     80156a <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80155f:	39 13                	cmp    %edx,(%ebx)
+  801561:	75 ee                	jne    801551 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801563:	b8 00 00 00 00       	mov    $0x0,%eax
+  801568:	eb 1f                	jmp    801589 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80156a:	a1 08 50 80 00       	mov    0x805008,%eax
+  80156f:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801572:	83 ec 04             	sub    $0x4,%esp
+  801575:	52                   	push   %edx
+  801576:	50                   	push   %eax
+  801577:	68 60 2f 80 00       	push   $0x802f60
+  80157c:	e8 34 ec ff ff       	call   8001b5 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801581:	83 c4 10             	add    $0x10,%esp
+  801584:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801589:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80158c:	89 1a                	mov    %ebx,(%edx)
+}
+  80158e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801591:	c9                   	leave
+  801592:	c3                   	ret
+
+00801593 <fd_close>:
+{
+  801593:	55                   	push   %ebp
+  801594:	89 e5                	mov    %esp,%ebp
+  801596:	57                   	push   %edi
+  801597:	56                   	push   %esi
+  801598:	53                   	push   %ebx
+  801599:	83 ec 24             	sub    $0x24,%esp
+  80159c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80159f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015a2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015a5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015a6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8015ac:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015af:	50                   	push   %eax
+  8015b0:	e8 3b ff ff ff       	call   8014f0 <fd_lookup>
+  8015b5:	89 c3                	mov    %eax,%ebx
+  8015b7:	83 c4 10             	add    $0x10,%esp
+  8015ba:	85 c0                	test   %eax,%eax
+  8015bc:	78 05                	js     8015c3 <fd_close+0x30>
+	    || fd != fd2)
+  8015be:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8015c1:	74 16                	je     8015d9 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8015c3:	89 f8                	mov    %edi,%eax
+  8015c5:	84 c0                	test   %al,%al
+  8015c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cc:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8015cf:	89 d8                	mov    %ebx,%eax
+  8015d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d4:	5b                   	pop    %ebx
+  8015d5:	5e                   	pop    %esi
+  8015d6:	5f                   	pop    %edi
+  8015d7:	5d                   	pop    %ebp
+  8015d8:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8015d9:	83 ec 08             	sub    $0x8,%esp
+  8015dc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8015df:	50                   	push   %eax
+  8015e0:	ff 36                	push   (%esi)
+  8015e2:	e8 59 ff ff ff       	call   801540 <dev_lookup>
+  8015e7:	89 c3                	mov    %eax,%ebx
+  8015e9:	83 c4 10             	add    $0x10,%esp
+  8015ec:	85 c0                	test   %eax,%eax
+  8015ee:	78 1a                	js     80160a <fd_close+0x77>
+		if (dev->dev_close)
+  8015f0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015f3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8015f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8015fb:	85 c0                	test   %eax,%eax
+  8015fd:	74 0b                	je     80160a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8015ff:	83 ec 0c             	sub    $0xc,%esp
+  801602:	56                   	push   %esi
+  801603:	ff d0                	call   *%eax
+  801605:	89 c3                	mov    %eax,%ebx
+  801607:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80160a:	83 ec 08             	sub    $0x8,%esp
+  80160d:	56                   	push   %esi
+  80160e:	6a 00                	push   $0x0
+  801610:	e8 c3 f6 ff ff       	call   800cd8 <sys_page_unmap>
+	return r;
+  801615:	83 c4 10             	add    $0x10,%esp
+  801618:	eb b5                	jmp    8015cf <fd_close+0x3c>
+
+0080161a <close>:
+
+int
+close(int fdnum)
+{
+  80161a:	55                   	push   %ebp
+  80161b:	89 e5                	mov    %esp,%ebp
+  80161d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801620:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801623:	50                   	push   %eax
+  801624:	ff 75 08             	push   0x8(%ebp)
+  801627:	e8 c4 fe ff ff       	call   8014f0 <fd_lookup>
+  80162c:	83 c4 10             	add    $0x10,%esp
+  80162f:	85 c0                	test   %eax,%eax
+  801631:	79 02                	jns    801635 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801633:	c9                   	leave
+  801634:	c3                   	ret
+		return fd_close(fd, 1);
+  801635:	83 ec 08             	sub    $0x8,%esp
+  801638:	6a 01                	push   $0x1
+  80163a:	ff 75 f4             	push   -0xc(%ebp)
+  80163d:	e8 51 ff ff ff       	call   801593 <fd_close>
+  801642:	83 c4 10             	add    $0x10,%esp
+  801645:	eb ec                	jmp    801633 <close+0x19>
+
+00801647 <close_all>:
+
+void
+close_all(void)
+{
+  801647:	55                   	push   %ebp
+  801648:	89 e5                	mov    %esp,%ebp
+  80164a:	53                   	push   %ebx
+  80164b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80164e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801653:	83 ec 0c             	sub    $0xc,%esp
+  801656:	53                   	push   %ebx
+  801657:	e8 be ff ff ff       	call   80161a <close>
+	for (i = 0; i < MAXFD; i++)
+  80165c:	83 c3 01             	add    $0x1,%ebx
+  80165f:	83 c4 10             	add    $0x10,%esp
+  801662:	83 fb 20             	cmp    $0x20,%ebx
+  801665:	75 ec                	jne    801653 <close_all+0xc>
+}
+  801667:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80166a:	c9                   	leave
+  80166b:	c3                   	ret
+
+0080166c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80166c:	55                   	push   %ebp
+  80166d:	89 e5                	mov    %esp,%ebp
+  80166f:	57                   	push   %edi
+  801670:	56                   	push   %esi
+  801671:	53                   	push   %ebx
+  801672:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801675:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801678:	50                   	push   %eax
+  801679:	ff 75 08             	push   0x8(%ebp)
+  80167c:	e8 6f fe ff ff       	call   8014f0 <fd_lookup>
+  801681:	89 c3                	mov    %eax,%ebx
+  801683:	83 c4 10             	add    $0x10,%esp
+  801686:	85 c0                	test   %eax,%eax
+  801688:	78 7f                	js     801709 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80168a:	83 ec 0c             	sub    $0xc,%esp
+  80168d:	ff 75 0c             	push   0xc(%ebp)
+  801690:	e8 85 ff ff ff       	call   80161a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801695:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801698:	c1 e6 0c             	shl    $0xc,%esi
+  80169b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8016a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016a4:	89 3c 24             	mov    %edi,(%esp)
+  8016a7:	e8 d7 fd ff ff       	call   801483 <fd2data>
+  8016ac:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8016ae:	89 34 24             	mov    %esi,(%esp)
+  8016b1:	e8 cd fd ff ff       	call   801483 <fd2data>
+  8016b6:	83 c4 10             	add    $0x10,%esp
+  8016b9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8016bc:	89 d8                	mov    %ebx,%eax
+  8016be:	c1 e8 16             	shr    $0x16,%eax
+  8016c1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016c8:	a8 01                	test   $0x1,%al
+  8016ca:	74 11                	je     8016dd <dup+0x71>
+  8016cc:	89 d8                	mov    %ebx,%eax
+  8016ce:	c1 e8 0c             	shr    $0xc,%eax
+  8016d1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016d8:	f6 c2 01             	test   $0x1,%dl
+  8016db:	75 36                	jne    801713 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8016dd:	89 f8                	mov    %edi,%eax
+  8016df:	c1 e8 0c             	shr    $0xc,%eax
+  8016e2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016e9:	83 ec 0c             	sub    $0xc,%esp
+  8016ec:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016f1:	50                   	push   %eax
+  8016f2:	56                   	push   %esi
+  8016f3:	6a 00                	push   $0x0
+  8016f5:	57                   	push   %edi
+  8016f6:	6a 00                	push   $0x0
+  8016f8:	e8 99 f5 ff ff       	call   800c96 <sys_page_map>
+  8016fd:	89 c3                	mov    %eax,%ebx
+  8016ff:	83 c4 20             	add    $0x20,%esp
+  801702:	85 c0                	test   %eax,%eax
+  801704:	78 33                	js     801739 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801706:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801709:	89 d8                	mov    %ebx,%eax
+  80170b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80170e:	5b                   	pop    %ebx
+  80170f:	5e                   	pop    %esi
+  801710:	5f                   	pop    %edi
+  801711:	5d                   	pop    %ebp
+  801712:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801713:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80171a:	83 ec 0c             	sub    $0xc,%esp
+  80171d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801722:	50                   	push   %eax
+  801723:	ff 75 d4             	push   -0x2c(%ebp)
+  801726:	6a 00                	push   $0x0
+  801728:	53                   	push   %ebx
+  801729:	6a 00                	push   $0x0
+  80172b:	e8 66 f5 ff ff       	call   800c96 <sys_page_map>
+  801730:	89 c3                	mov    %eax,%ebx
+  801732:	83 c4 20             	add    $0x20,%esp
+  801735:	85 c0                	test   %eax,%eax
+  801737:	79 a4                	jns    8016dd <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801739:	83 ec 08             	sub    $0x8,%esp
+  80173c:	56                   	push   %esi
+  80173d:	6a 00                	push   $0x0
+  80173f:	e8 94 f5 ff ff       	call   800cd8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801744:	83 c4 08             	add    $0x8,%esp
+  801747:	ff 75 d4             	push   -0x2c(%ebp)
+  80174a:	6a 00                	push   $0x0
+  80174c:	e8 87 f5 ff ff       	call   800cd8 <sys_page_unmap>
+	return r;
+  801751:	83 c4 10             	add    $0x10,%esp
+  801754:	eb b3                	jmp    801709 <dup+0x9d>
+
+00801756 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801756:	55                   	push   %ebp
+  801757:	89 e5                	mov    %esp,%ebp
+  801759:	56                   	push   %esi
+  80175a:	53                   	push   %ebx
+  80175b:	83 ec 18             	sub    $0x18,%esp
+  80175e:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801761:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801764:	50                   	push   %eax
+  801765:	56                   	push   %esi
+  801766:	e8 85 fd ff ff       	call   8014f0 <fd_lookup>
+  80176b:	83 c4 10             	add    $0x10,%esp
+  80176e:	85 c0                	test   %eax,%eax
+  801770:	78 3c                	js     8017ae <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801772:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801775:	83 ec 08             	sub    $0x8,%esp
+  801778:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80177b:	50                   	push   %eax
+  80177c:	ff 33                	push   (%ebx)
+  80177e:	e8 bd fd ff ff       	call   801540 <dev_lookup>
+  801783:	83 c4 10             	add    $0x10,%esp
+  801786:	85 c0                	test   %eax,%eax
+  801788:	78 24                	js     8017ae <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80178a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80178d:	83 e0 03             	and    $0x3,%eax
+  801790:	83 f8 01             	cmp    $0x1,%eax
+  801793:	74 20                	je     8017b5 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801798:	8b 40 08             	mov    0x8(%eax),%eax
+  80179b:	85 c0                	test   %eax,%eax
+  80179d:	74 37                	je     8017d6 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80179f:	83 ec 04             	sub    $0x4,%esp
+  8017a2:	ff 75 10             	push   0x10(%ebp)
+  8017a5:	ff 75 0c             	push   0xc(%ebp)
+  8017a8:	53                   	push   %ebx
+  8017a9:	ff d0                	call   *%eax
+  8017ab:	83 c4 10             	add    $0x10,%esp
+}
+  8017ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017b1:	5b                   	pop    %ebx
+  8017b2:	5e                   	pop    %esi
+  8017b3:	5d                   	pop    %ebp
+  8017b4:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017b5:	a1 08 50 80 00       	mov    0x805008,%eax
+  8017ba:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8017bd:	83 ec 04             	sub    $0x4,%esp
+  8017c0:	56                   	push   %esi
+  8017c1:	50                   	push   %eax
+  8017c2:	68 a1 2f 80 00       	push   $0x802fa1
+  8017c7:	e8 e9 e9 ff ff       	call   8001b5 <cprintf>
+		return -E_INVAL;
+  8017cc:	83 c4 10             	add    $0x10,%esp
+  8017cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d4:	eb d8                	jmp    8017ae <read+0x58>
+		return -E_NOT_SUPP;
+  8017d6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017db:	eb d1                	jmp    8017ae <read+0x58>
+
+008017dd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8017dd:	55                   	push   %ebp
+  8017de:	89 e5                	mov    %esp,%ebp
+  8017e0:	57                   	push   %edi
+  8017e1:	56                   	push   %esi
+  8017e2:	53                   	push   %ebx
+  8017e3:	83 ec 0c             	sub    $0xc,%esp
+  8017e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017e9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8017ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f1:	eb 02                	jmp    8017f5 <readn+0x18>
+  8017f3:	01 c3                	add    %eax,%ebx
+  8017f5:	39 f3                	cmp    %esi,%ebx
+  8017f7:	73 21                	jae    80181a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017f9:	83 ec 04             	sub    $0x4,%esp
+  8017fc:	89 f0                	mov    %esi,%eax
+  8017fe:	29 d8                	sub    %ebx,%eax
+  801800:	50                   	push   %eax
+  801801:	89 d8                	mov    %ebx,%eax
+  801803:	03 45 0c             	add    0xc(%ebp),%eax
+  801806:	50                   	push   %eax
+  801807:	57                   	push   %edi
+  801808:	e8 49 ff ff ff       	call   801756 <read>
+		if (m < 0)
+  80180d:	83 c4 10             	add    $0x10,%esp
+  801810:	85 c0                	test   %eax,%eax
+  801812:	78 04                	js     801818 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801814:	75 dd                	jne    8017f3 <readn+0x16>
+  801816:	eb 02                	jmp    80181a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801818:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80181a:	89 d8                	mov    %ebx,%eax
+  80181c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80181f:	5b                   	pop    %ebx
+  801820:	5e                   	pop    %esi
+  801821:	5f                   	pop    %edi
+  801822:	5d                   	pop    %ebp
+  801823:	c3                   	ret
+
+00801824 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801824:	55                   	push   %ebp
+  801825:	89 e5                	mov    %esp,%ebp
+  801827:	56                   	push   %esi
+  801828:	53                   	push   %ebx
+  801829:	83 ec 18             	sub    $0x18,%esp
+  80182c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80182f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801832:	50                   	push   %eax
+  801833:	53                   	push   %ebx
+  801834:	e8 b7 fc ff ff       	call   8014f0 <fd_lookup>
+  801839:	83 c4 10             	add    $0x10,%esp
+  80183c:	85 c0                	test   %eax,%eax
+  80183e:	78 37                	js     801877 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801840:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801843:	83 ec 08             	sub    $0x8,%esp
+  801846:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801849:	50                   	push   %eax
+  80184a:	ff 36                	push   (%esi)
+  80184c:	e8 ef fc ff ff       	call   801540 <dev_lookup>
+  801851:	83 c4 10             	add    $0x10,%esp
+  801854:	85 c0                	test   %eax,%eax
+  801856:	78 1f                	js     801877 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801858:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80185c:	74 20                	je     80187e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80185e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801861:	8b 40 0c             	mov    0xc(%eax),%eax
+  801864:	85 c0                	test   %eax,%eax
+  801866:	74 37                	je     80189f <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801868:	83 ec 04             	sub    $0x4,%esp
+  80186b:	ff 75 10             	push   0x10(%ebp)
+  80186e:	ff 75 0c             	push   0xc(%ebp)
+  801871:	56                   	push   %esi
+  801872:	ff d0                	call   *%eax
+  801874:	83 c4 10             	add    $0x10,%esp
+}
+  801877:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80187a:	5b                   	pop    %ebx
+  80187b:	5e                   	pop    %esi
+  80187c:	5d                   	pop    %ebp
+  80187d:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80187e:	a1 08 50 80 00       	mov    0x805008,%eax
+  801883:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801886:	83 ec 04             	sub    $0x4,%esp
+  801889:	53                   	push   %ebx
+  80188a:	50                   	push   %eax
+  80188b:	68 bd 2f 80 00       	push   $0x802fbd
+  801890:	e8 20 e9 ff ff       	call   8001b5 <cprintf>
+		return -E_INVAL;
+  801895:	83 c4 10             	add    $0x10,%esp
+  801898:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80189d:	eb d8                	jmp    801877 <write+0x53>
+		return -E_NOT_SUPP;
+  80189f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018a4:	eb d1                	jmp    801877 <write+0x53>
+
+008018a6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018af:	50                   	push   %eax
+  8018b0:	ff 75 08             	push   0x8(%ebp)
+  8018b3:	e8 38 fc ff ff       	call   8014f0 <fd_lookup>
+  8018b8:	83 c4 10             	add    $0x10,%esp
+  8018bb:	85 c0                	test   %eax,%eax
+  8018bd:	78 0e                	js     8018cd <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8018bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018c5:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8018c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018cd:	c9                   	leave
+  8018ce:	c3                   	ret
+
+008018cf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018cf:	55                   	push   %ebp
+  8018d0:	89 e5                	mov    %esp,%ebp
+  8018d2:	56                   	push   %esi
+  8018d3:	53                   	push   %ebx
+  8018d4:	83 ec 18             	sub    $0x18,%esp
+  8018d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018da:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018dd:	50                   	push   %eax
+  8018de:	53                   	push   %ebx
+  8018df:	e8 0c fc ff ff       	call   8014f0 <fd_lookup>
+  8018e4:	83 c4 10             	add    $0x10,%esp
+  8018e7:	85 c0                	test   %eax,%eax
+  8018e9:	78 34                	js     80191f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018eb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018ee:	83 ec 08             	sub    $0x8,%esp
+  8018f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018f4:	50                   	push   %eax
+  8018f5:	ff 36                	push   (%esi)
+  8018f7:	e8 44 fc ff ff       	call   801540 <dev_lookup>
+  8018fc:	83 c4 10             	add    $0x10,%esp
+  8018ff:	85 c0                	test   %eax,%eax
+  801901:	78 1c                	js     80191f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801903:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801907:	74 1d                	je     801926 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801909:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80190c:	8b 40 18             	mov    0x18(%eax),%eax
+  80190f:	85 c0                	test   %eax,%eax
+  801911:	74 34                	je     801947 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801913:	83 ec 08             	sub    $0x8,%esp
+  801916:	ff 75 0c             	push   0xc(%ebp)
+  801919:	56                   	push   %esi
+  80191a:	ff d0                	call   *%eax
+  80191c:	83 c4 10             	add    $0x10,%esp
+}
+  80191f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801922:	5b                   	pop    %ebx
+  801923:	5e                   	pop    %esi
+  801924:	5d                   	pop    %ebp
+  801925:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801926:	a1 08 50 80 00       	mov    0x805008,%eax
+  80192b:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80192e:	83 ec 04             	sub    $0x4,%esp
+  801931:	53                   	push   %ebx
+  801932:	50                   	push   %eax
+  801933:	68 80 2f 80 00       	push   $0x802f80
+  801938:	e8 78 e8 ff ff       	call   8001b5 <cprintf>
+		return -E_INVAL;
+  80193d:	83 c4 10             	add    $0x10,%esp
+  801940:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801945:	eb d8                	jmp    80191f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801947:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80194c:	eb d1                	jmp    80191f <ftruncate+0x50>
+
+0080194e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80194e:	55                   	push   %ebp
+  80194f:	89 e5                	mov    %esp,%ebp
+  801951:	56                   	push   %esi
+  801952:	53                   	push   %ebx
+  801953:	83 ec 18             	sub    $0x18,%esp
+  801956:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801959:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80195c:	50                   	push   %eax
+  80195d:	ff 75 08             	push   0x8(%ebp)
+  801960:	e8 8b fb ff ff       	call   8014f0 <fd_lookup>
+  801965:	83 c4 10             	add    $0x10,%esp
+  801968:	85 c0                	test   %eax,%eax
+  80196a:	78 49                	js     8019b5 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80196c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80196f:	83 ec 08             	sub    $0x8,%esp
+  801972:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801975:	50                   	push   %eax
+  801976:	ff 36                	push   (%esi)
+  801978:	e8 c3 fb ff ff       	call   801540 <dev_lookup>
+  80197d:	83 c4 10             	add    $0x10,%esp
+  801980:	85 c0                	test   %eax,%eax
+  801982:	78 31                	js     8019b5 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801984:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801987:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80198b:	74 2f                	je     8019bc <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80198d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801990:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801997:	00 00 00 
+	stat->st_isdir = 0;
+  80199a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019a1:	00 00 00 
+	stat->st_dev = dev;
+  8019a4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8019aa:	83 ec 08             	sub    $0x8,%esp
+  8019ad:	53                   	push   %ebx
+  8019ae:	56                   	push   %esi
+  8019af:	ff 50 14             	call   *0x14(%eax)
+  8019b2:	83 c4 10             	add    $0x10,%esp
+}
+  8019b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019b8:	5b                   	pop    %ebx
+  8019b9:	5e                   	pop    %esi
+  8019ba:	5d                   	pop    %ebp
+  8019bb:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019bc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019c1:	eb f2                	jmp    8019b5 <fstat+0x67>
+
+008019c3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019c3:	55                   	push   %ebp
+  8019c4:	89 e5                	mov    %esp,%ebp
+  8019c6:	56                   	push   %esi
+  8019c7:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8019c8:	83 ec 08             	sub    $0x8,%esp
+  8019cb:	6a 00                	push   $0x0
+  8019cd:	ff 75 08             	push   0x8(%ebp)
+  8019d0:	e8 e4 01 00 00       	call   801bb9 <open>
+  8019d5:	89 c3                	mov    %eax,%ebx
+  8019d7:	83 c4 10             	add    $0x10,%esp
+  8019da:	85 c0                	test   %eax,%eax
+  8019dc:	78 1b                	js     8019f9 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8019de:	83 ec 08             	sub    $0x8,%esp
+  8019e1:	ff 75 0c             	push   0xc(%ebp)
+  8019e4:	50                   	push   %eax
+  8019e5:	e8 64 ff ff ff       	call   80194e <fstat>
+  8019ea:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8019ec:	89 1c 24             	mov    %ebx,(%esp)
+  8019ef:	e8 26 fc ff ff       	call   80161a <close>
+	return r;
+  8019f4:	83 c4 10             	add    $0x10,%esp
+  8019f7:	89 f3                	mov    %esi,%ebx
+}
+  8019f9:	89 d8                	mov    %ebx,%eax
+  8019fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019fe:	5b                   	pop    %ebx
+  8019ff:	5e                   	pop    %esi
+  801a00:	5d                   	pop    %ebp
+  801a01:	c3                   	ret
+
+00801a02 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a02:	55                   	push   %ebp
+  801a03:	89 e5                	mov    %esp,%ebp
+  801a05:	56                   	push   %esi
+  801a06:	53                   	push   %ebx
+  801a07:	89 c6                	mov    %eax,%esi
+  801a09:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801a0b:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801a12:	74 27                	je     801a3b <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a14:	6a 07                	push   $0x7
+  801a16:	68 00 60 80 00       	push   $0x806000
+  801a1b:	56                   	push   %esi
+  801a1c:	ff 35 00 50 80 00    	push   0x805000
+  801a22:	e8 e8 f9 ff ff       	call   80140f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801a27:	83 c4 0c             	add    $0xc,%esp
+  801a2a:	6a 00                	push   $0x0
+  801a2c:	53                   	push   %ebx
+  801a2d:	6a 00                	push   $0x0
+  801a2f:	e8 63 f9 ff ff       	call   801397 <ipc_recv>
+}
+  801a34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a37:	5b                   	pop    %ebx
+  801a38:	5e                   	pop    %esi
+  801a39:	5d                   	pop    %ebp
+  801a3a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a3b:	83 ec 0c             	sub    $0xc,%esp
+  801a3e:	6a 01                	push   $0x1
+  801a40:	e8 1e fa ff ff       	call   801463 <ipc_find_env>
+  801a45:	a3 00 50 80 00       	mov    %eax,0x805000
+  801a4a:	83 c4 10             	add    $0x10,%esp
+  801a4d:	eb c5                	jmp    801a14 <fsipc+0x12>
+
+00801a4f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a4f:	55                   	push   %ebp
+  801a50:	89 e5                	mov    %esp,%ebp
+  801a52:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a58:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a5b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801a60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a63:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801a68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a72:	e8 8b ff ff ff       	call   801a02 <fsipc>
+}
+  801a77:	c9                   	leave
+  801a78:	c3                   	ret
+
+00801a79 <devfile_flush>:
+{
+  801a79:	55                   	push   %ebp
+  801a7a:	89 e5                	mov    %esp,%ebp
+  801a7c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a82:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a85:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801a8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a8f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a94:	e8 69 ff ff ff       	call   801a02 <fsipc>
+}
+  801a99:	c9                   	leave
+  801a9a:	c3                   	ret
+
+00801a9b <devfile_stat>:
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	53                   	push   %ebx
+  801a9f:	83 ec 04             	sub    $0x4,%esp
+  801aa2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801aa5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aa8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aab:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ab0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801aba:	e8 43 ff ff ff       	call   801a02 <fsipc>
+  801abf:	85 c0                	test   %eax,%eax
+  801ac1:	78 2c                	js     801aef <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ac3:	83 ec 08             	sub    $0x8,%esp
+  801ac6:	68 00 60 80 00       	push   $0x806000
+  801acb:	53                   	push   %ebx
+  801acc:	e8 d2 ec ff ff       	call   8007a3 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801ad1:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ad6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801adc:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ae1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801ae7:	83 c4 10             	add    $0x10,%esp
+  801aea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af2:	c9                   	leave
+  801af3:	c3                   	ret
+
+00801af4 <devfile_write>:
+{
+  801af4:	55                   	push   %ebp
+  801af5:	89 e5                	mov    %esp,%ebp
+  801af7:	83 ec 0c             	sub    $0xc,%esp
+  801afa:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801afd:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801b02:	39 d0                	cmp    %edx,%eax
+  801b04:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b07:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b0a:	8b 52 0c             	mov    0xc(%edx),%edx
+  801b0d:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801b13:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801b18:	50                   	push   %eax
+  801b19:	ff 75 0c             	push   0xc(%ebp)
+  801b1c:	68 08 60 80 00       	push   $0x806008
+  801b21:	e8 03 ee ff ff       	call   800929 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801b26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b30:	e8 cd fe ff ff       	call   801a02 <fsipc>
+}
+  801b35:	c9                   	leave
+  801b36:	c3                   	ret
+
+00801b37 <devfile_read>:
+{
+  801b37:	55                   	push   %ebp
+  801b38:	89 e5                	mov    %esp,%ebp
+  801b3a:	56                   	push   %esi
+  801b3b:	53                   	push   %ebx
+  801b3c:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b42:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b45:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801b4a:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b55:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b5a:	e8 a3 fe ff ff       	call   801a02 <fsipc>
+  801b5f:	89 c3                	mov    %eax,%ebx
+  801b61:	85 c0                	test   %eax,%eax
+  801b63:	78 1f                	js     801b84 <devfile_read+0x4d>
+	assert(r <= n);
+  801b65:	39 c6                	cmp    %eax,%esi
+  801b67:	72 24                	jb     801b8d <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801b69:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b6e:	7f 33                	jg     801ba3 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b70:	83 ec 04             	sub    $0x4,%esp
+  801b73:	50                   	push   %eax
+  801b74:	68 00 60 80 00       	push   $0x806000
+  801b79:	ff 75 0c             	push   0xc(%ebp)
+  801b7c:	e8 a8 ed ff ff       	call   800929 <memmove>
+	return r;
+  801b81:	83 c4 10             	add    $0x10,%esp
+}
+  801b84:	89 d8                	mov    %ebx,%eax
+  801b86:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b89:	5b                   	pop    %ebx
+  801b8a:	5e                   	pop    %esi
+  801b8b:	5d                   	pop    %ebp
+  801b8c:	c3                   	ret
+	assert(r <= n);
+  801b8d:	68 f0 2f 80 00       	push   $0x802ff0
+  801b92:	68 f7 2f 80 00       	push   $0x802ff7
+  801b97:	6a 7c                	push   $0x7c
+  801b99:	68 0c 30 80 00       	push   $0x80300c
+  801b9e:	e8 e1 09 00 00       	call   802584 <_panic>
+	assert(r <= PGSIZE);
+  801ba3:	68 17 30 80 00       	push   $0x803017
+  801ba8:	68 f7 2f 80 00       	push   $0x802ff7
+  801bad:	6a 7d                	push   $0x7d
+  801baf:	68 0c 30 80 00       	push   $0x80300c
+  801bb4:	e8 cb 09 00 00       	call   802584 <_panic>
+
+00801bb9 <open>:
+{
+  801bb9:	55                   	push   %ebp
+  801bba:	89 e5                	mov    %esp,%ebp
+  801bbc:	56                   	push   %esi
+  801bbd:	53                   	push   %ebx
+  801bbe:	83 ec 1c             	sub    $0x1c,%esp
+  801bc1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801bc4:	56                   	push   %esi
+  801bc5:	e8 9e eb ff ff       	call   800768 <strlen>
+  801bca:	83 c4 10             	add    $0x10,%esp
+  801bcd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bd2:	7f 6c                	jg     801c40 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801bd4:	83 ec 0c             	sub    $0xc,%esp
+  801bd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bda:	50                   	push   %eax
+  801bdb:	e8 ba f8 ff ff       	call   80149a <fd_alloc>
+  801be0:	89 c3                	mov    %eax,%ebx
+  801be2:	83 c4 10             	add    $0x10,%esp
+  801be5:	85 c0                	test   %eax,%eax
+  801be7:	78 3c                	js     801c25 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801be9:	83 ec 08             	sub    $0x8,%esp
+  801bec:	56                   	push   %esi
+  801bed:	68 00 60 80 00       	push   $0x806000
+  801bf2:	e8 ac eb ff ff       	call   8007a3 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801bf7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bfa:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c02:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c07:	e8 f6 fd ff ff       	call   801a02 <fsipc>
+  801c0c:	89 c3                	mov    %eax,%ebx
+  801c0e:	83 c4 10             	add    $0x10,%esp
+  801c11:	85 c0                	test   %eax,%eax
+  801c13:	78 19                	js     801c2e <open+0x75>
+	return fd2num(fd);
+  801c15:	83 ec 0c             	sub    $0xc,%esp
+  801c18:	ff 75 f4             	push   -0xc(%ebp)
+  801c1b:	e8 53 f8 ff ff       	call   801473 <fd2num>
+  801c20:	89 c3                	mov    %eax,%ebx
+  801c22:	83 c4 10             	add    $0x10,%esp
+}
+  801c25:	89 d8                	mov    %ebx,%eax
+  801c27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c2a:	5b                   	pop    %ebx
+  801c2b:	5e                   	pop    %esi
+  801c2c:	5d                   	pop    %ebp
+  801c2d:	c3                   	ret
+		fd_close(fd, 0);
+  801c2e:	83 ec 08             	sub    $0x8,%esp
+  801c31:	6a 00                	push   $0x0
+  801c33:	ff 75 f4             	push   -0xc(%ebp)
+  801c36:	e8 58 f9 ff ff       	call   801593 <fd_close>
+		return r;
+  801c3b:	83 c4 10             	add    $0x10,%esp
+  801c3e:	eb e5                	jmp    801c25 <open+0x6c>
+		return -E_BAD_PATH;
+  801c40:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c45:	eb de                	jmp    801c25 <open+0x6c>
+
+00801c47 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c47:	55                   	push   %ebp
+  801c48:	89 e5                	mov    %esp,%ebp
+  801c4a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c52:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c57:	e8 a6 fd ff ff       	call   801a02 <fsipc>
+}
+  801c5c:	c9                   	leave
+  801c5d:	c3                   	ret
+
+00801c5e <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c5e:	55                   	push   %ebp
+  801c5f:	89 e5                	mov    %esp,%ebp
+  801c61:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c64:	68 23 30 80 00       	push   $0x803023
+  801c69:	ff 75 0c             	push   0xc(%ebp)
+  801c6c:	e8 32 eb ff ff       	call   8007a3 <strcpy>
+	return 0;
+}
+  801c71:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c76:	c9                   	leave
+  801c77:	c3                   	ret
+
+00801c78 <devsock_close>:
+{
+  801c78:	55                   	push   %ebp
+  801c79:	89 e5                	mov    %esp,%ebp
+  801c7b:	53                   	push   %ebx
+  801c7c:	83 ec 10             	sub    $0x10,%esp
+  801c7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c82:	53                   	push   %ebx
+  801c83:	e8 d3 09 00 00       	call   80265b <pageref>
+  801c88:	89 c2                	mov    %eax,%edx
+  801c8a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c92:	83 fa 01             	cmp    $0x1,%edx
+  801c95:	74 05                	je     801c9c <devsock_close+0x24>
+}
+  801c97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c9a:	c9                   	leave
+  801c9b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c9c:	83 ec 0c             	sub    $0xc,%esp
+  801c9f:	ff 73 0c             	push   0xc(%ebx)
+  801ca2:	e8 b7 02 00 00       	call   801f5e <nsipc_close>
+  801ca7:	83 c4 10             	add    $0x10,%esp
+  801caa:	eb eb                	jmp    801c97 <devsock_close+0x1f>
+
+00801cac <devsock_write>:
+{
+  801cac:	55                   	push   %ebp
+  801cad:	89 e5                	mov    %esp,%ebp
+  801caf:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801cb2:	6a 00                	push   $0x0
+  801cb4:	ff 75 10             	push   0x10(%ebp)
+  801cb7:	ff 75 0c             	push   0xc(%ebp)
+  801cba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbd:	ff 70 0c             	push   0xc(%eax)
+  801cc0:	e8 79 03 00 00       	call   80203e <nsipc_send>
+}
+  801cc5:	c9                   	leave
+  801cc6:	c3                   	ret
+
+00801cc7 <devsock_read>:
+{
+  801cc7:	55                   	push   %ebp
+  801cc8:	89 e5                	mov    %esp,%ebp
+  801cca:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801ccd:	6a 00                	push   $0x0
+  801ccf:	ff 75 10             	push   0x10(%ebp)
+  801cd2:	ff 75 0c             	push   0xc(%ebp)
+  801cd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd8:	ff 70 0c             	push   0xc(%eax)
+  801cdb:	e8 ef 02 00 00       	call   801fcf <nsipc_recv>
+}
+  801ce0:	c9                   	leave
+  801ce1:	c3                   	ret
+
+00801ce2 <fd2sockid>:
+{
+  801ce2:	55                   	push   %ebp
+  801ce3:	89 e5                	mov    %esp,%ebp
+  801ce5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801ce8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801ceb:	52                   	push   %edx
+  801cec:	50                   	push   %eax
+  801ced:	e8 fe f7 ff ff       	call   8014f0 <fd_lookup>
+  801cf2:	83 c4 10             	add    $0x10,%esp
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	78 10                	js     801d09 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801cf9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cfc:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801d02:	39 08                	cmp    %ecx,(%eax)
+  801d04:	75 05                	jne    801d0b <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d06:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d09:	c9                   	leave
+  801d0a:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d0b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d10:	eb f7                	jmp    801d09 <fd2sockid+0x27>
+
+00801d12 <alloc_sockfd>:
+{
+  801d12:	55                   	push   %ebp
+  801d13:	89 e5                	mov    %esp,%ebp
+  801d15:	56                   	push   %esi
+  801d16:	53                   	push   %ebx
+  801d17:	83 ec 1c             	sub    $0x1c,%esp
+  801d1a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d1c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d1f:	50                   	push   %eax
+  801d20:	e8 75 f7 ff ff       	call   80149a <fd_alloc>
+  801d25:	89 c3                	mov    %eax,%ebx
+  801d27:	83 c4 10             	add    $0x10,%esp
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	78 43                	js     801d71 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d2e:	83 ec 04             	sub    $0x4,%esp
+  801d31:	68 07 04 00 00       	push   $0x407
+  801d36:	ff 75 f4             	push   -0xc(%ebp)
+  801d39:	6a 00                	push   $0x0
+  801d3b:	e8 d0 ee ff ff       	call   800c10 <sys_page_alloc>
+  801d40:	89 c3                	mov    %eax,%ebx
+  801d42:	83 c4 10             	add    $0x10,%esp
+  801d45:	85 c0                	test   %eax,%eax
+  801d47:	78 28                	js     801d71 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d4c:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d52:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d57:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d5e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d61:	83 ec 0c             	sub    $0xc,%esp
+  801d64:	50                   	push   %eax
+  801d65:	e8 09 f7 ff ff       	call   801473 <fd2num>
+  801d6a:	89 c3                	mov    %eax,%ebx
+  801d6c:	83 c4 10             	add    $0x10,%esp
+  801d6f:	eb 0c                	jmp    801d7d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d71:	83 ec 0c             	sub    $0xc,%esp
+  801d74:	56                   	push   %esi
+  801d75:	e8 e4 01 00 00       	call   801f5e <nsipc_close>
+		return r;
+  801d7a:	83 c4 10             	add    $0x10,%esp
+}
+  801d7d:	89 d8                	mov    %ebx,%eax
+  801d7f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d82:	5b                   	pop    %ebx
+  801d83:	5e                   	pop    %esi
+  801d84:	5d                   	pop    %ebp
+  801d85:	c3                   	ret
+
+00801d86 <accept>:
+{
+  801d86:	55                   	push   %ebp
+  801d87:	89 e5                	mov    %esp,%ebp
+  801d89:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8f:	e8 4e ff ff ff       	call   801ce2 <fd2sockid>
+  801d94:	85 c0                	test   %eax,%eax
+  801d96:	78 1b                	js     801db3 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d98:	83 ec 04             	sub    $0x4,%esp
+  801d9b:	ff 75 10             	push   0x10(%ebp)
+  801d9e:	ff 75 0c             	push   0xc(%ebp)
+  801da1:	50                   	push   %eax
+  801da2:	e8 0e 01 00 00       	call   801eb5 <nsipc_accept>
+  801da7:	83 c4 10             	add    $0x10,%esp
+  801daa:	85 c0                	test   %eax,%eax
+  801dac:	78 05                	js     801db3 <accept+0x2d>
+	return alloc_sockfd(r);
+  801dae:	e8 5f ff ff ff       	call   801d12 <alloc_sockfd>
+}
+  801db3:	c9                   	leave
+  801db4:	c3                   	ret
+
+00801db5 <bind>:
+{
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dbe:	e8 1f ff ff ff       	call   801ce2 <fd2sockid>
+  801dc3:	85 c0                	test   %eax,%eax
+  801dc5:	78 12                	js     801dd9 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801dc7:	83 ec 04             	sub    $0x4,%esp
+  801dca:	ff 75 10             	push   0x10(%ebp)
+  801dcd:	ff 75 0c             	push   0xc(%ebp)
+  801dd0:	50                   	push   %eax
+  801dd1:	e8 31 01 00 00       	call   801f07 <nsipc_bind>
+  801dd6:	83 c4 10             	add    $0x10,%esp
+}
+  801dd9:	c9                   	leave
+  801dda:	c3                   	ret
+
+00801ddb <shutdown>:
+{
+  801ddb:	55                   	push   %ebp
+  801ddc:	89 e5                	mov    %esp,%ebp
+  801dde:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801de1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de4:	e8 f9 fe ff ff       	call   801ce2 <fd2sockid>
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	78 0f                	js     801dfc <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801ded:	83 ec 08             	sub    $0x8,%esp
+  801df0:	ff 75 0c             	push   0xc(%ebp)
+  801df3:	50                   	push   %eax
+  801df4:	e8 43 01 00 00       	call   801f3c <nsipc_shutdown>
+  801df9:	83 c4 10             	add    $0x10,%esp
+}
+  801dfc:	c9                   	leave
+  801dfd:	c3                   	ret
+
+00801dfe <connect>:
+{
+  801dfe:	55                   	push   %ebp
+  801dff:	89 e5                	mov    %esp,%ebp
+  801e01:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e04:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e07:	e8 d6 fe ff ff       	call   801ce2 <fd2sockid>
+  801e0c:	85 c0                	test   %eax,%eax
+  801e0e:	78 12                	js     801e22 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e10:	83 ec 04             	sub    $0x4,%esp
+  801e13:	ff 75 10             	push   0x10(%ebp)
+  801e16:	ff 75 0c             	push   0xc(%ebp)
+  801e19:	50                   	push   %eax
+  801e1a:	e8 59 01 00 00       	call   801f78 <nsipc_connect>
+  801e1f:	83 c4 10             	add    $0x10,%esp
+}
+  801e22:	c9                   	leave
+  801e23:	c3                   	ret
+
+00801e24 <listen>:
+{
+  801e24:	55                   	push   %ebp
+  801e25:	89 e5                	mov    %esp,%ebp
+  801e27:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e2d:	e8 b0 fe ff ff       	call   801ce2 <fd2sockid>
+  801e32:	85 c0                	test   %eax,%eax
+  801e34:	78 0f                	js     801e45 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e36:	83 ec 08             	sub    $0x8,%esp
+  801e39:	ff 75 0c             	push   0xc(%ebp)
+  801e3c:	50                   	push   %eax
+  801e3d:	e8 6b 01 00 00       	call   801fad <nsipc_listen>
+  801e42:	83 c4 10             	add    $0x10,%esp
+}
+  801e45:	c9                   	leave
+  801e46:	c3                   	ret
+
+00801e47 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e47:	55                   	push   %ebp
+  801e48:	89 e5                	mov    %esp,%ebp
+  801e4a:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e4d:	ff 75 10             	push   0x10(%ebp)
+  801e50:	ff 75 0c             	push   0xc(%ebp)
+  801e53:	ff 75 08             	push   0x8(%ebp)
+  801e56:	e8 41 02 00 00       	call   80209c <nsipc_socket>
+  801e5b:	83 c4 10             	add    $0x10,%esp
+  801e5e:	85 c0                	test   %eax,%eax
+  801e60:	78 05                	js     801e67 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e62:	e8 ab fe ff ff       	call   801d12 <alloc_sockfd>
+}
+  801e67:	c9                   	leave
+  801e68:	c3                   	ret
+
+00801e69 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e69:	55                   	push   %ebp
+  801e6a:	89 e5                	mov    %esp,%ebp
+  801e6c:	53                   	push   %ebx
+  801e6d:	83 ec 04             	sub    $0x4,%esp
+  801e70:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e72:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801e79:	74 26                	je     801ea1 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e7b:	6a 07                	push   $0x7
+  801e7d:	68 00 70 80 00       	push   $0x807000
+  801e82:	53                   	push   %ebx
+  801e83:	ff 35 04 50 80 00    	push   0x805004
+  801e89:	e8 81 f5 ff ff       	call   80140f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e8e:	83 c4 0c             	add    $0xc,%esp
+  801e91:	6a 00                	push   $0x0
+  801e93:	6a 00                	push   $0x0
+  801e95:	6a 00                	push   $0x0
+  801e97:	e8 fb f4 ff ff       	call   801397 <ipc_recv>
+}
+  801e9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e9f:	c9                   	leave
+  801ea0:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ea1:	83 ec 0c             	sub    $0xc,%esp
+  801ea4:	6a 02                	push   $0x2
+  801ea6:	e8 b8 f5 ff ff       	call   801463 <ipc_find_env>
+  801eab:	a3 04 50 80 00       	mov    %eax,0x805004
+  801eb0:	83 c4 10             	add    $0x10,%esp
+  801eb3:	eb c6                	jmp    801e7b <nsipc+0x12>
+
+00801eb5 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801eb5:	55                   	push   %ebp
+  801eb6:	89 e5                	mov    %esp,%ebp
+  801eb8:	56                   	push   %esi
+  801eb9:	53                   	push   %ebx
+  801eba:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ec5:	8b 06                	mov    (%esi),%eax
+  801ec7:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ecc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ed1:	e8 93 ff ff ff       	call   801e69 <nsipc>
+  801ed6:	89 c3                	mov    %eax,%ebx
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	79 09                	jns    801ee5 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801edc:	89 d8                	mov    %ebx,%eax
+  801ede:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee1:	5b                   	pop    %ebx
+  801ee2:	5e                   	pop    %esi
+  801ee3:	5d                   	pop    %ebp
+  801ee4:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801ee5:	83 ec 04             	sub    $0x4,%esp
+  801ee8:	ff 35 10 70 80 00    	push   0x807010
+  801eee:	68 00 70 80 00       	push   $0x807000
+  801ef3:	ff 75 0c             	push   0xc(%ebp)
+  801ef6:	e8 2e ea ff ff       	call   800929 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801efb:	a1 10 70 80 00       	mov    0x807010,%eax
+  801f00:	89 06                	mov    %eax,(%esi)
+  801f02:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f05:	eb d5                	jmp    801edc <nsipc_accept+0x27>
+
+00801f07 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f07:	55                   	push   %ebp
+  801f08:	89 e5                	mov    %esp,%ebp
+  801f0a:	53                   	push   %ebx
+  801f0b:	83 ec 08             	sub    $0x8,%esp
+  801f0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f14:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f19:	53                   	push   %ebx
+  801f1a:	ff 75 0c             	push   0xc(%ebp)
+  801f1d:	68 04 70 80 00       	push   $0x807004
+  801f22:	e8 02 ea ff ff       	call   800929 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f27:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801f2d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f32:	e8 32 ff ff ff       	call   801e69 <nsipc>
+}
+  801f37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f3a:	c9                   	leave
+  801f3b:	c3                   	ret
+
+00801f3c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f3c:	55                   	push   %ebp
+  801f3d:	89 e5                	mov    %esp,%ebp
+  801f3f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f42:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f45:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801f4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f4d:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f52:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f57:	e8 0d ff ff ff       	call   801e69 <nsipc>
+}
+  801f5c:	c9                   	leave
+  801f5d:	c3                   	ret
+
+00801f5e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f5e:	55                   	push   %ebp
+  801f5f:	89 e5                	mov    %esp,%ebp
+  801f61:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f67:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801f6c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f71:	e8 f3 fe ff ff       	call   801e69 <nsipc>
+}
+  801f76:	c9                   	leave
+  801f77:	c3                   	ret
+
+00801f78 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	53                   	push   %ebx
+  801f7c:	83 ec 08             	sub    $0x8,%esp
+  801f7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f85:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f8a:	53                   	push   %ebx
+  801f8b:	ff 75 0c             	push   0xc(%ebp)
+  801f8e:	68 04 70 80 00       	push   $0x807004
+  801f93:	e8 91 e9 ff ff       	call   800929 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f98:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801f9e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fa3:	e8 c1 fe ff ff       	call   801e69 <nsipc>
+}
+  801fa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fab:	c9                   	leave
+  801fac:	c3                   	ret
+
+00801fad <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801fad:	55                   	push   %ebp
+  801fae:	89 e5                	mov    %esp,%ebp
+  801fb0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801fb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801fbb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fbe:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801fc3:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fc8:	e8 9c fe ff ff       	call   801e69 <nsipc>
+}
+  801fcd:	c9                   	leave
+  801fce:	c3                   	ret
+
+00801fcf <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	56                   	push   %esi
+  801fd3:	53                   	push   %ebx
+  801fd4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801fd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fda:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801fdf:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801fe5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fe8:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801fed:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ff2:	e8 72 fe ff ff       	call   801e69 <nsipc>
+  801ff7:	89 c3                	mov    %eax,%ebx
+  801ff9:	85 c0                	test   %eax,%eax
+  801ffb:	78 22                	js     80201f <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801ffd:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802002:	39 c6                	cmp    %eax,%esi
+  802004:	0f 4e c6             	cmovle %esi,%eax
+  802007:	39 c3                	cmp    %eax,%ebx
+  802009:	7f 1d                	jg     802028 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80200b:	83 ec 04             	sub    $0x4,%esp
+  80200e:	53                   	push   %ebx
+  80200f:	68 00 70 80 00       	push   $0x807000
+  802014:	ff 75 0c             	push   0xc(%ebp)
+  802017:	e8 0d e9 ff ff       	call   800929 <memmove>
+  80201c:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80201f:	89 d8                	mov    %ebx,%eax
+  802021:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802024:	5b                   	pop    %ebx
+  802025:	5e                   	pop    %esi
+  802026:	5d                   	pop    %ebp
+  802027:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802028:	68 2f 30 80 00       	push   $0x80302f
+  80202d:	68 f7 2f 80 00       	push   $0x802ff7
+  802032:	6a 62                	push   $0x62
+  802034:	68 44 30 80 00       	push   $0x803044
+  802039:	e8 46 05 00 00       	call   802584 <_panic>
+
+0080203e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80203e:	55                   	push   %ebp
+  80203f:	89 e5                	mov    %esp,%ebp
+  802041:	53                   	push   %ebx
+  802042:	83 ec 04             	sub    $0x4,%esp
+  802045:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802048:	8b 45 08             	mov    0x8(%ebp),%eax
+  80204b:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802050:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802056:	7f 2e                	jg     802086 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802058:	83 ec 04             	sub    $0x4,%esp
+  80205b:	53                   	push   %ebx
+  80205c:	ff 75 0c             	push   0xc(%ebp)
+  80205f:	68 0c 70 80 00       	push   $0x80700c
+  802064:	e8 c0 e8 ff ff       	call   800929 <memmove>
+	nsipcbuf.send.req_size = size;
+  802069:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80206f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802072:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802077:	b8 08 00 00 00       	mov    $0x8,%eax
+  80207c:	e8 e8 fd ff ff       	call   801e69 <nsipc>
+}
+  802081:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802084:	c9                   	leave
+  802085:	c3                   	ret
+	assert(size < 1600);
+  802086:	68 50 30 80 00       	push   $0x803050
+  80208b:	68 f7 2f 80 00       	push   $0x802ff7
+  802090:	6a 6d                	push   $0x6d
+  802092:	68 44 30 80 00       	push   $0x803044
+  802097:	e8 e8 04 00 00       	call   802584 <_panic>
+
+0080209c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80209c:	55                   	push   %ebp
+  80209d:	89 e5                	mov    %esp,%ebp
+  80209f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  8020aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ad:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020b2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020b5:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8020ba:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020bf:	e8 a5 fd ff ff       	call   801e69 <nsipc>
+}
+  8020c4:	c9                   	leave
+  8020c5:	c3                   	ret
+
+008020c6 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020c6:	55                   	push   %ebp
+  8020c7:	89 e5                	mov    %esp,%ebp
+  8020c9:	56                   	push   %esi
+  8020ca:	53                   	push   %ebx
+  8020cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8020ce:	83 ec 0c             	sub    $0xc,%esp
+  8020d1:	ff 75 08             	push   0x8(%ebp)
+  8020d4:	e8 aa f3 ff ff       	call   801483 <fd2data>
+  8020d9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8020db:	83 c4 08             	add    $0x8,%esp
+  8020de:	68 5c 30 80 00       	push   $0x80305c
+  8020e3:	53                   	push   %ebx
+  8020e4:	e8 ba e6 ff ff       	call   8007a3 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8020e9:	8b 46 04             	mov    0x4(%esi),%eax
+  8020ec:	2b 06                	sub    (%esi),%eax
+  8020ee:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020f4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020fb:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020fe:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802105:	40 80 00 
+	return 0;
+}
+  802108:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802110:	5b                   	pop    %ebx
+  802111:	5e                   	pop    %esi
+  802112:	5d                   	pop    %ebp
+  802113:	c3                   	ret
+
+00802114 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802114:	55                   	push   %ebp
+  802115:	89 e5                	mov    %esp,%ebp
+  802117:	53                   	push   %ebx
+  802118:	83 ec 0c             	sub    $0xc,%esp
+  80211b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80211e:	53                   	push   %ebx
+  80211f:	6a 00                	push   $0x0
+  802121:	e8 b2 eb ff ff       	call   800cd8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802126:	89 1c 24             	mov    %ebx,(%esp)
+  802129:	e8 55 f3 ff ff       	call   801483 <fd2data>
+  80212e:	83 c4 08             	add    $0x8,%esp
+  802131:	50                   	push   %eax
+  802132:	6a 00                	push   $0x0
+  802134:	e8 9f eb ff ff       	call   800cd8 <sys_page_unmap>
+}
+  802139:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80213c:	c9                   	leave
+  80213d:	c3                   	ret
+
+0080213e <_pipeisclosed>:
+{
+  80213e:	55                   	push   %ebp
+  80213f:	89 e5                	mov    %esp,%ebp
+  802141:	57                   	push   %edi
+  802142:	56                   	push   %esi
+  802143:	53                   	push   %ebx
+  802144:	83 ec 1c             	sub    $0x1c,%esp
+  802147:	89 c7                	mov    %eax,%edi
+  802149:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80214b:	a1 08 50 80 00       	mov    0x805008,%eax
+  802150:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802153:	83 ec 0c             	sub    $0xc,%esp
+  802156:	57                   	push   %edi
+  802157:	e8 ff 04 00 00       	call   80265b <pageref>
+  80215c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80215f:	89 34 24             	mov    %esi,(%esp)
+  802162:	e8 f4 04 00 00       	call   80265b <pageref>
+		nn = thisenv->env_runs;
+  802167:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  80216d:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802170:	83 c4 10             	add    $0x10,%esp
+  802173:	39 cb                	cmp    %ecx,%ebx
+  802175:	74 1b                	je     802192 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802177:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80217a:	75 cf                	jne    80214b <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80217c:	8b 42 5c             	mov    0x5c(%edx),%eax
+  80217f:	6a 01                	push   $0x1
+  802181:	50                   	push   %eax
+  802182:	53                   	push   %ebx
+  802183:	68 63 30 80 00       	push   $0x803063
+  802188:	e8 28 e0 ff ff       	call   8001b5 <cprintf>
+  80218d:	83 c4 10             	add    $0x10,%esp
+  802190:	eb b9                	jmp    80214b <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802192:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802195:	0f 94 c0             	sete   %al
+  802198:	0f b6 c0             	movzbl %al,%eax
+}
+  80219b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80219e:	5b                   	pop    %ebx
+  80219f:	5e                   	pop    %esi
+  8021a0:	5f                   	pop    %edi
+  8021a1:	5d                   	pop    %ebp
+  8021a2:	c3                   	ret
+
+008021a3 <devpipe_write>:
+{
+  8021a3:	55                   	push   %ebp
+  8021a4:	89 e5                	mov    %esp,%ebp
+  8021a6:	57                   	push   %edi
+  8021a7:	56                   	push   %esi
+  8021a8:	53                   	push   %ebx
+  8021a9:	83 ec 28             	sub    $0x28,%esp
+  8021ac:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8021af:	56                   	push   %esi
+  8021b0:	e8 ce f2 ff ff       	call   801483 <fd2data>
+  8021b5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021b7:	83 c4 10             	add    $0x10,%esp
+  8021ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021bf:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8021c2:	75 09                	jne    8021cd <devpipe_write+0x2a>
+	return i;
+  8021c4:	89 f8                	mov    %edi,%eax
+  8021c6:	eb 23                	jmp    8021eb <devpipe_write+0x48>
+			sys_yield();
+  8021c8:	e8 c3 e9 ff ff       	call   800b90 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8021cd:	8b 43 04             	mov    0x4(%ebx),%eax
+  8021d0:	8b 0b                	mov    (%ebx),%ecx
+  8021d2:	8d 51 20             	lea    0x20(%ecx),%edx
+  8021d5:	39 d0                	cmp    %edx,%eax
+  8021d7:	72 1a                	jb     8021f3 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8021d9:	89 da                	mov    %ebx,%edx
+  8021db:	89 f0                	mov    %esi,%eax
+  8021dd:	e8 5c ff ff ff       	call   80213e <_pipeisclosed>
+  8021e2:	85 c0                	test   %eax,%eax
+  8021e4:	74 e2                	je     8021c8 <devpipe_write+0x25>
+				return 0;
+  8021e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ee:	5b                   	pop    %ebx
+  8021ef:	5e                   	pop    %esi
+  8021f0:	5f                   	pop    %edi
+  8021f1:	5d                   	pop    %ebp
+  8021f2:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021f6:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021fa:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021fd:	89 c2                	mov    %eax,%edx
+  8021ff:	c1 fa 1f             	sar    $0x1f,%edx
+  802202:	89 d1                	mov    %edx,%ecx
+  802204:	c1 e9 1b             	shr    $0x1b,%ecx
+  802207:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80220a:	83 e2 1f             	and    $0x1f,%edx
+  80220d:	29 ca                	sub    %ecx,%edx
+  80220f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802213:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802217:	83 c0 01             	add    $0x1,%eax
+  80221a:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80221d:	83 c7 01             	add    $0x1,%edi
+  802220:	eb 9d                	jmp    8021bf <devpipe_write+0x1c>
+
+00802222 <devpipe_read>:
+{
+  802222:	55                   	push   %ebp
+  802223:	89 e5                	mov    %esp,%ebp
+  802225:	57                   	push   %edi
+  802226:	56                   	push   %esi
+  802227:	53                   	push   %ebx
+  802228:	83 ec 18             	sub    $0x18,%esp
+  80222b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80222e:	57                   	push   %edi
+  80222f:	e8 4f f2 ff ff       	call   801483 <fd2data>
+  802234:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802236:	83 c4 10             	add    $0x10,%esp
+  802239:	be 00 00 00 00       	mov    $0x0,%esi
+  80223e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802241:	75 13                	jne    802256 <devpipe_read+0x34>
+	return i;
+  802243:	89 f0                	mov    %esi,%eax
+  802245:	eb 02                	jmp    802249 <devpipe_read+0x27>
+				return i;
+  802247:	89 f0                	mov    %esi,%eax
+}
+  802249:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80224c:	5b                   	pop    %ebx
+  80224d:	5e                   	pop    %esi
+  80224e:	5f                   	pop    %edi
+  80224f:	5d                   	pop    %ebp
+  802250:	c3                   	ret
+			sys_yield();
+  802251:	e8 3a e9 ff ff       	call   800b90 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802256:	8b 03                	mov    (%ebx),%eax
+  802258:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80225b:	75 18                	jne    802275 <devpipe_read+0x53>
+			if (i > 0)
+  80225d:	85 f6                	test   %esi,%esi
+  80225f:	75 e6                	jne    802247 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802261:	89 da                	mov    %ebx,%edx
+  802263:	89 f8                	mov    %edi,%eax
+  802265:	e8 d4 fe ff ff       	call   80213e <_pipeisclosed>
+  80226a:	85 c0                	test   %eax,%eax
+  80226c:	74 e3                	je     802251 <devpipe_read+0x2f>
+				return 0;
+  80226e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802273:	eb d4                	jmp    802249 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802275:	99                   	cltd
+  802276:	c1 ea 1b             	shr    $0x1b,%edx
+  802279:	01 d0                	add    %edx,%eax
+  80227b:	83 e0 1f             	and    $0x1f,%eax
+  80227e:	29 d0                	sub    %edx,%eax
+  802280:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802285:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802288:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80228b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80228e:	83 c6 01             	add    $0x1,%esi
+  802291:	eb ab                	jmp    80223e <devpipe_read+0x1c>
+
+00802293 <pipe>:
+{
+  802293:	55                   	push   %ebp
+  802294:	89 e5                	mov    %esp,%ebp
+  802296:	56                   	push   %esi
+  802297:	53                   	push   %ebx
+  802298:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80229b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80229e:	50                   	push   %eax
+  80229f:	e8 f6 f1 ff ff       	call   80149a <fd_alloc>
+  8022a4:	89 c3                	mov    %eax,%ebx
+  8022a6:	83 c4 10             	add    $0x10,%esp
+  8022a9:	85 c0                	test   %eax,%eax
+  8022ab:	0f 88 23 01 00 00    	js     8023d4 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022b1:	83 ec 04             	sub    $0x4,%esp
+  8022b4:	68 07 04 00 00       	push   $0x407
+  8022b9:	ff 75 f4             	push   -0xc(%ebp)
+  8022bc:	6a 00                	push   $0x0
+  8022be:	e8 4d e9 ff ff       	call   800c10 <sys_page_alloc>
+  8022c3:	89 c3                	mov    %eax,%ebx
+  8022c5:	83 c4 10             	add    $0x10,%esp
+  8022c8:	85 c0                	test   %eax,%eax
+  8022ca:	0f 88 04 01 00 00    	js     8023d4 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8022d0:	83 ec 0c             	sub    $0xc,%esp
+  8022d3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022d6:	50                   	push   %eax
+  8022d7:	e8 be f1 ff ff       	call   80149a <fd_alloc>
+  8022dc:	89 c3                	mov    %eax,%ebx
+  8022de:	83 c4 10             	add    $0x10,%esp
+  8022e1:	85 c0                	test   %eax,%eax
+  8022e3:	0f 88 db 00 00 00    	js     8023c4 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022e9:	83 ec 04             	sub    $0x4,%esp
+  8022ec:	68 07 04 00 00       	push   $0x407
+  8022f1:	ff 75 f0             	push   -0x10(%ebp)
+  8022f4:	6a 00                	push   $0x0
+  8022f6:	e8 15 e9 ff ff       	call   800c10 <sys_page_alloc>
+  8022fb:	89 c3                	mov    %eax,%ebx
+  8022fd:	83 c4 10             	add    $0x10,%esp
+  802300:	85 c0                	test   %eax,%eax
+  802302:	0f 88 bc 00 00 00    	js     8023c4 <pipe+0x131>
+	va = fd2data(fd0);
+  802308:	83 ec 0c             	sub    $0xc,%esp
+  80230b:	ff 75 f4             	push   -0xc(%ebp)
+  80230e:	e8 70 f1 ff ff       	call   801483 <fd2data>
+  802313:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802315:	83 c4 0c             	add    $0xc,%esp
+  802318:	68 07 04 00 00       	push   $0x407
+  80231d:	50                   	push   %eax
+  80231e:	6a 00                	push   $0x0
+  802320:	e8 eb e8 ff ff       	call   800c10 <sys_page_alloc>
+  802325:	89 c3                	mov    %eax,%ebx
+  802327:	83 c4 10             	add    $0x10,%esp
+  80232a:	85 c0                	test   %eax,%eax
+  80232c:	0f 88 82 00 00 00    	js     8023b4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802332:	83 ec 0c             	sub    $0xc,%esp
+  802335:	ff 75 f0             	push   -0x10(%ebp)
+  802338:	e8 46 f1 ff ff       	call   801483 <fd2data>
+  80233d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802344:	50                   	push   %eax
+  802345:	6a 00                	push   $0x0
+  802347:	56                   	push   %esi
+  802348:	6a 00                	push   $0x0
+  80234a:	e8 47 e9 ff ff       	call   800c96 <sys_page_map>
+  80234f:	89 c3                	mov    %eax,%ebx
+  802351:	83 c4 20             	add    $0x20,%esp
+  802354:	85 c0                	test   %eax,%eax
+  802356:	78 4e                	js     8023a6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802358:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80235d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802360:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802362:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802365:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80236c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80236f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802371:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802374:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80237b:	83 ec 0c             	sub    $0xc,%esp
+  80237e:	ff 75 f4             	push   -0xc(%ebp)
+  802381:	e8 ed f0 ff ff       	call   801473 <fd2num>
+  802386:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802389:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80238b:	83 c4 04             	add    $0x4,%esp
+  80238e:	ff 75 f0             	push   -0x10(%ebp)
+  802391:	e8 dd f0 ff ff       	call   801473 <fd2num>
+  802396:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802399:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80239c:	83 c4 10             	add    $0x10,%esp
+  80239f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023a4:	eb 2e                	jmp    8023d4 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8023a6:	83 ec 08             	sub    $0x8,%esp
+  8023a9:	56                   	push   %esi
+  8023aa:	6a 00                	push   $0x0
+  8023ac:	e8 27 e9 ff ff       	call   800cd8 <sys_page_unmap>
+  8023b1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8023b4:	83 ec 08             	sub    $0x8,%esp
+  8023b7:	ff 75 f0             	push   -0x10(%ebp)
+  8023ba:	6a 00                	push   $0x0
+  8023bc:	e8 17 e9 ff ff       	call   800cd8 <sys_page_unmap>
+  8023c1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8023c4:	83 ec 08             	sub    $0x8,%esp
+  8023c7:	ff 75 f4             	push   -0xc(%ebp)
+  8023ca:	6a 00                	push   $0x0
+  8023cc:	e8 07 e9 ff ff       	call   800cd8 <sys_page_unmap>
+  8023d1:	83 c4 10             	add    $0x10,%esp
+}
+  8023d4:	89 d8                	mov    %ebx,%eax
+  8023d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d9:	5b                   	pop    %ebx
+  8023da:	5e                   	pop    %esi
+  8023db:	5d                   	pop    %ebp
+  8023dc:	c3                   	ret
+
+008023dd <pipeisclosed>:
+{
+  8023dd:	55                   	push   %ebp
+  8023de:	89 e5                	mov    %esp,%ebp
+  8023e0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023e6:	50                   	push   %eax
+  8023e7:	ff 75 08             	push   0x8(%ebp)
+  8023ea:	e8 01 f1 ff ff       	call   8014f0 <fd_lookup>
+  8023ef:	83 c4 10             	add    $0x10,%esp
+  8023f2:	85 c0                	test   %eax,%eax
+  8023f4:	78 18                	js     80240e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023f6:	83 ec 0c             	sub    $0xc,%esp
+  8023f9:	ff 75 f4             	push   -0xc(%ebp)
+  8023fc:	e8 82 f0 ff ff       	call   801483 <fd2data>
+  802401:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802403:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802406:	e8 33 fd ff ff       	call   80213e <_pipeisclosed>
+  80240b:	83 c4 10             	add    $0x10,%esp
+}
+  80240e:	c9                   	leave
+  80240f:	c3                   	ret
+
+00802410 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802410:	b8 00 00 00 00       	mov    $0x0,%eax
+  802415:	c3                   	ret
+
+00802416 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802416:	55                   	push   %ebp
+  802417:	89 e5                	mov    %esp,%ebp
+  802419:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80241c:	68 7b 30 80 00       	push   $0x80307b
+  802421:	ff 75 0c             	push   0xc(%ebp)
+  802424:	e8 7a e3 ff ff       	call   8007a3 <strcpy>
+	return 0;
+}
+  802429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242e:	c9                   	leave
+  80242f:	c3                   	ret
+
+00802430 <devcons_write>:
+{
+  802430:	55                   	push   %ebp
+  802431:	89 e5                	mov    %esp,%ebp
+  802433:	57                   	push   %edi
+  802434:	56                   	push   %esi
+  802435:	53                   	push   %ebx
+  802436:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80243c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802441:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802447:	eb 2e                	jmp    802477 <devcons_write+0x47>
+		m = n - tot;
+  802449:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80244c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80244e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802453:	39 c3                	cmp    %eax,%ebx
+  802455:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802458:	83 ec 04             	sub    $0x4,%esp
+  80245b:	53                   	push   %ebx
+  80245c:	89 f0                	mov    %esi,%eax
+  80245e:	03 45 0c             	add    0xc(%ebp),%eax
+  802461:	50                   	push   %eax
+  802462:	57                   	push   %edi
+  802463:	e8 c1 e4 ff ff       	call   800929 <memmove>
+		sys_cputs(buf, m);
+  802468:	83 c4 08             	add    $0x8,%esp
+  80246b:	53                   	push   %ebx
+  80246c:	57                   	push   %edi
+  80246d:	e8 61 e6 ff ff       	call   800ad3 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802472:	01 de                	add    %ebx,%esi
+  802474:	83 c4 10             	add    $0x10,%esp
+  802477:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80247a:	72 cd                	jb     802449 <devcons_write+0x19>
+}
+  80247c:	89 f0                	mov    %esi,%eax
+  80247e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802481:	5b                   	pop    %ebx
+  802482:	5e                   	pop    %esi
+  802483:	5f                   	pop    %edi
+  802484:	5d                   	pop    %ebp
+  802485:	c3                   	ret
+
+00802486 <devcons_read>:
+{
+  802486:	55                   	push   %ebp
+  802487:	89 e5                	mov    %esp,%ebp
+  802489:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80248c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802491:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802495:	75 07                	jne    80249e <devcons_read+0x18>
+  802497:	eb 1f                	jmp    8024b8 <devcons_read+0x32>
+		sys_yield();
+  802499:	e8 f2 e6 ff ff       	call   800b90 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80249e:	e8 4e e6 ff ff       	call   800af1 <sys_cgetc>
+  8024a3:	85 c0                	test   %eax,%eax
+  8024a5:	74 f2                	je     802499 <devcons_read+0x13>
+	if (c < 0)
+  8024a7:	78 0f                	js     8024b8 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8024a9:	83 f8 04             	cmp    $0x4,%eax
+  8024ac:	74 0c                	je     8024ba <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8024ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024b1:	88 02                	mov    %al,(%edx)
+	return 1;
+  8024b3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8024b8:	c9                   	leave
+  8024b9:	c3                   	ret
+		return 0;
+  8024ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024bf:	eb f7                	jmp    8024b8 <devcons_read+0x32>
+
+008024c1 <cputchar>:
+{
+  8024c1:	55                   	push   %ebp
+  8024c2:	89 e5                	mov    %esp,%ebp
+  8024c4:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8024c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ca:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8024cd:	6a 01                	push   $0x1
+  8024cf:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024d2:	50                   	push   %eax
+  8024d3:	e8 fb e5 ff ff       	call   800ad3 <sys_cputs>
+}
+  8024d8:	83 c4 10             	add    $0x10,%esp
+  8024db:	c9                   	leave
+  8024dc:	c3                   	ret
+
+008024dd <getchar>:
+{
+  8024dd:	55                   	push   %ebp
+  8024de:	89 e5                	mov    %esp,%ebp
+  8024e0:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8024e3:	6a 01                	push   $0x1
+  8024e5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024e8:	50                   	push   %eax
+  8024e9:	6a 00                	push   $0x0
+  8024eb:	e8 66 f2 ff ff       	call   801756 <read>
+	if (r < 0)
+  8024f0:	83 c4 10             	add    $0x10,%esp
+  8024f3:	85 c0                	test   %eax,%eax
+  8024f5:	78 06                	js     8024fd <getchar+0x20>
+	if (r < 1)
+  8024f7:	74 06                	je     8024ff <getchar+0x22>
+	return c;
+  8024f9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024fd:	c9                   	leave
+  8024fe:	c3                   	ret
+		return -E_EOF;
+  8024ff:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802504:	eb f7                	jmp    8024fd <getchar+0x20>
+
+00802506 <iscons>:
+{
+  802506:	55                   	push   %ebp
+  802507:	89 e5                	mov    %esp,%ebp
+  802509:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80250c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80250f:	50                   	push   %eax
+  802510:	ff 75 08             	push   0x8(%ebp)
+  802513:	e8 d8 ef ff ff       	call   8014f0 <fd_lookup>
+  802518:	83 c4 10             	add    $0x10,%esp
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	78 11                	js     802530 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80251f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802522:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802528:	39 10                	cmp    %edx,(%eax)
+  80252a:	0f 94 c0             	sete   %al
+  80252d:	0f b6 c0             	movzbl %al,%eax
+}
+  802530:	c9                   	leave
+  802531:	c3                   	ret
+
+00802532 <opencons>:
+{
+  802532:	55                   	push   %ebp
+  802533:	89 e5                	mov    %esp,%ebp
+  802535:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802538:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80253b:	50                   	push   %eax
+  80253c:	e8 59 ef ff ff       	call   80149a <fd_alloc>
+  802541:	83 c4 10             	add    $0x10,%esp
+  802544:	85 c0                	test   %eax,%eax
+  802546:	78 3a                	js     802582 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802548:	83 ec 04             	sub    $0x4,%esp
+  80254b:	68 07 04 00 00       	push   $0x407
+  802550:	ff 75 f4             	push   -0xc(%ebp)
+  802553:	6a 00                	push   $0x0
+  802555:	e8 b6 e6 ff ff       	call   800c10 <sys_page_alloc>
+  80255a:	83 c4 10             	add    $0x10,%esp
+  80255d:	85 c0                	test   %eax,%eax
+  80255f:	78 21                	js     802582 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802561:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802564:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80256a:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80256c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80256f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802576:	83 ec 0c             	sub    $0xc,%esp
+  802579:	50                   	push   %eax
+  80257a:	e8 f4 ee ff ff       	call   801473 <fd2num>
+  80257f:	83 c4 10             	add    $0x10,%esp
+}
+  802582:	c9                   	leave
+  802583:	c3                   	ret
+
+00802584 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802584:	55                   	push   %ebp
+  802585:	89 e5                	mov    %esp,%ebp
+  802587:	56                   	push   %esi
+  802588:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802589:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80258c:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802592:	e8 da e5 ff ff       	call   800b71 <sys_getenvid>
+  802597:	83 ec 0c             	sub    $0xc,%esp
+  80259a:	ff 75 0c             	push   0xc(%ebp)
+  80259d:	ff 75 08             	push   0x8(%ebp)
+  8025a0:	56                   	push   %esi
+  8025a1:	50                   	push   %eax
+  8025a2:	68 88 30 80 00       	push   $0x803088
+  8025a7:	e8 09 dc ff ff       	call   8001b5 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8025ac:	83 c4 18             	add    $0x18,%esp
+  8025af:	53                   	push   %ebx
+  8025b0:	ff 75 10             	push   0x10(%ebp)
+  8025b3:	e8 ac db ff ff       	call   800164 <vcprintf>
+	cprintf("\n");
+  8025b8:	c7 04 24 74 30 80 00 	movl   $0x803074,(%esp)
+  8025bf:	e8 f1 db ff ff       	call   8001b5 <cprintf>
+  8025c4:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8025c7:	cc                   	int3
+	while (1)
+  8025c8:	eb fd                	jmp    8025c7 <_panic+0x43>
+
+008025ca <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8025ca:	55                   	push   %ebp
+  8025cb:	89 e5                	mov    %esp,%ebp
+  8025cd:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8025d0:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8025d7:	74 0a                	je     8025e3 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8025d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025dc:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8025e1:	c9                   	leave
+  8025e2:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  8025e3:	83 ec 04             	sub    $0x4,%esp
+  8025e6:	6a 07                	push   $0x7
+  8025e8:	68 00 f0 bf ee       	push   $0xeebff000
+  8025ed:	6a 00                	push   $0x0
+  8025ef:	e8 1c e6 ff ff       	call   800c10 <sys_page_alloc>
+  8025f4:	83 c4 10             	add    $0x10,%esp
+  8025f7:	85 c0                	test   %eax,%eax
+  8025f9:	78 28                	js     802623 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  8025fb:	83 ec 08             	sub    $0x8,%esp
+  8025fe:	68 35 26 80 00       	push   $0x802635
+  802603:	6a 00                	push   $0x0
+  802605:	e8 01 e9 ff ff       	call   800f0b <sys_env_set_pgfault_upcall>
+  80260a:	83 c4 10             	add    $0x10,%esp
+  80260d:	85 c0                	test   %eax,%eax
+  80260f:	79 c8                	jns    8025d9 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  802611:	50                   	push   %eax
+  802612:	68 b9 30 80 00       	push   $0x8030b9
+  802617:	6a 24                	push   $0x24
+  802619:	68 ab 30 80 00       	push   $0x8030ab
+  80261e:	e8 61 ff ff ff       	call   802584 <_panic>
+			panic("sys_page_alloc: %e", r);
+  802623:	50                   	push   %eax
+  802624:	68 66 2e 80 00       	push   $0x802e66
+  802629:	6a 21                	push   $0x21
+  80262b:	68 ab 30 80 00       	push   $0x8030ab
+  802630:	e8 4f ff ff ff       	call   802584 <_panic>
+
+00802635 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802635:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802636:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  80263b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80263d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802640:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  802643:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  802647:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  80264a:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  80264e:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  802652:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  802654:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802655:	83 c4 04             	add    $0x4,%esp
+	popf
+  802658:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802659:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80265a:	c3                   	ret
+
+0080265b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80265b:	55                   	push   %ebp
+  80265c:	89 e5                	mov    %esp,%ebp
+  80265e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802661:	89 c2                	mov    %eax,%edx
+  802663:	c1 ea 16             	shr    $0x16,%edx
+  802666:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80266d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802672:	f6 c1 01             	test   $0x1,%cl
+  802675:	74 22                	je     802699 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802677:	c1 e8 0c             	shr    $0xc,%eax
+  80267a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802681:	a8 01                	test   $0x1,%al
+  802683:	74 14                	je     802699 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802685:	c1 e8 0c             	shr    $0xc,%eax
+  802688:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80268b:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802692:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802696:	0f b7 d2             	movzwl %dx,%edx
+}
+  802699:	89 d0                	mov    %edx,%eax
+  80269b:	5d                   	pop    %ebp
+  80269c:	c3                   	ret
+  80269d:	66 90                	xchg   %ax,%ax
+  80269f:	90                   	nop
+
+008026a0 <__udivmoddi4>:
+  8026a0:	55                   	push   %ebp
+  8026a1:	57                   	push   %edi
+  8026a2:	56                   	push   %esi
+  8026a3:	53                   	push   %ebx
+  8026a4:	83 ec 14             	sub    $0x14,%esp
+  8026a7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8026ab:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8026af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026b7:	89 f1                	mov    %esi,%ecx
+  8026b9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8026bd:	09 d9                	or     %ebx,%ecx
+  8026bf:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8026c3:	0f 84 92 00 00 00    	je     80275b <__udivmoddi4+0xbb>
+  8026c9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8026d0:	00 
+  8026d1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8026d6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8026dd:	00 
+  8026de:	89 1c 24             	mov    %ebx,(%esp)
+  8026e1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8026e5:	8d 76 00             	lea    0x0(%esi),%esi
+  8026e8:	89 e9                	mov    %ebp,%ecx
+  8026ea:	89 c3                	mov    %eax,%ebx
+  8026ec:	89 d6                	mov    %edx,%esi
+  8026ee:	31 ff                	xor    %edi,%edi
+  8026f0:	d3 ee                	shr    %cl,%esi
+  8026f2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8026f5:	f6 c1 20             	test   $0x20,%cl
+  8026f8:	0f 45 de             	cmovne %esi,%ebx
+  8026fb:	0f 45 f7             	cmovne %edi,%esi
+  8026fe:	8b 3c 24             	mov    (%esp),%edi
+  802701:	39 fb                	cmp    %edi,%ebx
+  802703:	89 f7                	mov    %esi,%edi
+  802705:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802709:	8b 1c 24             	mov    (%esp),%ebx
+  80270c:	19 f7                	sbb    %esi,%edi
+  80270e:	72 39                	jb     802749 <__udivmoddi4+0xa9>
+  802710:	89 e9                	mov    %ebp,%ecx
+  802712:	89 f7                	mov    %esi,%edi
+  802714:	89 de                	mov    %ebx,%esi
+  802716:	0f a5 df             	shld   %cl,%ebx,%edi
+  802719:	d3 e6                	shl    %cl,%esi
+  80271b:	31 db                	xor    %ebx,%ebx
+  80271d:	f6 c1 20             	test   $0x20,%cl
+  802720:	0f 45 fe             	cmovne %esi,%edi
+  802723:	0f 45 f3             	cmovne %ebx,%esi
+  802726:	29 f0                	sub    %esi,%eax
+  802728:	be 01 00 00 00       	mov    $0x1,%esi
+  80272d:	19 fa                	sbb    %edi,%edx
+  80272f:	31 ff                	xor    %edi,%edi
+  802731:	31 db                	xor    %ebx,%ebx
+  802733:	0f a5 f7             	shld   %cl,%esi,%edi
+  802736:	d3 e6                	shl    %cl,%esi
+  802738:	f6 c1 20             	test   $0x20,%cl
+  80273b:	0f 45 fe             	cmovne %esi,%edi
+  80273e:	0f 45 f3             	cmovne %ebx,%esi
+  802741:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802745:	09 74 24 08          	or     %esi,0x8(%esp)
+  802749:	83 ed 01             	sub    $0x1,%ebp
+  80274c:	73 9a                	jae    8026e8 <__udivmoddi4+0x48>
+  80274e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802752:	85 ff                	test   %edi,%edi
+  802754:	74 05                	je     80275b <__udivmoddi4+0xbb>
+  802756:	89 07                	mov    %eax,(%edi)
+  802758:	89 57 04             	mov    %edx,0x4(%edi)
+  80275b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80275f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802763:	83 c4 14             	add    $0x14,%esp
+  802766:	5b                   	pop    %ebx
+  802767:	5e                   	pop    %esi
+  802768:	5f                   	pop    %edi
+  802769:	5d                   	pop    %ebp
+  80276a:	c3                   	ret
+  80276b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80276f:	90                   	nop
+
+00802770 <__udivdi3>:
+  802770:	55                   	push   %ebp
+  802771:	57                   	push   %edi
+  802772:	56                   	push   %esi
+  802773:	53                   	push   %ebx
+  802774:	83 ec 14             	sub    $0x14,%esp
+  802777:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80277b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80277f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802783:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802787:	89 fb                	mov    %edi,%ebx
+  802789:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80278d:	09 f3                	or     %esi,%ebx
+  80278f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802793:	0f 84 85 00 00 00    	je     80281e <__udivdi3+0xae>
+  802799:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027a0:	00 
+  8027a1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8027a6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027ad:	00 
+  8027ae:	89 34 24             	mov    %esi,(%esp)
+  8027b1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8027b5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027b8:	89 e9                	mov    %ebp,%ecx
+  8027ba:	89 c3                	mov    %eax,%ebx
+  8027bc:	89 d6                	mov    %edx,%esi
+  8027be:	31 ff                	xor    %edi,%edi
+  8027c0:	d3 ee                	shr    %cl,%esi
+  8027c2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8027c5:	f6 c1 20             	test   $0x20,%cl
+  8027c8:	0f 45 de             	cmovne %esi,%ebx
+  8027cb:	0f 45 f7             	cmovne %edi,%esi
+  8027ce:	8b 3c 24             	mov    (%esp),%edi
+  8027d1:	39 fb                	cmp    %edi,%ebx
+  8027d3:	89 f7                	mov    %esi,%edi
+  8027d5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8027d9:	8b 1c 24             	mov    (%esp),%ebx
+  8027dc:	19 f7                	sbb    %esi,%edi
+  8027de:	72 39                	jb     802819 <__udivdi3+0xa9>
+  8027e0:	89 e9                	mov    %ebp,%ecx
+  8027e2:	89 f7                	mov    %esi,%edi
+  8027e4:	89 de                	mov    %ebx,%esi
+  8027e6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8027e9:	d3 e6                	shl    %cl,%esi
+  8027eb:	31 db                	xor    %ebx,%ebx
+  8027ed:	f6 c1 20             	test   $0x20,%cl
+  8027f0:	0f 45 fe             	cmovne %esi,%edi
+  8027f3:	0f 45 f3             	cmovne %ebx,%esi
+  8027f6:	29 f0                	sub    %esi,%eax
+  8027f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8027fd:	19 fa                	sbb    %edi,%edx
+  8027ff:	31 ff                	xor    %edi,%edi
+  802801:	31 db                	xor    %ebx,%ebx
+  802803:	0f a5 f7             	shld   %cl,%esi,%edi
+  802806:	d3 e6                	shl    %cl,%esi
+  802808:	f6 c1 20             	test   $0x20,%cl
+  80280b:	0f 45 fe             	cmovne %esi,%edi
+  80280e:	0f 45 f3             	cmovne %ebx,%esi
+  802811:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802815:	09 74 24 08          	or     %esi,0x8(%esp)
+  802819:	83 ed 01             	sub    $0x1,%ebp
+  80281c:	73 9a                	jae    8027b8 <__udivdi3+0x48>
+  80281e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802822:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802826:	83 c4 14             	add    $0x14,%esp
+  802829:	5b                   	pop    %ebx
+  80282a:	5e                   	pop    %esi
+  80282b:	5f                   	pop    %edi
+  80282c:	5d                   	pop    %ebp
+  80282d:	c3                   	ret
+  80282e:	66 90                	xchg   %ax,%ax
+
+00802830 <__umoddi3>:
+  802830:	57                   	push   %edi
+  802831:	56                   	push   %esi
+  802832:	53                   	push   %ebx
+  802833:	83 ec 08             	sub    $0x8,%esp
+  802836:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80283a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80283e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802842:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802846:	89 f9                	mov    %edi,%ecx
+  802848:	89 34 24             	mov    %esi,(%esp)
+  80284b:	09 f1                	or     %esi,%ecx
+  80284d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802851:	74 53                	je     8028a6 <__umoddi3+0x76>
+  802853:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80285f:	90                   	nop
+  802860:	89 c6                	mov    %eax,%esi
+  802862:	89 d7                	mov    %edx,%edi
+  802864:	31 db                	xor    %ebx,%ebx
+  802866:	d3 ef                	shr    %cl,%edi
+  802868:	0f ad d6             	shrd   %cl,%edx,%esi
+  80286b:	f6 c1 20             	test   $0x20,%cl
+  80286e:	0f 45 f7             	cmovne %edi,%esi
+  802871:	0f 45 fb             	cmovne %ebx,%edi
+  802874:	8b 1c 24             	mov    (%esp),%ebx
+  802877:	39 de                	cmp    %ebx,%esi
+  802879:	89 fb                	mov    %edi,%ebx
+  80287b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80287f:	8b 34 24             	mov    (%esp),%esi
+  802882:	19 fb                	sbb    %edi,%ebx
+  802884:	72 14                	jb     80289a <__umoddi3+0x6a>
+  802886:	0f a5 f7             	shld   %cl,%esi,%edi
+  802889:	31 db                	xor    %ebx,%ebx
+  80288b:	d3 e6                	shl    %cl,%esi
+  80288d:	f6 c1 20             	test   $0x20,%cl
+  802890:	0f 45 fe             	cmovne %esi,%edi
+  802893:	0f 45 f3             	cmovne %ebx,%esi
+  802896:	29 f0                	sub    %esi,%eax
+  802898:	19 fa                	sbb    %edi,%edx
+  80289a:	83 e9 01             	sub    $0x1,%ecx
+  80289d:	73 c1                	jae    802860 <__umoddi3+0x30>
+  80289f:	83 c4 08             	add    $0x8,%esp
+  8028a2:	5b                   	pop    %ebx
+  8028a3:	5e                   	pop    %esi
+  8028a4:	5f                   	pop    %edi
+  8028a5:	c3                   	ret
+  8028a6:	83 c4 08             	add    $0x8,%esp
+  8028a9:	31 c0                	xor    %eax,%eax
+  8028ab:	31 d2                	xor    %edx,%edx
+  8028ad:	5b                   	pop    %ebx
+  8028ae:	5e                   	pop    %esi
+  8028af:	5f                   	pop    %edi
+  8028b0:	c3                   	ret
+  8028b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028bf:	90                   	nop
+
+008028c0 <__divdi3>:
+  8028c0:	55                   	push   %ebp
+  8028c1:	57                   	push   %edi
+  8028c2:	56                   	push   %esi
+  8028c3:	53                   	push   %ebx
+  8028c4:	83 ec 1c             	sub    $0x1c,%esp
+  8028c7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8028cb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8028cf:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8028d3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8028d7:	85 ff                	test   %edi,%edi
+  8028d9:	0f 88 da 00 00 00    	js     8029b9 <__divdi3+0xf9>
+  8028df:	85 db                	test   %ebx,%ebx
+  8028e1:	78 16                	js     8028f9 <__divdi3+0x39>
+  8028e3:	89 dd                	mov    %ebx,%ebp
+  8028e5:	89 c8                	mov    %ecx,%eax
+  8028e7:	89 da                	mov    %ebx,%edx
+  8028e9:	09 cd                	or     %ecx,%ebp
+  8028eb:	0f 85 fd 00 00 00    	jne    8029ee <__divdi3+0x12e>
+  8028f1:	83 c4 1c             	add    $0x1c,%esp
+  8028f4:	5b                   	pop    %ebx
+  8028f5:	5e                   	pop    %esi
+  8028f6:	5f                   	pop    %edi
+  8028f7:	5d                   	pop    %ebp
+  8028f8:	c3                   	ret
+  8028f9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8028fe:	f7 d9                	neg    %ecx
+  802900:	89 f0                	mov    %esi,%eax
+  802902:	89 fa                	mov    %edi,%edx
+  802904:	83 d3 00             	adc    $0x0,%ebx
+  802907:	89 0c 24             	mov    %ecx,(%esp)
+  80290a:	f7 db                	neg    %ebx
+  80290c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802910:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802917:	00 
+  802918:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80291d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802924:	00 
+  802925:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802929:	89 cd                	mov    %ecx,%ebp
+  80292b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80292f:	90                   	nop
+  802930:	89 e9                	mov    %ebp,%ecx
+  802932:	89 c3                	mov    %eax,%ebx
+  802934:	89 d6                	mov    %edx,%esi
+  802936:	31 ff                	xor    %edi,%edi
+  802938:	d3 ee                	shr    %cl,%esi
+  80293a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80293d:	f6 c1 20             	test   $0x20,%cl
+  802940:	0f 45 de             	cmovne %esi,%ebx
+  802943:	0f 45 f7             	cmovne %edi,%esi
+  802946:	8b 3c 24             	mov    (%esp),%edi
+  802949:	39 fb                	cmp    %edi,%ebx
+  80294b:	89 f7                	mov    %esi,%edi
+  80294d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802951:	8b 1c 24             	mov    (%esp),%ebx
+  802954:	19 f7                	sbb    %esi,%edi
+  802956:	72 39                	jb     802991 <__divdi3+0xd1>
+  802958:	89 e9                	mov    %ebp,%ecx
+  80295a:	89 f7                	mov    %esi,%edi
+  80295c:	89 de                	mov    %ebx,%esi
+  80295e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802961:	d3 e6                	shl    %cl,%esi
+  802963:	31 db                	xor    %ebx,%ebx
+  802965:	f6 c1 20             	test   $0x20,%cl
+  802968:	0f 45 fe             	cmovne %esi,%edi
+  80296b:	0f 45 f3             	cmovne %ebx,%esi
+  80296e:	29 f0                	sub    %esi,%eax
+  802970:	be 01 00 00 00       	mov    $0x1,%esi
+  802975:	19 fa                	sbb    %edi,%edx
+  802977:	31 ff                	xor    %edi,%edi
+  802979:	31 db                	xor    %ebx,%ebx
+  80297b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80297e:	d3 e6                	shl    %cl,%esi
+  802980:	f6 c1 20             	test   $0x20,%cl
+  802983:	0f 45 fe             	cmovne %esi,%edi
+  802986:	0f 45 f3             	cmovne %ebx,%esi
+  802989:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80298d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802991:	83 ed 01             	sub    $0x1,%ebp
+  802994:	73 9a                	jae    802930 <__divdi3+0x70>
+  802996:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80299a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80299e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029a2:	85 ed                	test   %ebp,%ebp
+  8029a4:	0f 84 47 ff ff ff    	je     8028f1 <__divdi3+0x31>
+  8029aa:	f7 d8                	neg    %eax
+  8029ac:	83 d2 00             	adc    $0x0,%edx
+  8029af:	83 c4 1c             	add    $0x1c,%esp
+  8029b2:	5b                   	pop    %ebx
+  8029b3:	f7 da                	neg    %edx
+  8029b5:	5e                   	pop    %esi
+  8029b6:	5f                   	pop    %edi
+  8029b7:	5d                   	pop    %ebp
+  8029b8:	c3                   	ret
+  8029b9:	f7 de                	neg    %esi
+  8029bb:	83 d7 00             	adc    $0x0,%edi
+  8029be:	f7 df                	neg    %edi
+  8029c0:	85 db                	test   %ebx,%ebx
+  8029c2:	78 23                	js     8029e7 <__divdi3+0x127>
+  8029c4:	89 dd                	mov    %ebx,%ebp
+  8029c6:	89 c8                	mov    %ecx,%eax
+  8029c8:	89 da                	mov    %ebx,%edx
+  8029ca:	09 cd                	or     %ecx,%ebp
+  8029cc:	0f 84 1f ff ff ff    	je     8028f1 <__divdi3+0x31>
+  8029d2:	89 0c 24             	mov    %ecx,(%esp)
+  8029d5:	89 f0                	mov    %esi,%eax
+  8029d7:	89 fa                	mov    %edi,%edx
+  8029d9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8029de:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8029e2:	e9 29 ff ff ff       	jmp    802910 <__divdi3+0x50>
+  8029e7:	31 ed                	xor    %ebp,%ebp
+  8029e9:	e9 10 ff ff ff       	jmp    8028fe <__divdi3+0x3e>
+  8029ee:	89 0c 24             	mov    %ecx,(%esp)
+  8029f1:	89 f0                	mov    %esi,%eax
+  8029f3:	89 fa                	mov    %edi,%edx
+  8029f5:	31 ed                	xor    %ebp,%ebp
+  8029f7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8029fb:	e9 10 ff ff ff       	jmp    802910 <__divdi3+0x50>
+
+00802a00 <__moddi3>:
+  802a00:	55                   	push   %ebp
+  802a01:	57                   	push   %edi
+  802a02:	56                   	push   %esi
+  802a03:	53                   	push   %ebx
+  802a04:	83 ec 14             	sub    $0x14,%esp
+  802a07:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a0b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a0f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802a13:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802a17:	85 d2                	test   %edx,%edx
+  802a19:	0f 88 9b 00 00 00    	js     802aba <__moddi3+0xba>
+  802a1f:	89 f7                	mov    %esi,%edi
+  802a21:	31 ed                	xor    %ebp,%ebp
+  802a23:	09 cf                	or     %ecx,%edi
+  802a25:	0f 84 83 00 00 00    	je     802aae <__moddi3+0xae>
+  802a2b:	89 cb                	mov    %ecx,%ebx
+  802a2d:	89 f7                	mov    %esi,%edi
+  802a2f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802a33:	f7 db                	neg    %ebx
+  802a35:	83 d7 00             	adc    $0x0,%edi
+  802a38:	f7 df                	neg    %edi
+  802a3a:	0f 49 f7             	cmovns %edi,%esi
+  802a3d:	0f 49 cb             	cmovns %ebx,%ecx
+  802a40:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802a44:	89 0c 24             	mov    %ecx,(%esp)
+  802a47:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a4c:	89 cd                	mov    %ecx,%ebp
+  802a4e:	66 90                	xchg   %ax,%ax
+  802a50:	89 e9                	mov    %ebp,%ecx
+  802a52:	89 c3                	mov    %eax,%ebx
+  802a54:	89 d6                	mov    %edx,%esi
+  802a56:	31 ff                	xor    %edi,%edi
+  802a58:	d3 ee                	shr    %cl,%esi
+  802a5a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a5d:	f6 c1 20             	test   $0x20,%cl
+  802a60:	0f 45 de             	cmovne %esi,%ebx
+  802a63:	0f 45 f7             	cmovne %edi,%esi
+  802a66:	8b 3c 24             	mov    (%esp),%edi
+  802a69:	39 fb                	cmp    %edi,%ebx
+  802a6b:	89 f7                	mov    %esi,%edi
+  802a6d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802a71:	8b 1c 24             	mov    (%esp),%ebx
+  802a74:	19 f7                	sbb    %esi,%edi
+  802a76:	72 1a                	jb     802a92 <__moddi3+0x92>
+  802a78:	89 e9                	mov    %ebp,%ecx
+  802a7a:	89 f7                	mov    %esi,%edi
+  802a7c:	89 de                	mov    %ebx,%esi
+  802a7e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802a81:	d3 e6                	shl    %cl,%esi
+  802a83:	31 db                	xor    %ebx,%ebx
+  802a85:	f6 c1 20             	test   $0x20,%cl
+  802a88:	0f 45 fe             	cmovne %esi,%edi
+  802a8b:	0f 45 f3             	cmovne %ebx,%esi
+  802a8e:	29 f0                	sub    %esi,%eax
+  802a90:	19 fa                	sbb    %edi,%edx
+  802a92:	83 ed 01             	sub    $0x1,%ebp
+  802a95:	73 b9                	jae    802a50 <__moddi3+0x50>
+  802a97:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802a9b:	85 ed                	test   %ebp,%ebp
+  802a9d:	74 07                	je     802aa6 <__moddi3+0xa6>
+  802a9f:	f7 d8                	neg    %eax
+  802aa1:	83 d2 00             	adc    $0x0,%edx
+  802aa4:	f7 da                	neg    %edx
+  802aa6:	83 c4 14             	add    $0x14,%esp
+  802aa9:	5b                   	pop    %ebx
+  802aaa:	5e                   	pop    %esi
+  802aab:	5f                   	pop    %edi
+  802aac:	5d                   	pop    %ebp
+  802aad:	c3                   	ret
+  802aae:	83 c4 14             	add    $0x14,%esp
+  802ab1:	31 c0                	xor    %eax,%eax
+  802ab3:	31 d2                	xor    %edx,%edx
+  802ab5:	5b                   	pop    %ebx
+  802ab6:	5e                   	pop    %esi
+  802ab7:	5f                   	pop    %edi
+  802ab8:	5d                   	pop    %ebp
+  802ab9:	c3                   	ret
+  802aba:	89 f7                	mov    %esi,%edi
+  802abc:	09 cf                	or     %ecx,%edi
+  802abe:	74 11                	je     802ad1 <__moddi3+0xd1>
+  802ac0:	f7 d8                	neg    %eax
+  802ac2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802ac7:	83 d2 00             	adc    $0x0,%edx
+  802aca:	f7 da                	neg    %edx
+  802acc:	e9 5a ff ff ff       	jmp    802a2b <__moddi3+0x2b>
+  802ad1:	31 c0                	xor    %eax,%eax
+  802ad3:	31 d2                	xor    %edx,%edx
+  802ad5:	eb c8                	jmp    802a9f <__moddi3+0x9f>
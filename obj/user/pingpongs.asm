@@ -0,0 +1,6146 @@
+
+obj/user/pingpongs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 d2 00 00 00       	call   800103 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t val;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t who;
+	uint32_t i;
+
+	i = 0;
+	if ((who = sfork()) != 0) {
+  80003c:	e8 7f 13 00 00       	call   8013c0 <sfork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 74                	jne    8000bc <umain+0x89>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		ipc_recv(&who, 0, 0);
+  800048:	83 ec 04             	sub    $0x4,%esp
+  80004b:	6a 00                	push   $0x0
+  80004d:	6a 00                	push   $0x0
+  80004f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800052:	50                   	push   %eax
+  800053:	e8 82 13 00 00       	call   8013da <ipc_recv>
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800058:	8b 1d 0c 50 80 00    	mov    0x80500c,%ebx
+  80005e:	8b 7b 4c             	mov    0x4c(%ebx),%edi
+  800061:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800064:	a1 08 50 80 00       	mov    0x805008,%eax
+  800069:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80006c:	e8 43 0b 00 00       	call   800bb4 <sys_getenvid>
+  800071:	83 c4 08             	add    $0x8,%esp
+  800074:	57                   	push   %edi
+  800075:	53                   	push   %ebx
+  800076:	56                   	push   %esi
+  800077:	ff 75 d4             	push   -0x2c(%ebp)
+  80007a:	50                   	push   %eax
+  80007b:	68 50 2b 80 00       	push   $0x802b50
+  800080:	e8 73 01 00 00       	call   8001f8 <cprintf>
+		if (val == 10)
+  800085:	a1 08 50 80 00       	mov    0x805008,%eax
+  80008a:	83 c4 20             	add    $0x20,%esp
+  80008d:	83 f8 0a             	cmp    $0xa,%eax
+  800090:	74 22                	je     8000b4 <umain+0x81>
+			return;
+		++val;
+  800092:	83 c0 01             	add    $0x1,%eax
+  800095:	a3 08 50 80 00       	mov    %eax,0x805008
+		ipc_send(who, 0, 0, 0);
+  80009a:	6a 00                	push   $0x0
+  80009c:	6a 00                	push   $0x0
+  80009e:	6a 00                	push   $0x0
+  8000a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8000a3:	e8 aa 13 00 00       	call   801452 <ipc_send>
+		if (val == 10)
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	83 3d 08 50 80 00 0a 	cmpl   $0xa,0x805008
+  8000b2:	75 94                	jne    800048 <umain+0x15>
+			return;
+	}
+
+}
+  8000b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b7:	5b                   	pop    %ebx
+  8000b8:	5e                   	pop    %esi
+  8000b9:	5f                   	pop    %edi
+  8000ba:	5d                   	pop    %ebp
+  8000bb:	c3                   	ret
+		cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  8000bc:	8b 1d 0c 50 80 00    	mov    0x80500c,%ebx
+  8000c2:	e8 ed 0a 00 00       	call   800bb4 <sys_getenvid>
+  8000c7:	83 ec 04             	sub    $0x4,%esp
+  8000ca:	53                   	push   %ebx
+  8000cb:	50                   	push   %eax
+  8000cc:	68 20 2b 80 00       	push   $0x802b20
+  8000d1:	e8 22 01 00 00       	call   8001f8 <cprintf>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000d6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8000d9:	e8 d6 0a 00 00       	call   800bb4 <sys_getenvid>
+  8000de:	83 c4 0c             	add    $0xc,%esp
+  8000e1:	53                   	push   %ebx
+  8000e2:	50                   	push   %eax
+  8000e3:	68 3a 2b 80 00       	push   $0x802b3a
+  8000e8:	e8 0b 01 00 00       	call   8001f8 <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	6a 00                	push   $0x0
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000f6:	e8 57 13 00 00       	call   801452 <ipc_send>
+  8000fb:	83 c4 20             	add    $0x20,%esp
+  8000fe:	e9 45 ff ff ff       	jmp    800048 <umain+0x15>
+
+00800103 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800103:	55                   	push   %ebp
+  800104:	89 e5                	mov    %esp,%ebp
+  800106:	56                   	push   %esi
+  800107:	53                   	push   %ebx
+  800108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80010b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80010e:	e8 a1 0a 00 00       	call   800bb4 <sys_getenvid>
+  800113:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800118:	c1 e0 09             	shl    $0x9,%eax
+  80011b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800120:	a3 0c 50 80 00       	mov    %eax,0x80500c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800125:	85 db                	test   %ebx,%ebx
+  800127:	7e 07                	jle    800130 <libmain+0x2d>
+		binaryname = argv[0];
+  800129:	8b 06                	mov    (%esi),%eax
+  80012b:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800130:	83 ec 08             	sub    $0x8,%esp
+  800133:	56                   	push   %esi
+  800134:	53                   	push   %ebx
+  800135:	e8 f9 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80013a:	e8 0a 00 00 00       	call   800149 <exit>
+}
+  80013f:	83 c4 10             	add    $0x10,%esp
+  800142:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800145:	5b                   	pop    %ebx
+  800146:	5e                   	pop    %esi
+  800147:	5d                   	pop    %ebp
+  800148:	c3                   	ret
+
+00800149 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800149:	55                   	push   %ebp
+  80014a:	89 e5                	mov    %esp,%ebp
+  80014c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80014f:	e8 36 15 00 00       	call   80168a <close_all>
+	sys_env_destroy(0);
+  800154:	83 ec 0c             	sub    $0xc,%esp
+  800157:	6a 00                	push   $0x0
+  800159:	e8 15 0a 00 00       	call   800b73 <sys_env_destroy>
+}
+  80015e:	83 c4 10             	add    $0x10,%esp
+  800161:	c9                   	leave
+  800162:	c3                   	ret
+
+00800163 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800163:	55                   	push   %ebp
+  800164:	89 e5                	mov    %esp,%ebp
+  800166:	53                   	push   %ebx
+  800167:	83 ec 04             	sub    $0x4,%esp
+  80016a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80016d:	8b 13                	mov    (%ebx),%edx
+  80016f:	8d 42 01             	lea    0x1(%edx),%eax
+  800172:	89 03                	mov    %eax,(%ebx)
+  800174:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800177:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80017b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800180:	74 09                	je     80018b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800182:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800186:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800189:	c9                   	leave
+  80018a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80018b:	83 ec 08             	sub    $0x8,%esp
+  80018e:	68 ff 00 00 00       	push   $0xff
+  800193:	8d 43 08             	lea    0x8(%ebx),%eax
+  800196:	50                   	push   %eax
+  800197:	e8 7a 09 00 00       	call   800b16 <sys_cputs>
+		b->idx = 0;
+  80019c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001a2:	83 c4 10             	add    $0x10,%esp
+  8001a5:	eb db                	jmp    800182 <putch+0x1f>
+
+008001a7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001a7:	55                   	push   %ebp
+  8001a8:	89 e5                	mov    %esp,%ebp
+  8001aa:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001b0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b7:	00 00 00 
+	b.cnt = 0;
+  8001ba:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001c1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001c4:	ff 75 0c             	push   0xc(%ebp)
+  8001c7:	ff 75 08             	push   0x8(%ebp)
+  8001ca:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001d0:	50                   	push   %eax
+  8001d1:	68 63 01 80 00       	push   $0x800163
+  8001d6:	e8 14 01 00 00       	call   8002ef <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001db:	83 c4 08             	add    $0x8,%esp
+  8001de:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001e4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ea:	50                   	push   %eax
+  8001eb:	e8 26 09 00 00       	call   800b16 <sys_cputs>
+
+	return b.cnt;
+}
+  8001f0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f6:	c9                   	leave
+  8001f7:	c3                   	ret
+
+008001f8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001f8:	55                   	push   %ebp
+  8001f9:	89 e5                	mov    %esp,%ebp
+  8001fb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001fe:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800201:	50                   	push   %eax
+  800202:	ff 75 08             	push   0x8(%ebp)
+  800205:	e8 9d ff ff ff       	call   8001a7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80020a:	c9                   	leave
+  80020b:	c3                   	ret
+
+0080020c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80020c:	55                   	push   %ebp
+  80020d:	89 e5                	mov    %esp,%ebp
+  80020f:	57                   	push   %edi
+  800210:	56                   	push   %esi
+  800211:	53                   	push   %ebx
+  800212:	83 ec 1c             	sub    $0x1c,%esp
+  800215:	89 c7                	mov    %eax,%edi
+  800217:	89 d6                	mov    %edx,%esi
+  800219:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80021f:	89 d1                	mov    %edx,%ecx
+  800221:	89 c2                	mov    %eax,%edx
+  800223:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800226:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800229:	8b 45 10             	mov    0x10(%ebp),%eax
+  80022c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80022f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800232:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800239:	39 c2                	cmp    %eax,%edx
+  80023b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80023e:	72 3e                	jb     80027e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  800243:	ff 75 18             	push   0x18(%ebp)
+  800246:	83 eb 01             	sub    $0x1,%ebx
+  800249:	53                   	push   %ebx
+  80024a:	50                   	push   %eax
+  80024b:	83 ec 08             	sub    $0x8,%esp
+  80024e:	ff 75 e4             	push   -0x1c(%ebp)
+  800251:	ff 75 e0             	push   -0x20(%ebp)
+  800254:	ff 75 dc             	push   -0x24(%ebp)
+  800257:	ff 75 d8             	push   -0x28(%ebp)
+  80025a:	e8 51 25 00 00       	call   8027b0 <__udivdi3>
+  80025f:	83 c4 18             	add    $0x18,%esp
+  800262:	52                   	push   %edx
+  800263:	50                   	push   %eax
+  800264:	89 f2                	mov    %esi,%edx
+  800266:	89 f8                	mov    %edi,%eax
+  800268:	e8 9f ff ff ff       	call   80020c <printnum>
+  80026d:	83 c4 20             	add    $0x20,%esp
+  800270:	eb 13                	jmp    800285 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800272:	83 ec 08             	sub    $0x8,%esp
+  800275:	56                   	push   %esi
+  800276:	ff 75 18             	push   0x18(%ebp)
+  800279:	ff d7                	call   *%edi
+  80027b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80027e:	83 eb 01             	sub    $0x1,%ebx
+  800281:	85 db                	test   %ebx,%ebx
+  800283:	7f ed                	jg     800272 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800285:	83 ec 08             	sub    $0x8,%esp
+  800288:	56                   	push   %esi
+  800289:	83 ec 04             	sub    $0x4,%esp
+  80028c:	ff 75 e4             	push   -0x1c(%ebp)
+  80028f:	ff 75 e0             	push   -0x20(%ebp)
+  800292:	ff 75 dc             	push   -0x24(%ebp)
+  800295:	ff 75 d8             	push   -0x28(%ebp)
+  800298:	e8 d3 25 00 00       	call   802870 <__umoddi3>
+  80029d:	83 c4 14             	add    $0x14,%esp
+  8002a0:	0f be 80 80 2b 80 00 	movsbl 0x802b80(%eax),%eax
+  8002a7:	50                   	push   %eax
+  8002a8:	ff d7                	call   *%edi
+}
+  8002aa:	83 c4 10             	add    $0x10,%esp
+  8002ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b0:	5b                   	pop    %ebx
+  8002b1:	5e                   	pop    %esi
+  8002b2:	5f                   	pop    %edi
+  8002b3:	5d                   	pop    %ebp
+  8002b4:	c3                   	ret
+
+008002b5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002bb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002bf:	8b 10                	mov    (%eax),%edx
+  8002c1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002c4:	73 0a                	jae    8002d0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002c6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002c9:	89 08                	mov    %ecx,(%eax)
+  8002cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ce:	88 02                	mov    %al,(%edx)
+}
+  8002d0:	5d                   	pop    %ebp
+  8002d1:	c3                   	ret
+
+008002d2 <printfmt>:
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002d8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002db:	50                   	push   %eax
+  8002dc:	ff 75 10             	push   0x10(%ebp)
+  8002df:	ff 75 0c             	push   0xc(%ebp)
+  8002e2:	ff 75 08             	push   0x8(%ebp)
+  8002e5:	e8 05 00 00 00       	call   8002ef <vprintfmt>
+}
+  8002ea:	83 c4 10             	add    $0x10,%esp
+  8002ed:	c9                   	leave
+  8002ee:	c3                   	ret
+
+008002ef <vprintfmt>:
+{
+  8002ef:	55                   	push   %ebp
+  8002f0:	89 e5                	mov    %esp,%ebp
+  8002f2:	57                   	push   %edi
+  8002f3:	56                   	push   %esi
+  8002f4:	53                   	push   %ebx
+  8002f5:	83 ec 2c             	sub    $0x2c,%esp
+  8002f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002fe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800301:	eb 0a                	jmp    80030d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800303:	83 ec 08             	sub    $0x8,%esp
+  800306:	53                   	push   %ebx
+  800307:	50                   	push   %eax
+  800308:	ff d6                	call   *%esi
+  80030a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80030d:	83 c7 01             	add    $0x1,%edi
+  800310:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800314:	83 f8 25             	cmp    $0x25,%eax
+  800317:	74 0c                	je     800325 <vprintfmt+0x36>
+			if (ch == '\0')
+  800319:	85 c0                	test   %eax,%eax
+  80031b:	75 e6                	jne    800303 <vprintfmt+0x14>
+}
+  80031d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800320:	5b                   	pop    %ebx
+  800321:	5e                   	pop    %esi
+  800322:	5f                   	pop    %edi
+  800323:	5d                   	pop    %ebp
+  800324:	c3                   	ret
+		padc = ' ';
+  800325:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800329:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800330:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800337:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80033e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800343:	8d 47 01             	lea    0x1(%edi),%eax
+  800346:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800349:	0f b6 17             	movzbl (%edi),%edx
+  80034c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80034f:	3c 55                	cmp    $0x55,%al
+  800351:	0f 87 cf 03 00 00    	ja     800726 <vprintfmt+0x437>
+  800357:	0f b6 c0             	movzbl %al,%eax
+  80035a:	ff 24 85 c0 2c 80 00 	jmp    *0x802cc0(,%eax,4)
+  800361:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800364:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800368:	eb d9                	jmp    800343 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80036a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80036d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800371:	eb d0                	jmp    800343 <vprintfmt+0x54>
+  800373:	0f b6 d2             	movzbl %dl,%edx
+  800376:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800381:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800384:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800388:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80038b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80038e:	83 f9 09             	cmp    $0x9,%ecx
+  800391:	77 55                	ja     8003e8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800393:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800396:	eb e9                	jmp    800381 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800398:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039b:	8b 00                	mov    (%eax),%eax
+  80039d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003ac:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003b0:	79 91                	jns    800343 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003b2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003bf:	eb 82                	jmp    800343 <vprintfmt+0x54>
+			if (width < 0)
+  8003c1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003c4:	85 d2                	test   %edx,%edx
+  8003c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cb:	0f 49 c2             	cmovns %edx,%eax
+  8003ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d4:	e9 6a ff ff ff       	jmp    800343 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003dc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003e3:	e9 5b ff ff ff       	jmp    800343 <vprintfmt+0x54>
+  8003e8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ee:	eb bc                	jmp    8003ac <vprintfmt+0xbd>
+			lflag++;
+  8003f0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f6:	e9 48 ff ff ff       	jmp    800343 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fe:	8d 78 04             	lea    0x4(%eax),%edi
+  800401:	83 ec 08             	sub    $0x8,%esp
+  800404:	53                   	push   %ebx
+  800405:	ff 30                	push   (%eax)
+  800407:	ff d6                	call   *%esi
+			break;
+  800409:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80040c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80040f:	e9 b1 02 00 00       	jmp    8006c5 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800414:	8b 45 14             	mov    0x14(%ebp),%eax
+  800417:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80041a:	8b 10                	mov    (%eax),%edx
+  80041c:	89 d0                	mov    %edx,%eax
+  80041e:	f7 d8                	neg    %eax
+  800420:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800423:	83 f8 0f             	cmp    $0xf,%eax
+  800426:	7f 23                	jg     80044b <vprintfmt+0x15c>
+  800428:	8b 14 85 20 2e 80 00 	mov    0x802e20(,%eax,4),%edx
+  80042f:	85 d2                	test   %edx,%edx
+  800431:	74 18                	je     80044b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800433:	52                   	push   %edx
+  800434:	68 69 30 80 00       	push   $0x803069
+  800439:	53                   	push   %ebx
+  80043a:	56                   	push   %esi
+  80043b:	e8 92 fe ff ff       	call   8002d2 <printfmt>
+  800440:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800443:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800446:	e9 7a 02 00 00       	jmp    8006c5 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80044b:	50                   	push   %eax
+  80044c:	68 98 2b 80 00       	push   $0x802b98
+  800451:	53                   	push   %ebx
+  800452:	56                   	push   %esi
+  800453:	e8 7a fe ff ff       	call   8002d2 <printfmt>
+  800458:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80045b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80045e:	e9 62 02 00 00       	jmp    8006c5 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800463:	8b 45 14             	mov    0x14(%ebp),%eax
+  800466:	83 c0 04             	add    $0x4,%eax
+  800469:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80046c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800471:	85 c9                	test   %ecx,%ecx
+  800473:	b8 91 2b 80 00       	mov    $0x802b91,%eax
+  800478:	0f 45 c1             	cmovne %ecx,%eax
+  80047b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80047e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800482:	7e 06                	jle    80048a <vprintfmt+0x19b>
+  800484:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800488:	75 0b                	jne    800495 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80048a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80048d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800490:	89 75 08             	mov    %esi,0x8(%ebp)
+  800493:	eb 5c                	jmp    8004f1 <vprintfmt+0x202>
+  800495:	83 ec 08             	sub    $0x8,%esp
+  800498:	ff 75 d0             	push   -0x30(%ebp)
+  80049b:	ff 75 cc             	push   -0x34(%ebp)
+  80049e:	e8 20 03 00 00       	call   8007c3 <strnlen>
+  8004a3:	89 c2                	mov    %eax,%edx
+  8004a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004a8:	29 d0                	sub    %edx,%eax
+  8004aa:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004ad:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b9:	eb 0e                	jmp    8004c9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004bb:	83 ec 08             	sub    $0x8,%esp
+  8004be:	53                   	push   %ebx
+  8004bf:	57                   	push   %edi
+  8004c0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c3:	83 ee 01             	sub    $0x1,%esi
+  8004c6:	83 c4 10             	add    $0x10,%esp
+  8004c9:	85 f6                	test   %esi,%esi
+  8004cb:	7f ee                	jg     8004bb <vprintfmt+0x1cc>
+  8004cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d3:	85 c0                	test   %eax,%eax
+  8004d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004da:	0f 49 d0             	cmovns %eax,%edx
+  8004dd:	29 d0                	sub    %edx,%eax
+  8004df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e2:	eb a6                	jmp    80048a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004e4:	83 ec 08             	sub    $0x8,%esp
+  8004e7:	53                   	push   %ebx
+  8004e8:	52                   	push   %edx
+  8004e9:	ff 55 08             	call   *0x8(%ebp)
+  8004ec:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ef:	89 f1                	mov    %esi,%ecx
+  8004f1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004f4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004f8:	0f be d0             	movsbl %al,%edx
+  8004fb:	85 d2                	test   %edx,%edx
+  8004fd:	74 28                	je     800527 <vprintfmt+0x238>
+  8004ff:	85 ff                	test   %edi,%edi
+  800501:	78 05                	js     800508 <vprintfmt+0x219>
+  800503:	83 ef 01             	sub    $0x1,%edi
+  800506:	78 30                	js     800538 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800508:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80050c:	74 d6                	je     8004e4 <vprintfmt+0x1f5>
+  80050e:	0f be c0             	movsbl %al,%eax
+  800511:	83 e8 20             	sub    $0x20,%eax
+  800514:	83 f8 5e             	cmp    $0x5e,%eax
+  800517:	76 cb                	jbe    8004e4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800519:	83 ec 08             	sub    $0x8,%esp
+  80051c:	53                   	push   %ebx
+  80051d:	6a 3f                	push   $0x3f
+  80051f:	ff 55 08             	call   *0x8(%ebp)
+  800522:	83 c4 10             	add    $0x10,%esp
+  800525:	eb c8                	jmp    8004ef <vprintfmt+0x200>
+  800527:	8b 75 08             	mov    0x8(%ebp),%esi
+  80052a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80052d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800530:	01 d0                	add    %edx,%eax
+  800532:	29 c8                	sub    %ecx,%eax
+  800534:	89 c7                	mov    %eax,%edi
+  800536:	eb 13                	jmp    80054b <vprintfmt+0x25c>
+  800538:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053b:	eb ed                	jmp    80052a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80053d:	83 ec 08             	sub    $0x8,%esp
+  800540:	53                   	push   %ebx
+  800541:	6a 20                	push   $0x20
+  800543:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800545:	83 ef 01             	sub    $0x1,%edi
+  800548:	83 c4 10             	add    $0x10,%esp
+  80054b:	85 ff                	test   %edi,%edi
+  80054d:	7f ee                	jg     80053d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80054f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800552:	89 45 14             	mov    %eax,0x14(%ebp)
+  800555:	e9 6b 01 00 00       	jmp    8006c5 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80055a:	83 f9 01             	cmp    $0x1,%ecx
+  80055d:	7f 1f                	jg     80057e <vprintfmt+0x28f>
+	else if (lflag)
+  80055f:	85 c9                	test   %ecx,%ecx
+  800561:	74 67                	je     8005ca <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800563:	8b 45 14             	mov    0x14(%ebp),%eax
+  800566:	8b 00                	mov    (%eax),%eax
+  800568:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056b:	89 c1                	mov    %eax,%ecx
+  80056d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800570:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	8d 40 04             	lea    0x4(%eax),%eax
+  800579:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057c:	eb 17                	jmp    800595 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80057e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800581:	8b 50 04             	mov    0x4(%eax),%edx
+  800584:	8b 00                	mov    (%eax),%eax
+  800586:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800589:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80058c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058f:	8d 40 08             	lea    0x8(%eax),%eax
+  800592:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800595:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800598:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80059b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005a0:	85 c9                	test   %ecx,%ecx
+  8005a2:	0f 89 03 01 00 00    	jns    8006ab <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005a8:	83 ec 08             	sub    $0x8,%esp
+  8005ab:	53                   	push   %ebx
+  8005ac:	6a 2d                	push   $0x2d
+  8005ae:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005b0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b6:	f7 da                	neg    %edx
+  8005b8:	83 d1 00             	adc    $0x0,%ecx
+  8005bb:	f7 d9                	neg    %ecx
+  8005bd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005c0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c5:	e9 e1 00 00 00       	jmp    8006ab <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cd:	8b 00                	mov    (%eax),%eax
+  8005cf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d2:	89 c1                	mov    %eax,%ecx
+  8005d4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005d7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e3:	eb b0                	jmp    800595 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005e5:	83 f9 01             	cmp    $0x1,%ecx
+  8005e8:	7f 1e                	jg     800608 <vprintfmt+0x319>
+	else if (lflag)
+  8005ea:	85 c9                	test   %ecx,%ecx
+  8005ec:	74 32                	je     800620 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f1:	8b 10                	mov    (%eax),%edx
+  8005f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005fe:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800603:	e9 a3 00 00 00       	jmp    8006ab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060b:	8b 10                	mov    (%eax),%edx
+  80060d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800610:	8d 40 08             	lea    0x8(%eax),%eax
+  800613:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800616:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80061b:	e9 8b 00 00 00       	jmp    8006ab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8b 10                	mov    (%eax),%edx
+  800625:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062a:	8d 40 04             	lea    0x4(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800630:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800635:	eb 74                	jmp    8006ab <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800637:	83 f9 01             	cmp    $0x1,%ecx
+  80063a:	7f 1b                	jg     800657 <vprintfmt+0x368>
+	else if (lflag)
+  80063c:	85 c9                	test   %ecx,%ecx
+  80063e:	74 2c                	je     80066c <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8b 10                	mov    (%eax),%edx
+  800645:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064a:	8d 40 04             	lea    0x4(%eax),%eax
+  80064d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800650:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800655:	eb 54                	jmp    8006ab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8b 10                	mov    (%eax),%edx
+  80065c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80065f:	8d 40 08             	lea    0x8(%eax),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800665:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80066a:	eb 3f                	jmp    8006ab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 10                	mov    (%eax),%edx
+  800671:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800676:	8d 40 04             	lea    0x4(%eax),%eax
+  800679:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80067c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800681:	eb 28                	jmp    8006ab <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800683:	83 ec 08             	sub    $0x8,%esp
+  800686:	53                   	push   %ebx
+  800687:	6a 30                	push   $0x30
+  800689:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80068b:	83 c4 08             	add    $0x8,%esp
+  80068e:	53                   	push   %ebx
+  80068f:	6a 78                	push   $0x78
+  800691:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80069d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006ab:	83 ec 0c             	sub    $0xc,%esp
+  8006ae:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006b2:	50                   	push   %eax
+  8006b3:	ff 75 e0             	push   -0x20(%ebp)
+  8006b6:	57                   	push   %edi
+  8006b7:	51                   	push   %ecx
+  8006b8:	52                   	push   %edx
+  8006b9:	89 da                	mov    %ebx,%edx
+  8006bb:	89 f0                	mov    %esi,%eax
+  8006bd:	e8 4a fb ff ff       	call   80020c <printnum>
+			break;
+  8006c2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006c8:	e9 40 fc ff ff       	jmp    80030d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006cd:	83 f9 01             	cmp    $0x1,%ecx
+  8006d0:	7f 1b                	jg     8006ed <vprintfmt+0x3fe>
+	else if (lflag)
+  8006d2:	85 c9                	test   %ecx,%ecx
+  8006d4:	74 2c                	je     800702 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d9:	8b 10                	mov    (%eax),%edx
+  8006db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006eb:	eb be                	jmp    8006ab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8b 10                	mov    (%eax),%edx
+  8006f2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006fb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800700:	eb a9                	jmp    8006ab <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070c:	8d 40 04             	lea    0x4(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800712:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800717:	eb 92                	jmp    8006ab <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800719:	83 ec 08             	sub    $0x8,%esp
+  80071c:	53                   	push   %ebx
+  80071d:	6a 25                	push   $0x25
+  80071f:	ff d6                	call   *%esi
+			break;
+  800721:	83 c4 10             	add    $0x10,%esp
+  800724:	eb 9f                	jmp    8006c5 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800726:	83 ec 08             	sub    $0x8,%esp
+  800729:	53                   	push   %ebx
+  80072a:	6a 25                	push   $0x25
+  80072c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80072e:	83 c4 10             	add    $0x10,%esp
+  800731:	89 f8                	mov    %edi,%eax
+  800733:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800737:	74 05                	je     80073e <vprintfmt+0x44f>
+  800739:	83 e8 01             	sub    $0x1,%eax
+  80073c:	eb f5                	jmp    800733 <vprintfmt+0x444>
+  80073e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800741:	eb 82                	jmp    8006c5 <vprintfmt+0x3d6>
+
+00800743 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800743:	55                   	push   %ebp
+  800744:	89 e5                	mov    %esp,%ebp
+  800746:	83 ec 18             	sub    $0x18,%esp
+  800749:	8b 45 08             	mov    0x8(%ebp),%eax
+  80074c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80074f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800752:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800756:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800759:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800760:	85 c0                	test   %eax,%eax
+  800762:	74 26                	je     80078a <vsnprintf+0x47>
+  800764:	85 d2                	test   %edx,%edx
+  800766:	7e 22                	jle    80078a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800768:	ff 75 14             	push   0x14(%ebp)
+  80076b:	ff 75 10             	push   0x10(%ebp)
+  80076e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800771:	50                   	push   %eax
+  800772:	68 b5 02 80 00       	push   $0x8002b5
+  800777:	e8 73 fb ff ff       	call   8002ef <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80077c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80077f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800782:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800785:	83 c4 10             	add    $0x10,%esp
+}
+  800788:	c9                   	leave
+  800789:	c3                   	ret
+		return -E_INVAL;
+  80078a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80078f:	eb f7                	jmp    800788 <vsnprintf+0x45>
+
+00800791 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800791:	55                   	push   %ebp
+  800792:	89 e5                	mov    %esp,%ebp
+  800794:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800797:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80079a:	50                   	push   %eax
+  80079b:	ff 75 10             	push   0x10(%ebp)
+  80079e:	ff 75 0c             	push   0xc(%ebp)
+  8007a1:	ff 75 08             	push   0x8(%ebp)
+  8007a4:	e8 9a ff ff ff       	call   800743 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007a9:	c9                   	leave
+  8007aa:	c3                   	ret
+
+008007ab <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007ab:	55                   	push   %ebp
+  8007ac:	89 e5                	mov    %esp,%ebp
+  8007ae:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b6:	eb 03                	jmp    8007bb <strlen+0x10>
+		n++;
+  8007b8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007bb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007bf:	75 f7                	jne    8007b8 <strlen+0xd>
+	return n;
+}
+  8007c1:	5d                   	pop    %ebp
+  8007c2:	c3                   	ret
+
+008007c3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007c3:	55                   	push   %ebp
+  8007c4:	89 e5                	mov    %esp,%ebp
+  8007c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d1:	eb 03                	jmp    8007d6 <strnlen+0x13>
+		n++;
+  8007d3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d6:	39 d0                	cmp    %edx,%eax
+  8007d8:	74 08                	je     8007e2 <strnlen+0x1f>
+  8007da:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007de:	75 f3                	jne    8007d3 <strnlen+0x10>
+  8007e0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007e2:	89 d0                	mov    %edx,%eax
+  8007e4:	5d                   	pop    %ebp
+  8007e5:	c3                   	ret
+
+008007e6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	53                   	push   %ebx
+  8007ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007f9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007fc:	83 c0 01             	add    $0x1,%eax
+  8007ff:	84 d2                	test   %dl,%dl
+  800801:	75 f2                	jne    8007f5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800803:	89 c8                	mov    %ecx,%eax
+  800805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800808:	c9                   	leave
+  800809:	c3                   	ret
+
+0080080a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80080a:	55                   	push   %ebp
+  80080b:	89 e5                	mov    %esp,%ebp
+  80080d:	53                   	push   %ebx
+  80080e:	83 ec 10             	sub    $0x10,%esp
+  800811:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800814:	53                   	push   %ebx
+  800815:	e8 91 ff ff ff       	call   8007ab <strlen>
+  80081a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80081d:	ff 75 0c             	push   0xc(%ebp)
+  800820:	01 d8                	add    %ebx,%eax
+  800822:	50                   	push   %eax
+  800823:	e8 be ff ff ff       	call   8007e6 <strcpy>
+	return dst;
+}
+  800828:	89 d8                	mov    %ebx,%eax
+  80082a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80082d:	c9                   	leave
+  80082e:	c3                   	ret
+
+0080082f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80082f:	55                   	push   %ebp
+  800830:	89 e5                	mov    %esp,%ebp
+  800832:	56                   	push   %esi
+  800833:	53                   	push   %ebx
+  800834:	8b 75 08             	mov    0x8(%ebp),%esi
+  800837:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80083a:	89 f3                	mov    %esi,%ebx
+  80083c:	03 5d 10             	add    0x10(%ebp),%ebx
+  80083f:	89 f0                	mov    %esi,%eax
+  800841:	eb 0f                	jmp    800852 <strncpy+0x23>
+		*dst++ = *src;
+  800843:	83 c0 01             	add    $0x1,%eax
+  800846:	0f b6 0a             	movzbl (%edx),%ecx
+  800849:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80084c:	80 f9 01             	cmp    $0x1,%cl
+  80084f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800852:	39 d8                	cmp    %ebx,%eax
+  800854:	75 ed                	jne    800843 <strncpy+0x14>
+	}
+	return ret;
+}
+  800856:	89 f0                	mov    %esi,%eax
+  800858:	5b                   	pop    %ebx
+  800859:	5e                   	pop    %esi
+  80085a:	5d                   	pop    %ebp
+  80085b:	c3                   	ret
+
+0080085c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80085c:	55                   	push   %ebp
+  80085d:	89 e5                	mov    %esp,%ebp
+  80085f:	56                   	push   %esi
+  800860:	53                   	push   %ebx
+  800861:	8b 75 08             	mov    0x8(%ebp),%esi
+  800864:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800867:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80086a:	89 f0                	mov    %esi,%eax
+  80086c:	85 d2                	test   %edx,%edx
+  80086e:	74 21                	je     800891 <strlcpy+0x35>
+  800870:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800874:	89 f2                	mov    %esi,%edx
+  800876:	eb 09                	jmp    800881 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800878:	83 c1 01             	add    $0x1,%ecx
+  80087b:	83 c2 01             	add    $0x1,%edx
+  80087e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800881:	39 c2                	cmp    %eax,%edx
+  800883:	74 09                	je     80088e <strlcpy+0x32>
+  800885:	0f b6 19             	movzbl (%ecx),%ebx
+  800888:	84 db                	test   %bl,%bl
+  80088a:	75 ec                	jne    800878 <strlcpy+0x1c>
+  80088c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80088e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800891:	29 f0                	sub    %esi,%eax
+}
+  800893:	5b                   	pop    %ebx
+  800894:	5e                   	pop    %esi
+  800895:	5d                   	pop    %ebp
+  800896:	c3                   	ret
+
+00800897 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800897:	55                   	push   %ebp
+  800898:	89 e5                	mov    %esp,%ebp
+  80089a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80089d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008a0:	eb 06                	jmp    8008a8 <strcmp+0x11>
+		p++, q++;
+  8008a2:	83 c1 01             	add    $0x1,%ecx
+  8008a5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008a8:	0f b6 01             	movzbl (%ecx),%eax
+  8008ab:	84 c0                	test   %al,%al
+  8008ad:	74 04                	je     8008b3 <strcmp+0x1c>
+  8008af:	3a 02                	cmp    (%edx),%al
+  8008b1:	74 ef                	je     8008a2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008b3:	0f b6 c0             	movzbl %al,%eax
+  8008b6:	0f b6 12             	movzbl (%edx),%edx
+  8008b9:	29 d0                	sub    %edx,%eax
+}
+  8008bb:	5d                   	pop    %ebp
+  8008bc:	c3                   	ret
+
+008008bd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	53                   	push   %ebx
+  8008c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008ca:	eb 09                	jmp    8008d5 <strncmp+0x18>
+		n--, p++, q++;
+  8008cc:	83 ea 01             	sub    $0x1,%edx
+  8008cf:	83 c0 01             	add    $0x1,%eax
+  8008d2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008d5:	85 d2                	test   %edx,%edx
+  8008d7:	74 18                	je     8008f1 <strncmp+0x34>
+  8008d9:	0f b6 18             	movzbl (%eax),%ebx
+  8008dc:	84 db                	test   %bl,%bl
+  8008de:	74 04                	je     8008e4 <strncmp+0x27>
+  8008e0:	3a 19                	cmp    (%ecx),%bl
+  8008e2:	74 e8                	je     8008cc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008e4:	0f b6 00             	movzbl (%eax),%eax
+  8008e7:	0f b6 11             	movzbl (%ecx),%edx
+  8008ea:	29 d0                	sub    %edx,%eax
+}
+  8008ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ef:	c9                   	leave
+  8008f0:	c3                   	ret
+		return 0;
+  8008f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f6:	eb f4                	jmp    8008ec <strncmp+0x2f>
+
+008008f8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fe:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800902:	eb 03                	jmp    800907 <strchr+0xf>
+  800904:	83 c0 01             	add    $0x1,%eax
+  800907:	0f b6 10             	movzbl (%eax),%edx
+  80090a:	84 d2                	test   %dl,%dl
+  80090c:	74 06                	je     800914 <strchr+0x1c>
+		if (*s == c)
+  80090e:	38 ca                	cmp    %cl,%dl
+  800910:	75 f2                	jne    800904 <strchr+0xc>
+  800912:	eb 05                	jmp    800919 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800914:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800919:	5d                   	pop    %ebp
+  80091a:	c3                   	ret
+
+0080091b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80091b:	55                   	push   %ebp
+  80091c:	89 e5                	mov    %esp,%ebp
+  80091e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800921:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800925:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800928:	38 ca                	cmp    %cl,%dl
+  80092a:	74 09                	je     800935 <strfind+0x1a>
+  80092c:	84 d2                	test   %dl,%dl
+  80092e:	74 05                	je     800935 <strfind+0x1a>
+	for (; *s; s++)
+  800930:	83 c0 01             	add    $0x1,%eax
+  800933:	eb f0                	jmp    800925 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800935:	5d                   	pop    %ebp
+  800936:	c3                   	ret
+
+00800937 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800937:	55                   	push   %ebp
+  800938:	89 e5                	mov    %esp,%ebp
+  80093a:	57                   	push   %edi
+  80093b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80093e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800941:	85 c9                	test   %ecx,%ecx
+  800943:	74 20                	je     800965 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800945:	89 f8                	mov    %edi,%eax
+  800947:	09 c8                	or     %ecx,%eax
+  800949:	a8 03                	test   $0x3,%al
+  80094b:	75 12                	jne    80095f <memset+0x28>
+		c &= 0xFF;
+  80094d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800951:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800957:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80095a:	fc                   	cld
+  80095b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80095d:	eb 06                	jmp    800965 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80095f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800962:	fc                   	cld
+  800963:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800965:	89 f8                	mov    %edi,%eax
+  800967:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80096a:	c9                   	leave
+  80096b:	c3                   	ret
+
+0080096c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80096c:	55                   	push   %ebp
+  80096d:	89 e5                	mov    %esp,%ebp
+  80096f:	57                   	push   %edi
+  800970:	56                   	push   %esi
+  800971:	8b 45 08             	mov    0x8(%ebp),%eax
+  800974:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800977:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80097a:	39 c6                	cmp    %eax,%esi
+  80097c:	73 32                	jae    8009b0 <memmove+0x44>
+  80097e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800981:	39 d0                	cmp    %edx,%eax
+  800983:	73 2b                	jae    8009b0 <memmove+0x44>
+		s += n;
+		d += n;
+  800985:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800988:	89 d6                	mov    %edx,%esi
+  80098a:	09 fe                	or     %edi,%esi
+  80098c:	09 ce                	or     %ecx,%esi
+  80098e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800994:	75 0e                	jne    8009a4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800996:	83 ef 04             	sub    $0x4,%edi
+  800999:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80099c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80099f:	fd                   	std
+  8009a0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009a2:	eb 09                	jmp    8009ad <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009a4:	83 ef 01             	sub    $0x1,%edi
+  8009a7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009aa:	fd                   	std
+  8009ab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009ad:	fc                   	cld
+  8009ae:	eb 1a                	jmp    8009ca <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b0:	89 f2                	mov    %esi,%edx
+  8009b2:	09 c2                	or     %eax,%edx
+  8009b4:	09 ca                	or     %ecx,%edx
+  8009b6:	f6 c2 03             	test   $0x3,%dl
+  8009b9:	75 0a                	jne    8009c5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009bb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009be:	89 c7                	mov    %eax,%edi
+  8009c0:	fc                   	cld
+  8009c1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009c3:	eb 05                	jmp    8009ca <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009c5:	89 c7                	mov    %eax,%edi
+  8009c7:	fc                   	cld
+  8009c8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009ca:	5e                   	pop    %esi
+  8009cb:	5f                   	pop    %edi
+  8009cc:	5d                   	pop    %ebp
+  8009cd:	c3                   	ret
+
+008009ce <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009ce:	55                   	push   %ebp
+  8009cf:	89 e5                	mov    %esp,%ebp
+  8009d1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009d4:	ff 75 10             	push   0x10(%ebp)
+  8009d7:	ff 75 0c             	push   0xc(%ebp)
+  8009da:	ff 75 08             	push   0x8(%ebp)
+  8009dd:	e8 8a ff ff ff       	call   80096c <memmove>
+}
+  8009e2:	c9                   	leave
+  8009e3:	c3                   	ret
+
+008009e4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009e4:	55                   	push   %ebp
+  8009e5:	89 e5                	mov    %esp,%ebp
+  8009e7:	56                   	push   %esi
+  8009e8:	53                   	push   %ebx
+  8009e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009ef:	89 c6                	mov    %eax,%esi
+  8009f1:	03 75 10             	add    0x10(%ebp),%esi
+  8009f4:	eb 06                	jmp    8009fc <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009f6:	83 c0 01             	add    $0x1,%eax
+  8009f9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009fc:	39 f0                	cmp    %esi,%eax
+  8009fe:	74 14                	je     800a14 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a00:	0f b6 08             	movzbl (%eax),%ecx
+  800a03:	0f b6 1a             	movzbl (%edx),%ebx
+  800a06:	38 d9                	cmp    %bl,%cl
+  800a08:	74 ec                	je     8009f6 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a0a:	0f b6 c1             	movzbl %cl,%eax
+  800a0d:	0f b6 db             	movzbl %bl,%ebx
+  800a10:	29 d8                	sub    %ebx,%eax
+  800a12:	eb 05                	jmp    800a19 <memcmp+0x35>
+	}
+
+	return 0;
+  800a14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a19:	5b                   	pop    %ebx
+  800a1a:	5e                   	pop    %esi
+  800a1b:	5d                   	pop    %ebp
+  800a1c:	c3                   	ret
+
+00800a1d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a1d:	55                   	push   %ebp
+  800a1e:	89 e5                	mov    %esp,%ebp
+  800a20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a26:	89 c2                	mov    %eax,%edx
+  800a28:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a2b:	eb 03                	jmp    800a30 <memfind+0x13>
+  800a2d:	83 c0 01             	add    $0x1,%eax
+  800a30:	39 d0                	cmp    %edx,%eax
+  800a32:	73 04                	jae    800a38 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a34:	38 08                	cmp    %cl,(%eax)
+  800a36:	75 f5                	jne    800a2d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a38:	5d                   	pop    %ebp
+  800a39:	c3                   	ret
+
+00800a3a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a3a:	55                   	push   %ebp
+  800a3b:	89 e5                	mov    %esp,%ebp
+  800a3d:	57                   	push   %edi
+  800a3e:	56                   	push   %esi
+  800a3f:	53                   	push   %ebx
+  800a40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a46:	eb 03                	jmp    800a4b <strtol+0x11>
+		s++;
+  800a48:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a4b:	0f b6 02             	movzbl (%edx),%eax
+  800a4e:	3c 20                	cmp    $0x20,%al
+  800a50:	74 f6                	je     800a48 <strtol+0xe>
+  800a52:	3c 09                	cmp    $0x9,%al
+  800a54:	74 f2                	je     800a48 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a56:	3c 2b                	cmp    $0x2b,%al
+  800a58:	74 2a                	je     800a84 <strtol+0x4a>
+	int neg = 0;
+  800a5a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a5f:	3c 2d                	cmp    $0x2d,%al
+  800a61:	74 2b                	je     800a8e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a63:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a69:	75 0f                	jne    800a7a <strtol+0x40>
+  800a6b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a6e:	74 28                	je     800a98 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a70:	85 db                	test   %ebx,%ebx
+  800a72:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a77:	0f 44 d8             	cmove  %eax,%ebx
+  800a7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a82:	eb 46                	jmp    800aca <strtol+0x90>
+		s++;
+  800a84:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a87:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a8c:	eb d5                	jmp    800a63 <strtol+0x29>
+		s++, neg = 1;
+  800a8e:	83 c2 01             	add    $0x1,%edx
+  800a91:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a96:	eb cb                	jmp    800a63 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a98:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a9c:	74 0e                	je     800aac <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a9e:	85 db                	test   %ebx,%ebx
+  800aa0:	75 d8                	jne    800a7a <strtol+0x40>
+		s++, base = 8;
+  800aa2:	83 c2 01             	add    $0x1,%edx
+  800aa5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aaa:	eb ce                	jmp    800a7a <strtol+0x40>
+		s += 2, base = 16;
+  800aac:	83 c2 02             	add    $0x2,%edx
+  800aaf:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ab4:	eb c4                	jmp    800a7a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ab6:	0f be c0             	movsbl %al,%eax
+  800ab9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800abc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800abf:	7d 3a                	jge    800afb <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ac1:	83 c2 01             	add    $0x1,%edx
+  800ac4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ac8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aca:	0f b6 02             	movzbl (%edx),%eax
+  800acd:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ad0:	89 f3                	mov    %esi,%ebx
+  800ad2:	80 fb 09             	cmp    $0x9,%bl
+  800ad5:	76 df                	jbe    800ab6 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ad7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ada:	89 f3                	mov    %esi,%ebx
+  800adc:	80 fb 19             	cmp    $0x19,%bl
+  800adf:	77 08                	ja     800ae9 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ae1:	0f be c0             	movsbl %al,%eax
+  800ae4:	83 e8 57             	sub    $0x57,%eax
+  800ae7:	eb d3                	jmp    800abc <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ae9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aec:	89 f3                	mov    %esi,%ebx
+  800aee:	80 fb 19             	cmp    $0x19,%bl
+  800af1:	77 08                	ja     800afb <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800af3:	0f be c0             	movsbl %al,%eax
+  800af6:	83 e8 37             	sub    $0x37,%eax
+  800af9:	eb c1                	jmp    800abc <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800afb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aff:	74 05                	je     800b06 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b01:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b04:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b06:	89 c8                	mov    %ecx,%eax
+  800b08:	f7 d8                	neg    %eax
+  800b0a:	85 ff                	test   %edi,%edi
+  800b0c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b0f:	89 c8                	mov    %ecx,%eax
+  800b11:	5b                   	pop    %ebx
+  800b12:	5e                   	pop    %esi
+  800b13:	5f                   	pop    %edi
+  800b14:	5d                   	pop    %ebp
+  800b15:	c3                   	ret
+
+00800b16 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	57                   	push   %edi
+  800b1a:	56                   	push   %esi
+  800b1b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b27:	89 c3                	mov    %eax,%ebx
+  800b29:	89 c7                	mov    %eax,%edi
+  800b2b:	89 c6                	mov    %eax,%esi
+  800b2d:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b2f:	5b                   	pop    %ebx
+  800b30:	5e                   	pop    %esi
+  800b31:	5f                   	pop    %edi
+  800b32:	5d                   	pop    %ebp
+  800b33:	c3                   	ret
+
+00800b34 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b34:	55                   	push   %ebp
+  800b35:	89 e5                	mov    %esp,%ebp
+  800b37:	57                   	push   %edi
+  800b38:	56                   	push   %esi
+  800b39:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b3f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b44:	89 d1                	mov    %edx,%ecx
+  800b46:	89 d3                	mov    %edx,%ebx
+  800b48:	89 d7                	mov    %edx,%edi
+  800b4a:	89 d6                	mov    %edx,%esi
+  800b4c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b4e:	5b                   	pop    %ebx
+  800b4f:	5e                   	pop    %esi
+  800b50:	5f                   	pop    %edi
+  800b51:	5d                   	pop    %ebp
+  800b52:	c3                   	ret
+
+00800b53 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	57                   	push   %edi
+  800b57:	56                   	push   %esi
+  800b58:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b61:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b66:	89 cb                	mov    %ecx,%ebx
+  800b68:	89 cf                	mov    %ecx,%edi
+  800b6a:	89 ce                	mov    %ecx,%esi
+  800b6c:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b6e:	5b                   	pop    %ebx
+  800b6f:	5e                   	pop    %esi
+  800b70:	5f                   	pop    %edi
+  800b71:	5d                   	pop    %ebp
+  800b72:	c3                   	ret
+
+00800b73 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b73:	55                   	push   %ebp
+  800b74:	89 e5                	mov    %esp,%ebp
+  800b76:	57                   	push   %edi
+  800b77:	56                   	push   %esi
+  800b78:	53                   	push   %ebx
+  800b79:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b84:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b89:	89 cb                	mov    %ecx,%ebx
+  800b8b:	89 cf                	mov    %ecx,%edi
+  800b8d:	89 ce                	mov    %ecx,%esi
+  800b8f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b91:	85 c0                	test   %eax,%eax
+  800b93:	7f 08                	jg     800b9d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b98:	5b                   	pop    %ebx
+  800b99:	5e                   	pop    %esi
+  800b9a:	5f                   	pop    %edi
+  800b9b:	5d                   	pop    %ebp
+  800b9c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b9d:	83 ec 0c             	sub    $0xc,%esp
+  800ba0:	50                   	push   %eax
+  800ba1:	6a 03                	push   $0x3
+  800ba3:	68 7f 2e 80 00       	push   $0x802e7f
+  800ba8:	6a 23                	push   $0x23
+  800baa:	68 9c 2e 80 00       	push   $0x802e9c
+  800baf:	e8 13 1a 00 00       	call   8025c7 <_panic>
+
+00800bb4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bb4:	55                   	push   %ebp
+  800bb5:	89 e5                	mov    %esp,%ebp
+  800bb7:	57                   	push   %edi
+  800bb8:	56                   	push   %esi
+  800bb9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bba:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bbf:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bc4:	89 d1                	mov    %edx,%ecx
+  800bc6:	89 d3                	mov    %edx,%ebx
+  800bc8:	89 d7                	mov    %edx,%edi
+  800bca:	89 d6                	mov    %edx,%esi
+  800bcc:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bce:	5b                   	pop    %ebx
+  800bcf:	5e                   	pop    %esi
+  800bd0:	5f                   	pop    %edi
+  800bd1:	5d                   	pop    %ebp
+  800bd2:	c3                   	ret
+
+00800bd3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bd3:	55                   	push   %ebp
+  800bd4:	89 e5                	mov    %esp,%ebp
+  800bd6:	57                   	push   %edi
+  800bd7:	56                   	push   %esi
+  800bd8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bde:	b8 16 00 00 00       	mov    $0x16,%eax
+  800be3:	89 d1                	mov    %edx,%ecx
+  800be5:	89 d3                	mov    %edx,%ebx
+  800be7:	89 d7                	mov    %edx,%edi
+  800be9:	89 d6                	mov    %edx,%esi
+  800beb:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bed:	5b                   	pop    %ebx
+  800bee:	5e                   	pop    %esi
+  800bef:	5f                   	pop    %edi
+  800bf0:	5d                   	pop    %ebp
+  800bf1:	c3                   	ret
+
+00800bf2 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	57                   	push   %edi
+  800bf6:	56                   	push   %esi
+  800bf7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800c02:	89 d1                	mov    %edx,%ecx
+  800c04:	89 d3                	mov    %edx,%ebx
+  800c06:	89 d7                	mov    %edx,%edi
+  800c08:	89 d6                	mov    %edx,%esi
+  800c0a:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800c0c:	5b                   	pop    %ebx
+  800c0d:	5e                   	pop    %esi
+  800c0e:	5f                   	pop    %edi
+  800c0f:	5d                   	pop    %ebp
+  800c10:	c3                   	ret
+
+00800c11 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	57                   	push   %edi
+  800c15:	56                   	push   %esi
+  800c16:	53                   	push   %ebx
+  800c17:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c25:	b8 15 00 00 00       	mov    $0x15,%eax
+  800c2a:	89 df                	mov    %ebx,%edi
+  800c2c:	89 de                	mov    %ebx,%esi
+  800c2e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c30:	85 c0                	test   %eax,%eax
+  800c32:	7f 08                	jg     800c3c <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c37:	5b                   	pop    %ebx
+  800c38:	5e                   	pop    %esi
+  800c39:	5f                   	pop    %edi
+  800c3a:	5d                   	pop    %ebp
+  800c3b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c3c:	83 ec 0c             	sub    $0xc,%esp
+  800c3f:	50                   	push   %eax
+  800c40:	6a 15                	push   $0x15
+  800c42:	68 7f 2e 80 00       	push   $0x802e7f
+  800c47:	6a 23                	push   $0x23
+  800c49:	68 9c 2e 80 00       	push   $0x802e9c
+  800c4e:	e8 74 19 00 00       	call   8025c7 <_panic>
+
+00800c53 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c53:	55                   	push   %ebp
+  800c54:	89 e5                	mov    %esp,%ebp
+  800c56:	57                   	push   %edi
+  800c57:	56                   	push   %esi
+  800c58:	53                   	push   %ebx
+  800c59:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c5c:	be 00 00 00 00       	mov    $0x0,%esi
+  800c61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c67:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c6f:	89 f7                	mov    %esi,%edi
+  800c71:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c73:	85 c0                	test   %eax,%eax
+  800c75:	7f 08                	jg     800c7f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c7a:	5b                   	pop    %ebx
+  800c7b:	5e                   	pop    %esi
+  800c7c:	5f                   	pop    %edi
+  800c7d:	5d                   	pop    %ebp
+  800c7e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c7f:	83 ec 0c             	sub    $0xc,%esp
+  800c82:	50                   	push   %eax
+  800c83:	6a 05                	push   $0x5
+  800c85:	68 7f 2e 80 00       	push   $0x802e7f
+  800c8a:	6a 23                	push   $0x23
+  800c8c:	68 9c 2e 80 00       	push   $0x802e9c
+  800c91:	e8 31 19 00 00       	call   8025c7 <_panic>
+
+00800c96 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800c96:	55                   	push   %ebp
+  800c97:	89 e5                	mov    %esp,%ebp
+  800c99:	57                   	push   %edi
+  800c9a:	56                   	push   %esi
+  800c9b:	53                   	push   %ebx
+  800c9c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c9f:	be 00 00 00 00       	mov    $0x0,%esi
+  800ca4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800caa:	b8 06 00 00 00       	mov    $0x6,%eax
+  800caf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cb2:	89 f7                	mov    %esi,%edi
+  800cb4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cb6:	85 c0                	test   %eax,%eax
+  800cb8:	7f 08                	jg     800cc2 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbd:	5b                   	pop    %ebx
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5f                   	pop    %edi
+  800cc0:	5d                   	pop    %ebp
+  800cc1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc2:	83 ec 0c             	sub    $0xc,%esp
+  800cc5:	50                   	push   %eax
+  800cc6:	6a 06                	push   $0x6
+  800cc8:	68 7f 2e 80 00       	push   $0x802e7f
+  800ccd:	6a 23                	push   $0x23
+  800ccf:	68 9c 2e 80 00       	push   $0x802e9c
+  800cd4:	e8 ee 18 00 00       	call   8025c7 <_panic>
+
+00800cd9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	57                   	push   %edi
+  800cdd:	56                   	push   %esi
+  800cde:	53                   	push   %ebx
+  800cdf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ce2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce8:	b8 07 00 00 00       	mov    $0x7,%eax
+  800ced:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cf0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cf3:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cf6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cf8:	85 c0                	test   %eax,%eax
+  800cfa:	7f 08                	jg     800d04 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cff:	5b                   	pop    %ebx
+  800d00:	5e                   	pop    %esi
+  800d01:	5f                   	pop    %edi
+  800d02:	5d                   	pop    %ebp
+  800d03:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d04:	83 ec 0c             	sub    $0xc,%esp
+  800d07:	50                   	push   %eax
+  800d08:	6a 07                	push   $0x7
+  800d0a:	68 7f 2e 80 00       	push   $0x802e7f
+  800d0f:	6a 23                	push   $0x23
+  800d11:	68 9c 2e 80 00       	push   $0x802e9c
+  800d16:	e8 ac 18 00 00       	call   8025c7 <_panic>
+
+00800d1b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d1b:	55                   	push   %ebp
+  800d1c:	89 e5                	mov    %esp,%ebp
+  800d1e:	57                   	push   %edi
+  800d1f:	56                   	push   %esi
+  800d20:	53                   	push   %ebx
+  800d21:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d34:	89 df                	mov    %ebx,%edi
+  800d36:	89 de                	mov    %ebx,%esi
+  800d38:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d3a:	85 c0                	test   %eax,%eax
+  800d3c:	7f 08                	jg     800d46 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d41:	5b                   	pop    %ebx
+  800d42:	5e                   	pop    %esi
+  800d43:	5f                   	pop    %edi
+  800d44:	5d                   	pop    %ebp
+  800d45:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d46:	83 ec 0c             	sub    $0xc,%esp
+  800d49:	50                   	push   %eax
+  800d4a:	6a 08                	push   $0x8
+  800d4c:	68 7f 2e 80 00       	push   $0x802e7f
+  800d51:	6a 23                	push   $0x23
+  800d53:	68 9c 2e 80 00       	push   $0x802e9c
+  800d58:	e8 6a 18 00 00       	call   8025c7 <_panic>
+
+00800d5d <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d5d:	55                   	push   %ebp
+  800d5e:	89 e5                	mov    %esp,%ebp
+  800d60:	57                   	push   %edi
+  800d61:	56                   	push   %esi
+  800d62:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d69:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d6e:	be 00 00 00 00       	mov    $0x0,%esi
+  800d73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d76:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d79:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d7b:	5b                   	pop    %ebx
+  800d7c:	5e                   	pop    %esi
+  800d7d:	5f                   	pop    %edi
+  800d7e:	5d                   	pop    %ebp
+  800d7f:	c3                   	ret
+
+00800d80 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	57                   	push   %edi
+  800d84:	56                   	push   %esi
+  800d85:	53                   	push   %ebx
+  800d86:	8b 45 18             	mov    0x18(%ebp),%eax
+  800d89:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800d8c:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800d91:	77 27                	ja     800dba <sys_page_map_range+0x3a>
+  800d93:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800d99:	77 1f                	ja     800dba <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800d9b:	c1 e0 0c             	shl    $0xc,%eax
+  800d9e:	89 c6                	mov    %eax,%esi
+  800da0:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800da2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db3:	cd 30                	int    $0x30
+}
+  800db5:	5b                   	pop    %ebx
+  800db6:	5e                   	pop    %esi
+  800db7:	5f                   	pop    %edi
+  800db8:	5d                   	pop    %ebp
+  800db9:	c3                   	ret
+		return -E_INVAL;
+  800dba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dbf:	eb f4                	jmp    800db5 <sys_page_map_range+0x35>
+
+00800dc1 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800dc1:	55                   	push   %ebp
+  800dc2:	89 e5                	mov    %esp,%ebp
+  800dc4:	57                   	push   %edi
+  800dc5:	56                   	push   %esi
+  800dc6:	53                   	push   %ebx
+  800dc7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dd5:	be 00 00 00 00       	mov    $0x0,%esi
+  800dda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de2:	85 c0                	test   %eax,%eax
+  800de4:	7f 08                	jg     800dee <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800de6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de9:	5b                   	pop    %ebx
+  800dea:	5e                   	pop    %esi
+  800deb:	5f                   	pop    %edi
+  800dec:	5d                   	pop    %ebp
+  800ded:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dee:	83 ec 0c             	sub    $0xc,%esp
+  800df1:	50                   	push   %eax
+  800df2:	6a 0c                	push   $0xc
+  800df4:	68 7f 2e 80 00       	push   $0x802e7f
+  800df9:	6a 23                	push   $0x23
+  800dfb:	68 9c 2e 80 00       	push   $0x802e9c
+  800e00:	e8 c2 17 00 00       	call   8025c7 <_panic>
+
+00800e05 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	57                   	push   %edi
+  800e09:	56                   	push   %esi
+  800e0a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e0b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e16:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1e:	89 f7                	mov    %esi,%edi
+  800e20:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+
+00800e27 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e40:	89 df                	mov    %ebx,%edi
+  800e42:	89 de                	mov    %ebx,%esi
+  800e44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e46:	85 c0                	test   %eax,%eax
+  800e48:	7f 08                	jg     800e52 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4d:	5b                   	pop    %ebx
+  800e4e:	5e                   	pop    %esi
+  800e4f:	5f                   	pop    %edi
+  800e50:	5d                   	pop    %ebp
+  800e51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e52:	83 ec 0c             	sub    $0xc,%esp
+  800e55:	50                   	push   %eax
+  800e56:	6a 0f                	push   $0xf
+  800e58:	68 7f 2e 80 00       	push   $0x802e7f
+  800e5d:	6a 23                	push   $0x23
+  800e5f:	68 9c 2e 80 00       	push   $0x802e9c
+  800e64:	e8 5e 17 00 00       	call   8025c7 <_panic>
+
+00800e69 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e69:	55                   	push   %ebp
+  800e6a:	89 e5                	mov    %esp,%ebp
+  800e6c:	57                   	push   %edi
+  800e6d:	56                   	push   %esi
+  800e6e:	53                   	push   %ebx
+  800e6f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e82:	89 df                	mov    %ebx,%edi
+  800e84:	89 de                	mov    %ebx,%esi
+  800e86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e88:	85 c0                	test   %eax,%eax
+  800e8a:	7f 08                	jg     800e94 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800e8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5e                   	pop    %esi
+  800e91:	5f                   	pop    %edi
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e94:	83 ec 0c             	sub    $0xc,%esp
+  800e97:	50                   	push   %eax
+  800e98:	6a 10                	push   $0x10
+  800e9a:	68 7f 2e 80 00       	push   $0x802e7f
+  800e9f:	6a 23                	push   $0x23
+  800ea1:	68 9c 2e 80 00       	push   $0x802e9c
+  800ea6:	e8 1c 17 00 00       	call   8025c7 <_panic>
+
+00800eab <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	57                   	push   %edi
+  800eaf:	56                   	push   %esi
+  800eb0:	53                   	push   %ebx
+  800eb1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebf:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ec4:	89 df                	mov    %ebx,%edi
+  800ec6:	89 de                	mov    %ebx,%esi
+  800ec8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eca:	85 c0                	test   %eax,%eax
+  800ecc:	7f 08                	jg     800ed6 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800ece:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed1:	5b                   	pop    %ebx
+  800ed2:	5e                   	pop    %esi
+  800ed3:	5f                   	pop    %edi
+  800ed4:	5d                   	pop    %ebp
+  800ed5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed6:	83 ec 0c             	sub    $0xc,%esp
+  800ed9:	50                   	push   %eax
+  800eda:	6a 11                	push   $0x11
+  800edc:	68 7f 2e 80 00       	push   $0x802e7f
+  800ee1:	6a 23                	push   $0x23
+  800ee3:	68 9c 2e 80 00       	push   $0x802e9c
+  800ee8:	e8 da 16 00 00       	call   8025c7 <_panic>
+
+00800eed <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800eed:	55                   	push   %ebp
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	57                   	push   %edi
+  800ef1:	56                   	push   %esi
+  800ef2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef8:	b8 12 00 00 00       	mov    $0x12,%eax
+  800efd:	89 d1                	mov    %edx,%ecx
+  800eff:	89 d3                	mov    %edx,%ebx
+  800f01:	89 d7                	mov    %edx,%edi
+  800f03:	89 d6                	mov    %edx,%esi
+  800f05:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800f07:	5b                   	pop    %ebx
+  800f08:	5e                   	pop    %esi
+  800f09:	5f                   	pop    %edi
+  800f0a:	5d                   	pop    %ebp
+  800f0b:	c3                   	ret
+
+00800f0c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	57                   	push   %edi
+  800f10:	56                   	push   %esi
+  800f11:	53                   	push   %ebx
+  800f12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f20:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f25:	89 df                	mov    %ebx,%edi
+  800f27:	89 de                	mov    %ebx,%esi
+  800f29:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f2b:	85 c0                	test   %eax,%eax
+  800f2d:	7f 08                	jg     800f37 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f32:	5b                   	pop    %ebx
+  800f33:	5e                   	pop    %esi
+  800f34:	5f                   	pop    %edi
+  800f35:	5d                   	pop    %ebp
+  800f36:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+  800f3a:	50                   	push   %eax
+  800f3b:	6a 13                	push   $0x13
+  800f3d:	68 7f 2e 80 00       	push   $0x802e7f
+  800f42:	6a 23                	push   $0x23
+  800f44:	68 9c 2e 80 00       	push   $0x802e9c
+  800f49:	e8 79 16 00 00       	call   8025c7 <_panic>
+
+00800f4e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	57                   	push   %edi
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f62:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f67:	89 df                	mov    %ebx,%edi
+  800f69:	89 de                	mov    %ebx,%esi
+  800f6b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6d:	85 c0                	test   %eax,%eax
+  800f6f:	7f 08                	jg     800f79 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f74:	5b                   	pop    %ebx
+  800f75:	5e                   	pop    %esi
+  800f76:	5f                   	pop    %edi
+  800f77:	5d                   	pop    %ebp
+  800f78:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f79:	83 ec 0c             	sub    $0xc,%esp
+  800f7c:	50                   	push   %eax
+  800f7d:	6a 14                	push   $0x14
+  800f7f:	68 7f 2e 80 00       	push   $0x802e7f
+  800f84:	6a 23                	push   $0x23
+  800f86:	68 9c 2e 80 00       	push   $0x802e9c
+  800f8b:	e8 37 16 00 00       	call   8025c7 <_panic>
+
+00800f90 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f90:	55                   	push   %ebp
+  800f91:	89 e5                	mov    %esp,%ebp
+  800f93:	57                   	push   %edi
+  800f94:	56                   	push   %esi
+  800f95:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fa1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fac:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fae:	5b                   	pop    %ebx
+  800faf:	5e                   	pop    %esi
+  800fb0:	5f                   	pop    %edi
+  800fb1:	5d                   	pop    %ebp
+  800fb2:	c3                   	ret
+
+00800fb3 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	57                   	push   %edi
+  800fb7:	56                   	push   %esi
+  800fb8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbf:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fc4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fcc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fcf:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fd1:	5b                   	pop    %ebx
+  800fd2:	5e                   	pop    %esi
+  800fd3:	5f                   	pop    %edi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	c3                   	ret
+
+00800fd6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	57                   	push   %edi
+  800fda:	56                   	push   %esi
+  800fdb:	53                   	push   %ebx
+  800fdc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe7:	b8 19 00 00 00       	mov    $0x19,%eax
+  800fec:	89 cb                	mov    %ecx,%ebx
+  800fee:	89 cf                	mov    %ecx,%edi
+  800ff0:	89 ce                	mov    %ecx,%esi
+  800ff2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff4:	85 c0                	test   %eax,%eax
+  800ff6:	7f 08                	jg     801000 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800ff8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ffb:	5b                   	pop    %ebx
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5f                   	pop    %edi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801000:	83 ec 0c             	sub    $0xc,%esp
+  801003:	50                   	push   %eax
+  801004:	6a 19                	push   $0x19
+  801006:	68 7f 2e 80 00       	push   $0x802e7f
+  80100b:	6a 23                	push   $0x23
+  80100d:	68 9c 2e 80 00       	push   $0x802e9c
+  801012:	e8 b0 15 00 00       	call   8025c7 <_panic>
+
+00801017 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801017:	55                   	push   %ebp
+  801018:	89 e5                	mov    %esp,%ebp
+  80101a:	57                   	push   %edi
+  80101b:	56                   	push   %esi
+  80101c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801022:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801027:	89 d1                	mov    %edx,%ecx
+  801029:	89 d3                	mov    %edx,%ebx
+  80102b:	89 d7                	mov    %edx,%edi
+  80102d:	89 d6                	mov    %edx,%esi
+  80102f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801031:	5b                   	pop    %ebx
+  801032:	5e                   	pop    %esi
+  801033:	5f                   	pop    %edi
+  801034:	5d                   	pop    %ebp
+  801035:	c3                   	ret
+
+00801036 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801036:	55                   	push   %ebp
+  801037:	89 e5                	mov    %esp,%ebp
+  801039:	57                   	push   %edi
+  80103a:	56                   	push   %esi
+  80103b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801047:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80104c:	89 df                	mov    %ebx,%edi
+  80104e:	89 de                	mov    %ebx,%esi
+  801050:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801052:	5b                   	pop    %ebx
+  801053:	5e                   	pop    %esi
+  801054:	5f                   	pop    %edi
+  801055:	5d                   	pop    %ebp
+  801056:	c3                   	ret
+
+00801057 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801057:	55                   	push   %ebp
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	57                   	push   %edi
+  80105b:	56                   	push   %esi
+  80105c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801062:	8b 55 08             	mov    0x8(%ebp),%edx
+  801065:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801068:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80106d:	89 df                	mov    %ebx,%edi
+  80106f:	89 de                	mov    %ebx,%esi
+  801071:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801073:	5b                   	pop    %ebx
+  801074:	5e                   	pop    %esi
+  801075:	5f                   	pop    %edi
+  801076:	5d                   	pop    %ebp
+  801077:	c3                   	ret
+
+00801078 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801078:	55                   	push   %ebp
+  801079:	89 e5                	mov    %esp,%ebp
+  80107b:	53                   	push   %ebx
+  80107c:	83 ec 04             	sub    $0x4,%esp
+  80107f:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801082:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  801084:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  801087:	f6 c2 02             	test   $0x2,%dl
+  80108a:	74 7b                	je     801107 <pgfault+0x8f>
+  80108c:	89 c1                	mov    %eax,%ecx
+  80108e:	c1 e9 0c             	shr    $0xc,%ecx
+  801091:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  801098:	f6 c5 08             	test   $0x8,%ch
+  80109b:	74 6a                	je     801107 <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80109d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8010a2:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8010a4:	83 ec 04             	sub    $0x4,%esp
+  8010a7:	6a 07                	push   $0x7
+  8010a9:	68 00 f0 7f 00       	push   $0x7ff000
+  8010ae:	6a 00                	push   $0x0
+  8010b0:	e8 9e fb ff ff       	call   800c53 <sys_page_alloc>
+  8010b5:	83 c4 10             	add    $0x10,%esp
+  8010b8:	85 c0                	test   %eax,%eax
+  8010ba:	78 61                	js     80111d <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  8010bc:	83 ec 04             	sub    $0x4,%esp
+  8010bf:	68 00 10 00 00       	push   $0x1000
+  8010c4:	53                   	push   %ebx
+  8010c5:	68 00 f0 7f 00       	push   $0x7ff000
+  8010ca:	e8 9d f8 ff ff       	call   80096c <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  8010cf:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8010d6:	53                   	push   %ebx
+  8010d7:	6a 00                	push   $0x0
+  8010d9:	68 00 f0 7f 00       	push   $0x7ff000
+  8010de:	6a 00                	push   $0x0
+  8010e0:	e8 f4 fb ff ff       	call   800cd9 <sys_page_map>
+  8010e5:	83 c4 20             	add    $0x20,%esp
+  8010e8:	85 c0                	test   %eax,%eax
+  8010ea:	78 43                	js     80112f <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  8010ec:	83 ec 08             	sub    $0x8,%esp
+  8010ef:	68 00 f0 7f 00       	push   $0x7ff000
+  8010f4:	6a 00                	push   $0x0
+  8010f6:	e8 20 fc ff ff       	call   800d1b <sys_page_unmap>
+  8010fb:	83 c4 10             	add    $0x10,%esp
+  8010fe:	85 c0                	test   %eax,%eax
+  801100:	78 3f                	js     801141 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  801102:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801105:	c9                   	leave
+  801106:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  801107:	83 ec 0c             	sub    $0xc,%esp
+  80110a:	50                   	push   %eax
+  80110b:	52                   	push   %edx
+  80110c:	68 aa 2e 80 00       	push   $0x802eaa
+  801111:	6a 19                	push   $0x19
+  801113:	68 bb 2e 80 00       	push   $0x802ebb
+  801118:	e8 aa 14 00 00       	call   8025c7 <_panic>
+		panic("sys_page_alloc: %e", r);
+  80111d:	50                   	push   %eax
+  80111e:	68 c6 2e 80 00       	push   $0x802ec6
+  801123:	6a 24                	push   $0x24
+  801125:	68 bb 2e 80 00       	push   $0x802ebb
+  80112a:	e8 98 14 00 00       	call   8025c7 <_panic>
+		panic("sys_page_map: %e", r);
+  80112f:	50                   	push   %eax
+  801130:	68 d9 2e 80 00       	push   $0x802ed9
+  801135:	6a 29                	push   $0x29
+  801137:	68 bb 2e 80 00       	push   $0x802ebb
+  80113c:	e8 86 14 00 00       	call   8025c7 <_panic>
+		panic("sys_page_unmap: %e", r);
+  801141:	50                   	push   %eax
+  801142:	68 ea 2e 80 00       	push   $0x802eea
+  801147:	6a 2c                	push   $0x2c
+  801149:	68 bb 2e 80 00       	push   $0x802ebb
+  80114e:	e8 74 14 00 00       	call   8025c7 <_panic>
+
+00801153 <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  801153:	55                   	push   %ebp
+  801154:	89 e5                	mov    %esp,%ebp
+  801156:	57                   	push   %edi
+  801157:	56                   	push   %esi
+  801158:	53                   	push   %ebx
+  801159:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80115c:	68 78 10 80 00       	push   $0x801078
+  801161:	e8 a7 14 00 00       	call   80260d <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  801166:	83 c4 08             	add    $0x8,%esp
+  801169:	6a 01                	push   $0x1
+  80116b:	6a 00                	push   $0x0
+  80116d:	e8 9f fa ff ff       	call   800c11 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  801172:	e8 7b fa ff ff       	call   800bf2 <sys_fork_cow>
+  801177:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  80117a:	83 c4 10             	add    $0x10,%esp
+  80117d:	85 c0                	test   %eax,%eax
+  80117f:	74 2c                	je     8011ad <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  801181:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  801185:	0f 85 8b 01 00 00    	jne    801316 <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80118b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801190:	cd 30                	int    $0x30
+  801192:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  801195:	85 c0                	test   %eax,%eax
+  801197:	78 30                	js     8011c9 <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  801199:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80119e:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8011a3:	74 36                	je     8011db <fork+0x88>
+  8011a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8011a8:	e9 99 00 00 00       	jmp    801246 <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8011ad:	e8 02 fa ff ff       	call   800bb4 <sys_getenvid>
+  8011b2:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8011b7:	c1 e0 09             	shl    $0x9,%eax
+  8011ba:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8011bf:	a3 0c 50 80 00       	mov    %eax,0x80500c
+		return 0;
+  8011c4:	e9 4d 01 00 00       	jmp    801316 <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  8011c9:	50                   	push   %eax
+  8011ca:	68 fd 2e 80 00       	push   $0x802efd
+  8011cf:	6a 7d                	push   $0x7d
+  8011d1:	68 bb 2e 80 00       	push   $0x802ebb
+  8011d6:	e8 ec 13 00 00       	call   8025c7 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8011db:	e8 d4 f9 ff ff       	call   800bb4 <sys_getenvid>
+  8011e0:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8011e5:	c1 e0 09             	shl    $0x9,%eax
+  8011e8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8011ed:	a3 0c 50 80 00       	mov    %eax,0x80500c
+		return 0;
+  8011f2:	e9 1f 01 00 00       	jmp    801316 <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  8011f7:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8011fe:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801201:	25 07 0e 00 00       	and    $0xe07,%eax
+  801206:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801209:	83 ec 0c             	sub    $0xc,%esp
+  80120c:	50                   	push   %eax
+  80120d:	56                   	push   %esi
+  80120e:	ff 75 e4             	push   -0x1c(%ebp)
+  801211:	56                   	push   %esi
+  801212:	6a 00                	push   $0x0
+  801214:	e8 c0 fa ff ff       	call   800cd9 <sys_page_map>
+  801219:	83 c4 20             	add    $0x20,%esp
+  80121c:	85 c0                	test   %eax,%eax
+  80121e:	0f 88 98 00 00 00    	js     8012bc <fork+0x169>
+	if (perm & PTE_COW) {
+  801224:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  80122b:	0f 85 61 01 00 00    	jne    801392 <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801231:	83 c7 01             	add    $0x1,%edi
+  801234:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80123a:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  801240:	0f 84 88 00 00 00    	je     8012ce <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  801246:	89 f0                	mov    %esi,%eax
+  801248:	c1 e8 16             	shr    $0x16,%eax
+  80124b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801252:	25 81 00 00 00       	and    $0x81,%eax
+  801257:	83 f8 01             	cmp    $0x1,%eax
+  80125a:	75 d5                	jne    801231 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  80125c:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  801263:	a8 01                	test   $0x1,%al
+  801265:	74 ca                	je     801231 <fork+0xde>
+  801267:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  80126d:	74 c2                	je     801231 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  80126f:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  801271:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801278:	f6 c4 04             	test   $0x4,%ah
+  80127b:	0f 85 76 ff ff ff    	jne    8011f7 <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  801281:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801288:	a8 02                	test   $0x2,%al
+  80128a:	0f 85 dc 00 00 00    	jne    80136c <fork+0x219>
+  801290:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801297:	f6 c4 08             	test   $0x8,%ah
+  80129a:	0f 85 cc 00 00 00    	jne    80136c <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8012a0:	83 ec 0c             	sub    $0xc,%esp
+  8012a3:	6a 05                	push   $0x5
+  8012a5:	56                   	push   %esi
+  8012a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8012a9:	56                   	push   %esi
+  8012aa:	6a 00                	push   $0x0
+  8012ac:	e8 28 fa ff ff       	call   800cd9 <sys_page_map>
+  8012b1:	83 c4 20             	add    $0x20,%esp
+  8012b4:	85 c0                	test   %eax,%eax
+  8012b6:	0f 89 75 ff ff ff    	jns    801231 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  8012bc:	50                   	push   %eax
+  8012bd:	68 d9 2e 80 00       	push   $0x802ed9
+  8012c2:	6a 48                	push   $0x48
+  8012c4:	68 bb 2e 80 00       	push   $0x802ebb
+  8012c9:	e8 f9 12 00 00       	call   8025c7 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  8012ce:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8012d1:	83 ec 04             	sub    $0x4,%esp
+  8012d4:	6a 07                	push   $0x7
+  8012d6:	68 00 f0 bf ee       	push   $0xeebff000
+  8012db:	53                   	push   %ebx
+  8012dc:	e8 72 f9 ff ff       	call   800c53 <sys_page_alloc>
+  8012e1:	83 c4 10             	add    $0x10,%esp
+  8012e4:	85 c0                	test   %eax,%eax
+  8012e6:	78 39                	js     801321 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8012e8:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8012ed:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  8012f3:	83 ec 08             	sub    $0x8,%esp
+  8012f6:	50                   	push   %eax
+  8012f7:	53                   	push   %ebx
+  8012f8:	e8 51 fc ff ff       	call   800f4e <sys_env_set_pgfault_upcall>
+  8012fd:	83 c4 10             	add    $0x10,%esp
+  801300:	85 c0                	test   %eax,%eax
+  801302:	78 36                	js     80133a <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  801304:	83 ec 08             	sub    $0x8,%esp
+  801307:	6a 02                	push   $0x2
+  801309:	53                   	push   %ebx
+  80130a:	e8 18 fb ff ff       	call   800e27 <sys_env_set_status>
+  80130f:	83 c4 10             	add    $0x10,%esp
+  801312:	85 c0                	test   %eax,%eax
+  801314:	78 3d                	js     801353 <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  801316:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801319:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131c:	5b                   	pop    %ebx
+  80131d:	5e                   	pop    %esi
+  80131e:	5f                   	pop    %edi
+  80131f:	5d                   	pop    %ebp
+  801320:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  801321:	83 ec 0c             	sub    $0xc,%esp
+  801324:	53                   	push   %ebx
+  801325:	50                   	push   %eax
+  801326:	68 24 2f 80 00       	push   $0x802f24
+  80132b:	68 92 00 00 00       	push   $0x92
+  801330:	68 bb 2e 80 00       	push   $0x802ebb
+  801335:	e8 8d 12 00 00       	call   8025c7 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  80133a:	83 ec 0c             	sub    $0xc,%esp
+  80133d:	53                   	push   %ebx
+  80133e:	50                   	push   %eax
+  80133f:	68 48 2f 80 00       	push   $0x802f48
+  801344:	68 95 00 00 00       	push   $0x95
+  801349:	68 bb 2e 80 00       	push   $0x802ebb
+  80134e:	e8 74 12 00 00       	call   8025c7 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  801353:	83 ec 0c             	sub    $0xc,%esp
+  801356:	53                   	push   %ebx
+  801357:	50                   	push   %eax
+  801358:	68 78 2f 80 00       	push   $0x802f78
+  80135d:	68 98 00 00 00       	push   $0x98
+  801362:	68 bb 2e 80 00       	push   $0x802ebb
+  801367:	e8 5b 12 00 00       	call   8025c7 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  80136c:	83 ec 0c             	sub    $0xc,%esp
+  80136f:	68 05 08 00 00       	push   $0x805
+  801374:	53                   	push   %ebx
+  801375:	ff 75 e4             	push   -0x1c(%ebp)
+  801378:	53                   	push   %ebx
+  801379:	6a 00                	push   $0x0
+  80137b:	e8 59 f9 ff ff       	call   800cd9 <sys_page_map>
+  801380:	83 c4 20             	add    $0x20,%esp
+  801383:	85 c0                	test   %eax,%eax
+  801385:	0f 88 31 ff ff ff    	js     8012bc <fork+0x169>
+		perm |= PTE_COW;
+  80138b:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  801392:	83 ec 0c             	sub    $0xc,%esp
+  801395:	ff 75 e0             	push   -0x20(%ebp)
+  801398:	53                   	push   %ebx
+  801399:	6a 00                	push   $0x0
+  80139b:	53                   	push   %ebx
+  80139c:	6a 00                	push   $0x0
+  80139e:	e8 36 f9 ff ff       	call   800cd9 <sys_page_map>
+  8013a3:	83 c4 20             	add    $0x20,%esp
+  8013a6:	85 c0                	test   %eax,%eax
+  8013a8:	0f 89 83 fe ff ff    	jns    801231 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  8013ae:	50                   	push   %eax
+  8013af:	68 d9 2e 80 00       	push   $0x802ed9
+  8013b4:	6a 4c                	push   $0x4c
+  8013b6:	68 bb 2e 80 00       	push   $0x802ebb
+  8013bb:	e8 07 12 00 00       	call   8025c7 <_panic>
+
+008013c0 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8013c0:	55                   	push   %ebp
+  8013c1:	89 e5                	mov    %esp,%ebp
+  8013c3:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8013c6:	68 0d 2f 80 00       	push   $0x802f0d
+  8013cb:	68 a0 00 00 00       	push   $0xa0
+  8013d0:	68 bb 2e 80 00       	push   $0x802ebb
+  8013d5:	e8 ed 11 00 00       	call   8025c7 <_panic>
+
+008013da <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	57                   	push   %edi
+  8013de:	56                   	push   %esi
+  8013df:	53                   	push   %ebx
+  8013e0:	83 ec 18             	sub    $0x18,%esp
+  8013e3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013e6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8013e9:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8013ec:	85 db                	test   %ebx,%ebx
+  8013ee:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8013f3:	0f 45 c3             	cmovne %ebx,%eax
+  8013f6:	50                   	push   %eax
+  8013f7:	e8 da fb ff ff       	call   800fd6 <sys_ipc_recv>
+
+	if (from_env_store)
+  8013fc:	83 c4 10             	add    $0x10,%esp
+  8013ff:	85 ff                	test   %edi,%edi
+  801401:	74 17                	je     80141a <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801403:	ba 00 00 00 00       	mov    $0x0,%edx
+  801408:	85 c0                	test   %eax,%eax
+  80140a:	75 0c                	jne    801418 <ipc_recv+0x3e>
+  80140c:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+  801412:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  801418:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  80141a:	85 f6                	test   %esi,%esi
+  80141c:	74 2e                	je     80144c <ipc_recv+0x72>
+		if (!r && pg)
+  80141e:	85 c0                	test   %eax,%eax
+  801420:	75 24                	jne    801446 <ipc_recv+0x6c>
+  801422:	85 db                	test   %ebx,%ebx
+  801424:	74 20                	je     801446 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  801426:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  80142b:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  801431:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  801433:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801438:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80143e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801441:	5b                   	pop    %ebx
+  801442:	5e                   	pop    %esi
+  801443:	5f                   	pop    %edi
+  801444:	5d                   	pop    %ebp
+  801445:	c3                   	ret
+			*perm_store = 0;
+  801446:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80144c:	85 c0                	test   %eax,%eax
+  80144e:	75 ee                	jne    80143e <ipc_recv+0x64>
+  801450:	eb e1                	jmp    801433 <ipc_recv+0x59>
+
+00801452 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801452:	55                   	push   %ebp
+  801453:	89 e5                	mov    %esp,%ebp
+  801455:	57                   	push   %edi
+  801456:	56                   	push   %esi
+  801457:	53                   	push   %ebx
+  801458:	83 ec 0c             	sub    $0xc,%esp
+  80145b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80145e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801461:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  801464:	85 db                	test   %ebx,%ebx
+  801466:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80146b:	0f 44 d8             	cmove  %eax,%ebx
+  80146e:	ff 75 14             	push   0x14(%ebp)
+  801471:	53                   	push   %ebx
+  801472:	56                   	push   %esi
+  801473:	57                   	push   %edi
+  801474:	e8 3a fb ff ff       	call   800fb3 <sys_ipc_try_send_yield>
+  801479:	83 c4 10             	add    $0x10,%esp
+  80147c:	85 c0                	test   %eax,%eax
+  80147e:	79 1e                	jns    80149e <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  801480:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801483:	75 07                	jne    80148c <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  801485:	e8 49 f7 ff ff       	call   800bd3 <sys_yield>
+  80148a:	eb e2                	jmp    80146e <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  80148c:	50                   	push   %eax
+  80148d:	68 9e 2f 80 00       	push   $0x802f9e
+  801492:	6a 3d                	push   $0x3d
+  801494:	68 b3 2f 80 00       	push   $0x802fb3
+  801499:	e8 29 11 00 00       	call   8025c7 <_panic>
+	}
+}
+  80149e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a1:	5b                   	pop    %ebx
+  8014a2:	5e                   	pop    %esi
+  8014a3:	5f                   	pop    %edi
+  8014a4:	5d                   	pop    %ebp
+  8014a5:	c3                   	ret
+
+008014a6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8014a6:	55                   	push   %ebp
+  8014a7:	89 e5                	mov    %esp,%ebp
+  8014a9:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8014ac:	ff 75 08             	push   0x8(%ebp)
+  8014af:	e8 9f f6 ff ff       	call   800b53 <sys_env_find>
+}
+  8014b4:	c9                   	leave
+  8014b5:	c3                   	ret
+
+008014b6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014b6:	55                   	push   %ebp
+  8014b7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014bc:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014c1:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014c4:	5d                   	pop    %ebp
+  8014c5:	c3                   	ret
+
+008014c6 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014c6:	55                   	push   %ebp
+  8014c7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014cc:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8014d1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8014d6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8014db:	5d                   	pop    %ebp
+  8014dc:	c3                   	ret
+
+008014dd <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014dd:	55                   	push   %ebp
+  8014de:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8014e0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8014e5:	eb 02                	jmp    8014e9 <fd_alloc+0xc>
+  8014e7:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014e9:	89 c2                	mov    %eax,%edx
+  8014eb:	c1 ea 16             	shr    $0x16,%edx
+  8014ee:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014f5:	f6 c2 01             	test   $0x1,%dl
+  8014f8:	74 2b                	je     801525 <fd_alloc+0x48>
+  8014fa:	89 c2                	mov    %eax,%edx
+  8014fc:	c1 ea 0c             	shr    $0xc,%edx
+  8014ff:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801506:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80150c:	f6 c1 01             	test   $0x1,%cl
+  80150f:	74 14                	je     801525 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801511:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801517:	75 ce                	jne    8014e7 <fd_alloc+0xa>
+  801519:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80151e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801523:	eb 05                	jmp    80152a <fd_alloc+0x4d>
+			return 0;
+  801525:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80152a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152d:	89 02                	mov    %eax,(%edx)
+}
+  80152f:	89 c8                	mov    %ecx,%eax
+  801531:	5d                   	pop    %ebp
+  801532:	c3                   	ret
+
+00801533 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801533:	55                   	push   %ebp
+  801534:	89 e5                	mov    %esp,%ebp
+  801536:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801539:	83 f8 1f             	cmp    $0x1f,%eax
+  80153c:	77 30                	ja     80156e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80153e:	c1 e0 0c             	shl    $0xc,%eax
+  801541:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801546:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80154c:	f6 c2 01             	test   $0x1,%dl
+  80154f:	74 24                	je     801575 <fd_lookup+0x42>
+  801551:	89 c2                	mov    %eax,%edx
+  801553:	c1 ea 0c             	shr    $0xc,%edx
+  801556:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80155d:	f6 c2 01             	test   $0x1,%dl
+  801560:	74 1a                	je     80157c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801562:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801565:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801567:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80156c:	5d                   	pop    %ebp
+  80156d:	c3                   	ret
+		return -E_INVAL;
+  80156e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801573:	eb f7                	jmp    80156c <fd_lookup+0x39>
+		return -E_INVAL;
+  801575:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157a:	eb f0                	jmp    80156c <fd_lookup+0x39>
+  80157c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801581:	eb e9                	jmp    80156c <fd_lookup+0x39>
+
+00801583 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801583:	55                   	push   %ebp
+  801584:	89 e5                	mov    %esp,%ebp
+  801586:	53                   	push   %ebx
+  801587:	83 ec 04             	sub    $0x4,%esp
+  80158a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80158d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801592:	eb 03                	jmp    801597 <dev_lookup+0x14>
+  801594:	83 c0 01             	add    $0x1,%eax
+  801597:	8b 1c 85 3c 30 80 00 	mov    0x80303c(,%eax,4),%ebx
+  80159e:	85 db                	test   %ebx,%ebx
+  8015a0:	74 0b                	je     8015ad <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8015a2:	39 13                	cmp    %edx,(%ebx)
+  8015a4:	75 ee                	jne    801594 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8015a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ab:	eb 1f                	jmp    8015cc <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015ad:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8015b2:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8015b5:	83 ec 04             	sub    $0x4,%esp
+  8015b8:	52                   	push   %edx
+  8015b9:	50                   	push   %eax
+  8015ba:	68 c0 2f 80 00       	push   $0x802fc0
+  8015bf:	e8 34 ec ff ff       	call   8001f8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015c4:	83 c4 10             	add    $0x10,%esp
+  8015c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8015cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015cf:	89 1a                	mov    %ebx,(%edx)
+}
+  8015d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015d4:	c9                   	leave
+  8015d5:	c3                   	ret
+
+008015d6 <fd_close>:
+{
+  8015d6:	55                   	push   %ebp
+  8015d7:	89 e5                	mov    %esp,%ebp
+  8015d9:	57                   	push   %edi
+  8015da:	56                   	push   %esi
+  8015db:	53                   	push   %ebx
+  8015dc:	83 ec 24             	sub    $0x24,%esp
+  8015df:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015e2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015e5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015e8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015e9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8015ef:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015f2:	50                   	push   %eax
+  8015f3:	e8 3b ff ff ff       	call   801533 <fd_lookup>
+  8015f8:	89 c3                	mov    %eax,%ebx
+  8015fa:	83 c4 10             	add    $0x10,%esp
+  8015fd:	85 c0                	test   %eax,%eax
+  8015ff:	78 05                	js     801606 <fd_close+0x30>
+	    || fd != fd2)
+  801601:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801604:	74 16                	je     80161c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801606:	89 f8                	mov    %edi,%eax
+  801608:	84 c0                	test   %al,%al
+  80160a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801612:	89 d8                	mov    %ebx,%eax
+  801614:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801617:	5b                   	pop    %ebx
+  801618:	5e                   	pop    %esi
+  801619:	5f                   	pop    %edi
+  80161a:	5d                   	pop    %ebp
+  80161b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80161c:	83 ec 08             	sub    $0x8,%esp
+  80161f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801622:	50                   	push   %eax
+  801623:	ff 36                	push   (%esi)
+  801625:	e8 59 ff ff ff       	call   801583 <dev_lookup>
+  80162a:	89 c3                	mov    %eax,%ebx
+  80162c:	83 c4 10             	add    $0x10,%esp
+  80162f:	85 c0                	test   %eax,%eax
+  801631:	78 1a                	js     80164d <fd_close+0x77>
+		if (dev->dev_close)
+  801633:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801636:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801639:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80163e:	85 c0                	test   %eax,%eax
+  801640:	74 0b                	je     80164d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801642:	83 ec 0c             	sub    $0xc,%esp
+  801645:	56                   	push   %esi
+  801646:	ff d0                	call   *%eax
+  801648:	89 c3                	mov    %eax,%ebx
+  80164a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80164d:	83 ec 08             	sub    $0x8,%esp
+  801650:	56                   	push   %esi
+  801651:	6a 00                	push   $0x0
+  801653:	e8 c3 f6 ff ff       	call   800d1b <sys_page_unmap>
+	return r;
+  801658:	83 c4 10             	add    $0x10,%esp
+  80165b:	eb b5                	jmp    801612 <fd_close+0x3c>
+
+0080165d <close>:
+
+int
+close(int fdnum)
+{
+  80165d:	55                   	push   %ebp
+  80165e:	89 e5                	mov    %esp,%ebp
+  801660:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801663:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801666:	50                   	push   %eax
+  801667:	ff 75 08             	push   0x8(%ebp)
+  80166a:	e8 c4 fe ff ff       	call   801533 <fd_lookup>
+  80166f:	83 c4 10             	add    $0x10,%esp
+  801672:	85 c0                	test   %eax,%eax
+  801674:	79 02                	jns    801678 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801676:	c9                   	leave
+  801677:	c3                   	ret
+		return fd_close(fd, 1);
+  801678:	83 ec 08             	sub    $0x8,%esp
+  80167b:	6a 01                	push   $0x1
+  80167d:	ff 75 f4             	push   -0xc(%ebp)
+  801680:	e8 51 ff ff ff       	call   8015d6 <fd_close>
+  801685:	83 c4 10             	add    $0x10,%esp
+  801688:	eb ec                	jmp    801676 <close+0x19>
+
+0080168a <close_all>:
+
+void
+close_all(void)
+{
+  80168a:	55                   	push   %ebp
+  80168b:	89 e5                	mov    %esp,%ebp
+  80168d:	53                   	push   %ebx
+  80168e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801691:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801696:	83 ec 0c             	sub    $0xc,%esp
+  801699:	53                   	push   %ebx
+  80169a:	e8 be ff ff ff       	call   80165d <close>
+	for (i = 0; i < MAXFD; i++)
+  80169f:	83 c3 01             	add    $0x1,%ebx
+  8016a2:	83 c4 10             	add    $0x10,%esp
+  8016a5:	83 fb 20             	cmp    $0x20,%ebx
+  8016a8:	75 ec                	jne    801696 <close_all+0xc>
+}
+  8016aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016ad:	c9                   	leave
+  8016ae:	c3                   	ret
+
+008016af <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  8016b2:	57                   	push   %edi
+  8016b3:	56                   	push   %esi
+  8016b4:	53                   	push   %ebx
+  8016b5:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016b8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016bb:	50                   	push   %eax
+  8016bc:	ff 75 08             	push   0x8(%ebp)
+  8016bf:	e8 6f fe ff ff       	call   801533 <fd_lookup>
+  8016c4:	89 c3                	mov    %eax,%ebx
+  8016c6:	83 c4 10             	add    $0x10,%esp
+  8016c9:	85 c0                	test   %eax,%eax
+  8016cb:	78 7f                	js     80174c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8016cd:	83 ec 0c             	sub    $0xc,%esp
+  8016d0:	ff 75 0c             	push   0xc(%ebp)
+  8016d3:	e8 85 ff ff ff       	call   80165d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8016d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016db:	c1 e6 0c             	shl    $0xc,%esi
+  8016de:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8016e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016e7:	89 3c 24             	mov    %edi,(%esp)
+  8016ea:	e8 d7 fd ff ff       	call   8014c6 <fd2data>
+  8016ef:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8016f1:	89 34 24             	mov    %esi,(%esp)
+  8016f4:	e8 cd fd ff ff       	call   8014c6 <fd2data>
+  8016f9:	83 c4 10             	add    $0x10,%esp
+  8016fc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8016ff:	89 d8                	mov    %ebx,%eax
+  801701:	c1 e8 16             	shr    $0x16,%eax
+  801704:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80170b:	a8 01                	test   $0x1,%al
+  80170d:	74 11                	je     801720 <dup+0x71>
+  80170f:	89 d8                	mov    %ebx,%eax
+  801711:	c1 e8 0c             	shr    $0xc,%eax
+  801714:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80171b:	f6 c2 01             	test   $0x1,%dl
+  80171e:	75 36                	jne    801756 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801720:	89 f8                	mov    %edi,%eax
+  801722:	c1 e8 0c             	shr    $0xc,%eax
+  801725:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80172c:	83 ec 0c             	sub    $0xc,%esp
+  80172f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801734:	50                   	push   %eax
+  801735:	56                   	push   %esi
+  801736:	6a 00                	push   $0x0
+  801738:	57                   	push   %edi
+  801739:	6a 00                	push   $0x0
+  80173b:	e8 99 f5 ff ff       	call   800cd9 <sys_page_map>
+  801740:	89 c3                	mov    %eax,%ebx
+  801742:	83 c4 20             	add    $0x20,%esp
+  801745:	85 c0                	test   %eax,%eax
+  801747:	78 33                	js     80177c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801749:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80174c:	89 d8                	mov    %ebx,%eax
+  80174e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801751:	5b                   	pop    %ebx
+  801752:	5e                   	pop    %esi
+  801753:	5f                   	pop    %edi
+  801754:	5d                   	pop    %ebp
+  801755:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801756:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80175d:	83 ec 0c             	sub    $0xc,%esp
+  801760:	25 07 0e 00 00       	and    $0xe07,%eax
+  801765:	50                   	push   %eax
+  801766:	ff 75 d4             	push   -0x2c(%ebp)
+  801769:	6a 00                	push   $0x0
+  80176b:	53                   	push   %ebx
+  80176c:	6a 00                	push   $0x0
+  80176e:	e8 66 f5 ff ff       	call   800cd9 <sys_page_map>
+  801773:	89 c3                	mov    %eax,%ebx
+  801775:	83 c4 20             	add    $0x20,%esp
+  801778:	85 c0                	test   %eax,%eax
+  80177a:	79 a4                	jns    801720 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80177c:	83 ec 08             	sub    $0x8,%esp
+  80177f:	56                   	push   %esi
+  801780:	6a 00                	push   $0x0
+  801782:	e8 94 f5 ff ff       	call   800d1b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801787:	83 c4 08             	add    $0x8,%esp
+  80178a:	ff 75 d4             	push   -0x2c(%ebp)
+  80178d:	6a 00                	push   $0x0
+  80178f:	e8 87 f5 ff ff       	call   800d1b <sys_page_unmap>
+	return r;
+  801794:	83 c4 10             	add    $0x10,%esp
+  801797:	eb b3                	jmp    80174c <dup+0x9d>
+
+00801799 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801799:	55                   	push   %ebp
+  80179a:	89 e5                	mov    %esp,%ebp
+  80179c:	56                   	push   %esi
+  80179d:	53                   	push   %ebx
+  80179e:	83 ec 18             	sub    $0x18,%esp
+  8017a1:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017a4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017a7:	50                   	push   %eax
+  8017a8:	56                   	push   %esi
+  8017a9:	e8 85 fd ff ff       	call   801533 <fd_lookup>
+  8017ae:	83 c4 10             	add    $0x10,%esp
+  8017b1:	85 c0                	test   %eax,%eax
+  8017b3:	78 3c                	js     8017f1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017b5:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017b8:	83 ec 08             	sub    $0x8,%esp
+  8017bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017be:	50                   	push   %eax
+  8017bf:	ff 33                	push   (%ebx)
+  8017c1:	e8 bd fd ff ff       	call   801583 <dev_lookup>
+  8017c6:	83 c4 10             	add    $0x10,%esp
+  8017c9:	85 c0                	test   %eax,%eax
+  8017cb:	78 24                	js     8017f1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8017cd:	8b 43 08             	mov    0x8(%ebx),%eax
+  8017d0:	83 e0 03             	and    $0x3,%eax
+  8017d3:	83 f8 01             	cmp    $0x1,%eax
+  8017d6:	74 20                	je     8017f8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8017d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017db:	8b 40 08             	mov    0x8(%eax),%eax
+  8017de:	85 c0                	test   %eax,%eax
+  8017e0:	74 37                	je     801819 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8017e2:	83 ec 04             	sub    $0x4,%esp
+  8017e5:	ff 75 10             	push   0x10(%ebp)
+  8017e8:	ff 75 0c             	push   0xc(%ebp)
+  8017eb:	53                   	push   %ebx
+  8017ec:	ff d0                	call   *%eax
+  8017ee:	83 c4 10             	add    $0x10,%esp
+}
+  8017f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017f4:	5b                   	pop    %ebx
+  8017f5:	5e                   	pop    %esi
+  8017f6:	5d                   	pop    %ebp
+  8017f7:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017f8:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8017fd:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801800:	83 ec 04             	sub    $0x4,%esp
+  801803:	56                   	push   %esi
+  801804:	50                   	push   %eax
+  801805:	68 01 30 80 00       	push   $0x803001
+  80180a:	e8 e9 e9 ff ff       	call   8001f8 <cprintf>
+		return -E_INVAL;
+  80180f:	83 c4 10             	add    $0x10,%esp
+  801812:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801817:	eb d8                	jmp    8017f1 <read+0x58>
+		return -E_NOT_SUPP;
+  801819:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80181e:	eb d1                	jmp    8017f1 <read+0x58>
+
+00801820 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801820:	55                   	push   %ebp
+  801821:	89 e5                	mov    %esp,%ebp
+  801823:	57                   	push   %edi
+  801824:	56                   	push   %esi
+  801825:	53                   	push   %ebx
+  801826:	83 ec 0c             	sub    $0xc,%esp
+  801829:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80182c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80182f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801834:	eb 02                	jmp    801838 <readn+0x18>
+  801836:	01 c3                	add    %eax,%ebx
+  801838:	39 f3                	cmp    %esi,%ebx
+  80183a:	73 21                	jae    80185d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80183c:	83 ec 04             	sub    $0x4,%esp
+  80183f:	89 f0                	mov    %esi,%eax
+  801841:	29 d8                	sub    %ebx,%eax
+  801843:	50                   	push   %eax
+  801844:	89 d8                	mov    %ebx,%eax
+  801846:	03 45 0c             	add    0xc(%ebp),%eax
+  801849:	50                   	push   %eax
+  80184a:	57                   	push   %edi
+  80184b:	e8 49 ff ff ff       	call   801799 <read>
+		if (m < 0)
+  801850:	83 c4 10             	add    $0x10,%esp
+  801853:	85 c0                	test   %eax,%eax
+  801855:	78 04                	js     80185b <readn+0x3b>
+			return m;
+		if (m == 0)
+  801857:	75 dd                	jne    801836 <readn+0x16>
+  801859:	eb 02                	jmp    80185d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80185b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80185d:	89 d8                	mov    %ebx,%eax
+  80185f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801862:	5b                   	pop    %ebx
+  801863:	5e                   	pop    %esi
+  801864:	5f                   	pop    %edi
+  801865:	5d                   	pop    %ebp
+  801866:	c3                   	ret
+
+00801867 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801867:	55                   	push   %ebp
+  801868:	89 e5                	mov    %esp,%ebp
+  80186a:	56                   	push   %esi
+  80186b:	53                   	push   %ebx
+  80186c:	83 ec 18             	sub    $0x18,%esp
+  80186f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801872:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801875:	50                   	push   %eax
+  801876:	53                   	push   %ebx
+  801877:	e8 b7 fc ff ff       	call   801533 <fd_lookup>
+  80187c:	83 c4 10             	add    $0x10,%esp
+  80187f:	85 c0                	test   %eax,%eax
+  801881:	78 37                	js     8018ba <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801883:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801886:	83 ec 08             	sub    $0x8,%esp
+  801889:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80188c:	50                   	push   %eax
+  80188d:	ff 36                	push   (%esi)
+  80188f:	e8 ef fc ff ff       	call   801583 <dev_lookup>
+  801894:	83 c4 10             	add    $0x10,%esp
+  801897:	85 c0                	test   %eax,%eax
+  801899:	78 1f                	js     8018ba <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80189b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80189f:	74 20                	je     8018c1 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8018a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018a4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018a7:	85 c0                	test   %eax,%eax
+  8018a9:	74 37                	je     8018e2 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018ab:	83 ec 04             	sub    $0x4,%esp
+  8018ae:	ff 75 10             	push   0x10(%ebp)
+  8018b1:	ff 75 0c             	push   0xc(%ebp)
+  8018b4:	56                   	push   %esi
+  8018b5:	ff d0                	call   *%eax
+  8018b7:	83 c4 10             	add    $0x10,%esp
+}
+  8018ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018bd:	5b                   	pop    %ebx
+  8018be:	5e                   	pop    %esi
+  8018bf:	5d                   	pop    %ebp
+  8018c0:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018c1:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8018c6:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8018c9:	83 ec 04             	sub    $0x4,%esp
+  8018cc:	53                   	push   %ebx
+  8018cd:	50                   	push   %eax
+  8018ce:	68 1d 30 80 00       	push   $0x80301d
+  8018d3:	e8 20 e9 ff ff       	call   8001f8 <cprintf>
+		return -E_INVAL;
+  8018d8:	83 c4 10             	add    $0x10,%esp
+  8018db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018e0:	eb d8                	jmp    8018ba <write+0x53>
+		return -E_NOT_SUPP;
+  8018e2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018e7:	eb d1                	jmp    8018ba <write+0x53>
+
+008018e9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8018e9:	55                   	push   %ebp
+  8018ea:	89 e5                	mov    %esp,%ebp
+  8018ec:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018f2:	50                   	push   %eax
+  8018f3:	ff 75 08             	push   0x8(%ebp)
+  8018f6:	e8 38 fc ff ff       	call   801533 <fd_lookup>
+  8018fb:	83 c4 10             	add    $0x10,%esp
+  8018fe:	85 c0                	test   %eax,%eax
+  801900:	78 0e                	js     801910 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801902:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801905:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801908:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80190b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801910:	c9                   	leave
+  801911:	c3                   	ret
+
+00801912 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	56                   	push   %esi
+  801916:	53                   	push   %ebx
+  801917:	83 ec 18             	sub    $0x18,%esp
+  80191a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80191d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801920:	50                   	push   %eax
+  801921:	53                   	push   %ebx
+  801922:	e8 0c fc ff ff       	call   801533 <fd_lookup>
+  801927:	83 c4 10             	add    $0x10,%esp
+  80192a:	85 c0                	test   %eax,%eax
+  80192c:	78 34                	js     801962 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80192e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801931:	83 ec 08             	sub    $0x8,%esp
+  801934:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801937:	50                   	push   %eax
+  801938:	ff 36                	push   (%esi)
+  80193a:	e8 44 fc ff ff       	call   801583 <dev_lookup>
+  80193f:	83 c4 10             	add    $0x10,%esp
+  801942:	85 c0                	test   %eax,%eax
+  801944:	78 1c                	js     801962 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801946:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80194a:	74 1d                	je     801969 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80194c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80194f:	8b 40 18             	mov    0x18(%eax),%eax
+  801952:	85 c0                	test   %eax,%eax
+  801954:	74 34                	je     80198a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801956:	83 ec 08             	sub    $0x8,%esp
+  801959:	ff 75 0c             	push   0xc(%ebp)
+  80195c:	56                   	push   %esi
+  80195d:	ff d0                	call   *%eax
+  80195f:	83 c4 10             	add    $0x10,%esp
+}
+  801962:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801965:	5b                   	pop    %ebx
+  801966:	5e                   	pop    %esi
+  801967:	5d                   	pop    %ebp
+  801968:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801969:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  80196e:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801971:	83 ec 04             	sub    $0x4,%esp
+  801974:	53                   	push   %ebx
+  801975:	50                   	push   %eax
+  801976:	68 e0 2f 80 00       	push   $0x802fe0
+  80197b:	e8 78 e8 ff ff       	call   8001f8 <cprintf>
+		return -E_INVAL;
+  801980:	83 c4 10             	add    $0x10,%esp
+  801983:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801988:	eb d8                	jmp    801962 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80198a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80198f:	eb d1                	jmp    801962 <ftruncate+0x50>
+
+00801991 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801991:	55                   	push   %ebp
+  801992:	89 e5                	mov    %esp,%ebp
+  801994:	56                   	push   %esi
+  801995:	53                   	push   %ebx
+  801996:	83 ec 18             	sub    $0x18,%esp
+  801999:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80199c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80199f:	50                   	push   %eax
+  8019a0:	ff 75 08             	push   0x8(%ebp)
+  8019a3:	e8 8b fb ff ff       	call   801533 <fd_lookup>
+  8019a8:	83 c4 10             	add    $0x10,%esp
+  8019ab:	85 c0                	test   %eax,%eax
+  8019ad:	78 49                	js     8019f8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019af:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019b2:	83 ec 08             	sub    $0x8,%esp
+  8019b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b8:	50                   	push   %eax
+  8019b9:	ff 36                	push   (%esi)
+  8019bb:	e8 c3 fb ff ff       	call   801583 <dev_lookup>
+  8019c0:	83 c4 10             	add    $0x10,%esp
+  8019c3:	85 c0                	test   %eax,%eax
+  8019c5:	78 31                	js     8019f8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8019c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019ca:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8019ce:	74 2f                	je     8019ff <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8019d0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8019d3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8019da:	00 00 00 
+	stat->st_isdir = 0;
+  8019dd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019e4:	00 00 00 
+	stat->st_dev = dev;
+  8019e7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8019ed:	83 ec 08             	sub    $0x8,%esp
+  8019f0:	53                   	push   %ebx
+  8019f1:	56                   	push   %esi
+  8019f2:	ff 50 14             	call   *0x14(%eax)
+  8019f5:	83 c4 10             	add    $0x10,%esp
+}
+  8019f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019fb:	5b                   	pop    %ebx
+  8019fc:	5e                   	pop    %esi
+  8019fd:	5d                   	pop    %ebp
+  8019fe:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019ff:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a04:	eb f2                	jmp    8019f8 <fstat+0x67>
+
+00801a06 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a06:	55                   	push   %ebp
+  801a07:	89 e5                	mov    %esp,%ebp
+  801a09:	56                   	push   %esi
+  801a0a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a0b:	83 ec 08             	sub    $0x8,%esp
+  801a0e:	6a 00                	push   $0x0
+  801a10:	ff 75 08             	push   0x8(%ebp)
+  801a13:	e8 e4 01 00 00       	call   801bfc <open>
+  801a18:	89 c3                	mov    %eax,%ebx
+  801a1a:	83 c4 10             	add    $0x10,%esp
+  801a1d:	85 c0                	test   %eax,%eax
+  801a1f:	78 1b                	js     801a3c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801a21:	83 ec 08             	sub    $0x8,%esp
+  801a24:	ff 75 0c             	push   0xc(%ebp)
+  801a27:	50                   	push   %eax
+  801a28:	e8 64 ff ff ff       	call   801991 <fstat>
+  801a2d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a2f:	89 1c 24             	mov    %ebx,(%esp)
+  801a32:	e8 26 fc ff ff       	call   80165d <close>
+	return r;
+  801a37:	83 c4 10             	add    $0x10,%esp
+  801a3a:	89 f3                	mov    %esi,%ebx
+}
+  801a3c:	89 d8                	mov    %ebx,%eax
+  801a3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a41:	5b                   	pop    %ebx
+  801a42:	5e                   	pop    %esi
+  801a43:	5d                   	pop    %ebp
+  801a44:	c3                   	ret
+
+00801a45 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a45:	55                   	push   %ebp
+  801a46:	89 e5                	mov    %esp,%ebp
+  801a48:	56                   	push   %esi
+  801a49:	53                   	push   %ebx
+  801a4a:	89 c6                	mov    %eax,%esi
+  801a4c:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801a4e:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801a55:	74 27                	je     801a7e <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a57:	6a 07                	push   $0x7
+  801a59:	68 00 60 80 00       	push   $0x806000
+  801a5e:	56                   	push   %esi
+  801a5f:	ff 35 00 50 80 00    	push   0x805000
+  801a65:	e8 e8 f9 ff ff       	call   801452 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801a6a:	83 c4 0c             	add    $0xc,%esp
+  801a6d:	6a 00                	push   $0x0
+  801a6f:	53                   	push   %ebx
+  801a70:	6a 00                	push   $0x0
+  801a72:	e8 63 f9 ff ff       	call   8013da <ipc_recv>
+}
+  801a77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a7a:	5b                   	pop    %ebx
+  801a7b:	5e                   	pop    %esi
+  801a7c:	5d                   	pop    %ebp
+  801a7d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a7e:	83 ec 0c             	sub    $0xc,%esp
+  801a81:	6a 01                	push   $0x1
+  801a83:	e8 1e fa ff ff       	call   8014a6 <ipc_find_env>
+  801a88:	a3 00 50 80 00       	mov    %eax,0x805000
+  801a8d:	83 c4 10             	add    $0x10,%esp
+  801a90:	eb c5                	jmp    801a57 <fsipc+0x12>
+
+00801a92 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a92:	55                   	push   %ebp
+  801a93:	89 e5                	mov    %esp,%ebp
+  801a95:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a98:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a9b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a9e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801aa3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aa6:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801aab:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab0:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ab5:	e8 8b ff ff ff       	call   801a45 <fsipc>
+}
+  801aba:	c9                   	leave
+  801abb:	c3                   	ret
+
+00801abc <devfile_flush>:
+{
+  801abc:	55                   	push   %ebp
+  801abd:	89 e5                	mov    %esp,%ebp
+  801abf:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ac2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ac8:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801acd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad2:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ad7:	e8 69 ff ff ff       	call   801a45 <fsipc>
+}
+  801adc:	c9                   	leave
+  801add:	c3                   	ret
+
+00801ade <devfile_stat>:
+{
+  801ade:	55                   	push   %ebp
+  801adf:	89 e5                	mov    %esp,%ebp
+  801ae1:	53                   	push   %ebx
+  801ae2:	83 ec 04             	sub    $0x4,%esp
+  801ae5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ae8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aeb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aee:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801af3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af8:	b8 05 00 00 00       	mov    $0x5,%eax
+  801afd:	e8 43 ff ff ff       	call   801a45 <fsipc>
+  801b02:	85 c0                	test   %eax,%eax
+  801b04:	78 2c                	js     801b32 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b06:	83 ec 08             	sub    $0x8,%esp
+  801b09:	68 00 60 80 00       	push   $0x806000
+  801b0e:	53                   	push   %ebx
+  801b0f:	e8 d2 ec ff ff       	call   8007e6 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b14:	a1 80 60 80 00       	mov    0x806080,%eax
+  801b19:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b1f:	a1 84 60 80 00       	mov    0x806084,%eax
+  801b24:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801b2a:	83 c4 10             	add    $0x10,%esp
+  801b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b35:	c9                   	leave
+  801b36:	c3                   	ret
+
+00801b37 <devfile_write>:
+{
+  801b37:	55                   	push   %ebp
+  801b38:	89 e5                	mov    %esp,%ebp
+  801b3a:	83 ec 0c             	sub    $0xc,%esp
+  801b3d:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801b40:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801b45:	39 d0                	cmp    %edx,%eax
+  801b47:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b4d:	8b 52 0c             	mov    0xc(%edx),%edx
+  801b50:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801b56:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801b5b:	50                   	push   %eax
+  801b5c:	ff 75 0c             	push   0xc(%ebp)
+  801b5f:	68 08 60 80 00       	push   $0x806008
+  801b64:	e8 03 ee ff ff       	call   80096c <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801b69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b73:	e8 cd fe ff ff       	call   801a45 <fsipc>
+}
+  801b78:	c9                   	leave
+  801b79:	c3                   	ret
+
+00801b7a <devfile_read>:
+{
+  801b7a:	55                   	push   %ebp
+  801b7b:	89 e5                	mov    %esp,%ebp
+  801b7d:	56                   	push   %esi
+  801b7e:	53                   	push   %ebx
+  801b7f:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b85:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b88:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801b8d:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b98:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b9d:	e8 a3 fe ff ff       	call   801a45 <fsipc>
+  801ba2:	89 c3                	mov    %eax,%ebx
+  801ba4:	85 c0                	test   %eax,%eax
+  801ba6:	78 1f                	js     801bc7 <devfile_read+0x4d>
+	assert(r <= n);
+  801ba8:	39 c6                	cmp    %eax,%esi
+  801baa:	72 24                	jb     801bd0 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801bac:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801bb1:	7f 33                	jg     801be6 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801bb3:	83 ec 04             	sub    $0x4,%esp
+  801bb6:	50                   	push   %eax
+  801bb7:	68 00 60 80 00       	push   $0x806000
+  801bbc:	ff 75 0c             	push   0xc(%ebp)
+  801bbf:	e8 a8 ed ff ff       	call   80096c <memmove>
+	return r;
+  801bc4:	83 c4 10             	add    $0x10,%esp
+}
+  801bc7:	89 d8                	mov    %ebx,%eax
+  801bc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bcc:	5b                   	pop    %ebx
+  801bcd:	5e                   	pop    %esi
+  801bce:	5d                   	pop    %ebp
+  801bcf:	c3                   	ret
+	assert(r <= n);
+  801bd0:	68 50 30 80 00       	push   $0x803050
+  801bd5:	68 57 30 80 00       	push   $0x803057
+  801bda:	6a 7c                	push   $0x7c
+  801bdc:	68 6c 30 80 00       	push   $0x80306c
+  801be1:	e8 e1 09 00 00       	call   8025c7 <_panic>
+	assert(r <= PGSIZE);
+  801be6:	68 77 30 80 00       	push   $0x803077
+  801beb:	68 57 30 80 00       	push   $0x803057
+  801bf0:	6a 7d                	push   $0x7d
+  801bf2:	68 6c 30 80 00       	push   $0x80306c
+  801bf7:	e8 cb 09 00 00       	call   8025c7 <_panic>
+
+00801bfc <open>:
+{
+  801bfc:	55                   	push   %ebp
+  801bfd:	89 e5                	mov    %esp,%ebp
+  801bff:	56                   	push   %esi
+  801c00:	53                   	push   %ebx
+  801c01:	83 ec 1c             	sub    $0x1c,%esp
+  801c04:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801c07:	56                   	push   %esi
+  801c08:	e8 9e eb ff ff       	call   8007ab <strlen>
+  801c0d:	83 c4 10             	add    $0x10,%esp
+  801c10:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c15:	7f 6c                	jg     801c83 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801c17:	83 ec 0c             	sub    $0xc,%esp
+  801c1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c1d:	50                   	push   %eax
+  801c1e:	e8 ba f8 ff ff       	call   8014dd <fd_alloc>
+  801c23:	89 c3                	mov    %eax,%ebx
+  801c25:	83 c4 10             	add    $0x10,%esp
+  801c28:	85 c0                	test   %eax,%eax
+  801c2a:	78 3c                	js     801c68 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801c2c:	83 ec 08             	sub    $0x8,%esp
+  801c2f:	56                   	push   %esi
+  801c30:	68 00 60 80 00       	push   $0x806000
+  801c35:	e8 ac eb ff ff       	call   8007e6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801c3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c3d:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801c42:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c45:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c4a:	e8 f6 fd ff ff       	call   801a45 <fsipc>
+  801c4f:	89 c3                	mov    %eax,%ebx
+  801c51:	83 c4 10             	add    $0x10,%esp
+  801c54:	85 c0                	test   %eax,%eax
+  801c56:	78 19                	js     801c71 <open+0x75>
+	return fd2num(fd);
+  801c58:	83 ec 0c             	sub    $0xc,%esp
+  801c5b:	ff 75 f4             	push   -0xc(%ebp)
+  801c5e:	e8 53 f8 ff ff       	call   8014b6 <fd2num>
+  801c63:	89 c3                	mov    %eax,%ebx
+  801c65:	83 c4 10             	add    $0x10,%esp
+}
+  801c68:	89 d8                	mov    %ebx,%eax
+  801c6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c6d:	5b                   	pop    %ebx
+  801c6e:	5e                   	pop    %esi
+  801c6f:	5d                   	pop    %ebp
+  801c70:	c3                   	ret
+		fd_close(fd, 0);
+  801c71:	83 ec 08             	sub    $0x8,%esp
+  801c74:	6a 00                	push   $0x0
+  801c76:	ff 75 f4             	push   -0xc(%ebp)
+  801c79:	e8 58 f9 ff ff       	call   8015d6 <fd_close>
+		return r;
+  801c7e:	83 c4 10             	add    $0x10,%esp
+  801c81:	eb e5                	jmp    801c68 <open+0x6c>
+		return -E_BAD_PATH;
+  801c83:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c88:	eb de                	jmp    801c68 <open+0x6c>
+
+00801c8a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c8a:	55                   	push   %ebp
+  801c8b:	89 e5                	mov    %esp,%ebp
+  801c8d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c90:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c95:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c9a:	e8 a6 fd ff ff       	call   801a45 <fsipc>
+}
+  801c9f:	c9                   	leave
+  801ca0:	c3                   	ret
+
+00801ca1 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ca1:	55                   	push   %ebp
+  801ca2:	89 e5                	mov    %esp,%ebp
+  801ca4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801ca7:	68 83 30 80 00       	push   $0x803083
+  801cac:	ff 75 0c             	push   0xc(%ebp)
+  801caf:	e8 32 eb ff ff       	call   8007e6 <strcpy>
+	return 0;
+}
+  801cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb9:	c9                   	leave
+  801cba:	c3                   	ret
+
+00801cbb <devsock_close>:
+{
+  801cbb:	55                   	push   %ebp
+  801cbc:	89 e5                	mov    %esp,%ebp
+  801cbe:	53                   	push   %ebx
+  801cbf:	83 ec 10             	sub    $0x10,%esp
+  801cc2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801cc5:	53                   	push   %ebx
+  801cc6:	e8 d3 09 00 00       	call   80269e <pageref>
+  801ccb:	89 c2                	mov    %eax,%edx
+  801ccd:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801cd5:	83 fa 01             	cmp    $0x1,%edx
+  801cd8:	74 05                	je     801cdf <devsock_close+0x24>
+}
+  801cda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cdd:	c9                   	leave
+  801cde:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801cdf:	83 ec 0c             	sub    $0xc,%esp
+  801ce2:	ff 73 0c             	push   0xc(%ebx)
+  801ce5:	e8 b7 02 00 00       	call   801fa1 <nsipc_close>
+  801cea:	83 c4 10             	add    $0x10,%esp
+  801ced:	eb eb                	jmp    801cda <devsock_close+0x1f>
+
+00801cef <devsock_write>:
+{
+  801cef:	55                   	push   %ebp
+  801cf0:	89 e5                	mov    %esp,%ebp
+  801cf2:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801cf5:	6a 00                	push   $0x0
+  801cf7:	ff 75 10             	push   0x10(%ebp)
+  801cfa:	ff 75 0c             	push   0xc(%ebp)
+  801cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d00:	ff 70 0c             	push   0xc(%eax)
+  801d03:	e8 79 03 00 00       	call   802081 <nsipc_send>
+}
+  801d08:	c9                   	leave
+  801d09:	c3                   	ret
+
+00801d0a <devsock_read>:
+{
+  801d0a:	55                   	push   %ebp
+  801d0b:	89 e5                	mov    %esp,%ebp
+  801d0d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801d10:	6a 00                	push   $0x0
+  801d12:	ff 75 10             	push   0x10(%ebp)
+  801d15:	ff 75 0c             	push   0xc(%ebp)
+  801d18:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d1b:	ff 70 0c             	push   0xc(%eax)
+  801d1e:	e8 ef 02 00 00       	call   802012 <nsipc_recv>
+}
+  801d23:	c9                   	leave
+  801d24:	c3                   	ret
+
+00801d25 <fd2sockid>:
+{
+  801d25:	55                   	push   %ebp
+  801d26:	89 e5                	mov    %esp,%ebp
+  801d28:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d2b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d2e:	52                   	push   %edx
+  801d2f:	50                   	push   %eax
+  801d30:	e8 fe f7 ff ff       	call   801533 <fd_lookup>
+  801d35:	83 c4 10             	add    $0x10,%esp
+  801d38:	85 c0                	test   %eax,%eax
+  801d3a:	78 10                	js     801d4c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d3f:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801d45:	39 08                	cmp    %ecx,(%eax)
+  801d47:	75 05                	jne    801d4e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d49:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d4c:	c9                   	leave
+  801d4d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d4e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d53:	eb f7                	jmp    801d4c <fd2sockid+0x27>
+
+00801d55 <alloc_sockfd>:
+{
+  801d55:	55                   	push   %ebp
+  801d56:	89 e5                	mov    %esp,%ebp
+  801d58:	56                   	push   %esi
+  801d59:	53                   	push   %ebx
+  801d5a:	83 ec 1c             	sub    $0x1c,%esp
+  801d5d:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d5f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d62:	50                   	push   %eax
+  801d63:	e8 75 f7 ff ff       	call   8014dd <fd_alloc>
+  801d68:	89 c3                	mov    %eax,%ebx
+  801d6a:	83 c4 10             	add    $0x10,%esp
+  801d6d:	85 c0                	test   %eax,%eax
+  801d6f:	78 43                	js     801db4 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d71:	83 ec 04             	sub    $0x4,%esp
+  801d74:	68 07 04 00 00       	push   $0x407
+  801d79:	ff 75 f4             	push   -0xc(%ebp)
+  801d7c:	6a 00                	push   $0x0
+  801d7e:	e8 d0 ee ff ff       	call   800c53 <sys_page_alloc>
+  801d83:	89 c3                	mov    %eax,%ebx
+  801d85:	83 c4 10             	add    $0x10,%esp
+  801d88:	85 c0                	test   %eax,%eax
+  801d8a:	78 28                	js     801db4 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d8f:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d95:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d9a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801da1:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801da4:	83 ec 0c             	sub    $0xc,%esp
+  801da7:	50                   	push   %eax
+  801da8:	e8 09 f7 ff ff       	call   8014b6 <fd2num>
+  801dad:	89 c3                	mov    %eax,%ebx
+  801daf:	83 c4 10             	add    $0x10,%esp
+  801db2:	eb 0c                	jmp    801dc0 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801db4:	83 ec 0c             	sub    $0xc,%esp
+  801db7:	56                   	push   %esi
+  801db8:	e8 e4 01 00 00       	call   801fa1 <nsipc_close>
+		return r;
+  801dbd:	83 c4 10             	add    $0x10,%esp
+}
+  801dc0:	89 d8                	mov    %ebx,%eax
+  801dc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dc5:	5b                   	pop    %ebx
+  801dc6:	5e                   	pop    %esi
+  801dc7:	5d                   	pop    %ebp
+  801dc8:	c3                   	ret
+
+00801dc9 <accept>:
+{
+  801dc9:	55                   	push   %ebp
+  801dca:	89 e5                	mov    %esp,%ebp
+  801dcc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd2:	e8 4e ff ff ff       	call   801d25 <fd2sockid>
+  801dd7:	85 c0                	test   %eax,%eax
+  801dd9:	78 1b                	js     801df6 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801ddb:	83 ec 04             	sub    $0x4,%esp
+  801dde:	ff 75 10             	push   0x10(%ebp)
+  801de1:	ff 75 0c             	push   0xc(%ebp)
+  801de4:	50                   	push   %eax
+  801de5:	e8 0e 01 00 00       	call   801ef8 <nsipc_accept>
+  801dea:	83 c4 10             	add    $0x10,%esp
+  801ded:	85 c0                	test   %eax,%eax
+  801def:	78 05                	js     801df6 <accept+0x2d>
+	return alloc_sockfd(r);
+  801df1:	e8 5f ff ff ff       	call   801d55 <alloc_sockfd>
+}
+  801df6:	c9                   	leave
+  801df7:	c3                   	ret
+
+00801df8 <bind>:
+{
+  801df8:	55                   	push   %ebp
+  801df9:	89 e5                	mov    %esp,%ebp
+  801dfb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e01:	e8 1f ff ff ff       	call   801d25 <fd2sockid>
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	78 12                	js     801e1c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e0a:	83 ec 04             	sub    $0x4,%esp
+  801e0d:	ff 75 10             	push   0x10(%ebp)
+  801e10:	ff 75 0c             	push   0xc(%ebp)
+  801e13:	50                   	push   %eax
+  801e14:	e8 31 01 00 00       	call   801f4a <nsipc_bind>
+  801e19:	83 c4 10             	add    $0x10,%esp
+}
+  801e1c:	c9                   	leave
+  801e1d:	c3                   	ret
+
+00801e1e <shutdown>:
+{
+  801e1e:	55                   	push   %ebp
+  801e1f:	89 e5                	mov    %esp,%ebp
+  801e21:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e24:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e27:	e8 f9 fe ff ff       	call   801d25 <fd2sockid>
+  801e2c:	85 c0                	test   %eax,%eax
+  801e2e:	78 0f                	js     801e3f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e30:	83 ec 08             	sub    $0x8,%esp
+  801e33:	ff 75 0c             	push   0xc(%ebp)
+  801e36:	50                   	push   %eax
+  801e37:	e8 43 01 00 00       	call   801f7f <nsipc_shutdown>
+  801e3c:	83 c4 10             	add    $0x10,%esp
+}
+  801e3f:	c9                   	leave
+  801e40:	c3                   	ret
+
+00801e41 <connect>:
+{
+  801e41:	55                   	push   %ebp
+  801e42:	89 e5                	mov    %esp,%ebp
+  801e44:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e47:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4a:	e8 d6 fe ff ff       	call   801d25 <fd2sockid>
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	78 12                	js     801e65 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e53:	83 ec 04             	sub    $0x4,%esp
+  801e56:	ff 75 10             	push   0x10(%ebp)
+  801e59:	ff 75 0c             	push   0xc(%ebp)
+  801e5c:	50                   	push   %eax
+  801e5d:	e8 59 01 00 00       	call   801fbb <nsipc_connect>
+  801e62:	83 c4 10             	add    $0x10,%esp
+}
+  801e65:	c9                   	leave
+  801e66:	c3                   	ret
+
+00801e67 <listen>:
+{
+  801e67:	55                   	push   %ebp
+  801e68:	89 e5                	mov    %esp,%ebp
+  801e6a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e70:	e8 b0 fe ff ff       	call   801d25 <fd2sockid>
+  801e75:	85 c0                	test   %eax,%eax
+  801e77:	78 0f                	js     801e88 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e79:	83 ec 08             	sub    $0x8,%esp
+  801e7c:	ff 75 0c             	push   0xc(%ebp)
+  801e7f:	50                   	push   %eax
+  801e80:	e8 6b 01 00 00       	call   801ff0 <nsipc_listen>
+  801e85:	83 c4 10             	add    $0x10,%esp
+}
+  801e88:	c9                   	leave
+  801e89:	c3                   	ret
+
+00801e8a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e8a:	55                   	push   %ebp
+  801e8b:	89 e5                	mov    %esp,%ebp
+  801e8d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e90:	ff 75 10             	push   0x10(%ebp)
+  801e93:	ff 75 0c             	push   0xc(%ebp)
+  801e96:	ff 75 08             	push   0x8(%ebp)
+  801e99:	e8 41 02 00 00       	call   8020df <nsipc_socket>
+  801e9e:	83 c4 10             	add    $0x10,%esp
+  801ea1:	85 c0                	test   %eax,%eax
+  801ea3:	78 05                	js     801eaa <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801ea5:	e8 ab fe ff ff       	call   801d55 <alloc_sockfd>
+}
+  801eaa:	c9                   	leave
+  801eab:	c3                   	ret
+
+00801eac <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801eac:	55                   	push   %ebp
+  801ead:	89 e5                	mov    %esp,%ebp
+  801eaf:	53                   	push   %ebx
+  801eb0:	83 ec 04             	sub    $0x4,%esp
+  801eb3:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801eb5:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801ebc:	74 26                	je     801ee4 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801ebe:	6a 07                	push   $0x7
+  801ec0:	68 00 70 80 00       	push   $0x807000
+  801ec5:	53                   	push   %ebx
+  801ec6:	ff 35 04 50 80 00    	push   0x805004
+  801ecc:	e8 81 f5 ff ff       	call   801452 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801ed1:	83 c4 0c             	add    $0xc,%esp
+  801ed4:	6a 00                	push   $0x0
+  801ed6:	6a 00                	push   $0x0
+  801ed8:	6a 00                	push   $0x0
+  801eda:	e8 fb f4 ff ff       	call   8013da <ipc_recv>
+}
+  801edf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee2:	c9                   	leave
+  801ee3:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ee4:	83 ec 0c             	sub    $0xc,%esp
+  801ee7:	6a 02                	push   $0x2
+  801ee9:	e8 b8 f5 ff ff       	call   8014a6 <ipc_find_env>
+  801eee:	a3 04 50 80 00       	mov    %eax,0x805004
+  801ef3:	83 c4 10             	add    $0x10,%esp
+  801ef6:	eb c6                	jmp    801ebe <nsipc+0x12>
+
+00801ef8 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ef8:	55                   	push   %ebp
+  801ef9:	89 e5                	mov    %esp,%ebp
+  801efb:	56                   	push   %esi
+  801efc:	53                   	push   %ebx
+  801efd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801f00:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f03:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801f08:	8b 06                	mov    (%esi),%eax
+  801f0a:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801f0f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f14:	e8 93 ff ff ff       	call   801eac <nsipc>
+  801f19:	89 c3                	mov    %eax,%ebx
+  801f1b:	85 c0                	test   %eax,%eax
+  801f1d:	79 09                	jns    801f28 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801f1f:	89 d8                	mov    %ebx,%eax
+  801f21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f24:	5b                   	pop    %ebx
+  801f25:	5e                   	pop    %esi
+  801f26:	5d                   	pop    %ebp
+  801f27:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801f28:	83 ec 04             	sub    $0x4,%esp
+  801f2b:	ff 35 10 70 80 00    	push   0x807010
+  801f31:	68 00 70 80 00       	push   $0x807000
+  801f36:	ff 75 0c             	push   0xc(%ebp)
+  801f39:	e8 2e ea ff ff       	call   80096c <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f3e:	a1 10 70 80 00       	mov    0x807010,%eax
+  801f43:	89 06                	mov    %eax,(%esi)
+  801f45:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f48:	eb d5                	jmp    801f1f <nsipc_accept+0x27>
+
+00801f4a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f4a:	55                   	push   %ebp
+  801f4b:	89 e5                	mov    %esp,%ebp
+  801f4d:	53                   	push   %ebx
+  801f4e:	83 ec 08             	sub    $0x8,%esp
+  801f51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f54:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f57:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f5c:	53                   	push   %ebx
+  801f5d:	ff 75 0c             	push   0xc(%ebp)
+  801f60:	68 04 70 80 00       	push   $0x807004
+  801f65:	e8 02 ea ff ff       	call   80096c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f6a:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801f70:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f75:	e8 32 ff ff ff       	call   801eac <nsipc>
+}
+  801f7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f7d:	c9                   	leave
+  801f7e:	c3                   	ret
+
+00801f7f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f7f:	55                   	push   %ebp
+  801f80:	89 e5                	mov    %esp,%ebp
+  801f82:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f88:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801f8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f90:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f95:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f9a:	e8 0d ff ff ff       	call   801eac <nsipc>
+}
+  801f9f:	c9                   	leave
+  801fa0:	c3                   	ret
+
+00801fa1 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801fa1:	55                   	push   %ebp
+  801fa2:	89 e5                	mov    %esp,%ebp
+  801fa4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801fa7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801faa:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801faf:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fb4:	e8 f3 fe ff ff       	call   801eac <nsipc>
+}
+  801fb9:	c9                   	leave
+  801fba:	c3                   	ret
+
+00801fbb <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801fbb:	55                   	push   %ebp
+  801fbc:	89 e5                	mov    %esp,%ebp
+  801fbe:	53                   	push   %ebx
+  801fbf:	83 ec 08             	sub    $0x8,%esp
+  801fc2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801fc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc8:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801fcd:	53                   	push   %ebx
+  801fce:	ff 75 0c             	push   0xc(%ebp)
+  801fd1:	68 04 70 80 00       	push   $0x807004
+  801fd6:	e8 91 e9 ff ff       	call   80096c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801fdb:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801fe1:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fe6:	e8 c1 fe ff ff       	call   801eac <nsipc>
+}
+  801feb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fee:	c9                   	leave
+  801fef:	c3                   	ret
+
+00801ff0 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801ff0:	55                   	push   %ebp
+  801ff1:	89 e5                	mov    %esp,%ebp
+  801ff3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801ff6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801ffe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802001:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802006:	b8 06 00 00 00       	mov    $0x6,%eax
+  80200b:	e8 9c fe ff ff       	call   801eac <nsipc>
+}
+  802010:	c9                   	leave
+  802011:	c3                   	ret
+
+00802012 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802012:	55                   	push   %ebp
+  802013:	89 e5                	mov    %esp,%ebp
+  802015:	56                   	push   %esi
+  802016:	53                   	push   %ebx
+  802017:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80201a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802022:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802028:	8b 45 14             	mov    0x14(%ebp),%eax
+  80202b:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802030:	b8 07 00 00 00       	mov    $0x7,%eax
+  802035:	e8 72 fe ff ff       	call   801eac <nsipc>
+  80203a:	89 c3                	mov    %eax,%ebx
+  80203c:	85 c0                	test   %eax,%eax
+  80203e:	78 22                	js     802062 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802040:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802045:	39 c6                	cmp    %eax,%esi
+  802047:	0f 4e c6             	cmovle %esi,%eax
+  80204a:	39 c3                	cmp    %eax,%ebx
+  80204c:	7f 1d                	jg     80206b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80204e:	83 ec 04             	sub    $0x4,%esp
+  802051:	53                   	push   %ebx
+  802052:	68 00 70 80 00       	push   $0x807000
+  802057:	ff 75 0c             	push   0xc(%ebp)
+  80205a:	e8 0d e9 ff ff       	call   80096c <memmove>
+  80205f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802062:	89 d8                	mov    %ebx,%eax
+  802064:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802067:	5b                   	pop    %ebx
+  802068:	5e                   	pop    %esi
+  802069:	5d                   	pop    %ebp
+  80206a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80206b:	68 8f 30 80 00       	push   $0x80308f
+  802070:	68 57 30 80 00       	push   $0x803057
+  802075:	6a 62                	push   $0x62
+  802077:	68 a4 30 80 00       	push   $0x8030a4
+  80207c:	e8 46 05 00 00       	call   8025c7 <_panic>
+
+00802081 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802081:	55                   	push   %ebp
+  802082:	89 e5                	mov    %esp,%ebp
+  802084:	53                   	push   %ebx
+  802085:	83 ec 04             	sub    $0x4,%esp
+  802088:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80208b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80208e:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802093:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802099:	7f 2e                	jg     8020c9 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80209b:	83 ec 04             	sub    $0x4,%esp
+  80209e:	53                   	push   %ebx
+  80209f:	ff 75 0c             	push   0xc(%ebp)
+  8020a2:	68 0c 70 80 00       	push   $0x80700c
+  8020a7:	e8 c0 e8 ff ff       	call   80096c <memmove>
+	nsipcbuf.send.req_size = size;
+  8020ac:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8020b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020b5:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8020ba:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020bf:	e8 e8 fd ff ff       	call   801eac <nsipc>
+}
+  8020c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020c7:	c9                   	leave
+  8020c8:	c3                   	ret
+	assert(size < 1600);
+  8020c9:	68 b0 30 80 00       	push   $0x8030b0
+  8020ce:	68 57 30 80 00       	push   $0x803057
+  8020d3:	6a 6d                	push   $0x6d
+  8020d5:	68 a4 30 80 00       	push   $0x8030a4
+  8020da:	e8 e8 04 00 00       	call   8025c7 <_panic>
+
+008020df <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8020df:	55                   	push   %ebp
+  8020e0:	89 e5                	mov    %esp,%ebp
+  8020e2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  8020ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020f0:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020f5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020f8:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8020fd:	b8 09 00 00 00       	mov    $0x9,%eax
+  802102:	e8 a5 fd ff ff       	call   801eac <nsipc>
+}
+  802107:	c9                   	leave
+  802108:	c3                   	ret
+
+00802109 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802109:	55                   	push   %ebp
+  80210a:	89 e5                	mov    %esp,%ebp
+  80210c:	56                   	push   %esi
+  80210d:	53                   	push   %ebx
+  80210e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802111:	83 ec 0c             	sub    $0xc,%esp
+  802114:	ff 75 08             	push   0x8(%ebp)
+  802117:	e8 aa f3 ff ff       	call   8014c6 <fd2data>
+  80211c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80211e:	83 c4 08             	add    $0x8,%esp
+  802121:	68 bc 30 80 00       	push   $0x8030bc
+  802126:	53                   	push   %ebx
+  802127:	e8 ba e6 ff ff       	call   8007e6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80212c:	8b 46 04             	mov    0x4(%esi),%eax
+  80212f:	2b 06                	sub    (%esi),%eax
+  802131:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802137:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80213e:	00 00 00 
+	stat->st_dev = &devpipe;
+  802141:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802148:	40 80 00 
+	return 0;
+}
+  80214b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802150:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802153:	5b                   	pop    %ebx
+  802154:	5e                   	pop    %esi
+  802155:	5d                   	pop    %ebp
+  802156:	c3                   	ret
+
+00802157 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802157:	55                   	push   %ebp
+  802158:	89 e5                	mov    %esp,%ebp
+  80215a:	53                   	push   %ebx
+  80215b:	83 ec 0c             	sub    $0xc,%esp
+  80215e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802161:	53                   	push   %ebx
+  802162:	6a 00                	push   $0x0
+  802164:	e8 b2 eb ff ff       	call   800d1b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802169:	89 1c 24             	mov    %ebx,(%esp)
+  80216c:	e8 55 f3 ff ff       	call   8014c6 <fd2data>
+  802171:	83 c4 08             	add    $0x8,%esp
+  802174:	50                   	push   %eax
+  802175:	6a 00                	push   $0x0
+  802177:	e8 9f eb ff ff       	call   800d1b <sys_page_unmap>
+}
+  80217c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80217f:	c9                   	leave
+  802180:	c3                   	ret
+
+00802181 <_pipeisclosed>:
+{
+  802181:	55                   	push   %ebp
+  802182:	89 e5                	mov    %esp,%ebp
+  802184:	57                   	push   %edi
+  802185:	56                   	push   %esi
+  802186:	53                   	push   %ebx
+  802187:	83 ec 1c             	sub    $0x1c,%esp
+  80218a:	89 c7                	mov    %eax,%edi
+  80218c:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80218e:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  802193:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802196:	83 ec 0c             	sub    $0xc,%esp
+  802199:	57                   	push   %edi
+  80219a:	e8 ff 04 00 00       	call   80269e <pageref>
+  80219f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021a2:	89 34 24             	mov    %esi,(%esp)
+  8021a5:	e8 f4 04 00 00       	call   80269e <pageref>
+		nn = thisenv->env_runs;
+  8021aa:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+  8021b0:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8021b3:	83 c4 10             	add    $0x10,%esp
+  8021b6:	39 cb                	cmp    %ecx,%ebx
+  8021b8:	74 1b                	je     8021d5 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8021ba:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021bd:	75 cf                	jne    80218e <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8021bf:	8b 42 5c             	mov    0x5c(%edx),%eax
+  8021c2:	6a 01                	push   $0x1
+  8021c4:	50                   	push   %eax
+  8021c5:	53                   	push   %ebx
+  8021c6:	68 c3 30 80 00       	push   $0x8030c3
+  8021cb:	e8 28 e0 ff ff       	call   8001f8 <cprintf>
+  8021d0:	83 c4 10             	add    $0x10,%esp
+  8021d3:	eb b9                	jmp    80218e <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8021d5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021d8:	0f 94 c0             	sete   %al
+  8021db:	0f b6 c0             	movzbl %al,%eax
+}
+  8021de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021e1:	5b                   	pop    %ebx
+  8021e2:	5e                   	pop    %esi
+  8021e3:	5f                   	pop    %edi
+  8021e4:	5d                   	pop    %ebp
+  8021e5:	c3                   	ret
+
+008021e6 <devpipe_write>:
+{
+  8021e6:	55                   	push   %ebp
+  8021e7:	89 e5                	mov    %esp,%ebp
+  8021e9:	57                   	push   %edi
+  8021ea:	56                   	push   %esi
+  8021eb:	53                   	push   %ebx
+  8021ec:	83 ec 28             	sub    $0x28,%esp
+  8021ef:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8021f2:	56                   	push   %esi
+  8021f3:	e8 ce f2 ff ff       	call   8014c6 <fd2data>
+  8021f8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021fa:	83 c4 10             	add    $0x10,%esp
+  8021fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802202:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802205:	75 09                	jne    802210 <devpipe_write+0x2a>
+	return i;
+  802207:	89 f8                	mov    %edi,%eax
+  802209:	eb 23                	jmp    80222e <devpipe_write+0x48>
+			sys_yield();
+  80220b:	e8 c3 e9 ff ff       	call   800bd3 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802210:	8b 43 04             	mov    0x4(%ebx),%eax
+  802213:	8b 0b                	mov    (%ebx),%ecx
+  802215:	8d 51 20             	lea    0x20(%ecx),%edx
+  802218:	39 d0                	cmp    %edx,%eax
+  80221a:	72 1a                	jb     802236 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80221c:	89 da                	mov    %ebx,%edx
+  80221e:	89 f0                	mov    %esi,%eax
+  802220:	e8 5c ff ff ff       	call   802181 <_pipeisclosed>
+  802225:	85 c0                	test   %eax,%eax
+  802227:	74 e2                	je     80220b <devpipe_write+0x25>
+				return 0;
+  802229:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80222e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802231:	5b                   	pop    %ebx
+  802232:	5e                   	pop    %esi
+  802233:	5f                   	pop    %edi
+  802234:	5d                   	pop    %ebp
+  802235:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802236:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802239:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80223d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802240:	89 c2                	mov    %eax,%edx
+  802242:	c1 fa 1f             	sar    $0x1f,%edx
+  802245:	89 d1                	mov    %edx,%ecx
+  802247:	c1 e9 1b             	shr    $0x1b,%ecx
+  80224a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80224d:	83 e2 1f             	and    $0x1f,%edx
+  802250:	29 ca                	sub    %ecx,%edx
+  802252:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802256:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80225a:	83 c0 01             	add    $0x1,%eax
+  80225d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802260:	83 c7 01             	add    $0x1,%edi
+  802263:	eb 9d                	jmp    802202 <devpipe_write+0x1c>
+
+00802265 <devpipe_read>:
+{
+  802265:	55                   	push   %ebp
+  802266:	89 e5                	mov    %esp,%ebp
+  802268:	57                   	push   %edi
+  802269:	56                   	push   %esi
+  80226a:	53                   	push   %ebx
+  80226b:	83 ec 18             	sub    $0x18,%esp
+  80226e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802271:	57                   	push   %edi
+  802272:	e8 4f f2 ff ff       	call   8014c6 <fd2data>
+  802277:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802279:	83 c4 10             	add    $0x10,%esp
+  80227c:	be 00 00 00 00       	mov    $0x0,%esi
+  802281:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802284:	75 13                	jne    802299 <devpipe_read+0x34>
+	return i;
+  802286:	89 f0                	mov    %esi,%eax
+  802288:	eb 02                	jmp    80228c <devpipe_read+0x27>
+				return i;
+  80228a:	89 f0                	mov    %esi,%eax
+}
+  80228c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80228f:	5b                   	pop    %ebx
+  802290:	5e                   	pop    %esi
+  802291:	5f                   	pop    %edi
+  802292:	5d                   	pop    %ebp
+  802293:	c3                   	ret
+			sys_yield();
+  802294:	e8 3a e9 ff ff       	call   800bd3 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802299:	8b 03                	mov    (%ebx),%eax
+  80229b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80229e:	75 18                	jne    8022b8 <devpipe_read+0x53>
+			if (i > 0)
+  8022a0:	85 f6                	test   %esi,%esi
+  8022a2:	75 e6                	jne    80228a <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8022a4:	89 da                	mov    %ebx,%edx
+  8022a6:	89 f8                	mov    %edi,%eax
+  8022a8:	e8 d4 fe ff ff       	call   802181 <_pipeisclosed>
+  8022ad:	85 c0                	test   %eax,%eax
+  8022af:	74 e3                	je     802294 <devpipe_read+0x2f>
+				return 0;
+  8022b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b6:	eb d4                	jmp    80228c <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8022b8:	99                   	cltd
+  8022b9:	c1 ea 1b             	shr    $0x1b,%edx
+  8022bc:	01 d0                	add    %edx,%eax
+  8022be:	83 e0 1f             	and    $0x1f,%eax
+  8022c1:	29 d0                	sub    %edx,%eax
+  8022c3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8022c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022cb:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8022ce:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8022d1:	83 c6 01             	add    $0x1,%esi
+  8022d4:	eb ab                	jmp    802281 <devpipe_read+0x1c>
+
+008022d6 <pipe>:
+{
+  8022d6:	55                   	push   %ebp
+  8022d7:	89 e5                	mov    %esp,%ebp
+  8022d9:	56                   	push   %esi
+  8022da:	53                   	push   %ebx
+  8022db:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8022de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022e1:	50                   	push   %eax
+  8022e2:	e8 f6 f1 ff ff       	call   8014dd <fd_alloc>
+  8022e7:	89 c3                	mov    %eax,%ebx
+  8022e9:	83 c4 10             	add    $0x10,%esp
+  8022ec:	85 c0                	test   %eax,%eax
+  8022ee:	0f 88 23 01 00 00    	js     802417 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022f4:	83 ec 04             	sub    $0x4,%esp
+  8022f7:	68 07 04 00 00       	push   $0x407
+  8022fc:	ff 75 f4             	push   -0xc(%ebp)
+  8022ff:	6a 00                	push   $0x0
+  802301:	e8 4d e9 ff ff       	call   800c53 <sys_page_alloc>
+  802306:	89 c3                	mov    %eax,%ebx
+  802308:	83 c4 10             	add    $0x10,%esp
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	0f 88 04 01 00 00    	js     802417 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802313:	83 ec 0c             	sub    $0xc,%esp
+  802316:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802319:	50                   	push   %eax
+  80231a:	e8 be f1 ff ff       	call   8014dd <fd_alloc>
+  80231f:	89 c3                	mov    %eax,%ebx
+  802321:	83 c4 10             	add    $0x10,%esp
+  802324:	85 c0                	test   %eax,%eax
+  802326:	0f 88 db 00 00 00    	js     802407 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80232c:	83 ec 04             	sub    $0x4,%esp
+  80232f:	68 07 04 00 00       	push   $0x407
+  802334:	ff 75 f0             	push   -0x10(%ebp)
+  802337:	6a 00                	push   $0x0
+  802339:	e8 15 e9 ff ff       	call   800c53 <sys_page_alloc>
+  80233e:	89 c3                	mov    %eax,%ebx
+  802340:	83 c4 10             	add    $0x10,%esp
+  802343:	85 c0                	test   %eax,%eax
+  802345:	0f 88 bc 00 00 00    	js     802407 <pipe+0x131>
+	va = fd2data(fd0);
+  80234b:	83 ec 0c             	sub    $0xc,%esp
+  80234e:	ff 75 f4             	push   -0xc(%ebp)
+  802351:	e8 70 f1 ff ff       	call   8014c6 <fd2data>
+  802356:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802358:	83 c4 0c             	add    $0xc,%esp
+  80235b:	68 07 04 00 00       	push   $0x407
+  802360:	50                   	push   %eax
+  802361:	6a 00                	push   $0x0
+  802363:	e8 eb e8 ff ff       	call   800c53 <sys_page_alloc>
+  802368:	89 c3                	mov    %eax,%ebx
+  80236a:	83 c4 10             	add    $0x10,%esp
+  80236d:	85 c0                	test   %eax,%eax
+  80236f:	0f 88 82 00 00 00    	js     8023f7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802375:	83 ec 0c             	sub    $0xc,%esp
+  802378:	ff 75 f0             	push   -0x10(%ebp)
+  80237b:	e8 46 f1 ff ff       	call   8014c6 <fd2data>
+  802380:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802387:	50                   	push   %eax
+  802388:	6a 00                	push   $0x0
+  80238a:	56                   	push   %esi
+  80238b:	6a 00                	push   $0x0
+  80238d:	e8 47 e9 ff ff       	call   800cd9 <sys_page_map>
+  802392:	89 c3                	mov    %eax,%ebx
+  802394:	83 c4 20             	add    $0x20,%esp
+  802397:	85 c0                	test   %eax,%eax
+  802399:	78 4e                	js     8023e9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80239b:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8023a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023a3:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8023a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023a8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8023af:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8023b2:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8023b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8023b7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8023be:	83 ec 0c             	sub    $0xc,%esp
+  8023c1:	ff 75 f4             	push   -0xc(%ebp)
+  8023c4:	e8 ed f0 ff ff       	call   8014b6 <fd2num>
+  8023c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8023cc:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8023ce:	83 c4 04             	add    $0x4,%esp
+  8023d1:	ff 75 f0             	push   -0x10(%ebp)
+  8023d4:	e8 dd f0 ff ff       	call   8014b6 <fd2num>
+  8023d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8023dc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8023df:	83 c4 10             	add    $0x10,%esp
+  8023e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023e7:	eb 2e                	jmp    802417 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8023e9:	83 ec 08             	sub    $0x8,%esp
+  8023ec:	56                   	push   %esi
+  8023ed:	6a 00                	push   $0x0
+  8023ef:	e8 27 e9 ff ff       	call   800d1b <sys_page_unmap>
+  8023f4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8023f7:	83 ec 08             	sub    $0x8,%esp
+  8023fa:	ff 75 f0             	push   -0x10(%ebp)
+  8023fd:	6a 00                	push   $0x0
+  8023ff:	e8 17 e9 ff ff       	call   800d1b <sys_page_unmap>
+  802404:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802407:	83 ec 08             	sub    $0x8,%esp
+  80240a:	ff 75 f4             	push   -0xc(%ebp)
+  80240d:	6a 00                	push   $0x0
+  80240f:	e8 07 e9 ff ff       	call   800d1b <sys_page_unmap>
+  802414:	83 c4 10             	add    $0x10,%esp
+}
+  802417:	89 d8                	mov    %ebx,%eax
+  802419:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80241c:	5b                   	pop    %ebx
+  80241d:	5e                   	pop    %esi
+  80241e:	5d                   	pop    %ebp
+  80241f:	c3                   	ret
+
+00802420 <pipeisclosed>:
+{
+  802420:	55                   	push   %ebp
+  802421:	89 e5                	mov    %esp,%ebp
+  802423:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802426:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802429:	50                   	push   %eax
+  80242a:	ff 75 08             	push   0x8(%ebp)
+  80242d:	e8 01 f1 ff ff       	call   801533 <fd_lookup>
+  802432:	83 c4 10             	add    $0x10,%esp
+  802435:	85 c0                	test   %eax,%eax
+  802437:	78 18                	js     802451 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802439:	83 ec 0c             	sub    $0xc,%esp
+  80243c:	ff 75 f4             	push   -0xc(%ebp)
+  80243f:	e8 82 f0 ff ff       	call   8014c6 <fd2data>
+  802444:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802446:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802449:	e8 33 fd ff ff       	call   802181 <_pipeisclosed>
+  80244e:	83 c4 10             	add    $0x10,%esp
+}
+  802451:	c9                   	leave
+  802452:	c3                   	ret
+
+00802453 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802453:	b8 00 00 00 00       	mov    $0x0,%eax
+  802458:	c3                   	ret
+
+00802459 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802459:	55                   	push   %ebp
+  80245a:	89 e5                	mov    %esp,%ebp
+  80245c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80245f:	68 db 30 80 00       	push   $0x8030db
+  802464:	ff 75 0c             	push   0xc(%ebp)
+  802467:	e8 7a e3 ff ff       	call   8007e6 <strcpy>
+	return 0;
+}
+  80246c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802471:	c9                   	leave
+  802472:	c3                   	ret
+
+00802473 <devcons_write>:
+{
+  802473:	55                   	push   %ebp
+  802474:	89 e5                	mov    %esp,%ebp
+  802476:	57                   	push   %edi
+  802477:	56                   	push   %esi
+  802478:	53                   	push   %ebx
+  802479:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80247f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802484:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80248a:	eb 2e                	jmp    8024ba <devcons_write+0x47>
+		m = n - tot;
+  80248c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80248f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802491:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802496:	39 c3                	cmp    %eax,%ebx
+  802498:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80249b:	83 ec 04             	sub    $0x4,%esp
+  80249e:	53                   	push   %ebx
+  80249f:	89 f0                	mov    %esi,%eax
+  8024a1:	03 45 0c             	add    0xc(%ebp),%eax
+  8024a4:	50                   	push   %eax
+  8024a5:	57                   	push   %edi
+  8024a6:	e8 c1 e4 ff ff       	call   80096c <memmove>
+		sys_cputs(buf, m);
+  8024ab:	83 c4 08             	add    $0x8,%esp
+  8024ae:	53                   	push   %ebx
+  8024af:	57                   	push   %edi
+  8024b0:	e8 61 e6 ff ff       	call   800b16 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8024b5:	01 de                	add    %ebx,%esi
+  8024b7:	83 c4 10             	add    $0x10,%esp
+  8024ba:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8024bd:	72 cd                	jb     80248c <devcons_write+0x19>
+}
+  8024bf:	89 f0                	mov    %esi,%eax
+  8024c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024c4:	5b                   	pop    %ebx
+  8024c5:	5e                   	pop    %esi
+  8024c6:	5f                   	pop    %edi
+  8024c7:	5d                   	pop    %ebp
+  8024c8:	c3                   	ret
+
+008024c9 <devcons_read>:
+{
+  8024c9:	55                   	push   %ebp
+  8024ca:	89 e5                	mov    %esp,%ebp
+  8024cc:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8024cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8024d8:	75 07                	jne    8024e1 <devcons_read+0x18>
+  8024da:	eb 1f                	jmp    8024fb <devcons_read+0x32>
+		sys_yield();
+  8024dc:	e8 f2 e6 ff ff       	call   800bd3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8024e1:	e8 4e e6 ff ff       	call   800b34 <sys_cgetc>
+  8024e6:	85 c0                	test   %eax,%eax
+  8024e8:	74 f2                	je     8024dc <devcons_read+0x13>
+	if (c < 0)
+  8024ea:	78 0f                	js     8024fb <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8024ec:	83 f8 04             	cmp    $0x4,%eax
+  8024ef:	74 0c                	je     8024fd <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8024f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024f4:	88 02                	mov    %al,(%edx)
+	return 1;
+  8024f6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8024fb:	c9                   	leave
+  8024fc:	c3                   	ret
+		return 0;
+  8024fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802502:	eb f7                	jmp    8024fb <devcons_read+0x32>
+
+00802504 <cputchar>:
+{
+  802504:	55                   	push   %ebp
+  802505:	89 e5                	mov    %esp,%ebp
+  802507:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80250a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802510:	6a 01                	push   $0x1
+  802512:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802515:	50                   	push   %eax
+  802516:	e8 fb e5 ff ff       	call   800b16 <sys_cputs>
+}
+  80251b:	83 c4 10             	add    $0x10,%esp
+  80251e:	c9                   	leave
+  80251f:	c3                   	ret
+
+00802520 <getchar>:
+{
+  802520:	55                   	push   %ebp
+  802521:	89 e5                	mov    %esp,%ebp
+  802523:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802526:	6a 01                	push   $0x1
+  802528:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80252b:	50                   	push   %eax
+  80252c:	6a 00                	push   $0x0
+  80252e:	e8 66 f2 ff ff       	call   801799 <read>
+	if (r < 0)
+  802533:	83 c4 10             	add    $0x10,%esp
+  802536:	85 c0                	test   %eax,%eax
+  802538:	78 06                	js     802540 <getchar+0x20>
+	if (r < 1)
+  80253a:	74 06                	je     802542 <getchar+0x22>
+	return c;
+  80253c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802540:	c9                   	leave
+  802541:	c3                   	ret
+		return -E_EOF;
+  802542:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802547:	eb f7                	jmp    802540 <getchar+0x20>
+
+00802549 <iscons>:
+{
+  802549:	55                   	push   %ebp
+  80254a:	89 e5                	mov    %esp,%ebp
+  80254c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80254f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802552:	50                   	push   %eax
+  802553:	ff 75 08             	push   0x8(%ebp)
+  802556:	e8 d8 ef ff ff       	call   801533 <fd_lookup>
+  80255b:	83 c4 10             	add    $0x10,%esp
+  80255e:	85 c0                	test   %eax,%eax
+  802560:	78 11                	js     802573 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802562:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802565:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80256b:	39 10                	cmp    %edx,(%eax)
+  80256d:	0f 94 c0             	sete   %al
+  802570:	0f b6 c0             	movzbl %al,%eax
+}
+  802573:	c9                   	leave
+  802574:	c3                   	ret
+
+00802575 <opencons>:
+{
+  802575:	55                   	push   %ebp
+  802576:	89 e5                	mov    %esp,%ebp
+  802578:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80257b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80257e:	50                   	push   %eax
+  80257f:	e8 59 ef ff ff       	call   8014dd <fd_alloc>
+  802584:	83 c4 10             	add    $0x10,%esp
+  802587:	85 c0                	test   %eax,%eax
+  802589:	78 3a                	js     8025c5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80258b:	83 ec 04             	sub    $0x4,%esp
+  80258e:	68 07 04 00 00       	push   $0x407
+  802593:	ff 75 f4             	push   -0xc(%ebp)
+  802596:	6a 00                	push   $0x0
+  802598:	e8 b6 e6 ff ff       	call   800c53 <sys_page_alloc>
+  80259d:	83 c4 10             	add    $0x10,%esp
+  8025a0:	85 c0                	test   %eax,%eax
+  8025a2:	78 21                	js     8025c5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8025a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025a7:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8025ad:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8025af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025b2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8025b9:	83 ec 0c             	sub    $0xc,%esp
+  8025bc:	50                   	push   %eax
+  8025bd:	e8 f4 ee ff ff       	call   8014b6 <fd2num>
+  8025c2:	83 c4 10             	add    $0x10,%esp
+}
+  8025c5:	c9                   	leave
+  8025c6:	c3                   	ret
+
+008025c7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8025c7:	55                   	push   %ebp
+  8025c8:	89 e5                	mov    %esp,%ebp
+  8025ca:	56                   	push   %esi
+  8025cb:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8025cc:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8025cf:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8025d5:	e8 da e5 ff ff       	call   800bb4 <sys_getenvid>
+  8025da:	83 ec 0c             	sub    $0xc,%esp
+  8025dd:	ff 75 0c             	push   0xc(%ebp)
+  8025e0:	ff 75 08             	push   0x8(%ebp)
+  8025e3:	56                   	push   %esi
+  8025e4:	50                   	push   %eax
+  8025e5:	68 e8 30 80 00       	push   $0x8030e8
+  8025ea:	e8 09 dc ff ff       	call   8001f8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8025ef:	83 c4 18             	add    $0x18,%esp
+  8025f2:	53                   	push   %ebx
+  8025f3:	ff 75 10             	push   0x10(%ebp)
+  8025f6:	e8 ac db ff ff       	call   8001a7 <vcprintf>
+	cprintf("\n");
+  8025fb:	c7 04 24 d4 30 80 00 	movl   $0x8030d4,(%esp)
+  802602:	e8 f1 db ff ff       	call   8001f8 <cprintf>
+  802607:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80260a:	cc                   	int3
+	while (1)
+  80260b:	eb fd                	jmp    80260a <_panic+0x43>
+
+0080260d <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80260d:	55                   	push   %ebp
+  80260e:	89 e5                	mov    %esp,%ebp
+  802610:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802613:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80261a:	74 0a                	je     802626 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80261c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261f:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  802624:	c9                   	leave
+  802625:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  802626:	83 ec 04             	sub    $0x4,%esp
+  802629:	6a 07                	push   $0x7
+  80262b:	68 00 f0 bf ee       	push   $0xeebff000
+  802630:	6a 00                	push   $0x0
+  802632:	e8 1c e6 ff ff       	call   800c53 <sys_page_alloc>
+  802637:	83 c4 10             	add    $0x10,%esp
+  80263a:	85 c0                	test   %eax,%eax
+  80263c:	78 28                	js     802666 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  80263e:	83 ec 08             	sub    $0x8,%esp
+  802641:	68 78 26 80 00       	push   $0x802678
+  802646:	6a 00                	push   $0x0
+  802648:	e8 01 e9 ff ff       	call   800f4e <sys_env_set_pgfault_upcall>
+  80264d:	83 c4 10             	add    $0x10,%esp
+  802650:	85 c0                	test   %eax,%eax
+  802652:	79 c8                	jns    80261c <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  802654:	50                   	push   %eax
+  802655:	68 19 31 80 00       	push   $0x803119
+  80265a:	6a 24                	push   $0x24
+  80265c:	68 0b 31 80 00       	push   $0x80310b
+  802661:	e8 61 ff ff ff       	call   8025c7 <_panic>
+			panic("sys_page_alloc: %e", r);
+  802666:	50                   	push   %eax
+  802667:	68 c6 2e 80 00       	push   $0x802ec6
+  80266c:	6a 21                	push   $0x21
+  80266e:	68 0b 31 80 00       	push   $0x80310b
+  802673:	e8 4f ff ff ff       	call   8025c7 <_panic>
+
+00802678 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802678:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802679:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  80267e:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802680:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802683:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  802686:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  80268a:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  80268d:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  802691:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  802695:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  802697:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802698:	83 c4 04             	add    $0x4,%esp
+	popf
+  80269b:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80269c:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80269d:	c3                   	ret
+
+0080269e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80269e:	55                   	push   %ebp
+  80269f:	89 e5                	mov    %esp,%ebp
+  8026a1:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8026a4:	89 c2                	mov    %eax,%edx
+  8026a6:	c1 ea 16             	shr    $0x16,%edx
+  8026a9:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8026b0:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8026b5:	f6 c1 01             	test   $0x1,%cl
+  8026b8:	74 22                	je     8026dc <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8026ba:	c1 e8 0c             	shr    $0xc,%eax
+  8026bd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8026c4:	a8 01                	test   $0x1,%al
+  8026c6:	74 14                	je     8026dc <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8026c8:	c1 e8 0c             	shr    $0xc,%eax
+  8026cb:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026ce:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8026d5:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8026d9:	0f b7 d2             	movzwl %dx,%edx
+}
+  8026dc:	89 d0                	mov    %edx,%eax
+  8026de:	5d                   	pop    %ebp
+  8026df:	c3                   	ret
+
+008026e0 <__udivmoddi4>:
+  8026e0:	55                   	push   %ebp
+  8026e1:	57                   	push   %edi
+  8026e2:	56                   	push   %esi
+  8026e3:	53                   	push   %ebx
+  8026e4:	83 ec 14             	sub    $0x14,%esp
+  8026e7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8026eb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8026ef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026f3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026f7:	89 f1                	mov    %esi,%ecx
+  8026f9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8026fd:	09 d9                	or     %ebx,%ecx
+  8026ff:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802703:	0f 84 92 00 00 00    	je     80279b <__udivmoddi4+0xbb>
+  802709:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802710:	00 
+  802711:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802716:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80271d:	00 
+  80271e:	89 1c 24             	mov    %ebx,(%esp)
+  802721:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802725:	8d 76 00             	lea    0x0(%esi),%esi
+  802728:	89 e9                	mov    %ebp,%ecx
+  80272a:	89 c3                	mov    %eax,%ebx
+  80272c:	89 d6                	mov    %edx,%esi
+  80272e:	31 ff                	xor    %edi,%edi
+  802730:	d3 ee                	shr    %cl,%esi
+  802732:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802735:	f6 c1 20             	test   $0x20,%cl
+  802738:	0f 45 de             	cmovne %esi,%ebx
+  80273b:	0f 45 f7             	cmovne %edi,%esi
+  80273e:	8b 3c 24             	mov    (%esp),%edi
+  802741:	39 fb                	cmp    %edi,%ebx
+  802743:	89 f7                	mov    %esi,%edi
+  802745:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802749:	8b 1c 24             	mov    (%esp),%ebx
+  80274c:	19 f7                	sbb    %esi,%edi
+  80274e:	72 39                	jb     802789 <__udivmoddi4+0xa9>
+  802750:	89 e9                	mov    %ebp,%ecx
+  802752:	89 f7                	mov    %esi,%edi
+  802754:	89 de                	mov    %ebx,%esi
+  802756:	0f a5 df             	shld   %cl,%ebx,%edi
+  802759:	d3 e6                	shl    %cl,%esi
+  80275b:	31 db                	xor    %ebx,%ebx
+  80275d:	f6 c1 20             	test   $0x20,%cl
+  802760:	0f 45 fe             	cmovne %esi,%edi
+  802763:	0f 45 f3             	cmovne %ebx,%esi
+  802766:	29 f0                	sub    %esi,%eax
+  802768:	be 01 00 00 00       	mov    $0x1,%esi
+  80276d:	19 fa                	sbb    %edi,%edx
+  80276f:	31 ff                	xor    %edi,%edi
+  802771:	31 db                	xor    %ebx,%ebx
+  802773:	0f a5 f7             	shld   %cl,%esi,%edi
+  802776:	d3 e6                	shl    %cl,%esi
+  802778:	f6 c1 20             	test   $0x20,%cl
+  80277b:	0f 45 fe             	cmovne %esi,%edi
+  80277e:	0f 45 f3             	cmovne %ebx,%esi
+  802781:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802785:	09 74 24 08          	or     %esi,0x8(%esp)
+  802789:	83 ed 01             	sub    $0x1,%ebp
+  80278c:	73 9a                	jae    802728 <__udivmoddi4+0x48>
+  80278e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802792:	85 ff                	test   %edi,%edi
+  802794:	74 05                	je     80279b <__udivmoddi4+0xbb>
+  802796:	89 07                	mov    %eax,(%edi)
+  802798:	89 57 04             	mov    %edx,0x4(%edi)
+  80279b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80279f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027a3:	83 c4 14             	add    $0x14,%esp
+  8027a6:	5b                   	pop    %ebx
+  8027a7:	5e                   	pop    %esi
+  8027a8:	5f                   	pop    %edi
+  8027a9:	5d                   	pop    %ebp
+  8027aa:	c3                   	ret
+  8027ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8027af:	90                   	nop
+
+008027b0 <__udivdi3>:
+  8027b0:	55                   	push   %ebp
+  8027b1:	57                   	push   %edi
+  8027b2:	56                   	push   %esi
+  8027b3:	53                   	push   %ebx
+  8027b4:	83 ec 14             	sub    $0x14,%esp
+  8027b7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8027bb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8027bf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027c3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027c7:	89 fb                	mov    %edi,%ebx
+  8027c9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8027cd:	09 f3                	or     %esi,%ebx
+  8027cf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8027d3:	0f 84 85 00 00 00    	je     80285e <__udivdi3+0xae>
+  8027d9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027e0:	00 
+  8027e1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8027e6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027ed:	00 
+  8027ee:	89 34 24             	mov    %esi,(%esp)
+  8027f1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8027f5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027f8:	89 e9                	mov    %ebp,%ecx
+  8027fa:	89 c3                	mov    %eax,%ebx
+  8027fc:	89 d6                	mov    %edx,%esi
+  8027fe:	31 ff                	xor    %edi,%edi
+  802800:	d3 ee                	shr    %cl,%esi
+  802802:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802805:	f6 c1 20             	test   $0x20,%cl
+  802808:	0f 45 de             	cmovne %esi,%ebx
+  80280b:	0f 45 f7             	cmovne %edi,%esi
+  80280e:	8b 3c 24             	mov    (%esp),%edi
+  802811:	39 fb                	cmp    %edi,%ebx
+  802813:	89 f7                	mov    %esi,%edi
+  802815:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802819:	8b 1c 24             	mov    (%esp),%ebx
+  80281c:	19 f7                	sbb    %esi,%edi
+  80281e:	72 39                	jb     802859 <__udivdi3+0xa9>
+  802820:	89 e9                	mov    %ebp,%ecx
+  802822:	89 f7                	mov    %esi,%edi
+  802824:	89 de                	mov    %ebx,%esi
+  802826:	0f a5 df             	shld   %cl,%ebx,%edi
+  802829:	d3 e6                	shl    %cl,%esi
+  80282b:	31 db                	xor    %ebx,%ebx
+  80282d:	f6 c1 20             	test   $0x20,%cl
+  802830:	0f 45 fe             	cmovne %esi,%edi
+  802833:	0f 45 f3             	cmovne %ebx,%esi
+  802836:	29 f0                	sub    %esi,%eax
+  802838:	be 01 00 00 00       	mov    $0x1,%esi
+  80283d:	19 fa                	sbb    %edi,%edx
+  80283f:	31 ff                	xor    %edi,%edi
+  802841:	31 db                	xor    %ebx,%ebx
+  802843:	0f a5 f7             	shld   %cl,%esi,%edi
+  802846:	d3 e6                	shl    %cl,%esi
+  802848:	f6 c1 20             	test   $0x20,%cl
+  80284b:	0f 45 fe             	cmovne %esi,%edi
+  80284e:	0f 45 f3             	cmovne %ebx,%esi
+  802851:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802855:	09 74 24 08          	or     %esi,0x8(%esp)
+  802859:	83 ed 01             	sub    $0x1,%ebp
+  80285c:	73 9a                	jae    8027f8 <__udivdi3+0x48>
+  80285e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802862:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802866:	83 c4 14             	add    $0x14,%esp
+  802869:	5b                   	pop    %ebx
+  80286a:	5e                   	pop    %esi
+  80286b:	5f                   	pop    %edi
+  80286c:	5d                   	pop    %ebp
+  80286d:	c3                   	ret
+  80286e:	66 90                	xchg   %ax,%ax
+
+00802870 <__umoddi3>:
+  802870:	57                   	push   %edi
+  802871:	56                   	push   %esi
+  802872:	53                   	push   %ebx
+  802873:	83 ec 08             	sub    $0x8,%esp
+  802876:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80287a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80287e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802882:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802886:	89 f9                	mov    %edi,%ecx
+  802888:	89 34 24             	mov    %esi,(%esp)
+  80288b:	09 f1                	or     %esi,%ecx
+  80288d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802891:	74 53                	je     8028e6 <__umoddi3+0x76>
+  802893:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80289f:	90                   	nop
+  8028a0:	89 c6                	mov    %eax,%esi
+  8028a2:	89 d7                	mov    %edx,%edi
+  8028a4:	31 db                	xor    %ebx,%ebx
+  8028a6:	d3 ef                	shr    %cl,%edi
+  8028a8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8028ab:	f6 c1 20             	test   $0x20,%cl
+  8028ae:	0f 45 f7             	cmovne %edi,%esi
+  8028b1:	0f 45 fb             	cmovne %ebx,%edi
+  8028b4:	8b 1c 24             	mov    (%esp),%ebx
+  8028b7:	39 de                	cmp    %ebx,%esi
+  8028b9:	89 fb                	mov    %edi,%ebx
+  8028bb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8028bf:	8b 34 24             	mov    (%esp),%esi
+  8028c2:	19 fb                	sbb    %edi,%ebx
+  8028c4:	72 14                	jb     8028da <__umoddi3+0x6a>
+  8028c6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8028c9:	31 db                	xor    %ebx,%ebx
+  8028cb:	d3 e6                	shl    %cl,%esi
+  8028cd:	f6 c1 20             	test   $0x20,%cl
+  8028d0:	0f 45 fe             	cmovne %esi,%edi
+  8028d3:	0f 45 f3             	cmovne %ebx,%esi
+  8028d6:	29 f0                	sub    %esi,%eax
+  8028d8:	19 fa                	sbb    %edi,%edx
+  8028da:	83 e9 01             	sub    $0x1,%ecx
+  8028dd:	73 c1                	jae    8028a0 <__umoddi3+0x30>
+  8028df:	83 c4 08             	add    $0x8,%esp
+  8028e2:	5b                   	pop    %ebx
+  8028e3:	5e                   	pop    %esi
+  8028e4:	5f                   	pop    %edi
+  8028e5:	c3                   	ret
+  8028e6:	83 c4 08             	add    $0x8,%esp
+  8028e9:	31 c0                	xor    %eax,%eax
+  8028eb:	31 d2                	xor    %edx,%edx
+  8028ed:	5b                   	pop    %ebx
+  8028ee:	5e                   	pop    %esi
+  8028ef:	5f                   	pop    %edi
+  8028f0:	c3                   	ret
+  8028f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028ff:	90                   	nop
+
+00802900 <__divdi3>:
+  802900:	55                   	push   %ebp
+  802901:	57                   	push   %edi
+  802902:	56                   	push   %esi
+  802903:	53                   	push   %ebx
+  802904:	83 ec 1c             	sub    $0x1c,%esp
+  802907:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80290b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80290f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802913:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802917:	85 ff                	test   %edi,%edi
+  802919:	0f 88 da 00 00 00    	js     8029f9 <__divdi3+0xf9>
+  80291f:	85 db                	test   %ebx,%ebx
+  802921:	78 16                	js     802939 <__divdi3+0x39>
+  802923:	89 dd                	mov    %ebx,%ebp
+  802925:	89 c8                	mov    %ecx,%eax
+  802927:	89 da                	mov    %ebx,%edx
+  802929:	09 cd                	or     %ecx,%ebp
+  80292b:	0f 85 fd 00 00 00    	jne    802a2e <__divdi3+0x12e>
+  802931:	83 c4 1c             	add    $0x1c,%esp
+  802934:	5b                   	pop    %ebx
+  802935:	5e                   	pop    %esi
+  802936:	5f                   	pop    %edi
+  802937:	5d                   	pop    %ebp
+  802938:	c3                   	ret
+  802939:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80293e:	f7 d9                	neg    %ecx
+  802940:	89 f0                	mov    %esi,%eax
+  802942:	89 fa                	mov    %edi,%edx
+  802944:	83 d3 00             	adc    $0x0,%ebx
+  802947:	89 0c 24             	mov    %ecx,(%esp)
+  80294a:	f7 db                	neg    %ebx
+  80294c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802950:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802957:	00 
+  802958:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80295d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802964:	00 
+  802965:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802969:	89 cd                	mov    %ecx,%ebp
+  80296b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80296f:	90                   	nop
+  802970:	89 e9                	mov    %ebp,%ecx
+  802972:	89 c3                	mov    %eax,%ebx
+  802974:	89 d6                	mov    %edx,%esi
+  802976:	31 ff                	xor    %edi,%edi
+  802978:	d3 ee                	shr    %cl,%esi
+  80297a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80297d:	f6 c1 20             	test   $0x20,%cl
+  802980:	0f 45 de             	cmovne %esi,%ebx
+  802983:	0f 45 f7             	cmovne %edi,%esi
+  802986:	8b 3c 24             	mov    (%esp),%edi
+  802989:	39 fb                	cmp    %edi,%ebx
+  80298b:	89 f7                	mov    %esi,%edi
+  80298d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802991:	8b 1c 24             	mov    (%esp),%ebx
+  802994:	19 f7                	sbb    %esi,%edi
+  802996:	72 39                	jb     8029d1 <__divdi3+0xd1>
+  802998:	89 e9                	mov    %ebp,%ecx
+  80299a:	89 f7                	mov    %esi,%edi
+  80299c:	89 de                	mov    %ebx,%esi
+  80299e:	0f a5 df             	shld   %cl,%ebx,%edi
+  8029a1:	d3 e6                	shl    %cl,%esi
+  8029a3:	31 db                	xor    %ebx,%ebx
+  8029a5:	f6 c1 20             	test   $0x20,%cl
+  8029a8:	0f 45 fe             	cmovne %esi,%edi
+  8029ab:	0f 45 f3             	cmovne %ebx,%esi
+  8029ae:	29 f0                	sub    %esi,%eax
+  8029b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8029b5:	19 fa                	sbb    %edi,%edx
+  8029b7:	31 ff                	xor    %edi,%edi
+  8029b9:	31 db                	xor    %ebx,%ebx
+  8029bb:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029be:	d3 e6                	shl    %cl,%esi
+  8029c0:	f6 c1 20             	test   $0x20,%cl
+  8029c3:	0f 45 fe             	cmovne %esi,%edi
+  8029c6:	0f 45 f3             	cmovne %ebx,%esi
+  8029c9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8029cd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8029d1:	83 ed 01             	sub    $0x1,%ebp
+  8029d4:	73 9a                	jae    802970 <__divdi3+0x70>
+  8029d6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8029da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029e2:	85 ed                	test   %ebp,%ebp
+  8029e4:	0f 84 47 ff ff ff    	je     802931 <__divdi3+0x31>
+  8029ea:	f7 d8                	neg    %eax
+  8029ec:	83 d2 00             	adc    $0x0,%edx
+  8029ef:	83 c4 1c             	add    $0x1c,%esp
+  8029f2:	5b                   	pop    %ebx
+  8029f3:	f7 da                	neg    %edx
+  8029f5:	5e                   	pop    %esi
+  8029f6:	5f                   	pop    %edi
+  8029f7:	5d                   	pop    %ebp
+  8029f8:	c3                   	ret
+  8029f9:	f7 de                	neg    %esi
+  8029fb:	83 d7 00             	adc    $0x0,%edi
+  8029fe:	f7 df                	neg    %edi
+  802a00:	85 db                	test   %ebx,%ebx
+  802a02:	78 23                	js     802a27 <__divdi3+0x127>
+  802a04:	89 dd                	mov    %ebx,%ebp
+  802a06:	89 c8                	mov    %ecx,%eax
+  802a08:	89 da                	mov    %ebx,%edx
+  802a0a:	09 cd                	or     %ecx,%ebp
+  802a0c:	0f 84 1f ff ff ff    	je     802931 <__divdi3+0x31>
+  802a12:	89 0c 24             	mov    %ecx,(%esp)
+  802a15:	89 f0                	mov    %esi,%eax
+  802a17:	89 fa                	mov    %edi,%edx
+  802a19:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802a1e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a22:	e9 29 ff ff ff       	jmp    802950 <__divdi3+0x50>
+  802a27:	31 ed                	xor    %ebp,%ebp
+  802a29:	e9 10 ff ff ff       	jmp    80293e <__divdi3+0x3e>
+  802a2e:	89 0c 24             	mov    %ecx,(%esp)
+  802a31:	89 f0                	mov    %esi,%eax
+  802a33:	89 fa                	mov    %edi,%edx
+  802a35:	31 ed                	xor    %ebp,%ebp
+  802a37:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a3b:	e9 10 ff ff ff       	jmp    802950 <__divdi3+0x50>
+
+00802a40 <__moddi3>:
+  802a40:	55                   	push   %ebp
+  802a41:	57                   	push   %edi
+  802a42:	56                   	push   %esi
+  802a43:	53                   	push   %ebx
+  802a44:	83 ec 14             	sub    $0x14,%esp
+  802a47:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a4b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a4f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802a53:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802a57:	85 d2                	test   %edx,%edx
+  802a59:	0f 88 9b 00 00 00    	js     802afa <__moddi3+0xba>
+  802a5f:	89 f7                	mov    %esi,%edi
+  802a61:	31 ed                	xor    %ebp,%ebp
+  802a63:	09 cf                	or     %ecx,%edi
+  802a65:	0f 84 83 00 00 00    	je     802aee <__moddi3+0xae>
+  802a6b:	89 cb                	mov    %ecx,%ebx
+  802a6d:	89 f7                	mov    %esi,%edi
+  802a6f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802a73:	f7 db                	neg    %ebx
+  802a75:	83 d7 00             	adc    $0x0,%edi
+  802a78:	f7 df                	neg    %edi
+  802a7a:	0f 49 f7             	cmovns %edi,%esi
+  802a7d:	0f 49 cb             	cmovns %ebx,%ecx
+  802a80:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802a84:	89 0c 24             	mov    %ecx,(%esp)
+  802a87:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a8c:	89 cd                	mov    %ecx,%ebp
+  802a8e:	66 90                	xchg   %ax,%ax
+  802a90:	89 e9                	mov    %ebp,%ecx
+  802a92:	89 c3                	mov    %eax,%ebx
+  802a94:	89 d6                	mov    %edx,%esi
+  802a96:	31 ff                	xor    %edi,%edi
+  802a98:	d3 ee                	shr    %cl,%esi
+  802a9a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a9d:	f6 c1 20             	test   $0x20,%cl
+  802aa0:	0f 45 de             	cmovne %esi,%ebx
+  802aa3:	0f 45 f7             	cmovne %edi,%esi
+  802aa6:	8b 3c 24             	mov    (%esp),%edi
+  802aa9:	39 fb                	cmp    %edi,%ebx
+  802aab:	89 f7                	mov    %esi,%edi
+  802aad:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ab1:	8b 1c 24             	mov    (%esp),%ebx
+  802ab4:	19 f7                	sbb    %esi,%edi
+  802ab6:	72 1a                	jb     802ad2 <__moddi3+0x92>
+  802ab8:	89 e9                	mov    %ebp,%ecx
+  802aba:	89 f7                	mov    %esi,%edi
+  802abc:	89 de                	mov    %ebx,%esi
+  802abe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ac1:	d3 e6                	shl    %cl,%esi
+  802ac3:	31 db                	xor    %ebx,%ebx
+  802ac5:	f6 c1 20             	test   $0x20,%cl
+  802ac8:	0f 45 fe             	cmovne %esi,%edi
+  802acb:	0f 45 f3             	cmovne %ebx,%esi
+  802ace:	29 f0                	sub    %esi,%eax
+  802ad0:	19 fa                	sbb    %edi,%edx
+  802ad2:	83 ed 01             	sub    $0x1,%ebp
+  802ad5:	73 b9                	jae    802a90 <__moddi3+0x50>
+  802ad7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802adb:	85 ed                	test   %ebp,%ebp
+  802add:	74 07                	je     802ae6 <__moddi3+0xa6>
+  802adf:	f7 d8                	neg    %eax
+  802ae1:	83 d2 00             	adc    $0x0,%edx
+  802ae4:	f7 da                	neg    %edx
+  802ae6:	83 c4 14             	add    $0x14,%esp
+  802ae9:	5b                   	pop    %ebx
+  802aea:	5e                   	pop    %esi
+  802aeb:	5f                   	pop    %edi
+  802aec:	5d                   	pop    %ebp
+  802aed:	c3                   	ret
+  802aee:	83 c4 14             	add    $0x14,%esp
+  802af1:	31 c0                	xor    %eax,%eax
+  802af3:	31 d2                	xor    %edx,%edx
+  802af5:	5b                   	pop    %ebx
+  802af6:	5e                   	pop    %esi
+  802af7:	5f                   	pop    %edi
+  802af8:	5d                   	pop    %ebp
+  802af9:	c3                   	ret
+  802afa:	89 f7                	mov    %esi,%edi
+  802afc:	09 cf                	or     %ecx,%edi
+  802afe:	74 11                	je     802b11 <__moddi3+0xd1>
+  802b00:	f7 d8                	neg    %eax
+  802b02:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802b07:	83 d2 00             	adc    $0x0,%edx
+  802b0a:	f7 da                	neg    %edx
+  802b0c:	e9 5a ff ff ff       	jmp    802a6b <__moddi3+0x2b>
+  802b11:	31 c0                	xor    %eax,%eax
+  802b13:	31 d2                	xor    %edx,%edx
+  802b15:	eb c8                	jmp    802adf <__moddi3+0x9f>
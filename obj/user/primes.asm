@@ -0,0 +1,6176 @@
+
+obj/user/primes.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c3 00 00 00       	call   8000f4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	int i, id, p;
+	envid_t envid;
+
+	// fetch a prime from our left neighbor
+top:
+	p = ipc_recv(&envid, 0, 0);
+  80003c:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80003f:	83 ec 04             	sub    $0x4,%esp
+  800042:	6a 00                	push   $0x0
+  800044:	6a 00                	push   $0x0
+  800046:	56                   	push   %esi
+  800047:	e8 c5 13 00 00       	call   801411 <ipc_recv>
+  80004c:	89 c3                	mov    %eax,%ebx
+	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  80004e:	a1 08 50 80 00       	mov    0x805008,%eax
+  800053:	8b 40 60             	mov    0x60(%eax),%eax
+  800056:	83 c4 0c             	add    $0xc,%esp
+  800059:	53                   	push   %ebx
+  80005a:	50                   	push   %eax
+  80005b:	68 20 2b 80 00       	push   $0x802b20
+  800060:	e8 ca 01 00 00       	call   80022f <cprintf>
+
+	// fork a right neighbor to continue the chain
+	if ((id = fork()) < 0)
+  800065:	e8 20 11 00 00       	call   80118a <fork>
+  80006a:	89 c7                	mov    %eax,%edi
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	78 2e                	js     8000a1 <primeproc+0x6e>
+		panic("fork: %e", id);
+	if (id == 0)
+  800073:	74 ca                	je     80003f <primeproc+0xc>
+		goto top;
+
+	// filter out multiples of our prime
+	while (1) {
+		i = ipc_recv(&envid, 0, 0);
+  800075:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	6a 00                	push   $0x0
+  80007d:	6a 00                	push   $0x0
+  80007f:	56                   	push   %esi
+  800080:	e8 8c 13 00 00       	call   801411 <ipc_recv>
+  800085:	89 c1                	mov    %eax,%ecx
+		if (i % p)
+  800087:	99                   	cltd
+  800088:	f7 fb                	idiv   %ebx
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 d2                	test   %edx,%edx
+  80008f:	74 e7                	je     800078 <primeproc+0x45>
+			ipc_send(id, i, 0, 0);
+  800091:	6a 00                	push   $0x0
+  800093:	6a 00                	push   $0x0
+  800095:	51                   	push   %ecx
+  800096:	57                   	push   %edi
+  800097:	e8 ed 13 00 00       	call   801489 <ipc_send>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb d7                	jmp    800078 <primeproc+0x45>
+		panic("fork: %e", id);
+  8000a1:	50                   	push   %eax
+  8000a2:	68 e4 2e 80 00       	push   $0x802ee4
+  8000a7:	6a 1a                	push   $0x1a
+  8000a9:	68 2c 2b 80 00       	push   $0x802b2c
+  8000ae:	e8 a1 00 00 00       	call   800154 <_panic>
+
+008000b3 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8000b3:	55                   	push   %ebp
+  8000b4:	89 e5                	mov    %esp,%ebp
+  8000b6:	56                   	push   %esi
+  8000b7:	53                   	push   %ebx
+	int i, id;
+
+	// fork the first prime process in the chain
+	if ((id = fork()) < 0)
+  8000b8:	e8 cd 10 00 00       	call   80118a <fork>
+  8000bd:	89 c6                	mov    %eax,%esi
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	78 1a                	js     8000dd <umain+0x2a>
+		panic("fork: %e", id);
+	if (id == 0)
+		primeproc();
+
+	// feed all the integers through
+	for (i = 2; ; i++)
+  8000c3:	bb 02 00 00 00       	mov    $0x2,%ebx
+	if (id == 0)
+  8000c8:	74 25                	je     8000ef <umain+0x3c>
+		ipc_send(id, i, 0, 0);
+  8000ca:	6a 00                	push   $0x0
+  8000cc:	6a 00                	push   $0x0
+  8000ce:	53                   	push   %ebx
+  8000cf:	56                   	push   %esi
+  8000d0:	e8 b4 13 00 00       	call   801489 <ipc_send>
+	for (i = 2; ; i++)
+  8000d5:	83 c3 01             	add    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	eb ed                	jmp    8000ca <umain+0x17>
+		panic("fork: %e", id);
+  8000dd:	50                   	push   %eax
+  8000de:	68 e4 2e 80 00       	push   $0x802ee4
+  8000e3:	6a 2d                	push   $0x2d
+  8000e5:	68 2c 2b 80 00       	push   $0x802b2c
+  8000ea:	e8 65 00 00 00       	call   800154 <_panic>
+		primeproc();
+  8000ef:	e8 3f ff ff ff       	call   800033 <primeproc>
+
+008000f4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	56                   	push   %esi
+  8000f8:	53                   	push   %ebx
+  8000f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000ff:	e8 e7 0a 00 00       	call   800beb <sys_getenvid>
+  800104:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800109:	c1 e0 09             	shl    $0x9,%eax
+  80010c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800111:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800116:	85 db                	test   %ebx,%ebx
+  800118:	7e 07                	jle    800121 <libmain+0x2d>
+		binaryname = argv[0];
+  80011a:	8b 06                	mov    (%esi),%eax
+  80011c:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800121:	83 ec 08             	sub    $0x8,%esp
+  800124:	56                   	push   %esi
+  800125:	53                   	push   %ebx
+  800126:	e8 88 ff ff ff       	call   8000b3 <umain>
+
+	// exit gracefully
+	exit();
+  80012b:	e8 0a 00 00 00       	call   80013a <exit>
+}
+  800130:	83 c4 10             	add    $0x10,%esp
+  800133:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800136:	5b                   	pop    %ebx
+  800137:	5e                   	pop    %esi
+  800138:	5d                   	pop    %ebp
+  800139:	c3                   	ret
+
+0080013a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80013a:	55                   	push   %ebp
+  80013b:	89 e5                	mov    %esp,%ebp
+  80013d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800140:	e8 7c 15 00 00       	call   8016c1 <close_all>
+	sys_env_destroy(0);
+  800145:	83 ec 0c             	sub    $0xc,%esp
+  800148:	6a 00                	push   $0x0
+  80014a:	e8 5b 0a 00 00       	call   800baa <sys_env_destroy>
+}
+  80014f:	83 c4 10             	add    $0x10,%esp
+  800152:	c9                   	leave
+  800153:	c3                   	ret
+
+00800154 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800154:	55                   	push   %ebp
+  800155:	89 e5                	mov    %esp,%ebp
+  800157:	56                   	push   %esi
+  800158:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800159:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80015c:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800162:	e8 84 0a 00 00       	call   800beb <sys_getenvid>
+  800167:	83 ec 0c             	sub    $0xc,%esp
+  80016a:	ff 75 0c             	push   0xc(%ebp)
+  80016d:	ff 75 08             	push   0x8(%ebp)
+  800170:	56                   	push   %esi
+  800171:	50                   	push   %eax
+  800172:	68 44 2b 80 00       	push   $0x802b44
+  800177:	e8 b3 00 00 00       	call   80022f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80017c:	83 c4 18             	add    $0x18,%esp
+  80017f:	53                   	push   %ebx
+  800180:	ff 75 10             	push   0x10(%ebp)
+  800183:	e8 56 00 00 00       	call   8001de <vcprintf>
+	cprintf("\n");
+  800188:	c7 04 24 b4 30 80 00 	movl   $0x8030b4,(%esp)
+  80018f:	e8 9b 00 00 00       	call   80022f <cprintf>
+  800194:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800197:	cc                   	int3
+	while (1)
+  800198:	eb fd                	jmp    800197 <_panic+0x43>
+
+0080019a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80019a:	55                   	push   %ebp
+  80019b:	89 e5                	mov    %esp,%ebp
+  80019d:	53                   	push   %ebx
+  80019e:	83 ec 04             	sub    $0x4,%esp
+  8001a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001a4:	8b 13                	mov    (%ebx),%edx
+  8001a6:	8d 42 01             	lea    0x1(%edx),%eax
+  8001a9:	89 03                	mov    %eax,(%ebx)
+  8001ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001ae:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001b2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001b7:	74 09                	je     8001c2 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001b9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c0:	c9                   	leave
+  8001c1:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001c2:	83 ec 08             	sub    $0x8,%esp
+  8001c5:	68 ff 00 00 00       	push   $0xff
+  8001ca:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001cd:	50                   	push   %eax
+  8001ce:	e8 7a 09 00 00       	call   800b4d <sys_cputs>
+		b->idx = 0;
+  8001d3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001d9:	83 c4 10             	add    $0x10,%esp
+  8001dc:	eb db                	jmp    8001b9 <putch+0x1f>
+
+008001de <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001de:	55                   	push   %ebp
+  8001df:	89 e5                	mov    %esp,%ebp
+  8001e1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001e7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001ee:	00 00 00 
+	b.cnt = 0;
+  8001f1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001f8:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001fb:	ff 75 0c             	push   0xc(%ebp)
+  8001fe:	ff 75 08             	push   0x8(%ebp)
+  800201:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800207:	50                   	push   %eax
+  800208:	68 9a 01 80 00       	push   $0x80019a
+  80020d:	e8 14 01 00 00       	call   800326 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800212:	83 c4 08             	add    $0x8,%esp
+  800215:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80021b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800221:	50                   	push   %eax
+  800222:	e8 26 09 00 00       	call   800b4d <sys_cputs>
+
+	return b.cnt;
+}
+  800227:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80022d:	c9                   	leave
+  80022e:	c3                   	ret
+
+0080022f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80022f:	55                   	push   %ebp
+  800230:	89 e5                	mov    %esp,%ebp
+  800232:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800235:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800238:	50                   	push   %eax
+  800239:	ff 75 08             	push   0x8(%ebp)
+  80023c:	e8 9d ff ff ff       	call   8001de <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800241:	c9                   	leave
+  800242:	c3                   	ret
+
+00800243 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800243:	55                   	push   %ebp
+  800244:	89 e5                	mov    %esp,%ebp
+  800246:	57                   	push   %edi
+  800247:	56                   	push   %esi
+  800248:	53                   	push   %ebx
+  800249:	83 ec 1c             	sub    $0x1c,%esp
+  80024c:	89 c7                	mov    %eax,%edi
+  80024e:	89 d6                	mov    %edx,%esi
+  800250:	8b 45 08             	mov    0x8(%ebp),%eax
+  800253:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800256:	89 d1                	mov    %edx,%ecx
+  800258:	89 c2                	mov    %eax,%edx
+  80025a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80025d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800260:	8b 45 10             	mov    0x10(%ebp),%eax
+  800263:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800266:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800269:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800270:	39 c2                	cmp    %eax,%edx
+  800272:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800275:	72 3e                	jb     8002b5 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800277:	83 ec 0c             	sub    $0xc,%esp
+  80027a:	ff 75 18             	push   0x18(%ebp)
+  80027d:	83 eb 01             	sub    $0x1,%ebx
+  800280:	53                   	push   %ebx
+  800281:	50                   	push   %eax
+  800282:	83 ec 08             	sub    $0x8,%esp
+  800285:	ff 75 e4             	push   -0x1c(%ebp)
+  800288:	ff 75 e0             	push   -0x20(%ebp)
+  80028b:	ff 75 dc             	push   -0x24(%ebp)
+  80028e:	ff 75 d8             	push   -0x28(%ebp)
+  800291:	e8 1a 25 00 00       	call   8027b0 <__udivdi3>
+  800296:	83 c4 18             	add    $0x18,%esp
+  800299:	52                   	push   %edx
+  80029a:	50                   	push   %eax
+  80029b:	89 f2                	mov    %esi,%edx
+  80029d:	89 f8                	mov    %edi,%eax
+  80029f:	e8 9f ff ff ff       	call   800243 <printnum>
+  8002a4:	83 c4 20             	add    $0x20,%esp
+  8002a7:	eb 13                	jmp    8002bc <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002a9:	83 ec 08             	sub    $0x8,%esp
+  8002ac:	56                   	push   %esi
+  8002ad:	ff 75 18             	push   0x18(%ebp)
+  8002b0:	ff d7                	call   *%edi
+  8002b2:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002b5:	83 eb 01             	sub    $0x1,%ebx
+  8002b8:	85 db                	test   %ebx,%ebx
+  8002ba:	7f ed                	jg     8002a9 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002bc:	83 ec 08             	sub    $0x8,%esp
+  8002bf:	56                   	push   %esi
+  8002c0:	83 ec 04             	sub    $0x4,%esp
+  8002c3:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c6:	ff 75 e0             	push   -0x20(%ebp)
+  8002c9:	ff 75 dc             	push   -0x24(%ebp)
+  8002cc:	ff 75 d8             	push   -0x28(%ebp)
+  8002cf:	e8 9c 25 00 00       	call   802870 <__umoddi3>
+  8002d4:	83 c4 14             	add    $0x14,%esp
+  8002d7:	0f be 80 67 2b 80 00 	movsbl 0x802b67(%eax),%eax
+  8002de:	50                   	push   %eax
+  8002df:	ff d7                	call   *%edi
+}
+  8002e1:	83 c4 10             	add    $0x10,%esp
+  8002e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e7:	5b                   	pop    %ebx
+  8002e8:	5e                   	pop    %esi
+  8002e9:	5f                   	pop    %edi
+  8002ea:	5d                   	pop    %ebp
+  8002eb:	c3                   	ret
+
+008002ec <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002ec:	55                   	push   %ebp
+  8002ed:	89 e5                	mov    %esp,%ebp
+  8002ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002f2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002f6:	8b 10                	mov    (%eax),%edx
+  8002f8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002fb:	73 0a                	jae    800307 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002fd:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800300:	89 08                	mov    %ecx,(%eax)
+  800302:	8b 45 08             	mov    0x8(%ebp),%eax
+  800305:	88 02                	mov    %al,(%edx)
+}
+  800307:	5d                   	pop    %ebp
+  800308:	c3                   	ret
+
+00800309 <printfmt>:
+{
+  800309:	55                   	push   %ebp
+  80030a:	89 e5                	mov    %esp,%ebp
+  80030c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80030f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800312:	50                   	push   %eax
+  800313:	ff 75 10             	push   0x10(%ebp)
+  800316:	ff 75 0c             	push   0xc(%ebp)
+  800319:	ff 75 08             	push   0x8(%ebp)
+  80031c:	e8 05 00 00 00       	call   800326 <vprintfmt>
+}
+  800321:	83 c4 10             	add    $0x10,%esp
+  800324:	c9                   	leave
+  800325:	c3                   	ret
+
+00800326 <vprintfmt>:
+{
+  800326:	55                   	push   %ebp
+  800327:	89 e5                	mov    %esp,%ebp
+  800329:	57                   	push   %edi
+  80032a:	56                   	push   %esi
+  80032b:	53                   	push   %ebx
+  80032c:	83 ec 2c             	sub    $0x2c,%esp
+  80032f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800332:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800335:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800338:	eb 0a                	jmp    800344 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80033a:	83 ec 08             	sub    $0x8,%esp
+  80033d:	53                   	push   %ebx
+  80033e:	50                   	push   %eax
+  80033f:	ff d6                	call   *%esi
+  800341:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800344:	83 c7 01             	add    $0x1,%edi
+  800347:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80034b:	83 f8 25             	cmp    $0x25,%eax
+  80034e:	74 0c                	je     80035c <vprintfmt+0x36>
+			if (ch == '\0')
+  800350:	85 c0                	test   %eax,%eax
+  800352:	75 e6                	jne    80033a <vprintfmt+0x14>
+}
+  800354:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800357:	5b                   	pop    %ebx
+  800358:	5e                   	pop    %esi
+  800359:	5f                   	pop    %edi
+  80035a:	5d                   	pop    %ebp
+  80035b:	c3                   	ret
+		padc = ' ';
+  80035c:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800360:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800367:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80036e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800375:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80037a:	8d 47 01             	lea    0x1(%edi),%eax
+  80037d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800380:	0f b6 17             	movzbl (%edi),%edx
+  800383:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800386:	3c 55                	cmp    $0x55,%al
+  800388:	0f 87 cf 03 00 00    	ja     80075d <vprintfmt+0x437>
+  80038e:	0f b6 c0             	movzbl %al,%eax
+  800391:	ff 24 85 a0 2c 80 00 	jmp    *0x802ca0(,%eax,4)
+  800398:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80039b:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80039f:	eb d9                	jmp    80037a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003a4:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003a8:	eb d0                	jmp    80037a <vprintfmt+0x54>
+  8003aa:	0f b6 d2             	movzbl %dl,%edx
+  8003ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003b8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003bb:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003bf:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003c2:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003c5:	83 f9 09             	cmp    $0x9,%ecx
+  8003c8:	77 55                	ja     80041f <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003ca:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003cd:	eb e9                	jmp    8003b8 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d2:	8b 00                	mov    (%eax),%eax
+  8003d4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003da:	8d 40 04             	lea    0x4(%eax),%eax
+  8003dd:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003e3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e7:	79 91                	jns    80037a <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003e9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ef:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003f6:	eb 82                	jmp    80037a <vprintfmt+0x54>
+			if (width < 0)
+  8003f8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003fb:	85 d2                	test   %edx,%edx
+  8003fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800402:	0f 49 c2             	cmovns %edx,%eax
+  800405:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800408:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80040b:	e9 6a ff ff ff       	jmp    80037a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800410:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800413:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80041a:	e9 5b ff ff ff       	jmp    80037a <vprintfmt+0x54>
+  80041f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800422:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800425:	eb bc                	jmp    8003e3 <vprintfmt+0xbd>
+			lflag++;
+  800427:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80042a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80042d:	e9 48 ff ff ff       	jmp    80037a <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800432:	8b 45 14             	mov    0x14(%ebp),%eax
+  800435:	8d 78 04             	lea    0x4(%eax),%edi
+  800438:	83 ec 08             	sub    $0x8,%esp
+  80043b:	53                   	push   %ebx
+  80043c:	ff 30                	push   (%eax)
+  80043e:	ff d6                	call   *%esi
+			break;
+  800440:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800443:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800446:	e9 b1 02 00 00       	jmp    8006fc <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80044b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044e:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800451:	8b 10                	mov    (%eax),%edx
+  800453:	89 d0                	mov    %edx,%eax
+  800455:	f7 d8                	neg    %eax
+  800457:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80045a:	83 f8 0f             	cmp    $0xf,%eax
+  80045d:	7f 23                	jg     800482 <vprintfmt+0x15c>
+  80045f:	8b 14 85 00 2e 80 00 	mov    0x802e00(,%eax,4),%edx
+  800466:	85 d2                	test   %edx,%edx
+  800468:	74 18                	je     800482 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80046a:	52                   	push   %edx
+  80046b:	68 49 30 80 00       	push   $0x803049
+  800470:	53                   	push   %ebx
+  800471:	56                   	push   %esi
+  800472:	e8 92 fe ff ff       	call   800309 <printfmt>
+  800477:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80047d:	e9 7a 02 00 00       	jmp    8006fc <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800482:	50                   	push   %eax
+  800483:	68 7f 2b 80 00       	push   $0x802b7f
+  800488:	53                   	push   %ebx
+  800489:	56                   	push   %esi
+  80048a:	e8 7a fe ff ff       	call   800309 <printfmt>
+  80048f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800492:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800495:	e9 62 02 00 00       	jmp    8006fc <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049d:	83 c0 04             	add    $0x4,%eax
+  8004a0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a6:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004a8:	85 c9                	test   %ecx,%ecx
+  8004aa:	b8 78 2b 80 00       	mov    $0x802b78,%eax
+  8004af:	0f 45 c1             	cmovne %ecx,%eax
+  8004b2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004b5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004b9:	7e 06                	jle    8004c1 <vprintfmt+0x19b>
+  8004bb:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004bf:	75 0b                	jne    8004cc <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c1:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004c4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004c7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ca:	eb 5c                	jmp    800528 <vprintfmt+0x202>
+  8004cc:	83 ec 08             	sub    $0x8,%esp
+  8004cf:	ff 75 d0             	push   -0x30(%ebp)
+  8004d2:	ff 75 cc             	push   -0x34(%ebp)
+  8004d5:	e8 20 03 00 00       	call   8007fa <strnlen>
+  8004da:	89 c2                	mov    %eax,%edx
+  8004dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004df:	29 d0                	sub    %edx,%eax
+  8004e1:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004e4:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004e8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004eb:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ee:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f0:	eb 0e                	jmp    800500 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004f2:	83 ec 08             	sub    $0x8,%esp
+  8004f5:	53                   	push   %ebx
+  8004f6:	57                   	push   %edi
+  8004f7:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fa:	83 ee 01             	sub    $0x1,%esi
+  8004fd:	83 c4 10             	add    $0x10,%esp
+  800500:	85 f6                	test   %esi,%esi
+  800502:	7f ee                	jg     8004f2 <vprintfmt+0x1cc>
+  800504:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800507:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050a:	85 c0                	test   %eax,%eax
+  80050c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800511:	0f 49 d0             	cmovns %eax,%edx
+  800514:	29 d0                	sub    %edx,%eax
+  800516:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800519:	eb a6                	jmp    8004c1 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80051b:	83 ec 08             	sub    $0x8,%esp
+  80051e:	53                   	push   %ebx
+  80051f:	52                   	push   %edx
+  800520:	ff 55 08             	call   *0x8(%ebp)
+  800523:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800526:	89 f1                	mov    %esi,%ecx
+  800528:	8d 71 01             	lea    0x1(%ecx),%esi
+  80052b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80052f:	0f be d0             	movsbl %al,%edx
+  800532:	85 d2                	test   %edx,%edx
+  800534:	74 28                	je     80055e <vprintfmt+0x238>
+  800536:	85 ff                	test   %edi,%edi
+  800538:	78 05                	js     80053f <vprintfmt+0x219>
+  80053a:	83 ef 01             	sub    $0x1,%edi
+  80053d:	78 30                	js     80056f <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80053f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800543:	74 d6                	je     80051b <vprintfmt+0x1f5>
+  800545:	0f be c0             	movsbl %al,%eax
+  800548:	83 e8 20             	sub    $0x20,%eax
+  80054b:	83 f8 5e             	cmp    $0x5e,%eax
+  80054e:	76 cb                	jbe    80051b <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800550:	83 ec 08             	sub    $0x8,%esp
+  800553:	53                   	push   %ebx
+  800554:	6a 3f                	push   $0x3f
+  800556:	ff 55 08             	call   *0x8(%ebp)
+  800559:	83 c4 10             	add    $0x10,%esp
+  80055c:	eb c8                	jmp    800526 <vprintfmt+0x200>
+  80055e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800561:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800564:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800567:	01 d0                	add    %edx,%eax
+  800569:	29 c8                	sub    %ecx,%eax
+  80056b:	89 c7                	mov    %eax,%edi
+  80056d:	eb 13                	jmp    800582 <vprintfmt+0x25c>
+  80056f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800572:	eb ed                	jmp    800561 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800574:	83 ec 08             	sub    $0x8,%esp
+  800577:	53                   	push   %ebx
+  800578:	6a 20                	push   $0x20
+  80057a:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80057c:	83 ef 01             	sub    $0x1,%edi
+  80057f:	83 c4 10             	add    $0x10,%esp
+  800582:	85 ff                	test   %edi,%edi
+  800584:	7f ee                	jg     800574 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800586:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800589:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058c:	e9 6b 01 00 00       	jmp    8006fc <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800591:	83 f9 01             	cmp    $0x1,%ecx
+  800594:	7f 1f                	jg     8005b5 <vprintfmt+0x28f>
+	else if (lflag)
+  800596:	85 c9                	test   %ecx,%ecx
+  800598:	74 67                	je     800601 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80059a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059d:	8b 00                	mov    (%eax),%eax
+  80059f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a2:	89 c1                	mov    %eax,%ecx
+  8005a4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005a7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b3:	eb 17                	jmp    8005cc <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8b 50 04             	mov    0x4(%eax),%edx
+  8005bb:	8b 00                	mov    (%eax),%eax
+  8005bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c6:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005cc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005cf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005d2:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005d7:	85 c9                	test   %ecx,%ecx
+  8005d9:	0f 89 03 01 00 00    	jns    8006e2 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005df:	83 ec 08             	sub    $0x8,%esp
+  8005e2:	53                   	push   %ebx
+  8005e3:	6a 2d                	push   $0x2d
+  8005e5:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005e7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ea:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005ed:	f7 da                	neg    %edx
+  8005ef:	83 d1 00             	adc    $0x0,%ecx
+  8005f2:	f7 d9                	neg    %ecx
+  8005f4:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005f7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005fc:	e9 e1 00 00 00       	jmp    8006e2 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800601:	8b 45 14             	mov    0x14(%ebp),%eax
+  800604:	8b 00                	mov    (%eax),%eax
+  800606:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800609:	89 c1                	mov    %eax,%ecx
+  80060b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80060e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800611:	8b 45 14             	mov    0x14(%ebp),%eax
+  800614:	8d 40 04             	lea    0x4(%eax),%eax
+  800617:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061a:	eb b0                	jmp    8005cc <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80061c:	83 f9 01             	cmp    $0x1,%ecx
+  80061f:	7f 1e                	jg     80063f <vprintfmt+0x319>
+	else if (lflag)
+  800621:	85 c9                	test   %ecx,%ecx
+  800623:	74 32                	je     800657 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800625:	8b 45 14             	mov    0x14(%ebp),%eax
+  800628:	8b 10                	mov    (%eax),%edx
+  80062a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062f:	8d 40 04             	lea    0x4(%eax),%eax
+  800632:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800635:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80063a:	e9 a3 00 00 00       	jmp    8006e2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8b 10                	mov    (%eax),%edx
+  800644:	8b 48 04             	mov    0x4(%eax),%ecx
+  800647:	8d 40 08             	lea    0x8(%eax),%eax
+  80064a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800652:	e9 8b 00 00 00       	jmp    8006e2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8b 10                	mov    (%eax),%edx
+  80065c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800661:	8d 40 04             	lea    0x4(%eax),%eax
+  800664:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800667:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80066c:	eb 74                	jmp    8006e2 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80066e:	83 f9 01             	cmp    $0x1,%ecx
+  800671:	7f 1b                	jg     80068e <vprintfmt+0x368>
+	else if (lflag)
+  800673:	85 c9                	test   %ecx,%ecx
+  800675:	74 2c                	je     8006a3 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8b 10                	mov    (%eax),%edx
+  80067c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800681:	8d 40 04             	lea    0x4(%eax),%eax
+  800684:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800687:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80068c:	eb 54                	jmp    8006e2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 10                	mov    (%eax),%edx
+  800693:	8b 48 04             	mov    0x4(%eax),%ecx
+  800696:	8d 40 08             	lea    0x8(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80069c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006a1:	eb 3f                	jmp    8006e2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 10                	mov    (%eax),%edx
+  8006a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006b3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006b8:	eb 28                	jmp    8006e2 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006ba:	83 ec 08             	sub    $0x8,%esp
+  8006bd:	53                   	push   %ebx
+  8006be:	6a 30                	push   $0x30
+  8006c0:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006c2:	83 c4 08             	add    $0x8,%esp
+  8006c5:	53                   	push   %ebx
+  8006c6:	6a 78                	push   $0x78
+  8006c8:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cd:	8b 10                	mov    (%eax),%edx
+  8006cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006d4:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006da:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006dd:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006e2:	83 ec 0c             	sub    $0xc,%esp
+  8006e5:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006e9:	50                   	push   %eax
+  8006ea:	ff 75 e0             	push   -0x20(%ebp)
+  8006ed:	57                   	push   %edi
+  8006ee:	51                   	push   %ecx
+  8006ef:	52                   	push   %edx
+  8006f0:	89 da                	mov    %ebx,%edx
+  8006f2:	89 f0                	mov    %esi,%eax
+  8006f4:	e8 4a fb ff ff       	call   800243 <printnum>
+			break;
+  8006f9:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006ff:	e9 40 fc ff ff       	jmp    800344 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800704:	83 f9 01             	cmp    $0x1,%ecx
+  800707:	7f 1b                	jg     800724 <vprintfmt+0x3fe>
+	else if (lflag)
+  800709:	85 c9                	test   %ecx,%ecx
+  80070b:	74 2c                	je     800739 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80070d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800710:	8b 10                	mov    (%eax),%edx
+  800712:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800717:	8d 40 04             	lea    0x4(%eax),%eax
+  80071a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800722:	eb be                	jmp    8006e2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800724:	8b 45 14             	mov    0x14(%ebp),%eax
+  800727:	8b 10                	mov    (%eax),%edx
+  800729:	8b 48 04             	mov    0x4(%eax),%ecx
+  80072c:	8d 40 08             	lea    0x8(%eax),%eax
+  80072f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800732:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800737:	eb a9                	jmp    8006e2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	8b 10                	mov    (%eax),%edx
+  80073e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800743:	8d 40 04             	lea    0x4(%eax),%eax
+  800746:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800749:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80074e:	eb 92                	jmp    8006e2 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800750:	83 ec 08             	sub    $0x8,%esp
+  800753:	53                   	push   %ebx
+  800754:	6a 25                	push   $0x25
+  800756:	ff d6                	call   *%esi
+			break;
+  800758:	83 c4 10             	add    $0x10,%esp
+  80075b:	eb 9f                	jmp    8006fc <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80075d:	83 ec 08             	sub    $0x8,%esp
+  800760:	53                   	push   %ebx
+  800761:	6a 25                	push   $0x25
+  800763:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800765:	83 c4 10             	add    $0x10,%esp
+  800768:	89 f8                	mov    %edi,%eax
+  80076a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80076e:	74 05                	je     800775 <vprintfmt+0x44f>
+  800770:	83 e8 01             	sub    $0x1,%eax
+  800773:	eb f5                	jmp    80076a <vprintfmt+0x444>
+  800775:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800778:	eb 82                	jmp    8006fc <vprintfmt+0x3d6>
+
+0080077a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80077a:	55                   	push   %ebp
+  80077b:	89 e5                	mov    %esp,%ebp
+  80077d:	83 ec 18             	sub    $0x18,%esp
+  800780:	8b 45 08             	mov    0x8(%ebp),%eax
+  800783:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800786:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800789:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80078d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800790:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800797:	85 c0                	test   %eax,%eax
+  800799:	74 26                	je     8007c1 <vsnprintf+0x47>
+  80079b:	85 d2                	test   %edx,%edx
+  80079d:	7e 22                	jle    8007c1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80079f:	ff 75 14             	push   0x14(%ebp)
+  8007a2:	ff 75 10             	push   0x10(%ebp)
+  8007a5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007a8:	50                   	push   %eax
+  8007a9:	68 ec 02 80 00       	push   $0x8002ec
+  8007ae:	e8 73 fb ff ff       	call   800326 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007b3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007b6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007bc:	83 c4 10             	add    $0x10,%esp
+}
+  8007bf:	c9                   	leave
+  8007c0:	c3                   	ret
+		return -E_INVAL;
+  8007c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007c6:	eb f7                	jmp    8007bf <vsnprintf+0x45>
+
+008007c8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007c8:	55                   	push   %ebp
+  8007c9:	89 e5                	mov    %esp,%ebp
+  8007cb:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007ce:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007d1:	50                   	push   %eax
+  8007d2:	ff 75 10             	push   0x10(%ebp)
+  8007d5:	ff 75 0c             	push   0xc(%ebp)
+  8007d8:	ff 75 08             	push   0x8(%ebp)
+  8007db:	e8 9a ff ff ff       	call   80077a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007e0:	c9                   	leave
+  8007e1:	c3                   	ret
+
+008007e2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007e2:	55                   	push   %ebp
+  8007e3:	89 e5                	mov    %esp,%ebp
+  8007e5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ed:	eb 03                	jmp    8007f2 <strlen+0x10>
+		n++;
+  8007ef:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007f2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007f6:	75 f7                	jne    8007ef <strlen+0xd>
+	return n;
+}
+  8007f8:	5d                   	pop    %ebp
+  8007f9:	c3                   	ret
+
+008007fa <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007fa:	55                   	push   %ebp
+  8007fb:	89 e5                	mov    %esp,%ebp
+  8007fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800800:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800803:	b8 00 00 00 00       	mov    $0x0,%eax
+  800808:	eb 03                	jmp    80080d <strnlen+0x13>
+		n++;
+  80080a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80080d:	39 d0                	cmp    %edx,%eax
+  80080f:	74 08                	je     800819 <strnlen+0x1f>
+  800811:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800815:	75 f3                	jne    80080a <strnlen+0x10>
+  800817:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800819:	89 d0                	mov    %edx,%eax
+  80081b:	5d                   	pop    %ebp
+  80081c:	c3                   	ret
+
+0080081d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80081d:	55                   	push   %ebp
+  80081e:	89 e5                	mov    %esp,%ebp
+  800820:	53                   	push   %ebx
+  800821:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800824:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800830:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800833:	83 c0 01             	add    $0x1,%eax
+  800836:	84 d2                	test   %dl,%dl
+  800838:	75 f2                	jne    80082c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80083a:	89 c8                	mov    %ecx,%eax
+  80083c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083f:	c9                   	leave
+  800840:	c3                   	ret
+
+00800841 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800841:	55                   	push   %ebp
+  800842:	89 e5                	mov    %esp,%ebp
+  800844:	53                   	push   %ebx
+  800845:	83 ec 10             	sub    $0x10,%esp
+  800848:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80084b:	53                   	push   %ebx
+  80084c:	e8 91 ff ff ff       	call   8007e2 <strlen>
+  800851:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800854:	ff 75 0c             	push   0xc(%ebp)
+  800857:	01 d8                	add    %ebx,%eax
+  800859:	50                   	push   %eax
+  80085a:	e8 be ff ff ff       	call   80081d <strcpy>
+	return dst;
+}
+  80085f:	89 d8                	mov    %ebx,%eax
+  800861:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800864:	c9                   	leave
+  800865:	c3                   	ret
+
+00800866 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800866:	55                   	push   %ebp
+  800867:	89 e5                	mov    %esp,%ebp
+  800869:	56                   	push   %esi
+  80086a:	53                   	push   %ebx
+  80086b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80086e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800871:	89 f3                	mov    %esi,%ebx
+  800873:	03 5d 10             	add    0x10(%ebp),%ebx
+  800876:	89 f0                	mov    %esi,%eax
+  800878:	eb 0f                	jmp    800889 <strncpy+0x23>
+		*dst++ = *src;
+  80087a:	83 c0 01             	add    $0x1,%eax
+  80087d:	0f b6 0a             	movzbl (%edx),%ecx
+  800880:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800883:	80 f9 01             	cmp    $0x1,%cl
+  800886:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800889:	39 d8                	cmp    %ebx,%eax
+  80088b:	75 ed                	jne    80087a <strncpy+0x14>
+	}
+	return ret;
+}
+  80088d:	89 f0                	mov    %esi,%eax
+  80088f:	5b                   	pop    %ebx
+  800890:	5e                   	pop    %esi
+  800891:	5d                   	pop    %ebp
+  800892:	c3                   	ret
+
+00800893 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800893:	55                   	push   %ebp
+  800894:	89 e5                	mov    %esp,%ebp
+  800896:	56                   	push   %esi
+  800897:	53                   	push   %ebx
+  800898:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80089e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008a1:	89 f0                	mov    %esi,%eax
+  8008a3:	85 d2                	test   %edx,%edx
+  8008a5:	74 21                	je     8008c8 <strlcpy+0x35>
+  8008a7:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008ab:	89 f2                	mov    %esi,%edx
+  8008ad:	eb 09                	jmp    8008b8 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008af:	83 c1 01             	add    $0x1,%ecx
+  8008b2:	83 c2 01             	add    $0x1,%edx
+  8008b5:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008b8:	39 c2                	cmp    %eax,%edx
+  8008ba:	74 09                	je     8008c5 <strlcpy+0x32>
+  8008bc:	0f b6 19             	movzbl (%ecx),%ebx
+  8008bf:	84 db                	test   %bl,%bl
+  8008c1:	75 ec                	jne    8008af <strlcpy+0x1c>
+  8008c3:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008c5:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008c8:	29 f0                	sub    %esi,%eax
+}
+  8008ca:	5b                   	pop    %ebx
+  8008cb:	5e                   	pop    %esi
+  8008cc:	5d                   	pop    %ebp
+  8008cd:	c3                   	ret
+
+008008ce <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008ce:	55                   	push   %ebp
+  8008cf:	89 e5                	mov    %esp,%ebp
+  8008d1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008d7:	eb 06                	jmp    8008df <strcmp+0x11>
+		p++, q++;
+  8008d9:	83 c1 01             	add    $0x1,%ecx
+  8008dc:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008df:	0f b6 01             	movzbl (%ecx),%eax
+  8008e2:	84 c0                	test   %al,%al
+  8008e4:	74 04                	je     8008ea <strcmp+0x1c>
+  8008e6:	3a 02                	cmp    (%edx),%al
+  8008e8:	74 ef                	je     8008d9 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ea:	0f b6 c0             	movzbl %al,%eax
+  8008ed:	0f b6 12             	movzbl (%edx),%edx
+  8008f0:	29 d0                	sub    %edx,%eax
+}
+  8008f2:	5d                   	pop    %ebp
+  8008f3:	c3                   	ret
+
+008008f4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008f4:	55                   	push   %ebp
+  8008f5:	89 e5                	mov    %esp,%ebp
+  8008f7:	53                   	push   %ebx
+  8008f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008fe:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800901:	eb 09                	jmp    80090c <strncmp+0x18>
+		n--, p++, q++;
+  800903:	83 ea 01             	sub    $0x1,%edx
+  800906:	83 c0 01             	add    $0x1,%eax
+  800909:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80090c:	85 d2                	test   %edx,%edx
+  80090e:	74 18                	je     800928 <strncmp+0x34>
+  800910:	0f b6 18             	movzbl (%eax),%ebx
+  800913:	84 db                	test   %bl,%bl
+  800915:	74 04                	je     80091b <strncmp+0x27>
+  800917:	3a 19                	cmp    (%ecx),%bl
+  800919:	74 e8                	je     800903 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80091b:	0f b6 00             	movzbl (%eax),%eax
+  80091e:	0f b6 11             	movzbl (%ecx),%edx
+  800921:	29 d0                	sub    %edx,%eax
+}
+  800923:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800926:	c9                   	leave
+  800927:	c3                   	ret
+		return 0;
+  800928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092d:	eb f4                	jmp    800923 <strncmp+0x2f>
+
+0080092f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	8b 45 08             	mov    0x8(%ebp),%eax
+  800935:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800939:	eb 03                	jmp    80093e <strchr+0xf>
+  80093b:	83 c0 01             	add    $0x1,%eax
+  80093e:	0f b6 10             	movzbl (%eax),%edx
+  800941:	84 d2                	test   %dl,%dl
+  800943:	74 06                	je     80094b <strchr+0x1c>
+		if (*s == c)
+  800945:	38 ca                	cmp    %cl,%dl
+  800947:	75 f2                	jne    80093b <strchr+0xc>
+  800949:	eb 05                	jmp    800950 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80094b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800950:	5d                   	pop    %ebp
+  800951:	c3                   	ret
+
+00800952 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800952:	55                   	push   %ebp
+  800953:	89 e5                	mov    %esp,%ebp
+  800955:	8b 45 08             	mov    0x8(%ebp),%eax
+  800958:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80095c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80095f:	38 ca                	cmp    %cl,%dl
+  800961:	74 09                	je     80096c <strfind+0x1a>
+  800963:	84 d2                	test   %dl,%dl
+  800965:	74 05                	je     80096c <strfind+0x1a>
+	for (; *s; s++)
+  800967:	83 c0 01             	add    $0x1,%eax
+  80096a:	eb f0                	jmp    80095c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80096c:	5d                   	pop    %ebp
+  80096d:	c3                   	ret
+
+0080096e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	57                   	push   %edi
+  800972:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800975:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800978:	85 c9                	test   %ecx,%ecx
+  80097a:	74 20                	je     80099c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80097c:	89 f8                	mov    %edi,%eax
+  80097e:	09 c8                	or     %ecx,%eax
+  800980:	a8 03                	test   $0x3,%al
+  800982:	75 12                	jne    800996 <memset+0x28>
+		c &= 0xFF;
+  800984:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800988:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80098e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800991:	fc                   	cld
+  800992:	f3 ab                	rep stos %eax,%es:(%edi)
+  800994:	eb 06                	jmp    80099c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800996:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800999:	fc                   	cld
+  80099a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80099c:	89 f8                	mov    %edi,%eax
+  80099e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009a1:	c9                   	leave
+  8009a2:	c3                   	ret
+
+008009a3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009a3:	55                   	push   %ebp
+  8009a4:	89 e5                	mov    %esp,%ebp
+  8009a6:	57                   	push   %edi
+  8009a7:	56                   	push   %esi
+  8009a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009ae:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009b1:	39 c6                	cmp    %eax,%esi
+  8009b3:	73 32                	jae    8009e7 <memmove+0x44>
+  8009b5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009b8:	39 d0                	cmp    %edx,%eax
+  8009ba:	73 2b                	jae    8009e7 <memmove+0x44>
+		s += n;
+		d += n;
+  8009bc:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009bf:	89 d6                	mov    %edx,%esi
+  8009c1:	09 fe                	or     %edi,%esi
+  8009c3:	09 ce                	or     %ecx,%esi
+  8009c5:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009cb:	75 0e                	jne    8009db <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009cd:	83 ef 04             	sub    $0x4,%edi
+  8009d0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009d3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009d6:	fd                   	std
+  8009d7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d9:	eb 09                	jmp    8009e4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009db:	83 ef 01             	sub    $0x1,%edi
+  8009de:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009e1:	fd                   	std
+  8009e2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009e4:	fc                   	cld
+  8009e5:	eb 1a                	jmp    800a01 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009e7:	89 f2                	mov    %esi,%edx
+  8009e9:	09 c2                	or     %eax,%edx
+  8009eb:	09 ca                	or     %ecx,%edx
+  8009ed:	f6 c2 03             	test   $0x3,%dl
+  8009f0:	75 0a                	jne    8009fc <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009f2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009f5:	89 c7                	mov    %eax,%edi
+  8009f7:	fc                   	cld
+  8009f8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009fa:	eb 05                	jmp    800a01 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009fc:	89 c7                	mov    %eax,%edi
+  8009fe:	fc                   	cld
+  8009ff:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a01:	5e                   	pop    %esi
+  800a02:	5f                   	pop    %edi
+  800a03:	5d                   	pop    %ebp
+  800a04:	c3                   	ret
+
+00800a05 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a0b:	ff 75 10             	push   0x10(%ebp)
+  800a0e:	ff 75 0c             	push   0xc(%ebp)
+  800a11:	ff 75 08             	push   0x8(%ebp)
+  800a14:	e8 8a ff ff ff       	call   8009a3 <memmove>
+}
+  800a19:	c9                   	leave
+  800a1a:	c3                   	ret
+
+00800a1b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a1b:	55                   	push   %ebp
+  800a1c:	89 e5                	mov    %esp,%ebp
+  800a1e:	56                   	push   %esi
+  800a1f:	53                   	push   %ebx
+  800a20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a23:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a26:	89 c6                	mov    %eax,%esi
+  800a28:	03 75 10             	add    0x10(%ebp),%esi
+  800a2b:	eb 06                	jmp    800a33 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a2d:	83 c0 01             	add    $0x1,%eax
+  800a30:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a33:	39 f0                	cmp    %esi,%eax
+  800a35:	74 14                	je     800a4b <memcmp+0x30>
+		if (*s1 != *s2)
+  800a37:	0f b6 08             	movzbl (%eax),%ecx
+  800a3a:	0f b6 1a             	movzbl (%edx),%ebx
+  800a3d:	38 d9                	cmp    %bl,%cl
+  800a3f:	74 ec                	je     800a2d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a41:	0f b6 c1             	movzbl %cl,%eax
+  800a44:	0f b6 db             	movzbl %bl,%ebx
+  800a47:	29 d8                	sub    %ebx,%eax
+  800a49:	eb 05                	jmp    800a50 <memcmp+0x35>
+	}
+
+	return 0;
+  800a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a50:	5b                   	pop    %ebx
+  800a51:	5e                   	pop    %esi
+  800a52:	5d                   	pop    %ebp
+  800a53:	c3                   	ret
+
+00800a54 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a5d:	89 c2                	mov    %eax,%edx
+  800a5f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a62:	eb 03                	jmp    800a67 <memfind+0x13>
+  800a64:	83 c0 01             	add    $0x1,%eax
+  800a67:	39 d0                	cmp    %edx,%eax
+  800a69:	73 04                	jae    800a6f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a6b:	38 08                	cmp    %cl,(%eax)
+  800a6d:	75 f5                	jne    800a64 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a6f:	5d                   	pop    %ebp
+  800a70:	c3                   	ret
+
+00800a71 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a71:	55                   	push   %ebp
+  800a72:	89 e5                	mov    %esp,%ebp
+  800a74:	57                   	push   %edi
+  800a75:	56                   	push   %esi
+  800a76:	53                   	push   %ebx
+  800a77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a7d:	eb 03                	jmp    800a82 <strtol+0x11>
+		s++;
+  800a7f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a82:	0f b6 02             	movzbl (%edx),%eax
+  800a85:	3c 20                	cmp    $0x20,%al
+  800a87:	74 f6                	je     800a7f <strtol+0xe>
+  800a89:	3c 09                	cmp    $0x9,%al
+  800a8b:	74 f2                	je     800a7f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a8d:	3c 2b                	cmp    $0x2b,%al
+  800a8f:	74 2a                	je     800abb <strtol+0x4a>
+	int neg = 0;
+  800a91:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a96:	3c 2d                	cmp    $0x2d,%al
+  800a98:	74 2b                	je     800ac5 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a9a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aa0:	75 0f                	jne    800ab1 <strtol+0x40>
+  800aa2:	80 3a 30             	cmpb   $0x30,(%edx)
+  800aa5:	74 28                	je     800acf <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aa7:	85 db                	test   %ebx,%ebx
+  800aa9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aae:	0f 44 d8             	cmove  %eax,%ebx
+  800ab1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ab9:	eb 46                	jmp    800b01 <strtol+0x90>
+		s++;
+  800abb:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ac3:	eb d5                	jmp    800a9a <strtol+0x29>
+		s++, neg = 1;
+  800ac5:	83 c2 01             	add    $0x1,%edx
+  800ac8:	bf 01 00 00 00       	mov    $0x1,%edi
+  800acd:	eb cb                	jmp    800a9a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800acf:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ad3:	74 0e                	je     800ae3 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ad5:	85 db                	test   %ebx,%ebx
+  800ad7:	75 d8                	jne    800ab1 <strtol+0x40>
+		s++, base = 8;
+  800ad9:	83 c2 01             	add    $0x1,%edx
+  800adc:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ae1:	eb ce                	jmp    800ab1 <strtol+0x40>
+		s += 2, base = 16;
+  800ae3:	83 c2 02             	add    $0x2,%edx
+  800ae6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800aeb:	eb c4                	jmp    800ab1 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800aed:	0f be c0             	movsbl %al,%eax
+  800af0:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800af3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800af6:	7d 3a                	jge    800b32 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800af8:	83 c2 01             	add    $0x1,%edx
+  800afb:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800aff:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b01:	0f b6 02             	movzbl (%edx),%eax
+  800b04:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b07:	89 f3                	mov    %esi,%ebx
+  800b09:	80 fb 09             	cmp    $0x9,%bl
+  800b0c:	76 df                	jbe    800aed <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b0e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b11:	89 f3                	mov    %esi,%ebx
+  800b13:	80 fb 19             	cmp    $0x19,%bl
+  800b16:	77 08                	ja     800b20 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b18:	0f be c0             	movsbl %al,%eax
+  800b1b:	83 e8 57             	sub    $0x57,%eax
+  800b1e:	eb d3                	jmp    800af3 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b20:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b23:	89 f3                	mov    %esi,%ebx
+  800b25:	80 fb 19             	cmp    $0x19,%bl
+  800b28:	77 08                	ja     800b32 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b2a:	0f be c0             	movsbl %al,%eax
+  800b2d:	83 e8 37             	sub    $0x37,%eax
+  800b30:	eb c1                	jmp    800af3 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b32:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b36:	74 05                	je     800b3d <strtol+0xcc>
+		*endptr = (char *) s;
+  800b38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b3b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b3d:	89 c8                	mov    %ecx,%eax
+  800b3f:	f7 d8                	neg    %eax
+  800b41:	85 ff                	test   %edi,%edi
+  800b43:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b46:	89 c8                	mov    %ecx,%eax
+  800b48:	5b                   	pop    %ebx
+  800b49:	5e                   	pop    %esi
+  800b4a:	5f                   	pop    %edi
+  800b4b:	5d                   	pop    %ebp
+  800b4c:	c3                   	ret
+
+00800b4d <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	57                   	push   %edi
+  800b51:	56                   	push   %esi
+  800b52:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b5e:	89 c3                	mov    %eax,%ebx
+  800b60:	89 c7                	mov    %eax,%edi
+  800b62:	89 c6                	mov    %eax,%esi
+  800b64:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b66:	5b                   	pop    %ebx
+  800b67:	5e                   	pop    %esi
+  800b68:	5f                   	pop    %edi
+  800b69:	5d                   	pop    %ebp
+  800b6a:	c3                   	ret
+
+00800b6b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b6b:	55                   	push   %ebp
+  800b6c:	89 e5                	mov    %esp,%ebp
+  800b6e:	57                   	push   %edi
+  800b6f:	56                   	push   %esi
+  800b70:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b71:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b76:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b7b:	89 d1                	mov    %edx,%ecx
+  800b7d:	89 d3                	mov    %edx,%ebx
+  800b7f:	89 d7                	mov    %edx,%edi
+  800b81:	89 d6                	mov    %edx,%esi
+  800b83:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b85:	5b                   	pop    %ebx
+  800b86:	5e                   	pop    %esi
+  800b87:	5f                   	pop    %edi
+  800b88:	5d                   	pop    %ebp
+  800b89:	c3                   	ret
+
+00800b8a <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b8a:	55                   	push   %ebp
+  800b8b:	89 e5                	mov    %esp,%ebp
+  800b8d:	57                   	push   %edi
+  800b8e:	56                   	push   %esi
+  800b8f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b98:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b9d:	89 cb                	mov    %ecx,%ebx
+  800b9f:	89 cf                	mov    %ecx,%edi
+  800ba1:	89 ce                	mov    %ecx,%esi
+  800ba3:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800ba5:	5b                   	pop    %ebx
+  800ba6:	5e                   	pop    %esi
+  800ba7:	5f                   	pop    %edi
+  800ba8:	5d                   	pop    %ebp
+  800ba9:	c3                   	ret
+
+00800baa <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800baa:	55                   	push   %ebp
+  800bab:	89 e5                	mov    %esp,%ebp
+  800bad:	57                   	push   %edi
+  800bae:	56                   	push   %esi
+  800baf:	53                   	push   %ebx
+  800bb0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bc0:	89 cb                	mov    %ecx,%ebx
+  800bc2:	89 cf                	mov    %ecx,%edi
+  800bc4:	89 ce                	mov    %ecx,%esi
+  800bc6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bc8:	85 c0                	test   %eax,%eax
+  800bca:	7f 08                	jg     800bd4 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bcf:	5b                   	pop    %ebx
+  800bd0:	5e                   	pop    %esi
+  800bd1:	5f                   	pop    %edi
+  800bd2:	5d                   	pop    %ebp
+  800bd3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bd4:	83 ec 0c             	sub    $0xc,%esp
+  800bd7:	50                   	push   %eax
+  800bd8:	6a 03                	push   $0x3
+  800bda:	68 5f 2e 80 00       	push   $0x802e5f
+  800bdf:	6a 23                	push   $0x23
+  800be1:	68 7c 2e 80 00       	push   $0x802e7c
+  800be6:	e8 69 f5 ff ff       	call   800154 <_panic>
+
+00800beb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800beb:	55                   	push   %ebp
+  800bec:	89 e5                	mov    %esp,%ebp
+  800bee:	57                   	push   %edi
+  800bef:	56                   	push   %esi
+  800bf0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bfb:	89 d1                	mov    %edx,%ecx
+  800bfd:	89 d3                	mov    %edx,%ebx
+  800bff:	89 d7                	mov    %edx,%edi
+  800c01:	89 d6                	mov    %edx,%esi
+  800c03:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c05:	5b                   	pop    %ebx
+  800c06:	5e                   	pop    %esi
+  800c07:	5f                   	pop    %edi
+  800c08:	5d                   	pop    %ebp
+  800c09:	c3                   	ret
+
+00800c0a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c0a:	55                   	push   %ebp
+  800c0b:	89 e5                	mov    %esp,%ebp
+  800c0d:	57                   	push   %edi
+  800c0e:	56                   	push   %esi
+  800c0f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c15:	b8 16 00 00 00       	mov    $0x16,%eax
+  800c1a:	89 d1                	mov    %edx,%ecx
+  800c1c:	89 d3                	mov    %edx,%ebx
+  800c1e:	89 d7                	mov    %edx,%edi
+  800c20:	89 d6                	mov    %edx,%esi
+  800c22:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c24:	5b                   	pop    %ebx
+  800c25:	5e                   	pop    %esi
+  800c26:	5f                   	pop    %edi
+  800c27:	5d                   	pop    %ebp
+  800c28:	c3                   	ret
+
+00800c29 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800c29:	55                   	push   %ebp
+  800c2a:	89 e5                	mov    %esp,%ebp
+  800c2c:	57                   	push   %edi
+  800c2d:	56                   	push   %esi
+  800c2e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c34:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800c39:	89 d1                	mov    %edx,%ecx
+  800c3b:	89 d3                	mov    %edx,%ebx
+  800c3d:	89 d7                	mov    %edx,%edi
+  800c3f:	89 d6                	mov    %edx,%esi
+  800c41:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800c43:	5b                   	pop    %ebx
+  800c44:	5e                   	pop    %esi
+  800c45:	5f                   	pop    %edi
+  800c46:	5d                   	pop    %ebp
+  800c47:	c3                   	ret
+
+00800c48 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800c48:	55                   	push   %ebp
+  800c49:	89 e5                	mov    %esp,%ebp
+  800c4b:	57                   	push   %edi
+  800c4c:	56                   	push   %esi
+  800c4d:	53                   	push   %ebx
+  800c4e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5c:	b8 15 00 00 00       	mov    $0x15,%eax
+  800c61:	89 df                	mov    %ebx,%edi
+  800c63:	89 de                	mov    %ebx,%esi
+  800c65:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c67:	85 c0                	test   %eax,%eax
+  800c69:	7f 08                	jg     800c73 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800c6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6e:	5b                   	pop    %ebx
+  800c6f:	5e                   	pop    %esi
+  800c70:	5f                   	pop    %edi
+  800c71:	5d                   	pop    %ebp
+  800c72:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c73:	83 ec 0c             	sub    $0xc,%esp
+  800c76:	50                   	push   %eax
+  800c77:	6a 15                	push   $0x15
+  800c79:	68 5f 2e 80 00       	push   $0x802e5f
+  800c7e:	6a 23                	push   $0x23
+  800c80:	68 7c 2e 80 00       	push   $0x802e7c
+  800c85:	e8 ca f4 ff ff       	call   800154 <_panic>
+
+00800c8a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c8a:	55                   	push   %ebp
+  800c8b:	89 e5                	mov    %esp,%ebp
+  800c8d:	57                   	push   %edi
+  800c8e:	56                   	push   %esi
+  800c8f:	53                   	push   %ebx
+  800c90:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c93:	be 00 00 00 00       	mov    $0x0,%esi
+  800c98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ca3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ca6:	89 f7                	mov    %esi,%edi
+  800ca8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800caa:	85 c0                	test   %eax,%eax
+  800cac:	7f 08                	jg     800cb6 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb1:	5b                   	pop    %ebx
+  800cb2:	5e                   	pop    %esi
+  800cb3:	5f                   	pop    %edi
+  800cb4:	5d                   	pop    %ebp
+  800cb5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb6:	83 ec 0c             	sub    $0xc,%esp
+  800cb9:	50                   	push   %eax
+  800cba:	6a 05                	push   $0x5
+  800cbc:	68 5f 2e 80 00       	push   $0x802e5f
+  800cc1:	6a 23                	push   $0x23
+  800cc3:	68 7c 2e 80 00       	push   $0x802e7c
+  800cc8:	e8 87 f4 ff ff       	call   800154 <_panic>
+
+00800ccd <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	56                   	push   %esi
+  800cd2:	53                   	push   %ebx
+  800cd3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cd6:	be 00 00 00 00       	mov    $0x0,%esi
+  800cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce1:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ce6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ce9:	89 f7                	mov    %esi,%edi
+  800ceb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ced:	85 c0                	test   %eax,%eax
+  800cef:	7f 08                	jg     800cf9 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cf1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf4:	5b                   	pop    %ebx
+  800cf5:	5e                   	pop    %esi
+  800cf6:	5f                   	pop    %edi
+  800cf7:	5d                   	pop    %ebp
+  800cf8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf9:	83 ec 0c             	sub    $0xc,%esp
+  800cfc:	50                   	push   %eax
+  800cfd:	6a 06                	push   $0x6
+  800cff:	68 5f 2e 80 00       	push   $0x802e5f
+  800d04:	6a 23                	push   $0x23
+  800d06:	68 7c 2e 80 00       	push   $0x802e7c
+  800d0b:	e8 44 f4 ff ff       	call   800154 <_panic>
+
+00800d10 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d10:	55                   	push   %ebp
+  800d11:	89 e5                	mov    %esp,%ebp
+  800d13:	57                   	push   %edi
+  800d14:	56                   	push   %esi
+  800d15:	53                   	push   %ebx
+  800d16:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1f:	b8 07 00 00 00       	mov    $0x7,%eax
+  800d24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d27:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d2a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d2d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d2f:	85 c0                	test   %eax,%eax
+  800d31:	7f 08                	jg     800d3b <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d36:	5b                   	pop    %ebx
+  800d37:	5e                   	pop    %esi
+  800d38:	5f                   	pop    %edi
+  800d39:	5d                   	pop    %ebp
+  800d3a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d3b:	83 ec 0c             	sub    $0xc,%esp
+  800d3e:	50                   	push   %eax
+  800d3f:	6a 07                	push   $0x7
+  800d41:	68 5f 2e 80 00       	push   $0x802e5f
+  800d46:	6a 23                	push   $0x23
+  800d48:	68 7c 2e 80 00       	push   $0x802e7c
+  800d4d:	e8 02 f4 ff ff       	call   800154 <_panic>
+
+00800d52 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d52:	55                   	push   %ebp
+  800d53:	89 e5                	mov    %esp,%ebp
+  800d55:	57                   	push   %edi
+  800d56:	56                   	push   %esi
+  800d57:	53                   	push   %ebx
+  800d58:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d66:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d6b:	89 df                	mov    %ebx,%edi
+  800d6d:	89 de                	mov    %ebx,%esi
+  800d6f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d71:	85 c0                	test   %eax,%eax
+  800d73:	7f 08                	jg     800d7d <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d78:	5b                   	pop    %ebx
+  800d79:	5e                   	pop    %esi
+  800d7a:	5f                   	pop    %edi
+  800d7b:	5d                   	pop    %ebp
+  800d7c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d7d:	83 ec 0c             	sub    $0xc,%esp
+  800d80:	50                   	push   %eax
+  800d81:	6a 08                	push   $0x8
+  800d83:	68 5f 2e 80 00       	push   $0x802e5f
+  800d88:	6a 23                	push   $0x23
+  800d8a:	68 7c 2e 80 00       	push   $0x802e7c
+  800d8f:	e8 c0 f3 ff ff       	call   800154 <_panic>
+
+00800d94 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	57                   	push   %edi
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da0:	b8 09 00 00 00       	mov    $0x9,%eax
+  800da5:	be 00 00 00 00       	mov    $0x0,%esi
+  800daa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db0:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800db2:	5b                   	pop    %ebx
+  800db3:	5e                   	pop    %esi
+  800db4:	5f                   	pop    %edi
+  800db5:	5d                   	pop    %ebp
+  800db6:	c3                   	ret
+
+00800db7 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	57                   	push   %edi
+  800dbb:	56                   	push   %esi
+  800dbc:	53                   	push   %ebx
+  800dbd:	8b 45 18             	mov    0x18(%ebp),%eax
+  800dc0:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800dc3:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800dc8:	77 27                	ja     800df1 <sys_page_map_range+0x3a>
+  800dca:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800dd0:	77 1f                	ja     800df1 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800dd2:	c1 e0 0c             	shl    $0xc,%eax
+  800dd5:	89 c6                	mov    %eax,%esi
+  800dd7:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800dd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800de4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dea:	cd 30                	int    $0x30
+}
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+		return -E_INVAL;
+  800df1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800df6:	eb f4                	jmp    800dec <sys_page_map_range+0x35>
+
+00800df8 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800df8:	55                   	push   %ebp
+  800df9:	89 e5                	mov    %esp,%ebp
+  800dfb:	57                   	push   %edi
+  800dfc:	56                   	push   %esi
+  800dfd:	53                   	push   %ebx
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e07:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e0c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e14:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e17:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e19:	85 c0                	test   %eax,%eax
+  800e1b:	7f 08                	jg     800e25 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800e1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e20:	5b                   	pop    %ebx
+  800e21:	5e                   	pop    %esi
+  800e22:	5f                   	pop    %edi
+  800e23:	5d                   	pop    %ebp
+  800e24:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e25:	83 ec 0c             	sub    $0xc,%esp
+  800e28:	50                   	push   %eax
+  800e29:	6a 0c                	push   $0xc
+  800e2b:	68 5f 2e 80 00       	push   $0x802e5f
+  800e30:	6a 23                	push   $0x23
+  800e32:	68 7c 2e 80 00       	push   $0x802e7c
+  800e37:	e8 18 f3 ff ff       	call   800154 <_panic>
+
+00800e3c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e3c:	55                   	push   %ebp
+  800e3d:	89 e5                	mov    %esp,%ebp
+  800e3f:	57                   	push   %edi
+  800e40:	56                   	push   %esi
+  800e41:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e42:	be 00 00 00 00       	mov    $0x0,%esi
+  800e47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e52:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e55:	89 f7                	mov    %esi,%edi
+  800e57:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e59:	5b                   	pop    %ebx
+  800e5a:	5e                   	pop    %esi
+  800e5b:	5f                   	pop    %edi
+  800e5c:	5d                   	pop    %ebp
+  800e5d:	c3                   	ret
+
+00800e5e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	57                   	push   %edi
+  800e62:	56                   	push   %esi
+  800e63:	53                   	push   %ebx
+  800e64:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e72:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e77:	89 df                	mov    %ebx,%edi
+  800e79:	89 de                	mov    %ebx,%esi
+  800e7b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e7d:	85 c0                	test   %eax,%eax
+  800e7f:	7f 08                	jg     800e89 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e84:	5b                   	pop    %ebx
+  800e85:	5e                   	pop    %esi
+  800e86:	5f                   	pop    %edi
+  800e87:	5d                   	pop    %ebp
+  800e88:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e89:	83 ec 0c             	sub    $0xc,%esp
+  800e8c:	50                   	push   %eax
+  800e8d:	6a 0f                	push   $0xf
+  800e8f:	68 5f 2e 80 00       	push   $0x802e5f
+  800e94:	6a 23                	push   $0x23
+  800e96:	68 7c 2e 80 00       	push   $0x802e7c
+  800e9b:	e8 b4 f2 ff ff       	call   800154 <_panic>
+
+00800ea0 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800ea0:	55                   	push   %ebp
+  800ea1:	89 e5                	mov    %esp,%ebp
+  800ea3:	57                   	push   %edi
+  800ea4:	56                   	push   %esi
+  800ea5:	53                   	push   %ebx
+  800ea6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb4:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eb9:	89 df                	mov    %ebx,%edi
+  800ebb:	89 de                	mov    %ebx,%esi
+  800ebd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ebf:	85 c0                	test   %eax,%eax
+  800ec1:	7f 08                	jg     800ecb <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800ec3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec6:	5b                   	pop    %ebx
+  800ec7:	5e                   	pop    %esi
+  800ec8:	5f                   	pop    %edi
+  800ec9:	5d                   	pop    %ebp
+  800eca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ecb:	83 ec 0c             	sub    $0xc,%esp
+  800ece:	50                   	push   %eax
+  800ecf:	6a 10                	push   $0x10
+  800ed1:	68 5f 2e 80 00       	push   $0x802e5f
+  800ed6:	6a 23                	push   $0x23
+  800ed8:	68 7c 2e 80 00       	push   $0x802e7c
+  800edd:	e8 72 f2 ff ff       	call   800154 <_panic>
+
+00800ee2 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800ee2:	55                   	push   %ebp
+  800ee3:	89 e5                	mov    %esp,%ebp
+  800ee5:	57                   	push   %edi
+  800ee6:	56                   	push   %esi
+  800ee7:	53                   	push   %ebx
+  800ee8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eeb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef6:	b8 11 00 00 00       	mov    $0x11,%eax
+  800efb:	89 df                	mov    %ebx,%edi
+  800efd:	89 de                	mov    %ebx,%esi
+  800eff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f01:	85 c0                	test   %eax,%eax
+  800f03:	7f 08                	jg     800f0d <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800f05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f08:	5b                   	pop    %ebx
+  800f09:	5e                   	pop    %esi
+  800f0a:	5f                   	pop    %edi
+  800f0b:	5d                   	pop    %ebp
+  800f0c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0d:	83 ec 0c             	sub    $0xc,%esp
+  800f10:	50                   	push   %eax
+  800f11:	6a 11                	push   $0x11
+  800f13:	68 5f 2e 80 00       	push   $0x802e5f
+  800f18:	6a 23                	push   $0x23
+  800f1a:	68 7c 2e 80 00       	push   $0x802e7c
+  800f1f:	e8 30 f2 ff ff       	call   800154 <_panic>
+
+00800f24 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	57                   	push   %edi
+  800f28:	56                   	push   %esi
+  800f29:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f2f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f34:	89 d1                	mov    %edx,%ecx
+  800f36:	89 d3                	mov    %edx,%ebx
+  800f38:	89 d7                	mov    %edx,%edi
+  800f3a:	89 d6                	mov    %edx,%esi
+  800f3c:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+
+00800f43 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	57                   	push   %edi
+  800f47:	56                   	push   %esi
+  800f48:	53                   	push   %ebx
+  800f49:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f57:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f5c:	89 df                	mov    %ebx,%edi
+  800f5e:	89 de                	mov    %ebx,%esi
+  800f60:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f62:	85 c0                	test   %eax,%eax
+  800f64:	7f 08                	jg     800f6e <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f69:	5b                   	pop    %ebx
+  800f6a:	5e                   	pop    %esi
+  800f6b:	5f                   	pop    %edi
+  800f6c:	5d                   	pop    %ebp
+  800f6d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6e:	83 ec 0c             	sub    $0xc,%esp
+  800f71:	50                   	push   %eax
+  800f72:	6a 13                	push   $0x13
+  800f74:	68 5f 2e 80 00       	push   $0x802e5f
+  800f79:	6a 23                	push   $0x23
+  800f7b:	68 7c 2e 80 00       	push   $0x802e7c
+  800f80:	e8 cf f1 ff ff       	call   800154 <_panic>
+
+00800f85 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f85:	55                   	push   %ebp
+  800f86:	89 e5                	mov    %esp,%ebp
+  800f88:	57                   	push   %edi
+  800f89:	56                   	push   %esi
+  800f8a:	53                   	push   %ebx
+  800f8b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f99:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f9e:	89 df                	mov    %ebx,%edi
+  800fa0:	89 de                	mov    %ebx,%esi
+  800fa2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa4:	85 c0                	test   %eax,%eax
+  800fa6:	7f 08                	jg     800fb0 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fab:	5b                   	pop    %ebx
+  800fac:	5e                   	pop    %esi
+  800fad:	5f                   	pop    %edi
+  800fae:	5d                   	pop    %ebp
+  800faf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb0:	83 ec 0c             	sub    $0xc,%esp
+  800fb3:	50                   	push   %eax
+  800fb4:	6a 14                	push   $0x14
+  800fb6:	68 5f 2e 80 00       	push   $0x802e5f
+  800fbb:	6a 23                	push   $0x23
+  800fbd:	68 7c 2e 80 00       	push   $0x802e7c
+  800fc2:	e8 8d f1 ff ff       	call   800154 <_panic>
+
+00800fc7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fc7:	55                   	push   %ebp
+  800fc8:	89 e5                	mov    %esp,%ebp
+  800fca:	57                   	push   %edi
+  800fcb:	56                   	push   %esi
+  800fcc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd3:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fd8:	be 00 00 00 00       	mov    $0x0,%esi
+  800fdd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fe3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fe5:	5b                   	pop    %ebx
+  800fe6:	5e                   	pop    %esi
+  800fe7:	5f                   	pop    %edi
+  800fe8:	5d                   	pop    %ebp
+  800fe9:	c3                   	ret
+
+00800fea <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fea:	55                   	push   %ebp
+  800feb:	89 e5                	mov    %esp,%ebp
+  800fed:	57                   	push   %edi
+  800fee:	56                   	push   %esi
+  800fef:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff6:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ffb:	be 00 00 00 00       	mov    $0x0,%esi
+  801000:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801003:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801006:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801008:	5b                   	pop    %ebx
+  801009:	5e                   	pop    %esi
+  80100a:	5f                   	pop    %edi
+  80100b:	5d                   	pop    %ebp
+  80100c:	c3                   	ret
+
+0080100d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80100d:	55                   	push   %ebp
+  80100e:	89 e5                	mov    %esp,%ebp
+  801010:	57                   	push   %edi
+  801011:	56                   	push   %esi
+  801012:	53                   	push   %ebx
+  801013:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801016:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101e:	b8 19 00 00 00       	mov    $0x19,%eax
+  801023:	89 cb                	mov    %ecx,%ebx
+  801025:	89 cf                	mov    %ecx,%edi
+  801027:	89 ce                	mov    %ecx,%esi
+  801029:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80102b:	85 c0                	test   %eax,%eax
+  80102d:	7f 08                	jg     801037 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80102f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801032:	5b                   	pop    %ebx
+  801033:	5e                   	pop    %esi
+  801034:	5f                   	pop    %edi
+  801035:	5d                   	pop    %ebp
+  801036:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801037:	83 ec 0c             	sub    $0xc,%esp
+  80103a:	50                   	push   %eax
+  80103b:	6a 19                	push   $0x19
+  80103d:	68 5f 2e 80 00       	push   $0x802e5f
+  801042:	6a 23                	push   $0x23
+  801044:	68 7c 2e 80 00       	push   $0x802e7c
+  801049:	e8 06 f1 ff ff       	call   800154 <_panic>
+
+0080104e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80104e:	55                   	push   %ebp
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	57                   	push   %edi
+  801052:	56                   	push   %esi
+  801053:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801054:	ba 00 00 00 00       	mov    $0x0,%edx
+  801059:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80105e:	89 d1                	mov    %edx,%ecx
+  801060:	89 d3                	mov    %edx,%ebx
+  801062:	89 d7                	mov    %edx,%edi
+  801064:	89 d6                	mov    %edx,%esi
+  801066:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801068:	5b                   	pop    %ebx
+  801069:	5e                   	pop    %esi
+  80106a:	5f                   	pop    %edi
+  80106b:	5d                   	pop    %ebp
+  80106c:	c3                   	ret
+
+0080106d <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  80106d:	55                   	push   %ebp
+  80106e:	89 e5                	mov    %esp,%ebp
+  801070:	57                   	push   %edi
+  801071:	56                   	push   %esi
+  801072:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801073:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801078:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801083:	89 df                	mov    %ebx,%edi
+  801085:	89 de                	mov    %ebx,%esi
+  801087:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+
+0080108e <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	57                   	push   %edi
+  801092:	56                   	push   %esi
+  801093:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801094:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801099:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010a4:	89 df                	mov    %ebx,%edi
+  8010a6:	89 de                	mov    %ebx,%esi
+  8010a8:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5e                   	pop    %esi
+  8010ac:	5f                   	pop    %edi
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	c3                   	ret
+
+008010af <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8010af:	55                   	push   %ebp
+  8010b0:	89 e5                	mov    %esp,%ebp
+  8010b2:	53                   	push   %ebx
+  8010b3:	83 ec 04             	sub    $0x4,%esp
+  8010b6:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8010b9:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  8010bb:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  8010be:	f6 c2 02             	test   $0x2,%dl
+  8010c1:	74 7b                	je     80113e <pgfault+0x8f>
+  8010c3:	89 c1                	mov    %eax,%ecx
+  8010c5:	c1 e9 0c             	shr    $0xc,%ecx
+  8010c8:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8010cf:	f6 c5 08             	test   $0x8,%ch
+  8010d2:	74 6a                	je     80113e <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8010d4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8010d9:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8010db:	83 ec 04             	sub    $0x4,%esp
+  8010de:	6a 07                	push   $0x7
+  8010e0:	68 00 f0 7f 00       	push   $0x7ff000
+  8010e5:	6a 00                	push   $0x0
+  8010e7:	e8 9e fb ff ff       	call   800c8a <sys_page_alloc>
+  8010ec:	83 c4 10             	add    $0x10,%esp
+  8010ef:	85 c0                	test   %eax,%eax
+  8010f1:	78 61                	js     801154 <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  8010f3:	83 ec 04             	sub    $0x4,%esp
+  8010f6:	68 00 10 00 00       	push   $0x1000
+  8010fb:	53                   	push   %ebx
+  8010fc:	68 00 f0 7f 00       	push   $0x7ff000
+  801101:	e8 9d f8 ff ff       	call   8009a3 <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  801106:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80110d:	53                   	push   %ebx
+  80110e:	6a 00                	push   $0x0
+  801110:	68 00 f0 7f 00       	push   $0x7ff000
+  801115:	6a 00                	push   $0x0
+  801117:	e8 f4 fb ff ff       	call   800d10 <sys_page_map>
+  80111c:	83 c4 20             	add    $0x20,%esp
+  80111f:	85 c0                	test   %eax,%eax
+  801121:	78 43                	js     801166 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  801123:	83 ec 08             	sub    $0x8,%esp
+  801126:	68 00 f0 7f 00       	push   $0x7ff000
+  80112b:	6a 00                	push   $0x0
+  80112d:	e8 20 fc ff ff       	call   800d52 <sys_page_unmap>
+  801132:	83 c4 10             	add    $0x10,%esp
+  801135:	85 c0                	test   %eax,%eax
+  801137:	78 3f                	js     801178 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  801139:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80113c:	c9                   	leave
+  80113d:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  80113e:	83 ec 0c             	sub    $0xc,%esp
+  801141:	50                   	push   %eax
+  801142:	52                   	push   %edx
+  801143:	68 8a 2e 80 00       	push   $0x802e8a
+  801148:	6a 19                	push   $0x19
+  80114a:	68 9b 2e 80 00       	push   $0x802e9b
+  80114f:	e8 00 f0 ff ff       	call   800154 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801154:	50                   	push   %eax
+  801155:	68 a6 2e 80 00       	push   $0x802ea6
+  80115a:	6a 24                	push   $0x24
+  80115c:	68 9b 2e 80 00       	push   $0x802e9b
+  801161:	e8 ee ef ff ff       	call   800154 <_panic>
+		panic("sys_page_map: %e", r);
+  801166:	50                   	push   %eax
+  801167:	68 b9 2e 80 00       	push   $0x802eb9
+  80116c:	6a 29                	push   $0x29
+  80116e:	68 9b 2e 80 00       	push   $0x802e9b
+  801173:	e8 dc ef ff ff       	call   800154 <_panic>
+		panic("sys_page_unmap: %e", r);
+  801178:	50                   	push   %eax
+  801179:	68 ca 2e 80 00       	push   $0x802eca
+  80117e:	6a 2c                	push   $0x2c
+  801180:	68 9b 2e 80 00       	push   $0x802e9b
+  801185:	e8 ca ef ff ff       	call   800154 <_panic>
+
+0080118a <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  80118a:	55                   	push   %ebp
+  80118b:	89 e5                	mov    %esp,%ebp
+  80118d:	57                   	push   %edi
+  80118e:	56                   	push   %esi
+  80118f:	53                   	push   %ebx
+  801190:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801193:	68 af 10 80 00       	push   $0x8010af
+  801198:	e8 61 14 00 00       	call   8025fe <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  80119d:	83 c4 08             	add    $0x8,%esp
+  8011a0:	6a 01                	push   $0x1
+  8011a2:	6a 00                	push   $0x0
+  8011a4:	e8 9f fa ff ff       	call   800c48 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  8011a9:	e8 7b fa ff ff       	call   800c29 <sys_fork_cow>
+  8011ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  8011b1:	83 c4 10             	add    $0x10,%esp
+  8011b4:	85 c0                	test   %eax,%eax
+  8011b6:	74 2c                	je     8011e4 <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  8011b8:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8011bc:	0f 85 8b 01 00 00    	jne    80134d <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8011c2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011c7:	cd 30                	int    $0x30
+  8011c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8011cc:	85 c0                	test   %eax,%eax
+  8011ce:	78 30                	js     801200 <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  8011d0:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8011d5:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8011da:	74 36                	je     801212 <fork+0x88>
+  8011dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8011df:	e9 99 00 00 00       	jmp    80127d <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8011e4:	e8 02 fa ff ff       	call   800beb <sys_getenvid>
+  8011e9:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8011ee:	c1 e0 09             	shl    $0x9,%eax
+  8011f1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8011f6:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  8011fb:	e9 4d 01 00 00       	jmp    80134d <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  801200:	50                   	push   %eax
+  801201:	68 dd 2e 80 00       	push   $0x802edd
+  801206:	6a 7d                	push   $0x7d
+  801208:	68 9b 2e 80 00       	push   $0x802e9b
+  80120d:	e8 42 ef ff ff       	call   800154 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801212:	e8 d4 f9 ff ff       	call   800beb <sys_getenvid>
+  801217:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80121c:	c1 e0 09             	shl    $0x9,%eax
+  80121f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801224:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801229:	e9 1f 01 00 00       	jmp    80134d <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  80122e:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801235:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801238:	25 07 0e 00 00       	and    $0xe07,%eax
+  80123d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801240:	83 ec 0c             	sub    $0xc,%esp
+  801243:	50                   	push   %eax
+  801244:	56                   	push   %esi
+  801245:	ff 75 e4             	push   -0x1c(%ebp)
+  801248:	56                   	push   %esi
+  801249:	6a 00                	push   $0x0
+  80124b:	e8 c0 fa ff ff       	call   800d10 <sys_page_map>
+  801250:	83 c4 20             	add    $0x20,%esp
+  801253:	85 c0                	test   %eax,%eax
+  801255:	0f 88 98 00 00 00    	js     8012f3 <fork+0x169>
+	if (perm & PTE_COW) {
+  80125b:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801262:	0f 85 61 01 00 00    	jne    8013c9 <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801268:	83 c7 01             	add    $0x1,%edi
+  80126b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801271:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  801277:	0f 84 88 00 00 00    	je     801305 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  80127d:	89 f0                	mov    %esi,%eax
+  80127f:	c1 e8 16             	shr    $0x16,%eax
+  801282:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801289:	25 81 00 00 00       	and    $0x81,%eax
+  80128e:	83 f8 01             	cmp    $0x1,%eax
+  801291:	75 d5                	jne    801268 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  801293:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  80129a:	a8 01                	test   $0x1,%al
+  80129c:	74 ca                	je     801268 <fork+0xde>
+  80129e:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  8012a4:	74 c2                	je     801268 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  8012a6:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  8012a8:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8012af:	f6 c4 04             	test   $0x4,%ah
+  8012b2:	0f 85 76 ff ff ff    	jne    80122e <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  8012b8:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8012bf:	a8 02                	test   $0x2,%al
+  8012c1:	0f 85 dc 00 00 00    	jne    8013a3 <fork+0x219>
+  8012c7:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8012ce:	f6 c4 08             	test   $0x8,%ah
+  8012d1:	0f 85 cc 00 00 00    	jne    8013a3 <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8012d7:	83 ec 0c             	sub    $0xc,%esp
+  8012da:	6a 05                	push   $0x5
+  8012dc:	56                   	push   %esi
+  8012dd:	ff 75 e4             	push   -0x1c(%ebp)
+  8012e0:	56                   	push   %esi
+  8012e1:	6a 00                	push   $0x0
+  8012e3:	e8 28 fa ff ff       	call   800d10 <sys_page_map>
+  8012e8:	83 c4 20             	add    $0x20,%esp
+  8012eb:	85 c0                	test   %eax,%eax
+  8012ed:	0f 89 75 ff ff ff    	jns    801268 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  8012f3:	50                   	push   %eax
+  8012f4:	68 b9 2e 80 00       	push   $0x802eb9
+  8012f9:	6a 48                	push   $0x48
+  8012fb:	68 9b 2e 80 00       	push   $0x802e9b
+  801300:	e8 4f ee ff ff       	call   800154 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  801305:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  801308:	83 ec 04             	sub    $0x4,%esp
+  80130b:	6a 07                	push   $0x7
+  80130d:	68 00 f0 bf ee       	push   $0xeebff000
+  801312:	53                   	push   %ebx
+  801313:	e8 72 f9 ff ff       	call   800c8a <sys_page_alloc>
+  801318:	83 c4 10             	add    $0x10,%esp
+  80131b:	85 c0                	test   %eax,%eax
+  80131d:	78 39                	js     801358 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  80131f:	a1 08 50 80 00       	mov    0x805008,%eax
+  801324:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  80132a:	83 ec 08             	sub    $0x8,%esp
+  80132d:	50                   	push   %eax
+  80132e:	53                   	push   %ebx
+  80132f:	e8 51 fc ff ff       	call   800f85 <sys_env_set_pgfault_upcall>
+  801334:	83 c4 10             	add    $0x10,%esp
+  801337:	85 c0                	test   %eax,%eax
+  801339:	78 36                	js     801371 <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80133b:	83 ec 08             	sub    $0x8,%esp
+  80133e:	6a 02                	push   $0x2
+  801340:	53                   	push   %ebx
+  801341:	e8 18 fb ff ff       	call   800e5e <sys_env_set_status>
+  801346:	83 c4 10             	add    $0x10,%esp
+  801349:	85 c0                	test   %eax,%eax
+  80134b:	78 3d                	js     80138a <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  80134d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801350:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801353:	5b                   	pop    %ebx
+  801354:	5e                   	pop    %esi
+  801355:	5f                   	pop    %edi
+  801356:	5d                   	pop    %ebp
+  801357:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  801358:	83 ec 0c             	sub    $0xc,%esp
+  80135b:	53                   	push   %ebx
+  80135c:	50                   	push   %eax
+  80135d:	68 04 2f 80 00       	push   $0x802f04
+  801362:	68 92 00 00 00       	push   $0x92
+  801367:	68 9b 2e 80 00       	push   $0x802e9b
+  80136c:	e8 e3 ed ff ff       	call   800154 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  801371:	83 ec 0c             	sub    $0xc,%esp
+  801374:	53                   	push   %ebx
+  801375:	50                   	push   %eax
+  801376:	68 28 2f 80 00       	push   $0x802f28
+  80137b:	68 95 00 00 00       	push   $0x95
+  801380:	68 9b 2e 80 00       	push   $0x802e9b
+  801385:	e8 ca ed ff ff       	call   800154 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  80138a:	83 ec 0c             	sub    $0xc,%esp
+  80138d:	53                   	push   %ebx
+  80138e:	50                   	push   %eax
+  80138f:	68 58 2f 80 00       	push   $0x802f58
+  801394:	68 98 00 00 00       	push   $0x98
+  801399:	68 9b 2e 80 00       	push   $0x802e9b
+  80139e:	e8 b1 ed ff ff       	call   800154 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8013a3:	83 ec 0c             	sub    $0xc,%esp
+  8013a6:	68 05 08 00 00       	push   $0x805
+  8013ab:	53                   	push   %ebx
+  8013ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8013af:	53                   	push   %ebx
+  8013b0:	6a 00                	push   $0x0
+  8013b2:	e8 59 f9 ff ff       	call   800d10 <sys_page_map>
+  8013b7:	83 c4 20             	add    $0x20,%esp
+  8013ba:	85 c0                	test   %eax,%eax
+  8013bc:	0f 88 31 ff ff ff    	js     8012f3 <fork+0x169>
+		perm |= PTE_COW;
+  8013c2:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  8013c9:	83 ec 0c             	sub    $0xc,%esp
+  8013cc:	ff 75 e0             	push   -0x20(%ebp)
+  8013cf:	53                   	push   %ebx
+  8013d0:	6a 00                	push   $0x0
+  8013d2:	53                   	push   %ebx
+  8013d3:	6a 00                	push   $0x0
+  8013d5:	e8 36 f9 ff ff       	call   800d10 <sys_page_map>
+  8013da:	83 c4 20             	add    $0x20,%esp
+  8013dd:	85 c0                	test   %eax,%eax
+  8013df:	0f 89 83 fe ff ff    	jns    801268 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  8013e5:	50                   	push   %eax
+  8013e6:	68 b9 2e 80 00       	push   $0x802eb9
+  8013eb:	6a 4c                	push   $0x4c
+  8013ed:	68 9b 2e 80 00       	push   $0x802e9b
+  8013f2:	e8 5d ed ff ff       	call   800154 <_panic>
+
+008013f7 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8013fd:	68 ed 2e 80 00       	push   $0x802eed
+  801402:	68 a0 00 00 00       	push   $0xa0
+  801407:	68 9b 2e 80 00       	push   $0x802e9b
+  80140c:	e8 43 ed ff ff       	call   800154 <_panic>
+
+00801411 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801411:	55                   	push   %ebp
+  801412:	89 e5                	mov    %esp,%ebp
+  801414:	57                   	push   %edi
+  801415:	56                   	push   %esi
+  801416:	53                   	push   %ebx
+  801417:	83 ec 18             	sub    $0x18,%esp
+  80141a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80141d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801420:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801423:	85 db                	test   %ebx,%ebx
+  801425:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80142a:	0f 45 c3             	cmovne %ebx,%eax
+  80142d:	50                   	push   %eax
+  80142e:	e8 da fb ff ff       	call   80100d <sys_ipc_recv>
+
+	if (from_env_store)
+  801433:	83 c4 10             	add    $0x10,%esp
+  801436:	85 ff                	test   %edi,%edi
+  801438:	74 17                	je     801451 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80143a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	75 0c                	jne    80144f <ipc_recv+0x3e>
+  801443:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  801449:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  80144f:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  801451:	85 f6                	test   %esi,%esi
+  801453:	74 2e                	je     801483 <ipc_recv+0x72>
+		if (!r && pg)
+  801455:	85 c0                	test   %eax,%eax
+  801457:	75 24                	jne    80147d <ipc_recv+0x6c>
+  801459:	85 db                	test   %ebx,%ebx
+  80145b:	74 20                	je     80147d <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  80145d:	a1 08 50 80 00       	mov    0x805008,%eax
+  801462:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  801468:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80146a:	a1 08 50 80 00       	mov    0x805008,%eax
+  80146f:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  801475:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801478:	5b                   	pop    %ebx
+  801479:	5e                   	pop    %esi
+  80147a:	5f                   	pop    %edi
+  80147b:	5d                   	pop    %ebp
+  80147c:	c3                   	ret
+			*perm_store = 0;
+  80147d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  801483:	85 c0                	test   %eax,%eax
+  801485:	75 ee                	jne    801475 <ipc_recv+0x64>
+  801487:	eb e1                	jmp    80146a <ipc_recv+0x59>
+
+00801489 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801489:	55                   	push   %ebp
+  80148a:	89 e5                	mov    %esp,%ebp
+  80148c:	57                   	push   %edi
+  80148d:	56                   	push   %esi
+  80148e:	53                   	push   %ebx
+  80148f:	83 ec 0c             	sub    $0xc,%esp
+  801492:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801495:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801498:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80149b:	85 db                	test   %ebx,%ebx
+  80149d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014a2:	0f 44 d8             	cmove  %eax,%ebx
+  8014a5:	ff 75 14             	push   0x14(%ebp)
+  8014a8:	53                   	push   %ebx
+  8014a9:	56                   	push   %esi
+  8014aa:	57                   	push   %edi
+  8014ab:	e8 3a fb ff ff       	call   800fea <sys_ipc_try_send_yield>
+  8014b0:	83 c4 10             	add    $0x10,%esp
+  8014b3:	85 c0                	test   %eax,%eax
+  8014b5:	79 1e                	jns    8014d5 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8014b7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8014ba:	75 07                	jne    8014c3 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8014bc:	e8 49 f7 ff ff       	call   800c0a <sys_yield>
+  8014c1:	eb e2                	jmp    8014a5 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8014c3:	50                   	push   %eax
+  8014c4:	68 7e 2f 80 00       	push   $0x802f7e
+  8014c9:	6a 3d                	push   $0x3d
+  8014cb:	68 93 2f 80 00       	push   $0x802f93
+  8014d0:	e8 7f ec ff ff       	call   800154 <_panic>
+	}
+}
+  8014d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d8:	5b                   	pop    %ebx
+  8014d9:	5e                   	pop    %esi
+  8014da:	5f                   	pop    %edi
+  8014db:	5d                   	pop    %ebp
+  8014dc:	c3                   	ret
+
+008014dd <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8014dd:	55                   	push   %ebp
+  8014de:	89 e5                	mov    %esp,%ebp
+  8014e0:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8014e3:	ff 75 08             	push   0x8(%ebp)
+  8014e6:	e8 9f f6 ff ff       	call   800b8a <sys_env_find>
+}
+  8014eb:	c9                   	leave
+  8014ec:	c3                   	ret
+
+008014ed <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014f8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014fb:	5d                   	pop    %ebp
+  8014fc:	c3                   	ret
+
+008014fd <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801500:	8b 45 08             	mov    0x8(%ebp),%eax
+  801503:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801508:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80150d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801512:	5d                   	pop    %ebp
+  801513:	c3                   	ret
+
+00801514 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801514:	55                   	push   %ebp
+  801515:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801517:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80151c:	eb 02                	jmp    801520 <fd_alloc+0xc>
+  80151e:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801520:	89 c2                	mov    %eax,%edx
+  801522:	c1 ea 16             	shr    $0x16,%edx
+  801525:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80152c:	f6 c2 01             	test   $0x1,%dl
+  80152f:	74 2b                	je     80155c <fd_alloc+0x48>
+  801531:	89 c2                	mov    %eax,%edx
+  801533:	c1 ea 0c             	shr    $0xc,%edx
+  801536:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80153d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801543:	f6 c1 01             	test   $0x1,%cl
+  801546:	74 14                	je     80155c <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801548:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80154e:	75 ce                	jne    80151e <fd_alloc+0xa>
+  801550:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801555:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80155a:	eb 05                	jmp    801561 <fd_alloc+0x4d>
+			return 0;
+  80155c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801561:	8b 55 08             	mov    0x8(%ebp),%edx
+  801564:	89 02                	mov    %eax,(%edx)
+}
+  801566:	89 c8                	mov    %ecx,%eax
+  801568:	5d                   	pop    %ebp
+  801569:	c3                   	ret
+
+0080156a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80156a:	55                   	push   %ebp
+  80156b:	89 e5                	mov    %esp,%ebp
+  80156d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801570:	83 f8 1f             	cmp    $0x1f,%eax
+  801573:	77 30                	ja     8015a5 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801575:	c1 e0 0c             	shl    $0xc,%eax
+  801578:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80157d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801583:	f6 c2 01             	test   $0x1,%dl
+  801586:	74 24                	je     8015ac <fd_lookup+0x42>
+  801588:	89 c2                	mov    %eax,%edx
+  80158a:	c1 ea 0c             	shr    $0xc,%edx
+  80158d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801594:	f6 c2 01             	test   $0x1,%dl
+  801597:	74 1a                	je     8015b3 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801599:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80159c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80159e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015a3:	5d                   	pop    %ebp
+  8015a4:	c3                   	ret
+		return -E_INVAL;
+  8015a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015aa:	eb f7                	jmp    8015a3 <fd_lookup+0x39>
+		return -E_INVAL;
+  8015ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b1:	eb f0                	jmp    8015a3 <fd_lookup+0x39>
+  8015b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b8:	eb e9                	jmp    8015a3 <fd_lookup+0x39>
+
+008015ba <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015ba:	55                   	push   %ebp
+  8015bb:	89 e5                	mov    %esp,%ebp
+  8015bd:	53                   	push   %ebx
+  8015be:	83 ec 04             	sub    $0x4,%esp
+  8015c1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c9:	eb 03                	jmp    8015ce <dev_lookup+0x14>
+  8015cb:	83 c0 01             	add    $0x1,%eax
+  8015ce:	8b 1c 85 1c 30 80 00 	mov    0x80301c(,%eax,4),%ebx
+  8015d5:	85 db                	test   %ebx,%ebx
+  8015d7:	74 0b                	je     8015e4 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8015d9:	39 13                	cmp    %edx,(%ebx)
+  8015db:	75 ee                	jne    8015cb <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8015dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e2:	eb 1f                	jmp    801603 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015e4:	a1 08 50 80 00       	mov    0x805008,%eax
+  8015e9:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8015ec:	83 ec 04             	sub    $0x4,%esp
+  8015ef:	52                   	push   %edx
+  8015f0:	50                   	push   %eax
+  8015f1:	68 a0 2f 80 00       	push   $0x802fa0
+  8015f6:	e8 34 ec ff ff       	call   80022f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015fb:	83 c4 10             	add    $0x10,%esp
+  8015fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801603:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801606:	89 1a                	mov    %ebx,(%edx)
+}
+  801608:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80160b:	c9                   	leave
+  80160c:	c3                   	ret
+
+0080160d <fd_close>:
+{
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	57                   	push   %edi
+  801611:	56                   	push   %esi
+  801612:	53                   	push   %ebx
+  801613:	83 ec 24             	sub    $0x24,%esp
+  801616:	8b 75 08             	mov    0x8(%ebp),%esi
+  801619:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80161c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80161f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801620:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801626:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801629:	50                   	push   %eax
+  80162a:	e8 3b ff ff ff       	call   80156a <fd_lookup>
+  80162f:	89 c3                	mov    %eax,%ebx
+  801631:	83 c4 10             	add    $0x10,%esp
+  801634:	85 c0                	test   %eax,%eax
+  801636:	78 05                	js     80163d <fd_close+0x30>
+	    || fd != fd2)
+  801638:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80163b:	74 16                	je     801653 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80163d:	89 f8                	mov    %edi,%eax
+  80163f:	84 c0                	test   %al,%al
+  801641:	b8 00 00 00 00       	mov    $0x0,%eax
+  801646:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801649:	89 d8                	mov    %ebx,%eax
+  80164b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164e:	5b                   	pop    %ebx
+  80164f:	5e                   	pop    %esi
+  801650:	5f                   	pop    %edi
+  801651:	5d                   	pop    %ebp
+  801652:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801653:	83 ec 08             	sub    $0x8,%esp
+  801656:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801659:	50                   	push   %eax
+  80165a:	ff 36                	push   (%esi)
+  80165c:	e8 59 ff ff ff       	call   8015ba <dev_lookup>
+  801661:	89 c3                	mov    %eax,%ebx
+  801663:	83 c4 10             	add    $0x10,%esp
+  801666:	85 c0                	test   %eax,%eax
+  801668:	78 1a                	js     801684 <fd_close+0x77>
+		if (dev->dev_close)
+  80166a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80166d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801670:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801675:	85 c0                	test   %eax,%eax
+  801677:	74 0b                	je     801684 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801679:	83 ec 0c             	sub    $0xc,%esp
+  80167c:	56                   	push   %esi
+  80167d:	ff d0                	call   *%eax
+  80167f:	89 c3                	mov    %eax,%ebx
+  801681:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801684:	83 ec 08             	sub    $0x8,%esp
+  801687:	56                   	push   %esi
+  801688:	6a 00                	push   $0x0
+  80168a:	e8 c3 f6 ff ff       	call   800d52 <sys_page_unmap>
+	return r;
+  80168f:	83 c4 10             	add    $0x10,%esp
+  801692:	eb b5                	jmp    801649 <fd_close+0x3c>
+
+00801694 <close>:
+
+int
+close(int fdnum)
+{
+  801694:	55                   	push   %ebp
+  801695:	89 e5                	mov    %esp,%ebp
+  801697:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80169a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80169d:	50                   	push   %eax
+  80169e:	ff 75 08             	push   0x8(%ebp)
+  8016a1:	e8 c4 fe ff ff       	call   80156a <fd_lookup>
+  8016a6:	83 c4 10             	add    $0x10,%esp
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	79 02                	jns    8016af <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016ad:	c9                   	leave
+  8016ae:	c3                   	ret
+		return fd_close(fd, 1);
+  8016af:	83 ec 08             	sub    $0x8,%esp
+  8016b2:	6a 01                	push   $0x1
+  8016b4:	ff 75 f4             	push   -0xc(%ebp)
+  8016b7:	e8 51 ff ff ff       	call   80160d <fd_close>
+  8016bc:	83 c4 10             	add    $0x10,%esp
+  8016bf:	eb ec                	jmp    8016ad <close+0x19>
+
+008016c1 <close_all>:
+
+void
+close_all(void)
+{
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	53                   	push   %ebx
+  8016c5:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8016c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8016cd:	83 ec 0c             	sub    $0xc,%esp
+  8016d0:	53                   	push   %ebx
+  8016d1:	e8 be ff ff ff       	call   801694 <close>
+	for (i = 0; i < MAXFD; i++)
+  8016d6:	83 c3 01             	add    $0x1,%ebx
+  8016d9:	83 c4 10             	add    $0x10,%esp
+  8016dc:	83 fb 20             	cmp    $0x20,%ebx
+  8016df:	75 ec                	jne    8016cd <close_all+0xc>
+}
+  8016e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+
+008016e6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016e6:	55                   	push   %ebp
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	57                   	push   %edi
+  8016ea:	56                   	push   %esi
+  8016eb:	53                   	push   %ebx
+  8016ec:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016ef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016f2:	50                   	push   %eax
+  8016f3:	ff 75 08             	push   0x8(%ebp)
+  8016f6:	e8 6f fe ff ff       	call   80156a <fd_lookup>
+  8016fb:	89 c3                	mov    %eax,%ebx
+  8016fd:	83 c4 10             	add    $0x10,%esp
+  801700:	85 c0                	test   %eax,%eax
+  801702:	78 7f                	js     801783 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801704:	83 ec 0c             	sub    $0xc,%esp
+  801707:	ff 75 0c             	push   0xc(%ebp)
+  80170a:	e8 85 ff ff ff       	call   801694 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80170f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801712:	c1 e6 0c             	shl    $0xc,%esi
+  801715:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80171b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80171e:	89 3c 24             	mov    %edi,(%esp)
+  801721:	e8 d7 fd ff ff       	call   8014fd <fd2data>
+  801726:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801728:	89 34 24             	mov    %esi,(%esp)
+  80172b:	e8 cd fd ff ff       	call   8014fd <fd2data>
+  801730:	83 c4 10             	add    $0x10,%esp
+  801733:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801736:	89 d8                	mov    %ebx,%eax
+  801738:	c1 e8 16             	shr    $0x16,%eax
+  80173b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801742:	a8 01                	test   $0x1,%al
+  801744:	74 11                	je     801757 <dup+0x71>
+  801746:	89 d8                	mov    %ebx,%eax
+  801748:	c1 e8 0c             	shr    $0xc,%eax
+  80174b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801752:	f6 c2 01             	test   $0x1,%dl
+  801755:	75 36                	jne    80178d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801757:	89 f8                	mov    %edi,%eax
+  801759:	c1 e8 0c             	shr    $0xc,%eax
+  80175c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801763:	83 ec 0c             	sub    $0xc,%esp
+  801766:	25 07 0e 00 00       	and    $0xe07,%eax
+  80176b:	50                   	push   %eax
+  80176c:	56                   	push   %esi
+  80176d:	6a 00                	push   $0x0
+  80176f:	57                   	push   %edi
+  801770:	6a 00                	push   $0x0
+  801772:	e8 99 f5 ff ff       	call   800d10 <sys_page_map>
+  801777:	89 c3                	mov    %eax,%ebx
+  801779:	83 c4 20             	add    $0x20,%esp
+  80177c:	85 c0                	test   %eax,%eax
+  80177e:	78 33                	js     8017b3 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801780:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801783:	89 d8                	mov    %ebx,%eax
+  801785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801788:	5b                   	pop    %ebx
+  801789:	5e                   	pop    %esi
+  80178a:	5f                   	pop    %edi
+  80178b:	5d                   	pop    %ebp
+  80178c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80178d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801794:	83 ec 0c             	sub    $0xc,%esp
+  801797:	25 07 0e 00 00       	and    $0xe07,%eax
+  80179c:	50                   	push   %eax
+  80179d:	ff 75 d4             	push   -0x2c(%ebp)
+  8017a0:	6a 00                	push   $0x0
+  8017a2:	53                   	push   %ebx
+  8017a3:	6a 00                	push   $0x0
+  8017a5:	e8 66 f5 ff ff       	call   800d10 <sys_page_map>
+  8017aa:	89 c3                	mov    %eax,%ebx
+  8017ac:	83 c4 20             	add    $0x20,%esp
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	79 a4                	jns    801757 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8017b3:	83 ec 08             	sub    $0x8,%esp
+  8017b6:	56                   	push   %esi
+  8017b7:	6a 00                	push   $0x0
+  8017b9:	e8 94 f5 ff ff       	call   800d52 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017be:	83 c4 08             	add    $0x8,%esp
+  8017c1:	ff 75 d4             	push   -0x2c(%ebp)
+  8017c4:	6a 00                	push   $0x0
+  8017c6:	e8 87 f5 ff ff       	call   800d52 <sys_page_unmap>
+	return r;
+  8017cb:	83 c4 10             	add    $0x10,%esp
+  8017ce:	eb b3                	jmp    801783 <dup+0x9d>
+
+008017d0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8017d0:	55                   	push   %ebp
+  8017d1:	89 e5                	mov    %esp,%ebp
+  8017d3:	56                   	push   %esi
+  8017d4:	53                   	push   %ebx
+  8017d5:	83 ec 18             	sub    $0x18,%esp
+  8017d8:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017de:	50                   	push   %eax
+  8017df:	56                   	push   %esi
+  8017e0:	e8 85 fd ff ff       	call   80156a <fd_lookup>
+  8017e5:	83 c4 10             	add    $0x10,%esp
+  8017e8:	85 c0                	test   %eax,%eax
+  8017ea:	78 3c                	js     801828 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017ec:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017ef:	83 ec 08             	sub    $0x8,%esp
+  8017f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f5:	50                   	push   %eax
+  8017f6:	ff 33                	push   (%ebx)
+  8017f8:	e8 bd fd ff ff       	call   8015ba <dev_lookup>
+  8017fd:	83 c4 10             	add    $0x10,%esp
+  801800:	85 c0                	test   %eax,%eax
+  801802:	78 24                	js     801828 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801804:	8b 43 08             	mov    0x8(%ebx),%eax
+  801807:	83 e0 03             	and    $0x3,%eax
+  80180a:	83 f8 01             	cmp    $0x1,%eax
+  80180d:	74 20                	je     80182f <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80180f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801812:	8b 40 08             	mov    0x8(%eax),%eax
+  801815:	85 c0                	test   %eax,%eax
+  801817:	74 37                	je     801850 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801819:	83 ec 04             	sub    $0x4,%esp
+  80181c:	ff 75 10             	push   0x10(%ebp)
+  80181f:	ff 75 0c             	push   0xc(%ebp)
+  801822:	53                   	push   %ebx
+  801823:	ff d0                	call   *%eax
+  801825:	83 c4 10             	add    $0x10,%esp
+}
+  801828:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182b:	5b                   	pop    %ebx
+  80182c:	5e                   	pop    %esi
+  80182d:	5d                   	pop    %ebp
+  80182e:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80182f:	a1 08 50 80 00       	mov    0x805008,%eax
+  801834:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801837:	83 ec 04             	sub    $0x4,%esp
+  80183a:	56                   	push   %esi
+  80183b:	50                   	push   %eax
+  80183c:	68 e1 2f 80 00       	push   $0x802fe1
+  801841:	e8 e9 e9 ff ff       	call   80022f <cprintf>
+		return -E_INVAL;
+  801846:	83 c4 10             	add    $0x10,%esp
+  801849:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184e:	eb d8                	jmp    801828 <read+0x58>
+		return -E_NOT_SUPP;
+  801850:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801855:	eb d1                	jmp    801828 <read+0x58>
+
+00801857 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801857:	55                   	push   %ebp
+  801858:	89 e5                	mov    %esp,%ebp
+  80185a:	57                   	push   %edi
+  80185b:	56                   	push   %esi
+  80185c:	53                   	push   %ebx
+  80185d:	83 ec 0c             	sub    $0xc,%esp
+  801860:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801863:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801866:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186b:	eb 02                	jmp    80186f <readn+0x18>
+  80186d:	01 c3                	add    %eax,%ebx
+  80186f:	39 f3                	cmp    %esi,%ebx
+  801871:	73 21                	jae    801894 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801873:	83 ec 04             	sub    $0x4,%esp
+  801876:	89 f0                	mov    %esi,%eax
+  801878:	29 d8                	sub    %ebx,%eax
+  80187a:	50                   	push   %eax
+  80187b:	89 d8                	mov    %ebx,%eax
+  80187d:	03 45 0c             	add    0xc(%ebp),%eax
+  801880:	50                   	push   %eax
+  801881:	57                   	push   %edi
+  801882:	e8 49 ff ff ff       	call   8017d0 <read>
+		if (m < 0)
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	85 c0                	test   %eax,%eax
+  80188c:	78 04                	js     801892 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80188e:	75 dd                	jne    80186d <readn+0x16>
+  801890:	eb 02                	jmp    801894 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801892:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801894:	89 d8                	mov    %ebx,%eax
+  801896:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801899:	5b                   	pop    %ebx
+  80189a:	5e                   	pop    %esi
+  80189b:	5f                   	pop    %edi
+  80189c:	5d                   	pop    %ebp
+  80189d:	c3                   	ret
+
+0080189e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80189e:	55                   	push   %ebp
+  80189f:	89 e5                	mov    %esp,%ebp
+  8018a1:	56                   	push   %esi
+  8018a2:	53                   	push   %ebx
+  8018a3:	83 ec 18             	sub    $0x18,%esp
+  8018a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018a9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ac:	50                   	push   %eax
+  8018ad:	53                   	push   %ebx
+  8018ae:	e8 b7 fc ff ff       	call   80156a <fd_lookup>
+  8018b3:	83 c4 10             	add    $0x10,%esp
+  8018b6:	85 c0                	test   %eax,%eax
+  8018b8:	78 37                	js     8018f1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018ba:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018bd:	83 ec 08             	sub    $0x8,%esp
+  8018c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c3:	50                   	push   %eax
+  8018c4:	ff 36                	push   (%esi)
+  8018c6:	e8 ef fc ff ff       	call   8015ba <dev_lookup>
+  8018cb:	83 c4 10             	add    $0x10,%esp
+  8018ce:	85 c0                	test   %eax,%eax
+  8018d0:	78 1f                	js     8018f1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018d2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018d6:	74 20                	je     8018f8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8018d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018db:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018de:	85 c0                	test   %eax,%eax
+  8018e0:	74 37                	je     801919 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018e2:	83 ec 04             	sub    $0x4,%esp
+  8018e5:	ff 75 10             	push   0x10(%ebp)
+  8018e8:	ff 75 0c             	push   0xc(%ebp)
+  8018eb:	56                   	push   %esi
+  8018ec:	ff d0                	call   *%eax
+  8018ee:	83 c4 10             	add    $0x10,%esp
+}
+  8018f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018f4:	5b                   	pop    %ebx
+  8018f5:	5e                   	pop    %esi
+  8018f6:	5d                   	pop    %ebp
+  8018f7:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018f8:	a1 08 50 80 00       	mov    0x805008,%eax
+  8018fd:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801900:	83 ec 04             	sub    $0x4,%esp
+  801903:	53                   	push   %ebx
+  801904:	50                   	push   %eax
+  801905:	68 fd 2f 80 00       	push   $0x802ffd
+  80190a:	e8 20 e9 ff ff       	call   80022f <cprintf>
+		return -E_INVAL;
+  80190f:	83 c4 10             	add    $0x10,%esp
+  801912:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801917:	eb d8                	jmp    8018f1 <write+0x53>
+		return -E_NOT_SUPP;
+  801919:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80191e:	eb d1                	jmp    8018f1 <write+0x53>
+
+00801920 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801920:	55                   	push   %ebp
+  801921:	89 e5                	mov    %esp,%ebp
+  801923:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801926:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801929:	50                   	push   %eax
+  80192a:	ff 75 08             	push   0x8(%ebp)
+  80192d:	e8 38 fc ff ff       	call   80156a <fd_lookup>
+  801932:	83 c4 10             	add    $0x10,%esp
+  801935:	85 c0                	test   %eax,%eax
+  801937:	78 0e                	js     801947 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801939:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80193c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80193f:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801942:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801947:	c9                   	leave
+  801948:	c3                   	ret
+
+00801949 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	56                   	push   %esi
+  80194d:	53                   	push   %ebx
+  80194e:	83 ec 18             	sub    $0x18,%esp
+  801951:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801954:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801957:	50                   	push   %eax
+  801958:	53                   	push   %ebx
+  801959:	e8 0c fc ff ff       	call   80156a <fd_lookup>
+  80195e:	83 c4 10             	add    $0x10,%esp
+  801961:	85 c0                	test   %eax,%eax
+  801963:	78 34                	js     801999 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801965:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801968:	83 ec 08             	sub    $0x8,%esp
+  80196b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80196e:	50                   	push   %eax
+  80196f:	ff 36                	push   (%esi)
+  801971:	e8 44 fc ff ff       	call   8015ba <dev_lookup>
+  801976:	83 c4 10             	add    $0x10,%esp
+  801979:	85 c0                	test   %eax,%eax
+  80197b:	78 1c                	js     801999 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80197d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801981:	74 1d                	je     8019a0 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801983:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801986:	8b 40 18             	mov    0x18(%eax),%eax
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	74 34                	je     8019c1 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80198d:	83 ec 08             	sub    $0x8,%esp
+  801990:	ff 75 0c             	push   0xc(%ebp)
+  801993:	56                   	push   %esi
+  801994:	ff d0                	call   *%eax
+  801996:	83 c4 10             	add    $0x10,%esp
+}
+  801999:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80199c:	5b                   	pop    %ebx
+  80199d:	5e                   	pop    %esi
+  80199e:	5d                   	pop    %ebp
+  80199f:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8019a0:	a1 08 50 80 00       	mov    0x805008,%eax
+  8019a5:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019a8:	83 ec 04             	sub    $0x4,%esp
+  8019ab:	53                   	push   %ebx
+  8019ac:	50                   	push   %eax
+  8019ad:	68 c0 2f 80 00       	push   $0x802fc0
+  8019b2:	e8 78 e8 ff ff       	call   80022f <cprintf>
+		return -E_INVAL;
+  8019b7:	83 c4 10             	add    $0x10,%esp
+  8019ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019bf:	eb d8                	jmp    801999 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8019c1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019c6:	eb d1                	jmp    801999 <ftruncate+0x50>
+
+008019c8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8019c8:	55                   	push   %ebp
+  8019c9:	89 e5                	mov    %esp,%ebp
+  8019cb:	56                   	push   %esi
+  8019cc:	53                   	push   %ebx
+  8019cd:	83 ec 18             	sub    $0x18,%esp
+  8019d0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019d3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019d6:	50                   	push   %eax
+  8019d7:	ff 75 08             	push   0x8(%ebp)
+  8019da:	e8 8b fb ff ff       	call   80156a <fd_lookup>
+  8019df:	83 c4 10             	add    $0x10,%esp
+  8019e2:	85 c0                	test   %eax,%eax
+  8019e4:	78 49                	js     801a2f <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019e6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019e9:	83 ec 08             	sub    $0x8,%esp
+  8019ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ef:	50                   	push   %eax
+  8019f0:	ff 36                	push   (%esi)
+  8019f2:	e8 c3 fb ff ff       	call   8015ba <dev_lookup>
+  8019f7:	83 c4 10             	add    $0x10,%esp
+  8019fa:	85 c0                	test   %eax,%eax
+  8019fc:	78 31                	js     801a2f <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8019fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a01:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a05:	74 2f                	je     801a36 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a07:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a0a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a11:	00 00 00 
+	stat->st_isdir = 0;
+  801a14:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a1b:	00 00 00 
+	stat->st_dev = dev;
+  801a1e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a24:	83 ec 08             	sub    $0x8,%esp
+  801a27:	53                   	push   %ebx
+  801a28:	56                   	push   %esi
+  801a29:	ff 50 14             	call   *0x14(%eax)
+  801a2c:	83 c4 10             	add    $0x10,%esp
+}
+  801a2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a32:	5b                   	pop    %ebx
+  801a33:	5e                   	pop    %esi
+  801a34:	5d                   	pop    %ebp
+  801a35:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a36:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a3b:	eb f2                	jmp    801a2f <fstat+0x67>
+
+00801a3d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a3d:	55                   	push   %ebp
+  801a3e:	89 e5                	mov    %esp,%ebp
+  801a40:	56                   	push   %esi
+  801a41:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a42:	83 ec 08             	sub    $0x8,%esp
+  801a45:	6a 00                	push   $0x0
+  801a47:	ff 75 08             	push   0x8(%ebp)
+  801a4a:	e8 e4 01 00 00       	call   801c33 <open>
+  801a4f:	89 c3                	mov    %eax,%ebx
+  801a51:	83 c4 10             	add    $0x10,%esp
+  801a54:	85 c0                	test   %eax,%eax
+  801a56:	78 1b                	js     801a73 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801a58:	83 ec 08             	sub    $0x8,%esp
+  801a5b:	ff 75 0c             	push   0xc(%ebp)
+  801a5e:	50                   	push   %eax
+  801a5f:	e8 64 ff ff ff       	call   8019c8 <fstat>
+  801a64:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a66:	89 1c 24             	mov    %ebx,(%esp)
+  801a69:	e8 26 fc ff ff       	call   801694 <close>
+	return r;
+  801a6e:	83 c4 10             	add    $0x10,%esp
+  801a71:	89 f3                	mov    %esi,%ebx
+}
+  801a73:	89 d8                	mov    %ebx,%eax
+  801a75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a78:	5b                   	pop    %ebx
+  801a79:	5e                   	pop    %esi
+  801a7a:	5d                   	pop    %ebp
+  801a7b:	c3                   	ret
+
+00801a7c <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a7c:	55                   	push   %ebp
+  801a7d:	89 e5                	mov    %esp,%ebp
+  801a7f:	56                   	push   %esi
+  801a80:	53                   	push   %ebx
+  801a81:	89 c6                	mov    %eax,%esi
+  801a83:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801a85:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801a8c:	74 27                	je     801ab5 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a8e:	6a 07                	push   $0x7
+  801a90:	68 00 60 80 00       	push   $0x806000
+  801a95:	56                   	push   %esi
+  801a96:	ff 35 00 50 80 00    	push   0x805000
+  801a9c:	e8 e8 f9 ff ff       	call   801489 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801aa1:	83 c4 0c             	add    $0xc,%esp
+  801aa4:	6a 00                	push   $0x0
+  801aa6:	53                   	push   %ebx
+  801aa7:	6a 00                	push   $0x0
+  801aa9:	e8 63 f9 ff ff       	call   801411 <ipc_recv>
+}
+  801aae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab1:	5b                   	pop    %ebx
+  801ab2:	5e                   	pop    %esi
+  801ab3:	5d                   	pop    %ebp
+  801ab4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ab5:	83 ec 0c             	sub    $0xc,%esp
+  801ab8:	6a 01                	push   $0x1
+  801aba:	e8 1e fa ff ff       	call   8014dd <ipc_find_env>
+  801abf:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ac4:	83 c4 10             	add    $0x10,%esp
+  801ac7:	eb c5                	jmp    801a8e <fsipc+0x12>
+
+00801ac9 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ac9:	55                   	push   %ebp
+  801aca:	89 e5                	mov    %esp,%ebp
+  801acc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801acf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ad5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801ada:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801add:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ae2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae7:	b8 02 00 00 00       	mov    $0x2,%eax
+  801aec:	e8 8b ff ff ff       	call   801a7c <fsipc>
+}
+  801af1:	c9                   	leave
+  801af2:	c3                   	ret
+
+00801af3 <devfile_flush>:
+{
+  801af3:	55                   	push   %ebp
+  801af4:	89 e5                	mov    %esp,%ebp
+  801af6:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801afc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aff:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801b04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b09:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b0e:	e8 69 ff ff ff       	call   801a7c <fsipc>
+}
+  801b13:	c9                   	leave
+  801b14:	c3                   	ret
+
+00801b15 <devfile_stat>:
+{
+  801b15:	55                   	push   %ebp
+  801b16:	89 e5                	mov    %esp,%ebp
+  801b18:	53                   	push   %ebx
+  801b19:	83 ec 04             	sub    $0x4,%esp
+  801b1c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b22:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b25:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b34:	e8 43 ff ff ff       	call   801a7c <fsipc>
+  801b39:	85 c0                	test   %eax,%eax
+  801b3b:	78 2c                	js     801b69 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b3d:	83 ec 08             	sub    $0x8,%esp
+  801b40:	68 00 60 80 00       	push   $0x806000
+  801b45:	53                   	push   %ebx
+  801b46:	e8 d2 ec ff ff       	call   80081d <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b4b:	a1 80 60 80 00       	mov    0x806080,%eax
+  801b50:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b56:	a1 84 60 80 00       	mov    0x806084,%eax
+  801b5b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801b61:	83 c4 10             	add    $0x10,%esp
+  801b64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b6c:	c9                   	leave
+  801b6d:	c3                   	ret
+
+00801b6e <devfile_write>:
+{
+  801b6e:	55                   	push   %ebp
+  801b6f:	89 e5                	mov    %esp,%ebp
+  801b71:	83 ec 0c             	sub    $0xc,%esp
+  801b74:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801b77:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801b7c:	39 d0                	cmp    %edx,%eax
+  801b7e:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b81:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b84:	8b 52 0c             	mov    0xc(%edx),%edx
+  801b87:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801b8d:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801b92:	50                   	push   %eax
+  801b93:	ff 75 0c             	push   0xc(%ebp)
+  801b96:	68 08 60 80 00       	push   $0x806008
+  801b9b:	e8 03 ee ff ff       	call   8009a3 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801ba0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba5:	b8 04 00 00 00       	mov    $0x4,%eax
+  801baa:	e8 cd fe ff ff       	call   801a7c <fsipc>
+}
+  801baf:	c9                   	leave
+  801bb0:	c3                   	ret
+
+00801bb1 <devfile_read>:
+{
+  801bb1:	55                   	push   %ebp
+  801bb2:	89 e5                	mov    %esp,%ebp
+  801bb4:	56                   	push   %esi
+  801bb5:	53                   	push   %ebx
+  801bb6:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bbc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bbf:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801bc4:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801bca:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcf:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bd4:	e8 a3 fe ff ff       	call   801a7c <fsipc>
+  801bd9:	89 c3                	mov    %eax,%ebx
+  801bdb:	85 c0                	test   %eax,%eax
+  801bdd:	78 1f                	js     801bfe <devfile_read+0x4d>
+	assert(r <= n);
+  801bdf:	39 c6                	cmp    %eax,%esi
+  801be1:	72 24                	jb     801c07 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801be3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801be8:	7f 33                	jg     801c1d <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801bea:	83 ec 04             	sub    $0x4,%esp
+  801bed:	50                   	push   %eax
+  801bee:	68 00 60 80 00       	push   $0x806000
+  801bf3:	ff 75 0c             	push   0xc(%ebp)
+  801bf6:	e8 a8 ed ff ff       	call   8009a3 <memmove>
+	return r;
+  801bfb:	83 c4 10             	add    $0x10,%esp
+}
+  801bfe:	89 d8                	mov    %ebx,%eax
+  801c00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c03:	5b                   	pop    %ebx
+  801c04:	5e                   	pop    %esi
+  801c05:	5d                   	pop    %ebp
+  801c06:	c3                   	ret
+	assert(r <= n);
+  801c07:	68 30 30 80 00       	push   $0x803030
+  801c0c:	68 37 30 80 00       	push   $0x803037
+  801c11:	6a 7c                	push   $0x7c
+  801c13:	68 4c 30 80 00       	push   $0x80304c
+  801c18:	e8 37 e5 ff ff       	call   800154 <_panic>
+	assert(r <= PGSIZE);
+  801c1d:	68 57 30 80 00       	push   $0x803057
+  801c22:	68 37 30 80 00       	push   $0x803037
+  801c27:	6a 7d                	push   $0x7d
+  801c29:	68 4c 30 80 00       	push   $0x80304c
+  801c2e:	e8 21 e5 ff ff       	call   800154 <_panic>
+
+00801c33 <open>:
+{
+  801c33:	55                   	push   %ebp
+  801c34:	89 e5                	mov    %esp,%ebp
+  801c36:	56                   	push   %esi
+  801c37:	53                   	push   %ebx
+  801c38:	83 ec 1c             	sub    $0x1c,%esp
+  801c3b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801c3e:	56                   	push   %esi
+  801c3f:	e8 9e eb ff ff       	call   8007e2 <strlen>
+  801c44:	83 c4 10             	add    $0x10,%esp
+  801c47:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c4c:	7f 6c                	jg     801cba <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801c4e:	83 ec 0c             	sub    $0xc,%esp
+  801c51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c54:	50                   	push   %eax
+  801c55:	e8 ba f8 ff ff       	call   801514 <fd_alloc>
+  801c5a:	89 c3                	mov    %eax,%ebx
+  801c5c:	83 c4 10             	add    $0x10,%esp
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	78 3c                	js     801c9f <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801c63:	83 ec 08             	sub    $0x8,%esp
+  801c66:	56                   	push   %esi
+  801c67:	68 00 60 80 00       	push   $0x806000
+  801c6c:	e8 ac eb ff ff       	call   80081d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801c71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c74:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801c79:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c7c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c81:	e8 f6 fd ff ff       	call   801a7c <fsipc>
+  801c86:	89 c3                	mov    %eax,%ebx
+  801c88:	83 c4 10             	add    $0x10,%esp
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 19                	js     801ca8 <open+0x75>
+	return fd2num(fd);
+  801c8f:	83 ec 0c             	sub    $0xc,%esp
+  801c92:	ff 75 f4             	push   -0xc(%ebp)
+  801c95:	e8 53 f8 ff ff       	call   8014ed <fd2num>
+  801c9a:	89 c3                	mov    %eax,%ebx
+  801c9c:	83 c4 10             	add    $0x10,%esp
+}
+  801c9f:	89 d8                	mov    %ebx,%eax
+  801ca1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ca4:	5b                   	pop    %ebx
+  801ca5:	5e                   	pop    %esi
+  801ca6:	5d                   	pop    %ebp
+  801ca7:	c3                   	ret
+		fd_close(fd, 0);
+  801ca8:	83 ec 08             	sub    $0x8,%esp
+  801cab:	6a 00                	push   $0x0
+  801cad:	ff 75 f4             	push   -0xc(%ebp)
+  801cb0:	e8 58 f9 ff ff       	call   80160d <fd_close>
+		return r;
+  801cb5:	83 c4 10             	add    $0x10,%esp
+  801cb8:	eb e5                	jmp    801c9f <open+0x6c>
+		return -E_BAD_PATH;
+  801cba:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801cbf:	eb de                	jmp    801c9f <open+0x6c>
+
+00801cc1 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801cc1:	55                   	push   %ebp
+  801cc2:	89 e5                	mov    %esp,%ebp
+  801cc4:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801cc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ccc:	b8 08 00 00 00       	mov    $0x8,%eax
+  801cd1:	e8 a6 fd ff ff       	call   801a7c <fsipc>
+}
+  801cd6:	c9                   	leave
+  801cd7:	c3                   	ret
+
+00801cd8 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cd8:	55                   	push   %ebp
+  801cd9:	89 e5                	mov    %esp,%ebp
+  801cdb:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801cde:	68 63 30 80 00       	push   $0x803063
+  801ce3:	ff 75 0c             	push   0xc(%ebp)
+  801ce6:	e8 32 eb ff ff       	call   80081d <strcpy>
+	return 0;
+}
+  801ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf0:	c9                   	leave
+  801cf1:	c3                   	ret
+
+00801cf2 <devsock_close>:
+{
+  801cf2:	55                   	push   %ebp
+  801cf3:	89 e5                	mov    %esp,%ebp
+  801cf5:	53                   	push   %ebx
+  801cf6:	83 ec 10             	sub    $0x10,%esp
+  801cf9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801cfc:	53                   	push   %ebx
+  801cfd:	e8 8d 09 00 00       	call   80268f <pageref>
+  801d02:	89 c2                	mov    %eax,%edx
+  801d04:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d07:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801d0c:	83 fa 01             	cmp    $0x1,%edx
+  801d0f:	74 05                	je     801d16 <devsock_close+0x24>
+}
+  801d11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d14:	c9                   	leave
+  801d15:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801d16:	83 ec 0c             	sub    $0xc,%esp
+  801d19:	ff 73 0c             	push   0xc(%ebx)
+  801d1c:	e8 b7 02 00 00       	call   801fd8 <nsipc_close>
+  801d21:	83 c4 10             	add    $0x10,%esp
+  801d24:	eb eb                	jmp    801d11 <devsock_close+0x1f>
+
+00801d26 <devsock_write>:
+{
+  801d26:	55                   	push   %ebp
+  801d27:	89 e5                	mov    %esp,%ebp
+  801d29:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801d2c:	6a 00                	push   $0x0
+  801d2e:	ff 75 10             	push   0x10(%ebp)
+  801d31:	ff 75 0c             	push   0xc(%ebp)
+  801d34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d37:	ff 70 0c             	push   0xc(%eax)
+  801d3a:	e8 79 03 00 00       	call   8020b8 <nsipc_send>
+}
+  801d3f:	c9                   	leave
+  801d40:	c3                   	ret
+
+00801d41 <devsock_read>:
+{
+  801d41:	55                   	push   %ebp
+  801d42:	89 e5                	mov    %esp,%ebp
+  801d44:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801d47:	6a 00                	push   $0x0
+  801d49:	ff 75 10             	push   0x10(%ebp)
+  801d4c:	ff 75 0c             	push   0xc(%ebp)
+  801d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d52:	ff 70 0c             	push   0xc(%eax)
+  801d55:	e8 ef 02 00 00       	call   802049 <nsipc_recv>
+}
+  801d5a:	c9                   	leave
+  801d5b:	c3                   	ret
+
+00801d5c <fd2sockid>:
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d62:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d65:	52                   	push   %edx
+  801d66:	50                   	push   %eax
+  801d67:	e8 fe f7 ff ff       	call   80156a <fd_lookup>
+  801d6c:	83 c4 10             	add    $0x10,%esp
+  801d6f:	85 c0                	test   %eax,%eax
+  801d71:	78 10                	js     801d83 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d76:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801d7c:	39 08                	cmp    %ecx,(%eax)
+  801d7e:	75 05                	jne    801d85 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d80:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d83:	c9                   	leave
+  801d84:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d85:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d8a:	eb f7                	jmp    801d83 <fd2sockid+0x27>
+
+00801d8c <alloc_sockfd>:
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	56                   	push   %esi
+  801d90:	53                   	push   %ebx
+  801d91:	83 ec 1c             	sub    $0x1c,%esp
+  801d94:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d96:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d99:	50                   	push   %eax
+  801d9a:	e8 75 f7 ff ff       	call   801514 <fd_alloc>
+  801d9f:	89 c3                	mov    %eax,%ebx
+  801da1:	83 c4 10             	add    $0x10,%esp
+  801da4:	85 c0                	test   %eax,%eax
+  801da6:	78 43                	js     801deb <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801da8:	83 ec 04             	sub    $0x4,%esp
+  801dab:	68 07 04 00 00       	push   $0x407
+  801db0:	ff 75 f4             	push   -0xc(%ebp)
+  801db3:	6a 00                	push   $0x0
+  801db5:	e8 d0 ee ff ff       	call   800c8a <sys_page_alloc>
+  801dba:	89 c3                	mov    %eax,%ebx
+  801dbc:	83 c4 10             	add    $0x10,%esp
+  801dbf:	85 c0                	test   %eax,%eax
+  801dc1:	78 28                	js     801deb <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801dc3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc6:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801dcc:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801dce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dd1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801dd8:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801ddb:	83 ec 0c             	sub    $0xc,%esp
+  801dde:	50                   	push   %eax
+  801ddf:	e8 09 f7 ff ff       	call   8014ed <fd2num>
+  801de4:	89 c3                	mov    %eax,%ebx
+  801de6:	83 c4 10             	add    $0x10,%esp
+  801de9:	eb 0c                	jmp    801df7 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801deb:	83 ec 0c             	sub    $0xc,%esp
+  801dee:	56                   	push   %esi
+  801def:	e8 e4 01 00 00       	call   801fd8 <nsipc_close>
+		return r;
+  801df4:	83 c4 10             	add    $0x10,%esp
+}
+  801df7:	89 d8                	mov    %ebx,%eax
+  801df9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfc:	5b                   	pop    %ebx
+  801dfd:	5e                   	pop    %esi
+  801dfe:	5d                   	pop    %ebp
+  801dff:	c3                   	ret
+
+00801e00 <accept>:
+{
+  801e00:	55                   	push   %ebp
+  801e01:	89 e5                	mov    %esp,%ebp
+  801e03:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e06:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e09:	e8 4e ff ff ff       	call   801d5c <fd2sockid>
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 1b                	js     801e2d <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801e12:	83 ec 04             	sub    $0x4,%esp
+  801e15:	ff 75 10             	push   0x10(%ebp)
+  801e18:	ff 75 0c             	push   0xc(%ebp)
+  801e1b:	50                   	push   %eax
+  801e1c:	e8 0e 01 00 00       	call   801f2f <nsipc_accept>
+  801e21:	83 c4 10             	add    $0x10,%esp
+  801e24:	85 c0                	test   %eax,%eax
+  801e26:	78 05                	js     801e2d <accept+0x2d>
+	return alloc_sockfd(r);
+  801e28:	e8 5f ff ff ff       	call   801d8c <alloc_sockfd>
+}
+  801e2d:	c9                   	leave
+  801e2e:	c3                   	ret
+
+00801e2f <bind>:
+{
+  801e2f:	55                   	push   %ebp
+  801e30:	89 e5                	mov    %esp,%ebp
+  801e32:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e38:	e8 1f ff ff ff       	call   801d5c <fd2sockid>
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	78 12                	js     801e53 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e41:	83 ec 04             	sub    $0x4,%esp
+  801e44:	ff 75 10             	push   0x10(%ebp)
+  801e47:	ff 75 0c             	push   0xc(%ebp)
+  801e4a:	50                   	push   %eax
+  801e4b:	e8 31 01 00 00       	call   801f81 <nsipc_bind>
+  801e50:	83 c4 10             	add    $0x10,%esp
+}
+  801e53:	c9                   	leave
+  801e54:	c3                   	ret
+
+00801e55 <shutdown>:
+{
+  801e55:	55                   	push   %ebp
+  801e56:	89 e5                	mov    %esp,%ebp
+  801e58:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e5e:	e8 f9 fe ff ff       	call   801d5c <fd2sockid>
+  801e63:	85 c0                	test   %eax,%eax
+  801e65:	78 0f                	js     801e76 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e67:	83 ec 08             	sub    $0x8,%esp
+  801e6a:	ff 75 0c             	push   0xc(%ebp)
+  801e6d:	50                   	push   %eax
+  801e6e:	e8 43 01 00 00       	call   801fb6 <nsipc_shutdown>
+  801e73:	83 c4 10             	add    $0x10,%esp
+}
+  801e76:	c9                   	leave
+  801e77:	c3                   	ret
+
+00801e78 <connect>:
+{
+  801e78:	55                   	push   %ebp
+  801e79:	89 e5                	mov    %esp,%ebp
+  801e7b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e81:	e8 d6 fe ff ff       	call   801d5c <fd2sockid>
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	78 12                	js     801e9c <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e8a:	83 ec 04             	sub    $0x4,%esp
+  801e8d:	ff 75 10             	push   0x10(%ebp)
+  801e90:	ff 75 0c             	push   0xc(%ebp)
+  801e93:	50                   	push   %eax
+  801e94:	e8 59 01 00 00       	call   801ff2 <nsipc_connect>
+  801e99:	83 c4 10             	add    $0x10,%esp
+}
+  801e9c:	c9                   	leave
+  801e9d:	c3                   	ret
+
+00801e9e <listen>:
+{
+  801e9e:	55                   	push   %ebp
+  801e9f:	89 e5                	mov    %esp,%ebp
+  801ea1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea7:	e8 b0 fe ff ff       	call   801d5c <fd2sockid>
+  801eac:	85 c0                	test   %eax,%eax
+  801eae:	78 0f                	js     801ebf <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801eb0:	83 ec 08             	sub    $0x8,%esp
+  801eb3:	ff 75 0c             	push   0xc(%ebp)
+  801eb6:	50                   	push   %eax
+  801eb7:	e8 6b 01 00 00       	call   802027 <nsipc_listen>
+  801ebc:	83 c4 10             	add    $0x10,%esp
+}
+  801ebf:	c9                   	leave
+  801ec0:	c3                   	ret
+
+00801ec1 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801ec1:	55                   	push   %ebp
+  801ec2:	89 e5                	mov    %esp,%ebp
+  801ec4:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801ec7:	ff 75 10             	push   0x10(%ebp)
+  801eca:	ff 75 0c             	push   0xc(%ebp)
+  801ecd:	ff 75 08             	push   0x8(%ebp)
+  801ed0:	e8 41 02 00 00       	call   802116 <nsipc_socket>
+  801ed5:	83 c4 10             	add    $0x10,%esp
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	78 05                	js     801ee1 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801edc:	e8 ab fe ff ff       	call   801d8c <alloc_sockfd>
+}
+  801ee1:	c9                   	leave
+  801ee2:	c3                   	ret
+
+00801ee3 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801ee3:	55                   	push   %ebp
+  801ee4:	89 e5                	mov    %esp,%ebp
+  801ee6:	53                   	push   %ebx
+  801ee7:	83 ec 04             	sub    $0x4,%esp
+  801eea:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801eec:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801ef3:	74 26                	je     801f1b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801ef5:	6a 07                	push   $0x7
+  801ef7:	68 00 70 80 00       	push   $0x807000
+  801efc:	53                   	push   %ebx
+  801efd:	ff 35 04 50 80 00    	push   0x805004
+  801f03:	e8 81 f5 ff ff       	call   801489 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f08:	83 c4 0c             	add    $0xc,%esp
+  801f0b:	6a 00                	push   $0x0
+  801f0d:	6a 00                	push   $0x0
+  801f0f:	6a 00                	push   $0x0
+  801f11:	e8 fb f4 ff ff       	call   801411 <ipc_recv>
+}
+  801f16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f19:	c9                   	leave
+  801f1a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f1b:	83 ec 0c             	sub    $0xc,%esp
+  801f1e:	6a 02                	push   $0x2
+  801f20:	e8 b8 f5 ff ff       	call   8014dd <ipc_find_env>
+  801f25:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f2a:	83 c4 10             	add    $0x10,%esp
+  801f2d:	eb c6                	jmp    801ef5 <nsipc+0x12>
+
+00801f2f <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801f2f:	55                   	push   %ebp
+  801f30:	89 e5                	mov    %esp,%ebp
+  801f32:	56                   	push   %esi
+  801f33:	53                   	push   %ebx
+  801f34:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801f37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801f3f:	8b 06                	mov    (%esi),%eax
+  801f41:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801f46:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f4b:	e8 93 ff ff ff       	call   801ee3 <nsipc>
+  801f50:	89 c3                	mov    %eax,%ebx
+  801f52:	85 c0                	test   %eax,%eax
+  801f54:	79 09                	jns    801f5f <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801f56:	89 d8                	mov    %ebx,%eax
+  801f58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f5b:	5b                   	pop    %ebx
+  801f5c:	5e                   	pop    %esi
+  801f5d:	5d                   	pop    %ebp
+  801f5e:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801f5f:	83 ec 04             	sub    $0x4,%esp
+  801f62:	ff 35 10 70 80 00    	push   0x807010
+  801f68:	68 00 70 80 00       	push   $0x807000
+  801f6d:	ff 75 0c             	push   0xc(%ebp)
+  801f70:	e8 2e ea ff ff       	call   8009a3 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f75:	a1 10 70 80 00       	mov    0x807010,%eax
+  801f7a:	89 06                	mov    %eax,(%esi)
+  801f7c:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f7f:	eb d5                	jmp    801f56 <nsipc_accept+0x27>
+
+00801f81 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f81:	55                   	push   %ebp
+  801f82:	89 e5                	mov    %esp,%ebp
+  801f84:	53                   	push   %ebx
+  801f85:	83 ec 08             	sub    $0x8,%esp
+  801f88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8e:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f93:	53                   	push   %ebx
+  801f94:	ff 75 0c             	push   0xc(%ebp)
+  801f97:	68 04 70 80 00       	push   $0x807004
+  801f9c:	e8 02 ea ff ff       	call   8009a3 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801fa1:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801fa7:	b8 02 00 00 00       	mov    $0x2,%eax
+  801fac:	e8 32 ff ff ff       	call   801ee3 <nsipc>
+}
+  801fb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb4:	c9                   	leave
+  801fb5:	c3                   	ret
+
+00801fb6 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801fb6:	55                   	push   %ebp
+  801fb7:	89 e5                	mov    %esp,%ebp
+  801fb9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801fbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbf:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801fc4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc7:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801fcc:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fd1:	e8 0d ff ff ff       	call   801ee3 <nsipc>
+}
+  801fd6:	c9                   	leave
+  801fd7:	c3                   	ret
+
+00801fd8 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801fde:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe1:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801fe6:	b8 04 00 00 00       	mov    $0x4,%eax
+  801feb:	e8 f3 fe ff ff       	call   801ee3 <nsipc>
+}
+  801ff0:	c9                   	leave
+  801ff1:	c3                   	ret
+
+00801ff2 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801ff2:	55                   	push   %ebp
+  801ff3:	89 e5                	mov    %esp,%ebp
+  801ff5:	53                   	push   %ebx
+  801ff6:	83 ec 08             	sub    $0x8,%esp
+  801ff9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801ffc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fff:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802004:	53                   	push   %ebx
+  802005:	ff 75 0c             	push   0xc(%ebp)
+  802008:	68 04 70 80 00       	push   $0x807004
+  80200d:	e8 91 e9 ff ff       	call   8009a3 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802012:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802018:	b8 05 00 00 00       	mov    $0x5,%eax
+  80201d:	e8 c1 fe ff ff       	call   801ee3 <nsipc>
+}
+  802022:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802025:	c9                   	leave
+  802026:	c3                   	ret
+
+00802027 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802027:	55                   	push   %ebp
+  802028:	89 e5                	mov    %esp,%ebp
+  80202a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80202d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802030:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802035:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802038:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80203d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802042:	e8 9c fe ff ff       	call   801ee3 <nsipc>
+}
+  802047:	c9                   	leave
+  802048:	c3                   	ret
+
+00802049 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802049:	55                   	push   %ebp
+  80204a:	89 e5                	mov    %esp,%ebp
+  80204c:	56                   	push   %esi
+  80204d:	53                   	push   %ebx
+  80204e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802051:	8b 45 08             	mov    0x8(%ebp),%eax
+  802054:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802059:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80205f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802062:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802067:	b8 07 00 00 00       	mov    $0x7,%eax
+  80206c:	e8 72 fe ff ff       	call   801ee3 <nsipc>
+  802071:	89 c3                	mov    %eax,%ebx
+  802073:	85 c0                	test   %eax,%eax
+  802075:	78 22                	js     802099 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802077:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80207c:	39 c6                	cmp    %eax,%esi
+  80207e:	0f 4e c6             	cmovle %esi,%eax
+  802081:	39 c3                	cmp    %eax,%ebx
+  802083:	7f 1d                	jg     8020a2 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802085:	83 ec 04             	sub    $0x4,%esp
+  802088:	53                   	push   %ebx
+  802089:	68 00 70 80 00       	push   $0x807000
+  80208e:	ff 75 0c             	push   0xc(%ebp)
+  802091:	e8 0d e9 ff ff       	call   8009a3 <memmove>
+  802096:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802099:	89 d8                	mov    %ebx,%eax
+  80209b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80209e:	5b                   	pop    %ebx
+  80209f:	5e                   	pop    %esi
+  8020a0:	5d                   	pop    %ebp
+  8020a1:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8020a2:	68 6f 30 80 00       	push   $0x80306f
+  8020a7:	68 37 30 80 00       	push   $0x803037
+  8020ac:	6a 62                	push   $0x62
+  8020ae:	68 84 30 80 00       	push   $0x803084
+  8020b3:	e8 9c e0 ff ff       	call   800154 <_panic>
+
+008020b8 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8020b8:	55                   	push   %ebp
+  8020b9:	89 e5                	mov    %esp,%ebp
+  8020bb:	53                   	push   %ebx
+  8020bc:	83 ec 04             	sub    $0x4,%esp
+  8020bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8020c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c5:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8020ca:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8020d0:	7f 2e                	jg     802100 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8020d2:	83 ec 04             	sub    $0x4,%esp
+  8020d5:	53                   	push   %ebx
+  8020d6:	ff 75 0c             	push   0xc(%ebp)
+  8020d9:	68 0c 70 80 00       	push   $0x80700c
+  8020de:	e8 c0 e8 ff ff       	call   8009a3 <memmove>
+	nsipcbuf.send.req_size = size;
+  8020e3:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8020e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020ec:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8020f1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020f6:	e8 e8 fd ff ff       	call   801ee3 <nsipc>
+}
+  8020fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020fe:	c9                   	leave
+  8020ff:	c3                   	ret
+	assert(size < 1600);
+  802100:	68 90 30 80 00       	push   $0x803090
+  802105:	68 37 30 80 00       	push   $0x803037
+  80210a:	6a 6d                	push   $0x6d
+  80210c:	68 84 30 80 00       	push   $0x803084
+  802111:	e8 3e e0 ff ff       	call   800154 <_panic>
+
+00802116 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802116:	55                   	push   %ebp
+  802117:	89 e5                	mov    %esp,%ebp
+  802119:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80211c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80211f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802124:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802127:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80212c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80212f:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802134:	b8 09 00 00 00       	mov    $0x9,%eax
+  802139:	e8 a5 fd ff ff       	call   801ee3 <nsipc>
+}
+  80213e:	c9                   	leave
+  80213f:	c3                   	ret
+
+00802140 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	56                   	push   %esi
+  802144:	53                   	push   %ebx
+  802145:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802148:	83 ec 0c             	sub    $0xc,%esp
+  80214b:	ff 75 08             	push   0x8(%ebp)
+  80214e:	e8 aa f3 ff ff       	call   8014fd <fd2data>
+  802153:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802155:	83 c4 08             	add    $0x8,%esp
+  802158:	68 9c 30 80 00       	push   $0x80309c
+  80215d:	53                   	push   %ebx
+  80215e:	e8 ba e6 ff ff       	call   80081d <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802163:	8b 46 04             	mov    0x4(%esi),%eax
+  802166:	2b 06                	sub    (%esi),%eax
+  802168:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80216e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802175:	00 00 00 
+	stat->st_dev = &devpipe;
+  802178:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80217f:	40 80 00 
+	return 0;
+}
+  802182:	b8 00 00 00 00       	mov    $0x0,%eax
+  802187:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80218a:	5b                   	pop    %ebx
+  80218b:	5e                   	pop    %esi
+  80218c:	5d                   	pop    %ebp
+  80218d:	c3                   	ret
+
+0080218e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80218e:	55                   	push   %ebp
+  80218f:	89 e5                	mov    %esp,%ebp
+  802191:	53                   	push   %ebx
+  802192:	83 ec 0c             	sub    $0xc,%esp
+  802195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802198:	53                   	push   %ebx
+  802199:	6a 00                	push   $0x0
+  80219b:	e8 b2 eb ff ff       	call   800d52 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8021a0:	89 1c 24             	mov    %ebx,(%esp)
+  8021a3:	e8 55 f3 ff ff       	call   8014fd <fd2data>
+  8021a8:	83 c4 08             	add    $0x8,%esp
+  8021ab:	50                   	push   %eax
+  8021ac:	6a 00                	push   $0x0
+  8021ae:	e8 9f eb ff ff       	call   800d52 <sys_page_unmap>
+}
+  8021b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b6:	c9                   	leave
+  8021b7:	c3                   	ret
+
+008021b8 <_pipeisclosed>:
+{
+  8021b8:	55                   	push   %ebp
+  8021b9:	89 e5                	mov    %esp,%ebp
+  8021bb:	57                   	push   %edi
+  8021bc:	56                   	push   %esi
+  8021bd:	53                   	push   %ebx
+  8021be:	83 ec 1c             	sub    $0x1c,%esp
+  8021c1:	89 c7                	mov    %eax,%edi
+  8021c3:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8021c5:	a1 08 50 80 00       	mov    0x805008,%eax
+  8021ca:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8021cd:	83 ec 0c             	sub    $0xc,%esp
+  8021d0:	57                   	push   %edi
+  8021d1:	e8 b9 04 00 00       	call   80268f <pageref>
+  8021d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021d9:	89 34 24             	mov    %esi,(%esp)
+  8021dc:	e8 ae 04 00 00       	call   80268f <pageref>
+		nn = thisenv->env_runs;
+  8021e1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8021e7:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8021ea:	83 c4 10             	add    $0x10,%esp
+  8021ed:	39 cb                	cmp    %ecx,%ebx
+  8021ef:	74 1b                	je     80220c <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8021f1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021f4:	75 cf                	jne    8021c5 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8021f6:	8b 42 5c             	mov    0x5c(%edx),%eax
+  8021f9:	6a 01                	push   $0x1
+  8021fb:	50                   	push   %eax
+  8021fc:	53                   	push   %ebx
+  8021fd:	68 a3 30 80 00       	push   $0x8030a3
+  802202:	e8 28 e0 ff ff       	call   80022f <cprintf>
+  802207:	83 c4 10             	add    $0x10,%esp
+  80220a:	eb b9                	jmp    8021c5 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80220c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80220f:	0f 94 c0             	sete   %al
+  802212:	0f b6 c0             	movzbl %al,%eax
+}
+  802215:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802218:	5b                   	pop    %ebx
+  802219:	5e                   	pop    %esi
+  80221a:	5f                   	pop    %edi
+  80221b:	5d                   	pop    %ebp
+  80221c:	c3                   	ret
+
+0080221d <devpipe_write>:
+{
+  80221d:	55                   	push   %ebp
+  80221e:	89 e5                	mov    %esp,%ebp
+  802220:	57                   	push   %edi
+  802221:	56                   	push   %esi
+  802222:	53                   	push   %ebx
+  802223:	83 ec 28             	sub    $0x28,%esp
+  802226:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802229:	56                   	push   %esi
+  80222a:	e8 ce f2 ff ff       	call   8014fd <fd2data>
+  80222f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802231:	83 c4 10             	add    $0x10,%esp
+  802234:	bf 00 00 00 00       	mov    $0x0,%edi
+  802239:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80223c:	75 09                	jne    802247 <devpipe_write+0x2a>
+	return i;
+  80223e:	89 f8                	mov    %edi,%eax
+  802240:	eb 23                	jmp    802265 <devpipe_write+0x48>
+			sys_yield();
+  802242:	e8 c3 e9 ff ff       	call   800c0a <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802247:	8b 43 04             	mov    0x4(%ebx),%eax
+  80224a:	8b 0b                	mov    (%ebx),%ecx
+  80224c:	8d 51 20             	lea    0x20(%ecx),%edx
+  80224f:	39 d0                	cmp    %edx,%eax
+  802251:	72 1a                	jb     80226d <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802253:	89 da                	mov    %ebx,%edx
+  802255:	89 f0                	mov    %esi,%eax
+  802257:	e8 5c ff ff ff       	call   8021b8 <_pipeisclosed>
+  80225c:	85 c0                	test   %eax,%eax
+  80225e:	74 e2                	je     802242 <devpipe_write+0x25>
+				return 0;
+  802260:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802265:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802268:	5b                   	pop    %ebx
+  802269:	5e                   	pop    %esi
+  80226a:	5f                   	pop    %edi
+  80226b:	5d                   	pop    %ebp
+  80226c:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80226d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802270:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802274:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802277:	89 c2                	mov    %eax,%edx
+  802279:	c1 fa 1f             	sar    $0x1f,%edx
+  80227c:	89 d1                	mov    %edx,%ecx
+  80227e:	c1 e9 1b             	shr    $0x1b,%ecx
+  802281:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802284:	83 e2 1f             	and    $0x1f,%edx
+  802287:	29 ca                	sub    %ecx,%edx
+  802289:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80228d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802291:	83 c0 01             	add    $0x1,%eax
+  802294:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802297:	83 c7 01             	add    $0x1,%edi
+  80229a:	eb 9d                	jmp    802239 <devpipe_write+0x1c>
+
+0080229c <devpipe_read>:
+{
+  80229c:	55                   	push   %ebp
+  80229d:	89 e5                	mov    %esp,%ebp
+  80229f:	57                   	push   %edi
+  8022a0:	56                   	push   %esi
+  8022a1:	53                   	push   %ebx
+  8022a2:	83 ec 18             	sub    $0x18,%esp
+  8022a5:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8022a8:	57                   	push   %edi
+  8022a9:	e8 4f f2 ff ff       	call   8014fd <fd2data>
+  8022ae:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8022b0:	83 c4 10             	add    $0x10,%esp
+  8022b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022bb:	75 13                	jne    8022d0 <devpipe_read+0x34>
+	return i;
+  8022bd:	89 f0                	mov    %esi,%eax
+  8022bf:	eb 02                	jmp    8022c3 <devpipe_read+0x27>
+				return i;
+  8022c1:	89 f0                	mov    %esi,%eax
+}
+  8022c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c6:	5b                   	pop    %ebx
+  8022c7:	5e                   	pop    %esi
+  8022c8:	5f                   	pop    %edi
+  8022c9:	5d                   	pop    %ebp
+  8022ca:	c3                   	ret
+			sys_yield();
+  8022cb:	e8 3a e9 ff ff       	call   800c0a <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8022d0:	8b 03                	mov    (%ebx),%eax
+  8022d2:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8022d5:	75 18                	jne    8022ef <devpipe_read+0x53>
+			if (i > 0)
+  8022d7:	85 f6                	test   %esi,%esi
+  8022d9:	75 e6                	jne    8022c1 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8022db:	89 da                	mov    %ebx,%edx
+  8022dd:	89 f8                	mov    %edi,%eax
+  8022df:	e8 d4 fe ff ff       	call   8021b8 <_pipeisclosed>
+  8022e4:	85 c0                	test   %eax,%eax
+  8022e6:	74 e3                	je     8022cb <devpipe_read+0x2f>
+				return 0;
+  8022e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ed:	eb d4                	jmp    8022c3 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8022ef:	99                   	cltd
+  8022f0:	c1 ea 1b             	shr    $0x1b,%edx
+  8022f3:	01 d0                	add    %edx,%eax
+  8022f5:	83 e0 1f             	and    $0x1f,%eax
+  8022f8:	29 d0                	sub    %edx,%eax
+  8022fa:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8022ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802302:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802305:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802308:	83 c6 01             	add    $0x1,%esi
+  80230b:	eb ab                	jmp    8022b8 <devpipe_read+0x1c>
+
+0080230d <pipe>:
+{
+  80230d:	55                   	push   %ebp
+  80230e:	89 e5                	mov    %esp,%ebp
+  802310:	56                   	push   %esi
+  802311:	53                   	push   %ebx
+  802312:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802315:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802318:	50                   	push   %eax
+  802319:	e8 f6 f1 ff ff       	call   801514 <fd_alloc>
+  80231e:	89 c3                	mov    %eax,%ebx
+  802320:	83 c4 10             	add    $0x10,%esp
+  802323:	85 c0                	test   %eax,%eax
+  802325:	0f 88 23 01 00 00    	js     80244e <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80232b:	83 ec 04             	sub    $0x4,%esp
+  80232e:	68 07 04 00 00       	push   $0x407
+  802333:	ff 75 f4             	push   -0xc(%ebp)
+  802336:	6a 00                	push   $0x0
+  802338:	e8 4d e9 ff ff       	call   800c8a <sys_page_alloc>
+  80233d:	89 c3                	mov    %eax,%ebx
+  80233f:	83 c4 10             	add    $0x10,%esp
+  802342:	85 c0                	test   %eax,%eax
+  802344:	0f 88 04 01 00 00    	js     80244e <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80234a:	83 ec 0c             	sub    $0xc,%esp
+  80234d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802350:	50                   	push   %eax
+  802351:	e8 be f1 ff ff       	call   801514 <fd_alloc>
+  802356:	89 c3                	mov    %eax,%ebx
+  802358:	83 c4 10             	add    $0x10,%esp
+  80235b:	85 c0                	test   %eax,%eax
+  80235d:	0f 88 db 00 00 00    	js     80243e <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802363:	83 ec 04             	sub    $0x4,%esp
+  802366:	68 07 04 00 00       	push   $0x407
+  80236b:	ff 75 f0             	push   -0x10(%ebp)
+  80236e:	6a 00                	push   $0x0
+  802370:	e8 15 e9 ff ff       	call   800c8a <sys_page_alloc>
+  802375:	89 c3                	mov    %eax,%ebx
+  802377:	83 c4 10             	add    $0x10,%esp
+  80237a:	85 c0                	test   %eax,%eax
+  80237c:	0f 88 bc 00 00 00    	js     80243e <pipe+0x131>
+	va = fd2data(fd0);
+  802382:	83 ec 0c             	sub    $0xc,%esp
+  802385:	ff 75 f4             	push   -0xc(%ebp)
+  802388:	e8 70 f1 ff ff       	call   8014fd <fd2data>
+  80238d:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80238f:	83 c4 0c             	add    $0xc,%esp
+  802392:	68 07 04 00 00       	push   $0x407
+  802397:	50                   	push   %eax
+  802398:	6a 00                	push   $0x0
+  80239a:	e8 eb e8 ff ff       	call   800c8a <sys_page_alloc>
+  80239f:	89 c3                	mov    %eax,%ebx
+  8023a1:	83 c4 10             	add    $0x10,%esp
+  8023a4:	85 c0                	test   %eax,%eax
+  8023a6:	0f 88 82 00 00 00    	js     80242e <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023ac:	83 ec 0c             	sub    $0xc,%esp
+  8023af:	ff 75 f0             	push   -0x10(%ebp)
+  8023b2:	e8 46 f1 ff ff       	call   8014fd <fd2data>
+  8023b7:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8023be:	50                   	push   %eax
+  8023bf:	6a 00                	push   $0x0
+  8023c1:	56                   	push   %esi
+  8023c2:	6a 00                	push   $0x0
+  8023c4:	e8 47 e9 ff ff       	call   800d10 <sys_page_map>
+  8023c9:	89 c3                	mov    %eax,%ebx
+  8023cb:	83 c4 20             	add    $0x20,%esp
+  8023ce:	85 c0                	test   %eax,%eax
+  8023d0:	78 4e                	js     802420 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8023d2:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8023d7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023da:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8023dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023df:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8023e6:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8023e9:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8023eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8023ee:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8023f5:	83 ec 0c             	sub    $0xc,%esp
+  8023f8:	ff 75 f4             	push   -0xc(%ebp)
+  8023fb:	e8 ed f0 ff ff       	call   8014ed <fd2num>
+  802400:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802403:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802405:	83 c4 04             	add    $0x4,%esp
+  802408:	ff 75 f0             	push   -0x10(%ebp)
+  80240b:	e8 dd f0 ff ff       	call   8014ed <fd2num>
+  802410:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802413:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802416:	83 c4 10             	add    $0x10,%esp
+  802419:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80241e:	eb 2e                	jmp    80244e <pipe+0x141>
+	sys_page_unmap(0, va);
+  802420:	83 ec 08             	sub    $0x8,%esp
+  802423:	56                   	push   %esi
+  802424:	6a 00                	push   $0x0
+  802426:	e8 27 e9 ff ff       	call   800d52 <sys_page_unmap>
+  80242b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80242e:	83 ec 08             	sub    $0x8,%esp
+  802431:	ff 75 f0             	push   -0x10(%ebp)
+  802434:	6a 00                	push   $0x0
+  802436:	e8 17 e9 ff ff       	call   800d52 <sys_page_unmap>
+  80243b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80243e:	83 ec 08             	sub    $0x8,%esp
+  802441:	ff 75 f4             	push   -0xc(%ebp)
+  802444:	6a 00                	push   $0x0
+  802446:	e8 07 e9 ff ff       	call   800d52 <sys_page_unmap>
+  80244b:	83 c4 10             	add    $0x10,%esp
+}
+  80244e:	89 d8                	mov    %ebx,%eax
+  802450:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802453:	5b                   	pop    %ebx
+  802454:	5e                   	pop    %esi
+  802455:	5d                   	pop    %ebp
+  802456:	c3                   	ret
+
+00802457 <pipeisclosed>:
+{
+  802457:	55                   	push   %ebp
+  802458:	89 e5                	mov    %esp,%ebp
+  80245a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80245d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802460:	50                   	push   %eax
+  802461:	ff 75 08             	push   0x8(%ebp)
+  802464:	e8 01 f1 ff ff       	call   80156a <fd_lookup>
+  802469:	83 c4 10             	add    $0x10,%esp
+  80246c:	85 c0                	test   %eax,%eax
+  80246e:	78 18                	js     802488 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802470:	83 ec 0c             	sub    $0xc,%esp
+  802473:	ff 75 f4             	push   -0xc(%ebp)
+  802476:	e8 82 f0 ff ff       	call   8014fd <fd2data>
+  80247b:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80247d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802480:	e8 33 fd ff ff       	call   8021b8 <_pipeisclosed>
+  802485:	83 c4 10             	add    $0x10,%esp
+}
+  802488:	c9                   	leave
+  802489:	c3                   	ret
+
+0080248a <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80248a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80248f:	c3                   	ret
+
+00802490 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802490:	55                   	push   %ebp
+  802491:	89 e5                	mov    %esp,%ebp
+  802493:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802496:	68 bb 30 80 00       	push   $0x8030bb
+  80249b:	ff 75 0c             	push   0xc(%ebp)
+  80249e:	e8 7a e3 ff ff       	call   80081d <strcpy>
+	return 0;
+}
+  8024a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a8:	c9                   	leave
+  8024a9:	c3                   	ret
+
+008024aa <devcons_write>:
+{
+  8024aa:	55                   	push   %ebp
+  8024ab:	89 e5                	mov    %esp,%ebp
+  8024ad:	57                   	push   %edi
+  8024ae:	56                   	push   %esi
+  8024af:	53                   	push   %ebx
+  8024b0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8024b6:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8024bb:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8024c1:	eb 2e                	jmp    8024f1 <devcons_write+0x47>
+		m = n - tot;
+  8024c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8024c6:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8024c8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8024cd:	39 c3                	cmp    %eax,%ebx
+  8024cf:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8024d2:	83 ec 04             	sub    $0x4,%esp
+  8024d5:	53                   	push   %ebx
+  8024d6:	89 f0                	mov    %esi,%eax
+  8024d8:	03 45 0c             	add    0xc(%ebp),%eax
+  8024db:	50                   	push   %eax
+  8024dc:	57                   	push   %edi
+  8024dd:	e8 c1 e4 ff ff       	call   8009a3 <memmove>
+		sys_cputs(buf, m);
+  8024e2:	83 c4 08             	add    $0x8,%esp
+  8024e5:	53                   	push   %ebx
+  8024e6:	57                   	push   %edi
+  8024e7:	e8 61 e6 ff ff       	call   800b4d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8024ec:	01 de                	add    %ebx,%esi
+  8024ee:	83 c4 10             	add    $0x10,%esp
+  8024f1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8024f4:	72 cd                	jb     8024c3 <devcons_write+0x19>
+}
+  8024f6:	89 f0                	mov    %esi,%eax
+  8024f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024fb:	5b                   	pop    %ebx
+  8024fc:	5e                   	pop    %esi
+  8024fd:	5f                   	pop    %edi
+  8024fe:	5d                   	pop    %ebp
+  8024ff:	c3                   	ret
+
+00802500 <devcons_read>:
+{
+  802500:	55                   	push   %ebp
+  802501:	89 e5                	mov    %esp,%ebp
+  802503:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802506:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80250f:	75 07                	jne    802518 <devcons_read+0x18>
+  802511:	eb 1f                	jmp    802532 <devcons_read+0x32>
+		sys_yield();
+  802513:	e8 f2 e6 ff ff       	call   800c0a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802518:	e8 4e e6 ff ff       	call   800b6b <sys_cgetc>
+  80251d:	85 c0                	test   %eax,%eax
+  80251f:	74 f2                	je     802513 <devcons_read+0x13>
+	if (c < 0)
+  802521:	78 0f                	js     802532 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802523:	83 f8 04             	cmp    $0x4,%eax
+  802526:	74 0c                	je     802534 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802528:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80252b:	88 02                	mov    %al,(%edx)
+	return 1;
+  80252d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802532:	c9                   	leave
+  802533:	c3                   	ret
+		return 0;
+  802534:	b8 00 00 00 00       	mov    $0x0,%eax
+  802539:	eb f7                	jmp    802532 <devcons_read+0x32>
+
+0080253b <cputchar>:
+{
+  80253b:	55                   	push   %ebp
+  80253c:	89 e5                	mov    %esp,%ebp
+  80253e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802541:	8b 45 08             	mov    0x8(%ebp),%eax
+  802544:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802547:	6a 01                	push   $0x1
+  802549:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80254c:	50                   	push   %eax
+  80254d:	e8 fb e5 ff ff       	call   800b4d <sys_cputs>
+}
+  802552:	83 c4 10             	add    $0x10,%esp
+  802555:	c9                   	leave
+  802556:	c3                   	ret
+
+00802557 <getchar>:
+{
+  802557:	55                   	push   %ebp
+  802558:	89 e5                	mov    %esp,%ebp
+  80255a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80255d:	6a 01                	push   $0x1
+  80255f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802562:	50                   	push   %eax
+  802563:	6a 00                	push   $0x0
+  802565:	e8 66 f2 ff ff       	call   8017d0 <read>
+	if (r < 0)
+  80256a:	83 c4 10             	add    $0x10,%esp
+  80256d:	85 c0                	test   %eax,%eax
+  80256f:	78 06                	js     802577 <getchar+0x20>
+	if (r < 1)
+  802571:	74 06                	je     802579 <getchar+0x22>
+	return c;
+  802573:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802577:	c9                   	leave
+  802578:	c3                   	ret
+		return -E_EOF;
+  802579:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80257e:	eb f7                	jmp    802577 <getchar+0x20>
+
+00802580 <iscons>:
+{
+  802580:	55                   	push   %ebp
+  802581:	89 e5                	mov    %esp,%ebp
+  802583:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802586:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802589:	50                   	push   %eax
+  80258a:	ff 75 08             	push   0x8(%ebp)
+  80258d:	e8 d8 ef ff ff       	call   80156a <fd_lookup>
+  802592:	83 c4 10             	add    $0x10,%esp
+  802595:	85 c0                	test   %eax,%eax
+  802597:	78 11                	js     8025aa <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802599:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80259c:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8025a2:	39 10                	cmp    %edx,(%eax)
+  8025a4:	0f 94 c0             	sete   %al
+  8025a7:	0f b6 c0             	movzbl %al,%eax
+}
+  8025aa:	c9                   	leave
+  8025ab:	c3                   	ret
+
+008025ac <opencons>:
+{
+  8025ac:	55                   	push   %ebp
+  8025ad:	89 e5                	mov    %esp,%ebp
+  8025af:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8025b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025b5:	50                   	push   %eax
+  8025b6:	e8 59 ef ff ff       	call   801514 <fd_alloc>
+  8025bb:	83 c4 10             	add    $0x10,%esp
+  8025be:	85 c0                	test   %eax,%eax
+  8025c0:	78 3a                	js     8025fc <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8025c2:	83 ec 04             	sub    $0x4,%esp
+  8025c5:	68 07 04 00 00       	push   $0x407
+  8025ca:	ff 75 f4             	push   -0xc(%ebp)
+  8025cd:	6a 00                	push   $0x0
+  8025cf:	e8 b6 e6 ff ff       	call   800c8a <sys_page_alloc>
+  8025d4:	83 c4 10             	add    $0x10,%esp
+  8025d7:	85 c0                	test   %eax,%eax
+  8025d9:	78 21                	js     8025fc <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8025db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025de:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8025e4:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8025e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025e9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8025f0:	83 ec 0c             	sub    $0xc,%esp
+  8025f3:	50                   	push   %eax
+  8025f4:	e8 f4 ee ff ff       	call   8014ed <fd2num>
+  8025f9:	83 c4 10             	add    $0x10,%esp
+}
+  8025fc:	c9                   	leave
+  8025fd:	c3                   	ret
+
+008025fe <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8025fe:	55                   	push   %ebp
+  8025ff:	89 e5                	mov    %esp,%ebp
+  802601:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802604:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80260b:	74 0a                	je     802617 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80260d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802610:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  802615:	c9                   	leave
+  802616:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  802617:	83 ec 04             	sub    $0x4,%esp
+  80261a:	6a 07                	push   $0x7
+  80261c:	68 00 f0 bf ee       	push   $0xeebff000
+  802621:	6a 00                	push   $0x0
+  802623:	e8 62 e6 ff ff       	call   800c8a <sys_page_alloc>
+  802628:	83 c4 10             	add    $0x10,%esp
+  80262b:	85 c0                	test   %eax,%eax
+  80262d:	78 28                	js     802657 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  80262f:	83 ec 08             	sub    $0x8,%esp
+  802632:	68 69 26 80 00       	push   $0x802669
+  802637:	6a 00                	push   $0x0
+  802639:	e8 47 e9 ff ff       	call   800f85 <sys_env_set_pgfault_upcall>
+  80263e:	83 c4 10             	add    $0x10,%esp
+  802641:	85 c0                	test   %eax,%eax
+  802643:	79 c8                	jns    80260d <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  802645:	50                   	push   %eax
+  802646:	68 d5 30 80 00       	push   $0x8030d5
+  80264b:	6a 24                	push   $0x24
+  80264d:	68 c7 30 80 00       	push   $0x8030c7
+  802652:	e8 fd da ff ff       	call   800154 <_panic>
+			panic("sys_page_alloc: %e", r);
+  802657:	50                   	push   %eax
+  802658:	68 a6 2e 80 00       	push   $0x802ea6
+  80265d:	6a 21                	push   $0x21
+  80265f:	68 c7 30 80 00       	push   $0x8030c7
+  802664:	e8 eb da ff ff       	call   800154 <_panic>
+
+00802669 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802669:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80266a:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  80266f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802671:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802674:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  802677:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  80267b:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  80267e:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  802682:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  802686:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  802688:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802689:	83 c4 04             	add    $0x4,%esp
+	popf
+  80268c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80268d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80268e:	c3                   	ret
+
+0080268f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80268f:	55                   	push   %ebp
+  802690:	89 e5                	mov    %esp,%ebp
+  802692:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802695:	89 c2                	mov    %eax,%edx
+  802697:	c1 ea 16             	shr    $0x16,%edx
+  80269a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8026a1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8026a6:	f6 c1 01             	test   $0x1,%cl
+  8026a9:	74 22                	je     8026cd <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8026ab:	c1 e8 0c             	shr    $0xc,%eax
+  8026ae:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8026b5:	a8 01                	test   $0x1,%al
+  8026b7:	74 14                	je     8026cd <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8026b9:	c1 e8 0c             	shr    $0xc,%eax
+  8026bc:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026bf:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8026c6:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8026ca:	0f b7 d2             	movzwl %dx,%edx
+}
+  8026cd:	89 d0                	mov    %edx,%eax
+  8026cf:	5d                   	pop    %ebp
+  8026d0:	c3                   	ret
+  8026d1:	66 90                	xchg   %ax,%ax
+  8026d3:	66 90                	xchg   %ax,%ax
+  8026d5:	66 90                	xchg   %ax,%ax
+  8026d7:	66 90                	xchg   %ax,%ax
+  8026d9:	66 90                	xchg   %ax,%ax
+  8026db:	66 90                	xchg   %ax,%ax
+  8026dd:	66 90                	xchg   %ax,%ax
+  8026df:	90                   	nop
+
+008026e0 <__udivmoddi4>:
+  8026e0:	55                   	push   %ebp
+  8026e1:	57                   	push   %edi
+  8026e2:	56                   	push   %esi
+  8026e3:	53                   	push   %ebx
+  8026e4:	83 ec 14             	sub    $0x14,%esp
+  8026e7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8026eb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8026ef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026f3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026f7:	89 f1                	mov    %esi,%ecx
+  8026f9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8026fd:	09 d9                	or     %ebx,%ecx
+  8026ff:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802703:	0f 84 92 00 00 00    	je     80279b <__udivmoddi4+0xbb>
+  802709:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802710:	00 
+  802711:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802716:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80271d:	00 
+  80271e:	89 1c 24             	mov    %ebx,(%esp)
+  802721:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802725:	8d 76 00             	lea    0x0(%esi),%esi
+  802728:	89 e9                	mov    %ebp,%ecx
+  80272a:	89 c3                	mov    %eax,%ebx
+  80272c:	89 d6                	mov    %edx,%esi
+  80272e:	31 ff                	xor    %edi,%edi
+  802730:	d3 ee                	shr    %cl,%esi
+  802732:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802735:	f6 c1 20             	test   $0x20,%cl
+  802738:	0f 45 de             	cmovne %esi,%ebx
+  80273b:	0f 45 f7             	cmovne %edi,%esi
+  80273e:	8b 3c 24             	mov    (%esp),%edi
+  802741:	39 fb                	cmp    %edi,%ebx
+  802743:	89 f7                	mov    %esi,%edi
+  802745:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802749:	8b 1c 24             	mov    (%esp),%ebx
+  80274c:	19 f7                	sbb    %esi,%edi
+  80274e:	72 39                	jb     802789 <__udivmoddi4+0xa9>
+  802750:	89 e9                	mov    %ebp,%ecx
+  802752:	89 f7                	mov    %esi,%edi
+  802754:	89 de                	mov    %ebx,%esi
+  802756:	0f a5 df             	shld   %cl,%ebx,%edi
+  802759:	d3 e6                	shl    %cl,%esi
+  80275b:	31 db                	xor    %ebx,%ebx
+  80275d:	f6 c1 20             	test   $0x20,%cl
+  802760:	0f 45 fe             	cmovne %esi,%edi
+  802763:	0f 45 f3             	cmovne %ebx,%esi
+  802766:	29 f0                	sub    %esi,%eax
+  802768:	be 01 00 00 00       	mov    $0x1,%esi
+  80276d:	19 fa                	sbb    %edi,%edx
+  80276f:	31 ff                	xor    %edi,%edi
+  802771:	31 db                	xor    %ebx,%ebx
+  802773:	0f a5 f7             	shld   %cl,%esi,%edi
+  802776:	d3 e6                	shl    %cl,%esi
+  802778:	f6 c1 20             	test   $0x20,%cl
+  80277b:	0f 45 fe             	cmovne %esi,%edi
+  80277e:	0f 45 f3             	cmovne %ebx,%esi
+  802781:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802785:	09 74 24 08          	or     %esi,0x8(%esp)
+  802789:	83 ed 01             	sub    $0x1,%ebp
+  80278c:	73 9a                	jae    802728 <__udivmoddi4+0x48>
+  80278e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802792:	85 ff                	test   %edi,%edi
+  802794:	74 05                	je     80279b <__udivmoddi4+0xbb>
+  802796:	89 07                	mov    %eax,(%edi)
+  802798:	89 57 04             	mov    %edx,0x4(%edi)
+  80279b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80279f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027a3:	83 c4 14             	add    $0x14,%esp
+  8027a6:	5b                   	pop    %ebx
+  8027a7:	5e                   	pop    %esi
+  8027a8:	5f                   	pop    %edi
+  8027a9:	5d                   	pop    %ebp
+  8027aa:	c3                   	ret
+  8027ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8027af:	90                   	nop
+
+008027b0 <__udivdi3>:
+  8027b0:	55                   	push   %ebp
+  8027b1:	57                   	push   %edi
+  8027b2:	56                   	push   %esi
+  8027b3:	53                   	push   %ebx
+  8027b4:	83 ec 14             	sub    $0x14,%esp
+  8027b7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8027bb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8027bf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027c3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027c7:	89 fb                	mov    %edi,%ebx
+  8027c9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8027cd:	09 f3                	or     %esi,%ebx
+  8027cf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8027d3:	0f 84 85 00 00 00    	je     80285e <__udivdi3+0xae>
+  8027d9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027e0:	00 
+  8027e1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8027e6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027ed:	00 
+  8027ee:	89 34 24             	mov    %esi,(%esp)
+  8027f1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8027f5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027f8:	89 e9                	mov    %ebp,%ecx
+  8027fa:	89 c3                	mov    %eax,%ebx
+  8027fc:	89 d6                	mov    %edx,%esi
+  8027fe:	31 ff                	xor    %edi,%edi
+  802800:	d3 ee                	shr    %cl,%esi
+  802802:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802805:	f6 c1 20             	test   $0x20,%cl
+  802808:	0f 45 de             	cmovne %esi,%ebx
+  80280b:	0f 45 f7             	cmovne %edi,%esi
+  80280e:	8b 3c 24             	mov    (%esp),%edi
+  802811:	39 fb                	cmp    %edi,%ebx
+  802813:	89 f7                	mov    %esi,%edi
+  802815:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802819:	8b 1c 24             	mov    (%esp),%ebx
+  80281c:	19 f7                	sbb    %esi,%edi
+  80281e:	72 39                	jb     802859 <__udivdi3+0xa9>
+  802820:	89 e9                	mov    %ebp,%ecx
+  802822:	89 f7                	mov    %esi,%edi
+  802824:	89 de                	mov    %ebx,%esi
+  802826:	0f a5 df             	shld   %cl,%ebx,%edi
+  802829:	d3 e6                	shl    %cl,%esi
+  80282b:	31 db                	xor    %ebx,%ebx
+  80282d:	f6 c1 20             	test   $0x20,%cl
+  802830:	0f 45 fe             	cmovne %esi,%edi
+  802833:	0f 45 f3             	cmovne %ebx,%esi
+  802836:	29 f0                	sub    %esi,%eax
+  802838:	be 01 00 00 00       	mov    $0x1,%esi
+  80283d:	19 fa                	sbb    %edi,%edx
+  80283f:	31 ff                	xor    %edi,%edi
+  802841:	31 db                	xor    %ebx,%ebx
+  802843:	0f a5 f7             	shld   %cl,%esi,%edi
+  802846:	d3 e6                	shl    %cl,%esi
+  802848:	f6 c1 20             	test   $0x20,%cl
+  80284b:	0f 45 fe             	cmovne %esi,%edi
+  80284e:	0f 45 f3             	cmovne %ebx,%esi
+  802851:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802855:	09 74 24 08          	or     %esi,0x8(%esp)
+  802859:	83 ed 01             	sub    $0x1,%ebp
+  80285c:	73 9a                	jae    8027f8 <__udivdi3+0x48>
+  80285e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802862:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802866:	83 c4 14             	add    $0x14,%esp
+  802869:	5b                   	pop    %ebx
+  80286a:	5e                   	pop    %esi
+  80286b:	5f                   	pop    %edi
+  80286c:	5d                   	pop    %ebp
+  80286d:	c3                   	ret
+  80286e:	66 90                	xchg   %ax,%ax
+
+00802870 <__umoddi3>:
+  802870:	57                   	push   %edi
+  802871:	56                   	push   %esi
+  802872:	53                   	push   %ebx
+  802873:	83 ec 08             	sub    $0x8,%esp
+  802876:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80287a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80287e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802882:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802886:	89 f9                	mov    %edi,%ecx
+  802888:	89 34 24             	mov    %esi,(%esp)
+  80288b:	09 f1                	or     %esi,%ecx
+  80288d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802891:	74 53                	je     8028e6 <__umoddi3+0x76>
+  802893:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80289f:	90                   	nop
+  8028a0:	89 c6                	mov    %eax,%esi
+  8028a2:	89 d7                	mov    %edx,%edi
+  8028a4:	31 db                	xor    %ebx,%ebx
+  8028a6:	d3 ef                	shr    %cl,%edi
+  8028a8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8028ab:	f6 c1 20             	test   $0x20,%cl
+  8028ae:	0f 45 f7             	cmovne %edi,%esi
+  8028b1:	0f 45 fb             	cmovne %ebx,%edi
+  8028b4:	8b 1c 24             	mov    (%esp),%ebx
+  8028b7:	39 de                	cmp    %ebx,%esi
+  8028b9:	89 fb                	mov    %edi,%ebx
+  8028bb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8028bf:	8b 34 24             	mov    (%esp),%esi
+  8028c2:	19 fb                	sbb    %edi,%ebx
+  8028c4:	72 14                	jb     8028da <__umoddi3+0x6a>
+  8028c6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8028c9:	31 db                	xor    %ebx,%ebx
+  8028cb:	d3 e6                	shl    %cl,%esi
+  8028cd:	f6 c1 20             	test   $0x20,%cl
+  8028d0:	0f 45 fe             	cmovne %esi,%edi
+  8028d3:	0f 45 f3             	cmovne %ebx,%esi
+  8028d6:	29 f0                	sub    %esi,%eax
+  8028d8:	19 fa                	sbb    %edi,%edx
+  8028da:	83 e9 01             	sub    $0x1,%ecx
+  8028dd:	73 c1                	jae    8028a0 <__umoddi3+0x30>
+  8028df:	83 c4 08             	add    $0x8,%esp
+  8028e2:	5b                   	pop    %ebx
+  8028e3:	5e                   	pop    %esi
+  8028e4:	5f                   	pop    %edi
+  8028e5:	c3                   	ret
+  8028e6:	83 c4 08             	add    $0x8,%esp
+  8028e9:	31 c0                	xor    %eax,%eax
+  8028eb:	31 d2                	xor    %edx,%edx
+  8028ed:	5b                   	pop    %ebx
+  8028ee:	5e                   	pop    %esi
+  8028ef:	5f                   	pop    %edi
+  8028f0:	c3                   	ret
+  8028f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028ff:	90                   	nop
+
+00802900 <__divdi3>:
+  802900:	55                   	push   %ebp
+  802901:	57                   	push   %edi
+  802902:	56                   	push   %esi
+  802903:	53                   	push   %ebx
+  802904:	83 ec 1c             	sub    $0x1c,%esp
+  802907:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80290b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80290f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802913:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802917:	85 ff                	test   %edi,%edi
+  802919:	0f 88 da 00 00 00    	js     8029f9 <__divdi3+0xf9>
+  80291f:	85 db                	test   %ebx,%ebx
+  802921:	78 16                	js     802939 <__divdi3+0x39>
+  802923:	89 dd                	mov    %ebx,%ebp
+  802925:	89 c8                	mov    %ecx,%eax
+  802927:	89 da                	mov    %ebx,%edx
+  802929:	09 cd                	or     %ecx,%ebp
+  80292b:	0f 85 fd 00 00 00    	jne    802a2e <__divdi3+0x12e>
+  802931:	83 c4 1c             	add    $0x1c,%esp
+  802934:	5b                   	pop    %ebx
+  802935:	5e                   	pop    %esi
+  802936:	5f                   	pop    %edi
+  802937:	5d                   	pop    %ebp
+  802938:	c3                   	ret
+  802939:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80293e:	f7 d9                	neg    %ecx
+  802940:	89 f0                	mov    %esi,%eax
+  802942:	89 fa                	mov    %edi,%edx
+  802944:	83 d3 00             	adc    $0x0,%ebx
+  802947:	89 0c 24             	mov    %ecx,(%esp)
+  80294a:	f7 db                	neg    %ebx
+  80294c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802950:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802957:	00 
+  802958:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80295d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802964:	00 
+  802965:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802969:	89 cd                	mov    %ecx,%ebp
+  80296b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80296f:	90                   	nop
+  802970:	89 e9                	mov    %ebp,%ecx
+  802972:	89 c3                	mov    %eax,%ebx
+  802974:	89 d6                	mov    %edx,%esi
+  802976:	31 ff                	xor    %edi,%edi
+  802978:	d3 ee                	shr    %cl,%esi
+  80297a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80297d:	f6 c1 20             	test   $0x20,%cl
+  802980:	0f 45 de             	cmovne %esi,%ebx
+  802983:	0f 45 f7             	cmovne %edi,%esi
+  802986:	8b 3c 24             	mov    (%esp),%edi
+  802989:	39 fb                	cmp    %edi,%ebx
+  80298b:	89 f7                	mov    %esi,%edi
+  80298d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802991:	8b 1c 24             	mov    (%esp),%ebx
+  802994:	19 f7                	sbb    %esi,%edi
+  802996:	72 39                	jb     8029d1 <__divdi3+0xd1>
+  802998:	89 e9                	mov    %ebp,%ecx
+  80299a:	89 f7                	mov    %esi,%edi
+  80299c:	89 de                	mov    %ebx,%esi
+  80299e:	0f a5 df             	shld   %cl,%ebx,%edi
+  8029a1:	d3 e6                	shl    %cl,%esi
+  8029a3:	31 db                	xor    %ebx,%ebx
+  8029a5:	f6 c1 20             	test   $0x20,%cl
+  8029a8:	0f 45 fe             	cmovne %esi,%edi
+  8029ab:	0f 45 f3             	cmovne %ebx,%esi
+  8029ae:	29 f0                	sub    %esi,%eax
+  8029b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8029b5:	19 fa                	sbb    %edi,%edx
+  8029b7:	31 ff                	xor    %edi,%edi
+  8029b9:	31 db                	xor    %ebx,%ebx
+  8029bb:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029be:	d3 e6                	shl    %cl,%esi
+  8029c0:	f6 c1 20             	test   $0x20,%cl
+  8029c3:	0f 45 fe             	cmovne %esi,%edi
+  8029c6:	0f 45 f3             	cmovne %ebx,%esi
+  8029c9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8029cd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8029d1:	83 ed 01             	sub    $0x1,%ebp
+  8029d4:	73 9a                	jae    802970 <__divdi3+0x70>
+  8029d6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8029da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029e2:	85 ed                	test   %ebp,%ebp
+  8029e4:	0f 84 47 ff ff ff    	je     802931 <__divdi3+0x31>
+  8029ea:	f7 d8                	neg    %eax
+  8029ec:	83 d2 00             	adc    $0x0,%edx
+  8029ef:	83 c4 1c             	add    $0x1c,%esp
+  8029f2:	5b                   	pop    %ebx
+  8029f3:	f7 da                	neg    %edx
+  8029f5:	5e                   	pop    %esi
+  8029f6:	5f                   	pop    %edi
+  8029f7:	5d                   	pop    %ebp
+  8029f8:	c3                   	ret
+  8029f9:	f7 de                	neg    %esi
+  8029fb:	83 d7 00             	adc    $0x0,%edi
+  8029fe:	f7 df                	neg    %edi
+  802a00:	85 db                	test   %ebx,%ebx
+  802a02:	78 23                	js     802a27 <__divdi3+0x127>
+  802a04:	89 dd                	mov    %ebx,%ebp
+  802a06:	89 c8                	mov    %ecx,%eax
+  802a08:	89 da                	mov    %ebx,%edx
+  802a0a:	09 cd                	or     %ecx,%ebp
+  802a0c:	0f 84 1f ff ff ff    	je     802931 <__divdi3+0x31>
+  802a12:	89 0c 24             	mov    %ecx,(%esp)
+  802a15:	89 f0                	mov    %esi,%eax
+  802a17:	89 fa                	mov    %edi,%edx
+  802a19:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802a1e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a22:	e9 29 ff ff ff       	jmp    802950 <__divdi3+0x50>
+  802a27:	31 ed                	xor    %ebp,%ebp
+  802a29:	e9 10 ff ff ff       	jmp    80293e <__divdi3+0x3e>
+  802a2e:	89 0c 24             	mov    %ecx,(%esp)
+  802a31:	89 f0                	mov    %esi,%eax
+  802a33:	89 fa                	mov    %edi,%edx
+  802a35:	31 ed                	xor    %ebp,%ebp
+  802a37:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a3b:	e9 10 ff ff ff       	jmp    802950 <__divdi3+0x50>
+
+00802a40 <__moddi3>:
+  802a40:	55                   	push   %ebp
+  802a41:	57                   	push   %edi
+  802a42:	56                   	push   %esi
+  802a43:	53                   	push   %ebx
+  802a44:	83 ec 14             	sub    $0x14,%esp
+  802a47:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a4b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a4f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802a53:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802a57:	85 d2                	test   %edx,%edx
+  802a59:	0f 88 9b 00 00 00    	js     802afa <__moddi3+0xba>
+  802a5f:	89 f7                	mov    %esi,%edi
+  802a61:	31 ed                	xor    %ebp,%ebp
+  802a63:	09 cf                	or     %ecx,%edi
+  802a65:	0f 84 83 00 00 00    	je     802aee <__moddi3+0xae>
+  802a6b:	89 cb                	mov    %ecx,%ebx
+  802a6d:	89 f7                	mov    %esi,%edi
+  802a6f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802a73:	f7 db                	neg    %ebx
+  802a75:	83 d7 00             	adc    $0x0,%edi
+  802a78:	f7 df                	neg    %edi
+  802a7a:	0f 49 f7             	cmovns %edi,%esi
+  802a7d:	0f 49 cb             	cmovns %ebx,%ecx
+  802a80:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802a84:	89 0c 24             	mov    %ecx,(%esp)
+  802a87:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a8c:	89 cd                	mov    %ecx,%ebp
+  802a8e:	66 90                	xchg   %ax,%ax
+  802a90:	89 e9                	mov    %ebp,%ecx
+  802a92:	89 c3                	mov    %eax,%ebx
+  802a94:	89 d6                	mov    %edx,%esi
+  802a96:	31 ff                	xor    %edi,%edi
+  802a98:	d3 ee                	shr    %cl,%esi
+  802a9a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a9d:	f6 c1 20             	test   $0x20,%cl
+  802aa0:	0f 45 de             	cmovne %esi,%ebx
+  802aa3:	0f 45 f7             	cmovne %edi,%esi
+  802aa6:	8b 3c 24             	mov    (%esp),%edi
+  802aa9:	39 fb                	cmp    %edi,%ebx
+  802aab:	89 f7                	mov    %esi,%edi
+  802aad:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ab1:	8b 1c 24             	mov    (%esp),%ebx
+  802ab4:	19 f7                	sbb    %esi,%edi
+  802ab6:	72 1a                	jb     802ad2 <__moddi3+0x92>
+  802ab8:	89 e9                	mov    %ebp,%ecx
+  802aba:	89 f7                	mov    %esi,%edi
+  802abc:	89 de                	mov    %ebx,%esi
+  802abe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ac1:	d3 e6                	shl    %cl,%esi
+  802ac3:	31 db                	xor    %ebx,%ebx
+  802ac5:	f6 c1 20             	test   $0x20,%cl
+  802ac8:	0f 45 fe             	cmovne %esi,%edi
+  802acb:	0f 45 f3             	cmovne %ebx,%esi
+  802ace:	29 f0                	sub    %esi,%eax
+  802ad0:	19 fa                	sbb    %edi,%edx
+  802ad2:	83 ed 01             	sub    $0x1,%ebp
+  802ad5:	73 b9                	jae    802a90 <__moddi3+0x50>
+  802ad7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802adb:	85 ed                	test   %ebp,%ebp
+  802add:	74 07                	je     802ae6 <__moddi3+0xa6>
+  802adf:	f7 d8                	neg    %eax
+  802ae1:	83 d2 00             	adc    $0x0,%edx
+  802ae4:	f7 da                	neg    %edx
+  802ae6:	83 c4 14             	add    $0x14,%esp
+  802ae9:	5b                   	pop    %ebx
+  802aea:	5e                   	pop    %esi
+  802aeb:	5f                   	pop    %edi
+  802aec:	5d                   	pop    %ebp
+  802aed:	c3                   	ret
+  802aee:	83 c4 14             	add    $0x14,%esp
+  802af1:	31 c0                	xor    %eax,%eax
+  802af3:	31 d2                	xor    %edx,%edx
+  802af5:	5b                   	pop    %ebx
+  802af6:	5e                   	pop    %esi
+  802af7:	5f                   	pop    %edi
+  802af8:	5d                   	pop    %ebp
+  802af9:	c3                   	ret
+  802afa:	89 f7                	mov    %esi,%edi
+  802afc:	09 cf                	or     %ecx,%edi
+  802afe:	74 11                	je     802b11 <__moddi3+0xd1>
+  802b00:	f7 d8                	neg    %eax
+  802b02:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802b07:	83 d2 00             	adc    $0x0,%edx
+  802b0a:	f7 da                	neg    %edx
+  802b0c:	e9 5a ff ff ff       	jmp    802a6b <__moddi3+0x2b>
+  802b11:	31 c0                	xor    %eax,%eax
+  802b13:	31 d2                	xor    %edx,%edx
+  802b15:	eb c8                	jmp    802adf <__moddi3+0x9f>
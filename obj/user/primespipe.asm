@@ -0,0 +1,6301 @@
+
+obj/user/primespipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 06 02 00 00       	call   800237 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int i, id, p, pfd[2], wfd, r;
+
+	// fetch a prime from our left neighbor
+top:
+	if ((r = readn(fd, &p, 4)) != 4)
+  80003f:	8d 75 e0             	lea    -0x20(%ebp),%esi
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+
+	cprintf("%d\n", p);
+
+	// fork a right neighbor to continue the chain
+	if ((i=pipe(pfd)) < 0)
+  800042:	8d 7d d8             	lea    -0x28(%ebp),%edi
+	if ((r = readn(fd, &p, 4)) != 4)
+  800045:	83 ec 04             	sub    $0x4,%esp
+  800048:	6a 04                	push   $0x4
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	e8 6d 18 00 00       	call   8018be <readn>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	83 f8 04             	cmp    $0x4,%eax
+  800057:	75 49                	jne    8000a2 <primeproc+0x6f>
+	cprintf("%d\n", p);
+  800059:	83 ec 08             	sub    $0x8,%esp
+  80005c:	ff 75 e0             	push   -0x20(%ebp)
+  80005f:	68 a1 2c 80 00       	push   $0x802ca1
+  800064:	e8 09 03 00 00       	call   800372 <cprintf>
+	if ((i=pipe(pfd)) < 0)
+  800069:	89 3c 24             	mov    %edi,(%esp)
+  80006c:	e8 03 23 00 00       	call   802374 <pipe>
+  800071:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 47                	js     8000c2 <primeproc+0x8f>
+		panic("pipe: %e", i);
+	if ((id = fork()) < 0)
+  80007b:	e8 4d 12 00 00       	call   8012cd <fork>
+  800080:	85 c0                	test   %eax,%eax
+  800082:	78 50                	js     8000d4 <primeproc+0xa1>
+		panic("fork: %e", id);
+	if (id == 0) {
+  800084:	75 60                	jne    8000e6 <primeproc+0xb3>
+		close(fd);
+  800086:	83 ec 0c             	sub    $0xc,%esp
+  800089:	53                   	push   %ebx
+  80008a:	e8 6c 16 00 00       	call   8016fb <close>
+		close(pfd[1]);
+  80008f:	83 c4 04             	add    $0x4,%esp
+  800092:	ff 75 dc             	push   -0x24(%ebp)
+  800095:	e8 61 16 00 00       	call   8016fb <close>
+		fd = pfd[0];
+  80009a:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+		goto top;
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	eb a3                	jmp    800045 <primeproc+0x12>
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	85 c0                	test   %eax,%eax
+  8000a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ac:	0f 4e d0             	cmovle %eax,%edx
+  8000af:	52                   	push   %edx
+  8000b0:	50                   	push   %eax
+  8000b1:	68 60 2c 80 00       	push   $0x802c60
+  8000b6:	6a 15                	push   $0x15
+  8000b8:	68 8f 2c 80 00       	push   $0x802c8f
+  8000bd:	e8 d5 01 00 00       	call   800297 <_panic>
+		panic("pipe: %e", i);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 a5 2c 80 00       	push   $0x802ca5
+  8000c8:	6a 1b                	push   $0x1b
+  8000ca:	68 8f 2c 80 00       	push   $0x802c8f
+  8000cf:	e8 c3 01 00 00       	call   800297 <_panic>
+		panic("fork: %e", id);
+  8000d4:	50                   	push   %eax
+  8000d5:	68 c4 30 80 00       	push   $0x8030c4
+  8000da:	6a 1d                	push   $0x1d
+  8000dc:	68 8f 2c 80 00       	push   $0x802c8f
+  8000e1:	e8 b1 01 00 00       	call   800297 <_panic>
+	}
+
+	close(pfd[0]);
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  8000e9:	ff 75 d8             	push   -0x28(%ebp)
+  8000ec:	e8 0a 16 00 00       	call   8016fb <close>
+	wfd = pfd[1];
+  8000f1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8000f4:	83 c4 10             	add    $0x10,%esp
+
+	// filter out multiples of our prime
+	for (;;) {
+		if ((r=readn(fd, &i, 4)) != 4)
+  8000f7:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8000fa:	83 ec 04             	sub    $0x4,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	56                   	push   %esi
+  800100:	53                   	push   %ebx
+  800101:	e8 b8 17 00 00       	call   8018be <readn>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	83 f8 04             	cmp    $0x4,%eax
+  80010c:	75 45                	jne    800153 <primeproc+0x120>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+		if (i%p)
+  80010e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800111:	99                   	cltd
+  800112:	f7 7d e0             	idivl  -0x20(%ebp)
+  800115:	85 d2                	test   %edx,%edx
+  800117:	74 e1                	je     8000fa <primeproc+0xc7>
+			if ((r=write(wfd, &i, 4)) != 4)
+  800119:	83 ec 04             	sub    $0x4,%esp
+  80011c:	6a 04                	push   $0x4
+  80011e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800121:	50                   	push   %eax
+  800122:	57                   	push   %edi
+  800123:	e8 dd 17 00 00       	call   801905 <write>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	83 f8 04             	cmp    $0x4,%eax
+  80012e:	74 ca                	je     8000fa <primeproc+0xc7>
+				panic("primeproc %d write: %d %e", p, r, r >= 0 ? 0 : r);
+  800130:	83 ec 08             	sub    $0x8,%esp
+  800133:	85 c0                	test   %eax,%eax
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	0f 4e d0             	cmovle %eax,%edx
+  80013d:	52                   	push   %edx
+  80013e:	50                   	push   %eax
+  80013f:	ff 75 e0             	push   -0x20(%ebp)
+  800142:	68 ca 2c 80 00       	push   $0x802cca
+  800147:	6a 2e                	push   $0x2e
+  800149:	68 8f 2c 80 00       	push   $0x802c8f
+  80014e:	e8 44 01 00 00       	call   800297 <_panic>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+  800153:	83 ec 04             	sub    $0x4,%esp
+  800156:	85 c0                	test   %eax,%eax
+  800158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015d:	0f 4e d0             	cmovle %eax,%edx
+  800160:	52                   	push   %edx
+  800161:	50                   	push   %eax
+  800162:	53                   	push   %ebx
+  800163:	ff 75 e0             	push   -0x20(%ebp)
+  800166:	68 ae 2c 80 00       	push   $0x802cae
+  80016b:	6a 2b                	push   $0x2b
+  80016d:	68 8f 2c 80 00       	push   $0x802c8f
+  800172:	e8 20 01 00 00       	call   800297 <_panic>
+
+00800177 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800177:	55                   	push   %ebp
+  800178:	89 e5                	mov    %esp,%ebp
+  80017a:	53                   	push   %ebx
+  80017b:	83 ec 20             	sub    $0x20,%esp
+	int i, id, p[2], r;
+
+	binaryname = "primespipe";
+  80017e:	c7 05 00 40 80 00 e4 	movl   $0x802ce4,0x804000
+  800185:	2c 80 00 
+
+	if ((i=pipe(p)) < 0)
+  800188:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 e3 21 00 00       	call   802374 <pipe>
+  800191:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800194:	83 c4 10             	add    $0x10,%esp
+  800197:	85 c0                	test   %eax,%eax
+  800199:	78 21                	js     8001bc <umain+0x45>
+		panic("pipe: %e", i);
+
+	// fork the first prime process in the chain
+	if ((id=fork()) < 0)
+  80019b:	e8 2d 11 00 00       	call   8012cd <fork>
+  8001a0:	85 c0                	test   %eax,%eax
+  8001a2:	78 2a                	js     8001ce <umain+0x57>
+		panic("fork: %e", id);
+
+	if (id == 0) {
+  8001a4:	75 3a                	jne    8001e0 <umain+0x69>
+		close(p[1]);
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  8001a9:	ff 75 f0             	push   -0x10(%ebp)
+  8001ac:	e8 4a 15 00 00       	call   8016fb <close>
+		primeproc(p[0]);
+  8001b1:	83 c4 04             	add    $0x4,%esp
+  8001b4:	ff 75 ec             	push   -0x14(%ebp)
+  8001b7:	e8 77 fe ff ff       	call   800033 <primeproc>
+		panic("pipe: %e", i);
+  8001bc:	50                   	push   %eax
+  8001bd:	68 a5 2c 80 00       	push   $0x802ca5
+  8001c2:	6a 3a                	push   $0x3a
+  8001c4:	68 8f 2c 80 00       	push   $0x802c8f
+  8001c9:	e8 c9 00 00 00       	call   800297 <_panic>
+		panic("fork: %e", id);
+  8001ce:	50                   	push   %eax
+  8001cf:	68 c4 30 80 00       	push   $0x8030c4
+  8001d4:	6a 3e                	push   $0x3e
+  8001d6:	68 8f 2c 80 00       	push   $0x802c8f
+  8001db:	e8 b7 00 00 00       	call   800297 <_panic>
+	}
+
+	close(p[0]);
+  8001e0:	83 ec 0c             	sub    $0xc,%esp
+  8001e3:	ff 75 ec             	push   -0x14(%ebp)
+  8001e6:	e8 10 15 00 00       	call   8016fb <close>
+  8001eb:	83 c4 10             	add    $0x10,%esp
+  8001ee:	b8 02 00 00 00       	mov    $0x2,%eax
+
+	// feed all the integers through
+	for (i=2;; i++)
+		if ((r=write(p[1], &i, 4)) != 4)
+  8001f3:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8001f6:	eb 06                	jmp    8001fe <umain+0x87>
+	for (i=2;; i++)
+  8001f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001fb:	83 c0 01             	add    $0x1,%eax
+  8001fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+		if ((r=write(p[1], &i, 4)) != 4)
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	6a 04                	push   $0x4
+  800206:	53                   	push   %ebx
+  800207:	ff 75 f0             	push   -0x10(%ebp)
+  80020a:	e8 f6 16 00 00       	call   801905 <write>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	83 f8 04             	cmp    $0x4,%eax
+  800215:	74 e1                	je     8001f8 <umain+0x81>
+			panic("generator write: %d, %e", r, r >= 0 ? 0 : r);
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	85 c0                	test   %eax,%eax
+  80021c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800221:	0f 4e d0             	cmovle %eax,%edx
+  800224:	52                   	push   %edx
+  800225:	50                   	push   %eax
+  800226:	68 ef 2c 80 00       	push   $0x802cef
+  80022b:	6a 4a                	push   $0x4a
+  80022d:	68 8f 2c 80 00       	push   $0x802c8f
+  800232:	e8 60 00 00 00       	call   800297 <_panic>
+
+00800237 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	56                   	push   %esi
+  80023b:	53                   	push   %ebx
+  80023c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80023f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800242:	e8 e7 0a 00 00       	call   800d2e <sys_getenvid>
+  800247:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80024c:	c1 e0 09             	shl    $0x9,%eax
+  80024f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800254:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800259:	85 db                	test   %ebx,%ebx
+  80025b:	7e 07                	jle    800264 <libmain+0x2d>
+		binaryname = argv[0];
+  80025d:	8b 06                	mov    (%esi),%eax
+  80025f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800264:	83 ec 08             	sub    $0x8,%esp
+  800267:	56                   	push   %esi
+  800268:	53                   	push   %ebx
+  800269:	e8 09 ff ff ff       	call   800177 <umain>
+
+	// exit gracefully
+	exit();
+  80026e:	e8 0a 00 00 00       	call   80027d <exit>
+}
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800279:	5b                   	pop    %ebx
+  80027a:	5e                   	pop    %esi
+  80027b:	5d                   	pop    %ebp
+  80027c:	c3                   	ret
+
+0080027d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800283:	e8 a0 14 00 00       	call   801728 <close_all>
+	sys_env_destroy(0);
+  800288:	83 ec 0c             	sub    $0xc,%esp
+  80028b:	6a 00                	push   $0x0
+  80028d:	e8 5b 0a 00 00       	call   800ced <sys_env_destroy>
+}
+  800292:	83 c4 10             	add    $0x10,%esp
+  800295:	c9                   	leave
+  800296:	c3                   	ret
+
+00800297 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	56                   	push   %esi
+  80029b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80029c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80029f:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8002a5:	e8 84 0a 00 00       	call   800d2e <sys_getenvid>
+  8002aa:	83 ec 0c             	sub    $0xc,%esp
+  8002ad:	ff 75 0c             	push   0xc(%ebp)
+  8002b0:	ff 75 08             	push   0x8(%ebp)
+  8002b3:	56                   	push   %esi
+  8002b4:	50                   	push   %eax
+  8002b5:	68 14 2d 80 00       	push   $0x802d14
+  8002ba:	e8 b3 00 00 00       	call   800372 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002bf:	83 c4 18             	add    $0x18,%esp
+  8002c2:	53                   	push   %ebx
+  8002c3:	ff 75 10             	push   0x10(%ebp)
+  8002c6:	e8 56 00 00 00       	call   800321 <vcprintf>
+	cprintf("\n");
+  8002cb:	c7 04 24 a3 2c 80 00 	movl   $0x802ca3,(%esp)
+  8002d2:	e8 9b 00 00 00       	call   800372 <cprintf>
+  8002d7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002da:	cc                   	int3
+	while (1)
+  8002db:	eb fd                	jmp    8002da <_panic+0x43>
+
+008002dd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002dd:	55                   	push   %ebp
+  8002de:	89 e5                	mov    %esp,%ebp
+  8002e0:	53                   	push   %ebx
+  8002e1:	83 ec 04             	sub    $0x4,%esp
+  8002e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002e7:	8b 13                	mov    (%ebx),%edx
+  8002e9:	8d 42 01             	lea    0x1(%edx),%eax
+  8002ec:	89 03                	mov    %eax,(%ebx)
+  8002ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002f1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002f5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002fa:	74 09                	je     800305 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002fc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800300:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800303:	c9                   	leave
+  800304:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800305:	83 ec 08             	sub    $0x8,%esp
+  800308:	68 ff 00 00 00       	push   $0xff
+  80030d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800310:	50                   	push   %eax
+  800311:	e8 7a 09 00 00       	call   800c90 <sys_cputs>
+		b->idx = 0;
+  800316:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	eb db                	jmp    8002fc <putch+0x1f>
+
+00800321 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800321:	55                   	push   %ebp
+  800322:	89 e5                	mov    %esp,%ebp
+  800324:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80032a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800331:	00 00 00 
+	b.cnt = 0;
+  800334:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80033b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80033e:	ff 75 0c             	push   0xc(%ebp)
+  800341:	ff 75 08             	push   0x8(%ebp)
+  800344:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80034a:	50                   	push   %eax
+  80034b:	68 dd 02 80 00       	push   $0x8002dd
+  800350:	e8 14 01 00 00       	call   800469 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800355:	83 c4 08             	add    $0x8,%esp
+  800358:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80035e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800364:	50                   	push   %eax
+  800365:	e8 26 09 00 00       	call   800c90 <sys_cputs>
+
+	return b.cnt;
+}
+  80036a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800370:	c9                   	leave
+  800371:	c3                   	ret
+
+00800372 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800372:	55                   	push   %ebp
+  800373:	89 e5                	mov    %esp,%ebp
+  800375:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800378:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80037b:	50                   	push   %eax
+  80037c:	ff 75 08             	push   0x8(%ebp)
+  80037f:	e8 9d ff ff ff       	call   800321 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800384:	c9                   	leave
+  800385:	c3                   	ret
+
+00800386 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800386:	55                   	push   %ebp
+  800387:	89 e5                	mov    %esp,%ebp
+  800389:	57                   	push   %edi
+  80038a:	56                   	push   %esi
+  80038b:	53                   	push   %ebx
+  80038c:	83 ec 1c             	sub    $0x1c,%esp
+  80038f:	89 c7                	mov    %eax,%edi
+  800391:	89 d6                	mov    %edx,%esi
+  800393:	8b 45 08             	mov    0x8(%ebp),%eax
+  800396:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800399:	89 d1                	mov    %edx,%ecx
+  80039b:	89 c2                	mov    %eax,%edx
+  80039d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003a0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003a3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003a6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003b3:	39 c2                	cmp    %eax,%edx
+  8003b5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003b8:	72 3e                	jb     8003f8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003ba:	83 ec 0c             	sub    $0xc,%esp
+  8003bd:	ff 75 18             	push   0x18(%ebp)
+  8003c0:	83 eb 01             	sub    $0x1,%ebx
+  8003c3:	53                   	push   %ebx
+  8003c4:	50                   	push   %eax
+  8003c5:	83 ec 08             	sub    $0x8,%esp
+  8003c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8003cb:	ff 75 e0             	push   -0x20(%ebp)
+  8003ce:	ff 75 dc             	push   -0x24(%ebp)
+  8003d1:	ff 75 d8             	push   -0x28(%ebp)
+  8003d4:	e8 17 25 00 00       	call   8028f0 <__udivdi3>
+  8003d9:	83 c4 18             	add    $0x18,%esp
+  8003dc:	52                   	push   %edx
+  8003dd:	50                   	push   %eax
+  8003de:	89 f2                	mov    %esi,%edx
+  8003e0:	89 f8                	mov    %edi,%eax
+  8003e2:	e8 9f ff ff ff       	call   800386 <printnum>
+  8003e7:	83 c4 20             	add    $0x20,%esp
+  8003ea:	eb 13                	jmp    8003ff <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003ec:	83 ec 08             	sub    $0x8,%esp
+  8003ef:	56                   	push   %esi
+  8003f0:	ff 75 18             	push   0x18(%ebp)
+  8003f3:	ff d7                	call   *%edi
+  8003f5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003f8:	83 eb 01             	sub    $0x1,%ebx
+  8003fb:	85 db                	test   %ebx,%ebx
+  8003fd:	7f ed                	jg     8003ec <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003ff:	83 ec 08             	sub    $0x8,%esp
+  800402:	56                   	push   %esi
+  800403:	83 ec 04             	sub    $0x4,%esp
+  800406:	ff 75 e4             	push   -0x1c(%ebp)
+  800409:	ff 75 e0             	push   -0x20(%ebp)
+  80040c:	ff 75 dc             	push   -0x24(%ebp)
+  80040f:	ff 75 d8             	push   -0x28(%ebp)
+  800412:	e8 99 25 00 00       	call   8029b0 <__umoddi3>
+  800417:	83 c4 14             	add    $0x14,%esp
+  80041a:	0f be 80 37 2d 80 00 	movsbl 0x802d37(%eax),%eax
+  800421:	50                   	push   %eax
+  800422:	ff d7                	call   *%edi
+}
+  800424:	83 c4 10             	add    $0x10,%esp
+  800427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042a:	5b                   	pop    %ebx
+  80042b:	5e                   	pop    %esi
+  80042c:	5f                   	pop    %edi
+  80042d:	5d                   	pop    %ebp
+  80042e:	c3                   	ret
+
+0080042f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80042f:	55                   	push   %ebp
+  800430:	89 e5                	mov    %esp,%ebp
+  800432:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800435:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800439:	8b 10                	mov    (%eax),%edx
+  80043b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80043e:	73 0a                	jae    80044a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800440:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800443:	89 08                	mov    %ecx,(%eax)
+  800445:	8b 45 08             	mov    0x8(%ebp),%eax
+  800448:	88 02                	mov    %al,(%edx)
+}
+  80044a:	5d                   	pop    %ebp
+  80044b:	c3                   	ret
+
+0080044c <printfmt>:
+{
+  80044c:	55                   	push   %ebp
+  80044d:	89 e5                	mov    %esp,%ebp
+  80044f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800452:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800455:	50                   	push   %eax
+  800456:	ff 75 10             	push   0x10(%ebp)
+  800459:	ff 75 0c             	push   0xc(%ebp)
+  80045c:	ff 75 08             	push   0x8(%ebp)
+  80045f:	e8 05 00 00 00       	call   800469 <vprintfmt>
+}
+  800464:	83 c4 10             	add    $0x10,%esp
+  800467:	c9                   	leave
+  800468:	c3                   	ret
+
+00800469 <vprintfmt>:
+{
+  800469:	55                   	push   %ebp
+  80046a:	89 e5                	mov    %esp,%ebp
+  80046c:	57                   	push   %edi
+  80046d:	56                   	push   %esi
+  80046e:	53                   	push   %ebx
+  80046f:	83 ec 2c             	sub    $0x2c,%esp
+  800472:	8b 75 08             	mov    0x8(%ebp),%esi
+  800475:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800478:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80047b:	eb 0a                	jmp    800487 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80047d:	83 ec 08             	sub    $0x8,%esp
+  800480:	53                   	push   %ebx
+  800481:	50                   	push   %eax
+  800482:	ff d6                	call   *%esi
+  800484:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800487:	83 c7 01             	add    $0x1,%edi
+  80048a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80048e:	83 f8 25             	cmp    $0x25,%eax
+  800491:	74 0c                	je     80049f <vprintfmt+0x36>
+			if (ch == '\0')
+  800493:	85 c0                	test   %eax,%eax
+  800495:	75 e6                	jne    80047d <vprintfmt+0x14>
+}
+  800497:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80049a:	5b                   	pop    %ebx
+  80049b:	5e                   	pop    %esi
+  80049c:	5f                   	pop    %edi
+  80049d:	5d                   	pop    %ebp
+  80049e:	c3                   	ret
+		padc = ' ';
+  80049f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004a3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004aa:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004b1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bd:	8d 47 01             	lea    0x1(%edi),%eax
+  8004c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004c3:	0f b6 17             	movzbl (%edi),%edx
+  8004c6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004c9:	3c 55                	cmp    $0x55,%al
+  8004cb:	0f 87 cf 03 00 00    	ja     8008a0 <vprintfmt+0x437>
+  8004d1:	0f b6 c0             	movzbl %al,%eax
+  8004d4:	ff 24 85 80 2e 80 00 	jmp    *0x802e80(,%eax,4)
+  8004db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004de:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004e2:	eb d9                	jmp    8004bd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004e7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004eb:	eb d0                	jmp    8004bd <vprintfmt+0x54>
+  8004ed:	0f b6 d2             	movzbl %dl,%edx
+  8004f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004fb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004fe:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800502:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800505:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800508:	83 f9 09             	cmp    $0x9,%ecx
+  80050b:	77 55                	ja     800562 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80050d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800510:	eb e9                	jmp    8004fb <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800512:	8b 45 14             	mov    0x14(%ebp),%eax
+  800515:	8b 00                	mov    (%eax),%eax
+  800517:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80051a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051d:	8d 40 04             	lea    0x4(%eax),%eax
+  800520:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800523:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800526:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80052a:	79 91                	jns    8004bd <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80052c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80052f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800532:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800539:	eb 82                	jmp    8004bd <vprintfmt+0x54>
+			if (width < 0)
+  80053b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80053e:	85 d2                	test   %edx,%edx
+  800540:	b8 00 00 00 00       	mov    $0x0,%eax
+  800545:	0f 49 c2             	cmovns %edx,%eax
+  800548:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80054b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80054e:	e9 6a ff ff ff       	jmp    8004bd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800553:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800556:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80055d:	e9 5b ff ff ff       	jmp    8004bd <vprintfmt+0x54>
+  800562:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800565:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800568:	eb bc                	jmp    800526 <vprintfmt+0xbd>
+			lflag++;
+  80056a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80056d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800570:	e9 48 ff ff ff       	jmp    8004bd <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800575:	8b 45 14             	mov    0x14(%ebp),%eax
+  800578:	8d 78 04             	lea    0x4(%eax),%edi
+  80057b:	83 ec 08             	sub    $0x8,%esp
+  80057e:	53                   	push   %ebx
+  80057f:	ff 30                	push   (%eax)
+  800581:	ff d6                	call   *%esi
+			break;
+  800583:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800586:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800589:	e9 b1 02 00 00       	jmp    80083f <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800594:	8b 10                	mov    (%eax),%edx
+  800596:	89 d0                	mov    %edx,%eax
+  800598:	f7 d8                	neg    %eax
+  80059a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80059d:	83 f8 0f             	cmp    $0xf,%eax
+  8005a0:	7f 23                	jg     8005c5 <vprintfmt+0x15c>
+  8005a2:	8b 14 85 e0 2f 80 00 	mov    0x802fe0(,%eax,4),%edx
+  8005a9:	85 d2                	test   %edx,%edx
+  8005ab:	74 18                	je     8005c5 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005ad:	52                   	push   %edx
+  8005ae:	68 09 32 80 00       	push   $0x803209
+  8005b3:	53                   	push   %ebx
+  8005b4:	56                   	push   %esi
+  8005b5:	e8 92 fe ff ff       	call   80044c <printfmt>
+  8005ba:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005bd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005c0:	e9 7a 02 00 00       	jmp    80083f <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8005c5:	50                   	push   %eax
+  8005c6:	68 4f 2d 80 00       	push   $0x802d4f
+  8005cb:	53                   	push   %ebx
+  8005cc:	56                   	push   %esi
+  8005cd:	e8 7a fe ff ff       	call   80044c <printfmt>
+  8005d2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005d5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005d8:	e9 62 02 00 00       	jmp    80083f <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	83 c0 04             	add    $0x4,%eax
+  8005e3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005eb:	85 c9                	test   %ecx,%ecx
+  8005ed:	b8 48 2d 80 00       	mov    $0x802d48,%eax
+  8005f2:	0f 45 c1             	cmovne %ecx,%eax
+  8005f5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005f8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005fc:	7e 06                	jle    800604 <vprintfmt+0x19b>
+  8005fe:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800602:	75 0b                	jne    80060f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800604:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800607:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80060a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80060d:	eb 5c                	jmp    80066b <vprintfmt+0x202>
+  80060f:	83 ec 08             	sub    $0x8,%esp
+  800612:	ff 75 d0             	push   -0x30(%ebp)
+  800615:	ff 75 cc             	push   -0x34(%ebp)
+  800618:	e8 20 03 00 00       	call   80093d <strnlen>
+  80061d:	89 c2                	mov    %eax,%edx
+  80061f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800622:	29 d0                	sub    %edx,%eax
+  800624:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800627:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80062b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80062e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800631:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800633:	eb 0e                	jmp    800643 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800635:	83 ec 08             	sub    $0x8,%esp
+  800638:	53                   	push   %ebx
+  800639:	57                   	push   %edi
+  80063a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80063d:	83 ee 01             	sub    $0x1,%esi
+  800640:	83 c4 10             	add    $0x10,%esp
+  800643:	85 f6                	test   %esi,%esi
+  800645:	7f ee                	jg     800635 <vprintfmt+0x1cc>
+  800647:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80064a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064d:	85 c0                	test   %eax,%eax
+  80064f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800654:	0f 49 d0             	cmovns %eax,%edx
+  800657:	29 d0                	sub    %edx,%eax
+  800659:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80065c:	eb a6                	jmp    800604 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80065e:	83 ec 08             	sub    $0x8,%esp
+  800661:	53                   	push   %ebx
+  800662:	52                   	push   %edx
+  800663:	ff 55 08             	call   *0x8(%ebp)
+  800666:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800669:	89 f1                	mov    %esi,%ecx
+  80066b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80066e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800672:	0f be d0             	movsbl %al,%edx
+  800675:	85 d2                	test   %edx,%edx
+  800677:	74 28                	je     8006a1 <vprintfmt+0x238>
+  800679:	85 ff                	test   %edi,%edi
+  80067b:	78 05                	js     800682 <vprintfmt+0x219>
+  80067d:	83 ef 01             	sub    $0x1,%edi
+  800680:	78 30                	js     8006b2 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800682:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800686:	74 d6                	je     80065e <vprintfmt+0x1f5>
+  800688:	0f be c0             	movsbl %al,%eax
+  80068b:	83 e8 20             	sub    $0x20,%eax
+  80068e:	83 f8 5e             	cmp    $0x5e,%eax
+  800691:	76 cb                	jbe    80065e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800693:	83 ec 08             	sub    $0x8,%esp
+  800696:	53                   	push   %ebx
+  800697:	6a 3f                	push   $0x3f
+  800699:	ff 55 08             	call   *0x8(%ebp)
+  80069c:	83 c4 10             	add    $0x10,%esp
+  80069f:	eb c8                	jmp    800669 <vprintfmt+0x200>
+  8006a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006a4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006a7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006aa:	01 d0                	add    %edx,%eax
+  8006ac:	29 c8                	sub    %ecx,%eax
+  8006ae:	89 c7                	mov    %eax,%edi
+  8006b0:	eb 13                	jmp    8006c5 <vprintfmt+0x25c>
+  8006b2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b5:	eb ed                	jmp    8006a4 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006b7:	83 ec 08             	sub    $0x8,%esp
+  8006ba:	53                   	push   %ebx
+  8006bb:	6a 20                	push   $0x20
+  8006bd:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006bf:	83 ef 01             	sub    $0x1,%edi
+  8006c2:	83 c4 10             	add    $0x10,%esp
+  8006c5:	85 ff                	test   %edi,%edi
+  8006c7:	7f ee                	jg     8006b7 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006c9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006cf:	e9 6b 01 00 00       	jmp    80083f <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8006d4:	83 f9 01             	cmp    $0x1,%ecx
+  8006d7:	7f 1f                	jg     8006f8 <vprintfmt+0x28f>
+	else if (lflag)
+  8006d9:	85 c9                	test   %ecx,%ecx
+  8006db:	74 67                	je     800744 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8006dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e0:	8b 00                	mov    (%eax),%eax
+  8006e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e5:	89 c1                	mov    %eax,%ecx
+  8006e7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006ea:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f6:	eb 17                	jmp    80070f <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8006f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fb:	8b 50 04             	mov    0x4(%eax),%edx
+  8006fe:	8b 00                	mov    (%eax),%eax
+  800700:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800703:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800706:	8b 45 14             	mov    0x14(%ebp),%eax
+  800709:	8d 40 08             	lea    0x8(%eax),%eax
+  80070c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80070f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800712:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800715:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80071a:	85 c9                	test   %ecx,%ecx
+  80071c:	0f 89 03 01 00 00    	jns    800825 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800722:	83 ec 08             	sub    $0x8,%esp
+  800725:	53                   	push   %ebx
+  800726:	6a 2d                	push   $0x2d
+  800728:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80072a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80072d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800730:	f7 da                	neg    %edx
+  800732:	83 d1 00             	adc    $0x0,%ecx
+  800735:	f7 d9                	neg    %ecx
+  800737:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80073a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80073f:	e9 e1 00 00 00       	jmp    800825 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800744:	8b 45 14             	mov    0x14(%ebp),%eax
+  800747:	8b 00                	mov    (%eax),%eax
+  800749:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80074c:	89 c1                	mov    %eax,%ecx
+  80074e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800751:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800754:	8b 45 14             	mov    0x14(%ebp),%eax
+  800757:	8d 40 04             	lea    0x4(%eax),%eax
+  80075a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80075d:	eb b0                	jmp    80070f <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80075f:	83 f9 01             	cmp    $0x1,%ecx
+  800762:	7f 1e                	jg     800782 <vprintfmt+0x319>
+	else if (lflag)
+  800764:	85 c9                	test   %ecx,%ecx
+  800766:	74 32                	je     80079a <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	8b 10                	mov    (%eax),%edx
+  80076d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800772:	8d 40 04             	lea    0x4(%eax),%eax
+  800775:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800778:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80077d:	e9 a3 00 00 00       	jmp    800825 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800782:	8b 45 14             	mov    0x14(%ebp),%eax
+  800785:	8b 10                	mov    (%eax),%edx
+  800787:	8b 48 04             	mov    0x4(%eax),%ecx
+  80078a:	8d 40 08             	lea    0x8(%eax),%eax
+  80078d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800790:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800795:	e9 8b 00 00 00       	jmp    800825 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80079a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079d:	8b 10                	mov    (%eax),%edx
+  80079f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007aa:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007af:	eb 74                	jmp    800825 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8007b1:	83 f9 01             	cmp    $0x1,%ecx
+  8007b4:	7f 1b                	jg     8007d1 <vprintfmt+0x368>
+	else if (lflag)
+  8007b6:	85 c9                	test   %ecx,%ecx
+  8007b8:	74 2c                	je     8007e6 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8007ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bd:	8b 10                	mov    (%eax),%edx
+  8007bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ca:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8007cf:	eb 54                	jmp    800825 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d4:	8b 10                	mov    (%eax),%edx
+  8007d6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d9:	8d 40 08             	lea    0x8(%eax),%eax
+  8007dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007df:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8007e4:	eb 3f                	jmp    800825 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8b 10                	mov    (%eax),%edx
+  8007eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007f6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007fb:	eb 28                	jmp    800825 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8007fd:	83 ec 08             	sub    $0x8,%esp
+  800800:	53                   	push   %ebx
+  800801:	6a 30                	push   $0x30
+  800803:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800805:	83 c4 08             	add    $0x8,%esp
+  800808:	53                   	push   %ebx
+  800809:	6a 78                	push   $0x78
+  80080b:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80080d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800810:	8b 10                	mov    (%eax),%edx
+  800812:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800817:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80081a:	8d 40 04             	lea    0x4(%eax),%eax
+  80081d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800820:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800825:	83 ec 0c             	sub    $0xc,%esp
+  800828:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80082c:	50                   	push   %eax
+  80082d:	ff 75 e0             	push   -0x20(%ebp)
+  800830:	57                   	push   %edi
+  800831:	51                   	push   %ecx
+  800832:	52                   	push   %edx
+  800833:	89 da                	mov    %ebx,%edx
+  800835:	89 f0                	mov    %esi,%eax
+  800837:	e8 4a fb ff ff       	call   800386 <printnum>
+			break;
+  80083c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80083f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800842:	e9 40 fc ff ff       	jmp    800487 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800847:	83 f9 01             	cmp    $0x1,%ecx
+  80084a:	7f 1b                	jg     800867 <vprintfmt+0x3fe>
+	else if (lflag)
+  80084c:	85 c9                	test   %ecx,%ecx
+  80084e:	74 2c                	je     80087c <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800850:	8b 45 14             	mov    0x14(%ebp),%eax
+  800853:	8b 10                	mov    (%eax),%edx
+  800855:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80085a:	8d 40 04             	lea    0x4(%eax),%eax
+  80085d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800860:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800865:	eb be                	jmp    800825 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800867:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086a:	8b 10                	mov    (%eax),%edx
+  80086c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80086f:	8d 40 08             	lea    0x8(%eax),%eax
+  800872:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800875:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80087a:	eb a9                	jmp    800825 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80087c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087f:	8b 10                	mov    (%eax),%edx
+  800881:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800886:	8d 40 04             	lea    0x4(%eax),%eax
+  800889:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80088c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800891:	eb 92                	jmp    800825 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800893:	83 ec 08             	sub    $0x8,%esp
+  800896:	53                   	push   %ebx
+  800897:	6a 25                	push   $0x25
+  800899:	ff d6                	call   *%esi
+			break;
+  80089b:	83 c4 10             	add    $0x10,%esp
+  80089e:	eb 9f                	jmp    80083f <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8008a0:	83 ec 08             	sub    $0x8,%esp
+  8008a3:	53                   	push   %ebx
+  8008a4:	6a 25                	push   $0x25
+  8008a6:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008a8:	83 c4 10             	add    $0x10,%esp
+  8008ab:	89 f8                	mov    %edi,%eax
+  8008ad:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008b1:	74 05                	je     8008b8 <vprintfmt+0x44f>
+  8008b3:	83 e8 01             	sub    $0x1,%eax
+  8008b6:	eb f5                	jmp    8008ad <vprintfmt+0x444>
+  8008b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008bb:	eb 82                	jmp    80083f <vprintfmt+0x3d6>
+
+008008bd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	83 ec 18             	sub    $0x18,%esp
+  8008c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008c9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008cc:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008d0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008d3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008da:	85 c0                	test   %eax,%eax
+  8008dc:	74 26                	je     800904 <vsnprintf+0x47>
+  8008de:	85 d2                	test   %edx,%edx
+  8008e0:	7e 22                	jle    800904 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008e2:	ff 75 14             	push   0x14(%ebp)
+  8008e5:	ff 75 10             	push   0x10(%ebp)
+  8008e8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008eb:	50                   	push   %eax
+  8008ec:	68 2f 04 80 00       	push   $0x80042f
+  8008f1:	e8 73 fb ff ff       	call   800469 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008f6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008f9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008ff:	83 c4 10             	add    $0x10,%esp
+}
+  800902:	c9                   	leave
+  800903:	c3                   	ret
+		return -E_INVAL;
+  800904:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800909:	eb f7                	jmp    800902 <vsnprintf+0x45>
+
+0080090b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80090b:	55                   	push   %ebp
+  80090c:	89 e5                	mov    %esp,%ebp
+  80090e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800911:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800914:	50                   	push   %eax
+  800915:	ff 75 10             	push   0x10(%ebp)
+  800918:	ff 75 0c             	push   0xc(%ebp)
+  80091b:	ff 75 08             	push   0x8(%ebp)
+  80091e:	e8 9a ff ff ff       	call   8008bd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800923:	c9                   	leave
+  800924:	c3                   	ret
+
+00800925 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800925:	55                   	push   %ebp
+  800926:	89 e5                	mov    %esp,%ebp
+  800928:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80092b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800930:	eb 03                	jmp    800935 <strlen+0x10>
+		n++;
+  800932:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800935:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800939:	75 f7                	jne    800932 <strlen+0xd>
+	return n;
+}
+  80093b:	5d                   	pop    %ebp
+  80093c:	c3                   	ret
+
+0080093d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80093d:	55                   	push   %ebp
+  80093e:	89 e5                	mov    %esp,%ebp
+  800940:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800943:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094b:	eb 03                	jmp    800950 <strnlen+0x13>
+		n++;
+  80094d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800950:	39 d0                	cmp    %edx,%eax
+  800952:	74 08                	je     80095c <strnlen+0x1f>
+  800954:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800958:	75 f3                	jne    80094d <strnlen+0x10>
+  80095a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80095c:	89 d0                	mov    %edx,%eax
+  80095e:	5d                   	pop    %ebp
+  80095f:	c3                   	ret
+
+00800960 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	53                   	push   %ebx
+  800964:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800967:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80096a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800973:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800976:	83 c0 01             	add    $0x1,%eax
+  800979:	84 d2                	test   %dl,%dl
+  80097b:	75 f2                	jne    80096f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80097d:	89 c8                	mov    %ecx,%eax
+  80097f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800982:	c9                   	leave
+  800983:	c3                   	ret
+
+00800984 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800984:	55                   	push   %ebp
+  800985:	89 e5                	mov    %esp,%ebp
+  800987:	53                   	push   %ebx
+  800988:	83 ec 10             	sub    $0x10,%esp
+  80098b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80098e:	53                   	push   %ebx
+  80098f:	e8 91 ff ff ff       	call   800925 <strlen>
+  800994:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800997:	ff 75 0c             	push   0xc(%ebp)
+  80099a:	01 d8                	add    %ebx,%eax
+  80099c:	50                   	push   %eax
+  80099d:	e8 be ff ff ff       	call   800960 <strcpy>
+	return dst;
+}
+  8009a2:	89 d8                	mov    %ebx,%eax
+  8009a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a7:	c9                   	leave
+  8009a8:	c3                   	ret
+
+008009a9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	56                   	push   %esi
+  8009ad:	53                   	push   %ebx
+  8009ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009b4:	89 f3                	mov    %esi,%ebx
+  8009b6:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009b9:	89 f0                	mov    %esi,%eax
+  8009bb:	eb 0f                	jmp    8009cc <strncpy+0x23>
+		*dst++ = *src;
+  8009bd:	83 c0 01             	add    $0x1,%eax
+  8009c0:	0f b6 0a             	movzbl (%edx),%ecx
+  8009c3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009c6:	80 f9 01             	cmp    $0x1,%cl
+  8009c9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009cc:	39 d8                	cmp    %ebx,%eax
+  8009ce:	75 ed                	jne    8009bd <strncpy+0x14>
+	}
+	return ret;
+}
+  8009d0:	89 f0                	mov    %esi,%eax
+  8009d2:	5b                   	pop    %ebx
+  8009d3:	5e                   	pop    %esi
+  8009d4:	5d                   	pop    %ebp
+  8009d5:	c3                   	ret
+
+008009d6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009d6:	55                   	push   %ebp
+  8009d7:	89 e5                	mov    %esp,%ebp
+  8009d9:	56                   	push   %esi
+  8009da:	53                   	push   %ebx
+  8009db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009e4:	89 f0                	mov    %esi,%eax
+  8009e6:	85 d2                	test   %edx,%edx
+  8009e8:	74 21                	je     800a0b <strlcpy+0x35>
+  8009ea:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009ee:	89 f2                	mov    %esi,%edx
+  8009f0:	eb 09                	jmp    8009fb <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009f2:	83 c1 01             	add    $0x1,%ecx
+  8009f5:	83 c2 01             	add    $0x1,%edx
+  8009f8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009fb:	39 c2                	cmp    %eax,%edx
+  8009fd:	74 09                	je     800a08 <strlcpy+0x32>
+  8009ff:	0f b6 19             	movzbl (%ecx),%ebx
+  800a02:	84 db                	test   %bl,%bl
+  800a04:	75 ec                	jne    8009f2 <strlcpy+0x1c>
+  800a06:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a08:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a0b:	29 f0                	sub    %esi,%eax
+}
+  800a0d:	5b                   	pop    %ebx
+  800a0e:	5e                   	pop    %esi
+  800a0f:	5d                   	pop    %ebp
+  800a10:	c3                   	ret
+
+00800a11 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a17:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a1a:	eb 06                	jmp    800a22 <strcmp+0x11>
+		p++, q++;
+  800a1c:	83 c1 01             	add    $0x1,%ecx
+  800a1f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a22:	0f b6 01             	movzbl (%ecx),%eax
+  800a25:	84 c0                	test   %al,%al
+  800a27:	74 04                	je     800a2d <strcmp+0x1c>
+  800a29:	3a 02                	cmp    (%edx),%al
+  800a2b:	74 ef                	je     800a1c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a2d:	0f b6 c0             	movzbl %al,%eax
+  800a30:	0f b6 12             	movzbl (%edx),%edx
+  800a33:	29 d0                	sub    %edx,%eax
+}
+  800a35:	5d                   	pop    %ebp
+  800a36:	c3                   	ret
+
+00800a37 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	53                   	push   %ebx
+  800a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a41:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a44:	eb 09                	jmp    800a4f <strncmp+0x18>
+		n--, p++, q++;
+  800a46:	83 ea 01             	sub    $0x1,%edx
+  800a49:	83 c0 01             	add    $0x1,%eax
+  800a4c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a4f:	85 d2                	test   %edx,%edx
+  800a51:	74 18                	je     800a6b <strncmp+0x34>
+  800a53:	0f b6 18             	movzbl (%eax),%ebx
+  800a56:	84 db                	test   %bl,%bl
+  800a58:	74 04                	je     800a5e <strncmp+0x27>
+  800a5a:	3a 19                	cmp    (%ecx),%bl
+  800a5c:	74 e8                	je     800a46 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a5e:	0f b6 00             	movzbl (%eax),%eax
+  800a61:	0f b6 11             	movzbl (%ecx),%edx
+  800a64:	29 d0                	sub    %edx,%eax
+}
+  800a66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a69:	c9                   	leave
+  800a6a:	c3                   	ret
+		return 0;
+  800a6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a70:	eb f4                	jmp    800a66 <strncmp+0x2f>
+
+00800a72 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a72:	55                   	push   %ebp
+  800a73:	89 e5                	mov    %esp,%ebp
+  800a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a78:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a7c:	eb 03                	jmp    800a81 <strchr+0xf>
+  800a7e:	83 c0 01             	add    $0x1,%eax
+  800a81:	0f b6 10             	movzbl (%eax),%edx
+  800a84:	84 d2                	test   %dl,%dl
+  800a86:	74 06                	je     800a8e <strchr+0x1c>
+		if (*s == c)
+  800a88:	38 ca                	cmp    %cl,%dl
+  800a8a:	75 f2                	jne    800a7e <strchr+0xc>
+  800a8c:	eb 05                	jmp    800a93 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a93:	5d                   	pop    %ebp
+  800a94:	c3                   	ret
+
+00800a95 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a95:	55                   	push   %ebp
+  800a96:	89 e5                	mov    %esp,%ebp
+  800a98:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a9f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800aa2:	38 ca                	cmp    %cl,%dl
+  800aa4:	74 09                	je     800aaf <strfind+0x1a>
+  800aa6:	84 d2                	test   %dl,%dl
+  800aa8:	74 05                	je     800aaf <strfind+0x1a>
+	for (; *s; s++)
+  800aaa:	83 c0 01             	add    $0x1,%eax
+  800aad:	eb f0                	jmp    800a9f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800aaf:	5d                   	pop    %ebp
+  800ab0:	c3                   	ret
+
+00800ab1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	57                   	push   %edi
+  800ab5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ab8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800abb:	85 c9                	test   %ecx,%ecx
+  800abd:	74 20                	je     800adf <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800abf:	89 f8                	mov    %edi,%eax
+  800ac1:	09 c8                	or     %ecx,%eax
+  800ac3:	a8 03                	test   $0x3,%al
+  800ac5:	75 12                	jne    800ad9 <memset+0x28>
+		c &= 0xFF;
+  800ac7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800acb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ad1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ad4:	fc                   	cld
+  800ad5:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ad7:	eb 06                	jmp    800adf <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ad9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800adc:	fc                   	cld
+  800add:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800adf:	89 f8                	mov    %edi,%eax
+  800ae1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ae4:	c9                   	leave
+  800ae5:	c3                   	ret
+
+00800ae6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ae6:	55                   	push   %ebp
+  800ae7:	89 e5                	mov    %esp,%ebp
+  800ae9:	57                   	push   %edi
+  800aea:	56                   	push   %esi
+  800aeb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800af1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800af4:	39 c6                	cmp    %eax,%esi
+  800af6:	73 32                	jae    800b2a <memmove+0x44>
+  800af8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800afb:	39 d0                	cmp    %edx,%eax
+  800afd:	73 2b                	jae    800b2a <memmove+0x44>
+		s += n;
+		d += n;
+  800aff:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b02:	89 d6                	mov    %edx,%esi
+  800b04:	09 fe                	or     %edi,%esi
+  800b06:	09 ce                	or     %ecx,%esi
+  800b08:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b0e:	75 0e                	jne    800b1e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b10:	83 ef 04             	sub    $0x4,%edi
+  800b13:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b16:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b19:	fd                   	std
+  800b1a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b1c:	eb 09                	jmp    800b27 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b1e:	83 ef 01             	sub    $0x1,%edi
+  800b21:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b24:	fd                   	std
+  800b25:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b27:	fc                   	cld
+  800b28:	eb 1a                	jmp    800b44 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b2a:	89 f2                	mov    %esi,%edx
+  800b2c:	09 c2                	or     %eax,%edx
+  800b2e:	09 ca                	or     %ecx,%edx
+  800b30:	f6 c2 03             	test   $0x3,%dl
+  800b33:	75 0a                	jne    800b3f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b35:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b38:	89 c7                	mov    %eax,%edi
+  800b3a:	fc                   	cld
+  800b3b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b3d:	eb 05                	jmp    800b44 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b3f:	89 c7                	mov    %eax,%edi
+  800b41:	fc                   	cld
+  800b42:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b44:	5e                   	pop    %esi
+  800b45:	5f                   	pop    %edi
+  800b46:	5d                   	pop    %ebp
+  800b47:	c3                   	ret
+
+00800b48 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b48:	55                   	push   %ebp
+  800b49:	89 e5                	mov    %esp,%ebp
+  800b4b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b4e:	ff 75 10             	push   0x10(%ebp)
+  800b51:	ff 75 0c             	push   0xc(%ebp)
+  800b54:	ff 75 08             	push   0x8(%ebp)
+  800b57:	e8 8a ff ff ff       	call   800ae6 <memmove>
+}
+  800b5c:	c9                   	leave
+  800b5d:	c3                   	ret
+
+00800b5e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	56                   	push   %esi
+  800b62:	53                   	push   %ebx
+  800b63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b66:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b69:	89 c6                	mov    %eax,%esi
+  800b6b:	03 75 10             	add    0x10(%ebp),%esi
+  800b6e:	eb 06                	jmp    800b76 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b70:	83 c0 01             	add    $0x1,%eax
+  800b73:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b76:	39 f0                	cmp    %esi,%eax
+  800b78:	74 14                	je     800b8e <memcmp+0x30>
+		if (*s1 != *s2)
+  800b7a:	0f b6 08             	movzbl (%eax),%ecx
+  800b7d:	0f b6 1a             	movzbl (%edx),%ebx
+  800b80:	38 d9                	cmp    %bl,%cl
+  800b82:	74 ec                	je     800b70 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b84:	0f b6 c1             	movzbl %cl,%eax
+  800b87:	0f b6 db             	movzbl %bl,%ebx
+  800b8a:	29 d8                	sub    %ebx,%eax
+  800b8c:	eb 05                	jmp    800b93 <memcmp+0x35>
+	}
+
+	return 0;
+  800b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b93:	5b                   	pop    %ebx
+  800b94:	5e                   	pop    %esi
+  800b95:	5d                   	pop    %ebp
+  800b96:	c3                   	ret
+
+00800b97 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b97:	55                   	push   %ebp
+  800b98:	89 e5                	mov    %esp,%ebp
+  800b9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ba0:	89 c2                	mov    %eax,%edx
+  800ba2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ba5:	eb 03                	jmp    800baa <memfind+0x13>
+  800ba7:	83 c0 01             	add    $0x1,%eax
+  800baa:	39 d0                	cmp    %edx,%eax
+  800bac:	73 04                	jae    800bb2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bae:	38 08                	cmp    %cl,(%eax)
+  800bb0:	75 f5                	jne    800ba7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bb2:	5d                   	pop    %ebp
+  800bb3:	c3                   	ret
+
+00800bb4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bb4:	55                   	push   %ebp
+  800bb5:	89 e5                	mov    %esp,%ebp
+  800bb7:	57                   	push   %edi
+  800bb8:	56                   	push   %esi
+  800bb9:	53                   	push   %ebx
+  800bba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bc0:	eb 03                	jmp    800bc5 <strtol+0x11>
+		s++;
+  800bc2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bc5:	0f b6 02             	movzbl (%edx),%eax
+  800bc8:	3c 20                	cmp    $0x20,%al
+  800bca:	74 f6                	je     800bc2 <strtol+0xe>
+  800bcc:	3c 09                	cmp    $0x9,%al
+  800bce:	74 f2                	je     800bc2 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bd0:	3c 2b                	cmp    $0x2b,%al
+  800bd2:	74 2a                	je     800bfe <strtol+0x4a>
+	int neg = 0;
+  800bd4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bd9:	3c 2d                	cmp    $0x2d,%al
+  800bdb:	74 2b                	je     800c08 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bdd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800be3:	75 0f                	jne    800bf4 <strtol+0x40>
+  800be5:	80 3a 30             	cmpb   $0x30,(%edx)
+  800be8:	74 28                	je     800c12 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bea:	85 db                	test   %ebx,%ebx
+  800bec:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bf1:	0f 44 d8             	cmove  %eax,%ebx
+  800bf4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bfc:	eb 46                	jmp    800c44 <strtol+0x90>
+		s++;
+  800bfe:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c01:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c06:	eb d5                	jmp    800bdd <strtol+0x29>
+		s++, neg = 1;
+  800c08:	83 c2 01             	add    $0x1,%edx
+  800c0b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c10:	eb cb                	jmp    800bdd <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c12:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c16:	74 0e                	je     800c26 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c18:	85 db                	test   %ebx,%ebx
+  800c1a:	75 d8                	jne    800bf4 <strtol+0x40>
+		s++, base = 8;
+  800c1c:	83 c2 01             	add    $0x1,%edx
+  800c1f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c24:	eb ce                	jmp    800bf4 <strtol+0x40>
+		s += 2, base = 16;
+  800c26:	83 c2 02             	add    $0x2,%edx
+  800c29:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c2e:	eb c4                	jmp    800bf4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c30:	0f be c0             	movsbl %al,%eax
+  800c33:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c36:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c39:	7d 3a                	jge    800c75 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c3b:	83 c2 01             	add    $0x1,%edx
+  800c3e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c42:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c44:	0f b6 02             	movzbl (%edx),%eax
+  800c47:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c4a:	89 f3                	mov    %esi,%ebx
+  800c4c:	80 fb 09             	cmp    $0x9,%bl
+  800c4f:	76 df                	jbe    800c30 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c51:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c54:	89 f3                	mov    %esi,%ebx
+  800c56:	80 fb 19             	cmp    $0x19,%bl
+  800c59:	77 08                	ja     800c63 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c5b:	0f be c0             	movsbl %al,%eax
+  800c5e:	83 e8 57             	sub    $0x57,%eax
+  800c61:	eb d3                	jmp    800c36 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c63:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c66:	89 f3                	mov    %esi,%ebx
+  800c68:	80 fb 19             	cmp    $0x19,%bl
+  800c6b:	77 08                	ja     800c75 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c6d:	0f be c0             	movsbl %al,%eax
+  800c70:	83 e8 37             	sub    $0x37,%eax
+  800c73:	eb c1                	jmp    800c36 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c75:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c79:	74 05                	je     800c80 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c7e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c80:	89 c8                	mov    %ecx,%eax
+  800c82:	f7 d8                	neg    %eax
+  800c84:	85 ff                	test   %edi,%edi
+  800c86:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c89:	89 c8                	mov    %ecx,%eax
+  800c8b:	5b                   	pop    %ebx
+  800c8c:	5e                   	pop    %esi
+  800c8d:	5f                   	pop    %edi
+  800c8e:	5d                   	pop    %ebp
+  800c8f:	c3                   	ret
+
+00800c90 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c90:	55                   	push   %ebp
+  800c91:	89 e5                	mov    %esp,%ebp
+  800c93:	57                   	push   %edi
+  800c94:	56                   	push   %esi
+  800c95:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca1:	89 c3                	mov    %eax,%ebx
+  800ca3:	89 c7                	mov    %eax,%edi
+  800ca5:	89 c6                	mov    %eax,%esi
+  800ca7:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ca9:	5b                   	pop    %ebx
+  800caa:	5e                   	pop    %esi
+  800cab:	5f                   	pop    %edi
+  800cac:	5d                   	pop    %ebp
+  800cad:	c3                   	ret
+
+00800cae <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	57                   	push   %edi
+  800cb2:	56                   	push   %esi
+  800cb3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cbe:	89 d1                	mov    %edx,%ecx
+  800cc0:	89 d3                	mov    %edx,%ebx
+  800cc2:	89 d7                	mov    %edx,%edi
+  800cc4:	89 d6                	mov    %edx,%esi
+  800cc6:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cc8:	5b                   	pop    %ebx
+  800cc9:	5e                   	pop    %esi
+  800cca:	5f                   	pop    %edi
+  800ccb:	5d                   	pop    %ebp
+  800ccc:	c3                   	ret
+
+00800ccd <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	56                   	push   %esi
+  800cd2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cd3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdb:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ce0:	89 cb                	mov    %ecx,%ebx
+  800ce2:	89 cf                	mov    %ecx,%edi
+  800ce4:	89 ce                	mov    %ecx,%esi
+  800ce6:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800ce8:	5b                   	pop    %ebx
+  800ce9:	5e                   	pop    %esi
+  800cea:	5f                   	pop    %edi
+  800ceb:	5d                   	pop    %ebp
+  800cec:	c3                   	ret
+
+00800ced <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ced:	55                   	push   %ebp
+  800cee:	89 e5                	mov    %esp,%ebp
+  800cf0:	57                   	push   %edi
+  800cf1:	56                   	push   %esi
+  800cf2:	53                   	push   %ebx
+  800cf3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cf6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfe:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d03:	89 cb                	mov    %ecx,%ebx
+  800d05:	89 cf                	mov    %ecx,%edi
+  800d07:	89 ce                	mov    %ecx,%esi
+  800d09:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d0b:	85 c0                	test   %eax,%eax
+  800d0d:	7f 08                	jg     800d17 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d12:	5b                   	pop    %ebx
+  800d13:	5e                   	pop    %esi
+  800d14:	5f                   	pop    %edi
+  800d15:	5d                   	pop    %ebp
+  800d16:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d17:	83 ec 0c             	sub    $0xc,%esp
+  800d1a:	50                   	push   %eax
+  800d1b:	6a 03                	push   $0x3
+  800d1d:	68 3f 30 80 00       	push   $0x80303f
+  800d22:	6a 23                	push   $0x23
+  800d24:	68 5c 30 80 00       	push   $0x80305c
+  800d29:	e8 69 f5 ff ff       	call   800297 <_panic>
+
+00800d2e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d2e:	55                   	push   %ebp
+  800d2f:	89 e5                	mov    %esp,%ebp
+  800d31:	57                   	push   %edi
+  800d32:	56                   	push   %esi
+  800d33:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d39:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d3e:	89 d1                	mov    %edx,%ecx
+  800d40:	89 d3                	mov    %edx,%ebx
+  800d42:	89 d7                	mov    %edx,%edi
+  800d44:	89 d6                	mov    %edx,%esi
+  800d46:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d48:	5b                   	pop    %ebx
+  800d49:	5e                   	pop    %esi
+  800d4a:	5f                   	pop    %edi
+  800d4b:	5d                   	pop    %ebp
+  800d4c:	c3                   	ret
+
+00800d4d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	57                   	push   %edi
+  800d51:	56                   	push   %esi
+  800d52:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d58:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d5d:	89 d1                	mov    %edx,%ecx
+  800d5f:	89 d3                	mov    %edx,%ebx
+  800d61:	89 d7                	mov    %edx,%edi
+  800d63:	89 d6                	mov    %edx,%esi
+  800d65:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d67:	5b                   	pop    %ebx
+  800d68:	5e                   	pop    %esi
+  800d69:	5f                   	pop    %edi
+  800d6a:	5d                   	pop    %ebp
+  800d6b:	c3                   	ret
+
+00800d6c <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800d6c:	55                   	push   %ebp
+  800d6d:	89 e5                	mov    %esp,%ebp
+  800d6f:	57                   	push   %edi
+  800d70:	56                   	push   %esi
+  800d71:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d72:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d77:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d7c:	89 d1                	mov    %edx,%ecx
+  800d7e:	89 d3                	mov    %edx,%ebx
+  800d80:	89 d7                	mov    %edx,%edi
+  800d82:	89 d6                	mov    %edx,%esi
+  800d84:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800d86:	5b                   	pop    %ebx
+  800d87:	5e                   	pop    %esi
+  800d88:	5f                   	pop    %edi
+  800d89:	5d                   	pop    %ebp
+  800d8a:	c3                   	ret
+
+00800d8b <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800d8b:	55                   	push   %ebp
+  800d8c:	89 e5                	mov    %esp,%ebp
+  800d8e:	57                   	push   %edi
+  800d8f:	56                   	push   %esi
+  800d90:	53                   	push   %ebx
+  800d91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9f:	b8 15 00 00 00       	mov    $0x15,%eax
+  800da4:	89 df                	mov    %ebx,%edi
+  800da6:	89 de                	mov    %ebx,%esi
+  800da8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800daa:	85 c0                	test   %eax,%eax
+  800dac:	7f 08                	jg     800db6 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800dae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db1:	5b                   	pop    %ebx
+  800db2:	5e                   	pop    %esi
+  800db3:	5f                   	pop    %edi
+  800db4:	5d                   	pop    %ebp
+  800db5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db6:	83 ec 0c             	sub    $0xc,%esp
+  800db9:	50                   	push   %eax
+  800dba:	6a 15                	push   $0x15
+  800dbc:	68 3f 30 80 00       	push   $0x80303f
+  800dc1:	6a 23                	push   $0x23
+  800dc3:	68 5c 30 80 00       	push   $0x80305c
+  800dc8:	e8 ca f4 ff ff       	call   800297 <_panic>
+
+00800dcd <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	57                   	push   %edi
+  800dd1:	56                   	push   %esi
+  800dd2:	53                   	push   %ebx
+  800dd3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd6:	be 00 00 00 00       	mov    $0x0,%esi
+  800ddb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de1:	b8 05 00 00 00       	mov    $0x5,%eax
+  800de6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de9:	89 f7                	mov    %esi,%edi
+  800deb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ded:	85 c0                	test   %eax,%eax
+  800def:	7f 08                	jg     800df9 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800df1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df4:	5b                   	pop    %ebx
+  800df5:	5e                   	pop    %esi
+  800df6:	5f                   	pop    %edi
+  800df7:	5d                   	pop    %ebp
+  800df8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df9:	83 ec 0c             	sub    $0xc,%esp
+  800dfc:	50                   	push   %eax
+  800dfd:	6a 05                	push   $0x5
+  800dff:	68 3f 30 80 00       	push   $0x80303f
+  800e04:	6a 23                	push   $0x23
+  800e06:	68 5c 30 80 00       	push   $0x80305c
+  800e0b:	e8 87 f4 ff ff       	call   800297 <_panic>
+
+00800e10 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800e10:	55                   	push   %ebp
+  800e11:	89 e5                	mov    %esp,%ebp
+  800e13:	57                   	push   %edi
+  800e14:	56                   	push   %esi
+  800e15:	53                   	push   %ebx
+  800e16:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e19:	be 00 00 00 00       	mov    $0x0,%esi
+  800e1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e24:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e2c:	89 f7                	mov    %esi,%edi
+  800e2e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e30:	85 c0                	test   %eax,%eax
+  800e32:	7f 08                	jg     800e3c <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e37:	5b                   	pop    %ebx
+  800e38:	5e                   	pop    %esi
+  800e39:	5f                   	pop    %edi
+  800e3a:	5d                   	pop    %ebp
+  800e3b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3c:	83 ec 0c             	sub    $0xc,%esp
+  800e3f:	50                   	push   %eax
+  800e40:	6a 06                	push   $0x6
+  800e42:	68 3f 30 80 00       	push   $0x80303f
+  800e47:	6a 23                	push   $0x23
+  800e49:	68 5c 30 80 00       	push   $0x80305c
+  800e4e:	e8 44 f4 ff ff       	call   800297 <_panic>
+
+00800e53 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e53:	55                   	push   %ebp
+  800e54:	89 e5                	mov    %esp,%ebp
+  800e56:	57                   	push   %edi
+  800e57:	56                   	push   %esi
+  800e58:	53                   	push   %ebx
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e62:	b8 07 00 00 00       	mov    $0x7,%eax
+  800e67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e6d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e70:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e72:	85 c0                	test   %eax,%eax
+  800e74:	7f 08                	jg     800e7e <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e79:	5b                   	pop    %ebx
+  800e7a:	5e                   	pop    %esi
+  800e7b:	5f                   	pop    %edi
+  800e7c:	5d                   	pop    %ebp
+  800e7d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7e:	83 ec 0c             	sub    $0xc,%esp
+  800e81:	50                   	push   %eax
+  800e82:	6a 07                	push   $0x7
+  800e84:	68 3f 30 80 00       	push   $0x80303f
+  800e89:	6a 23                	push   $0x23
+  800e8b:	68 5c 30 80 00       	push   $0x80305c
+  800e90:	e8 02 f4 ff ff       	call   800297 <_panic>
+
+00800e95 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e95:	55                   	push   %ebp
+  800e96:	89 e5                	mov    %esp,%ebp
+  800e98:	57                   	push   %edi
+  800e99:	56                   	push   %esi
+  800e9a:	53                   	push   %ebx
+  800e9b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea9:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eae:	89 df                	mov    %ebx,%edi
+  800eb0:	89 de                	mov    %ebx,%esi
+  800eb2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb4:	85 c0                	test   %eax,%eax
+  800eb6:	7f 08                	jg     800ec0 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800eb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebb:	5b                   	pop    %ebx
+  800ebc:	5e                   	pop    %esi
+  800ebd:	5f                   	pop    %edi
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec0:	83 ec 0c             	sub    $0xc,%esp
+  800ec3:	50                   	push   %eax
+  800ec4:	6a 08                	push   $0x8
+  800ec6:	68 3f 30 80 00       	push   $0x80303f
+  800ecb:	6a 23                	push   $0x23
+  800ecd:	68 5c 30 80 00       	push   $0x80305c
+  800ed2:	e8 c0 f3 ff ff       	call   800297 <_panic>
+
+00800ed7 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800ed7:	55                   	push   %ebp
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	57                   	push   %edi
+  800edb:	56                   	push   %esi
+  800edc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800edd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee3:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ee8:	be 00 00 00 00       	mov    $0x0,%esi
+  800eed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef3:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800ef5:	5b                   	pop    %ebx
+  800ef6:	5e                   	pop    %esi
+  800ef7:	5f                   	pop    %edi
+  800ef8:	5d                   	pop    %ebp
+  800ef9:	c3                   	ret
+
+00800efa <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	57                   	push   %edi
+  800efe:	56                   	push   %esi
+  800eff:	53                   	push   %ebx
+  800f00:	8b 45 18             	mov    0x18(%ebp),%eax
+  800f03:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800f06:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800f0b:	77 27                	ja     800f34 <sys_page_map_range+0x3a>
+  800f0d:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800f13:	77 1f                	ja     800f34 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800f15:	c1 e0 0c             	shl    $0xc,%eax
+  800f18:	89 c6                	mov    %eax,%esi
+  800f1a:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f22:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f2d:	cd 30                	int    $0x30
+}
+  800f2f:	5b                   	pop    %ebx
+  800f30:	5e                   	pop    %esi
+  800f31:	5f                   	pop    %edi
+  800f32:	5d                   	pop    %ebp
+  800f33:	c3                   	ret
+		return -E_INVAL;
+  800f34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f39:	eb f4                	jmp    800f2f <sys_page_map_range+0x35>
+
+00800f3b <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	56                   	push   %esi
+  800f40:	53                   	push   %ebx
+  800f41:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f4f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f57:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f5a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5c:	85 c0                	test   %eax,%eax
+  800f5e:	7f 08                	jg     800f68 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800f60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f63:	5b                   	pop    %ebx
+  800f64:	5e                   	pop    %esi
+  800f65:	5f                   	pop    %edi
+  800f66:	5d                   	pop    %ebp
+  800f67:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f68:	83 ec 0c             	sub    $0xc,%esp
+  800f6b:	50                   	push   %eax
+  800f6c:	6a 0c                	push   $0xc
+  800f6e:	68 3f 30 80 00       	push   $0x80303f
+  800f73:	6a 23                	push   $0x23
+  800f75:	68 5c 30 80 00       	push   $0x80305c
+  800f7a:	e8 18 f3 ff ff       	call   800297 <_panic>
+
+00800f7f <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f7f:	55                   	push   %ebp
+  800f80:	89 e5                	mov    %esp,%ebp
+  800f82:	57                   	push   %edi
+  800f83:	56                   	push   %esi
+  800f84:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f85:	be 00 00 00 00       	mov    $0x0,%esi
+  800f8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f90:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f98:	89 f7                	mov    %esi,%edi
+  800f9a:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f9c:	5b                   	pop    %ebx
+  800f9d:	5e                   	pop    %esi
+  800f9e:	5f                   	pop    %edi
+  800f9f:	5d                   	pop    %ebp
+  800fa0:	c3                   	ret
+
+00800fa1 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fa1:	55                   	push   %ebp
+  800fa2:	89 e5                	mov    %esp,%ebp
+  800fa4:	57                   	push   %edi
+  800fa5:	56                   	push   %esi
+  800fa6:	53                   	push   %ebx
+  800fa7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800faa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800faf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fba:	89 df                	mov    %ebx,%edi
+  800fbc:	89 de                	mov    %ebx,%esi
+  800fbe:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc0:	85 c0                	test   %eax,%eax
+  800fc2:	7f 08                	jg     800fcc <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc7:	5b                   	pop    %ebx
+  800fc8:	5e                   	pop    %esi
+  800fc9:	5f                   	pop    %edi
+  800fca:	5d                   	pop    %ebp
+  800fcb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fcc:	83 ec 0c             	sub    $0xc,%esp
+  800fcf:	50                   	push   %eax
+  800fd0:	6a 0f                	push   $0xf
+  800fd2:	68 3f 30 80 00       	push   $0x80303f
+  800fd7:	6a 23                	push   $0x23
+  800fd9:	68 5c 30 80 00       	push   $0x80305c
+  800fde:	e8 b4 f2 ff ff       	call   800297 <_panic>
+
+00800fe3 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800fe3:	55                   	push   %ebp
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	57                   	push   %edi
+  800fe7:	56                   	push   %esi
+  800fe8:	53                   	push   %ebx
+  800fe9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff7:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ffc:	89 df                	mov    %ebx,%edi
+  800ffe:	89 de                	mov    %ebx,%esi
+  801000:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801002:	85 c0                	test   %eax,%eax
+  801004:	7f 08                	jg     80100e <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  801006:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801009:	5b                   	pop    %ebx
+  80100a:	5e                   	pop    %esi
+  80100b:	5f                   	pop    %edi
+  80100c:	5d                   	pop    %ebp
+  80100d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80100e:	83 ec 0c             	sub    $0xc,%esp
+  801011:	50                   	push   %eax
+  801012:	6a 10                	push   $0x10
+  801014:	68 3f 30 80 00       	push   $0x80303f
+  801019:	6a 23                	push   $0x23
+  80101b:	68 5c 30 80 00       	push   $0x80305c
+  801020:	e8 72 f2 ff ff       	call   800297 <_panic>
+
+00801025 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	57                   	push   %edi
+  801029:	56                   	push   %esi
+  80102a:	53                   	push   %ebx
+  80102b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80102e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801033:	8b 55 08             	mov    0x8(%ebp),%edx
+  801036:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801039:	b8 11 00 00 00       	mov    $0x11,%eax
+  80103e:	89 df                	mov    %ebx,%edi
+  801040:	89 de                	mov    %ebx,%esi
+  801042:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801044:	85 c0                	test   %eax,%eax
+  801046:	7f 08                	jg     801050 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  801048:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104b:	5b                   	pop    %ebx
+  80104c:	5e                   	pop    %esi
+  80104d:	5f                   	pop    %edi
+  80104e:	5d                   	pop    %ebp
+  80104f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801050:	83 ec 0c             	sub    $0xc,%esp
+  801053:	50                   	push   %eax
+  801054:	6a 11                	push   $0x11
+  801056:	68 3f 30 80 00       	push   $0x80303f
+  80105b:	6a 23                	push   $0x23
+  80105d:	68 5c 30 80 00       	push   $0x80305c
+  801062:	e8 30 f2 ff ff       	call   800297 <_panic>
+
+00801067 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  801067:	55                   	push   %ebp
+  801068:	89 e5                	mov    %esp,%ebp
+  80106a:	57                   	push   %edi
+  80106b:	56                   	push   %esi
+  80106c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80106d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801072:	b8 12 00 00 00       	mov    $0x12,%eax
+  801077:	89 d1                	mov    %edx,%ecx
+  801079:	89 d3                	mov    %edx,%ebx
+  80107b:	89 d7                	mov    %edx,%edi
+  80107d:	89 d6                	mov    %edx,%esi
+  80107f:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  801081:	5b                   	pop    %ebx
+  801082:	5e                   	pop    %esi
+  801083:	5f                   	pop    %edi
+  801084:	5d                   	pop    %ebp
+  801085:	c3                   	ret
+
+00801086 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	57                   	push   %edi
+  80108a:	56                   	push   %esi
+  80108b:	53                   	push   %ebx
+  80108c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80108f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801094:	8b 55 08             	mov    0x8(%ebp),%edx
+  801097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80109f:	89 df                	mov    %ebx,%edi
+  8010a1:	89 de                	mov    %ebx,%esi
+  8010a3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010a5:	85 c0                	test   %eax,%eax
+  8010a7:	7f 08                	jg     8010b1 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ac:	5b                   	pop    %ebx
+  8010ad:	5e                   	pop    %esi
+  8010ae:	5f                   	pop    %edi
+  8010af:	5d                   	pop    %ebp
+  8010b0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b1:	83 ec 0c             	sub    $0xc,%esp
+  8010b4:	50                   	push   %eax
+  8010b5:	6a 13                	push   $0x13
+  8010b7:	68 3f 30 80 00       	push   $0x80303f
+  8010bc:	6a 23                	push   $0x23
+  8010be:	68 5c 30 80 00       	push   $0x80305c
+  8010c3:	e8 cf f1 ff ff       	call   800297 <_panic>
+
+008010c8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010c8:	55                   	push   %ebp
+  8010c9:	89 e5                	mov    %esp,%ebp
+  8010cb:	57                   	push   %edi
+  8010cc:	56                   	push   %esi
+  8010cd:	53                   	push   %ebx
+  8010ce:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010dc:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010e1:	89 df                	mov    %ebx,%edi
+  8010e3:	89 de                	mov    %ebx,%esi
+  8010e5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e7:	85 c0                	test   %eax,%eax
+  8010e9:	7f 08                	jg     8010f3 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ee:	5b                   	pop    %ebx
+  8010ef:	5e                   	pop    %esi
+  8010f0:	5f                   	pop    %edi
+  8010f1:	5d                   	pop    %ebp
+  8010f2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f3:	83 ec 0c             	sub    $0xc,%esp
+  8010f6:	50                   	push   %eax
+  8010f7:	6a 14                	push   $0x14
+  8010f9:	68 3f 30 80 00       	push   $0x80303f
+  8010fe:	6a 23                	push   $0x23
+  801100:	68 5c 30 80 00       	push   $0x80305c
+  801105:	e8 8d f1 ff ff       	call   800297 <_panic>
+
+0080110a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80110a:	55                   	push   %ebp
+  80110b:	89 e5                	mov    %esp,%ebp
+  80110d:	57                   	push   %edi
+  80110e:	56                   	push   %esi
+  80110f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801116:	b8 17 00 00 00       	mov    $0x17,%eax
+  80111b:	be 00 00 00 00       	mov    $0x0,%esi
+  801120:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801123:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801126:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801128:	5b                   	pop    %ebx
+  801129:	5e                   	pop    %esi
+  80112a:	5f                   	pop    %edi
+  80112b:	5d                   	pop    %ebp
+  80112c:	c3                   	ret
+
+0080112d <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	57                   	push   %edi
+  801131:	56                   	push   %esi
+  801132:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801133:	8b 55 08             	mov    0x8(%ebp),%edx
+  801136:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801139:	b8 18 00 00 00       	mov    $0x18,%eax
+  80113e:	be 00 00 00 00       	mov    $0x0,%esi
+  801143:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801146:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801149:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80114b:	5b                   	pop    %ebx
+  80114c:	5e                   	pop    %esi
+  80114d:	5f                   	pop    %edi
+  80114e:	5d                   	pop    %ebp
+  80114f:	c3                   	ret
+
+00801150 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801150:	55                   	push   %ebp
+  801151:	89 e5                	mov    %esp,%ebp
+  801153:	57                   	push   %edi
+  801154:	56                   	push   %esi
+  801155:	53                   	push   %ebx
+  801156:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801159:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80115e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801161:	b8 19 00 00 00       	mov    $0x19,%eax
+  801166:	89 cb                	mov    %ecx,%ebx
+  801168:	89 cf                	mov    %ecx,%edi
+  80116a:	89 ce                	mov    %ecx,%esi
+  80116c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	7f 08                	jg     80117a <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117a:	83 ec 0c             	sub    $0xc,%esp
+  80117d:	50                   	push   %eax
+  80117e:	6a 19                	push   $0x19
+  801180:	68 3f 30 80 00       	push   $0x80303f
+  801185:	6a 23                	push   $0x23
+  801187:	68 5c 30 80 00       	push   $0x80305c
+  80118c:	e8 06 f1 ff ff       	call   800297 <_panic>
+
+00801191 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	57                   	push   %edi
+  801195:	56                   	push   %esi
+  801196:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801197:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8011a1:	89 d1                	mov    %edx,%ecx
+  8011a3:	89 d3                	mov    %edx,%ebx
+  8011a5:	89 d7                	mov    %edx,%edi
+  8011a7:	89 d6                	mov    %edx,%esi
+  8011a9:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5e                   	pop    %esi
+  8011ad:	5f                   	pop    %edi
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+
+008011b0 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+  8011b3:	57                   	push   %edi
+  8011b4:	56                   	push   %esi
+  8011b5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8011c6:	89 df                	mov    %ebx,%edi
+  8011c8:	89 de                	mov    %ebx,%esi
+  8011ca:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8011cc:	5b                   	pop    %ebx
+  8011cd:	5e                   	pop    %esi
+  8011ce:	5f                   	pop    %edi
+  8011cf:	5d                   	pop    %ebp
+  8011d0:	c3                   	ret
+
+008011d1 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8011d1:	55                   	push   %ebp
+  8011d2:	89 e5                	mov    %esp,%ebp
+  8011d4:	57                   	push   %edi
+  8011d5:	56                   	push   %esi
+  8011d6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8011e7:	89 df                	mov    %ebx,%edi
+  8011e9:	89 de                	mov    %ebx,%esi
+  8011eb:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  8011ed:	5b                   	pop    %ebx
+  8011ee:	5e                   	pop    %esi
+  8011ef:	5f                   	pop    %edi
+  8011f0:	5d                   	pop    %ebp
+  8011f1:	c3                   	ret
+
+008011f2 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	53                   	push   %ebx
+  8011f6:	83 ec 04             	sub    $0x4,%esp
+  8011f9:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8011fc:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  8011fe:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  801201:	f6 c2 02             	test   $0x2,%dl
+  801204:	74 7b                	je     801281 <pgfault+0x8f>
+  801206:	89 c1                	mov    %eax,%ecx
+  801208:	c1 e9 0c             	shr    $0xc,%ecx
+  80120b:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  801212:	f6 c5 08             	test   $0x8,%ch
+  801215:	74 6a                	je     801281 <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801217:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80121c:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80121e:	83 ec 04             	sub    $0x4,%esp
+  801221:	6a 07                	push   $0x7
+  801223:	68 00 f0 7f 00       	push   $0x7ff000
+  801228:	6a 00                	push   $0x0
+  80122a:	e8 9e fb ff ff       	call   800dcd <sys_page_alloc>
+  80122f:	83 c4 10             	add    $0x10,%esp
+  801232:	85 c0                	test   %eax,%eax
+  801234:	78 61                	js     801297 <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  801236:	83 ec 04             	sub    $0x4,%esp
+  801239:	68 00 10 00 00       	push   $0x1000
+  80123e:	53                   	push   %ebx
+  80123f:	68 00 f0 7f 00       	push   $0x7ff000
+  801244:	e8 9d f8 ff ff       	call   800ae6 <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  801249:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801250:	53                   	push   %ebx
+  801251:	6a 00                	push   $0x0
+  801253:	68 00 f0 7f 00       	push   $0x7ff000
+  801258:	6a 00                	push   $0x0
+  80125a:	e8 f4 fb ff ff       	call   800e53 <sys_page_map>
+  80125f:	83 c4 20             	add    $0x20,%esp
+  801262:	85 c0                	test   %eax,%eax
+  801264:	78 43                	js     8012a9 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  801266:	83 ec 08             	sub    $0x8,%esp
+  801269:	68 00 f0 7f 00       	push   $0x7ff000
+  80126e:	6a 00                	push   $0x0
+  801270:	e8 20 fc ff ff       	call   800e95 <sys_page_unmap>
+  801275:	83 c4 10             	add    $0x10,%esp
+  801278:	85 c0                	test   %eax,%eax
+  80127a:	78 3f                	js     8012bb <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  80127c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80127f:	c9                   	leave
+  801280:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  801281:	83 ec 0c             	sub    $0xc,%esp
+  801284:	50                   	push   %eax
+  801285:	52                   	push   %edx
+  801286:	68 6a 30 80 00       	push   $0x80306a
+  80128b:	6a 19                	push   $0x19
+  80128d:	68 7b 30 80 00       	push   $0x80307b
+  801292:	e8 00 f0 ff ff       	call   800297 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801297:	50                   	push   %eax
+  801298:	68 86 30 80 00       	push   $0x803086
+  80129d:	6a 24                	push   $0x24
+  80129f:	68 7b 30 80 00       	push   $0x80307b
+  8012a4:	e8 ee ef ff ff       	call   800297 <_panic>
+		panic("sys_page_map: %e", r);
+  8012a9:	50                   	push   %eax
+  8012aa:	68 99 30 80 00       	push   $0x803099
+  8012af:	6a 29                	push   $0x29
+  8012b1:	68 7b 30 80 00       	push   $0x80307b
+  8012b6:	e8 dc ef ff ff       	call   800297 <_panic>
+		panic("sys_page_unmap: %e", r);
+  8012bb:	50                   	push   %eax
+  8012bc:	68 aa 30 80 00       	push   $0x8030aa
+  8012c1:	6a 2c                	push   $0x2c
+  8012c3:	68 7b 30 80 00       	push   $0x80307b
+  8012c8:	e8 ca ef ff ff       	call   800297 <_panic>
+
+008012cd <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  8012cd:	55                   	push   %ebp
+  8012ce:	89 e5                	mov    %esp,%ebp
+  8012d0:	57                   	push   %edi
+  8012d1:	56                   	push   %esi
+  8012d2:	53                   	push   %ebx
+  8012d3:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8012d6:	68 f2 11 80 00       	push   $0x8011f2
+  8012db:	e8 85 13 00 00       	call   802665 <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  8012e0:	83 c4 08             	add    $0x8,%esp
+  8012e3:	6a 01                	push   $0x1
+  8012e5:	6a 00                	push   $0x0
+  8012e7:	e8 9f fa ff ff       	call   800d8b <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  8012ec:	e8 7b fa ff ff       	call   800d6c <sys_fork_cow>
+  8012f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  8012f4:	83 c4 10             	add    $0x10,%esp
+  8012f7:	85 c0                	test   %eax,%eax
+  8012f9:	74 2c                	je     801327 <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  8012fb:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8012ff:	0f 85 8b 01 00 00    	jne    801490 <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801305:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80130a:	cd 30                	int    $0x30
+  80130c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  80130f:	85 c0                	test   %eax,%eax
+  801311:	78 30                	js     801343 <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  801313:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801318:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  80131d:	74 36                	je     801355 <fork+0x88>
+  80131f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801322:	e9 99 00 00 00       	jmp    8013c0 <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801327:	e8 02 fa ff ff       	call   800d2e <sys_getenvid>
+  80132c:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801331:	c1 e0 09             	shl    $0x9,%eax
+  801334:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801339:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  80133e:	e9 4d 01 00 00       	jmp    801490 <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  801343:	50                   	push   %eax
+  801344:	68 bd 30 80 00       	push   $0x8030bd
+  801349:	6a 7d                	push   $0x7d
+  80134b:	68 7b 30 80 00       	push   $0x80307b
+  801350:	e8 42 ef ff ff       	call   800297 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801355:	e8 d4 f9 ff ff       	call   800d2e <sys_getenvid>
+  80135a:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80135f:	c1 e0 09             	shl    $0x9,%eax
+  801362:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801367:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  80136c:	e9 1f 01 00 00       	jmp    801490 <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  801371:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801378:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80137b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801380:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801383:	83 ec 0c             	sub    $0xc,%esp
+  801386:	50                   	push   %eax
+  801387:	56                   	push   %esi
+  801388:	ff 75 e4             	push   -0x1c(%ebp)
+  80138b:	56                   	push   %esi
+  80138c:	6a 00                	push   $0x0
+  80138e:	e8 c0 fa ff ff       	call   800e53 <sys_page_map>
+  801393:	83 c4 20             	add    $0x20,%esp
+  801396:	85 c0                	test   %eax,%eax
+  801398:	0f 88 98 00 00 00    	js     801436 <fork+0x169>
+	if (perm & PTE_COW) {
+  80139e:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  8013a5:	0f 85 61 01 00 00    	jne    80150c <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8013ab:	83 c7 01             	add    $0x1,%edi
+  8013ae:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8013b4:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  8013ba:	0f 84 88 00 00 00    	je     801448 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  8013c0:	89 f0                	mov    %esi,%eax
+  8013c2:	c1 e8 16             	shr    $0x16,%eax
+  8013c5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013cc:	25 81 00 00 00       	and    $0x81,%eax
+  8013d1:	83 f8 01             	cmp    $0x1,%eax
+  8013d4:	75 d5                	jne    8013ab <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  8013d6:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  8013dd:	a8 01                	test   $0x1,%al
+  8013df:	74 ca                	je     8013ab <fork+0xde>
+  8013e1:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  8013e7:	74 c2                	je     8013ab <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  8013e9:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  8013eb:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8013f2:	f6 c4 04             	test   $0x4,%ah
+  8013f5:	0f 85 76 ff ff ff    	jne    801371 <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  8013fb:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801402:	a8 02                	test   $0x2,%al
+  801404:	0f 85 dc 00 00 00    	jne    8014e6 <fork+0x219>
+  80140a:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801411:	f6 c4 08             	test   $0x8,%ah
+  801414:	0f 85 cc 00 00 00    	jne    8014e6 <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  80141a:	83 ec 0c             	sub    $0xc,%esp
+  80141d:	6a 05                	push   $0x5
+  80141f:	56                   	push   %esi
+  801420:	ff 75 e4             	push   -0x1c(%ebp)
+  801423:	56                   	push   %esi
+  801424:	6a 00                	push   $0x0
+  801426:	e8 28 fa ff ff       	call   800e53 <sys_page_map>
+  80142b:	83 c4 20             	add    $0x20,%esp
+  80142e:	85 c0                	test   %eax,%eax
+  801430:	0f 89 75 ff ff ff    	jns    8013ab <fork+0xde>
+		panic("sys_page_map: %e", r);
+  801436:	50                   	push   %eax
+  801437:	68 99 30 80 00       	push   $0x803099
+  80143c:	6a 48                	push   $0x48
+  80143e:	68 7b 30 80 00       	push   $0x80307b
+  801443:	e8 4f ee ff ff       	call   800297 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  801448:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80144b:	83 ec 04             	sub    $0x4,%esp
+  80144e:	6a 07                	push   $0x7
+  801450:	68 00 f0 bf ee       	push   $0xeebff000
+  801455:	53                   	push   %ebx
+  801456:	e8 72 f9 ff ff       	call   800dcd <sys_page_alloc>
+  80145b:	83 c4 10             	add    $0x10,%esp
+  80145e:	85 c0                	test   %eax,%eax
+  801460:	78 39                	js     80149b <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801462:	a1 08 50 80 00       	mov    0x805008,%eax
+  801467:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  80146d:	83 ec 08             	sub    $0x8,%esp
+  801470:	50                   	push   %eax
+  801471:	53                   	push   %ebx
+  801472:	e8 51 fc ff ff       	call   8010c8 <sys_env_set_pgfault_upcall>
+  801477:	83 c4 10             	add    $0x10,%esp
+  80147a:	85 c0                	test   %eax,%eax
+  80147c:	78 36                	js     8014b4 <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80147e:	83 ec 08             	sub    $0x8,%esp
+  801481:	6a 02                	push   $0x2
+  801483:	53                   	push   %ebx
+  801484:	e8 18 fb ff ff       	call   800fa1 <sys_env_set_status>
+  801489:	83 c4 10             	add    $0x10,%esp
+  80148c:	85 c0                	test   %eax,%eax
+  80148e:	78 3d                	js     8014cd <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  801490:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801493:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801496:	5b                   	pop    %ebx
+  801497:	5e                   	pop    %esi
+  801498:	5f                   	pop    %edi
+  801499:	5d                   	pop    %ebp
+  80149a:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  80149b:	83 ec 0c             	sub    $0xc,%esp
+  80149e:	53                   	push   %ebx
+  80149f:	50                   	push   %eax
+  8014a0:	68 e4 30 80 00       	push   $0x8030e4
+  8014a5:	68 92 00 00 00       	push   $0x92
+  8014aa:	68 7b 30 80 00       	push   $0x80307b
+  8014af:	e8 e3 ed ff ff       	call   800297 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  8014b4:	83 ec 0c             	sub    $0xc,%esp
+  8014b7:	53                   	push   %ebx
+  8014b8:	50                   	push   %eax
+  8014b9:	68 08 31 80 00       	push   $0x803108
+  8014be:	68 95 00 00 00       	push   $0x95
+  8014c3:	68 7b 30 80 00       	push   $0x80307b
+  8014c8:	e8 ca ed ff ff       	call   800297 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  8014cd:	83 ec 0c             	sub    $0xc,%esp
+  8014d0:	53                   	push   %ebx
+  8014d1:	50                   	push   %eax
+  8014d2:	68 38 31 80 00       	push   $0x803138
+  8014d7:	68 98 00 00 00       	push   $0x98
+  8014dc:	68 7b 30 80 00       	push   $0x80307b
+  8014e1:	e8 b1 ed ff ff       	call   800297 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8014e6:	83 ec 0c             	sub    $0xc,%esp
+  8014e9:	68 05 08 00 00       	push   $0x805
+  8014ee:	53                   	push   %ebx
+  8014ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8014f2:	53                   	push   %ebx
+  8014f3:	6a 00                	push   $0x0
+  8014f5:	e8 59 f9 ff ff       	call   800e53 <sys_page_map>
+  8014fa:	83 c4 20             	add    $0x20,%esp
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	0f 88 31 ff ff ff    	js     801436 <fork+0x169>
+		perm |= PTE_COW;
+  801505:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  80150c:	83 ec 0c             	sub    $0xc,%esp
+  80150f:	ff 75 e0             	push   -0x20(%ebp)
+  801512:	53                   	push   %ebx
+  801513:	6a 00                	push   $0x0
+  801515:	53                   	push   %ebx
+  801516:	6a 00                	push   $0x0
+  801518:	e8 36 f9 ff ff       	call   800e53 <sys_page_map>
+  80151d:	83 c4 20             	add    $0x20,%esp
+  801520:	85 c0                	test   %eax,%eax
+  801522:	0f 89 83 fe ff ff    	jns    8013ab <fork+0xde>
+			panic("sys_page_map: %e", r);
+  801528:	50                   	push   %eax
+  801529:	68 99 30 80 00       	push   $0x803099
+  80152e:	6a 4c                	push   $0x4c
+  801530:	68 7b 30 80 00       	push   $0x80307b
+  801535:	e8 5d ed ff ff       	call   800297 <_panic>
+
+0080153a <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80153a:	55                   	push   %ebp
+  80153b:	89 e5                	mov    %esp,%ebp
+  80153d:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801540:	68 cd 30 80 00       	push   $0x8030cd
+  801545:	68 a0 00 00 00       	push   $0xa0
+  80154a:	68 7b 30 80 00       	push   $0x80307b
+  80154f:	e8 43 ed ff ff       	call   800297 <_panic>
+
+00801554 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801554:	55                   	push   %ebp
+  801555:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801557:	8b 45 08             	mov    0x8(%ebp),%eax
+  80155a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80155f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801562:	5d                   	pop    %ebp
+  801563:	c3                   	ret
+
+00801564 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801564:	55                   	push   %ebp
+  801565:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801567:	8b 45 08             	mov    0x8(%ebp),%eax
+  80156a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80156f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801574:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801579:	5d                   	pop    %ebp
+  80157a:	c3                   	ret
+
+0080157b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80157b:	55                   	push   %ebp
+  80157c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80157e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801583:	eb 02                	jmp    801587 <fd_alloc+0xc>
+  801585:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801587:	89 c2                	mov    %eax,%edx
+  801589:	c1 ea 16             	shr    $0x16,%edx
+  80158c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801593:	f6 c2 01             	test   $0x1,%dl
+  801596:	74 2b                	je     8015c3 <fd_alloc+0x48>
+  801598:	89 c2                	mov    %eax,%edx
+  80159a:	c1 ea 0c             	shr    $0xc,%edx
+  80159d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8015a4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8015aa:	f6 c1 01             	test   $0x1,%cl
+  8015ad:	74 14                	je     8015c3 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8015af:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8015b5:	75 ce                	jne    801585 <fd_alloc+0xa>
+  8015b7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8015bc:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8015c1:	eb 05                	jmp    8015c8 <fd_alloc+0x4d>
+			return 0;
+  8015c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8015c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cb:	89 02                	mov    %eax,(%edx)
+}
+  8015cd:	89 c8                	mov    %ecx,%eax
+  8015cf:	5d                   	pop    %ebp
+  8015d0:	c3                   	ret
+
+008015d1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8015d1:	55                   	push   %ebp
+  8015d2:	89 e5                	mov    %esp,%ebp
+  8015d4:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8015d7:	83 f8 1f             	cmp    $0x1f,%eax
+  8015da:	77 30                	ja     80160c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8015dc:	c1 e0 0c             	shl    $0xc,%eax
+  8015df:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8015e4:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015ea:	f6 c2 01             	test   $0x1,%dl
+  8015ed:	74 24                	je     801613 <fd_lookup+0x42>
+  8015ef:	89 c2                	mov    %eax,%edx
+  8015f1:	c1 ea 0c             	shr    $0xc,%edx
+  8015f4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015fb:	f6 c2 01             	test   $0x1,%dl
+  8015fe:	74 1a                	je     80161a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801600:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801603:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801605:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80160a:	5d                   	pop    %ebp
+  80160b:	c3                   	ret
+		return -E_INVAL;
+  80160c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801611:	eb f7                	jmp    80160a <fd_lookup+0x39>
+		return -E_INVAL;
+  801613:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801618:	eb f0                	jmp    80160a <fd_lookup+0x39>
+  80161a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80161f:	eb e9                	jmp    80160a <fd_lookup+0x39>
+
+00801621 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801621:	55                   	push   %ebp
+  801622:	89 e5                	mov    %esp,%ebp
+  801624:	53                   	push   %ebx
+  801625:	83 ec 04             	sub    $0x4,%esp
+  801628:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80162b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801630:	eb 03                	jmp    801635 <dev_lookup+0x14>
+  801632:	83 c0 01             	add    $0x1,%eax
+  801635:	8b 1c 85 dc 31 80 00 	mov    0x8031dc(,%eax,4),%ebx
+  80163c:	85 db                	test   %ebx,%ebx
+  80163e:	74 0b                	je     80164b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801640:	39 13                	cmp    %edx,(%ebx)
+  801642:	75 ee                	jne    801632 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801644:	b8 00 00 00 00       	mov    $0x0,%eax
+  801649:	eb 1f                	jmp    80166a <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80164b:	a1 08 50 80 00       	mov    0x805008,%eax
+  801650:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801653:	83 ec 04             	sub    $0x4,%esp
+  801656:	52                   	push   %edx
+  801657:	50                   	push   %eax
+  801658:	68 60 31 80 00       	push   $0x803160
+  80165d:	e8 10 ed ff ff       	call   800372 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801662:	83 c4 10             	add    $0x10,%esp
+  801665:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80166a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80166d:	89 1a                	mov    %ebx,(%edx)
+}
+  80166f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801672:	c9                   	leave
+  801673:	c3                   	ret
+
+00801674 <fd_close>:
+{
+  801674:	55                   	push   %ebp
+  801675:	89 e5                	mov    %esp,%ebp
+  801677:	57                   	push   %edi
+  801678:	56                   	push   %esi
+  801679:	53                   	push   %ebx
+  80167a:	83 ec 24             	sub    $0x24,%esp
+  80167d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801680:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801683:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801686:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801687:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80168d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801690:	50                   	push   %eax
+  801691:	e8 3b ff ff ff       	call   8015d1 <fd_lookup>
+  801696:	89 c3                	mov    %eax,%ebx
+  801698:	83 c4 10             	add    $0x10,%esp
+  80169b:	85 c0                	test   %eax,%eax
+  80169d:	78 05                	js     8016a4 <fd_close+0x30>
+	    || fd != fd2)
+  80169f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8016a2:	74 16                	je     8016ba <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8016a4:	89 f8                	mov    %edi,%eax
+  8016a6:	84 c0                	test   %al,%al
+  8016a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ad:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8016b0:	89 d8                	mov    %ebx,%eax
+  8016b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b5:	5b                   	pop    %ebx
+  8016b6:	5e                   	pop    %esi
+  8016b7:	5f                   	pop    %edi
+  8016b8:	5d                   	pop    %ebp
+  8016b9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016ba:	83 ec 08             	sub    $0x8,%esp
+  8016bd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8016c0:	50                   	push   %eax
+  8016c1:	ff 36                	push   (%esi)
+  8016c3:	e8 59 ff ff ff       	call   801621 <dev_lookup>
+  8016c8:	89 c3                	mov    %eax,%ebx
+  8016ca:	83 c4 10             	add    $0x10,%esp
+  8016cd:	85 c0                	test   %eax,%eax
+  8016cf:	78 1a                	js     8016eb <fd_close+0x77>
+		if (dev->dev_close)
+  8016d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016d4:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8016d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	74 0b                	je     8016eb <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8016e0:	83 ec 0c             	sub    $0xc,%esp
+  8016e3:	56                   	push   %esi
+  8016e4:	ff d0                	call   *%eax
+  8016e6:	89 c3                	mov    %eax,%ebx
+  8016e8:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8016eb:	83 ec 08             	sub    $0x8,%esp
+  8016ee:	56                   	push   %esi
+  8016ef:	6a 00                	push   $0x0
+  8016f1:	e8 9f f7 ff ff       	call   800e95 <sys_page_unmap>
+	return r;
+  8016f6:	83 c4 10             	add    $0x10,%esp
+  8016f9:	eb b5                	jmp    8016b0 <fd_close+0x3c>
+
+008016fb <close>:
+
+int
+close(int fdnum)
+{
+  8016fb:	55                   	push   %ebp
+  8016fc:	89 e5                	mov    %esp,%ebp
+  8016fe:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801701:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801704:	50                   	push   %eax
+  801705:	ff 75 08             	push   0x8(%ebp)
+  801708:	e8 c4 fe ff ff       	call   8015d1 <fd_lookup>
+  80170d:	83 c4 10             	add    $0x10,%esp
+  801710:	85 c0                	test   %eax,%eax
+  801712:	79 02                	jns    801716 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801714:	c9                   	leave
+  801715:	c3                   	ret
+		return fd_close(fd, 1);
+  801716:	83 ec 08             	sub    $0x8,%esp
+  801719:	6a 01                	push   $0x1
+  80171b:	ff 75 f4             	push   -0xc(%ebp)
+  80171e:	e8 51 ff ff ff       	call   801674 <fd_close>
+  801723:	83 c4 10             	add    $0x10,%esp
+  801726:	eb ec                	jmp    801714 <close+0x19>
+
+00801728 <close_all>:
+
+void
+close_all(void)
+{
+  801728:	55                   	push   %ebp
+  801729:	89 e5                	mov    %esp,%ebp
+  80172b:	53                   	push   %ebx
+  80172c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80172f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	53                   	push   %ebx
+  801738:	e8 be ff ff ff       	call   8016fb <close>
+	for (i = 0; i < MAXFD; i++)
+  80173d:	83 c3 01             	add    $0x1,%ebx
+  801740:	83 c4 10             	add    $0x10,%esp
+  801743:	83 fb 20             	cmp    $0x20,%ebx
+  801746:	75 ec                	jne    801734 <close_all+0xc>
+}
+  801748:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80174b:	c9                   	leave
+  80174c:	c3                   	ret
+
+0080174d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80174d:	55                   	push   %ebp
+  80174e:	89 e5                	mov    %esp,%ebp
+  801750:	57                   	push   %edi
+  801751:	56                   	push   %esi
+  801752:	53                   	push   %ebx
+  801753:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801756:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801759:	50                   	push   %eax
+  80175a:	ff 75 08             	push   0x8(%ebp)
+  80175d:	e8 6f fe ff ff       	call   8015d1 <fd_lookup>
+  801762:	89 c3                	mov    %eax,%ebx
+  801764:	83 c4 10             	add    $0x10,%esp
+  801767:	85 c0                	test   %eax,%eax
+  801769:	78 7f                	js     8017ea <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80176b:	83 ec 0c             	sub    $0xc,%esp
+  80176e:	ff 75 0c             	push   0xc(%ebp)
+  801771:	e8 85 ff ff ff       	call   8016fb <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801776:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801779:	c1 e6 0c             	shl    $0xc,%esi
+  80177c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801782:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801785:	89 3c 24             	mov    %edi,(%esp)
+  801788:	e8 d7 fd ff ff       	call   801564 <fd2data>
+  80178d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80178f:	89 34 24             	mov    %esi,(%esp)
+  801792:	e8 cd fd ff ff       	call   801564 <fd2data>
+  801797:	83 c4 10             	add    $0x10,%esp
+  80179a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80179d:	89 d8                	mov    %ebx,%eax
+  80179f:	c1 e8 16             	shr    $0x16,%eax
+  8017a2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8017a9:	a8 01                	test   $0x1,%al
+  8017ab:	74 11                	je     8017be <dup+0x71>
+  8017ad:	89 d8                	mov    %ebx,%eax
+  8017af:	c1 e8 0c             	shr    $0xc,%eax
+  8017b2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017b9:	f6 c2 01             	test   $0x1,%dl
+  8017bc:	75 36                	jne    8017f4 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8017be:	89 f8                	mov    %edi,%eax
+  8017c0:	c1 e8 0c             	shr    $0xc,%eax
+  8017c3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017ca:	83 ec 0c             	sub    $0xc,%esp
+  8017cd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017d2:	50                   	push   %eax
+  8017d3:	56                   	push   %esi
+  8017d4:	6a 00                	push   $0x0
+  8017d6:	57                   	push   %edi
+  8017d7:	6a 00                	push   $0x0
+  8017d9:	e8 75 f6 ff ff       	call   800e53 <sys_page_map>
+  8017de:	89 c3                	mov    %eax,%ebx
+  8017e0:	83 c4 20             	add    $0x20,%esp
+  8017e3:	85 c0                	test   %eax,%eax
+  8017e5:	78 33                	js     80181a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8017e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8017ea:	89 d8                	mov    %ebx,%eax
+  8017ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ef:	5b                   	pop    %ebx
+  8017f0:	5e                   	pop    %esi
+  8017f1:	5f                   	pop    %edi
+  8017f2:	5d                   	pop    %ebp
+  8017f3:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8017f4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017fb:	83 ec 0c             	sub    $0xc,%esp
+  8017fe:	25 07 0e 00 00       	and    $0xe07,%eax
+  801803:	50                   	push   %eax
+  801804:	ff 75 d4             	push   -0x2c(%ebp)
+  801807:	6a 00                	push   $0x0
+  801809:	53                   	push   %ebx
+  80180a:	6a 00                	push   $0x0
+  80180c:	e8 42 f6 ff ff       	call   800e53 <sys_page_map>
+  801811:	89 c3                	mov    %eax,%ebx
+  801813:	83 c4 20             	add    $0x20,%esp
+  801816:	85 c0                	test   %eax,%eax
+  801818:	79 a4                	jns    8017be <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80181a:	83 ec 08             	sub    $0x8,%esp
+  80181d:	56                   	push   %esi
+  80181e:	6a 00                	push   $0x0
+  801820:	e8 70 f6 ff ff       	call   800e95 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801825:	83 c4 08             	add    $0x8,%esp
+  801828:	ff 75 d4             	push   -0x2c(%ebp)
+  80182b:	6a 00                	push   $0x0
+  80182d:	e8 63 f6 ff ff       	call   800e95 <sys_page_unmap>
+	return r;
+  801832:	83 c4 10             	add    $0x10,%esp
+  801835:	eb b3                	jmp    8017ea <dup+0x9d>
+
+00801837 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801837:	55                   	push   %ebp
+  801838:	89 e5                	mov    %esp,%ebp
+  80183a:	56                   	push   %esi
+  80183b:	53                   	push   %ebx
+  80183c:	83 ec 18             	sub    $0x18,%esp
+  80183f:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801842:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801845:	50                   	push   %eax
+  801846:	56                   	push   %esi
+  801847:	e8 85 fd ff ff       	call   8015d1 <fd_lookup>
+  80184c:	83 c4 10             	add    $0x10,%esp
+  80184f:	85 c0                	test   %eax,%eax
+  801851:	78 3c                	js     80188f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801853:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801856:	83 ec 08             	sub    $0x8,%esp
+  801859:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80185c:	50                   	push   %eax
+  80185d:	ff 33                	push   (%ebx)
+  80185f:	e8 bd fd ff ff       	call   801621 <dev_lookup>
+  801864:	83 c4 10             	add    $0x10,%esp
+  801867:	85 c0                	test   %eax,%eax
+  801869:	78 24                	js     80188f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80186b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80186e:	83 e0 03             	and    $0x3,%eax
+  801871:	83 f8 01             	cmp    $0x1,%eax
+  801874:	74 20                	je     801896 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801879:	8b 40 08             	mov    0x8(%eax),%eax
+  80187c:	85 c0                	test   %eax,%eax
+  80187e:	74 37                	je     8018b7 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801880:	83 ec 04             	sub    $0x4,%esp
+  801883:	ff 75 10             	push   0x10(%ebp)
+  801886:	ff 75 0c             	push   0xc(%ebp)
+  801889:	53                   	push   %ebx
+  80188a:	ff d0                	call   *%eax
+  80188c:	83 c4 10             	add    $0x10,%esp
+}
+  80188f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801892:	5b                   	pop    %ebx
+  801893:	5e                   	pop    %esi
+  801894:	5d                   	pop    %ebp
+  801895:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801896:	a1 08 50 80 00       	mov    0x805008,%eax
+  80189b:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80189e:	83 ec 04             	sub    $0x4,%esp
+  8018a1:	56                   	push   %esi
+  8018a2:	50                   	push   %eax
+  8018a3:	68 a1 31 80 00       	push   $0x8031a1
+  8018a8:	e8 c5 ea ff ff       	call   800372 <cprintf>
+		return -E_INVAL;
+  8018ad:	83 c4 10             	add    $0x10,%esp
+  8018b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b5:	eb d8                	jmp    80188f <read+0x58>
+		return -E_NOT_SUPP;
+  8018b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018bc:	eb d1                	jmp    80188f <read+0x58>
+
+008018be <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8018be:	55                   	push   %ebp
+  8018bf:	89 e5                	mov    %esp,%ebp
+  8018c1:	57                   	push   %edi
+  8018c2:	56                   	push   %esi
+  8018c3:	53                   	push   %ebx
+  8018c4:	83 ec 0c             	sub    $0xc,%esp
+  8018c7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8018ca:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8018cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d2:	eb 02                	jmp    8018d6 <readn+0x18>
+  8018d4:	01 c3                	add    %eax,%ebx
+  8018d6:	39 f3                	cmp    %esi,%ebx
+  8018d8:	73 21                	jae    8018fb <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018da:	83 ec 04             	sub    $0x4,%esp
+  8018dd:	89 f0                	mov    %esi,%eax
+  8018df:	29 d8                	sub    %ebx,%eax
+  8018e1:	50                   	push   %eax
+  8018e2:	89 d8                	mov    %ebx,%eax
+  8018e4:	03 45 0c             	add    0xc(%ebp),%eax
+  8018e7:	50                   	push   %eax
+  8018e8:	57                   	push   %edi
+  8018e9:	e8 49 ff ff ff       	call   801837 <read>
+		if (m < 0)
+  8018ee:	83 c4 10             	add    $0x10,%esp
+  8018f1:	85 c0                	test   %eax,%eax
+  8018f3:	78 04                	js     8018f9 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8018f5:	75 dd                	jne    8018d4 <readn+0x16>
+  8018f7:	eb 02                	jmp    8018fb <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018f9:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8018fb:	89 d8                	mov    %ebx,%eax
+  8018fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801900:	5b                   	pop    %ebx
+  801901:	5e                   	pop    %esi
+  801902:	5f                   	pop    %edi
+  801903:	5d                   	pop    %ebp
+  801904:	c3                   	ret
+
+00801905 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801905:	55                   	push   %ebp
+  801906:	89 e5                	mov    %esp,%ebp
+  801908:	56                   	push   %esi
+  801909:	53                   	push   %ebx
+  80190a:	83 ec 18             	sub    $0x18,%esp
+  80190d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801910:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801913:	50                   	push   %eax
+  801914:	53                   	push   %ebx
+  801915:	e8 b7 fc ff ff       	call   8015d1 <fd_lookup>
+  80191a:	83 c4 10             	add    $0x10,%esp
+  80191d:	85 c0                	test   %eax,%eax
+  80191f:	78 37                	js     801958 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801921:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801924:	83 ec 08             	sub    $0x8,%esp
+  801927:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80192a:	50                   	push   %eax
+  80192b:	ff 36                	push   (%esi)
+  80192d:	e8 ef fc ff ff       	call   801621 <dev_lookup>
+  801932:	83 c4 10             	add    $0x10,%esp
+  801935:	85 c0                	test   %eax,%eax
+  801937:	78 1f                	js     801958 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801939:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80193d:	74 20                	je     80195f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80193f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801942:	8b 40 0c             	mov    0xc(%eax),%eax
+  801945:	85 c0                	test   %eax,%eax
+  801947:	74 37                	je     801980 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801949:	83 ec 04             	sub    $0x4,%esp
+  80194c:	ff 75 10             	push   0x10(%ebp)
+  80194f:	ff 75 0c             	push   0xc(%ebp)
+  801952:	56                   	push   %esi
+  801953:	ff d0                	call   *%eax
+  801955:	83 c4 10             	add    $0x10,%esp
+}
+  801958:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80195b:	5b                   	pop    %ebx
+  80195c:	5e                   	pop    %esi
+  80195d:	5d                   	pop    %ebp
+  80195e:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80195f:	a1 08 50 80 00       	mov    0x805008,%eax
+  801964:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801967:	83 ec 04             	sub    $0x4,%esp
+  80196a:	53                   	push   %ebx
+  80196b:	50                   	push   %eax
+  80196c:	68 bd 31 80 00       	push   $0x8031bd
+  801971:	e8 fc e9 ff ff       	call   800372 <cprintf>
+		return -E_INVAL;
+  801976:	83 c4 10             	add    $0x10,%esp
+  801979:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80197e:	eb d8                	jmp    801958 <write+0x53>
+		return -E_NOT_SUPP;
+  801980:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801985:	eb d1                	jmp    801958 <write+0x53>
+
+00801987 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801987:	55                   	push   %ebp
+  801988:	89 e5                	mov    %esp,%ebp
+  80198a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80198d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801990:	50                   	push   %eax
+  801991:	ff 75 08             	push   0x8(%ebp)
+  801994:	e8 38 fc ff ff       	call   8015d1 <fd_lookup>
+  801999:	83 c4 10             	add    $0x10,%esp
+  80199c:	85 c0                	test   %eax,%eax
+  80199e:	78 0e                	js     8019ae <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8019a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019a6:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8019a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ae:	c9                   	leave
+  8019af:	c3                   	ret
+
+008019b0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019b0:	55                   	push   %ebp
+  8019b1:	89 e5                	mov    %esp,%ebp
+  8019b3:	56                   	push   %esi
+  8019b4:	53                   	push   %ebx
+  8019b5:	83 ec 18             	sub    $0x18,%esp
+  8019b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019bb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019be:	50                   	push   %eax
+  8019bf:	53                   	push   %ebx
+  8019c0:	e8 0c fc ff ff       	call   8015d1 <fd_lookup>
+  8019c5:	83 c4 10             	add    $0x10,%esp
+  8019c8:	85 c0                	test   %eax,%eax
+  8019ca:	78 34                	js     801a00 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019cc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019cf:	83 ec 08             	sub    $0x8,%esp
+  8019d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019d5:	50                   	push   %eax
+  8019d6:	ff 36                	push   (%esi)
+  8019d8:	e8 44 fc ff ff       	call   801621 <dev_lookup>
+  8019dd:	83 c4 10             	add    $0x10,%esp
+  8019e0:	85 c0                	test   %eax,%eax
+  8019e2:	78 1c                	js     801a00 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019e4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019e8:	74 1d                	je     801a07 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8019ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019ed:	8b 40 18             	mov    0x18(%eax),%eax
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	74 34                	je     801a28 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8019f4:	83 ec 08             	sub    $0x8,%esp
+  8019f7:	ff 75 0c             	push   0xc(%ebp)
+  8019fa:	56                   	push   %esi
+  8019fb:	ff d0                	call   *%eax
+  8019fd:	83 c4 10             	add    $0x10,%esp
+}
+  801a00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a03:	5b                   	pop    %ebx
+  801a04:	5e                   	pop    %esi
+  801a05:	5d                   	pop    %ebp
+  801a06:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801a07:	a1 08 50 80 00       	mov    0x805008,%eax
+  801a0c:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a0f:	83 ec 04             	sub    $0x4,%esp
+  801a12:	53                   	push   %ebx
+  801a13:	50                   	push   %eax
+  801a14:	68 80 31 80 00       	push   $0x803180
+  801a19:	e8 54 e9 ff ff       	call   800372 <cprintf>
+		return -E_INVAL;
+  801a1e:	83 c4 10             	add    $0x10,%esp
+  801a21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a26:	eb d8                	jmp    801a00 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a28:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a2d:	eb d1                	jmp    801a00 <ftruncate+0x50>
+
+00801a2f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a2f:	55                   	push   %ebp
+  801a30:	89 e5                	mov    %esp,%ebp
+  801a32:	56                   	push   %esi
+  801a33:	53                   	push   %ebx
+  801a34:	83 ec 18             	sub    $0x18,%esp
+  801a37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a3a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a3d:	50                   	push   %eax
+  801a3e:	ff 75 08             	push   0x8(%ebp)
+  801a41:	e8 8b fb ff ff       	call   8015d1 <fd_lookup>
+  801a46:	83 c4 10             	add    $0x10,%esp
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	78 49                	js     801a96 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a4d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a50:	83 ec 08             	sub    $0x8,%esp
+  801a53:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a56:	50                   	push   %eax
+  801a57:	ff 36                	push   (%esi)
+  801a59:	e8 c3 fb ff ff       	call   801621 <dev_lookup>
+  801a5e:	83 c4 10             	add    $0x10,%esp
+  801a61:	85 c0                	test   %eax,%eax
+  801a63:	78 31                	js     801a96 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a68:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a6c:	74 2f                	je     801a9d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a6e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a71:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a78:	00 00 00 
+	stat->st_isdir = 0;
+  801a7b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a82:	00 00 00 
+	stat->st_dev = dev;
+  801a85:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a8b:	83 ec 08             	sub    $0x8,%esp
+  801a8e:	53                   	push   %ebx
+  801a8f:	56                   	push   %esi
+  801a90:	ff 50 14             	call   *0x14(%eax)
+  801a93:	83 c4 10             	add    $0x10,%esp
+}
+  801a96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a99:	5b                   	pop    %ebx
+  801a9a:	5e                   	pop    %esi
+  801a9b:	5d                   	pop    %ebp
+  801a9c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a9d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aa2:	eb f2                	jmp    801a96 <fstat+0x67>
+
+00801aa4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801aa4:	55                   	push   %ebp
+  801aa5:	89 e5                	mov    %esp,%ebp
+  801aa7:	56                   	push   %esi
+  801aa8:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801aa9:	83 ec 08             	sub    $0x8,%esp
+  801aac:	6a 00                	push   $0x0
+  801aae:	ff 75 08             	push   0x8(%ebp)
+  801ab1:	e8 e4 01 00 00       	call   801c9a <open>
+  801ab6:	89 c3                	mov    %eax,%ebx
+  801ab8:	83 c4 10             	add    $0x10,%esp
+  801abb:	85 c0                	test   %eax,%eax
+  801abd:	78 1b                	js     801ada <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801abf:	83 ec 08             	sub    $0x8,%esp
+  801ac2:	ff 75 0c             	push   0xc(%ebp)
+  801ac5:	50                   	push   %eax
+  801ac6:	e8 64 ff ff ff       	call   801a2f <fstat>
+  801acb:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801acd:	89 1c 24             	mov    %ebx,(%esp)
+  801ad0:	e8 26 fc ff ff       	call   8016fb <close>
+	return r;
+  801ad5:	83 c4 10             	add    $0x10,%esp
+  801ad8:	89 f3                	mov    %esi,%ebx
+}
+  801ada:	89 d8                	mov    %ebx,%eax
+  801adc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801adf:	5b                   	pop    %ebx
+  801ae0:	5e                   	pop    %esi
+  801ae1:	5d                   	pop    %ebp
+  801ae2:	c3                   	ret
+
+00801ae3 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ae3:	55                   	push   %ebp
+  801ae4:	89 e5                	mov    %esp,%ebp
+  801ae6:	56                   	push   %esi
+  801ae7:	53                   	push   %ebx
+  801ae8:	89 c6                	mov    %eax,%esi
+  801aea:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801aec:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801af3:	74 27                	je     801b1c <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801af5:	6a 07                	push   $0x7
+  801af7:	68 00 60 80 00       	push   $0x806000
+  801afc:	56                   	push   %esi
+  801afd:	ff 35 00 50 80 00    	push   0x805000
+  801b03:	e8 66 0c 00 00       	call   80276e <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801b08:	83 c4 0c             	add    $0xc,%esp
+  801b0b:	6a 00                	push   $0x0
+  801b0d:	53                   	push   %ebx
+  801b0e:	6a 00                	push   $0x0
+  801b10:	e8 e1 0b 00 00       	call   8026f6 <ipc_recv>
+}
+  801b15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b18:	5b                   	pop    %ebx
+  801b19:	5e                   	pop    %esi
+  801b1a:	5d                   	pop    %ebp
+  801b1b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b1c:	83 ec 0c             	sub    $0xc,%esp
+  801b1f:	6a 01                	push   $0x1
+  801b21:	e8 9c 0c 00 00       	call   8027c2 <ipc_find_env>
+  801b26:	a3 00 50 80 00       	mov    %eax,0x805000
+  801b2b:	83 c4 10             	add    $0x10,%esp
+  801b2e:	eb c5                	jmp    801af5 <fsipc+0x12>
+
+00801b30 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801b30:	55                   	push   %ebp
+  801b31:	89 e5                	mov    %esp,%ebp
+  801b33:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b39:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b3c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801b41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b44:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801b49:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b53:	e8 8b ff ff ff       	call   801ae3 <fsipc>
+}
+  801b58:	c9                   	leave
+  801b59:	c3                   	ret
+
+00801b5a <devfile_flush>:
+{
+  801b5a:	55                   	push   %ebp
+  801b5b:	89 e5                	mov    %esp,%ebp
+  801b5d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b63:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b66:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801b6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b70:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b75:	e8 69 ff ff ff       	call   801ae3 <fsipc>
+}
+  801b7a:	c9                   	leave
+  801b7b:	c3                   	ret
+
+00801b7c <devfile_stat>:
+{
+  801b7c:	55                   	push   %ebp
+  801b7d:	89 e5                	mov    %esp,%ebp
+  801b7f:	53                   	push   %ebx
+  801b80:	83 ec 04             	sub    $0x4,%esp
+  801b83:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b86:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b89:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b8c:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b91:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b96:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b9b:	e8 43 ff ff ff       	call   801ae3 <fsipc>
+  801ba0:	85 c0                	test   %eax,%eax
+  801ba2:	78 2c                	js     801bd0 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ba4:	83 ec 08             	sub    $0x8,%esp
+  801ba7:	68 00 60 80 00       	push   $0x806000
+  801bac:	53                   	push   %ebx
+  801bad:	e8 ae ed ff ff       	call   800960 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801bb2:	a1 80 60 80 00       	mov    0x806080,%eax
+  801bb7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801bbd:	a1 84 60 80 00       	mov    0x806084,%eax
+  801bc2:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801bc8:	83 c4 10             	add    $0x10,%esp
+  801bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd3:	c9                   	leave
+  801bd4:	c3                   	ret
+
+00801bd5 <devfile_write>:
+{
+  801bd5:	55                   	push   %ebp
+  801bd6:	89 e5                	mov    %esp,%ebp
+  801bd8:	83 ec 0c             	sub    $0xc,%esp
+  801bdb:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801bde:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801be3:	39 d0                	cmp    %edx,%eax
+  801be5:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801be8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801beb:	8b 52 0c             	mov    0xc(%edx),%edx
+  801bee:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801bf4:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801bf9:	50                   	push   %eax
+  801bfa:	ff 75 0c             	push   0xc(%ebp)
+  801bfd:	68 08 60 80 00       	push   $0x806008
+  801c02:	e8 df ee ff ff       	call   800ae6 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801c07:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c11:	e8 cd fe ff ff       	call   801ae3 <fsipc>
+}
+  801c16:	c9                   	leave
+  801c17:	c3                   	ret
+
+00801c18 <devfile_read>:
+{
+  801c18:	55                   	push   %ebp
+  801c19:	89 e5                	mov    %esp,%ebp
+  801c1b:	56                   	push   %esi
+  801c1c:	53                   	push   %ebx
+  801c1d:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c20:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c23:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c26:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801c2b:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c36:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c3b:	e8 a3 fe ff ff       	call   801ae3 <fsipc>
+  801c40:	89 c3                	mov    %eax,%ebx
+  801c42:	85 c0                	test   %eax,%eax
+  801c44:	78 1f                	js     801c65 <devfile_read+0x4d>
+	assert(r <= n);
+  801c46:	39 c6                	cmp    %eax,%esi
+  801c48:	72 24                	jb     801c6e <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801c4a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c4f:	7f 33                	jg     801c84 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c51:	83 ec 04             	sub    $0x4,%esp
+  801c54:	50                   	push   %eax
+  801c55:	68 00 60 80 00       	push   $0x806000
+  801c5a:	ff 75 0c             	push   0xc(%ebp)
+  801c5d:	e8 84 ee ff ff       	call   800ae6 <memmove>
+	return r;
+  801c62:	83 c4 10             	add    $0x10,%esp
+}
+  801c65:	89 d8                	mov    %ebx,%eax
+  801c67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c6a:	5b                   	pop    %ebx
+  801c6b:	5e                   	pop    %esi
+  801c6c:	5d                   	pop    %ebp
+  801c6d:	c3                   	ret
+	assert(r <= n);
+  801c6e:	68 f0 31 80 00       	push   $0x8031f0
+  801c73:	68 f7 31 80 00       	push   $0x8031f7
+  801c78:	6a 7c                	push   $0x7c
+  801c7a:	68 0c 32 80 00       	push   $0x80320c
+  801c7f:	e8 13 e6 ff ff       	call   800297 <_panic>
+	assert(r <= PGSIZE);
+  801c84:	68 17 32 80 00       	push   $0x803217
+  801c89:	68 f7 31 80 00       	push   $0x8031f7
+  801c8e:	6a 7d                	push   $0x7d
+  801c90:	68 0c 32 80 00       	push   $0x80320c
+  801c95:	e8 fd e5 ff ff       	call   800297 <_panic>
+
+00801c9a <open>:
+{
+  801c9a:	55                   	push   %ebp
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	56                   	push   %esi
+  801c9e:	53                   	push   %ebx
+  801c9f:	83 ec 1c             	sub    $0x1c,%esp
+  801ca2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ca5:	56                   	push   %esi
+  801ca6:	e8 7a ec ff ff       	call   800925 <strlen>
+  801cab:	83 c4 10             	add    $0x10,%esp
+  801cae:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cb3:	7f 6c                	jg     801d21 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801cb5:	83 ec 0c             	sub    $0xc,%esp
+  801cb8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cbb:	50                   	push   %eax
+  801cbc:	e8 ba f8 ff ff       	call   80157b <fd_alloc>
+  801cc1:	89 c3                	mov    %eax,%ebx
+  801cc3:	83 c4 10             	add    $0x10,%esp
+  801cc6:	85 c0                	test   %eax,%eax
+  801cc8:	78 3c                	js     801d06 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801cca:	83 ec 08             	sub    $0x8,%esp
+  801ccd:	56                   	push   %esi
+  801cce:	68 00 60 80 00       	push   $0x806000
+  801cd3:	e8 88 ec ff ff       	call   800960 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801cd8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cdb:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ce0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ce3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ce8:	e8 f6 fd ff ff       	call   801ae3 <fsipc>
+  801ced:	89 c3                	mov    %eax,%ebx
+  801cef:	83 c4 10             	add    $0x10,%esp
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	78 19                	js     801d0f <open+0x75>
+	return fd2num(fd);
+  801cf6:	83 ec 0c             	sub    $0xc,%esp
+  801cf9:	ff 75 f4             	push   -0xc(%ebp)
+  801cfc:	e8 53 f8 ff ff       	call   801554 <fd2num>
+  801d01:	89 c3                	mov    %eax,%ebx
+  801d03:	83 c4 10             	add    $0x10,%esp
+}
+  801d06:	89 d8                	mov    %ebx,%eax
+  801d08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d0b:	5b                   	pop    %ebx
+  801d0c:	5e                   	pop    %esi
+  801d0d:	5d                   	pop    %ebp
+  801d0e:	c3                   	ret
+		fd_close(fd, 0);
+  801d0f:	83 ec 08             	sub    $0x8,%esp
+  801d12:	6a 00                	push   $0x0
+  801d14:	ff 75 f4             	push   -0xc(%ebp)
+  801d17:	e8 58 f9 ff ff       	call   801674 <fd_close>
+		return r;
+  801d1c:	83 c4 10             	add    $0x10,%esp
+  801d1f:	eb e5                	jmp    801d06 <open+0x6c>
+		return -E_BAD_PATH;
+  801d21:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d26:	eb de                	jmp    801d06 <open+0x6c>
+
+00801d28 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801d28:	55                   	push   %ebp
+  801d29:	89 e5                	mov    %esp,%ebp
+  801d2b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d33:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d38:	e8 a6 fd ff ff       	call   801ae3 <fsipc>
+}
+  801d3d:	c9                   	leave
+  801d3e:	c3                   	ret
+
+00801d3f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d3f:	55                   	push   %ebp
+  801d40:	89 e5                	mov    %esp,%ebp
+  801d42:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801d45:	68 23 32 80 00       	push   $0x803223
+  801d4a:	ff 75 0c             	push   0xc(%ebp)
+  801d4d:	e8 0e ec ff ff       	call   800960 <strcpy>
+	return 0;
+}
+  801d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d57:	c9                   	leave
+  801d58:	c3                   	ret
+
+00801d59 <devsock_close>:
+{
+  801d59:	55                   	push   %ebp
+  801d5a:	89 e5                	mov    %esp,%ebp
+  801d5c:	53                   	push   %ebx
+  801d5d:	83 ec 10             	sub    $0x10,%esp
+  801d60:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801d63:	53                   	push   %ebx
+  801d64:	e8 69 0a 00 00       	call   8027d2 <pageref>
+  801d69:	89 c2                	mov    %eax,%edx
+  801d6b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801d73:	83 fa 01             	cmp    $0x1,%edx
+  801d76:	74 05                	je     801d7d <devsock_close+0x24>
+}
+  801d78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d7b:	c9                   	leave
+  801d7c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801d7d:	83 ec 0c             	sub    $0xc,%esp
+  801d80:	ff 73 0c             	push   0xc(%ebx)
+  801d83:	e8 b7 02 00 00       	call   80203f <nsipc_close>
+  801d88:	83 c4 10             	add    $0x10,%esp
+  801d8b:	eb eb                	jmp    801d78 <devsock_close+0x1f>
+
+00801d8d <devsock_write>:
+{
+  801d8d:	55                   	push   %ebp
+  801d8e:	89 e5                	mov    %esp,%ebp
+  801d90:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801d93:	6a 00                	push   $0x0
+  801d95:	ff 75 10             	push   0x10(%ebp)
+  801d98:	ff 75 0c             	push   0xc(%ebp)
+  801d9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d9e:	ff 70 0c             	push   0xc(%eax)
+  801da1:	e8 79 03 00 00       	call   80211f <nsipc_send>
+}
+  801da6:	c9                   	leave
+  801da7:	c3                   	ret
+
+00801da8 <devsock_read>:
+{
+  801da8:	55                   	push   %ebp
+  801da9:	89 e5                	mov    %esp,%ebp
+  801dab:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801dae:	6a 00                	push   $0x0
+  801db0:	ff 75 10             	push   0x10(%ebp)
+  801db3:	ff 75 0c             	push   0xc(%ebp)
+  801db6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db9:	ff 70 0c             	push   0xc(%eax)
+  801dbc:	e8 ef 02 00 00       	call   8020b0 <nsipc_recv>
+}
+  801dc1:	c9                   	leave
+  801dc2:	c3                   	ret
+
+00801dc3 <fd2sockid>:
+{
+  801dc3:	55                   	push   %ebp
+  801dc4:	89 e5                	mov    %esp,%ebp
+  801dc6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801dc9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801dcc:	52                   	push   %edx
+  801dcd:	50                   	push   %eax
+  801dce:	e8 fe f7 ff ff       	call   8015d1 <fd_lookup>
+  801dd3:	83 c4 10             	add    $0x10,%esp
+  801dd6:	85 c0                	test   %eax,%eax
+  801dd8:	78 10                	js     801dea <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801dda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ddd:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801de3:	39 08                	cmp    %ecx,(%eax)
+  801de5:	75 05                	jne    801dec <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801de7:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801dea:	c9                   	leave
+  801deb:	c3                   	ret
+		return -E_NOT_SUPP;
+  801dec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801df1:	eb f7                	jmp    801dea <fd2sockid+0x27>
+
+00801df3 <alloc_sockfd>:
+{
+  801df3:	55                   	push   %ebp
+  801df4:	89 e5                	mov    %esp,%ebp
+  801df6:	56                   	push   %esi
+  801df7:	53                   	push   %ebx
+  801df8:	83 ec 1c             	sub    $0x1c,%esp
+  801dfb:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801dfd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e00:	50                   	push   %eax
+  801e01:	e8 75 f7 ff ff       	call   80157b <fd_alloc>
+  801e06:	89 c3                	mov    %eax,%ebx
+  801e08:	83 c4 10             	add    $0x10,%esp
+  801e0b:	85 c0                	test   %eax,%eax
+  801e0d:	78 43                	js     801e52 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801e0f:	83 ec 04             	sub    $0x4,%esp
+  801e12:	68 07 04 00 00       	push   $0x407
+  801e17:	ff 75 f4             	push   -0xc(%ebp)
+  801e1a:	6a 00                	push   $0x0
+  801e1c:	e8 ac ef ff ff       	call   800dcd <sys_page_alloc>
+  801e21:	89 c3                	mov    %eax,%ebx
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 28                	js     801e52 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801e2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e2d:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801e33:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801e35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e38:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801e3f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801e42:	83 ec 0c             	sub    $0xc,%esp
+  801e45:	50                   	push   %eax
+  801e46:	e8 09 f7 ff ff       	call   801554 <fd2num>
+  801e4b:	89 c3                	mov    %eax,%ebx
+  801e4d:	83 c4 10             	add    $0x10,%esp
+  801e50:	eb 0c                	jmp    801e5e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801e52:	83 ec 0c             	sub    $0xc,%esp
+  801e55:	56                   	push   %esi
+  801e56:	e8 e4 01 00 00       	call   80203f <nsipc_close>
+		return r;
+  801e5b:	83 c4 10             	add    $0x10,%esp
+}
+  801e5e:	89 d8                	mov    %ebx,%eax
+  801e60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e63:	5b                   	pop    %ebx
+  801e64:	5e                   	pop    %esi
+  801e65:	5d                   	pop    %ebp
+  801e66:	c3                   	ret
+
+00801e67 <accept>:
+{
+  801e67:	55                   	push   %ebp
+  801e68:	89 e5                	mov    %esp,%ebp
+  801e6a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e70:	e8 4e ff ff ff       	call   801dc3 <fd2sockid>
+  801e75:	85 c0                	test   %eax,%eax
+  801e77:	78 1b                	js     801e94 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801e79:	83 ec 04             	sub    $0x4,%esp
+  801e7c:	ff 75 10             	push   0x10(%ebp)
+  801e7f:	ff 75 0c             	push   0xc(%ebp)
+  801e82:	50                   	push   %eax
+  801e83:	e8 0e 01 00 00       	call   801f96 <nsipc_accept>
+  801e88:	83 c4 10             	add    $0x10,%esp
+  801e8b:	85 c0                	test   %eax,%eax
+  801e8d:	78 05                	js     801e94 <accept+0x2d>
+	return alloc_sockfd(r);
+  801e8f:	e8 5f ff ff ff       	call   801df3 <alloc_sockfd>
+}
+  801e94:	c9                   	leave
+  801e95:	c3                   	ret
+
+00801e96 <bind>:
+{
+  801e96:	55                   	push   %ebp
+  801e97:	89 e5                	mov    %esp,%ebp
+  801e99:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e9f:	e8 1f ff ff ff       	call   801dc3 <fd2sockid>
+  801ea4:	85 c0                	test   %eax,%eax
+  801ea6:	78 12                	js     801eba <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801ea8:	83 ec 04             	sub    $0x4,%esp
+  801eab:	ff 75 10             	push   0x10(%ebp)
+  801eae:	ff 75 0c             	push   0xc(%ebp)
+  801eb1:	50                   	push   %eax
+  801eb2:	e8 31 01 00 00       	call   801fe8 <nsipc_bind>
+  801eb7:	83 c4 10             	add    $0x10,%esp
+}
+  801eba:	c9                   	leave
+  801ebb:	c3                   	ret
+
+00801ebc <shutdown>:
+{
+  801ebc:	55                   	push   %ebp
+  801ebd:	89 e5                	mov    %esp,%ebp
+  801ebf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ec2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec5:	e8 f9 fe ff ff       	call   801dc3 <fd2sockid>
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	78 0f                	js     801edd <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801ece:	83 ec 08             	sub    $0x8,%esp
+  801ed1:	ff 75 0c             	push   0xc(%ebp)
+  801ed4:	50                   	push   %eax
+  801ed5:	e8 43 01 00 00       	call   80201d <nsipc_shutdown>
+  801eda:	83 c4 10             	add    $0x10,%esp
+}
+  801edd:	c9                   	leave
+  801ede:	c3                   	ret
+
+00801edf <connect>:
+{
+  801edf:	55                   	push   %ebp
+  801ee0:	89 e5                	mov    %esp,%ebp
+  801ee2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ee5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee8:	e8 d6 fe ff ff       	call   801dc3 <fd2sockid>
+  801eed:	85 c0                	test   %eax,%eax
+  801eef:	78 12                	js     801f03 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ef1:	83 ec 04             	sub    $0x4,%esp
+  801ef4:	ff 75 10             	push   0x10(%ebp)
+  801ef7:	ff 75 0c             	push   0xc(%ebp)
+  801efa:	50                   	push   %eax
+  801efb:	e8 59 01 00 00       	call   802059 <nsipc_connect>
+  801f00:	83 c4 10             	add    $0x10,%esp
+}
+  801f03:	c9                   	leave
+  801f04:	c3                   	ret
+
+00801f05 <listen>:
+{
+  801f05:	55                   	push   %ebp
+  801f06:	89 e5                	mov    %esp,%ebp
+  801f08:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0e:	e8 b0 fe ff ff       	call   801dc3 <fd2sockid>
+  801f13:	85 c0                	test   %eax,%eax
+  801f15:	78 0f                	js     801f26 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801f17:	83 ec 08             	sub    $0x8,%esp
+  801f1a:	ff 75 0c             	push   0xc(%ebp)
+  801f1d:	50                   	push   %eax
+  801f1e:	e8 6b 01 00 00       	call   80208e <nsipc_listen>
+  801f23:	83 c4 10             	add    $0x10,%esp
+}
+  801f26:	c9                   	leave
+  801f27:	c3                   	ret
+
+00801f28 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801f28:	55                   	push   %ebp
+  801f29:	89 e5                	mov    %esp,%ebp
+  801f2b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801f2e:	ff 75 10             	push   0x10(%ebp)
+  801f31:	ff 75 0c             	push   0xc(%ebp)
+  801f34:	ff 75 08             	push   0x8(%ebp)
+  801f37:	e8 41 02 00 00       	call   80217d <nsipc_socket>
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	78 05                	js     801f48 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801f43:	e8 ab fe ff ff       	call   801df3 <alloc_sockfd>
+}
+  801f48:	c9                   	leave
+  801f49:	c3                   	ret
+
+00801f4a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801f4a:	55                   	push   %ebp
+  801f4b:	89 e5                	mov    %esp,%ebp
+  801f4d:	53                   	push   %ebx
+  801f4e:	83 ec 04             	sub    $0x4,%esp
+  801f51:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801f53:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801f5a:	74 26                	je     801f82 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801f5c:	6a 07                	push   $0x7
+  801f5e:	68 00 70 80 00       	push   $0x807000
+  801f63:	53                   	push   %ebx
+  801f64:	ff 35 04 50 80 00    	push   0x805004
+  801f6a:	e8 ff 07 00 00       	call   80276e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f6f:	83 c4 0c             	add    $0xc,%esp
+  801f72:	6a 00                	push   $0x0
+  801f74:	6a 00                	push   $0x0
+  801f76:	6a 00                	push   $0x0
+  801f78:	e8 79 07 00 00       	call   8026f6 <ipc_recv>
+}
+  801f7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f80:	c9                   	leave
+  801f81:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f82:	83 ec 0c             	sub    $0xc,%esp
+  801f85:	6a 02                	push   $0x2
+  801f87:	e8 36 08 00 00       	call   8027c2 <ipc_find_env>
+  801f8c:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f91:	83 c4 10             	add    $0x10,%esp
+  801f94:	eb c6                	jmp    801f5c <nsipc+0x12>
+
+00801f96 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801f96:	55                   	push   %ebp
+  801f97:	89 e5                	mov    %esp,%ebp
+  801f99:	56                   	push   %esi
+  801f9a:	53                   	push   %ebx
+  801f9b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801f9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801fa6:	8b 06                	mov    (%esi),%eax
+  801fa8:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801fad:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fb2:	e8 93 ff ff ff       	call   801f4a <nsipc>
+  801fb7:	89 c3                	mov    %eax,%ebx
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	79 09                	jns    801fc6 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801fbd:	89 d8                	mov    %ebx,%eax
+  801fbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc2:	5b                   	pop    %ebx
+  801fc3:	5e                   	pop    %esi
+  801fc4:	5d                   	pop    %ebp
+  801fc5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801fc6:	83 ec 04             	sub    $0x4,%esp
+  801fc9:	ff 35 10 70 80 00    	push   0x807010
+  801fcf:	68 00 70 80 00       	push   $0x807000
+  801fd4:	ff 75 0c             	push   0xc(%ebp)
+  801fd7:	e8 0a eb ff ff       	call   800ae6 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801fdc:	a1 10 70 80 00       	mov    0x807010,%eax
+  801fe1:	89 06                	mov    %eax,(%esi)
+  801fe3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801fe6:	eb d5                	jmp    801fbd <nsipc_accept+0x27>
+
+00801fe8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801fe8:	55                   	push   %ebp
+  801fe9:	89 e5                	mov    %esp,%ebp
+  801feb:	53                   	push   %ebx
+  801fec:	83 ec 08             	sub    $0x8,%esp
+  801fef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ff2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff5:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ffa:	53                   	push   %ebx
+  801ffb:	ff 75 0c             	push   0xc(%ebp)
+  801ffe:	68 04 70 80 00       	push   $0x807004
+  802003:	e8 de ea ff ff       	call   800ae6 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802008:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80200e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802013:	e8 32 ff ff ff       	call   801f4a <nsipc>
+}
+  802018:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80201b:	c9                   	leave
+  80201c:	c3                   	ret
+
+0080201d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802023:	8b 45 08             	mov    0x8(%ebp),%eax
+  802026:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  80202b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80202e:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802033:	b8 03 00 00 00       	mov    $0x3,%eax
+  802038:	e8 0d ff ff ff       	call   801f4a <nsipc>
+}
+  80203d:	c9                   	leave
+  80203e:	c3                   	ret
+
+0080203f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80203f:	55                   	push   %ebp
+  802040:	89 e5                	mov    %esp,%ebp
+  802042:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802045:	8b 45 08             	mov    0x8(%ebp),%eax
+  802048:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80204d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802052:	e8 f3 fe ff ff       	call   801f4a <nsipc>
+}
+  802057:	c9                   	leave
+  802058:	c3                   	ret
+
+00802059 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802059:	55                   	push   %ebp
+  80205a:	89 e5                	mov    %esp,%ebp
+  80205c:	53                   	push   %ebx
+  80205d:	83 ec 08             	sub    $0x8,%esp
+  802060:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802063:	8b 45 08             	mov    0x8(%ebp),%eax
+  802066:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80206b:	53                   	push   %ebx
+  80206c:	ff 75 0c             	push   0xc(%ebp)
+  80206f:	68 04 70 80 00       	push   $0x807004
+  802074:	e8 6d ea ff ff       	call   800ae6 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802079:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80207f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802084:	e8 c1 fe ff ff       	call   801f4a <nsipc>
+}
+  802089:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80208c:	c9                   	leave
+  80208d:	c3                   	ret
+
+0080208e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80208e:	55                   	push   %ebp
+  80208f:	89 e5                	mov    %esp,%ebp
+  802091:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802094:	8b 45 08             	mov    0x8(%ebp),%eax
+  802097:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80209c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80209f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8020a4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8020a9:	e8 9c fe ff ff       	call   801f4a <nsipc>
+}
+  8020ae:	c9                   	leave
+  8020af:	c3                   	ret
+
+008020b0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8020b0:	55                   	push   %ebp
+  8020b1:	89 e5                	mov    %esp,%ebp
+  8020b3:	56                   	push   %esi
+  8020b4:	53                   	push   %ebx
+  8020b5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8020b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020bb:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8020c0:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8020c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020c9:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8020ce:	b8 07 00 00 00       	mov    $0x7,%eax
+  8020d3:	e8 72 fe ff ff       	call   801f4a <nsipc>
+  8020d8:	89 c3                	mov    %eax,%ebx
+  8020da:	85 c0                	test   %eax,%eax
+  8020dc:	78 22                	js     802100 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8020de:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8020e3:	39 c6                	cmp    %eax,%esi
+  8020e5:	0f 4e c6             	cmovle %esi,%eax
+  8020e8:	39 c3                	cmp    %eax,%ebx
+  8020ea:	7f 1d                	jg     802109 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8020ec:	83 ec 04             	sub    $0x4,%esp
+  8020ef:	53                   	push   %ebx
+  8020f0:	68 00 70 80 00       	push   $0x807000
+  8020f5:	ff 75 0c             	push   0xc(%ebp)
+  8020f8:	e8 e9 e9 ff ff       	call   800ae6 <memmove>
+  8020fd:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802100:	89 d8                	mov    %ebx,%eax
+  802102:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802105:	5b                   	pop    %ebx
+  802106:	5e                   	pop    %esi
+  802107:	5d                   	pop    %ebp
+  802108:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802109:	68 2f 32 80 00       	push   $0x80322f
+  80210e:	68 f7 31 80 00       	push   $0x8031f7
+  802113:	6a 62                	push   $0x62
+  802115:	68 44 32 80 00       	push   $0x803244
+  80211a:	e8 78 e1 ff ff       	call   800297 <_panic>
+
+0080211f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80211f:	55                   	push   %ebp
+  802120:	89 e5                	mov    %esp,%ebp
+  802122:	53                   	push   %ebx
+  802123:	83 ec 04             	sub    $0x4,%esp
+  802126:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802129:	8b 45 08             	mov    0x8(%ebp),%eax
+  80212c:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802131:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802137:	7f 2e                	jg     802167 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802139:	83 ec 04             	sub    $0x4,%esp
+  80213c:	53                   	push   %ebx
+  80213d:	ff 75 0c             	push   0xc(%ebp)
+  802140:	68 0c 70 80 00       	push   $0x80700c
+  802145:	e8 9c e9 ff ff       	call   800ae6 <memmove>
+	nsipcbuf.send.req_size = size;
+  80214a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802150:	8b 45 14             	mov    0x14(%ebp),%eax
+  802153:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802158:	b8 08 00 00 00       	mov    $0x8,%eax
+  80215d:	e8 e8 fd ff ff       	call   801f4a <nsipc>
+}
+  802162:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802165:	c9                   	leave
+  802166:	c3                   	ret
+	assert(size < 1600);
+  802167:	68 50 32 80 00       	push   $0x803250
+  80216c:	68 f7 31 80 00       	push   $0x8031f7
+  802171:	6a 6d                	push   $0x6d
+  802173:	68 44 32 80 00       	push   $0x803244
+  802178:	e8 1a e1 ff ff       	call   800297 <_panic>
+
+0080217d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80217d:	55                   	push   %ebp
+  80217e:	89 e5                	mov    %esp,%ebp
+  802180:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802183:	8b 45 08             	mov    0x8(%ebp),%eax
+  802186:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80218b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80218e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802193:	8b 45 10             	mov    0x10(%ebp),%eax
+  802196:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80219b:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021a0:	e8 a5 fd ff ff       	call   801f4a <nsipc>
+}
+  8021a5:	c9                   	leave
+  8021a6:	c3                   	ret
+
+008021a7 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8021a7:	55                   	push   %ebp
+  8021a8:	89 e5                	mov    %esp,%ebp
+  8021aa:	56                   	push   %esi
+  8021ab:	53                   	push   %ebx
+  8021ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8021af:	83 ec 0c             	sub    $0xc,%esp
+  8021b2:	ff 75 08             	push   0x8(%ebp)
+  8021b5:	e8 aa f3 ff ff       	call   801564 <fd2data>
+  8021ba:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8021bc:	83 c4 08             	add    $0x8,%esp
+  8021bf:	68 5c 32 80 00       	push   $0x80325c
+  8021c4:	53                   	push   %ebx
+  8021c5:	e8 96 e7 ff ff       	call   800960 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8021ca:	8b 46 04             	mov    0x4(%esi),%eax
+  8021cd:	2b 06                	sub    (%esi),%eax
+  8021cf:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8021d5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021dc:	00 00 00 
+	stat->st_dev = &devpipe;
+  8021df:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8021e6:	40 80 00 
+	return 0;
+}
+  8021e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021f1:	5b                   	pop    %ebx
+  8021f2:	5e                   	pop    %esi
+  8021f3:	5d                   	pop    %ebp
+  8021f4:	c3                   	ret
+
+008021f5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8021f5:	55                   	push   %ebp
+  8021f6:	89 e5                	mov    %esp,%ebp
+  8021f8:	53                   	push   %ebx
+  8021f9:	83 ec 0c             	sub    $0xc,%esp
+  8021fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8021ff:	53                   	push   %ebx
+  802200:	6a 00                	push   $0x0
+  802202:	e8 8e ec ff ff       	call   800e95 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802207:	89 1c 24             	mov    %ebx,(%esp)
+  80220a:	e8 55 f3 ff ff       	call   801564 <fd2data>
+  80220f:	83 c4 08             	add    $0x8,%esp
+  802212:	50                   	push   %eax
+  802213:	6a 00                	push   $0x0
+  802215:	e8 7b ec ff ff       	call   800e95 <sys_page_unmap>
+}
+  80221a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80221d:	c9                   	leave
+  80221e:	c3                   	ret
+
+0080221f <_pipeisclosed>:
+{
+  80221f:	55                   	push   %ebp
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	57                   	push   %edi
+  802223:	56                   	push   %esi
+  802224:	53                   	push   %ebx
+  802225:	83 ec 1c             	sub    $0x1c,%esp
+  802228:	89 c7                	mov    %eax,%edi
+  80222a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80222c:	a1 08 50 80 00       	mov    0x805008,%eax
+  802231:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802234:	83 ec 0c             	sub    $0xc,%esp
+  802237:	57                   	push   %edi
+  802238:	e8 95 05 00 00       	call   8027d2 <pageref>
+  80223d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802240:	89 34 24             	mov    %esi,(%esp)
+  802243:	e8 8a 05 00 00       	call   8027d2 <pageref>
+		nn = thisenv->env_runs;
+  802248:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  80224e:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802251:	83 c4 10             	add    $0x10,%esp
+  802254:	39 cb                	cmp    %ecx,%ebx
+  802256:	74 1b                	je     802273 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802258:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80225b:	75 cf                	jne    80222c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80225d:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802260:	6a 01                	push   $0x1
+  802262:	50                   	push   %eax
+  802263:	53                   	push   %ebx
+  802264:	68 63 32 80 00       	push   $0x803263
+  802269:	e8 04 e1 ff ff       	call   800372 <cprintf>
+  80226e:	83 c4 10             	add    $0x10,%esp
+  802271:	eb b9                	jmp    80222c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802273:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802276:	0f 94 c0             	sete   %al
+  802279:	0f b6 c0             	movzbl %al,%eax
+}
+  80227c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80227f:	5b                   	pop    %ebx
+  802280:	5e                   	pop    %esi
+  802281:	5f                   	pop    %edi
+  802282:	5d                   	pop    %ebp
+  802283:	c3                   	ret
+
+00802284 <devpipe_write>:
+{
+  802284:	55                   	push   %ebp
+  802285:	89 e5                	mov    %esp,%ebp
+  802287:	57                   	push   %edi
+  802288:	56                   	push   %esi
+  802289:	53                   	push   %ebx
+  80228a:	83 ec 28             	sub    $0x28,%esp
+  80228d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802290:	56                   	push   %esi
+  802291:	e8 ce f2 ff ff       	call   801564 <fd2data>
+  802296:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802298:	83 c4 10             	add    $0x10,%esp
+  80229b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a0:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8022a3:	75 09                	jne    8022ae <devpipe_write+0x2a>
+	return i;
+  8022a5:	89 f8                	mov    %edi,%eax
+  8022a7:	eb 23                	jmp    8022cc <devpipe_write+0x48>
+			sys_yield();
+  8022a9:	e8 9f ea ff ff       	call   800d4d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8022ae:	8b 43 04             	mov    0x4(%ebx),%eax
+  8022b1:	8b 0b                	mov    (%ebx),%ecx
+  8022b3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8022b6:	39 d0                	cmp    %edx,%eax
+  8022b8:	72 1a                	jb     8022d4 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8022ba:	89 da                	mov    %ebx,%edx
+  8022bc:	89 f0                	mov    %esi,%eax
+  8022be:	e8 5c ff ff ff       	call   80221f <_pipeisclosed>
+  8022c3:	85 c0                	test   %eax,%eax
+  8022c5:	74 e2                	je     8022a9 <devpipe_write+0x25>
+				return 0;
+  8022c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022cf:	5b                   	pop    %ebx
+  8022d0:	5e                   	pop    %esi
+  8022d1:	5f                   	pop    %edi
+  8022d2:	5d                   	pop    %ebp
+  8022d3:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8022d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022d7:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8022db:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8022de:	89 c2                	mov    %eax,%edx
+  8022e0:	c1 fa 1f             	sar    $0x1f,%edx
+  8022e3:	89 d1                	mov    %edx,%ecx
+  8022e5:	c1 e9 1b             	shr    $0x1b,%ecx
+  8022e8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8022eb:	83 e2 1f             	and    $0x1f,%edx
+  8022ee:	29 ca                	sub    %ecx,%edx
+  8022f0:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8022f4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8022f8:	83 c0 01             	add    $0x1,%eax
+  8022fb:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8022fe:	83 c7 01             	add    $0x1,%edi
+  802301:	eb 9d                	jmp    8022a0 <devpipe_write+0x1c>
+
+00802303 <devpipe_read>:
+{
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	57                   	push   %edi
+  802307:	56                   	push   %esi
+  802308:	53                   	push   %ebx
+  802309:	83 ec 18             	sub    $0x18,%esp
+  80230c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80230f:	57                   	push   %edi
+  802310:	e8 4f f2 ff ff       	call   801564 <fd2data>
+  802315:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802317:	83 c4 10             	add    $0x10,%esp
+  80231a:	be 00 00 00 00       	mov    $0x0,%esi
+  80231f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802322:	75 13                	jne    802337 <devpipe_read+0x34>
+	return i;
+  802324:	89 f0                	mov    %esi,%eax
+  802326:	eb 02                	jmp    80232a <devpipe_read+0x27>
+				return i;
+  802328:	89 f0                	mov    %esi,%eax
+}
+  80232a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80232d:	5b                   	pop    %ebx
+  80232e:	5e                   	pop    %esi
+  80232f:	5f                   	pop    %edi
+  802330:	5d                   	pop    %ebp
+  802331:	c3                   	ret
+			sys_yield();
+  802332:	e8 16 ea ff ff       	call   800d4d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802337:	8b 03                	mov    (%ebx),%eax
+  802339:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80233c:	75 18                	jne    802356 <devpipe_read+0x53>
+			if (i > 0)
+  80233e:	85 f6                	test   %esi,%esi
+  802340:	75 e6                	jne    802328 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802342:	89 da                	mov    %ebx,%edx
+  802344:	89 f8                	mov    %edi,%eax
+  802346:	e8 d4 fe ff ff       	call   80221f <_pipeisclosed>
+  80234b:	85 c0                	test   %eax,%eax
+  80234d:	74 e3                	je     802332 <devpipe_read+0x2f>
+				return 0;
+  80234f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802354:	eb d4                	jmp    80232a <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802356:	99                   	cltd
+  802357:	c1 ea 1b             	shr    $0x1b,%edx
+  80235a:	01 d0                	add    %edx,%eax
+  80235c:	83 e0 1f             	and    $0x1f,%eax
+  80235f:	29 d0                	sub    %edx,%eax
+  802361:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802366:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802369:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80236c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80236f:	83 c6 01             	add    $0x1,%esi
+  802372:	eb ab                	jmp    80231f <devpipe_read+0x1c>
+
+00802374 <pipe>:
+{
+  802374:	55                   	push   %ebp
+  802375:	89 e5                	mov    %esp,%ebp
+  802377:	56                   	push   %esi
+  802378:	53                   	push   %ebx
+  802379:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80237c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80237f:	50                   	push   %eax
+  802380:	e8 f6 f1 ff ff       	call   80157b <fd_alloc>
+  802385:	89 c3                	mov    %eax,%ebx
+  802387:	83 c4 10             	add    $0x10,%esp
+  80238a:	85 c0                	test   %eax,%eax
+  80238c:	0f 88 23 01 00 00    	js     8024b5 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802392:	83 ec 04             	sub    $0x4,%esp
+  802395:	68 07 04 00 00       	push   $0x407
+  80239a:	ff 75 f4             	push   -0xc(%ebp)
+  80239d:	6a 00                	push   $0x0
+  80239f:	e8 29 ea ff ff       	call   800dcd <sys_page_alloc>
+  8023a4:	89 c3                	mov    %eax,%ebx
+  8023a6:	83 c4 10             	add    $0x10,%esp
+  8023a9:	85 c0                	test   %eax,%eax
+  8023ab:	0f 88 04 01 00 00    	js     8024b5 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8023b1:	83 ec 0c             	sub    $0xc,%esp
+  8023b4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023b7:	50                   	push   %eax
+  8023b8:	e8 be f1 ff ff       	call   80157b <fd_alloc>
+  8023bd:	89 c3                	mov    %eax,%ebx
+  8023bf:	83 c4 10             	add    $0x10,%esp
+  8023c2:	85 c0                	test   %eax,%eax
+  8023c4:	0f 88 db 00 00 00    	js     8024a5 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023ca:	83 ec 04             	sub    $0x4,%esp
+  8023cd:	68 07 04 00 00       	push   $0x407
+  8023d2:	ff 75 f0             	push   -0x10(%ebp)
+  8023d5:	6a 00                	push   $0x0
+  8023d7:	e8 f1 e9 ff ff       	call   800dcd <sys_page_alloc>
+  8023dc:	89 c3                	mov    %eax,%ebx
+  8023de:	83 c4 10             	add    $0x10,%esp
+  8023e1:	85 c0                	test   %eax,%eax
+  8023e3:	0f 88 bc 00 00 00    	js     8024a5 <pipe+0x131>
+	va = fd2data(fd0);
+  8023e9:	83 ec 0c             	sub    $0xc,%esp
+  8023ec:	ff 75 f4             	push   -0xc(%ebp)
+  8023ef:	e8 70 f1 ff ff       	call   801564 <fd2data>
+  8023f4:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023f6:	83 c4 0c             	add    $0xc,%esp
+  8023f9:	68 07 04 00 00       	push   $0x407
+  8023fe:	50                   	push   %eax
+  8023ff:	6a 00                	push   $0x0
+  802401:	e8 c7 e9 ff ff       	call   800dcd <sys_page_alloc>
+  802406:	89 c3                	mov    %eax,%ebx
+  802408:	83 c4 10             	add    $0x10,%esp
+  80240b:	85 c0                	test   %eax,%eax
+  80240d:	0f 88 82 00 00 00    	js     802495 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802413:	83 ec 0c             	sub    $0xc,%esp
+  802416:	ff 75 f0             	push   -0x10(%ebp)
+  802419:	e8 46 f1 ff ff       	call   801564 <fd2data>
+  80241e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802425:	50                   	push   %eax
+  802426:	6a 00                	push   $0x0
+  802428:	56                   	push   %esi
+  802429:	6a 00                	push   $0x0
+  80242b:	e8 23 ea ff ff       	call   800e53 <sys_page_map>
+  802430:	89 c3                	mov    %eax,%ebx
+  802432:	83 c4 20             	add    $0x20,%esp
+  802435:	85 c0                	test   %eax,%eax
+  802437:	78 4e                	js     802487 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802439:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80243e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802441:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802443:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802446:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80244d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802450:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802452:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802455:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80245c:	83 ec 0c             	sub    $0xc,%esp
+  80245f:	ff 75 f4             	push   -0xc(%ebp)
+  802462:	e8 ed f0 ff ff       	call   801554 <fd2num>
+  802467:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80246a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80246c:	83 c4 04             	add    $0x4,%esp
+  80246f:	ff 75 f0             	push   -0x10(%ebp)
+  802472:	e8 dd f0 ff ff       	call   801554 <fd2num>
+  802477:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80247a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80247d:	83 c4 10             	add    $0x10,%esp
+  802480:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802485:	eb 2e                	jmp    8024b5 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802487:	83 ec 08             	sub    $0x8,%esp
+  80248a:	56                   	push   %esi
+  80248b:	6a 00                	push   $0x0
+  80248d:	e8 03 ea ff ff       	call   800e95 <sys_page_unmap>
+  802492:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802495:	83 ec 08             	sub    $0x8,%esp
+  802498:	ff 75 f0             	push   -0x10(%ebp)
+  80249b:	6a 00                	push   $0x0
+  80249d:	e8 f3 e9 ff ff       	call   800e95 <sys_page_unmap>
+  8024a2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8024a5:	83 ec 08             	sub    $0x8,%esp
+  8024a8:	ff 75 f4             	push   -0xc(%ebp)
+  8024ab:	6a 00                	push   $0x0
+  8024ad:	e8 e3 e9 ff ff       	call   800e95 <sys_page_unmap>
+  8024b2:	83 c4 10             	add    $0x10,%esp
+}
+  8024b5:	89 d8                	mov    %ebx,%eax
+  8024b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024ba:	5b                   	pop    %ebx
+  8024bb:	5e                   	pop    %esi
+  8024bc:	5d                   	pop    %ebp
+  8024bd:	c3                   	ret
+
+008024be <pipeisclosed>:
+{
+  8024be:	55                   	push   %ebp
+  8024bf:	89 e5                	mov    %esp,%ebp
+  8024c1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024c7:	50                   	push   %eax
+  8024c8:	ff 75 08             	push   0x8(%ebp)
+  8024cb:	e8 01 f1 ff ff       	call   8015d1 <fd_lookup>
+  8024d0:	83 c4 10             	add    $0x10,%esp
+  8024d3:	85 c0                	test   %eax,%eax
+  8024d5:	78 18                	js     8024ef <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8024d7:	83 ec 0c             	sub    $0xc,%esp
+  8024da:	ff 75 f4             	push   -0xc(%ebp)
+  8024dd:	e8 82 f0 ff ff       	call   801564 <fd2data>
+  8024e2:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8024e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024e7:	e8 33 fd ff ff       	call   80221f <_pipeisclosed>
+  8024ec:	83 c4 10             	add    $0x10,%esp
+}
+  8024ef:	c9                   	leave
+  8024f0:	c3                   	ret
+
+008024f1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8024f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f6:	c3                   	ret
+
+008024f7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024f7:	55                   	push   %ebp
+  8024f8:	89 e5                	mov    %esp,%ebp
+  8024fa:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8024fd:	68 76 32 80 00       	push   $0x803276
+  802502:	ff 75 0c             	push   0xc(%ebp)
+  802505:	e8 56 e4 ff ff       	call   800960 <strcpy>
+	return 0;
+}
+  80250a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250f:	c9                   	leave
+  802510:	c3                   	ret
+
+00802511 <devcons_write>:
+{
+  802511:	55                   	push   %ebp
+  802512:	89 e5                	mov    %esp,%ebp
+  802514:	57                   	push   %edi
+  802515:	56                   	push   %esi
+  802516:	53                   	push   %ebx
+  802517:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80251d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802522:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802528:	eb 2e                	jmp    802558 <devcons_write+0x47>
+		m = n - tot;
+  80252a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80252d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80252f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802534:	39 c3                	cmp    %eax,%ebx
+  802536:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802539:	83 ec 04             	sub    $0x4,%esp
+  80253c:	53                   	push   %ebx
+  80253d:	89 f0                	mov    %esi,%eax
+  80253f:	03 45 0c             	add    0xc(%ebp),%eax
+  802542:	50                   	push   %eax
+  802543:	57                   	push   %edi
+  802544:	e8 9d e5 ff ff       	call   800ae6 <memmove>
+		sys_cputs(buf, m);
+  802549:	83 c4 08             	add    $0x8,%esp
+  80254c:	53                   	push   %ebx
+  80254d:	57                   	push   %edi
+  80254e:	e8 3d e7 ff ff       	call   800c90 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802553:	01 de                	add    %ebx,%esi
+  802555:	83 c4 10             	add    $0x10,%esp
+  802558:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80255b:	72 cd                	jb     80252a <devcons_write+0x19>
+}
+  80255d:	89 f0                	mov    %esi,%eax
+  80255f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802562:	5b                   	pop    %ebx
+  802563:	5e                   	pop    %esi
+  802564:	5f                   	pop    %edi
+  802565:	5d                   	pop    %ebp
+  802566:	c3                   	ret
+
+00802567 <devcons_read>:
+{
+  802567:	55                   	push   %ebp
+  802568:	89 e5                	mov    %esp,%ebp
+  80256a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80256d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802572:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802576:	75 07                	jne    80257f <devcons_read+0x18>
+  802578:	eb 1f                	jmp    802599 <devcons_read+0x32>
+		sys_yield();
+  80257a:	e8 ce e7 ff ff       	call   800d4d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80257f:	e8 2a e7 ff ff       	call   800cae <sys_cgetc>
+  802584:	85 c0                	test   %eax,%eax
+  802586:	74 f2                	je     80257a <devcons_read+0x13>
+	if (c < 0)
+  802588:	78 0f                	js     802599 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80258a:	83 f8 04             	cmp    $0x4,%eax
+  80258d:	74 0c                	je     80259b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80258f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802592:	88 02                	mov    %al,(%edx)
+	return 1;
+  802594:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802599:	c9                   	leave
+  80259a:	c3                   	ret
+		return 0;
+  80259b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a0:	eb f7                	jmp    802599 <devcons_read+0x32>
+
+008025a2 <cputchar>:
+{
+  8025a2:	55                   	push   %ebp
+  8025a3:	89 e5                	mov    %esp,%ebp
+  8025a5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8025a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ab:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8025ae:	6a 01                	push   $0x1
+  8025b0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8025b3:	50                   	push   %eax
+  8025b4:	e8 d7 e6 ff ff       	call   800c90 <sys_cputs>
+}
+  8025b9:	83 c4 10             	add    $0x10,%esp
+  8025bc:	c9                   	leave
+  8025bd:	c3                   	ret
+
+008025be <getchar>:
+{
+  8025be:	55                   	push   %ebp
+  8025bf:	89 e5                	mov    %esp,%ebp
+  8025c1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8025c4:	6a 01                	push   $0x1
+  8025c6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8025c9:	50                   	push   %eax
+  8025ca:	6a 00                	push   $0x0
+  8025cc:	e8 66 f2 ff ff       	call   801837 <read>
+	if (r < 0)
+  8025d1:	83 c4 10             	add    $0x10,%esp
+  8025d4:	85 c0                	test   %eax,%eax
+  8025d6:	78 06                	js     8025de <getchar+0x20>
+	if (r < 1)
+  8025d8:	74 06                	je     8025e0 <getchar+0x22>
+	return c;
+  8025da:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8025de:	c9                   	leave
+  8025df:	c3                   	ret
+		return -E_EOF;
+  8025e0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8025e5:	eb f7                	jmp    8025de <getchar+0x20>
+
+008025e7 <iscons>:
+{
+  8025e7:	55                   	push   %ebp
+  8025e8:	89 e5                	mov    %esp,%ebp
+  8025ea:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025f0:	50                   	push   %eax
+  8025f1:	ff 75 08             	push   0x8(%ebp)
+  8025f4:	e8 d8 ef ff ff       	call   8015d1 <fd_lookup>
+  8025f9:	83 c4 10             	add    $0x10,%esp
+  8025fc:	85 c0                	test   %eax,%eax
+  8025fe:	78 11                	js     802611 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802600:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802603:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802609:	39 10                	cmp    %edx,(%eax)
+  80260b:	0f 94 c0             	sete   %al
+  80260e:	0f b6 c0             	movzbl %al,%eax
+}
+  802611:	c9                   	leave
+  802612:	c3                   	ret
+
+00802613 <opencons>:
+{
+  802613:	55                   	push   %ebp
+  802614:	89 e5                	mov    %esp,%ebp
+  802616:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802619:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80261c:	50                   	push   %eax
+  80261d:	e8 59 ef ff ff       	call   80157b <fd_alloc>
+  802622:	83 c4 10             	add    $0x10,%esp
+  802625:	85 c0                	test   %eax,%eax
+  802627:	78 3a                	js     802663 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802629:	83 ec 04             	sub    $0x4,%esp
+  80262c:	68 07 04 00 00       	push   $0x407
+  802631:	ff 75 f4             	push   -0xc(%ebp)
+  802634:	6a 00                	push   $0x0
+  802636:	e8 92 e7 ff ff       	call   800dcd <sys_page_alloc>
+  80263b:	83 c4 10             	add    $0x10,%esp
+  80263e:	85 c0                	test   %eax,%eax
+  802640:	78 21                	js     802663 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802642:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802645:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80264b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80264d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802650:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802657:	83 ec 0c             	sub    $0xc,%esp
+  80265a:	50                   	push   %eax
+  80265b:	e8 f4 ee ff ff       	call   801554 <fd2num>
+  802660:	83 c4 10             	add    $0x10,%esp
+}
+  802663:	c9                   	leave
+  802664:	c3                   	ret
+
+00802665 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802665:	55                   	push   %ebp
+  802666:	89 e5                	mov    %esp,%ebp
+  802668:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80266b:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802672:	74 0a                	je     80267e <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802674:	8b 45 08             	mov    0x8(%ebp),%eax
+  802677:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  80267c:	c9                   	leave
+  80267d:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  80267e:	83 ec 04             	sub    $0x4,%esp
+  802681:	6a 07                	push   $0x7
+  802683:	68 00 f0 bf ee       	push   $0xeebff000
+  802688:	6a 00                	push   $0x0
+  80268a:	e8 3e e7 ff ff       	call   800dcd <sys_page_alloc>
+  80268f:	83 c4 10             	add    $0x10,%esp
+  802692:	85 c0                	test   %eax,%eax
+  802694:	78 28                	js     8026be <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802696:	83 ec 08             	sub    $0x8,%esp
+  802699:	68 d0 26 80 00       	push   $0x8026d0
+  80269e:	6a 00                	push   $0x0
+  8026a0:	e8 23 ea ff ff       	call   8010c8 <sys_env_set_pgfault_upcall>
+  8026a5:	83 c4 10             	add    $0x10,%esp
+  8026a8:	85 c0                	test   %eax,%eax
+  8026aa:	79 c8                	jns    802674 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  8026ac:	50                   	push   %eax
+  8026ad:	68 90 32 80 00       	push   $0x803290
+  8026b2:	6a 24                	push   $0x24
+  8026b4:	68 82 32 80 00       	push   $0x803282
+  8026b9:	e8 d9 db ff ff       	call   800297 <_panic>
+			panic("sys_page_alloc: %e", r);
+  8026be:	50                   	push   %eax
+  8026bf:	68 86 30 80 00       	push   $0x803086
+  8026c4:	6a 21                	push   $0x21
+  8026c6:	68 82 32 80 00       	push   $0x803282
+  8026cb:	e8 c7 db ff ff       	call   800297 <_panic>
+
+008026d0 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8026d0:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8026d1:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8026d6:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8026d8:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8026db:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  8026de:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  8026e2:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  8026e5:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  8026e9:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  8026ed:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  8026ef:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8026f0:	83 c4 04             	add    $0x4,%esp
+	popf
+  8026f3:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8026f4:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8026f5:	c3                   	ret
+
+008026f6 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8026f6:	55                   	push   %ebp
+  8026f7:	89 e5                	mov    %esp,%ebp
+  8026f9:	57                   	push   %edi
+  8026fa:	56                   	push   %esi
+  8026fb:	53                   	push   %ebx
+  8026fc:	83 ec 18             	sub    $0x18,%esp
+  8026ff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802702:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802705:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802708:	85 db                	test   %ebx,%ebx
+  80270a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80270f:	0f 45 c3             	cmovne %ebx,%eax
+  802712:	50                   	push   %eax
+  802713:	e8 38 ea ff ff       	call   801150 <sys_ipc_recv>
+
+	if (from_env_store)
+  802718:	83 c4 10             	add    $0x10,%esp
+  80271b:	85 ff                	test   %edi,%edi
+  80271d:	74 17                	je     802736 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80271f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802724:	85 c0                	test   %eax,%eax
+  802726:	75 0c                	jne    802734 <ipc_recv+0x3e>
+  802728:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  80272e:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802734:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802736:	85 f6                	test   %esi,%esi
+  802738:	74 2e                	je     802768 <ipc_recv+0x72>
+		if (!r && pg)
+  80273a:	85 c0                	test   %eax,%eax
+  80273c:	75 24                	jne    802762 <ipc_recv+0x6c>
+  80273e:	85 db                	test   %ebx,%ebx
+  802740:	74 20                	je     802762 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802742:	a1 08 50 80 00       	mov    0x805008,%eax
+  802747:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  80274d:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80274f:	a1 08 50 80 00       	mov    0x805008,%eax
+  802754:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80275a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80275d:	5b                   	pop    %ebx
+  80275e:	5e                   	pop    %esi
+  80275f:	5f                   	pop    %edi
+  802760:	5d                   	pop    %ebp
+  802761:	c3                   	ret
+			*perm_store = 0;
+  802762:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	75 ee                	jne    80275a <ipc_recv+0x64>
+  80276c:	eb e1                	jmp    80274f <ipc_recv+0x59>
+
+0080276e <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80276e:	55                   	push   %ebp
+  80276f:	89 e5                	mov    %esp,%ebp
+  802771:	57                   	push   %edi
+  802772:	56                   	push   %esi
+  802773:	53                   	push   %ebx
+  802774:	83 ec 0c             	sub    $0xc,%esp
+  802777:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80277a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80277d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802780:	85 db                	test   %ebx,%ebx
+  802782:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802787:	0f 44 d8             	cmove  %eax,%ebx
+  80278a:	ff 75 14             	push   0x14(%ebp)
+  80278d:	53                   	push   %ebx
+  80278e:	56                   	push   %esi
+  80278f:	57                   	push   %edi
+  802790:	e8 98 e9 ff ff       	call   80112d <sys_ipc_try_send_yield>
+  802795:	83 c4 10             	add    $0x10,%esp
+  802798:	85 c0                	test   %eax,%eax
+  80279a:	79 1e                	jns    8027ba <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80279c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80279f:	75 07                	jne    8027a8 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8027a1:	e8 a7 e5 ff ff       	call   800d4d <sys_yield>
+  8027a6:	eb e2                	jmp    80278a <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8027a8:	50                   	push   %eax
+  8027a9:	68 ae 32 80 00       	push   $0x8032ae
+  8027ae:	6a 3d                	push   $0x3d
+  8027b0:	68 c3 32 80 00       	push   $0x8032c3
+  8027b5:	e8 dd da ff ff       	call   800297 <_panic>
+	}
+}
+  8027ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027bd:	5b                   	pop    %ebx
+  8027be:	5e                   	pop    %esi
+  8027bf:	5f                   	pop    %edi
+  8027c0:	5d                   	pop    %ebp
+  8027c1:	c3                   	ret
+
+008027c2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8027c2:	55                   	push   %ebp
+  8027c3:	89 e5                	mov    %esp,%ebp
+  8027c5:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8027c8:	ff 75 08             	push   0x8(%ebp)
+  8027cb:	e8 fd e4 ff ff       	call   800ccd <sys_env_find>
+}
+  8027d0:	c9                   	leave
+  8027d1:	c3                   	ret
+
+008027d2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8027d2:	55                   	push   %ebp
+  8027d3:	89 e5                	mov    %esp,%ebp
+  8027d5:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8027d8:	89 c2                	mov    %eax,%edx
+  8027da:	c1 ea 16             	shr    $0x16,%edx
+  8027dd:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8027e4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8027e9:	f6 c1 01             	test   $0x1,%cl
+  8027ec:	74 22                	je     802810 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8027ee:	c1 e8 0c             	shr    $0xc,%eax
+  8027f1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8027f8:	a8 01                	test   $0x1,%al
+  8027fa:	74 14                	je     802810 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8027fc:	c1 e8 0c             	shr    $0xc,%eax
+  8027ff:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802802:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802809:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80280d:	0f b7 d2             	movzwl %dx,%edx
+}
+  802810:	89 d0                	mov    %edx,%eax
+  802812:	5d                   	pop    %ebp
+  802813:	c3                   	ret
+  802814:	66 90                	xchg   %ax,%ax
+  802816:	66 90                	xchg   %ax,%ax
+  802818:	66 90                	xchg   %ax,%ax
+  80281a:	66 90                	xchg   %ax,%ax
+  80281c:	66 90                	xchg   %ax,%ax
+  80281e:	66 90                	xchg   %ax,%ax
+
+00802820 <__udivmoddi4>:
+  802820:	55                   	push   %ebp
+  802821:	57                   	push   %edi
+  802822:	56                   	push   %esi
+  802823:	53                   	push   %ebx
+  802824:	83 ec 14             	sub    $0x14,%esp
+  802827:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80282b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80282f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802833:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802837:	89 f1                	mov    %esi,%ecx
+  802839:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80283d:	09 d9                	or     %ebx,%ecx
+  80283f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802843:	0f 84 92 00 00 00    	je     8028db <__udivmoddi4+0xbb>
+  802849:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802850:	00 
+  802851:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802856:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80285d:	00 
+  80285e:	89 1c 24             	mov    %ebx,(%esp)
+  802861:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802865:	8d 76 00             	lea    0x0(%esi),%esi
+  802868:	89 e9                	mov    %ebp,%ecx
+  80286a:	89 c3                	mov    %eax,%ebx
+  80286c:	89 d6                	mov    %edx,%esi
+  80286e:	31 ff                	xor    %edi,%edi
+  802870:	d3 ee                	shr    %cl,%esi
+  802872:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802875:	f6 c1 20             	test   $0x20,%cl
+  802878:	0f 45 de             	cmovne %esi,%ebx
+  80287b:	0f 45 f7             	cmovne %edi,%esi
+  80287e:	8b 3c 24             	mov    (%esp),%edi
+  802881:	39 fb                	cmp    %edi,%ebx
+  802883:	89 f7                	mov    %esi,%edi
+  802885:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802889:	8b 1c 24             	mov    (%esp),%ebx
+  80288c:	19 f7                	sbb    %esi,%edi
+  80288e:	72 39                	jb     8028c9 <__udivmoddi4+0xa9>
+  802890:	89 e9                	mov    %ebp,%ecx
+  802892:	89 f7                	mov    %esi,%edi
+  802894:	89 de                	mov    %ebx,%esi
+  802896:	0f a5 df             	shld   %cl,%ebx,%edi
+  802899:	d3 e6                	shl    %cl,%esi
+  80289b:	31 db                	xor    %ebx,%ebx
+  80289d:	f6 c1 20             	test   $0x20,%cl
+  8028a0:	0f 45 fe             	cmovne %esi,%edi
+  8028a3:	0f 45 f3             	cmovne %ebx,%esi
+  8028a6:	29 f0                	sub    %esi,%eax
+  8028a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8028ad:	19 fa                	sbb    %edi,%edx
+  8028af:	31 ff                	xor    %edi,%edi
+  8028b1:	31 db                	xor    %ebx,%ebx
+  8028b3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8028b6:	d3 e6                	shl    %cl,%esi
+  8028b8:	f6 c1 20             	test   $0x20,%cl
+  8028bb:	0f 45 fe             	cmovne %esi,%edi
+  8028be:	0f 45 f3             	cmovne %ebx,%esi
+  8028c1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8028c5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8028c9:	83 ed 01             	sub    $0x1,%ebp
+  8028cc:	73 9a                	jae    802868 <__udivmoddi4+0x48>
+  8028ce:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8028d2:	85 ff                	test   %edi,%edi
+  8028d4:	74 05                	je     8028db <__udivmoddi4+0xbb>
+  8028d6:	89 07                	mov    %eax,(%edi)
+  8028d8:	89 57 04             	mov    %edx,0x4(%edi)
+  8028db:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028df:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028e3:	83 c4 14             	add    $0x14,%esp
+  8028e6:	5b                   	pop    %ebx
+  8028e7:	5e                   	pop    %esi
+  8028e8:	5f                   	pop    %edi
+  8028e9:	5d                   	pop    %ebp
+  8028ea:	c3                   	ret
+  8028eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8028ef:	90                   	nop
+
+008028f0 <__udivdi3>:
+  8028f0:	55                   	push   %ebp
+  8028f1:	57                   	push   %edi
+  8028f2:	56                   	push   %esi
+  8028f3:	53                   	push   %ebx
+  8028f4:	83 ec 14             	sub    $0x14,%esp
+  8028f7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8028fb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8028ff:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802903:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802907:	89 fb                	mov    %edi,%ebx
+  802909:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80290d:	09 f3                	or     %esi,%ebx
+  80290f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802913:	0f 84 85 00 00 00    	je     80299e <__udivdi3+0xae>
+  802919:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802920:	00 
+  802921:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802926:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80292d:	00 
+  80292e:	89 34 24             	mov    %esi,(%esp)
+  802931:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802935:	8d 76 00             	lea    0x0(%esi),%esi
+  802938:	89 e9                	mov    %ebp,%ecx
+  80293a:	89 c3                	mov    %eax,%ebx
+  80293c:	89 d6                	mov    %edx,%esi
+  80293e:	31 ff                	xor    %edi,%edi
+  802940:	d3 ee                	shr    %cl,%esi
+  802942:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802945:	f6 c1 20             	test   $0x20,%cl
+  802948:	0f 45 de             	cmovne %esi,%ebx
+  80294b:	0f 45 f7             	cmovne %edi,%esi
+  80294e:	8b 3c 24             	mov    (%esp),%edi
+  802951:	39 fb                	cmp    %edi,%ebx
+  802953:	89 f7                	mov    %esi,%edi
+  802955:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802959:	8b 1c 24             	mov    (%esp),%ebx
+  80295c:	19 f7                	sbb    %esi,%edi
+  80295e:	72 39                	jb     802999 <__udivdi3+0xa9>
+  802960:	89 e9                	mov    %ebp,%ecx
+  802962:	89 f7                	mov    %esi,%edi
+  802964:	89 de                	mov    %ebx,%esi
+  802966:	0f a5 df             	shld   %cl,%ebx,%edi
+  802969:	d3 e6                	shl    %cl,%esi
+  80296b:	31 db                	xor    %ebx,%ebx
+  80296d:	f6 c1 20             	test   $0x20,%cl
+  802970:	0f 45 fe             	cmovne %esi,%edi
+  802973:	0f 45 f3             	cmovne %ebx,%esi
+  802976:	29 f0                	sub    %esi,%eax
+  802978:	be 01 00 00 00       	mov    $0x1,%esi
+  80297d:	19 fa                	sbb    %edi,%edx
+  80297f:	31 ff                	xor    %edi,%edi
+  802981:	31 db                	xor    %ebx,%ebx
+  802983:	0f a5 f7             	shld   %cl,%esi,%edi
+  802986:	d3 e6                	shl    %cl,%esi
+  802988:	f6 c1 20             	test   $0x20,%cl
+  80298b:	0f 45 fe             	cmovne %esi,%edi
+  80298e:	0f 45 f3             	cmovne %ebx,%esi
+  802991:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802995:	09 74 24 08          	or     %esi,0x8(%esp)
+  802999:	83 ed 01             	sub    $0x1,%ebp
+  80299c:	73 9a                	jae    802938 <__udivdi3+0x48>
+  80299e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029a2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029a6:	83 c4 14             	add    $0x14,%esp
+  8029a9:	5b                   	pop    %ebx
+  8029aa:	5e                   	pop    %esi
+  8029ab:	5f                   	pop    %edi
+  8029ac:	5d                   	pop    %ebp
+  8029ad:	c3                   	ret
+  8029ae:	66 90                	xchg   %ax,%ax
+
+008029b0 <__umoddi3>:
+  8029b0:	57                   	push   %edi
+  8029b1:	56                   	push   %esi
+  8029b2:	53                   	push   %ebx
+  8029b3:	83 ec 08             	sub    $0x8,%esp
+  8029b6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8029ba:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8029be:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8029c2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8029c6:	89 f9                	mov    %edi,%ecx
+  8029c8:	89 34 24             	mov    %esi,(%esp)
+  8029cb:	09 f1                	or     %esi,%ecx
+  8029cd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8029d1:	74 53                	je     802a26 <__umoddi3+0x76>
+  8029d3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8029d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029df:	90                   	nop
+  8029e0:	89 c6                	mov    %eax,%esi
+  8029e2:	89 d7                	mov    %edx,%edi
+  8029e4:	31 db                	xor    %ebx,%ebx
+  8029e6:	d3 ef                	shr    %cl,%edi
+  8029e8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8029eb:	f6 c1 20             	test   $0x20,%cl
+  8029ee:	0f 45 f7             	cmovne %edi,%esi
+  8029f1:	0f 45 fb             	cmovne %ebx,%edi
+  8029f4:	8b 1c 24             	mov    (%esp),%ebx
+  8029f7:	39 de                	cmp    %ebx,%esi
+  8029f9:	89 fb                	mov    %edi,%ebx
+  8029fb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8029ff:	8b 34 24             	mov    (%esp),%esi
+  802a02:	19 fb                	sbb    %edi,%ebx
+  802a04:	72 14                	jb     802a1a <__umoddi3+0x6a>
+  802a06:	0f a5 f7             	shld   %cl,%esi,%edi
+  802a09:	31 db                	xor    %ebx,%ebx
+  802a0b:	d3 e6                	shl    %cl,%esi
+  802a0d:	f6 c1 20             	test   $0x20,%cl
+  802a10:	0f 45 fe             	cmovne %esi,%edi
+  802a13:	0f 45 f3             	cmovne %ebx,%esi
+  802a16:	29 f0                	sub    %esi,%eax
+  802a18:	19 fa                	sbb    %edi,%edx
+  802a1a:	83 e9 01             	sub    $0x1,%ecx
+  802a1d:	73 c1                	jae    8029e0 <__umoddi3+0x30>
+  802a1f:	83 c4 08             	add    $0x8,%esp
+  802a22:	5b                   	pop    %ebx
+  802a23:	5e                   	pop    %esi
+  802a24:	5f                   	pop    %edi
+  802a25:	c3                   	ret
+  802a26:	83 c4 08             	add    $0x8,%esp
+  802a29:	31 c0                	xor    %eax,%eax
+  802a2b:	31 d2                	xor    %edx,%edx
+  802a2d:	5b                   	pop    %ebx
+  802a2e:	5e                   	pop    %esi
+  802a2f:	5f                   	pop    %edi
+  802a30:	c3                   	ret
+  802a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a3f:	90                   	nop
+
+00802a40 <__divdi3>:
+  802a40:	55                   	push   %ebp
+  802a41:	57                   	push   %edi
+  802a42:	56                   	push   %esi
+  802a43:	53                   	push   %ebx
+  802a44:	83 ec 1c             	sub    $0x1c,%esp
+  802a47:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802a4b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802a4f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802a53:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802a57:	85 ff                	test   %edi,%edi
+  802a59:	0f 88 da 00 00 00    	js     802b39 <__divdi3+0xf9>
+  802a5f:	85 db                	test   %ebx,%ebx
+  802a61:	78 16                	js     802a79 <__divdi3+0x39>
+  802a63:	89 dd                	mov    %ebx,%ebp
+  802a65:	89 c8                	mov    %ecx,%eax
+  802a67:	89 da                	mov    %ebx,%edx
+  802a69:	09 cd                	or     %ecx,%ebp
+  802a6b:	0f 85 fd 00 00 00    	jne    802b6e <__divdi3+0x12e>
+  802a71:	83 c4 1c             	add    $0x1c,%esp
+  802a74:	5b                   	pop    %ebx
+  802a75:	5e                   	pop    %esi
+  802a76:	5f                   	pop    %edi
+  802a77:	5d                   	pop    %ebp
+  802a78:	c3                   	ret
+  802a79:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802a7e:	f7 d9                	neg    %ecx
+  802a80:	89 f0                	mov    %esi,%eax
+  802a82:	89 fa                	mov    %edi,%edx
+  802a84:	83 d3 00             	adc    $0x0,%ebx
+  802a87:	89 0c 24             	mov    %ecx,(%esp)
+  802a8a:	f7 db                	neg    %ebx
+  802a8c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a90:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802a97:	00 
+  802a98:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a9d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802aa4:	00 
+  802aa5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802aa9:	89 cd                	mov    %ecx,%ebp
+  802aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802aaf:	90                   	nop
+  802ab0:	89 e9                	mov    %ebp,%ecx
+  802ab2:	89 c3                	mov    %eax,%ebx
+  802ab4:	89 d6                	mov    %edx,%esi
+  802ab6:	31 ff                	xor    %edi,%edi
+  802ab8:	d3 ee                	shr    %cl,%esi
+  802aba:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802abd:	f6 c1 20             	test   $0x20,%cl
+  802ac0:	0f 45 de             	cmovne %esi,%ebx
+  802ac3:	0f 45 f7             	cmovne %edi,%esi
+  802ac6:	8b 3c 24             	mov    (%esp),%edi
+  802ac9:	39 fb                	cmp    %edi,%ebx
+  802acb:	89 f7                	mov    %esi,%edi
+  802acd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ad1:	8b 1c 24             	mov    (%esp),%ebx
+  802ad4:	19 f7                	sbb    %esi,%edi
+  802ad6:	72 39                	jb     802b11 <__divdi3+0xd1>
+  802ad8:	89 e9                	mov    %ebp,%ecx
+  802ada:	89 f7                	mov    %esi,%edi
+  802adc:	89 de                	mov    %ebx,%esi
+  802ade:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ae1:	d3 e6                	shl    %cl,%esi
+  802ae3:	31 db                	xor    %ebx,%ebx
+  802ae5:	f6 c1 20             	test   $0x20,%cl
+  802ae8:	0f 45 fe             	cmovne %esi,%edi
+  802aeb:	0f 45 f3             	cmovne %ebx,%esi
+  802aee:	29 f0                	sub    %esi,%eax
+  802af0:	be 01 00 00 00       	mov    $0x1,%esi
+  802af5:	19 fa                	sbb    %edi,%edx
+  802af7:	31 ff                	xor    %edi,%edi
+  802af9:	31 db                	xor    %ebx,%ebx
+  802afb:	0f a5 f7             	shld   %cl,%esi,%edi
+  802afe:	d3 e6                	shl    %cl,%esi
+  802b00:	f6 c1 20             	test   $0x20,%cl
+  802b03:	0f 45 fe             	cmovne %esi,%edi
+  802b06:	0f 45 f3             	cmovne %ebx,%esi
+  802b09:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802b0d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802b11:	83 ed 01             	sub    $0x1,%ebp
+  802b14:	73 9a                	jae    802ab0 <__divdi3+0x70>
+  802b16:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802b1a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b1e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b22:	85 ed                	test   %ebp,%ebp
+  802b24:	0f 84 47 ff ff ff    	je     802a71 <__divdi3+0x31>
+  802b2a:	f7 d8                	neg    %eax
+  802b2c:	83 d2 00             	adc    $0x0,%edx
+  802b2f:	83 c4 1c             	add    $0x1c,%esp
+  802b32:	5b                   	pop    %ebx
+  802b33:	f7 da                	neg    %edx
+  802b35:	5e                   	pop    %esi
+  802b36:	5f                   	pop    %edi
+  802b37:	5d                   	pop    %ebp
+  802b38:	c3                   	ret
+  802b39:	f7 de                	neg    %esi
+  802b3b:	83 d7 00             	adc    $0x0,%edi
+  802b3e:	f7 df                	neg    %edi
+  802b40:	85 db                	test   %ebx,%ebx
+  802b42:	78 23                	js     802b67 <__divdi3+0x127>
+  802b44:	89 dd                	mov    %ebx,%ebp
+  802b46:	89 c8                	mov    %ecx,%eax
+  802b48:	89 da                	mov    %ebx,%edx
+  802b4a:	09 cd                	or     %ecx,%ebp
+  802b4c:	0f 84 1f ff ff ff    	je     802a71 <__divdi3+0x31>
+  802b52:	89 0c 24             	mov    %ecx,(%esp)
+  802b55:	89 f0                	mov    %esi,%eax
+  802b57:	89 fa                	mov    %edi,%edx
+  802b59:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802b5e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802b62:	e9 29 ff ff ff       	jmp    802a90 <__divdi3+0x50>
+  802b67:	31 ed                	xor    %ebp,%ebp
+  802b69:	e9 10 ff ff ff       	jmp    802a7e <__divdi3+0x3e>
+  802b6e:	89 0c 24             	mov    %ecx,(%esp)
+  802b71:	89 f0                	mov    %esi,%eax
+  802b73:	89 fa                	mov    %edi,%edx
+  802b75:	31 ed                	xor    %ebp,%ebp
+  802b77:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802b7b:	e9 10 ff ff ff       	jmp    802a90 <__divdi3+0x50>
+
+00802b80 <__moddi3>:
+  802b80:	55                   	push   %ebp
+  802b81:	57                   	push   %edi
+  802b82:	56                   	push   %esi
+  802b83:	53                   	push   %ebx
+  802b84:	83 ec 14             	sub    $0x14,%esp
+  802b87:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802b8b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802b8f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802b93:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802b97:	85 d2                	test   %edx,%edx
+  802b99:	0f 88 9b 00 00 00    	js     802c3a <__moddi3+0xba>
+  802b9f:	89 f7                	mov    %esi,%edi
+  802ba1:	31 ed                	xor    %ebp,%ebp
+  802ba3:	09 cf                	or     %ecx,%edi
+  802ba5:	0f 84 83 00 00 00    	je     802c2e <__moddi3+0xae>
+  802bab:	89 cb                	mov    %ecx,%ebx
+  802bad:	89 f7                	mov    %esi,%edi
+  802baf:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802bb3:	f7 db                	neg    %ebx
+  802bb5:	83 d7 00             	adc    $0x0,%edi
+  802bb8:	f7 df                	neg    %edi
+  802bba:	0f 49 f7             	cmovns %edi,%esi
+  802bbd:	0f 49 cb             	cmovns %ebx,%ecx
+  802bc0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802bc4:	89 0c 24             	mov    %ecx,(%esp)
+  802bc7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802bcc:	89 cd                	mov    %ecx,%ebp
+  802bce:	66 90                	xchg   %ax,%ax
+  802bd0:	89 e9                	mov    %ebp,%ecx
+  802bd2:	89 c3                	mov    %eax,%ebx
+  802bd4:	89 d6                	mov    %edx,%esi
+  802bd6:	31 ff                	xor    %edi,%edi
+  802bd8:	d3 ee                	shr    %cl,%esi
+  802bda:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802bdd:	f6 c1 20             	test   $0x20,%cl
+  802be0:	0f 45 de             	cmovne %esi,%ebx
+  802be3:	0f 45 f7             	cmovne %edi,%esi
+  802be6:	8b 3c 24             	mov    (%esp),%edi
+  802be9:	39 fb                	cmp    %edi,%ebx
+  802beb:	89 f7                	mov    %esi,%edi
+  802bed:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802bf1:	8b 1c 24             	mov    (%esp),%ebx
+  802bf4:	19 f7                	sbb    %esi,%edi
+  802bf6:	72 1a                	jb     802c12 <__moddi3+0x92>
+  802bf8:	89 e9                	mov    %ebp,%ecx
+  802bfa:	89 f7                	mov    %esi,%edi
+  802bfc:	89 de                	mov    %ebx,%esi
+  802bfe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802c01:	d3 e6                	shl    %cl,%esi
+  802c03:	31 db                	xor    %ebx,%ebx
+  802c05:	f6 c1 20             	test   $0x20,%cl
+  802c08:	0f 45 fe             	cmovne %esi,%edi
+  802c0b:	0f 45 f3             	cmovne %ebx,%esi
+  802c0e:	29 f0                	sub    %esi,%eax
+  802c10:	19 fa                	sbb    %edi,%edx
+  802c12:	83 ed 01             	sub    $0x1,%ebp
+  802c15:	73 b9                	jae    802bd0 <__moddi3+0x50>
+  802c17:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802c1b:	85 ed                	test   %ebp,%ebp
+  802c1d:	74 07                	je     802c26 <__moddi3+0xa6>
+  802c1f:	f7 d8                	neg    %eax
+  802c21:	83 d2 00             	adc    $0x0,%edx
+  802c24:	f7 da                	neg    %edx
+  802c26:	83 c4 14             	add    $0x14,%esp
+  802c29:	5b                   	pop    %ebx
+  802c2a:	5e                   	pop    %esi
+  802c2b:	5f                   	pop    %edi
+  802c2c:	5d                   	pop    %ebp
+  802c2d:	c3                   	ret
+  802c2e:	83 c4 14             	add    $0x14,%esp
+  802c31:	31 c0                	xor    %eax,%eax
+  802c33:	31 d2                	xor    %edx,%edx
+  802c35:	5b                   	pop    %ebx
+  802c36:	5e                   	pop    %esi
+  802c37:	5f                   	pop    %edi
+  802c38:	5d                   	pop    %ebp
+  802c39:	c3                   	ret
+  802c3a:	89 f7                	mov    %esi,%edi
+  802c3c:	09 cf                	or     %ecx,%edi
+  802c3e:	74 11                	je     802c51 <__moddi3+0xd1>
+  802c40:	f7 d8                	neg    %eax
+  802c42:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802c47:	83 d2 00             	adc    $0x0,%edx
+  802c4a:	f7 da                	neg    %edx
+  802c4c:	e9 5a ff ff ff       	jmp    802bab <__moddi3+0x2b>
+  802c51:	31 c0                	xor    %eax,%eax
+  802c53:	31 d2                	xor    %edx,%edx
+  802c55:	eb c8                	jmp    802c1f <__moddi3+0x9f>
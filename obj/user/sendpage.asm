@@ -0,0 +1,6185 @@
+
+obj/user/sendpage.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 73 01 00 00       	call   8001a4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define TEMP_ADDR	((char*)0xa00000)
+#define TEMP_ADDR_CHILD	((char*)0xb00000)
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 18             	sub    $0x18,%esp
+	envid_t who;
+
+	if ((who = fork()) == 0) {
+  800039:	e8 b6 11 00 00       	call   8011f4 <fork>
+  80003e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800041:	85 c0                	test   %eax,%eax
+  800043:	0f 84 a5 00 00 00    	je     8000ee <umain+0xbb>
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+		return;
+	}
+
+	// Parent
+	sys_page_alloc(thisenv->env_id, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800049:	a1 08 50 80 00       	mov    0x805008,%eax
+  80004e:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800051:	83 ec 04             	sub    $0x4,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 a0 00       	push   $0xa00000
+  80005b:	50                   	push   %eax
+  80005c:	e8 93 0c 00 00       	call   800cf4 <sys_page_alloc>
+	memcpy(TEMP_ADDR, str1, strlen(str1) + 1);
+  800061:	83 c4 04             	add    $0x4,%esp
+  800064:	ff 35 04 40 80 00    	push   0x804004
+  80006a:	e8 dd 07 00 00       	call   80084c <strlen>
+  80006f:	83 c4 0c             	add    $0xc,%esp
+  800072:	83 c0 01             	add    $0x1,%eax
+  800075:	50                   	push   %eax
+  800076:	ff 35 04 40 80 00    	push   0x804004
+  80007c:	68 00 00 a0 00       	push   $0xa00000
+  800081:	e8 e9 09 00 00       	call   800a6f <memcpy>
+	ipc_send(who, 0, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800086:	6a 07                	push   $0x7
+  800088:	68 00 00 a0 00       	push   $0xa00000
+  80008d:	6a 00                	push   $0x0
+  80008f:	ff 75 f4             	push   -0xc(%ebp)
+  800092:	e8 5c 14 00 00       	call   8014f3 <ipc_send>
+
+	ipc_recv(&who, TEMP_ADDR, 0);
+  800097:	83 c4 1c             	add    $0x1c,%esp
+  80009a:	6a 00                	push   $0x0
+  80009c:	68 00 00 a0 00       	push   $0xa00000
+  8000a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a4:	50                   	push   %eax
+  8000a5:	e8 d1 13 00 00       	call   80147b <ipc_recv>
+	cprintf("%x got message: %s\n", who, TEMP_ADDR);
+  8000aa:	83 c4 0c             	add    $0xc,%esp
+  8000ad:	68 00 00 a0 00       	push   $0xa00000
+  8000b2:	ff 75 f4             	push   -0xc(%ebp)
+  8000b5:	68 e0 2b 80 00       	push   $0x802be0
+  8000ba:	e8 da 01 00 00       	call   800299 <cprintf>
+	if (strncmp(TEMP_ADDR, str2, strlen(str2)) == 0)
+  8000bf:	83 c4 04             	add    $0x4,%esp
+  8000c2:	ff 35 00 40 80 00    	push   0x804000
+  8000c8:	e8 7f 07 00 00       	call   80084c <strlen>
+  8000cd:	83 c4 0c             	add    $0xc,%esp
+  8000d0:	50                   	push   %eax
+  8000d1:	ff 35 00 40 80 00    	push   0x804000
+  8000d7:	68 00 00 a0 00       	push   $0xa00000
+  8000dc:	e8 7d 08 00 00       	call   80095e <strncmp>
+  8000e1:	83 c4 10             	add    $0x10,%esp
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	0f 84 a3 00 00 00    	je     80018f <umain+0x15c>
+		cprintf("parent received correct message\n");
+	return;
+}
+  8000ec:	c9                   	leave
+  8000ed:	c3                   	ret
+		ipc_recv(&who, TEMP_ADDR_CHILD, 0);
+  8000ee:	83 ec 04             	sub    $0x4,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	68 00 00 b0 00       	push   $0xb00000
+  8000f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000fb:	50                   	push   %eax
+  8000fc:	e8 7a 13 00 00       	call   80147b <ipc_recv>
+		cprintf("%x got message: %s\n", who, TEMP_ADDR_CHILD);
+  800101:	83 c4 0c             	add    $0xc,%esp
+  800104:	68 00 00 b0 00       	push   $0xb00000
+  800109:	ff 75 f4             	push   -0xc(%ebp)
+  80010c:	68 e0 2b 80 00       	push   $0x802be0
+  800111:	e8 83 01 00 00       	call   800299 <cprintf>
+		if (strncmp(TEMP_ADDR_CHILD, str1, strlen(str1)) == 0)
+  800116:	83 c4 04             	add    $0x4,%esp
+  800119:	ff 35 04 40 80 00    	push   0x804004
+  80011f:	e8 28 07 00 00       	call   80084c <strlen>
+  800124:	83 c4 0c             	add    $0xc,%esp
+  800127:	50                   	push   %eax
+  800128:	ff 35 04 40 80 00    	push   0x804004
+  80012e:	68 00 00 b0 00       	push   $0xb00000
+  800133:	e8 26 08 00 00       	call   80095e <strncmp>
+  800138:	83 c4 10             	add    $0x10,%esp
+  80013b:	85 c0                	test   %eax,%eax
+  80013d:	74 3e                	je     80017d <umain+0x14a>
+		memcpy(TEMP_ADDR_CHILD, str2, strlen(str2) + 1);
+  80013f:	83 ec 0c             	sub    $0xc,%esp
+  800142:	ff 35 00 40 80 00    	push   0x804000
+  800148:	e8 ff 06 00 00       	call   80084c <strlen>
+  80014d:	83 c4 0c             	add    $0xc,%esp
+  800150:	83 c0 01             	add    $0x1,%eax
+  800153:	50                   	push   %eax
+  800154:	ff 35 00 40 80 00    	push   0x804000
+  80015a:	68 00 00 b0 00       	push   $0xb00000
+  80015f:	e8 0b 09 00 00       	call   800a6f <memcpy>
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+  800164:	6a 07                	push   $0x7
+  800166:	68 00 00 b0 00       	push   $0xb00000
+  80016b:	6a 00                	push   $0x0
+  80016d:	ff 75 f4             	push   -0xc(%ebp)
+  800170:	e8 7e 13 00 00       	call   8014f3 <ipc_send>
+		return;
+  800175:	83 c4 20             	add    $0x20,%esp
+  800178:	e9 6f ff ff ff       	jmp    8000ec <umain+0xb9>
+			cprintf("child received correct message\n");
+  80017d:	83 ec 0c             	sub    $0xc,%esp
+  800180:	68 f4 2b 80 00       	push   $0x802bf4
+  800185:	e8 0f 01 00 00       	call   800299 <cprintf>
+  80018a:	83 c4 10             	add    $0x10,%esp
+  80018d:	eb b0                	jmp    80013f <umain+0x10c>
+		cprintf("parent received correct message\n");
+  80018f:	83 ec 0c             	sub    $0xc,%esp
+  800192:	68 14 2c 80 00       	push   $0x802c14
+  800197:	e8 fd 00 00 00       	call   800299 <cprintf>
+  80019c:	83 c4 10             	add    $0x10,%esp
+  80019f:	e9 48 ff ff ff       	jmp    8000ec <umain+0xb9>
+
+008001a4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	56                   	push   %esi
+  8001a8:	53                   	push   %ebx
+  8001a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001af:	e8 a1 0a 00 00       	call   800c55 <sys_getenvid>
+  8001b4:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8001b9:	c1 e0 09             	shl    $0x9,%eax
+  8001bc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001c1:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001c6:	85 db                	test   %ebx,%ebx
+  8001c8:	7e 07                	jle    8001d1 <libmain+0x2d>
+		binaryname = argv[0];
+  8001ca:	8b 06                	mov    (%esi),%eax
+  8001cc:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// call user main routine
+	umain(argc, argv);
+  8001d1:	83 ec 08             	sub    $0x8,%esp
+  8001d4:	56                   	push   %esi
+  8001d5:	53                   	push   %ebx
+  8001d6:	e8 58 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001db:	e8 0a 00 00 00       	call   8001ea <exit>
+}
+  8001e0:	83 c4 10             	add    $0x10,%esp
+  8001e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001e6:	5b                   	pop    %ebx
+  8001e7:	5e                   	pop    %esi
+  8001e8:	5d                   	pop    %ebp
+  8001e9:	c3                   	ret
+
+008001ea <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001ea:	55                   	push   %ebp
+  8001eb:	89 e5                	mov    %esp,%ebp
+  8001ed:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001f0:	e8 36 15 00 00       	call   80172b <close_all>
+	sys_env_destroy(0);
+  8001f5:	83 ec 0c             	sub    $0xc,%esp
+  8001f8:	6a 00                	push   $0x0
+  8001fa:	e8 15 0a 00 00       	call   800c14 <sys_env_destroy>
+}
+  8001ff:	83 c4 10             	add    $0x10,%esp
+  800202:	c9                   	leave
+  800203:	c3                   	ret
+
+00800204 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800204:	55                   	push   %ebp
+  800205:	89 e5                	mov    %esp,%ebp
+  800207:	53                   	push   %ebx
+  800208:	83 ec 04             	sub    $0x4,%esp
+  80020b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80020e:	8b 13                	mov    (%ebx),%edx
+  800210:	8d 42 01             	lea    0x1(%edx),%eax
+  800213:	89 03                	mov    %eax,(%ebx)
+  800215:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800218:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80021c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800221:	74 09                	je     80022c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800223:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800227:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80022a:	c9                   	leave
+  80022b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80022c:	83 ec 08             	sub    $0x8,%esp
+  80022f:	68 ff 00 00 00       	push   $0xff
+  800234:	8d 43 08             	lea    0x8(%ebx),%eax
+  800237:	50                   	push   %eax
+  800238:	e8 7a 09 00 00       	call   800bb7 <sys_cputs>
+		b->idx = 0;
+  80023d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800243:	83 c4 10             	add    $0x10,%esp
+  800246:	eb db                	jmp    800223 <putch+0x1f>
+
+00800248 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800248:	55                   	push   %ebp
+  800249:	89 e5                	mov    %esp,%ebp
+  80024b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800251:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800258:	00 00 00 
+	b.cnt = 0;
+  80025b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800262:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800265:	ff 75 0c             	push   0xc(%ebp)
+  800268:	ff 75 08             	push   0x8(%ebp)
+  80026b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800271:	50                   	push   %eax
+  800272:	68 04 02 80 00       	push   $0x800204
+  800277:	e8 14 01 00 00       	call   800390 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80027c:	83 c4 08             	add    $0x8,%esp
+  80027f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800285:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80028b:	50                   	push   %eax
+  80028c:	e8 26 09 00 00       	call   800bb7 <sys_cputs>
+
+	return b.cnt;
+}
+  800291:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800297:	c9                   	leave
+  800298:	c3                   	ret
+
+00800299 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800299:	55                   	push   %ebp
+  80029a:	89 e5                	mov    %esp,%ebp
+  80029c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80029f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002a2:	50                   	push   %eax
+  8002a3:	ff 75 08             	push   0x8(%ebp)
+  8002a6:	e8 9d ff ff ff       	call   800248 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002ab:	c9                   	leave
+  8002ac:	c3                   	ret
+
+008002ad <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002ad:	55                   	push   %ebp
+  8002ae:	89 e5                	mov    %esp,%ebp
+  8002b0:	57                   	push   %edi
+  8002b1:	56                   	push   %esi
+  8002b2:	53                   	push   %ebx
+  8002b3:	83 ec 1c             	sub    $0x1c,%esp
+  8002b6:	89 c7                	mov    %eax,%edi
+  8002b8:	89 d6                	mov    %edx,%esi
+  8002ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002c0:	89 d1                	mov    %edx,%ecx
+  8002c2:	89 c2                	mov    %eax,%edx
+  8002c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002c7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002cd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002da:	39 c2                	cmp    %eax,%edx
+  8002dc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002df:	72 3e                	jb     80031f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002e1:	83 ec 0c             	sub    $0xc,%esp
+  8002e4:	ff 75 18             	push   0x18(%ebp)
+  8002e7:	83 eb 01             	sub    $0x1,%ebx
+  8002ea:	53                   	push   %ebx
+  8002eb:	50                   	push   %eax
+  8002ec:	83 ec 08             	sub    $0x8,%esp
+  8002ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f2:	ff 75 e0             	push   -0x20(%ebp)
+  8002f5:	ff 75 dc             	push   -0x24(%ebp)
+  8002f8:	ff 75 d8             	push   -0x28(%ebp)
+  8002fb:	e8 60 25 00 00       	call   802860 <__udivdi3>
+  800300:	83 c4 18             	add    $0x18,%esp
+  800303:	52                   	push   %edx
+  800304:	50                   	push   %eax
+  800305:	89 f2                	mov    %esi,%edx
+  800307:	89 f8                	mov    %edi,%eax
+  800309:	e8 9f ff ff ff       	call   8002ad <printnum>
+  80030e:	83 c4 20             	add    $0x20,%esp
+  800311:	eb 13                	jmp    800326 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800313:	83 ec 08             	sub    $0x8,%esp
+  800316:	56                   	push   %esi
+  800317:	ff 75 18             	push   0x18(%ebp)
+  80031a:	ff d7                	call   *%edi
+  80031c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80031f:	83 eb 01             	sub    $0x1,%ebx
+  800322:	85 db                	test   %ebx,%ebx
+  800324:	7f ed                	jg     800313 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800326:	83 ec 08             	sub    $0x8,%esp
+  800329:	56                   	push   %esi
+  80032a:	83 ec 04             	sub    $0x4,%esp
+  80032d:	ff 75 e4             	push   -0x1c(%ebp)
+  800330:	ff 75 e0             	push   -0x20(%ebp)
+  800333:	ff 75 dc             	push   -0x24(%ebp)
+  800336:	ff 75 d8             	push   -0x28(%ebp)
+  800339:	e8 e2 25 00 00       	call   802920 <__umoddi3>
+  80033e:	83 c4 14             	add    $0x14,%esp
+  800341:	0f be 80 8c 2c 80 00 	movsbl 0x802c8c(%eax),%eax
+  800348:	50                   	push   %eax
+  800349:	ff d7                	call   *%edi
+}
+  80034b:	83 c4 10             	add    $0x10,%esp
+  80034e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800351:	5b                   	pop    %ebx
+  800352:	5e                   	pop    %esi
+  800353:	5f                   	pop    %edi
+  800354:	5d                   	pop    %ebp
+  800355:	c3                   	ret
+
+00800356 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800356:	55                   	push   %ebp
+  800357:	89 e5                	mov    %esp,%ebp
+  800359:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80035c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800360:	8b 10                	mov    (%eax),%edx
+  800362:	3b 50 04             	cmp    0x4(%eax),%edx
+  800365:	73 0a                	jae    800371 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800367:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80036a:	89 08                	mov    %ecx,(%eax)
+  80036c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80036f:	88 02                	mov    %al,(%edx)
+}
+  800371:	5d                   	pop    %ebp
+  800372:	c3                   	ret
+
+00800373 <printfmt>:
+{
+  800373:	55                   	push   %ebp
+  800374:	89 e5                	mov    %esp,%ebp
+  800376:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800379:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80037c:	50                   	push   %eax
+  80037d:	ff 75 10             	push   0x10(%ebp)
+  800380:	ff 75 0c             	push   0xc(%ebp)
+  800383:	ff 75 08             	push   0x8(%ebp)
+  800386:	e8 05 00 00 00       	call   800390 <vprintfmt>
+}
+  80038b:	83 c4 10             	add    $0x10,%esp
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+00800390 <vprintfmt>:
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	57                   	push   %edi
+  800394:	56                   	push   %esi
+  800395:	53                   	push   %ebx
+  800396:	83 ec 2c             	sub    $0x2c,%esp
+  800399:	8b 75 08             	mov    0x8(%ebp),%esi
+  80039c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80039f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003a2:	eb 0a                	jmp    8003ae <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003a4:	83 ec 08             	sub    $0x8,%esp
+  8003a7:	53                   	push   %ebx
+  8003a8:	50                   	push   %eax
+  8003a9:	ff d6                	call   *%esi
+  8003ab:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003ae:	83 c7 01             	add    $0x1,%edi
+  8003b1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003b5:	83 f8 25             	cmp    $0x25,%eax
+  8003b8:	74 0c                	je     8003c6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003ba:	85 c0                	test   %eax,%eax
+  8003bc:	75 e6                	jne    8003a4 <vprintfmt+0x14>
+}
+  8003be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c1:	5b                   	pop    %ebx
+  8003c2:	5e                   	pop    %esi
+  8003c3:	5f                   	pop    %edi
+  8003c4:	5d                   	pop    %ebp
+  8003c5:	c3                   	ret
+		padc = ' ';
+  8003c6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003ca:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003d8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003df:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e4:	8d 47 01             	lea    0x1(%edi),%eax
+  8003e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ea:	0f b6 17             	movzbl (%edi),%edx
+  8003ed:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003f0:	3c 55                	cmp    $0x55,%al
+  8003f2:	0f 87 cf 03 00 00    	ja     8007c7 <vprintfmt+0x437>
+  8003f8:	0f b6 c0             	movzbl %al,%eax
+  8003fb:	ff 24 85 c0 2d 80 00 	jmp    *0x802dc0(,%eax,4)
+  800402:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800405:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800409:	eb d9                	jmp    8003e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80040b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80040e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800412:	eb d0                	jmp    8003e4 <vprintfmt+0x54>
+  800414:	0f b6 d2             	movzbl %dl,%edx
+  800417:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80041a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800422:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800425:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800429:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80042c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80042f:	83 f9 09             	cmp    $0x9,%ecx
+  800432:	77 55                	ja     800489 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800434:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800437:	eb e9                	jmp    800422 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800439:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043c:	8b 00                	mov    (%eax),%eax
+  80043e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800441:	8b 45 14             	mov    0x14(%ebp),%eax
+  800444:	8d 40 04             	lea    0x4(%eax),%eax
+  800447:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80044a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80044d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800451:	79 91                	jns    8003e4 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800453:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800456:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800459:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800460:	eb 82                	jmp    8003e4 <vprintfmt+0x54>
+			if (width < 0)
+  800462:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800465:	85 d2                	test   %edx,%edx
+  800467:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046c:	0f 49 c2             	cmovns %edx,%eax
+  80046f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800472:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800475:	e9 6a ff ff ff       	jmp    8003e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80047d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800484:	e9 5b ff ff ff       	jmp    8003e4 <vprintfmt+0x54>
+  800489:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80048c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80048f:	eb bc                	jmp    80044d <vprintfmt+0xbd>
+			lflag++;
+  800491:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800494:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800497:	e9 48 ff ff ff       	jmp    8003e4 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80049c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049f:	8d 78 04             	lea    0x4(%eax),%edi
+  8004a2:	83 ec 08             	sub    $0x8,%esp
+  8004a5:	53                   	push   %ebx
+  8004a6:	ff 30                	push   (%eax)
+  8004a8:	ff d6                	call   *%esi
+			break;
+  8004aa:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004ad:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004b0:	e9 b1 02 00 00       	jmp    800766 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8004b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004bb:	8b 10                	mov    (%eax),%edx
+  8004bd:	89 d0                	mov    %edx,%eax
+  8004bf:	f7 d8                	neg    %eax
+  8004c1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004c4:	83 f8 0f             	cmp    $0xf,%eax
+  8004c7:	7f 23                	jg     8004ec <vprintfmt+0x15c>
+  8004c9:	8b 14 85 20 2f 80 00 	mov    0x802f20(,%eax,4),%edx
+  8004d0:	85 d2                	test   %edx,%edx
+  8004d2:	74 18                	je     8004ec <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004d4:	52                   	push   %edx
+  8004d5:	68 69 31 80 00       	push   $0x803169
+  8004da:	53                   	push   %ebx
+  8004db:	56                   	push   %esi
+  8004dc:	e8 92 fe ff ff       	call   800373 <printfmt>
+  8004e1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004e4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004e7:	e9 7a 02 00 00       	jmp    800766 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8004ec:	50                   	push   %eax
+  8004ed:	68 a4 2c 80 00       	push   $0x802ca4
+  8004f2:	53                   	push   %ebx
+  8004f3:	56                   	push   %esi
+  8004f4:	e8 7a fe ff ff       	call   800373 <printfmt>
+  8004f9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004fc:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004ff:	e9 62 02 00 00       	jmp    800766 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800504:	8b 45 14             	mov    0x14(%ebp),%eax
+  800507:	83 c0 04             	add    $0x4,%eax
+  80050a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80050d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800510:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800512:	85 c9                	test   %ecx,%ecx
+  800514:	b8 9d 2c 80 00       	mov    $0x802c9d,%eax
+  800519:	0f 45 c1             	cmovne %ecx,%eax
+  80051c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80051f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800523:	7e 06                	jle    80052b <vprintfmt+0x19b>
+  800525:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800529:	75 0b                	jne    800536 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80052e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800531:	89 75 08             	mov    %esi,0x8(%ebp)
+  800534:	eb 5c                	jmp    800592 <vprintfmt+0x202>
+  800536:	83 ec 08             	sub    $0x8,%esp
+  800539:	ff 75 d0             	push   -0x30(%ebp)
+  80053c:	ff 75 cc             	push   -0x34(%ebp)
+  80053f:	e8 20 03 00 00       	call   800864 <strnlen>
+  800544:	89 c2                	mov    %eax,%edx
+  800546:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800549:	29 d0                	sub    %edx,%eax
+  80054b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80054e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800552:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800555:	89 75 08             	mov    %esi,0x8(%ebp)
+  800558:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80055a:	eb 0e                	jmp    80056a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80055c:	83 ec 08             	sub    $0x8,%esp
+  80055f:	53                   	push   %ebx
+  800560:	57                   	push   %edi
+  800561:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800564:	83 ee 01             	sub    $0x1,%esi
+  800567:	83 c4 10             	add    $0x10,%esp
+  80056a:	85 f6                	test   %esi,%esi
+  80056c:	7f ee                	jg     80055c <vprintfmt+0x1cc>
+  80056e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800571:	8b 75 08             	mov    0x8(%ebp),%esi
+  800574:	85 c0                	test   %eax,%eax
+  800576:	ba 00 00 00 00       	mov    $0x0,%edx
+  80057b:	0f 49 d0             	cmovns %eax,%edx
+  80057e:	29 d0                	sub    %edx,%eax
+  800580:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800583:	eb a6                	jmp    80052b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800585:	83 ec 08             	sub    $0x8,%esp
+  800588:	53                   	push   %ebx
+  800589:	52                   	push   %edx
+  80058a:	ff 55 08             	call   *0x8(%ebp)
+  80058d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800590:	89 f1                	mov    %esi,%ecx
+  800592:	8d 71 01             	lea    0x1(%ecx),%esi
+  800595:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800599:	0f be d0             	movsbl %al,%edx
+  80059c:	85 d2                	test   %edx,%edx
+  80059e:	74 28                	je     8005c8 <vprintfmt+0x238>
+  8005a0:	85 ff                	test   %edi,%edi
+  8005a2:	78 05                	js     8005a9 <vprintfmt+0x219>
+  8005a4:	83 ef 01             	sub    $0x1,%edi
+  8005a7:	78 30                	js     8005d9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005ad:	74 d6                	je     800585 <vprintfmt+0x1f5>
+  8005af:	0f be c0             	movsbl %al,%eax
+  8005b2:	83 e8 20             	sub    $0x20,%eax
+  8005b5:	83 f8 5e             	cmp    $0x5e,%eax
+  8005b8:	76 cb                	jbe    800585 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005ba:	83 ec 08             	sub    $0x8,%esp
+  8005bd:	53                   	push   %ebx
+  8005be:	6a 3f                	push   $0x3f
+  8005c0:	ff 55 08             	call   *0x8(%ebp)
+  8005c3:	83 c4 10             	add    $0x10,%esp
+  8005c6:	eb c8                	jmp    800590 <vprintfmt+0x200>
+  8005c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005cb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005d1:	01 d0                	add    %edx,%eax
+  8005d3:	29 c8                	sub    %ecx,%eax
+  8005d5:	89 c7                	mov    %eax,%edi
+  8005d7:	eb 13                	jmp    8005ec <vprintfmt+0x25c>
+  8005d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005dc:	eb ed                	jmp    8005cb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005de:	83 ec 08             	sub    $0x8,%esp
+  8005e1:	53                   	push   %ebx
+  8005e2:	6a 20                	push   $0x20
+  8005e4:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005e6:	83 ef 01             	sub    $0x1,%edi
+  8005e9:	83 c4 10             	add    $0x10,%esp
+  8005ec:	85 ff                	test   %edi,%edi
+  8005ee:	7f ee                	jg     8005de <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005f0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f6:	e9 6b 01 00 00       	jmp    800766 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8005fb:	83 f9 01             	cmp    $0x1,%ecx
+  8005fe:	7f 1f                	jg     80061f <vprintfmt+0x28f>
+	else if (lflag)
+  800600:	85 c9                	test   %ecx,%ecx
+  800602:	74 67                	je     80066b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	8b 00                	mov    (%eax),%eax
+  800609:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060c:	89 c1                	mov    %eax,%ecx
+  80060e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800611:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800614:	8b 45 14             	mov    0x14(%ebp),%eax
+  800617:	8d 40 04             	lea    0x4(%eax),%eax
+  80061a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061d:	eb 17                	jmp    800636 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80061f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800622:	8b 50 04             	mov    0x4(%eax),%edx
+  800625:	8b 00                	mov    (%eax),%eax
+  800627:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8d 40 08             	lea    0x8(%eax),%eax
+  800633:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800636:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800639:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80063c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800641:	85 c9                	test   %ecx,%ecx
+  800643:	0f 89 03 01 00 00    	jns    80074c <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800649:	83 ec 08             	sub    $0x8,%esp
+  80064c:	53                   	push   %ebx
+  80064d:	6a 2d                	push   $0x2d
+  80064f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800651:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800654:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800657:	f7 da                	neg    %edx
+  800659:	83 d1 00             	adc    $0x0,%ecx
+  80065c:	f7 d9                	neg    %ecx
+  80065e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800661:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800666:	e9 e1 00 00 00       	jmp    80074c <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80066b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066e:	8b 00                	mov    (%eax),%eax
+  800670:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800673:	89 c1                	mov    %eax,%ecx
+  800675:	c1 f9 1f             	sar    $0x1f,%ecx
+  800678:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8d 40 04             	lea    0x4(%eax),%eax
+  800681:	89 45 14             	mov    %eax,0x14(%ebp)
+  800684:	eb b0                	jmp    800636 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800686:	83 f9 01             	cmp    $0x1,%ecx
+  800689:	7f 1e                	jg     8006a9 <vprintfmt+0x319>
+	else if (lflag)
+  80068b:	85 c9                	test   %ecx,%ecx
+  80068d:	74 32                	je     8006c1 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80068f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800692:	8b 10                	mov    (%eax),%edx
+  800694:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800699:	8d 40 04             	lea    0x4(%eax),%eax
+  80069c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80069f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006a4:	e9 a3 00 00 00       	jmp    80074c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ac:	8b 10                	mov    (%eax),%edx
+  8006ae:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006bc:	e9 8b 00 00 00       	jmp    80074c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c4:	8b 10                	mov    (%eax),%edx
+  8006c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006d6:	eb 74                	jmp    80074c <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8006d8:	83 f9 01             	cmp    $0x1,%ecx
+  8006db:	7f 1b                	jg     8006f8 <vprintfmt+0x368>
+	else if (lflag)
+  8006dd:	85 c9                	test   %ecx,%ecx
+  8006df:	74 2c                	je     80070d <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8006e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e4:	8b 10                	mov    (%eax),%edx
+  8006e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006f1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006f6:	eb 54                	jmp    80074c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fb:	8b 10                	mov    (%eax),%edx
+  8006fd:	8b 48 04             	mov    0x4(%eax),%ecx
+  800700:	8d 40 08             	lea    0x8(%eax),%eax
+  800703:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800706:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80070b:	eb 3f                	jmp    80074c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80070d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800710:	8b 10                	mov    (%eax),%edx
+  800712:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800717:	8d 40 04             	lea    0x4(%eax),%eax
+  80071a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80071d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800722:	eb 28                	jmp    80074c <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800724:	83 ec 08             	sub    $0x8,%esp
+  800727:	53                   	push   %ebx
+  800728:	6a 30                	push   $0x30
+  80072a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80072c:	83 c4 08             	add    $0x8,%esp
+  80072f:	53                   	push   %ebx
+  800730:	6a 78                	push   $0x78
+  800732:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800734:	8b 45 14             	mov    0x14(%ebp),%eax
+  800737:	8b 10                	mov    (%eax),%edx
+  800739:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80073e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800741:	8d 40 04             	lea    0x4(%eax),%eax
+  800744:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800747:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80074c:	83 ec 0c             	sub    $0xc,%esp
+  80074f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800753:	50                   	push   %eax
+  800754:	ff 75 e0             	push   -0x20(%ebp)
+  800757:	57                   	push   %edi
+  800758:	51                   	push   %ecx
+  800759:	52                   	push   %edx
+  80075a:	89 da                	mov    %ebx,%edx
+  80075c:	89 f0                	mov    %esi,%eax
+  80075e:	e8 4a fb ff ff       	call   8002ad <printnum>
+			break;
+  800763:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800766:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800769:	e9 40 fc ff ff       	jmp    8003ae <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80076e:	83 f9 01             	cmp    $0x1,%ecx
+  800771:	7f 1b                	jg     80078e <vprintfmt+0x3fe>
+	else if (lflag)
+  800773:	85 c9                	test   %ecx,%ecx
+  800775:	74 2c                	je     8007a3 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800777:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077a:	8b 10                	mov    (%eax),%edx
+  80077c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800781:	8d 40 04             	lea    0x4(%eax),%eax
+  800784:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800787:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80078c:	eb be                	jmp    80074c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80078e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800791:	8b 10                	mov    (%eax),%edx
+  800793:	8b 48 04             	mov    0x4(%eax),%ecx
+  800796:	8d 40 08             	lea    0x8(%eax),%eax
+  800799:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80079c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007a1:	eb a9                	jmp    80074c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a6:	8b 10                	mov    (%eax),%edx
+  8007a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007b8:	eb 92                	jmp    80074c <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8007ba:	83 ec 08             	sub    $0x8,%esp
+  8007bd:	53                   	push   %ebx
+  8007be:	6a 25                	push   $0x25
+  8007c0:	ff d6                	call   *%esi
+			break;
+  8007c2:	83 c4 10             	add    $0x10,%esp
+  8007c5:	eb 9f                	jmp    800766 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8007c7:	83 ec 08             	sub    $0x8,%esp
+  8007ca:	53                   	push   %ebx
+  8007cb:	6a 25                	push   $0x25
+  8007cd:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007cf:	83 c4 10             	add    $0x10,%esp
+  8007d2:	89 f8                	mov    %edi,%eax
+  8007d4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007d8:	74 05                	je     8007df <vprintfmt+0x44f>
+  8007da:	83 e8 01             	sub    $0x1,%eax
+  8007dd:	eb f5                	jmp    8007d4 <vprintfmt+0x444>
+  8007df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007e2:	eb 82                	jmp    800766 <vprintfmt+0x3d6>
+
+008007e4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007e4:	55                   	push   %ebp
+  8007e5:	89 e5                	mov    %esp,%ebp
+  8007e7:	83 ec 18             	sub    $0x18,%esp
+  8007ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007f0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007f3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007f7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007fa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800801:	85 c0                	test   %eax,%eax
+  800803:	74 26                	je     80082b <vsnprintf+0x47>
+  800805:	85 d2                	test   %edx,%edx
+  800807:	7e 22                	jle    80082b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800809:	ff 75 14             	push   0x14(%ebp)
+  80080c:	ff 75 10             	push   0x10(%ebp)
+  80080f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800812:	50                   	push   %eax
+  800813:	68 56 03 80 00       	push   $0x800356
+  800818:	e8 73 fb ff ff       	call   800390 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80081d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800820:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800823:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800826:	83 c4 10             	add    $0x10,%esp
+}
+  800829:	c9                   	leave
+  80082a:	c3                   	ret
+		return -E_INVAL;
+  80082b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800830:	eb f7                	jmp    800829 <vsnprintf+0x45>
+
+00800832 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800832:	55                   	push   %ebp
+  800833:	89 e5                	mov    %esp,%ebp
+  800835:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800838:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80083b:	50                   	push   %eax
+  80083c:	ff 75 10             	push   0x10(%ebp)
+  80083f:	ff 75 0c             	push   0xc(%ebp)
+  800842:	ff 75 08             	push   0x8(%ebp)
+  800845:	e8 9a ff ff ff       	call   8007e4 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80084a:	c9                   	leave
+  80084b:	c3                   	ret
+
+0080084c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80084c:	55                   	push   %ebp
+  80084d:	89 e5                	mov    %esp,%ebp
+  80084f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800852:	b8 00 00 00 00       	mov    $0x0,%eax
+  800857:	eb 03                	jmp    80085c <strlen+0x10>
+		n++;
+  800859:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80085c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800860:	75 f7                	jne    800859 <strlen+0xd>
+	return n;
+}
+  800862:	5d                   	pop    %ebp
+  800863:	c3                   	ret
+
+00800864 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800864:	55                   	push   %ebp
+  800865:	89 e5                	mov    %esp,%ebp
+  800867:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80086a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80086d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800872:	eb 03                	jmp    800877 <strnlen+0x13>
+		n++;
+  800874:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800877:	39 d0                	cmp    %edx,%eax
+  800879:	74 08                	je     800883 <strnlen+0x1f>
+  80087b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80087f:	75 f3                	jne    800874 <strnlen+0x10>
+  800881:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800883:	89 d0                	mov    %edx,%eax
+  800885:	5d                   	pop    %ebp
+  800886:	c3                   	ret
+
+00800887 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800887:	55                   	push   %ebp
+  800888:	89 e5                	mov    %esp,%ebp
+  80088a:	53                   	push   %ebx
+  80088b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80088e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800891:	b8 00 00 00 00       	mov    $0x0,%eax
+  800896:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80089a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80089d:	83 c0 01             	add    $0x1,%eax
+  8008a0:	84 d2                	test   %dl,%dl
+  8008a2:	75 f2                	jne    800896 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008a4:	89 c8                	mov    %ecx,%eax
+  8008a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a9:	c9                   	leave
+  8008aa:	c3                   	ret
+
+008008ab <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008ab:	55                   	push   %ebp
+  8008ac:	89 e5                	mov    %esp,%ebp
+  8008ae:	53                   	push   %ebx
+  8008af:	83 ec 10             	sub    $0x10,%esp
+  8008b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008b5:	53                   	push   %ebx
+  8008b6:	e8 91 ff ff ff       	call   80084c <strlen>
+  8008bb:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008be:	ff 75 0c             	push   0xc(%ebp)
+  8008c1:	01 d8                	add    %ebx,%eax
+  8008c3:	50                   	push   %eax
+  8008c4:	e8 be ff ff ff       	call   800887 <strcpy>
+	return dst;
+}
+  8008c9:	89 d8                	mov    %ebx,%eax
+  8008cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ce:	c9                   	leave
+  8008cf:	c3                   	ret
+
+008008d0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008d0:	55                   	push   %ebp
+  8008d1:	89 e5                	mov    %esp,%ebp
+  8008d3:	56                   	push   %esi
+  8008d4:	53                   	push   %ebx
+  8008d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008db:	89 f3                	mov    %esi,%ebx
+  8008dd:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008e0:	89 f0                	mov    %esi,%eax
+  8008e2:	eb 0f                	jmp    8008f3 <strncpy+0x23>
+		*dst++ = *src;
+  8008e4:	83 c0 01             	add    $0x1,%eax
+  8008e7:	0f b6 0a             	movzbl (%edx),%ecx
+  8008ea:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008ed:	80 f9 01             	cmp    $0x1,%cl
+  8008f0:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008f3:	39 d8                	cmp    %ebx,%eax
+  8008f5:	75 ed                	jne    8008e4 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008f7:	89 f0                	mov    %esi,%eax
+  8008f9:	5b                   	pop    %ebx
+  8008fa:	5e                   	pop    %esi
+  8008fb:	5d                   	pop    %ebp
+  8008fc:	c3                   	ret
+
+008008fd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	56                   	push   %esi
+  800901:	53                   	push   %ebx
+  800902:	8b 75 08             	mov    0x8(%ebp),%esi
+  800905:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800908:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80090b:	89 f0                	mov    %esi,%eax
+  80090d:	85 d2                	test   %edx,%edx
+  80090f:	74 21                	je     800932 <strlcpy+0x35>
+  800911:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800915:	89 f2                	mov    %esi,%edx
+  800917:	eb 09                	jmp    800922 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800919:	83 c1 01             	add    $0x1,%ecx
+  80091c:	83 c2 01             	add    $0x1,%edx
+  80091f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800922:	39 c2                	cmp    %eax,%edx
+  800924:	74 09                	je     80092f <strlcpy+0x32>
+  800926:	0f b6 19             	movzbl (%ecx),%ebx
+  800929:	84 db                	test   %bl,%bl
+  80092b:	75 ec                	jne    800919 <strlcpy+0x1c>
+  80092d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80092f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800932:	29 f0                	sub    %esi,%eax
+}
+  800934:	5b                   	pop    %ebx
+  800935:	5e                   	pop    %esi
+  800936:	5d                   	pop    %ebp
+  800937:	c3                   	ret
+
+00800938 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80093e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800941:	eb 06                	jmp    800949 <strcmp+0x11>
+		p++, q++;
+  800943:	83 c1 01             	add    $0x1,%ecx
+  800946:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800949:	0f b6 01             	movzbl (%ecx),%eax
+  80094c:	84 c0                	test   %al,%al
+  80094e:	74 04                	je     800954 <strcmp+0x1c>
+  800950:	3a 02                	cmp    (%edx),%al
+  800952:	74 ef                	je     800943 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800954:	0f b6 c0             	movzbl %al,%eax
+  800957:	0f b6 12             	movzbl (%edx),%edx
+  80095a:	29 d0                	sub    %edx,%eax
+}
+  80095c:	5d                   	pop    %ebp
+  80095d:	c3                   	ret
+
+0080095e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80095e:	55                   	push   %ebp
+  80095f:	89 e5                	mov    %esp,%ebp
+  800961:	53                   	push   %ebx
+  800962:	8b 45 08             	mov    0x8(%ebp),%eax
+  800965:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800968:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80096b:	eb 09                	jmp    800976 <strncmp+0x18>
+		n--, p++, q++;
+  80096d:	83 ea 01             	sub    $0x1,%edx
+  800970:	83 c0 01             	add    $0x1,%eax
+  800973:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800976:	85 d2                	test   %edx,%edx
+  800978:	74 18                	je     800992 <strncmp+0x34>
+  80097a:	0f b6 18             	movzbl (%eax),%ebx
+  80097d:	84 db                	test   %bl,%bl
+  80097f:	74 04                	je     800985 <strncmp+0x27>
+  800981:	3a 19                	cmp    (%ecx),%bl
+  800983:	74 e8                	je     80096d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800985:	0f b6 00             	movzbl (%eax),%eax
+  800988:	0f b6 11             	movzbl (%ecx),%edx
+  80098b:	29 d0                	sub    %edx,%eax
+}
+  80098d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800990:	c9                   	leave
+  800991:	c3                   	ret
+		return 0;
+  800992:	b8 00 00 00 00       	mov    $0x0,%eax
+  800997:	eb f4                	jmp    80098d <strncmp+0x2f>
+
+00800999 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800999:	55                   	push   %ebp
+  80099a:	89 e5                	mov    %esp,%ebp
+  80099c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009a3:	eb 03                	jmp    8009a8 <strchr+0xf>
+  8009a5:	83 c0 01             	add    $0x1,%eax
+  8009a8:	0f b6 10             	movzbl (%eax),%edx
+  8009ab:	84 d2                	test   %dl,%dl
+  8009ad:	74 06                	je     8009b5 <strchr+0x1c>
+		if (*s == c)
+  8009af:	38 ca                	cmp    %cl,%dl
+  8009b1:	75 f2                	jne    8009a5 <strchr+0xc>
+  8009b3:	eb 05                	jmp    8009ba <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009ba:	5d                   	pop    %ebp
+  8009bb:	c3                   	ret
+
+008009bc <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009bc:	55                   	push   %ebp
+  8009bd:	89 e5                	mov    %esp,%ebp
+  8009bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009c6:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009c9:	38 ca                	cmp    %cl,%dl
+  8009cb:	74 09                	je     8009d6 <strfind+0x1a>
+  8009cd:	84 d2                	test   %dl,%dl
+  8009cf:	74 05                	je     8009d6 <strfind+0x1a>
+	for (; *s; s++)
+  8009d1:	83 c0 01             	add    $0x1,%eax
+  8009d4:	eb f0                	jmp    8009c6 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009d6:	5d                   	pop    %ebp
+  8009d7:	c3                   	ret
+
+008009d8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009d8:	55                   	push   %ebp
+  8009d9:	89 e5                	mov    %esp,%ebp
+  8009db:	57                   	push   %edi
+  8009dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009df:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009e2:	85 c9                	test   %ecx,%ecx
+  8009e4:	74 20                	je     800a06 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009e6:	89 f8                	mov    %edi,%eax
+  8009e8:	09 c8                	or     %ecx,%eax
+  8009ea:	a8 03                	test   $0x3,%al
+  8009ec:	75 12                	jne    800a00 <memset+0x28>
+		c &= 0xFF;
+  8009ee:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009f2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009f8:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009fb:	fc                   	cld
+  8009fc:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009fe:	eb 06                	jmp    800a06 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a03:	fc                   	cld
+  800a04:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a06:	89 f8                	mov    %edi,%eax
+  800a08:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a0b:	c9                   	leave
+  800a0c:	c3                   	ret
+
+00800a0d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a0d:	55                   	push   %ebp
+  800a0e:	89 e5                	mov    %esp,%ebp
+  800a10:	57                   	push   %edi
+  800a11:	56                   	push   %esi
+  800a12:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a15:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a18:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a1b:	39 c6                	cmp    %eax,%esi
+  800a1d:	73 32                	jae    800a51 <memmove+0x44>
+  800a1f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a22:	39 d0                	cmp    %edx,%eax
+  800a24:	73 2b                	jae    800a51 <memmove+0x44>
+		s += n;
+		d += n;
+  800a26:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a29:	89 d6                	mov    %edx,%esi
+  800a2b:	09 fe                	or     %edi,%esi
+  800a2d:	09 ce                	or     %ecx,%esi
+  800a2f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a35:	75 0e                	jne    800a45 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a37:	83 ef 04             	sub    $0x4,%edi
+  800a3a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a3d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a40:	fd                   	std
+  800a41:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a43:	eb 09                	jmp    800a4e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a45:	83 ef 01             	sub    $0x1,%edi
+  800a48:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a4b:	fd                   	std
+  800a4c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a4e:	fc                   	cld
+  800a4f:	eb 1a                	jmp    800a6b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a51:	89 f2                	mov    %esi,%edx
+  800a53:	09 c2                	or     %eax,%edx
+  800a55:	09 ca                	or     %ecx,%edx
+  800a57:	f6 c2 03             	test   $0x3,%dl
+  800a5a:	75 0a                	jne    800a66 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a5c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a5f:	89 c7                	mov    %eax,%edi
+  800a61:	fc                   	cld
+  800a62:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a64:	eb 05                	jmp    800a6b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a66:	89 c7                	mov    %eax,%edi
+  800a68:	fc                   	cld
+  800a69:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a6b:	5e                   	pop    %esi
+  800a6c:	5f                   	pop    %edi
+  800a6d:	5d                   	pop    %ebp
+  800a6e:	c3                   	ret
+
+00800a6f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a6f:	55                   	push   %ebp
+  800a70:	89 e5                	mov    %esp,%ebp
+  800a72:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a75:	ff 75 10             	push   0x10(%ebp)
+  800a78:	ff 75 0c             	push   0xc(%ebp)
+  800a7b:	ff 75 08             	push   0x8(%ebp)
+  800a7e:	e8 8a ff ff ff       	call   800a0d <memmove>
+}
+  800a83:	c9                   	leave
+  800a84:	c3                   	ret
+
+00800a85 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a85:	55                   	push   %ebp
+  800a86:	89 e5                	mov    %esp,%ebp
+  800a88:	56                   	push   %esi
+  800a89:	53                   	push   %ebx
+  800a8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a90:	89 c6                	mov    %eax,%esi
+  800a92:	03 75 10             	add    0x10(%ebp),%esi
+  800a95:	eb 06                	jmp    800a9d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a97:	83 c0 01             	add    $0x1,%eax
+  800a9a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a9d:	39 f0                	cmp    %esi,%eax
+  800a9f:	74 14                	je     800ab5 <memcmp+0x30>
+		if (*s1 != *s2)
+  800aa1:	0f b6 08             	movzbl (%eax),%ecx
+  800aa4:	0f b6 1a             	movzbl (%edx),%ebx
+  800aa7:	38 d9                	cmp    %bl,%cl
+  800aa9:	74 ec                	je     800a97 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800aab:	0f b6 c1             	movzbl %cl,%eax
+  800aae:	0f b6 db             	movzbl %bl,%ebx
+  800ab1:	29 d8                	sub    %ebx,%eax
+  800ab3:	eb 05                	jmp    800aba <memcmp+0x35>
+	}
+
+	return 0;
+  800ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aba:	5b                   	pop    %ebx
+  800abb:	5e                   	pop    %esi
+  800abc:	5d                   	pop    %ebp
+  800abd:	c3                   	ret
+
+00800abe <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800abe:	55                   	push   %ebp
+  800abf:	89 e5                	mov    %esp,%ebp
+  800ac1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ac7:	89 c2                	mov    %eax,%edx
+  800ac9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800acc:	eb 03                	jmp    800ad1 <memfind+0x13>
+  800ace:	83 c0 01             	add    $0x1,%eax
+  800ad1:	39 d0                	cmp    %edx,%eax
+  800ad3:	73 04                	jae    800ad9 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ad5:	38 08                	cmp    %cl,(%eax)
+  800ad7:	75 f5                	jne    800ace <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ad9:	5d                   	pop    %ebp
+  800ada:	c3                   	ret
+
+00800adb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800adb:	55                   	push   %ebp
+  800adc:	89 e5                	mov    %esp,%ebp
+  800ade:	57                   	push   %edi
+  800adf:	56                   	push   %esi
+  800ae0:	53                   	push   %ebx
+  800ae1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ae7:	eb 03                	jmp    800aec <strtol+0x11>
+		s++;
+  800ae9:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800aec:	0f b6 02             	movzbl (%edx),%eax
+  800aef:	3c 20                	cmp    $0x20,%al
+  800af1:	74 f6                	je     800ae9 <strtol+0xe>
+  800af3:	3c 09                	cmp    $0x9,%al
+  800af5:	74 f2                	je     800ae9 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800af7:	3c 2b                	cmp    $0x2b,%al
+  800af9:	74 2a                	je     800b25 <strtol+0x4a>
+	int neg = 0;
+  800afb:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b00:	3c 2d                	cmp    $0x2d,%al
+  800b02:	74 2b                	je     800b2f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b04:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b0a:	75 0f                	jne    800b1b <strtol+0x40>
+  800b0c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b0f:	74 28                	je     800b39 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b11:	85 db                	test   %ebx,%ebx
+  800b13:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b18:	0f 44 d8             	cmove  %eax,%ebx
+  800b1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b20:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b23:	eb 46                	jmp    800b6b <strtol+0x90>
+		s++;
+  800b25:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b28:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b2d:	eb d5                	jmp    800b04 <strtol+0x29>
+		s++, neg = 1;
+  800b2f:	83 c2 01             	add    $0x1,%edx
+  800b32:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b37:	eb cb                	jmp    800b04 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b39:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b3d:	74 0e                	je     800b4d <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b3f:	85 db                	test   %ebx,%ebx
+  800b41:	75 d8                	jne    800b1b <strtol+0x40>
+		s++, base = 8;
+  800b43:	83 c2 01             	add    $0x1,%edx
+  800b46:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b4b:	eb ce                	jmp    800b1b <strtol+0x40>
+		s += 2, base = 16;
+  800b4d:	83 c2 02             	add    $0x2,%edx
+  800b50:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b55:	eb c4                	jmp    800b1b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b57:	0f be c0             	movsbl %al,%eax
+  800b5a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b5d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b60:	7d 3a                	jge    800b9c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b62:	83 c2 01             	add    $0x1,%edx
+  800b65:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b69:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b6b:	0f b6 02             	movzbl (%edx),%eax
+  800b6e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b71:	89 f3                	mov    %esi,%ebx
+  800b73:	80 fb 09             	cmp    $0x9,%bl
+  800b76:	76 df                	jbe    800b57 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b78:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b7b:	89 f3                	mov    %esi,%ebx
+  800b7d:	80 fb 19             	cmp    $0x19,%bl
+  800b80:	77 08                	ja     800b8a <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b82:	0f be c0             	movsbl %al,%eax
+  800b85:	83 e8 57             	sub    $0x57,%eax
+  800b88:	eb d3                	jmp    800b5d <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b8a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b8d:	89 f3                	mov    %esi,%ebx
+  800b8f:	80 fb 19             	cmp    $0x19,%bl
+  800b92:	77 08                	ja     800b9c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b94:	0f be c0             	movsbl %al,%eax
+  800b97:	83 e8 37             	sub    $0x37,%eax
+  800b9a:	eb c1                	jmp    800b5d <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b9c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ba0:	74 05                	je     800ba7 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ba2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ba5:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ba7:	89 c8                	mov    %ecx,%eax
+  800ba9:	f7 d8                	neg    %eax
+  800bab:	85 ff                	test   %edi,%edi
+  800bad:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bb0:	89 c8                	mov    %ecx,%eax
+  800bb2:	5b                   	pop    %ebx
+  800bb3:	5e                   	pop    %esi
+  800bb4:	5f                   	pop    %edi
+  800bb5:	5d                   	pop    %ebp
+  800bb6:	c3                   	ret
+
+00800bb7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bb7:	55                   	push   %ebp
+  800bb8:	89 e5                	mov    %esp,%ebp
+  800bba:	57                   	push   %edi
+  800bbb:	56                   	push   %esi
+  800bbc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc8:	89 c3                	mov    %eax,%ebx
+  800bca:	89 c7                	mov    %eax,%edi
+  800bcc:	89 c6                	mov    %eax,%esi
+  800bce:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bd0:	5b                   	pop    %ebx
+  800bd1:	5e                   	pop    %esi
+  800bd2:	5f                   	pop    %edi
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+
+00800bd5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bd5:	55                   	push   %ebp
+  800bd6:	89 e5                	mov    %esp,%ebp
+  800bd8:	57                   	push   %edi
+  800bd9:	56                   	push   %esi
+  800bda:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800be5:	89 d1                	mov    %edx,%ecx
+  800be7:	89 d3                	mov    %edx,%ebx
+  800be9:	89 d7                	mov    %edx,%edi
+  800beb:	89 d6                	mov    %edx,%esi
+  800bed:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bef:	5b                   	pop    %ebx
+  800bf0:	5e                   	pop    %esi
+  800bf1:	5f                   	pop    %edi
+  800bf2:	5d                   	pop    %ebp
+  800bf3:	c3                   	ret
+
+00800bf4 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800bf4:	55                   	push   %ebp
+  800bf5:	89 e5                	mov    %esp,%ebp
+  800bf7:	57                   	push   %edi
+  800bf8:	56                   	push   %esi
+  800bf9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bfa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c02:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c07:	89 cb                	mov    %ecx,%ebx
+  800c09:	89 cf                	mov    %ecx,%edi
+  800c0b:	89 ce                	mov    %ecx,%esi
+  800c0d:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800c0f:	5b                   	pop    %ebx
+  800c10:	5e                   	pop    %esi
+  800c11:	5f                   	pop    %edi
+  800c12:	5d                   	pop    %ebp
+  800c13:	c3                   	ret
+
+00800c14 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c14:	55                   	push   %ebp
+  800c15:	89 e5                	mov    %esp,%ebp
+  800c17:	57                   	push   %edi
+  800c18:	56                   	push   %esi
+  800c19:	53                   	push   %ebx
+  800c1a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c25:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c2a:	89 cb                	mov    %ecx,%ebx
+  800c2c:	89 cf                	mov    %ecx,%edi
+  800c2e:	89 ce                	mov    %ecx,%esi
+  800c30:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c32:	85 c0                	test   %eax,%eax
+  800c34:	7f 08                	jg     800c3e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c39:	5b                   	pop    %ebx
+  800c3a:	5e                   	pop    %esi
+  800c3b:	5f                   	pop    %edi
+  800c3c:	5d                   	pop    %ebp
+  800c3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c3e:	83 ec 0c             	sub    $0xc,%esp
+  800c41:	50                   	push   %eax
+  800c42:	6a 03                	push   $0x3
+  800c44:	68 7f 2f 80 00       	push   $0x802f7f
+  800c49:	6a 23                	push   $0x23
+  800c4b:	68 9c 2f 80 00       	push   $0x802f9c
+  800c50:	e8 13 1a 00 00       	call   802668 <_panic>
+
+00800c55 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c55:	55                   	push   %ebp
+  800c56:	89 e5                	mov    %esp,%ebp
+  800c58:	57                   	push   %edi
+  800c59:	56                   	push   %esi
+  800c5a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c60:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c65:	89 d1                	mov    %edx,%ecx
+  800c67:	89 d3                	mov    %edx,%ebx
+  800c69:	89 d7                	mov    %edx,%edi
+  800c6b:	89 d6                	mov    %edx,%esi
+  800c6d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c6f:	5b                   	pop    %ebx
+  800c70:	5e                   	pop    %esi
+  800c71:	5f                   	pop    %edi
+  800c72:	5d                   	pop    %ebp
+  800c73:	c3                   	ret
+
+00800c74 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c74:	55                   	push   %ebp
+  800c75:	89 e5                	mov    %esp,%ebp
+  800c77:	57                   	push   %edi
+  800c78:	56                   	push   %esi
+  800c79:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7f:	b8 16 00 00 00       	mov    $0x16,%eax
+  800c84:	89 d1                	mov    %edx,%ecx
+  800c86:	89 d3                	mov    %edx,%ebx
+  800c88:	89 d7                	mov    %edx,%edi
+  800c8a:	89 d6                	mov    %edx,%esi
+  800c8c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c8e:	5b                   	pop    %ebx
+  800c8f:	5e                   	pop    %esi
+  800c90:	5f                   	pop    %edi
+  800c91:	5d                   	pop    %ebp
+  800c92:	c3                   	ret
+
+00800c93 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800c93:	55                   	push   %ebp
+  800c94:	89 e5                	mov    %esp,%ebp
+  800c96:	57                   	push   %edi
+  800c97:	56                   	push   %esi
+  800c98:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c99:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ca3:	89 d1                	mov    %edx,%ecx
+  800ca5:	89 d3                	mov    %edx,%ebx
+  800ca7:	89 d7                	mov    %edx,%edi
+  800ca9:	89 d6                	mov    %edx,%esi
+  800cab:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800cad:	5b                   	pop    %ebx
+  800cae:	5e                   	pop    %esi
+  800caf:	5f                   	pop    %edi
+  800cb0:	5d                   	pop    %ebp
+  800cb1:	c3                   	ret
+
+00800cb2 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800cb2:	55                   	push   %ebp
+  800cb3:	89 e5                	mov    %esp,%ebp
+  800cb5:	57                   	push   %edi
+  800cb6:	56                   	push   %esi
+  800cb7:	53                   	push   %ebx
+  800cb8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc6:	b8 15 00 00 00       	mov    $0x15,%eax
+  800ccb:	89 df                	mov    %ebx,%edi
+  800ccd:	89 de                	mov    %ebx,%esi
+  800ccf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd1:	85 c0                	test   %eax,%eax
+  800cd3:	7f 08                	jg     800cdd <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800cd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd8:	5b                   	pop    %ebx
+  800cd9:	5e                   	pop    %esi
+  800cda:	5f                   	pop    %edi
+  800cdb:	5d                   	pop    %ebp
+  800cdc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cdd:	83 ec 0c             	sub    $0xc,%esp
+  800ce0:	50                   	push   %eax
+  800ce1:	6a 15                	push   $0x15
+  800ce3:	68 7f 2f 80 00       	push   $0x802f7f
+  800ce8:	6a 23                	push   $0x23
+  800cea:	68 9c 2f 80 00       	push   $0x802f9c
+  800cef:	e8 74 19 00 00       	call   802668 <_panic>
+
+00800cf4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	57                   	push   %edi
+  800cf8:	56                   	push   %esi
+  800cf9:	53                   	push   %ebx
+  800cfa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cfd:	be 00 00 00 00       	mov    $0x0,%esi
+  800d02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d08:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d10:	89 f7                	mov    %esi,%edi
+  800d12:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d14:	85 c0                	test   %eax,%eax
+  800d16:	7f 08                	jg     800d20 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1b:	5b                   	pop    %ebx
+  800d1c:	5e                   	pop    %esi
+  800d1d:	5f                   	pop    %edi
+  800d1e:	5d                   	pop    %ebp
+  800d1f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d20:	83 ec 0c             	sub    $0xc,%esp
+  800d23:	50                   	push   %eax
+  800d24:	6a 05                	push   $0x5
+  800d26:	68 7f 2f 80 00       	push   $0x802f7f
+  800d2b:	6a 23                	push   $0x23
+  800d2d:	68 9c 2f 80 00       	push   $0x802f9c
+  800d32:	e8 31 19 00 00       	call   802668 <_panic>
+
+00800d37 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	57                   	push   %edi
+  800d3b:	56                   	push   %esi
+  800d3c:	53                   	push   %ebx
+  800d3d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d40:	be 00 00 00 00       	mov    $0x0,%esi
+  800d45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d53:	89 f7                	mov    %esi,%edi
+  800d55:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d57:	85 c0                	test   %eax,%eax
+  800d59:	7f 08                	jg     800d63 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5e:	5b                   	pop    %ebx
+  800d5f:	5e                   	pop    %esi
+  800d60:	5f                   	pop    %edi
+  800d61:	5d                   	pop    %ebp
+  800d62:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d63:	83 ec 0c             	sub    $0xc,%esp
+  800d66:	50                   	push   %eax
+  800d67:	6a 06                	push   $0x6
+  800d69:	68 7f 2f 80 00       	push   $0x802f7f
+  800d6e:	6a 23                	push   $0x23
+  800d70:	68 9c 2f 80 00       	push   $0x802f9c
+  800d75:	e8 ee 18 00 00       	call   802668 <_panic>
+
+00800d7a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d7a:	55                   	push   %ebp
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	57                   	push   %edi
+  800d7e:	56                   	push   %esi
+  800d7f:	53                   	push   %ebx
+  800d80:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d89:	b8 07 00 00 00       	mov    $0x7,%eax
+  800d8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d91:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d94:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d97:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d99:	85 c0                	test   %eax,%eax
+  800d9b:	7f 08                	jg     800da5 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da5:	83 ec 0c             	sub    $0xc,%esp
+  800da8:	50                   	push   %eax
+  800da9:	6a 07                	push   $0x7
+  800dab:	68 7f 2f 80 00       	push   $0x802f7f
+  800db0:	6a 23                	push   $0x23
+  800db2:	68 9c 2f 80 00       	push   $0x802f9c
+  800db7:	e8 ac 18 00 00       	call   802668 <_panic>
+
+00800dbc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	57                   	push   %edi
+  800dc0:	56                   	push   %esi
+  800dc1:	53                   	push   %ebx
+  800dc2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd0:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dd5:	89 df                	mov    %ebx,%edi
+  800dd7:	89 de                	mov    %ebx,%esi
+  800dd9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddb:	85 c0                	test   %eax,%eax
+  800ddd:	7f 08                	jg     800de7 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de2:	5b                   	pop    %ebx
+  800de3:	5e                   	pop    %esi
+  800de4:	5f                   	pop    %edi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de7:	83 ec 0c             	sub    $0xc,%esp
+  800dea:	50                   	push   %eax
+  800deb:	6a 08                	push   $0x8
+  800ded:	68 7f 2f 80 00       	push   $0x802f7f
+  800df2:	6a 23                	push   $0x23
+  800df4:	68 9c 2f 80 00       	push   $0x802f9c
+  800df9:	e8 6a 18 00 00       	call   802668 <_panic>
+
+00800dfe <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	57                   	push   %edi
+  800e02:	56                   	push   %esi
+  800e03:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e0f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e14:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e17:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e1a:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e1c:	5b                   	pop    %ebx
+  800e1d:	5e                   	pop    %esi
+  800e1e:	5f                   	pop    %edi
+  800e1f:	5d                   	pop    %ebp
+  800e20:	c3                   	ret
+
+00800e21 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e21:	55                   	push   %ebp
+  800e22:	89 e5                	mov    %esp,%ebp
+  800e24:	57                   	push   %edi
+  800e25:	56                   	push   %esi
+  800e26:	53                   	push   %ebx
+  800e27:	8b 45 18             	mov    0x18(%ebp),%eax
+  800e2a:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800e2d:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800e32:	77 27                	ja     800e5b <sys_page_map_range+0x3a>
+  800e34:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800e3a:	77 1f                	ja     800e5b <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800e3c:	c1 e0 0c             	shl    $0xc,%eax
+  800e3f:	89 c6                	mov    %eax,%esi
+  800e41:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800e43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e49:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e51:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e54:	cd 30                	int    $0x30
+}
+  800e56:	5b                   	pop    %ebx
+  800e57:	5e                   	pop    %esi
+  800e58:	5f                   	pop    %edi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	c3                   	ret
+		return -E_INVAL;
+  800e5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e60:	eb f4                	jmp    800e56 <sys_page_map_range+0x35>
+
+00800e62 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800e62:	55                   	push   %ebp
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	57                   	push   %edi
+  800e66:	56                   	push   %esi
+  800e67:	53                   	push   %ebx
+  800e68:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e71:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e76:	be 00 00 00 00       	mov    $0x0,%esi
+  800e7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e7e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e81:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e83:	85 c0                	test   %eax,%eax
+  800e85:	7f 08                	jg     800e8f <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8a:	5b                   	pop    %ebx
+  800e8b:	5e                   	pop    %esi
+  800e8c:	5f                   	pop    %edi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8f:	83 ec 0c             	sub    $0xc,%esp
+  800e92:	50                   	push   %eax
+  800e93:	6a 0c                	push   $0xc
+  800e95:	68 7f 2f 80 00       	push   $0x802f7f
+  800e9a:	6a 23                	push   $0x23
+  800e9c:	68 9c 2f 80 00       	push   $0x802f9c
+  800ea1:	e8 c2 17 00 00       	call   802668 <_panic>
+
+00800ea6 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	57                   	push   %edi
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eac:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ebc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebf:	89 f7                	mov    %esi,%edi
+  800ec1:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ec3:	5b                   	pop    %ebx
+  800ec4:	5e                   	pop    %esi
+  800ec5:	5f                   	pop    %edi
+  800ec6:	5d                   	pop    %ebp
+  800ec7:	c3                   	ret
+
+00800ec8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	57                   	push   %edi
+  800ecc:	56                   	push   %esi
+  800ecd:	53                   	push   %ebx
+  800ece:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ee1:	89 df                	mov    %ebx,%edi
+  800ee3:	89 de                	mov    %ebx,%esi
+  800ee5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee7:	85 c0                	test   %eax,%eax
+  800ee9:	7f 08                	jg     800ef3 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800eeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eee:	5b                   	pop    %ebx
+  800eef:	5e                   	pop    %esi
+  800ef0:	5f                   	pop    %edi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef3:	83 ec 0c             	sub    $0xc,%esp
+  800ef6:	50                   	push   %eax
+  800ef7:	6a 0f                	push   $0xf
+  800ef9:	68 7f 2f 80 00       	push   $0x802f7f
+  800efe:	6a 23                	push   $0x23
+  800f00:	68 9c 2f 80 00       	push   $0x802f9c
+  800f05:	e8 5e 17 00 00       	call   802668 <_panic>
+
+00800f0a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800f0a:	55                   	push   %ebp
+  800f0b:	89 e5                	mov    %esp,%ebp
+  800f0d:	57                   	push   %edi
+  800f0e:	56                   	push   %esi
+  800f0f:	53                   	push   %ebx
+  800f10:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f23:	89 df                	mov    %ebx,%edi
+  800f25:	89 de                	mov    %ebx,%esi
+  800f27:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f29:	85 c0                	test   %eax,%eax
+  800f2b:	7f 08                	jg     800f35 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800f2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f30:	5b                   	pop    %ebx
+  800f31:	5e                   	pop    %esi
+  800f32:	5f                   	pop    %edi
+  800f33:	5d                   	pop    %ebp
+  800f34:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f35:	83 ec 0c             	sub    $0xc,%esp
+  800f38:	50                   	push   %eax
+  800f39:	6a 10                	push   $0x10
+  800f3b:	68 7f 2f 80 00       	push   $0x802f7f
+  800f40:	6a 23                	push   $0x23
+  800f42:	68 9c 2f 80 00       	push   $0x802f9c
+  800f47:	e8 1c 17 00 00       	call   802668 <_panic>
+
+00800f4c <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	57                   	push   %edi
+  800f50:	56                   	push   %esi
+  800f51:	53                   	push   %ebx
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f60:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f65:	89 df                	mov    %ebx,%edi
+  800f67:	89 de                	mov    %ebx,%esi
+  800f69:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6b:	85 c0                	test   %eax,%eax
+  800f6d:	7f 08                	jg     800f77 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800f6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f72:	5b                   	pop    %ebx
+  800f73:	5e                   	pop    %esi
+  800f74:	5f                   	pop    %edi
+  800f75:	5d                   	pop    %ebp
+  800f76:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f77:	83 ec 0c             	sub    $0xc,%esp
+  800f7a:	50                   	push   %eax
+  800f7b:	6a 11                	push   $0x11
+  800f7d:	68 7f 2f 80 00       	push   $0x802f7f
+  800f82:	6a 23                	push   $0x23
+  800f84:	68 9c 2f 80 00       	push   $0x802f9c
+  800f89:	e8 da 16 00 00       	call   802668 <_panic>
+
+00800f8e <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800f8e:	55                   	push   %ebp
+  800f8f:	89 e5                	mov    %esp,%ebp
+  800f91:	57                   	push   %edi
+  800f92:	56                   	push   %esi
+  800f93:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f99:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f9e:	89 d1                	mov    %edx,%ecx
+  800fa0:	89 d3                	mov    %edx,%ebx
+  800fa2:	89 d7                	mov    %edx,%edi
+  800fa4:	89 d6                	mov    %edx,%esi
+  800fa6:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800fa8:	5b                   	pop    %ebx
+  800fa9:	5e                   	pop    %esi
+  800faa:	5f                   	pop    %edi
+  800fab:	5d                   	pop    %ebp
+  800fac:	c3                   	ret
+
+00800fad <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	57                   	push   %edi
+  800fb1:	56                   	push   %esi
+  800fb2:	53                   	push   %ebx
+  800fb3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc1:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fc6:	89 df                	mov    %ebx,%edi
+  800fc8:	89 de                	mov    %ebx,%esi
+  800fca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fcc:	85 c0                	test   %eax,%eax
+  800fce:	7f 08                	jg     800fd8 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd3:	5b                   	pop    %ebx
+  800fd4:	5e                   	pop    %esi
+  800fd5:	5f                   	pop    %edi
+  800fd6:	5d                   	pop    %ebp
+  800fd7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd8:	83 ec 0c             	sub    $0xc,%esp
+  800fdb:	50                   	push   %eax
+  800fdc:	6a 13                	push   $0x13
+  800fde:	68 7f 2f 80 00       	push   $0x802f7f
+  800fe3:	6a 23                	push   $0x23
+  800fe5:	68 9c 2f 80 00       	push   $0x802f9c
+  800fea:	e8 79 16 00 00       	call   802668 <_panic>
+
+00800fef <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fef:	55                   	push   %ebp
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	57                   	push   %edi
+  800ff3:	56                   	push   %esi
+  800ff4:	53                   	push   %ebx
+  800ff5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ff8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801000:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801003:	b8 14 00 00 00       	mov    $0x14,%eax
+  801008:	89 df                	mov    %ebx,%edi
+  80100a:	89 de                	mov    %ebx,%esi
+  80100c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80100e:	85 c0                	test   %eax,%eax
+  801010:	7f 08                	jg     80101a <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801012:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801015:	5b                   	pop    %ebx
+  801016:	5e                   	pop    %esi
+  801017:	5f                   	pop    %edi
+  801018:	5d                   	pop    %ebp
+  801019:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101a:	83 ec 0c             	sub    $0xc,%esp
+  80101d:	50                   	push   %eax
+  80101e:	6a 14                	push   $0x14
+  801020:	68 7f 2f 80 00       	push   $0x802f7f
+  801025:	6a 23                	push   $0x23
+  801027:	68 9c 2f 80 00       	push   $0x802f9c
+  80102c:	e8 37 16 00 00       	call   802668 <_panic>
+
+00801031 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	57                   	push   %edi
+  801035:	56                   	push   %esi
+  801036:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801037:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801042:	be 00 00 00 00       	mov    $0x0,%esi
+  801047:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80104d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80104f:	5b                   	pop    %ebx
+  801050:	5e                   	pop    %esi
+  801051:	5f                   	pop    %edi
+  801052:	5d                   	pop    %ebp
+  801053:	c3                   	ret
+
+00801054 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801054:	55                   	push   %ebp
+  801055:	89 e5                	mov    %esp,%ebp
+  801057:	57                   	push   %edi
+  801058:	56                   	push   %esi
+  801059:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801060:	b8 18 00 00 00       	mov    $0x18,%eax
+  801065:	be 00 00 00 00       	mov    $0x0,%esi
+  80106a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801070:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801072:	5b                   	pop    %ebx
+  801073:	5e                   	pop    %esi
+  801074:	5f                   	pop    %edi
+  801075:	5d                   	pop    %ebp
+  801076:	c3                   	ret
+
+00801077 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	57                   	push   %edi
+  80107b:	56                   	push   %esi
+  80107c:	53                   	push   %ebx
+  80107d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801080:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801085:	8b 55 08             	mov    0x8(%ebp),%edx
+  801088:	b8 19 00 00 00       	mov    $0x19,%eax
+  80108d:	89 cb                	mov    %ecx,%ebx
+  80108f:	89 cf                	mov    %ecx,%edi
+  801091:	89 ce                	mov    %ecx,%esi
+  801093:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801095:	85 c0                	test   %eax,%eax
+  801097:	7f 08                	jg     8010a1 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801099:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109c:	5b                   	pop    %ebx
+  80109d:	5e                   	pop    %esi
+  80109e:	5f                   	pop    %edi
+  80109f:	5d                   	pop    %ebp
+  8010a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a1:	83 ec 0c             	sub    $0xc,%esp
+  8010a4:	50                   	push   %eax
+  8010a5:	6a 19                	push   $0x19
+  8010a7:	68 7f 2f 80 00       	push   $0x802f7f
+  8010ac:	6a 23                	push   $0x23
+  8010ae:	68 9c 2f 80 00       	push   $0x802f9c
+  8010b3:	e8 b0 15 00 00       	call   802668 <_panic>
+
+008010b8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010b8:	55                   	push   %ebp
+  8010b9:	89 e5                	mov    %esp,%ebp
+  8010bb:	57                   	push   %edi
+  8010bc:	56                   	push   %esi
+  8010bd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010c8:	89 d1                	mov    %edx,%ecx
+  8010ca:	89 d3                	mov    %edx,%ebx
+  8010cc:	89 d7                	mov    %edx,%edi
+  8010ce:	89 d6                	mov    %edx,%esi
+  8010d0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010d2:	5b                   	pop    %ebx
+  8010d3:	5e                   	pop    %esi
+  8010d4:	5f                   	pop    %edi
+  8010d5:	5d                   	pop    %ebp
+  8010d6:	c3                   	ret
+
+008010d7 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010ed:	89 df                	mov    %ebx,%edi
+  8010ef:	89 de                	mov    %ebx,%esi
+  8010f1:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5e                   	pop    %esi
+  8010f5:	5f                   	pop    %edi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+
+008010f8 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	57                   	push   %edi
+  8010fc:	56                   	push   %esi
+  8010fd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801103:	8b 55 08             	mov    0x8(%ebp),%edx
+  801106:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801109:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80110e:	89 df                	mov    %ebx,%edi
+  801110:	89 de                	mov    %ebx,%esi
+  801112:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801114:	5b                   	pop    %ebx
+  801115:	5e                   	pop    %esi
+  801116:	5f                   	pop    %edi
+  801117:	5d                   	pop    %ebp
+  801118:	c3                   	ret
+
+00801119 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801119:	55                   	push   %ebp
+  80111a:	89 e5                	mov    %esp,%ebp
+  80111c:	53                   	push   %ebx
+  80111d:	83 ec 04             	sub    $0x4,%esp
+  801120:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801123:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  801125:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  801128:	f6 c2 02             	test   $0x2,%dl
+  80112b:	74 7b                	je     8011a8 <pgfault+0x8f>
+  80112d:	89 c1                	mov    %eax,%ecx
+  80112f:	c1 e9 0c             	shr    $0xc,%ecx
+  801132:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  801139:	f6 c5 08             	test   $0x8,%ch
+  80113c:	74 6a                	je     8011a8 <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80113e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801143:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801145:	83 ec 04             	sub    $0x4,%esp
+  801148:	6a 07                	push   $0x7
+  80114a:	68 00 f0 7f 00       	push   $0x7ff000
+  80114f:	6a 00                	push   $0x0
+  801151:	e8 9e fb ff ff       	call   800cf4 <sys_page_alloc>
+  801156:	83 c4 10             	add    $0x10,%esp
+  801159:	85 c0                	test   %eax,%eax
+  80115b:	78 61                	js     8011be <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  80115d:	83 ec 04             	sub    $0x4,%esp
+  801160:	68 00 10 00 00       	push   $0x1000
+  801165:	53                   	push   %ebx
+  801166:	68 00 f0 7f 00       	push   $0x7ff000
+  80116b:	e8 9d f8 ff ff       	call   800a0d <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  801170:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801177:	53                   	push   %ebx
+  801178:	6a 00                	push   $0x0
+  80117a:	68 00 f0 7f 00       	push   $0x7ff000
+  80117f:	6a 00                	push   $0x0
+  801181:	e8 f4 fb ff ff       	call   800d7a <sys_page_map>
+  801186:	83 c4 20             	add    $0x20,%esp
+  801189:	85 c0                	test   %eax,%eax
+  80118b:	78 43                	js     8011d0 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  80118d:	83 ec 08             	sub    $0x8,%esp
+  801190:	68 00 f0 7f 00       	push   $0x7ff000
+  801195:	6a 00                	push   $0x0
+  801197:	e8 20 fc ff ff       	call   800dbc <sys_page_unmap>
+  80119c:	83 c4 10             	add    $0x10,%esp
+  80119f:	85 c0                	test   %eax,%eax
+  8011a1:	78 3f                	js     8011e2 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  8011a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011a6:	c9                   	leave
+  8011a7:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  8011a8:	83 ec 0c             	sub    $0xc,%esp
+  8011ab:	50                   	push   %eax
+  8011ac:	52                   	push   %edx
+  8011ad:	68 aa 2f 80 00       	push   $0x802faa
+  8011b2:	6a 19                	push   $0x19
+  8011b4:	68 bb 2f 80 00       	push   $0x802fbb
+  8011b9:	e8 aa 14 00 00       	call   802668 <_panic>
+		panic("sys_page_alloc: %e", r);
+  8011be:	50                   	push   %eax
+  8011bf:	68 c6 2f 80 00       	push   $0x802fc6
+  8011c4:	6a 24                	push   $0x24
+  8011c6:	68 bb 2f 80 00       	push   $0x802fbb
+  8011cb:	e8 98 14 00 00       	call   802668 <_panic>
+		panic("sys_page_map: %e", r);
+  8011d0:	50                   	push   %eax
+  8011d1:	68 d9 2f 80 00       	push   $0x802fd9
+  8011d6:	6a 29                	push   $0x29
+  8011d8:	68 bb 2f 80 00       	push   $0x802fbb
+  8011dd:	e8 86 14 00 00       	call   802668 <_panic>
+		panic("sys_page_unmap: %e", r);
+  8011e2:	50                   	push   %eax
+  8011e3:	68 ea 2f 80 00       	push   $0x802fea
+  8011e8:	6a 2c                	push   $0x2c
+  8011ea:	68 bb 2f 80 00       	push   $0x802fbb
+  8011ef:	e8 74 14 00 00       	call   802668 <_panic>
+
+008011f4 <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  8011f4:	55                   	push   %ebp
+  8011f5:	89 e5                	mov    %esp,%ebp
+  8011f7:	57                   	push   %edi
+  8011f8:	56                   	push   %esi
+  8011f9:	53                   	push   %ebx
+  8011fa:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8011fd:	68 19 11 80 00       	push   $0x801119
+  801202:	e8 a7 14 00 00       	call   8026ae <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  801207:	83 c4 08             	add    $0x8,%esp
+  80120a:	6a 01                	push   $0x1
+  80120c:	6a 00                	push   $0x0
+  80120e:	e8 9f fa ff ff       	call   800cb2 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  801213:	e8 7b fa ff ff       	call   800c93 <sys_fork_cow>
+  801218:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  80121b:	83 c4 10             	add    $0x10,%esp
+  80121e:	85 c0                	test   %eax,%eax
+  801220:	74 2c                	je     80124e <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  801222:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  801226:	0f 85 8b 01 00 00    	jne    8013b7 <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80122c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801231:	cd 30                	int    $0x30
+  801233:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  801236:	85 c0                	test   %eax,%eax
+  801238:	78 30                	js     80126a <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  80123a:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80123f:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  801244:	74 36                	je     80127c <fork+0x88>
+  801246:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801249:	e9 99 00 00 00       	jmp    8012e7 <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80124e:	e8 02 fa ff ff       	call   800c55 <sys_getenvid>
+  801253:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801258:	c1 e0 09             	shl    $0x9,%eax
+  80125b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801260:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801265:	e9 4d 01 00 00       	jmp    8013b7 <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  80126a:	50                   	push   %eax
+  80126b:	68 fd 2f 80 00       	push   $0x802ffd
+  801270:	6a 7d                	push   $0x7d
+  801272:	68 bb 2f 80 00       	push   $0x802fbb
+  801277:	e8 ec 13 00 00       	call   802668 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80127c:	e8 d4 f9 ff ff       	call   800c55 <sys_getenvid>
+  801281:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801286:	c1 e0 09             	shl    $0x9,%eax
+  801289:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80128e:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801293:	e9 1f 01 00 00       	jmp    8013b7 <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  801298:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80129f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8012a2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8012aa:	83 ec 0c             	sub    $0xc,%esp
+  8012ad:	50                   	push   %eax
+  8012ae:	56                   	push   %esi
+  8012af:	ff 75 e4             	push   -0x1c(%ebp)
+  8012b2:	56                   	push   %esi
+  8012b3:	6a 00                	push   $0x0
+  8012b5:	e8 c0 fa ff ff       	call   800d7a <sys_page_map>
+  8012ba:	83 c4 20             	add    $0x20,%esp
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	0f 88 98 00 00 00    	js     80135d <fork+0x169>
+	if (perm & PTE_COW) {
+  8012c5:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  8012cc:	0f 85 61 01 00 00    	jne    801433 <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8012d2:	83 c7 01             	add    $0x1,%edi
+  8012d5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8012db:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  8012e1:	0f 84 88 00 00 00    	je     80136f <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  8012e7:	89 f0                	mov    %esi,%eax
+  8012e9:	c1 e8 16             	shr    $0x16,%eax
+  8012ec:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012f3:	25 81 00 00 00       	and    $0x81,%eax
+  8012f8:	83 f8 01             	cmp    $0x1,%eax
+  8012fb:	75 d5                	jne    8012d2 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  8012fd:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  801304:	a8 01                	test   $0x1,%al
+  801306:	74 ca                	je     8012d2 <fork+0xde>
+  801308:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  80130e:	74 c2                	je     8012d2 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  801310:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  801312:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801319:	f6 c4 04             	test   $0x4,%ah
+  80131c:	0f 85 76 ff ff ff    	jne    801298 <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  801322:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801329:	a8 02                	test   $0x2,%al
+  80132b:	0f 85 dc 00 00 00    	jne    80140d <fork+0x219>
+  801331:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801338:	f6 c4 08             	test   $0x8,%ah
+  80133b:	0f 85 cc 00 00 00    	jne    80140d <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801341:	83 ec 0c             	sub    $0xc,%esp
+  801344:	6a 05                	push   $0x5
+  801346:	56                   	push   %esi
+  801347:	ff 75 e4             	push   -0x1c(%ebp)
+  80134a:	56                   	push   %esi
+  80134b:	6a 00                	push   $0x0
+  80134d:	e8 28 fa ff ff       	call   800d7a <sys_page_map>
+  801352:	83 c4 20             	add    $0x20,%esp
+  801355:	85 c0                	test   %eax,%eax
+  801357:	0f 89 75 ff ff ff    	jns    8012d2 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  80135d:	50                   	push   %eax
+  80135e:	68 d9 2f 80 00       	push   $0x802fd9
+  801363:	6a 48                	push   $0x48
+  801365:	68 bb 2f 80 00       	push   $0x802fbb
+  80136a:	e8 f9 12 00 00       	call   802668 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  80136f:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  801372:	83 ec 04             	sub    $0x4,%esp
+  801375:	6a 07                	push   $0x7
+  801377:	68 00 f0 bf ee       	push   $0xeebff000
+  80137c:	53                   	push   %ebx
+  80137d:	e8 72 f9 ff ff       	call   800cf4 <sys_page_alloc>
+  801382:	83 c4 10             	add    $0x10,%esp
+  801385:	85 c0                	test   %eax,%eax
+  801387:	78 39                	js     8013c2 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801389:	a1 08 50 80 00       	mov    0x805008,%eax
+  80138e:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  801394:	83 ec 08             	sub    $0x8,%esp
+  801397:	50                   	push   %eax
+  801398:	53                   	push   %ebx
+  801399:	e8 51 fc ff ff       	call   800fef <sys_env_set_pgfault_upcall>
+  80139e:	83 c4 10             	add    $0x10,%esp
+  8013a1:	85 c0                	test   %eax,%eax
+  8013a3:	78 36                	js     8013db <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8013a5:	83 ec 08             	sub    $0x8,%esp
+  8013a8:	6a 02                	push   $0x2
+  8013aa:	53                   	push   %ebx
+  8013ab:	e8 18 fb ff ff       	call   800ec8 <sys_env_set_status>
+  8013b0:	83 c4 10             	add    $0x10,%esp
+  8013b3:	85 c0                	test   %eax,%eax
+  8013b5:	78 3d                	js     8013f4 <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  8013b7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bd:	5b                   	pop    %ebx
+  8013be:	5e                   	pop    %esi
+  8013bf:	5f                   	pop    %edi
+  8013c0:	5d                   	pop    %ebp
+  8013c1:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  8013c2:	83 ec 0c             	sub    $0xc,%esp
+  8013c5:	53                   	push   %ebx
+  8013c6:	50                   	push   %eax
+  8013c7:	68 24 30 80 00       	push   $0x803024
+  8013cc:	68 92 00 00 00       	push   $0x92
+  8013d1:	68 bb 2f 80 00       	push   $0x802fbb
+  8013d6:	e8 8d 12 00 00       	call   802668 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  8013db:	83 ec 0c             	sub    $0xc,%esp
+  8013de:	53                   	push   %ebx
+  8013df:	50                   	push   %eax
+  8013e0:	68 48 30 80 00       	push   $0x803048
+  8013e5:	68 95 00 00 00       	push   $0x95
+  8013ea:	68 bb 2f 80 00       	push   $0x802fbb
+  8013ef:	e8 74 12 00 00       	call   802668 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  8013f4:	83 ec 0c             	sub    $0xc,%esp
+  8013f7:	53                   	push   %ebx
+  8013f8:	50                   	push   %eax
+  8013f9:	68 78 30 80 00       	push   $0x803078
+  8013fe:	68 98 00 00 00       	push   $0x98
+  801403:	68 bb 2f 80 00       	push   $0x802fbb
+  801408:	e8 5b 12 00 00       	call   802668 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  80140d:	83 ec 0c             	sub    $0xc,%esp
+  801410:	68 05 08 00 00       	push   $0x805
+  801415:	53                   	push   %ebx
+  801416:	ff 75 e4             	push   -0x1c(%ebp)
+  801419:	53                   	push   %ebx
+  80141a:	6a 00                	push   $0x0
+  80141c:	e8 59 f9 ff ff       	call   800d7a <sys_page_map>
+  801421:	83 c4 20             	add    $0x20,%esp
+  801424:	85 c0                	test   %eax,%eax
+  801426:	0f 88 31 ff ff ff    	js     80135d <fork+0x169>
+		perm |= PTE_COW;
+  80142c:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  801433:	83 ec 0c             	sub    $0xc,%esp
+  801436:	ff 75 e0             	push   -0x20(%ebp)
+  801439:	53                   	push   %ebx
+  80143a:	6a 00                	push   $0x0
+  80143c:	53                   	push   %ebx
+  80143d:	6a 00                	push   $0x0
+  80143f:	e8 36 f9 ff ff       	call   800d7a <sys_page_map>
+  801444:	83 c4 20             	add    $0x20,%esp
+  801447:	85 c0                	test   %eax,%eax
+  801449:	0f 89 83 fe ff ff    	jns    8012d2 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  80144f:	50                   	push   %eax
+  801450:	68 d9 2f 80 00       	push   $0x802fd9
+  801455:	6a 4c                	push   $0x4c
+  801457:	68 bb 2f 80 00       	push   $0x802fbb
+  80145c:	e8 07 12 00 00       	call   802668 <_panic>
+
+00801461 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801461:	55                   	push   %ebp
+  801462:	89 e5                	mov    %esp,%ebp
+  801464:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801467:	68 0d 30 80 00       	push   $0x80300d
+  80146c:	68 a0 00 00 00       	push   $0xa0
+  801471:	68 bb 2f 80 00       	push   $0x802fbb
+  801476:	e8 ed 11 00 00       	call   802668 <_panic>
+
+0080147b <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80147b:	55                   	push   %ebp
+  80147c:	89 e5                	mov    %esp,%ebp
+  80147e:	57                   	push   %edi
+  80147f:	56                   	push   %esi
+  801480:	53                   	push   %ebx
+  801481:	83 ec 18             	sub    $0x18,%esp
+  801484:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801487:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80148a:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80148d:	85 db                	test   %ebx,%ebx
+  80148f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801494:	0f 45 c3             	cmovne %ebx,%eax
+  801497:	50                   	push   %eax
+  801498:	e8 da fb ff ff       	call   801077 <sys_ipc_recv>
+
+	if (from_env_store)
+  80149d:	83 c4 10             	add    $0x10,%esp
+  8014a0:	85 ff                	test   %edi,%edi
+  8014a2:	74 17                	je     8014bb <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8014a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a9:	85 c0                	test   %eax,%eax
+  8014ab:	75 0c                	jne    8014b9 <ipc_recv+0x3e>
+  8014ad:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8014b3:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8014b9:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8014bb:	85 f6                	test   %esi,%esi
+  8014bd:	74 2e                	je     8014ed <ipc_recv+0x72>
+		if (!r && pg)
+  8014bf:	85 c0                	test   %eax,%eax
+  8014c1:	75 24                	jne    8014e7 <ipc_recv+0x6c>
+  8014c3:	85 db                	test   %ebx,%ebx
+  8014c5:	74 20                	je     8014e7 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8014c7:	a1 08 50 80 00       	mov    0x805008,%eax
+  8014cc:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8014d2:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8014d4:	a1 08 50 80 00       	mov    0x805008,%eax
+  8014d9:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  8014df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e2:	5b                   	pop    %ebx
+  8014e3:	5e                   	pop    %esi
+  8014e4:	5f                   	pop    %edi
+  8014e5:	5d                   	pop    %ebp
+  8014e6:	c3                   	ret
+			*perm_store = 0;
+  8014e7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  8014ed:	85 c0                	test   %eax,%eax
+  8014ef:	75 ee                	jne    8014df <ipc_recv+0x64>
+  8014f1:	eb e1                	jmp    8014d4 <ipc_recv+0x59>
+
+008014f3 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8014f3:	55                   	push   %ebp
+  8014f4:	89 e5                	mov    %esp,%ebp
+  8014f6:	57                   	push   %edi
+  8014f7:	56                   	push   %esi
+  8014f8:	53                   	push   %ebx
+  8014f9:	83 ec 0c             	sub    $0xc,%esp
+  8014fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014ff:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801502:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  801505:	85 db                	test   %ebx,%ebx
+  801507:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80150c:	0f 44 d8             	cmove  %eax,%ebx
+  80150f:	ff 75 14             	push   0x14(%ebp)
+  801512:	53                   	push   %ebx
+  801513:	56                   	push   %esi
+  801514:	57                   	push   %edi
+  801515:	e8 3a fb ff ff       	call   801054 <sys_ipc_try_send_yield>
+  80151a:	83 c4 10             	add    $0x10,%esp
+  80151d:	85 c0                	test   %eax,%eax
+  80151f:	79 1e                	jns    80153f <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  801521:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801524:	75 07                	jne    80152d <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  801526:	e8 49 f7 ff ff       	call   800c74 <sys_yield>
+  80152b:	eb e2                	jmp    80150f <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  80152d:	50                   	push   %eax
+  80152e:	68 9e 30 80 00       	push   $0x80309e
+  801533:	6a 3d                	push   $0x3d
+  801535:	68 b3 30 80 00       	push   $0x8030b3
+  80153a:	e8 29 11 00 00       	call   802668 <_panic>
+	}
+}
+  80153f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801542:	5b                   	pop    %ebx
+  801543:	5e                   	pop    %esi
+  801544:	5f                   	pop    %edi
+  801545:	5d                   	pop    %ebp
+  801546:	c3                   	ret
+
+00801547 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801547:	55                   	push   %ebp
+  801548:	89 e5                	mov    %esp,%ebp
+  80154a:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  80154d:	ff 75 08             	push   0x8(%ebp)
+  801550:	e8 9f f6 ff ff       	call   800bf4 <sys_env_find>
+}
+  801555:	c9                   	leave
+  801556:	c3                   	ret
+
+00801557 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801557:	55                   	push   %ebp
+  801558:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80155a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80155d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801562:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801565:	5d                   	pop    %ebp
+  801566:	c3                   	ret
+
+00801567 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801567:	55                   	push   %ebp
+  801568:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80156a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80156d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801572:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801577:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80157c:	5d                   	pop    %ebp
+  80157d:	c3                   	ret
+
+0080157e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80157e:	55                   	push   %ebp
+  80157f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801581:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801586:	eb 02                	jmp    80158a <fd_alloc+0xc>
+  801588:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80158a:	89 c2                	mov    %eax,%edx
+  80158c:	c1 ea 16             	shr    $0x16,%edx
+  80158f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801596:	f6 c2 01             	test   $0x1,%dl
+  801599:	74 2b                	je     8015c6 <fd_alloc+0x48>
+  80159b:	89 c2                	mov    %eax,%edx
+  80159d:	c1 ea 0c             	shr    $0xc,%edx
+  8015a0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8015a7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8015ad:	f6 c1 01             	test   $0x1,%cl
+  8015b0:	74 14                	je     8015c6 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8015b2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8015b8:	75 ce                	jne    801588 <fd_alloc+0xa>
+  8015ba:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8015bf:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8015c4:	eb 05                	jmp    8015cb <fd_alloc+0x4d>
+			return 0;
+  8015c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8015cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ce:	89 02                	mov    %eax,(%edx)
+}
+  8015d0:	89 c8                	mov    %ecx,%eax
+  8015d2:	5d                   	pop    %ebp
+  8015d3:	c3                   	ret
+
+008015d4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8015d4:	55                   	push   %ebp
+  8015d5:	89 e5                	mov    %esp,%ebp
+  8015d7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8015da:	83 f8 1f             	cmp    $0x1f,%eax
+  8015dd:	77 30                	ja     80160f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8015df:	c1 e0 0c             	shl    $0xc,%eax
+  8015e2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8015e7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015ed:	f6 c2 01             	test   $0x1,%dl
+  8015f0:	74 24                	je     801616 <fd_lookup+0x42>
+  8015f2:	89 c2                	mov    %eax,%edx
+  8015f4:	c1 ea 0c             	shr    $0xc,%edx
+  8015f7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015fe:	f6 c2 01             	test   $0x1,%dl
+  801601:	74 1a                	je     80161d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801603:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801606:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801608:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80160d:	5d                   	pop    %ebp
+  80160e:	c3                   	ret
+		return -E_INVAL;
+  80160f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801614:	eb f7                	jmp    80160d <fd_lookup+0x39>
+		return -E_INVAL;
+  801616:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80161b:	eb f0                	jmp    80160d <fd_lookup+0x39>
+  80161d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801622:	eb e9                	jmp    80160d <fd_lookup+0x39>
+
+00801624 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801624:	55                   	push   %ebp
+  801625:	89 e5                	mov    %esp,%ebp
+  801627:	53                   	push   %ebx
+  801628:	83 ec 04             	sub    $0x4,%esp
+  80162b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80162e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801633:	eb 03                	jmp    801638 <dev_lookup+0x14>
+  801635:	83 c0 01             	add    $0x1,%eax
+  801638:	8b 1c 85 3c 31 80 00 	mov    0x80313c(,%eax,4),%ebx
+  80163f:	85 db                	test   %ebx,%ebx
+  801641:	74 0b                	je     80164e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801643:	39 13                	cmp    %edx,(%ebx)
+  801645:	75 ee                	jne    801635 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801647:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164c:	eb 1f                	jmp    80166d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80164e:	a1 08 50 80 00       	mov    0x805008,%eax
+  801653:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801656:	83 ec 04             	sub    $0x4,%esp
+  801659:	52                   	push   %edx
+  80165a:	50                   	push   %eax
+  80165b:	68 c0 30 80 00       	push   $0x8030c0
+  801660:	e8 34 ec ff ff       	call   800299 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801665:	83 c4 10             	add    $0x10,%esp
+  801668:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80166d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801670:	89 1a                	mov    %ebx,(%edx)
+}
+  801672:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801675:	c9                   	leave
+  801676:	c3                   	ret
+
+00801677 <fd_close>:
+{
+  801677:	55                   	push   %ebp
+  801678:	89 e5                	mov    %esp,%ebp
+  80167a:	57                   	push   %edi
+  80167b:	56                   	push   %esi
+  80167c:	53                   	push   %ebx
+  80167d:	83 ec 24             	sub    $0x24,%esp
+  801680:	8b 75 08             	mov    0x8(%ebp),%esi
+  801683:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801686:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801689:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80168a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801690:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801693:	50                   	push   %eax
+  801694:	e8 3b ff ff ff       	call   8015d4 <fd_lookup>
+  801699:	89 c3                	mov    %eax,%ebx
+  80169b:	83 c4 10             	add    $0x10,%esp
+  80169e:	85 c0                	test   %eax,%eax
+  8016a0:	78 05                	js     8016a7 <fd_close+0x30>
+	    || fd != fd2)
+  8016a2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8016a5:	74 16                	je     8016bd <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8016a7:	89 f8                	mov    %edi,%eax
+  8016a9:	84 c0                	test   %al,%al
+  8016ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8016b3:	89 d8                	mov    %ebx,%eax
+  8016b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b8:	5b                   	pop    %ebx
+  8016b9:	5e                   	pop    %esi
+  8016ba:	5f                   	pop    %edi
+  8016bb:	5d                   	pop    %ebp
+  8016bc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016bd:	83 ec 08             	sub    $0x8,%esp
+  8016c0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8016c3:	50                   	push   %eax
+  8016c4:	ff 36                	push   (%esi)
+  8016c6:	e8 59 ff ff ff       	call   801624 <dev_lookup>
+  8016cb:	89 c3                	mov    %eax,%ebx
+  8016cd:	83 c4 10             	add    $0x10,%esp
+  8016d0:	85 c0                	test   %eax,%eax
+  8016d2:	78 1a                	js     8016ee <fd_close+0x77>
+		if (dev->dev_close)
+  8016d4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016d7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8016da:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	74 0b                	je     8016ee <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8016e3:	83 ec 0c             	sub    $0xc,%esp
+  8016e6:	56                   	push   %esi
+  8016e7:	ff d0                	call   *%eax
+  8016e9:	89 c3                	mov    %eax,%ebx
+  8016eb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8016ee:	83 ec 08             	sub    $0x8,%esp
+  8016f1:	56                   	push   %esi
+  8016f2:	6a 00                	push   $0x0
+  8016f4:	e8 c3 f6 ff ff       	call   800dbc <sys_page_unmap>
+	return r;
+  8016f9:	83 c4 10             	add    $0x10,%esp
+  8016fc:	eb b5                	jmp    8016b3 <fd_close+0x3c>
+
+008016fe <close>:
+
+int
+close(int fdnum)
+{
+  8016fe:	55                   	push   %ebp
+  8016ff:	89 e5                	mov    %esp,%ebp
+  801701:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801704:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801707:	50                   	push   %eax
+  801708:	ff 75 08             	push   0x8(%ebp)
+  80170b:	e8 c4 fe ff ff       	call   8015d4 <fd_lookup>
+  801710:	83 c4 10             	add    $0x10,%esp
+  801713:	85 c0                	test   %eax,%eax
+  801715:	79 02                	jns    801719 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801717:	c9                   	leave
+  801718:	c3                   	ret
+		return fd_close(fd, 1);
+  801719:	83 ec 08             	sub    $0x8,%esp
+  80171c:	6a 01                	push   $0x1
+  80171e:	ff 75 f4             	push   -0xc(%ebp)
+  801721:	e8 51 ff ff ff       	call   801677 <fd_close>
+  801726:	83 c4 10             	add    $0x10,%esp
+  801729:	eb ec                	jmp    801717 <close+0x19>
+
+0080172b <close_all>:
+
+void
+close_all(void)
+{
+  80172b:	55                   	push   %ebp
+  80172c:	89 e5                	mov    %esp,%ebp
+  80172e:	53                   	push   %ebx
+  80172f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801732:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801737:	83 ec 0c             	sub    $0xc,%esp
+  80173a:	53                   	push   %ebx
+  80173b:	e8 be ff ff ff       	call   8016fe <close>
+	for (i = 0; i < MAXFD; i++)
+  801740:	83 c3 01             	add    $0x1,%ebx
+  801743:	83 c4 10             	add    $0x10,%esp
+  801746:	83 fb 20             	cmp    $0x20,%ebx
+  801749:	75 ec                	jne    801737 <close_all+0xc>
+}
+  80174b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80174e:	c9                   	leave
+  80174f:	c3                   	ret
+
+00801750 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801750:	55                   	push   %ebp
+  801751:	89 e5                	mov    %esp,%ebp
+  801753:	57                   	push   %edi
+  801754:	56                   	push   %esi
+  801755:	53                   	push   %ebx
+  801756:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801759:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80175c:	50                   	push   %eax
+  80175d:	ff 75 08             	push   0x8(%ebp)
+  801760:	e8 6f fe ff ff       	call   8015d4 <fd_lookup>
+  801765:	89 c3                	mov    %eax,%ebx
+  801767:	83 c4 10             	add    $0x10,%esp
+  80176a:	85 c0                	test   %eax,%eax
+  80176c:	78 7f                	js     8017ed <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80176e:	83 ec 0c             	sub    $0xc,%esp
+  801771:	ff 75 0c             	push   0xc(%ebp)
+  801774:	e8 85 ff ff ff       	call   8016fe <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801779:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80177c:	c1 e6 0c             	shl    $0xc,%esi
+  80177f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801785:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801788:	89 3c 24             	mov    %edi,(%esp)
+  80178b:	e8 d7 fd ff ff       	call   801567 <fd2data>
+  801790:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801792:	89 34 24             	mov    %esi,(%esp)
+  801795:	e8 cd fd ff ff       	call   801567 <fd2data>
+  80179a:	83 c4 10             	add    $0x10,%esp
+  80179d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8017a0:	89 d8                	mov    %ebx,%eax
+  8017a2:	c1 e8 16             	shr    $0x16,%eax
+  8017a5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8017ac:	a8 01                	test   $0x1,%al
+  8017ae:	74 11                	je     8017c1 <dup+0x71>
+  8017b0:	89 d8                	mov    %ebx,%eax
+  8017b2:	c1 e8 0c             	shr    $0xc,%eax
+  8017b5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017bc:	f6 c2 01             	test   $0x1,%dl
+  8017bf:	75 36                	jne    8017f7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8017c1:	89 f8                	mov    %edi,%eax
+  8017c3:	c1 e8 0c             	shr    $0xc,%eax
+  8017c6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017cd:	83 ec 0c             	sub    $0xc,%esp
+  8017d0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017d5:	50                   	push   %eax
+  8017d6:	56                   	push   %esi
+  8017d7:	6a 00                	push   $0x0
+  8017d9:	57                   	push   %edi
+  8017da:	6a 00                	push   $0x0
+  8017dc:	e8 99 f5 ff ff       	call   800d7a <sys_page_map>
+  8017e1:	89 c3                	mov    %eax,%ebx
+  8017e3:	83 c4 20             	add    $0x20,%esp
+  8017e6:	85 c0                	test   %eax,%eax
+  8017e8:	78 33                	js     80181d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8017ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8017ed:	89 d8                	mov    %ebx,%eax
+  8017ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f2:	5b                   	pop    %ebx
+  8017f3:	5e                   	pop    %esi
+  8017f4:	5f                   	pop    %edi
+  8017f5:	5d                   	pop    %ebp
+  8017f6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8017f7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017fe:	83 ec 0c             	sub    $0xc,%esp
+  801801:	25 07 0e 00 00       	and    $0xe07,%eax
+  801806:	50                   	push   %eax
+  801807:	ff 75 d4             	push   -0x2c(%ebp)
+  80180a:	6a 00                	push   $0x0
+  80180c:	53                   	push   %ebx
+  80180d:	6a 00                	push   $0x0
+  80180f:	e8 66 f5 ff ff       	call   800d7a <sys_page_map>
+  801814:	89 c3                	mov    %eax,%ebx
+  801816:	83 c4 20             	add    $0x20,%esp
+  801819:	85 c0                	test   %eax,%eax
+  80181b:	79 a4                	jns    8017c1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80181d:	83 ec 08             	sub    $0x8,%esp
+  801820:	56                   	push   %esi
+  801821:	6a 00                	push   $0x0
+  801823:	e8 94 f5 ff ff       	call   800dbc <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801828:	83 c4 08             	add    $0x8,%esp
+  80182b:	ff 75 d4             	push   -0x2c(%ebp)
+  80182e:	6a 00                	push   $0x0
+  801830:	e8 87 f5 ff ff       	call   800dbc <sys_page_unmap>
+	return r;
+  801835:	83 c4 10             	add    $0x10,%esp
+  801838:	eb b3                	jmp    8017ed <dup+0x9d>
+
+0080183a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80183a:	55                   	push   %ebp
+  80183b:	89 e5                	mov    %esp,%ebp
+  80183d:	56                   	push   %esi
+  80183e:	53                   	push   %ebx
+  80183f:	83 ec 18             	sub    $0x18,%esp
+  801842:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801845:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801848:	50                   	push   %eax
+  801849:	56                   	push   %esi
+  80184a:	e8 85 fd ff ff       	call   8015d4 <fd_lookup>
+  80184f:	83 c4 10             	add    $0x10,%esp
+  801852:	85 c0                	test   %eax,%eax
+  801854:	78 3c                	js     801892 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801856:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801859:	83 ec 08             	sub    $0x8,%esp
+  80185c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80185f:	50                   	push   %eax
+  801860:	ff 33                	push   (%ebx)
+  801862:	e8 bd fd ff ff       	call   801624 <dev_lookup>
+  801867:	83 c4 10             	add    $0x10,%esp
+  80186a:	85 c0                	test   %eax,%eax
+  80186c:	78 24                	js     801892 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80186e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801871:	83 e0 03             	and    $0x3,%eax
+  801874:	83 f8 01             	cmp    $0x1,%eax
+  801877:	74 20                	je     801899 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801879:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80187c:	8b 40 08             	mov    0x8(%eax),%eax
+  80187f:	85 c0                	test   %eax,%eax
+  801881:	74 37                	je     8018ba <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801883:	83 ec 04             	sub    $0x4,%esp
+  801886:	ff 75 10             	push   0x10(%ebp)
+  801889:	ff 75 0c             	push   0xc(%ebp)
+  80188c:	53                   	push   %ebx
+  80188d:	ff d0                	call   *%eax
+  80188f:	83 c4 10             	add    $0x10,%esp
+}
+  801892:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801895:	5b                   	pop    %ebx
+  801896:	5e                   	pop    %esi
+  801897:	5d                   	pop    %ebp
+  801898:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801899:	a1 08 50 80 00       	mov    0x805008,%eax
+  80189e:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8018a1:	83 ec 04             	sub    $0x4,%esp
+  8018a4:	56                   	push   %esi
+  8018a5:	50                   	push   %eax
+  8018a6:	68 01 31 80 00       	push   $0x803101
+  8018ab:	e8 e9 e9 ff ff       	call   800299 <cprintf>
+		return -E_INVAL;
+  8018b0:	83 c4 10             	add    $0x10,%esp
+  8018b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b8:	eb d8                	jmp    801892 <read+0x58>
+		return -E_NOT_SUPP;
+  8018ba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018bf:	eb d1                	jmp    801892 <read+0x58>
+
+008018c1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8018c1:	55                   	push   %ebp
+  8018c2:	89 e5                	mov    %esp,%ebp
+  8018c4:	57                   	push   %edi
+  8018c5:	56                   	push   %esi
+  8018c6:	53                   	push   %ebx
+  8018c7:	83 ec 0c             	sub    $0xc,%esp
+  8018ca:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8018cd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8018d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d5:	eb 02                	jmp    8018d9 <readn+0x18>
+  8018d7:	01 c3                	add    %eax,%ebx
+  8018d9:	39 f3                	cmp    %esi,%ebx
+  8018db:	73 21                	jae    8018fe <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018dd:	83 ec 04             	sub    $0x4,%esp
+  8018e0:	89 f0                	mov    %esi,%eax
+  8018e2:	29 d8                	sub    %ebx,%eax
+  8018e4:	50                   	push   %eax
+  8018e5:	89 d8                	mov    %ebx,%eax
+  8018e7:	03 45 0c             	add    0xc(%ebp),%eax
+  8018ea:	50                   	push   %eax
+  8018eb:	57                   	push   %edi
+  8018ec:	e8 49 ff ff ff       	call   80183a <read>
+		if (m < 0)
+  8018f1:	83 c4 10             	add    $0x10,%esp
+  8018f4:	85 c0                	test   %eax,%eax
+  8018f6:	78 04                	js     8018fc <readn+0x3b>
+			return m;
+		if (m == 0)
+  8018f8:	75 dd                	jne    8018d7 <readn+0x16>
+  8018fa:	eb 02                	jmp    8018fe <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018fc:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8018fe:	89 d8                	mov    %ebx,%eax
+  801900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801903:	5b                   	pop    %ebx
+  801904:	5e                   	pop    %esi
+  801905:	5f                   	pop    %edi
+  801906:	5d                   	pop    %ebp
+  801907:	c3                   	ret
+
+00801908 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801908:	55                   	push   %ebp
+  801909:	89 e5                	mov    %esp,%ebp
+  80190b:	56                   	push   %esi
+  80190c:	53                   	push   %ebx
+  80190d:	83 ec 18             	sub    $0x18,%esp
+  801910:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801913:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801916:	50                   	push   %eax
+  801917:	53                   	push   %ebx
+  801918:	e8 b7 fc ff ff       	call   8015d4 <fd_lookup>
+  80191d:	83 c4 10             	add    $0x10,%esp
+  801920:	85 c0                	test   %eax,%eax
+  801922:	78 37                	js     80195b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801924:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801927:	83 ec 08             	sub    $0x8,%esp
+  80192a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80192d:	50                   	push   %eax
+  80192e:	ff 36                	push   (%esi)
+  801930:	e8 ef fc ff ff       	call   801624 <dev_lookup>
+  801935:	83 c4 10             	add    $0x10,%esp
+  801938:	85 c0                	test   %eax,%eax
+  80193a:	78 1f                	js     80195b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80193c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801940:	74 20                	je     801962 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801942:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801945:	8b 40 0c             	mov    0xc(%eax),%eax
+  801948:	85 c0                	test   %eax,%eax
+  80194a:	74 37                	je     801983 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80194c:	83 ec 04             	sub    $0x4,%esp
+  80194f:	ff 75 10             	push   0x10(%ebp)
+  801952:	ff 75 0c             	push   0xc(%ebp)
+  801955:	56                   	push   %esi
+  801956:	ff d0                	call   *%eax
+  801958:	83 c4 10             	add    $0x10,%esp
+}
+  80195b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80195e:	5b                   	pop    %ebx
+  80195f:	5e                   	pop    %esi
+  801960:	5d                   	pop    %ebp
+  801961:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801962:	a1 08 50 80 00       	mov    0x805008,%eax
+  801967:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80196a:	83 ec 04             	sub    $0x4,%esp
+  80196d:	53                   	push   %ebx
+  80196e:	50                   	push   %eax
+  80196f:	68 1d 31 80 00       	push   $0x80311d
+  801974:	e8 20 e9 ff ff       	call   800299 <cprintf>
+		return -E_INVAL;
+  801979:	83 c4 10             	add    $0x10,%esp
+  80197c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801981:	eb d8                	jmp    80195b <write+0x53>
+		return -E_NOT_SUPP;
+  801983:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801988:	eb d1                	jmp    80195b <write+0x53>
+
+0080198a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80198a:	55                   	push   %ebp
+  80198b:	89 e5                	mov    %esp,%ebp
+  80198d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801990:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801993:	50                   	push   %eax
+  801994:	ff 75 08             	push   0x8(%ebp)
+  801997:	e8 38 fc ff ff       	call   8015d4 <fd_lookup>
+  80199c:	83 c4 10             	add    $0x10,%esp
+  80199f:	85 c0                	test   %eax,%eax
+  8019a1:	78 0e                	js     8019b1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8019a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019a9:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8019ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019b1:	c9                   	leave
+  8019b2:	c3                   	ret
+
+008019b3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019b3:	55                   	push   %ebp
+  8019b4:	89 e5                	mov    %esp,%ebp
+  8019b6:	56                   	push   %esi
+  8019b7:	53                   	push   %ebx
+  8019b8:	83 ec 18             	sub    $0x18,%esp
+  8019bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019be:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019c1:	50                   	push   %eax
+  8019c2:	53                   	push   %ebx
+  8019c3:	e8 0c fc ff ff       	call   8015d4 <fd_lookup>
+  8019c8:	83 c4 10             	add    $0x10,%esp
+  8019cb:	85 c0                	test   %eax,%eax
+  8019cd:	78 34                	js     801a03 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019cf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019d2:	83 ec 08             	sub    $0x8,%esp
+  8019d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019d8:	50                   	push   %eax
+  8019d9:	ff 36                	push   (%esi)
+  8019db:	e8 44 fc ff ff       	call   801624 <dev_lookup>
+  8019e0:	83 c4 10             	add    $0x10,%esp
+  8019e3:	85 c0                	test   %eax,%eax
+  8019e5:	78 1c                	js     801a03 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019e7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019eb:	74 1d                	je     801a0a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8019ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019f0:	8b 40 18             	mov    0x18(%eax),%eax
+  8019f3:	85 c0                	test   %eax,%eax
+  8019f5:	74 34                	je     801a2b <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8019f7:	83 ec 08             	sub    $0x8,%esp
+  8019fa:	ff 75 0c             	push   0xc(%ebp)
+  8019fd:	56                   	push   %esi
+  8019fe:	ff d0                	call   *%eax
+  801a00:	83 c4 10             	add    $0x10,%esp
+}
+  801a03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a06:	5b                   	pop    %ebx
+  801a07:	5e                   	pop    %esi
+  801a08:	5d                   	pop    %ebp
+  801a09:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801a0a:	a1 08 50 80 00       	mov    0x805008,%eax
+  801a0f:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a12:	83 ec 04             	sub    $0x4,%esp
+  801a15:	53                   	push   %ebx
+  801a16:	50                   	push   %eax
+  801a17:	68 e0 30 80 00       	push   $0x8030e0
+  801a1c:	e8 78 e8 ff ff       	call   800299 <cprintf>
+		return -E_INVAL;
+  801a21:	83 c4 10             	add    $0x10,%esp
+  801a24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a29:	eb d8                	jmp    801a03 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a2b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a30:	eb d1                	jmp    801a03 <ftruncate+0x50>
+
+00801a32 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a32:	55                   	push   %ebp
+  801a33:	89 e5                	mov    %esp,%ebp
+  801a35:	56                   	push   %esi
+  801a36:	53                   	push   %ebx
+  801a37:	83 ec 18             	sub    $0x18,%esp
+  801a3a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a3d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a40:	50                   	push   %eax
+  801a41:	ff 75 08             	push   0x8(%ebp)
+  801a44:	e8 8b fb ff ff       	call   8015d4 <fd_lookup>
+  801a49:	83 c4 10             	add    $0x10,%esp
+  801a4c:	85 c0                	test   %eax,%eax
+  801a4e:	78 49                	js     801a99 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a50:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a53:	83 ec 08             	sub    $0x8,%esp
+  801a56:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a59:	50                   	push   %eax
+  801a5a:	ff 36                	push   (%esi)
+  801a5c:	e8 c3 fb ff ff       	call   801624 <dev_lookup>
+  801a61:	83 c4 10             	add    $0x10,%esp
+  801a64:	85 c0                	test   %eax,%eax
+  801a66:	78 31                	js     801a99 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a6b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a6f:	74 2f                	je     801aa0 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a71:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a74:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a7b:	00 00 00 
+	stat->st_isdir = 0;
+  801a7e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a85:	00 00 00 
+	stat->st_dev = dev;
+  801a88:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a8e:	83 ec 08             	sub    $0x8,%esp
+  801a91:	53                   	push   %ebx
+  801a92:	56                   	push   %esi
+  801a93:	ff 50 14             	call   *0x14(%eax)
+  801a96:	83 c4 10             	add    $0x10,%esp
+}
+  801a99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a9c:	5b                   	pop    %ebx
+  801a9d:	5e                   	pop    %esi
+  801a9e:	5d                   	pop    %ebp
+  801a9f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801aa0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aa5:	eb f2                	jmp    801a99 <fstat+0x67>
+
+00801aa7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801aa7:	55                   	push   %ebp
+  801aa8:	89 e5                	mov    %esp,%ebp
+  801aaa:	56                   	push   %esi
+  801aab:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801aac:	83 ec 08             	sub    $0x8,%esp
+  801aaf:	6a 00                	push   $0x0
+  801ab1:	ff 75 08             	push   0x8(%ebp)
+  801ab4:	e8 e4 01 00 00       	call   801c9d <open>
+  801ab9:	89 c3                	mov    %eax,%ebx
+  801abb:	83 c4 10             	add    $0x10,%esp
+  801abe:	85 c0                	test   %eax,%eax
+  801ac0:	78 1b                	js     801add <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801ac2:	83 ec 08             	sub    $0x8,%esp
+  801ac5:	ff 75 0c             	push   0xc(%ebp)
+  801ac8:	50                   	push   %eax
+  801ac9:	e8 64 ff ff ff       	call   801a32 <fstat>
+  801ace:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ad0:	89 1c 24             	mov    %ebx,(%esp)
+  801ad3:	e8 26 fc ff ff       	call   8016fe <close>
+	return r;
+  801ad8:	83 c4 10             	add    $0x10,%esp
+  801adb:	89 f3                	mov    %esi,%ebx
+}
+  801add:	89 d8                	mov    %ebx,%eax
+  801adf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae2:	5b                   	pop    %ebx
+  801ae3:	5e                   	pop    %esi
+  801ae4:	5d                   	pop    %ebp
+  801ae5:	c3                   	ret
+
+00801ae6 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ae6:	55                   	push   %ebp
+  801ae7:	89 e5                	mov    %esp,%ebp
+  801ae9:	56                   	push   %esi
+  801aea:	53                   	push   %ebx
+  801aeb:	89 c6                	mov    %eax,%esi
+  801aed:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801aef:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801af6:	74 27                	je     801b1f <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801af8:	6a 07                	push   $0x7
+  801afa:	68 00 60 80 00       	push   $0x806000
+  801aff:	56                   	push   %esi
+  801b00:	ff 35 00 50 80 00    	push   0x805000
+  801b06:	e8 e8 f9 ff ff       	call   8014f3 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801b0b:	83 c4 0c             	add    $0xc,%esp
+  801b0e:	6a 00                	push   $0x0
+  801b10:	53                   	push   %ebx
+  801b11:	6a 00                	push   $0x0
+  801b13:	e8 63 f9 ff ff       	call   80147b <ipc_recv>
+}
+  801b18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b1b:	5b                   	pop    %ebx
+  801b1c:	5e                   	pop    %esi
+  801b1d:	5d                   	pop    %ebp
+  801b1e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b1f:	83 ec 0c             	sub    $0xc,%esp
+  801b22:	6a 01                	push   $0x1
+  801b24:	e8 1e fa ff ff       	call   801547 <ipc_find_env>
+  801b29:	a3 00 50 80 00       	mov    %eax,0x805000
+  801b2e:	83 c4 10             	add    $0x10,%esp
+  801b31:	eb c5                	jmp    801af8 <fsipc+0x12>
+
+00801b33 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801b33:	55                   	push   %ebp
+  801b34:	89 e5                	mov    %esp,%ebp
+  801b36:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b39:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b3c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b3f:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801b44:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b47:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801b4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b51:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b56:	e8 8b ff ff ff       	call   801ae6 <fsipc>
+}
+  801b5b:	c9                   	leave
+  801b5c:	c3                   	ret
+
+00801b5d <devfile_flush>:
+{
+  801b5d:	55                   	push   %ebp
+  801b5e:	89 e5                	mov    %esp,%ebp
+  801b60:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b63:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b66:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b69:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801b6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b73:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b78:	e8 69 ff ff ff       	call   801ae6 <fsipc>
+}
+  801b7d:	c9                   	leave
+  801b7e:	c3                   	ret
+
+00801b7f <devfile_stat>:
+{
+  801b7f:	55                   	push   %ebp
+  801b80:	89 e5                	mov    %esp,%ebp
+  801b82:	53                   	push   %ebx
+  801b83:	83 ec 04             	sub    $0x4,%esp
+  801b86:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b89:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b8c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b8f:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b94:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b99:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b9e:	e8 43 ff ff ff       	call   801ae6 <fsipc>
+  801ba3:	85 c0                	test   %eax,%eax
+  801ba5:	78 2c                	js     801bd3 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ba7:	83 ec 08             	sub    $0x8,%esp
+  801baa:	68 00 60 80 00       	push   $0x806000
+  801baf:	53                   	push   %ebx
+  801bb0:	e8 d2 ec ff ff       	call   800887 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801bb5:	a1 80 60 80 00       	mov    0x806080,%eax
+  801bba:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801bc0:	a1 84 60 80 00       	mov    0x806084,%eax
+  801bc5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801bcb:	83 c4 10             	add    $0x10,%esp
+  801bce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bd3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd6:	c9                   	leave
+  801bd7:	c3                   	ret
+
+00801bd8 <devfile_write>:
+{
+  801bd8:	55                   	push   %ebp
+  801bd9:	89 e5                	mov    %esp,%ebp
+  801bdb:	83 ec 0c             	sub    $0xc,%esp
+  801bde:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801be1:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801be6:	39 d0                	cmp    %edx,%eax
+  801be8:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801beb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bee:	8b 52 0c             	mov    0xc(%edx),%edx
+  801bf1:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801bf7:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801bfc:	50                   	push   %eax
+  801bfd:	ff 75 0c             	push   0xc(%ebp)
+  801c00:	68 08 60 80 00       	push   $0x806008
+  801c05:	e8 03 ee ff ff       	call   800a0d <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801c0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c14:	e8 cd fe ff ff       	call   801ae6 <fsipc>
+}
+  801c19:	c9                   	leave
+  801c1a:	c3                   	ret
+
+00801c1b <devfile_read>:
+{
+  801c1b:	55                   	push   %ebp
+  801c1c:	89 e5                	mov    %esp,%ebp
+  801c1e:	56                   	push   %esi
+  801c1f:	53                   	push   %ebx
+  801c20:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c23:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c26:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c29:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801c2e:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c39:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c3e:	e8 a3 fe ff ff       	call   801ae6 <fsipc>
+  801c43:	89 c3                	mov    %eax,%ebx
+  801c45:	85 c0                	test   %eax,%eax
+  801c47:	78 1f                	js     801c68 <devfile_read+0x4d>
+	assert(r <= n);
+  801c49:	39 c6                	cmp    %eax,%esi
+  801c4b:	72 24                	jb     801c71 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801c4d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c52:	7f 33                	jg     801c87 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c54:	83 ec 04             	sub    $0x4,%esp
+  801c57:	50                   	push   %eax
+  801c58:	68 00 60 80 00       	push   $0x806000
+  801c5d:	ff 75 0c             	push   0xc(%ebp)
+  801c60:	e8 a8 ed ff ff       	call   800a0d <memmove>
+	return r;
+  801c65:	83 c4 10             	add    $0x10,%esp
+}
+  801c68:	89 d8                	mov    %ebx,%eax
+  801c6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c6d:	5b                   	pop    %ebx
+  801c6e:	5e                   	pop    %esi
+  801c6f:	5d                   	pop    %ebp
+  801c70:	c3                   	ret
+	assert(r <= n);
+  801c71:	68 50 31 80 00       	push   $0x803150
+  801c76:	68 57 31 80 00       	push   $0x803157
+  801c7b:	6a 7c                	push   $0x7c
+  801c7d:	68 6c 31 80 00       	push   $0x80316c
+  801c82:	e8 e1 09 00 00       	call   802668 <_panic>
+	assert(r <= PGSIZE);
+  801c87:	68 77 31 80 00       	push   $0x803177
+  801c8c:	68 57 31 80 00       	push   $0x803157
+  801c91:	6a 7d                	push   $0x7d
+  801c93:	68 6c 31 80 00       	push   $0x80316c
+  801c98:	e8 cb 09 00 00       	call   802668 <_panic>
+
+00801c9d <open>:
+{
+  801c9d:	55                   	push   %ebp
+  801c9e:	89 e5                	mov    %esp,%ebp
+  801ca0:	56                   	push   %esi
+  801ca1:	53                   	push   %ebx
+  801ca2:	83 ec 1c             	sub    $0x1c,%esp
+  801ca5:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ca8:	56                   	push   %esi
+  801ca9:	e8 9e eb ff ff       	call   80084c <strlen>
+  801cae:	83 c4 10             	add    $0x10,%esp
+  801cb1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cb6:	7f 6c                	jg     801d24 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801cb8:	83 ec 0c             	sub    $0xc,%esp
+  801cbb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cbe:	50                   	push   %eax
+  801cbf:	e8 ba f8 ff ff       	call   80157e <fd_alloc>
+  801cc4:	89 c3                	mov    %eax,%ebx
+  801cc6:	83 c4 10             	add    $0x10,%esp
+  801cc9:	85 c0                	test   %eax,%eax
+  801ccb:	78 3c                	js     801d09 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801ccd:	83 ec 08             	sub    $0x8,%esp
+  801cd0:	56                   	push   %esi
+  801cd1:	68 00 60 80 00       	push   $0x806000
+  801cd6:	e8 ac eb ff ff       	call   800887 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801cdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cde:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ce3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ce6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ceb:	e8 f6 fd ff ff       	call   801ae6 <fsipc>
+  801cf0:	89 c3                	mov    %eax,%ebx
+  801cf2:	83 c4 10             	add    $0x10,%esp
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	78 19                	js     801d12 <open+0x75>
+	return fd2num(fd);
+  801cf9:	83 ec 0c             	sub    $0xc,%esp
+  801cfc:	ff 75 f4             	push   -0xc(%ebp)
+  801cff:	e8 53 f8 ff ff       	call   801557 <fd2num>
+  801d04:	89 c3                	mov    %eax,%ebx
+  801d06:	83 c4 10             	add    $0x10,%esp
+}
+  801d09:	89 d8                	mov    %ebx,%eax
+  801d0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d0e:	5b                   	pop    %ebx
+  801d0f:	5e                   	pop    %esi
+  801d10:	5d                   	pop    %ebp
+  801d11:	c3                   	ret
+		fd_close(fd, 0);
+  801d12:	83 ec 08             	sub    $0x8,%esp
+  801d15:	6a 00                	push   $0x0
+  801d17:	ff 75 f4             	push   -0xc(%ebp)
+  801d1a:	e8 58 f9 ff ff       	call   801677 <fd_close>
+		return r;
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	eb e5                	jmp    801d09 <open+0x6c>
+		return -E_BAD_PATH;
+  801d24:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d29:	eb de                	jmp    801d09 <open+0x6c>
+
+00801d2b <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801d2b:	55                   	push   %ebp
+  801d2c:	89 e5                	mov    %esp,%ebp
+  801d2e:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801d31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d36:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d3b:	e8 a6 fd ff ff       	call   801ae6 <fsipc>
+}
+  801d40:	c9                   	leave
+  801d41:	c3                   	ret
+
+00801d42 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d42:	55                   	push   %ebp
+  801d43:	89 e5                	mov    %esp,%ebp
+  801d45:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801d48:	68 83 31 80 00       	push   $0x803183
+  801d4d:	ff 75 0c             	push   0xc(%ebp)
+  801d50:	e8 32 eb ff ff       	call   800887 <strcpy>
+	return 0;
+}
+  801d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5a:	c9                   	leave
+  801d5b:	c3                   	ret
+
+00801d5c <devsock_close>:
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	53                   	push   %ebx
+  801d60:	83 ec 10             	sub    $0x10,%esp
+  801d63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801d66:	53                   	push   %ebx
+  801d67:	e8 d3 09 00 00       	call   80273f <pageref>
+  801d6c:	89 c2                	mov    %eax,%edx
+  801d6e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d71:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801d76:	83 fa 01             	cmp    $0x1,%edx
+  801d79:	74 05                	je     801d80 <devsock_close+0x24>
+}
+  801d7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d7e:	c9                   	leave
+  801d7f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801d80:	83 ec 0c             	sub    $0xc,%esp
+  801d83:	ff 73 0c             	push   0xc(%ebx)
+  801d86:	e8 b7 02 00 00       	call   802042 <nsipc_close>
+  801d8b:	83 c4 10             	add    $0x10,%esp
+  801d8e:	eb eb                	jmp    801d7b <devsock_close+0x1f>
+
+00801d90 <devsock_write>:
+{
+  801d90:	55                   	push   %ebp
+  801d91:	89 e5                	mov    %esp,%ebp
+  801d93:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801d96:	6a 00                	push   $0x0
+  801d98:	ff 75 10             	push   0x10(%ebp)
+  801d9b:	ff 75 0c             	push   0xc(%ebp)
+  801d9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da1:	ff 70 0c             	push   0xc(%eax)
+  801da4:	e8 79 03 00 00       	call   802122 <nsipc_send>
+}
+  801da9:	c9                   	leave
+  801daa:	c3                   	ret
+
+00801dab <devsock_read>:
+{
+  801dab:	55                   	push   %ebp
+  801dac:	89 e5                	mov    %esp,%ebp
+  801dae:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801db1:	6a 00                	push   $0x0
+  801db3:	ff 75 10             	push   0x10(%ebp)
+  801db6:	ff 75 0c             	push   0xc(%ebp)
+  801db9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dbc:	ff 70 0c             	push   0xc(%eax)
+  801dbf:	e8 ef 02 00 00       	call   8020b3 <nsipc_recv>
+}
+  801dc4:	c9                   	leave
+  801dc5:	c3                   	ret
+
+00801dc6 <fd2sockid>:
+{
+  801dc6:	55                   	push   %ebp
+  801dc7:	89 e5                	mov    %esp,%ebp
+  801dc9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801dcc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801dcf:	52                   	push   %edx
+  801dd0:	50                   	push   %eax
+  801dd1:	e8 fe f7 ff ff       	call   8015d4 <fd_lookup>
+  801dd6:	83 c4 10             	add    $0x10,%esp
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 10                	js     801ded <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801ddd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801de0:	8b 0d 28 40 80 00    	mov    0x804028,%ecx
+  801de6:	39 08                	cmp    %ecx,(%eax)
+  801de8:	75 05                	jne    801def <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801dea:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801ded:	c9                   	leave
+  801dee:	c3                   	ret
+		return -E_NOT_SUPP;
+  801def:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801df4:	eb f7                	jmp    801ded <fd2sockid+0x27>
+
+00801df6 <alloc_sockfd>:
+{
+  801df6:	55                   	push   %ebp
+  801df7:	89 e5                	mov    %esp,%ebp
+  801df9:	56                   	push   %esi
+  801dfa:	53                   	push   %ebx
+  801dfb:	83 ec 1c             	sub    $0x1c,%esp
+  801dfe:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801e00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e03:	50                   	push   %eax
+  801e04:	e8 75 f7 ff ff       	call   80157e <fd_alloc>
+  801e09:	89 c3                	mov    %eax,%ebx
+  801e0b:	83 c4 10             	add    $0x10,%esp
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 43                	js     801e55 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801e12:	83 ec 04             	sub    $0x4,%esp
+  801e15:	68 07 04 00 00       	push   $0x407
+  801e1a:	ff 75 f4             	push   -0xc(%ebp)
+  801e1d:	6a 00                	push   $0x0
+  801e1f:	e8 d0 ee ff ff       	call   800cf4 <sys_page_alloc>
+  801e24:	89 c3                	mov    %eax,%ebx
+  801e26:	83 c4 10             	add    $0x10,%esp
+  801e29:	85 c0                	test   %eax,%eax
+  801e2b:	78 28                	js     801e55 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801e2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e30:	8b 15 28 40 80 00    	mov    0x804028,%edx
+  801e36:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801e38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e3b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801e42:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801e45:	83 ec 0c             	sub    $0xc,%esp
+  801e48:	50                   	push   %eax
+  801e49:	e8 09 f7 ff ff       	call   801557 <fd2num>
+  801e4e:	89 c3                	mov    %eax,%ebx
+  801e50:	83 c4 10             	add    $0x10,%esp
+  801e53:	eb 0c                	jmp    801e61 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801e55:	83 ec 0c             	sub    $0xc,%esp
+  801e58:	56                   	push   %esi
+  801e59:	e8 e4 01 00 00       	call   802042 <nsipc_close>
+		return r;
+  801e5e:	83 c4 10             	add    $0x10,%esp
+}
+  801e61:	89 d8                	mov    %ebx,%eax
+  801e63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e66:	5b                   	pop    %ebx
+  801e67:	5e                   	pop    %esi
+  801e68:	5d                   	pop    %ebp
+  801e69:	c3                   	ret
+
+00801e6a <accept>:
+{
+  801e6a:	55                   	push   %ebp
+  801e6b:	89 e5                	mov    %esp,%ebp
+  801e6d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e70:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e73:	e8 4e ff ff ff       	call   801dc6 <fd2sockid>
+  801e78:	85 c0                	test   %eax,%eax
+  801e7a:	78 1b                	js     801e97 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801e7c:	83 ec 04             	sub    $0x4,%esp
+  801e7f:	ff 75 10             	push   0x10(%ebp)
+  801e82:	ff 75 0c             	push   0xc(%ebp)
+  801e85:	50                   	push   %eax
+  801e86:	e8 0e 01 00 00       	call   801f99 <nsipc_accept>
+  801e8b:	83 c4 10             	add    $0x10,%esp
+  801e8e:	85 c0                	test   %eax,%eax
+  801e90:	78 05                	js     801e97 <accept+0x2d>
+	return alloc_sockfd(r);
+  801e92:	e8 5f ff ff ff       	call   801df6 <alloc_sockfd>
+}
+  801e97:	c9                   	leave
+  801e98:	c3                   	ret
+
+00801e99 <bind>:
+{
+  801e99:	55                   	push   %ebp
+  801e9a:	89 e5                	mov    %esp,%ebp
+  801e9c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea2:	e8 1f ff ff ff       	call   801dc6 <fd2sockid>
+  801ea7:	85 c0                	test   %eax,%eax
+  801ea9:	78 12                	js     801ebd <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801eab:	83 ec 04             	sub    $0x4,%esp
+  801eae:	ff 75 10             	push   0x10(%ebp)
+  801eb1:	ff 75 0c             	push   0xc(%ebp)
+  801eb4:	50                   	push   %eax
+  801eb5:	e8 31 01 00 00       	call   801feb <nsipc_bind>
+  801eba:	83 c4 10             	add    $0x10,%esp
+}
+  801ebd:	c9                   	leave
+  801ebe:	c3                   	ret
+
+00801ebf <shutdown>:
+{
+  801ebf:	55                   	push   %ebp
+  801ec0:	89 e5                	mov    %esp,%ebp
+  801ec2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ec5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec8:	e8 f9 fe ff ff       	call   801dc6 <fd2sockid>
+  801ecd:	85 c0                	test   %eax,%eax
+  801ecf:	78 0f                	js     801ee0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801ed1:	83 ec 08             	sub    $0x8,%esp
+  801ed4:	ff 75 0c             	push   0xc(%ebp)
+  801ed7:	50                   	push   %eax
+  801ed8:	e8 43 01 00 00       	call   802020 <nsipc_shutdown>
+  801edd:	83 c4 10             	add    $0x10,%esp
+}
+  801ee0:	c9                   	leave
+  801ee1:	c3                   	ret
+
+00801ee2 <connect>:
+{
+  801ee2:	55                   	push   %ebp
+  801ee3:	89 e5                	mov    %esp,%ebp
+  801ee5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ee8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eeb:	e8 d6 fe ff ff       	call   801dc6 <fd2sockid>
+  801ef0:	85 c0                	test   %eax,%eax
+  801ef2:	78 12                	js     801f06 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ef4:	83 ec 04             	sub    $0x4,%esp
+  801ef7:	ff 75 10             	push   0x10(%ebp)
+  801efa:	ff 75 0c             	push   0xc(%ebp)
+  801efd:	50                   	push   %eax
+  801efe:	e8 59 01 00 00       	call   80205c <nsipc_connect>
+  801f03:	83 c4 10             	add    $0x10,%esp
+}
+  801f06:	c9                   	leave
+  801f07:	c3                   	ret
+
+00801f08 <listen>:
+{
+  801f08:	55                   	push   %ebp
+  801f09:	89 e5                	mov    %esp,%ebp
+  801f0b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f11:	e8 b0 fe ff ff       	call   801dc6 <fd2sockid>
+  801f16:	85 c0                	test   %eax,%eax
+  801f18:	78 0f                	js     801f29 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801f1a:	83 ec 08             	sub    $0x8,%esp
+  801f1d:	ff 75 0c             	push   0xc(%ebp)
+  801f20:	50                   	push   %eax
+  801f21:	e8 6b 01 00 00       	call   802091 <nsipc_listen>
+  801f26:	83 c4 10             	add    $0x10,%esp
+}
+  801f29:	c9                   	leave
+  801f2a:	c3                   	ret
+
+00801f2b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801f31:	ff 75 10             	push   0x10(%ebp)
+  801f34:	ff 75 0c             	push   0xc(%ebp)
+  801f37:	ff 75 08             	push   0x8(%ebp)
+  801f3a:	e8 41 02 00 00       	call   802180 <nsipc_socket>
+  801f3f:	83 c4 10             	add    $0x10,%esp
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	78 05                	js     801f4b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801f46:	e8 ab fe ff ff       	call   801df6 <alloc_sockfd>
+}
+  801f4b:	c9                   	leave
+  801f4c:	c3                   	ret
+
+00801f4d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801f4d:	55                   	push   %ebp
+  801f4e:	89 e5                	mov    %esp,%ebp
+  801f50:	53                   	push   %ebx
+  801f51:	83 ec 04             	sub    $0x4,%esp
+  801f54:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801f56:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801f5d:	74 26                	je     801f85 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801f5f:	6a 07                	push   $0x7
+  801f61:	68 00 70 80 00       	push   $0x807000
+  801f66:	53                   	push   %ebx
+  801f67:	ff 35 04 50 80 00    	push   0x805004
+  801f6d:	e8 81 f5 ff ff       	call   8014f3 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f72:	83 c4 0c             	add    $0xc,%esp
+  801f75:	6a 00                	push   $0x0
+  801f77:	6a 00                	push   $0x0
+  801f79:	6a 00                	push   $0x0
+  801f7b:	e8 fb f4 ff ff       	call   80147b <ipc_recv>
+}
+  801f80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f83:	c9                   	leave
+  801f84:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f85:	83 ec 0c             	sub    $0xc,%esp
+  801f88:	6a 02                	push   $0x2
+  801f8a:	e8 b8 f5 ff ff       	call   801547 <ipc_find_env>
+  801f8f:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f94:	83 c4 10             	add    $0x10,%esp
+  801f97:	eb c6                	jmp    801f5f <nsipc+0x12>
+
+00801f99 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801f99:	55                   	push   %ebp
+  801f9a:	89 e5                	mov    %esp,%ebp
+  801f9c:	56                   	push   %esi
+  801f9d:	53                   	push   %ebx
+  801f9e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801fa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa4:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801fa9:	8b 06                	mov    (%esi),%eax
+  801fab:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801fb0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fb5:	e8 93 ff ff ff       	call   801f4d <nsipc>
+  801fba:	89 c3                	mov    %eax,%ebx
+  801fbc:	85 c0                	test   %eax,%eax
+  801fbe:	79 09                	jns    801fc9 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801fc0:	89 d8                	mov    %ebx,%eax
+  801fc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc5:	5b                   	pop    %ebx
+  801fc6:	5e                   	pop    %esi
+  801fc7:	5d                   	pop    %ebp
+  801fc8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801fc9:	83 ec 04             	sub    $0x4,%esp
+  801fcc:	ff 35 10 70 80 00    	push   0x807010
+  801fd2:	68 00 70 80 00       	push   $0x807000
+  801fd7:	ff 75 0c             	push   0xc(%ebp)
+  801fda:	e8 2e ea ff ff       	call   800a0d <memmove>
+		*addrlen = ret->ret_addrlen;
+  801fdf:	a1 10 70 80 00       	mov    0x807010,%eax
+  801fe4:	89 06                	mov    %eax,(%esi)
+  801fe6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801fe9:	eb d5                	jmp    801fc0 <nsipc_accept+0x27>
+
+00801feb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801feb:	55                   	push   %ebp
+  801fec:	89 e5                	mov    %esp,%ebp
+  801fee:	53                   	push   %ebx
+  801fef:	83 ec 08             	sub    $0x8,%esp
+  801ff2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ff5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff8:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ffd:	53                   	push   %ebx
+  801ffe:	ff 75 0c             	push   0xc(%ebp)
+  802001:	68 04 70 80 00       	push   $0x807004
+  802006:	e8 02 ea ff ff       	call   800a0d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80200b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802011:	b8 02 00 00 00       	mov    $0x2,%eax
+  802016:	e8 32 ff ff ff       	call   801f4d <nsipc>
+}
+  80201b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80201e:	c9                   	leave
+  80201f:	c3                   	ret
+
+00802020 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802020:	55                   	push   %ebp
+  802021:	89 e5                	mov    %esp,%ebp
+  802023:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802026:	8b 45 08             	mov    0x8(%ebp),%eax
+  802029:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  80202e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802031:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802036:	b8 03 00 00 00       	mov    $0x3,%eax
+  80203b:	e8 0d ff ff ff       	call   801f4d <nsipc>
+}
+  802040:	c9                   	leave
+  802041:	c3                   	ret
+
+00802042 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802042:	55                   	push   %ebp
+  802043:	89 e5                	mov    %esp,%ebp
+  802045:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802048:	8b 45 08             	mov    0x8(%ebp),%eax
+  80204b:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802050:	b8 04 00 00 00       	mov    $0x4,%eax
+  802055:	e8 f3 fe ff ff       	call   801f4d <nsipc>
+}
+  80205a:	c9                   	leave
+  80205b:	c3                   	ret
+
+0080205c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80205c:	55                   	push   %ebp
+  80205d:	89 e5                	mov    %esp,%ebp
+  80205f:	53                   	push   %ebx
+  802060:	83 ec 08             	sub    $0x8,%esp
+  802063:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802066:	8b 45 08             	mov    0x8(%ebp),%eax
+  802069:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80206e:	53                   	push   %ebx
+  80206f:	ff 75 0c             	push   0xc(%ebp)
+  802072:	68 04 70 80 00       	push   $0x807004
+  802077:	e8 91 e9 ff ff       	call   800a0d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80207c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802082:	b8 05 00 00 00       	mov    $0x5,%eax
+  802087:	e8 c1 fe ff ff       	call   801f4d <nsipc>
+}
+  80208c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80208f:	c9                   	leave
+  802090:	c3                   	ret
+
+00802091 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802091:	55                   	push   %ebp
+  802092:	89 e5                	mov    %esp,%ebp
+  802094:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802097:	8b 45 08             	mov    0x8(%ebp),%eax
+  80209a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80209f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020a2:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8020a7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8020ac:	e8 9c fe ff ff       	call   801f4d <nsipc>
+}
+  8020b1:	c9                   	leave
+  8020b2:	c3                   	ret
+
+008020b3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8020b3:	55                   	push   %ebp
+  8020b4:	89 e5                	mov    %esp,%ebp
+  8020b6:	56                   	push   %esi
+  8020b7:	53                   	push   %ebx
+  8020b8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8020bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020be:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8020c3:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8020c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020cc:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8020d1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8020d6:	e8 72 fe ff ff       	call   801f4d <nsipc>
+  8020db:	89 c3                	mov    %eax,%ebx
+  8020dd:	85 c0                	test   %eax,%eax
+  8020df:	78 22                	js     802103 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8020e1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8020e6:	39 c6                	cmp    %eax,%esi
+  8020e8:	0f 4e c6             	cmovle %esi,%eax
+  8020eb:	39 c3                	cmp    %eax,%ebx
+  8020ed:	7f 1d                	jg     80210c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8020ef:	83 ec 04             	sub    $0x4,%esp
+  8020f2:	53                   	push   %ebx
+  8020f3:	68 00 70 80 00       	push   $0x807000
+  8020f8:	ff 75 0c             	push   0xc(%ebp)
+  8020fb:	e8 0d e9 ff ff       	call   800a0d <memmove>
+  802100:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802103:	89 d8                	mov    %ebx,%eax
+  802105:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802108:	5b                   	pop    %ebx
+  802109:	5e                   	pop    %esi
+  80210a:	5d                   	pop    %ebp
+  80210b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80210c:	68 8f 31 80 00       	push   $0x80318f
+  802111:	68 57 31 80 00       	push   $0x803157
+  802116:	6a 62                	push   $0x62
+  802118:	68 a4 31 80 00       	push   $0x8031a4
+  80211d:	e8 46 05 00 00       	call   802668 <_panic>
+
+00802122 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802122:	55                   	push   %ebp
+  802123:	89 e5                	mov    %esp,%ebp
+  802125:	53                   	push   %ebx
+  802126:	83 ec 04             	sub    $0x4,%esp
+  802129:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80212c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80212f:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802134:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80213a:	7f 2e                	jg     80216a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80213c:	83 ec 04             	sub    $0x4,%esp
+  80213f:	53                   	push   %ebx
+  802140:	ff 75 0c             	push   0xc(%ebp)
+  802143:	68 0c 70 80 00       	push   $0x80700c
+  802148:	e8 c0 e8 ff ff       	call   800a0d <memmove>
+	nsipcbuf.send.req_size = size;
+  80214d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802153:	8b 45 14             	mov    0x14(%ebp),%eax
+  802156:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80215b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802160:	e8 e8 fd ff ff       	call   801f4d <nsipc>
+}
+  802165:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802168:	c9                   	leave
+  802169:	c3                   	ret
+	assert(size < 1600);
+  80216a:	68 b0 31 80 00       	push   $0x8031b0
+  80216f:	68 57 31 80 00       	push   $0x803157
+  802174:	6a 6d                	push   $0x6d
+  802176:	68 a4 31 80 00       	push   $0x8031a4
+  80217b:	e8 e8 04 00 00       	call   802668 <_panic>
+
+00802180 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802180:	55                   	push   %ebp
+  802181:	89 e5                	mov    %esp,%ebp
+  802183:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802186:	8b 45 08             	mov    0x8(%ebp),%eax
+  802189:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80218e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802191:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802196:	8b 45 10             	mov    0x10(%ebp),%eax
+  802199:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80219e:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021a3:	e8 a5 fd ff ff       	call   801f4d <nsipc>
+}
+  8021a8:	c9                   	leave
+  8021a9:	c3                   	ret
+
+008021aa <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8021aa:	55                   	push   %ebp
+  8021ab:	89 e5                	mov    %esp,%ebp
+  8021ad:	56                   	push   %esi
+  8021ae:	53                   	push   %ebx
+  8021af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8021b2:	83 ec 0c             	sub    $0xc,%esp
+  8021b5:	ff 75 08             	push   0x8(%ebp)
+  8021b8:	e8 aa f3 ff ff       	call   801567 <fd2data>
+  8021bd:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8021bf:	83 c4 08             	add    $0x8,%esp
+  8021c2:	68 bc 31 80 00       	push   $0x8031bc
+  8021c7:	53                   	push   %ebx
+  8021c8:	e8 ba e6 ff ff       	call   800887 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8021cd:	8b 46 04             	mov    0x4(%esi),%eax
+  8021d0:	2b 06                	sub    (%esi),%eax
+  8021d2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8021d8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021df:	00 00 00 
+	stat->st_dev = &devpipe;
+  8021e2:	c7 83 88 00 00 00 44 	movl   $0x804044,0x88(%ebx)
+  8021e9:	40 80 00 
+	return 0;
+}
+  8021ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021f4:	5b                   	pop    %ebx
+  8021f5:	5e                   	pop    %esi
+  8021f6:	5d                   	pop    %ebp
+  8021f7:	c3                   	ret
+
+008021f8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8021f8:	55                   	push   %ebp
+  8021f9:	89 e5                	mov    %esp,%ebp
+  8021fb:	53                   	push   %ebx
+  8021fc:	83 ec 0c             	sub    $0xc,%esp
+  8021ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802202:	53                   	push   %ebx
+  802203:	6a 00                	push   $0x0
+  802205:	e8 b2 eb ff ff       	call   800dbc <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80220a:	89 1c 24             	mov    %ebx,(%esp)
+  80220d:	e8 55 f3 ff ff       	call   801567 <fd2data>
+  802212:	83 c4 08             	add    $0x8,%esp
+  802215:	50                   	push   %eax
+  802216:	6a 00                	push   $0x0
+  802218:	e8 9f eb ff ff       	call   800dbc <sys_page_unmap>
+}
+  80221d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802220:	c9                   	leave
+  802221:	c3                   	ret
+
+00802222 <_pipeisclosed>:
+{
+  802222:	55                   	push   %ebp
+  802223:	89 e5                	mov    %esp,%ebp
+  802225:	57                   	push   %edi
+  802226:	56                   	push   %esi
+  802227:	53                   	push   %ebx
+  802228:	83 ec 1c             	sub    $0x1c,%esp
+  80222b:	89 c7                	mov    %eax,%edi
+  80222d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80222f:	a1 08 50 80 00       	mov    0x805008,%eax
+  802234:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802237:	83 ec 0c             	sub    $0xc,%esp
+  80223a:	57                   	push   %edi
+  80223b:	e8 ff 04 00 00       	call   80273f <pageref>
+  802240:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802243:	89 34 24             	mov    %esi,(%esp)
+  802246:	e8 f4 04 00 00       	call   80273f <pageref>
+		nn = thisenv->env_runs;
+  80224b:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802251:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802254:	83 c4 10             	add    $0x10,%esp
+  802257:	39 cb                	cmp    %ecx,%ebx
+  802259:	74 1b                	je     802276 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80225b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80225e:	75 cf                	jne    80222f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802260:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802263:	6a 01                	push   $0x1
+  802265:	50                   	push   %eax
+  802266:	53                   	push   %ebx
+  802267:	68 c3 31 80 00       	push   $0x8031c3
+  80226c:	e8 28 e0 ff ff       	call   800299 <cprintf>
+  802271:	83 c4 10             	add    $0x10,%esp
+  802274:	eb b9                	jmp    80222f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802276:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802279:	0f 94 c0             	sete   %al
+  80227c:	0f b6 c0             	movzbl %al,%eax
+}
+  80227f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802282:	5b                   	pop    %ebx
+  802283:	5e                   	pop    %esi
+  802284:	5f                   	pop    %edi
+  802285:	5d                   	pop    %ebp
+  802286:	c3                   	ret
+
+00802287 <devpipe_write>:
+{
+  802287:	55                   	push   %ebp
+  802288:	89 e5                	mov    %esp,%ebp
+  80228a:	57                   	push   %edi
+  80228b:	56                   	push   %esi
+  80228c:	53                   	push   %ebx
+  80228d:	83 ec 28             	sub    $0x28,%esp
+  802290:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802293:	56                   	push   %esi
+  802294:	e8 ce f2 ff ff       	call   801567 <fd2data>
+  802299:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8022a6:	75 09                	jne    8022b1 <devpipe_write+0x2a>
+	return i;
+  8022a8:	89 f8                	mov    %edi,%eax
+  8022aa:	eb 23                	jmp    8022cf <devpipe_write+0x48>
+			sys_yield();
+  8022ac:	e8 c3 e9 ff ff       	call   800c74 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8022b1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8022b4:	8b 0b                	mov    (%ebx),%ecx
+  8022b6:	8d 51 20             	lea    0x20(%ecx),%edx
+  8022b9:	39 d0                	cmp    %edx,%eax
+  8022bb:	72 1a                	jb     8022d7 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8022bd:	89 da                	mov    %ebx,%edx
+  8022bf:	89 f0                	mov    %esi,%eax
+  8022c1:	e8 5c ff ff ff       	call   802222 <_pipeisclosed>
+  8022c6:	85 c0                	test   %eax,%eax
+  8022c8:	74 e2                	je     8022ac <devpipe_write+0x25>
+				return 0;
+  8022ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d2:	5b                   	pop    %ebx
+  8022d3:	5e                   	pop    %esi
+  8022d4:	5f                   	pop    %edi
+  8022d5:	5d                   	pop    %ebp
+  8022d6:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8022d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022da:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8022de:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8022e1:	89 c2                	mov    %eax,%edx
+  8022e3:	c1 fa 1f             	sar    $0x1f,%edx
+  8022e6:	89 d1                	mov    %edx,%ecx
+  8022e8:	c1 e9 1b             	shr    $0x1b,%ecx
+  8022eb:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8022ee:	83 e2 1f             	and    $0x1f,%edx
+  8022f1:	29 ca                	sub    %ecx,%edx
+  8022f3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8022f7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8022fb:	83 c0 01             	add    $0x1,%eax
+  8022fe:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802301:	83 c7 01             	add    $0x1,%edi
+  802304:	eb 9d                	jmp    8022a3 <devpipe_write+0x1c>
+
+00802306 <devpipe_read>:
+{
+  802306:	55                   	push   %ebp
+  802307:	89 e5                	mov    %esp,%ebp
+  802309:	57                   	push   %edi
+  80230a:	56                   	push   %esi
+  80230b:	53                   	push   %ebx
+  80230c:	83 ec 18             	sub    $0x18,%esp
+  80230f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802312:	57                   	push   %edi
+  802313:	e8 4f f2 ff ff       	call   801567 <fd2data>
+  802318:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80231a:	83 c4 10             	add    $0x10,%esp
+  80231d:	be 00 00 00 00       	mov    $0x0,%esi
+  802322:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802325:	75 13                	jne    80233a <devpipe_read+0x34>
+	return i;
+  802327:	89 f0                	mov    %esi,%eax
+  802329:	eb 02                	jmp    80232d <devpipe_read+0x27>
+				return i;
+  80232b:	89 f0                	mov    %esi,%eax
+}
+  80232d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802330:	5b                   	pop    %ebx
+  802331:	5e                   	pop    %esi
+  802332:	5f                   	pop    %edi
+  802333:	5d                   	pop    %ebp
+  802334:	c3                   	ret
+			sys_yield();
+  802335:	e8 3a e9 ff ff       	call   800c74 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80233a:	8b 03                	mov    (%ebx),%eax
+  80233c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80233f:	75 18                	jne    802359 <devpipe_read+0x53>
+			if (i > 0)
+  802341:	85 f6                	test   %esi,%esi
+  802343:	75 e6                	jne    80232b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802345:	89 da                	mov    %ebx,%edx
+  802347:	89 f8                	mov    %edi,%eax
+  802349:	e8 d4 fe ff ff       	call   802222 <_pipeisclosed>
+  80234e:	85 c0                	test   %eax,%eax
+  802350:	74 e3                	je     802335 <devpipe_read+0x2f>
+				return 0;
+  802352:	b8 00 00 00 00       	mov    $0x0,%eax
+  802357:	eb d4                	jmp    80232d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802359:	99                   	cltd
+  80235a:	c1 ea 1b             	shr    $0x1b,%edx
+  80235d:	01 d0                	add    %edx,%eax
+  80235f:	83 e0 1f             	and    $0x1f,%eax
+  802362:	29 d0                	sub    %edx,%eax
+  802364:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802369:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80236c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80236f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802372:	83 c6 01             	add    $0x1,%esi
+  802375:	eb ab                	jmp    802322 <devpipe_read+0x1c>
+
+00802377 <pipe>:
+{
+  802377:	55                   	push   %ebp
+  802378:	89 e5                	mov    %esp,%ebp
+  80237a:	56                   	push   %esi
+  80237b:	53                   	push   %ebx
+  80237c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80237f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802382:	50                   	push   %eax
+  802383:	e8 f6 f1 ff ff       	call   80157e <fd_alloc>
+  802388:	89 c3                	mov    %eax,%ebx
+  80238a:	83 c4 10             	add    $0x10,%esp
+  80238d:	85 c0                	test   %eax,%eax
+  80238f:	0f 88 23 01 00 00    	js     8024b8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802395:	83 ec 04             	sub    $0x4,%esp
+  802398:	68 07 04 00 00       	push   $0x407
+  80239d:	ff 75 f4             	push   -0xc(%ebp)
+  8023a0:	6a 00                	push   $0x0
+  8023a2:	e8 4d e9 ff ff       	call   800cf4 <sys_page_alloc>
+  8023a7:	89 c3                	mov    %eax,%ebx
+  8023a9:	83 c4 10             	add    $0x10,%esp
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	0f 88 04 01 00 00    	js     8024b8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8023b4:	83 ec 0c             	sub    $0xc,%esp
+  8023b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023ba:	50                   	push   %eax
+  8023bb:	e8 be f1 ff ff       	call   80157e <fd_alloc>
+  8023c0:	89 c3                	mov    %eax,%ebx
+  8023c2:	83 c4 10             	add    $0x10,%esp
+  8023c5:	85 c0                	test   %eax,%eax
+  8023c7:	0f 88 db 00 00 00    	js     8024a8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023cd:	83 ec 04             	sub    $0x4,%esp
+  8023d0:	68 07 04 00 00       	push   $0x407
+  8023d5:	ff 75 f0             	push   -0x10(%ebp)
+  8023d8:	6a 00                	push   $0x0
+  8023da:	e8 15 e9 ff ff       	call   800cf4 <sys_page_alloc>
+  8023df:	89 c3                	mov    %eax,%ebx
+  8023e1:	83 c4 10             	add    $0x10,%esp
+  8023e4:	85 c0                	test   %eax,%eax
+  8023e6:	0f 88 bc 00 00 00    	js     8024a8 <pipe+0x131>
+	va = fd2data(fd0);
+  8023ec:	83 ec 0c             	sub    $0xc,%esp
+  8023ef:	ff 75 f4             	push   -0xc(%ebp)
+  8023f2:	e8 70 f1 ff ff       	call   801567 <fd2data>
+  8023f7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023f9:	83 c4 0c             	add    $0xc,%esp
+  8023fc:	68 07 04 00 00       	push   $0x407
+  802401:	50                   	push   %eax
+  802402:	6a 00                	push   $0x0
+  802404:	e8 eb e8 ff ff       	call   800cf4 <sys_page_alloc>
+  802409:	89 c3                	mov    %eax,%ebx
+  80240b:	83 c4 10             	add    $0x10,%esp
+  80240e:	85 c0                	test   %eax,%eax
+  802410:	0f 88 82 00 00 00    	js     802498 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802416:	83 ec 0c             	sub    $0xc,%esp
+  802419:	ff 75 f0             	push   -0x10(%ebp)
+  80241c:	e8 46 f1 ff ff       	call   801567 <fd2data>
+  802421:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802428:	50                   	push   %eax
+  802429:	6a 00                	push   $0x0
+  80242b:	56                   	push   %esi
+  80242c:	6a 00                	push   $0x0
+  80242e:	e8 47 e9 ff ff       	call   800d7a <sys_page_map>
+  802433:	89 c3                	mov    %eax,%ebx
+  802435:	83 c4 20             	add    $0x20,%esp
+  802438:	85 c0                	test   %eax,%eax
+  80243a:	78 4e                	js     80248a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80243c:	a1 44 40 80 00       	mov    0x804044,%eax
+  802441:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802444:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802446:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802449:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802450:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802453:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802455:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802458:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80245f:	83 ec 0c             	sub    $0xc,%esp
+  802462:	ff 75 f4             	push   -0xc(%ebp)
+  802465:	e8 ed f0 ff ff       	call   801557 <fd2num>
+  80246a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80246d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80246f:	83 c4 04             	add    $0x4,%esp
+  802472:	ff 75 f0             	push   -0x10(%ebp)
+  802475:	e8 dd f0 ff ff       	call   801557 <fd2num>
+  80247a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80247d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802480:	83 c4 10             	add    $0x10,%esp
+  802483:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802488:	eb 2e                	jmp    8024b8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80248a:	83 ec 08             	sub    $0x8,%esp
+  80248d:	56                   	push   %esi
+  80248e:	6a 00                	push   $0x0
+  802490:	e8 27 e9 ff ff       	call   800dbc <sys_page_unmap>
+  802495:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802498:	83 ec 08             	sub    $0x8,%esp
+  80249b:	ff 75 f0             	push   -0x10(%ebp)
+  80249e:	6a 00                	push   $0x0
+  8024a0:	e8 17 e9 ff ff       	call   800dbc <sys_page_unmap>
+  8024a5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8024a8:	83 ec 08             	sub    $0x8,%esp
+  8024ab:	ff 75 f4             	push   -0xc(%ebp)
+  8024ae:	6a 00                	push   $0x0
+  8024b0:	e8 07 e9 ff ff       	call   800dbc <sys_page_unmap>
+  8024b5:	83 c4 10             	add    $0x10,%esp
+}
+  8024b8:	89 d8                	mov    %ebx,%eax
+  8024ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024bd:	5b                   	pop    %ebx
+  8024be:	5e                   	pop    %esi
+  8024bf:	5d                   	pop    %ebp
+  8024c0:	c3                   	ret
+
+008024c1 <pipeisclosed>:
+{
+  8024c1:	55                   	push   %ebp
+  8024c2:	89 e5                	mov    %esp,%ebp
+  8024c4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024ca:	50                   	push   %eax
+  8024cb:	ff 75 08             	push   0x8(%ebp)
+  8024ce:	e8 01 f1 ff ff       	call   8015d4 <fd_lookup>
+  8024d3:	83 c4 10             	add    $0x10,%esp
+  8024d6:	85 c0                	test   %eax,%eax
+  8024d8:	78 18                	js     8024f2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8024da:	83 ec 0c             	sub    $0xc,%esp
+  8024dd:	ff 75 f4             	push   -0xc(%ebp)
+  8024e0:	e8 82 f0 ff ff       	call   801567 <fd2data>
+  8024e5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8024e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024ea:	e8 33 fd ff ff       	call   802222 <_pipeisclosed>
+  8024ef:	83 c4 10             	add    $0x10,%esp
+}
+  8024f2:	c9                   	leave
+  8024f3:	c3                   	ret
+
+008024f4 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8024f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f9:	c3                   	ret
+
+008024fa <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024fa:	55                   	push   %ebp
+  8024fb:	89 e5                	mov    %esp,%ebp
+  8024fd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802500:	68 db 31 80 00       	push   $0x8031db
+  802505:	ff 75 0c             	push   0xc(%ebp)
+  802508:	e8 7a e3 ff ff       	call   800887 <strcpy>
+	return 0;
+}
+  80250d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802512:	c9                   	leave
+  802513:	c3                   	ret
+
+00802514 <devcons_write>:
+{
+  802514:	55                   	push   %ebp
+  802515:	89 e5                	mov    %esp,%ebp
+  802517:	57                   	push   %edi
+  802518:	56                   	push   %esi
+  802519:	53                   	push   %ebx
+  80251a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802520:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802525:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80252b:	eb 2e                	jmp    80255b <devcons_write+0x47>
+		m = n - tot;
+  80252d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802530:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802532:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802537:	39 c3                	cmp    %eax,%ebx
+  802539:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80253c:	83 ec 04             	sub    $0x4,%esp
+  80253f:	53                   	push   %ebx
+  802540:	89 f0                	mov    %esi,%eax
+  802542:	03 45 0c             	add    0xc(%ebp),%eax
+  802545:	50                   	push   %eax
+  802546:	57                   	push   %edi
+  802547:	e8 c1 e4 ff ff       	call   800a0d <memmove>
+		sys_cputs(buf, m);
+  80254c:	83 c4 08             	add    $0x8,%esp
+  80254f:	53                   	push   %ebx
+  802550:	57                   	push   %edi
+  802551:	e8 61 e6 ff ff       	call   800bb7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802556:	01 de                	add    %ebx,%esi
+  802558:	83 c4 10             	add    $0x10,%esp
+  80255b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80255e:	72 cd                	jb     80252d <devcons_write+0x19>
+}
+  802560:	89 f0                	mov    %esi,%eax
+  802562:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802565:	5b                   	pop    %ebx
+  802566:	5e                   	pop    %esi
+  802567:	5f                   	pop    %edi
+  802568:	5d                   	pop    %ebp
+  802569:	c3                   	ret
+
+0080256a <devcons_read>:
+{
+  80256a:	55                   	push   %ebp
+  80256b:	89 e5                	mov    %esp,%ebp
+  80256d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802570:	b8 00 00 00 00       	mov    $0x0,%eax
+  802575:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802579:	75 07                	jne    802582 <devcons_read+0x18>
+  80257b:	eb 1f                	jmp    80259c <devcons_read+0x32>
+		sys_yield();
+  80257d:	e8 f2 e6 ff ff       	call   800c74 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802582:	e8 4e e6 ff ff       	call   800bd5 <sys_cgetc>
+  802587:	85 c0                	test   %eax,%eax
+  802589:	74 f2                	je     80257d <devcons_read+0x13>
+	if (c < 0)
+  80258b:	78 0f                	js     80259c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80258d:	83 f8 04             	cmp    $0x4,%eax
+  802590:	74 0c                	je     80259e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802592:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802595:	88 02                	mov    %al,(%edx)
+	return 1;
+  802597:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80259c:	c9                   	leave
+  80259d:	c3                   	ret
+		return 0;
+  80259e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a3:	eb f7                	jmp    80259c <devcons_read+0x32>
+
+008025a5 <cputchar>:
+{
+  8025a5:	55                   	push   %ebp
+  8025a6:	89 e5                	mov    %esp,%ebp
+  8025a8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8025ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ae:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8025b1:	6a 01                	push   $0x1
+  8025b3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8025b6:	50                   	push   %eax
+  8025b7:	e8 fb e5 ff ff       	call   800bb7 <sys_cputs>
+}
+  8025bc:	83 c4 10             	add    $0x10,%esp
+  8025bf:	c9                   	leave
+  8025c0:	c3                   	ret
+
+008025c1 <getchar>:
+{
+  8025c1:	55                   	push   %ebp
+  8025c2:	89 e5                	mov    %esp,%ebp
+  8025c4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8025c7:	6a 01                	push   $0x1
+  8025c9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8025cc:	50                   	push   %eax
+  8025cd:	6a 00                	push   $0x0
+  8025cf:	e8 66 f2 ff ff       	call   80183a <read>
+	if (r < 0)
+  8025d4:	83 c4 10             	add    $0x10,%esp
+  8025d7:	85 c0                	test   %eax,%eax
+  8025d9:	78 06                	js     8025e1 <getchar+0x20>
+	if (r < 1)
+  8025db:	74 06                	je     8025e3 <getchar+0x22>
+	return c;
+  8025dd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8025e1:	c9                   	leave
+  8025e2:	c3                   	ret
+		return -E_EOF;
+  8025e3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8025e8:	eb f7                	jmp    8025e1 <getchar+0x20>
+
+008025ea <iscons>:
+{
+  8025ea:	55                   	push   %ebp
+  8025eb:	89 e5                	mov    %esp,%ebp
+  8025ed:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025f3:	50                   	push   %eax
+  8025f4:	ff 75 08             	push   0x8(%ebp)
+  8025f7:	e8 d8 ef ff ff       	call   8015d4 <fd_lookup>
+  8025fc:	83 c4 10             	add    $0x10,%esp
+  8025ff:	85 c0                	test   %eax,%eax
+  802601:	78 11                	js     802614 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802603:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802606:	8b 15 60 40 80 00    	mov    0x804060,%edx
+  80260c:	39 10                	cmp    %edx,(%eax)
+  80260e:	0f 94 c0             	sete   %al
+  802611:	0f b6 c0             	movzbl %al,%eax
+}
+  802614:	c9                   	leave
+  802615:	c3                   	ret
+
+00802616 <opencons>:
+{
+  802616:	55                   	push   %ebp
+  802617:	89 e5                	mov    %esp,%ebp
+  802619:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80261c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80261f:	50                   	push   %eax
+  802620:	e8 59 ef ff ff       	call   80157e <fd_alloc>
+  802625:	83 c4 10             	add    $0x10,%esp
+  802628:	85 c0                	test   %eax,%eax
+  80262a:	78 3a                	js     802666 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80262c:	83 ec 04             	sub    $0x4,%esp
+  80262f:	68 07 04 00 00       	push   $0x407
+  802634:	ff 75 f4             	push   -0xc(%ebp)
+  802637:	6a 00                	push   $0x0
+  802639:	e8 b6 e6 ff ff       	call   800cf4 <sys_page_alloc>
+  80263e:	83 c4 10             	add    $0x10,%esp
+  802641:	85 c0                	test   %eax,%eax
+  802643:	78 21                	js     802666 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802645:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802648:	8b 15 60 40 80 00    	mov    0x804060,%edx
+  80264e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802650:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802653:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80265a:	83 ec 0c             	sub    $0xc,%esp
+  80265d:	50                   	push   %eax
+  80265e:	e8 f4 ee ff ff       	call   801557 <fd2num>
+  802663:	83 c4 10             	add    $0x10,%esp
+}
+  802666:	c9                   	leave
+  802667:	c3                   	ret
+
+00802668 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802668:	55                   	push   %ebp
+  802669:	89 e5                	mov    %esp,%ebp
+  80266b:	56                   	push   %esi
+  80266c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80266d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802670:	8b 35 08 40 80 00    	mov    0x804008,%esi
+  802676:	e8 da e5 ff ff       	call   800c55 <sys_getenvid>
+  80267b:	83 ec 0c             	sub    $0xc,%esp
+  80267e:	ff 75 0c             	push   0xc(%ebp)
+  802681:	ff 75 08             	push   0x8(%ebp)
+  802684:	56                   	push   %esi
+  802685:	50                   	push   %eax
+  802686:	68 e8 31 80 00       	push   $0x8031e8
+  80268b:	e8 09 dc ff ff       	call   800299 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802690:	83 c4 18             	add    $0x18,%esp
+  802693:	53                   	push   %ebx
+  802694:	ff 75 10             	push   0x10(%ebp)
+  802697:	e8 ac db ff ff       	call   800248 <vcprintf>
+	cprintf("\n");
+  80269c:	c7 04 24 d4 31 80 00 	movl   $0x8031d4,(%esp)
+  8026a3:	e8 f1 db ff ff       	call   800299 <cprintf>
+  8026a8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8026ab:	cc                   	int3
+	while (1)
+  8026ac:	eb fd                	jmp    8026ab <_panic+0x43>
+
+008026ae <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8026ae:	55                   	push   %ebp
+  8026af:	89 e5                	mov    %esp,%ebp
+  8026b1:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8026b4:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8026bb:	74 0a                	je     8026c7 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8026bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026c0:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8026c5:	c9                   	leave
+  8026c6:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  8026c7:	83 ec 04             	sub    $0x4,%esp
+  8026ca:	6a 07                	push   $0x7
+  8026cc:	68 00 f0 bf ee       	push   $0xeebff000
+  8026d1:	6a 00                	push   $0x0
+  8026d3:	e8 1c e6 ff ff       	call   800cf4 <sys_page_alloc>
+  8026d8:	83 c4 10             	add    $0x10,%esp
+  8026db:	85 c0                	test   %eax,%eax
+  8026dd:	78 28                	js     802707 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  8026df:	83 ec 08             	sub    $0x8,%esp
+  8026e2:	68 19 27 80 00       	push   $0x802719
+  8026e7:	6a 00                	push   $0x0
+  8026e9:	e8 01 e9 ff ff       	call   800fef <sys_env_set_pgfault_upcall>
+  8026ee:	83 c4 10             	add    $0x10,%esp
+  8026f1:	85 c0                	test   %eax,%eax
+  8026f3:	79 c8                	jns    8026bd <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  8026f5:	50                   	push   %eax
+  8026f6:	68 19 32 80 00       	push   $0x803219
+  8026fb:	6a 24                	push   $0x24
+  8026fd:	68 0b 32 80 00       	push   $0x80320b
+  802702:	e8 61 ff ff ff       	call   802668 <_panic>
+			panic("sys_page_alloc: %e", r);
+  802707:	50                   	push   %eax
+  802708:	68 c6 2f 80 00       	push   $0x802fc6
+  80270d:	6a 21                	push   $0x21
+  80270f:	68 0b 32 80 00       	push   $0x80320b
+  802714:	e8 4f ff ff ff       	call   802668 <_panic>
+
+00802719 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802719:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80271a:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  80271f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802721:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802724:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  802727:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  80272b:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  80272e:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  802732:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  802736:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  802738:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802739:	83 c4 04             	add    $0x4,%esp
+	popf
+  80273c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80273d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80273e:	c3                   	ret
+
+0080273f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80273f:	55                   	push   %ebp
+  802740:	89 e5                	mov    %esp,%ebp
+  802742:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802745:	89 c2                	mov    %eax,%edx
+  802747:	c1 ea 16             	shr    $0x16,%edx
+  80274a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802751:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802756:	f6 c1 01             	test   $0x1,%cl
+  802759:	74 22                	je     80277d <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80275b:	c1 e8 0c             	shr    $0xc,%eax
+  80275e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802765:	a8 01                	test   $0x1,%al
+  802767:	74 14                	je     80277d <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802769:	c1 e8 0c             	shr    $0xc,%eax
+  80276c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80276f:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802776:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80277a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80277d:	89 d0                	mov    %edx,%eax
+  80277f:	5d                   	pop    %ebp
+  802780:	c3                   	ret
+  802781:	66 90                	xchg   %ax,%ax
+  802783:	66 90                	xchg   %ax,%ax
+  802785:	66 90                	xchg   %ax,%ax
+  802787:	66 90                	xchg   %ax,%ax
+  802789:	66 90                	xchg   %ax,%ax
+  80278b:	66 90                	xchg   %ax,%ax
+  80278d:	66 90                	xchg   %ax,%ax
+  80278f:	90                   	nop
+
+00802790 <__udivmoddi4>:
+  802790:	55                   	push   %ebp
+  802791:	57                   	push   %edi
+  802792:	56                   	push   %esi
+  802793:	53                   	push   %ebx
+  802794:	83 ec 14             	sub    $0x14,%esp
+  802797:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80279b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80279f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027a3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027a7:	89 f1                	mov    %esi,%ecx
+  8027a9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8027ad:	09 d9                	or     %ebx,%ecx
+  8027af:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8027b3:	0f 84 92 00 00 00    	je     80284b <__udivmoddi4+0xbb>
+  8027b9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027c0:	00 
+  8027c1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8027c6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027cd:	00 
+  8027ce:	89 1c 24             	mov    %ebx,(%esp)
+  8027d1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8027d5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027d8:	89 e9                	mov    %ebp,%ecx
+  8027da:	89 c3                	mov    %eax,%ebx
+  8027dc:	89 d6                	mov    %edx,%esi
+  8027de:	31 ff                	xor    %edi,%edi
+  8027e0:	d3 ee                	shr    %cl,%esi
+  8027e2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8027e5:	f6 c1 20             	test   $0x20,%cl
+  8027e8:	0f 45 de             	cmovne %esi,%ebx
+  8027eb:	0f 45 f7             	cmovne %edi,%esi
+  8027ee:	8b 3c 24             	mov    (%esp),%edi
+  8027f1:	39 fb                	cmp    %edi,%ebx
+  8027f3:	89 f7                	mov    %esi,%edi
+  8027f5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8027f9:	8b 1c 24             	mov    (%esp),%ebx
+  8027fc:	19 f7                	sbb    %esi,%edi
+  8027fe:	72 39                	jb     802839 <__udivmoddi4+0xa9>
+  802800:	89 e9                	mov    %ebp,%ecx
+  802802:	89 f7                	mov    %esi,%edi
+  802804:	89 de                	mov    %ebx,%esi
+  802806:	0f a5 df             	shld   %cl,%ebx,%edi
+  802809:	d3 e6                	shl    %cl,%esi
+  80280b:	31 db                	xor    %ebx,%ebx
+  80280d:	f6 c1 20             	test   $0x20,%cl
+  802810:	0f 45 fe             	cmovne %esi,%edi
+  802813:	0f 45 f3             	cmovne %ebx,%esi
+  802816:	29 f0                	sub    %esi,%eax
+  802818:	be 01 00 00 00       	mov    $0x1,%esi
+  80281d:	19 fa                	sbb    %edi,%edx
+  80281f:	31 ff                	xor    %edi,%edi
+  802821:	31 db                	xor    %ebx,%ebx
+  802823:	0f a5 f7             	shld   %cl,%esi,%edi
+  802826:	d3 e6                	shl    %cl,%esi
+  802828:	f6 c1 20             	test   $0x20,%cl
+  80282b:	0f 45 fe             	cmovne %esi,%edi
+  80282e:	0f 45 f3             	cmovne %ebx,%esi
+  802831:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802835:	09 74 24 08          	or     %esi,0x8(%esp)
+  802839:	83 ed 01             	sub    $0x1,%ebp
+  80283c:	73 9a                	jae    8027d8 <__udivmoddi4+0x48>
+  80283e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802842:	85 ff                	test   %edi,%edi
+  802844:	74 05                	je     80284b <__udivmoddi4+0xbb>
+  802846:	89 07                	mov    %eax,(%edi)
+  802848:	89 57 04             	mov    %edx,0x4(%edi)
+  80284b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80284f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802853:	83 c4 14             	add    $0x14,%esp
+  802856:	5b                   	pop    %ebx
+  802857:	5e                   	pop    %esi
+  802858:	5f                   	pop    %edi
+  802859:	5d                   	pop    %ebp
+  80285a:	c3                   	ret
+  80285b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80285f:	90                   	nop
+
+00802860 <__udivdi3>:
+  802860:	55                   	push   %ebp
+  802861:	57                   	push   %edi
+  802862:	56                   	push   %esi
+  802863:	53                   	push   %ebx
+  802864:	83 ec 14             	sub    $0x14,%esp
+  802867:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80286b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80286f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802873:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802877:	89 fb                	mov    %edi,%ebx
+  802879:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80287d:	09 f3                	or     %esi,%ebx
+  80287f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802883:	0f 84 85 00 00 00    	je     80290e <__udivdi3+0xae>
+  802889:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802890:	00 
+  802891:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802896:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80289d:	00 
+  80289e:	89 34 24             	mov    %esi,(%esp)
+  8028a1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8028a5:	8d 76 00             	lea    0x0(%esi),%esi
+  8028a8:	89 e9                	mov    %ebp,%ecx
+  8028aa:	89 c3                	mov    %eax,%ebx
+  8028ac:	89 d6                	mov    %edx,%esi
+  8028ae:	31 ff                	xor    %edi,%edi
+  8028b0:	d3 ee                	shr    %cl,%esi
+  8028b2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8028b5:	f6 c1 20             	test   $0x20,%cl
+  8028b8:	0f 45 de             	cmovne %esi,%ebx
+  8028bb:	0f 45 f7             	cmovne %edi,%esi
+  8028be:	8b 3c 24             	mov    (%esp),%edi
+  8028c1:	39 fb                	cmp    %edi,%ebx
+  8028c3:	89 f7                	mov    %esi,%edi
+  8028c5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8028c9:	8b 1c 24             	mov    (%esp),%ebx
+  8028cc:	19 f7                	sbb    %esi,%edi
+  8028ce:	72 39                	jb     802909 <__udivdi3+0xa9>
+  8028d0:	89 e9                	mov    %ebp,%ecx
+  8028d2:	89 f7                	mov    %esi,%edi
+  8028d4:	89 de                	mov    %ebx,%esi
+  8028d6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8028d9:	d3 e6                	shl    %cl,%esi
+  8028db:	31 db                	xor    %ebx,%ebx
+  8028dd:	f6 c1 20             	test   $0x20,%cl
+  8028e0:	0f 45 fe             	cmovne %esi,%edi
+  8028e3:	0f 45 f3             	cmovne %ebx,%esi
+  8028e6:	29 f0                	sub    %esi,%eax
+  8028e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8028ed:	19 fa                	sbb    %edi,%edx
+  8028ef:	31 ff                	xor    %edi,%edi
+  8028f1:	31 db                	xor    %ebx,%ebx
+  8028f3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8028f6:	d3 e6                	shl    %cl,%esi
+  8028f8:	f6 c1 20             	test   $0x20,%cl
+  8028fb:	0f 45 fe             	cmovne %esi,%edi
+  8028fe:	0f 45 f3             	cmovne %ebx,%esi
+  802901:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802905:	09 74 24 08          	or     %esi,0x8(%esp)
+  802909:	83 ed 01             	sub    $0x1,%ebp
+  80290c:	73 9a                	jae    8028a8 <__udivdi3+0x48>
+  80290e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802912:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802916:	83 c4 14             	add    $0x14,%esp
+  802919:	5b                   	pop    %ebx
+  80291a:	5e                   	pop    %esi
+  80291b:	5f                   	pop    %edi
+  80291c:	5d                   	pop    %ebp
+  80291d:	c3                   	ret
+  80291e:	66 90                	xchg   %ax,%ax
+
+00802920 <__umoddi3>:
+  802920:	57                   	push   %edi
+  802921:	56                   	push   %esi
+  802922:	53                   	push   %ebx
+  802923:	83 ec 08             	sub    $0x8,%esp
+  802926:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80292a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80292e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802932:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802936:	89 f9                	mov    %edi,%ecx
+  802938:	89 34 24             	mov    %esi,(%esp)
+  80293b:	09 f1                	or     %esi,%ecx
+  80293d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802941:	74 53                	je     802996 <__umoddi3+0x76>
+  802943:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80294f:	90                   	nop
+  802950:	89 c6                	mov    %eax,%esi
+  802952:	89 d7                	mov    %edx,%edi
+  802954:	31 db                	xor    %ebx,%ebx
+  802956:	d3 ef                	shr    %cl,%edi
+  802958:	0f ad d6             	shrd   %cl,%edx,%esi
+  80295b:	f6 c1 20             	test   $0x20,%cl
+  80295e:	0f 45 f7             	cmovne %edi,%esi
+  802961:	0f 45 fb             	cmovne %ebx,%edi
+  802964:	8b 1c 24             	mov    (%esp),%ebx
+  802967:	39 de                	cmp    %ebx,%esi
+  802969:	89 fb                	mov    %edi,%ebx
+  80296b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80296f:	8b 34 24             	mov    (%esp),%esi
+  802972:	19 fb                	sbb    %edi,%ebx
+  802974:	72 14                	jb     80298a <__umoddi3+0x6a>
+  802976:	0f a5 f7             	shld   %cl,%esi,%edi
+  802979:	31 db                	xor    %ebx,%ebx
+  80297b:	d3 e6                	shl    %cl,%esi
+  80297d:	f6 c1 20             	test   $0x20,%cl
+  802980:	0f 45 fe             	cmovne %esi,%edi
+  802983:	0f 45 f3             	cmovne %ebx,%esi
+  802986:	29 f0                	sub    %esi,%eax
+  802988:	19 fa                	sbb    %edi,%edx
+  80298a:	83 e9 01             	sub    $0x1,%ecx
+  80298d:	73 c1                	jae    802950 <__umoddi3+0x30>
+  80298f:	83 c4 08             	add    $0x8,%esp
+  802992:	5b                   	pop    %ebx
+  802993:	5e                   	pop    %esi
+  802994:	5f                   	pop    %edi
+  802995:	c3                   	ret
+  802996:	83 c4 08             	add    $0x8,%esp
+  802999:	31 c0                	xor    %eax,%eax
+  80299b:	31 d2                	xor    %edx,%edx
+  80299d:	5b                   	pop    %ebx
+  80299e:	5e                   	pop    %esi
+  80299f:	5f                   	pop    %edi
+  8029a0:	c3                   	ret
+  8029a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029af:	90                   	nop
+
+008029b0 <__divdi3>:
+  8029b0:	55                   	push   %ebp
+  8029b1:	57                   	push   %edi
+  8029b2:	56                   	push   %esi
+  8029b3:	53                   	push   %ebx
+  8029b4:	83 ec 1c             	sub    $0x1c,%esp
+  8029b7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8029bb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8029bf:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8029c3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8029c7:	85 ff                	test   %edi,%edi
+  8029c9:	0f 88 da 00 00 00    	js     802aa9 <__divdi3+0xf9>
+  8029cf:	85 db                	test   %ebx,%ebx
+  8029d1:	78 16                	js     8029e9 <__divdi3+0x39>
+  8029d3:	89 dd                	mov    %ebx,%ebp
+  8029d5:	89 c8                	mov    %ecx,%eax
+  8029d7:	89 da                	mov    %ebx,%edx
+  8029d9:	09 cd                	or     %ecx,%ebp
+  8029db:	0f 85 fd 00 00 00    	jne    802ade <__divdi3+0x12e>
+  8029e1:	83 c4 1c             	add    $0x1c,%esp
+  8029e4:	5b                   	pop    %ebx
+  8029e5:	5e                   	pop    %esi
+  8029e6:	5f                   	pop    %edi
+  8029e7:	5d                   	pop    %ebp
+  8029e8:	c3                   	ret
+  8029e9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8029ee:	f7 d9                	neg    %ecx
+  8029f0:	89 f0                	mov    %esi,%eax
+  8029f2:	89 fa                	mov    %edi,%edx
+  8029f4:	83 d3 00             	adc    $0x0,%ebx
+  8029f7:	89 0c 24             	mov    %ecx,(%esp)
+  8029fa:	f7 db                	neg    %ebx
+  8029fc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a00:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802a07:	00 
+  802a08:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a0d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802a14:	00 
+  802a15:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a19:	89 cd                	mov    %ecx,%ebp
+  802a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802a1f:	90                   	nop
+  802a20:	89 e9                	mov    %ebp,%ecx
+  802a22:	89 c3                	mov    %eax,%ebx
+  802a24:	89 d6                	mov    %edx,%esi
+  802a26:	31 ff                	xor    %edi,%edi
+  802a28:	d3 ee                	shr    %cl,%esi
+  802a2a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a2d:	f6 c1 20             	test   $0x20,%cl
+  802a30:	0f 45 de             	cmovne %esi,%ebx
+  802a33:	0f 45 f7             	cmovne %edi,%esi
+  802a36:	8b 3c 24             	mov    (%esp),%edi
+  802a39:	39 fb                	cmp    %edi,%ebx
+  802a3b:	89 f7                	mov    %esi,%edi
+  802a3d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802a41:	8b 1c 24             	mov    (%esp),%ebx
+  802a44:	19 f7                	sbb    %esi,%edi
+  802a46:	72 39                	jb     802a81 <__divdi3+0xd1>
+  802a48:	89 e9                	mov    %ebp,%ecx
+  802a4a:	89 f7                	mov    %esi,%edi
+  802a4c:	89 de                	mov    %ebx,%esi
+  802a4e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802a51:	d3 e6                	shl    %cl,%esi
+  802a53:	31 db                	xor    %ebx,%ebx
+  802a55:	f6 c1 20             	test   $0x20,%cl
+  802a58:	0f 45 fe             	cmovne %esi,%edi
+  802a5b:	0f 45 f3             	cmovne %ebx,%esi
+  802a5e:	29 f0                	sub    %esi,%eax
+  802a60:	be 01 00 00 00       	mov    $0x1,%esi
+  802a65:	19 fa                	sbb    %edi,%edx
+  802a67:	31 ff                	xor    %edi,%edi
+  802a69:	31 db                	xor    %ebx,%ebx
+  802a6b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802a6e:	d3 e6                	shl    %cl,%esi
+  802a70:	f6 c1 20             	test   $0x20,%cl
+  802a73:	0f 45 fe             	cmovne %esi,%edi
+  802a76:	0f 45 f3             	cmovne %ebx,%esi
+  802a79:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802a7d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802a81:	83 ed 01             	sub    $0x1,%ebp
+  802a84:	73 9a                	jae    802a20 <__divdi3+0x70>
+  802a86:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802a8a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802a8e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802a92:	85 ed                	test   %ebp,%ebp
+  802a94:	0f 84 47 ff ff ff    	je     8029e1 <__divdi3+0x31>
+  802a9a:	f7 d8                	neg    %eax
+  802a9c:	83 d2 00             	adc    $0x0,%edx
+  802a9f:	83 c4 1c             	add    $0x1c,%esp
+  802aa2:	5b                   	pop    %ebx
+  802aa3:	f7 da                	neg    %edx
+  802aa5:	5e                   	pop    %esi
+  802aa6:	5f                   	pop    %edi
+  802aa7:	5d                   	pop    %ebp
+  802aa8:	c3                   	ret
+  802aa9:	f7 de                	neg    %esi
+  802aab:	83 d7 00             	adc    $0x0,%edi
+  802aae:	f7 df                	neg    %edi
+  802ab0:	85 db                	test   %ebx,%ebx
+  802ab2:	78 23                	js     802ad7 <__divdi3+0x127>
+  802ab4:	89 dd                	mov    %ebx,%ebp
+  802ab6:	89 c8                	mov    %ecx,%eax
+  802ab8:	89 da                	mov    %ebx,%edx
+  802aba:	09 cd                	or     %ecx,%ebp
+  802abc:	0f 84 1f ff ff ff    	je     8029e1 <__divdi3+0x31>
+  802ac2:	89 0c 24             	mov    %ecx,(%esp)
+  802ac5:	89 f0                	mov    %esi,%eax
+  802ac7:	89 fa                	mov    %edi,%edx
+  802ac9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802ace:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802ad2:	e9 29 ff ff ff       	jmp    802a00 <__divdi3+0x50>
+  802ad7:	31 ed                	xor    %ebp,%ebp
+  802ad9:	e9 10 ff ff ff       	jmp    8029ee <__divdi3+0x3e>
+  802ade:	89 0c 24             	mov    %ecx,(%esp)
+  802ae1:	89 f0                	mov    %esi,%eax
+  802ae3:	89 fa                	mov    %edi,%edx
+  802ae5:	31 ed                	xor    %ebp,%ebp
+  802ae7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802aeb:	e9 10 ff ff ff       	jmp    802a00 <__divdi3+0x50>
+
+00802af0 <__moddi3>:
+  802af0:	55                   	push   %ebp
+  802af1:	57                   	push   %edi
+  802af2:	56                   	push   %esi
+  802af3:	53                   	push   %ebx
+  802af4:	83 ec 14             	sub    $0x14,%esp
+  802af7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802afb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802aff:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802b03:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802b07:	85 d2                	test   %edx,%edx
+  802b09:	0f 88 9b 00 00 00    	js     802baa <__moddi3+0xba>
+  802b0f:	89 f7                	mov    %esi,%edi
+  802b11:	31 ed                	xor    %ebp,%ebp
+  802b13:	09 cf                	or     %ecx,%edi
+  802b15:	0f 84 83 00 00 00    	je     802b9e <__moddi3+0xae>
+  802b1b:	89 cb                	mov    %ecx,%ebx
+  802b1d:	89 f7                	mov    %esi,%edi
+  802b1f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802b23:	f7 db                	neg    %ebx
+  802b25:	83 d7 00             	adc    $0x0,%edi
+  802b28:	f7 df                	neg    %edi
+  802b2a:	0f 49 f7             	cmovns %edi,%esi
+  802b2d:	0f 49 cb             	cmovns %ebx,%ecx
+  802b30:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802b34:	89 0c 24             	mov    %ecx,(%esp)
+  802b37:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802b3c:	89 cd                	mov    %ecx,%ebp
+  802b3e:	66 90                	xchg   %ax,%ax
+  802b40:	89 e9                	mov    %ebp,%ecx
+  802b42:	89 c3                	mov    %eax,%ebx
+  802b44:	89 d6                	mov    %edx,%esi
+  802b46:	31 ff                	xor    %edi,%edi
+  802b48:	d3 ee                	shr    %cl,%esi
+  802b4a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802b4d:	f6 c1 20             	test   $0x20,%cl
+  802b50:	0f 45 de             	cmovne %esi,%ebx
+  802b53:	0f 45 f7             	cmovne %edi,%esi
+  802b56:	8b 3c 24             	mov    (%esp),%edi
+  802b59:	39 fb                	cmp    %edi,%ebx
+  802b5b:	89 f7                	mov    %esi,%edi
+  802b5d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802b61:	8b 1c 24             	mov    (%esp),%ebx
+  802b64:	19 f7                	sbb    %esi,%edi
+  802b66:	72 1a                	jb     802b82 <__moddi3+0x92>
+  802b68:	89 e9                	mov    %ebp,%ecx
+  802b6a:	89 f7                	mov    %esi,%edi
+  802b6c:	89 de                	mov    %ebx,%esi
+  802b6e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802b71:	d3 e6                	shl    %cl,%esi
+  802b73:	31 db                	xor    %ebx,%ebx
+  802b75:	f6 c1 20             	test   $0x20,%cl
+  802b78:	0f 45 fe             	cmovne %esi,%edi
+  802b7b:	0f 45 f3             	cmovne %ebx,%esi
+  802b7e:	29 f0                	sub    %esi,%eax
+  802b80:	19 fa                	sbb    %edi,%edx
+  802b82:	83 ed 01             	sub    $0x1,%ebp
+  802b85:	73 b9                	jae    802b40 <__moddi3+0x50>
+  802b87:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802b8b:	85 ed                	test   %ebp,%ebp
+  802b8d:	74 07                	je     802b96 <__moddi3+0xa6>
+  802b8f:	f7 d8                	neg    %eax
+  802b91:	83 d2 00             	adc    $0x0,%edx
+  802b94:	f7 da                	neg    %edx
+  802b96:	83 c4 14             	add    $0x14,%esp
+  802b99:	5b                   	pop    %ebx
+  802b9a:	5e                   	pop    %esi
+  802b9b:	5f                   	pop    %edi
+  802b9c:	5d                   	pop    %ebp
+  802b9d:	c3                   	ret
+  802b9e:	83 c4 14             	add    $0x14,%esp
+  802ba1:	31 c0                	xor    %eax,%eax
+  802ba3:	31 d2                	xor    %edx,%edx
+  802ba5:	5b                   	pop    %ebx
+  802ba6:	5e                   	pop    %esi
+  802ba7:	5f                   	pop    %edi
+  802ba8:	5d                   	pop    %ebp
+  802ba9:	c3                   	ret
+  802baa:	89 f7                	mov    %esi,%edi
+  802bac:	09 cf                	or     %ecx,%edi
+  802bae:	74 11                	je     802bc1 <__moddi3+0xd1>
+  802bb0:	f7 d8                	neg    %eax
+  802bb2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802bb7:	83 d2 00             	adc    $0x0,%edx
+  802bba:	f7 da                	neg    %edx
+  802bbc:	e9 5a ff ff ff       	jmp    802b1b <__moddi3+0x2b>
+  802bc1:	31 c0                	xor    %eax,%eax
+  802bc3:	31 d2                	xor    %edx,%edx
+  802bc5:	eb c8                	jmp    802b8f <__moddi3+0x9f>
@@ -0,0 +1,8150 @@
+
+obj/user/sh.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f2 09 00 00       	call   800a23 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <_gettoken>:
+#define WHITESPACE " \t\r\n"
+#define SYMBOLS "<|>&;()"
+
+int
+_gettoken(char *s, char **p1, char **p2)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int t;
+
+	if (s == 0) {
+  800042:	85 db                	test   %ebx,%ebx
+  800044:	74 1a                	je     800060 <_gettoken+0x2d>
+		if (debug > 1)
+			cprintf("GETTOKEN NULL\n");
+		return 0;
+	}
+
+	if (debug > 1)
+  800046:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  80004d:	7f 31                	jg     800080 <_gettoken+0x4d>
+		cprintf("GETTOKEN: %s\n", s);
+
+	*p1 = 0;
+  80004f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	*p2 = 0;
+  800055:	8b 45 10             	mov    0x10(%ebp),%eax
+  800058:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+	while (strchr(WHITESPACE, *s))
+  80005e:	eb 3a                	jmp    80009a <_gettoken+0x67>
+		return 0;
+  800060:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  800065:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  80006c:	7e 59                	jle    8000c7 <_gettoken+0x94>
+			cprintf("GETTOKEN NULL\n");
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	68 20 3d 80 00       	push   $0x803d20
+  800076:	e8 e3 0a 00 00       	call   800b5e <cprintf>
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	eb 47                	jmp    8000c7 <_gettoken+0x94>
+		cprintf("GETTOKEN: %s\n", s);
+  800080:	83 ec 08             	sub    $0x8,%esp
+  800083:	53                   	push   %ebx
+  800084:	68 2f 3d 80 00       	push   $0x803d2f
+  800089:	e8 d0 0a 00 00       	call   800b5e <cprintf>
+  80008e:	83 c4 10             	add    $0x10,%esp
+  800091:	eb bc                	jmp    80004f <_gettoken+0x1c>
+		*s++ = 0;
+  800093:	83 c3 01             	add    $0x1,%ebx
+  800096:	c6 43 ff 00          	movb   $0x0,-0x1(%ebx)
+	while (strchr(WHITESPACE, *s))
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	0f be 03             	movsbl (%ebx),%eax
+  8000a0:	50                   	push   %eax
+  8000a1:	68 3d 3d 80 00       	push   $0x803d3d
+  8000a6:	e8 a3 12 00 00       	call   80134e <strchr>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	85 c0                	test   %eax,%eax
+  8000b0:	75 e1                	jne    800093 <_gettoken+0x60>
+	if (*s == 0) {
+  8000b2:	0f b6 03             	movzbl (%ebx),%eax
+  8000b5:	84 c0                	test   %al,%al
+  8000b7:	75 2a                	jne    8000e3 <_gettoken+0xb0>
+		if (debug > 1)
+			cprintf("EOL\n");
+		return 0;
+  8000b9:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  8000be:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  8000c5:	7f 0a                	jg     8000d1 <_gettoken+0x9e>
+		**p2 = 0;
+		cprintf("WORD: %s\n", *p1);
+		**p2 = t;
+	}
+	return 'w';
+}
+  8000c7:	89 f0                	mov    %esi,%eax
+  8000c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5f                   	pop    %edi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+			cprintf("EOL\n");
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	68 42 3d 80 00       	push   $0x803d42
+  8000d9:	e8 80 0a 00 00       	call   800b5e <cprintf>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	eb e4                	jmp    8000c7 <_gettoken+0x94>
+	if (strchr(SYMBOLS, *s)) {
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+  8000e6:	0f be c0             	movsbl %al,%eax
+  8000e9:	50                   	push   %eax
+  8000ea:	68 53 3d 80 00       	push   $0x803d53
+  8000ef:	e8 5a 12 00 00       	call   80134e <strchr>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	85 c0                	test   %eax,%eax
+  8000f9:	74 2c                	je     800127 <_gettoken+0xf4>
+		t = *s;
+  8000fb:	0f be 33             	movsbl (%ebx),%esi
+		*p1 = s;
+  8000fe:	89 1f                	mov    %ebx,(%edi)
+		*s++ = 0;
+  800100:	c6 03 00             	movb   $0x0,(%ebx)
+  800103:	83 c3 01             	add    $0x1,%ebx
+  800106:	8b 45 10             	mov    0x10(%ebp),%eax
+  800109:	89 18                	mov    %ebx,(%eax)
+		if (debug > 1)
+  80010b:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  800112:	7e b3                	jle    8000c7 <_gettoken+0x94>
+			cprintf("TOK %c\n", t);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	68 47 3d 80 00       	push   $0x803d47
+  80011d:	e8 3c 0a 00 00       	call   800b5e <cprintf>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb a0                	jmp    8000c7 <_gettoken+0x94>
+	*p1 = s;
+  800127:	89 1f                	mov    %ebx,(%edi)
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  800129:	eb 03                	jmp    80012e <_gettoken+0xfb>
+		s++;
+  80012b:	83 c3 01             	add    $0x1,%ebx
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  80012e:	0f b6 03             	movzbl (%ebx),%eax
+  800131:	84 c0                	test   %al,%al
+  800133:	74 18                	je     80014d <_gettoken+0x11a>
+  800135:	83 ec 08             	sub    $0x8,%esp
+  800138:	0f be c0             	movsbl %al,%eax
+  80013b:	50                   	push   %eax
+  80013c:	68 4f 3d 80 00       	push   $0x803d4f
+  800141:	e8 08 12 00 00       	call   80134e <strchr>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	85 c0                	test   %eax,%eax
+  80014b:	74 de                	je     80012b <_gettoken+0xf8>
+	*p2 = s;
+  80014d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800150:	89 18                	mov    %ebx,(%eax)
+	return 'w';
+  800152:	be 77 00 00 00       	mov    $0x77,%esi
+	if (debug > 1) {
+  800157:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  80015e:	0f 8e 63 ff ff ff    	jle    8000c7 <_gettoken+0x94>
+		t = **p2;
+  800164:	0f b6 33             	movzbl (%ebx),%esi
+		**p2 = 0;
+  800167:	c6 03 00             	movb   $0x0,(%ebx)
+		cprintf("WORD: %s\n", *p1);
+  80016a:	83 ec 08             	sub    $0x8,%esp
+  80016d:	ff 37                	push   (%edi)
+  80016f:	68 5b 3d 80 00       	push   $0x803d5b
+  800174:	e8 e5 09 00 00       	call   800b5e <cprintf>
+		**p2 = t;
+  800179:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017c:	8b 00                	mov    (%eax),%eax
+  80017e:	89 f2                	mov    %esi,%edx
+  800180:	88 10                	mov    %dl,(%eax)
+  800182:	83 c4 10             	add    $0x10,%esp
+	return 'w';
+  800185:	be 77 00 00 00       	mov    $0x77,%esi
+  80018a:	e9 38 ff ff ff       	jmp    8000c7 <_gettoken+0x94>
+
+0080018f <gettoken>:
+
+int
+gettoken(char *s, char **p1)
+{
+  80018f:	55                   	push   %ebp
+  800190:	89 e5                	mov    %esp,%ebp
+  800192:	83 ec 08             	sub    $0x8,%esp
+  800195:	8b 45 08             	mov    0x8(%ebp),%eax
+	static int c, nc;
+	static char* np1, *np2;
+
+	if (s) {
+  800198:	85 c0                	test   %eax,%eax
+  80019a:	74 22                	je     8001be <gettoken+0x2f>
+		nc = _gettoken(s, &np1, &np2);
+  80019c:	83 ec 04             	sub    $0x4,%esp
+  80019f:	68 0c 60 80 00       	push   $0x80600c
+  8001a4:	68 10 60 80 00       	push   $0x806010
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 84 fe ff ff       	call   800033 <_gettoken>
+  8001af:	a3 08 60 80 00       	mov    %eax,0x806008
+		return 0;
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	c = nc;
+	*p1 = np1;
+	nc = _gettoken(np2, &np1, &np2);
+	return c;
+}
+  8001bc:	c9                   	leave
+  8001bd:	c3                   	ret
+	c = nc;
+  8001be:	a1 08 60 80 00       	mov    0x806008,%eax
+  8001c3:	a3 04 60 80 00       	mov    %eax,0x806004
+	*p1 = np1;
+  8001c8:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  8001ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8001d1:	89 10                	mov    %edx,(%eax)
+	nc = _gettoken(np2, &np1, &np2);
+  8001d3:	83 ec 04             	sub    $0x4,%esp
+  8001d6:	68 0c 60 80 00       	push   $0x80600c
+  8001db:	68 10 60 80 00       	push   $0x806010
+  8001e0:	ff 35 0c 60 80 00    	push   0x80600c
+  8001e6:	e8 48 fe ff ff       	call   800033 <_gettoken>
+  8001eb:	a3 08 60 80 00       	mov    %eax,0x806008
+	return c;
+  8001f0:	a1 04 60 80 00       	mov    0x806004,%eax
+  8001f5:	83 c4 10             	add    $0x10,%esp
+  8001f8:	eb c2                	jmp    8001bc <gettoken+0x2d>
+
+008001fa <runcmd>:
+{
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	57                   	push   %edi
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	81 ec 74 04 00 00    	sub    $0x474,%esp
+	gettoken(s, 0);
+  800206:	6a 00                	push   $0x0
+  800208:	ff 75 08             	push   0x8(%ebp)
+  80020b:	e8 7f ff ff ff       	call   80018f <gettoken>
+  800210:	83 c4 10             	add    $0x10,%esp
+		switch ((c = gettoken(0, &t))) {
+  800213:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	argc = 0;
+  800216:	bb 00 00 00 00       	mov    $0x0,%ebx
+		switch ((c = gettoken(0, &t))) {
+  80021b:	83 ec 08             	sub    $0x8,%esp
+  80021e:	56                   	push   %esi
+  80021f:	6a 00                	push   $0x0
+  800221:	e8 69 ff ff ff       	call   80018f <gettoken>
+  800226:	89 c7                	mov    %eax,%edi
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	83 f8 3e             	cmp    $0x3e,%eax
+  80022e:	0f 84 3f 01 00 00    	je     800373 <runcmd+0x179>
+  800234:	7f 53                	jg     800289 <runcmd+0x8f>
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 84 36 02 00 00    	je     800474 <runcmd+0x27a>
+  80023e:	83 f8 3c             	cmp    $0x3c,%eax
+  800241:	0f 85 09 03 00 00    	jne    800550 <runcmd+0x356>
+			if (gettoken(0, &t) != 'w') {
+  800247:	83 ec 08             	sub    $0x8,%esp
+  80024a:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  80024d:	50                   	push   %eax
+  80024e:	6a 00                	push   $0x0
+  800250:	e8 3a ff ff ff       	call   80018f <gettoken>
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	83 f8 77             	cmp    $0x77,%eax
+  80025b:	0f 85 c1 00 00 00    	jne    800322 <runcmd+0x128>
+			if ((fd = open(t, O_RDONLY)) < 0) {
+  800261:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800264:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  80026a:	83 ec 08             	sub    $0x8,%esp
+  80026d:	6a 00                	push   $0x0
+  80026f:	50                   	push   %eax
+  800270:	e8 50 24 00 00       	call   8026c5 <open>
+  800275:	89 c7                	mov    %eax,%edi
+  800277:	83 c4 10             	add    $0x10,%esp
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 ba 00 00 00    	js     80033c <runcmd+0x142>
+			if (fd != 0) {
+  800282:	74 97                	je     80021b <runcmd+0x21>
+  800284:	e9 cf 00 00 00       	jmp    800358 <runcmd+0x15e>
+		switch ((c = gettoken(0, &t))) {
+  800289:	83 f8 77             	cmp    $0x77,%eax
+  80028c:	74 69                	je     8002f7 <runcmd+0xfd>
+  80028e:	83 f8 7c             	cmp    $0x7c,%eax
+  800291:	0f 85 b9 02 00 00    	jne    800550 <runcmd+0x356>
+			if ((r = pipe(p)) < 0) {
+  800297:	83 ec 0c             	sub    $0xc,%esp
+  80029a:	8d 85 9c fb ff ff    	lea    -0x464(%ebp),%eax
+  8002a0:	50                   	push   %eax
+  8002a1:	e8 ad 32 00 00       	call   803553 <pipe>
+  8002a6:	83 c4 10             	add    $0x10,%esp
+  8002a9:	85 c0                	test   %eax,%eax
+  8002ab:	0f 88 51 01 00 00    	js     800402 <runcmd+0x208>
+			if (debug)
+  8002b1:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8002b8:	0f 85 5f 01 00 00    	jne    80041d <runcmd+0x223>
+			if ((r = fork()) < 0) {
+  8002be:	e8 e6 18 00 00       	call   801ba9 <fork>
+  8002c3:	89 c7                	mov    %eax,%edi
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	0f 88 71 01 00 00    	js     80043e <runcmd+0x244>
+			if (r == 0) {
+  8002cd:	0f 85 81 01 00 00    	jne    800454 <runcmd+0x25a>
+				if (p[0] != 0) {
+  8002d3:	8b 85 9c fb ff ff    	mov    -0x464(%ebp),%eax
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	0f 85 2d 02 00 00    	jne    80050e <runcmd+0x314>
+				close(p[1]);
+  8002e1:	83 ec 0c             	sub    $0xc,%esp
+  8002e4:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  8002ea:	e8 37 1e 00 00       	call   802126 <close>
+				goto again;
+  8002ef:	83 c4 10             	add    $0x10,%esp
+  8002f2:	e9 1f ff ff ff       	jmp    800216 <runcmd+0x1c>
+			if (argc == MAXARGS) {
+  8002f7:	83 fb 10             	cmp    $0x10,%ebx
+  8002fa:	74 0f                	je     80030b <runcmd+0x111>
+			argv[argc++] = t;
+  8002fc:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8002ff:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+  800303:	8d 5b 01             	lea    0x1(%ebx),%ebx
+			break;
+  800306:	e9 10 ff ff ff       	jmp    80021b <runcmd+0x21>
+				cprintf("too many arguments\n");
+  80030b:	83 ec 0c             	sub    $0xc,%esp
+  80030e:	68 65 3d 80 00       	push   $0x803d65
+  800313:	e8 46 08 00 00       	call   800b5e <cprintf>
+				exit();
+  800318:	e8 4c 07 00 00       	call   800a69 <exit>
+  80031d:	83 c4 10             	add    $0x10,%esp
+  800320:	eb da                	jmp    8002fc <runcmd+0x102>
+				cprintf("syntax error: < not followed by word\n");
+  800322:	83 ec 0c             	sub    $0xc,%esp
+  800325:	68 b0 3e 80 00       	push   $0x803eb0
+  80032a:	e8 2f 08 00 00       	call   800b5e <cprintf>
+				exit();
+  80032f:	e8 35 07 00 00       	call   800a69 <exit>
+  800334:	83 c4 10             	add    $0x10,%esp
+  800337:	e9 25 ff ff ff       	jmp    800261 <runcmd+0x67>
+				cprintf("open %s for read: %e", t, fd);
+  80033c:	83 ec 04             	sub    $0x4,%esp
+  80033f:	50                   	push   %eax
+  800340:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  800346:	68 79 3d 80 00       	push   $0x803d79
+  80034b:	e8 0e 08 00 00       	call   800b5e <cprintf>
+				exit();
+  800350:	e8 14 07 00 00       	call   800a69 <exit>
+  800355:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 0);
+  800358:	83 ec 08             	sub    $0x8,%esp
+  80035b:	6a 00                	push   $0x0
+  80035d:	57                   	push   %edi
+  80035e:	e8 15 1e 00 00       	call   802178 <dup>
+				close(fd);
+  800363:	89 3c 24             	mov    %edi,(%esp)
+  800366:	e8 bb 1d 00 00       	call   802126 <close>
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	e9 a8 fe ff ff       	jmp    80021b <runcmd+0x21>
+			if (gettoken(0, &t) != 'w') {
+  800373:	83 ec 08             	sub    $0x8,%esp
+  800376:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  800379:	50                   	push   %eax
+  80037a:	6a 00                	push   $0x0
+  80037c:	e8 0e fe ff ff       	call   80018f <gettoken>
+  800381:	83 c4 10             	add    $0x10,%esp
+  800384:	83 f8 77             	cmp    $0x77,%eax
+  800387:	75 2b                	jne    8003b4 <runcmd+0x1ba>
+			if ((fd = open(t, O_WRONLY|O_CREAT|O_TRUNC)) < 0) {
+  800389:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  80038c:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  800392:	83 ec 08             	sub    $0x8,%esp
+  800395:	68 01 03 00 00       	push   $0x301
+  80039a:	50                   	push   %eax
+  80039b:	e8 25 23 00 00       	call   8026c5 <open>
+  8003a0:	89 c7                	mov    %eax,%edi
+  8003a2:	83 c4 10             	add    $0x10,%esp
+  8003a5:	85 c0                	test   %eax,%eax
+  8003a7:	78 22                	js     8003cb <runcmd+0x1d1>
+			if (fd != 1) {
+  8003a9:	83 f8 01             	cmp    $0x1,%eax
+  8003ac:	0f 84 69 fe ff ff    	je     80021b <runcmd+0x21>
+  8003b2:	eb 33                	jmp    8003e7 <runcmd+0x1ed>
+				cprintf("syntax error: > not followed by word\n");
+  8003b4:	83 ec 0c             	sub    $0xc,%esp
+  8003b7:	68 d8 3e 80 00       	push   $0x803ed8
+  8003bc:	e8 9d 07 00 00       	call   800b5e <cprintf>
+				exit();
+  8003c1:	e8 a3 06 00 00       	call   800a69 <exit>
+  8003c6:	83 c4 10             	add    $0x10,%esp
+  8003c9:	eb be                	jmp    800389 <runcmd+0x18f>
+				cprintf("open %s for write: %e", t, fd);
+  8003cb:	83 ec 04             	sub    $0x4,%esp
+  8003ce:	50                   	push   %eax
+  8003cf:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  8003d5:	68 8e 3d 80 00       	push   $0x803d8e
+  8003da:	e8 7f 07 00 00       	call   800b5e <cprintf>
+				exit();
+  8003df:	e8 85 06 00 00       	call   800a69 <exit>
+  8003e4:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 1);
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	6a 01                	push   $0x1
+  8003ec:	57                   	push   %edi
+  8003ed:	e8 86 1d 00 00       	call   802178 <dup>
+				close(fd);
+  8003f2:	89 3c 24             	mov    %edi,(%esp)
+  8003f5:	e8 2c 1d 00 00       	call   802126 <close>
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	e9 19 fe ff ff       	jmp    80021b <runcmd+0x21>
+				cprintf("pipe: %e", r);
+  800402:	83 ec 08             	sub    $0x8,%esp
+  800405:	50                   	push   %eax
+  800406:	68 a4 3d 80 00       	push   $0x803da4
+  80040b:	e8 4e 07 00 00       	call   800b5e <cprintf>
+				exit();
+  800410:	e8 54 06 00 00       	call   800a69 <exit>
+  800415:	83 c4 10             	add    $0x10,%esp
+  800418:	e9 94 fe ff ff       	jmp    8002b1 <runcmd+0xb7>
+				cprintf("PIPE: %d %d\n", p[0], p[1]);
+  80041d:	83 ec 04             	sub    $0x4,%esp
+  800420:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800426:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80042c:	68 ad 3d 80 00       	push   $0x803dad
+  800431:	e8 28 07 00 00       	call   800b5e <cprintf>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	e9 80 fe ff ff       	jmp    8002be <runcmd+0xc4>
+				cprintf("fork: %e", r);
+  80043e:	83 ec 08             	sub    $0x8,%esp
+  800441:	50                   	push   %eax
+  800442:	68 f4 42 80 00       	push   $0x8042f4
+  800447:	e8 12 07 00 00       	call   800b5e <cprintf>
+				exit();
+  80044c:	e8 18 06 00 00       	call   800a69 <exit>
+  800451:	83 c4 10             	add    $0x10,%esp
+				if (p[1] != 1) {
+  800454:	8b 85 a0 fb ff ff    	mov    -0x460(%ebp),%eax
+  80045a:	83 f8 01             	cmp    $0x1,%eax
+  80045d:	0f 85 cc 00 00 00    	jne    80052f <runcmd+0x335>
+				close(p[0]);
+  800463:	83 ec 0c             	sub    $0xc,%esp
+  800466:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80046c:	e8 b5 1c 00 00       	call   802126 <close>
+				goto runit;
+  800471:	83 c4 10             	add    $0x10,%esp
+	if(argc == 0) {
+  800474:	85 db                	test   %ebx,%ebx
+  800476:	0f 84 e6 00 00 00    	je     800562 <runcmd+0x368>
+	if (argv[0][0] != '/') {
+  80047c:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  80047f:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800482:	0f 85 f5 00 00 00    	jne    80057d <runcmd+0x383>
+	argv[argc] = 0;
+  800488:	c7 44 9d a8 00 00 00 	movl   $0x0,-0x58(%ebp,%ebx,4)
+  80048f:	00 
+	if (debug) {
+  800490:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800497:	0f 85 08 01 00 00    	jne    8005a5 <runcmd+0x3ab>
+	if ((r = spawn(argv[0], (const char**) argv)) < 0)
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  8004a3:	50                   	push   %eax
+  8004a4:	ff 75 a8             	push   -0x58(%ebp)
+  8004a7:	e8 d2 23 00 00       	call   80287e <spawn>
+  8004ac:	89 c3                	mov    %eax,%ebx
+  8004ae:	83 c4 10             	add    $0x10,%esp
+  8004b1:	85 c0                	test   %eax,%eax
+  8004b3:	0f 88 3a 01 00 00    	js     8005f3 <runcmd+0x3f9>
+	close_all();
+  8004b9:	e8 95 1c 00 00       	call   802153 <close_all>
+		if (debug)
+  8004be:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8004c5:	0f 85 75 01 00 00    	jne    800640 <runcmd+0x446>
+		wait(r);
+  8004cb:	83 ec 0c             	sub    $0xc,%esp
+  8004ce:	53                   	push   %ebx
+  8004cf:	e8 fc 31 00 00       	call   8036d0 <wait>
+		if (debug)
+  8004d4:	83 c4 10             	add    $0x10,%esp
+  8004d7:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8004de:	0f 85 7b 01 00 00    	jne    80065f <runcmd+0x465>
+	if (pipe_child) {
+  8004e4:	85 ff                	test   %edi,%edi
+  8004e6:	74 19                	je     800501 <runcmd+0x307>
+		wait(pipe_child);
+  8004e8:	83 ec 0c             	sub    $0xc,%esp
+  8004eb:	57                   	push   %edi
+  8004ec:	e8 df 31 00 00       	call   8036d0 <wait>
+		if (debug)
+  8004f1:	83 c4 10             	add    $0x10,%esp
+  8004f4:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8004fb:	0f 85 79 01 00 00    	jne    80067a <runcmd+0x480>
+	exit();
+  800501:	e8 63 05 00 00       	call   800a69 <exit>
+}
+  800506:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800509:	5b                   	pop    %ebx
+  80050a:	5e                   	pop    %esi
+  80050b:	5f                   	pop    %edi
+  80050c:	5d                   	pop    %ebp
+  80050d:	c3                   	ret
+					dup(p[0], 0);
+  80050e:	83 ec 08             	sub    $0x8,%esp
+  800511:	6a 00                	push   $0x0
+  800513:	50                   	push   %eax
+  800514:	e8 5f 1c 00 00       	call   802178 <dup>
+					close(p[0]);
+  800519:	83 c4 04             	add    $0x4,%esp
+  80051c:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  800522:	e8 ff 1b 00 00       	call   802126 <close>
+  800527:	83 c4 10             	add    $0x10,%esp
+  80052a:	e9 b2 fd ff ff       	jmp    8002e1 <runcmd+0xe7>
+					dup(p[1], 1);
+  80052f:	83 ec 08             	sub    $0x8,%esp
+  800532:	6a 01                	push   $0x1
+  800534:	50                   	push   %eax
+  800535:	e8 3e 1c 00 00       	call   802178 <dup>
+					close(p[1]);
+  80053a:	83 c4 04             	add    $0x4,%esp
+  80053d:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800543:	e8 de 1b 00 00       	call   802126 <close>
+  800548:	83 c4 10             	add    $0x10,%esp
+  80054b:	e9 13 ff ff ff       	jmp    800463 <runcmd+0x269>
+			panic("bad return %d from gettoken", c);
+  800550:	57                   	push   %edi
+  800551:	68 ba 3d 80 00       	push   $0x803dba
+  800556:	6a 77                	push   $0x77
+  800558:	68 d6 3d 80 00       	push   $0x803dd6
+  80055d:	e8 21 05 00 00       	call   800a83 <_panic>
+		if (debug)
+  800562:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800569:	74 9b                	je     800506 <runcmd+0x30c>
+			cprintf("EMPTY COMMAND\n");
+  80056b:	83 ec 0c             	sub    $0xc,%esp
+  80056e:	68 e0 3d 80 00       	push   $0x803de0
+  800573:	e8 e6 05 00 00       	call   800b5e <cprintf>
+  800578:	83 c4 10             	add    $0x10,%esp
+		return;
+  80057b:	eb 89                	jmp    800506 <runcmd+0x30c>
+		argv0buf[0] = '/';
+  80057d:	c6 85 a4 fb ff ff 2f 	movb   $0x2f,-0x45c(%ebp)
+		strcpy(argv0buf + 1, argv[0]);
+  800584:	83 ec 08             	sub    $0x8,%esp
+  800587:	50                   	push   %eax
+  800588:	8d b5 a4 fb ff ff    	lea    -0x45c(%ebp),%esi
+  80058e:	8d 85 a5 fb ff ff    	lea    -0x45b(%ebp),%eax
+  800594:	50                   	push   %eax
+  800595:	e8 a2 0c 00 00       	call   80123c <strcpy>
+		argv[0] = argv0buf;
+  80059a:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  80059d:	83 c4 10             	add    $0x10,%esp
+  8005a0:	e9 e3 fe ff ff       	jmp    800488 <runcmd+0x28e>
+		cprintf("[%08x] SPAWN:", thisenv->env_id);
+  8005a5:	a1 28 64 80 00       	mov    0x806428,%eax
+  8005aa:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8005ad:	83 ec 08             	sub    $0x8,%esp
+  8005b0:	50                   	push   %eax
+  8005b1:	68 ef 3d 80 00       	push   $0x803def
+  8005b6:	e8 a3 05 00 00       	call   800b5e <cprintf>
+		for (i = 0; argv[i]; i++)
+  8005bb:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+  8005be:	83 c4 10             	add    $0x10,%esp
+  8005c1:	eb 11                	jmp    8005d4 <runcmd+0x3da>
+			cprintf(" %s", argv[i]);
+  8005c3:	83 ec 08             	sub    $0x8,%esp
+  8005c6:	50                   	push   %eax
+  8005c7:	68 77 3e 80 00       	push   $0x803e77
+  8005cc:	e8 8d 05 00 00       	call   800b5e <cprintf>
+  8005d1:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; argv[i]; i++)
+  8005d4:	83 c3 04             	add    $0x4,%ebx
+  8005d7:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  8005da:	85 c0                	test   %eax,%eax
+  8005dc:	75 e5                	jne    8005c3 <runcmd+0x3c9>
+		cprintf("\n");
+  8005de:	83 ec 0c             	sub    $0xc,%esp
+  8005e1:	68 40 3d 80 00       	push   $0x803d40
+  8005e6:	e8 73 05 00 00       	call   800b5e <cprintf>
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	e9 aa fe ff ff       	jmp    80049d <runcmd+0x2a3>
+		cprintf("spawn %s: %e\n", argv[0], r);
+  8005f3:	83 ec 04             	sub    $0x4,%esp
+  8005f6:	50                   	push   %eax
+  8005f7:	ff 75 a8             	push   -0x58(%ebp)
+  8005fa:	68 fd 3d 80 00       	push   $0x803dfd
+  8005ff:	e8 5a 05 00 00       	call   800b5e <cprintf>
+	close_all();
+  800604:	e8 4a 1b 00 00       	call   802153 <close_all>
+	if (r >= 0) {
+  800609:	83 c4 10             	add    $0x10,%esp
+	if (pipe_child) {
+  80060c:	85 ff                	test   %edi,%edi
+  80060e:	0f 84 ed fe ff ff    	je     800501 <runcmd+0x307>
+		if (debug)
+  800614:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80061b:	0f 84 c7 fe ff ff    	je     8004e8 <runcmd+0x2ee>
+			cprintf("[%08x] WAIT pipe_child %08x\n", thisenv->env_id, pipe_child);
+  800621:	a1 28 64 80 00       	mov    0x806428,%eax
+  800626:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800629:	83 ec 04             	sub    $0x4,%esp
+  80062c:	57                   	push   %edi
+  80062d:	50                   	push   %eax
+  80062e:	68 36 3e 80 00       	push   $0x803e36
+  800633:	e8 26 05 00 00       	call   800b5e <cprintf>
+  800638:	83 c4 10             	add    $0x10,%esp
+  80063b:	e9 a8 fe ff ff       	jmp    8004e8 <runcmd+0x2ee>
+			cprintf("[%08x] WAIT %s %08x\n", thisenv->env_id, argv[0], r);
+  800640:	a1 28 64 80 00       	mov    0x806428,%eax
+  800645:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800648:	53                   	push   %ebx
+  800649:	ff 75 a8             	push   -0x58(%ebp)
+  80064c:	50                   	push   %eax
+  80064d:	68 0b 3e 80 00       	push   $0x803e0b
+  800652:	e8 07 05 00 00       	call   800b5e <cprintf>
+  800657:	83 c4 10             	add    $0x10,%esp
+  80065a:	e9 6c fe ff ff       	jmp    8004cb <runcmd+0x2d1>
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  80065f:	a1 28 64 80 00       	mov    0x806428,%eax
+  800664:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800667:	83 ec 08             	sub    $0x8,%esp
+  80066a:	50                   	push   %eax
+  80066b:	68 20 3e 80 00       	push   $0x803e20
+  800670:	e8 e9 04 00 00       	call   800b5e <cprintf>
+  800675:	83 c4 10             	add    $0x10,%esp
+  800678:	eb 92                	jmp    80060c <runcmd+0x412>
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  80067a:	a1 28 64 80 00       	mov    0x806428,%eax
+  80067f:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800682:	83 ec 08             	sub    $0x8,%esp
+  800685:	50                   	push   %eax
+  800686:	68 20 3e 80 00       	push   $0x803e20
+  80068b:	e8 ce 04 00 00       	call   800b5e <cprintf>
+  800690:	83 c4 10             	add    $0x10,%esp
+  800693:	e9 69 fe ff ff       	jmp    800501 <runcmd+0x307>
+
+00800698 <usage>:
+
+
+void
+usage(void)
+{
+  800698:	55                   	push   %ebp
+  800699:	89 e5                	mov    %esp,%ebp
+  80069b:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: sh [-dix] [command-file]\n");
+  80069e:	68 00 3f 80 00       	push   $0x803f00
+  8006a3:	e8 b6 04 00 00       	call   800b5e <cprintf>
+	exit();
+  8006a8:	e8 bc 03 00 00       	call   800a69 <exit>
+}
+  8006ad:	83 c4 10             	add    $0x10,%esp
+  8006b0:	c9                   	leave
+  8006b1:	c3                   	ret
+
+008006b2 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8006b2:	55                   	push   %ebp
+  8006b3:	89 e5                	mov    %esp,%ebp
+  8006b5:	57                   	push   %edi
+  8006b6:	56                   	push   %esi
+  8006b7:	53                   	push   %ebx
+  8006b8:	83 ec 30             	sub    $0x30,%esp
+	int r, interactive, echocmds;
+	struct Argstate args;
+
+	interactive = '?';
+	echocmds = 0;
+	argstart(&argc, argv, &args);
+  8006bb:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  8006be:	50                   	push   %eax
+  8006bf:	ff 75 0c             	push   0xc(%ebp)
+  8006c2:	8d 45 08             	lea    0x8(%ebp),%eax
+  8006c5:	50                   	push   %eax
+  8006c6:	e8 65 17 00 00       	call   801e30 <argstart>
+	while ((r = argnext(&args)) >= 0)
+  8006cb:	83 c4 10             	add    $0x10,%esp
+	echocmds = 0;
+  8006ce:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	interactive = '?';
+  8006d5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+	while ((r = argnext(&args)) >= 0)
+  8006da:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+		switch (r) {
+		case 'd':
+			debug++;
+			break;
+		case 'i':
+			interactive = 1;
+  8006dd:	be 01 00 00 00       	mov    $0x1,%esi
+	while ((r = argnext(&args)) >= 0)
+  8006e2:	eb 10                	jmp    8006f4 <umain+0x42>
+			debug++;
+  8006e4:	83 05 00 60 80 00 01 	addl   $0x1,0x806000
+			break;
+  8006eb:	eb 07                	jmp    8006f4 <umain+0x42>
+			interactive = 1;
+  8006ed:	89 f7                	mov    %esi,%edi
+  8006ef:	eb 03                	jmp    8006f4 <umain+0x42>
+		switch (r) {
+  8006f1:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+	while ((r = argnext(&args)) >= 0)
+  8006f4:	83 ec 0c             	sub    $0xc,%esp
+  8006f7:	53                   	push   %ebx
+  8006f8:	e8 63 17 00 00       	call   801e60 <argnext>
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	85 c0                	test   %eax,%eax
+  800702:	78 16                	js     80071a <umain+0x68>
+		switch (r) {
+  800704:	83 f8 69             	cmp    $0x69,%eax
+  800707:	74 e4                	je     8006ed <umain+0x3b>
+  800709:	83 f8 78             	cmp    $0x78,%eax
+  80070c:	74 e3                	je     8006f1 <umain+0x3f>
+  80070e:	83 f8 64             	cmp    $0x64,%eax
+  800711:	74 d1                	je     8006e4 <umain+0x32>
+			break;
+		case 'x':
+			echocmds = 1;
+			break;
+		default:
+			usage();
+  800713:	e8 80 ff ff ff       	call   800698 <usage>
+  800718:	eb da                	jmp    8006f4 <umain+0x42>
+		}
+
+	if (argc > 2)
+  80071a:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  80071e:	7f 1f                	jg     80073f <umain+0x8d>
+		usage();
+	if (argc == 2) {
+  800720:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  800724:	74 20                	je     800746 <umain+0x94>
+		close(0);
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+			panic("open %s: %e", argv[1], r);
+		assert(r == 0);
+	}
+	if (interactive == '?')
+  800726:	83 ff 3f             	cmp    $0x3f,%edi
+  800729:	74 75                	je     8007a0 <umain+0xee>
+  80072b:	85 ff                	test   %edi,%edi
+  80072d:	bf 7b 3e 80 00       	mov    $0x803e7b,%edi
+  800732:	b8 00 00 00 00       	mov    $0x0,%eax
+  800737:	0f 44 f8             	cmove  %eax,%edi
+  80073a:	e9 06 01 00 00       	jmp    800845 <umain+0x193>
+		usage();
+  80073f:	e8 54 ff ff ff       	call   800698 <usage>
+  800744:	eb da                	jmp    800720 <umain+0x6e>
+		close(0);
+  800746:	83 ec 0c             	sub    $0xc,%esp
+  800749:	6a 00                	push   $0x0
+  80074b:	e8 d6 19 00 00       	call   802126 <close>
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+  800750:	83 c4 08             	add    $0x8,%esp
+  800753:	6a 00                	push   $0x0
+  800755:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800758:	ff 70 04             	push   0x4(%eax)
+  80075b:	e8 65 1f 00 00       	call   8026c5 <open>
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	85 c0                	test   %eax,%eax
+  800765:	78 1b                	js     800782 <umain+0xd0>
+		assert(r == 0);
+  800767:	74 bd                	je     800726 <umain+0x74>
+  800769:	68 5f 3e 80 00       	push   $0x803e5f
+  80076e:	68 66 3e 80 00       	push   $0x803e66
+  800773:	68 28 01 00 00       	push   $0x128
+  800778:	68 d6 3d 80 00       	push   $0x803dd6
+  80077d:	e8 01 03 00 00       	call   800a83 <_panic>
+			panic("open %s: %e", argv[1], r);
+  800782:	83 ec 0c             	sub    $0xc,%esp
+  800785:	50                   	push   %eax
+  800786:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800789:	ff 70 04             	push   0x4(%eax)
+  80078c:	68 53 3e 80 00       	push   $0x803e53
+  800791:	68 27 01 00 00       	push   $0x127
+  800796:	68 d6 3d 80 00       	push   $0x803dd6
+  80079b:	e8 e3 02 00 00       	call   800a83 <_panic>
+		interactive = iscons(0);
+  8007a0:	83 ec 0c             	sub    $0xc,%esp
+  8007a3:	6a 00                	push   $0x0
+  8007a5:	e8 fb 01 00 00       	call   8009a5 <iscons>
+  8007aa:	89 c7                	mov    %eax,%edi
+  8007ac:	83 c4 10             	add    $0x10,%esp
+  8007af:	e9 77 ff ff ff       	jmp    80072b <umain+0x79>
+	while (1) {
+		char *buf;
+
+		buf = readline(interactive ? "$ " : NULL);
+		if (buf == NULL) {
+			if (debug)
+  8007b4:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8007bb:	75 0a                	jne    8007c7 <umain+0x115>
+				cprintf("EXITING\n");
+			exit();	// end of file
+  8007bd:	e8 a7 02 00 00       	call   800a69 <exit>
+  8007c2:	e9 94 00 00 00       	jmp    80085b <umain+0x1a9>
+				cprintf("EXITING\n");
+  8007c7:	83 ec 0c             	sub    $0xc,%esp
+  8007ca:	68 7e 3e 80 00       	push   $0x803e7e
+  8007cf:	e8 8a 03 00 00       	call   800b5e <cprintf>
+  8007d4:	83 c4 10             	add    $0x10,%esp
+  8007d7:	eb e4                	jmp    8007bd <umain+0x10b>
+		}
+		if (debug)
+			cprintf("LINE: %s\n", buf);
+  8007d9:	83 ec 08             	sub    $0x8,%esp
+  8007dc:	53                   	push   %ebx
+  8007dd:	68 87 3e 80 00       	push   $0x803e87
+  8007e2:	e8 77 03 00 00       	call   800b5e <cprintf>
+  8007e7:	83 c4 10             	add    $0x10,%esp
+  8007ea:	eb 7c                	jmp    800868 <umain+0x1b6>
+		if (buf[0] == '#')
+			continue;
+		if (echocmds)
+			printf("# %s\n", buf);
+  8007ec:	83 ec 08             	sub    $0x8,%esp
+  8007ef:	53                   	push   %ebx
+  8007f0:	68 91 3e 80 00       	push   $0x803e91
+  8007f5:	e8 6e 20 00 00       	call   802868 <printf>
+  8007fa:	83 c4 10             	add    $0x10,%esp
+  8007fd:	eb 78                	jmp    800877 <umain+0x1c5>
+		if (debug)
+			cprintf("BEFORE FORK\n");
+  8007ff:	83 ec 0c             	sub    $0xc,%esp
+  800802:	68 97 3e 80 00       	push   $0x803e97
+  800807:	e8 52 03 00 00       	call   800b5e <cprintf>
+  80080c:	83 c4 10             	add    $0x10,%esp
+  80080f:	eb 73                	jmp    800884 <umain+0x1d2>
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+  800811:	50                   	push   %eax
+  800812:	68 f4 42 80 00       	push   $0x8042f4
+  800817:	68 3f 01 00 00       	push   $0x13f
+  80081c:	68 d6 3d 80 00       	push   $0x803dd6
+  800821:	e8 5d 02 00 00       	call   800a83 <_panic>
+		if (debug)
+			cprintf("FORK: %d\n", r);
+  800826:	83 ec 08             	sub    $0x8,%esp
+  800829:	50                   	push   %eax
+  80082a:	68 a4 3e 80 00       	push   $0x803ea4
+  80082f:	e8 2a 03 00 00       	call   800b5e <cprintf>
+  800834:	83 c4 10             	add    $0x10,%esp
+  800837:	eb 5f                	jmp    800898 <umain+0x1e6>
+		if (r == 0) {
+			runcmd(buf);
+			exit();
+		} else
+			wait(r);
+  800839:	83 ec 0c             	sub    $0xc,%esp
+  80083c:	56                   	push   %esi
+  80083d:	e8 8e 2e 00 00       	call   8036d0 <wait>
+  800842:	83 c4 10             	add    $0x10,%esp
+		buf = readline(interactive ? "$ " : NULL);
+  800845:	83 ec 0c             	sub    $0xc,%esp
+  800848:	57                   	push   %edi
+  800849:	e8 c3 08 00 00       	call   801111 <readline>
+  80084e:	89 c3                	mov    %eax,%ebx
+		if (buf == NULL) {
+  800850:	83 c4 10             	add    $0x10,%esp
+  800853:	85 c0                	test   %eax,%eax
+  800855:	0f 84 59 ff ff ff    	je     8007b4 <umain+0x102>
+		if (debug)
+  80085b:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800862:	0f 85 71 ff ff ff    	jne    8007d9 <umain+0x127>
+		if (buf[0] == '#')
+  800868:	80 3b 23             	cmpb   $0x23,(%ebx)
+  80086b:	74 d8                	je     800845 <umain+0x193>
+		if (echocmds)
+  80086d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  800871:	0f 85 75 ff ff ff    	jne    8007ec <umain+0x13a>
+		if (debug)
+  800877:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80087e:	0f 85 7b ff ff ff    	jne    8007ff <umain+0x14d>
+		if ((r = fork()) < 0)
+  800884:	e8 20 13 00 00       	call   801ba9 <fork>
+  800889:	89 c6                	mov    %eax,%esi
+  80088b:	85 c0                	test   %eax,%eax
+  80088d:	78 82                	js     800811 <umain+0x15f>
+		if (debug)
+  80088f:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800896:	75 8e                	jne    800826 <umain+0x174>
+		if (r == 0) {
+  800898:	85 f6                	test   %esi,%esi
+  80089a:	75 9d                	jne    800839 <umain+0x187>
+			runcmd(buf);
+  80089c:	83 ec 0c             	sub    $0xc,%esp
+  80089f:	53                   	push   %ebx
+  8008a0:	e8 55 f9 ff ff       	call   8001fa <runcmd>
+			exit();
+  8008a5:	e8 bf 01 00 00       	call   800a69 <exit>
+  8008aa:	83 c4 10             	add    $0x10,%esp
+  8008ad:	eb 96                	jmp    800845 <umain+0x193>
+
+008008af <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8008af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b4:	c3                   	ret
+
+008008b5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8008b5:	55                   	push   %ebp
+  8008b6:	89 e5                	mov    %esp,%ebp
+  8008b8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8008bb:	68 21 3f 80 00       	push   $0x803f21
+  8008c0:	ff 75 0c             	push   0xc(%ebp)
+  8008c3:	e8 74 09 00 00       	call   80123c <strcpy>
+	return 0;
+}
+  8008c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cd:	c9                   	leave
+  8008ce:	c3                   	ret
+
+008008cf <devcons_write>:
+{
+  8008cf:	55                   	push   %ebp
+  8008d0:	89 e5                	mov    %esp,%ebp
+  8008d2:	57                   	push   %edi
+  8008d3:	56                   	push   %esi
+  8008d4:	53                   	push   %ebx
+  8008d5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8008db:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8008e0:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8008e6:	eb 2e                	jmp    800916 <devcons_write+0x47>
+		m = n - tot;
+  8008e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008eb:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8008ed:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8008f2:	39 c3                	cmp    %eax,%ebx
+  8008f4:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8008f7:	83 ec 04             	sub    $0x4,%esp
+  8008fa:	53                   	push   %ebx
+  8008fb:	89 f0                	mov    %esi,%eax
+  8008fd:	03 45 0c             	add    0xc(%ebp),%eax
+  800900:	50                   	push   %eax
+  800901:	57                   	push   %edi
+  800902:	e8 bb 0a 00 00       	call   8013c2 <memmove>
+		sys_cputs(buf, m);
+  800907:	83 c4 08             	add    $0x8,%esp
+  80090a:	53                   	push   %ebx
+  80090b:	57                   	push   %edi
+  80090c:	e8 5b 0c 00 00       	call   80156c <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800911:	01 de                	add    %ebx,%esi
+  800913:	83 c4 10             	add    $0x10,%esp
+  800916:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800919:	72 cd                	jb     8008e8 <devcons_write+0x19>
+}
+  80091b:	89 f0                	mov    %esi,%eax
+  80091d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800920:	5b                   	pop    %ebx
+  800921:	5e                   	pop    %esi
+  800922:	5f                   	pop    %edi
+  800923:	5d                   	pop    %ebp
+  800924:	c3                   	ret
+
+00800925 <devcons_read>:
+{
+  800925:	55                   	push   %ebp
+  800926:	89 e5                	mov    %esp,%ebp
+  800928:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80092b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800930:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800934:	75 07                	jne    80093d <devcons_read+0x18>
+  800936:	eb 1f                	jmp    800957 <devcons_read+0x32>
+		sys_yield();
+  800938:	e8 ec 0c 00 00       	call   801629 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80093d:	e8 48 0c 00 00       	call   80158a <sys_cgetc>
+  800942:	85 c0                	test   %eax,%eax
+  800944:	74 f2                	je     800938 <devcons_read+0x13>
+	if (c < 0)
+  800946:	78 0f                	js     800957 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  800948:	83 f8 04             	cmp    $0x4,%eax
+  80094b:	74 0c                	je     800959 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80094d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800950:	88 02                	mov    %al,(%edx)
+	return 1;
+  800952:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800957:	c9                   	leave
+  800958:	c3                   	ret
+		return 0;
+  800959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095e:	eb f7                	jmp    800957 <devcons_read+0x32>
+
+00800960 <cputchar>:
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  800966:	8b 45 08             	mov    0x8(%ebp),%eax
+  800969:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80096c:	6a 01                	push   $0x1
+  80096e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800971:	50                   	push   %eax
+  800972:	e8 f5 0b 00 00       	call   80156c <sys_cputs>
+}
+  800977:	83 c4 10             	add    $0x10,%esp
+  80097a:	c9                   	leave
+  80097b:	c3                   	ret
+
+0080097c <getchar>:
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  800982:	6a 01                	push   $0x1
+  800984:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800987:	50                   	push   %eax
+  800988:	6a 00                	push   $0x0
+  80098a:	e8 d3 18 00 00       	call   802262 <read>
+	if (r < 0)
+  80098f:	83 c4 10             	add    $0x10,%esp
+  800992:	85 c0                	test   %eax,%eax
+  800994:	78 06                	js     80099c <getchar+0x20>
+	if (r < 1)
+  800996:	74 06                	je     80099e <getchar+0x22>
+	return c;
+  800998:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80099c:	c9                   	leave
+  80099d:	c3                   	ret
+		return -E_EOF;
+  80099e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8009a3:	eb f7                	jmp    80099c <getchar+0x20>
+
+008009a5 <iscons>:
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8009ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009ae:	50                   	push   %eax
+  8009af:	ff 75 08             	push   0x8(%ebp)
+  8009b2:	e8 45 16 00 00       	call   801ffc <fd_lookup>
+  8009b7:	83 c4 10             	add    $0x10,%esp
+  8009ba:	85 c0                	test   %eax,%eax
+  8009bc:	78 11                	js     8009cf <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8009be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009c1:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8009c7:	39 10                	cmp    %edx,(%eax)
+  8009c9:	0f 94 c0             	sete   %al
+  8009cc:	0f b6 c0             	movzbl %al,%eax
+}
+  8009cf:	c9                   	leave
+  8009d0:	c3                   	ret
+
+008009d1 <opencons>:
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8009d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009da:	50                   	push   %eax
+  8009db:	e8 c6 15 00 00       	call   801fa6 <fd_alloc>
+  8009e0:	83 c4 10             	add    $0x10,%esp
+  8009e3:	85 c0                	test   %eax,%eax
+  8009e5:	78 3a                	js     800a21 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8009e7:	83 ec 04             	sub    $0x4,%esp
+  8009ea:	68 07 04 00 00       	push   $0x407
+  8009ef:	ff 75 f4             	push   -0xc(%ebp)
+  8009f2:	6a 00                	push   $0x0
+  8009f4:	e8 b0 0c 00 00       	call   8016a9 <sys_page_alloc>
+  8009f9:	83 c4 10             	add    $0x10,%esp
+  8009fc:	85 c0                	test   %eax,%eax
+  8009fe:	78 21                	js     800a21 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800a00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a03:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  800a09:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800a0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a0e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800a15:	83 ec 0c             	sub    $0xc,%esp
+  800a18:	50                   	push   %eax
+  800a19:	e8 61 15 00 00       	call   801f7f <fd2num>
+  800a1e:	83 c4 10             	add    $0x10,%esp
+}
+  800a21:	c9                   	leave
+  800a22:	c3                   	ret
+
+00800a23 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800a23:	55                   	push   %ebp
+  800a24:	89 e5                	mov    %esp,%ebp
+  800a26:	56                   	push   %esi
+  800a27:	53                   	push   %ebx
+  800a28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800a2e:	e8 d7 0b 00 00       	call   80160a <sys_getenvid>
+  800a33:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800a38:	c1 e0 09             	shl    $0x9,%eax
+  800a3b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800a40:	a3 28 64 80 00       	mov    %eax,0x806428
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800a45:	85 db                	test   %ebx,%ebx
+  800a47:	7e 07                	jle    800a50 <libmain+0x2d>
+		binaryname = argv[0];
+  800a49:	8b 06                	mov    (%esi),%eax
+  800a4b:	a3 1c 50 80 00       	mov    %eax,0x80501c
+
+	// call user main routine
+	umain(argc, argv);
+  800a50:	83 ec 08             	sub    $0x8,%esp
+  800a53:	56                   	push   %esi
+  800a54:	53                   	push   %ebx
+  800a55:	e8 58 fc ff ff       	call   8006b2 <umain>
+
+	// exit gracefully
+	exit();
+  800a5a:	e8 0a 00 00 00       	call   800a69 <exit>
+}
+  800a5f:	83 c4 10             	add    $0x10,%esp
+  800a62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a65:	5b                   	pop    %ebx
+  800a66:	5e                   	pop    %esi
+  800a67:	5d                   	pop    %ebp
+  800a68:	c3                   	ret
+
+00800a69 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800a6f:	e8 df 16 00 00       	call   802153 <close_all>
+	sys_env_destroy(0);
+  800a74:	83 ec 0c             	sub    $0xc,%esp
+  800a77:	6a 00                	push   $0x0
+  800a79:	e8 4b 0b 00 00       	call   8015c9 <sys_env_destroy>
+}
+  800a7e:	83 c4 10             	add    $0x10,%esp
+  800a81:	c9                   	leave
+  800a82:	c3                   	ret
+
+00800a83 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800a83:	55                   	push   %ebp
+  800a84:	89 e5                	mov    %esp,%ebp
+  800a86:	56                   	push   %esi
+  800a87:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800a88:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800a8b:	8b 35 1c 50 80 00    	mov    0x80501c,%esi
+  800a91:	e8 74 0b 00 00       	call   80160a <sys_getenvid>
+  800a96:	83 ec 0c             	sub    $0xc,%esp
+  800a99:	ff 75 0c             	push   0xc(%ebp)
+  800a9c:	ff 75 08             	push   0x8(%ebp)
+  800a9f:	56                   	push   %esi
+  800aa0:	50                   	push   %eax
+  800aa1:	68 38 3f 80 00       	push   $0x803f38
+  800aa6:	e8 b3 00 00 00       	call   800b5e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800aab:	83 c4 18             	add    $0x18,%esp
+  800aae:	53                   	push   %ebx
+  800aaf:	ff 75 10             	push   0x10(%ebp)
+  800ab2:	e8 56 00 00 00       	call   800b0d <vcprintf>
+	cprintf("\n");
+  800ab7:	c7 04 24 40 3d 80 00 	movl   $0x803d40,(%esp)
+  800abe:	e8 9b 00 00 00       	call   800b5e <cprintf>
+  800ac3:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800ac6:	cc                   	int3
+	while (1)
+  800ac7:	eb fd                	jmp    800ac6 <_panic+0x43>
+
+00800ac9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800ac9:	55                   	push   %ebp
+  800aca:	89 e5                	mov    %esp,%ebp
+  800acc:	53                   	push   %ebx
+  800acd:	83 ec 04             	sub    $0x4,%esp
+  800ad0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800ad3:	8b 13                	mov    (%ebx),%edx
+  800ad5:	8d 42 01             	lea    0x1(%edx),%eax
+  800ad8:	89 03                	mov    %eax,(%ebx)
+  800ada:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800add:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800ae1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800ae6:	74 09                	je     800af1 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800ae8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800aec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aef:	c9                   	leave
+  800af0:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800af1:	83 ec 08             	sub    $0x8,%esp
+  800af4:	68 ff 00 00 00       	push   $0xff
+  800af9:	8d 43 08             	lea    0x8(%ebx),%eax
+  800afc:	50                   	push   %eax
+  800afd:	e8 6a 0a 00 00       	call   80156c <sys_cputs>
+		b->idx = 0;
+  800b02:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800b08:	83 c4 10             	add    $0x10,%esp
+  800b0b:	eb db                	jmp    800ae8 <putch+0x1f>
+
+00800b0d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800b0d:	55                   	push   %ebp
+  800b0e:	89 e5                	mov    %esp,%ebp
+  800b10:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800b16:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800b1d:	00 00 00 
+	b.cnt = 0;
+  800b20:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800b27:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800b2a:	ff 75 0c             	push   0xc(%ebp)
+  800b2d:	ff 75 08             	push   0x8(%ebp)
+  800b30:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800b36:	50                   	push   %eax
+  800b37:	68 c9 0a 80 00       	push   $0x800ac9
+  800b3c:	e8 14 01 00 00       	call   800c55 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800b41:	83 c4 08             	add    $0x8,%esp
+  800b44:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800b4a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800b50:	50                   	push   %eax
+  800b51:	e8 16 0a 00 00       	call   80156c <sys_cputs>
+
+	return b.cnt;
+}
+  800b56:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800b5c:	c9                   	leave
+  800b5d:	c3                   	ret
+
+00800b5e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800b64:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800b67:	50                   	push   %eax
+  800b68:	ff 75 08             	push   0x8(%ebp)
+  800b6b:	e8 9d ff ff ff       	call   800b0d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800b70:	c9                   	leave
+  800b71:	c3                   	ret
+
+00800b72 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	57                   	push   %edi
+  800b76:	56                   	push   %esi
+  800b77:	53                   	push   %ebx
+  800b78:	83 ec 1c             	sub    $0x1c,%esp
+  800b7b:	89 c7                	mov    %eax,%edi
+  800b7d:	89 d6                	mov    %edx,%esi
+  800b7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b82:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b85:	89 d1                	mov    %edx,%ecx
+  800b87:	89 c2                	mov    %eax,%edx
+  800b89:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b8c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b8f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800b92:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800b95:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b98:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800b9f:	39 c2                	cmp    %eax,%edx
+  800ba1:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800ba4:	72 3e                	jb     800be4 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800ba6:	83 ec 0c             	sub    $0xc,%esp
+  800ba9:	ff 75 18             	push   0x18(%ebp)
+  800bac:	83 eb 01             	sub    $0x1,%ebx
+  800baf:	53                   	push   %ebx
+  800bb0:	50                   	push   %eax
+  800bb1:	83 ec 08             	sub    $0x8,%esp
+  800bb4:	ff 75 e4             	push   -0x1c(%ebp)
+  800bb7:	ff 75 e0             	push   -0x20(%ebp)
+  800bba:	ff 75 dc             	push   -0x24(%ebp)
+  800bbd:	ff 75 d8             	push   -0x28(%ebp)
+  800bc0:	e8 db 2d 00 00       	call   8039a0 <__udivdi3>
+  800bc5:	83 c4 18             	add    $0x18,%esp
+  800bc8:	52                   	push   %edx
+  800bc9:	50                   	push   %eax
+  800bca:	89 f2                	mov    %esi,%edx
+  800bcc:	89 f8                	mov    %edi,%eax
+  800bce:	e8 9f ff ff ff       	call   800b72 <printnum>
+  800bd3:	83 c4 20             	add    $0x20,%esp
+  800bd6:	eb 13                	jmp    800beb <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800bd8:	83 ec 08             	sub    $0x8,%esp
+  800bdb:	56                   	push   %esi
+  800bdc:	ff 75 18             	push   0x18(%ebp)
+  800bdf:	ff d7                	call   *%edi
+  800be1:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800be4:	83 eb 01             	sub    $0x1,%ebx
+  800be7:	85 db                	test   %ebx,%ebx
+  800be9:	7f ed                	jg     800bd8 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800beb:	83 ec 08             	sub    $0x8,%esp
+  800bee:	56                   	push   %esi
+  800bef:	83 ec 04             	sub    $0x4,%esp
+  800bf2:	ff 75 e4             	push   -0x1c(%ebp)
+  800bf5:	ff 75 e0             	push   -0x20(%ebp)
+  800bf8:	ff 75 dc             	push   -0x24(%ebp)
+  800bfb:	ff 75 d8             	push   -0x28(%ebp)
+  800bfe:	e8 5d 2e 00 00       	call   803a60 <__umoddi3>
+  800c03:	83 c4 14             	add    $0x14,%esp
+  800c06:	0f be 80 5b 3f 80 00 	movsbl 0x803f5b(%eax),%eax
+  800c0d:	50                   	push   %eax
+  800c0e:	ff d7                	call   *%edi
+}
+  800c10:	83 c4 10             	add    $0x10,%esp
+  800c13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c16:	5b                   	pop    %ebx
+  800c17:	5e                   	pop    %esi
+  800c18:	5f                   	pop    %edi
+  800c19:	5d                   	pop    %ebp
+  800c1a:	c3                   	ret
+
+00800c1b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800c21:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800c25:	8b 10                	mov    (%eax),%edx
+  800c27:	3b 50 04             	cmp    0x4(%eax),%edx
+  800c2a:	73 0a                	jae    800c36 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800c2c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800c2f:	89 08                	mov    %ecx,(%eax)
+  800c31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c34:	88 02                	mov    %al,(%edx)
+}
+  800c36:	5d                   	pop    %ebp
+  800c37:	c3                   	ret
+
+00800c38 <printfmt>:
+{
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800c3e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800c41:	50                   	push   %eax
+  800c42:	ff 75 10             	push   0x10(%ebp)
+  800c45:	ff 75 0c             	push   0xc(%ebp)
+  800c48:	ff 75 08             	push   0x8(%ebp)
+  800c4b:	e8 05 00 00 00       	call   800c55 <vprintfmt>
+}
+  800c50:	83 c4 10             	add    $0x10,%esp
+  800c53:	c9                   	leave
+  800c54:	c3                   	ret
+
+00800c55 <vprintfmt>:
+{
+  800c55:	55                   	push   %ebp
+  800c56:	89 e5                	mov    %esp,%ebp
+  800c58:	57                   	push   %edi
+  800c59:	56                   	push   %esi
+  800c5a:	53                   	push   %ebx
+  800c5b:	83 ec 2c             	sub    $0x2c,%esp
+  800c5e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c61:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c64:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800c67:	eb 0a                	jmp    800c73 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800c69:	83 ec 08             	sub    $0x8,%esp
+  800c6c:	53                   	push   %ebx
+  800c6d:	50                   	push   %eax
+  800c6e:	ff d6                	call   *%esi
+  800c70:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c73:	83 c7 01             	add    $0x1,%edi
+  800c76:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800c7a:	83 f8 25             	cmp    $0x25,%eax
+  800c7d:	74 0c                	je     800c8b <vprintfmt+0x36>
+			if (ch == '\0')
+  800c7f:	85 c0                	test   %eax,%eax
+  800c81:	75 e6                	jne    800c69 <vprintfmt+0x14>
+}
+  800c83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c86:	5b                   	pop    %ebx
+  800c87:	5e                   	pop    %esi
+  800c88:	5f                   	pop    %edi
+  800c89:	5d                   	pop    %ebp
+  800c8a:	c3                   	ret
+		padc = ' ';
+  800c8b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800c8f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800c96:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800c9d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800ca4:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800ca9:	8d 47 01             	lea    0x1(%edi),%eax
+  800cac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800caf:	0f b6 17             	movzbl (%edi),%edx
+  800cb2:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800cb5:	3c 55                	cmp    $0x55,%al
+  800cb7:	0f 87 cf 03 00 00    	ja     80108c <vprintfmt+0x437>
+  800cbd:	0f b6 c0             	movzbl %al,%eax
+  800cc0:	ff 24 85 a0 40 80 00 	jmp    *0x8040a0(,%eax,4)
+  800cc7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800cca:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800cce:	eb d9                	jmp    800ca9 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800cd0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800cd3:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800cd7:	eb d0                	jmp    800ca9 <vprintfmt+0x54>
+  800cd9:	0f b6 d2             	movzbl %dl,%edx
+  800cdc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800ce7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800cea:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800cee:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800cf1:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800cf4:	83 f9 09             	cmp    $0x9,%ecx
+  800cf7:	77 55                	ja     800d4e <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800cf9:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800cfc:	eb e9                	jmp    800ce7 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800cfe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d01:	8b 00                	mov    (%eax),%eax
+  800d03:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800d06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d09:	8d 40 04             	lea    0x4(%eax),%eax
+  800d0c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800d0f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800d12:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800d16:	79 91                	jns    800ca9 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800d18:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800d1b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800d1e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800d25:	eb 82                	jmp    800ca9 <vprintfmt+0x54>
+			if (width < 0)
+  800d27:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800d2a:	85 d2                	test   %edx,%edx
+  800d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d31:	0f 49 c2             	cmovns %edx,%eax
+  800d34:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800d37:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800d3a:	e9 6a ff ff ff       	jmp    800ca9 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800d3f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800d42:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800d49:	e9 5b ff ff ff       	jmp    800ca9 <vprintfmt+0x54>
+  800d4e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800d51:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800d54:	eb bc                	jmp    800d12 <vprintfmt+0xbd>
+			lflag++;
+  800d56:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800d59:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800d5c:	e9 48 ff ff ff       	jmp    800ca9 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800d61:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d64:	8d 78 04             	lea    0x4(%eax),%edi
+  800d67:	83 ec 08             	sub    $0x8,%esp
+  800d6a:	53                   	push   %ebx
+  800d6b:	ff 30                	push   (%eax)
+  800d6d:	ff d6                	call   *%esi
+			break;
+  800d6f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800d72:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800d75:	e9 b1 02 00 00       	jmp    80102b <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800d7a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d7d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800d80:	8b 10                	mov    (%eax),%edx
+  800d82:	89 d0                	mov    %edx,%eax
+  800d84:	f7 d8                	neg    %eax
+  800d86:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d89:	83 f8 0f             	cmp    $0xf,%eax
+  800d8c:	7f 23                	jg     800db1 <vprintfmt+0x15c>
+  800d8e:	8b 14 85 00 42 80 00 	mov    0x804200(,%eax,4),%edx
+  800d95:	85 d2                	test   %edx,%edx
+  800d97:	74 18                	je     800db1 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800d99:	52                   	push   %edx
+  800d9a:	68 78 3e 80 00       	push   $0x803e78
+  800d9f:	53                   	push   %ebx
+  800da0:	56                   	push   %esi
+  800da1:	e8 92 fe ff ff       	call   800c38 <printfmt>
+  800da6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800da9:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800dac:	e9 7a 02 00 00       	jmp    80102b <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800db1:	50                   	push   %eax
+  800db2:	68 73 3f 80 00       	push   $0x803f73
+  800db7:	53                   	push   %ebx
+  800db8:	56                   	push   %esi
+  800db9:	e8 7a fe ff ff       	call   800c38 <printfmt>
+  800dbe:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800dc1:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800dc4:	e9 62 02 00 00       	jmp    80102b <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800dc9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dcc:	83 c0 04             	add    $0x4,%eax
+  800dcf:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800dd2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dd5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800dd7:	85 c9                	test   %ecx,%ecx
+  800dd9:	b8 6c 3f 80 00       	mov    $0x803f6c,%eax
+  800dde:	0f 45 c1             	cmovne %ecx,%eax
+  800de1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800de4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800de8:	7e 06                	jle    800df0 <vprintfmt+0x19b>
+  800dea:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800dee:	75 0b                	jne    800dfb <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800df0:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800df3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800df6:	89 75 08             	mov    %esi,0x8(%ebp)
+  800df9:	eb 5c                	jmp    800e57 <vprintfmt+0x202>
+  800dfb:	83 ec 08             	sub    $0x8,%esp
+  800dfe:	ff 75 d0             	push   -0x30(%ebp)
+  800e01:	ff 75 cc             	push   -0x34(%ebp)
+  800e04:	e8 10 04 00 00       	call   801219 <strnlen>
+  800e09:	89 c2                	mov    %eax,%edx
+  800e0b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800e0e:	29 d0                	sub    %edx,%eax
+  800e10:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800e13:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800e17:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e1a:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e1d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e1f:	eb 0e                	jmp    800e2f <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800e21:	83 ec 08             	sub    $0x8,%esp
+  800e24:	53                   	push   %ebx
+  800e25:	57                   	push   %edi
+  800e26:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e29:	83 ee 01             	sub    $0x1,%esi
+  800e2c:	83 c4 10             	add    $0x10,%esp
+  800e2f:	85 f6                	test   %esi,%esi
+  800e31:	7f ee                	jg     800e21 <vprintfmt+0x1cc>
+  800e33:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800e36:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e39:	85 c0                	test   %eax,%eax
+  800e3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e40:	0f 49 d0             	cmovns %eax,%edx
+  800e43:	29 d0                	sub    %edx,%eax
+  800e45:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e48:	eb a6                	jmp    800df0 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800e4a:	83 ec 08             	sub    $0x8,%esp
+  800e4d:	53                   	push   %ebx
+  800e4e:	52                   	push   %edx
+  800e4f:	ff 55 08             	call   *0x8(%ebp)
+  800e52:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e55:	89 f1                	mov    %esi,%ecx
+  800e57:	8d 71 01             	lea    0x1(%ecx),%esi
+  800e5a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800e5e:	0f be d0             	movsbl %al,%edx
+  800e61:	85 d2                	test   %edx,%edx
+  800e63:	74 28                	je     800e8d <vprintfmt+0x238>
+  800e65:	85 ff                	test   %edi,%edi
+  800e67:	78 05                	js     800e6e <vprintfmt+0x219>
+  800e69:	83 ef 01             	sub    $0x1,%edi
+  800e6c:	78 30                	js     800e9e <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800e6e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800e72:	74 d6                	je     800e4a <vprintfmt+0x1f5>
+  800e74:	0f be c0             	movsbl %al,%eax
+  800e77:	83 e8 20             	sub    $0x20,%eax
+  800e7a:	83 f8 5e             	cmp    $0x5e,%eax
+  800e7d:	76 cb                	jbe    800e4a <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800e7f:	83 ec 08             	sub    $0x8,%esp
+  800e82:	53                   	push   %ebx
+  800e83:	6a 3f                	push   $0x3f
+  800e85:	ff 55 08             	call   *0x8(%ebp)
+  800e88:	83 c4 10             	add    $0x10,%esp
+  800e8b:	eb c8                	jmp    800e55 <vprintfmt+0x200>
+  800e8d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e90:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800e93:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e96:	01 d0                	add    %edx,%eax
+  800e98:	29 c8                	sub    %ecx,%eax
+  800e9a:	89 c7                	mov    %eax,%edi
+  800e9c:	eb 13                	jmp    800eb1 <vprintfmt+0x25c>
+  800e9e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ea1:	eb ed                	jmp    800e90 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800ea3:	83 ec 08             	sub    $0x8,%esp
+  800ea6:	53                   	push   %ebx
+  800ea7:	6a 20                	push   $0x20
+  800ea9:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800eab:	83 ef 01             	sub    $0x1,%edi
+  800eae:	83 c4 10             	add    $0x10,%esp
+  800eb1:	85 ff                	test   %edi,%edi
+  800eb3:	7f ee                	jg     800ea3 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800eb5:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800eb8:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ebb:	e9 6b 01 00 00       	jmp    80102b <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800ec0:	83 f9 01             	cmp    $0x1,%ecx
+  800ec3:	7f 1f                	jg     800ee4 <vprintfmt+0x28f>
+	else if (lflag)
+  800ec5:	85 c9                	test   %ecx,%ecx
+  800ec7:	74 67                	je     800f30 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800ec9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ecc:	8b 00                	mov    (%eax),%eax
+  800ece:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ed1:	89 c1                	mov    %eax,%ecx
+  800ed3:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ed6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ed9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800edc:	8d 40 04             	lea    0x4(%eax),%eax
+  800edf:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ee2:	eb 17                	jmp    800efb <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800ee4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ee7:	8b 50 04             	mov    0x4(%eax),%edx
+  800eea:	8b 00                	mov    (%eax),%eax
+  800eec:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800eef:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ef2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef5:	8d 40 08             	lea    0x8(%eax),%eax
+  800ef8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800efb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800efe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800f01:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800f06:	85 c9                	test   %ecx,%ecx
+  800f08:	0f 89 03 01 00 00    	jns    801011 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800f0e:	83 ec 08             	sub    $0x8,%esp
+  800f11:	53                   	push   %ebx
+  800f12:	6a 2d                	push   $0x2d
+  800f14:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800f16:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800f19:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800f1c:	f7 da                	neg    %edx
+  800f1e:	83 d1 00             	adc    $0x0,%ecx
+  800f21:	f7 d9                	neg    %ecx
+  800f23:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800f26:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800f2b:	e9 e1 00 00 00       	jmp    801011 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800f30:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f33:	8b 00                	mov    (%eax),%eax
+  800f35:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800f38:	89 c1                	mov    %eax,%ecx
+  800f3a:	c1 f9 1f             	sar    $0x1f,%ecx
+  800f3d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800f40:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f43:	8d 40 04             	lea    0x4(%eax),%eax
+  800f46:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f49:	eb b0                	jmp    800efb <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800f4b:	83 f9 01             	cmp    $0x1,%ecx
+  800f4e:	7f 1e                	jg     800f6e <vprintfmt+0x319>
+	else if (lflag)
+  800f50:	85 c9                	test   %ecx,%ecx
+  800f52:	74 32                	je     800f86 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800f54:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f57:	8b 10                	mov    (%eax),%edx
+  800f59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f5e:	8d 40 04             	lea    0x4(%eax),%eax
+  800f61:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f64:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800f69:	e9 a3 00 00 00       	jmp    801011 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800f6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f71:	8b 10                	mov    (%eax),%edx
+  800f73:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f76:	8d 40 08             	lea    0x8(%eax),%eax
+  800f79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f7c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800f81:	e9 8b 00 00 00       	jmp    801011 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800f86:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f89:	8b 10                	mov    (%eax),%edx
+  800f8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f90:	8d 40 04             	lea    0x4(%eax),%eax
+  800f93:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f96:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800f9b:	eb 74                	jmp    801011 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800f9d:	83 f9 01             	cmp    $0x1,%ecx
+  800fa0:	7f 1b                	jg     800fbd <vprintfmt+0x368>
+	else if (lflag)
+  800fa2:	85 c9                	test   %ecx,%ecx
+  800fa4:	74 2c                	je     800fd2 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800fa6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fa9:	8b 10                	mov    (%eax),%edx
+  800fab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb0:	8d 40 04             	lea    0x4(%eax),%eax
+  800fb3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800fb6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800fbb:	eb 54                	jmp    801011 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800fbd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fc0:	8b 10                	mov    (%eax),%edx
+  800fc2:	8b 48 04             	mov    0x4(%eax),%ecx
+  800fc5:	8d 40 08             	lea    0x8(%eax),%eax
+  800fc8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800fcb:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800fd0:	eb 3f                	jmp    801011 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800fd2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fd5:	8b 10                	mov    (%eax),%edx
+  800fd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fdc:	8d 40 04             	lea    0x4(%eax),%eax
+  800fdf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800fe2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800fe7:	eb 28                	jmp    801011 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800fe9:	83 ec 08             	sub    $0x8,%esp
+  800fec:	53                   	push   %ebx
+  800fed:	6a 30                	push   $0x30
+  800fef:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800ff1:	83 c4 08             	add    $0x8,%esp
+  800ff4:	53                   	push   %ebx
+  800ff5:	6a 78                	push   $0x78
+  800ff7:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800ff9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ffc:	8b 10                	mov    (%eax),%edx
+  800ffe:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801003:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801006:	8d 40 04             	lea    0x4(%eax),%eax
+  801009:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80100c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801011:	83 ec 0c             	sub    $0xc,%esp
+  801014:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801018:	50                   	push   %eax
+  801019:	ff 75 e0             	push   -0x20(%ebp)
+  80101c:	57                   	push   %edi
+  80101d:	51                   	push   %ecx
+  80101e:	52                   	push   %edx
+  80101f:	89 da                	mov    %ebx,%edx
+  801021:	89 f0                	mov    %esi,%eax
+  801023:	e8 4a fb ff ff       	call   800b72 <printnum>
+			break;
+  801028:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80102b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80102e:	e9 40 fc ff ff       	jmp    800c73 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801033:	83 f9 01             	cmp    $0x1,%ecx
+  801036:	7f 1b                	jg     801053 <vprintfmt+0x3fe>
+	else if (lflag)
+  801038:	85 c9                	test   %ecx,%ecx
+  80103a:	74 2c                	je     801068 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80103c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80103f:	8b 10                	mov    (%eax),%edx
+  801041:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801046:	8d 40 04             	lea    0x4(%eax),%eax
+  801049:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80104c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801051:	eb be                	jmp    801011 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801053:	8b 45 14             	mov    0x14(%ebp),%eax
+  801056:	8b 10                	mov    (%eax),%edx
+  801058:	8b 48 04             	mov    0x4(%eax),%ecx
+  80105b:	8d 40 08             	lea    0x8(%eax),%eax
+  80105e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801061:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801066:	eb a9                	jmp    801011 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801068:	8b 45 14             	mov    0x14(%ebp),%eax
+  80106b:	8b 10                	mov    (%eax),%edx
+  80106d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801072:	8d 40 04             	lea    0x4(%eax),%eax
+  801075:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801078:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80107d:	eb 92                	jmp    801011 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80107f:	83 ec 08             	sub    $0x8,%esp
+  801082:	53                   	push   %ebx
+  801083:	6a 25                	push   $0x25
+  801085:	ff d6                	call   *%esi
+			break;
+  801087:	83 c4 10             	add    $0x10,%esp
+  80108a:	eb 9f                	jmp    80102b <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80108c:	83 ec 08             	sub    $0x8,%esp
+  80108f:	53                   	push   %ebx
+  801090:	6a 25                	push   $0x25
+  801092:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801094:	83 c4 10             	add    $0x10,%esp
+  801097:	89 f8                	mov    %edi,%eax
+  801099:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80109d:	74 05                	je     8010a4 <vprintfmt+0x44f>
+  80109f:	83 e8 01             	sub    $0x1,%eax
+  8010a2:	eb f5                	jmp    801099 <vprintfmt+0x444>
+  8010a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8010a7:	eb 82                	jmp    80102b <vprintfmt+0x3d6>
+
+008010a9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8010a9:	55                   	push   %ebp
+  8010aa:	89 e5                	mov    %esp,%ebp
+  8010ac:	83 ec 18             	sub    $0x18,%esp
+  8010af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8010b5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8010b8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8010bc:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8010bf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8010c6:	85 c0                	test   %eax,%eax
+  8010c8:	74 26                	je     8010f0 <vsnprintf+0x47>
+  8010ca:	85 d2                	test   %edx,%edx
+  8010cc:	7e 22                	jle    8010f0 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8010ce:	ff 75 14             	push   0x14(%ebp)
+  8010d1:	ff 75 10             	push   0x10(%ebp)
+  8010d4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8010d7:	50                   	push   %eax
+  8010d8:	68 1b 0c 80 00       	push   $0x800c1b
+  8010dd:	e8 73 fb ff ff       	call   800c55 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8010e2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010e5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8010e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010eb:	83 c4 10             	add    $0x10,%esp
+}
+  8010ee:	c9                   	leave
+  8010ef:	c3                   	ret
+		return -E_INVAL;
+  8010f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010f5:	eb f7                	jmp    8010ee <vsnprintf+0x45>
+
+008010f7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8010fd:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801100:	50                   	push   %eax
+  801101:	ff 75 10             	push   0x10(%ebp)
+  801104:	ff 75 0c             	push   0xc(%ebp)
+  801107:	ff 75 08             	push   0x8(%ebp)
+  80110a:	e8 9a ff ff ff       	call   8010a9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80110f:	c9                   	leave
+  801110:	c3                   	ret
+
+00801111 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+  801114:	57                   	push   %edi
+  801115:	56                   	push   %esi
+  801116:	53                   	push   %ebx
+  801117:	83 ec 0c             	sub    $0xc,%esp
+  80111a:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  80111d:	85 c0                	test   %eax,%eax
+  80111f:	74 13                	je     801134 <readline+0x23>
+		fprintf(1, "%s", prompt);
+  801121:	83 ec 04             	sub    $0x4,%esp
+  801124:	50                   	push   %eax
+  801125:	68 78 3e 80 00       	push   $0x803e78
+  80112a:	6a 01                	push   $0x1
+  80112c:	e8 20 17 00 00       	call   802851 <fprintf>
+  801131:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  801134:	83 ec 0c             	sub    $0xc,%esp
+  801137:	6a 00                	push   $0x0
+  801139:	e8 67 f8 ff ff       	call   8009a5 <iscons>
+  80113e:	89 c7                	mov    %eax,%edi
+  801140:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  801143:	be 00 00 00 00       	mov    $0x0,%esi
+  801148:	eb 4b                	jmp    801195 <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  80114a:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  80114f:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  801152:	75 08                	jne    80115c <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  801154:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801157:	5b                   	pop    %ebx
+  801158:	5e                   	pop    %esi
+  801159:	5f                   	pop    %edi
+  80115a:	5d                   	pop    %ebp
+  80115b:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  80115c:	83 ec 08             	sub    $0x8,%esp
+  80115f:	53                   	push   %ebx
+  801160:	68 5f 42 80 00       	push   $0x80425f
+  801165:	e8 f4 f9 ff ff       	call   800b5e <cprintf>
+  80116a:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  80116d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801172:	eb e0                	jmp    801154 <readline+0x43>
+			if (echoing)
+  801174:	85 ff                	test   %edi,%edi
+  801176:	75 05                	jne    80117d <readline+0x6c>
+			i--;
+  801178:	83 ee 01             	sub    $0x1,%esi
+  80117b:	eb 18                	jmp    801195 <readline+0x84>
+				cputchar('\b');
+  80117d:	83 ec 0c             	sub    $0xc,%esp
+  801180:	6a 08                	push   $0x8
+  801182:	e8 d9 f7 ff ff       	call   800960 <cputchar>
+  801187:	83 c4 10             	add    $0x10,%esp
+  80118a:	eb ec                	jmp    801178 <readline+0x67>
+			buf[i++] = c;
+  80118c:	88 9e 20 60 80 00    	mov    %bl,0x806020(%esi)
+  801192:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  801195:	e8 e2 f7 ff ff       	call   80097c <getchar>
+  80119a:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  80119c:	85 c0                	test   %eax,%eax
+  80119e:	78 aa                	js     80114a <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  8011a0:	83 f8 08             	cmp    $0x8,%eax
+  8011a3:	0f 94 c0             	sete   %al
+  8011a6:	83 fb 7f             	cmp    $0x7f,%ebx
+  8011a9:	0f 94 c2             	sete   %dl
+  8011ac:	08 d0                	or     %dl,%al
+  8011ae:	74 04                	je     8011b4 <readline+0xa3>
+  8011b0:	85 f6                	test   %esi,%esi
+  8011b2:	7f c0                	jg     801174 <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  8011b4:	83 fb 1f             	cmp    $0x1f,%ebx
+  8011b7:	7e 1a                	jle    8011d3 <readline+0xc2>
+  8011b9:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  8011bf:	7f 12                	jg     8011d3 <readline+0xc2>
+			if (echoing)
+  8011c1:	85 ff                	test   %edi,%edi
+  8011c3:	74 c7                	je     80118c <readline+0x7b>
+				cputchar(c);
+  8011c5:	83 ec 0c             	sub    $0xc,%esp
+  8011c8:	53                   	push   %ebx
+  8011c9:	e8 92 f7 ff ff       	call   800960 <cputchar>
+  8011ce:	83 c4 10             	add    $0x10,%esp
+  8011d1:	eb b9                	jmp    80118c <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  8011d3:	83 fb 0a             	cmp    $0xa,%ebx
+  8011d6:	74 05                	je     8011dd <readline+0xcc>
+  8011d8:	83 fb 0d             	cmp    $0xd,%ebx
+  8011db:	75 b8                	jne    801195 <readline+0x84>
+			if (echoing)
+  8011dd:	85 ff                	test   %edi,%edi
+  8011df:	75 11                	jne    8011f2 <readline+0xe1>
+			buf[i] = 0;
+  8011e1:	c6 86 20 60 80 00 00 	movb   $0x0,0x806020(%esi)
+			return buf;
+  8011e8:	b8 20 60 80 00       	mov    $0x806020,%eax
+  8011ed:	e9 62 ff ff ff       	jmp    801154 <readline+0x43>
+				cputchar('\n');
+  8011f2:	83 ec 0c             	sub    $0xc,%esp
+  8011f5:	6a 0a                	push   $0xa
+  8011f7:	e8 64 f7 ff ff       	call   800960 <cputchar>
+  8011fc:	83 c4 10             	add    $0x10,%esp
+  8011ff:	eb e0                	jmp    8011e1 <readline+0xd0>
+
+00801201 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801207:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120c:	eb 03                	jmp    801211 <strlen+0x10>
+		n++;
+  80120e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801211:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801215:	75 f7                	jne    80120e <strlen+0xd>
+	return n;
+}
+  801217:	5d                   	pop    %ebp
+  801218:	c3                   	ret
+
+00801219 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801219:	55                   	push   %ebp
+  80121a:	89 e5                	mov    %esp,%ebp
+  80121c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80121f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801222:	b8 00 00 00 00       	mov    $0x0,%eax
+  801227:	eb 03                	jmp    80122c <strnlen+0x13>
+		n++;
+  801229:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80122c:	39 d0                	cmp    %edx,%eax
+  80122e:	74 08                	je     801238 <strnlen+0x1f>
+  801230:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801234:	75 f3                	jne    801229 <strnlen+0x10>
+  801236:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801238:	89 d0                	mov    %edx,%eax
+  80123a:	5d                   	pop    %ebp
+  80123b:	c3                   	ret
+
+0080123c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	53                   	push   %ebx
+  801240:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801243:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80124f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801252:	83 c0 01             	add    $0x1,%eax
+  801255:	84 d2                	test   %dl,%dl
+  801257:	75 f2                	jne    80124b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801259:	89 c8                	mov    %ecx,%eax
+  80125b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80125e:	c9                   	leave
+  80125f:	c3                   	ret
+
+00801260 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801260:	55                   	push   %ebp
+  801261:	89 e5                	mov    %esp,%ebp
+  801263:	53                   	push   %ebx
+  801264:	83 ec 10             	sub    $0x10,%esp
+  801267:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80126a:	53                   	push   %ebx
+  80126b:	e8 91 ff ff ff       	call   801201 <strlen>
+  801270:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801273:	ff 75 0c             	push   0xc(%ebp)
+  801276:	01 d8                	add    %ebx,%eax
+  801278:	50                   	push   %eax
+  801279:	e8 be ff ff ff       	call   80123c <strcpy>
+	return dst;
+}
+  80127e:	89 d8                	mov    %ebx,%eax
+  801280:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801283:	c9                   	leave
+  801284:	c3                   	ret
+
+00801285 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801285:	55                   	push   %ebp
+  801286:	89 e5                	mov    %esp,%ebp
+  801288:	56                   	push   %esi
+  801289:	53                   	push   %ebx
+  80128a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80128d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801290:	89 f3                	mov    %esi,%ebx
+  801292:	03 5d 10             	add    0x10(%ebp),%ebx
+  801295:	89 f0                	mov    %esi,%eax
+  801297:	eb 0f                	jmp    8012a8 <strncpy+0x23>
+		*dst++ = *src;
+  801299:	83 c0 01             	add    $0x1,%eax
+  80129c:	0f b6 0a             	movzbl (%edx),%ecx
+  80129f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8012a2:	80 f9 01             	cmp    $0x1,%cl
+  8012a5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8012a8:	39 d8                	cmp    %ebx,%eax
+  8012aa:	75 ed                	jne    801299 <strncpy+0x14>
+	}
+	return ret;
+}
+  8012ac:	89 f0                	mov    %esi,%eax
+  8012ae:	5b                   	pop    %ebx
+  8012af:	5e                   	pop    %esi
+  8012b0:	5d                   	pop    %ebp
+  8012b1:	c3                   	ret
+
+008012b2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8012b2:	55                   	push   %ebp
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	56                   	push   %esi
+  8012b6:	53                   	push   %ebx
+  8012b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012bd:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8012c0:	89 f0                	mov    %esi,%eax
+  8012c2:	85 d2                	test   %edx,%edx
+  8012c4:	74 21                	je     8012e7 <strlcpy+0x35>
+  8012c6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8012ca:	89 f2                	mov    %esi,%edx
+  8012cc:	eb 09                	jmp    8012d7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8012ce:	83 c1 01             	add    $0x1,%ecx
+  8012d1:	83 c2 01             	add    $0x1,%edx
+  8012d4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8012d7:	39 c2                	cmp    %eax,%edx
+  8012d9:	74 09                	je     8012e4 <strlcpy+0x32>
+  8012db:	0f b6 19             	movzbl (%ecx),%ebx
+  8012de:	84 db                	test   %bl,%bl
+  8012e0:	75 ec                	jne    8012ce <strlcpy+0x1c>
+  8012e2:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8012e4:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8012e7:	29 f0                	sub    %esi,%eax
+}
+  8012e9:	5b                   	pop    %ebx
+  8012ea:	5e                   	pop    %esi
+  8012eb:	5d                   	pop    %ebp
+  8012ec:	c3                   	ret
+
+008012ed <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8012ed:	55                   	push   %ebp
+  8012ee:	89 e5                	mov    %esp,%ebp
+  8012f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8012f6:	eb 06                	jmp    8012fe <strcmp+0x11>
+		p++, q++;
+  8012f8:	83 c1 01             	add    $0x1,%ecx
+  8012fb:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8012fe:	0f b6 01             	movzbl (%ecx),%eax
+  801301:	84 c0                	test   %al,%al
+  801303:	74 04                	je     801309 <strcmp+0x1c>
+  801305:	3a 02                	cmp    (%edx),%al
+  801307:	74 ef                	je     8012f8 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801309:	0f b6 c0             	movzbl %al,%eax
+  80130c:	0f b6 12             	movzbl (%edx),%edx
+  80130f:	29 d0                	sub    %edx,%eax
+}
+  801311:	5d                   	pop    %ebp
+  801312:	c3                   	ret
+
+00801313 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801313:	55                   	push   %ebp
+  801314:	89 e5                	mov    %esp,%ebp
+  801316:	53                   	push   %ebx
+  801317:	8b 45 08             	mov    0x8(%ebp),%eax
+  80131a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801320:	eb 09                	jmp    80132b <strncmp+0x18>
+		n--, p++, q++;
+  801322:	83 ea 01             	sub    $0x1,%edx
+  801325:	83 c0 01             	add    $0x1,%eax
+  801328:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80132b:	85 d2                	test   %edx,%edx
+  80132d:	74 18                	je     801347 <strncmp+0x34>
+  80132f:	0f b6 18             	movzbl (%eax),%ebx
+  801332:	84 db                	test   %bl,%bl
+  801334:	74 04                	je     80133a <strncmp+0x27>
+  801336:	3a 19                	cmp    (%ecx),%bl
+  801338:	74 e8                	je     801322 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80133a:	0f b6 00             	movzbl (%eax),%eax
+  80133d:	0f b6 11             	movzbl (%ecx),%edx
+  801340:	29 d0                	sub    %edx,%eax
+}
+  801342:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801345:	c9                   	leave
+  801346:	c3                   	ret
+		return 0;
+  801347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134c:	eb f4                	jmp    801342 <strncmp+0x2f>
+
+0080134e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80134e:	55                   	push   %ebp
+  80134f:	89 e5                	mov    %esp,%ebp
+  801351:	8b 45 08             	mov    0x8(%ebp),%eax
+  801354:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801358:	eb 03                	jmp    80135d <strchr+0xf>
+  80135a:	83 c0 01             	add    $0x1,%eax
+  80135d:	0f b6 10             	movzbl (%eax),%edx
+  801360:	84 d2                	test   %dl,%dl
+  801362:	74 06                	je     80136a <strchr+0x1c>
+		if (*s == c)
+  801364:	38 ca                	cmp    %cl,%dl
+  801366:	75 f2                	jne    80135a <strchr+0xc>
+  801368:	eb 05                	jmp    80136f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80136a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80136f:	5d                   	pop    %ebp
+  801370:	c3                   	ret
+
+00801371 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801371:	55                   	push   %ebp
+  801372:	89 e5                	mov    %esp,%ebp
+  801374:	8b 45 08             	mov    0x8(%ebp),%eax
+  801377:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80137b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80137e:	38 ca                	cmp    %cl,%dl
+  801380:	74 09                	je     80138b <strfind+0x1a>
+  801382:	84 d2                	test   %dl,%dl
+  801384:	74 05                	je     80138b <strfind+0x1a>
+	for (; *s; s++)
+  801386:	83 c0 01             	add    $0x1,%eax
+  801389:	eb f0                	jmp    80137b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80138b:	5d                   	pop    %ebp
+  80138c:	c3                   	ret
+
+0080138d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80138d:	55                   	push   %ebp
+  80138e:	89 e5                	mov    %esp,%ebp
+  801390:	57                   	push   %edi
+  801391:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801394:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801397:	85 c9                	test   %ecx,%ecx
+  801399:	74 20                	je     8013bb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80139b:	89 f8                	mov    %edi,%eax
+  80139d:	09 c8                	or     %ecx,%eax
+  80139f:	a8 03                	test   $0x3,%al
+  8013a1:	75 12                	jne    8013b5 <memset+0x28>
+		c &= 0xFF;
+  8013a3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8013a7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8013ad:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8013b0:	fc                   	cld
+  8013b1:	f3 ab                	rep stos %eax,%es:(%edi)
+  8013b3:	eb 06                	jmp    8013bb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8013b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013b8:	fc                   	cld
+  8013b9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8013bb:	89 f8                	mov    %edi,%eax
+  8013bd:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8013c0:	c9                   	leave
+  8013c1:	c3                   	ret
+
+008013c2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	57                   	push   %edi
+  8013c6:	56                   	push   %esi
+  8013c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013ca:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013cd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8013d0:	39 c6                	cmp    %eax,%esi
+  8013d2:	73 32                	jae    801406 <memmove+0x44>
+  8013d4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8013d7:	39 d0                	cmp    %edx,%eax
+  8013d9:	73 2b                	jae    801406 <memmove+0x44>
+		s += n;
+		d += n;
+  8013db:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8013de:	89 d6                	mov    %edx,%esi
+  8013e0:	09 fe                	or     %edi,%esi
+  8013e2:	09 ce                	or     %ecx,%esi
+  8013e4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8013ea:	75 0e                	jne    8013fa <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8013ec:	83 ef 04             	sub    $0x4,%edi
+  8013ef:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8013f2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8013f5:	fd                   	std
+  8013f6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8013f8:	eb 09                	jmp    801403 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8013fa:	83 ef 01             	sub    $0x1,%edi
+  8013fd:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801400:	fd                   	std
+  801401:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801403:	fc                   	cld
+  801404:	eb 1a                	jmp    801420 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801406:	89 f2                	mov    %esi,%edx
+  801408:	09 c2                	or     %eax,%edx
+  80140a:	09 ca                	or     %ecx,%edx
+  80140c:	f6 c2 03             	test   $0x3,%dl
+  80140f:	75 0a                	jne    80141b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801411:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801414:	89 c7                	mov    %eax,%edi
+  801416:	fc                   	cld
+  801417:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801419:	eb 05                	jmp    801420 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80141b:	89 c7                	mov    %eax,%edi
+  80141d:	fc                   	cld
+  80141e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801420:	5e                   	pop    %esi
+  801421:	5f                   	pop    %edi
+  801422:	5d                   	pop    %ebp
+  801423:	c3                   	ret
+
+00801424 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801424:	55                   	push   %ebp
+  801425:	89 e5                	mov    %esp,%ebp
+  801427:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80142a:	ff 75 10             	push   0x10(%ebp)
+  80142d:	ff 75 0c             	push   0xc(%ebp)
+  801430:	ff 75 08             	push   0x8(%ebp)
+  801433:	e8 8a ff ff ff       	call   8013c2 <memmove>
+}
+  801438:	c9                   	leave
+  801439:	c3                   	ret
+
+0080143a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80143a:	55                   	push   %ebp
+  80143b:	89 e5                	mov    %esp,%ebp
+  80143d:	56                   	push   %esi
+  80143e:	53                   	push   %ebx
+  80143f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801442:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801445:	89 c6                	mov    %eax,%esi
+  801447:	03 75 10             	add    0x10(%ebp),%esi
+  80144a:	eb 06                	jmp    801452 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80144c:	83 c0 01             	add    $0x1,%eax
+  80144f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801452:	39 f0                	cmp    %esi,%eax
+  801454:	74 14                	je     80146a <memcmp+0x30>
+		if (*s1 != *s2)
+  801456:	0f b6 08             	movzbl (%eax),%ecx
+  801459:	0f b6 1a             	movzbl (%edx),%ebx
+  80145c:	38 d9                	cmp    %bl,%cl
+  80145e:	74 ec                	je     80144c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801460:	0f b6 c1             	movzbl %cl,%eax
+  801463:	0f b6 db             	movzbl %bl,%ebx
+  801466:	29 d8                	sub    %ebx,%eax
+  801468:	eb 05                	jmp    80146f <memcmp+0x35>
+	}
+
+	return 0;
+  80146a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80146f:	5b                   	pop    %ebx
+  801470:	5e                   	pop    %esi
+  801471:	5d                   	pop    %ebp
+  801472:	c3                   	ret
+
+00801473 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801473:	55                   	push   %ebp
+  801474:	89 e5                	mov    %esp,%ebp
+  801476:	8b 45 08             	mov    0x8(%ebp),%eax
+  801479:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80147c:	89 c2                	mov    %eax,%edx
+  80147e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801481:	eb 03                	jmp    801486 <memfind+0x13>
+  801483:	83 c0 01             	add    $0x1,%eax
+  801486:	39 d0                	cmp    %edx,%eax
+  801488:	73 04                	jae    80148e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80148a:	38 08                	cmp    %cl,(%eax)
+  80148c:	75 f5                	jne    801483 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80148e:	5d                   	pop    %ebp
+  80148f:	c3                   	ret
+
+00801490 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801490:	55                   	push   %ebp
+  801491:	89 e5                	mov    %esp,%ebp
+  801493:	57                   	push   %edi
+  801494:	56                   	push   %esi
+  801495:	53                   	push   %ebx
+  801496:	8b 55 08             	mov    0x8(%ebp),%edx
+  801499:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80149c:	eb 03                	jmp    8014a1 <strtol+0x11>
+		s++;
+  80149e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8014a1:	0f b6 02             	movzbl (%edx),%eax
+  8014a4:	3c 20                	cmp    $0x20,%al
+  8014a6:	74 f6                	je     80149e <strtol+0xe>
+  8014a8:	3c 09                	cmp    $0x9,%al
+  8014aa:	74 f2                	je     80149e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8014ac:	3c 2b                	cmp    $0x2b,%al
+  8014ae:	74 2a                	je     8014da <strtol+0x4a>
+	int neg = 0;
+  8014b0:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8014b5:	3c 2d                	cmp    $0x2d,%al
+  8014b7:	74 2b                	je     8014e4 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8014b9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8014bf:	75 0f                	jne    8014d0 <strtol+0x40>
+  8014c1:	80 3a 30             	cmpb   $0x30,(%edx)
+  8014c4:	74 28                	je     8014ee <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8014c6:	85 db                	test   %ebx,%ebx
+  8014c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014cd:	0f 44 d8             	cmove  %eax,%ebx
+  8014d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8014d8:	eb 46                	jmp    801520 <strtol+0x90>
+		s++;
+  8014da:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8014dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014e2:	eb d5                	jmp    8014b9 <strtol+0x29>
+		s++, neg = 1;
+  8014e4:	83 c2 01             	add    $0x1,%edx
+  8014e7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8014ec:	eb cb                	jmp    8014b9 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8014ee:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8014f2:	74 0e                	je     801502 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8014f4:	85 db                	test   %ebx,%ebx
+  8014f6:	75 d8                	jne    8014d0 <strtol+0x40>
+		s++, base = 8;
+  8014f8:	83 c2 01             	add    $0x1,%edx
+  8014fb:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801500:	eb ce                	jmp    8014d0 <strtol+0x40>
+		s += 2, base = 16;
+  801502:	83 c2 02             	add    $0x2,%edx
+  801505:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80150a:	eb c4                	jmp    8014d0 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80150c:	0f be c0             	movsbl %al,%eax
+  80150f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801512:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801515:	7d 3a                	jge    801551 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801517:	83 c2 01             	add    $0x1,%edx
+  80151a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80151e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801520:	0f b6 02             	movzbl (%edx),%eax
+  801523:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801526:	89 f3                	mov    %esi,%ebx
+  801528:	80 fb 09             	cmp    $0x9,%bl
+  80152b:	76 df                	jbe    80150c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80152d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801530:	89 f3                	mov    %esi,%ebx
+  801532:	80 fb 19             	cmp    $0x19,%bl
+  801535:	77 08                	ja     80153f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801537:	0f be c0             	movsbl %al,%eax
+  80153a:	83 e8 57             	sub    $0x57,%eax
+  80153d:	eb d3                	jmp    801512 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  80153f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801542:	89 f3                	mov    %esi,%ebx
+  801544:	80 fb 19             	cmp    $0x19,%bl
+  801547:	77 08                	ja     801551 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801549:	0f be c0             	movsbl %al,%eax
+  80154c:	83 e8 37             	sub    $0x37,%eax
+  80154f:	eb c1                	jmp    801512 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801551:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801555:	74 05                	je     80155c <strtol+0xcc>
+		*endptr = (char *) s;
+  801557:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80155a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80155c:	89 c8                	mov    %ecx,%eax
+  80155e:	f7 d8                	neg    %eax
+  801560:	85 ff                	test   %edi,%edi
+  801562:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801565:	89 c8                	mov    %ecx,%eax
+  801567:	5b                   	pop    %ebx
+  801568:	5e                   	pop    %esi
+  801569:	5f                   	pop    %edi
+  80156a:	5d                   	pop    %ebp
+  80156b:	c3                   	ret
+
+0080156c <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80156c:	55                   	push   %ebp
+  80156d:	89 e5                	mov    %esp,%ebp
+  80156f:	57                   	push   %edi
+  801570:	56                   	push   %esi
+  801571:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801572:	b8 00 00 00 00       	mov    $0x0,%eax
+  801577:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157d:	89 c3                	mov    %eax,%ebx
+  80157f:	89 c7                	mov    %eax,%edi
+  801581:	89 c6                	mov    %eax,%esi
+  801583:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801585:	5b                   	pop    %ebx
+  801586:	5e                   	pop    %esi
+  801587:	5f                   	pop    %edi
+  801588:	5d                   	pop    %ebp
+  801589:	c3                   	ret
+
+0080158a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80158a:	55                   	push   %ebp
+  80158b:	89 e5                	mov    %esp,%ebp
+  80158d:	57                   	push   %edi
+  80158e:	56                   	push   %esi
+  80158f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801590:	ba 00 00 00 00       	mov    $0x0,%edx
+  801595:	b8 01 00 00 00       	mov    $0x1,%eax
+  80159a:	89 d1                	mov    %edx,%ecx
+  80159c:	89 d3                	mov    %edx,%ebx
+  80159e:	89 d7                	mov    %edx,%edi
+  8015a0:	89 d6                	mov    %edx,%esi
+  8015a2:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8015a4:	5b                   	pop    %ebx
+  8015a5:	5e                   	pop    %esi
+  8015a6:	5f                   	pop    %edi
+  8015a7:	5d                   	pop    %ebp
+  8015a8:	c3                   	ret
+
+008015a9 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	57                   	push   %edi
+  8015ad:	56                   	push   %esi
+  8015ae:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8015bc:	89 cb                	mov    %ecx,%ebx
+  8015be:	89 cf                	mov    %ecx,%edi
+  8015c0:	89 ce                	mov    %ecx,%esi
+  8015c2:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  8015c4:	5b                   	pop    %ebx
+  8015c5:	5e                   	pop    %esi
+  8015c6:	5f                   	pop    %edi
+  8015c7:	5d                   	pop    %ebp
+  8015c8:	c3                   	ret
+
+008015c9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	57                   	push   %edi
+  8015cd:	56                   	push   %esi
+  8015ce:	53                   	push   %ebx
+  8015cf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8015d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015da:	b8 03 00 00 00       	mov    $0x3,%eax
+  8015df:	89 cb                	mov    %ecx,%ebx
+  8015e1:	89 cf                	mov    %ecx,%edi
+  8015e3:	89 ce                	mov    %ecx,%esi
+  8015e5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015e7:	85 c0                	test   %eax,%eax
+  8015e9:	7f 08                	jg     8015f3 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8015eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ee:	5b                   	pop    %ebx
+  8015ef:	5e                   	pop    %esi
+  8015f0:	5f                   	pop    %edi
+  8015f1:	5d                   	pop    %ebp
+  8015f2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015f3:	83 ec 0c             	sub    $0xc,%esp
+  8015f6:	50                   	push   %eax
+  8015f7:	6a 03                	push   $0x3
+  8015f9:	68 6f 42 80 00       	push   $0x80426f
+  8015fe:	6a 23                	push   $0x23
+  801600:	68 8c 42 80 00       	push   $0x80428c
+  801605:	e8 79 f4 ff ff       	call   800a83 <_panic>
+
+0080160a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80160a:	55                   	push   %ebp
+  80160b:	89 e5                	mov    %esp,%ebp
+  80160d:	57                   	push   %edi
+  80160e:	56                   	push   %esi
+  80160f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801610:	ba 00 00 00 00       	mov    $0x0,%edx
+  801615:	b8 02 00 00 00       	mov    $0x2,%eax
+  80161a:	89 d1                	mov    %edx,%ecx
+  80161c:	89 d3                	mov    %edx,%ebx
+  80161e:	89 d7                	mov    %edx,%edi
+  801620:	89 d6                	mov    %edx,%esi
+  801622:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801624:	5b                   	pop    %ebx
+  801625:	5e                   	pop    %esi
+  801626:	5f                   	pop    %edi
+  801627:	5d                   	pop    %ebp
+  801628:	c3                   	ret
+
+00801629 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801629:	55                   	push   %ebp
+  80162a:	89 e5                	mov    %esp,%ebp
+  80162c:	57                   	push   %edi
+  80162d:	56                   	push   %esi
+  80162e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80162f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801634:	b8 16 00 00 00       	mov    $0x16,%eax
+  801639:	89 d1                	mov    %edx,%ecx
+  80163b:	89 d3                	mov    %edx,%ebx
+  80163d:	89 d7                	mov    %edx,%edi
+  80163f:	89 d6                	mov    %edx,%esi
+  801641:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801643:	5b                   	pop    %ebx
+  801644:	5e                   	pop    %esi
+  801645:	5f                   	pop    %edi
+  801646:	5d                   	pop    %ebp
+  801647:	c3                   	ret
+
+00801648 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	57                   	push   %edi
+  80164c:	56                   	push   %esi
+  80164d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80164e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801653:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801658:	89 d1                	mov    %edx,%ecx
+  80165a:	89 d3                	mov    %edx,%ebx
+  80165c:	89 d7                	mov    %edx,%edi
+  80165e:	89 d6                	mov    %edx,%esi
+  801660:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  801662:	5b                   	pop    %ebx
+  801663:	5e                   	pop    %esi
+  801664:	5f                   	pop    %edi
+  801665:	5d                   	pop    %ebp
+  801666:	c3                   	ret
+
+00801667 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  801667:	55                   	push   %ebp
+  801668:	89 e5                	mov    %esp,%ebp
+  80166a:	57                   	push   %edi
+  80166b:	56                   	push   %esi
+  80166c:	53                   	push   %ebx
+  80166d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801670:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801675:	8b 55 08             	mov    0x8(%ebp),%edx
+  801678:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80167b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801680:	89 df                	mov    %ebx,%edi
+  801682:	89 de                	mov    %ebx,%esi
+  801684:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801686:	85 c0                	test   %eax,%eax
+  801688:	7f 08                	jg     801692 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  80168a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168d:	5b                   	pop    %ebx
+  80168e:	5e                   	pop    %esi
+  80168f:	5f                   	pop    %edi
+  801690:	5d                   	pop    %ebp
+  801691:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801692:	83 ec 0c             	sub    $0xc,%esp
+  801695:	50                   	push   %eax
+  801696:	6a 15                	push   $0x15
+  801698:	68 6f 42 80 00       	push   $0x80426f
+  80169d:	6a 23                	push   $0x23
+  80169f:	68 8c 42 80 00       	push   $0x80428c
+  8016a4:	e8 da f3 ff ff       	call   800a83 <_panic>
+
+008016a9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8016a9:	55                   	push   %ebp
+  8016aa:	89 e5                	mov    %esp,%ebp
+  8016ac:	57                   	push   %edi
+  8016ad:	56                   	push   %esi
+  8016ae:	53                   	push   %ebx
+  8016af:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8016b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bd:	b8 05 00 00 00       	mov    $0x5,%eax
+  8016c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016c5:	89 f7                	mov    %esi,%edi
+  8016c7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016c9:	85 c0                	test   %eax,%eax
+  8016cb:	7f 08                	jg     8016d5 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8016cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d0:	5b                   	pop    %ebx
+  8016d1:	5e                   	pop    %esi
+  8016d2:	5f                   	pop    %edi
+  8016d3:	5d                   	pop    %ebp
+  8016d4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016d5:	83 ec 0c             	sub    $0xc,%esp
+  8016d8:	50                   	push   %eax
+  8016d9:	6a 05                	push   $0x5
+  8016db:	68 6f 42 80 00       	push   $0x80426f
+  8016e0:	6a 23                	push   $0x23
+  8016e2:	68 8c 42 80 00       	push   $0x80428c
+  8016e7:	e8 97 f3 ff ff       	call   800a83 <_panic>
+
+008016ec <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  8016ec:	55                   	push   %ebp
+  8016ed:	89 e5                	mov    %esp,%ebp
+  8016ef:	57                   	push   %edi
+  8016f0:	56                   	push   %esi
+  8016f1:	53                   	push   %ebx
+  8016f2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8016f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801700:	b8 06 00 00 00       	mov    $0x6,%eax
+  801705:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801708:	89 f7                	mov    %esi,%edi
+  80170a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80170c:	85 c0                	test   %eax,%eax
+  80170e:	7f 08                	jg     801718 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801713:	5b                   	pop    %ebx
+  801714:	5e                   	pop    %esi
+  801715:	5f                   	pop    %edi
+  801716:	5d                   	pop    %ebp
+  801717:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801718:	83 ec 0c             	sub    $0xc,%esp
+  80171b:	50                   	push   %eax
+  80171c:	6a 06                	push   $0x6
+  80171e:	68 6f 42 80 00       	push   $0x80426f
+  801723:	6a 23                	push   $0x23
+  801725:	68 8c 42 80 00       	push   $0x80428c
+  80172a:	e8 54 f3 ff ff       	call   800a83 <_panic>
+
+0080172f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80172f:	55                   	push   %ebp
+  801730:	89 e5                	mov    %esp,%ebp
+  801732:	57                   	push   %edi
+  801733:	56                   	push   %esi
+  801734:	53                   	push   %ebx
+  801735:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801738:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801743:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801746:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801749:	8b 75 18             	mov    0x18(%ebp),%esi
+  80174c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80174e:	85 c0                	test   %eax,%eax
+  801750:	7f 08                	jg     80175a <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801755:	5b                   	pop    %ebx
+  801756:	5e                   	pop    %esi
+  801757:	5f                   	pop    %edi
+  801758:	5d                   	pop    %ebp
+  801759:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80175a:	83 ec 0c             	sub    $0xc,%esp
+  80175d:	50                   	push   %eax
+  80175e:	6a 07                	push   $0x7
+  801760:	68 6f 42 80 00       	push   $0x80426f
+  801765:	6a 23                	push   $0x23
+  801767:	68 8c 42 80 00       	push   $0x80428c
+  80176c:	e8 12 f3 ff ff       	call   800a83 <_panic>
+
+00801771 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801771:	55                   	push   %ebp
+  801772:	89 e5                	mov    %esp,%ebp
+  801774:	57                   	push   %edi
+  801775:	56                   	push   %esi
+  801776:	53                   	push   %ebx
+  801777:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80177a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801782:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801785:	b8 08 00 00 00       	mov    $0x8,%eax
+  80178a:	89 df                	mov    %ebx,%edi
+  80178c:	89 de                	mov    %ebx,%esi
+  80178e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801790:	85 c0                	test   %eax,%eax
+  801792:	7f 08                	jg     80179c <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801794:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801797:	5b                   	pop    %ebx
+  801798:	5e                   	pop    %esi
+  801799:	5f                   	pop    %edi
+  80179a:	5d                   	pop    %ebp
+  80179b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80179c:	83 ec 0c             	sub    $0xc,%esp
+  80179f:	50                   	push   %eax
+  8017a0:	6a 08                	push   $0x8
+  8017a2:	68 6f 42 80 00       	push   $0x80426f
+  8017a7:	6a 23                	push   $0x23
+  8017a9:	68 8c 42 80 00       	push   $0x80428c
+  8017ae:	e8 d0 f2 ff ff       	call   800a83 <_panic>
+
+008017b3 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8017b3:	55                   	push   %ebp
+  8017b4:	89 e5                	mov    %esp,%ebp
+  8017b6:	57                   	push   %edi
+  8017b7:	56                   	push   %esi
+  8017b8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8017b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017bf:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017cc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017cf:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8017d1:	5b                   	pop    %ebx
+  8017d2:	5e                   	pop    %esi
+  8017d3:	5f                   	pop    %edi
+  8017d4:	5d                   	pop    %ebp
+  8017d5:	c3                   	ret
+
+008017d6 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8017d6:	55                   	push   %ebp
+  8017d7:	89 e5                	mov    %esp,%ebp
+  8017d9:	57                   	push   %edi
+  8017da:	56                   	push   %esi
+  8017db:	53                   	push   %ebx
+  8017dc:	8b 45 18             	mov    0x18(%ebp),%eax
+  8017df:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  8017e2:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  8017e7:	77 27                	ja     801810 <sys_page_map_range+0x3a>
+  8017e9:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8017ef:	77 1f                	ja     801810 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  8017f1:	c1 e0 0c             	shl    $0xc,%eax
+  8017f4:	89 c6                	mov    %eax,%esi
+  8017f6:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  8017f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801803:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801806:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801809:	cd 30                	int    $0x30
+}
+  80180b:	5b                   	pop    %ebx
+  80180c:	5e                   	pop    %esi
+  80180d:	5f                   	pop    %edi
+  80180e:	5d                   	pop    %ebp
+  80180f:	c3                   	ret
+		return -E_INVAL;
+  801810:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801815:	eb f4                	jmp    80180b <sys_page_map_range+0x35>
+
+00801817 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	57                   	push   %edi
+  80181b:	56                   	push   %esi
+  80181c:	53                   	push   %ebx
+  80181d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801820:	8b 55 08             	mov    0x8(%ebp),%edx
+  801823:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801826:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80182b:	be 00 00 00 00       	mov    $0x0,%esi
+  801830:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801833:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801836:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	7f 08                	jg     801844 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80183c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80183f:	5b                   	pop    %ebx
+  801840:	5e                   	pop    %esi
+  801841:	5f                   	pop    %edi
+  801842:	5d                   	pop    %ebp
+  801843:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801844:	83 ec 0c             	sub    $0xc,%esp
+  801847:	50                   	push   %eax
+  801848:	6a 0c                	push   $0xc
+  80184a:	68 6f 42 80 00       	push   $0x80426f
+  80184f:	6a 23                	push   $0x23
+  801851:	68 8c 42 80 00       	push   $0x80428c
+  801856:	e8 28 f2 ff ff       	call   800a83 <_panic>
+
+0080185b <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  80185b:	55                   	push   %ebp
+  80185c:	89 e5                	mov    %esp,%ebp
+  80185e:	57                   	push   %edi
+  80185f:	56                   	push   %esi
+  801860:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801861:	be 00 00 00 00       	mov    $0x0,%esi
+  801866:	8b 55 08             	mov    0x8(%ebp),%edx
+  801869:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80186c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801871:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801874:	89 f7                	mov    %esi,%edi
+  801876:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  801878:	5b                   	pop    %ebx
+  801879:	5e                   	pop    %esi
+  80187a:	5f                   	pop    %edi
+  80187b:	5d                   	pop    %ebp
+  80187c:	c3                   	ret
+
+0080187d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80187d:	55                   	push   %ebp
+  80187e:	89 e5                	mov    %esp,%ebp
+  801880:	57                   	push   %edi
+  801881:	56                   	push   %esi
+  801882:	53                   	push   %ebx
+  801883:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801886:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80188b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801891:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801896:	89 df                	mov    %ebx,%edi
+  801898:	89 de                	mov    %ebx,%esi
+  80189a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80189c:	85 c0                	test   %eax,%eax
+  80189e:	7f 08                	jg     8018a8 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8018a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a3:	5b                   	pop    %ebx
+  8018a4:	5e                   	pop    %esi
+  8018a5:	5f                   	pop    %edi
+  8018a6:	5d                   	pop    %ebp
+  8018a7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018a8:	83 ec 0c             	sub    $0xc,%esp
+  8018ab:	50                   	push   %eax
+  8018ac:	6a 0f                	push   $0xf
+  8018ae:	68 6f 42 80 00       	push   $0x80426f
+  8018b3:	6a 23                	push   $0x23
+  8018b5:	68 8c 42 80 00       	push   $0x80428c
+  8018ba:	e8 c4 f1 ff ff       	call   800a83 <_panic>
+
+008018bf <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8018bf:	55                   	push   %ebp
+  8018c0:	89 e5                	mov    %esp,%ebp
+  8018c2:	57                   	push   %edi
+  8018c3:	56                   	push   %esi
+  8018c4:	53                   	push   %ebx
+  8018c5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8018c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018d3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8018d8:	89 df                	mov    %ebx,%edi
+  8018da:	89 de                	mov    %ebx,%esi
+  8018dc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018de:	85 c0                	test   %eax,%eax
+  8018e0:	7f 08                	jg     8018ea <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  8018e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e5:	5b                   	pop    %ebx
+  8018e6:	5e                   	pop    %esi
+  8018e7:	5f                   	pop    %edi
+  8018e8:	5d                   	pop    %ebp
+  8018e9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018ea:	83 ec 0c             	sub    $0xc,%esp
+  8018ed:	50                   	push   %eax
+  8018ee:	6a 10                	push   $0x10
+  8018f0:	68 6f 42 80 00       	push   $0x80426f
+  8018f5:	6a 23                	push   $0x23
+  8018f7:	68 8c 42 80 00       	push   $0x80428c
+  8018fc:	e8 82 f1 ff ff       	call   800a83 <_panic>
+
+00801901 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  801901:	55                   	push   %ebp
+  801902:	89 e5                	mov    %esp,%ebp
+  801904:	57                   	push   %edi
+  801905:	56                   	push   %esi
+  801906:	53                   	push   %ebx
+  801907:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80190a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80190f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801912:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801915:	b8 11 00 00 00       	mov    $0x11,%eax
+  80191a:	89 df                	mov    %ebx,%edi
+  80191c:	89 de                	mov    %ebx,%esi
+  80191e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801920:	85 c0                	test   %eax,%eax
+  801922:	7f 08                	jg     80192c <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  801924:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801927:	5b                   	pop    %ebx
+  801928:	5e                   	pop    %esi
+  801929:	5f                   	pop    %edi
+  80192a:	5d                   	pop    %ebp
+  80192b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80192c:	83 ec 0c             	sub    $0xc,%esp
+  80192f:	50                   	push   %eax
+  801930:	6a 11                	push   $0x11
+  801932:	68 6f 42 80 00       	push   $0x80426f
+  801937:	6a 23                	push   $0x23
+  801939:	68 8c 42 80 00       	push   $0x80428c
+  80193e:	e8 40 f1 ff ff       	call   800a83 <_panic>
+
+00801943 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  801943:	55                   	push   %ebp
+  801944:	89 e5                	mov    %esp,%ebp
+  801946:	57                   	push   %edi
+  801947:	56                   	push   %esi
+  801948:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801949:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801953:	89 d1                	mov    %edx,%ecx
+  801955:	89 d3                	mov    %edx,%ebx
+  801957:	89 d7                	mov    %edx,%edi
+  801959:	89 d6                	mov    %edx,%esi
+  80195b:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  80195d:	5b                   	pop    %ebx
+  80195e:	5e                   	pop    %esi
+  80195f:	5f                   	pop    %edi
+  801960:	5d                   	pop    %ebp
+  801961:	c3                   	ret
+
+00801962 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	57                   	push   %edi
+  801966:	56                   	push   %esi
+  801967:	53                   	push   %ebx
+  801968:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80196b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801970:	8b 55 08             	mov    0x8(%ebp),%edx
+  801973:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801976:	b8 13 00 00 00       	mov    $0x13,%eax
+  80197b:	89 df                	mov    %ebx,%edi
+  80197d:	89 de                	mov    %ebx,%esi
+  80197f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801981:	85 c0                	test   %eax,%eax
+  801983:	7f 08                	jg     80198d <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801988:	5b                   	pop    %ebx
+  801989:	5e                   	pop    %esi
+  80198a:	5f                   	pop    %edi
+  80198b:	5d                   	pop    %ebp
+  80198c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80198d:	83 ec 0c             	sub    $0xc,%esp
+  801990:	50                   	push   %eax
+  801991:	6a 13                	push   $0x13
+  801993:	68 6f 42 80 00       	push   $0x80426f
+  801998:	6a 23                	push   $0x23
+  80199a:	68 8c 42 80 00       	push   $0x80428c
+  80199f:	e8 df f0 ff ff       	call   800a83 <_panic>
+
+008019a4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8019a4:	55                   	push   %ebp
+  8019a5:	89 e5                	mov    %esp,%ebp
+  8019a7:	57                   	push   %edi
+  8019a8:	56                   	push   %esi
+  8019a9:	53                   	push   %ebx
+  8019aa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8019ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019b8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8019bd:	89 df                	mov    %ebx,%edi
+  8019bf:	89 de                	mov    %ebx,%esi
+  8019c1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8019c3:	85 c0                	test   %eax,%eax
+  8019c5:	7f 08                	jg     8019cf <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8019c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ca:	5b                   	pop    %ebx
+  8019cb:	5e                   	pop    %esi
+  8019cc:	5f                   	pop    %edi
+  8019cd:	5d                   	pop    %ebp
+  8019ce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019cf:	83 ec 0c             	sub    $0xc,%esp
+  8019d2:	50                   	push   %eax
+  8019d3:	6a 14                	push   $0x14
+  8019d5:	68 6f 42 80 00       	push   $0x80426f
+  8019da:	6a 23                	push   $0x23
+  8019dc:	68 8c 42 80 00       	push   $0x80428c
+  8019e1:	e8 9d f0 ff ff       	call   800a83 <_panic>
+
+008019e6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8019e6:	55                   	push   %ebp
+  8019e7:	89 e5                	mov    %esp,%ebp
+  8019e9:	57                   	push   %edi
+  8019ea:	56                   	push   %esi
+  8019eb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8019ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f2:	b8 17 00 00 00       	mov    $0x17,%eax
+  8019f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8019fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019ff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a02:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801a04:	5b                   	pop    %ebx
+  801a05:	5e                   	pop    %esi
+  801a06:	5f                   	pop    %edi
+  801a07:	5d                   	pop    %ebp
+  801a08:	c3                   	ret
+
+00801a09 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801a09:	55                   	push   %ebp
+  801a0a:	89 e5                	mov    %esp,%ebp
+  801a0c:	57                   	push   %edi
+  801a0d:	56                   	push   %esi
+  801a0e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801a0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a15:	b8 18 00 00 00       	mov    $0x18,%eax
+  801a1a:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a22:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a25:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801a27:	5b                   	pop    %ebx
+  801a28:	5e                   	pop    %esi
+  801a29:	5f                   	pop    %edi
+  801a2a:	5d                   	pop    %ebp
+  801a2b:	c3                   	ret
+
+00801a2c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801a2c:	55                   	push   %ebp
+  801a2d:	89 e5                	mov    %esp,%ebp
+  801a2f:	57                   	push   %edi
+  801a30:	56                   	push   %esi
+  801a31:	53                   	push   %ebx
+  801a32:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801a35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a3d:	b8 19 00 00 00       	mov    $0x19,%eax
+  801a42:	89 cb                	mov    %ecx,%ebx
+  801a44:	89 cf                	mov    %ecx,%edi
+  801a46:	89 ce                	mov    %ecx,%esi
+  801a48:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a4a:	85 c0                	test   %eax,%eax
+  801a4c:	7f 08                	jg     801a56 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801a4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a51:	5b                   	pop    %ebx
+  801a52:	5e                   	pop    %esi
+  801a53:	5f                   	pop    %edi
+  801a54:	5d                   	pop    %ebp
+  801a55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a56:	83 ec 0c             	sub    $0xc,%esp
+  801a59:	50                   	push   %eax
+  801a5a:	6a 19                	push   $0x19
+  801a5c:	68 6f 42 80 00       	push   $0x80426f
+  801a61:	6a 23                	push   $0x23
+  801a63:	68 8c 42 80 00       	push   $0x80428c
+  801a68:	e8 16 f0 ff ff       	call   800a83 <_panic>
+
+00801a6d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801a6d:	55                   	push   %ebp
+  801a6e:	89 e5                	mov    %esp,%ebp
+  801a70:	57                   	push   %edi
+  801a71:	56                   	push   %esi
+  801a72:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801a73:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a78:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801a7d:	89 d1                	mov    %edx,%ecx
+  801a7f:	89 d3                	mov    %edx,%ebx
+  801a81:	89 d7                	mov    %edx,%edi
+  801a83:	89 d6                	mov    %edx,%esi
+  801a85:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801a87:	5b                   	pop    %ebx
+  801a88:	5e                   	pop    %esi
+  801a89:	5f                   	pop    %edi
+  801a8a:	5d                   	pop    %ebp
+  801a8b:	c3                   	ret
+
+00801a8c <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801a8c:	55                   	push   %ebp
+  801a8d:	89 e5                	mov    %esp,%ebp
+  801a8f:	57                   	push   %edi
+  801a90:	56                   	push   %esi
+  801a91:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801a92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a97:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a9d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801aa2:	89 df                	mov    %ebx,%edi
+  801aa4:	89 de                	mov    %ebx,%esi
+  801aa6:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801aa8:	5b                   	pop    %ebx
+  801aa9:	5e                   	pop    %esi
+  801aaa:	5f                   	pop    %edi
+  801aab:	5d                   	pop    %ebp
+  801aac:	c3                   	ret
+
+00801aad <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801aad:	55                   	push   %ebp
+  801aae:	89 e5                	mov    %esp,%ebp
+  801ab0:	57                   	push   %edi
+  801ab1:	56                   	push   %esi
+  801ab2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801ab3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801abb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801abe:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801ac3:	89 df                	mov    %ebx,%edi
+  801ac5:	89 de                	mov    %ebx,%esi
+  801ac7:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801ac9:	5b                   	pop    %ebx
+  801aca:	5e                   	pop    %esi
+  801acb:	5f                   	pop    %edi
+  801acc:	5d                   	pop    %ebp
+  801acd:	c3                   	ret
+
+00801ace <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801ace:	55                   	push   %ebp
+  801acf:	89 e5                	mov    %esp,%ebp
+  801ad1:	53                   	push   %ebx
+  801ad2:	83 ec 04             	sub    $0x4,%esp
+  801ad5:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801ad8:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  801ada:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  801add:	f6 c2 02             	test   $0x2,%dl
+  801ae0:	74 7b                	je     801b5d <pgfault+0x8f>
+  801ae2:	89 c1                	mov    %eax,%ecx
+  801ae4:	c1 e9 0c             	shr    $0xc,%ecx
+  801ae7:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  801aee:	f6 c5 08             	test   $0x8,%ch
+  801af1:	74 6a                	je     801b5d <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801af3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801af8:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801afa:	83 ec 04             	sub    $0x4,%esp
+  801afd:	6a 07                	push   $0x7
+  801aff:	68 00 f0 7f 00       	push   $0x7ff000
+  801b04:	6a 00                	push   $0x0
+  801b06:	e8 9e fb ff ff       	call   8016a9 <sys_page_alloc>
+  801b0b:	83 c4 10             	add    $0x10,%esp
+  801b0e:	85 c0                	test   %eax,%eax
+  801b10:	78 61                	js     801b73 <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  801b12:	83 ec 04             	sub    $0x4,%esp
+  801b15:	68 00 10 00 00       	push   $0x1000
+  801b1a:	53                   	push   %ebx
+  801b1b:	68 00 f0 7f 00       	push   $0x7ff000
+  801b20:	e8 9d f8 ff ff       	call   8013c2 <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  801b25:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801b2c:	53                   	push   %ebx
+  801b2d:	6a 00                	push   $0x0
+  801b2f:	68 00 f0 7f 00       	push   $0x7ff000
+  801b34:	6a 00                	push   $0x0
+  801b36:	e8 f4 fb ff ff       	call   80172f <sys_page_map>
+  801b3b:	83 c4 20             	add    $0x20,%esp
+  801b3e:	85 c0                	test   %eax,%eax
+  801b40:	78 43                	js     801b85 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  801b42:	83 ec 08             	sub    $0x8,%esp
+  801b45:	68 00 f0 7f 00       	push   $0x7ff000
+  801b4a:	6a 00                	push   $0x0
+  801b4c:	e8 20 fc ff ff       	call   801771 <sys_page_unmap>
+  801b51:	83 c4 10             	add    $0x10,%esp
+  801b54:	85 c0                	test   %eax,%eax
+  801b56:	78 3f                	js     801b97 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  801b58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b5b:	c9                   	leave
+  801b5c:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  801b5d:	83 ec 0c             	sub    $0xc,%esp
+  801b60:	50                   	push   %eax
+  801b61:	52                   	push   %edx
+  801b62:	68 9a 42 80 00       	push   $0x80429a
+  801b67:	6a 19                	push   $0x19
+  801b69:	68 ab 42 80 00       	push   $0x8042ab
+  801b6e:	e8 10 ef ff ff       	call   800a83 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801b73:	50                   	push   %eax
+  801b74:	68 b6 42 80 00       	push   $0x8042b6
+  801b79:	6a 24                	push   $0x24
+  801b7b:	68 ab 42 80 00       	push   $0x8042ab
+  801b80:	e8 fe ee ff ff       	call   800a83 <_panic>
+		panic("sys_page_map: %e", r);
+  801b85:	50                   	push   %eax
+  801b86:	68 c9 42 80 00       	push   $0x8042c9
+  801b8b:	6a 29                	push   $0x29
+  801b8d:	68 ab 42 80 00       	push   $0x8042ab
+  801b92:	e8 ec ee ff ff       	call   800a83 <_panic>
+		panic("sys_page_unmap: %e", r);
+  801b97:	50                   	push   %eax
+  801b98:	68 da 42 80 00       	push   $0x8042da
+  801b9d:	6a 2c                	push   $0x2c
+  801b9f:	68 ab 42 80 00       	push   $0x8042ab
+  801ba4:	e8 da ee ff ff       	call   800a83 <_panic>
+
+00801ba9 <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  801ba9:	55                   	push   %ebp
+  801baa:	89 e5                	mov    %esp,%ebp
+  801bac:	57                   	push   %edi
+  801bad:	56                   	push   %esi
+  801bae:	53                   	push   %ebx
+  801baf:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801bb2:	68 ce 1a 80 00       	push   $0x801ace
+  801bb7:	e8 63 1b 00 00       	call   80371f <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  801bbc:	83 c4 08             	add    $0x8,%esp
+  801bbf:	6a 01                	push   $0x1
+  801bc1:	6a 00                	push   $0x0
+  801bc3:	e8 9f fa ff ff       	call   801667 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  801bc8:	e8 7b fa ff ff       	call   801648 <sys_fork_cow>
+  801bcd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  801bd0:	83 c4 10             	add    $0x10,%esp
+  801bd3:	85 c0                	test   %eax,%eax
+  801bd5:	74 2c                	je     801c03 <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  801bd7:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  801bdb:	0f 85 8b 01 00 00    	jne    801d6c <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801be1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801be6:	cd 30                	int    $0x30
+  801be8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  801beb:	85 c0                	test   %eax,%eax
+  801bed:	78 30                	js     801c1f <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  801bef:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801bf4:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  801bf9:	74 36                	je     801c31 <fork+0x88>
+  801bfb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bfe:	e9 99 00 00 00       	jmp    801c9c <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801c03:	e8 02 fa ff ff       	call   80160a <sys_getenvid>
+  801c08:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801c0d:	c1 e0 09             	shl    $0x9,%eax
+  801c10:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c15:	a3 28 64 80 00       	mov    %eax,0x806428
+		return 0;
+  801c1a:	e9 4d 01 00 00       	jmp    801d6c <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  801c1f:	50                   	push   %eax
+  801c20:	68 ed 42 80 00       	push   $0x8042ed
+  801c25:	6a 7d                	push   $0x7d
+  801c27:	68 ab 42 80 00       	push   $0x8042ab
+  801c2c:	e8 52 ee ff ff       	call   800a83 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801c31:	e8 d4 f9 ff ff       	call   80160a <sys_getenvid>
+  801c36:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801c3b:	c1 e0 09             	shl    $0x9,%eax
+  801c3e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c43:	a3 28 64 80 00       	mov    %eax,0x806428
+		return 0;
+  801c48:	e9 1f 01 00 00       	jmp    801d6c <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  801c4d:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801c54:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801c57:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c5c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801c5f:	83 ec 0c             	sub    $0xc,%esp
+  801c62:	50                   	push   %eax
+  801c63:	56                   	push   %esi
+  801c64:	ff 75 e4             	push   -0x1c(%ebp)
+  801c67:	56                   	push   %esi
+  801c68:	6a 00                	push   $0x0
+  801c6a:	e8 c0 fa ff ff       	call   80172f <sys_page_map>
+  801c6f:	83 c4 20             	add    $0x20,%esp
+  801c72:	85 c0                	test   %eax,%eax
+  801c74:	0f 88 98 00 00 00    	js     801d12 <fork+0x169>
+	if (perm & PTE_COW) {
+  801c7a:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801c81:	0f 85 61 01 00 00    	jne    801de8 <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801c87:	83 c7 01             	add    $0x1,%edi
+  801c8a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c90:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  801c96:	0f 84 88 00 00 00    	je     801d24 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  801c9c:	89 f0                	mov    %esi,%eax
+  801c9e:	c1 e8 16             	shr    $0x16,%eax
+  801ca1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ca8:	25 81 00 00 00       	and    $0x81,%eax
+  801cad:	83 f8 01             	cmp    $0x1,%eax
+  801cb0:	75 d5                	jne    801c87 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  801cb2:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  801cb9:	a8 01                	test   $0x1,%al
+  801cbb:	74 ca                	je     801c87 <fork+0xde>
+  801cbd:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  801cc3:	74 c2                	je     801c87 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  801cc5:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  801cc7:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801cce:	f6 c4 04             	test   $0x4,%ah
+  801cd1:	0f 85 76 ff ff ff    	jne    801c4d <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  801cd7:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801cde:	a8 02                	test   $0x2,%al
+  801ce0:	0f 85 dc 00 00 00    	jne    801dc2 <fork+0x219>
+  801ce6:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801ced:	f6 c4 08             	test   $0x8,%ah
+  801cf0:	0f 85 cc 00 00 00    	jne    801dc2 <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801cf6:	83 ec 0c             	sub    $0xc,%esp
+  801cf9:	6a 05                	push   $0x5
+  801cfb:	56                   	push   %esi
+  801cfc:	ff 75 e4             	push   -0x1c(%ebp)
+  801cff:	56                   	push   %esi
+  801d00:	6a 00                	push   $0x0
+  801d02:	e8 28 fa ff ff       	call   80172f <sys_page_map>
+  801d07:	83 c4 20             	add    $0x20,%esp
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	0f 89 75 ff ff ff    	jns    801c87 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  801d12:	50                   	push   %eax
+  801d13:	68 c9 42 80 00       	push   $0x8042c9
+  801d18:	6a 48                	push   $0x48
+  801d1a:	68 ab 42 80 00       	push   $0x8042ab
+  801d1f:	e8 5f ed ff ff       	call   800a83 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  801d24:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  801d27:	83 ec 04             	sub    $0x4,%esp
+  801d2a:	6a 07                	push   $0x7
+  801d2c:	68 00 f0 bf ee       	push   $0xeebff000
+  801d31:	53                   	push   %ebx
+  801d32:	e8 72 f9 ff ff       	call   8016a9 <sys_page_alloc>
+  801d37:	83 c4 10             	add    $0x10,%esp
+  801d3a:	85 c0                	test   %eax,%eax
+  801d3c:	78 39                	js     801d77 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801d3e:	a1 28 64 80 00       	mov    0x806428,%eax
+  801d43:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  801d49:	83 ec 08             	sub    $0x8,%esp
+  801d4c:	50                   	push   %eax
+  801d4d:	53                   	push   %ebx
+  801d4e:	e8 51 fc ff ff       	call   8019a4 <sys_env_set_pgfault_upcall>
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 36                	js     801d90 <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  801d5a:	83 ec 08             	sub    $0x8,%esp
+  801d5d:	6a 02                	push   $0x2
+  801d5f:	53                   	push   %ebx
+  801d60:	e8 18 fb ff ff       	call   80187d <sys_env_set_status>
+  801d65:	83 c4 10             	add    $0x10,%esp
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	78 3d                	js     801da9 <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  801d6c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d72:	5b                   	pop    %ebx
+  801d73:	5e                   	pop    %esi
+  801d74:	5f                   	pop    %edi
+  801d75:	5d                   	pop    %ebp
+  801d76:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  801d77:	83 ec 0c             	sub    $0xc,%esp
+  801d7a:	53                   	push   %ebx
+  801d7b:	50                   	push   %eax
+  801d7c:	68 14 43 80 00       	push   $0x804314
+  801d81:	68 92 00 00 00       	push   $0x92
+  801d86:	68 ab 42 80 00       	push   $0x8042ab
+  801d8b:	e8 f3 ec ff ff       	call   800a83 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  801d90:	83 ec 0c             	sub    $0xc,%esp
+  801d93:	53                   	push   %ebx
+  801d94:	50                   	push   %eax
+  801d95:	68 38 43 80 00       	push   $0x804338
+  801d9a:	68 95 00 00 00       	push   $0x95
+  801d9f:	68 ab 42 80 00       	push   $0x8042ab
+  801da4:	e8 da ec ff ff       	call   800a83 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  801da9:	83 ec 0c             	sub    $0xc,%esp
+  801dac:	53                   	push   %ebx
+  801dad:	50                   	push   %eax
+  801dae:	68 68 43 80 00       	push   $0x804368
+  801db3:	68 98 00 00 00       	push   $0x98
+  801db8:	68 ab 42 80 00       	push   $0x8042ab
+  801dbd:	e8 c1 ec ff ff       	call   800a83 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801dc2:	83 ec 0c             	sub    $0xc,%esp
+  801dc5:	68 05 08 00 00       	push   $0x805
+  801dca:	53                   	push   %ebx
+  801dcb:	ff 75 e4             	push   -0x1c(%ebp)
+  801dce:	53                   	push   %ebx
+  801dcf:	6a 00                	push   $0x0
+  801dd1:	e8 59 f9 ff ff       	call   80172f <sys_page_map>
+  801dd6:	83 c4 20             	add    $0x20,%esp
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	0f 88 31 ff ff ff    	js     801d12 <fork+0x169>
+		perm |= PTE_COW;
+  801de1:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  801de8:	83 ec 0c             	sub    $0xc,%esp
+  801deb:	ff 75 e0             	push   -0x20(%ebp)
+  801dee:	53                   	push   %ebx
+  801def:	6a 00                	push   $0x0
+  801df1:	53                   	push   %ebx
+  801df2:	6a 00                	push   $0x0
+  801df4:	e8 36 f9 ff ff       	call   80172f <sys_page_map>
+  801df9:	83 c4 20             	add    $0x20,%esp
+  801dfc:	85 c0                	test   %eax,%eax
+  801dfe:	0f 89 83 fe ff ff    	jns    801c87 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  801e04:	50                   	push   %eax
+  801e05:	68 c9 42 80 00       	push   $0x8042c9
+  801e0a:	6a 4c                	push   $0x4c
+  801e0c:	68 ab 42 80 00       	push   $0x8042ab
+  801e11:	e8 6d ec ff ff       	call   800a83 <_panic>
+
+00801e16 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801e16:	55                   	push   %ebp
+  801e17:	89 e5                	mov    %esp,%ebp
+  801e19:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801e1c:	68 fd 42 80 00       	push   $0x8042fd
+  801e21:	68 a0 00 00 00       	push   $0xa0
+  801e26:	68 ab 42 80 00       	push   $0x8042ab
+  801e2b:	e8 53 ec ff ff       	call   800a83 <_panic>
+
+00801e30 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801e30:	55                   	push   %ebp
+  801e31:	89 e5                	mov    %esp,%ebp
+  801e33:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e39:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  801e3c:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  801e3e:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  801e41:	83 3a 01             	cmpl   $0x1,(%edx)
+  801e44:	7e 09                	jle    801e4f <argstart+0x1f>
+  801e46:	ba 41 3d 80 00       	mov    $0x803d41,%edx
+  801e4b:	85 c9                	test   %ecx,%ecx
+  801e4d:	75 05                	jne    801e54 <argstart+0x24>
+  801e4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e54:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  801e57:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  801e5e:	5d                   	pop    %ebp
+  801e5f:	c3                   	ret
+
+00801e60 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  801e60:	55                   	push   %ebp
+  801e61:	89 e5                	mov    %esp,%ebp
+  801e63:	53                   	push   %ebx
+  801e64:	83 ec 04             	sub    $0x4,%esp
+  801e67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  801e6a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  801e71:	8b 43 08             	mov    0x8(%ebx),%eax
+  801e74:	85 c0                	test   %eax,%eax
+  801e76:	74 74                	je     801eec <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  801e78:	80 38 00             	cmpb   $0x0,(%eax)
+  801e7b:	75 48                	jne    801ec5 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  801e7d:	8b 0b                	mov    (%ebx),%ecx
+  801e7f:	83 39 01             	cmpl   $0x1,(%ecx)
+  801e82:	74 5a                	je     801ede <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  801e84:	8b 53 04             	mov    0x4(%ebx),%edx
+  801e87:	8b 42 04             	mov    0x4(%edx),%eax
+  801e8a:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801e8d:	75 4f                	jne    801ede <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  801e8f:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801e93:	74 49                	je     801ede <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  801e95:	83 c0 01             	add    $0x1,%eax
+  801e98:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801e9b:	83 ec 04             	sub    $0x4,%esp
+  801e9e:	8b 01                	mov    (%ecx),%eax
+  801ea0:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  801ea7:	50                   	push   %eax
+  801ea8:	8d 42 08             	lea    0x8(%edx),%eax
+  801eab:	50                   	push   %eax
+  801eac:	83 c2 04             	add    $0x4,%edx
+  801eaf:	52                   	push   %edx
+  801eb0:	e8 0d f5 ff ff       	call   8013c2 <memmove>
+		(*args->argc)--;
+  801eb5:	8b 03                	mov    (%ebx),%eax
+  801eb7:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801eba:	8b 43 08             	mov    0x8(%ebx),%eax
+  801ebd:	83 c4 10             	add    $0x10,%esp
+  801ec0:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801ec3:	74 13                	je     801ed8 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  801ec5:	8b 43 08             	mov    0x8(%ebx),%eax
+  801ec8:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  801ecb:	83 c0 01             	add    $0x1,%eax
+  801ece:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801ed1:	89 d0                	mov    %edx,%eax
+  801ed3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed6:	c9                   	leave
+  801ed7:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801ed8:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801edc:	75 e7                	jne    801ec5 <argnext+0x65>
+	args->curarg = 0;
+  801ede:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  801ee5:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801eea:	eb e5                	jmp    801ed1 <argnext+0x71>
+		return -1;
+  801eec:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801ef1:	eb de                	jmp    801ed1 <argnext+0x71>
+
+00801ef3 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	53                   	push   %ebx
+  801ef7:	83 ec 04             	sub    $0x4,%esp
+  801efa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  801efd:	8b 43 08             	mov    0x8(%ebx),%eax
+  801f00:	85 c0                	test   %eax,%eax
+  801f02:	74 12                	je     801f16 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  801f04:	80 38 00             	cmpb   $0x0,(%eax)
+  801f07:	74 12                	je     801f1b <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  801f09:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  801f0c:	c7 43 08 41 3d 80 00 	movl   $0x803d41,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  801f13:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  801f16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f19:	c9                   	leave
+  801f1a:	c3                   	ret
+	} else if (*args->argc > 1) {
+  801f1b:	8b 13                	mov    (%ebx),%edx
+  801f1d:	83 3a 01             	cmpl   $0x1,(%edx)
+  801f20:	7f 10                	jg     801f32 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  801f22:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  801f29:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801f30:	eb e1                	jmp    801f13 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801f32:	8b 43 04             	mov    0x4(%ebx),%eax
+  801f35:	8b 48 04             	mov    0x4(%eax),%ecx
+  801f38:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801f3b:	83 ec 04             	sub    $0x4,%esp
+  801f3e:	8b 12                	mov    (%edx),%edx
+  801f40:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  801f47:	52                   	push   %edx
+  801f48:	8d 50 08             	lea    0x8(%eax),%edx
+  801f4b:	52                   	push   %edx
+  801f4c:	83 c0 04             	add    $0x4,%eax
+  801f4f:	50                   	push   %eax
+  801f50:	e8 6d f4 ff ff       	call   8013c2 <memmove>
+		(*args->argc)--;
+  801f55:	8b 03                	mov    (%ebx),%eax
+  801f57:	83 28 01             	subl   $0x1,(%eax)
+  801f5a:	83 c4 10             	add    $0x10,%esp
+  801f5d:	eb b4                	jmp    801f13 <argnextvalue+0x20>
+
+00801f5f <argvalue>:
+{
+  801f5f:	55                   	push   %ebp
+  801f60:	89 e5                	mov    %esp,%ebp
+  801f62:	83 ec 08             	sub    $0x8,%esp
+  801f65:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801f68:	8b 42 0c             	mov    0xc(%edx),%eax
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	74 02                	je     801f71 <argvalue+0x12>
+}
+  801f6f:	c9                   	leave
+  801f70:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801f71:	83 ec 0c             	sub    $0xc,%esp
+  801f74:	52                   	push   %edx
+  801f75:	e8 79 ff ff ff       	call   801ef3 <argnextvalue>
+  801f7a:	83 c4 10             	add    $0x10,%esp
+  801f7d:	eb f0                	jmp    801f6f <argvalue+0x10>
+
+00801f7f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801f7f:	55                   	push   %ebp
+  801f80:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f85:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f8a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801f8d:	5d                   	pop    %ebp
+  801f8e:	c3                   	ret
+
+00801f8f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f95:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801f9a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f9f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801fa4:	5d                   	pop    %ebp
+  801fa5:	c3                   	ret
+
+00801fa6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801fa6:	55                   	push   %ebp
+  801fa7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801fa9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801fae:	eb 02                	jmp    801fb2 <fd_alloc+0xc>
+  801fb0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801fb2:	89 c2                	mov    %eax,%edx
+  801fb4:	c1 ea 16             	shr    $0x16,%edx
+  801fb7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801fbe:	f6 c2 01             	test   $0x1,%dl
+  801fc1:	74 2b                	je     801fee <fd_alloc+0x48>
+  801fc3:	89 c2                	mov    %eax,%edx
+  801fc5:	c1 ea 0c             	shr    $0xc,%edx
+  801fc8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801fcf:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801fd5:	f6 c1 01             	test   $0x1,%cl
+  801fd8:	74 14                	je     801fee <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801fda:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801fe0:	75 ce                	jne    801fb0 <fd_alloc+0xa>
+  801fe2:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801fe7:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801fec:	eb 05                	jmp    801ff3 <fd_alloc+0x4d>
+			return 0;
+  801fee:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ff6:	89 02                	mov    %eax,(%edx)
+}
+  801ff8:	89 c8                	mov    %ecx,%eax
+  801ffa:	5d                   	pop    %ebp
+  801ffb:	c3                   	ret
+
+00801ffc <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801ffc:	55                   	push   %ebp
+  801ffd:	89 e5                	mov    %esp,%ebp
+  801fff:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802002:	83 f8 1f             	cmp    $0x1f,%eax
+  802005:	77 30                	ja     802037 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802007:	c1 e0 0c             	shl    $0xc,%eax
+  80200a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80200f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802015:	f6 c2 01             	test   $0x1,%dl
+  802018:	74 24                	je     80203e <fd_lookup+0x42>
+  80201a:	89 c2                	mov    %eax,%edx
+  80201c:	c1 ea 0c             	shr    $0xc,%edx
+  80201f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802026:	f6 c2 01             	test   $0x1,%dl
+  802029:	74 1a                	je     802045 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80202b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80202e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802030:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802035:	5d                   	pop    %ebp
+  802036:	c3                   	ret
+		return -E_INVAL;
+  802037:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80203c:	eb f7                	jmp    802035 <fd_lookup+0x39>
+		return -E_INVAL;
+  80203e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802043:	eb f0                	jmp    802035 <fd_lookup+0x39>
+  802045:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80204a:	eb e9                	jmp    802035 <fd_lookup+0x39>
+
+0080204c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80204c:	55                   	push   %ebp
+  80204d:	89 e5                	mov    %esp,%ebp
+  80204f:	53                   	push   %ebx
+  802050:	83 ec 04             	sub    $0x4,%esp
+  802053:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205b:	eb 03                	jmp    802060 <dev_lookup+0x14>
+  80205d:	83 c0 01             	add    $0x1,%eax
+  802060:	8b 1c 85 0c 44 80 00 	mov    0x80440c(,%eax,4),%ebx
+  802067:	85 db                	test   %ebx,%ebx
+  802069:	74 0b                	je     802076 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80206b:	39 13                	cmp    %edx,(%ebx)
+  80206d:	75 ee                	jne    80205d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80206f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802074:	eb 1f                	jmp    802095 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802076:	a1 28 64 80 00       	mov    0x806428,%eax
+  80207b:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80207e:	83 ec 04             	sub    $0x4,%esp
+  802081:	52                   	push   %edx
+  802082:	50                   	push   %eax
+  802083:	68 90 43 80 00       	push   $0x804390
+  802088:	e8 d1 ea ff ff       	call   800b5e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80208d:	83 c4 10             	add    $0x10,%esp
+  802090:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802095:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802098:	89 1a                	mov    %ebx,(%edx)
+}
+  80209a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80209d:	c9                   	leave
+  80209e:	c3                   	ret
+
+0080209f <fd_close>:
+{
+  80209f:	55                   	push   %ebp
+  8020a0:	89 e5                	mov    %esp,%ebp
+  8020a2:	57                   	push   %edi
+  8020a3:	56                   	push   %esi
+  8020a4:	53                   	push   %ebx
+  8020a5:	83 ec 24             	sub    $0x24,%esp
+  8020a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020ab:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8020ae:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020b1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8020b2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8020b8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8020bb:	50                   	push   %eax
+  8020bc:	e8 3b ff ff ff       	call   801ffc <fd_lookup>
+  8020c1:	89 c3                	mov    %eax,%ebx
+  8020c3:	83 c4 10             	add    $0x10,%esp
+  8020c6:	85 c0                	test   %eax,%eax
+  8020c8:	78 05                	js     8020cf <fd_close+0x30>
+	    || fd != fd2)
+  8020ca:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8020cd:	74 16                	je     8020e5 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8020cf:	89 f8                	mov    %edi,%eax
+  8020d1:	84 c0                	test   %al,%al
+  8020d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8020db:	89 d8                	mov    %ebx,%eax
+  8020dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e0:	5b                   	pop    %ebx
+  8020e1:	5e                   	pop    %esi
+  8020e2:	5f                   	pop    %edi
+  8020e3:	5d                   	pop    %ebp
+  8020e4:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8020e5:	83 ec 08             	sub    $0x8,%esp
+  8020e8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8020eb:	50                   	push   %eax
+  8020ec:	ff 36                	push   (%esi)
+  8020ee:	e8 59 ff ff ff       	call   80204c <dev_lookup>
+  8020f3:	89 c3                	mov    %eax,%ebx
+  8020f5:	83 c4 10             	add    $0x10,%esp
+  8020f8:	85 c0                	test   %eax,%eax
+  8020fa:	78 1a                	js     802116 <fd_close+0x77>
+		if (dev->dev_close)
+  8020fc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8020ff:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802102:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802107:	85 c0                	test   %eax,%eax
+  802109:	74 0b                	je     802116 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80210b:	83 ec 0c             	sub    $0xc,%esp
+  80210e:	56                   	push   %esi
+  80210f:	ff d0                	call   *%eax
+  802111:	89 c3                	mov    %eax,%ebx
+  802113:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802116:	83 ec 08             	sub    $0x8,%esp
+  802119:	56                   	push   %esi
+  80211a:	6a 00                	push   $0x0
+  80211c:	e8 50 f6 ff ff       	call   801771 <sys_page_unmap>
+	return r;
+  802121:	83 c4 10             	add    $0x10,%esp
+  802124:	eb b5                	jmp    8020db <fd_close+0x3c>
+
+00802126 <close>:
+
+int
+close(int fdnum)
+{
+  802126:	55                   	push   %ebp
+  802127:	89 e5                	mov    %esp,%ebp
+  802129:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80212c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80212f:	50                   	push   %eax
+  802130:	ff 75 08             	push   0x8(%ebp)
+  802133:	e8 c4 fe ff ff       	call   801ffc <fd_lookup>
+  802138:	83 c4 10             	add    $0x10,%esp
+  80213b:	85 c0                	test   %eax,%eax
+  80213d:	79 02                	jns    802141 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80213f:	c9                   	leave
+  802140:	c3                   	ret
+		return fd_close(fd, 1);
+  802141:	83 ec 08             	sub    $0x8,%esp
+  802144:	6a 01                	push   $0x1
+  802146:	ff 75 f4             	push   -0xc(%ebp)
+  802149:	e8 51 ff ff ff       	call   80209f <fd_close>
+  80214e:	83 c4 10             	add    $0x10,%esp
+  802151:	eb ec                	jmp    80213f <close+0x19>
+
+00802153 <close_all>:
+
+void
+close_all(void)
+{
+  802153:	55                   	push   %ebp
+  802154:	89 e5                	mov    %esp,%ebp
+  802156:	53                   	push   %ebx
+  802157:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80215a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80215f:	83 ec 0c             	sub    $0xc,%esp
+  802162:	53                   	push   %ebx
+  802163:	e8 be ff ff ff       	call   802126 <close>
+	for (i = 0; i < MAXFD; i++)
+  802168:	83 c3 01             	add    $0x1,%ebx
+  80216b:	83 c4 10             	add    $0x10,%esp
+  80216e:	83 fb 20             	cmp    $0x20,%ebx
+  802171:	75 ec                	jne    80215f <close_all+0xc>
+}
+  802173:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802176:	c9                   	leave
+  802177:	c3                   	ret
+
+00802178 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802178:	55                   	push   %ebp
+  802179:	89 e5                	mov    %esp,%ebp
+  80217b:	57                   	push   %edi
+  80217c:	56                   	push   %esi
+  80217d:	53                   	push   %ebx
+  80217e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802181:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802184:	50                   	push   %eax
+  802185:	ff 75 08             	push   0x8(%ebp)
+  802188:	e8 6f fe ff ff       	call   801ffc <fd_lookup>
+  80218d:	89 c3                	mov    %eax,%ebx
+  80218f:	83 c4 10             	add    $0x10,%esp
+  802192:	85 c0                	test   %eax,%eax
+  802194:	78 7f                	js     802215 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802196:	83 ec 0c             	sub    $0xc,%esp
+  802199:	ff 75 0c             	push   0xc(%ebp)
+  80219c:	e8 85 ff ff ff       	call   802126 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8021a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021a4:	c1 e6 0c             	shl    $0xc,%esi
+  8021a7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8021ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8021b0:	89 3c 24             	mov    %edi,(%esp)
+  8021b3:	e8 d7 fd ff ff       	call   801f8f <fd2data>
+  8021b8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8021ba:	89 34 24             	mov    %esi,(%esp)
+  8021bd:	e8 cd fd ff ff       	call   801f8f <fd2data>
+  8021c2:	83 c4 10             	add    $0x10,%esp
+  8021c5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8021c8:	89 d8                	mov    %ebx,%eax
+  8021ca:	c1 e8 16             	shr    $0x16,%eax
+  8021cd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8021d4:	a8 01                	test   $0x1,%al
+  8021d6:	74 11                	je     8021e9 <dup+0x71>
+  8021d8:	89 d8                	mov    %ebx,%eax
+  8021da:	c1 e8 0c             	shr    $0xc,%eax
+  8021dd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8021e4:	f6 c2 01             	test   $0x1,%dl
+  8021e7:	75 36                	jne    80221f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8021e9:	89 f8                	mov    %edi,%eax
+  8021eb:	c1 e8 0c             	shr    $0xc,%eax
+  8021ee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021f5:	83 ec 0c             	sub    $0xc,%esp
+  8021f8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021fd:	50                   	push   %eax
+  8021fe:	56                   	push   %esi
+  8021ff:	6a 00                	push   $0x0
+  802201:	57                   	push   %edi
+  802202:	6a 00                	push   $0x0
+  802204:	e8 26 f5 ff ff       	call   80172f <sys_page_map>
+  802209:	89 c3                	mov    %eax,%ebx
+  80220b:	83 c4 20             	add    $0x20,%esp
+  80220e:	85 c0                	test   %eax,%eax
+  802210:	78 33                	js     802245 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802212:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802215:	89 d8                	mov    %ebx,%eax
+  802217:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80221a:	5b                   	pop    %ebx
+  80221b:	5e                   	pop    %esi
+  80221c:	5f                   	pop    %edi
+  80221d:	5d                   	pop    %ebp
+  80221e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80221f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802226:	83 ec 0c             	sub    $0xc,%esp
+  802229:	25 07 0e 00 00       	and    $0xe07,%eax
+  80222e:	50                   	push   %eax
+  80222f:	ff 75 d4             	push   -0x2c(%ebp)
+  802232:	6a 00                	push   $0x0
+  802234:	53                   	push   %ebx
+  802235:	6a 00                	push   $0x0
+  802237:	e8 f3 f4 ff ff       	call   80172f <sys_page_map>
+  80223c:	89 c3                	mov    %eax,%ebx
+  80223e:	83 c4 20             	add    $0x20,%esp
+  802241:	85 c0                	test   %eax,%eax
+  802243:	79 a4                	jns    8021e9 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802245:	83 ec 08             	sub    $0x8,%esp
+  802248:	56                   	push   %esi
+  802249:	6a 00                	push   $0x0
+  80224b:	e8 21 f5 ff ff       	call   801771 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802250:	83 c4 08             	add    $0x8,%esp
+  802253:	ff 75 d4             	push   -0x2c(%ebp)
+  802256:	6a 00                	push   $0x0
+  802258:	e8 14 f5 ff ff       	call   801771 <sys_page_unmap>
+	return r;
+  80225d:	83 c4 10             	add    $0x10,%esp
+  802260:	eb b3                	jmp    802215 <dup+0x9d>
+
+00802262 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802262:	55                   	push   %ebp
+  802263:	89 e5                	mov    %esp,%ebp
+  802265:	56                   	push   %esi
+  802266:	53                   	push   %ebx
+  802267:	83 ec 18             	sub    $0x18,%esp
+  80226a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80226d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802270:	50                   	push   %eax
+  802271:	56                   	push   %esi
+  802272:	e8 85 fd ff ff       	call   801ffc <fd_lookup>
+  802277:	83 c4 10             	add    $0x10,%esp
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	78 3c                	js     8022ba <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80227e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802281:	83 ec 08             	sub    $0x8,%esp
+  802284:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802287:	50                   	push   %eax
+  802288:	ff 33                	push   (%ebx)
+  80228a:	e8 bd fd ff ff       	call   80204c <dev_lookup>
+  80228f:	83 c4 10             	add    $0x10,%esp
+  802292:	85 c0                	test   %eax,%eax
+  802294:	78 24                	js     8022ba <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802296:	8b 43 08             	mov    0x8(%ebx),%eax
+  802299:	83 e0 03             	and    $0x3,%eax
+  80229c:	83 f8 01             	cmp    $0x1,%eax
+  80229f:	74 20                	je     8022c1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8022a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022a4:	8b 40 08             	mov    0x8(%eax),%eax
+  8022a7:	85 c0                	test   %eax,%eax
+  8022a9:	74 37                	je     8022e2 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8022ab:	83 ec 04             	sub    $0x4,%esp
+  8022ae:	ff 75 10             	push   0x10(%ebp)
+  8022b1:	ff 75 0c             	push   0xc(%ebp)
+  8022b4:	53                   	push   %ebx
+  8022b5:	ff d0                	call   *%eax
+  8022b7:	83 c4 10             	add    $0x10,%esp
+}
+  8022ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022bd:	5b                   	pop    %ebx
+  8022be:	5e                   	pop    %esi
+  8022bf:	5d                   	pop    %ebp
+  8022c0:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022c1:	a1 28 64 80 00       	mov    0x806428,%eax
+  8022c6:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8022c9:	83 ec 04             	sub    $0x4,%esp
+  8022cc:	56                   	push   %esi
+  8022cd:	50                   	push   %eax
+  8022ce:	68 d1 43 80 00       	push   $0x8043d1
+  8022d3:	e8 86 e8 ff ff       	call   800b5e <cprintf>
+		return -E_INVAL;
+  8022d8:	83 c4 10             	add    $0x10,%esp
+  8022db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022e0:	eb d8                	jmp    8022ba <read+0x58>
+		return -E_NOT_SUPP;
+  8022e2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022e7:	eb d1                	jmp    8022ba <read+0x58>
+
+008022e9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8022e9:	55                   	push   %ebp
+  8022ea:	89 e5                	mov    %esp,%ebp
+  8022ec:	57                   	push   %edi
+  8022ed:	56                   	push   %esi
+  8022ee:	53                   	push   %ebx
+  8022ef:	83 ec 0c             	sub    $0xc,%esp
+  8022f2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022f5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8022f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022fd:	eb 02                	jmp    802301 <readn+0x18>
+  8022ff:	01 c3                	add    %eax,%ebx
+  802301:	39 f3                	cmp    %esi,%ebx
+  802303:	73 21                	jae    802326 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802305:	83 ec 04             	sub    $0x4,%esp
+  802308:	89 f0                	mov    %esi,%eax
+  80230a:	29 d8                	sub    %ebx,%eax
+  80230c:	50                   	push   %eax
+  80230d:	89 d8                	mov    %ebx,%eax
+  80230f:	03 45 0c             	add    0xc(%ebp),%eax
+  802312:	50                   	push   %eax
+  802313:	57                   	push   %edi
+  802314:	e8 49 ff ff ff       	call   802262 <read>
+		if (m < 0)
+  802319:	83 c4 10             	add    $0x10,%esp
+  80231c:	85 c0                	test   %eax,%eax
+  80231e:	78 04                	js     802324 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802320:	75 dd                	jne    8022ff <readn+0x16>
+  802322:	eb 02                	jmp    802326 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802324:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802326:	89 d8                	mov    %ebx,%eax
+  802328:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80232b:	5b                   	pop    %ebx
+  80232c:	5e                   	pop    %esi
+  80232d:	5f                   	pop    %edi
+  80232e:	5d                   	pop    %ebp
+  80232f:	c3                   	ret
+
+00802330 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802330:	55                   	push   %ebp
+  802331:	89 e5                	mov    %esp,%ebp
+  802333:	56                   	push   %esi
+  802334:	53                   	push   %ebx
+  802335:	83 ec 18             	sub    $0x18,%esp
+  802338:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80233b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80233e:	50                   	push   %eax
+  80233f:	53                   	push   %ebx
+  802340:	e8 b7 fc ff ff       	call   801ffc <fd_lookup>
+  802345:	83 c4 10             	add    $0x10,%esp
+  802348:	85 c0                	test   %eax,%eax
+  80234a:	78 37                	js     802383 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80234c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80234f:	83 ec 08             	sub    $0x8,%esp
+  802352:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802355:	50                   	push   %eax
+  802356:	ff 36                	push   (%esi)
+  802358:	e8 ef fc ff ff       	call   80204c <dev_lookup>
+  80235d:	83 c4 10             	add    $0x10,%esp
+  802360:	85 c0                	test   %eax,%eax
+  802362:	78 1f                	js     802383 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802364:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802368:	74 20                	je     80238a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80236a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80236d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802370:	85 c0                	test   %eax,%eax
+  802372:	74 37                	je     8023ab <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802374:	83 ec 04             	sub    $0x4,%esp
+  802377:	ff 75 10             	push   0x10(%ebp)
+  80237a:	ff 75 0c             	push   0xc(%ebp)
+  80237d:	56                   	push   %esi
+  80237e:	ff d0                	call   *%eax
+  802380:	83 c4 10             	add    $0x10,%esp
+}
+  802383:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802386:	5b                   	pop    %ebx
+  802387:	5e                   	pop    %esi
+  802388:	5d                   	pop    %ebp
+  802389:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80238a:	a1 28 64 80 00       	mov    0x806428,%eax
+  80238f:	8b 40 4c             	mov    0x4c(%eax),%eax
+  802392:	83 ec 04             	sub    $0x4,%esp
+  802395:	53                   	push   %ebx
+  802396:	50                   	push   %eax
+  802397:	68 ed 43 80 00       	push   $0x8043ed
+  80239c:	e8 bd e7 ff ff       	call   800b5e <cprintf>
+		return -E_INVAL;
+  8023a1:	83 c4 10             	add    $0x10,%esp
+  8023a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023a9:	eb d8                	jmp    802383 <write+0x53>
+		return -E_NOT_SUPP;
+  8023ab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023b0:	eb d1                	jmp    802383 <write+0x53>
+
+008023b2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8023b2:	55                   	push   %ebp
+  8023b3:	89 e5                	mov    %esp,%ebp
+  8023b5:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023bb:	50                   	push   %eax
+  8023bc:	ff 75 08             	push   0x8(%ebp)
+  8023bf:	e8 38 fc ff ff       	call   801ffc <fd_lookup>
+  8023c4:	83 c4 10             	add    $0x10,%esp
+  8023c7:	85 c0                	test   %eax,%eax
+  8023c9:	78 0e                	js     8023d9 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8023cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023d1:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8023d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023d9:	c9                   	leave
+  8023da:	c3                   	ret
+
+008023db <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8023db:	55                   	push   %ebp
+  8023dc:	89 e5                	mov    %esp,%ebp
+  8023de:	56                   	push   %esi
+  8023df:	53                   	push   %ebx
+  8023e0:	83 ec 18             	sub    $0x18,%esp
+  8023e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8023e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023e9:	50                   	push   %eax
+  8023ea:	53                   	push   %ebx
+  8023eb:	e8 0c fc ff ff       	call   801ffc <fd_lookup>
+  8023f0:	83 c4 10             	add    $0x10,%esp
+  8023f3:	85 c0                	test   %eax,%eax
+  8023f5:	78 34                	js     80242b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8023f7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8023fa:	83 ec 08             	sub    $0x8,%esp
+  8023fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802400:	50                   	push   %eax
+  802401:	ff 36                	push   (%esi)
+  802403:	e8 44 fc ff ff       	call   80204c <dev_lookup>
+  802408:	83 c4 10             	add    $0x10,%esp
+  80240b:	85 c0                	test   %eax,%eax
+  80240d:	78 1c                	js     80242b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80240f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802413:	74 1d                	je     802432 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802415:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802418:	8b 40 18             	mov    0x18(%eax),%eax
+  80241b:	85 c0                	test   %eax,%eax
+  80241d:	74 34                	je     802453 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80241f:	83 ec 08             	sub    $0x8,%esp
+  802422:	ff 75 0c             	push   0xc(%ebp)
+  802425:	56                   	push   %esi
+  802426:	ff d0                	call   *%eax
+  802428:	83 c4 10             	add    $0x10,%esp
+}
+  80242b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80242e:	5b                   	pop    %ebx
+  80242f:	5e                   	pop    %esi
+  802430:	5d                   	pop    %ebp
+  802431:	c3                   	ret
+			thisenv->env_id, fdnum);
+  802432:	a1 28 64 80 00       	mov    0x806428,%eax
+  802437:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80243a:	83 ec 04             	sub    $0x4,%esp
+  80243d:	53                   	push   %ebx
+  80243e:	50                   	push   %eax
+  80243f:	68 b0 43 80 00       	push   $0x8043b0
+  802444:	e8 15 e7 ff ff       	call   800b5e <cprintf>
+		return -E_INVAL;
+  802449:	83 c4 10             	add    $0x10,%esp
+  80244c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802451:	eb d8                	jmp    80242b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802453:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802458:	eb d1                	jmp    80242b <ftruncate+0x50>
+
+0080245a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80245a:	55                   	push   %ebp
+  80245b:	89 e5                	mov    %esp,%ebp
+  80245d:	56                   	push   %esi
+  80245e:	53                   	push   %ebx
+  80245f:	83 ec 18             	sub    $0x18,%esp
+  802462:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802465:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802468:	50                   	push   %eax
+  802469:	ff 75 08             	push   0x8(%ebp)
+  80246c:	e8 8b fb ff ff       	call   801ffc <fd_lookup>
+  802471:	83 c4 10             	add    $0x10,%esp
+  802474:	85 c0                	test   %eax,%eax
+  802476:	78 49                	js     8024c1 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802478:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80247b:	83 ec 08             	sub    $0x8,%esp
+  80247e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802481:	50                   	push   %eax
+  802482:	ff 36                	push   (%esi)
+  802484:	e8 c3 fb ff ff       	call   80204c <dev_lookup>
+  802489:	83 c4 10             	add    $0x10,%esp
+  80248c:	85 c0                	test   %eax,%eax
+  80248e:	78 31                	js     8024c1 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802490:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802493:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802497:	74 2f                	je     8024c8 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802499:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80249c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8024a3:	00 00 00 
+	stat->st_isdir = 0;
+  8024a6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024ad:	00 00 00 
+	stat->st_dev = dev;
+  8024b0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8024b6:	83 ec 08             	sub    $0x8,%esp
+  8024b9:	53                   	push   %ebx
+  8024ba:	56                   	push   %esi
+  8024bb:	ff 50 14             	call   *0x14(%eax)
+  8024be:	83 c4 10             	add    $0x10,%esp
+}
+  8024c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024c4:	5b                   	pop    %ebx
+  8024c5:	5e                   	pop    %esi
+  8024c6:	5d                   	pop    %ebp
+  8024c7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8024c8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024cd:	eb f2                	jmp    8024c1 <fstat+0x67>
+
+008024cf <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8024cf:	55                   	push   %ebp
+  8024d0:	89 e5                	mov    %esp,%ebp
+  8024d2:	56                   	push   %esi
+  8024d3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8024d4:	83 ec 08             	sub    $0x8,%esp
+  8024d7:	6a 00                	push   $0x0
+  8024d9:	ff 75 08             	push   0x8(%ebp)
+  8024dc:	e8 e4 01 00 00       	call   8026c5 <open>
+  8024e1:	89 c3                	mov    %eax,%ebx
+  8024e3:	83 c4 10             	add    $0x10,%esp
+  8024e6:	85 c0                	test   %eax,%eax
+  8024e8:	78 1b                	js     802505 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8024ea:	83 ec 08             	sub    $0x8,%esp
+  8024ed:	ff 75 0c             	push   0xc(%ebp)
+  8024f0:	50                   	push   %eax
+  8024f1:	e8 64 ff ff ff       	call   80245a <fstat>
+  8024f6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8024f8:	89 1c 24             	mov    %ebx,(%esp)
+  8024fb:	e8 26 fc ff ff       	call   802126 <close>
+	return r;
+  802500:	83 c4 10             	add    $0x10,%esp
+  802503:	89 f3                	mov    %esi,%ebx
+}
+  802505:	89 d8                	mov    %ebx,%eax
+  802507:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80250a:	5b                   	pop    %ebx
+  80250b:	5e                   	pop    %esi
+  80250c:	5d                   	pop    %ebp
+  80250d:	c3                   	ret
+
+0080250e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80250e:	55                   	push   %ebp
+  80250f:	89 e5                	mov    %esp,%ebp
+  802511:	56                   	push   %esi
+  802512:	53                   	push   %ebx
+  802513:	89 c6                	mov    %eax,%esi
+  802515:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802517:	83 3d 20 64 80 00 00 	cmpl   $0x0,0x806420
+  80251e:	74 27                	je     802547 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802520:	6a 07                	push   $0x7
+  802522:	68 00 70 80 00       	push   $0x807000
+  802527:	56                   	push   %esi
+  802528:	ff 35 20 64 80 00    	push   0x806420
+  80252e:	e8 f5 12 00 00       	call   803828 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802533:	83 c4 0c             	add    $0xc,%esp
+  802536:	6a 00                	push   $0x0
+  802538:	53                   	push   %ebx
+  802539:	6a 00                	push   $0x0
+  80253b:	e8 70 12 00 00       	call   8037b0 <ipc_recv>
+}
+  802540:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802543:	5b                   	pop    %ebx
+  802544:	5e                   	pop    %esi
+  802545:	5d                   	pop    %ebp
+  802546:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802547:	83 ec 0c             	sub    $0xc,%esp
+  80254a:	6a 01                	push   $0x1
+  80254c:	e8 2b 13 00 00       	call   80387c <ipc_find_env>
+  802551:	a3 20 64 80 00       	mov    %eax,0x806420
+  802556:	83 c4 10             	add    $0x10,%esp
+  802559:	eb c5                	jmp    802520 <fsipc+0x12>
+
+0080255b <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80255b:	55                   	push   %ebp
+  80255c:	89 e5                	mov    %esp,%ebp
+  80255e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802561:	8b 45 08             	mov    0x8(%ebp),%eax
+  802564:	8b 40 0c             	mov    0xc(%eax),%eax
+  802567:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80256c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80256f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802574:	ba 00 00 00 00       	mov    $0x0,%edx
+  802579:	b8 02 00 00 00       	mov    $0x2,%eax
+  80257e:	e8 8b ff ff ff       	call   80250e <fsipc>
+}
+  802583:	c9                   	leave
+  802584:	c3                   	ret
+
+00802585 <devfile_flush>:
+{
+  802585:	55                   	push   %ebp
+  802586:	89 e5                	mov    %esp,%ebp
+  802588:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80258b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80258e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802591:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80259b:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025a0:	e8 69 ff ff ff       	call   80250e <fsipc>
+}
+  8025a5:	c9                   	leave
+  8025a6:	c3                   	ret
+
+008025a7 <devfile_stat>:
+{
+  8025a7:	55                   	push   %ebp
+  8025a8:	89 e5                	mov    %esp,%ebp
+  8025aa:	53                   	push   %ebx
+  8025ab:	83 ec 04             	sub    $0x4,%esp
+  8025ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8025b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025b7:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8025bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025c1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025c6:	e8 43 ff ff ff       	call   80250e <fsipc>
+  8025cb:	85 c0                	test   %eax,%eax
+  8025cd:	78 2c                	js     8025fb <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8025cf:	83 ec 08             	sub    $0x8,%esp
+  8025d2:	68 00 70 80 00       	push   $0x807000
+  8025d7:	53                   	push   %ebx
+  8025d8:	e8 5f ec ff ff       	call   80123c <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8025dd:	a1 80 70 80 00       	mov    0x807080,%eax
+  8025e2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8025e8:	a1 84 70 80 00       	mov    0x807084,%eax
+  8025ed:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8025f3:	83 c4 10             	add    $0x10,%esp
+  8025f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025fe:	c9                   	leave
+  8025ff:	c3                   	ret
+
+00802600 <devfile_write>:
+{
+  802600:	55                   	push   %ebp
+  802601:	89 e5                	mov    %esp,%ebp
+  802603:	83 ec 0c             	sub    $0xc,%esp
+  802606:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802609:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80260e:	39 d0                	cmp    %edx,%eax
+  802610:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802613:	8b 55 08             	mov    0x8(%ebp),%edx
+  802616:	8b 52 0c             	mov    0xc(%edx),%edx
+  802619:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = n;
+  80261f:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  802624:	50                   	push   %eax
+  802625:	ff 75 0c             	push   0xc(%ebp)
+  802628:	68 08 70 80 00       	push   $0x807008
+  80262d:	e8 90 ed ff ff       	call   8013c2 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  802632:	ba 00 00 00 00       	mov    $0x0,%edx
+  802637:	b8 04 00 00 00       	mov    $0x4,%eax
+  80263c:	e8 cd fe ff ff       	call   80250e <fsipc>
+}
+  802641:	c9                   	leave
+  802642:	c3                   	ret
+
+00802643 <devfile_read>:
+{
+  802643:	55                   	push   %ebp
+  802644:	89 e5                	mov    %esp,%ebp
+  802646:	56                   	push   %esi
+  802647:	53                   	push   %ebx
+  802648:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80264b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80264e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802651:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802656:	89 35 04 70 80 00    	mov    %esi,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80265c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802661:	b8 03 00 00 00       	mov    $0x3,%eax
+  802666:	e8 a3 fe ff ff       	call   80250e <fsipc>
+  80266b:	89 c3                	mov    %eax,%ebx
+  80266d:	85 c0                	test   %eax,%eax
+  80266f:	78 1f                	js     802690 <devfile_read+0x4d>
+	assert(r <= n);
+  802671:	39 c6                	cmp    %eax,%esi
+  802673:	72 24                	jb     802699 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802675:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80267a:	7f 33                	jg     8026af <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80267c:	83 ec 04             	sub    $0x4,%esp
+  80267f:	50                   	push   %eax
+  802680:	68 00 70 80 00       	push   $0x807000
+  802685:	ff 75 0c             	push   0xc(%ebp)
+  802688:	e8 35 ed ff ff       	call   8013c2 <memmove>
+	return r;
+  80268d:	83 c4 10             	add    $0x10,%esp
+}
+  802690:	89 d8                	mov    %ebx,%eax
+  802692:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802695:	5b                   	pop    %ebx
+  802696:	5e                   	pop    %esi
+  802697:	5d                   	pop    %ebp
+  802698:	c3                   	ret
+	assert(r <= n);
+  802699:	68 20 44 80 00       	push   $0x804420
+  80269e:	68 66 3e 80 00       	push   $0x803e66
+  8026a3:	6a 7c                	push   $0x7c
+  8026a5:	68 27 44 80 00       	push   $0x804427
+  8026aa:	e8 d4 e3 ff ff       	call   800a83 <_panic>
+	assert(r <= PGSIZE);
+  8026af:	68 32 44 80 00       	push   $0x804432
+  8026b4:	68 66 3e 80 00       	push   $0x803e66
+  8026b9:	6a 7d                	push   $0x7d
+  8026bb:	68 27 44 80 00       	push   $0x804427
+  8026c0:	e8 be e3 ff ff       	call   800a83 <_panic>
+
+008026c5 <open>:
+{
+  8026c5:	55                   	push   %ebp
+  8026c6:	89 e5                	mov    %esp,%ebp
+  8026c8:	56                   	push   %esi
+  8026c9:	53                   	push   %ebx
+  8026ca:	83 ec 1c             	sub    $0x1c,%esp
+  8026cd:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8026d0:	56                   	push   %esi
+  8026d1:	e8 2b eb ff ff       	call   801201 <strlen>
+  8026d6:	83 c4 10             	add    $0x10,%esp
+  8026d9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026de:	7f 6c                	jg     80274c <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8026e0:	83 ec 0c             	sub    $0xc,%esp
+  8026e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026e6:	50                   	push   %eax
+  8026e7:	e8 ba f8 ff ff       	call   801fa6 <fd_alloc>
+  8026ec:	89 c3                	mov    %eax,%ebx
+  8026ee:	83 c4 10             	add    $0x10,%esp
+  8026f1:	85 c0                	test   %eax,%eax
+  8026f3:	78 3c                	js     802731 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8026f5:	83 ec 08             	sub    $0x8,%esp
+  8026f8:	56                   	push   %esi
+  8026f9:	68 00 70 80 00       	push   $0x807000
+  8026fe:	e8 39 eb ff ff       	call   80123c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802703:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802706:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80270b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80270e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802713:	e8 f6 fd ff ff       	call   80250e <fsipc>
+  802718:	89 c3                	mov    %eax,%ebx
+  80271a:	83 c4 10             	add    $0x10,%esp
+  80271d:	85 c0                	test   %eax,%eax
+  80271f:	78 19                	js     80273a <open+0x75>
+	return fd2num(fd);
+  802721:	83 ec 0c             	sub    $0xc,%esp
+  802724:	ff 75 f4             	push   -0xc(%ebp)
+  802727:	e8 53 f8 ff ff       	call   801f7f <fd2num>
+  80272c:	89 c3                	mov    %eax,%ebx
+  80272e:	83 c4 10             	add    $0x10,%esp
+}
+  802731:	89 d8                	mov    %ebx,%eax
+  802733:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802736:	5b                   	pop    %ebx
+  802737:	5e                   	pop    %esi
+  802738:	5d                   	pop    %ebp
+  802739:	c3                   	ret
+		fd_close(fd, 0);
+  80273a:	83 ec 08             	sub    $0x8,%esp
+  80273d:	6a 00                	push   $0x0
+  80273f:	ff 75 f4             	push   -0xc(%ebp)
+  802742:	e8 58 f9 ff ff       	call   80209f <fd_close>
+		return r;
+  802747:	83 c4 10             	add    $0x10,%esp
+  80274a:	eb e5                	jmp    802731 <open+0x6c>
+		return -E_BAD_PATH;
+  80274c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802751:	eb de                	jmp    802731 <open+0x6c>
+
+00802753 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802753:	55                   	push   %ebp
+  802754:	89 e5                	mov    %esp,%ebp
+  802756:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802759:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802763:	e8 a6 fd ff ff       	call   80250e <fsipc>
+}
+  802768:	c9                   	leave
+  802769:	c3                   	ret
+
+0080276a <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  80276a:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80276e:	7f 01                	jg     802771 <writebuf+0x7>
+  802770:	c3                   	ret
+{
+  802771:	55                   	push   %ebp
+  802772:	89 e5                	mov    %esp,%ebp
+  802774:	53                   	push   %ebx
+  802775:	83 ec 08             	sub    $0x8,%esp
+  802778:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  80277a:	ff 70 04             	push   0x4(%eax)
+  80277d:	8d 40 10             	lea    0x10(%eax),%eax
+  802780:	50                   	push   %eax
+  802781:	ff 33                	push   (%ebx)
+  802783:	e8 a8 fb ff ff       	call   802330 <write>
+		if (result > 0)
+  802788:	83 c4 10             	add    $0x10,%esp
+  80278b:	85 c0                	test   %eax,%eax
+  80278d:	7e 03                	jle    802792 <writebuf+0x28>
+			b->result += result;
+  80278f:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802792:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802795:	74 0d                	je     8027a4 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802797:	85 c0                	test   %eax,%eax
+  802799:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279e:	0f 4f c2             	cmovg  %edx,%eax
+  8027a1:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  8027a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027a7:	c9                   	leave
+  8027a8:	c3                   	ret
+
+008027a9 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8027a9:	55                   	push   %ebp
+  8027aa:	89 e5                	mov    %esp,%ebp
+  8027ac:	53                   	push   %ebx
+  8027ad:	83 ec 04             	sub    $0x4,%esp
+  8027b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  8027b3:	8b 53 04             	mov    0x4(%ebx),%edx
+  8027b6:	8d 42 01             	lea    0x1(%edx),%eax
+  8027b9:	89 43 04             	mov    %eax,0x4(%ebx)
+  8027bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027bf:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  8027c3:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8027c8:	74 05                	je     8027cf <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  8027ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027cd:	c9                   	leave
+  8027ce:	c3                   	ret
+		writebuf(b);
+  8027cf:	89 d8                	mov    %ebx,%eax
+  8027d1:	e8 94 ff ff ff       	call   80276a <writebuf>
+		b->idx = 0;
+  8027d6:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  8027dd:	eb eb                	jmp    8027ca <putch+0x21>
+
+008027df <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  8027df:	55                   	push   %ebp
+  8027e0:	89 e5                	mov    %esp,%ebp
+  8027e2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  8027e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027eb:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8027f1:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8027f8:	00 00 00 
+	b.result = 0;
+  8027fb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802802:	00 00 00 
+	b.error = 1;
+  802805:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80280c:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  80280f:	ff 75 10             	push   0x10(%ebp)
+  802812:	ff 75 0c             	push   0xc(%ebp)
+  802815:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80281b:	50                   	push   %eax
+  80281c:	68 a9 27 80 00       	push   $0x8027a9
+  802821:	e8 2f e4 ff ff       	call   800c55 <vprintfmt>
+	if (b.idx > 0)
+  802826:	83 c4 10             	add    $0x10,%esp
+  802829:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802830:	7f 12                	jg     802844 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  802832:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802838:	85 c0                	test   %eax,%eax
+  80283a:	75 06                	jne    802842 <vfprintf+0x63>
+  80283c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802842:	c9                   	leave
+  802843:	c3                   	ret
+		writebuf(&b);
+  802844:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80284a:	e8 1b ff ff ff       	call   80276a <writebuf>
+  80284f:	eb e1                	jmp    802832 <vfprintf+0x53>
+
+00802851 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802851:	55                   	push   %ebp
+  802852:	89 e5                	mov    %esp,%ebp
+  802854:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802857:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  80285a:	50                   	push   %eax
+  80285b:	ff 75 0c             	push   0xc(%ebp)
+  80285e:	ff 75 08             	push   0x8(%ebp)
+  802861:	e8 79 ff ff ff       	call   8027df <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802866:	c9                   	leave
+  802867:	c3                   	ret
+
+00802868 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802868:	55                   	push   %ebp
+  802869:	89 e5                	mov    %esp,%ebp
+  80286b:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80286e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802871:	50                   	push   %eax
+  802872:	ff 75 08             	push   0x8(%ebp)
+  802875:	6a 01                	push   $0x1
+  802877:	e8 63 ff ff ff       	call   8027df <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80287c:	c9                   	leave
+  80287d:	c3                   	ret
+
+0080287e <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  80287e:	55                   	push   %ebp
+  80287f:	89 e5                	mov    %esp,%ebp
+  802881:	57                   	push   %edi
+  802882:	56                   	push   %esi
+  802883:	53                   	push   %ebx
+  802884:	81 ec 94 02 00 00    	sub    $0x294,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  80288a:	6a 00                	push   $0x0
+  80288c:	ff 75 08             	push   0x8(%ebp)
+  80288f:	e8 31 fe ff ff       	call   8026c5 <open>
+  802894:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  80289a:	83 c4 10             	add    $0x10,%esp
+  80289d:	85 c0                	test   %eax,%eax
+  80289f:	0f 88 d0 05 00 00    	js     802e75 <spawn+0x5f7>
+  8028a5:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  8028a7:	83 ec 04             	sub    $0x4,%esp
+  8028aa:	68 00 02 00 00       	push   $0x200
+  8028af:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8028b5:	50                   	push   %eax
+  8028b6:	51                   	push   %ecx
+  8028b7:	e8 2d fa ff ff       	call   8022e9 <readn>
+  8028bc:	83 c4 10             	add    $0x10,%esp
+  8028bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8028c4:	75 73                	jne    802939 <spawn+0xbb>
+	    || elf->e_magic != ELF_MAGIC) {
+  8028c6:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8028cd:	45 4c 46 
+  8028d0:	75 67                	jne    802939 <spawn+0xbb>
+  8028d2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8028d7:	cd 30                	int    $0x30
+  8028d9:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8028df:	85 c0                	test   %eax,%eax
+  8028e1:	0f 88 82 05 00 00    	js     802e69 <spawn+0x5eb>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8028e7:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8028ec:	89 c6                	mov    %eax,%esi
+  8028ee:	c1 e6 09             	shl    $0x9,%esi
+  8028f1:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8028f7:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8028fd:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802902:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802904:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  80290a:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802910:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802915:	be 00 00 00 00       	mov    $0x0,%esi
+  80291a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  80291d:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802920:	85 c0                	test   %eax,%eax
+  802922:	74 4d                	je     802971 <spawn+0xf3>
+		string_size += strlen(argv[argc]) + 1;
+  802924:	83 ec 0c             	sub    $0xc,%esp
+  802927:	50                   	push   %eax
+  802928:	e8 d4 e8 ff ff       	call   801201 <strlen>
+  80292d:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802931:	83 c3 01             	add    $0x1,%ebx
+  802934:	83 c4 10             	add    $0x10,%esp
+  802937:	eb e4                	jmp    80291d <spawn+0x9f>
+		close(fd);
+  802939:	83 ec 0c             	sub    $0xc,%esp
+  80293c:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  802942:	e8 df f7 ff ff       	call   802126 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802947:	83 c4 0c             	add    $0xc,%esp
+  80294a:	68 7f 45 4c 46       	push   $0x464c457f
+  80294f:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802955:	68 3e 44 80 00       	push   $0x80443e
+  80295a:	e8 ff e1 ff ff       	call   800b5e <cprintf>
+		return -E_NOT_EXEC;
+  80295f:	83 c4 10             	add    $0x10,%esp
+  802962:	c7 85 80 fd ff ff f2 	movl   $0xfffffff2,-0x280(%ebp)
+  802969:	ff ff ff 
+  80296c:	e9 04 05 00 00       	jmp    802e75 <spawn+0x5f7>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802971:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802977:	bf 00 10 40 00       	mov    $0x401000,%edi
+  80297c:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80297e:	89 fa                	mov    %edi,%edx
+  802980:	83 e2 fc             	and    $0xfffffffc,%edx
+  802983:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  80298a:	29 c2                	sub    %eax,%edx
+  80298c:	89 95 90 fd ff ff    	mov    %edx,-0x270(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802992:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802995:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80299a:	0f 86 e3 04 00 00    	jbe    802e83 <spawn+0x605>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8029a0:	83 ec 04             	sub    $0x4,%esp
+  8029a3:	6a 07                	push   $0x7
+  8029a5:	68 00 00 40 00       	push   $0x400000
+  8029aa:	6a 00                	push   $0x0
+  8029ac:	e8 f8 ec ff ff       	call   8016a9 <sys_page_alloc>
+  8029b1:	83 c4 10             	add    $0x10,%esp
+  8029b4:	85 c0                	test   %eax,%eax
+  8029b6:	0f 88 cc 04 00 00    	js     802e88 <spawn+0x60a>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8029bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8029c1:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  8029c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8029ca:	eb 30                	jmp    8029fc <spawn+0x17e>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8029cc:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8029d2:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  8029d8:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  8029db:	83 ec 08             	sub    $0x8,%esp
+  8029de:	ff 34 b3             	push   (%ebx,%esi,4)
+  8029e1:	57                   	push   %edi
+  8029e2:	e8 55 e8 ff ff       	call   80123c <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8029e7:	83 c4 04             	add    $0x4,%esp
+  8029ea:	ff 34 b3             	push   (%ebx,%esi,4)
+  8029ed:	e8 0f e8 ff ff       	call   801201 <strlen>
+  8029f2:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  8029f6:	83 c6 01             	add    $0x1,%esi
+  8029f9:	83 c4 10             	add    $0x10,%esp
+  8029fc:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  802a02:	7f c8                	jg     8029cc <spawn+0x14e>
+	}
+	argv_store[argc] = 0;
+  802a04:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802a0a:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802a10:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802a17:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802a1d:	0f 85 81 00 00 00    	jne    802aa4 <spawn+0x226>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802a23:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  802a29:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  802a2f:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  802a32:	89 c8                	mov    %ecx,%eax
+  802a34:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802a3a:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802a3d:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802a42:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802a48:	83 ec 0c             	sub    $0xc,%esp
+  802a4b:	6a 07                	push   $0x7
+  802a4d:	68 00 d0 bf ee       	push   $0xeebfd000
+  802a52:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802a58:	68 00 00 40 00       	push   $0x400000
+  802a5d:	6a 00                	push   $0x0
+  802a5f:	e8 cb ec ff ff       	call   80172f <sys_page_map>
+  802a64:	89 c3                	mov    %eax,%ebx
+  802a66:	83 c4 20             	add    $0x20,%esp
+  802a69:	85 c0                	test   %eax,%eax
+  802a6b:	0f 88 1f 04 00 00    	js     802e90 <spawn+0x612>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802a71:	83 ec 08             	sub    $0x8,%esp
+  802a74:	68 00 00 40 00       	push   $0x400000
+  802a79:	6a 00                	push   $0x0
+  802a7b:	e8 f1 ec ff ff       	call   801771 <sys_page_unmap>
+  802a80:	89 c3                	mov    %eax,%ebx
+  802a82:	83 c4 10             	add    $0x10,%esp
+  802a85:	85 c0                	test   %eax,%eax
+  802a87:	0f 88 03 04 00 00    	js     802e90 <spawn+0x612>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802a8d:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802a93:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802a9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a9f:	e9 87 01 00 00       	jmp    802c2b <spawn+0x3ad>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802aa4:	68 ac 44 80 00       	push   $0x8044ac
+  802aa9:	68 66 3e 80 00       	push   $0x803e66
+  802aae:	68 f1 00 00 00       	push   $0xf1
+  802ab3:	68 58 44 80 00       	push   $0x804458
+  802ab8:	e8 c6 df ff ff       	call   800a83 <_panic>
+	}
+
+	// from file, as many pages at a time as fit below PFTEMP
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+		for (j = 0; j < n; j += r)
+  802abd:	01 c6                	add    %eax,%esi
+  802abf:	39 f3                	cmp    %esi,%ebx
+  802ac1:	7e 4c                	jle    802b0f <spawn+0x291>
+			if ((r = sys_page_alloc_range(0, UTEMP + j * PGSIZE, n - j, PTE_P|PTE_U|PTE_W)) < 0)
+  802ac3:	6a 07                	push   $0x7
+  802ac5:	89 d8                	mov    %ebx,%eax
+  802ac7:	29 f0                	sub    %esi,%eax
+  802ac9:	50                   	push   %eax
+  802aca:	89 f0                	mov    %esi,%eax
+  802acc:	c1 e0 0c             	shl    $0xc,%eax
+  802acf:	05 00 00 40 00       	add    $0x400000,%eax
+  802ad4:	50                   	push   %eax
+  802ad5:	6a 00                	push   $0x0
+  802ad7:	e8 d7 ec ff ff       	call   8017b3 <sys_page_alloc_range>
+  802adc:	83 c4 10             	add    $0x10,%esp
+  802adf:	85 c0                	test   %eax,%eax
+  802ae1:	79 da                	jns    802abd <spawn+0x23f>
+  802ae3:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802ae5:	83 ec 0c             	sub    $0xc,%esp
+  802ae8:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802aee:	e8 d6 ea ff ff       	call   8015c9 <sys_env_destroy>
+	close(fd);
+  802af3:	83 c4 04             	add    $0x4,%esp
+  802af6:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  802afc:	e8 25 f6 ff ff       	call   802126 <close>
+	return r;
+  802b01:	83 c4 10             	add    $0x10,%esp
+  802b04:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  802b0a:	e9 66 03 00 00       	jmp    802e75 <spawn+0x5f7>
+				return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  802b0f:	83 ec 08             	sub    $0x8,%esp
+  802b12:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  802b18:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  802b1e:	01 c8                	add    %ecx,%eax
+  802b20:	50                   	push   %eax
+  802b21:	8b b5 80 fd ff ff    	mov    -0x280(%ebp),%esi
+  802b27:	56                   	push   %esi
+  802b28:	e8 85 f8 ff ff       	call   8023b2 <seek>
+  802b2d:	83 c4 10             	add    $0x10,%esp
+  802b30:	85 c0                	test   %eax,%eax
+  802b32:	0f 88 cd 01 00 00    	js     802d05 <spawn+0x487>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  802b38:	89 d8                	mov    %ebx,%eax
+  802b3a:	c1 e0 0c             	shl    $0xc,%eax
+  802b3d:	89 85 74 fd ff ff    	mov    %eax,-0x28c(%ebp)
+  802b43:	83 ec 04             	sub    $0x4,%esp
+  802b46:	39 f8                	cmp    %edi,%eax
+  802b48:	0f 46 f8             	cmovbe %eax,%edi
+  802b4b:	57                   	push   %edi
+  802b4c:	68 00 00 40 00       	push   $0x400000
+  802b51:	56                   	push   %esi
+  802b52:	e8 92 f7 ff ff       	call   8022e9 <readn>
+  802b57:	83 c4 10             	add    $0x10,%esp
+  802b5a:	85 c0                	test   %eax,%eax
+  802b5c:	0f 88 aa 01 00 00    	js     802d0c <spawn+0x48e>
+			return r;
+		for (j = 0; j < n; j += r)
+  802b62:	be 00 00 00 00       	mov    $0x0,%esi
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  802b67:	8b bd 84 fd ff ff    	mov    -0x27c(%ebp),%edi
+  802b6d:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802b73:	01 c7                	add    %eax,%edi
+		for (j = 0; j < n; j += r)
+  802b75:	39 f3                	cmp    %esi,%ebx
+  802b77:	7e 4a                	jle    802bc3 <spawn+0x345>
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  802b79:	89 f0                	mov    %esi,%eax
+  802b7b:	c1 e0 0c             	shl    $0xc,%eax
+  802b7e:	83 ec 08             	sub    $0x8,%esp
+  802b81:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802b87:	89 da                	mov    %ebx,%edx
+  802b89:	29 f2                	sub    %esi,%edx
+  802b8b:	52                   	push   %edx
+  802b8c:	8d 14 07             	lea    (%edi,%eax,1),%edx
+  802b8f:	52                   	push   %edx
+  802b90:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802b96:	05 00 00 40 00       	add    $0x400000,%eax
+  802b9b:	50                   	push   %eax
+  802b9c:	6a 00                	push   $0x0
+  802b9e:	e8 33 ec ff ff       	call   8017d6 <sys_page_map_range>
+  802ba3:	83 c4 20             	add    $0x20,%esp
+  802ba6:	85 c0                	test   %eax,%eax
+  802ba8:	78 04                	js     802bae <spawn+0x330>
+		for (j = 0; j < n; j += r)
+  802baa:	01 c6                	add    %eax,%esi
+  802bac:	eb c7                	jmp    802b75 <spawn+0x2f7>
+				panic("spawn: sys_page_map_range data: %e", r);
+  802bae:	50                   	push   %eax
+  802baf:	68 d4 44 80 00       	push   $0x8044d4
+  802bb4:	68 22 01 00 00       	push   $0x122
+  802bb9:	68 58 44 80 00       	push   $0x804458
+  802bbe:	e8 c0 de ff ff       	call   800a83 <_panic>
+		sys_page_unmap_range(0, UTEMP, n);
+  802bc3:	83 ec 04             	sub    $0x4,%esp
+  802bc6:	53                   	push   %ebx
+  802bc7:	68 00 00 40 00       	push   $0x400000
+  802bcc:	6a 00                	push   $0x0
+  802bce:	e8 88 ec ff ff       	call   80185b <sys_page_unmap_range>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802bd3:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  802bd9:	01 8d 8c fd ff ff    	add    %ecx,-0x274(%ebp)
+  802bdf:	83 c4 10             	add    $0x10,%esp
+  802be2:	e9 c4 00 00 00       	jmp    802cab <spawn+0x42d>
+	}
+
+	// the rest is zero-filled on demand
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  802be7:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  802bed:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  802bf3:	8b 9d 6c fd ff ff    	mov    -0x294(%ebp),%ebx
+  802bf9:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  802bff:	39 c8                	cmp    %ecx,%eax
+  802c01:	73 22                	jae    802c25 <spawn+0x3a7>
+  802c03:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802c09:	29 c1                	sub    %eax,%ecx
+  802c0b:	51                   	push   %ecx
+  802c0c:	01 d0                	add    %edx,%eax
+  802c0e:	50                   	push   %eax
+  802c0f:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802c15:	e8 fd eb ff ff       	call   801817 <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802c1a:	83 c4 10             	add    $0x10,%esp
+  802c1d:	85 c0                	test   %eax,%eax
+  802c1f:	0f 88 d1 00 00 00    	js     802cf6 <spawn+0x478>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802c25:	83 c3 01             	add    $0x1,%ebx
+  802c28:	83 c6 20             	add    $0x20,%esi
+  802c2b:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802c32:	39 d8                	cmp    %ebx,%eax
+  802c34:	0f 8e d9 00 00 00    	jle    802d13 <spawn+0x495>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802c3a:	83 3e 01             	cmpl   $0x1,(%esi)
+  802c3d:	75 e6                	jne    802c25 <spawn+0x3a7>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802c3f:	8b 46 18             	mov    0x18(%esi),%eax
+  802c42:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802c45:	83 f8 01             	cmp    $0x1,%eax
+  802c48:	19 c0                	sbb    %eax,%eax
+  802c4a:	83 e0 fe             	and    $0xfffffffe,%eax
+  802c4d:	83 c0 07             	add    $0x7,%eax
+  802c50:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802c56:	8b 7e 04             	mov    0x4(%esi),%edi
+  802c59:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  802c5f:	8b 46 10             	mov    0x10(%esi),%eax
+  802c62:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802c68:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802c6b:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  802c6e:	89 d0                	mov    %edx,%eax
+  802c70:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802c75:	74 12                	je     802c89 <spawn+0x40b>
+		va -= i;
+  802c77:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  802c79:	01 c1                	add    %eax,%ecx
+		filesz += i;
+  802c7b:	01 85 88 fd ff ff    	add    %eax,-0x278(%ebp)
+		fileoffset -= i;
+  802c81:	29 c7                	sub    %eax,%edi
+  802c83:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802c89:	c7 85 8c fd ff ff 00 	movl   $0x0,-0x274(%ebp)
+  802c90:	00 00 00 
+  802c93:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  802c99:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  802c9f:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  802ca5:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  802cab:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802cb1:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  802cb7:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802cbd:	39 c8                	cmp    %ecx,%eax
+  802cbf:	0f 83 22 ff ff ff    	jae    802be7 <spawn+0x369>
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+  802cc5:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  802ccb:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802cd1:	29 c7                	sub    %eax,%edi
+  802cd3:	8d 9f ff 0f 00 00    	lea    0xfff(%edi),%ebx
+  802cd9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802cdf:	b8 00 f0 3f 00       	mov    $0x3ff000,%eax
+  802ce4:	39 c3                	cmp    %eax,%ebx
+  802ce6:	0f 47 d8             	cmova  %eax,%ebx
+  802ce9:	c1 eb 0c             	shr    $0xc,%ebx
+		for (j = 0; j < n; j += r)
+  802cec:	be 00 00 00 00       	mov    $0x0,%esi
+  802cf1:	e9 c9 fd ff ff       	jmp    802abf <spawn+0x241>
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  802cf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cfb:	89 d7                	mov    %edx,%edi
+  802cfd:	0f 4e f8             	cmovle %eax,%edi
+  802d00:	e9 e0 fd ff ff       	jmp    802ae5 <spawn+0x267>
+  802d05:	89 c7                	mov    %eax,%edi
+  802d07:	e9 d9 fd ff ff       	jmp    802ae5 <spawn+0x267>
+  802d0c:	89 c7                	mov    %eax,%edi
+  802d0e:	e9 d2 fd ff ff       	jmp    802ae5 <spawn+0x267>
+	close(fd);
+  802d13:	83 ec 0c             	sub    $0xc,%esp
+  802d16:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  802d1c:	e8 05 f4 ff ff       	call   802126 <close>
+  802d21:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	uint32_t pn, n;
+	void *va;
+	int perm, r;
+
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  802d24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d29:	e9 82 00 00 00       	jmp    802db0 <spawn+0x532>
+		// in one go.
+		perm = uvpt[pn] & PTE_SYSCALL;
+		while (pn + n < PGNUM(UTOP)
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+			n++;
+  802d2e:	83 c6 01             	add    $0x1,%esi
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  802d31:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  802d36:	74 2e                	je     802d66 <spawn+0x4e8>
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+  802d38:	89 c2                	mov    %eax,%edx
+  802d3a:	c1 e2 0c             	shl    $0xc,%edx
+  802d3d:	c1 ea 16             	shr    $0x16,%edx
+  802d40:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802d47:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802d4d:	83 fa 01             	cmp    $0x1,%edx
+  802d50:	75 14                	jne    802d66 <spawn+0x4e8>
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  802d52:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802d59:	83 c0 01             	add    $0x1,%eax
+  802d5c:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  802d62:	39 d7                	cmp    %edx,%edi
+  802d64:	74 c8                	je     802d2e <spawn+0x4b0>
+		if ((r = sys_page_map_range(0, va, child, va, n, perm)) != n)
+  802d66:	83 ec 08             	sub    $0x8,%esp
+  802d69:	57                   	push   %edi
+  802d6a:	56                   	push   %esi
+  802d6b:	51                   	push   %ecx
+  802d6c:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802d72:	51                   	push   %ecx
+  802d73:	6a 00                	push   $0x0
+  802d75:	e8 5c ea ff ff       	call   8017d6 <sys_page_map_range>
+  802d7a:	89 c2                	mov    %eax,%edx
+  802d7c:	83 c4 20             	add    $0x20,%esp
+  802d7f:	39 c6                	cmp    %eax,%esi
+  802d81:	74 23                	je     802da6 <spawn+0x528>
+			panic("sys_page_map_range: %e", r < 0 ? r : -E_NO_MEM);
+  802d83:	85 c0                	test   %eax,%eax
+  802d85:	78 05                	js     802d8c <spawn+0x50e>
+  802d87:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802d8c:	50                   	push   %eax
+  802d8d:	68 64 44 80 00       	push   $0x804464
+  802d92:	68 47 01 00 00       	push   $0x147
+  802d97:	68 58 44 80 00       	push   $0x804458
+  802d9c:	e8 e2 dc ff ff       	call   800a83 <_panic>
+		n = 1;
+  802da1:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  802da6:	01 d3                	add    %edx,%ebx
+  802da8:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802dae:	77 4e                	ja     802dfe <spawn+0x580>
+		va = (void *) (pn << PGSHIFT);
+  802db0:	89 d9                	mov    %ebx,%ecx
+  802db2:	c1 e1 0c             	shl    $0xc,%ecx
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  802db5:	89 c8                	mov    %ecx,%eax
+  802db7:	c1 e8 16             	shr    $0x16,%eax
+  802dba:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802dc1:	25 81 00 00 00       	and    $0x81,%eax
+  802dc6:	83 f8 01             	cmp    $0x1,%eax
+  802dc9:	75 d6                	jne    802da1 <spawn+0x523>
+		if (!(uvpt[pn] & PTE_P))
+  802dcb:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  802dd2:	83 e2 01             	and    $0x1,%edx
+  802dd5:	74 23                	je     802dfa <spawn+0x57c>
+		if (!(uvpt[pn] & PTE_SHARE))
+  802dd7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802dde:	f6 c4 04             	test   $0x4,%ah
+  802de1:	74 c3                	je     802da6 <spawn+0x528>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  802de3:	8b 3c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edi
+  802dea:	81 e7 07 0e 00 00    	and    $0xe07,%edi
+		while (pn + n < PGNUM(UTOP)
+  802df0:	8d 43 01             	lea    0x1(%ebx),%eax
+		n = 1;
+  802df3:	89 d6                	mov    %edx,%esi
+		while (pn + n < PGNUM(UTOP)
+  802df5:	e9 37 ff ff ff       	jmp    802d31 <spawn+0x4b3>
+		n = 1;
+  802dfa:	89 c2                	mov    %eax,%edx
+  802dfc:	eb a8                	jmp    802da6 <spawn+0x528>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802dfe:	83 ec 08             	sub    $0x8,%esp
+  802e01:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802e07:	50                   	push   %eax
+  802e08:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802e0e:	e8 4f eb ff ff       	call   801962 <sys_env_set_trapframe>
+  802e13:	83 c4 10             	add    $0x10,%esp
+  802e16:	85 c0                	test   %eax,%eax
+  802e18:	78 25                	js     802e3f <spawn+0x5c1>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802e1a:	83 ec 08             	sub    $0x8,%esp
+  802e1d:	6a 02                	push   $0x2
+  802e1f:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802e25:	e8 53 ea ff ff       	call   80187d <sys_env_set_status>
+  802e2a:	83 c4 10             	add    $0x10,%esp
+  802e2d:	85 c0                	test   %eax,%eax
+  802e2f:	78 23                	js     802e54 <spawn+0x5d6>
+	return child;
+  802e31:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802e37:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802e3d:	eb 36                	jmp    802e75 <spawn+0x5f7>
+		panic("sys_env_set_trapframe: %e", r);
+  802e3f:	50                   	push   %eax
+  802e40:	68 7b 44 80 00       	push   $0x80447b
+  802e45:	68 85 00 00 00       	push   $0x85
+  802e4a:	68 58 44 80 00       	push   $0x804458
+  802e4f:	e8 2f dc ff ff       	call   800a83 <_panic>
+		panic("sys_env_set_status: %e", r);
+  802e54:	50                   	push   %eax
+  802e55:	68 95 44 80 00       	push   $0x804495
+  802e5a:	68 88 00 00 00       	push   $0x88
+  802e5f:	68 58 44 80 00       	push   $0x804458
+  802e64:	e8 1a dc ff ff       	call   800a83 <_panic>
+		return r;
+  802e69:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802e6f:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+}
+  802e75:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802e7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e7e:	5b                   	pop    %ebx
+  802e7f:	5e                   	pop    %esi
+  802e80:	5f                   	pop    %edi
+  802e81:	5d                   	pop    %ebp
+  802e82:	c3                   	ret
+		return -E_NO_MEM;
+  802e83:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802e88:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802e8e:	eb e5                	jmp    802e75 <spawn+0x5f7>
+	sys_page_unmap(0, UTEMP);
+  802e90:	83 ec 08             	sub    $0x8,%esp
+  802e93:	68 00 00 40 00       	push   $0x400000
+  802e98:	6a 00                	push   $0x0
+  802e9a:	e8 d2 e8 ff ff       	call   801771 <sys_page_unmap>
+  802e9f:	83 c4 10             	add    $0x10,%esp
+  802ea2:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  802ea8:	eb cb                	jmp    802e75 <spawn+0x5f7>
+
+00802eaa <spawnl>:
+{
+  802eaa:	55                   	push   %ebp
+  802eab:	89 e5                	mov    %esp,%ebp
+  802ead:	56                   	push   %esi
+  802eae:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802eaf:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  802eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  802eb7:	eb 05                	jmp    802ebe <spawnl+0x14>
+		argc++;
+  802eb9:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802ebc:	89 ca                	mov    %ecx,%edx
+  802ebe:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802ec1:	83 3a 00             	cmpl   $0x0,(%edx)
+  802ec4:	75 f3                	jne    802eb9 <spawnl+0xf>
+	const char *argv[argc+2];
+  802ec6:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802ecd:	83 e2 f0             	and    $0xfffffff0,%edx
+  802ed0:	29 d4                	sub    %edx,%esp
+  802ed2:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802ed6:	89 da                	mov    %ebx,%edx
+  802ed8:	c1 ea 02             	shr    $0x2,%edx
+  802edb:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802ede:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ee1:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802ee8:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802eef:	00 
+	va_start(vl, arg0);
+  802ef0:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802ef3:	89 c2                	mov    %eax,%edx
+  802ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802efa:	eb 0b                	jmp    802f07 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802efc:	83 c0 01             	add    $0x1,%eax
+  802eff:	8b 31                	mov    (%ecx),%esi
+  802f01:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802f04:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802f07:	39 d0                	cmp    %edx,%eax
+  802f09:	75 f1                	jne    802efc <spawnl+0x52>
+	return spawn(prog, argv);
+  802f0b:	83 ec 08             	sub    $0x8,%esp
+  802f0e:	53                   	push   %ebx
+  802f0f:	ff 75 08             	push   0x8(%ebp)
+  802f12:	e8 67 f9 ff ff       	call   80287e <spawn>
+}
+  802f17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f1a:	5b                   	pop    %ebx
+  802f1b:	5e                   	pop    %esi
+  802f1c:	5d                   	pop    %ebp
+  802f1d:	c3                   	ret
+
+00802f1e <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f1e:	55                   	push   %ebp
+  802f1f:	89 e5                	mov    %esp,%ebp
+  802f21:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802f24:	68 f7 44 80 00       	push   $0x8044f7
+  802f29:	ff 75 0c             	push   0xc(%ebp)
+  802f2c:	e8 0b e3 ff ff       	call   80123c <strcpy>
+	return 0;
+}
+  802f31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f36:	c9                   	leave
+  802f37:	c3                   	ret
+
+00802f38 <devsock_close>:
+{
+  802f38:	55                   	push   %ebp
+  802f39:	89 e5                	mov    %esp,%ebp
+  802f3b:	53                   	push   %ebx
+  802f3c:	83 ec 10             	sub    $0x10,%esp
+  802f3f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802f42:	53                   	push   %ebx
+  802f43:	e8 44 09 00 00       	call   80388c <pageref>
+  802f48:	89 c2                	mov    %eax,%edx
+  802f4a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802f52:	83 fa 01             	cmp    $0x1,%edx
+  802f55:	74 05                	je     802f5c <devsock_close+0x24>
+}
+  802f57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f5a:	c9                   	leave
+  802f5b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802f5c:	83 ec 0c             	sub    $0xc,%esp
+  802f5f:	ff 73 0c             	push   0xc(%ebx)
+  802f62:	e8 b7 02 00 00       	call   80321e <nsipc_close>
+  802f67:	83 c4 10             	add    $0x10,%esp
+  802f6a:	eb eb                	jmp    802f57 <devsock_close+0x1f>
+
+00802f6c <devsock_write>:
+{
+  802f6c:	55                   	push   %ebp
+  802f6d:	89 e5                	mov    %esp,%ebp
+  802f6f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802f72:	6a 00                	push   $0x0
+  802f74:	ff 75 10             	push   0x10(%ebp)
+  802f77:	ff 75 0c             	push   0xc(%ebp)
+  802f7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f7d:	ff 70 0c             	push   0xc(%eax)
+  802f80:	e8 79 03 00 00       	call   8032fe <nsipc_send>
+}
+  802f85:	c9                   	leave
+  802f86:	c3                   	ret
+
+00802f87 <devsock_read>:
+{
+  802f87:	55                   	push   %ebp
+  802f88:	89 e5                	mov    %esp,%ebp
+  802f8a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802f8d:	6a 00                	push   $0x0
+  802f8f:	ff 75 10             	push   0x10(%ebp)
+  802f92:	ff 75 0c             	push   0xc(%ebp)
+  802f95:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f98:	ff 70 0c             	push   0xc(%eax)
+  802f9b:	e8 ef 02 00 00       	call   80328f <nsipc_recv>
+}
+  802fa0:	c9                   	leave
+  802fa1:	c3                   	ret
+
+00802fa2 <fd2sockid>:
+{
+  802fa2:	55                   	push   %ebp
+  802fa3:	89 e5                	mov    %esp,%ebp
+  802fa5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802fa8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802fab:	52                   	push   %edx
+  802fac:	50                   	push   %eax
+  802fad:	e8 4a f0 ff ff       	call   801ffc <fd_lookup>
+  802fb2:	83 c4 10             	add    $0x10,%esp
+  802fb5:	85 c0                	test   %eax,%eax
+  802fb7:	78 10                	js     802fc9 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802fb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fbc:	8b 0d 3c 50 80 00    	mov    0x80503c,%ecx
+  802fc2:	39 08                	cmp    %ecx,(%eax)
+  802fc4:	75 05                	jne    802fcb <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802fc6:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802fc9:	c9                   	leave
+  802fca:	c3                   	ret
+		return -E_NOT_SUPP;
+  802fcb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802fd0:	eb f7                	jmp    802fc9 <fd2sockid+0x27>
+
+00802fd2 <alloc_sockfd>:
+{
+  802fd2:	55                   	push   %ebp
+  802fd3:	89 e5                	mov    %esp,%ebp
+  802fd5:	56                   	push   %esi
+  802fd6:	53                   	push   %ebx
+  802fd7:	83 ec 1c             	sub    $0x1c,%esp
+  802fda:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802fdc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fdf:	50                   	push   %eax
+  802fe0:	e8 c1 ef ff ff       	call   801fa6 <fd_alloc>
+  802fe5:	89 c3                	mov    %eax,%ebx
+  802fe7:	83 c4 10             	add    $0x10,%esp
+  802fea:	85 c0                	test   %eax,%eax
+  802fec:	78 43                	js     803031 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802fee:	83 ec 04             	sub    $0x4,%esp
+  802ff1:	68 07 04 00 00       	push   $0x407
+  802ff6:	ff 75 f4             	push   -0xc(%ebp)
+  802ff9:	6a 00                	push   $0x0
+  802ffb:	e8 a9 e6 ff ff       	call   8016a9 <sys_page_alloc>
+  803000:	89 c3                	mov    %eax,%ebx
+  803002:	83 c4 10             	add    $0x10,%esp
+  803005:	85 c0                	test   %eax,%eax
+  803007:	78 28                	js     803031 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803009:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80300c:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  803012:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803014:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803017:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80301e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803021:	83 ec 0c             	sub    $0xc,%esp
+  803024:	50                   	push   %eax
+  803025:	e8 55 ef ff ff       	call   801f7f <fd2num>
+  80302a:	89 c3                	mov    %eax,%ebx
+  80302c:	83 c4 10             	add    $0x10,%esp
+  80302f:	eb 0c                	jmp    80303d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803031:	83 ec 0c             	sub    $0xc,%esp
+  803034:	56                   	push   %esi
+  803035:	e8 e4 01 00 00       	call   80321e <nsipc_close>
+		return r;
+  80303a:	83 c4 10             	add    $0x10,%esp
+}
+  80303d:	89 d8                	mov    %ebx,%eax
+  80303f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803042:	5b                   	pop    %ebx
+  803043:	5e                   	pop    %esi
+  803044:	5d                   	pop    %ebp
+  803045:	c3                   	ret
+
+00803046 <accept>:
+{
+  803046:	55                   	push   %ebp
+  803047:	89 e5                	mov    %esp,%ebp
+  803049:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80304c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80304f:	e8 4e ff ff ff       	call   802fa2 <fd2sockid>
+  803054:	85 c0                	test   %eax,%eax
+  803056:	78 1b                	js     803073 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803058:	83 ec 04             	sub    $0x4,%esp
+  80305b:	ff 75 10             	push   0x10(%ebp)
+  80305e:	ff 75 0c             	push   0xc(%ebp)
+  803061:	50                   	push   %eax
+  803062:	e8 0e 01 00 00       	call   803175 <nsipc_accept>
+  803067:	83 c4 10             	add    $0x10,%esp
+  80306a:	85 c0                	test   %eax,%eax
+  80306c:	78 05                	js     803073 <accept+0x2d>
+	return alloc_sockfd(r);
+  80306e:	e8 5f ff ff ff       	call   802fd2 <alloc_sockfd>
+}
+  803073:	c9                   	leave
+  803074:	c3                   	ret
+
+00803075 <bind>:
+{
+  803075:	55                   	push   %ebp
+  803076:	89 e5                	mov    %esp,%ebp
+  803078:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80307b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80307e:	e8 1f ff ff ff       	call   802fa2 <fd2sockid>
+  803083:	85 c0                	test   %eax,%eax
+  803085:	78 12                	js     803099 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803087:	83 ec 04             	sub    $0x4,%esp
+  80308a:	ff 75 10             	push   0x10(%ebp)
+  80308d:	ff 75 0c             	push   0xc(%ebp)
+  803090:	50                   	push   %eax
+  803091:	e8 31 01 00 00       	call   8031c7 <nsipc_bind>
+  803096:	83 c4 10             	add    $0x10,%esp
+}
+  803099:	c9                   	leave
+  80309a:	c3                   	ret
+
+0080309b <shutdown>:
+{
+  80309b:	55                   	push   %ebp
+  80309c:	89 e5                	mov    %esp,%ebp
+  80309e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030a4:	e8 f9 fe ff ff       	call   802fa2 <fd2sockid>
+  8030a9:	85 c0                	test   %eax,%eax
+  8030ab:	78 0f                	js     8030bc <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8030ad:	83 ec 08             	sub    $0x8,%esp
+  8030b0:	ff 75 0c             	push   0xc(%ebp)
+  8030b3:	50                   	push   %eax
+  8030b4:	e8 43 01 00 00       	call   8031fc <nsipc_shutdown>
+  8030b9:	83 c4 10             	add    $0x10,%esp
+}
+  8030bc:	c9                   	leave
+  8030bd:	c3                   	ret
+
+008030be <connect>:
+{
+  8030be:	55                   	push   %ebp
+  8030bf:	89 e5                	mov    %esp,%ebp
+  8030c1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030c7:	e8 d6 fe ff ff       	call   802fa2 <fd2sockid>
+  8030cc:	85 c0                	test   %eax,%eax
+  8030ce:	78 12                	js     8030e2 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8030d0:	83 ec 04             	sub    $0x4,%esp
+  8030d3:	ff 75 10             	push   0x10(%ebp)
+  8030d6:	ff 75 0c             	push   0xc(%ebp)
+  8030d9:	50                   	push   %eax
+  8030da:	e8 59 01 00 00       	call   803238 <nsipc_connect>
+  8030df:	83 c4 10             	add    $0x10,%esp
+}
+  8030e2:	c9                   	leave
+  8030e3:	c3                   	ret
+
+008030e4 <listen>:
+{
+  8030e4:	55                   	push   %ebp
+  8030e5:	89 e5                	mov    %esp,%ebp
+  8030e7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ed:	e8 b0 fe ff ff       	call   802fa2 <fd2sockid>
+  8030f2:	85 c0                	test   %eax,%eax
+  8030f4:	78 0f                	js     803105 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8030f6:	83 ec 08             	sub    $0x8,%esp
+  8030f9:	ff 75 0c             	push   0xc(%ebp)
+  8030fc:	50                   	push   %eax
+  8030fd:	e8 6b 01 00 00       	call   80326d <nsipc_listen>
+  803102:	83 c4 10             	add    $0x10,%esp
+}
+  803105:	c9                   	leave
+  803106:	c3                   	ret
+
+00803107 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803107:	55                   	push   %ebp
+  803108:	89 e5                	mov    %esp,%ebp
+  80310a:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80310d:	ff 75 10             	push   0x10(%ebp)
+  803110:	ff 75 0c             	push   0xc(%ebp)
+  803113:	ff 75 08             	push   0x8(%ebp)
+  803116:	e8 41 02 00 00       	call   80335c <nsipc_socket>
+  80311b:	83 c4 10             	add    $0x10,%esp
+  80311e:	85 c0                	test   %eax,%eax
+  803120:	78 05                	js     803127 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803122:	e8 ab fe ff ff       	call   802fd2 <alloc_sockfd>
+}
+  803127:	c9                   	leave
+  803128:	c3                   	ret
+
+00803129 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803129:	55                   	push   %ebp
+  80312a:	89 e5                	mov    %esp,%ebp
+  80312c:	53                   	push   %ebx
+  80312d:	83 ec 04             	sub    $0x4,%esp
+  803130:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803132:	83 3d 24 64 80 00 00 	cmpl   $0x0,0x806424
+  803139:	74 26                	je     803161 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80313b:	6a 07                	push   $0x7
+  80313d:	68 00 80 80 00       	push   $0x808000
+  803142:	53                   	push   %ebx
+  803143:	ff 35 24 64 80 00    	push   0x806424
+  803149:	e8 da 06 00 00       	call   803828 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80314e:	83 c4 0c             	add    $0xc,%esp
+  803151:	6a 00                	push   $0x0
+  803153:	6a 00                	push   $0x0
+  803155:	6a 00                	push   $0x0
+  803157:	e8 54 06 00 00       	call   8037b0 <ipc_recv>
+}
+  80315c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80315f:	c9                   	leave
+  803160:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803161:	83 ec 0c             	sub    $0xc,%esp
+  803164:	6a 02                	push   $0x2
+  803166:	e8 11 07 00 00       	call   80387c <ipc_find_env>
+  80316b:	a3 24 64 80 00       	mov    %eax,0x806424
+  803170:	83 c4 10             	add    $0x10,%esp
+  803173:	eb c6                	jmp    80313b <nsipc+0x12>
+
+00803175 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803175:	55                   	push   %ebp
+  803176:	89 e5                	mov    %esp,%ebp
+  803178:	56                   	push   %esi
+  803179:	53                   	push   %ebx
+  80317a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80317d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803180:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803185:	8b 06                	mov    (%esi),%eax
+  803187:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80318c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803191:	e8 93 ff ff ff       	call   803129 <nsipc>
+  803196:	89 c3                	mov    %eax,%ebx
+  803198:	85 c0                	test   %eax,%eax
+  80319a:	79 09                	jns    8031a5 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80319c:	89 d8                	mov    %ebx,%eax
+  80319e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031a1:	5b                   	pop    %ebx
+  8031a2:	5e                   	pop    %esi
+  8031a3:	5d                   	pop    %ebp
+  8031a4:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8031a5:	83 ec 04             	sub    $0x4,%esp
+  8031a8:	ff 35 10 80 80 00    	push   0x808010
+  8031ae:	68 00 80 80 00       	push   $0x808000
+  8031b3:	ff 75 0c             	push   0xc(%ebp)
+  8031b6:	e8 07 e2 ff ff       	call   8013c2 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8031bb:	a1 10 80 80 00       	mov    0x808010,%eax
+  8031c0:	89 06                	mov    %eax,(%esi)
+  8031c2:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8031c5:	eb d5                	jmp    80319c <nsipc_accept+0x27>
+
+008031c7 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8031c7:	55                   	push   %ebp
+  8031c8:	89 e5                	mov    %esp,%ebp
+  8031ca:	53                   	push   %ebx
+  8031cb:	83 ec 08             	sub    $0x8,%esp
+  8031ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8031d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031d4:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8031d9:	53                   	push   %ebx
+  8031da:	ff 75 0c             	push   0xc(%ebp)
+  8031dd:	68 04 80 80 00       	push   $0x808004
+  8031e2:	e8 db e1 ff ff       	call   8013c2 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8031e7:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8031ed:	b8 02 00 00 00       	mov    $0x2,%eax
+  8031f2:	e8 32 ff ff ff       	call   803129 <nsipc>
+}
+  8031f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031fa:	c9                   	leave
+  8031fb:	c3                   	ret
+
+008031fc <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8031fc:	55                   	push   %ebp
+  8031fd:	89 e5                	mov    %esp,%ebp
+  8031ff:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803202:	8b 45 08             	mov    0x8(%ebp),%eax
+  803205:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  80320a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80320d:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  803212:	b8 03 00 00 00       	mov    $0x3,%eax
+  803217:	e8 0d ff ff ff       	call   803129 <nsipc>
+}
+  80321c:	c9                   	leave
+  80321d:	c3                   	ret
+
+0080321e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80321e:	55                   	push   %ebp
+  80321f:	89 e5                	mov    %esp,%ebp
+  803221:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803224:	8b 45 08             	mov    0x8(%ebp),%eax
+  803227:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80322c:	b8 04 00 00 00       	mov    $0x4,%eax
+  803231:	e8 f3 fe ff ff       	call   803129 <nsipc>
+}
+  803236:	c9                   	leave
+  803237:	c3                   	ret
+
+00803238 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803238:	55                   	push   %ebp
+  803239:	89 e5                	mov    %esp,%ebp
+  80323b:	53                   	push   %ebx
+  80323c:	83 ec 08             	sub    $0x8,%esp
+  80323f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803242:	8b 45 08             	mov    0x8(%ebp),%eax
+  803245:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80324a:	53                   	push   %ebx
+  80324b:	ff 75 0c             	push   0xc(%ebp)
+  80324e:	68 04 80 80 00       	push   $0x808004
+  803253:	e8 6a e1 ff ff       	call   8013c2 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803258:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  80325e:	b8 05 00 00 00       	mov    $0x5,%eax
+  803263:	e8 c1 fe ff ff       	call   803129 <nsipc>
+}
+  803268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80326b:	c9                   	leave
+  80326c:	c3                   	ret
+
+0080326d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80326d:	55                   	push   %ebp
+  80326e:	89 e5                	mov    %esp,%ebp
+  803270:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803273:	8b 45 08             	mov    0x8(%ebp),%eax
+  803276:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  80327b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80327e:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  803283:	b8 06 00 00 00       	mov    $0x6,%eax
+  803288:	e8 9c fe ff ff       	call   803129 <nsipc>
+}
+  80328d:	c9                   	leave
+  80328e:	c3                   	ret
+
+0080328f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80328f:	55                   	push   %ebp
+  803290:	89 e5                	mov    %esp,%ebp
+  803292:	56                   	push   %esi
+  803293:	53                   	push   %ebx
+  803294:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803297:	8b 45 08             	mov    0x8(%ebp),%eax
+  80329a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  80329f:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8032a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8032a8:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8032ad:	b8 07 00 00 00       	mov    $0x7,%eax
+  8032b2:	e8 72 fe ff ff       	call   803129 <nsipc>
+  8032b7:	89 c3                	mov    %eax,%ebx
+  8032b9:	85 c0                	test   %eax,%eax
+  8032bb:	78 22                	js     8032df <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8032bd:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8032c2:	39 c6                	cmp    %eax,%esi
+  8032c4:	0f 4e c6             	cmovle %esi,%eax
+  8032c7:	39 c3                	cmp    %eax,%ebx
+  8032c9:	7f 1d                	jg     8032e8 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8032cb:	83 ec 04             	sub    $0x4,%esp
+  8032ce:	53                   	push   %ebx
+  8032cf:	68 00 80 80 00       	push   $0x808000
+  8032d4:	ff 75 0c             	push   0xc(%ebp)
+  8032d7:	e8 e6 e0 ff ff       	call   8013c2 <memmove>
+  8032dc:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8032df:	89 d8                	mov    %ebx,%eax
+  8032e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032e4:	5b                   	pop    %ebx
+  8032e5:	5e                   	pop    %esi
+  8032e6:	5d                   	pop    %ebp
+  8032e7:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8032e8:	68 03 45 80 00       	push   $0x804503
+  8032ed:	68 66 3e 80 00       	push   $0x803e66
+  8032f2:	6a 62                	push   $0x62
+  8032f4:	68 18 45 80 00       	push   $0x804518
+  8032f9:	e8 85 d7 ff ff       	call   800a83 <_panic>
+
+008032fe <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8032fe:	55                   	push   %ebp
+  8032ff:	89 e5                	mov    %esp,%ebp
+  803301:	53                   	push   %ebx
+  803302:	83 ec 04             	sub    $0x4,%esp
+  803305:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803308:	8b 45 08             	mov    0x8(%ebp),%eax
+  80330b:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  803310:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803316:	7f 2e                	jg     803346 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803318:	83 ec 04             	sub    $0x4,%esp
+  80331b:	53                   	push   %ebx
+  80331c:	ff 75 0c             	push   0xc(%ebp)
+  80331f:	68 0c 80 80 00       	push   $0x80800c
+  803324:	e8 99 e0 ff ff       	call   8013c2 <memmove>
+	nsipcbuf.send.req_size = size;
+  803329:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80332f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803332:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  803337:	b8 08 00 00 00       	mov    $0x8,%eax
+  80333c:	e8 e8 fd ff ff       	call   803129 <nsipc>
+}
+  803341:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803344:	c9                   	leave
+  803345:	c3                   	ret
+	assert(size < 1600);
+  803346:	68 24 45 80 00       	push   $0x804524
+  80334b:	68 66 3e 80 00       	push   $0x803e66
+  803350:	6a 6d                	push   $0x6d
+  803352:	68 18 45 80 00       	push   $0x804518
+  803357:	e8 27 d7 ff ff       	call   800a83 <_panic>
+
+0080335c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80335c:	55                   	push   %ebp
+  80335d:	89 e5                	mov    %esp,%ebp
+  80335f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803362:	8b 45 08             	mov    0x8(%ebp),%eax
+  803365:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80336a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80336d:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  803372:	8b 45 10             	mov    0x10(%ebp),%eax
+  803375:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80337a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80337f:	e8 a5 fd ff ff       	call   803129 <nsipc>
+}
+  803384:	c9                   	leave
+  803385:	c3                   	ret
+
+00803386 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803386:	55                   	push   %ebp
+  803387:	89 e5                	mov    %esp,%ebp
+  803389:	56                   	push   %esi
+  80338a:	53                   	push   %ebx
+  80338b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80338e:	83 ec 0c             	sub    $0xc,%esp
+  803391:	ff 75 08             	push   0x8(%ebp)
+  803394:	e8 f6 eb ff ff       	call   801f8f <fd2data>
+  803399:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80339b:	83 c4 08             	add    $0x8,%esp
+  80339e:	68 30 45 80 00       	push   $0x804530
+  8033a3:	53                   	push   %ebx
+  8033a4:	e8 93 de ff ff       	call   80123c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8033a9:	8b 46 04             	mov    0x4(%esi),%eax
+  8033ac:	2b 06                	sub    (%esi),%eax
+  8033ae:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8033b4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8033bb:	00 00 00 
+	stat->st_dev = &devpipe;
+  8033be:	c7 83 88 00 00 00 58 	movl   $0x805058,0x88(%ebx)
+  8033c5:	50 80 00 
+	return 0;
+}
+  8033c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033d0:	5b                   	pop    %ebx
+  8033d1:	5e                   	pop    %esi
+  8033d2:	5d                   	pop    %ebp
+  8033d3:	c3                   	ret
+
+008033d4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8033d4:	55                   	push   %ebp
+  8033d5:	89 e5                	mov    %esp,%ebp
+  8033d7:	53                   	push   %ebx
+  8033d8:	83 ec 0c             	sub    $0xc,%esp
+  8033db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8033de:	53                   	push   %ebx
+  8033df:	6a 00                	push   $0x0
+  8033e1:	e8 8b e3 ff ff       	call   801771 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8033e6:	89 1c 24             	mov    %ebx,(%esp)
+  8033e9:	e8 a1 eb ff ff       	call   801f8f <fd2data>
+  8033ee:	83 c4 08             	add    $0x8,%esp
+  8033f1:	50                   	push   %eax
+  8033f2:	6a 00                	push   $0x0
+  8033f4:	e8 78 e3 ff ff       	call   801771 <sys_page_unmap>
+}
+  8033f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033fc:	c9                   	leave
+  8033fd:	c3                   	ret
+
+008033fe <_pipeisclosed>:
+{
+  8033fe:	55                   	push   %ebp
+  8033ff:	89 e5                	mov    %esp,%ebp
+  803401:	57                   	push   %edi
+  803402:	56                   	push   %esi
+  803403:	53                   	push   %ebx
+  803404:	83 ec 1c             	sub    $0x1c,%esp
+  803407:	89 c7                	mov    %eax,%edi
+  803409:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80340b:	a1 28 64 80 00       	mov    0x806428,%eax
+  803410:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803413:	83 ec 0c             	sub    $0xc,%esp
+  803416:	57                   	push   %edi
+  803417:	e8 70 04 00 00       	call   80388c <pageref>
+  80341c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80341f:	89 34 24             	mov    %esi,(%esp)
+  803422:	e8 65 04 00 00       	call   80388c <pageref>
+		nn = thisenv->env_runs;
+  803427:	8b 15 28 64 80 00    	mov    0x806428,%edx
+  80342d:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  803430:	83 c4 10             	add    $0x10,%esp
+  803433:	39 cb                	cmp    %ecx,%ebx
+  803435:	74 1b                	je     803452 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803437:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80343a:	75 cf                	jne    80340b <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80343c:	8b 42 5c             	mov    0x5c(%edx),%eax
+  80343f:	6a 01                	push   $0x1
+  803441:	50                   	push   %eax
+  803442:	53                   	push   %ebx
+  803443:	68 37 45 80 00       	push   $0x804537
+  803448:	e8 11 d7 ff ff       	call   800b5e <cprintf>
+  80344d:	83 c4 10             	add    $0x10,%esp
+  803450:	eb b9                	jmp    80340b <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  803452:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803455:	0f 94 c0             	sete   %al
+  803458:	0f b6 c0             	movzbl %al,%eax
+}
+  80345b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80345e:	5b                   	pop    %ebx
+  80345f:	5e                   	pop    %esi
+  803460:	5f                   	pop    %edi
+  803461:	5d                   	pop    %ebp
+  803462:	c3                   	ret
+
+00803463 <devpipe_write>:
+{
+  803463:	55                   	push   %ebp
+  803464:	89 e5                	mov    %esp,%ebp
+  803466:	57                   	push   %edi
+  803467:	56                   	push   %esi
+  803468:	53                   	push   %ebx
+  803469:	83 ec 28             	sub    $0x28,%esp
+  80346c:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80346f:	56                   	push   %esi
+  803470:	e8 1a eb ff ff       	call   801f8f <fd2data>
+  803475:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803477:	83 c4 10             	add    $0x10,%esp
+  80347a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80347f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803482:	75 09                	jne    80348d <devpipe_write+0x2a>
+	return i;
+  803484:	89 f8                	mov    %edi,%eax
+  803486:	eb 23                	jmp    8034ab <devpipe_write+0x48>
+			sys_yield();
+  803488:	e8 9c e1 ff ff       	call   801629 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80348d:	8b 43 04             	mov    0x4(%ebx),%eax
+  803490:	8b 0b                	mov    (%ebx),%ecx
+  803492:	8d 51 20             	lea    0x20(%ecx),%edx
+  803495:	39 d0                	cmp    %edx,%eax
+  803497:	72 1a                	jb     8034b3 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803499:	89 da                	mov    %ebx,%edx
+  80349b:	89 f0                	mov    %esi,%eax
+  80349d:	e8 5c ff ff ff       	call   8033fe <_pipeisclosed>
+  8034a2:	85 c0                	test   %eax,%eax
+  8034a4:	74 e2                	je     803488 <devpipe_write+0x25>
+				return 0;
+  8034a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034ae:	5b                   	pop    %ebx
+  8034af:	5e                   	pop    %esi
+  8034b0:	5f                   	pop    %edi
+  8034b1:	5d                   	pop    %ebp
+  8034b2:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8034b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8034b6:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8034ba:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8034bd:	89 c2                	mov    %eax,%edx
+  8034bf:	c1 fa 1f             	sar    $0x1f,%edx
+  8034c2:	89 d1                	mov    %edx,%ecx
+  8034c4:	c1 e9 1b             	shr    $0x1b,%ecx
+  8034c7:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8034ca:	83 e2 1f             	and    $0x1f,%edx
+  8034cd:	29 ca                	sub    %ecx,%edx
+  8034cf:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8034d3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8034d7:	83 c0 01             	add    $0x1,%eax
+  8034da:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8034dd:	83 c7 01             	add    $0x1,%edi
+  8034e0:	eb 9d                	jmp    80347f <devpipe_write+0x1c>
+
+008034e2 <devpipe_read>:
+{
+  8034e2:	55                   	push   %ebp
+  8034e3:	89 e5                	mov    %esp,%ebp
+  8034e5:	57                   	push   %edi
+  8034e6:	56                   	push   %esi
+  8034e7:	53                   	push   %ebx
+  8034e8:	83 ec 18             	sub    $0x18,%esp
+  8034eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8034ee:	57                   	push   %edi
+  8034ef:	e8 9b ea ff ff       	call   801f8f <fd2data>
+  8034f4:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8034f6:	83 c4 10             	add    $0x10,%esp
+  8034f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8034fe:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803501:	75 13                	jne    803516 <devpipe_read+0x34>
+	return i;
+  803503:	89 f0                	mov    %esi,%eax
+  803505:	eb 02                	jmp    803509 <devpipe_read+0x27>
+				return i;
+  803507:	89 f0                	mov    %esi,%eax
+}
+  803509:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80350c:	5b                   	pop    %ebx
+  80350d:	5e                   	pop    %esi
+  80350e:	5f                   	pop    %edi
+  80350f:	5d                   	pop    %ebp
+  803510:	c3                   	ret
+			sys_yield();
+  803511:	e8 13 e1 ff ff       	call   801629 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803516:	8b 03                	mov    (%ebx),%eax
+  803518:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80351b:	75 18                	jne    803535 <devpipe_read+0x53>
+			if (i > 0)
+  80351d:	85 f6                	test   %esi,%esi
+  80351f:	75 e6                	jne    803507 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803521:	89 da                	mov    %ebx,%edx
+  803523:	89 f8                	mov    %edi,%eax
+  803525:	e8 d4 fe ff ff       	call   8033fe <_pipeisclosed>
+  80352a:	85 c0                	test   %eax,%eax
+  80352c:	74 e3                	je     803511 <devpipe_read+0x2f>
+				return 0;
+  80352e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803533:	eb d4                	jmp    803509 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803535:	99                   	cltd
+  803536:	c1 ea 1b             	shr    $0x1b,%edx
+  803539:	01 d0                	add    %edx,%eax
+  80353b:	83 e0 1f             	and    $0x1f,%eax
+  80353e:	29 d0                	sub    %edx,%eax
+  803540:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803545:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803548:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80354b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80354e:	83 c6 01             	add    $0x1,%esi
+  803551:	eb ab                	jmp    8034fe <devpipe_read+0x1c>
+
+00803553 <pipe>:
+{
+  803553:	55                   	push   %ebp
+  803554:	89 e5                	mov    %esp,%ebp
+  803556:	56                   	push   %esi
+  803557:	53                   	push   %ebx
+  803558:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80355b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80355e:	50                   	push   %eax
+  80355f:	e8 42 ea ff ff       	call   801fa6 <fd_alloc>
+  803564:	89 c3                	mov    %eax,%ebx
+  803566:	83 c4 10             	add    $0x10,%esp
+  803569:	85 c0                	test   %eax,%eax
+  80356b:	0f 88 23 01 00 00    	js     803694 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803571:	83 ec 04             	sub    $0x4,%esp
+  803574:	68 07 04 00 00       	push   $0x407
+  803579:	ff 75 f4             	push   -0xc(%ebp)
+  80357c:	6a 00                	push   $0x0
+  80357e:	e8 26 e1 ff ff       	call   8016a9 <sys_page_alloc>
+  803583:	89 c3                	mov    %eax,%ebx
+  803585:	83 c4 10             	add    $0x10,%esp
+  803588:	85 c0                	test   %eax,%eax
+  80358a:	0f 88 04 01 00 00    	js     803694 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803590:	83 ec 0c             	sub    $0xc,%esp
+  803593:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803596:	50                   	push   %eax
+  803597:	e8 0a ea ff ff       	call   801fa6 <fd_alloc>
+  80359c:	89 c3                	mov    %eax,%ebx
+  80359e:	83 c4 10             	add    $0x10,%esp
+  8035a1:	85 c0                	test   %eax,%eax
+  8035a3:	0f 88 db 00 00 00    	js     803684 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8035a9:	83 ec 04             	sub    $0x4,%esp
+  8035ac:	68 07 04 00 00       	push   $0x407
+  8035b1:	ff 75 f0             	push   -0x10(%ebp)
+  8035b4:	6a 00                	push   $0x0
+  8035b6:	e8 ee e0 ff ff       	call   8016a9 <sys_page_alloc>
+  8035bb:	89 c3                	mov    %eax,%ebx
+  8035bd:	83 c4 10             	add    $0x10,%esp
+  8035c0:	85 c0                	test   %eax,%eax
+  8035c2:	0f 88 bc 00 00 00    	js     803684 <pipe+0x131>
+	va = fd2data(fd0);
+  8035c8:	83 ec 0c             	sub    $0xc,%esp
+  8035cb:	ff 75 f4             	push   -0xc(%ebp)
+  8035ce:	e8 bc e9 ff ff       	call   801f8f <fd2data>
+  8035d3:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8035d5:	83 c4 0c             	add    $0xc,%esp
+  8035d8:	68 07 04 00 00       	push   $0x407
+  8035dd:	50                   	push   %eax
+  8035de:	6a 00                	push   $0x0
+  8035e0:	e8 c4 e0 ff ff       	call   8016a9 <sys_page_alloc>
+  8035e5:	89 c3                	mov    %eax,%ebx
+  8035e7:	83 c4 10             	add    $0x10,%esp
+  8035ea:	85 c0                	test   %eax,%eax
+  8035ec:	0f 88 82 00 00 00    	js     803674 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8035f2:	83 ec 0c             	sub    $0xc,%esp
+  8035f5:	ff 75 f0             	push   -0x10(%ebp)
+  8035f8:	e8 92 e9 ff ff       	call   801f8f <fd2data>
+  8035fd:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803604:	50                   	push   %eax
+  803605:	6a 00                	push   $0x0
+  803607:	56                   	push   %esi
+  803608:	6a 00                	push   $0x0
+  80360a:	e8 20 e1 ff ff       	call   80172f <sys_page_map>
+  80360f:	89 c3                	mov    %eax,%ebx
+  803611:	83 c4 20             	add    $0x20,%esp
+  803614:	85 c0                	test   %eax,%eax
+  803616:	78 4e                	js     803666 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803618:	a1 58 50 80 00       	mov    0x805058,%eax
+  80361d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803620:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803622:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803625:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80362c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80362f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803631:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803634:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80363b:	83 ec 0c             	sub    $0xc,%esp
+  80363e:	ff 75 f4             	push   -0xc(%ebp)
+  803641:	e8 39 e9 ff ff       	call   801f7f <fd2num>
+  803646:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803649:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80364b:	83 c4 04             	add    $0x4,%esp
+  80364e:	ff 75 f0             	push   -0x10(%ebp)
+  803651:	e8 29 e9 ff ff       	call   801f7f <fd2num>
+  803656:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803659:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80365c:	83 c4 10             	add    $0x10,%esp
+  80365f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803664:	eb 2e                	jmp    803694 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803666:	83 ec 08             	sub    $0x8,%esp
+  803669:	56                   	push   %esi
+  80366a:	6a 00                	push   $0x0
+  80366c:	e8 00 e1 ff ff       	call   801771 <sys_page_unmap>
+  803671:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803674:	83 ec 08             	sub    $0x8,%esp
+  803677:	ff 75 f0             	push   -0x10(%ebp)
+  80367a:	6a 00                	push   $0x0
+  80367c:	e8 f0 e0 ff ff       	call   801771 <sys_page_unmap>
+  803681:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803684:	83 ec 08             	sub    $0x8,%esp
+  803687:	ff 75 f4             	push   -0xc(%ebp)
+  80368a:	6a 00                	push   $0x0
+  80368c:	e8 e0 e0 ff ff       	call   801771 <sys_page_unmap>
+  803691:	83 c4 10             	add    $0x10,%esp
+}
+  803694:	89 d8                	mov    %ebx,%eax
+  803696:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803699:	5b                   	pop    %ebx
+  80369a:	5e                   	pop    %esi
+  80369b:	5d                   	pop    %ebp
+  80369c:	c3                   	ret
+
+0080369d <pipeisclosed>:
+{
+  80369d:	55                   	push   %ebp
+  80369e:	89 e5                	mov    %esp,%ebp
+  8036a0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8036a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036a6:	50                   	push   %eax
+  8036a7:	ff 75 08             	push   0x8(%ebp)
+  8036aa:	e8 4d e9 ff ff       	call   801ffc <fd_lookup>
+  8036af:	83 c4 10             	add    $0x10,%esp
+  8036b2:	85 c0                	test   %eax,%eax
+  8036b4:	78 18                	js     8036ce <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8036b6:	83 ec 0c             	sub    $0xc,%esp
+  8036b9:	ff 75 f4             	push   -0xc(%ebp)
+  8036bc:	e8 ce e8 ff ff       	call   801f8f <fd2data>
+  8036c1:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8036c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036c6:	e8 33 fd ff ff       	call   8033fe <_pipeisclosed>
+  8036cb:	83 c4 10             	add    $0x10,%esp
+}
+  8036ce:	c9                   	leave
+  8036cf:	c3                   	ret
+
+008036d0 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8036d0:	55                   	push   %ebp
+  8036d1:	89 e5                	mov    %esp,%ebp
+  8036d3:	56                   	push   %esi
+  8036d4:	53                   	push   %ebx
+  8036d5:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8036d8:	85 f6                	test   %esi,%esi
+  8036da:	74 13                	je     8036ef <wait+0x1f>
+	e = &envs[ENVX(envid)];
+  8036dc:	89 f3                	mov    %esi,%ebx
+  8036de:	81 e3 ff 1f 00 00    	and    $0x1fff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8036e4:	c1 e3 09             	shl    $0x9,%ebx
+  8036e7:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8036ed:	eb 1b                	jmp    80370a <wait+0x3a>
+	assert(envid != 0);
+  8036ef:	68 4f 45 80 00       	push   $0x80454f
+  8036f4:	68 66 3e 80 00       	push   $0x803e66
+  8036f9:	6a 09                	push   $0x9
+  8036fb:	68 5a 45 80 00       	push   $0x80455a
+  803700:	e8 7e d3 ff ff       	call   800a83 <_panic>
+		sys_yield();
+  803705:	e8 1f df ff ff       	call   801629 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80370a:	8b 43 4c             	mov    0x4c(%ebx),%eax
+  80370d:	39 f0                	cmp    %esi,%eax
+  80370f:	75 07                	jne    803718 <wait+0x48>
+  803711:	8b 43 58             	mov    0x58(%ebx),%eax
+  803714:	85 c0                	test   %eax,%eax
+  803716:	75 ed                	jne    803705 <wait+0x35>
+}
+  803718:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80371b:	5b                   	pop    %ebx
+  80371c:	5e                   	pop    %esi
+  80371d:	5d                   	pop    %ebp
+  80371e:	c3                   	ret
+
+0080371f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80371f:	55                   	push   %ebp
+  803720:	89 e5                	mov    %esp,%ebp
+  803722:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  803725:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80372c:	74 0a                	je     803738 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80372e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803731:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  803736:	c9                   	leave
+  803737:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  803738:	83 ec 04             	sub    $0x4,%esp
+  80373b:	6a 07                	push   $0x7
+  80373d:	68 00 f0 bf ee       	push   $0xeebff000
+  803742:	6a 00                	push   $0x0
+  803744:	e8 60 df ff ff       	call   8016a9 <sys_page_alloc>
+  803749:	83 c4 10             	add    $0x10,%esp
+  80374c:	85 c0                	test   %eax,%eax
+  80374e:	78 28                	js     803778 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  803750:	83 ec 08             	sub    $0x8,%esp
+  803753:	68 8a 37 80 00       	push   $0x80378a
+  803758:	6a 00                	push   $0x0
+  80375a:	e8 45 e2 ff ff       	call   8019a4 <sys_env_set_pgfault_upcall>
+  80375f:	83 c4 10             	add    $0x10,%esp
+  803762:	85 c0                	test   %eax,%eax
+  803764:	79 c8                	jns    80372e <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  803766:	50                   	push   %eax
+  803767:	68 73 45 80 00       	push   $0x804573
+  80376c:	6a 24                	push   $0x24
+  80376e:	68 65 45 80 00       	push   $0x804565
+  803773:	e8 0b d3 ff ff       	call   800a83 <_panic>
+			panic("sys_page_alloc: %e", r);
+  803778:	50                   	push   %eax
+  803779:	68 b6 42 80 00       	push   $0x8042b6
+  80377e:	6a 21                	push   $0x21
+  803780:	68 65 45 80 00       	push   $0x804565
+  803785:	e8 f9 d2 ff ff       	call   800a83 <_panic>
+
+0080378a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80378a:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80378b:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  803790:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803792:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  803795:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  803798:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  80379c:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  80379f:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  8037a3:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  8037a7:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  8037a9:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8037aa:	83 c4 04             	add    $0x4,%esp
+	popf
+  8037ad:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8037ae:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8037af:	c3                   	ret
+
+008037b0 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8037b0:	55                   	push   %ebp
+  8037b1:	89 e5                	mov    %esp,%ebp
+  8037b3:	57                   	push   %edi
+  8037b4:	56                   	push   %esi
+  8037b5:	53                   	push   %ebx
+  8037b6:	83 ec 18             	sub    $0x18,%esp
+  8037b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8037bf:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8037c2:	85 db                	test   %ebx,%ebx
+  8037c4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8037c9:	0f 45 c3             	cmovne %ebx,%eax
+  8037cc:	50                   	push   %eax
+  8037cd:	e8 5a e2 ff ff       	call   801a2c <sys_ipc_recv>
+
+	if (from_env_store)
+  8037d2:	83 c4 10             	add    $0x10,%esp
+  8037d5:	85 ff                	test   %edi,%edi
+  8037d7:	74 17                	je     8037f0 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8037d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037de:	85 c0                	test   %eax,%eax
+  8037e0:	75 0c                	jne    8037ee <ipc_recv+0x3e>
+  8037e2:	8b 15 28 64 80 00    	mov    0x806428,%edx
+  8037e8:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8037ee:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8037f0:	85 f6                	test   %esi,%esi
+  8037f2:	74 2e                	je     803822 <ipc_recv+0x72>
+		if (!r && pg)
+  8037f4:	85 c0                	test   %eax,%eax
+  8037f6:	75 24                	jne    80381c <ipc_recv+0x6c>
+  8037f8:	85 db                	test   %ebx,%ebx
+  8037fa:	74 20                	je     80381c <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8037fc:	a1 28 64 80 00       	mov    0x806428,%eax
+  803801:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  803807:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  803809:	a1 28 64 80 00       	mov    0x806428,%eax
+  80380e:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  803814:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803817:	5b                   	pop    %ebx
+  803818:	5e                   	pop    %esi
+  803819:	5f                   	pop    %edi
+  80381a:	5d                   	pop    %ebp
+  80381b:	c3                   	ret
+			*perm_store = 0;
+  80381c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  803822:	85 c0                	test   %eax,%eax
+  803824:	75 ee                	jne    803814 <ipc_recv+0x64>
+  803826:	eb e1                	jmp    803809 <ipc_recv+0x59>
+
+00803828 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803828:	55                   	push   %ebp
+  803829:	89 e5                	mov    %esp,%ebp
+  80382b:	57                   	push   %edi
+  80382c:	56                   	push   %esi
+  80382d:	53                   	push   %ebx
+  80382e:	83 ec 0c             	sub    $0xc,%esp
+  803831:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803834:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803837:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80383a:	85 db                	test   %ebx,%ebx
+  80383c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803841:	0f 44 d8             	cmove  %eax,%ebx
+  803844:	ff 75 14             	push   0x14(%ebp)
+  803847:	53                   	push   %ebx
+  803848:	56                   	push   %esi
+  803849:	57                   	push   %edi
+  80384a:	e8 ba e1 ff ff       	call   801a09 <sys_ipc_try_send_yield>
+  80384f:	83 c4 10             	add    $0x10,%esp
+  803852:	85 c0                	test   %eax,%eax
+  803854:	79 1e                	jns    803874 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  803856:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803859:	75 07                	jne    803862 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80385b:	e8 c9 dd ff ff       	call   801629 <sys_yield>
+  803860:	eb e2                	jmp    803844 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  803862:	50                   	push   %eax
+  803863:	68 91 45 80 00       	push   $0x804591
+  803868:	6a 3d                	push   $0x3d
+  80386a:	68 a6 45 80 00       	push   $0x8045a6
+  80386f:	e8 0f d2 ff ff       	call   800a83 <_panic>
+	}
+}
+  803874:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803877:	5b                   	pop    %ebx
+  803878:	5e                   	pop    %esi
+  803879:	5f                   	pop    %edi
+  80387a:	5d                   	pop    %ebp
+  80387b:	c3                   	ret
+
+0080387c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80387c:	55                   	push   %ebp
+  80387d:	89 e5                	mov    %esp,%ebp
+  80387f:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  803882:	ff 75 08             	push   0x8(%ebp)
+  803885:	e8 1f dd ff ff       	call   8015a9 <sys_env_find>
+}
+  80388a:	c9                   	leave
+  80388b:	c3                   	ret
+
+0080388c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80388c:	55                   	push   %ebp
+  80388d:	89 e5                	mov    %esp,%ebp
+  80388f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803892:	89 c2                	mov    %eax,%edx
+  803894:	c1 ea 16             	shr    $0x16,%edx
+  803897:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80389e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8038a3:	f6 c1 01             	test   $0x1,%cl
+  8038a6:	74 22                	je     8038ca <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8038a8:	c1 e8 0c             	shr    $0xc,%eax
+  8038ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8038b2:	a8 01                	test   $0x1,%al
+  8038b4:	74 14                	je     8038ca <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8038b6:	c1 e8 0c             	shr    $0xc,%eax
+  8038b9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8038bc:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8038c3:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8038c7:	0f b7 d2             	movzwl %dx,%edx
+}
+  8038ca:	89 d0                	mov    %edx,%eax
+  8038cc:	5d                   	pop    %ebp
+  8038cd:	c3                   	ret
+  8038ce:	66 90                	xchg   %ax,%ax
+
+008038d0 <__udivmoddi4>:
+  8038d0:	55                   	push   %ebp
+  8038d1:	57                   	push   %edi
+  8038d2:	56                   	push   %esi
+  8038d3:	53                   	push   %ebx
+  8038d4:	83 ec 14             	sub    $0x14,%esp
+  8038d7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8038db:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8038df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038e7:	89 f1                	mov    %esi,%ecx
+  8038e9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8038ed:	09 d9                	or     %ebx,%ecx
+  8038ef:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8038f3:	0f 84 92 00 00 00    	je     80398b <__udivmoddi4+0xbb>
+  8038f9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803900:	00 
+  803901:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  803906:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80390d:	00 
+  80390e:	89 1c 24             	mov    %ebx,(%esp)
+  803911:	89 74 24 04          	mov    %esi,0x4(%esp)
+  803915:	8d 76 00             	lea    0x0(%esi),%esi
+  803918:	89 e9                	mov    %ebp,%ecx
+  80391a:	89 c3                	mov    %eax,%ebx
+  80391c:	89 d6                	mov    %edx,%esi
+  80391e:	31 ff                	xor    %edi,%edi
+  803920:	d3 ee                	shr    %cl,%esi
+  803922:	0f ad d3             	shrd   %cl,%edx,%ebx
+  803925:	f6 c1 20             	test   $0x20,%cl
+  803928:	0f 45 de             	cmovne %esi,%ebx
+  80392b:	0f 45 f7             	cmovne %edi,%esi
+  80392e:	8b 3c 24             	mov    (%esp),%edi
+  803931:	39 fb                	cmp    %edi,%ebx
+  803933:	89 f7                	mov    %esi,%edi
+  803935:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803939:	8b 1c 24             	mov    (%esp),%ebx
+  80393c:	19 f7                	sbb    %esi,%edi
+  80393e:	72 39                	jb     803979 <__udivmoddi4+0xa9>
+  803940:	89 e9                	mov    %ebp,%ecx
+  803942:	89 f7                	mov    %esi,%edi
+  803944:	89 de                	mov    %ebx,%esi
+  803946:	0f a5 df             	shld   %cl,%ebx,%edi
+  803949:	d3 e6                	shl    %cl,%esi
+  80394b:	31 db                	xor    %ebx,%ebx
+  80394d:	f6 c1 20             	test   $0x20,%cl
+  803950:	0f 45 fe             	cmovne %esi,%edi
+  803953:	0f 45 f3             	cmovne %ebx,%esi
+  803956:	29 f0                	sub    %esi,%eax
+  803958:	be 01 00 00 00       	mov    $0x1,%esi
+  80395d:	19 fa                	sbb    %edi,%edx
+  80395f:	31 ff                	xor    %edi,%edi
+  803961:	31 db                	xor    %ebx,%ebx
+  803963:	0f a5 f7             	shld   %cl,%esi,%edi
+  803966:	d3 e6                	shl    %cl,%esi
+  803968:	f6 c1 20             	test   $0x20,%cl
+  80396b:	0f 45 fe             	cmovne %esi,%edi
+  80396e:	0f 45 f3             	cmovne %ebx,%esi
+  803971:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803975:	09 74 24 08          	or     %esi,0x8(%esp)
+  803979:	83 ed 01             	sub    $0x1,%ebp
+  80397c:	73 9a                	jae    803918 <__udivmoddi4+0x48>
+  80397e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  803982:	85 ff                	test   %edi,%edi
+  803984:	74 05                	je     80398b <__udivmoddi4+0xbb>
+  803986:	89 07                	mov    %eax,(%edi)
+  803988:	89 57 04             	mov    %edx,0x4(%edi)
+  80398b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80398f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803993:	83 c4 14             	add    $0x14,%esp
+  803996:	5b                   	pop    %ebx
+  803997:	5e                   	pop    %esi
+  803998:	5f                   	pop    %edi
+  803999:	5d                   	pop    %ebp
+  80399a:	c3                   	ret
+  80399b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80399f:	90                   	nop
+
+008039a0 <__udivdi3>:
+  8039a0:	55                   	push   %ebp
+  8039a1:	57                   	push   %edi
+  8039a2:	56                   	push   %esi
+  8039a3:	53                   	push   %ebx
+  8039a4:	83 ec 14             	sub    $0x14,%esp
+  8039a7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8039ab:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8039af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8039b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8039b7:	89 fb                	mov    %edi,%ebx
+  8039b9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8039bd:	09 f3                	or     %esi,%ebx
+  8039bf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8039c3:	0f 84 85 00 00 00    	je     803a4e <__udivdi3+0xae>
+  8039c9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8039d0:	00 
+  8039d1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8039d6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8039dd:	00 
+  8039de:	89 34 24             	mov    %esi,(%esp)
+  8039e1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8039e5:	8d 76 00             	lea    0x0(%esi),%esi
+  8039e8:	89 e9                	mov    %ebp,%ecx
+  8039ea:	89 c3                	mov    %eax,%ebx
+  8039ec:	89 d6                	mov    %edx,%esi
+  8039ee:	31 ff                	xor    %edi,%edi
+  8039f0:	d3 ee                	shr    %cl,%esi
+  8039f2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8039f5:	f6 c1 20             	test   $0x20,%cl
+  8039f8:	0f 45 de             	cmovne %esi,%ebx
+  8039fb:	0f 45 f7             	cmovne %edi,%esi
+  8039fe:	8b 3c 24             	mov    (%esp),%edi
+  803a01:	39 fb                	cmp    %edi,%ebx
+  803a03:	89 f7                	mov    %esi,%edi
+  803a05:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803a09:	8b 1c 24             	mov    (%esp),%ebx
+  803a0c:	19 f7                	sbb    %esi,%edi
+  803a0e:	72 39                	jb     803a49 <__udivdi3+0xa9>
+  803a10:	89 e9                	mov    %ebp,%ecx
+  803a12:	89 f7                	mov    %esi,%edi
+  803a14:	89 de                	mov    %ebx,%esi
+  803a16:	0f a5 df             	shld   %cl,%ebx,%edi
+  803a19:	d3 e6                	shl    %cl,%esi
+  803a1b:	31 db                	xor    %ebx,%ebx
+  803a1d:	f6 c1 20             	test   $0x20,%cl
+  803a20:	0f 45 fe             	cmovne %esi,%edi
+  803a23:	0f 45 f3             	cmovne %ebx,%esi
+  803a26:	29 f0                	sub    %esi,%eax
+  803a28:	be 01 00 00 00       	mov    $0x1,%esi
+  803a2d:	19 fa                	sbb    %edi,%edx
+  803a2f:	31 ff                	xor    %edi,%edi
+  803a31:	31 db                	xor    %ebx,%ebx
+  803a33:	0f a5 f7             	shld   %cl,%esi,%edi
+  803a36:	d3 e6                	shl    %cl,%esi
+  803a38:	f6 c1 20             	test   $0x20,%cl
+  803a3b:	0f 45 fe             	cmovne %esi,%edi
+  803a3e:	0f 45 f3             	cmovne %ebx,%esi
+  803a41:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803a45:	09 74 24 08          	or     %esi,0x8(%esp)
+  803a49:	83 ed 01             	sub    $0x1,%ebp
+  803a4c:	73 9a                	jae    8039e8 <__udivdi3+0x48>
+  803a4e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a52:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a56:	83 c4 14             	add    $0x14,%esp
+  803a59:	5b                   	pop    %ebx
+  803a5a:	5e                   	pop    %esi
+  803a5b:	5f                   	pop    %edi
+  803a5c:	5d                   	pop    %ebp
+  803a5d:	c3                   	ret
+  803a5e:	66 90                	xchg   %ax,%ax
+
+00803a60 <__umoddi3>:
+  803a60:	57                   	push   %edi
+  803a61:	56                   	push   %esi
+  803a62:	53                   	push   %ebx
+  803a63:	83 ec 08             	sub    $0x8,%esp
+  803a66:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a6a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a6e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a72:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a76:	89 f9                	mov    %edi,%ecx
+  803a78:	89 34 24             	mov    %esi,(%esp)
+  803a7b:	09 f1                	or     %esi,%ecx
+  803a7d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803a81:	74 53                	je     803ad6 <__umoddi3+0x76>
+  803a83:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803a8f:	90                   	nop
+  803a90:	89 c6                	mov    %eax,%esi
+  803a92:	89 d7                	mov    %edx,%edi
+  803a94:	31 db                	xor    %ebx,%ebx
+  803a96:	d3 ef                	shr    %cl,%edi
+  803a98:	0f ad d6             	shrd   %cl,%edx,%esi
+  803a9b:	f6 c1 20             	test   $0x20,%cl
+  803a9e:	0f 45 f7             	cmovne %edi,%esi
+  803aa1:	0f 45 fb             	cmovne %ebx,%edi
+  803aa4:	8b 1c 24             	mov    (%esp),%ebx
+  803aa7:	39 de                	cmp    %ebx,%esi
+  803aa9:	89 fb                	mov    %edi,%ebx
+  803aab:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  803aaf:	8b 34 24             	mov    (%esp),%esi
+  803ab2:	19 fb                	sbb    %edi,%ebx
+  803ab4:	72 14                	jb     803aca <__umoddi3+0x6a>
+  803ab6:	0f a5 f7             	shld   %cl,%esi,%edi
+  803ab9:	31 db                	xor    %ebx,%ebx
+  803abb:	d3 e6                	shl    %cl,%esi
+  803abd:	f6 c1 20             	test   $0x20,%cl
+  803ac0:	0f 45 fe             	cmovne %esi,%edi
+  803ac3:	0f 45 f3             	cmovne %ebx,%esi
+  803ac6:	29 f0                	sub    %esi,%eax
+  803ac8:	19 fa                	sbb    %edi,%edx
+  803aca:	83 e9 01             	sub    $0x1,%ecx
+  803acd:	73 c1                	jae    803a90 <__umoddi3+0x30>
+  803acf:	83 c4 08             	add    $0x8,%esp
+  803ad2:	5b                   	pop    %ebx
+  803ad3:	5e                   	pop    %esi
+  803ad4:	5f                   	pop    %edi
+  803ad5:	c3                   	ret
+  803ad6:	83 c4 08             	add    $0x8,%esp
+  803ad9:	31 c0                	xor    %eax,%eax
+  803adb:	31 d2                	xor    %edx,%edx
+  803add:	5b                   	pop    %ebx
+  803ade:	5e                   	pop    %esi
+  803adf:	5f                   	pop    %edi
+  803ae0:	c3                   	ret
+  803ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803aef:	90                   	nop
+
+00803af0 <__divdi3>:
+  803af0:	55                   	push   %ebp
+  803af1:	57                   	push   %edi
+  803af2:	56                   	push   %esi
+  803af3:	53                   	push   %ebx
+  803af4:	83 ec 1c             	sub    $0x1c,%esp
+  803af7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  803afb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  803aff:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  803b03:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  803b07:	85 ff                	test   %edi,%edi
+  803b09:	0f 88 da 00 00 00    	js     803be9 <__divdi3+0xf9>
+  803b0f:	85 db                	test   %ebx,%ebx
+  803b11:	78 16                	js     803b29 <__divdi3+0x39>
+  803b13:	89 dd                	mov    %ebx,%ebp
+  803b15:	89 c8                	mov    %ecx,%eax
+  803b17:	89 da                	mov    %ebx,%edx
+  803b19:	09 cd                	or     %ecx,%ebp
+  803b1b:	0f 85 fd 00 00 00    	jne    803c1e <__divdi3+0x12e>
+  803b21:	83 c4 1c             	add    $0x1c,%esp
+  803b24:	5b                   	pop    %ebx
+  803b25:	5e                   	pop    %esi
+  803b26:	5f                   	pop    %edi
+  803b27:	5d                   	pop    %ebp
+  803b28:	c3                   	ret
+  803b29:	bd 01 00 00 00       	mov    $0x1,%ebp
+  803b2e:	f7 d9                	neg    %ecx
+  803b30:	89 f0                	mov    %esi,%eax
+  803b32:	89 fa                	mov    %edi,%edx
+  803b34:	83 d3 00             	adc    $0x0,%ebx
+  803b37:	89 0c 24             	mov    %ecx,(%esp)
+  803b3a:	f7 db                	neg    %ebx
+  803b3c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  803b40:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803b47:	00 
+  803b48:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803b4d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803b54:	00 
+  803b55:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  803b59:	89 cd                	mov    %ecx,%ebp
+  803b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  803b5f:	90                   	nop
+  803b60:	89 e9                	mov    %ebp,%ecx
+  803b62:	89 c3                	mov    %eax,%ebx
+  803b64:	89 d6                	mov    %edx,%esi
+  803b66:	31 ff                	xor    %edi,%edi
+  803b68:	d3 ee                	shr    %cl,%esi
+  803b6a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  803b6d:	f6 c1 20             	test   $0x20,%cl
+  803b70:	0f 45 de             	cmovne %esi,%ebx
+  803b73:	0f 45 f7             	cmovne %edi,%esi
+  803b76:	8b 3c 24             	mov    (%esp),%edi
+  803b79:	39 fb                	cmp    %edi,%ebx
+  803b7b:	89 f7                	mov    %esi,%edi
+  803b7d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803b81:	8b 1c 24             	mov    (%esp),%ebx
+  803b84:	19 f7                	sbb    %esi,%edi
+  803b86:	72 39                	jb     803bc1 <__divdi3+0xd1>
+  803b88:	89 e9                	mov    %ebp,%ecx
+  803b8a:	89 f7                	mov    %esi,%edi
+  803b8c:	89 de                	mov    %ebx,%esi
+  803b8e:	0f a5 df             	shld   %cl,%ebx,%edi
+  803b91:	d3 e6                	shl    %cl,%esi
+  803b93:	31 db                	xor    %ebx,%ebx
+  803b95:	f6 c1 20             	test   $0x20,%cl
+  803b98:	0f 45 fe             	cmovne %esi,%edi
+  803b9b:	0f 45 f3             	cmovne %ebx,%esi
+  803b9e:	29 f0                	sub    %esi,%eax
+  803ba0:	be 01 00 00 00       	mov    $0x1,%esi
+  803ba5:	19 fa                	sbb    %edi,%edx
+  803ba7:	31 ff                	xor    %edi,%edi
+  803ba9:	31 db                	xor    %ebx,%ebx
+  803bab:	0f a5 f7             	shld   %cl,%esi,%edi
+  803bae:	d3 e6                	shl    %cl,%esi
+  803bb0:	f6 c1 20             	test   $0x20,%cl
+  803bb3:	0f 45 fe             	cmovne %esi,%edi
+  803bb6:	0f 45 f3             	cmovne %ebx,%esi
+  803bb9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803bbd:	09 74 24 08          	or     %esi,0x8(%esp)
+  803bc1:	83 ed 01             	sub    $0x1,%ebp
+  803bc4:	73 9a                	jae    803b60 <__divdi3+0x70>
+  803bc6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  803bca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803bce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803bd2:	85 ed                	test   %ebp,%ebp
+  803bd4:	0f 84 47 ff ff ff    	je     803b21 <__divdi3+0x31>
+  803bda:	f7 d8                	neg    %eax
+  803bdc:	83 d2 00             	adc    $0x0,%edx
+  803bdf:	83 c4 1c             	add    $0x1c,%esp
+  803be2:	5b                   	pop    %ebx
+  803be3:	f7 da                	neg    %edx
+  803be5:	5e                   	pop    %esi
+  803be6:	5f                   	pop    %edi
+  803be7:	5d                   	pop    %ebp
+  803be8:	c3                   	ret
+  803be9:	f7 de                	neg    %esi
+  803beb:	83 d7 00             	adc    $0x0,%edi
+  803bee:	f7 df                	neg    %edi
+  803bf0:	85 db                	test   %ebx,%ebx
+  803bf2:	78 23                	js     803c17 <__divdi3+0x127>
+  803bf4:	89 dd                	mov    %ebx,%ebp
+  803bf6:	89 c8                	mov    %ecx,%eax
+  803bf8:	89 da                	mov    %ebx,%edx
+  803bfa:	09 cd                	or     %ecx,%ebp
+  803bfc:	0f 84 1f ff ff ff    	je     803b21 <__divdi3+0x31>
+  803c02:	89 0c 24             	mov    %ecx,(%esp)
+  803c05:	89 f0                	mov    %esi,%eax
+  803c07:	89 fa                	mov    %edi,%edx
+  803c09:	bd 01 00 00 00       	mov    $0x1,%ebp
+  803c0e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  803c12:	e9 29 ff ff ff       	jmp    803b40 <__divdi3+0x50>
+  803c17:	31 ed                	xor    %ebp,%ebp
+  803c19:	e9 10 ff ff ff       	jmp    803b2e <__divdi3+0x3e>
+  803c1e:	89 0c 24             	mov    %ecx,(%esp)
+  803c21:	89 f0                	mov    %esi,%eax
+  803c23:	89 fa                	mov    %edi,%edx
+  803c25:	31 ed                	xor    %ebp,%ebp
+  803c27:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  803c2b:	e9 10 ff ff ff       	jmp    803b40 <__divdi3+0x50>
+
+00803c30 <__moddi3>:
+  803c30:	55                   	push   %ebp
+  803c31:	57                   	push   %edi
+  803c32:	56                   	push   %esi
+  803c33:	53                   	push   %ebx
+  803c34:	83 ec 14             	sub    $0x14,%esp
+  803c37:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803c3b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803c3f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803c43:	8b 74 24 34          	mov    0x34(%esp),%esi
+  803c47:	85 d2                	test   %edx,%edx
+  803c49:	0f 88 9b 00 00 00    	js     803cea <__moddi3+0xba>
+  803c4f:	89 f7                	mov    %esi,%edi
+  803c51:	31 ed                	xor    %ebp,%ebp
+  803c53:	09 cf                	or     %ecx,%edi
+  803c55:	0f 84 83 00 00 00    	je     803cde <__moddi3+0xae>
+  803c5b:	89 cb                	mov    %ecx,%ebx
+  803c5d:	89 f7                	mov    %esi,%edi
+  803c5f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  803c63:	f7 db                	neg    %ebx
+  803c65:	83 d7 00             	adc    $0x0,%edi
+  803c68:	f7 df                	neg    %edi
+  803c6a:	0f 49 f7             	cmovns %edi,%esi
+  803c6d:	0f 49 cb             	cmovns %ebx,%ecx
+  803c70:	89 74 24 04          	mov    %esi,0x4(%esp)
+  803c74:	89 0c 24             	mov    %ecx,(%esp)
+  803c77:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803c7c:	89 cd                	mov    %ecx,%ebp
+  803c7e:	66 90                	xchg   %ax,%ax
+  803c80:	89 e9                	mov    %ebp,%ecx
+  803c82:	89 c3                	mov    %eax,%ebx
+  803c84:	89 d6                	mov    %edx,%esi
+  803c86:	31 ff                	xor    %edi,%edi
+  803c88:	d3 ee                	shr    %cl,%esi
+  803c8a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  803c8d:	f6 c1 20             	test   $0x20,%cl
+  803c90:	0f 45 de             	cmovne %esi,%ebx
+  803c93:	0f 45 f7             	cmovne %edi,%esi
+  803c96:	8b 3c 24             	mov    (%esp),%edi
+  803c99:	39 fb                	cmp    %edi,%ebx
+  803c9b:	89 f7                	mov    %esi,%edi
+  803c9d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803ca1:	8b 1c 24             	mov    (%esp),%ebx
+  803ca4:	19 f7                	sbb    %esi,%edi
+  803ca6:	72 1a                	jb     803cc2 <__moddi3+0x92>
+  803ca8:	89 e9                	mov    %ebp,%ecx
+  803caa:	89 f7                	mov    %esi,%edi
+  803cac:	89 de                	mov    %ebx,%esi
+  803cae:	0f a5 df             	shld   %cl,%ebx,%edi
+  803cb1:	d3 e6                	shl    %cl,%esi
+  803cb3:	31 db                	xor    %ebx,%ebx
+  803cb5:	f6 c1 20             	test   $0x20,%cl
+  803cb8:	0f 45 fe             	cmovne %esi,%edi
+  803cbb:	0f 45 f3             	cmovne %ebx,%esi
+  803cbe:	29 f0                	sub    %esi,%eax
+  803cc0:	19 fa                	sbb    %edi,%edx
+  803cc2:	83 ed 01             	sub    $0x1,%ebp
+  803cc5:	73 b9                	jae    803c80 <__moddi3+0x50>
+  803cc7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  803ccb:	85 ed                	test   %ebp,%ebp
+  803ccd:	74 07                	je     803cd6 <__moddi3+0xa6>
+  803ccf:	f7 d8                	neg    %eax
+  803cd1:	83 d2 00             	adc    $0x0,%edx
+  803cd4:	f7 da                	neg    %edx
+  803cd6:	83 c4 14             	add    $0x14,%esp
+  803cd9:	5b                   	pop    %ebx
+  803cda:	5e                   	pop    %esi
+  803cdb:	5f                   	pop    %edi
+  803cdc:	5d                   	pop    %ebp
+  803cdd:	c3                   	ret
+  803cde:	83 c4 14             	add    $0x14,%esp
+  803ce1:	31 c0                	xor    %eax,%eax
+  803ce3:	31 d2                	xor    %edx,%edx
+  803ce5:	5b                   	pop    %ebx
+  803ce6:	5e                   	pop    %esi
+  803ce7:	5f                   	pop    %edi
+  803ce8:	5d                   	pop    %ebp
+  803ce9:	c3                   	ret
+  803cea:	89 f7                	mov    %esi,%edi
+  803cec:	09 cf                	or     %ecx,%edi
+  803cee:	74 11                	je     803d01 <__moddi3+0xd1>
+  803cf0:	f7 d8                	neg    %eax
+  803cf2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  803cf7:	83 d2 00             	adc    $0x0,%edx
+  803cfa:	f7 da                	neg    %edx
+  803cfc:	e9 5a ff ff ff       	jmp    803c5b <__moddi3+0x2b>
+  803d01:	31 c0                	xor    %eax,%eax
+  803d03:	31 d2                	xor    %edx,%edx
+  803d05:	eb c8                	jmp    803ccf <__moddi3+0x9f>
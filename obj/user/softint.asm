@@ -0,0 +1,5550 @@
+
+obj/user/softint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 05 00 00 00       	call   800036 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $14");	// page fault
+  800033:	cd 0e                	int    $0xe
+}
+  800035:	c3                   	ret
+
+00800036 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800036:	55                   	push   %ebp
+  800037:	89 e5                	mov    %esp,%ebp
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800041:	e8 ee 00 00 00       	call   800134 <sys_getenvid>
+  800046:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80004b:	c1 e0 09             	shl    $0x9,%eax
+  80004e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800053:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800058:	85 db                	test   %ebx,%ebx
+  80005a:	7e 07                	jle    800063 <libmain+0x2d>
+		binaryname = argv[0];
+  80005c:	8b 06                	mov    (%esi),%eax
+  80005e:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800063:	83 ec 08             	sub    $0x8,%esp
+  800066:	56                   	push   %esi
+  800067:	53                   	push   %ebx
+  800068:	e8 c6 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80006d:	e8 0a 00 00 00       	call   80007c <exit>
+}
+  800072:	83 c4 10             	add    $0x10,%esp
+  800075:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800078:	5b                   	pop    %ebx
+  800079:	5e                   	pop    %esi
+  80007a:	5d                   	pop    %ebp
+  80007b:	c3                   	ret
+
+0080007c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80007c:	55                   	push   %ebp
+  80007d:	89 e5                	mov    %esp,%ebp
+  80007f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800082:	e8 45 07 00 00       	call   8007cc <close_all>
+	sys_env_destroy(0);
+  800087:	83 ec 0c             	sub    $0xc,%esp
+  80008a:	6a 00                	push   $0x0
+  80008c:	e8 62 00 00 00       	call   8000f3 <sys_env_destroy>
+}
+  800091:	83 c4 10             	add    $0x10,%esp
+  800094:	c9                   	leave
+  800095:	c3                   	ret
+
+00800096 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800096:	55                   	push   %ebp
+  800097:	89 e5                	mov    %esp,%ebp
+  800099:	57                   	push   %edi
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80009c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000a7:	89 c3                	mov    %eax,%ebx
+  8000a9:	89 c7                	mov    %eax,%edi
+  8000ab:	89 c6                	mov    %eax,%esi
+  8000ad:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000af:	5b                   	pop    %ebx
+  8000b0:	5e                   	pop    %esi
+  8000b1:	5f                   	pop    %edi
+  8000b2:	5d                   	pop    %ebp
+  8000b3:	c3                   	ret
+
+008000b4 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000b4:	55                   	push   %ebp
+  8000b5:	89 e5                	mov    %esp,%ebp
+  8000b7:	57                   	push   %edi
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000c4:	89 d1                	mov    %edx,%ecx
+  8000c6:	89 d3                	mov    %edx,%ebx
+  8000c8:	89 d7                	mov    %edx,%edi
+  8000ca:	89 d6                	mov    %edx,%esi
+  8000cc:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000ce:	5b                   	pop    %ebx
+  8000cf:	5e                   	pop    %esi
+  8000d0:	5f                   	pop    %edi
+  8000d1:	5d                   	pop    %ebp
+  8000d2:	c3                   	ret
+
+008000d3 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8000d3:	55                   	push   %ebp
+  8000d4:	89 e5                	mov    %esp,%ebp
+  8000d6:	57                   	push   %edi
+  8000d7:	56                   	push   %esi
+  8000d8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8000e6:	89 cb                	mov    %ecx,%ebx
+  8000e8:	89 cf                	mov    %ecx,%edi
+  8000ea:	89 ce                	mov    %ecx,%esi
+  8000ec:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  8000ee:	5b                   	pop    %ebx
+  8000ef:	5e                   	pop    %esi
+  8000f0:	5f                   	pop    %edi
+  8000f1:	5d                   	pop    %ebp
+  8000f2:	c3                   	ret
+
+008000f3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000f3:	55                   	push   %ebp
+  8000f4:	89 e5                	mov    %esp,%ebp
+  8000f6:	57                   	push   %edi
+  8000f7:	56                   	push   %esi
+  8000f8:	53                   	push   %ebx
+  8000f9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8000fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800101:	8b 55 08             	mov    0x8(%ebp),%edx
+  800104:	b8 03 00 00 00       	mov    $0x3,%eax
+  800109:	89 cb                	mov    %ecx,%ebx
+  80010b:	89 cf                	mov    %ecx,%edi
+  80010d:	89 ce                	mov    %ecx,%esi
+  80010f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800111:	85 c0                	test   %eax,%eax
+  800113:	7f 08                	jg     80011d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800115:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800118:	5b                   	pop    %ebx
+  800119:	5e                   	pop    %esi
+  80011a:	5f                   	pop    %edi
+  80011b:	5d                   	pop    %ebp
+  80011c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80011d:	83 ec 0c             	sub    $0xc,%esp
+  800120:	50                   	push   %eax
+  800121:	6a 03                	push   $0x3
+  800123:	68 6a 26 80 00       	push   $0x80266a
+  800128:	6a 23                	push   $0x23
+  80012a:	68 87 26 80 00       	push   $0x802687
+  80012f:	e8 d5 15 00 00       	call   801709 <_panic>
+
+00800134 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	57                   	push   %edi
+  800138:	56                   	push   %esi
+  800139:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80013a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800144:	89 d1                	mov    %edx,%ecx
+  800146:	89 d3                	mov    %edx,%ebx
+  800148:	89 d7                	mov    %edx,%edi
+  80014a:	89 d6                	mov    %edx,%esi
+  80014c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80014e:	5b                   	pop    %ebx
+  80014f:	5e                   	pop    %esi
+  800150:	5f                   	pop    %edi
+  800151:	5d                   	pop    %ebp
+  800152:	c3                   	ret
+
+00800153 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800153:	55                   	push   %ebp
+  800154:	89 e5                	mov    %esp,%ebp
+  800156:	57                   	push   %edi
+  800157:	56                   	push   %esi
+  800158:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800159:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015e:	b8 16 00 00 00       	mov    $0x16,%eax
+  800163:	89 d1                	mov    %edx,%ecx
+  800165:	89 d3                	mov    %edx,%ebx
+  800167:	89 d7                	mov    %edx,%edi
+  800169:	89 d6                	mov    %edx,%esi
+  80016b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80016d:	5b                   	pop    %ebx
+  80016e:	5e                   	pop    %esi
+  80016f:	5f                   	pop    %edi
+  800170:	5d                   	pop    %ebp
+  800171:	c3                   	ret
+
+00800172 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800172:	55                   	push   %ebp
+  800173:	89 e5                	mov    %esp,%ebp
+  800175:	57                   	push   %edi
+  800176:	56                   	push   %esi
+  800177:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800178:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800182:	89 d1                	mov    %edx,%ecx
+  800184:	89 d3                	mov    %edx,%ebx
+  800186:	89 d7                	mov    %edx,%edi
+  800188:	89 d6                	mov    %edx,%esi
+  80018a:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  80018c:	5b                   	pop    %ebx
+  80018d:	5e                   	pop    %esi
+  80018e:	5f                   	pop    %edi
+  80018f:	5d                   	pop    %ebp
+  800190:	c3                   	ret
+
+00800191 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800191:	55                   	push   %ebp
+  800192:	89 e5                	mov    %esp,%ebp
+  800194:	57                   	push   %edi
+  800195:	56                   	push   %esi
+  800196:	53                   	push   %ebx
+  800197:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80019a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001a5:	b8 15 00 00 00       	mov    $0x15,%eax
+  8001aa:	89 df                	mov    %ebx,%edi
+  8001ac:	89 de                	mov    %ebx,%esi
+  8001ae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001b0:	85 c0                	test   %eax,%eax
+  8001b2:	7f 08                	jg     8001bc <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  8001b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b7:	5b                   	pop    %ebx
+  8001b8:	5e                   	pop    %esi
+  8001b9:	5f                   	pop    %edi
+  8001ba:	5d                   	pop    %ebp
+  8001bb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001bc:	83 ec 0c             	sub    $0xc,%esp
+  8001bf:	50                   	push   %eax
+  8001c0:	6a 15                	push   $0x15
+  8001c2:	68 6a 26 80 00       	push   $0x80266a
+  8001c7:	6a 23                	push   $0x23
+  8001c9:	68 87 26 80 00       	push   $0x802687
+  8001ce:	e8 36 15 00 00       	call   801709 <_panic>
+
+008001d3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001d3:	55                   	push   %ebp
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	57                   	push   %edi
+  8001d7:	56                   	push   %esi
+  8001d8:	53                   	push   %ebx
+  8001d9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001e7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001ef:	89 f7                	mov    %esi,%edi
+  8001f1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001f3:	85 c0                	test   %eax,%eax
+  8001f5:	7f 08                	jg     8001ff <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fa:	5b                   	pop    %ebx
+  8001fb:	5e                   	pop    %esi
+  8001fc:	5f                   	pop    %edi
+  8001fd:	5d                   	pop    %ebp
+  8001fe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001ff:	83 ec 0c             	sub    $0xc,%esp
+  800202:	50                   	push   %eax
+  800203:	6a 05                	push   $0x5
+  800205:	68 6a 26 80 00       	push   $0x80266a
+  80020a:	6a 23                	push   $0x23
+  80020c:	68 87 26 80 00       	push   $0x802687
+  800211:	e8 f3 14 00 00       	call   801709 <_panic>
+
+00800216 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800216:	55                   	push   %ebp
+  800217:	89 e5                	mov    %esp,%ebp
+  800219:	57                   	push   %edi
+  80021a:	56                   	push   %esi
+  80021b:	53                   	push   %ebx
+  80021c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80021f:	be 00 00 00 00       	mov    $0x0,%esi
+  800224:	8b 55 08             	mov    0x8(%ebp),%edx
+  800227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80022f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800232:	89 f7                	mov    %esi,%edi
+  800234:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800236:	85 c0                	test   %eax,%eax
+  800238:	7f 08                	jg     800242 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80023a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80023d:	5b                   	pop    %ebx
+  80023e:	5e                   	pop    %esi
+  80023f:	5f                   	pop    %edi
+  800240:	5d                   	pop    %ebp
+  800241:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800242:	83 ec 0c             	sub    $0xc,%esp
+  800245:	50                   	push   %eax
+  800246:	6a 06                	push   $0x6
+  800248:	68 6a 26 80 00       	push   $0x80266a
+  80024d:	6a 23                	push   $0x23
+  80024f:	68 87 26 80 00       	push   $0x802687
+  800254:	e8 b0 14 00 00       	call   801709 <_panic>
+
+00800259 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800259:	55                   	push   %ebp
+  80025a:	89 e5                	mov    %esp,%ebp
+  80025c:	57                   	push   %edi
+  80025d:	56                   	push   %esi
+  80025e:	53                   	push   %ebx
+  80025f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800262:	8b 55 08             	mov    0x8(%ebp),%edx
+  800265:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800268:	b8 07 00 00 00       	mov    $0x7,%eax
+  80026d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800270:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800273:	8b 75 18             	mov    0x18(%ebp),%esi
+  800276:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800278:	85 c0                	test   %eax,%eax
+  80027a:	7f 08                	jg     800284 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80027c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027f:	5b                   	pop    %ebx
+  800280:	5e                   	pop    %esi
+  800281:	5f                   	pop    %edi
+  800282:	5d                   	pop    %ebp
+  800283:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800284:	83 ec 0c             	sub    $0xc,%esp
+  800287:	50                   	push   %eax
+  800288:	6a 07                	push   $0x7
+  80028a:	68 6a 26 80 00       	push   $0x80266a
+  80028f:	6a 23                	push   $0x23
+  800291:	68 87 26 80 00       	push   $0x802687
+  800296:	e8 6e 14 00 00       	call   801709 <_panic>
+
+0080029b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80029b:	55                   	push   %ebp
+  80029c:	89 e5                	mov    %esp,%ebp
+  80029e:	57                   	push   %edi
+  80029f:	56                   	push   %esi
+  8002a0:	53                   	push   %ebx
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002af:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002b4:	89 df                	mov    %ebx,%edi
+  8002b6:	89 de                	mov    %ebx,%esi
+  8002b8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002ba:	85 c0                	test   %eax,%eax
+  8002bc:	7f 08                	jg     8002c6 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c1:	5b                   	pop    %ebx
+  8002c2:	5e                   	pop    %esi
+  8002c3:	5f                   	pop    %edi
+  8002c4:	5d                   	pop    %ebp
+  8002c5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002c6:	83 ec 0c             	sub    $0xc,%esp
+  8002c9:	50                   	push   %eax
+  8002ca:	6a 08                	push   $0x8
+  8002cc:	68 6a 26 80 00       	push   $0x80266a
+  8002d1:	6a 23                	push   $0x23
+  8002d3:	68 87 26 80 00       	push   $0x802687
+  8002d8:	e8 2c 14 00 00       	call   801709 <_panic>
+
+008002dd <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002dd:	55                   	push   %ebp
+  8002de:	89 e5                	mov    %esp,%ebp
+  8002e0:	57                   	push   %edi
+  8002e1:	56                   	push   %esi
+  8002e2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002e9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8002f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002f9:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8002fb:	5b                   	pop    %ebx
+  8002fc:	5e                   	pop    %esi
+  8002fd:	5f                   	pop    %edi
+  8002fe:	5d                   	pop    %ebp
+  8002ff:	c3                   	ret
+
+00800300 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800300:	55                   	push   %ebp
+  800301:	89 e5                	mov    %esp,%ebp
+  800303:	57                   	push   %edi
+  800304:	56                   	push   %esi
+  800305:	53                   	push   %ebx
+  800306:	8b 45 18             	mov    0x18(%ebp),%eax
+  800309:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  80030c:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800311:	77 27                	ja     80033a <sys_page_map_range+0x3a>
+  800313:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800319:	77 1f                	ja     80033a <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  80031b:	c1 e0 0c             	shl    $0xc,%eax
+  80031e:	89 c6                	mov    %eax,%esi
+  800320:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800322:	8b 55 08             	mov    0x8(%ebp),%edx
+  800325:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800328:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80032d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800330:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800333:	cd 30                	int    $0x30
+}
+  800335:	5b                   	pop    %ebx
+  800336:	5e                   	pop    %esi
+  800337:	5f                   	pop    %edi
+  800338:	5d                   	pop    %ebp
+  800339:	c3                   	ret
+		return -E_INVAL;
+  80033a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80033f:	eb f4                	jmp    800335 <sys_page_map_range+0x35>
+
+00800341 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800341:	55                   	push   %ebp
+  800342:	89 e5                	mov    %esp,%ebp
+  800344:	57                   	push   %edi
+  800345:	56                   	push   %esi
+  800346:	53                   	push   %ebx
+  800347:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80034a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80034d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800350:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800355:	be 00 00 00 00       	mov    $0x0,%esi
+  80035a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80035d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800360:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800362:	85 c0                	test   %eax,%eax
+  800364:	7f 08                	jg     80036e <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800366:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800369:	5b                   	pop    %ebx
+  80036a:	5e                   	pop    %esi
+  80036b:	5f                   	pop    %edi
+  80036c:	5d                   	pop    %ebp
+  80036d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80036e:	83 ec 0c             	sub    $0xc,%esp
+  800371:	50                   	push   %eax
+  800372:	6a 0c                	push   $0xc
+  800374:	68 6a 26 80 00       	push   $0x80266a
+  800379:	6a 23                	push   $0x23
+  80037b:	68 87 26 80 00       	push   $0x802687
+  800380:	e8 84 13 00 00       	call   801709 <_panic>
+
+00800385 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800385:	55                   	push   %ebp
+  800386:	89 e5                	mov    %esp,%ebp
+  800388:	57                   	push   %edi
+  800389:	56                   	push   %esi
+  80038a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80038b:	be 00 00 00 00       	mov    $0x0,%esi
+  800390:	8b 55 08             	mov    0x8(%ebp),%edx
+  800393:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800396:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80039b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80039e:	89 f7                	mov    %esi,%edi
+  8003a0:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003a2:	5b                   	pop    %ebx
+  8003a3:	5e                   	pop    %esi
+  8003a4:	5f                   	pop    %edi
+  8003a5:	5d                   	pop    %ebp
+  8003a6:	c3                   	ret
+
+008003a7 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003a7:	55                   	push   %ebp
+  8003a8:	89 e5                	mov    %esp,%ebp
+  8003aa:	57                   	push   %edi
+  8003ab:	56                   	push   %esi
+  8003ac:	53                   	push   %ebx
+  8003ad:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003bb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003c0:	89 df                	mov    %ebx,%edi
+  8003c2:	89 de                	mov    %ebx,%esi
+  8003c4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003c6:	85 c0                	test   %eax,%eax
+  8003c8:	7f 08                	jg     8003d2 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003cd:	5b                   	pop    %ebx
+  8003ce:	5e                   	pop    %esi
+  8003cf:	5f                   	pop    %edi
+  8003d0:	5d                   	pop    %ebp
+  8003d1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003d2:	83 ec 0c             	sub    $0xc,%esp
+  8003d5:	50                   	push   %eax
+  8003d6:	6a 0f                	push   $0xf
+  8003d8:	68 6a 26 80 00       	push   $0x80266a
+  8003dd:	6a 23                	push   $0x23
+  8003df:	68 87 26 80 00       	push   $0x802687
+  8003e4:	e8 20 13 00 00       	call   801709 <_panic>
+
+008003e9 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8003e9:	55                   	push   %ebp
+  8003ea:	89 e5                	mov    %esp,%ebp
+  8003ec:	57                   	push   %edi
+  8003ed:	56                   	push   %esi
+  8003ee:	53                   	push   %ebx
+  8003ef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003fd:	b8 10 00 00 00       	mov    $0x10,%eax
+  800402:	89 df                	mov    %ebx,%edi
+  800404:	89 de                	mov    %ebx,%esi
+  800406:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800408:	85 c0                	test   %eax,%eax
+  80040a:	7f 08                	jg     800414 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  80040c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80040f:	5b                   	pop    %ebx
+  800410:	5e                   	pop    %esi
+  800411:	5f                   	pop    %edi
+  800412:	5d                   	pop    %ebp
+  800413:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800414:	83 ec 0c             	sub    $0xc,%esp
+  800417:	50                   	push   %eax
+  800418:	6a 10                	push   $0x10
+  80041a:	68 6a 26 80 00       	push   $0x80266a
+  80041f:	6a 23                	push   $0x23
+  800421:	68 87 26 80 00       	push   $0x802687
+  800426:	e8 de 12 00 00       	call   801709 <_panic>
+
+0080042b <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80042b:	55                   	push   %ebp
+  80042c:	89 e5                	mov    %esp,%ebp
+  80042e:	57                   	push   %edi
+  80042f:	56                   	push   %esi
+  800430:	53                   	push   %ebx
+  800431:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800434:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800439:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80043f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800444:	89 df                	mov    %ebx,%edi
+  800446:	89 de                	mov    %ebx,%esi
+  800448:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80044a:	85 c0                	test   %eax,%eax
+  80044c:	7f 08                	jg     800456 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  80044e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800451:	5b                   	pop    %ebx
+  800452:	5e                   	pop    %esi
+  800453:	5f                   	pop    %edi
+  800454:	5d                   	pop    %ebp
+  800455:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800456:	83 ec 0c             	sub    $0xc,%esp
+  800459:	50                   	push   %eax
+  80045a:	6a 11                	push   $0x11
+  80045c:	68 6a 26 80 00       	push   $0x80266a
+  800461:	6a 23                	push   $0x23
+  800463:	68 87 26 80 00       	push   $0x802687
+  800468:	e8 9c 12 00 00       	call   801709 <_panic>
+
+0080046d <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  80046d:	55                   	push   %ebp
+  80046e:	89 e5                	mov    %esp,%ebp
+  800470:	57                   	push   %edi
+  800471:	56                   	push   %esi
+  800472:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800473:	ba 00 00 00 00       	mov    $0x0,%edx
+  800478:	b8 12 00 00 00       	mov    $0x12,%eax
+  80047d:	89 d1                	mov    %edx,%ecx
+  80047f:	89 d3                	mov    %edx,%ebx
+  800481:	89 d7                	mov    %edx,%edi
+  800483:	89 d6                	mov    %edx,%esi
+  800485:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800487:	5b                   	pop    %ebx
+  800488:	5e                   	pop    %esi
+  800489:	5f                   	pop    %edi
+  80048a:	5d                   	pop    %ebp
+  80048b:	c3                   	ret
+
+0080048c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80048c:	55                   	push   %ebp
+  80048d:	89 e5                	mov    %esp,%ebp
+  80048f:	57                   	push   %edi
+  800490:	56                   	push   %esi
+  800491:	53                   	push   %ebx
+  800492:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800495:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004a5:	89 df                	mov    %ebx,%edi
+  8004a7:	89 de                	mov    %ebx,%esi
+  8004a9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004ab:	85 c0                	test   %eax,%eax
+  8004ad:	7f 08                	jg     8004b7 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8004af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b2:	5b                   	pop    %ebx
+  8004b3:	5e                   	pop    %esi
+  8004b4:	5f                   	pop    %edi
+  8004b5:	5d                   	pop    %ebp
+  8004b6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004b7:	83 ec 0c             	sub    $0xc,%esp
+  8004ba:	50                   	push   %eax
+  8004bb:	6a 13                	push   $0x13
+  8004bd:	68 6a 26 80 00       	push   $0x80266a
+  8004c2:	6a 23                	push   $0x23
+  8004c4:	68 87 26 80 00       	push   $0x802687
+  8004c9:	e8 3b 12 00 00       	call   801709 <_panic>
+
+008004ce <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	57                   	push   %edi
+  8004d2:	56                   	push   %esi
+  8004d3:	53                   	push   %ebx
+  8004d4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004e7:	89 df                	mov    %ebx,%edi
+  8004e9:	89 de                	mov    %ebx,%esi
+  8004eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004ed:	85 c0                	test   %eax,%eax
+  8004ef:	7f 08                	jg     8004f9 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8004f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004f4:	5b                   	pop    %ebx
+  8004f5:	5e                   	pop    %esi
+  8004f6:	5f                   	pop    %edi
+  8004f7:	5d                   	pop    %ebp
+  8004f8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004f9:	83 ec 0c             	sub    $0xc,%esp
+  8004fc:	50                   	push   %eax
+  8004fd:	6a 14                	push   $0x14
+  8004ff:	68 6a 26 80 00       	push   $0x80266a
+  800504:	6a 23                	push   $0x23
+  800506:	68 87 26 80 00       	push   $0x802687
+  80050b:	e8 f9 11 00 00       	call   801709 <_panic>
+
+00800510 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800510:	55                   	push   %ebp
+  800511:	89 e5                	mov    %esp,%ebp
+  800513:	57                   	push   %edi
+  800514:	56                   	push   %esi
+  800515:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800516:	8b 55 08             	mov    0x8(%ebp),%edx
+  800519:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80051c:	b8 17 00 00 00       	mov    $0x17,%eax
+  800521:	be 00 00 00 00       	mov    $0x0,%esi
+  800526:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800529:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80052c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80052e:	5b                   	pop    %ebx
+  80052f:	5e                   	pop    %esi
+  800530:	5f                   	pop    %edi
+  800531:	5d                   	pop    %ebp
+  800532:	c3                   	ret
+
+00800533 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800533:	55                   	push   %ebp
+  800534:	89 e5                	mov    %esp,%ebp
+  800536:	57                   	push   %edi
+  800537:	56                   	push   %esi
+  800538:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800539:	8b 55 08             	mov    0x8(%ebp),%edx
+  80053c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80053f:	b8 18 00 00 00       	mov    $0x18,%eax
+  800544:	be 00 00 00 00       	mov    $0x0,%esi
+  800549:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80054c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80054f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800551:	5b                   	pop    %ebx
+  800552:	5e                   	pop    %esi
+  800553:	5f                   	pop    %edi
+  800554:	5d                   	pop    %ebp
+  800555:	c3                   	ret
+
+00800556 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800556:	55                   	push   %ebp
+  800557:	89 e5                	mov    %esp,%ebp
+  800559:	57                   	push   %edi
+  80055a:	56                   	push   %esi
+  80055b:	53                   	push   %ebx
+  80055c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80055f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800564:	8b 55 08             	mov    0x8(%ebp),%edx
+  800567:	b8 19 00 00 00       	mov    $0x19,%eax
+  80056c:	89 cb                	mov    %ecx,%ebx
+  80056e:	89 cf                	mov    %ecx,%edi
+  800570:	89 ce                	mov    %ecx,%esi
+  800572:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800574:	85 c0                	test   %eax,%eax
+  800576:	7f 08                	jg     800580 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800578:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80057b:	5b                   	pop    %ebx
+  80057c:	5e                   	pop    %esi
+  80057d:	5f                   	pop    %edi
+  80057e:	5d                   	pop    %ebp
+  80057f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800580:	83 ec 0c             	sub    $0xc,%esp
+  800583:	50                   	push   %eax
+  800584:	6a 19                	push   $0x19
+  800586:	68 6a 26 80 00       	push   $0x80266a
+  80058b:	6a 23                	push   $0x23
+  80058d:	68 87 26 80 00       	push   $0x802687
+  800592:	e8 72 11 00 00       	call   801709 <_panic>
+
+00800597 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800597:	55                   	push   %ebp
+  800598:	89 e5                	mov    %esp,%ebp
+  80059a:	57                   	push   %edi
+  80059b:	56                   	push   %esi
+  80059c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80059d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8005a7:	89 d1                	mov    %edx,%ecx
+  8005a9:	89 d3                	mov    %edx,%ebx
+  8005ab:	89 d7                	mov    %edx,%edi
+  8005ad:	89 d6                	mov    %edx,%esi
+  8005af:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8005b1:	5b                   	pop    %ebx
+  8005b2:	5e                   	pop    %esi
+  8005b3:	5f                   	pop    %edi
+  8005b4:	5d                   	pop    %ebp
+  8005b5:	c3                   	ret
+
+008005b6 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8005b6:	55                   	push   %ebp
+  8005b7:	89 e5                	mov    %esp,%ebp
+  8005b9:	57                   	push   %edi
+  8005ba:	56                   	push   %esi
+  8005bb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005cc:	89 df                	mov    %ebx,%edi
+  8005ce:	89 de                	mov    %ebx,%esi
+  8005d0:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8005d2:	5b                   	pop    %ebx
+  8005d3:	5e                   	pop    %esi
+  8005d4:	5f                   	pop    %edi
+  8005d5:	5d                   	pop    %ebp
+  8005d6:	c3                   	ret
+
+008005d7 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8005d7:	55                   	push   %ebp
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	57                   	push   %edi
+  8005db:	56                   	push   %esi
+  8005dc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005e8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005ed:	89 df                	mov    %ebx,%edi
+  8005ef:	89 de                	mov    %ebx,%esi
+  8005f1:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  8005f3:	5b                   	pop    %ebx
+  8005f4:	5e                   	pop    %esi
+  8005f5:	5f                   	pop    %edi
+  8005f6:	5d                   	pop    %ebp
+  8005f7:	c3                   	ret
+
+008005f8 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8005f8:	55                   	push   %ebp
+  8005f9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8005fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005fe:	05 00 00 00 30       	add    $0x30000000,%eax
+  800603:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800606:	5d                   	pop    %ebp
+  800607:	c3                   	ret
+
+00800608 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800608:	55                   	push   %ebp
+  800609:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80060b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80060e:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800613:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800618:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80061d:	5d                   	pop    %ebp
+  80061e:	c3                   	ret
+
+0080061f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80061f:	55                   	push   %ebp
+  800620:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800622:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800627:	eb 02                	jmp    80062b <fd_alloc+0xc>
+  800629:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80062b:	89 c2                	mov    %eax,%edx
+  80062d:	c1 ea 16             	shr    $0x16,%edx
+  800630:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800637:	f6 c2 01             	test   $0x1,%dl
+  80063a:	74 2b                	je     800667 <fd_alloc+0x48>
+  80063c:	89 c2                	mov    %eax,%edx
+  80063e:	c1 ea 0c             	shr    $0xc,%edx
+  800641:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800648:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80064e:	f6 c1 01             	test   $0x1,%cl
+  800651:	74 14                	je     800667 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800653:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800659:	75 ce                	jne    800629 <fd_alloc+0xa>
+  80065b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800660:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800665:	eb 05                	jmp    80066c <fd_alloc+0x4d>
+			return 0;
+  800667:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80066c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80066f:	89 02                	mov    %eax,(%edx)
+}
+  800671:	89 c8                	mov    %ecx,%eax
+  800673:	5d                   	pop    %ebp
+  800674:	c3                   	ret
+
+00800675 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800675:	55                   	push   %ebp
+  800676:	89 e5                	mov    %esp,%ebp
+  800678:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80067b:	83 f8 1f             	cmp    $0x1f,%eax
+  80067e:	77 30                	ja     8006b0 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800680:	c1 e0 0c             	shl    $0xc,%eax
+  800683:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800688:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80068e:	f6 c2 01             	test   $0x1,%dl
+  800691:	74 24                	je     8006b7 <fd_lookup+0x42>
+  800693:	89 c2                	mov    %eax,%edx
+  800695:	c1 ea 0c             	shr    $0xc,%edx
+  800698:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80069f:	f6 c2 01             	test   $0x1,%dl
+  8006a2:	74 1a                	je     8006be <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006a7:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006ae:	5d                   	pop    %ebp
+  8006af:	c3                   	ret
+		return -E_INVAL;
+  8006b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006b5:	eb f7                	jmp    8006ae <fd_lookup+0x39>
+		return -E_INVAL;
+  8006b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006bc:	eb f0                	jmp    8006ae <fd_lookup+0x39>
+  8006be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c3:	eb e9                	jmp    8006ae <fd_lookup+0x39>
+
+008006c5 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006c5:	55                   	push   %ebp
+  8006c6:	89 e5                	mov    %esp,%ebp
+  8006c8:	53                   	push   %ebx
+  8006c9:	83 ec 04             	sub    $0x4,%esp
+  8006cc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d4:	eb 03                	jmp    8006d9 <dev_lookup+0x14>
+  8006d6:	83 c0 01             	add    $0x1,%eax
+  8006d9:	8b 1c 85 14 27 80 00 	mov    0x802714(,%eax,4),%ebx
+  8006e0:	85 db                	test   %ebx,%ebx
+  8006e2:	74 0b                	je     8006ef <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8006e4:	39 13                	cmp    %edx,(%ebx)
+  8006e6:	75 ee                	jne    8006d6 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8006e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ed:	eb 1f                	jmp    80070e <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8006ef:	a1 08 40 80 00       	mov    0x804008,%eax
+  8006f4:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8006f7:	83 ec 04             	sub    $0x4,%esp
+  8006fa:	52                   	push   %edx
+  8006fb:	50                   	push   %eax
+  8006fc:	68 98 26 80 00       	push   $0x802698
+  800701:	e8 de 10 00 00       	call   8017e4 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800706:	83 c4 10             	add    $0x10,%esp
+  800709:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80070e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800711:	89 1a                	mov    %ebx,(%edx)
+}
+  800713:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800716:	c9                   	leave
+  800717:	c3                   	ret
+
+00800718 <fd_close>:
+{
+  800718:	55                   	push   %ebp
+  800719:	89 e5                	mov    %esp,%ebp
+  80071b:	57                   	push   %edi
+  80071c:	56                   	push   %esi
+  80071d:	53                   	push   %ebx
+  80071e:	83 ec 24             	sub    $0x24,%esp
+  800721:	8b 75 08             	mov    0x8(%ebp),%esi
+  800724:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800727:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80072a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80072b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800731:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800734:	50                   	push   %eax
+  800735:	e8 3b ff ff ff       	call   800675 <fd_lookup>
+  80073a:	89 c3                	mov    %eax,%ebx
+  80073c:	83 c4 10             	add    $0x10,%esp
+  80073f:	85 c0                	test   %eax,%eax
+  800741:	78 05                	js     800748 <fd_close+0x30>
+	    || fd != fd2)
+  800743:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800746:	74 16                	je     80075e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800748:	89 f8                	mov    %edi,%eax
+  80074a:	84 c0                	test   %al,%al
+  80074c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800751:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800754:	89 d8                	mov    %ebx,%eax
+  800756:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800759:	5b                   	pop    %ebx
+  80075a:	5e                   	pop    %esi
+  80075b:	5f                   	pop    %edi
+  80075c:	5d                   	pop    %ebp
+  80075d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80075e:	83 ec 08             	sub    $0x8,%esp
+  800761:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800764:	50                   	push   %eax
+  800765:	ff 36                	push   (%esi)
+  800767:	e8 59 ff ff ff       	call   8006c5 <dev_lookup>
+  80076c:	89 c3                	mov    %eax,%ebx
+  80076e:	83 c4 10             	add    $0x10,%esp
+  800771:	85 c0                	test   %eax,%eax
+  800773:	78 1a                	js     80078f <fd_close+0x77>
+		if (dev->dev_close)
+  800775:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800778:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80077b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800780:	85 c0                	test   %eax,%eax
+  800782:	74 0b                	je     80078f <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800784:	83 ec 0c             	sub    $0xc,%esp
+  800787:	56                   	push   %esi
+  800788:	ff d0                	call   *%eax
+  80078a:	89 c3                	mov    %eax,%ebx
+  80078c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80078f:	83 ec 08             	sub    $0x8,%esp
+  800792:	56                   	push   %esi
+  800793:	6a 00                	push   $0x0
+  800795:	e8 01 fb ff ff       	call   80029b <sys_page_unmap>
+	return r;
+  80079a:	83 c4 10             	add    $0x10,%esp
+  80079d:	eb b5                	jmp    800754 <fd_close+0x3c>
+
+0080079f <close>:
+
+int
+close(int fdnum)
+{
+  80079f:	55                   	push   %ebp
+  8007a0:	89 e5                	mov    %esp,%ebp
+  8007a2:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007a8:	50                   	push   %eax
+  8007a9:	ff 75 08             	push   0x8(%ebp)
+  8007ac:	e8 c4 fe ff ff       	call   800675 <fd_lookup>
+  8007b1:	83 c4 10             	add    $0x10,%esp
+  8007b4:	85 c0                	test   %eax,%eax
+  8007b6:	79 02                	jns    8007ba <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007b8:	c9                   	leave
+  8007b9:	c3                   	ret
+		return fd_close(fd, 1);
+  8007ba:	83 ec 08             	sub    $0x8,%esp
+  8007bd:	6a 01                	push   $0x1
+  8007bf:	ff 75 f4             	push   -0xc(%ebp)
+  8007c2:	e8 51 ff ff ff       	call   800718 <fd_close>
+  8007c7:	83 c4 10             	add    $0x10,%esp
+  8007ca:	eb ec                	jmp    8007b8 <close+0x19>
+
+008007cc <close_all>:
+
+void
+close_all(void)
+{
+  8007cc:	55                   	push   %ebp
+  8007cd:	89 e5                	mov    %esp,%ebp
+  8007cf:	53                   	push   %ebx
+  8007d0:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8007d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8007d8:	83 ec 0c             	sub    $0xc,%esp
+  8007db:	53                   	push   %ebx
+  8007dc:	e8 be ff ff ff       	call   80079f <close>
+	for (i = 0; i < MAXFD; i++)
+  8007e1:	83 c3 01             	add    $0x1,%ebx
+  8007e4:	83 c4 10             	add    $0x10,%esp
+  8007e7:	83 fb 20             	cmp    $0x20,%ebx
+  8007ea:	75 ec                	jne    8007d8 <close_all+0xc>
+}
+  8007ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ef:	c9                   	leave
+  8007f0:	c3                   	ret
+
+008007f1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8007f1:	55                   	push   %ebp
+  8007f2:	89 e5                	mov    %esp,%ebp
+  8007f4:	57                   	push   %edi
+  8007f5:	56                   	push   %esi
+  8007f6:	53                   	push   %ebx
+  8007f7:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8007fa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007fd:	50                   	push   %eax
+  8007fe:	ff 75 08             	push   0x8(%ebp)
+  800801:	e8 6f fe ff ff       	call   800675 <fd_lookup>
+  800806:	89 c3                	mov    %eax,%ebx
+  800808:	83 c4 10             	add    $0x10,%esp
+  80080b:	85 c0                	test   %eax,%eax
+  80080d:	78 7f                	js     80088e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80080f:	83 ec 0c             	sub    $0xc,%esp
+  800812:	ff 75 0c             	push   0xc(%ebp)
+  800815:	e8 85 ff ff ff       	call   80079f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80081a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80081d:	c1 e6 0c             	shl    $0xc,%esi
+  800820:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800826:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800829:	89 3c 24             	mov    %edi,(%esp)
+  80082c:	e8 d7 fd ff ff       	call   800608 <fd2data>
+  800831:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800833:	89 34 24             	mov    %esi,(%esp)
+  800836:	e8 cd fd ff ff       	call   800608 <fd2data>
+  80083b:	83 c4 10             	add    $0x10,%esp
+  80083e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800841:	89 d8                	mov    %ebx,%eax
+  800843:	c1 e8 16             	shr    $0x16,%eax
+  800846:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80084d:	a8 01                	test   $0x1,%al
+  80084f:	74 11                	je     800862 <dup+0x71>
+  800851:	89 d8                	mov    %ebx,%eax
+  800853:	c1 e8 0c             	shr    $0xc,%eax
+  800856:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80085d:	f6 c2 01             	test   $0x1,%dl
+  800860:	75 36                	jne    800898 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800862:	89 f8                	mov    %edi,%eax
+  800864:	c1 e8 0c             	shr    $0xc,%eax
+  800867:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80086e:	83 ec 0c             	sub    $0xc,%esp
+  800871:	25 07 0e 00 00       	and    $0xe07,%eax
+  800876:	50                   	push   %eax
+  800877:	56                   	push   %esi
+  800878:	6a 00                	push   $0x0
+  80087a:	57                   	push   %edi
+  80087b:	6a 00                	push   $0x0
+  80087d:	e8 d7 f9 ff ff       	call   800259 <sys_page_map>
+  800882:	89 c3                	mov    %eax,%ebx
+  800884:	83 c4 20             	add    $0x20,%esp
+  800887:	85 c0                	test   %eax,%eax
+  800889:	78 33                	js     8008be <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80088b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80088e:	89 d8                	mov    %ebx,%eax
+  800890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800893:	5b                   	pop    %ebx
+  800894:	5e                   	pop    %esi
+  800895:	5f                   	pop    %edi
+  800896:	5d                   	pop    %ebp
+  800897:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800898:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80089f:	83 ec 0c             	sub    $0xc,%esp
+  8008a2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008a7:	50                   	push   %eax
+  8008a8:	ff 75 d4             	push   -0x2c(%ebp)
+  8008ab:	6a 00                	push   $0x0
+  8008ad:	53                   	push   %ebx
+  8008ae:	6a 00                	push   $0x0
+  8008b0:	e8 a4 f9 ff ff       	call   800259 <sys_page_map>
+  8008b5:	89 c3                	mov    %eax,%ebx
+  8008b7:	83 c4 20             	add    $0x20,%esp
+  8008ba:	85 c0                	test   %eax,%eax
+  8008bc:	79 a4                	jns    800862 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008be:	83 ec 08             	sub    $0x8,%esp
+  8008c1:	56                   	push   %esi
+  8008c2:	6a 00                	push   $0x0
+  8008c4:	e8 d2 f9 ff ff       	call   80029b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008c9:	83 c4 08             	add    $0x8,%esp
+  8008cc:	ff 75 d4             	push   -0x2c(%ebp)
+  8008cf:	6a 00                	push   $0x0
+  8008d1:	e8 c5 f9 ff ff       	call   80029b <sys_page_unmap>
+	return r;
+  8008d6:	83 c4 10             	add    $0x10,%esp
+  8008d9:	eb b3                	jmp    80088e <dup+0x9d>
+
+008008db <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8008db:	55                   	push   %ebp
+  8008dc:	89 e5                	mov    %esp,%ebp
+  8008de:	56                   	push   %esi
+  8008df:	53                   	push   %ebx
+  8008e0:	83 ec 18             	sub    $0x18,%esp
+  8008e3:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8008e9:	50                   	push   %eax
+  8008ea:	56                   	push   %esi
+  8008eb:	e8 85 fd ff ff       	call   800675 <fd_lookup>
+  8008f0:	83 c4 10             	add    $0x10,%esp
+  8008f3:	85 c0                	test   %eax,%eax
+  8008f5:	78 3c                	js     800933 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008f7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8008fa:	83 ec 08             	sub    $0x8,%esp
+  8008fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800900:	50                   	push   %eax
+  800901:	ff 33                	push   (%ebx)
+  800903:	e8 bd fd ff ff       	call   8006c5 <dev_lookup>
+  800908:	83 c4 10             	add    $0x10,%esp
+  80090b:	85 c0                	test   %eax,%eax
+  80090d:	78 24                	js     800933 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80090f:	8b 43 08             	mov    0x8(%ebx),%eax
+  800912:	83 e0 03             	and    $0x3,%eax
+  800915:	83 f8 01             	cmp    $0x1,%eax
+  800918:	74 20                	je     80093a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80091a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80091d:	8b 40 08             	mov    0x8(%eax),%eax
+  800920:	85 c0                	test   %eax,%eax
+  800922:	74 37                	je     80095b <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800924:	83 ec 04             	sub    $0x4,%esp
+  800927:	ff 75 10             	push   0x10(%ebp)
+  80092a:	ff 75 0c             	push   0xc(%ebp)
+  80092d:	53                   	push   %ebx
+  80092e:	ff d0                	call   *%eax
+  800930:	83 c4 10             	add    $0x10,%esp
+}
+  800933:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800936:	5b                   	pop    %ebx
+  800937:	5e                   	pop    %esi
+  800938:	5d                   	pop    %ebp
+  800939:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80093a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80093f:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800942:	83 ec 04             	sub    $0x4,%esp
+  800945:	56                   	push   %esi
+  800946:	50                   	push   %eax
+  800947:	68 d9 26 80 00       	push   $0x8026d9
+  80094c:	e8 93 0e 00 00       	call   8017e4 <cprintf>
+		return -E_INVAL;
+  800951:	83 c4 10             	add    $0x10,%esp
+  800954:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800959:	eb d8                	jmp    800933 <read+0x58>
+		return -E_NOT_SUPP;
+  80095b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800960:	eb d1                	jmp    800933 <read+0x58>
+
+00800962 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800962:	55                   	push   %ebp
+  800963:	89 e5                	mov    %esp,%ebp
+  800965:	57                   	push   %edi
+  800966:	56                   	push   %esi
+  800967:	53                   	push   %ebx
+  800968:	83 ec 0c             	sub    $0xc,%esp
+  80096b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80096e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800971:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800976:	eb 02                	jmp    80097a <readn+0x18>
+  800978:	01 c3                	add    %eax,%ebx
+  80097a:	39 f3                	cmp    %esi,%ebx
+  80097c:	73 21                	jae    80099f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80097e:	83 ec 04             	sub    $0x4,%esp
+  800981:	89 f0                	mov    %esi,%eax
+  800983:	29 d8                	sub    %ebx,%eax
+  800985:	50                   	push   %eax
+  800986:	89 d8                	mov    %ebx,%eax
+  800988:	03 45 0c             	add    0xc(%ebp),%eax
+  80098b:	50                   	push   %eax
+  80098c:	57                   	push   %edi
+  80098d:	e8 49 ff ff ff       	call   8008db <read>
+		if (m < 0)
+  800992:	83 c4 10             	add    $0x10,%esp
+  800995:	85 c0                	test   %eax,%eax
+  800997:	78 04                	js     80099d <readn+0x3b>
+			return m;
+		if (m == 0)
+  800999:	75 dd                	jne    800978 <readn+0x16>
+  80099b:	eb 02                	jmp    80099f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80099d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80099f:	89 d8                	mov    %ebx,%eax
+  8009a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009a4:	5b                   	pop    %ebx
+  8009a5:	5e                   	pop    %esi
+  8009a6:	5f                   	pop    %edi
+  8009a7:	5d                   	pop    %ebp
+  8009a8:	c3                   	ret
+
+008009a9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	56                   	push   %esi
+  8009ad:	53                   	push   %ebx
+  8009ae:	83 ec 18             	sub    $0x18,%esp
+  8009b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009b4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009b7:	50                   	push   %eax
+  8009b8:	53                   	push   %ebx
+  8009b9:	e8 b7 fc ff ff       	call   800675 <fd_lookup>
+  8009be:	83 c4 10             	add    $0x10,%esp
+  8009c1:	85 c0                	test   %eax,%eax
+  8009c3:	78 37                	js     8009fc <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009c5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8009c8:	83 ec 08             	sub    $0x8,%esp
+  8009cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009ce:	50                   	push   %eax
+  8009cf:	ff 36                	push   (%esi)
+  8009d1:	e8 ef fc ff ff       	call   8006c5 <dev_lookup>
+  8009d6:	83 c4 10             	add    $0x10,%esp
+  8009d9:	85 c0                	test   %eax,%eax
+  8009db:	78 1f                	js     8009fc <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8009dd:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8009e1:	74 20                	je     800a03 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8009e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009e6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8009e9:	85 c0                	test   %eax,%eax
+  8009eb:	74 37                	je     800a24 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8009ed:	83 ec 04             	sub    $0x4,%esp
+  8009f0:	ff 75 10             	push   0x10(%ebp)
+  8009f3:	ff 75 0c             	push   0xc(%ebp)
+  8009f6:	56                   	push   %esi
+  8009f7:	ff d0                	call   *%eax
+  8009f9:	83 c4 10             	add    $0x10,%esp
+}
+  8009fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009ff:	5b                   	pop    %ebx
+  800a00:	5e                   	pop    %esi
+  800a01:	5d                   	pop    %ebp
+  800a02:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a03:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a08:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800a0b:	83 ec 04             	sub    $0x4,%esp
+  800a0e:	53                   	push   %ebx
+  800a0f:	50                   	push   %eax
+  800a10:	68 f5 26 80 00       	push   $0x8026f5
+  800a15:	e8 ca 0d 00 00       	call   8017e4 <cprintf>
+		return -E_INVAL;
+  800a1a:	83 c4 10             	add    $0x10,%esp
+  800a1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a22:	eb d8                	jmp    8009fc <write+0x53>
+		return -E_NOT_SUPP;
+  800a24:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a29:	eb d1                	jmp    8009fc <write+0x53>
+
+00800a2b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a34:	50                   	push   %eax
+  800a35:	ff 75 08             	push   0x8(%ebp)
+  800a38:	e8 38 fc ff ff       	call   800675 <fd_lookup>
+  800a3d:	83 c4 10             	add    $0x10,%esp
+  800a40:	85 c0                	test   %eax,%eax
+  800a42:	78 0e                	js     800a52 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800a44:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a4a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a52:	c9                   	leave
+  800a53:	c3                   	ret
+
+00800a54 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	56                   	push   %esi
+  800a58:	53                   	push   %ebx
+  800a59:	83 ec 18             	sub    $0x18,%esp
+  800a5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a5f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a62:	50                   	push   %eax
+  800a63:	53                   	push   %ebx
+  800a64:	e8 0c fc ff ff       	call   800675 <fd_lookup>
+  800a69:	83 c4 10             	add    $0x10,%esp
+  800a6c:	85 c0                	test   %eax,%eax
+  800a6e:	78 34                	js     800aa4 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a70:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a73:	83 ec 08             	sub    $0x8,%esp
+  800a76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a79:	50                   	push   %eax
+  800a7a:	ff 36                	push   (%esi)
+  800a7c:	e8 44 fc ff ff       	call   8006c5 <dev_lookup>
+  800a81:	83 c4 10             	add    $0x10,%esp
+  800a84:	85 c0                	test   %eax,%eax
+  800a86:	78 1c                	js     800aa4 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a88:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a8c:	74 1d                	je     800aab <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800a8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a91:	8b 40 18             	mov    0x18(%eax),%eax
+  800a94:	85 c0                	test   %eax,%eax
+  800a96:	74 34                	je     800acc <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800a98:	83 ec 08             	sub    $0x8,%esp
+  800a9b:	ff 75 0c             	push   0xc(%ebp)
+  800a9e:	56                   	push   %esi
+  800a9f:	ff d0                	call   *%eax
+  800aa1:	83 c4 10             	add    $0x10,%esp
+}
+  800aa4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aa7:	5b                   	pop    %ebx
+  800aa8:	5e                   	pop    %esi
+  800aa9:	5d                   	pop    %ebp
+  800aaa:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800aab:	a1 08 40 80 00       	mov    0x804008,%eax
+  800ab0:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ab3:	83 ec 04             	sub    $0x4,%esp
+  800ab6:	53                   	push   %ebx
+  800ab7:	50                   	push   %eax
+  800ab8:	68 b8 26 80 00       	push   $0x8026b8
+  800abd:	e8 22 0d 00 00       	call   8017e4 <cprintf>
+		return -E_INVAL;
+  800ac2:	83 c4 10             	add    $0x10,%esp
+  800ac5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800aca:	eb d8                	jmp    800aa4 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800acc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ad1:	eb d1                	jmp    800aa4 <ftruncate+0x50>
+
+00800ad3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800ad3:	55                   	push   %ebp
+  800ad4:	89 e5                	mov    %esp,%ebp
+  800ad6:	56                   	push   %esi
+  800ad7:	53                   	push   %ebx
+  800ad8:	83 ec 18             	sub    $0x18,%esp
+  800adb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ade:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ae1:	50                   	push   %eax
+  800ae2:	ff 75 08             	push   0x8(%ebp)
+  800ae5:	e8 8b fb ff ff       	call   800675 <fd_lookup>
+  800aea:	83 c4 10             	add    $0x10,%esp
+  800aed:	85 c0                	test   %eax,%eax
+  800aef:	78 49                	js     800b3a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800af1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800af4:	83 ec 08             	sub    $0x8,%esp
+  800af7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800afa:	50                   	push   %eax
+  800afb:	ff 36                	push   (%esi)
+  800afd:	e8 c3 fb ff ff       	call   8006c5 <dev_lookup>
+  800b02:	83 c4 10             	add    $0x10,%esp
+  800b05:	85 c0                	test   %eax,%eax
+  800b07:	78 31                	js     800b3a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b0c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b10:	74 2f                	je     800b41 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b12:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b15:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b1c:	00 00 00 
+	stat->st_isdir = 0;
+  800b1f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b26:	00 00 00 
+	stat->st_dev = dev;
+  800b29:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b2f:	83 ec 08             	sub    $0x8,%esp
+  800b32:	53                   	push   %ebx
+  800b33:	56                   	push   %esi
+  800b34:	ff 50 14             	call   *0x14(%eax)
+  800b37:	83 c4 10             	add    $0x10,%esp
+}
+  800b3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b3d:	5b                   	pop    %ebx
+  800b3e:	5e                   	pop    %esi
+  800b3f:	5d                   	pop    %ebp
+  800b40:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b41:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b46:	eb f2                	jmp    800b3a <fstat+0x67>
+
+00800b48 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b48:	55                   	push   %ebp
+  800b49:	89 e5                	mov    %esp,%ebp
+  800b4b:	56                   	push   %esi
+  800b4c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800b4d:	83 ec 08             	sub    $0x8,%esp
+  800b50:	6a 00                	push   $0x0
+  800b52:	ff 75 08             	push   0x8(%ebp)
+  800b55:	e8 e4 01 00 00       	call   800d3e <open>
+  800b5a:	89 c3                	mov    %eax,%ebx
+  800b5c:	83 c4 10             	add    $0x10,%esp
+  800b5f:	85 c0                	test   %eax,%eax
+  800b61:	78 1b                	js     800b7e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800b63:	83 ec 08             	sub    $0x8,%esp
+  800b66:	ff 75 0c             	push   0xc(%ebp)
+  800b69:	50                   	push   %eax
+  800b6a:	e8 64 ff ff ff       	call   800ad3 <fstat>
+  800b6f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b71:	89 1c 24             	mov    %ebx,(%esp)
+  800b74:	e8 26 fc ff ff       	call   80079f <close>
+	return r;
+  800b79:	83 c4 10             	add    $0x10,%esp
+  800b7c:	89 f3                	mov    %esi,%ebx
+}
+  800b7e:	89 d8                	mov    %ebx,%eax
+  800b80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b83:	5b                   	pop    %ebx
+  800b84:	5e                   	pop    %esi
+  800b85:	5d                   	pop    %ebp
+  800b86:	c3                   	ret
+
+00800b87 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800b87:	55                   	push   %ebp
+  800b88:	89 e5                	mov    %esp,%ebp
+  800b8a:	56                   	push   %esi
+  800b8b:	53                   	push   %ebx
+  800b8c:	89 c6                	mov    %eax,%esi
+  800b8e:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800b90:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800b97:	74 27                	je     800bc0 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800b99:	6a 07                	push   $0x7
+  800b9b:	68 00 50 80 00       	push   $0x805000
+  800ba0:	56                   	push   %esi
+  800ba1:	ff 35 00 40 80 00    	push   0x804000
+  800ba7:	e8 ce 15 00 00       	call   80217a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800bac:	83 c4 0c             	add    $0xc,%esp
+  800baf:	6a 00                	push   $0x0
+  800bb1:	53                   	push   %ebx
+  800bb2:	6a 00                	push   $0x0
+  800bb4:	e8 49 15 00 00       	call   802102 <ipc_recv>
+}
+  800bb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bbc:	5b                   	pop    %ebx
+  800bbd:	5e                   	pop    %esi
+  800bbe:	5d                   	pop    %ebp
+  800bbf:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bc0:	83 ec 0c             	sub    $0xc,%esp
+  800bc3:	6a 01                	push   $0x1
+  800bc5:	e8 04 16 00 00       	call   8021ce <ipc_find_env>
+  800bca:	a3 00 40 80 00       	mov    %eax,0x804000
+  800bcf:	83 c4 10             	add    $0x10,%esp
+  800bd2:	eb c5                	jmp    800b99 <fsipc+0x12>
+
+00800bd4 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800bd4:	55                   	push   %ebp
+  800bd5:	89 e5                	mov    %esp,%ebp
+  800bd7:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800bda:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bdd:	8b 40 0c             	mov    0xc(%eax),%eax
+  800be0:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800be5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800be8:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800bed:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bf7:	e8 8b ff ff ff       	call   800b87 <fsipc>
+}
+  800bfc:	c9                   	leave
+  800bfd:	c3                   	ret
+
+00800bfe <devfile_flush>:
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800c04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c07:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c0a:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800c0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c14:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c19:	e8 69 ff ff ff       	call   800b87 <fsipc>
+}
+  800c1e:	c9                   	leave
+  800c1f:	c3                   	ret
+
+00800c20 <devfile_stat>:
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	53                   	push   %ebx
+  800c24:	83 ec 04             	sub    $0x4,%esp
+  800c27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800c2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c2d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c30:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800c35:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c3a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c3f:	e8 43 ff ff ff       	call   800b87 <fsipc>
+  800c44:	85 c0                	test   %eax,%eax
+  800c46:	78 2c                	js     800c74 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800c48:	83 ec 08             	sub    $0x8,%esp
+  800c4b:	68 00 50 80 00       	push   $0x805000
+  800c50:	53                   	push   %ebx
+  800c51:	e8 7c 11 00 00       	call   801dd2 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800c56:	a1 80 50 80 00       	mov    0x805080,%eax
+  800c5b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800c61:	a1 84 50 80 00       	mov    0x805084,%eax
+  800c66:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800c6c:	83 c4 10             	add    $0x10,%esp
+  800c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c77:	c9                   	leave
+  800c78:	c3                   	ret
+
+00800c79 <devfile_write>:
+{
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	83 ec 0c             	sub    $0xc,%esp
+  800c7f:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800c82:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800c87:	39 d0                	cmp    %edx,%eax
+  800c89:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800c8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8f:	8b 52 0c             	mov    0xc(%edx),%edx
+  800c92:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800c98:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800c9d:	50                   	push   %eax
+  800c9e:	ff 75 0c             	push   0xc(%ebp)
+  800ca1:	68 08 50 80 00       	push   $0x805008
+  800ca6:	e8 ad 12 00 00       	call   801f58 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800cab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cb5:	e8 cd fe ff ff       	call   800b87 <fsipc>
+}
+  800cba:	c9                   	leave
+  800cbb:	c3                   	ret
+
+00800cbc <devfile_read>:
+{
+  800cbc:	55                   	push   %ebp
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	56                   	push   %esi
+  800cc0:	53                   	push   %ebx
+  800cc1:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800cc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc7:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cca:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800ccf:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800cd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cda:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cdf:	e8 a3 fe ff ff       	call   800b87 <fsipc>
+  800ce4:	89 c3                	mov    %eax,%ebx
+  800ce6:	85 c0                	test   %eax,%eax
+  800ce8:	78 1f                	js     800d09 <devfile_read+0x4d>
+	assert(r <= n);
+  800cea:	39 c6                	cmp    %eax,%esi
+  800cec:	72 24                	jb     800d12 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  800cee:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800cf3:	7f 33                	jg     800d28 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800cf5:	83 ec 04             	sub    $0x4,%esp
+  800cf8:	50                   	push   %eax
+  800cf9:	68 00 50 80 00       	push   $0x805000
+  800cfe:	ff 75 0c             	push   0xc(%ebp)
+  800d01:	e8 52 12 00 00       	call   801f58 <memmove>
+	return r;
+  800d06:	83 c4 10             	add    $0x10,%esp
+}
+  800d09:	89 d8                	mov    %ebx,%eax
+  800d0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d0e:	5b                   	pop    %ebx
+  800d0f:	5e                   	pop    %esi
+  800d10:	5d                   	pop    %ebp
+  800d11:	c3                   	ret
+	assert(r <= n);
+  800d12:	68 28 27 80 00       	push   $0x802728
+  800d17:	68 2f 27 80 00       	push   $0x80272f
+  800d1c:	6a 7c                	push   $0x7c
+  800d1e:	68 44 27 80 00       	push   $0x802744
+  800d23:	e8 e1 09 00 00       	call   801709 <_panic>
+	assert(r <= PGSIZE);
+  800d28:	68 4f 27 80 00       	push   $0x80274f
+  800d2d:	68 2f 27 80 00       	push   $0x80272f
+  800d32:	6a 7d                	push   $0x7d
+  800d34:	68 44 27 80 00       	push   $0x802744
+  800d39:	e8 cb 09 00 00       	call   801709 <_panic>
+
+00800d3e <open>:
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	56                   	push   %esi
+  800d42:	53                   	push   %ebx
+  800d43:	83 ec 1c             	sub    $0x1c,%esp
+  800d46:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800d49:	56                   	push   %esi
+  800d4a:	e8 48 10 00 00       	call   801d97 <strlen>
+  800d4f:	83 c4 10             	add    $0x10,%esp
+  800d52:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800d57:	7f 6c                	jg     800dc5 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800d59:	83 ec 0c             	sub    $0xc,%esp
+  800d5c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d5f:	50                   	push   %eax
+  800d60:	e8 ba f8 ff ff       	call   80061f <fd_alloc>
+  800d65:	89 c3                	mov    %eax,%ebx
+  800d67:	83 c4 10             	add    $0x10,%esp
+  800d6a:	85 c0                	test   %eax,%eax
+  800d6c:	78 3c                	js     800daa <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800d6e:	83 ec 08             	sub    $0x8,%esp
+  800d71:	56                   	push   %esi
+  800d72:	68 00 50 80 00       	push   $0x805000
+  800d77:	e8 56 10 00 00       	call   801dd2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800d7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d7f:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800d84:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800d87:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d8c:	e8 f6 fd ff ff       	call   800b87 <fsipc>
+  800d91:	89 c3                	mov    %eax,%ebx
+  800d93:	83 c4 10             	add    $0x10,%esp
+  800d96:	85 c0                	test   %eax,%eax
+  800d98:	78 19                	js     800db3 <open+0x75>
+	return fd2num(fd);
+  800d9a:	83 ec 0c             	sub    $0xc,%esp
+  800d9d:	ff 75 f4             	push   -0xc(%ebp)
+  800da0:	e8 53 f8 ff ff       	call   8005f8 <fd2num>
+  800da5:	89 c3                	mov    %eax,%ebx
+  800da7:	83 c4 10             	add    $0x10,%esp
+}
+  800daa:	89 d8                	mov    %ebx,%eax
+  800dac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800daf:	5b                   	pop    %ebx
+  800db0:	5e                   	pop    %esi
+  800db1:	5d                   	pop    %ebp
+  800db2:	c3                   	ret
+		fd_close(fd, 0);
+  800db3:	83 ec 08             	sub    $0x8,%esp
+  800db6:	6a 00                	push   $0x0
+  800db8:	ff 75 f4             	push   -0xc(%ebp)
+  800dbb:	e8 58 f9 ff ff       	call   800718 <fd_close>
+		return r;
+  800dc0:	83 c4 10             	add    $0x10,%esp
+  800dc3:	eb e5                	jmp    800daa <open+0x6c>
+		return -E_BAD_PATH;
+  800dc5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800dca:	eb de                	jmp    800daa <open+0x6c>
+
+00800dcc <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800dcc:	55                   	push   %ebp
+  800dcd:	89 e5                	mov    %esp,%ebp
+  800dcf:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800dd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd7:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ddc:	e8 a6 fd ff ff       	call   800b87 <fsipc>
+}
+  800de1:	c9                   	leave
+  800de2:	c3                   	ret
+
+00800de3 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800de9:	68 5b 27 80 00       	push   $0x80275b
+  800dee:	ff 75 0c             	push   0xc(%ebp)
+  800df1:	e8 dc 0f 00 00       	call   801dd2 <strcpy>
+	return 0;
+}
+  800df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfb:	c9                   	leave
+  800dfc:	c3                   	ret
+
+00800dfd <devsock_close>:
+{
+  800dfd:	55                   	push   %ebp
+  800dfe:	89 e5                	mov    %esp,%ebp
+  800e00:	53                   	push   %ebx
+  800e01:	83 ec 10             	sub    $0x10,%esp
+  800e04:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800e07:	53                   	push   %ebx
+  800e08:	e8 d1 13 00 00       	call   8021de <pageref>
+  800e0d:	89 c2                	mov    %eax,%edx
+  800e0f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e12:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800e17:	83 fa 01             	cmp    $0x1,%edx
+  800e1a:	74 05                	je     800e21 <devsock_close+0x24>
+}
+  800e1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e1f:	c9                   	leave
+  800e20:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800e21:	83 ec 0c             	sub    $0xc,%esp
+  800e24:	ff 73 0c             	push   0xc(%ebx)
+  800e27:	e8 b7 02 00 00       	call   8010e3 <nsipc_close>
+  800e2c:	83 c4 10             	add    $0x10,%esp
+  800e2f:	eb eb                	jmp    800e1c <devsock_close+0x1f>
+
+00800e31 <devsock_write>:
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800e37:	6a 00                	push   $0x0
+  800e39:	ff 75 10             	push   0x10(%ebp)
+  800e3c:	ff 75 0c             	push   0xc(%ebp)
+  800e3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e42:	ff 70 0c             	push   0xc(%eax)
+  800e45:	e8 79 03 00 00       	call   8011c3 <nsipc_send>
+}
+  800e4a:	c9                   	leave
+  800e4b:	c3                   	ret
+
+00800e4c <devsock_read>:
+{
+  800e4c:	55                   	push   %ebp
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800e52:	6a 00                	push   $0x0
+  800e54:	ff 75 10             	push   0x10(%ebp)
+  800e57:	ff 75 0c             	push   0xc(%ebp)
+  800e5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e5d:	ff 70 0c             	push   0xc(%eax)
+  800e60:	e8 ef 02 00 00       	call   801154 <nsipc_recv>
+}
+  800e65:	c9                   	leave
+  800e66:	c3                   	ret
+
+00800e67 <fd2sockid>:
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800e6d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800e70:	52                   	push   %edx
+  800e71:	50                   	push   %eax
+  800e72:	e8 fe f7 ff ff       	call   800675 <fd_lookup>
+  800e77:	83 c4 10             	add    $0x10,%esp
+  800e7a:	85 c0                	test   %eax,%eax
+  800e7c:	78 10                	js     800e8e <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800e7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e81:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800e87:	39 08                	cmp    %ecx,(%eax)
+  800e89:	75 05                	jne    800e90 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800e8b:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800e8e:	c9                   	leave
+  800e8f:	c3                   	ret
+		return -E_NOT_SUPP;
+  800e90:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e95:	eb f7                	jmp    800e8e <fd2sockid+0x27>
+
+00800e97 <alloc_sockfd>:
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	56                   	push   %esi
+  800e9b:	53                   	push   %ebx
+  800e9c:	83 ec 1c             	sub    $0x1c,%esp
+  800e9f:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800ea1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ea4:	50                   	push   %eax
+  800ea5:	e8 75 f7 ff ff       	call   80061f <fd_alloc>
+  800eaa:	89 c3                	mov    %eax,%ebx
+  800eac:	83 c4 10             	add    $0x10,%esp
+  800eaf:	85 c0                	test   %eax,%eax
+  800eb1:	78 43                	js     800ef6 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800eb3:	83 ec 04             	sub    $0x4,%esp
+  800eb6:	68 07 04 00 00       	push   $0x407
+  800ebb:	ff 75 f4             	push   -0xc(%ebp)
+  800ebe:	6a 00                	push   $0x0
+  800ec0:	e8 0e f3 ff ff       	call   8001d3 <sys_page_alloc>
+  800ec5:	89 c3                	mov    %eax,%ebx
+  800ec7:	83 c4 10             	add    $0x10,%esp
+  800eca:	85 c0                	test   %eax,%eax
+  800ecc:	78 28                	js     800ef6 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800ece:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ed1:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800ed7:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800ed9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800edc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800ee3:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800ee6:	83 ec 0c             	sub    $0xc,%esp
+  800ee9:	50                   	push   %eax
+  800eea:	e8 09 f7 ff ff       	call   8005f8 <fd2num>
+  800eef:	89 c3                	mov    %eax,%ebx
+  800ef1:	83 c4 10             	add    $0x10,%esp
+  800ef4:	eb 0c                	jmp    800f02 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800ef6:	83 ec 0c             	sub    $0xc,%esp
+  800ef9:	56                   	push   %esi
+  800efa:	e8 e4 01 00 00       	call   8010e3 <nsipc_close>
+		return r;
+  800eff:	83 c4 10             	add    $0x10,%esp
+}
+  800f02:	89 d8                	mov    %ebx,%eax
+  800f04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f07:	5b                   	pop    %ebx
+  800f08:	5e                   	pop    %esi
+  800f09:	5d                   	pop    %ebp
+  800f0a:	c3                   	ret
+
+00800f0b <accept>:
+{
+  800f0b:	55                   	push   %ebp
+  800f0c:	89 e5                	mov    %esp,%ebp
+  800f0e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f11:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f14:	e8 4e ff ff ff       	call   800e67 <fd2sockid>
+  800f19:	85 c0                	test   %eax,%eax
+  800f1b:	78 1b                	js     800f38 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800f1d:	83 ec 04             	sub    $0x4,%esp
+  800f20:	ff 75 10             	push   0x10(%ebp)
+  800f23:	ff 75 0c             	push   0xc(%ebp)
+  800f26:	50                   	push   %eax
+  800f27:	e8 0e 01 00 00       	call   80103a <nsipc_accept>
+  800f2c:	83 c4 10             	add    $0x10,%esp
+  800f2f:	85 c0                	test   %eax,%eax
+  800f31:	78 05                	js     800f38 <accept+0x2d>
+	return alloc_sockfd(r);
+  800f33:	e8 5f ff ff ff       	call   800e97 <alloc_sockfd>
+}
+  800f38:	c9                   	leave
+  800f39:	c3                   	ret
+
+00800f3a <bind>:
+{
+  800f3a:	55                   	push   %ebp
+  800f3b:	89 e5                	mov    %esp,%ebp
+  800f3d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f43:	e8 1f ff ff ff       	call   800e67 <fd2sockid>
+  800f48:	85 c0                	test   %eax,%eax
+  800f4a:	78 12                	js     800f5e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800f4c:	83 ec 04             	sub    $0x4,%esp
+  800f4f:	ff 75 10             	push   0x10(%ebp)
+  800f52:	ff 75 0c             	push   0xc(%ebp)
+  800f55:	50                   	push   %eax
+  800f56:	e8 31 01 00 00       	call   80108c <nsipc_bind>
+  800f5b:	83 c4 10             	add    $0x10,%esp
+}
+  800f5e:	c9                   	leave
+  800f5f:	c3                   	ret
+
+00800f60 <shutdown>:
+{
+  800f60:	55                   	push   %ebp
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f69:	e8 f9 fe ff ff       	call   800e67 <fd2sockid>
+  800f6e:	85 c0                	test   %eax,%eax
+  800f70:	78 0f                	js     800f81 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800f72:	83 ec 08             	sub    $0x8,%esp
+  800f75:	ff 75 0c             	push   0xc(%ebp)
+  800f78:	50                   	push   %eax
+  800f79:	e8 43 01 00 00       	call   8010c1 <nsipc_shutdown>
+  800f7e:	83 c4 10             	add    $0x10,%esp
+}
+  800f81:	c9                   	leave
+  800f82:	c3                   	ret
+
+00800f83 <connect>:
+{
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800f89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f8c:	e8 d6 fe ff ff       	call   800e67 <fd2sockid>
+  800f91:	85 c0                	test   %eax,%eax
+  800f93:	78 12                	js     800fa7 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800f95:	83 ec 04             	sub    $0x4,%esp
+  800f98:	ff 75 10             	push   0x10(%ebp)
+  800f9b:	ff 75 0c             	push   0xc(%ebp)
+  800f9e:	50                   	push   %eax
+  800f9f:	e8 59 01 00 00       	call   8010fd <nsipc_connect>
+  800fa4:	83 c4 10             	add    $0x10,%esp
+}
+  800fa7:	c9                   	leave
+  800fa8:	c3                   	ret
+
+00800fa9 <listen>:
+{
+  800fa9:	55                   	push   %ebp
+  800faa:	89 e5                	mov    %esp,%ebp
+  800fac:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800faf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fb2:	e8 b0 fe ff ff       	call   800e67 <fd2sockid>
+  800fb7:	85 c0                	test   %eax,%eax
+  800fb9:	78 0f                	js     800fca <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800fbb:	83 ec 08             	sub    $0x8,%esp
+  800fbe:	ff 75 0c             	push   0xc(%ebp)
+  800fc1:	50                   	push   %eax
+  800fc2:	e8 6b 01 00 00       	call   801132 <nsipc_listen>
+  800fc7:	83 c4 10             	add    $0x10,%esp
+}
+  800fca:	c9                   	leave
+  800fcb:	c3                   	ret
+
+00800fcc <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800fcc:	55                   	push   %ebp
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800fd2:	ff 75 10             	push   0x10(%ebp)
+  800fd5:	ff 75 0c             	push   0xc(%ebp)
+  800fd8:	ff 75 08             	push   0x8(%ebp)
+  800fdb:	e8 41 02 00 00       	call   801221 <nsipc_socket>
+  800fe0:	83 c4 10             	add    $0x10,%esp
+  800fe3:	85 c0                	test   %eax,%eax
+  800fe5:	78 05                	js     800fec <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800fe7:	e8 ab fe ff ff       	call   800e97 <alloc_sockfd>
+}
+  800fec:	c9                   	leave
+  800fed:	c3                   	ret
+
+00800fee <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	53                   	push   %ebx
+  800ff2:	83 ec 04             	sub    $0x4,%esp
+  800ff5:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800ff7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ffe:	74 26                	je     801026 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801000:	6a 07                	push   $0x7
+  801002:	68 00 60 80 00       	push   $0x806000
+  801007:	53                   	push   %ebx
+  801008:	ff 35 04 40 80 00    	push   0x804004
+  80100e:	e8 67 11 00 00       	call   80217a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801013:	83 c4 0c             	add    $0xc,%esp
+  801016:	6a 00                	push   $0x0
+  801018:	6a 00                	push   $0x0
+  80101a:	6a 00                	push   $0x0
+  80101c:	e8 e1 10 00 00       	call   802102 <ipc_recv>
+}
+  801021:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801024:	c9                   	leave
+  801025:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801026:	83 ec 0c             	sub    $0xc,%esp
+  801029:	6a 02                	push   $0x2
+  80102b:	e8 9e 11 00 00       	call   8021ce <ipc_find_env>
+  801030:	a3 04 40 80 00       	mov    %eax,0x804004
+  801035:	83 c4 10             	add    $0x10,%esp
+  801038:	eb c6                	jmp    801000 <nsipc+0x12>
+
+0080103a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80103a:	55                   	push   %ebp
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	56                   	push   %esi
+  80103e:	53                   	push   %ebx
+  80103f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801042:	8b 45 08             	mov    0x8(%ebp),%eax
+  801045:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80104a:	8b 06                	mov    (%esi),%eax
+  80104c:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801051:	b8 01 00 00 00       	mov    $0x1,%eax
+  801056:	e8 93 ff ff ff       	call   800fee <nsipc>
+  80105b:	89 c3                	mov    %eax,%ebx
+  80105d:	85 c0                	test   %eax,%eax
+  80105f:	79 09                	jns    80106a <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801061:	89 d8                	mov    %ebx,%eax
+  801063:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801066:	5b                   	pop    %ebx
+  801067:	5e                   	pop    %esi
+  801068:	5d                   	pop    %ebp
+  801069:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80106a:	83 ec 04             	sub    $0x4,%esp
+  80106d:	ff 35 10 60 80 00    	push   0x806010
+  801073:	68 00 60 80 00       	push   $0x806000
+  801078:	ff 75 0c             	push   0xc(%ebp)
+  80107b:	e8 d8 0e 00 00       	call   801f58 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801080:	a1 10 60 80 00       	mov    0x806010,%eax
+  801085:	89 06                	mov    %eax,(%esi)
+  801087:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80108a:	eb d5                	jmp    801061 <nsipc_accept+0x27>
+
+0080108c <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80108c:	55                   	push   %ebp
+  80108d:	89 e5                	mov    %esp,%ebp
+  80108f:	53                   	push   %ebx
+  801090:	83 ec 08             	sub    $0x8,%esp
+  801093:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801096:	8b 45 08             	mov    0x8(%ebp),%eax
+  801099:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80109e:	53                   	push   %ebx
+  80109f:	ff 75 0c             	push   0xc(%ebp)
+  8010a2:	68 04 60 80 00       	push   $0x806004
+  8010a7:	e8 ac 0e 00 00       	call   801f58 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8010ac:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8010b2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010b7:	e8 32 ff ff ff       	call   800fee <nsipc>
+}
+  8010bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010bf:	c9                   	leave
+  8010c0:	c3                   	ret
+
+008010c1 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+  8010c4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8010c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ca:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8010cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010d2:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8010d7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010dc:	e8 0d ff ff ff       	call   800fee <nsipc>
+}
+  8010e1:	c9                   	leave
+  8010e2:	c3                   	ret
+
+008010e3 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8010e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ec:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  8010f1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010f6:	e8 f3 fe ff ff       	call   800fee <nsipc>
+}
+  8010fb:	c9                   	leave
+  8010fc:	c3                   	ret
+
+008010fd <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8010fd:	55                   	push   %ebp
+  8010fe:	89 e5                	mov    %esp,%ebp
+  801100:	53                   	push   %ebx
+  801101:	83 ec 08             	sub    $0x8,%esp
+  801104:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801107:	8b 45 08             	mov    0x8(%ebp),%eax
+  80110a:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80110f:	53                   	push   %ebx
+  801110:	ff 75 0c             	push   0xc(%ebp)
+  801113:	68 04 60 80 00       	push   $0x806004
+  801118:	e8 3b 0e 00 00       	call   801f58 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80111d:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801123:	b8 05 00 00 00       	mov    $0x5,%eax
+  801128:	e8 c1 fe ff ff       	call   800fee <nsipc>
+}
+  80112d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801130:	c9                   	leave
+  801131:	c3                   	ret
+
+00801132 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801132:	55                   	push   %ebp
+  801133:	89 e5                	mov    %esp,%ebp
+  801135:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801138:	8b 45 08             	mov    0x8(%ebp),%eax
+  80113b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801140:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801143:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801148:	b8 06 00 00 00       	mov    $0x6,%eax
+  80114d:	e8 9c fe ff ff       	call   800fee <nsipc>
+}
+  801152:	c9                   	leave
+  801153:	c3                   	ret
+
+00801154 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801154:	55                   	push   %ebp
+  801155:	89 e5                	mov    %esp,%ebp
+  801157:	56                   	push   %esi
+  801158:	53                   	push   %ebx
+  801159:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80115c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80115f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801164:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  80116a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80116d:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801172:	b8 07 00 00 00       	mov    $0x7,%eax
+  801177:	e8 72 fe ff ff       	call   800fee <nsipc>
+  80117c:	89 c3                	mov    %eax,%ebx
+  80117e:	85 c0                	test   %eax,%eax
+  801180:	78 22                	js     8011a4 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801182:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801187:	39 c6                	cmp    %eax,%esi
+  801189:	0f 4e c6             	cmovle %esi,%eax
+  80118c:	39 c3                	cmp    %eax,%ebx
+  80118e:	7f 1d                	jg     8011ad <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801190:	83 ec 04             	sub    $0x4,%esp
+  801193:	53                   	push   %ebx
+  801194:	68 00 60 80 00       	push   $0x806000
+  801199:	ff 75 0c             	push   0xc(%ebp)
+  80119c:	e8 b7 0d 00 00       	call   801f58 <memmove>
+  8011a1:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8011a4:	89 d8                	mov    %ebx,%eax
+  8011a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011a9:	5b                   	pop    %ebx
+  8011aa:	5e                   	pop    %esi
+  8011ab:	5d                   	pop    %ebp
+  8011ac:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8011ad:	68 67 27 80 00       	push   $0x802767
+  8011b2:	68 2f 27 80 00       	push   $0x80272f
+  8011b7:	6a 62                	push   $0x62
+  8011b9:	68 7c 27 80 00       	push   $0x80277c
+  8011be:	e8 46 05 00 00       	call   801709 <_panic>
+
+008011c3 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8011c3:	55                   	push   %ebp
+  8011c4:	89 e5                	mov    %esp,%ebp
+  8011c6:	53                   	push   %ebx
+  8011c7:	83 ec 04             	sub    $0x4,%esp
+  8011ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8011cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d0:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  8011d5:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8011db:	7f 2e                	jg     80120b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8011dd:	83 ec 04             	sub    $0x4,%esp
+  8011e0:	53                   	push   %ebx
+  8011e1:	ff 75 0c             	push   0xc(%ebp)
+  8011e4:	68 0c 60 80 00       	push   $0x80600c
+  8011e9:	e8 6a 0d 00 00       	call   801f58 <memmove>
+	nsipcbuf.send.req_size = size;
+  8011ee:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  8011f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011f7:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  8011fc:	b8 08 00 00 00       	mov    $0x8,%eax
+  801201:	e8 e8 fd ff ff       	call   800fee <nsipc>
+}
+  801206:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801209:	c9                   	leave
+  80120a:	c3                   	ret
+	assert(size < 1600);
+  80120b:	68 88 27 80 00       	push   $0x802788
+  801210:	68 2f 27 80 00       	push   $0x80272f
+  801215:	6a 6d                	push   $0x6d
+  801217:	68 7c 27 80 00       	push   $0x80277c
+  80121c:	e8 e8 04 00 00       	call   801709 <_panic>
+
+00801221 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801227:	8b 45 08             	mov    0x8(%ebp),%eax
+  80122a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  80122f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801232:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801237:	8b 45 10             	mov    0x10(%ebp),%eax
+  80123a:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  80123f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801244:	e8 a5 fd ff ff       	call   800fee <nsipc>
+}
+  801249:	c9                   	leave
+  80124a:	c3                   	ret
+
+0080124b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	56                   	push   %esi
+  80124f:	53                   	push   %ebx
+  801250:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801253:	83 ec 0c             	sub    $0xc,%esp
+  801256:	ff 75 08             	push   0x8(%ebp)
+  801259:	e8 aa f3 ff ff       	call   800608 <fd2data>
+  80125e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801260:	83 c4 08             	add    $0x8,%esp
+  801263:	68 94 27 80 00       	push   $0x802794
+  801268:	53                   	push   %ebx
+  801269:	e8 64 0b 00 00       	call   801dd2 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80126e:	8b 46 04             	mov    0x4(%esi),%eax
+  801271:	2b 06                	sub    (%esi),%eax
+  801273:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801279:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801280:	00 00 00 
+	stat->st_dev = &devpipe;
+  801283:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  80128a:	30 80 00 
+	return 0;
+}
+  80128d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801292:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801295:	5b                   	pop    %ebx
+  801296:	5e                   	pop    %esi
+  801297:	5d                   	pop    %ebp
+  801298:	c3                   	ret
+
+00801299 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801299:	55                   	push   %ebp
+  80129a:	89 e5                	mov    %esp,%ebp
+  80129c:	53                   	push   %ebx
+  80129d:	83 ec 0c             	sub    $0xc,%esp
+  8012a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8012a3:	53                   	push   %ebx
+  8012a4:	6a 00                	push   $0x0
+  8012a6:	e8 f0 ef ff ff       	call   80029b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8012ab:	89 1c 24             	mov    %ebx,(%esp)
+  8012ae:	e8 55 f3 ff ff       	call   800608 <fd2data>
+  8012b3:	83 c4 08             	add    $0x8,%esp
+  8012b6:	50                   	push   %eax
+  8012b7:	6a 00                	push   $0x0
+  8012b9:	e8 dd ef ff ff       	call   80029b <sys_page_unmap>
+}
+  8012be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012c1:	c9                   	leave
+  8012c2:	c3                   	ret
+
+008012c3 <_pipeisclosed>:
+{
+  8012c3:	55                   	push   %ebp
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	57                   	push   %edi
+  8012c7:	56                   	push   %esi
+  8012c8:	53                   	push   %ebx
+  8012c9:	83 ec 1c             	sub    $0x1c,%esp
+  8012cc:	89 c7                	mov    %eax,%edi
+  8012ce:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8012d0:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012d5:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8012d8:	83 ec 0c             	sub    $0xc,%esp
+  8012db:	57                   	push   %edi
+  8012dc:	e8 fd 0e 00 00       	call   8021de <pageref>
+  8012e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012e4:	89 34 24             	mov    %esi,(%esp)
+  8012e7:	e8 f2 0e 00 00       	call   8021de <pageref>
+		nn = thisenv->env_runs;
+  8012ec:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  8012f2:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8012f5:	83 c4 10             	add    $0x10,%esp
+  8012f8:	39 cb                	cmp    %ecx,%ebx
+  8012fa:	74 1b                	je     801317 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8012fc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8012ff:	75 cf                	jne    8012d0 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801301:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801304:	6a 01                	push   $0x1
+  801306:	50                   	push   %eax
+  801307:	53                   	push   %ebx
+  801308:	68 9b 27 80 00       	push   $0x80279b
+  80130d:	e8 d2 04 00 00       	call   8017e4 <cprintf>
+  801312:	83 c4 10             	add    $0x10,%esp
+  801315:	eb b9                	jmp    8012d0 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801317:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80131a:	0f 94 c0             	sete   %al
+  80131d:	0f b6 c0             	movzbl %al,%eax
+}
+  801320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801323:	5b                   	pop    %ebx
+  801324:	5e                   	pop    %esi
+  801325:	5f                   	pop    %edi
+  801326:	5d                   	pop    %ebp
+  801327:	c3                   	ret
+
+00801328 <devpipe_write>:
+{
+  801328:	55                   	push   %ebp
+  801329:	89 e5                	mov    %esp,%ebp
+  80132b:	57                   	push   %edi
+  80132c:	56                   	push   %esi
+  80132d:	53                   	push   %ebx
+  80132e:	83 ec 28             	sub    $0x28,%esp
+  801331:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801334:	56                   	push   %esi
+  801335:	e8 ce f2 ff ff       	call   800608 <fd2data>
+  80133a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80133c:	83 c4 10             	add    $0x10,%esp
+  80133f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801344:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801347:	75 09                	jne    801352 <devpipe_write+0x2a>
+	return i;
+  801349:	89 f8                	mov    %edi,%eax
+  80134b:	eb 23                	jmp    801370 <devpipe_write+0x48>
+			sys_yield();
+  80134d:	e8 01 ee ff ff       	call   800153 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801352:	8b 43 04             	mov    0x4(%ebx),%eax
+  801355:	8b 0b                	mov    (%ebx),%ecx
+  801357:	8d 51 20             	lea    0x20(%ecx),%edx
+  80135a:	39 d0                	cmp    %edx,%eax
+  80135c:	72 1a                	jb     801378 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80135e:	89 da                	mov    %ebx,%edx
+  801360:	89 f0                	mov    %esi,%eax
+  801362:	e8 5c ff ff ff       	call   8012c3 <_pipeisclosed>
+  801367:	85 c0                	test   %eax,%eax
+  801369:	74 e2                	je     80134d <devpipe_write+0x25>
+				return 0;
+  80136b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801373:	5b                   	pop    %ebx
+  801374:	5e                   	pop    %esi
+  801375:	5f                   	pop    %edi
+  801376:	5d                   	pop    %ebp
+  801377:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801378:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80137f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801382:	89 c2                	mov    %eax,%edx
+  801384:	c1 fa 1f             	sar    $0x1f,%edx
+  801387:	89 d1                	mov    %edx,%ecx
+  801389:	c1 e9 1b             	shr    $0x1b,%ecx
+  80138c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80138f:	83 e2 1f             	and    $0x1f,%edx
+  801392:	29 ca                	sub    %ecx,%edx
+  801394:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801398:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80139c:	83 c0 01             	add    $0x1,%eax
+  80139f:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8013a2:	83 c7 01             	add    $0x1,%edi
+  8013a5:	eb 9d                	jmp    801344 <devpipe_write+0x1c>
+
+008013a7 <devpipe_read>:
+{
+  8013a7:	55                   	push   %ebp
+  8013a8:	89 e5                	mov    %esp,%ebp
+  8013aa:	57                   	push   %edi
+  8013ab:	56                   	push   %esi
+  8013ac:	53                   	push   %ebx
+  8013ad:	83 ec 18             	sub    $0x18,%esp
+  8013b0:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8013b3:	57                   	push   %edi
+  8013b4:	e8 4f f2 ff ff       	call   800608 <fd2data>
+  8013b9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8013bb:	83 c4 10             	add    $0x10,%esp
+  8013be:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8013c6:	75 13                	jne    8013db <devpipe_read+0x34>
+	return i;
+  8013c8:	89 f0                	mov    %esi,%eax
+  8013ca:	eb 02                	jmp    8013ce <devpipe_read+0x27>
+				return i;
+  8013cc:	89 f0                	mov    %esi,%eax
+}
+  8013ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d1:	5b                   	pop    %ebx
+  8013d2:	5e                   	pop    %esi
+  8013d3:	5f                   	pop    %edi
+  8013d4:	5d                   	pop    %ebp
+  8013d5:	c3                   	ret
+			sys_yield();
+  8013d6:	e8 78 ed ff ff       	call   800153 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8013db:	8b 03                	mov    (%ebx),%eax
+  8013dd:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8013e0:	75 18                	jne    8013fa <devpipe_read+0x53>
+			if (i > 0)
+  8013e2:	85 f6                	test   %esi,%esi
+  8013e4:	75 e6                	jne    8013cc <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8013e6:	89 da                	mov    %ebx,%edx
+  8013e8:	89 f8                	mov    %edi,%eax
+  8013ea:	e8 d4 fe ff ff       	call   8012c3 <_pipeisclosed>
+  8013ef:	85 c0                	test   %eax,%eax
+  8013f1:	74 e3                	je     8013d6 <devpipe_read+0x2f>
+				return 0;
+  8013f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f8:	eb d4                	jmp    8013ce <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8013fa:	99                   	cltd
+  8013fb:	c1 ea 1b             	shr    $0x1b,%edx
+  8013fe:	01 d0                	add    %edx,%eax
+  801400:	83 e0 1f             	and    $0x1f,%eax
+  801403:	29 d0                	sub    %edx,%eax
+  801405:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80140a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801410:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801413:	83 c6 01             	add    $0x1,%esi
+  801416:	eb ab                	jmp    8013c3 <devpipe_read+0x1c>
+
+00801418 <pipe>:
+{
+  801418:	55                   	push   %ebp
+  801419:	89 e5                	mov    %esp,%ebp
+  80141b:	56                   	push   %esi
+  80141c:	53                   	push   %ebx
+  80141d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801420:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801423:	50                   	push   %eax
+  801424:	e8 f6 f1 ff ff       	call   80061f <fd_alloc>
+  801429:	89 c3                	mov    %eax,%ebx
+  80142b:	83 c4 10             	add    $0x10,%esp
+  80142e:	85 c0                	test   %eax,%eax
+  801430:	0f 88 23 01 00 00    	js     801559 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801436:	83 ec 04             	sub    $0x4,%esp
+  801439:	68 07 04 00 00       	push   $0x407
+  80143e:	ff 75 f4             	push   -0xc(%ebp)
+  801441:	6a 00                	push   $0x0
+  801443:	e8 8b ed ff ff       	call   8001d3 <sys_page_alloc>
+  801448:	89 c3                	mov    %eax,%ebx
+  80144a:	83 c4 10             	add    $0x10,%esp
+  80144d:	85 c0                	test   %eax,%eax
+  80144f:	0f 88 04 01 00 00    	js     801559 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801455:	83 ec 0c             	sub    $0xc,%esp
+  801458:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80145b:	50                   	push   %eax
+  80145c:	e8 be f1 ff ff       	call   80061f <fd_alloc>
+  801461:	89 c3                	mov    %eax,%ebx
+  801463:	83 c4 10             	add    $0x10,%esp
+  801466:	85 c0                	test   %eax,%eax
+  801468:	0f 88 db 00 00 00    	js     801549 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80146e:	83 ec 04             	sub    $0x4,%esp
+  801471:	68 07 04 00 00       	push   $0x407
+  801476:	ff 75 f0             	push   -0x10(%ebp)
+  801479:	6a 00                	push   $0x0
+  80147b:	e8 53 ed ff ff       	call   8001d3 <sys_page_alloc>
+  801480:	89 c3                	mov    %eax,%ebx
+  801482:	83 c4 10             	add    $0x10,%esp
+  801485:	85 c0                	test   %eax,%eax
+  801487:	0f 88 bc 00 00 00    	js     801549 <pipe+0x131>
+	va = fd2data(fd0);
+  80148d:	83 ec 0c             	sub    $0xc,%esp
+  801490:	ff 75 f4             	push   -0xc(%ebp)
+  801493:	e8 70 f1 ff ff       	call   800608 <fd2data>
+  801498:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80149a:	83 c4 0c             	add    $0xc,%esp
+  80149d:	68 07 04 00 00       	push   $0x407
+  8014a2:	50                   	push   %eax
+  8014a3:	6a 00                	push   $0x0
+  8014a5:	e8 29 ed ff ff       	call   8001d3 <sys_page_alloc>
+  8014aa:	89 c3                	mov    %eax,%ebx
+  8014ac:	83 c4 10             	add    $0x10,%esp
+  8014af:	85 c0                	test   %eax,%eax
+  8014b1:	0f 88 82 00 00 00    	js     801539 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014b7:	83 ec 0c             	sub    $0xc,%esp
+  8014ba:	ff 75 f0             	push   -0x10(%ebp)
+  8014bd:	e8 46 f1 ff ff       	call   800608 <fd2data>
+  8014c2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014c9:	50                   	push   %eax
+  8014ca:	6a 00                	push   $0x0
+  8014cc:	56                   	push   %esi
+  8014cd:	6a 00                	push   $0x0
+  8014cf:	e8 85 ed ff ff       	call   800259 <sys_page_map>
+  8014d4:	89 c3                	mov    %eax,%ebx
+  8014d6:	83 c4 20             	add    $0x20,%esp
+  8014d9:	85 c0                	test   %eax,%eax
+  8014db:	78 4e                	js     80152b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014dd:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8014e2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014e5:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014e7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014ea:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8014f1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8014f4:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8014f6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8014f9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801500:	83 ec 0c             	sub    $0xc,%esp
+  801503:	ff 75 f4             	push   -0xc(%ebp)
+  801506:	e8 ed f0 ff ff       	call   8005f8 <fd2num>
+  80150b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80150e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801510:	83 c4 04             	add    $0x4,%esp
+  801513:	ff 75 f0             	push   -0x10(%ebp)
+  801516:	e8 dd f0 ff ff       	call   8005f8 <fd2num>
+  80151b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80151e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801521:	83 c4 10             	add    $0x10,%esp
+  801524:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801529:	eb 2e                	jmp    801559 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80152b:	83 ec 08             	sub    $0x8,%esp
+  80152e:	56                   	push   %esi
+  80152f:	6a 00                	push   $0x0
+  801531:	e8 65 ed ff ff       	call   80029b <sys_page_unmap>
+  801536:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801539:	83 ec 08             	sub    $0x8,%esp
+  80153c:	ff 75 f0             	push   -0x10(%ebp)
+  80153f:	6a 00                	push   $0x0
+  801541:	e8 55 ed ff ff       	call   80029b <sys_page_unmap>
+  801546:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801549:	83 ec 08             	sub    $0x8,%esp
+  80154c:	ff 75 f4             	push   -0xc(%ebp)
+  80154f:	6a 00                	push   $0x0
+  801551:	e8 45 ed ff ff       	call   80029b <sys_page_unmap>
+  801556:	83 c4 10             	add    $0x10,%esp
+}
+  801559:	89 d8                	mov    %ebx,%eax
+  80155b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80155e:	5b                   	pop    %ebx
+  80155f:	5e                   	pop    %esi
+  801560:	5d                   	pop    %ebp
+  801561:	c3                   	ret
+
+00801562 <pipeisclosed>:
+{
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+  801565:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801568:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80156b:	50                   	push   %eax
+  80156c:	ff 75 08             	push   0x8(%ebp)
+  80156f:	e8 01 f1 ff ff       	call   800675 <fd_lookup>
+  801574:	83 c4 10             	add    $0x10,%esp
+  801577:	85 c0                	test   %eax,%eax
+  801579:	78 18                	js     801593 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80157b:	83 ec 0c             	sub    $0xc,%esp
+  80157e:	ff 75 f4             	push   -0xc(%ebp)
+  801581:	e8 82 f0 ff ff       	call   800608 <fd2data>
+  801586:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801588:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80158b:	e8 33 fd ff ff       	call   8012c3 <_pipeisclosed>
+  801590:	83 c4 10             	add    $0x10,%esp
+}
+  801593:	c9                   	leave
+  801594:	c3                   	ret
+
+00801595 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801595:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159a:	c3                   	ret
+
+0080159b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80159b:	55                   	push   %ebp
+  80159c:	89 e5                	mov    %esp,%ebp
+  80159e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015a1:	68 b3 27 80 00       	push   $0x8027b3
+  8015a6:	ff 75 0c             	push   0xc(%ebp)
+  8015a9:	e8 24 08 00 00       	call   801dd2 <strcpy>
+	return 0;
+}
+  8015ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b3:	c9                   	leave
+  8015b4:	c3                   	ret
+
+008015b5 <devcons_write>:
+{
+  8015b5:	55                   	push   %ebp
+  8015b6:	89 e5                	mov    %esp,%ebp
+  8015b8:	57                   	push   %edi
+  8015b9:	56                   	push   %esi
+  8015ba:	53                   	push   %ebx
+  8015bb:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015c1:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015c6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015cc:	eb 2e                	jmp    8015fc <devcons_write+0x47>
+		m = n - tot;
+  8015ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015d1:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015d3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015d8:	39 c3                	cmp    %eax,%ebx
+  8015da:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015dd:	83 ec 04             	sub    $0x4,%esp
+  8015e0:	53                   	push   %ebx
+  8015e1:	89 f0                	mov    %esi,%eax
+  8015e3:	03 45 0c             	add    0xc(%ebp),%eax
+  8015e6:	50                   	push   %eax
+  8015e7:	57                   	push   %edi
+  8015e8:	e8 6b 09 00 00       	call   801f58 <memmove>
+		sys_cputs(buf, m);
+  8015ed:	83 c4 08             	add    $0x8,%esp
+  8015f0:	53                   	push   %ebx
+  8015f1:	57                   	push   %edi
+  8015f2:	e8 9f ea ff ff       	call   800096 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8015f7:	01 de                	add    %ebx,%esi
+  8015f9:	83 c4 10             	add    $0x10,%esp
+  8015fc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8015ff:	72 cd                	jb     8015ce <devcons_write+0x19>
+}
+  801601:	89 f0                	mov    %esi,%eax
+  801603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801606:	5b                   	pop    %ebx
+  801607:	5e                   	pop    %esi
+  801608:	5f                   	pop    %edi
+  801609:	5d                   	pop    %ebp
+  80160a:	c3                   	ret
+
+0080160b <devcons_read>:
+{
+  80160b:	55                   	push   %ebp
+  80160c:	89 e5                	mov    %esp,%ebp
+  80160e:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801611:	b8 00 00 00 00       	mov    $0x0,%eax
+  801616:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80161a:	75 07                	jne    801623 <devcons_read+0x18>
+  80161c:	eb 1f                	jmp    80163d <devcons_read+0x32>
+		sys_yield();
+  80161e:	e8 30 eb ff ff       	call   800153 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801623:	e8 8c ea ff ff       	call   8000b4 <sys_cgetc>
+  801628:	85 c0                	test   %eax,%eax
+  80162a:	74 f2                	je     80161e <devcons_read+0x13>
+	if (c < 0)
+  80162c:	78 0f                	js     80163d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80162e:	83 f8 04             	cmp    $0x4,%eax
+  801631:	74 0c                	je     80163f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801633:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801636:	88 02                	mov    %al,(%edx)
+	return 1;
+  801638:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80163d:	c9                   	leave
+  80163e:	c3                   	ret
+		return 0;
+  80163f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801644:	eb f7                	jmp    80163d <devcons_read+0x32>
+
+00801646 <cputchar>:
+{
+  801646:	55                   	push   %ebp
+  801647:	89 e5                	mov    %esp,%ebp
+  801649:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80164c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80164f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801652:	6a 01                	push   $0x1
+  801654:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801657:	50                   	push   %eax
+  801658:	e8 39 ea ff ff       	call   800096 <sys_cputs>
+}
+  80165d:	83 c4 10             	add    $0x10,%esp
+  801660:	c9                   	leave
+  801661:	c3                   	ret
+
+00801662 <getchar>:
+{
+  801662:	55                   	push   %ebp
+  801663:	89 e5                	mov    %esp,%ebp
+  801665:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801668:	6a 01                	push   $0x1
+  80166a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80166d:	50                   	push   %eax
+  80166e:	6a 00                	push   $0x0
+  801670:	e8 66 f2 ff ff       	call   8008db <read>
+	if (r < 0)
+  801675:	83 c4 10             	add    $0x10,%esp
+  801678:	85 c0                	test   %eax,%eax
+  80167a:	78 06                	js     801682 <getchar+0x20>
+	if (r < 1)
+  80167c:	74 06                	je     801684 <getchar+0x22>
+	return c;
+  80167e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801682:	c9                   	leave
+  801683:	c3                   	ret
+		return -E_EOF;
+  801684:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801689:	eb f7                	jmp    801682 <getchar+0x20>
+
+0080168b <iscons>:
+{
+  80168b:	55                   	push   %ebp
+  80168c:	89 e5                	mov    %esp,%ebp
+  80168e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801691:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801694:	50                   	push   %eax
+  801695:	ff 75 08             	push   0x8(%ebp)
+  801698:	e8 d8 ef ff ff       	call   800675 <fd_lookup>
+  80169d:	83 c4 10             	add    $0x10,%esp
+  8016a0:	85 c0                	test   %eax,%eax
+  8016a2:	78 11                	js     8016b5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a7:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8016ad:	39 10                	cmp    %edx,(%eax)
+  8016af:	0f 94 c0             	sete   %al
+  8016b2:	0f b6 c0             	movzbl %al,%eax
+}
+  8016b5:	c9                   	leave
+  8016b6:	c3                   	ret
+
+008016b7 <opencons>:
+{
+  8016b7:	55                   	push   %ebp
+  8016b8:	89 e5                	mov    %esp,%ebp
+  8016ba:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c0:	50                   	push   %eax
+  8016c1:	e8 59 ef ff ff       	call   80061f <fd_alloc>
+  8016c6:	83 c4 10             	add    $0x10,%esp
+  8016c9:	85 c0                	test   %eax,%eax
+  8016cb:	78 3a                	js     801707 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016cd:	83 ec 04             	sub    $0x4,%esp
+  8016d0:	68 07 04 00 00       	push   $0x407
+  8016d5:	ff 75 f4             	push   -0xc(%ebp)
+  8016d8:	6a 00                	push   $0x0
+  8016da:	e8 f4 ea ff ff       	call   8001d3 <sys_page_alloc>
+  8016df:	83 c4 10             	add    $0x10,%esp
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	78 21                	js     801707 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e9:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8016ef:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8016f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8016fb:	83 ec 0c             	sub    $0xc,%esp
+  8016fe:	50                   	push   %eax
+  8016ff:	e8 f4 ee ff ff       	call   8005f8 <fd2num>
+  801704:	83 c4 10             	add    $0x10,%esp
+}
+  801707:	c9                   	leave
+  801708:	c3                   	ret
+
+00801709 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	56                   	push   %esi
+  80170d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80170e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801711:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801717:	e8 18 ea ff ff       	call   800134 <sys_getenvid>
+  80171c:	83 ec 0c             	sub    $0xc,%esp
+  80171f:	ff 75 0c             	push   0xc(%ebp)
+  801722:	ff 75 08             	push   0x8(%ebp)
+  801725:	56                   	push   %esi
+  801726:	50                   	push   %eax
+  801727:	68 c0 27 80 00       	push   $0x8027c0
+  80172c:	e8 b3 00 00 00       	call   8017e4 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801731:	83 c4 18             	add    $0x18,%esp
+  801734:	53                   	push   %ebx
+  801735:	ff 75 10             	push   0x10(%ebp)
+  801738:	e8 56 00 00 00       	call   801793 <vcprintf>
+	cprintf("\n");
+  80173d:	c7 04 24 ac 27 80 00 	movl   $0x8027ac,(%esp)
+  801744:	e8 9b 00 00 00       	call   8017e4 <cprintf>
+  801749:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80174c:	cc                   	int3
+	while (1)
+  80174d:	eb fd                	jmp    80174c <_panic+0x43>
+
+0080174f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80174f:	55                   	push   %ebp
+  801750:	89 e5                	mov    %esp,%ebp
+  801752:	53                   	push   %ebx
+  801753:	83 ec 04             	sub    $0x4,%esp
+  801756:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801759:	8b 13                	mov    (%ebx),%edx
+  80175b:	8d 42 01             	lea    0x1(%edx),%eax
+  80175e:	89 03                	mov    %eax,(%ebx)
+  801760:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801763:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801767:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80176c:	74 09                	je     801777 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80176e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801772:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801775:	c9                   	leave
+  801776:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801777:	83 ec 08             	sub    $0x8,%esp
+  80177a:	68 ff 00 00 00       	push   $0xff
+  80177f:	8d 43 08             	lea    0x8(%ebx),%eax
+  801782:	50                   	push   %eax
+  801783:	e8 0e e9 ff ff       	call   800096 <sys_cputs>
+		b->idx = 0;
+  801788:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80178e:	83 c4 10             	add    $0x10,%esp
+  801791:	eb db                	jmp    80176e <putch+0x1f>
+
+00801793 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80179c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017a3:	00 00 00 
+	b.cnt = 0;
+  8017a6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017ad:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017b0:	ff 75 0c             	push   0xc(%ebp)
+  8017b3:	ff 75 08             	push   0x8(%ebp)
+  8017b6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017bc:	50                   	push   %eax
+  8017bd:	68 4f 17 80 00       	push   $0x80174f
+  8017c2:	e8 14 01 00 00       	call   8018db <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017c7:	83 c4 08             	add    $0x8,%esp
+  8017ca:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017d0:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017d6:	50                   	push   %eax
+  8017d7:	e8 ba e8 ff ff       	call   800096 <sys_cputs>
+
+	return b.cnt;
+}
+  8017dc:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017e2:	c9                   	leave
+  8017e3:	c3                   	ret
+
+008017e4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017ea:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8017ed:	50                   	push   %eax
+  8017ee:	ff 75 08             	push   0x8(%ebp)
+  8017f1:	e8 9d ff ff ff       	call   801793 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8017f6:	c9                   	leave
+  8017f7:	c3                   	ret
+
+008017f8 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8017f8:	55                   	push   %ebp
+  8017f9:	89 e5                	mov    %esp,%ebp
+  8017fb:	57                   	push   %edi
+  8017fc:	56                   	push   %esi
+  8017fd:	53                   	push   %ebx
+  8017fe:	83 ec 1c             	sub    $0x1c,%esp
+  801801:	89 c7                	mov    %eax,%edi
+  801803:	89 d6                	mov    %edx,%esi
+  801805:	8b 45 08             	mov    0x8(%ebp),%eax
+  801808:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80180b:	89 d1                	mov    %edx,%ecx
+  80180d:	89 c2                	mov    %eax,%edx
+  80180f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801812:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801815:	8b 45 10             	mov    0x10(%ebp),%eax
+  801818:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80181b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80181e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801825:	39 c2                	cmp    %eax,%edx
+  801827:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80182a:	72 3e                	jb     80186a <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80182c:	83 ec 0c             	sub    $0xc,%esp
+  80182f:	ff 75 18             	push   0x18(%ebp)
+  801832:	83 eb 01             	sub    $0x1,%ebx
+  801835:	53                   	push   %ebx
+  801836:	50                   	push   %eax
+  801837:	83 ec 08             	sub    $0x8,%esp
+  80183a:	ff 75 e4             	push   -0x1c(%ebp)
+  80183d:	ff 75 e0             	push   -0x20(%ebp)
+  801840:	ff 75 dc             	push   -0x24(%ebp)
+  801843:	ff 75 d8             	push   -0x28(%ebp)
+  801846:	e8 a5 0a 00 00       	call   8022f0 <__udivdi3>
+  80184b:	83 c4 18             	add    $0x18,%esp
+  80184e:	52                   	push   %edx
+  80184f:	50                   	push   %eax
+  801850:	89 f2                	mov    %esi,%edx
+  801852:	89 f8                	mov    %edi,%eax
+  801854:	e8 9f ff ff ff       	call   8017f8 <printnum>
+  801859:	83 c4 20             	add    $0x20,%esp
+  80185c:	eb 13                	jmp    801871 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80185e:	83 ec 08             	sub    $0x8,%esp
+  801861:	56                   	push   %esi
+  801862:	ff 75 18             	push   0x18(%ebp)
+  801865:	ff d7                	call   *%edi
+  801867:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80186a:	83 eb 01             	sub    $0x1,%ebx
+  80186d:	85 db                	test   %ebx,%ebx
+  80186f:	7f ed                	jg     80185e <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801871:	83 ec 08             	sub    $0x8,%esp
+  801874:	56                   	push   %esi
+  801875:	83 ec 04             	sub    $0x4,%esp
+  801878:	ff 75 e4             	push   -0x1c(%ebp)
+  80187b:	ff 75 e0             	push   -0x20(%ebp)
+  80187e:	ff 75 dc             	push   -0x24(%ebp)
+  801881:	ff 75 d8             	push   -0x28(%ebp)
+  801884:	e8 27 0b 00 00       	call   8023b0 <__umoddi3>
+  801889:	83 c4 14             	add    $0x14,%esp
+  80188c:	0f be 80 e3 27 80 00 	movsbl 0x8027e3(%eax),%eax
+  801893:	50                   	push   %eax
+  801894:	ff d7                	call   *%edi
+}
+  801896:	83 c4 10             	add    $0x10,%esp
+  801899:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80189c:	5b                   	pop    %ebx
+  80189d:	5e                   	pop    %esi
+  80189e:	5f                   	pop    %edi
+  80189f:	5d                   	pop    %ebp
+  8018a0:	c3                   	ret
+
+008018a1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018a1:	55                   	push   %ebp
+  8018a2:	89 e5                	mov    %esp,%ebp
+  8018a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018a7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018ab:	8b 10                	mov    (%eax),%edx
+  8018ad:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018b0:	73 0a                	jae    8018bc <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018b2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018b5:	89 08                	mov    %ecx,(%eax)
+  8018b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ba:	88 02                	mov    %al,(%edx)
+}
+  8018bc:	5d                   	pop    %ebp
+  8018bd:	c3                   	ret
+
+008018be <printfmt>:
+{
+  8018be:	55                   	push   %ebp
+  8018bf:	89 e5                	mov    %esp,%ebp
+  8018c1:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018c4:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018c7:	50                   	push   %eax
+  8018c8:	ff 75 10             	push   0x10(%ebp)
+  8018cb:	ff 75 0c             	push   0xc(%ebp)
+  8018ce:	ff 75 08             	push   0x8(%ebp)
+  8018d1:	e8 05 00 00 00       	call   8018db <vprintfmt>
+}
+  8018d6:	83 c4 10             	add    $0x10,%esp
+  8018d9:	c9                   	leave
+  8018da:	c3                   	ret
+
+008018db <vprintfmt>:
+{
+  8018db:	55                   	push   %ebp
+  8018dc:	89 e5                	mov    %esp,%ebp
+  8018de:	57                   	push   %edi
+  8018df:	56                   	push   %esi
+  8018e0:	53                   	push   %ebx
+  8018e1:	83 ec 2c             	sub    $0x2c,%esp
+  8018e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018ea:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8018ed:	eb 0a                	jmp    8018f9 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8018ef:	83 ec 08             	sub    $0x8,%esp
+  8018f2:	53                   	push   %ebx
+  8018f3:	50                   	push   %eax
+  8018f4:	ff d6                	call   *%esi
+  8018f6:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8018f9:	83 c7 01             	add    $0x1,%edi
+  8018fc:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801900:	83 f8 25             	cmp    $0x25,%eax
+  801903:	74 0c                	je     801911 <vprintfmt+0x36>
+			if (ch == '\0')
+  801905:	85 c0                	test   %eax,%eax
+  801907:	75 e6                	jne    8018ef <vprintfmt+0x14>
+}
+  801909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80190c:	5b                   	pop    %ebx
+  80190d:	5e                   	pop    %esi
+  80190e:	5f                   	pop    %edi
+  80190f:	5d                   	pop    %ebp
+  801910:	c3                   	ret
+		padc = ' ';
+  801911:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801915:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80191c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801923:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80192a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80192f:	8d 47 01             	lea    0x1(%edi),%eax
+  801932:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801935:	0f b6 17             	movzbl (%edi),%edx
+  801938:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80193b:	3c 55                	cmp    $0x55,%al
+  80193d:	0f 87 cf 03 00 00    	ja     801d12 <vprintfmt+0x437>
+  801943:	0f b6 c0             	movzbl %al,%eax
+  801946:	ff 24 85 20 29 80 00 	jmp    *0x802920(,%eax,4)
+  80194d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801950:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801954:	eb d9                	jmp    80192f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801956:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801959:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80195d:	eb d0                	jmp    80192f <vprintfmt+0x54>
+  80195f:	0f b6 d2             	movzbl %dl,%edx
+  801962:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801965:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80196d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801970:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801974:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801977:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80197a:	83 f9 09             	cmp    $0x9,%ecx
+  80197d:	77 55                	ja     8019d4 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80197f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801982:	eb e9                	jmp    80196d <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801984:	8b 45 14             	mov    0x14(%ebp),%eax
+  801987:	8b 00                	mov    (%eax),%eax
+  801989:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80198c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80198f:	8d 40 04             	lea    0x4(%eax),%eax
+  801992:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801995:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801998:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80199c:	79 91                	jns    80192f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80199e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019a1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019a4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019ab:	eb 82                	jmp    80192f <vprintfmt+0x54>
+			if (width < 0)
+  8019ad:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019b0:	85 d2                	test   %edx,%edx
+  8019b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b7:	0f 49 c2             	cmovns %edx,%eax
+  8019ba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019c0:	e9 6a ff ff ff       	jmp    80192f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019c8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019cf:	e9 5b ff ff ff       	jmp    80192f <vprintfmt+0x54>
+  8019d4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019d7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019da:	eb bc                	jmp    801998 <vprintfmt+0xbd>
+			lflag++;
+  8019dc:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019e2:	e9 48 ff ff ff       	jmp    80192f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019ea:	8d 78 04             	lea    0x4(%eax),%edi
+  8019ed:	83 ec 08             	sub    $0x8,%esp
+  8019f0:	53                   	push   %ebx
+  8019f1:	ff 30                	push   (%eax)
+  8019f3:	ff d6                	call   *%esi
+			break;
+  8019f5:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8019f8:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8019fb:	e9 b1 02 00 00       	jmp    801cb1 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801a00:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a03:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a06:	8b 10                	mov    (%eax),%edx
+  801a08:	89 d0                	mov    %edx,%eax
+  801a0a:	f7 d8                	neg    %eax
+  801a0c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a0f:	83 f8 0f             	cmp    $0xf,%eax
+  801a12:	7f 23                	jg     801a37 <vprintfmt+0x15c>
+  801a14:	8b 14 85 80 2a 80 00 	mov    0x802a80(,%eax,4),%edx
+  801a1b:	85 d2                	test   %edx,%edx
+  801a1d:	74 18                	je     801a37 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a1f:	52                   	push   %edx
+  801a20:	68 41 27 80 00       	push   $0x802741
+  801a25:	53                   	push   %ebx
+  801a26:	56                   	push   %esi
+  801a27:	e8 92 fe ff ff       	call   8018be <printfmt>
+  801a2c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a2f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a32:	e9 7a 02 00 00       	jmp    801cb1 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801a37:	50                   	push   %eax
+  801a38:	68 fb 27 80 00       	push   $0x8027fb
+  801a3d:	53                   	push   %ebx
+  801a3e:	56                   	push   %esi
+  801a3f:	e8 7a fe ff ff       	call   8018be <printfmt>
+  801a44:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a47:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a4a:	e9 62 02 00 00       	jmp    801cb1 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a4f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a52:	83 c0 04             	add    $0x4,%eax
+  801a55:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a58:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a5b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a5d:	85 c9                	test   %ecx,%ecx
+  801a5f:	b8 f4 27 80 00       	mov    $0x8027f4,%eax
+  801a64:	0f 45 c1             	cmovne %ecx,%eax
+  801a67:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a6a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a6e:	7e 06                	jle    801a76 <vprintfmt+0x19b>
+  801a70:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a74:	75 0b                	jne    801a81 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a76:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a79:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a7c:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a7f:	eb 5c                	jmp    801add <vprintfmt+0x202>
+  801a81:	83 ec 08             	sub    $0x8,%esp
+  801a84:	ff 75 d0             	push   -0x30(%ebp)
+  801a87:	ff 75 cc             	push   -0x34(%ebp)
+  801a8a:	e8 20 03 00 00       	call   801daf <strnlen>
+  801a8f:	89 c2                	mov    %eax,%edx
+  801a91:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a94:	29 d0                	sub    %edx,%eax
+  801a96:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801a99:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801a9d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801aa0:	89 75 08             	mov    %esi,0x8(%ebp)
+  801aa3:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aa5:	eb 0e                	jmp    801ab5 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801aa7:	83 ec 08             	sub    $0x8,%esp
+  801aaa:	53                   	push   %ebx
+  801aab:	57                   	push   %edi
+  801aac:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aaf:	83 ee 01             	sub    $0x1,%esi
+  801ab2:	83 c4 10             	add    $0x10,%esp
+  801ab5:	85 f6                	test   %esi,%esi
+  801ab7:	7f ee                	jg     801aa7 <vprintfmt+0x1cc>
+  801ab9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801abc:	8b 75 08             	mov    0x8(%ebp),%esi
+  801abf:	85 c0                	test   %eax,%eax
+  801ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac6:	0f 49 d0             	cmovns %eax,%edx
+  801ac9:	29 d0                	sub    %edx,%eax
+  801acb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ace:	eb a6                	jmp    801a76 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ad0:	83 ec 08             	sub    $0x8,%esp
+  801ad3:	53                   	push   %ebx
+  801ad4:	52                   	push   %edx
+  801ad5:	ff 55 08             	call   *0x8(%ebp)
+  801ad8:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801adb:	89 f1                	mov    %esi,%ecx
+  801add:	8d 71 01             	lea    0x1(%ecx),%esi
+  801ae0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801ae4:	0f be d0             	movsbl %al,%edx
+  801ae7:	85 d2                	test   %edx,%edx
+  801ae9:	74 28                	je     801b13 <vprintfmt+0x238>
+  801aeb:	85 ff                	test   %edi,%edi
+  801aed:	78 05                	js     801af4 <vprintfmt+0x219>
+  801aef:	83 ef 01             	sub    $0x1,%edi
+  801af2:	78 30                	js     801b24 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801af4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801af8:	74 d6                	je     801ad0 <vprintfmt+0x1f5>
+  801afa:	0f be c0             	movsbl %al,%eax
+  801afd:	83 e8 20             	sub    $0x20,%eax
+  801b00:	83 f8 5e             	cmp    $0x5e,%eax
+  801b03:	76 cb                	jbe    801ad0 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b05:	83 ec 08             	sub    $0x8,%esp
+  801b08:	53                   	push   %ebx
+  801b09:	6a 3f                	push   $0x3f
+  801b0b:	ff 55 08             	call   *0x8(%ebp)
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	eb c8                	jmp    801adb <vprintfmt+0x200>
+  801b13:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b16:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b19:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b1c:	01 d0                	add    %edx,%eax
+  801b1e:	29 c8                	sub    %ecx,%eax
+  801b20:	89 c7                	mov    %eax,%edi
+  801b22:	eb 13                	jmp    801b37 <vprintfmt+0x25c>
+  801b24:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b27:	eb ed                	jmp    801b16 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b29:	83 ec 08             	sub    $0x8,%esp
+  801b2c:	53                   	push   %ebx
+  801b2d:	6a 20                	push   $0x20
+  801b2f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b31:	83 ef 01             	sub    $0x1,%edi
+  801b34:	83 c4 10             	add    $0x10,%esp
+  801b37:	85 ff                	test   %edi,%edi
+  801b39:	7f ee                	jg     801b29 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b3b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b3e:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b41:	e9 6b 01 00 00       	jmp    801cb1 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801b46:	83 f9 01             	cmp    $0x1,%ecx
+  801b49:	7f 1f                	jg     801b6a <vprintfmt+0x28f>
+	else if (lflag)
+  801b4b:	85 c9                	test   %ecx,%ecx
+  801b4d:	74 67                	je     801bb6 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801b4f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b52:	8b 00                	mov    (%eax),%eax
+  801b54:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b57:	89 c1                	mov    %eax,%ecx
+  801b59:	c1 f9 1f             	sar    $0x1f,%ecx
+  801b5c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801b5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b62:	8d 40 04             	lea    0x4(%eax),%eax
+  801b65:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b68:	eb 17                	jmp    801b81 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801b6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b6d:	8b 50 04             	mov    0x4(%eax),%edx
+  801b70:	8b 00                	mov    (%eax),%eax
+  801b72:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b75:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b78:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b7b:	8d 40 08             	lea    0x8(%eax),%eax
+  801b7e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b81:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b84:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b87:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801b8c:	85 c9                	test   %ecx,%ecx
+  801b8e:	0f 89 03 01 00 00    	jns    801c97 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  801b94:	83 ec 08             	sub    $0x8,%esp
+  801b97:	53                   	push   %ebx
+  801b98:	6a 2d                	push   $0x2d
+  801b9a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801b9c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b9f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801ba2:	f7 da                	neg    %edx
+  801ba4:	83 d1 00             	adc    $0x0,%ecx
+  801ba7:	f7 d9                	neg    %ecx
+  801ba9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bac:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bb1:	e9 e1 00 00 00       	jmp    801c97 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  801bb6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bb9:	8b 00                	mov    (%eax),%eax
+  801bbb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bbe:	89 c1                	mov    %eax,%ecx
+  801bc0:	c1 f9 1f             	sar    $0x1f,%ecx
+  801bc3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801bc6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bc9:	8d 40 04             	lea    0x4(%eax),%eax
+  801bcc:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bcf:	eb b0                	jmp    801b81 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801bd1:	83 f9 01             	cmp    $0x1,%ecx
+  801bd4:	7f 1e                	jg     801bf4 <vprintfmt+0x319>
+	else if (lflag)
+  801bd6:	85 c9                	test   %ecx,%ecx
+  801bd8:	74 32                	je     801c0c <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  801bda:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bdd:	8b 10                	mov    (%eax),%edx
+  801bdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be4:	8d 40 04             	lea    0x4(%eax),%eax
+  801be7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bea:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801bef:	e9 a3 00 00 00       	jmp    801c97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801bf4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bf7:	8b 10                	mov    (%eax),%edx
+  801bf9:	8b 48 04             	mov    0x4(%eax),%ecx
+  801bfc:	8d 40 08             	lea    0x8(%eax),%eax
+  801bff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c02:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c07:	e9 8b 00 00 00       	jmp    801c97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c0c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c0f:	8b 10                	mov    (%eax),%edx
+  801c11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c16:	8d 40 04             	lea    0x4(%eax),%eax
+  801c19:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c1c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c21:	eb 74                	jmp    801c97 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  801c23:	83 f9 01             	cmp    $0x1,%ecx
+  801c26:	7f 1b                	jg     801c43 <vprintfmt+0x368>
+	else if (lflag)
+  801c28:	85 c9                	test   %ecx,%ecx
+  801c2a:	74 2c                	je     801c58 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  801c2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c2f:	8b 10                	mov    (%eax),%edx
+  801c31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c36:	8d 40 04             	lea    0x4(%eax),%eax
+  801c39:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c3c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  801c41:	eb 54                	jmp    801c97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801c43:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c46:	8b 10                	mov    (%eax),%edx
+  801c48:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c4b:	8d 40 08             	lea    0x8(%eax),%eax
+  801c4e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c51:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  801c56:	eb 3f                	jmp    801c97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801c58:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c5b:	8b 10                	mov    (%eax),%edx
+  801c5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c62:	8d 40 04             	lea    0x4(%eax),%eax
+  801c65:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801c68:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  801c6d:	eb 28                	jmp    801c97 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  801c6f:	83 ec 08             	sub    $0x8,%esp
+  801c72:	53                   	push   %ebx
+  801c73:	6a 30                	push   $0x30
+  801c75:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c77:	83 c4 08             	add    $0x8,%esp
+  801c7a:	53                   	push   %ebx
+  801c7b:	6a 78                	push   $0x78
+  801c7d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c82:	8b 10                	mov    (%eax),%edx
+  801c84:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801c89:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801c8c:	8d 40 04             	lea    0x4(%eax),%eax
+  801c8f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801c92:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801c97:	83 ec 0c             	sub    $0xc,%esp
+  801c9a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801c9e:	50                   	push   %eax
+  801c9f:	ff 75 e0             	push   -0x20(%ebp)
+  801ca2:	57                   	push   %edi
+  801ca3:	51                   	push   %ecx
+  801ca4:	52                   	push   %edx
+  801ca5:	89 da                	mov    %ebx,%edx
+  801ca7:	89 f0                	mov    %esi,%eax
+  801ca9:	e8 4a fb ff ff       	call   8017f8 <printnum>
+			break;
+  801cae:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801cb1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801cb4:	e9 40 fc ff ff       	jmp    8018f9 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801cb9:	83 f9 01             	cmp    $0x1,%ecx
+  801cbc:	7f 1b                	jg     801cd9 <vprintfmt+0x3fe>
+	else if (lflag)
+  801cbe:	85 c9                	test   %ecx,%ecx
+  801cc0:	74 2c                	je     801cee <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  801cc2:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cc5:	8b 10                	mov    (%eax),%edx
+  801cc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ccc:	8d 40 04             	lea    0x4(%eax),%eax
+  801ccf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cd2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801cd7:	eb be                	jmp    801c97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801cd9:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cdc:	8b 10                	mov    (%eax),%edx
+  801cde:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ce1:	8d 40 08             	lea    0x8(%eax),%eax
+  801ce4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ce7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801cec:	eb a9                	jmp    801c97 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801cee:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf1:	8b 10                	mov    (%eax),%edx
+  801cf3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cf8:	8d 40 04             	lea    0x4(%eax),%eax
+  801cfb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cfe:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d03:	eb 92                	jmp    801c97 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  801d05:	83 ec 08             	sub    $0x8,%esp
+  801d08:	53                   	push   %ebx
+  801d09:	6a 25                	push   $0x25
+  801d0b:	ff d6                	call   *%esi
+			break;
+  801d0d:	83 c4 10             	add    $0x10,%esp
+  801d10:	eb 9f                	jmp    801cb1 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  801d12:	83 ec 08             	sub    $0x8,%esp
+  801d15:	53                   	push   %ebx
+  801d16:	6a 25                	push   $0x25
+  801d18:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d1a:	83 c4 10             	add    $0x10,%esp
+  801d1d:	89 f8                	mov    %edi,%eax
+  801d1f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d23:	74 05                	je     801d2a <vprintfmt+0x44f>
+  801d25:	83 e8 01             	sub    $0x1,%eax
+  801d28:	eb f5                	jmp    801d1f <vprintfmt+0x444>
+  801d2a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d2d:	eb 82                	jmp    801cb1 <vprintfmt+0x3d6>
+
+00801d2f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d2f:	55                   	push   %ebp
+  801d30:	89 e5                	mov    %esp,%ebp
+  801d32:	83 ec 18             	sub    $0x18,%esp
+  801d35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d38:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d3b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d3e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d42:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d45:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d4c:	85 c0                	test   %eax,%eax
+  801d4e:	74 26                	je     801d76 <vsnprintf+0x47>
+  801d50:	85 d2                	test   %edx,%edx
+  801d52:	7e 22                	jle    801d76 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d54:	ff 75 14             	push   0x14(%ebp)
+  801d57:	ff 75 10             	push   0x10(%ebp)
+  801d5a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d5d:	50                   	push   %eax
+  801d5e:	68 a1 18 80 00       	push   $0x8018a1
+  801d63:	e8 73 fb ff ff       	call   8018db <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d68:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d6b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d71:	83 c4 10             	add    $0x10,%esp
+}
+  801d74:	c9                   	leave
+  801d75:	c3                   	ret
+		return -E_INVAL;
+  801d76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d7b:	eb f7                	jmp    801d74 <vsnprintf+0x45>
+
+00801d7d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d7d:	55                   	push   %ebp
+  801d7e:	89 e5                	mov    %esp,%ebp
+  801d80:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d83:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d86:	50                   	push   %eax
+  801d87:	ff 75 10             	push   0x10(%ebp)
+  801d8a:	ff 75 0c             	push   0xc(%ebp)
+  801d8d:	ff 75 08             	push   0x8(%ebp)
+  801d90:	e8 9a ff ff ff       	call   801d2f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801d95:	c9                   	leave
+  801d96:	c3                   	ret
+
+00801d97 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801d97:	55                   	push   %ebp
+  801d98:	89 e5                	mov    %esp,%ebp
+  801d9a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da2:	eb 03                	jmp    801da7 <strlen+0x10>
+		n++;
+  801da4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801da7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801dab:	75 f7                	jne    801da4 <strlen+0xd>
+	return n;
+}
+  801dad:	5d                   	pop    %ebp
+  801dae:	c3                   	ret
+
+00801daf <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801daf:	55                   	push   %ebp
+  801db0:	89 e5                	mov    %esp,%ebp
+  801db2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801db5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801db8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dbd:	eb 03                	jmp    801dc2 <strnlen+0x13>
+		n++;
+  801dbf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dc2:	39 d0                	cmp    %edx,%eax
+  801dc4:	74 08                	je     801dce <strnlen+0x1f>
+  801dc6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801dca:	75 f3                	jne    801dbf <strnlen+0x10>
+  801dcc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801dce:	89 d0                	mov    %edx,%eax
+  801dd0:	5d                   	pop    %ebp
+  801dd1:	c3                   	ret
+
+00801dd2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801dd2:	55                   	push   %ebp
+  801dd3:	89 e5                	mov    %esp,%ebp
+  801dd5:	53                   	push   %ebx
+  801dd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801dd9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801de5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801de8:	83 c0 01             	add    $0x1,%eax
+  801deb:	84 d2                	test   %dl,%dl
+  801ded:	75 f2                	jne    801de1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801def:	89 c8                	mov    %ecx,%eax
+  801df1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801df4:	c9                   	leave
+  801df5:	c3                   	ret
+
+00801df6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801df6:	55                   	push   %ebp
+  801df7:	89 e5                	mov    %esp,%ebp
+  801df9:	53                   	push   %ebx
+  801dfa:	83 ec 10             	sub    $0x10,%esp
+  801dfd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e00:	53                   	push   %ebx
+  801e01:	e8 91 ff ff ff       	call   801d97 <strlen>
+  801e06:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e09:	ff 75 0c             	push   0xc(%ebp)
+  801e0c:	01 d8                	add    %ebx,%eax
+  801e0e:	50                   	push   %eax
+  801e0f:	e8 be ff ff ff       	call   801dd2 <strcpy>
+	return dst;
+}
+  801e14:	89 d8                	mov    %ebx,%eax
+  801e16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e19:	c9                   	leave
+  801e1a:	c3                   	ret
+
+00801e1b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e1b:	55                   	push   %ebp
+  801e1c:	89 e5                	mov    %esp,%ebp
+  801e1e:	56                   	push   %esi
+  801e1f:	53                   	push   %ebx
+  801e20:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e23:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e26:	89 f3                	mov    %esi,%ebx
+  801e28:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e2b:	89 f0                	mov    %esi,%eax
+  801e2d:	eb 0f                	jmp    801e3e <strncpy+0x23>
+		*dst++ = *src;
+  801e2f:	83 c0 01             	add    $0x1,%eax
+  801e32:	0f b6 0a             	movzbl (%edx),%ecx
+  801e35:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e38:	80 f9 01             	cmp    $0x1,%cl
+  801e3b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e3e:	39 d8                	cmp    %ebx,%eax
+  801e40:	75 ed                	jne    801e2f <strncpy+0x14>
+	}
+	return ret;
+}
+  801e42:	89 f0                	mov    %esi,%eax
+  801e44:	5b                   	pop    %ebx
+  801e45:	5e                   	pop    %esi
+  801e46:	5d                   	pop    %ebp
+  801e47:	c3                   	ret
+
+00801e48 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e48:	55                   	push   %ebp
+  801e49:	89 e5                	mov    %esp,%ebp
+  801e4b:	56                   	push   %esi
+  801e4c:	53                   	push   %ebx
+  801e4d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e53:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e56:	89 f0                	mov    %esi,%eax
+  801e58:	85 d2                	test   %edx,%edx
+  801e5a:	74 21                	je     801e7d <strlcpy+0x35>
+  801e5c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e60:	89 f2                	mov    %esi,%edx
+  801e62:	eb 09                	jmp    801e6d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e64:	83 c1 01             	add    $0x1,%ecx
+  801e67:	83 c2 01             	add    $0x1,%edx
+  801e6a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e6d:	39 c2                	cmp    %eax,%edx
+  801e6f:	74 09                	je     801e7a <strlcpy+0x32>
+  801e71:	0f b6 19             	movzbl (%ecx),%ebx
+  801e74:	84 db                	test   %bl,%bl
+  801e76:	75 ec                	jne    801e64 <strlcpy+0x1c>
+  801e78:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e7a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e7d:	29 f0                	sub    %esi,%eax
+}
+  801e7f:	5b                   	pop    %ebx
+  801e80:	5e                   	pop    %esi
+  801e81:	5d                   	pop    %ebp
+  801e82:	c3                   	ret
+
+00801e83 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e83:	55                   	push   %ebp
+  801e84:	89 e5                	mov    %esp,%ebp
+  801e86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e89:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801e8c:	eb 06                	jmp    801e94 <strcmp+0x11>
+		p++, q++;
+  801e8e:	83 c1 01             	add    $0x1,%ecx
+  801e91:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801e94:	0f b6 01             	movzbl (%ecx),%eax
+  801e97:	84 c0                	test   %al,%al
+  801e99:	74 04                	je     801e9f <strcmp+0x1c>
+  801e9b:	3a 02                	cmp    (%edx),%al
+  801e9d:	74 ef                	je     801e8e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801e9f:	0f b6 c0             	movzbl %al,%eax
+  801ea2:	0f b6 12             	movzbl (%edx),%edx
+  801ea5:	29 d0                	sub    %edx,%eax
+}
+  801ea7:	5d                   	pop    %ebp
+  801ea8:	c3                   	ret
+
+00801ea9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ea9:	55                   	push   %ebp
+  801eaa:	89 e5                	mov    %esp,%ebp
+  801eac:	53                   	push   %ebx
+  801ead:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eb3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801eb6:	eb 09                	jmp    801ec1 <strncmp+0x18>
+		n--, p++, q++;
+  801eb8:	83 ea 01             	sub    $0x1,%edx
+  801ebb:	83 c0 01             	add    $0x1,%eax
+  801ebe:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ec1:	85 d2                	test   %edx,%edx
+  801ec3:	74 18                	je     801edd <strncmp+0x34>
+  801ec5:	0f b6 18             	movzbl (%eax),%ebx
+  801ec8:	84 db                	test   %bl,%bl
+  801eca:	74 04                	je     801ed0 <strncmp+0x27>
+  801ecc:	3a 19                	cmp    (%ecx),%bl
+  801ece:	74 e8                	je     801eb8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ed0:	0f b6 00             	movzbl (%eax),%eax
+  801ed3:	0f b6 11             	movzbl (%ecx),%edx
+  801ed6:	29 d0                	sub    %edx,%eax
+}
+  801ed8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801edb:	c9                   	leave
+  801edc:	c3                   	ret
+		return 0;
+  801edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee2:	eb f4                	jmp    801ed8 <strncmp+0x2f>
+
+00801ee4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801ee4:	55                   	push   %ebp
+  801ee5:	89 e5                	mov    %esp,%ebp
+  801ee7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eea:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801eee:	eb 03                	jmp    801ef3 <strchr+0xf>
+  801ef0:	83 c0 01             	add    $0x1,%eax
+  801ef3:	0f b6 10             	movzbl (%eax),%edx
+  801ef6:	84 d2                	test   %dl,%dl
+  801ef8:	74 06                	je     801f00 <strchr+0x1c>
+		if (*s == c)
+  801efa:	38 ca                	cmp    %cl,%dl
+  801efc:	75 f2                	jne    801ef0 <strchr+0xc>
+  801efe:	eb 05                	jmp    801f05 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f05:	5d                   	pop    %ebp
+  801f06:	c3                   	ret
+
+00801f07 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f07:	55                   	push   %ebp
+  801f08:	89 e5                	mov    %esp,%ebp
+  801f0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f11:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f14:	38 ca                	cmp    %cl,%dl
+  801f16:	74 09                	je     801f21 <strfind+0x1a>
+  801f18:	84 d2                	test   %dl,%dl
+  801f1a:	74 05                	je     801f21 <strfind+0x1a>
+	for (; *s; s++)
+  801f1c:	83 c0 01             	add    $0x1,%eax
+  801f1f:	eb f0                	jmp    801f11 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f21:	5d                   	pop    %ebp
+  801f22:	c3                   	ret
+
+00801f23 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f23:	55                   	push   %ebp
+  801f24:	89 e5                	mov    %esp,%ebp
+  801f26:	57                   	push   %edi
+  801f27:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f2a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f2d:	85 c9                	test   %ecx,%ecx
+  801f2f:	74 20                	je     801f51 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f31:	89 f8                	mov    %edi,%eax
+  801f33:	09 c8                	or     %ecx,%eax
+  801f35:	a8 03                	test   $0x3,%al
+  801f37:	75 12                	jne    801f4b <memset+0x28>
+		c &= 0xFF;
+  801f39:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f3d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f43:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f46:	fc                   	cld
+  801f47:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f49:	eb 06                	jmp    801f51 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f4e:	fc                   	cld
+  801f4f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f51:	89 f8                	mov    %edi,%eax
+  801f53:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f56:	c9                   	leave
+  801f57:	c3                   	ret
+
+00801f58 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f58:	55                   	push   %ebp
+  801f59:	89 e5                	mov    %esp,%ebp
+  801f5b:	57                   	push   %edi
+  801f5c:	56                   	push   %esi
+  801f5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f60:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f63:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f66:	39 c6                	cmp    %eax,%esi
+  801f68:	73 32                	jae    801f9c <memmove+0x44>
+  801f6a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f6d:	39 d0                	cmp    %edx,%eax
+  801f6f:	73 2b                	jae    801f9c <memmove+0x44>
+		s += n;
+		d += n;
+  801f71:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f74:	89 d6                	mov    %edx,%esi
+  801f76:	09 fe                	or     %edi,%esi
+  801f78:	09 ce                	or     %ecx,%esi
+  801f7a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f80:	75 0e                	jne    801f90 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f82:	83 ef 04             	sub    $0x4,%edi
+  801f85:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f88:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f8b:	fd                   	std
+  801f8c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f8e:	eb 09                	jmp    801f99 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801f90:	83 ef 01             	sub    $0x1,%edi
+  801f93:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801f96:	fd                   	std
+  801f97:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801f99:	fc                   	cld
+  801f9a:	eb 1a                	jmp    801fb6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f9c:	89 f2                	mov    %esi,%edx
+  801f9e:	09 c2                	or     %eax,%edx
+  801fa0:	09 ca                	or     %ecx,%edx
+  801fa2:	f6 c2 03             	test   $0x3,%dl
+  801fa5:	75 0a                	jne    801fb1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fa7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801faa:	89 c7                	mov    %eax,%edi
+  801fac:	fc                   	cld
+  801fad:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801faf:	eb 05                	jmp    801fb6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fb1:	89 c7                	mov    %eax,%edi
+  801fb3:	fc                   	cld
+  801fb4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fb6:	5e                   	pop    %esi
+  801fb7:	5f                   	pop    %edi
+  801fb8:	5d                   	pop    %ebp
+  801fb9:	c3                   	ret
+
+00801fba <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fba:	55                   	push   %ebp
+  801fbb:	89 e5                	mov    %esp,%ebp
+  801fbd:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fc0:	ff 75 10             	push   0x10(%ebp)
+  801fc3:	ff 75 0c             	push   0xc(%ebp)
+  801fc6:	ff 75 08             	push   0x8(%ebp)
+  801fc9:	e8 8a ff ff ff       	call   801f58 <memmove>
+}
+  801fce:	c9                   	leave
+  801fcf:	c3                   	ret
+
+00801fd0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fd0:	55                   	push   %ebp
+  801fd1:	89 e5                	mov    %esp,%ebp
+  801fd3:	56                   	push   %esi
+  801fd4:	53                   	push   %ebx
+  801fd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fdb:	89 c6                	mov    %eax,%esi
+  801fdd:	03 75 10             	add    0x10(%ebp),%esi
+  801fe0:	eb 06                	jmp    801fe8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801fe2:	83 c0 01             	add    $0x1,%eax
+  801fe5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801fe8:	39 f0                	cmp    %esi,%eax
+  801fea:	74 14                	je     802000 <memcmp+0x30>
+		if (*s1 != *s2)
+  801fec:	0f b6 08             	movzbl (%eax),%ecx
+  801fef:	0f b6 1a             	movzbl (%edx),%ebx
+  801ff2:	38 d9                	cmp    %bl,%cl
+  801ff4:	74 ec                	je     801fe2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801ff6:	0f b6 c1             	movzbl %cl,%eax
+  801ff9:	0f b6 db             	movzbl %bl,%ebx
+  801ffc:	29 d8                	sub    %ebx,%eax
+  801ffe:	eb 05                	jmp    802005 <memcmp+0x35>
+	}
+
+	return 0;
+  802000:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802005:	5b                   	pop    %ebx
+  802006:	5e                   	pop    %esi
+  802007:	5d                   	pop    %ebp
+  802008:	c3                   	ret
+
+00802009 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802009:	55                   	push   %ebp
+  80200a:	89 e5                	mov    %esp,%ebp
+  80200c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80200f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802012:	89 c2                	mov    %eax,%edx
+  802014:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802017:	eb 03                	jmp    80201c <memfind+0x13>
+  802019:	83 c0 01             	add    $0x1,%eax
+  80201c:	39 d0                	cmp    %edx,%eax
+  80201e:	73 04                	jae    802024 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802020:	38 08                	cmp    %cl,(%eax)
+  802022:	75 f5                	jne    802019 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802024:	5d                   	pop    %ebp
+  802025:	c3                   	ret
+
+00802026 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802026:	55                   	push   %ebp
+  802027:	89 e5                	mov    %esp,%ebp
+  802029:	57                   	push   %edi
+  80202a:	56                   	push   %esi
+  80202b:	53                   	push   %ebx
+  80202c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80202f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802032:	eb 03                	jmp    802037 <strtol+0x11>
+		s++;
+  802034:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802037:	0f b6 02             	movzbl (%edx),%eax
+  80203a:	3c 20                	cmp    $0x20,%al
+  80203c:	74 f6                	je     802034 <strtol+0xe>
+  80203e:	3c 09                	cmp    $0x9,%al
+  802040:	74 f2                	je     802034 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802042:	3c 2b                	cmp    $0x2b,%al
+  802044:	74 2a                	je     802070 <strtol+0x4a>
+	int neg = 0;
+  802046:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80204b:	3c 2d                	cmp    $0x2d,%al
+  80204d:	74 2b                	je     80207a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80204f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802055:	75 0f                	jne    802066 <strtol+0x40>
+  802057:	80 3a 30             	cmpb   $0x30,(%edx)
+  80205a:	74 28                	je     802084 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80205c:	85 db                	test   %ebx,%ebx
+  80205e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802063:	0f 44 d8             	cmove  %eax,%ebx
+  802066:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80206b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80206e:	eb 46                	jmp    8020b6 <strtol+0x90>
+		s++;
+  802070:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802073:	bf 00 00 00 00       	mov    $0x0,%edi
+  802078:	eb d5                	jmp    80204f <strtol+0x29>
+		s++, neg = 1;
+  80207a:	83 c2 01             	add    $0x1,%edx
+  80207d:	bf 01 00 00 00       	mov    $0x1,%edi
+  802082:	eb cb                	jmp    80204f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802084:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802088:	74 0e                	je     802098 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80208a:	85 db                	test   %ebx,%ebx
+  80208c:	75 d8                	jne    802066 <strtol+0x40>
+		s++, base = 8;
+  80208e:	83 c2 01             	add    $0x1,%edx
+  802091:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802096:	eb ce                	jmp    802066 <strtol+0x40>
+		s += 2, base = 16;
+  802098:	83 c2 02             	add    $0x2,%edx
+  80209b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020a0:	eb c4                	jmp    802066 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020a2:	0f be c0             	movsbl %al,%eax
+  8020a5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020a8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020ab:	7d 3a                	jge    8020e7 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020ad:	83 c2 01             	add    $0x1,%edx
+  8020b0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020b4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020b6:	0f b6 02             	movzbl (%edx),%eax
+  8020b9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020bc:	89 f3                	mov    %esi,%ebx
+  8020be:	80 fb 09             	cmp    $0x9,%bl
+  8020c1:	76 df                	jbe    8020a2 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020c3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020c6:	89 f3                	mov    %esi,%ebx
+  8020c8:	80 fb 19             	cmp    $0x19,%bl
+  8020cb:	77 08                	ja     8020d5 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020cd:	0f be c0             	movsbl %al,%eax
+  8020d0:	83 e8 57             	sub    $0x57,%eax
+  8020d3:	eb d3                	jmp    8020a8 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020d5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020d8:	89 f3                	mov    %esi,%ebx
+  8020da:	80 fb 19             	cmp    $0x19,%bl
+  8020dd:	77 08                	ja     8020e7 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020df:	0f be c0             	movsbl %al,%eax
+  8020e2:	83 e8 37             	sub    $0x37,%eax
+  8020e5:	eb c1                	jmp    8020a8 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020e7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020eb:	74 05                	je     8020f2 <strtol+0xcc>
+		*endptr = (char *) s;
+  8020ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020f0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8020f2:	89 c8                	mov    %ecx,%eax
+  8020f4:	f7 d8                	neg    %eax
+  8020f6:	85 ff                	test   %edi,%edi
+  8020f8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8020fb:	89 c8                	mov    %ecx,%eax
+  8020fd:	5b                   	pop    %ebx
+  8020fe:	5e                   	pop    %esi
+  8020ff:	5f                   	pop    %edi
+  802100:	5d                   	pop    %ebp
+  802101:	c3                   	ret
+
+00802102 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802102:	55                   	push   %ebp
+  802103:	89 e5                	mov    %esp,%ebp
+  802105:	57                   	push   %edi
+  802106:	56                   	push   %esi
+  802107:	53                   	push   %ebx
+  802108:	83 ec 18             	sub    $0x18,%esp
+  80210b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80210e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802111:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802114:	85 db                	test   %ebx,%ebx
+  802116:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80211b:	0f 45 c3             	cmovne %ebx,%eax
+  80211e:	50                   	push   %eax
+  80211f:	e8 32 e4 ff ff       	call   800556 <sys_ipc_recv>
+
+	if (from_env_store)
+  802124:	83 c4 10             	add    $0x10,%esp
+  802127:	85 ff                	test   %edi,%edi
+  802129:	74 17                	je     802142 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80212b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802130:	85 c0                	test   %eax,%eax
+  802132:	75 0c                	jne    802140 <ipc_recv+0x3e>
+  802134:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80213a:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802140:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802142:	85 f6                	test   %esi,%esi
+  802144:	74 2e                	je     802174 <ipc_recv+0x72>
+		if (!r && pg)
+  802146:	85 c0                	test   %eax,%eax
+  802148:	75 24                	jne    80216e <ipc_recv+0x6c>
+  80214a:	85 db                	test   %ebx,%ebx
+  80214c:	74 20                	je     80216e <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  80214e:	a1 08 40 80 00       	mov    0x804008,%eax
+  802153:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802159:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80215b:	a1 08 40 80 00       	mov    0x804008,%eax
+  802160:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802166:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802169:	5b                   	pop    %ebx
+  80216a:	5e                   	pop    %esi
+  80216b:	5f                   	pop    %edi
+  80216c:	5d                   	pop    %ebp
+  80216d:	c3                   	ret
+			*perm_store = 0;
+  80216e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802174:	85 c0                	test   %eax,%eax
+  802176:	75 ee                	jne    802166 <ipc_recv+0x64>
+  802178:	eb e1                	jmp    80215b <ipc_recv+0x59>
+
+0080217a <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80217a:	55                   	push   %ebp
+  80217b:	89 e5                	mov    %esp,%ebp
+  80217d:	57                   	push   %edi
+  80217e:	56                   	push   %esi
+  80217f:	53                   	push   %ebx
+  802180:	83 ec 0c             	sub    $0xc,%esp
+  802183:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802186:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802189:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80218c:	85 db                	test   %ebx,%ebx
+  80218e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802193:	0f 44 d8             	cmove  %eax,%ebx
+  802196:	ff 75 14             	push   0x14(%ebp)
+  802199:	53                   	push   %ebx
+  80219a:	56                   	push   %esi
+  80219b:	57                   	push   %edi
+  80219c:	e8 92 e3 ff ff       	call   800533 <sys_ipc_try_send_yield>
+  8021a1:	83 c4 10             	add    $0x10,%esp
+  8021a4:	85 c0                	test   %eax,%eax
+  8021a6:	79 1e                	jns    8021c6 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8021a8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021ab:	75 07                	jne    8021b4 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8021ad:	e8 a1 df ff ff       	call   800153 <sys_yield>
+  8021b2:	eb e2                	jmp    802196 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8021b4:	50                   	push   %eax
+  8021b5:	68 df 2a 80 00       	push   $0x802adf
+  8021ba:	6a 3d                	push   $0x3d
+  8021bc:	68 f4 2a 80 00       	push   $0x802af4
+  8021c1:	e8 43 f5 ff ff       	call   801709 <_panic>
+	}
+}
+  8021c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021c9:	5b                   	pop    %ebx
+  8021ca:	5e                   	pop    %esi
+  8021cb:	5f                   	pop    %edi
+  8021cc:	5d                   	pop    %ebp
+  8021cd:	c3                   	ret
+
+008021ce <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8021ce:	55                   	push   %ebp
+  8021cf:	89 e5                	mov    %esp,%ebp
+  8021d1:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8021d4:	ff 75 08             	push   0x8(%ebp)
+  8021d7:	e8 f7 de ff ff       	call   8000d3 <sys_env_find>
+}
+  8021dc:	c9                   	leave
+  8021dd:	c3                   	ret
+
+008021de <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8021de:	55                   	push   %ebp
+  8021df:	89 e5                	mov    %esp,%ebp
+  8021e1:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021e4:	89 c2                	mov    %eax,%edx
+  8021e6:	c1 ea 16             	shr    $0x16,%edx
+  8021e9:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8021f0:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021f5:	f6 c1 01             	test   $0x1,%cl
+  8021f8:	74 22                	je     80221c <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8021fa:	c1 e8 0c             	shr    $0xc,%eax
+  8021fd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802204:	a8 01                	test   $0x1,%al
+  802206:	74 14                	je     80221c <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802208:	c1 e8 0c             	shr    $0xc,%eax
+  80220b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80220e:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802215:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802219:	0f b7 d2             	movzwl %dx,%edx
+}
+  80221c:	89 d0                	mov    %edx,%eax
+  80221e:	5d                   	pop    %ebp
+  80221f:	c3                   	ret
+
+00802220 <__udivmoddi4>:
+  802220:	55                   	push   %ebp
+  802221:	57                   	push   %edi
+  802222:	56                   	push   %esi
+  802223:	53                   	push   %ebx
+  802224:	83 ec 14             	sub    $0x14,%esp
+  802227:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80222b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80222f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802233:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802237:	89 f1                	mov    %esi,%ecx
+  802239:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80223d:	09 d9                	or     %ebx,%ecx
+  80223f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802243:	0f 84 92 00 00 00    	je     8022db <__udivmoddi4+0xbb>
+  802249:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802250:	00 
+  802251:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802256:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80225d:	00 
+  80225e:	89 1c 24             	mov    %ebx,(%esp)
+  802261:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802265:	8d 76 00             	lea    0x0(%esi),%esi
+  802268:	89 e9                	mov    %ebp,%ecx
+  80226a:	89 c3                	mov    %eax,%ebx
+  80226c:	89 d6                	mov    %edx,%esi
+  80226e:	31 ff                	xor    %edi,%edi
+  802270:	d3 ee                	shr    %cl,%esi
+  802272:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802275:	f6 c1 20             	test   $0x20,%cl
+  802278:	0f 45 de             	cmovne %esi,%ebx
+  80227b:	0f 45 f7             	cmovne %edi,%esi
+  80227e:	8b 3c 24             	mov    (%esp),%edi
+  802281:	39 fb                	cmp    %edi,%ebx
+  802283:	89 f7                	mov    %esi,%edi
+  802285:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802289:	8b 1c 24             	mov    (%esp),%ebx
+  80228c:	19 f7                	sbb    %esi,%edi
+  80228e:	72 39                	jb     8022c9 <__udivmoddi4+0xa9>
+  802290:	89 e9                	mov    %ebp,%ecx
+  802292:	89 f7                	mov    %esi,%edi
+  802294:	89 de                	mov    %ebx,%esi
+  802296:	0f a5 df             	shld   %cl,%ebx,%edi
+  802299:	d3 e6                	shl    %cl,%esi
+  80229b:	31 db                	xor    %ebx,%ebx
+  80229d:	f6 c1 20             	test   $0x20,%cl
+  8022a0:	0f 45 fe             	cmovne %esi,%edi
+  8022a3:	0f 45 f3             	cmovne %ebx,%esi
+  8022a6:	29 f0                	sub    %esi,%eax
+  8022a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ad:	19 fa                	sbb    %edi,%edx
+  8022af:	31 ff                	xor    %edi,%edi
+  8022b1:	31 db                	xor    %ebx,%ebx
+  8022b3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8022b6:	d3 e6                	shl    %cl,%esi
+  8022b8:	f6 c1 20             	test   $0x20,%cl
+  8022bb:	0f 45 fe             	cmovne %esi,%edi
+  8022be:	0f 45 f3             	cmovne %ebx,%esi
+  8022c1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8022c5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8022c9:	83 ed 01             	sub    $0x1,%ebp
+  8022cc:	73 9a                	jae    802268 <__udivmoddi4+0x48>
+  8022ce:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8022d2:	85 ff                	test   %edi,%edi
+  8022d4:	74 05                	je     8022db <__udivmoddi4+0xbb>
+  8022d6:	89 07                	mov    %eax,(%edi)
+  8022d8:	89 57 04             	mov    %edx,0x4(%edi)
+  8022db:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022df:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022e3:	83 c4 14             	add    $0x14,%esp
+  8022e6:	5b                   	pop    %ebx
+  8022e7:	5e                   	pop    %esi
+  8022e8:	5f                   	pop    %edi
+  8022e9:	5d                   	pop    %ebp
+  8022ea:	c3                   	ret
+  8022eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8022ef:	90                   	nop
+
+008022f0 <__udivdi3>:
+  8022f0:	55                   	push   %ebp
+  8022f1:	57                   	push   %edi
+  8022f2:	56                   	push   %esi
+  8022f3:	53                   	push   %ebx
+  8022f4:	83 ec 14             	sub    $0x14,%esp
+  8022f7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8022fb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8022ff:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802303:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802307:	89 fb                	mov    %edi,%ebx
+  802309:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80230d:	09 f3                	or     %esi,%ebx
+  80230f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802313:	0f 84 85 00 00 00    	je     80239e <__udivdi3+0xae>
+  802319:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802320:	00 
+  802321:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802326:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80232d:	00 
+  80232e:	89 34 24             	mov    %esi,(%esp)
+  802331:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802335:	8d 76 00             	lea    0x0(%esi),%esi
+  802338:	89 e9                	mov    %ebp,%ecx
+  80233a:	89 c3                	mov    %eax,%ebx
+  80233c:	89 d6                	mov    %edx,%esi
+  80233e:	31 ff                	xor    %edi,%edi
+  802340:	d3 ee                	shr    %cl,%esi
+  802342:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802345:	f6 c1 20             	test   $0x20,%cl
+  802348:	0f 45 de             	cmovne %esi,%ebx
+  80234b:	0f 45 f7             	cmovne %edi,%esi
+  80234e:	8b 3c 24             	mov    (%esp),%edi
+  802351:	39 fb                	cmp    %edi,%ebx
+  802353:	89 f7                	mov    %esi,%edi
+  802355:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802359:	8b 1c 24             	mov    (%esp),%ebx
+  80235c:	19 f7                	sbb    %esi,%edi
+  80235e:	72 39                	jb     802399 <__udivdi3+0xa9>
+  802360:	89 e9                	mov    %ebp,%ecx
+  802362:	89 f7                	mov    %esi,%edi
+  802364:	89 de                	mov    %ebx,%esi
+  802366:	0f a5 df             	shld   %cl,%ebx,%edi
+  802369:	d3 e6                	shl    %cl,%esi
+  80236b:	31 db                	xor    %ebx,%ebx
+  80236d:	f6 c1 20             	test   $0x20,%cl
+  802370:	0f 45 fe             	cmovne %esi,%edi
+  802373:	0f 45 f3             	cmovne %ebx,%esi
+  802376:	29 f0                	sub    %esi,%eax
+  802378:	be 01 00 00 00       	mov    $0x1,%esi
+  80237d:	19 fa                	sbb    %edi,%edx
+  80237f:	31 ff                	xor    %edi,%edi
+  802381:	31 db                	xor    %ebx,%ebx
+  802383:	0f a5 f7             	shld   %cl,%esi,%edi
+  802386:	d3 e6                	shl    %cl,%esi
+  802388:	f6 c1 20             	test   $0x20,%cl
+  80238b:	0f 45 fe             	cmovne %esi,%edi
+  80238e:	0f 45 f3             	cmovne %ebx,%esi
+  802391:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802395:	09 74 24 08          	or     %esi,0x8(%esp)
+  802399:	83 ed 01             	sub    $0x1,%ebp
+  80239c:	73 9a                	jae    802338 <__udivdi3+0x48>
+  80239e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023a2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023a6:	83 c4 14             	add    $0x14,%esp
+  8023a9:	5b                   	pop    %ebx
+  8023aa:	5e                   	pop    %esi
+  8023ab:	5f                   	pop    %edi
+  8023ac:	5d                   	pop    %ebp
+  8023ad:	c3                   	ret
+  8023ae:	66 90                	xchg   %ax,%ax
+
+008023b0 <__umoddi3>:
+  8023b0:	57                   	push   %edi
+  8023b1:	56                   	push   %esi
+  8023b2:	53                   	push   %ebx
+  8023b3:	83 ec 08             	sub    $0x8,%esp
+  8023b6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8023ba:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8023be:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023c2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023c6:	89 f9                	mov    %edi,%ecx
+  8023c8:	89 34 24             	mov    %esi,(%esp)
+  8023cb:	09 f1                	or     %esi,%ecx
+  8023cd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023d1:	74 53                	je     802426 <__umoddi3+0x76>
+  8023d3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023df:	90                   	nop
+  8023e0:	89 c6                	mov    %eax,%esi
+  8023e2:	89 d7                	mov    %edx,%edi
+  8023e4:	31 db                	xor    %ebx,%ebx
+  8023e6:	d3 ef                	shr    %cl,%edi
+  8023e8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8023eb:	f6 c1 20             	test   $0x20,%cl
+  8023ee:	0f 45 f7             	cmovne %edi,%esi
+  8023f1:	0f 45 fb             	cmovne %ebx,%edi
+  8023f4:	8b 1c 24             	mov    (%esp),%ebx
+  8023f7:	39 de                	cmp    %ebx,%esi
+  8023f9:	89 fb                	mov    %edi,%ebx
+  8023fb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8023ff:	8b 34 24             	mov    (%esp),%esi
+  802402:	19 fb                	sbb    %edi,%ebx
+  802404:	72 14                	jb     80241a <__umoddi3+0x6a>
+  802406:	0f a5 f7             	shld   %cl,%esi,%edi
+  802409:	31 db                	xor    %ebx,%ebx
+  80240b:	d3 e6                	shl    %cl,%esi
+  80240d:	f6 c1 20             	test   $0x20,%cl
+  802410:	0f 45 fe             	cmovne %esi,%edi
+  802413:	0f 45 f3             	cmovne %ebx,%esi
+  802416:	29 f0                	sub    %esi,%eax
+  802418:	19 fa                	sbb    %edi,%edx
+  80241a:	83 e9 01             	sub    $0x1,%ecx
+  80241d:	73 c1                	jae    8023e0 <__umoddi3+0x30>
+  80241f:	83 c4 08             	add    $0x8,%esp
+  802422:	5b                   	pop    %ebx
+  802423:	5e                   	pop    %esi
+  802424:	5f                   	pop    %edi
+  802425:	c3                   	ret
+  802426:	83 c4 08             	add    $0x8,%esp
+  802429:	31 c0                	xor    %eax,%eax
+  80242b:	31 d2                	xor    %edx,%edx
+  80242d:	5b                   	pop    %ebx
+  80242e:	5e                   	pop    %esi
+  80242f:	5f                   	pop    %edi
+  802430:	c3                   	ret
+  802431:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80243f:	90                   	nop
+
+00802440 <__divdi3>:
+  802440:	55                   	push   %ebp
+  802441:	57                   	push   %edi
+  802442:	56                   	push   %esi
+  802443:	53                   	push   %ebx
+  802444:	83 ec 1c             	sub    $0x1c,%esp
+  802447:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80244b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80244f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802453:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802457:	85 ff                	test   %edi,%edi
+  802459:	0f 88 da 00 00 00    	js     802539 <__divdi3+0xf9>
+  80245f:	85 db                	test   %ebx,%ebx
+  802461:	78 16                	js     802479 <__divdi3+0x39>
+  802463:	89 dd                	mov    %ebx,%ebp
+  802465:	89 c8                	mov    %ecx,%eax
+  802467:	89 da                	mov    %ebx,%edx
+  802469:	09 cd                	or     %ecx,%ebp
+  80246b:	0f 85 fd 00 00 00    	jne    80256e <__divdi3+0x12e>
+  802471:	83 c4 1c             	add    $0x1c,%esp
+  802474:	5b                   	pop    %ebx
+  802475:	5e                   	pop    %esi
+  802476:	5f                   	pop    %edi
+  802477:	5d                   	pop    %ebp
+  802478:	c3                   	ret
+  802479:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80247e:	f7 d9                	neg    %ecx
+  802480:	89 f0                	mov    %esi,%eax
+  802482:	89 fa                	mov    %edi,%edx
+  802484:	83 d3 00             	adc    $0x0,%ebx
+  802487:	89 0c 24             	mov    %ecx,(%esp)
+  80248a:	f7 db                	neg    %ebx
+  80248c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802490:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802497:	00 
+  802498:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80249d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024a4:	00 
+  8024a5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024a9:	89 cd                	mov    %ecx,%ebp
+  8024ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024af:	90                   	nop
+  8024b0:	89 e9                	mov    %ebp,%ecx
+  8024b2:	89 c3                	mov    %eax,%ebx
+  8024b4:	89 d6                	mov    %edx,%esi
+  8024b6:	31 ff                	xor    %edi,%edi
+  8024b8:	d3 ee                	shr    %cl,%esi
+  8024ba:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024bd:	f6 c1 20             	test   $0x20,%cl
+  8024c0:	0f 45 de             	cmovne %esi,%ebx
+  8024c3:	0f 45 f7             	cmovne %edi,%esi
+  8024c6:	8b 3c 24             	mov    (%esp),%edi
+  8024c9:	39 fb                	cmp    %edi,%ebx
+  8024cb:	89 f7                	mov    %esi,%edi
+  8024cd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8024d1:	8b 1c 24             	mov    (%esp),%ebx
+  8024d4:	19 f7                	sbb    %esi,%edi
+  8024d6:	72 39                	jb     802511 <__divdi3+0xd1>
+  8024d8:	89 e9                	mov    %ebp,%ecx
+  8024da:	89 f7                	mov    %esi,%edi
+  8024dc:	89 de                	mov    %ebx,%esi
+  8024de:	0f a5 df             	shld   %cl,%ebx,%edi
+  8024e1:	d3 e6                	shl    %cl,%esi
+  8024e3:	31 db                	xor    %ebx,%ebx
+  8024e5:	f6 c1 20             	test   $0x20,%cl
+  8024e8:	0f 45 fe             	cmovne %esi,%edi
+  8024eb:	0f 45 f3             	cmovne %ebx,%esi
+  8024ee:	29 f0                	sub    %esi,%eax
+  8024f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8024f5:	19 fa                	sbb    %edi,%edx
+  8024f7:	31 ff                	xor    %edi,%edi
+  8024f9:	31 db                	xor    %ebx,%ebx
+  8024fb:	0f a5 f7             	shld   %cl,%esi,%edi
+  8024fe:	d3 e6                	shl    %cl,%esi
+  802500:	f6 c1 20             	test   $0x20,%cl
+  802503:	0f 45 fe             	cmovne %esi,%edi
+  802506:	0f 45 f3             	cmovne %ebx,%esi
+  802509:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80250d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802511:	83 ed 01             	sub    $0x1,%ebp
+  802514:	73 9a                	jae    8024b0 <__divdi3+0x70>
+  802516:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80251a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80251e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802522:	85 ed                	test   %ebp,%ebp
+  802524:	0f 84 47 ff ff ff    	je     802471 <__divdi3+0x31>
+  80252a:	f7 d8                	neg    %eax
+  80252c:	83 d2 00             	adc    $0x0,%edx
+  80252f:	83 c4 1c             	add    $0x1c,%esp
+  802532:	5b                   	pop    %ebx
+  802533:	f7 da                	neg    %edx
+  802535:	5e                   	pop    %esi
+  802536:	5f                   	pop    %edi
+  802537:	5d                   	pop    %ebp
+  802538:	c3                   	ret
+  802539:	f7 de                	neg    %esi
+  80253b:	83 d7 00             	adc    $0x0,%edi
+  80253e:	f7 df                	neg    %edi
+  802540:	85 db                	test   %ebx,%ebx
+  802542:	78 23                	js     802567 <__divdi3+0x127>
+  802544:	89 dd                	mov    %ebx,%ebp
+  802546:	89 c8                	mov    %ecx,%eax
+  802548:	89 da                	mov    %ebx,%edx
+  80254a:	09 cd                	or     %ecx,%ebp
+  80254c:	0f 84 1f ff ff ff    	je     802471 <__divdi3+0x31>
+  802552:	89 0c 24             	mov    %ecx,(%esp)
+  802555:	89 f0                	mov    %esi,%eax
+  802557:	89 fa                	mov    %edi,%edx
+  802559:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80255e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802562:	e9 29 ff ff ff       	jmp    802490 <__divdi3+0x50>
+  802567:	31 ed                	xor    %ebp,%ebp
+  802569:	e9 10 ff ff ff       	jmp    80247e <__divdi3+0x3e>
+  80256e:	89 0c 24             	mov    %ecx,(%esp)
+  802571:	89 f0                	mov    %esi,%eax
+  802573:	89 fa                	mov    %edi,%edx
+  802575:	31 ed                	xor    %ebp,%ebp
+  802577:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80257b:	e9 10 ff ff ff       	jmp    802490 <__divdi3+0x50>
+
+00802580 <__moddi3>:
+  802580:	55                   	push   %ebp
+  802581:	57                   	push   %edi
+  802582:	56                   	push   %esi
+  802583:	53                   	push   %ebx
+  802584:	83 ec 14             	sub    $0x14,%esp
+  802587:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80258b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80258f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802593:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802597:	85 d2                	test   %edx,%edx
+  802599:	0f 88 9b 00 00 00    	js     80263a <__moddi3+0xba>
+  80259f:	89 f7                	mov    %esi,%edi
+  8025a1:	31 ed                	xor    %ebp,%ebp
+  8025a3:	09 cf                	or     %ecx,%edi
+  8025a5:	0f 84 83 00 00 00    	je     80262e <__moddi3+0xae>
+  8025ab:	89 cb                	mov    %ecx,%ebx
+  8025ad:	89 f7                	mov    %esi,%edi
+  8025af:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8025b3:	f7 db                	neg    %ebx
+  8025b5:	83 d7 00             	adc    $0x0,%edi
+  8025b8:	f7 df                	neg    %edi
+  8025ba:	0f 49 f7             	cmovns %edi,%esi
+  8025bd:	0f 49 cb             	cmovns %ebx,%ecx
+  8025c0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025c4:	89 0c 24             	mov    %ecx,(%esp)
+  8025c7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025cc:	89 cd                	mov    %ecx,%ebp
+  8025ce:	66 90                	xchg   %ax,%ax
+  8025d0:	89 e9                	mov    %ebp,%ecx
+  8025d2:	89 c3                	mov    %eax,%ebx
+  8025d4:	89 d6                	mov    %edx,%esi
+  8025d6:	31 ff                	xor    %edi,%edi
+  8025d8:	d3 ee                	shr    %cl,%esi
+  8025da:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025dd:	f6 c1 20             	test   $0x20,%cl
+  8025e0:	0f 45 de             	cmovne %esi,%ebx
+  8025e3:	0f 45 f7             	cmovne %edi,%esi
+  8025e6:	8b 3c 24             	mov    (%esp),%edi
+  8025e9:	39 fb                	cmp    %edi,%ebx
+  8025eb:	89 f7                	mov    %esi,%edi
+  8025ed:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8025f1:	8b 1c 24             	mov    (%esp),%ebx
+  8025f4:	19 f7                	sbb    %esi,%edi
+  8025f6:	72 1a                	jb     802612 <__moddi3+0x92>
+  8025f8:	89 e9                	mov    %ebp,%ecx
+  8025fa:	89 f7                	mov    %esi,%edi
+  8025fc:	89 de                	mov    %ebx,%esi
+  8025fe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802601:	d3 e6                	shl    %cl,%esi
+  802603:	31 db                	xor    %ebx,%ebx
+  802605:	f6 c1 20             	test   $0x20,%cl
+  802608:	0f 45 fe             	cmovne %esi,%edi
+  80260b:	0f 45 f3             	cmovne %ebx,%esi
+  80260e:	29 f0                	sub    %esi,%eax
+  802610:	19 fa                	sbb    %edi,%edx
+  802612:	83 ed 01             	sub    $0x1,%ebp
+  802615:	73 b9                	jae    8025d0 <__moddi3+0x50>
+  802617:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80261b:	85 ed                	test   %ebp,%ebp
+  80261d:	74 07                	je     802626 <__moddi3+0xa6>
+  80261f:	f7 d8                	neg    %eax
+  802621:	83 d2 00             	adc    $0x0,%edx
+  802624:	f7 da                	neg    %edx
+  802626:	83 c4 14             	add    $0x14,%esp
+  802629:	5b                   	pop    %ebx
+  80262a:	5e                   	pop    %esi
+  80262b:	5f                   	pop    %edi
+  80262c:	5d                   	pop    %ebp
+  80262d:	c3                   	ret
+  80262e:	83 c4 14             	add    $0x14,%esp
+  802631:	31 c0                	xor    %eax,%eax
+  802633:	31 d2                	xor    %edx,%edx
+  802635:	5b                   	pop    %ebx
+  802636:	5e                   	pop    %esi
+  802637:	5f                   	pop    %edi
+  802638:	5d                   	pop    %ebp
+  802639:	c3                   	ret
+  80263a:	89 f7                	mov    %esi,%edi
+  80263c:	09 cf                	or     %ecx,%edi
+  80263e:	74 11                	je     802651 <__moddi3+0xd1>
+  802640:	f7 d8                	neg    %eax
+  802642:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802647:	83 d2 00             	adc    $0x0,%edx
+  80264a:	f7 da                	neg    %edx
+  80264c:	e9 5a ff ff ff       	jmp    8025ab <__moddi3+0x2b>
+  802651:	31 c0                	xor    %eax,%eax
+  802653:	31 d2                	xor    %edx,%edx
+  802655:	eb c8                	jmp    80261f <__moddi3+0x9f>
@@ -0,0 +1,6237 @@
+
+obj/user/spawnhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4a 00 00 00       	call   80007b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	int r;
+	cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800039:	a1 08 50 80 00       	mov    0x805008,%eax
+  80003e:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800041:	50                   	push   %eax
+  800042:	68 60 2d 80 00       	push   $0x802d60
+  800047:	e8 6a 01 00 00       	call   8001b6 <cprintf>
+	if ((r = spawnl("hello", "hello", 0)) < 0)
+  80004c:	83 c4 0c             	add    $0xc,%esp
+  80004f:	6a 00                	push   $0x0
+  800051:	68 7e 2d 80 00       	push   $0x802d7e
+  800056:	68 7e 2d 80 00       	push   $0x802d7e
+  80005b:	e8 ed 1d 00 00       	call   801e4d <spawnl>
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	85 c0                	test   %eax,%eax
+  800065:	78 02                	js     800069 <umain+0x36>
+		panic("spawn(hello) failed: %e", r);
+}
+  800067:	c9                   	leave
+  800068:	c3                   	ret
+		panic("spawn(hello) failed: %e", r);
+  800069:	50                   	push   %eax
+  80006a:	68 84 2d 80 00       	push   $0x802d84
+  80006f:	6a 09                	push   $0x9
+  800071:	68 9c 2d 80 00       	push   $0x802d9c
+  800076:	e8 60 00 00 00       	call   8000db <_panic>
+
+0080007b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80007b:	55                   	push   %ebp
+  80007c:	89 e5                	mov    %esp,%ebp
+  80007e:	56                   	push   %esi
+  80007f:	53                   	push   %ebx
+  800080:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800083:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800086:	e8 e7 0a 00 00       	call   800b72 <sys_getenvid>
+  80008b:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800090:	c1 e0 09             	shl    $0x9,%eax
+  800093:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800098:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80009d:	85 db                	test   %ebx,%ebx
+  80009f:	7e 07                	jle    8000a8 <libmain+0x2d>
+		binaryname = argv[0];
+  8000a1:	8b 06                	mov    (%esi),%eax
+  8000a3:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000a8:	83 ec 08             	sub    $0x8,%esp
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+  8000ad:	e8 81 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000b2:	e8 0a 00 00 00       	call   8000c1 <exit>
+}
+  8000b7:	83 c4 10             	add    $0x10,%esp
+  8000ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000bd:	5b                   	pop    %ebx
+  8000be:	5e                   	pop    %esi
+  8000bf:	5d                   	pop    %ebp
+  8000c0:	c3                   	ret
+
+008000c1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c1:	55                   	push   %ebp
+  8000c2:	89 e5                	mov    %esp,%ebp
+  8000c4:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000c7:	e8 3e 11 00 00       	call   80120a <close_all>
+	sys_env_destroy(0);
+  8000cc:	83 ec 0c             	sub    $0xc,%esp
+  8000cf:	6a 00                	push   $0x0
+  8000d1:	e8 5b 0a 00 00       	call   800b31 <sys_env_destroy>
+}
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	c9                   	leave
+  8000da:	c3                   	ret
+
+008000db <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8000db:	55                   	push   %ebp
+  8000dc:	89 e5                	mov    %esp,%ebp
+  8000de:	56                   	push   %esi
+  8000df:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8000e0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8000e3:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8000e9:	e8 84 0a 00 00       	call   800b72 <sys_getenvid>
+  8000ee:	83 ec 0c             	sub    $0xc,%esp
+  8000f1:	ff 75 0c             	push   0xc(%ebp)
+  8000f4:	ff 75 08             	push   0x8(%ebp)
+  8000f7:	56                   	push   %esi
+  8000f8:	50                   	push   %eax
+  8000f9:	68 b8 2d 80 00       	push   $0x802db8
+  8000fe:	e8 b3 00 00 00       	call   8001b6 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800103:	83 c4 18             	add    $0x18,%esp
+  800106:	53                   	push   %ebx
+  800107:	ff 75 10             	push   0x10(%ebp)
+  80010a:	e8 56 00 00 00       	call   800165 <vcprintf>
+	cprintf("\n");
+  80010f:	c7 04 24 dc 32 80 00 	movl   $0x8032dc,(%esp)
+  800116:	e8 9b 00 00 00       	call   8001b6 <cprintf>
+  80011b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80011e:	cc                   	int3
+	while (1)
+  80011f:	eb fd                	jmp    80011e <_panic+0x43>
+
+00800121 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800121:	55                   	push   %ebp
+  800122:	89 e5                	mov    %esp,%ebp
+  800124:	53                   	push   %ebx
+  800125:	83 ec 04             	sub    $0x4,%esp
+  800128:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80012b:	8b 13                	mov    (%ebx),%edx
+  80012d:	8d 42 01             	lea    0x1(%edx),%eax
+  800130:	89 03                	mov    %eax,(%ebx)
+  800132:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800135:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800139:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80013e:	74 09                	je     800149 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800140:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800144:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800147:	c9                   	leave
+  800148:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800149:	83 ec 08             	sub    $0x8,%esp
+  80014c:	68 ff 00 00 00       	push   $0xff
+  800151:	8d 43 08             	lea    0x8(%ebx),%eax
+  800154:	50                   	push   %eax
+  800155:	e8 7a 09 00 00       	call   800ad4 <sys_cputs>
+		b->idx = 0;
+  80015a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800160:	83 c4 10             	add    $0x10,%esp
+  800163:	eb db                	jmp    800140 <putch+0x1f>
+
+00800165 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800165:	55                   	push   %ebp
+  800166:	89 e5                	mov    %esp,%ebp
+  800168:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80016e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800175:	00 00 00 
+	b.cnt = 0;
+  800178:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80017f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800182:	ff 75 0c             	push   0xc(%ebp)
+  800185:	ff 75 08             	push   0x8(%ebp)
+  800188:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80018e:	50                   	push   %eax
+  80018f:	68 21 01 80 00       	push   $0x800121
+  800194:	e8 14 01 00 00       	call   8002ad <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800199:	83 c4 08             	add    $0x8,%esp
+  80019c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a2:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001a8:	50                   	push   %eax
+  8001a9:	e8 26 09 00 00       	call   800ad4 <sys_cputs>
+
+	return b.cnt;
+}
+  8001ae:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b4:	c9                   	leave
+  8001b5:	c3                   	ret
+
+008001b6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b6:	55                   	push   %ebp
+  8001b7:	89 e5                	mov    %esp,%ebp
+  8001b9:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001bc:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001bf:	50                   	push   %eax
+  8001c0:	ff 75 08             	push   0x8(%ebp)
+  8001c3:	e8 9d ff ff ff       	call   800165 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001c8:	c9                   	leave
+  8001c9:	c3                   	ret
+
+008001ca <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	57                   	push   %edi
+  8001ce:	56                   	push   %esi
+  8001cf:	53                   	push   %ebx
+  8001d0:	83 ec 1c             	sub    $0x1c,%esp
+  8001d3:	89 c7                	mov    %eax,%edi
+  8001d5:	89 d6                	mov    %edx,%esi
+  8001d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001da:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001dd:	89 d1                	mov    %edx,%ecx
+  8001df:	89 c2                	mov    %eax,%edx
+  8001e1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001e7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ea:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001f7:	39 c2                	cmp    %eax,%edx
+  8001f9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001fc:	72 3e                	jb     80023c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001fe:	83 ec 0c             	sub    $0xc,%esp
+  800201:	ff 75 18             	push   0x18(%ebp)
+  800204:	83 eb 01             	sub    $0x1,%ebx
+  800207:	53                   	push   %ebx
+  800208:	50                   	push   %eax
+  800209:	83 ec 08             	sub    $0x8,%esp
+  80020c:	ff 75 e4             	push   -0x1c(%ebp)
+  80020f:	ff 75 e0             	push   -0x20(%ebp)
+  800212:	ff 75 dc             	push   -0x24(%ebp)
+  800215:	ff 75 d8             	push   -0x28(%ebp)
+  800218:	e8 c3 27 00 00       	call   8029e0 <__udivdi3>
+  80021d:	83 c4 18             	add    $0x18,%esp
+  800220:	52                   	push   %edx
+  800221:	50                   	push   %eax
+  800222:	89 f2                	mov    %esi,%edx
+  800224:	89 f8                	mov    %edi,%eax
+  800226:	e8 9f ff ff ff       	call   8001ca <printnum>
+  80022b:	83 c4 20             	add    $0x20,%esp
+  80022e:	eb 13                	jmp    800243 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800230:	83 ec 08             	sub    $0x8,%esp
+  800233:	56                   	push   %esi
+  800234:	ff 75 18             	push   0x18(%ebp)
+  800237:	ff d7                	call   *%edi
+  800239:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80023c:	83 eb 01             	sub    $0x1,%ebx
+  80023f:	85 db                	test   %ebx,%ebx
+  800241:	7f ed                	jg     800230 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800243:	83 ec 08             	sub    $0x8,%esp
+  800246:	56                   	push   %esi
+  800247:	83 ec 04             	sub    $0x4,%esp
+  80024a:	ff 75 e4             	push   -0x1c(%ebp)
+  80024d:	ff 75 e0             	push   -0x20(%ebp)
+  800250:	ff 75 dc             	push   -0x24(%ebp)
+  800253:	ff 75 d8             	push   -0x28(%ebp)
+  800256:	e8 45 28 00 00       	call   802aa0 <__umoddi3>
+  80025b:	83 c4 14             	add    $0x14,%esp
+  80025e:	0f be 80 db 2d 80 00 	movsbl 0x802ddb(%eax),%eax
+  800265:	50                   	push   %eax
+  800266:	ff d7                	call   *%edi
+}
+  800268:	83 c4 10             	add    $0x10,%esp
+  80026b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026e:	5b                   	pop    %ebx
+  80026f:	5e                   	pop    %esi
+  800270:	5f                   	pop    %edi
+  800271:	5d                   	pop    %ebp
+  800272:	c3                   	ret
+
+00800273 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800279:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80027d:	8b 10                	mov    (%eax),%edx
+  80027f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800282:	73 0a                	jae    80028e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800284:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800287:	89 08                	mov    %ecx,(%eax)
+  800289:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028c:	88 02                	mov    %al,(%edx)
+}
+  80028e:	5d                   	pop    %ebp
+  80028f:	c3                   	ret
+
+00800290 <printfmt>:
+{
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800296:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800299:	50                   	push   %eax
+  80029a:	ff 75 10             	push   0x10(%ebp)
+  80029d:	ff 75 0c             	push   0xc(%ebp)
+  8002a0:	ff 75 08             	push   0x8(%ebp)
+  8002a3:	e8 05 00 00 00       	call   8002ad <vprintfmt>
+}
+  8002a8:	83 c4 10             	add    $0x10,%esp
+  8002ab:	c9                   	leave
+  8002ac:	c3                   	ret
+
+008002ad <vprintfmt>:
+{
+  8002ad:	55                   	push   %ebp
+  8002ae:	89 e5                	mov    %esp,%ebp
+  8002b0:	57                   	push   %edi
+  8002b1:	56                   	push   %esi
+  8002b2:	53                   	push   %ebx
+  8002b3:	83 ec 2c             	sub    $0x2c,%esp
+  8002b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002bc:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002bf:	eb 0a                	jmp    8002cb <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002c1:	83 ec 08             	sub    $0x8,%esp
+  8002c4:	53                   	push   %ebx
+  8002c5:	50                   	push   %eax
+  8002c6:	ff d6                	call   *%esi
+  8002c8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002cb:	83 c7 01             	add    $0x1,%edi
+  8002ce:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002d2:	83 f8 25             	cmp    $0x25,%eax
+  8002d5:	74 0c                	je     8002e3 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002d7:	85 c0                	test   %eax,%eax
+  8002d9:	75 e6                	jne    8002c1 <vprintfmt+0x14>
+}
+  8002db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002de:	5b                   	pop    %ebx
+  8002df:	5e                   	pop    %esi
+  8002e0:	5f                   	pop    %edi
+  8002e1:	5d                   	pop    %ebp
+  8002e2:	c3                   	ret
+		padc = ' ';
+  8002e3:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002e7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002ee:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002f5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800301:	8d 47 01             	lea    0x1(%edi),%eax
+  800304:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800307:	0f b6 17             	movzbl (%edi),%edx
+  80030a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80030d:	3c 55                	cmp    $0x55,%al
+  80030f:	0f 87 cf 03 00 00    	ja     8006e4 <vprintfmt+0x437>
+  800315:	0f b6 c0             	movzbl %al,%eax
+  800318:	ff 24 85 20 2f 80 00 	jmp    *0x802f20(,%eax,4)
+  80031f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800322:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800326:	eb d9                	jmp    800301 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800328:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80032f:	eb d0                	jmp    800301 <vprintfmt+0x54>
+  800331:	0f b6 d2             	movzbl %dl,%edx
+  800334:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80033f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800342:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800346:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800349:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80034c:	83 f9 09             	cmp    $0x9,%ecx
+  80034f:	77 55                	ja     8003a6 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800351:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800354:	eb e9                	jmp    80033f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800356:	8b 45 14             	mov    0x14(%ebp),%eax
+  800359:	8b 00                	mov    (%eax),%eax
+  80035b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80035e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800361:	8d 40 04             	lea    0x4(%eax),%eax
+  800364:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800367:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80036a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80036e:	79 91                	jns    800301 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800370:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800373:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800376:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80037d:	eb 82                	jmp    800301 <vprintfmt+0x54>
+			if (width < 0)
+  80037f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800382:	85 d2                	test   %edx,%edx
+  800384:	b8 00 00 00 00       	mov    $0x0,%eax
+  800389:	0f 49 c2             	cmovns %edx,%eax
+  80038c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80038f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800392:	e9 6a ff ff ff       	jmp    800301 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800397:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80039a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003a1:	e9 5b ff ff ff       	jmp    800301 <vprintfmt+0x54>
+  8003a6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003a9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ac:	eb bc                	jmp    80036a <vprintfmt+0xbd>
+			lflag++;
+  8003ae:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b4:	e9 48 ff ff ff       	jmp    800301 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bc:	8d 78 04             	lea    0x4(%eax),%edi
+  8003bf:	83 ec 08             	sub    $0x8,%esp
+  8003c2:	53                   	push   %ebx
+  8003c3:	ff 30                	push   (%eax)
+  8003c5:	ff d6                	call   *%esi
+			break;
+  8003c7:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003ca:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003cd:	e9 b1 02 00 00       	jmp    800683 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d5:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003d8:	8b 10                	mov    (%eax),%edx
+  8003da:	89 d0                	mov    %edx,%eax
+  8003dc:	f7 d8                	neg    %eax
+  8003de:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003e1:	83 f8 0f             	cmp    $0xf,%eax
+  8003e4:	7f 23                	jg     800409 <vprintfmt+0x15c>
+  8003e6:	8b 14 85 80 30 80 00 	mov    0x803080(,%eax,4),%edx
+  8003ed:	85 d2                	test   %edx,%edx
+  8003ef:	74 18                	je     800409 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003f1:	52                   	push   %edx
+  8003f2:	68 b5 31 80 00       	push   $0x8031b5
+  8003f7:	53                   	push   %ebx
+  8003f8:	56                   	push   %esi
+  8003f9:	e8 92 fe ff ff       	call   800290 <printfmt>
+  8003fe:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800401:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800404:	e9 7a 02 00 00       	jmp    800683 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800409:	50                   	push   %eax
+  80040a:	68 f3 2d 80 00       	push   $0x802df3
+  80040f:	53                   	push   %ebx
+  800410:	56                   	push   %esi
+  800411:	e8 7a fe ff ff       	call   800290 <printfmt>
+  800416:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800419:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80041c:	e9 62 02 00 00       	jmp    800683 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800421:	8b 45 14             	mov    0x14(%ebp),%eax
+  800424:	83 c0 04             	add    $0x4,%eax
+  800427:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80042a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80042f:	85 c9                	test   %ecx,%ecx
+  800431:	b8 ec 2d 80 00       	mov    $0x802dec,%eax
+  800436:	0f 45 c1             	cmovne %ecx,%eax
+  800439:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80043c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800440:	7e 06                	jle    800448 <vprintfmt+0x19b>
+  800442:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800446:	75 0b                	jne    800453 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800448:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80044b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80044e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800451:	eb 5c                	jmp    8004af <vprintfmt+0x202>
+  800453:	83 ec 08             	sub    $0x8,%esp
+  800456:	ff 75 d0             	push   -0x30(%ebp)
+  800459:	ff 75 cc             	push   -0x34(%ebp)
+  80045c:	e8 20 03 00 00       	call   800781 <strnlen>
+  800461:	89 c2                	mov    %eax,%edx
+  800463:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800466:	29 d0                	sub    %edx,%eax
+  800468:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80046b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80046f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800472:	89 75 08             	mov    %esi,0x8(%ebp)
+  800475:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800477:	eb 0e                	jmp    800487 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800479:	83 ec 08             	sub    $0x8,%esp
+  80047c:	53                   	push   %ebx
+  80047d:	57                   	push   %edi
+  80047e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800481:	83 ee 01             	sub    $0x1,%esi
+  800484:	83 c4 10             	add    $0x10,%esp
+  800487:	85 f6                	test   %esi,%esi
+  800489:	7f ee                	jg     800479 <vprintfmt+0x1cc>
+  80048b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80048e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800491:	85 c0                	test   %eax,%eax
+  800493:	ba 00 00 00 00       	mov    $0x0,%edx
+  800498:	0f 49 d0             	cmovns %eax,%edx
+  80049b:	29 d0                	sub    %edx,%eax
+  80049d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a0:	eb a6                	jmp    800448 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004a2:	83 ec 08             	sub    $0x8,%esp
+  8004a5:	53                   	push   %ebx
+  8004a6:	52                   	push   %edx
+  8004a7:	ff 55 08             	call   *0x8(%ebp)
+  8004aa:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ad:	89 f1                	mov    %esi,%ecx
+  8004af:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004b2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b6:	0f be d0             	movsbl %al,%edx
+  8004b9:	85 d2                	test   %edx,%edx
+  8004bb:	74 28                	je     8004e5 <vprintfmt+0x238>
+  8004bd:	85 ff                	test   %edi,%edi
+  8004bf:	78 05                	js     8004c6 <vprintfmt+0x219>
+  8004c1:	83 ef 01             	sub    $0x1,%edi
+  8004c4:	78 30                	js     8004f6 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004c6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004ca:	74 d6                	je     8004a2 <vprintfmt+0x1f5>
+  8004cc:	0f be c0             	movsbl %al,%eax
+  8004cf:	83 e8 20             	sub    $0x20,%eax
+  8004d2:	83 f8 5e             	cmp    $0x5e,%eax
+  8004d5:	76 cb                	jbe    8004a2 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004d7:	83 ec 08             	sub    $0x8,%esp
+  8004da:	53                   	push   %ebx
+  8004db:	6a 3f                	push   $0x3f
+  8004dd:	ff 55 08             	call   *0x8(%ebp)
+  8004e0:	83 c4 10             	add    $0x10,%esp
+  8004e3:	eb c8                	jmp    8004ad <vprintfmt+0x200>
+  8004e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004eb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ee:	01 d0                	add    %edx,%eax
+  8004f0:	29 c8                	sub    %ecx,%eax
+  8004f2:	89 c7                	mov    %eax,%edi
+  8004f4:	eb 13                	jmp    800509 <vprintfmt+0x25c>
+  8004f6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f9:	eb ed                	jmp    8004e8 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004fb:	83 ec 08             	sub    $0x8,%esp
+  8004fe:	53                   	push   %ebx
+  8004ff:	6a 20                	push   $0x20
+  800501:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800503:	83 ef 01             	sub    $0x1,%edi
+  800506:	83 c4 10             	add    $0x10,%esp
+  800509:	85 ff                	test   %edi,%edi
+  80050b:	7f ee                	jg     8004fb <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80050d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800510:	89 45 14             	mov    %eax,0x14(%ebp)
+  800513:	e9 6b 01 00 00       	jmp    800683 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800518:	83 f9 01             	cmp    $0x1,%ecx
+  80051b:	7f 1f                	jg     80053c <vprintfmt+0x28f>
+	else if (lflag)
+  80051d:	85 c9                	test   %ecx,%ecx
+  80051f:	74 67                	je     800588 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800521:	8b 45 14             	mov    0x14(%ebp),%eax
+  800524:	8b 00                	mov    (%eax),%eax
+  800526:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800529:	89 c1                	mov    %eax,%ecx
+  80052b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80052e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800531:	8b 45 14             	mov    0x14(%ebp),%eax
+  800534:	8d 40 04             	lea    0x4(%eax),%eax
+  800537:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053a:	eb 17                	jmp    800553 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80053c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053f:	8b 50 04             	mov    0x4(%eax),%edx
+  800542:	8b 00                	mov    (%eax),%eax
+  800544:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800547:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80054a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054d:	8d 40 08             	lea    0x8(%eax),%eax
+  800550:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800553:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800556:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800559:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80055e:	85 c9                	test   %ecx,%ecx
+  800560:	0f 89 03 01 00 00    	jns    800669 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800566:	83 ec 08             	sub    $0x8,%esp
+  800569:	53                   	push   %ebx
+  80056a:	6a 2d                	push   $0x2d
+  80056c:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80056e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800571:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800574:	f7 da                	neg    %edx
+  800576:	83 d1 00             	adc    $0x0,%ecx
+  800579:	f7 d9                	neg    %ecx
+  80057b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80057e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800583:	e9 e1 00 00 00       	jmp    800669 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058b:	8b 00                	mov    (%eax),%eax
+  80058d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800590:	89 c1                	mov    %eax,%ecx
+  800592:	c1 f9 1f             	sar    $0x1f,%ecx
+  800595:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800598:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059b:	8d 40 04             	lea    0x4(%eax),%eax
+  80059e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a1:	eb b0                	jmp    800553 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005a3:	83 f9 01             	cmp    $0x1,%ecx
+  8005a6:	7f 1e                	jg     8005c6 <vprintfmt+0x319>
+	else if (lflag)
+  8005a8:	85 c9                	test   %ecx,%ecx
+  8005aa:	74 32                	je     8005de <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005af:	8b 10                	mov    (%eax),%edx
+  8005b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005bc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005c1:	e9 a3 00 00 00       	jmp    800669 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c9:	8b 10                	mov    (%eax),%edx
+  8005cb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005ce:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005d9:	e9 8b 00 00 00       	jmp    800669 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e1:	8b 10                	mov    (%eax),%edx
+  8005e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ee:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005f3:	eb 74                	jmp    800669 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005f5:	83 f9 01             	cmp    $0x1,%ecx
+  8005f8:	7f 1b                	jg     800615 <vprintfmt+0x368>
+	else if (lflag)
+  8005fa:	85 c9                	test   %ecx,%ecx
+  8005fc:	74 2c                	je     80062a <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8b 10                	mov    (%eax),%edx
+  800603:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800608:	8d 40 04             	lea    0x4(%eax),%eax
+  80060b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80060e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800613:	eb 54                	jmp    800669 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8b 10                	mov    (%eax),%edx
+  80061a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80061d:	8d 40 08             	lea    0x8(%eax),%eax
+  800620:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800623:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800628:	eb 3f                	jmp    800669 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80062a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062d:	8b 10                	mov    (%eax),%edx
+  80062f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800634:	8d 40 04             	lea    0x4(%eax),%eax
+  800637:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80063a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80063f:	eb 28                	jmp    800669 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800641:	83 ec 08             	sub    $0x8,%esp
+  800644:	53                   	push   %ebx
+  800645:	6a 30                	push   $0x30
+  800647:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800649:	83 c4 08             	add    $0x8,%esp
+  80064c:	53                   	push   %ebx
+  80064d:	6a 78                	push   $0x78
+  80064f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800651:	8b 45 14             	mov    0x14(%ebp),%eax
+  800654:	8b 10                	mov    (%eax),%edx
+  800656:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80065b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80065e:	8d 40 04             	lea    0x4(%eax),%eax
+  800661:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800664:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800669:	83 ec 0c             	sub    $0xc,%esp
+  80066c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800670:	50                   	push   %eax
+  800671:	ff 75 e0             	push   -0x20(%ebp)
+  800674:	57                   	push   %edi
+  800675:	51                   	push   %ecx
+  800676:	52                   	push   %edx
+  800677:	89 da                	mov    %ebx,%edx
+  800679:	89 f0                	mov    %esi,%eax
+  80067b:	e8 4a fb ff ff       	call   8001ca <printnum>
+			break;
+  800680:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800683:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800686:	e9 40 fc ff ff       	jmp    8002cb <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80068b:	83 f9 01             	cmp    $0x1,%ecx
+  80068e:	7f 1b                	jg     8006ab <vprintfmt+0x3fe>
+	else if (lflag)
+  800690:	85 c9                	test   %ecx,%ecx
+  800692:	74 2c                	je     8006c0 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800694:	8b 45 14             	mov    0x14(%ebp),%eax
+  800697:	8b 10                	mov    (%eax),%edx
+  800699:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069e:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006a9:	eb be                	jmp    800669 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ae:	8b 10                	mov    (%eax),%edx
+  8006b0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006be:	eb a9                	jmp    800669 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c3:	8b 10                	mov    (%eax),%edx
+  8006c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006d5:	eb 92                	jmp    800669 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006d7:	83 ec 08             	sub    $0x8,%esp
+  8006da:	53                   	push   %ebx
+  8006db:	6a 25                	push   $0x25
+  8006dd:	ff d6                	call   *%esi
+			break;
+  8006df:	83 c4 10             	add    $0x10,%esp
+  8006e2:	eb 9f                	jmp    800683 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006e4:	83 ec 08             	sub    $0x8,%esp
+  8006e7:	53                   	push   %ebx
+  8006e8:	6a 25                	push   $0x25
+  8006ea:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006ec:	83 c4 10             	add    $0x10,%esp
+  8006ef:	89 f8                	mov    %edi,%eax
+  8006f1:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006f5:	74 05                	je     8006fc <vprintfmt+0x44f>
+  8006f7:	83 e8 01             	sub    $0x1,%eax
+  8006fa:	eb f5                	jmp    8006f1 <vprintfmt+0x444>
+  8006fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006ff:	eb 82                	jmp    800683 <vprintfmt+0x3d6>
+
+00800701 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800701:	55                   	push   %ebp
+  800702:	89 e5                	mov    %esp,%ebp
+  800704:	83 ec 18             	sub    $0x18,%esp
+  800707:	8b 45 08             	mov    0x8(%ebp),%eax
+  80070a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80070d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800710:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800714:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800717:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80071e:	85 c0                	test   %eax,%eax
+  800720:	74 26                	je     800748 <vsnprintf+0x47>
+  800722:	85 d2                	test   %edx,%edx
+  800724:	7e 22                	jle    800748 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800726:	ff 75 14             	push   0x14(%ebp)
+  800729:	ff 75 10             	push   0x10(%ebp)
+  80072c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80072f:	50                   	push   %eax
+  800730:	68 73 02 80 00       	push   $0x800273
+  800735:	e8 73 fb ff ff       	call   8002ad <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80073a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80073d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800740:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800743:	83 c4 10             	add    $0x10,%esp
+}
+  800746:	c9                   	leave
+  800747:	c3                   	ret
+		return -E_INVAL;
+  800748:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80074d:	eb f7                	jmp    800746 <vsnprintf+0x45>
+
+0080074f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80074f:	55                   	push   %ebp
+  800750:	89 e5                	mov    %esp,%ebp
+  800752:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800755:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800758:	50                   	push   %eax
+  800759:	ff 75 10             	push   0x10(%ebp)
+  80075c:	ff 75 0c             	push   0xc(%ebp)
+  80075f:	ff 75 08             	push   0x8(%ebp)
+  800762:	e8 9a ff ff ff       	call   800701 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800767:	c9                   	leave
+  800768:	c3                   	ret
+
+00800769 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800769:	55                   	push   %ebp
+  80076a:	89 e5                	mov    %esp,%ebp
+  80076c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80076f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800774:	eb 03                	jmp    800779 <strlen+0x10>
+		n++;
+  800776:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800779:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80077d:	75 f7                	jne    800776 <strlen+0xd>
+	return n;
+}
+  80077f:	5d                   	pop    %ebp
+  800780:	c3                   	ret
+
+00800781 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800781:	55                   	push   %ebp
+  800782:	89 e5                	mov    %esp,%ebp
+  800784:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800787:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80078a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078f:	eb 03                	jmp    800794 <strnlen+0x13>
+		n++;
+  800791:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800794:	39 d0                	cmp    %edx,%eax
+  800796:	74 08                	je     8007a0 <strnlen+0x1f>
+  800798:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80079c:	75 f3                	jne    800791 <strnlen+0x10>
+  80079e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007a0:	89 d0                	mov    %edx,%eax
+  8007a2:	5d                   	pop    %ebp
+  8007a3:	c3                   	ret
+
+008007a4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007a4:	55                   	push   %ebp
+  8007a5:	89 e5                	mov    %esp,%ebp
+  8007a7:	53                   	push   %ebx
+  8007a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b3:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007b7:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007ba:	83 c0 01             	add    $0x1,%eax
+  8007bd:	84 d2                	test   %dl,%dl
+  8007bf:	75 f2                	jne    8007b3 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007c1:	89 c8                	mov    %ecx,%eax
+  8007c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c6:	c9                   	leave
+  8007c7:	c3                   	ret
+
+008007c8 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007c8:	55                   	push   %ebp
+  8007c9:	89 e5                	mov    %esp,%ebp
+  8007cb:	53                   	push   %ebx
+  8007cc:	83 ec 10             	sub    $0x10,%esp
+  8007cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007d2:	53                   	push   %ebx
+  8007d3:	e8 91 ff ff ff       	call   800769 <strlen>
+  8007d8:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007db:	ff 75 0c             	push   0xc(%ebp)
+  8007de:	01 d8                	add    %ebx,%eax
+  8007e0:	50                   	push   %eax
+  8007e1:	e8 be ff ff ff       	call   8007a4 <strcpy>
+	return dst;
+}
+  8007e6:	89 d8                	mov    %ebx,%eax
+  8007e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007eb:	c9                   	leave
+  8007ec:	c3                   	ret
+
+008007ed <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007ed:	55                   	push   %ebp
+  8007ee:	89 e5                	mov    %esp,%ebp
+  8007f0:	56                   	push   %esi
+  8007f1:	53                   	push   %ebx
+  8007f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007f8:	89 f3                	mov    %esi,%ebx
+  8007fa:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007fd:	89 f0                	mov    %esi,%eax
+  8007ff:	eb 0f                	jmp    800810 <strncpy+0x23>
+		*dst++ = *src;
+  800801:	83 c0 01             	add    $0x1,%eax
+  800804:	0f b6 0a             	movzbl (%edx),%ecx
+  800807:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80080a:	80 f9 01             	cmp    $0x1,%cl
+  80080d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800810:	39 d8                	cmp    %ebx,%eax
+  800812:	75 ed                	jne    800801 <strncpy+0x14>
+	}
+	return ret;
+}
+  800814:	89 f0                	mov    %esi,%eax
+  800816:	5b                   	pop    %ebx
+  800817:	5e                   	pop    %esi
+  800818:	5d                   	pop    %ebp
+  800819:	c3                   	ret
+
+0080081a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80081a:	55                   	push   %ebp
+  80081b:	89 e5                	mov    %esp,%ebp
+  80081d:	56                   	push   %esi
+  80081e:	53                   	push   %ebx
+  80081f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800822:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800825:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800828:	89 f0                	mov    %esi,%eax
+  80082a:	85 d2                	test   %edx,%edx
+  80082c:	74 21                	je     80084f <strlcpy+0x35>
+  80082e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800832:	89 f2                	mov    %esi,%edx
+  800834:	eb 09                	jmp    80083f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800836:	83 c1 01             	add    $0x1,%ecx
+  800839:	83 c2 01             	add    $0x1,%edx
+  80083c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80083f:	39 c2                	cmp    %eax,%edx
+  800841:	74 09                	je     80084c <strlcpy+0x32>
+  800843:	0f b6 19             	movzbl (%ecx),%ebx
+  800846:	84 db                	test   %bl,%bl
+  800848:	75 ec                	jne    800836 <strlcpy+0x1c>
+  80084a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80084c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80084f:	29 f0                	sub    %esi,%eax
+}
+  800851:	5b                   	pop    %ebx
+  800852:	5e                   	pop    %esi
+  800853:	5d                   	pop    %ebp
+  800854:	c3                   	ret
+
+00800855 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800855:	55                   	push   %ebp
+  800856:	89 e5                	mov    %esp,%ebp
+  800858:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80085e:	eb 06                	jmp    800866 <strcmp+0x11>
+		p++, q++;
+  800860:	83 c1 01             	add    $0x1,%ecx
+  800863:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800866:	0f b6 01             	movzbl (%ecx),%eax
+  800869:	84 c0                	test   %al,%al
+  80086b:	74 04                	je     800871 <strcmp+0x1c>
+  80086d:	3a 02                	cmp    (%edx),%al
+  80086f:	74 ef                	je     800860 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800871:	0f b6 c0             	movzbl %al,%eax
+  800874:	0f b6 12             	movzbl (%edx),%edx
+  800877:	29 d0                	sub    %edx,%eax
+}
+  800879:	5d                   	pop    %ebp
+  80087a:	c3                   	ret
+
+0080087b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80087b:	55                   	push   %ebp
+  80087c:	89 e5                	mov    %esp,%ebp
+  80087e:	53                   	push   %ebx
+  80087f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800882:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800885:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800888:	eb 09                	jmp    800893 <strncmp+0x18>
+		n--, p++, q++;
+  80088a:	83 ea 01             	sub    $0x1,%edx
+  80088d:	83 c0 01             	add    $0x1,%eax
+  800890:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800893:	85 d2                	test   %edx,%edx
+  800895:	74 18                	je     8008af <strncmp+0x34>
+  800897:	0f b6 18             	movzbl (%eax),%ebx
+  80089a:	84 db                	test   %bl,%bl
+  80089c:	74 04                	je     8008a2 <strncmp+0x27>
+  80089e:	3a 19                	cmp    (%ecx),%bl
+  8008a0:	74 e8                	je     80088a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008a2:	0f b6 00             	movzbl (%eax),%eax
+  8008a5:	0f b6 11             	movzbl (%ecx),%edx
+  8008a8:	29 d0                	sub    %edx,%eax
+}
+  8008aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ad:	c9                   	leave
+  8008ae:	c3                   	ret
+		return 0;
+  8008af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b4:	eb f4                	jmp    8008aa <strncmp+0x2f>
+
+008008b6 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008b6:	55                   	push   %ebp
+  8008b7:	89 e5                	mov    %esp,%ebp
+  8008b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008c0:	eb 03                	jmp    8008c5 <strchr+0xf>
+  8008c2:	83 c0 01             	add    $0x1,%eax
+  8008c5:	0f b6 10             	movzbl (%eax),%edx
+  8008c8:	84 d2                	test   %dl,%dl
+  8008ca:	74 06                	je     8008d2 <strchr+0x1c>
+		if (*s == c)
+  8008cc:	38 ca                	cmp    %cl,%dl
+  8008ce:	75 f2                	jne    8008c2 <strchr+0xc>
+  8008d0:	eb 05                	jmp    8008d7 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008d7:	5d                   	pop    %ebp
+  8008d8:	c3                   	ret
+
+008008d9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008df:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008e3:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008e6:	38 ca                	cmp    %cl,%dl
+  8008e8:	74 09                	je     8008f3 <strfind+0x1a>
+  8008ea:	84 d2                	test   %dl,%dl
+  8008ec:	74 05                	je     8008f3 <strfind+0x1a>
+	for (; *s; s++)
+  8008ee:	83 c0 01             	add    $0x1,%eax
+  8008f1:	eb f0                	jmp    8008e3 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008f3:	5d                   	pop    %ebp
+  8008f4:	c3                   	ret
+
+008008f5 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008f5:	55                   	push   %ebp
+  8008f6:	89 e5                	mov    %esp,%ebp
+  8008f8:	57                   	push   %edi
+  8008f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008fc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008ff:	85 c9                	test   %ecx,%ecx
+  800901:	74 20                	je     800923 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800903:	89 f8                	mov    %edi,%eax
+  800905:	09 c8                	or     %ecx,%eax
+  800907:	a8 03                	test   $0x3,%al
+  800909:	75 12                	jne    80091d <memset+0x28>
+		c &= 0xFF;
+  80090b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80090f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800915:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800918:	fc                   	cld
+  800919:	f3 ab                	rep stos %eax,%es:(%edi)
+  80091b:	eb 06                	jmp    800923 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80091d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800920:	fc                   	cld
+  800921:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800923:	89 f8                	mov    %edi,%eax
+  800925:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800928:	c9                   	leave
+  800929:	c3                   	ret
+
+0080092a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80092a:	55                   	push   %ebp
+  80092b:	89 e5                	mov    %esp,%ebp
+  80092d:	57                   	push   %edi
+  80092e:	56                   	push   %esi
+  80092f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800932:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800935:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800938:	39 c6                	cmp    %eax,%esi
+  80093a:	73 32                	jae    80096e <memmove+0x44>
+  80093c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80093f:	39 d0                	cmp    %edx,%eax
+  800941:	73 2b                	jae    80096e <memmove+0x44>
+		s += n;
+		d += n;
+  800943:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800946:	89 d6                	mov    %edx,%esi
+  800948:	09 fe                	or     %edi,%esi
+  80094a:	09 ce                	or     %ecx,%esi
+  80094c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800952:	75 0e                	jne    800962 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800954:	83 ef 04             	sub    $0x4,%edi
+  800957:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80095a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80095d:	fd                   	std
+  80095e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800960:	eb 09                	jmp    80096b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800962:	83 ef 01             	sub    $0x1,%edi
+  800965:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800968:	fd                   	std
+  800969:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80096b:	fc                   	cld
+  80096c:	eb 1a                	jmp    800988 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80096e:	89 f2                	mov    %esi,%edx
+  800970:	09 c2                	or     %eax,%edx
+  800972:	09 ca                	or     %ecx,%edx
+  800974:	f6 c2 03             	test   $0x3,%dl
+  800977:	75 0a                	jne    800983 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800979:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80097c:	89 c7                	mov    %eax,%edi
+  80097e:	fc                   	cld
+  80097f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800981:	eb 05                	jmp    800988 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800983:	89 c7                	mov    %eax,%edi
+  800985:	fc                   	cld
+  800986:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800988:	5e                   	pop    %esi
+  800989:	5f                   	pop    %edi
+  80098a:	5d                   	pop    %ebp
+  80098b:	c3                   	ret
+
+0080098c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80098c:	55                   	push   %ebp
+  80098d:	89 e5                	mov    %esp,%ebp
+  80098f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800992:	ff 75 10             	push   0x10(%ebp)
+  800995:	ff 75 0c             	push   0xc(%ebp)
+  800998:	ff 75 08             	push   0x8(%ebp)
+  80099b:	e8 8a ff ff ff       	call   80092a <memmove>
+}
+  8009a0:	c9                   	leave
+  8009a1:	c3                   	ret
+
+008009a2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	56                   	push   %esi
+  8009a6:	53                   	push   %ebx
+  8009a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009ad:	89 c6                	mov    %eax,%esi
+  8009af:	03 75 10             	add    0x10(%ebp),%esi
+  8009b2:	eb 06                	jmp    8009ba <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009b4:	83 c0 01             	add    $0x1,%eax
+  8009b7:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009ba:	39 f0                	cmp    %esi,%eax
+  8009bc:	74 14                	je     8009d2 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009be:	0f b6 08             	movzbl (%eax),%ecx
+  8009c1:	0f b6 1a             	movzbl (%edx),%ebx
+  8009c4:	38 d9                	cmp    %bl,%cl
+  8009c6:	74 ec                	je     8009b4 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009c8:	0f b6 c1             	movzbl %cl,%eax
+  8009cb:	0f b6 db             	movzbl %bl,%ebx
+  8009ce:	29 d8                	sub    %ebx,%eax
+  8009d0:	eb 05                	jmp    8009d7 <memcmp+0x35>
+	}
+
+	return 0;
+  8009d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009d7:	5b                   	pop    %ebx
+  8009d8:	5e                   	pop    %esi
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+
+008009db <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009e4:	89 c2                	mov    %eax,%edx
+  8009e6:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009e9:	eb 03                	jmp    8009ee <memfind+0x13>
+  8009eb:	83 c0 01             	add    $0x1,%eax
+  8009ee:	39 d0                	cmp    %edx,%eax
+  8009f0:	73 04                	jae    8009f6 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009f2:	38 08                	cmp    %cl,(%eax)
+  8009f4:	75 f5                	jne    8009eb <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	c3                   	ret
+
+008009f8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	57                   	push   %edi
+  8009fc:	56                   	push   %esi
+  8009fd:	53                   	push   %ebx
+  8009fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a04:	eb 03                	jmp    800a09 <strtol+0x11>
+		s++;
+  800a06:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a09:	0f b6 02             	movzbl (%edx),%eax
+  800a0c:	3c 20                	cmp    $0x20,%al
+  800a0e:	74 f6                	je     800a06 <strtol+0xe>
+  800a10:	3c 09                	cmp    $0x9,%al
+  800a12:	74 f2                	je     800a06 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a14:	3c 2b                	cmp    $0x2b,%al
+  800a16:	74 2a                	je     800a42 <strtol+0x4a>
+	int neg = 0;
+  800a18:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a1d:	3c 2d                	cmp    $0x2d,%al
+  800a1f:	74 2b                	je     800a4c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a21:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a27:	75 0f                	jne    800a38 <strtol+0x40>
+  800a29:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a2c:	74 28                	je     800a56 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a2e:	85 db                	test   %ebx,%ebx
+  800a30:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a35:	0f 44 d8             	cmove  %eax,%ebx
+  800a38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a3d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a40:	eb 46                	jmp    800a88 <strtol+0x90>
+		s++;
+  800a42:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a45:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a4a:	eb d5                	jmp    800a21 <strtol+0x29>
+		s++, neg = 1;
+  800a4c:	83 c2 01             	add    $0x1,%edx
+  800a4f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a54:	eb cb                	jmp    800a21 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a56:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a5a:	74 0e                	je     800a6a <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a5c:	85 db                	test   %ebx,%ebx
+  800a5e:	75 d8                	jne    800a38 <strtol+0x40>
+		s++, base = 8;
+  800a60:	83 c2 01             	add    $0x1,%edx
+  800a63:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a68:	eb ce                	jmp    800a38 <strtol+0x40>
+		s += 2, base = 16;
+  800a6a:	83 c2 02             	add    $0x2,%edx
+  800a6d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a72:	eb c4                	jmp    800a38 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a74:	0f be c0             	movsbl %al,%eax
+  800a77:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a7a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a7d:	7d 3a                	jge    800ab9 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a7f:	83 c2 01             	add    $0x1,%edx
+  800a82:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a86:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a88:	0f b6 02             	movzbl (%edx),%eax
+  800a8b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a8e:	89 f3                	mov    %esi,%ebx
+  800a90:	80 fb 09             	cmp    $0x9,%bl
+  800a93:	76 df                	jbe    800a74 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a95:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a98:	89 f3                	mov    %esi,%ebx
+  800a9a:	80 fb 19             	cmp    $0x19,%bl
+  800a9d:	77 08                	ja     800aa7 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a9f:	0f be c0             	movsbl %al,%eax
+  800aa2:	83 e8 57             	sub    $0x57,%eax
+  800aa5:	eb d3                	jmp    800a7a <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aa7:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aaa:	89 f3                	mov    %esi,%ebx
+  800aac:	80 fb 19             	cmp    $0x19,%bl
+  800aaf:	77 08                	ja     800ab9 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ab1:	0f be c0             	movsbl %al,%eax
+  800ab4:	83 e8 37             	sub    $0x37,%eax
+  800ab7:	eb c1                	jmp    800a7a <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ab9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800abd:	74 05                	je     800ac4 <strtol+0xcc>
+		*endptr = (char *) s;
+  800abf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ac2:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ac4:	89 c8                	mov    %ecx,%eax
+  800ac6:	f7 d8                	neg    %eax
+  800ac8:	85 ff                	test   %edi,%edi
+  800aca:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800acd:	89 c8                	mov    %ecx,%eax
+  800acf:	5b                   	pop    %ebx
+  800ad0:	5e                   	pop    %esi
+  800ad1:	5f                   	pop    %edi
+  800ad2:	5d                   	pop    %ebp
+  800ad3:	c3                   	ret
+
+00800ad4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ad4:	55                   	push   %ebp
+  800ad5:	89 e5                	mov    %esp,%ebp
+  800ad7:	57                   	push   %edi
+  800ad8:	56                   	push   %esi
+  800ad9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ada:	b8 00 00 00 00       	mov    $0x0,%eax
+  800adf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae5:	89 c3                	mov    %eax,%ebx
+  800ae7:	89 c7                	mov    %eax,%edi
+  800ae9:	89 c6                	mov    %eax,%esi
+  800aeb:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800aed:	5b                   	pop    %ebx
+  800aee:	5e                   	pop    %esi
+  800aef:	5f                   	pop    %edi
+  800af0:	5d                   	pop    %ebp
+  800af1:	c3                   	ret
+
+00800af2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800af2:	55                   	push   %ebp
+  800af3:	89 e5                	mov    %esp,%ebp
+  800af5:	57                   	push   %edi
+  800af6:	56                   	push   %esi
+  800af7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800af8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800afd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b02:	89 d1                	mov    %edx,%ecx
+  800b04:	89 d3                	mov    %edx,%ebx
+  800b06:	89 d7                	mov    %edx,%edi
+  800b08:	89 d6                	mov    %edx,%esi
+  800b0a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b0c:	5b                   	pop    %ebx
+  800b0d:	5e                   	pop    %esi
+  800b0e:	5f                   	pop    %edi
+  800b0f:	5d                   	pop    %ebp
+  800b10:	c3                   	ret
+
+00800b11 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b11:	55                   	push   %ebp
+  800b12:	89 e5                	mov    %esp,%ebp
+  800b14:	57                   	push   %edi
+  800b15:	56                   	push   %esi
+  800b16:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b24:	89 cb                	mov    %ecx,%ebx
+  800b26:	89 cf                	mov    %ecx,%edi
+  800b28:	89 ce                	mov    %ecx,%esi
+  800b2a:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b2c:	5b                   	pop    %ebx
+  800b2d:	5e                   	pop    %esi
+  800b2e:	5f                   	pop    %edi
+  800b2f:	5d                   	pop    %ebp
+  800b30:	c3                   	ret
+
+00800b31 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	57                   	push   %edi
+  800b35:	56                   	push   %esi
+  800b36:	53                   	push   %ebx
+  800b37:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b42:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b47:	89 cb                	mov    %ecx,%ebx
+  800b49:	89 cf                	mov    %ecx,%edi
+  800b4b:	89 ce                	mov    %ecx,%esi
+  800b4d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b4f:	85 c0                	test   %eax,%eax
+  800b51:	7f 08                	jg     800b5b <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b56:	5b                   	pop    %ebx
+  800b57:	5e                   	pop    %esi
+  800b58:	5f                   	pop    %edi
+  800b59:	5d                   	pop    %ebp
+  800b5a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b5b:	83 ec 0c             	sub    $0xc,%esp
+  800b5e:	50                   	push   %eax
+  800b5f:	6a 03                	push   $0x3
+  800b61:	68 df 30 80 00       	push   $0x8030df
+  800b66:	6a 23                	push   $0x23
+  800b68:	68 fc 30 80 00       	push   $0x8030fc
+  800b6d:	e8 69 f5 ff ff       	call   8000db <_panic>
+
+00800b72 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	57                   	push   %edi
+  800b76:	56                   	push   %esi
+  800b77:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b82:	89 d1                	mov    %edx,%ecx
+  800b84:	89 d3                	mov    %edx,%ebx
+  800b86:	89 d7                	mov    %edx,%edi
+  800b88:	89 d6                	mov    %edx,%esi
+  800b8a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b8c:	5b                   	pop    %ebx
+  800b8d:	5e                   	pop    %esi
+  800b8e:	5f                   	pop    %edi
+  800b8f:	5d                   	pop    %ebp
+  800b90:	c3                   	ret
+
+00800b91 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	57                   	push   %edi
+  800b95:	56                   	push   %esi
+  800b96:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b9c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800ba1:	89 d1                	mov    %edx,%ecx
+  800ba3:	89 d3                	mov    %edx,%ebx
+  800ba5:	89 d7                	mov    %edx,%edi
+  800ba7:	89 d6                	mov    %edx,%esi
+  800ba9:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bab:	5b                   	pop    %ebx
+  800bac:	5e                   	pop    %esi
+  800bad:	5f                   	pop    %edi
+  800bae:	5d                   	pop    %ebp
+  800baf:	c3                   	ret
+
+00800bb0 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800bb0:	55                   	push   %ebp
+  800bb1:	89 e5                	mov    %esp,%ebp
+  800bb3:	57                   	push   %edi
+  800bb4:	56                   	push   %esi
+  800bb5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bbb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800bc0:	89 d1                	mov    %edx,%ecx
+  800bc2:	89 d3                	mov    %edx,%ebx
+  800bc4:	89 d7                	mov    %edx,%edi
+  800bc6:	89 d6                	mov    %edx,%esi
+  800bc8:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800bca:	5b                   	pop    %ebx
+  800bcb:	5e                   	pop    %esi
+  800bcc:	5f                   	pop    %edi
+  800bcd:	5d                   	pop    %ebp
+  800bce:	c3                   	ret
+
+00800bcf <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800bcf:	55                   	push   %ebp
+  800bd0:	89 e5                	mov    %esp,%ebp
+  800bd2:	57                   	push   %edi
+  800bd3:	56                   	push   %esi
+  800bd4:	53                   	push   %ebx
+  800bd5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be3:	b8 15 00 00 00       	mov    $0x15,%eax
+  800be8:	89 df                	mov    %ebx,%edi
+  800bea:	89 de                	mov    %ebx,%esi
+  800bec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bee:	85 c0                	test   %eax,%eax
+  800bf0:	7f 08                	jg     800bfa <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800bf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bf5:	5b                   	pop    %ebx
+  800bf6:	5e                   	pop    %esi
+  800bf7:	5f                   	pop    %edi
+  800bf8:	5d                   	pop    %ebp
+  800bf9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bfa:	83 ec 0c             	sub    $0xc,%esp
+  800bfd:	50                   	push   %eax
+  800bfe:	6a 15                	push   $0x15
+  800c00:	68 df 30 80 00       	push   $0x8030df
+  800c05:	6a 23                	push   $0x23
+  800c07:	68 fc 30 80 00       	push   $0x8030fc
+  800c0c:	e8 ca f4 ff ff       	call   8000db <_panic>
+
+00800c11 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	57                   	push   %edi
+  800c15:	56                   	push   %esi
+  800c16:	53                   	push   %ebx
+  800c17:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c1a:	be 00 00 00 00       	mov    $0x0,%esi
+  800c1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c25:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c2d:	89 f7                	mov    %esi,%edi
+  800c2f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c31:	85 c0                	test   %eax,%eax
+  800c33:	7f 08                	jg     800c3d <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c38:	5b                   	pop    %ebx
+  800c39:	5e                   	pop    %esi
+  800c3a:	5f                   	pop    %edi
+  800c3b:	5d                   	pop    %ebp
+  800c3c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c3d:	83 ec 0c             	sub    $0xc,%esp
+  800c40:	50                   	push   %eax
+  800c41:	6a 05                	push   $0x5
+  800c43:	68 df 30 80 00       	push   $0x8030df
+  800c48:	6a 23                	push   $0x23
+  800c4a:	68 fc 30 80 00       	push   $0x8030fc
+  800c4f:	e8 87 f4 ff ff       	call   8000db <_panic>
+
+00800c54 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800c54:	55                   	push   %ebp
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	57                   	push   %edi
+  800c58:	56                   	push   %esi
+  800c59:	53                   	push   %ebx
+  800c5a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c5d:	be 00 00 00 00       	mov    $0x0,%esi
+  800c62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c68:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c70:	89 f7                	mov    %esi,%edi
+  800c72:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c74:	85 c0                	test   %eax,%eax
+  800c76:	7f 08                	jg     800c80 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c7b:	5b                   	pop    %ebx
+  800c7c:	5e                   	pop    %esi
+  800c7d:	5f                   	pop    %edi
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c80:	83 ec 0c             	sub    $0xc,%esp
+  800c83:	50                   	push   %eax
+  800c84:	6a 06                	push   $0x6
+  800c86:	68 df 30 80 00       	push   $0x8030df
+  800c8b:	6a 23                	push   $0x23
+  800c8d:	68 fc 30 80 00       	push   $0x8030fc
+  800c92:	e8 44 f4 ff ff       	call   8000db <_panic>
+
+00800c97 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c97:	55                   	push   %ebp
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	57                   	push   %edi
+  800c9b:	56                   	push   %esi
+  800c9c:	53                   	push   %ebx
+  800c9d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ca0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca6:	b8 07 00 00 00       	mov    $0x7,%eax
+  800cab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cb1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cb4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cb6:	85 c0                	test   %eax,%eax
+  800cb8:	7f 08                	jg     800cc2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbd:	5b                   	pop    %ebx
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5f                   	pop    %edi
+  800cc0:	5d                   	pop    %ebp
+  800cc1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc2:	83 ec 0c             	sub    $0xc,%esp
+  800cc5:	50                   	push   %eax
+  800cc6:	6a 07                	push   $0x7
+  800cc8:	68 df 30 80 00       	push   $0x8030df
+  800ccd:	6a 23                	push   $0x23
+  800ccf:	68 fc 30 80 00       	push   $0x8030fc
+  800cd4:	e8 02 f4 ff ff       	call   8000db <_panic>
+
+00800cd9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	57                   	push   %edi
+  800cdd:	56                   	push   %esi
+  800cde:	53                   	push   %ebx
+  800cdf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ce2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ced:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cf2:	89 df                	mov    %ebx,%edi
+  800cf4:	89 de                	mov    %ebx,%esi
+  800cf6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cf8:	85 c0                	test   %eax,%eax
+  800cfa:	7f 08                	jg     800d04 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cff:	5b                   	pop    %ebx
+  800d00:	5e                   	pop    %esi
+  800d01:	5f                   	pop    %edi
+  800d02:	5d                   	pop    %ebp
+  800d03:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d04:	83 ec 0c             	sub    $0xc,%esp
+  800d07:	50                   	push   %eax
+  800d08:	6a 08                	push   $0x8
+  800d0a:	68 df 30 80 00       	push   $0x8030df
+  800d0f:	6a 23                	push   $0x23
+  800d11:	68 fc 30 80 00       	push   $0x8030fc
+  800d16:	e8 c0 f3 ff ff       	call   8000db <_panic>
+
+00800d1b <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d1b:	55                   	push   %ebp
+  800d1c:	89 e5                	mov    %esp,%ebp
+  800d1e:	57                   	push   %edi
+  800d1f:	56                   	push   %esi
+  800d20:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d27:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d2c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d34:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d37:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d39:	5b                   	pop    %ebx
+  800d3a:	5e                   	pop    %esi
+  800d3b:	5f                   	pop    %edi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+
+00800d3e <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	57                   	push   %edi
+  800d42:	56                   	push   %esi
+  800d43:	53                   	push   %ebx
+  800d44:	8b 45 18             	mov    0x18(%ebp),%eax
+  800d47:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800d4a:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800d4f:	77 27                	ja     800d78 <sys_page_map_range+0x3a>
+  800d51:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800d57:	77 1f                	ja     800d78 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800d59:	c1 e0 0c             	shl    $0xc,%eax
+  800d5c:	89 c6                	mov    %eax,%esi
+  800d5e:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800d60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d66:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d6e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d71:	cd 30                	int    $0x30
+}
+  800d73:	5b                   	pop    %ebx
+  800d74:	5e                   	pop    %esi
+  800d75:	5f                   	pop    %edi
+  800d76:	5d                   	pop    %ebp
+  800d77:	c3                   	ret
+		return -E_INVAL;
+  800d78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d7d:	eb f4                	jmp    800d73 <sys_page_map_range+0x35>
+
+00800d7f <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800d7f:	55                   	push   %ebp
+  800d80:	89 e5                	mov    %esp,%ebp
+  800d82:	57                   	push   %edi
+  800d83:	56                   	push   %esi
+  800d84:	53                   	push   %ebx
+  800d85:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d93:	be 00 00 00 00       	mov    $0x0,%esi
+  800d98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d9e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da0:	85 c0                	test   %eax,%eax
+  800da2:	7f 08                	jg     800dac <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800da4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da7:	5b                   	pop    %ebx
+  800da8:	5e                   	pop    %esi
+  800da9:	5f                   	pop    %edi
+  800daa:	5d                   	pop    %ebp
+  800dab:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dac:	83 ec 0c             	sub    $0xc,%esp
+  800daf:	50                   	push   %eax
+  800db0:	6a 0c                	push   $0xc
+  800db2:	68 df 30 80 00       	push   $0x8030df
+  800db7:	6a 23                	push   $0x23
+  800db9:	68 fc 30 80 00       	push   $0x8030fc
+  800dbe:	e8 18 f3 ff ff       	call   8000db <_panic>
+
+00800dc3 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800dc3:	55                   	push   %ebp
+  800dc4:	89 e5                	mov    %esp,%ebp
+  800dc6:	57                   	push   %edi
+  800dc7:	56                   	push   %esi
+  800dc8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dc9:	be 00 00 00 00       	mov    $0x0,%esi
+  800dce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddc:	89 f7                	mov    %esi,%edi
+  800dde:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800de0:	5b                   	pop    %ebx
+  800de1:	5e                   	pop    %esi
+  800de2:	5f                   	pop    %edi
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+
+00800de5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+  800deb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dfe:	89 df                	mov    %ebx,%edi
+  800e00:	89 de                	mov    %ebx,%esi
+  800e02:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e04:	85 c0                	test   %eax,%eax
+  800e06:	7f 08                	jg     800e10 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e10:	83 ec 0c             	sub    $0xc,%esp
+  800e13:	50                   	push   %eax
+  800e14:	6a 0f                	push   $0xf
+  800e16:	68 df 30 80 00       	push   $0x8030df
+  800e1b:	6a 23                	push   $0x23
+  800e1d:	68 fc 30 80 00       	push   $0x8030fc
+  800e22:	e8 b4 f2 ff ff       	call   8000db <_panic>
+
+00800e27 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e40:	89 df                	mov    %ebx,%edi
+  800e42:	89 de                	mov    %ebx,%esi
+  800e44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e46:	85 c0                	test   %eax,%eax
+  800e48:	7f 08                	jg     800e52 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800e4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4d:	5b                   	pop    %ebx
+  800e4e:	5e                   	pop    %esi
+  800e4f:	5f                   	pop    %edi
+  800e50:	5d                   	pop    %ebp
+  800e51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e52:	83 ec 0c             	sub    $0xc,%esp
+  800e55:	50                   	push   %eax
+  800e56:	6a 10                	push   $0x10
+  800e58:	68 df 30 80 00       	push   $0x8030df
+  800e5d:	6a 23                	push   $0x23
+  800e5f:	68 fc 30 80 00       	push   $0x8030fc
+  800e64:	e8 72 f2 ff ff       	call   8000db <_panic>
+
+00800e69 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800e69:	55                   	push   %ebp
+  800e6a:	89 e5                	mov    %esp,%ebp
+  800e6c:	57                   	push   %edi
+  800e6d:	56                   	push   %esi
+  800e6e:	53                   	push   %ebx
+  800e6f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e82:	89 df                	mov    %ebx,%edi
+  800e84:	89 de                	mov    %ebx,%esi
+  800e86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e88:	85 c0                	test   %eax,%eax
+  800e8a:	7f 08                	jg     800e94 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800e8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5e                   	pop    %esi
+  800e91:	5f                   	pop    %edi
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e94:	83 ec 0c             	sub    $0xc,%esp
+  800e97:	50                   	push   %eax
+  800e98:	6a 11                	push   $0x11
+  800e9a:	68 df 30 80 00       	push   $0x8030df
+  800e9f:	6a 23                	push   $0x23
+  800ea1:	68 fc 30 80 00       	push   $0x8030fc
+  800ea6:	e8 30 f2 ff ff       	call   8000db <_panic>
+
+00800eab <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	57                   	push   %edi
+  800eaf:	56                   	push   %esi
+  800eb0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb6:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ebb:	89 d1                	mov    %edx,%ecx
+  800ebd:	89 d3                	mov    %edx,%ebx
+  800ebf:	89 d7                	mov    %edx,%edi
+  800ec1:	89 d6                	mov    %edx,%esi
+  800ec3:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+
+00800eca <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	56                   	push   %esi
+  800ecf:	53                   	push   %ebx
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ede:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ee3:	89 df                	mov    %ebx,%edi
+  800ee5:	89 de                	mov    %ebx,%esi
+  800ee7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee9:	85 c0                	test   %eax,%eax
+  800eeb:	7f 08                	jg     800ef5 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800eed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef0:	5b                   	pop    %ebx
+  800ef1:	5e                   	pop    %esi
+  800ef2:	5f                   	pop    %edi
+  800ef3:	5d                   	pop    %ebp
+  800ef4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef5:	83 ec 0c             	sub    $0xc,%esp
+  800ef8:	50                   	push   %eax
+  800ef9:	6a 13                	push   $0x13
+  800efb:	68 df 30 80 00       	push   $0x8030df
+  800f00:	6a 23                	push   $0x23
+  800f02:	68 fc 30 80 00       	push   $0x8030fc
+  800f07:	e8 cf f1 ff ff       	call   8000db <_panic>
+
+00800f0c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	57                   	push   %edi
+  800f10:	56                   	push   %esi
+  800f11:	53                   	push   %ebx
+  800f12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f20:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f25:	89 df                	mov    %ebx,%edi
+  800f27:	89 de                	mov    %ebx,%esi
+  800f29:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f2b:	85 c0                	test   %eax,%eax
+  800f2d:	7f 08                	jg     800f37 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f32:	5b                   	pop    %ebx
+  800f33:	5e                   	pop    %esi
+  800f34:	5f                   	pop    %edi
+  800f35:	5d                   	pop    %ebp
+  800f36:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+  800f3a:	50                   	push   %eax
+  800f3b:	6a 14                	push   $0x14
+  800f3d:	68 df 30 80 00       	push   $0x8030df
+  800f42:	6a 23                	push   $0x23
+  800f44:	68 fc 30 80 00       	push   $0x8030fc
+  800f49:	e8 8d f1 ff ff       	call   8000db <_panic>
+
+00800f4e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	57                   	push   %edi
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5a:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f5f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f67:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f6c:	5b                   	pop    %ebx
+  800f6d:	5e                   	pop    %esi
+  800f6e:	5f                   	pop    %edi
+  800f6f:	5d                   	pop    %ebp
+  800f70:	c3                   	ret
+
+00800f71 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f71:	55                   	push   %ebp
+  800f72:	89 e5                	mov    %esp,%ebp
+  800f74:	57                   	push   %edi
+  800f75:	56                   	push   %esi
+  800f76:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7d:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f82:	be 00 00 00 00       	mov    $0x0,%esi
+  800f87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f8d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f8f:	5b                   	pop    %ebx
+  800f90:	5e                   	pop    %esi
+  800f91:	5f                   	pop    %edi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+
+00800f94 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	57                   	push   %edi
+  800f98:	56                   	push   %esi
+  800f99:	53                   	push   %ebx
+  800f9a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa5:	b8 19 00 00 00       	mov    $0x19,%eax
+  800faa:	89 cb                	mov    %ecx,%ebx
+  800fac:	89 cf                	mov    %ecx,%edi
+  800fae:	89 ce                	mov    %ecx,%esi
+  800fb0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb2:	85 c0                	test   %eax,%eax
+  800fb4:	7f 08                	jg     800fbe <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800fb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb9:	5b                   	pop    %ebx
+  800fba:	5e                   	pop    %esi
+  800fbb:	5f                   	pop    %edi
+  800fbc:	5d                   	pop    %ebp
+  800fbd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+  800fc1:	50                   	push   %eax
+  800fc2:	6a 19                	push   $0x19
+  800fc4:	68 df 30 80 00       	push   $0x8030df
+  800fc9:	6a 23                	push   $0x23
+  800fcb:	68 fc 30 80 00       	push   $0x8030fc
+  800fd0:	e8 06 f1 ff ff       	call   8000db <_panic>
+
+00800fd5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fd5:	55                   	push   %ebp
+  800fd6:	89 e5                	mov    %esp,%ebp
+  800fd8:	57                   	push   %edi
+  800fd9:	56                   	push   %esi
+  800fda:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fe5:	89 d1                	mov    %edx,%ecx
+  800fe7:	89 d3                	mov    %edx,%ebx
+  800fe9:	89 d7                	mov    %edx,%edi
+  800feb:	89 d6                	mov    %edx,%esi
+  800fed:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fef:	5b                   	pop    %ebx
+  800ff0:	5e                   	pop    %esi
+  800ff1:	5f                   	pop    %edi
+  800ff2:	5d                   	pop    %ebp
+  800ff3:	c3                   	ret
+
+00800ff4 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  800ff4:	55                   	push   %ebp
+  800ff5:	89 e5                	mov    %esp,%ebp
+  800ff7:	57                   	push   %edi
+  800ff8:	56                   	push   %esi
+  800ff9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ffa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801002:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801005:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80100a:	89 df                	mov    %ebx,%edi
+  80100c:	89 de                	mov    %ebx,%esi
+  80100e:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801010:	5b                   	pop    %ebx
+  801011:	5e                   	pop    %esi
+  801012:	5f                   	pop    %edi
+  801013:	5d                   	pop    %ebp
+  801014:	c3                   	ret
+
+00801015 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	57                   	push   %edi
+  801019:	56                   	push   %esi
+  80101a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801020:	8b 55 08             	mov    0x8(%ebp),%edx
+  801023:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801026:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80102b:	89 df                	mov    %ebx,%edi
+  80102d:	89 de                	mov    %ebx,%esi
+  80102f:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801031:	5b                   	pop    %ebx
+  801032:	5e                   	pop    %esi
+  801033:	5f                   	pop    %edi
+  801034:	5d                   	pop    %ebp
+  801035:	c3                   	ret
+
+00801036 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801036:	55                   	push   %ebp
+  801037:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801039:	8b 45 08             	mov    0x8(%ebp),%eax
+  80103c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801041:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+
+00801046 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801049:	8b 45 08             	mov    0x8(%ebp),%eax
+  80104c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801056:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80105b:	5d                   	pop    %ebp
+  80105c:	c3                   	ret
+
+0080105d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80105d:	55                   	push   %ebp
+  80105e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801060:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801065:	eb 02                	jmp    801069 <fd_alloc+0xc>
+  801067:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801069:	89 c2                	mov    %eax,%edx
+  80106b:	c1 ea 16             	shr    $0x16,%edx
+  80106e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801075:	f6 c2 01             	test   $0x1,%dl
+  801078:	74 2b                	je     8010a5 <fd_alloc+0x48>
+  80107a:	89 c2                	mov    %eax,%edx
+  80107c:	c1 ea 0c             	shr    $0xc,%edx
+  80107f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801086:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80108c:	f6 c1 01             	test   $0x1,%cl
+  80108f:	74 14                	je     8010a5 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801091:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801097:	75 ce                	jne    801067 <fd_alloc+0xa>
+  801099:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80109e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8010a3:	eb 05                	jmp    8010aa <fd_alloc+0x4d>
+			return 0;
+  8010a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8010aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ad:	89 02                	mov    %eax,(%edx)
+}
+  8010af:	89 c8                	mov    %ecx,%eax
+  8010b1:	5d                   	pop    %ebp
+  8010b2:	c3                   	ret
+
+008010b3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8010b9:	83 f8 1f             	cmp    $0x1f,%eax
+  8010bc:	77 30                	ja     8010ee <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8010be:	c1 e0 0c             	shl    $0xc,%eax
+  8010c1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010c6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010cc:	f6 c2 01             	test   $0x1,%dl
+  8010cf:	74 24                	je     8010f5 <fd_lookup+0x42>
+  8010d1:	89 c2                	mov    %eax,%edx
+  8010d3:	c1 ea 0c             	shr    $0xc,%edx
+  8010d6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8010dd:	f6 c2 01             	test   $0x1,%dl
+  8010e0:	74 1a                	je     8010fc <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8010e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010e5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8010e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010ec:	5d                   	pop    %ebp
+  8010ed:	c3                   	ret
+		return -E_INVAL;
+  8010ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010f3:	eb f7                	jmp    8010ec <fd_lookup+0x39>
+		return -E_INVAL;
+  8010f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010fa:	eb f0                	jmp    8010ec <fd_lookup+0x39>
+  8010fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801101:	eb e9                	jmp    8010ec <fd_lookup+0x39>
+
+00801103 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801103:	55                   	push   %ebp
+  801104:	89 e5                	mov    %esp,%ebp
+  801106:	53                   	push   %ebx
+  801107:	83 ec 04             	sub    $0x4,%esp
+  80110a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80110d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801112:	eb 03                	jmp    801117 <dev_lookup+0x14>
+  801114:	83 c0 01             	add    $0x1,%eax
+  801117:	8b 1c 85 88 31 80 00 	mov    0x803188(,%eax,4),%ebx
+  80111e:	85 db                	test   %ebx,%ebx
+  801120:	74 0b                	je     80112d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801122:	39 13                	cmp    %edx,(%ebx)
+  801124:	75 ee                	jne    801114 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112b:	eb 1f                	jmp    80114c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80112d:	a1 08 50 80 00       	mov    0x805008,%eax
+  801132:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801135:	83 ec 04             	sub    $0x4,%esp
+  801138:	52                   	push   %edx
+  801139:	50                   	push   %eax
+  80113a:	68 0c 31 80 00       	push   $0x80310c
+  80113f:	e8 72 f0 ff ff       	call   8001b6 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801144:	83 c4 10             	add    $0x10,%esp
+  801147:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80114c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80114f:	89 1a                	mov    %ebx,(%edx)
+}
+  801151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801154:	c9                   	leave
+  801155:	c3                   	ret
+
+00801156 <fd_close>:
+{
+  801156:	55                   	push   %ebp
+  801157:	89 e5                	mov    %esp,%ebp
+  801159:	57                   	push   %edi
+  80115a:	56                   	push   %esi
+  80115b:	53                   	push   %ebx
+  80115c:	83 ec 24             	sub    $0x24,%esp
+  80115f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801162:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801165:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801168:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801169:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80116f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801172:	50                   	push   %eax
+  801173:	e8 3b ff ff ff       	call   8010b3 <fd_lookup>
+  801178:	89 c3                	mov    %eax,%ebx
+  80117a:	83 c4 10             	add    $0x10,%esp
+  80117d:	85 c0                	test   %eax,%eax
+  80117f:	78 05                	js     801186 <fd_close+0x30>
+	    || fd != fd2)
+  801181:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801184:	74 16                	je     80119c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801186:	89 f8                	mov    %edi,%eax
+  801188:	84 c0                	test   %al,%al
+  80118a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801192:	89 d8                	mov    %ebx,%eax
+  801194:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801197:	5b                   	pop    %ebx
+  801198:	5e                   	pop    %esi
+  801199:	5f                   	pop    %edi
+  80119a:	5d                   	pop    %ebp
+  80119b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80119c:	83 ec 08             	sub    $0x8,%esp
+  80119f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8011a2:	50                   	push   %eax
+  8011a3:	ff 36                	push   (%esi)
+  8011a5:	e8 59 ff ff ff       	call   801103 <dev_lookup>
+  8011aa:	89 c3                	mov    %eax,%ebx
+  8011ac:	83 c4 10             	add    $0x10,%esp
+  8011af:	85 c0                	test   %eax,%eax
+  8011b1:	78 1a                	js     8011cd <fd_close+0x77>
+		if (dev->dev_close)
+  8011b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8011b6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8011b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8011be:	85 c0                	test   %eax,%eax
+  8011c0:	74 0b                	je     8011cd <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8011c2:	83 ec 0c             	sub    $0xc,%esp
+  8011c5:	56                   	push   %esi
+  8011c6:	ff d0                	call   *%eax
+  8011c8:	89 c3                	mov    %eax,%ebx
+  8011ca:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8011cd:	83 ec 08             	sub    $0x8,%esp
+  8011d0:	56                   	push   %esi
+  8011d1:	6a 00                	push   $0x0
+  8011d3:	e8 01 fb ff ff       	call   800cd9 <sys_page_unmap>
+	return r;
+  8011d8:	83 c4 10             	add    $0x10,%esp
+  8011db:	eb b5                	jmp    801192 <fd_close+0x3c>
+
+008011dd <close>:
+
+int
+close(int fdnum)
+{
+  8011dd:	55                   	push   %ebp
+  8011de:	89 e5                	mov    %esp,%ebp
+  8011e0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8011e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011e6:	50                   	push   %eax
+  8011e7:	ff 75 08             	push   0x8(%ebp)
+  8011ea:	e8 c4 fe ff ff       	call   8010b3 <fd_lookup>
+  8011ef:	83 c4 10             	add    $0x10,%esp
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	79 02                	jns    8011f8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8011f6:	c9                   	leave
+  8011f7:	c3                   	ret
+		return fd_close(fd, 1);
+  8011f8:	83 ec 08             	sub    $0x8,%esp
+  8011fb:	6a 01                	push   $0x1
+  8011fd:	ff 75 f4             	push   -0xc(%ebp)
+  801200:	e8 51 ff ff ff       	call   801156 <fd_close>
+  801205:	83 c4 10             	add    $0x10,%esp
+  801208:	eb ec                	jmp    8011f6 <close+0x19>
+
+0080120a <close_all>:
+
+void
+close_all(void)
+{
+  80120a:	55                   	push   %ebp
+  80120b:	89 e5                	mov    %esp,%ebp
+  80120d:	53                   	push   %ebx
+  80120e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801211:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801216:	83 ec 0c             	sub    $0xc,%esp
+  801219:	53                   	push   %ebx
+  80121a:	e8 be ff ff ff       	call   8011dd <close>
+	for (i = 0; i < MAXFD; i++)
+  80121f:	83 c3 01             	add    $0x1,%ebx
+  801222:	83 c4 10             	add    $0x10,%esp
+  801225:	83 fb 20             	cmp    $0x20,%ebx
+  801228:	75 ec                	jne    801216 <close_all+0xc>
+}
+  80122a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80122d:	c9                   	leave
+  80122e:	c3                   	ret
+
+0080122f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80122f:	55                   	push   %ebp
+  801230:	89 e5                	mov    %esp,%ebp
+  801232:	57                   	push   %edi
+  801233:	56                   	push   %esi
+  801234:	53                   	push   %ebx
+  801235:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801238:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80123b:	50                   	push   %eax
+  80123c:	ff 75 08             	push   0x8(%ebp)
+  80123f:	e8 6f fe ff ff       	call   8010b3 <fd_lookup>
+  801244:	89 c3                	mov    %eax,%ebx
+  801246:	83 c4 10             	add    $0x10,%esp
+  801249:	85 c0                	test   %eax,%eax
+  80124b:	78 7f                	js     8012cc <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80124d:	83 ec 0c             	sub    $0xc,%esp
+  801250:	ff 75 0c             	push   0xc(%ebp)
+  801253:	e8 85 ff ff ff       	call   8011dd <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801258:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80125b:	c1 e6 0c             	shl    $0xc,%esi
+  80125e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801264:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801267:	89 3c 24             	mov    %edi,(%esp)
+  80126a:	e8 d7 fd ff ff       	call   801046 <fd2data>
+  80126f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801271:	89 34 24             	mov    %esi,(%esp)
+  801274:	e8 cd fd ff ff       	call   801046 <fd2data>
+  801279:	83 c4 10             	add    $0x10,%esp
+  80127c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80127f:	89 d8                	mov    %ebx,%eax
+  801281:	c1 e8 16             	shr    $0x16,%eax
+  801284:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80128b:	a8 01                	test   $0x1,%al
+  80128d:	74 11                	je     8012a0 <dup+0x71>
+  80128f:	89 d8                	mov    %ebx,%eax
+  801291:	c1 e8 0c             	shr    $0xc,%eax
+  801294:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80129b:	f6 c2 01             	test   $0x1,%dl
+  80129e:	75 36                	jne    8012d6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8012a0:	89 f8                	mov    %edi,%eax
+  8012a2:	c1 e8 0c             	shr    $0xc,%eax
+  8012a5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012ac:	83 ec 0c             	sub    $0xc,%esp
+  8012af:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012b4:	50                   	push   %eax
+  8012b5:	56                   	push   %esi
+  8012b6:	6a 00                	push   $0x0
+  8012b8:	57                   	push   %edi
+  8012b9:	6a 00                	push   $0x0
+  8012bb:	e8 d7 f9 ff ff       	call   800c97 <sys_page_map>
+  8012c0:	89 c3                	mov    %eax,%ebx
+  8012c2:	83 c4 20             	add    $0x20,%esp
+  8012c5:	85 c0                	test   %eax,%eax
+  8012c7:	78 33                	js     8012fc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8012c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8012cc:	89 d8                	mov    %ebx,%eax
+  8012ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d1:	5b                   	pop    %ebx
+  8012d2:	5e                   	pop    %esi
+  8012d3:	5f                   	pop    %edi
+  8012d4:	5d                   	pop    %ebp
+  8012d5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8012d6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012dd:	83 ec 0c             	sub    $0xc,%esp
+  8012e0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012e5:	50                   	push   %eax
+  8012e6:	ff 75 d4             	push   -0x2c(%ebp)
+  8012e9:	6a 00                	push   $0x0
+  8012eb:	53                   	push   %ebx
+  8012ec:	6a 00                	push   $0x0
+  8012ee:	e8 a4 f9 ff ff       	call   800c97 <sys_page_map>
+  8012f3:	89 c3                	mov    %eax,%ebx
+  8012f5:	83 c4 20             	add    $0x20,%esp
+  8012f8:	85 c0                	test   %eax,%eax
+  8012fa:	79 a4                	jns    8012a0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8012fc:	83 ec 08             	sub    $0x8,%esp
+  8012ff:	56                   	push   %esi
+  801300:	6a 00                	push   $0x0
+  801302:	e8 d2 f9 ff ff       	call   800cd9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801307:	83 c4 08             	add    $0x8,%esp
+  80130a:	ff 75 d4             	push   -0x2c(%ebp)
+  80130d:	6a 00                	push   $0x0
+  80130f:	e8 c5 f9 ff ff       	call   800cd9 <sys_page_unmap>
+	return r;
+  801314:	83 c4 10             	add    $0x10,%esp
+  801317:	eb b3                	jmp    8012cc <dup+0x9d>
+
+00801319 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801319:	55                   	push   %ebp
+  80131a:	89 e5                	mov    %esp,%ebp
+  80131c:	56                   	push   %esi
+  80131d:	53                   	push   %ebx
+  80131e:	83 ec 18             	sub    $0x18,%esp
+  801321:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801324:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801327:	50                   	push   %eax
+  801328:	56                   	push   %esi
+  801329:	e8 85 fd ff ff       	call   8010b3 <fd_lookup>
+  80132e:	83 c4 10             	add    $0x10,%esp
+  801331:	85 c0                	test   %eax,%eax
+  801333:	78 3c                	js     801371 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801335:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801338:	83 ec 08             	sub    $0x8,%esp
+  80133b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80133e:	50                   	push   %eax
+  80133f:	ff 33                	push   (%ebx)
+  801341:	e8 bd fd ff ff       	call   801103 <dev_lookup>
+  801346:	83 c4 10             	add    $0x10,%esp
+  801349:	85 c0                	test   %eax,%eax
+  80134b:	78 24                	js     801371 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80134d:	8b 43 08             	mov    0x8(%ebx),%eax
+  801350:	83 e0 03             	and    $0x3,%eax
+  801353:	83 f8 01             	cmp    $0x1,%eax
+  801356:	74 20                	je     801378 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801358:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80135b:	8b 40 08             	mov    0x8(%eax),%eax
+  80135e:	85 c0                	test   %eax,%eax
+  801360:	74 37                	je     801399 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801362:	83 ec 04             	sub    $0x4,%esp
+  801365:	ff 75 10             	push   0x10(%ebp)
+  801368:	ff 75 0c             	push   0xc(%ebp)
+  80136b:	53                   	push   %ebx
+  80136c:	ff d0                	call   *%eax
+  80136e:	83 c4 10             	add    $0x10,%esp
+}
+  801371:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801374:	5b                   	pop    %ebx
+  801375:	5e                   	pop    %esi
+  801376:	5d                   	pop    %ebp
+  801377:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801378:	a1 08 50 80 00       	mov    0x805008,%eax
+  80137d:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801380:	83 ec 04             	sub    $0x4,%esp
+  801383:	56                   	push   %esi
+  801384:	50                   	push   %eax
+  801385:	68 4d 31 80 00       	push   $0x80314d
+  80138a:	e8 27 ee ff ff       	call   8001b6 <cprintf>
+		return -E_INVAL;
+  80138f:	83 c4 10             	add    $0x10,%esp
+  801392:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801397:	eb d8                	jmp    801371 <read+0x58>
+		return -E_NOT_SUPP;
+  801399:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80139e:	eb d1                	jmp    801371 <read+0x58>
+
+008013a0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8013a0:	55                   	push   %ebp
+  8013a1:	89 e5                	mov    %esp,%ebp
+  8013a3:	57                   	push   %edi
+  8013a4:	56                   	push   %esi
+  8013a5:	53                   	push   %ebx
+  8013a6:	83 ec 0c             	sub    $0xc,%esp
+  8013a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013ac:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8013af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b4:	eb 02                	jmp    8013b8 <readn+0x18>
+  8013b6:	01 c3                	add    %eax,%ebx
+  8013b8:	39 f3                	cmp    %esi,%ebx
+  8013ba:	73 21                	jae    8013dd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8013bc:	83 ec 04             	sub    $0x4,%esp
+  8013bf:	89 f0                	mov    %esi,%eax
+  8013c1:	29 d8                	sub    %ebx,%eax
+  8013c3:	50                   	push   %eax
+  8013c4:	89 d8                	mov    %ebx,%eax
+  8013c6:	03 45 0c             	add    0xc(%ebp),%eax
+  8013c9:	50                   	push   %eax
+  8013ca:	57                   	push   %edi
+  8013cb:	e8 49 ff ff ff       	call   801319 <read>
+		if (m < 0)
+  8013d0:	83 c4 10             	add    $0x10,%esp
+  8013d3:	85 c0                	test   %eax,%eax
+  8013d5:	78 04                	js     8013db <readn+0x3b>
+			return m;
+		if (m == 0)
+  8013d7:	75 dd                	jne    8013b6 <readn+0x16>
+  8013d9:	eb 02                	jmp    8013dd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8013db:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8013dd:	89 d8                	mov    %ebx,%eax
+  8013df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e2:	5b                   	pop    %ebx
+  8013e3:	5e                   	pop    %esi
+  8013e4:	5f                   	pop    %edi
+  8013e5:	5d                   	pop    %ebp
+  8013e6:	c3                   	ret
+
+008013e7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	56                   	push   %esi
+  8013eb:	53                   	push   %ebx
+  8013ec:	83 ec 18             	sub    $0x18,%esp
+  8013ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013f2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013f5:	50                   	push   %eax
+  8013f6:	53                   	push   %ebx
+  8013f7:	e8 b7 fc ff ff       	call   8010b3 <fd_lookup>
+  8013fc:	83 c4 10             	add    $0x10,%esp
+  8013ff:	85 c0                	test   %eax,%eax
+  801401:	78 37                	js     80143a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801403:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801406:	83 ec 08             	sub    $0x8,%esp
+  801409:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80140c:	50                   	push   %eax
+  80140d:	ff 36                	push   (%esi)
+  80140f:	e8 ef fc ff ff       	call   801103 <dev_lookup>
+  801414:	83 c4 10             	add    $0x10,%esp
+  801417:	85 c0                	test   %eax,%eax
+  801419:	78 1f                	js     80143a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80141b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80141f:	74 20                	je     801441 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801421:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801424:	8b 40 0c             	mov    0xc(%eax),%eax
+  801427:	85 c0                	test   %eax,%eax
+  801429:	74 37                	je     801462 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80142b:	83 ec 04             	sub    $0x4,%esp
+  80142e:	ff 75 10             	push   0x10(%ebp)
+  801431:	ff 75 0c             	push   0xc(%ebp)
+  801434:	56                   	push   %esi
+  801435:	ff d0                	call   *%eax
+  801437:	83 c4 10             	add    $0x10,%esp
+}
+  80143a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80143d:	5b                   	pop    %ebx
+  80143e:	5e                   	pop    %esi
+  80143f:	5d                   	pop    %ebp
+  801440:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801441:	a1 08 50 80 00       	mov    0x805008,%eax
+  801446:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801449:	83 ec 04             	sub    $0x4,%esp
+  80144c:	53                   	push   %ebx
+  80144d:	50                   	push   %eax
+  80144e:	68 69 31 80 00       	push   $0x803169
+  801453:	e8 5e ed ff ff       	call   8001b6 <cprintf>
+		return -E_INVAL;
+  801458:	83 c4 10             	add    $0x10,%esp
+  80145b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801460:	eb d8                	jmp    80143a <write+0x53>
+		return -E_NOT_SUPP;
+  801462:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801467:	eb d1                	jmp    80143a <write+0x53>
+
+00801469 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801469:	55                   	push   %ebp
+  80146a:	89 e5                	mov    %esp,%ebp
+  80146c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80146f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801472:	50                   	push   %eax
+  801473:	ff 75 08             	push   0x8(%ebp)
+  801476:	e8 38 fc ff ff       	call   8010b3 <fd_lookup>
+  80147b:	83 c4 10             	add    $0x10,%esp
+  80147e:	85 c0                	test   %eax,%eax
+  801480:	78 0e                	js     801490 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801482:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801485:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801488:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80148b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801490:	c9                   	leave
+  801491:	c3                   	ret
+
+00801492 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801492:	55                   	push   %ebp
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	56                   	push   %esi
+  801496:	53                   	push   %ebx
+  801497:	83 ec 18             	sub    $0x18,%esp
+  80149a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80149d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014a0:	50                   	push   %eax
+  8014a1:	53                   	push   %ebx
+  8014a2:	e8 0c fc ff ff       	call   8010b3 <fd_lookup>
+  8014a7:	83 c4 10             	add    $0x10,%esp
+  8014aa:	85 c0                	test   %eax,%eax
+  8014ac:	78 34                	js     8014e2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014ae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014b1:	83 ec 08             	sub    $0x8,%esp
+  8014b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014b7:	50                   	push   %eax
+  8014b8:	ff 36                	push   (%esi)
+  8014ba:	e8 44 fc ff ff       	call   801103 <dev_lookup>
+  8014bf:	83 c4 10             	add    $0x10,%esp
+  8014c2:	85 c0                	test   %eax,%eax
+  8014c4:	78 1c                	js     8014e2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014c6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014ca:	74 1d                	je     8014e9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8014cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014cf:	8b 40 18             	mov    0x18(%eax),%eax
+  8014d2:	85 c0                	test   %eax,%eax
+  8014d4:	74 34                	je     80150a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8014d6:	83 ec 08             	sub    $0x8,%esp
+  8014d9:	ff 75 0c             	push   0xc(%ebp)
+  8014dc:	56                   	push   %esi
+  8014dd:	ff d0                	call   *%eax
+  8014df:	83 c4 10             	add    $0x10,%esp
+}
+  8014e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014e5:	5b                   	pop    %ebx
+  8014e6:	5e                   	pop    %esi
+  8014e7:	5d                   	pop    %ebp
+  8014e8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8014e9:	a1 08 50 80 00       	mov    0x805008,%eax
+  8014ee:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8014f1:	83 ec 04             	sub    $0x4,%esp
+  8014f4:	53                   	push   %ebx
+  8014f5:	50                   	push   %eax
+  8014f6:	68 2c 31 80 00       	push   $0x80312c
+  8014fb:	e8 b6 ec ff ff       	call   8001b6 <cprintf>
+		return -E_INVAL;
+  801500:	83 c4 10             	add    $0x10,%esp
+  801503:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801508:	eb d8                	jmp    8014e2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80150a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80150f:	eb d1                	jmp    8014e2 <ftruncate+0x50>
+
+00801511 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801511:	55                   	push   %ebp
+  801512:	89 e5                	mov    %esp,%ebp
+  801514:	56                   	push   %esi
+  801515:	53                   	push   %ebx
+  801516:	83 ec 18             	sub    $0x18,%esp
+  801519:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80151c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80151f:	50                   	push   %eax
+  801520:	ff 75 08             	push   0x8(%ebp)
+  801523:	e8 8b fb ff ff       	call   8010b3 <fd_lookup>
+  801528:	83 c4 10             	add    $0x10,%esp
+  80152b:	85 c0                	test   %eax,%eax
+  80152d:	78 49                	js     801578 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80152f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801532:	83 ec 08             	sub    $0x8,%esp
+  801535:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801538:	50                   	push   %eax
+  801539:	ff 36                	push   (%esi)
+  80153b:	e8 c3 fb ff ff       	call   801103 <dev_lookup>
+  801540:	83 c4 10             	add    $0x10,%esp
+  801543:	85 c0                	test   %eax,%eax
+  801545:	78 31                	js     801578 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801547:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80154a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80154e:	74 2f                	je     80157f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801550:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801553:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80155a:	00 00 00 
+	stat->st_isdir = 0;
+  80155d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801564:	00 00 00 
+	stat->st_dev = dev;
+  801567:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80156d:	83 ec 08             	sub    $0x8,%esp
+  801570:	53                   	push   %ebx
+  801571:	56                   	push   %esi
+  801572:	ff 50 14             	call   *0x14(%eax)
+  801575:	83 c4 10             	add    $0x10,%esp
+}
+  801578:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80157b:	5b                   	pop    %ebx
+  80157c:	5e                   	pop    %esi
+  80157d:	5d                   	pop    %ebp
+  80157e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80157f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801584:	eb f2                	jmp    801578 <fstat+0x67>
+
+00801586 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801586:	55                   	push   %ebp
+  801587:	89 e5                	mov    %esp,%ebp
+  801589:	56                   	push   %esi
+  80158a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80158b:	83 ec 08             	sub    $0x8,%esp
+  80158e:	6a 00                	push   $0x0
+  801590:	ff 75 08             	push   0x8(%ebp)
+  801593:	e8 e4 01 00 00       	call   80177c <open>
+  801598:	89 c3                	mov    %eax,%ebx
+  80159a:	83 c4 10             	add    $0x10,%esp
+  80159d:	85 c0                	test   %eax,%eax
+  80159f:	78 1b                	js     8015bc <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8015a1:	83 ec 08             	sub    $0x8,%esp
+  8015a4:	ff 75 0c             	push   0xc(%ebp)
+  8015a7:	50                   	push   %eax
+  8015a8:	e8 64 ff ff ff       	call   801511 <fstat>
+  8015ad:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8015af:	89 1c 24             	mov    %ebx,(%esp)
+  8015b2:	e8 26 fc ff ff       	call   8011dd <close>
+	return r;
+  8015b7:	83 c4 10             	add    $0x10,%esp
+  8015ba:	89 f3                	mov    %esi,%ebx
+}
+  8015bc:	89 d8                	mov    %ebx,%eax
+  8015be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c1:	5b                   	pop    %ebx
+  8015c2:	5e                   	pop    %esi
+  8015c3:	5d                   	pop    %ebp
+  8015c4:	c3                   	ret
+
+008015c5 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8015c5:	55                   	push   %ebp
+  8015c6:	89 e5                	mov    %esp,%ebp
+  8015c8:	56                   	push   %esi
+  8015c9:	53                   	push   %ebx
+  8015ca:	89 c6                	mov    %eax,%esi
+  8015cc:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8015ce:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8015d5:	74 27                	je     8015fe <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8015d7:	6a 07                	push   $0x7
+  8015d9:	68 00 60 80 00       	push   $0x806000
+  8015de:	56                   	push   %esi
+  8015df:	ff 35 00 50 80 00    	push   0x805000
+  8015e5:	e8 75 12 00 00       	call   80285f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8015ea:	83 c4 0c             	add    $0xc,%esp
+  8015ed:	6a 00                	push   $0x0
+  8015ef:	53                   	push   %ebx
+  8015f0:	6a 00                	push   $0x0
+  8015f2:	e8 f0 11 00 00       	call   8027e7 <ipc_recv>
+}
+  8015f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015fa:	5b                   	pop    %ebx
+  8015fb:	5e                   	pop    %esi
+  8015fc:	5d                   	pop    %ebp
+  8015fd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8015fe:	83 ec 0c             	sub    $0xc,%esp
+  801601:	6a 01                	push   $0x1
+  801603:	e8 ab 12 00 00       	call   8028b3 <ipc_find_env>
+  801608:	a3 00 50 80 00       	mov    %eax,0x805000
+  80160d:	83 c4 10             	add    $0x10,%esp
+  801610:	eb c5                	jmp    8015d7 <fsipc+0x12>
+
+00801612 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801612:	55                   	push   %ebp
+  801613:	89 e5                	mov    %esp,%ebp
+  801615:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801618:	8b 45 08             	mov    0x8(%ebp),%eax
+  80161b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80161e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801623:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801626:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80162b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801630:	b8 02 00 00 00       	mov    $0x2,%eax
+  801635:	e8 8b ff ff ff       	call   8015c5 <fsipc>
+}
+  80163a:	c9                   	leave
+  80163b:	c3                   	ret
+
+0080163c <devfile_flush>:
+{
+  80163c:	55                   	push   %ebp
+  80163d:	89 e5                	mov    %esp,%ebp
+  80163f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801642:	8b 45 08             	mov    0x8(%ebp),%eax
+  801645:	8b 40 0c             	mov    0xc(%eax),%eax
+  801648:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80164d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801652:	b8 06 00 00 00       	mov    $0x6,%eax
+  801657:	e8 69 ff ff ff       	call   8015c5 <fsipc>
+}
+  80165c:	c9                   	leave
+  80165d:	c3                   	ret
+
+0080165e <devfile_stat>:
+{
+  80165e:	55                   	push   %ebp
+  80165f:	89 e5                	mov    %esp,%ebp
+  801661:	53                   	push   %ebx
+  801662:	83 ec 04             	sub    $0x4,%esp
+  801665:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801668:	8b 45 08             	mov    0x8(%ebp),%eax
+  80166b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80166e:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801673:	ba 00 00 00 00       	mov    $0x0,%edx
+  801678:	b8 05 00 00 00       	mov    $0x5,%eax
+  80167d:	e8 43 ff ff ff       	call   8015c5 <fsipc>
+  801682:	85 c0                	test   %eax,%eax
+  801684:	78 2c                	js     8016b2 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801686:	83 ec 08             	sub    $0x8,%esp
+  801689:	68 00 60 80 00       	push   $0x806000
+  80168e:	53                   	push   %ebx
+  80168f:	e8 10 f1 ff ff       	call   8007a4 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801694:	a1 80 60 80 00       	mov    0x806080,%eax
+  801699:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80169f:	a1 84 60 80 00       	mov    0x806084,%eax
+  8016a4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8016aa:	83 c4 10             	add    $0x10,%esp
+  8016ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016b5:	c9                   	leave
+  8016b6:	c3                   	ret
+
+008016b7 <devfile_write>:
+{
+  8016b7:	55                   	push   %ebp
+  8016b8:	89 e5                	mov    %esp,%ebp
+  8016ba:	83 ec 0c             	sub    $0xc,%esp
+  8016bd:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8016c0:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8016c5:	39 d0                	cmp    %edx,%eax
+  8016c7:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8016ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016cd:	8b 52 0c             	mov    0xc(%edx),%edx
+  8016d0:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8016d6:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8016db:	50                   	push   %eax
+  8016dc:	ff 75 0c             	push   0xc(%ebp)
+  8016df:	68 08 60 80 00       	push   $0x806008
+  8016e4:	e8 41 f2 ff ff       	call   80092a <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8016e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ee:	b8 04 00 00 00       	mov    $0x4,%eax
+  8016f3:	e8 cd fe ff ff       	call   8015c5 <fsipc>
+}
+  8016f8:	c9                   	leave
+  8016f9:	c3                   	ret
+
+008016fa <devfile_read>:
+{
+  8016fa:	55                   	push   %ebp
+  8016fb:	89 e5                	mov    %esp,%ebp
+  8016fd:	56                   	push   %esi
+  8016fe:	53                   	push   %ebx
+  8016ff:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801702:	8b 45 08             	mov    0x8(%ebp),%eax
+  801705:	8b 40 0c             	mov    0xc(%eax),%eax
+  801708:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80170d:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801713:	ba 00 00 00 00       	mov    $0x0,%edx
+  801718:	b8 03 00 00 00       	mov    $0x3,%eax
+  80171d:	e8 a3 fe ff ff       	call   8015c5 <fsipc>
+  801722:	89 c3                	mov    %eax,%ebx
+  801724:	85 c0                	test   %eax,%eax
+  801726:	78 1f                	js     801747 <devfile_read+0x4d>
+	assert(r <= n);
+  801728:	39 c6                	cmp    %eax,%esi
+  80172a:	72 24                	jb     801750 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80172c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801731:	7f 33                	jg     801766 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801733:	83 ec 04             	sub    $0x4,%esp
+  801736:	50                   	push   %eax
+  801737:	68 00 60 80 00       	push   $0x806000
+  80173c:	ff 75 0c             	push   0xc(%ebp)
+  80173f:	e8 e6 f1 ff ff       	call   80092a <memmove>
+	return r;
+  801744:	83 c4 10             	add    $0x10,%esp
+}
+  801747:	89 d8                	mov    %ebx,%eax
+  801749:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80174c:	5b                   	pop    %ebx
+  80174d:	5e                   	pop    %esi
+  80174e:	5d                   	pop    %ebp
+  80174f:	c3                   	ret
+	assert(r <= n);
+  801750:	68 9c 31 80 00       	push   $0x80319c
+  801755:	68 a3 31 80 00       	push   $0x8031a3
+  80175a:	6a 7c                	push   $0x7c
+  80175c:	68 b8 31 80 00       	push   $0x8031b8
+  801761:	e8 75 e9 ff ff       	call   8000db <_panic>
+	assert(r <= PGSIZE);
+  801766:	68 c3 31 80 00       	push   $0x8031c3
+  80176b:	68 a3 31 80 00       	push   $0x8031a3
+  801770:	6a 7d                	push   $0x7d
+  801772:	68 b8 31 80 00       	push   $0x8031b8
+  801777:	e8 5f e9 ff ff       	call   8000db <_panic>
+
+0080177c <open>:
+{
+  80177c:	55                   	push   %ebp
+  80177d:	89 e5                	mov    %esp,%ebp
+  80177f:	56                   	push   %esi
+  801780:	53                   	push   %ebx
+  801781:	83 ec 1c             	sub    $0x1c,%esp
+  801784:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801787:	56                   	push   %esi
+  801788:	e8 dc ef ff ff       	call   800769 <strlen>
+  80178d:	83 c4 10             	add    $0x10,%esp
+  801790:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801795:	7f 6c                	jg     801803 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801797:	83 ec 0c             	sub    $0xc,%esp
+  80179a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80179d:	50                   	push   %eax
+  80179e:	e8 ba f8 ff ff       	call   80105d <fd_alloc>
+  8017a3:	89 c3                	mov    %eax,%ebx
+  8017a5:	83 c4 10             	add    $0x10,%esp
+  8017a8:	85 c0                	test   %eax,%eax
+  8017aa:	78 3c                	js     8017e8 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8017ac:	83 ec 08             	sub    $0x8,%esp
+  8017af:	56                   	push   %esi
+  8017b0:	68 00 60 80 00       	push   $0x806000
+  8017b5:	e8 ea ef ff ff       	call   8007a4 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8017ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017bd:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8017c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8017c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017ca:	e8 f6 fd ff ff       	call   8015c5 <fsipc>
+  8017cf:	89 c3                	mov    %eax,%ebx
+  8017d1:	83 c4 10             	add    $0x10,%esp
+  8017d4:	85 c0                	test   %eax,%eax
+  8017d6:	78 19                	js     8017f1 <open+0x75>
+	return fd2num(fd);
+  8017d8:	83 ec 0c             	sub    $0xc,%esp
+  8017db:	ff 75 f4             	push   -0xc(%ebp)
+  8017de:	e8 53 f8 ff ff       	call   801036 <fd2num>
+  8017e3:	89 c3                	mov    %eax,%ebx
+  8017e5:	83 c4 10             	add    $0x10,%esp
+}
+  8017e8:	89 d8                	mov    %ebx,%eax
+  8017ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ed:	5b                   	pop    %ebx
+  8017ee:	5e                   	pop    %esi
+  8017ef:	5d                   	pop    %ebp
+  8017f0:	c3                   	ret
+		fd_close(fd, 0);
+  8017f1:	83 ec 08             	sub    $0x8,%esp
+  8017f4:	6a 00                	push   $0x0
+  8017f6:	ff 75 f4             	push   -0xc(%ebp)
+  8017f9:	e8 58 f9 ff ff       	call   801156 <fd_close>
+		return r;
+  8017fe:	83 c4 10             	add    $0x10,%esp
+  801801:	eb e5                	jmp    8017e8 <open+0x6c>
+		return -E_BAD_PATH;
+  801803:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801808:	eb de                	jmp    8017e8 <open+0x6c>
+
+0080180a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801810:	ba 00 00 00 00       	mov    $0x0,%edx
+  801815:	b8 08 00 00 00       	mov    $0x8,%eax
+  80181a:	e8 a6 fd ff ff       	call   8015c5 <fsipc>
+}
+  80181f:	c9                   	leave
+  801820:	c3                   	ret
+
+00801821 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  801821:	55                   	push   %ebp
+  801822:	89 e5                	mov    %esp,%ebp
+  801824:	57                   	push   %edi
+  801825:	56                   	push   %esi
+  801826:	53                   	push   %ebx
+  801827:	81 ec 94 02 00 00    	sub    $0x294,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  80182d:	6a 00                	push   $0x0
+  80182f:	ff 75 08             	push   0x8(%ebp)
+  801832:	e8 45 ff ff ff       	call   80177c <open>
+  801837:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  80183d:	83 c4 10             	add    $0x10,%esp
+  801840:	85 c0                	test   %eax,%eax
+  801842:	0f 88 d0 05 00 00    	js     801e18 <spawn+0x5f7>
+  801848:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  80184a:	83 ec 04             	sub    $0x4,%esp
+  80184d:	68 00 02 00 00       	push   $0x200
+  801852:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801858:	50                   	push   %eax
+  801859:	51                   	push   %ecx
+  80185a:	e8 41 fb ff ff       	call   8013a0 <readn>
+  80185f:	83 c4 10             	add    $0x10,%esp
+  801862:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801867:	75 73                	jne    8018dc <spawn+0xbb>
+	    || elf->e_magic != ELF_MAGIC) {
+  801869:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801870:	45 4c 46 
+  801873:	75 67                	jne    8018dc <spawn+0xbb>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801875:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80187a:	cd 30                	int    $0x30
+  80187c:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  801882:	85 c0                	test   %eax,%eax
+  801884:	0f 88 82 05 00 00    	js     801e0c <spawn+0x5eb>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  80188a:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80188f:	89 c6                	mov    %eax,%esi
+  801891:	c1 e6 09             	shl    $0x9,%esi
+  801894:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80189a:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8018a0:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8018a5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  8018a7:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8018ad:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  8018b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  8018b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018bd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8018c0:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  8018c3:	85 c0                	test   %eax,%eax
+  8018c5:	74 4d                	je     801914 <spawn+0xf3>
+		string_size += strlen(argv[argc]) + 1;
+  8018c7:	83 ec 0c             	sub    $0xc,%esp
+  8018ca:	50                   	push   %eax
+  8018cb:	e8 99 ee ff ff       	call   800769 <strlen>
+  8018d0:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8018d4:	83 c3 01             	add    $0x1,%ebx
+  8018d7:	83 c4 10             	add    $0x10,%esp
+  8018da:	eb e4                	jmp    8018c0 <spawn+0x9f>
+		close(fd);
+  8018dc:	83 ec 0c             	sub    $0xc,%esp
+  8018df:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  8018e5:	e8 f3 f8 ff ff       	call   8011dd <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8018ea:	83 c4 0c             	add    $0xc,%esp
+  8018ed:	68 7f 45 4c 46       	push   $0x464c457f
+  8018f2:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8018f8:	68 cf 31 80 00       	push   $0x8031cf
+  8018fd:	e8 b4 e8 ff ff       	call   8001b6 <cprintf>
+		return -E_NOT_EXEC;
+  801902:	83 c4 10             	add    $0x10,%esp
+  801905:	c7 85 80 fd ff ff f2 	movl   $0xfffffff2,-0x280(%ebp)
+  80190c:	ff ff ff 
+  80190f:	e9 04 05 00 00       	jmp    801e18 <spawn+0x5f7>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  801914:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  80191a:	bf 00 10 40 00       	mov    $0x401000,%edi
+  80191f:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  801921:	89 fa                	mov    %edi,%edx
+  801923:	83 e2 fc             	and    $0xfffffffc,%edx
+  801926:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  80192d:	29 c2                	sub    %eax,%edx
+  80192f:	89 95 90 fd ff ff    	mov    %edx,-0x270(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  801935:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801938:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80193d:	0f 86 e3 04 00 00    	jbe    801e26 <spawn+0x605>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801943:	83 ec 04             	sub    $0x4,%esp
+  801946:	6a 07                	push   $0x7
+  801948:	68 00 00 40 00       	push   $0x400000
+  80194d:	6a 00                	push   $0x0
+  80194f:	e8 bd f2 ff ff       	call   800c11 <sys_page_alloc>
+  801954:	83 c4 10             	add    $0x10,%esp
+  801957:	85 c0                	test   %eax,%eax
+  801959:	0f 88 cc 04 00 00    	js     801e2b <spawn+0x60a>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  80195f:	be 00 00 00 00       	mov    $0x0,%esi
+  801964:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  80196a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80196d:	eb 30                	jmp    80199f <spawn+0x17e>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  80196f:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801975:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  80197b:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  80197e:	83 ec 08             	sub    $0x8,%esp
+  801981:	ff 34 b3             	push   (%ebx,%esi,4)
+  801984:	57                   	push   %edi
+  801985:	e8 1a ee ff ff       	call   8007a4 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  80198a:	83 c4 04             	add    $0x4,%esp
+  80198d:	ff 34 b3             	push   (%ebx,%esi,4)
+  801990:	e8 d4 ed ff ff       	call   800769 <strlen>
+  801995:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  801999:	83 c6 01             	add    $0x1,%esi
+  80199c:	83 c4 10             	add    $0x10,%esp
+  80199f:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  8019a5:	7f c8                	jg     80196f <spawn+0x14e>
+	}
+	argv_store[argc] = 0;
+  8019a7:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  8019ad:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  8019b3:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8019ba:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  8019c0:	0f 85 81 00 00 00    	jne    801a47 <spawn+0x226>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8019c6:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  8019cc:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  8019d2:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  8019d5:	89 c8                	mov    %ecx,%eax
+  8019d7:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  8019dd:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8019e0:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8019e5:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8019eb:	83 ec 0c             	sub    $0xc,%esp
+  8019ee:	6a 07                	push   $0x7
+  8019f0:	68 00 d0 bf ee       	push   $0xeebfd000
+  8019f5:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  8019fb:	68 00 00 40 00       	push   $0x400000
+  801a00:	6a 00                	push   $0x0
+  801a02:	e8 90 f2 ff ff       	call   800c97 <sys_page_map>
+  801a07:	89 c3                	mov    %eax,%ebx
+  801a09:	83 c4 20             	add    $0x20,%esp
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	0f 88 1f 04 00 00    	js     801e33 <spawn+0x612>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801a14:	83 ec 08             	sub    $0x8,%esp
+  801a17:	68 00 00 40 00       	push   $0x400000
+  801a1c:	6a 00                	push   $0x0
+  801a1e:	e8 b6 f2 ff ff       	call   800cd9 <sys_page_unmap>
+  801a23:	89 c3                	mov    %eax,%ebx
+  801a25:	83 c4 10             	add    $0x10,%esp
+  801a28:	85 c0                	test   %eax,%eax
+  801a2a:	0f 88 03 04 00 00    	js     801e33 <spawn+0x612>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  801a30:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  801a36:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801a3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a42:	e9 87 01 00 00       	jmp    801bce <spawn+0x3ad>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801a47:	68 40 32 80 00       	push   $0x803240
+  801a4c:	68 a3 31 80 00       	push   $0x8031a3
+  801a51:	68 f1 00 00 00       	push   $0xf1
+  801a56:	68 e9 31 80 00       	push   $0x8031e9
+  801a5b:	e8 7b e6 ff ff       	call   8000db <_panic>
+	}
+
+	// from file, as many pages at a time as fit below PFTEMP
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+		for (j = 0; j < n; j += r)
+  801a60:	01 c6                	add    %eax,%esi
+  801a62:	39 f3                	cmp    %esi,%ebx
+  801a64:	7e 4c                	jle    801ab2 <spawn+0x291>
+			if ((r = sys_page_alloc_range(0, UTEMP + j * PGSIZE, n - j, PTE_P|PTE_U|PTE_W)) < 0)
+  801a66:	6a 07                	push   $0x7
+  801a68:	89 d8                	mov    %ebx,%eax
+  801a6a:	29 f0                	sub    %esi,%eax
+  801a6c:	50                   	push   %eax
+  801a6d:	89 f0                	mov    %esi,%eax
+  801a6f:	c1 e0 0c             	shl    $0xc,%eax
+  801a72:	05 00 00 40 00       	add    $0x400000,%eax
+  801a77:	50                   	push   %eax
+  801a78:	6a 00                	push   $0x0
+  801a7a:	e8 9c f2 ff ff       	call   800d1b <sys_page_alloc_range>
+  801a7f:	83 c4 10             	add    $0x10,%esp
+  801a82:	85 c0                	test   %eax,%eax
+  801a84:	79 da                	jns    801a60 <spawn+0x23f>
+  801a86:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  801a88:	83 ec 0c             	sub    $0xc,%esp
+  801a8b:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801a91:	e8 9b f0 ff ff       	call   800b31 <sys_env_destroy>
+	close(fd);
+  801a96:	83 c4 04             	add    $0x4,%esp
+  801a99:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  801a9f:	e8 39 f7 ff ff       	call   8011dd <close>
+	return r;
+  801aa4:	83 c4 10             	add    $0x10,%esp
+  801aa7:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  801aad:	e9 66 03 00 00       	jmp    801e18 <spawn+0x5f7>
+				return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  801ab2:	83 ec 08             	sub    $0x8,%esp
+  801ab5:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  801abb:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  801ac1:	01 c8                	add    %ecx,%eax
+  801ac3:	50                   	push   %eax
+  801ac4:	8b b5 80 fd ff ff    	mov    -0x280(%ebp),%esi
+  801aca:	56                   	push   %esi
+  801acb:	e8 99 f9 ff ff       	call   801469 <seek>
+  801ad0:	83 c4 10             	add    $0x10,%esp
+  801ad3:	85 c0                	test   %eax,%eax
+  801ad5:	0f 88 cd 01 00 00    	js     801ca8 <spawn+0x487>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  801adb:	89 d8                	mov    %ebx,%eax
+  801add:	c1 e0 0c             	shl    $0xc,%eax
+  801ae0:	89 85 74 fd ff ff    	mov    %eax,-0x28c(%ebp)
+  801ae6:	83 ec 04             	sub    $0x4,%esp
+  801ae9:	39 f8                	cmp    %edi,%eax
+  801aeb:	0f 46 f8             	cmovbe %eax,%edi
+  801aee:	57                   	push   %edi
+  801aef:	68 00 00 40 00       	push   $0x400000
+  801af4:	56                   	push   %esi
+  801af5:	e8 a6 f8 ff ff       	call   8013a0 <readn>
+  801afa:	83 c4 10             	add    $0x10,%esp
+  801afd:	85 c0                	test   %eax,%eax
+  801aff:	0f 88 aa 01 00 00    	js     801caf <spawn+0x48e>
+			return r;
+		for (j = 0; j < n; j += r)
+  801b05:	be 00 00 00 00       	mov    $0x0,%esi
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  801b0a:	8b bd 84 fd ff ff    	mov    -0x27c(%ebp),%edi
+  801b10:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  801b16:	01 c7                	add    %eax,%edi
+		for (j = 0; j < n; j += r)
+  801b18:	39 f3                	cmp    %esi,%ebx
+  801b1a:	7e 4a                	jle    801b66 <spawn+0x345>
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  801b1c:	89 f0                	mov    %esi,%eax
+  801b1e:	c1 e0 0c             	shl    $0xc,%eax
+  801b21:	83 ec 08             	sub    $0x8,%esp
+  801b24:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  801b2a:	89 da                	mov    %ebx,%edx
+  801b2c:	29 f2                	sub    %esi,%edx
+  801b2e:	52                   	push   %edx
+  801b2f:	8d 14 07             	lea    (%edi,%eax,1),%edx
+  801b32:	52                   	push   %edx
+  801b33:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801b39:	05 00 00 40 00       	add    $0x400000,%eax
+  801b3e:	50                   	push   %eax
+  801b3f:	6a 00                	push   $0x0
+  801b41:	e8 f8 f1 ff ff       	call   800d3e <sys_page_map_range>
+  801b46:	83 c4 20             	add    $0x20,%esp
+  801b49:	85 c0                	test   %eax,%eax
+  801b4b:	78 04                	js     801b51 <spawn+0x330>
+		for (j = 0; j < n; j += r)
+  801b4d:	01 c6                	add    %eax,%esi
+  801b4f:	eb c7                	jmp    801b18 <spawn+0x2f7>
+				panic("spawn: sys_page_map_range data: %e", r);
+  801b51:	50                   	push   %eax
+  801b52:	68 68 32 80 00       	push   $0x803268
+  801b57:	68 22 01 00 00       	push   $0x122
+  801b5c:	68 e9 31 80 00       	push   $0x8031e9
+  801b61:	e8 75 e5 ff ff       	call   8000db <_panic>
+		sys_page_unmap_range(0, UTEMP, n);
+  801b66:	83 ec 04             	sub    $0x4,%esp
+  801b69:	53                   	push   %ebx
+  801b6a:	68 00 00 40 00       	push   $0x400000
+  801b6f:	6a 00                	push   $0x0
+  801b71:	e8 4d f2 ff ff       	call   800dc3 <sys_page_unmap_range>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  801b76:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  801b7c:	01 8d 8c fd ff ff    	add    %ecx,-0x274(%ebp)
+  801b82:	83 c4 10             	add    $0x10,%esp
+  801b85:	e9 c4 00 00 00       	jmp    801c4e <spawn+0x42d>
+	}
+
+	// the rest is zero-filled on demand
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  801b8a:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  801b90:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  801b96:	8b 9d 6c fd ff ff    	mov    -0x294(%ebp),%ebx
+  801b9c:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  801ba2:	39 c8                	cmp    %ecx,%eax
+  801ba4:	73 22                	jae    801bc8 <spawn+0x3a7>
+  801ba6:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  801bac:	29 c1                	sub    %eax,%ecx
+  801bae:	51                   	push   %ecx
+  801baf:	01 d0                	add    %edx,%eax
+  801bb1:	50                   	push   %eax
+  801bb2:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801bb8:	e8 c2 f1 ff ff       	call   800d7f <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  801bbd:	83 c4 10             	add    $0x10,%esp
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	0f 88 d1 00 00 00    	js     801c99 <spawn+0x478>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801bc8:	83 c3 01             	add    $0x1,%ebx
+  801bcb:	83 c6 20             	add    $0x20,%esi
+  801bce:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  801bd5:	39 d8                	cmp    %ebx,%eax
+  801bd7:	0f 8e d9 00 00 00    	jle    801cb6 <spawn+0x495>
+		if (ph->p_type != ELF_PROG_LOAD)
+  801bdd:	83 3e 01             	cmpl   $0x1,(%esi)
+  801be0:	75 e6                	jne    801bc8 <spawn+0x3a7>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  801be2:	8b 46 18             	mov    0x18(%esi),%eax
+  801be5:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  801be8:	83 f8 01             	cmp    $0x1,%eax
+  801beb:	19 c0                	sbb    %eax,%eax
+  801bed:	83 e0 fe             	and    $0xfffffffe,%eax
+  801bf0:	83 c0 07             	add    $0x7,%eax
+  801bf3:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  801bf9:	8b 7e 04             	mov    0x4(%esi),%edi
+  801bfc:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  801c02:	8b 46 10             	mov    0x10(%esi),%eax
+  801c05:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  801c0b:	8b 4e 14             	mov    0x14(%esi),%ecx
+  801c0e:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  801c11:	89 d0                	mov    %edx,%eax
+  801c13:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c18:	74 12                	je     801c2c <spawn+0x40b>
+		va -= i;
+  801c1a:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  801c1c:	01 c1                	add    %eax,%ecx
+		filesz += i;
+  801c1e:	01 85 88 fd ff ff    	add    %eax,-0x278(%ebp)
+		fileoffset -= i;
+  801c24:	29 c7                	sub    %eax,%edi
+  801c26:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  801c2c:	c7 85 8c fd ff ff 00 	movl   $0x0,-0x274(%ebp)
+  801c33:	00 00 00 
+  801c36:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  801c3c:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  801c42:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  801c48:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  801c4e:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  801c54:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  801c5a:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  801c60:	39 c8                	cmp    %ecx,%eax
+  801c62:	0f 83 22 ff ff ff    	jae    801b8a <spawn+0x369>
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+  801c68:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  801c6e:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  801c74:	29 c7                	sub    %eax,%edi
+  801c76:	8d 9f ff 0f 00 00    	lea    0xfff(%edi),%ebx
+  801c7c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  801c82:	b8 00 f0 3f 00       	mov    $0x3ff000,%eax
+  801c87:	39 c3                	cmp    %eax,%ebx
+  801c89:	0f 47 d8             	cmova  %eax,%ebx
+  801c8c:	c1 eb 0c             	shr    $0xc,%ebx
+		for (j = 0; j < n; j += r)
+  801c8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801c94:	e9 c9 fd ff ff       	jmp    801a62 <spawn+0x241>
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  801c99:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9e:	89 d7                	mov    %edx,%edi
+  801ca0:	0f 4e f8             	cmovle %eax,%edi
+  801ca3:	e9 e0 fd ff ff       	jmp    801a88 <spawn+0x267>
+  801ca8:	89 c7                	mov    %eax,%edi
+  801caa:	e9 d9 fd ff ff       	jmp    801a88 <spawn+0x267>
+  801caf:	89 c7                	mov    %eax,%edi
+  801cb1:	e9 d2 fd ff ff       	jmp    801a88 <spawn+0x267>
+	close(fd);
+  801cb6:	83 ec 0c             	sub    $0xc,%esp
+  801cb9:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  801cbf:	e8 19 f5 ff ff       	call   8011dd <close>
+  801cc4:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	uint32_t pn, n;
+	void *va;
+	int perm, r;
+
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  801cc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ccc:	e9 82 00 00 00       	jmp    801d53 <spawn+0x532>
+		// in one go.
+		perm = uvpt[pn] & PTE_SYSCALL;
+		while (pn + n < PGNUM(UTOP)
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+			n++;
+  801cd1:	83 c6 01             	add    $0x1,%esi
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  801cd4:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  801cd9:	74 2e                	je     801d09 <spawn+0x4e8>
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+  801cdb:	89 c2                	mov    %eax,%edx
+  801cdd:	c1 e2 0c             	shl    $0xc,%edx
+  801ce0:	c1 ea 16             	shr    $0x16,%edx
+  801ce3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801cea:	81 e2 81 00 00 00    	and    $0x81,%edx
+  801cf0:	83 fa 01             	cmp    $0x1,%edx
+  801cf3:	75 14                	jne    801d09 <spawn+0x4e8>
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  801cf5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801cfc:	83 c0 01             	add    $0x1,%eax
+  801cff:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  801d05:	39 d7                	cmp    %edx,%edi
+  801d07:	74 c8                	je     801cd1 <spawn+0x4b0>
+		if ((r = sys_page_map_range(0, va, child, va, n, perm)) != n)
+  801d09:	83 ec 08             	sub    $0x8,%esp
+  801d0c:	57                   	push   %edi
+  801d0d:	56                   	push   %esi
+  801d0e:	51                   	push   %ecx
+  801d0f:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801d15:	51                   	push   %ecx
+  801d16:	6a 00                	push   $0x0
+  801d18:	e8 21 f0 ff ff       	call   800d3e <sys_page_map_range>
+  801d1d:	89 c2                	mov    %eax,%edx
+  801d1f:	83 c4 20             	add    $0x20,%esp
+  801d22:	39 c6                	cmp    %eax,%esi
+  801d24:	74 23                	je     801d49 <spawn+0x528>
+			panic("sys_page_map_range: %e", r < 0 ? r : -E_NO_MEM);
+  801d26:	85 c0                	test   %eax,%eax
+  801d28:	78 05                	js     801d2f <spawn+0x50e>
+  801d2a:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  801d2f:	50                   	push   %eax
+  801d30:	68 f5 31 80 00       	push   $0x8031f5
+  801d35:	68 47 01 00 00       	push   $0x147
+  801d3a:	68 e9 31 80 00       	push   $0x8031e9
+  801d3f:	e8 97 e3 ff ff       	call   8000db <_panic>
+		n = 1;
+  801d44:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  801d49:	01 d3                	add    %edx,%ebx
+  801d4b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801d51:	77 4e                	ja     801da1 <spawn+0x580>
+		va = (void *) (pn << PGSHIFT);
+  801d53:	89 d9                	mov    %ebx,%ecx
+  801d55:	c1 e1 0c             	shl    $0xc,%ecx
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  801d58:	89 c8                	mov    %ecx,%eax
+  801d5a:	c1 e8 16             	shr    $0x16,%eax
+  801d5d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d64:	25 81 00 00 00       	and    $0x81,%eax
+  801d69:	83 f8 01             	cmp    $0x1,%eax
+  801d6c:	75 d6                	jne    801d44 <spawn+0x523>
+		if (!(uvpt[pn] & PTE_P))
+  801d6e:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  801d75:	83 e2 01             	and    $0x1,%edx
+  801d78:	74 23                	je     801d9d <spawn+0x57c>
+		if (!(uvpt[pn] & PTE_SHARE))
+  801d7a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801d81:	f6 c4 04             	test   $0x4,%ah
+  801d84:	74 c3                	je     801d49 <spawn+0x528>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  801d86:	8b 3c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edi
+  801d8d:	81 e7 07 0e 00 00    	and    $0xe07,%edi
+		while (pn + n < PGNUM(UTOP)
+  801d93:	8d 43 01             	lea    0x1(%ebx),%eax
+		n = 1;
+  801d96:	89 d6                	mov    %edx,%esi
+		while (pn + n < PGNUM(UTOP)
+  801d98:	e9 37 ff ff ff       	jmp    801cd4 <spawn+0x4b3>
+		n = 1;
+  801d9d:	89 c2                	mov    %eax,%edx
+  801d9f:	eb a8                	jmp    801d49 <spawn+0x528>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  801da1:	83 ec 08             	sub    $0x8,%esp
+  801da4:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  801daa:	50                   	push   %eax
+  801dab:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801db1:	e8 14 f1 ff ff       	call   800eca <sys_env_set_trapframe>
+  801db6:	83 c4 10             	add    $0x10,%esp
+  801db9:	85 c0                	test   %eax,%eax
+  801dbb:	78 25                	js     801de2 <spawn+0x5c1>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  801dbd:	83 ec 08             	sub    $0x8,%esp
+  801dc0:	6a 02                	push   $0x2
+  801dc2:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801dc8:	e8 18 f0 ff ff       	call   800de5 <sys_env_set_status>
+  801dcd:	83 c4 10             	add    $0x10,%esp
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	78 23                	js     801df7 <spawn+0x5d6>
+	return child;
+  801dd4:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801dda:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  801de0:	eb 36                	jmp    801e18 <spawn+0x5f7>
+		panic("sys_env_set_trapframe: %e", r);
+  801de2:	50                   	push   %eax
+  801de3:	68 0c 32 80 00       	push   $0x80320c
+  801de8:	68 85 00 00 00       	push   $0x85
+  801ded:	68 e9 31 80 00       	push   $0x8031e9
+  801df2:	e8 e4 e2 ff ff       	call   8000db <_panic>
+		panic("sys_env_set_status: %e", r);
+  801df7:	50                   	push   %eax
+  801df8:	68 26 32 80 00       	push   $0x803226
+  801dfd:	68 88 00 00 00       	push   $0x88
+  801e02:	68 e9 31 80 00       	push   $0x8031e9
+  801e07:	e8 cf e2 ff ff       	call   8000db <_panic>
+		return r;
+  801e0c:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801e12:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+}
+  801e18:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  801e1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e21:	5b                   	pop    %ebx
+  801e22:	5e                   	pop    %esi
+  801e23:	5f                   	pop    %edi
+  801e24:	5d                   	pop    %ebp
+  801e25:	c3                   	ret
+		return -E_NO_MEM;
+  801e26:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  801e2b:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  801e31:	eb e5                	jmp    801e18 <spawn+0x5f7>
+	sys_page_unmap(0, UTEMP);
+  801e33:	83 ec 08             	sub    $0x8,%esp
+  801e36:	68 00 00 40 00       	push   $0x400000
+  801e3b:	6a 00                	push   $0x0
+  801e3d:	e8 97 ee ff ff       	call   800cd9 <sys_page_unmap>
+  801e42:	83 c4 10             	add    $0x10,%esp
+  801e45:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  801e4b:	eb cb                	jmp    801e18 <spawn+0x5f7>
+
+00801e4d <spawnl>:
+{
+  801e4d:	55                   	push   %ebp
+  801e4e:	89 e5                	mov    %esp,%ebp
+  801e50:	56                   	push   %esi
+  801e51:	53                   	push   %ebx
+	va_start(vl, arg0);
+  801e52:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  801e55:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  801e5a:	eb 05                	jmp    801e61 <spawnl+0x14>
+		argc++;
+  801e5c:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  801e5f:	89 ca                	mov    %ecx,%edx
+  801e61:	8d 4a 04             	lea    0x4(%edx),%ecx
+  801e64:	83 3a 00             	cmpl   $0x0,(%edx)
+  801e67:	75 f3                	jne    801e5c <spawnl+0xf>
+	const char *argv[argc+2];
+  801e69:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  801e70:	83 e2 f0             	and    $0xfffffff0,%edx
+  801e73:	29 d4                	sub    %edx,%esp
+  801e75:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  801e79:	89 da                	mov    %ebx,%edx
+  801e7b:	c1 ea 02             	shr    $0x2,%edx
+  801e7e:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  801e81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e84:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  801e8b:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  801e92:	00 
+	va_start(vl, arg0);
+  801e93:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  801e96:	89 c2                	mov    %eax,%edx
+  801e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9d:	eb 0b                	jmp    801eaa <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  801e9f:	83 c0 01             	add    $0x1,%eax
+  801ea2:	8b 31                	mov    (%ecx),%esi
+  801ea4:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  801ea7:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  801eaa:	39 d0                	cmp    %edx,%eax
+  801eac:	75 f1                	jne    801e9f <spawnl+0x52>
+	return spawn(prog, argv);
+  801eae:	83 ec 08             	sub    $0x8,%esp
+  801eb1:	53                   	push   %ebx
+  801eb2:	ff 75 08             	push   0x8(%ebp)
+  801eb5:	e8 67 f9 ff ff       	call   801821 <spawn>
+}
+  801eba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ebd:	5b                   	pop    %ebx
+  801ebe:	5e                   	pop    %esi
+  801ebf:	5d                   	pop    %ebp
+  801ec0:	c3                   	ret
+
+00801ec1 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ec1:	55                   	push   %ebp
+  801ec2:	89 e5                	mov    %esp,%ebp
+  801ec4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801ec7:	68 8b 32 80 00       	push   $0x80328b
+  801ecc:	ff 75 0c             	push   0xc(%ebp)
+  801ecf:	e8 d0 e8 ff ff       	call   8007a4 <strcpy>
+	return 0;
+}
+  801ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed9:	c9                   	leave
+  801eda:	c3                   	ret
+
+00801edb <devsock_close>:
+{
+  801edb:	55                   	push   %ebp
+  801edc:	89 e5                	mov    %esp,%ebp
+  801ede:	53                   	push   %ebx
+  801edf:	83 ec 10             	sub    $0x10,%esp
+  801ee2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801ee5:	53                   	push   %ebx
+  801ee6:	e8 d8 09 00 00       	call   8028c3 <pageref>
+  801eeb:	89 c2                	mov    %eax,%edx
+  801eed:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801ef5:	83 fa 01             	cmp    $0x1,%edx
+  801ef8:	74 05                	je     801eff <devsock_close+0x24>
+}
+  801efa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801efd:	c9                   	leave
+  801efe:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801eff:	83 ec 0c             	sub    $0xc,%esp
+  801f02:	ff 73 0c             	push   0xc(%ebx)
+  801f05:	e8 b7 02 00 00       	call   8021c1 <nsipc_close>
+  801f0a:	83 c4 10             	add    $0x10,%esp
+  801f0d:	eb eb                	jmp    801efa <devsock_close+0x1f>
+
+00801f0f <devsock_write>:
+{
+  801f0f:	55                   	push   %ebp
+  801f10:	89 e5                	mov    %esp,%ebp
+  801f12:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801f15:	6a 00                	push   $0x0
+  801f17:	ff 75 10             	push   0x10(%ebp)
+  801f1a:	ff 75 0c             	push   0xc(%ebp)
+  801f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f20:	ff 70 0c             	push   0xc(%eax)
+  801f23:	e8 79 03 00 00       	call   8022a1 <nsipc_send>
+}
+  801f28:	c9                   	leave
+  801f29:	c3                   	ret
+
+00801f2a <devsock_read>:
+{
+  801f2a:	55                   	push   %ebp
+  801f2b:	89 e5                	mov    %esp,%ebp
+  801f2d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801f30:	6a 00                	push   $0x0
+  801f32:	ff 75 10             	push   0x10(%ebp)
+  801f35:	ff 75 0c             	push   0xc(%ebp)
+  801f38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3b:	ff 70 0c             	push   0xc(%eax)
+  801f3e:	e8 ef 02 00 00       	call   802232 <nsipc_recv>
+}
+  801f43:	c9                   	leave
+  801f44:	c3                   	ret
+
+00801f45 <fd2sockid>:
+{
+  801f45:	55                   	push   %ebp
+  801f46:	89 e5                	mov    %esp,%ebp
+  801f48:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801f4b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801f4e:	52                   	push   %edx
+  801f4f:	50                   	push   %eax
+  801f50:	e8 5e f1 ff ff       	call   8010b3 <fd_lookup>
+  801f55:	83 c4 10             	add    $0x10,%esp
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	78 10                	js     801f6c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801f5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f5f:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801f65:	39 08                	cmp    %ecx,(%eax)
+  801f67:	75 05                	jne    801f6e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801f69:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801f6c:	c9                   	leave
+  801f6d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f6e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f73:	eb f7                	jmp    801f6c <fd2sockid+0x27>
+
+00801f75 <alloc_sockfd>:
+{
+  801f75:	55                   	push   %ebp
+  801f76:	89 e5                	mov    %esp,%ebp
+  801f78:	56                   	push   %esi
+  801f79:	53                   	push   %ebx
+  801f7a:	83 ec 1c             	sub    $0x1c,%esp
+  801f7d:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801f7f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f82:	50                   	push   %eax
+  801f83:	e8 d5 f0 ff ff       	call   80105d <fd_alloc>
+  801f88:	89 c3                	mov    %eax,%ebx
+  801f8a:	83 c4 10             	add    $0x10,%esp
+  801f8d:	85 c0                	test   %eax,%eax
+  801f8f:	78 43                	js     801fd4 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801f91:	83 ec 04             	sub    $0x4,%esp
+  801f94:	68 07 04 00 00       	push   $0x407
+  801f99:	ff 75 f4             	push   -0xc(%ebp)
+  801f9c:	6a 00                	push   $0x0
+  801f9e:	e8 6e ec ff ff       	call   800c11 <sys_page_alloc>
+  801fa3:	89 c3                	mov    %eax,%ebx
+  801fa5:	83 c4 10             	add    $0x10,%esp
+  801fa8:	85 c0                	test   %eax,%eax
+  801faa:	78 28                	js     801fd4 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801fac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801faf:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801fb5:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801fb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fba:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801fc1:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801fc4:	83 ec 0c             	sub    $0xc,%esp
+  801fc7:	50                   	push   %eax
+  801fc8:	e8 69 f0 ff ff       	call   801036 <fd2num>
+  801fcd:	89 c3                	mov    %eax,%ebx
+  801fcf:	83 c4 10             	add    $0x10,%esp
+  801fd2:	eb 0c                	jmp    801fe0 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801fd4:	83 ec 0c             	sub    $0xc,%esp
+  801fd7:	56                   	push   %esi
+  801fd8:	e8 e4 01 00 00       	call   8021c1 <nsipc_close>
+		return r;
+  801fdd:	83 c4 10             	add    $0x10,%esp
+}
+  801fe0:	89 d8                	mov    %ebx,%eax
+  801fe2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe5:	5b                   	pop    %ebx
+  801fe6:	5e                   	pop    %esi
+  801fe7:	5d                   	pop    %ebp
+  801fe8:	c3                   	ret
+
+00801fe9 <accept>:
+{
+  801fe9:	55                   	push   %ebp
+  801fea:	89 e5                	mov    %esp,%ebp
+  801fec:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff2:	e8 4e ff ff ff       	call   801f45 <fd2sockid>
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	78 1b                	js     802016 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801ffb:	83 ec 04             	sub    $0x4,%esp
+  801ffe:	ff 75 10             	push   0x10(%ebp)
+  802001:	ff 75 0c             	push   0xc(%ebp)
+  802004:	50                   	push   %eax
+  802005:	e8 0e 01 00 00       	call   802118 <nsipc_accept>
+  80200a:	83 c4 10             	add    $0x10,%esp
+  80200d:	85 c0                	test   %eax,%eax
+  80200f:	78 05                	js     802016 <accept+0x2d>
+	return alloc_sockfd(r);
+  802011:	e8 5f ff ff ff       	call   801f75 <alloc_sockfd>
+}
+  802016:	c9                   	leave
+  802017:	c3                   	ret
+
+00802018 <bind>:
+{
+  802018:	55                   	push   %ebp
+  802019:	89 e5                	mov    %esp,%ebp
+  80201b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80201e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802021:	e8 1f ff ff ff       	call   801f45 <fd2sockid>
+  802026:	85 c0                	test   %eax,%eax
+  802028:	78 12                	js     80203c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80202a:	83 ec 04             	sub    $0x4,%esp
+  80202d:	ff 75 10             	push   0x10(%ebp)
+  802030:	ff 75 0c             	push   0xc(%ebp)
+  802033:	50                   	push   %eax
+  802034:	e8 31 01 00 00       	call   80216a <nsipc_bind>
+  802039:	83 c4 10             	add    $0x10,%esp
+}
+  80203c:	c9                   	leave
+  80203d:	c3                   	ret
+
+0080203e <shutdown>:
+{
+  80203e:	55                   	push   %ebp
+  80203f:	89 e5                	mov    %esp,%ebp
+  802041:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802044:	8b 45 08             	mov    0x8(%ebp),%eax
+  802047:	e8 f9 fe ff ff       	call   801f45 <fd2sockid>
+  80204c:	85 c0                	test   %eax,%eax
+  80204e:	78 0f                	js     80205f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802050:	83 ec 08             	sub    $0x8,%esp
+  802053:	ff 75 0c             	push   0xc(%ebp)
+  802056:	50                   	push   %eax
+  802057:	e8 43 01 00 00       	call   80219f <nsipc_shutdown>
+  80205c:	83 c4 10             	add    $0x10,%esp
+}
+  80205f:	c9                   	leave
+  802060:	c3                   	ret
+
+00802061 <connect>:
+{
+  802061:	55                   	push   %ebp
+  802062:	89 e5                	mov    %esp,%ebp
+  802064:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802067:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206a:	e8 d6 fe ff ff       	call   801f45 <fd2sockid>
+  80206f:	85 c0                	test   %eax,%eax
+  802071:	78 12                	js     802085 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802073:	83 ec 04             	sub    $0x4,%esp
+  802076:	ff 75 10             	push   0x10(%ebp)
+  802079:	ff 75 0c             	push   0xc(%ebp)
+  80207c:	50                   	push   %eax
+  80207d:	e8 59 01 00 00       	call   8021db <nsipc_connect>
+  802082:	83 c4 10             	add    $0x10,%esp
+}
+  802085:	c9                   	leave
+  802086:	c3                   	ret
+
+00802087 <listen>:
+{
+  802087:	55                   	push   %ebp
+  802088:	89 e5                	mov    %esp,%ebp
+  80208a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80208d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802090:	e8 b0 fe ff ff       	call   801f45 <fd2sockid>
+  802095:	85 c0                	test   %eax,%eax
+  802097:	78 0f                	js     8020a8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802099:	83 ec 08             	sub    $0x8,%esp
+  80209c:	ff 75 0c             	push   0xc(%ebp)
+  80209f:	50                   	push   %eax
+  8020a0:	e8 6b 01 00 00       	call   802210 <nsipc_listen>
+  8020a5:	83 c4 10             	add    $0x10,%esp
+}
+  8020a8:	c9                   	leave
+  8020a9:	c3                   	ret
+
+008020aa <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8020aa:	55                   	push   %ebp
+  8020ab:	89 e5                	mov    %esp,%ebp
+  8020ad:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8020b0:	ff 75 10             	push   0x10(%ebp)
+  8020b3:	ff 75 0c             	push   0xc(%ebp)
+  8020b6:	ff 75 08             	push   0x8(%ebp)
+  8020b9:	e8 41 02 00 00       	call   8022ff <nsipc_socket>
+  8020be:	83 c4 10             	add    $0x10,%esp
+  8020c1:	85 c0                	test   %eax,%eax
+  8020c3:	78 05                	js     8020ca <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8020c5:	e8 ab fe ff ff       	call   801f75 <alloc_sockfd>
+}
+  8020ca:	c9                   	leave
+  8020cb:	c3                   	ret
+
+008020cc <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8020cc:	55                   	push   %ebp
+  8020cd:	89 e5                	mov    %esp,%ebp
+  8020cf:	53                   	push   %ebx
+  8020d0:	83 ec 04             	sub    $0x4,%esp
+  8020d3:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8020d5:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8020dc:	74 26                	je     802104 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8020de:	6a 07                	push   $0x7
+  8020e0:	68 00 70 80 00       	push   $0x807000
+  8020e5:	53                   	push   %ebx
+  8020e6:	ff 35 04 50 80 00    	push   0x805004
+  8020ec:	e8 6e 07 00 00       	call   80285f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8020f1:	83 c4 0c             	add    $0xc,%esp
+  8020f4:	6a 00                	push   $0x0
+  8020f6:	6a 00                	push   $0x0
+  8020f8:	6a 00                	push   $0x0
+  8020fa:	e8 e8 06 00 00       	call   8027e7 <ipc_recv>
+}
+  8020ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802102:	c9                   	leave
+  802103:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802104:	83 ec 0c             	sub    $0xc,%esp
+  802107:	6a 02                	push   $0x2
+  802109:	e8 a5 07 00 00       	call   8028b3 <ipc_find_env>
+  80210e:	a3 04 50 80 00       	mov    %eax,0x805004
+  802113:	83 c4 10             	add    $0x10,%esp
+  802116:	eb c6                	jmp    8020de <nsipc+0x12>
+
+00802118 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802118:	55                   	push   %ebp
+  802119:	89 e5                	mov    %esp,%ebp
+  80211b:	56                   	push   %esi
+  80211c:	53                   	push   %ebx
+  80211d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802120:	8b 45 08             	mov    0x8(%ebp),%eax
+  802123:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802128:	8b 06                	mov    (%esi),%eax
+  80212a:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80212f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802134:	e8 93 ff ff ff       	call   8020cc <nsipc>
+  802139:	89 c3                	mov    %eax,%ebx
+  80213b:	85 c0                	test   %eax,%eax
+  80213d:	79 09                	jns    802148 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80213f:	89 d8                	mov    %ebx,%eax
+  802141:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802144:	5b                   	pop    %ebx
+  802145:	5e                   	pop    %esi
+  802146:	5d                   	pop    %ebp
+  802147:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802148:	83 ec 04             	sub    $0x4,%esp
+  80214b:	ff 35 10 70 80 00    	push   0x807010
+  802151:	68 00 70 80 00       	push   $0x807000
+  802156:	ff 75 0c             	push   0xc(%ebp)
+  802159:	e8 cc e7 ff ff       	call   80092a <memmove>
+		*addrlen = ret->ret_addrlen;
+  80215e:	a1 10 70 80 00       	mov    0x807010,%eax
+  802163:	89 06                	mov    %eax,(%esi)
+  802165:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802168:	eb d5                	jmp    80213f <nsipc_accept+0x27>
+
+0080216a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80216a:	55                   	push   %ebp
+  80216b:	89 e5                	mov    %esp,%ebp
+  80216d:	53                   	push   %ebx
+  80216e:	83 ec 08             	sub    $0x8,%esp
+  802171:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802174:	8b 45 08             	mov    0x8(%ebp),%eax
+  802177:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80217c:	53                   	push   %ebx
+  80217d:	ff 75 0c             	push   0xc(%ebp)
+  802180:	68 04 70 80 00       	push   $0x807004
+  802185:	e8 a0 e7 ff ff       	call   80092a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80218a:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802190:	b8 02 00 00 00       	mov    $0x2,%eax
+  802195:	e8 32 ff ff ff       	call   8020cc <nsipc>
+}
+  80219a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80219d:	c9                   	leave
+  80219e:	c3                   	ret
+
+0080219f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80219f:	55                   	push   %ebp
+  8021a0:	89 e5                	mov    %esp,%ebp
+  8021a2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8021a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8021ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021b0:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8021b5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021ba:	e8 0d ff ff ff       	call   8020cc <nsipc>
+}
+  8021bf:	c9                   	leave
+  8021c0:	c3                   	ret
+
+008021c1 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8021c1:	55                   	push   %ebp
+  8021c2:	89 e5                	mov    %esp,%ebp
+  8021c4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8021c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ca:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8021cf:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021d4:	e8 f3 fe ff ff       	call   8020cc <nsipc>
+}
+  8021d9:	c9                   	leave
+  8021da:	c3                   	ret
+
+008021db <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8021db:	55                   	push   %ebp
+  8021dc:	89 e5                	mov    %esp,%ebp
+  8021de:	53                   	push   %ebx
+  8021df:	83 ec 08             	sub    $0x8,%esp
+  8021e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8021e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e8:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8021ed:	53                   	push   %ebx
+  8021ee:	ff 75 0c             	push   0xc(%ebp)
+  8021f1:	68 04 70 80 00       	push   $0x807004
+  8021f6:	e8 2f e7 ff ff       	call   80092a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8021fb:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802201:	b8 05 00 00 00       	mov    $0x5,%eax
+  802206:	e8 c1 fe ff ff       	call   8020cc <nsipc>
+}
+  80220b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80220e:	c9                   	leave
+  80220f:	c3                   	ret
+
+00802210 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802210:	55                   	push   %ebp
+  802211:	89 e5                	mov    %esp,%ebp
+  802213:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802216:	8b 45 08             	mov    0x8(%ebp),%eax
+  802219:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80221e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802221:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802226:	b8 06 00 00 00       	mov    $0x6,%eax
+  80222b:	e8 9c fe ff ff       	call   8020cc <nsipc>
+}
+  802230:	c9                   	leave
+  802231:	c3                   	ret
+
+00802232 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802232:	55                   	push   %ebp
+  802233:	89 e5                	mov    %esp,%ebp
+  802235:	56                   	push   %esi
+  802236:	53                   	push   %ebx
+  802237:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80223a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80223d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802242:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802248:	8b 45 14             	mov    0x14(%ebp),%eax
+  80224b:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802250:	b8 07 00 00 00       	mov    $0x7,%eax
+  802255:	e8 72 fe ff ff       	call   8020cc <nsipc>
+  80225a:	89 c3                	mov    %eax,%ebx
+  80225c:	85 c0                	test   %eax,%eax
+  80225e:	78 22                	js     802282 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802260:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802265:	39 c6                	cmp    %eax,%esi
+  802267:	0f 4e c6             	cmovle %esi,%eax
+  80226a:	39 c3                	cmp    %eax,%ebx
+  80226c:	7f 1d                	jg     80228b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80226e:	83 ec 04             	sub    $0x4,%esp
+  802271:	53                   	push   %ebx
+  802272:	68 00 70 80 00       	push   $0x807000
+  802277:	ff 75 0c             	push   0xc(%ebp)
+  80227a:	e8 ab e6 ff ff       	call   80092a <memmove>
+  80227f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802282:	89 d8                	mov    %ebx,%eax
+  802284:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802287:	5b                   	pop    %ebx
+  802288:	5e                   	pop    %esi
+  802289:	5d                   	pop    %ebp
+  80228a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80228b:	68 97 32 80 00       	push   $0x803297
+  802290:	68 a3 31 80 00       	push   $0x8031a3
+  802295:	6a 62                	push   $0x62
+  802297:	68 ac 32 80 00       	push   $0x8032ac
+  80229c:	e8 3a de ff ff       	call   8000db <_panic>
+
+008022a1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8022a1:	55                   	push   %ebp
+  8022a2:	89 e5                	mov    %esp,%ebp
+  8022a4:	53                   	push   %ebx
+  8022a5:	83 ec 04             	sub    $0x4,%esp
+  8022a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8022ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ae:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8022b3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8022b9:	7f 2e                	jg     8022e9 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8022bb:	83 ec 04             	sub    $0x4,%esp
+  8022be:	53                   	push   %ebx
+  8022bf:	ff 75 0c             	push   0xc(%ebp)
+  8022c2:	68 0c 70 80 00       	push   $0x80700c
+  8022c7:	e8 5e e6 ff ff       	call   80092a <memmove>
+	nsipcbuf.send.req_size = size;
+  8022cc:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8022d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022d5:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8022da:	b8 08 00 00 00       	mov    $0x8,%eax
+  8022df:	e8 e8 fd ff ff       	call   8020cc <nsipc>
+}
+  8022e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e7:	c9                   	leave
+  8022e8:	c3                   	ret
+	assert(size < 1600);
+  8022e9:	68 b8 32 80 00       	push   $0x8032b8
+  8022ee:	68 a3 31 80 00       	push   $0x8031a3
+  8022f3:	6a 6d                	push   $0x6d
+  8022f5:	68 ac 32 80 00       	push   $0x8032ac
+  8022fa:	e8 dc dd ff ff       	call   8000db <_panic>
+
+008022ff <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8022ff:	55                   	push   %ebp
+  802300:	89 e5                	mov    %esp,%ebp
+  802302:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802305:	8b 45 08             	mov    0x8(%ebp),%eax
+  802308:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80230d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802310:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802315:	8b 45 10             	mov    0x10(%ebp),%eax
+  802318:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80231d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802322:	e8 a5 fd ff ff       	call   8020cc <nsipc>
+}
+  802327:	c9                   	leave
+  802328:	c3                   	ret
+
+00802329 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802329:	55                   	push   %ebp
+  80232a:	89 e5                	mov    %esp,%ebp
+  80232c:	56                   	push   %esi
+  80232d:	53                   	push   %ebx
+  80232e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802331:	83 ec 0c             	sub    $0xc,%esp
+  802334:	ff 75 08             	push   0x8(%ebp)
+  802337:	e8 0a ed ff ff       	call   801046 <fd2data>
+  80233c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80233e:	83 c4 08             	add    $0x8,%esp
+  802341:	68 c4 32 80 00       	push   $0x8032c4
+  802346:	53                   	push   %ebx
+  802347:	e8 58 e4 ff ff       	call   8007a4 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80234c:	8b 46 04             	mov    0x4(%esi),%eax
+  80234f:	2b 06                	sub    (%esi),%eax
+  802351:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802357:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80235e:	00 00 00 
+	stat->st_dev = &devpipe;
+  802361:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802368:	40 80 00 
+	return 0;
+}
+  80236b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802370:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802373:	5b                   	pop    %ebx
+  802374:	5e                   	pop    %esi
+  802375:	5d                   	pop    %ebp
+  802376:	c3                   	ret
+
+00802377 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802377:	55                   	push   %ebp
+  802378:	89 e5                	mov    %esp,%ebp
+  80237a:	53                   	push   %ebx
+  80237b:	83 ec 0c             	sub    $0xc,%esp
+  80237e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802381:	53                   	push   %ebx
+  802382:	6a 00                	push   $0x0
+  802384:	e8 50 e9 ff ff       	call   800cd9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802389:	89 1c 24             	mov    %ebx,(%esp)
+  80238c:	e8 b5 ec ff ff       	call   801046 <fd2data>
+  802391:	83 c4 08             	add    $0x8,%esp
+  802394:	50                   	push   %eax
+  802395:	6a 00                	push   $0x0
+  802397:	e8 3d e9 ff ff       	call   800cd9 <sys_page_unmap>
+}
+  80239c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80239f:	c9                   	leave
+  8023a0:	c3                   	ret
+
+008023a1 <_pipeisclosed>:
+{
+  8023a1:	55                   	push   %ebp
+  8023a2:	89 e5                	mov    %esp,%ebp
+  8023a4:	57                   	push   %edi
+  8023a5:	56                   	push   %esi
+  8023a6:	53                   	push   %ebx
+  8023a7:	83 ec 1c             	sub    $0x1c,%esp
+  8023aa:	89 c7                	mov    %eax,%edi
+  8023ac:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8023ae:	a1 08 50 80 00       	mov    0x805008,%eax
+  8023b3:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8023b6:	83 ec 0c             	sub    $0xc,%esp
+  8023b9:	57                   	push   %edi
+  8023ba:	e8 04 05 00 00       	call   8028c3 <pageref>
+  8023bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023c2:	89 34 24             	mov    %esi,(%esp)
+  8023c5:	e8 f9 04 00 00       	call   8028c3 <pageref>
+		nn = thisenv->env_runs;
+  8023ca:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8023d0:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8023d3:	83 c4 10             	add    $0x10,%esp
+  8023d6:	39 cb                	cmp    %ecx,%ebx
+  8023d8:	74 1b                	je     8023f5 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8023da:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023dd:	75 cf                	jne    8023ae <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8023df:	8b 42 5c             	mov    0x5c(%edx),%eax
+  8023e2:	6a 01                	push   $0x1
+  8023e4:	50                   	push   %eax
+  8023e5:	53                   	push   %ebx
+  8023e6:	68 cb 32 80 00       	push   $0x8032cb
+  8023eb:	e8 c6 dd ff ff       	call   8001b6 <cprintf>
+  8023f0:	83 c4 10             	add    $0x10,%esp
+  8023f3:	eb b9                	jmp    8023ae <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8023f5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023f8:	0f 94 c0             	sete   %al
+  8023fb:	0f b6 c0             	movzbl %al,%eax
+}
+  8023fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802401:	5b                   	pop    %ebx
+  802402:	5e                   	pop    %esi
+  802403:	5f                   	pop    %edi
+  802404:	5d                   	pop    %ebp
+  802405:	c3                   	ret
+
+00802406 <devpipe_write>:
+{
+  802406:	55                   	push   %ebp
+  802407:	89 e5                	mov    %esp,%ebp
+  802409:	57                   	push   %edi
+  80240a:	56                   	push   %esi
+  80240b:	53                   	push   %ebx
+  80240c:	83 ec 28             	sub    $0x28,%esp
+  80240f:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802412:	56                   	push   %esi
+  802413:	e8 2e ec ff ff       	call   801046 <fd2data>
+  802418:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80241a:	83 c4 10             	add    $0x10,%esp
+  80241d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802422:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802425:	75 09                	jne    802430 <devpipe_write+0x2a>
+	return i;
+  802427:	89 f8                	mov    %edi,%eax
+  802429:	eb 23                	jmp    80244e <devpipe_write+0x48>
+			sys_yield();
+  80242b:	e8 61 e7 ff ff       	call   800b91 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802430:	8b 43 04             	mov    0x4(%ebx),%eax
+  802433:	8b 0b                	mov    (%ebx),%ecx
+  802435:	8d 51 20             	lea    0x20(%ecx),%edx
+  802438:	39 d0                	cmp    %edx,%eax
+  80243a:	72 1a                	jb     802456 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80243c:	89 da                	mov    %ebx,%edx
+  80243e:	89 f0                	mov    %esi,%eax
+  802440:	e8 5c ff ff ff       	call   8023a1 <_pipeisclosed>
+  802445:	85 c0                	test   %eax,%eax
+  802447:	74 e2                	je     80242b <devpipe_write+0x25>
+				return 0;
+  802449:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80244e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802451:	5b                   	pop    %ebx
+  802452:	5e                   	pop    %esi
+  802453:	5f                   	pop    %edi
+  802454:	5d                   	pop    %ebp
+  802455:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802456:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802459:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80245d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802460:	89 c2                	mov    %eax,%edx
+  802462:	c1 fa 1f             	sar    $0x1f,%edx
+  802465:	89 d1                	mov    %edx,%ecx
+  802467:	c1 e9 1b             	shr    $0x1b,%ecx
+  80246a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80246d:	83 e2 1f             	and    $0x1f,%edx
+  802470:	29 ca                	sub    %ecx,%edx
+  802472:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802476:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80247a:	83 c0 01             	add    $0x1,%eax
+  80247d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802480:	83 c7 01             	add    $0x1,%edi
+  802483:	eb 9d                	jmp    802422 <devpipe_write+0x1c>
+
+00802485 <devpipe_read>:
+{
+  802485:	55                   	push   %ebp
+  802486:	89 e5                	mov    %esp,%ebp
+  802488:	57                   	push   %edi
+  802489:	56                   	push   %esi
+  80248a:	53                   	push   %ebx
+  80248b:	83 ec 18             	sub    $0x18,%esp
+  80248e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802491:	57                   	push   %edi
+  802492:	e8 af eb ff ff       	call   801046 <fd2data>
+  802497:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8024a4:	75 13                	jne    8024b9 <devpipe_read+0x34>
+	return i;
+  8024a6:	89 f0                	mov    %esi,%eax
+  8024a8:	eb 02                	jmp    8024ac <devpipe_read+0x27>
+				return i;
+  8024aa:	89 f0                	mov    %esi,%eax
+}
+  8024ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024af:	5b                   	pop    %ebx
+  8024b0:	5e                   	pop    %esi
+  8024b1:	5f                   	pop    %edi
+  8024b2:	5d                   	pop    %ebp
+  8024b3:	c3                   	ret
+			sys_yield();
+  8024b4:	e8 d8 e6 ff ff       	call   800b91 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8024b9:	8b 03                	mov    (%ebx),%eax
+  8024bb:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8024be:	75 18                	jne    8024d8 <devpipe_read+0x53>
+			if (i > 0)
+  8024c0:	85 f6                	test   %esi,%esi
+  8024c2:	75 e6                	jne    8024aa <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8024c4:	89 da                	mov    %ebx,%edx
+  8024c6:	89 f8                	mov    %edi,%eax
+  8024c8:	e8 d4 fe ff ff       	call   8023a1 <_pipeisclosed>
+  8024cd:	85 c0                	test   %eax,%eax
+  8024cf:	74 e3                	je     8024b4 <devpipe_read+0x2f>
+				return 0;
+  8024d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d6:	eb d4                	jmp    8024ac <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8024d8:	99                   	cltd
+  8024d9:	c1 ea 1b             	shr    $0x1b,%edx
+  8024dc:	01 d0                	add    %edx,%eax
+  8024de:	83 e0 1f             	and    $0x1f,%eax
+  8024e1:	29 d0                	sub    %edx,%eax
+  8024e3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8024e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024eb:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8024ee:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8024f1:	83 c6 01             	add    $0x1,%esi
+  8024f4:	eb ab                	jmp    8024a1 <devpipe_read+0x1c>
+
+008024f6 <pipe>:
+{
+  8024f6:	55                   	push   %ebp
+  8024f7:	89 e5                	mov    %esp,%ebp
+  8024f9:	56                   	push   %esi
+  8024fa:	53                   	push   %ebx
+  8024fb:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8024fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802501:	50                   	push   %eax
+  802502:	e8 56 eb ff ff       	call   80105d <fd_alloc>
+  802507:	89 c3                	mov    %eax,%ebx
+  802509:	83 c4 10             	add    $0x10,%esp
+  80250c:	85 c0                	test   %eax,%eax
+  80250e:	0f 88 23 01 00 00    	js     802637 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802514:	83 ec 04             	sub    $0x4,%esp
+  802517:	68 07 04 00 00       	push   $0x407
+  80251c:	ff 75 f4             	push   -0xc(%ebp)
+  80251f:	6a 00                	push   $0x0
+  802521:	e8 eb e6 ff ff       	call   800c11 <sys_page_alloc>
+  802526:	89 c3                	mov    %eax,%ebx
+  802528:	83 c4 10             	add    $0x10,%esp
+  80252b:	85 c0                	test   %eax,%eax
+  80252d:	0f 88 04 01 00 00    	js     802637 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802533:	83 ec 0c             	sub    $0xc,%esp
+  802536:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802539:	50                   	push   %eax
+  80253a:	e8 1e eb ff ff       	call   80105d <fd_alloc>
+  80253f:	89 c3                	mov    %eax,%ebx
+  802541:	83 c4 10             	add    $0x10,%esp
+  802544:	85 c0                	test   %eax,%eax
+  802546:	0f 88 db 00 00 00    	js     802627 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80254c:	83 ec 04             	sub    $0x4,%esp
+  80254f:	68 07 04 00 00       	push   $0x407
+  802554:	ff 75 f0             	push   -0x10(%ebp)
+  802557:	6a 00                	push   $0x0
+  802559:	e8 b3 e6 ff ff       	call   800c11 <sys_page_alloc>
+  80255e:	89 c3                	mov    %eax,%ebx
+  802560:	83 c4 10             	add    $0x10,%esp
+  802563:	85 c0                	test   %eax,%eax
+  802565:	0f 88 bc 00 00 00    	js     802627 <pipe+0x131>
+	va = fd2data(fd0);
+  80256b:	83 ec 0c             	sub    $0xc,%esp
+  80256e:	ff 75 f4             	push   -0xc(%ebp)
+  802571:	e8 d0 ea ff ff       	call   801046 <fd2data>
+  802576:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802578:	83 c4 0c             	add    $0xc,%esp
+  80257b:	68 07 04 00 00       	push   $0x407
+  802580:	50                   	push   %eax
+  802581:	6a 00                	push   $0x0
+  802583:	e8 89 e6 ff ff       	call   800c11 <sys_page_alloc>
+  802588:	89 c3                	mov    %eax,%ebx
+  80258a:	83 c4 10             	add    $0x10,%esp
+  80258d:	85 c0                	test   %eax,%eax
+  80258f:	0f 88 82 00 00 00    	js     802617 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802595:	83 ec 0c             	sub    $0xc,%esp
+  802598:	ff 75 f0             	push   -0x10(%ebp)
+  80259b:	e8 a6 ea ff ff       	call   801046 <fd2data>
+  8025a0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8025a7:	50                   	push   %eax
+  8025a8:	6a 00                	push   $0x0
+  8025aa:	56                   	push   %esi
+  8025ab:	6a 00                	push   $0x0
+  8025ad:	e8 e5 e6 ff ff       	call   800c97 <sys_page_map>
+  8025b2:	89 c3                	mov    %eax,%ebx
+  8025b4:	83 c4 20             	add    $0x20,%esp
+  8025b7:	85 c0                	test   %eax,%eax
+  8025b9:	78 4e                	js     802609 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025bb:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8025c0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025c3:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8025c5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025c8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8025cf:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025d2:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025d4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8025d7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8025de:	83 ec 0c             	sub    $0xc,%esp
+  8025e1:	ff 75 f4             	push   -0xc(%ebp)
+  8025e4:	e8 4d ea ff ff       	call   801036 <fd2num>
+  8025e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025ec:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8025ee:	83 c4 04             	add    $0x4,%esp
+  8025f1:	ff 75 f0             	push   -0x10(%ebp)
+  8025f4:	e8 3d ea ff ff       	call   801036 <fd2num>
+  8025f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025fc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8025ff:	83 c4 10             	add    $0x10,%esp
+  802602:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802607:	eb 2e                	jmp    802637 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802609:	83 ec 08             	sub    $0x8,%esp
+  80260c:	56                   	push   %esi
+  80260d:	6a 00                	push   $0x0
+  80260f:	e8 c5 e6 ff ff       	call   800cd9 <sys_page_unmap>
+  802614:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802617:	83 ec 08             	sub    $0x8,%esp
+  80261a:	ff 75 f0             	push   -0x10(%ebp)
+  80261d:	6a 00                	push   $0x0
+  80261f:	e8 b5 e6 ff ff       	call   800cd9 <sys_page_unmap>
+  802624:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802627:	83 ec 08             	sub    $0x8,%esp
+  80262a:	ff 75 f4             	push   -0xc(%ebp)
+  80262d:	6a 00                	push   $0x0
+  80262f:	e8 a5 e6 ff ff       	call   800cd9 <sys_page_unmap>
+  802634:	83 c4 10             	add    $0x10,%esp
+}
+  802637:	89 d8                	mov    %ebx,%eax
+  802639:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80263c:	5b                   	pop    %ebx
+  80263d:	5e                   	pop    %esi
+  80263e:	5d                   	pop    %ebp
+  80263f:	c3                   	ret
+
+00802640 <pipeisclosed>:
+{
+  802640:	55                   	push   %ebp
+  802641:	89 e5                	mov    %esp,%ebp
+  802643:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802646:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802649:	50                   	push   %eax
+  80264a:	ff 75 08             	push   0x8(%ebp)
+  80264d:	e8 61 ea ff ff       	call   8010b3 <fd_lookup>
+  802652:	83 c4 10             	add    $0x10,%esp
+  802655:	85 c0                	test   %eax,%eax
+  802657:	78 18                	js     802671 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802659:	83 ec 0c             	sub    $0xc,%esp
+  80265c:	ff 75 f4             	push   -0xc(%ebp)
+  80265f:	e8 e2 e9 ff ff       	call   801046 <fd2data>
+  802664:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802666:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802669:	e8 33 fd ff ff       	call   8023a1 <_pipeisclosed>
+  80266e:	83 c4 10             	add    $0x10,%esp
+}
+  802671:	c9                   	leave
+  802672:	c3                   	ret
+
+00802673 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802673:	b8 00 00 00 00       	mov    $0x0,%eax
+  802678:	c3                   	ret
+
+00802679 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802679:	55                   	push   %ebp
+  80267a:	89 e5                	mov    %esp,%ebp
+  80267c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80267f:	68 e3 32 80 00       	push   $0x8032e3
+  802684:	ff 75 0c             	push   0xc(%ebp)
+  802687:	e8 18 e1 ff ff       	call   8007a4 <strcpy>
+	return 0;
+}
+  80268c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802691:	c9                   	leave
+  802692:	c3                   	ret
+
+00802693 <devcons_write>:
+{
+  802693:	55                   	push   %ebp
+  802694:	89 e5                	mov    %esp,%ebp
+  802696:	57                   	push   %edi
+  802697:	56                   	push   %esi
+  802698:	53                   	push   %ebx
+  802699:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80269f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8026a4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8026aa:	eb 2e                	jmp    8026da <devcons_write+0x47>
+		m = n - tot;
+  8026ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026af:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8026b1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8026b6:	39 c3                	cmp    %eax,%ebx
+  8026b8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8026bb:	83 ec 04             	sub    $0x4,%esp
+  8026be:	53                   	push   %ebx
+  8026bf:	89 f0                	mov    %esi,%eax
+  8026c1:	03 45 0c             	add    0xc(%ebp),%eax
+  8026c4:	50                   	push   %eax
+  8026c5:	57                   	push   %edi
+  8026c6:	e8 5f e2 ff ff       	call   80092a <memmove>
+		sys_cputs(buf, m);
+  8026cb:	83 c4 08             	add    $0x8,%esp
+  8026ce:	53                   	push   %ebx
+  8026cf:	57                   	push   %edi
+  8026d0:	e8 ff e3 ff ff       	call   800ad4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8026d5:	01 de                	add    %ebx,%esi
+  8026d7:	83 c4 10             	add    $0x10,%esp
+  8026da:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8026dd:	72 cd                	jb     8026ac <devcons_write+0x19>
+}
+  8026df:	89 f0                	mov    %esi,%eax
+  8026e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026e4:	5b                   	pop    %ebx
+  8026e5:	5e                   	pop    %esi
+  8026e6:	5f                   	pop    %edi
+  8026e7:	5d                   	pop    %ebp
+  8026e8:	c3                   	ret
+
+008026e9 <devcons_read>:
+{
+  8026e9:	55                   	push   %ebp
+  8026ea:	89 e5                	mov    %esp,%ebp
+  8026ec:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8026ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8026f8:	75 07                	jne    802701 <devcons_read+0x18>
+  8026fa:	eb 1f                	jmp    80271b <devcons_read+0x32>
+		sys_yield();
+  8026fc:	e8 90 e4 ff ff       	call   800b91 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802701:	e8 ec e3 ff ff       	call   800af2 <sys_cgetc>
+  802706:	85 c0                	test   %eax,%eax
+  802708:	74 f2                	je     8026fc <devcons_read+0x13>
+	if (c < 0)
+  80270a:	78 0f                	js     80271b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80270c:	83 f8 04             	cmp    $0x4,%eax
+  80270f:	74 0c                	je     80271d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802711:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802714:	88 02                	mov    %al,(%edx)
+	return 1;
+  802716:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80271b:	c9                   	leave
+  80271c:	c3                   	ret
+		return 0;
+  80271d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802722:	eb f7                	jmp    80271b <devcons_read+0x32>
+
+00802724 <cputchar>:
+{
+  802724:	55                   	push   %ebp
+  802725:	89 e5                	mov    %esp,%ebp
+  802727:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80272a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80272d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802730:	6a 01                	push   $0x1
+  802732:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802735:	50                   	push   %eax
+  802736:	e8 99 e3 ff ff       	call   800ad4 <sys_cputs>
+}
+  80273b:	83 c4 10             	add    $0x10,%esp
+  80273e:	c9                   	leave
+  80273f:	c3                   	ret
+
+00802740 <getchar>:
+{
+  802740:	55                   	push   %ebp
+  802741:	89 e5                	mov    %esp,%ebp
+  802743:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802746:	6a 01                	push   $0x1
+  802748:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80274b:	50                   	push   %eax
+  80274c:	6a 00                	push   $0x0
+  80274e:	e8 c6 eb ff ff       	call   801319 <read>
+	if (r < 0)
+  802753:	83 c4 10             	add    $0x10,%esp
+  802756:	85 c0                	test   %eax,%eax
+  802758:	78 06                	js     802760 <getchar+0x20>
+	if (r < 1)
+  80275a:	74 06                	je     802762 <getchar+0x22>
+	return c;
+  80275c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802760:	c9                   	leave
+  802761:	c3                   	ret
+		return -E_EOF;
+  802762:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802767:	eb f7                	jmp    802760 <getchar+0x20>
+
+00802769 <iscons>:
+{
+  802769:	55                   	push   %ebp
+  80276a:	89 e5                	mov    %esp,%ebp
+  80276c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80276f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802772:	50                   	push   %eax
+  802773:	ff 75 08             	push   0x8(%ebp)
+  802776:	e8 38 e9 ff ff       	call   8010b3 <fd_lookup>
+  80277b:	83 c4 10             	add    $0x10,%esp
+  80277e:	85 c0                	test   %eax,%eax
+  802780:	78 11                	js     802793 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802782:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802785:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80278b:	39 10                	cmp    %edx,(%eax)
+  80278d:	0f 94 c0             	sete   %al
+  802790:	0f b6 c0             	movzbl %al,%eax
+}
+  802793:	c9                   	leave
+  802794:	c3                   	ret
+
+00802795 <opencons>:
+{
+  802795:	55                   	push   %ebp
+  802796:	89 e5                	mov    %esp,%ebp
+  802798:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80279b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80279e:	50                   	push   %eax
+  80279f:	e8 b9 e8 ff ff       	call   80105d <fd_alloc>
+  8027a4:	83 c4 10             	add    $0x10,%esp
+  8027a7:	85 c0                	test   %eax,%eax
+  8027a9:	78 3a                	js     8027e5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8027ab:	83 ec 04             	sub    $0x4,%esp
+  8027ae:	68 07 04 00 00       	push   $0x407
+  8027b3:	ff 75 f4             	push   -0xc(%ebp)
+  8027b6:	6a 00                	push   $0x0
+  8027b8:	e8 54 e4 ff ff       	call   800c11 <sys_page_alloc>
+  8027bd:	83 c4 10             	add    $0x10,%esp
+  8027c0:	85 c0                	test   %eax,%eax
+  8027c2:	78 21                	js     8027e5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8027c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027c7:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8027cd:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8027cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027d2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8027d9:	83 ec 0c             	sub    $0xc,%esp
+  8027dc:	50                   	push   %eax
+  8027dd:	e8 54 e8 ff ff       	call   801036 <fd2num>
+  8027e2:	83 c4 10             	add    $0x10,%esp
+}
+  8027e5:	c9                   	leave
+  8027e6:	c3                   	ret
+
+008027e7 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8027e7:	55                   	push   %ebp
+  8027e8:	89 e5                	mov    %esp,%ebp
+  8027ea:	57                   	push   %edi
+  8027eb:	56                   	push   %esi
+  8027ec:	53                   	push   %ebx
+  8027ed:	83 ec 18             	sub    $0x18,%esp
+  8027f0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8027f6:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8027f9:	85 db                	test   %ebx,%ebx
+  8027fb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802800:	0f 45 c3             	cmovne %ebx,%eax
+  802803:	50                   	push   %eax
+  802804:	e8 8b e7 ff ff       	call   800f94 <sys_ipc_recv>
+
+	if (from_env_store)
+  802809:	83 c4 10             	add    $0x10,%esp
+  80280c:	85 ff                	test   %edi,%edi
+  80280e:	74 17                	je     802827 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802810:	ba 00 00 00 00       	mov    $0x0,%edx
+  802815:	85 c0                	test   %eax,%eax
+  802817:	75 0c                	jne    802825 <ipc_recv+0x3e>
+  802819:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  80281f:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802825:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802827:	85 f6                	test   %esi,%esi
+  802829:	74 2e                	je     802859 <ipc_recv+0x72>
+		if (!r && pg)
+  80282b:	85 c0                	test   %eax,%eax
+  80282d:	75 24                	jne    802853 <ipc_recv+0x6c>
+  80282f:	85 db                	test   %ebx,%ebx
+  802831:	74 20                	je     802853 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802833:	a1 08 50 80 00       	mov    0x805008,%eax
+  802838:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  80283e:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802840:	a1 08 50 80 00       	mov    0x805008,%eax
+  802845:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80284b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80284e:	5b                   	pop    %ebx
+  80284f:	5e                   	pop    %esi
+  802850:	5f                   	pop    %edi
+  802851:	5d                   	pop    %ebp
+  802852:	c3                   	ret
+			*perm_store = 0;
+  802853:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802859:	85 c0                	test   %eax,%eax
+  80285b:	75 ee                	jne    80284b <ipc_recv+0x64>
+  80285d:	eb e1                	jmp    802840 <ipc_recv+0x59>
+
+0080285f <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80285f:	55                   	push   %ebp
+  802860:	89 e5                	mov    %esp,%ebp
+  802862:	57                   	push   %edi
+  802863:	56                   	push   %esi
+  802864:	53                   	push   %ebx
+  802865:	83 ec 0c             	sub    $0xc,%esp
+  802868:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80286b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80286e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802871:	85 db                	test   %ebx,%ebx
+  802873:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802878:	0f 44 d8             	cmove  %eax,%ebx
+  80287b:	ff 75 14             	push   0x14(%ebp)
+  80287e:	53                   	push   %ebx
+  80287f:	56                   	push   %esi
+  802880:	57                   	push   %edi
+  802881:	e8 eb e6 ff ff       	call   800f71 <sys_ipc_try_send_yield>
+  802886:	83 c4 10             	add    $0x10,%esp
+  802889:	85 c0                	test   %eax,%eax
+  80288b:	79 1e                	jns    8028ab <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80288d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802890:	75 07                	jne    802899 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802892:	e8 fa e2 ff ff       	call   800b91 <sys_yield>
+  802897:	eb e2                	jmp    80287b <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802899:	50                   	push   %eax
+  80289a:	68 ef 32 80 00       	push   $0x8032ef
+  80289f:	6a 3d                	push   $0x3d
+  8028a1:	68 04 33 80 00       	push   $0x803304
+  8028a6:	e8 30 d8 ff ff       	call   8000db <_panic>
+	}
+}
+  8028ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028ae:	5b                   	pop    %ebx
+  8028af:	5e                   	pop    %esi
+  8028b0:	5f                   	pop    %edi
+  8028b1:	5d                   	pop    %ebp
+  8028b2:	c3                   	ret
+
+008028b3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8028b3:	55                   	push   %ebp
+  8028b4:	89 e5                	mov    %esp,%ebp
+  8028b6:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8028b9:	ff 75 08             	push   0x8(%ebp)
+  8028bc:	e8 50 e2 ff ff       	call   800b11 <sys_env_find>
+}
+  8028c1:	c9                   	leave
+  8028c2:	c3                   	ret
+
+008028c3 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8028c3:	55                   	push   %ebp
+  8028c4:	89 e5                	mov    %esp,%ebp
+  8028c6:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8028c9:	89 c2                	mov    %eax,%edx
+  8028cb:	c1 ea 16             	shr    $0x16,%edx
+  8028ce:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8028d5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8028da:	f6 c1 01             	test   $0x1,%cl
+  8028dd:	74 22                	je     802901 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8028df:	c1 e8 0c             	shr    $0xc,%eax
+  8028e2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8028e9:	a8 01                	test   $0x1,%al
+  8028eb:	74 14                	je     802901 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8028ed:	c1 e8 0c             	shr    $0xc,%eax
+  8028f0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8028f3:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8028fa:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8028fe:	0f b7 d2             	movzwl %dx,%edx
+}
+  802901:	89 d0                	mov    %edx,%eax
+  802903:	5d                   	pop    %ebp
+  802904:	c3                   	ret
+  802905:	66 90                	xchg   %ax,%ax
+  802907:	66 90                	xchg   %ax,%ax
+  802909:	66 90                	xchg   %ax,%ax
+  80290b:	66 90                	xchg   %ax,%ax
+  80290d:	66 90                	xchg   %ax,%ax
+  80290f:	90                   	nop
+
+00802910 <__udivmoddi4>:
+  802910:	55                   	push   %ebp
+  802911:	57                   	push   %edi
+  802912:	56                   	push   %esi
+  802913:	53                   	push   %ebx
+  802914:	83 ec 14             	sub    $0x14,%esp
+  802917:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80291b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80291f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802923:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802927:	89 f1                	mov    %esi,%ecx
+  802929:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80292d:	09 d9                	or     %ebx,%ecx
+  80292f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802933:	0f 84 92 00 00 00    	je     8029cb <__udivmoddi4+0xbb>
+  802939:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802940:	00 
+  802941:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802946:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80294d:	00 
+  80294e:	89 1c 24             	mov    %ebx,(%esp)
+  802951:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802955:	8d 76 00             	lea    0x0(%esi),%esi
+  802958:	89 e9                	mov    %ebp,%ecx
+  80295a:	89 c3                	mov    %eax,%ebx
+  80295c:	89 d6                	mov    %edx,%esi
+  80295e:	31 ff                	xor    %edi,%edi
+  802960:	d3 ee                	shr    %cl,%esi
+  802962:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802965:	f6 c1 20             	test   $0x20,%cl
+  802968:	0f 45 de             	cmovne %esi,%ebx
+  80296b:	0f 45 f7             	cmovne %edi,%esi
+  80296e:	8b 3c 24             	mov    (%esp),%edi
+  802971:	39 fb                	cmp    %edi,%ebx
+  802973:	89 f7                	mov    %esi,%edi
+  802975:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802979:	8b 1c 24             	mov    (%esp),%ebx
+  80297c:	19 f7                	sbb    %esi,%edi
+  80297e:	72 39                	jb     8029b9 <__udivmoddi4+0xa9>
+  802980:	89 e9                	mov    %ebp,%ecx
+  802982:	89 f7                	mov    %esi,%edi
+  802984:	89 de                	mov    %ebx,%esi
+  802986:	0f a5 df             	shld   %cl,%ebx,%edi
+  802989:	d3 e6                	shl    %cl,%esi
+  80298b:	31 db                	xor    %ebx,%ebx
+  80298d:	f6 c1 20             	test   $0x20,%cl
+  802990:	0f 45 fe             	cmovne %esi,%edi
+  802993:	0f 45 f3             	cmovne %ebx,%esi
+  802996:	29 f0                	sub    %esi,%eax
+  802998:	be 01 00 00 00       	mov    $0x1,%esi
+  80299d:	19 fa                	sbb    %edi,%edx
+  80299f:	31 ff                	xor    %edi,%edi
+  8029a1:	31 db                	xor    %ebx,%ebx
+  8029a3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029a6:	d3 e6                	shl    %cl,%esi
+  8029a8:	f6 c1 20             	test   $0x20,%cl
+  8029ab:	0f 45 fe             	cmovne %esi,%edi
+  8029ae:	0f 45 f3             	cmovne %ebx,%esi
+  8029b1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8029b5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8029b9:	83 ed 01             	sub    $0x1,%ebp
+  8029bc:	73 9a                	jae    802958 <__udivmoddi4+0x48>
+  8029be:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8029c2:	85 ff                	test   %edi,%edi
+  8029c4:	74 05                	je     8029cb <__udivmoddi4+0xbb>
+  8029c6:	89 07                	mov    %eax,(%edi)
+  8029c8:	89 57 04             	mov    %edx,0x4(%edi)
+  8029cb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029cf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029d3:	83 c4 14             	add    $0x14,%esp
+  8029d6:	5b                   	pop    %ebx
+  8029d7:	5e                   	pop    %esi
+  8029d8:	5f                   	pop    %edi
+  8029d9:	5d                   	pop    %ebp
+  8029da:	c3                   	ret
+  8029db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8029df:	90                   	nop
+
+008029e0 <__udivdi3>:
+  8029e0:	55                   	push   %ebp
+  8029e1:	57                   	push   %edi
+  8029e2:	56                   	push   %esi
+  8029e3:	53                   	push   %ebx
+  8029e4:	83 ec 14             	sub    $0x14,%esp
+  8029e7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8029eb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8029ef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8029f3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8029f7:	89 fb                	mov    %edi,%ebx
+  8029f9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8029fd:	09 f3                	or     %esi,%ebx
+  8029ff:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802a03:	0f 84 85 00 00 00    	je     802a8e <__udivdi3+0xae>
+  802a09:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802a10:	00 
+  802a11:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802a16:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802a1d:	00 
+  802a1e:	89 34 24             	mov    %esi,(%esp)
+  802a21:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802a25:	8d 76 00             	lea    0x0(%esi),%esi
+  802a28:	89 e9                	mov    %ebp,%ecx
+  802a2a:	89 c3                	mov    %eax,%ebx
+  802a2c:	89 d6                	mov    %edx,%esi
+  802a2e:	31 ff                	xor    %edi,%edi
+  802a30:	d3 ee                	shr    %cl,%esi
+  802a32:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a35:	f6 c1 20             	test   $0x20,%cl
+  802a38:	0f 45 de             	cmovne %esi,%ebx
+  802a3b:	0f 45 f7             	cmovne %edi,%esi
+  802a3e:	8b 3c 24             	mov    (%esp),%edi
+  802a41:	39 fb                	cmp    %edi,%ebx
+  802a43:	89 f7                	mov    %esi,%edi
+  802a45:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802a49:	8b 1c 24             	mov    (%esp),%ebx
+  802a4c:	19 f7                	sbb    %esi,%edi
+  802a4e:	72 39                	jb     802a89 <__udivdi3+0xa9>
+  802a50:	89 e9                	mov    %ebp,%ecx
+  802a52:	89 f7                	mov    %esi,%edi
+  802a54:	89 de                	mov    %ebx,%esi
+  802a56:	0f a5 df             	shld   %cl,%ebx,%edi
+  802a59:	d3 e6                	shl    %cl,%esi
+  802a5b:	31 db                	xor    %ebx,%ebx
+  802a5d:	f6 c1 20             	test   $0x20,%cl
+  802a60:	0f 45 fe             	cmovne %esi,%edi
+  802a63:	0f 45 f3             	cmovne %ebx,%esi
+  802a66:	29 f0                	sub    %esi,%eax
+  802a68:	be 01 00 00 00       	mov    $0x1,%esi
+  802a6d:	19 fa                	sbb    %edi,%edx
+  802a6f:	31 ff                	xor    %edi,%edi
+  802a71:	31 db                	xor    %ebx,%ebx
+  802a73:	0f a5 f7             	shld   %cl,%esi,%edi
+  802a76:	d3 e6                	shl    %cl,%esi
+  802a78:	f6 c1 20             	test   $0x20,%cl
+  802a7b:	0f 45 fe             	cmovne %esi,%edi
+  802a7e:	0f 45 f3             	cmovne %ebx,%esi
+  802a81:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802a85:	09 74 24 08          	or     %esi,0x8(%esp)
+  802a89:	83 ed 01             	sub    $0x1,%ebp
+  802a8c:	73 9a                	jae    802a28 <__udivdi3+0x48>
+  802a8e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802a92:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802a96:	83 c4 14             	add    $0x14,%esp
+  802a99:	5b                   	pop    %ebx
+  802a9a:	5e                   	pop    %esi
+  802a9b:	5f                   	pop    %edi
+  802a9c:	5d                   	pop    %ebp
+  802a9d:	c3                   	ret
+  802a9e:	66 90                	xchg   %ax,%ax
+
+00802aa0 <__umoddi3>:
+  802aa0:	57                   	push   %edi
+  802aa1:	56                   	push   %esi
+  802aa2:	53                   	push   %ebx
+  802aa3:	83 ec 08             	sub    $0x8,%esp
+  802aa6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  802aaa:	8b 74 24 20          	mov    0x20(%esp),%esi
+  802aae:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802ab2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ab6:	89 f9                	mov    %edi,%ecx
+  802ab8:	89 34 24             	mov    %esi,(%esp)
+  802abb:	09 f1                	or     %esi,%ecx
+  802abd:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802ac1:	74 53                	je     802b16 <__umoddi3+0x76>
+  802ac3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802acf:	90                   	nop
+  802ad0:	89 c6                	mov    %eax,%esi
+  802ad2:	89 d7                	mov    %edx,%edi
+  802ad4:	31 db                	xor    %ebx,%ebx
+  802ad6:	d3 ef                	shr    %cl,%edi
+  802ad8:	0f ad d6             	shrd   %cl,%edx,%esi
+  802adb:	f6 c1 20             	test   $0x20,%cl
+  802ade:	0f 45 f7             	cmovne %edi,%esi
+  802ae1:	0f 45 fb             	cmovne %ebx,%edi
+  802ae4:	8b 1c 24             	mov    (%esp),%ebx
+  802ae7:	39 de                	cmp    %ebx,%esi
+  802ae9:	89 fb                	mov    %edi,%ebx
+  802aeb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  802aef:	8b 34 24             	mov    (%esp),%esi
+  802af2:	19 fb                	sbb    %edi,%ebx
+  802af4:	72 14                	jb     802b0a <__umoddi3+0x6a>
+  802af6:	0f a5 f7             	shld   %cl,%esi,%edi
+  802af9:	31 db                	xor    %ebx,%ebx
+  802afb:	d3 e6                	shl    %cl,%esi
+  802afd:	f6 c1 20             	test   $0x20,%cl
+  802b00:	0f 45 fe             	cmovne %esi,%edi
+  802b03:	0f 45 f3             	cmovne %ebx,%esi
+  802b06:	29 f0                	sub    %esi,%eax
+  802b08:	19 fa                	sbb    %edi,%edx
+  802b0a:	83 e9 01             	sub    $0x1,%ecx
+  802b0d:	73 c1                	jae    802ad0 <__umoddi3+0x30>
+  802b0f:	83 c4 08             	add    $0x8,%esp
+  802b12:	5b                   	pop    %ebx
+  802b13:	5e                   	pop    %esi
+  802b14:	5f                   	pop    %edi
+  802b15:	c3                   	ret
+  802b16:	83 c4 08             	add    $0x8,%esp
+  802b19:	31 c0                	xor    %eax,%eax
+  802b1b:	31 d2                	xor    %edx,%edx
+  802b1d:	5b                   	pop    %ebx
+  802b1e:	5e                   	pop    %esi
+  802b1f:	5f                   	pop    %edi
+  802b20:	c3                   	ret
+  802b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802b28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802b2f:	90                   	nop
+
+00802b30 <__divdi3>:
+  802b30:	55                   	push   %ebp
+  802b31:	57                   	push   %edi
+  802b32:	56                   	push   %esi
+  802b33:	53                   	push   %ebx
+  802b34:	83 ec 1c             	sub    $0x1c,%esp
+  802b37:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802b3b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802b3f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802b43:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802b47:	85 ff                	test   %edi,%edi
+  802b49:	0f 88 da 00 00 00    	js     802c29 <__divdi3+0xf9>
+  802b4f:	85 db                	test   %ebx,%ebx
+  802b51:	78 16                	js     802b69 <__divdi3+0x39>
+  802b53:	89 dd                	mov    %ebx,%ebp
+  802b55:	89 c8                	mov    %ecx,%eax
+  802b57:	89 da                	mov    %ebx,%edx
+  802b59:	09 cd                	or     %ecx,%ebp
+  802b5b:	0f 85 fd 00 00 00    	jne    802c5e <__divdi3+0x12e>
+  802b61:	83 c4 1c             	add    $0x1c,%esp
+  802b64:	5b                   	pop    %ebx
+  802b65:	5e                   	pop    %esi
+  802b66:	5f                   	pop    %edi
+  802b67:	5d                   	pop    %ebp
+  802b68:	c3                   	ret
+  802b69:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802b6e:	f7 d9                	neg    %ecx
+  802b70:	89 f0                	mov    %esi,%eax
+  802b72:	89 fa                	mov    %edi,%edx
+  802b74:	83 d3 00             	adc    $0x0,%ebx
+  802b77:	89 0c 24             	mov    %ecx,(%esp)
+  802b7a:	f7 db                	neg    %ebx
+  802b7c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802b80:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802b87:	00 
+  802b88:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802b8d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802b94:	00 
+  802b95:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802b99:	89 cd                	mov    %ecx,%ebp
+  802b9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802b9f:	90                   	nop
+  802ba0:	89 e9                	mov    %ebp,%ecx
+  802ba2:	89 c3                	mov    %eax,%ebx
+  802ba4:	89 d6                	mov    %edx,%esi
+  802ba6:	31 ff                	xor    %edi,%edi
+  802ba8:	d3 ee                	shr    %cl,%esi
+  802baa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802bad:	f6 c1 20             	test   $0x20,%cl
+  802bb0:	0f 45 de             	cmovne %esi,%ebx
+  802bb3:	0f 45 f7             	cmovne %edi,%esi
+  802bb6:	8b 3c 24             	mov    (%esp),%edi
+  802bb9:	39 fb                	cmp    %edi,%ebx
+  802bbb:	89 f7                	mov    %esi,%edi
+  802bbd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802bc1:	8b 1c 24             	mov    (%esp),%ebx
+  802bc4:	19 f7                	sbb    %esi,%edi
+  802bc6:	72 39                	jb     802c01 <__divdi3+0xd1>
+  802bc8:	89 e9                	mov    %ebp,%ecx
+  802bca:	89 f7                	mov    %esi,%edi
+  802bcc:	89 de                	mov    %ebx,%esi
+  802bce:	0f a5 df             	shld   %cl,%ebx,%edi
+  802bd1:	d3 e6                	shl    %cl,%esi
+  802bd3:	31 db                	xor    %ebx,%ebx
+  802bd5:	f6 c1 20             	test   $0x20,%cl
+  802bd8:	0f 45 fe             	cmovne %esi,%edi
+  802bdb:	0f 45 f3             	cmovne %ebx,%esi
+  802bde:	29 f0                	sub    %esi,%eax
+  802be0:	be 01 00 00 00       	mov    $0x1,%esi
+  802be5:	19 fa                	sbb    %edi,%edx
+  802be7:	31 ff                	xor    %edi,%edi
+  802be9:	31 db                	xor    %ebx,%ebx
+  802beb:	0f a5 f7             	shld   %cl,%esi,%edi
+  802bee:	d3 e6                	shl    %cl,%esi
+  802bf0:	f6 c1 20             	test   $0x20,%cl
+  802bf3:	0f 45 fe             	cmovne %esi,%edi
+  802bf6:	0f 45 f3             	cmovne %ebx,%esi
+  802bf9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802bfd:	09 74 24 08          	or     %esi,0x8(%esp)
+  802c01:	83 ed 01             	sub    $0x1,%ebp
+  802c04:	73 9a                	jae    802ba0 <__divdi3+0x70>
+  802c06:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802c0a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c0e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c12:	85 ed                	test   %ebp,%ebp
+  802c14:	0f 84 47 ff ff ff    	je     802b61 <__divdi3+0x31>
+  802c1a:	f7 d8                	neg    %eax
+  802c1c:	83 d2 00             	adc    $0x0,%edx
+  802c1f:	83 c4 1c             	add    $0x1c,%esp
+  802c22:	5b                   	pop    %ebx
+  802c23:	f7 da                	neg    %edx
+  802c25:	5e                   	pop    %esi
+  802c26:	5f                   	pop    %edi
+  802c27:	5d                   	pop    %ebp
+  802c28:	c3                   	ret
+  802c29:	f7 de                	neg    %esi
+  802c2b:	83 d7 00             	adc    $0x0,%edi
+  802c2e:	f7 df                	neg    %edi
+  802c30:	85 db                	test   %ebx,%ebx
+  802c32:	78 23                	js     802c57 <__divdi3+0x127>
+  802c34:	89 dd                	mov    %ebx,%ebp
+  802c36:	89 c8                	mov    %ecx,%eax
+  802c38:	89 da                	mov    %ebx,%edx
+  802c3a:	09 cd                	or     %ecx,%ebp
+  802c3c:	0f 84 1f ff ff ff    	je     802b61 <__divdi3+0x31>
+  802c42:	89 0c 24             	mov    %ecx,(%esp)
+  802c45:	89 f0                	mov    %esi,%eax
+  802c47:	89 fa                	mov    %edi,%edx
+  802c49:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802c4e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802c52:	e9 29 ff ff ff       	jmp    802b80 <__divdi3+0x50>
+  802c57:	31 ed                	xor    %ebp,%ebp
+  802c59:	e9 10 ff ff ff       	jmp    802b6e <__divdi3+0x3e>
+  802c5e:	89 0c 24             	mov    %ecx,(%esp)
+  802c61:	89 f0                	mov    %esi,%eax
+  802c63:	89 fa                	mov    %edi,%edx
+  802c65:	31 ed                	xor    %ebp,%ebp
+  802c67:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802c6b:	e9 10 ff ff ff       	jmp    802b80 <__divdi3+0x50>
+
+00802c70 <__moddi3>:
+  802c70:	55                   	push   %ebp
+  802c71:	57                   	push   %edi
+  802c72:	56                   	push   %esi
+  802c73:	53                   	push   %ebx
+  802c74:	83 ec 14             	sub    $0x14,%esp
+  802c77:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802c7b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802c7f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802c83:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802c87:	85 d2                	test   %edx,%edx
+  802c89:	0f 88 9b 00 00 00    	js     802d2a <__moddi3+0xba>
+  802c8f:	89 f7                	mov    %esi,%edi
+  802c91:	31 ed                	xor    %ebp,%ebp
+  802c93:	09 cf                	or     %ecx,%edi
+  802c95:	0f 84 83 00 00 00    	je     802d1e <__moddi3+0xae>
+  802c9b:	89 cb                	mov    %ecx,%ebx
+  802c9d:	89 f7                	mov    %esi,%edi
+  802c9f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802ca3:	f7 db                	neg    %ebx
+  802ca5:	83 d7 00             	adc    $0x0,%edi
+  802ca8:	f7 df                	neg    %edi
+  802caa:	0f 49 f7             	cmovns %edi,%esi
+  802cad:	0f 49 cb             	cmovns %ebx,%ecx
+  802cb0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802cb4:	89 0c 24             	mov    %ecx,(%esp)
+  802cb7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802cbc:	89 cd                	mov    %ecx,%ebp
+  802cbe:	66 90                	xchg   %ax,%ax
+  802cc0:	89 e9                	mov    %ebp,%ecx
+  802cc2:	89 c3                	mov    %eax,%ebx
+  802cc4:	89 d6                	mov    %edx,%esi
+  802cc6:	31 ff                	xor    %edi,%edi
+  802cc8:	d3 ee                	shr    %cl,%esi
+  802cca:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802ccd:	f6 c1 20             	test   $0x20,%cl
+  802cd0:	0f 45 de             	cmovne %esi,%ebx
+  802cd3:	0f 45 f7             	cmovne %edi,%esi
+  802cd6:	8b 3c 24             	mov    (%esp),%edi
+  802cd9:	39 fb                	cmp    %edi,%ebx
+  802cdb:	89 f7                	mov    %esi,%edi
+  802cdd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ce1:	8b 1c 24             	mov    (%esp),%ebx
+  802ce4:	19 f7                	sbb    %esi,%edi
+  802ce6:	72 1a                	jb     802d02 <__moddi3+0x92>
+  802ce8:	89 e9                	mov    %ebp,%ecx
+  802cea:	89 f7                	mov    %esi,%edi
+  802cec:	89 de                	mov    %ebx,%esi
+  802cee:	0f a5 df             	shld   %cl,%ebx,%edi
+  802cf1:	d3 e6                	shl    %cl,%esi
+  802cf3:	31 db                	xor    %ebx,%ebx
+  802cf5:	f6 c1 20             	test   $0x20,%cl
+  802cf8:	0f 45 fe             	cmovne %esi,%edi
+  802cfb:	0f 45 f3             	cmovne %ebx,%esi
+  802cfe:	29 f0                	sub    %esi,%eax
+  802d00:	19 fa                	sbb    %edi,%edx
+  802d02:	83 ed 01             	sub    $0x1,%ebp
+  802d05:	73 b9                	jae    802cc0 <__moddi3+0x50>
+  802d07:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802d0b:	85 ed                	test   %ebp,%ebp
+  802d0d:	74 07                	je     802d16 <__moddi3+0xa6>
+  802d0f:	f7 d8                	neg    %eax
+  802d11:	83 d2 00             	adc    $0x0,%edx
+  802d14:	f7 da                	neg    %edx
+  802d16:	83 c4 14             	add    $0x14,%esp
+  802d19:	5b                   	pop    %ebx
+  802d1a:	5e                   	pop    %esi
+  802d1b:	5f                   	pop    %edi
+  802d1c:	5d                   	pop    %ebp
+  802d1d:	c3                   	ret
+  802d1e:	83 c4 14             	add    $0x14,%esp
+  802d21:	31 c0                	xor    %eax,%eax
+  802d23:	31 d2                	xor    %edx,%edx
+  802d25:	5b                   	pop    %ebx
+  802d26:	5e                   	pop    %esi
+  802d27:	5f                   	pop    %edi
+  802d28:	5d                   	pop    %ebp
+  802d29:	c3                   	ret
+  802d2a:	89 f7                	mov    %esi,%edi
+  802d2c:	09 cf                	or     %ecx,%edi
+  802d2e:	74 11                	je     802d41 <__moddi3+0xd1>
+  802d30:	f7 d8                	neg    %eax
+  802d32:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802d37:	83 d2 00             	adc    $0x0,%edx
+  802d3a:	f7 da                	neg    %edx
+  802d3c:	e9 5a ff ff ff       	jmp    802c9b <__moddi3+0x2b>
+  802d41:	31 c0                	xor    %eax,%eax
+  802d43:	31 d2                	xor    %edx,%edx
+  802d45:	eb c8                	jmp    802d0f <__moddi3+0x9f>
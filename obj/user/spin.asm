@@ -0,0 +1,6115 @@
+
+obj/user/spin.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 10             	sub    $0x10,%esp
+	envid_t env;
+
+	cprintf("I am the parent.  Forking the child...\n");
+  80003a:	68 e0 2a 80 00       	push   $0x802ae0
+  80003f:	e8 66 01 00 00       	call   8001aa <cprintf>
+	if ((env = fork()) == 0) {
+  800044:	e8 bc 10 00 00       	call   801105 <fork>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	75 12                	jne    800062 <umain+0x2f>
+		cprintf("I am the child.  Spinning...\n");
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	68 58 2b 80 00       	push   $0x802b58
+  800058:	e8 4d 01 00 00       	call   8001aa <cprintf>
+  80005d:	83 c4 10             	add    $0x10,%esp
+		while (1)
+  800060:	eb fe                	jmp    800060 <umain+0x2d>
+  800062:	89 c3                	mov    %eax,%ebx
+			/* do nothing */;
+	}
+
+	cprintf("I am the parent.  Running the child...\n");
+  800064:	83 ec 0c             	sub    $0xc,%esp
+  800067:	68 08 2b 80 00       	push   $0x802b08
+  80006c:	e8 39 01 00 00       	call   8001aa <cprintf>
+	sys_yield();
+  800071:	e8 0f 0b 00 00       	call   800b85 <sys_yield>
+	sys_yield();
+  800076:	e8 0a 0b 00 00       	call   800b85 <sys_yield>
+	sys_yield();
+  80007b:	e8 05 0b 00 00       	call   800b85 <sys_yield>
+	sys_yield();
+  800080:	e8 00 0b 00 00       	call   800b85 <sys_yield>
+	sys_yield();
+  800085:	e8 fb 0a 00 00       	call   800b85 <sys_yield>
+	sys_yield();
+  80008a:	e8 f6 0a 00 00       	call   800b85 <sys_yield>
+	sys_yield();
+  80008f:	e8 f1 0a 00 00       	call   800b85 <sys_yield>
+	sys_yield();
+  800094:	e8 ec 0a 00 00       	call   800b85 <sys_yield>
+
+	cprintf("I am the parent.  Killing the child...\n");
+  800099:	c7 04 24 30 2b 80 00 	movl   $0x802b30,(%esp)
+  8000a0:	e8 05 01 00 00       	call   8001aa <cprintf>
+	sys_env_destroy(env);
+  8000a5:	89 1c 24             	mov    %ebx,(%esp)
+  8000a8:	e8 78 0a 00 00       	call   800b25 <sys_env_destroy>
+}
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000c0:	e8 a1 0a 00 00       	call   800b66 <sys_getenvid>
+  8000c5:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000ca:	c1 e0 09             	shl    $0x9,%eax
+  8000cd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d2:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000d7:	85 db                	test   %ebx,%ebx
+  8000d9:	7e 07                	jle    8000e2 <libmain+0x2d>
+		binaryname = argv[0];
+  8000db:	8b 06                	mov    (%esi),%eax
+  8000dd:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000e2:	83 ec 08             	sub    $0x8,%esp
+  8000e5:	56                   	push   %esi
+  8000e6:	53                   	push   %ebx
+  8000e7:	e8 47 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000ec:	e8 0a 00 00 00       	call   8000fb <exit>
+}
+  8000f1:	83 c4 10             	add    $0x10,%esp
+  8000f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000f7:	5b                   	pop    %ebx
+  8000f8:	5e                   	pop    %esi
+  8000f9:	5d                   	pop    %ebp
+  8000fa:	c3                   	ret
+
+008000fb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fb:	55                   	push   %ebp
+  8000fc:	89 e5                	mov    %esp,%ebp
+  8000fe:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800101:	e8 5a 14 00 00       	call   801560 <close_all>
+	sys_env_destroy(0);
+  800106:	83 ec 0c             	sub    $0xc,%esp
+  800109:	6a 00                	push   $0x0
+  80010b:	e8 15 0a 00 00       	call   800b25 <sys_env_destroy>
+}
+  800110:	83 c4 10             	add    $0x10,%esp
+  800113:	c9                   	leave
+  800114:	c3                   	ret
+
+00800115 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800115:	55                   	push   %ebp
+  800116:	89 e5                	mov    %esp,%ebp
+  800118:	53                   	push   %ebx
+  800119:	83 ec 04             	sub    $0x4,%esp
+  80011c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80011f:	8b 13                	mov    (%ebx),%edx
+  800121:	8d 42 01             	lea    0x1(%edx),%eax
+  800124:	89 03                	mov    %eax,(%ebx)
+  800126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800129:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80012d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800132:	74 09                	je     80013d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800134:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800138:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80013b:	c9                   	leave
+  80013c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80013d:	83 ec 08             	sub    $0x8,%esp
+  800140:	68 ff 00 00 00       	push   $0xff
+  800145:	8d 43 08             	lea    0x8(%ebx),%eax
+  800148:	50                   	push   %eax
+  800149:	e8 7a 09 00 00       	call   800ac8 <sys_cputs>
+		b->idx = 0;
+  80014e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800154:	83 c4 10             	add    $0x10,%esp
+  800157:	eb db                	jmp    800134 <putch+0x1f>
+
+00800159 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800159:	55                   	push   %ebp
+  80015a:	89 e5                	mov    %esp,%ebp
+  80015c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800162:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800169:	00 00 00 
+	b.cnt = 0;
+  80016c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800173:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800176:	ff 75 0c             	push   0xc(%ebp)
+  800179:	ff 75 08             	push   0x8(%ebp)
+  80017c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800182:	50                   	push   %eax
+  800183:	68 15 01 80 00       	push   $0x800115
+  800188:	e8 14 01 00 00       	call   8002a1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80018d:	83 c4 08             	add    $0x8,%esp
+  800190:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800196:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80019c:	50                   	push   %eax
+  80019d:	e8 26 09 00 00       	call   800ac8 <sys_cputs>
+
+	return b.cnt;
+}
+  8001a2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001a8:	c9                   	leave
+  8001a9:	c3                   	ret
+
+008001aa <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001b0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001b3:	50                   	push   %eax
+  8001b4:	ff 75 08             	push   0x8(%ebp)
+  8001b7:	e8 9d ff ff ff       	call   800159 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001bc:	c9                   	leave
+  8001bd:	c3                   	ret
+
+008001be <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001be:	55                   	push   %ebp
+  8001bf:	89 e5                	mov    %esp,%ebp
+  8001c1:	57                   	push   %edi
+  8001c2:	56                   	push   %esi
+  8001c3:	53                   	push   %ebx
+  8001c4:	83 ec 1c             	sub    $0x1c,%esp
+  8001c7:	89 c7                	mov    %eax,%edi
+  8001c9:	89 d6                	mov    %edx,%esi
+  8001cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001d1:	89 d1                	mov    %edx,%ecx
+  8001d3:	89 c2                	mov    %eax,%edx
+  8001d5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001d8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001db:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001de:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001e4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001eb:	39 c2                	cmp    %eax,%edx
+  8001ed:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001f0:	72 3e                	jb     800230 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001f2:	83 ec 0c             	sub    $0xc,%esp
+  8001f5:	ff 75 18             	push   0x18(%ebp)
+  8001f8:	83 eb 01             	sub    $0x1,%ebx
+  8001fb:	53                   	push   %ebx
+  8001fc:	50                   	push   %eax
+  8001fd:	83 ec 08             	sub    $0x8,%esp
+  800200:	ff 75 e4             	push   -0x1c(%ebp)
+  800203:	ff 75 e0             	push   -0x20(%ebp)
+  800206:	ff 75 dc             	push   -0x24(%ebp)
+  800209:	ff 75 d8             	push   -0x28(%ebp)
+  80020c:	e8 5f 25 00 00       	call   802770 <__udivdi3>
+  800211:	83 c4 18             	add    $0x18,%esp
+  800214:	52                   	push   %edx
+  800215:	50                   	push   %eax
+  800216:	89 f2                	mov    %esi,%edx
+  800218:	89 f8                	mov    %edi,%eax
+  80021a:	e8 9f ff ff ff       	call   8001be <printnum>
+  80021f:	83 c4 20             	add    $0x20,%esp
+  800222:	eb 13                	jmp    800237 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800224:	83 ec 08             	sub    $0x8,%esp
+  800227:	56                   	push   %esi
+  800228:	ff 75 18             	push   0x18(%ebp)
+  80022b:	ff d7                	call   *%edi
+  80022d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800230:	83 eb 01             	sub    $0x1,%ebx
+  800233:	85 db                	test   %ebx,%ebx
+  800235:	7f ed                	jg     800224 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800237:	83 ec 08             	sub    $0x8,%esp
+  80023a:	56                   	push   %esi
+  80023b:	83 ec 04             	sub    $0x4,%esp
+  80023e:	ff 75 e4             	push   -0x1c(%ebp)
+  800241:	ff 75 e0             	push   -0x20(%ebp)
+  800244:	ff 75 dc             	push   -0x24(%ebp)
+  800247:	ff 75 d8             	push   -0x28(%ebp)
+  80024a:	e8 e1 25 00 00       	call   802830 <__umoddi3>
+  80024f:	83 c4 14             	add    $0x14,%esp
+  800252:	0f be 80 80 2b 80 00 	movsbl 0x802b80(%eax),%eax
+  800259:	50                   	push   %eax
+  80025a:	ff d7                	call   *%edi
+}
+  80025c:	83 c4 10             	add    $0x10,%esp
+  80025f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800262:	5b                   	pop    %ebx
+  800263:	5e                   	pop    %esi
+  800264:	5f                   	pop    %edi
+  800265:	5d                   	pop    %ebp
+  800266:	c3                   	ret
+
+00800267 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800267:	55                   	push   %ebp
+  800268:	89 e5                	mov    %esp,%ebp
+  80026a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80026d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800271:	8b 10                	mov    (%eax),%edx
+  800273:	3b 50 04             	cmp    0x4(%eax),%edx
+  800276:	73 0a                	jae    800282 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800278:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80027b:	89 08                	mov    %ecx,(%eax)
+  80027d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800280:	88 02                	mov    %al,(%edx)
+}
+  800282:	5d                   	pop    %ebp
+  800283:	c3                   	ret
+
+00800284 <printfmt>:
+{
+  800284:	55                   	push   %ebp
+  800285:	89 e5                	mov    %esp,%ebp
+  800287:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80028a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80028d:	50                   	push   %eax
+  80028e:	ff 75 10             	push   0x10(%ebp)
+  800291:	ff 75 0c             	push   0xc(%ebp)
+  800294:	ff 75 08             	push   0x8(%ebp)
+  800297:	e8 05 00 00 00       	call   8002a1 <vprintfmt>
+}
+  80029c:	83 c4 10             	add    $0x10,%esp
+  80029f:	c9                   	leave
+  8002a0:	c3                   	ret
+
+008002a1 <vprintfmt>:
+{
+  8002a1:	55                   	push   %ebp
+  8002a2:	89 e5                	mov    %esp,%ebp
+  8002a4:	57                   	push   %edi
+  8002a5:	56                   	push   %esi
+  8002a6:	53                   	push   %ebx
+  8002a7:	83 ec 2c             	sub    $0x2c,%esp
+  8002aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002b0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002b3:	eb 0a                	jmp    8002bf <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002b5:	83 ec 08             	sub    $0x8,%esp
+  8002b8:	53                   	push   %ebx
+  8002b9:	50                   	push   %eax
+  8002ba:	ff d6                	call   *%esi
+  8002bc:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002bf:	83 c7 01             	add    $0x1,%edi
+  8002c2:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002c6:	83 f8 25             	cmp    $0x25,%eax
+  8002c9:	74 0c                	je     8002d7 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002cb:	85 c0                	test   %eax,%eax
+  8002cd:	75 e6                	jne    8002b5 <vprintfmt+0x14>
+}
+  8002cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d2:	5b                   	pop    %ebx
+  8002d3:	5e                   	pop    %esi
+  8002d4:	5f                   	pop    %edi
+  8002d5:	5d                   	pop    %ebp
+  8002d6:	c3                   	ret
+		padc = ' ';
+  8002d7:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002db:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002e2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002e9:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002f5:	8d 47 01             	lea    0x1(%edi),%eax
+  8002f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002fb:	0f b6 17             	movzbl (%edi),%edx
+  8002fe:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800301:	3c 55                	cmp    $0x55,%al
+  800303:	0f 87 cf 03 00 00    	ja     8006d8 <vprintfmt+0x437>
+  800309:	0f b6 c0             	movzbl %al,%eax
+  80030c:	ff 24 85 c0 2c 80 00 	jmp    *0x802cc0(,%eax,4)
+  800313:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800316:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80031a:	eb d9                	jmp    8002f5 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80031c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80031f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800323:	eb d0                	jmp    8002f5 <vprintfmt+0x54>
+  800325:	0f b6 d2             	movzbl %dl,%edx
+  800328:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80032b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800330:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800333:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800336:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80033a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80033d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800340:	83 f9 09             	cmp    $0x9,%ecx
+  800343:	77 55                	ja     80039a <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800345:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800348:	eb e9                	jmp    800333 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80034a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80034d:	8b 00                	mov    (%eax),%eax
+  80034f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800352:	8b 45 14             	mov    0x14(%ebp),%eax
+  800355:	8d 40 04             	lea    0x4(%eax),%eax
+  800358:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80035b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80035e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800362:	79 91                	jns    8002f5 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800364:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800367:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80036a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800371:	eb 82                	jmp    8002f5 <vprintfmt+0x54>
+			if (width < 0)
+  800373:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800376:	85 d2                	test   %edx,%edx
+  800378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037d:	0f 49 c2             	cmovns %edx,%eax
+  800380:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800383:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800386:	e9 6a ff ff ff       	jmp    8002f5 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80038b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80038e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800395:	e9 5b ff ff ff       	jmp    8002f5 <vprintfmt+0x54>
+  80039a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80039d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a0:	eb bc                	jmp    80035e <vprintfmt+0xbd>
+			lflag++;
+  8003a2:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003a8:	e9 48 ff ff ff       	jmp    8002f5 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b0:	8d 78 04             	lea    0x4(%eax),%edi
+  8003b3:	83 ec 08             	sub    $0x8,%esp
+  8003b6:	53                   	push   %ebx
+  8003b7:	ff 30                	push   (%eax)
+  8003b9:	ff d6                	call   *%esi
+			break;
+  8003bb:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003be:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003c1:	e9 b1 02 00 00       	jmp    800677 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c9:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003cc:	8b 10                	mov    (%eax),%edx
+  8003ce:	89 d0                	mov    %edx,%eax
+  8003d0:	f7 d8                	neg    %eax
+  8003d2:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003d5:	83 f8 0f             	cmp    $0xf,%eax
+  8003d8:	7f 23                	jg     8003fd <vprintfmt+0x15c>
+  8003da:	8b 14 85 20 2e 80 00 	mov    0x802e20(,%eax,4),%edx
+  8003e1:	85 d2                	test   %edx,%edx
+  8003e3:	74 18                	je     8003fd <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003e5:	52                   	push   %edx
+  8003e6:	68 49 30 80 00       	push   $0x803049
+  8003eb:	53                   	push   %ebx
+  8003ec:	56                   	push   %esi
+  8003ed:	e8 92 fe ff ff       	call   800284 <printfmt>
+  8003f2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f5:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003f8:	e9 7a 02 00 00       	jmp    800677 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003fd:	50                   	push   %eax
+  8003fe:	68 98 2b 80 00       	push   $0x802b98
+  800403:	53                   	push   %ebx
+  800404:	56                   	push   %esi
+  800405:	e8 7a fe ff ff       	call   800284 <printfmt>
+  80040a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80040d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800410:	e9 62 02 00 00       	jmp    800677 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800415:	8b 45 14             	mov    0x14(%ebp),%eax
+  800418:	83 c0 04             	add    $0x4,%eax
+  80041b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80041e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800421:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800423:	85 c9                	test   %ecx,%ecx
+  800425:	b8 91 2b 80 00       	mov    $0x802b91,%eax
+  80042a:	0f 45 c1             	cmovne %ecx,%eax
+  80042d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800430:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800434:	7e 06                	jle    80043c <vprintfmt+0x19b>
+  800436:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80043a:	75 0b                	jne    800447 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80043c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80043f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800442:	89 75 08             	mov    %esi,0x8(%ebp)
+  800445:	eb 5c                	jmp    8004a3 <vprintfmt+0x202>
+  800447:	83 ec 08             	sub    $0x8,%esp
+  80044a:	ff 75 d0             	push   -0x30(%ebp)
+  80044d:	ff 75 cc             	push   -0x34(%ebp)
+  800450:	e8 20 03 00 00       	call   800775 <strnlen>
+  800455:	89 c2                	mov    %eax,%edx
+  800457:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80045a:	29 d0                	sub    %edx,%eax
+  80045c:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80045f:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800463:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800466:	89 75 08             	mov    %esi,0x8(%ebp)
+  800469:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80046b:	eb 0e                	jmp    80047b <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80046d:	83 ec 08             	sub    $0x8,%esp
+  800470:	53                   	push   %ebx
+  800471:	57                   	push   %edi
+  800472:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800475:	83 ee 01             	sub    $0x1,%esi
+  800478:	83 c4 10             	add    $0x10,%esp
+  80047b:	85 f6                	test   %esi,%esi
+  80047d:	7f ee                	jg     80046d <vprintfmt+0x1cc>
+  80047f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800482:	8b 75 08             	mov    0x8(%ebp),%esi
+  800485:	85 c0                	test   %eax,%eax
+  800487:	ba 00 00 00 00       	mov    $0x0,%edx
+  80048c:	0f 49 d0             	cmovns %eax,%edx
+  80048f:	29 d0                	sub    %edx,%eax
+  800491:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800494:	eb a6                	jmp    80043c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800496:	83 ec 08             	sub    $0x8,%esp
+  800499:	53                   	push   %ebx
+  80049a:	52                   	push   %edx
+  80049b:	ff 55 08             	call   *0x8(%ebp)
+  80049e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004a1:	89 f1                	mov    %esi,%ecx
+  8004a3:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004a6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004aa:	0f be d0             	movsbl %al,%edx
+  8004ad:	85 d2                	test   %edx,%edx
+  8004af:	74 28                	je     8004d9 <vprintfmt+0x238>
+  8004b1:	85 ff                	test   %edi,%edi
+  8004b3:	78 05                	js     8004ba <vprintfmt+0x219>
+  8004b5:	83 ef 01             	sub    $0x1,%edi
+  8004b8:	78 30                	js     8004ea <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004ba:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004be:	74 d6                	je     800496 <vprintfmt+0x1f5>
+  8004c0:	0f be c0             	movsbl %al,%eax
+  8004c3:	83 e8 20             	sub    $0x20,%eax
+  8004c6:	83 f8 5e             	cmp    $0x5e,%eax
+  8004c9:	76 cb                	jbe    800496 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004cb:	83 ec 08             	sub    $0x8,%esp
+  8004ce:	53                   	push   %ebx
+  8004cf:	6a 3f                	push   $0x3f
+  8004d1:	ff 55 08             	call   *0x8(%ebp)
+  8004d4:	83 c4 10             	add    $0x10,%esp
+  8004d7:	eb c8                	jmp    8004a1 <vprintfmt+0x200>
+  8004d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004dc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004df:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e2:	01 d0                	add    %edx,%eax
+  8004e4:	29 c8                	sub    %ecx,%eax
+  8004e6:	89 c7                	mov    %eax,%edi
+  8004e8:	eb 13                	jmp    8004fd <vprintfmt+0x25c>
+  8004ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ed:	eb ed                	jmp    8004dc <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004ef:	83 ec 08             	sub    $0x8,%esp
+  8004f2:	53                   	push   %ebx
+  8004f3:	6a 20                	push   $0x20
+  8004f5:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004f7:	83 ef 01             	sub    $0x1,%edi
+  8004fa:	83 c4 10             	add    $0x10,%esp
+  8004fd:	85 ff                	test   %edi,%edi
+  8004ff:	7f ee                	jg     8004ef <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800501:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800504:	89 45 14             	mov    %eax,0x14(%ebp)
+  800507:	e9 6b 01 00 00       	jmp    800677 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80050c:	83 f9 01             	cmp    $0x1,%ecx
+  80050f:	7f 1f                	jg     800530 <vprintfmt+0x28f>
+	else if (lflag)
+  800511:	85 c9                	test   %ecx,%ecx
+  800513:	74 67                	je     80057c <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800515:	8b 45 14             	mov    0x14(%ebp),%eax
+  800518:	8b 00                	mov    (%eax),%eax
+  80051a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80051d:	89 c1                	mov    %eax,%ecx
+  80051f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800522:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800525:	8b 45 14             	mov    0x14(%ebp),%eax
+  800528:	8d 40 04             	lea    0x4(%eax),%eax
+  80052b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80052e:	eb 17                	jmp    800547 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800530:	8b 45 14             	mov    0x14(%ebp),%eax
+  800533:	8b 50 04             	mov    0x4(%eax),%edx
+  800536:	8b 00                	mov    (%eax),%eax
+  800538:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80053b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8d 40 08             	lea    0x8(%eax),%eax
+  800544:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800547:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80054a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80054d:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800552:	85 c9                	test   %ecx,%ecx
+  800554:	0f 89 03 01 00 00    	jns    80065d <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80055a:	83 ec 08             	sub    $0x8,%esp
+  80055d:	53                   	push   %ebx
+  80055e:	6a 2d                	push   $0x2d
+  800560:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800562:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800565:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800568:	f7 da                	neg    %edx
+  80056a:	83 d1 00             	adc    $0x0,%ecx
+  80056d:	f7 d9                	neg    %ecx
+  80056f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800572:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800577:	e9 e1 00 00 00       	jmp    80065d <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80057c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057f:	8b 00                	mov    (%eax),%eax
+  800581:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800584:	89 c1                	mov    %eax,%ecx
+  800586:	c1 f9 1f             	sar    $0x1f,%ecx
+  800589:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80058c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058f:	8d 40 04             	lea    0x4(%eax),%eax
+  800592:	89 45 14             	mov    %eax,0x14(%ebp)
+  800595:	eb b0                	jmp    800547 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800597:	83 f9 01             	cmp    $0x1,%ecx
+  80059a:	7f 1e                	jg     8005ba <vprintfmt+0x319>
+	else if (lflag)
+  80059c:	85 c9                	test   %ecx,%ecx
+  80059e:	74 32                	je     8005d2 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a3:	8b 10                	mov    (%eax),%edx
+  8005a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005b5:	e9 a3 00 00 00       	jmp    80065d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8b 10                	mov    (%eax),%edx
+  8005bf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005c2:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005c8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005cd:	e9 8b 00 00 00       	jmp    80065d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d5:	8b 10                	mov    (%eax),%edx
+  8005d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005e2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005e7:	eb 74                	jmp    80065d <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005e9:	83 f9 01             	cmp    $0x1,%ecx
+  8005ec:	7f 1b                	jg     800609 <vprintfmt+0x368>
+	else if (lflag)
+  8005ee:	85 c9                	test   %ecx,%ecx
+  8005f0:	74 2c                	je     80061e <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f5:	8b 10                	mov    (%eax),%edx
+  8005f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800602:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800607:	eb 54                	jmp    80065d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800609:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060c:	8b 10                	mov    (%eax),%edx
+  80060e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800611:	8d 40 08             	lea    0x8(%eax),%eax
+  800614:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800617:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80061c:	eb 3f                	jmp    80065d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80061e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800621:	8b 10                	mov    (%eax),%edx
+  800623:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800628:	8d 40 04             	lea    0x4(%eax),%eax
+  80062b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80062e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800633:	eb 28                	jmp    80065d <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800635:	83 ec 08             	sub    $0x8,%esp
+  800638:	53                   	push   %ebx
+  800639:	6a 30                	push   $0x30
+  80063b:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80063d:	83 c4 08             	add    $0x8,%esp
+  800640:	53                   	push   %ebx
+  800641:	6a 78                	push   $0x78
+  800643:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800645:	8b 45 14             	mov    0x14(%ebp),%eax
+  800648:	8b 10                	mov    (%eax),%edx
+  80064a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80064f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800652:	8d 40 04             	lea    0x4(%eax),%eax
+  800655:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800658:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80065d:	83 ec 0c             	sub    $0xc,%esp
+  800660:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800664:	50                   	push   %eax
+  800665:	ff 75 e0             	push   -0x20(%ebp)
+  800668:	57                   	push   %edi
+  800669:	51                   	push   %ecx
+  80066a:	52                   	push   %edx
+  80066b:	89 da                	mov    %ebx,%edx
+  80066d:	89 f0                	mov    %esi,%eax
+  80066f:	e8 4a fb ff ff       	call   8001be <printnum>
+			break;
+  800674:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800677:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80067a:	e9 40 fc ff ff       	jmp    8002bf <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80067f:	83 f9 01             	cmp    $0x1,%ecx
+  800682:	7f 1b                	jg     80069f <vprintfmt+0x3fe>
+	else if (lflag)
+  800684:	85 c9                	test   %ecx,%ecx
+  800686:	74 2c                	je     8006b4 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8b 10                	mov    (%eax),%edx
+  80068d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800692:	8d 40 04             	lea    0x4(%eax),%eax
+  800695:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800698:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80069d:	eb be                	jmp    80065d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80069f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a2:	8b 10                	mov    (%eax),%edx
+  8006a4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ad:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006b2:	eb a9                	jmp    80065d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b7:	8b 10                	mov    (%eax),%edx
+  8006b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006be:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006c9:	eb 92                	jmp    80065d <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006cb:	83 ec 08             	sub    $0x8,%esp
+  8006ce:	53                   	push   %ebx
+  8006cf:	6a 25                	push   $0x25
+  8006d1:	ff d6                	call   *%esi
+			break;
+  8006d3:	83 c4 10             	add    $0x10,%esp
+  8006d6:	eb 9f                	jmp    800677 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006d8:	83 ec 08             	sub    $0x8,%esp
+  8006db:	53                   	push   %ebx
+  8006dc:	6a 25                	push   $0x25
+  8006de:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006e0:	83 c4 10             	add    $0x10,%esp
+  8006e3:	89 f8                	mov    %edi,%eax
+  8006e5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006e9:	74 05                	je     8006f0 <vprintfmt+0x44f>
+  8006eb:	83 e8 01             	sub    $0x1,%eax
+  8006ee:	eb f5                	jmp    8006e5 <vprintfmt+0x444>
+  8006f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006f3:	eb 82                	jmp    800677 <vprintfmt+0x3d6>
+
+008006f5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006f5:	55                   	push   %ebp
+  8006f6:	89 e5                	mov    %esp,%ebp
+  8006f8:	83 ec 18             	sub    $0x18,%esp
+  8006fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800701:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800704:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800708:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80070b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800712:	85 c0                	test   %eax,%eax
+  800714:	74 26                	je     80073c <vsnprintf+0x47>
+  800716:	85 d2                	test   %edx,%edx
+  800718:	7e 22                	jle    80073c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80071a:	ff 75 14             	push   0x14(%ebp)
+  80071d:	ff 75 10             	push   0x10(%ebp)
+  800720:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800723:	50                   	push   %eax
+  800724:	68 67 02 80 00       	push   $0x800267
+  800729:	e8 73 fb ff ff       	call   8002a1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80072e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800731:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800734:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800737:	83 c4 10             	add    $0x10,%esp
+}
+  80073a:	c9                   	leave
+  80073b:	c3                   	ret
+		return -E_INVAL;
+  80073c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800741:	eb f7                	jmp    80073a <vsnprintf+0x45>
+
+00800743 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800743:	55                   	push   %ebp
+  800744:	89 e5                	mov    %esp,%ebp
+  800746:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800749:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80074c:	50                   	push   %eax
+  80074d:	ff 75 10             	push   0x10(%ebp)
+  800750:	ff 75 0c             	push   0xc(%ebp)
+  800753:	ff 75 08             	push   0x8(%ebp)
+  800756:	e8 9a ff ff ff       	call   8006f5 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80075b:	c9                   	leave
+  80075c:	c3                   	ret
+
+0080075d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80075d:	55                   	push   %ebp
+  80075e:	89 e5                	mov    %esp,%ebp
+  800760:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800763:	b8 00 00 00 00       	mov    $0x0,%eax
+  800768:	eb 03                	jmp    80076d <strlen+0x10>
+		n++;
+  80076a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80076d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800771:	75 f7                	jne    80076a <strlen+0xd>
+	return n;
+}
+  800773:	5d                   	pop    %ebp
+  800774:	c3                   	ret
+
+00800775 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800775:	55                   	push   %ebp
+  800776:	89 e5                	mov    %esp,%ebp
+  800778:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80077b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80077e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800783:	eb 03                	jmp    800788 <strnlen+0x13>
+		n++;
+  800785:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800788:	39 d0                	cmp    %edx,%eax
+  80078a:	74 08                	je     800794 <strnlen+0x1f>
+  80078c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800790:	75 f3                	jne    800785 <strnlen+0x10>
+  800792:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800794:	89 d0                	mov    %edx,%eax
+  800796:	5d                   	pop    %ebp
+  800797:	c3                   	ret
+
+00800798 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800798:	55                   	push   %ebp
+  800799:	89 e5                	mov    %esp,%ebp
+  80079b:	53                   	push   %ebx
+  80079c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80079f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007ab:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007ae:	83 c0 01             	add    $0x1,%eax
+  8007b1:	84 d2                	test   %dl,%dl
+  8007b3:	75 f2                	jne    8007a7 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007b5:	89 c8                	mov    %ecx,%eax
+  8007b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ba:	c9                   	leave
+  8007bb:	c3                   	ret
+
+008007bc <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007bc:	55                   	push   %ebp
+  8007bd:	89 e5                	mov    %esp,%ebp
+  8007bf:	53                   	push   %ebx
+  8007c0:	83 ec 10             	sub    $0x10,%esp
+  8007c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007c6:	53                   	push   %ebx
+  8007c7:	e8 91 ff ff ff       	call   80075d <strlen>
+  8007cc:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007cf:	ff 75 0c             	push   0xc(%ebp)
+  8007d2:	01 d8                	add    %ebx,%eax
+  8007d4:	50                   	push   %eax
+  8007d5:	e8 be ff ff ff       	call   800798 <strcpy>
+	return dst;
+}
+  8007da:	89 d8                	mov    %ebx,%eax
+  8007dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007df:	c9                   	leave
+  8007e0:	c3                   	ret
+
+008007e1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007e1:	55                   	push   %ebp
+  8007e2:	89 e5                	mov    %esp,%ebp
+  8007e4:	56                   	push   %esi
+  8007e5:	53                   	push   %ebx
+  8007e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007ec:	89 f3                	mov    %esi,%ebx
+  8007ee:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007f1:	89 f0                	mov    %esi,%eax
+  8007f3:	eb 0f                	jmp    800804 <strncpy+0x23>
+		*dst++ = *src;
+  8007f5:	83 c0 01             	add    $0x1,%eax
+  8007f8:	0f b6 0a             	movzbl (%edx),%ecx
+  8007fb:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007fe:	80 f9 01             	cmp    $0x1,%cl
+  800801:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800804:	39 d8                	cmp    %ebx,%eax
+  800806:	75 ed                	jne    8007f5 <strncpy+0x14>
+	}
+	return ret;
+}
+  800808:	89 f0                	mov    %esi,%eax
+  80080a:	5b                   	pop    %ebx
+  80080b:	5e                   	pop    %esi
+  80080c:	5d                   	pop    %ebp
+  80080d:	c3                   	ret
+
+0080080e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80080e:	55                   	push   %ebp
+  80080f:	89 e5                	mov    %esp,%ebp
+  800811:	56                   	push   %esi
+  800812:	53                   	push   %ebx
+  800813:	8b 75 08             	mov    0x8(%ebp),%esi
+  800816:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800819:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80081c:	89 f0                	mov    %esi,%eax
+  80081e:	85 d2                	test   %edx,%edx
+  800820:	74 21                	je     800843 <strlcpy+0x35>
+  800822:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800826:	89 f2                	mov    %esi,%edx
+  800828:	eb 09                	jmp    800833 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80082a:	83 c1 01             	add    $0x1,%ecx
+  80082d:	83 c2 01             	add    $0x1,%edx
+  800830:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800833:	39 c2                	cmp    %eax,%edx
+  800835:	74 09                	je     800840 <strlcpy+0x32>
+  800837:	0f b6 19             	movzbl (%ecx),%ebx
+  80083a:	84 db                	test   %bl,%bl
+  80083c:	75 ec                	jne    80082a <strlcpy+0x1c>
+  80083e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800840:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800843:	29 f0                	sub    %esi,%eax
+}
+  800845:	5b                   	pop    %ebx
+  800846:	5e                   	pop    %esi
+  800847:	5d                   	pop    %ebp
+  800848:	c3                   	ret
+
+00800849 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800849:	55                   	push   %ebp
+  80084a:	89 e5                	mov    %esp,%ebp
+  80084c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80084f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800852:	eb 06                	jmp    80085a <strcmp+0x11>
+		p++, q++;
+  800854:	83 c1 01             	add    $0x1,%ecx
+  800857:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80085a:	0f b6 01             	movzbl (%ecx),%eax
+  80085d:	84 c0                	test   %al,%al
+  80085f:	74 04                	je     800865 <strcmp+0x1c>
+  800861:	3a 02                	cmp    (%edx),%al
+  800863:	74 ef                	je     800854 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800865:	0f b6 c0             	movzbl %al,%eax
+  800868:	0f b6 12             	movzbl (%edx),%edx
+  80086b:	29 d0                	sub    %edx,%eax
+}
+  80086d:	5d                   	pop    %ebp
+  80086e:	c3                   	ret
+
+0080086f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80086f:	55                   	push   %ebp
+  800870:	89 e5                	mov    %esp,%ebp
+  800872:	53                   	push   %ebx
+  800873:	8b 45 08             	mov    0x8(%ebp),%eax
+  800876:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800879:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80087c:	eb 09                	jmp    800887 <strncmp+0x18>
+		n--, p++, q++;
+  80087e:	83 ea 01             	sub    $0x1,%edx
+  800881:	83 c0 01             	add    $0x1,%eax
+  800884:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800887:	85 d2                	test   %edx,%edx
+  800889:	74 18                	je     8008a3 <strncmp+0x34>
+  80088b:	0f b6 18             	movzbl (%eax),%ebx
+  80088e:	84 db                	test   %bl,%bl
+  800890:	74 04                	je     800896 <strncmp+0x27>
+  800892:	3a 19                	cmp    (%ecx),%bl
+  800894:	74 e8                	je     80087e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800896:	0f b6 00             	movzbl (%eax),%eax
+  800899:	0f b6 11             	movzbl (%ecx),%edx
+  80089c:	29 d0                	sub    %edx,%eax
+}
+  80089e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a1:	c9                   	leave
+  8008a2:	c3                   	ret
+		return 0;
+  8008a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a8:	eb f4                	jmp    80089e <strncmp+0x2f>
+
+008008aa <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008aa:	55                   	push   %ebp
+  8008ab:	89 e5                	mov    %esp,%ebp
+  8008ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008b4:	eb 03                	jmp    8008b9 <strchr+0xf>
+  8008b6:	83 c0 01             	add    $0x1,%eax
+  8008b9:	0f b6 10             	movzbl (%eax),%edx
+  8008bc:	84 d2                	test   %dl,%dl
+  8008be:	74 06                	je     8008c6 <strchr+0x1c>
+		if (*s == c)
+  8008c0:	38 ca                	cmp    %cl,%dl
+  8008c2:	75 f2                	jne    8008b6 <strchr+0xc>
+  8008c4:	eb 05                	jmp    8008cb <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008cb:	5d                   	pop    %ebp
+  8008cc:	c3                   	ret
+
+008008cd <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008cd:	55                   	push   %ebp
+  8008ce:	89 e5                	mov    %esp,%ebp
+  8008d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008d7:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008da:	38 ca                	cmp    %cl,%dl
+  8008dc:	74 09                	je     8008e7 <strfind+0x1a>
+  8008de:	84 d2                	test   %dl,%dl
+  8008e0:	74 05                	je     8008e7 <strfind+0x1a>
+	for (; *s; s++)
+  8008e2:	83 c0 01             	add    $0x1,%eax
+  8008e5:	eb f0                	jmp    8008d7 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008e7:	5d                   	pop    %ebp
+  8008e8:	c3                   	ret
+
+008008e9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008e9:	55                   	push   %ebp
+  8008ea:	89 e5                	mov    %esp,%ebp
+  8008ec:	57                   	push   %edi
+  8008ed:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008f0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008f3:	85 c9                	test   %ecx,%ecx
+  8008f5:	74 20                	je     800917 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008f7:	89 f8                	mov    %edi,%eax
+  8008f9:	09 c8                	or     %ecx,%eax
+  8008fb:	a8 03                	test   $0x3,%al
+  8008fd:	75 12                	jne    800911 <memset+0x28>
+		c &= 0xFF;
+  8008ff:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800903:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800909:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80090c:	fc                   	cld
+  80090d:	f3 ab                	rep stos %eax,%es:(%edi)
+  80090f:	eb 06                	jmp    800917 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800911:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800914:	fc                   	cld
+  800915:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800917:	89 f8                	mov    %edi,%eax
+  800919:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80091c:	c9                   	leave
+  80091d:	c3                   	ret
+
+0080091e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80091e:	55                   	push   %ebp
+  80091f:	89 e5                	mov    %esp,%ebp
+  800921:	57                   	push   %edi
+  800922:	56                   	push   %esi
+  800923:	8b 45 08             	mov    0x8(%ebp),%eax
+  800926:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800929:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80092c:	39 c6                	cmp    %eax,%esi
+  80092e:	73 32                	jae    800962 <memmove+0x44>
+  800930:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800933:	39 d0                	cmp    %edx,%eax
+  800935:	73 2b                	jae    800962 <memmove+0x44>
+		s += n;
+		d += n;
+  800937:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80093a:	89 d6                	mov    %edx,%esi
+  80093c:	09 fe                	or     %edi,%esi
+  80093e:	09 ce                	or     %ecx,%esi
+  800940:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800946:	75 0e                	jne    800956 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800948:	83 ef 04             	sub    $0x4,%edi
+  80094b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80094e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800951:	fd                   	std
+  800952:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800954:	eb 09                	jmp    80095f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800956:	83 ef 01             	sub    $0x1,%edi
+  800959:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80095c:	fd                   	std
+  80095d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80095f:	fc                   	cld
+  800960:	eb 1a                	jmp    80097c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800962:	89 f2                	mov    %esi,%edx
+  800964:	09 c2                	or     %eax,%edx
+  800966:	09 ca                	or     %ecx,%edx
+  800968:	f6 c2 03             	test   $0x3,%dl
+  80096b:	75 0a                	jne    800977 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80096d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800970:	89 c7                	mov    %eax,%edi
+  800972:	fc                   	cld
+  800973:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800975:	eb 05                	jmp    80097c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800977:	89 c7                	mov    %eax,%edi
+  800979:	fc                   	cld
+  80097a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80097c:	5e                   	pop    %esi
+  80097d:	5f                   	pop    %edi
+  80097e:	5d                   	pop    %ebp
+  80097f:	c3                   	ret
+
+00800980 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800986:	ff 75 10             	push   0x10(%ebp)
+  800989:	ff 75 0c             	push   0xc(%ebp)
+  80098c:	ff 75 08             	push   0x8(%ebp)
+  80098f:	e8 8a ff ff ff       	call   80091e <memmove>
+}
+  800994:	c9                   	leave
+  800995:	c3                   	ret
+
+00800996 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800996:	55                   	push   %ebp
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	56                   	push   %esi
+  80099a:	53                   	push   %ebx
+  80099b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009a1:	89 c6                	mov    %eax,%esi
+  8009a3:	03 75 10             	add    0x10(%ebp),%esi
+  8009a6:	eb 06                	jmp    8009ae <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009a8:	83 c0 01             	add    $0x1,%eax
+  8009ab:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009ae:	39 f0                	cmp    %esi,%eax
+  8009b0:	74 14                	je     8009c6 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009b2:	0f b6 08             	movzbl (%eax),%ecx
+  8009b5:	0f b6 1a             	movzbl (%edx),%ebx
+  8009b8:	38 d9                	cmp    %bl,%cl
+  8009ba:	74 ec                	je     8009a8 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009bc:	0f b6 c1             	movzbl %cl,%eax
+  8009bf:	0f b6 db             	movzbl %bl,%ebx
+  8009c2:	29 d8                	sub    %ebx,%eax
+  8009c4:	eb 05                	jmp    8009cb <memcmp+0x35>
+	}
+
+	return 0;
+  8009c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009cb:	5b                   	pop    %ebx
+  8009cc:	5e                   	pop    %esi
+  8009cd:	5d                   	pop    %ebp
+  8009ce:	c3                   	ret
+
+008009cf <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009cf:	55                   	push   %ebp
+  8009d0:	89 e5                	mov    %esp,%ebp
+  8009d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009d8:	89 c2                	mov    %eax,%edx
+  8009da:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009dd:	eb 03                	jmp    8009e2 <memfind+0x13>
+  8009df:	83 c0 01             	add    $0x1,%eax
+  8009e2:	39 d0                	cmp    %edx,%eax
+  8009e4:	73 04                	jae    8009ea <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009e6:	38 08                	cmp    %cl,(%eax)
+  8009e8:	75 f5                	jne    8009df <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009ea:	5d                   	pop    %ebp
+  8009eb:	c3                   	ret
+
+008009ec <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009ec:	55                   	push   %ebp
+  8009ed:	89 e5                	mov    %esp,%ebp
+  8009ef:	57                   	push   %edi
+  8009f0:	56                   	push   %esi
+  8009f1:	53                   	push   %ebx
+  8009f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009f8:	eb 03                	jmp    8009fd <strtol+0x11>
+		s++;
+  8009fa:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009fd:	0f b6 02             	movzbl (%edx),%eax
+  800a00:	3c 20                	cmp    $0x20,%al
+  800a02:	74 f6                	je     8009fa <strtol+0xe>
+  800a04:	3c 09                	cmp    $0x9,%al
+  800a06:	74 f2                	je     8009fa <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a08:	3c 2b                	cmp    $0x2b,%al
+  800a0a:	74 2a                	je     800a36 <strtol+0x4a>
+	int neg = 0;
+  800a0c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a11:	3c 2d                	cmp    $0x2d,%al
+  800a13:	74 2b                	je     800a40 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a15:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a1b:	75 0f                	jne    800a2c <strtol+0x40>
+  800a1d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a20:	74 28                	je     800a4a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a22:	85 db                	test   %ebx,%ebx
+  800a24:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a29:	0f 44 d8             	cmove  %eax,%ebx
+  800a2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a31:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a34:	eb 46                	jmp    800a7c <strtol+0x90>
+		s++;
+  800a36:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a39:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a3e:	eb d5                	jmp    800a15 <strtol+0x29>
+		s++, neg = 1;
+  800a40:	83 c2 01             	add    $0x1,%edx
+  800a43:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a48:	eb cb                	jmp    800a15 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a4a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a4e:	74 0e                	je     800a5e <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a50:	85 db                	test   %ebx,%ebx
+  800a52:	75 d8                	jne    800a2c <strtol+0x40>
+		s++, base = 8;
+  800a54:	83 c2 01             	add    $0x1,%edx
+  800a57:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a5c:	eb ce                	jmp    800a2c <strtol+0x40>
+		s += 2, base = 16;
+  800a5e:	83 c2 02             	add    $0x2,%edx
+  800a61:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a66:	eb c4                	jmp    800a2c <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a68:	0f be c0             	movsbl %al,%eax
+  800a6b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a6e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a71:	7d 3a                	jge    800aad <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a73:	83 c2 01             	add    $0x1,%edx
+  800a76:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a7a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a7c:	0f b6 02             	movzbl (%edx),%eax
+  800a7f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a82:	89 f3                	mov    %esi,%ebx
+  800a84:	80 fb 09             	cmp    $0x9,%bl
+  800a87:	76 df                	jbe    800a68 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a89:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a8c:	89 f3                	mov    %esi,%ebx
+  800a8e:	80 fb 19             	cmp    $0x19,%bl
+  800a91:	77 08                	ja     800a9b <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a93:	0f be c0             	movsbl %al,%eax
+  800a96:	83 e8 57             	sub    $0x57,%eax
+  800a99:	eb d3                	jmp    800a6e <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a9b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a9e:	89 f3                	mov    %esi,%ebx
+  800aa0:	80 fb 19             	cmp    $0x19,%bl
+  800aa3:	77 08                	ja     800aad <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aa5:	0f be c0             	movsbl %al,%eax
+  800aa8:	83 e8 37             	sub    $0x37,%eax
+  800aab:	eb c1                	jmp    800a6e <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800aad:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ab1:	74 05                	je     800ab8 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ab3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ab6:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ab8:	89 c8                	mov    %ecx,%eax
+  800aba:	f7 d8                	neg    %eax
+  800abc:	85 ff                	test   %edi,%edi
+  800abe:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ac1:	89 c8                	mov    %ecx,%eax
+  800ac3:	5b                   	pop    %ebx
+  800ac4:	5e                   	pop    %esi
+  800ac5:	5f                   	pop    %edi
+  800ac6:	5d                   	pop    %ebp
+  800ac7:	c3                   	ret
+
+00800ac8 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ac8:	55                   	push   %ebp
+  800ac9:	89 e5                	mov    %esp,%ebp
+  800acb:	57                   	push   %edi
+  800acc:	56                   	push   %esi
+  800acd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ace:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ad6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ad9:	89 c3                	mov    %eax,%ebx
+  800adb:	89 c7                	mov    %eax,%edi
+  800add:	89 c6                	mov    %eax,%esi
+  800adf:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ae1:	5b                   	pop    %ebx
+  800ae2:	5e                   	pop    %esi
+  800ae3:	5f                   	pop    %edi
+  800ae4:	5d                   	pop    %ebp
+  800ae5:	c3                   	ret
+
+00800ae6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ae6:	55                   	push   %ebp
+  800ae7:	89 e5                	mov    %esp,%ebp
+  800ae9:	57                   	push   %edi
+  800aea:	56                   	push   %esi
+  800aeb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800aec:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800af6:	89 d1                	mov    %edx,%ecx
+  800af8:	89 d3                	mov    %edx,%ebx
+  800afa:	89 d7                	mov    %edx,%edi
+  800afc:	89 d6                	mov    %edx,%esi
+  800afe:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b00:	5b                   	pop    %ebx
+  800b01:	5e                   	pop    %esi
+  800b02:	5f                   	pop    %edi
+  800b03:	5d                   	pop    %ebp
+  800b04:	c3                   	ret
+
+00800b05 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	57                   	push   %edi
+  800b09:	56                   	push   %esi
+  800b0a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b13:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b18:	89 cb                	mov    %ecx,%ebx
+  800b1a:	89 cf                	mov    %ecx,%edi
+  800b1c:	89 ce                	mov    %ecx,%esi
+  800b1e:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b20:	5b                   	pop    %ebx
+  800b21:	5e                   	pop    %esi
+  800b22:	5f                   	pop    %edi
+  800b23:	5d                   	pop    %ebp
+  800b24:	c3                   	ret
+
+00800b25 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b25:	55                   	push   %ebp
+  800b26:	89 e5                	mov    %esp,%ebp
+  800b28:	57                   	push   %edi
+  800b29:	56                   	push   %esi
+  800b2a:	53                   	push   %ebx
+  800b2b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b36:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b3b:	89 cb                	mov    %ecx,%ebx
+  800b3d:	89 cf                	mov    %ecx,%edi
+  800b3f:	89 ce                	mov    %ecx,%esi
+  800b41:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b43:	85 c0                	test   %eax,%eax
+  800b45:	7f 08                	jg     800b4f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b4a:	5b                   	pop    %ebx
+  800b4b:	5e                   	pop    %esi
+  800b4c:	5f                   	pop    %edi
+  800b4d:	5d                   	pop    %ebp
+  800b4e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b4f:	83 ec 0c             	sub    $0xc,%esp
+  800b52:	50                   	push   %eax
+  800b53:	6a 03                	push   $0x3
+  800b55:	68 7f 2e 80 00       	push   $0x802e7f
+  800b5a:	6a 23                	push   $0x23
+  800b5c:	68 9c 2e 80 00       	push   $0x802e9c
+  800b61:	e8 37 19 00 00       	call   80249d <_panic>
+
+00800b66 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b66:	55                   	push   %ebp
+  800b67:	89 e5                	mov    %esp,%ebp
+  800b69:	57                   	push   %edi
+  800b6a:	56                   	push   %esi
+  800b6b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b71:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b76:	89 d1                	mov    %edx,%ecx
+  800b78:	89 d3                	mov    %edx,%ebx
+  800b7a:	89 d7                	mov    %edx,%edi
+  800b7c:	89 d6                	mov    %edx,%esi
+  800b7e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b80:	5b                   	pop    %ebx
+  800b81:	5e                   	pop    %esi
+  800b82:	5f                   	pop    %edi
+  800b83:	5d                   	pop    %ebp
+  800b84:	c3                   	ret
+
+00800b85 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b85:	55                   	push   %ebp
+  800b86:	89 e5                	mov    %esp,%ebp
+  800b88:	57                   	push   %edi
+  800b89:	56                   	push   %esi
+  800b8a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b90:	b8 16 00 00 00       	mov    $0x16,%eax
+  800b95:	89 d1                	mov    %edx,%ecx
+  800b97:	89 d3                	mov    %edx,%ebx
+  800b99:	89 d7                	mov    %edx,%edi
+  800b9b:	89 d6                	mov    %edx,%esi
+  800b9d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b9f:	5b                   	pop    %ebx
+  800ba0:	5e                   	pop    %esi
+  800ba1:	5f                   	pop    %edi
+  800ba2:	5d                   	pop    %ebp
+  800ba3:	c3                   	ret
+
+00800ba4 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	57                   	push   %edi
+  800ba8:	56                   	push   %esi
+  800ba9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800baa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800baf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800bb4:	89 d1                	mov    %edx,%ecx
+  800bb6:	89 d3                	mov    %edx,%ebx
+  800bb8:	89 d7                	mov    %edx,%edi
+  800bba:	89 d6                	mov    %edx,%esi
+  800bbc:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800bbe:	5b                   	pop    %ebx
+  800bbf:	5e                   	pop    %esi
+  800bc0:	5f                   	pop    %edi
+  800bc1:	5d                   	pop    %ebp
+  800bc2:	c3                   	ret
+
+00800bc3 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800bc3:	55                   	push   %ebp
+  800bc4:	89 e5                	mov    %esp,%ebp
+  800bc6:	57                   	push   %edi
+  800bc7:	56                   	push   %esi
+  800bc8:	53                   	push   %ebx
+  800bc9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd7:	b8 15 00 00 00       	mov    $0x15,%eax
+  800bdc:	89 df                	mov    %ebx,%edi
+  800bde:	89 de                	mov    %ebx,%esi
+  800be0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800be2:	85 c0                	test   %eax,%eax
+  800be4:	7f 08                	jg     800bee <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800be6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be9:	5b                   	pop    %ebx
+  800bea:	5e                   	pop    %esi
+  800beb:	5f                   	pop    %edi
+  800bec:	5d                   	pop    %ebp
+  800bed:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bee:	83 ec 0c             	sub    $0xc,%esp
+  800bf1:	50                   	push   %eax
+  800bf2:	6a 15                	push   $0x15
+  800bf4:	68 7f 2e 80 00       	push   $0x802e7f
+  800bf9:	6a 23                	push   $0x23
+  800bfb:	68 9c 2e 80 00       	push   $0x802e9c
+  800c00:	e8 98 18 00 00       	call   80249d <_panic>
+
+00800c05 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c05:	55                   	push   %ebp
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	57                   	push   %edi
+  800c09:	56                   	push   %esi
+  800c0a:	53                   	push   %ebx
+  800c0b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c0e:	be 00 00 00 00       	mov    $0x0,%esi
+  800c13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c19:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c21:	89 f7                	mov    %esi,%edi
+  800c23:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c25:	85 c0                	test   %eax,%eax
+  800c27:	7f 08                	jg     800c31 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2c:	5b                   	pop    %ebx
+  800c2d:	5e                   	pop    %esi
+  800c2e:	5f                   	pop    %edi
+  800c2f:	5d                   	pop    %ebp
+  800c30:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c31:	83 ec 0c             	sub    $0xc,%esp
+  800c34:	50                   	push   %eax
+  800c35:	6a 05                	push   $0x5
+  800c37:	68 7f 2e 80 00       	push   $0x802e7f
+  800c3c:	6a 23                	push   $0x23
+  800c3e:	68 9c 2e 80 00       	push   $0x802e9c
+  800c43:	e8 55 18 00 00       	call   80249d <_panic>
+
+00800c48 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800c48:	55                   	push   %ebp
+  800c49:	89 e5                	mov    %esp,%ebp
+  800c4b:	57                   	push   %edi
+  800c4c:	56                   	push   %esi
+  800c4d:	53                   	push   %ebx
+  800c4e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c51:	be 00 00 00 00       	mov    $0x0,%esi
+  800c56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c64:	89 f7                	mov    %esi,%edi
+  800c66:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c68:	85 c0                	test   %eax,%eax
+  800c6a:	7f 08                	jg     800c74 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6f:	5b                   	pop    %ebx
+  800c70:	5e                   	pop    %esi
+  800c71:	5f                   	pop    %edi
+  800c72:	5d                   	pop    %ebp
+  800c73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c74:	83 ec 0c             	sub    $0xc,%esp
+  800c77:	50                   	push   %eax
+  800c78:	6a 06                	push   $0x6
+  800c7a:	68 7f 2e 80 00       	push   $0x802e7f
+  800c7f:	6a 23                	push   $0x23
+  800c81:	68 9c 2e 80 00       	push   $0x802e9c
+  800c86:	e8 12 18 00 00       	call   80249d <_panic>
+
+00800c8b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c8b:	55                   	push   %ebp
+  800c8c:	89 e5                	mov    %esp,%ebp
+  800c8e:	57                   	push   %edi
+  800c8f:	56                   	push   %esi
+  800c90:	53                   	push   %ebx
+  800c91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9a:	b8 07 00 00 00       	mov    $0x7,%eax
+  800c9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ca2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ca5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ca8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800caa:	85 c0                	test   %eax,%eax
+  800cac:	7f 08                	jg     800cb6 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb1:	5b                   	pop    %ebx
+  800cb2:	5e                   	pop    %esi
+  800cb3:	5f                   	pop    %edi
+  800cb4:	5d                   	pop    %ebp
+  800cb5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb6:	83 ec 0c             	sub    $0xc,%esp
+  800cb9:	50                   	push   %eax
+  800cba:	6a 07                	push   $0x7
+  800cbc:	68 7f 2e 80 00       	push   $0x802e7f
+  800cc1:	6a 23                	push   $0x23
+  800cc3:	68 9c 2e 80 00       	push   $0x802e9c
+  800cc8:	e8 d0 17 00 00       	call   80249d <_panic>
+
+00800ccd <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	56                   	push   %esi
+  800cd2:	53                   	push   %ebx
+  800cd3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce1:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ce6:	89 df                	mov    %ebx,%edi
+  800ce8:	89 de                	mov    %ebx,%esi
+  800cea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cec:	85 c0                	test   %eax,%eax
+  800cee:	7f 08                	jg     800cf8 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf3:	5b                   	pop    %ebx
+  800cf4:	5e                   	pop    %esi
+  800cf5:	5f                   	pop    %edi
+  800cf6:	5d                   	pop    %ebp
+  800cf7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf8:	83 ec 0c             	sub    $0xc,%esp
+  800cfb:	50                   	push   %eax
+  800cfc:	6a 08                	push   $0x8
+  800cfe:	68 7f 2e 80 00       	push   $0x802e7f
+  800d03:	6a 23                	push   $0x23
+  800d05:	68 9c 2e 80 00       	push   $0x802e9c
+  800d0a:	e8 8e 17 00 00       	call   80249d <_panic>
+
+00800d0f <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d0f:	55                   	push   %ebp
+  800d10:	89 e5                	mov    %esp,%ebp
+  800d12:	57                   	push   %edi
+  800d13:	56                   	push   %esi
+  800d14:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d20:	be 00 00 00 00       	mov    $0x0,%esi
+  800d25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d28:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d2b:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d2d:	5b                   	pop    %ebx
+  800d2e:	5e                   	pop    %esi
+  800d2f:	5f                   	pop    %edi
+  800d30:	5d                   	pop    %ebp
+  800d31:	c3                   	ret
+
+00800d32 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d32:	55                   	push   %ebp
+  800d33:	89 e5                	mov    %esp,%ebp
+  800d35:	57                   	push   %edi
+  800d36:	56                   	push   %esi
+  800d37:	53                   	push   %ebx
+  800d38:	8b 45 18             	mov    0x18(%ebp),%eax
+  800d3b:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800d3e:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800d43:	77 27                	ja     800d6c <sys_page_map_range+0x3a>
+  800d45:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800d4b:	77 1f                	ja     800d6c <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800d4d:	c1 e0 0c             	shl    $0xc,%eax
+  800d50:	89 c6                	mov    %eax,%esi
+  800d52:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800d54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d62:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d65:	cd 30                	int    $0x30
+}
+  800d67:	5b                   	pop    %ebx
+  800d68:	5e                   	pop    %esi
+  800d69:	5f                   	pop    %edi
+  800d6a:	5d                   	pop    %ebp
+  800d6b:	c3                   	ret
+		return -E_INVAL;
+  800d6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d71:	eb f4                	jmp    800d67 <sys_page_map_range+0x35>
+
+00800d73 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800d73:	55                   	push   %ebp
+  800d74:	89 e5                	mov    %esp,%ebp
+  800d76:	57                   	push   %edi
+  800d77:	56                   	push   %esi
+  800d78:	53                   	push   %ebx
+  800d79:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d82:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d87:	be 00 00 00 00       	mov    $0x0,%esi
+  800d8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d92:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d94:	85 c0                	test   %eax,%eax
+  800d96:	7f 08                	jg     800da0 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800d98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9b:	5b                   	pop    %ebx
+  800d9c:	5e                   	pop    %esi
+  800d9d:	5f                   	pop    %edi
+  800d9e:	5d                   	pop    %ebp
+  800d9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da0:	83 ec 0c             	sub    $0xc,%esp
+  800da3:	50                   	push   %eax
+  800da4:	6a 0c                	push   $0xc
+  800da6:	68 7f 2e 80 00       	push   $0x802e7f
+  800dab:	6a 23                	push   $0x23
+  800dad:	68 9c 2e 80 00       	push   $0x802e9c
+  800db2:	e8 e6 16 00 00       	call   80249d <_panic>
+
+00800db7 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	57                   	push   %edi
+  800dbb:	56                   	push   %esi
+  800dbc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dbd:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dcd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd0:	89 f7                	mov    %esi,%edi
+  800dd2:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800dd4:	5b                   	pop    %ebx
+  800dd5:	5e                   	pop    %esi
+  800dd6:	5f                   	pop    %edi
+  800dd7:	5d                   	pop    %ebp
+  800dd8:	c3                   	ret
+
+00800dd9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800dd9:	55                   	push   %ebp
+  800dda:	89 e5                	mov    %esp,%ebp
+  800ddc:	57                   	push   %edi
+  800ddd:	56                   	push   %esi
+  800dde:	53                   	push   %ebx
+  800ddf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800de2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ded:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800df2:	89 df                	mov    %ebx,%edi
+  800df4:	89 de                	mov    %ebx,%esi
+  800df6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800df8:	85 c0                	test   %eax,%eax
+  800dfa:	7f 08                	jg     800e04 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800dfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dff:	5b                   	pop    %ebx
+  800e00:	5e                   	pop    %esi
+  800e01:	5f                   	pop    %edi
+  800e02:	5d                   	pop    %ebp
+  800e03:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e04:	83 ec 0c             	sub    $0xc,%esp
+  800e07:	50                   	push   %eax
+  800e08:	6a 0f                	push   $0xf
+  800e0a:	68 7f 2e 80 00       	push   $0x802e7f
+  800e0f:	6a 23                	push   $0x23
+  800e11:	68 9c 2e 80 00       	push   $0x802e9c
+  800e16:	e8 82 16 00 00       	call   80249d <_panic>
+
+00800e1b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e1b:	55                   	push   %ebp
+  800e1c:	89 e5                	mov    %esp,%ebp
+  800e1e:	57                   	push   %edi
+  800e1f:	56                   	push   %esi
+  800e20:	53                   	push   %ebx
+  800e21:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e34:	89 df                	mov    %ebx,%edi
+  800e36:	89 de                	mov    %ebx,%esi
+  800e38:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e3a:	85 c0                	test   %eax,%eax
+  800e3c:	7f 08                	jg     800e46 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800e3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5f                   	pop    %edi
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e46:	83 ec 0c             	sub    $0xc,%esp
+  800e49:	50                   	push   %eax
+  800e4a:	6a 10                	push   $0x10
+  800e4c:	68 7f 2e 80 00       	push   $0x802e7f
+  800e51:	6a 23                	push   $0x23
+  800e53:	68 9c 2e 80 00       	push   $0x802e9c
+  800e58:	e8 40 16 00 00       	call   80249d <_panic>
+
+00800e5d <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800e5d:	55                   	push   %ebp
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	57                   	push   %edi
+  800e61:	56                   	push   %esi
+  800e62:	53                   	push   %ebx
+  800e63:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e71:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e76:	89 df                	mov    %ebx,%edi
+  800e78:	89 de                	mov    %ebx,%esi
+  800e7a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e7c:	85 c0                	test   %eax,%eax
+  800e7e:	7f 08                	jg     800e88 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800e80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e83:	5b                   	pop    %ebx
+  800e84:	5e                   	pop    %esi
+  800e85:	5f                   	pop    %edi
+  800e86:	5d                   	pop    %ebp
+  800e87:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e88:	83 ec 0c             	sub    $0xc,%esp
+  800e8b:	50                   	push   %eax
+  800e8c:	6a 11                	push   $0x11
+  800e8e:	68 7f 2e 80 00       	push   $0x802e7f
+  800e93:	6a 23                	push   $0x23
+  800e95:	68 9c 2e 80 00       	push   $0x802e9c
+  800e9a:	e8 fe 15 00 00       	call   80249d <_panic>
+
+00800e9f <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	57                   	push   %edi
+  800ea3:	56                   	push   %esi
+  800ea4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ea5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eaa:	b8 12 00 00 00       	mov    $0x12,%eax
+  800eaf:	89 d1                	mov    %edx,%ecx
+  800eb1:	89 d3                	mov    %edx,%ebx
+  800eb3:	89 d7                	mov    %edx,%edi
+  800eb5:	89 d6                	mov    %edx,%esi
+  800eb7:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5e                   	pop    %esi
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+
+00800ebe <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ebe:	55                   	push   %ebp
+  800ebf:	89 e5                	mov    %esp,%ebp
+  800ec1:	57                   	push   %edi
+  800ec2:	56                   	push   %esi
+  800ec3:	53                   	push   %ebx
+  800ec4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ec7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed2:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ed7:	89 df                	mov    %ebx,%edi
+  800ed9:	89 de                	mov    %ebx,%esi
+  800edb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800edd:	85 c0                	test   %eax,%eax
+  800edf:	7f 08                	jg     800ee9 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ee1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee4:	5b                   	pop    %ebx
+  800ee5:	5e                   	pop    %esi
+  800ee6:	5f                   	pop    %edi
+  800ee7:	5d                   	pop    %ebp
+  800ee8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee9:	83 ec 0c             	sub    $0xc,%esp
+  800eec:	50                   	push   %eax
+  800eed:	6a 13                	push   $0x13
+  800eef:	68 7f 2e 80 00       	push   $0x802e7f
+  800ef4:	6a 23                	push   $0x23
+  800ef6:	68 9c 2e 80 00       	push   $0x802e9c
+  800efb:	e8 9d 15 00 00       	call   80249d <_panic>
+
+00800f00 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f00:	55                   	push   %ebp
+  800f01:	89 e5                	mov    %esp,%ebp
+  800f03:	57                   	push   %edi
+  800f04:	56                   	push   %esi
+  800f05:	53                   	push   %ebx
+  800f06:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f14:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f19:	89 df                	mov    %ebx,%edi
+  800f1b:	89 de                	mov    %ebx,%esi
+  800f1d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f1f:	85 c0                	test   %eax,%eax
+  800f21:	7f 08                	jg     800f2b <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2b:	83 ec 0c             	sub    $0xc,%esp
+  800f2e:	50                   	push   %eax
+  800f2f:	6a 14                	push   $0x14
+  800f31:	68 7f 2e 80 00       	push   $0x802e7f
+  800f36:	6a 23                	push   $0x23
+  800f38:	68 9c 2e 80 00       	push   $0x802e9c
+  800f3d:	e8 5b 15 00 00       	call   80249d <_panic>
+
+00800f42 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	57                   	push   %edi
+  800f46:	56                   	push   %esi
+  800f47:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4e:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f53:	be 00 00 00 00       	mov    $0x0,%esi
+  800f58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f5e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f60:	5b                   	pop    %ebx
+  800f61:	5e                   	pop    %esi
+  800f62:	5f                   	pop    %edi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+
+00800f65 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f65:	55                   	push   %ebp
+  800f66:	89 e5                	mov    %esp,%ebp
+  800f68:	57                   	push   %edi
+  800f69:	56                   	push   %esi
+  800f6a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f71:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f76:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f81:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f83:	5b                   	pop    %ebx
+  800f84:	5e                   	pop    %esi
+  800f85:	5f                   	pop    %edi
+  800f86:	5d                   	pop    %ebp
+  800f87:	c3                   	ret
+
+00800f88 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	57                   	push   %edi
+  800f8c:	56                   	push   %esi
+  800f8d:	53                   	push   %ebx
+  800f8e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f9e:	89 cb                	mov    %ecx,%ebx
+  800fa0:	89 cf                	mov    %ecx,%edi
+  800fa2:	89 ce                	mov    %ecx,%esi
+  800fa4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa6:	85 c0                	test   %eax,%eax
+  800fa8:	7f 08                	jg     800fb2 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800faa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fad:	5b                   	pop    %ebx
+  800fae:	5e                   	pop    %esi
+  800faf:	5f                   	pop    %edi
+  800fb0:	5d                   	pop    %ebp
+  800fb1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb2:	83 ec 0c             	sub    $0xc,%esp
+  800fb5:	50                   	push   %eax
+  800fb6:	6a 19                	push   $0x19
+  800fb8:	68 7f 2e 80 00       	push   $0x802e7f
+  800fbd:	6a 23                	push   $0x23
+  800fbf:	68 9c 2e 80 00       	push   $0x802e9c
+  800fc4:	e8 d4 14 00 00       	call   80249d <_panic>
+
+00800fc9 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	57                   	push   %edi
+  800fcd:	56                   	push   %esi
+  800fce:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fd9:	89 d1                	mov    %edx,%ecx
+  800fdb:	89 d3                	mov    %edx,%ebx
+  800fdd:	89 d7                	mov    %edx,%edi
+  800fdf:	89 d6                	mov    %edx,%esi
+  800fe1:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fe3:	5b                   	pop    %ebx
+  800fe4:	5e                   	pop    %esi
+  800fe5:	5f                   	pop    %edi
+  800fe6:	5d                   	pop    %ebp
+  800fe7:	c3                   	ret
+
+00800fe8 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  800fe8:	55                   	push   %ebp
+  800fe9:	89 e5                	mov    %esp,%ebp
+  800feb:	57                   	push   %edi
+  800fec:	56                   	push   %esi
+  800fed:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800ffe:	89 df                	mov    %ebx,%edi
+  801000:	89 de                	mov    %ebx,%esi
+  801002:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801004:	5b                   	pop    %ebx
+  801005:	5e                   	pop    %esi
+  801006:	5f                   	pop    %edi
+  801007:	5d                   	pop    %ebp
+  801008:	c3                   	ret
+
+00801009 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801009:	55                   	push   %ebp
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	57                   	push   %edi
+  80100d:	56                   	push   %esi
+  80100e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80100f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801014:	8b 55 08             	mov    0x8(%ebp),%edx
+  801017:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80101f:	89 df                	mov    %ebx,%edi
+  801021:	89 de                	mov    %ebx,%esi
+  801023:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801025:	5b                   	pop    %ebx
+  801026:	5e                   	pop    %esi
+  801027:	5f                   	pop    %edi
+  801028:	5d                   	pop    %ebp
+  801029:	c3                   	ret
+
+0080102a <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80102a:	55                   	push   %ebp
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	53                   	push   %ebx
+  80102e:	83 ec 04             	sub    $0x4,%esp
+  801031:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801034:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  801036:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  801039:	f6 c2 02             	test   $0x2,%dl
+  80103c:	74 7b                	je     8010b9 <pgfault+0x8f>
+  80103e:	89 c1                	mov    %eax,%ecx
+  801040:	c1 e9 0c             	shr    $0xc,%ecx
+  801043:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  80104a:	f6 c5 08             	test   $0x8,%ch
+  80104d:	74 6a                	je     8010b9 <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80104f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801054:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801056:	83 ec 04             	sub    $0x4,%esp
+  801059:	6a 07                	push   $0x7
+  80105b:	68 00 f0 7f 00       	push   $0x7ff000
+  801060:	6a 00                	push   $0x0
+  801062:	e8 9e fb ff ff       	call   800c05 <sys_page_alloc>
+  801067:	83 c4 10             	add    $0x10,%esp
+  80106a:	85 c0                	test   %eax,%eax
+  80106c:	78 61                	js     8010cf <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  80106e:	83 ec 04             	sub    $0x4,%esp
+  801071:	68 00 10 00 00       	push   $0x1000
+  801076:	53                   	push   %ebx
+  801077:	68 00 f0 7f 00       	push   $0x7ff000
+  80107c:	e8 9d f8 ff ff       	call   80091e <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  801081:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801088:	53                   	push   %ebx
+  801089:	6a 00                	push   $0x0
+  80108b:	68 00 f0 7f 00       	push   $0x7ff000
+  801090:	6a 00                	push   $0x0
+  801092:	e8 f4 fb ff ff       	call   800c8b <sys_page_map>
+  801097:	83 c4 20             	add    $0x20,%esp
+  80109a:	85 c0                	test   %eax,%eax
+  80109c:	78 43                	js     8010e1 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  80109e:	83 ec 08             	sub    $0x8,%esp
+  8010a1:	68 00 f0 7f 00       	push   $0x7ff000
+  8010a6:	6a 00                	push   $0x0
+  8010a8:	e8 20 fc ff ff       	call   800ccd <sys_page_unmap>
+  8010ad:	83 c4 10             	add    $0x10,%esp
+  8010b0:	85 c0                	test   %eax,%eax
+  8010b2:	78 3f                	js     8010f3 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  8010b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010b7:	c9                   	leave
+  8010b8:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  8010b9:	83 ec 0c             	sub    $0xc,%esp
+  8010bc:	50                   	push   %eax
+  8010bd:	52                   	push   %edx
+  8010be:	68 aa 2e 80 00       	push   $0x802eaa
+  8010c3:	6a 19                	push   $0x19
+  8010c5:	68 bb 2e 80 00       	push   $0x802ebb
+  8010ca:	e8 ce 13 00 00       	call   80249d <_panic>
+		panic("sys_page_alloc: %e", r);
+  8010cf:	50                   	push   %eax
+  8010d0:	68 c6 2e 80 00       	push   $0x802ec6
+  8010d5:	6a 24                	push   $0x24
+  8010d7:	68 bb 2e 80 00       	push   $0x802ebb
+  8010dc:	e8 bc 13 00 00       	call   80249d <_panic>
+		panic("sys_page_map: %e", r);
+  8010e1:	50                   	push   %eax
+  8010e2:	68 d9 2e 80 00       	push   $0x802ed9
+  8010e7:	6a 29                	push   $0x29
+  8010e9:	68 bb 2e 80 00       	push   $0x802ebb
+  8010ee:	e8 aa 13 00 00       	call   80249d <_panic>
+		panic("sys_page_unmap: %e", r);
+  8010f3:	50                   	push   %eax
+  8010f4:	68 ea 2e 80 00       	push   $0x802eea
+  8010f9:	6a 2c                	push   $0x2c
+  8010fb:	68 bb 2e 80 00       	push   $0x802ebb
+  801100:	e8 98 13 00 00       	call   80249d <_panic>
+
+00801105 <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	57                   	push   %edi
+  801109:	56                   	push   %esi
+  80110a:	53                   	push   %ebx
+  80110b:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80110e:	68 2a 10 80 00       	push   $0x80102a
+  801113:	e8 cb 13 00 00       	call   8024e3 <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  801118:	83 c4 08             	add    $0x8,%esp
+  80111b:	6a 01                	push   $0x1
+  80111d:	6a 00                	push   $0x0
+  80111f:	e8 9f fa ff ff       	call   800bc3 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  801124:	e8 7b fa ff ff       	call   800ba4 <sys_fork_cow>
+  801129:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  80112c:	83 c4 10             	add    $0x10,%esp
+  80112f:	85 c0                	test   %eax,%eax
+  801131:	74 2c                	je     80115f <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  801133:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  801137:	0f 85 8b 01 00 00    	jne    8012c8 <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80113d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801142:	cd 30                	int    $0x30
+  801144:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  801147:	85 c0                	test   %eax,%eax
+  801149:	78 30                	js     80117b <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  80114b:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801150:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  801155:	74 36                	je     80118d <fork+0x88>
+  801157:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80115a:	e9 99 00 00 00       	jmp    8011f8 <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80115f:	e8 02 fa ff ff       	call   800b66 <sys_getenvid>
+  801164:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801169:	c1 e0 09             	shl    $0x9,%eax
+  80116c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801171:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801176:	e9 4d 01 00 00       	jmp    8012c8 <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  80117b:	50                   	push   %eax
+  80117c:	68 fd 2e 80 00       	push   $0x802efd
+  801181:	6a 7d                	push   $0x7d
+  801183:	68 bb 2e 80 00       	push   $0x802ebb
+  801188:	e8 10 13 00 00       	call   80249d <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80118d:	e8 d4 f9 ff ff       	call   800b66 <sys_getenvid>
+  801192:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801197:	c1 e0 09             	shl    $0x9,%eax
+  80119a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80119f:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  8011a4:	e9 1f 01 00 00       	jmp    8012c8 <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  8011a9:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8011b0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8011b3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8011bb:	83 ec 0c             	sub    $0xc,%esp
+  8011be:	50                   	push   %eax
+  8011bf:	56                   	push   %esi
+  8011c0:	ff 75 e4             	push   -0x1c(%ebp)
+  8011c3:	56                   	push   %esi
+  8011c4:	6a 00                	push   $0x0
+  8011c6:	e8 c0 fa ff ff       	call   800c8b <sys_page_map>
+  8011cb:	83 c4 20             	add    $0x20,%esp
+  8011ce:	85 c0                	test   %eax,%eax
+  8011d0:	0f 88 98 00 00 00    	js     80126e <fork+0x169>
+	if (perm & PTE_COW) {
+  8011d6:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  8011dd:	0f 85 61 01 00 00    	jne    801344 <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8011e3:	83 c7 01             	add    $0x1,%edi
+  8011e6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8011ec:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  8011f2:	0f 84 88 00 00 00    	je     801280 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  8011f8:	89 f0                	mov    %esi,%eax
+  8011fa:	c1 e8 16             	shr    $0x16,%eax
+  8011fd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801204:	25 81 00 00 00       	and    $0x81,%eax
+  801209:	83 f8 01             	cmp    $0x1,%eax
+  80120c:	75 d5                	jne    8011e3 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  80120e:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  801215:	a8 01                	test   $0x1,%al
+  801217:	74 ca                	je     8011e3 <fork+0xde>
+  801219:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  80121f:	74 c2                	je     8011e3 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  801221:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  801223:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80122a:	f6 c4 04             	test   $0x4,%ah
+  80122d:	0f 85 76 ff ff ff    	jne    8011a9 <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  801233:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80123a:	a8 02                	test   $0x2,%al
+  80123c:	0f 85 dc 00 00 00    	jne    80131e <fork+0x219>
+  801242:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801249:	f6 c4 08             	test   $0x8,%ah
+  80124c:	0f 85 cc 00 00 00    	jne    80131e <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801252:	83 ec 0c             	sub    $0xc,%esp
+  801255:	6a 05                	push   $0x5
+  801257:	56                   	push   %esi
+  801258:	ff 75 e4             	push   -0x1c(%ebp)
+  80125b:	56                   	push   %esi
+  80125c:	6a 00                	push   $0x0
+  80125e:	e8 28 fa ff ff       	call   800c8b <sys_page_map>
+  801263:	83 c4 20             	add    $0x20,%esp
+  801266:	85 c0                	test   %eax,%eax
+  801268:	0f 89 75 ff ff ff    	jns    8011e3 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  80126e:	50                   	push   %eax
+  80126f:	68 d9 2e 80 00       	push   $0x802ed9
+  801274:	6a 48                	push   $0x48
+  801276:	68 bb 2e 80 00       	push   $0x802ebb
+  80127b:	e8 1d 12 00 00       	call   80249d <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  801280:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  801283:	83 ec 04             	sub    $0x4,%esp
+  801286:	6a 07                	push   $0x7
+  801288:	68 00 f0 bf ee       	push   $0xeebff000
+  80128d:	53                   	push   %ebx
+  80128e:	e8 72 f9 ff ff       	call   800c05 <sys_page_alloc>
+  801293:	83 c4 10             	add    $0x10,%esp
+  801296:	85 c0                	test   %eax,%eax
+  801298:	78 39                	js     8012d3 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  80129a:	a1 08 50 80 00       	mov    0x805008,%eax
+  80129f:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  8012a5:	83 ec 08             	sub    $0x8,%esp
+  8012a8:	50                   	push   %eax
+  8012a9:	53                   	push   %ebx
+  8012aa:	e8 51 fc ff ff       	call   800f00 <sys_env_set_pgfault_upcall>
+  8012af:	83 c4 10             	add    $0x10,%esp
+  8012b2:	85 c0                	test   %eax,%eax
+  8012b4:	78 36                	js     8012ec <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8012b6:	83 ec 08             	sub    $0x8,%esp
+  8012b9:	6a 02                	push   $0x2
+  8012bb:	53                   	push   %ebx
+  8012bc:	e8 18 fb ff ff       	call   800dd9 <sys_env_set_status>
+  8012c1:	83 c4 10             	add    $0x10,%esp
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	78 3d                	js     801305 <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  8012c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ce:	5b                   	pop    %ebx
+  8012cf:	5e                   	pop    %esi
+  8012d0:	5f                   	pop    %edi
+  8012d1:	5d                   	pop    %ebp
+  8012d2:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  8012d3:	83 ec 0c             	sub    $0xc,%esp
+  8012d6:	53                   	push   %ebx
+  8012d7:	50                   	push   %eax
+  8012d8:	68 24 2f 80 00       	push   $0x802f24
+  8012dd:	68 92 00 00 00       	push   $0x92
+  8012e2:	68 bb 2e 80 00       	push   $0x802ebb
+  8012e7:	e8 b1 11 00 00       	call   80249d <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  8012ec:	83 ec 0c             	sub    $0xc,%esp
+  8012ef:	53                   	push   %ebx
+  8012f0:	50                   	push   %eax
+  8012f1:	68 48 2f 80 00       	push   $0x802f48
+  8012f6:	68 95 00 00 00       	push   $0x95
+  8012fb:	68 bb 2e 80 00       	push   $0x802ebb
+  801300:	e8 98 11 00 00       	call   80249d <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  801305:	83 ec 0c             	sub    $0xc,%esp
+  801308:	53                   	push   %ebx
+  801309:	50                   	push   %eax
+  80130a:	68 78 2f 80 00       	push   $0x802f78
+  80130f:	68 98 00 00 00       	push   $0x98
+  801314:	68 bb 2e 80 00       	push   $0x802ebb
+  801319:	e8 7f 11 00 00       	call   80249d <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  80131e:	83 ec 0c             	sub    $0xc,%esp
+  801321:	68 05 08 00 00       	push   $0x805
+  801326:	53                   	push   %ebx
+  801327:	ff 75 e4             	push   -0x1c(%ebp)
+  80132a:	53                   	push   %ebx
+  80132b:	6a 00                	push   $0x0
+  80132d:	e8 59 f9 ff ff       	call   800c8b <sys_page_map>
+  801332:	83 c4 20             	add    $0x20,%esp
+  801335:	85 c0                	test   %eax,%eax
+  801337:	0f 88 31 ff ff ff    	js     80126e <fork+0x169>
+		perm |= PTE_COW;
+  80133d:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  801344:	83 ec 0c             	sub    $0xc,%esp
+  801347:	ff 75 e0             	push   -0x20(%ebp)
+  80134a:	53                   	push   %ebx
+  80134b:	6a 00                	push   $0x0
+  80134d:	53                   	push   %ebx
+  80134e:	6a 00                	push   $0x0
+  801350:	e8 36 f9 ff ff       	call   800c8b <sys_page_map>
+  801355:	83 c4 20             	add    $0x20,%esp
+  801358:	85 c0                	test   %eax,%eax
+  80135a:	0f 89 83 fe ff ff    	jns    8011e3 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  801360:	50                   	push   %eax
+  801361:	68 d9 2e 80 00       	push   $0x802ed9
+  801366:	6a 4c                	push   $0x4c
+  801368:	68 bb 2e 80 00       	push   $0x802ebb
+  80136d:	e8 2b 11 00 00       	call   80249d <_panic>
+
+00801372 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801372:	55                   	push   %ebp
+  801373:	89 e5                	mov    %esp,%ebp
+  801375:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801378:	68 0d 2f 80 00       	push   $0x802f0d
+  80137d:	68 a0 00 00 00       	push   $0xa0
+  801382:	68 bb 2e 80 00       	push   $0x802ebb
+  801387:	e8 11 11 00 00       	call   80249d <_panic>
+
+0080138c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80138f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801392:	05 00 00 00 30       	add    $0x30000000,%eax
+  801397:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80139a:	5d                   	pop    %ebp
+  80139b:	c3                   	ret
+
+0080139c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80139c:	55                   	push   %ebp
+  80139d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80139f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013a2:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013a7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013ac:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013b1:	5d                   	pop    %ebp
+  8013b2:	c3                   	ret
+
+008013b3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013b3:	55                   	push   %ebp
+  8013b4:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8013b6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013bb:	eb 02                	jmp    8013bf <fd_alloc+0xc>
+  8013bd:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013bf:	89 c2                	mov    %eax,%edx
+  8013c1:	c1 ea 16             	shr    $0x16,%edx
+  8013c4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8013cb:	f6 c2 01             	test   $0x1,%dl
+  8013ce:	74 2b                	je     8013fb <fd_alloc+0x48>
+  8013d0:	89 c2                	mov    %eax,%edx
+  8013d2:	c1 ea 0c             	shr    $0xc,%edx
+  8013d5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013dc:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8013e2:	f6 c1 01             	test   $0x1,%cl
+  8013e5:	74 14                	je     8013fb <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8013e7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8013ed:	75 ce                	jne    8013bd <fd_alloc+0xa>
+  8013ef:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013f4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8013f9:	eb 05                	jmp    801400 <fd_alloc+0x4d>
+			return 0;
+  8013fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801400:	8b 55 08             	mov    0x8(%ebp),%edx
+  801403:	89 02                	mov    %eax,(%edx)
+}
+  801405:	89 c8                	mov    %ecx,%eax
+  801407:	5d                   	pop    %ebp
+  801408:	c3                   	ret
+
+00801409 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801409:	55                   	push   %ebp
+  80140a:	89 e5                	mov    %esp,%ebp
+  80140c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80140f:	83 f8 1f             	cmp    $0x1f,%eax
+  801412:	77 30                	ja     801444 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801414:	c1 e0 0c             	shl    $0xc,%eax
+  801417:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80141c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801422:	f6 c2 01             	test   $0x1,%dl
+  801425:	74 24                	je     80144b <fd_lookup+0x42>
+  801427:	89 c2                	mov    %eax,%edx
+  801429:	c1 ea 0c             	shr    $0xc,%edx
+  80142c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801433:	f6 c2 01             	test   $0x1,%dl
+  801436:	74 1a                	je     801452 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801438:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80143b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80143d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801442:	5d                   	pop    %ebp
+  801443:	c3                   	ret
+		return -E_INVAL;
+  801444:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801449:	eb f7                	jmp    801442 <fd_lookup+0x39>
+		return -E_INVAL;
+  80144b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801450:	eb f0                	jmp    801442 <fd_lookup+0x39>
+  801452:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801457:	eb e9                	jmp    801442 <fd_lookup+0x39>
+
+00801459 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	53                   	push   %ebx
+  80145d:	83 ec 04             	sub    $0x4,%esp
+  801460:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801463:	b8 00 00 00 00       	mov    $0x0,%eax
+  801468:	eb 03                	jmp    80146d <dev_lookup+0x14>
+  80146a:	83 c0 01             	add    $0x1,%eax
+  80146d:	8b 1c 85 1c 30 80 00 	mov    0x80301c(,%eax,4),%ebx
+  801474:	85 db                	test   %ebx,%ebx
+  801476:	74 0b                	je     801483 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801478:	39 13                	cmp    %edx,(%ebx)
+  80147a:	75 ee                	jne    80146a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80147c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801481:	eb 1f                	jmp    8014a2 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801483:	a1 08 50 80 00       	mov    0x805008,%eax
+  801488:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80148b:	83 ec 04             	sub    $0x4,%esp
+  80148e:	52                   	push   %edx
+  80148f:	50                   	push   %eax
+  801490:	68 a0 2f 80 00       	push   $0x802fa0
+  801495:	e8 10 ed ff ff       	call   8001aa <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80149a:	83 c4 10             	add    $0x10,%esp
+  80149d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014a5:	89 1a                	mov    %ebx,(%edx)
+}
+  8014a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014aa:	c9                   	leave
+  8014ab:	c3                   	ret
+
+008014ac <fd_close>:
+{
+  8014ac:	55                   	push   %ebp
+  8014ad:	89 e5                	mov    %esp,%ebp
+  8014af:	57                   	push   %edi
+  8014b0:	56                   	push   %esi
+  8014b1:	53                   	push   %ebx
+  8014b2:	83 ec 24             	sub    $0x24,%esp
+  8014b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014b8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014bb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014be:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014bf:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014c5:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014c8:	50                   	push   %eax
+  8014c9:	e8 3b ff ff ff       	call   801409 <fd_lookup>
+  8014ce:	89 c3                	mov    %eax,%ebx
+  8014d0:	83 c4 10             	add    $0x10,%esp
+  8014d3:	85 c0                	test   %eax,%eax
+  8014d5:	78 05                	js     8014dc <fd_close+0x30>
+	    || fd != fd2)
+  8014d7:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014da:	74 16                	je     8014f2 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8014dc:	89 f8                	mov    %edi,%eax
+  8014de:	84 c0                	test   %al,%al
+  8014e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e5:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014e8:	89 d8                	mov    %ebx,%eax
+  8014ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ed:	5b                   	pop    %ebx
+  8014ee:	5e                   	pop    %esi
+  8014ef:	5f                   	pop    %edi
+  8014f0:	5d                   	pop    %ebp
+  8014f1:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014f2:	83 ec 08             	sub    $0x8,%esp
+  8014f5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014f8:	50                   	push   %eax
+  8014f9:	ff 36                	push   (%esi)
+  8014fb:	e8 59 ff ff ff       	call   801459 <dev_lookup>
+  801500:	89 c3                	mov    %eax,%ebx
+  801502:	83 c4 10             	add    $0x10,%esp
+  801505:	85 c0                	test   %eax,%eax
+  801507:	78 1a                	js     801523 <fd_close+0x77>
+		if (dev->dev_close)
+  801509:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80150c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80150f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801514:	85 c0                	test   %eax,%eax
+  801516:	74 0b                	je     801523 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801518:	83 ec 0c             	sub    $0xc,%esp
+  80151b:	56                   	push   %esi
+  80151c:	ff d0                	call   *%eax
+  80151e:	89 c3                	mov    %eax,%ebx
+  801520:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801523:	83 ec 08             	sub    $0x8,%esp
+  801526:	56                   	push   %esi
+  801527:	6a 00                	push   $0x0
+  801529:	e8 9f f7 ff ff       	call   800ccd <sys_page_unmap>
+	return r;
+  80152e:	83 c4 10             	add    $0x10,%esp
+  801531:	eb b5                	jmp    8014e8 <fd_close+0x3c>
+
+00801533 <close>:
+
+int
+close(int fdnum)
+{
+  801533:	55                   	push   %ebp
+  801534:	89 e5                	mov    %esp,%ebp
+  801536:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801539:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80153c:	50                   	push   %eax
+  80153d:	ff 75 08             	push   0x8(%ebp)
+  801540:	e8 c4 fe ff ff       	call   801409 <fd_lookup>
+  801545:	83 c4 10             	add    $0x10,%esp
+  801548:	85 c0                	test   %eax,%eax
+  80154a:	79 02                	jns    80154e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80154c:	c9                   	leave
+  80154d:	c3                   	ret
+		return fd_close(fd, 1);
+  80154e:	83 ec 08             	sub    $0x8,%esp
+  801551:	6a 01                	push   $0x1
+  801553:	ff 75 f4             	push   -0xc(%ebp)
+  801556:	e8 51 ff ff ff       	call   8014ac <fd_close>
+  80155b:	83 c4 10             	add    $0x10,%esp
+  80155e:	eb ec                	jmp    80154c <close+0x19>
+
+00801560 <close_all>:
+
+void
+close_all(void)
+{
+  801560:	55                   	push   %ebp
+  801561:	89 e5                	mov    %esp,%ebp
+  801563:	53                   	push   %ebx
+  801564:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801567:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80156c:	83 ec 0c             	sub    $0xc,%esp
+  80156f:	53                   	push   %ebx
+  801570:	e8 be ff ff ff       	call   801533 <close>
+	for (i = 0; i < MAXFD; i++)
+  801575:	83 c3 01             	add    $0x1,%ebx
+  801578:	83 c4 10             	add    $0x10,%esp
+  80157b:	83 fb 20             	cmp    $0x20,%ebx
+  80157e:	75 ec                	jne    80156c <close_all+0xc>
+}
+  801580:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801583:	c9                   	leave
+  801584:	c3                   	ret
+
+00801585 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801585:	55                   	push   %ebp
+  801586:	89 e5                	mov    %esp,%ebp
+  801588:	57                   	push   %edi
+  801589:	56                   	push   %esi
+  80158a:	53                   	push   %ebx
+  80158b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80158e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801591:	50                   	push   %eax
+  801592:	ff 75 08             	push   0x8(%ebp)
+  801595:	e8 6f fe ff ff       	call   801409 <fd_lookup>
+  80159a:	89 c3                	mov    %eax,%ebx
+  80159c:	83 c4 10             	add    $0x10,%esp
+  80159f:	85 c0                	test   %eax,%eax
+  8015a1:	78 7f                	js     801622 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015a3:	83 ec 0c             	sub    $0xc,%esp
+  8015a6:	ff 75 0c             	push   0xc(%ebp)
+  8015a9:	e8 85 ff ff ff       	call   801533 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8015ae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015b1:	c1 e6 0c             	shl    $0xc,%esi
+  8015b4:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015bd:	89 3c 24             	mov    %edi,(%esp)
+  8015c0:	e8 d7 fd ff ff       	call   80139c <fd2data>
+  8015c5:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015c7:	89 34 24             	mov    %esi,(%esp)
+  8015ca:	e8 cd fd ff ff       	call   80139c <fd2data>
+  8015cf:	83 c4 10             	add    $0x10,%esp
+  8015d2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8015d5:	89 d8                	mov    %ebx,%eax
+  8015d7:	c1 e8 16             	shr    $0x16,%eax
+  8015da:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015e1:	a8 01                	test   $0x1,%al
+  8015e3:	74 11                	je     8015f6 <dup+0x71>
+  8015e5:	89 d8                	mov    %ebx,%eax
+  8015e7:	c1 e8 0c             	shr    $0xc,%eax
+  8015ea:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015f1:	f6 c2 01             	test   $0x1,%dl
+  8015f4:	75 36                	jne    80162c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015f6:	89 f8                	mov    %edi,%eax
+  8015f8:	c1 e8 0c             	shr    $0xc,%eax
+  8015fb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801602:	83 ec 0c             	sub    $0xc,%esp
+  801605:	25 07 0e 00 00       	and    $0xe07,%eax
+  80160a:	50                   	push   %eax
+  80160b:	56                   	push   %esi
+  80160c:	6a 00                	push   $0x0
+  80160e:	57                   	push   %edi
+  80160f:	6a 00                	push   $0x0
+  801611:	e8 75 f6 ff ff       	call   800c8b <sys_page_map>
+  801616:	89 c3                	mov    %eax,%ebx
+  801618:	83 c4 20             	add    $0x20,%esp
+  80161b:	85 c0                	test   %eax,%eax
+  80161d:	78 33                	js     801652 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80161f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801622:	89 d8                	mov    %ebx,%eax
+  801624:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801627:	5b                   	pop    %ebx
+  801628:	5e                   	pop    %esi
+  801629:	5f                   	pop    %edi
+  80162a:	5d                   	pop    %ebp
+  80162b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80162c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801633:	83 ec 0c             	sub    $0xc,%esp
+  801636:	25 07 0e 00 00       	and    $0xe07,%eax
+  80163b:	50                   	push   %eax
+  80163c:	ff 75 d4             	push   -0x2c(%ebp)
+  80163f:	6a 00                	push   $0x0
+  801641:	53                   	push   %ebx
+  801642:	6a 00                	push   $0x0
+  801644:	e8 42 f6 ff ff       	call   800c8b <sys_page_map>
+  801649:	89 c3                	mov    %eax,%ebx
+  80164b:	83 c4 20             	add    $0x20,%esp
+  80164e:	85 c0                	test   %eax,%eax
+  801650:	79 a4                	jns    8015f6 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801652:	83 ec 08             	sub    $0x8,%esp
+  801655:	56                   	push   %esi
+  801656:	6a 00                	push   $0x0
+  801658:	e8 70 f6 ff ff       	call   800ccd <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80165d:	83 c4 08             	add    $0x8,%esp
+  801660:	ff 75 d4             	push   -0x2c(%ebp)
+  801663:	6a 00                	push   $0x0
+  801665:	e8 63 f6 ff ff       	call   800ccd <sys_page_unmap>
+	return r;
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	eb b3                	jmp    801622 <dup+0x9d>
+
+0080166f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80166f:	55                   	push   %ebp
+  801670:	89 e5                	mov    %esp,%ebp
+  801672:	56                   	push   %esi
+  801673:	53                   	push   %ebx
+  801674:	83 ec 18             	sub    $0x18,%esp
+  801677:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80167a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80167d:	50                   	push   %eax
+  80167e:	56                   	push   %esi
+  80167f:	e8 85 fd ff ff       	call   801409 <fd_lookup>
+  801684:	83 c4 10             	add    $0x10,%esp
+  801687:	85 c0                	test   %eax,%eax
+  801689:	78 3c                	js     8016c7 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80168b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80168e:	83 ec 08             	sub    $0x8,%esp
+  801691:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801694:	50                   	push   %eax
+  801695:	ff 33                	push   (%ebx)
+  801697:	e8 bd fd ff ff       	call   801459 <dev_lookup>
+  80169c:	83 c4 10             	add    $0x10,%esp
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	78 24                	js     8016c7 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016a3:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016a6:	83 e0 03             	and    $0x3,%eax
+  8016a9:	83 f8 01             	cmp    $0x1,%eax
+  8016ac:	74 20                	je     8016ce <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8016ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b1:	8b 40 08             	mov    0x8(%eax),%eax
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	74 37                	je     8016ef <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016b8:	83 ec 04             	sub    $0x4,%esp
+  8016bb:	ff 75 10             	push   0x10(%ebp)
+  8016be:	ff 75 0c             	push   0xc(%ebp)
+  8016c1:	53                   	push   %ebx
+  8016c2:	ff d0                	call   *%eax
+  8016c4:	83 c4 10             	add    $0x10,%esp
+}
+  8016c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ca:	5b                   	pop    %ebx
+  8016cb:	5e                   	pop    %esi
+  8016cc:	5d                   	pop    %ebp
+  8016cd:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016ce:	a1 08 50 80 00       	mov    0x805008,%eax
+  8016d3:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8016d6:	83 ec 04             	sub    $0x4,%esp
+  8016d9:	56                   	push   %esi
+  8016da:	50                   	push   %eax
+  8016db:	68 e1 2f 80 00       	push   $0x802fe1
+  8016e0:	e8 c5 ea ff ff       	call   8001aa <cprintf>
+		return -E_INVAL;
+  8016e5:	83 c4 10             	add    $0x10,%esp
+  8016e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ed:	eb d8                	jmp    8016c7 <read+0x58>
+		return -E_NOT_SUPP;
+  8016ef:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016f4:	eb d1                	jmp    8016c7 <read+0x58>
+
+008016f6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016f6:	55                   	push   %ebp
+  8016f7:	89 e5                	mov    %esp,%ebp
+  8016f9:	57                   	push   %edi
+  8016fa:	56                   	push   %esi
+  8016fb:	53                   	push   %ebx
+  8016fc:	83 ec 0c             	sub    $0xc,%esp
+  8016ff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801702:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801705:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170a:	eb 02                	jmp    80170e <readn+0x18>
+  80170c:	01 c3                	add    %eax,%ebx
+  80170e:	39 f3                	cmp    %esi,%ebx
+  801710:	73 21                	jae    801733 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801712:	83 ec 04             	sub    $0x4,%esp
+  801715:	89 f0                	mov    %esi,%eax
+  801717:	29 d8                	sub    %ebx,%eax
+  801719:	50                   	push   %eax
+  80171a:	89 d8                	mov    %ebx,%eax
+  80171c:	03 45 0c             	add    0xc(%ebp),%eax
+  80171f:	50                   	push   %eax
+  801720:	57                   	push   %edi
+  801721:	e8 49 ff ff ff       	call   80166f <read>
+		if (m < 0)
+  801726:	83 c4 10             	add    $0x10,%esp
+  801729:	85 c0                	test   %eax,%eax
+  80172b:	78 04                	js     801731 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80172d:	75 dd                	jne    80170c <readn+0x16>
+  80172f:	eb 02                	jmp    801733 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801731:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801733:	89 d8                	mov    %ebx,%eax
+  801735:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801738:	5b                   	pop    %ebx
+  801739:	5e                   	pop    %esi
+  80173a:	5f                   	pop    %edi
+  80173b:	5d                   	pop    %ebp
+  80173c:	c3                   	ret
+
+0080173d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80173d:	55                   	push   %ebp
+  80173e:	89 e5                	mov    %esp,%ebp
+  801740:	56                   	push   %esi
+  801741:	53                   	push   %ebx
+  801742:	83 ec 18             	sub    $0x18,%esp
+  801745:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801748:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80174b:	50                   	push   %eax
+  80174c:	53                   	push   %ebx
+  80174d:	e8 b7 fc ff ff       	call   801409 <fd_lookup>
+  801752:	83 c4 10             	add    $0x10,%esp
+  801755:	85 c0                	test   %eax,%eax
+  801757:	78 37                	js     801790 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801759:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80175c:	83 ec 08             	sub    $0x8,%esp
+  80175f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801762:	50                   	push   %eax
+  801763:	ff 36                	push   (%esi)
+  801765:	e8 ef fc ff ff       	call   801459 <dev_lookup>
+  80176a:	83 c4 10             	add    $0x10,%esp
+  80176d:	85 c0                	test   %eax,%eax
+  80176f:	78 1f                	js     801790 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801771:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801775:	74 20                	je     801797 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801777:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80177a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	74 37                	je     8017b8 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801781:	83 ec 04             	sub    $0x4,%esp
+  801784:	ff 75 10             	push   0x10(%ebp)
+  801787:	ff 75 0c             	push   0xc(%ebp)
+  80178a:	56                   	push   %esi
+  80178b:	ff d0                	call   *%eax
+  80178d:	83 c4 10             	add    $0x10,%esp
+}
+  801790:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801793:	5b                   	pop    %ebx
+  801794:	5e                   	pop    %esi
+  801795:	5d                   	pop    %ebp
+  801796:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801797:	a1 08 50 80 00       	mov    0x805008,%eax
+  80179c:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80179f:	83 ec 04             	sub    $0x4,%esp
+  8017a2:	53                   	push   %ebx
+  8017a3:	50                   	push   %eax
+  8017a4:	68 fd 2f 80 00       	push   $0x802ffd
+  8017a9:	e8 fc e9 ff ff       	call   8001aa <cprintf>
+		return -E_INVAL;
+  8017ae:	83 c4 10             	add    $0x10,%esp
+  8017b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b6:	eb d8                	jmp    801790 <write+0x53>
+		return -E_NOT_SUPP;
+  8017b8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017bd:	eb d1                	jmp    801790 <write+0x53>
+
+008017bf <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017bf:	55                   	push   %ebp
+  8017c0:	89 e5                	mov    %esp,%ebp
+  8017c2:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017c8:	50                   	push   %eax
+  8017c9:	ff 75 08             	push   0x8(%ebp)
+  8017cc:	e8 38 fc ff ff       	call   801409 <fd_lookup>
+  8017d1:	83 c4 10             	add    $0x10,%esp
+  8017d4:	85 c0                	test   %eax,%eax
+  8017d6:	78 0e                	js     8017e6 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017de:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017e6:	c9                   	leave
+  8017e7:	c3                   	ret
+
+008017e8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	56                   	push   %esi
+  8017ec:	53                   	push   %ebx
+  8017ed:	83 ec 18             	sub    $0x18,%esp
+  8017f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017f3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017f6:	50                   	push   %eax
+  8017f7:	53                   	push   %ebx
+  8017f8:	e8 0c fc ff ff       	call   801409 <fd_lookup>
+  8017fd:	83 c4 10             	add    $0x10,%esp
+  801800:	85 c0                	test   %eax,%eax
+  801802:	78 34                	js     801838 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801804:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801807:	83 ec 08             	sub    $0x8,%esp
+  80180a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80180d:	50                   	push   %eax
+  80180e:	ff 36                	push   (%esi)
+  801810:	e8 44 fc ff ff       	call   801459 <dev_lookup>
+  801815:	83 c4 10             	add    $0x10,%esp
+  801818:	85 c0                	test   %eax,%eax
+  80181a:	78 1c                	js     801838 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80181c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801820:	74 1d                	je     80183f <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801822:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801825:	8b 40 18             	mov    0x18(%eax),%eax
+  801828:	85 c0                	test   %eax,%eax
+  80182a:	74 34                	je     801860 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80182c:	83 ec 08             	sub    $0x8,%esp
+  80182f:	ff 75 0c             	push   0xc(%ebp)
+  801832:	56                   	push   %esi
+  801833:	ff d0                	call   *%eax
+  801835:	83 c4 10             	add    $0x10,%esp
+}
+  801838:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80183b:	5b                   	pop    %ebx
+  80183c:	5e                   	pop    %esi
+  80183d:	5d                   	pop    %ebp
+  80183e:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80183f:	a1 08 50 80 00       	mov    0x805008,%eax
+  801844:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801847:	83 ec 04             	sub    $0x4,%esp
+  80184a:	53                   	push   %ebx
+  80184b:	50                   	push   %eax
+  80184c:	68 c0 2f 80 00       	push   $0x802fc0
+  801851:	e8 54 e9 ff ff       	call   8001aa <cprintf>
+		return -E_INVAL;
+  801856:	83 c4 10             	add    $0x10,%esp
+  801859:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185e:	eb d8                	jmp    801838 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801860:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801865:	eb d1                	jmp    801838 <ftruncate+0x50>
+
+00801867 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801867:	55                   	push   %ebp
+  801868:	89 e5                	mov    %esp,%ebp
+  80186a:	56                   	push   %esi
+  80186b:	53                   	push   %ebx
+  80186c:	83 ec 18             	sub    $0x18,%esp
+  80186f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801872:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801875:	50                   	push   %eax
+  801876:	ff 75 08             	push   0x8(%ebp)
+  801879:	e8 8b fb ff ff       	call   801409 <fd_lookup>
+  80187e:	83 c4 10             	add    $0x10,%esp
+  801881:	85 c0                	test   %eax,%eax
+  801883:	78 49                	js     8018ce <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801885:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801888:	83 ec 08             	sub    $0x8,%esp
+  80188b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80188e:	50                   	push   %eax
+  80188f:	ff 36                	push   (%esi)
+  801891:	e8 c3 fb ff ff       	call   801459 <dev_lookup>
+  801896:	83 c4 10             	add    $0x10,%esp
+  801899:	85 c0                	test   %eax,%eax
+  80189b:	78 31                	js     8018ce <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80189d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018a0:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018a4:	74 2f                	je     8018d5 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018a6:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018a9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018b0:	00 00 00 
+	stat->st_isdir = 0;
+  8018b3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018ba:	00 00 00 
+	stat->st_dev = dev;
+  8018bd:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018c3:	83 ec 08             	sub    $0x8,%esp
+  8018c6:	53                   	push   %ebx
+  8018c7:	56                   	push   %esi
+  8018c8:	ff 50 14             	call   *0x14(%eax)
+  8018cb:	83 c4 10             	add    $0x10,%esp
+}
+  8018ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018d1:	5b                   	pop    %ebx
+  8018d2:	5e                   	pop    %esi
+  8018d3:	5d                   	pop    %ebp
+  8018d4:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018d5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018da:	eb f2                	jmp    8018ce <fstat+0x67>
+
+008018dc <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018dc:	55                   	push   %ebp
+  8018dd:	89 e5                	mov    %esp,%ebp
+  8018df:	56                   	push   %esi
+  8018e0:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018e1:	83 ec 08             	sub    $0x8,%esp
+  8018e4:	6a 00                	push   $0x0
+  8018e6:	ff 75 08             	push   0x8(%ebp)
+  8018e9:	e8 e4 01 00 00       	call   801ad2 <open>
+  8018ee:	89 c3                	mov    %eax,%ebx
+  8018f0:	83 c4 10             	add    $0x10,%esp
+  8018f3:	85 c0                	test   %eax,%eax
+  8018f5:	78 1b                	js     801912 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018f7:	83 ec 08             	sub    $0x8,%esp
+  8018fa:	ff 75 0c             	push   0xc(%ebp)
+  8018fd:	50                   	push   %eax
+  8018fe:	e8 64 ff ff ff       	call   801867 <fstat>
+  801903:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801905:	89 1c 24             	mov    %ebx,(%esp)
+  801908:	e8 26 fc ff ff       	call   801533 <close>
+	return r;
+  80190d:	83 c4 10             	add    $0x10,%esp
+  801910:	89 f3                	mov    %esi,%ebx
+}
+  801912:	89 d8                	mov    %ebx,%eax
+  801914:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801917:	5b                   	pop    %ebx
+  801918:	5e                   	pop    %esi
+  801919:	5d                   	pop    %ebp
+  80191a:	c3                   	ret
+
+0080191b <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80191b:	55                   	push   %ebp
+  80191c:	89 e5                	mov    %esp,%ebp
+  80191e:	56                   	push   %esi
+  80191f:	53                   	push   %ebx
+  801920:	89 c6                	mov    %eax,%esi
+  801922:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801924:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  80192b:	74 27                	je     801954 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80192d:	6a 07                	push   $0x7
+  80192f:	68 00 60 80 00       	push   $0x806000
+  801934:	56                   	push   %esi
+  801935:	ff 35 00 50 80 00    	push   0x805000
+  80193b:	e8 ac 0c 00 00       	call   8025ec <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801940:	83 c4 0c             	add    $0xc,%esp
+  801943:	6a 00                	push   $0x0
+  801945:	53                   	push   %ebx
+  801946:	6a 00                	push   $0x0
+  801948:	e8 27 0c 00 00       	call   802574 <ipc_recv>
+}
+  80194d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801950:	5b                   	pop    %ebx
+  801951:	5e                   	pop    %esi
+  801952:	5d                   	pop    %ebp
+  801953:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801954:	83 ec 0c             	sub    $0xc,%esp
+  801957:	6a 01                	push   $0x1
+  801959:	e8 e2 0c 00 00       	call   802640 <ipc_find_env>
+  80195e:	a3 00 50 80 00       	mov    %eax,0x805000
+  801963:	83 c4 10             	add    $0x10,%esp
+  801966:	eb c5                	jmp    80192d <fsipc+0x12>
+
+00801968 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801968:	55                   	push   %ebp
+  801969:	89 e5                	mov    %esp,%ebp
+  80196b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80196e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801971:	8b 40 0c             	mov    0xc(%eax),%eax
+  801974:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801979:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80197c:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801981:	ba 00 00 00 00       	mov    $0x0,%edx
+  801986:	b8 02 00 00 00       	mov    $0x2,%eax
+  80198b:	e8 8b ff ff ff       	call   80191b <fsipc>
+}
+  801990:	c9                   	leave
+  801991:	c3                   	ret
+
+00801992 <devfile_flush>:
+{
+  801992:	55                   	push   %ebp
+  801993:	89 e5                	mov    %esp,%ebp
+  801995:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801998:	8b 45 08             	mov    0x8(%ebp),%eax
+  80199b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80199e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8019a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019ad:	e8 69 ff ff ff       	call   80191b <fsipc>
+}
+  8019b2:	c9                   	leave
+  8019b3:	c3                   	ret
+
+008019b4 <devfile_stat>:
+{
+  8019b4:	55                   	push   %ebp
+  8019b5:	89 e5                	mov    %esp,%ebp
+  8019b7:	53                   	push   %ebx
+  8019b8:	83 ec 04             	sub    $0x4,%esp
+  8019bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019c4:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ce:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019d3:	e8 43 ff ff ff       	call   80191b <fsipc>
+  8019d8:	85 c0                	test   %eax,%eax
+  8019da:	78 2c                	js     801a08 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019dc:	83 ec 08             	sub    $0x8,%esp
+  8019df:	68 00 60 80 00       	push   $0x806000
+  8019e4:	53                   	push   %ebx
+  8019e5:	e8 ae ed ff ff       	call   800798 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019ea:	a1 80 60 80 00       	mov    0x806080,%eax
+  8019ef:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019f5:	a1 84 60 80 00       	mov    0x806084,%eax
+  8019fa:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801a00:	83 c4 10             	add    $0x10,%esp
+  801a03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a0b:	c9                   	leave
+  801a0c:	c3                   	ret
+
+00801a0d <devfile_write>:
+{
+  801a0d:	55                   	push   %ebp
+  801a0e:	89 e5                	mov    %esp,%ebp
+  801a10:	83 ec 0c             	sub    $0xc,%esp
+  801a13:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a16:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a1b:	39 d0                	cmp    %edx,%eax
+  801a1d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a20:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a23:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a26:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801a2c:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a31:	50                   	push   %eax
+  801a32:	ff 75 0c             	push   0xc(%ebp)
+  801a35:	68 08 60 80 00       	push   $0x806008
+  801a3a:	e8 df ee ff ff       	call   80091e <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a44:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a49:	e8 cd fe ff ff       	call   80191b <fsipc>
+}
+  801a4e:	c9                   	leave
+  801a4f:	c3                   	ret
+
+00801a50 <devfile_read>:
+{
+  801a50:	55                   	push   %ebp
+  801a51:	89 e5                	mov    %esp,%ebp
+  801a53:	56                   	push   %esi
+  801a54:	53                   	push   %ebx
+  801a55:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a5b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a5e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801a63:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a73:	e8 a3 fe ff ff       	call   80191b <fsipc>
+  801a78:	89 c3                	mov    %eax,%ebx
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	78 1f                	js     801a9d <devfile_read+0x4d>
+	assert(r <= n);
+  801a7e:	39 c6                	cmp    %eax,%esi
+  801a80:	72 24                	jb     801aa6 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801a82:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a87:	7f 33                	jg     801abc <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a89:	83 ec 04             	sub    $0x4,%esp
+  801a8c:	50                   	push   %eax
+  801a8d:	68 00 60 80 00       	push   $0x806000
+  801a92:	ff 75 0c             	push   0xc(%ebp)
+  801a95:	e8 84 ee ff ff       	call   80091e <memmove>
+	return r;
+  801a9a:	83 c4 10             	add    $0x10,%esp
+}
+  801a9d:	89 d8                	mov    %ebx,%eax
+  801a9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa2:	5b                   	pop    %ebx
+  801aa3:	5e                   	pop    %esi
+  801aa4:	5d                   	pop    %ebp
+  801aa5:	c3                   	ret
+	assert(r <= n);
+  801aa6:	68 30 30 80 00       	push   $0x803030
+  801aab:	68 37 30 80 00       	push   $0x803037
+  801ab0:	6a 7c                	push   $0x7c
+  801ab2:	68 4c 30 80 00       	push   $0x80304c
+  801ab7:	e8 e1 09 00 00       	call   80249d <_panic>
+	assert(r <= PGSIZE);
+  801abc:	68 57 30 80 00       	push   $0x803057
+  801ac1:	68 37 30 80 00       	push   $0x803037
+  801ac6:	6a 7d                	push   $0x7d
+  801ac8:	68 4c 30 80 00       	push   $0x80304c
+  801acd:	e8 cb 09 00 00       	call   80249d <_panic>
+
+00801ad2 <open>:
+{
+  801ad2:	55                   	push   %ebp
+  801ad3:	89 e5                	mov    %esp,%ebp
+  801ad5:	56                   	push   %esi
+  801ad6:	53                   	push   %ebx
+  801ad7:	83 ec 1c             	sub    $0x1c,%esp
+  801ada:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801add:	56                   	push   %esi
+  801ade:	e8 7a ec ff ff       	call   80075d <strlen>
+  801ae3:	83 c4 10             	add    $0x10,%esp
+  801ae6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801aeb:	7f 6c                	jg     801b59 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801aed:	83 ec 0c             	sub    $0xc,%esp
+  801af0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af3:	50                   	push   %eax
+  801af4:	e8 ba f8 ff ff       	call   8013b3 <fd_alloc>
+  801af9:	89 c3                	mov    %eax,%ebx
+  801afb:	83 c4 10             	add    $0x10,%esp
+  801afe:	85 c0                	test   %eax,%eax
+  801b00:	78 3c                	js     801b3e <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b02:	83 ec 08             	sub    $0x8,%esp
+  801b05:	56                   	push   %esi
+  801b06:	68 00 60 80 00       	push   $0x806000
+  801b0b:	e8 88 ec ff ff       	call   800798 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b10:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b13:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b18:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b20:	e8 f6 fd ff ff       	call   80191b <fsipc>
+  801b25:	89 c3                	mov    %eax,%ebx
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	85 c0                	test   %eax,%eax
+  801b2c:	78 19                	js     801b47 <open+0x75>
+	return fd2num(fd);
+  801b2e:	83 ec 0c             	sub    $0xc,%esp
+  801b31:	ff 75 f4             	push   -0xc(%ebp)
+  801b34:	e8 53 f8 ff ff       	call   80138c <fd2num>
+  801b39:	89 c3                	mov    %eax,%ebx
+  801b3b:	83 c4 10             	add    $0x10,%esp
+}
+  801b3e:	89 d8                	mov    %ebx,%eax
+  801b40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b43:	5b                   	pop    %ebx
+  801b44:	5e                   	pop    %esi
+  801b45:	5d                   	pop    %ebp
+  801b46:	c3                   	ret
+		fd_close(fd, 0);
+  801b47:	83 ec 08             	sub    $0x8,%esp
+  801b4a:	6a 00                	push   $0x0
+  801b4c:	ff 75 f4             	push   -0xc(%ebp)
+  801b4f:	e8 58 f9 ff ff       	call   8014ac <fd_close>
+		return r;
+  801b54:	83 c4 10             	add    $0x10,%esp
+  801b57:	eb e5                	jmp    801b3e <open+0x6c>
+		return -E_BAD_PATH;
+  801b59:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b5e:	eb de                	jmp    801b3e <open+0x6c>
+
+00801b60 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b60:	55                   	push   %ebp
+  801b61:	89 e5                	mov    %esp,%ebp
+  801b63:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b70:	e8 a6 fd ff ff       	call   80191b <fsipc>
+}
+  801b75:	c9                   	leave
+  801b76:	c3                   	ret
+
+00801b77 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b77:	55                   	push   %ebp
+  801b78:	89 e5                	mov    %esp,%ebp
+  801b7a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801b7d:	68 63 30 80 00       	push   $0x803063
+  801b82:	ff 75 0c             	push   0xc(%ebp)
+  801b85:	e8 0e ec ff ff       	call   800798 <strcpy>
+	return 0;
+}
+  801b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8f:	c9                   	leave
+  801b90:	c3                   	ret
+
+00801b91 <devsock_close>:
+{
+  801b91:	55                   	push   %ebp
+  801b92:	89 e5                	mov    %esp,%ebp
+  801b94:	53                   	push   %ebx
+  801b95:	83 ec 10             	sub    $0x10,%esp
+  801b98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801b9b:	53                   	push   %ebx
+  801b9c:	e8 af 0a 00 00       	call   802650 <pageref>
+  801ba1:	89 c2                	mov    %eax,%edx
+  801ba3:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801bab:	83 fa 01             	cmp    $0x1,%edx
+  801bae:	74 05                	je     801bb5 <devsock_close+0x24>
+}
+  801bb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bb3:	c9                   	leave
+  801bb4:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801bb5:	83 ec 0c             	sub    $0xc,%esp
+  801bb8:	ff 73 0c             	push   0xc(%ebx)
+  801bbb:	e8 b7 02 00 00       	call   801e77 <nsipc_close>
+  801bc0:	83 c4 10             	add    $0x10,%esp
+  801bc3:	eb eb                	jmp    801bb0 <devsock_close+0x1f>
+
+00801bc5 <devsock_write>:
+{
+  801bc5:	55                   	push   %ebp
+  801bc6:	89 e5                	mov    %esp,%ebp
+  801bc8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801bcb:	6a 00                	push   $0x0
+  801bcd:	ff 75 10             	push   0x10(%ebp)
+  801bd0:	ff 75 0c             	push   0xc(%ebp)
+  801bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd6:	ff 70 0c             	push   0xc(%eax)
+  801bd9:	e8 79 03 00 00       	call   801f57 <nsipc_send>
+}
+  801bde:	c9                   	leave
+  801bdf:	c3                   	ret
+
+00801be0 <devsock_read>:
+{
+  801be0:	55                   	push   %ebp
+  801be1:	89 e5                	mov    %esp,%ebp
+  801be3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801be6:	6a 00                	push   $0x0
+  801be8:	ff 75 10             	push   0x10(%ebp)
+  801beb:	ff 75 0c             	push   0xc(%ebp)
+  801bee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf1:	ff 70 0c             	push   0xc(%eax)
+  801bf4:	e8 ef 02 00 00       	call   801ee8 <nsipc_recv>
+}
+  801bf9:	c9                   	leave
+  801bfa:	c3                   	ret
+
+00801bfb <fd2sockid>:
+{
+  801bfb:	55                   	push   %ebp
+  801bfc:	89 e5                	mov    %esp,%ebp
+  801bfe:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c01:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c04:	52                   	push   %edx
+  801c05:	50                   	push   %eax
+  801c06:	e8 fe f7 ff ff       	call   801409 <fd_lookup>
+  801c0b:	83 c4 10             	add    $0x10,%esp
+  801c0e:	85 c0                	test   %eax,%eax
+  801c10:	78 10                	js     801c22 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c15:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801c1b:	39 08                	cmp    %ecx,(%eax)
+  801c1d:	75 05                	jne    801c24 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801c1f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801c22:	c9                   	leave
+  801c23:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c24:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c29:	eb f7                	jmp    801c22 <fd2sockid+0x27>
+
+00801c2b <alloc_sockfd>:
+{
+  801c2b:	55                   	push   %ebp
+  801c2c:	89 e5                	mov    %esp,%ebp
+  801c2e:	56                   	push   %esi
+  801c2f:	53                   	push   %ebx
+  801c30:	83 ec 1c             	sub    $0x1c,%esp
+  801c33:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801c35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c38:	50                   	push   %eax
+  801c39:	e8 75 f7 ff ff       	call   8013b3 <fd_alloc>
+  801c3e:	89 c3                	mov    %eax,%ebx
+  801c40:	83 c4 10             	add    $0x10,%esp
+  801c43:	85 c0                	test   %eax,%eax
+  801c45:	78 43                	js     801c8a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801c47:	83 ec 04             	sub    $0x4,%esp
+  801c4a:	68 07 04 00 00       	push   $0x407
+  801c4f:	ff 75 f4             	push   -0xc(%ebp)
+  801c52:	6a 00                	push   $0x0
+  801c54:	e8 ac ef ff ff       	call   800c05 <sys_page_alloc>
+  801c59:	89 c3                	mov    %eax,%ebx
+  801c5b:	83 c4 10             	add    $0x10,%esp
+  801c5e:	85 c0                	test   %eax,%eax
+  801c60:	78 28                	js     801c8a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801c62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c65:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801c6b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801c6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c70:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801c77:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801c7a:	83 ec 0c             	sub    $0xc,%esp
+  801c7d:	50                   	push   %eax
+  801c7e:	e8 09 f7 ff ff       	call   80138c <fd2num>
+  801c83:	89 c3                	mov    %eax,%ebx
+  801c85:	83 c4 10             	add    $0x10,%esp
+  801c88:	eb 0c                	jmp    801c96 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801c8a:	83 ec 0c             	sub    $0xc,%esp
+  801c8d:	56                   	push   %esi
+  801c8e:	e8 e4 01 00 00       	call   801e77 <nsipc_close>
+		return r;
+  801c93:	83 c4 10             	add    $0x10,%esp
+}
+  801c96:	89 d8                	mov    %ebx,%eax
+  801c98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c9b:	5b                   	pop    %ebx
+  801c9c:	5e                   	pop    %esi
+  801c9d:	5d                   	pop    %ebp
+  801c9e:	c3                   	ret
+
+00801c9f <accept>:
+{
+  801c9f:	55                   	push   %ebp
+  801ca0:	89 e5                	mov    %esp,%ebp
+  801ca2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ca5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca8:	e8 4e ff ff ff       	call   801bfb <fd2sockid>
+  801cad:	85 c0                	test   %eax,%eax
+  801caf:	78 1b                	js     801ccc <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801cb1:	83 ec 04             	sub    $0x4,%esp
+  801cb4:	ff 75 10             	push   0x10(%ebp)
+  801cb7:	ff 75 0c             	push   0xc(%ebp)
+  801cba:	50                   	push   %eax
+  801cbb:	e8 0e 01 00 00       	call   801dce <nsipc_accept>
+  801cc0:	83 c4 10             	add    $0x10,%esp
+  801cc3:	85 c0                	test   %eax,%eax
+  801cc5:	78 05                	js     801ccc <accept+0x2d>
+	return alloc_sockfd(r);
+  801cc7:	e8 5f ff ff ff       	call   801c2b <alloc_sockfd>
+}
+  801ccc:	c9                   	leave
+  801ccd:	c3                   	ret
+
+00801cce <bind>:
+{
+  801cce:	55                   	push   %ebp
+  801ccf:	89 e5                	mov    %esp,%ebp
+  801cd1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd7:	e8 1f ff ff ff       	call   801bfb <fd2sockid>
+  801cdc:	85 c0                	test   %eax,%eax
+  801cde:	78 12                	js     801cf2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801ce0:	83 ec 04             	sub    $0x4,%esp
+  801ce3:	ff 75 10             	push   0x10(%ebp)
+  801ce6:	ff 75 0c             	push   0xc(%ebp)
+  801ce9:	50                   	push   %eax
+  801cea:	e8 31 01 00 00       	call   801e20 <nsipc_bind>
+  801cef:	83 c4 10             	add    $0x10,%esp
+}
+  801cf2:	c9                   	leave
+  801cf3:	c3                   	ret
+
+00801cf4 <shutdown>:
+{
+  801cf4:	55                   	push   %ebp
+  801cf5:	89 e5                	mov    %esp,%ebp
+  801cf7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cfd:	e8 f9 fe ff ff       	call   801bfb <fd2sockid>
+  801d02:	85 c0                	test   %eax,%eax
+  801d04:	78 0f                	js     801d15 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d06:	83 ec 08             	sub    $0x8,%esp
+  801d09:	ff 75 0c             	push   0xc(%ebp)
+  801d0c:	50                   	push   %eax
+  801d0d:	e8 43 01 00 00       	call   801e55 <nsipc_shutdown>
+  801d12:	83 c4 10             	add    $0x10,%esp
+}
+  801d15:	c9                   	leave
+  801d16:	c3                   	ret
+
+00801d17 <connect>:
+{
+  801d17:	55                   	push   %ebp
+  801d18:	89 e5                	mov    %esp,%ebp
+  801d1a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d20:	e8 d6 fe ff ff       	call   801bfb <fd2sockid>
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	78 12                	js     801d3b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801d29:	83 ec 04             	sub    $0x4,%esp
+  801d2c:	ff 75 10             	push   0x10(%ebp)
+  801d2f:	ff 75 0c             	push   0xc(%ebp)
+  801d32:	50                   	push   %eax
+  801d33:	e8 59 01 00 00       	call   801e91 <nsipc_connect>
+  801d38:	83 c4 10             	add    $0x10,%esp
+}
+  801d3b:	c9                   	leave
+  801d3c:	c3                   	ret
+
+00801d3d <listen>:
+{
+  801d3d:	55                   	push   %ebp
+  801d3e:	89 e5                	mov    %esp,%ebp
+  801d40:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d46:	e8 b0 fe ff ff       	call   801bfb <fd2sockid>
+  801d4b:	85 c0                	test   %eax,%eax
+  801d4d:	78 0f                	js     801d5e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801d4f:	83 ec 08             	sub    $0x8,%esp
+  801d52:	ff 75 0c             	push   0xc(%ebp)
+  801d55:	50                   	push   %eax
+  801d56:	e8 6b 01 00 00       	call   801ec6 <nsipc_listen>
+  801d5b:	83 c4 10             	add    $0x10,%esp
+}
+  801d5e:	c9                   	leave
+  801d5f:	c3                   	ret
+
+00801d60 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801d60:	55                   	push   %ebp
+  801d61:	89 e5                	mov    %esp,%ebp
+  801d63:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801d66:	ff 75 10             	push   0x10(%ebp)
+  801d69:	ff 75 0c             	push   0xc(%ebp)
+  801d6c:	ff 75 08             	push   0x8(%ebp)
+  801d6f:	e8 41 02 00 00       	call   801fb5 <nsipc_socket>
+  801d74:	83 c4 10             	add    $0x10,%esp
+  801d77:	85 c0                	test   %eax,%eax
+  801d79:	78 05                	js     801d80 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801d7b:	e8 ab fe ff ff       	call   801c2b <alloc_sockfd>
+}
+  801d80:	c9                   	leave
+  801d81:	c3                   	ret
+
+00801d82 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	53                   	push   %ebx
+  801d86:	83 ec 04             	sub    $0x4,%esp
+  801d89:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801d8b:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801d92:	74 26                	je     801dba <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801d94:	6a 07                	push   $0x7
+  801d96:	68 00 70 80 00       	push   $0x807000
+  801d9b:	53                   	push   %ebx
+  801d9c:	ff 35 04 50 80 00    	push   0x805004
+  801da2:	e8 45 08 00 00       	call   8025ec <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801da7:	83 c4 0c             	add    $0xc,%esp
+  801daa:	6a 00                	push   $0x0
+  801dac:	6a 00                	push   $0x0
+  801dae:	6a 00                	push   $0x0
+  801db0:	e8 bf 07 00 00       	call   802574 <ipc_recv>
+}
+  801db5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801db8:	c9                   	leave
+  801db9:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801dba:	83 ec 0c             	sub    $0xc,%esp
+  801dbd:	6a 02                	push   $0x2
+  801dbf:	e8 7c 08 00 00       	call   802640 <ipc_find_env>
+  801dc4:	a3 04 50 80 00       	mov    %eax,0x805004
+  801dc9:	83 c4 10             	add    $0x10,%esp
+  801dcc:	eb c6                	jmp    801d94 <nsipc+0x12>
+
+00801dce <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801dce:	55                   	push   %ebp
+  801dcf:	89 e5                	mov    %esp,%ebp
+  801dd1:	56                   	push   %esi
+  801dd2:	53                   	push   %ebx
+  801dd3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801dd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801dde:	8b 06                	mov    (%esi),%eax
+  801de0:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801de5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dea:	e8 93 ff ff ff       	call   801d82 <nsipc>
+  801def:	89 c3                	mov    %eax,%ebx
+  801df1:	85 c0                	test   %eax,%eax
+  801df3:	79 09                	jns    801dfe <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801df5:	89 d8                	mov    %ebx,%eax
+  801df7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfa:	5b                   	pop    %ebx
+  801dfb:	5e                   	pop    %esi
+  801dfc:	5d                   	pop    %ebp
+  801dfd:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801dfe:	83 ec 04             	sub    $0x4,%esp
+  801e01:	ff 35 10 70 80 00    	push   0x807010
+  801e07:	68 00 70 80 00       	push   $0x807000
+  801e0c:	ff 75 0c             	push   0xc(%ebp)
+  801e0f:	e8 0a eb ff ff       	call   80091e <memmove>
+		*addrlen = ret->ret_addrlen;
+  801e14:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e19:	89 06                	mov    %eax,(%esi)
+  801e1b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801e1e:	eb d5                	jmp    801df5 <nsipc_accept+0x27>
+
+00801e20 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801e20:	55                   	push   %ebp
+  801e21:	89 e5                	mov    %esp,%ebp
+  801e23:	53                   	push   %ebx
+  801e24:	83 ec 08             	sub    $0x8,%esp
+  801e27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801e2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e2d:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801e32:	53                   	push   %ebx
+  801e33:	ff 75 0c             	push   0xc(%ebp)
+  801e36:	68 04 70 80 00       	push   $0x807004
+  801e3b:	e8 de ea ff ff       	call   80091e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801e40:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801e46:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e4b:	e8 32 ff ff ff       	call   801d82 <nsipc>
+}
+  801e50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e53:	c9                   	leave
+  801e54:	c3                   	ret
+
+00801e55 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801e55:	55                   	push   %ebp
+  801e56:	89 e5                	mov    %esp,%ebp
+  801e58:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801e5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e5e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801e63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e66:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801e6b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e70:	e8 0d ff ff ff       	call   801d82 <nsipc>
+}
+  801e75:	c9                   	leave
+  801e76:	c3                   	ret
+
+00801e77 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801e77:	55                   	push   %ebp
+  801e78:	89 e5                	mov    %esp,%ebp
+  801e7a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801e7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e80:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801e85:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e8a:	e8 f3 fe ff ff       	call   801d82 <nsipc>
+}
+  801e8f:	c9                   	leave
+  801e90:	c3                   	ret
+
+00801e91 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801e91:	55                   	push   %ebp
+  801e92:	89 e5                	mov    %esp,%ebp
+  801e94:	53                   	push   %ebx
+  801e95:	83 ec 08             	sub    $0x8,%esp
+  801e98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801e9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e9e:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801ea3:	53                   	push   %ebx
+  801ea4:	ff 75 0c             	push   0xc(%ebp)
+  801ea7:	68 04 70 80 00       	push   $0x807004
+  801eac:	e8 6d ea ff ff       	call   80091e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801eb1:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801eb7:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ebc:	e8 c1 fe ff ff       	call   801d82 <nsipc>
+}
+  801ec1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ec4:	c9                   	leave
+  801ec5:	c3                   	ret
+
+00801ec6 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801ec6:	55                   	push   %ebp
+  801ec7:	89 e5                	mov    %esp,%ebp
+  801ec9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801ecc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ecf:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801ed4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed7:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801edc:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ee1:	e8 9c fe ff ff       	call   801d82 <nsipc>
+}
+  801ee6:	c9                   	leave
+  801ee7:	c3                   	ret
+
+00801ee8 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	56                   	push   %esi
+  801eec:	53                   	push   %ebx
+  801eed:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801ef0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef3:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801ef8:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801efe:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f01:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801f06:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f0b:	e8 72 fe ff ff       	call   801d82 <nsipc>
+  801f10:	89 c3                	mov    %eax,%ebx
+  801f12:	85 c0                	test   %eax,%eax
+  801f14:	78 22                	js     801f38 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801f16:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801f1b:	39 c6                	cmp    %eax,%esi
+  801f1d:	0f 4e c6             	cmovle %esi,%eax
+  801f20:	39 c3                	cmp    %eax,%ebx
+  801f22:	7f 1d                	jg     801f41 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801f24:	83 ec 04             	sub    $0x4,%esp
+  801f27:	53                   	push   %ebx
+  801f28:	68 00 70 80 00       	push   $0x807000
+  801f2d:	ff 75 0c             	push   0xc(%ebp)
+  801f30:	e8 e9 e9 ff ff       	call   80091e <memmove>
+  801f35:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801f38:	89 d8                	mov    %ebx,%eax
+  801f3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f3d:	5b                   	pop    %ebx
+  801f3e:	5e                   	pop    %esi
+  801f3f:	5d                   	pop    %ebp
+  801f40:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801f41:	68 6f 30 80 00       	push   $0x80306f
+  801f46:	68 37 30 80 00       	push   $0x803037
+  801f4b:	6a 62                	push   $0x62
+  801f4d:	68 84 30 80 00       	push   $0x803084
+  801f52:	e8 46 05 00 00       	call   80249d <_panic>
+
+00801f57 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801f57:	55                   	push   %ebp
+  801f58:	89 e5                	mov    %esp,%ebp
+  801f5a:	53                   	push   %ebx
+  801f5b:	83 ec 04             	sub    $0x4,%esp
+  801f5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801f61:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f64:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801f69:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801f6f:	7f 2e                	jg     801f9f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801f71:	83 ec 04             	sub    $0x4,%esp
+  801f74:	53                   	push   %ebx
+  801f75:	ff 75 0c             	push   0xc(%ebp)
+  801f78:	68 0c 70 80 00       	push   $0x80700c
+  801f7d:	e8 9c e9 ff ff       	call   80091e <memmove>
+	nsipcbuf.send.req_size = size;
+  801f82:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801f88:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f8b:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801f90:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f95:	e8 e8 fd ff ff       	call   801d82 <nsipc>
+}
+  801f9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f9d:	c9                   	leave
+  801f9e:	c3                   	ret
+	assert(size < 1600);
+  801f9f:	68 90 30 80 00       	push   $0x803090
+  801fa4:	68 37 30 80 00       	push   $0x803037
+  801fa9:	6a 6d                	push   $0x6d
+  801fab:	68 84 30 80 00       	push   $0x803084
+  801fb0:	e8 e8 04 00 00       	call   80249d <_panic>
+
+00801fb5 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801fb5:	55                   	push   %ebp
+  801fb6:	89 e5                	mov    %esp,%ebp
+  801fb8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801fbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbe:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801fc3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc6:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801fcb:	8b 45 10             	mov    0x10(%ebp),%eax
+  801fce:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801fd3:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fd8:	e8 a5 fd ff ff       	call   801d82 <nsipc>
+}
+  801fdd:	c9                   	leave
+  801fde:	c3                   	ret
+
+00801fdf <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801fdf:	55                   	push   %ebp
+  801fe0:	89 e5                	mov    %esp,%ebp
+  801fe2:	56                   	push   %esi
+  801fe3:	53                   	push   %ebx
+  801fe4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801fe7:	83 ec 0c             	sub    $0xc,%esp
+  801fea:	ff 75 08             	push   0x8(%ebp)
+  801fed:	e8 aa f3 ff ff       	call   80139c <fd2data>
+  801ff2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801ff4:	83 c4 08             	add    $0x8,%esp
+  801ff7:	68 9c 30 80 00       	push   $0x80309c
+  801ffc:	53                   	push   %ebx
+  801ffd:	e8 96 e7 ff ff       	call   800798 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802002:	8b 46 04             	mov    0x4(%esi),%eax
+  802005:	2b 06                	sub    (%esi),%eax
+  802007:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80200d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802014:	00 00 00 
+	stat->st_dev = &devpipe;
+  802017:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80201e:	40 80 00 
+	return 0;
+}
+  802021:	b8 00 00 00 00       	mov    $0x0,%eax
+  802026:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802029:	5b                   	pop    %ebx
+  80202a:	5e                   	pop    %esi
+  80202b:	5d                   	pop    %ebp
+  80202c:	c3                   	ret
+
+0080202d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80202d:	55                   	push   %ebp
+  80202e:	89 e5                	mov    %esp,%ebp
+  802030:	53                   	push   %ebx
+  802031:	83 ec 0c             	sub    $0xc,%esp
+  802034:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802037:	53                   	push   %ebx
+  802038:	6a 00                	push   $0x0
+  80203a:	e8 8e ec ff ff       	call   800ccd <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80203f:	89 1c 24             	mov    %ebx,(%esp)
+  802042:	e8 55 f3 ff ff       	call   80139c <fd2data>
+  802047:	83 c4 08             	add    $0x8,%esp
+  80204a:	50                   	push   %eax
+  80204b:	6a 00                	push   $0x0
+  80204d:	e8 7b ec ff ff       	call   800ccd <sys_page_unmap>
+}
+  802052:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802055:	c9                   	leave
+  802056:	c3                   	ret
+
+00802057 <_pipeisclosed>:
+{
+  802057:	55                   	push   %ebp
+  802058:	89 e5                	mov    %esp,%ebp
+  80205a:	57                   	push   %edi
+  80205b:	56                   	push   %esi
+  80205c:	53                   	push   %ebx
+  80205d:	83 ec 1c             	sub    $0x1c,%esp
+  802060:	89 c7                	mov    %eax,%edi
+  802062:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802064:	a1 08 50 80 00       	mov    0x805008,%eax
+  802069:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80206c:	83 ec 0c             	sub    $0xc,%esp
+  80206f:	57                   	push   %edi
+  802070:	e8 db 05 00 00       	call   802650 <pageref>
+  802075:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802078:	89 34 24             	mov    %esi,(%esp)
+  80207b:	e8 d0 05 00 00       	call   802650 <pageref>
+		nn = thisenv->env_runs;
+  802080:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802086:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	39 cb                	cmp    %ecx,%ebx
+  80208e:	74 1b                	je     8020ab <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802090:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802093:	75 cf                	jne    802064 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802095:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802098:	6a 01                	push   $0x1
+  80209a:	50                   	push   %eax
+  80209b:	53                   	push   %ebx
+  80209c:	68 a3 30 80 00       	push   $0x8030a3
+  8020a1:	e8 04 e1 ff ff       	call   8001aa <cprintf>
+  8020a6:	83 c4 10             	add    $0x10,%esp
+  8020a9:	eb b9                	jmp    802064 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8020ab:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020ae:	0f 94 c0             	sete   %al
+  8020b1:	0f b6 c0             	movzbl %al,%eax
+}
+  8020b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020b7:	5b                   	pop    %ebx
+  8020b8:	5e                   	pop    %esi
+  8020b9:	5f                   	pop    %edi
+  8020ba:	5d                   	pop    %ebp
+  8020bb:	c3                   	ret
+
+008020bc <devpipe_write>:
+{
+  8020bc:	55                   	push   %ebp
+  8020bd:	89 e5                	mov    %esp,%ebp
+  8020bf:	57                   	push   %edi
+  8020c0:	56                   	push   %esi
+  8020c1:	53                   	push   %ebx
+  8020c2:	83 ec 28             	sub    $0x28,%esp
+  8020c5:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8020c8:	56                   	push   %esi
+  8020c9:	e8 ce f2 ff ff       	call   80139c <fd2data>
+  8020ce:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8020d0:	83 c4 10             	add    $0x10,%esp
+  8020d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020d8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8020db:	75 09                	jne    8020e6 <devpipe_write+0x2a>
+	return i;
+  8020dd:	89 f8                	mov    %edi,%eax
+  8020df:	eb 23                	jmp    802104 <devpipe_write+0x48>
+			sys_yield();
+  8020e1:	e8 9f ea ff ff       	call   800b85 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8020e6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8020e9:	8b 0b                	mov    (%ebx),%ecx
+  8020eb:	8d 51 20             	lea    0x20(%ecx),%edx
+  8020ee:	39 d0                	cmp    %edx,%eax
+  8020f0:	72 1a                	jb     80210c <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8020f2:	89 da                	mov    %ebx,%edx
+  8020f4:	89 f0                	mov    %esi,%eax
+  8020f6:	e8 5c ff ff ff       	call   802057 <_pipeisclosed>
+  8020fb:	85 c0                	test   %eax,%eax
+  8020fd:	74 e2                	je     8020e1 <devpipe_write+0x25>
+				return 0;
+  8020ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802104:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802107:	5b                   	pop    %ebx
+  802108:	5e                   	pop    %esi
+  802109:	5f                   	pop    %edi
+  80210a:	5d                   	pop    %ebp
+  80210b:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80210c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80210f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802113:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802116:	89 c2                	mov    %eax,%edx
+  802118:	c1 fa 1f             	sar    $0x1f,%edx
+  80211b:	89 d1                	mov    %edx,%ecx
+  80211d:	c1 e9 1b             	shr    $0x1b,%ecx
+  802120:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802123:	83 e2 1f             	and    $0x1f,%edx
+  802126:	29 ca                	sub    %ecx,%edx
+  802128:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80212c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802130:	83 c0 01             	add    $0x1,%eax
+  802133:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802136:	83 c7 01             	add    $0x1,%edi
+  802139:	eb 9d                	jmp    8020d8 <devpipe_write+0x1c>
+
+0080213b <devpipe_read>:
+{
+  80213b:	55                   	push   %ebp
+  80213c:	89 e5                	mov    %esp,%ebp
+  80213e:	57                   	push   %edi
+  80213f:	56                   	push   %esi
+  802140:	53                   	push   %ebx
+  802141:	83 ec 18             	sub    $0x18,%esp
+  802144:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802147:	57                   	push   %edi
+  802148:	e8 4f f2 ff ff       	call   80139c <fd2data>
+  80214d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80214f:	83 c4 10             	add    $0x10,%esp
+  802152:	be 00 00 00 00       	mov    $0x0,%esi
+  802157:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80215a:	75 13                	jne    80216f <devpipe_read+0x34>
+	return i;
+  80215c:	89 f0                	mov    %esi,%eax
+  80215e:	eb 02                	jmp    802162 <devpipe_read+0x27>
+				return i;
+  802160:	89 f0                	mov    %esi,%eax
+}
+  802162:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802165:	5b                   	pop    %ebx
+  802166:	5e                   	pop    %esi
+  802167:	5f                   	pop    %edi
+  802168:	5d                   	pop    %ebp
+  802169:	c3                   	ret
+			sys_yield();
+  80216a:	e8 16 ea ff ff       	call   800b85 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80216f:	8b 03                	mov    (%ebx),%eax
+  802171:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802174:	75 18                	jne    80218e <devpipe_read+0x53>
+			if (i > 0)
+  802176:	85 f6                	test   %esi,%esi
+  802178:	75 e6                	jne    802160 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80217a:	89 da                	mov    %ebx,%edx
+  80217c:	89 f8                	mov    %edi,%eax
+  80217e:	e8 d4 fe ff ff       	call   802057 <_pipeisclosed>
+  802183:	85 c0                	test   %eax,%eax
+  802185:	74 e3                	je     80216a <devpipe_read+0x2f>
+				return 0;
+  802187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80218c:	eb d4                	jmp    802162 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80218e:	99                   	cltd
+  80218f:	c1 ea 1b             	shr    $0x1b,%edx
+  802192:	01 d0                	add    %edx,%eax
+  802194:	83 e0 1f             	and    $0x1f,%eax
+  802197:	29 d0                	sub    %edx,%eax
+  802199:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80219e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021a1:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8021a4:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8021a7:	83 c6 01             	add    $0x1,%esi
+  8021aa:	eb ab                	jmp    802157 <devpipe_read+0x1c>
+
+008021ac <pipe>:
+{
+  8021ac:	55                   	push   %ebp
+  8021ad:	89 e5                	mov    %esp,%ebp
+  8021af:	56                   	push   %esi
+  8021b0:	53                   	push   %ebx
+  8021b1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8021b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b7:	50                   	push   %eax
+  8021b8:	e8 f6 f1 ff ff       	call   8013b3 <fd_alloc>
+  8021bd:	89 c3                	mov    %eax,%ebx
+  8021bf:	83 c4 10             	add    $0x10,%esp
+  8021c2:	85 c0                	test   %eax,%eax
+  8021c4:	0f 88 23 01 00 00    	js     8022ed <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021ca:	83 ec 04             	sub    $0x4,%esp
+  8021cd:	68 07 04 00 00       	push   $0x407
+  8021d2:	ff 75 f4             	push   -0xc(%ebp)
+  8021d5:	6a 00                	push   $0x0
+  8021d7:	e8 29 ea ff ff       	call   800c05 <sys_page_alloc>
+  8021dc:	89 c3                	mov    %eax,%ebx
+  8021de:	83 c4 10             	add    $0x10,%esp
+  8021e1:	85 c0                	test   %eax,%eax
+  8021e3:	0f 88 04 01 00 00    	js     8022ed <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8021e9:	83 ec 0c             	sub    $0xc,%esp
+  8021ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021ef:	50                   	push   %eax
+  8021f0:	e8 be f1 ff ff       	call   8013b3 <fd_alloc>
+  8021f5:	89 c3                	mov    %eax,%ebx
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	85 c0                	test   %eax,%eax
+  8021fc:	0f 88 db 00 00 00    	js     8022dd <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802202:	83 ec 04             	sub    $0x4,%esp
+  802205:	68 07 04 00 00       	push   $0x407
+  80220a:	ff 75 f0             	push   -0x10(%ebp)
+  80220d:	6a 00                	push   $0x0
+  80220f:	e8 f1 e9 ff ff       	call   800c05 <sys_page_alloc>
+  802214:	89 c3                	mov    %eax,%ebx
+  802216:	83 c4 10             	add    $0x10,%esp
+  802219:	85 c0                	test   %eax,%eax
+  80221b:	0f 88 bc 00 00 00    	js     8022dd <pipe+0x131>
+	va = fd2data(fd0);
+  802221:	83 ec 0c             	sub    $0xc,%esp
+  802224:	ff 75 f4             	push   -0xc(%ebp)
+  802227:	e8 70 f1 ff ff       	call   80139c <fd2data>
+  80222c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80222e:	83 c4 0c             	add    $0xc,%esp
+  802231:	68 07 04 00 00       	push   $0x407
+  802236:	50                   	push   %eax
+  802237:	6a 00                	push   $0x0
+  802239:	e8 c7 e9 ff ff       	call   800c05 <sys_page_alloc>
+  80223e:	89 c3                	mov    %eax,%ebx
+  802240:	83 c4 10             	add    $0x10,%esp
+  802243:	85 c0                	test   %eax,%eax
+  802245:	0f 88 82 00 00 00    	js     8022cd <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80224b:	83 ec 0c             	sub    $0xc,%esp
+  80224e:	ff 75 f0             	push   -0x10(%ebp)
+  802251:	e8 46 f1 ff ff       	call   80139c <fd2data>
+  802256:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80225d:	50                   	push   %eax
+  80225e:	6a 00                	push   $0x0
+  802260:	56                   	push   %esi
+  802261:	6a 00                	push   $0x0
+  802263:	e8 23 ea ff ff       	call   800c8b <sys_page_map>
+  802268:	89 c3                	mov    %eax,%ebx
+  80226a:	83 c4 20             	add    $0x20,%esp
+  80226d:	85 c0                	test   %eax,%eax
+  80226f:	78 4e                	js     8022bf <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802271:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802276:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802279:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80227b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80227e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802285:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802288:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80228a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80228d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802294:	83 ec 0c             	sub    $0xc,%esp
+  802297:	ff 75 f4             	push   -0xc(%ebp)
+  80229a:	e8 ed f0 ff ff       	call   80138c <fd2num>
+  80229f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022a2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8022a4:	83 c4 04             	add    $0x4,%esp
+  8022a7:	ff 75 f0             	push   -0x10(%ebp)
+  8022aa:	e8 dd f0 ff ff       	call   80138c <fd2num>
+  8022af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022b2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022bd:	eb 2e                	jmp    8022ed <pipe+0x141>
+	sys_page_unmap(0, va);
+  8022bf:	83 ec 08             	sub    $0x8,%esp
+  8022c2:	56                   	push   %esi
+  8022c3:	6a 00                	push   $0x0
+  8022c5:	e8 03 ea ff ff       	call   800ccd <sys_page_unmap>
+  8022ca:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8022cd:	83 ec 08             	sub    $0x8,%esp
+  8022d0:	ff 75 f0             	push   -0x10(%ebp)
+  8022d3:	6a 00                	push   $0x0
+  8022d5:	e8 f3 e9 ff ff       	call   800ccd <sys_page_unmap>
+  8022da:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8022dd:	83 ec 08             	sub    $0x8,%esp
+  8022e0:	ff 75 f4             	push   -0xc(%ebp)
+  8022e3:	6a 00                	push   $0x0
+  8022e5:	e8 e3 e9 ff ff       	call   800ccd <sys_page_unmap>
+  8022ea:	83 c4 10             	add    $0x10,%esp
+}
+  8022ed:	89 d8                	mov    %ebx,%eax
+  8022ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022f2:	5b                   	pop    %ebx
+  8022f3:	5e                   	pop    %esi
+  8022f4:	5d                   	pop    %ebp
+  8022f5:	c3                   	ret
+
+008022f6 <pipeisclosed>:
+{
+  8022f6:	55                   	push   %ebp
+  8022f7:	89 e5                	mov    %esp,%ebp
+  8022f9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ff:	50                   	push   %eax
+  802300:	ff 75 08             	push   0x8(%ebp)
+  802303:	e8 01 f1 ff ff       	call   801409 <fd_lookup>
+  802308:	83 c4 10             	add    $0x10,%esp
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	78 18                	js     802327 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80230f:	83 ec 0c             	sub    $0xc,%esp
+  802312:	ff 75 f4             	push   -0xc(%ebp)
+  802315:	e8 82 f0 ff ff       	call   80139c <fd2data>
+  80231a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80231c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80231f:	e8 33 fd ff ff       	call   802057 <_pipeisclosed>
+  802324:	83 c4 10             	add    $0x10,%esp
+}
+  802327:	c9                   	leave
+  802328:	c3                   	ret
+
+00802329 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802329:	b8 00 00 00 00       	mov    $0x0,%eax
+  80232e:	c3                   	ret
+
+0080232f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80232f:	55                   	push   %ebp
+  802330:	89 e5                	mov    %esp,%ebp
+  802332:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802335:	68 bb 30 80 00       	push   $0x8030bb
+  80233a:	ff 75 0c             	push   0xc(%ebp)
+  80233d:	e8 56 e4 ff ff       	call   800798 <strcpy>
+	return 0;
+}
+  802342:	b8 00 00 00 00       	mov    $0x0,%eax
+  802347:	c9                   	leave
+  802348:	c3                   	ret
+
+00802349 <devcons_write>:
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	57                   	push   %edi
+  80234d:	56                   	push   %esi
+  80234e:	53                   	push   %ebx
+  80234f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802355:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80235a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802360:	eb 2e                	jmp    802390 <devcons_write+0x47>
+		m = n - tot;
+  802362:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802365:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802367:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80236c:	39 c3                	cmp    %eax,%ebx
+  80236e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802371:	83 ec 04             	sub    $0x4,%esp
+  802374:	53                   	push   %ebx
+  802375:	89 f0                	mov    %esi,%eax
+  802377:	03 45 0c             	add    0xc(%ebp),%eax
+  80237a:	50                   	push   %eax
+  80237b:	57                   	push   %edi
+  80237c:	e8 9d e5 ff ff       	call   80091e <memmove>
+		sys_cputs(buf, m);
+  802381:	83 c4 08             	add    $0x8,%esp
+  802384:	53                   	push   %ebx
+  802385:	57                   	push   %edi
+  802386:	e8 3d e7 ff ff       	call   800ac8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80238b:	01 de                	add    %ebx,%esi
+  80238d:	83 c4 10             	add    $0x10,%esp
+  802390:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802393:	72 cd                	jb     802362 <devcons_write+0x19>
+}
+  802395:	89 f0                	mov    %esi,%eax
+  802397:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80239a:	5b                   	pop    %ebx
+  80239b:	5e                   	pop    %esi
+  80239c:	5f                   	pop    %edi
+  80239d:	5d                   	pop    %ebp
+  80239e:	c3                   	ret
+
+0080239f <devcons_read>:
+{
+  80239f:	55                   	push   %ebp
+  8023a0:	89 e5                	mov    %esp,%ebp
+  8023a2:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8023a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023aa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8023ae:	75 07                	jne    8023b7 <devcons_read+0x18>
+  8023b0:	eb 1f                	jmp    8023d1 <devcons_read+0x32>
+		sys_yield();
+  8023b2:	e8 ce e7 ff ff       	call   800b85 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8023b7:	e8 2a e7 ff ff       	call   800ae6 <sys_cgetc>
+  8023bc:	85 c0                	test   %eax,%eax
+  8023be:	74 f2                	je     8023b2 <devcons_read+0x13>
+	if (c < 0)
+  8023c0:	78 0f                	js     8023d1 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8023c2:	83 f8 04             	cmp    $0x4,%eax
+  8023c5:	74 0c                	je     8023d3 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8023c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023ca:	88 02                	mov    %al,(%edx)
+	return 1;
+  8023cc:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8023d1:	c9                   	leave
+  8023d2:	c3                   	ret
+		return 0;
+  8023d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d8:	eb f7                	jmp    8023d1 <devcons_read+0x32>
+
+008023da <cputchar>:
+{
+  8023da:	55                   	push   %ebp
+  8023db:	89 e5                	mov    %esp,%ebp
+  8023dd:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8023e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e3:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8023e6:	6a 01                	push   $0x1
+  8023e8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8023eb:	50                   	push   %eax
+  8023ec:	e8 d7 e6 ff ff       	call   800ac8 <sys_cputs>
+}
+  8023f1:	83 c4 10             	add    $0x10,%esp
+  8023f4:	c9                   	leave
+  8023f5:	c3                   	ret
+
+008023f6 <getchar>:
+{
+  8023f6:	55                   	push   %ebp
+  8023f7:	89 e5                	mov    %esp,%ebp
+  8023f9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8023fc:	6a 01                	push   $0x1
+  8023fe:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802401:	50                   	push   %eax
+  802402:	6a 00                	push   $0x0
+  802404:	e8 66 f2 ff ff       	call   80166f <read>
+	if (r < 0)
+  802409:	83 c4 10             	add    $0x10,%esp
+  80240c:	85 c0                	test   %eax,%eax
+  80240e:	78 06                	js     802416 <getchar+0x20>
+	if (r < 1)
+  802410:	74 06                	je     802418 <getchar+0x22>
+	return c;
+  802412:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802416:	c9                   	leave
+  802417:	c3                   	ret
+		return -E_EOF;
+  802418:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80241d:	eb f7                	jmp    802416 <getchar+0x20>
+
+0080241f <iscons>:
+{
+  80241f:	55                   	push   %ebp
+  802420:	89 e5                	mov    %esp,%ebp
+  802422:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802425:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802428:	50                   	push   %eax
+  802429:	ff 75 08             	push   0x8(%ebp)
+  80242c:	e8 d8 ef ff ff       	call   801409 <fd_lookup>
+  802431:	83 c4 10             	add    $0x10,%esp
+  802434:	85 c0                	test   %eax,%eax
+  802436:	78 11                	js     802449 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802438:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80243b:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802441:	39 10                	cmp    %edx,(%eax)
+  802443:	0f 94 c0             	sete   %al
+  802446:	0f b6 c0             	movzbl %al,%eax
+}
+  802449:	c9                   	leave
+  80244a:	c3                   	ret
+
+0080244b <opencons>:
+{
+  80244b:	55                   	push   %ebp
+  80244c:	89 e5                	mov    %esp,%ebp
+  80244e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802451:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802454:	50                   	push   %eax
+  802455:	e8 59 ef ff ff       	call   8013b3 <fd_alloc>
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	78 3a                	js     80249b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802461:	83 ec 04             	sub    $0x4,%esp
+  802464:	68 07 04 00 00       	push   $0x407
+  802469:	ff 75 f4             	push   -0xc(%ebp)
+  80246c:	6a 00                	push   $0x0
+  80246e:	e8 92 e7 ff ff       	call   800c05 <sys_page_alloc>
+  802473:	83 c4 10             	add    $0x10,%esp
+  802476:	85 c0                	test   %eax,%eax
+  802478:	78 21                	js     80249b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80247a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80247d:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802483:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802485:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802488:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80248f:	83 ec 0c             	sub    $0xc,%esp
+  802492:	50                   	push   %eax
+  802493:	e8 f4 ee ff ff       	call   80138c <fd2num>
+  802498:	83 c4 10             	add    $0x10,%esp
+}
+  80249b:	c9                   	leave
+  80249c:	c3                   	ret
+
+0080249d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80249d:	55                   	push   %ebp
+  80249e:	89 e5                	mov    %esp,%ebp
+  8024a0:	56                   	push   %esi
+  8024a1:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8024a2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8024a5:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8024ab:	e8 b6 e6 ff ff       	call   800b66 <sys_getenvid>
+  8024b0:	83 ec 0c             	sub    $0xc,%esp
+  8024b3:	ff 75 0c             	push   0xc(%ebp)
+  8024b6:	ff 75 08             	push   0x8(%ebp)
+  8024b9:	56                   	push   %esi
+  8024ba:	50                   	push   %eax
+  8024bb:	68 c8 30 80 00       	push   $0x8030c8
+  8024c0:	e8 e5 dc ff ff       	call   8001aa <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8024c5:	83 c4 18             	add    $0x18,%esp
+  8024c8:	53                   	push   %ebx
+  8024c9:	ff 75 10             	push   0x10(%ebp)
+  8024cc:	e8 88 dc ff ff       	call   800159 <vcprintf>
+	cprintf("\n");
+  8024d1:	c7 04 24 74 2b 80 00 	movl   $0x802b74,(%esp)
+  8024d8:	e8 cd dc ff ff       	call   8001aa <cprintf>
+  8024dd:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8024e0:	cc                   	int3
+	while (1)
+  8024e1:	eb fd                	jmp    8024e0 <_panic+0x43>
+
+008024e3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8024e3:	55                   	push   %ebp
+  8024e4:	89 e5                	mov    %esp,%ebp
+  8024e6:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8024e9:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8024f0:	74 0a                	je     8024fc <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8024f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f5:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8024fa:	c9                   	leave
+  8024fb:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  8024fc:	83 ec 04             	sub    $0x4,%esp
+  8024ff:	6a 07                	push   $0x7
+  802501:	68 00 f0 bf ee       	push   $0xeebff000
+  802506:	6a 00                	push   $0x0
+  802508:	e8 f8 e6 ff ff       	call   800c05 <sys_page_alloc>
+  80250d:	83 c4 10             	add    $0x10,%esp
+  802510:	85 c0                	test   %eax,%eax
+  802512:	78 28                	js     80253c <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802514:	83 ec 08             	sub    $0x8,%esp
+  802517:	68 4e 25 80 00       	push   $0x80254e
+  80251c:	6a 00                	push   $0x0
+  80251e:	e8 dd e9 ff ff       	call   800f00 <sys_env_set_pgfault_upcall>
+  802523:	83 c4 10             	add    $0x10,%esp
+  802526:	85 c0                	test   %eax,%eax
+  802528:	79 c8                	jns    8024f2 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  80252a:	50                   	push   %eax
+  80252b:	68 f9 30 80 00       	push   $0x8030f9
+  802530:	6a 24                	push   $0x24
+  802532:	68 eb 30 80 00       	push   $0x8030eb
+  802537:	e8 61 ff ff ff       	call   80249d <_panic>
+			panic("sys_page_alloc: %e", r);
+  80253c:	50                   	push   %eax
+  80253d:	68 c6 2e 80 00       	push   $0x802ec6
+  802542:	6a 21                	push   $0x21
+  802544:	68 eb 30 80 00       	push   $0x8030eb
+  802549:	e8 4f ff ff ff       	call   80249d <_panic>
+
+0080254e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80254e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80254f:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802554:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802556:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802559:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  80255c:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  802560:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  802563:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  802567:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  80256b:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  80256d:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80256e:	83 c4 04             	add    $0x4,%esp
+	popf
+  802571:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802572:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802573:	c3                   	ret
+
+00802574 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802574:	55                   	push   %ebp
+  802575:	89 e5                	mov    %esp,%ebp
+  802577:	57                   	push   %edi
+  802578:	56                   	push   %esi
+  802579:	53                   	push   %ebx
+  80257a:	83 ec 18             	sub    $0x18,%esp
+  80257d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802580:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802583:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802586:	85 db                	test   %ebx,%ebx
+  802588:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80258d:	0f 45 c3             	cmovne %ebx,%eax
+  802590:	50                   	push   %eax
+  802591:	e8 f2 e9 ff ff       	call   800f88 <sys_ipc_recv>
+
+	if (from_env_store)
+  802596:	83 c4 10             	add    $0x10,%esp
+  802599:	85 ff                	test   %edi,%edi
+  80259b:	74 17                	je     8025b4 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80259d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a2:	85 c0                	test   %eax,%eax
+  8025a4:	75 0c                	jne    8025b2 <ipc_recv+0x3e>
+  8025a6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8025ac:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8025b2:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8025b4:	85 f6                	test   %esi,%esi
+  8025b6:	74 2e                	je     8025e6 <ipc_recv+0x72>
+		if (!r && pg)
+  8025b8:	85 c0                	test   %eax,%eax
+  8025ba:	75 24                	jne    8025e0 <ipc_recv+0x6c>
+  8025bc:	85 db                	test   %ebx,%ebx
+  8025be:	74 20                	je     8025e0 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8025c0:	a1 08 50 80 00       	mov    0x805008,%eax
+  8025c5:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8025cb:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8025cd:	a1 08 50 80 00       	mov    0x805008,%eax
+  8025d2:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  8025d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025db:	5b                   	pop    %ebx
+  8025dc:	5e                   	pop    %esi
+  8025dd:	5f                   	pop    %edi
+  8025de:	5d                   	pop    %ebp
+  8025df:	c3                   	ret
+			*perm_store = 0;
+  8025e0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  8025e6:	85 c0                	test   %eax,%eax
+  8025e8:	75 ee                	jne    8025d8 <ipc_recv+0x64>
+  8025ea:	eb e1                	jmp    8025cd <ipc_recv+0x59>
+
+008025ec <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8025ec:	55                   	push   %ebp
+  8025ed:	89 e5                	mov    %esp,%ebp
+  8025ef:	57                   	push   %edi
+  8025f0:	56                   	push   %esi
+  8025f1:	53                   	push   %ebx
+  8025f2:	83 ec 0c             	sub    $0xc,%esp
+  8025f5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8025fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8025fe:	85 db                	test   %ebx,%ebx
+  802600:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802605:	0f 44 d8             	cmove  %eax,%ebx
+  802608:	ff 75 14             	push   0x14(%ebp)
+  80260b:	53                   	push   %ebx
+  80260c:	56                   	push   %esi
+  80260d:	57                   	push   %edi
+  80260e:	e8 52 e9 ff ff       	call   800f65 <sys_ipc_try_send_yield>
+  802613:	83 c4 10             	add    $0x10,%esp
+  802616:	85 c0                	test   %eax,%eax
+  802618:	79 1e                	jns    802638 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80261a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80261d:	75 07                	jne    802626 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80261f:	e8 61 e5 ff ff       	call   800b85 <sys_yield>
+  802624:	eb e2                	jmp    802608 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802626:	50                   	push   %eax
+  802627:	68 17 31 80 00       	push   $0x803117
+  80262c:	6a 3d                	push   $0x3d
+  80262e:	68 2c 31 80 00       	push   $0x80312c
+  802633:	e8 65 fe ff ff       	call   80249d <_panic>
+	}
+}
+  802638:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80263b:	5b                   	pop    %ebx
+  80263c:	5e                   	pop    %esi
+  80263d:	5f                   	pop    %edi
+  80263e:	5d                   	pop    %ebp
+  80263f:	c3                   	ret
+
+00802640 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802640:	55                   	push   %ebp
+  802641:	89 e5                	mov    %esp,%ebp
+  802643:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802646:	ff 75 08             	push   0x8(%ebp)
+  802649:	e8 b7 e4 ff ff       	call   800b05 <sys_env_find>
+}
+  80264e:	c9                   	leave
+  80264f:	c3                   	ret
+
+00802650 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802650:	55                   	push   %ebp
+  802651:	89 e5                	mov    %esp,%ebp
+  802653:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802656:	89 c2                	mov    %eax,%edx
+  802658:	c1 ea 16             	shr    $0x16,%edx
+  80265b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802662:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802667:	f6 c1 01             	test   $0x1,%cl
+  80266a:	74 22                	je     80268e <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80266c:	c1 e8 0c             	shr    $0xc,%eax
+  80266f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802676:	a8 01                	test   $0x1,%al
+  802678:	74 14                	je     80268e <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80267a:	c1 e8 0c             	shr    $0xc,%eax
+  80267d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802680:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802687:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80268b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80268e:	89 d0                	mov    %edx,%eax
+  802690:	5d                   	pop    %ebp
+  802691:	c3                   	ret
+  802692:	66 90                	xchg   %ax,%ax
+  802694:	66 90                	xchg   %ax,%ax
+  802696:	66 90                	xchg   %ax,%ax
+  802698:	66 90                	xchg   %ax,%ax
+  80269a:	66 90                	xchg   %ax,%ax
+  80269c:	66 90                	xchg   %ax,%ax
+  80269e:	66 90                	xchg   %ax,%ax
+
+008026a0 <__udivmoddi4>:
+  8026a0:	55                   	push   %ebp
+  8026a1:	57                   	push   %edi
+  8026a2:	56                   	push   %esi
+  8026a3:	53                   	push   %ebx
+  8026a4:	83 ec 14             	sub    $0x14,%esp
+  8026a7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8026ab:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8026af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026b7:	89 f1                	mov    %esi,%ecx
+  8026b9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8026bd:	09 d9                	or     %ebx,%ecx
+  8026bf:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8026c3:	0f 84 92 00 00 00    	je     80275b <__udivmoddi4+0xbb>
+  8026c9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8026d0:	00 
+  8026d1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8026d6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8026dd:	00 
+  8026de:	89 1c 24             	mov    %ebx,(%esp)
+  8026e1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8026e5:	8d 76 00             	lea    0x0(%esi),%esi
+  8026e8:	89 e9                	mov    %ebp,%ecx
+  8026ea:	89 c3                	mov    %eax,%ebx
+  8026ec:	89 d6                	mov    %edx,%esi
+  8026ee:	31 ff                	xor    %edi,%edi
+  8026f0:	d3 ee                	shr    %cl,%esi
+  8026f2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8026f5:	f6 c1 20             	test   $0x20,%cl
+  8026f8:	0f 45 de             	cmovne %esi,%ebx
+  8026fb:	0f 45 f7             	cmovne %edi,%esi
+  8026fe:	8b 3c 24             	mov    (%esp),%edi
+  802701:	39 fb                	cmp    %edi,%ebx
+  802703:	89 f7                	mov    %esi,%edi
+  802705:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802709:	8b 1c 24             	mov    (%esp),%ebx
+  80270c:	19 f7                	sbb    %esi,%edi
+  80270e:	72 39                	jb     802749 <__udivmoddi4+0xa9>
+  802710:	89 e9                	mov    %ebp,%ecx
+  802712:	89 f7                	mov    %esi,%edi
+  802714:	89 de                	mov    %ebx,%esi
+  802716:	0f a5 df             	shld   %cl,%ebx,%edi
+  802719:	d3 e6                	shl    %cl,%esi
+  80271b:	31 db                	xor    %ebx,%ebx
+  80271d:	f6 c1 20             	test   $0x20,%cl
+  802720:	0f 45 fe             	cmovne %esi,%edi
+  802723:	0f 45 f3             	cmovne %ebx,%esi
+  802726:	29 f0                	sub    %esi,%eax
+  802728:	be 01 00 00 00       	mov    $0x1,%esi
+  80272d:	19 fa                	sbb    %edi,%edx
+  80272f:	31 ff                	xor    %edi,%edi
+  802731:	31 db                	xor    %ebx,%ebx
+  802733:	0f a5 f7             	shld   %cl,%esi,%edi
+  802736:	d3 e6                	shl    %cl,%esi
+  802738:	f6 c1 20             	test   $0x20,%cl
+  80273b:	0f 45 fe             	cmovne %esi,%edi
+  80273e:	0f 45 f3             	cmovne %ebx,%esi
+  802741:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802745:	09 74 24 08          	or     %esi,0x8(%esp)
+  802749:	83 ed 01             	sub    $0x1,%ebp
+  80274c:	73 9a                	jae    8026e8 <__udivmoddi4+0x48>
+  80274e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802752:	85 ff                	test   %edi,%edi
+  802754:	74 05                	je     80275b <__udivmoddi4+0xbb>
+  802756:	89 07                	mov    %eax,(%edi)
+  802758:	89 57 04             	mov    %edx,0x4(%edi)
+  80275b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80275f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802763:	83 c4 14             	add    $0x14,%esp
+  802766:	5b                   	pop    %ebx
+  802767:	5e                   	pop    %esi
+  802768:	5f                   	pop    %edi
+  802769:	5d                   	pop    %ebp
+  80276a:	c3                   	ret
+  80276b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80276f:	90                   	nop
+
+00802770 <__udivdi3>:
+  802770:	55                   	push   %ebp
+  802771:	57                   	push   %edi
+  802772:	56                   	push   %esi
+  802773:	53                   	push   %ebx
+  802774:	83 ec 14             	sub    $0x14,%esp
+  802777:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80277b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80277f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802783:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802787:	89 fb                	mov    %edi,%ebx
+  802789:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80278d:	09 f3                	or     %esi,%ebx
+  80278f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802793:	0f 84 85 00 00 00    	je     80281e <__udivdi3+0xae>
+  802799:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027a0:	00 
+  8027a1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8027a6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027ad:	00 
+  8027ae:	89 34 24             	mov    %esi,(%esp)
+  8027b1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8027b5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027b8:	89 e9                	mov    %ebp,%ecx
+  8027ba:	89 c3                	mov    %eax,%ebx
+  8027bc:	89 d6                	mov    %edx,%esi
+  8027be:	31 ff                	xor    %edi,%edi
+  8027c0:	d3 ee                	shr    %cl,%esi
+  8027c2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8027c5:	f6 c1 20             	test   $0x20,%cl
+  8027c8:	0f 45 de             	cmovne %esi,%ebx
+  8027cb:	0f 45 f7             	cmovne %edi,%esi
+  8027ce:	8b 3c 24             	mov    (%esp),%edi
+  8027d1:	39 fb                	cmp    %edi,%ebx
+  8027d3:	89 f7                	mov    %esi,%edi
+  8027d5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8027d9:	8b 1c 24             	mov    (%esp),%ebx
+  8027dc:	19 f7                	sbb    %esi,%edi
+  8027de:	72 39                	jb     802819 <__udivdi3+0xa9>
+  8027e0:	89 e9                	mov    %ebp,%ecx
+  8027e2:	89 f7                	mov    %esi,%edi
+  8027e4:	89 de                	mov    %ebx,%esi
+  8027e6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8027e9:	d3 e6                	shl    %cl,%esi
+  8027eb:	31 db                	xor    %ebx,%ebx
+  8027ed:	f6 c1 20             	test   $0x20,%cl
+  8027f0:	0f 45 fe             	cmovne %esi,%edi
+  8027f3:	0f 45 f3             	cmovne %ebx,%esi
+  8027f6:	29 f0                	sub    %esi,%eax
+  8027f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8027fd:	19 fa                	sbb    %edi,%edx
+  8027ff:	31 ff                	xor    %edi,%edi
+  802801:	31 db                	xor    %ebx,%ebx
+  802803:	0f a5 f7             	shld   %cl,%esi,%edi
+  802806:	d3 e6                	shl    %cl,%esi
+  802808:	f6 c1 20             	test   $0x20,%cl
+  80280b:	0f 45 fe             	cmovne %esi,%edi
+  80280e:	0f 45 f3             	cmovne %ebx,%esi
+  802811:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802815:	09 74 24 08          	or     %esi,0x8(%esp)
+  802819:	83 ed 01             	sub    $0x1,%ebp
+  80281c:	73 9a                	jae    8027b8 <__udivdi3+0x48>
+  80281e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802822:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802826:	83 c4 14             	add    $0x14,%esp
+  802829:	5b                   	pop    %ebx
+  80282a:	5e                   	pop    %esi
+  80282b:	5f                   	pop    %edi
+  80282c:	5d                   	pop    %ebp
+  80282d:	c3                   	ret
+  80282e:	66 90                	xchg   %ax,%ax
+
+00802830 <__umoddi3>:
+  802830:	57                   	push   %edi
+  802831:	56                   	push   %esi
+  802832:	53                   	push   %ebx
+  802833:	83 ec 08             	sub    $0x8,%esp
+  802836:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80283a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80283e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802842:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802846:	89 f9                	mov    %edi,%ecx
+  802848:	89 34 24             	mov    %esi,(%esp)
+  80284b:	09 f1                	or     %esi,%ecx
+  80284d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802851:	74 53                	je     8028a6 <__umoddi3+0x76>
+  802853:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80285f:	90                   	nop
+  802860:	89 c6                	mov    %eax,%esi
+  802862:	89 d7                	mov    %edx,%edi
+  802864:	31 db                	xor    %ebx,%ebx
+  802866:	d3 ef                	shr    %cl,%edi
+  802868:	0f ad d6             	shrd   %cl,%edx,%esi
+  80286b:	f6 c1 20             	test   $0x20,%cl
+  80286e:	0f 45 f7             	cmovne %edi,%esi
+  802871:	0f 45 fb             	cmovne %ebx,%edi
+  802874:	8b 1c 24             	mov    (%esp),%ebx
+  802877:	39 de                	cmp    %ebx,%esi
+  802879:	89 fb                	mov    %edi,%ebx
+  80287b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80287f:	8b 34 24             	mov    (%esp),%esi
+  802882:	19 fb                	sbb    %edi,%ebx
+  802884:	72 14                	jb     80289a <__umoddi3+0x6a>
+  802886:	0f a5 f7             	shld   %cl,%esi,%edi
+  802889:	31 db                	xor    %ebx,%ebx
+  80288b:	d3 e6                	shl    %cl,%esi
+  80288d:	f6 c1 20             	test   $0x20,%cl
+  802890:	0f 45 fe             	cmovne %esi,%edi
+  802893:	0f 45 f3             	cmovne %ebx,%esi
+  802896:	29 f0                	sub    %esi,%eax
+  802898:	19 fa                	sbb    %edi,%edx
+  80289a:	83 e9 01             	sub    $0x1,%ecx
+  80289d:	73 c1                	jae    802860 <__umoddi3+0x30>
+  80289f:	83 c4 08             	add    $0x8,%esp
+  8028a2:	5b                   	pop    %ebx
+  8028a3:	5e                   	pop    %esi
+  8028a4:	5f                   	pop    %edi
+  8028a5:	c3                   	ret
+  8028a6:	83 c4 08             	add    $0x8,%esp
+  8028a9:	31 c0                	xor    %eax,%eax
+  8028ab:	31 d2                	xor    %edx,%edx
+  8028ad:	5b                   	pop    %ebx
+  8028ae:	5e                   	pop    %esi
+  8028af:	5f                   	pop    %edi
+  8028b0:	c3                   	ret
+  8028b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028bf:	90                   	nop
+
+008028c0 <__divdi3>:
+  8028c0:	55                   	push   %ebp
+  8028c1:	57                   	push   %edi
+  8028c2:	56                   	push   %esi
+  8028c3:	53                   	push   %ebx
+  8028c4:	83 ec 1c             	sub    $0x1c,%esp
+  8028c7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8028cb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8028cf:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8028d3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8028d7:	85 ff                	test   %edi,%edi
+  8028d9:	0f 88 da 00 00 00    	js     8029b9 <__divdi3+0xf9>
+  8028df:	85 db                	test   %ebx,%ebx
+  8028e1:	78 16                	js     8028f9 <__divdi3+0x39>
+  8028e3:	89 dd                	mov    %ebx,%ebp
+  8028e5:	89 c8                	mov    %ecx,%eax
+  8028e7:	89 da                	mov    %ebx,%edx
+  8028e9:	09 cd                	or     %ecx,%ebp
+  8028eb:	0f 85 fd 00 00 00    	jne    8029ee <__divdi3+0x12e>
+  8028f1:	83 c4 1c             	add    $0x1c,%esp
+  8028f4:	5b                   	pop    %ebx
+  8028f5:	5e                   	pop    %esi
+  8028f6:	5f                   	pop    %edi
+  8028f7:	5d                   	pop    %ebp
+  8028f8:	c3                   	ret
+  8028f9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8028fe:	f7 d9                	neg    %ecx
+  802900:	89 f0                	mov    %esi,%eax
+  802902:	89 fa                	mov    %edi,%edx
+  802904:	83 d3 00             	adc    $0x0,%ebx
+  802907:	89 0c 24             	mov    %ecx,(%esp)
+  80290a:	f7 db                	neg    %ebx
+  80290c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802910:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802917:	00 
+  802918:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80291d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802924:	00 
+  802925:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802929:	89 cd                	mov    %ecx,%ebp
+  80292b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80292f:	90                   	nop
+  802930:	89 e9                	mov    %ebp,%ecx
+  802932:	89 c3                	mov    %eax,%ebx
+  802934:	89 d6                	mov    %edx,%esi
+  802936:	31 ff                	xor    %edi,%edi
+  802938:	d3 ee                	shr    %cl,%esi
+  80293a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80293d:	f6 c1 20             	test   $0x20,%cl
+  802940:	0f 45 de             	cmovne %esi,%ebx
+  802943:	0f 45 f7             	cmovne %edi,%esi
+  802946:	8b 3c 24             	mov    (%esp),%edi
+  802949:	39 fb                	cmp    %edi,%ebx
+  80294b:	89 f7                	mov    %esi,%edi
+  80294d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802951:	8b 1c 24             	mov    (%esp),%ebx
+  802954:	19 f7                	sbb    %esi,%edi
+  802956:	72 39                	jb     802991 <__divdi3+0xd1>
+  802958:	89 e9                	mov    %ebp,%ecx
+  80295a:	89 f7                	mov    %esi,%edi
+  80295c:	89 de                	mov    %ebx,%esi
+  80295e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802961:	d3 e6                	shl    %cl,%esi
+  802963:	31 db                	xor    %ebx,%ebx
+  802965:	f6 c1 20             	test   $0x20,%cl
+  802968:	0f 45 fe             	cmovne %esi,%edi
+  80296b:	0f 45 f3             	cmovne %ebx,%esi
+  80296e:	29 f0                	sub    %esi,%eax
+  802970:	be 01 00 00 00       	mov    $0x1,%esi
+  802975:	19 fa                	sbb    %edi,%edx
+  802977:	31 ff                	xor    %edi,%edi
+  802979:	31 db                	xor    %ebx,%ebx
+  80297b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80297e:	d3 e6                	shl    %cl,%esi
+  802980:	f6 c1 20             	test   $0x20,%cl
+  802983:	0f 45 fe             	cmovne %esi,%edi
+  802986:	0f 45 f3             	cmovne %ebx,%esi
+  802989:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80298d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802991:	83 ed 01             	sub    $0x1,%ebp
+  802994:	73 9a                	jae    802930 <__divdi3+0x70>
+  802996:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80299a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80299e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029a2:	85 ed                	test   %ebp,%ebp
+  8029a4:	0f 84 47 ff ff ff    	je     8028f1 <__divdi3+0x31>
+  8029aa:	f7 d8                	neg    %eax
+  8029ac:	83 d2 00             	adc    $0x0,%edx
+  8029af:	83 c4 1c             	add    $0x1c,%esp
+  8029b2:	5b                   	pop    %ebx
+  8029b3:	f7 da                	neg    %edx
+  8029b5:	5e                   	pop    %esi
+  8029b6:	5f                   	pop    %edi
+  8029b7:	5d                   	pop    %ebp
+  8029b8:	c3                   	ret
+  8029b9:	f7 de                	neg    %esi
+  8029bb:	83 d7 00             	adc    $0x0,%edi
+  8029be:	f7 df                	neg    %edi
+  8029c0:	85 db                	test   %ebx,%ebx
+  8029c2:	78 23                	js     8029e7 <__divdi3+0x127>
+  8029c4:	89 dd                	mov    %ebx,%ebp
+  8029c6:	89 c8                	mov    %ecx,%eax
+  8029c8:	89 da                	mov    %ebx,%edx
+  8029ca:	09 cd                	or     %ecx,%ebp
+  8029cc:	0f 84 1f ff ff ff    	je     8028f1 <__divdi3+0x31>
+  8029d2:	89 0c 24             	mov    %ecx,(%esp)
+  8029d5:	89 f0                	mov    %esi,%eax
+  8029d7:	89 fa                	mov    %edi,%edx
+  8029d9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8029de:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8029e2:	e9 29 ff ff ff       	jmp    802910 <__divdi3+0x50>
+  8029e7:	31 ed                	xor    %ebp,%ebp
+  8029e9:	e9 10 ff ff ff       	jmp    8028fe <__divdi3+0x3e>
+  8029ee:	89 0c 24             	mov    %ecx,(%esp)
+  8029f1:	89 f0                	mov    %esi,%eax
+  8029f3:	89 fa                	mov    %edi,%edx
+  8029f5:	31 ed                	xor    %ebp,%ebp
+  8029f7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8029fb:	e9 10 ff ff ff       	jmp    802910 <__divdi3+0x50>
+
+00802a00 <__moddi3>:
+  802a00:	55                   	push   %ebp
+  802a01:	57                   	push   %edi
+  802a02:	56                   	push   %esi
+  802a03:	53                   	push   %ebx
+  802a04:	83 ec 14             	sub    $0x14,%esp
+  802a07:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a0b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a0f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802a13:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802a17:	85 d2                	test   %edx,%edx
+  802a19:	0f 88 9b 00 00 00    	js     802aba <__moddi3+0xba>
+  802a1f:	89 f7                	mov    %esi,%edi
+  802a21:	31 ed                	xor    %ebp,%ebp
+  802a23:	09 cf                	or     %ecx,%edi
+  802a25:	0f 84 83 00 00 00    	je     802aae <__moddi3+0xae>
+  802a2b:	89 cb                	mov    %ecx,%ebx
+  802a2d:	89 f7                	mov    %esi,%edi
+  802a2f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802a33:	f7 db                	neg    %ebx
+  802a35:	83 d7 00             	adc    $0x0,%edi
+  802a38:	f7 df                	neg    %edi
+  802a3a:	0f 49 f7             	cmovns %edi,%esi
+  802a3d:	0f 49 cb             	cmovns %ebx,%ecx
+  802a40:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802a44:	89 0c 24             	mov    %ecx,(%esp)
+  802a47:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a4c:	89 cd                	mov    %ecx,%ebp
+  802a4e:	66 90                	xchg   %ax,%ax
+  802a50:	89 e9                	mov    %ebp,%ecx
+  802a52:	89 c3                	mov    %eax,%ebx
+  802a54:	89 d6                	mov    %edx,%esi
+  802a56:	31 ff                	xor    %edi,%edi
+  802a58:	d3 ee                	shr    %cl,%esi
+  802a5a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a5d:	f6 c1 20             	test   $0x20,%cl
+  802a60:	0f 45 de             	cmovne %esi,%ebx
+  802a63:	0f 45 f7             	cmovne %edi,%esi
+  802a66:	8b 3c 24             	mov    (%esp),%edi
+  802a69:	39 fb                	cmp    %edi,%ebx
+  802a6b:	89 f7                	mov    %esi,%edi
+  802a6d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802a71:	8b 1c 24             	mov    (%esp),%ebx
+  802a74:	19 f7                	sbb    %esi,%edi
+  802a76:	72 1a                	jb     802a92 <__moddi3+0x92>
+  802a78:	89 e9                	mov    %ebp,%ecx
+  802a7a:	89 f7                	mov    %esi,%edi
+  802a7c:	89 de                	mov    %ebx,%esi
+  802a7e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802a81:	d3 e6                	shl    %cl,%esi
+  802a83:	31 db                	xor    %ebx,%ebx
+  802a85:	f6 c1 20             	test   $0x20,%cl
+  802a88:	0f 45 fe             	cmovne %esi,%edi
+  802a8b:	0f 45 f3             	cmovne %ebx,%esi
+  802a8e:	29 f0                	sub    %esi,%eax
+  802a90:	19 fa                	sbb    %edi,%edx
+  802a92:	83 ed 01             	sub    $0x1,%ebp
+  802a95:	73 b9                	jae    802a50 <__moddi3+0x50>
+  802a97:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802a9b:	85 ed                	test   %ebp,%ebp
+  802a9d:	74 07                	je     802aa6 <__moddi3+0xa6>
+  802a9f:	f7 d8                	neg    %eax
+  802aa1:	83 d2 00             	adc    $0x0,%edx
+  802aa4:	f7 da                	neg    %edx
+  802aa6:	83 c4 14             	add    $0x14,%esp
+  802aa9:	5b                   	pop    %ebx
+  802aaa:	5e                   	pop    %esi
+  802aab:	5f                   	pop    %edi
+  802aac:	5d                   	pop    %ebp
+  802aad:	c3                   	ret
+  802aae:	83 c4 14             	add    $0x14,%esp
+  802ab1:	31 c0                	xor    %eax,%eax
+  802ab3:	31 d2                	xor    %edx,%edx
+  802ab5:	5b                   	pop    %ebx
+  802ab6:	5e                   	pop    %esi
+  802ab7:	5f                   	pop    %edi
+  802ab8:	5d                   	pop    %ebp
+  802ab9:	c3                   	ret
+  802aba:	89 f7                	mov    %esi,%edi
+  802abc:	09 cf                	or     %ecx,%edi
+  802abe:	74 11                	je     802ad1 <__moddi3+0xd1>
+  802ac0:	f7 d8                	neg    %eax
+  802ac2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802ac7:	83 d2 00             	adc    $0x0,%edx
+  802aca:	f7 da                	neg    %edx
+  802acc:	e9 5a ff ff ff       	jmp    802a2b <__moddi3+0x2b>
+  802ad1:	31 c0                	xor    %eax,%eax
+  802ad3:	31 d2                	xor    %edx,%edx
+  802ad5:	eb c8                	jmp    802a9f <__moddi3+0x9f>
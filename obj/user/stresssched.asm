@@ -0,0 +1,6154 @@
+
+obj/user/stresssched.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b6 00 00 00       	call   8000e7 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+volatile int counter;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int i, j;
+	int seen;
+	envid_t parent = sys_getenvid();
+  800038:	e8 a1 0b 00 00       	call   800bde <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+
+	// Fork several environments
+	for (i = 0; i < 20; i++)
+  80003f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fork() == 0)
+  800044:	e8 34 11 00 00       	call   80117d <fork>
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	74 0f                	je     80005c <umain+0x29>
+	for (i = 0; i < 20; i++)
+  80004d:	83 c3 01             	add    $0x1,%ebx
+  800050:	83 fb 14             	cmp    $0x14,%ebx
+  800053:	75 ef                	jne    800044 <umain+0x11>
+			break;
+	if (i == 20) {
+		sys_yield();
+  800055:	e8 a3 0b 00 00       	call   800bfd <sys_yield>
+		return;
+  80005a:	eb 6d                	jmp    8000c9 <umain+0x96>
+	}
+
+	// Wait for the parent to finish forking
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80005c:	89 f0                	mov    %esi,%eax
+  80005e:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800063:	c1 e0 09             	shl    $0x9,%eax
+  800066:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006b:	eb 02                	jmp    80006f <umain+0x3c>
+		asm volatile("pause");
+  80006d:	f3 90                	pause
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80006f:	8b 50 58             	mov    0x58(%eax),%edx
+  800072:	85 d2                	test   %edx,%edx
+  800074:	75 f7                	jne    80006d <umain+0x3a>
+  800076:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80007b:	eb 12                	jmp    80008f <umain+0x5c>
+
+	// Check that one environment doesn't run on two CPUs at once
+	for (i = 0; i < 10; i++) {
+		sys_yield();
+		for (j = 0; j < 10000; j++)
+			counter++;
+  80007d:	a1 08 50 80 00       	mov    0x805008,%eax
+  800082:	83 c0 01             	add    $0x1,%eax
+  800085:	a3 08 50 80 00       	mov    %eax,0x805008
+		for (j = 0; j < 10000; j++)
+  80008a:	83 ea 01             	sub    $0x1,%edx
+  80008d:	75 ee                	jne    80007d <umain+0x4a>
+	for (i = 0; i < 10; i++) {
+  80008f:	83 eb 01             	sub    $0x1,%ebx
+  800092:	74 0c                	je     8000a0 <umain+0x6d>
+		sys_yield();
+  800094:	e8 64 0b 00 00       	call   800bfd <sys_yield>
+		for (j = 0; j < 10000; j++)
+  800099:	ba 11 27 00 00       	mov    $0x2711,%edx
+  80009e:	eb ea                	jmp    80008a <umain+0x57>
+	}
+
+	if (counter != 10*10000)
+  8000a0:	a1 08 50 80 00       	mov    0x805008,%eax
+  8000a5:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000aa:	75 24                	jne    8000d0 <umain+0x9d>
+		panic("ran on two CPUs at once (counter is %d)", counter);
+
+	// Check that we see environments running on different CPUs
+	cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8000ac:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8000b1:	8b 50 60             	mov    0x60(%eax),%edx
+  8000b4:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8000b7:	83 ec 04             	sub    $0x4,%esp
+  8000ba:	52                   	push   %edx
+  8000bb:	50                   	push   %eax
+  8000bc:	68 5b 2b 80 00       	push   $0x802b5b
+  8000c1:	e8 5c 01 00 00       	call   800222 <cprintf>
+  8000c6:	83 c4 10             	add    $0x10,%esp
+
+}
+  8000c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5d                   	pop    %ebp
+  8000cf:	c3                   	ret
+		panic("ran on two CPUs at once (counter is %d)", counter);
+  8000d0:	a1 08 50 80 00       	mov    0x805008,%eax
+  8000d5:	50                   	push   %eax
+  8000d6:	68 20 2b 80 00       	push   $0x802b20
+  8000db:	6a 21                	push   $0x21
+  8000dd:	68 48 2b 80 00       	push   $0x802b48
+  8000e2:	e8 60 00 00 00       	call   800147 <_panic>
+
+008000e7 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e7:	55                   	push   %ebp
+  8000e8:	89 e5                	mov    %esp,%ebp
+  8000ea:	56                   	push   %esi
+  8000eb:	53                   	push   %ebx
+  8000ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ef:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000f2:	e8 e7 0a 00 00       	call   800bde <sys_getenvid>
+  8000f7:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000fc:	c1 e0 09             	shl    $0x9,%eax
+  8000ff:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800104:	a3 0c 50 80 00       	mov    %eax,0x80500c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800109:	85 db                	test   %ebx,%ebx
+  80010b:	7e 07                	jle    800114 <libmain+0x2d>
+		binaryname = argv[0];
+  80010d:	8b 06                	mov    (%esi),%eax
+  80010f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	53                   	push   %ebx
+  800119:	e8 15 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80011e:	e8 0a 00 00 00       	call   80012d <exit>
+}
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5d                   	pop    %ebp
+  80012c:	c3                   	ret
+
+0080012d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800133:	e8 a0 14 00 00       	call   8015d8 <close_all>
+	sys_env_destroy(0);
+  800138:	83 ec 0c             	sub    $0xc,%esp
+  80013b:	6a 00                	push   $0x0
+  80013d:	e8 5b 0a 00 00       	call   800b9d <sys_env_destroy>
+}
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	c9                   	leave
+  800146:	c3                   	ret
+
+00800147 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800147:	55                   	push   %ebp
+  800148:	89 e5                	mov    %esp,%ebp
+  80014a:	56                   	push   %esi
+  80014b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80014c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80014f:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800155:	e8 84 0a 00 00       	call   800bde <sys_getenvid>
+  80015a:	83 ec 0c             	sub    $0xc,%esp
+  80015d:	ff 75 0c             	push   0xc(%ebp)
+  800160:	ff 75 08             	push   0x8(%ebp)
+  800163:	56                   	push   %esi
+  800164:	50                   	push   %eax
+  800165:	68 84 2b 80 00       	push   $0x802b84
+  80016a:	e8 b3 00 00 00       	call   800222 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80016f:	83 c4 18             	add    $0x18,%esp
+  800172:	53                   	push   %ebx
+  800173:	ff 75 10             	push   0x10(%ebp)
+  800176:	e8 56 00 00 00       	call   8001d1 <vcprintf>
+	cprintf("\n");
+  80017b:	c7 04 24 77 2b 80 00 	movl   $0x802b77,(%esp)
+  800182:	e8 9b 00 00 00       	call   800222 <cprintf>
+  800187:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80018a:	cc                   	int3
+	while (1)
+  80018b:	eb fd                	jmp    80018a <_panic+0x43>
+
+0080018d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80018d:	55                   	push   %ebp
+  80018e:	89 e5                	mov    %esp,%ebp
+  800190:	53                   	push   %ebx
+  800191:	83 ec 04             	sub    $0x4,%esp
+  800194:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800197:	8b 13                	mov    (%ebx),%edx
+  800199:	8d 42 01             	lea    0x1(%edx),%eax
+  80019c:	89 03                	mov    %eax,(%ebx)
+  80019e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001a1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001a5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001aa:	74 09                	je     8001b5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001ac:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b3:	c9                   	leave
+  8001b4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001b5:	83 ec 08             	sub    $0x8,%esp
+  8001b8:	68 ff 00 00 00       	push   $0xff
+  8001bd:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001c0:	50                   	push   %eax
+  8001c1:	e8 7a 09 00 00       	call   800b40 <sys_cputs>
+		b->idx = 0;
+  8001c6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001cc:	83 c4 10             	add    $0x10,%esp
+  8001cf:	eb db                	jmp    8001ac <putch+0x1f>
+
+008001d1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001d1:	55                   	push   %ebp
+  8001d2:	89 e5                	mov    %esp,%ebp
+  8001d4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001da:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001e1:	00 00 00 
+	b.cnt = 0;
+  8001e4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001eb:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001ee:	ff 75 0c             	push   0xc(%ebp)
+  8001f1:	ff 75 08             	push   0x8(%ebp)
+  8001f4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001fa:	50                   	push   %eax
+  8001fb:	68 8d 01 80 00       	push   $0x80018d
+  800200:	e8 14 01 00 00       	call   800319 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800205:	83 c4 08             	add    $0x8,%esp
+  800208:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80020e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800214:	50                   	push   %eax
+  800215:	e8 26 09 00 00       	call   800b40 <sys_cputs>
+
+	return b.cnt;
+}
+  80021a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800220:	c9                   	leave
+  800221:	c3                   	ret
+
+00800222 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800228:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80022b:	50                   	push   %eax
+  80022c:	ff 75 08             	push   0x8(%ebp)
+  80022f:	e8 9d ff ff ff       	call   8001d1 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800234:	c9                   	leave
+  800235:	c3                   	ret
+
+00800236 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800236:	55                   	push   %ebp
+  800237:	89 e5                	mov    %esp,%ebp
+  800239:	57                   	push   %edi
+  80023a:	56                   	push   %esi
+  80023b:	53                   	push   %ebx
+  80023c:	83 ec 1c             	sub    $0x1c,%esp
+  80023f:	89 c7                	mov    %eax,%edi
+  800241:	89 d6                	mov    %edx,%esi
+  800243:	8b 45 08             	mov    0x8(%ebp),%eax
+  800246:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800249:	89 d1                	mov    %edx,%ecx
+  80024b:	89 c2                	mov    %eax,%edx
+  80024d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800250:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800253:	8b 45 10             	mov    0x10(%ebp),%eax
+  800256:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800259:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80025c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800263:	39 c2                	cmp    %eax,%edx
+  800265:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800268:	72 3e                	jb     8002a8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80026a:	83 ec 0c             	sub    $0xc,%esp
+  80026d:	ff 75 18             	push   0x18(%ebp)
+  800270:	83 eb 01             	sub    $0x1,%ebx
+  800273:	53                   	push   %ebx
+  800274:	50                   	push   %eax
+  800275:	83 ec 08             	sub    $0x8,%esp
+  800278:	ff 75 e4             	push   -0x1c(%ebp)
+  80027b:	ff 75 e0             	push   -0x20(%ebp)
+  80027e:	ff 75 dc             	push   -0x24(%ebp)
+  800281:	ff 75 d8             	push   -0x28(%ebp)
+  800284:	e8 17 25 00 00       	call   8027a0 <__udivdi3>
+  800289:	83 c4 18             	add    $0x18,%esp
+  80028c:	52                   	push   %edx
+  80028d:	50                   	push   %eax
+  80028e:	89 f2                	mov    %esi,%edx
+  800290:	89 f8                	mov    %edi,%eax
+  800292:	e8 9f ff ff ff       	call   800236 <printnum>
+  800297:	83 c4 20             	add    $0x20,%esp
+  80029a:	eb 13                	jmp    8002af <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80029c:	83 ec 08             	sub    $0x8,%esp
+  80029f:	56                   	push   %esi
+  8002a0:	ff 75 18             	push   0x18(%ebp)
+  8002a3:	ff d7                	call   *%edi
+  8002a5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002a8:	83 eb 01             	sub    $0x1,%ebx
+  8002ab:	85 db                	test   %ebx,%ebx
+  8002ad:	7f ed                	jg     80029c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002af:	83 ec 08             	sub    $0x8,%esp
+  8002b2:	56                   	push   %esi
+  8002b3:	83 ec 04             	sub    $0x4,%esp
+  8002b6:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b9:	ff 75 e0             	push   -0x20(%ebp)
+  8002bc:	ff 75 dc             	push   -0x24(%ebp)
+  8002bf:	ff 75 d8             	push   -0x28(%ebp)
+  8002c2:	e8 99 25 00 00       	call   802860 <__umoddi3>
+  8002c7:	83 c4 14             	add    $0x14,%esp
+  8002ca:	0f be 80 a7 2b 80 00 	movsbl 0x802ba7(%eax),%eax
+  8002d1:	50                   	push   %eax
+  8002d2:	ff d7                	call   *%edi
+}
+  8002d4:	83 c4 10             	add    $0x10,%esp
+  8002d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002da:	5b                   	pop    %ebx
+  8002db:	5e                   	pop    %esi
+  8002dc:	5f                   	pop    %edi
+  8002dd:	5d                   	pop    %ebp
+  8002de:	c3                   	ret
+
+008002df <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002df:	55                   	push   %ebp
+  8002e0:	89 e5                	mov    %esp,%ebp
+  8002e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002e5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002e9:	8b 10                	mov    (%eax),%edx
+  8002eb:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002ee:	73 0a                	jae    8002fa <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002f0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002f3:	89 08                	mov    %ecx,(%eax)
+  8002f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f8:	88 02                	mov    %al,(%edx)
+}
+  8002fa:	5d                   	pop    %ebp
+  8002fb:	c3                   	ret
+
+008002fc <printfmt>:
+{
+  8002fc:	55                   	push   %ebp
+  8002fd:	89 e5                	mov    %esp,%ebp
+  8002ff:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800302:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800305:	50                   	push   %eax
+  800306:	ff 75 10             	push   0x10(%ebp)
+  800309:	ff 75 0c             	push   0xc(%ebp)
+  80030c:	ff 75 08             	push   0x8(%ebp)
+  80030f:	e8 05 00 00 00       	call   800319 <vprintfmt>
+}
+  800314:	83 c4 10             	add    $0x10,%esp
+  800317:	c9                   	leave
+  800318:	c3                   	ret
+
+00800319 <vprintfmt>:
+{
+  800319:	55                   	push   %ebp
+  80031a:	89 e5                	mov    %esp,%ebp
+  80031c:	57                   	push   %edi
+  80031d:	56                   	push   %esi
+  80031e:	53                   	push   %ebx
+  80031f:	83 ec 2c             	sub    $0x2c,%esp
+  800322:	8b 75 08             	mov    0x8(%ebp),%esi
+  800325:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800328:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80032b:	eb 0a                	jmp    800337 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80032d:	83 ec 08             	sub    $0x8,%esp
+  800330:	53                   	push   %ebx
+  800331:	50                   	push   %eax
+  800332:	ff d6                	call   *%esi
+  800334:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800337:	83 c7 01             	add    $0x1,%edi
+  80033a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80033e:	83 f8 25             	cmp    $0x25,%eax
+  800341:	74 0c                	je     80034f <vprintfmt+0x36>
+			if (ch == '\0')
+  800343:	85 c0                	test   %eax,%eax
+  800345:	75 e6                	jne    80032d <vprintfmt+0x14>
+}
+  800347:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034a:	5b                   	pop    %ebx
+  80034b:	5e                   	pop    %esi
+  80034c:	5f                   	pop    %edi
+  80034d:	5d                   	pop    %ebp
+  80034e:	c3                   	ret
+		padc = ' ';
+  80034f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800353:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80035a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800361:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800368:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80036d:	8d 47 01             	lea    0x1(%edi),%eax
+  800370:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800373:	0f b6 17             	movzbl (%edi),%edx
+  800376:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800379:	3c 55                	cmp    $0x55,%al
+  80037b:	0f 87 cf 03 00 00    	ja     800750 <vprintfmt+0x437>
+  800381:	0f b6 c0             	movzbl %al,%eax
+  800384:	ff 24 85 e0 2c 80 00 	jmp    *0x802ce0(,%eax,4)
+  80038b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80038e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800392:	eb d9                	jmp    80036d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800394:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800397:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80039b:	eb d0                	jmp    80036d <vprintfmt+0x54>
+  80039d:	0f b6 d2             	movzbl %dl,%edx
+  8003a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003ab:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003ae:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003b2:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003b5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003b8:	83 f9 09             	cmp    $0x9,%ecx
+  8003bb:	77 55                	ja     800412 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003bd:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003c0:	eb e9                	jmp    8003ab <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c5:	8b 00                	mov    (%eax),%eax
+  8003c7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8003d0:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003d6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003da:	79 91                	jns    80036d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003dc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003e2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003e9:	eb 82                	jmp    80036d <vprintfmt+0x54>
+			if (width < 0)
+  8003eb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003ee:	85 d2                	test   %edx,%edx
+  8003f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f5:	0f 49 c2             	cmovns %edx,%eax
+  8003f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003fe:	e9 6a ff ff ff       	jmp    80036d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800403:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800406:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80040d:	e9 5b ff ff ff       	jmp    80036d <vprintfmt+0x54>
+  800412:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800415:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800418:	eb bc                	jmp    8003d6 <vprintfmt+0xbd>
+			lflag++;
+  80041a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80041d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800420:	e9 48 ff ff ff       	jmp    80036d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800425:	8b 45 14             	mov    0x14(%ebp),%eax
+  800428:	8d 78 04             	lea    0x4(%eax),%edi
+  80042b:	83 ec 08             	sub    $0x8,%esp
+  80042e:	53                   	push   %ebx
+  80042f:	ff 30                	push   (%eax)
+  800431:	ff d6                	call   *%esi
+			break;
+  800433:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800436:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800439:	e9 b1 02 00 00       	jmp    8006ef <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80043e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800441:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800444:	8b 10                	mov    (%eax),%edx
+  800446:	89 d0                	mov    %edx,%eax
+  800448:	f7 d8                	neg    %eax
+  80044a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80044d:	83 f8 0f             	cmp    $0xf,%eax
+  800450:	7f 23                	jg     800475 <vprintfmt+0x15c>
+  800452:	8b 14 85 40 2e 80 00 	mov    0x802e40(,%eax,4),%edx
+  800459:	85 d2                	test   %edx,%edx
+  80045b:	74 18                	je     800475 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80045d:	52                   	push   %edx
+  80045e:	68 69 30 80 00       	push   $0x803069
+  800463:	53                   	push   %ebx
+  800464:	56                   	push   %esi
+  800465:	e8 92 fe ff ff       	call   8002fc <printfmt>
+  80046a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800470:	e9 7a 02 00 00       	jmp    8006ef <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800475:	50                   	push   %eax
+  800476:	68 bf 2b 80 00       	push   $0x802bbf
+  80047b:	53                   	push   %ebx
+  80047c:	56                   	push   %esi
+  80047d:	e8 7a fe ff ff       	call   8002fc <printfmt>
+  800482:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800485:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800488:	e9 62 02 00 00       	jmp    8006ef <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80048d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800490:	83 c0 04             	add    $0x4,%eax
+  800493:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800496:	8b 45 14             	mov    0x14(%ebp),%eax
+  800499:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80049b:	85 c9                	test   %ecx,%ecx
+  80049d:	b8 b8 2b 80 00       	mov    $0x802bb8,%eax
+  8004a2:	0f 45 c1             	cmovne %ecx,%eax
+  8004a5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004a8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004ac:	7e 06                	jle    8004b4 <vprintfmt+0x19b>
+  8004ae:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004b2:	75 0b                	jne    8004bf <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004b7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004ba:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004bd:	eb 5c                	jmp    80051b <vprintfmt+0x202>
+  8004bf:	83 ec 08             	sub    $0x8,%esp
+  8004c2:	ff 75 d0             	push   -0x30(%ebp)
+  8004c5:	ff 75 cc             	push   -0x34(%ebp)
+  8004c8:	e8 20 03 00 00       	call   8007ed <strnlen>
+  8004cd:	89 c2                	mov    %eax,%edx
+  8004cf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d2:	29 d0                	sub    %edx,%eax
+  8004d4:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004d7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004de:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004e1:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e3:	eb 0e                	jmp    8004f3 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004e5:	83 ec 08             	sub    $0x8,%esp
+  8004e8:	53                   	push   %ebx
+  8004e9:	57                   	push   %edi
+  8004ea:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ed:	83 ee 01             	sub    $0x1,%esi
+  8004f0:	83 c4 10             	add    $0x10,%esp
+  8004f3:	85 f6                	test   %esi,%esi
+  8004f5:	7f ee                	jg     8004e5 <vprintfmt+0x1cc>
+  8004f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004fd:	85 c0                	test   %eax,%eax
+  8004ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800504:	0f 49 d0             	cmovns %eax,%edx
+  800507:	29 d0                	sub    %edx,%eax
+  800509:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80050c:	eb a6                	jmp    8004b4 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80050e:	83 ec 08             	sub    $0x8,%esp
+  800511:	53                   	push   %ebx
+  800512:	52                   	push   %edx
+  800513:	ff 55 08             	call   *0x8(%ebp)
+  800516:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800519:	89 f1                	mov    %esi,%ecx
+  80051b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80051e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800522:	0f be d0             	movsbl %al,%edx
+  800525:	85 d2                	test   %edx,%edx
+  800527:	74 28                	je     800551 <vprintfmt+0x238>
+  800529:	85 ff                	test   %edi,%edi
+  80052b:	78 05                	js     800532 <vprintfmt+0x219>
+  80052d:	83 ef 01             	sub    $0x1,%edi
+  800530:	78 30                	js     800562 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800532:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800536:	74 d6                	je     80050e <vprintfmt+0x1f5>
+  800538:	0f be c0             	movsbl %al,%eax
+  80053b:	83 e8 20             	sub    $0x20,%eax
+  80053e:	83 f8 5e             	cmp    $0x5e,%eax
+  800541:	76 cb                	jbe    80050e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800543:	83 ec 08             	sub    $0x8,%esp
+  800546:	53                   	push   %ebx
+  800547:	6a 3f                	push   $0x3f
+  800549:	ff 55 08             	call   *0x8(%ebp)
+  80054c:	83 c4 10             	add    $0x10,%esp
+  80054f:	eb c8                	jmp    800519 <vprintfmt+0x200>
+  800551:	8b 75 08             	mov    0x8(%ebp),%esi
+  800554:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800557:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80055a:	01 d0                	add    %edx,%eax
+  80055c:	29 c8                	sub    %ecx,%eax
+  80055e:	89 c7                	mov    %eax,%edi
+  800560:	eb 13                	jmp    800575 <vprintfmt+0x25c>
+  800562:	8b 75 08             	mov    0x8(%ebp),%esi
+  800565:	eb ed                	jmp    800554 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800567:	83 ec 08             	sub    $0x8,%esp
+  80056a:	53                   	push   %ebx
+  80056b:	6a 20                	push   $0x20
+  80056d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80056f:	83 ef 01             	sub    $0x1,%edi
+  800572:	83 c4 10             	add    $0x10,%esp
+  800575:	85 ff                	test   %edi,%edi
+  800577:	7f ee                	jg     800567 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800579:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80057c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057f:	e9 6b 01 00 00       	jmp    8006ef <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800584:	83 f9 01             	cmp    $0x1,%ecx
+  800587:	7f 1f                	jg     8005a8 <vprintfmt+0x28f>
+	else if (lflag)
+  800589:	85 c9                	test   %ecx,%ecx
+  80058b:	74 67                	je     8005f4 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80058d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800590:	8b 00                	mov    (%eax),%eax
+  800592:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800595:	89 c1                	mov    %eax,%ecx
+  800597:	c1 f9 1f             	sar    $0x1f,%ecx
+  80059a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80059d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a6:	eb 17                	jmp    8005bf <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ab:	8b 50 04             	mov    0x4(%eax),%edx
+  8005ae:	8b 00                	mov    (%eax),%eax
+  8005b0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b9:	8d 40 08             	lea    0x8(%eax),%eax
+  8005bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005bf:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005c5:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005ca:	85 c9                	test   %ecx,%ecx
+  8005cc:	0f 89 03 01 00 00    	jns    8006d5 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005d2:	83 ec 08             	sub    $0x8,%esp
+  8005d5:	53                   	push   %ebx
+  8005d6:	6a 2d                	push   $0x2d
+  8005d8:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005da:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005dd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005e0:	f7 da                	neg    %edx
+  8005e2:	83 d1 00             	adc    $0x0,%ecx
+  8005e5:	f7 d9                	neg    %ecx
+  8005e7:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005ea:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005ef:	e9 e1 00 00 00       	jmp    8006d5 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f7:	8b 00                	mov    (%eax),%eax
+  8005f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fc:	89 c1                	mov    %eax,%ecx
+  8005fe:	c1 f9 1f             	sar    $0x1f,%ecx
+  800601:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	8d 40 04             	lea    0x4(%eax),%eax
+  80060a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80060d:	eb b0                	jmp    8005bf <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80060f:	83 f9 01             	cmp    $0x1,%ecx
+  800612:	7f 1e                	jg     800632 <vprintfmt+0x319>
+	else if (lflag)
+  800614:	85 c9                	test   %ecx,%ecx
+  800616:	74 32                	je     80064a <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800618:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061b:	8b 10                	mov    (%eax),%edx
+  80061d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800622:	8d 40 04             	lea    0x4(%eax),%eax
+  800625:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800628:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80062d:	e9 a3 00 00 00       	jmp    8006d5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800632:	8b 45 14             	mov    0x14(%ebp),%eax
+  800635:	8b 10                	mov    (%eax),%edx
+  800637:	8b 48 04             	mov    0x4(%eax),%ecx
+  80063a:	8d 40 08             	lea    0x8(%eax),%eax
+  80063d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800640:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800645:	e9 8b 00 00 00       	jmp    8006d5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80064a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064d:	8b 10                	mov    (%eax),%edx
+  80064f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800654:	8d 40 04             	lea    0x4(%eax),%eax
+  800657:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80065a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80065f:	eb 74                	jmp    8006d5 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800661:	83 f9 01             	cmp    $0x1,%ecx
+  800664:	7f 1b                	jg     800681 <vprintfmt+0x368>
+	else if (lflag)
+  800666:	85 c9                	test   %ecx,%ecx
+  800668:	74 2c                	je     800696 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80066a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066d:	8b 10                	mov    (%eax),%edx
+  80066f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800674:	8d 40 04             	lea    0x4(%eax),%eax
+  800677:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80067a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80067f:	eb 54                	jmp    8006d5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800681:	8b 45 14             	mov    0x14(%ebp),%eax
+  800684:	8b 10                	mov    (%eax),%edx
+  800686:	8b 48 04             	mov    0x4(%eax),%ecx
+  800689:	8d 40 08             	lea    0x8(%eax),%eax
+  80068c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80068f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800694:	eb 3f                	jmp    8006d5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 10                	mov    (%eax),%edx
+  80069b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006ab:	eb 28                	jmp    8006d5 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006ad:	83 ec 08             	sub    $0x8,%esp
+  8006b0:	53                   	push   %ebx
+  8006b1:	6a 30                	push   $0x30
+  8006b3:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006b5:	83 c4 08             	add    $0x8,%esp
+  8006b8:	53                   	push   %ebx
+  8006b9:	6a 78                	push   $0x78
+  8006bb:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c0:	8b 10                	mov    (%eax),%edx
+  8006c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006c7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d0:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006d5:	83 ec 0c             	sub    $0xc,%esp
+  8006d8:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006dc:	50                   	push   %eax
+  8006dd:	ff 75 e0             	push   -0x20(%ebp)
+  8006e0:	57                   	push   %edi
+  8006e1:	51                   	push   %ecx
+  8006e2:	52                   	push   %edx
+  8006e3:	89 da                	mov    %ebx,%edx
+  8006e5:	89 f0                	mov    %esi,%eax
+  8006e7:	e8 4a fb ff ff       	call   800236 <printnum>
+			break;
+  8006ec:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006f2:	e9 40 fc ff ff       	jmp    800337 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006f7:	83 f9 01             	cmp    $0x1,%ecx
+  8006fa:	7f 1b                	jg     800717 <vprintfmt+0x3fe>
+	else if (lflag)
+  8006fc:	85 c9                	test   %ecx,%ecx
+  8006fe:	74 2c                	je     80072c <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800700:	8b 45 14             	mov    0x14(%ebp),%eax
+  800703:	8b 10                	mov    (%eax),%edx
+  800705:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070a:	8d 40 04             	lea    0x4(%eax),%eax
+  80070d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800710:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800715:	eb be                	jmp    8006d5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800717:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071a:	8b 10                	mov    (%eax),%edx
+  80071c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80071f:	8d 40 08             	lea    0x8(%eax),%eax
+  800722:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800725:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80072a:	eb a9                	jmp    8006d5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80072c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072f:	8b 10                	mov    (%eax),%edx
+  800731:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800736:	8d 40 04             	lea    0x4(%eax),%eax
+  800739:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80073c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800741:	eb 92                	jmp    8006d5 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800743:	83 ec 08             	sub    $0x8,%esp
+  800746:	53                   	push   %ebx
+  800747:	6a 25                	push   $0x25
+  800749:	ff d6                	call   *%esi
+			break;
+  80074b:	83 c4 10             	add    $0x10,%esp
+  80074e:	eb 9f                	jmp    8006ef <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800750:	83 ec 08             	sub    $0x8,%esp
+  800753:	53                   	push   %ebx
+  800754:	6a 25                	push   $0x25
+  800756:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800758:	83 c4 10             	add    $0x10,%esp
+  80075b:	89 f8                	mov    %edi,%eax
+  80075d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800761:	74 05                	je     800768 <vprintfmt+0x44f>
+  800763:	83 e8 01             	sub    $0x1,%eax
+  800766:	eb f5                	jmp    80075d <vprintfmt+0x444>
+  800768:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80076b:	eb 82                	jmp    8006ef <vprintfmt+0x3d6>
+
+0080076d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80076d:	55                   	push   %ebp
+  80076e:	89 e5                	mov    %esp,%ebp
+  800770:	83 ec 18             	sub    $0x18,%esp
+  800773:	8b 45 08             	mov    0x8(%ebp),%eax
+  800776:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800779:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80077c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800780:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800783:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80078a:	85 c0                	test   %eax,%eax
+  80078c:	74 26                	je     8007b4 <vsnprintf+0x47>
+  80078e:	85 d2                	test   %edx,%edx
+  800790:	7e 22                	jle    8007b4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800792:	ff 75 14             	push   0x14(%ebp)
+  800795:	ff 75 10             	push   0x10(%ebp)
+  800798:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80079b:	50                   	push   %eax
+  80079c:	68 df 02 80 00       	push   $0x8002df
+  8007a1:	e8 73 fb ff ff       	call   800319 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007a6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007a9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007af:	83 c4 10             	add    $0x10,%esp
+}
+  8007b2:	c9                   	leave
+  8007b3:	c3                   	ret
+		return -E_INVAL;
+  8007b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007b9:	eb f7                	jmp    8007b2 <vsnprintf+0x45>
+
+008007bb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007bb:	55                   	push   %ebp
+  8007bc:	89 e5                	mov    %esp,%ebp
+  8007be:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007c1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007c4:	50                   	push   %eax
+  8007c5:	ff 75 10             	push   0x10(%ebp)
+  8007c8:	ff 75 0c             	push   0xc(%ebp)
+  8007cb:	ff 75 08             	push   0x8(%ebp)
+  8007ce:	e8 9a ff ff ff       	call   80076d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007d3:	c9                   	leave
+  8007d4:	c3                   	ret
+
+008007d5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007d5:	55                   	push   %ebp
+  8007d6:	89 e5                	mov    %esp,%ebp
+  8007d8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e0:	eb 03                	jmp    8007e5 <strlen+0x10>
+		n++;
+  8007e2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007e5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007e9:	75 f7                	jne    8007e2 <strlen+0xd>
+	return n;
+}
+  8007eb:	5d                   	pop    %ebp
+  8007ec:	c3                   	ret
+
+008007ed <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007ed:	55                   	push   %ebp
+  8007ee:	89 e5                	mov    %esp,%ebp
+  8007f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fb:	eb 03                	jmp    800800 <strnlen+0x13>
+		n++;
+  8007fd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800800:	39 d0                	cmp    %edx,%eax
+  800802:	74 08                	je     80080c <strnlen+0x1f>
+  800804:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800808:	75 f3                	jne    8007fd <strnlen+0x10>
+  80080a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80080c:	89 d0                	mov    %edx,%eax
+  80080e:	5d                   	pop    %ebp
+  80080f:	c3                   	ret
+
+00800810 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800810:	55                   	push   %ebp
+  800811:	89 e5                	mov    %esp,%ebp
+  800813:	53                   	push   %ebx
+  800814:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800817:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800823:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800826:	83 c0 01             	add    $0x1,%eax
+  800829:	84 d2                	test   %dl,%dl
+  80082b:	75 f2                	jne    80081f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80082d:	89 c8                	mov    %ecx,%eax
+  80082f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800832:	c9                   	leave
+  800833:	c3                   	ret
+
+00800834 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800834:	55                   	push   %ebp
+  800835:	89 e5                	mov    %esp,%ebp
+  800837:	53                   	push   %ebx
+  800838:	83 ec 10             	sub    $0x10,%esp
+  80083b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80083e:	53                   	push   %ebx
+  80083f:	e8 91 ff ff ff       	call   8007d5 <strlen>
+  800844:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800847:	ff 75 0c             	push   0xc(%ebp)
+  80084a:	01 d8                	add    %ebx,%eax
+  80084c:	50                   	push   %eax
+  80084d:	e8 be ff ff ff       	call   800810 <strcpy>
+	return dst;
+}
+  800852:	89 d8                	mov    %ebx,%eax
+  800854:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800857:	c9                   	leave
+  800858:	c3                   	ret
+
+00800859 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	56                   	push   %esi
+  80085d:	53                   	push   %ebx
+  80085e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800861:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800864:	89 f3                	mov    %esi,%ebx
+  800866:	03 5d 10             	add    0x10(%ebp),%ebx
+  800869:	89 f0                	mov    %esi,%eax
+  80086b:	eb 0f                	jmp    80087c <strncpy+0x23>
+		*dst++ = *src;
+  80086d:	83 c0 01             	add    $0x1,%eax
+  800870:	0f b6 0a             	movzbl (%edx),%ecx
+  800873:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800876:	80 f9 01             	cmp    $0x1,%cl
+  800879:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80087c:	39 d8                	cmp    %ebx,%eax
+  80087e:	75 ed                	jne    80086d <strncpy+0x14>
+	}
+	return ret;
+}
+  800880:	89 f0                	mov    %esi,%eax
+  800882:	5b                   	pop    %ebx
+  800883:	5e                   	pop    %esi
+  800884:	5d                   	pop    %ebp
+  800885:	c3                   	ret
+
+00800886 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800886:	55                   	push   %ebp
+  800887:	89 e5                	mov    %esp,%ebp
+  800889:	56                   	push   %esi
+  80088a:	53                   	push   %ebx
+  80088b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80088e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800891:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800894:	89 f0                	mov    %esi,%eax
+  800896:	85 d2                	test   %edx,%edx
+  800898:	74 21                	je     8008bb <strlcpy+0x35>
+  80089a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80089e:	89 f2                	mov    %esi,%edx
+  8008a0:	eb 09                	jmp    8008ab <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008a2:	83 c1 01             	add    $0x1,%ecx
+  8008a5:	83 c2 01             	add    $0x1,%edx
+  8008a8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008ab:	39 c2                	cmp    %eax,%edx
+  8008ad:	74 09                	je     8008b8 <strlcpy+0x32>
+  8008af:	0f b6 19             	movzbl (%ecx),%ebx
+  8008b2:	84 db                	test   %bl,%bl
+  8008b4:	75 ec                	jne    8008a2 <strlcpy+0x1c>
+  8008b6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008b8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008bb:	29 f0                	sub    %esi,%eax
+}
+  8008bd:	5b                   	pop    %ebx
+  8008be:	5e                   	pop    %esi
+  8008bf:	5d                   	pop    %ebp
+  8008c0:	c3                   	ret
+
+008008c1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008c1:	55                   	push   %ebp
+  8008c2:	89 e5                	mov    %esp,%ebp
+  8008c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008ca:	eb 06                	jmp    8008d2 <strcmp+0x11>
+		p++, q++;
+  8008cc:	83 c1 01             	add    $0x1,%ecx
+  8008cf:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008d2:	0f b6 01             	movzbl (%ecx),%eax
+  8008d5:	84 c0                	test   %al,%al
+  8008d7:	74 04                	je     8008dd <strcmp+0x1c>
+  8008d9:	3a 02                	cmp    (%edx),%al
+  8008db:	74 ef                	je     8008cc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008dd:	0f b6 c0             	movzbl %al,%eax
+  8008e0:	0f b6 12             	movzbl (%edx),%edx
+  8008e3:	29 d0                	sub    %edx,%eax
+}
+  8008e5:	5d                   	pop    %ebp
+  8008e6:	c3                   	ret
+
+008008e7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008e7:	55                   	push   %ebp
+  8008e8:	89 e5                	mov    %esp,%ebp
+  8008ea:	53                   	push   %ebx
+  8008eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008f4:	eb 09                	jmp    8008ff <strncmp+0x18>
+		n--, p++, q++;
+  8008f6:	83 ea 01             	sub    $0x1,%edx
+  8008f9:	83 c0 01             	add    $0x1,%eax
+  8008fc:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008ff:	85 d2                	test   %edx,%edx
+  800901:	74 18                	je     80091b <strncmp+0x34>
+  800903:	0f b6 18             	movzbl (%eax),%ebx
+  800906:	84 db                	test   %bl,%bl
+  800908:	74 04                	je     80090e <strncmp+0x27>
+  80090a:	3a 19                	cmp    (%ecx),%bl
+  80090c:	74 e8                	je     8008f6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80090e:	0f b6 00             	movzbl (%eax),%eax
+  800911:	0f b6 11             	movzbl (%ecx),%edx
+  800914:	29 d0                	sub    %edx,%eax
+}
+  800916:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800919:	c9                   	leave
+  80091a:	c3                   	ret
+		return 0;
+  80091b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800920:	eb f4                	jmp    800916 <strncmp+0x2f>
+
+00800922 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800922:	55                   	push   %ebp
+  800923:	89 e5                	mov    %esp,%ebp
+  800925:	8b 45 08             	mov    0x8(%ebp),%eax
+  800928:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80092c:	eb 03                	jmp    800931 <strchr+0xf>
+  80092e:	83 c0 01             	add    $0x1,%eax
+  800931:	0f b6 10             	movzbl (%eax),%edx
+  800934:	84 d2                	test   %dl,%dl
+  800936:	74 06                	je     80093e <strchr+0x1c>
+		if (*s == c)
+  800938:	38 ca                	cmp    %cl,%dl
+  80093a:	75 f2                	jne    80092e <strchr+0xc>
+  80093c:	eb 05                	jmp    800943 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80093e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800943:	5d                   	pop    %ebp
+  800944:	c3                   	ret
+
+00800945 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800945:	55                   	push   %ebp
+  800946:	89 e5                	mov    %esp,%ebp
+  800948:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80094f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800952:	38 ca                	cmp    %cl,%dl
+  800954:	74 09                	je     80095f <strfind+0x1a>
+  800956:	84 d2                	test   %dl,%dl
+  800958:	74 05                	je     80095f <strfind+0x1a>
+	for (; *s; s++)
+  80095a:	83 c0 01             	add    $0x1,%eax
+  80095d:	eb f0                	jmp    80094f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80095f:	5d                   	pop    %ebp
+  800960:	c3                   	ret
+
+00800961 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800961:	55                   	push   %ebp
+  800962:	89 e5                	mov    %esp,%ebp
+  800964:	57                   	push   %edi
+  800965:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800968:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80096b:	85 c9                	test   %ecx,%ecx
+  80096d:	74 20                	je     80098f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80096f:	89 f8                	mov    %edi,%eax
+  800971:	09 c8                	or     %ecx,%eax
+  800973:	a8 03                	test   $0x3,%al
+  800975:	75 12                	jne    800989 <memset+0x28>
+		c &= 0xFF;
+  800977:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80097b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800981:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800984:	fc                   	cld
+  800985:	f3 ab                	rep stos %eax,%es:(%edi)
+  800987:	eb 06                	jmp    80098f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800989:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80098c:	fc                   	cld
+  80098d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80098f:	89 f8                	mov    %edi,%eax
+  800991:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800994:	c9                   	leave
+  800995:	c3                   	ret
+
+00800996 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800996:	55                   	push   %ebp
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	57                   	push   %edi
+  80099a:	56                   	push   %esi
+  80099b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009a1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009a4:	39 c6                	cmp    %eax,%esi
+  8009a6:	73 32                	jae    8009da <memmove+0x44>
+  8009a8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009ab:	39 d0                	cmp    %edx,%eax
+  8009ad:	73 2b                	jae    8009da <memmove+0x44>
+		s += n;
+		d += n;
+  8009af:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b2:	89 d6                	mov    %edx,%esi
+  8009b4:	09 fe                	or     %edi,%esi
+  8009b6:	09 ce                	or     %ecx,%esi
+  8009b8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009be:	75 0e                	jne    8009ce <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009c0:	83 ef 04             	sub    $0x4,%edi
+  8009c3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009c6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009c9:	fd                   	std
+  8009ca:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009cc:	eb 09                	jmp    8009d7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009ce:	83 ef 01             	sub    $0x1,%edi
+  8009d1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009d4:	fd                   	std
+  8009d5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009d7:	fc                   	cld
+  8009d8:	eb 1a                	jmp    8009f4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009da:	89 f2                	mov    %esi,%edx
+  8009dc:	09 c2                	or     %eax,%edx
+  8009de:	09 ca                	or     %ecx,%edx
+  8009e0:	f6 c2 03             	test   $0x3,%dl
+  8009e3:	75 0a                	jne    8009ef <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009e5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009e8:	89 c7                	mov    %eax,%edi
+  8009ea:	fc                   	cld
+  8009eb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ed:	eb 05                	jmp    8009f4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009ef:	89 c7                	mov    %eax,%edi
+  8009f1:	fc                   	cld
+  8009f2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009f4:	5e                   	pop    %esi
+  8009f5:	5f                   	pop    %edi
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	c3                   	ret
+
+008009f8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009fe:	ff 75 10             	push   0x10(%ebp)
+  800a01:	ff 75 0c             	push   0xc(%ebp)
+  800a04:	ff 75 08             	push   0x8(%ebp)
+  800a07:	e8 8a ff ff ff       	call   800996 <memmove>
+}
+  800a0c:	c9                   	leave
+  800a0d:	c3                   	ret
+
+00800a0e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a0e:	55                   	push   %ebp
+  800a0f:	89 e5                	mov    %esp,%ebp
+  800a11:	56                   	push   %esi
+  800a12:	53                   	push   %ebx
+  800a13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a16:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a19:	89 c6                	mov    %eax,%esi
+  800a1b:	03 75 10             	add    0x10(%ebp),%esi
+  800a1e:	eb 06                	jmp    800a26 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a20:	83 c0 01             	add    $0x1,%eax
+  800a23:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a26:	39 f0                	cmp    %esi,%eax
+  800a28:	74 14                	je     800a3e <memcmp+0x30>
+		if (*s1 != *s2)
+  800a2a:	0f b6 08             	movzbl (%eax),%ecx
+  800a2d:	0f b6 1a             	movzbl (%edx),%ebx
+  800a30:	38 d9                	cmp    %bl,%cl
+  800a32:	74 ec                	je     800a20 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a34:	0f b6 c1             	movzbl %cl,%eax
+  800a37:	0f b6 db             	movzbl %bl,%ebx
+  800a3a:	29 d8                	sub    %ebx,%eax
+  800a3c:	eb 05                	jmp    800a43 <memcmp+0x35>
+	}
+
+	return 0;
+  800a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a43:	5b                   	pop    %ebx
+  800a44:	5e                   	pop    %esi
+  800a45:	5d                   	pop    %ebp
+  800a46:	c3                   	ret
+
+00800a47 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a47:	55                   	push   %ebp
+  800a48:	89 e5                	mov    %esp,%ebp
+  800a4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a50:	89 c2                	mov    %eax,%edx
+  800a52:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a55:	eb 03                	jmp    800a5a <memfind+0x13>
+  800a57:	83 c0 01             	add    $0x1,%eax
+  800a5a:	39 d0                	cmp    %edx,%eax
+  800a5c:	73 04                	jae    800a62 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a5e:	38 08                	cmp    %cl,(%eax)
+  800a60:	75 f5                	jne    800a57 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a62:	5d                   	pop    %ebp
+  800a63:	c3                   	ret
+
+00800a64 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a64:	55                   	push   %ebp
+  800a65:	89 e5                	mov    %esp,%ebp
+  800a67:	57                   	push   %edi
+  800a68:	56                   	push   %esi
+  800a69:	53                   	push   %ebx
+  800a6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a70:	eb 03                	jmp    800a75 <strtol+0x11>
+		s++;
+  800a72:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a75:	0f b6 02             	movzbl (%edx),%eax
+  800a78:	3c 20                	cmp    $0x20,%al
+  800a7a:	74 f6                	je     800a72 <strtol+0xe>
+  800a7c:	3c 09                	cmp    $0x9,%al
+  800a7e:	74 f2                	je     800a72 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a80:	3c 2b                	cmp    $0x2b,%al
+  800a82:	74 2a                	je     800aae <strtol+0x4a>
+	int neg = 0;
+  800a84:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a89:	3c 2d                	cmp    $0x2d,%al
+  800a8b:	74 2b                	je     800ab8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a8d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a93:	75 0f                	jne    800aa4 <strtol+0x40>
+  800a95:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a98:	74 28                	je     800ac2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a9a:	85 db                	test   %ebx,%ebx
+  800a9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aa1:	0f 44 d8             	cmove  %eax,%ebx
+  800aa4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800aac:	eb 46                	jmp    800af4 <strtol+0x90>
+		s++;
+  800aae:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ab1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ab6:	eb d5                	jmp    800a8d <strtol+0x29>
+		s++, neg = 1;
+  800ab8:	83 c2 01             	add    $0x1,%edx
+  800abb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ac0:	eb cb                	jmp    800a8d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ac2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ac6:	74 0e                	je     800ad6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ac8:	85 db                	test   %ebx,%ebx
+  800aca:	75 d8                	jne    800aa4 <strtol+0x40>
+		s++, base = 8;
+  800acc:	83 c2 01             	add    $0x1,%edx
+  800acf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ad4:	eb ce                	jmp    800aa4 <strtol+0x40>
+		s += 2, base = 16;
+  800ad6:	83 c2 02             	add    $0x2,%edx
+  800ad9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ade:	eb c4                	jmp    800aa4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ae0:	0f be c0             	movsbl %al,%eax
+  800ae3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ae6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ae9:	7d 3a                	jge    800b25 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800aeb:	83 c2 01             	add    $0x1,%edx
+  800aee:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800af2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800af4:	0f b6 02             	movzbl (%edx),%eax
+  800af7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800afa:	89 f3                	mov    %esi,%ebx
+  800afc:	80 fb 09             	cmp    $0x9,%bl
+  800aff:	76 df                	jbe    800ae0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b01:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b04:	89 f3                	mov    %esi,%ebx
+  800b06:	80 fb 19             	cmp    $0x19,%bl
+  800b09:	77 08                	ja     800b13 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b0b:	0f be c0             	movsbl %al,%eax
+  800b0e:	83 e8 57             	sub    $0x57,%eax
+  800b11:	eb d3                	jmp    800ae6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b13:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b16:	89 f3                	mov    %esi,%ebx
+  800b18:	80 fb 19             	cmp    $0x19,%bl
+  800b1b:	77 08                	ja     800b25 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b1d:	0f be c0             	movsbl %al,%eax
+  800b20:	83 e8 37             	sub    $0x37,%eax
+  800b23:	eb c1                	jmp    800ae6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b25:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b29:	74 05                	je     800b30 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b2e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b30:	89 c8                	mov    %ecx,%eax
+  800b32:	f7 d8                	neg    %eax
+  800b34:	85 ff                	test   %edi,%edi
+  800b36:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b39:	89 c8                	mov    %ecx,%eax
+  800b3b:	5b                   	pop    %ebx
+  800b3c:	5e                   	pop    %esi
+  800b3d:	5f                   	pop    %edi
+  800b3e:	5d                   	pop    %ebp
+  800b3f:	c3                   	ret
+
+00800b40 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	57                   	push   %edi
+  800b44:	56                   	push   %esi
+  800b45:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b51:	89 c3                	mov    %eax,%ebx
+  800b53:	89 c7                	mov    %eax,%edi
+  800b55:	89 c6                	mov    %eax,%esi
+  800b57:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b59:	5b                   	pop    %ebx
+  800b5a:	5e                   	pop    %esi
+  800b5b:	5f                   	pop    %edi
+  800b5c:	5d                   	pop    %ebp
+  800b5d:	c3                   	ret
+
+00800b5e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	57                   	push   %edi
+  800b62:	56                   	push   %esi
+  800b63:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b64:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b69:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b6e:	89 d1                	mov    %edx,%ecx
+  800b70:	89 d3                	mov    %edx,%ebx
+  800b72:	89 d7                	mov    %edx,%edi
+  800b74:	89 d6                	mov    %edx,%esi
+  800b76:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b78:	5b                   	pop    %ebx
+  800b79:	5e                   	pop    %esi
+  800b7a:	5f                   	pop    %edi
+  800b7b:	5d                   	pop    %ebp
+  800b7c:	c3                   	ret
+
+00800b7d <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	57                   	push   %edi
+  800b81:	56                   	push   %esi
+  800b82:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b8b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b90:	89 cb                	mov    %ecx,%ebx
+  800b92:	89 cf                	mov    %ecx,%edi
+  800b94:	89 ce                	mov    %ecx,%esi
+  800b96:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b98:	5b                   	pop    %ebx
+  800b99:	5e                   	pop    %esi
+  800b9a:	5f                   	pop    %edi
+  800b9b:	5d                   	pop    %ebp
+  800b9c:	c3                   	ret
+
+00800b9d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	57                   	push   %edi
+  800ba1:	56                   	push   %esi
+  800ba2:	53                   	push   %ebx
+  800ba3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ba6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bae:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bb3:	89 cb                	mov    %ecx,%ebx
+  800bb5:	89 cf                	mov    %ecx,%edi
+  800bb7:	89 ce                	mov    %ecx,%esi
+  800bb9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bbb:	85 c0                	test   %eax,%eax
+  800bbd:	7f 08                	jg     800bc7 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc2:	5b                   	pop    %ebx
+  800bc3:	5e                   	pop    %esi
+  800bc4:	5f                   	pop    %edi
+  800bc5:	5d                   	pop    %ebp
+  800bc6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bc7:	83 ec 0c             	sub    $0xc,%esp
+  800bca:	50                   	push   %eax
+  800bcb:	6a 03                	push   $0x3
+  800bcd:	68 9f 2e 80 00       	push   $0x802e9f
+  800bd2:	6a 23                	push   $0x23
+  800bd4:	68 bc 2e 80 00       	push   $0x802ebc
+  800bd9:	e8 69 f5 ff ff       	call   800147 <_panic>
+
+00800bde <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	57                   	push   %edi
+  800be2:	56                   	push   %esi
+  800be3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800be4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bee:	89 d1                	mov    %edx,%ecx
+  800bf0:	89 d3                	mov    %edx,%ebx
+  800bf2:	89 d7                	mov    %edx,%edi
+  800bf4:	89 d6                	mov    %edx,%esi
+  800bf6:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bf8:	5b                   	pop    %ebx
+  800bf9:	5e                   	pop    %esi
+  800bfa:	5f                   	pop    %edi
+  800bfb:	5d                   	pop    %ebp
+  800bfc:	c3                   	ret
+
+00800bfd <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	57                   	push   %edi
+  800c01:	56                   	push   %esi
+  800c02:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c03:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c08:	b8 16 00 00 00       	mov    $0x16,%eax
+  800c0d:	89 d1                	mov    %edx,%ecx
+  800c0f:	89 d3                	mov    %edx,%ebx
+  800c11:	89 d7                	mov    %edx,%edi
+  800c13:	89 d6                	mov    %edx,%esi
+  800c15:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c17:	5b                   	pop    %ebx
+  800c18:	5e                   	pop    %esi
+  800c19:	5f                   	pop    %edi
+  800c1a:	5d                   	pop    %ebp
+  800c1b:	c3                   	ret
+
+00800c1c <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800c1c:	55                   	push   %ebp
+  800c1d:	89 e5                	mov    %esp,%ebp
+  800c1f:	57                   	push   %edi
+  800c20:	56                   	push   %esi
+  800c21:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c22:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c27:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800c2c:	89 d1                	mov    %edx,%ecx
+  800c2e:	89 d3                	mov    %edx,%ebx
+  800c30:	89 d7                	mov    %edx,%edi
+  800c32:	89 d6                	mov    %edx,%esi
+  800c34:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800c36:	5b                   	pop    %ebx
+  800c37:	5e                   	pop    %esi
+  800c38:	5f                   	pop    %edi
+  800c39:	5d                   	pop    %ebp
+  800c3a:	c3                   	ret
+
+00800c3b <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800c3b:	55                   	push   %ebp
+  800c3c:	89 e5                	mov    %esp,%ebp
+  800c3e:	57                   	push   %edi
+  800c3f:	56                   	push   %esi
+  800c40:	53                   	push   %ebx
+  800c41:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c4f:	b8 15 00 00 00       	mov    $0x15,%eax
+  800c54:	89 df                	mov    %ebx,%edi
+  800c56:	89 de                	mov    %ebx,%esi
+  800c58:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c5a:	85 c0                	test   %eax,%eax
+  800c5c:	7f 08                	jg     800c66 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800c5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c61:	5b                   	pop    %ebx
+  800c62:	5e                   	pop    %esi
+  800c63:	5f                   	pop    %edi
+  800c64:	5d                   	pop    %ebp
+  800c65:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c66:	83 ec 0c             	sub    $0xc,%esp
+  800c69:	50                   	push   %eax
+  800c6a:	6a 15                	push   $0x15
+  800c6c:	68 9f 2e 80 00       	push   $0x802e9f
+  800c71:	6a 23                	push   $0x23
+  800c73:	68 bc 2e 80 00       	push   $0x802ebc
+  800c78:	e8 ca f4 ff ff       	call   800147 <_panic>
+
+00800c7d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c7d:	55                   	push   %ebp
+  800c7e:	89 e5                	mov    %esp,%ebp
+  800c80:	57                   	push   %edi
+  800c81:	56                   	push   %esi
+  800c82:	53                   	push   %ebx
+  800c83:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c86:	be 00 00 00 00       	mov    $0x0,%esi
+  800c8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c91:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c99:	89 f7                	mov    %esi,%edi
+  800c9b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c9d:	85 c0                	test   %eax,%eax
+  800c9f:	7f 08                	jg     800ca9 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ca1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca4:	5b                   	pop    %ebx
+  800ca5:	5e                   	pop    %esi
+  800ca6:	5f                   	pop    %edi
+  800ca7:	5d                   	pop    %ebp
+  800ca8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca9:	83 ec 0c             	sub    $0xc,%esp
+  800cac:	50                   	push   %eax
+  800cad:	6a 05                	push   $0x5
+  800caf:	68 9f 2e 80 00       	push   $0x802e9f
+  800cb4:	6a 23                	push   $0x23
+  800cb6:	68 bc 2e 80 00       	push   $0x802ebc
+  800cbb:	e8 87 f4 ff ff       	call   800147 <_panic>
+
+00800cc0 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	57                   	push   %edi
+  800cc4:	56                   	push   %esi
+  800cc5:	53                   	push   %ebx
+  800cc6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cc9:	be 00 00 00 00       	mov    $0x0,%esi
+  800cce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd4:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cdc:	89 f7                	mov    %esi,%edi
+  800cde:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ce0:	85 c0                	test   %eax,%eax
+  800ce2:	7f 08                	jg     800cec <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ce4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce7:	5b                   	pop    %ebx
+  800ce8:	5e                   	pop    %esi
+  800ce9:	5f                   	pop    %edi
+  800cea:	5d                   	pop    %ebp
+  800ceb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cec:	83 ec 0c             	sub    $0xc,%esp
+  800cef:	50                   	push   %eax
+  800cf0:	6a 06                	push   $0x6
+  800cf2:	68 9f 2e 80 00       	push   $0x802e9f
+  800cf7:	6a 23                	push   $0x23
+  800cf9:	68 bc 2e 80 00       	push   $0x802ebc
+  800cfe:	e8 44 f4 ff ff       	call   800147 <_panic>
+
+00800d03 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d03:	55                   	push   %ebp
+  800d04:	89 e5                	mov    %esp,%ebp
+  800d06:	57                   	push   %edi
+  800d07:	56                   	push   %esi
+  800d08:	53                   	push   %ebx
+  800d09:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d12:	b8 07 00 00 00       	mov    $0x7,%eax
+  800d17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d1a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d1d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d20:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d22:	85 c0                	test   %eax,%eax
+  800d24:	7f 08                	jg     800d2e <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d29:	5b                   	pop    %ebx
+  800d2a:	5e                   	pop    %esi
+  800d2b:	5f                   	pop    %edi
+  800d2c:	5d                   	pop    %ebp
+  800d2d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d2e:	83 ec 0c             	sub    $0xc,%esp
+  800d31:	50                   	push   %eax
+  800d32:	6a 07                	push   $0x7
+  800d34:	68 9f 2e 80 00       	push   $0x802e9f
+  800d39:	6a 23                	push   $0x23
+  800d3b:	68 bc 2e 80 00       	push   $0x802ebc
+  800d40:	e8 02 f4 ff ff       	call   800147 <_panic>
+
+00800d45 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	57                   	push   %edi
+  800d49:	56                   	push   %esi
+  800d4a:	53                   	push   %ebx
+  800d4b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d59:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d5e:	89 df                	mov    %ebx,%edi
+  800d60:	89 de                	mov    %ebx,%esi
+  800d62:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d64:	85 c0                	test   %eax,%eax
+  800d66:	7f 08                	jg     800d70 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6b:	5b                   	pop    %ebx
+  800d6c:	5e                   	pop    %esi
+  800d6d:	5f                   	pop    %edi
+  800d6e:	5d                   	pop    %ebp
+  800d6f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d70:	83 ec 0c             	sub    $0xc,%esp
+  800d73:	50                   	push   %eax
+  800d74:	6a 08                	push   $0x8
+  800d76:	68 9f 2e 80 00       	push   $0x802e9f
+  800d7b:	6a 23                	push   $0x23
+  800d7d:	68 bc 2e 80 00       	push   $0x802ebc
+  800d82:	e8 c0 f3 ff ff       	call   800147 <_panic>
+
+00800d87 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	57                   	push   %edi
+  800d8b:	56                   	push   %esi
+  800d8c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d93:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d98:	be 00 00 00 00       	mov    $0x0,%esi
+  800d9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da3:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800da5:	5b                   	pop    %ebx
+  800da6:	5e                   	pop    %esi
+  800da7:	5f                   	pop    %edi
+  800da8:	5d                   	pop    %ebp
+  800da9:	c3                   	ret
+
+00800daa <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	57                   	push   %edi
+  800dae:	56                   	push   %esi
+  800daf:	53                   	push   %ebx
+  800db0:	8b 45 18             	mov    0x18(%ebp),%eax
+  800db3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800db6:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800dbb:	77 27                	ja     800de4 <sys_page_map_range+0x3a>
+  800dbd:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800dc3:	77 1f                	ja     800de4 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800dc5:	c1 e0 0c             	shl    $0xc,%eax
+  800dc8:	89 c6                	mov    %eax,%esi
+  800dca:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800dcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dda:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ddd:	cd 30                	int    $0x30
+}
+  800ddf:	5b                   	pop    %ebx
+  800de0:	5e                   	pop    %esi
+  800de1:	5f                   	pop    %edi
+  800de2:	5d                   	pop    %ebp
+  800de3:	c3                   	ret
+		return -E_INVAL;
+  800de4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800de9:	eb f4                	jmp    800ddf <sys_page_map_range+0x35>
+
+00800deb <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+  800dee:	57                   	push   %edi
+  800def:	56                   	push   %esi
+  800df0:	53                   	push   %ebx
+  800df1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dff:	be 00 00 00 00       	mov    $0x0,%esi
+  800e04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e07:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e0a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e0c:	85 c0                	test   %eax,%eax
+  800e0e:	7f 08                	jg     800e18 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800e10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e13:	5b                   	pop    %ebx
+  800e14:	5e                   	pop    %esi
+  800e15:	5f                   	pop    %edi
+  800e16:	5d                   	pop    %ebp
+  800e17:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e18:	83 ec 0c             	sub    $0xc,%esp
+  800e1b:	50                   	push   %eax
+  800e1c:	6a 0c                	push   $0xc
+  800e1e:	68 9f 2e 80 00       	push   $0x802e9f
+  800e23:	6a 23                	push   $0x23
+  800e25:	68 bc 2e 80 00       	push   $0x802ebc
+  800e2a:	e8 18 f3 ff ff       	call   800147 <_panic>
+
+00800e2f <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e2f:	55                   	push   %ebp
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	57                   	push   %edi
+  800e33:	56                   	push   %esi
+  800e34:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e35:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e40:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e48:	89 f7                	mov    %esi,%edi
+  800e4a:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5e                   	pop    %esi
+  800e4e:	5f                   	pop    %edi
+  800e4f:	5d                   	pop    %ebp
+  800e50:	c3                   	ret
+
+00800e51 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e51:	55                   	push   %ebp
+  800e52:	89 e5                	mov    %esp,%ebp
+  800e54:	57                   	push   %edi
+  800e55:	56                   	push   %esi
+  800e56:	53                   	push   %ebx
+  800e57:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e65:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e6a:	89 df                	mov    %ebx,%edi
+  800e6c:	89 de                	mov    %ebx,%esi
+  800e6e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e70:	85 c0                	test   %eax,%eax
+  800e72:	7f 08                	jg     800e7c <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e77:	5b                   	pop    %ebx
+  800e78:	5e                   	pop    %esi
+  800e79:	5f                   	pop    %edi
+  800e7a:	5d                   	pop    %ebp
+  800e7b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7c:	83 ec 0c             	sub    $0xc,%esp
+  800e7f:	50                   	push   %eax
+  800e80:	6a 0f                	push   $0xf
+  800e82:	68 9f 2e 80 00       	push   $0x802e9f
+  800e87:	6a 23                	push   $0x23
+  800e89:	68 bc 2e 80 00       	push   $0x802ebc
+  800e8e:	e8 b4 f2 ff ff       	call   800147 <_panic>
+
+00800e93 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	57                   	push   %edi
+  800e97:	56                   	push   %esi
+  800e98:	53                   	push   %ebx
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea7:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eac:	89 df                	mov    %ebx,%edi
+  800eae:	89 de                	mov    %ebx,%esi
+  800eb0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb2:	85 c0                	test   %eax,%eax
+  800eb4:	7f 08                	jg     800ebe <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800eb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5e                   	pop    %esi
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebe:	83 ec 0c             	sub    $0xc,%esp
+  800ec1:	50                   	push   %eax
+  800ec2:	6a 10                	push   $0x10
+  800ec4:	68 9f 2e 80 00       	push   $0x802e9f
+  800ec9:	6a 23                	push   $0x23
+  800ecb:	68 bc 2e 80 00       	push   $0x802ebc
+  800ed0:	e8 72 f2 ff ff       	call   800147 <_panic>
+
+00800ed5 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800ed5:	55                   	push   %ebp
+  800ed6:	89 e5                	mov    %esp,%ebp
+  800ed8:	57                   	push   %edi
+  800ed9:	56                   	push   %esi
+  800eda:	53                   	push   %ebx
+  800edb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ede:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee9:	b8 11 00 00 00       	mov    $0x11,%eax
+  800eee:	89 df                	mov    %ebx,%edi
+  800ef0:	89 de                	mov    %ebx,%esi
+  800ef2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef4:	85 c0                	test   %eax,%eax
+  800ef6:	7f 08                	jg     800f00 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800ef8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efb:	5b                   	pop    %ebx
+  800efc:	5e                   	pop    %esi
+  800efd:	5f                   	pop    %edi
+  800efe:	5d                   	pop    %ebp
+  800eff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f00:	83 ec 0c             	sub    $0xc,%esp
+  800f03:	50                   	push   %eax
+  800f04:	6a 11                	push   $0x11
+  800f06:	68 9f 2e 80 00       	push   $0x802e9f
+  800f0b:	6a 23                	push   $0x23
+  800f0d:	68 bc 2e 80 00       	push   $0x802ebc
+  800f12:	e8 30 f2 ff ff       	call   800147 <_panic>
+
+00800f17 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800f17:	55                   	push   %ebp
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	57                   	push   %edi
+  800f1b:	56                   	push   %esi
+  800f1c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f22:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f27:	89 d1                	mov    %edx,%ecx
+  800f29:	89 d3                	mov    %edx,%ebx
+  800f2b:	89 d7                	mov    %edx,%edi
+  800f2d:	89 d6                	mov    %edx,%esi
+  800f2f:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800f31:	5b                   	pop    %ebx
+  800f32:	5e                   	pop    %esi
+  800f33:	5f                   	pop    %edi
+  800f34:	5d                   	pop    %ebp
+  800f35:	c3                   	ret
+
+00800f36 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f36:	55                   	push   %ebp
+  800f37:	89 e5                	mov    %esp,%ebp
+  800f39:	57                   	push   %edi
+  800f3a:	56                   	push   %esi
+  800f3b:	53                   	push   %ebx
+  800f3c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4a:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f4f:	89 df                	mov    %ebx,%edi
+  800f51:	89 de                	mov    %ebx,%esi
+  800f53:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f55:	85 c0                	test   %eax,%eax
+  800f57:	7f 08                	jg     800f61 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5c:	5b                   	pop    %ebx
+  800f5d:	5e                   	pop    %esi
+  800f5e:	5f                   	pop    %edi
+  800f5f:	5d                   	pop    %ebp
+  800f60:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f61:	83 ec 0c             	sub    $0xc,%esp
+  800f64:	50                   	push   %eax
+  800f65:	6a 13                	push   $0x13
+  800f67:	68 9f 2e 80 00       	push   $0x802e9f
+  800f6c:	6a 23                	push   $0x23
+  800f6e:	68 bc 2e 80 00       	push   $0x802ebc
+  800f73:	e8 cf f1 ff ff       	call   800147 <_panic>
+
+00800f78 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f78:	55                   	push   %ebp
+  800f79:	89 e5                	mov    %esp,%ebp
+  800f7b:	57                   	push   %edi
+  800f7c:	56                   	push   %esi
+  800f7d:	53                   	push   %ebx
+  800f7e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8c:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f91:	89 df                	mov    %ebx,%edi
+  800f93:	89 de                	mov    %ebx,%esi
+  800f95:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f97:	85 c0                	test   %eax,%eax
+  800f99:	7f 08                	jg     800fa3 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9e:	5b                   	pop    %ebx
+  800f9f:	5e                   	pop    %esi
+  800fa0:	5f                   	pop    %edi
+  800fa1:	5d                   	pop    %ebp
+  800fa2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa3:	83 ec 0c             	sub    $0xc,%esp
+  800fa6:	50                   	push   %eax
+  800fa7:	6a 14                	push   $0x14
+  800fa9:	68 9f 2e 80 00       	push   $0x802e9f
+  800fae:	6a 23                	push   $0x23
+  800fb0:	68 bc 2e 80 00       	push   $0x802ebc
+  800fb5:	e8 8d f1 ff ff       	call   800147 <_panic>
+
+00800fba <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	57                   	push   %edi
+  800fbe:	56                   	push   %esi
+  800fbf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc6:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fcb:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fd6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fd8:	5b                   	pop    %ebx
+  800fd9:	5e                   	pop    %esi
+  800fda:	5f                   	pop    %edi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+
+00800fdd <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fe3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe9:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fee:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ff9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ffb:	5b                   	pop    %ebx
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5f                   	pop    %edi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+
+00801000 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	53                   	push   %ebx
+  801006:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801009:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80100e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801011:	b8 19 00 00 00       	mov    $0x19,%eax
+  801016:	89 cb                	mov    %ecx,%ebx
+  801018:	89 cf                	mov    %ecx,%edi
+  80101a:	89 ce                	mov    %ecx,%esi
+  80101c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80101e:	85 c0                	test   %eax,%eax
+  801020:	7f 08                	jg     80102a <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801022:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801025:	5b                   	pop    %ebx
+  801026:	5e                   	pop    %esi
+  801027:	5f                   	pop    %edi
+  801028:	5d                   	pop    %ebp
+  801029:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80102a:	83 ec 0c             	sub    $0xc,%esp
+  80102d:	50                   	push   %eax
+  80102e:	6a 19                	push   $0x19
+  801030:	68 9f 2e 80 00       	push   $0x802e9f
+  801035:	6a 23                	push   $0x23
+  801037:	68 bc 2e 80 00       	push   $0x802ebc
+  80103c:	e8 06 f1 ff ff       	call   800147 <_panic>
+
+00801041 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801041:	55                   	push   %ebp
+  801042:	89 e5                	mov    %esp,%ebp
+  801044:	57                   	push   %edi
+  801045:	56                   	push   %esi
+  801046:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801047:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801051:	89 d1                	mov    %edx,%ecx
+  801053:	89 d3                	mov    %edx,%ebx
+  801055:	89 d7                	mov    %edx,%edi
+  801057:	89 d6                	mov    %edx,%esi
+  801059:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80105b:	5b                   	pop    %ebx
+  80105c:	5e                   	pop    %esi
+  80105d:	5f                   	pop    %edi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+
+00801060 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	56                   	push   %esi
+  801065:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801066:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801071:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801076:	89 df                	mov    %ebx,%edi
+  801078:	89 de                	mov    %ebx,%esi
+  80107a:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  80107c:	5b                   	pop    %ebx
+  80107d:	5e                   	pop    %esi
+  80107e:	5f                   	pop    %edi
+  80107f:	5d                   	pop    %ebp
+  801080:	c3                   	ret
+
+00801081 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801081:	55                   	push   %ebp
+  801082:	89 e5                	mov    %esp,%ebp
+  801084:	57                   	push   %edi
+  801085:	56                   	push   %esi
+  801086:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801087:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801092:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801097:	89 df                	mov    %ebx,%edi
+  801099:	89 de                	mov    %ebx,%esi
+  80109b:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  80109d:	5b                   	pop    %ebx
+  80109e:	5e                   	pop    %esi
+  80109f:	5f                   	pop    %edi
+  8010a0:	5d                   	pop    %ebp
+  8010a1:	c3                   	ret
+
+008010a2 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8010a2:	55                   	push   %ebp
+  8010a3:	89 e5                	mov    %esp,%ebp
+  8010a5:	53                   	push   %ebx
+  8010a6:	83 ec 04             	sub    $0x4,%esp
+  8010a9:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8010ac:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  8010ae:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  8010b1:	f6 c2 02             	test   $0x2,%dl
+  8010b4:	74 7b                	je     801131 <pgfault+0x8f>
+  8010b6:	89 c1                	mov    %eax,%ecx
+  8010b8:	c1 e9 0c             	shr    $0xc,%ecx
+  8010bb:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8010c2:	f6 c5 08             	test   $0x8,%ch
+  8010c5:	74 6a                	je     801131 <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8010c7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8010cc:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8010ce:	83 ec 04             	sub    $0x4,%esp
+  8010d1:	6a 07                	push   $0x7
+  8010d3:	68 00 f0 7f 00       	push   $0x7ff000
+  8010d8:	6a 00                	push   $0x0
+  8010da:	e8 9e fb ff ff       	call   800c7d <sys_page_alloc>
+  8010df:	83 c4 10             	add    $0x10,%esp
+  8010e2:	85 c0                	test   %eax,%eax
+  8010e4:	78 61                	js     801147 <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  8010e6:	83 ec 04             	sub    $0x4,%esp
+  8010e9:	68 00 10 00 00       	push   $0x1000
+  8010ee:	53                   	push   %ebx
+  8010ef:	68 00 f0 7f 00       	push   $0x7ff000
+  8010f4:	e8 9d f8 ff ff       	call   800996 <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  8010f9:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801100:	53                   	push   %ebx
+  801101:	6a 00                	push   $0x0
+  801103:	68 00 f0 7f 00       	push   $0x7ff000
+  801108:	6a 00                	push   $0x0
+  80110a:	e8 f4 fb ff ff       	call   800d03 <sys_page_map>
+  80110f:	83 c4 20             	add    $0x20,%esp
+  801112:	85 c0                	test   %eax,%eax
+  801114:	78 43                	js     801159 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  801116:	83 ec 08             	sub    $0x8,%esp
+  801119:	68 00 f0 7f 00       	push   $0x7ff000
+  80111e:	6a 00                	push   $0x0
+  801120:	e8 20 fc ff ff       	call   800d45 <sys_page_unmap>
+  801125:	83 c4 10             	add    $0x10,%esp
+  801128:	85 c0                	test   %eax,%eax
+  80112a:	78 3f                	js     80116b <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  80112c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80112f:	c9                   	leave
+  801130:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  801131:	83 ec 0c             	sub    $0xc,%esp
+  801134:	50                   	push   %eax
+  801135:	52                   	push   %edx
+  801136:	68 ca 2e 80 00       	push   $0x802eca
+  80113b:	6a 19                	push   $0x19
+  80113d:	68 db 2e 80 00       	push   $0x802edb
+  801142:	e8 00 f0 ff ff       	call   800147 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801147:	50                   	push   %eax
+  801148:	68 e6 2e 80 00       	push   $0x802ee6
+  80114d:	6a 24                	push   $0x24
+  80114f:	68 db 2e 80 00       	push   $0x802edb
+  801154:	e8 ee ef ff ff       	call   800147 <_panic>
+		panic("sys_page_map: %e", r);
+  801159:	50                   	push   %eax
+  80115a:	68 f9 2e 80 00       	push   $0x802ef9
+  80115f:	6a 29                	push   $0x29
+  801161:	68 db 2e 80 00       	push   $0x802edb
+  801166:	e8 dc ef ff ff       	call   800147 <_panic>
+		panic("sys_page_unmap: %e", r);
+  80116b:	50                   	push   %eax
+  80116c:	68 0a 2f 80 00       	push   $0x802f0a
+  801171:	6a 2c                	push   $0x2c
+  801173:	68 db 2e 80 00       	push   $0x802edb
+  801178:	e8 ca ef ff ff       	call   800147 <_panic>
+
+0080117d <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  801183:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801186:	68 a2 10 80 00       	push   $0x8010a2
+  80118b:	e8 85 13 00 00       	call   802515 <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  801190:	83 c4 08             	add    $0x8,%esp
+  801193:	6a 01                	push   $0x1
+  801195:	6a 00                	push   $0x0
+  801197:	e8 9f fa ff ff       	call   800c3b <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  80119c:	e8 7b fa ff ff       	call   800c1c <sys_fork_cow>
+  8011a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  8011a4:	83 c4 10             	add    $0x10,%esp
+  8011a7:	85 c0                	test   %eax,%eax
+  8011a9:	74 2c                	je     8011d7 <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  8011ab:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8011af:	0f 85 8b 01 00 00    	jne    801340 <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8011b5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ba:	cd 30                	int    $0x30
+  8011bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8011bf:	85 c0                	test   %eax,%eax
+  8011c1:	78 30                	js     8011f3 <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  8011c3:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8011c8:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8011cd:	74 36                	je     801205 <fork+0x88>
+  8011cf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8011d2:	e9 99 00 00 00       	jmp    801270 <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8011d7:	e8 02 fa ff ff       	call   800bde <sys_getenvid>
+  8011dc:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8011e1:	c1 e0 09             	shl    $0x9,%eax
+  8011e4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8011e9:	a3 0c 50 80 00       	mov    %eax,0x80500c
+		return 0;
+  8011ee:	e9 4d 01 00 00       	jmp    801340 <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  8011f3:	50                   	push   %eax
+  8011f4:	68 1d 2f 80 00       	push   $0x802f1d
+  8011f9:	6a 7d                	push   $0x7d
+  8011fb:	68 db 2e 80 00       	push   $0x802edb
+  801200:	e8 42 ef ff ff       	call   800147 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801205:	e8 d4 f9 ff ff       	call   800bde <sys_getenvid>
+  80120a:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80120f:	c1 e0 09             	shl    $0x9,%eax
+  801212:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801217:	a3 0c 50 80 00       	mov    %eax,0x80500c
+		return 0;
+  80121c:	e9 1f 01 00 00       	jmp    801340 <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  801221:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801228:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80122b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801230:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801233:	83 ec 0c             	sub    $0xc,%esp
+  801236:	50                   	push   %eax
+  801237:	56                   	push   %esi
+  801238:	ff 75 e4             	push   -0x1c(%ebp)
+  80123b:	56                   	push   %esi
+  80123c:	6a 00                	push   $0x0
+  80123e:	e8 c0 fa ff ff       	call   800d03 <sys_page_map>
+  801243:	83 c4 20             	add    $0x20,%esp
+  801246:	85 c0                	test   %eax,%eax
+  801248:	0f 88 98 00 00 00    	js     8012e6 <fork+0x169>
+	if (perm & PTE_COW) {
+  80124e:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801255:	0f 85 61 01 00 00    	jne    8013bc <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80125b:	83 c7 01             	add    $0x1,%edi
+  80125e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801264:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  80126a:	0f 84 88 00 00 00    	je     8012f8 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  801270:	89 f0                	mov    %esi,%eax
+  801272:	c1 e8 16             	shr    $0x16,%eax
+  801275:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80127c:	25 81 00 00 00       	and    $0x81,%eax
+  801281:	83 f8 01             	cmp    $0x1,%eax
+  801284:	75 d5                	jne    80125b <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  801286:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  80128d:	a8 01                	test   $0x1,%al
+  80128f:	74 ca                	je     80125b <fork+0xde>
+  801291:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  801297:	74 c2                	je     80125b <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  801299:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  80129b:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8012a2:	f6 c4 04             	test   $0x4,%ah
+  8012a5:	0f 85 76 ff ff ff    	jne    801221 <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  8012ab:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8012b2:	a8 02                	test   $0x2,%al
+  8012b4:	0f 85 dc 00 00 00    	jne    801396 <fork+0x219>
+  8012ba:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8012c1:	f6 c4 08             	test   $0x8,%ah
+  8012c4:	0f 85 cc 00 00 00    	jne    801396 <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8012ca:	83 ec 0c             	sub    $0xc,%esp
+  8012cd:	6a 05                	push   $0x5
+  8012cf:	56                   	push   %esi
+  8012d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8012d3:	56                   	push   %esi
+  8012d4:	6a 00                	push   $0x0
+  8012d6:	e8 28 fa ff ff       	call   800d03 <sys_page_map>
+  8012db:	83 c4 20             	add    $0x20,%esp
+  8012de:	85 c0                	test   %eax,%eax
+  8012e0:	0f 89 75 ff ff ff    	jns    80125b <fork+0xde>
+		panic("sys_page_map: %e", r);
+  8012e6:	50                   	push   %eax
+  8012e7:	68 f9 2e 80 00       	push   $0x802ef9
+  8012ec:	6a 48                	push   $0x48
+  8012ee:	68 db 2e 80 00       	push   $0x802edb
+  8012f3:	e8 4f ee ff ff       	call   800147 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  8012f8:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8012fb:	83 ec 04             	sub    $0x4,%esp
+  8012fe:	6a 07                	push   $0x7
+  801300:	68 00 f0 bf ee       	push   $0xeebff000
+  801305:	53                   	push   %ebx
+  801306:	e8 72 f9 ff ff       	call   800c7d <sys_page_alloc>
+  80130b:	83 c4 10             	add    $0x10,%esp
+  80130e:	85 c0                	test   %eax,%eax
+  801310:	78 39                	js     80134b <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801312:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801317:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  80131d:	83 ec 08             	sub    $0x8,%esp
+  801320:	50                   	push   %eax
+  801321:	53                   	push   %ebx
+  801322:	e8 51 fc ff ff       	call   800f78 <sys_env_set_pgfault_upcall>
+  801327:	83 c4 10             	add    $0x10,%esp
+  80132a:	85 c0                	test   %eax,%eax
+  80132c:	78 36                	js     801364 <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80132e:	83 ec 08             	sub    $0x8,%esp
+  801331:	6a 02                	push   $0x2
+  801333:	53                   	push   %ebx
+  801334:	e8 18 fb ff ff       	call   800e51 <sys_env_set_status>
+  801339:	83 c4 10             	add    $0x10,%esp
+  80133c:	85 c0                	test   %eax,%eax
+  80133e:	78 3d                	js     80137d <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  801340:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801343:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801346:	5b                   	pop    %ebx
+  801347:	5e                   	pop    %esi
+  801348:	5f                   	pop    %edi
+  801349:	5d                   	pop    %ebp
+  80134a:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+  80134e:	53                   	push   %ebx
+  80134f:	50                   	push   %eax
+  801350:	68 44 2f 80 00       	push   $0x802f44
+  801355:	68 92 00 00 00       	push   $0x92
+  80135a:	68 db 2e 80 00       	push   $0x802edb
+  80135f:	e8 e3 ed ff ff       	call   800147 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  801364:	83 ec 0c             	sub    $0xc,%esp
+  801367:	53                   	push   %ebx
+  801368:	50                   	push   %eax
+  801369:	68 68 2f 80 00       	push   $0x802f68
+  80136e:	68 95 00 00 00       	push   $0x95
+  801373:	68 db 2e 80 00       	push   $0x802edb
+  801378:	e8 ca ed ff ff       	call   800147 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  80137d:	83 ec 0c             	sub    $0xc,%esp
+  801380:	53                   	push   %ebx
+  801381:	50                   	push   %eax
+  801382:	68 98 2f 80 00       	push   $0x802f98
+  801387:	68 98 00 00 00       	push   $0x98
+  80138c:	68 db 2e 80 00       	push   $0x802edb
+  801391:	e8 b1 ed ff ff       	call   800147 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801396:	83 ec 0c             	sub    $0xc,%esp
+  801399:	68 05 08 00 00       	push   $0x805
+  80139e:	53                   	push   %ebx
+  80139f:	ff 75 e4             	push   -0x1c(%ebp)
+  8013a2:	53                   	push   %ebx
+  8013a3:	6a 00                	push   $0x0
+  8013a5:	e8 59 f9 ff ff       	call   800d03 <sys_page_map>
+  8013aa:	83 c4 20             	add    $0x20,%esp
+  8013ad:	85 c0                	test   %eax,%eax
+  8013af:	0f 88 31 ff ff ff    	js     8012e6 <fork+0x169>
+		perm |= PTE_COW;
+  8013b5:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  8013bc:	83 ec 0c             	sub    $0xc,%esp
+  8013bf:	ff 75 e0             	push   -0x20(%ebp)
+  8013c2:	53                   	push   %ebx
+  8013c3:	6a 00                	push   $0x0
+  8013c5:	53                   	push   %ebx
+  8013c6:	6a 00                	push   $0x0
+  8013c8:	e8 36 f9 ff ff       	call   800d03 <sys_page_map>
+  8013cd:	83 c4 20             	add    $0x20,%esp
+  8013d0:	85 c0                	test   %eax,%eax
+  8013d2:	0f 89 83 fe ff ff    	jns    80125b <fork+0xde>
+			panic("sys_page_map: %e", r);
+  8013d8:	50                   	push   %eax
+  8013d9:	68 f9 2e 80 00       	push   $0x802ef9
+  8013de:	6a 4c                	push   $0x4c
+  8013e0:	68 db 2e 80 00       	push   $0x802edb
+  8013e5:	e8 5d ed ff ff       	call   800147 <_panic>
+
+008013ea <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8013ea:	55                   	push   %ebp
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8013f0:	68 2d 2f 80 00       	push   $0x802f2d
+  8013f5:	68 a0 00 00 00       	push   $0xa0
+  8013fa:	68 db 2e 80 00       	push   $0x802edb
+  8013ff:	e8 43 ed ff ff       	call   800147 <_panic>
+
+00801404 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801404:	55                   	push   %ebp
+  801405:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801407:	8b 45 08             	mov    0x8(%ebp),%eax
+  80140a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80140f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801412:	5d                   	pop    %ebp
+  801413:	c3                   	ret
+
+00801414 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801414:	55                   	push   %ebp
+  801415:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801417:	8b 45 08             	mov    0x8(%ebp),%eax
+  80141a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80141f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801424:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801429:	5d                   	pop    %ebp
+  80142a:	c3                   	ret
+
+0080142b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80142b:	55                   	push   %ebp
+  80142c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80142e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801433:	eb 02                	jmp    801437 <fd_alloc+0xc>
+  801435:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801437:	89 c2                	mov    %eax,%edx
+  801439:	c1 ea 16             	shr    $0x16,%edx
+  80143c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801443:	f6 c2 01             	test   $0x1,%dl
+  801446:	74 2b                	je     801473 <fd_alloc+0x48>
+  801448:	89 c2                	mov    %eax,%edx
+  80144a:	c1 ea 0c             	shr    $0xc,%edx
+  80144d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801454:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80145a:	f6 c1 01             	test   $0x1,%cl
+  80145d:	74 14                	je     801473 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80145f:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801465:	75 ce                	jne    801435 <fd_alloc+0xa>
+  801467:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80146c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801471:	eb 05                	jmp    801478 <fd_alloc+0x4d>
+			return 0;
+  801473:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801478:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147b:	89 02                	mov    %eax,(%edx)
+}
+  80147d:	89 c8                	mov    %ecx,%eax
+  80147f:	5d                   	pop    %ebp
+  801480:	c3                   	ret
+
+00801481 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801481:	55                   	push   %ebp
+  801482:	89 e5                	mov    %esp,%ebp
+  801484:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801487:	83 f8 1f             	cmp    $0x1f,%eax
+  80148a:	77 30                	ja     8014bc <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80148c:	c1 e0 0c             	shl    $0xc,%eax
+  80148f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801494:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80149a:	f6 c2 01             	test   $0x1,%dl
+  80149d:	74 24                	je     8014c3 <fd_lookup+0x42>
+  80149f:	89 c2                	mov    %eax,%edx
+  8014a1:	c1 ea 0c             	shr    $0xc,%edx
+  8014a4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8014ab:	f6 c2 01             	test   $0x1,%dl
+  8014ae:	74 1a                	je     8014ca <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8014b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014b3:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8014b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014ba:	5d                   	pop    %ebp
+  8014bb:	c3                   	ret
+		return -E_INVAL;
+  8014bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014c1:	eb f7                	jmp    8014ba <fd_lookup+0x39>
+		return -E_INVAL;
+  8014c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014c8:	eb f0                	jmp    8014ba <fd_lookup+0x39>
+  8014ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014cf:	eb e9                	jmp    8014ba <fd_lookup+0x39>
+
+008014d1 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8014d1:	55                   	push   %ebp
+  8014d2:	89 e5                	mov    %esp,%ebp
+  8014d4:	53                   	push   %ebx
+  8014d5:	83 ec 04             	sub    $0x4,%esp
+  8014d8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e0:	eb 03                	jmp    8014e5 <dev_lookup+0x14>
+  8014e2:	83 c0 01             	add    $0x1,%eax
+  8014e5:	8b 1c 85 3c 30 80 00 	mov    0x80303c(,%eax,4),%ebx
+  8014ec:	85 db                	test   %ebx,%ebx
+  8014ee:	74 0b                	je     8014fb <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8014f0:	39 13                	cmp    %edx,(%ebx)
+  8014f2:	75 ee                	jne    8014e2 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8014f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f9:	eb 1f                	jmp    80151a <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014fb:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801500:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801503:	83 ec 04             	sub    $0x4,%esp
+  801506:	52                   	push   %edx
+  801507:	50                   	push   %eax
+  801508:	68 c0 2f 80 00       	push   $0x802fc0
+  80150d:	e8 10 ed ff ff       	call   800222 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80151a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80151d:	89 1a                	mov    %ebx,(%edx)
+}
+  80151f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801522:	c9                   	leave
+  801523:	c3                   	ret
+
+00801524 <fd_close>:
+{
+  801524:	55                   	push   %ebp
+  801525:	89 e5                	mov    %esp,%ebp
+  801527:	57                   	push   %edi
+  801528:	56                   	push   %esi
+  801529:	53                   	push   %ebx
+  80152a:	83 ec 24             	sub    $0x24,%esp
+  80152d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801530:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801533:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801536:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801537:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80153d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801540:	50                   	push   %eax
+  801541:	e8 3b ff ff ff       	call   801481 <fd_lookup>
+  801546:	89 c3                	mov    %eax,%ebx
+  801548:	83 c4 10             	add    $0x10,%esp
+  80154b:	85 c0                	test   %eax,%eax
+  80154d:	78 05                	js     801554 <fd_close+0x30>
+	    || fd != fd2)
+  80154f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801552:	74 16                	je     80156a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801554:	89 f8                	mov    %edi,%eax
+  801556:	84 c0                	test   %al,%al
+  801558:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801560:	89 d8                	mov    %ebx,%eax
+  801562:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801565:	5b                   	pop    %ebx
+  801566:	5e                   	pop    %esi
+  801567:	5f                   	pop    %edi
+  801568:	5d                   	pop    %ebp
+  801569:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80156a:	83 ec 08             	sub    $0x8,%esp
+  80156d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801570:	50                   	push   %eax
+  801571:	ff 36                	push   (%esi)
+  801573:	e8 59 ff ff ff       	call   8014d1 <dev_lookup>
+  801578:	89 c3                	mov    %eax,%ebx
+  80157a:	83 c4 10             	add    $0x10,%esp
+  80157d:	85 c0                	test   %eax,%eax
+  80157f:	78 1a                	js     80159b <fd_close+0x77>
+		if (dev->dev_close)
+  801581:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801584:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801587:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80158c:	85 c0                	test   %eax,%eax
+  80158e:	74 0b                	je     80159b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801590:	83 ec 0c             	sub    $0xc,%esp
+  801593:	56                   	push   %esi
+  801594:	ff d0                	call   *%eax
+  801596:	89 c3                	mov    %eax,%ebx
+  801598:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80159b:	83 ec 08             	sub    $0x8,%esp
+  80159e:	56                   	push   %esi
+  80159f:	6a 00                	push   $0x0
+  8015a1:	e8 9f f7 ff ff       	call   800d45 <sys_page_unmap>
+	return r;
+  8015a6:	83 c4 10             	add    $0x10,%esp
+  8015a9:	eb b5                	jmp    801560 <fd_close+0x3c>
+
+008015ab <close>:
+
+int
+close(int fdnum)
+{
+  8015ab:	55                   	push   %ebp
+  8015ac:	89 e5                	mov    %esp,%ebp
+  8015ae:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b4:	50                   	push   %eax
+  8015b5:	ff 75 08             	push   0x8(%ebp)
+  8015b8:	e8 c4 fe ff ff       	call   801481 <fd_lookup>
+  8015bd:	83 c4 10             	add    $0x10,%esp
+  8015c0:	85 c0                	test   %eax,%eax
+  8015c2:	79 02                	jns    8015c6 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8015c4:	c9                   	leave
+  8015c5:	c3                   	ret
+		return fd_close(fd, 1);
+  8015c6:	83 ec 08             	sub    $0x8,%esp
+  8015c9:	6a 01                	push   $0x1
+  8015cb:	ff 75 f4             	push   -0xc(%ebp)
+  8015ce:	e8 51 ff ff ff       	call   801524 <fd_close>
+  8015d3:	83 c4 10             	add    $0x10,%esp
+  8015d6:	eb ec                	jmp    8015c4 <close+0x19>
+
+008015d8 <close_all>:
+
+void
+close_all(void)
+{
+  8015d8:	55                   	push   %ebp
+  8015d9:	89 e5                	mov    %esp,%ebp
+  8015db:	53                   	push   %ebx
+  8015dc:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8015df:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015e4:	83 ec 0c             	sub    $0xc,%esp
+  8015e7:	53                   	push   %ebx
+  8015e8:	e8 be ff ff ff       	call   8015ab <close>
+	for (i = 0; i < MAXFD; i++)
+  8015ed:	83 c3 01             	add    $0x1,%ebx
+  8015f0:	83 c4 10             	add    $0x10,%esp
+  8015f3:	83 fb 20             	cmp    $0x20,%ebx
+  8015f6:	75 ec                	jne    8015e4 <close_all+0xc>
+}
+  8015f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015fb:	c9                   	leave
+  8015fc:	c3                   	ret
+
+008015fd <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015fd:	55                   	push   %ebp
+  8015fe:	89 e5                	mov    %esp,%ebp
+  801600:	57                   	push   %edi
+  801601:	56                   	push   %esi
+  801602:	53                   	push   %ebx
+  801603:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801606:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801609:	50                   	push   %eax
+  80160a:	ff 75 08             	push   0x8(%ebp)
+  80160d:	e8 6f fe ff ff       	call   801481 <fd_lookup>
+  801612:	89 c3                	mov    %eax,%ebx
+  801614:	83 c4 10             	add    $0x10,%esp
+  801617:	85 c0                	test   %eax,%eax
+  801619:	78 7f                	js     80169a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80161b:	83 ec 0c             	sub    $0xc,%esp
+  80161e:	ff 75 0c             	push   0xc(%ebp)
+  801621:	e8 85 ff ff ff       	call   8015ab <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801626:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801629:	c1 e6 0c             	shl    $0xc,%esi
+  80162c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801632:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801635:	89 3c 24             	mov    %edi,(%esp)
+  801638:	e8 d7 fd ff ff       	call   801414 <fd2data>
+  80163d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80163f:	89 34 24             	mov    %esi,(%esp)
+  801642:	e8 cd fd ff ff       	call   801414 <fd2data>
+  801647:	83 c4 10             	add    $0x10,%esp
+  80164a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80164d:	89 d8                	mov    %ebx,%eax
+  80164f:	c1 e8 16             	shr    $0x16,%eax
+  801652:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801659:	a8 01                	test   $0x1,%al
+  80165b:	74 11                	je     80166e <dup+0x71>
+  80165d:	89 d8                	mov    %ebx,%eax
+  80165f:	c1 e8 0c             	shr    $0xc,%eax
+  801662:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801669:	f6 c2 01             	test   $0x1,%dl
+  80166c:	75 36                	jne    8016a4 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80166e:	89 f8                	mov    %edi,%eax
+  801670:	c1 e8 0c             	shr    $0xc,%eax
+  801673:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80167a:	83 ec 0c             	sub    $0xc,%esp
+  80167d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801682:	50                   	push   %eax
+  801683:	56                   	push   %esi
+  801684:	6a 00                	push   $0x0
+  801686:	57                   	push   %edi
+  801687:	6a 00                	push   $0x0
+  801689:	e8 75 f6 ff ff       	call   800d03 <sys_page_map>
+  80168e:	89 c3                	mov    %eax,%ebx
+  801690:	83 c4 20             	add    $0x20,%esp
+  801693:	85 c0                	test   %eax,%eax
+  801695:	78 33                	js     8016ca <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801697:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80169a:	89 d8                	mov    %ebx,%eax
+  80169c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169f:	5b                   	pop    %ebx
+  8016a0:	5e                   	pop    %esi
+  8016a1:	5f                   	pop    %edi
+  8016a2:	5d                   	pop    %ebp
+  8016a3:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8016a4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016ab:	83 ec 0c             	sub    $0xc,%esp
+  8016ae:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016b3:	50                   	push   %eax
+  8016b4:	ff 75 d4             	push   -0x2c(%ebp)
+  8016b7:	6a 00                	push   $0x0
+  8016b9:	53                   	push   %ebx
+  8016ba:	6a 00                	push   $0x0
+  8016bc:	e8 42 f6 ff ff       	call   800d03 <sys_page_map>
+  8016c1:	89 c3                	mov    %eax,%ebx
+  8016c3:	83 c4 20             	add    $0x20,%esp
+  8016c6:	85 c0                	test   %eax,%eax
+  8016c8:	79 a4                	jns    80166e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8016ca:	83 ec 08             	sub    $0x8,%esp
+  8016cd:	56                   	push   %esi
+  8016ce:	6a 00                	push   $0x0
+  8016d0:	e8 70 f6 ff ff       	call   800d45 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8016d5:	83 c4 08             	add    $0x8,%esp
+  8016d8:	ff 75 d4             	push   -0x2c(%ebp)
+  8016db:	6a 00                	push   $0x0
+  8016dd:	e8 63 f6 ff ff       	call   800d45 <sys_page_unmap>
+	return r;
+  8016e2:	83 c4 10             	add    $0x10,%esp
+  8016e5:	eb b3                	jmp    80169a <dup+0x9d>
+
+008016e7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016e7:	55                   	push   %ebp
+  8016e8:	89 e5                	mov    %esp,%ebp
+  8016ea:	56                   	push   %esi
+  8016eb:	53                   	push   %ebx
+  8016ec:	83 ec 18             	sub    $0x18,%esp
+  8016ef:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016f2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016f5:	50                   	push   %eax
+  8016f6:	56                   	push   %esi
+  8016f7:	e8 85 fd ff ff       	call   801481 <fd_lookup>
+  8016fc:	83 c4 10             	add    $0x10,%esp
+  8016ff:	85 c0                	test   %eax,%eax
+  801701:	78 3c                	js     80173f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801703:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801706:	83 ec 08             	sub    $0x8,%esp
+  801709:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80170c:	50                   	push   %eax
+  80170d:	ff 33                	push   (%ebx)
+  80170f:	e8 bd fd ff ff       	call   8014d1 <dev_lookup>
+  801714:	83 c4 10             	add    $0x10,%esp
+  801717:	85 c0                	test   %eax,%eax
+  801719:	78 24                	js     80173f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80171b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80171e:	83 e0 03             	and    $0x3,%eax
+  801721:	83 f8 01             	cmp    $0x1,%eax
+  801724:	74 20                	je     801746 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801726:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801729:	8b 40 08             	mov    0x8(%eax),%eax
+  80172c:	85 c0                	test   %eax,%eax
+  80172e:	74 37                	je     801767 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801730:	83 ec 04             	sub    $0x4,%esp
+  801733:	ff 75 10             	push   0x10(%ebp)
+  801736:	ff 75 0c             	push   0xc(%ebp)
+  801739:	53                   	push   %ebx
+  80173a:	ff d0                	call   *%eax
+  80173c:	83 c4 10             	add    $0x10,%esp
+}
+  80173f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801742:	5b                   	pop    %ebx
+  801743:	5e                   	pop    %esi
+  801744:	5d                   	pop    %ebp
+  801745:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801746:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  80174b:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80174e:	83 ec 04             	sub    $0x4,%esp
+  801751:	56                   	push   %esi
+  801752:	50                   	push   %eax
+  801753:	68 01 30 80 00       	push   $0x803001
+  801758:	e8 c5 ea ff ff       	call   800222 <cprintf>
+		return -E_INVAL;
+  80175d:	83 c4 10             	add    $0x10,%esp
+  801760:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801765:	eb d8                	jmp    80173f <read+0x58>
+		return -E_NOT_SUPP;
+  801767:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80176c:	eb d1                	jmp    80173f <read+0x58>
+
+0080176e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80176e:	55                   	push   %ebp
+  80176f:	89 e5                	mov    %esp,%ebp
+  801771:	57                   	push   %edi
+  801772:	56                   	push   %esi
+  801773:	53                   	push   %ebx
+  801774:	83 ec 0c             	sub    $0xc,%esp
+  801777:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80177a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80177d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801782:	eb 02                	jmp    801786 <readn+0x18>
+  801784:	01 c3                	add    %eax,%ebx
+  801786:	39 f3                	cmp    %esi,%ebx
+  801788:	73 21                	jae    8017ab <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80178a:	83 ec 04             	sub    $0x4,%esp
+  80178d:	89 f0                	mov    %esi,%eax
+  80178f:	29 d8                	sub    %ebx,%eax
+  801791:	50                   	push   %eax
+  801792:	89 d8                	mov    %ebx,%eax
+  801794:	03 45 0c             	add    0xc(%ebp),%eax
+  801797:	50                   	push   %eax
+  801798:	57                   	push   %edi
+  801799:	e8 49 ff ff ff       	call   8016e7 <read>
+		if (m < 0)
+  80179e:	83 c4 10             	add    $0x10,%esp
+  8017a1:	85 c0                	test   %eax,%eax
+  8017a3:	78 04                	js     8017a9 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8017a5:	75 dd                	jne    801784 <readn+0x16>
+  8017a7:	eb 02                	jmp    8017ab <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017a9:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8017ab:	89 d8                	mov    %ebx,%eax
+  8017ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b0:	5b                   	pop    %ebx
+  8017b1:	5e                   	pop    %esi
+  8017b2:	5f                   	pop    %edi
+  8017b3:	5d                   	pop    %ebp
+  8017b4:	c3                   	ret
+
+008017b5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8017b5:	55                   	push   %ebp
+  8017b6:	89 e5                	mov    %esp,%ebp
+  8017b8:	56                   	push   %esi
+  8017b9:	53                   	push   %ebx
+  8017ba:	83 ec 18             	sub    $0x18,%esp
+  8017bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017c0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017c3:	50                   	push   %eax
+  8017c4:	53                   	push   %ebx
+  8017c5:	e8 b7 fc ff ff       	call   801481 <fd_lookup>
+  8017ca:	83 c4 10             	add    $0x10,%esp
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	78 37                	js     801808 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017d1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017d4:	83 ec 08             	sub    $0x8,%esp
+  8017d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017da:	50                   	push   %eax
+  8017db:	ff 36                	push   (%esi)
+  8017dd:	e8 ef fc ff ff       	call   8014d1 <dev_lookup>
+  8017e2:	83 c4 10             	add    $0x10,%esp
+  8017e5:	85 c0                	test   %eax,%eax
+  8017e7:	78 1f                	js     801808 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017e9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017ed:	74 20                	je     80180f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8017ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017f5:	85 c0                	test   %eax,%eax
+  8017f7:	74 37                	je     801830 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8017f9:	83 ec 04             	sub    $0x4,%esp
+  8017fc:	ff 75 10             	push   0x10(%ebp)
+  8017ff:	ff 75 0c             	push   0xc(%ebp)
+  801802:	56                   	push   %esi
+  801803:	ff d0                	call   *%eax
+  801805:	83 c4 10             	add    $0x10,%esp
+}
+  801808:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80180b:	5b                   	pop    %ebx
+  80180c:	5e                   	pop    %esi
+  80180d:	5d                   	pop    %ebp
+  80180e:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80180f:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801814:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801817:	83 ec 04             	sub    $0x4,%esp
+  80181a:	53                   	push   %ebx
+  80181b:	50                   	push   %eax
+  80181c:	68 1d 30 80 00       	push   $0x80301d
+  801821:	e8 fc e9 ff ff       	call   800222 <cprintf>
+		return -E_INVAL;
+  801826:	83 c4 10             	add    $0x10,%esp
+  801829:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80182e:	eb d8                	jmp    801808 <write+0x53>
+		return -E_NOT_SUPP;
+  801830:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801835:	eb d1                	jmp    801808 <write+0x53>
+
+00801837 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801837:	55                   	push   %ebp
+  801838:	89 e5                	mov    %esp,%ebp
+  80183a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80183d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801840:	50                   	push   %eax
+  801841:	ff 75 08             	push   0x8(%ebp)
+  801844:	e8 38 fc ff ff       	call   801481 <fd_lookup>
+  801849:	83 c4 10             	add    $0x10,%esp
+  80184c:	85 c0                	test   %eax,%eax
+  80184e:	78 0e                	js     80185e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801850:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801853:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801856:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801859:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80185e:	c9                   	leave
+  80185f:	c3                   	ret
+
+00801860 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801860:	55                   	push   %ebp
+  801861:	89 e5                	mov    %esp,%ebp
+  801863:	56                   	push   %esi
+  801864:	53                   	push   %ebx
+  801865:	83 ec 18             	sub    $0x18,%esp
+  801868:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80186b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80186e:	50                   	push   %eax
+  80186f:	53                   	push   %ebx
+  801870:	e8 0c fc ff ff       	call   801481 <fd_lookup>
+  801875:	83 c4 10             	add    $0x10,%esp
+  801878:	85 c0                	test   %eax,%eax
+  80187a:	78 34                	js     8018b0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80187c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80187f:	83 ec 08             	sub    $0x8,%esp
+  801882:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801885:	50                   	push   %eax
+  801886:	ff 36                	push   (%esi)
+  801888:	e8 44 fc ff ff       	call   8014d1 <dev_lookup>
+  80188d:	83 c4 10             	add    $0x10,%esp
+  801890:	85 c0                	test   %eax,%eax
+  801892:	78 1c                	js     8018b0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801894:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801898:	74 1d                	je     8018b7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80189a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80189d:	8b 40 18             	mov    0x18(%eax),%eax
+  8018a0:	85 c0                	test   %eax,%eax
+  8018a2:	74 34                	je     8018d8 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8018a4:	83 ec 08             	sub    $0x8,%esp
+  8018a7:	ff 75 0c             	push   0xc(%ebp)
+  8018aa:	56                   	push   %esi
+  8018ab:	ff d0                	call   *%eax
+  8018ad:	83 c4 10             	add    $0x10,%esp
+}
+  8018b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b3:	5b                   	pop    %ebx
+  8018b4:	5e                   	pop    %esi
+  8018b5:	5d                   	pop    %ebp
+  8018b6:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8018b7:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8018bc:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8018bf:	83 ec 04             	sub    $0x4,%esp
+  8018c2:	53                   	push   %ebx
+  8018c3:	50                   	push   %eax
+  8018c4:	68 e0 2f 80 00       	push   $0x802fe0
+  8018c9:	e8 54 e9 ff ff       	call   800222 <cprintf>
+		return -E_INVAL;
+  8018ce:	83 c4 10             	add    $0x10,%esp
+  8018d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018d6:	eb d8                	jmp    8018b0 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8018d8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018dd:	eb d1                	jmp    8018b0 <ftruncate+0x50>
+
+008018df <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018df:	55                   	push   %ebp
+  8018e0:	89 e5                	mov    %esp,%ebp
+  8018e2:	56                   	push   %esi
+  8018e3:	53                   	push   %ebx
+  8018e4:	83 ec 18             	sub    $0x18,%esp
+  8018e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018ea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ed:	50                   	push   %eax
+  8018ee:	ff 75 08             	push   0x8(%ebp)
+  8018f1:	e8 8b fb ff ff       	call   801481 <fd_lookup>
+  8018f6:	83 c4 10             	add    $0x10,%esp
+  8018f9:	85 c0                	test   %eax,%eax
+  8018fb:	78 49                	js     801946 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018fd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801900:	83 ec 08             	sub    $0x8,%esp
+  801903:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801906:	50                   	push   %eax
+  801907:	ff 36                	push   (%esi)
+  801909:	e8 c3 fb ff ff       	call   8014d1 <dev_lookup>
+  80190e:	83 c4 10             	add    $0x10,%esp
+  801911:	85 c0                	test   %eax,%eax
+  801913:	78 31                	js     801946 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801915:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801918:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80191c:	74 2f                	je     80194d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80191e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801921:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801928:	00 00 00 
+	stat->st_isdir = 0;
+  80192b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801932:	00 00 00 
+	stat->st_dev = dev;
+  801935:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80193b:	83 ec 08             	sub    $0x8,%esp
+  80193e:	53                   	push   %ebx
+  80193f:	56                   	push   %esi
+  801940:	ff 50 14             	call   *0x14(%eax)
+  801943:	83 c4 10             	add    $0x10,%esp
+}
+  801946:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801949:	5b                   	pop    %ebx
+  80194a:	5e                   	pop    %esi
+  80194b:	5d                   	pop    %ebp
+  80194c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80194d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801952:	eb f2                	jmp    801946 <fstat+0x67>
+
+00801954 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801954:	55                   	push   %ebp
+  801955:	89 e5                	mov    %esp,%ebp
+  801957:	56                   	push   %esi
+  801958:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801959:	83 ec 08             	sub    $0x8,%esp
+  80195c:	6a 00                	push   $0x0
+  80195e:	ff 75 08             	push   0x8(%ebp)
+  801961:	e8 e4 01 00 00       	call   801b4a <open>
+  801966:	89 c3                	mov    %eax,%ebx
+  801968:	83 c4 10             	add    $0x10,%esp
+  80196b:	85 c0                	test   %eax,%eax
+  80196d:	78 1b                	js     80198a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80196f:	83 ec 08             	sub    $0x8,%esp
+  801972:	ff 75 0c             	push   0xc(%ebp)
+  801975:	50                   	push   %eax
+  801976:	e8 64 ff ff ff       	call   8018df <fstat>
+  80197b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80197d:	89 1c 24             	mov    %ebx,(%esp)
+  801980:	e8 26 fc ff ff       	call   8015ab <close>
+	return r;
+  801985:	83 c4 10             	add    $0x10,%esp
+  801988:	89 f3                	mov    %esi,%ebx
+}
+  80198a:	89 d8                	mov    %ebx,%eax
+  80198c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80198f:	5b                   	pop    %ebx
+  801990:	5e                   	pop    %esi
+  801991:	5d                   	pop    %ebp
+  801992:	c3                   	ret
+
+00801993 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801993:	55                   	push   %ebp
+  801994:	89 e5                	mov    %esp,%ebp
+  801996:	56                   	push   %esi
+  801997:	53                   	push   %ebx
+  801998:	89 c6                	mov    %eax,%esi
+  80199a:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80199c:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8019a3:	74 27                	je     8019cc <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8019a5:	6a 07                	push   $0x7
+  8019a7:	68 00 60 80 00       	push   $0x806000
+  8019ac:	56                   	push   %esi
+  8019ad:	ff 35 00 50 80 00    	push   0x805000
+  8019b3:	e8 66 0c 00 00       	call   80261e <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8019b8:	83 c4 0c             	add    $0xc,%esp
+  8019bb:	6a 00                	push   $0x0
+  8019bd:	53                   	push   %ebx
+  8019be:	6a 00                	push   $0x0
+  8019c0:	e8 e1 0b 00 00       	call   8025a6 <ipc_recv>
+}
+  8019c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019c8:	5b                   	pop    %ebx
+  8019c9:	5e                   	pop    %esi
+  8019ca:	5d                   	pop    %ebp
+  8019cb:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019cc:	83 ec 0c             	sub    $0xc,%esp
+  8019cf:	6a 01                	push   $0x1
+  8019d1:	e8 9c 0c 00 00       	call   802672 <ipc_find_env>
+  8019d6:	a3 00 50 80 00       	mov    %eax,0x805000
+  8019db:	83 c4 10             	add    $0x10,%esp
+  8019de:	eb c5                	jmp    8019a5 <fsipc+0x12>
+
+008019e0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019e0:	55                   	push   %ebp
+  8019e1:	89 e5                	mov    %esp,%ebp
+  8019e3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ec:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8019f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019f4:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019fe:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a03:	e8 8b ff ff ff       	call   801993 <fsipc>
+}
+  801a08:	c9                   	leave
+  801a09:	c3                   	ret
+
+00801a0a <devfile_flush>:
+{
+  801a0a:	55                   	push   %ebp
+  801a0b:	89 e5                	mov    %esp,%ebp
+  801a0d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a10:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a13:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a16:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801a1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a20:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a25:	e8 69 ff ff ff       	call   801993 <fsipc>
+}
+  801a2a:	c9                   	leave
+  801a2b:	c3                   	ret
+
+00801a2c <devfile_stat>:
+{
+  801a2c:	55                   	push   %ebp
+  801a2d:	89 e5                	mov    %esp,%ebp
+  801a2f:	53                   	push   %ebx
+  801a30:	83 ec 04             	sub    $0x4,%esp
+  801a33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a39:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a3c:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a46:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a4b:	e8 43 ff ff ff       	call   801993 <fsipc>
+  801a50:	85 c0                	test   %eax,%eax
+  801a52:	78 2c                	js     801a80 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a54:	83 ec 08             	sub    $0x8,%esp
+  801a57:	68 00 60 80 00       	push   $0x806000
+  801a5c:	53                   	push   %ebx
+  801a5d:	e8 ae ed ff ff       	call   800810 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a62:	a1 80 60 80 00       	mov    0x806080,%eax
+  801a67:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a6d:	a1 84 60 80 00       	mov    0x806084,%eax
+  801a72:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801a78:	83 c4 10             	add    $0x10,%esp
+  801a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a83:	c9                   	leave
+  801a84:	c3                   	ret
+
+00801a85 <devfile_write>:
+{
+  801a85:	55                   	push   %ebp
+  801a86:	89 e5                	mov    %esp,%ebp
+  801a88:	83 ec 0c             	sub    $0xc,%esp
+  801a8b:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a8e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a93:	39 d0                	cmp    %edx,%eax
+  801a95:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a98:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9b:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a9e:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801aa4:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801aa9:	50                   	push   %eax
+  801aaa:	ff 75 0c             	push   0xc(%ebp)
+  801aad:	68 08 60 80 00       	push   $0x806008
+  801ab2:	e8 df ee ff ff       	call   800996 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801ab7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801abc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ac1:	e8 cd fe ff ff       	call   801993 <fsipc>
+}
+  801ac6:	c9                   	leave
+  801ac7:	c3                   	ret
+
+00801ac8 <devfile_read>:
+{
+  801ac8:	55                   	push   %ebp
+  801ac9:	89 e5                	mov    %esp,%ebp
+  801acb:	56                   	push   %esi
+  801acc:	53                   	push   %ebx
+  801acd:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ad0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ad6:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801adb:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ae1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae6:	b8 03 00 00 00       	mov    $0x3,%eax
+  801aeb:	e8 a3 fe ff ff       	call   801993 <fsipc>
+  801af0:	89 c3                	mov    %eax,%ebx
+  801af2:	85 c0                	test   %eax,%eax
+  801af4:	78 1f                	js     801b15 <devfile_read+0x4d>
+	assert(r <= n);
+  801af6:	39 c6                	cmp    %eax,%esi
+  801af8:	72 24                	jb     801b1e <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801afa:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801aff:	7f 33                	jg     801b34 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b01:	83 ec 04             	sub    $0x4,%esp
+  801b04:	50                   	push   %eax
+  801b05:	68 00 60 80 00       	push   $0x806000
+  801b0a:	ff 75 0c             	push   0xc(%ebp)
+  801b0d:	e8 84 ee ff ff       	call   800996 <memmove>
+	return r;
+  801b12:	83 c4 10             	add    $0x10,%esp
+}
+  801b15:	89 d8                	mov    %ebx,%eax
+  801b17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b1a:	5b                   	pop    %ebx
+  801b1b:	5e                   	pop    %esi
+  801b1c:	5d                   	pop    %ebp
+  801b1d:	c3                   	ret
+	assert(r <= n);
+  801b1e:	68 50 30 80 00       	push   $0x803050
+  801b23:	68 57 30 80 00       	push   $0x803057
+  801b28:	6a 7c                	push   $0x7c
+  801b2a:	68 6c 30 80 00       	push   $0x80306c
+  801b2f:	e8 13 e6 ff ff       	call   800147 <_panic>
+	assert(r <= PGSIZE);
+  801b34:	68 77 30 80 00       	push   $0x803077
+  801b39:	68 57 30 80 00       	push   $0x803057
+  801b3e:	6a 7d                	push   $0x7d
+  801b40:	68 6c 30 80 00       	push   $0x80306c
+  801b45:	e8 fd e5 ff ff       	call   800147 <_panic>
+
+00801b4a <open>:
+{
+  801b4a:	55                   	push   %ebp
+  801b4b:	89 e5                	mov    %esp,%ebp
+  801b4d:	56                   	push   %esi
+  801b4e:	53                   	push   %ebx
+  801b4f:	83 ec 1c             	sub    $0x1c,%esp
+  801b52:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b55:	56                   	push   %esi
+  801b56:	e8 7a ec ff ff       	call   8007d5 <strlen>
+  801b5b:	83 c4 10             	add    $0x10,%esp
+  801b5e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b63:	7f 6c                	jg     801bd1 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b65:	83 ec 0c             	sub    $0xc,%esp
+  801b68:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b6b:	50                   	push   %eax
+  801b6c:	e8 ba f8 ff ff       	call   80142b <fd_alloc>
+  801b71:	89 c3                	mov    %eax,%ebx
+  801b73:	83 c4 10             	add    $0x10,%esp
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	78 3c                	js     801bb6 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b7a:	83 ec 08             	sub    $0x8,%esp
+  801b7d:	56                   	push   %esi
+  801b7e:	68 00 60 80 00       	push   $0x806000
+  801b83:	e8 88 ec ff ff       	call   800810 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b88:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b8b:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b90:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b93:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b98:	e8 f6 fd ff ff       	call   801993 <fsipc>
+  801b9d:	89 c3                	mov    %eax,%ebx
+  801b9f:	83 c4 10             	add    $0x10,%esp
+  801ba2:	85 c0                	test   %eax,%eax
+  801ba4:	78 19                	js     801bbf <open+0x75>
+	return fd2num(fd);
+  801ba6:	83 ec 0c             	sub    $0xc,%esp
+  801ba9:	ff 75 f4             	push   -0xc(%ebp)
+  801bac:	e8 53 f8 ff ff       	call   801404 <fd2num>
+  801bb1:	89 c3                	mov    %eax,%ebx
+  801bb3:	83 c4 10             	add    $0x10,%esp
+}
+  801bb6:	89 d8                	mov    %ebx,%eax
+  801bb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bbb:	5b                   	pop    %ebx
+  801bbc:	5e                   	pop    %esi
+  801bbd:	5d                   	pop    %ebp
+  801bbe:	c3                   	ret
+		fd_close(fd, 0);
+  801bbf:	83 ec 08             	sub    $0x8,%esp
+  801bc2:	6a 00                	push   $0x0
+  801bc4:	ff 75 f4             	push   -0xc(%ebp)
+  801bc7:	e8 58 f9 ff ff       	call   801524 <fd_close>
+		return r;
+  801bcc:	83 c4 10             	add    $0x10,%esp
+  801bcf:	eb e5                	jmp    801bb6 <open+0x6c>
+		return -E_BAD_PATH;
+  801bd1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801bd6:	eb de                	jmp    801bb6 <open+0x6c>
+
+00801bd8 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801bd8:	55                   	push   %ebp
+  801bd9:	89 e5                	mov    %esp,%ebp
+  801bdb:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801bde:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be3:	b8 08 00 00 00       	mov    $0x8,%eax
+  801be8:	e8 a6 fd ff ff       	call   801993 <fsipc>
+}
+  801bed:	c9                   	leave
+  801bee:	c3                   	ret
+
+00801bef <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801bef:	55                   	push   %ebp
+  801bf0:	89 e5                	mov    %esp,%ebp
+  801bf2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801bf5:	68 83 30 80 00       	push   $0x803083
+  801bfa:	ff 75 0c             	push   0xc(%ebp)
+  801bfd:	e8 0e ec ff ff       	call   800810 <strcpy>
+	return 0;
+}
+  801c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c07:	c9                   	leave
+  801c08:	c3                   	ret
+
+00801c09 <devsock_close>:
+{
+  801c09:	55                   	push   %ebp
+  801c0a:	89 e5                	mov    %esp,%ebp
+  801c0c:	53                   	push   %ebx
+  801c0d:	83 ec 10             	sub    $0x10,%esp
+  801c10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c13:	53                   	push   %ebx
+  801c14:	e8 69 0a 00 00       	call   802682 <pageref>
+  801c19:	89 c2                	mov    %eax,%edx
+  801c1b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c23:	83 fa 01             	cmp    $0x1,%edx
+  801c26:	74 05                	je     801c2d <devsock_close+0x24>
+}
+  801c28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c2b:	c9                   	leave
+  801c2c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c2d:	83 ec 0c             	sub    $0xc,%esp
+  801c30:	ff 73 0c             	push   0xc(%ebx)
+  801c33:	e8 b7 02 00 00       	call   801eef <nsipc_close>
+  801c38:	83 c4 10             	add    $0x10,%esp
+  801c3b:	eb eb                	jmp    801c28 <devsock_close+0x1f>
+
+00801c3d <devsock_write>:
+{
+  801c3d:	55                   	push   %ebp
+  801c3e:	89 e5                	mov    %esp,%ebp
+  801c40:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c43:	6a 00                	push   $0x0
+  801c45:	ff 75 10             	push   0x10(%ebp)
+  801c48:	ff 75 0c             	push   0xc(%ebp)
+  801c4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c4e:	ff 70 0c             	push   0xc(%eax)
+  801c51:	e8 79 03 00 00       	call   801fcf <nsipc_send>
+}
+  801c56:	c9                   	leave
+  801c57:	c3                   	ret
+
+00801c58 <devsock_read>:
+{
+  801c58:	55                   	push   %ebp
+  801c59:	89 e5                	mov    %esp,%ebp
+  801c5b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c5e:	6a 00                	push   $0x0
+  801c60:	ff 75 10             	push   0x10(%ebp)
+  801c63:	ff 75 0c             	push   0xc(%ebp)
+  801c66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c69:	ff 70 0c             	push   0xc(%eax)
+  801c6c:	e8 ef 02 00 00       	call   801f60 <nsipc_recv>
+}
+  801c71:	c9                   	leave
+  801c72:	c3                   	ret
+
+00801c73 <fd2sockid>:
+{
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c79:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c7c:	52                   	push   %edx
+  801c7d:	50                   	push   %eax
+  801c7e:	e8 fe f7 ff ff       	call   801481 <fd_lookup>
+  801c83:	83 c4 10             	add    $0x10,%esp
+  801c86:	85 c0                	test   %eax,%eax
+  801c88:	78 10                	js     801c9a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c8d:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801c93:	39 08                	cmp    %ecx,(%eax)
+  801c95:	75 05                	jne    801c9c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801c97:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801c9a:	c9                   	leave
+  801c9b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c9c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ca1:	eb f7                	jmp    801c9a <fd2sockid+0x27>
+
+00801ca3 <alloc_sockfd>:
+{
+  801ca3:	55                   	push   %ebp
+  801ca4:	89 e5                	mov    %esp,%ebp
+  801ca6:	56                   	push   %esi
+  801ca7:	53                   	push   %ebx
+  801ca8:	83 ec 1c             	sub    $0x1c,%esp
+  801cab:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb0:	50                   	push   %eax
+  801cb1:	e8 75 f7 ff ff       	call   80142b <fd_alloc>
+  801cb6:	89 c3                	mov    %eax,%ebx
+  801cb8:	83 c4 10             	add    $0x10,%esp
+  801cbb:	85 c0                	test   %eax,%eax
+  801cbd:	78 43                	js     801d02 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cbf:	83 ec 04             	sub    $0x4,%esp
+  801cc2:	68 07 04 00 00       	push   $0x407
+  801cc7:	ff 75 f4             	push   -0xc(%ebp)
+  801cca:	6a 00                	push   $0x0
+  801ccc:	e8 ac ef ff ff       	call   800c7d <sys_page_alloc>
+  801cd1:	89 c3                	mov    %eax,%ebx
+  801cd3:	83 c4 10             	add    $0x10,%esp
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	78 28                	js     801d02 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801cda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cdd:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801ce3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801ce5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801cef:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801cf2:	83 ec 0c             	sub    $0xc,%esp
+  801cf5:	50                   	push   %eax
+  801cf6:	e8 09 f7 ff ff       	call   801404 <fd2num>
+  801cfb:	89 c3                	mov    %eax,%ebx
+  801cfd:	83 c4 10             	add    $0x10,%esp
+  801d00:	eb 0c                	jmp    801d0e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d02:	83 ec 0c             	sub    $0xc,%esp
+  801d05:	56                   	push   %esi
+  801d06:	e8 e4 01 00 00       	call   801eef <nsipc_close>
+		return r;
+  801d0b:	83 c4 10             	add    $0x10,%esp
+}
+  801d0e:	89 d8                	mov    %ebx,%eax
+  801d10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d13:	5b                   	pop    %ebx
+  801d14:	5e                   	pop    %esi
+  801d15:	5d                   	pop    %ebp
+  801d16:	c3                   	ret
+
+00801d17 <accept>:
+{
+  801d17:	55                   	push   %ebp
+  801d18:	89 e5                	mov    %esp,%ebp
+  801d1a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d20:	e8 4e ff ff ff       	call   801c73 <fd2sockid>
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	78 1b                	js     801d44 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d29:	83 ec 04             	sub    $0x4,%esp
+  801d2c:	ff 75 10             	push   0x10(%ebp)
+  801d2f:	ff 75 0c             	push   0xc(%ebp)
+  801d32:	50                   	push   %eax
+  801d33:	e8 0e 01 00 00       	call   801e46 <nsipc_accept>
+  801d38:	83 c4 10             	add    $0x10,%esp
+  801d3b:	85 c0                	test   %eax,%eax
+  801d3d:	78 05                	js     801d44 <accept+0x2d>
+	return alloc_sockfd(r);
+  801d3f:	e8 5f ff ff ff       	call   801ca3 <alloc_sockfd>
+}
+  801d44:	c9                   	leave
+  801d45:	c3                   	ret
+
+00801d46 <bind>:
+{
+  801d46:	55                   	push   %ebp
+  801d47:	89 e5                	mov    %esp,%ebp
+  801d49:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d4f:	e8 1f ff ff ff       	call   801c73 <fd2sockid>
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	78 12                	js     801d6a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d58:	83 ec 04             	sub    $0x4,%esp
+  801d5b:	ff 75 10             	push   0x10(%ebp)
+  801d5e:	ff 75 0c             	push   0xc(%ebp)
+  801d61:	50                   	push   %eax
+  801d62:	e8 31 01 00 00       	call   801e98 <nsipc_bind>
+  801d67:	83 c4 10             	add    $0x10,%esp
+}
+  801d6a:	c9                   	leave
+  801d6b:	c3                   	ret
+
+00801d6c <shutdown>:
+{
+  801d6c:	55                   	push   %ebp
+  801d6d:	89 e5                	mov    %esp,%ebp
+  801d6f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d72:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d75:	e8 f9 fe ff ff       	call   801c73 <fd2sockid>
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	78 0f                	js     801d8d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d7e:	83 ec 08             	sub    $0x8,%esp
+  801d81:	ff 75 0c             	push   0xc(%ebp)
+  801d84:	50                   	push   %eax
+  801d85:	e8 43 01 00 00       	call   801ecd <nsipc_shutdown>
+  801d8a:	83 c4 10             	add    $0x10,%esp
+}
+  801d8d:	c9                   	leave
+  801d8e:	c3                   	ret
+
+00801d8f <connect>:
+{
+  801d8f:	55                   	push   %ebp
+  801d90:	89 e5                	mov    %esp,%ebp
+  801d92:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d98:	e8 d6 fe ff ff       	call   801c73 <fd2sockid>
+  801d9d:	85 c0                	test   %eax,%eax
+  801d9f:	78 12                	js     801db3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801da1:	83 ec 04             	sub    $0x4,%esp
+  801da4:	ff 75 10             	push   0x10(%ebp)
+  801da7:	ff 75 0c             	push   0xc(%ebp)
+  801daa:	50                   	push   %eax
+  801dab:	e8 59 01 00 00       	call   801f09 <nsipc_connect>
+  801db0:	83 c4 10             	add    $0x10,%esp
+}
+  801db3:	c9                   	leave
+  801db4:	c3                   	ret
+
+00801db5 <listen>:
+{
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dbe:	e8 b0 fe ff ff       	call   801c73 <fd2sockid>
+  801dc3:	85 c0                	test   %eax,%eax
+  801dc5:	78 0f                	js     801dd6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801dc7:	83 ec 08             	sub    $0x8,%esp
+  801dca:	ff 75 0c             	push   0xc(%ebp)
+  801dcd:	50                   	push   %eax
+  801dce:	e8 6b 01 00 00       	call   801f3e <nsipc_listen>
+  801dd3:	83 c4 10             	add    $0x10,%esp
+}
+  801dd6:	c9                   	leave
+  801dd7:	c3                   	ret
+
+00801dd8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801dd8:	55                   	push   %ebp
+  801dd9:	89 e5                	mov    %esp,%ebp
+  801ddb:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801dde:	ff 75 10             	push   0x10(%ebp)
+  801de1:	ff 75 0c             	push   0xc(%ebp)
+  801de4:	ff 75 08             	push   0x8(%ebp)
+  801de7:	e8 41 02 00 00       	call   80202d <nsipc_socket>
+  801dec:	83 c4 10             	add    $0x10,%esp
+  801def:	85 c0                	test   %eax,%eax
+  801df1:	78 05                	js     801df8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801df3:	e8 ab fe ff ff       	call   801ca3 <alloc_sockfd>
+}
+  801df8:	c9                   	leave
+  801df9:	c3                   	ret
+
+00801dfa <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801dfa:	55                   	push   %ebp
+  801dfb:	89 e5                	mov    %esp,%ebp
+  801dfd:	53                   	push   %ebx
+  801dfe:	83 ec 04             	sub    $0x4,%esp
+  801e01:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e03:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801e0a:	74 26                	je     801e32 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e0c:	6a 07                	push   $0x7
+  801e0e:	68 00 70 80 00       	push   $0x807000
+  801e13:	53                   	push   %ebx
+  801e14:	ff 35 04 50 80 00    	push   0x805004
+  801e1a:	e8 ff 07 00 00       	call   80261e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e1f:	83 c4 0c             	add    $0xc,%esp
+  801e22:	6a 00                	push   $0x0
+  801e24:	6a 00                	push   $0x0
+  801e26:	6a 00                	push   $0x0
+  801e28:	e8 79 07 00 00       	call   8025a6 <ipc_recv>
+}
+  801e2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e30:	c9                   	leave
+  801e31:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e32:	83 ec 0c             	sub    $0xc,%esp
+  801e35:	6a 02                	push   $0x2
+  801e37:	e8 36 08 00 00       	call   802672 <ipc_find_env>
+  801e3c:	a3 04 50 80 00       	mov    %eax,0x805004
+  801e41:	83 c4 10             	add    $0x10,%esp
+  801e44:	eb c6                	jmp    801e0c <nsipc+0x12>
+
+00801e46 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e46:	55                   	push   %ebp
+  801e47:	89 e5                	mov    %esp,%ebp
+  801e49:	56                   	push   %esi
+  801e4a:	53                   	push   %ebx
+  801e4b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e51:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e56:	8b 06                	mov    (%esi),%eax
+  801e58:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e5d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e62:	e8 93 ff ff ff       	call   801dfa <nsipc>
+  801e67:	89 c3                	mov    %eax,%ebx
+  801e69:	85 c0                	test   %eax,%eax
+  801e6b:	79 09                	jns    801e76 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e6d:	89 d8                	mov    %ebx,%eax
+  801e6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e72:	5b                   	pop    %ebx
+  801e73:	5e                   	pop    %esi
+  801e74:	5d                   	pop    %ebp
+  801e75:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801e76:	83 ec 04             	sub    $0x4,%esp
+  801e79:	ff 35 10 70 80 00    	push   0x807010
+  801e7f:	68 00 70 80 00       	push   $0x807000
+  801e84:	ff 75 0c             	push   0xc(%ebp)
+  801e87:	e8 0a eb ff ff       	call   800996 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801e8c:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e91:	89 06                	mov    %eax,(%esi)
+  801e93:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801e96:	eb d5                	jmp    801e6d <nsipc_accept+0x27>
+
+00801e98 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801e98:	55                   	push   %ebp
+  801e99:	89 e5                	mov    %esp,%ebp
+  801e9b:	53                   	push   %ebx
+  801e9c:	83 ec 08             	sub    $0x8,%esp
+  801e9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ea2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea5:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801eaa:	53                   	push   %ebx
+  801eab:	ff 75 0c             	push   0xc(%ebp)
+  801eae:	68 04 70 80 00       	push   $0x807004
+  801eb3:	e8 de ea ff ff       	call   800996 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801eb8:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801ebe:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ec3:	e8 32 ff ff ff       	call   801dfa <nsipc>
+}
+  801ec8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ecb:	c9                   	leave
+  801ecc:	c3                   	ret
+
+00801ecd <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801ecd:	55                   	push   %ebp
+  801ece:	89 e5                	mov    %esp,%ebp
+  801ed0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801ed3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801edb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ede:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801ee3:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ee8:	e8 0d ff ff ff       	call   801dfa <nsipc>
+}
+  801eed:	c9                   	leave
+  801eee:	c3                   	ret
+
+00801eef <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801eef:	55                   	push   %ebp
+  801ef0:	89 e5                	mov    %esp,%ebp
+  801ef2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef8:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801efd:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f02:	e8 f3 fe ff ff       	call   801dfa <nsipc>
+}
+  801f07:	c9                   	leave
+  801f08:	c3                   	ret
+
+00801f09 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f09:	55                   	push   %ebp
+  801f0a:	89 e5                	mov    %esp,%ebp
+  801f0c:	53                   	push   %ebx
+  801f0d:	83 ec 08             	sub    $0x8,%esp
+  801f10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f13:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f16:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f1b:	53                   	push   %ebx
+  801f1c:	ff 75 0c             	push   0xc(%ebp)
+  801f1f:	68 04 70 80 00       	push   $0x807004
+  801f24:	e8 6d ea ff ff       	call   800996 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f29:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801f2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f34:	e8 c1 fe ff ff       	call   801dfa <nsipc>
+}
+  801f39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f3c:	c9                   	leave
+  801f3d:	c3                   	ret
+
+00801f3e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f3e:	55                   	push   %ebp
+  801f3f:	89 e5                	mov    %esp,%ebp
+  801f41:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f47:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f4f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801f54:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f59:	e8 9c fe ff ff       	call   801dfa <nsipc>
+}
+  801f5e:	c9                   	leave
+  801f5f:	c3                   	ret
+
+00801f60 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f60:	55                   	push   %ebp
+  801f61:	89 e5                	mov    %esp,%ebp
+  801f63:	56                   	push   %esi
+  801f64:	53                   	push   %ebx
+  801f65:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f68:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801f70:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801f76:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f79:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801f7e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f83:	e8 72 fe ff ff       	call   801dfa <nsipc>
+  801f88:	89 c3                	mov    %eax,%ebx
+  801f8a:	85 c0                	test   %eax,%eax
+  801f8c:	78 22                	js     801fb0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801f8e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801f93:	39 c6                	cmp    %eax,%esi
+  801f95:	0f 4e c6             	cmovle %esi,%eax
+  801f98:	39 c3                	cmp    %eax,%ebx
+  801f9a:	7f 1d                	jg     801fb9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801f9c:	83 ec 04             	sub    $0x4,%esp
+  801f9f:	53                   	push   %ebx
+  801fa0:	68 00 70 80 00       	push   $0x807000
+  801fa5:	ff 75 0c             	push   0xc(%ebp)
+  801fa8:	e8 e9 e9 ff ff       	call   800996 <memmove>
+  801fad:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801fb0:	89 d8                	mov    %ebx,%eax
+  801fb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fb5:	5b                   	pop    %ebx
+  801fb6:	5e                   	pop    %esi
+  801fb7:	5d                   	pop    %ebp
+  801fb8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fb9:	68 8f 30 80 00       	push   $0x80308f
+  801fbe:	68 57 30 80 00       	push   $0x803057
+  801fc3:	6a 62                	push   $0x62
+  801fc5:	68 a4 30 80 00       	push   $0x8030a4
+  801fca:	e8 78 e1 ff ff       	call   800147 <_panic>
+
+00801fcf <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	53                   	push   %ebx
+  801fd3:	83 ec 04             	sub    $0x4,%esp
+  801fd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801fd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fdc:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801fe1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801fe7:	7f 2e                	jg     802017 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801fe9:	83 ec 04             	sub    $0x4,%esp
+  801fec:	53                   	push   %ebx
+  801fed:	ff 75 0c             	push   0xc(%ebp)
+  801ff0:	68 0c 70 80 00       	push   $0x80700c
+  801ff5:	e8 9c e9 ff ff       	call   800996 <memmove>
+	nsipcbuf.send.req_size = size;
+  801ffa:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802000:	8b 45 14             	mov    0x14(%ebp),%eax
+  802003:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802008:	b8 08 00 00 00       	mov    $0x8,%eax
+  80200d:	e8 e8 fd ff ff       	call   801dfa <nsipc>
+}
+  802012:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802015:	c9                   	leave
+  802016:	c3                   	ret
+	assert(size < 1600);
+  802017:	68 b0 30 80 00       	push   $0x8030b0
+  80201c:	68 57 30 80 00       	push   $0x803057
+  802021:	6a 6d                	push   $0x6d
+  802023:	68 a4 30 80 00       	push   $0x8030a4
+  802028:	e8 1a e1 ff ff       	call   800147 <_panic>
+
+0080202d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80202d:	55                   	push   %ebp
+  80202e:	89 e5                	mov    %esp,%ebp
+  802030:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802033:	8b 45 08             	mov    0x8(%ebp),%eax
+  802036:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80203b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80203e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802043:	8b 45 10             	mov    0x10(%ebp),%eax
+  802046:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80204b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802050:	e8 a5 fd ff ff       	call   801dfa <nsipc>
+}
+  802055:	c9                   	leave
+  802056:	c3                   	ret
+
+00802057 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802057:	55                   	push   %ebp
+  802058:	89 e5                	mov    %esp,%ebp
+  80205a:	56                   	push   %esi
+  80205b:	53                   	push   %ebx
+  80205c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80205f:	83 ec 0c             	sub    $0xc,%esp
+  802062:	ff 75 08             	push   0x8(%ebp)
+  802065:	e8 aa f3 ff ff       	call   801414 <fd2data>
+  80206a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80206c:	83 c4 08             	add    $0x8,%esp
+  80206f:	68 bc 30 80 00       	push   $0x8030bc
+  802074:	53                   	push   %ebx
+  802075:	e8 96 e7 ff ff       	call   800810 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80207a:	8b 46 04             	mov    0x4(%esi),%eax
+  80207d:	2b 06                	sub    (%esi),%eax
+  80207f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802085:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80208c:	00 00 00 
+	stat->st_dev = &devpipe;
+  80208f:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802096:	40 80 00 
+	return 0;
+}
+  802099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020a1:	5b                   	pop    %ebx
+  8020a2:	5e                   	pop    %esi
+  8020a3:	5d                   	pop    %ebp
+  8020a4:	c3                   	ret
+
+008020a5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020a5:	55                   	push   %ebp
+  8020a6:	89 e5                	mov    %esp,%ebp
+  8020a8:	53                   	push   %ebx
+  8020a9:	83 ec 0c             	sub    $0xc,%esp
+  8020ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020af:	53                   	push   %ebx
+  8020b0:	6a 00                	push   $0x0
+  8020b2:	e8 8e ec ff ff       	call   800d45 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020b7:	89 1c 24             	mov    %ebx,(%esp)
+  8020ba:	e8 55 f3 ff ff       	call   801414 <fd2data>
+  8020bf:	83 c4 08             	add    $0x8,%esp
+  8020c2:	50                   	push   %eax
+  8020c3:	6a 00                	push   $0x0
+  8020c5:	e8 7b ec ff ff       	call   800d45 <sys_page_unmap>
+}
+  8020ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020cd:	c9                   	leave
+  8020ce:	c3                   	ret
+
+008020cf <_pipeisclosed>:
+{
+  8020cf:	55                   	push   %ebp
+  8020d0:	89 e5                	mov    %esp,%ebp
+  8020d2:	57                   	push   %edi
+  8020d3:	56                   	push   %esi
+  8020d4:	53                   	push   %ebx
+  8020d5:	83 ec 1c             	sub    $0x1c,%esp
+  8020d8:	89 c7                	mov    %eax,%edi
+  8020da:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8020dc:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8020e1:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8020e4:	83 ec 0c             	sub    $0xc,%esp
+  8020e7:	57                   	push   %edi
+  8020e8:	e8 95 05 00 00       	call   802682 <pageref>
+  8020ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020f0:	89 34 24             	mov    %esi,(%esp)
+  8020f3:	e8 8a 05 00 00       	call   802682 <pageref>
+		nn = thisenv->env_runs;
+  8020f8:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+  8020fe:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802101:	83 c4 10             	add    $0x10,%esp
+  802104:	39 cb                	cmp    %ecx,%ebx
+  802106:	74 1b                	je     802123 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802108:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80210b:	75 cf                	jne    8020dc <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80210d:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802110:	6a 01                	push   $0x1
+  802112:	50                   	push   %eax
+  802113:	53                   	push   %ebx
+  802114:	68 c3 30 80 00       	push   $0x8030c3
+  802119:	e8 04 e1 ff ff       	call   800222 <cprintf>
+  80211e:	83 c4 10             	add    $0x10,%esp
+  802121:	eb b9                	jmp    8020dc <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802123:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802126:	0f 94 c0             	sete   %al
+  802129:	0f b6 c0             	movzbl %al,%eax
+}
+  80212c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80212f:	5b                   	pop    %ebx
+  802130:	5e                   	pop    %esi
+  802131:	5f                   	pop    %edi
+  802132:	5d                   	pop    %ebp
+  802133:	c3                   	ret
+
+00802134 <devpipe_write>:
+{
+  802134:	55                   	push   %ebp
+  802135:	89 e5                	mov    %esp,%ebp
+  802137:	57                   	push   %edi
+  802138:	56                   	push   %esi
+  802139:	53                   	push   %ebx
+  80213a:	83 ec 28             	sub    $0x28,%esp
+  80213d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802140:	56                   	push   %esi
+  802141:	e8 ce f2 ff ff       	call   801414 <fd2data>
+  802146:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802148:	83 c4 10             	add    $0x10,%esp
+  80214b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802150:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802153:	75 09                	jne    80215e <devpipe_write+0x2a>
+	return i;
+  802155:	89 f8                	mov    %edi,%eax
+  802157:	eb 23                	jmp    80217c <devpipe_write+0x48>
+			sys_yield();
+  802159:	e8 9f ea ff ff       	call   800bfd <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80215e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802161:	8b 0b                	mov    (%ebx),%ecx
+  802163:	8d 51 20             	lea    0x20(%ecx),%edx
+  802166:	39 d0                	cmp    %edx,%eax
+  802168:	72 1a                	jb     802184 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80216a:	89 da                	mov    %ebx,%edx
+  80216c:	89 f0                	mov    %esi,%eax
+  80216e:	e8 5c ff ff ff       	call   8020cf <_pipeisclosed>
+  802173:	85 c0                	test   %eax,%eax
+  802175:	74 e2                	je     802159 <devpipe_write+0x25>
+				return 0;
+  802177:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80217c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80217f:	5b                   	pop    %ebx
+  802180:	5e                   	pop    %esi
+  802181:	5f                   	pop    %edi
+  802182:	5d                   	pop    %ebp
+  802183:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802184:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802187:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80218b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80218e:	89 c2                	mov    %eax,%edx
+  802190:	c1 fa 1f             	sar    $0x1f,%edx
+  802193:	89 d1                	mov    %edx,%ecx
+  802195:	c1 e9 1b             	shr    $0x1b,%ecx
+  802198:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80219b:	83 e2 1f             	and    $0x1f,%edx
+  80219e:	29 ca                	sub    %ecx,%edx
+  8021a0:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021a4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021a8:	83 c0 01             	add    $0x1,%eax
+  8021ab:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021ae:	83 c7 01             	add    $0x1,%edi
+  8021b1:	eb 9d                	jmp    802150 <devpipe_write+0x1c>
+
+008021b3 <devpipe_read>:
+{
+  8021b3:	55                   	push   %ebp
+  8021b4:	89 e5                	mov    %esp,%ebp
+  8021b6:	57                   	push   %edi
+  8021b7:	56                   	push   %esi
+  8021b8:	53                   	push   %ebx
+  8021b9:	83 ec 18             	sub    $0x18,%esp
+  8021bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021bf:	57                   	push   %edi
+  8021c0:	e8 4f f2 ff ff       	call   801414 <fd2data>
+  8021c5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021c7:	83 c4 10             	add    $0x10,%esp
+  8021ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8021cf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021d2:	75 13                	jne    8021e7 <devpipe_read+0x34>
+	return i;
+  8021d4:	89 f0                	mov    %esi,%eax
+  8021d6:	eb 02                	jmp    8021da <devpipe_read+0x27>
+				return i;
+  8021d8:	89 f0                	mov    %esi,%eax
+}
+  8021da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021dd:	5b                   	pop    %ebx
+  8021de:	5e                   	pop    %esi
+  8021df:	5f                   	pop    %edi
+  8021e0:	5d                   	pop    %ebp
+  8021e1:	c3                   	ret
+			sys_yield();
+  8021e2:	e8 16 ea ff ff       	call   800bfd <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8021e7:	8b 03                	mov    (%ebx),%eax
+  8021e9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8021ec:	75 18                	jne    802206 <devpipe_read+0x53>
+			if (i > 0)
+  8021ee:	85 f6                	test   %esi,%esi
+  8021f0:	75 e6                	jne    8021d8 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8021f2:	89 da                	mov    %ebx,%edx
+  8021f4:	89 f8                	mov    %edi,%eax
+  8021f6:	e8 d4 fe ff ff       	call   8020cf <_pipeisclosed>
+  8021fb:	85 c0                	test   %eax,%eax
+  8021fd:	74 e3                	je     8021e2 <devpipe_read+0x2f>
+				return 0;
+  8021ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802204:	eb d4                	jmp    8021da <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802206:	99                   	cltd
+  802207:	c1 ea 1b             	shr    $0x1b,%edx
+  80220a:	01 d0                	add    %edx,%eax
+  80220c:	83 e0 1f             	and    $0x1f,%eax
+  80220f:	29 d0                	sub    %edx,%eax
+  802211:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802216:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802219:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80221c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80221f:	83 c6 01             	add    $0x1,%esi
+  802222:	eb ab                	jmp    8021cf <devpipe_read+0x1c>
+
+00802224 <pipe>:
+{
+  802224:	55                   	push   %ebp
+  802225:	89 e5                	mov    %esp,%ebp
+  802227:	56                   	push   %esi
+  802228:	53                   	push   %ebx
+  802229:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80222c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80222f:	50                   	push   %eax
+  802230:	e8 f6 f1 ff ff       	call   80142b <fd_alloc>
+  802235:	89 c3                	mov    %eax,%ebx
+  802237:	83 c4 10             	add    $0x10,%esp
+  80223a:	85 c0                	test   %eax,%eax
+  80223c:	0f 88 23 01 00 00    	js     802365 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802242:	83 ec 04             	sub    $0x4,%esp
+  802245:	68 07 04 00 00       	push   $0x407
+  80224a:	ff 75 f4             	push   -0xc(%ebp)
+  80224d:	6a 00                	push   $0x0
+  80224f:	e8 29 ea ff ff       	call   800c7d <sys_page_alloc>
+  802254:	89 c3                	mov    %eax,%ebx
+  802256:	83 c4 10             	add    $0x10,%esp
+  802259:	85 c0                	test   %eax,%eax
+  80225b:	0f 88 04 01 00 00    	js     802365 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802261:	83 ec 0c             	sub    $0xc,%esp
+  802264:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802267:	50                   	push   %eax
+  802268:	e8 be f1 ff ff       	call   80142b <fd_alloc>
+  80226d:	89 c3                	mov    %eax,%ebx
+  80226f:	83 c4 10             	add    $0x10,%esp
+  802272:	85 c0                	test   %eax,%eax
+  802274:	0f 88 db 00 00 00    	js     802355 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80227a:	83 ec 04             	sub    $0x4,%esp
+  80227d:	68 07 04 00 00       	push   $0x407
+  802282:	ff 75 f0             	push   -0x10(%ebp)
+  802285:	6a 00                	push   $0x0
+  802287:	e8 f1 e9 ff ff       	call   800c7d <sys_page_alloc>
+  80228c:	89 c3                	mov    %eax,%ebx
+  80228e:	83 c4 10             	add    $0x10,%esp
+  802291:	85 c0                	test   %eax,%eax
+  802293:	0f 88 bc 00 00 00    	js     802355 <pipe+0x131>
+	va = fd2data(fd0);
+  802299:	83 ec 0c             	sub    $0xc,%esp
+  80229c:	ff 75 f4             	push   -0xc(%ebp)
+  80229f:	e8 70 f1 ff ff       	call   801414 <fd2data>
+  8022a4:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022a6:	83 c4 0c             	add    $0xc,%esp
+  8022a9:	68 07 04 00 00       	push   $0x407
+  8022ae:	50                   	push   %eax
+  8022af:	6a 00                	push   $0x0
+  8022b1:	e8 c7 e9 ff ff       	call   800c7d <sys_page_alloc>
+  8022b6:	89 c3                	mov    %eax,%ebx
+  8022b8:	83 c4 10             	add    $0x10,%esp
+  8022bb:	85 c0                	test   %eax,%eax
+  8022bd:	0f 88 82 00 00 00    	js     802345 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022c3:	83 ec 0c             	sub    $0xc,%esp
+  8022c6:	ff 75 f0             	push   -0x10(%ebp)
+  8022c9:	e8 46 f1 ff ff       	call   801414 <fd2data>
+  8022ce:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8022d5:	50                   	push   %eax
+  8022d6:	6a 00                	push   $0x0
+  8022d8:	56                   	push   %esi
+  8022d9:	6a 00                	push   $0x0
+  8022db:	e8 23 ea ff ff       	call   800d03 <sys_page_map>
+  8022e0:	89 c3                	mov    %eax,%ebx
+  8022e2:	83 c4 20             	add    $0x20,%esp
+  8022e5:	85 c0                	test   %eax,%eax
+  8022e7:	78 4e                	js     802337 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8022e9:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8022ee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022f1:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8022f3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022f6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8022fd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802300:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802302:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802305:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80230c:	83 ec 0c             	sub    $0xc,%esp
+  80230f:	ff 75 f4             	push   -0xc(%ebp)
+  802312:	e8 ed f0 ff ff       	call   801404 <fd2num>
+  802317:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80231a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80231c:	83 c4 04             	add    $0x4,%esp
+  80231f:	ff 75 f0             	push   -0x10(%ebp)
+  802322:	e8 dd f0 ff ff       	call   801404 <fd2num>
+  802327:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80232a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80232d:	83 c4 10             	add    $0x10,%esp
+  802330:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802335:	eb 2e                	jmp    802365 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802337:	83 ec 08             	sub    $0x8,%esp
+  80233a:	56                   	push   %esi
+  80233b:	6a 00                	push   $0x0
+  80233d:	e8 03 ea ff ff       	call   800d45 <sys_page_unmap>
+  802342:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802345:	83 ec 08             	sub    $0x8,%esp
+  802348:	ff 75 f0             	push   -0x10(%ebp)
+  80234b:	6a 00                	push   $0x0
+  80234d:	e8 f3 e9 ff ff       	call   800d45 <sys_page_unmap>
+  802352:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802355:	83 ec 08             	sub    $0x8,%esp
+  802358:	ff 75 f4             	push   -0xc(%ebp)
+  80235b:	6a 00                	push   $0x0
+  80235d:	e8 e3 e9 ff ff       	call   800d45 <sys_page_unmap>
+  802362:	83 c4 10             	add    $0x10,%esp
+}
+  802365:	89 d8                	mov    %ebx,%eax
+  802367:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80236a:	5b                   	pop    %ebx
+  80236b:	5e                   	pop    %esi
+  80236c:	5d                   	pop    %ebp
+  80236d:	c3                   	ret
+
+0080236e <pipeisclosed>:
+{
+  80236e:	55                   	push   %ebp
+  80236f:	89 e5                	mov    %esp,%ebp
+  802371:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802374:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802377:	50                   	push   %eax
+  802378:	ff 75 08             	push   0x8(%ebp)
+  80237b:	e8 01 f1 ff ff       	call   801481 <fd_lookup>
+  802380:	83 c4 10             	add    $0x10,%esp
+  802383:	85 c0                	test   %eax,%eax
+  802385:	78 18                	js     80239f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802387:	83 ec 0c             	sub    $0xc,%esp
+  80238a:	ff 75 f4             	push   -0xc(%ebp)
+  80238d:	e8 82 f0 ff ff       	call   801414 <fd2data>
+  802392:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802394:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802397:	e8 33 fd ff ff       	call   8020cf <_pipeisclosed>
+  80239c:	83 c4 10             	add    $0x10,%esp
+}
+  80239f:	c9                   	leave
+  8023a0:	c3                   	ret
+
+008023a1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a6:	c3                   	ret
+
+008023a7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023a7:	55                   	push   %ebp
+  8023a8:	89 e5                	mov    %esp,%ebp
+  8023aa:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023ad:	68 db 30 80 00       	push   $0x8030db
+  8023b2:	ff 75 0c             	push   0xc(%ebp)
+  8023b5:	e8 56 e4 ff ff       	call   800810 <strcpy>
+	return 0;
+}
+  8023ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023bf:	c9                   	leave
+  8023c0:	c3                   	ret
+
+008023c1 <devcons_write>:
+{
+  8023c1:	55                   	push   %ebp
+  8023c2:	89 e5                	mov    %esp,%ebp
+  8023c4:	57                   	push   %edi
+  8023c5:	56                   	push   %esi
+  8023c6:	53                   	push   %ebx
+  8023c7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8023cd:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8023d2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8023d8:	eb 2e                	jmp    802408 <devcons_write+0x47>
+		m = n - tot;
+  8023da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023dd:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8023df:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8023e4:	39 c3                	cmp    %eax,%ebx
+  8023e6:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8023e9:	83 ec 04             	sub    $0x4,%esp
+  8023ec:	53                   	push   %ebx
+  8023ed:	89 f0                	mov    %esi,%eax
+  8023ef:	03 45 0c             	add    0xc(%ebp),%eax
+  8023f2:	50                   	push   %eax
+  8023f3:	57                   	push   %edi
+  8023f4:	e8 9d e5 ff ff       	call   800996 <memmove>
+		sys_cputs(buf, m);
+  8023f9:	83 c4 08             	add    $0x8,%esp
+  8023fc:	53                   	push   %ebx
+  8023fd:	57                   	push   %edi
+  8023fe:	e8 3d e7 ff ff       	call   800b40 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802403:	01 de                	add    %ebx,%esi
+  802405:	83 c4 10             	add    $0x10,%esp
+  802408:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80240b:	72 cd                	jb     8023da <devcons_write+0x19>
+}
+  80240d:	89 f0                	mov    %esi,%eax
+  80240f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802412:	5b                   	pop    %ebx
+  802413:	5e                   	pop    %esi
+  802414:	5f                   	pop    %edi
+  802415:	5d                   	pop    %ebp
+  802416:	c3                   	ret
+
+00802417 <devcons_read>:
+{
+  802417:	55                   	push   %ebp
+  802418:	89 e5                	mov    %esp,%ebp
+  80241a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80241d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802422:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802426:	75 07                	jne    80242f <devcons_read+0x18>
+  802428:	eb 1f                	jmp    802449 <devcons_read+0x32>
+		sys_yield();
+  80242a:	e8 ce e7 ff ff       	call   800bfd <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80242f:	e8 2a e7 ff ff       	call   800b5e <sys_cgetc>
+  802434:	85 c0                	test   %eax,%eax
+  802436:	74 f2                	je     80242a <devcons_read+0x13>
+	if (c < 0)
+  802438:	78 0f                	js     802449 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80243a:	83 f8 04             	cmp    $0x4,%eax
+  80243d:	74 0c                	je     80244b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80243f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802442:	88 02                	mov    %al,(%edx)
+	return 1;
+  802444:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802449:	c9                   	leave
+  80244a:	c3                   	ret
+		return 0;
+  80244b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802450:	eb f7                	jmp    802449 <devcons_read+0x32>
+
+00802452 <cputchar>:
+{
+  802452:	55                   	push   %ebp
+  802453:	89 e5                	mov    %esp,%ebp
+  802455:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802458:	8b 45 08             	mov    0x8(%ebp),%eax
+  80245b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80245e:	6a 01                	push   $0x1
+  802460:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802463:	50                   	push   %eax
+  802464:	e8 d7 e6 ff ff       	call   800b40 <sys_cputs>
+}
+  802469:	83 c4 10             	add    $0x10,%esp
+  80246c:	c9                   	leave
+  80246d:	c3                   	ret
+
+0080246e <getchar>:
+{
+  80246e:	55                   	push   %ebp
+  80246f:	89 e5                	mov    %esp,%ebp
+  802471:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802474:	6a 01                	push   $0x1
+  802476:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802479:	50                   	push   %eax
+  80247a:	6a 00                	push   $0x0
+  80247c:	e8 66 f2 ff ff       	call   8016e7 <read>
+	if (r < 0)
+  802481:	83 c4 10             	add    $0x10,%esp
+  802484:	85 c0                	test   %eax,%eax
+  802486:	78 06                	js     80248e <getchar+0x20>
+	if (r < 1)
+  802488:	74 06                	je     802490 <getchar+0x22>
+	return c;
+  80248a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80248e:	c9                   	leave
+  80248f:	c3                   	ret
+		return -E_EOF;
+  802490:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802495:	eb f7                	jmp    80248e <getchar+0x20>
+
+00802497 <iscons>:
+{
+  802497:	55                   	push   %ebp
+  802498:	89 e5                	mov    %esp,%ebp
+  80249a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80249d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024a0:	50                   	push   %eax
+  8024a1:	ff 75 08             	push   0x8(%ebp)
+  8024a4:	e8 d8 ef ff ff       	call   801481 <fd_lookup>
+  8024a9:	83 c4 10             	add    $0x10,%esp
+  8024ac:	85 c0                	test   %eax,%eax
+  8024ae:	78 11                	js     8024c1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024b3:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8024b9:	39 10                	cmp    %edx,(%eax)
+  8024bb:	0f 94 c0             	sete   %al
+  8024be:	0f b6 c0             	movzbl %al,%eax
+}
+  8024c1:	c9                   	leave
+  8024c2:	c3                   	ret
+
+008024c3 <opencons>:
+{
+  8024c3:	55                   	push   %ebp
+  8024c4:	89 e5                	mov    %esp,%ebp
+  8024c6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024cc:	50                   	push   %eax
+  8024cd:	e8 59 ef ff ff       	call   80142b <fd_alloc>
+  8024d2:	83 c4 10             	add    $0x10,%esp
+  8024d5:	85 c0                	test   %eax,%eax
+  8024d7:	78 3a                	js     802513 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8024d9:	83 ec 04             	sub    $0x4,%esp
+  8024dc:	68 07 04 00 00       	push   $0x407
+  8024e1:	ff 75 f4             	push   -0xc(%ebp)
+  8024e4:	6a 00                	push   $0x0
+  8024e6:	e8 92 e7 ff ff       	call   800c7d <sys_page_alloc>
+  8024eb:	83 c4 10             	add    $0x10,%esp
+  8024ee:	85 c0                	test   %eax,%eax
+  8024f0:	78 21                	js     802513 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8024f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024f5:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8024fb:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8024fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802500:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802507:	83 ec 0c             	sub    $0xc,%esp
+  80250a:	50                   	push   %eax
+  80250b:	e8 f4 ee ff ff       	call   801404 <fd2num>
+  802510:	83 c4 10             	add    $0x10,%esp
+}
+  802513:	c9                   	leave
+  802514:	c3                   	ret
+
+00802515 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802515:	55                   	push   %ebp
+  802516:	89 e5                	mov    %esp,%ebp
+  802518:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80251b:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802522:	74 0a                	je     80252e <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802524:	8b 45 08             	mov    0x8(%ebp),%eax
+  802527:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  80252c:	c9                   	leave
+  80252d:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  80252e:	83 ec 04             	sub    $0x4,%esp
+  802531:	6a 07                	push   $0x7
+  802533:	68 00 f0 bf ee       	push   $0xeebff000
+  802538:	6a 00                	push   $0x0
+  80253a:	e8 3e e7 ff ff       	call   800c7d <sys_page_alloc>
+  80253f:	83 c4 10             	add    $0x10,%esp
+  802542:	85 c0                	test   %eax,%eax
+  802544:	78 28                	js     80256e <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802546:	83 ec 08             	sub    $0x8,%esp
+  802549:	68 80 25 80 00       	push   $0x802580
+  80254e:	6a 00                	push   $0x0
+  802550:	e8 23 ea ff ff       	call   800f78 <sys_env_set_pgfault_upcall>
+  802555:	83 c4 10             	add    $0x10,%esp
+  802558:	85 c0                	test   %eax,%eax
+  80255a:	79 c8                	jns    802524 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  80255c:	50                   	push   %eax
+  80255d:	68 f5 30 80 00       	push   $0x8030f5
+  802562:	6a 24                	push   $0x24
+  802564:	68 e7 30 80 00       	push   $0x8030e7
+  802569:	e8 d9 db ff ff       	call   800147 <_panic>
+			panic("sys_page_alloc: %e", r);
+  80256e:	50                   	push   %eax
+  80256f:	68 e6 2e 80 00       	push   $0x802ee6
+  802574:	6a 21                	push   $0x21
+  802576:	68 e7 30 80 00       	push   $0x8030e7
+  80257b:	e8 c7 db ff ff       	call   800147 <_panic>
+
+00802580 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802580:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802581:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802586:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802588:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  80258b:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  80258e:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  802592:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  802595:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  802599:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  80259d:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  80259f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8025a0:	83 c4 04             	add    $0x4,%esp
+	popf
+  8025a3:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8025a4:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8025a5:	c3                   	ret
+
+008025a6 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8025a6:	55                   	push   %ebp
+  8025a7:	89 e5                	mov    %esp,%ebp
+  8025a9:	57                   	push   %edi
+  8025aa:	56                   	push   %esi
+  8025ab:	53                   	push   %ebx
+  8025ac:	83 ec 18             	sub    $0x18,%esp
+  8025af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025b5:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8025b8:	85 db                	test   %ebx,%ebx
+  8025ba:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8025bf:	0f 45 c3             	cmovne %ebx,%eax
+  8025c2:	50                   	push   %eax
+  8025c3:	e8 38 ea ff ff       	call   801000 <sys_ipc_recv>
+
+	if (from_env_store)
+  8025c8:	83 c4 10             	add    $0x10,%esp
+  8025cb:	85 ff                	test   %edi,%edi
+  8025cd:	74 17                	je     8025e6 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8025cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d4:	85 c0                	test   %eax,%eax
+  8025d6:	75 0c                	jne    8025e4 <ipc_recv+0x3e>
+  8025d8:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+  8025de:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8025e4:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8025e6:	85 f6                	test   %esi,%esi
+  8025e8:	74 2e                	je     802618 <ipc_recv+0x72>
+		if (!r && pg)
+  8025ea:	85 c0                	test   %eax,%eax
+  8025ec:	75 24                	jne    802612 <ipc_recv+0x6c>
+  8025ee:	85 db                	test   %ebx,%ebx
+  8025f0:	74 20                	je     802612 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8025f2:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8025f7:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8025fd:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8025ff:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  802604:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80260a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80260d:	5b                   	pop    %ebx
+  80260e:	5e                   	pop    %esi
+  80260f:	5f                   	pop    %edi
+  802610:	5d                   	pop    %ebp
+  802611:	c3                   	ret
+			*perm_store = 0;
+  802612:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802618:	85 c0                	test   %eax,%eax
+  80261a:	75 ee                	jne    80260a <ipc_recv+0x64>
+  80261c:	eb e1                	jmp    8025ff <ipc_recv+0x59>
+
+0080261e <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80261e:	55                   	push   %ebp
+  80261f:	89 e5                	mov    %esp,%ebp
+  802621:	57                   	push   %edi
+  802622:	56                   	push   %esi
+  802623:	53                   	push   %ebx
+  802624:	83 ec 0c             	sub    $0xc,%esp
+  802627:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80262a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80262d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802630:	85 db                	test   %ebx,%ebx
+  802632:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802637:	0f 44 d8             	cmove  %eax,%ebx
+  80263a:	ff 75 14             	push   0x14(%ebp)
+  80263d:	53                   	push   %ebx
+  80263e:	56                   	push   %esi
+  80263f:	57                   	push   %edi
+  802640:	e8 98 e9 ff ff       	call   800fdd <sys_ipc_try_send_yield>
+  802645:	83 c4 10             	add    $0x10,%esp
+  802648:	85 c0                	test   %eax,%eax
+  80264a:	79 1e                	jns    80266a <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80264c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80264f:	75 07                	jne    802658 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802651:	e8 a7 e5 ff ff       	call   800bfd <sys_yield>
+  802656:	eb e2                	jmp    80263a <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802658:	50                   	push   %eax
+  802659:	68 13 31 80 00       	push   $0x803113
+  80265e:	6a 3d                	push   $0x3d
+  802660:	68 28 31 80 00       	push   $0x803128
+  802665:	e8 dd da ff ff       	call   800147 <_panic>
+	}
+}
+  80266a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80266d:	5b                   	pop    %ebx
+  80266e:	5e                   	pop    %esi
+  80266f:	5f                   	pop    %edi
+  802670:	5d                   	pop    %ebp
+  802671:	c3                   	ret
+
+00802672 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802672:	55                   	push   %ebp
+  802673:	89 e5                	mov    %esp,%ebp
+  802675:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802678:	ff 75 08             	push   0x8(%ebp)
+  80267b:	e8 fd e4 ff ff       	call   800b7d <sys_env_find>
+}
+  802680:	c9                   	leave
+  802681:	c3                   	ret
+
+00802682 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802682:	55                   	push   %ebp
+  802683:	89 e5                	mov    %esp,%ebp
+  802685:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802688:	89 c2                	mov    %eax,%edx
+  80268a:	c1 ea 16             	shr    $0x16,%edx
+  80268d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802694:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802699:	f6 c1 01             	test   $0x1,%cl
+  80269c:	74 22                	je     8026c0 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80269e:	c1 e8 0c             	shr    $0xc,%eax
+  8026a1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8026a8:	a8 01                	test   $0x1,%al
+  8026aa:	74 14                	je     8026c0 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8026ac:	c1 e8 0c             	shr    $0xc,%eax
+  8026af:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026b2:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8026b9:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8026bd:	0f b7 d2             	movzwl %dx,%edx
+}
+  8026c0:	89 d0                	mov    %edx,%eax
+  8026c2:	5d                   	pop    %ebp
+  8026c3:	c3                   	ret
+  8026c4:	66 90                	xchg   %ax,%ax
+  8026c6:	66 90                	xchg   %ax,%ax
+  8026c8:	66 90                	xchg   %ax,%ax
+  8026ca:	66 90                	xchg   %ax,%ax
+  8026cc:	66 90                	xchg   %ax,%ax
+  8026ce:	66 90                	xchg   %ax,%ax
+
+008026d0 <__udivmoddi4>:
+  8026d0:	55                   	push   %ebp
+  8026d1:	57                   	push   %edi
+  8026d2:	56                   	push   %esi
+  8026d3:	53                   	push   %ebx
+  8026d4:	83 ec 14             	sub    $0x14,%esp
+  8026d7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8026db:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8026df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026e7:	89 f1                	mov    %esi,%ecx
+  8026e9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8026ed:	09 d9                	or     %ebx,%ecx
+  8026ef:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8026f3:	0f 84 92 00 00 00    	je     80278b <__udivmoddi4+0xbb>
+  8026f9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802700:	00 
+  802701:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802706:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80270d:	00 
+  80270e:	89 1c 24             	mov    %ebx,(%esp)
+  802711:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802715:	8d 76 00             	lea    0x0(%esi),%esi
+  802718:	89 e9                	mov    %ebp,%ecx
+  80271a:	89 c3                	mov    %eax,%ebx
+  80271c:	89 d6                	mov    %edx,%esi
+  80271e:	31 ff                	xor    %edi,%edi
+  802720:	d3 ee                	shr    %cl,%esi
+  802722:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802725:	f6 c1 20             	test   $0x20,%cl
+  802728:	0f 45 de             	cmovne %esi,%ebx
+  80272b:	0f 45 f7             	cmovne %edi,%esi
+  80272e:	8b 3c 24             	mov    (%esp),%edi
+  802731:	39 fb                	cmp    %edi,%ebx
+  802733:	89 f7                	mov    %esi,%edi
+  802735:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802739:	8b 1c 24             	mov    (%esp),%ebx
+  80273c:	19 f7                	sbb    %esi,%edi
+  80273e:	72 39                	jb     802779 <__udivmoddi4+0xa9>
+  802740:	89 e9                	mov    %ebp,%ecx
+  802742:	89 f7                	mov    %esi,%edi
+  802744:	89 de                	mov    %ebx,%esi
+  802746:	0f a5 df             	shld   %cl,%ebx,%edi
+  802749:	d3 e6                	shl    %cl,%esi
+  80274b:	31 db                	xor    %ebx,%ebx
+  80274d:	f6 c1 20             	test   $0x20,%cl
+  802750:	0f 45 fe             	cmovne %esi,%edi
+  802753:	0f 45 f3             	cmovne %ebx,%esi
+  802756:	29 f0                	sub    %esi,%eax
+  802758:	be 01 00 00 00       	mov    $0x1,%esi
+  80275d:	19 fa                	sbb    %edi,%edx
+  80275f:	31 ff                	xor    %edi,%edi
+  802761:	31 db                	xor    %ebx,%ebx
+  802763:	0f a5 f7             	shld   %cl,%esi,%edi
+  802766:	d3 e6                	shl    %cl,%esi
+  802768:	f6 c1 20             	test   $0x20,%cl
+  80276b:	0f 45 fe             	cmovne %esi,%edi
+  80276e:	0f 45 f3             	cmovne %ebx,%esi
+  802771:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802775:	09 74 24 08          	or     %esi,0x8(%esp)
+  802779:	83 ed 01             	sub    $0x1,%ebp
+  80277c:	73 9a                	jae    802718 <__udivmoddi4+0x48>
+  80277e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802782:	85 ff                	test   %edi,%edi
+  802784:	74 05                	je     80278b <__udivmoddi4+0xbb>
+  802786:	89 07                	mov    %eax,(%edi)
+  802788:	89 57 04             	mov    %edx,0x4(%edi)
+  80278b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80278f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802793:	83 c4 14             	add    $0x14,%esp
+  802796:	5b                   	pop    %ebx
+  802797:	5e                   	pop    %esi
+  802798:	5f                   	pop    %edi
+  802799:	5d                   	pop    %ebp
+  80279a:	c3                   	ret
+  80279b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80279f:	90                   	nop
+
+008027a0 <__udivdi3>:
+  8027a0:	55                   	push   %ebp
+  8027a1:	57                   	push   %edi
+  8027a2:	56                   	push   %esi
+  8027a3:	53                   	push   %ebx
+  8027a4:	83 ec 14             	sub    $0x14,%esp
+  8027a7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8027ab:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8027af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027b7:	89 fb                	mov    %edi,%ebx
+  8027b9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8027bd:	09 f3                	or     %esi,%ebx
+  8027bf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8027c3:	0f 84 85 00 00 00    	je     80284e <__udivdi3+0xae>
+  8027c9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027d0:	00 
+  8027d1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8027d6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027dd:	00 
+  8027de:	89 34 24             	mov    %esi,(%esp)
+  8027e1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8027e5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027e8:	89 e9                	mov    %ebp,%ecx
+  8027ea:	89 c3                	mov    %eax,%ebx
+  8027ec:	89 d6                	mov    %edx,%esi
+  8027ee:	31 ff                	xor    %edi,%edi
+  8027f0:	d3 ee                	shr    %cl,%esi
+  8027f2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8027f5:	f6 c1 20             	test   $0x20,%cl
+  8027f8:	0f 45 de             	cmovne %esi,%ebx
+  8027fb:	0f 45 f7             	cmovne %edi,%esi
+  8027fe:	8b 3c 24             	mov    (%esp),%edi
+  802801:	39 fb                	cmp    %edi,%ebx
+  802803:	89 f7                	mov    %esi,%edi
+  802805:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802809:	8b 1c 24             	mov    (%esp),%ebx
+  80280c:	19 f7                	sbb    %esi,%edi
+  80280e:	72 39                	jb     802849 <__udivdi3+0xa9>
+  802810:	89 e9                	mov    %ebp,%ecx
+  802812:	89 f7                	mov    %esi,%edi
+  802814:	89 de                	mov    %ebx,%esi
+  802816:	0f a5 df             	shld   %cl,%ebx,%edi
+  802819:	d3 e6                	shl    %cl,%esi
+  80281b:	31 db                	xor    %ebx,%ebx
+  80281d:	f6 c1 20             	test   $0x20,%cl
+  802820:	0f 45 fe             	cmovne %esi,%edi
+  802823:	0f 45 f3             	cmovne %ebx,%esi
+  802826:	29 f0                	sub    %esi,%eax
+  802828:	be 01 00 00 00       	mov    $0x1,%esi
+  80282d:	19 fa                	sbb    %edi,%edx
+  80282f:	31 ff                	xor    %edi,%edi
+  802831:	31 db                	xor    %ebx,%ebx
+  802833:	0f a5 f7             	shld   %cl,%esi,%edi
+  802836:	d3 e6                	shl    %cl,%esi
+  802838:	f6 c1 20             	test   $0x20,%cl
+  80283b:	0f 45 fe             	cmovne %esi,%edi
+  80283e:	0f 45 f3             	cmovne %ebx,%esi
+  802841:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802845:	09 74 24 08          	or     %esi,0x8(%esp)
+  802849:	83 ed 01             	sub    $0x1,%ebp
+  80284c:	73 9a                	jae    8027e8 <__udivdi3+0x48>
+  80284e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802852:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802856:	83 c4 14             	add    $0x14,%esp
+  802859:	5b                   	pop    %ebx
+  80285a:	5e                   	pop    %esi
+  80285b:	5f                   	pop    %edi
+  80285c:	5d                   	pop    %ebp
+  80285d:	c3                   	ret
+  80285e:	66 90                	xchg   %ax,%ax
+
+00802860 <__umoddi3>:
+  802860:	57                   	push   %edi
+  802861:	56                   	push   %esi
+  802862:	53                   	push   %ebx
+  802863:	83 ec 08             	sub    $0x8,%esp
+  802866:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80286a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80286e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802872:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802876:	89 f9                	mov    %edi,%ecx
+  802878:	89 34 24             	mov    %esi,(%esp)
+  80287b:	09 f1                	or     %esi,%ecx
+  80287d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802881:	74 53                	je     8028d6 <__umoddi3+0x76>
+  802883:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80288f:	90                   	nop
+  802890:	89 c6                	mov    %eax,%esi
+  802892:	89 d7                	mov    %edx,%edi
+  802894:	31 db                	xor    %ebx,%ebx
+  802896:	d3 ef                	shr    %cl,%edi
+  802898:	0f ad d6             	shrd   %cl,%edx,%esi
+  80289b:	f6 c1 20             	test   $0x20,%cl
+  80289e:	0f 45 f7             	cmovne %edi,%esi
+  8028a1:	0f 45 fb             	cmovne %ebx,%edi
+  8028a4:	8b 1c 24             	mov    (%esp),%ebx
+  8028a7:	39 de                	cmp    %ebx,%esi
+  8028a9:	89 fb                	mov    %edi,%ebx
+  8028ab:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8028af:	8b 34 24             	mov    (%esp),%esi
+  8028b2:	19 fb                	sbb    %edi,%ebx
+  8028b4:	72 14                	jb     8028ca <__umoddi3+0x6a>
+  8028b6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8028b9:	31 db                	xor    %ebx,%ebx
+  8028bb:	d3 e6                	shl    %cl,%esi
+  8028bd:	f6 c1 20             	test   $0x20,%cl
+  8028c0:	0f 45 fe             	cmovne %esi,%edi
+  8028c3:	0f 45 f3             	cmovne %ebx,%esi
+  8028c6:	29 f0                	sub    %esi,%eax
+  8028c8:	19 fa                	sbb    %edi,%edx
+  8028ca:	83 e9 01             	sub    $0x1,%ecx
+  8028cd:	73 c1                	jae    802890 <__umoddi3+0x30>
+  8028cf:	83 c4 08             	add    $0x8,%esp
+  8028d2:	5b                   	pop    %ebx
+  8028d3:	5e                   	pop    %esi
+  8028d4:	5f                   	pop    %edi
+  8028d5:	c3                   	ret
+  8028d6:	83 c4 08             	add    $0x8,%esp
+  8028d9:	31 c0                	xor    %eax,%eax
+  8028db:	31 d2                	xor    %edx,%edx
+  8028dd:	5b                   	pop    %ebx
+  8028de:	5e                   	pop    %esi
+  8028df:	5f                   	pop    %edi
+  8028e0:	c3                   	ret
+  8028e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028ef:	90                   	nop
+
+008028f0 <__divdi3>:
+  8028f0:	55                   	push   %ebp
+  8028f1:	57                   	push   %edi
+  8028f2:	56                   	push   %esi
+  8028f3:	53                   	push   %ebx
+  8028f4:	83 ec 1c             	sub    $0x1c,%esp
+  8028f7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8028fb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8028ff:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802903:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802907:	85 ff                	test   %edi,%edi
+  802909:	0f 88 da 00 00 00    	js     8029e9 <__divdi3+0xf9>
+  80290f:	85 db                	test   %ebx,%ebx
+  802911:	78 16                	js     802929 <__divdi3+0x39>
+  802913:	89 dd                	mov    %ebx,%ebp
+  802915:	89 c8                	mov    %ecx,%eax
+  802917:	89 da                	mov    %ebx,%edx
+  802919:	09 cd                	or     %ecx,%ebp
+  80291b:	0f 85 fd 00 00 00    	jne    802a1e <__divdi3+0x12e>
+  802921:	83 c4 1c             	add    $0x1c,%esp
+  802924:	5b                   	pop    %ebx
+  802925:	5e                   	pop    %esi
+  802926:	5f                   	pop    %edi
+  802927:	5d                   	pop    %ebp
+  802928:	c3                   	ret
+  802929:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80292e:	f7 d9                	neg    %ecx
+  802930:	89 f0                	mov    %esi,%eax
+  802932:	89 fa                	mov    %edi,%edx
+  802934:	83 d3 00             	adc    $0x0,%ebx
+  802937:	89 0c 24             	mov    %ecx,(%esp)
+  80293a:	f7 db                	neg    %ebx
+  80293c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802940:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802947:	00 
+  802948:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80294d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802954:	00 
+  802955:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802959:	89 cd                	mov    %ecx,%ebp
+  80295b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80295f:	90                   	nop
+  802960:	89 e9                	mov    %ebp,%ecx
+  802962:	89 c3                	mov    %eax,%ebx
+  802964:	89 d6                	mov    %edx,%esi
+  802966:	31 ff                	xor    %edi,%edi
+  802968:	d3 ee                	shr    %cl,%esi
+  80296a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80296d:	f6 c1 20             	test   $0x20,%cl
+  802970:	0f 45 de             	cmovne %esi,%ebx
+  802973:	0f 45 f7             	cmovne %edi,%esi
+  802976:	8b 3c 24             	mov    (%esp),%edi
+  802979:	39 fb                	cmp    %edi,%ebx
+  80297b:	89 f7                	mov    %esi,%edi
+  80297d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802981:	8b 1c 24             	mov    (%esp),%ebx
+  802984:	19 f7                	sbb    %esi,%edi
+  802986:	72 39                	jb     8029c1 <__divdi3+0xd1>
+  802988:	89 e9                	mov    %ebp,%ecx
+  80298a:	89 f7                	mov    %esi,%edi
+  80298c:	89 de                	mov    %ebx,%esi
+  80298e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802991:	d3 e6                	shl    %cl,%esi
+  802993:	31 db                	xor    %ebx,%ebx
+  802995:	f6 c1 20             	test   $0x20,%cl
+  802998:	0f 45 fe             	cmovne %esi,%edi
+  80299b:	0f 45 f3             	cmovne %ebx,%esi
+  80299e:	29 f0                	sub    %esi,%eax
+  8029a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8029a5:	19 fa                	sbb    %edi,%edx
+  8029a7:	31 ff                	xor    %edi,%edi
+  8029a9:	31 db                	xor    %ebx,%ebx
+  8029ab:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029ae:	d3 e6                	shl    %cl,%esi
+  8029b0:	f6 c1 20             	test   $0x20,%cl
+  8029b3:	0f 45 fe             	cmovne %esi,%edi
+  8029b6:	0f 45 f3             	cmovne %ebx,%esi
+  8029b9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8029bd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8029c1:	83 ed 01             	sub    $0x1,%ebp
+  8029c4:	73 9a                	jae    802960 <__divdi3+0x70>
+  8029c6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8029ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029d2:	85 ed                	test   %ebp,%ebp
+  8029d4:	0f 84 47 ff ff ff    	je     802921 <__divdi3+0x31>
+  8029da:	f7 d8                	neg    %eax
+  8029dc:	83 d2 00             	adc    $0x0,%edx
+  8029df:	83 c4 1c             	add    $0x1c,%esp
+  8029e2:	5b                   	pop    %ebx
+  8029e3:	f7 da                	neg    %edx
+  8029e5:	5e                   	pop    %esi
+  8029e6:	5f                   	pop    %edi
+  8029e7:	5d                   	pop    %ebp
+  8029e8:	c3                   	ret
+  8029e9:	f7 de                	neg    %esi
+  8029eb:	83 d7 00             	adc    $0x0,%edi
+  8029ee:	f7 df                	neg    %edi
+  8029f0:	85 db                	test   %ebx,%ebx
+  8029f2:	78 23                	js     802a17 <__divdi3+0x127>
+  8029f4:	89 dd                	mov    %ebx,%ebp
+  8029f6:	89 c8                	mov    %ecx,%eax
+  8029f8:	89 da                	mov    %ebx,%edx
+  8029fa:	09 cd                	or     %ecx,%ebp
+  8029fc:	0f 84 1f ff ff ff    	je     802921 <__divdi3+0x31>
+  802a02:	89 0c 24             	mov    %ecx,(%esp)
+  802a05:	89 f0                	mov    %esi,%eax
+  802a07:	89 fa                	mov    %edi,%edx
+  802a09:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802a0e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a12:	e9 29 ff ff ff       	jmp    802940 <__divdi3+0x50>
+  802a17:	31 ed                	xor    %ebp,%ebp
+  802a19:	e9 10 ff ff ff       	jmp    80292e <__divdi3+0x3e>
+  802a1e:	89 0c 24             	mov    %ecx,(%esp)
+  802a21:	89 f0                	mov    %esi,%eax
+  802a23:	89 fa                	mov    %edi,%edx
+  802a25:	31 ed                	xor    %ebp,%ebp
+  802a27:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a2b:	e9 10 ff ff ff       	jmp    802940 <__divdi3+0x50>
+
+00802a30 <__moddi3>:
+  802a30:	55                   	push   %ebp
+  802a31:	57                   	push   %edi
+  802a32:	56                   	push   %esi
+  802a33:	53                   	push   %ebx
+  802a34:	83 ec 14             	sub    $0x14,%esp
+  802a37:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a3b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a3f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802a43:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802a47:	85 d2                	test   %edx,%edx
+  802a49:	0f 88 9b 00 00 00    	js     802aea <__moddi3+0xba>
+  802a4f:	89 f7                	mov    %esi,%edi
+  802a51:	31 ed                	xor    %ebp,%ebp
+  802a53:	09 cf                	or     %ecx,%edi
+  802a55:	0f 84 83 00 00 00    	je     802ade <__moddi3+0xae>
+  802a5b:	89 cb                	mov    %ecx,%ebx
+  802a5d:	89 f7                	mov    %esi,%edi
+  802a5f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802a63:	f7 db                	neg    %ebx
+  802a65:	83 d7 00             	adc    $0x0,%edi
+  802a68:	f7 df                	neg    %edi
+  802a6a:	0f 49 f7             	cmovns %edi,%esi
+  802a6d:	0f 49 cb             	cmovns %ebx,%ecx
+  802a70:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802a74:	89 0c 24             	mov    %ecx,(%esp)
+  802a77:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a7c:	89 cd                	mov    %ecx,%ebp
+  802a7e:	66 90                	xchg   %ax,%ax
+  802a80:	89 e9                	mov    %ebp,%ecx
+  802a82:	89 c3                	mov    %eax,%ebx
+  802a84:	89 d6                	mov    %edx,%esi
+  802a86:	31 ff                	xor    %edi,%edi
+  802a88:	d3 ee                	shr    %cl,%esi
+  802a8a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a8d:	f6 c1 20             	test   $0x20,%cl
+  802a90:	0f 45 de             	cmovne %esi,%ebx
+  802a93:	0f 45 f7             	cmovne %edi,%esi
+  802a96:	8b 3c 24             	mov    (%esp),%edi
+  802a99:	39 fb                	cmp    %edi,%ebx
+  802a9b:	89 f7                	mov    %esi,%edi
+  802a9d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802aa1:	8b 1c 24             	mov    (%esp),%ebx
+  802aa4:	19 f7                	sbb    %esi,%edi
+  802aa6:	72 1a                	jb     802ac2 <__moddi3+0x92>
+  802aa8:	89 e9                	mov    %ebp,%ecx
+  802aaa:	89 f7                	mov    %esi,%edi
+  802aac:	89 de                	mov    %ebx,%esi
+  802aae:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ab1:	d3 e6                	shl    %cl,%esi
+  802ab3:	31 db                	xor    %ebx,%ebx
+  802ab5:	f6 c1 20             	test   $0x20,%cl
+  802ab8:	0f 45 fe             	cmovne %esi,%edi
+  802abb:	0f 45 f3             	cmovne %ebx,%esi
+  802abe:	29 f0                	sub    %esi,%eax
+  802ac0:	19 fa                	sbb    %edi,%edx
+  802ac2:	83 ed 01             	sub    $0x1,%ebp
+  802ac5:	73 b9                	jae    802a80 <__moddi3+0x50>
+  802ac7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802acb:	85 ed                	test   %ebp,%ebp
+  802acd:	74 07                	je     802ad6 <__moddi3+0xa6>
+  802acf:	f7 d8                	neg    %eax
+  802ad1:	83 d2 00             	adc    $0x0,%edx
+  802ad4:	f7 da                	neg    %edx
+  802ad6:	83 c4 14             	add    $0x14,%esp
+  802ad9:	5b                   	pop    %ebx
+  802ada:	5e                   	pop    %esi
+  802adb:	5f                   	pop    %edi
+  802adc:	5d                   	pop    %ebp
+  802add:	c3                   	ret
+  802ade:	83 c4 14             	add    $0x14,%esp
+  802ae1:	31 c0                	xor    %eax,%eax
+  802ae3:	31 d2                	xor    %edx,%edx
+  802ae5:	5b                   	pop    %ebx
+  802ae6:	5e                   	pop    %esi
+  802ae7:	5f                   	pop    %edi
+  802ae8:	5d                   	pop    %ebp
+  802ae9:	c3                   	ret
+  802aea:	89 f7                	mov    %esi,%edi
+  802aec:	09 cf                	or     %ecx,%edi
+  802aee:	74 11                	je     802b01 <__moddi3+0xd1>
+  802af0:	f7 d8                	neg    %eax
+  802af2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802af7:	83 d2 00             	adc    $0x0,%edx
+  802afa:	f7 da                	neg    %edx
+  802afc:	e9 5a ff ff ff       	jmp    802a5b <__moddi3+0x2b>
+  802b01:	31 c0                	xor    %eax,%eax
+  802b03:	31 d2                	xor    %edx,%edx
+  802b05:	eb c8                	jmp    802acf <__moddi3+0x9f>
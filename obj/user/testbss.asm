@@ -0,0 +1,5616 @@
+
+obj/user/testbss.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ab 00 00 00       	call   8000dc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	int i;
+
+	cprintf("Making sure bss works right...\n");
+  800039:	68 20 27 80 00       	push   $0x802720
+  80003e:	e8 d4 01 00 00       	call   800217 <cprintf>
+  800043:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < ARRAYSIZE; i++)
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != 0)
+  80004b:	83 3c 85 20 40 80 00 	cmpl   $0x0,0x804020(,%eax,4)
+  800052:	00 
+  800053:	75 63                	jne    8000b8 <umain+0x85>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800055:	83 c0 01             	add    $0x1,%eax
+  800058:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005d:	75 ec                	jne    80004b <umain+0x18>
+			panic("bigarray[%d] isn't cleared!\n", i);
+	for (i = 0; i < ARRAYSIZE; i++)
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+		bigarray[i] = i;
+  800064:	89 04 85 20 40 80 00 	mov    %eax,0x804020(,%eax,4)
+	for (i = 0; i < ARRAYSIZE; i++)
+  80006b:	83 c0 01             	add    $0x1,%eax
+  80006e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800073:	75 ef                	jne    800064 <umain+0x31>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != i)
+  80007a:	39 04 85 20 40 80 00 	cmp    %eax,0x804020(,%eax,4)
+  800081:	75 47                	jne    8000ca <umain+0x97>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800083:	83 c0 01             	add    $0x1,%eax
+  800086:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80008b:	75 ed                	jne    80007a <umain+0x47>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+
+	cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	68 68 27 80 00       	push   $0x802768
+  800095:	e8 7d 01 00 00       	call   800217 <cprintf>
+	bigarray[ARRAYSIZE+1024] = 0;
+  80009a:	c7 05 20 50 c0 00 00 	movl   $0x0,0xc05020
+  8000a1:	00 00 00 
+	panic("SHOULD HAVE TRAPPED!!!");
+  8000a4:	83 c4 0c             	add    $0xc,%esp
+  8000a7:	68 c7 27 80 00       	push   $0x8027c7
+  8000ac:	6a 1a                	push   $0x1a
+  8000ae:	68 b8 27 80 00       	push   $0x8027b8
+  8000b3:	e8 84 00 00 00       	call   80013c <_panic>
+			panic("bigarray[%d] isn't cleared!\n", i);
+  8000b8:	50                   	push   %eax
+  8000b9:	68 9b 27 80 00       	push   $0x80279b
+  8000be:	6a 11                	push   $0x11
+  8000c0:	68 b8 27 80 00       	push   $0x8027b8
+  8000c5:	e8 72 00 00 00       	call   80013c <_panic>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+  8000ca:	50                   	push   %eax
+  8000cb:	68 40 27 80 00       	push   $0x802740
+  8000d0:	6a 16                	push   $0x16
+  8000d2:	68 b8 27 80 00       	push   $0x8027b8
+  8000d7:	e8 60 00 00 00       	call   80013c <_panic>
+
+008000dc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000dc:	55                   	push   %ebp
+  8000dd:	89 e5                	mov    %esp,%ebp
+  8000df:	56                   	push   %esi
+  8000e0:	53                   	push   %ebx
+  8000e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000e7:	e8 e7 0a 00 00       	call   800bd3 <sys_getenvid>
+  8000ec:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000f1:	c1 e0 09             	shl    $0x9,%eax
+  8000f4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000f9:	a3 20 40 c0 00       	mov    %eax,0xc04020
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000fe:	85 db                	test   %ebx,%ebx
+  800100:	7e 07                	jle    800109 <libmain+0x2d>
+		binaryname = argv[0];
+  800102:	8b 06                	mov    (%esi),%eax
+  800104:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800109:	83 ec 08             	sub    $0x8,%esp
+  80010c:	56                   	push   %esi
+  80010d:	53                   	push   %ebx
+  80010e:	e8 20 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800113:	e8 0a 00 00 00       	call   800122 <exit>
+}
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011e:	5b                   	pop    %ebx
+  80011f:	5e                   	pop    %esi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+
+00800122 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800122:	55                   	push   %ebp
+  800123:	89 e5                	mov    %esp,%ebp
+  800125:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800128:	e8 3e 11 00 00       	call   80126b <close_all>
+	sys_env_destroy(0);
+  80012d:	83 ec 0c             	sub    $0xc,%esp
+  800130:	6a 00                	push   $0x0
+  800132:	e8 5b 0a 00 00       	call   800b92 <sys_env_destroy>
+}
+  800137:	83 c4 10             	add    $0x10,%esp
+  80013a:	c9                   	leave
+  80013b:	c3                   	ret
+
+0080013c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80013c:	55                   	push   %ebp
+  80013d:	89 e5                	mov    %esp,%ebp
+  80013f:	56                   	push   %esi
+  800140:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800141:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800144:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80014a:	e8 84 0a 00 00       	call   800bd3 <sys_getenvid>
+  80014f:	83 ec 0c             	sub    $0xc,%esp
+  800152:	ff 75 0c             	push   0xc(%ebp)
+  800155:	ff 75 08             	push   0x8(%ebp)
+  800158:	56                   	push   %esi
+  800159:	50                   	push   %eax
+  80015a:	68 e8 27 80 00       	push   $0x8027e8
+  80015f:	e8 b3 00 00 00       	call   800217 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800164:	83 c4 18             	add    $0x18,%esp
+  800167:	53                   	push   %ebx
+  800168:	ff 75 10             	push   0x10(%ebp)
+  80016b:	e8 56 00 00 00       	call   8001c6 <vcprintf>
+	cprintf("\n");
+  800170:	c7 04 24 b6 27 80 00 	movl   $0x8027b6,(%esp)
+  800177:	e8 9b 00 00 00       	call   800217 <cprintf>
+  80017c:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80017f:	cc                   	int3
+	while (1)
+  800180:	eb fd                	jmp    80017f <_panic+0x43>
+
+00800182 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800182:	55                   	push   %ebp
+  800183:	89 e5                	mov    %esp,%ebp
+  800185:	53                   	push   %ebx
+  800186:	83 ec 04             	sub    $0x4,%esp
+  800189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80018c:	8b 13                	mov    (%ebx),%edx
+  80018e:	8d 42 01             	lea    0x1(%edx),%eax
+  800191:	89 03                	mov    %eax,(%ebx)
+  800193:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800196:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80019a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80019f:	74 09                	je     8001aa <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001a1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001a8:	c9                   	leave
+  8001a9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001aa:	83 ec 08             	sub    $0x8,%esp
+  8001ad:	68 ff 00 00 00       	push   $0xff
+  8001b2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001b5:	50                   	push   %eax
+  8001b6:	e8 7a 09 00 00       	call   800b35 <sys_cputs>
+		b->idx = 0;
+  8001bb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001c1:	83 c4 10             	add    $0x10,%esp
+  8001c4:	eb db                	jmp    8001a1 <putch+0x1f>
+
+008001c6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001c6:	55                   	push   %ebp
+  8001c7:	89 e5                	mov    %esp,%ebp
+  8001c9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001cf:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001d6:	00 00 00 
+	b.cnt = 0;
+  8001d9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001e0:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001e3:	ff 75 0c             	push   0xc(%ebp)
+  8001e6:	ff 75 08             	push   0x8(%ebp)
+  8001e9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001ef:	50                   	push   %eax
+  8001f0:	68 82 01 80 00       	push   $0x800182
+  8001f5:	e8 14 01 00 00       	call   80030e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001fa:	83 c4 08             	add    $0x8,%esp
+  8001fd:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800203:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800209:	50                   	push   %eax
+  80020a:	e8 26 09 00 00       	call   800b35 <sys_cputs>
+
+	return b.cnt;
+}
+  80020f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800215:	c9                   	leave
+  800216:	c3                   	ret
+
+00800217 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800217:	55                   	push   %ebp
+  800218:	89 e5                	mov    %esp,%ebp
+  80021a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80021d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800220:	50                   	push   %eax
+  800221:	ff 75 08             	push   0x8(%ebp)
+  800224:	e8 9d ff ff ff       	call   8001c6 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800229:	c9                   	leave
+  80022a:	c3                   	ret
+
+0080022b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80022b:	55                   	push   %ebp
+  80022c:	89 e5                	mov    %esp,%ebp
+  80022e:	57                   	push   %edi
+  80022f:	56                   	push   %esi
+  800230:	53                   	push   %ebx
+  800231:	83 ec 1c             	sub    $0x1c,%esp
+  800234:	89 c7                	mov    %eax,%edi
+  800236:	89 d6                	mov    %edx,%esi
+  800238:	8b 45 08             	mov    0x8(%ebp),%eax
+  80023b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80023e:	89 d1                	mov    %edx,%ecx
+  800240:	89 c2                	mov    %eax,%edx
+  800242:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800245:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800248:	8b 45 10             	mov    0x10(%ebp),%eax
+  80024b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80024e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800251:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800258:	39 c2                	cmp    %eax,%edx
+  80025a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80025d:	72 3e                	jb     80029d <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80025f:	83 ec 0c             	sub    $0xc,%esp
+  800262:	ff 75 18             	push   0x18(%ebp)
+  800265:	83 eb 01             	sub    $0x1,%ebx
+  800268:	53                   	push   %ebx
+  800269:	50                   	push   %eax
+  80026a:	83 ec 08             	sub    $0x8,%esp
+  80026d:	ff 75 e4             	push   -0x1c(%ebp)
+  800270:	ff 75 e0             	push   -0x20(%ebp)
+  800273:	ff 75 dc             	push   -0x24(%ebp)
+  800276:	ff 75 d8             	push   -0x28(%ebp)
+  800279:	e8 22 21 00 00       	call   8023a0 <__udivdi3>
+  80027e:	83 c4 18             	add    $0x18,%esp
+  800281:	52                   	push   %edx
+  800282:	50                   	push   %eax
+  800283:	89 f2                	mov    %esi,%edx
+  800285:	89 f8                	mov    %edi,%eax
+  800287:	e8 9f ff ff ff       	call   80022b <printnum>
+  80028c:	83 c4 20             	add    $0x20,%esp
+  80028f:	eb 13                	jmp    8002a4 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800291:	83 ec 08             	sub    $0x8,%esp
+  800294:	56                   	push   %esi
+  800295:	ff 75 18             	push   0x18(%ebp)
+  800298:	ff d7                	call   *%edi
+  80029a:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80029d:	83 eb 01             	sub    $0x1,%ebx
+  8002a0:	85 db                	test   %ebx,%ebx
+  8002a2:	7f ed                	jg     800291 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002a4:	83 ec 08             	sub    $0x8,%esp
+  8002a7:	56                   	push   %esi
+  8002a8:	83 ec 04             	sub    $0x4,%esp
+  8002ab:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ae:	ff 75 e0             	push   -0x20(%ebp)
+  8002b1:	ff 75 dc             	push   -0x24(%ebp)
+  8002b4:	ff 75 d8             	push   -0x28(%ebp)
+  8002b7:	e8 a4 21 00 00       	call   802460 <__umoddi3>
+  8002bc:	83 c4 14             	add    $0x14,%esp
+  8002bf:	0f be 80 0b 28 80 00 	movsbl 0x80280b(%eax),%eax
+  8002c6:	50                   	push   %eax
+  8002c7:	ff d7                	call   *%edi
+}
+  8002c9:	83 c4 10             	add    $0x10,%esp
+  8002cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002cf:	5b                   	pop    %ebx
+  8002d0:	5e                   	pop    %esi
+  8002d1:	5f                   	pop    %edi
+  8002d2:	5d                   	pop    %ebp
+  8002d3:	c3                   	ret
+
+008002d4 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002d4:	55                   	push   %ebp
+  8002d5:	89 e5                	mov    %esp,%ebp
+  8002d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002da:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002de:	8b 10                	mov    (%eax),%edx
+  8002e0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002e3:	73 0a                	jae    8002ef <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002e5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002e8:	89 08                	mov    %ecx,(%eax)
+  8002ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ed:	88 02                	mov    %al,(%edx)
+}
+  8002ef:	5d                   	pop    %ebp
+  8002f0:	c3                   	ret
+
+008002f1 <printfmt>:
+{
+  8002f1:	55                   	push   %ebp
+  8002f2:	89 e5                	mov    %esp,%ebp
+  8002f4:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002f7:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002fa:	50                   	push   %eax
+  8002fb:	ff 75 10             	push   0x10(%ebp)
+  8002fe:	ff 75 0c             	push   0xc(%ebp)
+  800301:	ff 75 08             	push   0x8(%ebp)
+  800304:	e8 05 00 00 00       	call   80030e <vprintfmt>
+}
+  800309:	83 c4 10             	add    $0x10,%esp
+  80030c:	c9                   	leave
+  80030d:	c3                   	ret
+
+0080030e <vprintfmt>:
+{
+  80030e:	55                   	push   %ebp
+  80030f:	89 e5                	mov    %esp,%ebp
+  800311:	57                   	push   %edi
+  800312:	56                   	push   %esi
+  800313:	53                   	push   %ebx
+  800314:	83 ec 2c             	sub    $0x2c,%esp
+  800317:	8b 75 08             	mov    0x8(%ebp),%esi
+  80031a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80031d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800320:	eb 0a                	jmp    80032c <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800322:	83 ec 08             	sub    $0x8,%esp
+  800325:	53                   	push   %ebx
+  800326:	50                   	push   %eax
+  800327:	ff d6                	call   *%esi
+  800329:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80032c:	83 c7 01             	add    $0x1,%edi
+  80032f:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800333:	83 f8 25             	cmp    $0x25,%eax
+  800336:	74 0c                	je     800344 <vprintfmt+0x36>
+			if (ch == '\0')
+  800338:	85 c0                	test   %eax,%eax
+  80033a:	75 e6                	jne    800322 <vprintfmt+0x14>
+}
+  80033c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033f:	5b                   	pop    %ebx
+  800340:	5e                   	pop    %esi
+  800341:	5f                   	pop    %edi
+  800342:	5d                   	pop    %ebp
+  800343:	c3                   	ret
+		padc = ' ';
+  800344:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800348:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80034f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800356:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80035d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800362:	8d 47 01             	lea    0x1(%edi),%eax
+  800365:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800368:	0f b6 17             	movzbl (%edi),%edx
+  80036b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80036e:	3c 55                	cmp    $0x55,%al
+  800370:	0f 87 cf 03 00 00    	ja     800745 <vprintfmt+0x437>
+  800376:	0f b6 c0             	movzbl %al,%eax
+  800379:	ff 24 85 40 29 80 00 	jmp    *0x802940(,%eax,4)
+  800380:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800383:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800387:	eb d9                	jmp    800362 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800389:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80038c:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800390:	eb d0                	jmp    800362 <vprintfmt+0x54>
+  800392:	0f b6 d2             	movzbl %dl,%edx
+  800395:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003a0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003a3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003a7:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003aa:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003ad:	83 f9 09             	cmp    $0x9,%ecx
+  8003b0:	77 55                	ja     800407 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003b2:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003b5:	eb e9                	jmp    8003a0 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ba:	8b 00                	mov    (%eax),%eax
+  8003bc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8003c5:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003cb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003cf:	79 91                	jns    800362 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003d1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003d4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003de:	eb 82                	jmp    800362 <vprintfmt+0x54>
+			if (width < 0)
+  8003e0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003e3:	85 d2                	test   %edx,%edx
+  8003e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ea:	0f 49 c2             	cmovns %edx,%eax
+  8003ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f3:	e9 6a ff ff ff       	jmp    800362 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003fb:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800402:	e9 5b ff ff ff       	jmp    800362 <vprintfmt+0x54>
+  800407:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80040a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80040d:	eb bc                	jmp    8003cb <vprintfmt+0xbd>
+			lflag++;
+  80040f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800412:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800415:	e9 48 ff ff ff       	jmp    800362 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80041a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041d:	8d 78 04             	lea    0x4(%eax),%edi
+  800420:	83 ec 08             	sub    $0x8,%esp
+  800423:	53                   	push   %ebx
+  800424:	ff 30                	push   (%eax)
+  800426:	ff d6                	call   *%esi
+			break;
+  800428:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80042b:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80042e:	e9 b1 02 00 00       	jmp    8006e4 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800433:	8b 45 14             	mov    0x14(%ebp),%eax
+  800436:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800439:	8b 10                	mov    (%eax),%edx
+  80043b:	89 d0                	mov    %edx,%eax
+  80043d:	f7 d8                	neg    %eax
+  80043f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800442:	83 f8 0f             	cmp    $0xf,%eax
+  800445:	7f 23                	jg     80046a <vprintfmt+0x15c>
+  800447:	8b 14 85 a0 2a 80 00 	mov    0x802aa0(,%eax,4),%edx
+  80044e:	85 d2                	test   %edx,%edx
+  800450:	74 18                	je     80046a <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800452:	52                   	push   %edx
+  800453:	68 d5 2b 80 00       	push   $0x802bd5
+  800458:	53                   	push   %ebx
+  800459:	56                   	push   %esi
+  80045a:	e8 92 fe ff ff       	call   8002f1 <printfmt>
+  80045f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800462:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800465:	e9 7a 02 00 00       	jmp    8006e4 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80046a:	50                   	push   %eax
+  80046b:	68 23 28 80 00       	push   $0x802823
+  800470:	53                   	push   %ebx
+  800471:	56                   	push   %esi
+  800472:	e8 7a fe ff ff       	call   8002f1 <printfmt>
+  800477:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047a:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80047d:	e9 62 02 00 00       	jmp    8006e4 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800482:	8b 45 14             	mov    0x14(%ebp),%eax
+  800485:	83 c0 04             	add    $0x4,%eax
+  800488:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80048b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800490:	85 c9                	test   %ecx,%ecx
+  800492:	b8 1c 28 80 00       	mov    $0x80281c,%eax
+  800497:	0f 45 c1             	cmovne %ecx,%eax
+  80049a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80049d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004a1:	7e 06                	jle    8004a9 <vprintfmt+0x19b>
+  8004a3:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004a7:	75 0b                	jne    8004b4 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004a9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004ac:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004af:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b2:	eb 5c                	jmp    800510 <vprintfmt+0x202>
+  8004b4:	83 ec 08             	sub    $0x8,%esp
+  8004b7:	ff 75 d0             	push   -0x30(%ebp)
+  8004ba:	ff 75 cc             	push   -0x34(%ebp)
+  8004bd:	e8 20 03 00 00       	call   8007e2 <strnlen>
+  8004c2:	89 c2                	mov    %eax,%edx
+  8004c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004c7:	29 d0                	sub    %edx,%eax
+  8004c9:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004cc:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d6:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d8:	eb 0e                	jmp    8004e8 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004da:	83 ec 08             	sub    $0x8,%esp
+  8004dd:	53                   	push   %ebx
+  8004de:	57                   	push   %edi
+  8004df:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e2:	83 ee 01             	sub    $0x1,%esi
+  8004e5:	83 c4 10             	add    $0x10,%esp
+  8004e8:	85 f6                	test   %esi,%esi
+  8004ea:	7f ee                	jg     8004da <vprintfmt+0x1cc>
+  8004ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f2:	85 c0                	test   %eax,%eax
+  8004f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f9:	0f 49 d0             	cmovns %eax,%edx
+  8004fc:	29 d0                	sub    %edx,%eax
+  8004fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800501:	eb a6                	jmp    8004a9 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800503:	83 ec 08             	sub    $0x8,%esp
+  800506:	53                   	push   %ebx
+  800507:	52                   	push   %edx
+  800508:	ff 55 08             	call   *0x8(%ebp)
+  80050b:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80050e:	89 f1                	mov    %esi,%ecx
+  800510:	8d 71 01             	lea    0x1(%ecx),%esi
+  800513:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800517:	0f be d0             	movsbl %al,%edx
+  80051a:	85 d2                	test   %edx,%edx
+  80051c:	74 28                	je     800546 <vprintfmt+0x238>
+  80051e:	85 ff                	test   %edi,%edi
+  800520:	78 05                	js     800527 <vprintfmt+0x219>
+  800522:	83 ef 01             	sub    $0x1,%edi
+  800525:	78 30                	js     800557 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800527:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80052b:	74 d6                	je     800503 <vprintfmt+0x1f5>
+  80052d:	0f be c0             	movsbl %al,%eax
+  800530:	83 e8 20             	sub    $0x20,%eax
+  800533:	83 f8 5e             	cmp    $0x5e,%eax
+  800536:	76 cb                	jbe    800503 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800538:	83 ec 08             	sub    $0x8,%esp
+  80053b:	53                   	push   %ebx
+  80053c:	6a 3f                	push   $0x3f
+  80053e:	ff 55 08             	call   *0x8(%ebp)
+  800541:	83 c4 10             	add    $0x10,%esp
+  800544:	eb c8                	jmp    80050e <vprintfmt+0x200>
+  800546:	8b 75 08             	mov    0x8(%ebp),%esi
+  800549:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80054c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80054f:	01 d0                	add    %edx,%eax
+  800551:	29 c8                	sub    %ecx,%eax
+  800553:	89 c7                	mov    %eax,%edi
+  800555:	eb 13                	jmp    80056a <vprintfmt+0x25c>
+  800557:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055a:	eb ed                	jmp    800549 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80055c:	83 ec 08             	sub    $0x8,%esp
+  80055f:	53                   	push   %ebx
+  800560:	6a 20                	push   $0x20
+  800562:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800564:	83 ef 01             	sub    $0x1,%edi
+  800567:	83 c4 10             	add    $0x10,%esp
+  80056a:	85 ff                	test   %edi,%edi
+  80056c:	7f ee                	jg     80055c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80056e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800571:	89 45 14             	mov    %eax,0x14(%ebp)
+  800574:	e9 6b 01 00 00       	jmp    8006e4 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800579:	83 f9 01             	cmp    $0x1,%ecx
+  80057c:	7f 1f                	jg     80059d <vprintfmt+0x28f>
+	else if (lflag)
+  80057e:	85 c9                	test   %ecx,%ecx
+  800580:	74 67                	je     8005e9 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800582:	8b 45 14             	mov    0x14(%ebp),%eax
+  800585:	8b 00                	mov    (%eax),%eax
+  800587:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058a:	89 c1                	mov    %eax,%ecx
+  80058c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80058f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800592:	8b 45 14             	mov    0x14(%ebp),%eax
+  800595:	8d 40 04             	lea    0x4(%eax),%eax
+  800598:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059b:	eb 17                	jmp    8005b4 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80059d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a0:	8b 50 04             	mov    0x4(%eax),%edx
+  8005a3:	8b 00                	mov    (%eax),%eax
+  8005a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ae:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005b4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005ba:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005bf:	85 c9                	test   %ecx,%ecx
+  8005c1:	0f 89 03 01 00 00    	jns    8006ca <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005c7:	83 ec 08             	sub    $0x8,%esp
+  8005ca:	53                   	push   %ebx
+  8005cb:	6a 2d                	push   $0x2d
+  8005cd:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005cf:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005d5:	f7 da                	neg    %edx
+  8005d7:	83 d1 00             	adc    $0x0,%ecx
+  8005da:	f7 d9                	neg    %ecx
+  8005dc:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005df:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005e4:	e9 e1 00 00 00       	jmp    8006ca <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 00                	mov    (%eax),%eax
+  8005ee:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f1:	89 c1                	mov    %eax,%ecx
+  8005f3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005f6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ff:	89 45 14             	mov    %eax,0x14(%ebp)
+  800602:	eb b0                	jmp    8005b4 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800604:	83 f9 01             	cmp    $0x1,%ecx
+  800607:	7f 1e                	jg     800627 <vprintfmt+0x319>
+	else if (lflag)
+  800609:	85 c9                	test   %ecx,%ecx
+  80060b:	74 32                	je     80063f <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80060d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800610:	8b 10                	mov    (%eax),%edx
+  800612:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800617:	8d 40 04             	lea    0x4(%eax),%eax
+  80061a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80061d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800622:	e9 a3 00 00 00       	jmp    8006ca <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800627:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062a:	8b 10                	mov    (%eax),%edx
+  80062c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80062f:	8d 40 08             	lea    0x8(%eax),%eax
+  800632:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800635:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80063a:	e9 8b 00 00 00       	jmp    8006ca <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8b 10                	mov    (%eax),%edx
+  800644:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800649:	8d 40 04             	lea    0x4(%eax),%eax
+  80064c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800654:	eb 74                	jmp    8006ca <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800656:	83 f9 01             	cmp    $0x1,%ecx
+  800659:	7f 1b                	jg     800676 <vprintfmt+0x368>
+	else if (lflag)
+  80065b:	85 c9                	test   %ecx,%ecx
+  80065d:	74 2c                	je     80068b <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80065f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800662:	8b 10                	mov    (%eax),%edx
+  800664:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800669:	8d 40 04             	lea    0x4(%eax),%eax
+  80066c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80066f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800674:	eb 54                	jmp    8006ca <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8b 10                	mov    (%eax),%edx
+  80067b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80067e:	8d 40 08             	lea    0x8(%eax),%eax
+  800681:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800684:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800689:	eb 3f                	jmp    8006ca <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 10                	mov    (%eax),%edx
+  800690:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800695:	8d 40 04             	lea    0x4(%eax),%eax
+  800698:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80069b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006a0:	eb 28                	jmp    8006ca <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006a2:	83 ec 08             	sub    $0x8,%esp
+  8006a5:	53                   	push   %ebx
+  8006a6:	6a 30                	push   $0x30
+  8006a8:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006aa:	83 c4 08             	add    $0x8,%esp
+  8006ad:	53                   	push   %ebx
+  8006ae:	6a 78                	push   $0x78
+  8006b0:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 10                	mov    (%eax),%edx
+  8006b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006bc:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c5:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006ca:	83 ec 0c             	sub    $0xc,%esp
+  8006cd:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006d1:	50                   	push   %eax
+  8006d2:	ff 75 e0             	push   -0x20(%ebp)
+  8006d5:	57                   	push   %edi
+  8006d6:	51                   	push   %ecx
+  8006d7:	52                   	push   %edx
+  8006d8:	89 da                	mov    %ebx,%edx
+  8006da:	89 f0                	mov    %esi,%eax
+  8006dc:	e8 4a fb ff ff       	call   80022b <printnum>
+			break;
+  8006e1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006e7:	e9 40 fc ff ff       	jmp    80032c <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006ec:	83 f9 01             	cmp    $0x1,%ecx
+  8006ef:	7f 1b                	jg     80070c <vprintfmt+0x3fe>
+	else if (lflag)
+  8006f1:	85 c9                	test   %ecx,%ecx
+  8006f3:	74 2c                	je     800721 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f8:	8b 10                	mov    (%eax),%edx
+  8006fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800702:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800705:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80070a:	eb be                	jmp    8006ca <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80070c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070f:	8b 10                	mov    (%eax),%edx
+  800711:	8b 48 04             	mov    0x4(%eax),%ecx
+  800714:	8d 40 08             	lea    0x8(%eax),%eax
+  800717:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80071f:	eb a9                	jmp    8006ca <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 10                	mov    (%eax),%edx
+  800726:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072b:	8d 40 04             	lea    0x4(%eax),%eax
+  80072e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800731:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800736:	eb 92                	jmp    8006ca <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800738:	83 ec 08             	sub    $0x8,%esp
+  80073b:	53                   	push   %ebx
+  80073c:	6a 25                	push   $0x25
+  80073e:	ff d6                	call   *%esi
+			break;
+  800740:	83 c4 10             	add    $0x10,%esp
+  800743:	eb 9f                	jmp    8006e4 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800745:	83 ec 08             	sub    $0x8,%esp
+  800748:	53                   	push   %ebx
+  800749:	6a 25                	push   $0x25
+  80074b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80074d:	83 c4 10             	add    $0x10,%esp
+  800750:	89 f8                	mov    %edi,%eax
+  800752:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800756:	74 05                	je     80075d <vprintfmt+0x44f>
+  800758:	83 e8 01             	sub    $0x1,%eax
+  80075b:	eb f5                	jmp    800752 <vprintfmt+0x444>
+  80075d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800760:	eb 82                	jmp    8006e4 <vprintfmt+0x3d6>
+
+00800762 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800762:	55                   	push   %ebp
+  800763:	89 e5                	mov    %esp,%ebp
+  800765:	83 ec 18             	sub    $0x18,%esp
+  800768:	8b 45 08             	mov    0x8(%ebp),%eax
+  80076b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80076e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800771:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800775:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800778:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80077f:	85 c0                	test   %eax,%eax
+  800781:	74 26                	je     8007a9 <vsnprintf+0x47>
+  800783:	85 d2                	test   %edx,%edx
+  800785:	7e 22                	jle    8007a9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800787:	ff 75 14             	push   0x14(%ebp)
+  80078a:	ff 75 10             	push   0x10(%ebp)
+  80078d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800790:	50                   	push   %eax
+  800791:	68 d4 02 80 00       	push   $0x8002d4
+  800796:	e8 73 fb ff ff       	call   80030e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80079b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80079e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007a4:	83 c4 10             	add    $0x10,%esp
+}
+  8007a7:	c9                   	leave
+  8007a8:	c3                   	ret
+		return -E_INVAL;
+  8007a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007ae:	eb f7                	jmp    8007a7 <vsnprintf+0x45>
+
+008007b0 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007b6:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007b9:	50                   	push   %eax
+  8007ba:	ff 75 10             	push   0x10(%ebp)
+  8007bd:	ff 75 0c             	push   0xc(%ebp)
+  8007c0:	ff 75 08             	push   0x8(%ebp)
+  8007c3:	e8 9a ff ff ff       	call   800762 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007c8:	c9                   	leave
+  8007c9:	c3                   	ret
+
+008007ca <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007ca:	55                   	push   %ebp
+  8007cb:	89 e5                	mov    %esp,%ebp
+  8007cd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d5:	eb 03                	jmp    8007da <strlen+0x10>
+		n++;
+  8007d7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007da:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007de:	75 f7                	jne    8007d7 <strlen+0xd>
+	return n;
+}
+  8007e0:	5d                   	pop    %ebp
+  8007e1:	c3                   	ret
+
+008007e2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007e2:	55                   	push   %ebp
+  8007e3:	89 e5                	mov    %esp,%ebp
+  8007e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f0:	eb 03                	jmp    8007f5 <strnlen+0x13>
+		n++;
+  8007f2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f5:	39 d0                	cmp    %edx,%eax
+  8007f7:	74 08                	je     800801 <strnlen+0x1f>
+  8007f9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007fd:	75 f3                	jne    8007f2 <strnlen+0x10>
+  8007ff:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800801:	89 d0                	mov    %edx,%eax
+  800803:	5d                   	pop    %ebp
+  800804:	c3                   	ret
+
+00800805 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800805:	55                   	push   %ebp
+  800806:	89 e5                	mov    %esp,%ebp
+  800808:	53                   	push   %ebx
+  800809:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80080c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80080f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800814:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800818:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80081b:	83 c0 01             	add    $0x1,%eax
+  80081e:	84 d2                	test   %dl,%dl
+  800820:	75 f2                	jne    800814 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800822:	89 c8                	mov    %ecx,%eax
+  800824:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800827:	c9                   	leave
+  800828:	c3                   	ret
+
+00800829 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800829:	55                   	push   %ebp
+  80082a:	89 e5                	mov    %esp,%ebp
+  80082c:	53                   	push   %ebx
+  80082d:	83 ec 10             	sub    $0x10,%esp
+  800830:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800833:	53                   	push   %ebx
+  800834:	e8 91 ff ff ff       	call   8007ca <strlen>
+  800839:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80083c:	ff 75 0c             	push   0xc(%ebp)
+  80083f:	01 d8                	add    %ebx,%eax
+  800841:	50                   	push   %eax
+  800842:	e8 be ff ff ff       	call   800805 <strcpy>
+	return dst;
+}
+  800847:	89 d8                	mov    %ebx,%eax
+  800849:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084c:	c9                   	leave
+  80084d:	c3                   	ret
+
+0080084e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80084e:	55                   	push   %ebp
+  80084f:	89 e5                	mov    %esp,%ebp
+  800851:	56                   	push   %esi
+  800852:	53                   	push   %ebx
+  800853:	8b 75 08             	mov    0x8(%ebp),%esi
+  800856:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800859:	89 f3                	mov    %esi,%ebx
+  80085b:	03 5d 10             	add    0x10(%ebp),%ebx
+  80085e:	89 f0                	mov    %esi,%eax
+  800860:	eb 0f                	jmp    800871 <strncpy+0x23>
+		*dst++ = *src;
+  800862:	83 c0 01             	add    $0x1,%eax
+  800865:	0f b6 0a             	movzbl (%edx),%ecx
+  800868:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80086b:	80 f9 01             	cmp    $0x1,%cl
+  80086e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800871:	39 d8                	cmp    %ebx,%eax
+  800873:	75 ed                	jne    800862 <strncpy+0x14>
+	}
+	return ret;
+}
+  800875:	89 f0                	mov    %esi,%eax
+  800877:	5b                   	pop    %ebx
+  800878:	5e                   	pop    %esi
+  800879:	5d                   	pop    %ebp
+  80087a:	c3                   	ret
+
+0080087b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80087b:	55                   	push   %ebp
+  80087c:	89 e5                	mov    %esp,%ebp
+  80087e:	56                   	push   %esi
+  80087f:	53                   	push   %ebx
+  800880:	8b 75 08             	mov    0x8(%ebp),%esi
+  800883:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800886:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800889:	89 f0                	mov    %esi,%eax
+  80088b:	85 d2                	test   %edx,%edx
+  80088d:	74 21                	je     8008b0 <strlcpy+0x35>
+  80088f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800893:	89 f2                	mov    %esi,%edx
+  800895:	eb 09                	jmp    8008a0 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800897:	83 c1 01             	add    $0x1,%ecx
+  80089a:	83 c2 01             	add    $0x1,%edx
+  80089d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008a0:	39 c2                	cmp    %eax,%edx
+  8008a2:	74 09                	je     8008ad <strlcpy+0x32>
+  8008a4:	0f b6 19             	movzbl (%ecx),%ebx
+  8008a7:	84 db                	test   %bl,%bl
+  8008a9:	75 ec                	jne    800897 <strlcpy+0x1c>
+  8008ab:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008ad:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008b0:	29 f0                	sub    %esi,%eax
+}
+  8008b2:	5b                   	pop    %ebx
+  8008b3:	5e                   	pop    %esi
+  8008b4:	5d                   	pop    %ebp
+  8008b5:	c3                   	ret
+
+008008b6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008b6:	55                   	push   %ebp
+  8008b7:	89 e5                	mov    %esp,%ebp
+  8008b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008bf:	eb 06                	jmp    8008c7 <strcmp+0x11>
+		p++, q++;
+  8008c1:	83 c1 01             	add    $0x1,%ecx
+  8008c4:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008c7:	0f b6 01             	movzbl (%ecx),%eax
+  8008ca:	84 c0                	test   %al,%al
+  8008cc:	74 04                	je     8008d2 <strcmp+0x1c>
+  8008ce:	3a 02                	cmp    (%edx),%al
+  8008d0:	74 ef                	je     8008c1 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008d2:	0f b6 c0             	movzbl %al,%eax
+  8008d5:	0f b6 12             	movzbl (%edx),%edx
+  8008d8:	29 d0                	sub    %edx,%eax
+}
+  8008da:	5d                   	pop    %ebp
+  8008db:	c3                   	ret
+
+008008dc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008dc:	55                   	push   %ebp
+  8008dd:	89 e5                	mov    %esp,%ebp
+  8008df:	53                   	push   %ebx
+  8008e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008e9:	eb 09                	jmp    8008f4 <strncmp+0x18>
+		n--, p++, q++;
+  8008eb:	83 ea 01             	sub    $0x1,%edx
+  8008ee:	83 c0 01             	add    $0x1,%eax
+  8008f1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008f4:	85 d2                	test   %edx,%edx
+  8008f6:	74 18                	je     800910 <strncmp+0x34>
+  8008f8:	0f b6 18             	movzbl (%eax),%ebx
+  8008fb:	84 db                	test   %bl,%bl
+  8008fd:	74 04                	je     800903 <strncmp+0x27>
+  8008ff:	3a 19                	cmp    (%ecx),%bl
+  800901:	74 e8                	je     8008eb <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800903:	0f b6 00             	movzbl (%eax),%eax
+  800906:	0f b6 11             	movzbl (%ecx),%edx
+  800909:	29 d0                	sub    %edx,%eax
+}
+  80090b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090e:	c9                   	leave
+  80090f:	c3                   	ret
+		return 0;
+  800910:	b8 00 00 00 00       	mov    $0x0,%eax
+  800915:	eb f4                	jmp    80090b <strncmp+0x2f>
+
+00800917 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80091d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800921:	eb 03                	jmp    800926 <strchr+0xf>
+  800923:	83 c0 01             	add    $0x1,%eax
+  800926:	0f b6 10             	movzbl (%eax),%edx
+  800929:	84 d2                	test   %dl,%dl
+  80092b:	74 06                	je     800933 <strchr+0x1c>
+		if (*s == c)
+  80092d:	38 ca                	cmp    %cl,%dl
+  80092f:	75 f2                	jne    800923 <strchr+0xc>
+  800931:	eb 05                	jmp    800938 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800933:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800938:	5d                   	pop    %ebp
+  800939:	c3                   	ret
+
+0080093a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80093a:	55                   	push   %ebp
+  80093b:	89 e5                	mov    %esp,%ebp
+  80093d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800940:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800944:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800947:	38 ca                	cmp    %cl,%dl
+  800949:	74 09                	je     800954 <strfind+0x1a>
+  80094b:	84 d2                	test   %dl,%dl
+  80094d:	74 05                	je     800954 <strfind+0x1a>
+	for (; *s; s++)
+  80094f:	83 c0 01             	add    $0x1,%eax
+  800952:	eb f0                	jmp    800944 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800954:	5d                   	pop    %ebp
+  800955:	c3                   	ret
+
+00800956 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800956:	55                   	push   %ebp
+  800957:	89 e5                	mov    %esp,%ebp
+  800959:	57                   	push   %edi
+  80095a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80095d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800960:	85 c9                	test   %ecx,%ecx
+  800962:	74 20                	je     800984 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800964:	89 f8                	mov    %edi,%eax
+  800966:	09 c8                	or     %ecx,%eax
+  800968:	a8 03                	test   $0x3,%al
+  80096a:	75 12                	jne    80097e <memset+0x28>
+		c &= 0xFF;
+  80096c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800970:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800976:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800979:	fc                   	cld
+  80097a:	f3 ab                	rep stos %eax,%es:(%edi)
+  80097c:	eb 06                	jmp    800984 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80097e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800981:	fc                   	cld
+  800982:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800984:	89 f8                	mov    %edi,%eax
+  800986:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800989:	c9                   	leave
+  80098a:	c3                   	ret
+
+0080098b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80098b:	55                   	push   %ebp
+  80098c:	89 e5                	mov    %esp,%ebp
+  80098e:	57                   	push   %edi
+  80098f:	56                   	push   %esi
+  800990:	8b 45 08             	mov    0x8(%ebp),%eax
+  800993:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800996:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800999:	39 c6                	cmp    %eax,%esi
+  80099b:	73 32                	jae    8009cf <memmove+0x44>
+  80099d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009a0:	39 d0                	cmp    %edx,%eax
+  8009a2:	73 2b                	jae    8009cf <memmove+0x44>
+		s += n;
+		d += n;
+  8009a4:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009a7:	89 d6                	mov    %edx,%esi
+  8009a9:	09 fe                	or     %edi,%esi
+  8009ab:	09 ce                	or     %ecx,%esi
+  8009ad:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009b3:	75 0e                	jne    8009c3 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009b5:	83 ef 04             	sub    $0x4,%edi
+  8009b8:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009bb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009be:	fd                   	std
+  8009bf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009c1:	eb 09                	jmp    8009cc <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009c3:	83 ef 01             	sub    $0x1,%edi
+  8009c6:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009c9:	fd                   	std
+  8009ca:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009cc:	fc                   	cld
+  8009cd:	eb 1a                	jmp    8009e9 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009cf:	89 f2                	mov    %esi,%edx
+  8009d1:	09 c2                	or     %eax,%edx
+  8009d3:	09 ca                	or     %ecx,%edx
+  8009d5:	f6 c2 03             	test   $0x3,%dl
+  8009d8:	75 0a                	jne    8009e4 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009da:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009dd:	89 c7                	mov    %eax,%edi
+  8009df:	fc                   	cld
+  8009e0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e2:	eb 05                	jmp    8009e9 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009e4:	89 c7                	mov    %eax,%edi
+  8009e6:	fc                   	cld
+  8009e7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009e9:	5e                   	pop    %esi
+  8009ea:	5f                   	pop    %edi
+  8009eb:	5d                   	pop    %ebp
+  8009ec:	c3                   	ret
+
+008009ed <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009ed:	55                   	push   %ebp
+  8009ee:	89 e5                	mov    %esp,%ebp
+  8009f0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009f3:	ff 75 10             	push   0x10(%ebp)
+  8009f6:	ff 75 0c             	push   0xc(%ebp)
+  8009f9:	ff 75 08             	push   0x8(%ebp)
+  8009fc:	e8 8a ff ff ff       	call   80098b <memmove>
+}
+  800a01:	c9                   	leave
+  800a02:	c3                   	ret
+
+00800a03 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a03:	55                   	push   %ebp
+  800a04:	89 e5                	mov    %esp,%ebp
+  800a06:	56                   	push   %esi
+  800a07:	53                   	push   %ebx
+  800a08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a0e:	89 c6                	mov    %eax,%esi
+  800a10:	03 75 10             	add    0x10(%ebp),%esi
+  800a13:	eb 06                	jmp    800a1b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a15:	83 c0 01             	add    $0x1,%eax
+  800a18:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a1b:	39 f0                	cmp    %esi,%eax
+  800a1d:	74 14                	je     800a33 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a1f:	0f b6 08             	movzbl (%eax),%ecx
+  800a22:	0f b6 1a             	movzbl (%edx),%ebx
+  800a25:	38 d9                	cmp    %bl,%cl
+  800a27:	74 ec                	je     800a15 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a29:	0f b6 c1             	movzbl %cl,%eax
+  800a2c:	0f b6 db             	movzbl %bl,%ebx
+  800a2f:	29 d8                	sub    %ebx,%eax
+  800a31:	eb 05                	jmp    800a38 <memcmp+0x35>
+	}
+
+	return 0;
+  800a33:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a38:	5b                   	pop    %ebx
+  800a39:	5e                   	pop    %esi
+  800a3a:	5d                   	pop    %ebp
+  800a3b:	c3                   	ret
+
+00800a3c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a3c:	55                   	push   %ebp
+  800a3d:	89 e5                	mov    %esp,%ebp
+  800a3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a45:	89 c2                	mov    %eax,%edx
+  800a47:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a4a:	eb 03                	jmp    800a4f <memfind+0x13>
+  800a4c:	83 c0 01             	add    $0x1,%eax
+  800a4f:	39 d0                	cmp    %edx,%eax
+  800a51:	73 04                	jae    800a57 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a53:	38 08                	cmp    %cl,(%eax)
+  800a55:	75 f5                	jne    800a4c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a57:	5d                   	pop    %ebp
+  800a58:	c3                   	ret
+
+00800a59 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a59:	55                   	push   %ebp
+  800a5a:	89 e5                	mov    %esp,%ebp
+  800a5c:	57                   	push   %edi
+  800a5d:	56                   	push   %esi
+  800a5e:	53                   	push   %ebx
+  800a5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a65:	eb 03                	jmp    800a6a <strtol+0x11>
+		s++;
+  800a67:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a6a:	0f b6 02             	movzbl (%edx),%eax
+  800a6d:	3c 20                	cmp    $0x20,%al
+  800a6f:	74 f6                	je     800a67 <strtol+0xe>
+  800a71:	3c 09                	cmp    $0x9,%al
+  800a73:	74 f2                	je     800a67 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a75:	3c 2b                	cmp    $0x2b,%al
+  800a77:	74 2a                	je     800aa3 <strtol+0x4a>
+	int neg = 0;
+  800a79:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a7e:	3c 2d                	cmp    $0x2d,%al
+  800a80:	74 2b                	je     800aad <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a82:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a88:	75 0f                	jne    800a99 <strtol+0x40>
+  800a8a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a8d:	74 28                	je     800ab7 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a8f:	85 db                	test   %ebx,%ebx
+  800a91:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a96:	0f 44 d8             	cmove  %eax,%ebx
+  800a99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a9e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800aa1:	eb 46                	jmp    800ae9 <strtol+0x90>
+		s++;
+  800aa3:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800aa6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aab:	eb d5                	jmp    800a82 <strtol+0x29>
+		s++, neg = 1;
+  800aad:	83 c2 01             	add    $0x1,%edx
+  800ab0:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ab5:	eb cb                	jmp    800a82 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab7:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800abb:	74 0e                	je     800acb <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800abd:	85 db                	test   %ebx,%ebx
+  800abf:	75 d8                	jne    800a99 <strtol+0x40>
+		s++, base = 8;
+  800ac1:	83 c2 01             	add    $0x1,%edx
+  800ac4:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ac9:	eb ce                	jmp    800a99 <strtol+0x40>
+		s += 2, base = 16;
+  800acb:	83 c2 02             	add    $0x2,%edx
+  800ace:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ad3:	eb c4                	jmp    800a99 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ad5:	0f be c0             	movsbl %al,%eax
+  800ad8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800adb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ade:	7d 3a                	jge    800b1a <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ae0:	83 c2 01             	add    $0x1,%edx
+  800ae3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ae7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ae9:	0f b6 02             	movzbl (%edx),%eax
+  800aec:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800aef:	89 f3                	mov    %esi,%ebx
+  800af1:	80 fb 09             	cmp    $0x9,%bl
+  800af4:	76 df                	jbe    800ad5 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800af6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800af9:	89 f3                	mov    %esi,%ebx
+  800afb:	80 fb 19             	cmp    $0x19,%bl
+  800afe:	77 08                	ja     800b08 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b00:	0f be c0             	movsbl %al,%eax
+  800b03:	83 e8 57             	sub    $0x57,%eax
+  800b06:	eb d3                	jmp    800adb <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b08:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b0b:	89 f3                	mov    %esi,%ebx
+  800b0d:	80 fb 19             	cmp    $0x19,%bl
+  800b10:	77 08                	ja     800b1a <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b12:	0f be c0             	movsbl %al,%eax
+  800b15:	83 e8 37             	sub    $0x37,%eax
+  800b18:	eb c1                	jmp    800adb <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b1a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b1e:	74 05                	je     800b25 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b20:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b23:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b25:	89 c8                	mov    %ecx,%eax
+  800b27:	f7 d8                	neg    %eax
+  800b29:	85 ff                	test   %edi,%edi
+  800b2b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b2e:	89 c8                	mov    %ecx,%eax
+  800b30:	5b                   	pop    %ebx
+  800b31:	5e                   	pop    %esi
+  800b32:	5f                   	pop    %edi
+  800b33:	5d                   	pop    %ebp
+  800b34:	c3                   	ret
+
+00800b35 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b35:	55                   	push   %ebp
+  800b36:	89 e5                	mov    %esp,%ebp
+  800b38:	57                   	push   %edi
+  800b39:	56                   	push   %esi
+  800b3a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b46:	89 c3                	mov    %eax,%ebx
+  800b48:	89 c7                	mov    %eax,%edi
+  800b4a:	89 c6                	mov    %eax,%esi
+  800b4c:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b4e:	5b                   	pop    %ebx
+  800b4f:	5e                   	pop    %esi
+  800b50:	5f                   	pop    %edi
+  800b51:	5d                   	pop    %ebp
+  800b52:	c3                   	ret
+
+00800b53 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	57                   	push   %edi
+  800b57:	56                   	push   %esi
+  800b58:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b63:	89 d1                	mov    %edx,%ecx
+  800b65:	89 d3                	mov    %edx,%ebx
+  800b67:	89 d7                	mov    %edx,%edi
+  800b69:	89 d6                	mov    %edx,%esi
+  800b6b:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b6d:	5b                   	pop    %ebx
+  800b6e:	5e                   	pop    %esi
+  800b6f:	5f                   	pop    %edi
+  800b70:	5d                   	pop    %ebp
+  800b71:	c3                   	ret
+
+00800b72 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	57                   	push   %edi
+  800b76:	56                   	push   %esi
+  800b77:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b80:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b85:	89 cb                	mov    %ecx,%ebx
+  800b87:	89 cf                	mov    %ecx,%edi
+  800b89:	89 ce                	mov    %ecx,%esi
+  800b8b:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b8d:	5b                   	pop    %ebx
+  800b8e:	5e                   	pop    %esi
+  800b8f:	5f                   	pop    %edi
+  800b90:	5d                   	pop    %ebp
+  800b91:	c3                   	ret
+
+00800b92 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b92:	55                   	push   %ebp
+  800b93:	89 e5                	mov    %esp,%ebp
+  800b95:	57                   	push   %edi
+  800b96:	56                   	push   %esi
+  800b97:	53                   	push   %ebx
+  800b98:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba3:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ba8:	89 cb                	mov    %ecx,%ebx
+  800baa:	89 cf                	mov    %ecx,%edi
+  800bac:	89 ce                	mov    %ecx,%esi
+  800bae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bb0:	85 c0                	test   %eax,%eax
+  800bb2:	7f 08                	jg     800bbc <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb7:	5b                   	pop    %ebx
+  800bb8:	5e                   	pop    %esi
+  800bb9:	5f                   	pop    %edi
+  800bba:	5d                   	pop    %ebp
+  800bbb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bbc:	83 ec 0c             	sub    $0xc,%esp
+  800bbf:	50                   	push   %eax
+  800bc0:	6a 03                	push   $0x3
+  800bc2:	68 ff 2a 80 00       	push   $0x802aff
+  800bc7:	6a 23                	push   $0x23
+  800bc9:	68 1c 2b 80 00       	push   $0x802b1c
+  800bce:	e8 69 f5 ff ff       	call   80013c <_panic>
+
+00800bd3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bd3:	55                   	push   %ebp
+  800bd4:	89 e5                	mov    %esp,%ebp
+  800bd6:	57                   	push   %edi
+  800bd7:	56                   	push   %esi
+  800bd8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bde:	b8 02 00 00 00       	mov    $0x2,%eax
+  800be3:	89 d1                	mov    %edx,%ecx
+  800be5:	89 d3                	mov    %edx,%ebx
+  800be7:	89 d7                	mov    %edx,%edi
+  800be9:	89 d6                	mov    %edx,%esi
+  800beb:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bed:	5b                   	pop    %ebx
+  800bee:	5e                   	pop    %esi
+  800bef:	5f                   	pop    %edi
+  800bf0:	5d                   	pop    %ebp
+  800bf1:	c3                   	ret
+
+00800bf2 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	57                   	push   %edi
+  800bf6:	56                   	push   %esi
+  800bf7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfd:	b8 16 00 00 00       	mov    $0x16,%eax
+  800c02:	89 d1                	mov    %edx,%ecx
+  800c04:	89 d3                	mov    %edx,%ebx
+  800c06:	89 d7                	mov    %edx,%edi
+  800c08:	89 d6                	mov    %edx,%esi
+  800c0a:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c0c:	5b                   	pop    %ebx
+  800c0d:	5e                   	pop    %esi
+  800c0e:	5f                   	pop    %edi
+  800c0f:	5d                   	pop    %ebp
+  800c10:	c3                   	ret
+
+00800c11 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	57                   	push   %edi
+  800c15:	56                   	push   %esi
+  800c16:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800c21:	89 d1                	mov    %edx,%ecx
+  800c23:	89 d3                	mov    %edx,%ebx
+  800c25:	89 d7                	mov    %edx,%edi
+  800c27:	89 d6                	mov    %edx,%esi
+  800c29:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800c2b:	5b                   	pop    %ebx
+  800c2c:	5e                   	pop    %esi
+  800c2d:	5f                   	pop    %edi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+
+00800c30 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	57                   	push   %edi
+  800c34:	56                   	push   %esi
+  800c35:	53                   	push   %ebx
+  800c36:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c44:	b8 15 00 00 00       	mov    $0x15,%eax
+  800c49:	89 df                	mov    %ebx,%edi
+  800c4b:	89 de                	mov    %ebx,%esi
+  800c4d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c4f:	85 c0                	test   %eax,%eax
+  800c51:	7f 08                	jg     800c5b <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800c53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c56:	5b                   	pop    %ebx
+  800c57:	5e                   	pop    %esi
+  800c58:	5f                   	pop    %edi
+  800c59:	5d                   	pop    %ebp
+  800c5a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c5b:	83 ec 0c             	sub    $0xc,%esp
+  800c5e:	50                   	push   %eax
+  800c5f:	6a 15                	push   $0x15
+  800c61:	68 ff 2a 80 00       	push   $0x802aff
+  800c66:	6a 23                	push   $0x23
+  800c68:	68 1c 2b 80 00       	push   $0x802b1c
+  800c6d:	e8 ca f4 ff ff       	call   80013c <_panic>
+
+00800c72 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c72:	55                   	push   %ebp
+  800c73:	89 e5                	mov    %esp,%ebp
+  800c75:	57                   	push   %edi
+  800c76:	56                   	push   %esi
+  800c77:	53                   	push   %ebx
+  800c78:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c7b:	be 00 00 00 00       	mov    $0x0,%esi
+  800c80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c86:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c8e:	89 f7                	mov    %esi,%edi
+  800c90:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c92:	85 c0                	test   %eax,%eax
+  800c94:	7f 08                	jg     800c9e <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c99:	5b                   	pop    %ebx
+  800c9a:	5e                   	pop    %esi
+  800c9b:	5f                   	pop    %edi
+  800c9c:	5d                   	pop    %ebp
+  800c9d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c9e:	83 ec 0c             	sub    $0xc,%esp
+  800ca1:	50                   	push   %eax
+  800ca2:	6a 05                	push   $0x5
+  800ca4:	68 ff 2a 80 00       	push   $0x802aff
+  800ca9:	6a 23                	push   $0x23
+  800cab:	68 1c 2b 80 00       	push   $0x802b1c
+  800cb0:	e8 87 f4 ff ff       	call   80013c <_panic>
+
+00800cb5 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	57                   	push   %edi
+  800cb9:	56                   	push   %esi
+  800cba:	53                   	push   %ebx
+  800cbb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cbe:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cd1:	89 f7                	mov    %esi,%edi
+  800cd3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd5:	85 c0                	test   %eax,%eax
+  800cd7:	7f 08                	jg     800ce1 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdc:	5b                   	pop    %ebx
+  800cdd:	5e                   	pop    %esi
+  800cde:	5f                   	pop    %edi
+  800cdf:	5d                   	pop    %ebp
+  800ce0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce1:	83 ec 0c             	sub    $0xc,%esp
+  800ce4:	50                   	push   %eax
+  800ce5:	6a 06                	push   $0x6
+  800ce7:	68 ff 2a 80 00       	push   $0x802aff
+  800cec:	6a 23                	push   $0x23
+  800cee:	68 1c 2b 80 00       	push   $0x802b1c
+  800cf3:	e8 44 f4 ff ff       	call   80013c <_panic>
+
+00800cf8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	57                   	push   %edi
+  800cfc:	56                   	push   %esi
+  800cfd:	53                   	push   %ebx
+  800cfe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d07:	b8 07 00 00 00       	mov    $0x7,%eax
+  800d0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d0f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d12:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d15:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d17:	85 c0                	test   %eax,%eax
+  800d19:	7f 08                	jg     800d23 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d23:	83 ec 0c             	sub    $0xc,%esp
+  800d26:	50                   	push   %eax
+  800d27:	6a 07                	push   $0x7
+  800d29:	68 ff 2a 80 00       	push   $0x802aff
+  800d2e:	6a 23                	push   $0x23
+  800d30:	68 1c 2b 80 00       	push   $0x802b1c
+  800d35:	e8 02 f4 ff ff       	call   80013c <_panic>
+
+00800d3a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d3a:	55                   	push   %ebp
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	57                   	push   %edi
+  800d3e:	56                   	push   %esi
+  800d3f:	53                   	push   %ebx
+  800d40:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d53:	89 df                	mov    %ebx,%edi
+  800d55:	89 de                	mov    %ebx,%esi
+  800d57:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d59:	85 c0                	test   %eax,%eax
+  800d5b:	7f 08                	jg     800d65 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d60:	5b                   	pop    %ebx
+  800d61:	5e                   	pop    %esi
+  800d62:	5f                   	pop    %edi
+  800d63:	5d                   	pop    %ebp
+  800d64:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d65:	83 ec 0c             	sub    $0xc,%esp
+  800d68:	50                   	push   %eax
+  800d69:	6a 08                	push   $0x8
+  800d6b:	68 ff 2a 80 00       	push   $0x802aff
+  800d70:	6a 23                	push   $0x23
+  800d72:	68 1c 2b 80 00       	push   $0x802b1c
+  800d77:	e8 c0 f3 ff ff       	call   80013c <_panic>
+
+00800d7c <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d7c:	55                   	push   %ebp
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	57                   	push   %edi
+  800d80:	56                   	push   %esi
+  800d81:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d88:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d8d:	be 00 00 00 00       	mov    $0x0,%esi
+  800d92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d95:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d98:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d9a:	5b                   	pop    %ebx
+  800d9b:	5e                   	pop    %esi
+  800d9c:	5f                   	pop    %edi
+  800d9d:	5d                   	pop    %ebp
+  800d9e:	c3                   	ret
+
+00800d9f <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	57                   	push   %edi
+  800da3:	56                   	push   %esi
+  800da4:	53                   	push   %ebx
+  800da5:	8b 45 18             	mov    0x18(%ebp),%eax
+  800da8:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800dab:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800db0:	77 27                	ja     800dd9 <sys_page_map_range+0x3a>
+  800db2:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800db8:	77 1f                	ja     800dd9 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800dba:	c1 e0 0c             	shl    $0xc,%eax
+  800dbd:	89 c6                	mov    %eax,%esi
+  800dbf:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800dc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dcc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dcf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dd2:	cd 30                	int    $0x30
+}
+  800dd4:	5b                   	pop    %ebx
+  800dd5:	5e                   	pop    %esi
+  800dd6:	5f                   	pop    %edi
+  800dd7:	5d                   	pop    %ebp
+  800dd8:	c3                   	ret
+		return -E_INVAL;
+  800dd9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dde:	eb f4                	jmp    800dd4 <sys_page_map_range+0x35>
+
+00800de0 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	57                   	push   %edi
+  800de4:	56                   	push   %esi
+  800de5:	53                   	push   %ebx
+  800de6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800de9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800def:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800df4:	be 00 00 00 00       	mov    $0x0,%esi
+  800df9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e01:	85 c0                	test   %eax,%eax
+  800e03:	7f 08                	jg     800e0d <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800e05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e08:	5b                   	pop    %ebx
+  800e09:	5e                   	pop    %esi
+  800e0a:	5f                   	pop    %edi
+  800e0b:	5d                   	pop    %ebp
+  800e0c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0d:	83 ec 0c             	sub    $0xc,%esp
+  800e10:	50                   	push   %eax
+  800e11:	6a 0c                	push   $0xc
+  800e13:	68 ff 2a 80 00       	push   $0x802aff
+  800e18:	6a 23                	push   $0x23
+  800e1a:	68 1c 2b 80 00       	push   $0x802b1c
+  800e1f:	e8 18 f3 ff ff       	call   80013c <_panic>
+
+00800e24 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e24:	55                   	push   %ebp
+  800e25:	89 e5                	mov    %esp,%ebp
+  800e27:	57                   	push   %edi
+  800e28:	56                   	push   %esi
+  800e29:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e2a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e35:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3d:	89 f7                	mov    %esi,%edi
+  800e3f:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5f                   	pop    %edi
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+
+00800e46 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	57                   	push   %edi
+  800e4a:	56                   	push   %esi
+  800e4b:	53                   	push   %ebx
+  800e4c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e5f:	89 df                	mov    %ebx,%edi
+  800e61:	89 de                	mov    %ebx,%esi
+  800e63:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e65:	85 c0                	test   %eax,%eax
+  800e67:	7f 08                	jg     800e71 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6c:	5b                   	pop    %ebx
+  800e6d:	5e                   	pop    %esi
+  800e6e:	5f                   	pop    %edi
+  800e6f:	5d                   	pop    %ebp
+  800e70:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e71:	83 ec 0c             	sub    $0xc,%esp
+  800e74:	50                   	push   %eax
+  800e75:	6a 0f                	push   $0xf
+  800e77:	68 ff 2a 80 00       	push   $0x802aff
+  800e7c:	6a 23                	push   $0x23
+  800e7e:	68 1c 2b 80 00       	push   $0x802b1c
+  800e83:	e8 b4 f2 ff ff       	call   80013c <_panic>
+
+00800e88 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e88:	55                   	push   %ebp
+  800e89:	89 e5                	mov    %esp,%ebp
+  800e8b:	57                   	push   %edi
+  800e8c:	56                   	push   %esi
+  800e8d:	53                   	push   %ebx
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ea1:	89 df                	mov    %ebx,%edi
+  800ea3:	89 de                	mov    %ebx,%esi
+  800ea5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea7:	85 c0                	test   %eax,%eax
+  800ea9:	7f 08                	jg     800eb3 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800eab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eae:	5b                   	pop    %ebx
+  800eaf:	5e                   	pop    %esi
+  800eb0:	5f                   	pop    %edi
+  800eb1:	5d                   	pop    %ebp
+  800eb2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb3:	83 ec 0c             	sub    $0xc,%esp
+  800eb6:	50                   	push   %eax
+  800eb7:	6a 10                	push   $0x10
+  800eb9:	68 ff 2a 80 00       	push   $0x802aff
+  800ebe:	6a 23                	push   $0x23
+  800ec0:	68 1c 2b 80 00       	push   $0x802b1c
+  800ec5:	e8 72 f2 ff ff       	call   80013c <_panic>
+
+00800eca <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	56                   	push   %esi
+  800ecf:	53                   	push   %ebx
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ede:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ee3:	89 df                	mov    %ebx,%edi
+  800ee5:	89 de                	mov    %ebx,%esi
+  800ee7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee9:	85 c0                	test   %eax,%eax
+  800eeb:	7f 08                	jg     800ef5 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800eed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef0:	5b                   	pop    %ebx
+  800ef1:	5e                   	pop    %esi
+  800ef2:	5f                   	pop    %edi
+  800ef3:	5d                   	pop    %ebp
+  800ef4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef5:	83 ec 0c             	sub    $0xc,%esp
+  800ef8:	50                   	push   %eax
+  800ef9:	6a 11                	push   $0x11
+  800efb:	68 ff 2a 80 00       	push   $0x802aff
+  800f00:	6a 23                	push   $0x23
+  800f02:	68 1c 2b 80 00       	push   $0x802b1c
+  800f07:	e8 30 f2 ff ff       	call   80013c <_panic>
+
+00800f0c <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	57                   	push   %edi
+  800f10:	56                   	push   %esi
+  800f11:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f12:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f17:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f1c:	89 d1                	mov    %edx,%ecx
+  800f1e:	89 d3                	mov    %edx,%ebx
+  800f20:	89 d7                	mov    %edx,%edi
+  800f22:	89 d6                	mov    %edx,%esi
+  800f24:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+
+00800f2b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	56                   	push   %esi
+  800f30:	53                   	push   %ebx
+  800f31:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3f:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f44:	89 df                	mov    %ebx,%edi
+  800f46:	89 de                	mov    %ebx,%esi
+  800f48:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4a:	85 c0                	test   %eax,%eax
+  800f4c:	7f 08                	jg     800f56 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f51:	5b                   	pop    %ebx
+  800f52:	5e                   	pop    %esi
+  800f53:	5f                   	pop    %edi
+  800f54:	5d                   	pop    %ebp
+  800f55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f56:	83 ec 0c             	sub    $0xc,%esp
+  800f59:	50                   	push   %eax
+  800f5a:	6a 13                	push   $0x13
+  800f5c:	68 ff 2a 80 00       	push   $0x802aff
+  800f61:	6a 23                	push   $0x23
+  800f63:	68 1c 2b 80 00       	push   $0x802b1c
+  800f68:	e8 cf f1 ff ff       	call   80013c <_panic>
+
+00800f6d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f6d:	55                   	push   %ebp
+  800f6e:	89 e5                	mov    %esp,%ebp
+  800f70:	57                   	push   %edi
+  800f71:	56                   	push   %esi
+  800f72:	53                   	push   %ebx
+  800f73:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f81:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f86:	89 df                	mov    %ebx,%edi
+  800f88:	89 de                	mov    %ebx,%esi
+  800f8a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f8c:	85 c0                	test   %eax,%eax
+  800f8e:	7f 08                	jg     800f98 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f93:	5b                   	pop    %ebx
+  800f94:	5e                   	pop    %esi
+  800f95:	5f                   	pop    %edi
+  800f96:	5d                   	pop    %ebp
+  800f97:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f98:	83 ec 0c             	sub    $0xc,%esp
+  800f9b:	50                   	push   %eax
+  800f9c:	6a 14                	push   $0x14
+  800f9e:	68 ff 2a 80 00       	push   $0x802aff
+  800fa3:	6a 23                	push   $0x23
+  800fa5:	68 1c 2b 80 00       	push   $0x802b1c
+  800faa:	e8 8d f1 ff ff       	call   80013c <_panic>
+
+00800faf <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800faf:	55                   	push   %ebp
+  800fb0:	89 e5                	mov    %esp,%ebp
+  800fb2:	57                   	push   %edi
+  800fb3:	56                   	push   %esi
+  800fb4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbb:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fc0:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fcb:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fcd:	5b                   	pop    %ebx
+  800fce:	5e                   	pop    %esi
+  800fcf:	5f                   	pop    %edi
+  800fd0:	5d                   	pop    %ebp
+  800fd1:	c3                   	ret
+
+00800fd2 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+  800fd5:	57                   	push   %edi
+  800fd6:	56                   	push   %esi
+  800fd7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fde:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fe3:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800feb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fee:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5f                   	pop    %edi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+
+00800ff5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	57                   	push   %edi
+  800ff9:	56                   	push   %esi
+  800ffa:	53                   	push   %ebx
+  800ffb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ffe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801003:	8b 55 08             	mov    0x8(%ebp),%edx
+  801006:	b8 19 00 00 00       	mov    $0x19,%eax
+  80100b:	89 cb                	mov    %ecx,%ebx
+  80100d:	89 cf                	mov    %ecx,%edi
+  80100f:	89 ce                	mov    %ecx,%esi
+  801011:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801013:	85 c0                	test   %eax,%eax
+  801015:	7f 08                	jg     80101f <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801017:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101a:	5b                   	pop    %ebx
+  80101b:	5e                   	pop    %esi
+  80101c:	5f                   	pop    %edi
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101f:	83 ec 0c             	sub    $0xc,%esp
+  801022:	50                   	push   %eax
+  801023:	6a 19                	push   $0x19
+  801025:	68 ff 2a 80 00       	push   $0x802aff
+  80102a:	6a 23                	push   $0x23
+  80102c:	68 1c 2b 80 00       	push   $0x802b1c
+  801031:	e8 06 f1 ff ff       	call   80013c <_panic>
+
+00801036 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801036:	55                   	push   %ebp
+  801037:	89 e5                	mov    %esp,%ebp
+  801039:	57                   	push   %edi
+  80103a:	56                   	push   %esi
+  80103b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801041:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801046:	89 d1                	mov    %edx,%ecx
+  801048:	89 d3                	mov    %edx,%ebx
+  80104a:	89 d7                	mov    %edx,%edi
+  80104c:	89 d6                	mov    %edx,%esi
+  80104e:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801050:	5b                   	pop    %ebx
+  801051:	5e                   	pop    %esi
+  801052:	5f                   	pop    %edi
+  801053:	5d                   	pop    %ebp
+  801054:	c3                   	ret
+
+00801055 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801060:	8b 55 08             	mov    0x8(%ebp),%edx
+  801063:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801066:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80106b:	89 df                	mov    %ebx,%edi
+  80106d:	89 de                	mov    %ebx,%esi
+  80106f:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801071:	5b                   	pop    %ebx
+  801072:	5e                   	pop    %esi
+  801073:	5f                   	pop    %edi
+  801074:	5d                   	pop    %ebp
+  801075:	c3                   	ret
+
+00801076 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801076:	55                   	push   %ebp
+  801077:	89 e5                	mov    %esp,%ebp
+  801079:	57                   	push   %edi
+  80107a:	56                   	push   %esi
+  80107b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80107c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801081:	8b 55 08             	mov    0x8(%ebp),%edx
+  801084:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801087:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80108c:	89 df                	mov    %ebx,%edi
+  80108e:	89 de                	mov    %ebx,%esi
+  801090:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801092:	5b                   	pop    %ebx
+  801093:	5e                   	pop    %esi
+  801094:	5f                   	pop    %edi
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+
+00801097 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80109a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80109d:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010a2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8010a5:	5d                   	pop    %ebp
+  8010a6:	c3                   	ret
+
+008010a7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8010a7:	55                   	push   %ebp
+  8010a8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ad:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8010b2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8010b7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8010bc:	5d                   	pop    %ebp
+  8010bd:	c3                   	ret
+
+008010be <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8010be:	55                   	push   %ebp
+  8010bf:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8010c1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8010c6:	eb 02                	jmp    8010ca <fd_alloc+0xc>
+  8010c8:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8010ca:	89 c2                	mov    %eax,%edx
+  8010cc:	c1 ea 16             	shr    $0x16,%edx
+  8010cf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010d6:	f6 c2 01             	test   $0x1,%dl
+  8010d9:	74 2b                	je     801106 <fd_alloc+0x48>
+  8010db:	89 c2                	mov    %eax,%edx
+  8010dd:	c1 ea 0c             	shr    $0xc,%edx
+  8010e0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8010e7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010ed:	f6 c1 01             	test   $0x1,%cl
+  8010f0:	74 14                	je     801106 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8010f2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010f8:	75 ce                	jne    8010c8 <fd_alloc+0xa>
+  8010fa:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8010ff:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801104:	eb 05                	jmp    80110b <fd_alloc+0x4d>
+			return 0;
+  801106:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80110b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110e:	89 02                	mov    %eax,(%edx)
+}
+  801110:	89 c8                	mov    %ecx,%eax
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+
+00801114 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  801117:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80111a:	83 f8 1f             	cmp    $0x1f,%eax
+  80111d:	77 30                	ja     80114f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80111f:	c1 e0 0c             	shl    $0xc,%eax
+  801122:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801127:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80112d:	f6 c2 01             	test   $0x1,%dl
+  801130:	74 24                	je     801156 <fd_lookup+0x42>
+  801132:	89 c2                	mov    %eax,%edx
+  801134:	c1 ea 0c             	shr    $0xc,%edx
+  801137:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80113e:	f6 c2 01             	test   $0x1,%dl
+  801141:	74 1a                	je     80115d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801143:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801146:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801148:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80114d:	5d                   	pop    %ebp
+  80114e:	c3                   	ret
+		return -E_INVAL;
+  80114f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801154:	eb f7                	jmp    80114d <fd_lookup+0x39>
+		return -E_INVAL;
+  801156:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80115b:	eb f0                	jmp    80114d <fd_lookup+0x39>
+  80115d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801162:	eb e9                	jmp    80114d <fd_lookup+0x39>
+
+00801164 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	53                   	push   %ebx
+  801168:	83 ec 04             	sub    $0x4,%esp
+  80116b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80116e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801173:	eb 03                	jmp    801178 <dev_lookup+0x14>
+  801175:	83 c0 01             	add    $0x1,%eax
+  801178:	8b 1c 85 a8 2b 80 00 	mov    0x802ba8(,%eax,4),%ebx
+  80117f:	85 db                	test   %ebx,%ebx
+  801181:	74 0b                	je     80118e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801183:	39 13                	cmp    %edx,(%ebx)
+  801185:	75 ee                	jne    801175 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118c:	eb 1f                	jmp    8011ad <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80118e:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  801193:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801196:	83 ec 04             	sub    $0x4,%esp
+  801199:	52                   	push   %edx
+  80119a:	50                   	push   %eax
+  80119b:	68 2c 2b 80 00       	push   $0x802b2c
+  8011a0:	e8 72 f0 ff ff       	call   800217 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8011a5:	83 c4 10             	add    $0x10,%esp
+  8011a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8011ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011b0:	89 1a                	mov    %ebx,(%edx)
+}
+  8011b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011b5:	c9                   	leave
+  8011b6:	c3                   	ret
+
+008011b7 <fd_close>:
+{
+  8011b7:	55                   	push   %ebp
+  8011b8:	89 e5                	mov    %esp,%ebp
+  8011ba:	57                   	push   %edi
+  8011bb:	56                   	push   %esi
+  8011bc:	53                   	push   %ebx
+  8011bd:	83 ec 24             	sub    $0x24,%esp
+  8011c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011c3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011c6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011c9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011ca:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011d0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011d3:	50                   	push   %eax
+  8011d4:	e8 3b ff ff ff       	call   801114 <fd_lookup>
+  8011d9:	89 c3                	mov    %eax,%ebx
+  8011db:	83 c4 10             	add    $0x10,%esp
+  8011de:	85 c0                	test   %eax,%eax
+  8011e0:	78 05                	js     8011e7 <fd_close+0x30>
+	    || fd != fd2)
+  8011e2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011e5:	74 16                	je     8011fd <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8011e7:	89 f8                	mov    %edi,%eax
+  8011e9:	84 c0                	test   %al,%al
+  8011eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8011f3:	89 d8                	mov    %ebx,%eax
+  8011f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f8:	5b                   	pop    %ebx
+  8011f9:	5e                   	pop    %esi
+  8011fa:	5f                   	pop    %edi
+  8011fb:	5d                   	pop    %ebp
+  8011fc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8011fd:	83 ec 08             	sub    $0x8,%esp
+  801200:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801203:	50                   	push   %eax
+  801204:	ff 36                	push   (%esi)
+  801206:	e8 59 ff ff ff       	call   801164 <dev_lookup>
+  80120b:	89 c3                	mov    %eax,%ebx
+  80120d:	83 c4 10             	add    $0x10,%esp
+  801210:	85 c0                	test   %eax,%eax
+  801212:	78 1a                	js     80122e <fd_close+0x77>
+		if (dev->dev_close)
+  801214:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801217:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80121a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80121f:	85 c0                	test   %eax,%eax
+  801221:	74 0b                	je     80122e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801223:	83 ec 0c             	sub    $0xc,%esp
+  801226:	56                   	push   %esi
+  801227:	ff d0                	call   *%eax
+  801229:	89 c3                	mov    %eax,%ebx
+  80122b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80122e:	83 ec 08             	sub    $0x8,%esp
+  801231:	56                   	push   %esi
+  801232:	6a 00                	push   $0x0
+  801234:	e8 01 fb ff ff       	call   800d3a <sys_page_unmap>
+	return r;
+  801239:	83 c4 10             	add    $0x10,%esp
+  80123c:	eb b5                	jmp    8011f3 <fd_close+0x3c>
+
+0080123e <close>:
+
+int
+close(int fdnum)
+{
+  80123e:	55                   	push   %ebp
+  80123f:	89 e5                	mov    %esp,%ebp
+  801241:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801244:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801247:	50                   	push   %eax
+  801248:	ff 75 08             	push   0x8(%ebp)
+  80124b:	e8 c4 fe ff ff       	call   801114 <fd_lookup>
+  801250:	83 c4 10             	add    $0x10,%esp
+  801253:	85 c0                	test   %eax,%eax
+  801255:	79 02                	jns    801259 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801257:	c9                   	leave
+  801258:	c3                   	ret
+		return fd_close(fd, 1);
+  801259:	83 ec 08             	sub    $0x8,%esp
+  80125c:	6a 01                	push   $0x1
+  80125e:	ff 75 f4             	push   -0xc(%ebp)
+  801261:	e8 51 ff ff ff       	call   8011b7 <fd_close>
+  801266:	83 c4 10             	add    $0x10,%esp
+  801269:	eb ec                	jmp    801257 <close+0x19>
+
+0080126b <close_all>:
+
+void
+close_all(void)
+{
+  80126b:	55                   	push   %ebp
+  80126c:	89 e5                	mov    %esp,%ebp
+  80126e:	53                   	push   %ebx
+  80126f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801272:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801277:	83 ec 0c             	sub    $0xc,%esp
+  80127a:	53                   	push   %ebx
+  80127b:	e8 be ff ff ff       	call   80123e <close>
+	for (i = 0; i < MAXFD; i++)
+  801280:	83 c3 01             	add    $0x1,%ebx
+  801283:	83 c4 10             	add    $0x10,%esp
+  801286:	83 fb 20             	cmp    $0x20,%ebx
+  801289:	75 ec                	jne    801277 <close_all+0xc>
+}
+  80128b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80128e:	c9                   	leave
+  80128f:	c3                   	ret
+
+00801290 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801290:	55                   	push   %ebp
+  801291:	89 e5                	mov    %esp,%ebp
+  801293:	57                   	push   %edi
+  801294:	56                   	push   %esi
+  801295:	53                   	push   %ebx
+  801296:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801299:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80129c:	50                   	push   %eax
+  80129d:	ff 75 08             	push   0x8(%ebp)
+  8012a0:	e8 6f fe ff ff       	call   801114 <fd_lookup>
+  8012a5:	89 c3                	mov    %eax,%ebx
+  8012a7:	83 c4 10             	add    $0x10,%esp
+  8012aa:	85 c0                	test   %eax,%eax
+  8012ac:	78 7f                	js     80132d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8012ae:	83 ec 0c             	sub    $0xc,%esp
+  8012b1:	ff 75 0c             	push   0xc(%ebp)
+  8012b4:	e8 85 ff ff ff       	call   80123e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8012b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8012bc:	c1 e6 0c             	shl    $0xc,%esi
+  8012bf:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8012c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8012c8:	89 3c 24             	mov    %edi,(%esp)
+  8012cb:	e8 d7 fd ff ff       	call   8010a7 <fd2data>
+  8012d0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012d2:	89 34 24             	mov    %esi,(%esp)
+  8012d5:	e8 cd fd ff ff       	call   8010a7 <fd2data>
+  8012da:	83 c4 10             	add    $0x10,%esp
+  8012dd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012e0:	89 d8                	mov    %ebx,%eax
+  8012e2:	c1 e8 16             	shr    $0x16,%eax
+  8012e5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012ec:	a8 01                	test   $0x1,%al
+  8012ee:	74 11                	je     801301 <dup+0x71>
+  8012f0:	89 d8                	mov    %ebx,%eax
+  8012f2:	c1 e8 0c             	shr    $0xc,%eax
+  8012f5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012fc:	f6 c2 01             	test   $0x1,%dl
+  8012ff:	75 36                	jne    801337 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801301:	89 f8                	mov    %edi,%eax
+  801303:	c1 e8 0c             	shr    $0xc,%eax
+  801306:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80130d:	83 ec 0c             	sub    $0xc,%esp
+  801310:	25 07 0e 00 00       	and    $0xe07,%eax
+  801315:	50                   	push   %eax
+  801316:	56                   	push   %esi
+  801317:	6a 00                	push   $0x0
+  801319:	57                   	push   %edi
+  80131a:	6a 00                	push   $0x0
+  80131c:	e8 d7 f9 ff ff       	call   800cf8 <sys_page_map>
+  801321:	89 c3                	mov    %eax,%ebx
+  801323:	83 c4 20             	add    $0x20,%esp
+  801326:	85 c0                	test   %eax,%eax
+  801328:	78 33                	js     80135d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80132a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80132d:	89 d8                	mov    %ebx,%eax
+  80132f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801332:	5b                   	pop    %ebx
+  801333:	5e                   	pop    %esi
+  801334:	5f                   	pop    %edi
+  801335:	5d                   	pop    %ebp
+  801336:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801337:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80133e:	83 ec 0c             	sub    $0xc,%esp
+  801341:	25 07 0e 00 00       	and    $0xe07,%eax
+  801346:	50                   	push   %eax
+  801347:	ff 75 d4             	push   -0x2c(%ebp)
+  80134a:	6a 00                	push   $0x0
+  80134c:	53                   	push   %ebx
+  80134d:	6a 00                	push   $0x0
+  80134f:	e8 a4 f9 ff ff       	call   800cf8 <sys_page_map>
+  801354:	89 c3                	mov    %eax,%ebx
+  801356:	83 c4 20             	add    $0x20,%esp
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	79 a4                	jns    801301 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80135d:	83 ec 08             	sub    $0x8,%esp
+  801360:	56                   	push   %esi
+  801361:	6a 00                	push   $0x0
+  801363:	e8 d2 f9 ff ff       	call   800d3a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801368:	83 c4 08             	add    $0x8,%esp
+  80136b:	ff 75 d4             	push   -0x2c(%ebp)
+  80136e:	6a 00                	push   $0x0
+  801370:	e8 c5 f9 ff ff       	call   800d3a <sys_page_unmap>
+	return r;
+  801375:	83 c4 10             	add    $0x10,%esp
+  801378:	eb b3                	jmp    80132d <dup+0x9d>
+
+0080137a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	56                   	push   %esi
+  80137e:	53                   	push   %ebx
+  80137f:	83 ec 18             	sub    $0x18,%esp
+  801382:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801385:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801388:	50                   	push   %eax
+  801389:	56                   	push   %esi
+  80138a:	e8 85 fd ff ff       	call   801114 <fd_lookup>
+  80138f:	83 c4 10             	add    $0x10,%esp
+  801392:	85 c0                	test   %eax,%eax
+  801394:	78 3c                	js     8013d2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801396:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801399:	83 ec 08             	sub    $0x8,%esp
+  80139c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80139f:	50                   	push   %eax
+  8013a0:	ff 33                	push   (%ebx)
+  8013a2:	e8 bd fd ff ff       	call   801164 <dev_lookup>
+  8013a7:	83 c4 10             	add    $0x10,%esp
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	78 24                	js     8013d2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8013ae:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013b1:	83 e0 03             	and    $0x3,%eax
+  8013b4:	83 f8 01             	cmp    $0x1,%eax
+  8013b7:	74 20                	je     8013d9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8013b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013bc:	8b 40 08             	mov    0x8(%eax),%eax
+  8013bf:	85 c0                	test   %eax,%eax
+  8013c1:	74 37                	je     8013fa <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8013c3:	83 ec 04             	sub    $0x4,%esp
+  8013c6:	ff 75 10             	push   0x10(%ebp)
+  8013c9:	ff 75 0c             	push   0xc(%ebp)
+  8013cc:	53                   	push   %ebx
+  8013cd:	ff d0                	call   *%eax
+  8013cf:	83 c4 10             	add    $0x10,%esp
+}
+  8013d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d5:	5b                   	pop    %ebx
+  8013d6:	5e                   	pop    %esi
+  8013d7:	5d                   	pop    %ebp
+  8013d8:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013d9:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  8013de:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8013e1:	83 ec 04             	sub    $0x4,%esp
+  8013e4:	56                   	push   %esi
+  8013e5:	50                   	push   %eax
+  8013e6:	68 6d 2b 80 00       	push   $0x802b6d
+  8013eb:	e8 27 ee ff ff       	call   800217 <cprintf>
+		return -E_INVAL;
+  8013f0:	83 c4 10             	add    $0x10,%esp
+  8013f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013f8:	eb d8                	jmp    8013d2 <read+0x58>
+		return -E_NOT_SUPP;
+  8013fa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013ff:	eb d1                	jmp    8013d2 <read+0x58>
+
+00801401 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801401:	55                   	push   %ebp
+  801402:	89 e5                	mov    %esp,%ebp
+  801404:	57                   	push   %edi
+  801405:	56                   	push   %esi
+  801406:	53                   	push   %ebx
+  801407:	83 ec 0c             	sub    $0xc,%esp
+  80140a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80140d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801410:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801415:	eb 02                	jmp    801419 <readn+0x18>
+  801417:	01 c3                	add    %eax,%ebx
+  801419:	39 f3                	cmp    %esi,%ebx
+  80141b:	73 21                	jae    80143e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80141d:	83 ec 04             	sub    $0x4,%esp
+  801420:	89 f0                	mov    %esi,%eax
+  801422:	29 d8                	sub    %ebx,%eax
+  801424:	50                   	push   %eax
+  801425:	89 d8                	mov    %ebx,%eax
+  801427:	03 45 0c             	add    0xc(%ebp),%eax
+  80142a:	50                   	push   %eax
+  80142b:	57                   	push   %edi
+  80142c:	e8 49 ff ff ff       	call   80137a <read>
+		if (m < 0)
+  801431:	83 c4 10             	add    $0x10,%esp
+  801434:	85 c0                	test   %eax,%eax
+  801436:	78 04                	js     80143c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801438:	75 dd                	jne    801417 <readn+0x16>
+  80143a:	eb 02                	jmp    80143e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80143c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80143e:	89 d8                	mov    %ebx,%eax
+  801440:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801443:	5b                   	pop    %ebx
+  801444:	5e                   	pop    %esi
+  801445:	5f                   	pop    %edi
+  801446:	5d                   	pop    %ebp
+  801447:	c3                   	ret
+
+00801448 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	56                   	push   %esi
+  80144c:	53                   	push   %ebx
+  80144d:	83 ec 18             	sub    $0x18,%esp
+  801450:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801453:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801456:	50                   	push   %eax
+  801457:	53                   	push   %ebx
+  801458:	e8 b7 fc ff ff       	call   801114 <fd_lookup>
+  80145d:	83 c4 10             	add    $0x10,%esp
+  801460:	85 c0                	test   %eax,%eax
+  801462:	78 37                	js     80149b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801464:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801467:	83 ec 08             	sub    $0x8,%esp
+  80146a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80146d:	50                   	push   %eax
+  80146e:	ff 36                	push   (%esi)
+  801470:	e8 ef fc ff ff       	call   801164 <dev_lookup>
+  801475:	83 c4 10             	add    $0x10,%esp
+  801478:	85 c0                	test   %eax,%eax
+  80147a:	78 1f                	js     80149b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80147c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801480:	74 20                	je     8014a2 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801482:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801485:	8b 40 0c             	mov    0xc(%eax),%eax
+  801488:	85 c0                	test   %eax,%eax
+  80148a:	74 37                	je     8014c3 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80148c:	83 ec 04             	sub    $0x4,%esp
+  80148f:	ff 75 10             	push   0x10(%ebp)
+  801492:	ff 75 0c             	push   0xc(%ebp)
+  801495:	56                   	push   %esi
+  801496:	ff d0                	call   *%eax
+  801498:	83 c4 10             	add    $0x10,%esp
+}
+  80149b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80149e:	5b                   	pop    %ebx
+  80149f:	5e                   	pop    %esi
+  8014a0:	5d                   	pop    %ebp
+  8014a1:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014a2:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  8014a7:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8014aa:	83 ec 04             	sub    $0x4,%esp
+  8014ad:	53                   	push   %ebx
+  8014ae:	50                   	push   %eax
+  8014af:	68 89 2b 80 00       	push   $0x802b89
+  8014b4:	e8 5e ed ff ff       	call   800217 <cprintf>
+		return -E_INVAL;
+  8014b9:	83 c4 10             	add    $0x10,%esp
+  8014bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014c1:	eb d8                	jmp    80149b <write+0x53>
+		return -E_NOT_SUPP;
+  8014c3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014c8:	eb d1                	jmp    80149b <write+0x53>
+
+008014ca <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8014ca:	55                   	push   %ebp
+  8014cb:	89 e5                	mov    %esp,%ebp
+  8014cd:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d3:	50                   	push   %eax
+  8014d4:	ff 75 08             	push   0x8(%ebp)
+  8014d7:	e8 38 fc ff ff       	call   801114 <fd_lookup>
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	78 0e                	js     8014f1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8014e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014e9:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8014ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014f1:	c9                   	leave
+  8014f2:	c3                   	ret
+
+008014f3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8014f3:	55                   	push   %ebp
+  8014f4:	89 e5                	mov    %esp,%ebp
+  8014f6:	56                   	push   %esi
+  8014f7:	53                   	push   %ebx
+  8014f8:	83 ec 18             	sub    $0x18,%esp
+  8014fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014fe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801501:	50                   	push   %eax
+  801502:	53                   	push   %ebx
+  801503:	e8 0c fc ff ff       	call   801114 <fd_lookup>
+  801508:	83 c4 10             	add    $0x10,%esp
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	78 34                	js     801543 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80150f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801512:	83 ec 08             	sub    $0x8,%esp
+  801515:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801518:	50                   	push   %eax
+  801519:	ff 36                	push   (%esi)
+  80151b:	e8 44 fc ff ff       	call   801164 <dev_lookup>
+  801520:	83 c4 10             	add    $0x10,%esp
+  801523:	85 c0                	test   %eax,%eax
+  801525:	78 1c                	js     801543 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801527:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80152b:	74 1d                	je     80154a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80152d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801530:	8b 40 18             	mov    0x18(%eax),%eax
+  801533:	85 c0                	test   %eax,%eax
+  801535:	74 34                	je     80156b <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801537:	83 ec 08             	sub    $0x8,%esp
+  80153a:	ff 75 0c             	push   0xc(%ebp)
+  80153d:	56                   	push   %esi
+  80153e:	ff d0                	call   *%eax
+  801540:	83 c4 10             	add    $0x10,%esp
+}
+  801543:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801546:	5b                   	pop    %ebx
+  801547:	5e                   	pop    %esi
+  801548:	5d                   	pop    %ebp
+  801549:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80154a:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  80154f:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801552:	83 ec 04             	sub    $0x4,%esp
+  801555:	53                   	push   %ebx
+  801556:	50                   	push   %eax
+  801557:	68 4c 2b 80 00       	push   $0x802b4c
+  80155c:	e8 b6 ec ff ff       	call   800217 <cprintf>
+		return -E_INVAL;
+  801561:	83 c4 10             	add    $0x10,%esp
+  801564:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801569:	eb d8                	jmp    801543 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80156b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801570:	eb d1                	jmp    801543 <ftruncate+0x50>
+
+00801572 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801572:	55                   	push   %ebp
+  801573:	89 e5                	mov    %esp,%ebp
+  801575:	56                   	push   %esi
+  801576:	53                   	push   %ebx
+  801577:	83 ec 18             	sub    $0x18,%esp
+  80157a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80157d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801580:	50                   	push   %eax
+  801581:	ff 75 08             	push   0x8(%ebp)
+  801584:	e8 8b fb ff ff       	call   801114 <fd_lookup>
+  801589:	83 c4 10             	add    $0x10,%esp
+  80158c:	85 c0                	test   %eax,%eax
+  80158e:	78 49                	js     8015d9 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801590:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801593:	83 ec 08             	sub    $0x8,%esp
+  801596:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801599:	50                   	push   %eax
+  80159a:	ff 36                	push   (%esi)
+  80159c:	e8 c3 fb ff ff       	call   801164 <dev_lookup>
+  8015a1:	83 c4 10             	add    $0x10,%esp
+  8015a4:	85 c0                	test   %eax,%eax
+  8015a6:	78 31                	js     8015d9 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8015a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ab:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8015af:	74 2f                	je     8015e0 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8015b1:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8015b4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8015bb:	00 00 00 
+	stat->st_isdir = 0;
+  8015be:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8015c5:	00 00 00 
+	stat->st_dev = dev;
+  8015c8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8015ce:	83 ec 08             	sub    $0x8,%esp
+  8015d1:	53                   	push   %ebx
+  8015d2:	56                   	push   %esi
+  8015d3:	ff 50 14             	call   *0x14(%eax)
+  8015d6:	83 c4 10             	add    $0x10,%esp
+}
+  8015d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015dc:	5b                   	pop    %ebx
+  8015dd:	5e                   	pop    %esi
+  8015de:	5d                   	pop    %ebp
+  8015df:	c3                   	ret
+		return -E_NOT_SUPP;
+  8015e0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015e5:	eb f2                	jmp    8015d9 <fstat+0x67>
+
+008015e7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	56                   	push   %esi
+  8015eb:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8015ec:	83 ec 08             	sub    $0x8,%esp
+  8015ef:	6a 00                	push   $0x0
+  8015f1:	ff 75 08             	push   0x8(%ebp)
+  8015f4:	e8 e4 01 00 00       	call   8017dd <open>
+  8015f9:	89 c3                	mov    %eax,%ebx
+  8015fb:	83 c4 10             	add    $0x10,%esp
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	78 1b                	js     80161d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801602:	83 ec 08             	sub    $0x8,%esp
+  801605:	ff 75 0c             	push   0xc(%ebp)
+  801608:	50                   	push   %eax
+  801609:	e8 64 ff ff ff       	call   801572 <fstat>
+  80160e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801610:	89 1c 24             	mov    %ebx,(%esp)
+  801613:	e8 26 fc ff ff       	call   80123e <close>
+	return r;
+  801618:	83 c4 10             	add    $0x10,%esp
+  80161b:	89 f3                	mov    %esi,%ebx
+}
+  80161d:	89 d8                	mov    %ebx,%eax
+  80161f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801622:	5b                   	pop    %ebx
+  801623:	5e                   	pop    %esi
+  801624:	5d                   	pop    %ebp
+  801625:	c3                   	ret
+
+00801626 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801626:	55                   	push   %ebp
+  801627:	89 e5                	mov    %esp,%ebp
+  801629:	56                   	push   %esi
+  80162a:	53                   	push   %ebx
+  80162b:	89 c6                	mov    %eax,%esi
+  80162d:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80162f:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801636:	74 27                	je     80165f <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801638:	6a 07                	push   $0x7
+  80163a:	68 00 50 c0 00       	push   $0xc05000
+  80163f:	56                   	push   %esi
+  801640:	ff 35 00 40 80 00    	push   0x804000
+  801646:	e8 d5 0b 00 00       	call   802220 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80164b:	83 c4 0c             	add    $0xc,%esp
+  80164e:	6a 00                	push   $0x0
+  801650:	53                   	push   %ebx
+  801651:	6a 00                	push   $0x0
+  801653:	e8 50 0b 00 00       	call   8021a8 <ipc_recv>
+}
+  801658:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80165b:	5b                   	pop    %ebx
+  80165c:	5e                   	pop    %esi
+  80165d:	5d                   	pop    %ebp
+  80165e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80165f:	83 ec 0c             	sub    $0xc,%esp
+  801662:	6a 01                	push   $0x1
+  801664:	e8 0b 0c 00 00       	call   802274 <ipc_find_env>
+  801669:	a3 00 40 80 00       	mov    %eax,0x804000
+  80166e:	83 c4 10             	add    $0x10,%esp
+  801671:	eb c5                	jmp    801638 <fsipc+0x12>
+
+00801673 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801673:	55                   	push   %ebp
+  801674:	89 e5                	mov    %esp,%ebp
+  801676:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801679:	8b 45 08             	mov    0x8(%ebp),%eax
+  80167c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80167f:	a3 00 50 c0 00       	mov    %eax,0xc05000
+	fsipcbuf.set_size.req_size = newsize;
+  801684:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801687:	a3 04 50 c0 00       	mov    %eax,0xc05004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80168c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801691:	b8 02 00 00 00       	mov    $0x2,%eax
+  801696:	e8 8b ff ff ff       	call   801626 <fsipc>
+}
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+
+0080169d <devfile_flush>:
+{
+  80169d:	55                   	push   %ebp
+  80169e:	89 e5                	mov    %esp,%ebp
+  8016a0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8016a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016a6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016a9:	a3 00 50 c0 00       	mov    %eax,0xc05000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8016ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8016b8:	e8 69 ff ff ff       	call   801626 <fsipc>
+}
+  8016bd:	c9                   	leave
+  8016be:	c3                   	ret
+
+008016bf <devfile_stat>:
+{
+  8016bf:	55                   	push   %ebp
+  8016c0:	89 e5                	mov    %esp,%ebp
+  8016c2:	53                   	push   %ebx
+  8016c3:	83 ec 04             	sub    $0x4,%esp
+  8016c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8016c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016cc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016cf:	a3 00 50 c0 00       	mov    %eax,0xc05000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8016d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8016de:	e8 43 ff ff ff       	call   801626 <fsipc>
+  8016e3:	85 c0                	test   %eax,%eax
+  8016e5:	78 2c                	js     801713 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8016e7:	83 ec 08             	sub    $0x8,%esp
+  8016ea:	68 00 50 c0 00       	push   $0xc05000
+  8016ef:	53                   	push   %ebx
+  8016f0:	e8 10 f1 ff ff       	call   800805 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8016f5:	a1 80 50 c0 00       	mov    0xc05080,%eax
+  8016fa:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801700:	a1 84 50 c0 00       	mov    0xc05084,%eax
+  801705:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80170b:	83 c4 10             	add    $0x10,%esp
+  80170e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801713:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801716:	c9                   	leave
+  801717:	c3                   	ret
+
+00801718 <devfile_write>:
+{
+  801718:	55                   	push   %ebp
+  801719:	89 e5                	mov    %esp,%ebp
+  80171b:	83 ec 0c             	sub    $0xc,%esp
+  80171e:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801721:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801726:	39 d0                	cmp    %edx,%eax
+  801728:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80172b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172e:	8b 52 0c             	mov    0xc(%edx),%edx
+  801731:	89 15 00 50 c0 00    	mov    %edx,0xc05000
+	fsipcbuf.write.req_n = n;
+  801737:	a3 04 50 c0 00       	mov    %eax,0xc05004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80173c:	50                   	push   %eax
+  80173d:	ff 75 0c             	push   0xc(%ebp)
+  801740:	68 08 50 c0 00       	push   $0xc05008
+  801745:	e8 41 f2 ff ff       	call   80098b <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80174a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801754:	e8 cd fe ff ff       	call   801626 <fsipc>
+}
+  801759:	c9                   	leave
+  80175a:	c3                   	ret
+
+0080175b <devfile_read>:
+{
+  80175b:	55                   	push   %ebp
+  80175c:	89 e5                	mov    %esp,%ebp
+  80175e:	56                   	push   %esi
+  80175f:	53                   	push   %ebx
+  801760:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801763:	8b 45 08             	mov    0x8(%ebp),%eax
+  801766:	8b 40 0c             	mov    0xc(%eax),%eax
+  801769:	a3 00 50 c0 00       	mov    %eax,0xc05000
+	fsipcbuf.read.req_n = n;
+  80176e:	89 35 04 50 c0 00    	mov    %esi,0xc05004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801774:	ba 00 00 00 00       	mov    $0x0,%edx
+  801779:	b8 03 00 00 00       	mov    $0x3,%eax
+  80177e:	e8 a3 fe ff ff       	call   801626 <fsipc>
+  801783:	89 c3                	mov    %eax,%ebx
+  801785:	85 c0                	test   %eax,%eax
+  801787:	78 1f                	js     8017a8 <devfile_read+0x4d>
+	assert(r <= n);
+  801789:	39 c6                	cmp    %eax,%esi
+  80178b:	72 24                	jb     8017b1 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80178d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801792:	7f 33                	jg     8017c7 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801794:	83 ec 04             	sub    $0x4,%esp
+  801797:	50                   	push   %eax
+  801798:	68 00 50 c0 00       	push   $0xc05000
+  80179d:	ff 75 0c             	push   0xc(%ebp)
+  8017a0:	e8 e6 f1 ff ff       	call   80098b <memmove>
+	return r;
+  8017a5:	83 c4 10             	add    $0x10,%esp
+}
+  8017a8:	89 d8                	mov    %ebx,%eax
+  8017aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ad:	5b                   	pop    %ebx
+  8017ae:	5e                   	pop    %esi
+  8017af:	5d                   	pop    %ebp
+  8017b0:	c3                   	ret
+	assert(r <= n);
+  8017b1:	68 bc 2b 80 00       	push   $0x802bbc
+  8017b6:	68 c3 2b 80 00       	push   $0x802bc3
+  8017bb:	6a 7c                	push   $0x7c
+  8017bd:	68 d8 2b 80 00       	push   $0x802bd8
+  8017c2:	e8 75 e9 ff ff       	call   80013c <_panic>
+	assert(r <= PGSIZE);
+  8017c7:	68 e3 2b 80 00       	push   $0x802be3
+  8017cc:	68 c3 2b 80 00       	push   $0x802bc3
+  8017d1:	6a 7d                	push   $0x7d
+  8017d3:	68 d8 2b 80 00       	push   $0x802bd8
+  8017d8:	e8 5f e9 ff ff       	call   80013c <_panic>
+
+008017dd <open>:
+{
+  8017dd:	55                   	push   %ebp
+  8017de:	89 e5                	mov    %esp,%ebp
+  8017e0:	56                   	push   %esi
+  8017e1:	53                   	push   %ebx
+  8017e2:	83 ec 1c             	sub    $0x1c,%esp
+  8017e5:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8017e8:	56                   	push   %esi
+  8017e9:	e8 dc ef ff ff       	call   8007ca <strlen>
+  8017ee:	83 c4 10             	add    $0x10,%esp
+  8017f1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8017f6:	7f 6c                	jg     801864 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8017f8:	83 ec 0c             	sub    $0xc,%esp
+  8017fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017fe:	50                   	push   %eax
+  8017ff:	e8 ba f8 ff ff       	call   8010be <fd_alloc>
+  801804:	89 c3                	mov    %eax,%ebx
+  801806:	83 c4 10             	add    $0x10,%esp
+  801809:	85 c0                	test   %eax,%eax
+  80180b:	78 3c                	js     801849 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80180d:	83 ec 08             	sub    $0x8,%esp
+  801810:	56                   	push   %esi
+  801811:	68 00 50 c0 00       	push   $0xc05000
+  801816:	e8 ea ef ff ff       	call   800805 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80181b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80181e:	a3 00 54 c0 00       	mov    %eax,0xc05400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801823:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801826:	b8 01 00 00 00       	mov    $0x1,%eax
+  80182b:	e8 f6 fd ff ff       	call   801626 <fsipc>
+  801830:	89 c3                	mov    %eax,%ebx
+  801832:	83 c4 10             	add    $0x10,%esp
+  801835:	85 c0                	test   %eax,%eax
+  801837:	78 19                	js     801852 <open+0x75>
+	return fd2num(fd);
+  801839:	83 ec 0c             	sub    $0xc,%esp
+  80183c:	ff 75 f4             	push   -0xc(%ebp)
+  80183f:	e8 53 f8 ff ff       	call   801097 <fd2num>
+  801844:	89 c3                	mov    %eax,%ebx
+  801846:	83 c4 10             	add    $0x10,%esp
+}
+  801849:	89 d8                	mov    %ebx,%eax
+  80184b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80184e:	5b                   	pop    %ebx
+  80184f:	5e                   	pop    %esi
+  801850:	5d                   	pop    %ebp
+  801851:	c3                   	ret
+		fd_close(fd, 0);
+  801852:	83 ec 08             	sub    $0x8,%esp
+  801855:	6a 00                	push   $0x0
+  801857:	ff 75 f4             	push   -0xc(%ebp)
+  80185a:	e8 58 f9 ff ff       	call   8011b7 <fd_close>
+		return r;
+  80185f:	83 c4 10             	add    $0x10,%esp
+  801862:	eb e5                	jmp    801849 <open+0x6c>
+		return -E_BAD_PATH;
+  801864:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801869:	eb de                	jmp    801849 <open+0x6c>
+
+0080186b <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80186b:	55                   	push   %ebp
+  80186c:	89 e5                	mov    %esp,%ebp
+  80186e:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801871:	ba 00 00 00 00       	mov    $0x0,%edx
+  801876:	b8 08 00 00 00       	mov    $0x8,%eax
+  80187b:	e8 a6 fd ff ff       	call   801626 <fsipc>
+}
+  801880:	c9                   	leave
+  801881:	c3                   	ret
+
+00801882 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801882:	55                   	push   %ebp
+  801883:	89 e5                	mov    %esp,%ebp
+  801885:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801888:	68 ef 2b 80 00       	push   $0x802bef
+  80188d:	ff 75 0c             	push   0xc(%ebp)
+  801890:	e8 70 ef ff ff       	call   800805 <strcpy>
+	return 0;
+}
+  801895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189a:	c9                   	leave
+  80189b:	c3                   	ret
+
+0080189c <devsock_close>:
+{
+  80189c:	55                   	push   %ebp
+  80189d:	89 e5                	mov    %esp,%ebp
+  80189f:	53                   	push   %ebx
+  8018a0:	83 ec 10             	sub    $0x10,%esp
+  8018a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8018a6:	53                   	push   %ebx
+  8018a7:	e8 d8 09 00 00       	call   802284 <pageref>
+  8018ac:	89 c2                	mov    %eax,%edx
+  8018ae:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8018b1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8018b6:	83 fa 01             	cmp    $0x1,%edx
+  8018b9:	74 05                	je     8018c0 <devsock_close+0x24>
+}
+  8018bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018be:	c9                   	leave
+  8018bf:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8018c0:	83 ec 0c             	sub    $0xc,%esp
+  8018c3:	ff 73 0c             	push   0xc(%ebx)
+  8018c6:	e8 b7 02 00 00       	call   801b82 <nsipc_close>
+  8018cb:	83 c4 10             	add    $0x10,%esp
+  8018ce:	eb eb                	jmp    8018bb <devsock_close+0x1f>
+
+008018d0 <devsock_write>:
+{
+  8018d0:	55                   	push   %ebp
+  8018d1:	89 e5                	mov    %esp,%ebp
+  8018d3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8018d6:	6a 00                	push   $0x0
+  8018d8:	ff 75 10             	push   0x10(%ebp)
+  8018db:	ff 75 0c             	push   0xc(%ebp)
+  8018de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e1:	ff 70 0c             	push   0xc(%eax)
+  8018e4:	e8 79 03 00 00       	call   801c62 <nsipc_send>
+}
+  8018e9:	c9                   	leave
+  8018ea:	c3                   	ret
+
+008018eb <devsock_read>:
+{
+  8018eb:	55                   	push   %ebp
+  8018ec:	89 e5                	mov    %esp,%ebp
+  8018ee:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8018f1:	6a 00                	push   $0x0
+  8018f3:	ff 75 10             	push   0x10(%ebp)
+  8018f6:	ff 75 0c             	push   0xc(%ebp)
+  8018f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018fc:	ff 70 0c             	push   0xc(%eax)
+  8018ff:	e8 ef 02 00 00       	call   801bf3 <nsipc_recv>
+}
+  801904:	c9                   	leave
+  801905:	c3                   	ret
+
+00801906 <fd2sockid>:
+{
+  801906:	55                   	push   %ebp
+  801907:	89 e5                	mov    %esp,%ebp
+  801909:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80190c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80190f:	52                   	push   %edx
+  801910:	50                   	push   %eax
+  801911:	e8 fe f7 ff ff       	call   801114 <fd_lookup>
+  801916:	83 c4 10             	add    $0x10,%esp
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	78 10                	js     80192d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80191d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801920:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801926:	39 08                	cmp    %ecx,(%eax)
+  801928:	75 05                	jne    80192f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80192a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80192d:	c9                   	leave
+  80192e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80192f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801934:	eb f7                	jmp    80192d <fd2sockid+0x27>
+
+00801936 <alloc_sockfd>:
+{
+  801936:	55                   	push   %ebp
+  801937:	89 e5                	mov    %esp,%ebp
+  801939:	56                   	push   %esi
+  80193a:	53                   	push   %ebx
+  80193b:	83 ec 1c             	sub    $0x1c,%esp
+  80193e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801940:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801943:	50                   	push   %eax
+  801944:	e8 75 f7 ff ff       	call   8010be <fd_alloc>
+  801949:	89 c3                	mov    %eax,%ebx
+  80194b:	83 c4 10             	add    $0x10,%esp
+  80194e:	85 c0                	test   %eax,%eax
+  801950:	78 43                	js     801995 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801952:	83 ec 04             	sub    $0x4,%esp
+  801955:	68 07 04 00 00       	push   $0x407
+  80195a:	ff 75 f4             	push   -0xc(%ebp)
+  80195d:	6a 00                	push   $0x0
+  80195f:	e8 0e f3 ff ff       	call   800c72 <sys_page_alloc>
+  801964:	89 c3                	mov    %eax,%ebx
+  801966:	83 c4 10             	add    $0x10,%esp
+  801969:	85 c0                	test   %eax,%eax
+  80196b:	78 28                	js     801995 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80196d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801970:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801976:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801978:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80197b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801982:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801985:	83 ec 0c             	sub    $0xc,%esp
+  801988:	50                   	push   %eax
+  801989:	e8 09 f7 ff ff       	call   801097 <fd2num>
+  80198e:	89 c3                	mov    %eax,%ebx
+  801990:	83 c4 10             	add    $0x10,%esp
+  801993:	eb 0c                	jmp    8019a1 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801995:	83 ec 0c             	sub    $0xc,%esp
+  801998:	56                   	push   %esi
+  801999:	e8 e4 01 00 00       	call   801b82 <nsipc_close>
+		return r;
+  80199e:	83 c4 10             	add    $0x10,%esp
+}
+  8019a1:	89 d8                	mov    %ebx,%eax
+  8019a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a6:	5b                   	pop    %ebx
+  8019a7:	5e                   	pop    %esi
+  8019a8:	5d                   	pop    %ebp
+  8019a9:	c3                   	ret
+
+008019aa <accept>:
+{
+  8019aa:	55                   	push   %ebp
+  8019ab:	89 e5                	mov    %esp,%ebp
+  8019ad:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b3:	e8 4e ff ff ff       	call   801906 <fd2sockid>
+  8019b8:	85 c0                	test   %eax,%eax
+  8019ba:	78 1b                	js     8019d7 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8019bc:	83 ec 04             	sub    $0x4,%esp
+  8019bf:	ff 75 10             	push   0x10(%ebp)
+  8019c2:	ff 75 0c             	push   0xc(%ebp)
+  8019c5:	50                   	push   %eax
+  8019c6:	e8 0e 01 00 00       	call   801ad9 <nsipc_accept>
+  8019cb:	83 c4 10             	add    $0x10,%esp
+  8019ce:	85 c0                	test   %eax,%eax
+  8019d0:	78 05                	js     8019d7 <accept+0x2d>
+	return alloc_sockfd(r);
+  8019d2:	e8 5f ff ff ff       	call   801936 <alloc_sockfd>
+}
+  8019d7:	c9                   	leave
+  8019d8:	c3                   	ret
+
+008019d9 <bind>:
+{
+  8019d9:	55                   	push   %ebp
+  8019da:	89 e5                	mov    %esp,%ebp
+  8019dc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e2:	e8 1f ff ff ff       	call   801906 <fd2sockid>
+  8019e7:	85 c0                	test   %eax,%eax
+  8019e9:	78 12                	js     8019fd <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8019eb:	83 ec 04             	sub    $0x4,%esp
+  8019ee:	ff 75 10             	push   0x10(%ebp)
+  8019f1:	ff 75 0c             	push   0xc(%ebp)
+  8019f4:	50                   	push   %eax
+  8019f5:	e8 31 01 00 00       	call   801b2b <nsipc_bind>
+  8019fa:	83 c4 10             	add    $0x10,%esp
+}
+  8019fd:	c9                   	leave
+  8019fe:	c3                   	ret
+
+008019ff <shutdown>:
+{
+  8019ff:	55                   	push   %ebp
+  801a00:	89 e5                	mov    %esp,%ebp
+  801a02:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a08:	e8 f9 fe ff ff       	call   801906 <fd2sockid>
+  801a0d:	85 c0                	test   %eax,%eax
+  801a0f:	78 0f                	js     801a20 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801a11:	83 ec 08             	sub    $0x8,%esp
+  801a14:	ff 75 0c             	push   0xc(%ebp)
+  801a17:	50                   	push   %eax
+  801a18:	e8 43 01 00 00       	call   801b60 <nsipc_shutdown>
+  801a1d:	83 c4 10             	add    $0x10,%esp
+}
+  801a20:	c9                   	leave
+  801a21:	c3                   	ret
+
+00801a22 <connect>:
+{
+  801a22:	55                   	push   %ebp
+  801a23:	89 e5                	mov    %esp,%ebp
+  801a25:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a28:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a2b:	e8 d6 fe ff ff       	call   801906 <fd2sockid>
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	78 12                	js     801a46 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801a34:	83 ec 04             	sub    $0x4,%esp
+  801a37:	ff 75 10             	push   0x10(%ebp)
+  801a3a:	ff 75 0c             	push   0xc(%ebp)
+  801a3d:	50                   	push   %eax
+  801a3e:	e8 59 01 00 00       	call   801b9c <nsipc_connect>
+  801a43:	83 c4 10             	add    $0x10,%esp
+}
+  801a46:	c9                   	leave
+  801a47:	c3                   	ret
+
+00801a48 <listen>:
+{
+  801a48:	55                   	push   %ebp
+  801a49:	89 e5                	mov    %esp,%ebp
+  801a4b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a51:	e8 b0 fe ff ff       	call   801906 <fd2sockid>
+  801a56:	85 c0                	test   %eax,%eax
+  801a58:	78 0f                	js     801a69 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801a5a:	83 ec 08             	sub    $0x8,%esp
+  801a5d:	ff 75 0c             	push   0xc(%ebp)
+  801a60:	50                   	push   %eax
+  801a61:	e8 6b 01 00 00       	call   801bd1 <nsipc_listen>
+  801a66:	83 c4 10             	add    $0x10,%esp
+}
+  801a69:	c9                   	leave
+  801a6a:	c3                   	ret
+
+00801a6b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801a71:	ff 75 10             	push   0x10(%ebp)
+  801a74:	ff 75 0c             	push   0xc(%ebp)
+  801a77:	ff 75 08             	push   0x8(%ebp)
+  801a7a:	e8 41 02 00 00       	call   801cc0 <nsipc_socket>
+  801a7f:	83 c4 10             	add    $0x10,%esp
+  801a82:	85 c0                	test   %eax,%eax
+  801a84:	78 05                	js     801a8b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801a86:	e8 ab fe ff ff       	call   801936 <alloc_sockfd>
+}
+  801a8b:	c9                   	leave
+  801a8c:	c3                   	ret
+
+00801a8d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801a8d:	55                   	push   %ebp
+  801a8e:	89 e5                	mov    %esp,%ebp
+  801a90:	53                   	push   %ebx
+  801a91:	83 ec 04             	sub    $0x4,%esp
+  801a94:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801a96:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a9d:	74 26                	je     801ac5 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801a9f:	6a 07                	push   $0x7
+  801aa1:	68 00 60 c0 00       	push   $0xc06000
+  801aa6:	53                   	push   %ebx
+  801aa7:	ff 35 04 40 80 00    	push   0x804004
+  801aad:	e8 6e 07 00 00       	call   802220 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801ab2:	83 c4 0c             	add    $0xc,%esp
+  801ab5:	6a 00                	push   $0x0
+  801ab7:	6a 00                	push   $0x0
+  801ab9:	6a 00                	push   $0x0
+  801abb:	e8 e8 06 00 00       	call   8021a8 <ipc_recv>
+}
+  801ac0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac3:	c9                   	leave
+  801ac4:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ac5:	83 ec 0c             	sub    $0xc,%esp
+  801ac8:	6a 02                	push   $0x2
+  801aca:	e8 a5 07 00 00       	call   802274 <ipc_find_env>
+  801acf:	a3 04 40 80 00       	mov    %eax,0x804004
+  801ad4:	83 c4 10             	add    $0x10,%esp
+  801ad7:	eb c6                	jmp    801a9f <nsipc+0x12>
+
+00801ad9 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ad9:	55                   	push   %ebp
+  801ada:	89 e5                	mov    %esp,%ebp
+  801adc:	56                   	push   %esi
+  801add:	53                   	push   %ebx
+  801ade:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ae1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae4:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ae9:	8b 06                	mov    (%esi),%eax
+  801aeb:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801af0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801af5:	e8 93 ff ff ff       	call   801a8d <nsipc>
+  801afa:	89 c3                	mov    %eax,%ebx
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	79 09                	jns    801b09 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801b00:	89 d8                	mov    %ebx,%eax
+  801b02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b05:	5b                   	pop    %ebx
+  801b06:	5e                   	pop    %esi
+  801b07:	5d                   	pop    %ebp
+  801b08:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801b09:	83 ec 04             	sub    $0x4,%esp
+  801b0c:	ff 35 10 60 c0 00    	push   0xc06010
+  801b12:	68 00 60 c0 00       	push   $0xc06000
+  801b17:	ff 75 0c             	push   0xc(%ebp)
+  801b1a:	e8 6c ee ff ff       	call   80098b <memmove>
+		*addrlen = ret->ret_addrlen;
+  801b1f:	a1 10 60 c0 00       	mov    0xc06010,%eax
+  801b24:	89 06                	mov    %eax,(%esi)
+  801b26:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801b29:	eb d5                	jmp    801b00 <nsipc_accept+0x27>
+
+00801b2b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801b2b:	55                   	push   %ebp
+  801b2c:	89 e5                	mov    %esp,%ebp
+  801b2e:	53                   	push   %ebx
+  801b2f:	83 ec 08             	sub    $0x8,%esp
+  801b32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b38:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801b3d:	53                   	push   %ebx
+  801b3e:	ff 75 0c             	push   0xc(%ebp)
+  801b41:	68 04 60 c0 00       	push   $0xc06004
+  801b46:	e8 40 ee ff ff       	call   80098b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801b4b:	89 1d 14 60 c0 00    	mov    %ebx,0xc06014
+	return nsipc(NSREQ_BIND);
+  801b51:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b56:	e8 32 ff ff ff       	call   801a8d <nsipc>
+}
+  801b5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b5e:	c9                   	leave
+  801b5f:	c3                   	ret
+
+00801b60 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801b60:	55                   	push   %ebp
+  801b61:	89 e5                	mov    %esp,%ebp
+  801b63:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b69:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	nsipcbuf.shutdown.req_how = how;
+  801b6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b71:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	return nsipc(NSREQ_SHUTDOWN);
+  801b76:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b7b:	e8 0d ff ff ff       	call   801a8d <nsipc>
+}
+  801b80:	c9                   	leave
+  801b81:	c3                   	ret
+
+00801b82 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801b82:	55                   	push   %ebp
+  801b83:	89 e5                	mov    %esp,%ebp
+  801b85:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801b88:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b8b:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	return nsipc(NSREQ_CLOSE);
+  801b90:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b95:	e8 f3 fe ff ff       	call   801a8d <nsipc>
+}
+  801b9a:	c9                   	leave
+  801b9b:	c3                   	ret
+
+00801b9c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801b9c:	55                   	push   %ebp
+  801b9d:	89 e5                	mov    %esp,%ebp
+  801b9f:	53                   	push   %ebx
+  801ba0:	83 ec 08             	sub    $0x8,%esp
+  801ba3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801ba6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba9:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801bae:	53                   	push   %ebx
+  801baf:	ff 75 0c             	push   0xc(%ebp)
+  801bb2:	68 04 60 c0 00       	push   $0xc06004
+  801bb7:	e8 cf ed ff ff       	call   80098b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801bbc:	89 1d 14 60 c0 00    	mov    %ebx,0xc06014
+	return nsipc(NSREQ_CONNECT);
+  801bc2:	b8 05 00 00 00       	mov    $0x5,%eax
+  801bc7:	e8 c1 fe ff ff       	call   801a8d <nsipc>
+}
+  801bcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bcf:	c9                   	leave
+  801bd0:	c3                   	ret
+
+00801bd1 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801bd1:	55                   	push   %ebp
+  801bd2:	89 e5                	mov    %esp,%ebp
+  801bd4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801bd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bda:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	nsipcbuf.listen.req_backlog = backlog;
+  801bdf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801be2:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	return nsipc(NSREQ_LISTEN);
+  801be7:	b8 06 00 00 00       	mov    $0x6,%eax
+  801bec:	e8 9c fe ff ff       	call   801a8d <nsipc>
+}
+  801bf1:	c9                   	leave
+  801bf2:	c3                   	ret
+
+00801bf3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801bf3:	55                   	push   %ebp
+  801bf4:	89 e5                	mov    %esp,%ebp
+  801bf6:	56                   	push   %esi
+  801bf7:	53                   	push   %ebx
+  801bf8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801bfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bfe:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	nsipcbuf.recv.req_len = len;
+  801c03:	89 35 04 60 c0 00    	mov    %esi,0xc06004
+	nsipcbuf.recv.req_flags = flags;
+  801c09:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c0c:	a3 08 60 c0 00       	mov    %eax,0xc06008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801c11:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c16:	e8 72 fe ff ff       	call   801a8d <nsipc>
+  801c1b:	89 c3                	mov    %eax,%ebx
+  801c1d:	85 c0                	test   %eax,%eax
+  801c1f:	78 22                	js     801c43 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801c21:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801c26:	39 c6                	cmp    %eax,%esi
+  801c28:	0f 4e c6             	cmovle %esi,%eax
+  801c2b:	39 c3                	cmp    %eax,%ebx
+  801c2d:	7f 1d                	jg     801c4c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801c2f:	83 ec 04             	sub    $0x4,%esp
+  801c32:	53                   	push   %ebx
+  801c33:	68 00 60 c0 00       	push   $0xc06000
+  801c38:	ff 75 0c             	push   0xc(%ebp)
+  801c3b:	e8 4b ed ff ff       	call   80098b <memmove>
+  801c40:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801c43:	89 d8                	mov    %ebx,%eax
+  801c45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c48:	5b                   	pop    %ebx
+  801c49:	5e                   	pop    %esi
+  801c4a:	5d                   	pop    %ebp
+  801c4b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801c4c:	68 fb 2b 80 00       	push   $0x802bfb
+  801c51:	68 c3 2b 80 00       	push   $0x802bc3
+  801c56:	6a 62                	push   $0x62
+  801c58:	68 10 2c 80 00       	push   $0x802c10
+  801c5d:	e8 da e4 ff ff       	call   80013c <_panic>
+
+00801c62 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801c62:	55                   	push   %ebp
+  801c63:	89 e5                	mov    %esp,%ebp
+  801c65:	53                   	push   %ebx
+  801c66:	83 ec 04             	sub    $0x4,%esp
+  801c69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801c6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c6f:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	assert(size < 1600);
+  801c74:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801c7a:	7f 2e                	jg     801caa <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801c7c:	83 ec 04             	sub    $0x4,%esp
+  801c7f:	53                   	push   %ebx
+  801c80:	ff 75 0c             	push   0xc(%ebp)
+  801c83:	68 0c 60 c0 00       	push   $0xc0600c
+  801c88:	e8 fe ec ff ff       	call   80098b <memmove>
+	nsipcbuf.send.req_size = size;
+  801c8d:	89 1d 04 60 c0 00    	mov    %ebx,0xc06004
+	nsipcbuf.send.req_flags = flags;
+  801c93:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c96:	a3 08 60 c0 00       	mov    %eax,0xc06008
+	return nsipc(NSREQ_SEND);
+  801c9b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ca0:	e8 e8 fd ff ff       	call   801a8d <nsipc>
+}
+  801ca5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca8:	c9                   	leave
+  801ca9:	c3                   	ret
+	assert(size < 1600);
+  801caa:	68 1c 2c 80 00       	push   $0x802c1c
+  801caf:	68 c3 2b 80 00       	push   $0x802bc3
+  801cb4:	6a 6d                	push   $0x6d
+  801cb6:	68 10 2c 80 00       	push   $0x802c10
+  801cbb:	e8 7c e4 ff ff       	call   80013c <_panic>
+
+00801cc0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801cc0:	55                   	push   %ebp
+  801cc1:	89 e5                	mov    %esp,%ebp
+  801cc3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cc9:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	nsipcbuf.socket.req_type = type;
+  801cce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cd1:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	nsipcbuf.socket.req_protocol = protocol;
+  801cd6:	8b 45 10             	mov    0x10(%ebp),%eax
+  801cd9:	a3 08 60 c0 00       	mov    %eax,0xc06008
+	return nsipc(NSREQ_SOCKET);
+  801cde:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ce3:	e8 a5 fd ff ff       	call   801a8d <nsipc>
+}
+  801ce8:	c9                   	leave
+  801ce9:	c3                   	ret
+
+00801cea <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cea:	55                   	push   %ebp
+  801ceb:	89 e5                	mov    %esp,%ebp
+  801ced:	56                   	push   %esi
+  801cee:	53                   	push   %ebx
+  801cef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801cf2:	83 ec 0c             	sub    $0xc,%esp
+  801cf5:	ff 75 08             	push   0x8(%ebp)
+  801cf8:	e8 aa f3 ff ff       	call   8010a7 <fd2data>
+  801cfd:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801cff:	83 c4 08             	add    $0x8,%esp
+  801d02:	68 28 2c 80 00       	push   $0x802c28
+  801d07:	53                   	push   %ebx
+  801d08:	e8 f8 ea ff ff       	call   800805 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801d0d:	8b 46 04             	mov    0x4(%esi),%eax
+  801d10:	2b 06                	sub    (%esi),%eax
+  801d12:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801d18:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d1f:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d22:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801d29:	30 80 00 
+	return 0;
+}
+  801d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d34:	5b                   	pop    %ebx
+  801d35:	5e                   	pop    %esi
+  801d36:	5d                   	pop    %ebp
+  801d37:	c3                   	ret
+
+00801d38 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d38:	55                   	push   %ebp
+  801d39:	89 e5                	mov    %esp,%ebp
+  801d3b:	53                   	push   %ebx
+  801d3c:	83 ec 0c             	sub    $0xc,%esp
+  801d3f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d42:	53                   	push   %ebx
+  801d43:	6a 00                	push   $0x0
+  801d45:	e8 f0 ef ff ff       	call   800d3a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d4a:	89 1c 24             	mov    %ebx,(%esp)
+  801d4d:	e8 55 f3 ff ff       	call   8010a7 <fd2data>
+  801d52:	83 c4 08             	add    $0x8,%esp
+  801d55:	50                   	push   %eax
+  801d56:	6a 00                	push   $0x0
+  801d58:	e8 dd ef ff ff       	call   800d3a <sys_page_unmap>
+}
+  801d5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d60:	c9                   	leave
+  801d61:	c3                   	ret
+
+00801d62 <_pipeisclosed>:
+{
+  801d62:	55                   	push   %ebp
+  801d63:	89 e5                	mov    %esp,%ebp
+  801d65:	57                   	push   %edi
+  801d66:	56                   	push   %esi
+  801d67:	53                   	push   %ebx
+  801d68:	83 ec 1c             	sub    $0x1c,%esp
+  801d6b:	89 c7                	mov    %eax,%edi
+  801d6d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d6f:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  801d74:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801d77:	83 ec 0c             	sub    $0xc,%esp
+  801d7a:	57                   	push   %edi
+  801d7b:	e8 04 05 00 00       	call   802284 <pageref>
+  801d80:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d83:	89 34 24             	mov    %esi,(%esp)
+  801d86:	e8 f9 04 00 00       	call   802284 <pageref>
+		nn = thisenv->env_runs;
+  801d8b:	8b 15 20 40 c0 00    	mov    0xc04020,%edx
+  801d91:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801d94:	83 c4 10             	add    $0x10,%esp
+  801d97:	39 cb                	cmp    %ecx,%ebx
+  801d99:	74 1b                	je     801db6 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801d9b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d9e:	75 cf                	jne    801d6f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801da0:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801da3:	6a 01                	push   $0x1
+  801da5:	50                   	push   %eax
+  801da6:	53                   	push   %ebx
+  801da7:	68 2f 2c 80 00       	push   $0x802c2f
+  801dac:	e8 66 e4 ff ff       	call   800217 <cprintf>
+  801db1:	83 c4 10             	add    $0x10,%esp
+  801db4:	eb b9                	jmp    801d6f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801db6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801db9:	0f 94 c0             	sete   %al
+  801dbc:	0f b6 c0             	movzbl %al,%eax
+}
+  801dbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc2:	5b                   	pop    %ebx
+  801dc3:	5e                   	pop    %esi
+  801dc4:	5f                   	pop    %edi
+  801dc5:	5d                   	pop    %ebp
+  801dc6:	c3                   	ret
+
+00801dc7 <devpipe_write>:
+{
+  801dc7:	55                   	push   %ebp
+  801dc8:	89 e5                	mov    %esp,%ebp
+  801dca:	57                   	push   %edi
+  801dcb:	56                   	push   %esi
+  801dcc:	53                   	push   %ebx
+  801dcd:	83 ec 28             	sub    $0x28,%esp
+  801dd0:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801dd3:	56                   	push   %esi
+  801dd4:	e8 ce f2 ff ff       	call   8010a7 <fd2data>
+  801dd9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801ddb:	83 c4 10             	add    $0x10,%esp
+  801dde:	bf 00 00 00 00       	mov    $0x0,%edi
+  801de3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801de6:	75 09                	jne    801df1 <devpipe_write+0x2a>
+	return i;
+  801de8:	89 f8                	mov    %edi,%eax
+  801dea:	eb 23                	jmp    801e0f <devpipe_write+0x48>
+			sys_yield();
+  801dec:	e8 01 ee ff ff       	call   800bf2 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801df1:	8b 43 04             	mov    0x4(%ebx),%eax
+  801df4:	8b 0b                	mov    (%ebx),%ecx
+  801df6:	8d 51 20             	lea    0x20(%ecx),%edx
+  801df9:	39 d0                	cmp    %edx,%eax
+  801dfb:	72 1a                	jb     801e17 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801dfd:	89 da                	mov    %ebx,%edx
+  801dff:	89 f0                	mov    %esi,%eax
+  801e01:	e8 5c ff ff ff       	call   801d62 <_pipeisclosed>
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	74 e2                	je     801dec <devpipe_write+0x25>
+				return 0;
+  801e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e12:	5b                   	pop    %ebx
+  801e13:	5e                   	pop    %esi
+  801e14:	5f                   	pop    %edi
+  801e15:	5d                   	pop    %ebp
+  801e16:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e1a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801e1e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801e21:	89 c2                	mov    %eax,%edx
+  801e23:	c1 fa 1f             	sar    $0x1f,%edx
+  801e26:	89 d1                	mov    %edx,%ecx
+  801e28:	c1 e9 1b             	shr    $0x1b,%ecx
+  801e2b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801e2e:	83 e2 1f             	and    $0x1f,%edx
+  801e31:	29 ca                	sub    %ecx,%edx
+  801e33:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801e37:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801e3b:	83 c0 01             	add    $0x1,%eax
+  801e3e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801e41:	83 c7 01             	add    $0x1,%edi
+  801e44:	eb 9d                	jmp    801de3 <devpipe_write+0x1c>
+
+00801e46 <devpipe_read>:
+{
+  801e46:	55                   	push   %ebp
+  801e47:	89 e5                	mov    %esp,%ebp
+  801e49:	57                   	push   %edi
+  801e4a:	56                   	push   %esi
+  801e4b:	53                   	push   %ebx
+  801e4c:	83 ec 18             	sub    $0x18,%esp
+  801e4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801e52:	57                   	push   %edi
+  801e53:	e8 4f f2 ff ff       	call   8010a7 <fd2data>
+  801e58:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801e5a:	83 c4 10             	add    $0x10,%esp
+  801e5d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e62:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801e65:	75 13                	jne    801e7a <devpipe_read+0x34>
+	return i;
+  801e67:	89 f0                	mov    %esi,%eax
+  801e69:	eb 02                	jmp    801e6d <devpipe_read+0x27>
+				return i;
+  801e6b:	89 f0                	mov    %esi,%eax
+}
+  801e6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e70:	5b                   	pop    %ebx
+  801e71:	5e                   	pop    %esi
+  801e72:	5f                   	pop    %edi
+  801e73:	5d                   	pop    %ebp
+  801e74:	c3                   	ret
+			sys_yield();
+  801e75:	e8 78 ed ff ff       	call   800bf2 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801e7a:	8b 03                	mov    (%ebx),%eax
+  801e7c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801e7f:	75 18                	jne    801e99 <devpipe_read+0x53>
+			if (i > 0)
+  801e81:	85 f6                	test   %esi,%esi
+  801e83:	75 e6                	jne    801e6b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801e85:	89 da                	mov    %ebx,%edx
+  801e87:	89 f8                	mov    %edi,%eax
+  801e89:	e8 d4 fe ff ff       	call   801d62 <_pipeisclosed>
+  801e8e:	85 c0                	test   %eax,%eax
+  801e90:	74 e3                	je     801e75 <devpipe_read+0x2f>
+				return 0;
+  801e92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e97:	eb d4                	jmp    801e6d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e99:	99                   	cltd
+  801e9a:	c1 ea 1b             	shr    $0x1b,%edx
+  801e9d:	01 d0                	add    %edx,%eax
+  801e9f:	83 e0 1f             	and    $0x1f,%eax
+  801ea2:	29 d0                	sub    %edx,%eax
+  801ea4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ea9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eac:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801eaf:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801eb2:	83 c6 01             	add    $0x1,%esi
+  801eb5:	eb ab                	jmp    801e62 <devpipe_read+0x1c>
+
+00801eb7 <pipe>:
+{
+  801eb7:	55                   	push   %ebp
+  801eb8:	89 e5                	mov    %esp,%ebp
+  801eba:	56                   	push   %esi
+  801ebb:	53                   	push   %ebx
+  801ebc:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801ebf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ec2:	50                   	push   %eax
+  801ec3:	e8 f6 f1 ff ff       	call   8010be <fd_alloc>
+  801ec8:	89 c3                	mov    %eax,%ebx
+  801eca:	83 c4 10             	add    $0x10,%esp
+  801ecd:	85 c0                	test   %eax,%eax
+  801ecf:	0f 88 23 01 00 00    	js     801ff8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ed5:	83 ec 04             	sub    $0x4,%esp
+  801ed8:	68 07 04 00 00       	push   $0x407
+  801edd:	ff 75 f4             	push   -0xc(%ebp)
+  801ee0:	6a 00                	push   $0x0
+  801ee2:	e8 8b ed ff ff       	call   800c72 <sys_page_alloc>
+  801ee7:	89 c3                	mov    %eax,%ebx
+  801ee9:	83 c4 10             	add    $0x10,%esp
+  801eec:	85 c0                	test   %eax,%eax
+  801eee:	0f 88 04 01 00 00    	js     801ff8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801ef4:	83 ec 0c             	sub    $0xc,%esp
+  801ef7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801efa:	50                   	push   %eax
+  801efb:	e8 be f1 ff ff       	call   8010be <fd_alloc>
+  801f00:	89 c3                	mov    %eax,%ebx
+  801f02:	83 c4 10             	add    $0x10,%esp
+  801f05:	85 c0                	test   %eax,%eax
+  801f07:	0f 88 db 00 00 00    	js     801fe8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f0d:	83 ec 04             	sub    $0x4,%esp
+  801f10:	68 07 04 00 00       	push   $0x407
+  801f15:	ff 75 f0             	push   -0x10(%ebp)
+  801f18:	6a 00                	push   $0x0
+  801f1a:	e8 53 ed ff ff       	call   800c72 <sys_page_alloc>
+  801f1f:	89 c3                	mov    %eax,%ebx
+  801f21:	83 c4 10             	add    $0x10,%esp
+  801f24:	85 c0                	test   %eax,%eax
+  801f26:	0f 88 bc 00 00 00    	js     801fe8 <pipe+0x131>
+	va = fd2data(fd0);
+  801f2c:	83 ec 0c             	sub    $0xc,%esp
+  801f2f:	ff 75 f4             	push   -0xc(%ebp)
+  801f32:	e8 70 f1 ff ff       	call   8010a7 <fd2data>
+  801f37:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f39:	83 c4 0c             	add    $0xc,%esp
+  801f3c:	68 07 04 00 00       	push   $0x407
+  801f41:	50                   	push   %eax
+  801f42:	6a 00                	push   $0x0
+  801f44:	e8 29 ed ff ff       	call   800c72 <sys_page_alloc>
+  801f49:	89 c3                	mov    %eax,%ebx
+  801f4b:	83 c4 10             	add    $0x10,%esp
+  801f4e:	85 c0                	test   %eax,%eax
+  801f50:	0f 88 82 00 00 00    	js     801fd8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f56:	83 ec 0c             	sub    $0xc,%esp
+  801f59:	ff 75 f0             	push   -0x10(%ebp)
+  801f5c:	e8 46 f1 ff ff       	call   8010a7 <fd2data>
+  801f61:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801f68:	50                   	push   %eax
+  801f69:	6a 00                	push   $0x0
+  801f6b:	56                   	push   %esi
+  801f6c:	6a 00                	push   $0x0
+  801f6e:	e8 85 ed ff ff       	call   800cf8 <sys_page_map>
+  801f73:	89 c3                	mov    %eax,%ebx
+  801f75:	83 c4 20             	add    $0x20,%esp
+  801f78:	85 c0                	test   %eax,%eax
+  801f7a:	78 4e                	js     801fca <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801f7c:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801f81:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f84:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801f86:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f89:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801f90:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801f93:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801f95:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801f98:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801f9f:	83 ec 0c             	sub    $0xc,%esp
+  801fa2:	ff 75 f4             	push   -0xc(%ebp)
+  801fa5:	e8 ed f0 ff ff       	call   801097 <fd2num>
+  801faa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fad:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801faf:	83 c4 04             	add    $0x4,%esp
+  801fb2:	ff 75 f0             	push   -0x10(%ebp)
+  801fb5:	e8 dd f0 ff ff       	call   801097 <fd2num>
+  801fba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fbd:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801fc0:	83 c4 10             	add    $0x10,%esp
+  801fc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fc8:	eb 2e                	jmp    801ff8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801fca:	83 ec 08             	sub    $0x8,%esp
+  801fcd:	56                   	push   %esi
+  801fce:	6a 00                	push   $0x0
+  801fd0:	e8 65 ed ff ff       	call   800d3a <sys_page_unmap>
+  801fd5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801fd8:	83 ec 08             	sub    $0x8,%esp
+  801fdb:	ff 75 f0             	push   -0x10(%ebp)
+  801fde:	6a 00                	push   $0x0
+  801fe0:	e8 55 ed ff ff       	call   800d3a <sys_page_unmap>
+  801fe5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801fe8:	83 ec 08             	sub    $0x8,%esp
+  801feb:	ff 75 f4             	push   -0xc(%ebp)
+  801fee:	6a 00                	push   $0x0
+  801ff0:	e8 45 ed ff ff       	call   800d3a <sys_page_unmap>
+  801ff5:	83 c4 10             	add    $0x10,%esp
+}
+  801ff8:	89 d8                	mov    %ebx,%eax
+  801ffa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ffd:	5b                   	pop    %ebx
+  801ffe:	5e                   	pop    %esi
+  801fff:	5d                   	pop    %ebp
+  802000:	c3                   	ret
+
+00802001 <pipeisclosed>:
+{
+  802001:	55                   	push   %ebp
+  802002:	89 e5                	mov    %esp,%ebp
+  802004:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802007:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80200a:	50                   	push   %eax
+  80200b:	ff 75 08             	push   0x8(%ebp)
+  80200e:	e8 01 f1 ff ff       	call   801114 <fd_lookup>
+  802013:	83 c4 10             	add    $0x10,%esp
+  802016:	85 c0                	test   %eax,%eax
+  802018:	78 18                	js     802032 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80201a:	83 ec 0c             	sub    $0xc,%esp
+  80201d:	ff 75 f4             	push   -0xc(%ebp)
+  802020:	e8 82 f0 ff ff       	call   8010a7 <fd2data>
+  802025:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802027:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80202a:	e8 33 fd ff ff       	call   801d62 <_pipeisclosed>
+  80202f:	83 c4 10             	add    $0x10,%esp
+}
+  802032:	c9                   	leave
+  802033:	c3                   	ret
+
+00802034 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802034:	b8 00 00 00 00       	mov    $0x0,%eax
+  802039:	c3                   	ret
+
+0080203a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80203a:	55                   	push   %ebp
+  80203b:	89 e5                	mov    %esp,%ebp
+  80203d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802040:	68 47 2c 80 00       	push   $0x802c47
+  802045:	ff 75 0c             	push   0xc(%ebp)
+  802048:	e8 b8 e7 ff ff       	call   800805 <strcpy>
+	return 0;
+}
+  80204d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802052:	c9                   	leave
+  802053:	c3                   	ret
+
+00802054 <devcons_write>:
+{
+  802054:	55                   	push   %ebp
+  802055:	89 e5                	mov    %esp,%ebp
+  802057:	57                   	push   %edi
+  802058:	56                   	push   %esi
+  802059:	53                   	push   %ebx
+  80205a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802060:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802065:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80206b:	eb 2e                	jmp    80209b <devcons_write+0x47>
+		m = n - tot;
+  80206d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802070:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802072:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802077:	39 c3                	cmp    %eax,%ebx
+  802079:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80207c:	83 ec 04             	sub    $0x4,%esp
+  80207f:	53                   	push   %ebx
+  802080:	89 f0                	mov    %esi,%eax
+  802082:	03 45 0c             	add    0xc(%ebp),%eax
+  802085:	50                   	push   %eax
+  802086:	57                   	push   %edi
+  802087:	e8 ff e8 ff ff       	call   80098b <memmove>
+		sys_cputs(buf, m);
+  80208c:	83 c4 08             	add    $0x8,%esp
+  80208f:	53                   	push   %ebx
+  802090:	57                   	push   %edi
+  802091:	e8 9f ea ff ff       	call   800b35 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802096:	01 de                	add    %ebx,%esi
+  802098:	83 c4 10             	add    $0x10,%esp
+  80209b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80209e:	72 cd                	jb     80206d <devcons_write+0x19>
+}
+  8020a0:	89 f0                	mov    %esi,%eax
+  8020a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020a5:	5b                   	pop    %ebx
+  8020a6:	5e                   	pop    %esi
+  8020a7:	5f                   	pop    %edi
+  8020a8:	5d                   	pop    %ebp
+  8020a9:	c3                   	ret
+
+008020aa <devcons_read>:
+{
+  8020aa:	55                   	push   %ebp
+  8020ab:	89 e5                	mov    %esp,%ebp
+  8020ad:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8020b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8020b9:	75 07                	jne    8020c2 <devcons_read+0x18>
+  8020bb:	eb 1f                	jmp    8020dc <devcons_read+0x32>
+		sys_yield();
+  8020bd:	e8 30 eb ff ff       	call   800bf2 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8020c2:	e8 8c ea ff ff       	call   800b53 <sys_cgetc>
+  8020c7:	85 c0                	test   %eax,%eax
+  8020c9:	74 f2                	je     8020bd <devcons_read+0x13>
+	if (c < 0)
+  8020cb:	78 0f                	js     8020dc <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8020cd:	83 f8 04             	cmp    $0x4,%eax
+  8020d0:	74 0c                	je     8020de <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8020d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020d5:	88 02                	mov    %al,(%edx)
+	return 1;
+  8020d7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8020dc:	c9                   	leave
+  8020dd:	c3                   	ret
+		return 0;
+  8020de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e3:	eb f7                	jmp    8020dc <devcons_read+0x32>
+
+008020e5 <cputchar>:
+{
+  8020e5:	55                   	push   %ebp
+  8020e6:	89 e5                	mov    %esp,%ebp
+  8020e8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8020eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ee:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8020f1:	6a 01                	push   $0x1
+  8020f3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020f6:	50                   	push   %eax
+  8020f7:	e8 39 ea ff ff       	call   800b35 <sys_cputs>
+}
+  8020fc:	83 c4 10             	add    $0x10,%esp
+  8020ff:	c9                   	leave
+  802100:	c3                   	ret
+
+00802101 <getchar>:
+{
+  802101:	55                   	push   %ebp
+  802102:	89 e5                	mov    %esp,%ebp
+  802104:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802107:	6a 01                	push   $0x1
+  802109:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80210c:	50                   	push   %eax
+  80210d:	6a 00                	push   $0x0
+  80210f:	e8 66 f2 ff ff       	call   80137a <read>
+	if (r < 0)
+  802114:	83 c4 10             	add    $0x10,%esp
+  802117:	85 c0                	test   %eax,%eax
+  802119:	78 06                	js     802121 <getchar+0x20>
+	if (r < 1)
+  80211b:	74 06                	je     802123 <getchar+0x22>
+	return c;
+  80211d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802121:	c9                   	leave
+  802122:	c3                   	ret
+		return -E_EOF;
+  802123:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802128:	eb f7                	jmp    802121 <getchar+0x20>
+
+0080212a <iscons>:
+{
+  80212a:	55                   	push   %ebp
+  80212b:	89 e5                	mov    %esp,%ebp
+  80212d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802130:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802133:	50                   	push   %eax
+  802134:	ff 75 08             	push   0x8(%ebp)
+  802137:	e8 d8 ef ff ff       	call   801114 <fd_lookup>
+  80213c:	83 c4 10             	add    $0x10,%esp
+  80213f:	85 c0                	test   %eax,%eax
+  802141:	78 11                	js     802154 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802143:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802146:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80214c:	39 10                	cmp    %edx,(%eax)
+  80214e:	0f 94 c0             	sete   %al
+  802151:	0f b6 c0             	movzbl %al,%eax
+}
+  802154:	c9                   	leave
+  802155:	c3                   	ret
+
+00802156 <opencons>:
+{
+  802156:	55                   	push   %ebp
+  802157:	89 e5                	mov    %esp,%ebp
+  802159:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80215c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80215f:	50                   	push   %eax
+  802160:	e8 59 ef ff ff       	call   8010be <fd_alloc>
+  802165:	83 c4 10             	add    $0x10,%esp
+  802168:	85 c0                	test   %eax,%eax
+  80216a:	78 3a                	js     8021a6 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80216c:	83 ec 04             	sub    $0x4,%esp
+  80216f:	68 07 04 00 00       	push   $0x407
+  802174:	ff 75 f4             	push   -0xc(%ebp)
+  802177:	6a 00                	push   $0x0
+  802179:	e8 f4 ea ff ff       	call   800c72 <sys_page_alloc>
+  80217e:	83 c4 10             	add    $0x10,%esp
+  802181:	85 c0                	test   %eax,%eax
+  802183:	78 21                	js     8021a6 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802185:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802188:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80218e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802190:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802193:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80219a:	83 ec 0c             	sub    $0xc,%esp
+  80219d:	50                   	push   %eax
+  80219e:	e8 f4 ee ff ff       	call   801097 <fd2num>
+  8021a3:	83 c4 10             	add    $0x10,%esp
+}
+  8021a6:	c9                   	leave
+  8021a7:	c3                   	ret
+
+008021a8 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8021a8:	55                   	push   %ebp
+  8021a9:	89 e5                	mov    %esp,%ebp
+  8021ab:	57                   	push   %edi
+  8021ac:	56                   	push   %esi
+  8021ad:	53                   	push   %ebx
+  8021ae:	83 ec 18             	sub    $0x18,%esp
+  8021b1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021b4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021b7:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8021ba:	85 db                	test   %ebx,%ebx
+  8021bc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021c1:	0f 45 c3             	cmovne %ebx,%eax
+  8021c4:	50                   	push   %eax
+  8021c5:	e8 2b ee ff ff       	call   800ff5 <sys_ipc_recv>
+
+	if (from_env_store)
+  8021ca:	83 c4 10             	add    $0x10,%esp
+  8021cd:	85 ff                	test   %edi,%edi
+  8021cf:	74 17                	je     8021e8 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8021d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d6:	85 c0                	test   %eax,%eax
+  8021d8:	75 0c                	jne    8021e6 <ipc_recv+0x3e>
+  8021da:	8b 15 20 40 c0 00    	mov    0xc04020,%edx
+  8021e0:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8021e6:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8021e8:	85 f6                	test   %esi,%esi
+  8021ea:	74 2e                	je     80221a <ipc_recv+0x72>
+		if (!r && pg)
+  8021ec:	85 c0                	test   %eax,%eax
+  8021ee:	75 24                	jne    802214 <ipc_recv+0x6c>
+  8021f0:	85 db                	test   %ebx,%ebx
+  8021f2:	74 20                	je     802214 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8021f4:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  8021f9:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8021ff:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802201:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  802206:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80220c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80220f:	5b                   	pop    %ebx
+  802210:	5e                   	pop    %esi
+  802211:	5f                   	pop    %edi
+  802212:	5d                   	pop    %ebp
+  802213:	c3                   	ret
+			*perm_store = 0;
+  802214:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80221a:	85 c0                	test   %eax,%eax
+  80221c:	75 ee                	jne    80220c <ipc_recv+0x64>
+  80221e:	eb e1                	jmp    802201 <ipc_recv+0x59>
+
+00802220 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802220:	55                   	push   %ebp
+  802221:	89 e5                	mov    %esp,%ebp
+  802223:	57                   	push   %edi
+  802224:	56                   	push   %esi
+  802225:	53                   	push   %ebx
+  802226:	83 ec 0c             	sub    $0xc,%esp
+  802229:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80222c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80222f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802232:	85 db                	test   %ebx,%ebx
+  802234:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802239:	0f 44 d8             	cmove  %eax,%ebx
+  80223c:	ff 75 14             	push   0x14(%ebp)
+  80223f:	53                   	push   %ebx
+  802240:	56                   	push   %esi
+  802241:	57                   	push   %edi
+  802242:	e8 8b ed ff ff       	call   800fd2 <sys_ipc_try_send_yield>
+  802247:	83 c4 10             	add    $0x10,%esp
+  80224a:	85 c0                	test   %eax,%eax
+  80224c:	79 1e                	jns    80226c <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80224e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802251:	75 07                	jne    80225a <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802253:	e8 9a e9 ff ff       	call   800bf2 <sys_yield>
+  802258:	eb e2                	jmp    80223c <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  80225a:	50                   	push   %eax
+  80225b:	68 53 2c 80 00       	push   $0x802c53
+  802260:	6a 3d                	push   $0x3d
+  802262:	68 68 2c 80 00       	push   $0x802c68
+  802267:	e8 d0 de ff ff       	call   80013c <_panic>
+	}
+}
+  80226c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80226f:	5b                   	pop    %ebx
+  802270:	5e                   	pop    %esi
+  802271:	5f                   	pop    %edi
+  802272:	5d                   	pop    %ebp
+  802273:	c3                   	ret
+
+00802274 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802274:	55                   	push   %ebp
+  802275:	89 e5                	mov    %esp,%ebp
+  802277:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  80227a:	ff 75 08             	push   0x8(%ebp)
+  80227d:	e8 f0 e8 ff ff       	call   800b72 <sys_env_find>
+}
+  802282:	c9                   	leave
+  802283:	c3                   	ret
+
+00802284 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802284:	55                   	push   %ebp
+  802285:	89 e5                	mov    %esp,%ebp
+  802287:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80228a:	89 c2                	mov    %eax,%edx
+  80228c:	c1 ea 16             	shr    $0x16,%edx
+  80228f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802296:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80229b:	f6 c1 01             	test   $0x1,%cl
+  80229e:	74 22                	je     8022c2 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8022a0:	c1 e8 0c             	shr    $0xc,%eax
+  8022a3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8022aa:	a8 01                	test   $0x1,%al
+  8022ac:	74 14                	je     8022c2 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8022ae:	c1 e8 0c             	shr    $0xc,%eax
+  8022b1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8022b4:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8022bb:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8022bf:	0f b7 d2             	movzwl %dx,%edx
+}
+  8022c2:	89 d0                	mov    %edx,%eax
+  8022c4:	5d                   	pop    %ebp
+  8022c5:	c3                   	ret
+  8022c6:	66 90                	xchg   %ax,%ax
+  8022c8:	66 90                	xchg   %ax,%ax
+  8022ca:	66 90                	xchg   %ax,%ax
+  8022cc:	66 90                	xchg   %ax,%ax
+  8022ce:	66 90                	xchg   %ax,%ax
+
+008022d0 <__udivmoddi4>:
+  8022d0:	55                   	push   %ebp
+  8022d1:	57                   	push   %edi
+  8022d2:	56                   	push   %esi
+  8022d3:	53                   	push   %ebx
+  8022d4:	83 ec 14             	sub    $0x14,%esp
+  8022d7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8022db:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8022df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022e7:	89 f1                	mov    %esi,%ecx
+  8022e9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022ed:	09 d9                	or     %ebx,%ecx
+  8022ef:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022f3:	0f 84 92 00 00 00    	je     80238b <__udivmoddi4+0xbb>
+  8022f9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802300:	00 
+  802301:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802306:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80230d:	00 
+  80230e:	89 1c 24             	mov    %ebx,(%esp)
+  802311:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802315:	8d 76 00             	lea    0x0(%esi),%esi
+  802318:	89 e9                	mov    %ebp,%ecx
+  80231a:	89 c3                	mov    %eax,%ebx
+  80231c:	89 d6                	mov    %edx,%esi
+  80231e:	31 ff                	xor    %edi,%edi
+  802320:	d3 ee                	shr    %cl,%esi
+  802322:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802325:	f6 c1 20             	test   $0x20,%cl
+  802328:	0f 45 de             	cmovne %esi,%ebx
+  80232b:	0f 45 f7             	cmovne %edi,%esi
+  80232e:	8b 3c 24             	mov    (%esp),%edi
+  802331:	39 fb                	cmp    %edi,%ebx
+  802333:	89 f7                	mov    %esi,%edi
+  802335:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802339:	8b 1c 24             	mov    (%esp),%ebx
+  80233c:	19 f7                	sbb    %esi,%edi
+  80233e:	72 39                	jb     802379 <__udivmoddi4+0xa9>
+  802340:	89 e9                	mov    %ebp,%ecx
+  802342:	89 f7                	mov    %esi,%edi
+  802344:	89 de                	mov    %ebx,%esi
+  802346:	0f a5 df             	shld   %cl,%ebx,%edi
+  802349:	d3 e6                	shl    %cl,%esi
+  80234b:	31 db                	xor    %ebx,%ebx
+  80234d:	f6 c1 20             	test   $0x20,%cl
+  802350:	0f 45 fe             	cmovne %esi,%edi
+  802353:	0f 45 f3             	cmovne %ebx,%esi
+  802356:	29 f0                	sub    %esi,%eax
+  802358:	be 01 00 00 00       	mov    $0x1,%esi
+  80235d:	19 fa                	sbb    %edi,%edx
+  80235f:	31 ff                	xor    %edi,%edi
+  802361:	31 db                	xor    %ebx,%ebx
+  802363:	0f a5 f7             	shld   %cl,%esi,%edi
+  802366:	d3 e6                	shl    %cl,%esi
+  802368:	f6 c1 20             	test   $0x20,%cl
+  80236b:	0f 45 fe             	cmovne %esi,%edi
+  80236e:	0f 45 f3             	cmovne %ebx,%esi
+  802371:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802375:	09 74 24 08          	or     %esi,0x8(%esp)
+  802379:	83 ed 01             	sub    $0x1,%ebp
+  80237c:	73 9a                	jae    802318 <__udivmoddi4+0x48>
+  80237e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802382:	85 ff                	test   %edi,%edi
+  802384:	74 05                	je     80238b <__udivmoddi4+0xbb>
+  802386:	89 07                	mov    %eax,(%edi)
+  802388:	89 57 04             	mov    %edx,0x4(%edi)
+  80238b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80238f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802393:	83 c4 14             	add    $0x14,%esp
+  802396:	5b                   	pop    %ebx
+  802397:	5e                   	pop    %esi
+  802398:	5f                   	pop    %edi
+  802399:	5d                   	pop    %ebp
+  80239a:	c3                   	ret
+  80239b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80239f:	90                   	nop
+
+008023a0 <__udivdi3>:
+  8023a0:	55                   	push   %ebp
+  8023a1:	57                   	push   %edi
+  8023a2:	56                   	push   %esi
+  8023a3:	53                   	push   %ebx
+  8023a4:	83 ec 14             	sub    $0x14,%esp
+  8023a7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8023ab:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8023af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8023b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8023b7:	89 fb                	mov    %edi,%ebx
+  8023b9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8023bd:	09 f3                	or     %esi,%ebx
+  8023bf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8023c3:	0f 84 85 00 00 00    	je     80244e <__udivdi3+0xae>
+  8023c9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8023d0:	00 
+  8023d1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8023d6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8023dd:	00 
+  8023de:	89 34 24             	mov    %esi,(%esp)
+  8023e1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023e5:	8d 76 00             	lea    0x0(%esi),%esi
+  8023e8:	89 e9                	mov    %ebp,%ecx
+  8023ea:	89 c3                	mov    %eax,%ebx
+  8023ec:	89 d6                	mov    %edx,%esi
+  8023ee:	31 ff                	xor    %edi,%edi
+  8023f0:	d3 ee                	shr    %cl,%esi
+  8023f2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8023f5:	f6 c1 20             	test   $0x20,%cl
+  8023f8:	0f 45 de             	cmovne %esi,%ebx
+  8023fb:	0f 45 f7             	cmovne %edi,%esi
+  8023fe:	8b 3c 24             	mov    (%esp),%edi
+  802401:	39 fb                	cmp    %edi,%ebx
+  802403:	89 f7                	mov    %esi,%edi
+  802405:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802409:	8b 1c 24             	mov    (%esp),%ebx
+  80240c:	19 f7                	sbb    %esi,%edi
+  80240e:	72 39                	jb     802449 <__udivdi3+0xa9>
+  802410:	89 e9                	mov    %ebp,%ecx
+  802412:	89 f7                	mov    %esi,%edi
+  802414:	89 de                	mov    %ebx,%esi
+  802416:	0f a5 df             	shld   %cl,%ebx,%edi
+  802419:	d3 e6                	shl    %cl,%esi
+  80241b:	31 db                	xor    %ebx,%ebx
+  80241d:	f6 c1 20             	test   $0x20,%cl
+  802420:	0f 45 fe             	cmovne %esi,%edi
+  802423:	0f 45 f3             	cmovne %ebx,%esi
+  802426:	29 f0                	sub    %esi,%eax
+  802428:	be 01 00 00 00       	mov    $0x1,%esi
+  80242d:	19 fa                	sbb    %edi,%edx
+  80242f:	31 ff                	xor    %edi,%edi
+  802431:	31 db                	xor    %ebx,%ebx
+  802433:	0f a5 f7             	shld   %cl,%esi,%edi
+  802436:	d3 e6                	shl    %cl,%esi
+  802438:	f6 c1 20             	test   $0x20,%cl
+  80243b:	0f 45 fe             	cmovne %esi,%edi
+  80243e:	0f 45 f3             	cmovne %ebx,%esi
+  802441:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802445:	09 74 24 08          	or     %esi,0x8(%esp)
+  802449:	83 ed 01             	sub    $0x1,%ebp
+  80244c:	73 9a                	jae    8023e8 <__udivdi3+0x48>
+  80244e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802452:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802456:	83 c4 14             	add    $0x14,%esp
+  802459:	5b                   	pop    %ebx
+  80245a:	5e                   	pop    %esi
+  80245b:	5f                   	pop    %edi
+  80245c:	5d                   	pop    %ebp
+  80245d:	c3                   	ret
+  80245e:	66 90                	xchg   %ax,%ax
+
+00802460 <__umoddi3>:
+  802460:	57                   	push   %edi
+  802461:	56                   	push   %esi
+  802462:	53                   	push   %ebx
+  802463:	83 ec 08             	sub    $0x8,%esp
+  802466:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80246a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80246e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802472:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802476:	89 f9                	mov    %edi,%ecx
+  802478:	89 34 24             	mov    %esi,(%esp)
+  80247b:	09 f1                	or     %esi,%ecx
+  80247d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802481:	74 53                	je     8024d6 <__umoddi3+0x76>
+  802483:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802488:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80248f:	90                   	nop
+  802490:	89 c6                	mov    %eax,%esi
+  802492:	89 d7                	mov    %edx,%edi
+  802494:	31 db                	xor    %ebx,%ebx
+  802496:	d3 ef                	shr    %cl,%edi
+  802498:	0f ad d6             	shrd   %cl,%edx,%esi
+  80249b:	f6 c1 20             	test   $0x20,%cl
+  80249e:	0f 45 f7             	cmovne %edi,%esi
+  8024a1:	0f 45 fb             	cmovne %ebx,%edi
+  8024a4:	8b 1c 24             	mov    (%esp),%ebx
+  8024a7:	39 de                	cmp    %ebx,%esi
+  8024a9:	89 fb                	mov    %edi,%ebx
+  8024ab:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8024af:	8b 34 24             	mov    (%esp),%esi
+  8024b2:	19 fb                	sbb    %edi,%ebx
+  8024b4:	72 14                	jb     8024ca <__umoddi3+0x6a>
+  8024b6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8024b9:	31 db                	xor    %ebx,%ebx
+  8024bb:	d3 e6                	shl    %cl,%esi
+  8024bd:	f6 c1 20             	test   $0x20,%cl
+  8024c0:	0f 45 fe             	cmovne %esi,%edi
+  8024c3:	0f 45 f3             	cmovne %ebx,%esi
+  8024c6:	29 f0                	sub    %esi,%eax
+  8024c8:	19 fa                	sbb    %edi,%edx
+  8024ca:	83 e9 01             	sub    $0x1,%ecx
+  8024cd:	73 c1                	jae    802490 <__umoddi3+0x30>
+  8024cf:	83 c4 08             	add    $0x8,%esp
+  8024d2:	5b                   	pop    %ebx
+  8024d3:	5e                   	pop    %esi
+  8024d4:	5f                   	pop    %edi
+  8024d5:	c3                   	ret
+  8024d6:	83 c4 08             	add    $0x8,%esp
+  8024d9:	31 c0                	xor    %eax,%eax
+  8024db:	31 d2                	xor    %edx,%edx
+  8024dd:	5b                   	pop    %ebx
+  8024de:	5e                   	pop    %esi
+  8024df:	5f                   	pop    %edi
+  8024e0:	c3                   	ret
+  8024e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024ef:	90                   	nop
+
+008024f0 <__divdi3>:
+  8024f0:	55                   	push   %ebp
+  8024f1:	57                   	push   %edi
+  8024f2:	56                   	push   %esi
+  8024f3:	53                   	push   %ebx
+  8024f4:	83 ec 1c             	sub    $0x1c,%esp
+  8024f7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8024fb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8024ff:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802503:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802507:	85 ff                	test   %edi,%edi
+  802509:	0f 88 da 00 00 00    	js     8025e9 <__divdi3+0xf9>
+  80250f:	85 db                	test   %ebx,%ebx
+  802511:	78 16                	js     802529 <__divdi3+0x39>
+  802513:	89 dd                	mov    %ebx,%ebp
+  802515:	89 c8                	mov    %ecx,%eax
+  802517:	89 da                	mov    %ebx,%edx
+  802519:	09 cd                	or     %ecx,%ebp
+  80251b:	0f 85 fd 00 00 00    	jne    80261e <__divdi3+0x12e>
+  802521:	83 c4 1c             	add    $0x1c,%esp
+  802524:	5b                   	pop    %ebx
+  802525:	5e                   	pop    %esi
+  802526:	5f                   	pop    %edi
+  802527:	5d                   	pop    %ebp
+  802528:	c3                   	ret
+  802529:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80252e:	f7 d9                	neg    %ecx
+  802530:	89 f0                	mov    %esi,%eax
+  802532:	89 fa                	mov    %edi,%edx
+  802534:	83 d3 00             	adc    $0x0,%ebx
+  802537:	89 0c 24             	mov    %ecx,(%esp)
+  80253a:	f7 db                	neg    %ebx
+  80253c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802540:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802547:	00 
+  802548:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80254d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802554:	00 
+  802555:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802559:	89 cd                	mov    %ecx,%ebp
+  80255b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80255f:	90                   	nop
+  802560:	89 e9                	mov    %ebp,%ecx
+  802562:	89 c3                	mov    %eax,%ebx
+  802564:	89 d6                	mov    %edx,%esi
+  802566:	31 ff                	xor    %edi,%edi
+  802568:	d3 ee                	shr    %cl,%esi
+  80256a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80256d:	f6 c1 20             	test   $0x20,%cl
+  802570:	0f 45 de             	cmovne %esi,%ebx
+  802573:	0f 45 f7             	cmovne %edi,%esi
+  802576:	8b 3c 24             	mov    (%esp),%edi
+  802579:	39 fb                	cmp    %edi,%ebx
+  80257b:	89 f7                	mov    %esi,%edi
+  80257d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802581:	8b 1c 24             	mov    (%esp),%ebx
+  802584:	19 f7                	sbb    %esi,%edi
+  802586:	72 39                	jb     8025c1 <__divdi3+0xd1>
+  802588:	89 e9                	mov    %ebp,%ecx
+  80258a:	89 f7                	mov    %esi,%edi
+  80258c:	89 de                	mov    %ebx,%esi
+  80258e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802591:	d3 e6                	shl    %cl,%esi
+  802593:	31 db                	xor    %ebx,%ebx
+  802595:	f6 c1 20             	test   $0x20,%cl
+  802598:	0f 45 fe             	cmovne %esi,%edi
+  80259b:	0f 45 f3             	cmovne %ebx,%esi
+  80259e:	29 f0                	sub    %esi,%eax
+  8025a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8025a5:	19 fa                	sbb    %edi,%edx
+  8025a7:	31 ff                	xor    %edi,%edi
+  8025a9:	31 db                	xor    %ebx,%ebx
+  8025ab:	0f a5 f7             	shld   %cl,%esi,%edi
+  8025ae:	d3 e6                	shl    %cl,%esi
+  8025b0:	f6 c1 20             	test   $0x20,%cl
+  8025b3:	0f 45 fe             	cmovne %esi,%edi
+  8025b6:	0f 45 f3             	cmovne %ebx,%esi
+  8025b9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8025bd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8025c1:	83 ed 01             	sub    $0x1,%ebp
+  8025c4:	73 9a                	jae    802560 <__divdi3+0x70>
+  8025c6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8025ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025d2:	85 ed                	test   %ebp,%ebp
+  8025d4:	0f 84 47 ff ff ff    	je     802521 <__divdi3+0x31>
+  8025da:	f7 d8                	neg    %eax
+  8025dc:	83 d2 00             	adc    $0x0,%edx
+  8025df:	83 c4 1c             	add    $0x1c,%esp
+  8025e2:	5b                   	pop    %ebx
+  8025e3:	f7 da                	neg    %edx
+  8025e5:	5e                   	pop    %esi
+  8025e6:	5f                   	pop    %edi
+  8025e7:	5d                   	pop    %ebp
+  8025e8:	c3                   	ret
+  8025e9:	f7 de                	neg    %esi
+  8025eb:	83 d7 00             	adc    $0x0,%edi
+  8025ee:	f7 df                	neg    %edi
+  8025f0:	85 db                	test   %ebx,%ebx
+  8025f2:	78 23                	js     802617 <__divdi3+0x127>
+  8025f4:	89 dd                	mov    %ebx,%ebp
+  8025f6:	89 c8                	mov    %ecx,%eax
+  8025f8:	89 da                	mov    %ebx,%edx
+  8025fa:	09 cd                	or     %ecx,%ebp
+  8025fc:	0f 84 1f ff ff ff    	je     802521 <__divdi3+0x31>
+  802602:	89 0c 24             	mov    %ecx,(%esp)
+  802605:	89 f0                	mov    %esi,%eax
+  802607:	89 fa                	mov    %edi,%edx
+  802609:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80260e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802612:	e9 29 ff ff ff       	jmp    802540 <__divdi3+0x50>
+  802617:	31 ed                	xor    %ebp,%ebp
+  802619:	e9 10 ff ff ff       	jmp    80252e <__divdi3+0x3e>
+  80261e:	89 0c 24             	mov    %ecx,(%esp)
+  802621:	89 f0                	mov    %esi,%eax
+  802623:	89 fa                	mov    %edi,%edx
+  802625:	31 ed                	xor    %ebp,%ebp
+  802627:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80262b:	e9 10 ff ff ff       	jmp    802540 <__divdi3+0x50>
+
+00802630 <__moddi3>:
+  802630:	55                   	push   %ebp
+  802631:	57                   	push   %edi
+  802632:	56                   	push   %esi
+  802633:	53                   	push   %ebx
+  802634:	83 ec 14             	sub    $0x14,%esp
+  802637:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80263b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80263f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802643:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802647:	85 d2                	test   %edx,%edx
+  802649:	0f 88 9b 00 00 00    	js     8026ea <__moddi3+0xba>
+  80264f:	89 f7                	mov    %esi,%edi
+  802651:	31 ed                	xor    %ebp,%ebp
+  802653:	09 cf                	or     %ecx,%edi
+  802655:	0f 84 83 00 00 00    	je     8026de <__moddi3+0xae>
+  80265b:	89 cb                	mov    %ecx,%ebx
+  80265d:	89 f7                	mov    %esi,%edi
+  80265f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802663:	f7 db                	neg    %ebx
+  802665:	83 d7 00             	adc    $0x0,%edi
+  802668:	f7 df                	neg    %edi
+  80266a:	0f 49 f7             	cmovns %edi,%esi
+  80266d:	0f 49 cb             	cmovns %ebx,%ecx
+  802670:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802674:	89 0c 24             	mov    %ecx,(%esp)
+  802677:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80267c:	89 cd                	mov    %ecx,%ebp
+  80267e:	66 90                	xchg   %ax,%ax
+  802680:	89 e9                	mov    %ebp,%ecx
+  802682:	89 c3                	mov    %eax,%ebx
+  802684:	89 d6                	mov    %edx,%esi
+  802686:	31 ff                	xor    %edi,%edi
+  802688:	d3 ee                	shr    %cl,%esi
+  80268a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80268d:	f6 c1 20             	test   $0x20,%cl
+  802690:	0f 45 de             	cmovne %esi,%ebx
+  802693:	0f 45 f7             	cmovne %edi,%esi
+  802696:	8b 3c 24             	mov    (%esp),%edi
+  802699:	39 fb                	cmp    %edi,%ebx
+  80269b:	89 f7                	mov    %esi,%edi
+  80269d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8026a1:	8b 1c 24             	mov    (%esp),%ebx
+  8026a4:	19 f7                	sbb    %esi,%edi
+  8026a6:	72 1a                	jb     8026c2 <__moddi3+0x92>
+  8026a8:	89 e9                	mov    %ebp,%ecx
+  8026aa:	89 f7                	mov    %esi,%edi
+  8026ac:	89 de                	mov    %ebx,%esi
+  8026ae:	0f a5 df             	shld   %cl,%ebx,%edi
+  8026b1:	d3 e6                	shl    %cl,%esi
+  8026b3:	31 db                	xor    %ebx,%ebx
+  8026b5:	f6 c1 20             	test   $0x20,%cl
+  8026b8:	0f 45 fe             	cmovne %esi,%edi
+  8026bb:	0f 45 f3             	cmovne %ebx,%esi
+  8026be:	29 f0                	sub    %esi,%eax
+  8026c0:	19 fa                	sbb    %edi,%edx
+  8026c2:	83 ed 01             	sub    $0x1,%ebp
+  8026c5:	73 b9                	jae    802680 <__moddi3+0x50>
+  8026c7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  8026cb:	85 ed                	test   %ebp,%ebp
+  8026cd:	74 07                	je     8026d6 <__moddi3+0xa6>
+  8026cf:	f7 d8                	neg    %eax
+  8026d1:	83 d2 00             	adc    $0x0,%edx
+  8026d4:	f7 da                	neg    %edx
+  8026d6:	83 c4 14             	add    $0x14,%esp
+  8026d9:	5b                   	pop    %ebx
+  8026da:	5e                   	pop    %esi
+  8026db:	5f                   	pop    %edi
+  8026dc:	5d                   	pop    %ebp
+  8026dd:	c3                   	ret
+  8026de:	83 c4 14             	add    $0x14,%esp
+  8026e1:	31 c0                	xor    %eax,%eax
+  8026e3:	31 d2                	xor    %edx,%edx
+  8026e5:	5b                   	pop    %ebx
+  8026e6:	5e                   	pop    %esi
+  8026e7:	5f                   	pop    %edi
+  8026e8:	5d                   	pop    %ebp
+  8026e9:	c3                   	ret
+  8026ea:	89 f7                	mov    %esi,%edi
+  8026ec:	09 cf                	or     %ecx,%edi
+  8026ee:	74 11                	je     802701 <__moddi3+0xd1>
+  8026f0:	f7 d8                	neg    %eax
+  8026f2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8026f7:	83 d2 00             	adc    $0x0,%edx
+  8026fa:	f7 da                	neg    %edx
+  8026fc:	e9 5a ff ff ff       	jmp    80265b <__moddi3+0x2b>
+  802701:	31 c0                	xor    %eax,%eax
+  802703:	31 d2                	xor    %edx,%edx
+  802705:	eb c8                	jmp    8026cf <__moddi3+0x9f>
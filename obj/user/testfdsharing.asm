@@ -0,0 +1,6266 @@
+
+obj/user/testfdsharing.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 01 00 00       	call   8001ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 14             	sub    $0x14,%esp
+	int fd, r, n, n2;
+
+	if ((fd = open("motd", O_RDONLY)) < 0)
+  80003c:	6a 00                	push   $0x0
+  80003e:	68 40 2c 80 00       	push   $0x802c40
+  800043:	e8 e5 1b 00 00       	call   801c2d <open>
+  800048:	89 c3                	mov    %eax,%ebx
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 ff 00 00 00    	js     800154 <umain+0x121>
+		panic("open motd: %e", fd);
+	seek(fd, 0);
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	6a 00                	push   $0x0
+  80005a:	50                   	push   %eax
+  80005b:	e8 ba 18 00 00       	call   80191a <seek>
+	if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800060:	83 c4 0c             	add    $0xc,%esp
+  800063:	68 00 02 00 00       	push   $0x200
+  800068:	68 20 52 80 00       	push   $0x805220
+  80006d:	53                   	push   %ebx
+  80006e:	e8 de 17 00 00       	call   801851 <readn>
+  800073:	89 c6                	mov    %eax,%esi
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 8e e6 00 00 00    	jle    800166 <umain+0x133>
+		panic("readn: %e", n);
+
+	if ((r = fork()) < 0)
+  800080:	e8 db 11 00 00       	call   801260 <fork>
+  800085:	89 c7                	mov    %eax,%edi
+  800087:	85 c0                	test   %eax,%eax
+  800089:	0f 88 e9 00 00 00    	js     800178 <umain+0x145>
+		panic("fork: %e", r);
+	if (r == 0) {
+  80008f:	75 7b                	jne    80010c <umain+0xd9>
+		seek(fd, 0);
+  800091:	83 ec 08             	sub    $0x8,%esp
+  800094:	6a 00                	push   $0x0
+  800096:	53                   	push   %ebx
+  800097:	e8 7e 18 00 00       	call   80191a <seek>
+		cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  80009c:	c7 04 24 a8 2c 80 00 	movl   $0x802ca8,(%esp)
+  8000a3:	e8 5d 02 00 00       	call   800305 <cprintf>
+		if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000a8:	83 c4 0c             	add    $0xc,%esp
+  8000ab:	68 00 02 00 00       	push   $0x200
+  8000b0:	68 20 50 80 00       	push   $0x805020
+  8000b5:	53                   	push   %ebx
+  8000b6:	e8 96 17 00 00       	call   801851 <readn>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	39 c6                	cmp    %eax,%esi
+  8000c0:	0f 85 c4 00 00 00    	jne    80018a <umain+0x157>
+			panic("read in parent got %d, read in child got %d", n, n2);
+		if (memcmp(buf, buf2, n) != 0)
+  8000c6:	83 ec 04             	sub    $0x4,%esp
+  8000c9:	56                   	push   %esi
+  8000ca:	68 20 50 80 00       	push   $0x805020
+  8000cf:	68 20 52 80 00       	push   $0x805220
+  8000d4:	e8 18 0a 00 00       	call   800af1 <memcmp>
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	85 c0                	test   %eax,%eax
+  8000de:	0f 85 bc 00 00 00    	jne    8001a0 <umain+0x16d>
+			panic("read in parent got different bytes from read in child");
+		cprintf("read in child succeeded\n");
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	68 72 2c 80 00       	push   $0x802c72
+  8000ec:	e8 14 02 00 00       	call   800305 <cprintf>
+		seek(fd, 0);
+  8000f1:	83 c4 08             	add    $0x8,%esp
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	53                   	push   %ebx
+  8000f7:	e8 1e 18 00 00       	call   80191a <seek>
+		close(fd);
+  8000fc:	89 1c 24             	mov    %ebx,(%esp)
+  8000ff:	e8 8a 15 00 00       	call   80168e <close>
+		exit();
+  800104:	e8 07 01 00 00       	call   800210 <exit>
+  800109:	83 c4 10             	add    $0x10,%esp
+	}
+	wait(r);
+  80010c:	83 ec 0c             	sub    $0xc,%esp
+  80010f:	57                   	push   %edi
+  800110:	e8 6f 23 00 00       	call   802484 <wait>
+	if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800115:	83 c4 0c             	add    $0xc,%esp
+  800118:	68 00 02 00 00       	push   $0x200
+  80011d:	68 20 50 80 00       	push   $0x805020
+  800122:	53                   	push   %ebx
+  800123:	e8 29 17 00 00       	call   801851 <readn>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	39 c6                	cmp    %eax,%esi
+  80012d:	0f 85 81 00 00 00    	jne    8001b4 <umain+0x181>
+		panic("read in parent got %d, then got %d", n, n2);
+	cprintf("read in parent succeeded\n");
+  800133:	83 ec 0c             	sub    $0xc,%esp
+  800136:	68 8b 2c 80 00       	push   $0x802c8b
+  80013b:	e8 c5 01 00 00       	call   800305 <cprintf>
+	close(fd);
+  800140:	89 1c 24             	mov    %ebx,(%esp)
+  800143:	e8 46 15 00 00       	call   80168e <close>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  800148:	cc                   	int3
+
+	breakpoint();
+}
+  800149:	83 c4 10             	add    $0x10,%esp
+  80014c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+		panic("open motd: %e", fd);
+  800154:	50                   	push   %eax
+  800155:	68 45 2c 80 00       	push   $0x802c45
+  80015a:	6a 0c                	push   $0xc
+  80015c:	68 53 2c 80 00       	push   $0x802c53
+  800161:	e8 c4 00 00 00       	call   80022a <_panic>
+		panic("readn: %e", n);
+  800166:	50                   	push   %eax
+  800167:	68 68 2c 80 00       	push   $0x802c68
+  80016c:	6a 0f                	push   $0xf
+  80016e:	68 53 2c 80 00       	push   $0x802c53
+  800173:	e8 b2 00 00 00       	call   80022a <_panic>
+		panic("fork: %e", r);
+  800178:	50                   	push   %eax
+  800179:	68 24 31 80 00       	push   $0x803124
+  80017e:	6a 12                	push   $0x12
+  800180:	68 53 2c 80 00       	push   $0x802c53
+  800185:	e8 a0 00 00 00       	call   80022a <_panic>
+			panic("read in parent got %d, read in child got %d", n, n2);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	50                   	push   %eax
+  80018e:	56                   	push   %esi
+  80018f:	68 ec 2c 80 00       	push   $0x802cec
+  800194:	6a 17                	push   $0x17
+  800196:	68 53 2c 80 00       	push   $0x802c53
+  80019b:	e8 8a 00 00 00       	call   80022a <_panic>
+			panic("read in parent got different bytes from read in child");
+  8001a0:	83 ec 04             	sub    $0x4,%esp
+  8001a3:	68 18 2d 80 00       	push   $0x802d18
+  8001a8:	6a 19                	push   $0x19
+  8001aa:	68 53 2c 80 00       	push   $0x802c53
+  8001af:	e8 76 00 00 00       	call   80022a <_panic>
+		panic("read in parent got %d, then got %d", n, n2);
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	50                   	push   %eax
+  8001b8:	56                   	push   %esi
+  8001b9:	68 50 2d 80 00       	push   $0x802d50
+  8001be:	6a 21                	push   $0x21
+  8001c0:	68 53 2c 80 00       	push   $0x802c53
+  8001c5:	e8 60 00 00 00       	call   80022a <_panic>
+
+008001ca <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	56                   	push   %esi
+  8001ce:	53                   	push   %ebx
+  8001cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001d5:	e8 e7 0a 00 00       	call   800cc1 <sys_getenvid>
+  8001da:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8001df:	c1 e0 09             	shl    $0x9,%eax
+  8001e2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001e7:	a3 20 54 80 00       	mov    %eax,0x805420
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001ec:	85 db                	test   %ebx,%ebx
+  8001ee:	7e 07                	jle    8001f7 <libmain+0x2d>
+		binaryname = argv[0];
+  8001f0:	8b 06                	mov    (%esi),%eax
+  8001f2:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001f7:	83 ec 08             	sub    $0x8,%esp
+  8001fa:	56                   	push   %esi
+  8001fb:	53                   	push   %ebx
+  8001fc:	e8 32 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800201:	e8 0a 00 00 00       	call   800210 <exit>
+}
+  800206:	83 c4 10             	add    $0x10,%esp
+  800209:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80020c:	5b                   	pop    %ebx
+  80020d:	5e                   	pop    %esi
+  80020e:	5d                   	pop    %ebp
+  80020f:	c3                   	ret
+
+00800210 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800210:	55                   	push   %ebp
+  800211:	89 e5                	mov    %esp,%ebp
+  800213:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800216:	e8 a0 14 00 00       	call   8016bb <close_all>
+	sys_env_destroy(0);
+  80021b:	83 ec 0c             	sub    $0xc,%esp
+  80021e:	6a 00                	push   $0x0
+  800220:	e8 5b 0a 00 00       	call   800c80 <sys_env_destroy>
+}
+  800225:	83 c4 10             	add    $0x10,%esp
+  800228:	c9                   	leave
+  800229:	c3                   	ret
+
+0080022a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80022a:	55                   	push   %ebp
+  80022b:	89 e5                	mov    %esp,%ebp
+  80022d:	56                   	push   %esi
+  80022e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80022f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800232:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800238:	e8 84 0a 00 00       	call   800cc1 <sys_getenvid>
+  80023d:	83 ec 0c             	sub    $0xc,%esp
+  800240:	ff 75 0c             	push   0xc(%ebp)
+  800243:	ff 75 08             	push   0x8(%ebp)
+  800246:	56                   	push   %esi
+  800247:	50                   	push   %eax
+  800248:	68 80 2d 80 00       	push   $0x802d80
+  80024d:	e8 b3 00 00 00       	call   800305 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800252:	83 c4 18             	add    $0x18,%esp
+  800255:	53                   	push   %ebx
+  800256:	ff 75 10             	push   0x10(%ebp)
+  800259:	e8 56 00 00 00       	call   8002b4 <vcprintf>
+	cprintf("\n");
+  80025e:	c7 04 24 89 2c 80 00 	movl   $0x802c89,(%esp)
+  800265:	e8 9b 00 00 00       	call   800305 <cprintf>
+  80026a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80026d:	cc                   	int3
+	while (1)
+  80026e:	eb fd                	jmp    80026d <_panic+0x43>
+
+00800270 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800270:	55                   	push   %ebp
+  800271:	89 e5                	mov    %esp,%ebp
+  800273:	53                   	push   %ebx
+  800274:	83 ec 04             	sub    $0x4,%esp
+  800277:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80027a:	8b 13                	mov    (%ebx),%edx
+  80027c:	8d 42 01             	lea    0x1(%edx),%eax
+  80027f:	89 03                	mov    %eax,(%ebx)
+  800281:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800284:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800288:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80028d:	74 09                	je     800298 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80028f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800293:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800296:	c9                   	leave
+  800297:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800298:	83 ec 08             	sub    $0x8,%esp
+  80029b:	68 ff 00 00 00       	push   $0xff
+  8002a0:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a3:	50                   	push   %eax
+  8002a4:	e8 7a 09 00 00       	call   800c23 <sys_cputs>
+		b->idx = 0;
+  8002a9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002af:	83 c4 10             	add    $0x10,%esp
+  8002b2:	eb db                	jmp    80028f <putch+0x1f>
+
+008002b4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002b4:	55                   	push   %ebp
+  8002b5:	89 e5                	mov    %esp,%ebp
+  8002b7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002bd:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002c4:	00 00 00 
+	b.cnt = 0;
+  8002c7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002ce:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d1:	ff 75 0c             	push   0xc(%ebp)
+  8002d4:	ff 75 08             	push   0x8(%ebp)
+  8002d7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002dd:	50                   	push   %eax
+  8002de:	68 70 02 80 00       	push   $0x800270
+  8002e3:	e8 14 01 00 00       	call   8003fc <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002e8:	83 c4 08             	add    $0x8,%esp
+  8002eb:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002f7:	50                   	push   %eax
+  8002f8:	e8 26 09 00 00       	call   800c23 <sys_cputs>
+
+	return b.cnt;
+}
+  8002fd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800303:	c9                   	leave
+  800304:	c3                   	ret
+
+00800305 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800305:	55                   	push   %ebp
+  800306:	89 e5                	mov    %esp,%ebp
+  800308:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80030b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80030e:	50                   	push   %eax
+  80030f:	ff 75 08             	push   0x8(%ebp)
+  800312:	e8 9d ff ff ff       	call   8002b4 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800317:	c9                   	leave
+  800318:	c3                   	ret
+
+00800319 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800319:	55                   	push   %ebp
+  80031a:	89 e5                	mov    %esp,%ebp
+  80031c:	57                   	push   %edi
+  80031d:	56                   	push   %esi
+  80031e:	53                   	push   %ebx
+  80031f:	83 ec 1c             	sub    $0x1c,%esp
+  800322:	89 c7                	mov    %eax,%edi
+  800324:	89 d6                	mov    %edx,%esi
+  800326:	8b 45 08             	mov    0x8(%ebp),%eax
+  800329:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80032c:	89 d1                	mov    %edx,%ecx
+  80032e:	89 c2                	mov    %eax,%edx
+  800330:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800333:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800336:	8b 45 10             	mov    0x10(%ebp),%eax
+  800339:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80033c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80033f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800346:	39 c2                	cmp    %eax,%edx
+  800348:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80034b:	72 3e                	jb     80038b <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80034d:	83 ec 0c             	sub    $0xc,%esp
+  800350:	ff 75 18             	push   0x18(%ebp)
+  800353:	83 eb 01             	sub    $0x1,%ebx
+  800356:	53                   	push   %ebx
+  800357:	50                   	push   %eax
+  800358:	83 ec 08             	sub    $0x8,%esp
+  80035b:	ff 75 e4             	push   -0x1c(%ebp)
+  80035e:	ff 75 e0             	push   -0x20(%ebp)
+  800361:	ff 75 dc             	push   -0x24(%ebp)
+  800364:	ff 75 d8             	push   -0x28(%ebp)
+  800367:	e8 64 25 00 00       	call   8028d0 <__udivdi3>
+  80036c:	83 c4 18             	add    $0x18,%esp
+  80036f:	52                   	push   %edx
+  800370:	50                   	push   %eax
+  800371:	89 f2                	mov    %esi,%edx
+  800373:	89 f8                	mov    %edi,%eax
+  800375:	e8 9f ff ff ff       	call   800319 <printnum>
+  80037a:	83 c4 20             	add    $0x20,%esp
+  80037d:	eb 13                	jmp    800392 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80037f:	83 ec 08             	sub    $0x8,%esp
+  800382:	56                   	push   %esi
+  800383:	ff 75 18             	push   0x18(%ebp)
+  800386:	ff d7                	call   *%edi
+  800388:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80038b:	83 eb 01             	sub    $0x1,%ebx
+  80038e:	85 db                	test   %ebx,%ebx
+  800390:	7f ed                	jg     80037f <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800392:	83 ec 08             	sub    $0x8,%esp
+  800395:	56                   	push   %esi
+  800396:	83 ec 04             	sub    $0x4,%esp
+  800399:	ff 75 e4             	push   -0x1c(%ebp)
+  80039c:	ff 75 e0             	push   -0x20(%ebp)
+  80039f:	ff 75 dc             	push   -0x24(%ebp)
+  8003a2:	ff 75 d8             	push   -0x28(%ebp)
+  8003a5:	e8 e6 25 00 00       	call   802990 <__umoddi3>
+  8003aa:	83 c4 14             	add    $0x14,%esp
+  8003ad:	0f be 80 a3 2d 80 00 	movsbl 0x802da3(%eax),%eax
+  8003b4:	50                   	push   %eax
+  8003b5:	ff d7                	call   *%edi
+}
+  8003b7:	83 c4 10             	add    $0x10,%esp
+  8003ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003bd:	5b                   	pop    %ebx
+  8003be:	5e                   	pop    %esi
+  8003bf:	5f                   	pop    %edi
+  8003c0:	5d                   	pop    %ebp
+  8003c1:	c3                   	ret
+
+008003c2 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003c8:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003cc:	8b 10                	mov    (%eax),%edx
+  8003ce:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d1:	73 0a                	jae    8003dd <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d3:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003d6:	89 08                	mov    %ecx,(%eax)
+  8003d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003db:	88 02                	mov    %al,(%edx)
+}
+  8003dd:	5d                   	pop    %ebp
+  8003de:	c3                   	ret
+
+008003df <printfmt>:
+{
+  8003df:	55                   	push   %ebp
+  8003e0:	89 e5                	mov    %esp,%ebp
+  8003e2:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003e5:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003e8:	50                   	push   %eax
+  8003e9:	ff 75 10             	push   0x10(%ebp)
+  8003ec:	ff 75 0c             	push   0xc(%ebp)
+  8003ef:	ff 75 08             	push   0x8(%ebp)
+  8003f2:	e8 05 00 00 00       	call   8003fc <vprintfmt>
+}
+  8003f7:	83 c4 10             	add    $0x10,%esp
+  8003fa:	c9                   	leave
+  8003fb:	c3                   	ret
+
+008003fc <vprintfmt>:
+{
+  8003fc:	55                   	push   %ebp
+  8003fd:	89 e5                	mov    %esp,%ebp
+  8003ff:	57                   	push   %edi
+  800400:	56                   	push   %esi
+  800401:	53                   	push   %ebx
+  800402:	83 ec 2c             	sub    $0x2c,%esp
+  800405:	8b 75 08             	mov    0x8(%ebp),%esi
+  800408:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80040b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80040e:	eb 0a                	jmp    80041a <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800410:	83 ec 08             	sub    $0x8,%esp
+  800413:	53                   	push   %ebx
+  800414:	50                   	push   %eax
+  800415:	ff d6                	call   *%esi
+  800417:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80041a:	83 c7 01             	add    $0x1,%edi
+  80041d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800421:	83 f8 25             	cmp    $0x25,%eax
+  800424:	74 0c                	je     800432 <vprintfmt+0x36>
+			if (ch == '\0')
+  800426:	85 c0                	test   %eax,%eax
+  800428:	75 e6                	jne    800410 <vprintfmt+0x14>
+}
+  80042a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042d:	5b                   	pop    %ebx
+  80042e:	5e                   	pop    %esi
+  80042f:	5f                   	pop    %edi
+  800430:	5d                   	pop    %ebp
+  800431:	c3                   	ret
+		padc = ' ';
+  800432:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800436:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80043d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800444:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80044b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800450:	8d 47 01             	lea    0x1(%edi),%eax
+  800453:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800456:	0f b6 17             	movzbl (%edi),%edx
+  800459:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80045c:	3c 55                	cmp    $0x55,%al
+  80045e:	0f 87 cf 03 00 00    	ja     800833 <vprintfmt+0x437>
+  800464:	0f b6 c0             	movzbl %al,%eax
+  800467:	ff 24 85 e0 2e 80 00 	jmp    *0x802ee0(,%eax,4)
+  80046e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800471:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800475:	eb d9                	jmp    800450 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800477:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80047a:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80047e:	eb d0                	jmp    800450 <vprintfmt+0x54>
+  800480:	0f b6 d2             	movzbl %dl,%edx
+  800483:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80048e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800491:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800495:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800498:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80049b:	83 f9 09             	cmp    $0x9,%ecx
+  80049e:	77 55                	ja     8004f5 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004a0:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004a3:	eb e9                	jmp    80048e <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a8:	8b 00                	mov    (%eax),%eax
+  8004aa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004b9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004bd:	79 91                	jns    800450 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004bf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004cc:	eb 82                	jmp    800450 <vprintfmt+0x54>
+			if (width < 0)
+  8004ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d1:	85 d2                	test   %edx,%edx
+  8004d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d8:	0f 49 c2             	cmovns %edx,%eax
+  8004db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e1:	e9 6a ff ff ff       	jmp    800450 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004e9:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f0:	e9 5b ff ff ff       	jmp    800450 <vprintfmt+0x54>
+  8004f5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004fb:	eb bc                	jmp    8004b9 <vprintfmt+0xbd>
+			lflag++;
+  8004fd:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800500:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800503:	e9 48 ff ff ff       	jmp    800450 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800508:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050b:	8d 78 04             	lea    0x4(%eax),%edi
+  80050e:	83 ec 08             	sub    $0x8,%esp
+  800511:	53                   	push   %ebx
+  800512:	ff 30                	push   (%eax)
+  800514:	ff d6                	call   *%esi
+			break;
+  800516:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800519:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80051c:	e9 b1 02 00 00       	jmp    8007d2 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800521:	8b 45 14             	mov    0x14(%ebp),%eax
+  800524:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800527:	8b 10                	mov    (%eax),%edx
+  800529:	89 d0                	mov    %edx,%eax
+  80052b:	f7 d8                	neg    %eax
+  80052d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800530:	83 f8 0f             	cmp    $0xf,%eax
+  800533:	7f 23                	jg     800558 <vprintfmt+0x15c>
+  800535:	8b 14 85 40 30 80 00 	mov    0x803040(,%eax,4),%edx
+  80053c:	85 d2                	test   %edx,%edx
+  80053e:	74 18                	je     800558 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800540:	52                   	push   %edx
+  800541:	68 69 32 80 00       	push   $0x803269
+  800546:	53                   	push   %ebx
+  800547:	56                   	push   %esi
+  800548:	e8 92 fe ff ff       	call   8003df <printfmt>
+  80054d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800550:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800553:	e9 7a 02 00 00       	jmp    8007d2 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800558:	50                   	push   %eax
+  800559:	68 bb 2d 80 00       	push   $0x802dbb
+  80055e:	53                   	push   %ebx
+  80055f:	56                   	push   %esi
+  800560:	e8 7a fe ff ff       	call   8003df <printfmt>
+  800565:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800568:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80056b:	e9 62 02 00 00       	jmp    8007d2 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800570:	8b 45 14             	mov    0x14(%ebp),%eax
+  800573:	83 c0 04             	add    $0x4,%eax
+  800576:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800579:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80057e:	85 c9                	test   %ecx,%ecx
+  800580:	b8 b4 2d 80 00       	mov    $0x802db4,%eax
+  800585:	0f 45 c1             	cmovne %ecx,%eax
+  800588:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80058b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80058f:	7e 06                	jle    800597 <vprintfmt+0x19b>
+  800591:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800595:	75 0b                	jne    8005a2 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800597:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80059a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80059d:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a0:	eb 5c                	jmp    8005fe <vprintfmt+0x202>
+  8005a2:	83 ec 08             	sub    $0x8,%esp
+  8005a5:	ff 75 d0             	push   -0x30(%ebp)
+  8005a8:	ff 75 cc             	push   -0x34(%ebp)
+  8005ab:	e8 20 03 00 00       	call   8008d0 <strnlen>
+  8005b0:	89 c2                	mov    %eax,%edx
+  8005b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b5:	29 d0                	sub    %edx,%eax
+  8005b7:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005ba:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c4:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c6:	eb 0e                	jmp    8005d6 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005c8:	83 ec 08             	sub    $0x8,%esp
+  8005cb:	53                   	push   %ebx
+  8005cc:	57                   	push   %edi
+  8005cd:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d0:	83 ee 01             	sub    $0x1,%esi
+  8005d3:	83 c4 10             	add    $0x10,%esp
+  8005d6:	85 f6                	test   %esi,%esi
+  8005d8:	7f ee                	jg     8005c8 <vprintfmt+0x1cc>
+  8005da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e0:	85 c0                	test   %eax,%eax
+  8005e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005e7:	0f 49 d0             	cmovns %eax,%edx
+  8005ea:	29 d0                	sub    %edx,%eax
+  8005ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ef:	eb a6                	jmp    800597 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005f1:	83 ec 08             	sub    $0x8,%esp
+  8005f4:	53                   	push   %ebx
+  8005f5:	52                   	push   %edx
+  8005f6:	ff 55 08             	call   *0x8(%ebp)
+  8005f9:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005fc:	89 f1                	mov    %esi,%ecx
+  8005fe:	8d 71 01             	lea    0x1(%ecx),%esi
+  800601:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800605:	0f be d0             	movsbl %al,%edx
+  800608:	85 d2                	test   %edx,%edx
+  80060a:	74 28                	je     800634 <vprintfmt+0x238>
+  80060c:	85 ff                	test   %edi,%edi
+  80060e:	78 05                	js     800615 <vprintfmt+0x219>
+  800610:	83 ef 01             	sub    $0x1,%edi
+  800613:	78 30                	js     800645 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800615:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800619:	74 d6                	je     8005f1 <vprintfmt+0x1f5>
+  80061b:	0f be c0             	movsbl %al,%eax
+  80061e:	83 e8 20             	sub    $0x20,%eax
+  800621:	83 f8 5e             	cmp    $0x5e,%eax
+  800624:	76 cb                	jbe    8005f1 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800626:	83 ec 08             	sub    $0x8,%esp
+  800629:	53                   	push   %ebx
+  80062a:	6a 3f                	push   $0x3f
+  80062c:	ff 55 08             	call   *0x8(%ebp)
+  80062f:	83 c4 10             	add    $0x10,%esp
+  800632:	eb c8                	jmp    8005fc <vprintfmt+0x200>
+  800634:	8b 75 08             	mov    0x8(%ebp),%esi
+  800637:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80063a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80063d:	01 d0                	add    %edx,%eax
+  80063f:	29 c8                	sub    %ecx,%eax
+  800641:	89 c7                	mov    %eax,%edi
+  800643:	eb 13                	jmp    800658 <vprintfmt+0x25c>
+  800645:	8b 75 08             	mov    0x8(%ebp),%esi
+  800648:	eb ed                	jmp    800637 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80064a:	83 ec 08             	sub    $0x8,%esp
+  80064d:	53                   	push   %ebx
+  80064e:	6a 20                	push   $0x20
+  800650:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800652:	83 ef 01             	sub    $0x1,%edi
+  800655:	83 c4 10             	add    $0x10,%esp
+  800658:	85 ff                	test   %edi,%edi
+  80065a:	7f ee                	jg     80064a <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80065c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80065f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800662:	e9 6b 01 00 00       	jmp    8007d2 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800667:	83 f9 01             	cmp    $0x1,%ecx
+  80066a:	7f 1f                	jg     80068b <vprintfmt+0x28f>
+	else if (lflag)
+  80066c:	85 c9                	test   %ecx,%ecx
+  80066e:	74 67                	je     8006d7 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	8b 00                	mov    (%eax),%eax
+  800675:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800678:	89 c1                	mov    %eax,%ecx
+  80067a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80067d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8d 40 04             	lea    0x4(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+  800689:	eb 17                	jmp    8006a2 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 50 04             	mov    0x4(%eax),%edx
+  800691:	8b 00                	mov    (%eax),%eax
+  800693:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800696:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800699:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069c:	8d 40 08             	lea    0x8(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006a8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006ad:	85 c9                	test   %ecx,%ecx
+  8006af:	0f 89 03 01 00 00    	jns    8007b8 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006b5:	83 ec 08             	sub    $0x8,%esp
+  8006b8:	53                   	push   %ebx
+  8006b9:	6a 2d                	push   $0x2d
+  8006bb:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006bd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006c3:	f7 da                	neg    %edx
+  8006c5:	83 d1 00             	adc    $0x0,%ecx
+  8006c8:	f7 d9                	neg    %ecx
+  8006ca:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006cd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d2:	e9 e1 00 00 00       	jmp    8007b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006da:	8b 00                	mov    (%eax),%eax
+  8006dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006df:	89 c1                	mov    %eax,%ecx
+  8006e1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006e4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f0:	eb b0                	jmp    8006a2 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006f2:	83 f9 01             	cmp    $0x1,%ecx
+  8006f5:	7f 1e                	jg     800715 <vprintfmt+0x319>
+	else if (lflag)
+  8006f7:	85 c9                	test   %ecx,%ecx
+  8006f9:	74 32                	je     80072d <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8006fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fe:	8b 10                	mov    (%eax),%edx
+  800700:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800705:	8d 40 04             	lea    0x4(%eax),%eax
+  800708:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800710:	e9 a3 00 00 00       	jmp    8007b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800715:	8b 45 14             	mov    0x14(%ebp),%eax
+  800718:	8b 10                	mov    (%eax),%edx
+  80071a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80071d:	8d 40 08             	lea    0x8(%eax),%eax
+  800720:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800723:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800728:	e9 8b 00 00 00       	jmp    8007b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80072d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800730:	8b 10                	mov    (%eax),%edx
+  800732:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800737:	8d 40 04             	lea    0x4(%eax),%eax
+  80073a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80073d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800742:	eb 74                	jmp    8007b8 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800744:	83 f9 01             	cmp    $0x1,%ecx
+  800747:	7f 1b                	jg     800764 <vprintfmt+0x368>
+	else if (lflag)
+  800749:	85 c9                	test   %ecx,%ecx
+  80074b:	74 2c                	je     800779 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80074d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800750:	8b 10                	mov    (%eax),%edx
+  800752:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800757:	8d 40 04             	lea    0x4(%eax),%eax
+  80075a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80075d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800762:	eb 54                	jmp    8007b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800764:	8b 45 14             	mov    0x14(%ebp),%eax
+  800767:	8b 10                	mov    (%eax),%edx
+  800769:	8b 48 04             	mov    0x4(%eax),%ecx
+  80076c:	8d 40 08             	lea    0x8(%eax),%eax
+  80076f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800772:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800777:	eb 3f                	jmp    8007b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077c:	8b 10                	mov    (%eax),%edx
+  80077e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800783:	8d 40 04             	lea    0x4(%eax),%eax
+  800786:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800789:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80078e:	eb 28                	jmp    8007b8 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800790:	83 ec 08             	sub    $0x8,%esp
+  800793:	53                   	push   %ebx
+  800794:	6a 30                	push   $0x30
+  800796:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800798:	83 c4 08             	add    $0x8,%esp
+  80079b:	53                   	push   %ebx
+  80079c:	6a 78                	push   $0x78
+  80079e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a3:	8b 10                	mov    (%eax),%edx
+  8007a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007aa:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b3:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007b8:	83 ec 0c             	sub    $0xc,%esp
+  8007bb:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007bf:	50                   	push   %eax
+  8007c0:	ff 75 e0             	push   -0x20(%ebp)
+  8007c3:	57                   	push   %edi
+  8007c4:	51                   	push   %ecx
+  8007c5:	52                   	push   %edx
+  8007c6:	89 da                	mov    %ebx,%edx
+  8007c8:	89 f0                	mov    %esi,%eax
+  8007ca:	e8 4a fb ff ff       	call   800319 <printnum>
+			break;
+  8007cf:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007d5:	e9 40 fc ff ff       	jmp    80041a <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007da:	83 f9 01             	cmp    $0x1,%ecx
+  8007dd:	7f 1b                	jg     8007fa <vprintfmt+0x3fe>
+	else if (lflag)
+  8007df:	85 c9                	test   %ecx,%ecx
+  8007e1:	74 2c                	je     80080f <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e6:	8b 10                	mov    (%eax),%edx
+  8007e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007f8:	eb be                	jmp    8007b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fd:	8b 10                	mov    (%eax),%edx
+  8007ff:	8b 48 04             	mov    0x4(%eax),%ecx
+  800802:	8d 40 08             	lea    0x8(%eax),%eax
+  800805:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800808:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80080d:	eb a9                	jmp    8007b8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80080f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800812:	8b 10                	mov    (%eax),%edx
+  800814:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800819:	8d 40 04             	lea    0x4(%eax),%eax
+  80081c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80081f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800824:	eb 92                	jmp    8007b8 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800826:	83 ec 08             	sub    $0x8,%esp
+  800829:	53                   	push   %ebx
+  80082a:	6a 25                	push   $0x25
+  80082c:	ff d6                	call   *%esi
+			break;
+  80082e:	83 c4 10             	add    $0x10,%esp
+  800831:	eb 9f                	jmp    8007d2 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800833:	83 ec 08             	sub    $0x8,%esp
+  800836:	53                   	push   %ebx
+  800837:	6a 25                	push   $0x25
+  800839:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80083b:	83 c4 10             	add    $0x10,%esp
+  80083e:	89 f8                	mov    %edi,%eax
+  800840:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800844:	74 05                	je     80084b <vprintfmt+0x44f>
+  800846:	83 e8 01             	sub    $0x1,%eax
+  800849:	eb f5                	jmp    800840 <vprintfmt+0x444>
+  80084b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80084e:	eb 82                	jmp    8007d2 <vprintfmt+0x3d6>
+
+00800850 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800850:	55                   	push   %ebp
+  800851:	89 e5                	mov    %esp,%ebp
+  800853:	83 ec 18             	sub    $0x18,%esp
+  800856:	8b 45 08             	mov    0x8(%ebp),%eax
+  800859:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80085c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80085f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800863:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800866:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80086d:	85 c0                	test   %eax,%eax
+  80086f:	74 26                	je     800897 <vsnprintf+0x47>
+  800871:	85 d2                	test   %edx,%edx
+  800873:	7e 22                	jle    800897 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800875:	ff 75 14             	push   0x14(%ebp)
+  800878:	ff 75 10             	push   0x10(%ebp)
+  80087b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80087e:	50                   	push   %eax
+  80087f:	68 c2 03 80 00       	push   $0x8003c2
+  800884:	e8 73 fb ff ff       	call   8003fc <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800889:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80088c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80088f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800892:	83 c4 10             	add    $0x10,%esp
+}
+  800895:	c9                   	leave
+  800896:	c3                   	ret
+		return -E_INVAL;
+  800897:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80089c:	eb f7                	jmp    800895 <vsnprintf+0x45>
+
+0080089e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80089e:	55                   	push   %ebp
+  80089f:	89 e5                	mov    %esp,%ebp
+  8008a1:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008a4:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008a7:	50                   	push   %eax
+  8008a8:	ff 75 10             	push   0x10(%ebp)
+  8008ab:	ff 75 0c             	push   0xc(%ebp)
+  8008ae:	ff 75 08             	push   0x8(%ebp)
+  8008b1:	e8 9a ff ff ff       	call   800850 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008b6:	c9                   	leave
+  8008b7:	c3                   	ret
+
+008008b8 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008b8:	55                   	push   %ebp
+  8008b9:	89 e5                	mov    %esp,%ebp
+  8008bb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c3:	eb 03                	jmp    8008c8 <strlen+0x10>
+		n++;
+  8008c5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008c8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008cc:	75 f7                	jne    8008c5 <strlen+0xd>
+	return n;
+}
+  8008ce:	5d                   	pop    %ebp
+  8008cf:	c3                   	ret
+
+008008d0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008d0:	55                   	push   %ebp
+  8008d1:	89 e5                	mov    %esp,%ebp
+  8008d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008de:	eb 03                	jmp    8008e3 <strnlen+0x13>
+		n++;
+  8008e0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e3:	39 d0                	cmp    %edx,%eax
+  8008e5:	74 08                	je     8008ef <strnlen+0x1f>
+  8008e7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008eb:	75 f3                	jne    8008e0 <strnlen+0x10>
+  8008ed:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008ef:	89 d0                	mov    %edx,%eax
+  8008f1:	5d                   	pop    %ebp
+  8008f2:	c3                   	ret
+
+008008f3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008f3:	55                   	push   %ebp
+  8008f4:	89 e5                	mov    %esp,%ebp
+  8008f6:	53                   	push   %ebx
+  8008f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800902:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800906:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800909:	83 c0 01             	add    $0x1,%eax
+  80090c:	84 d2                	test   %dl,%dl
+  80090e:	75 f2                	jne    800902 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800910:	89 c8                	mov    %ecx,%eax
+  800912:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800915:	c9                   	leave
+  800916:	c3                   	ret
+
+00800917 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	53                   	push   %ebx
+  80091b:	83 ec 10             	sub    $0x10,%esp
+  80091e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800921:	53                   	push   %ebx
+  800922:	e8 91 ff ff ff       	call   8008b8 <strlen>
+  800927:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80092a:	ff 75 0c             	push   0xc(%ebp)
+  80092d:	01 d8                	add    %ebx,%eax
+  80092f:	50                   	push   %eax
+  800930:	e8 be ff ff ff       	call   8008f3 <strcpy>
+	return dst;
+}
+  800935:	89 d8                	mov    %ebx,%eax
+  800937:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093a:	c9                   	leave
+  80093b:	c3                   	ret
+
+0080093c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80093c:	55                   	push   %ebp
+  80093d:	89 e5                	mov    %esp,%ebp
+  80093f:	56                   	push   %esi
+  800940:	53                   	push   %ebx
+  800941:	8b 75 08             	mov    0x8(%ebp),%esi
+  800944:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800947:	89 f3                	mov    %esi,%ebx
+  800949:	03 5d 10             	add    0x10(%ebp),%ebx
+  80094c:	89 f0                	mov    %esi,%eax
+  80094e:	eb 0f                	jmp    80095f <strncpy+0x23>
+		*dst++ = *src;
+  800950:	83 c0 01             	add    $0x1,%eax
+  800953:	0f b6 0a             	movzbl (%edx),%ecx
+  800956:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800959:	80 f9 01             	cmp    $0x1,%cl
+  80095c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80095f:	39 d8                	cmp    %ebx,%eax
+  800961:	75 ed                	jne    800950 <strncpy+0x14>
+	}
+	return ret;
+}
+  800963:	89 f0                	mov    %esi,%eax
+  800965:	5b                   	pop    %ebx
+  800966:	5e                   	pop    %esi
+  800967:	5d                   	pop    %ebp
+  800968:	c3                   	ret
+
+00800969 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800969:	55                   	push   %ebp
+  80096a:	89 e5                	mov    %esp,%ebp
+  80096c:	56                   	push   %esi
+  80096d:	53                   	push   %ebx
+  80096e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800971:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800974:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800977:	89 f0                	mov    %esi,%eax
+  800979:	85 d2                	test   %edx,%edx
+  80097b:	74 21                	je     80099e <strlcpy+0x35>
+  80097d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800981:	89 f2                	mov    %esi,%edx
+  800983:	eb 09                	jmp    80098e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800985:	83 c1 01             	add    $0x1,%ecx
+  800988:	83 c2 01             	add    $0x1,%edx
+  80098b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80098e:	39 c2                	cmp    %eax,%edx
+  800990:	74 09                	je     80099b <strlcpy+0x32>
+  800992:	0f b6 19             	movzbl (%ecx),%ebx
+  800995:	84 db                	test   %bl,%bl
+  800997:	75 ec                	jne    800985 <strlcpy+0x1c>
+  800999:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80099b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80099e:	29 f0                	sub    %esi,%eax
+}
+  8009a0:	5b                   	pop    %ebx
+  8009a1:	5e                   	pop    %esi
+  8009a2:	5d                   	pop    %ebp
+  8009a3:	c3                   	ret
+
+008009a4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a4:	55                   	push   %ebp
+  8009a5:	89 e5                	mov    %esp,%ebp
+  8009a7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ad:	eb 06                	jmp    8009b5 <strcmp+0x11>
+		p++, q++;
+  8009af:	83 c1 01             	add    $0x1,%ecx
+  8009b2:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009b5:	0f b6 01             	movzbl (%ecx),%eax
+  8009b8:	84 c0                	test   %al,%al
+  8009ba:	74 04                	je     8009c0 <strcmp+0x1c>
+  8009bc:	3a 02                	cmp    (%edx),%al
+  8009be:	74 ef                	je     8009af <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c0:	0f b6 c0             	movzbl %al,%eax
+  8009c3:	0f b6 12             	movzbl (%edx),%edx
+  8009c6:	29 d0                	sub    %edx,%eax
+}
+  8009c8:	5d                   	pop    %ebp
+  8009c9:	c3                   	ret
+
+008009ca <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009ca:	55                   	push   %ebp
+  8009cb:	89 e5                	mov    %esp,%ebp
+  8009cd:	53                   	push   %ebx
+  8009ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009d7:	eb 09                	jmp    8009e2 <strncmp+0x18>
+		n--, p++, q++;
+  8009d9:	83 ea 01             	sub    $0x1,%edx
+  8009dc:	83 c0 01             	add    $0x1,%eax
+  8009df:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009e2:	85 d2                	test   %edx,%edx
+  8009e4:	74 18                	je     8009fe <strncmp+0x34>
+  8009e6:	0f b6 18             	movzbl (%eax),%ebx
+  8009e9:	84 db                	test   %bl,%bl
+  8009eb:	74 04                	je     8009f1 <strncmp+0x27>
+  8009ed:	3a 19                	cmp    (%ecx),%bl
+  8009ef:	74 e8                	je     8009d9 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f1:	0f b6 00             	movzbl (%eax),%eax
+  8009f4:	0f b6 11             	movzbl (%ecx),%edx
+  8009f7:	29 d0                	sub    %edx,%eax
+}
+  8009f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009fc:	c9                   	leave
+  8009fd:	c3                   	ret
+		return 0;
+  8009fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a03:	eb f4                	jmp    8009f9 <strncmp+0x2f>
+
+00800a05 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a0f:	eb 03                	jmp    800a14 <strchr+0xf>
+  800a11:	83 c0 01             	add    $0x1,%eax
+  800a14:	0f b6 10             	movzbl (%eax),%edx
+  800a17:	84 d2                	test   %dl,%dl
+  800a19:	74 06                	je     800a21 <strchr+0x1c>
+		if (*s == c)
+  800a1b:	38 ca                	cmp    %cl,%dl
+  800a1d:	75 f2                	jne    800a11 <strchr+0xc>
+  800a1f:	eb 05                	jmp    800a26 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a26:	5d                   	pop    %ebp
+  800a27:	c3                   	ret
+
+00800a28 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a28:	55                   	push   %ebp
+  800a29:	89 e5                	mov    %esp,%ebp
+  800a2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a32:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a35:	38 ca                	cmp    %cl,%dl
+  800a37:	74 09                	je     800a42 <strfind+0x1a>
+  800a39:	84 d2                	test   %dl,%dl
+  800a3b:	74 05                	je     800a42 <strfind+0x1a>
+	for (; *s; s++)
+  800a3d:	83 c0 01             	add    $0x1,%eax
+  800a40:	eb f0                	jmp    800a32 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a42:	5d                   	pop    %ebp
+  800a43:	c3                   	ret
+
+00800a44 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a44:	55                   	push   %ebp
+  800a45:	89 e5                	mov    %esp,%ebp
+  800a47:	57                   	push   %edi
+  800a48:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a4b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a4e:	85 c9                	test   %ecx,%ecx
+  800a50:	74 20                	je     800a72 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a52:	89 f8                	mov    %edi,%eax
+  800a54:	09 c8                	or     %ecx,%eax
+  800a56:	a8 03                	test   $0x3,%al
+  800a58:	75 12                	jne    800a6c <memset+0x28>
+		c &= 0xFF;
+  800a5a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a5e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a64:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a67:	fc                   	cld
+  800a68:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a6a:	eb 06                	jmp    800a72 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a6f:	fc                   	cld
+  800a70:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a72:	89 f8                	mov    %edi,%eax
+  800a74:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a77:	c9                   	leave
+  800a78:	c3                   	ret
+
+00800a79 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a79:	55                   	push   %ebp
+  800a7a:	89 e5                	mov    %esp,%ebp
+  800a7c:	57                   	push   %edi
+  800a7d:	56                   	push   %esi
+  800a7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a81:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a84:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a87:	39 c6                	cmp    %eax,%esi
+  800a89:	73 32                	jae    800abd <memmove+0x44>
+  800a8b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a8e:	39 d0                	cmp    %edx,%eax
+  800a90:	73 2b                	jae    800abd <memmove+0x44>
+		s += n;
+		d += n;
+  800a92:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a95:	89 d6                	mov    %edx,%esi
+  800a97:	09 fe                	or     %edi,%esi
+  800a99:	09 ce                	or     %ecx,%esi
+  800a9b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aa1:	75 0e                	jne    800ab1 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800aa3:	83 ef 04             	sub    $0x4,%edi
+  800aa6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aa9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aac:	fd                   	std
+  800aad:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aaf:	eb 09                	jmp    800aba <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ab1:	83 ef 01             	sub    $0x1,%edi
+  800ab4:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ab7:	fd                   	std
+  800ab8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800aba:	fc                   	cld
+  800abb:	eb 1a                	jmp    800ad7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800abd:	89 f2                	mov    %esi,%edx
+  800abf:	09 c2                	or     %eax,%edx
+  800ac1:	09 ca                	or     %ecx,%edx
+  800ac3:	f6 c2 03             	test   $0x3,%dl
+  800ac6:	75 0a                	jne    800ad2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ac8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800acb:	89 c7                	mov    %eax,%edi
+  800acd:	fc                   	cld
+  800ace:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad0:	eb 05                	jmp    800ad7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ad2:	89 c7                	mov    %eax,%edi
+  800ad4:	fc                   	cld
+  800ad5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ad7:	5e                   	pop    %esi
+  800ad8:	5f                   	pop    %edi
+  800ad9:	5d                   	pop    %ebp
+  800ada:	c3                   	ret
+
+00800adb <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800adb:	55                   	push   %ebp
+  800adc:	89 e5                	mov    %esp,%ebp
+  800ade:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ae1:	ff 75 10             	push   0x10(%ebp)
+  800ae4:	ff 75 0c             	push   0xc(%ebp)
+  800ae7:	ff 75 08             	push   0x8(%ebp)
+  800aea:	e8 8a ff ff ff       	call   800a79 <memmove>
+}
+  800aef:	c9                   	leave
+  800af0:	c3                   	ret
+
+00800af1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800af1:	55                   	push   %ebp
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	56                   	push   %esi
+  800af5:	53                   	push   %ebx
+  800af6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800afc:	89 c6                	mov    %eax,%esi
+  800afe:	03 75 10             	add    0x10(%ebp),%esi
+  800b01:	eb 06                	jmp    800b09 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b03:	83 c0 01             	add    $0x1,%eax
+  800b06:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b09:	39 f0                	cmp    %esi,%eax
+  800b0b:	74 14                	je     800b21 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b0d:	0f b6 08             	movzbl (%eax),%ecx
+  800b10:	0f b6 1a             	movzbl (%edx),%ebx
+  800b13:	38 d9                	cmp    %bl,%cl
+  800b15:	74 ec                	je     800b03 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b17:	0f b6 c1             	movzbl %cl,%eax
+  800b1a:	0f b6 db             	movzbl %bl,%ebx
+  800b1d:	29 d8                	sub    %ebx,%eax
+  800b1f:	eb 05                	jmp    800b26 <memcmp+0x35>
+	}
+
+	return 0;
+  800b21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b26:	5b                   	pop    %ebx
+  800b27:	5e                   	pop    %esi
+  800b28:	5d                   	pop    %ebp
+  800b29:	c3                   	ret
+
+00800b2a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b33:	89 c2                	mov    %eax,%edx
+  800b35:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b38:	eb 03                	jmp    800b3d <memfind+0x13>
+  800b3a:	83 c0 01             	add    $0x1,%eax
+  800b3d:	39 d0                	cmp    %edx,%eax
+  800b3f:	73 04                	jae    800b45 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b41:	38 08                	cmp    %cl,(%eax)
+  800b43:	75 f5                	jne    800b3a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b45:	5d                   	pop    %ebp
+  800b46:	c3                   	ret
+
+00800b47 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b47:	55                   	push   %ebp
+  800b48:	89 e5                	mov    %esp,%ebp
+  800b4a:	57                   	push   %edi
+  800b4b:	56                   	push   %esi
+  800b4c:	53                   	push   %ebx
+  800b4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b53:	eb 03                	jmp    800b58 <strtol+0x11>
+		s++;
+  800b55:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b58:	0f b6 02             	movzbl (%edx),%eax
+  800b5b:	3c 20                	cmp    $0x20,%al
+  800b5d:	74 f6                	je     800b55 <strtol+0xe>
+  800b5f:	3c 09                	cmp    $0x9,%al
+  800b61:	74 f2                	je     800b55 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b63:	3c 2b                	cmp    $0x2b,%al
+  800b65:	74 2a                	je     800b91 <strtol+0x4a>
+	int neg = 0;
+  800b67:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b6c:	3c 2d                	cmp    $0x2d,%al
+  800b6e:	74 2b                	je     800b9b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b70:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b76:	75 0f                	jne    800b87 <strtol+0x40>
+  800b78:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b7b:	74 28                	je     800ba5 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b7d:	85 db                	test   %ebx,%ebx
+  800b7f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b84:	0f 44 d8             	cmove  %eax,%ebx
+  800b87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b8f:	eb 46                	jmp    800bd7 <strtol+0x90>
+		s++;
+  800b91:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b94:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b99:	eb d5                	jmp    800b70 <strtol+0x29>
+		s++, neg = 1;
+  800b9b:	83 c2 01             	add    $0x1,%edx
+  800b9e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ba3:	eb cb                	jmp    800b70 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba5:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ba9:	74 0e                	je     800bb9 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bab:	85 db                	test   %ebx,%ebx
+  800bad:	75 d8                	jne    800b87 <strtol+0x40>
+		s++, base = 8;
+  800baf:	83 c2 01             	add    $0x1,%edx
+  800bb2:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bb7:	eb ce                	jmp    800b87 <strtol+0x40>
+		s += 2, base = 16;
+  800bb9:	83 c2 02             	add    $0x2,%edx
+  800bbc:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bc1:	eb c4                	jmp    800b87 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bc3:	0f be c0             	movsbl %al,%eax
+  800bc6:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bc9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bcc:	7d 3a                	jge    800c08 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bce:	83 c2 01             	add    $0x1,%edx
+  800bd1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bd5:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bd7:	0f b6 02             	movzbl (%edx),%eax
+  800bda:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bdd:	89 f3                	mov    %esi,%ebx
+  800bdf:	80 fb 09             	cmp    $0x9,%bl
+  800be2:	76 df                	jbe    800bc3 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800be4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800be7:	89 f3                	mov    %esi,%ebx
+  800be9:	80 fb 19             	cmp    $0x19,%bl
+  800bec:	77 08                	ja     800bf6 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bee:	0f be c0             	movsbl %al,%eax
+  800bf1:	83 e8 57             	sub    $0x57,%eax
+  800bf4:	eb d3                	jmp    800bc9 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bf6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bf9:	89 f3                	mov    %esi,%ebx
+  800bfb:	80 fb 19             	cmp    $0x19,%bl
+  800bfe:	77 08                	ja     800c08 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c00:	0f be c0             	movsbl %al,%eax
+  800c03:	83 e8 37             	sub    $0x37,%eax
+  800c06:	eb c1                	jmp    800bc9 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c08:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c0c:	74 05                	je     800c13 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c11:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c13:	89 c8                	mov    %ecx,%eax
+  800c15:	f7 d8                	neg    %eax
+  800c17:	85 ff                	test   %edi,%edi
+  800c19:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c1c:	89 c8                	mov    %ecx,%eax
+  800c1e:	5b                   	pop    %ebx
+  800c1f:	5e                   	pop    %esi
+  800c20:	5f                   	pop    %edi
+  800c21:	5d                   	pop    %ebp
+  800c22:	c3                   	ret
+
+00800c23 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c23:	55                   	push   %ebp
+  800c24:	89 e5                	mov    %esp,%ebp
+  800c26:	57                   	push   %edi
+  800c27:	56                   	push   %esi
+  800c28:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c34:	89 c3                	mov    %eax,%ebx
+  800c36:	89 c7                	mov    %eax,%edi
+  800c38:	89 c6                	mov    %eax,%esi
+  800c3a:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c3c:	5b                   	pop    %ebx
+  800c3d:	5e                   	pop    %esi
+  800c3e:	5f                   	pop    %edi
+  800c3f:	5d                   	pop    %ebp
+  800c40:	c3                   	ret
+
+00800c41 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c41:	55                   	push   %ebp
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	57                   	push   %edi
+  800c45:	56                   	push   %esi
+  800c46:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c51:	89 d1                	mov    %edx,%ecx
+  800c53:	89 d3                	mov    %edx,%ebx
+  800c55:	89 d7                	mov    %edx,%edi
+  800c57:	89 d6                	mov    %edx,%esi
+  800c59:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c5b:	5b                   	pop    %ebx
+  800c5c:	5e                   	pop    %esi
+  800c5d:	5f                   	pop    %edi
+  800c5e:	5d                   	pop    %ebp
+  800c5f:	c3                   	ret
+
+00800c60 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800c60:	55                   	push   %ebp
+  800c61:	89 e5                	mov    %esp,%ebp
+  800c63:	57                   	push   %edi
+  800c64:	56                   	push   %esi
+  800c65:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c73:	89 cb                	mov    %ecx,%ebx
+  800c75:	89 cf                	mov    %ecx,%edi
+  800c77:	89 ce                	mov    %ecx,%esi
+  800c79:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800c7b:	5b                   	pop    %ebx
+  800c7c:	5e                   	pop    %esi
+  800c7d:	5f                   	pop    %edi
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+
+00800c80 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	57                   	push   %edi
+  800c84:	56                   	push   %esi
+  800c85:	53                   	push   %ebx
+  800c86:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c91:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c96:	89 cb                	mov    %ecx,%ebx
+  800c98:	89 cf                	mov    %ecx,%edi
+  800c9a:	89 ce                	mov    %ecx,%esi
+  800c9c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c9e:	85 c0                	test   %eax,%eax
+  800ca0:	7f 08                	jg     800caa <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ca2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca5:	5b                   	pop    %ebx
+  800ca6:	5e                   	pop    %esi
+  800ca7:	5f                   	pop    %edi
+  800ca8:	5d                   	pop    %ebp
+  800ca9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800caa:	83 ec 0c             	sub    $0xc,%esp
+  800cad:	50                   	push   %eax
+  800cae:	6a 03                	push   $0x3
+  800cb0:	68 9f 30 80 00       	push   $0x80309f
+  800cb5:	6a 23                	push   $0x23
+  800cb7:	68 bc 30 80 00       	push   $0x8030bc
+  800cbc:	e8 69 f5 ff ff       	call   80022a <_panic>
+
+00800cc1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cc1:	55                   	push   %ebp
+  800cc2:	89 e5                	mov    %esp,%ebp
+  800cc4:	57                   	push   %edi
+  800cc5:	56                   	push   %esi
+  800cc6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccc:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd1:	89 d1                	mov    %edx,%ecx
+  800cd3:	89 d3                	mov    %edx,%ebx
+  800cd5:	89 d7                	mov    %edx,%edi
+  800cd7:	89 d6                	mov    %edx,%esi
+  800cd9:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cdb:	5b                   	pop    %ebx
+  800cdc:	5e                   	pop    %esi
+  800cdd:	5f                   	pop    %edi
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+
+00800ce0 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	57                   	push   %edi
+  800ce4:	56                   	push   %esi
+  800ce5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ce6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ceb:	b8 16 00 00 00       	mov    $0x16,%eax
+  800cf0:	89 d1                	mov    %edx,%ecx
+  800cf2:	89 d3                	mov    %edx,%ebx
+  800cf4:	89 d7                	mov    %edx,%edi
+  800cf6:	89 d6                	mov    %edx,%esi
+  800cf8:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cfa:	5b                   	pop    %ebx
+  800cfb:	5e                   	pop    %esi
+  800cfc:	5f                   	pop    %edi
+  800cfd:	5d                   	pop    %ebp
+  800cfe:	c3                   	ret
+
+00800cff <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800cff:	55                   	push   %ebp
+  800d00:	89 e5                	mov    %esp,%ebp
+  800d02:	57                   	push   %edi
+  800d03:	56                   	push   %esi
+  800d04:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d05:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d0a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d0f:	89 d1                	mov    %edx,%ecx
+  800d11:	89 d3                	mov    %edx,%ebx
+  800d13:	89 d7                	mov    %edx,%edi
+  800d15:	89 d6                	mov    %edx,%esi
+  800d17:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800d19:	5b                   	pop    %ebx
+  800d1a:	5e                   	pop    %esi
+  800d1b:	5f                   	pop    %edi
+  800d1c:	5d                   	pop    %ebp
+  800d1d:	c3                   	ret
+
+00800d1e <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800d1e:	55                   	push   %ebp
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	57                   	push   %edi
+  800d22:	56                   	push   %esi
+  800d23:	53                   	push   %ebx
+  800d24:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d32:	b8 15 00 00 00       	mov    $0x15,%eax
+  800d37:	89 df                	mov    %ebx,%edi
+  800d39:	89 de                	mov    %ebx,%esi
+  800d3b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d3d:	85 c0                	test   %eax,%eax
+  800d3f:	7f 08                	jg     800d49 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800d41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d44:	5b                   	pop    %ebx
+  800d45:	5e                   	pop    %esi
+  800d46:	5f                   	pop    %edi
+  800d47:	5d                   	pop    %ebp
+  800d48:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d49:	83 ec 0c             	sub    $0xc,%esp
+  800d4c:	50                   	push   %eax
+  800d4d:	6a 15                	push   $0x15
+  800d4f:	68 9f 30 80 00       	push   $0x80309f
+  800d54:	6a 23                	push   $0x23
+  800d56:	68 bc 30 80 00       	push   $0x8030bc
+  800d5b:	e8 ca f4 ff ff       	call   80022a <_panic>
+
+00800d60 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d60:	55                   	push   %ebp
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	57                   	push   %edi
+  800d64:	56                   	push   %esi
+  800d65:	53                   	push   %ebx
+  800d66:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d69:	be 00 00 00 00       	mov    $0x0,%esi
+  800d6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d74:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7c:	89 f7                	mov    %esi,%edi
+  800d7e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d80:	85 c0                	test   %eax,%eax
+  800d82:	7f 08                	jg     800d8c <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d87:	5b                   	pop    %ebx
+  800d88:	5e                   	pop    %esi
+  800d89:	5f                   	pop    %edi
+  800d8a:	5d                   	pop    %ebp
+  800d8b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8c:	83 ec 0c             	sub    $0xc,%esp
+  800d8f:	50                   	push   %eax
+  800d90:	6a 05                	push   $0x5
+  800d92:	68 9f 30 80 00       	push   $0x80309f
+  800d97:	6a 23                	push   $0x23
+  800d99:	68 bc 30 80 00       	push   $0x8030bc
+  800d9e:	e8 87 f4 ff ff       	call   80022a <_panic>
+
+00800da3 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800da3:	55                   	push   %ebp
+  800da4:	89 e5                	mov    %esp,%ebp
+  800da6:	57                   	push   %edi
+  800da7:	56                   	push   %esi
+  800da8:	53                   	push   %ebx
+  800da9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dac:	be 00 00 00 00       	mov    $0x0,%esi
+  800db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dbc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbf:	89 f7                	mov    %esi,%edi
+  800dc1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc3:	85 c0                	test   %eax,%eax
+  800dc5:	7f 08                	jg     800dcf <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dca:	5b                   	pop    %ebx
+  800dcb:	5e                   	pop    %esi
+  800dcc:	5f                   	pop    %edi
+  800dcd:	5d                   	pop    %ebp
+  800dce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dcf:	83 ec 0c             	sub    $0xc,%esp
+  800dd2:	50                   	push   %eax
+  800dd3:	6a 06                	push   $0x6
+  800dd5:	68 9f 30 80 00       	push   $0x80309f
+  800dda:	6a 23                	push   $0x23
+  800ddc:	68 bc 30 80 00       	push   $0x8030bc
+  800de1:	e8 44 f4 ff ff       	call   80022a <_panic>
+
+00800de6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800de6:	55                   	push   %ebp
+  800de7:	89 e5                	mov    %esp,%ebp
+  800de9:	57                   	push   %edi
+  800dea:	56                   	push   %esi
+  800deb:	53                   	push   %ebx
+  800dec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800def:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df5:	b8 07 00 00 00       	mov    $0x7,%eax
+  800dfa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e00:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e03:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e05:	85 c0                	test   %eax,%eax
+  800e07:	7f 08                	jg     800e11 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5f                   	pop    %edi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e11:	83 ec 0c             	sub    $0xc,%esp
+  800e14:	50                   	push   %eax
+  800e15:	6a 07                	push   $0x7
+  800e17:	68 9f 30 80 00       	push   $0x80309f
+  800e1c:	6a 23                	push   $0x23
+  800e1e:	68 bc 30 80 00       	push   $0x8030bc
+  800e23:	e8 02 f4 ff ff       	call   80022a <_panic>
+
+00800e28 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e28:	55                   	push   %ebp
+  800e29:	89 e5                	mov    %esp,%ebp
+  800e2b:	57                   	push   %edi
+  800e2c:	56                   	push   %esi
+  800e2d:	53                   	push   %ebx
+  800e2e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e41:	89 df                	mov    %ebx,%edi
+  800e43:	89 de                	mov    %ebx,%esi
+  800e45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	7f 08                	jg     800e53 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  800e56:	50                   	push   %eax
+  800e57:	6a 08                	push   $0x8
+  800e59:	68 9f 30 80 00       	push   $0x80309f
+  800e5e:	6a 23                	push   $0x23
+  800e60:	68 bc 30 80 00       	push   $0x8030bc
+  800e65:	e8 c0 f3 ff ff       	call   80022a <_panic>
+
+00800e6a <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	57                   	push   %edi
+  800e6e:	56                   	push   %esi
+  800e6f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e76:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e7b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e83:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e86:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e88:	5b                   	pop    %ebx
+  800e89:	5e                   	pop    %esi
+  800e8a:	5f                   	pop    %edi
+  800e8b:	5d                   	pop    %ebp
+  800e8c:	c3                   	ret
+
+00800e8d <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e8d:	55                   	push   %ebp
+  800e8e:	89 e5                	mov    %esp,%ebp
+  800e90:	57                   	push   %edi
+  800e91:	56                   	push   %esi
+  800e92:	53                   	push   %ebx
+  800e93:	8b 45 18             	mov    0x18(%ebp),%eax
+  800e96:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800e99:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800e9e:	77 27                	ja     800ec7 <sys_page_map_range+0x3a>
+  800ea0:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800ea6:	77 1f                	ja     800ec7 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800ea8:	c1 e0 0c             	shl    $0xc,%eax
+  800eab:	89 c6                	mov    %eax,%esi
+  800ead:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800eaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec0:	cd 30                	int    $0x30
+}
+  800ec2:	5b                   	pop    %ebx
+  800ec3:	5e                   	pop    %esi
+  800ec4:	5f                   	pop    %edi
+  800ec5:	5d                   	pop    %ebp
+  800ec6:	c3                   	ret
+		return -E_INVAL;
+  800ec7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ecc:	eb f4                	jmp    800ec2 <sys_page_map_range+0x35>
+
+00800ece <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	57                   	push   %edi
+  800ed2:	56                   	push   %esi
+  800ed3:	53                   	push   %ebx
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ee2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eed:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eef:	85 c0                	test   %eax,%eax
+  800ef1:	7f 08                	jg     800efb <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800ef3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef6:	5b                   	pop    %ebx
+  800ef7:	5e                   	pop    %esi
+  800ef8:	5f                   	pop    %edi
+  800ef9:	5d                   	pop    %ebp
+  800efa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efb:	83 ec 0c             	sub    $0xc,%esp
+  800efe:	50                   	push   %eax
+  800eff:	6a 0c                	push   $0xc
+  800f01:	68 9f 30 80 00       	push   $0x80309f
+  800f06:	6a 23                	push   $0x23
+  800f08:	68 bc 30 80 00       	push   $0x8030bc
+  800f0d:	e8 18 f3 ff ff       	call   80022a <_panic>
+
+00800f12 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	57                   	push   %edi
+  800f16:	56                   	push   %esi
+  800f17:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f18:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f23:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2b:	89 f7                	mov    %esi,%edi
+  800f2d:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f2f:	5b                   	pop    %ebx
+  800f30:	5e                   	pop    %esi
+  800f31:	5f                   	pop    %edi
+  800f32:	5d                   	pop    %ebp
+  800f33:	c3                   	ret
+
+00800f34 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f34:	55                   	push   %ebp
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	57                   	push   %edi
+  800f38:	56                   	push   %esi
+  800f39:	53                   	push   %ebx
+  800f3a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f48:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f4d:	89 df                	mov    %ebx,%edi
+  800f4f:	89 de                	mov    %ebx,%esi
+  800f51:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f53:	85 c0                	test   %eax,%eax
+  800f55:	7f 08                	jg     800f5f <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5a:	5b                   	pop    %ebx
+  800f5b:	5e                   	pop    %esi
+  800f5c:	5f                   	pop    %edi
+  800f5d:	5d                   	pop    %ebp
+  800f5e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5f:	83 ec 0c             	sub    $0xc,%esp
+  800f62:	50                   	push   %eax
+  800f63:	6a 0f                	push   $0xf
+  800f65:	68 9f 30 80 00       	push   $0x80309f
+  800f6a:	6a 23                	push   $0x23
+  800f6c:	68 bc 30 80 00       	push   $0x8030bc
+  800f71:	e8 b4 f2 ff ff       	call   80022a <_panic>
+
+00800f76 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800f76:	55                   	push   %ebp
+  800f77:	89 e5                	mov    %esp,%ebp
+  800f79:	57                   	push   %edi
+  800f7a:	56                   	push   %esi
+  800f7b:	53                   	push   %ebx
+  800f7c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8a:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f8f:	89 df                	mov    %ebx,%edi
+  800f91:	89 de                	mov    %ebx,%esi
+  800f93:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f95:	85 c0                	test   %eax,%eax
+  800f97:	7f 08                	jg     800fa1 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800f99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9c:	5b                   	pop    %ebx
+  800f9d:	5e                   	pop    %esi
+  800f9e:	5f                   	pop    %edi
+  800f9f:	5d                   	pop    %ebp
+  800fa0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa1:	83 ec 0c             	sub    $0xc,%esp
+  800fa4:	50                   	push   %eax
+  800fa5:	6a 10                	push   $0x10
+  800fa7:	68 9f 30 80 00       	push   $0x80309f
+  800fac:	6a 23                	push   $0x23
+  800fae:	68 bc 30 80 00       	push   $0x8030bc
+  800fb3:	e8 72 f2 ff ff       	call   80022a <_panic>
+
+00800fb8 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800fb8:	55                   	push   %ebp
+  800fb9:	89 e5                	mov    %esp,%ebp
+  800fbb:	57                   	push   %edi
+  800fbc:	56                   	push   %esi
+  800fbd:	53                   	push   %ebx
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcc:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fd1:	89 df                	mov    %ebx,%edi
+  800fd3:	89 de                	mov    %ebx,%esi
+  800fd5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd7:	85 c0                	test   %eax,%eax
+  800fd9:	7f 08                	jg     800fe3 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fde:	5b                   	pop    %ebx
+  800fdf:	5e                   	pop    %esi
+  800fe0:	5f                   	pop    %edi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+  800fe6:	50                   	push   %eax
+  800fe7:	6a 11                	push   $0x11
+  800fe9:	68 9f 30 80 00       	push   $0x80309f
+  800fee:	6a 23                	push   $0x23
+  800ff0:	68 bc 30 80 00       	push   $0x8030bc
+  800ff5:	e8 30 f2 ff ff       	call   80022a <_panic>
+
+00800ffa <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+  800ffd:	57                   	push   %edi
+  800ffe:	56                   	push   %esi
+  800fff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801000:	ba 00 00 00 00       	mov    $0x0,%edx
+  801005:	b8 12 00 00 00       	mov    $0x12,%eax
+  80100a:	89 d1                	mov    %edx,%ecx
+  80100c:	89 d3                	mov    %edx,%ebx
+  80100e:	89 d7                	mov    %edx,%edi
+  801010:	89 d6                	mov    %edx,%esi
+  801012:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  801014:	5b                   	pop    %ebx
+  801015:	5e                   	pop    %esi
+  801016:	5f                   	pop    %edi
+  801017:	5d                   	pop    %ebp
+  801018:	c3                   	ret
+
+00801019 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801019:	55                   	push   %ebp
+  80101a:	89 e5                	mov    %esp,%ebp
+  80101c:	57                   	push   %edi
+  80101d:	56                   	push   %esi
+  80101e:	53                   	push   %ebx
+  80101f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801022:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801027:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801032:	89 df                	mov    %ebx,%edi
+  801034:	89 de                	mov    %ebx,%esi
+  801036:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801038:	85 c0                	test   %eax,%eax
+  80103a:	7f 08                	jg     801044 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80103c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103f:	5b                   	pop    %ebx
+  801040:	5e                   	pop    %esi
+  801041:	5f                   	pop    %edi
+  801042:	5d                   	pop    %ebp
+  801043:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801044:	83 ec 0c             	sub    $0xc,%esp
+  801047:	50                   	push   %eax
+  801048:	6a 13                	push   $0x13
+  80104a:	68 9f 30 80 00       	push   $0x80309f
+  80104f:	6a 23                	push   $0x23
+  801051:	68 bc 30 80 00       	push   $0x8030bc
+  801056:	e8 cf f1 ff ff       	call   80022a <_panic>
+
+0080105b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80105b:	55                   	push   %ebp
+  80105c:	89 e5                	mov    %esp,%ebp
+  80105e:	57                   	push   %edi
+  80105f:	56                   	push   %esi
+  801060:	53                   	push   %ebx
+  801061:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801064:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801069:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801074:	89 df                	mov    %ebx,%edi
+  801076:	89 de                	mov    %ebx,%esi
+  801078:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107a:	85 c0                	test   %eax,%eax
+  80107c:	7f 08                	jg     801086 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80107e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801081:	5b                   	pop    %ebx
+  801082:	5e                   	pop    %esi
+  801083:	5f                   	pop    %edi
+  801084:	5d                   	pop    %ebp
+  801085:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801086:	83 ec 0c             	sub    $0xc,%esp
+  801089:	50                   	push   %eax
+  80108a:	6a 14                	push   $0x14
+  80108c:	68 9f 30 80 00       	push   $0x80309f
+  801091:	6a 23                	push   $0x23
+  801093:	68 bc 30 80 00       	push   $0x8030bc
+  801098:	e8 8d f1 ff ff       	call   80022a <_panic>
+
+0080109d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80109d:	55                   	push   %ebp
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	57                   	push   %edi
+  8010a1:	56                   	push   %esi
+  8010a2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a9:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010bb:	5b                   	pop    %ebx
+  8010bc:	5e                   	pop    %esi
+  8010bd:	5f                   	pop    %edi
+  8010be:	5d                   	pop    %ebp
+  8010bf:	c3                   	ret
+
+008010c0 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	56                   	push   %esi
+  8010c5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cc:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010dc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010de:	5b                   	pop    %ebx
+  8010df:	5e                   	pop    %esi
+  8010e0:	5f                   	pop    %edi
+  8010e1:	5d                   	pop    %ebp
+  8010e2:	c3                   	ret
+
+008010e3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010f9:	89 cb                	mov    %ecx,%ebx
+  8010fb:	89 cf                	mov    %ecx,%edi
+  8010fd:	89 ce                	mov    %ecx,%esi
+  8010ff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801101:	85 c0                	test   %eax,%eax
+  801103:	7f 08                	jg     80110d <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801105:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801108:	5b                   	pop    %ebx
+  801109:	5e                   	pop    %esi
+  80110a:	5f                   	pop    %edi
+  80110b:	5d                   	pop    %ebp
+  80110c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110d:	83 ec 0c             	sub    $0xc,%esp
+  801110:	50                   	push   %eax
+  801111:	6a 19                	push   $0x19
+  801113:	68 9f 30 80 00       	push   $0x80309f
+  801118:	6a 23                	push   $0x23
+  80111a:	68 bc 30 80 00       	push   $0x8030bc
+  80111f:	e8 06 f1 ff ff       	call   80022a <_panic>
+
+00801124 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	57                   	push   %edi
+  801128:	56                   	push   %esi
+  801129:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801134:	89 d1                	mov    %edx,%ecx
+  801136:	89 d3                	mov    %edx,%ebx
+  801138:	89 d7                	mov    %edx,%edi
+  80113a:	89 d6                	mov    %edx,%esi
+  80113c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80113e:	5b                   	pop    %ebx
+  80113f:	5e                   	pop    %esi
+  801140:	5f                   	pop    %edi
+  801141:	5d                   	pop    %ebp
+  801142:	c3                   	ret
+
+00801143 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801143:	55                   	push   %ebp
+  801144:	89 e5                	mov    %esp,%ebp
+  801146:	57                   	push   %edi
+  801147:	56                   	push   %esi
+  801148:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801149:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801151:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801154:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801159:	89 df                	mov    %ebx,%edi
+  80115b:	89 de                	mov    %ebx,%esi
+  80115d:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  80115f:	5b                   	pop    %ebx
+  801160:	5e                   	pop    %esi
+  801161:	5f                   	pop    %edi
+  801162:	5d                   	pop    %ebp
+  801163:	c3                   	ret
+
+00801164 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80116a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801172:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801175:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80117a:	89 df                	mov    %ebx,%edi
+  80117c:	89 de                	mov    %ebx,%esi
+  80117e:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801180:	5b                   	pop    %ebx
+  801181:	5e                   	pop    %esi
+  801182:	5f                   	pop    %edi
+  801183:	5d                   	pop    %ebp
+  801184:	c3                   	ret
+
+00801185 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801185:	55                   	push   %ebp
+  801186:	89 e5                	mov    %esp,%ebp
+  801188:	53                   	push   %ebx
+  801189:	83 ec 04             	sub    $0x4,%esp
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80118f:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  801191:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  801194:	f6 c2 02             	test   $0x2,%dl
+  801197:	74 7b                	je     801214 <pgfault+0x8f>
+  801199:	89 c1                	mov    %eax,%ecx
+  80119b:	c1 e9 0c             	shr    $0xc,%ecx
+  80119e:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8011a5:	f6 c5 08             	test   $0x8,%ch
+  8011a8:	74 6a                	je     801214 <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8011aa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011af:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8011b1:	83 ec 04             	sub    $0x4,%esp
+  8011b4:	6a 07                	push   $0x7
+  8011b6:	68 00 f0 7f 00       	push   $0x7ff000
+  8011bb:	6a 00                	push   $0x0
+  8011bd:	e8 9e fb ff ff       	call   800d60 <sys_page_alloc>
+  8011c2:	83 c4 10             	add    $0x10,%esp
+  8011c5:	85 c0                	test   %eax,%eax
+  8011c7:	78 61                	js     80122a <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  8011c9:	83 ec 04             	sub    $0x4,%esp
+  8011cc:	68 00 10 00 00       	push   $0x1000
+  8011d1:	53                   	push   %ebx
+  8011d2:	68 00 f0 7f 00       	push   $0x7ff000
+  8011d7:	e8 9d f8 ff ff       	call   800a79 <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  8011dc:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8011e3:	53                   	push   %ebx
+  8011e4:	6a 00                	push   $0x0
+  8011e6:	68 00 f0 7f 00       	push   $0x7ff000
+  8011eb:	6a 00                	push   $0x0
+  8011ed:	e8 f4 fb ff ff       	call   800de6 <sys_page_map>
+  8011f2:	83 c4 20             	add    $0x20,%esp
+  8011f5:	85 c0                	test   %eax,%eax
+  8011f7:	78 43                	js     80123c <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  8011f9:	83 ec 08             	sub    $0x8,%esp
+  8011fc:	68 00 f0 7f 00       	push   $0x7ff000
+  801201:	6a 00                	push   $0x0
+  801203:	e8 20 fc ff ff       	call   800e28 <sys_page_unmap>
+  801208:	83 c4 10             	add    $0x10,%esp
+  80120b:	85 c0                	test   %eax,%eax
+  80120d:	78 3f                	js     80124e <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  80120f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801212:	c9                   	leave
+  801213:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  801214:	83 ec 0c             	sub    $0xc,%esp
+  801217:	50                   	push   %eax
+  801218:	52                   	push   %edx
+  801219:	68 ca 30 80 00       	push   $0x8030ca
+  80121e:	6a 19                	push   $0x19
+  801220:	68 db 30 80 00       	push   $0x8030db
+  801225:	e8 00 f0 ff ff       	call   80022a <_panic>
+		panic("sys_page_alloc: %e", r);
+  80122a:	50                   	push   %eax
+  80122b:	68 e6 30 80 00       	push   $0x8030e6
+  801230:	6a 24                	push   $0x24
+  801232:	68 db 30 80 00       	push   $0x8030db
+  801237:	e8 ee ef ff ff       	call   80022a <_panic>
+		panic("sys_page_map: %e", r);
+  80123c:	50                   	push   %eax
+  80123d:	68 f9 30 80 00       	push   $0x8030f9
+  801242:	6a 29                	push   $0x29
+  801244:	68 db 30 80 00       	push   $0x8030db
+  801249:	e8 dc ef ff ff       	call   80022a <_panic>
+		panic("sys_page_unmap: %e", r);
+  80124e:	50                   	push   %eax
+  80124f:	68 0a 31 80 00       	push   $0x80310a
+  801254:	6a 2c                	push   $0x2c
+  801256:	68 db 30 80 00       	push   $0x8030db
+  80125b:	e8 ca ef ff ff       	call   80022a <_panic>
+
+00801260 <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  801260:	55                   	push   %ebp
+  801261:	89 e5                	mov    %esp,%ebp
+  801263:	57                   	push   %edi
+  801264:	56                   	push   %esi
+  801265:	53                   	push   %ebx
+  801266:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801269:	68 85 11 80 00       	push   $0x801185
+  80126e:	e8 d4 13 00 00       	call   802647 <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  801273:	83 c4 08             	add    $0x8,%esp
+  801276:	6a 01                	push   $0x1
+  801278:	6a 00                	push   $0x0
+  80127a:	e8 9f fa ff ff       	call   800d1e <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  80127f:	e8 7b fa ff ff       	call   800cff <sys_fork_cow>
+  801284:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  801287:	83 c4 10             	add    $0x10,%esp
+  80128a:	85 c0                	test   %eax,%eax
+  80128c:	74 2c                	je     8012ba <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  80128e:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  801292:	0f 85 8b 01 00 00    	jne    801423 <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801298:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80129d:	cd 30                	int    $0x30
+  80129f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8012a2:	85 c0                	test   %eax,%eax
+  8012a4:	78 30                	js     8012d6 <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  8012a6:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8012ab:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8012b0:	74 36                	je     8012e8 <fork+0x88>
+  8012b2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8012b5:	e9 99 00 00 00       	jmp    801353 <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8012ba:	e8 02 fa ff ff       	call   800cc1 <sys_getenvid>
+  8012bf:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8012c4:	c1 e0 09             	shl    $0x9,%eax
+  8012c7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8012cc:	a3 20 54 80 00       	mov    %eax,0x805420
+		return 0;
+  8012d1:	e9 4d 01 00 00       	jmp    801423 <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  8012d6:	50                   	push   %eax
+  8012d7:	68 1d 31 80 00       	push   $0x80311d
+  8012dc:	6a 7d                	push   $0x7d
+  8012de:	68 db 30 80 00       	push   $0x8030db
+  8012e3:	e8 42 ef ff ff       	call   80022a <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8012e8:	e8 d4 f9 ff ff       	call   800cc1 <sys_getenvid>
+  8012ed:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8012f2:	c1 e0 09             	shl    $0x9,%eax
+  8012f5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8012fa:	a3 20 54 80 00       	mov    %eax,0x805420
+		return 0;
+  8012ff:	e9 1f 01 00 00       	jmp    801423 <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  801304:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80130b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80130e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801313:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801316:	83 ec 0c             	sub    $0xc,%esp
+  801319:	50                   	push   %eax
+  80131a:	56                   	push   %esi
+  80131b:	ff 75 e4             	push   -0x1c(%ebp)
+  80131e:	56                   	push   %esi
+  80131f:	6a 00                	push   $0x0
+  801321:	e8 c0 fa ff ff       	call   800de6 <sys_page_map>
+  801326:	83 c4 20             	add    $0x20,%esp
+  801329:	85 c0                	test   %eax,%eax
+  80132b:	0f 88 98 00 00 00    	js     8013c9 <fork+0x169>
+	if (perm & PTE_COW) {
+  801331:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801338:	0f 85 61 01 00 00    	jne    80149f <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80133e:	83 c7 01             	add    $0x1,%edi
+  801341:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801347:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  80134d:	0f 84 88 00 00 00    	je     8013db <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  801353:	89 f0                	mov    %esi,%eax
+  801355:	c1 e8 16             	shr    $0x16,%eax
+  801358:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80135f:	25 81 00 00 00       	and    $0x81,%eax
+  801364:	83 f8 01             	cmp    $0x1,%eax
+  801367:	75 d5                	jne    80133e <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  801369:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  801370:	a8 01                	test   $0x1,%al
+  801372:	74 ca                	je     80133e <fork+0xde>
+  801374:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  80137a:	74 c2                	je     80133e <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  80137c:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  80137e:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801385:	f6 c4 04             	test   $0x4,%ah
+  801388:	0f 85 76 ff ff ff    	jne    801304 <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  80138e:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801395:	a8 02                	test   $0x2,%al
+  801397:	0f 85 dc 00 00 00    	jne    801479 <fork+0x219>
+  80139d:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8013a4:	f6 c4 08             	test   $0x8,%ah
+  8013a7:	0f 85 cc 00 00 00    	jne    801479 <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8013ad:	83 ec 0c             	sub    $0xc,%esp
+  8013b0:	6a 05                	push   $0x5
+  8013b2:	56                   	push   %esi
+  8013b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8013b6:	56                   	push   %esi
+  8013b7:	6a 00                	push   $0x0
+  8013b9:	e8 28 fa ff ff       	call   800de6 <sys_page_map>
+  8013be:	83 c4 20             	add    $0x20,%esp
+  8013c1:	85 c0                	test   %eax,%eax
+  8013c3:	0f 89 75 ff ff ff    	jns    80133e <fork+0xde>
+		panic("sys_page_map: %e", r);
+  8013c9:	50                   	push   %eax
+  8013ca:	68 f9 30 80 00       	push   $0x8030f9
+  8013cf:	6a 48                	push   $0x48
+  8013d1:	68 db 30 80 00       	push   $0x8030db
+  8013d6:	e8 4f ee ff ff       	call   80022a <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  8013db:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8013de:	83 ec 04             	sub    $0x4,%esp
+  8013e1:	6a 07                	push   $0x7
+  8013e3:	68 00 f0 bf ee       	push   $0xeebff000
+  8013e8:	53                   	push   %ebx
+  8013e9:	e8 72 f9 ff ff       	call   800d60 <sys_page_alloc>
+  8013ee:	83 c4 10             	add    $0x10,%esp
+  8013f1:	85 c0                	test   %eax,%eax
+  8013f3:	78 39                	js     80142e <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8013f5:	a1 20 54 80 00       	mov    0x805420,%eax
+  8013fa:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  801400:	83 ec 08             	sub    $0x8,%esp
+  801403:	50                   	push   %eax
+  801404:	53                   	push   %ebx
+  801405:	e8 51 fc ff ff       	call   80105b <sys_env_set_pgfault_upcall>
+  80140a:	83 c4 10             	add    $0x10,%esp
+  80140d:	85 c0                	test   %eax,%eax
+  80140f:	78 36                	js     801447 <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  801411:	83 ec 08             	sub    $0x8,%esp
+  801414:	6a 02                	push   $0x2
+  801416:	53                   	push   %ebx
+  801417:	e8 18 fb ff ff       	call   800f34 <sys_env_set_status>
+  80141c:	83 c4 10             	add    $0x10,%esp
+  80141f:	85 c0                	test   %eax,%eax
+  801421:	78 3d                	js     801460 <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  801423:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801426:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801429:	5b                   	pop    %ebx
+  80142a:	5e                   	pop    %esi
+  80142b:	5f                   	pop    %edi
+  80142c:	5d                   	pop    %ebp
+  80142d:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  80142e:	83 ec 0c             	sub    $0xc,%esp
+  801431:	53                   	push   %ebx
+  801432:	50                   	push   %eax
+  801433:	68 44 31 80 00       	push   $0x803144
+  801438:	68 92 00 00 00       	push   $0x92
+  80143d:	68 db 30 80 00       	push   $0x8030db
+  801442:	e8 e3 ed ff ff       	call   80022a <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  801447:	83 ec 0c             	sub    $0xc,%esp
+  80144a:	53                   	push   %ebx
+  80144b:	50                   	push   %eax
+  80144c:	68 68 31 80 00       	push   $0x803168
+  801451:	68 95 00 00 00       	push   $0x95
+  801456:	68 db 30 80 00       	push   $0x8030db
+  80145b:	e8 ca ed ff ff       	call   80022a <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  801460:	83 ec 0c             	sub    $0xc,%esp
+  801463:	53                   	push   %ebx
+  801464:	50                   	push   %eax
+  801465:	68 98 31 80 00       	push   $0x803198
+  80146a:	68 98 00 00 00       	push   $0x98
+  80146f:	68 db 30 80 00       	push   $0x8030db
+  801474:	e8 b1 ed ff ff       	call   80022a <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801479:	83 ec 0c             	sub    $0xc,%esp
+  80147c:	68 05 08 00 00       	push   $0x805
+  801481:	53                   	push   %ebx
+  801482:	ff 75 e4             	push   -0x1c(%ebp)
+  801485:	53                   	push   %ebx
+  801486:	6a 00                	push   $0x0
+  801488:	e8 59 f9 ff ff       	call   800de6 <sys_page_map>
+  80148d:	83 c4 20             	add    $0x20,%esp
+  801490:	85 c0                	test   %eax,%eax
+  801492:	0f 88 31 ff ff ff    	js     8013c9 <fork+0x169>
+		perm |= PTE_COW;
+  801498:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  80149f:	83 ec 0c             	sub    $0xc,%esp
+  8014a2:	ff 75 e0             	push   -0x20(%ebp)
+  8014a5:	53                   	push   %ebx
+  8014a6:	6a 00                	push   $0x0
+  8014a8:	53                   	push   %ebx
+  8014a9:	6a 00                	push   $0x0
+  8014ab:	e8 36 f9 ff ff       	call   800de6 <sys_page_map>
+  8014b0:	83 c4 20             	add    $0x20,%esp
+  8014b3:	85 c0                	test   %eax,%eax
+  8014b5:	0f 89 83 fe ff ff    	jns    80133e <fork+0xde>
+			panic("sys_page_map: %e", r);
+  8014bb:	50                   	push   %eax
+  8014bc:	68 f9 30 80 00       	push   $0x8030f9
+  8014c1:	6a 4c                	push   $0x4c
+  8014c3:	68 db 30 80 00       	push   $0x8030db
+  8014c8:	e8 5d ed ff ff       	call   80022a <_panic>
+
+008014cd <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8014cd:	55                   	push   %ebp
+  8014ce:	89 e5                	mov    %esp,%ebp
+  8014d0:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8014d3:	68 2d 31 80 00       	push   $0x80312d
+  8014d8:	68 a0 00 00 00       	push   $0xa0
+  8014dd:	68 db 30 80 00       	push   $0x8030db
+  8014e2:	e8 43 ed ff ff       	call   80022a <_panic>
+
+008014e7 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014e7:	55                   	push   %ebp
+  8014e8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014ed:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014f2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014f5:	5d                   	pop    %ebp
+  8014f6:	c3                   	ret
+
+008014f7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014fd:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801502:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801507:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80150c:	5d                   	pop    %ebp
+  80150d:	c3                   	ret
+
+0080150e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80150e:	55                   	push   %ebp
+  80150f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801511:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801516:	eb 02                	jmp    80151a <fd_alloc+0xc>
+  801518:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80151a:	89 c2                	mov    %eax,%edx
+  80151c:	c1 ea 16             	shr    $0x16,%edx
+  80151f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801526:	f6 c2 01             	test   $0x1,%dl
+  801529:	74 2b                	je     801556 <fd_alloc+0x48>
+  80152b:	89 c2                	mov    %eax,%edx
+  80152d:	c1 ea 0c             	shr    $0xc,%edx
+  801530:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801537:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80153d:	f6 c1 01             	test   $0x1,%cl
+  801540:	74 14                	je     801556 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801542:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801548:	75 ce                	jne    801518 <fd_alloc+0xa>
+  80154a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80154f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801554:	eb 05                	jmp    80155b <fd_alloc+0x4d>
+			return 0;
+  801556:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80155b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155e:	89 02                	mov    %eax,(%edx)
+}
+  801560:	89 c8                	mov    %ecx,%eax
+  801562:	5d                   	pop    %ebp
+  801563:	c3                   	ret
+
+00801564 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801564:	55                   	push   %ebp
+  801565:	89 e5                	mov    %esp,%ebp
+  801567:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80156a:	83 f8 1f             	cmp    $0x1f,%eax
+  80156d:	77 30                	ja     80159f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80156f:	c1 e0 0c             	shl    $0xc,%eax
+  801572:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801577:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80157d:	f6 c2 01             	test   $0x1,%dl
+  801580:	74 24                	je     8015a6 <fd_lookup+0x42>
+  801582:	89 c2                	mov    %eax,%edx
+  801584:	c1 ea 0c             	shr    $0xc,%edx
+  801587:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80158e:	f6 c2 01             	test   $0x1,%dl
+  801591:	74 1a                	je     8015ad <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801593:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801596:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801598:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80159d:	5d                   	pop    %ebp
+  80159e:	c3                   	ret
+		return -E_INVAL;
+  80159f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a4:	eb f7                	jmp    80159d <fd_lookup+0x39>
+		return -E_INVAL;
+  8015a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ab:	eb f0                	jmp    80159d <fd_lookup+0x39>
+  8015ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b2:	eb e9                	jmp    80159d <fd_lookup+0x39>
+
+008015b4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015b4:	55                   	push   %ebp
+  8015b5:	89 e5                	mov    %esp,%ebp
+  8015b7:	53                   	push   %ebx
+  8015b8:	83 ec 04             	sub    $0x4,%esp
+  8015bb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c3:	eb 03                	jmp    8015c8 <dev_lookup+0x14>
+  8015c5:	83 c0 01             	add    $0x1,%eax
+  8015c8:	8b 1c 85 3c 32 80 00 	mov    0x80323c(,%eax,4),%ebx
+  8015cf:	85 db                	test   %ebx,%ebx
+  8015d1:	74 0b                	je     8015de <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8015d3:	39 13                	cmp    %edx,(%ebx)
+  8015d5:	75 ee                	jne    8015c5 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8015d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015dc:	eb 1f                	jmp    8015fd <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015de:	a1 20 54 80 00       	mov    0x805420,%eax
+  8015e3:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8015e6:	83 ec 04             	sub    $0x4,%esp
+  8015e9:	52                   	push   %edx
+  8015ea:	50                   	push   %eax
+  8015eb:	68 c0 31 80 00       	push   $0x8031c0
+  8015f0:	e8 10 ed ff ff       	call   800305 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015f5:	83 c4 10             	add    $0x10,%esp
+  8015f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8015fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801600:	89 1a                	mov    %ebx,(%edx)
+}
+  801602:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801605:	c9                   	leave
+  801606:	c3                   	ret
+
+00801607 <fd_close>:
+{
+  801607:	55                   	push   %ebp
+  801608:	89 e5                	mov    %esp,%ebp
+  80160a:	57                   	push   %edi
+  80160b:	56                   	push   %esi
+  80160c:	53                   	push   %ebx
+  80160d:	83 ec 24             	sub    $0x24,%esp
+  801610:	8b 75 08             	mov    0x8(%ebp),%esi
+  801613:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801616:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801619:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80161a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801620:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801623:	50                   	push   %eax
+  801624:	e8 3b ff ff ff       	call   801564 <fd_lookup>
+  801629:	89 c3                	mov    %eax,%ebx
+  80162b:	83 c4 10             	add    $0x10,%esp
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	78 05                	js     801637 <fd_close+0x30>
+	    || fd != fd2)
+  801632:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801635:	74 16                	je     80164d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801637:	89 f8                	mov    %edi,%eax
+  801639:	84 c0                	test   %al,%al
+  80163b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801640:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801643:	89 d8                	mov    %ebx,%eax
+  801645:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801648:	5b                   	pop    %ebx
+  801649:	5e                   	pop    %esi
+  80164a:	5f                   	pop    %edi
+  80164b:	5d                   	pop    %ebp
+  80164c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80164d:	83 ec 08             	sub    $0x8,%esp
+  801650:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801653:	50                   	push   %eax
+  801654:	ff 36                	push   (%esi)
+  801656:	e8 59 ff ff ff       	call   8015b4 <dev_lookup>
+  80165b:	89 c3                	mov    %eax,%ebx
+  80165d:	83 c4 10             	add    $0x10,%esp
+  801660:	85 c0                	test   %eax,%eax
+  801662:	78 1a                	js     80167e <fd_close+0x77>
+		if (dev->dev_close)
+  801664:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801667:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80166a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80166f:	85 c0                	test   %eax,%eax
+  801671:	74 0b                	je     80167e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801673:	83 ec 0c             	sub    $0xc,%esp
+  801676:	56                   	push   %esi
+  801677:	ff d0                	call   *%eax
+  801679:	89 c3                	mov    %eax,%ebx
+  80167b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80167e:	83 ec 08             	sub    $0x8,%esp
+  801681:	56                   	push   %esi
+  801682:	6a 00                	push   $0x0
+  801684:	e8 9f f7 ff ff       	call   800e28 <sys_page_unmap>
+	return r;
+  801689:	83 c4 10             	add    $0x10,%esp
+  80168c:	eb b5                	jmp    801643 <fd_close+0x3c>
+
+0080168e <close>:
+
+int
+close(int fdnum)
+{
+  80168e:	55                   	push   %ebp
+  80168f:	89 e5                	mov    %esp,%ebp
+  801691:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801694:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801697:	50                   	push   %eax
+  801698:	ff 75 08             	push   0x8(%ebp)
+  80169b:	e8 c4 fe ff ff       	call   801564 <fd_lookup>
+  8016a0:	83 c4 10             	add    $0x10,%esp
+  8016a3:	85 c0                	test   %eax,%eax
+  8016a5:	79 02                	jns    8016a9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016a7:	c9                   	leave
+  8016a8:	c3                   	ret
+		return fd_close(fd, 1);
+  8016a9:	83 ec 08             	sub    $0x8,%esp
+  8016ac:	6a 01                	push   $0x1
+  8016ae:	ff 75 f4             	push   -0xc(%ebp)
+  8016b1:	e8 51 ff ff ff       	call   801607 <fd_close>
+  8016b6:	83 c4 10             	add    $0x10,%esp
+  8016b9:	eb ec                	jmp    8016a7 <close+0x19>
+
+008016bb <close_all>:
+
+void
+close_all(void)
+{
+  8016bb:	55                   	push   %ebp
+  8016bc:	89 e5                	mov    %esp,%ebp
+  8016be:	53                   	push   %ebx
+  8016bf:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8016c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8016c7:	83 ec 0c             	sub    $0xc,%esp
+  8016ca:	53                   	push   %ebx
+  8016cb:	e8 be ff ff ff       	call   80168e <close>
+	for (i = 0; i < MAXFD; i++)
+  8016d0:	83 c3 01             	add    $0x1,%ebx
+  8016d3:	83 c4 10             	add    $0x10,%esp
+  8016d6:	83 fb 20             	cmp    $0x20,%ebx
+  8016d9:	75 ec                	jne    8016c7 <close_all+0xc>
+}
+  8016db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016de:	c9                   	leave
+  8016df:	c3                   	ret
+
+008016e0 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016e0:	55                   	push   %ebp
+  8016e1:	89 e5                	mov    %esp,%ebp
+  8016e3:	57                   	push   %edi
+  8016e4:	56                   	push   %esi
+  8016e5:	53                   	push   %ebx
+  8016e6:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016e9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016ec:	50                   	push   %eax
+  8016ed:	ff 75 08             	push   0x8(%ebp)
+  8016f0:	e8 6f fe ff ff       	call   801564 <fd_lookup>
+  8016f5:	89 c3                	mov    %eax,%ebx
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	78 7f                	js     80177d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8016fe:	83 ec 0c             	sub    $0xc,%esp
+  801701:	ff 75 0c             	push   0xc(%ebp)
+  801704:	e8 85 ff ff ff       	call   80168e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801709:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80170c:	c1 e6 0c             	shl    $0xc,%esi
+  80170f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801715:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801718:	89 3c 24             	mov    %edi,(%esp)
+  80171b:	e8 d7 fd ff ff       	call   8014f7 <fd2data>
+  801720:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801722:	89 34 24             	mov    %esi,(%esp)
+  801725:	e8 cd fd ff ff       	call   8014f7 <fd2data>
+  80172a:	83 c4 10             	add    $0x10,%esp
+  80172d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801730:	89 d8                	mov    %ebx,%eax
+  801732:	c1 e8 16             	shr    $0x16,%eax
+  801735:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80173c:	a8 01                	test   $0x1,%al
+  80173e:	74 11                	je     801751 <dup+0x71>
+  801740:	89 d8                	mov    %ebx,%eax
+  801742:	c1 e8 0c             	shr    $0xc,%eax
+  801745:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80174c:	f6 c2 01             	test   $0x1,%dl
+  80174f:	75 36                	jne    801787 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801751:	89 f8                	mov    %edi,%eax
+  801753:	c1 e8 0c             	shr    $0xc,%eax
+  801756:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80175d:	83 ec 0c             	sub    $0xc,%esp
+  801760:	25 07 0e 00 00       	and    $0xe07,%eax
+  801765:	50                   	push   %eax
+  801766:	56                   	push   %esi
+  801767:	6a 00                	push   $0x0
+  801769:	57                   	push   %edi
+  80176a:	6a 00                	push   $0x0
+  80176c:	e8 75 f6 ff ff       	call   800de6 <sys_page_map>
+  801771:	89 c3                	mov    %eax,%ebx
+  801773:	83 c4 20             	add    $0x20,%esp
+  801776:	85 c0                	test   %eax,%eax
+  801778:	78 33                	js     8017ad <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80177a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80177d:	89 d8                	mov    %ebx,%eax
+  80177f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801782:	5b                   	pop    %ebx
+  801783:	5e                   	pop    %esi
+  801784:	5f                   	pop    %edi
+  801785:	5d                   	pop    %ebp
+  801786:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801787:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80178e:	83 ec 0c             	sub    $0xc,%esp
+  801791:	25 07 0e 00 00       	and    $0xe07,%eax
+  801796:	50                   	push   %eax
+  801797:	ff 75 d4             	push   -0x2c(%ebp)
+  80179a:	6a 00                	push   $0x0
+  80179c:	53                   	push   %ebx
+  80179d:	6a 00                	push   $0x0
+  80179f:	e8 42 f6 ff ff       	call   800de6 <sys_page_map>
+  8017a4:	89 c3                	mov    %eax,%ebx
+  8017a6:	83 c4 20             	add    $0x20,%esp
+  8017a9:	85 c0                	test   %eax,%eax
+  8017ab:	79 a4                	jns    801751 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8017ad:	83 ec 08             	sub    $0x8,%esp
+  8017b0:	56                   	push   %esi
+  8017b1:	6a 00                	push   $0x0
+  8017b3:	e8 70 f6 ff ff       	call   800e28 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017b8:	83 c4 08             	add    $0x8,%esp
+  8017bb:	ff 75 d4             	push   -0x2c(%ebp)
+  8017be:	6a 00                	push   $0x0
+  8017c0:	e8 63 f6 ff ff       	call   800e28 <sys_page_unmap>
+	return r;
+  8017c5:	83 c4 10             	add    $0x10,%esp
+  8017c8:	eb b3                	jmp    80177d <dup+0x9d>
+
+008017ca <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8017ca:	55                   	push   %ebp
+  8017cb:	89 e5                	mov    %esp,%ebp
+  8017cd:	56                   	push   %esi
+  8017ce:	53                   	push   %ebx
+  8017cf:	83 ec 18             	sub    $0x18,%esp
+  8017d2:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017d5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017d8:	50                   	push   %eax
+  8017d9:	56                   	push   %esi
+  8017da:	e8 85 fd ff ff       	call   801564 <fd_lookup>
+  8017df:	83 c4 10             	add    $0x10,%esp
+  8017e2:	85 c0                	test   %eax,%eax
+  8017e4:	78 3c                	js     801822 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017e6:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017e9:	83 ec 08             	sub    $0x8,%esp
+  8017ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ef:	50                   	push   %eax
+  8017f0:	ff 33                	push   (%ebx)
+  8017f2:	e8 bd fd ff ff       	call   8015b4 <dev_lookup>
+  8017f7:	83 c4 10             	add    $0x10,%esp
+  8017fa:	85 c0                	test   %eax,%eax
+  8017fc:	78 24                	js     801822 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8017fe:	8b 43 08             	mov    0x8(%ebx),%eax
+  801801:	83 e0 03             	and    $0x3,%eax
+  801804:	83 f8 01             	cmp    $0x1,%eax
+  801807:	74 20                	je     801829 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801809:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180c:	8b 40 08             	mov    0x8(%eax),%eax
+  80180f:	85 c0                	test   %eax,%eax
+  801811:	74 37                	je     80184a <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801813:	83 ec 04             	sub    $0x4,%esp
+  801816:	ff 75 10             	push   0x10(%ebp)
+  801819:	ff 75 0c             	push   0xc(%ebp)
+  80181c:	53                   	push   %ebx
+  80181d:	ff d0                	call   *%eax
+  80181f:	83 c4 10             	add    $0x10,%esp
+}
+  801822:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801825:	5b                   	pop    %ebx
+  801826:	5e                   	pop    %esi
+  801827:	5d                   	pop    %ebp
+  801828:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801829:	a1 20 54 80 00       	mov    0x805420,%eax
+  80182e:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801831:	83 ec 04             	sub    $0x4,%esp
+  801834:	56                   	push   %esi
+  801835:	50                   	push   %eax
+  801836:	68 01 32 80 00       	push   $0x803201
+  80183b:	e8 c5 ea ff ff       	call   800305 <cprintf>
+		return -E_INVAL;
+  801840:	83 c4 10             	add    $0x10,%esp
+  801843:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801848:	eb d8                	jmp    801822 <read+0x58>
+		return -E_NOT_SUPP;
+  80184a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80184f:	eb d1                	jmp    801822 <read+0x58>
+
+00801851 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801851:	55                   	push   %ebp
+  801852:	89 e5                	mov    %esp,%ebp
+  801854:	57                   	push   %edi
+  801855:	56                   	push   %esi
+  801856:	53                   	push   %ebx
+  801857:	83 ec 0c             	sub    $0xc,%esp
+  80185a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80185d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801860:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801865:	eb 02                	jmp    801869 <readn+0x18>
+  801867:	01 c3                	add    %eax,%ebx
+  801869:	39 f3                	cmp    %esi,%ebx
+  80186b:	73 21                	jae    80188e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80186d:	83 ec 04             	sub    $0x4,%esp
+  801870:	89 f0                	mov    %esi,%eax
+  801872:	29 d8                	sub    %ebx,%eax
+  801874:	50                   	push   %eax
+  801875:	89 d8                	mov    %ebx,%eax
+  801877:	03 45 0c             	add    0xc(%ebp),%eax
+  80187a:	50                   	push   %eax
+  80187b:	57                   	push   %edi
+  80187c:	e8 49 ff ff ff       	call   8017ca <read>
+		if (m < 0)
+  801881:	83 c4 10             	add    $0x10,%esp
+  801884:	85 c0                	test   %eax,%eax
+  801886:	78 04                	js     80188c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801888:	75 dd                	jne    801867 <readn+0x16>
+  80188a:	eb 02                	jmp    80188e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80188c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80188e:	89 d8                	mov    %ebx,%eax
+  801890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801893:	5b                   	pop    %ebx
+  801894:	5e                   	pop    %esi
+  801895:	5f                   	pop    %edi
+  801896:	5d                   	pop    %ebp
+  801897:	c3                   	ret
+
+00801898 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801898:	55                   	push   %ebp
+  801899:	89 e5                	mov    %esp,%ebp
+  80189b:	56                   	push   %esi
+  80189c:	53                   	push   %ebx
+  80189d:	83 ec 18             	sub    $0x18,%esp
+  8018a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018a3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018a6:	50                   	push   %eax
+  8018a7:	53                   	push   %ebx
+  8018a8:	e8 b7 fc ff ff       	call   801564 <fd_lookup>
+  8018ad:	83 c4 10             	add    $0x10,%esp
+  8018b0:	85 c0                	test   %eax,%eax
+  8018b2:	78 37                	js     8018eb <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018b4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018b7:	83 ec 08             	sub    $0x8,%esp
+  8018ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018bd:	50                   	push   %eax
+  8018be:	ff 36                	push   (%esi)
+  8018c0:	e8 ef fc ff ff       	call   8015b4 <dev_lookup>
+  8018c5:	83 c4 10             	add    $0x10,%esp
+  8018c8:	85 c0                	test   %eax,%eax
+  8018ca:	78 1f                	js     8018eb <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018cc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018d0:	74 20                	je     8018f2 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8018d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018d5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018d8:	85 c0                	test   %eax,%eax
+  8018da:	74 37                	je     801913 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018dc:	83 ec 04             	sub    $0x4,%esp
+  8018df:	ff 75 10             	push   0x10(%ebp)
+  8018e2:	ff 75 0c             	push   0xc(%ebp)
+  8018e5:	56                   	push   %esi
+  8018e6:	ff d0                	call   *%eax
+  8018e8:	83 c4 10             	add    $0x10,%esp
+}
+  8018eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ee:	5b                   	pop    %ebx
+  8018ef:	5e                   	pop    %esi
+  8018f0:	5d                   	pop    %ebp
+  8018f1:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018f2:	a1 20 54 80 00       	mov    0x805420,%eax
+  8018f7:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8018fa:	83 ec 04             	sub    $0x4,%esp
+  8018fd:	53                   	push   %ebx
+  8018fe:	50                   	push   %eax
+  8018ff:	68 1d 32 80 00       	push   $0x80321d
+  801904:	e8 fc e9 ff ff       	call   800305 <cprintf>
+		return -E_INVAL;
+  801909:	83 c4 10             	add    $0x10,%esp
+  80190c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801911:	eb d8                	jmp    8018eb <write+0x53>
+		return -E_NOT_SUPP;
+  801913:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801918:	eb d1                	jmp    8018eb <write+0x53>
+
+0080191a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80191a:	55                   	push   %ebp
+  80191b:	89 e5                	mov    %esp,%ebp
+  80191d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801920:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801923:	50                   	push   %eax
+  801924:	ff 75 08             	push   0x8(%ebp)
+  801927:	e8 38 fc ff ff       	call   801564 <fd_lookup>
+  80192c:	83 c4 10             	add    $0x10,%esp
+  80192f:	85 c0                	test   %eax,%eax
+  801931:	78 0e                	js     801941 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801933:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801936:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801939:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80193c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801941:	c9                   	leave
+  801942:	c3                   	ret
+
+00801943 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801943:	55                   	push   %ebp
+  801944:	89 e5                	mov    %esp,%ebp
+  801946:	56                   	push   %esi
+  801947:	53                   	push   %ebx
+  801948:	83 ec 18             	sub    $0x18,%esp
+  80194b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80194e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801951:	50                   	push   %eax
+  801952:	53                   	push   %ebx
+  801953:	e8 0c fc ff ff       	call   801564 <fd_lookup>
+  801958:	83 c4 10             	add    $0x10,%esp
+  80195b:	85 c0                	test   %eax,%eax
+  80195d:	78 34                	js     801993 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80195f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801962:	83 ec 08             	sub    $0x8,%esp
+  801965:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801968:	50                   	push   %eax
+  801969:	ff 36                	push   (%esi)
+  80196b:	e8 44 fc ff ff       	call   8015b4 <dev_lookup>
+  801970:	83 c4 10             	add    $0x10,%esp
+  801973:	85 c0                	test   %eax,%eax
+  801975:	78 1c                	js     801993 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801977:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80197b:	74 1d                	je     80199a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80197d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801980:	8b 40 18             	mov    0x18(%eax),%eax
+  801983:	85 c0                	test   %eax,%eax
+  801985:	74 34                	je     8019bb <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801987:	83 ec 08             	sub    $0x8,%esp
+  80198a:	ff 75 0c             	push   0xc(%ebp)
+  80198d:	56                   	push   %esi
+  80198e:	ff d0                	call   *%eax
+  801990:	83 c4 10             	add    $0x10,%esp
+}
+  801993:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801996:	5b                   	pop    %ebx
+  801997:	5e                   	pop    %esi
+  801998:	5d                   	pop    %ebp
+  801999:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80199a:	a1 20 54 80 00       	mov    0x805420,%eax
+  80199f:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019a2:	83 ec 04             	sub    $0x4,%esp
+  8019a5:	53                   	push   %ebx
+  8019a6:	50                   	push   %eax
+  8019a7:	68 e0 31 80 00       	push   $0x8031e0
+  8019ac:	e8 54 e9 ff ff       	call   800305 <cprintf>
+		return -E_INVAL;
+  8019b1:	83 c4 10             	add    $0x10,%esp
+  8019b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019b9:	eb d8                	jmp    801993 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8019bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019c0:	eb d1                	jmp    801993 <ftruncate+0x50>
+
+008019c2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8019c2:	55                   	push   %ebp
+  8019c3:	89 e5                	mov    %esp,%ebp
+  8019c5:	56                   	push   %esi
+  8019c6:	53                   	push   %ebx
+  8019c7:	83 ec 18             	sub    $0x18,%esp
+  8019ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019cd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019d0:	50                   	push   %eax
+  8019d1:	ff 75 08             	push   0x8(%ebp)
+  8019d4:	e8 8b fb ff ff       	call   801564 <fd_lookup>
+  8019d9:	83 c4 10             	add    $0x10,%esp
+  8019dc:	85 c0                	test   %eax,%eax
+  8019de:	78 49                	js     801a29 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019e0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019e3:	83 ec 08             	sub    $0x8,%esp
+  8019e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019e9:	50                   	push   %eax
+  8019ea:	ff 36                	push   (%esi)
+  8019ec:	e8 c3 fb ff ff       	call   8015b4 <dev_lookup>
+  8019f1:	83 c4 10             	add    $0x10,%esp
+  8019f4:	85 c0                	test   %eax,%eax
+  8019f6:	78 31                	js     801a29 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8019f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019fb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8019ff:	74 2f                	je     801a30 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a01:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a04:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a0b:	00 00 00 
+	stat->st_isdir = 0;
+  801a0e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a15:	00 00 00 
+	stat->st_dev = dev;
+  801a18:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a1e:	83 ec 08             	sub    $0x8,%esp
+  801a21:	53                   	push   %ebx
+  801a22:	56                   	push   %esi
+  801a23:	ff 50 14             	call   *0x14(%eax)
+  801a26:	83 c4 10             	add    $0x10,%esp
+}
+  801a29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a2c:	5b                   	pop    %ebx
+  801a2d:	5e                   	pop    %esi
+  801a2e:	5d                   	pop    %ebp
+  801a2f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a35:	eb f2                	jmp    801a29 <fstat+0x67>
+
+00801a37 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a37:	55                   	push   %ebp
+  801a38:	89 e5                	mov    %esp,%ebp
+  801a3a:	56                   	push   %esi
+  801a3b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a3c:	83 ec 08             	sub    $0x8,%esp
+  801a3f:	6a 00                	push   $0x0
+  801a41:	ff 75 08             	push   0x8(%ebp)
+  801a44:	e8 e4 01 00 00       	call   801c2d <open>
+  801a49:	89 c3                	mov    %eax,%ebx
+  801a4b:	83 c4 10             	add    $0x10,%esp
+  801a4e:	85 c0                	test   %eax,%eax
+  801a50:	78 1b                	js     801a6d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801a52:	83 ec 08             	sub    $0x8,%esp
+  801a55:	ff 75 0c             	push   0xc(%ebp)
+  801a58:	50                   	push   %eax
+  801a59:	e8 64 ff ff ff       	call   8019c2 <fstat>
+  801a5e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a60:	89 1c 24             	mov    %ebx,(%esp)
+  801a63:	e8 26 fc ff ff       	call   80168e <close>
+	return r;
+  801a68:	83 c4 10             	add    $0x10,%esp
+  801a6b:	89 f3                	mov    %esi,%ebx
+}
+  801a6d:	89 d8                	mov    %ebx,%eax
+  801a6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a72:	5b                   	pop    %ebx
+  801a73:	5e                   	pop    %esi
+  801a74:	5d                   	pop    %ebp
+  801a75:	c3                   	ret
+
+00801a76 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a76:	55                   	push   %ebp
+  801a77:	89 e5                	mov    %esp,%ebp
+  801a79:	56                   	push   %esi
+  801a7a:	53                   	push   %ebx
+  801a7b:	89 c6                	mov    %eax,%esi
+  801a7d:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801a7f:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801a86:	74 27                	je     801aaf <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a88:	6a 07                	push   $0x7
+  801a8a:	68 00 60 80 00       	push   $0x806000
+  801a8f:	56                   	push   %esi
+  801a90:	ff 35 00 50 80 00    	push   0x805000
+  801a96:	e8 b5 0c 00 00       	call   802750 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801a9b:	83 c4 0c             	add    $0xc,%esp
+  801a9e:	6a 00                	push   $0x0
+  801aa0:	53                   	push   %ebx
+  801aa1:	6a 00                	push   $0x0
+  801aa3:	e8 30 0c 00 00       	call   8026d8 <ipc_recv>
+}
+  801aa8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aab:	5b                   	pop    %ebx
+  801aac:	5e                   	pop    %esi
+  801aad:	5d                   	pop    %ebp
+  801aae:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801aaf:	83 ec 0c             	sub    $0xc,%esp
+  801ab2:	6a 01                	push   $0x1
+  801ab4:	e8 eb 0c 00 00       	call   8027a4 <ipc_find_env>
+  801ab9:	a3 00 50 80 00       	mov    %eax,0x805000
+  801abe:	83 c4 10             	add    $0x10,%esp
+  801ac1:	eb c5                	jmp    801a88 <fsipc+0x12>
+
+00801ac3 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ac3:	55                   	push   %ebp
+  801ac4:	89 e5                	mov    %esp,%ebp
+  801ac6:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ac9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801acc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801acf:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801ad4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ad7:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801adc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae1:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ae6:	e8 8b ff ff ff       	call   801a76 <fsipc>
+}
+  801aeb:	c9                   	leave
+  801aec:	c3                   	ret
+
+00801aed <devfile_flush>:
+{
+  801aed:	55                   	push   %ebp
+  801aee:	89 e5                	mov    %esp,%ebp
+  801af0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801af3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801af9:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801afe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b03:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b08:	e8 69 ff ff ff       	call   801a76 <fsipc>
+}
+  801b0d:	c9                   	leave
+  801b0e:	c3                   	ret
+
+00801b0f <devfile_stat>:
+{
+  801b0f:	55                   	push   %ebp
+  801b10:	89 e5                	mov    %esp,%ebp
+  801b12:	53                   	push   %ebx
+  801b13:	83 ec 04             	sub    $0x4,%esp
+  801b16:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b19:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b1c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b1f:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b24:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b29:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b2e:	e8 43 ff ff ff       	call   801a76 <fsipc>
+  801b33:	85 c0                	test   %eax,%eax
+  801b35:	78 2c                	js     801b63 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b37:	83 ec 08             	sub    $0x8,%esp
+  801b3a:	68 00 60 80 00       	push   $0x806000
+  801b3f:	53                   	push   %ebx
+  801b40:	e8 ae ed ff ff       	call   8008f3 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b45:	a1 80 60 80 00       	mov    0x806080,%eax
+  801b4a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b50:	a1 84 60 80 00       	mov    0x806084,%eax
+  801b55:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801b5b:	83 c4 10             	add    $0x10,%esp
+  801b5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b66:	c9                   	leave
+  801b67:	c3                   	ret
+
+00801b68 <devfile_write>:
+{
+  801b68:	55                   	push   %ebp
+  801b69:	89 e5                	mov    %esp,%ebp
+  801b6b:	83 ec 0c             	sub    $0xc,%esp
+  801b6e:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801b71:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801b76:	39 d0                	cmp    %edx,%eax
+  801b78:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b7e:	8b 52 0c             	mov    0xc(%edx),%edx
+  801b81:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801b87:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801b8c:	50                   	push   %eax
+  801b8d:	ff 75 0c             	push   0xc(%ebp)
+  801b90:	68 08 60 80 00       	push   $0x806008
+  801b95:	e8 df ee ff ff       	call   800a79 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801b9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ba4:	e8 cd fe ff ff       	call   801a76 <fsipc>
+}
+  801ba9:	c9                   	leave
+  801baa:	c3                   	ret
+
+00801bab <devfile_read>:
+{
+  801bab:	55                   	push   %ebp
+  801bac:	89 e5                	mov    %esp,%ebp
+  801bae:	56                   	push   %esi
+  801baf:	53                   	push   %ebx
+  801bb0:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bb9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801bbe:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801bc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc9:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bce:	e8 a3 fe ff ff       	call   801a76 <fsipc>
+  801bd3:	89 c3                	mov    %eax,%ebx
+  801bd5:	85 c0                	test   %eax,%eax
+  801bd7:	78 1f                	js     801bf8 <devfile_read+0x4d>
+	assert(r <= n);
+  801bd9:	39 c6                	cmp    %eax,%esi
+  801bdb:	72 24                	jb     801c01 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801bdd:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801be2:	7f 33                	jg     801c17 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801be4:	83 ec 04             	sub    $0x4,%esp
+  801be7:	50                   	push   %eax
+  801be8:	68 00 60 80 00       	push   $0x806000
+  801bed:	ff 75 0c             	push   0xc(%ebp)
+  801bf0:	e8 84 ee ff ff       	call   800a79 <memmove>
+	return r;
+  801bf5:	83 c4 10             	add    $0x10,%esp
+}
+  801bf8:	89 d8                	mov    %ebx,%eax
+  801bfa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bfd:	5b                   	pop    %ebx
+  801bfe:	5e                   	pop    %esi
+  801bff:	5d                   	pop    %ebp
+  801c00:	c3                   	ret
+	assert(r <= n);
+  801c01:	68 50 32 80 00       	push   $0x803250
+  801c06:	68 57 32 80 00       	push   $0x803257
+  801c0b:	6a 7c                	push   $0x7c
+  801c0d:	68 6c 32 80 00       	push   $0x80326c
+  801c12:	e8 13 e6 ff ff       	call   80022a <_panic>
+	assert(r <= PGSIZE);
+  801c17:	68 77 32 80 00       	push   $0x803277
+  801c1c:	68 57 32 80 00       	push   $0x803257
+  801c21:	6a 7d                	push   $0x7d
+  801c23:	68 6c 32 80 00       	push   $0x80326c
+  801c28:	e8 fd e5 ff ff       	call   80022a <_panic>
+
+00801c2d <open>:
+{
+  801c2d:	55                   	push   %ebp
+  801c2e:	89 e5                	mov    %esp,%ebp
+  801c30:	56                   	push   %esi
+  801c31:	53                   	push   %ebx
+  801c32:	83 ec 1c             	sub    $0x1c,%esp
+  801c35:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801c38:	56                   	push   %esi
+  801c39:	e8 7a ec ff ff       	call   8008b8 <strlen>
+  801c3e:	83 c4 10             	add    $0x10,%esp
+  801c41:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c46:	7f 6c                	jg     801cb4 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801c48:	83 ec 0c             	sub    $0xc,%esp
+  801c4b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c4e:	50                   	push   %eax
+  801c4f:	e8 ba f8 ff ff       	call   80150e <fd_alloc>
+  801c54:	89 c3                	mov    %eax,%ebx
+  801c56:	83 c4 10             	add    $0x10,%esp
+  801c59:	85 c0                	test   %eax,%eax
+  801c5b:	78 3c                	js     801c99 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801c5d:	83 ec 08             	sub    $0x8,%esp
+  801c60:	56                   	push   %esi
+  801c61:	68 00 60 80 00       	push   $0x806000
+  801c66:	e8 88 ec ff ff       	call   8008f3 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801c6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c6e:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801c73:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c76:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c7b:	e8 f6 fd ff ff       	call   801a76 <fsipc>
+  801c80:	89 c3                	mov    %eax,%ebx
+  801c82:	83 c4 10             	add    $0x10,%esp
+  801c85:	85 c0                	test   %eax,%eax
+  801c87:	78 19                	js     801ca2 <open+0x75>
+	return fd2num(fd);
+  801c89:	83 ec 0c             	sub    $0xc,%esp
+  801c8c:	ff 75 f4             	push   -0xc(%ebp)
+  801c8f:	e8 53 f8 ff ff       	call   8014e7 <fd2num>
+  801c94:	89 c3                	mov    %eax,%ebx
+  801c96:	83 c4 10             	add    $0x10,%esp
+}
+  801c99:	89 d8                	mov    %ebx,%eax
+  801c9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c9e:	5b                   	pop    %ebx
+  801c9f:	5e                   	pop    %esi
+  801ca0:	5d                   	pop    %ebp
+  801ca1:	c3                   	ret
+		fd_close(fd, 0);
+  801ca2:	83 ec 08             	sub    $0x8,%esp
+  801ca5:	6a 00                	push   $0x0
+  801ca7:	ff 75 f4             	push   -0xc(%ebp)
+  801caa:	e8 58 f9 ff ff       	call   801607 <fd_close>
+		return r;
+  801caf:	83 c4 10             	add    $0x10,%esp
+  801cb2:	eb e5                	jmp    801c99 <open+0x6c>
+		return -E_BAD_PATH;
+  801cb4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801cb9:	eb de                	jmp    801c99 <open+0x6c>
+
+00801cbb <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801cbb:	55                   	push   %ebp
+  801cbc:	89 e5                	mov    %esp,%ebp
+  801cbe:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801cc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc6:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ccb:	e8 a6 fd ff ff       	call   801a76 <fsipc>
+}
+  801cd0:	c9                   	leave
+  801cd1:	c3                   	ret
+
+00801cd2 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cd2:	55                   	push   %ebp
+  801cd3:	89 e5                	mov    %esp,%ebp
+  801cd5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801cd8:	68 83 32 80 00       	push   $0x803283
+  801cdd:	ff 75 0c             	push   0xc(%ebp)
+  801ce0:	e8 0e ec ff ff       	call   8008f3 <strcpy>
+	return 0;
+}
+  801ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cea:	c9                   	leave
+  801ceb:	c3                   	ret
+
+00801cec <devsock_close>:
+{
+  801cec:	55                   	push   %ebp
+  801ced:	89 e5                	mov    %esp,%ebp
+  801cef:	53                   	push   %ebx
+  801cf0:	83 ec 10             	sub    $0x10,%esp
+  801cf3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801cf6:	53                   	push   %ebx
+  801cf7:	e8 b8 0a 00 00       	call   8027b4 <pageref>
+  801cfc:	89 c2                	mov    %eax,%edx
+  801cfe:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d01:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801d06:	83 fa 01             	cmp    $0x1,%edx
+  801d09:	74 05                	je     801d10 <devsock_close+0x24>
+}
+  801d0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d0e:	c9                   	leave
+  801d0f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801d10:	83 ec 0c             	sub    $0xc,%esp
+  801d13:	ff 73 0c             	push   0xc(%ebx)
+  801d16:	e8 b7 02 00 00       	call   801fd2 <nsipc_close>
+  801d1b:	83 c4 10             	add    $0x10,%esp
+  801d1e:	eb eb                	jmp    801d0b <devsock_close+0x1f>
+
+00801d20 <devsock_write>:
+{
+  801d20:	55                   	push   %ebp
+  801d21:	89 e5                	mov    %esp,%ebp
+  801d23:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801d26:	6a 00                	push   $0x0
+  801d28:	ff 75 10             	push   0x10(%ebp)
+  801d2b:	ff 75 0c             	push   0xc(%ebp)
+  801d2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d31:	ff 70 0c             	push   0xc(%eax)
+  801d34:	e8 79 03 00 00       	call   8020b2 <nsipc_send>
+}
+  801d39:	c9                   	leave
+  801d3a:	c3                   	ret
+
+00801d3b <devsock_read>:
+{
+  801d3b:	55                   	push   %ebp
+  801d3c:	89 e5                	mov    %esp,%ebp
+  801d3e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801d41:	6a 00                	push   $0x0
+  801d43:	ff 75 10             	push   0x10(%ebp)
+  801d46:	ff 75 0c             	push   0xc(%ebp)
+  801d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d4c:	ff 70 0c             	push   0xc(%eax)
+  801d4f:	e8 ef 02 00 00       	call   802043 <nsipc_recv>
+}
+  801d54:	c9                   	leave
+  801d55:	c3                   	ret
+
+00801d56 <fd2sockid>:
+{
+  801d56:	55                   	push   %ebp
+  801d57:	89 e5                	mov    %esp,%ebp
+  801d59:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d5c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d5f:	52                   	push   %edx
+  801d60:	50                   	push   %eax
+  801d61:	e8 fe f7 ff ff       	call   801564 <fd_lookup>
+  801d66:	83 c4 10             	add    $0x10,%esp
+  801d69:	85 c0                	test   %eax,%eax
+  801d6b:	78 10                	js     801d7d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d70:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801d76:	39 08                	cmp    %ecx,(%eax)
+  801d78:	75 05                	jne    801d7f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d7a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d7d:	c9                   	leave
+  801d7e:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d7f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d84:	eb f7                	jmp    801d7d <fd2sockid+0x27>
+
+00801d86 <alloc_sockfd>:
+{
+  801d86:	55                   	push   %ebp
+  801d87:	89 e5                	mov    %esp,%ebp
+  801d89:	56                   	push   %esi
+  801d8a:	53                   	push   %ebx
+  801d8b:	83 ec 1c             	sub    $0x1c,%esp
+  801d8e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d90:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d93:	50                   	push   %eax
+  801d94:	e8 75 f7 ff ff       	call   80150e <fd_alloc>
+  801d99:	89 c3                	mov    %eax,%ebx
+  801d9b:	83 c4 10             	add    $0x10,%esp
+  801d9e:	85 c0                	test   %eax,%eax
+  801da0:	78 43                	js     801de5 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801da2:	83 ec 04             	sub    $0x4,%esp
+  801da5:	68 07 04 00 00       	push   $0x407
+  801daa:	ff 75 f4             	push   -0xc(%ebp)
+  801dad:	6a 00                	push   $0x0
+  801daf:	e8 ac ef ff ff       	call   800d60 <sys_page_alloc>
+  801db4:	89 c3                	mov    %eax,%ebx
+  801db6:	83 c4 10             	add    $0x10,%esp
+  801db9:	85 c0                	test   %eax,%eax
+  801dbb:	78 28                	js     801de5 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801dbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc0:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801dc6:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801dc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dcb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801dd2:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801dd5:	83 ec 0c             	sub    $0xc,%esp
+  801dd8:	50                   	push   %eax
+  801dd9:	e8 09 f7 ff ff       	call   8014e7 <fd2num>
+  801dde:	89 c3                	mov    %eax,%ebx
+  801de0:	83 c4 10             	add    $0x10,%esp
+  801de3:	eb 0c                	jmp    801df1 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801de5:	83 ec 0c             	sub    $0xc,%esp
+  801de8:	56                   	push   %esi
+  801de9:	e8 e4 01 00 00       	call   801fd2 <nsipc_close>
+		return r;
+  801dee:	83 c4 10             	add    $0x10,%esp
+}
+  801df1:	89 d8                	mov    %ebx,%eax
+  801df3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df6:	5b                   	pop    %ebx
+  801df7:	5e                   	pop    %esi
+  801df8:	5d                   	pop    %ebp
+  801df9:	c3                   	ret
+
+00801dfa <accept>:
+{
+  801dfa:	55                   	push   %ebp
+  801dfb:	89 e5                	mov    %esp,%ebp
+  801dfd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e00:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e03:	e8 4e ff ff ff       	call   801d56 <fd2sockid>
+  801e08:	85 c0                	test   %eax,%eax
+  801e0a:	78 1b                	js     801e27 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801e0c:	83 ec 04             	sub    $0x4,%esp
+  801e0f:	ff 75 10             	push   0x10(%ebp)
+  801e12:	ff 75 0c             	push   0xc(%ebp)
+  801e15:	50                   	push   %eax
+  801e16:	e8 0e 01 00 00       	call   801f29 <nsipc_accept>
+  801e1b:	83 c4 10             	add    $0x10,%esp
+  801e1e:	85 c0                	test   %eax,%eax
+  801e20:	78 05                	js     801e27 <accept+0x2d>
+	return alloc_sockfd(r);
+  801e22:	e8 5f ff ff ff       	call   801d86 <alloc_sockfd>
+}
+  801e27:	c9                   	leave
+  801e28:	c3                   	ret
+
+00801e29 <bind>:
+{
+  801e29:	55                   	push   %ebp
+  801e2a:	89 e5                	mov    %esp,%ebp
+  801e2c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e32:	e8 1f ff ff ff       	call   801d56 <fd2sockid>
+  801e37:	85 c0                	test   %eax,%eax
+  801e39:	78 12                	js     801e4d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e3b:	83 ec 04             	sub    $0x4,%esp
+  801e3e:	ff 75 10             	push   0x10(%ebp)
+  801e41:	ff 75 0c             	push   0xc(%ebp)
+  801e44:	50                   	push   %eax
+  801e45:	e8 31 01 00 00       	call   801f7b <nsipc_bind>
+  801e4a:	83 c4 10             	add    $0x10,%esp
+}
+  801e4d:	c9                   	leave
+  801e4e:	c3                   	ret
+
+00801e4f <shutdown>:
+{
+  801e4f:	55                   	push   %ebp
+  801e50:	89 e5                	mov    %esp,%ebp
+  801e52:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e58:	e8 f9 fe ff ff       	call   801d56 <fd2sockid>
+  801e5d:	85 c0                	test   %eax,%eax
+  801e5f:	78 0f                	js     801e70 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e61:	83 ec 08             	sub    $0x8,%esp
+  801e64:	ff 75 0c             	push   0xc(%ebp)
+  801e67:	50                   	push   %eax
+  801e68:	e8 43 01 00 00       	call   801fb0 <nsipc_shutdown>
+  801e6d:	83 c4 10             	add    $0x10,%esp
+}
+  801e70:	c9                   	leave
+  801e71:	c3                   	ret
+
+00801e72 <connect>:
+{
+  801e72:	55                   	push   %ebp
+  801e73:	89 e5                	mov    %esp,%ebp
+  801e75:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e7b:	e8 d6 fe ff ff       	call   801d56 <fd2sockid>
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	78 12                	js     801e96 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e84:	83 ec 04             	sub    $0x4,%esp
+  801e87:	ff 75 10             	push   0x10(%ebp)
+  801e8a:	ff 75 0c             	push   0xc(%ebp)
+  801e8d:	50                   	push   %eax
+  801e8e:	e8 59 01 00 00       	call   801fec <nsipc_connect>
+  801e93:	83 c4 10             	add    $0x10,%esp
+}
+  801e96:	c9                   	leave
+  801e97:	c3                   	ret
+
+00801e98 <listen>:
+{
+  801e98:	55                   	push   %ebp
+  801e99:	89 e5                	mov    %esp,%ebp
+  801e9b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea1:	e8 b0 fe ff ff       	call   801d56 <fd2sockid>
+  801ea6:	85 c0                	test   %eax,%eax
+  801ea8:	78 0f                	js     801eb9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801eaa:	83 ec 08             	sub    $0x8,%esp
+  801ead:	ff 75 0c             	push   0xc(%ebp)
+  801eb0:	50                   	push   %eax
+  801eb1:	e8 6b 01 00 00       	call   802021 <nsipc_listen>
+  801eb6:	83 c4 10             	add    $0x10,%esp
+}
+  801eb9:	c9                   	leave
+  801eba:	c3                   	ret
+
+00801ebb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801ebb:	55                   	push   %ebp
+  801ebc:	89 e5                	mov    %esp,%ebp
+  801ebe:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801ec1:	ff 75 10             	push   0x10(%ebp)
+  801ec4:	ff 75 0c             	push   0xc(%ebp)
+  801ec7:	ff 75 08             	push   0x8(%ebp)
+  801eca:	e8 41 02 00 00       	call   802110 <nsipc_socket>
+  801ecf:	83 c4 10             	add    $0x10,%esp
+  801ed2:	85 c0                	test   %eax,%eax
+  801ed4:	78 05                	js     801edb <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801ed6:	e8 ab fe ff ff       	call   801d86 <alloc_sockfd>
+}
+  801edb:	c9                   	leave
+  801edc:	c3                   	ret
+
+00801edd <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801edd:	55                   	push   %ebp
+  801ede:	89 e5                	mov    %esp,%ebp
+  801ee0:	53                   	push   %ebx
+  801ee1:	83 ec 04             	sub    $0x4,%esp
+  801ee4:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801ee6:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801eed:	74 26                	je     801f15 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801eef:	6a 07                	push   $0x7
+  801ef1:	68 00 70 80 00       	push   $0x807000
+  801ef6:	53                   	push   %ebx
+  801ef7:	ff 35 04 50 80 00    	push   0x805004
+  801efd:	e8 4e 08 00 00       	call   802750 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f02:	83 c4 0c             	add    $0xc,%esp
+  801f05:	6a 00                	push   $0x0
+  801f07:	6a 00                	push   $0x0
+  801f09:	6a 00                	push   $0x0
+  801f0b:	e8 c8 07 00 00       	call   8026d8 <ipc_recv>
+}
+  801f10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f13:	c9                   	leave
+  801f14:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f15:	83 ec 0c             	sub    $0xc,%esp
+  801f18:	6a 02                	push   $0x2
+  801f1a:	e8 85 08 00 00       	call   8027a4 <ipc_find_env>
+  801f1f:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f24:	83 c4 10             	add    $0x10,%esp
+  801f27:	eb c6                	jmp    801eef <nsipc+0x12>
+
+00801f29 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801f29:	55                   	push   %ebp
+  801f2a:	89 e5                	mov    %esp,%ebp
+  801f2c:	56                   	push   %esi
+  801f2d:	53                   	push   %ebx
+  801f2e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801f31:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f34:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801f39:	8b 06                	mov    (%esi),%eax
+  801f3b:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801f40:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f45:	e8 93 ff ff ff       	call   801edd <nsipc>
+  801f4a:	89 c3                	mov    %eax,%ebx
+  801f4c:	85 c0                	test   %eax,%eax
+  801f4e:	79 09                	jns    801f59 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801f50:	89 d8                	mov    %ebx,%eax
+  801f52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f55:	5b                   	pop    %ebx
+  801f56:	5e                   	pop    %esi
+  801f57:	5d                   	pop    %ebp
+  801f58:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801f59:	83 ec 04             	sub    $0x4,%esp
+  801f5c:	ff 35 10 70 80 00    	push   0x807010
+  801f62:	68 00 70 80 00       	push   $0x807000
+  801f67:	ff 75 0c             	push   0xc(%ebp)
+  801f6a:	e8 0a eb ff ff       	call   800a79 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f6f:	a1 10 70 80 00       	mov    0x807010,%eax
+  801f74:	89 06                	mov    %eax,(%esi)
+  801f76:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f79:	eb d5                	jmp    801f50 <nsipc_accept+0x27>
+
+00801f7b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+  801f7e:	53                   	push   %ebx
+  801f7f:	83 ec 08             	sub    $0x8,%esp
+  801f82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f88:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f8d:	53                   	push   %ebx
+  801f8e:	ff 75 0c             	push   0xc(%ebp)
+  801f91:	68 04 70 80 00       	push   $0x807004
+  801f96:	e8 de ea ff ff       	call   800a79 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f9b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801fa1:	b8 02 00 00 00       	mov    $0x2,%eax
+  801fa6:	e8 32 ff ff ff       	call   801edd <nsipc>
+}
+  801fab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fae:	c9                   	leave
+  801faf:	c3                   	ret
+
+00801fb0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801fb0:	55                   	push   %ebp
+  801fb1:	89 e5                	mov    %esp,%ebp
+  801fb3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801fb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801fbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc1:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801fc6:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fcb:	e8 0d ff ff ff       	call   801edd <nsipc>
+}
+  801fd0:	c9                   	leave
+  801fd1:	c3                   	ret
+
+00801fd2 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801fd2:	55                   	push   %ebp
+  801fd3:	89 e5                	mov    %esp,%ebp
+  801fd5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801fd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fdb:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801fe0:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fe5:	e8 f3 fe ff ff       	call   801edd <nsipc>
+}
+  801fea:	c9                   	leave
+  801feb:	c3                   	ret
+
+00801fec <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801fec:	55                   	push   %ebp
+  801fed:	89 e5                	mov    %esp,%ebp
+  801fef:	53                   	push   %ebx
+  801ff0:	83 ec 08             	sub    $0x8,%esp
+  801ff3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801ff6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff9:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801ffe:	53                   	push   %ebx
+  801fff:	ff 75 0c             	push   0xc(%ebp)
+  802002:	68 04 70 80 00       	push   $0x807004
+  802007:	e8 6d ea ff ff       	call   800a79 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80200c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802012:	b8 05 00 00 00       	mov    $0x5,%eax
+  802017:	e8 c1 fe ff ff       	call   801edd <nsipc>
+}
+  80201c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80201f:	c9                   	leave
+  802020:	c3                   	ret
+
+00802021 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802027:	8b 45 08             	mov    0x8(%ebp),%eax
+  80202a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80202f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802032:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802037:	b8 06 00 00 00       	mov    $0x6,%eax
+  80203c:	e8 9c fe ff ff       	call   801edd <nsipc>
+}
+  802041:	c9                   	leave
+  802042:	c3                   	ret
+
+00802043 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802043:	55                   	push   %ebp
+  802044:	89 e5                	mov    %esp,%ebp
+  802046:	56                   	push   %esi
+  802047:	53                   	push   %ebx
+  802048:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80204b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80204e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802053:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802059:	8b 45 14             	mov    0x14(%ebp),%eax
+  80205c:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802061:	b8 07 00 00 00       	mov    $0x7,%eax
+  802066:	e8 72 fe ff ff       	call   801edd <nsipc>
+  80206b:	89 c3                	mov    %eax,%ebx
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	78 22                	js     802093 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802071:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802076:	39 c6                	cmp    %eax,%esi
+  802078:	0f 4e c6             	cmovle %esi,%eax
+  80207b:	39 c3                	cmp    %eax,%ebx
+  80207d:	7f 1d                	jg     80209c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80207f:	83 ec 04             	sub    $0x4,%esp
+  802082:	53                   	push   %ebx
+  802083:	68 00 70 80 00       	push   $0x807000
+  802088:	ff 75 0c             	push   0xc(%ebp)
+  80208b:	e8 e9 e9 ff ff       	call   800a79 <memmove>
+  802090:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802093:	89 d8                	mov    %ebx,%eax
+  802095:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802098:	5b                   	pop    %ebx
+  802099:	5e                   	pop    %esi
+  80209a:	5d                   	pop    %ebp
+  80209b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80209c:	68 8f 32 80 00       	push   $0x80328f
+  8020a1:	68 57 32 80 00       	push   $0x803257
+  8020a6:	6a 62                	push   $0x62
+  8020a8:	68 a4 32 80 00       	push   $0x8032a4
+  8020ad:	e8 78 e1 ff ff       	call   80022a <_panic>
+
+008020b2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8020b2:	55                   	push   %ebp
+  8020b3:	89 e5                	mov    %esp,%ebp
+  8020b5:	53                   	push   %ebx
+  8020b6:	83 ec 04             	sub    $0x4,%esp
+  8020b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8020bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020bf:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8020c4:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8020ca:	7f 2e                	jg     8020fa <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8020cc:	83 ec 04             	sub    $0x4,%esp
+  8020cf:	53                   	push   %ebx
+  8020d0:	ff 75 0c             	push   0xc(%ebp)
+  8020d3:	68 0c 70 80 00       	push   $0x80700c
+  8020d8:	e8 9c e9 ff ff       	call   800a79 <memmove>
+	nsipcbuf.send.req_size = size;
+  8020dd:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8020e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020e6:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8020eb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020f0:	e8 e8 fd ff ff       	call   801edd <nsipc>
+}
+  8020f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020f8:	c9                   	leave
+  8020f9:	c3                   	ret
+	assert(size < 1600);
+  8020fa:	68 b0 32 80 00       	push   $0x8032b0
+  8020ff:	68 57 32 80 00       	push   $0x803257
+  802104:	6a 6d                	push   $0x6d
+  802106:	68 a4 32 80 00       	push   $0x8032a4
+  80210b:	e8 1a e1 ff ff       	call   80022a <_panic>
+
+00802110 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802110:	55                   	push   %ebp
+  802111:	89 e5                	mov    %esp,%ebp
+  802113:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802116:	8b 45 08             	mov    0x8(%ebp),%eax
+  802119:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80211e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802121:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802126:	8b 45 10             	mov    0x10(%ebp),%eax
+  802129:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80212e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802133:	e8 a5 fd ff ff       	call   801edd <nsipc>
+}
+  802138:	c9                   	leave
+  802139:	c3                   	ret
+
+0080213a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80213a:	55                   	push   %ebp
+  80213b:	89 e5                	mov    %esp,%ebp
+  80213d:	56                   	push   %esi
+  80213e:	53                   	push   %ebx
+  80213f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802142:	83 ec 0c             	sub    $0xc,%esp
+  802145:	ff 75 08             	push   0x8(%ebp)
+  802148:	e8 aa f3 ff ff       	call   8014f7 <fd2data>
+  80214d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80214f:	83 c4 08             	add    $0x8,%esp
+  802152:	68 bc 32 80 00       	push   $0x8032bc
+  802157:	53                   	push   %ebx
+  802158:	e8 96 e7 ff ff       	call   8008f3 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80215d:	8b 46 04             	mov    0x4(%esi),%eax
+  802160:	2b 06                	sub    (%esi),%eax
+  802162:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802168:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80216f:	00 00 00 
+	stat->st_dev = &devpipe;
+  802172:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802179:	40 80 00 
+	return 0;
+}
+  80217c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802181:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802184:	5b                   	pop    %ebx
+  802185:	5e                   	pop    %esi
+  802186:	5d                   	pop    %ebp
+  802187:	c3                   	ret
+
+00802188 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802188:	55                   	push   %ebp
+  802189:	89 e5                	mov    %esp,%ebp
+  80218b:	53                   	push   %ebx
+  80218c:	83 ec 0c             	sub    $0xc,%esp
+  80218f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802192:	53                   	push   %ebx
+  802193:	6a 00                	push   $0x0
+  802195:	e8 8e ec ff ff       	call   800e28 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80219a:	89 1c 24             	mov    %ebx,(%esp)
+  80219d:	e8 55 f3 ff ff       	call   8014f7 <fd2data>
+  8021a2:	83 c4 08             	add    $0x8,%esp
+  8021a5:	50                   	push   %eax
+  8021a6:	6a 00                	push   $0x0
+  8021a8:	e8 7b ec ff ff       	call   800e28 <sys_page_unmap>
+}
+  8021ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b0:	c9                   	leave
+  8021b1:	c3                   	ret
+
+008021b2 <_pipeisclosed>:
+{
+  8021b2:	55                   	push   %ebp
+  8021b3:	89 e5                	mov    %esp,%ebp
+  8021b5:	57                   	push   %edi
+  8021b6:	56                   	push   %esi
+  8021b7:	53                   	push   %ebx
+  8021b8:	83 ec 1c             	sub    $0x1c,%esp
+  8021bb:	89 c7                	mov    %eax,%edi
+  8021bd:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8021bf:	a1 20 54 80 00       	mov    0x805420,%eax
+  8021c4:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8021c7:	83 ec 0c             	sub    $0xc,%esp
+  8021ca:	57                   	push   %edi
+  8021cb:	e8 e4 05 00 00       	call   8027b4 <pageref>
+  8021d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021d3:	89 34 24             	mov    %esi,(%esp)
+  8021d6:	e8 d9 05 00 00       	call   8027b4 <pageref>
+		nn = thisenv->env_runs;
+  8021db:	8b 15 20 54 80 00    	mov    0x805420,%edx
+  8021e1:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8021e4:	83 c4 10             	add    $0x10,%esp
+  8021e7:	39 cb                	cmp    %ecx,%ebx
+  8021e9:	74 1b                	je     802206 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8021eb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021ee:	75 cf                	jne    8021bf <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8021f0:	8b 42 5c             	mov    0x5c(%edx),%eax
+  8021f3:	6a 01                	push   $0x1
+  8021f5:	50                   	push   %eax
+  8021f6:	53                   	push   %ebx
+  8021f7:	68 c3 32 80 00       	push   $0x8032c3
+  8021fc:	e8 04 e1 ff ff       	call   800305 <cprintf>
+  802201:	83 c4 10             	add    $0x10,%esp
+  802204:	eb b9                	jmp    8021bf <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802206:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802209:	0f 94 c0             	sete   %al
+  80220c:	0f b6 c0             	movzbl %al,%eax
+}
+  80220f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802212:	5b                   	pop    %ebx
+  802213:	5e                   	pop    %esi
+  802214:	5f                   	pop    %edi
+  802215:	5d                   	pop    %ebp
+  802216:	c3                   	ret
+
+00802217 <devpipe_write>:
+{
+  802217:	55                   	push   %ebp
+  802218:	89 e5                	mov    %esp,%ebp
+  80221a:	57                   	push   %edi
+  80221b:	56                   	push   %esi
+  80221c:	53                   	push   %ebx
+  80221d:	83 ec 28             	sub    $0x28,%esp
+  802220:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802223:	56                   	push   %esi
+  802224:	e8 ce f2 ff ff       	call   8014f7 <fd2data>
+  802229:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80222b:	83 c4 10             	add    $0x10,%esp
+  80222e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802233:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802236:	75 09                	jne    802241 <devpipe_write+0x2a>
+	return i;
+  802238:	89 f8                	mov    %edi,%eax
+  80223a:	eb 23                	jmp    80225f <devpipe_write+0x48>
+			sys_yield();
+  80223c:	e8 9f ea ff ff       	call   800ce0 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802241:	8b 43 04             	mov    0x4(%ebx),%eax
+  802244:	8b 0b                	mov    (%ebx),%ecx
+  802246:	8d 51 20             	lea    0x20(%ecx),%edx
+  802249:	39 d0                	cmp    %edx,%eax
+  80224b:	72 1a                	jb     802267 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80224d:	89 da                	mov    %ebx,%edx
+  80224f:	89 f0                	mov    %esi,%eax
+  802251:	e8 5c ff ff ff       	call   8021b2 <_pipeisclosed>
+  802256:	85 c0                	test   %eax,%eax
+  802258:	74 e2                	je     80223c <devpipe_write+0x25>
+				return 0;
+  80225a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80225f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802262:	5b                   	pop    %ebx
+  802263:	5e                   	pop    %esi
+  802264:	5f                   	pop    %edi
+  802265:	5d                   	pop    %ebp
+  802266:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80226a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80226e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802271:	89 c2                	mov    %eax,%edx
+  802273:	c1 fa 1f             	sar    $0x1f,%edx
+  802276:	89 d1                	mov    %edx,%ecx
+  802278:	c1 e9 1b             	shr    $0x1b,%ecx
+  80227b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80227e:	83 e2 1f             	and    $0x1f,%edx
+  802281:	29 ca                	sub    %ecx,%edx
+  802283:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802287:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80228b:	83 c0 01             	add    $0x1,%eax
+  80228e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802291:	83 c7 01             	add    $0x1,%edi
+  802294:	eb 9d                	jmp    802233 <devpipe_write+0x1c>
+
+00802296 <devpipe_read>:
+{
+  802296:	55                   	push   %ebp
+  802297:	89 e5                	mov    %esp,%ebp
+  802299:	57                   	push   %edi
+  80229a:	56                   	push   %esi
+  80229b:	53                   	push   %ebx
+  80229c:	83 ec 18             	sub    $0x18,%esp
+  80229f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8022a2:	57                   	push   %edi
+  8022a3:	e8 4f f2 ff ff       	call   8014f7 <fd2data>
+  8022a8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8022aa:	83 c4 10             	add    $0x10,%esp
+  8022ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022b5:	75 13                	jne    8022ca <devpipe_read+0x34>
+	return i;
+  8022b7:	89 f0                	mov    %esi,%eax
+  8022b9:	eb 02                	jmp    8022bd <devpipe_read+0x27>
+				return i;
+  8022bb:	89 f0                	mov    %esi,%eax
+}
+  8022bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c0:	5b                   	pop    %ebx
+  8022c1:	5e                   	pop    %esi
+  8022c2:	5f                   	pop    %edi
+  8022c3:	5d                   	pop    %ebp
+  8022c4:	c3                   	ret
+			sys_yield();
+  8022c5:	e8 16 ea ff ff       	call   800ce0 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8022ca:	8b 03                	mov    (%ebx),%eax
+  8022cc:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8022cf:	75 18                	jne    8022e9 <devpipe_read+0x53>
+			if (i > 0)
+  8022d1:	85 f6                	test   %esi,%esi
+  8022d3:	75 e6                	jne    8022bb <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8022d5:	89 da                	mov    %ebx,%edx
+  8022d7:	89 f8                	mov    %edi,%eax
+  8022d9:	e8 d4 fe ff ff       	call   8021b2 <_pipeisclosed>
+  8022de:	85 c0                	test   %eax,%eax
+  8022e0:	74 e3                	je     8022c5 <devpipe_read+0x2f>
+				return 0;
+  8022e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e7:	eb d4                	jmp    8022bd <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8022e9:	99                   	cltd
+  8022ea:	c1 ea 1b             	shr    $0x1b,%edx
+  8022ed:	01 d0                	add    %edx,%eax
+  8022ef:	83 e0 1f             	and    $0x1f,%eax
+  8022f2:	29 d0                	sub    %edx,%eax
+  8022f4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8022f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022fc:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8022ff:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802302:	83 c6 01             	add    $0x1,%esi
+  802305:	eb ab                	jmp    8022b2 <devpipe_read+0x1c>
+
+00802307 <pipe>:
+{
+  802307:	55                   	push   %ebp
+  802308:	89 e5                	mov    %esp,%ebp
+  80230a:	56                   	push   %esi
+  80230b:	53                   	push   %ebx
+  80230c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80230f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802312:	50                   	push   %eax
+  802313:	e8 f6 f1 ff ff       	call   80150e <fd_alloc>
+  802318:	89 c3                	mov    %eax,%ebx
+  80231a:	83 c4 10             	add    $0x10,%esp
+  80231d:	85 c0                	test   %eax,%eax
+  80231f:	0f 88 23 01 00 00    	js     802448 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802325:	83 ec 04             	sub    $0x4,%esp
+  802328:	68 07 04 00 00       	push   $0x407
+  80232d:	ff 75 f4             	push   -0xc(%ebp)
+  802330:	6a 00                	push   $0x0
+  802332:	e8 29 ea ff ff       	call   800d60 <sys_page_alloc>
+  802337:	89 c3                	mov    %eax,%ebx
+  802339:	83 c4 10             	add    $0x10,%esp
+  80233c:	85 c0                	test   %eax,%eax
+  80233e:	0f 88 04 01 00 00    	js     802448 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802344:	83 ec 0c             	sub    $0xc,%esp
+  802347:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80234a:	50                   	push   %eax
+  80234b:	e8 be f1 ff ff       	call   80150e <fd_alloc>
+  802350:	89 c3                	mov    %eax,%ebx
+  802352:	83 c4 10             	add    $0x10,%esp
+  802355:	85 c0                	test   %eax,%eax
+  802357:	0f 88 db 00 00 00    	js     802438 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80235d:	83 ec 04             	sub    $0x4,%esp
+  802360:	68 07 04 00 00       	push   $0x407
+  802365:	ff 75 f0             	push   -0x10(%ebp)
+  802368:	6a 00                	push   $0x0
+  80236a:	e8 f1 e9 ff ff       	call   800d60 <sys_page_alloc>
+  80236f:	89 c3                	mov    %eax,%ebx
+  802371:	83 c4 10             	add    $0x10,%esp
+  802374:	85 c0                	test   %eax,%eax
+  802376:	0f 88 bc 00 00 00    	js     802438 <pipe+0x131>
+	va = fd2data(fd0);
+  80237c:	83 ec 0c             	sub    $0xc,%esp
+  80237f:	ff 75 f4             	push   -0xc(%ebp)
+  802382:	e8 70 f1 ff ff       	call   8014f7 <fd2data>
+  802387:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802389:	83 c4 0c             	add    $0xc,%esp
+  80238c:	68 07 04 00 00       	push   $0x407
+  802391:	50                   	push   %eax
+  802392:	6a 00                	push   $0x0
+  802394:	e8 c7 e9 ff ff       	call   800d60 <sys_page_alloc>
+  802399:	89 c3                	mov    %eax,%ebx
+  80239b:	83 c4 10             	add    $0x10,%esp
+  80239e:	85 c0                	test   %eax,%eax
+  8023a0:	0f 88 82 00 00 00    	js     802428 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023a6:	83 ec 0c             	sub    $0xc,%esp
+  8023a9:	ff 75 f0             	push   -0x10(%ebp)
+  8023ac:	e8 46 f1 ff ff       	call   8014f7 <fd2data>
+  8023b1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8023b8:	50                   	push   %eax
+  8023b9:	6a 00                	push   $0x0
+  8023bb:	56                   	push   %esi
+  8023bc:	6a 00                	push   $0x0
+  8023be:	e8 23 ea ff ff       	call   800de6 <sys_page_map>
+  8023c3:	89 c3                	mov    %eax,%ebx
+  8023c5:	83 c4 20             	add    $0x20,%esp
+  8023c8:	85 c0                	test   %eax,%eax
+  8023ca:	78 4e                	js     80241a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8023cc:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8023d1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023d4:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8023d6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023d9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8023e0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8023e3:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8023e5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8023e8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8023ef:	83 ec 0c             	sub    $0xc,%esp
+  8023f2:	ff 75 f4             	push   -0xc(%ebp)
+  8023f5:	e8 ed f0 ff ff       	call   8014e7 <fd2num>
+  8023fa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8023fd:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8023ff:	83 c4 04             	add    $0x4,%esp
+  802402:	ff 75 f0             	push   -0x10(%ebp)
+  802405:	e8 dd f0 ff ff       	call   8014e7 <fd2num>
+  80240a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80240d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802410:	83 c4 10             	add    $0x10,%esp
+  802413:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802418:	eb 2e                	jmp    802448 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80241a:	83 ec 08             	sub    $0x8,%esp
+  80241d:	56                   	push   %esi
+  80241e:	6a 00                	push   $0x0
+  802420:	e8 03 ea ff ff       	call   800e28 <sys_page_unmap>
+  802425:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802428:	83 ec 08             	sub    $0x8,%esp
+  80242b:	ff 75 f0             	push   -0x10(%ebp)
+  80242e:	6a 00                	push   $0x0
+  802430:	e8 f3 e9 ff ff       	call   800e28 <sys_page_unmap>
+  802435:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802438:	83 ec 08             	sub    $0x8,%esp
+  80243b:	ff 75 f4             	push   -0xc(%ebp)
+  80243e:	6a 00                	push   $0x0
+  802440:	e8 e3 e9 ff ff       	call   800e28 <sys_page_unmap>
+  802445:	83 c4 10             	add    $0x10,%esp
+}
+  802448:	89 d8                	mov    %ebx,%eax
+  80244a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80244d:	5b                   	pop    %ebx
+  80244e:	5e                   	pop    %esi
+  80244f:	5d                   	pop    %ebp
+  802450:	c3                   	ret
+
+00802451 <pipeisclosed>:
+{
+  802451:	55                   	push   %ebp
+  802452:	89 e5                	mov    %esp,%ebp
+  802454:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802457:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80245a:	50                   	push   %eax
+  80245b:	ff 75 08             	push   0x8(%ebp)
+  80245e:	e8 01 f1 ff ff       	call   801564 <fd_lookup>
+  802463:	83 c4 10             	add    $0x10,%esp
+  802466:	85 c0                	test   %eax,%eax
+  802468:	78 18                	js     802482 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80246a:	83 ec 0c             	sub    $0xc,%esp
+  80246d:	ff 75 f4             	push   -0xc(%ebp)
+  802470:	e8 82 f0 ff ff       	call   8014f7 <fd2data>
+  802475:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802477:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80247a:	e8 33 fd ff ff       	call   8021b2 <_pipeisclosed>
+  80247f:	83 c4 10             	add    $0x10,%esp
+}
+  802482:	c9                   	leave
+  802483:	c3                   	ret
+
+00802484 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802484:	55                   	push   %ebp
+  802485:	89 e5                	mov    %esp,%ebp
+  802487:	56                   	push   %esi
+  802488:	53                   	push   %ebx
+  802489:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  80248c:	85 f6                	test   %esi,%esi
+  80248e:	74 13                	je     8024a3 <wait+0x1f>
+	e = &envs[ENVX(envid)];
+  802490:	89 f3                	mov    %esi,%ebx
+  802492:	81 e3 ff 1f 00 00    	and    $0x1fff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  802498:	c1 e3 09             	shl    $0x9,%ebx
+  80249b:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8024a1:	eb 1b                	jmp    8024be <wait+0x3a>
+	assert(envid != 0);
+  8024a3:	68 db 32 80 00       	push   $0x8032db
+  8024a8:	68 57 32 80 00       	push   $0x803257
+  8024ad:	6a 09                	push   $0x9
+  8024af:	68 e6 32 80 00       	push   $0x8032e6
+  8024b4:	e8 71 dd ff ff       	call   80022a <_panic>
+		sys_yield();
+  8024b9:	e8 22 e8 ff ff       	call   800ce0 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8024be:	8b 43 4c             	mov    0x4c(%ebx),%eax
+  8024c1:	39 f0                	cmp    %esi,%eax
+  8024c3:	75 07                	jne    8024cc <wait+0x48>
+  8024c5:	8b 43 58             	mov    0x58(%ebx),%eax
+  8024c8:	85 c0                	test   %eax,%eax
+  8024ca:	75 ed                	jne    8024b9 <wait+0x35>
+}
+  8024cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024cf:	5b                   	pop    %ebx
+  8024d0:	5e                   	pop    %esi
+  8024d1:	5d                   	pop    %ebp
+  8024d2:	c3                   	ret
+
+008024d3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8024d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d8:	c3                   	ret
+
+008024d9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024d9:	55                   	push   %ebp
+  8024da:	89 e5                	mov    %esp,%ebp
+  8024dc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8024df:	68 f1 32 80 00       	push   $0x8032f1
+  8024e4:	ff 75 0c             	push   0xc(%ebp)
+  8024e7:	e8 07 e4 ff ff       	call   8008f3 <strcpy>
+	return 0;
+}
+  8024ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f1:	c9                   	leave
+  8024f2:	c3                   	ret
+
+008024f3 <devcons_write>:
+{
+  8024f3:	55                   	push   %ebp
+  8024f4:	89 e5                	mov    %esp,%ebp
+  8024f6:	57                   	push   %edi
+  8024f7:	56                   	push   %esi
+  8024f8:	53                   	push   %ebx
+  8024f9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8024ff:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802504:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80250a:	eb 2e                	jmp    80253a <devcons_write+0x47>
+		m = n - tot;
+  80250c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80250f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802511:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802516:	39 c3                	cmp    %eax,%ebx
+  802518:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80251b:	83 ec 04             	sub    $0x4,%esp
+  80251e:	53                   	push   %ebx
+  80251f:	89 f0                	mov    %esi,%eax
+  802521:	03 45 0c             	add    0xc(%ebp),%eax
+  802524:	50                   	push   %eax
+  802525:	57                   	push   %edi
+  802526:	e8 4e e5 ff ff       	call   800a79 <memmove>
+		sys_cputs(buf, m);
+  80252b:	83 c4 08             	add    $0x8,%esp
+  80252e:	53                   	push   %ebx
+  80252f:	57                   	push   %edi
+  802530:	e8 ee e6 ff ff       	call   800c23 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802535:	01 de                	add    %ebx,%esi
+  802537:	83 c4 10             	add    $0x10,%esp
+  80253a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80253d:	72 cd                	jb     80250c <devcons_write+0x19>
+}
+  80253f:	89 f0                	mov    %esi,%eax
+  802541:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802544:	5b                   	pop    %ebx
+  802545:	5e                   	pop    %esi
+  802546:	5f                   	pop    %edi
+  802547:	5d                   	pop    %ebp
+  802548:	c3                   	ret
+
+00802549 <devcons_read>:
+{
+  802549:	55                   	push   %ebp
+  80254a:	89 e5                	mov    %esp,%ebp
+  80254c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80254f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802554:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802558:	75 07                	jne    802561 <devcons_read+0x18>
+  80255a:	eb 1f                	jmp    80257b <devcons_read+0x32>
+		sys_yield();
+  80255c:	e8 7f e7 ff ff       	call   800ce0 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802561:	e8 db e6 ff ff       	call   800c41 <sys_cgetc>
+  802566:	85 c0                	test   %eax,%eax
+  802568:	74 f2                	je     80255c <devcons_read+0x13>
+	if (c < 0)
+  80256a:	78 0f                	js     80257b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80256c:	83 f8 04             	cmp    $0x4,%eax
+  80256f:	74 0c                	je     80257d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802571:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802574:	88 02                	mov    %al,(%edx)
+	return 1;
+  802576:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80257b:	c9                   	leave
+  80257c:	c3                   	ret
+		return 0;
+  80257d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802582:	eb f7                	jmp    80257b <devcons_read+0x32>
+
+00802584 <cputchar>:
+{
+  802584:	55                   	push   %ebp
+  802585:	89 e5                	mov    %esp,%ebp
+  802587:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80258a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80258d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802590:	6a 01                	push   $0x1
+  802592:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802595:	50                   	push   %eax
+  802596:	e8 88 e6 ff ff       	call   800c23 <sys_cputs>
+}
+  80259b:	83 c4 10             	add    $0x10,%esp
+  80259e:	c9                   	leave
+  80259f:	c3                   	ret
+
+008025a0 <getchar>:
+{
+  8025a0:	55                   	push   %ebp
+  8025a1:	89 e5                	mov    %esp,%ebp
+  8025a3:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8025a6:	6a 01                	push   $0x1
+  8025a8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8025ab:	50                   	push   %eax
+  8025ac:	6a 00                	push   $0x0
+  8025ae:	e8 17 f2 ff ff       	call   8017ca <read>
+	if (r < 0)
+  8025b3:	83 c4 10             	add    $0x10,%esp
+  8025b6:	85 c0                	test   %eax,%eax
+  8025b8:	78 06                	js     8025c0 <getchar+0x20>
+	if (r < 1)
+  8025ba:	74 06                	je     8025c2 <getchar+0x22>
+	return c;
+  8025bc:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8025c0:	c9                   	leave
+  8025c1:	c3                   	ret
+		return -E_EOF;
+  8025c2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8025c7:	eb f7                	jmp    8025c0 <getchar+0x20>
+
+008025c9 <iscons>:
+{
+  8025c9:	55                   	push   %ebp
+  8025ca:	89 e5                	mov    %esp,%ebp
+  8025cc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025d2:	50                   	push   %eax
+  8025d3:	ff 75 08             	push   0x8(%ebp)
+  8025d6:	e8 89 ef ff ff       	call   801564 <fd_lookup>
+  8025db:	83 c4 10             	add    $0x10,%esp
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	78 11                	js     8025f3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8025e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025e5:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8025eb:	39 10                	cmp    %edx,(%eax)
+  8025ed:	0f 94 c0             	sete   %al
+  8025f0:	0f b6 c0             	movzbl %al,%eax
+}
+  8025f3:	c9                   	leave
+  8025f4:	c3                   	ret
+
+008025f5 <opencons>:
+{
+  8025f5:	55                   	push   %ebp
+  8025f6:	89 e5                	mov    %esp,%ebp
+  8025f8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8025fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025fe:	50                   	push   %eax
+  8025ff:	e8 0a ef ff ff       	call   80150e <fd_alloc>
+  802604:	83 c4 10             	add    $0x10,%esp
+  802607:	85 c0                	test   %eax,%eax
+  802609:	78 3a                	js     802645 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80260b:	83 ec 04             	sub    $0x4,%esp
+  80260e:	68 07 04 00 00       	push   $0x407
+  802613:	ff 75 f4             	push   -0xc(%ebp)
+  802616:	6a 00                	push   $0x0
+  802618:	e8 43 e7 ff ff       	call   800d60 <sys_page_alloc>
+  80261d:	83 c4 10             	add    $0x10,%esp
+  802620:	85 c0                	test   %eax,%eax
+  802622:	78 21                	js     802645 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802624:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802627:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80262d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80262f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802632:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802639:	83 ec 0c             	sub    $0xc,%esp
+  80263c:	50                   	push   %eax
+  80263d:	e8 a5 ee ff ff       	call   8014e7 <fd2num>
+  802642:	83 c4 10             	add    $0x10,%esp
+}
+  802645:	c9                   	leave
+  802646:	c3                   	ret
+
+00802647 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802647:	55                   	push   %ebp
+  802648:	89 e5                	mov    %esp,%ebp
+  80264a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80264d:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802654:	74 0a                	je     802660 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802656:	8b 45 08             	mov    0x8(%ebp),%eax
+  802659:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  80265e:	c9                   	leave
+  80265f:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  802660:	83 ec 04             	sub    $0x4,%esp
+  802663:	6a 07                	push   $0x7
+  802665:	68 00 f0 bf ee       	push   $0xeebff000
+  80266a:	6a 00                	push   $0x0
+  80266c:	e8 ef e6 ff ff       	call   800d60 <sys_page_alloc>
+  802671:	83 c4 10             	add    $0x10,%esp
+  802674:	85 c0                	test   %eax,%eax
+  802676:	78 28                	js     8026a0 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802678:	83 ec 08             	sub    $0x8,%esp
+  80267b:	68 b2 26 80 00       	push   $0x8026b2
+  802680:	6a 00                	push   $0x0
+  802682:	e8 d4 e9 ff ff       	call   80105b <sys_env_set_pgfault_upcall>
+  802687:	83 c4 10             	add    $0x10,%esp
+  80268a:	85 c0                	test   %eax,%eax
+  80268c:	79 c8                	jns    802656 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  80268e:	50                   	push   %eax
+  80268f:	68 0b 33 80 00       	push   $0x80330b
+  802694:	6a 24                	push   $0x24
+  802696:	68 fd 32 80 00       	push   $0x8032fd
+  80269b:	e8 8a db ff ff       	call   80022a <_panic>
+			panic("sys_page_alloc: %e", r);
+  8026a0:	50                   	push   %eax
+  8026a1:	68 e6 30 80 00       	push   $0x8030e6
+  8026a6:	6a 21                	push   $0x21
+  8026a8:	68 fd 32 80 00       	push   $0x8032fd
+  8026ad:	e8 78 db ff ff       	call   80022a <_panic>
+
+008026b2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8026b2:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8026b3:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8026b8:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8026ba:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8026bd:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  8026c0:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  8026c4:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  8026c7:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  8026cb:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  8026cf:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  8026d1:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8026d2:	83 c4 04             	add    $0x4,%esp
+	popf
+  8026d5:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8026d6:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8026d7:	c3                   	ret
+
+008026d8 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8026d8:	55                   	push   %ebp
+  8026d9:	89 e5                	mov    %esp,%ebp
+  8026db:	57                   	push   %edi
+  8026dc:	56                   	push   %esi
+  8026dd:	53                   	push   %ebx
+  8026de:	83 ec 18             	sub    $0x18,%esp
+  8026e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8026e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8026e7:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8026ea:	85 db                	test   %ebx,%ebx
+  8026ec:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8026f1:	0f 45 c3             	cmovne %ebx,%eax
+  8026f4:	50                   	push   %eax
+  8026f5:	e8 e9 e9 ff ff       	call   8010e3 <sys_ipc_recv>
+
+	if (from_env_store)
+  8026fa:	83 c4 10             	add    $0x10,%esp
+  8026fd:	85 ff                	test   %edi,%edi
+  8026ff:	74 17                	je     802718 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802701:	ba 00 00 00 00       	mov    $0x0,%edx
+  802706:	85 c0                	test   %eax,%eax
+  802708:	75 0c                	jne    802716 <ipc_recv+0x3e>
+  80270a:	8b 15 20 54 80 00    	mov    0x805420,%edx
+  802710:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802716:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802718:	85 f6                	test   %esi,%esi
+  80271a:	74 2e                	je     80274a <ipc_recv+0x72>
+		if (!r && pg)
+  80271c:	85 c0                	test   %eax,%eax
+  80271e:	75 24                	jne    802744 <ipc_recv+0x6c>
+  802720:	85 db                	test   %ebx,%ebx
+  802722:	74 20                	je     802744 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802724:	a1 20 54 80 00       	mov    0x805420,%eax
+  802729:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  80272f:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802731:	a1 20 54 80 00       	mov    0x805420,%eax
+  802736:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80273c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80273f:	5b                   	pop    %ebx
+  802740:	5e                   	pop    %esi
+  802741:	5f                   	pop    %edi
+  802742:	5d                   	pop    %ebp
+  802743:	c3                   	ret
+			*perm_store = 0;
+  802744:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80274a:	85 c0                	test   %eax,%eax
+  80274c:	75 ee                	jne    80273c <ipc_recv+0x64>
+  80274e:	eb e1                	jmp    802731 <ipc_recv+0x59>
+
+00802750 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802750:	55                   	push   %ebp
+  802751:	89 e5                	mov    %esp,%ebp
+  802753:	57                   	push   %edi
+  802754:	56                   	push   %esi
+  802755:	53                   	push   %ebx
+  802756:	83 ec 0c             	sub    $0xc,%esp
+  802759:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80275c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80275f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802762:	85 db                	test   %ebx,%ebx
+  802764:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802769:	0f 44 d8             	cmove  %eax,%ebx
+  80276c:	ff 75 14             	push   0x14(%ebp)
+  80276f:	53                   	push   %ebx
+  802770:	56                   	push   %esi
+  802771:	57                   	push   %edi
+  802772:	e8 49 e9 ff ff       	call   8010c0 <sys_ipc_try_send_yield>
+  802777:	83 c4 10             	add    $0x10,%esp
+  80277a:	85 c0                	test   %eax,%eax
+  80277c:	79 1e                	jns    80279c <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80277e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802781:	75 07                	jne    80278a <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802783:	e8 58 e5 ff ff       	call   800ce0 <sys_yield>
+  802788:	eb e2                	jmp    80276c <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  80278a:	50                   	push   %eax
+  80278b:	68 29 33 80 00       	push   $0x803329
+  802790:	6a 3d                	push   $0x3d
+  802792:	68 3e 33 80 00       	push   $0x80333e
+  802797:	e8 8e da ff ff       	call   80022a <_panic>
+	}
+}
+  80279c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80279f:	5b                   	pop    %ebx
+  8027a0:	5e                   	pop    %esi
+  8027a1:	5f                   	pop    %edi
+  8027a2:	5d                   	pop    %ebp
+  8027a3:	c3                   	ret
+
+008027a4 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8027a4:	55                   	push   %ebp
+  8027a5:	89 e5                	mov    %esp,%ebp
+  8027a7:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8027aa:	ff 75 08             	push   0x8(%ebp)
+  8027ad:	e8 ae e4 ff ff       	call   800c60 <sys_env_find>
+}
+  8027b2:	c9                   	leave
+  8027b3:	c3                   	ret
+
+008027b4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8027b4:	55                   	push   %ebp
+  8027b5:	89 e5                	mov    %esp,%ebp
+  8027b7:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8027ba:	89 c2                	mov    %eax,%edx
+  8027bc:	c1 ea 16             	shr    $0x16,%edx
+  8027bf:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8027c6:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8027cb:	f6 c1 01             	test   $0x1,%cl
+  8027ce:	74 22                	je     8027f2 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8027d0:	c1 e8 0c             	shr    $0xc,%eax
+  8027d3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8027da:	a8 01                	test   $0x1,%al
+  8027dc:	74 14                	je     8027f2 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8027de:	c1 e8 0c             	shr    $0xc,%eax
+  8027e1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8027e4:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8027eb:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8027ef:	0f b7 d2             	movzwl %dx,%edx
+}
+  8027f2:	89 d0                	mov    %edx,%eax
+  8027f4:	5d                   	pop    %ebp
+  8027f5:	c3                   	ret
+  8027f6:	66 90                	xchg   %ax,%ax
+  8027f8:	66 90                	xchg   %ax,%ax
+  8027fa:	66 90                	xchg   %ax,%ax
+  8027fc:	66 90                	xchg   %ax,%ax
+  8027fe:	66 90                	xchg   %ax,%ax
+
+00802800 <__udivmoddi4>:
+  802800:	55                   	push   %ebp
+  802801:	57                   	push   %edi
+  802802:	56                   	push   %esi
+  802803:	53                   	push   %ebx
+  802804:	83 ec 14             	sub    $0x14,%esp
+  802807:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80280b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80280f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802813:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802817:	89 f1                	mov    %esi,%ecx
+  802819:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80281d:	09 d9                	or     %ebx,%ecx
+  80281f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802823:	0f 84 92 00 00 00    	je     8028bb <__udivmoddi4+0xbb>
+  802829:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802830:	00 
+  802831:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802836:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80283d:	00 
+  80283e:	89 1c 24             	mov    %ebx,(%esp)
+  802841:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802845:	8d 76 00             	lea    0x0(%esi),%esi
+  802848:	89 e9                	mov    %ebp,%ecx
+  80284a:	89 c3                	mov    %eax,%ebx
+  80284c:	89 d6                	mov    %edx,%esi
+  80284e:	31 ff                	xor    %edi,%edi
+  802850:	d3 ee                	shr    %cl,%esi
+  802852:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802855:	f6 c1 20             	test   $0x20,%cl
+  802858:	0f 45 de             	cmovne %esi,%ebx
+  80285b:	0f 45 f7             	cmovne %edi,%esi
+  80285e:	8b 3c 24             	mov    (%esp),%edi
+  802861:	39 fb                	cmp    %edi,%ebx
+  802863:	89 f7                	mov    %esi,%edi
+  802865:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802869:	8b 1c 24             	mov    (%esp),%ebx
+  80286c:	19 f7                	sbb    %esi,%edi
+  80286e:	72 39                	jb     8028a9 <__udivmoddi4+0xa9>
+  802870:	89 e9                	mov    %ebp,%ecx
+  802872:	89 f7                	mov    %esi,%edi
+  802874:	89 de                	mov    %ebx,%esi
+  802876:	0f a5 df             	shld   %cl,%ebx,%edi
+  802879:	d3 e6                	shl    %cl,%esi
+  80287b:	31 db                	xor    %ebx,%ebx
+  80287d:	f6 c1 20             	test   $0x20,%cl
+  802880:	0f 45 fe             	cmovne %esi,%edi
+  802883:	0f 45 f3             	cmovne %ebx,%esi
+  802886:	29 f0                	sub    %esi,%eax
+  802888:	be 01 00 00 00       	mov    $0x1,%esi
+  80288d:	19 fa                	sbb    %edi,%edx
+  80288f:	31 ff                	xor    %edi,%edi
+  802891:	31 db                	xor    %ebx,%ebx
+  802893:	0f a5 f7             	shld   %cl,%esi,%edi
+  802896:	d3 e6                	shl    %cl,%esi
+  802898:	f6 c1 20             	test   $0x20,%cl
+  80289b:	0f 45 fe             	cmovne %esi,%edi
+  80289e:	0f 45 f3             	cmovne %ebx,%esi
+  8028a1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8028a5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8028a9:	83 ed 01             	sub    $0x1,%ebp
+  8028ac:	73 9a                	jae    802848 <__udivmoddi4+0x48>
+  8028ae:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8028b2:	85 ff                	test   %edi,%edi
+  8028b4:	74 05                	je     8028bb <__udivmoddi4+0xbb>
+  8028b6:	89 07                	mov    %eax,(%edi)
+  8028b8:	89 57 04             	mov    %edx,0x4(%edi)
+  8028bb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028bf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028c3:	83 c4 14             	add    $0x14,%esp
+  8028c6:	5b                   	pop    %ebx
+  8028c7:	5e                   	pop    %esi
+  8028c8:	5f                   	pop    %edi
+  8028c9:	5d                   	pop    %ebp
+  8028ca:	c3                   	ret
+  8028cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8028cf:	90                   	nop
+
+008028d0 <__udivdi3>:
+  8028d0:	55                   	push   %ebp
+  8028d1:	57                   	push   %edi
+  8028d2:	56                   	push   %esi
+  8028d3:	53                   	push   %ebx
+  8028d4:	83 ec 14             	sub    $0x14,%esp
+  8028d7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8028db:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8028df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8028e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8028e7:	89 fb                	mov    %edi,%ebx
+  8028e9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8028ed:	09 f3                	or     %esi,%ebx
+  8028ef:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8028f3:	0f 84 85 00 00 00    	je     80297e <__udivdi3+0xae>
+  8028f9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802900:	00 
+  802901:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802906:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80290d:	00 
+  80290e:	89 34 24             	mov    %esi,(%esp)
+  802911:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802915:	8d 76 00             	lea    0x0(%esi),%esi
+  802918:	89 e9                	mov    %ebp,%ecx
+  80291a:	89 c3                	mov    %eax,%ebx
+  80291c:	89 d6                	mov    %edx,%esi
+  80291e:	31 ff                	xor    %edi,%edi
+  802920:	d3 ee                	shr    %cl,%esi
+  802922:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802925:	f6 c1 20             	test   $0x20,%cl
+  802928:	0f 45 de             	cmovne %esi,%ebx
+  80292b:	0f 45 f7             	cmovne %edi,%esi
+  80292e:	8b 3c 24             	mov    (%esp),%edi
+  802931:	39 fb                	cmp    %edi,%ebx
+  802933:	89 f7                	mov    %esi,%edi
+  802935:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802939:	8b 1c 24             	mov    (%esp),%ebx
+  80293c:	19 f7                	sbb    %esi,%edi
+  80293e:	72 39                	jb     802979 <__udivdi3+0xa9>
+  802940:	89 e9                	mov    %ebp,%ecx
+  802942:	89 f7                	mov    %esi,%edi
+  802944:	89 de                	mov    %ebx,%esi
+  802946:	0f a5 df             	shld   %cl,%ebx,%edi
+  802949:	d3 e6                	shl    %cl,%esi
+  80294b:	31 db                	xor    %ebx,%ebx
+  80294d:	f6 c1 20             	test   $0x20,%cl
+  802950:	0f 45 fe             	cmovne %esi,%edi
+  802953:	0f 45 f3             	cmovne %ebx,%esi
+  802956:	29 f0                	sub    %esi,%eax
+  802958:	be 01 00 00 00       	mov    $0x1,%esi
+  80295d:	19 fa                	sbb    %edi,%edx
+  80295f:	31 ff                	xor    %edi,%edi
+  802961:	31 db                	xor    %ebx,%ebx
+  802963:	0f a5 f7             	shld   %cl,%esi,%edi
+  802966:	d3 e6                	shl    %cl,%esi
+  802968:	f6 c1 20             	test   $0x20,%cl
+  80296b:	0f 45 fe             	cmovne %esi,%edi
+  80296e:	0f 45 f3             	cmovne %ebx,%esi
+  802971:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802975:	09 74 24 08          	or     %esi,0x8(%esp)
+  802979:	83 ed 01             	sub    $0x1,%ebp
+  80297c:	73 9a                	jae    802918 <__udivdi3+0x48>
+  80297e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802982:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802986:	83 c4 14             	add    $0x14,%esp
+  802989:	5b                   	pop    %ebx
+  80298a:	5e                   	pop    %esi
+  80298b:	5f                   	pop    %edi
+  80298c:	5d                   	pop    %ebp
+  80298d:	c3                   	ret
+  80298e:	66 90                	xchg   %ax,%ax
+
+00802990 <__umoddi3>:
+  802990:	57                   	push   %edi
+  802991:	56                   	push   %esi
+  802992:	53                   	push   %ebx
+  802993:	83 ec 08             	sub    $0x8,%esp
+  802996:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80299a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80299e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8029a2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8029a6:	89 f9                	mov    %edi,%ecx
+  8029a8:	89 34 24             	mov    %esi,(%esp)
+  8029ab:	09 f1                	or     %esi,%ecx
+  8029ad:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8029b1:	74 53                	je     802a06 <__umoddi3+0x76>
+  8029b3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8029b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029bf:	90                   	nop
+  8029c0:	89 c6                	mov    %eax,%esi
+  8029c2:	89 d7                	mov    %edx,%edi
+  8029c4:	31 db                	xor    %ebx,%ebx
+  8029c6:	d3 ef                	shr    %cl,%edi
+  8029c8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8029cb:	f6 c1 20             	test   $0x20,%cl
+  8029ce:	0f 45 f7             	cmovne %edi,%esi
+  8029d1:	0f 45 fb             	cmovne %ebx,%edi
+  8029d4:	8b 1c 24             	mov    (%esp),%ebx
+  8029d7:	39 de                	cmp    %ebx,%esi
+  8029d9:	89 fb                	mov    %edi,%ebx
+  8029db:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8029df:	8b 34 24             	mov    (%esp),%esi
+  8029e2:	19 fb                	sbb    %edi,%ebx
+  8029e4:	72 14                	jb     8029fa <__umoddi3+0x6a>
+  8029e6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029e9:	31 db                	xor    %ebx,%ebx
+  8029eb:	d3 e6                	shl    %cl,%esi
+  8029ed:	f6 c1 20             	test   $0x20,%cl
+  8029f0:	0f 45 fe             	cmovne %esi,%edi
+  8029f3:	0f 45 f3             	cmovne %ebx,%esi
+  8029f6:	29 f0                	sub    %esi,%eax
+  8029f8:	19 fa                	sbb    %edi,%edx
+  8029fa:	83 e9 01             	sub    $0x1,%ecx
+  8029fd:	73 c1                	jae    8029c0 <__umoddi3+0x30>
+  8029ff:	83 c4 08             	add    $0x8,%esp
+  802a02:	5b                   	pop    %ebx
+  802a03:	5e                   	pop    %esi
+  802a04:	5f                   	pop    %edi
+  802a05:	c3                   	ret
+  802a06:	83 c4 08             	add    $0x8,%esp
+  802a09:	31 c0                	xor    %eax,%eax
+  802a0b:	31 d2                	xor    %edx,%edx
+  802a0d:	5b                   	pop    %ebx
+  802a0e:	5e                   	pop    %esi
+  802a0f:	5f                   	pop    %edi
+  802a10:	c3                   	ret
+  802a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a1f:	90                   	nop
+
+00802a20 <__divdi3>:
+  802a20:	55                   	push   %ebp
+  802a21:	57                   	push   %edi
+  802a22:	56                   	push   %esi
+  802a23:	53                   	push   %ebx
+  802a24:	83 ec 1c             	sub    $0x1c,%esp
+  802a27:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802a2b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802a2f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802a33:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802a37:	85 ff                	test   %edi,%edi
+  802a39:	0f 88 da 00 00 00    	js     802b19 <__divdi3+0xf9>
+  802a3f:	85 db                	test   %ebx,%ebx
+  802a41:	78 16                	js     802a59 <__divdi3+0x39>
+  802a43:	89 dd                	mov    %ebx,%ebp
+  802a45:	89 c8                	mov    %ecx,%eax
+  802a47:	89 da                	mov    %ebx,%edx
+  802a49:	09 cd                	or     %ecx,%ebp
+  802a4b:	0f 85 fd 00 00 00    	jne    802b4e <__divdi3+0x12e>
+  802a51:	83 c4 1c             	add    $0x1c,%esp
+  802a54:	5b                   	pop    %ebx
+  802a55:	5e                   	pop    %esi
+  802a56:	5f                   	pop    %edi
+  802a57:	5d                   	pop    %ebp
+  802a58:	c3                   	ret
+  802a59:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802a5e:	f7 d9                	neg    %ecx
+  802a60:	89 f0                	mov    %esi,%eax
+  802a62:	89 fa                	mov    %edi,%edx
+  802a64:	83 d3 00             	adc    $0x0,%ebx
+  802a67:	89 0c 24             	mov    %ecx,(%esp)
+  802a6a:	f7 db                	neg    %ebx
+  802a6c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a70:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802a77:	00 
+  802a78:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a7d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802a84:	00 
+  802a85:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a89:	89 cd                	mov    %ecx,%ebp
+  802a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802a8f:	90                   	nop
+  802a90:	89 e9                	mov    %ebp,%ecx
+  802a92:	89 c3                	mov    %eax,%ebx
+  802a94:	89 d6                	mov    %edx,%esi
+  802a96:	31 ff                	xor    %edi,%edi
+  802a98:	d3 ee                	shr    %cl,%esi
+  802a9a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a9d:	f6 c1 20             	test   $0x20,%cl
+  802aa0:	0f 45 de             	cmovne %esi,%ebx
+  802aa3:	0f 45 f7             	cmovne %edi,%esi
+  802aa6:	8b 3c 24             	mov    (%esp),%edi
+  802aa9:	39 fb                	cmp    %edi,%ebx
+  802aab:	89 f7                	mov    %esi,%edi
+  802aad:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ab1:	8b 1c 24             	mov    (%esp),%ebx
+  802ab4:	19 f7                	sbb    %esi,%edi
+  802ab6:	72 39                	jb     802af1 <__divdi3+0xd1>
+  802ab8:	89 e9                	mov    %ebp,%ecx
+  802aba:	89 f7                	mov    %esi,%edi
+  802abc:	89 de                	mov    %ebx,%esi
+  802abe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ac1:	d3 e6                	shl    %cl,%esi
+  802ac3:	31 db                	xor    %ebx,%ebx
+  802ac5:	f6 c1 20             	test   $0x20,%cl
+  802ac8:	0f 45 fe             	cmovne %esi,%edi
+  802acb:	0f 45 f3             	cmovne %ebx,%esi
+  802ace:	29 f0                	sub    %esi,%eax
+  802ad0:	be 01 00 00 00       	mov    $0x1,%esi
+  802ad5:	19 fa                	sbb    %edi,%edx
+  802ad7:	31 ff                	xor    %edi,%edi
+  802ad9:	31 db                	xor    %ebx,%ebx
+  802adb:	0f a5 f7             	shld   %cl,%esi,%edi
+  802ade:	d3 e6                	shl    %cl,%esi
+  802ae0:	f6 c1 20             	test   $0x20,%cl
+  802ae3:	0f 45 fe             	cmovne %esi,%edi
+  802ae6:	0f 45 f3             	cmovne %ebx,%esi
+  802ae9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802aed:	09 74 24 08          	or     %esi,0x8(%esp)
+  802af1:	83 ed 01             	sub    $0x1,%ebp
+  802af4:	73 9a                	jae    802a90 <__divdi3+0x70>
+  802af6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802afa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802afe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b02:	85 ed                	test   %ebp,%ebp
+  802b04:	0f 84 47 ff ff ff    	je     802a51 <__divdi3+0x31>
+  802b0a:	f7 d8                	neg    %eax
+  802b0c:	83 d2 00             	adc    $0x0,%edx
+  802b0f:	83 c4 1c             	add    $0x1c,%esp
+  802b12:	5b                   	pop    %ebx
+  802b13:	f7 da                	neg    %edx
+  802b15:	5e                   	pop    %esi
+  802b16:	5f                   	pop    %edi
+  802b17:	5d                   	pop    %ebp
+  802b18:	c3                   	ret
+  802b19:	f7 de                	neg    %esi
+  802b1b:	83 d7 00             	adc    $0x0,%edi
+  802b1e:	f7 df                	neg    %edi
+  802b20:	85 db                	test   %ebx,%ebx
+  802b22:	78 23                	js     802b47 <__divdi3+0x127>
+  802b24:	89 dd                	mov    %ebx,%ebp
+  802b26:	89 c8                	mov    %ecx,%eax
+  802b28:	89 da                	mov    %ebx,%edx
+  802b2a:	09 cd                	or     %ecx,%ebp
+  802b2c:	0f 84 1f ff ff ff    	je     802a51 <__divdi3+0x31>
+  802b32:	89 0c 24             	mov    %ecx,(%esp)
+  802b35:	89 f0                	mov    %esi,%eax
+  802b37:	89 fa                	mov    %edi,%edx
+  802b39:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802b3e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802b42:	e9 29 ff ff ff       	jmp    802a70 <__divdi3+0x50>
+  802b47:	31 ed                	xor    %ebp,%ebp
+  802b49:	e9 10 ff ff ff       	jmp    802a5e <__divdi3+0x3e>
+  802b4e:	89 0c 24             	mov    %ecx,(%esp)
+  802b51:	89 f0                	mov    %esi,%eax
+  802b53:	89 fa                	mov    %edi,%edx
+  802b55:	31 ed                	xor    %ebp,%ebp
+  802b57:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802b5b:	e9 10 ff ff ff       	jmp    802a70 <__divdi3+0x50>
+
+00802b60 <__moddi3>:
+  802b60:	55                   	push   %ebp
+  802b61:	57                   	push   %edi
+  802b62:	56                   	push   %esi
+  802b63:	53                   	push   %ebx
+  802b64:	83 ec 14             	sub    $0x14,%esp
+  802b67:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802b6b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802b6f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802b73:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802b77:	85 d2                	test   %edx,%edx
+  802b79:	0f 88 9b 00 00 00    	js     802c1a <__moddi3+0xba>
+  802b7f:	89 f7                	mov    %esi,%edi
+  802b81:	31 ed                	xor    %ebp,%ebp
+  802b83:	09 cf                	or     %ecx,%edi
+  802b85:	0f 84 83 00 00 00    	je     802c0e <__moddi3+0xae>
+  802b8b:	89 cb                	mov    %ecx,%ebx
+  802b8d:	89 f7                	mov    %esi,%edi
+  802b8f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802b93:	f7 db                	neg    %ebx
+  802b95:	83 d7 00             	adc    $0x0,%edi
+  802b98:	f7 df                	neg    %edi
+  802b9a:	0f 49 f7             	cmovns %edi,%esi
+  802b9d:	0f 49 cb             	cmovns %ebx,%ecx
+  802ba0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802ba4:	89 0c 24             	mov    %ecx,(%esp)
+  802ba7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802bac:	89 cd                	mov    %ecx,%ebp
+  802bae:	66 90                	xchg   %ax,%ax
+  802bb0:	89 e9                	mov    %ebp,%ecx
+  802bb2:	89 c3                	mov    %eax,%ebx
+  802bb4:	89 d6                	mov    %edx,%esi
+  802bb6:	31 ff                	xor    %edi,%edi
+  802bb8:	d3 ee                	shr    %cl,%esi
+  802bba:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802bbd:	f6 c1 20             	test   $0x20,%cl
+  802bc0:	0f 45 de             	cmovne %esi,%ebx
+  802bc3:	0f 45 f7             	cmovne %edi,%esi
+  802bc6:	8b 3c 24             	mov    (%esp),%edi
+  802bc9:	39 fb                	cmp    %edi,%ebx
+  802bcb:	89 f7                	mov    %esi,%edi
+  802bcd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802bd1:	8b 1c 24             	mov    (%esp),%ebx
+  802bd4:	19 f7                	sbb    %esi,%edi
+  802bd6:	72 1a                	jb     802bf2 <__moddi3+0x92>
+  802bd8:	89 e9                	mov    %ebp,%ecx
+  802bda:	89 f7                	mov    %esi,%edi
+  802bdc:	89 de                	mov    %ebx,%esi
+  802bde:	0f a5 df             	shld   %cl,%ebx,%edi
+  802be1:	d3 e6                	shl    %cl,%esi
+  802be3:	31 db                	xor    %ebx,%ebx
+  802be5:	f6 c1 20             	test   $0x20,%cl
+  802be8:	0f 45 fe             	cmovne %esi,%edi
+  802beb:	0f 45 f3             	cmovne %ebx,%esi
+  802bee:	29 f0                	sub    %esi,%eax
+  802bf0:	19 fa                	sbb    %edi,%edx
+  802bf2:	83 ed 01             	sub    $0x1,%ebp
+  802bf5:	73 b9                	jae    802bb0 <__moddi3+0x50>
+  802bf7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802bfb:	85 ed                	test   %ebp,%ebp
+  802bfd:	74 07                	je     802c06 <__moddi3+0xa6>
+  802bff:	f7 d8                	neg    %eax
+  802c01:	83 d2 00             	adc    $0x0,%edx
+  802c04:	f7 da                	neg    %edx
+  802c06:	83 c4 14             	add    $0x14,%esp
+  802c09:	5b                   	pop    %ebx
+  802c0a:	5e                   	pop    %esi
+  802c0b:	5f                   	pop    %edi
+  802c0c:	5d                   	pop    %ebp
+  802c0d:	c3                   	ret
+  802c0e:	83 c4 14             	add    $0x14,%esp
+  802c11:	31 c0                	xor    %eax,%eax
+  802c13:	31 d2                	xor    %edx,%edx
+  802c15:	5b                   	pop    %ebx
+  802c16:	5e                   	pop    %esi
+  802c17:	5f                   	pop    %edi
+  802c18:	5d                   	pop    %ebp
+  802c19:	c3                   	ret
+  802c1a:	89 f7                	mov    %esi,%edi
+  802c1c:	09 cf                	or     %ecx,%edi
+  802c1e:	74 11                	je     802c31 <__moddi3+0xd1>
+  802c20:	f7 d8                	neg    %eax
+  802c22:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802c27:	83 d2 00             	adc    $0x0,%edx
+  802c2a:	f7 da                	neg    %edx
+  802c2c:	e9 5a ff ff ff       	jmp    802b8b <__moddi3+0x2b>
+  802c31:	31 c0                	xor    %eax,%eax
+  802c33:	31 d2                	xor    %edx,%edx
+  802c35:	eb c8                	jmp    802bff <__moddi3+0x9f>
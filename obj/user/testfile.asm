@@ -0,0 +1,6120 @@
+
+obj/user/testfile.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4e 06 00 00       	call   80067f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <xopen>:
+
+#define FVA ((struct Fd*)0xCCCCC000)
+
+static int
+xopen(const char *path, int mode)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	89 d3                	mov    %edx,%ebx
+	extern union Fsipc fsipcbuf;
+	envid_t fsenv;
+	
+	strcpy(fsipcbuf.open.req_path, path);
+  80003c:	50                   	push   %eax
+  80003d:	68 00 60 80 00       	push   $0x806000
+  800042:	e8 61 0d 00 00       	call   800da8 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800047:	89 1d 00 64 80 00    	mov    %ebx,0x806400
+
+	fsenv = ipc_find_env(ENV_TYPE_FS);
+  80004d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800054:	e8 ad 16 00 00       	call   801706 <ipc_find_env>
+	ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800059:	6a 07                	push   $0x7
+  80005b:	68 00 60 80 00       	push   $0x806000
+  800060:	6a 01                	push   $0x1
+  800062:	50                   	push   %eax
+  800063:	e8 4a 16 00 00       	call   8016b2 <ipc_send>
+	return ipc_recv(NULL, FVA, NULL);
+  800068:	83 c4 1c             	add    $0x1c,%esp
+  80006b:	6a 00                	push   $0x0
+  80006d:	68 00 c0 cc cc       	push   $0xccccc000
+  800072:	6a 00                	push   $0x0
+  800074:	e8 c1 15 00 00       	call   80163a <ipc_recv>
+}
+  800079:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007c:	c9                   	leave
+  80007d:	c3                   	ret
+
+0080007e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	57                   	push   %edi
+  800082:	56                   	push   %esi
+  800083:	53                   	push   %ebx
+  800084:	81 ec ac 02 00 00    	sub    $0x2ac,%esp
+	struct Fd fdcopy;
+	struct Stat st;
+	char buf[512];
+
+	// We open files manually first, to avoid the FD layer
+	if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  80008a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80008f:	b8 c0 2c 80 00       	mov    $0x802cc0,%eax
+  800094:	e8 9a ff ff ff       	call   800033 <xopen>
+  800099:	85 c0                	test   %eax,%eax
+  80009b:	0f 89 fa 03 00 00    	jns    80049b <umain+0x41d>
+  8000a1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8000a4:	0f 85 df 03 00 00    	jne    800489 <umain+0x40b>
+		panic("serve_open /not-found: %e", r);
+	else if (r >= 0)
+		panic("serve_open /not-found succeeded!");
+
+	if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000af:	b8 f5 2c 80 00       	mov    $0x802cf5,%eax
+  8000b4:	e8 7a ff ff ff       	call   800033 <xopen>
+  8000b9:	85 c0                	test   %eax,%eax
+  8000bb:	0f 88 ee 03 00 00    	js     8004af <umain+0x431>
+		panic("serve_open /newmotd: %e", r);
+	if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  8000c1:	83 3d 00 c0 cc cc 66 	cmpl   $0x66,0xccccc000
+  8000c8:	0f 85 f3 03 00 00    	jne    8004c1 <umain+0x443>
+  8000ce:	83 3d 04 c0 cc cc 00 	cmpl   $0x0,0xccccc004
+  8000d5:	0f 85 e6 03 00 00    	jne    8004c1 <umain+0x443>
+  8000db:	83 3d 08 c0 cc cc 00 	cmpl   $0x0,0xccccc008
+  8000e2:	0f 85 d9 03 00 00    	jne    8004c1 <umain+0x443>
+		panic("serve_open did not fill struct Fd correctly\n");
+	cprintf("serve_open is good\n");
+  8000e8:	83 ec 0c             	sub    $0xc,%esp
+  8000eb:	68 16 2d 80 00       	push   $0x802d16
+  8000f0:	e8 c5 06 00 00       	call   8007ba <cprintf>
+
+	if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  8000f5:	83 c4 08             	add    $0x8,%esp
+  8000f8:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  8000fe:	50                   	push   %eax
+  8000ff:	68 00 c0 cc cc       	push   $0xccccc000
+  800104:	ff 15 1c 40 80 00    	call   *0x80401c
+  80010a:	83 c4 10             	add    $0x10,%esp
+  80010d:	85 c0                	test   %eax,%eax
+  80010f:	0f 88 c0 03 00 00    	js     8004d5 <umain+0x457>
+		panic("file_stat: %e", r);
+	if (strlen(msg) != st.st_size)
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	ff 35 00 40 80 00    	push   0x804000
+  80011e:	e8 4a 0c 00 00       	call   800d6d <strlen>
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	3b 45 cc             	cmp    -0x34(%ebp),%eax
+  800129:	0f 85 b8 03 00 00    	jne    8004e7 <umain+0x469>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+	cprintf("file_stat is good\n");
+  80012f:	83 ec 0c             	sub    $0xc,%esp
+  800132:	68 38 2d 80 00       	push   $0x802d38
+  800137:	e8 7e 06 00 00       	call   8007ba <cprintf>
+
+	memset(buf, 0, sizeof buf);
+  80013c:	83 c4 0c             	add    $0xc,%esp
+  80013f:	68 00 02 00 00       	push   $0x200
+  800144:	6a 00                	push   $0x0
+  800146:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  80014c:	53                   	push   %ebx
+  80014d:	e8 a7 0d 00 00       	call   800ef9 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800152:	83 c4 0c             	add    $0xc,%esp
+  800155:	68 00 02 00 00       	push   $0x200
+  80015a:	53                   	push   %ebx
+  80015b:	68 00 c0 cc cc       	push   $0xccccc000
+  800160:	ff 15 10 40 80 00    	call   *0x804010
+  800166:	83 c4 10             	add    $0x10,%esp
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	0f 88 9b 03 00 00    	js     80050c <umain+0x48e>
+		panic("file_read: %e", r);
+	if (strcmp(buf, msg) != 0)
+  800171:	83 ec 08             	sub    $0x8,%esp
+  800174:	ff 35 00 40 80 00    	push   0x804000
+  80017a:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800180:	50                   	push   %eax
+  800181:	e8 d3 0c 00 00       	call   800e59 <strcmp>
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	0f 85 8d 03 00 00    	jne    80051e <umain+0x4a0>
+		panic("file_read returned wrong data");
+	cprintf("file_read is good\n");
+  800191:	83 ec 0c             	sub    $0xc,%esp
+  800194:	68 77 2d 80 00       	push   $0x802d77
+  800199:	e8 1c 06 00 00       	call   8007ba <cprintf>
+
+	if ((r = devfile.dev_close(FVA)) < 0)
+  80019e:	c7 04 24 00 c0 cc cc 	movl   $0xccccc000,(%esp)
+  8001a5:	ff 15 18 40 80 00    	call   *0x804018
+  8001ab:	83 c4 10             	add    $0x10,%esp
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	0f 88 7c 03 00 00    	js     800532 <umain+0x4b4>
+		panic("file_close: %e", r);
+	cprintf("file_close is good\n");
+  8001b6:	83 ec 0c             	sub    $0xc,%esp
+  8001b9:	68 99 2d 80 00       	push   $0x802d99
+  8001be:	e8 f7 05 00 00       	call   8007ba <cprintf>
+
+	// We're about to unmap the FD, but still need a way to get
+	// the stale filenum to serve_read, so we make a local copy.
+	// The file server won't think it's stale until we unmap the
+	// FD page.
+	fdcopy = *FVA;
+  8001c3:	a1 00 c0 cc cc       	mov    0xccccc000,%eax
+  8001c8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001cb:	a1 04 c0 cc cc       	mov    0xccccc004,%eax
+  8001d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001d3:	a1 08 c0 cc cc       	mov    0xccccc008,%eax
+  8001d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001db:	a1 0c c0 cc cc       	mov    0xccccc00c,%eax
+  8001e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	sys_page_unmap(0, FVA);
+  8001e3:	83 c4 08             	add    $0x8,%esp
+  8001e6:	68 00 c0 cc cc       	push   $0xccccc000
+  8001eb:	6a 00                	push   $0x0
+  8001ed:	e8 eb 10 00 00       	call   8012dd <sys_page_unmap>
+
+	if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	68 00 02 00 00       	push   $0x200
+  8001fa:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800200:	50                   	push   %eax
+  800201:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800204:	50                   	push   %eax
+  800205:	ff 15 10 40 80 00    	call   *0x804010
+  80020b:	83 c4 10             	add    $0x10,%esp
+  80020e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800211:	0f 85 2d 03 00 00    	jne    800544 <umain+0x4c6>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+	cprintf("stale fileid is good\n");
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	68 ad 2d 80 00       	push   $0x802dad
+  80021f:	e8 96 05 00 00       	call   8007ba <cprintf>
+
+	// Try writing
+	if ((r = xopen("/new-file", O_RDWR|O_CREAT)) < 0)
+  800224:	ba 02 01 00 00       	mov    $0x102,%edx
+  800229:	b8 c3 2d 80 00       	mov    $0x802dc3,%eax
+  80022e:	e8 00 fe ff ff       	call   800033 <xopen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 88 18 03 00 00    	js     800556 <umain+0x4d8>
+		panic("serve_open /new-file: %e", r);
+
+	if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  80023e:	8b 1d 14 40 80 00    	mov    0x804014,%ebx
+  800244:	83 ec 0c             	sub    $0xc,%esp
+  800247:	ff 35 00 40 80 00    	push   0x804000
+  80024d:	e8 1b 0b 00 00       	call   800d6d <strlen>
+  800252:	83 c4 0c             	add    $0xc,%esp
+  800255:	50                   	push   %eax
+  800256:	ff 35 00 40 80 00    	push   0x804000
+  80025c:	68 00 c0 cc cc       	push   $0xccccc000
+  800261:	ff d3                	call   *%ebx
+  800263:	89 c3                	mov    %eax,%ebx
+  800265:	83 c4 04             	add    $0x4,%esp
+  800268:	ff 35 00 40 80 00    	push   0x804000
+  80026e:	e8 fa 0a 00 00       	call   800d6d <strlen>
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	39 d8                	cmp    %ebx,%eax
+  800278:	0f 85 ea 02 00 00    	jne    800568 <umain+0x4ea>
+		panic("file_write: %e", r);
+	cprintf("file_write is good\n");
+  80027e:	83 ec 0c             	sub    $0xc,%esp
+  800281:	68 f5 2d 80 00       	push   $0x802df5
+  800286:	e8 2f 05 00 00       	call   8007ba <cprintf>
+
+	FVA->fd_offset = 0;
+  80028b:	c7 05 04 c0 cc cc 00 	movl   $0x0,0xccccc004
+  800292:	00 00 00 
+	memset(buf, 0, sizeof buf);
+  800295:	83 c4 0c             	add    $0xc,%esp
+  800298:	68 00 02 00 00       	push   $0x200
+  80029d:	6a 00                	push   $0x0
+  80029f:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  8002a5:	53                   	push   %ebx
+  8002a6:	e8 4e 0c 00 00       	call   800ef9 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8002ab:	83 c4 0c             	add    $0xc,%esp
+  8002ae:	68 00 02 00 00       	push   $0x200
+  8002b3:	53                   	push   %ebx
+  8002b4:	68 00 c0 cc cc       	push   $0xccccc000
+  8002b9:	ff 15 10 40 80 00    	call   *0x804010
+  8002bf:	89 c3                	mov    %eax,%ebx
+  8002c1:	83 c4 10             	add    $0x10,%esp
+  8002c4:	85 c0                	test   %eax,%eax
+  8002c6:	0f 88 ae 02 00 00    	js     80057a <umain+0x4fc>
+		panic("file_read after file_write: %e", r);
+	if (r != strlen(msg))
+  8002cc:	83 ec 0c             	sub    $0xc,%esp
+  8002cf:	ff 35 00 40 80 00    	push   0x804000
+  8002d5:	e8 93 0a 00 00       	call   800d6d <strlen>
+  8002da:	83 c4 10             	add    $0x10,%esp
+  8002dd:	39 d8                	cmp    %ebx,%eax
+  8002df:	0f 85 a7 02 00 00    	jne    80058c <umain+0x50e>
+		panic("file_read after file_write returned wrong length: %d", r);
+	if (strcmp(buf, msg) != 0)
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	ff 35 00 40 80 00    	push   0x804000
+  8002ee:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	e8 5f 0b 00 00       	call   800e59 <strcmp>
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	85 c0                	test   %eax,%eax
+  8002ff:	0f 85 99 02 00 00    	jne    80059e <umain+0x520>
+		panic("file_read after file_write returned wrong data");
+	cprintf("file_read after file_write is good\n");
+  800305:	83 ec 0c             	sub    $0xc,%esp
+  800308:	68 bc 2f 80 00       	push   $0x802fbc
+  80030d:	e8 a8 04 00 00       	call   8007ba <cprintf>
+
+	// Now we'll try out open
+	if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800312:	83 c4 08             	add    $0x8,%esp
+  800315:	6a 00                	push   $0x0
+  800317:	68 c0 2c 80 00       	push   $0x802cc0
+  80031c:	e8 3b 1b 00 00       	call   801e5c <open>
+  800321:	83 c4 10             	add    $0x10,%esp
+  800324:	85 c0                	test   %eax,%eax
+  800326:	0f 89 98 02 00 00    	jns    8005c4 <umain+0x546>
+  80032c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80032f:	0f 85 7d 02 00 00    	jne    8005b2 <umain+0x534>
+		panic("open /not-found: %e", r);
+	else if (r >= 0)
+		panic("open /not-found succeeded!");
+
+	if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800335:	83 ec 08             	sub    $0x8,%esp
+  800338:	6a 00                	push   $0x0
+  80033a:	68 f5 2c 80 00       	push   $0x802cf5
+  80033f:	e8 18 1b 00 00       	call   801e5c <open>
+  800344:	83 c4 10             	add    $0x10,%esp
+  800347:	85 c0                	test   %eax,%eax
+  800349:	0f 88 89 02 00 00    	js     8005d8 <umain+0x55a>
+		panic("open /newmotd: %e", r);
+	fd = (struct Fd*) (0xD0000000 + r*PGSIZE);
+  80034f:	c1 e0 0c             	shl    $0xc,%eax
+	if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800352:	83 b8 00 00 00 d0 66 	cmpl   $0x66,-0x30000000(%eax)
+  800359:	0f 85 8b 02 00 00    	jne    8005ea <umain+0x56c>
+  80035f:	83 b8 04 00 00 d0 00 	cmpl   $0x0,-0x2ffffffc(%eax)
+  800366:	0f 85 7e 02 00 00    	jne    8005ea <umain+0x56c>
+  80036c:	8b 98 08 00 00 d0    	mov    -0x2ffffff8(%eax),%ebx
+  800372:	85 db                	test   %ebx,%ebx
+  800374:	0f 85 70 02 00 00    	jne    8005ea <umain+0x56c>
+		panic("open did not fill struct Fd correctly\n");
+	cprintf("open is good\n");
+  80037a:	83 ec 0c             	sub    $0xc,%esp
+  80037d:	68 1c 2d 80 00       	push   $0x802d1c
+  800382:	e8 33 04 00 00       	call   8007ba <cprintf>
+
+	// Try files with indirect blocks
+	if ((f = open("/big", O_WRONLY|O_CREAT)) < 0)
+  800387:	83 c4 08             	add    $0x8,%esp
+  80038a:	68 01 01 00 00       	push   $0x101
+  80038f:	68 24 2e 80 00       	push   $0x802e24
+  800394:	e8 c3 1a 00 00       	call   801e5c <open>
+  800399:	89 c7                	mov    %eax,%edi
+  80039b:	83 c4 10             	add    $0x10,%esp
+  80039e:	85 c0                	test   %eax,%eax
+  8003a0:	0f 88 58 02 00 00    	js     8005fe <umain+0x580>
+		panic("create /big: %e", f);
+	memset(buf, 0, sizeof(buf));
+  8003a6:	83 ec 04             	sub    $0x4,%esp
+  8003a9:	68 00 02 00 00       	push   $0x200
+  8003ae:	6a 00                	push   $0x0
+  8003b0:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003b6:	50                   	push   %eax
+  8003b7:	e8 3d 0b 00 00       	call   800ef9 <memset>
+  8003bc:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003bf:	89 de                	mov    %ebx,%esi
+		*(int*)buf = i;
+  8003c1:	89 b5 4c fd ff ff    	mov    %esi,-0x2b4(%ebp)
+		if ((r = write(f, buf, sizeof(buf))) < 0)
+  8003c7:	83 ec 04             	sub    $0x4,%esp
+  8003ca:	68 00 02 00 00       	push   $0x200
+  8003cf:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003d5:	50                   	push   %eax
+  8003d6:	57                   	push   %edi
+  8003d7:	e8 eb 16 00 00       	call   801ac7 <write>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	85 c0                	test   %eax,%eax
+  8003e1:	0f 88 29 02 00 00    	js     800610 <umain+0x592>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003e7:	8d 86 00 02 00 00    	lea    0x200(%esi),%eax
+  8003ed:	89 c6                	mov    %eax,%esi
+  8003ef:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  8003f4:	75 cb                	jne    8003c1 <umain+0x343>
+			panic("write /big@%d: %e", i, r);
+	}
+	close(f);
+  8003f6:	83 ec 0c             	sub    $0xc,%esp
+  8003f9:	57                   	push   %edi
+  8003fa:	e8 be 14 00 00       	call   8018bd <close>
+
+	if ((f = open("/big", O_RDONLY)) < 0)
+  8003ff:	83 c4 08             	add    $0x8,%esp
+  800402:	6a 00                	push   $0x0
+  800404:	68 24 2e 80 00       	push   $0x802e24
+  800409:	e8 4e 1a 00 00       	call   801e5c <open>
+  80040e:	89 c6                	mov    %eax,%esi
+  800410:	83 c4 10             	add    $0x10,%esp
+  800413:	85 c0                	test   %eax,%eax
+  800415:	0f 88 0b 02 00 00    	js     800626 <umain+0x5a8>
+		panic("open /big: %e", f);
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+		*(int*)buf = i;
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  80041b:	8d bd 4c fd ff ff    	lea    -0x2b4(%ebp),%edi
+		*(int*)buf = i;
+  800421:	89 9d 4c fd ff ff    	mov    %ebx,-0x2b4(%ebp)
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800427:	83 ec 04             	sub    $0x4,%esp
+  80042a:	68 00 02 00 00       	push   $0x200
+  80042f:	57                   	push   %edi
+  800430:	56                   	push   %esi
+  800431:	e8 4a 16 00 00       	call   801a80 <readn>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	85 c0                	test   %eax,%eax
+  80043b:	0f 88 f7 01 00 00    	js     800638 <umain+0x5ba>
+			panic("read /big@%d: %e", i, r);
+		if (r != sizeof(buf))
+  800441:	3d 00 02 00 00       	cmp    $0x200,%eax
+  800446:	0f 85 02 02 00 00    	jne    80064e <umain+0x5d0>
+			panic("read /big from %d returned %d < %d bytes",
+			      i, r, sizeof(buf));
+		if (*(int*)buf != i)
+  80044c:	8b 85 4c fd ff ff    	mov    -0x2b4(%ebp),%eax
+  800452:	39 d8                	cmp    %ebx,%eax
+  800454:	0f 85 0f 02 00 00    	jne    800669 <umain+0x5eb>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  80045a:	8d 83 00 02 00 00    	lea    0x200(%ebx),%eax
+  800460:	89 c3                	mov    %eax,%ebx
+  800462:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  800467:	75 b8                	jne    800421 <umain+0x3a3>
+			panic("read /big from %d returned bad data %d",
+			      i, *(int*)buf);
+	}
+	close(f);
+  800469:	83 ec 0c             	sub    $0xc,%esp
+  80046c:	56                   	push   %esi
+  80046d:	e8 4b 14 00 00       	call   8018bd <close>
+	cprintf("large file is good\n");
+  800472:	c7 04 24 6a 2e 80 00 	movl   $0x802e6a,(%esp)
+  800479:	e8 3c 03 00 00       	call   8007ba <cprintf>
+}
+  80047e:	83 c4 10             	add    $0x10,%esp
+  800481:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800484:	5b                   	pop    %ebx
+  800485:	5e                   	pop    %esi
+  800486:	5f                   	pop    %edi
+  800487:	5d                   	pop    %ebp
+  800488:	c3                   	ret
+		panic("serve_open /not-found: %e", r);
+  800489:	50                   	push   %eax
+  80048a:	68 cb 2c 80 00       	push   $0x802ccb
+  80048f:	6a 20                	push   $0x20
+  800491:	68 e5 2c 80 00       	push   $0x802ce5
+  800496:	e8 44 02 00 00       	call   8006df <_panic>
+		panic("serve_open /not-found succeeded!");
+  80049b:	83 ec 04             	sub    $0x4,%esp
+  80049e:	68 80 2e 80 00       	push   $0x802e80
+  8004a3:	6a 22                	push   $0x22
+  8004a5:	68 e5 2c 80 00       	push   $0x802ce5
+  8004aa:	e8 30 02 00 00       	call   8006df <_panic>
+		panic("serve_open /newmotd: %e", r);
+  8004af:	50                   	push   %eax
+  8004b0:	68 fe 2c 80 00       	push   $0x802cfe
+  8004b5:	6a 25                	push   $0x25
+  8004b7:	68 e5 2c 80 00       	push   $0x802ce5
+  8004bc:	e8 1e 02 00 00       	call   8006df <_panic>
+		panic("serve_open did not fill struct Fd correctly\n");
+  8004c1:	83 ec 04             	sub    $0x4,%esp
+  8004c4:	68 a4 2e 80 00       	push   $0x802ea4
+  8004c9:	6a 27                	push   $0x27
+  8004cb:	68 e5 2c 80 00       	push   $0x802ce5
+  8004d0:	e8 0a 02 00 00       	call   8006df <_panic>
+		panic("file_stat: %e", r);
+  8004d5:	50                   	push   %eax
+  8004d6:	68 2a 2d 80 00       	push   $0x802d2a
+  8004db:	6a 2b                	push   $0x2b
+  8004dd:	68 e5 2c 80 00       	push   $0x802ce5
+  8004e2:	e8 f8 01 00 00       	call   8006df <_panic>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+  8004e7:	83 ec 0c             	sub    $0xc,%esp
+  8004ea:	ff 35 00 40 80 00    	push   0x804000
+  8004f0:	e8 78 08 00 00       	call   800d6d <strlen>
+  8004f5:	89 04 24             	mov    %eax,(%esp)
+  8004f8:	ff 75 cc             	push   -0x34(%ebp)
+  8004fb:	68 d4 2e 80 00       	push   $0x802ed4
+  800500:	6a 2d                	push   $0x2d
+  800502:	68 e5 2c 80 00       	push   $0x802ce5
+  800507:	e8 d3 01 00 00       	call   8006df <_panic>
+		panic("file_read: %e", r);
+  80050c:	50                   	push   %eax
+  80050d:	68 4b 2d 80 00       	push   $0x802d4b
+  800512:	6a 32                	push   $0x32
+  800514:	68 e5 2c 80 00       	push   $0x802ce5
+  800519:	e8 c1 01 00 00       	call   8006df <_panic>
+		panic("file_read returned wrong data");
+  80051e:	83 ec 04             	sub    $0x4,%esp
+  800521:	68 59 2d 80 00       	push   $0x802d59
+  800526:	6a 34                	push   $0x34
+  800528:	68 e5 2c 80 00       	push   $0x802ce5
+  80052d:	e8 ad 01 00 00       	call   8006df <_panic>
+		panic("file_close: %e", r);
+  800532:	50                   	push   %eax
+  800533:	68 8a 2d 80 00       	push   $0x802d8a
+  800538:	6a 38                	push   $0x38
+  80053a:	68 e5 2c 80 00       	push   $0x802ce5
+  80053f:	e8 9b 01 00 00       	call   8006df <_panic>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+  800544:	50                   	push   %eax
+  800545:	68 fc 2e 80 00       	push   $0x802efc
+  80054a:	6a 43                	push   $0x43
+  80054c:	68 e5 2c 80 00       	push   $0x802ce5
+  800551:	e8 89 01 00 00       	call   8006df <_panic>
+		panic("serve_open /new-file: %e", r);
+  800556:	50                   	push   %eax
+  800557:	68 cd 2d 80 00       	push   $0x802dcd
+  80055c:	6a 48                	push   $0x48
+  80055e:	68 e5 2c 80 00       	push   $0x802ce5
+  800563:	e8 77 01 00 00       	call   8006df <_panic>
+		panic("file_write: %e", r);
+  800568:	53                   	push   %ebx
+  800569:	68 e6 2d 80 00       	push   $0x802de6
+  80056e:	6a 4b                	push   $0x4b
+  800570:	68 e5 2c 80 00       	push   $0x802ce5
+  800575:	e8 65 01 00 00       	call   8006df <_panic>
+		panic("file_read after file_write: %e", r);
+  80057a:	50                   	push   %eax
+  80057b:	68 34 2f 80 00       	push   $0x802f34
+  800580:	6a 51                	push   $0x51
+  800582:	68 e5 2c 80 00       	push   $0x802ce5
+  800587:	e8 53 01 00 00       	call   8006df <_panic>
+		panic("file_read after file_write returned wrong length: %d", r);
+  80058c:	53                   	push   %ebx
+  80058d:	68 54 2f 80 00       	push   $0x802f54
+  800592:	6a 53                	push   $0x53
+  800594:	68 e5 2c 80 00       	push   $0x802ce5
+  800599:	e8 41 01 00 00       	call   8006df <_panic>
+		panic("file_read after file_write returned wrong data");
+  80059e:	83 ec 04             	sub    $0x4,%esp
+  8005a1:	68 8c 2f 80 00       	push   $0x802f8c
+  8005a6:	6a 55                	push   $0x55
+  8005a8:	68 e5 2c 80 00       	push   $0x802ce5
+  8005ad:	e8 2d 01 00 00       	call   8006df <_panic>
+		panic("open /not-found: %e", r);
+  8005b2:	50                   	push   %eax
+  8005b3:	68 d1 2c 80 00       	push   $0x802cd1
+  8005b8:	6a 5a                	push   $0x5a
+  8005ba:	68 e5 2c 80 00       	push   $0x802ce5
+  8005bf:	e8 1b 01 00 00       	call   8006df <_panic>
+		panic("open /not-found succeeded!");
+  8005c4:	83 ec 04             	sub    $0x4,%esp
+  8005c7:	68 09 2e 80 00       	push   $0x802e09
+  8005cc:	6a 5c                	push   $0x5c
+  8005ce:	68 e5 2c 80 00       	push   $0x802ce5
+  8005d3:	e8 07 01 00 00       	call   8006df <_panic>
+		panic("open /newmotd: %e", r);
+  8005d8:	50                   	push   %eax
+  8005d9:	68 04 2d 80 00       	push   $0x802d04
+  8005de:	6a 5f                	push   $0x5f
+  8005e0:	68 e5 2c 80 00       	push   $0x802ce5
+  8005e5:	e8 f5 00 00 00       	call   8006df <_panic>
+		panic("open did not fill struct Fd correctly\n");
+  8005ea:	83 ec 04             	sub    $0x4,%esp
+  8005ed:	68 e0 2f 80 00       	push   $0x802fe0
+  8005f2:	6a 62                	push   $0x62
+  8005f4:	68 e5 2c 80 00       	push   $0x802ce5
+  8005f9:	e8 e1 00 00 00       	call   8006df <_panic>
+		panic("create /big: %e", f);
+  8005fe:	50                   	push   %eax
+  8005ff:	68 29 2e 80 00       	push   $0x802e29
+  800604:	6a 67                	push   $0x67
+  800606:	68 e5 2c 80 00       	push   $0x802ce5
+  80060b:	e8 cf 00 00 00       	call   8006df <_panic>
+			panic("write /big@%d: %e", i, r);
+  800610:	83 ec 0c             	sub    $0xc,%esp
+  800613:	50                   	push   %eax
+  800614:	56                   	push   %esi
+  800615:	68 39 2e 80 00       	push   $0x802e39
+  80061a:	6a 6c                	push   $0x6c
+  80061c:	68 e5 2c 80 00       	push   $0x802ce5
+  800621:	e8 b9 00 00 00       	call   8006df <_panic>
+		panic("open /big: %e", f);
+  800626:	50                   	push   %eax
+  800627:	68 4b 2e 80 00       	push   $0x802e4b
+  80062c:	6a 71                	push   $0x71
+  80062e:	68 e5 2c 80 00       	push   $0x802ce5
+  800633:	e8 a7 00 00 00       	call   8006df <_panic>
+			panic("read /big@%d: %e", i, r);
+  800638:	83 ec 0c             	sub    $0xc,%esp
+  80063b:	50                   	push   %eax
+  80063c:	53                   	push   %ebx
+  80063d:	68 59 2e 80 00       	push   $0x802e59
+  800642:	6a 75                	push   $0x75
+  800644:	68 e5 2c 80 00       	push   $0x802ce5
+  800649:	e8 91 00 00 00       	call   8006df <_panic>
+			panic("read /big from %d returned %d < %d bytes",
+  80064e:	83 ec 08             	sub    $0x8,%esp
+  800651:	68 00 02 00 00       	push   $0x200
+  800656:	50                   	push   %eax
+  800657:	53                   	push   %ebx
+  800658:	68 08 30 80 00       	push   $0x803008
+  80065d:	6a 77                	push   $0x77
+  80065f:	68 e5 2c 80 00       	push   $0x802ce5
+  800664:	e8 76 00 00 00       	call   8006df <_panic>
+			panic("read /big from %d returned bad data %d",
+  800669:	83 ec 0c             	sub    $0xc,%esp
+  80066c:	50                   	push   %eax
+  80066d:	53                   	push   %ebx
+  80066e:	68 34 30 80 00       	push   $0x803034
+  800673:	6a 7a                	push   $0x7a
+  800675:	68 e5 2c 80 00       	push   $0x802ce5
+  80067a:	e8 60 00 00 00       	call   8006df <_panic>
+
+0080067f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80067f:	55                   	push   %ebp
+  800680:	89 e5                	mov    %esp,%ebp
+  800682:	56                   	push   %esi
+  800683:	53                   	push   %ebx
+  800684:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800687:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80068a:	e8 e7 0a 00 00       	call   801176 <sys_getenvid>
+  80068f:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800694:	c1 e0 09             	shl    $0x9,%eax
+  800697:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80069c:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8006a1:	85 db                	test   %ebx,%ebx
+  8006a3:	7e 07                	jle    8006ac <libmain+0x2d>
+		binaryname = argv[0];
+  8006a5:	8b 06                	mov    (%esi),%eax
+  8006a7:	a3 04 40 80 00       	mov    %eax,0x804004
+
+	// call user main routine
+	umain(argc, argv);
+  8006ac:	83 ec 08             	sub    $0x8,%esp
+  8006af:	56                   	push   %esi
+  8006b0:	53                   	push   %ebx
+  8006b1:	e8 c8 f9 ff ff       	call   80007e <umain>
+
+	// exit gracefully
+	exit();
+  8006b6:	e8 0a 00 00 00       	call   8006c5 <exit>
+}
+  8006bb:	83 c4 10             	add    $0x10,%esp
+  8006be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8006c1:	5b                   	pop    %ebx
+  8006c2:	5e                   	pop    %esi
+  8006c3:	5d                   	pop    %ebp
+  8006c4:	c3                   	ret
+
+008006c5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8006c5:	55                   	push   %ebp
+  8006c6:	89 e5                	mov    %esp,%ebp
+  8006c8:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8006cb:	e8 1a 12 00 00       	call   8018ea <close_all>
+	sys_env_destroy(0);
+  8006d0:	83 ec 0c             	sub    $0xc,%esp
+  8006d3:	6a 00                	push   $0x0
+  8006d5:	e8 5b 0a 00 00       	call   801135 <sys_env_destroy>
+}
+  8006da:	83 c4 10             	add    $0x10,%esp
+  8006dd:	c9                   	leave
+  8006de:	c3                   	ret
+
+008006df <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8006df:	55                   	push   %ebp
+  8006e0:	89 e5                	mov    %esp,%ebp
+  8006e2:	56                   	push   %esi
+  8006e3:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8006e4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006e7:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  8006ed:	e8 84 0a 00 00       	call   801176 <sys_getenvid>
+  8006f2:	83 ec 0c             	sub    $0xc,%esp
+  8006f5:	ff 75 0c             	push   0xc(%ebp)
+  8006f8:	ff 75 08             	push   0x8(%ebp)
+  8006fb:	56                   	push   %esi
+  8006fc:	50                   	push   %eax
+  8006fd:	68 8c 30 80 00       	push   $0x80308c
+  800702:	e8 b3 00 00 00       	call   8007ba <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800707:	83 c4 18             	add    $0x18,%esp
+  80070a:	53                   	push   %ebx
+  80070b:	ff 75 10             	push   0x10(%ebp)
+  80070e:	e8 56 00 00 00       	call   800769 <vcprintf>
+	cprintf("\n");
+  800713:	c7 04 24 20 35 80 00 	movl   $0x803520,(%esp)
+  80071a:	e8 9b 00 00 00       	call   8007ba <cprintf>
+  80071f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800722:	cc                   	int3
+	while (1)
+  800723:	eb fd                	jmp    800722 <_panic+0x43>
+
+00800725 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800725:	55                   	push   %ebp
+  800726:	89 e5                	mov    %esp,%ebp
+  800728:	53                   	push   %ebx
+  800729:	83 ec 04             	sub    $0x4,%esp
+  80072c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80072f:	8b 13                	mov    (%ebx),%edx
+  800731:	8d 42 01             	lea    0x1(%edx),%eax
+  800734:	89 03                	mov    %eax,(%ebx)
+  800736:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800739:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80073d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800742:	74 09                	je     80074d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800744:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800748:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80074b:	c9                   	leave
+  80074c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80074d:	83 ec 08             	sub    $0x8,%esp
+  800750:	68 ff 00 00 00       	push   $0xff
+  800755:	8d 43 08             	lea    0x8(%ebx),%eax
+  800758:	50                   	push   %eax
+  800759:	e8 7a 09 00 00       	call   8010d8 <sys_cputs>
+		b->idx = 0;
+  80075e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800764:	83 c4 10             	add    $0x10,%esp
+  800767:	eb db                	jmp    800744 <putch+0x1f>
+
+00800769 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800769:	55                   	push   %ebp
+  80076a:	89 e5                	mov    %esp,%ebp
+  80076c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800772:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800779:	00 00 00 
+	b.cnt = 0;
+  80077c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800783:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800786:	ff 75 0c             	push   0xc(%ebp)
+  800789:	ff 75 08             	push   0x8(%ebp)
+  80078c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800792:	50                   	push   %eax
+  800793:	68 25 07 80 00       	push   $0x800725
+  800798:	e8 14 01 00 00       	call   8008b1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80079d:	83 c4 08             	add    $0x8,%esp
+  8007a0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8007a6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8007ac:	50                   	push   %eax
+  8007ad:	e8 26 09 00 00       	call   8010d8 <sys_cputs>
+
+	return b.cnt;
+}
+  8007b2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8007b8:	c9                   	leave
+  8007b9:	c3                   	ret
+
+008007ba <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8007ba:	55                   	push   %ebp
+  8007bb:	89 e5                	mov    %esp,%ebp
+  8007bd:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8007c0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8007c3:	50                   	push   %eax
+  8007c4:	ff 75 08             	push   0x8(%ebp)
+  8007c7:	e8 9d ff ff ff       	call   800769 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8007cc:	c9                   	leave
+  8007cd:	c3                   	ret
+
+008007ce <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8007ce:	55                   	push   %ebp
+  8007cf:	89 e5                	mov    %esp,%ebp
+  8007d1:	57                   	push   %edi
+  8007d2:	56                   	push   %esi
+  8007d3:	53                   	push   %ebx
+  8007d4:	83 ec 1c             	sub    $0x1c,%esp
+  8007d7:	89 c7                	mov    %eax,%edi
+  8007d9:	89 d6                	mov    %edx,%esi
+  8007db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e1:	89 d1                	mov    %edx,%ecx
+  8007e3:	89 c2                	mov    %eax,%edx
+  8007e5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007e8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8007ee:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8007f1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007f4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8007fb:	39 c2                	cmp    %eax,%edx
+  8007fd:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800800:	72 3e                	jb     800840 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800802:	83 ec 0c             	sub    $0xc,%esp
+  800805:	ff 75 18             	push   0x18(%ebp)
+  800808:	83 eb 01             	sub    $0x1,%ebx
+  80080b:	53                   	push   %ebx
+  80080c:	50                   	push   %eax
+  80080d:	83 ec 08             	sub    $0x8,%esp
+  800810:	ff 75 e4             	push   -0x1c(%ebp)
+  800813:	ff 75 e0             	push   -0x20(%ebp)
+  800816:	ff 75 dc             	push   -0x24(%ebp)
+  800819:	ff 75 d8             	push   -0x28(%ebp)
+  80081c:	e8 1f 21 00 00       	call   802940 <__udivdi3>
+  800821:	83 c4 18             	add    $0x18,%esp
+  800824:	52                   	push   %edx
+  800825:	50                   	push   %eax
+  800826:	89 f2                	mov    %esi,%edx
+  800828:	89 f8                	mov    %edi,%eax
+  80082a:	e8 9f ff ff ff       	call   8007ce <printnum>
+  80082f:	83 c4 20             	add    $0x20,%esp
+  800832:	eb 13                	jmp    800847 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800834:	83 ec 08             	sub    $0x8,%esp
+  800837:	56                   	push   %esi
+  800838:	ff 75 18             	push   0x18(%ebp)
+  80083b:	ff d7                	call   *%edi
+  80083d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800840:	83 eb 01             	sub    $0x1,%ebx
+  800843:	85 db                	test   %ebx,%ebx
+  800845:	7f ed                	jg     800834 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800847:	83 ec 08             	sub    $0x8,%esp
+  80084a:	56                   	push   %esi
+  80084b:	83 ec 04             	sub    $0x4,%esp
+  80084e:	ff 75 e4             	push   -0x1c(%ebp)
+  800851:	ff 75 e0             	push   -0x20(%ebp)
+  800854:	ff 75 dc             	push   -0x24(%ebp)
+  800857:	ff 75 d8             	push   -0x28(%ebp)
+  80085a:	e8 a1 21 00 00       	call   802a00 <__umoddi3>
+  80085f:	83 c4 14             	add    $0x14,%esp
+  800862:	0f be 80 af 30 80 00 	movsbl 0x8030af(%eax),%eax
+  800869:	50                   	push   %eax
+  80086a:	ff d7                	call   *%edi
+}
+  80086c:	83 c4 10             	add    $0x10,%esp
+  80086f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800872:	5b                   	pop    %ebx
+  800873:	5e                   	pop    %esi
+  800874:	5f                   	pop    %edi
+  800875:	5d                   	pop    %ebp
+  800876:	c3                   	ret
+
+00800877 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800877:	55                   	push   %ebp
+  800878:	89 e5                	mov    %esp,%ebp
+  80087a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80087d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800881:	8b 10                	mov    (%eax),%edx
+  800883:	3b 50 04             	cmp    0x4(%eax),%edx
+  800886:	73 0a                	jae    800892 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800888:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80088b:	89 08                	mov    %ecx,(%eax)
+  80088d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800890:	88 02                	mov    %al,(%edx)
+}
+  800892:	5d                   	pop    %ebp
+  800893:	c3                   	ret
+
+00800894 <printfmt>:
+{
+  800894:	55                   	push   %ebp
+  800895:	89 e5                	mov    %esp,%ebp
+  800897:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80089a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80089d:	50                   	push   %eax
+  80089e:	ff 75 10             	push   0x10(%ebp)
+  8008a1:	ff 75 0c             	push   0xc(%ebp)
+  8008a4:	ff 75 08             	push   0x8(%ebp)
+  8008a7:	e8 05 00 00 00       	call   8008b1 <vprintfmt>
+}
+  8008ac:	83 c4 10             	add    $0x10,%esp
+  8008af:	c9                   	leave
+  8008b0:	c3                   	ret
+
+008008b1 <vprintfmt>:
+{
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	57                   	push   %edi
+  8008b5:	56                   	push   %esi
+  8008b6:	53                   	push   %ebx
+  8008b7:	83 ec 2c             	sub    $0x2c,%esp
+  8008ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008c0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8008c3:	eb 0a                	jmp    8008cf <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8008c5:	83 ec 08             	sub    $0x8,%esp
+  8008c8:	53                   	push   %ebx
+  8008c9:	50                   	push   %eax
+  8008ca:	ff d6                	call   *%esi
+  8008cc:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008cf:	83 c7 01             	add    $0x1,%edi
+  8008d2:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8008d6:	83 f8 25             	cmp    $0x25,%eax
+  8008d9:	74 0c                	je     8008e7 <vprintfmt+0x36>
+			if (ch == '\0')
+  8008db:	85 c0                	test   %eax,%eax
+  8008dd:	75 e6                	jne    8008c5 <vprintfmt+0x14>
+}
+  8008df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008e2:	5b                   	pop    %ebx
+  8008e3:	5e                   	pop    %esi
+  8008e4:	5f                   	pop    %edi
+  8008e5:	5d                   	pop    %ebp
+  8008e6:	c3                   	ret
+		padc = ' ';
+  8008e7:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8008eb:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8008f2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8008f9:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800900:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800905:	8d 47 01             	lea    0x1(%edi),%eax
+  800908:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80090b:	0f b6 17             	movzbl (%edi),%edx
+  80090e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800911:	3c 55                	cmp    $0x55,%al
+  800913:	0f 87 cf 03 00 00    	ja     800ce8 <vprintfmt+0x437>
+  800919:	0f b6 c0             	movzbl %al,%eax
+  80091c:	ff 24 85 00 32 80 00 	jmp    *0x803200(,%eax,4)
+  800923:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800926:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80092a:	eb d9                	jmp    800905 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80092c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80092f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800933:	eb d0                	jmp    800905 <vprintfmt+0x54>
+  800935:	0f b6 d2             	movzbl %dl,%edx
+  800938:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80093b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800940:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800943:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800946:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80094a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80094d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800950:	83 f9 09             	cmp    $0x9,%ecx
+  800953:	77 55                	ja     8009aa <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800955:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800958:	eb e9                	jmp    800943 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80095a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095d:	8b 00                	mov    (%eax),%eax
+  80095f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800962:	8b 45 14             	mov    0x14(%ebp),%eax
+  800965:	8d 40 04             	lea    0x4(%eax),%eax
+  800968:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80096b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80096e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800972:	79 91                	jns    800905 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800974:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800977:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80097a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800981:	eb 82                	jmp    800905 <vprintfmt+0x54>
+			if (width < 0)
+  800983:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800986:	85 d2                	test   %edx,%edx
+  800988:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098d:	0f 49 c2             	cmovns %edx,%eax
+  800990:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800993:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800996:	e9 6a ff ff ff       	jmp    800905 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80099b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80099e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8009a5:	e9 5b ff ff ff       	jmp    800905 <vprintfmt+0x54>
+  8009aa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8009ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009b0:	eb bc                	jmp    80096e <vprintfmt+0xbd>
+			lflag++;
+  8009b2:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8009b8:	e9 48 ff ff ff       	jmp    800905 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8009bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c0:	8d 78 04             	lea    0x4(%eax),%edi
+  8009c3:	83 ec 08             	sub    $0x8,%esp
+  8009c6:	53                   	push   %ebx
+  8009c7:	ff 30                	push   (%eax)
+  8009c9:	ff d6                	call   *%esi
+			break;
+  8009cb:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8009ce:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8009d1:	e9 b1 02 00 00       	jmp    800c87 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8009d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d9:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8009dc:	8b 10                	mov    (%eax),%edx
+  8009de:	89 d0                	mov    %edx,%eax
+  8009e0:	f7 d8                	neg    %eax
+  8009e2:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8009e5:	83 f8 0f             	cmp    $0xf,%eax
+  8009e8:	7f 23                	jg     800a0d <vprintfmt+0x15c>
+  8009ea:	8b 14 85 60 33 80 00 	mov    0x803360(,%eax,4),%edx
+  8009f1:	85 d2                	test   %edx,%edx
+  8009f3:	74 18                	je     800a0d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8009f5:	52                   	push   %edx
+  8009f6:	68 b5 34 80 00       	push   $0x8034b5
+  8009fb:	53                   	push   %ebx
+  8009fc:	56                   	push   %esi
+  8009fd:	e8 92 fe ff ff       	call   800894 <printfmt>
+  800a02:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a05:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800a08:	e9 7a 02 00 00       	jmp    800c87 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800a0d:	50                   	push   %eax
+  800a0e:	68 c7 30 80 00       	push   $0x8030c7
+  800a13:	53                   	push   %ebx
+  800a14:	56                   	push   %esi
+  800a15:	e8 7a fe ff ff       	call   800894 <printfmt>
+  800a1a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a1d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800a20:	e9 62 02 00 00       	jmp    800c87 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a25:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a28:	83 c0 04             	add    $0x4,%eax
+  800a2b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800a2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a31:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800a33:	85 c9                	test   %ecx,%ecx
+  800a35:	b8 c0 30 80 00       	mov    $0x8030c0,%eax
+  800a3a:	0f 45 c1             	cmovne %ecx,%eax
+  800a3d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800a40:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800a44:	7e 06                	jle    800a4c <vprintfmt+0x19b>
+  800a46:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800a4a:	75 0b                	jne    800a57 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a4c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800a4f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800a52:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a55:	eb 5c                	jmp    800ab3 <vprintfmt+0x202>
+  800a57:	83 ec 08             	sub    $0x8,%esp
+  800a5a:	ff 75 d0             	push   -0x30(%ebp)
+  800a5d:	ff 75 cc             	push   -0x34(%ebp)
+  800a60:	e8 20 03 00 00       	call   800d85 <strnlen>
+  800a65:	89 c2                	mov    %eax,%edx
+  800a67:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a6a:	29 d0                	sub    %edx,%eax
+  800a6c:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800a6f:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800a73:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a76:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a79:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a7b:	eb 0e                	jmp    800a8b <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800a7d:	83 ec 08             	sub    $0x8,%esp
+  800a80:	53                   	push   %ebx
+  800a81:	57                   	push   %edi
+  800a82:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a85:	83 ee 01             	sub    $0x1,%esi
+  800a88:	83 c4 10             	add    $0x10,%esp
+  800a8b:	85 f6                	test   %esi,%esi
+  800a8d:	7f ee                	jg     800a7d <vprintfmt+0x1cc>
+  800a8f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a92:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a95:	85 c0                	test   %eax,%eax
+  800a97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a9c:	0f 49 d0             	cmovns %eax,%edx
+  800a9f:	29 d0                	sub    %edx,%eax
+  800aa1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800aa4:	eb a6                	jmp    800a4c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800aa6:	83 ec 08             	sub    $0x8,%esp
+  800aa9:	53                   	push   %ebx
+  800aaa:	52                   	push   %edx
+  800aab:	ff 55 08             	call   *0x8(%ebp)
+  800aae:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ab1:	89 f1                	mov    %esi,%ecx
+  800ab3:	8d 71 01             	lea    0x1(%ecx),%esi
+  800ab6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800aba:	0f be d0             	movsbl %al,%edx
+  800abd:	85 d2                	test   %edx,%edx
+  800abf:	74 28                	je     800ae9 <vprintfmt+0x238>
+  800ac1:	85 ff                	test   %edi,%edi
+  800ac3:	78 05                	js     800aca <vprintfmt+0x219>
+  800ac5:	83 ef 01             	sub    $0x1,%edi
+  800ac8:	78 30                	js     800afa <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800aca:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800ace:	74 d6                	je     800aa6 <vprintfmt+0x1f5>
+  800ad0:	0f be c0             	movsbl %al,%eax
+  800ad3:	83 e8 20             	sub    $0x20,%eax
+  800ad6:	83 f8 5e             	cmp    $0x5e,%eax
+  800ad9:	76 cb                	jbe    800aa6 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800adb:	83 ec 08             	sub    $0x8,%esp
+  800ade:	53                   	push   %ebx
+  800adf:	6a 3f                	push   $0x3f
+  800ae1:	ff 55 08             	call   *0x8(%ebp)
+  800ae4:	83 c4 10             	add    $0x10,%esp
+  800ae7:	eb c8                	jmp    800ab1 <vprintfmt+0x200>
+  800ae9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aec:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800aef:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800af2:	01 d0                	add    %edx,%eax
+  800af4:	29 c8                	sub    %ecx,%eax
+  800af6:	89 c7                	mov    %eax,%edi
+  800af8:	eb 13                	jmp    800b0d <vprintfmt+0x25c>
+  800afa:	8b 75 08             	mov    0x8(%ebp),%esi
+  800afd:	eb ed                	jmp    800aec <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800aff:	83 ec 08             	sub    $0x8,%esp
+  800b02:	53                   	push   %ebx
+  800b03:	6a 20                	push   $0x20
+  800b05:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800b07:	83 ef 01             	sub    $0x1,%edi
+  800b0a:	83 c4 10             	add    $0x10,%esp
+  800b0d:	85 ff                	test   %edi,%edi
+  800b0f:	7f ee                	jg     800aff <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800b11:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800b14:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b17:	e9 6b 01 00 00       	jmp    800c87 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800b1c:	83 f9 01             	cmp    $0x1,%ecx
+  800b1f:	7f 1f                	jg     800b40 <vprintfmt+0x28f>
+	else if (lflag)
+  800b21:	85 c9                	test   %ecx,%ecx
+  800b23:	74 67                	je     800b8c <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800b25:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b28:	8b 00                	mov    (%eax),%eax
+  800b2a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b2d:	89 c1                	mov    %eax,%ecx
+  800b2f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b32:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b35:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b38:	8d 40 04             	lea    0x4(%eax),%eax
+  800b3b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b3e:	eb 17                	jmp    800b57 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800b40:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b43:	8b 50 04             	mov    0x4(%eax),%edx
+  800b46:	8b 00                	mov    (%eax),%eax
+  800b48:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b4b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b4e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b51:	8d 40 08             	lea    0x8(%eax),%eax
+  800b54:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800b57:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b5a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800b5d:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800b62:	85 c9                	test   %ecx,%ecx
+  800b64:	0f 89 03 01 00 00    	jns    800c6d <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800b6a:	83 ec 08             	sub    $0x8,%esp
+  800b6d:	53                   	push   %ebx
+  800b6e:	6a 2d                	push   $0x2d
+  800b70:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800b72:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b75:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b78:	f7 da                	neg    %edx
+  800b7a:	83 d1 00             	adc    $0x0,%ecx
+  800b7d:	f7 d9                	neg    %ecx
+  800b7f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800b82:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800b87:	e9 e1 00 00 00       	jmp    800c6d <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800b8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b8f:	8b 00                	mov    (%eax),%eax
+  800b91:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b94:	89 c1                	mov    %eax,%ecx
+  800b96:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b99:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b9f:	8d 40 04             	lea    0x4(%eax),%eax
+  800ba2:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ba5:	eb b0                	jmp    800b57 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800ba7:	83 f9 01             	cmp    $0x1,%ecx
+  800baa:	7f 1e                	jg     800bca <vprintfmt+0x319>
+	else if (lflag)
+  800bac:	85 c9                	test   %ecx,%ecx
+  800bae:	74 32                	je     800be2 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800bb0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb3:	8b 10                	mov    (%eax),%edx
+  800bb5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bba:	8d 40 04             	lea    0x4(%eax),%eax
+  800bbd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bc0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800bc5:	e9 a3 00 00 00       	jmp    800c6d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800bca:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bcd:	8b 10                	mov    (%eax),%edx
+  800bcf:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bd2:	8d 40 08             	lea    0x8(%eax),%eax
+  800bd5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bd8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800bdd:	e9 8b 00 00 00       	jmp    800c6d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800be2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800be5:	8b 10                	mov    (%eax),%edx
+  800be7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bec:	8d 40 04             	lea    0x4(%eax),%eax
+  800bef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bf2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800bf7:	eb 74                	jmp    800c6d <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800bf9:	83 f9 01             	cmp    $0x1,%ecx
+  800bfc:	7f 1b                	jg     800c19 <vprintfmt+0x368>
+	else if (lflag)
+  800bfe:	85 c9                	test   %ecx,%ecx
+  800c00:	74 2c                	je     800c2e <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800c02:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c05:	8b 10                	mov    (%eax),%edx
+  800c07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c0c:	8d 40 04             	lea    0x4(%eax),%eax
+  800c0f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c12:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800c17:	eb 54                	jmp    800c6d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800c19:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c1c:	8b 10                	mov    (%eax),%edx
+  800c1e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c21:	8d 40 08             	lea    0x8(%eax),%eax
+  800c24:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c27:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800c2c:	eb 3f                	jmp    800c6d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800c2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c31:	8b 10                	mov    (%eax),%edx
+  800c33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c38:	8d 40 04             	lea    0x4(%eax),%eax
+  800c3b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c3e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800c43:	eb 28                	jmp    800c6d <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800c45:	83 ec 08             	sub    $0x8,%esp
+  800c48:	53                   	push   %ebx
+  800c49:	6a 30                	push   $0x30
+  800c4b:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800c4d:	83 c4 08             	add    $0x8,%esp
+  800c50:	53                   	push   %ebx
+  800c51:	6a 78                	push   $0x78
+  800c53:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800c55:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c58:	8b 10                	mov    (%eax),%edx
+  800c5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800c5f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800c62:	8d 40 04             	lea    0x4(%eax),%eax
+  800c65:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c68:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800c6d:	83 ec 0c             	sub    $0xc,%esp
+  800c70:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800c74:	50                   	push   %eax
+  800c75:	ff 75 e0             	push   -0x20(%ebp)
+  800c78:	57                   	push   %edi
+  800c79:	51                   	push   %ecx
+  800c7a:	52                   	push   %edx
+  800c7b:	89 da                	mov    %ebx,%edx
+  800c7d:	89 f0                	mov    %esi,%eax
+  800c7f:	e8 4a fb ff ff       	call   8007ce <printnum>
+			break;
+  800c84:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800c87:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c8a:	e9 40 fc ff ff       	jmp    8008cf <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800c8f:	83 f9 01             	cmp    $0x1,%ecx
+  800c92:	7f 1b                	jg     800caf <vprintfmt+0x3fe>
+	else if (lflag)
+  800c94:	85 c9                	test   %ecx,%ecx
+  800c96:	74 2c                	je     800cc4 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800c98:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c9b:	8b 10                	mov    (%eax),%edx
+  800c9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ca2:	8d 40 04             	lea    0x4(%eax),%eax
+  800ca5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ca8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800cad:	eb be                	jmp    800c6d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800caf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cb2:	8b 10                	mov    (%eax),%edx
+  800cb4:	8b 48 04             	mov    0x4(%eax),%ecx
+  800cb7:	8d 40 08             	lea    0x8(%eax),%eax
+  800cba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cbd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800cc2:	eb a9                	jmp    800c6d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800cc4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cc7:	8b 10                	mov    (%eax),%edx
+  800cc9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cce:	8d 40 04             	lea    0x4(%eax),%eax
+  800cd1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cd4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800cd9:	eb 92                	jmp    800c6d <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800cdb:	83 ec 08             	sub    $0x8,%esp
+  800cde:	53                   	push   %ebx
+  800cdf:	6a 25                	push   $0x25
+  800ce1:	ff d6                	call   *%esi
+			break;
+  800ce3:	83 c4 10             	add    $0x10,%esp
+  800ce6:	eb 9f                	jmp    800c87 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800ce8:	83 ec 08             	sub    $0x8,%esp
+  800ceb:	53                   	push   %ebx
+  800cec:	6a 25                	push   $0x25
+  800cee:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800cf0:	83 c4 10             	add    $0x10,%esp
+  800cf3:	89 f8                	mov    %edi,%eax
+  800cf5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800cf9:	74 05                	je     800d00 <vprintfmt+0x44f>
+  800cfb:	83 e8 01             	sub    $0x1,%eax
+  800cfe:	eb f5                	jmp    800cf5 <vprintfmt+0x444>
+  800d00:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800d03:	eb 82                	jmp    800c87 <vprintfmt+0x3d6>
+
+00800d05 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800d05:	55                   	push   %ebp
+  800d06:	89 e5                	mov    %esp,%ebp
+  800d08:	83 ec 18             	sub    $0x18,%esp
+  800d0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800d11:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800d14:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800d18:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800d1b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800d22:	85 c0                	test   %eax,%eax
+  800d24:	74 26                	je     800d4c <vsnprintf+0x47>
+  800d26:	85 d2                	test   %edx,%edx
+  800d28:	7e 22                	jle    800d4c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800d2a:	ff 75 14             	push   0x14(%ebp)
+  800d2d:	ff 75 10             	push   0x10(%ebp)
+  800d30:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800d33:	50                   	push   %eax
+  800d34:	68 77 08 80 00       	push   $0x800877
+  800d39:	e8 73 fb ff ff       	call   8008b1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d3e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800d41:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800d44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d47:	83 c4 10             	add    $0x10,%esp
+}
+  800d4a:	c9                   	leave
+  800d4b:	c3                   	ret
+		return -E_INVAL;
+  800d4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d51:	eb f7                	jmp    800d4a <vsnprintf+0x45>
+
+00800d53 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d53:	55                   	push   %ebp
+  800d54:	89 e5                	mov    %esp,%ebp
+  800d56:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800d59:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800d5c:	50                   	push   %eax
+  800d5d:	ff 75 10             	push   0x10(%ebp)
+  800d60:	ff 75 0c             	push   0xc(%ebp)
+  800d63:	ff 75 08             	push   0x8(%ebp)
+  800d66:	e8 9a ff ff ff       	call   800d05 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800d6b:	c9                   	leave
+  800d6c:	c3                   	ret
+
+00800d6d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800d73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d78:	eb 03                	jmp    800d7d <strlen+0x10>
+		n++;
+  800d7a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800d7d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800d81:	75 f7                	jne    800d7a <strlen+0xd>
+	return n;
+}
+  800d83:	5d                   	pop    %ebp
+  800d84:	c3                   	ret
+
+00800d85 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800d85:	55                   	push   %ebp
+  800d86:	89 e5                	mov    %esp,%ebp
+  800d88:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d8b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d93:	eb 03                	jmp    800d98 <strnlen+0x13>
+		n++;
+  800d95:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d98:	39 d0                	cmp    %edx,%eax
+  800d9a:	74 08                	je     800da4 <strnlen+0x1f>
+  800d9c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800da0:	75 f3                	jne    800d95 <strnlen+0x10>
+  800da2:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800da4:	89 d0                	mov    %edx,%eax
+  800da6:	5d                   	pop    %ebp
+  800da7:	c3                   	ret
+
+00800da8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	53                   	push   %ebx
+  800dac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800daf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800db2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800dbb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800dbe:	83 c0 01             	add    $0x1,%eax
+  800dc1:	84 d2                	test   %dl,%dl
+  800dc3:	75 f2                	jne    800db7 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800dc5:	89 c8                	mov    %ecx,%eax
+  800dc7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dca:	c9                   	leave
+  800dcb:	c3                   	ret
+
+00800dcc <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800dcc:	55                   	push   %ebp
+  800dcd:	89 e5                	mov    %esp,%ebp
+  800dcf:	53                   	push   %ebx
+  800dd0:	83 ec 10             	sub    $0x10,%esp
+  800dd3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800dd6:	53                   	push   %ebx
+  800dd7:	e8 91 ff ff ff       	call   800d6d <strlen>
+  800ddc:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ddf:	ff 75 0c             	push   0xc(%ebp)
+  800de2:	01 d8                	add    %ebx,%eax
+  800de4:	50                   	push   %eax
+  800de5:	e8 be ff ff ff       	call   800da8 <strcpy>
+	return dst;
+}
+  800dea:	89 d8                	mov    %ebx,%eax
+  800dec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800def:	c9                   	leave
+  800df0:	c3                   	ret
+
+00800df1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	56                   	push   %esi
+  800df5:	53                   	push   %ebx
+  800df6:	8b 75 08             	mov    0x8(%ebp),%esi
+  800df9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800dfc:	89 f3                	mov    %esi,%ebx
+  800dfe:	03 5d 10             	add    0x10(%ebp),%ebx
+  800e01:	89 f0                	mov    %esi,%eax
+  800e03:	eb 0f                	jmp    800e14 <strncpy+0x23>
+		*dst++ = *src;
+  800e05:	83 c0 01             	add    $0x1,%eax
+  800e08:	0f b6 0a             	movzbl (%edx),%ecx
+  800e0b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800e0e:	80 f9 01             	cmp    $0x1,%cl
+  800e11:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800e14:	39 d8                	cmp    %ebx,%eax
+  800e16:	75 ed                	jne    800e05 <strncpy+0x14>
+	}
+	return ret;
+}
+  800e18:	89 f0                	mov    %esi,%eax
+  800e1a:	5b                   	pop    %ebx
+  800e1b:	5e                   	pop    %esi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+
+00800e1e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	56                   	push   %esi
+  800e22:	53                   	push   %ebx
+  800e23:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e29:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800e2c:	89 f0                	mov    %esi,%eax
+  800e2e:	85 d2                	test   %edx,%edx
+  800e30:	74 21                	je     800e53 <strlcpy+0x35>
+  800e32:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800e36:	89 f2                	mov    %esi,%edx
+  800e38:	eb 09                	jmp    800e43 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800e3a:	83 c1 01             	add    $0x1,%ecx
+  800e3d:	83 c2 01             	add    $0x1,%edx
+  800e40:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800e43:	39 c2                	cmp    %eax,%edx
+  800e45:	74 09                	je     800e50 <strlcpy+0x32>
+  800e47:	0f b6 19             	movzbl (%ecx),%ebx
+  800e4a:	84 db                	test   %bl,%bl
+  800e4c:	75 ec                	jne    800e3a <strlcpy+0x1c>
+  800e4e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800e50:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800e53:	29 f0                	sub    %esi,%eax
+}
+  800e55:	5b                   	pop    %ebx
+  800e56:	5e                   	pop    %esi
+  800e57:	5d                   	pop    %ebp
+  800e58:	c3                   	ret
+
+00800e59 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800e59:	55                   	push   %ebp
+  800e5a:	89 e5                	mov    %esp,%ebp
+  800e5c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800e62:	eb 06                	jmp    800e6a <strcmp+0x11>
+		p++, q++;
+  800e64:	83 c1 01             	add    $0x1,%ecx
+  800e67:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800e6a:	0f b6 01             	movzbl (%ecx),%eax
+  800e6d:	84 c0                	test   %al,%al
+  800e6f:	74 04                	je     800e75 <strcmp+0x1c>
+  800e71:	3a 02                	cmp    (%edx),%al
+  800e73:	74 ef                	je     800e64 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e75:	0f b6 c0             	movzbl %al,%eax
+  800e78:	0f b6 12             	movzbl (%edx),%edx
+  800e7b:	29 d0                	sub    %edx,%eax
+}
+  800e7d:	5d                   	pop    %ebp
+  800e7e:	c3                   	ret
+
+00800e7f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	53                   	push   %ebx
+  800e83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e89:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800e8c:	eb 09                	jmp    800e97 <strncmp+0x18>
+		n--, p++, q++;
+  800e8e:	83 ea 01             	sub    $0x1,%edx
+  800e91:	83 c0 01             	add    $0x1,%eax
+  800e94:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800e97:	85 d2                	test   %edx,%edx
+  800e99:	74 18                	je     800eb3 <strncmp+0x34>
+  800e9b:	0f b6 18             	movzbl (%eax),%ebx
+  800e9e:	84 db                	test   %bl,%bl
+  800ea0:	74 04                	je     800ea6 <strncmp+0x27>
+  800ea2:	3a 19                	cmp    (%ecx),%bl
+  800ea4:	74 e8                	je     800e8e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ea6:	0f b6 00             	movzbl (%eax),%eax
+  800ea9:	0f b6 11             	movzbl (%ecx),%edx
+  800eac:	29 d0                	sub    %edx,%eax
+}
+  800eae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800eb1:	c9                   	leave
+  800eb2:	c3                   	ret
+		return 0;
+  800eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb8:	eb f4                	jmp    800eae <strncmp+0x2f>
+
+00800eba <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800eba:	55                   	push   %ebp
+  800ebb:	89 e5                	mov    %esp,%ebp
+  800ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ec0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ec4:	eb 03                	jmp    800ec9 <strchr+0xf>
+  800ec6:	83 c0 01             	add    $0x1,%eax
+  800ec9:	0f b6 10             	movzbl (%eax),%edx
+  800ecc:	84 d2                	test   %dl,%dl
+  800ece:	74 06                	je     800ed6 <strchr+0x1c>
+		if (*s == c)
+  800ed0:	38 ca                	cmp    %cl,%dl
+  800ed2:	75 f2                	jne    800ec6 <strchr+0xc>
+  800ed4:	eb 05                	jmp    800edb <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800edb:	5d                   	pop    %ebp
+  800edc:	c3                   	ret
+
+00800edd <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800edd:	55                   	push   %ebp
+  800ede:	89 e5                	mov    %esp,%ebp
+  800ee0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ee7:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800eea:	38 ca                	cmp    %cl,%dl
+  800eec:	74 09                	je     800ef7 <strfind+0x1a>
+  800eee:	84 d2                	test   %dl,%dl
+  800ef0:	74 05                	je     800ef7 <strfind+0x1a>
+	for (; *s; s++)
+  800ef2:	83 c0 01             	add    $0x1,%eax
+  800ef5:	eb f0                	jmp    800ee7 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800ef7:	5d                   	pop    %ebp
+  800ef8:	c3                   	ret
+
+00800ef9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ef9:	55                   	push   %ebp
+  800efa:	89 e5                	mov    %esp,%ebp
+  800efc:	57                   	push   %edi
+  800efd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f00:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800f03:	85 c9                	test   %ecx,%ecx
+  800f05:	74 20                	je     800f27 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800f07:	89 f8                	mov    %edi,%eax
+  800f09:	09 c8                	or     %ecx,%eax
+  800f0b:	a8 03                	test   $0x3,%al
+  800f0d:	75 12                	jne    800f21 <memset+0x28>
+		c &= 0xFF;
+  800f0f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800f13:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800f19:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800f1c:	fc                   	cld
+  800f1d:	f3 ab                	rep stos %eax,%es:(%edi)
+  800f1f:	eb 06                	jmp    800f27 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800f21:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f24:	fc                   	cld
+  800f25:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800f27:	89 f8                	mov    %edi,%eax
+  800f29:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800f2c:	c9                   	leave
+  800f2d:	c3                   	ret
+
+00800f2e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800f2e:	55                   	push   %ebp
+  800f2f:	89 e5                	mov    %esp,%ebp
+  800f31:	57                   	push   %edi
+  800f32:	56                   	push   %esi
+  800f33:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f36:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f39:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800f3c:	39 c6                	cmp    %eax,%esi
+  800f3e:	73 32                	jae    800f72 <memmove+0x44>
+  800f40:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800f43:	39 d0                	cmp    %edx,%eax
+  800f45:	73 2b                	jae    800f72 <memmove+0x44>
+		s += n;
+		d += n;
+  800f47:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f4a:	89 d6                	mov    %edx,%esi
+  800f4c:	09 fe                	or     %edi,%esi
+  800f4e:	09 ce                	or     %ecx,%esi
+  800f50:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800f56:	75 0e                	jne    800f66 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800f58:	83 ef 04             	sub    $0x4,%edi
+  800f5b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800f5e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800f61:	fd                   	std
+  800f62:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f64:	eb 09                	jmp    800f6f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f66:	83 ef 01             	sub    $0x1,%edi
+  800f69:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800f6c:	fd                   	std
+  800f6d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f6f:	fc                   	cld
+  800f70:	eb 1a                	jmp    800f8c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f72:	89 f2                	mov    %esi,%edx
+  800f74:	09 c2                	or     %eax,%edx
+  800f76:	09 ca                	or     %ecx,%edx
+  800f78:	f6 c2 03             	test   $0x3,%dl
+  800f7b:	75 0a                	jne    800f87 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f7d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f80:	89 c7                	mov    %eax,%edi
+  800f82:	fc                   	cld
+  800f83:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f85:	eb 05                	jmp    800f8c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800f87:	89 c7                	mov    %eax,%edi
+  800f89:	fc                   	cld
+  800f8a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800f8c:	5e                   	pop    %esi
+  800f8d:	5f                   	pop    %edi
+  800f8e:	5d                   	pop    %ebp
+  800f8f:	c3                   	ret
+
+00800f90 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800f90:	55                   	push   %ebp
+  800f91:	89 e5                	mov    %esp,%ebp
+  800f93:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800f96:	ff 75 10             	push   0x10(%ebp)
+  800f99:	ff 75 0c             	push   0xc(%ebp)
+  800f9c:	ff 75 08             	push   0x8(%ebp)
+  800f9f:	e8 8a ff ff ff       	call   800f2e <memmove>
+}
+  800fa4:	c9                   	leave
+  800fa5:	c3                   	ret
+
+00800fa6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800fa6:	55                   	push   %ebp
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	56                   	push   %esi
+  800faa:	53                   	push   %ebx
+  800fab:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fae:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800fb1:	89 c6                	mov    %eax,%esi
+  800fb3:	03 75 10             	add    0x10(%ebp),%esi
+  800fb6:	eb 06                	jmp    800fbe <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800fb8:	83 c0 01             	add    $0x1,%eax
+  800fbb:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800fbe:	39 f0                	cmp    %esi,%eax
+  800fc0:	74 14                	je     800fd6 <memcmp+0x30>
+		if (*s1 != *s2)
+  800fc2:	0f b6 08             	movzbl (%eax),%ecx
+  800fc5:	0f b6 1a             	movzbl (%edx),%ebx
+  800fc8:	38 d9                	cmp    %bl,%cl
+  800fca:	74 ec                	je     800fb8 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800fcc:	0f b6 c1             	movzbl %cl,%eax
+  800fcf:	0f b6 db             	movzbl %bl,%ebx
+  800fd2:	29 d8                	sub    %ebx,%eax
+  800fd4:	eb 05                	jmp    800fdb <memcmp+0x35>
+	}
+
+	return 0;
+  800fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fdb:	5b                   	pop    %ebx
+  800fdc:	5e                   	pop    %esi
+  800fdd:	5d                   	pop    %ebp
+  800fde:	c3                   	ret
+
+00800fdf <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800fe8:	89 c2                	mov    %eax,%edx
+  800fea:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800fed:	eb 03                	jmp    800ff2 <memfind+0x13>
+  800fef:	83 c0 01             	add    $0x1,%eax
+  800ff2:	39 d0                	cmp    %edx,%eax
+  800ff4:	73 04                	jae    800ffa <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ff6:	38 08                	cmp    %cl,(%eax)
+  800ff8:	75 f5                	jne    800fef <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ffa:	5d                   	pop    %ebp
+  800ffb:	c3                   	ret
+
+00800ffc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ffc:	55                   	push   %ebp
+  800ffd:	89 e5                	mov    %esp,%ebp
+  800fff:	57                   	push   %edi
+  801000:	56                   	push   %esi
+  801001:	53                   	push   %ebx
+  801002:	8b 55 08             	mov    0x8(%ebp),%edx
+  801005:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801008:	eb 03                	jmp    80100d <strtol+0x11>
+		s++;
+  80100a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80100d:	0f b6 02             	movzbl (%edx),%eax
+  801010:	3c 20                	cmp    $0x20,%al
+  801012:	74 f6                	je     80100a <strtol+0xe>
+  801014:	3c 09                	cmp    $0x9,%al
+  801016:	74 f2                	je     80100a <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801018:	3c 2b                	cmp    $0x2b,%al
+  80101a:	74 2a                	je     801046 <strtol+0x4a>
+	int neg = 0;
+  80101c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801021:	3c 2d                	cmp    $0x2d,%al
+  801023:	74 2b                	je     801050 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801025:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80102b:	75 0f                	jne    80103c <strtol+0x40>
+  80102d:	80 3a 30             	cmpb   $0x30,(%edx)
+  801030:	74 28                	je     80105a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801032:	85 db                	test   %ebx,%ebx
+  801034:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801039:	0f 44 d8             	cmove  %eax,%ebx
+  80103c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801041:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801044:	eb 46                	jmp    80108c <strtol+0x90>
+		s++;
+  801046:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801049:	bf 00 00 00 00       	mov    $0x0,%edi
+  80104e:	eb d5                	jmp    801025 <strtol+0x29>
+		s++, neg = 1;
+  801050:	83 c2 01             	add    $0x1,%edx
+  801053:	bf 01 00 00 00       	mov    $0x1,%edi
+  801058:	eb cb                	jmp    801025 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80105a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80105e:	74 0e                	je     80106e <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801060:	85 db                	test   %ebx,%ebx
+  801062:	75 d8                	jne    80103c <strtol+0x40>
+		s++, base = 8;
+  801064:	83 c2 01             	add    $0x1,%edx
+  801067:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80106c:	eb ce                	jmp    80103c <strtol+0x40>
+		s += 2, base = 16;
+  80106e:	83 c2 02             	add    $0x2,%edx
+  801071:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801076:	eb c4                	jmp    80103c <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801078:	0f be c0             	movsbl %al,%eax
+  80107b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80107e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801081:	7d 3a                	jge    8010bd <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801083:	83 c2 01             	add    $0x1,%edx
+  801086:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80108a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80108c:	0f b6 02             	movzbl (%edx),%eax
+  80108f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801092:	89 f3                	mov    %esi,%ebx
+  801094:	80 fb 09             	cmp    $0x9,%bl
+  801097:	76 df                	jbe    801078 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801099:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80109c:	89 f3                	mov    %esi,%ebx
+  80109e:	80 fb 19             	cmp    $0x19,%bl
+  8010a1:	77 08                	ja     8010ab <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8010a3:	0f be c0             	movsbl %al,%eax
+  8010a6:	83 e8 57             	sub    $0x57,%eax
+  8010a9:	eb d3                	jmp    80107e <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8010ab:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8010ae:	89 f3                	mov    %esi,%ebx
+  8010b0:	80 fb 19             	cmp    $0x19,%bl
+  8010b3:	77 08                	ja     8010bd <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8010b5:	0f be c0             	movsbl %al,%eax
+  8010b8:	83 e8 37             	sub    $0x37,%eax
+  8010bb:	eb c1                	jmp    80107e <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8010bd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8010c1:	74 05                	je     8010c8 <strtol+0xcc>
+		*endptr = (char *) s;
+  8010c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010c6:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8010c8:	89 c8                	mov    %ecx,%eax
+  8010ca:	f7 d8                	neg    %eax
+  8010cc:	85 ff                	test   %edi,%edi
+  8010ce:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8010d1:	89 c8                	mov    %ecx,%eax
+  8010d3:	5b                   	pop    %ebx
+  8010d4:	5e                   	pop    %esi
+  8010d5:	5f                   	pop    %edi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	c3                   	ret
+
+008010d8 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e9:	89 c3                	mov    %eax,%ebx
+  8010eb:	89 c7                	mov    %eax,%edi
+  8010ed:	89 c6                	mov    %eax,%esi
+  8010ef:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8010f1:	5b                   	pop    %ebx
+  8010f2:	5e                   	pop    %esi
+  8010f3:	5f                   	pop    %edi
+  8010f4:	5d                   	pop    %ebp
+  8010f5:	c3                   	ret
+
+008010f6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8010f6:	55                   	push   %ebp
+  8010f7:	89 e5                	mov    %esp,%ebp
+  8010f9:	57                   	push   %edi
+  8010fa:	56                   	push   %esi
+  8010fb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801101:	b8 01 00 00 00       	mov    $0x1,%eax
+  801106:	89 d1                	mov    %edx,%ecx
+  801108:	89 d3                	mov    %edx,%ebx
+  80110a:	89 d7                	mov    %edx,%edi
+  80110c:	89 d6                	mov    %edx,%esi
+  80110e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801110:	5b                   	pop    %ebx
+  801111:	5e                   	pop    %esi
+  801112:	5f                   	pop    %edi
+  801113:	5d                   	pop    %ebp
+  801114:	c3                   	ret
+
+00801115 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  801115:	55                   	push   %ebp
+  801116:	89 e5                	mov    %esp,%ebp
+  801118:	57                   	push   %edi
+  801119:	56                   	push   %esi
+  80111a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80111b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801120:	8b 55 08             	mov    0x8(%ebp),%edx
+  801123:	b8 04 00 00 00       	mov    $0x4,%eax
+  801128:	89 cb                	mov    %ecx,%ebx
+  80112a:	89 cf                	mov    %ecx,%edi
+  80112c:	89 ce                	mov    %ecx,%esi
+  80112e:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  801130:	5b                   	pop    %ebx
+  801131:	5e                   	pop    %esi
+  801132:	5f                   	pop    %edi
+  801133:	5d                   	pop    %ebp
+  801134:	c3                   	ret
+
+00801135 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801135:	55                   	push   %ebp
+  801136:	89 e5                	mov    %esp,%ebp
+  801138:	57                   	push   %edi
+  801139:	56                   	push   %esi
+  80113a:	53                   	push   %ebx
+  80113b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80113e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801143:	8b 55 08             	mov    0x8(%ebp),%edx
+  801146:	b8 03 00 00 00       	mov    $0x3,%eax
+  80114b:	89 cb                	mov    %ecx,%ebx
+  80114d:	89 cf                	mov    %ecx,%edi
+  80114f:	89 ce                	mov    %ecx,%esi
+  801151:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801153:	85 c0                	test   %eax,%eax
+  801155:	7f 08                	jg     80115f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801157:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115a:	5b                   	pop    %ebx
+  80115b:	5e                   	pop    %esi
+  80115c:	5f                   	pop    %edi
+  80115d:	5d                   	pop    %ebp
+  80115e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80115f:	83 ec 0c             	sub    $0xc,%esp
+  801162:	50                   	push   %eax
+  801163:	6a 03                	push   $0x3
+  801165:	68 bf 33 80 00       	push   $0x8033bf
+  80116a:	6a 23                	push   $0x23
+  80116c:	68 dc 33 80 00       	push   $0x8033dc
+  801171:	e8 69 f5 ff ff       	call   8006df <_panic>
+
+00801176 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801176:	55                   	push   %ebp
+  801177:	89 e5                	mov    %esp,%ebp
+  801179:	57                   	push   %edi
+  80117a:	56                   	push   %esi
+  80117b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80117c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801181:	b8 02 00 00 00       	mov    $0x2,%eax
+  801186:	89 d1                	mov    %edx,%ecx
+  801188:	89 d3                	mov    %edx,%ebx
+  80118a:	89 d7                	mov    %edx,%edi
+  80118c:	89 d6                	mov    %edx,%esi
+  80118e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801190:	5b                   	pop    %ebx
+  801191:	5e                   	pop    %esi
+  801192:	5f                   	pop    %edi
+  801193:	5d                   	pop    %ebp
+  801194:	c3                   	ret
+
+00801195 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801195:	55                   	push   %ebp
+  801196:	89 e5                	mov    %esp,%ebp
+  801198:	57                   	push   %edi
+  801199:	56                   	push   %esi
+  80119a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80119b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a0:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011a5:	89 d1                	mov    %edx,%ecx
+  8011a7:	89 d3                	mov    %edx,%ebx
+  8011a9:	89 d7                	mov    %edx,%edi
+  8011ab:	89 d6                	mov    %edx,%esi
+  8011ad:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8011af:	5b                   	pop    %ebx
+  8011b0:	5e                   	pop    %esi
+  8011b1:	5f                   	pop    %edi
+  8011b2:	5d                   	pop    %ebp
+  8011b3:	c3                   	ret
+
+008011b4 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  8011b4:	55                   	push   %ebp
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	57                   	push   %edi
+  8011b8:	56                   	push   %esi
+  8011b9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011bf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011c4:	89 d1                	mov    %edx,%ecx
+  8011c6:	89 d3                	mov    %edx,%ebx
+  8011c8:	89 d7                	mov    %edx,%edi
+  8011ca:	89 d6                	mov    %edx,%esi
+  8011cc:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  8011ce:	5b                   	pop    %ebx
+  8011cf:	5e                   	pop    %esi
+  8011d0:	5f                   	pop    %edi
+  8011d1:	5d                   	pop    %ebp
+  8011d2:	c3                   	ret
+
+008011d3 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  8011d3:	55                   	push   %ebp
+  8011d4:	89 e5                	mov    %esp,%ebp
+  8011d6:	57                   	push   %edi
+  8011d7:	56                   	push   %esi
+  8011d8:	53                   	push   %ebx
+  8011d9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011ec:	89 df                	mov    %ebx,%edi
+  8011ee:	89 de                	mov    %ebx,%esi
+  8011f0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	7f 08                	jg     8011fe <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  8011f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f9:	5b                   	pop    %ebx
+  8011fa:	5e                   	pop    %esi
+  8011fb:	5f                   	pop    %edi
+  8011fc:	5d                   	pop    %ebp
+  8011fd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011fe:	83 ec 0c             	sub    $0xc,%esp
+  801201:	50                   	push   %eax
+  801202:	6a 15                	push   $0x15
+  801204:	68 bf 33 80 00       	push   $0x8033bf
+  801209:	6a 23                	push   $0x23
+  80120b:	68 dc 33 80 00       	push   $0x8033dc
+  801210:	e8 ca f4 ff ff       	call   8006df <_panic>
+
+00801215 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	57                   	push   %edi
+  801219:	56                   	push   %esi
+  80121a:	53                   	push   %ebx
+  80121b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80121e:	be 00 00 00 00       	mov    $0x0,%esi
+  801223:	8b 55 08             	mov    0x8(%ebp),%edx
+  801226:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801229:	b8 05 00 00 00       	mov    $0x5,%eax
+  80122e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801231:	89 f7                	mov    %esi,%edi
+  801233:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801235:	85 c0                	test   %eax,%eax
+  801237:	7f 08                	jg     801241 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801239:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123c:	5b                   	pop    %ebx
+  80123d:	5e                   	pop    %esi
+  80123e:	5f                   	pop    %edi
+  80123f:	5d                   	pop    %ebp
+  801240:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801241:	83 ec 0c             	sub    $0xc,%esp
+  801244:	50                   	push   %eax
+  801245:	6a 05                	push   $0x5
+  801247:	68 bf 33 80 00       	push   $0x8033bf
+  80124c:	6a 23                	push   $0x23
+  80124e:	68 dc 33 80 00       	push   $0x8033dc
+  801253:	e8 87 f4 ff ff       	call   8006df <_panic>
+
+00801258 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  801258:	55                   	push   %ebp
+  801259:	89 e5                	mov    %esp,%ebp
+  80125b:	57                   	push   %edi
+  80125c:	56                   	push   %esi
+  80125d:	53                   	push   %ebx
+  80125e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801261:	be 00 00 00 00       	mov    $0x0,%esi
+  801266:	8b 55 08             	mov    0x8(%ebp),%edx
+  801269:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801271:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801274:	89 f7                	mov    %esi,%edi
+  801276:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801278:	85 c0                	test   %eax,%eax
+  80127a:	7f 08                	jg     801284 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80127c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5f                   	pop    %edi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801284:	83 ec 0c             	sub    $0xc,%esp
+  801287:	50                   	push   %eax
+  801288:	6a 06                	push   $0x6
+  80128a:	68 bf 33 80 00       	push   $0x8033bf
+  80128f:	6a 23                	push   $0x23
+  801291:	68 dc 33 80 00       	push   $0x8033dc
+  801296:	e8 44 f4 ff ff       	call   8006df <_panic>
+
+0080129b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80129b:	55                   	push   %ebp
+  80129c:	89 e5                	mov    %esp,%ebp
+  80129e:	57                   	push   %edi
+  80129f:	56                   	push   %esi
+  8012a0:	53                   	push   %ebx
+  8012a1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012aa:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012b8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ba:	85 c0                	test   %eax,%eax
+  8012bc:	7f 08                	jg     8012c6 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8012be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c1:	5b                   	pop    %ebx
+  8012c2:	5e                   	pop    %esi
+  8012c3:	5f                   	pop    %edi
+  8012c4:	5d                   	pop    %ebp
+  8012c5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c6:	83 ec 0c             	sub    $0xc,%esp
+  8012c9:	50                   	push   %eax
+  8012ca:	6a 07                	push   $0x7
+  8012cc:	68 bf 33 80 00       	push   $0x8033bf
+  8012d1:	6a 23                	push   $0x23
+  8012d3:	68 dc 33 80 00       	push   $0x8033dc
+  8012d8:	e8 02 f4 ff ff       	call   8006df <_panic>
+
+008012dd <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8012dd:	55                   	push   %ebp
+  8012de:	89 e5                	mov    %esp,%ebp
+  8012e0:	57                   	push   %edi
+  8012e1:	56                   	push   %esi
+  8012e2:	53                   	push   %ebx
+  8012e3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012f6:	89 df                	mov    %ebx,%edi
+  8012f8:	89 de                	mov    %ebx,%esi
+  8012fa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012fc:	85 c0                	test   %eax,%eax
+  8012fe:	7f 08                	jg     801308 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801300:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801303:	5b                   	pop    %ebx
+  801304:	5e                   	pop    %esi
+  801305:	5f                   	pop    %edi
+  801306:	5d                   	pop    %ebp
+  801307:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801308:	83 ec 0c             	sub    $0xc,%esp
+  80130b:	50                   	push   %eax
+  80130c:	6a 08                	push   $0x8
+  80130e:	68 bf 33 80 00       	push   $0x8033bf
+  801313:	6a 23                	push   $0x23
+  801315:	68 dc 33 80 00       	push   $0x8033dc
+  80131a:	e8 c0 f3 ff ff       	call   8006df <_panic>
+
+0080131f <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  80131f:	55                   	push   %ebp
+  801320:	89 e5                	mov    %esp,%ebp
+  801322:	57                   	push   %edi
+  801323:	56                   	push   %esi
+  801324:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801325:	8b 55 08             	mov    0x8(%ebp),%edx
+  801328:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801330:	be 00 00 00 00       	mov    $0x0,%esi
+  801335:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801338:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80133b:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  80133d:	5b                   	pop    %ebx
+  80133e:	5e                   	pop    %esi
+  80133f:	5f                   	pop    %edi
+  801340:	5d                   	pop    %ebp
+  801341:	c3                   	ret
+
+00801342 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+  801345:	57                   	push   %edi
+  801346:	56                   	push   %esi
+  801347:	53                   	push   %ebx
+  801348:	8b 45 18             	mov    0x18(%ebp),%eax
+  80134b:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  80134e:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  801353:	77 27                	ja     80137c <sys_page_map_range+0x3a>
+  801355:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80135b:	77 1f                	ja     80137c <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  80135d:	c1 e0 0c             	shl    $0xc,%eax
+  801360:	89 c6                	mov    %eax,%esi
+  801362:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  801364:	8b 55 08             	mov    0x8(%ebp),%edx
+  801367:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80136f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801372:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801375:	cd 30                	int    $0x30
+}
+  801377:	5b                   	pop    %ebx
+  801378:	5e                   	pop    %esi
+  801379:	5f                   	pop    %edi
+  80137a:	5d                   	pop    %ebp
+  80137b:	c3                   	ret
+		return -E_INVAL;
+  80137c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801381:	eb f4                	jmp    801377 <sys_page_map_range+0x35>
+
+00801383 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+  801386:	57                   	push   %edi
+  801387:	56                   	push   %esi
+  801388:	53                   	push   %ebx
+  801389:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80138c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801392:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801397:	be 00 00 00 00       	mov    $0x0,%esi
+  80139c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013a2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013a4:	85 c0                	test   %eax,%eax
+  8013a6:	7f 08                	jg     8013b0 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8013a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ab:	5b                   	pop    %ebx
+  8013ac:	5e                   	pop    %esi
+  8013ad:	5f                   	pop    %edi
+  8013ae:	5d                   	pop    %ebp
+  8013af:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+  8013b3:	50                   	push   %eax
+  8013b4:	6a 0c                	push   $0xc
+  8013b6:	68 bf 33 80 00       	push   $0x8033bf
+  8013bb:	6a 23                	push   $0x23
+  8013bd:	68 dc 33 80 00       	push   $0x8033dc
+  8013c2:	e8 18 f3 ff ff       	call   8006df <_panic>
+
+008013c7 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8013c7:	55                   	push   %ebp
+  8013c8:	89 e5                	mov    %esp,%ebp
+  8013ca:	57                   	push   %edi
+  8013cb:	56                   	push   %esi
+  8013cc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8013dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e0:	89 f7                	mov    %esi,%edi
+  8013e2:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8013e4:	5b                   	pop    %ebx
+  8013e5:	5e                   	pop    %esi
+  8013e6:	5f                   	pop    %edi
+  8013e7:	5d                   	pop    %ebp
+  8013e8:	c3                   	ret
+
+008013e9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8013e9:	55                   	push   %ebp
+  8013ea:	89 e5                	mov    %esp,%ebp
+  8013ec:	57                   	push   %edi
+  8013ed:	56                   	push   %esi
+  8013ee:	53                   	push   %ebx
+  8013ef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801402:	89 df                	mov    %ebx,%edi
+  801404:	89 de                	mov    %ebx,%esi
+  801406:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801408:	85 c0                	test   %eax,%eax
+  80140a:	7f 08                	jg     801414 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80140c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80140f:	5b                   	pop    %ebx
+  801410:	5e                   	pop    %esi
+  801411:	5f                   	pop    %edi
+  801412:	5d                   	pop    %ebp
+  801413:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801414:	83 ec 0c             	sub    $0xc,%esp
+  801417:	50                   	push   %eax
+  801418:	6a 0f                	push   $0xf
+  80141a:	68 bf 33 80 00       	push   $0x8033bf
+  80141f:	6a 23                	push   $0x23
+  801421:	68 dc 33 80 00       	push   $0x8033dc
+  801426:	e8 b4 f2 ff ff       	call   8006df <_panic>
+
+0080142b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80142b:	55                   	push   %ebp
+  80142c:	89 e5                	mov    %esp,%ebp
+  80142e:	57                   	push   %edi
+  80142f:	56                   	push   %esi
+  801430:	53                   	push   %ebx
+  801431:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801434:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801439:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801444:	89 df                	mov    %ebx,%edi
+  801446:	89 de                	mov    %ebx,%esi
+  801448:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80144a:	85 c0                	test   %eax,%eax
+  80144c:	7f 08                	jg     801456 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  80144e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801451:	5b                   	pop    %ebx
+  801452:	5e                   	pop    %esi
+  801453:	5f                   	pop    %edi
+  801454:	5d                   	pop    %ebp
+  801455:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801456:	83 ec 0c             	sub    $0xc,%esp
+  801459:	50                   	push   %eax
+  80145a:	6a 10                	push   $0x10
+  80145c:	68 bf 33 80 00       	push   $0x8033bf
+  801461:	6a 23                	push   $0x23
+  801463:	68 dc 33 80 00       	push   $0x8033dc
+  801468:	e8 72 f2 ff ff       	call   8006df <_panic>
+
+0080146d <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80146d:	55                   	push   %ebp
+  80146e:	89 e5                	mov    %esp,%ebp
+  801470:	57                   	push   %edi
+  801471:	56                   	push   %esi
+  801472:	53                   	push   %ebx
+  801473:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801476:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80147b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801481:	b8 11 00 00 00       	mov    $0x11,%eax
+  801486:	89 df                	mov    %ebx,%edi
+  801488:	89 de                	mov    %ebx,%esi
+  80148a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80148c:	85 c0                	test   %eax,%eax
+  80148e:	7f 08                	jg     801498 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  801490:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801493:	5b                   	pop    %ebx
+  801494:	5e                   	pop    %esi
+  801495:	5f                   	pop    %edi
+  801496:	5d                   	pop    %ebp
+  801497:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801498:	83 ec 0c             	sub    $0xc,%esp
+  80149b:	50                   	push   %eax
+  80149c:	6a 11                	push   $0x11
+  80149e:	68 bf 33 80 00       	push   $0x8033bf
+  8014a3:	6a 23                	push   $0x23
+  8014a5:	68 dc 33 80 00       	push   $0x8033dc
+  8014aa:	e8 30 f2 ff ff       	call   8006df <_panic>
+
+008014af <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  8014af:	55                   	push   %ebp
+  8014b0:	89 e5                	mov    %esp,%ebp
+  8014b2:	57                   	push   %edi
+  8014b3:	56                   	push   %esi
+  8014b4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ba:	b8 12 00 00 00       	mov    $0x12,%eax
+  8014bf:	89 d1                	mov    %edx,%ecx
+  8014c1:	89 d3                	mov    %edx,%ebx
+  8014c3:	89 d7                	mov    %edx,%edi
+  8014c5:	89 d6                	mov    %edx,%esi
+  8014c7:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  8014c9:	5b                   	pop    %ebx
+  8014ca:	5e                   	pop    %esi
+  8014cb:	5f                   	pop    %edi
+  8014cc:	5d                   	pop    %ebp
+  8014cd:	c3                   	ret
+
+008014ce <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8014ce:	55                   	push   %ebp
+  8014cf:	89 e5                	mov    %esp,%ebp
+  8014d1:	57                   	push   %edi
+  8014d2:	56                   	push   %esi
+  8014d3:	53                   	push   %ebx
+  8014d4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8014d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e2:	b8 13 00 00 00       	mov    $0x13,%eax
+  8014e7:	89 df                	mov    %ebx,%edi
+  8014e9:	89 de                	mov    %ebx,%esi
+  8014eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014ed:	85 c0                	test   %eax,%eax
+  8014ef:	7f 08                	jg     8014f9 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8014f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f4:	5b                   	pop    %ebx
+  8014f5:	5e                   	pop    %esi
+  8014f6:	5f                   	pop    %edi
+  8014f7:	5d                   	pop    %ebp
+  8014f8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014f9:	83 ec 0c             	sub    $0xc,%esp
+  8014fc:	50                   	push   %eax
+  8014fd:	6a 13                	push   $0x13
+  8014ff:	68 bf 33 80 00       	push   $0x8033bf
+  801504:	6a 23                	push   $0x23
+  801506:	68 dc 33 80 00       	push   $0x8033dc
+  80150b:	e8 cf f1 ff ff       	call   8006df <_panic>
+
+00801510 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801510:	55                   	push   %ebp
+  801511:	89 e5                	mov    %esp,%ebp
+  801513:	57                   	push   %edi
+  801514:	56                   	push   %esi
+  801515:	53                   	push   %ebx
+  801516:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801519:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801521:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801524:	b8 14 00 00 00       	mov    $0x14,%eax
+  801529:	89 df                	mov    %ebx,%edi
+  80152b:	89 de                	mov    %ebx,%esi
+  80152d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80152f:	85 c0                	test   %eax,%eax
+  801531:	7f 08                	jg     80153b <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801533:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801536:	5b                   	pop    %ebx
+  801537:	5e                   	pop    %esi
+  801538:	5f                   	pop    %edi
+  801539:	5d                   	pop    %ebp
+  80153a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80153b:	83 ec 0c             	sub    $0xc,%esp
+  80153e:	50                   	push   %eax
+  80153f:	6a 14                	push   $0x14
+  801541:	68 bf 33 80 00       	push   $0x8033bf
+  801546:	6a 23                	push   $0x23
+  801548:	68 dc 33 80 00       	push   $0x8033dc
+  80154d:	e8 8d f1 ff ff       	call   8006df <_panic>
+
+00801552 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801552:	55                   	push   %ebp
+  801553:	89 e5                	mov    %esp,%ebp
+  801555:	57                   	push   %edi
+  801556:	56                   	push   %esi
+  801557:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801558:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801563:	be 00 00 00 00       	mov    $0x0,%esi
+  801568:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80156b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80156e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801570:	5b                   	pop    %ebx
+  801571:	5e                   	pop    %esi
+  801572:	5f                   	pop    %edi
+  801573:	5d                   	pop    %ebp
+  801574:	c3                   	ret
+
+00801575 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801575:	55                   	push   %ebp
+  801576:	89 e5                	mov    %esp,%ebp
+  801578:	57                   	push   %edi
+  801579:	56                   	push   %esi
+  80157a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80157b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801581:	b8 18 00 00 00       	mov    $0x18,%eax
+  801586:	be 00 00 00 00       	mov    $0x0,%esi
+  80158b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80158e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801591:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801593:	5b                   	pop    %ebx
+  801594:	5e                   	pop    %esi
+  801595:	5f                   	pop    %edi
+  801596:	5d                   	pop    %ebp
+  801597:	c3                   	ret
+
+00801598 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	57                   	push   %edi
+  80159c:	56                   	push   %esi
+  80159d:	53                   	push   %ebx
+  80159e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8015a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015ae:	89 cb                	mov    %ecx,%ebx
+  8015b0:	89 cf                	mov    %ecx,%edi
+  8015b2:	89 ce                	mov    %ecx,%esi
+  8015b4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015b6:	85 c0                	test   %eax,%eax
+  8015b8:	7f 08                	jg     8015c2 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8015ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015bd:	5b                   	pop    %ebx
+  8015be:	5e                   	pop    %esi
+  8015bf:	5f                   	pop    %edi
+  8015c0:	5d                   	pop    %ebp
+  8015c1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015c2:	83 ec 0c             	sub    $0xc,%esp
+  8015c5:	50                   	push   %eax
+  8015c6:	6a 19                	push   $0x19
+  8015c8:	68 bf 33 80 00       	push   $0x8033bf
+  8015cd:	6a 23                	push   $0x23
+  8015cf:	68 dc 33 80 00       	push   $0x8033dc
+  8015d4:	e8 06 f1 ff ff       	call   8006df <_panic>
+
+008015d9 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8015d9:	55                   	push   %ebp
+  8015da:	89 e5                	mov    %esp,%ebp
+  8015dc:	57                   	push   %edi
+  8015dd:	56                   	push   %esi
+  8015de:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015e9:	89 d1                	mov    %edx,%ecx
+  8015eb:	89 d3                	mov    %edx,%ebx
+  8015ed:	89 d7                	mov    %edx,%edi
+  8015ef:	89 d6                	mov    %edx,%esi
+  8015f1:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8015f3:	5b                   	pop    %ebx
+  8015f4:	5e                   	pop    %esi
+  8015f5:	5f                   	pop    %edi
+  8015f6:	5d                   	pop    %ebp
+  8015f7:	c3                   	ret
+
+008015f8 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8015f8:	55                   	push   %ebp
+  8015f9:	89 e5                	mov    %esp,%ebp
+  8015fb:	57                   	push   %edi
+  8015fc:	56                   	push   %esi
+  8015fd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801603:	8b 55 08             	mov    0x8(%ebp),%edx
+  801606:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801609:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80160e:	89 df                	mov    %ebx,%edi
+  801610:	89 de                	mov    %ebx,%esi
+  801612:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801614:	5b                   	pop    %ebx
+  801615:	5e                   	pop    %esi
+  801616:	5f                   	pop    %edi
+  801617:	5d                   	pop    %ebp
+  801618:	c3                   	ret
+
+00801619 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801619:	55                   	push   %ebp
+  80161a:	89 e5                	mov    %esp,%ebp
+  80161c:	57                   	push   %edi
+  80161d:	56                   	push   %esi
+  80161e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80161f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801624:	8b 55 08             	mov    0x8(%ebp),%edx
+  801627:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80162a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80162f:	89 df                	mov    %ebx,%edi
+  801631:	89 de                	mov    %ebx,%esi
+  801633:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801635:	5b                   	pop    %ebx
+  801636:	5e                   	pop    %esi
+  801637:	5f                   	pop    %edi
+  801638:	5d                   	pop    %ebp
+  801639:	c3                   	ret
+
+0080163a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80163a:	55                   	push   %ebp
+  80163b:	89 e5                	mov    %esp,%ebp
+  80163d:	57                   	push   %edi
+  80163e:	56                   	push   %esi
+  80163f:	53                   	push   %ebx
+  801640:	83 ec 18             	sub    $0x18,%esp
+  801643:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801646:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801649:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80164c:	85 db                	test   %ebx,%ebx
+  80164e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801653:	0f 45 c3             	cmovne %ebx,%eax
+  801656:	50                   	push   %eax
+  801657:	e8 3c ff ff ff       	call   801598 <sys_ipc_recv>
+
+	if (from_env_store)
+  80165c:	83 c4 10             	add    $0x10,%esp
+  80165f:	85 ff                	test   %edi,%edi
+  801661:	74 17                	je     80167a <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801663:	ba 00 00 00 00       	mov    $0x0,%edx
+  801668:	85 c0                	test   %eax,%eax
+  80166a:	75 0c                	jne    801678 <ipc_recv+0x3e>
+  80166c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  801672:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  801678:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  80167a:	85 f6                	test   %esi,%esi
+  80167c:	74 2e                	je     8016ac <ipc_recv+0x72>
+		if (!r && pg)
+  80167e:	85 c0                	test   %eax,%eax
+  801680:	75 24                	jne    8016a6 <ipc_recv+0x6c>
+  801682:	85 db                	test   %ebx,%ebx
+  801684:	74 20                	je     8016a6 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  801686:	a1 08 50 80 00       	mov    0x805008,%eax
+  80168b:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  801691:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  801693:	a1 08 50 80 00       	mov    0x805008,%eax
+  801698:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80169e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a1:	5b                   	pop    %ebx
+  8016a2:	5e                   	pop    %esi
+  8016a3:	5f                   	pop    %edi
+  8016a4:	5d                   	pop    %ebp
+  8016a5:	c3                   	ret
+			*perm_store = 0;
+  8016a6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	75 ee                	jne    80169e <ipc_recv+0x64>
+  8016b0:	eb e1                	jmp    801693 <ipc_recv+0x59>
+
+008016b2 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8016b2:	55                   	push   %ebp
+  8016b3:	89 e5                	mov    %esp,%ebp
+  8016b5:	57                   	push   %edi
+  8016b6:	56                   	push   %esi
+  8016b7:	53                   	push   %ebx
+  8016b8:	83 ec 0c             	sub    $0xc,%esp
+  8016bb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016be:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8016c4:	85 db                	test   %ebx,%ebx
+  8016c6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8016cb:	0f 44 d8             	cmove  %eax,%ebx
+  8016ce:	ff 75 14             	push   0x14(%ebp)
+  8016d1:	53                   	push   %ebx
+  8016d2:	56                   	push   %esi
+  8016d3:	57                   	push   %edi
+  8016d4:	e8 9c fe ff ff       	call   801575 <sys_ipc_try_send_yield>
+  8016d9:	83 c4 10             	add    $0x10,%esp
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	79 1e                	jns    8016fe <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8016e0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8016e3:	75 07                	jne    8016ec <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8016e5:	e8 ab fa ff ff       	call   801195 <sys_yield>
+  8016ea:	eb e2                	jmp    8016ce <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8016ec:	50                   	push   %eax
+  8016ed:	68 ea 33 80 00       	push   $0x8033ea
+  8016f2:	6a 3d                	push   $0x3d
+  8016f4:	68 ff 33 80 00       	push   $0x8033ff
+  8016f9:	e8 e1 ef ff ff       	call   8006df <_panic>
+	}
+}
+  8016fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801701:	5b                   	pop    %ebx
+  801702:	5e                   	pop    %esi
+  801703:	5f                   	pop    %edi
+  801704:	5d                   	pop    %ebp
+  801705:	c3                   	ret
+
+00801706 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801706:	55                   	push   %ebp
+  801707:	89 e5                	mov    %esp,%ebp
+  801709:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  80170c:	ff 75 08             	push   0x8(%ebp)
+  80170f:	e8 01 fa ff ff       	call   801115 <sys_env_find>
+}
+  801714:	c9                   	leave
+  801715:	c3                   	ret
+
+00801716 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801719:	8b 45 08             	mov    0x8(%ebp),%eax
+  80171c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801721:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801724:	5d                   	pop    %ebp
+  801725:	c3                   	ret
+
+00801726 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801726:	55                   	push   %ebp
+  801727:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801729:	8b 45 08             	mov    0x8(%ebp),%eax
+  80172c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801731:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801736:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80173b:	5d                   	pop    %ebp
+  80173c:	c3                   	ret
+
+0080173d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80173d:	55                   	push   %ebp
+  80173e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801740:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801745:	eb 02                	jmp    801749 <fd_alloc+0xc>
+  801747:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801749:	89 c2                	mov    %eax,%edx
+  80174b:	c1 ea 16             	shr    $0x16,%edx
+  80174e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801755:	f6 c2 01             	test   $0x1,%dl
+  801758:	74 2b                	je     801785 <fd_alloc+0x48>
+  80175a:	89 c2                	mov    %eax,%edx
+  80175c:	c1 ea 0c             	shr    $0xc,%edx
+  80175f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801766:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80176c:	f6 c1 01             	test   $0x1,%cl
+  80176f:	74 14                	je     801785 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801771:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801777:	75 ce                	jne    801747 <fd_alloc+0xa>
+  801779:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80177e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801783:	eb 05                	jmp    80178a <fd_alloc+0x4d>
+			return 0;
+  801785:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80178a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178d:	89 02                	mov    %eax,(%edx)
+}
+  80178f:	89 c8                	mov    %ecx,%eax
+  801791:	5d                   	pop    %ebp
+  801792:	c3                   	ret
+
+00801793 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801799:	83 f8 1f             	cmp    $0x1f,%eax
+  80179c:	77 30                	ja     8017ce <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80179e:	c1 e0 0c             	shl    $0xc,%eax
+  8017a1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8017a6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8017ac:	f6 c2 01             	test   $0x1,%dl
+  8017af:	74 24                	je     8017d5 <fd_lookup+0x42>
+  8017b1:	89 c2                	mov    %eax,%edx
+  8017b3:	c1 ea 0c             	shr    $0xc,%edx
+  8017b6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8017bd:	f6 c2 01             	test   $0x1,%dl
+  8017c0:	74 1a                	je     8017dc <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8017c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017c5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8017c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017cc:	5d                   	pop    %ebp
+  8017cd:	c3                   	ret
+		return -E_INVAL;
+  8017ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d3:	eb f7                	jmp    8017cc <fd_lookup+0x39>
+		return -E_INVAL;
+  8017d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017da:	eb f0                	jmp    8017cc <fd_lookup+0x39>
+  8017dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e1:	eb e9                	jmp    8017cc <fd_lookup+0x39>
+
+008017e3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8017e3:	55                   	push   %ebp
+  8017e4:	89 e5                	mov    %esp,%ebp
+  8017e6:	53                   	push   %ebx
+  8017e7:	83 ec 04             	sub    $0x4,%esp
+  8017ea:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8017ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f2:	eb 03                	jmp    8017f7 <dev_lookup+0x14>
+  8017f4:	83 c0 01             	add    $0x1,%eax
+  8017f7:	8b 1c 85 88 34 80 00 	mov    0x803488(,%eax,4),%ebx
+  8017fe:	85 db                	test   %ebx,%ebx
+  801800:	74 0b                	je     80180d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801802:	39 13                	cmp    %edx,(%ebx)
+  801804:	75 ee                	jne    8017f4 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180b:	eb 1f                	jmp    80182c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80180d:	a1 08 50 80 00       	mov    0x805008,%eax
+  801812:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801815:	83 ec 04             	sub    $0x4,%esp
+  801818:	52                   	push   %edx
+  801819:	50                   	push   %eax
+  80181a:	68 0c 34 80 00       	push   $0x80340c
+  80181f:	e8 96 ef ff ff       	call   8007ba <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801824:	83 c4 10             	add    $0x10,%esp
+  801827:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80182c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80182f:	89 1a                	mov    %ebx,(%edx)
+}
+  801831:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801834:	c9                   	leave
+  801835:	c3                   	ret
+
+00801836 <fd_close>:
+{
+  801836:	55                   	push   %ebp
+  801837:	89 e5                	mov    %esp,%ebp
+  801839:	57                   	push   %edi
+  80183a:	56                   	push   %esi
+  80183b:	53                   	push   %ebx
+  80183c:	83 ec 24             	sub    $0x24,%esp
+  80183f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801842:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801845:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801848:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801849:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80184f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801852:	50                   	push   %eax
+  801853:	e8 3b ff ff ff       	call   801793 <fd_lookup>
+  801858:	89 c3                	mov    %eax,%ebx
+  80185a:	83 c4 10             	add    $0x10,%esp
+  80185d:	85 c0                	test   %eax,%eax
+  80185f:	78 05                	js     801866 <fd_close+0x30>
+	    || fd != fd2)
+  801861:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801864:	74 16                	je     80187c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801866:	89 f8                	mov    %edi,%eax
+  801868:	84 c0                	test   %al,%al
+  80186a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80186f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801872:	89 d8                	mov    %ebx,%eax
+  801874:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801877:	5b                   	pop    %ebx
+  801878:	5e                   	pop    %esi
+  801879:	5f                   	pop    %edi
+  80187a:	5d                   	pop    %ebp
+  80187b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80187c:	83 ec 08             	sub    $0x8,%esp
+  80187f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801882:	50                   	push   %eax
+  801883:	ff 36                	push   (%esi)
+  801885:	e8 59 ff ff ff       	call   8017e3 <dev_lookup>
+  80188a:	89 c3                	mov    %eax,%ebx
+  80188c:	83 c4 10             	add    $0x10,%esp
+  80188f:	85 c0                	test   %eax,%eax
+  801891:	78 1a                	js     8018ad <fd_close+0x77>
+		if (dev->dev_close)
+  801893:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801896:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801899:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80189e:	85 c0                	test   %eax,%eax
+  8018a0:	74 0b                	je     8018ad <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8018a2:	83 ec 0c             	sub    $0xc,%esp
+  8018a5:	56                   	push   %esi
+  8018a6:	ff d0                	call   *%eax
+  8018a8:	89 c3                	mov    %eax,%ebx
+  8018aa:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8018ad:	83 ec 08             	sub    $0x8,%esp
+  8018b0:	56                   	push   %esi
+  8018b1:	6a 00                	push   $0x0
+  8018b3:	e8 25 fa ff ff       	call   8012dd <sys_page_unmap>
+	return r;
+  8018b8:	83 c4 10             	add    $0x10,%esp
+  8018bb:	eb b5                	jmp    801872 <fd_close+0x3c>
+
+008018bd <close>:
+
+int
+close(int fdnum)
+{
+  8018bd:	55                   	push   %ebp
+  8018be:	89 e5                	mov    %esp,%ebp
+  8018c0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c6:	50                   	push   %eax
+  8018c7:	ff 75 08             	push   0x8(%ebp)
+  8018ca:	e8 c4 fe ff ff       	call   801793 <fd_lookup>
+  8018cf:	83 c4 10             	add    $0x10,%esp
+  8018d2:	85 c0                	test   %eax,%eax
+  8018d4:	79 02                	jns    8018d8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8018d6:	c9                   	leave
+  8018d7:	c3                   	ret
+		return fd_close(fd, 1);
+  8018d8:	83 ec 08             	sub    $0x8,%esp
+  8018db:	6a 01                	push   $0x1
+  8018dd:	ff 75 f4             	push   -0xc(%ebp)
+  8018e0:	e8 51 ff ff ff       	call   801836 <fd_close>
+  8018e5:	83 c4 10             	add    $0x10,%esp
+  8018e8:	eb ec                	jmp    8018d6 <close+0x19>
+
+008018ea <close_all>:
+
+void
+close_all(void)
+{
+  8018ea:	55                   	push   %ebp
+  8018eb:	89 e5                	mov    %esp,%ebp
+  8018ed:	53                   	push   %ebx
+  8018ee:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8018f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8018f6:	83 ec 0c             	sub    $0xc,%esp
+  8018f9:	53                   	push   %ebx
+  8018fa:	e8 be ff ff ff       	call   8018bd <close>
+	for (i = 0; i < MAXFD; i++)
+  8018ff:	83 c3 01             	add    $0x1,%ebx
+  801902:	83 c4 10             	add    $0x10,%esp
+  801905:	83 fb 20             	cmp    $0x20,%ebx
+  801908:	75 ec                	jne    8018f6 <close_all+0xc>
+}
+  80190a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190d:	c9                   	leave
+  80190e:	c3                   	ret
+
+0080190f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80190f:	55                   	push   %ebp
+  801910:	89 e5                	mov    %esp,%ebp
+  801912:	57                   	push   %edi
+  801913:	56                   	push   %esi
+  801914:	53                   	push   %ebx
+  801915:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801918:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80191b:	50                   	push   %eax
+  80191c:	ff 75 08             	push   0x8(%ebp)
+  80191f:	e8 6f fe ff ff       	call   801793 <fd_lookup>
+  801924:	89 c3                	mov    %eax,%ebx
+  801926:	83 c4 10             	add    $0x10,%esp
+  801929:	85 c0                	test   %eax,%eax
+  80192b:	78 7f                	js     8019ac <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80192d:	83 ec 0c             	sub    $0xc,%esp
+  801930:	ff 75 0c             	push   0xc(%ebp)
+  801933:	e8 85 ff ff ff       	call   8018bd <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801938:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80193b:	c1 e6 0c             	shl    $0xc,%esi
+  80193e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801944:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801947:	89 3c 24             	mov    %edi,(%esp)
+  80194a:	e8 d7 fd ff ff       	call   801726 <fd2data>
+  80194f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801951:	89 34 24             	mov    %esi,(%esp)
+  801954:	e8 cd fd ff ff       	call   801726 <fd2data>
+  801959:	83 c4 10             	add    $0x10,%esp
+  80195c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80195f:	89 d8                	mov    %ebx,%eax
+  801961:	c1 e8 16             	shr    $0x16,%eax
+  801964:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80196b:	a8 01                	test   $0x1,%al
+  80196d:	74 11                	je     801980 <dup+0x71>
+  80196f:	89 d8                	mov    %ebx,%eax
+  801971:	c1 e8 0c             	shr    $0xc,%eax
+  801974:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80197b:	f6 c2 01             	test   $0x1,%dl
+  80197e:	75 36                	jne    8019b6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801980:	89 f8                	mov    %edi,%eax
+  801982:	c1 e8 0c             	shr    $0xc,%eax
+  801985:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80198c:	83 ec 0c             	sub    $0xc,%esp
+  80198f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801994:	50                   	push   %eax
+  801995:	56                   	push   %esi
+  801996:	6a 00                	push   $0x0
+  801998:	57                   	push   %edi
+  801999:	6a 00                	push   $0x0
+  80199b:	e8 fb f8 ff ff       	call   80129b <sys_page_map>
+  8019a0:	89 c3                	mov    %eax,%ebx
+  8019a2:	83 c4 20             	add    $0x20,%esp
+  8019a5:	85 c0                	test   %eax,%eax
+  8019a7:	78 33                	js     8019dc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8019a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8019ac:	89 d8                	mov    %ebx,%eax
+  8019ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019b1:	5b                   	pop    %ebx
+  8019b2:	5e                   	pop    %esi
+  8019b3:	5f                   	pop    %edi
+  8019b4:	5d                   	pop    %ebp
+  8019b5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8019b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019bd:	83 ec 0c             	sub    $0xc,%esp
+  8019c0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019c5:	50                   	push   %eax
+  8019c6:	ff 75 d4             	push   -0x2c(%ebp)
+  8019c9:	6a 00                	push   $0x0
+  8019cb:	53                   	push   %ebx
+  8019cc:	6a 00                	push   $0x0
+  8019ce:	e8 c8 f8 ff ff       	call   80129b <sys_page_map>
+  8019d3:	89 c3                	mov    %eax,%ebx
+  8019d5:	83 c4 20             	add    $0x20,%esp
+  8019d8:	85 c0                	test   %eax,%eax
+  8019da:	79 a4                	jns    801980 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8019dc:	83 ec 08             	sub    $0x8,%esp
+  8019df:	56                   	push   %esi
+  8019e0:	6a 00                	push   $0x0
+  8019e2:	e8 f6 f8 ff ff       	call   8012dd <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8019e7:	83 c4 08             	add    $0x8,%esp
+  8019ea:	ff 75 d4             	push   -0x2c(%ebp)
+  8019ed:	6a 00                	push   $0x0
+  8019ef:	e8 e9 f8 ff ff       	call   8012dd <sys_page_unmap>
+	return r;
+  8019f4:	83 c4 10             	add    $0x10,%esp
+  8019f7:	eb b3                	jmp    8019ac <dup+0x9d>
+
+008019f9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8019f9:	55                   	push   %ebp
+  8019fa:	89 e5                	mov    %esp,%ebp
+  8019fc:	56                   	push   %esi
+  8019fd:	53                   	push   %ebx
+  8019fe:	83 ec 18             	sub    $0x18,%esp
+  801a01:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a04:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a07:	50                   	push   %eax
+  801a08:	56                   	push   %esi
+  801a09:	e8 85 fd ff ff       	call   801793 <fd_lookup>
+  801a0e:	83 c4 10             	add    $0x10,%esp
+  801a11:	85 c0                	test   %eax,%eax
+  801a13:	78 3c                	js     801a51 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a15:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801a18:	83 ec 08             	sub    $0x8,%esp
+  801a1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a1e:	50                   	push   %eax
+  801a1f:	ff 33                	push   (%ebx)
+  801a21:	e8 bd fd ff ff       	call   8017e3 <dev_lookup>
+  801a26:	83 c4 10             	add    $0x10,%esp
+  801a29:	85 c0                	test   %eax,%eax
+  801a2b:	78 24                	js     801a51 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a2d:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a30:	83 e0 03             	and    $0x3,%eax
+  801a33:	83 f8 01             	cmp    $0x1,%eax
+  801a36:	74 20                	je     801a58 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801a38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a3b:	8b 40 08             	mov    0x8(%eax),%eax
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	74 37                	je     801a79 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801a42:	83 ec 04             	sub    $0x4,%esp
+  801a45:	ff 75 10             	push   0x10(%ebp)
+  801a48:	ff 75 0c             	push   0xc(%ebp)
+  801a4b:	53                   	push   %ebx
+  801a4c:	ff d0                	call   *%eax
+  801a4e:	83 c4 10             	add    $0x10,%esp
+}
+  801a51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a54:	5b                   	pop    %ebx
+  801a55:	5e                   	pop    %esi
+  801a56:	5d                   	pop    %ebp
+  801a57:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a58:	a1 08 50 80 00       	mov    0x805008,%eax
+  801a5d:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801a60:	83 ec 04             	sub    $0x4,%esp
+  801a63:	56                   	push   %esi
+  801a64:	50                   	push   %eax
+  801a65:	68 4d 34 80 00       	push   $0x80344d
+  801a6a:	e8 4b ed ff ff       	call   8007ba <cprintf>
+		return -E_INVAL;
+  801a6f:	83 c4 10             	add    $0x10,%esp
+  801a72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a77:	eb d8                	jmp    801a51 <read+0x58>
+		return -E_NOT_SUPP;
+  801a79:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a7e:	eb d1                	jmp    801a51 <read+0x58>
+
+00801a80 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801a80:	55                   	push   %ebp
+  801a81:	89 e5                	mov    %esp,%ebp
+  801a83:	57                   	push   %edi
+  801a84:	56                   	push   %esi
+  801a85:	53                   	push   %ebx
+  801a86:	83 ec 0c             	sub    $0xc,%esp
+  801a89:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801a8c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801a8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a94:	eb 02                	jmp    801a98 <readn+0x18>
+  801a96:	01 c3                	add    %eax,%ebx
+  801a98:	39 f3                	cmp    %esi,%ebx
+  801a9a:	73 21                	jae    801abd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a9c:	83 ec 04             	sub    $0x4,%esp
+  801a9f:	89 f0                	mov    %esi,%eax
+  801aa1:	29 d8                	sub    %ebx,%eax
+  801aa3:	50                   	push   %eax
+  801aa4:	89 d8                	mov    %ebx,%eax
+  801aa6:	03 45 0c             	add    0xc(%ebp),%eax
+  801aa9:	50                   	push   %eax
+  801aaa:	57                   	push   %edi
+  801aab:	e8 49 ff ff ff       	call   8019f9 <read>
+		if (m < 0)
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	78 04                	js     801abb <readn+0x3b>
+			return m;
+		if (m == 0)
+  801ab7:	75 dd                	jne    801a96 <readn+0x16>
+  801ab9:	eb 02                	jmp    801abd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801abb:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801abd:	89 d8                	mov    %ebx,%eax
+  801abf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ac2:	5b                   	pop    %ebx
+  801ac3:	5e                   	pop    %esi
+  801ac4:	5f                   	pop    %edi
+  801ac5:	5d                   	pop    %ebp
+  801ac6:	c3                   	ret
+
+00801ac7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801ac7:	55                   	push   %ebp
+  801ac8:	89 e5                	mov    %esp,%ebp
+  801aca:	56                   	push   %esi
+  801acb:	53                   	push   %ebx
+  801acc:	83 ec 18             	sub    $0x18,%esp
+  801acf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ad2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ad5:	50                   	push   %eax
+  801ad6:	53                   	push   %ebx
+  801ad7:	e8 b7 fc ff ff       	call   801793 <fd_lookup>
+  801adc:	83 c4 10             	add    $0x10,%esp
+  801adf:	85 c0                	test   %eax,%eax
+  801ae1:	78 37                	js     801b1a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ae3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ae6:	83 ec 08             	sub    $0x8,%esp
+  801ae9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aec:	50                   	push   %eax
+  801aed:	ff 36                	push   (%esi)
+  801aef:	e8 ef fc ff ff       	call   8017e3 <dev_lookup>
+  801af4:	83 c4 10             	add    $0x10,%esp
+  801af7:	85 c0                	test   %eax,%eax
+  801af9:	78 1f                	js     801b1a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801afb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801aff:	74 20                	je     801b21 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801b01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b04:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b07:	85 c0                	test   %eax,%eax
+  801b09:	74 37                	je     801b42 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801b0b:	83 ec 04             	sub    $0x4,%esp
+  801b0e:	ff 75 10             	push   0x10(%ebp)
+  801b11:	ff 75 0c             	push   0xc(%ebp)
+  801b14:	56                   	push   %esi
+  801b15:	ff d0                	call   *%eax
+  801b17:	83 c4 10             	add    $0x10,%esp
+}
+  801b1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b1d:	5b                   	pop    %ebx
+  801b1e:	5e                   	pop    %esi
+  801b1f:	5d                   	pop    %ebp
+  801b20:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b21:	a1 08 50 80 00       	mov    0x805008,%eax
+  801b26:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801b29:	83 ec 04             	sub    $0x4,%esp
+  801b2c:	53                   	push   %ebx
+  801b2d:	50                   	push   %eax
+  801b2e:	68 69 34 80 00       	push   $0x803469
+  801b33:	e8 82 ec ff ff       	call   8007ba <cprintf>
+		return -E_INVAL;
+  801b38:	83 c4 10             	add    $0x10,%esp
+  801b3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b40:	eb d8                	jmp    801b1a <write+0x53>
+		return -E_NOT_SUPP;
+  801b42:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b47:	eb d1                	jmp    801b1a <write+0x53>
+
+00801b49 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801b49:	55                   	push   %ebp
+  801b4a:	89 e5                	mov    %esp,%ebp
+  801b4c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b4f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b52:	50                   	push   %eax
+  801b53:	ff 75 08             	push   0x8(%ebp)
+  801b56:	e8 38 fc ff ff       	call   801793 <fd_lookup>
+  801b5b:	83 c4 10             	add    $0x10,%esp
+  801b5e:	85 c0                	test   %eax,%eax
+  801b60:	78 0e                	js     801b70 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801b62:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b68:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b70:	c9                   	leave
+  801b71:	c3                   	ret
+
+00801b72 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801b72:	55                   	push   %ebp
+  801b73:	89 e5                	mov    %esp,%ebp
+  801b75:	56                   	push   %esi
+  801b76:	53                   	push   %ebx
+  801b77:	83 ec 18             	sub    $0x18,%esp
+  801b7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b7d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b80:	50                   	push   %eax
+  801b81:	53                   	push   %ebx
+  801b82:	e8 0c fc ff ff       	call   801793 <fd_lookup>
+  801b87:	83 c4 10             	add    $0x10,%esp
+  801b8a:	85 c0                	test   %eax,%eax
+  801b8c:	78 34                	js     801bc2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b8e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b91:	83 ec 08             	sub    $0x8,%esp
+  801b94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b97:	50                   	push   %eax
+  801b98:	ff 36                	push   (%esi)
+  801b9a:	e8 44 fc ff ff       	call   8017e3 <dev_lookup>
+  801b9f:	83 c4 10             	add    $0x10,%esp
+  801ba2:	85 c0                	test   %eax,%eax
+  801ba4:	78 1c                	js     801bc2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ba6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801baa:	74 1d                	je     801bc9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801bac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801baf:	8b 40 18             	mov    0x18(%eax),%eax
+  801bb2:	85 c0                	test   %eax,%eax
+  801bb4:	74 34                	je     801bea <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801bb6:	83 ec 08             	sub    $0x8,%esp
+  801bb9:	ff 75 0c             	push   0xc(%ebp)
+  801bbc:	56                   	push   %esi
+  801bbd:	ff d0                	call   *%eax
+  801bbf:	83 c4 10             	add    $0x10,%esp
+}
+  801bc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bc5:	5b                   	pop    %ebx
+  801bc6:	5e                   	pop    %esi
+  801bc7:	5d                   	pop    %ebp
+  801bc8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801bc9:	a1 08 50 80 00       	mov    0x805008,%eax
+  801bce:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801bd1:	83 ec 04             	sub    $0x4,%esp
+  801bd4:	53                   	push   %ebx
+  801bd5:	50                   	push   %eax
+  801bd6:	68 2c 34 80 00       	push   $0x80342c
+  801bdb:	e8 da eb ff ff       	call   8007ba <cprintf>
+		return -E_INVAL;
+  801be0:	83 c4 10             	add    $0x10,%esp
+  801be3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801be8:	eb d8                	jmp    801bc2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801bea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bef:	eb d1                	jmp    801bc2 <ftruncate+0x50>
+
+00801bf1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801bf1:	55                   	push   %ebp
+  801bf2:	89 e5                	mov    %esp,%ebp
+  801bf4:	56                   	push   %esi
+  801bf5:	53                   	push   %ebx
+  801bf6:	83 ec 18             	sub    $0x18,%esp
+  801bf9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bfc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bff:	50                   	push   %eax
+  801c00:	ff 75 08             	push   0x8(%ebp)
+  801c03:	e8 8b fb ff ff       	call   801793 <fd_lookup>
+  801c08:	83 c4 10             	add    $0x10,%esp
+  801c0b:	85 c0                	test   %eax,%eax
+  801c0d:	78 49                	js     801c58 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c0f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c12:	83 ec 08             	sub    $0x8,%esp
+  801c15:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c18:	50                   	push   %eax
+  801c19:	ff 36                	push   (%esi)
+  801c1b:	e8 c3 fb ff ff       	call   8017e3 <dev_lookup>
+  801c20:	83 c4 10             	add    $0x10,%esp
+  801c23:	85 c0                	test   %eax,%eax
+  801c25:	78 31                	js     801c58 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801c27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c2a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801c2e:	74 2f                	je     801c5f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801c30:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801c33:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c3a:	00 00 00 
+	stat->st_isdir = 0;
+  801c3d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c44:	00 00 00 
+	stat->st_dev = dev;
+  801c47:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801c4d:	83 ec 08             	sub    $0x8,%esp
+  801c50:	53                   	push   %ebx
+  801c51:	56                   	push   %esi
+  801c52:	ff 50 14             	call   *0x14(%eax)
+  801c55:	83 c4 10             	add    $0x10,%esp
+}
+  801c58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c5b:	5b                   	pop    %ebx
+  801c5c:	5e                   	pop    %esi
+  801c5d:	5d                   	pop    %ebp
+  801c5e:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c5f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c64:	eb f2                	jmp    801c58 <fstat+0x67>
+
+00801c66 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801c66:	55                   	push   %ebp
+  801c67:	89 e5                	mov    %esp,%ebp
+  801c69:	56                   	push   %esi
+  801c6a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801c6b:	83 ec 08             	sub    $0x8,%esp
+  801c6e:	6a 00                	push   $0x0
+  801c70:	ff 75 08             	push   0x8(%ebp)
+  801c73:	e8 e4 01 00 00       	call   801e5c <open>
+  801c78:	89 c3                	mov    %eax,%ebx
+  801c7a:	83 c4 10             	add    $0x10,%esp
+  801c7d:	85 c0                	test   %eax,%eax
+  801c7f:	78 1b                	js     801c9c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801c81:	83 ec 08             	sub    $0x8,%esp
+  801c84:	ff 75 0c             	push   0xc(%ebp)
+  801c87:	50                   	push   %eax
+  801c88:	e8 64 ff ff ff       	call   801bf1 <fstat>
+  801c8d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801c8f:	89 1c 24             	mov    %ebx,(%esp)
+  801c92:	e8 26 fc ff ff       	call   8018bd <close>
+	return r;
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	89 f3                	mov    %esi,%ebx
+}
+  801c9c:	89 d8                	mov    %ebx,%eax
+  801c9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ca1:	5b                   	pop    %ebx
+  801ca2:	5e                   	pop    %esi
+  801ca3:	5d                   	pop    %ebp
+  801ca4:	c3                   	ret
+
+00801ca5 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ca5:	55                   	push   %ebp
+  801ca6:	89 e5                	mov    %esp,%ebp
+  801ca8:	56                   	push   %esi
+  801ca9:	53                   	push   %ebx
+  801caa:	89 c6                	mov    %eax,%esi
+  801cac:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801cae:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801cb5:	74 27                	je     801cde <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801cb7:	6a 07                	push   $0x7
+  801cb9:	68 00 60 80 00       	push   $0x806000
+  801cbe:	56                   	push   %esi
+  801cbf:	ff 35 00 50 80 00    	push   0x805000
+  801cc5:	e8 e8 f9 ff ff       	call   8016b2 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801cca:	83 c4 0c             	add    $0xc,%esp
+  801ccd:	6a 00                	push   $0x0
+  801ccf:	53                   	push   %ebx
+  801cd0:	6a 00                	push   $0x0
+  801cd2:	e8 63 f9 ff ff       	call   80163a <ipc_recv>
+}
+  801cd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cda:	5b                   	pop    %ebx
+  801cdb:	5e                   	pop    %esi
+  801cdc:	5d                   	pop    %ebp
+  801cdd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801cde:	83 ec 0c             	sub    $0xc,%esp
+  801ce1:	6a 01                	push   $0x1
+  801ce3:	e8 1e fa ff ff       	call   801706 <ipc_find_env>
+  801ce8:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	eb c5                	jmp    801cb7 <fsipc+0x12>
+
+00801cf2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801cf2:	55                   	push   %ebp
+  801cf3:	89 e5                	mov    %esp,%ebp
+  801cf5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801cf8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cfb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cfe:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801d03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d06:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801d0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d10:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d15:	e8 8b ff ff ff       	call   801ca5 <fsipc>
+}
+  801d1a:	c9                   	leave
+  801d1b:	c3                   	ret
+
+00801d1c <devfile_flush>:
+{
+  801d1c:	55                   	push   %ebp
+  801d1d:	89 e5                	mov    %esp,%ebp
+  801d1f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d25:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d28:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801d2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d32:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d37:	e8 69 ff ff ff       	call   801ca5 <fsipc>
+}
+  801d3c:	c9                   	leave
+  801d3d:	c3                   	ret
+
+00801d3e <devfile_stat>:
+{
+  801d3e:	55                   	push   %ebp
+  801d3f:	89 e5                	mov    %esp,%ebp
+  801d41:	53                   	push   %ebx
+  801d42:	83 ec 04             	sub    $0x4,%esp
+  801d45:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d48:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d4b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d4e:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d53:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d58:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d5d:	e8 43 ff ff ff       	call   801ca5 <fsipc>
+  801d62:	85 c0                	test   %eax,%eax
+  801d64:	78 2c                	js     801d92 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d66:	83 ec 08             	sub    $0x8,%esp
+  801d69:	68 00 60 80 00       	push   $0x806000
+  801d6e:	53                   	push   %ebx
+  801d6f:	e8 34 f0 ff ff       	call   800da8 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801d74:	a1 80 60 80 00       	mov    0x806080,%eax
+  801d79:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d7f:	a1 84 60 80 00       	mov    0x806084,%eax
+  801d84:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801d8a:	83 c4 10             	add    $0x10,%esp
+  801d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d95:	c9                   	leave
+  801d96:	c3                   	ret
+
+00801d97 <devfile_write>:
+{
+  801d97:	55                   	push   %ebp
+  801d98:	89 e5                	mov    %esp,%ebp
+  801d9a:	83 ec 0c             	sub    $0xc,%esp
+  801d9d:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801da0:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801da5:	39 d0                	cmp    %edx,%eax
+  801da7:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dad:	8b 52 0c             	mov    0xc(%edx),%edx
+  801db0:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801db6:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801dbb:	50                   	push   %eax
+  801dbc:	ff 75 0c             	push   0xc(%ebp)
+  801dbf:	68 08 60 80 00       	push   $0x806008
+  801dc4:	e8 65 f1 ff ff       	call   800f2e <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dce:	b8 04 00 00 00       	mov    $0x4,%eax
+  801dd3:	e8 cd fe ff ff       	call   801ca5 <fsipc>
+}
+  801dd8:	c9                   	leave
+  801dd9:	c3                   	ret
+
+00801dda <devfile_read>:
+{
+  801dda:	55                   	push   %ebp
+  801ddb:	89 e5                	mov    %esp,%ebp
+  801ddd:	56                   	push   %esi
+  801dde:	53                   	push   %ebx
+  801ddf:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801de2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801de8:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801ded:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801df3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df8:	b8 03 00 00 00       	mov    $0x3,%eax
+  801dfd:	e8 a3 fe ff ff       	call   801ca5 <fsipc>
+  801e02:	89 c3                	mov    %eax,%ebx
+  801e04:	85 c0                	test   %eax,%eax
+  801e06:	78 1f                	js     801e27 <devfile_read+0x4d>
+	assert(r <= n);
+  801e08:	39 c6                	cmp    %eax,%esi
+  801e0a:	72 24                	jb     801e30 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801e0c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e11:	7f 33                	jg     801e46 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e13:	83 ec 04             	sub    $0x4,%esp
+  801e16:	50                   	push   %eax
+  801e17:	68 00 60 80 00       	push   $0x806000
+  801e1c:	ff 75 0c             	push   0xc(%ebp)
+  801e1f:	e8 0a f1 ff ff       	call   800f2e <memmove>
+	return r;
+  801e24:	83 c4 10             	add    $0x10,%esp
+}
+  801e27:	89 d8                	mov    %ebx,%eax
+  801e29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e2c:	5b                   	pop    %ebx
+  801e2d:	5e                   	pop    %esi
+  801e2e:	5d                   	pop    %ebp
+  801e2f:	c3                   	ret
+	assert(r <= n);
+  801e30:	68 9c 34 80 00       	push   $0x80349c
+  801e35:	68 a3 34 80 00       	push   $0x8034a3
+  801e3a:	6a 7c                	push   $0x7c
+  801e3c:	68 b8 34 80 00       	push   $0x8034b8
+  801e41:	e8 99 e8 ff ff       	call   8006df <_panic>
+	assert(r <= PGSIZE);
+  801e46:	68 c3 34 80 00       	push   $0x8034c3
+  801e4b:	68 a3 34 80 00       	push   $0x8034a3
+  801e50:	6a 7d                	push   $0x7d
+  801e52:	68 b8 34 80 00       	push   $0x8034b8
+  801e57:	e8 83 e8 ff ff       	call   8006df <_panic>
+
+00801e5c <open>:
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	56                   	push   %esi
+  801e60:	53                   	push   %ebx
+  801e61:	83 ec 1c             	sub    $0x1c,%esp
+  801e64:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801e67:	56                   	push   %esi
+  801e68:	e8 00 ef ff ff       	call   800d6d <strlen>
+  801e6d:	83 c4 10             	add    $0x10,%esp
+  801e70:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e75:	7f 6c                	jg     801ee3 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801e77:	83 ec 0c             	sub    $0xc,%esp
+  801e7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e7d:	50                   	push   %eax
+  801e7e:	e8 ba f8 ff ff       	call   80173d <fd_alloc>
+  801e83:	89 c3                	mov    %eax,%ebx
+  801e85:	83 c4 10             	add    $0x10,%esp
+  801e88:	85 c0                	test   %eax,%eax
+  801e8a:	78 3c                	js     801ec8 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801e8c:	83 ec 08             	sub    $0x8,%esp
+  801e8f:	56                   	push   %esi
+  801e90:	68 00 60 80 00       	push   $0x806000
+  801e95:	e8 0e ef ff ff       	call   800da8 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e9d:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ea2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ea5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eaa:	e8 f6 fd ff ff       	call   801ca5 <fsipc>
+  801eaf:	89 c3                	mov    %eax,%ebx
+  801eb1:	83 c4 10             	add    $0x10,%esp
+  801eb4:	85 c0                	test   %eax,%eax
+  801eb6:	78 19                	js     801ed1 <open+0x75>
+	return fd2num(fd);
+  801eb8:	83 ec 0c             	sub    $0xc,%esp
+  801ebb:	ff 75 f4             	push   -0xc(%ebp)
+  801ebe:	e8 53 f8 ff ff       	call   801716 <fd2num>
+  801ec3:	89 c3                	mov    %eax,%ebx
+  801ec5:	83 c4 10             	add    $0x10,%esp
+}
+  801ec8:	89 d8                	mov    %ebx,%eax
+  801eca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ecd:	5b                   	pop    %ebx
+  801ece:	5e                   	pop    %esi
+  801ecf:	5d                   	pop    %ebp
+  801ed0:	c3                   	ret
+		fd_close(fd, 0);
+  801ed1:	83 ec 08             	sub    $0x8,%esp
+  801ed4:	6a 00                	push   $0x0
+  801ed6:	ff 75 f4             	push   -0xc(%ebp)
+  801ed9:	e8 58 f9 ff ff       	call   801836 <fd_close>
+		return r;
+  801ede:	83 c4 10             	add    $0x10,%esp
+  801ee1:	eb e5                	jmp    801ec8 <open+0x6c>
+		return -E_BAD_PATH;
+  801ee3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ee8:	eb de                	jmp    801ec8 <open+0x6c>
+
+00801eea <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801eea:	55                   	push   %ebp
+  801eeb:	89 e5                	mov    %esp,%ebp
+  801eed:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801ef0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef5:	b8 08 00 00 00       	mov    $0x8,%eax
+  801efa:	e8 a6 fd ff ff       	call   801ca5 <fsipc>
+}
+  801eff:	c9                   	leave
+  801f00:	c3                   	ret
+
+00801f01 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f01:	55                   	push   %ebp
+  801f02:	89 e5                	mov    %esp,%ebp
+  801f04:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801f07:	68 cf 34 80 00       	push   $0x8034cf
+  801f0c:	ff 75 0c             	push   0xc(%ebp)
+  801f0f:	e8 94 ee ff ff       	call   800da8 <strcpy>
+	return 0;
+}
+  801f14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f19:	c9                   	leave
+  801f1a:	c3                   	ret
+
+00801f1b <devsock_close>:
+{
+  801f1b:	55                   	push   %ebp
+  801f1c:	89 e5                	mov    %esp,%ebp
+  801f1e:	53                   	push   %ebx
+  801f1f:	83 ec 10             	sub    $0x10,%esp
+  801f22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801f25:	53                   	push   %ebx
+  801f26:	e8 fc 08 00 00       	call   802827 <pageref>
+  801f2b:	89 c2                	mov    %eax,%edx
+  801f2d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801f30:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801f35:	83 fa 01             	cmp    $0x1,%edx
+  801f38:	74 05                	je     801f3f <devsock_close+0x24>
+}
+  801f3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f3d:	c9                   	leave
+  801f3e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801f3f:	83 ec 0c             	sub    $0xc,%esp
+  801f42:	ff 73 0c             	push   0xc(%ebx)
+  801f45:	e8 b7 02 00 00       	call   802201 <nsipc_close>
+  801f4a:	83 c4 10             	add    $0x10,%esp
+  801f4d:	eb eb                	jmp    801f3a <devsock_close+0x1f>
+
+00801f4f <devsock_write>:
+{
+  801f4f:	55                   	push   %ebp
+  801f50:	89 e5                	mov    %esp,%ebp
+  801f52:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801f55:	6a 00                	push   $0x0
+  801f57:	ff 75 10             	push   0x10(%ebp)
+  801f5a:	ff 75 0c             	push   0xc(%ebp)
+  801f5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f60:	ff 70 0c             	push   0xc(%eax)
+  801f63:	e8 79 03 00 00       	call   8022e1 <nsipc_send>
+}
+  801f68:	c9                   	leave
+  801f69:	c3                   	ret
+
+00801f6a <devsock_read>:
+{
+  801f6a:	55                   	push   %ebp
+  801f6b:	89 e5                	mov    %esp,%ebp
+  801f6d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801f70:	6a 00                	push   $0x0
+  801f72:	ff 75 10             	push   0x10(%ebp)
+  801f75:	ff 75 0c             	push   0xc(%ebp)
+  801f78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f7b:	ff 70 0c             	push   0xc(%eax)
+  801f7e:	e8 ef 02 00 00       	call   802272 <nsipc_recv>
+}
+  801f83:	c9                   	leave
+  801f84:	c3                   	ret
+
+00801f85 <fd2sockid>:
+{
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801f8b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801f8e:	52                   	push   %edx
+  801f8f:	50                   	push   %eax
+  801f90:	e8 fe f7 ff ff       	call   801793 <fd_lookup>
+  801f95:	83 c4 10             	add    $0x10,%esp
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	78 10                	js     801fac <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801f9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f9f:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  801fa5:	39 08                	cmp    %ecx,(%eax)
+  801fa7:	75 05                	jne    801fae <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801fa9:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801fac:	c9                   	leave
+  801fad:	c3                   	ret
+		return -E_NOT_SUPP;
+  801fae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fb3:	eb f7                	jmp    801fac <fd2sockid+0x27>
+
+00801fb5 <alloc_sockfd>:
+{
+  801fb5:	55                   	push   %ebp
+  801fb6:	89 e5                	mov    %esp,%ebp
+  801fb8:	56                   	push   %esi
+  801fb9:	53                   	push   %ebx
+  801fba:	83 ec 1c             	sub    $0x1c,%esp
+  801fbd:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801fbf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fc2:	50                   	push   %eax
+  801fc3:	e8 75 f7 ff ff       	call   80173d <fd_alloc>
+  801fc8:	89 c3                	mov    %eax,%ebx
+  801fca:	83 c4 10             	add    $0x10,%esp
+  801fcd:	85 c0                	test   %eax,%eax
+  801fcf:	78 43                	js     802014 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801fd1:	83 ec 04             	sub    $0x4,%esp
+  801fd4:	68 07 04 00 00       	push   $0x407
+  801fd9:	ff 75 f4             	push   -0xc(%ebp)
+  801fdc:	6a 00                	push   $0x0
+  801fde:	e8 32 f2 ff ff       	call   801215 <sys_page_alloc>
+  801fe3:	89 c3                	mov    %eax,%ebx
+  801fe5:	83 c4 10             	add    $0x10,%esp
+  801fe8:	85 c0                	test   %eax,%eax
+  801fea:	78 28                	js     802014 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801fec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fef:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  801ff5:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801ff7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ffa:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802001:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802004:	83 ec 0c             	sub    $0xc,%esp
+  802007:	50                   	push   %eax
+  802008:	e8 09 f7 ff ff       	call   801716 <fd2num>
+  80200d:	89 c3                	mov    %eax,%ebx
+  80200f:	83 c4 10             	add    $0x10,%esp
+  802012:	eb 0c                	jmp    802020 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802014:	83 ec 0c             	sub    $0xc,%esp
+  802017:	56                   	push   %esi
+  802018:	e8 e4 01 00 00       	call   802201 <nsipc_close>
+		return r;
+  80201d:	83 c4 10             	add    $0x10,%esp
+}
+  802020:	89 d8                	mov    %ebx,%eax
+  802022:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802025:	5b                   	pop    %ebx
+  802026:	5e                   	pop    %esi
+  802027:	5d                   	pop    %ebp
+  802028:	c3                   	ret
+
+00802029 <accept>:
+{
+  802029:	55                   	push   %ebp
+  80202a:	89 e5                	mov    %esp,%ebp
+  80202c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80202f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802032:	e8 4e ff ff ff       	call   801f85 <fd2sockid>
+  802037:	85 c0                	test   %eax,%eax
+  802039:	78 1b                	js     802056 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80203b:	83 ec 04             	sub    $0x4,%esp
+  80203e:	ff 75 10             	push   0x10(%ebp)
+  802041:	ff 75 0c             	push   0xc(%ebp)
+  802044:	50                   	push   %eax
+  802045:	e8 0e 01 00 00       	call   802158 <nsipc_accept>
+  80204a:	83 c4 10             	add    $0x10,%esp
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	78 05                	js     802056 <accept+0x2d>
+	return alloc_sockfd(r);
+  802051:	e8 5f ff ff ff       	call   801fb5 <alloc_sockfd>
+}
+  802056:	c9                   	leave
+  802057:	c3                   	ret
+
+00802058 <bind>:
+{
+  802058:	55                   	push   %ebp
+  802059:	89 e5                	mov    %esp,%ebp
+  80205b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80205e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802061:	e8 1f ff ff ff       	call   801f85 <fd2sockid>
+  802066:	85 c0                	test   %eax,%eax
+  802068:	78 12                	js     80207c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80206a:	83 ec 04             	sub    $0x4,%esp
+  80206d:	ff 75 10             	push   0x10(%ebp)
+  802070:	ff 75 0c             	push   0xc(%ebp)
+  802073:	50                   	push   %eax
+  802074:	e8 31 01 00 00       	call   8021aa <nsipc_bind>
+  802079:	83 c4 10             	add    $0x10,%esp
+}
+  80207c:	c9                   	leave
+  80207d:	c3                   	ret
+
+0080207e <shutdown>:
+{
+  80207e:	55                   	push   %ebp
+  80207f:	89 e5                	mov    %esp,%ebp
+  802081:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802084:	8b 45 08             	mov    0x8(%ebp),%eax
+  802087:	e8 f9 fe ff ff       	call   801f85 <fd2sockid>
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	78 0f                	js     80209f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802090:	83 ec 08             	sub    $0x8,%esp
+  802093:	ff 75 0c             	push   0xc(%ebp)
+  802096:	50                   	push   %eax
+  802097:	e8 43 01 00 00       	call   8021df <nsipc_shutdown>
+  80209c:	83 c4 10             	add    $0x10,%esp
+}
+  80209f:	c9                   	leave
+  8020a0:	c3                   	ret
+
+008020a1 <connect>:
+{
+  8020a1:	55                   	push   %ebp
+  8020a2:	89 e5                	mov    %esp,%ebp
+  8020a4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8020a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020aa:	e8 d6 fe ff ff       	call   801f85 <fd2sockid>
+  8020af:	85 c0                	test   %eax,%eax
+  8020b1:	78 12                	js     8020c5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8020b3:	83 ec 04             	sub    $0x4,%esp
+  8020b6:	ff 75 10             	push   0x10(%ebp)
+  8020b9:	ff 75 0c             	push   0xc(%ebp)
+  8020bc:	50                   	push   %eax
+  8020bd:	e8 59 01 00 00       	call   80221b <nsipc_connect>
+  8020c2:	83 c4 10             	add    $0x10,%esp
+}
+  8020c5:	c9                   	leave
+  8020c6:	c3                   	ret
+
+008020c7 <listen>:
+{
+  8020c7:	55                   	push   %ebp
+  8020c8:	89 e5                	mov    %esp,%ebp
+  8020ca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8020cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d0:	e8 b0 fe ff ff       	call   801f85 <fd2sockid>
+  8020d5:	85 c0                	test   %eax,%eax
+  8020d7:	78 0f                	js     8020e8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8020d9:	83 ec 08             	sub    $0x8,%esp
+  8020dc:	ff 75 0c             	push   0xc(%ebp)
+  8020df:	50                   	push   %eax
+  8020e0:	e8 6b 01 00 00       	call   802250 <nsipc_listen>
+  8020e5:	83 c4 10             	add    $0x10,%esp
+}
+  8020e8:	c9                   	leave
+  8020e9:	c3                   	ret
+
+008020ea <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8020ea:	55                   	push   %ebp
+  8020eb:	89 e5                	mov    %esp,%ebp
+  8020ed:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8020f0:	ff 75 10             	push   0x10(%ebp)
+  8020f3:	ff 75 0c             	push   0xc(%ebp)
+  8020f6:	ff 75 08             	push   0x8(%ebp)
+  8020f9:	e8 41 02 00 00       	call   80233f <nsipc_socket>
+  8020fe:	83 c4 10             	add    $0x10,%esp
+  802101:	85 c0                	test   %eax,%eax
+  802103:	78 05                	js     80210a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802105:	e8 ab fe ff ff       	call   801fb5 <alloc_sockfd>
+}
+  80210a:	c9                   	leave
+  80210b:	c3                   	ret
+
+0080210c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80210c:	55                   	push   %ebp
+  80210d:	89 e5                	mov    %esp,%ebp
+  80210f:	53                   	push   %ebx
+  802110:	83 ec 04             	sub    $0x4,%esp
+  802113:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802115:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  80211c:	74 26                	je     802144 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80211e:	6a 07                	push   $0x7
+  802120:	68 00 70 80 00       	push   $0x807000
+  802125:	53                   	push   %ebx
+  802126:	ff 35 04 50 80 00    	push   0x805004
+  80212c:	e8 81 f5 ff ff       	call   8016b2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802131:	83 c4 0c             	add    $0xc,%esp
+  802134:	6a 00                	push   $0x0
+  802136:	6a 00                	push   $0x0
+  802138:	6a 00                	push   $0x0
+  80213a:	e8 fb f4 ff ff       	call   80163a <ipc_recv>
+}
+  80213f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802142:	c9                   	leave
+  802143:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802144:	83 ec 0c             	sub    $0xc,%esp
+  802147:	6a 02                	push   $0x2
+  802149:	e8 b8 f5 ff ff       	call   801706 <ipc_find_env>
+  80214e:	a3 04 50 80 00       	mov    %eax,0x805004
+  802153:	83 c4 10             	add    $0x10,%esp
+  802156:	eb c6                	jmp    80211e <nsipc+0x12>
+
+00802158 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802158:	55                   	push   %ebp
+  802159:	89 e5                	mov    %esp,%ebp
+  80215b:	56                   	push   %esi
+  80215c:	53                   	push   %ebx
+  80215d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802160:	8b 45 08             	mov    0x8(%ebp),%eax
+  802163:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802168:	8b 06                	mov    (%esi),%eax
+  80216a:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80216f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802174:	e8 93 ff ff ff       	call   80210c <nsipc>
+  802179:	89 c3                	mov    %eax,%ebx
+  80217b:	85 c0                	test   %eax,%eax
+  80217d:	79 09                	jns    802188 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80217f:	89 d8                	mov    %ebx,%eax
+  802181:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802184:	5b                   	pop    %ebx
+  802185:	5e                   	pop    %esi
+  802186:	5d                   	pop    %ebp
+  802187:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802188:	83 ec 04             	sub    $0x4,%esp
+  80218b:	ff 35 10 70 80 00    	push   0x807010
+  802191:	68 00 70 80 00       	push   $0x807000
+  802196:	ff 75 0c             	push   0xc(%ebp)
+  802199:	e8 90 ed ff ff       	call   800f2e <memmove>
+		*addrlen = ret->ret_addrlen;
+  80219e:	a1 10 70 80 00       	mov    0x807010,%eax
+  8021a3:	89 06                	mov    %eax,(%esi)
+  8021a5:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8021a8:	eb d5                	jmp    80217f <nsipc_accept+0x27>
+
+008021aa <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8021aa:	55                   	push   %ebp
+  8021ab:	89 e5                	mov    %esp,%ebp
+  8021ad:	53                   	push   %ebx
+  8021ae:	83 ec 08             	sub    $0x8,%esp
+  8021b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8021b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b7:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8021bc:	53                   	push   %ebx
+  8021bd:	ff 75 0c             	push   0xc(%ebp)
+  8021c0:	68 04 70 80 00       	push   $0x807004
+  8021c5:	e8 64 ed ff ff       	call   800f2e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8021ca:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8021d0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021d5:	e8 32 ff ff ff       	call   80210c <nsipc>
+}
+  8021da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021dd:	c9                   	leave
+  8021de:	c3                   	ret
+
+008021df <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8021df:	55                   	push   %ebp
+  8021e0:	89 e5                	mov    %esp,%ebp
+  8021e2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8021e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8021ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f0:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8021f5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021fa:	e8 0d ff ff ff       	call   80210c <nsipc>
+}
+  8021ff:	c9                   	leave
+  802200:	c3                   	ret
+
+00802201 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802201:	55                   	push   %ebp
+  802202:	89 e5                	mov    %esp,%ebp
+  802204:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802207:	8b 45 08             	mov    0x8(%ebp),%eax
+  80220a:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80220f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802214:	e8 f3 fe ff ff       	call   80210c <nsipc>
+}
+  802219:	c9                   	leave
+  80221a:	c3                   	ret
+
+0080221b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80221b:	55                   	push   %ebp
+  80221c:	89 e5                	mov    %esp,%ebp
+  80221e:	53                   	push   %ebx
+  80221f:	83 ec 08             	sub    $0x8,%esp
+  802222:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802225:	8b 45 08             	mov    0x8(%ebp),%eax
+  802228:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80222d:	53                   	push   %ebx
+  80222e:	ff 75 0c             	push   0xc(%ebp)
+  802231:	68 04 70 80 00       	push   $0x807004
+  802236:	e8 f3 ec ff ff       	call   800f2e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80223b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802241:	b8 05 00 00 00       	mov    $0x5,%eax
+  802246:	e8 c1 fe ff ff       	call   80210c <nsipc>
+}
+  80224b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80224e:	c9                   	leave
+  80224f:	c3                   	ret
+
+00802250 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802250:	55                   	push   %ebp
+  802251:	89 e5                	mov    %esp,%ebp
+  802253:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802256:	8b 45 08             	mov    0x8(%ebp),%eax
+  802259:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80225e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802261:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802266:	b8 06 00 00 00       	mov    $0x6,%eax
+  80226b:	e8 9c fe ff ff       	call   80210c <nsipc>
+}
+  802270:	c9                   	leave
+  802271:	c3                   	ret
+
+00802272 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802272:	55                   	push   %ebp
+  802273:	89 e5                	mov    %esp,%ebp
+  802275:	56                   	push   %esi
+  802276:	53                   	push   %ebx
+  802277:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80227a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802282:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802288:	8b 45 14             	mov    0x14(%ebp),%eax
+  80228b:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802290:	b8 07 00 00 00       	mov    $0x7,%eax
+  802295:	e8 72 fe ff ff       	call   80210c <nsipc>
+  80229a:	89 c3                	mov    %eax,%ebx
+  80229c:	85 c0                	test   %eax,%eax
+  80229e:	78 22                	js     8022c2 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8022a0:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8022a5:	39 c6                	cmp    %eax,%esi
+  8022a7:	0f 4e c6             	cmovle %esi,%eax
+  8022aa:	39 c3                	cmp    %eax,%ebx
+  8022ac:	7f 1d                	jg     8022cb <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8022ae:	83 ec 04             	sub    $0x4,%esp
+  8022b1:	53                   	push   %ebx
+  8022b2:	68 00 70 80 00       	push   $0x807000
+  8022b7:	ff 75 0c             	push   0xc(%ebp)
+  8022ba:	e8 6f ec ff ff       	call   800f2e <memmove>
+  8022bf:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8022c2:	89 d8                	mov    %ebx,%eax
+  8022c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c7:	5b                   	pop    %ebx
+  8022c8:	5e                   	pop    %esi
+  8022c9:	5d                   	pop    %ebp
+  8022ca:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8022cb:	68 db 34 80 00       	push   $0x8034db
+  8022d0:	68 a3 34 80 00       	push   $0x8034a3
+  8022d5:	6a 62                	push   $0x62
+  8022d7:	68 f0 34 80 00       	push   $0x8034f0
+  8022dc:	e8 fe e3 ff ff       	call   8006df <_panic>
+
+008022e1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8022e1:	55                   	push   %ebp
+  8022e2:	89 e5                	mov    %esp,%ebp
+  8022e4:	53                   	push   %ebx
+  8022e5:	83 ec 04             	sub    $0x4,%esp
+  8022e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8022eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ee:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8022f3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8022f9:	7f 2e                	jg     802329 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8022fb:	83 ec 04             	sub    $0x4,%esp
+  8022fe:	53                   	push   %ebx
+  8022ff:	ff 75 0c             	push   0xc(%ebp)
+  802302:	68 0c 70 80 00       	push   $0x80700c
+  802307:	e8 22 ec ff ff       	call   800f2e <memmove>
+	nsipcbuf.send.req_size = size;
+  80230c:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802312:	8b 45 14             	mov    0x14(%ebp),%eax
+  802315:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80231a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80231f:	e8 e8 fd ff ff       	call   80210c <nsipc>
+}
+  802324:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802327:	c9                   	leave
+  802328:	c3                   	ret
+	assert(size < 1600);
+  802329:	68 fc 34 80 00       	push   $0x8034fc
+  80232e:	68 a3 34 80 00       	push   $0x8034a3
+  802333:	6a 6d                	push   $0x6d
+  802335:	68 f0 34 80 00       	push   $0x8034f0
+  80233a:	e8 a0 e3 ff ff       	call   8006df <_panic>
+
+0080233f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80233f:	55                   	push   %ebp
+  802340:	89 e5                	mov    %esp,%ebp
+  802342:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802345:	8b 45 08             	mov    0x8(%ebp),%eax
+  802348:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80234d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802350:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802355:	8b 45 10             	mov    0x10(%ebp),%eax
+  802358:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80235d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802362:	e8 a5 fd ff ff       	call   80210c <nsipc>
+}
+  802367:	c9                   	leave
+  802368:	c3                   	ret
+
+00802369 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802369:	55                   	push   %ebp
+  80236a:	89 e5                	mov    %esp,%ebp
+  80236c:	56                   	push   %esi
+  80236d:	53                   	push   %ebx
+  80236e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802371:	83 ec 0c             	sub    $0xc,%esp
+  802374:	ff 75 08             	push   0x8(%ebp)
+  802377:	e8 aa f3 ff ff       	call   801726 <fd2data>
+  80237c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80237e:	83 c4 08             	add    $0x8,%esp
+  802381:	68 08 35 80 00       	push   $0x803508
+  802386:	53                   	push   %ebx
+  802387:	e8 1c ea ff ff       	call   800da8 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80238c:	8b 46 04             	mov    0x4(%esi),%eax
+  80238f:	2b 06                	sub    (%esi),%eax
+  802391:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802397:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80239e:	00 00 00 
+	stat->st_dev = &devpipe;
+  8023a1:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  8023a8:	40 80 00 
+	return 0;
+}
+  8023ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023b3:	5b                   	pop    %ebx
+  8023b4:	5e                   	pop    %esi
+  8023b5:	5d                   	pop    %ebp
+  8023b6:	c3                   	ret
+
+008023b7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8023b7:	55                   	push   %ebp
+  8023b8:	89 e5                	mov    %esp,%ebp
+  8023ba:	53                   	push   %ebx
+  8023bb:	83 ec 0c             	sub    $0xc,%esp
+  8023be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8023c1:	53                   	push   %ebx
+  8023c2:	6a 00                	push   $0x0
+  8023c4:	e8 14 ef ff ff       	call   8012dd <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8023c9:	89 1c 24             	mov    %ebx,(%esp)
+  8023cc:	e8 55 f3 ff ff       	call   801726 <fd2data>
+  8023d1:	83 c4 08             	add    $0x8,%esp
+  8023d4:	50                   	push   %eax
+  8023d5:	6a 00                	push   $0x0
+  8023d7:	e8 01 ef ff ff       	call   8012dd <sys_page_unmap>
+}
+  8023dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023df:	c9                   	leave
+  8023e0:	c3                   	ret
+
+008023e1 <_pipeisclosed>:
+{
+  8023e1:	55                   	push   %ebp
+  8023e2:	89 e5                	mov    %esp,%ebp
+  8023e4:	57                   	push   %edi
+  8023e5:	56                   	push   %esi
+  8023e6:	53                   	push   %ebx
+  8023e7:	83 ec 1c             	sub    $0x1c,%esp
+  8023ea:	89 c7                	mov    %eax,%edi
+  8023ec:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8023ee:	a1 08 50 80 00       	mov    0x805008,%eax
+  8023f3:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8023f6:	83 ec 0c             	sub    $0xc,%esp
+  8023f9:	57                   	push   %edi
+  8023fa:	e8 28 04 00 00       	call   802827 <pageref>
+  8023ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802402:	89 34 24             	mov    %esi,(%esp)
+  802405:	e8 1d 04 00 00       	call   802827 <pageref>
+		nn = thisenv->env_runs;
+  80240a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802410:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802413:	83 c4 10             	add    $0x10,%esp
+  802416:	39 cb                	cmp    %ecx,%ebx
+  802418:	74 1b                	je     802435 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80241a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80241d:	75 cf                	jne    8023ee <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80241f:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802422:	6a 01                	push   $0x1
+  802424:	50                   	push   %eax
+  802425:	53                   	push   %ebx
+  802426:	68 0f 35 80 00       	push   $0x80350f
+  80242b:	e8 8a e3 ff ff       	call   8007ba <cprintf>
+  802430:	83 c4 10             	add    $0x10,%esp
+  802433:	eb b9                	jmp    8023ee <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802435:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802438:	0f 94 c0             	sete   %al
+  80243b:	0f b6 c0             	movzbl %al,%eax
+}
+  80243e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802441:	5b                   	pop    %ebx
+  802442:	5e                   	pop    %esi
+  802443:	5f                   	pop    %edi
+  802444:	5d                   	pop    %ebp
+  802445:	c3                   	ret
+
+00802446 <devpipe_write>:
+{
+  802446:	55                   	push   %ebp
+  802447:	89 e5                	mov    %esp,%ebp
+  802449:	57                   	push   %edi
+  80244a:	56                   	push   %esi
+  80244b:	53                   	push   %ebx
+  80244c:	83 ec 28             	sub    $0x28,%esp
+  80244f:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802452:	56                   	push   %esi
+  802453:	e8 ce f2 ff ff       	call   801726 <fd2data>
+  802458:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802462:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802465:	75 09                	jne    802470 <devpipe_write+0x2a>
+	return i;
+  802467:	89 f8                	mov    %edi,%eax
+  802469:	eb 23                	jmp    80248e <devpipe_write+0x48>
+			sys_yield();
+  80246b:	e8 25 ed ff ff       	call   801195 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802470:	8b 43 04             	mov    0x4(%ebx),%eax
+  802473:	8b 0b                	mov    (%ebx),%ecx
+  802475:	8d 51 20             	lea    0x20(%ecx),%edx
+  802478:	39 d0                	cmp    %edx,%eax
+  80247a:	72 1a                	jb     802496 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80247c:	89 da                	mov    %ebx,%edx
+  80247e:	89 f0                	mov    %esi,%eax
+  802480:	e8 5c ff ff ff       	call   8023e1 <_pipeisclosed>
+  802485:	85 c0                	test   %eax,%eax
+  802487:	74 e2                	je     80246b <devpipe_write+0x25>
+				return 0;
+  802489:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80248e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802491:	5b                   	pop    %ebx
+  802492:	5e                   	pop    %esi
+  802493:	5f                   	pop    %edi
+  802494:	5d                   	pop    %ebp
+  802495:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802496:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802499:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80249d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8024a0:	89 c2                	mov    %eax,%edx
+  8024a2:	c1 fa 1f             	sar    $0x1f,%edx
+  8024a5:	89 d1                	mov    %edx,%ecx
+  8024a7:	c1 e9 1b             	shr    $0x1b,%ecx
+  8024aa:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8024ad:	83 e2 1f             	and    $0x1f,%edx
+  8024b0:	29 ca                	sub    %ecx,%edx
+  8024b2:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8024b6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8024ba:	83 c0 01             	add    $0x1,%eax
+  8024bd:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8024c0:	83 c7 01             	add    $0x1,%edi
+  8024c3:	eb 9d                	jmp    802462 <devpipe_write+0x1c>
+
+008024c5 <devpipe_read>:
+{
+  8024c5:	55                   	push   %ebp
+  8024c6:	89 e5                	mov    %esp,%ebp
+  8024c8:	57                   	push   %edi
+  8024c9:	56                   	push   %esi
+  8024ca:	53                   	push   %ebx
+  8024cb:	83 ec 18             	sub    $0x18,%esp
+  8024ce:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8024d1:	57                   	push   %edi
+  8024d2:	e8 4f f2 ff ff       	call   801726 <fd2data>
+  8024d7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8024d9:	83 c4 10             	add    $0x10,%esp
+  8024dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8024e4:	75 13                	jne    8024f9 <devpipe_read+0x34>
+	return i;
+  8024e6:	89 f0                	mov    %esi,%eax
+  8024e8:	eb 02                	jmp    8024ec <devpipe_read+0x27>
+				return i;
+  8024ea:	89 f0                	mov    %esi,%eax
+}
+  8024ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ef:	5b                   	pop    %ebx
+  8024f0:	5e                   	pop    %esi
+  8024f1:	5f                   	pop    %edi
+  8024f2:	5d                   	pop    %ebp
+  8024f3:	c3                   	ret
+			sys_yield();
+  8024f4:	e8 9c ec ff ff       	call   801195 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8024f9:	8b 03                	mov    (%ebx),%eax
+  8024fb:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8024fe:	75 18                	jne    802518 <devpipe_read+0x53>
+			if (i > 0)
+  802500:	85 f6                	test   %esi,%esi
+  802502:	75 e6                	jne    8024ea <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802504:	89 da                	mov    %ebx,%edx
+  802506:	89 f8                	mov    %edi,%eax
+  802508:	e8 d4 fe ff ff       	call   8023e1 <_pipeisclosed>
+  80250d:	85 c0                	test   %eax,%eax
+  80250f:	74 e3                	je     8024f4 <devpipe_read+0x2f>
+				return 0;
+  802511:	b8 00 00 00 00       	mov    $0x0,%eax
+  802516:	eb d4                	jmp    8024ec <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802518:	99                   	cltd
+  802519:	c1 ea 1b             	shr    $0x1b,%edx
+  80251c:	01 d0                	add    %edx,%eax
+  80251e:	83 e0 1f             	and    $0x1f,%eax
+  802521:	29 d0                	sub    %edx,%eax
+  802523:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802528:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80252b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80252e:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802531:	83 c6 01             	add    $0x1,%esi
+  802534:	eb ab                	jmp    8024e1 <devpipe_read+0x1c>
+
+00802536 <pipe>:
+{
+  802536:	55                   	push   %ebp
+  802537:	89 e5                	mov    %esp,%ebp
+  802539:	56                   	push   %esi
+  80253a:	53                   	push   %ebx
+  80253b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80253e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802541:	50                   	push   %eax
+  802542:	e8 f6 f1 ff ff       	call   80173d <fd_alloc>
+  802547:	89 c3                	mov    %eax,%ebx
+  802549:	83 c4 10             	add    $0x10,%esp
+  80254c:	85 c0                	test   %eax,%eax
+  80254e:	0f 88 23 01 00 00    	js     802677 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802554:	83 ec 04             	sub    $0x4,%esp
+  802557:	68 07 04 00 00       	push   $0x407
+  80255c:	ff 75 f4             	push   -0xc(%ebp)
+  80255f:	6a 00                	push   $0x0
+  802561:	e8 af ec ff ff       	call   801215 <sys_page_alloc>
+  802566:	89 c3                	mov    %eax,%ebx
+  802568:	83 c4 10             	add    $0x10,%esp
+  80256b:	85 c0                	test   %eax,%eax
+  80256d:	0f 88 04 01 00 00    	js     802677 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802573:	83 ec 0c             	sub    $0xc,%esp
+  802576:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802579:	50                   	push   %eax
+  80257a:	e8 be f1 ff ff       	call   80173d <fd_alloc>
+  80257f:	89 c3                	mov    %eax,%ebx
+  802581:	83 c4 10             	add    $0x10,%esp
+  802584:	85 c0                	test   %eax,%eax
+  802586:	0f 88 db 00 00 00    	js     802667 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80258c:	83 ec 04             	sub    $0x4,%esp
+  80258f:	68 07 04 00 00       	push   $0x407
+  802594:	ff 75 f0             	push   -0x10(%ebp)
+  802597:	6a 00                	push   $0x0
+  802599:	e8 77 ec ff ff       	call   801215 <sys_page_alloc>
+  80259e:	89 c3                	mov    %eax,%ebx
+  8025a0:	83 c4 10             	add    $0x10,%esp
+  8025a3:	85 c0                	test   %eax,%eax
+  8025a5:	0f 88 bc 00 00 00    	js     802667 <pipe+0x131>
+	va = fd2data(fd0);
+  8025ab:	83 ec 0c             	sub    $0xc,%esp
+  8025ae:	ff 75 f4             	push   -0xc(%ebp)
+  8025b1:	e8 70 f1 ff ff       	call   801726 <fd2data>
+  8025b6:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025b8:	83 c4 0c             	add    $0xc,%esp
+  8025bb:	68 07 04 00 00       	push   $0x407
+  8025c0:	50                   	push   %eax
+  8025c1:	6a 00                	push   $0x0
+  8025c3:	e8 4d ec ff ff       	call   801215 <sys_page_alloc>
+  8025c8:	89 c3                	mov    %eax,%ebx
+  8025ca:	83 c4 10             	add    $0x10,%esp
+  8025cd:	85 c0                	test   %eax,%eax
+  8025cf:	0f 88 82 00 00 00    	js     802657 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025d5:	83 ec 0c             	sub    $0xc,%esp
+  8025d8:	ff 75 f0             	push   -0x10(%ebp)
+  8025db:	e8 46 f1 ff ff       	call   801726 <fd2data>
+  8025e0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8025e7:	50                   	push   %eax
+  8025e8:	6a 00                	push   $0x0
+  8025ea:	56                   	push   %esi
+  8025eb:	6a 00                	push   $0x0
+  8025ed:	e8 a9 ec ff ff       	call   80129b <sys_page_map>
+  8025f2:	89 c3                	mov    %eax,%ebx
+  8025f4:	83 c4 20             	add    $0x20,%esp
+  8025f7:	85 c0                	test   %eax,%eax
+  8025f9:	78 4e                	js     802649 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025fb:	a1 40 40 80 00       	mov    0x804040,%eax
+  802600:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802603:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802605:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802608:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80260f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802612:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802614:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802617:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80261e:	83 ec 0c             	sub    $0xc,%esp
+  802621:	ff 75 f4             	push   -0xc(%ebp)
+  802624:	e8 ed f0 ff ff       	call   801716 <fd2num>
+  802629:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80262c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80262e:	83 c4 04             	add    $0x4,%esp
+  802631:	ff 75 f0             	push   -0x10(%ebp)
+  802634:	e8 dd f0 ff ff       	call   801716 <fd2num>
+  802639:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80263c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80263f:	83 c4 10             	add    $0x10,%esp
+  802642:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802647:	eb 2e                	jmp    802677 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802649:	83 ec 08             	sub    $0x8,%esp
+  80264c:	56                   	push   %esi
+  80264d:	6a 00                	push   $0x0
+  80264f:	e8 89 ec ff ff       	call   8012dd <sys_page_unmap>
+  802654:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802657:	83 ec 08             	sub    $0x8,%esp
+  80265a:	ff 75 f0             	push   -0x10(%ebp)
+  80265d:	6a 00                	push   $0x0
+  80265f:	e8 79 ec ff ff       	call   8012dd <sys_page_unmap>
+  802664:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802667:	83 ec 08             	sub    $0x8,%esp
+  80266a:	ff 75 f4             	push   -0xc(%ebp)
+  80266d:	6a 00                	push   $0x0
+  80266f:	e8 69 ec ff ff       	call   8012dd <sys_page_unmap>
+  802674:	83 c4 10             	add    $0x10,%esp
+}
+  802677:	89 d8                	mov    %ebx,%eax
+  802679:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80267c:	5b                   	pop    %ebx
+  80267d:	5e                   	pop    %esi
+  80267e:	5d                   	pop    %ebp
+  80267f:	c3                   	ret
+
+00802680 <pipeisclosed>:
+{
+  802680:	55                   	push   %ebp
+  802681:	89 e5                	mov    %esp,%ebp
+  802683:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802686:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802689:	50                   	push   %eax
+  80268a:	ff 75 08             	push   0x8(%ebp)
+  80268d:	e8 01 f1 ff ff       	call   801793 <fd_lookup>
+  802692:	83 c4 10             	add    $0x10,%esp
+  802695:	85 c0                	test   %eax,%eax
+  802697:	78 18                	js     8026b1 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802699:	83 ec 0c             	sub    $0xc,%esp
+  80269c:	ff 75 f4             	push   -0xc(%ebp)
+  80269f:	e8 82 f0 ff ff       	call   801726 <fd2data>
+  8026a4:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8026a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026a9:	e8 33 fd ff ff       	call   8023e1 <_pipeisclosed>
+  8026ae:	83 c4 10             	add    $0x10,%esp
+}
+  8026b1:	c9                   	leave
+  8026b2:	c3                   	ret
+
+008026b3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8026b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b8:	c3                   	ret
+
+008026b9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026b9:	55                   	push   %ebp
+  8026ba:	89 e5                	mov    %esp,%ebp
+  8026bc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8026bf:	68 27 35 80 00       	push   $0x803527
+  8026c4:	ff 75 0c             	push   0xc(%ebp)
+  8026c7:	e8 dc e6 ff ff       	call   800da8 <strcpy>
+	return 0;
+}
+  8026cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d1:	c9                   	leave
+  8026d2:	c3                   	ret
+
+008026d3 <devcons_write>:
+{
+  8026d3:	55                   	push   %ebp
+  8026d4:	89 e5                	mov    %esp,%ebp
+  8026d6:	57                   	push   %edi
+  8026d7:	56                   	push   %esi
+  8026d8:	53                   	push   %ebx
+  8026d9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8026df:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8026e4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8026ea:	eb 2e                	jmp    80271a <devcons_write+0x47>
+		m = n - tot;
+  8026ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026ef:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8026f1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8026f6:	39 c3                	cmp    %eax,%ebx
+  8026f8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8026fb:	83 ec 04             	sub    $0x4,%esp
+  8026fe:	53                   	push   %ebx
+  8026ff:	89 f0                	mov    %esi,%eax
+  802701:	03 45 0c             	add    0xc(%ebp),%eax
+  802704:	50                   	push   %eax
+  802705:	57                   	push   %edi
+  802706:	e8 23 e8 ff ff       	call   800f2e <memmove>
+		sys_cputs(buf, m);
+  80270b:	83 c4 08             	add    $0x8,%esp
+  80270e:	53                   	push   %ebx
+  80270f:	57                   	push   %edi
+  802710:	e8 c3 e9 ff ff       	call   8010d8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802715:	01 de                	add    %ebx,%esi
+  802717:	83 c4 10             	add    $0x10,%esp
+  80271a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80271d:	72 cd                	jb     8026ec <devcons_write+0x19>
+}
+  80271f:	89 f0                	mov    %esi,%eax
+  802721:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802724:	5b                   	pop    %ebx
+  802725:	5e                   	pop    %esi
+  802726:	5f                   	pop    %edi
+  802727:	5d                   	pop    %ebp
+  802728:	c3                   	ret
+
+00802729 <devcons_read>:
+{
+  802729:	55                   	push   %ebp
+  80272a:	89 e5                	mov    %esp,%ebp
+  80272c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80272f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802734:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802738:	75 07                	jne    802741 <devcons_read+0x18>
+  80273a:	eb 1f                	jmp    80275b <devcons_read+0x32>
+		sys_yield();
+  80273c:	e8 54 ea ff ff       	call   801195 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802741:	e8 b0 e9 ff ff       	call   8010f6 <sys_cgetc>
+  802746:	85 c0                	test   %eax,%eax
+  802748:	74 f2                	je     80273c <devcons_read+0x13>
+	if (c < 0)
+  80274a:	78 0f                	js     80275b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80274c:	83 f8 04             	cmp    $0x4,%eax
+  80274f:	74 0c                	je     80275d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802751:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802754:	88 02                	mov    %al,(%edx)
+	return 1;
+  802756:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80275b:	c9                   	leave
+  80275c:	c3                   	ret
+		return 0;
+  80275d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802762:	eb f7                	jmp    80275b <devcons_read+0x32>
+
+00802764 <cputchar>:
+{
+  802764:	55                   	push   %ebp
+  802765:	89 e5                	mov    %esp,%ebp
+  802767:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80276a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80276d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802770:	6a 01                	push   $0x1
+  802772:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802775:	50                   	push   %eax
+  802776:	e8 5d e9 ff ff       	call   8010d8 <sys_cputs>
+}
+  80277b:	83 c4 10             	add    $0x10,%esp
+  80277e:	c9                   	leave
+  80277f:	c3                   	ret
+
+00802780 <getchar>:
+{
+  802780:	55                   	push   %ebp
+  802781:	89 e5                	mov    %esp,%ebp
+  802783:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802786:	6a 01                	push   $0x1
+  802788:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80278b:	50                   	push   %eax
+  80278c:	6a 00                	push   $0x0
+  80278e:	e8 66 f2 ff ff       	call   8019f9 <read>
+	if (r < 0)
+  802793:	83 c4 10             	add    $0x10,%esp
+  802796:	85 c0                	test   %eax,%eax
+  802798:	78 06                	js     8027a0 <getchar+0x20>
+	if (r < 1)
+  80279a:	74 06                	je     8027a2 <getchar+0x22>
+	return c;
+  80279c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8027a0:	c9                   	leave
+  8027a1:	c3                   	ret
+		return -E_EOF;
+  8027a2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8027a7:	eb f7                	jmp    8027a0 <getchar+0x20>
+
+008027a9 <iscons>:
+{
+  8027a9:	55                   	push   %ebp
+  8027aa:	89 e5                	mov    %esp,%ebp
+  8027ac:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027b2:	50                   	push   %eax
+  8027b3:	ff 75 08             	push   0x8(%ebp)
+  8027b6:	e8 d8 ef ff ff       	call   801793 <fd_lookup>
+  8027bb:	83 c4 10             	add    $0x10,%esp
+  8027be:	85 c0                	test   %eax,%eax
+  8027c0:	78 11                	js     8027d3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8027c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027c5:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  8027cb:	39 10                	cmp    %edx,(%eax)
+  8027cd:	0f 94 c0             	sete   %al
+  8027d0:	0f b6 c0             	movzbl %al,%eax
+}
+  8027d3:	c9                   	leave
+  8027d4:	c3                   	ret
+
+008027d5 <opencons>:
+{
+  8027d5:	55                   	push   %ebp
+  8027d6:	89 e5                	mov    %esp,%ebp
+  8027d8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8027db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027de:	50                   	push   %eax
+  8027df:	e8 59 ef ff ff       	call   80173d <fd_alloc>
+  8027e4:	83 c4 10             	add    $0x10,%esp
+  8027e7:	85 c0                	test   %eax,%eax
+  8027e9:	78 3a                	js     802825 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8027eb:	83 ec 04             	sub    $0x4,%esp
+  8027ee:	68 07 04 00 00       	push   $0x407
+  8027f3:	ff 75 f4             	push   -0xc(%ebp)
+  8027f6:	6a 00                	push   $0x0
+  8027f8:	e8 18 ea ff ff       	call   801215 <sys_page_alloc>
+  8027fd:	83 c4 10             	add    $0x10,%esp
+  802800:	85 c0                	test   %eax,%eax
+  802802:	78 21                	js     802825 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802804:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802807:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  80280d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80280f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802812:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802819:	83 ec 0c             	sub    $0xc,%esp
+  80281c:	50                   	push   %eax
+  80281d:	e8 f4 ee ff ff       	call   801716 <fd2num>
+  802822:	83 c4 10             	add    $0x10,%esp
+}
+  802825:	c9                   	leave
+  802826:	c3                   	ret
+
+00802827 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802827:	55                   	push   %ebp
+  802828:	89 e5                	mov    %esp,%ebp
+  80282a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80282d:	89 c2                	mov    %eax,%edx
+  80282f:	c1 ea 16             	shr    $0x16,%edx
+  802832:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802839:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80283e:	f6 c1 01             	test   $0x1,%cl
+  802841:	74 22                	je     802865 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802843:	c1 e8 0c             	shr    $0xc,%eax
+  802846:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80284d:	a8 01                	test   $0x1,%al
+  80284f:	74 14                	je     802865 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802851:	c1 e8 0c             	shr    $0xc,%eax
+  802854:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802857:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80285e:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802862:	0f b7 d2             	movzwl %dx,%edx
+}
+  802865:	89 d0                	mov    %edx,%eax
+  802867:	5d                   	pop    %ebp
+  802868:	c3                   	ret
+  802869:	66 90                	xchg   %ax,%ax
+  80286b:	66 90                	xchg   %ax,%ax
+  80286d:	66 90                	xchg   %ax,%ax
+  80286f:	90                   	nop
+
+00802870 <__udivmoddi4>:
+  802870:	55                   	push   %ebp
+  802871:	57                   	push   %edi
+  802872:	56                   	push   %esi
+  802873:	53                   	push   %ebx
+  802874:	83 ec 14             	sub    $0x14,%esp
+  802877:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80287b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80287f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802883:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802887:	89 f1                	mov    %esi,%ecx
+  802889:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80288d:	09 d9                	or     %ebx,%ecx
+  80288f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802893:	0f 84 92 00 00 00    	je     80292b <__udivmoddi4+0xbb>
+  802899:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8028a0:	00 
+  8028a1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8028a6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8028ad:	00 
+  8028ae:	89 1c 24             	mov    %ebx,(%esp)
+  8028b1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8028b5:	8d 76 00             	lea    0x0(%esi),%esi
+  8028b8:	89 e9                	mov    %ebp,%ecx
+  8028ba:	89 c3                	mov    %eax,%ebx
+  8028bc:	89 d6                	mov    %edx,%esi
+  8028be:	31 ff                	xor    %edi,%edi
+  8028c0:	d3 ee                	shr    %cl,%esi
+  8028c2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8028c5:	f6 c1 20             	test   $0x20,%cl
+  8028c8:	0f 45 de             	cmovne %esi,%ebx
+  8028cb:	0f 45 f7             	cmovne %edi,%esi
+  8028ce:	8b 3c 24             	mov    (%esp),%edi
+  8028d1:	39 fb                	cmp    %edi,%ebx
+  8028d3:	89 f7                	mov    %esi,%edi
+  8028d5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8028d9:	8b 1c 24             	mov    (%esp),%ebx
+  8028dc:	19 f7                	sbb    %esi,%edi
+  8028de:	72 39                	jb     802919 <__udivmoddi4+0xa9>
+  8028e0:	89 e9                	mov    %ebp,%ecx
+  8028e2:	89 f7                	mov    %esi,%edi
+  8028e4:	89 de                	mov    %ebx,%esi
+  8028e6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8028e9:	d3 e6                	shl    %cl,%esi
+  8028eb:	31 db                	xor    %ebx,%ebx
+  8028ed:	f6 c1 20             	test   $0x20,%cl
+  8028f0:	0f 45 fe             	cmovne %esi,%edi
+  8028f3:	0f 45 f3             	cmovne %ebx,%esi
+  8028f6:	29 f0                	sub    %esi,%eax
+  8028f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8028fd:	19 fa                	sbb    %edi,%edx
+  8028ff:	31 ff                	xor    %edi,%edi
+  802901:	31 db                	xor    %ebx,%ebx
+  802903:	0f a5 f7             	shld   %cl,%esi,%edi
+  802906:	d3 e6                	shl    %cl,%esi
+  802908:	f6 c1 20             	test   $0x20,%cl
+  80290b:	0f 45 fe             	cmovne %esi,%edi
+  80290e:	0f 45 f3             	cmovne %ebx,%esi
+  802911:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802915:	09 74 24 08          	or     %esi,0x8(%esp)
+  802919:	83 ed 01             	sub    $0x1,%ebp
+  80291c:	73 9a                	jae    8028b8 <__udivmoddi4+0x48>
+  80291e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802922:	85 ff                	test   %edi,%edi
+  802924:	74 05                	je     80292b <__udivmoddi4+0xbb>
+  802926:	89 07                	mov    %eax,(%edi)
+  802928:	89 57 04             	mov    %edx,0x4(%edi)
+  80292b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80292f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802933:	83 c4 14             	add    $0x14,%esp
+  802936:	5b                   	pop    %ebx
+  802937:	5e                   	pop    %esi
+  802938:	5f                   	pop    %edi
+  802939:	5d                   	pop    %ebp
+  80293a:	c3                   	ret
+  80293b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80293f:	90                   	nop
+
+00802940 <__udivdi3>:
+  802940:	55                   	push   %ebp
+  802941:	57                   	push   %edi
+  802942:	56                   	push   %esi
+  802943:	53                   	push   %ebx
+  802944:	83 ec 14             	sub    $0x14,%esp
+  802947:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80294b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80294f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802953:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802957:	89 fb                	mov    %edi,%ebx
+  802959:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80295d:	09 f3                	or     %esi,%ebx
+  80295f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802963:	0f 84 85 00 00 00    	je     8029ee <__udivdi3+0xae>
+  802969:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802970:	00 
+  802971:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802976:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80297d:	00 
+  80297e:	89 34 24             	mov    %esi,(%esp)
+  802981:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802985:	8d 76 00             	lea    0x0(%esi),%esi
+  802988:	89 e9                	mov    %ebp,%ecx
+  80298a:	89 c3                	mov    %eax,%ebx
+  80298c:	89 d6                	mov    %edx,%esi
+  80298e:	31 ff                	xor    %edi,%edi
+  802990:	d3 ee                	shr    %cl,%esi
+  802992:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802995:	f6 c1 20             	test   $0x20,%cl
+  802998:	0f 45 de             	cmovne %esi,%ebx
+  80299b:	0f 45 f7             	cmovne %edi,%esi
+  80299e:	8b 3c 24             	mov    (%esp),%edi
+  8029a1:	39 fb                	cmp    %edi,%ebx
+  8029a3:	89 f7                	mov    %esi,%edi
+  8029a5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8029a9:	8b 1c 24             	mov    (%esp),%ebx
+  8029ac:	19 f7                	sbb    %esi,%edi
+  8029ae:	72 39                	jb     8029e9 <__udivdi3+0xa9>
+  8029b0:	89 e9                	mov    %ebp,%ecx
+  8029b2:	89 f7                	mov    %esi,%edi
+  8029b4:	89 de                	mov    %ebx,%esi
+  8029b6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8029b9:	d3 e6                	shl    %cl,%esi
+  8029bb:	31 db                	xor    %ebx,%ebx
+  8029bd:	f6 c1 20             	test   $0x20,%cl
+  8029c0:	0f 45 fe             	cmovne %esi,%edi
+  8029c3:	0f 45 f3             	cmovne %ebx,%esi
+  8029c6:	29 f0                	sub    %esi,%eax
+  8029c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8029cd:	19 fa                	sbb    %edi,%edx
+  8029cf:	31 ff                	xor    %edi,%edi
+  8029d1:	31 db                	xor    %ebx,%ebx
+  8029d3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029d6:	d3 e6                	shl    %cl,%esi
+  8029d8:	f6 c1 20             	test   $0x20,%cl
+  8029db:	0f 45 fe             	cmovne %esi,%edi
+  8029de:	0f 45 f3             	cmovne %ebx,%esi
+  8029e1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8029e5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8029e9:	83 ed 01             	sub    $0x1,%ebp
+  8029ec:	73 9a                	jae    802988 <__udivdi3+0x48>
+  8029ee:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029f2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029f6:	83 c4 14             	add    $0x14,%esp
+  8029f9:	5b                   	pop    %ebx
+  8029fa:	5e                   	pop    %esi
+  8029fb:	5f                   	pop    %edi
+  8029fc:	5d                   	pop    %ebp
+  8029fd:	c3                   	ret
+  8029fe:	66 90                	xchg   %ax,%ax
+
+00802a00 <__umoddi3>:
+  802a00:	57                   	push   %edi
+  802a01:	56                   	push   %esi
+  802a02:	53                   	push   %ebx
+  802a03:	83 ec 08             	sub    $0x8,%esp
+  802a06:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  802a0a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  802a0e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a12:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a16:	89 f9                	mov    %edi,%ecx
+  802a18:	89 34 24             	mov    %esi,(%esp)
+  802a1b:	09 f1                	or     %esi,%ecx
+  802a1d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802a21:	74 53                	je     802a76 <__umoddi3+0x76>
+  802a23:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a2f:	90                   	nop
+  802a30:	89 c6                	mov    %eax,%esi
+  802a32:	89 d7                	mov    %edx,%edi
+  802a34:	31 db                	xor    %ebx,%ebx
+  802a36:	d3 ef                	shr    %cl,%edi
+  802a38:	0f ad d6             	shrd   %cl,%edx,%esi
+  802a3b:	f6 c1 20             	test   $0x20,%cl
+  802a3e:	0f 45 f7             	cmovne %edi,%esi
+  802a41:	0f 45 fb             	cmovne %ebx,%edi
+  802a44:	8b 1c 24             	mov    (%esp),%ebx
+  802a47:	39 de                	cmp    %ebx,%esi
+  802a49:	89 fb                	mov    %edi,%ebx
+  802a4b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  802a4f:	8b 34 24             	mov    (%esp),%esi
+  802a52:	19 fb                	sbb    %edi,%ebx
+  802a54:	72 14                	jb     802a6a <__umoddi3+0x6a>
+  802a56:	0f a5 f7             	shld   %cl,%esi,%edi
+  802a59:	31 db                	xor    %ebx,%ebx
+  802a5b:	d3 e6                	shl    %cl,%esi
+  802a5d:	f6 c1 20             	test   $0x20,%cl
+  802a60:	0f 45 fe             	cmovne %esi,%edi
+  802a63:	0f 45 f3             	cmovne %ebx,%esi
+  802a66:	29 f0                	sub    %esi,%eax
+  802a68:	19 fa                	sbb    %edi,%edx
+  802a6a:	83 e9 01             	sub    $0x1,%ecx
+  802a6d:	73 c1                	jae    802a30 <__umoddi3+0x30>
+  802a6f:	83 c4 08             	add    $0x8,%esp
+  802a72:	5b                   	pop    %ebx
+  802a73:	5e                   	pop    %esi
+  802a74:	5f                   	pop    %edi
+  802a75:	c3                   	ret
+  802a76:	83 c4 08             	add    $0x8,%esp
+  802a79:	31 c0                	xor    %eax,%eax
+  802a7b:	31 d2                	xor    %edx,%edx
+  802a7d:	5b                   	pop    %ebx
+  802a7e:	5e                   	pop    %esi
+  802a7f:	5f                   	pop    %edi
+  802a80:	c3                   	ret
+  802a81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a8f:	90                   	nop
+
+00802a90 <__divdi3>:
+  802a90:	55                   	push   %ebp
+  802a91:	57                   	push   %edi
+  802a92:	56                   	push   %esi
+  802a93:	53                   	push   %ebx
+  802a94:	83 ec 1c             	sub    $0x1c,%esp
+  802a97:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802a9b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802a9f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802aa3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802aa7:	85 ff                	test   %edi,%edi
+  802aa9:	0f 88 da 00 00 00    	js     802b89 <__divdi3+0xf9>
+  802aaf:	85 db                	test   %ebx,%ebx
+  802ab1:	78 16                	js     802ac9 <__divdi3+0x39>
+  802ab3:	89 dd                	mov    %ebx,%ebp
+  802ab5:	89 c8                	mov    %ecx,%eax
+  802ab7:	89 da                	mov    %ebx,%edx
+  802ab9:	09 cd                	or     %ecx,%ebp
+  802abb:	0f 85 fd 00 00 00    	jne    802bbe <__divdi3+0x12e>
+  802ac1:	83 c4 1c             	add    $0x1c,%esp
+  802ac4:	5b                   	pop    %ebx
+  802ac5:	5e                   	pop    %esi
+  802ac6:	5f                   	pop    %edi
+  802ac7:	5d                   	pop    %ebp
+  802ac8:	c3                   	ret
+  802ac9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802ace:	f7 d9                	neg    %ecx
+  802ad0:	89 f0                	mov    %esi,%eax
+  802ad2:	89 fa                	mov    %edi,%edx
+  802ad4:	83 d3 00             	adc    $0x0,%ebx
+  802ad7:	89 0c 24             	mov    %ecx,(%esp)
+  802ada:	f7 db                	neg    %ebx
+  802adc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802ae0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802ae7:	00 
+  802ae8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802aed:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802af4:	00 
+  802af5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802af9:	89 cd                	mov    %ecx,%ebp
+  802afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802aff:	90                   	nop
+  802b00:	89 e9                	mov    %ebp,%ecx
+  802b02:	89 c3                	mov    %eax,%ebx
+  802b04:	89 d6                	mov    %edx,%esi
+  802b06:	31 ff                	xor    %edi,%edi
+  802b08:	d3 ee                	shr    %cl,%esi
+  802b0a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802b0d:	f6 c1 20             	test   $0x20,%cl
+  802b10:	0f 45 de             	cmovne %esi,%ebx
+  802b13:	0f 45 f7             	cmovne %edi,%esi
+  802b16:	8b 3c 24             	mov    (%esp),%edi
+  802b19:	39 fb                	cmp    %edi,%ebx
+  802b1b:	89 f7                	mov    %esi,%edi
+  802b1d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802b21:	8b 1c 24             	mov    (%esp),%ebx
+  802b24:	19 f7                	sbb    %esi,%edi
+  802b26:	72 39                	jb     802b61 <__divdi3+0xd1>
+  802b28:	89 e9                	mov    %ebp,%ecx
+  802b2a:	89 f7                	mov    %esi,%edi
+  802b2c:	89 de                	mov    %ebx,%esi
+  802b2e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802b31:	d3 e6                	shl    %cl,%esi
+  802b33:	31 db                	xor    %ebx,%ebx
+  802b35:	f6 c1 20             	test   $0x20,%cl
+  802b38:	0f 45 fe             	cmovne %esi,%edi
+  802b3b:	0f 45 f3             	cmovne %ebx,%esi
+  802b3e:	29 f0                	sub    %esi,%eax
+  802b40:	be 01 00 00 00       	mov    $0x1,%esi
+  802b45:	19 fa                	sbb    %edi,%edx
+  802b47:	31 ff                	xor    %edi,%edi
+  802b49:	31 db                	xor    %ebx,%ebx
+  802b4b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802b4e:	d3 e6                	shl    %cl,%esi
+  802b50:	f6 c1 20             	test   $0x20,%cl
+  802b53:	0f 45 fe             	cmovne %esi,%edi
+  802b56:	0f 45 f3             	cmovne %ebx,%esi
+  802b59:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802b5d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802b61:	83 ed 01             	sub    $0x1,%ebp
+  802b64:	73 9a                	jae    802b00 <__divdi3+0x70>
+  802b66:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802b6a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b6e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b72:	85 ed                	test   %ebp,%ebp
+  802b74:	0f 84 47 ff ff ff    	je     802ac1 <__divdi3+0x31>
+  802b7a:	f7 d8                	neg    %eax
+  802b7c:	83 d2 00             	adc    $0x0,%edx
+  802b7f:	83 c4 1c             	add    $0x1c,%esp
+  802b82:	5b                   	pop    %ebx
+  802b83:	f7 da                	neg    %edx
+  802b85:	5e                   	pop    %esi
+  802b86:	5f                   	pop    %edi
+  802b87:	5d                   	pop    %ebp
+  802b88:	c3                   	ret
+  802b89:	f7 de                	neg    %esi
+  802b8b:	83 d7 00             	adc    $0x0,%edi
+  802b8e:	f7 df                	neg    %edi
+  802b90:	85 db                	test   %ebx,%ebx
+  802b92:	78 23                	js     802bb7 <__divdi3+0x127>
+  802b94:	89 dd                	mov    %ebx,%ebp
+  802b96:	89 c8                	mov    %ecx,%eax
+  802b98:	89 da                	mov    %ebx,%edx
+  802b9a:	09 cd                	or     %ecx,%ebp
+  802b9c:	0f 84 1f ff ff ff    	je     802ac1 <__divdi3+0x31>
+  802ba2:	89 0c 24             	mov    %ecx,(%esp)
+  802ba5:	89 f0                	mov    %esi,%eax
+  802ba7:	89 fa                	mov    %edi,%edx
+  802ba9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802bae:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802bb2:	e9 29 ff ff ff       	jmp    802ae0 <__divdi3+0x50>
+  802bb7:	31 ed                	xor    %ebp,%ebp
+  802bb9:	e9 10 ff ff ff       	jmp    802ace <__divdi3+0x3e>
+  802bbe:	89 0c 24             	mov    %ecx,(%esp)
+  802bc1:	89 f0                	mov    %esi,%eax
+  802bc3:	89 fa                	mov    %edi,%edx
+  802bc5:	31 ed                	xor    %ebp,%ebp
+  802bc7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802bcb:	e9 10 ff ff ff       	jmp    802ae0 <__divdi3+0x50>
+
+00802bd0 <__moddi3>:
+  802bd0:	55                   	push   %ebp
+  802bd1:	57                   	push   %edi
+  802bd2:	56                   	push   %esi
+  802bd3:	53                   	push   %ebx
+  802bd4:	83 ec 14             	sub    $0x14,%esp
+  802bd7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802bdb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802bdf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802be3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802be7:	85 d2                	test   %edx,%edx
+  802be9:	0f 88 9b 00 00 00    	js     802c8a <__moddi3+0xba>
+  802bef:	89 f7                	mov    %esi,%edi
+  802bf1:	31 ed                	xor    %ebp,%ebp
+  802bf3:	09 cf                	or     %ecx,%edi
+  802bf5:	0f 84 83 00 00 00    	je     802c7e <__moddi3+0xae>
+  802bfb:	89 cb                	mov    %ecx,%ebx
+  802bfd:	89 f7                	mov    %esi,%edi
+  802bff:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802c03:	f7 db                	neg    %ebx
+  802c05:	83 d7 00             	adc    $0x0,%edi
+  802c08:	f7 df                	neg    %edi
+  802c0a:	0f 49 f7             	cmovns %edi,%esi
+  802c0d:	0f 49 cb             	cmovns %ebx,%ecx
+  802c10:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802c14:	89 0c 24             	mov    %ecx,(%esp)
+  802c17:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c1c:	89 cd                	mov    %ecx,%ebp
+  802c1e:	66 90                	xchg   %ax,%ax
+  802c20:	89 e9                	mov    %ebp,%ecx
+  802c22:	89 c3                	mov    %eax,%ebx
+  802c24:	89 d6                	mov    %edx,%esi
+  802c26:	31 ff                	xor    %edi,%edi
+  802c28:	d3 ee                	shr    %cl,%esi
+  802c2a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802c2d:	f6 c1 20             	test   $0x20,%cl
+  802c30:	0f 45 de             	cmovne %esi,%ebx
+  802c33:	0f 45 f7             	cmovne %edi,%esi
+  802c36:	8b 3c 24             	mov    (%esp),%edi
+  802c39:	39 fb                	cmp    %edi,%ebx
+  802c3b:	89 f7                	mov    %esi,%edi
+  802c3d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c41:	8b 1c 24             	mov    (%esp),%ebx
+  802c44:	19 f7                	sbb    %esi,%edi
+  802c46:	72 1a                	jb     802c62 <__moddi3+0x92>
+  802c48:	89 e9                	mov    %ebp,%ecx
+  802c4a:	89 f7                	mov    %esi,%edi
+  802c4c:	89 de                	mov    %ebx,%esi
+  802c4e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802c51:	d3 e6                	shl    %cl,%esi
+  802c53:	31 db                	xor    %ebx,%ebx
+  802c55:	f6 c1 20             	test   $0x20,%cl
+  802c58:	0f 45 fe             	cmovne %esi,%edi
+  802c5b:	0f 45 f3             	cmovne %ebx,%esi
+  802c5e:	29 f0                	sub    %esi,%eax
+  802c60:	19 fa                	sbb    %edi,%edx
+  802c62:	83 ed 01             	sub    $0x1,%ebp
+  802c65:	73 b9                	jae    802c20 <__moddi3+0x50>
+  802c67:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802c6b:	85 ed                	test   %ebp,%ebp
+  802c6d:	74 07                	je     802c76 <__moddi3+0xa6>
+  802c6f:	f7 d8                	neg    %eax
+  802c71:	83 d2 00             	adc    $0x0,%edx
+  802c74:	f7 da                	neg    %edx
+  802c76:	83 c4 14             	add    $0x14,%esp
+  802c79:	5b                   	pop    %ebx
+  802c7a:	5e                   	pop    %esi
+  802c7b:	5f                   	pop    %edi
+  802c7c:	5d                   	pop    %ebp
+  802c7d:	c3                   	ret
+  802c7e:	83 c4 14             	add    $0x14,%esp
+  802c81:	31 c0                	xor    %eax,%eax
+  802c83:	31 d2                	xor    %edx,%edx
+  802c85:	5b                   	pop    %ebx
+  802c86:	5e                   	pop    %esi
+  802c87:	5f                   	pop    %edi
+  802c88:	5d                   	pop    %ebp
+  802c89:	c3                   	ret
+  802c8a:	89 f7                	mov    %esi,%edi
+  802c8c:	09 cf                	or     %ecx,%edi
+  802c8e:	74 11                	je     802ca1 <__moddi3+0xd1>
+  802c90:	f7 d8                	neg    %eax
+  802c92:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802c97:	83 d2 00             	adc    $0x0,%edx
+  802c9a:	f7 da                	neg    %edx
+  802c9c:	e9 5a ff ff ff       	jmp    802bfb <__moddi3+0x2b>
+  802ca1:	31 c0                	xor    %eax,%eax
+  802ca3:	31 d2                	xor    %edx,%edx
+  802ca5:	eb c8                	jmp    802c6f <__moddi3+0x9f>
@@ -0,0 +1,5771 @@
+
+obj/user/testforkcow.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 27 02 00 00       	call   800258 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+// Big enough that most of it is past the pages loaded from the file.
+uint32_t bigbss[16 * WORDS];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	envid_t child;
+	int r;
+
+	if ((r = sys_region_reserve(0, REGION, 3 * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  80003a:	6a 07                	push   $0x7
+  80003c:	68 00 30 00 00       	push   $0x3000
+  800041:	68 00 00 00 a0       	push   $0xa0000000
+  800046:	6a 00                	push   $0x0
+  800048:	e8 0f 0f 00 00       	call   800f5c <sys_region_reserve>
+  80004d:	83 c4 10             	add    $0x10,%esp
+  800050:	85 c0                	test   %eax,%eax
+  800052:	0f 88 66 01 00 00    	js     8001be <umain+0x18b>
+		panic("sys_region_reserve: %e", r);
+	bigbss[0] = 1;
+  800058:	c7 05 20 40 80 00 01 	movl   $0x1,0x804020
+  80005f:	00 00 00 
+	bigbss[5 * WORDS] = 2;
+  800062:	c7 05 20 90 80 00 02 	movl   $0x2,0x809020
+  800069:	00 00 00 
+	REGION[0] = 'p';
+  80006c:	c6 05 00 00 00 a0 70 	movb   $0x70,0xa0000000
+	if (REGION[PGSIZE] != 0)
+  800073:	80 3d 00 10 00 a0 00 	cmpb   $0x0,0xa0001000
+  80007a:	0f 85 50 01 00 00    	jne    8001d0 <umain+0x19d>
+		panic("region page isn't cleared");
+	// bigbss[10 * WORDS] and REGION[2 * PGSIZE] stay untouched.
+
+	if ((r = sys_env_set_kernel_cow(0, 1)) < 0)
+  800080:	83 ec 08             	sub    $0x8,%esp
+  800083:	6a 01                	push   $0x1
+  800085:	6a 00                	push   $0x0
+  800087:	e8 20 0d 00 00       	call   800dac <sys_env_set_kernel_cow>
+  80008c:	83 c4 10             	add    $0x10,%esp
+  80008f:	85 c0                	test   %eax,%eax
+  800091:	0f 88 4d 01 00 00    	js     8001e4 <umain+0x1b1>
+		panic("sys_env_set_kernel_cow: %e", r);
+	if ((child = sys_fork_cow()) < 0)
+  800097:	e8 f1 0c 00 00       	call   800d8d <sys_fork_cow>
+  80009c:	89 c3                	mov    %eax,%ebx
+  80009e:	85 c0                	test   %eax,%eax
+  8000a0:	0f 88 50 01 00 00    	js     8001f6 <umain+0x1c3>
+		panic("sys_fork_cow: %e", child);
+
+	if (child == 0) {
+  8000a6:	0f 85 a3 00 00 00    	jne    80014f <umain+0x11c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8000ac:	e8 9e 0c 00 00       	call   800d4f <sys_getenvid>
+  8000b1:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000b6:	c1 e0 09             	shl    $0x9,%eax
+  8000b9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000be:	a3 20 40 81 00       	mov    %eax,0x814020
+		if (bigbss[0] != 1 || bigbss[5 * WORDS] != 2 || bigbss[10 * WORDS] != 0)
+  8000c3:	83 3d 20 40 80 00 01 	cmpl   $0x1,0x804020
+  8000ca:	0f 85 38 01 00 00    	jne    800208 <umain+0x1d5>
+  8000d0:	83 3d 20 90 80 00 02 	cmpl   $0x2,0x809020
+  8000d7:	0f 85 2b 01 00 00    	jne    800208 <umain+0x1d5>
+  8000dd:	83 3d 20 e0 80 00 00 	cmpl   $0x0,0x80e020
+  8000e4:	0f 85 1e 01 00 00    	jne    800208 <umain+0x1d5>
+			panic("child: wrong bss");
+		if (REGION[0] != 'p' || REGION[PGSIZE] != 0 || REGION[2 * PGSIZE] != 0)
+  8000ea:	80 3d 00 00 00 a0 70 	cmpb   $0x70,0xa0000000
+  8000f1:	0f 85 25 01 00 00    	jne    80021c <umain+0x1e9>
+  8000f7:	80 3d 00 10 00 a0 00 	cmpb   $0x0,0xa0001000
+  8000fe:	0f 85 18 01 00 00    	jne    80021c <umain+0x1e9>
+  800104:	80 3d 00 20 00 a0 00 	cmpb   $0x0,0xa0002000
+  80010b:	0f 85 0b 01 00 00    	jne    80021c <umain+0x1e9>
+			panic("child: wrong region");
+		bigbss[0] = 10;
+  800111:	c7 05 20 40 80 00 0a 	movl   $0xa,0x804020
+  800118:	00 00 00 
+		bigbss[10 * WORDS] = 11;
+  80011b:	c7 05 20 e0 80 00 0b 	movl   $0xb,0x80e020
+  800122:	00 00 00 
+		REGION[0] = 'c';
+  800125:	c6 05 00 00 00 a0 63 	movb   $0x63,0xa0000000
+		REGION[PGSIZE] = 'c';
+  80012c:	c6 05 00 10 00 a0 63 	movb   $0x63,0xa0001000
+		REGION[2 * PGSIZE] = 'c';
+  800133:	c6 05 00 20 00 a0 63 	movb   $0x63,0xa0002000
+		cprintf("child sees the parent's bss and region\n");
+  80013a:	83 ec 0c             	sub    $0xc,%esp
+  80013d:	68 a0 29 80 00       	push   $0x8029a0
+  800142:	e8 4c 02 00 00       	call   800393 <cprintf>
+		exit();
+  800147:	e8 52 01 00 00       	call   80029e <exit>
+  80014c:	83 c4 10             	add    $0x10,%esp
+	}
+
+	wait(child);
+  80014f:	83 ec 0c             	sub    $0xc,%esp
+  800152:	53                   	push   %ebx
+  800153:	e8 58 20 00 00       	call   8021b0 <wait>
+	if (bigbss[0] != 1 || bigbss[5 * WORDS] != 2 || bigbss[10 * WORDS] != 0)
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	83 3d 20 40 80 00 01 	cmpl   $0x1,0x804020
+  800162:	0f 85 c8 00 00 00    	jne    800230 <umain+0x1fd>
+  800168:	83 3d 20 90 80 00 02 	cmpl   $0x2,0x809020
+  80016f:	0f 85 bb 00 00 00    	jne    800230 <umain+0x1fd>
+  800175:	83 3d 20 e0 80 00 00 	cmpl   $0x0,0x80e020
+  80017c:	0f 85 ae 00 00 00    	jne    800230 <umain+0x1fd>
+		panic("parent: bss changed");
+	if (REGION[0] != 'p' || REGION[PGSIZE] != 0 || REGION[2 * PGSIZE] != 0)
+  800182:	80 3d 00 00 00 a0 70 	cmpb   $0x70,0xa0000000
+  800189:	0f 85 b5 00 00 00    	jne    800244 <umain+0x211>
+  80018f:	80 3d 00 10 00 a0 00 	cmpb   $0x0,0xa0001000
+  800196:	0f 85 a8 00 00 00    	jne    800244 <umain+0x211>
+  80019c:	80 3d 00 20 00 a0 00 	cmpb   $0x0,0xa0002000
+  8001a3:	0f 85 9b 00 00 00    	jne    800244 <umain+0x211>
+		panic("parent: region changed");
+	cprintf("parent keeps its own bss and region\n");
+  8001a9:	83 ec 0c             	sub    $0xc,%esp
+  8001ac:	68 c8 29 80 00       	push   $0x8029c8
+  8001b1:	e8 dd 01 00 00       	call   800393 <cprintf>
+}
+  8001b6:	83 c4 10             	add    $0x10,%esp
+  8001b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001bc:	c9                   	leave
+  8001bd:	c3                   	ret
+		panic("sys_region_reserve: %e", r);
+  8001be:	50                   	push   %eax
+  8001bf:	68 e0 28 80 00       	push   $0x8028e0
+  8001c4:	6a 14                	push   $0x14
+  8001c6:	68 f7 28 80 00       	push   $0x8028f7
+  8001cb:	e8 e8 00 00 00       	call   8002b8 <_panic>
+		panic("region page isn't cleared");
+  8001d0:	83 ec 04             	sub    $0x4,%esp
+  8001d3:	68 0a 29 80 00       	push   $0x80290a
+  8001d8:	6a 19                	push   $0x19
+  8001da:	68 f7 28 80 00       	push   $0x8028f7
+  8001df:	e8 d4 00 00 00       	call   8002b8 <_panic>
+		panic("sys_env_set_kernel_cow: %e", r);
+  8001e4:	50                   	push   %eax
+  8001e5:	68 24 29 80 00       	push   $0x802924
+  8001ea:	6a 1d                	push   $0x1d
+  8001ec:	68 f7 28 80 00       	push   $0x8028f7
+  8001f1:	e8 c2 00 00 00       	call   8002b8 <_panic>
+		panic("sys_fork_cow: %e", child);
+  8001f6:	50                   	push   %eax
+  8001f7:	68 3f 29 80 00       	push   $0x80293f
+  8001fc:	6a 1f                	push   $0x1f
+  8001fe:	68 f7 28 80 00       	push   $0x8028f7
+  800203:	e8 b0 00 00 00       	call   8002b8 <_panic>
+			panic("child: wrong bss");
+  800208:	83 ec 04             	sub    $0x4,%esp
+  80020b:	68 50 29 80 00       	push   $0x802950
+  800210:	6a 24                	push   $0x24
+  800212:	68 f7 28 80 00       	push   $0x8028f7
+  800217:	e8 9c 00 00 00       	call   8002b8 <_panic>
+			panic("child: wrong region");
+  80021c:	83 ec 04             	sub    $0x4,%esp
+  80021f:	68 61 29 80 00       	push   $0x802961
+  800224:	6a 26                	push   $0x26
+  800226:	68 f7 28 80 00       	push   $0x8028f7
+  80022b:	e8 88 00 00 00       	call   8002b8 <_panic>
+		panic("parent: bss changed");
+  800230:	83 ec 04             	sub    $0x4,%esp
+  800233:	68 75 29 80 00       	push   $0x802975
+  800238:	6a 32                	push   $0x32
+  80023a:	68 f7 28 80 00       	push   $0x8028f7
+  80023f:	e8 74 00 00 00       	call   8002b8 <_panic>
+		panic("parent: region changed");
+  800244:	83 ec 04             	sub    $0x4,%esp
+  800247:	68 89 29 80 00       	push   $0x802989
+  80024c:	6a 34                	push   $0x34
+  80024e:	68 f7 28 80 00       	push   $0x8028f7
+  800253:	e8 60 00 00 00       	call   8002b8 <_panic>
+
+00800258 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800258:	55                   	push   %ebp
+  800259:	89 e5                	mov    %esp,%ebp
+  80025b:	56                   	push   %esi
+  80025c:	53                   	push   %ebx
+  80025d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800260:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800263:	e8 e7 0a 00 00       	call   800d4f <sys_getenvid>
+  800268:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80026d:	c1 e0 09             	shl    $0x9,%eax
+  800270:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800275:	a3 20 40 81 00       	mov    %eax,0x814020
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80027a:	85 db                	test   %ebx,%ebx
+  80027c:	7e 07                	jle    800285 <libmain+0x2d>
+		binaryname = argv[0];
+  80027e:	8b 06                	mov    (%esi),%eax
+  800280:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800285:	83 ec 08             	sub    $0x8,%esp
+  800288:	56                   	push   %esi
+  800289:	53                   	push   %ebx
+  80028a:	e8 a4 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80028f:	e8 0a 00 00 00       	call   80029e <exit>
+}
+  800294:	83 c4 10             	add    $0x10,%esp
+  800297:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80029a:	5b                   	pop    %ebx
+  80029b:	5e                   	pop    %esi
+  80029c:	5d                   	pop    %ebp
+  80029d:	c3                   	ret
+
+0080029e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80029e:	55                   	push   %ebp
+  80029f:	89 e5                	mov    %esp,%ebp
+  8002a1:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002a4:	e8 3e 11 00 00       	call   8013e7 <close_all>
+	sys_env_destroy(0);
+  8002a9:	83 ec 0c             	sub    $0xc,%esp
+  8002ac:	6a 00                	push   $0x0
+  8002ae:	e8 5b 0a 00 00       	call   800d0e <sys_env_destroy>
+}
+  8002b3:	83 c4 10             	add    $0x10,%esp
+  8002b6:	c9                   	leave
+  8002b7:	c3                   	ret
+
+008002b8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	56                   	push   %esi
+  8002bc:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002bd:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002c0:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8002c6:	e8 84 0a 00 00       	call   800d4f <sys_getenvid>
+  8002cb:	83 ec 0c             	sub    $0xc,%esp
+  8002ce:	ff 75 0c             	push   0xc(%ebp)
+  8002d1:	ff 75 08             	push   0x8(%ebp)
+  8002d4:	56                   	push   %esi
+  8002d5:	50                   	push   %eax
+  8002d6:	68 f8 29 80 00       	push   $0x8029f8
+  8002db:	e8 b3 00 00 00       	call   800393 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002e0:	83 c4 18             	add    $0x18,%esp
+  8002e3:	53                   	push   %ebx
+  8002e4:	ff 75 10             	push   0x10(%ebp)
+  8002e7:	e8 56 00 00 00       	call   800342 <vcprintf>
+	cprintf("\n");
+  8002ec:	c7 04 24 60 2e 80 00 	movl   $0x802e60,(%esp)
+  8002f3:	e8 9b 00 00 00       	call   800393 <cprintf>
+  8002f8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002fb:	cc                   	int3
+	while (1)
+  8002fc:	eb fd                	jmp    8002fb <_panic+0x43>
+
+008002fe <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002fe:	55                   	push   %ebp
+  8002ff:	89 e5                	mov    %esp,%ebp
+  800301:	53                   	push   %ebx
+  800302:	83 ec 04             	sub    $0x4,%esp
+  800305:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800308:	8b 13                	mov    (%ebx),%edx
+  80030a:	8d 42 01             	lea    0x1(%edx),%eax
+  80030d:	89 03                	mov    %eax,(%ebx)
+  80030f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800312:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800316:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80031b:	74 09                	je     800326 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80031d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800324:	c9                   	leave
+  800325:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800326:	83 ec 08             	sub    $0x8,%esp
+  800329:	68 ff 00 00 00       	push   $0xff
+  80032e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800331:	50                   	push   %eax
+  800332:	e8 7a 09 00 00       	call   800cb1 <sys_cputs>
+		b->idx = 0;
+  800337:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80033d:	83 c4 10             	add    $0x10,%esp
+  800340:	eb db                	jmp    80031d <putch+0x1f>
+
+00800342 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800342:	55                   	push   %ebp
+  800343:	89 e5                	mov    %esp,%ebp
+  800345:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80034b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800352:	00 00 00 
+	b.cnt = 0;
+  800355:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80035c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80035f:	ff 75 0c             	push   0xc(%ebp)
+  800362:	ff 75 08             	push   0x8(%ebp)
+  800365:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80036b:	50                   	push   %eax
+  80036c:	68 fe 02 80 00       	push   $0x8002fe
+  800371:	e8 14 01 00 00       	call   80048a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800376:	83 c4 08             	add    $0x8,%esp
+  800379:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80037f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800385:	50                   	push   %eax
+  800386:	e8 26 09 00 00       	call   800cb1 <sys_cputs>
+
+	return b.cnt;
+}
+  80038b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800391:	c9                   	leave
+  800392:	c3                   	ret
+
+00800393 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800399:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80039c:	50                   	push   %eax
+  80039d:	ff 75 08             	push   0x8(%ebp)
+  8003a0:	e8 9d ff ff ff       	call   800342 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003a5:	c9                   	leave
+  8003a6:	c3                   	ret
+
+008003a7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003a7:	55                   	push   %ebp
+  8003a8:	89 e5                	mov    %esp,%ebp
+  8003aa:	57                   	push   %edi
+  8003ab:	56                   	push   %esi
+  8003ac:	53                   	push   %ebx
+  8003ad:	83 ec 1c             	sub    $0x1c,%esp
+  8003b0:	89 c7                	mov    %eax,%edi
+  8003b2:	89 d6                	mov    %edx,%esi
+  8003b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003ba:	89 d1                	mov    %edx,%ecx
+  8003bc:	89 c2                	mov    %eax,%edx
+  8003be:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003c1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003c4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003c7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003cd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003d4:	39 c2                	cmp    %eax,%edx
+  8003d6:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003d9:	72 3e                	jb     800419 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003db:	83 ec 0c             	sub    $0xc,%esp
+  8003de:	ff 75 18             	push   0x18(%ebp)
+  8003e1:	83 eb 01             	sub    $0x1,%ebx
+  8003e4:	53                   	push   %ebx
+  8003e5:	50                   	push   %eax
+  8003e6:	83 ec 08             	sub    $0x8,%esp
+  8003e9:	ff 75 e4             	push   -0x1c(%ebp)
+  8003ec:	ff 75 e0             	push   -0x20(%ebp)
+  8003ef:	ff 75 dc             	push   -0x24(%ebp)
+  8003f2:	ff 75 d8             	push   -0x28(%ebp)
+  8003f5:	e8 76 21 00 00       	call   802570 <__udivdi3>
+  8003fa:	83 c4 18             	add    $0x18,%esp
+  8003fd:	52                   	push   %edx
+  8003fe:	50                   	push   %eax
+  8003ff:	89 f2                	mov    %esi,%edx
+  800401:	89 f8                	mov    %edi,%eax
+  800403:	e8 9f ff ff ff       	call   8003a7 <printnum>
+  800408:	83 c4 20             	add    $0x20,%esp
+  80040b:	eb 13                	jmp    800420 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80040d:	83 ec 08             	sub    $0x8,%esp
+  800410:	56                   	push   %esi
+  800411:	ff 75 18             	push   0x18(%ebp)
+  800414:	ff d7                	call   *%edi
+  800416:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800419:	83 eb 01             	sub    $0x1,%ebx
+  80041c:	85 db                	test   %ebx,%ebx
+  80041e:	7f ed                	jg     80040d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800420:	83 ec 08             	sub    $0x8,%esp
+  800423:	56                   	push   %esi
+  800424:	83 ec 04             	sub    $0x4,%esp
+  800427:	ff 75 e4             	push   -0x1c(%ebp)
+  80042a:	ff 75 e0             	push   -0x20(%ebp)
+  80042d:	ff 75 dc             	push   -0x24(%ebp)
+  800430:	ff 75 d8             	push   -0x28(%ebp)
+  800433:	e8 f8 21 00 00       	call   802630 <__umoddi3>
+  800438:	83 c4 14             	add    $0x14,%esp
+  80043b:	0f be 80 1b 2a 80 00 	movsbl 0x802a1b(%eax),%eax
+  800442:	50                   	push   %eax
+  800443:	ff d7                	call   *%edi
+}
+  800445:	83 c4 10             	add    $0x10,%esp
+  800448:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80044b:	5b                   	pop    %ebx
+  80044c:	5e                   	pop    %esi
+  80044d:	5f                   	pop    %edi
+  80044e:	5d                   	pop    %ebp
+  80044f:	c3                   	ret
+
+00800450 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800450:	55                   	push   %ebp
+  800451:	89 e5                	mov    %esp,%ebp
+  800453:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800456:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80045a:	8b 10                	mov    (%eax),%edx
+  80045c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80045f:	73 0a                	jae    80046b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800461:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800464:	89 08                	mov    %ecx,(%eax)
+  800466:	8b 45 08             	mov    0x8(%ebp),%eax
+  800469:	88 02                	mov    %al,(%edx)
+}
+  80046b:	5d                   	pop    %ebp
+  80046c:	c3                   	ret
+
+0080046d <printfmt>:
+{
+  80046d:	55                   	push   %ebp
+  80046e:	89 e5                	mov    %esp,%ebp
+  800470:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800473:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800476:	50                   	push   %eax
+  800477:	ff 75 10             	push   0x10(%ebp)
+  80047a:	ff 75 0c             	push   0xc(%ebp)
+  80047d:	ff 75 08             	push   0x8(%ebp)
+  800480:	e8 05 00 00 00       	call   80048a <vprintfmt>
+}
+  800485:	83 c4 10             	add    $0x10,%esp
+  800488:	c9                   	leave
+  800489:	c3                   	ret
+
+0080048a <vprintfmt>:
+{
+  80048a:	55                   	push   %ebp
+  80048b:	89 e5                	mov    %esp,%ebp
+  80048d:	57                   	push   %edi
+  80048e:	56                   	push   %esi
+  80048f:	53                   	push   %ebx
+  800490:	83 ec 2c             	sub    $0x2c,%esp
+  800493:	8b 75 08             	mov    0x8(%ebp),%esi
+  800496:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800499:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80049c:	eb 0a                	jmp    8004a8 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80049e:	83 ec 08             	sub    $0x8,%esp
+  8004a1:	53                   	push   %ebx
+  8004a2:	50                   	push   %eax
+  8004a3:	ff d6                	call   *%esi
+  8004a5:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004a8:	83 c7 01             	add    $0x1,%edi
+  8004ab:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8004af:	83 f8 25             	cmp    $0x25,%eax
+  8004b2:	74 0c                	je     8004c0 <vprintfmt+0x36>
+			if (ch == '\0')
+  8004b4:	85 c0                	test   %eax,%eax
+  8004b6:	75 e6                	jne    80049e <vprintfmt+0x14>
+}
+  8004b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004bb:	5b                   	pop    %ebx
+  8004bc:	5e                   	pop    %esi
+  8004bd:	5f                   	pop    %edi
+  8004be:	5d                   	pop    %ebp
+  8004bf:	c3                   	ret
+		padc = ' ';
+  8004c0:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004c4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004cb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004d2:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004de:	8d 47 01             	lea    0x1(%edi),%eax
+  8004e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004e4:	0f b6 17             	movzbl (%edi),%edx
+  8004e7:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004ea:	3c 55                	cmp    $0x55,%al
+  8004ec:	0f 87 cf 03 00 00    	ja     8008c1 <vprintfmt+0x437>
+  8004f2:	0f b6 c0             	movzbl %al,%eax
+  8004f5:	ff 24 85 60 2b 80 00 	jmp    *0x802b60(,%eax,4)
+  8004fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004ff:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800503:	eb d9                	jmp    8004de <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800505:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800508:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80050c:	eb d0                	jmp    8004de <vprintfmt+0x54>
+  80050e:	0f b6 d2             	movzbl %dl,%edx
+  800511:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800514:	b8 00 00 00 00       	mov    $0x0,%eax
+  800519:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80051c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80051f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800523:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800526:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800529:	83 f9 09             	cmp    $0x9,%ecx
+  80052c:	77 55                	ja     800583 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80052e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800531:	eb e9                	jmp    80051c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800533:	8b 45 14             	mov    0x14(%ebp),%eax
+  800536:	8b 00                	mov    (%eax),%eax
+  800538:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80053b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053e:	8d 40 04             	lea    0x4(%eax),%eax
+  800541:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800544:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800547:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80054b:	79 91                	jns    8004de <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80054d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800550:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800553:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80055a:	eb 82                	jmp    8004de <vprintfmt+0x54>
+			if (width < 0)
+  80055c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80055f:	85 d2                	test   %edx,%edx
+  800561:	b8 00 00 00 00       	mov    $0x0,%eax
+  800566:	0f 49 c2             	cmovns %edx,%eax
+  800569:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80056c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80056f:	e9 6a ff ff ff       	jmp    8004de <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800574:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800577:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80057e:	e9 5b ff ff ff       	jmp    8004de <vprintfmt+0x54>
+  800583:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800586:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800589:	eb bc                	jmp    800547 <vprintfmt+0xbd>
+			lflag++;
+  80058b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80058e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800591:	e9 48 ff ff ff       	jmp    8004de <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800596:	8b 45 14             	mov    0x14(%ebp),%eax
+  800599:	8d 78 04             	lea    0x4(%eax),%edi
+  80059c:	83 ec 08             	sub    $0x8,%esp
+  80059f:	53                   	push   %ebx
+  8005a0:	ff 30                	push   (%eax)
+  8005a2:	ff d6                	call   *%esi
+			break;
+  8005a4:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005a7:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8005aa:	e9 b1 02 00 00       	jmp    800860 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8005b5:	8b 10                	mov    (%eax),%edx
+  8005b7:	89 d0                	mov    %edx,%eax
+  8005b9:	f7 d8                	neg    %eax
+  8005bb:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005be:	83 f8 0f             	cmp    $0xf,%eax
+  8005c1:	7f 23                	jg     8005e6 <vprintfmt+0x15c>
+  8005c3:	8b 14 85 c0 2c 80 00 	mov    0x802cc0(,%eax,4),%edx
+  8005ca:	85 d2                	test   %edx,%edx
+  8005cc:	74 18                	je     8005e6 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005ce:	52                   	push   %edx
+  8005cf:	68 f5 2d 80 00       	push   $0x802df5
+  8005d4:	53                   	push   %ebx
+  8005d5:	56                   	push   %esi
+  8005d6:	e8 92 fe ff ff       	call   80046d <printfmt>
+  8005db:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005de:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005e1:	e9 7a 02 00 00       	jmp    800860 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8005e6:	50                   	push   %eax
+  8005e7:	68 33 2a 80 00       	push   $0x802a33
+  8005ec:	53                   	push   %ebx
+  8005ed:	56                   	push   %esi
+  8005ee:	e8 7a fe ff ff       	call   80046d <printfmt>
+  8005f3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005f6:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005f9:	e9 62 02 00 00       	jmp    800860 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	83 c0 04             	add    $0x4,%eax
+  800604:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80060c:	85 c9                	test   %ecx,%ecx
+  80060e:	b8 2c 2a 80 00       	mov    $0x802a2c,%eax
+  800613:	0f 45 c1             	cmovne %ecx,%eax
+  800616:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800619:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80061d:	7e 06                	jle    800625 <vprintfmt+0x19b>
+  80061f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800623:	75 0b                	jne    800630 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800625:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800628:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80062b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80062e:	eb 5c                	jmp    80068c <vprintfmt+0x202>
+  800630:	83 ec 08             	sub    $0x8,%esp
+  800633:	ff 75 d0             	push   -0x30(%ebp)
+  800636:	ff 75 cc             	push   -0x34(%ebp)
+  800639:	e8 20 03 00 00       	call   80095e <strnlen>
+  80063e:	89 c2                	mov    %eax,%edx
+  800640:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800643:	29 d0                	sub    %edx,%eax
+  800645:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800648:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80064c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80064f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800652:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800654:	eb 0e                	jmp    800664 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800656:	83 ec 08             	sub    $0x8,%esp
+  800659:	53                   	push   %ebx
+  80065a:	57                   	push   %edi
+  80065b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80065e:	83 ee 01             	sub    $0x1,%esi
+  800661:	83 c4 10             	add    $0x10,%esp
+  800664:	85 f6                	test   %esi,%esi
+  800666:	7f ee                	jg     800656 <vprintfmt+0x1cc>
+  800668:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80066b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80066e:	85 c0                	test   %eax,%eax
+  800670:	ba 00 00 00 00       	mov    $0x0,%edx
+  800675:	0f 49 d0             	cmovns %eax,%edx
+  800678:	29 d0                	sub    %edx,%eax
+  80067a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80067d:	eb a6                	jmp    800625 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80067f:	83 ec 08             	sub    $0x8,%esp
+  800682:	53                   	push   %ebx
+  800683:	52                   	push   %edx
+  800684:	ff 55 08             	call   *0x8(%ebp)
+  800687:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80068a:	89 f1                	mov    %esi,%ecx
+  80068c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80068f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800693:	0f be d0             	movsbl %al,%edx
+  800696:	85 d2                	test   %edx,%edx
+  800698:	74 28                	je     8006c2 <vprintfmt+0x238>
+  80069a:	85 ff                	test   %edi,%edi
+  80069c:	78 05                	js     8006a3 <vprintfmt+0x219>
+  80069e:	83 ef 01             	sub    $0x1,%edi
+  8006a1:	78 30                	js     8006d3 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006a3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006a7:	74 d6                	je     80067f <vprintfmt+0x1f5>
+  8006a9:	0f be c0             	movsbl %al,%eax
+  8006ac:	83 e8 20             	sub    $0x20,%eax
+  8006af:	83 f8 5e             	cmp    $0x5e,%eax
+  8006b2:	76 cb                	jbe    80067f <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8006b4:	83 ec 08             	sub    $0x8,%esp
+  8006b7:	53                   	push   %ebx
+  8006b8:	6a 3f                	push   $0x3f
+  8006ba:	ff 55 08             	call   *0x8(%ebp)
+  8006bd:	83 c4 10             	add    $0x10,%esp
+  8006c0:	eb c8                	jmp    80068a <vprintfmt+0x200>
+  8006c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006c5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006c8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006cb:	01 d0                	add    %edx,%eax
+  8006cd:	29 c8                	sub    %ecx,%eax
+  8006cf:	89 c7                	mov    %eax,%edi
+  8006d1:	eb 13                	jmp    8006e6 <vprintfmt+0x25c>
+  8006d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006d6:	eb ed                	jmp    8006c5 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006d8:	83 ec 08             	sub    $0x8,%esp
+  8006db:	53                   	push   %ebx
+  8006dc:	6a 20                	push   $0x20
+  8006de:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006e0:	83 ef 01             	sub    $0x1,%edi
+  8006e3:	83 c4 10             	add    $0x10,%esp
+  8006e6:	85 ff                	test   %edi,%edi
+  8006e8:	7f ee                	jg     8006d8 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006ea:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f0:	e9 6b 01 00 00       	jmp    800860 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8006f5:	83 f9 01             	cmp    $0x1,%ecx
+  8006f8:	7f 1f                	jg     800719 <vprintfmt+0x28f>
+	else if (lflag)
+  8006fa:	85 c9                	test   %ecx,%ecx
+  8006fc:	74 67                	je     800765 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 00                	mov    (%eax),%eax
+  800703:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800706:	89 c1                	mov    %eax,%ecx
+  800708:	c1 f9 1f             	sar    $0x1f,%ecx
+  80070b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80070e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800711:	8d 40 04             	lea    0x4(%eax),%eax
+  800714:	89 45 14             	mov    %eax,0x14(%ebp)
+  800717:	eb 17                	jmp    800730 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 50 04             	mov    0x4(%eax),%edx
+  80071f:	8b 00                	mov    (%eax),%eax
+  800721:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800724:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072a:	8d 40 08             	lea    0x8(%eax),%eax
+  80072d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800730:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800733:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800736:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80073b:	85 c9                	test   %ecx,%ecx
+  80073d:	0f 89 03 01 00 00    	jns    800846 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800743:	83 ec 08             	sub    $0x8,%esp
+  800746:	53                   	push   %ebx
+  800747:	6a 2d                	push   $0x2d
+  800749:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80074b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80074e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800751:	f7 da                	neg    %edx
+  800753:	83 d1 00             	adc    $0x0,%ecx
+  800756:	f7 d9                	neg    %ecx
+  800758:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80075b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800760:	e9 e1 00 00 00       	jmp    800846 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800765:	8b 45 14             	mov    0x14(%ebp),%eax
+  800768:	8b 00                	mov    (%eax),%eax
+  80076a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80076d:	89 c1                	mov    %eax,%ecx
+  80076f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800772:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800775:	8b 45 14             	mov    0x14(%ebp),%eax
+  800778:	8d 40 04             	lea    0x4(%eax),%eax
+  80077b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80077e:	eb b0                	jmp    800730 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800780:	83 f9 01             	cmp    $0x1,%ecx
+  800783:	7f 1e                	jg     8007a3 <vprintfmt+0x319>
+	else if (lflag)
+  800785:	85 c9                	test   %ecx,%ecx
+  800787:	74 32                	je     8007bb <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800789:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078c:	8b 10                	mov    (%eax),%edx
+  80078e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800793:	8d 40 04             	lea    0x4(%eax),%eax
+  800796:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800799:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80079e:	e9 a3 00 00 00       	jmp    800846 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a6:	8b 10                	mov    (%eax),%edx
+  8007a8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ab:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007b1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8007b6:	e9 8b 00 00 00       	jmp    800846 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007be:	8b 10                	mov    (%eax),%edx
+  8007c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007d0:	eb 74                	jmp    800846 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8007d2:	83 f9 01             	cmp    $0x1,%ecx
+  8007d5:	7f 1b                	jg     8007f2 <vprintfmt+0x368>
+	else if (lflag)
+  8007d7:	85 c9                	test   %ecx,%ecx
+  8007d9:	74 2c                	je     800807 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8007db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007de:	8b 10                	mov    (%eax),%edx
+  8007e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007eb:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8007f0:	eb 54                	jmp    800846 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f5:	8b 10                	mov    (%eax),%edx
+  8007f7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007fa:	8d 40 08             	lea    0x8(%eax),%eax
+  8007fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800800:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800805:	eb 3f                	jmp    800846 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800807:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080a:	8b 10                	mov    (%eax),%edx
+  80080c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800811:	8d 40 04             	lea    0x4(%eax),%eax
+  800814:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800817:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80081c:	eb 28                	jmp    800846 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80081e:	83 ec 08             	sub    $0x8,%esp
+  800821:	53                   	push   %ebx
+  800822:	6a 30                	push   $0x30
+  800824:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800826:	83 c4 08             	add    $0x8,%esp
+  800829:	53                   	push   %ebx
+  80082a:	6a 78                	push   $0x78
+  80082c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80082e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800831:	8b 10                	mov    (%eax),%edx
+  800833:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800838:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80083b:	8d 40 04             	lea    0x4(%eax),%eax
+  80083e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800841:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800846:	83 ec 0c             	sub    $0xc,%esp
+  800849:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80084d:	50                   	push   %eax
+  80084e:	ff 75 e0             	push   -0x20(%ebp)
+  800851:	57                   	push   %edi
+  800852:	51                   	push   %ecx
+  800853:	52                   	push   %edx
+  800854:	89 da                	mov    %ebx,%edx
+  800856:	89 f0                	mov    %esi,%eax
+  800858:	e8 4a fb ff ff       	call   8003a7 <printnum>
+			break;
+  80085d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800860:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800863:	e9 40 fc ff ff       	jmp    8004a8 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800868:	83 f9 01             	cmp    $0x1,%ecx
+  80086b:	7f 1b                	jg     800888 <vprintfmt+0x3fe>
+	else if (lflag)
+  80086d:	85 c9                	test   %ecx,%ecx
+  80086f:	74 2c                	je     80089d <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800871:	8b 45 14             	mov    0x14(%ebp),%eax
+  800874:	8b 10                	mov    (%eax),%edx
+  800876:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80087b:	8d 40 04             	lea    0x4(%eax),%eax
+  80087e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800881:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800886:	eb be                	jmp    800846 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800888:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088b:	8b 10                	mov    (%eax),%edx
+  80088d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800890:	8d 40 08             	lea    0x8(%eax),%eax
+  800893:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800896:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80089b:	eb a9                	jmp    800846 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80089d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a0:	8b 10                	mov    (%eax),%edx
+  8008a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8008aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008ad:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8008b2:	eb 92                	jmp    800846 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8008b4:	83 ec 08             	sub    $0x8,%esp
+  8008b7:	53                   	push   %ebx
+  8008b8:	6a 25                	push   $0x25
+  8008ba:	ff d6                	call   *%esi
+			break;
+  8008bc:	83 c4 10             	add    $0x10,%esp
+  8008bf:	eb 9f                	jmp    800860 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8008c1:	83 ec 08             	sub    $0x8,%esp
+  8008c4:	53                   	push   %ebx
+  8008c5:	6a 25                	push   $0x25
+  8008c7:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008c9:	83 c4 10             	add    $0x10,%esp
+  8008cc:	89 f8                	mov    %edi,%eax
+  8008ce:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008d2:	74 05                	je     8008d9 <vprintfmt+0x44f>
+  8008d4:	83 e8 01             	sub    $0x1,%eax
+  8008d7:	eb f5                	jmp    8008ce <vprintfmt+0x444>
+  8008d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008dc:	eb 82                	jmp    800860 <vprintfmt+0x3d6>
+
+008008de <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008de:	55                   	push   %ebp
+  8008df:	89 e5                	mov    %esp,%ebp
+  8008e1:	83 ec 18             	sub    $0x18,%esp
+  8008e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008ea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008ed:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008f1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008f4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008fb:	85 c0                	test   %eax,%eax
+  8008fd:	74 26                	je     800925 <vsnprintf+0x47>
+  8008ff:	85 d2                	test   %edx,%edx
+  800901:	7e 22                	jle    800925 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800903:	ff 75 14             	push   0x14(%ebp)
+  800906:	ff 75 10             	push   0x10(%ebp)
+  800909:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80090c:	50                   	push   %eax
+  80090d:	68 50 04 80 00       	push   $0x800450
+  800912:	e8 73 fb ff ff       	call   80048a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800917:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80091a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80091d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800920:	83 c4 10             	add    $0x10,%esp
+}
+  800923:	c9                   	leave
+  800924:	c3                   	ret
+		return -E_INVAL;
+  800925:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80092a:	eb f7                	jmp    800923 <vsnprintf+0x45>
+
+0080092c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80092c:	55                   	push   %ebp
+  80092d:	89 e5                	mov    %esp,%ebp
+  80092f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800932:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800935:	50                   	push   %eax
+  800936:	ff 75 10             	push   0x10(%ebp)
+  800939:	ff 75 0c             	push   0xc(%ebp)
+  80093c:	ff 75 08             	push   0x8(%ebp)
+  80093f:	e8 9a ff ff ff       	call   8008de <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800944:	c9                   	leave
+  800945:	c3                   	ret
+
+00800946 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800946:	55                   	push   %ebp
+  800947:	89 e5                	mov    %esp,%ebp
+  800949:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80094c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800951:	eb 03                	jmp    800956 <strlen+0x10>
+		n++;
+  800953:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800956:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80095a:	75 f7                	jne    800953 <strlen+0xd>
+	return n;
+}
+  80095c:	5d                   	pop    %ebp
+  80095d:	c3                   	ret
+
+0080095e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80095e:	55                   	push   %ebp
+  80095f:	89 e5                	mov    %esp,%ebp
+  800961:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800964:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096c:	eb 03                	jmp    800971 <strnlen+0x13>
+		n++;
+  80096e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800971:	39 d0                	cmp    %edx,%eax
+  800973:	74 08                	je     80097d <strnlen+0x1f>
+  800975:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800979:	75 f3                	jne    80096e <strnlen+0x10>
+  80097b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80097d:	89 d0                	mov    %edx,%eax
+  80097f:	5d                   	pop    %ebp
+  800980:	c3                   	ret
+
+00800981 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800981:	55                   	push   %ebp
+  800982:	89 e5                	mov    %esp,%ebp
+  800984:	53                   	push   %ebx
+  800985:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800988:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80098b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800990:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800994:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800997:	83 c0 01             	add    $0x1,%eax
+  80099a:	84 d2                	test   %dl,%dl
+  80099c:	75 f2                	jne    800990 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80099e:	89 c8                	mov    %ecx,%eax
+  8009a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a3:	c9                   	leave
+  8009a4:	c3                   	ret
+
+008009a5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	53                   	push   %ebx
+  8009a9:	83 ec 10             	sub    $0x10,%esp
+  8009ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009af:	53                   	push   %ebx
+  8009b0:	e8 91 ff ff ff       	call   800946 <strlen>
+  8009b5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009b8:	ff 75 0c             	push   0xc(%ebp)
+  8009bb:	01 d8                	add    %ebx,%eax
+  8009bd:	50                   	push   %eax
+  8009be:	e8 be ff ff ff       	call   800981 <strcpy>
+	return dst;
+}
+  8009c3:	89 d8                	mov    %ebx,%eax
+  8009c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c8:	c9                   	leave
+  8009c9:	c3                   	ret
+
+008009ca <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009ca:	55                   	push   %ebp
+  8009cb:	89 e5                	mov    %esp,%ebp
+  8009cd:	56                   	push   %esi
+  8009ce:	53                   	push   %ebx
+  8009cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009d5:	89 f3                	mov    %esi,%ebx
+  8009d7:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009da:	89 f0                	mov    %esi,%eax
+  8009dc:	eb 0f                	jmp    8009ed <strncpy+0x23>
+		*dst++ = *src;
+  8009de:	83 c0 01             	add    $0x1,%eax
+  8009e1:	0f b6 0a             	movzbl (%edx),%ecx
+  8009e4:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009e7:	80 f9 01             	cmp    $0x1,%cl
+  8009ea:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009ed:	39 d8                	cmp    %ebx,%eax
+  8009ef:	75 ed                	jne    8009de <strncpy+0x14>
+	}
+	return ret;
+}
+  8009f1:	89 f0                	mov    %esi,%eax
+  8009f3:	5b                   	pop    %ebx
+  8009f4:	5e                   	pop    %esi
+  8009f5:	5d                   	pop    %ebp
+  8009f6:	c3                   	ret
+
+008009f7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	56                   	push   %esi
+  8009fb:	53                   	push   %ebx
+  8009fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a02:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a05:	89 f0                	mov    %esi,%eax
+  800a07:	85 d2                	test   %edx,%edx
+  800a09:	74 21                	je     800a2c <strlcpy+0x35>
+  800a0b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a0f:	89 f2                	mov    %esi,%edx
+  800a11:	eb 09                	jmp    800a1c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a13:	83 c1 01             	add    $0x1,%ecx
+  800a16:	83 c2 01             	add    $0x1,%edx
+  800a19:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a1c:	39 c2                	cmp    %eax,%edx
+  800a1e:	74 09                	je     800a29 <strlcpy+0x32>
+  800a20:	0f b6 19             	movzbl (%ecx),%ebx
+  800a23:	84 db                	test   %bl,%bl
+  800a25:	75 ec                	jne    800a13 <strlcpy+0x1c>
+  800a27:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a29:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a2c:	29 f0                	sub    %esi,%eax
+}
+  800a2e:	5b                   	pop    %ebx
+  800a2f:	5e                   	pop    %esi
+  800a30:	5d                   	pop    %ebp
+  800a31:	c3                   	ret
+
+00800a32 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a38:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a3b:	eb 06                	jmp    800a43 <strcmp+0x11>
+		p++, q++;
+  800a3d:	83 c1 01             	add    $0x1,%ecx
+  800a40:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a43:	0f b6 01             	movzbl (%ecx),%eax
+  800a46:	84 c0                	test   %al,%al
+  800a48:	74 04                	je     800a4e <strcmp+0x1c>
+  800a4a:	3a 02                	cmp    (%edx),%al
+  800a4c:	74 ef                	je     800a3d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a4e:	0f b6 c0             	movzbl %al,%eax
+  800a51:	0f b6 12             	movzbl (%edx),%edx
+  800a54:	29 d0                	sub    %edx,%eax
+}
+  800a56:	5d                   	pop    %ebp
+  800a57:	c3                   	ret
+
+00800a58 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	53                   	push   %ebx
+  800a5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a62:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a65:	eb 09                	jmp    800a70 <strncmp+0x18>
+		n--, p++, q++;
+  800a67:	83 ea 01             	sub    $0x1,%edx
+  800a6a:	83 c0 01             	add    $0x1,%eax
+  800a6d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a70:	85 d2                	test   %edx,%edx
+  800a72:	74 18                	je     800a8c <strncmp+0x34>
+  800a74:	0f b6 18             	movzbl (%eax),%ebx
+  800a77:	84 db                	test   %bl,%bl
+  800a79:	74 04                	je     800a7f <strncmp+0x27>
+  800a7b:	3a 19                	cmp    (%ecx),%bl
+  800a7d:	74 e8                	je     800a67 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a7f:	0f b6 00             	movzbl (%eax),%eax
+  800a82:	0f b6 11             	movzbl (%ecx),%edx
+  800a85:	29 d0                	sub    %edx,%eax
+}
+  800a87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a8a:	c9                   	leave
+  800a8b:	c3                   	ret
+		return 0;
+  800a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a91:	eb f4                	jmp    800a87 <strncmp+0x2f>
+
+00800a93 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a93:	55                   	push   %ebp
+  800a94:	89 e5                	mov    %esp,%ebp
+  800a96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a99:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a9d:	eb 03                	jmp    800aa2 <strchr+0xf>
+  800a9f:	83 c0 01             	add    $0x1,%eax
+  800aa2:	0f b6 10             	movzbl (%eax),%edx
+  800aa5:	84 d2                	test   %dl,%dl
+  800aa7:	74 06                	je     800aaf <strchr+0x1c>
+		if (*s == c)
+  800aa9:	38 ca                	cmp    %cl,%dl
+  800aab:	75 f2                	jne    800a9f <strchr+0xc>
+  800aad:	eb 05                	jmp    800ab4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ab4:	5d                   	pop    %ebp
+  800ab5:	c3                   	ret
+
+00800ab6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ab6:	55                   	push   %ebp
+  800ab7:	89 e5                	mov    %esp,%ebp
+  800ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800abc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ac0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800ac3:	38 ca                	cmp    %cl,%dl
+  800ac5:	74 09                	je     800ad0 <strfind+0x1a>
+  800ac7:	84 d2                	test   %dl,%dl
+  800ac9:	74 05                	je     800ad0 <strfind+0x1a>
+	for (; *s; s++)
+  800acb:	83 c0 01             	add    $0x1,%eax
+  800ace:	eb f0                	jmp    800ac0 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800ad0:	5d                   	pop    %ebp
+  800ad1:	c3                   	ret
+
+00800ad2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	57                   	push   %edi
+  800ad6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ad9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800adc:	85 c9                	test   %ecx,%ecx
+  800ade:	74 20                	je     800b00 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ae0:	89 f8                	mov    %edi,%eax
+  800ae2:	09 c8                	or     %ecx,%eax
+  800ae4:	a8 03                	test   $0x3,%al
+  800ae6:	75 12                	jne    800afa <memset+0x28>
+		c &= 0xFF;
+  800ae8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800aec:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800af2:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800af5:	fc                   	cld
+  800af6:	f3 ab                	rep stos %eax,%es:(%edi)
+  800af8:	eb 06                	jmp    800b00 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800afa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800afd:	fc                   	cld
+  800afe:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b00:	89 f8                	mov    %edi,%eax
+  800b02:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b05:	c9                   	leave
+  800b06:	c3                   	ret
+
+00800b07 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b07:	55                   	push   %ebp
+  800b08:	89 e5                	mov    %esp,%ebp
+  800b0a:	57                   	push   %edi
+  800b0b:	56                   	push   %esi
+  800b0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b12:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b15:	39 c6                	cmp    %eax,%esi
+  800b17:	73 32                	jae    800b4b <memmove+0x44>
+  800b19:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b1c:	39 d0                	cmp    %edx,%eax
+  800b1e:	73 2b                	jae    800b4b <memmove+0x44>
+		s += n;
+		d += n;
+  800b20:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b23:	89 d6                	mov    %edx,%esi
+  800b25:	09 fe                	or     %edi,%esi
+  800b27:	09 ce                	or     %ecx,%esi
+  800b29:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b2f:	75 0e                	jne    800b3f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b31:	83 ef 04             	sub    $0x4,%edi
+  800b34:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b37:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b3a:	fd                   	std
+  800b3b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b3d:	eb 09                	jmp    800b48 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b3f:	83 ef 01             	sub    $0x1,%edi
+  800b42:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b45:	fd                   	std
+  800b46:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b48:	fc                   	cld
+  800b49:	eb 1a                	jmp    800b65 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b4b:	89 f2                	mov    %esi,%edx
+  800b4d:	09 c2                	or     %eax,%edx
+  800b4f:	09 ca                	or     %ecx,%edx
+  800b51:	f6 c2 03             	test   $0x3,%dl
+  800b54:	75 0a                	jne    800b60 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b56:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b59:	89 c7                	mov    %eax,%edi
+  800b5b:	fc                   	cld
+  800b5c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b5e:	eb 05                	jmp    800b65 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b60:	89 c7                	mov    %eax,%edi
+  800b62:	fc                   	cld
+  800b63:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b65:	5e                   	pop    %esi
+  800b66:	5f                   	pop    %edi
+  800b67:	5d                   	pop    %ebp
+  800b68:	c3                   	ret
+
+00800b69 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b69:	55                   	push   %ebp
+  800b6a:	89 e5                	mov    %esp,%ebp
+  800b6c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b6f:	ff 75 10             	push   0x10(%ebp)
+  800b72:	ff 75 0c             	push   0xc(%ebp)
+  800b75:	ff 75 08             	push   0x8(%ebp)
+  800b78:	e8 8a ff ff ff       	call   800b07 <memmove>
+}
+  800b7d:	c9                   	leave
+  800b7e:	c3                   	ret
+
+00800b7f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	56                   	push   %esi
+  800b83:	53                   	push   %ebx
+  800b84:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b87:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b8a:	89 c6                	mov    %eax,%esi
+  800b8c:	03 75 10             	add    0x10(%ebp),%esi
+  800b8f:	eb 06                	jmp    800b97 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b91:	83 c0 01             	add    $0x1,%eax
+  800b94:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b97:	39 f0                	cmp    %esi,%eax
+  800b99:	74 14                	je     800baf <memcmp+0x30>
+		if (*s1 != *s2)
+  800b9b:	0f b6 08             	movzbl (%eax),%ecx
+  800b9e:	0f b6 1a             	movzbl (%edx),%ebx
+  800ba1:	38 d9                	cmp    %bl,%cl
+  800ba3:	74 ec                	je     800b91 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ba5:	0f b6 c1             	movzbl %cl,%eax
+  800ba8:	0f b6 db             	movzbl %bl,%ebx
+  800bab:	29 d8                	sub    %ebx,%eax
+  800bad:	eb 05                	jmp    800bb4 <memcmp+0x35>
+	}
+
+	return 0;
+  800baf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bb4:	5b                   	pop    %ebx
+  800bb5:	5e                   	pop    %esi
+  800bb6:	5d                   	pop    %ebp
+  800bb7:	c3                   	ret
+
+00800bb8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bc1:	89 c2                	mov    %eax,%edx
+  800bc3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bc6:	eb 03                	jmp    800bcb <memfind+0x13>
+  800bc8:	83 c0 01             	add    $0x1,%eax
+  800bcb:	39 d0                	cmp    %edx,%eax
+  800bcd:	73 04                	jae    800bd3 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bcf:	38 08                	cmp    %cl,(%eax)
+  800bd1:	75 f5                	jne    800bc8 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+
+00800bd5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bd5:	55                   	push   %ebp
+  800bd6:	89 e5                	mov    %esp,%ebp
+  800bd8:	57                   	push   %edi
+  800bd9:	56                   	push   %esi
+  800bda:	53                   	push   %ebx
+  800bdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800be1:	eb 03                	jmp    800be6 <strtol+0x11>
+		s++;
+  800be3:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800be6:	0f b6 02             	movzbl (%edx),%eax
+  800be9:	3c 20                	cmp    $0x20,%al
+  800beb:	74 f6                	je     800be3 <strtol+0xe>
+  800bed:	3c 09                	cmp    $0x9,%al
+  800bef:	74 f2                	je     800be3 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bf1:	3c 2b                	cmp    $0x2b,%al
+  800bf3:	74 2a                	je     800c1f <strtol+0x4a>
+	int neg = 0;
+  800bf5:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bfa:	3c 2d                	cmp    $0x2d,%al
+  800bfc:	74 2b                	je     800c29 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bfe:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c04:	75 0f                	jne    800c15 <strtol+0x40>
+  800c06:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c09:	74 28                	je     800c33 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c0b:	85 db                	test   %ebx,%ebx
+  800c0d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c12:	0f 44 d8             	cmove  %eax,%ebx
+  800c15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c1a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c1d:	eb 46                	jmp    800c65 <strtol+0x90>
+		s++;
+  800c1f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c22:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c27:	eb d5                	jmp    800bfe <strtol+0x29>
+		s++, neg = 1;
+  800c29:	83 c2 01             	add    $0x1,%edx
+  800c2c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c31:	eb cb                	jmp    800bfe <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c33:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c37:	74 0e                	je     800c47 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c39:	85 db                	test   %ebx,%ebx
+  800c3b:	75 d8                	jne    800c15 <strtol+0x40>
+		s++, base = 8;
+  800c3d:	83 c2 01             	add    $0x1,%edx
+  800c40:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c45:	eb ce                	jmp    800c15 <strtol+0x40>
+		s += 2, base = 16;
+  800c47:	83 c2 02             	add    $0x2,%edx
+  800c4a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c4f:	eb c4                	jmp    800c15 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c51:	0f be c0             	movsbl %al,%eax
+  800c54:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c57:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c5a:	7d 3a                	jge    800c96 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c5c:	83 c2 01             	add    $0x1,%edx
+  800c5f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c63:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c65:	0f b6 02             	movzbl (%edx),%eax
+  800c68:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c6b:	89 f3                	mov    %esi,%ebx
+  800c6d:	80 fb 09             	cmp    $0x9,%bl
+  800c70:	76 df                	jbe    800c51 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c72:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c75:	89 f3                	mov    %esi,%ebx
+  800c77:	80 fb 19             	cmp    $0x19,%bl
+  800c7a:	77 08                	ja     800c84 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c7c:	0f be c0             	movsbl %al,%eax
+  800c7f:	83 e8 57             	sub    $0x57,%eax
+  800c82:	eb d3                	jmp    800c57 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c84:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c87:	89 f3                	mov    %esi,%ebx
+  800c89:	80 fb 19             	cmp    $0x19,%bl
+  800c8c:	77 08                	ja     800c96 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c8e:	0f be c0             	movsbl %al,%eax
+  800c91:	83 e8 37             	sub    $0x37,%eax
+  800c94:	eb c1                	jmp    800c57 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c96:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c9a:	74 05                	je     800ca1 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c9f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ca1:	89 c8                	mov    %ecx,%eax
+  800ca3:	f7 d8                	neg    %eax
+  800ca5:	85 ff                	test   %edi,%edi
+  800ca7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800caa:	89 c8                	mov    %ecx,%eax
+  800cac:	5b                   	pop    %ebx
+  800cad:	5e                   	pop    %esi
+  800cae:	5f                   	pop    %edi
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+
+00800cb1 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cb1:	55                   	push   %ebp
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	57                   	push   %edi
+  800cb5:	56                   	push   %esi
+  800cb6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc2:	89 c3                	mov    %eax,%ebx
+  800cc4:	89 c7                	mov    %eax,%edi
+  800cc6:	89 c6                	mov    %eax,%esi
+  800cc8:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cca:	5b                   	pop    %ebx
+  800ccb:	5e                   	pop    %esi
+  800ccc:	5f                   	pop    %edi
+  800ccd:	5d                   	pop    %ebp
+  800cce:	c3                   	ret
+
+00800ccf <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	57                   	push   %edi
+  800cd3:	56                   	push   %esi
+  800cd4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cda:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cdf:	89 d1                	mov    %edx,%ecx
+  800ce1:	89 d3                	mov    %edx,%ebx
+  800ce3:	89 d7                	mov    %edx,%edi
+  800ce5:	89 d6                	mov    %edx,%esi
+  800ce7:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ce9:	5b                   	pop    %ebx
+  800cea:	5e                   	pop    %esi
+  800ceb:	5f                   	pop    %edi
+  800cec:	5d                   	pop    %ebp
+  800ced:	c3                   	ret
+
+00800cee <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800cee:	55                   	push   %ebp
+  800cef:	89 e5                	mov    %esp,%ebp
+  800cf1:	57                   	push   %edi
+  800cf2:	56                   	push   %esi
+  800cf3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cf4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d01:	89 cb                	mov    %ecx,%ebx
+  800d03:	89 cf                	mov    %ecx,%edi
+  800d05:	89 ce                	mov    %ecx,%esi
+  800d07:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800d09:	5b                   	pop    %ebx
+  800d0a:	5e                   	pop    %esi
+  800d0b:	5f                   	pop    %edi
+  800d0c:	5d                   	pop    %ebp
+  800d0d:	c3                   	ret
+
+00800d0e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	57                   	push   %edi
+  800d12:	56                   	push   %esi
+  800d13:	53                   	push   %ebx
+  800d14:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d24:	89 cb                	mov    %ecx,%ebx
+  800d26:	89 cf                	mov    %ecx,%edi
+  800d28:	89 ce                	mov    %ecx,%esi
+  800d2a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d2c:	85 c0                	test   %eax,%eax
+  800d2e:	7f 08                	jg     800d38 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d33:	5b                   	pop    %ebx
+  800d34:	5e                   	pop    %esi
+  800d35:	5f                   	pop    %edi
+  800d36:	5d                   	pop    %ebp
+  800d37:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d38:	83 ec 0c             	sub    $0xc,%esp
+  800d3b:	50                   	push   %eax
+  800d3c:	6a 03                	push   $0x3
+  800d3e:	68 1f 2d 80 00       	push   $0x802d1f
+  800d43:	6a 23                	push   $0x23
+  800d45:	68 3c 2d 80 00       	push   $0x802d3c
+  800d4a:	e8 69 f5 ff ff       	call   8002b8 <_panic>
+
+00800d4f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	57                   	push   %edi
+  800d53:	56                   	push   %esi
+  800d54:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d5f:	89 d1                	mov    %edx,%ecx
+  800d61:	89 d3                	mov    %edx,%ebx
+  800d63:	89 d7                	mov    %edx,%edi
+  800d65:	89 d6                	mov    %edx,%esi
+  800d67:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d69:	5b                   	pop    %ebx
+  800d6a:	5e                   	pop    %esi
+  800d6b:	5f                   	pop    %edi
+  800d6c:	5d                   	pop    %ebp
+  800d6d:	c3                   	ret
+
+00800d6e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	57                   	push   %edi
+  800d72:	56                   	push   %esi
+  800d73:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d79:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d7e:	89 d1                	mov    %edx,%ecx
+  800d80:	89 d3                	mov    %edx,%ebx
+  800d82:	89 d7                	mov    %edx,%edi
+  800d84:	89 d6                	mov    %edx,%esi
+  800d86:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d88:	5b                   	pop    %ebx
+  800d89:	5e                   	pop    %esi
+  800d8a:	5f                   	pop    %edi
+  800d8b:	5d                   	pop    %ebp
+  800d8c:	c3                   	ret
+
+00800d8d <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800d8d:	55                   	push   %ebp
+  800d8e:	89 e5                	mov    %esp,%ebp
+  800d90:	57                   	push   %edi
+  800d91:	56                   	push   %esi
+  800d92:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d93:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d98:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d9d:	89 d1                	mov    %edx,%ecx
+  800d9f:	89 d3                	mov    %edx,%ebx
+  800da1:	89 d7                	mov    %edx,%edi
+  800da3:	89 d6                	mov    %edx,%esi
+  800da5:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800da7:	5b                   	pop    %ebx
+  800da8:	5e                   	pop    %esi
+  800da9:	5f                   	pop    %edi
+  800daa:	5d                   	pop    %ebp
+  800dab:	c3                   	ret
+
+00800dac <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800dac:	55                   	push   %ebp
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	57                   	push   %edi
+  800db0:	56                   	push   %esi
+  800db1:	53                   	push   %ebx
+  800db2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc0:	b8 15 00 00 00       	mov    $0x15,%eax
+  800dc5:	89 df                	mov    %ebx,%edi
+  800dc7:	89 de                	mov    %ebx,%esi
+  800dc9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dcb:	85 c0                	test   %eax,%eax
+  800dcd:	7f 08                	jg     800dd7 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800dcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd2:	5b                   	pop    %ebx
+  800dd3:	5e                   	pop    %esi
+  800dd4:	5f                   	pop    %edi
+  800dd5:	5d                   	pop    %ebp
+  800dd6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd7:	83 ec 0c             	sub    $0xc,%esp
+  800dda:	50                   	push   %eax
+  800ddb:	6a 15                	push   $0x15
+  800ddd:	68 1f 2d 80 00       	push   $0x802d1f
+  800de2:	6a 23                	push   $0x23
+  800de4:	68 3c 2d 80 00       	push   $0x802d3c
+  800de9:	e8 ca f4 ff ff       	call   8002b8 <_panic>
+
+00800dee <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dee:	55                   	push   %ebp
+  800def:	89 e5                	mov    %esp,%ebp
+  800df1:	57                   	push   %edi
+  800df2:	56                   	push   %esi
+  800df3:	53                   	push   %ebx
+  800df4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df7:	be 00 00 00 00       	mov    $0x0,%esi
+  800dfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e02:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0a:	89 f7                	mov    %esi,%edi
+  800e0c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e0e:	85 c0                	test   %eax,%eax
+  800e10:	7f 08                	jg     800e1a <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e15:	5b                   	pop    %ebx
+  800e16:	5e                   	pop    %esi
+  800e17:	5f                   	pop    %edi
+  800e18:	5d                   	pop    %ebp
+  800e19:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1a:	83 ec 0c             	sub    $0xc,%esp
+  800e1d:	50                   	push   %eax
+  800e1e:	6a 05                	push   $0x5
+  800e20:	68 1f 2d 80 00       	push   $0x802d1f
+  800e25:	6a 23                	push   $0x23
+  800e27:	68 3c 2d 80 00       	push   $0x802d3c
+  800e2c:	e8 87 f4 ff ff       	call   8002b8 <_panic>
+
+00800e31 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e3a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e45:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4d:	89 f7                	mov    %esi,%edi
+  800e4f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e51:	85 c0                	test   %eax,%eax
+  800e53:	7f 08                	jg     800e5d <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+  800e60:	50                   	push   %eax
+  800e61:	6a 06                	push   $0x6
+  800e63:	68 1f 2d 80 00       	push   $0x802d1f
+  800e68:	6a 23                	push   $0x23
+  800e6a:	68 3c 2d 80 00       	push   $0x802d3c
+  800e6f:	e8 44 f4 ff ff       	call   8002b8 <_panic>
+
+00800e74 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	57                   	push   %edi
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+  800e7a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e83:	b8 07 00 00 00       	mov    $0x7,%eax
+  800e88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e91:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	7f 08                	jg     800e9f <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5f                   	pop    %edi
+  800e9d:	5d                   	pop    %ebp
+  800e9e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+  800ea2:	50                   	push   %eax
+  800ea3:	6a 07                	push   $0x7
+  800ea5:	68 1f 2d 80 00       	push   $0x802d1f
+  800eaa:	6a 23                	push   $0x23
+  800eac:	68 3c 2d 80 00       	push   $0x802d3c
+  800eb1:	e8 02 f4 ff ff       	call   8002b8 <_panic>
+
+00800eb6 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eb6:	55                   	push   %ebp
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	57                   	push   %edi
+  800eba:	56                   	push   %esi
+  800ebb:	53                   	push   %ebx
+  800ebc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ebf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eca:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ecf:	89 df                	mov    %ebx,%edi
+  800ed1:	89 de                	mov    %ebx,%esi
+  800ed3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed5:	85 c0                	test   %eax,%eax
+  800ed7:	7f 08                	jg     800ee1 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ed9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edc:	5b                   	pop    %ebx
+  800edd:	5e                   	pop    %esi
+  800ede:	5f                   	pop    %edi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee1:	83 ec 0c             	sub    $0xc,%esp
+  800ee4:	50                   	push   %eax
+  800ee5:	6a 08                	push   $0x8
+  800ee7:	68 1f 2d 80 00       	push   $0x802d1f
+  800eec:	6a 23                	push   $0x23
+  800eee:	68 3c 2d 80 00       	push   $0x802d3c
+  800ef3:	e8 c0 f3 ff ff       	call   8002b8 <_panic>
+
+00800ef8 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800ef8:	55                   	push   %ebp
+  800ef9:	89 e5                	mov    %esp,%ebp
+  800efb:	57                   	push   %edi
+  800efc:	56                   	push   %esi
+  800efd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800efe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f04:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f09:	be 00 00 00 00       	mov    $0x0,%esi
+  800f0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f11:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f14:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f16:	5b                   	pop    %ebx
+  800f17:	5e                   	pop    %esi
+  800f18:	5f                   	pop    %edi
+  800f19:	5d                   	pop    %ebp
+  800f1a:	c3                   	ret
+
+00800f1b <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	57                   	push   %edi
+  800f1f:	56                   	push   %esi
+  800f20:	53                   	push   %ebx
+  800f21:	8b 45 18             	mov    0x18(%ebp),%eax
+  800f24:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800f27:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800f2c:	77 27                	ja     800f55 <sys_page_map_range+0x3a>
+  800f2e:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800f34:	77 1f                	ja     800f55 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800f36:	c1 e0 0c             	shl    $0xc,%eax
+  800f39:	89 c6                	mov    %eax,%esi
+  800f3b:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800f3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f43:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f4e:	cd 30                	int    $0x30
+}
+  800f50:	5b                   	pop    %ebx
+  800f51:	5e                   	pop    %esi
+  800f52:	5f                   	pop    %edi
+  800f53:	5d                   	pop    %ebp
+  800f54:	c3                   	ret
+		return -E_INVAL;
+  800f55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f5a:	eb f4                	jmp    800f50 <sys_page_map_range+0x35>
+
+00800f5c <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800f5c:	55                   	push   %ebp
+  800f5d:	89 e5                	mov    %esp,%ebp
+  800f5f:	57                   	push   %edi
+  800f60:	56                   	push   %esi
+  800f61:	53                   	push   %ebx
+  800f62:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f70:	be 00 00 00 00       	mov    $0x0,%esi
+  800f75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f78:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f7b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7d:	85 c0                	test   %eax,%eax
+  800f7f:	7f 08                	jg     800f89 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800f81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f84:	5b                   	pop    %ebx
+  800f85:	5e                   	pop    %esi
+  800f86:	5f                   	pop    %edi
+  800f87:	5d                   	pop    %ebp
+  800f88:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+  800f8c:	50                   	push   %eax
+  800f8d:	6a 0c                	push   $0xc
+  800f8f:	68 1f 2d 80 00       	push   $0x802d1f
+  800f94:	6a 23                	push   $0x23
+  800f96:	68 3c 2d 80 00       	push   $0x802d3c
+  800f9b:	e8 18 f3 ff ff       	call   8002b8 <_panic>
+
+00800fa0 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa6:	be 00 00 00 00       	mov    $0x0,%esi
+  800fab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb9:	89 f7                	mov    %esi,%edi
+  800fbb:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fbd:	5b                   	pop    %ebx
+  800fbe:	5e                   	pop    %esi
+  800fbf:	5f                   	pop    %edi
+  800fc0:	5d                   	pop    %ebp
+  800fc1:	c3                   	ret
+
+00800fc2 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fc2:	55                   	push   %ebp
+  800fc3:	89 e5                	mov    %esp,%ebp
+  800fc5:	57                   	push   %edi
+  800fc6:	56                   	push   %esi
+  800fc7:	53                   	push   %ebx
+  800fc8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fdb:	89 df                	mov    %ebx,%edi
+  800fdd:	89 de                	mov    %ebx,%esi
+  800fdf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe1:	85 c0                	test   %eax,%eax
+  800fe3:	7f 08                	jg     800fed <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fe5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe8:	5b                   	pop    %ebx
+  800fe9:	5e                   	pop    %esi
+  800fea:	5f                   	pop    %edi
+  800feb:	5d                   	pop    %ebp
+  800fec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fed:	83 ec 0c             	sub    $0xc,%esp
+  800ff0:	50                   	push   %eax
+  800ff1:	6a 0f                	push   $0xf
+  800ff3:	68 1f 2d 80 00       	push   $0x802d1f
+  800ff8:	6a 23                	push   $0x23
+  800ffa:	68 3c 2d 80 00       	push   $0x802d3c
+  800fff:	e8 b4 f2 ff ff       	call   8002b8 <_panic>
+
+00801004 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  801004:	55                   	push   %ebp
+  801005:	89 e5                	mov    %esp,%ebp
+  801007:	57                   	push   %edi
+  801008:	56                   	push   %esi
+  801009:	53                   	push   %ebx
+  80100a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80100d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801012:	8b 55 08             	mov    0x8(%ebp),%edx
+  801015:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801018:	b8 10 00 00 00       	mov    $0x10,%eax
+  80101d:	89 df                	mov    %ebx,%edi
+  80101f:	89 de                	mov    %ebx,%esi
+  801021:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801023:	85 c0                	test   %eax,%eax
+  801025:	7f 08                	jg     80102f <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  801027:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80102a:	5b                   	pop    %ebx
+  80102b:	5e                   	pop    %esi
+  80102c:	5f                   	pop    %edi
+  80102d:	5d                   	pop    %ebp
+  80102e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80102f:	83 ec 0c             	sub    $0xc,%esp
+  801032:	50                   	push   %eax
+  801033:	6a 10                	push   $0x10
+  801035:	68 1f 2d 80 00       	push   $0x802d1f
+  80103a:	6a 23                	push   $0x23
+  80103c:	68 3c 2d 80 00       	push   $0x802d3c
+  801041:	e8 72 f2 ff ff       	call   8002b8 <_panic>
+
+00801046 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+  801049:	57                   	push   %edi
+  80104a:	56                   	push   %esi
+  80104b:	53                   	push   %ebx
+  80104c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80104f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801054:	8b 55 08             	mov    0x8(%ebp),%edx
+  801057:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80105f:	89 df                	mov    %ebx,%edi
+  801061:	89 de                	mov    %ebx,%esi
+  801063:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801065:	85 c0                	test   %eax,%eax
+  801067:	7f 08                	jg     801071 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  801069:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106c:	5b                   	pop    %ebx
+  80106d:	5e                   	pop    %esi
+  80106e:	5f                   	pop    %edi
+  80106f:	5d                   	pop    %ebp
+  801070:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801071:	83 ec 0c             	sub    $0xc,%esp
+  801074:	50                   	push   %eax
+  801075:	6a 11                	push   $0x11
+  801077:	68 1f 2d 80 00       	push   $0x802d1f
+  80107c:	6a 23                	push   $0x23
+  80107e:	68 3c 2d 80 00       	push   $0x802d3c
+  801083:	e8 30 f2 ff ff       	call   8002b8 <_panic>
+
+00801088 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  801088:	55                   	push   %ebp
+  801089:	89 e5                	mov    %esp,%ebp
+  80108b:	57                   	push   %edi
+  80108c:	56                   	push   %esi
+  80108d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80108e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801093:	b8 12 00 00 00       	mov    $0x12,%eax
+  801098:	89 d1                	mov    %edx,%ecx
+  80109a:	89 d3                	mov    %edx,%ebx
+  80109c:	89 d7                	mov    %edx,%edi
+  80109e:	89 d6                	mov    %edx,%esi
+  8010a0:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  8010a2:	5b                   	pop    %ebx
+  8010a3:	5e                   	pop    %esi
+  8010a4:	5f                   	pop    %edi
+  8010a5:	5d                   	pop    %ebp
+  8010a6:	c3                   	ret
+
+008010a7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010a7:	55                   	push   %ebp
+  8010a8:	89 e5                	mov    %esp,%ebp
+  8010aa:	57                   	push   %edi
+  8010ab:	56                   	push   %esi
+  8010ac:	53                   	push   %ebx
+  8010ad:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bb:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010c0:	89 df                	mov    %ebx,%edi
+  8010c2:	89 de                	mov    %ebx,%esi
+  8010c4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c6:	85 c0                	test   %eax,%eax
+  8010c8:	7f 08                	jg     8010d2 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cd:	5b                   	pop    %ebx
+  8010ce:	5e                   	pop    %esi
+  8010cf:	5f                   	pop    %edi
+  8010d0:	5d                   	pop    %ebp
+  8010d1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d2:	83 ec 0c             	sub    $0xc,%esp
+  8010d5:	50                   	push   %eax
+  8010d6:	6a 13                	push   $0x13
+  8010d8:	68 1f 2d 80 00       	push   $0x802d1f
+  8010dd:	6a 23                	push   $0x23
+  8010df:	68 3c 2d 80 00       	push   $0x802d3c
+  8010e4:	e8 cf f1 ff ff       	call   8002b8 <_panic>
+
+008010e9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010e9:	55                   	push   %ebp
+  8010ea:	89 e5                	mov    %esp,%ebp
+  8010ec:	57                   	push   %edi
+  8010ed:	56                   	push   %esi
+  8010ee:	53                   	push   %ebx
+  8010ef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fd:	b8 14 00 00 00       	mov    $0x14,%eax
+  801102:	89 df                	mov    %ebx,%edi
+  801104:	89 de                	mov    %ebx,%esi
+  801106:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801108:	85 c0                	test   %eax,%eax
+  80110a:	7f 08                	jg     801114 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80110c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110f:	5b                   	pop    %ebx
+  801110:	5e                   	pop    %esi
+  801111:	5f                   	pop    %edi
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801114:	83 ec 0c             	sub    $0xc,%esp
+  801117:	50                   	push   %eax
+  801118:	6a 14                	push   $0x14
+  80111a:	68 1f 2d 80 00       	push   $0x802d1f
+  80111f:	6a 23                	push   $0x23
+  801121:	68 3c 2d 80 00       	push   $0x802d3c
+  801126:	e8 8d f1 ff ff       	call   8002b8 <_panic>
+
+0080112b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80112b:	55                   	push   %ebp
+  80112c:	89 e5                	mov    %esp,%ebp
+  80112e:	57                   	push   %edi
+  80112f:	56                   	push   %esi
+  801130:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801131:	8b 55 08             	mov    0x8(%ebp),%edx
+  801134:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801137:	b8 17 00 00 00       	mov    $0x17,%eax
+  80113c:	be 00 00 00 00       	mov    $0x0,%esi
+  801141:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801144:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801147:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801149:	5b                   	pop    %ebx
+  80114a:	5e                   	pop    %esi
+  80114b:	5f                   	pop    %edi
+  80114c:	5d                   	pop    %ebp
+  80114d:	c3                   	ret
+
+0080114e <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80114e:	55                   	push   %ebp
+  80114f:	89 e5                	mov    %esp,%ebp
+  801151:	57                   	push   %edi
+  801152:	56                   	push   %esi
+  801153:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801154:	8b 55 08             	mov    0x8(%ebp),%edx
+  801157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80115f:	be 00 00 00 00       	mov    $0x0,%esi
+  801164:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801167:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80116a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80116c:	5b                   	pop    %ebx
+  80116d:	5e                   	pop    %esi
+  80116e:	5f                   	pop    %edi
+  80116f:	5d                   	pop    %ebp
+  801170:	c3                   	ret
+
+00801171 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801171:	55                   	push   %ebp
+  801172:	89 e5                	mov    %esp,%ebp
+  801174:	57                   	push   %edi
+  801175:	56                   	push   %esi
+  801176:	53                   	push   %ebx
+  801177:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80117a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80117f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801182:	b8 19 00 00 00       	mov    $0x19,%eax
+  801187:	89 cb                	mov    %ecx,%ebx
+  801189:	89 cf                	mov    %ecx,%edi
+  80118b:	89 ce                	mov    %ecx,%esi
+  80118d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118f:	85 c0                	test   %eax,%eax
+  801191:	7f 08                	jg     80119b <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801196:	5b                   	pop    %ebx
+  801197:	5e                   	pop    %esi
+  801198:	5f                   	pop    %edi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119b:	83 ec 0c             	sub    $0xc,%esp
+  80119e:	50                   	push   %eax
+  80119f:	6a 19                	push   $0x19
+  8011a1:	68 1f 2d 80 00       	push   $0x802d1f
+  8011a6:	6a 23                	push   $0x23
+  8011a8:	68 3c 2d 80 00       	push   $0x802d3c
+  8011ad:	e8 06 f1 ff ff       	call   8002b8 <_panic>
+
+008011b2 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	57                   	push   %edi
+  8011b6:	56                   	push   %esi
+  8011b7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011bd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8011c2:	89 d1                	mov    %edx,%ecx
+  8011c4:	89 d3                	mov    %edx,%ebx
+  8011c6:	89 d7                	mov    %edx,%edi
+  8011c8:	89 d6                	mov    %edx,%esi
+  8011ca:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011cc:	5b                   	pop    %ebx
+  8011cd:	5e                   	pop    %esi
+  8011ce:	5f                   	pop    %edi
+  8011cf:	5d                   	pop    %ebp
+  8011d0:	c3                   	ret
+
+008011d1 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8011d1:	55                   	push   %ebp
+  8011d2:	89 e5                	mov    %esp,%ebp
+  8011d4:	57                   	push   %edi
+  8011d5:	56                   	push   %esi
+  8011d6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8011e7:	89 df                	mov    %ebx,%edi
+  8011e9:	89 de                	mov    %ebx,%esi
+  8011eb:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8011ed:	5b                   	pop    %ebx
+  8011ee:	5e                   	pop    %esi
+  8011ef:	5f                   	pop    %edi
+  8011f0:	5d                   	pop    %ebp
+  8011f1:	c3                   	ret
+
+008011f2 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	57                   	push   %edi
+  8011f6:	56                   	push   %esi
+  8011f7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801200:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801203:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801208:	89 df                	mov    %ebx,%edi
+  80120a:	89 de                	mov    %ebx,%esi
+  80120c:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  80120e:	5b                   	pop    %ebx
+  80120f:	5e                   	pop    %esi
+  801210:	5f                   	pop    %edi
+  801211:	5d                   	pop    %ebp
+  801212:	c3                   	ret
+
+00801213 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801213:	55                   	push   %ebp
+  801214:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801216:	8b 45 08             	mov    0x8(%ebp),%eax
+  801219:	05 00 00 00 30       	add    $0x30000000,%eax
+  80121e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801221:	5d                   	pop    %ebp
+  801222:	c3                   	ret
+
+00801223 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801223:	55                   	push   %ebp
+  801224:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801226:	8b 45 08             	mov    0x8(%ebp),%eax
+  801229:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80122e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801233:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801238:	5d                   	pop    %ebp
+  801239:	c3                   	ret
+
+0080123a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80123a:	55                   	push   %ebp
+  80123b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80123d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801242:	eb 02                	jmp    801246 <fd_alloc+0xc>
+  801244:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801246:	89 c2                	mov    %eax,%edx
+  801248:	c1 ea 16             	shr    $0x16,%edx
+  80124b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801252:	f6 c2 01             	test   $0x1,%dl
+  801255:	74 2b                	je     801282 <fd_alloc+0x48>
+  801257:	89 c2                	mov    %eax,%edx
+  801259:	c1 ea 0c             	shr    $0xc,%edx
+  80125c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801263:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801269:	f6 c1 01             	test   $0x1,%cl
+  80126c:	74 14                	je     801282 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80126e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801274:	75 ce                	jne    801244 <fd_alloc+0xa>
+  801276:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80127b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801280:	eb 05                	jmp    801287 <fd_alloc+0x4d>
+			return 0;
+  801282:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801287:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128a:	89 02                	mov    %eax,(%edx)
+}
+  80128c:	89 c8                	mov    %ecx,%eax
+  80128e:	5d                   	pop    %ebp
+  80128f:	c3                   	ret
+
+00801290 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801290:	55                   	push   %ebp
+  801291:	89 e5                	mov    %esp,%ebp
+  801293:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801296:	83 f8 1f             	cmp    $0x1f,%eax
+  801299:	77 30                	ja     8012cb <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80129b:	c1 e0 0c             	shl    $0xc,%eax
+  80129e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012a3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012a9:	f6 c2 01             	test   $0x1,%dl
+  8012ac:	74 24                	je     8012d2 <fd_lookup+0x42>
+  8012ae:	89 c2                	mov    %eax,%edx
+  8012b0:	c1 ea 0c             	shr    $0xc,%edx
+  8012b3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012ba:	f6 c2 01             	test   $0x1,%dl
+  8012bd:	74 1a                	je     8012d9 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012c2:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012c9:	5d                   	pop    %ebp
+  8012ca:	c3                   	ret
+		return -E_INVAL;
+  8012cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012d0:	eb f7                	jmp    8012c9 <fd_lookup+0x39>
+		return -E_INVAL;
+  8012d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012d7:	eb f0                	jmp    8012c9 <fd_lookup+0x39>
+  8012d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012de:	eb e9                	jmp    8012c9 <fd_lookup+0x39>
+
+008012e0 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+  8012e3:	53                   	push   %ebx
+  8012e4:	83 ec 04             	sub    $0x4,%esp
+  8012e7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8012ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ef:	eb 03                	jmp    8012f4 <dev_lookup+0x14>
+  8012f1:	83 c0 01             	add    $0x1,%eax
+  8012f4:	8b 1c 85 c8 2d 80 00 	mov    0x802dc8(,%eax,4),%ebx
+  8012fb:	85 db                	test   %ebx,%ebx
+  8012fd:	74 0b                	je     80130a <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8012ff:	39 13                	cmp    %edx,(%ebx)
+  801301:	75 ee                	jne    8012f1 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801303:	b8 00 00 00 00       	mov    $0x0,%eax
+  801308:	eb 1f                	jmp    801329 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80130a:	a1 20 40 81 00       	mov    0x814020,%eax
+  80130f:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801312:	83 ec 04             	sub    $0x4,%esp
+  801315:	52                   	push   %edx
+  801316:	50                   	push   %eax
+  801317:	68 4c 2d 80 00       	push   $0x802d4c
+  80131c:	e8 72 f0 ff ff       	call   800393 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801321:	83 c4 10             	add    $0x10,%esp
+  801324:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801329:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80132c:	89 1a                	mov    %ebx,(%edx)
+}
+  80132e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801331:	c9                   	leave
+  801332:	c3                   	ret
+
+00801333 <fd_close>:
+{
+  801333:	55                   	push   %ebp
+  801334:	89 e5                	mov    %esp,%ebp
+  801336:	57                   	push   %edi
+  801337:	56                   	push   %esi
+  801338:	53                   	push   %ebx
+  801339:	83 ec 24             	sub    $0x24,%esp
+  80133c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80133f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801342:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801345:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801346:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80134c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80134f:	50                   	push   %eax
+  801350:	e8 3b ff ff ff       	call   801290 <fd_lookup>
+  801355:	89 c3                	mov    %eax,%ebx
+  801357:	83 c4 10             	add    $0x10,%esp
+  80135a:	85 c0                	test   %eax,%eax
+  80135c:	78 05                	js     801363 <fd_close+0x30>
+	    || fd != fd2)
+  80135e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801361:	74 16                	je     801379 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801363:	89 f8                	mov    %edi,%eax
+  801365:	84 c0                	test   %al,%al
+  801367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80136f:	89 d8                	mov    %ebx,%eax
+  801371:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801374:	5b                   	pop    %ebx
+  801375:	5e                   	pop    %esi
+  801376:	5f                   	pop    %edi
+  801377:	5d                   	pop    %ebp
+  801378:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801379:	83 ec 08             	sub    $0x8,%esp
+  80137c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80137f:	50                   	push   %eax
+  801380:	ff 36                	push   (%esi)
+  801382:	e8 59 ff ff ff       	call   8012e0 <dev_lookup>
+  801387:	89 c3                	mov    %eax,%ebx
+  801389:	83 c4 10             	add    $0x10,%esp
+  80138c:	85 c0                	test   %eax,%eax
+  80138e:	78 1a                	js     8013aa <fd_close+0x77>
+		if (dev->dev_close)
+  801390:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801393:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801396:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80139b:	85 c0                	test   %eax,%eax
+  80139d:	74 0b                	je     8013aa <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80139f:	83 ec 0c             	sub    $0xc,%esp
+  8013a2:	56                   	push   %esi
+  8013a3:	ff d0                	call   *%eax
+  8013a5:	89 c3                	mov    %eax,%ebx
+  8013a7:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013aa:	83 ec 08             	sub    $0x8,%esp
+  8013ad:	56                   	push   %esi
+  8013ae:	6a 00                	push   $0x0
+  8013b0:	e8 01 fb ff ff       	call   800eb6 <sys_page_unmap>
+	return r;
+  8013b5:	83 c4 10             	add    $0x10,%esp
+  8013b8:	eb b5                	jmp    80136f <fd_close+0x3c>
+
+008013ba <close>:
+
+int
+close(int fdnum)
+{
+  8013ba:	55                   	push   %ebp
+  8013bb:	89 e5                	mov    %esp,%ebp
+  8013bd:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013c3:	50                   	push   %eax
+  8013c4:	ff 75 08             	push   0x8(%ebp)
+  8013c7:	e8 c4 fe ff ff       	call   801290 <fd_lookup>
+  8013cc:	83 c4 10             	add    $0x10,%esp
+  8013cf:	85 c0                	test   %eax,%eax
+  8013d1:	79 02                	jns    8013d5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8013d3:	c9                   	leave
+  8013d4:	c3                   	ret
+		return fd_close(fd, 1);
+  8013d5:	83 ec 08             	sub    $0x8,%esp
+  8013d8:	6a 01                	push   $0x1
+  8013da:	ff 75 f4             	push   -0xc(%ebp)
+  8013dd:	e8 51 ff ff ff       	call   801333 <fd_close>
+  8013e2:	83 c4 10             	add    $0x10,%esp
+  8013e5:	eb ec                	jmp    8013d3 <close+0x19>
+
+008013e7 <close_all>:
+
+void
+close_all(void)
+{
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	53                   	push   %ebx
+  8013eb:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8013ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8013f3:	83 ec 0c             	sub    $0xc,%esp
+  8013f6:	53                   	push   %ebx
+  8013f7:	e8 be ff ff ff       	call   8013ba <close>
+	for (i = 0; i < MAXFD; i++)
+  8013fc:	83 c3 01             	add    $0x1,%ebx
+  8013ff:	83 c4 10             	add    $0x10,%esp
+  801402:	83 fb 20             	cmp    $0x20,%ebx
+  801405:	75 ec                	jne    8013f3 <close_all+0xc>
+}
+  801407:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80140a:	c9                   	leave
+  80140b:	c3                   	ret
+
+0080140c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80140c:	55                   	push   %ebp
+  80140d:	89 e5                	mov    %esp,%ebp
+  80140f:	57                   	push   %edi
+  801410:	56                   	push   %esi
+  801411:	53                   	push   %ebx
+  801412:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801415:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801418:	50                   	push   %eax
+  801419:	ff 75 08             	push   0x8(%ebp)
+  80141c:	e8 6f fe ff ff       	call   801290 <fd_lookup>
+  801421:	89 c3                	mov    %eax,%ebx
+  801423:	83 c4 10             	add    $0x10,%esp
+  801426:	85 c0                	test   %eax,%eax
+  801428:	78 7f                	js     8014a9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80142a:	83 ec 0c             	sub    $0xc,%esp
+  80142d:	ff 75 0c             	push   0xc(%ebp)
+  801430:	e8 85 ff ff ff       	call   8013ba <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801435:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801438:	c1 e6 0c             	shl    $0xc,%esi
+  80143b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801441:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801444:	89 3c 24             	mov    %edi,(%esp)
+  801447:	e8 d7 fd ff ff       	call   801223 <fd2data>
+  80144c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80144e:	89 34 24             	mov    %esi,(%esp)
+  801451:	e8 cd fd ff ff       	call   801223 <fd2data>
+  801456:	83 c4 10             	add    $0x10,%esp
+  801459:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80145c:	89 d8                	mov    %ebx,%eax
+  80145e:	c1 e8 16             	shr    $0x16,%eax
+  801461:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801468:	a8 01                	test   $0x1,%al
+  80146a:	74 11                	je     80147d <dup+0x71>
+  80146c:	89 d8                	mov    %ebx,%eax
+  80146e:	c1 e8 0c             	shr    $0xc,%eax
+  801471:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801478:	f6 c2 01             	test   $0x1,%dl
+  80147b:	75 36                	jne    8014b3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80147d:	89 f8                	mov    %edi,%eax
+  80147f:	c1 e8 0c             	shr    $0xc,%eax
+  801482:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801489:	83 ec 0c             	sub    $0xc,%esp
+  80148c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801491:	50                   	push   %eax
+  801492:	56                   	push   %esi
+  801493:	6a 00                	push   $0x0
+  801495:	57                   	push   %edi
+  801496:	6a 00                	push   $0x0
+  801498:	e8 d7 f9 ff ff       	call   800e74 <sys_page_map>
+  80149d:	89 c3                	mov    %eax,%ebx
+  80149f:	83 c4 20             	add    $0x20,%esp
+  8014a2:	85 c0                	test   %eax,%eax
+  8014a4:	78 33                	js     8014d9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014a9:	89 d8                	mov    %ebx,%eax
+  8014ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ae:	5b                   	pop    %ebx
+  8014af:	5e                   	pop    %esi
+  8014b0:	5f                   	pop    %edi
+  8014b1:	5d                   	pop    %ebp
+  8014b2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014b3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014ba:	83 ec 0c             	sub    $0xc,%esp
+  8014bd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014c2:	50                   	push   %eax
+  8014c3:	ff 75 d4             	push   -0x2c(%ebp)
+  8014c6:	6a 00                	push   $0x0
+  8014c8:	53                   	push   %ebx
+  8014c9:	6a 00                	push   $0x0
+  8014cb:	e8 a4 f9 ff ff       	call   800e74 <sys_page_map>
+  8014d0:	89 c3                	mov    %eax,%ebx
+  8014d2:	83 c4 20             	add    $0x20,%esp
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	79 a4                	jns    80147d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8014d9:	83 ec 08             	sub    $0x8,%esp
+  8014dc:	56                   	push   %esi
+  8014dd:	6a 00                	push   $0x0
+  8014df:	e8 d2 f9 ff ff       	call   800eb6 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8014e4:	83 c4 08             	add    $0x8,%esp
+  8014e7:	ff 75 d4             	push   -0x2c(%ebp)
+  8014ea:	6a 00                	push   $0x0
+  8014ec:	e8 c5 f9 ff ff       	call   800eb6 <sys_page_unmap>
+	return r;
+  8014f1:	83 c4 10             	add    $0x10,%esp
+  8014f4:	eb b3                	jmp    8014a9 <dup+0x9d>
+
+008014f6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014f6:	55                   	push   %ebp
+  8014f7:	89 e5                	mov    %esp,%ebp
+  8014f9:	56                   	push   %esi
+  8014fa:	53                   	push   %ebx
+  8014fb:	83 ec 18             	sub    $0x18,%esp
+  8014fe:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801501:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801504:	50                   	push   %eax
+  801505:	56                   	push   %esi
+  801506:	e8 85 fd ff ff       	call   801290 <fd_lookup>
+  80150b:	83 c4 10             	add    $0x10,%esp
+  80150e:	85 c0                	test   %eax,%eax
+  801510:	78 3c                	js     80154e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801512:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801515:	83 ec 08             	sub    $0x8,%esp
+  801518:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80151b:	50                   	push   %eax
+  80151c:	ff 33                	push   (%ebx)
+  80151e:	e8 bd fd ff ff       	call   8012e0 <dev_lookup>
+  801523:	83 c4 10             	add    $0x10,%esp
+  801526:	85 c0                	test   %eax,%eax
+  801528:	78 24                	js     80154e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80152a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80152d:	83 e0 03             	and    $0x3,%eax
+  801530:	83 f8 01             	cmp    $0x1,%eax
+  801533:	74 20                	je     801555 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801535:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801538:	8b 40 08             	mov    0x8(%eax),%eax
+  80153b:	85 c0                	test   %eax,%eax
+  80153d:	74 37                	je     801576 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80153f:	83 ec 04             	sub    $0x4,%esp
+  801542:	ff 75 10             	push   0x10(%ebp)
+  801545:	ff 75 0c             	push   0xc(%ebp)
+  801548:	53                   	push   %ebx
+  801549:	ff d0                	call   *%eax
+  80154b:	83 c4 10             	add    $0x10,%esp
+}
+  80154e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801551:	5b                   	pop    %ebx
+  801552:	5e                   	pop    %esi
+  801553:	5d                   	pop    %ebp
+  801554:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801555:	a1 20 40 81 00       	mov    0x814020,%eax
+  80155a:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80155d:	83 ec 04             	sub    $0x4,%esp
+  801560:	56                   	push   %esi
+  801561:	50                   	push   %eax
+  801562:	68 8d 2d 80 00       	push   $0x802d8d
+  801567:	e8 27 ee ff ff       	call   800393 <cprintf>
+		return -E_INVAL;
+  80156c:	83 c4 10             	add    $0x10,%esp
+  80156f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801574:	eb d8                	jmp    80154e <read+0x58>
+		return -E_NOT_SUPP;
+  801576:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80157b:	eb d1                	jmp    80154e <read+0x58>
+
+0080157d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80157d:	55                   	push   %ebp
+  80157e:	89 e5                	mov    %esp,%ebp
+  801580:	57                   	push   %edi
+  801581:	56                   	push   %esi
+  801582:	53                   	push   %ebx
+  801583:	83 ec 0c             	sub    $0xc,%esp
+  801586:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801589:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80158c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801591:	eb 02                	jmp    801595 <readn+0x18>
+  801593:	01 c3                	add    %eax,%ebx
+  801595:	39 f3                	cmp    %esi,%ebx
+  801597:	73 21                	jae    8015ba <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801599:	83 ec 04             	sub    $0x4,%esp
+  80159c:	89 f0                	mov    %esi,%eax
+  80159e:	29 d8                	sub    %ebx,%eax
+  8015a0:	50                   	push   %eax
+  8015a1:	89 d8                	mov    %ebx,%eax
+  8015a3:	03 45 0c             	add    0xc(%ebp),%eax
+  8015a6:	50                   	push   %eax
+  8015a7:	57                   	push   %edi
+  8015a8:	e8 49 ff ff ff       	call   8014f6 <read>
+		if (m < 0)
+  8015ad:	83 c4 10             	add    $0x10,%esp
+  8015b0:	85 c0                	test   %eax,%eax
+  8015b2:	78 04                	js     8015b8 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8015b4:	75 dd                	jne    801593 <readn+0x16>
+  8015b6:	eb 02                	jmp    8015ba <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015b8:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8015ba:	89 d8                	mov    %ebx,%eax
+  8015bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015bf:	5b                   	pop    %ebx
+  8015c0:	5e                   	pop    %esi
+  8015c1:	5f                   	pop    %edi
+  8015c2:	5d                   	pop    %ebp
+  8015c3:	c3                   	ret
+
+008015c4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015c4:	55                   	push   %ebp
+  8015c5:	89 e5                	mov    %esp,%ebp
+  8015c7:	56                   	push   %esi
+  8015c8:	53                   	push   %ebx
+  8015c9:	83 ec 18             	sub    $0x18,%esp
+  8015cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015cf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015d2:	50                   	push   %eax
+  8015d3:	53                   	push   %ebx
+  8015d4:	e8 b7 fc ff ff       	call   801290 <fd_lookup>
+  8015d9:	83 c4 10             	add    $0x10,%esp
+  8015dc:	85 c0                	test   %eax,%eax
+  8015de:	78 37                	js     801617 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015e0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015e3:	83 ec 08             	sub    $0x8,%esp
+  8015e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e9:	50                   	push   %eax
+  8015ea:	ff 36                	push   (%esi)
+  8015ec:	e8 ef fc ff ff       	call   8012e0 <dev_lookup>
+  8015f1:	83 c4 10             	add    $0x10,%esp
+  8015f4:	85 c0                	test   %eax,%eax
+  8015f6:	78 1f                	js     801617 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015f8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015fc:	74 20                	je     80161e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801601:	8b 40 0c             	mov    0xc(%eax),%eax
+  801604:	85 c0                	test   %eax,%eax
+  801606:	74 37                	je     80163f <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801608:	83 ec 04             	sub    $0x4,%esp
+  80160b:	ff 75 10             	push   0x10(%ebp)
+  80160e:	ff 75 0c             	push   0xc(%ebp)
+  801611:	56                   	push   %esi
+  801612:	ff d0                	call   *%eax
+  801614:	83 c4 10             	add    $0x10,%esp
+}
+  801617:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80161a:	5b                   	pop    %ebx
+  80161b:	5e                   	pop    %esi
+  80161c:	5d                   	pop    %ebp
+  80161d:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80161e:	a1 20 40 81 00       	mov    0x814020,%eax
+  801623:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801626:	83 ec 04             	sub    $0x4,%esp
+  801629:	53                   	push   %ebx
+  80162a:	50                   	push   %eax
+  80162b:	68 a9 2d 80 00       	push   $0x802da9
+  801630:	e8 5e ed ff ff       	call   800393 <cprintf>
+		return -E_INVAL;
+  801635:	83 c4 10             	add    $0x10,%esp
+  801638:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80163d:	eb d8                	jmp    801617 <write+0x53>
+		return -E_NOT_SUPP;
+  80163f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801644:	eb d1                	jmp    801617 <write+0x53>
+
+00801646 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801646:	55                   	push   %ebp
+  801647:	89 e5                	mov    %esp,%ebp
+  801649:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80164c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80164f:	50                   	push   %eax
+  801650:	ff 75 08             	push   0x8(%ebp)
+  801653:	e8 38 fc ff ff       	call   801290 <fd_lookup>
+  801658:	83 c4 10             	add    $0x10,%esp
+  80165b:	85 c0                	test   %eax,%eax
+  80165d:	78 0e                	js     80166d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80165f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801662:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801665:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801668:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80166d:	c9                   	leave
+  80166e:	c3                   	ret
+
+0080166f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80166f:	55                   	push   %ebp
+  801670:	89 e5                	mov    %esp,%ebp
+  801672:	56                   	push   %esi
+  801673:	53                   	push   %ebx
+  801674:	83 ec 18             	sub    $0x18,%esp
+  801677:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80167a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80167d:	50                   	push   %eax
+  80167e:	53                   	push   %ebx
+  80167f:	e8 0c fc ff ff       	call   801290 <fd_lookup>
+  801684:	83 c4 10             	add    $0x10,%esp
+  801687:	85 c0                	test   %eax,%eax
+  801689:	78 34                	js     8016bf <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80168b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80168e:	83 ec 08             	sub    $0x8,%esp
+  801691:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801694:	50                   	push   %eax
+  801695:	ff 36                	push   (%esi)
+  801697:	e8 44 fc ff ff       	call   8012e0 <dev_lookup>
+  80169c:	83 c4 10             	add    $0x10,%esp
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	78 1c                	js     8016bf <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016a3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016a7:	74 1d                	je     8016c6 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8016a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ac:	8b 40 18             	mov    0x18(%eax),%eax
+  8016af:	85 c0                	test   %eax,%eax
+  8016b1:	74 34                	je     8016e7 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8016b3:	83 ec 08             	sub    $0x8,%esp
+  8016b6:	ff 75 0c             	push   0xc(%ebp)
+  8016b9:	56                   	push   %esi
+  8016ba:	ff d0                	call   *%eax
+  8016bc:	83 c4 10             	add    $0x10,%esp
+}
+  8016bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c2:	5b                   	pop    %ebx
+  8016c3:	5e                   	pop    %esi
+  8016c4:	5d                   	pop    %ebp
+  8016c5:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8016c6:	a1 20 40 81 00       	mov    0x814020,%eax
+  8016cb:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016ce:	83 ec 04             	sub    $0x4,%esp
+  8016d1:	53                   	push   %ebx
+  8016d2:	50                   	push   %eax
+  8016d3:	68 6c 2d 80 00       	push   $0x802d6c
+  8016d8:	e8 b6 ec ff ff       	call   800393 <cprintf>
+		return -E_INVAL;
+  8016dd:	83 c4 10             	add    $0x10,%esp
+  8016e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e5:	eb d8                	jmp    8016bf <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016e7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016ec:	eb d1                	jmp    8016bf <ftruncate+0x50>
+
+008016ee <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016ee:	55                   	push   %ebp
+  8016ef:	89 e5                	mov    %esp,%ebp
+  8016f1:	56                   	push   %esi
+  8016f2:	53                   	push   %ebx
+  8016f3:	83 ec 18             	sub    $0x18,%esp
+  8016f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016f9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016fc:	50                   	push   %eax
+  8016fd:	ff 75 08             	push   0x8(%ebp)
+  801700:	e8 8b fb ff ff       	call   801290 <fd_lookup>
+  801705:	83 c4 10             	add    $0x10,%esp
+  801708:	85 c0                	test   %eax,%eax
+  80170a:	78 49                	js     801755 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80170c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80170f:	83 ec 08             	sub    $0x8,%esp
+  801712:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801715:	50                   	push   %eax
+  801716:	ff 36                	push   (%esi)
+  801718:	e8 c3 fb ff ff       	call   8012e0 <dev_lookup>
+  80171d:	83 c4 10             	add    $0x10,%esp
+  801720:	85 c0                	test   %eax,%eax
+  801722:	78 31                	js     801755 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801724:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801727:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80172b:	74 2f                	je     80175c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80172d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801730:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801737:	00 00 00 
+	stat->st_isdir = 0;
+  80173a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801741:	00 00 00 
+	stat->st_dev = dev;
+  801744:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80174a:	83 ec 08             	sub    $0x8,%esp
+  80174d:	53                   	push   %ebx
+  80174e:	56                   	push   %esi
+  80174f:	ff 50 14             	call   *0x14(%eax)
+  801752:	83 c4 10             	add    $0x10,%esp
+}
+  801755:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801758:	5b                   	pop    %ebx
+  801759:	5e                   	pop    %esi
+  80175a:	5d                   	pop    %ebp
+  80175b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80175c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801761:	eb f2                	jmp    801755 <fstat+0x67>
+
+00801763 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801763:	55                   	push   %ebp
+  801764:	89 e5                	mov    %esp,%ebp
+  801766:	56                   	push   %esi
+  801767:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801768:	83 ec 08             	sub    $0x8,%esp
+  80176b:	6a 00                	push   $0x0
+  80176d:	ff 75 08             	push   0x8(%ebp)
+  801770:	e8 e4 01 00 00       	call   801959 <open>
+  801775:	89 c3                	mov    %eax,%ebx
+  801777:	83 c4 10             	add    $0x10,%esp
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	78 1b                	js     801799 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80177e:	83 ec 08             	sub    $0x8,%esp
+  801781:	ff 75 0c             	push   0xc(%ebp)
+  801784:	50                   	push   %eax
+  801785:	e8 64 ff ff ff       	call   8016ee <fstat>
+  80178a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80178c:	89 1c 24             	mov    %ebx,(%esp)
+  80178f:	e8 26 fc ff ff       	call   8013ba <close>
+	return r;
+  801794:	83 c4 10             	add    $0x10,%esp
+  801797:	89 f3                	mov    %esi,%ebx
+}
+  801799:	89 d8                	mov    %ebx,%eax
+  80179b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80179e:	5b                   	pop    %ebx
+  80179f:	5e                   	pop    %esi
+  8017a0:	5d                   	pop    %ebp
+  8017a1:	c3                   	ret
+
+008017a2 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8017a2:	55                   	push   %ebp
+  8017a3:	89 e5                	mov    %esp,%ebp
+  8017a5:	56                   	push   %esi
+  8017a6:	53                   	push   %ebx
+  8017a7:	89 c6                	mov    %eax,%esi
+  8017a9:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8017ab:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8017b2:	74 27                	je     8017db <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017b4:	6a 07                	push   $0x7
+  8017b6:	68 00 50 81 00       	push   $0x815000
+  8017bb:	56                   	push   %esi
+  8017bc:	ff 35 00 40 80 00    	push   0x804000
+  8017c2:	e8 24 0c 00 00       	call   8023eb <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8017c7:	83 c4 0c             	add    $0xc,%esp
+  8017ca:	6a 00                	push   $0x0
+  8017cc:	53                   	push   %ebx
+  8017cd:	6a 00                	push   $0x0
+  8017cf:	e8 9f 0b 00 00       	call   802373 <ipc_recv>
+}
+  8017d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d7:	5b                   	pop    %ebx
+  8017d8:	5e                   	pop    %esi
+  8017d9:	5d                   	pop    %ebp
+  8017da:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017db:	83 ec 0c             	sub    $0xc,%esp
+  8017de:	6a 01                	push   $0x1
+  8017e0:	e8 5a 0c 00 00       	call   80243f <ipc_find_env>
+  8017e5:	a3 00 40 80 00       	mov    %eax,0x804000
+  8017ea:	83 c4 10             	add    $0x10,%esp
+  8017ed:	eb c5                	jmp    8017b4 <fsipc+0x12>
+
+008017ef <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017ef:	55                   	push   %ebp
+  8017f0:	89 e5                	mov    %esp,%ebp
+  8017f2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017fb:	a3 00 50 81 00       	mov    %eax,0x815000
+	fsipcbuf.set_size.req_size = newsize;
+  801800:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801803:	a3 04 50 81 00       	mov    %eax,0x815004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801808:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801812:	e8 8b ff ff ff       	call   8017a2 <fsipc>
+}
+  801817:	c9                   	leave
+  801818:	c3                   	ret
+
+00801819 <devfile_flush>:
+{
+  801819:	55                   	push   %ebp
+  80181a:	89 e5                	mov    %esp,%ebp
+  80181c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80181f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801822:	8b 40 0c             	mov    0xc(%eax),%eax
+  801825:	a3 00 50 81 00       	mov    %eax,0x815000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80182a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80182f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801834:	e8 69 ff ff ff       	call   8017a2 <fsipc>
+}
+  801839:	c9                   	leave
+  80183a:	c3                   	ret
+
+0080183b <devfile_stat>:
+{
+  80183b:	55                   	push   %ebp
+  80183c:	89 e5                	mov    %esp,%ebp
+  80183e:	53                   	push   %ebx
+  80183f:	83 ec 04             	sub    $0x4,%esp
+  801842:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801845:	8b 45 08             	mov    0x8(%ebp),%eax
+  801848:	8b 40 0c             	mov    0xc(%eax),%eax
+  80184b:	a3 00 50 81 00       	mov    %eax,0x815000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801850:	ba 00 00 00 00       	mov    $0x0,%edx
+  801855:	b8 05 00 00 00       	mov    $0x5,%eax
+  80185a:	e8 43 ff ff ff       	call   8017a2 <fsipc>
+  80185f:	85 c0                	test   %eax,%eax
+  801861:	78 2c                	js     80188f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801863:	83 ec 08             	sub    $0x8,%esp
+  801866:	68 00 50 81 00       	push   $0x815000
+  80186b:	53                   	push   %ebx
+  80186c:	e8 10 f1 ff ff       	call   800981 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801871:	a1 80 50 81 00       	mov    0x815080,%eax
+  801876:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80187c:	a1 84 50 81 00       	mov    0x815084,%eax
+  801881:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80188f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801892:	c9                   	leave
+  801893:	c3                   	ret
+
+00801894 <devfile_write>:
+{
+  801894:	55                   	push   %ebp
+  801895:	89 e5                	mov    %esp,%ebp
+  801897:	83 ec 0c             	sub    $0xc,%esp
+  80189a:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80189d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8018a2:	39 d0                	cmp    %edx,%eax
+  8018a4:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018aa:	8b 52 0c             	mov    0xc(%edx),%edx
+  8018ad:	89 15 00 50 81 00    	mov    %edx,0x815000
+	fsipcbuf.write.req_n = n;
+  8018b3:	a3 04 50 81 00       	mov    %eax,0x815004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8018b8:	50                   	push   %eax
+  8018b9:	ff 75 0c             	push   0xc(%ebp)
+  8018bc:	68 08 50 81 00       	push   $0x815008
+  8018c1:	e8 41 f2 ff ff       	call   800b07 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8018c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018cb:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018d0:	e8 cd fe ff ff       	call   8017a2 <fsipc>
+}
+  8018d5:	c9                   	leave
+  8018d6:	c3                   	ret
+
+008018d7 <devfile_read>:
+{
+  8018d7:	55                   	push   %ebp
+  8018d8:	89 e5                	mov    %esp,%ebp
+  8018da:	56                   	push   %esi
+  8018db:	53                   	push   %ebx
+  8018dc:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8018df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018e5:	a3 00 50 81 00       	mov    %eax,0x815000
+	fsipcbuf.read.req_n = n;
+  8018ea:	89 35 04 50 81 00    	mov    %esi,0x815004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8018f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018fa:	e8 a3 fe ff ff       	call   8017a2 <fsipc>
+  8018ff:	89 c3                	mov    %eax,%ebx
+  801901:	85 c0                	test   %eax,%eax
+  801903:	78 1f                	js     801924 <devfile_read+0x4d>
+	assert(r <= n);
+  801905:	39 c6                	cmp    %eax,%esi
+  801907:	72 24                	jb     80192d <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801909:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80190e:	7f 33                	jg     801943 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801910:	83 ec 04             	sub    $0x4,%esp
+  801913:	50                   	push   %eax
+  801914:	68 00 50 81 00       	push   $0x815000
+  801919:	ff 75 0c             	push   0xc(%ebp)
+  80191c:	e8 e6 f1 ff ff       	call   800b07 <memmove>
+	return r;
+  801921:	83 c4 10             	add    $0x10,%esp
+}
+  801924:	89 d8                	mov    %ebx,%eax
+  801926:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801929:	5b                   	pop    %ebx
+  80192a:	5e                   	pop    %esi
+  80192b:	5d                   	pop    %ebp
+  80192c:	c3                   	ret
+	assert(r <= n);
+  80192d:	68 dc 2d 80 00       	push   $0x802ddc
+  801932:	68 e3 2d 80 00       	push   $0x802de3
+  801937:	6a 7c                	push   $0x7c
+  801939:	68 f8 2d 80 00       	push   $0x802df8
+  80193e:	e8 75 e9 ff ff       	call   8002b8 <_panic>
+	assert(r <= PGSIZE);
+  801943:	68 03 2e 80 00       	push   $0x802e03
+  801948:	68 e3 2d 80 00       	push   $0x802de3
+  80194d:	6a 7d                	push   $0x7d
+  80194f:	68 f8 2d 80 00       	push   $0x802df8
+  801954:	e8 5f e9 ff ff       	call   8002b8 <_panic>
+
+00801959 <open>:
+{
+  801959:	55                   	push   %ebp
+  80195a:	89 e5                	mov    %esp,%ebp
+  80195c:	56                   	push   %esi
+  80195d:	53                   	push   %ebx
+  80195e:	83 ec 1c             	sub    $0x1c,%esp
+  801961:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801964:	56                   	push   %esi
+  801965:	e8 dc ef ff ff       	call   800946 <strlen>
+  80196a:	83 c4 10             	add    $0x10,%esp
+  80196d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801972:	7f 6c                	jg     8019e0 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801974:	83 ec 0c             	sub    $0xc,%esp
+  801977:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80197a:	50                   	push   %eax
+  80197b:	e8 ba f8 ff ff       	call   80123a <fd_alloc>
+  801980:	89 c3                	mov    %eax,%ebx
+  801982:	83 c4 10             	add    $0x10,%esp
+  801985:	85 c0                	test   %eax,%eax
+  801987:	78 3c                	js     8019c5 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801989:	83 ec 08             	sub    $0x8,%esp
+  80198c:	56                   	push   %esi
+  80198d:	68 00 50 81 00       	push   $0x815000
+  801992:	e8 ea ef ff ff       	call   800981 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801997:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80199a:	a3 00 54 81 00       	mov    %eax,0x815400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80199f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8019a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019a7:	e8 f6 fd ff ff       	call   8017a2 <fsipc>
+  8019ac:	89 c3                	mov    %eax,%ebx
+  8019ae:	83 c4 10             	add    $0x10,%esp
+  8019b1:	85 c0                	test   %eax,%eax
+  8019b3:	78 19                	js     8019ce <open+0x75>
+	return fd2num(fd);
+  8019b5:	83 ec 0c             	sub    $0xc,%esp
+  8019b8:	ff 75 f4             	push   -0xc(%ebp)
+  8019bb:	e8 53 f8 ff ff       	call   801213 <fd2num>
+  8019c0:	89 c3                	mov    %eax,%ebx
+  8019c2:	83 c4 10             	add    $0x10,%esp
+}
+  8019c5:	89 d8                	mov    %ebx,%eax
+  8019c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ca:	5b                   	pop    %ebx
+  8019cb:	5e                   	pop    %esi
+  8019cc:	5d                   	pop    %ebp
+  8019cd:	c3                   	ret
+		fd_close(fd, 0);
+  8019ce:	83 ec 08             	sub    $0x8,%esp
+  8019d1:	6a 00                	push   $0x0
+  8019d3:	ff 75 f4             	push   -0xc(%ebp)
+  8019d6:	e8 58 f9 ff ff       	call   801333 <fd_close>
+		return r;
+  8019db:	83 c4 10             	add    $0x10,%esp
+  8019de:	eb e5                	jmp    8019c5 <open+0x6c>
+		return -E_BAD_PATH;
+  8019e0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8019e5:	eb de                	jmp    8019c5 <open+0x6c>
+
+008019e7 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8019e7:	55                   	push   %ebp
+  8019e8:	89 e5                	mov    %esp,%ebp
+  8019ea:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8019ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019f7:	e8 a6 fd ff ff       	call   8017a2 <fsipc>
+}
+  8019fc:	c9                   	leave
+  8019fd:	c3                   	ret
+
+008019fe <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8019fe:	55                   	push   %ebp
+  8019ff:	89 e5                	mov    %esp,%ebp
+  801a01:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801a04:	68 0f 2e 80 00       	push   $0x802e0f
+  801a09:	ff 75 0c             	push   0xc(%ebp)
+  801a0c:	e8 70 ef ff ff       	call   800981 <strcpy>
+	return 0;
+}
+  801a11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a16:	c9                   	leave
+  801a17:	c3                   	ret
+
+00801a18 <devsock_close>:
+{
+  801a18:	55                   	push   %ebp
+  801a19:	89 e5                	mov    %esp,%ebp
+  801a1b:	53                   	push   %ebx
+  801a1c:	83 ec 10             	sub    $0x10,%esp
+  801a1f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801a22:	53                   	push   %ebx
+  801a23:	e8 27 0a 00 00       	call   80244f <pageref>
+  801a28:	89 c2                	mov    %eax,%edx
+  801a2a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801a32:	83 fa 01             	cmp    $0x1,%edx
+  801a35:	74 05                	je     801a3c <devsock_close+0x24>
+}
+  801a37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3a:	c9                   	leave
+  801a3b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801a3c:	83 ec 0c             	sub    $0xc,%esp
+  801a3f:	ff 73 0c             	push   0xc(%ebx)
+  801a42:	e8 b7 02 00 00       	call   801cfe <nsipc_close>
+  801a47:	83 c4 10             	add    $0x10,%esp
+  801a4a:	eb eb                	jmp    801a37 <devsock_close+0x1f>
+
+00801a4c <devsock_write>:
+{
+  801a4c:	55                   	push   %ebp
+  801a4d:	89 e5                	mov    %esp,%ebp
+  801a4f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801a52:	6a 00                	push   $0x0
+  801a54:	ff 75 10             	push   0x10(%ebp)
+  801a57:	ff 75 0c             	push   0xc(%ebp)
+  801a5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a5d:	ff 70 0c             	push   0xc(%eax)
+  801a60:	e8 79 03 00 00       	call   801dde <nsipc_send>
+}
+  801a65:	c9                   	leave
+  801a66:	c3                   	ret
+
+00801a67 <devsock_read>:
+{
+  801a67:	55                   	push   %ebp
+  801a68:	89 e5                	mov    %esp,%ebp
+  801a6a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801a6d:	6a 00                	push   $0x0
+  801a6f:	ff 75 10             	push   0x10(%ebp)
+  801a72:	ff 75 0c             	push   0xc(%ebp)
+  801a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a78:	ff 70 0c             	push   0xc(%eax)
+  801a7b:	e8 ef 02 00 00       	call   801d6f <nsipc_recv>
+}
+  801a80:	c9                   	leave
+  801a81:	c3                   	ret
+
+00801a82 <fd2sockid>:
+{
+  801a82:	55                   	push   %ebp
+  801a83:	89 e5                	mov    %esp,%ebp
+  801a85:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801a88:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801a8b:	52                   	push   %edx
+  801a8c:	50                   	push   %eax
+  801a8d:	e8 fe f7 ff ff       	call   801290 <fd_lookup>
+  801a92:	83 c4 10             	add    $0x10,%esp
+  801a95:	85 c0                	test   %eax,%eax
+  801a97:	78 10                	js     801aa9 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801a99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a9c:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801aa2:	39 08                	cmp    %ecx,(%eax)
+  801aa4:	75 05                	jne    801aab <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801aa6:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801aa9:	c9                   	leave
+  801aaa:	c3                   	ret
+		return -E_NOT_SUPP;
+  801aab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ab0:	eb f7                	jmp    801aa9 <fd2sockid+0x27>
+
+00801ab2 <alloc_sockfd>:
+{
+  801ab2:	55                   	push   %ebp
+  801ab3:	89 e5                	mov    %esp,%ebp
+  801ab5:	56                   	push   %esi
+  801ab6:	53                   	push   %ebx
+  801ab7:	83 ec 1c             	sub    $0x1c,%esp
+  801aba:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801abc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801abf:	50                   	push   %eax
+  801ac0:	e8 75 f7 ff ff       	call   80123a <fd_alloc>
+  801ac5:	89 c3                	mov    %eax,%ebx
+  801ac7:	83 c4 10             	add    $0x10,%esp
+  801aca:	85 c0                	test   %eax,%eax
+  801acc:	78 43                	js     801b11 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ace:	83 ec 04             	sub    $0x4,%esp
+  801ad1:	68 07 04 00 00       	push   $0x407
+  801ad6:	ff 75 f4             	push   -0xc(%ebp)
+  801ad9:	6a 00                	push   $0x0
+  801adb:	e8 0e f3 ff ff       	call   800dee <sys_page_alloc>
+  801ae0:	89 c3                	mov    %eax,%ebx
+  801ae2:	83 c4 10             	add    $0x10,%esp
+  801ae5:	85 c0                	test   %eax,%eax
+  801ae7:	78 28                	js     801b11 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801ae9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aec:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801af2:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801af4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801af7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801afe:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801b01:	83 ec 0c             	sub    $0xc,%esp
+  801b04:	50                   	push   %eax
+  801b05:	e8 09 f7 ff ff       	call   801213 <fd2num>
+  801b0a:	89 c3                	mov    %eax,%ebx
+  801b0c:	83 c4 10             	add    $0x10,%esp
+  801b0f:	eb 0c                	jmp    801b1d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801b11:	83 ec 0c             	sub    $0xc,%esp
+  801b14:	56                   	push   %esi
+  801b15:	e8 e4 01 00 00       	call   801cfe <nsipc_close>
+		return r;
+  801b1a:	83 c4 10             	add    $0x10,%esp
+}
+  801b1d:	89 d8                	mov    %ebx,%eax
+  801b1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b22:	5b                   	pop    %ebx
+  801b23:	5e                   	pop    %esi
+  801b24:	5d                   	pop    %ebp
+  801b25:	c3                   	ret
+
+00801b26 <accept>:
+{
+  801b26:	55                   	push   %ebp
+  801b27:	89 e5                	mov    %esp,%ebp
+  801b29:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b2f:	e8 4e ff ff ff       	call   801a82 <fd2sockid>
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	78 1b                	js     801b53 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801b38:	83 ec 04             	sub    $0x4,%esp
+  801b3b:	ff 75 10             	push   0x10(%ebp)
+  801b3e:	ff 75 0c             	push   0xc(%ebp)
+  801b41:	50                   	push   %eax
+  801b42:	e8 0e 01 00 00       	call   801c55 <nsipc_accept>
+  801b47:	83 c4 10             	add    $0x10,%esp
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	78 05                	js     801b53 <accept+0x2d>
+	return alloc_sockfd(r);
+  801b4e:	e8 5f ff ff ff       	call   801ab2 <alloc_sockfd>
+}
+  801b53:	c9                   	leave
+  801b54:	c3                   	ret
+
+00801b55 <bind>:
+{
+  801b55:	55                   	push   %ebp
+  801b56:	89 e5                	mov    %esp,%ebp
+  801b58:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b5e:	e8 1f ff ff ff       	call   801a82 <fd2sockid>
+  801b63:	85 c0                	test   %eax,%eax
+  801b65:	78 12                	js     801b79 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801b67:	83 ec 04             	sub    $0x4,%esp
+  801b6a:	ff 75 10             	push   0x10(%ebp)
+  801b6d:	ff 75 0c             	push   0xc(%ebp)
+  801b70:	50                   	push   %eax
+  801b71:	e8 31 01 00 00       	call   801ca7 <nsipc_bind>
+  801b76:	83 c4 10             	add    $0x10,%esp
+}
+  801b79:	c9                   	leave
+  801b7a:	c3                   	ret
+
+00801b7b <shutdown>:
+{
+  801b7b:	55                   	push   %ebp
+  801b7c:	89 e5                	mov    %esp,%ebp
+  801b7e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b81:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b84:	e8 f9 fe ff ff       	call   801a82 <fd2sockid>
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	78 0f                	js     801b9c <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801b8d:	83 ec 08             	sub    $0x8,%esp
+  801b90:	ff 75 0c             	push   0xc(%ebp)
+  801b93:	50                   	push   %eax
+  801b94:	e8 43 01 00 00       	call   801cdc <nsipc_shutdown>
+  801b99:	83 c4 10             	add    $0x10,%esp
+}
+  801b9c:	c9                   	leave
+  801b9d:	c3                   	ret
+
+00801b9e <connect>:
+{
+  801b9e:	55                   	push   %ebp
+  801b9f:	89 e5                	mov    %esp,%ebp
+  801ba1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ba4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba7:	e8 d6 fe ff ff       	call   801a82 <fd2sockid>
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	78 12                	js     801bc2 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801bb0:	83 ec 04             	sub    $0x4,%esp
+  801bb3:	ff 75 10             	push   0x10(%ebp)
+  801bb6:	ff 75 0c             	push   0xc(%ebp)
+  801bb9:	50                   	push   %eax
+  801bba:	e8 59 01 00 00       	call   801d18 <nsipc_connect>
+  801bbf:	83 c4 10             	add    $0x10,%esp
+}
+  801bc2:	c9                   	leave
+  801bc3:	c3                   	ret
+
+00801bc4 <listen>:
+{
+  801bc4:	55                   	push   %ebp
+  801bc5:	89 e5                	mov    %esp,%ebp
+  801bc7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bca:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bcd:	e8 b0 fe ff ff       	call   801a82 <fd2sockid>
+  801bd2:	85 c0                	test   %eax,%eax
+  801bd4:	78 0f                	js     801be5 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801bd6:	83 ec 08             	sub    $0x8,%esp
+  801bd9:	ff 75 0c             	push   0xc(%ebp)
+  801bdc:	50                   	push   %eax
+  801bdd:	e8 6b 01 00 00       	call   801d4d <nsipc_listen>
+  801be2:	83 c4 10             	add    $0x10,%esp
+}
+  801be5:	c9                   	leave
+  801be6:	c3                   	ret
+
+00801be7 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801be7:	55                   	push   %ebp
+  801be8:	89 e5                	mov    %esp,%ebp
+  801bea:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801bed:	ff 75 10             	push   0x10(%ebp)
+  801bf0:	ff 75 0c             	push   0xc(%ebp)
+  801bf3:	ff 75 08             	push   0x8(%ebp)
+  801bf6:	e8 41 02 00 00       	call   801e3c <nsipc_socket>
+  801bfb:	83 c4 10             	add    $0x10,%esp
+  801bfe:	85 c0                	test   %eax,%eax
+  801c00:	78 05                	js     801c07 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801c02:	e8 ab fe ff ff       	call   801ab2 <alloc_sockfd>
+}
+  801c07:	c9                   	leave
+  801c08:	c3                   	ret
+
+00801c09 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801c09:	55                   	push   %ebp
+  801c0a:	89 e5                	mov    %esp,%ebp
+  801c0c:	53                   	push   %ebx
+  801c0d:	83 ec 04             	sub    $0x4,%esp
+  801c10:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801c12:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c19:	74 26                	je     801c41 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801c1b:	6a 07                	push   $0x7
+  801c1d:	68 00 60 81 00       	push   $0x816000
+  801c22:	53                   	push   %ebx
+  801c23:	ff 35 04 40 80 00    	push   0x804004
+  801c29:	e8 bd 07 00 00       	call   8023eb <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801c2e:	83 c4 0c             	add    $0xc,%esp
+  801c31:	6a 00                	push   $0x0
+  801c33:	6a 00                	push   $0x0
+  801c35:	6a 00                	push   $0x0
+  801c37:	e8 37 07 00 00       	call   802373 <ipc_recv>
+}
+  801c3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c3f:	c9                   	leave
+  801c40:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801c41:	83 ec 0c             	sub    $0xc,%esp
+  801c44:	6a 02                	push   $0x2
+  801c46:	e8 f4 07 00 00       	call   80243f <ipc_find_env>
+  801c4b:	a3 04 40 80 00       	mov    %eax,0x804004
+  801c50:	83 c4 10             	add    $0x10,%esp
+  801c53:	eb c6                	jmp    801c1b <nsipc+0x12>
+
+00801c55 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801c55:	55                   	push   %ebp
+  801c56:	89 e5                	mov    %esp,%ebp
+  801c58:	56                   	push   %esi
+  801c59:	53                   	push   %ebx
+  801c5a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801c5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c60:	a3 00 60 81 00       	mov    %eax,0x816000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801c65:	8b 06                	mov    (%esi),%eax
+  801c67:	a3 04 60 81 00       	mov    %eax,0x816004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801c6c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c71:	e8 93 ff ff ff       	call   801c09 <nsipc>
+  801c76:	89 c3                	mov    %eax,%ebx
+  801c78:	85 c0                	test   %eax,%eax
+  801c7a:	79 09                	jns    801c85 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801c7c:	89 d8                	mov    %ebx,%eax
+  801c7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c81:	5b                   	pop    %ebx
+  801c82:	5e                   	pop    %esi
+  801c83:	5d                   	pop    %ebp
+  801c84:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801c85:	83 ec 04             	sub    $0x4,%esp
+  801c88:	ff 35 10 60 81 00    	push   0x816010
+  801c8e:	68 00 60 81 00       	push   $0x816000
+  801c93:	ff 75 0c             	push   0xc(%ebp)
+  801c96:	e8 6c ee ff ff       	call   800b07 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801c9b:	a1 10 60 81 00       	mov    0x816010,%eax
+  801ca0:	89 06                	mov    %eax,(%esi)
+  801ca2:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ca5:	eb d5                	jmp    801c7c <nsipc_accept+0x27>
+
+00801ca7 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ca7:	55                   	push   %ebp
+  801ca8:	89 e5                	mov    %esp,%ebp
+  801caa:	53                   	push   %ebx
+  801cab:	83 ec 08             	sub    $0x8,%esp
+  801cae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb4:	a3 00 60 81 00       	mov    %eax,0x816000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801cb9:	53                   	push   %ebx
+  801cba:	ff 75 0c             	push   0xc(%ebp)
+  801cbd:	68 04 60 81 00       	push   $0x816004
+  801cc2:	e8 40 ee ff ff       	call   800b07 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801cc7:	89 1d 14 60 81 00    	mov    %ebx,0x816014
+	return nsipc(NSREQ_BIND);
+  801ccd:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cd2:	e8 32 ff ff ff       	call   801c09 <nsipc>
+}
+  801cd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cda:	c9                   	leave
+  801cdb:	c3                   	ret
+
+00801cdc <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801cdc:	55                   	push   %ebp
+  801cdd:	89 e5                	mov    %esp,%ebp
+  801cdf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801ce2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce5:	a3 00 60 81 00       	mov    %eax,0x816000
+	nsipcbuf.shutdown.req_how = how;
+  801cea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ced:	a3 04 60 81 00       	mov    %eax,0x816004
+	return nsipc(NSREQ_SHUTDOWN);
+  801cf2:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cf7:	e8 0d ff ff ff       	call   801c09 <nsipc>
+}
+  801cfc:	c9                   	leave
+  801cfd:	c3                   	ret
+
+00801cfe <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801cfe:	55                   	push   %ebp
+  801cff:	89 e5                	mov    %esp,%ebp
+  801d01:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801d04:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d07:	a3 00 60 81 00       	mov    %eax,0x816000
+	return nsipc(NSREQ_CLOSE);
+  801d0c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d11:	e8 f3 fe ff ff       	call   801c09 <nsipc>
+}
+  801d16:	c9                   	leave
+  801d17:	c3                   	ret
+
+00801d18 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801d18:	55                   	push   %ebp
+  801d19:	89 e5                	mov    %esp,%ebp
+  801d1b:	53                   	push   %ebx
+  801d1c:	83 ec 08             	sub    $0x8,%esp
+  801d1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801d22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d25:	a3 00 60 81 00       	mov    %eax,0x816000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801d2a:	53                   	push   %ebx
+  801d2b:	ff 75 0c             	push   0xc(%ebp)
+  801d2e:	68 04 60 81 00       	push   $0x816004
+  801d33:	e8 cf ed ff ff       	call   800b07 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801d38:	89 1d 14 60 81 00    	mov    %ebx,0x816014
+	return nsipc(NSREQ_CONNECT);
+  801d3e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d43:	e8 c1 fe ff ff       	call   801c09 <nsipc>
+}
+  801d48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d4b:	c9                   	leave
+  801d4c:	c3                   	ret
+
+00801d4d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801d4d:	55                   	push   %ebp
+  801d4e:	89 e5                	mov    %esp,%ebp
+  801d50:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801d53:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d56:	a3 00 60 81 00       	mov    %eax,0x816000
+	nsipcbuf.listen.req_backlog = backlog;
+  801d5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d5e:	a3 04 60 81 00       	mov    %eax,0x816004
+	return nsipc(NSREQ_LISTEN);
+  801d63:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d68:	e8 9c fe ff ff       	call   801c09 <nsipc>
+}
+  801d6d:	c9                   	leave
+  801d6e:	c3                   	ret
+
+00801d6f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801d6f:	55                   	push   %ebp
+  801d70:	89 e5                	mov    %esp,%ebp
+  801d72:	56                   	push   %esi
+  801d73:	53                   	push   %ebx
+  801d74:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801d77:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7a:	a3 00 60 81 00       	mov    %eax,0x816000
+	nsipcbuf.recv.req_len = len;
+  801d7f:	89 35 04 60 81 00    	mov    %esi,0x816004
+	nsipcbuf.recv.req_flags = flags;
+  801d85:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d88:	a3 08 60 81 00       	mov    %eax,0x816008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801d8d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d92:	e8 72 fe ff ff       	call   801c09 <nsipc>
+  801d97:	89 c3                	mov    %eax,%ebx
+  801d99:	85 c0                	test   %eax,%eax
+  801d9b:	78 22                	js     801dbf <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801d9d:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801da2:	39 c6                	cmp    %eax,%esi
+  801da4:	0f 4e c6             	cmovle %esi,%eax
+  801da7:	39 c3                	cmp    %eax,%ebx
+  801da9:	7f 1d                	jg     801dc8 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801dab:	83 ec 04             	sub    $0x4,%esp
+  801dae:	53                   	push   %ebx
+  801daf:	68 00 60 81 00       	push   $0x816000
+  801db4:	ff 75 0c             	push   0xc(%ebp)
+  801db7:	e8 4b ed ff ff       	call   800b07 <memmove>
+  801dbc:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801dbf:	89 d8                	mov    %ebx,%eax
+  801dc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dc4:	5b                   	pop    %ebx
+  801dc5:	5e                   	pop    %esi
+  801dc6:	5d                   	pop    %ebp
+  801dc7:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801dc8:	68 1b 2e 80 00       	push   $0x802e1b
+  801dcd:	68 e3 2d 80 00       	push   $0x802de3
+  801dd2:	6a 62                	push   $0x62
+  801dd4:	68 30 2e 80 00       	push   $0x802e30
+  801dd9:	e8 da e4 ff ff       	call   8002b8 <_panic>
+
+00801dde <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801dde:	55                   	push   %ebp
+  801ddf:	89 e5                	mov    %esp,%ebp
+  801de1:	53                   	push   %ebx
+  801de2:	83 ec 04             	sub    $0x4,%esp
+  801de5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801de8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801deb:	a3 00 60 81 00       	mov    %eax,0x816000
+	assert(size < 1600);
+  801df0:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801df6:	7f 2e                	jg     801e26 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801df8:	83 ec 04             	sub    $0x4,%esp
+  801dfb:	53                   	push   %ebx
+  801dfc:	ff 75 0c             	push   0xc(%ebp)
+  801dff:	68 0c 60 81 00       	push   $0x81600c
+  801e04:	e8 fe ec ff ff       	call   800b07 <memmove>
+	nsipcbuf.send.req_size = size;
+  801e09:	89 1d 04 60 81 00    	mov    %ebx,0x816004
+	nsipcbuf.send.req_flags = flags;
+  801e0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e12:	a3 08 60 81 00       	mov    %eax,0x816008
+	return nsipc(NSREQ_SEND);
+  801e17:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e1c:	e8 e8 fd ff ff       	call   801c09 <nsipc>
+}
+  801e21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e24:	c9                   	leave
+  801e25:	c3                   	ret
+	assert(size < 1600);
+  801e26:	68 3c 2e 80 00       	push   $0x802e3c
+  801e2b:	68 e3 2d 80 00       	push   $0x802de3
+  801e30:	6a 6d                	push   $0x6d
+  801e32:	68 30 2e 80 00       	push   $0x802e30
+  801e37:	e8 7c e4 ff ff       	call   8002b8 <_panic>
+
+00801e3c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801e3c:	55                   	push   %ebp
+  801e3d:	89 e5                	mov    %esp,%ebp
+  801e3f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801e42:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e45:	a3 00 60 81 00       	mov    %eax,0x816000
+	nsipcbuf.socket.req_type = type;
+  801e4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e4d:	a3 04 60 81 00       	mov    %eax,0x816004
+	nsipcbuf.socket.req_protocol = protocol;
+  801e52:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e55:	a3 08 60 81 00       	mov    %eax,0x816008
+	return nsipc(NSREQ_SOCKET);
+  801e5a:	b8 09 00 00 00       	mov    $0x9,%eax
+  801e5f:	e8 a5 fd ff ff       	call   801c09 <nsipc>
+}
+  801e64:	c9                   	leave
+  801e65:	c3                   	ret
+
+00801e66 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e66:	55                   	push   %ebp
+  801e67:	89 e5                	mov    %esp,%ebp
+  801e69:	56                   	push   %esi
+  801e6a:	53                   	push   %ebx
+  801e6b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801e6e:	83 ec 0c             	sub    $0xc,%esp
+  801e71:	ff 75 08             	push   0x8(%ebp)
+  801e74:	e8 aa f3 ff ff       	call   801223 <fd2data>
+  801e79:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801e7b:	83 c4 08             	add    $0x8,%esp
+  801e7e:	68 48 2e 80 00       	push   $0x802e48
+  801e83:	53                   	push   %ebx
+  801e84:	e8 f8 ea ff ff       	call   800981 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801e89:	8b 46 04             	mov    0x4(%esi),%eax
+  801e8c:	2b 06                	sub    (%esi),%eax
+  801e8e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801e94:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e9b:	00 00 00 
+	stat->st_dev = &devpipe;
+  801e9e:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801ea5:	30 80 00 
+	return 0;
+}
+  801ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ead:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb0:	5b                   	pop    %ebx
+  801eb1:	5e                   	pop    %esi
+  801eb2:	5d                   	pop    %ebp
+  801eb3:	c3                   	ret
+
+00801eb4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801eb4:	55                   	push   %ebp
+  801eb5:	89 e5                	mov    %esp,%ebp
+  801eb7:	53                   	push   %ebx
+  801eb8:	83 ec 0c             	sub    $0xc,%esp
+  801ebb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801ebe:	53                   	push   %ebx
+  801ebf:	6a 00                	push   $0x0
+  801ec1:	e8 f0 ef ff ff       	call   800eb6 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801ec6:	89 1c 24             	mov    %ebx,(%esp)
+  801ec9:	e8 55 f3 ff ff       	call   801223 <fd2data>
+  801ece:	83 c4 08             	add    $0x8,%esp
+  801ed1:	50                   	push   %eax
+  801ed2:	6a 00                	push   $0x0
+  801ed4:	e8 dd ef ff ff       	call   800eb6 <sys_page_unmap>
+}
+  801ed9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801edc:	c9                   	leave
+  801edd:	c3                   	ret
+
+00801ede <_pipeisclosed>:
+{
+  801ede:	55                   	push   %ebp
+  801edf:	89 e5                	mov    %esp,%ebp
+  801ee1:	57                   	push   %edi
+  801ee2:	56                   	push   %esi
+  801ee3:	53                   	push   %ebx
+  801ee4:	83 ec 1c             	sub    $0x1c,%esp
+  801ee7:	89 c7                	mov    %eax,%edi
+  801ee9:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801eeb:	a1 20 40 81 00       	mov    0x814020,%eax
+  801ef0:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801ef3:	83 ec 0c             	sub    $0xc,%esp
+  801ef6:	57                   	push   %edi
+  801ef7:	e8 53 05 00 00       	call   80244f <pageref>
+  801efc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801eff:	89 34 24             	mov    %esi,(%esp)
+  801f02:	e8 48 05 00 00       	call   80244f <pageref>
+		nn = thisenv->env_runs;
+  801f07:	8b 15 20 40 81 00    	mov    0x814020,%edx
+  801f0d:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801f10:	83 c4 10             	add    $0x10,%esp
+  801f13:	39 cb                	cmp    %ecx,%ebx
+  801f15:	74 1b                	je     801f32 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801f17:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f1a:	75 cf                	jne    801eeb <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801f1c:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801f1f:	6a 01                	push   $0x1
+  801f21:	50                   	push   %eax
+  801f22:	53                   	push   %ebx
+  801f23:	68 4f 2e 80 00       	push   $0x802e4f
+  801f28:	e8 66 e4 ff ff       	call   800393 <cprintf>
+  801f2d:	83 c4 10             	add    $0x10,%esp
+  801f30:	eb b9                	jmp    801eeb <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801f32:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f35:	0f 94 c0             	sete   %al
+  801f38:	0f b6 c0             	movzbl %al,%eax
+}
+  801f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f3e:	5b                   	pop    %ebx
+  801f3f:	5e                   	pop    %esi
+  801f40:	5f                   	pop    %edi
+  801f41:	5d                   	pop    %ebp
+  801f42:	c3                   	ret
+
+00801f43 <devpipe_write>:
+{
+  801f43:	55                   	push   %ebp
+  801f44:	89 e5                	mov    %esp,%ebp
+  801f46:	57                   	push   %edi
+  801f47:	56                   	push   %esi
+  801f48:	53                   	push   %ebx
+  801f49:	83 ec 28             	sub    $0x28,%esp
+  801f4c:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801f4f:	56                   	push   %esi
+  801f50:	e8 ce f2 ff ff       	call   801223 <fd2data>
+  801f55:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801f57:	83 c4 10             	add    $0x10,%esp
+  801f5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f5f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801f62:	75 09                	jne    801f6d <devpipe_write+0x2a>
+	return i;
+  801f64:	89 f8                	mov    %edi,%eax
+  801f66:	eb 23                	jmp    801f8b <devpipe_write+0x48>
+			sys_yield();
+  801f68:	e8 01 ee ff ff       	call   800d6e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801f6d:	8b 43 04             	mov    0x4(%ebx),%eax
+  801f70:	8b 0b                	mov    (%ebx),%ecx
+  801f72:	8d 51 20             	lea    0x20(%ecx),%edx
+  801f75:	39 d0                	cmp    %edx,%eax
+  801f77:	72 1a                	jb     801f93 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801f79:	89 da                	mov    %ebx,%edx
+  801f7b:	89 f0                	mov    %esi,%eax
+  801f7d:	e8 5c ff ff ff       	call   801ede <_pipeisclosed>
+  801f82:	85 c0                	test   %eax,%eax
+  801f84:	74 e2                	je     801f68 <devpipe_write+0x25>
+				return 0;
+  801f86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f8e:	5b                   	pop    %ebx
+  801f8f:	5e                   	pop    %esi
+  801f90:	5f                   	pop    %edi
+  801f91:	5d                   	pop    %ebp
+  801f92:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801f93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f96:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801f9a:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801f9d:	89 c2                	mov    %eax,%edx
+  801f9f:	c1 fa 1f             	sar    $0x1f,%edx
+  801fa2:	89 d1                	mov    %edx,%ecx
+  801fa4:	c1 e9 1b             	shr    $0x1b,%ecx
+  801fa7:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801faa:	83 e2 1f             	and    $0x1f,%edx
+  801fad:	29 ca                	sub    %ecx,%edx
+  801faf:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801fb3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801fb7:	83 c0 01             	add    $0x1,%eax
+  801fba:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801fbd:	83 c7 01             	add    $0x1,%edi
+  801fc0:	eb 9d                	jmp    801f5f <devpipe_write+0x1c>
+
+00801fc2 <devpipe_read>:
+{
+  801fc2:	55                   	push   %ebp
+  801fc3:	89 e5                	mov    %esp,%ebp
+  801fc5:	57                   	push   %edi
+  801fc6:	56                   	push   %esi
+  801fc7:	53                   	push   %ebx
+  801fc8:	83 ec 18             	sub    $0x18,%esp
+  801fcb:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801fce:	57                   	push   %edi
+  801fcf:	e8 4f f2 ff ff       	call   801223 <fd2data>
+  801fd4:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801fd6:	83 c4 10             	add    $0x10,%esp
+  801fd9:	be 00 00 00 00       	mov    $0x0,%esi
+  801fde:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801fe1:	75 13                	jne    801ff6 <devpipe_read+0x34>
+	return i;
+  801fe3:	89 f0                	mov    %esi,%eax
+  801fe5:	eb 02                	jmp    801fe9 <devpipe_read+0x27>
+				return i;
+  801fe7:	89 f0                	mov    %esi,%eax
+}
+  801fe9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fec:	5b                   	pop    %ebx
+  801fed:	5e                   	pop    %esi
+  801fee:	5f                   	pop    %edi
+  801fef:	5d                   	pop    %ebp
+  801ff0:	c3                   	ret
+			sys_yield();
+  801ff1:	e8 78 ed ff ff       	call   800d6e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801ff6:	8b 03                	mov    (%ebx),%eax
+  801ff8:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801ffb:	75 18                	jne    802015 <devpipe_read+0x53>
+			if (i > 0)
+  801ffd:	85 f6                	test   %esi,%esi
+  801fff:	75 e6                	jne    801fe7 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802001:	89 da                	mov    %ebx,%edx
+  802003:	89 f8                	mov    %edi,%eax
+  802005:	e8 d4 fe ff ff       	call   801ede <_pipeisclosed>
+  80200a:	85 c0                	test   %eax,%eax
+  80200c:	74 e3                	je     801ff1 <devpipe_read+0x2f>
+				return 0;
+  80200e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802013:	eb d4                	jmp    801fe9 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802015:	99                   	cltd
+  802016:	c1 ea 1b             	shr    $0x1b,%edx
+  802019:	01 d0                	add    %edx,%eax
+  80201b:	83 e0 1f             	and    $0x1f,%eax
+  80201e:	29 d0                	sub    %edx,%eax
+  802020:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802025:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802028:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80202b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80202e:	83 c6 01             	add    $0x1,%esi
+  802031:	eb ab                	jmp    801fde <devpipe_read+0x1c>
+
+00802033 <pipe>:
+{
+  802033:	55                   	push   %ebp
+  802034:	89 e5                	mov    %esp,%ebp
+  802036:	56                   	push   %esi
+  802037:	53                   	push   %ebx
+  802038:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80203b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80203e:	50                   	push   %eax
+  80203f:	e8 f6 f1 ff ff       	call   80123a <fd_alloc>
+  802044:	89 c3                	mov    %eax,%ebx
+  802046:	83 c4 10             	add    $0x10,%esp
+  802049:	85 c0                	test   %eax,%eax
+  80204b:	0f 88 23 01 00 00    	js     802174 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802051:	83 ec 04             	sub    $0x4,%esp
+  802054:	68 07 04 00 00       	push   $0x407
+  802059:	ff 75 f4             	push   -0xc(%ebp)
+  80205c:	6a 00                	push   $0x0
+  80205e:	e8 8b ed ff ff       	call   800dee <sys_page_alloc>
+  802063:	89 c3                	mov    %eax,%ebx
+  802065:	83 c4 10             	add    $0x10,%esp
+  802068:	85 c0                	test   %eax,%eax
+  80206a:	0f 88 04 01 00 00    	js     802174 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802070:	83 ec 0c             	sub    $0xc,%esp
+  802073:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802076:	50                   	push   %eax
+  802077:	e8 be f1 ff ff       	call   80123a <fd_alloc>
+  80207c:	89 c3                	mov    %eax,%ebx
+  80207e:	83 c4 10             	add    $0x10,%esp
+  802081:	85 c0                	test   %eax,%eax
+  802083:	0f 88 db 00 00 00    	js     802164 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802089:	83 ec 04             	sub    $0x4,%esp
+  80208c:	68 07 04 00 00       	push   $0x407
+  802091:	ff 75 f0             	push   -0x10(%ebp)
+  802094:	6a 00                	push   $0x0
+  802096:	e8 53 ed ff ff       	call   800dee <sys_page_alloc>
+  80209b:	89 c3                	mov    %eax,%ebx
+  80209d:	83 c4 10             	add    $0x10,%esp
+  8020a0:	85 c0                	test   %eax,%eax
+  8020a2:	0f 88 bc 00 00 00    	js     802164 <pipe+0x131>
+	va = fd2data(fd0);
+  8020a8:	83 ec 0c             	sub    $0xc,%esp
+  8020ab:	ff 75 f4             	push   -0xc(%ebp)
+  8020ae:	e8 70 f1 ff ff       	call   801223 <fd2data>
+  8020b3:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020b5:	83 c4 0c             	add    $0xc,%esp
+  8020b8:	68 07 04 00 00       	push   $0x407
+  8020bd:	50                   	push   %eax
+  8020be:	6a 00                	push   $0x0
+  8020c0:	e8 29 ed ff ff       	call   800dee <sys_page_alloc>
+  8020c5:	89 c3                	mov    %eax,%ebx
+  8020c7:	83 c4 10             	add    $0x10,%esp
+  8020ca:	85 c0                	test   %eax,%eax
+  8020cc:	0f 88 82 00 00 00    	js     802154 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020d2:	83 ec 0c             	sub    $0xc,%esp
+  8020d5:	ff 75 f0             	push   -0x10(%ebp)
+  8020d8:	e8 46 f1 ff ff       	call   801223 <fd2data>
+  8020dd:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8020e4:	50                   	push   %eax
+  8020e5:	6a 00                	push   $0x0
+  8020e7:	56                   	push   %esi
+  8020e8:	6a 00                	push   $0x0
+  8020ea:	e8 85 ed ff ff       	call   800e74 <sys_page_map>
+  8020ef:	89 c3                	mov    %eax,%ebx
+  8020f1:	83 c4 20             	add    $0x20,%esp
+  8020f4:	85 c0                	test   %eax,%eax
+  8020f6:	78 4e                	js     802146 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8020f8:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8020fd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802100:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802102:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802105:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80210c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80210f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802111:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802114:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80211b:	83 ec 0c             	sub    $0xc,%esp
+  80211e:	ff 75 f4             	push   -0xc(%ebp)
+  802121:	e8 ed f0 ff ff       	call   801213 <fd2num>
+  802126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802129:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80212b:	83 c4 04             	add    $0x4,%esp
+  80212e:	ff 75 f0             	push   -0x10(%ebp)
+  802131:	e8 dd f0 ff ff       	call   801213 <fd2num>
+  802136:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802139:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80213c:	83 c4 10             	add    $0x10,%esp
+  80213f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802144:	eb 2e                	jmp    802174 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802146:	83 ec 08             	sub    $0x8,%esp
+  802149:	56                   	push   %esi
+  80214a:	6a 00                	push   $0x0
+  80214c:	e8 65 ed ff ff       	call   800eb6 <sys_page_unmap>
+  802151:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802154:	83 ec 08             	sub    $0x8,%esp
+  802157:	ff 75 f0             	push   -0x10(%ebp)
+  80215a:	6a 00                	push   $0x0
+  80215c:	e8 55 ed ff ff       	call   800eb6 <sys_page_unmap>
+  802161:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802164:	83 ec 08             	sub    $0x8,%esp
+  802167:	ff 75 f4             	push   -0xc(%ebp)
+  80216a:	6a 00                	push   $0x0
+  80216c:	e8 45 ed ff ff       	call   800eb6 <sys_page_unmap>
+  802171:	83 c4 10             	add    $0x10,%esp
+}
+  802174:	89 d8                	mov    %ebx,%eax
+  802176:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802179:	5b                   	pop    %ebx
+  80217a:	5e                   	pop    %esi
+  80217b:	5d                   	pop    %ebp
+  80217c:	c3                   	ret
+
+0080217d <pipeisclosed>:
+{
+  80217d:	55                   	push   %ebp
+  80217e:	89 e5                	mov    %esp,%ebp
+  802180:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802183:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802186:	50                   	push   %eax
+  802187:	ff 75 08             	push   0x8(%ebp)
+  80218a:	e8 01 f1 ff ff       	call   801290 <fd_lookup>
+  80218f:	83 c4 10             	add    $0x10,%esp
+  802192:	85 c0                	test   %eax,%eax
+  802194:	78 18                	js     8021ae <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802196:	83 ec 0c             	sub    $0xc,%esp
+  802199:	ff 75 f4             	push   -0xc(%ebp)
+  80219c:	e8 82 f0 ff ff       	call   801223 <fd2data>
+  8021a1:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021a6:	e8 33 fd ff ff       	call   801ede <_pipeisclosed>
+  8021ab:	83 c4 10             	add    $0x10,%esp
+}
+  8021ae:	c9                   	leave
+  8021af:	c3                   	ret
+
+008021b0 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8021b0:	55                   	push   %ebp
+  8021b1:	89 e5                	mov    %esp,%ebp
+  8021b3:	56                   	push   %esi
+  8021b4:	53                   	push   %ebx
+  8021b5:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8021b8:	85 f6                	test   %esi,%esi
+  8021ba:	74 13                	je     8021cf <wait+0x1f>
+	e = &envs[ENVX(envid)];
+  8021bc:	89 f3                	mov    %esi,%ebx
+  8021be:	81 e3 ff 1f 00 00    	and    $0x1fff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8021c4:	c1 e3 09             	shl    $0x9,%ebx
+  8021c7:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8021cd:	eb 1b                	jmp    8021ea <wait+0x3a>
+	assert(envid != 0);
+  8021cf:	68 67 2e 80 00       	push   $0x802e67
+  8021d4:	68 e3 2d 80 00       	push   $0x802de3
+  8021d9:	6a 09                	push   $0x9
+  8021db:	68 72 2e 80 00       	push   $0x802e72
+  8021e0:	e8 d3 e0 ff ff       	call   8002b8 <_panic>
+		sys_yield();
+  8021e5:	e8 84 eb ff ff       	call   800d6e <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8021ea:	8b 43 4c             	mov    0x4c(%ebx),%eax
+  8021ed:	39 f0                	cmp    %esi,%eax
+  8021ef:	75 07                	jne    8021f8 <wait+0x48>
+  8021f1:	8b 43 58             	mov    0x58(%ebx),%eax
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	75 ed                	jne    8021e5 <wait+0x35>
+}
+  8021f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021fb:	5b                   	pop    %ebx
+  8021fc:	5e                   	pop    %esi
+  8021fd:	5d                   	pop    %ebp
+  8021fe:	c3                   	ret
+
+008021ff <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8021ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802204:	c3                   	ret
+
+00802205 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802205:	55                   	push   %ebp
+  802206:	89 e5                	mov    %esp,%ebp
+  802208:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80220b:	68 7d 2e 80 00       	push   $0x802e7d
+  802210:	ff 75 0c             	push   0xc(%ebp)
+  802213:	e8 69 e7 ff ff       	call   800981 <strcpy>
+	return 0;
+}
+  802218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221d:	c9                   	leave
+  80221e:	c3                   	ret
+
+0080221f <devcons_write>:
+{
+  80221f:	55                   	push   %ebp
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	57                   	push   %edi
+  802223:	56                   	push   %esi
+  802224:	53                   	push   %ebx
+  802225:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80222b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802230:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802236:	eb 2e                	jmp    802266 <devcons_write+0x47>
+		m = n - tot;
+  802238:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80223b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80223d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802242:	39 c3                	cmp    %eax,%ebx
+  802244:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802247:	83 ec 04             	sub    $0x4,%esp
+  80224a:	53                   	push   %ebx
+  80224b:	89 f0                	mov    %esi,%eax
+  80224d:	03 45 0c             	add    0xc(%ebp),%eax
+  802250:	50                   	push   %eax
+  802251:	57                   	push   %edi
+  802252:	e8 b0 e8 ff ff       	call   800b07 <memmove>
+		sys_cputs(buf, m);
+  802257:	83 c4 08             	add    $0x8,%esp
+  80225a:	53                   	push   %ebx
+  80225b:	57                   	push   %edi
+  80225c:	e8 50 ea ff ff       	call   800cb1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802261:	01 de                	add    %ebx,%esi
+  802263:	83 c4 10             	add    $0x10,%esp
+  802266:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802269:	72 cd                	jb     802238 <devcons_write+0x19>
+}
+  80226b:	89 f0                	mov    %esi,%eax
+  80226d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802270:	5b                   	pop    %ebx
+  802271:	5e                   	pop    %esi
+  802272:	5f                   	pop    %edi
+  802273:	5d                   	pop    %ebp
+  802274:	c3                   	ret
+
+00802275 <devcons_read>:
+{
+  802275:	55                   	push   %ebp
+  802276:	89 e5                	mov    %esp,%ebp
+  802278:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80227b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802280:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802284:	75 07                	jne    80228d <devcons_read+0x18>
+  802286:	eb 1f                	jmp    8022a7 <devcons_read+0x32>
+		sys_yield();
+  802288:	e8 e1 ea ff ff       	call   800d6e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80228d:	e8 3d ea ff ff       	call   800ccf <sys_cgetc>
+  802292:	85 c0                	test   %eax,%eax
+  802294:	74 f2                	je     802288 <devcons_read+0x13>
+	if (c < 0)
+  802296:	78 0f                	js     8022a7 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802298:	83 f8 04             	cmp    $0x4,%eax
+  80229b:	74 0c                	je     8022a9 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80229d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022a0:	88 02                	mov    %al,(%edx)
+	return 1;
+  8022a2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8022a7:	c9                   	leave
+  8022a8:	c3                   	ret
+		return 0;
+  8022a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ae:	eb f7                	jmp    8022a7 <devcons_read+0x32>
+
+008022b0 <cputchar>:
+{
+  8022b0:	55                   	push   %ebp
+  8022b1:	89 e5                	mov    %esp,%ebp
+  8022b3:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8022b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b9:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8022bc:	6a 01                	push   $0x1
+  8022be:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022c1:	50                   	push   %eax
+  8022c2:	e8 ea e9 ff ff       	call   800cb1 <sys_cputs>
+}
+  8022c7:	83 c4 10             	add    $0x10,%esp
+  8022ca:	c9                   	leave
+  8022cb:	c3                   	ret
+
+008022cc <getchar>:
+{
+  8022cc:	55                   	push   %ebp
+  8022cd:	89 e5                	mov    %esp,%ebp
+  8022cf:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8022d2:	6a 01                	push   $0x1
+  8022d4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022d7:	50                   	push   %eax
+  8022d8:	6a 00                	push   $0x0
+  8022da:	e8 17 f2 ff ff       	call   8014f6 <read>
+	if (r < 0)
+  8022df:	83 c4 10             	add    $0x10,%esp
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	78 06                	js     8022ec <getchar+0x20>
+	if (r < 1)
+  8022e6:	74 06                	je     8022ee <getchar+0x22>
+	return c;
+  8022e8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8022ec:	c9                   	leave
+  8022ed:	c3                   	ret
+		return -E_EOF;
+  8022ee:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8022f3:	eb f7                	jmp    8022ec <getchar+0x20>
+
+008022f5 <iscons>:
+{
+  8022f5:	55                   	push   %ebp
+  8022f6:	89 e5                	mov    %esp,%ebp
+  8022f8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022fe:	50                   	push   %eax
+  8022ff:	ff 75 08             	push   0x8(%ebp)
+  802302:	e8 89 ef ff ff       	call   801290 <fd_lookup>
+  802307:	83 c4 10             	add    $0x10,%esp
+  80230a:	85 c0                	test   %eax,%eax
+  80230c:	78 11                	js     80231f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80230e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802311:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802317:	39 10                	cmp    %edx,(%eax)
+  802319:	0f 94 c0             	sete   %al
+  80231c:	0f b6 c0             	movzbl %al,%eax
+}
+  80231f:	c9                   	leave
+  802320:	c3                   	ret
+
+00802321 <opencons>:
+{
+  802321:	55                   	push   %ebp
+  802322:	89 e5                	mov    %esp,%ebp
+  802324:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802327:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80232a:	50                   	push   %eax
+  80232b:	e8 0a ef ff ff       	call   80123a <fd_alloc>
+  802330:	83 c4 10             	add    $0x10,%esp
+  802333:	85 c0                	test   %eax,%eax
+  802335:	78 3a                	js     802371 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802337:	83 ec 04             	sub    $0x4,%esp
+  80233a:	68 07 04 00 00       	push   $0x407
+  80233f:	ff 75 f4             	push   -0xc(%ebp)
+  802342:	6a 00                	push   $0x0
+  802344:	e8 a5 ea ff ff       	call   800dee <sys_page_alloc>
+  802349:	83 c4 10             	add    $0x10,%esp
+  80234c:	85 c0                	test   %eax,%eax
+  80234e:	78 21                	js     802371 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802350:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802353:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802359:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80235b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80235e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802365:	83 ec 0c             	sub    $0xc,%esp
+  802368:	50                   	push   %eax
+  802369:	e8 a5 ee ff ff       	call   801213 <fd2num>
+  80236e:	83 c4 10             	add    $0x10,%esp
+}
+  802371:	c9                   	leave
+  802372:	c3                   	ret
+
+00802373 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802373:	55                   	push   %ebp
+  802374:	89 e5                	mov    %esp,%ebp
+  802376:	57                   	push   %edi
+  802377:	56                   	push   %esi
+  802378:	53                   	push   %ebx
+  802379:	83 ec 18             	sub    $0x18,%esp
+  80237c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80237f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802382:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802385:	85 db                	test   %ebx,%ebx
+  802387:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80238c:	0f 45 c3             	cmovne %ebx,%eax
+  80238f:	50                   	push   %eax
+  802390:	e8 dc ed ff ff       	call   801171 <sys_ipc_recv>
+
+	if (from_env_store)
+  802395:	83 c4 10             	add    $0x10,%esp
+  802398:	85 ff                	test   %edi,%edi
+  80239a:	74 17                	je     8023b3 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80239c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	75 0c                	jne    8023b1 <ipc_recv+0x3e>
+  8023a5:	8b 15 20 40 81 00    	mov    0x814020,%edx
+  8023ab:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8023b1:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8023b3:	85 f6                	test   %esi,%esi
+  8023b5:	74 2e                	je     8023e5 <ipc_recv+0x72>
+		if (!r && pg)
+  8023b7:	85 c0                	test   %eax,%eax
+  8023b9:	75 24                	jne    8023df <ipc_recv+0x6c>
+  8023bb:	85 db                	test   %ebx,%ebx
+  8023bd:	74 20                	je     8023df <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8023bf:	a1 20 40 81 00       	mov    0x814020,%eax
+  8023c4:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8023ca:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8023cc:	a1 20 40 81 00       	mov    0x814020,%eax
+  8023d1:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  8023d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023da:	5b                   	pop    %ebx
+  8023db:	5e                   	pop    %esi
+  8023dc:	5f                   	pop    %edi
+  8023dd:	5d                   	pop    %ebp
+  8023de:	c3                   	ret
+			*perm_store = 0;
+  8023df:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  8023e5:	85 c0                	test   %eax,%eax
+  8023e7:	75 ee                	jne    8023d7 <ipc_recv+0x64>
+  8023e9:	eb e1                	jmp    8023cc <ipc_recv+0x59>
+
+008023eb <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8023eb:	55                   	push   %ebp
+  8023ec:	89 e5                	mov    %esp,%ebp
+  8023ee:	57                   	push   %edi
+  8023ef:	56                   	push   %esi
+  8023f0:	53                   	push   %ebx
+  8023f1:	83 ec 0c             	sub    $0xc,%esp
+  8023f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023f7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8023fd:	85 db                	test   %ebx,%ebx
+  8023ff:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802404:	0f 44 d8             	cmove  %eax,%ebx
+  802407:	ff 75 14             	push   0x14(%ebp)
+  80240a:	53                   	push   %ebx
+  80240b:	56                   	push   %esi
+  80240c:	57                   	push   %edi
+  80240d:	e8 3c ed ff ff       	call   80114e <sys_ipc_try_send_yield>
+  802412:	83 c4 10             	add    $0x10,%esp
+  802415:	85 c0                	test   %eax,%eax
+  802417:	79 1e                	jns    802437 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802419:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80241c:	75 07                	jne    802425 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80241e:	e8 4b e9 ff ff       	call   800d6e <sys_yield>
+  802423:	eb e2                	jmp    802407 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802425:	50                   	push   %eax
+  802426:	68 89 2e 80 00       	push   $0x802e89
+  80242b:	6a 3d                	push   $0x3d
+  80242d:	68 9e 2e 80 00       	push   $0x802e9e
+  802432:	e8 81 de ff ff       	call   8002b8 <_panic>
+	}
+}
+  802437:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80243a:	5b                   	pop    %ebx
+  80243b:	5e                   	pop    %esi
+  80243c:	5f                   	pop    %edi
+  80243d:	5d                   	pop    %ebp
+  80243e:	c3                   	ret
+
+0080243f <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80243f:	55                   	push   %ebp
+  802440:	89 e5                	mov    %esp,%ebp
+  802442:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802445:	ff 75 08             	push   0x8(%ebp)
+  802448:	e8 a1 e8 ff ff       	call   800cee <sys_env_find>
+}
+  80244d:	c9                   	leave
+  80244e:	c3                   	ret
+
+0080244f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80244f:	55                   	push   %ebp
+  802450:	89 e5                	mov    %esp,%ebp
+  802452:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802455:	89 c2                	mov    %eax,%edx
+  802457:	c1 ea 16             	shr    $0x16,%edx
+  80245a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802461:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802466:	f6 c1 01             	test   $0x1,%cl
+  802469:	74 22                	je     80248d <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80246b:	c1 e8 0c             	shr    $0xc,%eax
+  80246e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802475:	a8 01                	test   $0x1,%al
+  802477:	74 14                	je     80248d <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802479:	c1 e8 0c             	shr    $0xc,%eax
+  80247c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80247f:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802486:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80248a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80248d:	89 d0                	mov    %edx,%eax
+  80248f:	5d                   	pop    %ebp
+  802490:	c3                   	ret
+  802491:	66 90                	xchg   %ax,%ax
+  802493:	66 90                	xchg   %ax,%ax
+  802495:	66 90                	xchg   %ax,%ax
+  802497:	66 90                	xchg   %ax,%ax
+  802499:	66 90                	xchg   %ax,%ax
+  80249b:	66 90                	xchg   %ax,%ax
+  80249d:	66 90                	xchg   %ax,%ax
+  80249f:	90                   	nop
+
+008024a0 <__udivmoddi4>:
+  8024a0:	55                   	push   %ebp
+  8024a1:	57                   	push   %edi
+  8024a2:	56                   	push   %esi
+  8024a3:	53                   	push   %ebx
+  8024a4:	83 ec 14             	sub    $0x14,%esp
+  8024a7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8024ab:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8024af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8024b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8024b7:	89 f1                	mov    %esi,%ecx
+  8024b9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8024bd:	09 d9                	or     %ebx,%ecx
+  8024bf:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8024c3:	0f 84 92 00 00 00    	je     80255b <__udivmoddi4+0xbb>
+  8024c9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8024d0:	00 
+  8024d1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8024d6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8024dd:	00 
+  8024de:	89 1c 24             	mov    %ebx,(%esp)
+  8024e1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8024e5:	8d 76 00             	lea    0x0(%esi),%esi
+  8024e8:	89 e9                	mov    %ebp,%ecx
+  8024ea:	89 c3                	mov    %eax,%ebx
+  8024ec:	89 d6                	mov    %edx,%esi
+  8024ee:	31 ff                	xor    %edi,%edi
+  8024f0:	d3 ee                	shr    %cl,%esi
+  8024f2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8024f5:	f6 c1 20             	test   $0x20,%cl
+  8024f8:	0f 45 de             	cmovne %esi,%ebx
+  8024fb:	0f 45 f7             	cmovne %edi,%esi
+  8024fe:	8b 3c 24             	mov    (%esp),%edi
+  802501:	39 fb                	cmp    %edi,%ebx
+  802503:	89 f7                	mov    %esi,%edi
+  802505:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802509:	8b 1c 24             	mov    (%esp),%ebx
+  80250c:	19 f7                	sbb    %esi,%edi
+  80250e:	72 39                	jb     802549 <__udivmoddi4+0xa9>
+  802510:	89 e9                	mov    %ebp,%ecx
+  802512:	89 f7                	mov    %esi,%edi
+  802514:	89 de                	mov    %ebx,%esi
+  802516:	0f a5 df             	shld   %cl,%ebx,%edi
+  802519:	d3 e6                	shl    %cl,%esi
+  80251b:	31 db                	xor    %ebx,%ebx
+  80251d:	f6 c1 20             	test   $0x20,%cl
+  802520:	0f 45 fe             	cmovne %esi,%edi
+  802523:	0f 45 f3             	cmovne %ebx,%esi
+  802526:	29 f0                	sub    %esi,%eax
+  802528:	be 01 00 00 00       	mov    $0x1,%esi
+  80252d:	19 fa                	sbb    %edi,%edx
+  80252f:	31 ff                	xor    %edi,%edi
+  802531:	31 db                	xor    %ebx,%ebx
+  802533:	0f a5 f7             	shld   %cl,%esi,%edi
+  802536:	d3 e6                	shl    %cl,%esi
+  802538:	f6 c1 20             	test   $0x20,%cl
+  80253b:	0f 45 fe             	cmovne %esi,%edi
+  80253e:	0f 45 f3             	cmovne %ebx,%esi
+  802541:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802545:	09 74 24 08          	or     %esi,0x8(%esp)
+  802549:	83 ed 01             	sub    $0x1,%ebp
+  80254c:	73 9a                	jae    8024e8 <__udivmoddi4+0x48>
+  80254e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802552:	85 ff                	test   %edi,%edi
+  802554:	74 05                	je     80255b <__udivmoddi4+0xbb>
+  802556:	89 07                	mov    %eax,(%edi)
+  802558:	89 57 04             	mov    %edx,0x4(%edi)
+  80255b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80255f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802563:	83 c4 14             	add    $0x14,%esp
+  802566:	5b                   	pop    %ebx
+  802567:	5e                   	pop    %esi
+  802568:	5f                   	pop    %edi
+  802569:	5d                   	pop    %ebp
+  80256a:	c3                   	ret
+  80256b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80256f:	90                   	nop
+
+00802570 <__udivdi3>:
+  802570:	55                   	push   %ebp
+  802571:	57                   	push   %edi
+  802572:	56                   	push   %esi
+  802573:	53                   	push   %ebx
+  802574:	83 ec 14             	sub    $0x14,%esp
+  802577:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80257b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80257f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802583:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802587:	89 fb                	mov    %edi,%ebx
+  802589:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80258d:	09 f3                	or     %esi,%ebx
+  80258f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802593:	0f 84 85 00 00 00    	je     80261e <__udivdi3+0xae>
+  802599:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8025a0:	00 
+  8025a1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8025a6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8025ad:	00 
+  8025ae:	89 34 24             	mov    %esi,(%esp)
+  8025b1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8025b5:	8d 76 00             	lea    0x0(%esi),%esi
+  8025b8:	89 e9                	mov    %ebp,%ecx
+  8025ba:	89 c3                	mov    %eax,%ebx
+  8025bc:	89 d6                	mov    %edx,%esi
+  8025be:	31 ff                	xor    %edi,%edi
+  8025c0:	d3 ee                	shr    %cl,%esi
+  8025c2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8025c5:	f6 c1 20             	test   $0x20,%cl
+  8025c8:	0f 45 de             	cmovne %esi,%ebx
+  8025cb:	0f 45 f7             	cmovne %edi,%esi
+  8025ce:	8b 3c 24             	mov    (%esp),%edi
+  8025d1:	39 fb                	cmp    %edi,%ebx
+  8025d3:	89 f7                	mov    %esi,%edi
+  8025d5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8025d9:	8b 1c 24             	mov    (%esp),%ebx
+  8025dc:	19 f7                	sbb    %esi,%edi
+  8025de:	72 39                	jb     802619 <__udivdi3+0xa9>
+  8025e0:	89 e9                	mov    %ebp,%ecx
+  8025e2:	89 f7                	mov    %esi,%edi
+  8025e4:	89 de                	mov    %ebx,%esi
+  8025e6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8025e9:	d3 e6                	shl    %cl,%esi
+  8025eb:	31 db                	xor    %ebx,%ebx
+  8025ed:	f6 c1 20             	test   $0x20,%cl
+  8025f0:	0f 45 fe             	cmovne %esi,%edi
+  8025f3:	0f 45 f3             	cmovne %ebx,%esi
+  8025f6:	29 f0                	sub    %esi,%eax
+  8025f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8025fd:	19 fa                	sbb    %edi,%edx
+  8025ff:	31 ff                	xor    %edi,%edi
+  802601:	31 db                	xor    %ebx,%ebx
+  802603:	0f a5 f7             	shld   %cl,%esi,%edi
+  802606:	d3 e6                	shl    %cl,%esi
+  802608:	f6 c1 20             	test   $0x20,%cl
+  80260b:	0f 45 fe             	cmovne %esi,%edi
+  80260e:	0f 45 f3             	cmovne %ebx,%esi
+  802611:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802615:	09 74 24 08          	or     %esi,0x8(%esp)
+  802619:	83 ed 01             	sub    $0x1,%ebp
+  80261c:	73 9a                	jae    8025b8 <__udivdi3+0x48>
+  80261e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802622:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802626:	83 c4 14             	add    $0x14,%esp
+  802629:	5b                   	pop    %ebx
+  80262a:	5e                   	pop    %esi
+  80262b:	5f                   	pop    %edi
+  80262c:	5d                   	pop    %ebp
+  80262d:	c3                   	ret
+  80262e:	66 90                	xchg   %ax,%ax
+
+00802630 <__umoddi3>:
+  802630:	57                   	push   %edi
+  802631:	56                   	push   %esi
+  802632:	53                   	push   %ebx
+  802633:	83 ec 08             	sub    $0x8,%esp
+  802636:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80263a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80263e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802642:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802646:	89 f9                	mov    %edi,%ecx
+  802648:	89 34 24             	mov    %esi,(%esp)
+  80264b:	09 f1                	or     %esi,%ecx
+  80264d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802651:	74 53                	je     8026a6 <__umoddi3+0x76>
+  802653:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80265f:	90                   	nop
+  802660:	89 c6                	mov    %eax,%esi
+  802662:	89 d7                	mov    %edx,%edi
+  802664:	31 db                	xor    %ebx,%ebx
+  802666:	d3 ef                	shr    %cl,%edi
+  802668:	0f ad d6             	shrd   %cl,%edx,%esi
+  80266b:	f6 c1 20             	test   $0x20,%cl
+  80266e:	0f 45 f7             	cmovne %edi,%esi
+  802671:	0f 45 fb             	cmovne %ebx,%edi
+  802674:	8b 1c 24             	mov    (%esp),%ebx
+  802677:	39 de                	cmp    %ebx,%esi
+  802679:	89 fb                	mov    %edi,%ebx
+  80267b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80267f:	8b 34 24             	mov    (%esp),%esi
+  802682:	19 fb                	sbb    %edi,%ebx
+  802684:	72 14                	jb     80269a <__umoddi3+0x6a>
+  802686:	0f a5 f7             	shld   %cl,%esi,%edi
+  802689:	31 db                	xor    %ebx,%ebx
+  80268b:	d3 e6                	shl    %cl,%esi
+  80268d:	f6 c1 20             	test   $0x20,%cl
+  802690:	0f 45 fe             	cmovne %esi,%edi
+  802693:	0f 45 f3             	cmovne %ebx,%esi
+  802696:	29 f0                	sub    %esi,%eax
+  802698:	19 fa                	sbb    %edi,%edx
+  80269a:	83 e9 01             	sub    $0x1,%ecx
+  80269d:	73 c1                	jae    802660 <__umoddi3+0x30>
+  80269f:	83 c4 08             	add    $0x8,%esp
+  8026a2:	5b                   	pop    %ebx
+  8026a3:	5e                   	pop    %esi
+  8026a4:	5f                   	pop    %edi
+  8026a5:	c3                   	ret
+  8026a6:	83 c4 08             	add    $0x8,%esp
+  8026a9:	31 c0                	xor    %eax,%eax
+  8026ab:	31 d2                	xor    %edx,%edx
+  8026ad:	5b                   	pop    %ebx
+  8026ae:	5e                   	pop    %esi
+  8026af:	5f                   	pop    %edi
+  8026b0:	c3                   	ret
+  8026b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026bf:	90                   	nop
+
+008026c0 <__divdi3>:
+  8026c0:	55                   	push   %ebp
+  8026c1:	57                   	push   %edi
+  8026c2:	56                   	push   %esi
+  8026c3:	53                   	push   %ebx
+  8026c4:	83 ec 1c             	sub    $0x1c,%esp
+  8026c7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8026cb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8026cf:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8026d3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8026d7:	85 ff                	test   %edi,%edi
+  8026d9:	0f 88 da 00 00 00    	js     8027b9 <__divdi3+0xf9>
+  8026df:	85 db                	test   %ebx,%ebx
+  8026e1:	78 16                	js     8026f9 <__divdi3+0x39>
+  8026e3:	89 dd                	mov    %ebx,%ebp
+  8026e5:	89 c8                	mov    %ecx,%eax
+  8026e7:	89 da                	mov    %ebx,%edx
+  8026e9:	09 cd                	or     %ecx,%ebp
+  8026eb:	0f 85 fd 00 00 00    	jne    8027ee <__divdi3+0x12e>
+  8026f1:	83 c4 1c             	add    $0x1c,%esp
+  8026f4:	5b                   	pop    %ebx
+  8026f5:	5e                   	pop    %esi
+  8026f6:	5f                   	pop    %edi
+  8026f7:	5d                   	pop    %ebp
+  8026f8:	c3                   	ret
+  8026f9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8026fe:	f7 d9                	neg    %ecx
+  802700:	89 f0                	mov    %esi,%eax
+  802702:	89 fa                	mov    %edi,%edx
+  802704:	83 d3 00             	adc    $0x0,%ebx
+  802707:	89 0c 24             	mov    %ecx,(%esp)
+  80270a:	f7 db                	neg    %ebx
+  80270c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802710:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802717:	00 
+  802718:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80271d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802724:	00 
+  802725:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802729:	89 cd                	mov    %ecx,%ebp
+  80272b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80272f:	90                   	nop
+  802730:	89 e9                	mov    %ebp,%ecx
+  802732:	89 c3                	mov    %eax,%ebx
+  802734:	89 d6                	mov    %edx,%esi
+  802736:	31 ff                	xor    %edi,%edi
+  802738:	d3 ee                	shr    %cl,%esi
+  80273a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80273d:	f6 c1 20             	test   $0x20,%cl
+  802740:	0f 45 de             	cmovne %esi,%ebx
+  802743:	0f 45 f7             	cmovne %edi,%esi
+  802746:	8b 3c 24             	mov    (%esp),%edi
+  802749:	39 fb                	cmp    %edi,%ebx
+  80274b:	89 f7                	mov    %esi,%edi
+  80274d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802751:	8b 1c 24             	mov    (%esp),%ebx
+  802754:	19 f7                	sbb    %esi,%edi
+  802756:	72 39                	jb     802791 <__divdi3+0xd1>
+  802758:	89 e9                	mov    %ebp,%ecx
+  80275a:	89 f7                	mov    %esi,%edi
+  80275c:	89 de                	mov    %ebx,%esi
+  80275e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802761:	d3 e6                	shl    %cl,%esi
+  802763:	31 db                	xor    %ebx,%ebx
+  802765:	f6 c1 20             	test   $0x20,%cl
+  802768:	0f 45 fe             	cmovne %esi,%edi
+  80276b:	0f 45 f3             	cmovne %ebx,%esi
+  80276e:	29 f0                	sub    %esi,%eax
+  802770:	be 01 00 00 00       	mov    $0x1,%esi
+  802775:	19 fa                	sbb    %edi,%edx
+  802777:	31 ff                	xor    %edi,%edi
+  802779:	31 db                	xor    %ebx,%ebx
+  80277b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80277e:	d3 e6                	shl    %cl,%esi
+  802780:	f6 c1 20             	test   $0x20,%cl
+  802783:	0f 45 fe             	cmovne %esi,%edi
+  802786:	0f 45 f3             	cmovne %ebx,%esi
+  802789:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80278d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802791:	83 ed 01             	sub    $0x1,%ebp
+  802794:	73 9a                	jae    802730 <__divdi3+0x70>
+  802796:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80279a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80279e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027a2:	85 ed                	test   %ebp,%ebp
+  8027a4:	0f 84 47 ff ff ff    	je     8026f1 <__divdi3+0x31>
+  8027aa:	f7 d8                	neg    %eax
+  8027ac:	83 d2 00             	adc    $0x0,%edx
+  8027af:	83 c4 1c             	add    $0x1c,%esp
+  8027b2:	5b                   	pop    %ebx
+  8027b3:	f7 da                	neg    %edx
+  8027b5:	5e                   	pop    %esi
+  8027b6:	5f                   	pop    %edi
+  8027b7:	5d                   	pop    %ebp
+  8027b8:	c3                   	ret
+  8027b9:	f7 de                	neg    %esi
+  8027bb:	83 d7 00             	adc    $0x0,%edi
+  8027be:	f7 df                	neg    %edi
+  8027c0:	85 db                	test   %ebx,%ebx
+  8027c2:	78 23                	js     8027e7 <__divdi3+0x127>
+  8027c4:	89 dd                	mov    %ebx,%ebp
+  8027c6:	89 c8                	mov    %ecx,%eax
+  8027c8:	89 da                	mov    %ebx,%edx
+  8027ca:	09 cd                	or     %ecx,%ebp
+  8027cc:	0f 84 1f ff ff ff    	je     8026f1 <__divdi3+0x31>
+  8027d2:	89 0c 24             	mov    %ecx,(%esp)
+  8027d5:	89 f0                	mov    %esi,%eax
+  8027d7:	89 fa                	mov    %edi,%edx
+  8027d9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8027de:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8027e2:	e9 29 ff ff ff       	jmp    802710 <__divdi3+0x50>
+  8027e7:	31 ed                	xor    %ebp,%ebp
+  8027e9:	e9 10 ff ff ff       	jmp    8026fe <__divdi3+0x3e>
+  8027ee:	89 0c 24             	mov    %ecx,(%esp)
+  8027f1:	89 f0                	mov    %esi,%eax
+  8027f3:	89 fa                	mov    %edi,%edx
+  8027f5:	31 ed                	xor    %ebp,%ebp
+  8027f7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8027fb:	e9 10 ff ff ff       	jmp    802710 <__divdi3+0x50>
+
+00802800 <__moddi3>:
+  802800:	55                   	push   %ebp
+  802801:	57                   	push   %edi
+  802802:	56                   	push   %esi
+  802803:	53                   	push   %ebx
+  802804:	83 ec 14             	sub    $0x14,%esp
+  802807:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80280b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80280f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802813:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802817:	85 d2                	test   %edx,%edx
+  802819:	0f 88 9b 00 00 00    	js     8028ba <__moddi3+0xba>
+  80281f:	89 f7                	mov    %esi,%edi
+  802821:	31 ed                	xor    %ebp,%ebp
+  802823:	09 cf                	or     %ecx,%edi
+  802825:	0f 84 83 00 00 00    	je     8028ae <__moddi3+0xae>
+  80282b:	89 cb                	mov    %ecx,%ebx
+  80282d:	89 f7                	mov    %esi,%edi
+  80282f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802833:	f7 db                	neg    %ebx
+  802835:	83 d7 00             	adc    $0x0,%edi
+  802838:	f7 df                	neg    %edi
+  80283a:	0f 49 f7             	cmovns %edi,%esi
+  80283d:	0f 49 cb             	cmovns %ebx,%ecx
+  802840:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802844:	89 0c 24             	mov    %ecx,(%esp)
+  802847:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80284c:	89 cd                	mov    %ecx,%ebp
+  80284e:	66 90                	xchg   %ax,%ax
+  802850:	89 e9                	mov    %ebp,%ecx
+  802852:	89 c3                	mov    %eax,%ebx
+  802854:	89 d6                	mov    %edx,%esi
+  802856:	31 ff                	xor    %edi,%edi
+  802858:	d3 ee                	shr    %cl,%esi
+  80285a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80285d:	f6 c1 20             	test   $0x20,%cl
+  802860:	0f 45 de             	cmovne %esi,%ebx
+  802863:	0f 45 f7             	cmovne %edi,%esi
+  802866:	8b 3c 24             	mov    (%esp),%edi
+  802869:	39 fb                	cmp    %edi,%ebx
+  80286b:	89 f7                	mov    %esi,%edi
+  80286d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802871:	8b 1c 24             	mov    (%esp),%ebx
+  802874:	19 f7                	sbb    %esi,%edi
+  802876:	72 1a                	jb     802892 <__moddi3+0x92>
+  802878:	89 e9                	mov    %ebp,%ecx
+  80287a:	89 f7                	mov    %esi,%edi
+  80287c:	89 de                	mov    %ebx,%esi
+  80287e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802881:	d3 e6                	shl    %cl,%esi
+  802883:	31 db                	xor    %ebx,%ebx
+  802885:	f6 c1 20             	test   $0x20,%cl
+  802888:	0f 45 fe             	cmovne %esi,%edi
+  80288b:	0f 45 f3             	cmovne %ebx,%esi
+  80288e:	29 f0                	sub    %esi,%eax
+  802890:	19 fa                	sbb    %edi,%edx
+  802892:	83 ed 01             	sub    $0x1,%ebp
+  802895:	73 b9                	jae    802850 <__moddi3+0x50>
+  802897:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80289b:	85 ed                	test   %ebp,%ebp
+  80289d:	74 07                	je     8028a6 <__moddi3+0xa6>
+  80289f:	f7 d8                	neg    %eax
+  8028a1:	83 d2 00             	adc    $0x0,%edx
+  8028a4:	f7 da                	neg    %edx
+  8028a6:	83 c4 14             	add    $0x14,%esp
+  8028a9:	5b                   	pop    %ebx
+  8028aa:	5e                   	pop    %esi
+  8028ab:	5f                   	pop    %edi
+  8028ac:	5d                   	pop    %ebp
+  8028ad:	c3                   	ret
+  8028ae:	83 c4 14             	add    $0x14,%esp
+  8028b1:	31 c0                	xor    %eax,%eax
+  8028b3:	31 d2                	xor    %edx,%edx
+  8028b5:	5b                   	pop    %ebx
+  8028b6:	5e                   	pop    %esi
+  8028b7:	5f                   	pop    %edi
+  8028b8:	5d                   	pop    %ebp
+  8028b9:	c3                   	ret
+  8028ba:	89 f7                	mov    %esi,%edi
+  8028bc:	09 cf                	or     %ecx,%edi
+  8028be:	74 11                	je     8028d1 <__moddi3+0xd1>
+  8028c0:	f7 d8                	neg    %eax
+  8028c2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8028c7:	83 d2 00             	adc    $0x0,%edx
+  8028ca:	f7 da                	neg    %edx
+  8028cc:	e9 5a ff ff ff       	jmp    80282b <__moddi3+0x2b>
+  8028d1:	31 c0                	xor    %eax,%eax
+  8028d3:	31 d2                	xor    %edx,%edx
+  8028d5:	eb c8                	jmp    80289f <__moddi3+0x9f>
@@ -0,0 +1,5946 @@
+
+obj/user/testkbd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2a 02 00 00       	call   80025b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	int i, r;
+
+	// Spin for a bit to let the console quiet
+	for (i = 0; i < 10; ++i)
+  80003a:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80003f:	eb 05                	jmp    800046 <umain+0x13>
+		sys_yield();
+  800041:	e8 1b 0e 00 00       	call   800e61 <sys_yield>
+	for (i = 0; i < 10; ++i)
+  800046:	83 eb 01             	sub    $0x1,%ebx
+  800049:	75 f6                	jne    800041 <umain+0xe>
+
+	close(0);
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	e8 58 14 00 00       	call   8014ad <close>
+	if ((r = opencons()) < 0)
+  800055:	e8 af 01 00 00       	call   800209 <opencons>
+  80005a:	83 c4 10             	add    $0x10,%esp
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	78 14                	js     800075 <umain+0x42>
+		panic("opencons: %e", r);
+	if (r != 0)
+  800061:	74 24                	je     800087 <umain+0x54>
+		panic("first opencons used fd %d", r);
+  800063:	50                   	push   %eax
+  800064:	68 3c 29 80 00       	push   $0x80293c
+  800069:	6a 11                	push   $0x11
+  80006b:	68 2d 29 80 00       	push   $0x80292d
+  800070:	e8 46 02 00 00       	call   8002bb <_panic>
+		panic("opencons: %e", r);
+  800075:	50                   	push   %eax
+  800076:	68 20 29 80 00       	push   $0x802920
+  80007b:	6a 0f                	push   $0xf
+  80007d:	68 2d 29 80 00       	push   $0x80292d
+  800082:	e8 34 02 00 00       	call   8002bb <_panic>
+	if ((r = dup(0, 1)) < 0)
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	6a 01                	push   $0x1
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 6c 14 00 00       	call   8014ff <dup>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	85 c0                	test   %eax,%eax
+  800098:	79 25                	jns    8000bf <umain+0x8c>
+		panic("dup: %e", r);
+  80009a:	50                   	push   %eax
+  80009b:	68 56 29 80 00       	push   $0x802956
+  8000a0:	6a 13                	push   $0x13
+  8000a2:	68 2d 29 80 00       	push   $0x80292d
+  8000a7:	e8 0f 02 00 00       	call   8002bb <_panic>
+	for(;;){
+		char *buf;
+
+		buf = readline("Type a line: ");
+		if (buf != NULL)
+			fprintf(1, "%s\n", buf);
+  8000ac:	83 ec 04             	sub    $0x4,%esp
+  8000af:	50                   	push   %eax
+  8000b0:	68 6c 29 80 00       	push   $0x80296c
+  8000b5:	6a 01                	push   $0x1
+  8000b7:	e8 1c 1b 00 00       	call   801bd8 <fprintf>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+		buf = readline("Type a line: ");
+  8000bf:	83 ec 0c             	sub    $0xc,%esp
+  8000c2:	68 5e 29 80 00       	push   $0x80295e
+  8000c7:	e8 7d 08 00 00       	call   800949 <readline>
+		if (buf != NULL)
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	85 c0                	test   %eax,%eax
+  8000d1:	75 d9                	jne    8000ac <umain+0x79>
+		else
+			fprintf(1, "(end of file received)\n");
+  8000d3:	83 ec 08             	sub    $0x8,%esp
+  8000d6:	68 70 29 80 00       	push   $0x802970
+  8000db:	6a 01                	push   $0x1
+  8000dd:	e8 f6 1a 00 00       	call   801bd8 <fprintf>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	eb d8                	jmp    8000bf <umain+0x8c>
+
+008000e7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8000e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ec:	c3                   	ret
+
+008000ed <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8000f3:	68 88 29 80 00       	push   $0x802988
+  8000f8:	ff 75 0c             	push   0xc(%ebp)
+  8000fb:	e8 74 09 00 00       	call   800a74 <strcpy>
+	return 0;
+}
+  800100:	b8 00 00 00 00       	mov    $0x0,%eax
+  800105:	c9                   	leave
+  800106:	c3                   	ret
+
+00800107 <devcons_write>:
+{
+  800107:	55                   	push   %ebp
+  800108:	89 e5                	mov    %esp,%ebp
+  80010a:	57                   	push   %edi
+  80010b:	56                   	push   %esi
+  80010c:	53                   	push   %ebx
+  80010d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800113:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800118:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80011e:	eb 2e                	jmp    80014e <devcons_write+0x47>
+		m = n - tot;
+  800120:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800123:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  800125:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80012a:	39 c3                	cmp    %eax,%ebx
+  80012c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80012f:	83 ec 04             	sub    $0x4,%esp
+  800132:	53                   	push   %ebx
+  800133:	89 f0                	mov    %esi,%eax
+  800135:	03 45 0c             	add    0xc(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	57                   	push   %edi
+  80013a:	e8 bb 0a 00 00       	call   800bfa <memmove>
+		sys_cputs(buf, m);
+  80013f:	83 c4 08             	add    $0x8,%esp
+  800142:	53                   	push   %ebx
+  800143:	57                   	push   %edi
+  800144:	e8 5b 0c 00 00       	call   800da4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800149:	01 de                	add    %ebx,%esi
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800151:	72 cd                	jb     800120 <devcons_write+0x19>
+}
+  800153:	89 f0                	mov    %esi,%eax
+  800155:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800158:	5b                   	pop    %ebx
+  800159:	5e                   	pop    %esi
+  80015a:	5f                   	pop    %edi
+  80015b:	5d                   	pop    %ebp
+  80015c:	c3                   	ret
+
+0080015d <devcons_read>:
+{
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80016c:	75 07                	jne    800175 <devcons_read+0x18>
+  80016e:	eb 1f                	jmp    80018f <devcons_read+0x32>
+		sys_yield();
+  800170:	e8 ec 0c 00 00       	call   800e61 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  800175:	e8 48 0c 00 00       	call   800dc2 <sys_cgetc>
+  80017a:	85 c0                	test   %eax,%eax
+  80017c:	74 f2                	je     800170 <devcons_read+0x13>
+	if (c < 0)
+  80017e:	78 0f                	js     80018f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  800180:	83 f8 04             	cmp    $0x4,%eax
+  800183:	74 0c                	je     800191 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  800185:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800188:	88 02                	mov    %al,(%edx)
+	return 1;
+  80018a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+		return 0;
+  800191:	b8 00 00 00 00       	mov    $0x0,%eax
+  800196:	eb f7                	jmp    80018f <devcons_read+0x32>
+
+00800198 <cputchar>:
+{
+  800198:	55                   	push   %ebp
+  800199:	89 e5                	mov    %esp,%ebp
+  80019b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80019e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001a1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8001a4:	6a 01                	push   $0x1
+  8001a6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 f5 0b 00 00       	call   800da4 <sys_cputs>
+}
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	c9                   	leave
+  8001b3:	c3                   	ret
+
+008001b4 <getchar>:
+{
+  8001b4:	55                   	push   %ebp
+  8001b5:	89 e5                	mov    %esp,%ebp
+  8001b7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8001ba:	6a 01                	push   $0x1
+  8001bc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001bf:	50                   	push   %eax
+  8001c0:	6a 00                	push   $0x0
+  8001c2:	e8 22 14 00 00       	call   8015e9 <read>
+	if (r < 0)
+  8001c7:	83 c4 10             	add    $0x10,%esp
+  8001ca:	85 c0                	test   %eax,%eax
+  8001cc:	78 06                	js     8001d4 <getchar+0x20>
+	if (r < 1)
+  8001ce:	74 06                	je     8001d6 <getchar+0x22>
+	return c;
+  8001d0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8001d4:	c9                   	leave
+  8001d5:	c3                   	ret
+		return -E_EOF;
+  8001d6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8001db:	eb f7                	jmp    8001d4 <getchar+0x20>
+
+008001dd <iscons>:
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8001e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8001e6:	50                   	push   %eax
+  8001e7:	ff 75 08             	push   0x8(%ebp)
+  8001ea:	e8 94 11 00 00       	call   801383 <fd_lookup>
+  8001ef:	83 c4 10             	add    $0x10,%esp
+  8001f2:	85 c0                	test   %eax,%eax
+  8001f4:	78 11                	js     800207 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8001f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001f9:	8b 15 00 30 80 00    	mov    0x803000,%edx
+  8001ff:	39 10                	cmp    %edx,(%eax)
+  800201:	0f 94 c0             	sete   %al
+  800204:	0f b6 c0             	movzbl %al,%eax
+}
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <opencons>:
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80020f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800212:	50                   	push   %eax
+  800213:	e8 15 11 00 00       	call   80132d <fd_alloc>
+  800218:	83 c4 10             	add    $0x10,%esp
+  80021b:	85 c0                	test   %eax,%eax
+  80021d:	78 3a                	js     800259 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80021f:	83 ec 04             	sub    $0x4,%esp
+  800222:	68 07 04 00 00       	push   $0x407
+  800227:	ff 75 f4             	push   -0xc(%ebp)
+  80022a:	6a 00                	push   $0x0
+  80022c:	e8 b0 0c 00 00       	call   800ee1 <sys_page_alloc>
+  800231:	83 c4 10             	add    $0x10,%esp
+  800234:	85 c0                	test   %eax,%eax
+  800236:	78 21                	js     800259 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800238:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80023b:	8b 15 00 30 80 00    	mov    0x803000,%edx
+  800241:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800246:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	50                   	push   %eax
+  800251:	e8 b0 10 00 00       	call   801306 <fd2num>
+  800256:	83 c4 10             	add    $0x10,%esp
+}
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+0080025b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80025b:	55                   	push   %ebp
+  80025c:	89 e5                	mov    %esp,%ebp
+  80025e:	56                   	push   %esi
+  80025f:	53                   	push   %ebx
+  800260:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800263:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800266:	e8 d7 0b 00 00       	call   800e42 <sys_getenvid>
+  80026b:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800270:	c1 e0 09             	shl    $0x9,%eax
+  800273:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800278:	a3 08 44 80 00       	mov    %eax,0x804408
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80027d:	85 db                	test   %ebx,%ebx
+  80027f:	7e 07                	jle    800288 <libmain+0x2d>
+		binaryname = argv[0];
+  800281:	8b 06                	mov    (%esi),%eax
+  800283:	a3 1c 30 80 00       	mov    %eax,0x80301c
+
+	// call user main routine
+	umain(argc, argv);
+  800288:	83 ec 08             	sub    $0x8,%esp
+  80028b:	56                   	push   %esi
+  80028c:	53                   	push   %ebx
+  80028d:	e8 a1 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800292:	e8 0a 00 00 00       	call   8002a1 <exit>
+}
+  800297:	83 c4 10             	add    $0x10,%esp
+  80029a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80029d:	5b                   	pop    %ebx
+  80029e:	5e                   	pop    %esi
+  80029f:	5d                   	pop    %ebp
+  8002a0:	c3                   	ret
+
+008002a1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002a1:	55                   	push   %ebp
+  8002a2:	89 e5                	mov    %esp,%ebp
+  8002a4:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002a7:	e8 2e 12 00 00       	call   8014da <close_all>
+	sys_env_destroy(0);
+  8002ac:	83 ec 0c             	sub    $0xc,%esp
+  8002af:	6a 00                	push   $0x0
+  8002b1:	e8 4b 0b 00 00       	call   800e01 <sys_env_destroy>
+}
+  8002b6:	83 c4 10             	add    $0x10,%esp
+  8002b9:	c9                   	leave
+  8002ba:	c3                   	ret
+
+008002bb <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002bb:	55                   	push   %ebp
+  8002bc:	89 e5                	mov    %esp,%ebp
+  8002be:	56                   	push   %esi
+  8002bf:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002c0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002c3:	8b 35 1c 30 80 00    	mov    0x80301c,%esi
+  8002c9:	e8 74 0b 00 00       	call   800e42 <sys_getenvid>
+  8002ce:	83 ec 0c             	sub    $0xc,%esp
+  8002d1:	ff 75 0c             	push   0xc(%ebp)
+  8002d4:	ff 75 08             	push   0x8(%ebp)
+  8002d7:	56                   	push   %esi
+  8002d8:	50                   	push   %eax
+  8002d9:	68 a0 29 80 00       	push   $0x8029a0
+  8002de:	e8 b3 00 00 00       	call   800396 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002e3:	83 c4 18             	add    $0x18,%esp
+  8002e6:	53                   	push   %ebx
+  8002e7:	ff 75 10             	push   0x10(%ebp)
+  8002ea:	e8 56 00 00 00       	call   800345 <vcprintf>
+	cprintf("\n");
+  8002ef:	c7 04 24 86 29 80 00 	movl   $0x802986,(%esp)
+  8002f6:	e8 9b 00 00 00       	call   800396 <cprintf>
+  8002fb:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002fe:	cc                   	int3
+	while (1)
+  8002ff:	eb fd                	jmp    8002fe <_panic+0x43>
+
+00800301 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800301:	55                   	push   %ebp
+  800302:	89 e5                	mov    %esp,%ebp
+  800304:	53                   	push   %ebx
+  800305:	83 ec 04             	sub    $0x4,%esp
+  800308:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80030b:	8b 13                	mov    (%ebx),%edx
+  80030d:	8d 42 01             	lea    0x1(%edx),%eax
+  800310:	89 03                	mov    %eax,(%ebx)
+  800312:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800315:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800319:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80031e:	74 09                	je     800329 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800320:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800324:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800327:	c9                   	leave
+  800328:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800329:	83 ec 08             	sub    $0x8,%esp
+  80032c:	68 ff 00 00 00       	push   $0xff
+  800331:	8d 43 08             	lea    0x8(%ebx),%eax
+  800334:	50                   	push   %eax
+  800335:	e8 6a 0a 00 00       	call   800da4 <sys_cputs>
+		b->idx = 0;
+  80033a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800340:	83 c4 10             	add    $0x10,%esp
+  800343:	eb db                	jmp    800320 <putch+0x1f>
+
+00800345 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800345:	55                   	push   %ebp
+  800346:	89 e5                	mov    %esp,%ebp
+  800348:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80034e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800355:	00 00 00 
+	b.cnt = 0;
+  800358:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80035f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800362:	ff 75 0c             	push   0xc(%ebp)
+  800365:	ff 75 08             	push   0x8(%ebp)
+  800368:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80036e:	50                   	push   %eax
+  80036f:	68 01 03 80 00       	push   $0x800301
+  800374:	e8 14 01 00 00       	call   80048d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800379:	83 c4 08             	add    $0x8,%esp
+  80037c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800382:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800388:	50                   	push   %eax
+  800389:	e8 16 0a 00 00       	call   800da4 <sys_cputs>
+
+	return b.cnt;
+}
+  80038e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800394:	c9                   	leave
+  800395:	c3                   	ret
+
+00800396 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800396:	55                   	push   %ebp
+  800397:	89 e5                	mov    %esp,%ebp
+  800399:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80039c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80039f:	50                   	push   %eax
+  8003a0:	ff 75 08             	push   0x8(%ebp)
+  8003a3:	e8 9d ff ff ff       	call   800345 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003a8:	c9                   	leave
+  8003a9:	c3                   	ret
+
+008003aa <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003aa:	55                   	push   %ebp
+  8003ab:	89 e5                	mov    %esp,%ebp
+  8003ad:	57                   	push   %edi
+  8003ae:	56                   	push   %esi
+  8003af:	53                   	push   %ebx
+  8003b0:	83 ec 1c             	sub    $0x1c,%esp
+  8003b3:	89 c7                	mov    %eax,%edi
+  8003b5:	89 d6                	mov    %edx,%esi
+  8003b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003bd:	89 d1                	mov    %edx,%ecx
+  8003bf:	89 c2                	mov    %eax,%edx
+  8003c1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003c4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003c7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003ca:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003d7:	39 c2                	cmp    %eax,%edx
+  8003d9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003dc:	72 3e                	jb     80041c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003de:	83 ec 0c             	sub    $0xc,%esp
+  8003e1:	ff 75 18             	push   0x18(%ebp)
+  8003e4:	83 eb 01             	sub    $0x1,%ebx
+  8003e7:	53                   	push   %ebx
+  8003e8:	50                   	push   %eax
+  8003e9:	83 ec 08             	sub    $0x8,%esp
+  8003ec:	ff 75 e4             	push   -0x1c(%ebp)
+  8003ef:	ff 75 e0             	push   -0x20(%ebp)
+  8003f2:	ff 75 dc             	push   -0x24(%ebp)
+  8003f5:	ff 75 d8             	push   -0x28(%ebp)
+  8003f8:	e8 b3 21 00 00       	call   8025b0 <__udivdi3>
+  8003fd:	83 c4 18             	add    $0x18,%esp
+  800400:	52                   	push   %edx
+  800401:	50                   	push   %eax
+  800402:	89 f2                	mov    %esi,%edx
+  800404:	89 f8                	mov    %edi,%eax
+  800406:	e8 9f ff ff ff       	call   8003aa <printnum>
+  80040b:	83 c4 20             	add    $0x20,%esp
+  80040e:	eb 13                	jmp    800423 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800410:	83 ec 08             	sub    $0x8,%esp
+  800413:	56                   	push   %esi
+  800414:	ff 75 18             	push   0x18(%ebp)
+  800417:	ff d7                	call   *%edi
+  800419:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80041c:	83 eb 01             	sub    $0x1,%ebx
+  80041f:	85 db                	test   %ebx,%ebx
+  800421:	7f ed                	jg     800410 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800423:	83 ec 08             	sub    $0x8,%esp
+  800426:	56                   	push   %esi
+  800427:	83 ec 04             	sub    $0x4,%esp
+  80042a:	ff 75 e4             	push   -0x1c(%ebp)
+  80042d:	ff 75 e0             	push   -0x20(%ebp)
+  800430:	ff 75 dc             	push   -0x24(%ebp)
+  800433:	ff 75 d8             	push   -0x28(%ebp)
+  800436:	e8 35 22 00 00       	call   802670 <__umoddi3>
+  80043b:	83 c4 14             	add    $0x14,%esp
+  80043e:	0f be 80 c3 29 80 00 	movsbl 0x8029c3(%eax),%eax
+  800445:	50                   	push   %eax
+  800446:	ff d7                	call   *%edi
+}
+  800448:	83 c4 10             	add    $0x10,%esp
+  80044b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80044e:	5b                   	pop    %ebx
+  80044f:	5e                   	pop    %esi
+  800450:	5f                   	pop    %edi
+  800451:	5d                   	pop    %ebp
+  800452:	c3                   	ret
+
+00800453 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800453:	55                   	push   %ebp
+  800454:	89 e5                	mov    %esp,%ebp
+  800456:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800459:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80045d:	8b 10                	mov    (%eax),%edx
+  80045f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800462:	73 0a                	jae    80046e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800464:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800467:	89 08                	mov    %ecx,(%eax)
+  800469:	8b 45 08             	mov    0x8(%ebp),%eax
+  80046c:	88 02                	mov    %al,(%edx)
+}
+  80046e:	5d                   	pop    %ebp
+  80046f:	c3                   	ret
+
+00800470 <printfmt>:
+{
+  800470:	55                   	push   %ebp
+  800471:	89 e5                	mov    %esp,%ebp
+  800473:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800476:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800479:	50                   	push   %eax
+  80047a:	ff 75 10             	push   0x10(%ebp)
+  80047d:	ff 75 0c             	push   0xc(%ebp)
+  800480:	ff 75 08             	push   0x8(%ebp)
+  800483:	e8 05 00 00 00       	call   80048d <vprintfmt>
+}
+  800488:	83 c4 10             	add    $0x10,%esp
+  80048b:	c9                   	leave
+  80048c:	c3                   	ret
+
+0080048d <vprintfmt>:
+{
+  80048d:	55                   	push   %ebp
+  80048e:	89 e5                	mov    %esp,%ebp
+  800490:	57                   	push   %edi
+  800491:	56                   	push   %esi
+  800492:	53                   	push   %ebx
+  800493:	83 ec 2c             	sub    $0x2c,%esp
+  800496:	8b 75 08             	mov    0x8(%ebp),%esi
+  800499:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80049c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80049f:	eb 0a                	jmp    8004ab <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8004a1:	83 ec 08             	sub    $0x8,%esp
+  8004a4:	53                   	push   %ebx
+  8004a5:	50                   	push   %eax
+  8004a6:	ff d6                	call   *%esi
+  8004a8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004ab:	83 c7 01             	add    $0x1,%edi
+  8004ae:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8004b2:	83 f8 25             	cmp    $0x25,%eax
+  8004b5:	74 0c                	je     8004c3 <vprintfmt+0x36>
+			if (ch == '\0')
+  8004b7:	85 c0                	test   %eax,%eax
+  8004b9:	75 e6                	jne    8004a1 <vprintfmt+0x14>
+}
+  8004bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004be:	5b                   	pop    %ebx
+  8004bf:	5e                   	pop    %esi
+  8004c0:	5f                   	pop    %edi
+  8004c1:	5d                   	pop    %ebp
+  8004c2:	c3                   	ret
+		padc = ' ';
+  8004c3:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004c7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004ce:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004d5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e1:	8d 47 01             	lea    0x1(%edi),%eax
+  8004e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004e7:	0f b6 17             	movzbl (%edi),%edx
+  8004ea:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004ed:	3c 55                	cmp    $0x55,%al
+  8004ef:	0f 87 cf 03 00 00    	ja     8008c4 <vprintfmt+0x437>
+  8004f5:	0f b6 c0             	movzbl %al,%eax
+  8004f8:	ff 24 85 00 2b 80 00 	jmp    *0x802b00(,%eax,4)
+  8004ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800502:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800506:	eb d9                	jmp    8004e1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800508:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80050b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80050f:	eb d0                	jmp    8004e1 <vprintfmt+0x54>
+  800511:	0f b6 d2             	movzbl %dl,%edx
+  800514:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800517:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80051f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800522:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800526:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800529:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80052c:	83 f9 09             	cmp    $0x9,%ecx
+  80052f:	77 55                	ja     800586 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800531:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800534:	eb e9                	jmp    80051f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800536:	8b 45 14             	mov    0x14(%ebp),%eax
+  800539:	8b 00                	mov    (%eax),%eax
+  80053b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8d 40 04             	lea    0x4(%eax),%eax
+  800544:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800547:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80054a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80054e:	79 91                	jns    8004e1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800550:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800553:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800556:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80055d:	eb 82                	jmp    8004e1 <vprintfmt+0x54>
+			if (width < 0)
+  80055f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800562:	85 d2                	test   %edx,%edx
+  800564:	b8 00 00 00 00       	mov    $0x0,%eax
+  800569:	0f 49 c2             	cmovns %edx,%eax
+  80056c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80056f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800572:	e9 6a ff ff ff       	jmp    8004e1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800577:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80057a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800581:	e9 5b ff ff ff       	jmp    8004e1 <vprintfmt+0x54>
+  800586:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800589:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80058c:	eb bc                	jmp    80054a <vprintfmt+0xbd>
+			lflag++;
+  80058e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800591:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800594:	e9 48 ff ff ff       	jmp    8004e1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059c:	8d 78 04             	lea    0x4(%eax),%edi
+  80059f:	83 ec 08             	sub    $0x8,%esp
+  8005a2:	53                   	push   %ebx
+  8005a3:	ff 30                	push   (%eax)
+  8005a5:	ff d6                	call   *%esi
+			break;
+  8005a7:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005aa:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8005ad:	e9 b1 02 00 00       	jmp    800863 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8005b8:	8b 10                	mov    (%eax),%edx
+  8005ba:	89 d0                	mov    %edx,%eax
+  8005bc:	f7 d8                	neg    %eax
+  8005be:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005c1:	83 f8 0f             	cmp    $0xf,%eax
+  8005c4:	7f 23                	jg     8005e9 <vprintfmt+0x15c>
+  8005c6:	8b 14 85 60 2c 80 00 	mov    0x802c60(,%eax,4),%edx
+  8005cd:	85 d2                	test   %edx,%edx
+  8005cf:	74 18                	je     8005e9 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005d1:	52                   	push   %edx
+  8005d2:	68 a5 2d 80 00       	push   $0x802da5
+  8005d7:	53                   	push   %ebx
+  8005d8:	56                   	push   %esi
+  8005d9:	e8 92 fe ff ff       	call   800470 <printfmt>
+  8005de:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005e1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005e4:	e9 7a 02 00 00       	jmp    800863 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8005e9:	50                   	push   %eax
+  8005ea:	68 db 29 80 00       	push   $0x8029db
+  8005ef:	53                   	push   %ebx
+  8005f0:	56                   	push   %esi
+  8005f1:	e8 7a fe ff ff       	call   800470 <printfmt>
+  8005f6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005f9:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005fc:	e9 62 02 00 00       	jmp    800863 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800601:	8b 45 14             	mov    0x14(%ebp),%eax
+  800604:	83 c0 04             	add    $0x4,%eax
+  800607:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80060f:	85 c9                	test   %ecx,%ecx
+  800611:	b8 d4 29 80 00       	mov    $0x8029d4,%eax
+  800616:	0f 45 c1             	cmovne %ecx,%eax
+  800619:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80061c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800620:	7e 06                	jle    800628 <vprintfmt+0x19b>
+  800622:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800626:	75 0b                	jne    800633 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800628:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80062b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80062e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800631:	eb 5c                	jmp    80068f <vprintfmt+0x202>
+  800633:	83 ec 08             	sub    $0x8,%esp
+  800636:	ff 75 d0             	push   -0x30(%ebp)
+  800639:	ff 75 cc             	push   -0x34(%ebp)
+  80063c:	e8 10 04 00 00       	call   800a51 <strnlen>
+  800641:	89 c2                	mov    %eax,%edx
+  800643:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800646:	29 d0                	sub    %edx,%eax
+  800648:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80064b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80064f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800652:	89 75 08             	mov    %esi,0x8(%ebp)
+  800655:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800657:	eb 0e                	jmp    800667 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800659:	83 ec 08             	sub    $0x8,%esp
+  80065c:	53                   	push   %ebx
+  80065d:	57                   	push   %edi
+  80065e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800661:	83 ee 01             	sub    $0x1,%esi
+  800664:	83 c4 10             	add    $0x10,%esp
+  800667:	85 f6                	test   %esi,%esi
+  800669:	7f ee                	jg     800659 <vprintfmt+0x1cc>
+  80066b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80066e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800671:	85 c0                	test   %eax,%eax
+  800673:	ba 00 00 00 00       	mov    $0x0,%edx
+  800678:	0f 49 d0             	cmovns %eax,%edx
+  80067b:	29 d0                	sub    %edx,%eax
+  80067d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800680:	eb a6                	jmp    800628 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800682:	83 ec 08             	sub    $0x8,%esp
+  800685:	53                   	push   %ebx
+  800686:	52                   	push   %edx
+  800687:	ff 55 08             	call   *0x8(%ebp)
+  80068a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80068d:	89 f1                	mov    %esi,%ecx
+  80068f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800692:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800696:	0f be d0             	movsbl %al,%edx
+  800699:	85 d2                	test   %edx,%edx
+  80069b:	74 28                	je     8006c5 <vprintfmt+0x238>
+  80069d:	85 ff                	test   %edi,%edi
+  80069f:	78 05                	js     8006a6 <vprintfmt+0x219>
+  8006a1:	83 ef 01             	sub    $0x1,%edi
+  8006a4:	78 30                	js     8006d6 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006a6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006aa:	74 d6                	je     800682 <vprintfmt+0x1f5>
+  8006ac:	0f be c0             	movsbl %al,%eax
+  8006af:	83 e8 20             	sub    $0x20,%eax
+  8006b2:	83 f8 5e             	cmp    $0x5e,%eax
+  8006b5:	76 cb                	jbe    800682 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8006b7:	83 ec 08             	sub    $0x8,%esp
+  8006ba:	53                   	push   %ebx
+  8006bb:	6a 3f                	push   $0x3f
+  8006bd:	ff 55 08             	call   *0x8(%ebp)
+  8006c0:	83 c4 10             	add    $0x10,%esp
+  8006c3:	eb c8                	jmp    80068d <vprintfmt+0x200>
+  8006c5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006c8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006cb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006ce:	01 d0                	add    %edx,%eax
+  8006d0:	29 c8                	sub    %ecx,%eax
+  8006d2:	89 c7                	mov    %eax,%edi
+  8006d4:	eb 13                	jmp    8006e9 <vprintfmt+0x25c>
+  8006d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006d9:	eb ed                	jmp    8006c8 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006db:	83 ec 08             	sub    $0x8,%esp
+  8006de:	53                   	push   %ebx
+  8006df:	6a 20                	push   $0x20
+  8006e1:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006e3:	83 ef 01             	sub    $0x1,%edi
+  8006e6:	83 c4 10             	add    $0x10,%esp
+  8006e9:	85 ff                	test   %edi,%edi
+  8006eb:	7f ee                	jg     8006db <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006ed:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f3:	e9 6b 01 00 00       	jmp    800863 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8006f8:	83 f9 01             	cmp    $0x1,%ecx
+  8006fb:	7f 1f                	jg     80071c <vprintfmt+0x28f>
+	else if (lflag)
+  8006fd:	85 c9                	test   %ecx,%ecx
+  8006ff:	74 67                	je     800768 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800701:	8b 45 14             	mov    0x14(%ebp),%eax
+  800704:	8b 00                	mov    (%eax),%eax
+  800706:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800709:	89 c1                	mov    %eax,%ecx
+  80070b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80070e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800711:	8b 45 14             	mov    0x14(%ebp),%eax
+  800714:	8d 40 04             	lea    0x4(%eax),%eax
+  800717:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071a:	eb 17                	jmp    800733 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 50 04             	mov    0x4(%eax),%edx
+  800722:	8b 00                	mov    (%eax),%eax
+  800724:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800727:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80072a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072d:	8d 40 08             	lea    0x8(%eax),%eax
+  800730:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800733:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800736:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800739:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80073e:	85 c9                	test   %ecx,%ecx
+  800740:	0f 89 03 01 00 00    	jns    800849 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800746:	83 ec 08             	sub    $0x8,%esp
+  800749:	53                   	push   %ebx
+  80074a:	6a 2d                	push   $0x2d
+  80074c:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80074e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800751:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800754:	f7 da                	neg    %edx
+  800756:	83 d1 00             	adc    $0x0,%ecx
+  800759:	f7 d9                	neg    %ecx
+  80075b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80075e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800763:	e9 e1 00 00 00       	jmp    800849 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	8b 00                	mov    (%eax),%eax
+  80076d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800770:	89 c1                	mov    %eax,%ecx
+  800772:	c1 f9 1f             	sar    $0x1f,%ecx
+  800775:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800778:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077b:	8d 40 04             	lea    0x4(%eax),%eax
+  80077e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800781:	eb b0                	jmp    800733 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800783:	83 f9 01             	cmp    $0x1,%ecx
+  800786:	7f 1e                	jg     8007a6 <vprintfmt+0x319>
+	else if (lflag)
+  800788:	85 c9                	test   %ecx,%ecx
+  80078a:	74 32                	je     8007be <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8b 10                	mov    (%eax),%edx
+  800791:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800796:	8d 40 04             	lea    0x4(%eax),%eax
+  800799:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80079c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8007a1:	e9 a3 00 00 00       	jmp    800849 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8b 10                	mov    (%eax),%edx
+  8007ab:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ae:	8d 40 08             	lea    0x8(%eax),%eax
+  8007b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8007b9:	e9 8b 00 00 00       	jmp    800849 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c1:	8b 10                	mov    (%eax),%edx
+  8007c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007d3:	eb 74                	jmp    800849 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8007d5:	83 f9 01             	cmp    $0x1,%ecx
+  8007d8:	7f 1b                	jg     8007f5 <vprintfmt+0x368>
+	else if (lflag)
+  8007da:	85 c9                	test   %ecx,%ecx
+  8007dc:	74 2c                	je     80080a <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8007de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e1:	8b 10                	mov    (%eax),%edx
+  8007e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ee:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8007f3:	eb 54                	jmp    800849 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f8:	8b 10                	mov    (%eax),%edx
+  8007fa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007fd:	8d 40 08             	lea    0x8(%eax),%eax
+  800800:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800803:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800808:	eb 3f                	jmp    800849 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80080a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080d:	8b 10                	mov    (%eax),%edx
+  80080f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800814:	8d 40 04             	lea    0x4(%eax),%eax
+  800817:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80081a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80081f:	eb 28                	jmp    800849 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800821:	83 ec 08             	sub    $0x8,%esp
+  800824:	53                   	push   %ebx
+  800825:	6a 30                	push   $0x30
+  800827:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800829:	83 c4 08             	add    $0x8,%esp
+  80082c:	53                   	push   %ebx
+  80082d:	6a 78                	push   $0x78
+  80082f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800831:	8b 45 14             	mov    0x14(%ebp),%eax
+  800834:	8b 10                	mov    (%eax),%edx
+  800836:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80083b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80083e:	8d 40 04             	lea    0x4(%eax),%eax
+  800841:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800844:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800849:	83 ec 0c             	sub    $0xc,%esp
+  80084c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800850:	50                   	push   %eax
+  800851:	ff 75 e0             	push   -0x20(%ebp)
+  800854:	57                   	push   %edi
+  800855:	51                   	push   %ecx
+  800856:	52                   	push   %edx
+  800857:	89 da                	mov    %ebx,%edx
+  800859:	89 f0                	mov    %esi,%eax
+  80085b:	e8 4a fb ff ff       	call   8003aa <printnum>
+			break;
+  800860:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800863:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800866:	e9 40 fc ff ff       	jmp    8004ab <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80086b:	83 f9 01             	cmp    $0x1,%ecx
+  80086e:	7f 1b                	jg     80088b <vprintfmt+0x3fe>
+	else if (lflag)
+  800870:	85 c9                	test   %ecx,%ecx
+  800872:	74 2c                	je     8008a0 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800874:	8b 45 14             	mov    0x14(%ebp),%eax
+  800877:	8b 10                	mov    (%eax),%edx
+  800879:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80087e:	8d 40 04             	lea    0x4(%eax),%eax
+  800881:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800884:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800889:	eb be                	jmp    800849 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80088b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088e:	8b 10                	mov    (%eax),%edx
+  800890:	8b 48 04             	mov    0x4(%eax),%ecx
+  800893:	8d 40 08             	lea    0x8(%eax),%eax
+  800896:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800899:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80089e:	eb a9                	jmp    800849 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a3:	8b 10                	mov    (%eax),%edx
+  8008a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008b0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8008b5:	eb 92                	jmp    800849 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8008b7:	83 ec 08             	sub    $0x8,%esp
+  8008ba:	53                   	push   %ebx
+  8008bb:	6a 25                	push   $0x25
+  8008bd:	ff d6                	call   *%esi
+			break;
+  8008bf:	83 c4 10             	add    $0x10,%esp
+  8008c2:	eb 9f                	jmp    800863 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8008c4:	83 ec 08             	sub    $0x8,%esp
+  8008c7:	53                   	push   %ebx
+  8008c8:	6a 25                	push   $0x25
+  8008ca:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008cc:	83 c4 10             	add    $0x10,%esp
+  8008cf:	89 f8                	mov    %edi,%eax
+  8008d1:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008d5:	74 05                	je     8008dc <vprintfmt+0x44f>
+  8008d7:	83 e8 01             	sub    $0x1,%eax
+  8008da:	eb f5                	jmp    8008d1 <vprintfmt+0x444>
+  8008dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008df:	eb 82                	jmp    800863 <vprintfmt+0x3d6>
+
+008008e1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008e1:	55                   	push   %ebp
+  8008e2:	89 e5                	mov    %esp,%ebp
+  8008e4:	83 ec 18             	sub    $0x18,%esp
+  8008e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008ed:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008f0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008f4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008f7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008fe:	85 c0                	test   %eax,%eax
+  800900:	74 26                	je     800928 <vsnprintf+0x47>
+  800902:	85 d2                	test   %edx,%edx
+  800904:	7e 22                	jle    800928 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800906:	ff 75 14             	push   0x14(%ebp)
+  800909:	ff 75 10             	push   0x10(%ebp)
+  80090c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80090f:	50                   	push   %eax
+  800910:	68 53 04 80 00       	push   $0x800453
+  800915:	e8 73 fb ff ff       	call   80048d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80091a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80091d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800920:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800923:	83 c4 10             	add    $0x10,%esp
+}
+  800926:	c9                   	leave
+  800927:	c3                   	ret
+		return -E_INVAL;
+  800928:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80092d:	eb f7                	jmp    800926 <vsnprintf+0x45>
+
+0080092f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800935:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800938:	50                   	push   %eax
+  800939:	ff 75 10             	push   0x10(%ebp)
+  80093c:	ff 75 0c             	push   0xc(%ebp)
+  80093f:	ff 75 08             	push   0x8(%ebp)
+  800942:	e8 9a ff ff ff       	call   8008e1 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800947:	c9                   	leave
+  800948:	c3                   	ret
+
+00800949 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  800949:	55                   	push   %ebp
+  80094a:	89 e5                	mov    %esp,%ebp
+  80094c:	57                   	push   %edi
+  80094d:	56                   	push   %esi
+  80094e:	53                   	push   %ebx
+  80094f:	83 ec 0c             	sub    $0xc,%esp
+  800952:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  800955:	85 c0                	test   %eax,%eax
+  800957:	74 13                	je     80096c <readline+0x23>
+		fprintf(1, "%s", prompt);
+  800959:	83 ec 04             	sub    $0x4,%esp
+  80095c:	50                   	push   %eax
+  80095d:	68 a5 2d 80 00       	push   $0x802da5
+  800962:	6a 01                	push   $0x1
+  800964:	e8 6f 12 00 00       	call   801bd8 <fprintf>
+  800969:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  80096c:	83 ec 0c             	sub    $0xc,%esp
+  80096f:	6a 00                	push   $0x0
+  800971:	e8 67 f8 ff ff       	call   8001dd <iscons>
+  800976:	89 c7                	mov    %eax,%edi
+  800978:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  80097b:	be 00 00 00 00       	mov    $0x0,%esi
+  800980:	eb 4b                	jmp    8009cd <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  800982:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  800987:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  80098a:	75 08                	jne    800994 <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  80098c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80098f:	5b                   	pop    %ebx
+  800990:	5e                   	pop    %esi
+  800991:	5f                   	pop    %edi
+  800992:	5d                   	pop    %ebp
+  800993:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  800994:	83 ec 08             	sub    $0x8,%esp
+  800997:	53                   	push   %ebx
+  800998:	68 bf 2c 80 00       	push   $0x802cbf
+  80099d:	e8 f4 f9 ff ff       	call   800396 <cprintf>
+  8009a2:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  8009a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009aa:	eb e0                	jmp    80098c <readline+0x43>
+			if (echoing)
+  8009ac:	85 ff                	test   %edi,%edi
+  8009ae:	75 05                	jne    8009b5 <readline+0x6c>
+			i--;
+  8009b0:	83 ee 01             	sub    $0x1,%esi
+  8009b3:	eb 18                	jmp    8009cd <readline+0x84>
+				cputchar('\b');
+  8009b5:	83 ec 0c             	sub    $0xc,%esp
+  8009b8:	6a 08                	push   $0x8
+  8009ba:	e8 d9 f7 ff ff       	call   800198 <cputchar>
+  8009bf:	83 c4 10             	add    $0x10,%esp
+  8009c2:	eb ec                	jmp    8009b0 <readline+0x67>
+			buf[i++] = c;
+  8009c4:	88 9e 00 40 80 00    	mov    %bl,0x804000(%esi)
+  8009ca:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  8009cd:	e8 e2 f7 ff ff       	call   8001b4 <getchar>
+  8009d2:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  8009d4:	85 c0                	test   %eax,%eax
+  8009d6:	78 aa                	js     800982 <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  8009d8:	83 f8 08             	cmp    $0x8,%eax
+  8009db:	0f 94 c0             	sete   %al
+  8009de:	83 fb 7f             	cmp    $0x7f,%ebx
+  8009e1:	0f 94 c2             	sete   %dl
+  8009e4:	08 d0                	or     %dl,%al
+  8009e6:	74 04                	je     8009ec <readline+0xa3>
+  8009e8:	85 f6                	test   %esi,%esi
+  8009ea:	7f c0                	jg     8009ac <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  8009ec:	83 fb 1f             	cmp    $0x1f,%ebx
+  8009ef:	7e 1a                	jle    800a0b <readline+0xc2>
+  8009f1:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  8009f7:	7f 12                	jg     800a0b <readline+0xc2>
+			if (echoing)
+  8009f9:	85 ff                	test   %edi,%edi
+  8009fb:	74 c7                	je     8009c4 <readline+0x7b>
+				cputchar(c);
+  8009fd:	83 ec 0c             	sub    $0xc,%esp
+  800a00:	53                   	push   %ebx
+  800a01:	e8 92 f7 ff ff       	call   800198 <cputchar>
+  800a06:	83 c4 10             	add    $0x10,%esp
+  800a09:	eb b9                	jmp    8009c4 <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  800a0b:	83 fb 0a             	cmp    $0xa,%ebx
+  800a0e:	74 05                	je     800a15 <readline+0xcc>
+  800a10:	83 fb 0d             	cmp    $0xd,%ebx
+  800a13:	75 b8                	jne    8009cd <readline+0x84>
+			if (echoing)
+  800a15:	85 ff                	test   %edi,%edi
+  800a17:	75 11                	jne    800a2a <readline+0xe1>
+			buf[i] = 0;
+  800a19:	c6 86 00 40 80 00 00 	movb   $0x0,0x804000(%esi)
+			return buf;
+  800a20:	b8 00 40 80 00       	mov    $0x804000,%eax
+  800a25:	e9 62 ff ff ff       	jmp    80098c <readline+0x43>
+				cputchar('\n');
+  800a2a:	83 ec 0c             	sub    $0xc,%esp
+  800a2d:	6a 0a                	push   $0xa
+  800a2f:	e8 64 f7 ff ff       	call   800198 <cputchar>
+  800a34:	83 c4 10             	add    $0x10,%esp
+  800a37:	eb e0                	jmp    800a19 <readline+0xd0>
+
+00800a39 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a39:	55                   	push   %ebp
+  800a3a:	89 e5                	mov    %esp,%ebp
+  800a3c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a44:	eb 03                	jmp    800a49 <strlen+0x10>
+		n++;
+  800a46:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a49:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a4d:	75 f7                	jne    800a46 <strlen+0xd>
+	return n;
+}
+  800a4f:	5d                   	pop    %ebp
+  800a50:	c3                   	ret
+
+00800a51 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a51:	55                   	push   %ebp
+  800a52:	89 e5                	mov    %esp,%ebp
+  800a54:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a57:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5f:	eb 03                	jmp    800a64 <strnlen+0x13>
+		n++;
+  800a61:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a64:	39 d0                	cmp    %edx,%eax
+  800a66:	74 08                	je     800a70 <strnlen+0x1f>
+  800a68:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a6c:	75 f3                	jne    800a61 <strnlen+0x10>
+  800a6e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a70:	89 d0                	mov    %edx,%eax
+  800a72:	5d                   	pop    %ebp
+  800a73:	c3                   	ret
+
+00800a74 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	53                   	push   %ebx
+  800a78:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a7b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a83:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a87:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a8a:	83 c0 01             	add    $0x1,%eax
+  800a8d:	84 d2                	test   %dl,%dl
+  800a8f:	75 f2                	jne    800a83 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a91:	89 c8                	mov    %ecx,%eax
+  800a93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a96:	c9                   	leave
+  800a97:	c3                   	ret
+
+00800a98 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a98:	55                   	push   %ebp
+  800a99:	89 e5                	mov    %esp,%ebp
+  800a9b:	53                   	push   %ebx
+  800a9c:	83 ec 10             	sub    $0x10,%esp
+  800a9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800aa2:	53                   	push   %ebx
+  800aa3:	e8 91 ff ff ff       	call   800a39 <strlen>
+  800aa8:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800aab:	ff 75 0c             	push   0xc(%ebp)
+  800aae:	01 d8                	add    %ebx,%eax
+  800ab0:	50                   	push   %eax
+  800ab1:	e8 be ff ff ff       	call   800a74 <strcpy>
+	return dst;
+}
+  800ab6:	89 d8                	mov    %ebx,%eax
+  800ab8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800abb:	c9                   	leave
+  800abc:	c3                   	ret
+
+00800abd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800abd:	55                   	push   %ebp
+  800abe:	89 e5                	mov    %esp,%ebp
+  800ac0:	56                   	push   %esi
+  800ac1:	53                   	push   %ebx
+  800ac2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ac8:	89 f3                	mov    %esi,%ebx
+  800aca:	03 5d 10             	add    0x10(%ebp),%ebx
+  800acd:	89 f0                	mov    %esi,%eax
+  800acf:	eb 0f                	jmp    800ae0 <strncpy+0x23>
+		*dst++ = *src;
+  800ad1:	83 c0 01             	add    $0x1,%eax
+  800ad4:	0f b6 0a             	movzbl (%edx),%ecx
+  800ad7:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ada:	80 f9 01             	cmp    $0x1,%cl
+  800add:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ae0:	39 d8                	cmp    %ebx,%eax
+  800ae2:	75 ed                	jne    800ad1 <strncpy+0x14>
+	}
+	return ret;
+}
+  800ae4:	89 f0                	mov    %esi,%eax
+  800ae6:	5b                   	pop    %ebx
+  800ae7:	5e                   	pop    %esi
+  800ae8:	5d                   	pop    %ebp
+  800ae9:	c3                   	ret
+
+00800aea <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	56                   	push   %esi
+  800aee:	53                   	push   %ebx
+  800aef:	8b 75 08             	mov    0x8(%ebp),%esi
+  800af2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af5:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800af8:	89 f0                	mov    %esi,%eax
+  800afa:	85 d2                	test   %edx,%edx
+  800afc:	74 21                	je     800b1f <strlcpy+0x35>
+  800afe:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b02:	89 f2                	mov    %esi,%edx
+  800b04:	eb 09                	jmp    800b0f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b06:	83 c1 01             	add    $0x1,%ecx
+  800b09:	83 c2 01             	add    $0x1,%edx
+  800b0c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b0f:	39 c2                	cmp    %eax,%edx
+  800b11:	74 09                	je     800b1c <strlcpy+0x32>
+  800b13:	0f b6 19             	movzbl (%ecx),%ebx
+  800b16:	84 db                	test   %bl,%bl
+  800b18:	75 ec                	jne    800b06 <strlcpy+0x1c>
+  800b1a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b1c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b1f:	29 f0                	sub    %esi,%eax
+}
+  800b21:	5b                   	pop    %ebx
+  800b22:	5e                   	pop    %esi
+  800b23:	5d                   	pop    %ebp
+  800b24:	c3                   	ret
+
+00800b25 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b25:	55                   	push   %ebp
+  800b26:	89 e5                	mov    %esp,%ebp
+  800b28:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b2e:	eb 06                	jmp    800b36 <strcmp+0x11>
+		p++, q++;
+  800b30:	83 c1 01             	add    $0x1,%ecx
+  800b33:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b36:	0f b6 01             	movzbl (%ecx),%eax
+  800b39:	84 c0                	test   %al,%al
+  800b3b:	74 04                	je     800b41 <strcmp+0x1c>
+  800b3d:	3a 02                	cmp    (%edx),%al
+  800b3f:	74 ef                	je     800b30 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b41:	0f b6 c0             	movzbl %al,%eax
+  800b44:	0f b6 12             	movzbl (%edx),%edx
+  800b47:	29 d0                	sub    %edx,%eax
+}
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+
+00800b4b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	53                   	push   %ebx
+  800b4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b55:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b58:	eb 09                	jmp    800b63 <strncmp+0x18>
+		n--, p++, q++;
+  800b5a:	83 ea 01             	sub    $0x1,%edx
+  800b5d:	83 c0 01             	add    $0x1,%eax
+  800b60:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b63:	85 d2                	test   %edx,%edx
+  800b65:	74 18                	je     800b7f <strncmp+0x34>
+  800b67:	0f b6 18             	movzbl (%eax),%ebx
+  800b6a:	84 db                	test   %bl,%bl
+  800b6c:	74 04                	je     800b72 <strncmp+0x27>
+  800b6e:	3a 19                	cmp    (%ecx),%bl
+  800b70:	74 e8                	je     800b5a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b72:	0f b6 00             	movzbl (%eax),%eax
+  800b75:	0f b6 11             	movzbl (%ecx),%edx
+  800b78:	29 d0                	sub    %edx,%eax
+}
+  800b7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b7d:	c9                   	leave
+  800b7e:	c3                   	ret
+		return 0;
+  800b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b84:	eb f4                	jmp    800b7a <strncmp+0x2f>
+
+00800b86 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b86:	55                   	push   %ebp
+  800b87:	89 e5                	mov    %esp,%ebp
+  800b89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b90:	eb 03                	jmp    800b95 <strchr+0xf>
+  800b92:	83 c0 01             	add    $0x1,%eax
+  800b95:	0f b6 10             	movzbl (%eax),%edx
+  800b98:	84 d2                	test   %dl,%dl
+  800b9a:	74 06                	je     800ba2 <strchr+0x1c>
+		if (*s == c)
+  800b9c:	38 ca                	cmp    %cl,%dl
+  800b9e:	75 f2                	jne    800b92 <strchr+0xc>
+  800ba0:	eb 05                	jmp    800ba7 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ba7:	5d                   	pop    %ebp
+  800ba8:	c3                   	ret
+
+00800ba9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ba9:	55                   	push   %ebp
+  800baa:	89 e5                	mov    %esp,%ebp
+  800bac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800baf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bb3:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bb6:	38 ca                	cmp    %cl,%dl
+  800bb8:	74 09                	je     800bc3 <strfind+0x1a>
+  800bba:	84 d2                	test   %dl,%dl
+  800bbc:	74 05                	je     800bc3 <strfind+0x1a>
+	for (; *s; s++)
+  800bbe:	83 c0 01             	add    $0x1,%eax
+  800bc1:	eb f0                	jmp    800bb3 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800bc3:	5d                   	pop    %ebp
+  800bc4:	c3                   	ret
+
+00800bc5 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bc5:	55                   	push   %ebp
+  800bc6:	89 e5                	mov    %esp,%ebp
+  800bc8:	57                   	push   %edi
+  800bc9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bcc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bcf:	85 c9                	test   %ecx,%ecx
+  800bd1:	74 20                	je     800bf3 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bd3:	89 f8                	mov    %edi,%eax
+  800bd5:	09 c8                	or     %ecx,%eax
+  800bd7:	a8 03                	test   $0x3,%al
+  800bd9:	75 12                	jne    800bed <memset+0x28>
+		c &= 0xFF;
+  800bdb:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bdf:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800be5:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800be8:	fc                   	cld
+  800be9:	f3 ab                	rep stos %eax,%es:(%edi)
+  800beb:	eb 06                	jmp    800bf3 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bf0:	fc                   	cld
+  800bf1:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bf3:	89 f8                	mov    %edi,%eax
+  800bf5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bf8:	c9                   	leave
+  800bf9:	c3                   	ret
+
+00800bfa <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bfa:	55                   	push   %ebp
+  800bfb:	89 e5                	mov    %esp,%ebp
+  800bfd:	57                   	push   %edi
+  800bfe:	56                   	push   %esi
+  800bff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c02:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c05:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c08:	39 c6                	cmp    %eax,%esi
+  800c0a:	73 32                	jae    800c3e <memmove+0x44>
+  800c0c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c0f:	39 d0                	cmp    %edx,%eax
+  800c11:	73 2b                	jae    800c3e <memmove+0x44>
+		s += n;
+		d += n;
+  800c13:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c16:	89 d6                	mov    %edx,%esi
+  800c18:	09 fe                	or     %edi,%esi
+  800c1a:	09 ce                	or     %ecx,%esi
+  800c1c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c22:	75 0e                	jne    800c32 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c24:	83 ef 04             	sub    $0x4,%edi
+  800c27:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c2a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c2d:	fd                   	std
+  800c2e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c30:	eb 09                	jmp    800c3b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c32:	83 ef 01             	sub    $0x1,%edi
+  800c35:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c38:	fd                   	std
+  800c39:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c3b:	fc                   	cld
+  800c3c:	eb 1a                	jmp    800c58 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c3e:	89 f2                	mov    %esi,%edx
+  800c40:	09 c2                	or     %eax,%edx
+  800c42:	09 ca                	or     %ecx,%edx
+  800c44:	f6 c2 03             	test   $0x3,%dl
+  800c47:	75 0a                	jne    800c53 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c49:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c4c:	89 c7                	mov    %eax,%edi
+  800c4e:	fc                   	cld
+  800c4f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c51:	eb 05                	jmp    800c58 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c53:	89 c7                	mov    %eax,%edi
+  800c55:	fc                   	cld
+  800c56:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c58:	5e                   	pop    %esi
+  800c59:	5f                   	pop    %edi
+  800c5a:	5d                   	pop    %ebp
+  800c5b:	c3                   	ret
+
+00800c5c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c62:	ff 75 10             	push   0x10(%ebp)
+  800c65:	ff 75 0c             	push   0xc(%ebp)
+  800c68:	ff 75 08             	push   0x8(%ebp)
+  800c6b:	e8 8a ff ff ff       	call   800bfa <memmove>
+}
+  800c70:	c9                   	leave
+  800c71:	c3                   	ret
+
+00800c72 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c72:	55                   	push   %ebp
+  800c73:	89 e5                	mov    %esp,%ebp
+  800c75:	56                   	push   %esi
+  800c76:	53                   	push   %ebx
+  800c77:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c7d:	89 c6                	mov    %eax,%esi
+  800c7f:	03 75 10             	add    0x10(%ebp),%esi
+  800c82:	eb 06                	jmp    800c8a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c84:	83 c0 01             	add    $0x1,%eax
+  800c87:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c8a:	39 f0                	cmp    %esi,%eax
+  800c8c:	74 14                	je     800ca2 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c8e:	0f b6 08             	movzbl (%eax),%ecx
+  800c91:	0f b6 1a             	movzbl (%edx),%ebx
+  800c94:	38 d9                	cmp    %bl,%cl
+  800c96:	74 ec                	je     800c84 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c98:	0f b6 c1             	movzbl %cl,%eax
+  800c9b:	0f b6 db             	movzbl %bl,%ebx
+  800c9e:	29 d8                	sub    %ebx,%eax
+  800ca0:	eb 05                	jmp    800ca7 <memcmp+0x35>
+	}
+
+	return 0;
+  800ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca7:	5b                   	pop    %ebx
+  800ca8:	5e                   	pop    %esi
+  800ca9:	5d                   	pop    %ebp
+  800caa:	c3                   	ret
+
+00800cab <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cb4:	89 c2                	mov    %eax,%edx
+  800cb6:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cb9:	eb 03                	jmp    800cbe <memfind+0x13>
+  800cbb:	83 c0 01             	add    $0x1,%eax
+  800cbe:	39 d0                	cmp    %edx,%eax
+  800cc0:	73 04                	jae    800cc6 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cc2:	38 08                	cmp    %cl,(%eax)
+  800cc4:	75 f5                	jne    800cbb <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800cc6:	5d                   	pop    %ebp
+  800cc7:	c3                   	ret
+
+00800cc8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cc8:	55                   	push   %ebp
+  800cc9:	89 e5                	mov    %esp,%ebp
+  800ccb:	57                   	push   %edi
+  800ccc:	56                   	push   %esi
+  800ccd:	53                   	push   %ebx
+  800cce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cd4:	eb 03                	jmp    800cd9 <strtol+0x11>
+		s++;
+  800cd6:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cd9:	0f b6 02             	movzbl (%edx),%eax
+  800cdc:	3c 20                	cmp    $0x20,%al
+  800cde:	74 f6                	je     800cd6 <strtol+0xe>
+  800ce0:	3c 09                	cmp    $0x9,%al
+  800ce2:	74 f2                	je     800cd6 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ce4:	3c 2b                	cmp    $0x2b,%al
+  800ce6:	74 2a                	je     800d12 <strtol+0x4a>
+	int neg = 0;
+  800ce8:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ced:	3c 2d                	cmp    $0x2d,%al
+  800cef:	74 2b                	je     800d1c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cf1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cf7:	75 0f                	jne    800d08 <strtol+0x40>
+  800cf9:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cfc:	74 28                	je     800d26 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cfe:	85 db                	test   %ebx,%ebx
+  800d00:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d05:	0f 44 d8             	cmove  %eax,%ebx
+  800d08:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d0d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d10:	eb 46                	jmp    800d58 <strtol+0x90>
+		s++;
+  800d12:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d15:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d1a:	eb d5                	jmp    800cf1 <strtol+0x29>
+		s++, neg = 1;
+  800d1c:	83 c2 01             	add    $0x1,%edx
+  800d1f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d24:	eb cb                	jmp    800cf1 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d26:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d2a:	74 0e                	je     800d3a <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d2c:	85 db                	test   %ebx,%ebx
+  800d2e:	75 d8                	jne    800d08 <strtol+0x40>
+		s++, base = 8;
+  800d30:	83 c2 01             	add    $0x1,%edx
+  800d33:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d38:	eb ce                	jmp    800d08 <strtol+0x40>
+		s += 2, base = 16;
+  800d3a:	83 c2 02             	add    $0x2,%edx
+  800d3d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d42:	eb c4                	jmp    800d08 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d44:	0f be c0             	movsbl %al,%eax
+  800d47:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d4a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d4d:	7d 3a                	jge    800d89 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d4f:	83 c2 01             	add    $0x1,%edx
+  800d52:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d56:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d58:	0f b6 02             	movzbl (%edx),%eax
+  800d5b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d5e:	89 f3                	mov    %esi,%ebx
+  800d60:	80 fb 09             	cmp    $0x9,%bl
+  800d63:	76 df                	jbe    800d44 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d65:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d68:	89 f3                	mov    %esi,%ebx
+  800d6a:	80 fb 19             	cmp    $0x19,%bl
+  800d6d:	77 08                	ja     800d77 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d6f:	0f be c0             	movsbl %al,%eax
+  800d72:	83 e8 57             	sub    $0x57,%eax
+  800d75:	eb d3                	jmp    800d4a <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d77:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d7a:	89 f3                	mov    %esi,%ebx
+  800d7c:	80 fb 19             	cmp    $0x19,%bl
+  800d7f:	77 08                	ja     800d89 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d81:	0f be c0             	movsbl %al,%eax
+  800d84:	83 e8 37             	sub    $0x37,%eax
+  800d87:	eb c1                	jmp    800d4a <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d89:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d8d:	74 05                	je     800d94 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d92:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d94:	89 c8                	mov    %ecx,%eax
+  800d96:	f7 d8                	neg    %eax
+  800d98:	85 ff                	test   %edi,%edi
+  800d9a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d9d:	89 c8                	mov    %ecx,%eax
+  800d9f:	5b                   	pop    %ebx
+  800da0:	5e                   	pop    %esi
+  800da1:	5f                   	pop    %edi
+  800da2:	5d                   	pop    %ebp
+  800da3:	c3                   	ret
+
+00800da4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	57                   	push   %edi
+  800da8:	56                   	push   %esi
+  800da9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800daf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db5:	89 c3                	mov    %eax,%ebx
+  800db7:	89 c7                	mov    %eax,%edi
+  800db9:	89 c6                	mov    %eax,%esi
+  800dbb:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800dbd:	5b                   	pop    %ebx
+  800dbe:	5e                   	pop    %esi
+  800dbf:	5f                   	pop    %edi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+
+00800dc2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	57                   	push   %edi
+  800dc6:	56                   	push   %esi
+  800dc7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd2:	89 d1                	mov    %edx,%ecx
+  800dd4:	89 d3                	mov    %edx,%ebx
+  800dd6:	89 d7                	mov    %edx,%edi
+  800dd8:	89 d6                	mov    %edx,%esi
+  800dda:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ddc:	5b                   	pop    %ebx
+  800ddd:	5e                   	pop    %esi
+  800dde:	5f                   	pop    %edi
+  800ddf:	5d                   	pop    %ebp
+  800de0:	c3                   	ret
+
+00800de1 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	57                   	push   %edi
+  800de5:	56                   	push   %esi
+  800de6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800de7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800def:	b8 04 00 00 00       	mov    $0x4,%eax
+  800df4:	89 cb                	mov    %ecx,%ebx
+  800df6:	89 cf                	mov    %ecx,%edi
+  800df8:	89 ce                	mov    %ecx,%esi
+  800dfa:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800dfc:	5b                   	pop    %ebx
+  800dfd:	5e                   	pop    %esi
+  800dfe:	5f                   	pop    %edi
+  800dff:	5d                   	pop    %ebp
+  800e00:	c3                   	ret
+
+00800e01 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	57                   	push   %edi
+  800e05:	56                   	push   %esi
+  800e06:	53                   	push   %ebx
+  800e07:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e12:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e17:	89 cb                	mov    %ecx,%ebx
+  800e19:	89 cf                	mov    %ecx,%edi
+  800e1b:	89 ce                	mov    %ecx,%esi
+  800e1d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e1f:	85 c0                	test   %eax,%eax
+  800e21:	7f 08                	jg     800e2b <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e26:	5b                   	pop    %ebx
+  800e27:	5e                   	pop    %esi
+  800e28:	5f                   	pop    %edi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2b:	83 ec 0c             	sub    $0xc,%esp
+  800e2e:	50                   	push   %eax
+  800e2f:	6a 03                	push   $0x3
+  800e31:	68 cf 2c 80 00       	push   $0x802ccf
+  800e36:	6a 23                	push   $0x23
+  800e38:	68 ec 2c 80 00       	push   $0x802cec
+  800e3d:	e8 79 f4 ff ff       	call   8002bb <_panic>
+
+00800e42 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	57                   	push   %edi
+  800e46:	56                   	push   %esi
+  800e47:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e52:	89 d1                	mov    %edx,%ecx
+  800e54:	89 d3                	mov    %edx,%ebx
+  800e56:	89 d7                	mov    %edx,%edi
+  800e58:	89 d6                	mov    %edx,%esi
+  800e5a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e5c:	5b                   	pop    %ebx
+  800e5d:	5e                   	pop    %esi
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+
+00800e61 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	57                   	push   %edi
+  800e65:	56                   	push   %esi
+  800e66:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800e71:	89 d1                	mov    %edx,%ecx
+  800e73:	89 d3                	mov    %edx,%ebx
+  800e75:	89 d7                	mov    %edx,%edi
+  800e77:	89 d6                	mov    %edx,%esi
+  800e79:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5f                   	pop    %edi
+  800e7e:	5d                   	pop    %ebp
+  800e7f:	c3                   	ret
+
+00800e80 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800e80:	55                   	push   %ebp
+  800e81:	89 e5                	mov    %esp,%ebp
+  800e83:	57                   	push   %edi
+  800e84:	56                   	push   %esi
+  800e85:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e86:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e90:	89 d1                	mov    %edx,%ecx
+  800e92:	89 d3                	mov    %edx,%ebx
+  800e94:	89 d7                	mov    %edx,%edi
+  800e96:	89 d6                	mov    %edx,%esi
+  800e98:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5f                   	pop    %edi
+  800e9d:	5d                   	pop    %ebp
+  800e9e:	c3                   	ret
+
+00800e9f <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	57                   	push   %edi
+  800ea3:	56                   	push   %esi
+  800ea4:	53                   	push   %ebx
+  800ea5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb3:	b8 15 00 00 00       	mov    $0x15,%eax
+  800eb8:	89 df                	mov    %ebx,%edi
+  800eba:	89 de                	mov    %ebx,%esi
+  800ebc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ebe:	85 c0                	test   %eax,%eax
+  800ec0:	7f 08                	jg     800eca <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800ec2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eca:	83 ec 0c             	sub    $0xc,%esp
+  800ecd:	50                   	push   %eax
+  800ece:	6a 15                	push   $0x15
+  800ed0:	68 cf 2c 80 00       	push   $0x802ccf
+  800ed5:	6a 23                	push   $0x23
+  800ed7:	68 ec 2c 80 00       	push   $0x802cec
+  800edc:	e8 da f3 ff ff       	call   8002bb <_panic>
+
+00800ee1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	57                   	push   %edi
+  800ee5:	56                   	push   %esi
+  800ee6:	53                   	push   %ebx
+  800ee7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eea:	be 00 00 00 00       	mov    $0x0,%esi
+  800eef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800efa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efd:	89 f7                	mov    %esi,%edi
+  800eff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f01:	85 c0                	test   %eax,%eax
+  800f03:	7f 08                	jg     800f0d <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f08:	5b                   	pop    %ebx
+  800f09:	5e                   	pop    %esi
+  800f0a:	5f                   	pop    %edi
+  800f0b:	5d                   	pop    %ebp
+  800f0c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0d:	83 ec 0c             	sub    $0xc,%esp
+  800f10:	50                   	push   %eax
+  800f11:	6a 05                	push   $0x5
+  800f13:	68 cf 2c 80 00       	push   $0x802ccf
+  800f18:	6a 23                	push   $0x23
+  800f1a:	68 ec 2c 80 00       	push   $0x802cec
+  800f1f:	e8 97 f3 ff ff       	call   8002bb <_panic>
+
+00800f24 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	57                   	push   %edi
+  800f28:	56                   	push   %esi
+  800f29:	53                   	push   %ebx
+  800f2a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f2d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f38:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f40:	89 f7                	mov    %esi,%edi
+  800f42:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f44:	85 c0                	test   %eax,%eax
+  800f46:	7f 08                	jg     800f50 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4b:	5b                   	pop    %ebx
+  800f4c:	5e                   	pop    %esi
+  800f4d:	5f                   	pop    %edi
+  800f4e:	5d                   	pop    %ebp
+  800f4f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f50:	83 ec 0c             	sub    $0xc,%esp
+  800f53:	50                   	push   %eax
+  800f54:	6a 06                	push   $0x6
+  800f56:	68 cf 2c 80 00       	push   $0x802ccf
+  800f5b:	6a 23                	push   $0x23
+  800f5d:	68 ec 2c 80 00       	push   $0x802cec
+  800f62:	e8 54 f3 ff ff       	call   8002bb <_panic>
+
+00800f67 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f67:	55                   	push   %ebp
+  800f68:	89 e5                	mov    %esp,%ebp
+  800f6a:	57                   	push   %edi
+  800f6b:	56                   	push   %esi
+  800f6c:	53                   	push   %ebx
+  800f6d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f76:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f81:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f84:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f86:	85 c0                	test   %eax,%eax
+  800f88:	7f 08                	jg     800f92 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8d:	5b                   	pop    %ebx
+  800f8e:	5e                   	pop    %esi
+  800f8f:	5f                   	pop    %edi
+  800f90:	5d                   	pop    %ebp
+  800f91:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f92:	83 ec 0c             	sub    $0xc,%esp
+  800f95:	50                   	push   %eax
+  800f96:	6a 07                	push   $0x7
+  800f98:	68 cf 2c 80 00       	push   $0x802ccf
+  800f9d:	6a 23                	push   $0x23
+  800f9f:	68 ec 2c 80 00       	push   $0x802cec
+  800fa4:	e8 12 f3 ff ff       	call   8002bb <_panic>
+
+00800fa9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800fa9:	55                   	push   %ebp
+  800faa:	89 e5                	mov    %esp,%ebp
+  800fac:	57                   	push   %edi
+  800fad:	56                   	push   %esi
+  800fae:	53                   	push   %ebx
+  800faf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbd:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fc2:	89 df                	mov    %ebx,%edi
+  800fc4:	89 de                	mov    %ebx,%esi
+  800fc6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc8:	85 c0                	test   %eax,%eax
+  800fca:	7f 08                	jg     800fd4 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcf:	5b                   	pop    %ebx
+  800fd0:	5e                   	pop    %esi
+  800fd1:	5f                   	pop    %edi
+  800fd2:	5d                   	pop    %ebp
+  800fd3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd4:	83 ec 0c             	sub    $0xc,%esp
+  800fd7:	50                   	push   %eax
+  800fd8:	6a 08                	push   $0x8
+  800fda:	68 cf 2c 80 00       	push   $0x802ccf
+  800fdf:	6a 23                	push   $0x23
+  800fe1:	68 ec 2c 80 00       	push   $0x802cec
+  800fe6:	e8 d0 f2 ff ff       	call   8002bb <_panic>
+
+00800feb <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800feb:	55                   	push   %ebp
+  800fec:	89 e5                	mov    %esp,%ebp
+  800fee:	57                   	push   %edi
+  800fef:	56                   	push   %esi
+  800ff0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff7:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ffc:	be 00 00 00 00       	mov    $0x0,%esi
+  801001:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801004:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801007:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  801009:	5b                   	pop    %ebx
+  80100a:	5e                   	pop    %esi
+  80100b:	5f                   	pop    %edi
+  80100c:	5d                   	pop    %ebp
+  80100d:	c3                   	ret
+
+0080100e <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  80100e:	55                   	push   %ebp
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	57                   	push   %edi
+  801012:	56                   	push   %esi
+  801013:	53                   	push   %ebx
+  801014:	8b 45 18             	mov    0x18(%ebp),%eax
+  801017:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  80101a:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  80101f:	77 27                	ja     801048 <sys_page_map_range+0x3a>
+  801021:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  801027:	77 1f                	ja     801048 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  801029:	c1 e0 0c             	shl    $0xc,%eax
+  80102c:	89 c6                	mov    %eax,%esi
+  80102e:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  801030:	8b 55 08             	mov    0x8(%ebp),%edx
+  801033:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801036:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80103b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801041:	cd 30                	int    $0x30
+}
+  801043:	5b                   	pop    %ebx
+  801044:	5e                   	pop    %esi
+  801045:	5f                   	pop    %edi
+  801046:	5d                   	pop    %ebp
+  801047:	c3                   	ret
+		return -E_INVAL;
+  801048:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80104d:	eb f4                	jmp    801043 <sys_page_map_range+0x35>
+
+0080104f <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	57                   	push   %edi
+  801053:	56                   	push   %esi
+  801054:	53                   	push   %ebx
+  801055:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801058:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801063:	be 00 00 00 00       	mov    $0x0,%esi
+  801068:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80106e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801070:	85 c0                	test   %eax,%eax
+  801072:	7f 08                	jg     80107c <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801074:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801077:	5b                   	pop    %ebx
+  801078:	5e                   	pop    %esi
+  801079:	5f                   	pop    %edi
+  80107a:	5d                   	pop    %ebp
+  80107b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107c:	83 ec 0c             	sub    $0xc,%esp
+  80107f:	50                   	push   %eax
+  801080:	6a 0c                	push   $0xc
+  801082:	68 cf 2c 80 00       	push   $0x802ccf
+  801087:	6a 23                	push   $0x23
+  801089:	68 ec 2c 80 00       	push   $0x802cec
+  80108e:	e8 28 f2 ff ff       	call   8002bb <_panic>
+
+00801093 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	57                   	push   %edi
+  801097:	56                   	push   %esi
+  801098:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801099:	be 00 00 00 00       	mov    $0x0,%esi
+  80109e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ac:	89 f7                	mov    %esi,%edi
+  8010ae:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8010b0:	5b                   	pop    %ebx
+  8010b1:	5e                   	pop    %esi
+  8010b2:	5f                   	pop    %edi
+  8010b3:	5d                   	pop    %ebp
+  8010b4:	c3                   	ret
+
+008010b5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+  8010bb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010ce:	89 df                	mov    %ebx,%edi
+  8010d0:	89 de                	mov    %ebx,%esi
+  8010d2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d4:	85 c0                	test   %eax,%eax
+  8010d6:	7f 08                	jg     8010e0 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010db:	5b                   	pop    %ebx
+  8010dc:	5e                   	pop    %esi
+  8010dd:	5f                   	pop    %edi
+  8010de:	5d                   	pop    %ebp
+  8010df:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e0:	83 ec 0c             	sub    $0xc,%esp
+  8010e3:	50                   	push   %eax
+  8010e4:	6a 0f                	push   $0xf
+  8010e6:	68 cf 2c 80 00       	push   $0x802ccf
+  8010eb:	6a 23                	push   $0x23
+  8010ed:	68 ec 2c 80 00       	push   $0x802cec
+  8010f2:	e8 c4 f1 ff ff       	call   8002bb <_panic>
+
+008010f7 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	57                   	push   %edi
+  8010fb:	56                   	push   %esi
+  8010fc:	53                   	push   %ebx
+  8010fd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801100:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801105:	8b 55 08             	mov    0x8(%ebp),%edx
+  801108:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801110:	89 df                	mov    %ebx,%edi
+  801112:	89 de                	mov    %ebx,%esi
+  801114:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801116:	85 c0                	test   %eax,%eax
+  801118:	7f 08                	jg     801122 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  80111a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111d:	5b                   	pop    %ebx
+  80111e:	5e                   	pop    %esi
+  80111f:	5f                   	pop    %edi
+  801120:	5d                   	pop    %ebp
+  801121:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801122:	83 ec 0c             	sub    $0xc,%esp
+  801125:	50                   	push   %eax
+  801126:	6a 10                	push   $0x10
+  801128:	68 cf 2c 80 00       	push   $0x802ccf
+  80112d:	6a 23                	push   $0x23
+  80112f:	68 ec 2c 80 00       	push   $0x802cec
+  801134:	e8 82 f1 ff ff       	call   8002bb <_panic>
+
+00801139 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  801139:	55                   	push   %ebp
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	57                   	push   %edi
+  80113d:	56                   	push   %esi
+  80113e:	53                   	push   %ebx
+  80113f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801142:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801147:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801152:	89 df                	mov    %ebx,%edi
+  801154:	89 de                	mov    %ebx,%esi
+  801156:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801158:	85 c0                	test   %eax,%eax
+  80115a:	7f 08                	jg     801164 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  80115c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115f:	5b                   	pop    %ebx
+  801160:	5e                   	pop    %esi
+  801161:	5f                   	pop    %edi
+  801162:	5d                   	pop    %ebp
+  801163:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801164:	83 ec 0c             	sub    $0xc,%esp
+  801167:	50                   	push   %eax
+  801168:	6a 11                	push   $0x11
+  80116a:	68 cf 2c 80 00       	push   $0x802ccf
+  80116f:	6a 23                	push   $0x23
+  801171:	68 ec 2c 80 00       	push   $0x802cec
+  801176:	e8 40 f1 ff ff       	call   8002bb <_panic>
+
+0080117b <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  80117b:	55                   	push   %ebp
+  80117c:	89 e5                	mov    %esp,%ebp
+  80117e:	57                   	push   %edi
+  80117f:	56                   	push   %esi
+  801180:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801181:	ba 00 00 00 00       	mov    $0x0,%edx
+  801186:	b8 12 00 00 00       	mov    $0x12,%eax
+  80118b:	89 d1                	mov    %edx,%ecx
+  80118d:	89 d3                	mov    %edx,%ebx
+  80118f:	89 d7                	mov    %edx,%edi
+  801191:	89 d6                	mov    %edx,%esi
+  801193:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+
+0080119a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+  8011a0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ae:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011b3:	89 df                	mov    %ebx,%edi
+  8011b5:	89 de                	mov    %ebx,%esi
+  8011b7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011b9:	85 c0                	test   %eax,%eax
+  8011bb:	7f 08                	jg     8011c5 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8011bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c0:	5b                   	pop    %ebx
+  8011c1:	5e                   	pop    %esi
+  8011c2:	5f                   	pop    %edi
+  8011c3:	5d                   	pop    %ebp
+  8011c4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011c5:	83 ec 0c             	sub    $0xc,%esp
+  8011c8:	50                   	push   %eax
+  8011c9:	6a 13                	push   $0x13
+  8011cb:	68 cf 2c 80 00       	push   $0x802ccf
+  8011d0:	6a 23                	push   $0x23
+  8011d2:	68 ec 2c 80 00       	push   $0x802cec
+  8011d7:	e8 df f0 ff ff       	call   8002bb <_panic>
+
+008011dc <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8011dc:	55                   	push   %ebp
+  8011dd:	89 e5                	mov    %esp,%ebp
+  8011df:	57                   	push   %edi
+  8011e0:	56                   	push   %esi
+  8011e1:	53                   	push   %ebx
+  8011e2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011f5:	89 df                	mov    %ebx,%edi
+  8011f7:	89 de                	mov    %ebx,%esi
+  8011f9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011fb:	85 c0                	test   %eax,%eax
+  8011fd:	7f 08                	jg     801207 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801202:	5b                   	pop    %ebx
+  801203:	5e                   	pop    %esi
+  801204:	5f                   	pop    %edi
+  801205:	5d                   	pop    %ebp
+  801206:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801207:	83 ec 0c             	sub    $0xc,%esp
+  80120a:	50                   	push   %eax
+  80120b:	6a 14                	push   $0x14
+  80120d:	68 cf 2c 80 00       	push   $0x802ccf
+  801212:	6a 23                	push   $0x23
+  801214:	68 ec 2c 80 00       	push   $0x802cec
+  801219:	e8 9d f0 ff ff       	call   8002bb <_panic>
+
+0080121e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80121e:	55                   	push   %ebp
+  80121f:	89 e5                	mov    %esp,%ebp
+  801221:	57                   	push   %edi
+  801222:	56                   	push   %esi
+  801223:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801224:	8b 55 08             	mov    0x8(%ebp),%edx
+  801227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80122f:	be 00 00 00 00       	mov    $0x0,%esi
+  801234:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801237:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80123a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80123c:	5b                   	pop    %ebx
+  80123d:	5e                   	pop    %esi
+  80123e:	5f                   	pop    %edi
+  80123f:	5d                   	pop    %ebp
+  801240:	c3                   	ret
+
+00801241 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	57                   	push   %edi
+  801245:	56                   	push   %esi
+  801246:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801247:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801252:	be 00 00 00 00       	mov    $0x0,%esi
+  801257:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80125d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80125f:	5b                   	pop    %ebx
+  801260:	5e                   	pop    %esi
+  801261:	5f                   	pop    %edi
+  801262:	5d                   	pop    %ebp
+  801263:	c3                   	ret
+
+00801264 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801264:	55                   	push   %ebp
+  801265:	89 e5                	mov    %esp,%ebp
+  801267:	57                   	push   %edi
+  801268:	56                   	push   %esi
+  801269:	53                   	push   %ebx
+  80126a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80126d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801272:	8b 55 08             	mov    0x8(%ebp),%edx
+  801275:	b8 19 00 00 00       	mov    $0x19,%eax
+  80127a:	89 cb                	mov    %ecx,%ebx
+  80127c:	89 cf                	mov    %ecx,%edi
+  80127e:	89 ce                	mov    %ecx,%esi
+  801280:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801282:	85 c0                	test   %eax,%eax
+  801284:	7f 08                	jg     80128e <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801286:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801289:	5b                   	pop    %ebx
+  80128a:	5e                   	pop    %esi
+  80128b:	5f                   	pop    %edi
+  80128c:	5d                   	pop    %ebp
+  80128d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80128e:	83 ec 0c             	sub    $0xc,%esp
+  801291:	50                   	push   %eax
+  801292:	6a 19                	push   $0x19
+  801294:	68 cf 2c 80 00       	push   $0x802ccf
+  801299:	6a 23                	push   $0x23
+  80129b:	68 ec 2c 80 00       	push   $0x802cec
+  8012a0:	e8 16 f0 ff ff       	call   8002bb <_panic>
+
+008012a5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	57                   	push   %edi
+  8012a9:	56                   	push   %esi
+  8012aa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8012b5:	89 d1                	mov    %edx,%ecx
+  8012b7:	89 d3                	mov    %edx,%ebx
+  8012b9:	89 d7                	mov    %edx,%edi
+  8012bb:	89 d6                	mov    %edx,%esi
+  8012bd:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012bf:	5b                   	pop    %ebx
+  8012c0:	5e                   	pop    %esi
+  8012c1:	5f                   	pop    %edi
+  8012c2:	5d                   	pop    %ebp
+  8012c3:	c3                   	ret
+
+008012c4 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8012c4:	55                   	push   %ebp
+  8012c5:	89 e5                	mov    %esp,%ebp
+  8012c7:	57                   	push   %edi
+  8012c8:	56                   	push   %esi
+  8012c9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8012da:	89 df                	mov    %ebx,%edi
+  8012dc:	89 de                	mov    %ebx,%esi
+  8012de:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  8012e0:	5b                   	pop    %ebx
+  8012e1:	5e                   	pop    %esi
+  8012e2:	5f                   	pop    %edi
+  8012e3:	5d                   	pop    %ebp
+  8012e4:	c3                   	ret
+
+008012e5 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  8012e5:	55                   	push   %ebp
+  8012e6:	89 e5                	mov    %esp,%ebp
+  8012e8:	57                   	push   %edi
+  8012e9:	56                   	push   %esi
+  8012ea:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8012fb:	89 df                	mov    %ebx,%edi
+  8012fd:	89 de                	mov    %ebx,%esi
+  8012ff:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801301:	5b                   	pop    %ebx
+  801302:	5e                   	pop    %esi
+  801303:	5f                   	pop    %edi
+  801304:	5d                   	pop    %ebp
+  801305:	c3                   	ret
+
+00801306 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801309:	8b 45 08             	mov    0x8(%ebp),%eax
+  80130c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801311:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801314:	5d                   	pop    %ebp
+  801315:	c3                   	ret
+
+00801316 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801319:	8b 45 08             	mov    0x8(%ebp),%eax
+  80131c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801321:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801326:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80132b:	5d                   	pop    %ebp
+  80132c:	c3                   	ret
+
+0080132d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80132d:	55                   	push   %ebp
+  80132e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801330:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801335:	eb 02                	jmp    801339 <fd_alloc+0xc>
+  801337:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801339:	89 c2                	mov    %eax,%edx
+  80133b:	c1 ea 16             	shr    $0x16,%edx
+  80133e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801345:	f6 c2 01             	test   $0x1,%dl
+  801348:	74 2b                	je     801375 <fd_alloc+0x48>
+  80134a:	89 c2                	mov    %eax,%edx
+  80134c:	c1 ea 0c             	shr    $0xc,%edx
+  80134f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801356:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80135c:	f6 c1 01             	test   $0x1,%cl
+  80135f:	74 14                	je     801375 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801361:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801367:	75 ce                	jne    801337 <fd_alloc+0xa>
+  801369:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80136e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801373:	eb 05                	jmp    80137a <fd_alloc+0x4d>
+			return 0;
+  801375:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80137a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137d:	89 02                	mov    %eax,(%edx)
+}
+  80137f:	89 c8                	mov    %ecx,%eax
+  801381:	5d                   	pop    %ebp
+  801382:	c3                   	ret
+
+00801383 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+  801386:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801389:	83 f8 1f             	cmp    $0x1f,%eax
+  80138c:	77 30                	ja     8013be <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80138e:	c1 e0 0c             	shl    $0xc,%eax
+  801391:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801396:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80139c:	f6 c2 01             	test   $0x1,%dl
+  80139f:	74 24                	je     8013c5 <fd_lookup+0x42>
+  8013a1:	89 c2                	mov    %eax,%edx
+  8013a3:	c1 ea 0c             	shr    $0xc,%edx
+  8013a6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013ad:	f6 c2 01             	test   $0x1,%dl
+  8013b0:	74 1a                	je     8013cc <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013b5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013bc:	5d                   	pop    %ebp
+  8013bd:	c3                   	ret
+		return -E_INVAL;
+  8013be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013c3:	eb f7                	jmp    8013bc <fd_lookup+0x39>
+		return -E_INVAL;
+  8013c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ca:	eb f0                	jmp    8013bc <fd_lookup+0x39>
+  8013cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013d1:	eb e9                	jmp    8013bc <fd_lookup+0x39>
+
+008013d3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013d3:	55                   	push   %ebp
+  8013d4:	89 e5                	mov    %esp,%ebp
+  8013d6:	53                   	push   %ebx
+  8013d7:	83 ec 04             	sub    $0x4,%esp
+  8013da:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e2:	eb 03                	jmp    8013e7 <dev_lookup+0x14>
+  8013e4:	83 c0 01             	add    $0x1,%eax
+  8013e7:	8b 1c 85 78 2d 80 00 	mov    0x802d78(,%eax,4),%ebx
+  8013ee:	85 db                	test   %ebx,%ebx
+  8013f0:	74 0b                	je     8013fd <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8013f2:	39 13                	cmp    %edx,(%ebx)
+  8013f4:	75 ee                	jne    8013e4 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8013f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fb:	eb 1f                	jmp    80141c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013fd:	a1 08 44 80 00       	mov    0x804408,%eax
+  801402:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801405:	83 ec 04             	sub    $0x4,%esp
+  801408:	52                   	push   %edx
+  801409:	50                   	push   %eax
+  80140a:	68 fc 2c 80 00       	push   $0x802cfc
+  80140f:	e8 82 ef ff ff       	call   800396 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801414:	83 c4 10             	add    $0x10,%esp
+  801417:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80141c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80141f:	89 1a                	mov    %ebx,(%edx)
+}
+  801421:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801424:	c9                   	leave
+  801425:	c3                   	ret
+
+00801426 <fd_close>:
+{
+  801426:	55                   	push   %ebp
+  801427:	89 e5                	mov    %esp,%ebp
+  801429:	57                   	push   %edi
+  80142a:	56                   	push   %esi
+  80142b:	53                   	push   %ebx
+  80142c:	83 ec 24             	sub    $0x24,%esp
+  80142f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801432:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801435:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801438:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801439:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80143f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801442:	50                   	push   %eax
+  801443:	e8 3b ff ff ff       	call   801383 <fd_lookup>
+  801448:	89 c3                	mov    %eax,%ebx
+  80144a:	83 c4 10             	add    $0x10,%esp
+  80144d:	85 c0                	test   %eax,%eax
+  80144f:	78 05                	js     801456 <fd_close+0x30>
+	    || fd != fd2)
+  801451:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801454:	74 16                	je     80146c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801456:	89 f8                	mov    %edi,%eax
+  801458:	84 c0                	test   %al,%al
+  80145a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801462:	89 d8                	mov    %ebx,%eax
+  801464:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801467:	5b                   	pop    %ebx
+  801468:	5e                   	pop    %esi
+  801469:	5f                   	pop    %edi
+  80146a:	5d                   	pop    %ebp
+  80146b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80146c:	83 ec 08             	sub    $0x8,%esp
+  80146f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801472:	50                   	push   %eax
+  801473:	ff 36                	push   (%esi)
+  801475:	e8 59 ff ff ff       	call   8013d3 <dev_lookup>
+  80147a:	89 c3                	mov    %eax,%ebx
+  80147c:	83 c4 10             	add    $0x10,%esp
+  80147f:	85 c0                	test   %eax,%eax
+  801481:	78 1a                	js     80149d <fd_close+0x77>
+		if (dev->dev_close)
+  801483:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801486:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801489:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80148e:	85 c0                	test   %eax,%eax
+  801490:	74 0b                	je     80149d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801492:	83 ec 0c             	sub    $0xc,%esp
+  801495:	56                   	push   %esi
+  801496:	ff d0                	call   *%eax
+  801498:	89 c3                	mov    %eax,%ebx
+  80149a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80149d:	83 ec 08             	sub    $0x8,%esp
+  8014a0:	56                   	push   %esi
+  8014a1:	6a 00                	push   $0x0
+  8014a3:	e8 01 fb ff ff       	call   800fa9 <sys_page_unmap>
+	return r;
+  8014a8:	83 c4 10             	add    $0x10,%esp
+  8014ab:	eb b5                	jmp    801462 <fd_close+0x3c>
+
+008014ad <close>:
+
+int
+close(int fdnum)
+{
+  8014ad:	55                   	push   %ebp
+  8014ae:	89 e5                	mov    %esp,%ebp
+  8014b0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014b6:	50                   	push   %eax
+  8014b7:	ff 75 08             	push   0x8(%ebp)
+  8014ba:	e8 c4 fe ff ff       	call   801383 <fd_lookup>
+  8014bf:	83 c4 10             	add    $0x10,%esp
+  8014c2:	85 c0                	test   %eax,%eax
+  8014c4:	79 02                	jns    8014c8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014c6:	c9                   	leave
+  8014c7:	c3                   	ret
+		return fd_close(fd, 1);
+  8014c8:	83 ec 08             	sub    $0x8,%esp
+  8014cb:	6a 01                	push   $0x1
+  8014cd:	ff 75 f4             	push   -0xc(%ebp)
+  8014d0:	e8 51 ff ff ff       	call   801426 <fd_close>
+  8014d5:	83 c4 10             	add    $0x10,%esp
+  8014d8:	eb ec                	jmp    8014c6 <close+0x19>
+
+008014da <close_all>:
+
+void
+close_all(void)
+{
+  8014da:	55                   	push   %ebp
+  8014db:	89 e5                	mov    %esp,%ebp
+  8014dd:	53                   	push   %ebx
+  8014de:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014e6:	83 ec 0c             	sub    $0xc,%esp
+  8014e9:	53                   	push   %ebx
+  8014ea:	e8 be ff ff ff       	call   8014ad <close>
+	for (i = 0; i < MAXFD; i++)
+  8014ef:	83 c3 01             	add    $0x1,%ebx
+  8014f2:	83 c4 10             	add    $0x10,%esp
+  8014f5:	83 fb 20             	cmp    $0x20,%ebx
+  8014f8:	75 ec                	jne    8014e6 <close_all+0xc>
+}
+  8014fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014fd:	c9                   	leave
+  8014fe:	c3                   	ret
+
+008014ff <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014ff:	55                   	push   %ebp
+  801500:	89 e5                	mov    %esp,%ebp
+  801502:	57                   	push   %edi
+  801503:	56                   	push   %esi
+  801504:	53                   	push   %ebx
+  801505:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801508:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80150b:	50                   	push   %eax
+  80150c:	ff 75 08             	push   0x8(%ebp)
+  80150f:	e8 6f fe ff ff       	call   801383 <fd_lookup>
+  801514:	89 c3                	mov    %eax,%ebx
+  801516:	83 c4 10             	add    $0x10,%esp
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	78 7f                	js     80159c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80151d:	83 ec 0c             	sub    $0xc,%esp
+  801520:	ff 75 0c             	push   0xc(%ebp)
+  801523:	e8 85 ff ff ff       	call   8014ad <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801528:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80152b:	c1 e6 0c             	shl    $0xc,%esi
+  80152e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801534:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801537:	89 3c 24             	mov    %edi,(%esp)
+  80153a:	e8 d7 fd ff ff       	call   801316 <fd2data>
+  80153f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801541:	89 34 24             	mov    %esi,(%esp)
+  801544:	e8 cd fd ff ff       	call   801316 <fd2data>
+  801549:	83 c4 10             	add    $0x10,%esp
+  80154c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80154f:	89 d8                	mov    %ebx,%eax
+  801551:	c1 e8 16             	shr    $0x16,%eax
+  801554:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80155b:	a8 01                	test   $0x1,%al
+  80155d:	74 11                	je     801570 <dup+0x71>
+  80155f:	89 d8                	mov    %ebx,%eax
+  801561:	c1 e8 0c             	shr    $0xc,%eax
+  801564:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80156b:	f6 c2 01             	test   $0x1,%dl
+  80156e:	75 36                	jne    8015a6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801570:	89 f8                	mov    %edi,%eax
+  801572:	c1 e8 0c             	shr    $0xc,%eax
+  801575:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80157c:	83 ec 0c             	sub    $0xc,%esp
+  80157f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801584:	50                   	push   %eax
+  801585:	56                   	push   %esi
+  801586:	6a 00                	push   $0x0
+  801588:	57                   	push   %edi
+  801589:	6a 00                	push   $0x0
+  80158b:	e8 d7 f9 ff ff       	call   800f67 <sys_page_map>
+  801590:	89 c3                	mov    %eax,%ebx
+  801592:	83 c4 20             	add    $0x20,%esp
+  801595:	85 c0                	test   %eax,%eax
+  801597:	78 33                	js     8015cc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801599:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80159c:	89 d8                	mov    %ebx,%eax
+  80159e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a1:	5b                   	pop    %ebx
+  8015a2:	5e                   	pop    %esi
+  8015a3:	5f                   	pop    %edi
+  8015a4:	5d                   	pop    %ebp
+  8015a5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015a6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ad:	83 ec 0c             	sub    $0xc,%esp
+  8015b0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015b5:	50                   	push   %eax
+  8015b6:	ff 75 d4             	push   -0x2c(%ebp)
+  8015b9:	6a 00                	push   $0x0
+  8015bb:	53                   	push   %ebx
+  8015bc:	6a 00                	push   $0x0
+  8015be:	e8 a4 f9 ff ff       	call   800f67 <sys_page_map>
+  8015c3:	89 c3                	mov    %eax,%ebx
+  8015c5:	83 c4 20             	add    $0x20,%esp
+  8015c8:	85 c0                	test   %eax,%eax
+  8015ca:	79 a4                	jns    801570 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015cc:	83 ec 08             	sub    $0x8,%esp
+  8015cf:	56                   	push   %esi
+  8015d0:	6a 00                	push   $0x0
+  8015d2:	e8 d2 f9 ff ff       	call   800fa9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015d7:	83 c4 08             	add    $0x8,%esp
+  8015da:	ff 75 d4             	push   -0x2c(%ebp)
+  8015dd:	6a 00                	push   $0x0
+  8015df:	e8 c5 f9 ff ff       	call   800fa9 <sys_page_unmap>
+	return r;
+  8015e4:	83 c4 10             	add    $0x10,%esp
+  8015e7:	eb b3                	jmp    80159c <dup+0x9d>
+
+008015e9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015e9:	55                   	push   %ebp
+  8015ea:	89 e5                	mov    %esp,%ebp
+  8015ec:	56                   	push   %esi
+  8015ed:	53                   	push   %ebx
+  8015ee:	83 ec 18             	sub    $0x18,%esp
+  8015f1:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015f4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015f7:	50                   	push   %eax
+  8015f8:	56                   	push   %esi
+  8015f9:	e8 85 fd ff ff       	call   801383 <fd_lookup>
+  8015fe:	83 c4 10             	add    $0x10,%esp
+  801601:	85 c0                	test   %eax,%eax
+  801603:	78 3c                	js     801641 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801605:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801608:	83 ec 08             	sub    $0x8,%esp
+  80160b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80160e:	50                   	push   %eax
+  80160f:	ff 33                	push   (%ebx)
+  801611:	e8 bd fd ff ff       	call   8013d3 <dev_lookup>
+  801616:	83 c4 10             	add    $0x10,%esp
+  801619:	85 c0                	test   %eax,%eax
+  80161b:	78 24                	js     801641 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80161d:	8b 43 08             	mov    0x8(%ebx),%eax
+  801620:	83 e0 03             	and    $0x3,%eax
+  801623:	83 f8 01             	cmp    $0x1,%eax
+  801626:	74 20                	je     801648 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801628:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80162b:	8b 40 08             	mov    0x8(%eax),%eax
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	74 37                	je     801669 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801632:	83 ec 04             	sub    $0x4,%esp
+  801635:	ff 75 10             	push   0x10(%ebp)
+  801638:	ff 75 0c             	push   0xc(%ebp)
+  80163b:	53                   	push   %ebx
+  80163c:	ff d0                	call   *%eax
+  80163e:	83 c4 10             	add    $0x10,%esp
+}
+  801641:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801644:	5b                   	pop    %ebx
+  801645:	5e                   	pop    %esi
+  801646:	5d                   	pop    %ebp
+  801647:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801648:	a1 08 44 80 00       	mov    0x804408,%eax
+  80164d:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801650:	83 ec 04             	sub    $0x4,%esp
+  801653:	56                   	push   %esi
+  801654:	50                   	push   %eax
+  801655:	68 3d 2d 80 00       	push   $0x802d3d
+  80165a:	e8 37 ed ff ff       	call   800396 <cprintf>
+		return -E_INVAL;
+  80165f:	83 c4 10             	add    $0x10,%esp
+  801662:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801667:	eb d8                	jmp    801641 <read+0x58>
+		return -E_NOT_SUPP;
+  801669:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80166e:	eb d1                	jmp    801641 <read+0x58>
+
+00801670 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801670:	55                   	push   %ebp
+  801671:	89 e5                	mov    %esp,%ebp
+  801673:	57                   	push   %edi
+  801674:	56                   	push   %esi
+  801675:	53                   	push   %ebx
+  801676:	83 ec 0c             	sub    $0xc,%esp
+  801679:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80167c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80167f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801684:	eb 02                	jmp    801688 <readn+0x18>
+  801686:	01 c3                	add    %eax,%ebx
+  801688:	39 f3                	cmp    %esi,%ebx
+  80168a:	73 21                	jae    8016ad <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80168c:	83 ec 04             	sub    $0x4,%esp
+  80168f:	89 f0                	mov    %esi,%eax
+  801691:	29 d8                	sub    %ebx,%eax
+  801693:	50                   	push   %eax
+  801694:	89 d8                	mov    %ebx,%eax
+  801696:	03 45 0c             	add    0xc(%ebp),%eax
+  801699:	50                   	push   %eax
+  80169a:	57                   	push   %edi
+  80169b:	e8 49 ff ff ff       	call   8015e9 <read>
+		if (m < 0)
+  8016a0:	83 c4 10             	add    $0x10,%esp
+  8016a3:	85 c0                	test   %eax,%eax
+  8016a5:	78 04                	js     8016ab <readn+0x3b>
+			return m;
+		if (m == 0)
+  8016a7:	75 dd                	jne    801686 <readn+0x16>
+  8016a9:	eb 02                	jmp    8016ad <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016ab:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8016ad:	89 d8                	mov    %ebx,%eax
+  8016af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b2:	5b                   	pop    %ebx
+  8016b3:	5e                   	pop    %esi
+  8016b4:	5f                   	pop    %edi
+  8016b5:	5d                   	pop    %ebp
+  8016b6:	c3                   	ret
+
+008016b7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016b7:	55                   	push   %ebp
+  8016b8:	89 e5                	mov    %esp,%ebp
+  8016ba:	56                   	push   %esi
+  8016bb:	53                   	push   %ebx
+  8016bc:	83 ec 18             	sub    $0x18,%esp
+  8016bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016c2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016c5:	50                   	push   %eax
+  8016c6:	53                   	push   %ebx
+  8016c7:	e8 b7 fc ff ff       	call   801383 <fd_lookup>
+  8016cc:	83 c4 10             	add    $0x10,%esp
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	78 37                	js     80170a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016d3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016d6:	83 ec 08             	sub    $0x8,%esp
+  8016d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016dc:	50                   	push   %eax
+  8016dd:	ff 36                	push   (%esi)
+  8016df:	e8 ef fc ff ff       	call   8013d3 <dev_lookup>
+  8016e4:	83 c4 10             	add    $0x10,%esp
+  8016e7:	85 c0                	test   %eax,%eax
+  8016e9:	78 1f                	js     80170a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016eb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016ef:	74 20                	je     801711 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016f7:	85 c0                	test   %eax,%eax
+  8016f9:	74 37                	je     801732 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016fb:	83 ec 04             	sub    $0x4,%esp
+  8016fe:	ff 75 10             	push   0x10(%ebp)
+  801701:	ff 75 0c             	push   0xc(%ebp)
+  801704:	56                   	push   %esi
+  801705:	ff d0                	call   *%eax
+  801707:	83 c4 10             	add    $0x10,%esp
+}
+  80170a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80170d:	5b                   	pop    %ebx
+  80170e:	5e                   	pop    %esi
+  80170f:	5d                   	pop    %ebp
+  801710:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801711:	a1 08 44 80 00       	mov    0x804408,%eax
+  801716:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801719:	83 ec 04             	sub    $0x4,%esp
+  80171c:	53                   	push   %ebx
+  80171d:	50                   	push   %eax
+  80171e:	68 59 2d 80 00       	push   $0x802d59
+  801723:	e8 6e ec ff ff       	call   800396 <cprintf>
+		return -E_INVAL;
+  801728:	83 c4 10             	add    $0x10,%esp
+  80172b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801730:	eb d8                	jmp    80170a <write+0x53>
+		return -E_NOT_SUPP;
+  801732:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801737:	eb d1                	jmp    80170a <write+0x53>
+
+00801739 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801739:	55                   	push   %ebp
+  80173a:	89 e5                	mov    %esp,%ebp
+  80173c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80173f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801742:	50                   	push   %eax
+  801743:	ff 75 08             	push   0x8(%ebp)
+  801746:	e8 38 fc ff ff       	call   801383 <fd_lookup>
+  80174b:	83 c4 10             	add    $0x10,%esp
+  80174e:	85 c0                	test   %eax,%eax
+  801750:	78 0e                	js     801760 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801752:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801755:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801758:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80175b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801760:	c9                   	leave
+  801761:	c3                   	ret
+
+00801762 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801762:	55                   	push   %ebp
+  801763:	89 e5                	mov    %esp,%ebp
+  801765:	56                   	push   %esi
+  801766:	53                   	push   %ebx
+  801767:	83 ec 18             	sub    $0x18,%esp
+  80176a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80176d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801770:	50                   	push   %eax
+  801771:	53                   	push   %ebx
+  801772:	e8 0c fc ff ff       	call   801383 <fd_lookup>
+  801777:	83 c4 10             	add    $0x10,%esp
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	78 34                	js     8017b2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80177e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801781:	83 ec 08             	sub    $0x8,%esp
+  801784:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801787:	50                   	push   %eax
+  801788:	ff 36                	push   (%esi)
+  80178a:	e8 44 fc ff ff       	call   8013d3 <dev_lookup>
+  80178f:	83 c4 10             	add    $0x10,%esp
+  801792:	85 c0                	test   %eax,%eax
+  801794:	78 1c                	js     8017b2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801796:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80179a:	74 1d                	je     8017b9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80179c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80179f:	8b 40 18             	mov    0x18(%eax),%eax
+  8017a2:	85 c0                	test   %eax,%eax
+  8017a4:	74 34                	je     8017da <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017a6:	83 ec 08             	sub    $0x8,%esp
+  8017a9:	ff 75 0c             	push   0xc(%ebp)
+  8017ac:	56                   	push   %esi
+  8017ad:	ff d0                	call   *%eax
+  8017af:	83 c4 10             	add    $0x10,%esp
+}
+  8017b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017b5:	5b                   	pop    %ebx
+  8017b6:	5e                   	pop    %esi
+  8017b7:	5d                   	pop    %ebp
+  8017b8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8017b9:	a1 08 44 80 00       	mov    0x804408,%eax
+  8017be:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017c1:	83 ec 04             	sub    $0x4,%esp
+  8017c4:	53                   	push   %ebx
+  8017c5:	50                   	push   %eax
+  8017c6:	68 1c 2d 80 00       	push   $0x802d1c
+  8017cb:	e8 c6 eb ff ff       	call   800396 <cprintf>
+		return -E_INVAL;
+  8017d0:	83 c4 10             	add    $0x10,%esp
+  8017d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d8:	eb d8                	jmp    8017b2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017da:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017df:	eb d1                	jmp    8017b2 <ftruncate+0x50>
+
+008017e1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+  8017e4:	56                   	push   %esi
+  8017e5:	53                   	push   %ebx
+  8017e6:	83 ec 18             	sub    $0x18,%esp
+  8017e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017ef:	50                   	push   %eax
+  8017f0:	ff 75 08             	push   0x8(%ebp)
+  8017f3:	e8 8b fb ff ff       	call   801383 <fd_lookup>
+  8017f8:	83 c4 10             	add    $0x10,%esp
+  8017fb:	85 c0                	test   %eax,%eax
+  8017fd:	78 49                	js     801848 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017ff:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801802:	83 ec 08             	sub    $0x8,%esp
+  801805:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801808:	50                   	push   %eax
+  801809:	ff 36                	push   (%esi)
+  80180b:	e8 c3 fb ff ff       	call   8013d3 <dev_lookup>
+  801810:	83 c4 10             	add    $0x10,%esp
+  801813:	85 c0                	test   %eax,%eax
+  801815:	78 31                	js     801848 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801817:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80181a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80181e:	74 2f                	je     80184f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801820:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801823:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80182a:	00 00 00 
+	stat->st_isdir = 0;
+  80182d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801834:	00 00 00 
+	stat->st_dev = dev;
+  801837:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80183d:	83 ec 08             	sub    $0x8,%esp
+  801840:	53                   	push   %ebx
+  801841:	56                   	push   %esi
+  801842:	ff 50 14             	call   *0x14(%eax)
+  801845:	83 c4 10             	add    $0x10,%esp
+}
+  801848:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80184b:	5b                   	pop    %ebx
+  80184c:	5e                   	pop    %esi
+  80184d:	5d                   	pop    %ebp
+  80184e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80184f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801854:	eb f2                	jmp    801848 <fstat+0x67>
+
+00801856 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801856:	55                   	push   %ebp
+  801857:	89 e5                	mov    %esp,%ebp
+  801859:	56                   	push   %esi
+  80185a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80185b:	83 ec 08             	sub    $0x8,%esp
+  80185e:	6a 00                	push   $0x0
+  801860:	ff 75 08             	push   0x8(%ebp)
+  801863:	e8 e4 01 00 00       	call   801a4c <open>
+  801868:	89 c3                	mov    %eax,%ebx
+  80186a:	83 c4 10             	add    $0x10,%esp
+  80186d:	85 c0                	test   %eax,%eax
+  80186f:	78 1b                	js     80188c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801871:	83 ec 08             	sub    $0x8,%esp
+  801874:	ff 75 0c             	push   0xc(%ebp)
+  801877:	50                   	push   %eax
+  801878:	e8 64 ff ff ff       	call   8017e1 <fstat>
+  80187d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80187f:	89 1c 24             	mov    %ebx,(%esp)
+  801882:	e8 26 fc ff ff       	call   8014ad <close>
+	return r;
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	89 f3                	mov    %esi,%ebx
+}
+  80188c:	89 d8                	mov    %ebx,%eax
+  80188e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801891:	5b                   	pop    %ebx
+  801892:	5e                   	pop    %esi
+  801893:	5d                   	pop    %ebp
+  801894:	c3                   	ret
+
+00801895 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801895:	55                   	push   %ebp
+  801896:	89 e5                	mov    %esp,%ebp
+  801898:	56                   	push   %esi
+  801899:	53                   	push   %ebx
+  80189a:	89 c6                	mov    %eax,%esi
+  80189c:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80189e:	83 3d 00 44 80 00 00 	cmpl   $0x0,0x804400
+  8018a5:	74 27                	je     8018ce <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018a7:	6a 07                	push   $0x7
+  8018a9:	68 00 50 80 00       	push   $0x805000
+  8018ae:	56                   	push   %esi
+  8018af:	ff 35 00 44 80 00    	push   0x804400
+  8018b5:	e8 75 0b 00 00       	call   80242f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8018ba:	83 c4 0c             	add    $0xc,%esp
+  8018bd:	6a 00                	push   $0x0
+  8018bf:	53                   	push   %ebx
+  8018c0:	6a 00                	push   $0x0
+  8018c2:	e8 f0 0a 00 00       	call   8023b7 <ipc_recv>
+}
+  8018c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ca:	5b                   	pop    %ebx
+  8018cb:	5e                   	pop    %esi
+  8018cc:	5d                   	pop    %ebp
+  8018cd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018ce:	83 ec 0c             	sub    $0xc,%esp
+  8018d1:	6a 01                	push   $0x1
+  8018d3:	e8 ab 0b 00 00       	call   802483 <ipc_find_env>
+  8018d8:	a3 00 44 80 00       	mov    %eax,0x804400
+  8018dd:	83 c4 10             	add    $0x10,%esp
+  8018e0:	eb c5                	jmp    8018a7 <fsipc+0x12>
+
+008018e2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018e2:	55                   	push   %ebp
+  8018e3:	89 e5                	mov    %esp,%ebp
+  8018e5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018eb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018ee:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8018f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f6:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8018fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801900:	b8 02 00 00 00       	mov    $0x2,%eax
+  801905:	e8 8b ff ff ff       	call   801895 <fsipc>
+}
+  80190a:	c9                   	leave
+  80190b:	c3                   	ret
+
+0080190c <devfile_flush>:
+{
+  80190c:	55                   	push   %ebp
+  80190d:	89 e5                	mov    %esp,%ebp
+  80190f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801912:	8b 45 08             	mov    0x8(%ebp),%eax
+  801915:	8b 40 0c             	mov    0xc(%eax),%eax
+  801918:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80191d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801922:	b8 06 00 00 00       	mov    $0x6,%eax
+  801927:	e8 69 ff ff ff       	call   801895 <fsipc>
+}
+  80192c:	c9                   	leave
+  80192d:	c3                   	ret
+
+0080192e <devfile_stat>:
+{
+  80192e:	55                   	push   %ebp
+  80192f:	89 e5                	mov    %esp,%ebp
+  801931:	53                   	push   %ebx
+  801932:	83 ec 04             	sub    $0x4,%esp
+  801935:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801938:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80193e:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801943:	ba 00 00 00 00       	mov    $0x0,%edx
+  801948:	b8 05 00 00 00       	mov    $0x5,%eax
+  80194d:	e8 43 ff ff ff       	call   801895 <fsipc>
+  801952:	85 c0                	test   %eax,%eax
+  801954:	78 2c                	js     801982 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801956:	83 ec 08             	sub    $0x8,%esp
+  801959:	68 00 50 80 00       	push   $0x805000
+  80195e:	53                   	push   %ebx
+  80195f:	e8 10 f1 ff ff       	call   800a74 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801964:	a1 80 50 80 00       	mov    0x805080,%eax
+  801969:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80196f:	a1 84 50 80 00       	mov    0x805084,%eax
+  801974:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80197a:	83 c4 10             	add    $0x10,%esp
+  80197d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801982:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801985:	c9                   	leave
+  801986:	c3                   	ret
+
+00801987 <devfile_write>:
+{
+  801987:	55                   	push   %ebp
+  801988:	89 e5                	mov    %esp,%ebp
+  80198a:	83 ec 0c             	sub    $0xc,%esp
+  80198d:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801990:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801995:	39 d0                	cmp    %edx,%eax
+  801997:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80199a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80199d:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019a0:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  8019a6:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8019ab:	50                   	push   %eax
+  8019ac:	ff 75 0c             	push   0xc(%ebp)
+  8019af:	68 08 50 80 00       	push   $0x805008
+  8019b4:	e8 41 f2 ff ff       	call   800bfa <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8019b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019be:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019c3:	e8 cd fe ff ff       	call   801895 <fsipc>
+}
+  8019c8:	c9                   	leave
+  8019c9:	c3                   	ret
+
+008019ca <devfile_read>:
+{
+  8019ca:	55                   	push   %ebp
+  8019cb:	89 e5                	mov    %esp,%ebp
+  8019cd:	56                   	push   %esi
+  8019ce:	53                   	push   %ebx
+  8019cf:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019d8:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  8019dd:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8019e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019ed:	e8 a3 fe ff ff       	call   801895 <fsipc>
+  8019f2:	89 c3                	mov    %eax,%ebx
+  8019f4:	85 c0                	test   %eax,%eax
+  8019f6:	78 1f                	js     801a17 <devfile_read+0x4d>
+	assert(r <= n);
+  8019f8:	39 c6                	cmp    %eax,%esi
+  8019fa:	72 24                	jb     801a20 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8019fc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a01:	7f 33                	jg     801a36 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a03:	83 ec 04             	sub    $0x4,%esp
+  801a06:	50                   	push   %eax
+  801a07:	68 00 50 80 00       	push   $0x805000
+  801a0c:	ff 75 0c             	push   0xc(%ebp)
+  801a0f:	e8 e6 f1 ff ff       	call   800bfa <memmove>
+	return r;
+  801a14:	83 c4 10             	add    $0x10,%esp
+}
+  801a17:	89 d8                	mov    %ebx,%eax
+  801a19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a1c:	5b                   	pop    %ebx
+  801a1d:	5e                   	pop    %esi
+  801a1e:	5d                   	pop    %ebp
+  801a1f:	c3                   	ret
+	assert(r <= n);
+  801a20:	68 8c 2d 80 00       	push   $0x802d8c
+  801a25:	68 93 2d 80 00       	push   $0x802d93
+  801a2a:	6a 7c                	push   $0x7c
+  801a2c:	68 a8 2d 80 00       	push   $0x802da8
+  801a31:	e8 85 e8 ff ff       	call   8002bb <_panic>
+	assert(r <= PGSIZE);
+  801a36:	68 b3 2d 80 00       	push   $0x802db3
+  801a3b:	68 93 2d 80 00       	push   $0x802d93
+  801a40:	6a 7d                	push   $0x7d
+  801a42:	68 a8 2d 80 00       	push   $0x802da8
+  801a47:	e8 6f e8 ff ff       	call   8002bb <_panic>
+
+00801a4c <open>:
+{
+  801a4c:	55                   	push   %ebp
+  801a4d:	89 e5                	mov    %esp,%ebp
+  801a4f:	56                   	push   %esi
+  801a50:	53                   	push   %ebx
+  801a51:	83 ec 1c             	sub    $0x1c,%esp
+  801a54:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a57:	56                   	push   %esi
+  801a58:	e8 dc ef ff ff       	call   800a39 <strlen>
+  801a5d:	83 c4 10             	add    $0x10,%esp
+  801a60:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a65:	7f 6c                	jg     801ad3 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801a67:	83 ec 0c             	sub    $0xc,%esp
+  801a6a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a6d:	50                   	push   %eax
+  801a6e:	e8 ba f8 ff ff       	call   80132d <fd_alloc>
+  801a73:	89 c3                	mov    %eax,%ebx
+  801a75:	83 c4 10             	add    $0x10,%esp
+  801a78:	85 c0                	test   %eax,%eax
+  801a7a:	78 3c                	js     801ab8 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a7c:	83 ec 08             	sub    $0x8,%esp
+  801a7f:	56                   	push   %esi
+  801a80:	68 00 50 80 00       	push   $0x805000
+  801a85:	e8 ea ef ff ff       	call   800a74 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a8d:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a92:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a95:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a9a:	e8 f6 fd ff ff       	call   801895 <fsipc>
+  801a9f:	89 c3                	mov    %eax,%ebx
+  801aa1:	83 c4 10             	add    $0x10,%esp
+  801aa4:	85 c0                	test   %eax,%eax
+  801aa6:	78 19                	js     801ac1 <open+0x75>
+	return fd2num(fd);
+  801aa8:	83 ec 0c             	sub    $0xc,%esp
+  801aab:	ff 75 f4             	push   -0xc(%ebp)
+  801aae:	e8 53 f8 ff ff       	call   801306 <fd2num>
+  801ab3:	89 c3                	mov    %eax,%ebx
+  801ab5:	83 c4 10             	add    $0x10,%esp
+}
+  801ab8:	89 d8                	mov    %ebx,%eax
+  801aba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801abd:	5b                   	pop    %ebx
+  801abe:	5e                   	pop    %esi
+  801abf:	5d                   	pop    %ebp
+  801ac0:	c3                   	ret
+		fd_close(fd, 0);
+  801ac1:	83 ec 08             	sub    $0x8,%esp
+  801ac4:	6a 00                	push   $0x0
+  801ac6:	ff 75 f4             	push   -0xc(%ebp)
+  801ac9:	e8 58 f9 ff ff       	call   801426 <fd_close>
+		return r;
+  801ace:	83 c4 10             	add    $0x10,%esp
+  801ad1:	eb e5                	jmp    801ab8 <open+0x6c>
+		return -E_BAD_PATH;
+  801ad3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ad8:	eb de                	jmp    801ab8 <open+0x6c>
+
+00801ada <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ada:	55                   	push   %ebp
+  801adb:	89 e5                	mov    %esp,%ebp
+  801add:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801ae0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae5:	b8 08 00 00 00       	mov    $0x8,%eax
+  801aea:	e8 a6 fd ff ff       	call   801895 <fsipc>
+}
+  801aef:	c9                   	leave
+  801af0:	c3                   	ret
+
+00801af1 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801af1:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801af5:	7f 01                	jg     801af8 <writebuf+0x7>
+  801af7:	c3                   	ret
+{
+  801af8:	55                   	push   %ebp
+  801af9:	89 e5                	mov    %esp,%ebp
+  801afb:	53                   	push   %ebx
+  801afc:	83 ec 08             	sub    $0x8,%esp
+  801aff:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801b01:	ff 70 04             	push   0x4(%eax)
+  801b04:	8d 40 10             	lea    0x10(%eax),%eax
+  801b07:	50                   	push   %eax
+  801b08:	ff 33                	push   (%ebx)
+  801b0a:	e8 a8 fb ff ff       	call   8016b7 <write>
+		if (result > 0)
+  801b0f:	83 c4 10             	add    $0x10,%esp
+  801b12:	85 c0                	test   %eax,%eax
+  801b14:	7e 03                	jle    801b19 <writebuf+0x28>
+			b->result += result;
+  801b16:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801b19:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801b1c:	74 0d                	je     801b2b <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801b1e:	85 c0                	test   %eax,%eax
+  801b20:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b25:	0f 4f c2             	cmovg  %edx,%eax
+  801b28:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801b2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b2e:	c9                   	leave
+  801b2f:	c3                   	ret
+
+00801b30 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801b30:	55                   	push   %ebp
+  801b31:	89 e5                	mov    %esp,%ebp
+  801b33:	53                   	push   %ebx
+  801b34:	83 ec 04             	sub    $0x4,%esp
+  801b37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801b3a:	8b 53 04             	mov    0x4(%ebx),%edx
+  801b3d:	8d 42 01             	lea    0x1(%edx),%eax
+  801b40:	89 43 04             	mov    %eax,0x4(%ebx)
+  801b43:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b46:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801b4a:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801b4f:	74 05                	je     801b56 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801b51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b54:	c9                   	leave
+  801b55:	c3                   	ret
+		writebuf(b);
+  801b56:	89 d8                	mov    %ebx,%eax
+  801b58:	e8 94 ff ff ff       	call   801af1 <writebuf>
+		b->idx = 0;
+  801b5d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801b64:	eb eb                	jmp    801b51 <putch+0x21>
+
+00801b66 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801b66:	55                   	push   %ebp
+  801b67:	89 e5                	mov    %esp,%ebp
+  801b69:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801b6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b72:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801b78:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801b7f:	00 00 00 
+	b.result = 0;
+  801b82:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801b89:	00 00 00 
+	b.error = 1;
+  801b8c:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801b93:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801b96:	ff 75 10             	push   0x10(%ebp)
+  801b99:	ff 75 0c             	push   0xc(%ebp)
+  801b9c:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801ba2:	50                   	push   %eax
+  801ba3:	68 30 1b 80 00       	push   $0x801b30
+  801ba8:	e8 e0 e8 ff ff       	call   80048d <vprintfmt>
+	if (b.idx > 0)
+  801bad:	83 c4 10             	add    $0x10,%esp
+  801bb0:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801bb7:	7f 12                	jg     801bcb <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801bb9:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801bbf:	85 c0                	test   %eax,%eax
+  801bc1:	75 06                	jne    801bc9 <vfprintf+0x63>
+  801bc3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801bc9:	c9                   	leave
+  801bca:	c3                   	ret
+		writebuf(&b);
+  801bcb:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801bd1:	e8 1b ff ff ff       	call   801af1 <writebuf>
+  801bd6:	eb e1                	jmp    801bb9 <vfprintf+0x53>
+
+00801bd8 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801bd8:	55                   	push   %ebp
+  801bd9:	89 e5                	mov    %esp,%ebp
+  801bdb:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801bde:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801be1:	50                   	push   %eax
+  801be2:	ff 75 0c             	push   0xc(%ebp)
+  801be5:	ff 75 08             	push   0x8(%ebp)
+  801be8:	e8 79 ff ff ff       	call   801b66 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801bed:	c9                   	leave
+  801bee:	c3                   	ret
+
+00801bef <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801bef:	55                   	push   %ebp
+  801bf0:	89 e5                	mov    %esp,%ebp
+  801bf2:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801bf5:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801bf8:	50                   	push   %eax
+  801bf9:	ff 75 08             	push   0x8(%ebp)
+  801bfc:	6a 01                	push   $0x1
+  801bfe:	e8 63 ff ff ff       	call   801b66 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801c03:	c9                   	leave
+  801c04:	c3                   	ret
+
+00801c05 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c05:	55                   	push   %ebp
+  801c06:	89 e5                	mov    %esp,%ebp
+  801c08:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c0b:	68 bf 2d 80 00       	push   $0x802dbf
+  801c10:	ff 75 0c             	push   0xc(%ebp)
+  801c13:	e8 5c ee ff ff       	call   800a74 <strcpy>
+	return 0;
+}
+  801c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1d:	c9                   	leave
+  801c1e:	c3                   	ret
+
+00801c1f <devsock_close>:
+{
+  801c1f:	55                   	push   %ebp
+  801c20:	89 e5                	mov    %esp,%ebp
+  801c22:	53                   	push   %ebx
+  801c23:	83 ec 10             	sub    $0x10,%esp
+  801c26:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c29:	53                   	push   %ebx
+  801c2a:	e8 64 08 00 00       	call   802493 <pageref>
+  801c2f:	89 c2                	mov    %eax,%edx
+  801c31:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c34:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c39:	83 fa 01             	cmp    $0x1,%edx
+  801c3c:	74 05                	je     801c43 <devsock_close+0x24>
+}
+  801c3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c41:	c9                   	leave
+  801c42:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c43:	83 ec 0c             	sub    $0xc,%esp
+  801c46:	ff 73 0c             	push   0xc(%ebx)
+  801c49:	e8 b7 02 00 00       	call   801f05 <nsipc_close>
+  801c4e:	83 c4 10             	add    $0x10,%esp
+  801c51:	eb eb                	jmp    801c3e <devsock_close+0x1f>
+
+00801c53 <devsock_write>:
+{
+  801c53:	55                   	push   %ebp
+  801c54:	89 e5                	mov    %esp,%ebp
+  801c56:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c59:	6a 00                	push   $0x0
+  801c5b:	ff 75 10             	push   0x10(%ebp)
+  801c5e:	ff 75 0c             	push   0xc(%ebp)
+  801c61:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c64:	ff 70 0c             	push   0xc(%eax)
+  801c67:	e8 79 03 00 00       	call   801fe5 <nsipc_send>
+}
+  801c6c:	c9                   	leave
+  801c6d:	c3                   	ret
+
+00801c6e <devsock_read>:
+{
+  801c6e:	55                   	push   %ebp
+  801c6f:	89 e5                	mov    %esp,%ebp
+  801c71:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c74:	6a 00                	push   $0x0
+  801c76:	ff 75 10             	push   0x10(%ebp)
+  801c79:	ff 75 0c             	push   0xc(%ebp)
+  801c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7f:	ff 70 0c             	push   0xc(%eax)
+  801c82:	e8 ef 02 00 00       	call   801f76 <nsipc_recv>
+}
+  801c87:	c9                   	leave
+  801c88:	c3                   	ret
+
+00801c89 <fd2sockid>:
+{
+  801c89:	55                   	push   %ebp
+  801c8a:	89 e5                	mov    %esp,%ebp
+  801c8c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c8f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c92:	52                   	push   %edx
+  801c93:	50                   	push   %eax
+  801c94:	e8 ea f6 ff ff       	call   801383 <fd_lookup>
+  801c99:	83 c4 10             	add    $0x10,%esp
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	78 10                	js     801cb0 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801ca0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ca3:	8b 0d 3c 30 80 00    	mov    0x80303c,%ecx
+  801ca9:	39 08                	cmp    %ecx,(%eax)
+  801cab:	75 05                	jne    801cb2 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cad:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cb0:	c9                   	leave
+  801cb1:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cb2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cb7:	eb f7                	jmp    801cb0 <fd2sockid+0x27>
+
+00801cb9 <alloc_sockfd>:
+{
+  801cb9:	55                   	push   %ebp
+  801cba:	89 e5                	mov    %esp,%ebp
+  801cbc:	56                   	push   %esi
+  801cbd:	53                   	push   %ebx
+  801cbe:	83 ec 1c             	sub    $0x1c,%esp
+  801cc1:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cc3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cc6:	50                   	push   %eax
+  801cc7:	e8 61 f6 ff ff       	call   80132d <fd_alloc>
+  801ccc:	89 c3                	mov    %eax,%ebx
+  801cce:	83 c4 10             	add    $0x10,%esp
+  801cd1:	85 c0                	test   %eax,%eax
+  801cd3:	78 43                	js     801d18 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cd5:	83 ec 04             	sub    $0x4,%esp
+  801cd8:	68 07 04 00 00       	push   $0x407
+  801cdd:	ff 75 f4             	push   -0xc(%ebp)
+  801ce0:	6a 00                	push   $0x0
+  801ce2:	e8 fa f1 ff ff       	call   800ee1 <sys_page_alloc>
+  801ce7:	89 c3                	mov    %eax,%ebx
+  801ce9:	83 c4 10             	add    $0x10,%esp
+  801cec:	85 c0                	test   %eax,%eax
+  801cee:	78 28                	js     801d18 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801cf0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cf3:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  801cf9:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801cfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cfe:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d05:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d08:	83 ec 0c             	sub    $0xc,%esp
+  801d0b:	50                   	push   %eax
+  801d0c:	e8 f5 f5 ff ff       	call   801306 <fd2num>
+  801d11:	89 c3                	mov    %eax,%ebx
+  801d13:	83 c4 10             	add    $0x10,%esp
+  801d16:	eb 0c                	jmp    801d24 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d18:	83 ec 0c             	sub    $0xc,%esp
+  801d1b:	56                   	push   %esi
+  801d1c:	e8 e4 01 00 00       	call   801f05 <nsipc_close>
+		return r;
+  801d21:	83 c4 10             	add    $0x10,%esp
+}
+  801d24:	89 d8                	mov    %ebx,%eax
+  801d26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d29:	5b                   	pop    %ebx
+  801d2a:	5e                   	pop    %esi
+  801d2b:	5d                   	pop    %ebp
+  801d2c:	c3                   	ret
+
+00801d2d <accept>:
+{
+  801d2d:	55                   	push   %ebp
+  801d2e:	89 e5                	mov    %esp,%ebp
+  801d30:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d36:	e8 4e ff ff ff       	call   801c89 <fd2sockid>
+  801d3b:	85 c0                	test   %eax,%eax
+  801d3d:	78 1b                	js     801d5a <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d3f:	83 ec 04             	sub    $0x4,%esp
+  801d42:	ff 75 10             	push   0x10(%ebp)
+  801d45:	ff 75 0c             	push   0xc(%ebp)
+  801d48:	50                   	push   %eax
+  801d49:	e8 0e 01 00 00       	call   801e5c <nsipc_accept>
+  801d4e:	83 c4 10             	add    $0x10,%esp
+  801d51:	85 c0                	test   %eax,%eax
+  801d53:	78 05                	js     801d5a <accept+0x2d>
+	return alloc_sockfd(r);
+  801d55:	e8 5f ff ff ff       	call   801cb9 <alloc_sockfd>
+}
+  801d5a:	c9                   	leave
+  801d5b:	c3                   	ret
+
+00801d5c <bind>:
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d62:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d65:	e8 1f ff ff ff       	call   801c89 <fd2sockid>
+  801d6a:	85 c0                	test   %eax,%eax
+  801d6c:	78 12                	js     801d80 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d6e:	83 ec 04             	sub    $0x4,%esp
+  801d71:	ff 75 10             	push   0x10(%ebp)
+  801d74:	ff 75 0c             	push   0xc(%ebp)
+  801d77:	50                   	push   %eax
+  801d78:	e8 31 01 00 00       	call   801eae <nsipc_bind>
+  801d7d:	83 c4 10             	add    $0x10,%esp
+}
+  801d80:	c9                   	leave
+  801d81:	c3                   	ret
+
+00801d82 <shutdown>:
+{
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d88:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8b:	e8 f9 fe ff ff       	call   801c89 <fd2sockid>
+  801d90:	85 c0                	test   %eax,%eax
+  801d92:	78 0f                	js     801da3 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d94:	83 ec 08             	sub    $0x8,%esp
+  801d97:	ff 75 0c             	push   0xc(%ebp)
+  801d9a:	50                   	push   %eax
+  801d9b:	e8 43 01 00 00       	call   801ee3 <nsipc_shutdown>
+  801da0:	83 c4 10             	add    $0x10,%esp
+}
+  801da3:	c9                   	leave
+  801da4:	c3                   	ret
+
+00801da5 <connect>:
+{
+  801da5:	55                   	push   %ebp
+  801da6:	89 e5                	mov    %esp,%ebp
+  801da8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dae:	e8 d6 fe ff ff       	call   801c89 <fd2sockid>
+  801db3:	85 c0                	test   %eax,%eax
+  801db5:	78 12                	js     801dc9 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801db7:	83 ec 04             	sub    $0x4,%esp
+  801dba:	ff 75 10             	push   0x10(%ebp)
+  801dbd:	ff 75 0c             	push   0xc(%ebp)
+  801dc0:	50                   	push   %eax
+  801dc1:	e8 59 01 00 00       	call   801f1f <nsipc_connect>
+  801dc6:	83 c4 10             	add    $0x10,%esp
+}
+  801dc9:	c9                   	leave
+  801dca:	c3                   	ret
+
+00801dcb <listen>:
+{
+  801dcb:	55                   	push   %ebp
+  801dcc:	89 e5                	mov    %esp,%ebp
+  801dce:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd4:	e8 b0 fe ff ff       	call   801c89 <fd2sockid>
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 0f                	js     801dec <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801ddd:	83 ec 08             	sub    $0x8,%esp
+  801de0:	ff 75 0c             	push   0xc(%ebp)
+  801de3:	50                   	push   %eax
+  801de4:	e8 6b 01 00 00       	call   801f54 <nsipc_listen>
+  801de9:	83 c4 10             	add    $0x10,%esp
+}
+  801dec:	c9                   	leave
+  801ded:	c3                   	ret
+
+00801dee <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801dee:	55                   	push   %ebp
+  801def:	89 e5                	mov    %esp,%ebp
+  801df1:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801df4:	ff 75 10             	push   0x10(%ebp)
+  801df7:	ff 75 0c             	push   0xc(%ebp)
+  801dfa:	ff 75 08             	push   0x8(%ebp)
+  801dfd:	e8 41 02 00 00       	call   802043 <nsipc_socket>
+  801e02:	83 c4 10             	add    $0x10,%esp
+  801e05:	85 c0                	test   %eax,%eax
+  801e07:	78 05                	js     801e0e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e09:	e8 ab fe ff ff       	call   801cb9 <alloc_sockfd>
+}
+  801e0e:	c9                   	leave
+  801e0f:	c3                   	ret
+
+00801e10 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e10:	55                   	push   %ebp
+  801e11:	89 e5                	mov    %esp,%ebp
+  801e13:	53                   	push   %ebx
+  801e14:	83 ec 04             	sub    $0x4,%esp
+  801e17:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e19:	83 3d 04 44 80 00 00 	cmpl   $0x0,0x804404
+  801e20:	74 26                	je     801e48 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e22:	6a 07                	push   $0x7
+  801e24:	68 00 60 80 00       	push   $0x806000
+  801e29:	53                   	push   %ebx
+  801e2a:	ff 35 04 44 80 00    	push   0x804404
+  801e30:	e8 fa 05 00 00       	call   80242f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e35:	83 c4 0c             	add    $0xc,%esp
+  801e38:	6a 00                	push   $0x0
+  801e3a:	6a 00                	push   $0x0
+  801e3c:	6a 00                	push   $0x0
+  801e3e:	e8 74 05 00 00       	call   8023b7 <ipc_recv>
+}
+  801e43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e46:	c9                   	leave
+  801e47:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e48:	83 ec 0c             	sub    $0xc,%esp
+  801e4b:	6a 02                	push   $0x2
+  801e4d:	e8 31 06 00 00       	call   802483 <ipc_find_env>
+  801e52:	a3 04 44 80 00       	mov    %eax,0x804404
+  801e57:	83 c4 10             	add    $0x10,%esp
+  801e5a:	eb c6                	jmp    801e22 <nsipc+0x12>
+
+00801e5c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	56                   	push   %esi
+  801e60:	53                   	push   %ebx
+  801e61:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e67:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e6c:	8b 06                	mov    (%esi),%eax
+  801e6e:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e73:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e78:	e8 93 ff ff ff       	call   801e10 <nsipc>
+  801e7d:	89 c3                	mov    %eax,%ebx
+  801e7f:	85 c0                	test   %eax,%eax
+  801e81:	79 09                	jns    801e8c <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e83:	89 d8                	mov    %ebx,%eax
+  801e85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e88:	5b                   	pop    %ebx
+  801e89:	5e                   	pop    %esi
+  801e8a:	5d                   	pop    %ebp
+  801e8b:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801e8c:	83 ec 04             	sub    $0x4,%esp
+  801e8f:	ff 35 10 60 80 00    	push   0x806010
+  801e95:	68 00 60 80 00       	push   $0x806000
+  801e9a:	ff 75 0c             	push   0xc(%ebp)
+  801e9d:	e8 58 ed ff ff       	call   800bfa <memmove>
+		*addrlen = ret->ret_addrlen;
+  801ea2:	a1 10 60 80 00       	mov    0x806010,%eax
+  801ea7:	89 06                	mov    %eax,(%esi)
+  801ea9:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801eac:	eb d5                	jmp    801e83 <nsipc_accept+0x27>
+
+00801eae <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801eae:	55                   	push   %ebp
+  801eaf:	89 e5                	mov    %esp,%ebp
+  801eb1:	53                   	push   %ebx
+  801eb2:	83 ec 08             	sub    $0x8,%esp
+  801eb5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801eb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ebb:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ec0:	53                   	push   %ebx
+  801ec1:	ff 75 0c             	push   0xc(%ebp)
+  801ec4:	68 04 60 80 00       	push   $0x806004
+  801ec9:	e8 2c ed ff ff       	call   800bfa <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801ece:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801ed4:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ed9:	e8 32 ff ff ff       	call   801e10 <nsipc>
+}
+  801ede:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee1:	c9                   	leave
+  801ee2:	c3                   	ret
+
+00801ee3 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801ee3:	55                   	push   %ebp
+  801ee4:	89 e5                	mov    %esp,%ebp
+  801ee6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801ee9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eec:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801ef1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ef4:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801ef9:	b8 03 00 00 00       	mov    $0x3,%eax
+  801efe:	e8 0d ff ff ff       	call   801e10 <nsipc>
+}
+  801f03:	c9                   	leave
+  801f04:	c3                   	ret
+
+00801f05 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f05:	55                   	push   %ebp
+  801f06:	89 e5                	mov    %esp,%ebp
+  801f08:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801f13:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f18:	e8 f3 fe ff ff       	call   801e10 <nsipc>
+}
+  801f1d:	c9                   	leave
+  801f1e:	c3                   	ret
+
+00801f1f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f1f:	55                   	push   %ebp
+  801f20:	89 e5                	mov    %esp,%ebp
+  801f22:	53                   	push   %ebx
+  801f23:	83 ec 08             	sub    $0x8,%esp
+  801f26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2c:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f31:	53                   	push   %ebx
+  801f32:	ff 75 0c             	push   0xc(%ebp)
+  801f35:	68 04 60 80 00       	push   $0x806004
+  801f3a:	e8 bb ec ff ff       	call   800bfa <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f3f:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801f45:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f4a:	e8 c1 fe ff ff       	call   801e10 <nsipc>
+}
+  801f4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f52:	c9                   	leave
+  801f53:	c3                   	ret
+
+00801f54 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f54:	55                   	push   %ebp
+  801f55:	89 e5                	mov    %esp,%ebp
+  801f57:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5d:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f62:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f65:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801f6a:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f6f:	e8 9c fe ff ff       	call   801e10 <nsipc>
+}
+  801f74:	c9                   	leave
+  801f75:	c3                   	ret
+
+00801f76 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f76:	55                   	push   %ebp
+  801f77:	89 e5                	mov    %esp,%ebp
+  801f79:	56                   	push   %esi
+  801f7a:	53                   	push   %ebx
+  801f7b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f81:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801f86:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801f8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f8f:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801f94:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f99:	e8 72 fe ff ff       	call   801e10 <nsipc>
+  801f9e:	89 c3                	mov    %eax,%ebx
+  801fa0:	85 c0                	test   %eax,%eax
+  801fa2:	78 22                	js     801fc6 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fa4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801fa9:	39 c6                	cmp    %eax,%esi
+  801fab:	0f 4e c6             	cmovle %esi,%eax
+  801fae:	39 c3                	cmp    %eax,%ebx
+  801fb0:	7f 1d                	jg     801fcf <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fb2:	83 ec 04             	sub    $0x4,%esp
+  801fb5:	53                   	push   %ebx
+  801fb6:	68 00 60 80 00       	push   $0x806000
+  801fbb:	ff 75 0c             	push   0xc(%ebp)
+  801fbe:	e8 37 ec ff ff       	call   800bfa <memmove>
+  801fc3:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801fc6:	89 d8                	mov    %ebx,%eax
+  801fc8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fcb:	5b                   	pop    %ebx
+  801fcc:	5e                   	pop    %esi
+  801fcd:	5d                   	pop    %ebp
+  801fce:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fcf:	68 cb 2d 80 00       	push   $0x802dcb
+  801fd4:	68 93 2d 80 00       	push   $0x802d93
+  801fd9:	6a 62                	push   $0x62
+  801fdb:	68 e0 2d 80 00       	push   $0x802de0
+  801fe0:	e8 d6 e2 ff ff       	call   8002bb <_panic>
+
+00801fe5 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801fe5:	55                   	push   %ebp
+  801fe6:	89 e5                	mov    %esp,%ebp
+  801fe8:	53                   	push   %ebx
+  801fe9:	83 ec 04             	sub    $0x4,%esp
+  801fec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801fef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff2:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801ff7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801ffd:	7f 2e                	jg     80202d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801fff:	83 ec 04             	sub    $0x4,%esp
+  802002:	53                   	push   %ebx
+  802003:	ff 75 0c             	push   0xc(%ebp)
+  802006:	68 0c 60 80 00       	push   $0x80600c
+  80200b:	e8 ea eb ff ff       	call   800bfa <memmove>
+	nsipcbuf.send.req_size = size;
+  802010:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  802016:	8b 45 14             	mov    0x14(%ebp),%eax
+  802019:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  80201e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802023:	e8 e8 fd ff ff       	call   801e10 <nsipc>
+}
+  802028:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80202b:	c9                   	leave
+  80202c:	c3                   	ret
+	assert(size < 1600);
+  80202d:	68 ec 2d 80 00       	push   $0x802dec
+  802032:	68 93 2d 80 00       	push   $0x802d93
+  802037:	6a 6d                	push   $0x6d
+  802039:	68 e0 2d 80 00       	push   $0x802de0
+  80203e:	e8 78 e2 ff ff       	call   8002bb <_panic>
+
+00802043 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802043:	55                   	push   %ebp
+  802044:	89 e5                	mov    %esp,%ebp
+  802046:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802049:	8b 45 08             	mov    0x8(%ebp),%eax
+  80204c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  802051:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802054:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  802059:	8b 45 10             	mov    0x10(%ebp),%eax
+  80205c:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  802061:	b8 09 00 00 00       	mov    $0x9,%eax
+  802066:	e8 a5 fd ff ff       	call   801e10 <nsipc>
+}
+  80206b:	c9                   	leave
+  80206c:	c3                   	ret
+
+0080206d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80206d:	55                   	push   %ebp
+  80206e:	89 e5                	mov    %esp,%ebp
+  802070:	56                   	push   %esi
+  802071:	53                   	push   %ebx
+  802072:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802075:	83 ec 0c             	sub    $0xc,%esp
+  802078:	ff 75 08             	push   0x8(%ebp)
+  80207b:	e8 96 f2 ff ff       	call   801316 <fd2data>
+  802080:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802082:	83 c4 08             	add    $0x8,%esp
+  802085:	68 f8 2d 80 00       	push   $0x802df8
+  80208a:	53                   	push   %ebx
+  80208b:	e8 e4 e9 ff ff       	call   800a74 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802090:	8b 46 04             	mov    0x4(%esi),%eax
+  802093:	2b 06                	sub    (%esi),%eax
+  802095:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80209b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020a2:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020a5:	c7 83 88 00 00 00 58 	movl   $0x803058,0x88(%ebx)
+  8020ac:	30 80 00 
+	return 0;
+}
+  8020af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020b7:	5b                   	pop    %ebx
+  8020b8:	5e                   	pop    %esi
+  8020b9:	5d                   	pop    %ebp
+  8020ba:	c3                   	ret
+
+008020bb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020bb:	55                   	push   %ebp
+  8020bc:	89 e5                	mov    %esp,%ebp
+  8020be:	53                   	push   %ebx
+  8020bf:	83 ec 0c             	sub    $0xc,%esp
+  8020c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020c5:	53                   	push   %ebx
+  8020c6:	6a 00                	push   $0x0
+  8020c8:	e8 dc ee ff ff       	call   800fa9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020cd:	89 1c 24             	mov    %ebx,(%esp)
+  8020d0:	e8 41 f2 ff ff       	call   801316 <fd2data>
+  8020d5:	83 c4 08             	add    $0x8,%esp
+  8020d8:	50                   	push   %eax
+  8020d9:	6a 00                	push   $0x0
+  8020db:	e8 c9 ee ff ff       	call   800fa9 <sys_page_unmap>
+}
+  8020e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020e3:	c9                   	leave
+  8020e4:	c3                   	ret
+
+008020e5 <_pipeisclosed>:
+{
+  8020e5:	55                   	push   %ebp
+  8020e6:	89 e5                	mov    %esp,%ebp
+  8020e8:	57                   	push   %edi
+  8020e9:	56                   	push   %esi
+  8020ea:	53                   	push   %ebx
+  8020eb:	83 ec 1c             	sub    $0x1c,%esp
+  8020ee:	89 c7                	mov    %eax,%edi
+  8020f0:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8020f2:	a1 08 44 80 00       	mov    0x804408,%eax
+  8020f7:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8020fa:	83 ec 0c             	sub    $0xc,%esp
+  8020fd:	57                   	push   %edi
+  8020fe:	e8 90 03 00 00       	call   802493 <pageref>
+  802103:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802106:	89 34 24             	mov    %esi,(%esp)
+  802109:	e8 85 03 00 00       	call   802493 <pageref>
+		nn = thisenv->env_runs;
+  80210e:	8b 15 08 44 80 00    	mov    0x804408,%edx
+  802114:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802117:	83 c4 10             	add    $0x10,%esp
+  80211a:	39 cb                	cmp    %ecx,%ebx
+  80211c:	74 1b                	je     802139 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80211e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802121:	75 cf                	jne    8020f2 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802123:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802126:	6a 01                	push   $0x1
+  802128:	50                   	push   %eax
+  802129:	53                   	push   %ebx
+  80212a:	68 ff 2d 80 00       	push   $0x802dff
+  80212f:	e8 62 e2 ff ff       	call   800396 <cprintf>
+  802134:	83 c4 10             	add    $0x10,%esp
+  802137:	eb b9                	jmp    8020f2 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802139:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80213c:	0f 94 c0             	sete   %al
+  80213f:	0f b6 c0             	movzbl %al,%eax
+}
+  802142:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802145:	5b                   	pop    %ebx
+  802146:	5e                   	pop    %esi
+  802147:	5f                   	pop    %edi
+  802148:	5d                   	pop    %ebp
+  802149:	c3                   	ret
+
+0080214a <devpipe_write>:
+{
+  80214a:	55                   	push   %ebp
+  80214b:	89 e5                	mov    %esp,%ebp
+  80214d:	57                   	push   %edi
+  80214e:	56                   	push   %esi
+  80214f:	53                   	push   %ebx
+  802150:	83 ec 28             	sub    $0x28,%esp
+  802153:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802156:	56                   	push   %esi
+  802157:	e8 ba f1 ff ff       	call   801316 <fd2data>
+  80215c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80215e:	83 c4 10             	add    $0x10,%esp
+  802161:	bf 00 00 00 00       	mov    $0x0,%edi
+  802166:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802169:	75 09                	jne    802174 <devpipe_write+0x2a>
+	return i;
+  80216b:	89 f8                	mov    %edi,%eax
+  80216d:	eb 23                	jmp    802192 <devpipe_write+0x48>
+			sys_yield();
+  80216f:	e8 ed ec ff ff       	call   800e61 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802174:	8b 43 04             	mov    0x4(%ebx),%eax
+  802177:	8b 0b                	mov    (%ebx),%ecx
+  802179:	8d 51 20             	lea    0x20(%ecx),%edx
+  80217c:	39 d0                	cmp    %edx,%eax
+  80217e:	72 1a                	jb     80219a <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802180:	89 da                	mov    %ebx,%edx
+  802182:	89 f0                	mov    %esi,%eax
+  802184:	e8 5c ff ff ff       	call   8020e5 <_pipeisclosed>
+  802189:	85 c0                	test   %eax,%eax
+  80218b:	74 e2                	je     80216f <devpipe_write+0x25>
+				return 0;
+  80218d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802192:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802195:	5b                   	pop    %ebx
+  802196:	5e                   	pop    %esi
+  802197:	5f                   	pop    %edi
+  802198:	5d                   	pop    %ebp
+  802199:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80219a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80219d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021a1:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021a4:	89 c2                	mov    %eax,%edx
+  8021a6:	c1 fa 1f             	sar    $0x1f,%edx
+  8021a9:	89 d1                	mov    %edx,%ecx
+  8021ab:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021ae:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021b1:	83 e2 1f             	and    $0x1f,%edx
+  8021b4:	29 ca                	sub    %ecx,%edx
+  8021b6:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021ba:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021be:	83 c0 01             	add    $0x1,%eax
+  8021c1:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021c4:	83 c7 01             	add    $0x1,%edi
+  8021c7:	eb 9d                	jmp    802166 <devpipe_write+0x1c>
+
+008021c9 <devpipe_read>:
+{
+  8021c9:	55                   	push   %ebp
+  8021ca:	89 e5                	mov    %esp,%ebp
+  8021cc:	57                   	push   %edi
+  8021cd:	56                   	push   %esi
+  8021ce:	53                   	push   %ebx
+  8021cf:	83 ec 18             	sub    $0x18,%esp
+  8021d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021d5:	57                   	push   %edi
+  8021d6:	e8 3b f1 ff ff       	call   801316 <fd2data>
+  8021db:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021dd:	83 c4 10             	add    $0x10,%esp
+  8021e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021e8:	75 13                	jne    8021fd <devpipe_read+0x34>
+	return i;
+  8021ea:	89 f0                	mov    %esi,%eax
+  8021ec:	eb 02                	jmp    8021f0 <devpipe_read+0x27>
+				return i;
+  8021ee:	89 f0                	mov    %esi,%eax
+}
+  8021f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f3:	5b                   	pop    %ebx
+  8021f4:	5e                   	pop    %esi
+  8021f5:	5f                   	pop    %edi
+  8021f6:	5d                   	pop    %ebp
+  8021f7:	c3                   	ret
+			sys_yield();
+  8021f8:	e8 64 ec ff ff       	call   800e61 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8021fd:	8b 03                	mov    (%ebx),%eax
+  8021ff:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802202:	75 18                	jne    80221c <devpipe_read+0x53>
+			if (i > 0)
+  802204:	85 f6                	test   %esi,%esi
+  802206:	75 e6                	jne    8021ee <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802208:	89 da                	mov    %ebx,%edx
+  80220a:	89 f8                	mov    %edi,%eax
+  80220c:	e8 d4 fe ff ff       	call   8020e5 <_pipeisclosed>
+  802211:	85 c0                	test   %eax,%eax
+  802213:	74 e3                	je     8021f8 <devpipe_read+0x2f>
+				return 0;
+  802215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221a:	eb d4                	jmp    8021f0 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80221c:	99                   	cltd
+  80221d:	c1 ea 1b             	shr    $0x1b,%edx
+  802220:	01 d0                	add    %edx,%eax
+  802222:	83 e0 1f             	and    $0x1f,%eax
+  802225:	29 d0                	sub    %edx,%eax
+  802227:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80222c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80222f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802232:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802235:	83 c6 01             	add    $0x1,%esi
+  802238:	eb ab                	jmp    8021e5 <devpipe_read+0x1c>
+
+0080223a <pipe>:
+{
+  80223a:	55                   	push   %ebp
+  80223b:	89 e5                	mov    %esp,%ebp
+  80223d:	56                   	push   %esi
+  80223e:	53                   	push   %ebx
+  80223f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802242:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802245:	50                   	push   %eax
+  802246:	e8 e2 f0 ff ff       	call   80132d <fd_alloc>
+  80224b:	89 c3                	mov    %eax,%ebx
+  80224d:	83 c4 10             	add    $0x10,%esp
+  802250:	85 c0                	test   %eax,%eax
+  802252:	0f 88 23 01 00 00    	js     80237b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802258:	83 ec 04             	sub    $0x4,%esp
+  80225b:	68 07 04 00 00       	push   $0x407
+  802260:	ff 75 f4             	push   -0xc(%ebp)
+  802263:	6a 00                	push   $0x0
+  802265:	e8 77 ec ff ff       	call   800ee1 <sys_page_alloc>
+  80226a:	89 c3                	mov    %eax,%ebx
+  80226c:	83 c4 10             	add    $0x10,%esp
+  80226f:	85 c0                	test   %eax,%eax
+  802271:	0f 88 04 01 00 00    	js     80237b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802277:	83 ec 0c             	sub    $0xc,%esp
+  80227a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80227d:	50                   	push   %eax
+  80227e:	e8 aa f0 ff ff       	call   80132d <fd_alloc>
+  802283:	89 c3                	mov    %eax,%ebx
+  802285:	83 c4 10             	add    $0x10,%esp
+  802288:	85 c0                	test   %eax,%eax
+  80228a:	0f 88 db 00 00 00    	js     80236b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802290:	83 ec 04             	sub    $0x4,%esp
+  802293:	68 07 04 00 00       	push   $0x407
+  802298:	ff 75 f0             	push   -0x10(%ebp)
+  80229b:	6a 00                	push   $0x0
+  80229d:	e8 3f ec ff ff       	call   800ee1 <sys_page_alloc>
+  8022a2:	89 c3                	mov    %eax,%ebx
+  8022a4:	83 c4 10             	add    $0x10,%esp
+  8022a7:	85 c0                	test   %eax,%eax
+  8022a9:	0f 88 bc 00 00 00    	js     80236b <pipe+0x131>
+	va = fd2data(fd0);
+  8022af:	83 ec 0c             	sub    $0xc,%esp
+  8022b2:	ff 75 f4             	push   -0xc(%ebp)
+  8022b5:	e8 5c f0 ff ff       	call   801316 <fd2data>
+  8022ba:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022bc:	83 c4 0c             	add    $0xc,%esp
+  8022bf:	68 07 04 00 00       	push   $0x407
+  8022c4:	50                   	push   %eax
+  8022c5:	6a 00                	push   $0x0
+  8022c7:	e8 15 ec ff ff       	call   800ee1 <sys_page_alloc>
+  8022cc:	89 c3                	mov    %eax,%ebx
+  8022ce:	83 c4 10             	add    $0x10,%esp
+  8022d1:	85 c0                	test   %eax,%eax
+  8022d3:	0f 88 82 00 00 00    	js     80235b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022d9:	83 ec 0c             	sub    $0xc,%esp
+  8022dc:	ff 75 f0             	push   -0x10(%ebp)
+  8022df:	e8 32 f0 ff ff       	call   801316 <fd2data>
+  8022e4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8022eb:	50                   	push   %eax
+  8022ec:	6a 00                	push   $0x0
+  8022ee:	56                   	push   %esi
+  8022ef:	6a 00                	push   $0x0
+  8022f1:	e8 71 ec ff ff       	call   800f67 <sys_page_map>
+  8022f6:	89 c3                	mov    %eax,%ebx
+  8022f8:	83 c4 20             	add    $0x20,%esp
+  8022fb:	85 c0                	test   %eax,%eax
+  8022fd:	78 4e                	js     80234d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8022ff:	a1 58 30 80 00       	mov    0x803058,%eax
+  802304:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802307:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802309:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80230c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802313:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802316:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802318:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80231b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802322:	83 ec 0c             	sub    $0xc,%esp
+  802325:	ff 75 f4             	push   -0xc(%ebp)
+  802328:	e8 d9 ef ff ff       	call   801306 <fd2num>
+  80232d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802330:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802332:	83 c4 04             	add    $0x4,%esp
+  802335:	ff 75 f0             	push   -0x10(%ebp)
+  802338:	e8 c9 ef ff ff       	call   801306 <fd2num>
+  80233d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802340:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802343:	83 c4 10             	add    $0x10,%esp
+  802346:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80234b:	eb 2e                	jmp    80237b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80234d:	83 ec 08             	sub    $0x8,%esp
+  802350:	56                   	push   %esi
+  802351:	6a 00                	push   $0x0
+  802353:	e8 51 ec ff ff       	call   800fa9 <sys_page_unmap>
+  802358:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80235b:	83 ec 08             	sub    $0x8,%esp
+  80235e:	ff 75 f0             	push   -0x10(%ebp)
+  802361:	6a 00                	push   $0x0
+  802363:	e8 41 ec ff ff       	call   800fa9 <sys_page_unmap>
+  802368:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80236b:	83 ec 08             	sub    $0x8,%esp
+  80236e:	ff 75 f4             	push   -0xc(%ebp)
+  802371:	6a 00                	push   $0x0
+  802373:	e8 31 ec ff ff       	call   800fa9 <sys_page_unmap>
+  802378:	83 c4 10             	add    $0x10,%esp
+}
+  80237b:	89 d8                	mov    %ebx,%eax
+  80237d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802380:	5b                   	pop    %ebx
+  802381:	5e                   	pop    %esi
+  802382:	5d                   	pop    %ebp
+  802383:	c3                   	ret
+
+00802384 <pipeisclosed>:
+{
+  802384:	55                   	push   %ebp
+  802385:	89 e5                	mov    %esp,%ebp
+  802387:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80238a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80238d:	50                   	push   %eax
+  80238e:	ff 75 08             	push   0x8(%ebp)
+  802391:	e8 ed ef ff ff       	call   801383 <fd_lookup>
+  802396:	83 c4 10             	add    $0x10,%esp
+  802399:	85 c0                	test   %eax,%eax
+  80239b:	78 18                	js     8023b5 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80239d:	83 ec 0c             	sub    $0xc,%esp
+  8023a0:	ff 75 f4             	push   -0xc(%ebp)
+  8023a3:	e8 6e ef ff ff       	call   801316 <fd2data>
+  8023a8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023ad:	e8 33 fd ff ff       	call   8020e5 <_pipeisclosed>
+  8023b2:	83 c4 10             	add    $0x10,%esp
+}
+  8023b5:	c9                   	leave
+  8023b6:	c3                   	ret
+
+008023b7 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8023b7:	55                   	push   %ebp
+  8023b8:	89 e5                	mov    %esp,%ebp
+  8023ba:	57                   	push   %edi
+  8023bb:	56                   	push   %esi
+  8023bc:	53                   	push   %ebx
+  8023bd:	83 ec 18             	sub    $0x18,%esp
+  8023c0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8023c6:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8023c9:	85 db                	test   %ebx,%ebx
+  8023cb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023d0:	0f 45 c3             	cmovne %ebx,%eax
+  8023d3:	50                   	push   %eax
+  8023d4:	e8 8b ee ff ff       	call   801264 <sys_ipc_recv>
+
+	if (from_env_store)
+  8023d9:	83 c4 10             	add    $0x10,%esp
+  8023dc:	85 ff                	test   %edi,%edi
+  8023de:	74 17                	je     8023f7 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8023e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e5:	85 c0                	test   %eax,%eax
+  8023e7:	75 0c                	jne    8023f5 <ipc_recv+0x3e>
+  8023e9:	8b 15 08 44 80 00    	mov    0x804408,%edx
+  8023ef:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8023f5:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8023f7:	85 f6                	test   %esi,%esi
+  8023f9:	74 2e                	je     802429 <ipc_recv+0x72>
+		if (!r && pg)
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	75 24                	jne    802423 <ipc_recv+0x6c>
+  8023ff:	85 db                	test   %ebx,%ebx
+  802401:	74 20                	je     802423 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802403:	a1 08 44 80 00       	mov    0x804408,%eax
+  802408:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  80240e:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802410:	a1 08 44 80 00       	mov    0x804408,%eax
+  802415:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80241b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80241e:	5b                   	pop    %ebx
+  80241f:	5e                   	pop    %esi
+  802420:	5f                   	pop    %edi
+  802421:	5d                   	pop    %ebp
+  802422:	c3                   	ret
+			*perm_store = 0;
+  802423:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802429:	85 c0                	test   %eax,%eax
+  80242b:	75 ee                	jne    80241b <ipc_recv+0x64>
+  80242d:	eb e1                	jmp    802410 <ipc_recv+0x59>
+
+0080242f <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80242f:	55                   	push   %ebp
+  802430:	89 e5                	mov    %esp,%ebp
+  802432:	57                   	push   %edi
+  802433:	56                   	push   %esi
+  802434:	53                   	push   %ebx
+  802435:	83 ec 0c             	sub    $0xc,%esp
+  802438:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80243b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80243e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802441:	85 db                	test   %ebx,%ebx
+  802443:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802448:	0f 44 d8             	cmove  %eax,%ebx
+  80244b:	ff 75 14             	push   0x14(%ebp)
+  80244e:	53                   	push   %ebx
+  80244f:	56                   	push   %esi
+  802450:	57                   	push   %edi
+  802451:	e8 eb ed ff ff       	call   801241 <sys_ipc_try_send_yield>
+  802456:	83 c4 10             	add    $0x10,%esp
+  802459:	85 c0                	test   %eax,%eax
+  80245b:	79 1e                	jns    80247b <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80245d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802460:	75 07                	jne    802469 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802462:	e8 fa e9 ff ff       	call   800e61 <sys_yield>
+  802467:	eb e2                	jmp    80244b <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802469:	50                   	push   %eax
+  80246a:	68 17 2e 80 00       	push   $0x802e17
+  80246f:	6a 3d                	push   $0x3d
+  802471:	68 2c 2e 80 00       	push   $0x802e2c
+  802476:	e8 40 de ff ff       	call   8002bb <_panic>
+	}
+}
+  80247b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80247e:	5b                   	pop    %ebx
+  80247f:	5e                   	pop    %esi
+  802480:	5f                   	pop    %edi
+  802481:	5d                   	pop    %ebp
+  802482:	c3                   	ret
+
+00802483 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802483:	55                   	push   %ebp
+  802484:	89 e5                	mov    %esp,%ebp
+  802486:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802489:	ff 75 08             	push   0x8(%ebp)
+  80248c:	e8 50 e9 ff ff       	call   800de1 <sys_env_find>
+}
+  802491:	c9                   	leave
+  802492:	c3                   	ret
+
+00802493 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802493:	55                   	push   %ebp
+  802494:	89 e5                	mov    %esp,%ebp
+  802496:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802499:	89 c2                	mov    %eax,%edx
+  80249b:	c1 ea 16             	shr    $0x16,%edx
+  80249e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8024a5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024aa:	f6 c1 01             	test   $0x1,%cl
+  8024ad:	74 22                	je     8024d1 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8024af:	c1 e8 0c             	shr    $0xc,%eax
+  8024b2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8024b9:	a8 01                	test   $0x1,%al
+  8024bb:	74 14                	je     8024d1 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8024bd:	c1 e8 0c             	shr    $0xc,%eax
+  8024c0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8024c3:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8024ca:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8024ce:	0f b7 d2             	movzwl %dx,%edx
+}
+  8024d1:	89 d0                	mov    %edx,%eax
+  8024d3:	5d                   	pop    %ebp
+  8024d4:	c3                   	ret
+  8024d5:	66 90                	xchg   %ax,%ax
+  8024d7:	66 90                	xchg   %ax,%ax
+  8024d9:	66 90                	xchg   %ax,%ax
+  8024db:	66 90                	xchg   %ax,%ax
+  8024dd:	66 90                	xchg   %ax,%ax
+  8024df:	90                   	nop
+
+008024e0 <__udivmoddi4>:
+  8024e0:	55                   	push   %ebp
+  8024e1:	57                   	push   %edi
+  8024e2:	56                   	push   %esi
+  8024e3:	53                   	push   %ebx
+  8024e4:	83 ec 14             	sub    $0x14,%esp
+  8024e7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8024eb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8024ef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8024f3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8024f7:	89 f1                	mov    %esi,%ecx
+  8024f9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8024fd:	09 d9                	or     %ebx,%ecx
+  8024ff:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802503:	0f 84 92 00 00 00    	je     80259b <__udivmoddi4+0xbb>
+  802509:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802510:	00 
+  802511:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802516:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80251d:	00 
+  80251e:	89 1c 24             	mov    %ebx,(%esp)
+  802521:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802525:	8d 76 00             	lea    0x0(%esi),%esi
+  802528:	89 e9                	mov    %ebp,%ecx
+  80252a:	89 c3                	mov    %eax,%ebx
+  80252c:	89 d6                	mov    %edx,%esi
+  80252e:	31 ff                	xor    %edi,%edi
+  802530:	d3 ee                	shr    %cl,%esi
+  802532:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802535:	f6 c1 20             	test   $0x20,%cl
+  802538:	0f 45 de             	cmovne %esi,%ebx
+  80253b:	0f 45 f7             	cmovne %edi,%esi
+  80253e:	8b 3c 24             	mov    (%esp),%edi
+  802541:	39 fb                	cmp    %edi,%ebx
+  802543:	89 f7                	mov    %esi,%edi
+  802545:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802549:	8b 1c 24             	mov    (%esp),%ebx
+  80254c:	19 f7                	sbb    %esi,%edi
+  80254e:	72 39                	jb     802589 <__udivmoddi4+0xa9>
+  802550:	89 e9                	mov    %ebp,%ecx
+  802552:	89 f7                	mov    %esi,%edi
+  802554:	89 de                	mov    %ebx,%esi
+  802556:	0f a5 df             	shld   %cl,%ebx,%edi
+  802559:	d3 e6                	shl    %cl,%esi
+  80255b:	31 db                	xor    %ebx,%ebx
+  80255d:	f6 c1 20             	test   $0x20,%cl
+  802560:	0f 45 fe             	cmovne %esi,%edi
+  802563:	0f 45 f3             	cmovne %ebx,%esi
+  802566:	29 f0                	sub    %esi,%eax
+  802568:	be 01 00 00 00       	mov    $0x1,%esi
+  80256d:	19 fa                	sbb    %edi,%edx
+  80256f:	31 ff                	xor    %edi,%edi
+  802571:	31 db                	xor    %ebx,%ebx
+  802573:	0f a5 f7             	shld   %cl,%esi,%edi
+  802576:	d3 e6                	shl    %cl,%esi
+  802578:	f6 c1 20             	test   $0x20,%cl
+  80257b:	0f 45 fe             	cmovne %esi,%edi
+  80257e:	0f 45 f3             	cmovne %ebx,%esi
+  802581:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802585:	09 74 24 08          	or     %esi,0x8(%esp)
+  802589:	83 ed 01             	sub    $0x1,%ebp
+  80258c:	73 9a                	jae    802528 <__udivmoddi4+0x48>
+  80258e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802592:	85 ff                	test   %edi,%edi
+  802594:	74 05                	je     80259b <__udivmoddi4+0xbb>
+  802596:	89 07                	mov    %eax,(%edi)
+  802598:	89 57 04             	mov    %edx,0x4(%edi)
+  80259b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80259f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025a3:	83 c4 14             	add    $0x14,%esp
+  8025a6:	5b                   	pop    %ebx
+  8025a7:	5e                   	pop    %esi
+  8025a8:	5f                   	pop    %edi
+  8025a9:	5d                   	pop    %ebp
+  8025aa:	c3                   	ret
+  8025ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8025af:	90                   	nop
+
+008025b0 <__udivdi3>:
+  8025b0:	55                   	push   %ebp
+  8025b1:	57                   	push   %edi
+  8025b2:	56                   	push   %esi
+  8025b3:	53                   	push   %ebx
+  8025b4:	83 ec 14             	sub    $0x14,%esp
+  8025b7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8025bb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025bf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025c3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025c7:	89 fb                	mov    %edi,%ebx
+  8025c9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8025cd:	09 f3                	or     %esi,%ebx
+  8025cf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8025d3:	0f 84 85 00 00 00    	je     80265e <__udivdi3+0xae>
+  8025d9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8025e0:	00 
+  8025e1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8025e6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8025ed:	00 
+  8025ee:	89 34 24             	mov    %esi,(%esp)
+  8025f1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8025f5:	8d 76 00             	lea    0x0(%esi),%esi
+  8025f8:	89 e9                	mov    %ebp,%ecx
+  8025fa:	89 c3                	mov    %eax,%ebx
+  8025fc:	89 d6                	mov    %edx,%esi
+  8025fe:	31 ff                	xor    %edi,%edi
+  802600:	d3 ee                	shr    %cl,%esi
+  802602:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802605:	f6 c1 20             	test   $0x20,%cl
+  802608:	0f 45 de             	cmovne %esi,%ebx
+  80260b:	0f 45 f7             	cmovne %edi,%esi
+  80260e:	8b 3c 24             	mov    (%esp),%edi
+  802611:	39 fb                	cmp    %edi,%ebx
+  802613:	89 f7                	mov    %esi,%edi
+  802615:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802619:	8b 1c 24             	mov    (%esp),%ebx
+  80261c:	19 f7                	sbb    %esi,%edi
+  80261e:	72 39                	jb     802659 <__udivdi3+0xa9>
+  802620:	89 e9                	mov    %ebp,%ecx
+  802622:	89 f7                	mov    %esi,%edi
+  802624:	89 de                	mov    %ebx,%esi
+  802626:	0f a5 df             	shld   %cl,%ebx,%edi
+  802629:	d3 e6                	shl    %cl,%esi
+  80262b:	31 db                	xor    %ebx,%ebx
+  80262d:	f6 c1 20             	test   $0x20,%cl
+  802630:	0f 45 fe             	cmovne %esi,%edi
+  802633:	0f 45 f3             	cmovne %ebx,%esi
+  802636:	29 f0                	sub    %esi,%eax
+  802638:	be 01 00 00 00       	mov    $0x1,%esi
+  80263d:	19 fa                	sbb    %edi,%edx
+  80263f:	31 ff                	xor    %edi,%edi
+  802641:	31 db                	xor    %ebx,%ebx
+  802643:	0f a5 f7             	shld   %cl,%esi,%edi
+  802646:	d3 e6                	shl    %cl,%esi
+  802648:	f6 c1 20             	test   $0x20,%cl
+  80264b:	0f 45 fe             	cmovne %esi,%edi
+  80264e:	0f 45 f3             	cmovne %ebx,%esi
+  802651:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802655:	09 74 24 08          	or     %esi,0x8(%esp)
+  802659:	83 ed 01             	sub    $0x1,%ebp
+  80265c:	73 9a                	jae    8025f8 <__udivdi3+0x48>
+  80265e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802662:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802666:	83 c4 14             	add    $0x14,%esp
+  802669:	5b                   	pop    %ebx
+  80266a:	5e                   	pop    %esi
+  80266b:	5f                   	pop    %edi
+  80266c:	5d                   	pop    %ebp
+  80266d:	c3                   	ret
+  80266e:	66 90                	xchg   %ax,%ax
+
+00802670 <__umoddi3>:
+  802670:	57                   	push   %edi
+  802671:	56                   	push   %esi
+  802672:	53                   	push   %ebx
+  802673:	83 ec 08             	sub    $0x8,%esp
+  802676:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80267a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80267e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802682:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802686:	89 f9                	mov    %edi,%ecx
+  802688:	89 34 24             	mov    %esi,(%esp)
+  80268b:	09 f1                	or     %esi,%ecx
+  80268d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802691:	74 53                	je     8026e6 <__umoddi3+0x76>
+  802693:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80269f:	90                   	nop
+  8026a0:	89 c6                	mov    %eax,%esi
+  8026a2:	89 d7                	mov    %edx,%edi
+  8026a4:	31 db                	xor    %ebx,%ebx
+  8026a6:	d3 ef                	shr    %cl,%edi
+  8026a8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8026ab:	f6 c1 20             	test   $0x20,%cl
+  8026ae:	0f 45 f7             	cmovne %edi,%esi
+  8026b1:	0f 45 fb             	cmovne %ebx,%edi
+  8026b4:	8b 1c 24             	mov    (%esp),%ebx
+  8026b7:	39 de                	cmp    %ebx,%esi
+  8026b9:	89 fb                	mov    %edi,%ebx
+  8026bb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8026bf:	8b 34 24             	mov    (%esp),%esi
+  8026c2:	19 fb                	sbb    %edi,%ebx
+  8026c4:	72 14                	jb     8026da <__umoddi3+0x6a>
+  8026c6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8026c9:	31 db                	xor    %ebx,%ebx
+  8026cb:	d3 e6                	shl    %cl,%esi
+  8026cd:	f6 c1 20             	test   $0x20,%cl
+  8026d0:	0f 45 fe             	cmovne %esi,%edi
+  8026d3:	0f 45 f3             	cmovne %ebx,%esi
+  8026d6:	29 f0                	sub    %esi,%eax
+  8026d8:	19 fa                	sbb    %edi,%edx
+  8026da:	83 e9 01             	sub    $0x1,%ecx
+  8026dd:	73 c1                	jae    8026a0 <__umoddi3+0x30>
+  8026df:	83 c4 08             	add    $0x8,%esp
+  8026e2:	5b                   	pop    %ebx
+  8026e3:	5e                   	pop    %esi
+  8026e4:	5f                   	pop    %edi
+  8026e5:	c3                   	ret
+  8026e6:	83 c4 08             	add    $0x8,%esp
+  8026e9:	31 c0                	xor    %eax,%eax
+  8026eb:	31 d2                	xor    %edx,%edx
+  8026ed:	5b                   	pop    %ebx
+  8026ee:	5e                   	pop    %esi
+  8026ef:	5f                   	pop    %edi
+  8026f0:	c3                   	ret
+  8026f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026ff:	90                   	nop
+
+00802700 <__divdi3>:
+  802700:	55                   	push   %ebp
+  802701:	57                   	push   %edi
+  802702:	56                   	push   %esi
+  802703:	53                   	push   %ebx
+  802704:	83 ec 1c             	sub    $0x1c,%esp
+  802707:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80270b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80270f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802713:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802717:	85 ff                	test   %edi,%edi
+  802719:	0f 88 da 00 00 00    	js     8027f9 <__divdi3+0xf9>
+  80271f:	85 db                	test   %ebx,%ebx
+  802721:	78 16                	js     802739 <__divdi3+0x39>
+  802723:	89 dd                	mov    %ebx,%ebp
+  802725:	89 c8                	mov    %ecx,%eax
+  802727:	89 da                	mov    %ebx,%edx
+  802729:	09 cd                	or     %ecx,%ebp
+  80272b:	0f 85 fd 00 00 00    	jne    80282e <__divdi3+0x12e>
+  802731:	83 c4 1c             	add    $0x1c,%esp
+  802734:	5b                   	pop    %ebx
+  802735:	5e                   	pop    %esi
+  802736:	5f                   	pop    %edi
+  802737:	5d                   	pop    %ebp
+  802738:	c3                   	ret
+  802739:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80273e:	f7 d9                	neg    %ecx
+  802740:	89 f0                	mov    %esi,%eax
+  802742:	89 fa                	mov    %edi,%edx
+  802744:	83 d3 00             	adc    $0x0,%ebx
+  802747:	89 0c 24             	mov    %ecx,(%esp)
+  80274a:	f7 db                	neg    %ebx
+  80274c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802750:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802757:	00 
+  802758:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80275d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802764:	00 
+  802765:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802769:	89 cd                	mov    %ecx,%ebp
+  80276b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80276f:	90                   	nop
+  802770:	89 e9                	mov    %ebp,%ecx
+  802772:	89 c3                	mov    %eax,%ebx
+  802774:	89 d6                	mov    %edx,%esi
+  802776:	31 ff                	xor    %edi,%edi
+  802778:	d3 ee                	shr    %cl,%esi
+  80277a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80277d:	f6 c1 20             	test   $0x20,%cl
+  802780:	0f 45 de             	cmovne %esi,%ebx
+  802783:	0f 45 f7             	cmovne %edi,%esi
+  802786:	8b 3c 24             	mov    (%esp),%edi
+  802789:	39 fb                	cmp    %edi,%ebx
+  80278b:	89 f7                	mov    %esi,%edi
+  80278d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802791:	8b 1c 24             	mov    (%esp),%ebx
+  802794:	19 f7                	sbb    %esi,%edi
+  802796:	72 39                	jb     8027d1 <__divdi3+0xd1>
+  802798:	89 e9                	mov    %ebp,%ecx
+  80279a:	89 f7                	mov    %esi,%edi
+  80279c:	89 de                	mov    %ebx,%esi
+  80279e:	0f a5 df             	shld   %cl,%ebx,%edi
+  8027a1:	d3 e6                	shl    %cl,%esi
+  8027a3:	31 db                	xor    %ebx,%ebx
+  8027a5:	f6 c1 20             	test   $0x20,%cl
+  8027a8:	0f 45 fe             	cmovne %esi,%edi
+  8027ab:	0f 45 f3             	cmovne %ebx,%esi
+  8027ae:	29 f0                	sub    %esi,%eax
+  8027b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8027b5:	19 fa                	sbb    %edi,%edx
+  8027b7:	31 ff                	xor    %edi,%edi
+  8027b9:	31 db                	xor    %ebx,%ebx
+  8027bb:	0f a5 f7             	shld   %cl,%esi,%edi
+  8027be:	d3 e6                	shl    %cl,%esi
+  8027c0:	f6 c1 20             	test   $0x20,%cl
+  8027c3:	0f 45 fe             	cmovne %esi,%edi
+  8027c6:	0f 45 f3             	cmovne %ebx,%esi
+  8027c9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8027cd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8027d1:	83 ed 01             	sub    $0x1,%ebp
+  8027d4:	73 9a                	jae    802770 <__divdi3+0x70>
+  8027d6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8027da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027e2:	85 ed                	test   %ebp,%ebp
+  8027e4:	0f 84 47 ff ff ff    	je     802731 <__divdi3+0x31>
+  8027ea:	f7 d8                	neg    %eax
+  8027ec:	83 d2 00             	adc    $0x0,%edx
+  8027ef:	83 c4 1c             	add    $0x1c,%esp
+  8027f2:	5b                   	pop    %ebx
+  8027f3:	f7 da                	neg    %edx
+  8027f5:	5e                   	pop    %esi
+  8027f6:	5f                   	pop    %edi
+  8027f7:	5d                   	pop    %ebp
+  8027f8:	c3                   	ret
+  8027f9:	f7 de                	neg    %esi
+  8027fb:	83 d7 00             	adc    $0x0,%edi
+  8027fe:	f7 df                	neg    %edi
+  802800:	85 db                	test   %ebx,%ebx
+  802802:	78 23                	js     802827 <__divdi3+0x127>
+  802804:	89 dd                	mov    %ebx,%ebp
+  802806:	89 c8                	mov    %ecx,%eax
+  802808:	89 da                	mov    %ebx,%edx
+  80280a:	09 cd                	or     %ecx,%ebp
+  80280c:	0f 84 1f ff ff ff    	je     802731 <__divdi3+0x31>
+  802812:	89 0c 24             	mov    %ecx,(%esp)
+  802815:	89 f0                	mov    %esi,%eax
+  802817:	89 fa                	mov    %edi,%edx
+  802819:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80281e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802822:	e9 29 ff ff ff       	jmp    802750 <__divdi3+0x50>
+  802827:	31 ed                	xor    %ebp,%ebp
+  802829:	e9 10 ff ff ff       	jmp    80273e <__divdi3+0x3e>
+  80282e:	89 0c 24             	mov    %ecx,(%esp)
+  802831:	89 f0                	mov    %esi,%eax
+  802833:	89 fa                	mov    %edi,%edx
+  802835:	31 ed                	xor    %ebp,%ebp
+  802837:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80283b:	e9 10 ff ff ff       	jmp    802750 <__divdi3+0x50>
+
+00802840 <__moddi3>:
+  802840:	55                   	push   %ebp
+  802841:	57                   	push   %edi
+  802842:	56                   	push   %esi
+  802843:	53                   	push   %ebx
+  802844:	83 ec 14             	sub    $0x14,%esp
+  802847:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80284b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80284f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802853:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802857:	85 d2                	test   %edx,%edx
+  802859:	0f 88 9b 00 00 00    	js     8028fa <__moddi3+0xba>
+  80285f:	89 f7                	mov    %esi,%edi
+  802861:	31 ed                	xor    %ebp,%ebp
+  802863:	09 cf                	or     %ecx,%edi
+  802865:	0f 84 83 00 00 00    	je     8028ee <__moddi3+0xae>
+  80286b:	89 cb                	mov    %ecx,%ebx
+  80286d:	89 f7                	mov    %esi,%edi
+  80286f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802873:	f7 db                	neg    %ebx
+  802875:	83 d7 00             	adc    $0x0,%edi
+  802878:	f7 df                	neg    %edi
+  80287a:	0f 49 f7             	cmovns %edi,%esi
+  80287d:	0f 49 cb             	cmovns %ebx,%ecx
+  802880:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802884:	89 0c 24             	mov    %ecx,(%esp)
+  802887:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80288c:	89 cd                	mov    %ecx,%ebp
+  80288e:	66 90                	xchg   %ax,%ax
+  802890:	89 e9                	mov    %ebp,%ecx
+  802892:	89 c3                	mov    %eax,%ebx
+  802894:	89 d6                	mov    %edx,%esi
+  802896:	31 ff                	xor    %edi,%edi
+  802898:	d3 ee                	shr    %cl,%esi
+  80289a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80289d:	f6 c1 20             	test   $0x20,%cl
+  8028a0:	0f 45 de             	cmovne %esi,%ebx
+  8028a3:	0f 45 f7             	cmovne %edi,%esi
+  8028a6:	8b 3c 24             	mov    (%esp),%edi
+  8028a9:	39 fb                	cmp    %edi,%ebx
+  8028ab:	89 f7                	mov    %esi,%edi
+  8028ad:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8028b1:	8b 1c 24             	mov    (%esp),%ebx
+  8028b4:	19 f7                	sbb    %esi,%edi
+  8028b6:	72 1a                	jb     8028d2 <__moddi3+0x92>
+  8028b8:	89 e9                	mov    %ebp,%ecx
+  8028ba:	89 f7                	mov    %esi,%edi
+  8028bc:	89 de                	mov    %ebx,%esi
+  8028be:	0f a5 df             	shld   %cl,%ebx,%edi
+  8028c1:	d3 e6                	shl    %cl,%esi
+  8028c3:	31 db                	xor    %ebx,%ebx
+  8028c5:	f6 c1 20             	test   $0x20,%cl
+  8028c8:	0f 45 fe             	cmovne %esi,%edi
+  8028cb:	0f 45 f3             	cmovne %ebx,%esi
+  8028ce:	29 f0                	sub    %esi,%eax
+  8028d0:	19 fa                	sbb    %edi,%edx
+  8028d2:	83 ed 01             	sub    $0x1,%ebp
+  8028d5:	73 b9                	jae    802890 <__moddi3+0x50>
+  8028d7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  8028db:	85 ed                	test   %ebp,%ebp
+  8028dd:	74 07                	je     8028e6 <__moddi3+0xa6>
+  8028df:	f7 d8                	neg    %eax
+  8028e1:	83 d2 00             	adc    $0x0,%edx
+  8028e4:	f7 da                	neg    %edx
+  8028e6:	83 c4 14             	add    $0x14,%esp
+  8028e9:	5b                   	pop    %ebx
+  8028ea:	5e                   	pop    %esi
+  8028eb:	5f                   	pop    %edi
+  8028ec:	5d                   	pop    %ebp
+  8028ed:	c3                   	ret
+  8028ee:	83 c4 14             	add    $0x14,%esp
+  8028f1:	31 c0                	xor    %eax,%eax
+  8028f3:	31 d2                	xor    %edx,%edx
+  8028f5:	5b                   	pop    %ebx
+  8028f6:	5e                   	pop    %esi
+  8028f7:	5f                   	pop    %edi
+  8028f8:	5d                   	pop    %ebp
+  8028f9:	c3                   	ret
+  8028fa:	89 f7                	mov    %esi,%edi
+  8028fc:	09 cf                	or     %ecx,%edi
+  8028fe:	74 11                	je     802911 <__moddi3+0xd1>
+  802900:	f7 d8                	neg    %eax
+  802902:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802907:	83 d2 00             	adc    $0x0,%edx
+  80290a:	f7 da                	neg    %edx
+  80290c:	e9 5a ff ff ff       	jmp    80286b <__moddi3+0x2b>
+  802911:	31 c0                	xor    %eax,%eax
+  802913:	31 d2                	xor    %edx,%edx
+  802915:	eb c8                	jmp    8028df <__moddi3+0x9f>
@@ -0,0 +1,6354 @@
+
+obj/user/testpipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a1 02 00 00       	call   8002d2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 7c             	sub    $0x7c,%esp
+	char buf[100];
+	int i, pid, p[2];
+
+	binaryname = "pipereadeof";
+  80003b:	c7 05 04 40 80 00 40 	movl   $0x802d40,0x804004
+  800042:	2d 80 00 
+
+	if ((i = pipe(p)) < 0)
+  800045:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800048:	50                   	push   %eax
+  800049:	e8 c1 23 00 00       	call   80240f <pipe>
+  80004e:	89 c6                	mov    %eax,%esi
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 1b 01 00 00    	js     800176 <umain+0x143>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  80005b:	e8 08 13 00 00       	call   801368 <fork>
+  800060:	89 c3                	mov    %eax,%ebx
+  800062:	85 c0                	test   %eax,%eax
+  800064:	0f 88 1e 01 00 00    	js     800188 <umain+0x155>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  80006a:	0f 85 56 01 00 00    	jne    8001c6 <umain+0x193>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800070:	a1 08 50 80 00       	mov    0x805008,%eax
+  800075:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	ff 75 90             	push   -0x70(%ebp)
+  80007e:	50                   	push   %eax
+  80007f:	68 65 2d 80 00       	push   $0x802d65
+  800084:	e8 84 03 00 00       	call   80040d <cprintf>
+		close(p[1]);
+  800089:	83 c4 04             	add    $0x4,%esp
+  80008c:	ff 75 90             	push   -0x70(%ebp)
+  80008f:	e8 02 17 00 00       	call   801796 <close>
+		cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  800094:	a1 08 50 80 00       	mov    0x805008,%eax
+  800099:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80009c:	83 c4 0c             	add    $0xc,%esp
+  80009f:	ff 75 8c             	push   -0x74(%ebp)
+  8000a2:	50                   	push   %eax
+  8000a3:	68 82 2d 80 00       	push   $0x802d82
+  8000a8:	e8 60 03 00 00       	call   80040d <cprintf>
+		i = readn(p[0], buf, sizeof buf-1);
+  8000ad:	83 c4 0c             	add    $0xc,%esp
+  8000b0:	6a 63                	push   $0x63
+  8000b2:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000b5:	50                   	push   %eax
+  8000b6:	ff 75 8c             	push   -0x74(%ebp)
+  8000b9:	e8 9b 18 00 00       	call   801959 <readn>
+  8000be:	89 c6                	mov    %eax,%esi
+		if (i < 0)
+  8000c0:	83 c4 10             	add    $0x10,%esp
+  8000c3:	85 c0                	test   %eax,%eax
+  8000c5:	0f 88 cf 00 00 00    	js     80019a <umain+0x167>
+			panic("read: %e", i);
+		buf[i] = 0;
+  8000cb:	c6 44 05 94 00       	movb   $0x0,-0x6c(%ebp,%eax,1)
+		if (strcmp(buf, msg) == 0)
+  8000d0:	83 ec 08             	sub    $0x8,%esp
+  8000d3:	ff 35 00 40 80 00    	push   0x804000
+  8000d9:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000dc:	50                   	push   %eax
+  8000dd:	e8 ca 09 00 00       	call   800aac <strcmp>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	85 c0                	test   %eax,%eax
+  8000e7:	0f 85 bf 00 00 00    	jne    8001ac <umain+0x179>
+			cprintf("\npipe read closed properly\n");
+  8000ed:	83 ec 0c             	sub    $0xc,%esp
+  8000f0:	68 a8 2d 80 00       	push   $0x802da8
+  8000f5:	e8 13 03 00 00       	call   80040d <cprintf>
+  8000fa:	83 c4 10             	add    $0x10,%esp
+		else
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+		exit();
+  8000fd:	e8 16 02 00 00       	call   800318 <exit>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+			panic("write: %e", i);
+		close(p[1]);
+	}
+	wait(pid);
+  800102:	83 ec 0c             	sub    $0xc,%esp
+  800105:	53                   	push   %ebx
+  800106:	e8 81 24 00 00       	call   80258c <wait>
+
+	binaryname = "pipewriteeof";
+  80010b:	c7 05 04 40 80 00 fe 	movl   $0x802dfe,0x804004
+  800112:	2d 80 00 
+	if ((i = pipe(p)) < 0)
+  800115:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800118:	89 04 24             	mov    %eax,(%esp)
+  80011b:	e8 ef 22 00 00       	call   80240f <pipe>
+  800120:	89 c6                	mov    %eax,%esi
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 32 01 00 00    	js     80025f <umain+0x22c>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  80012d:	e8 36 12 00 00       	call   801368 <fork>
+  800132:	89 c3                	mov    %eax,%ebx
+  800134:	85 c0                	test   %eax,%eax
+  800136:	0f 88 35 01 00 00    	js     800271 <umain+0x23e>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  80013c:	0f 84 41 01 00 00    	je     800283 <umain+0x250>
+				break;
+		}
+		cprintf("\npipe write closed properly\n");
+		exit();
+	}
+	close(p[0]);
+  800142:	83 ec 0c             	sub    $0xc,%esp
+  800145:	ff 75 8c             	push   -0x74(%ebp)
+  800148:	e8 49 16 00 00       	call   801796 <close>
+	close(p[1]);
+  80014d:	83 c4 04             	add    $0x4,%esp
+  800150:	ff 75 90             	push   -0x70(%ebp)
+  800153:	e8 3e 16 00 00       	call   801796 <close>
+	wait(pid);
+  800158:	89 1c 24             	mov    %ebx,(%esp)
+  80015b:	e8 2c 24 00 00       	call   80258c <wait>
+
+	cprintf("pipe tests passed\n");
+  800160:	c7 04 24 2a 2e 80 00 	movl   $0x802e2a,(%esp)
+  800167:	e8 a1 02 00 00       	call   80040d <cprintf>
+}
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800172:	5b                   	pop    %ebx
+  800173:	5e                   	pop    %esi
+  800174:	5d                   	pop    %ebp
+  800175:	c3                   	ret
+		panic("pipe: %e", i);
+  800176:	50                   	push   %eax
+  800177:	68 4c 2d 80 00       	push   $0x802d4c
+  80017c:	6a 0e                	push   $0xe
+  80017e:	68 55 2d 80 00       	push   $0x802d55
+  800183:	e8 aa 01 00 00       	call   800332 <_panic>
+		panic("fork: %e", i);
+  800188:	56                   	push   %esi
+  800189:	68 44 32 80 00       	push   $0x803244
+  80018e:	6a 11                	push   $0x11
+  800190:	68 55 2d 80 00       	push   $0x802d55
+  800195:	e8 98 01 00 00       	call   800332 <_panic>
+			panic("read: %e", i);
+  80019a:	50                   	push   %eax
+  80019b:	68 9f 2d 80 00       	push   $0x802d9f
+  8001a0:	6a 19                	push   $0x19
+  8001a2:	68 55 2d 80 00       	push   $0x802d55
+  8001a7:	e8 86 01 00 00       	call   800332 <_panic>
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+  8001ac:	83 ec 04             	sub    $0x4,%esp
+  8001af:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8001b2:	50                   	push   %eax
+  8001b3:	56                   	push   %esi
+  8001b4:	68 c4 2d 80 00       	push   $0x802dc4
+  8001b9:	e8 4f 02 00 00       	call   80040d <cprintf>
+  8001be:	83 c4 10             	add    $0x10,%esp
+  8001c1:	e9 37 ff ff ff       	jmp    8000fd <umain+0xca>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8001c6:	a1 08 50 80 00       	mov    0x805008,%eax
+  8001cb:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8001ce:	83 ec 04             	sub    $0x4,%esp
+  8001d1:	ff 75 8c             	push   -0x74(%ebp)
+  8001d4:	50                   	push   %eax
+  8001d5:	68 65 2d 80 00       	push   $0x802d65
+  8001da:	e8 2e 02 00 00       	call   80040d <cprintf>
+		close(p[0]);
+  8001df:	83 c4 04             	add    $0x4,%esp
+  8001e2:	ff 75 8c             	push   -0x74(%ebp)
+  8001e5:	e8 ac 15 00 00       	call   801796 <close>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  8001ea:	a1 08 50 80 00       	mov    0x805008,%eax
+  8001ef:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	ff 75 90             	push   -0x70(%ebp)
+  8001f8:	50                   	push   %eax
+  8001f9:	68 d7 2d 80 00       	push   $0x802dd7
+  8001fe:	e8 0a 02 00 00       	call   80040d <cprintf>
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  800203:	83 c4 04             	add    $0x4,%esp
+  800206:	ff 35 00 40 80 00    	push   0x804000
+  80020c:	e8 af 07 00 00       	call   8009c0 <strlen>
+  800211:	83 c4 0c             	add    $0xc,%esp
+  800214:	50                   	push   %eax
+  800215:	ff 35 00 40 80 00    	push   0x804000
+  80021b:	ff 75 90             	push   -0x70(%ebp)
+  80021e:	e8 7d 17 00 00       	call   8019a0 <write>
+  800223:	89 c6                	mov    %eax,%esi
+  800225:	83 c4 04             	add    $0x4,%esp
+  800228:	ff 35 00 40 80 00    	push   0x804000
+  80022e:	e8 8d 07 00 00       	call   8009c0 <strlen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	39 f0                	cmp    %esi,%eax
+  800238:	75 13                	jne    80024d <umain+0x21a>
+		close(p[1]);
+  80023a:	83 ec 0c             	sub    $0xc,%esp
+  80023d:	ff 75 90             	push   -0x70(%ebp)
+  800240:	e8 51 15 00 00       	call   801796 <close>
+  800245:	83 c4 10             	add    $0x10,%esp
+  800248:	e9 b5 fe ff ff       	jmp    800102 <umain+0xcf>
+			panic("write: %e", i);
+  80024d:	56                   	push   %esi
+  80024e:	68 f4 2d 80 00       	push   $0x802df4
+  800253:	6a 25                	push   $0x25
+  800255:	68 55 2d 80 00       	push   $0x802d55
+  80025a:	e8 d3 00 00 00       	call   800332 <_panic>
+		panic("pipe: %e", i);
+  80025f:	50                   	push   %eax
+  800260:	68 4c 2d 80 00       	push   $0x802d4c
+  800265:	6a 2c                	push   $0x2c
+  800267:	68 55 2d 80 00       	push   $0x802d55
+  80026c:	e8 c1 00 00 00       	call   800332 <_panic>
+		panic("fork: %e", i);
+  800271:	56                   	push   %esi
+  800272:	68 44 32 80 00       	push   $0x803244
+  800277:	6a 2f                	push   $0x2f
+  800279:	68 55 2d 80 00       	push   $0x802d55
+  80027e:	e8 af 00 00 00       	call   800332 <_panic>
+		close(p[0]);
+  800283:	83 ec 0c             	sub    $0xc,%esp
+  800286:	ff 75 8c             	push   -0x74(%ebp)
+  800289:	e8 08 15 00 00       	call   801796 <close>
+  80028e:	83 c4 10             	add    $0x10,%esp
+			cprintf(".");
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	68 0b 2e 80 00       	push   $0x802e0b
+  800299:	e8 6f 01 00 00       	call   80040d <cprintf>
+			if (write(p[1], "x", 1) != 1)
+  80029e:	83 c4 0c             	add    $0xc,%esp
+  8002a1:	6a 01                	push   $0x1
+  8002a3:	68 f9 31 80 00       	push   $0x8031f9
+  8002a8:	ff 75 90             	push   -0x70(%ebp)
+  8002ab:	e8 f0 16 00 00       	call   8019a0 <write>
+  8002b0:	83 c4 10             	add    $0x10,%esp
+  8002b3:	83 f8 01             	cmp    $0x1,%eax
+  8002b6:	74 d9                	je     800291 <umain+0x25e>
+		cprintf("\npipe write closed properly\n");
+  8002b8:	83 ec 0c             	sub    $0xc,%esp
+  8002bb:	68 0d 2e 80 00       	push   $0x802e0d
+  8002c0:	e8 48 01 00 00       	call   80040d <cprintf>
+		exit();
+  8002c5:	e8 4e 00 00 00       	call   800318 <exit>
+  8002ca:	83 c4 10             	add    $0x10,%esp
+  8002cd:	e9 70 fe ff ff       	jmp    800142 <umain+0x10f>
+
+008002d2 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	56                   	push   %esi
+  8002d6:	53                   	push   %ebx
+  8002d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002da:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8002dd:	e8 e7 0a 00 00       	call   800dc9 <sys_getenvid>
+  8002e2:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8002e7:	c1 e0 09             	shl    $0x9,%eax
+  8002ea:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002ef:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002f4:	85 db                	test   %ebx,%ebx
+  8002f6:	7e 07                	jle    8002ff <libmain+0x2d>
+		binaryname = argv[0];
+  8002f8:	8b 06                	mov    (%esi),%eax
+  8002fa:	a3 04 40 80 00       	mov    %eax,0x804004
+
+	// call user main routine
+	umain(argc, argv);
+  8002ff:	83 ec 08             	sub    $0x8,%esp
+  800302:	56                   	push   %esi
+  800303:	53                   	push   %ebx
+  800304:	e8 2a fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800309:	e8 0a 00 00 00       	call   800318 <exit>
+}
+  80030e:	83 c4 10             	add    $0x10,%esp
+  800311:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800314:	5b                   	pop    %ebx
+  800315:	5e                   	pop    %esi
+  800316:	5d                   	pop    %ebp
+  800317:	c3                   	ret
+
+00800318 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800318:	55                   	push   %ebp
+  800319:	89 e5                	mov    %esp,%ebp
+  80031b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80031e:	e8 a0 14 00 00       	call   8017c3 <close_all>
+	sys_env_destroy(0);
+  800323:	83 ec 0c             	sub    $0xc,%esp
+  800326:	6a 00                	push   $0x0
+  800328:	e8 5b 0a 00 00       	call   800d88 <sys_env_destroy>
+}
+  80032d:	83 c4 10             	add    $0x10,%esp
+  800330:	c9                   	leave
+  800331:	c3                   	ret
+
+00800332 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800332:	55                   	push   %ebp
+  800333:	89 e5                	mov    %esp,%ebp
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800337:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80033a:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  800340:	e8 84 0a 00 00       	call   800dc9 <sys_getenvid>
+  800345:	83 ec 0c             	sub    $0xc,%esp
+  800348:	ff 75 0c             	push   0xc(%ebp)
+  80034b:	ff 75 08             	push   0x8(%ebp)
+  80034e:	56                   	push   %esi
+  80034f:	50                   	push   %eax
+  800350:	68 90 2e 80 00       	push   $0x802e90
+  800355:	e8 b3 00 00 00       	call   80040d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80035a:	83 c4 18             	add    $0x18,%esp
+  80035d:	53                   	push   %ebx
+  80035e:	ff 75 10             	push   0x10(%ebp)
+  800361:	e8 56 00 00 00       	call   8003bc <vcprintf>
+	cprintf("\n");
+  800366:	c7 04 24 80 2d 80 00 	movl   $0x802d80,(%esp)
+  80036d:	e8 9b 00 00 00       	call   80040d <cprintf>
+  800372:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800375:	cc                   	int3
+	while (1)
+  800376:	eb fd                	jmp    800375 <_panic+0x43>
+
+00800378 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800378:	55                   	push   %ebp
+  800379:	89 e5                	mov    %esp,%ebp
+  80037b:	53                   	push   %ebx
+  80037c:	83 ec 04             	sub    $0x4,%esp
+  80037f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800382:	8b 13                	mov    (%ebx),%edx
+  800384:	8d 42 01             	lea    0x1(%edx),%eax
+  800387:	89 03                	mov    %eax,(%ebx)
+  800389:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80038c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800390:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800395:	74 09                	je     8003a0 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800397:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80039b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80039e:	c9                   	leave
+  80039f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003a0:	83 ec 08             	sub    $0x8,%esp
+  8003a3:	68 ff 00 00 00       	push   $0xff
+  8003a8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003ab:	50                   	push   %eax
+  8003ac:	e8 7a 09 00 00       	call   800d2b <sys_cputs>
+		b->idx = 0;
+  8003b1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003b7:	83 c4 10             	add    $0x10,%esp
+  8003ba:	eb db                	jmp    800397 <putch+0x1f>
+
+008003bc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003bc:	55                   	push   %ebp
+  8003bd:	89 e5                	mov    %esp,%ebp
+  8003bf:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003c5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003cc:	00 00 00 
+	b.cnt = 0;
+  8003cf:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003d6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003d9:	ff 75 0c             	push   0xc(%ebp)
+  8003dc:	ff 75 08             	push   0x8(%ebp)
+  8003df:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003e5:	50                   	push   %eax
+  8003e6:	68 78 03 80 00       	push   $0x800378
+  8003eb:	e8 14 01 00 00       	call   800504 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003f0:	83 c4 08             	add    $0x8,%esp
+  8003f3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003f9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003ff:	50                   	push   %eax
+  800400:	e8 26 09 00 00       	call   800d2b <sys_cputs>
+
+	return b.cnt;
+}
+  800405:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80040b:	c9                   	leave
+  80040c:	c3                   	ret
+
+0080040d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80040d:	55                   	push   %ebp
+  80040e:	89 e5                	mov    %esp,%ebp
+  800410:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800413:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800416:	50                   	push   %eax
+  800417:	ff 75 08             	push   0x8(%ebp)
+  80041a:	e8 9d ff ff ff       	call   8003bc <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80041f:	c9                   	leave
+  800420:	c3                   	ret
+
+00800421 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800421:	55                   	push   %ebp
+  800422:	89 e5                	mov    %esp,%ebp
+  800424:	57                   	push   %edi
+  800425:	56                   	push   %esi
+  800426:	53                   	push   %ebx
+  800427:	83 ec 1c             	sub    $0x1c,%esp
+  80042a:	89 c7                	mov    %eax,%edi
+  80042c:	89 d6                	mov    %edx,%esi
+  80042e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800431:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800434:	89 d1                	mov    %edx,%ecx
+  800436:	89 c2                	mov    %eax,%edx
+  800438:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80043b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80043e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800441:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800444:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800447:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80044e:	39 c2                	cmp    %eax,%edx
+  800450:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800453:	72 3e                	jb     800493 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800455:	83 ec 0c             	sub    $0xc,%esp
+  800458:	ff 75 18             	push   0x18(%ebp)
+  80045b:	83 eb 01             	sub    $0x1,%ebx
+  80045e:	53                   	push   %ebx
+  80045f:	50                   	push   %eax
+  800460:	83 ec 08             	sub    $0x8,%esp
+  800463:	ff 75 e4             	push   -0x1c(%ebp)
+  800466:	ff 75 e0             	push   -0x20(%ebp)
+  800469:	ff 75 dc             	push   -0x24(%ebp)
+  80046c:	ff 75 d8             	push   -0x28(%ebp)
+  80046f:	e8 5c 25 00 00       	call   8029d0 <__udivdi3>
+  800474:	83 c4 18             	add    $0x18,%esp
+  800477:	52                   	push   %edx
+  800478:	50                   	push   %eax
+  800479:	89 f2                	mov    %esi,%edx
+  80047b:	89 f8                	mov    %edi,%eax
+  80047d:	e8 9f ff ff ff       	call   800421 <printnum>
+  800482:	83 c4 20             	add    $0x20,%esp
+  800485:	eb 13                	jmp    80049a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800487:	83 ec 08             	sub    $0x8,%esp
+  80048a:	56                   	push   %esi
+  80048b:	ff 75 18             	push   0x18(%ebp)
+  80048e:	ff d7                	call   *%edi
+  800490:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800493:	83 eb 01             	sub    $0x1,%ebx
+  800496:	85 db                	test   %ebx,%ebx
+  800498:	7f ed                	jg     800487 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80049a:	83 ec 08             	sub    $0x8,%esp
+  80049d:	56                   	push   %esi
+  80049e:	83 ec 04             	sub    $0x4,%esp
+  8004a1:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a4:	ff 75 e0             	push   -0x20(%ebp)
+  8004a7:	ff 75 dc             	push   -0x24(%ebp)
+  8004aa:	ff 75 d8             	push   -0x28(%ebp)
+  8004ad:	e8 de 25 00 00       	call   802a90 <__umoddi3>
+  8004b2:	83 c4 14             	add    $0x14,%esp
+  8004b5:	0f be 80 b3 2e 80 00 	movsbl 0x802eb3(%eax),%eax
+  8004bc:	50                   	push   %eax
+  8004bd:	ff d7                	call   *%edi
+}
+  8004bf:	83 c4 10             	add    $0x10,%esp
+  8004c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c5:	5b                   	pop    %ebx
+  8004c6:	5e                   	pop    %esi
+  8004c7:	5f                   	pop    %edi
+  8004c8:	5d                   	pop    %ebp
+  8004c9:	c3                   	ret
+
+008004ca <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004ca:	55                   	push   %ebp
+  8004cb:	89 e5                	mov    %esp,%ebp
+  8004cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004d0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004d4:	8b 10                	mov    (%eax),%edx
+  8004d6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004d9:	73 0a                	jae    8004e5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004db:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004de:	89 08                	mov    %ecx,(%eax)
+  8004e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004e3:	88 02                	mov    %al,(%edx)
+}
+  8004e5:	5d                   	pop    %ebp
+  8004e6:	c3                   	ret
+
+008004e7 <printfmt>:
+{
+  8004e7:	55                   	push   %ebp
+  8004e8:	89 e5                	mov    %esp,%ebp
+  8004ea:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004ed:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004f0:	50                   	push   %eax
+  8004f1:	ff 75 10             	push   0x10(%ebp)
+  8004f4:	ff 75 0c             	push   0xc(%ebp)
+  8004f7:	ff 75 08             	push   0x8(%ebp)
+  8004fa:	e8 05 00 00 00       	call   800504 <vprintfmt>
+}
+  8004ff:	83 c4 10             	add    $0x10,%esp
+  800502:	c9                   	leave
+  800503:	c3                   	ret
+
+00800504 <vprintfmt>:
+{
+  800504:	55                   	push   %ebp
+  800505:	89 e5                	mov    %esp,%ebp
+  800507:	57                   	push   %edi
+  800508:	56                   	push   %esi
+  800509:	53                   	push   %ebx
+  80050a:	83 ec 2c             	sub    $0x2c,%esp
+  80050d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800510:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800513:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800516:	eb 0a                	jmp    800522 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800518:	83 ec 08             	sub    $0x8,%esp
+  80051b:	53                   	push   %ebx
+  80051c:	50                   	push   %eax
+  80051d:	ff d6                	call   *%esi
+  80051f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800522:	83 c7 01             	add    $0x1,%edi
+  800525:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800529:	83 f8 25             	cmp    $0x25,%eax
+  80052c:	74 0c                	je     80053a <vprintfmt+0x36>
+			if (ch == '\0')
+  80052e:	85 c0                	test   %eax,%eax
+  800530:	75 e6                	jne    800518 <vprintfmt+0x14>
+}
+  800532:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800535:	5b                   	pop    %ebx
+  800536:	5e                   	pop    %esi
+  800537:	5f                   	pop    %edi
+  800538:	5d                   	pop    %ebp
+  800539:	c3                   	ret
+		padc = ' ';
+  80053a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80053e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800545:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80054c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800553:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800558:	8d 47 01             	lea    0x1(%edi),%eax
+  80055b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80055e:	0f b6 17             	movzbl (%edi),%edx
+  800561:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800564:	3c 55                	cmp    $0x55,%al
+  800566:	0f 87 cf 03 00 00    	ja     80093b <vprintfmt+0x437>
+  80056c:	0f b6 c0             	movzbl %al,%eax
+  80056f:	ff 24 85 00 30 80 00 	jmp    *0x803000(,%eax,4)
+  800576:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800579:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80057d:	eb d9                	jmp    800558 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80057f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800582:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800586:	eb d0                	jmp    800558 <vprintfmt+0x54>
+  800588:	0f b6 d2             	movzbl %dl,%edx
+  80058b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80058e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800593:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800596:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800599:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80059d:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005a0:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005a3:	83 f9 09             	cmp    $0x9,%ecx
+  8005a6:	77 55                	ja     8005fd <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005a8:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005ab:	eb e9                	jmp    800596 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b0:	8b 00                	mov    (%eax),%eax
+  8005b2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bb:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005c1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c5:	79 91                	jns    800558 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005c7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005cd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005d4:	eb 82                	jmp    800558 <vprintfmt+0x54>
+			if (width < 0)
+  8005d6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005d9:	85 d2                	test   %edx,%edx
+  8005db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e0:	0f 49 c2             	cmovns %edx,%eax
+  8005e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005e9:	e9 6a ff ff ff       	jmp    800558 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005f1:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005f8:	e9 5b ff ff ff       	jmp    800558 <vprintfmt+0x54>
+  8005fd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800600:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800603:	eb bc                	jmp    8005c1 <vprintfmt+0xbd>
+			lflag++;
+  800605:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800608:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80060b:	e9 48 ff ff ff       	jmp    800558 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800610:	8b 45 14             	mov    0x14(%ebp),%eax
+  800613:	8d 78 04             	lea    0x4(%eax),%edi
+  800616:	83 ec 08             	sub    $0x8,%esp
+  800619:	53                   	push   %ebx
+  80061a:	ff 30                	push   (%eax)
+  80061c:	ff d6                	call   *%esi
+			break;
+  80061e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800621:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800624:	e9 b1 02 00 00       	jmp    8008da <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800629:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80062f:	8b 10                	mov    (%eax),%edx
+  800631:	89 d0                	mov    %edx,%eax
+  800633:	f7 d8                	neg    %eax
+  800635:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800638:	83 f8 0f             	cmp    $0xf,%eax
+  80063b:	7f 23                	jg     800660 <vprintfmt+0x15c>
+  80063d:	8b 14 85 60 31 80 00 	mov    0x803160(,%eax,4),%edx
+  800644:	85 d2                	test   %edx,%edx
+  800646:	74 18                	je     800660 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800648:	52                   	push   %edx
+  800649:	68 89 33 80 00       	push   $0x803389
+  80064e:	53                   	push   %ebx
+  80064f:	56                   	push   %esi
+  800650:	e8 92 fe ff ff       	call   8004e7 <printfmt>
+  800655:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800658:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80065b:	e9 7a 02 00 00       	jmp    8008da <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800660:	50                   	push   %eax
+  800661:	68 cb 2e 80 00       	push   $0x802ecb
+  800666:	53                   	push   %ebx
+  800667:	56                   	push   %esi
+  800668:	e8 7a fe ff ff       	call   8004e7 <printfmt>
+  80066d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800670:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800673:	e9 62 02 00 00       	jmp    8008da <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067b:	83 c0 04             	add    $0x4,%eax
+  80067e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800681:	8b 45 14             	mov    0x14(%ebp),%eax
+  800684:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800686:	85 c9                	test   %ecx,%ecx
+  800688:	b8 c4 2e 80 00       	mov    $0x802ec4,%eax
+  80068d:	0f 45 c1             	cmovne %ecx,%eax
+  800690:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800693:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800697:	7e 06                	jle    80069f <vprintfmt+0x19b>
+  800699:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80069d:	75 0b                	jne    8006aa <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80069f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006a2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006a5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006a8:	eb 5c                	jmp    800706 <vprintfmt+0x202>
+  8006aa:	83 ec 08             	sub    $0x8,%esp
+  8006ad:	ff 75 d0             	push   -0x30(%ebp)
+  8006b0:	ff 75 cc             	push   -0x34(%ebp)
+  8006b3:	e8 20 03 00 00       	call   8009d8 <strnlen>
+  8006b8:	89 c2                	mov    %eax,%edx
+  8006ba:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006bd:	29 d0                	sub    %edx,%eax
+  8006bf:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006c2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006c9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006cc:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006ce:	eb 0e                	jmp    8006de <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8006d0:	83 ec 08             	sub    $0x8,%esp
+  8006d3:	53                   	push   %ebx
+  8006d4:	57                   	push   %edi
+  8006d5:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d8:	83 ee 01             	sub    $0x1,%esi
+  8006db:	83 c4 10             	add    $0x10,%esp
+  8006de:	85 f6                	test   %esi,%esi
+  8006e0:	7f ee                	jg     8006d0 <vprintfmt+0x1cc>
+  8006e2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006e8:	85 c0                	test   %eax,%eax
+  8006ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ef:	0f 49 d0             	cmovns %eax,%edx
+  8006f2:	29 d0                	sub    %edx,%eax
+  8006f4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006f7:	eb a6                	jmp    80069f <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8006f9:	83 ec 08             	sub    $0x8,%esp
+  8006fc:	53                   	push   %ebx
+  8006fd:	52                   	push   %edx
+  8006fe:	ff 55 08             	call   *0x8(%ebp)
+  800701:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800704:	89 f1                	mov    %esi,%ecx
+  800706:	8d 71 01             	lea    0x1(%ecx),%esi
+  800709:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80070d:	0f be d0             	movsbl %al,%edx
+  800710:	85 d2                	test   %edx,%edx
+  800712:	74 28                	je     80073c <vprintfmt+0x238>
+  800714:	85 ff                	test   %edi,%edi
+  800716:	78 05                	js     80071d <vprintfmt+0x219>
+  800718:	83 ef 01             	sub    $0x1,%edi
+  80071b:	78 30                	js     80074d <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80071d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800721:	74 d6                	je     8006f9 <vprintfmt+0x1f5>
+  800723:	0f be c0             	movsbl %al,%eax
+  800726:	83 e8 20             	sub    $0x20,%eax
+  800729:	83 f8 5e             	cmp    $0x5e,%eax
+  80072c:	76 cb                	jbe    8006f9 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80072e:	83 ec 08             	sub    $0x8,%esp
+  800731:	53                   	push   %ebx
+  800732:	6a 3f                	push   $0x3f
+  800734:	ff 55 08             	call   *0x8(%ebp)
+  800737:	83 c4 10             	add    $0x10,%esp
+  80073a:	eb c8                	jmp    800704 <vprintfmt+0x200>
+  80073c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80073f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800742:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800745:	01 d0                	add    %edx,%eax
+  800747:	29 c8                	sub    %ecx,%eax
+  800749:	89 c7                	mov    %eax,%edi
+  80074b:	eb 13                	jmp    800760 <vprintfmt+0x25c>
+  80074d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800750:	eb ed                	jmp    80073f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800752:	83 ec 08             	sub    $0x8,%esp
+  800755:	53                   	push   %ebx
+  800756:	6a 20                	push   $0x20
+  800758:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80075a:	83 ef 01             	sub    $0x1,%edi
+  80075d:	83 c4 10             	add    $0x10,%esp
+  800760:	85 ff                	test   %edi,%edi
+  800762:	7f ee                	jg     800752 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800764:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800767:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076a:	e9 6b 01 00 00       	jmp    8008da <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80076f:	83 f9 01             	cmp    $0x1,%ecx
+  800772:	7f 1f                	jg     800793 <vprintfmt+0x28f>
+	else if (lflag)
+  800774:	85 c9                	test   %ecx,%ecx
+  800776:	74 67                	je     8007df <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800778:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077b:	8b 00                	mov    (%eax),%eax
+  80077d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800780:	89 c1                	mov    %eax,%ecx
+  800782:	c1 f9 1f             	sar    $0x1f,%ecx
+  800785:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800788:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078b:	8d 40 04             	lea    0x4(%eax),%eax
+  80078e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800791:	eb 17                	jmp    8007aa <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800793:	8b 45 14             	mov    0x14(%ebp),%eax
+  800796:	8b 50 04             	mov    0x4(%eax),%edx
+  800799:	8b 00                	mov    (%eax),%eax
+  80079b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80079e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007aa:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007ad:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007b5:	85 c9                	test   %ecx,%ecx
+  8007b7:	0f 89 03 01 00 00    	jns    8008c0 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8007bd:	83 ec 08             	sub    $0x8,%esp
+  8007c0:	53                   	push   %ebx
+  8007c1:	6a 2d                	push   $0x2d
+  8007c3:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007c5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007c8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007cb:	f7 da                	neg    %edx
+  8007cd:	83 d1 00             	adc    $0x0,%ecx
+  8007d0:	f7 d9                	neg    %ecx
+  8007d2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007da:	e9 e1 00 00 00       	jmp    8008c0 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8007df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e2:	8b 00                	mov    (%eax),%eax
+  8007e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007e7:	89 c1                	mov    %eax,%ecx
+  8007e9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007ec:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f8:	eb b0                	jmp    8007aa <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8007fa:	83 f9 01             	cmp    $0x1,%ecx
+  8007fd:	7f 1e                	jg     80081d <vprintfmt+0x319>
+	else if (lflag)
+  8007ff:	85 c9                	test   %ecx,%ecx
+  800801:	74 32                	je     800835 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800803:	8b 45 14             	mov    0x14(%ebp),%eax
+  800806:	8b 10                	mov    (%eax),%edx
+  800808:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080d:	8d 40 04             	lea    0x4(%eax),%eax
+  800810:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800813:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800818:	e9 a3 00 00 00       	jmp    8008c0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80081d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800820:	8b 10                	mov    (%eax),%edx
+  800822:	8b 48 04             	mov    0x4(%eax),%ecx
+  800825:	8d 40 08             	lea    0x8(%eax),%eax
+  800828:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80082b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800830:	e9 8b 00 00 00       	jmp    8008c0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800835:	8b 45 14             	mov    0x14(%ebp),%eax
+  800838:	8b 10                	mov    (%eax),%edx
+  80083a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80083f:	8d 40 04             	lea    0x4(%eax),%eax
+  800842:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800845:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80084a:	eb 74                	jmp    8008c0 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80084c:	83 f9 01             	cmp    $0x1,%ecx
+  80084f:	7f 1b                	jg     80086c <vprintfmt+0x368>
+	else if (lflag)
+  800851:	85 c9                	test   %ecx,%ecx
+  800853:	74 2c                	je     800881 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800855:	8b 45 14             	mov    0x14(%ebp),%eax
+  800858:	8b 10                	mov    (%eax),%edx
+  80085a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80085f:	8d 40 04             	lea    0x4(%eax),%eax
+  800862:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800865:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80086a:	eb 54                	jmp    8008c0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80086c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086f:	8b 10                	mov    (%eax),%edx
+  800871:	8b 48 04             	mov    0x4(%eax),%ecx
+  800874:	8d 40 08             	lea    0x8(%eax),%eax
+  800877:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80087a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80087f:	eb 3f                	jmp    8008c0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800881:	8b 45 14             	mov    0x14(%ebp),%eax
+  800884:	8b 10                	mov    (%eax),%edx
+  800886:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80088b:	8d 40 04             	lea    0x4(%eax),%eax
+  80088e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800891:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800896:	eb 28                	jmp    8008c0 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800898:	83 ec 08             	sub    $0x8,%esp
+  80089b:	53                   	push   %ebx
+  80089c:	6a 30                	push   $0x30
+  80089e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008a0:	83 c4 08             	add    $0x8,%esp
+  8008a3:	53                   	push   %ebx
+  8008a4:	6a 78                	push   $0x78
+  8008a6:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ab:	8b 10                	mov    (%eax),%edx
+  8008ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008b2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008bb:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8008c0:	83 ec 0c             	sub    $0xc,%esp
+  8008c3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008c7:	50                   	push   %eax
+  8008c8:	ff 75 e0             	push   -0x20(%ebp)
+  8008cb:	57                   	push   %edi
+  8008cc:	51                   	push   %ecx
+  8008cd:	52                   	push   %edx
+  8008ce:	89 da                	mov    %ebx,%edx
+  8008d0:	89 f0                	mov    %esi,%eax
+  8008d2:	e8 4a fb ff ff       	call   800421 <printnum>
+			break;
+  8008d7:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8008da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008dd:	e9 40 fc ff ff       	jmp    800522 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8008e2:	83 f9 01             	cmp    $0x1,%ecx
+  8008e5:	7f 1b                	jg     800902 <vprintfmt+0x3fe>
+	else if (lflag)
+  8008e7:	85 c9                	test   %ecx,%ecx
+  8008e9:	74 2c                	je     800917 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8008eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ee:	8b 10                	mov    (%eax),%edx
+  8008f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008fb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800900:	eb be                	jmp    8008c0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800902:	8b 45 14             	mov    0x14(%ebp),%eax
+  800905:	8b 10                	mov    (%eax),%edx
+  800907:	8b 48 04             	mov    0x4(%eax),%ecx
+  80090a:	8d 40 08             	lea    0x8(%eax),%eax
+  80090d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800910:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800915:	eb a9                	jmp    8008c0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800917:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091a:	8b 10                	mov    (%eax),%edx
+  80091c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800921:	8d 40 04             	lea    0x4(%eax),%eax
+  800924:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800927:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80092c:	eb 92                	jmp    8008c0 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80092e:	83 ec 08             	sub    $0x8,%esp
+  800931:	53                   	push   %ebx
+  800932:	6a 25                	push   $0x25
+  800934:	ff d6                	call   *%esi
+			break;
+  800936:	83 c4 10             	add    $0x10,%esp
+  800939:	eb 9f                	jmp    8008da <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80093b:	83 ec 08             	sub    $0x8,%esp
+  80093e:	53                   	push   %ebx
+  80093f:	6a 25                	push   $0x25
+  800941:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800943:	83 c4 10             	add    $0x10,%esp
+  800946:	89 f8                	mov    %edi,%eax
+  800948:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80094c:	74 05                	je     800953 <vprintfmt+0x44f>
+  80094e:	83 e8 01             	sub    $0x1,%eax
+  800951:	eb f5                	jmp    800948 <vprintfmt+0x444>
+  800953:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800956:	eb 82                	jmp    8008da <vprintfmt+0x3d6>
+
+00800958 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800958:	55                   	push   %ebp
+  800959:	89 e5                	mov    %esp,%ebp
+  80095b:	83 ec 18             	sub    $0x18,%esp
+  80095e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800961:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800964:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800967:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80096b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80096e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800975:	85 c0                	test   %eax,%eax
+  800977:	74 26                	je     80099f <vsnprintf+0x47>
+  800979:	85 d2                	test   %edx,%edx
+  80097b:	7e 22                	jle    80099f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80097d:	ff 75 14             	push   0x14(%ebp)
+  800980:	ff 75 10             	push   0x10(%ebp)
+  800983:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800986:	50                   	push   %eax
+  800987:	68 ca 04 80 00       	push   $0x8004ca
+  80098c:	e8 73 fb ff ff       	call   800504 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800991:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800994:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800997:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80099a:	83 c4 10             	add    $0x10,%esp
+}
+  80099d:	c9                   	leave
+  80099e:	c3                   	ret
+		return -E_INVAL;
+  80099f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a4:	eb f7                	jmp    80099d <vsnprintf+0x45>
+
+008009a6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009a6:	55                   	push   %ebp
+  8009a7:	89 e5                	mov    %esp,%ebp
+  8009a9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009ac:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009af:	50                   	push   %eax
+  8009b0:	ff 75 10             	push   0x10(%ebp)
+  8009b3:	ff 75 0c             	push   0xc(%ebp)
+  8009b6:	ff 75 08             	push   0x8(%ebp)
+  8009b9:	e8 9a ff ff ff       	call   800958 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009be:	c9                   	leave
+  8009bf:	c3                   	ret
+
+008009c0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009c0:	55                   	push   %ebp
+  8009c1:	89 e5                	mov    %esp,%ebp
+  8009c3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cb:	eb 03                	jmp    8009d0 <strlen+0x10>
+		n++;
+  8009cd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009d0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009d4:	75 f7                	jne    8009cd <strlen+0xd>
+	return n;
+}
+  8009d6:	5d                   	pop    %ebp
+  8009d7:	c3                   	ret
+
+008009d8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009d8:	55                   	push   %ebp
+  8009d9:	89 e5                	mov    %esp,%ebp
+  8009db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e6:	eb 03                	jmp    8009eb <strnlen+0x13>
+		n++;
+  8009e8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009eb:	39 d0                	cmp    %edx,%eax
+  8009ed:	74 08                	je     8009f7 <strnlen+0x1f>
+  8009ef:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009f3:	75 f3                	jne    8009e8 <strnlen+0x10>
+  8009f5:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009f7:	89 d0                	mov    %edx,%eax
+  8009f9:	5d                   	pop    %ebp
+  8009fa:	c3                   	ret
+
+008009fb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009fb:	55                   	push   %ebp
+  8009fc:	89 e5                	mov    %esp,%ebp
+  8009fe:	53                   	push   %ebx
+  8009ff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a02:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a0e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a11:	83 c0 01             	add    $0x1,%eax
+  800a14:	84 d2                	test   %dl,%dl
+  800a16:	75 f2                	jne    800a0a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a18:	89 c8                	mov    %ecx,%eax
+  800a1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a1d:	c9                   	leave
+  800a1e:	c3                   	ret
+
+00800a1f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a1f:	55                   	push   %ebp
+  800a20:	89 e5                	mov    %esp,%ebp
+  800a22:	53                   	push   %ebx
+  800a23:	83 ec 10             	sub    $0x10,%esp
+  800a26:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a29:	53                   	push   %ebx
+  800a2a:	e8 91 ff ff ff       	call   8009c0 <strlen>
+  800a2f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a32:	ff 75 0c             	push   0xc(%ebp)
+  800a35:	01 d8                	add    %ebx,%eax
+  800a37:	50                   	push   %eax
+  800a38:	e8 be ff ff ff       	call   8009fb <strcpy>
+	return dst;
+}
+  800a3d:	89 d8                	mov    %ebx,%eax
+  800a3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a42:	c9                   	leave
+  800a43:	c3                   	ret
+
+00800a44 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a44:	55                   	push   %ebp
+  800a45:	89 e5                	mov    %esp,%ebp
+  800a47:	56                   	push   %esi
+  800a48:	53                   	push   %ebx
+  800a49:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a4f:	89 f3                	mov    %esi,%ebx
+  800a51:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a54:	89 f0                	mov    %esi,%eax
+  800a56:	eb 0f                	jmp    800a67 <strncpy+0x23>
+		*dst++ = *src;
+  800a58:	83 c0 01             	add    $0x1,%eax
+  800a5b:	0f b6 0a             	movzbl (%edx),%ecx
+  800a5e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a61:	80 f9 01             	cmp    $0x1,%cl
+  800a64:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a67:	39 d8                	cmp    %ebx,%eax
+  800a69:	75 ed                	jne    800a58 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a6b:	89 f0                	mov    %esi,%eax
+  800a6d:	5b                   	pop    %ebx
+  800a6e:	5e                   	pop    %esi
+  800a6f:	5d                   	pop    %ebp
+  800a70:	c3                   	ret
+
+00800a71 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a71:	55                   	push   %ebp
+  800a72:	89 e5                	mov    %esp,%ebp
+  800a74:	56                   	push   %esi
+  800a75:	53                   	push   %ebx
+  800a76:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a7c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a7f:	89 f0                	mov    %esi,%eax
+  800a81:	85 d2                	test   %edx,%edx
+  800a83:	74 21                	je     800aa6 <strlcpy+0x35>
+  800a85:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a89:	89 f2                	mov    %esi,%edx
+  800a8b:	eb 09                	jmp    800a96 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a8d:	83 c1 01             	add    $0x1,%ecx
+  800a90:	83 c2 01             	add    $0x1,%edx
+  800a93:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a96:	39 c2                	cmp    %eax,%edx
+  800a98:	74 09                	je     800aa3 <strlcpy+0x32>
+  800a9a:	0f b6 19             	movzbl (%ecx),%ebx
+  800a9d:	84 db                	test   %bl,%bl
+  800a9f:	75 ec                	jne    800a8d <strlcpy+0x1c>
+  800aa1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800aa3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800aa6:	29 f0                	sub    %esi,%eax
+}
+  800aa8:	5b                   	pop    %ebx
+  800aa9:	5e                   	pop    %esi
+  800aaa:	5d                   	pop    %ebp
+  800aab:	c3                   	ret
+
+00800aac <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800aac:	55                   	push   %ebp
+  800aad:	89 e5                	mov    %esp,%ebp
+  800aaf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ab2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ab5:	eb 06                	jmp    800abd <strcmp+0x11>
+		p++, q++;
+  800ab7:	83 c1 01             	add    $0x1,%ecx
+  800aba:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800abd:	0f b6 01             	movzbl (%ecx),%eax
+  800ac0:	84 c0                	test   %al,%al
+  800ac2:	74 04                	je     800ac8 <strcmp+0x1c>
+  800ac4:	3a 02                	cmp    (%edx),%al
+  800ac6:	74 ef                	je     800ab7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ac8:	0f b6 c0             	movzbl %al,%eax
+  800acb:	0f b6 12             	movzbl (%edx),%edx
+  800ace:	29 d0                	sub    %edx,%eax
+}
+  800ad0:	5d                   	pop    %ebp
+  800ad1:	c3                   	ret
+
+00800ad2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	53                   	push   %ebx
+  800ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800adc:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800adf:	eb 09                	jmp    800aea <strncmp+0x18>
+		n--, p++, q++;
+  800ae1:	83 ea 01             	sub    $0x1,%edx
+  800ae4:	83 c0 01             	add    $0x1,%eax
+  800ae7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800aea:	85 d2                	test   %edx,%edx
+  800aec:	74 18                	je     800b06 <strncmp+0x34>
+  800aee:	0f b6 18             	movzbl (%eax),%ebx
+  800af1:	84 db                	test   %bl,%bl
+  800af3:	74 04                	je     800af9 <strncmp+0x27>
+  800af5:	3a 19                	cmp    (%ecx),%bl
+  800af7:	74 e8                	je     800ae1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800af9:	0f b6 00             	movzbl (%eax),%eax
+  800afc:	0f b6 11             	movzbl (%ecx),%edx
+  800aff:	29 d0                	sub    %edx,%eax
+}
+  800b01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b04:	c9                   	leave
+  800b05:	c3                   	ret
+		return 0;
+  800b06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0b:	eb f4                	jmp    800b01 <strncmp+0x2f>
+
+00800b0d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b0d:	55                   	push   %ebp
+  800b0e:	89 e5                	mov    %esp,%ebp
+  800b10:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b13:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b17:	eb 03                	jmp    800b1c <strchr+0xf>
+  800b19:	83 c0 01             	add    $0x1,%eax
+  800b1c:	0f b6 10             	movzbl (%eax),%edx
+  800b1f:	84 d2                	test   %dl,%dl
+  800b21:	74 06                	je     800b29 <strchr+0x1c>
+		if (*s == c)
+  800b23:	38 ca                	cmp    %cl,%dl
+  800b25:	75 f2                	jne    800b19 <strchr+0xc>
+  800b27:	eb 05                	jmp    800b2e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b2e:	5d                   	pop    %ebp
+  800b2f:	c3                   	ret
+
+00800b30 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b36:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b3a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b3d:	38 ca                	cmp    %cl,%dl
+  800b3f:	74 09                	je     800b4a <strfind+0x1a>
+  800b41:	84 d2                	test   %dl,%dl
+  800b43:	74 05                	je     800b4a <strfind+0x1a>
+	for (; *s; s++)
+  800b45:	83 c0 01             	add    $0x1,%eax
+  800b48:	eb f0                	jmp    800b3a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b4a:	5d                   	pop    %ebp
+  800b4b:	c3                   	ret
+
+00800b4c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b4c:	55                   	push   %ebp
+  800b4d:	89 e5                	mov    %esp,%ebp
+  800b4f:	57                   	push   %edi
+  800b50:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b53:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b56:	85 c9                	test   %ecx,%ecx
+  800b58:	74 20                	je     800b7a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b5a:	89 f8                	mov    %edi,%eax
+  800b5c:	09 c8                	or     %ecx,%eax
+  800b5e:	a8 03                	test   $0x3,%al
+  800b60:	75 12                	jne    800b74 <memset+0x28>
+		c &= 0xFF;
+  800b62:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b66:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b6c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b6f:	fc                   	cld
+  800b70:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b72:	eb 06                	jmp    800b7a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b77:	fc                   	cld
+  800b78:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b7a:	89 f8                	mov    %edi,%eax
+  800b7c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b7f:	c9                   	leave
+  800b80:	c3                   	ret
+
+00800b81 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	57                   	push   %edi
+  800b85:	56                   	push   %esi
+  800b86:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b89:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b8c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b8f:	39 c6                	cmp    %eax,%esi
+  800b91:	73 32                	jae    800bc5 <memmove+0x44>
+  800b93:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b96:	39 d0                	cmp    %edx,%eax
+  800b98:	73 2b                	jae    800bc5 <memmove+0x44>
+		s += n;
+		d += n;
+  800b9a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b9d:	89 d6                	mov    %edx,%esi
+  800b9f:	09 fe                	or     %edi,%esi
+  800ba1:	09 ce                	or     %ecx,%esi
+  800ba3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ba9:	75 0e                	jne    800bb9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bab:	83 ef 04             	sub    $0x4,%edi
+  800bae:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bb1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bb4:	fd                   	std
+  800bb5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bb7:	eb 09                	jmp    800bc2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bb9:	83 ef 01             	sub    $0x1,%edi
+  800bbc:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bbf:	fd                   	std
+  800bc0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bc2:	fc                   	cld
+  800bc3:	eb 1a                	jmp    800bdf <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bc5:	89 f2                	mov    %esi,%edx
+  800bc7:	09 c2                	or     %eax,%edx
+  800bc9:	09 ca                	or     %ecx,%edx
+  800bcb:	f6 c2 03             	test   $0x3,%dl
+  800bce:	75 0a                	jne    800bda <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bd0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bd3:	89 c7                	mov    %eax,%edi
+  800bd5:	fc                   	cld
+  800bd6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bd8:	eb 05                	jmp    800bdf <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bda:	89 c7                	mov    %eax,%edi
+  800bdc:	fc                   	cld
+  800bdd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bdf:	5e                   	pop    %esi
+  800be0:	5f                   	pop    %edi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+
+00800be3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800be9:	ff 75 10             	push   0x10(%ebp)
+  800bec:	ff 75 0c             	push   0xc(%ebp)
+  800bef:	ff 75 08             	push   0x8(%ebp)
+  800bf2:	e8 8a ff ff ff       	call   800b81 <memmove>
+}
+  800bf7:	c9                   	leave
+  800bf8:	c3                   	ret
+
+00800bf9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bf9:	55                   	push   %ebp
+  800bfa:	89 e5                	mov    %esp,%ebp
+  800bfc:	56                   	push   %esi
+  800bfd:	53                   	push   %ebx
+  800bfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c01:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c04:	89 c6                	mov    %eax,%esi
+  800c06:	03 75 10             	add    0x10(%ebp),%esi
+  800c09:	eb 06                	jmp    800c11 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c0b:	83 c0 01             	add    $0x1,%eax
+  800c0e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c11:	39 f0                	cmp    %esi,%eax
+  800c13:	74 14                	je     800c29 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c15:	0f b6 08             	movzbl (%eax),%ecx
+  800c18:	0f b6 1a             	movzbl (%edx),%ebx
+  800c1b:	38 d9                	cmp    %bl,%cl
+  800c1d:	74 ec                	je     800c0b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c1f:	0f b6 c1             	movzbl %cl,%eax
+  800c22:	0f b6 db             	movzbl %bl,%ebx
+  800c25:	29 d8                	sub    %ebx,%eax
+  800c27:	eb 05                	jmp    800c2e <memcmp+0x35>
+	}
+
+	return 0;
+  800c29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c2e:	5b                   	pop    %ebx
+  800c2f:	5e                   	pop    %esi
+  800c30:	5d                   	pop    %ebp
+  800c31:	c3                   	ret
+
+00800c32 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c3b:	89 c2                	mov    %eax,%edx
+  800c3d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c40:	eb 03                	jmp    800c45 <memfind+0x13>
+  800c42:	83 c0 01             	add    $0x1,%eax
+  800c45:	39 d0                	cmp    %edx,%eax
+  800c47:	73 04                	jae    800c4d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c49:	38 08                	cmp    %cl,(%eax)
+  800c4b:	75 f5                	jne    800c42 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c4d:	5d                   	pop    %ebp
+  800c4e:	c3                   	ret
+
+00800c4f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c4f:	55                   	push   %ebp
+  800c50:	89 e5                	mov    %esp,%ebp
+  800c52:	57                   	push   %edi
+  800c53:	56                   	push   %esi
+  800c54:	53                   	push   %ebx
+  800c55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c5b:	eb 03                	jmp    800c60 <strtol+0x11>
+		s++;
+  800c5d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c60:	0f b6 02             	movzbl (%edx),%eax
+  800c63:	3c 20                	cmp    $0x20,%al
+  800c65:	74 f6                	je     800c5d <strtol+0xe>
+  800c67:	3c 09                	cmp    $0x9,%al
+  800c69:	74 f2                	je     800c5d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c6b:	3c 2b                	cmp    $0x2b,%al
+  800c6d:	74 2a                	je     800c99 <strtol+0x4a>
+	int neg = 0;
+  800c6f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c74:	3c 2d                	cmp    $0x2d,%al
+  800c76:	74 2b                	je     800ca3 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c78:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c7e:	75 0f                	jne    800c8f <strtol+0x40>
+  800c80:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c83:	74 28                	je     800cad <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c85:	85 db                	test   %ebx,%ebx
+  800c87:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c8c:	0f 44 d8             	cmove  %eax,%ebx
+  800c8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c94:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c97:	eb 46                	jmp    800cdf <strtol+0x90>
+		s++;
+  800c99:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ca1:	eb d5                	jmp    800c78 <strtol+0x29>
+		s++, neg = 1;
+  800ca3:	83 c2 01             	add    $0x1,%edx
+  800ca6:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cab:	eb cb                	jmp    800c78 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cad:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cb1:	74 0e                	je     800cc1 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800cb3:	85 db                	test   %ebx,%ebx
+  800cb5:	75 d8                	jne    800c8f <strtol+0x40>
+		s++, base = 8;
+  800cb7:	83 c2 01             	add    $0x1,%edx
+  800cba:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cbf:	eb ce                	jmp    800c8f <strtol+0x40>
+		s += 2, base = 16;
+  800cc1:	83 c2 02             	add    $0x2,%edx
+  800cc4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cc9:	eb c4                	jmp    800c8f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ccb:	0f be c0             	movsbl %al,%eax
+  800cce:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800cd1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cd4:	7d 3a                	jge    800d10 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800cd6:	83 c2 01             	add    $0x1,%edx
+  800cd9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cdd:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800cdf:	0f b6 02             	movzbl (%edx),%eax
+  800ce2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ce5:	89 f3                	mov    %esi,%ebx
+  800ce7:	80 fb 09             	cmp    $0x9,%bl
+  800cea:	76 df                	jbe    800ccb <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800cec:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cef:	89 f3                	mov    %esi,%ebx
+  800cf1:	80 fb 19             	cmp    $0x19,%bl
+  800cf4:	77 08                	ja     800cfe <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800cf6:	0f be c0             	movsbl %al,%eax
+  800cf9:	83 e8 57             	sub    $0x57,%eax
+  800cfc:	eb d3                	jmp    800cd1 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cfe:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d01:	89 f3                	mov    %esi,%ebx
+  800d03:	80 fb 19             	cmp    $0x19,%bl
+  800d06:	77 08                	ja     800d10 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d08:	0f be c0             	movsbl %al,%eax
+  800d0b:	83 e8 37             	sub    $0x37,%eax
+  800d0e:	eb c1                	jmp    800cd1 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d10:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d14:	74 05                	je     800d1b <strtol+0xcc>
+		*endptr = (char *) s;
+  800d16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d19:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d1b:	89 c8                	mov    %ecx,%eax
+  800d1d:	f7 d8                	neg    %eax
+  800d1f:	85 ff                	test   %edi,%edi
+  800d21:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d24:	89 c8                	mov    %ecx,%eax
+  800d26:	5b                   	pop    %ebx
+  800d27:	5e                   	pop    %esi
+  800d28:	5f                   	pop    %edi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+
+00800d2b <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d2b:	55                   	push   %ebp
+  800d2c:	89 e5                	mov    %esp,%ebp
+  800d2e:	57                   	push   %edi
+  800d2f:	56                   	push   %esi
+  800d30:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3c:	89 c3                	mov    %eax,%ebx
+  800d3e:	89 c7                	mov    %eax,%edi
+  800d40:	89 c6                	mov    %eax,%esi
+  800d42:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d44:	5b                   	pop    %ebx
+  800d45:	5e                   	pop    %esi
+  800d46:	5f                   	pop    %edi
+  800d47:	5d                   	pop    %ebp
+  800d48:	c3                   	ret
+
+00800d49 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d49:	55                   	push   %ebp
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	57                   	push   %edi
+  800d4d:	56                   	push   %esi
+  800d4e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d54:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d59:	89 d1                	mov    %edx,%ecx
+  800d5b:	89 d3                	mov    %edx,%ebx
+  800d5d:	89 d7                	mov    %edx,%edi
+  800d5f:	89 d6                	mov    %edx,%esi
+  800d61:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d63:	5b                   	pop    %ebx
+  800d64:	5e                   	pop    %esi
+  800d65:	5f                   	pop    %edi
+  800d66:	5d                   	pop    %ebp
+  800d67:	c3                   	ret
+
+00800d68 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	57                   	push   %edi
+  800d6c:	56                   	push   %esi
+  800d6d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d76:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d7b:	89 cb                	mov    %ecx,%ebx
+  800d7d:	89 cf                	mov    %ecx,%edi
+  800d7f:	89 ce                	mov    %ecx,%esi
+  800d81:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800d83:	5b                   	pop    %ebx
+  800d84:	5e                   	pop    %esi
+  800d85:	5f                   	pop    %edi
+  800d86:	5d                   	pop    %ebp
+  800d87:	c3                   	ret
+
+00800d88 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d88:	55                   	push   %ebp
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	57                   	push   %edi
+  800d8c:	56                   	push   %esi
+  800d8d:	53                   	push   %ebx
+  800d8e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d99:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d9e:	89 cb                	mov    %ecx,%ebx
+  800da0:	89 cf                	mov    %ecx,%edi
+  800da2:	89 ce                	mov    %ecx,%esi
+  800da4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da6:	85 c0                	test   %eax,%eax
+  800da8:	7f 08                	jg     800db2 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800daa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db2:	83 ec 0c             	sub    $0xc,%esp
+  800db5:	50                   	push   %eax
+  800db6:	6a 03                	push   $0x3
+  800db8:	68 bf 31 80 00       	push   $0x8031bf
+  800dbd:	6a 23                	push   $0x23
+  800dbf:	68 dc 31 80 00       	push   $0x8031dc
+  800dc4:	e8 69 f5 ff ff       	call   800332 <_panic>
+
+00800dc9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dc9:	55                   	push   %ebp
+  800dca:	89 e5                	mov    %esp,%ebp
+  800dcc:	57                   	push   %edi
+  800dcd:	56                   	push   %esi
+  800dce:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dd9:	89 d1                	mov    %edx,%ecx
+  800ddb:	89 d3                	mov    %edx,%ebx
+  800ddd:	89 d7                	mov    %edx,%edi
+  800ddf:	89 d6                	mov    %edx,%esi
+  800de1:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800de3:	5b                   	pop    %ebx
+  800de4:	5e                   	pop    %esi
+  800de5:	5f                   	pop    %edi
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+
+00800de8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	57                   	push   %edi
+  800dec:	56                   	push   %esi
+  800ded:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df3:	b8 16 00 00 00       	mov    $0x16,%eax
+  800df8:	89 d1                	mov    %edx,%ecx
+  800dfa:	89 d3                	mov    %edx,%ebx
+  800dfc:	89 d7                	mov    %edx,%edi
+  800dfe:	89 d6                	mov    %edx,%esi
+  800e00:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e02:	5b                   	pop    %ebx
+  800e03:	5e                   	pop    %esi
+  800e04:	5f                   	pop    %edi
+  800e05:	5d                   	pop    %ebp
+  800e06:	c3                   	ret
+
+00800e07 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800e07:	55                   	push   %ebp
+  800e08:	89 e5                	mov    %esp,%ebp
+  800e0a:	57                   	push   %edi
+  800e0b:	56                   	push   %esi
+  800e0c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e12:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e17:	89 d1                	mov    %edx,%ecx
+  800e19:	89 d3                	mov    %edx,%ebx
+  800e1b:	89 d7                	mov    %edx,%edi
+  800e1d:	89 d6                	mov    %edx,%esi
+  800e1f:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800e21:	5b                   	pop    %ebx
+  800e22:	5e                   	pop    %esi
+  800e23:	5f                   	pop    %edi
+  800e24:	5d                   	pop    %ebp
+  800e25:	c3                   	ret
+
+00800e26 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	57                   	push   %edi
+  800e2a:	56                   	push   %esi
+  800e2b:	53                   	push   %ebx
+  800e2c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3a:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e3f:	89 df                	mov    %ebx,%edi
+  800e41:	89 de                	mov    %ebx,%esi
+  800e43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e45:	85 c0                	test   %eax,%eax
+  800e47:	7f 08                	jg     800e51 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800e49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5e                   	pop    %esi
+  800e4e:	5f                   	pop    %edi
+  800e4f:	5d                   	pop    %ebp
+  800e50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e51:	83 ec 0c             	sub    $0xc,%esp
+  800e54:	50                   	push   %eax
+  800e55:	6a 15                	push   $0x15
+  800e57:	68 bf 31 80 00       	push   $0x8031bf
+  800e5c:	6a 23                	push   $0x23
+  800e5e:	68 dc 31 80 00       	push   $0x8031dc
+  800e63:	e8 ca f4 ff ff       	call   800332 <_panic>
+
+00800e68 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	57                   	push   %edi
+  800e6c:	56                   	push   %esi
+  800e6d:	53                   	push   %ebx
+  800e6e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e71:	be 00 00 00 00       	mov    $0x0,%esi
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e84:	89 f7                	mov    %esi,%edi
+  800e86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e88:	85 c0                	test   %eax,%eax
+  800e8a:	7f 08                	jg     800e94 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5e                   	pop    %esi
+  800e91:	5f                   	pop    %edi
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e94:	83 ec 0c             	sub    $0xc,%esp
+  800e97:	50                   	push   %eax
+  800e98:	6a 05                	push   $0x5
+  800e9a:	68 bf 31 80 00       	push   $0x8031bf
+  800e9f:	6a 23                	push   $0x23
+  800ea1:	68 dc 31 80 00       	push   $0x8031dc
+  800ea6:	e8 87 f4 ff ff       	call   800332 <_panic>
+
+00800eab <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	57                   	push   %edi
+  800eaf:	56                   	push   %esi
+  800eb0:	53                   	push   %ebx
+  800eb1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb4:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebf:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ec4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec7:	89 f7                	mov    %esi,%edi
+  800ec9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ecb:	85 c0                	test   %eax,%eax
+  800ecd:	7f 08                	jg     800ed7 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed2:	5b                   	pop    %ebx
+  800ed3:	5e                   	pop    %esi
+  800ed4:	5f                   	pop    %edi
+  800ed5:	5d                   	pop    %ebp
+  800ed6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+  800eda:	50                   	push   %eax
+  800edb:	6a 06                	push   $0x6
+  800edd:	68 bf 31 80 00       	push   $0x8031bf
+  800ee2:	6a 23                	push   $0x23
+  800ee4:	68 dc 31 80 00       	push   $0x8031dc
+  800ee9:	e8 44 f4 ff ff       	call   800332 <_panic>
+
+00800eee <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800eee:	55                   	push   %ebp
+  800eef:	89 e5                	mov    %esp,%ebp
+  800ef1:	57                   	push   %edi
+  800ef2:	56                   	push   %esi
+  800ef3:	53                   	push   %ebx
+  800ef4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efd:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f05:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f08:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f0b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0d:	85 c0                	test   %eax,%eax
+  800f0f:	7f 08                	jg     800f19 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+  800f1c:	50                   	push   %eax
+  800f1d:	6a 07                	push   $0x7
+  800f1f:	68 bf 31 80 00       	push   $0x8031bf
+  800f24:	6a 23                	push   $0x23
+  800f26:	68 dc 31 80 00       	push   $0x8031dc
+  800f2b:	e8 02 f4 ff ff       	call   800332 <_panic>
+
+00800f30 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	56                   	push   %esi
+  800f35:	53                   	push   %ebx
+  800f36:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f44:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f49:	89 df                	mov    %ebx,%edi
+  800f4b:	89 de                	mov    %ebx,%esi
+  800f4d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4f:	85 c0                	test   %eax,%eax
+  800f51:	7f 08                	jg     800f5b <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f56:	5b                   	pop    %ebx
+  800f57:	5e                   	pop    %esi
+  800f58:	5f                   	pop    %edi
+  800f59:	5d                   	pop    %ebp
+  800f5a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5b:	83 ec 0c             	sub    $0xc,%esp
+  800f5e:	50                   	push   %eax
+  800f5f:	6a 08                	push   $0x8
+  800f61:	68 bf 31 80 00       	push   $0x8031bf
+  800f66:	6a 23                	push   $0x23
+  800f68:	68 dc 31 80 00       	push   $0x8031dc
+  800f6d:	e8 c0 f3 ff ff       	call   800332 <_panic>
+
+00800f72 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f72:	55                   	push   %ebp
+  800f73:	89 e5                	mov    %esp,%ebp
+  800f75:	57                   	push   %edi
+  800f76:	56                   	push   %esi
+  800f77:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f83:	be 00 00 00 00       	mov    $0x0,%esi
+  800f88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f8e:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f90:	5b                   	pop    %ebx
+  800f91:	5e                   	pop    %esi
+  800f92:	5f                   	pop    %edi
+  800f93:	5d                   	pop    %ebp
+  800f94:	c3                   	ret
+
+00800f95 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f95:	55                   	push   %ebp
+  800f96:	89 e5                	mov    %esp,%ebp
+  800f98:	57                   	push   %edi
+  800f99:	56                   	push   %esi
+  800f9a:	53                   	push   %ebx
+  800f9b:	8b 45 18             	mov    0x18(%ebp),%eax
+  800f9e:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800fa1:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800fa6:	77 27                	ja     800fcf <sys_page_map_range+0x3a>
+  800fa8:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800fae:	77 1f                	ja     800fcf <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800fb0:	c1 e0 0c             	shl    $0xc,%eax
+  800fb3:	89 c6                	mov    %eax,%esi
+  800fb5:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800fb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fc2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc8:	cd 30                	int    $0x30
+}
+  800fca:	5b                   	pop    %ebx
+  800fcb:	5e                   	pop    %esi
+  800fcc:	5f                   	pop    %edi
+  800fcd:	5d                   	pop    %ebp
+  800fce:	c3                   	ret
+		return -E_INVAL;
+  800fcf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fd4:	eb f4                	jmp    800fca <sys_page_map_range+0x35>
+
+00800fd6 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	57                   	push   %edi
+  800fda:	56                   	push   %esi
+  800fdb:	53                   	push   %ebx
+  800fdc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fea:	be 00 00 00 00       	mov    $0x0,%esi
+  800fef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ff5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff7:	85 c0                	test   %eax,%eax
+  800ff9:	7f 08                	jg     801003 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800ffb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ffe:	5b                   	pop    %ebx
+  800fff:	5e                   	pop    %esi
+  801000:	5f                   	pop    %edi
+  801001:	5d                   	pop    %ebp
+  801002:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801003:	83 ec 0c             	sub    $0xc,%esp
+  801006:	50                   	push   %eax
+  801007:	6a 0c                	push   $0xc
+  801009:	68 bf 31 80 00       	push   $0x8031bf
+  80100e:	6a 23                	push   $0x23
+  801010:	68 dc 31 80 00       	push   $0x8031dc
+  801015:	e8 18 f3 ff ff       	call   800332 <_panic>
+
+0080101a <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  80101a:	55                   	push   %ebp
+  80101b:	89 e5                	mov    %esp,%ebp
+  80101d:	57                   	push   %edi
+  80101e:	56                   	push   %esi
+  80101f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801020:	be 00 00 00 00       	mov    $0x0,%esi
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+  801028:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801030:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801033:	89 f7                	mov    %esi,%edi
+  801035:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+
+0080103c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80103c:	55                   	push   %ebp
+  80103d:	89 e5                	mov    %esp,%ebp
+  80103f:	57                   	push   %edi
+  801040:	56                   	push   %esi
+  801041:	53                   	push   %ebx
+  801042:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801045:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801050:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801055:	89 df                	mov    %ebx,%edi
+  801057:	89 de                	mov    %ebx,%esi
+  801059:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105b:	85 c0                	test   %eax,%eax
+  80105d:	7f 08                	jg     801067 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80105f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801062:	5b                   	pop    %ebx
+  801063:	5e                   	pop    %esi
+  801064:	5f                   	pop    %edi
+  801065:	5d                   	pop    %ebp
+  801066:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801067:	83 ec 0c             	sub    $0xc,%esp
+  80106a:	50                   	push   %eax
+  80106b:	6a 0f                	push   $0xf
+  80106d:	68 bf 31 80 00       	push   $0x8031bf
+  801072:	6a 23                	push   $0x23
+  801074:	68 dc 31 80 00       	push   $0x8031dc
+  801079:	e8 b4 f2 ff ff       	call   800332 <_panic>
+
+0080107e <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80107e:	55                   	push   %ebp
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	57                   	push   %edi
+  801082:	56                   	push   %esi
+  801083:	53                   	push   %ebx
+  801084:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801087:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801092:	b8 10 00 00 00       	mov    $0x10,%eax
+  801097:	89 df                	mov    %ebx,%edi
+  801099:	89 de                	mov    %ebx,%esi
+  80109b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80109d:	85 c0                	test   %eax,%eax
+  80109f:	7f 08                	jg     8010a9 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  8010a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a4:	5b                   	pop    %ebx
+  8010a5:	5e                   	pop    %esi
+  8010a6:	5f                   	pop    %edi
+  8010a7:	5d                   	pop    %ebp
+  8010a8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a9:	83 ec 0c             	sub    $0xc,%esp
+  8010ac:	50                   	push   %eax
+  8010ad:	6a 10                	push   $0x10
+  8010af:	68 bf 31 80 00       	push   $0x8031bf
+  8010b4:	6a 23                	push   $0x23
+  8010b6:	68 dc 31 80 00       	push   $0x8031dc
+  8010bb:	e8 72 f2 ff ff       	call   800332 <_panic>
+
+008010c0 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	56                   	push   %esi
+  8010c5:	53                   	push   %ebx
+  8010c6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d4:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010d9:	89 df                	mov    %ebx,%edi
+  8010db:	89 de                	mov    %ebx,%esi
+  8010dd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010df:	85 c0                	test   %eax,%eax
+  8010e1:	7f 08                	jg     8010eb <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  8010e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e6:	5b                   	pop    %ebx
+  8010e7:	5e                   	pop    %esi
+  8010e8:	5f                   	pop    %edi
+  8010e9:	5d                   	pop    %ebp
+  8010ea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010eb:	83 ec 0c             	sub    $0xc,%esp
+  8010ee:	50                   	push   %eax
+  8010ef:	6a 11                	push   $0x11
+  8010f1:	68 bf 31 80 00       	push   $0x8031bf
+  8010f6:	6a 23                	push   $0x23
+  8010f8:	68 dc 31 80 00       	push   $0x8031dc
+  8010fd:	e8 30 f2 ff ff       	call   800332 <_panic>
+
+00801102 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	57                   	push   %edi
+  801106:	56                   	push   %esi
+  801107:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801108:	ba 00 00 00 00       	mov    $0x0,%edx
+  80110d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801112:	89 d1                	mov    %edx,%ecx
+  801114:	89 d3                	mov    %edx,%ebx
+  801116:	89 d7                	mov    %edx,%edi
+  801118:	89 d6                	mov    %edx,%esi
+  80111a:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  80111c:	5b                   	pop    %ebx
+  80111d:	5e                   	pop    %esi
+  80111e:	5f                   	pop    %edi
+  80111f:	5d                   	pop    %ebp
+  801120:	c3                   	ret
+
+00801121 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801121:	55                   	push   %ebp
+  801122:	89 e5                	mov    %esp,%ebp
+  801124:	57                   	push   %edi
+  801125:	56                   	push   %esi
+  801126:	53                   	push   %ebx
+  801127:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80112a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801132:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801135:	b8 13 00 00 00       	mov    $0x13,%eax
+  80113a:	89 df                	mov    %ebx,%edi
+  80113c:	89 de                	mov    %ebx,%esi
+  80113e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801140:	85 c0                	test   %eax,%eax
+  801142:	7f 08                	jg     80114c <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801144:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801147:	5b                   	pop    %ebx
+  801148:	5e                   	pop    %esi
+  801149:	5f                   	pop    %edi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114c:	83 ec 0c             	sub    $0xc,%esp
+  80114f:	50                   	push   %eax
+  801150:	6a 13                	push   $0x13
+  801152:	68 bf 31 80 00       	push   $0x8031bf
+  801157:	6a 23                	push   $0x23
+  801159:	68 dc 31 80 00       	push   $0x8031dc
+  80115e:	e8 cf f1 ff ff       	call   800332 <_panic>
+
+00801163 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801163:	55                   	push   %ebp
+  801164:	89 e5                	mov    %esp,%ebp
+  801166:	57                   	push   %edi
+  801167:	56                   	push   %esi
+  801168:	53                   	push   %ebx
+  801169:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80116c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801171:	8b 55 08             	mov    0x8(%ebp),%edx
+  801174:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801177:	b8 14 00 00 00       	mov    $0x14,%eax
+  80117c:	89 df                	mov    %ebx,%edi
+  80117e:	89 de                	mov    %ebx,%esi
+  801180:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801182:	85 c0                	test   %eax,%eax
+  801184:	7f 08                	jg     80118e <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801186:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801189:	5b                   	pop    %ebx
+  80118a:	5e                   	pop    %esi
+  80118b:	5f                   	pop    %edi
+  80118c:	5d                   	pop    %ebp
+  80118d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118e:	83 ec 0c             	sub    $0xc,%esp
+  801191:	50                   	push   %eax
+  801192:	6a 14                	push   $0x14
+  801194:	68 bf 31 80 00       	push   $0x8031bf
+  801199:	6a 23                	push   $0x23
+  80119b:	68 dc 31 80 00       	push   $0x8031dc
+  8011a0:	e8 8d f1 ff ff       	call   800332 <_panic>
+
+008011a5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011a5:	55                   	push   %ebp
+  8011a6:	89 e5                	mov    %esp,%ebp
+  8011a8:	57                   	push   %edi
+  8011a9:	56                   	push   %esi
+  8011aa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011be:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c1:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011c3:	5b                   	pop    %ebx
+  8011c4:	5e                   	pop    %esi
+  8011c5:	5f                   	pop    %edi
+  8011c6:	5d                   	pop    %ebp
+  8011c7:	c3                   	ret
+
+008011c8 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	57                   	push   %edi
+  8011cc:	56                   	push   %esi
+  8011cd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011e6:	5b                   	pop    %ebx
+  8011e7:	5e                   	pop    %esi
+  8011e8:	5f                   	pop    %edi
+  8011e9:	5d                   	pop    %ebp
+  8011ea:	c3                   	ret
+
+008011eb <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011eb:	55                   	push   %ebp
+  8011ec:	89 e5                	mov    %esp,%ebp
+  8011ee:	57                   	push   %edi
+  8011ef:	56                   	push   %esi
+  8011f0:	53                   	push   %ebx
+  8011f1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fc:	b8 19 00 00 00       	mov    $0x19,%eax
+  801201:	89 cb                	mov    %ecx,%ebx
+  801203:	89 cf                	mov    %ecx,%edi
+  801205:	89 ce                	mov    %ecx,%esi
+  801207:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801209:	85 c0                	test   %eax,%eax
+  80120b:	7f 08                	jg     801215 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80120d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801210:	5b                   	pop    %ebx
+  801211:	5e                   	pop    %esi
+  801212:	5f                   	pop    %edi
+  801213:	5d                   	pop    %ebp
+  801214:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801215:	83 ec 0c             	sub    $0xc,%esp
+  801218:	50                   	push   %eax
+  801219:	6a 19                	push   $0x19
+  80121b:	68 bf 31 80 00       	push   $0x8031bf
+  801220:	6a 23                	push   $0x23
+  801222:	68 dc 31 80 00       	push   $0x8031dc
+  801227:	e8 06 f1 ff ff       	call   800332 <_panic>
+
+0080122c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80122c:	55                   	push   %ebp
+  80122d:	89 e5                	mov    %esp,%ebp
+  80122f:	57                   	push   %edi
+  801230:	56                   	push   %esi
+  801231:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801232:	ba 00 00 00 00       	mov    $0x0,%edx
+  801237:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80123c:	89 d1                	mov    %edx,%ecx
+  80123e:	89 d3                	mov    %edx,%ebx
+  801240:	89 d7                	mov    %edx,%edi
+  801242:	89 d6                	mov    %edx,%esi
+  801244:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801246:	5b                   	pop    %ebx
+  801247:	5e                   	pop    %esi
+  801248:	5f                   	pop    %edi
+  801249:	5d                   	pop    %ebp
+  80124a:	c3                   	ret
+
+0080124b <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	57                   	push   %edi
+  80124f:	56                   	push   %esi
+  801250:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801251:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801256:	8b 55 08             	mov    0x8(%ebp),%edx
+  801259:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801261:	89 df                	mov    %ebx,%edi
+  801263:	89 de                	mov    %ebx,%esi
+  801265:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801267:	5b                   	pop    %ebx
+  801268:	5e                   	pop    %esi
+  801269:	5f                   	pop    %edi
+  80126a:	5d                   	pop    %ebp
+  80126b:	c3                   	ret
+
+0080126c <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  80126c:	55                   	push   %ebp
+  80126d:	89 e5                	mov    %esp,%ebp
+  80126f:	57                   	push   %edi
+  801270:	56                   	push   %esi
+  801271:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801272:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801277:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801282:	89 df                	mov    %ebx,%edi
+  801284:	89 de                	mov    %ebx,%esi
+  801286:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801288:	5b                   	pop    %ebx
+  801289:	5e                   	pop    %esi
+  80128a:	5f                   	pop    %edi
+  80128b:	5d                   	pop    %ebp
+  80128c:	c3                   	ret
+
+0080128d <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80128d:	55                   	push   %ebp
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	53                   	push   %ebx
+  801291:	83 ec 04             	sub    $0x4,%esp
+  801294:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801297:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  801299:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  80129c:	f6 c2 02             	test   $0x2,%dl
+  80129f:	74 7b                	je     80131c <pgfault+0x8f>
+  8012a1:	89 c1                	mov    %eax,%ecx
+  8012a3:	c1 e9 0c             	shr    $0xc,%ecx
+  8012a6:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8012ad:	f6 c5 08             	test   $0x8,%ch
+  8012b0:	74 6a                	je     80131c <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8012b2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012b7:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8012b9:	83 ec 04             	sub    $0x4,%esp
+  8012bc:	6a 07                	push   $0x7
+  8012be:	68 00 f0 7f 00       	push   $0x7ff000
+  8012c3:	6a 00                	push   $0x0
+  8012c5:	e8 9e fb ff ff       	call   800e68 <sys_page_alloc>
+  8012ca:	83 c4 10             	add    $0x10,%esp
+  8012cd:	85 c0                	test   %eax,%eax
+  8012cf:	78 61                	js     801332 <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  8012d1:	83 ec 04             	sub    $0x4,%esp
+  8012d4:	68 00 10 00 00       	push   $0x1000
+  8012d9:	53                   	push   %ebx
+  8012da:	68 00 f0 7f 00       	push   $0x7ff000
+  8012df:	e8 9d f8 ff ff       	call   800b81 <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  8012e4:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8012eb:	53                   	push   %ebx
+  8012ec:	6a 00                	push   $0x0
+  8012ee:	68 00 f0 7f 00       	push   $0x7ff000
+  8012f3:	6a 00                	push   $0x0
+  8012f5:	e8 f4 fb ff ff       	call   800eee <sys_page_map>
+  8012fa:	83 c4 20             	add    $0x20,%esp
+  8012fd:	85 c0                	test   %eax,%eax
+  8012ff:	78 43                	js     801344 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  801301:	83 ec 08             	sub    $0x8,%esp
+  801304:	68 00 f0 7f 00       	push   $0x7ff000
+  801309:	6a 00                	push   $0x0
+  80130b:	e8 20 fc ff ff       	call   800f30 <sys_page_unmap>
+  801310:	83 c4 10             	add    $0x10,%esp
+  801313:	85 c0                	test   %eax,%eax
+  801315:	78 3f                	js     801356 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  801317:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80131a:	c9                   	leave
+  80131b:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  80131c:	83 ec 0c             	sub    $0xc,%esp
+  80131f:	50                   	push   %eax
+  801320:	52                   	push   %edx
+  801321:	68 ea 31 80 00       	push   $0x8031ea
+  801326:	6a 19                	push   $0x19
+  801328:	68 fb 31 80 00       	push   $0x8031fb
+  80132d:	e8 00 f0 ff ff       	call   800332 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801332:	50                   	push   %eax
+  801333:	68 06 32 80 00       	push   $0x803206
+  801338:	6a 24                	push   $0x24
+  80133a:	68 fb 31 80 00       	push   $0x8031fb
+  80133f:	e8 ee ef ff ff       	call   800332 <_panic>
+		panic("sys_page_map: %e", r);
+  801344:	50                   	push   %eax
+  801345:	68 19 32 80 00       	push   $0x803219
+  80134a:	6a 29                	push   $0x29
+  80134c:	68 fb 31 80 00       	push   $0x8031fb
+  801351:	e8 dc ef ff ff       	call   800332 <_panic>
+		panic("sys_page_unmap: %e", r);
+  801356:	50                   	push   %eax
+  801357:	68 2a 32 80 00       	push   $0x80322a
+  80135c:	6a 2c                	push   $0x2c
+  80135e:	68 fb 31 80 00       	push   $0x8031fb
+  801363:	e8 ca ef ff ff       	call   800332 <_panic>
+
+00801368 <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  801368:	55                   	push   %ebp
+  801369:	89 e5                	mov    %esp,%ebp
+  80136b:	57                   	push   %edi
+  80136c:	56                   	push   %esi
+  80136d:	53                   	push   %ebx
+  80136e:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801371:	68 8d 12 80 00       	push   $0x80128d
+  801376:	e8 d4 13 00 00       	call   80274f <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  80137b:	83 c4 08             	add    $0x8,%esp
+  80137e:	6a 01                	push   $0x1
+  801380:	6a 00                	push   $0x0
+  801382:	e8 9f fa ff ff       	call   800e26 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  801387:	e8 7b fa ff ff       	call   800e07 <sys_fork_cow>
+  80138c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  80138f:	83 c4 10             	add    $0x10,%esp
+  801392:	85 c0                	test   %eax,%eax
+  801394:	74 2c                	je     8013c2 <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  801396:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  80139a:	0f 85 8b 01 00 00    	jne    80152b <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8013a0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013a5:	cd 30                	int    $0x30
+  8013a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	78 30                	js     8013de <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  8013ae:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8013b3:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8013b8:	74 36                	je     8013f0 <fork+0x88>
+  8013ba:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8013bd:	e9 99 00 00 00       	jmp    80145b <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8013c2:	e8 02 fa ff ff       	call   800dc9 <sys_getenvid>
+  8013c7:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8013cc:	c1 e0 09             	shl    $0x9,%eax
+  8013cf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8013d4:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  8013d9:	e9 4d 01 00 00       	jmp    80152b <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  8013de:	50                   	push   %eax
+  8013df:	68 3d 32 80 00       	push   $0x80323d
+  8013e4:	6a 7d                	push   $0x7d
+  8013e6:	68 fb 31 80 00       	push   $0x8031fb
+  8013eb:	e8 42 ef ff ff       	call   800332 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8013f0:	e8 d4 f9 ff ff       	call   800dc9 <sys_getenvid>
+  8013f5:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8013fa:	c1 e0 09             	shl    $0x9,%eax
+  8013fd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801402:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801407:	e9 1f 01 00 00       	jmp    80152b <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  80140c:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801413:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801416:	25 07 0e 00 00       	and    $0xe07,%eax
+  80141b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  80141e:	83 ec 0c             	sub    $0xc,%esp
+  801421:	50                   	push   %eax
+  801422:	56                   	push   %esi
+  801423:	ff 75 e4             	push   -0x1c(%ebp)
+  801426:	56                   	push   %esi
+  801427:	6a 00                	push   $0x0
+  801429:	e8 c0 fa ff ff       	call   800eee <sys_page_map>
+  80142e:	83 c4 20             	add    $0x20,%esp
+  801431:	85 c0                	test   %eax,%eax
+  801433:	0f 88 98 00 00 00    	js     8014d1 <fork+0x169>
+	if (perm & PTE_COW) {
+  801439:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801440:	0f 85 61 01 00 00    	jne    8015a7 <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801446:	83 c7 01             	add    $0x1,%edi
+  801449:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80144f:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  801455:	0f 84 88 00 00 00    	je     8014e3 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  80145b:	89 f0                	mov    %esi,%eax
+  80145d:	c1 e8 16             	shr    $0x16,%eax
+  801460:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801467:	25 81 00 00 00       	and    $0x81,%eax
+  80146c:	83 f8 01             	cmp    $0x1,%eax
+  80146f:	75 d5                	jne    801446 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  801471:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  801478:	a8 01                	test   $0x1,%al
+  80147a:	74 ca                	je     801446 <fork+0xde>
+  80147c:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  801482:	74 c2                	je     801446 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  801484:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  801486:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80148d:	f6 c4 04             	test   $0x4,%ah
+  801490:	0f 85 76 ff ff ff    	jne    80140c <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  801496:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80149d:	a8 02                	test   $0x2,%al
+  80149f:	0f 85 dc 00 00 00    	jne    801581 <fork+0x219>
+  8014a5:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8014ac:	f6 c4 08             	test   $0x8,%ah
+  8014af:	0f 85 cc 00 00 00    	jne    801581 <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8014b5:	83 ec 0c             	sub    $0xc,%esp
+  8014b8:	6a 05                	push   $0x5
+  8014ba:	56                   	push   %esi
+  8014bb:	ff 75 e4             	push   -0x1c(%ebp)
+  8014be:	56                   	push   %esi
+  8014bf:	6a 00                	push   $0x0
+  8014c1:	e8 28 fa ff ff       	call   800eee <sys_page_map>
+  8014c6:	83 c4 20             	add    $0x20,%esp
+  8014c9:	85 c0                	test   %eax,%eax
+  8014cb:	0f 89 75 ff ff ff    	jns    801446 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  8014d1:	50                   	push   %eax
+  8014d2:	68 19 32 80 00       	push   $0x803219
+  8014d7:	6a 48                	push   $0x48
+  8014d9:	68 fb 31 80 00       	push   $0x8031fb
+  8014de:	e8 4f ee ff ff       	call   800332 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  8014e3:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8014e6:	83 ec 04             	sub    $0x4,%esp
+  8014e9:	6a 07                	push   $0x7
+  8014eb:	68 00 f0 bf ee       	push   $0xeebff000
+  8014f0:	53                   	push   %ebx
+  8014f1:	e8 72 f9 ff ff       	call   800e68 <sys_page_alloc>
+  8014f6:	83 c4 10             	add    $0x10,%esp
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	78 39                	js     801536 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8014fd:	a1 08 50 80 00       	mov    0x805008,%eax
+  801502:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  801508:	83 ec 08             	sub    $0x8,%esp
+  80150b:	50                   	push   %eax
+  80150c:	53                   	push   %ebx
+  80150d:	e8 51 fc ff ff       	call   801163 <sys_env_set_pgfault_upcall>
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	85 c0                	test   %eax,%eax
+  801517:	78 36                	js     80154f <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  801519:	83 ec 08             	sub    $0x8,%esp
+  80151c:	6a 02                	push   $0x2
+  80151e:	53                   	push   %ebx
+  80151f:	e8 18 fb ff ff       	call   80103c <sys_env_set_status>
+  801524:	83 c4 10             	add    $0x10,%esp
+  801527:	85 c0                	test   %eax,%eax
+  801529:	78 3d                	js     801568 <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  80152b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80152e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801531:	5b                   	pop    %ebx
+  801532:	5e                   	pop    %esi
+  801533:	5f                   	pop    %edi
+  801534:	5d                   	pop    %ebp
+  801535:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  801536:	83 ec 0c             	sub    $0xc,%esp
+  801539:	53                   	push   %ebx
+  80153a:	50                   	push   %eax
+  80153b:	68 64 32 80 00       	push   $0x803264
+  801540:	68 92 00 00 00       	push   $0x92
+  801545:	68 fb 31 80 00       	push   $0x8031fb
+  80154a:	e8 e3 ed ff ff       	call   800332 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  80154f:	83 ec 0c             	sub    $0xc,%esp
+  801552:	53                   	push   %ebx
+  801553:	50                   	push   %eax
+  801554:	68 88 32 80 00       	push   $0x803288
+  801559:	68 95 00 00 00       	push   $0x95
+  80155e:	68 fb 31 80 00       	push   $0x8031fb
+  801563:	e8 ca ed ff ff       	call   800332 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  801568:	83 ec 0c             	sub    $0xc,%esp
+  80156b:	53                   	push   %ebx
+  80156c:	50                   	push   %eax
+  80156d:	68 b8 32 80 00       	push   $0x8032b8
+  801572:	68 98 00 00 00       	push   $0x98
+  801577:	68 fb 31 80 00       	push   $0x8031fb
+  80157c:	e8 b1 ed ff ff       	call   800332 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801581:	83 ec 0c             	sub    $0xc,%esp
+  801584:	68 05 08 00 00       	push   $0x805
+  801589:	53                   	push   %ebx
+  80158a:	ff 75 e4             	push   -0x1c(%ebp)
+  80158d:	53                   	push   %ebx
+  80158e:	6a 00                	push   $0x0
+  801590:	e8 59 f9 ff ff       	call   800eee <sys_page_map>
+  801595:	83 c4 20             	add    $0x20,%esp
+  801598:	85 c0                	test   %eax,%eax
+  80159a:	0f 88 31 ff ff ff    	js     8014d1 <fork+0x169>
+		perm |= PTE_COW;
+  8015a0:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  8015a7:	83 ec 0c             	sub    $0xc,%esp
+  8015aa:	ff 75 e0             	push   -0x20(%ebp)
+  8015ad:	53                   	push   %ebx
+  8015ae:	6a 00                	push   $0x0
+  8015b0:	53                   	push   %ebx
+  8015b1:	6a 00                	push   $0x0
+  8015b3:	e8 36 f9 ff ff       	call   800eee <sys_page_map>
+  8015b8:	83 c4 20             	add    $0x20,%esp
+  8015bb:	85 c0                	test   %eax,%eax
+  8015bd:	0f 89 83 fe ff ff    	jns    801446 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  8015c3:	50                   	push   %eax
+  8015c4:	68 19 32 80 00       	push   $0x803219
+  8015c9:	6a 4c                	push   $0x4c
+  8015cb:	68 fb 31 80 00       	push   $0x8031fb
+  8015d0:	e8 5d ed ff ff       	call   800332 <_panic>
+
+008015d5 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8015d5:	55                   	push   %ebp
+  8015d6:	89 e5                	mov    %esp,%ebp
+  8015d8:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8015db:	68 4d 32 80 00       	push   $0x80324d
+  8015e0:	68 a0 00 00 00       	push   $0xa0
+  8015e5:	68 fb 31 80 00       	push   $0x8031fb
+  8015ea:	e8 43 ed ff ff       	call   800332 <_panic>
+
+008015ef <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8015ef:	55                   	push   %ebp
+  8015f0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8015fa:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8015fd:	5d                   	pop    %ebp
+  8015fe:	c3                   	ret
+
+008015ff <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8015ff:	55                   	push   %ebp
+  801600:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801602:	8b 45 08             	mov    0x8(%ebp),%eax
+  801605:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80160a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80160f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801614:	5d                   	pop    %ebp
+  801615:	c3                   	ret
+
+00801616 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801616:	55                   	push   %ebp
+  801617:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801619:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80161e:	eb 02                	jmp    801622 <fd_alloc+0xc>
+  801620:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801622:	89 c2                	mov    %eax,%edx
+  801624:	c1 ea 16             	shr    $0x16,%edx
+  801627:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80162e:	f6 c2 01             	test   $0x1,%dl
+  801631:	74 2b                	je     80165e <fd_alloc+0x48>
+  801633:	89 c2                	mov    %eax,%edx
+  801635:	c1 ea 0c             	shr    $0xc,%edx
+  801638:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80163f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801645:	f6 c1 01             	test   $0x1,%cl
+  801648:	74 14                	je     80165e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80164a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801650:	75 ce                	jne    801620 <fd_alloc+0xa>
+  801652:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801657:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80165c:	eb 05                	jmp    801663 <fd_alloc+0x4d>
+			return 0;
+  80165e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801663:	8b 55 08             	mov    0x8(%ebp),%edx
+  801666:	89 02                	mov    %eax,(%edx)
+}
+  801668:	89 c8                	mov    %ecx,%eax
+  80166a:	5d                   	pop    %ebp
+  80166b:	c3                   	ret
+
+0080166c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80166c:	55                   	push   %ebp
+  80166d:	89 e5                	mov    %esp,%ebp
+  80166f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801672:	83 f8 1f             	cmp    $0x1f,%eax
+  801675:	77 30                	ja     8016a7 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801677:	c1 e0 0c             	shl    $0xc,%eax
+  80167a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80167f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801685:	f6 c2 01             	test   $0x1,%dl
+  801688:	74 24                	je     8016ae <fd_lookup+0x42>
+  80168a:	89 c2                	mov    %eax,%edx
+  80168c:	c1 ea 0c             	shr    $0xc,%edx
+  80168f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801696:	f6 c2 01             	test   $0x1,%dl
+  801699:	74 1a                	je     8016b5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80169b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80169e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8016a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016a5:	5d                   	pop    %ebp
+  8016a6:	c3                   	ret
+		return -E_INVAL;
+  8016a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ac:	eb f7                	jmp    8016a5 <fd_lookup+0x39>
+		return -E_INVAL;
+  8016ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016b3:	eb f0                	jmp    8016a5 <fd_lookup+0x39>
+  8016b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ba:	eb e9                	jmp    8016a5 <fd_lookup+0x39>
+
+008016bc <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8016bc:	55                   	push   %ebp
+  8016bd:	89 e5                	mov    %esp,%ebp
+  8016bf:	53                   	push   %ebx
+  8016c0:	83 ec 04             	sub    $0x4,%esp
+  8016c3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8016c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016cb:	eb 03                	jmp    8016d0 <dev_lookup+0x14>
+  8016cd:	83 c0 01             	add    $0x1,%eax
+  8016d0:	8b 1c 85 5c 33 80 00 	mov    0x80335c(,%eax,4),%ebx
+  8016d7:	85 db                	test   %ebx,%ebx
+  8016d9:	74 0b                	je     8016e6 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8016db:	39 13                	cmp    %edx,(%ebx)
+  8016dd:	75 ee                	jne    8016cd <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8016df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e4:	eb 1f                	jmp    801705 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016e6:	a1 08 50 80 00       	mov    0x805008,%eax
+  8016eb:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8016ee:	83 ec 04             	sub    $0x4,%esp
+  8016f1:	52                   	push   %edx
+  8016f2:	50                   	push   %eax
+  8016f3:	68 e0 32 80 00       	push   $0x8032e0
+  8016f8:	e8 10 ed ff ff       	call   80040d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8016fd:	83 c4 10             	add    $0x10,%esp
+  801700:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801705:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801708:	89 1a                	mov    %ebx,(%edx)
+}
+  80170a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80170d:	c9                   	leave
+  80170e:	c3                   	ret
+
+0080170f <fd_close>:
+{
+  80170f:	55                   	push   %ebp
+  801710:	89 e5                	mov    %esp,%ebp
+  801712:	57                   	push   %edi
+  801713:	56                   	push   %esi
+  801714:	53                   	push   %ebx
+  801715:	83 ec 24             	sub    $0x24,%esp
+  801718:	8b 75 08             	mov    0x8(%ebp),%esi
+  80171b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80171e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801721:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801722:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801728:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80172b:	50                   	push   %eax
+  80172c:	e8 3b ff ff ff       	call   80166c <fd_lookup>
+  801731:	89 c3                	mov    %eax,%ebx
+  801733:	83 c4 10             	add    $0x10,%esp
+  801736:	85 c0                	test   %eax,%eax
+  801738:	78 05                	js     80173f <fd_close+0x30>
+	    || fd != fd2)
+  80173a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80173d:	74 16                	je     801755 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80173f:	89 f8                	mov    %edi,%eax
+  801741:	84 c0                	test   %al,%al
+  801743:	b8 00 00 00 00       	mov    $0x0,%eax
+  801748:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80174b:	89 d8                	mov    %ebx,%eax
+  80174d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801750:	5b                   	pop    %ebx
+  801751:	5e                   	pop    %esi
+  801752:	5f                   	pop    %edi
+  801753:	5d                   	pop    %ebp
+  801754:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801755:	83 ec 08             	sub    $0x8,%esp
+  801758:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80175b:	50                   	push   %eax
+  80175c:	ff 36                	push   (%esi)
+  80175e:	e8 59 ff ff ff       	call   8016bc <dev_lookup>
+  801763:	89 c3                	mov    %eax,%ebx
+  801765:	83 c4 10             	add    $0x10,%esp
+  801768:	85 c0                	test   %eax,%eax
+  80176a:	78 1a                	js     801786 <fd_close+0x77>
+		if (dev->dev_close)
+  80176c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80176f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801772:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801777:	85 c0                	test   %eax,%eax
+  801779:	74 0b                	je     801786 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80177b:	83 ec 0c             	sub    $0xc,%esp
+  80177e:	56                   	push   %esi
+  80177f:	ff d0                	call   *%eax
+  801781:	89 c3                	mov    %eax,%ebx
+  801783:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801786:	83 ec 08             	sub    $0x8,%esp
+  801789:	56                   	push   %esi
+  80178a:	6a 00                	push   $0x0
+  80178c:	e8 9f f7 ff ff       	call   800f30 <sys_page_unmap>
+	return r;
+  801791:	83 c4 10             	add    $0x10,%esp
+  801794:	eb b5                	jmp    80174b <fd_close+0x3c>
+
+00801796 <close>:
+
+int
+close(int fdnum)
+{
+  801796:	55                   	push   %ebp
+  801797:	89 e5                	mov    %esp,%ebp
+  801799:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80179c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80179f:	50                   	push   %eax
+  8017a0:	ff 75 08             	push   0x8(%ebp)
+  8017a3:	e8 c4 fe ff ff       	call   80166c <fd_lookup>
+  8017a8:	83 c4 10             	add    $0x10,%esp
+  8017ab:	85 c0                	test   %eax,%eax
+  8017ad:	79 02                	jns    8017b1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8017af:	c9                   	leave
+  8017b0:	c3                   	ret
+		return fd_close(fd, 1);
+  8017b1:	83 ec 08             	sub    $0x8,%esp
+  8017b4:	6a 01                	push   $0x1
+  8017b6:	ff 75 f4             	push   -0xc(%ebp)
+  8017b9:	e8 51 ff ff ff       	call   80170f <fd_close>
+  8017be:	83 c4 10             	add    $0x10,%esp
+  8017c1:	eb ec                	jmp    8017af <close+0x19>
+
+008017c3 <close_all>:
+
+void
+close_all(void)
+{
+  8017c3:	55                   	push   %ebp
+  8017c4:	89 e5                	mov    %esp,%ebp
+  8017c6:	53                   	push   %ebx
+  8017c7:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8017ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8017cf:	83 ec 0c             	sub    $0xc,%esp
+  8017d2:	53                   	push   %ebx
+  8017d3:	e8 be ff ff ff       	call   801796 <close>
+	for (i = 0; i < MAXFD; i++)
+  8017d8:	83 c3 01             	add    $0x1,%ebx
+  8017db:	83 c4 10             	add    $0x10,%esp
+  8017de:	83 fb 20             	cmp    $0x20,%ebx
+  8017e1:	75 ec                	jne    8017cf <close_all+0xc>
+}
+  8017e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017e6:	c9                   	leave
+  8017e7:	c3                   	ret
+
+008017e8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	57                   	push   %edi
+  8017ec:	56                   	push   %esi
+  8017ed:	53                   	push   %ebx
+  8017ee:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8017f1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017f4:	50                   	push   %eax
+  8017f5:	ff 75 08             	push   0x8(%ebp)
+  8017f8:	e8 6f fe ff ff       	call   80166c <fd_lookup>
+  8017fd:	89 c3                	mov    %eax,%ebx
+  8017ff:	83 c4 10             	add    $0x10,%esp
+  801802:	85 c0                	test   %eax,%eax
+  801804:	78 7f                	js     801885 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801806:	83 ec 0c             	sub    $0xc,%esp
+  801809:	ff 75 0c             	push   0xc(%ebp)
+  80180c:	e8 85 ff ff ff       	call   801796 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801811:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801814:	c1 e6 0c             	shl    $0xc,%esi
+  801817:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80181d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801820:	89 3c 24             	mov    %edi,(%esp)
+  801823:	e8 d7 fd ff ff       	call   8015ff <fd2data>
+  801828:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80182a:	89 34 24             	mov    %esi,(%esp)
+  80182d:	e8 cd fd ff ff       	call   8015ff <fd2data>
+  801832:	83 c4 10             	add    $0x10,%esp
+  801835:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801838:	89 d8                	mov    %ebx,%eax
+  80183a:	c1 e8 16             	shr    $0x16,%eax
+  80183d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801844:	a8 01                	test   $0x1,%al
+  801846:	74 11                	je     801859 <dup+0x71>
+  801848:	89 d8                	mov    %ebx,%eax
+  80184a:	c1 e8 0c             	shr    $0xc,%eax
+  80184d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801854:	f6 c2 01             	test   $0x1,%dl
+  801857:	75 36                	jne    80188f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801859:	89 f8                	mov    %edi,%eax
+  80185b:	c1 e8 0c             	shr    $0xc,%eax
+  80185e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801865:	83 ec 0c             	sub    $0xc,%esp
+  801868:	25 07 0e 00 00       	and    $0xe07,%eax
+  80186d:	50                   	push   %eax
+  80186e:	56                   	push   %esi
+  80186f:	6a 00                	push   $0x0
+  801871:	57                   	push   %edi
+  801872:	6a 00                	push   $0x0
+  801874:	e8 75 f6 ff ff       	call   800eee <sys_page_map>
+  801879:	89 c3                	mov    %eax,%ebx
+  80187b:	83 c4 20             	add    $0x20,%esp
+  80187e:	85 c0                	test   %eax,%eax
+  801880:	78 33                	js     8018b5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801882:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801885:	89 d8                	mov    %ebx,%eax
+  801887:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80188a:	5b                   	pop    %ebx
+  80188b:	5e                   	pop    %esi
+  80188c:	5f                   	pop    %edi
+  80188d:	5d                   	pop    %ebp
+  80188e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80188f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801896:	83 ec 0c             	sub    $0xc,%esp
+  801899:	25 07 0e 00 00       	and    $0xe07,%eax
+  80189e:	50                   	push   %eax
+  80189f:	ff 75 d4             	push   -0x2c(%ebp)
+  8018a2:	6a 00                	push   $0x0
+  8018a4:	53                   	push   %ebx
+  8018a5:	6a 00                	push   $0x0
+  8018a7:	e8 42 f6 ff ff       	call   800eee <sys_page_map>
+  8018ac:	89 c3                	mov    %eax,%ebx
+  8018ae:	83 c4 20             	add    $0x20,%esp
+  8018b1:	85 c0                	test   %eax,%eax
+  8018b3:	79 a4                	jns    801859 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8018b5:	83 ec 08             	sub    $0x8,%esp
+  8018b8:	56                   	push   %esi
+  8018b9:	6a 00                	push   $0x0
+  8018bb:	e8 70 f6 ff ff       	call   800f30 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8018c0:	83 c4 08             	add    $0x8,%esp
+  8018c3:	ff 75 d4             	push   -0x2c(%ebp)
+  8018c6:	6a 00                	push   $0x0
+  8018c8:	e8 63 f6 ff ff       	call   800f30 <sys_page_unmap>
+	return r;
+  8018cd:	83 c4 10             	add    $0x10,%esp
+  8018d0:	eb b3                	jmp    801885 <dup+0x9d>
+
+008018d2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8018d2:	55                   	push   %ebp
+  8018d3:	89 e5                	mov    %esp,%ebp
+  8018d5:	56                   	push   %esi
+  8018d6:	53                   	push   %ebx
+  8018d7:	83 ec 18             	sub    $0x18,%esp
+  8018da:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018dd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018e0:	50                   	push   %eax
+  8018e1:	56                   	push   %esi
+  8018e2:	e8 85 fd ff ff       	call   80166c <fd_lookup>
+  8018e7:	83 c4 10             	add    $0x10,%esp
+  8018ea:	85 c0                	test   %eax,%eax
+  8018ec:	78 3c                	js     80192a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018ee:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018f1:	83 ec 08             	sub    $0x8,%esp
+  8018f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018f7:	50                   	push   %eax
+  8018f8:	ff 33                	push   (%ebx)
+  8018fa:	e8 bd fd ff ff       	call   8016bc <dev_lookup>
+  8018ff:	83 c4 10             	add    $0x10,%esp
+  801902:	85 c0                	test   %eax,%eax
+  801904:	78 24                	js     80192a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801906:	8b 43 08             	mov    0x8(%ebx),%eax
+  801909:	83 e0 03             	and    $0x3,%eax
+  80190c:	83 f8 01             	cmp    $0x1,%eax
+  80190f:	74 20                	je     801931 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801911:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801914:	8b 40 08             	mov    0x8(%eax),%eax
+  801917:	85 c0                	test   %eax,%eax
+  801919:	74 37                	je     801952 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80191b:	83 ec 04             	sub    $0x4,%esp
+  80191e:	ff 75 10             	push   0x10(%ebp)
+  801921:	ff 75 0c             	push   0xc(%ebp)
+  801924:	53                   	push   %ebx
+  801925:	ff d0                	call   *%eax
+  801927:	83 c4 10             	add    $0x10,%esp
+}
+  80192a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80192d:	5b                   	pop    %ebx
+  80192e:	5e                   	pop    %esi
+  80192f:	5d                   	pop    %ebp
+  801930:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801931:	a1 08 50 80 00       	mov    0x805008,%eax
+  801936:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801939:	83 ec 04             	sub    $0x4,%esp
+  80193c:	56                   	push   %esi
+  80193d:	50                   	push   %eax
+  80193e:	68 21 33 80 00       	push   $0x803321
+  801943:	e8 c5 ea ff ff       	call   80040d <cprintf>
+		return -E_INVAL;
+  801948:	83 c4 10             	add    $0x10,%esp
+  80194b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801950:	eb d8                	jmp    80192a <read+0x58>
+		return -E_NOT_SUPP;
+  801952:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801957:	eb d1                	jmp    80192a <read+0x58>
+
+00801959 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801959:	55                   	push   %ebp
+  80195a:	89 e5                	mov    %esp,%ebp
+  80195c:	57                   	push   %edi
+  80195d:	56                   	push   %esi
+  80195e:	53                   	push   %ebx
+  80195f:	83 ec 0c             	sub    $0xc,%esp
+  801962:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801965:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801968:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196d:	eb 02                	jmp    801971 <readn+0x18>
+  80196f:	01 c3                	add    %eax,%ebx
+  801971:	39 f3                	cmp    %esi,%ebx
+  801973:	73 21                	jae    801996 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801975:	83 ec 04             	sub    $0x4,%esp
+  801978:	89 f0                	mov    %esi,%eax
+  80197a:	29 d8                	sub    %ebx,%eax
+  80197c:	50                   	push   %eax
+  80197d:	89 d8                	mov    %ebx,%eax
+  80197f:	03 45 0c             	add    0xc(%ebp),%eax
+  801982:	50                   	push   %eax
+  801983:	57                   	push   %edi
+  801984:	e8 49 ff ff ff       	call   8018d2 <read>
+		if (m < 0)
+  801989:	83 c4 10             	add    $0x10,%esp
+  80198c:	85 c0                	test   %eax,%eax
+  80198e:	78 04                	js     801994 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801990:	75 dd                	jne    80196f <readn+0x16>
+  801992:	eb 02                	jmp    801996 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801994:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801996:	89 d8                	mov    %ebx,%eax
+  801998:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80199b:	5b                   	pop    %ebx
+  80199c:	5e                   	pop    %esi
+  80199d:	5f                   	pop    %edi
+  80199e:	5d                   	pop    %ebp
+  80199f:	c3                   	ret
+
+008019a0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8019a0:	55                   	push   %ebp
+  8019a1:	89 e5                	mov    %esp,%ebp
+  8019a3:	56                   	push   %esi
+  8019a4:	53                   	push   %ebx
+  8019a5:	83 ec 18             	sub    $0x18,%esp
+  8019a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019ab:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019ae:	50                   	push   %eax
+  8019af:	53                   	push   %ebx
+  8019b0:	e8 b7 fc ff ff       	call   80166c <fd_lookup>
+  8019b5:	83 c4 10             	add    $0x10,%esp
+  8019b8:	85 c0                	test   %eax,%eax
+  8019ba:	78 37                	js     8019f3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019bc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019bf:	83 ec 08             	sub    $0x8,%esp
+  8019c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019c5:	50                   	push   %eax
+  8019c6:	ff 36                	push   (%esi)
+  8019c8:	e8 ef fc ff ff       	call   8016bc <dev_lookup>
+  8019cd:	83 c4 10             	add    $0x10,%esp
+  8019d0:	85 c0                	test   %eax,%eax
+  8019d2:	78 1f                	js     8019f3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019d4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019d8:	74 20                	je     8019fa <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8019da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019dd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019e0:	85 c0                	test   %eax,%eax
+  8019e2:	74 37                	je     801a1b <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8019e4:	83 ec 04             	sub    $0x4,%esp
+  8019e7:	ff 75 10             	push   0x10(%ebp)
+  8019ea:	ff 75 0c             	push   0xc(%ebp)
+  8019ed:	56                   	push   %esi
+  8019ee:	ff d0                	call   *%eax
+  8019f0:	83 c4 10             	add    $0x10,%esp
+}
+  8019f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019f6:	5b                   	pop    %ebx
+  8019f7:	5e                   	pop    %esi
+  8019f8:	5d                   	pop    %ebp
+  8019f9:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019fa:	a1 08 50 80 00       	mov    0x805008,%eax
+  8019ff:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801a02:	83 ec 04             	sub    $0x4,%esp
+  801a05:	53                   	push   %ebx
+  801a06:	50                   	push   %eax
+  801a07:	68 3d 33 80 00       	push   $0x80333d
+  801a0c:	e8 fc e9 ff ff       	call   80040d <cprintf>
+		return -E_INVAL;
+  801a11:	83 c4 10             	add    $0x10,%esp
+  801a14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a19:	eb d8                	jmp    8019f3 <write+0x53>
+		return -E_NOT_SUPP;
+  801a1b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a20:	eb d1                	jmp    8019f3 <write+0x53>
+
+00801a22 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a22:	55                   	push   %ebp
+  801a23:	89 e5                	mov    %esp,%ebp
+  801a25:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a2b:	50                   	push   %eax
+  801a2c:	ff 75 08             	push   0x8(%ebp)
+  801a2f:	e8 38 fc ff ff       	call   80166c <fd_lookup>
+  801a34:	83 c4 10             	add    $0x10,%esp
+  801a37:	85 c0                	test   %eax,%eax
+  801a39:	78 0e                	js     801a49 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801a3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a41:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801a44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a49:	c9                   	leave
+  801a4a:	c3                   	ret
+
+00801a4b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a4b:	55                   	push   %ebp
+  801a4c:	89 e5                	mov    %esp,%ebp
+  801a4e:	56                   	push   %esi
+  801a4f:	53                   	push   %ebx
+  801a50:	83 ec 18             	sub    $0x18,%esp
+  801a53:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a56:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a59:	50                   	push   %eax
+  801a5a:	53                   	push   %ebx
+  801a5b:	e8 0c fc ff ff       	call   80166c <fd_lookup>
+  801a60:	83 c4 10             	add    $0x10,%esp
+  801a63:	85 c0                	test   %eax,%eax
+  801a65:	78 34                	js     801a9b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a67:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a6a:	83 ec 08             	sub    $0x8,%esp
+  801a6d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a70:	50                   	push   %eax
+  801a71:	ff 36                	push   (%esi)
+  801a73:	e8 44 fc ff ff       	call   8016bc <dev_lookup>
+  801a78:	83 c4 10             	add    $0x10,%esp
+  801a7b:	85 c0                	test   %eax,%eax
+  801a7d:	78 1c                	js     801a9b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a7f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a83:	74 1d                	je     801aa2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a88:	8b 40 18             	mov    0x18(%eax),%eax
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	74 34                	je     801ac3 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+  801a92:	ff 75 0c             	push   0xc(%ebp)
+  801a95:	56                   	push   %esi
+  801a96:	ff d0                	call   *%eax
+  801a98:	83 c4 10             	add    $0x10,%esp
+}
+  801a9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a9e:	5b                   	pop    %ebx
+  801a9f:	5e                   	pop    %esi
+  801aa0:	5d                   	pop    %ebp
+  801aa1:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801aa2:	a1 08 50 80 00       	mov    0x805008,%eax
+  801aa7:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801aaa:	83 ec 04             	sub    $0x4,%esp
+  801aad:	53                   	push   %ebx
+  801aae:	50                   	push   %eax
+  801aaf:	68 00 33 80 00       	push   $0x803300
+  801ab4:	e8 54 e9 ff ff       	call   80040d <cprintf>
+		return -E_INVAL;
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ac1:	eb d8                	jmp    801a9b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ac3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ac8:	eb d1                	jmp    801a9b <ftruncate+0x50>
+
+00801aca <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801aca:	55                   	push   %ebp
+  801acb:	89 e5                	mov    %esp,%ebp
+  801acd:	56                   	push   %esi
+  801ace:	53                   	push   %ebx
+  801acf:	83 ec 18             	sub    $0x18,%esp
+  801ad2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ad5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ad8:	50                   	push   %eax
+  801ad9:	ff 75 08             	push   0x8(%ebp)
+  801adc:	e8 8b fb ff ff       	call   80166c <fd_lookup>
+  801ae1:	83 c4 10             	add    $0x10,%esp
+  801ae4:	85 c0                	test   %eax,%eax
+  801ae6:	78 49                	js     801b31 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ae8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801aeb:	83 ec 08             	sub    $0x8,%esp
+  801aee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af1:	50                   	push   %eax
+  801af2:	ff 36                	push   (%esi)
+  801af4:	e8 c3 fb ff ff       	call   8016bc <dev_lookup>
+  801af9:	83 c4 10             	add    $0x10,%esp
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	78 31                	js     801b31 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801b00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b03:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b07:	74 2f                	je     801b38 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801b09:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801b0c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b13:	00 00 00 
+	stat->st_isdir = 0;
+  801b16:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b1d:	00 00 00 
+	stat->st_dev = dev;
+  801b20:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801b26:	83 ec 08             	sub    $0x8,%esp
+  801b29:	53                   	push   %ebx
+  801b2a:	56                   	push   %esi
+  801b2b:	ff 50 14             	call   *0x14(%eax)
+  801b2e:	83 c4 10             	add    $0x10,%esp
+}
+  801b31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b34:	5b                   	pop    %ebx
+  801b35:	5e                   	pop    %esi
+  801b36:	5d                   	pop    %ebp
+  801b37:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b38:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b3d:	eb f2                	jmp    801b31 <fstat+0x67>
+
+00801b3f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b3f:	55                   	push   %ebp
+  801b40:	89 e5                	mov    %esp,%ebp
+  801b42:	56                   	push   %esi
+  801b43:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801b44:	83 ec 08             	sub    $0x8,%esp
+  801b47:	6a 00                	push   $0x0
+  801b49:	ff 75 08             	push   0x8(%ebp)
+  801b4c:	e8 e4 01 00 00       	call   801d35 <open>
+  801b51:	89 c3                	mov    %eax,%ebx
+  801b53:	83 c4 10             	add    $0x10,%esp
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	78 1b                	js     801b75 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801b5a:	83 ec 08             	sub    $0x8,%esp
+  801b5d:	ff 75 0c             	push   0xc(%ebp)
+  801b60:	50                   	push   %eax
+  801b61:	e8 64 ff ff ff       	call   801aca <fstat>
+  801b66:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b68:	89 1c 24             	mov    %ebx,(%esp)
+  801b6b:	e8 26 fc ff ff       	call   801796 <close>
+	return r;
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	89 f3                	mov    %esi,%ebx
+}
+  801b75:	89 d8                	mov    %ebx,%eax
+  801b77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b7a:	5b                   	pop    %ebx
+  801b7b:	5e                   	pop    %esi
+  801b7c:	5d                   	pop    %ebp
+  801b7d:	c3                   	ret
+
+00801b7e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b7e:	55                   	push   %ebp
+  801b7f:	89 e5                	mov    %esp,%ebp
+  801b81:	56                   	push   %esi
+  801b82:	53                   	push   %ebx
+  801b83:	89 c6                	mov    %eax,%esi
+  801b85:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801b87:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801b8e:	74 27                	je     801bb7 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b90:	6a 07                	push   $0x7
+  801b92:	68 00 60 80 00       	push   $0x806000
+  801b97:	56                   	push   %esi
+  801b98:	ff 35 00 50 80 00    	push   0x805000
+  801b9e:	e8 b5 0c 00 00       	call   802858 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ba3:	83 c4 0c             	add    $0xc,%esp
+  801ba6:	6a 00                	push   $0x0
+  801ba8:	53                   	push   %ebx
+  801ba9:	6a 00                	push   $0x0
+  801bab:	e8 30 0c 00 00       	call   8027e0 <ipc_recv>
+}
+  801bb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb3:	5b                   	pop    %ebx
+  801bb4:	5e                   	pop    %esi
+  801bb5:	5d                   	pop    %ebp
+  801bb6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bb7:	83 ec 0c             	sub    $0xc,%esp
+  801bba:	6a 01                	push   $0x1
+  801bbc:	e8 eb 0c 00 00       	call   8028ac <ipc_find_env>
+  801bc1:	a3 00 50 80 00       	mov    %eax,0x805000
+  801bc6:	83 c4 10             	add    $0x10,%esp
+  801bc9:	eb c5                	jmp    801b90 <fsipc+0x12>
+
+00801bcb <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801bcb:	55                   	push   %ebp
+  801bcc:	89 e5                	mov    %esp,%ebp
+  801bce:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801bd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bd7:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801bdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bdf:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801be4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be9:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bee:	e8 8b ff ff ff       	call   801b7e <fsipc>
+}
+  801bf3:	c9                   	leave
+  801bf4:	c3                   	ret
+
+00801bf5 <devfile_flush>:
+{
+  801bf5:	55                   	push   %ebp
+  801bf6:	89 e5                	mov    %esp,%ebp
+  801bf8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801bfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bfe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c01:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801c06:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c10:	e8 69 ff ff ff       	call   801b7e <fsipc>
+}
+  801c15:	c9                   	leave
+  801c16:	c3                   	ret
+
+00801c17 <devfile_stat>:
+{
+  801c17:	55                   	push   %ebp
+  801c18:	89 e5                	mov    %esp,%ebp
+  801c1a:	53                   	push   %ebx
+  801c1b:	83 ec 04             	sub    $0x4,%esp
+  801c1e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c21:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c24:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c27:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c31:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c36:	e8 43 ff ff ff       	call   801b7e <fsipc>
+  801c3b:	85 c0                	test   %eax,%eax
+  801c3d:	78 2c                	js     801c6b <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c3f:	83 ec 08             	sub    $0x8,%esp
+  801c42:	68 00 60 80 00       	push   $0x806000
+  801c47:	53                   	push   %ebx
+  801c48:	e8 ae ed ff ff       	call   8009fb <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801c4d:	a1 80 60 80 00       	mov    0x806080,%eax
+  801c52:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c58:	a1 84 60 80 00       	mov    0x806084,%eax
+  801c5d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801c63:	83 c4 10             	add    $0x10,%esp
+  801c66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c6e:	c9                   	leave
+  801c6f:	c3                   	ret
+
+00801c70 <devfile_write>:
+{
+  801c70:	55                   	push   %ebp
+  801c71:	89 e5                	mov    %esp,%ebp
+  801c73:	83 ec 0c             	sub    $0xc,%esp
+  801c76:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801c79:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801c7e:	39 d0                	cmp    %edx,%eax
+  801c80:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c83:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c86:	8b 52 0c             	mov    0xc(%edx),%edx
+  801c89:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801c8f:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801c94:	50                   	push   %eax
+  801c95:	ff 75 0c             	push   0xc(%ebp)
+  801c98:	68 08 60 80 00       	push   $0x806008
+  801c9d:	e8 df ee ff ff       	call   800b81 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801ca2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca7:	b8 04 00 00 00       	mov    $0x4,%eax
+  801cac:	e8 cd fe ff ff       	call   801b7e <fsipc>
+}
+  801cb1:	c9                   	leave
+  801cb2:	c3                   	ret
+
+00801cb3 <devfile_read>:
+{
+  801cb3:	55                   	push   %ebp
+  801cb4:	89 e5                	mov    %esp,%ebp
+  801cb6:	56                   	push   %esi
+  801cb7:	53                   	push   %ebx
+  801cb8:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801cbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cc1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801cc6:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd1:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cd6:	e8 a3 fe ff ff       	call   801b7e <fsipc>
+  801cdb:	89 c3                	mov    %eax,%ebx
+  801cdd:	85 c0                	test   %eax,%eax
+  801cdf:	78 1f                	js     801d00 <devfile_read+0x4d>
+	assert(r <= n);
+  801ce1:	39 c6                	cmp    %eax,%esi
+  801ce3:	72 24                	jb     801d09 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801ce5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801cea:	7f 33                	jg     801d1f <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801cec:	83 ec 04             	sub    $0x4,%esp
+  801cef:	50                   	push   %eax
+  801cf0:	68 00 60 80 00       	push   $0x806000
+  801cf5:	ff 75 0c             	push   0xc(%ebp)
+  801cf8:	e8 84 ee ff ff       	call   800b81 <memmove>
+	return r;
+  801cfd:	83 c4 10             	add    $0x10,%esp
+}
+  801d00:	89 d8                	mov    %ebx,%eax
+  801d02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d05:	5b                   	pop    %ebx
+  801d06:	5e                   	pop    %esi
+  801d07:	5d                   	pop    %ebp
+  801d08:	c3                   	ret
+	assert(r <= n);
+  801d09:	68 70 33 80 00       	push   $0x803370
+  801d0e:	68 77 33 80 00       	push   $0x803377
+  801d13:	6a 7c                	push   $0x7c
+  801d15:	68 8c 33 80 00       	push   $0x80338c
+  801d1a:	e8 13 e6 ff ff       	call   800332 <_panic>
+	assert(r <= PGSIZE);
+  801d1f:	68 97 33 80 00       	push   $0x803397
+  801d24:	68 77 33 80 00       	push   $0x803377
+  801d29:	6a 7d                	push   $0x7d
+  801d2b:	68 8c 33 80 00       	push   $0x80338c
+  801d30:	e8 fd e5 ff ff       	call   800332 <_panic>
+
+00801d35 <open>:
+{
+  801d35:	55                   	push   %ebp
+  801d36:	89 e5                	mov    %esp,%ebp
+  801d38:	56                   	push   %esi
+  801d39:	53                   	push   %ebx
+  801d3a:	83 ec 1c             	sub    $0x1c,%esp
+  801d3d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801d40:	56                   	push   %esi
+  801d41:	e8 7a ec ff ff       	call   8009c0 <strlen>
+  801d46:	83 c4 10             	add    $0x10,%esp
+  801d49:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d4e:	7f 6c                	jg     801dbc <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d50:	83 ec 0c             	sub    $0xc,%esp
+  801d53:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d56:	50                   	push   %eax
+  801d57:	e8 ba f8 ff ff       	call   801616 <fd_alloc>
+  801d5c:	89 c3                	mov    %eax,%ebx
+  801d5e:	83 c4 10             	add    $0x10,%esp
+  801d61:	85 c0                	test   %eax,%eax
+  801d63:	78 3c                	js     801da1 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d65:	83 ec 08             	sub    $0x8,%esp
+  801d68:	56                   	push   %esi
+  801d69:	68 00 60 80 00       	push   $0x806000
+  801d6e:	e8 88 ec ff ff       	call   8009fb <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d76:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d7b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d7e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d83:	e8 f6 fd ff ff       	call   801b7e <fsipc>
+  801d88:	89 c3                	mov    %eax,%ebx
+  801d8a:	83 c4 10             	add    $0x10,%esp
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	78 19                	js     801daa <open+0x75>
+	return fd2num(fd);
+  801d91:	83 ec 0c             	sub    $0xc,%esp
+  801d94:	ff 75 f4             	push   -0xc(%ebp)
+  801d97:	e8 53 f8 ff ff       	call   8015ef <fd2num>
+  801d9c:	89 c3                	mov    %eax,%ebx
+  801d9e:	83 c4 10             	add    $0x10,%esp
+}
+  801da1:	89 d8                	mov    %ebx,%eax
+  801da3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da6:	5b                   	pop    %ebx
+  801da7:	5e                   	pop    %esi
+  801da8:	5d                   	pop    %ebp
+  801da9:	c3                   	ret
+		fd_close(fd, 0);
+  801daa:	83 ec 08             	sub    $0x8,%esp
+  801dad:	6a 00                	push   $0x0
+  801daf:	ff 75 f4             	push   -0xc(%ebp)
+  801db2:	e8 58 f9 ff ff       	call   80170f <fd_close>
+		return r;
+  801db7:	83 c4 10             	add    $0x10,%esp
+  801dba:	eb e5                	jmp    801da1 <open+0x6c>
+		return -E_BAD_PATH;
+  801dbc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801dc1:	eb de                	jmp    801da1 <open+0x6c>
+
+00801dc3 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801dc3:	55                   	push   %ebp
+  801dc4:	89 e5                	mov    %esp,%ebp
+  801dc6:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dce:	b8 08 00 00 00       	mov    $0x8,%eax
+  801dd3:	e8 a6 fd ff ff       	call   801b7e <fsipc>
+}
+  801dd8:	c9                   	leave
+  801dd9:	c3                   	ret
+
+00801dda <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801dda:	55                   	push   %ebp
+  801ddb:	89 e5                	mov    %esp,%ebp
+  801ddd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801de0:	68 a3 33 80 00       	push   $0x8033a3
+  801de5:	ff 75 0c             	push   0xc(%ebp)
+  801de8:	e8 0e ec ff ff       	call   8009fb <strcpy>
+	return 0;
+}
+  801ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df2:	c9                   	leave
+  801df3:	c3                   	ret
+
+00801df4 <devsock_close>:
+{
+  801df4:	55                   	push   %ebp
+  801df5:	89 e5                	mov    %esp,%ebp
+  801df7:	53                   	push   %ebx
+  801df8:	83 ec 10             	sub    $0x10,%esp
+  801dfb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801dfe:	53                   	push   %ebx
+  801dff:	e8 b8 0a 00 00       	call   8028bc <pageref>
+  801e04:	89 c2                	mov    %eax,%edx
+  801e06:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801e09:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801e0e:	83 fa 01             	cmp    $0x1,%edx
+  801e11:	74 05                	je     801e18 <devsock_close+0x24>
+}
+  801e13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e16:	c9                   	leave
+  801e17:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801e18:	83 ec 0c             	sub    $0xc,%esp
+  801e1b:	ff 73 0c             	push   0xc(%ebx)
+  801e1e:	e8 b7 02 00 00       	call   8020da <nsipc_close>
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	eb eb                	jmp    801e13 <devsock_close+0x1f>
+
+00801e28 <devsock_write>:
+{
+  801e28:	55                   	push   %ebp
+  801e29:	89 e5                	mov    %esp,%ebp
+  801e2b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801e2e:	6a 00                	push   $0x0
+  801e30:	ff 75 10             	push   0x10(%ebp)
+  801e33:	ff 75 0c             	push   0xc(%ebp)
+  801e36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e39:	ff 70 0c             	push   0xc(%eax)
+  801e3c:	e8 79 03 00 00       	call   8021ba <nsipc_send>
+}
+  801e41:	c9                   	leave
+  801e42:	c3                   	ret
+
+00801e43 <devsock_read>:
+{
+  801e43:	55                   	push   %ebp
+  801e44:	89 e5                	mov    %esp,%ebp
+  801e46:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801e49:	6a 00                	push   $0x0
+  801e4b:	ff 75 10             	push   0x10(%ebp)
+  801e4e:	ff 75 0c             	push   0xc(%ebp)
+  801e51:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e54:	ff 70 0c             	push   0xc(%eax)
+  801e57:	e8 ef 02 00 00       	call   80214b <nsipc_recv>
+}
+  801e5c:	c9                   	leave
+  801e5d:	c3                   	ret
+
+00801e5e <fd2sockid>:
+{
+  801e5e:	55                   	push   %ebp
+  801e5f:	89 e5                	mov    %esp,%ebp
+  801e61:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801e64:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e67:	52                   	push   %edx
+  801e68:	50                   	push   %eax
+  801e69:	e8 fe f7 ff ff       	call   80166c <fd_lookup>
+  801e6e:	83 c4 10             	add    $0x10,%esp
+  801e71:	85 c0                	test   %eax,%eax
+  801e73:	78 10                	js     801e85 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801e75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e78:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  801e7e:	39 08                	cmp    %ecx,(%eax)
+  801e80:	75 05                	jne    801e87 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801e82:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801e85:	c9                   	leave
+  801e86:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e87:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e8c:	eb f7                	jmp    801e85 <fd2sockid+0x27>
+
+00801e8e <alloc_sockfd>:
+{
+  801e8e:	55                   	push   %ebp
+  801e8f:	89 e5                	mov    %esp,%ebp
+  801e91:	56                   	push   %esi
+  801e92:	53                   	push   %ebx
+  801e93:	83 ec 1c             	sub    $0x1c,%esp
+  801e96:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801e98:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e9b:	50                   	push   %eax
+  801e9c:	e8 75 f7 ff ff       	call   801616 <fd_alloc>
+  801ea1:	89 c3                	mov    %eax,%ebx
+  801ea3:	83 c4 10             	add    $0x10,%esp
+  801ea6:	85 c0                	test   %eax,%eax
+  801ea8:	78 43                	js     801eed <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801eaa:	83 ec 04             	sub    $0x4,%esp
+  801ead:	68 07 04 00 00       	push   $0x407
+  801eb2:	ff 75 f4             	push   -0xc(%ebp)
+  801eb5:	6a 00                	push   $0x0
+  801eb7:	e8 ac ef ff ff       	call   800e68 <sys_page_alloc>
+  801ebc:	89 c3                	mov    %eax,%ebx
+  801ebe:	83 c4 10             	add    $0x10,%esp
+  801ec1:	85 c0                	test   %eax,%eax
+  801ec3:	78 28                	js     801eed <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801ec5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ec8:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  801ece:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801ed0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ed3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801eda:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801edd:	83 ec 0c             	sub    $0xc,%esp
+  801ee0:	50                   	push   %eax
+  801ee1:	e8 09 f7 ff ff       	call   8015ef <fd2num>
+  801ee6:	89 c3                	mov    %eax,%ebx
+  801ee8:	83 c4 10             	add    $0x10,%esp
+  801eeb:	eb 0c                	jmp    801ef9 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801eed:	83 ec 0c             	sub    $0xc,%esp
+  801ef0:	56                   	push   %esi
+  801ef1:	e8 e4 01 00 00       	call   8020da <nsipc_close>
+		return r;
+  801ef6:	83 c4 10             	add    $0x10,%esp
+}
+  801ef9:	89 d8                	mov    %ebx,%eax
+  801efb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801efe:	5b                   	pop    %ebx
+  801eff:	5e                   	pop    %esi
+  801f00:	5d                   	pop    %ebp
+  801f01:	c3                   	ret
+
+00801f02 <accept>:
+{
+  801f02:	55                   	push   %ebp
+  801f03:	89 e5                	mov    %esp,%ebp
+  801f05:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f08:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0b:	e8 4e ff ff ff       	call   801e5e <fd2sockid>
+  801f10:	85 c0                	test   %eax,%eax
+  801f12:	78 1b                	js     801f2f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801f14:	83 ec 04             	sub    $0x4,%esp
+  801f17:	ff 75 10             	push   0x10(%ebp)
+  801f1a:	ff 75 0c             	push   0xc(%ebp)
+  801f1d:	50                   	push   %eax
+  801f1e:	e8 0e 01 00 00       	call   802031 <nsipc_accept>
+  801f23:	83 c4 10             	add    $0x10,%esp
+  801f26:	85 c0                	test   %eax,%eax
+  801f28:	78 05                	js     801f2f <accept+0x2d>
+	return alloc_sockfd(r);
+  801f2a:	e8 5f ff ff ff       	call   801e8e <alloc_sockfd>
+}
+  801f2f:	c9                   	leave
+  801f30:	c3                   	ret
+
+00801f31 <bind>:
+{
+  801f31:	55                   	push   %ebp
+  801f32:	89 e5                	mov    %esp,%ebp
+  801f34:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3a:	e8 1f ff ff ff       	call   801e5e <fd2sockid>
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	78 12                	js     801f55 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801f43:	83 ec 04             	sub    $0x4,%esp
+  801f46:	ff 75 10             	push   0x10(%ebp)
+  801f49:	ff 75 0c             	push   0xc(%ebp)
+  801f4c:	50                   	push   %eax
+  801f4d:	e8 31 01 00 00       	call   802083 <nsipc_bind>
+  801f52:	83 c4 10             	add    $0x10,%esp
+}
+  801f55:	c9                   	leave
+  801f56:	c3                   	ret
+
+00801f57 <shutdown>:
+{
+  801f57:	55                   	push   %ebp
+  801f58:	89 e5                	mov    %esp,%ebp
+  801f5a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f60:	e8 f9 fe ff ff       	call   801e5e <fd2sockid>
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	78 0f                	js     801f78 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801f69:	83 ec 08             	sub    $0x8,%esp
+  801f6c:	ff 75 0c             	push   0xc(%ebp)
+  801f6f:	50                   	push   %eax
+  801f70:	e8 43 01 00 00       	call   8020b8 <nsipc_shutdown>
+  801f75:	83 c4 10             	add    $0x10,%esp
+}
+  801f78:	c9                   	leave
+  801f79:	c3                   	ret
+
+00801f7a <connect>:
+{
+  801f7a:	55                   	push   %ebp
+  801f7b:	89 e5                	mov    %esp,%ebp
+  801f7d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f80:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f83:	e8 d6 fe ff ff       	call   801e5e <fd2sockid>
+  801f88:	85 c0                	test   %eax,%eax
+  801f8a:	78 12                	js     801f9e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801f8c:	83 ec 04             	sub    $0x4,%esp
+  801f8f:	ff 75 10             	push   0x10(%ebp)
+  801f92:	ff 75 0c             	push   0xc(%ebp)
+  801f95:	50                   	push   %eax
+  801f96:	e8 59 01 00 00       	call   8020f4 <nsipc_connect>
+  801f9b:	83 c4 10             	add    $0x10,%esp
+}
+  801f9e:	c9                   	leave
+  801f9f:	c3                   	ret
+
+00801fa0 <listen>:
+{
+  801fa0:	55                   	push   %ebp
+  801fa1:	89 e5                	mov    %esp,%ebp
+  801fa3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa9:	e8 b0 fe ff ff       	call   801e5e <fd2sockid>
+  801fae:	85 c0                	test   %eax,%eax
+  801fb0:	78 0f                	js     801fc1 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801fb2:	83 ec 08             	sub    $0x8,%esp
+  801fb5:	ff 75 0c             	push   0xc(%ebp)
+  801fb8:	50                   	push   %eax
+  801fb9:	e8 6b 01 00 00       	call   802129 <nsipc_listen>
+  801fbe:	83 c4 10             	add    $0x10,%esp
+}
+  801fc1:	c9                   	leave
+  801fc2:	c3                   	ret
+
+00801fc3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801fc3:	55                   	push   %ebp
+  801fc4:	89 e5                	mov    %esp,%ebp
+  801fc6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801fc9:	ff 75 10             	push   0x10(%ebp)
+  801fcc:	ff 75 0c             	push   0xc(%ebp)
+  801fcf:	ff 75 08             	push   0x8(%ebp)
+  801fd2:	e8 41 02 00 00       	call   802218 <nsipc_socket>
+  801fd7:	83 c4 10             	add    $0x10,%esp
+  801fda:	85 c0                	test   %eax,%eax
+  801fdc:	78 05                	js     801fe3 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801fde:	e8 ab fe ff ff       	call   801e8e <alloc_sockfd>
+}
+  801fe3:	c9                   	leave
+  801fe4:	c3                   	ret
+
+00801fe5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801fe5:	55                   	push   %ebp
+  801fe6:	89 e5                	mov    %esp,%ebp
+  801fe8:	53                   	push   %ebx
+  801fe9:	83 ec 04             	sub    $0x4,%esp
+  801fec:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801fee:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801ff5:	74 26                	je     80201d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801ff7:	6a 07                	push   $0x7
+  801ff9:	68 00 70 80 00       	push   $0x807000
+  801ffe:	53                   	push   %ebx
+  801fff:	ff 35 04 50 80 00    	push   0x805004
+  802005:	e8 4e 08 00 00       	call   802858 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80200a:	83 c4 0c             	add    $0xc,%esp
+  80200d:	6a 00                	push   $0x0
+  80200f:	6a 00                	push   $0x0
+  802011:	6a 00                	push   $0x0
+  802013:	e8 c8 07 00 00       	call   8027e0 <ipc_recv>
+}
+  802018:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80201b:	c9                   	leave
+  80201c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80201d:	83 ec 0c             	sub    $0xc,%esp
+  802020:	6a 02                	push   $0x2
+  802022:	e8 85 08 00 00       	call   8028ac <ipc_find_env>
+  802027:	a3 04 50 80 00       	mov    %eax,0x805004
+  80202c:	83 c4 10             	add    $0x10,%esp
+  80202f:	eb c6                	jmp    801ff7 <nsipc+0x12>
+
+00802031 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802031:	55                   	push   %ebp
+  802032:	89 e5                	mov    %esp,%ebp
+  802034:	56                   	push   %esi
+  802035:	53                   	push   %ebx
+  802036:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802039:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802041:	8b 06                	mov    (%esi),%eax
+  802043:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802048:	b8 01 00 00 00       	mov    $0x1,%eax
+  80204d:	e8 93 ff ff ff       	call   801fe5 <nsipc>
+  802052:	89 c3                	mov    %eax,%ebx
+  802054:	85 c0                	test   %eax,%eax
+  802056:	79 09                	jns    802061 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802058:	89 d8                	mov    %ebx,%eax
+  80205a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80205d:	5b                   	pop    %ebx
+  80205e:	5e                   	pop    %esi
+  80205f:	5d                   	pop    %ebp
+  802060:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802061:	83 ec 04             	sub    $0x4,%esp
+  802064:	ff 35 10 70 80 00    	push   0x807010
+  80206a:	68 00 70 80 00       	push   $0x807000
+  80206f:	ff 75 0c             	push   0xc(%ebp)
+  802072:	e8 0a eb ff ff       	call   800b81 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802077:	a1 10 70 80 00       	mov    0x807010,%eax
+  80207c:	89 06                	mov    %eax,(%esi)
+  80207e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802081:	eb d5                	jmp    802058 <nsipc_accept+0x27>
+
+00802083 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802083:	55                   	push   %ebp
+  802084:	89 e5                	mov    %esp,%ebp
+  802086:	53                   	push   %ebx
+  802087:	83 ec 08             	sub    $0x8,%esp
+  80208a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80208d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802090:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802095:	53                   	push   %ebx
+  802096:	ff 75 0c             	push   0xc(%ebp)
+  802099:	68 04 70 80 00       	push   $0x807004
+  80209e:	e8 de ea ff ff       	call   800b81 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8020a3:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8020a9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020ae:	e8 32 ff ff ff       	call   801fe5 <nsipc>
+}
+  8020b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020b6:	c9                   	leave
+  8020b7:	c3                   	ret
+
+008020b8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8020b8:	55                   	push   %ebp
+  8020b9:	89 e5                	mov    %esp,%ebp
+  8020bb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8020be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8020c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020c9:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8020ce:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020d3:	e8 0d ff ff ff       	call   801fe5 <nsipc>
+}
+  8020d8:	c9                   	leave
+  8020d9:	c3                   	ret
+
+008020da <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8020da:	55                   	push   %ebp
+  8020db:	89 e5                	mov    %esp,%ebp
+  8020dd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8020e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e3:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8020e8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020ed:	e8 f3 fe ff ff       	call   801fe5 <nsipc>
+}
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+
+008020f4 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	53                   	push   %ebx
+  8020f8:	83 ec 08             	sub    $0x8,%esp
+  8020fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8020fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802101:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802106:	53                   	push   %ebx
+  802107:	ff 75 0c             	push   0xc(%ebp)
+  80210a:	68 04 70 80 00       	push   $0x807004
+  80210f:	e8 6d ea ff ff       	call   800b81 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802114:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80211a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80211f:	e8 c1 fe ff ff       	call   801fe5 <nsipc>
+}
+  802124:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802127:	c9                   	leave
+  802128:	c3                   	ret
+
+00802129 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802129:	55                   	push   %ebp
+  80212a:	89 e5                	mov    %esp,%ebp
+  80212c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80212f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802132:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802137:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80213a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80213f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802144:	e8 9c fe ff ff       	call   801fe5 <nsipc>
+}
+  802149:	c9                   	leave
+  80214a:	c3                   	ret
+
+0080214b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80214b:	55                   	push   %ebp
+  80214c:	89 e5                	mov    %esp,%ebp
+  80214e:	56                   	push   %esi
+  80214f:	53                   	push   %ebx
+  802150:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802153:	8b 45 08             	mov    0x8(%ebp),%eax
+  802156:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80215b:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802161:	8b 45 14             	mov    0x14(%ebp),%eax
+  802164:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802169:	b8 07 00 00 00       	mov    $0x7,%eax
+  80216e:	e8 72 fe ff ff       	call   801fe5 <nsipc>
+  802173:	89 c3                	mov    %eax,%ebx
+  802175:	85 c0                	test   %eax,%eax
+  802177:	78 22                	js     80219b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802179:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80217e:	39 c6                	cmp    %eax,%esi
+  802180:	0f 4e c6             	cmovle %esi,%eax
+  802183:	39 c3                	cmp    %eax,%ebx
+  802185:	7f 1d                	jg     8021a4 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802187:	83 ec 04             	sub    $0x4,%esp
+  80218a:	53                   	push   %ebx
+  80218b:	68 00 70 80 00       	push   $0x807000
+  802190:	ff 75 0c             	push   0xc(%ebp)
+  802193:	e8 e9 e9 ff ff       	call   800b81 <memmove>
+  802198:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80219b:	89 d8                	mov    %ebx,%eax
+  80219d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a0:	5b                   	pop    %ebx
+  8021a1:	5e                   	pop    %esi
+  8021a2:	5d                   	pop    %ebp
+  8021a3:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8021a4:	68 af 33 80 00       	push   $0x8033af
+  8021a9:	68 77 33 80 00       	push   $0x803377
+  8021ae:	6a 62                	push   $0x62
+  8021b0:	68 c4 33 80 00       	push   $0x8033c4
+  8021b5:	e8 78 e1 ff ff       	call   800332 <_panic>
+
+008021ba <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8021ba:	55                   	push   %ebp
+  8021bb:	89 e5                	mov    %esp,%ebp
+  8021bd:	53                   	push   %ebx
+  8021be:	83 ec 04             	sub    $0x4,%esp
+  8021c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8021c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c7:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8021cc:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8021d2:	7f 2e                	jg     802202 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8021d4:	83 ec 04             	sub    $0x4,%esp
+  8021d7:	53                   	push   %ebx
+  8021d8:	ff 75 0c             	push   0xc(%ebp)
+  8021db:	68 0c 70 80 00       	push   $0x80700c
+  8021e0:	e8 9c e9 ff ff       	call   800b81 <memmove>
+	nsipcbuf.send.req_size = size;
+  8021e5:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8021eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021ee:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8021f3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021f8:	e8 e8 fd ff ff       	call   801fe5 <nsipc>
+}
+  8021fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802200:	c9                   	leave
+  802201:	c3                   	ret
+	assert(size < 1600);
+  802202:	68 d0 33 80 00       	push   $0x8033d0
+  802207:	68 77 33 80 00       	push   $0x803377
+  80220c:	6a 6d                	push   $0x6d
+  80220e:	68 c4 33 80 00       	push   $0x8033c4
+  802213:	e8 1a e1 ff ff       	call   800332 <_panic>
+
+00802218 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802218:	55                   	push   %ebp
+  802219:	89 e5                	mov    %esp,%ebp
+  80221b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80221e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802221:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802226:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802229:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80222e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802231:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802236:	b8 09 00 00 00       	mov    $0x9,%eax
+  80223b:	e8 a5 fd ff ff       	call   801fe5 <nsipc>
+}
+  802240:	c9                   	leave
+  802241:	c3                   	ret
+
+00802242 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802242:	55                   	push   %ebp
+  802243:	89 e5                	mov    %esp,%ebp
+  802245:	56                   	push   %esi
+  802246:	53                   	push   %ebx
+  802247:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80224a:	83 ec 0c             	sub    $0xc,%esp
+  80224d:	ff 75 08             	push   0x8(%ebp)
+  802250:	e8 aa f3 ff ff       	call   8015ff <fd2data>
+  802255:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802257:	83 c4 08             	add    $0x8,%esp
+  80225a:	68 dc 33 80 00       	push   $0x8033dc
+  80225f:	53                   	push   %ebx
+  802260:	e8 96 e7 ff ff       	call   8009fb <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802265:	8b 46 04             	mov    0x4(%esi),%eax
+  802268:	2b 06                	sub    (%esi),%eax
+  80226a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802270:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802277:	00 00 00 
+	stat->st_dev = &devpipe;
+  80227a:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  802281:	40 80 00 
+	return 0;
+}
+  802284:	b8 00 00 00 00       	mov    $0x0,%eax
+  802289:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80228c:	5b                   	pop    %ebx
+  80228d:	5e                   	pop    %esi
+  80228e:	5d                   	pop    %ebp
+  80228f:	c3                   	ret
+
+00802290 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802290:	55                   	push   %ebp
+  802291:	89 e5                	mov    %esp,%ebp
+  802293:	53                   	push   %ebx
+  802294:	83 ec 0c             	sub    $0xc,%esp
+  802297:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80229a:	53                   	push   %ebx
+  80229b:	6a 00                	push   $0x0
+  80229d:	e8 8e ec ff ff       	call   800f30 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8022a2:	89 1c 24             	mov    %ebx,(%esp)
+  8022a5:	e8 55 f3 ff ff       	call   8015ff <fd2data>
+  8022aa:	83 c4 08             	add    $0x8,%esp
+  8022ad:	50                   	push   %eax
+  8022ae:	6a 00                	push   $0x0
+  8022b0:	e8 7b ec ff ff       	call   800f30 <sys_page_unmap>
+}
+  8022b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b8:	c9                   	leave
+  8022b9:	c3                   	ret
+
+008022ba <_pipeisclosed>:
+{
+  8022ba:	55                   	push   %ebp
+  8022bb:	89 e5                	mov    %esp,%ebp
+  8022bd:	57                   	push   %edi
+  8022be:	56                   	push   %esi
+  8022bf:	53                   	push   %ebx
+  8022c0:	83 ec 1c             	sub    $0x1c,%esp
+  8022c3:	89 c7                	mov    %eax,%edi
+  8022c5:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8022c7:	a1 08 50 80 00       	mov    0x805008,%eax
+  8022cc:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8022cf:	83 ec 0c             	sub    $0xc,%esp
+  8022d2:	57                   	push   %edi
+  8022d3:	e8 e4 05 00 00       	call   8028bc <pageref>
+  8022d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022db:	89 34 24             	mov    %esi,(%esp)
+  8022de:	e8 d9 05 00 00       	call   8028bc <pageref>
+		nn = thisenv->env_runs;
+  8022e3:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8022e9:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8022ec:	83 c4 10             	add    $0x10,%esp
+  8022ef:	39 cb                	cmp    %ecx,%ebx
+  8022f1:	74 1b                	je     80230e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8022f3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8022f6:	75 cf                	jne    8022c7 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8022f8:	8b 42 5c             	mov    0x5c(%edx),%eax
+  8022fb:	6a 01                	push   $0x1
+  8022fd:	50                   	push   %eax
+  8022fe:	53                   	push   %ebx
+  8022ff:	68 e3 33 80 00       	push   $0x8033e3
+  802304:	e8 04 e1 ff ff       	call   80040d <cprintf>
+  802309:	83 c4 10             	add    $0x10,%esp
+  80230c:	eb b9                	jmp    8022c7 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80230e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802311:	0f 94 c0             	sete   %al
+  802314:	0f b6 c0             	movzbl %al,%eax
+}
+  802317:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80231a:	5b                   	pop    %ebx
+  80231b:	5e                   	pop    %esi
+  80231c:	5f                   	pop    %edi
+  80231d:	5d                   	pop    %ebp
+  80231e:	c3                   	ret
+
+0080231f <devpipe_write>:
+{
+  80231f:	55                   	push   %ebp
+  802320:	89 e5                	mov    %esp,%ebp
+  802322:	57                   	push   %edi
+  802323:	56                   	push   %esi
+  802324:	53                   	push   %ebx
+  802325:	83 ec 28             	sub    $0x28,%esp
+  802328:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80232b:	56                   	push   %esi
+  80232c:	e8 ce f2 ff ff       	call   8015ff <fd2data>
+  802331:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802333:	83 c4 10             	add    $0x10,%esp
+  802336:	bf 00 00 00 00       	mov    $0x0,%edi
+  80233b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80233e:	75 09                	jne    802349 <devpipe_write+0x2a>
+	return i;
+  802340:	89 f8                	mov    %edi,%eax
+  802342:	eb 23                	jmp    802367 <devpipe_write+0x48>
+			sys_yield();
+  802344:	e8 9f ea ff ff       	call   800de8 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802349:	8b 43 04             	mov    0x4(%ebx),%eax
+  80234c:	8b 0b                	mov    (%ebx),%ecx
+  80234e:	8d 51 20             	lea    0x20(%ecx),%edx
+  802351:	39 d0                	cmp    %edx,%eax
+  802353:	72 1a                	jb     80236f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802355:	89 da                	mov    %ebx,%edx
+  802357:	89 f0                	mov    %esi,%eax
+  802359:	e8 5c ff ff ff       	call   8022ba <_pipeisclosed>
+  80235e:	85 c0                	test   %eax,%eax
+  802360:	74 e2                	je     802344 <devpipe_write+0x25>
+				return 0;
+  802362:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802367:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236a:	5b                   	pop    %ebx
+  80236b:	5e                   	pop    %esi
+  80236c:	5f                   	pop    %edi
+  80236d:	5d                   	pop    %ebp
+  80236e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80236f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802372:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802376:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802379:	89 c2                	mov    %eax,%edx
+  80237b:	c1 fa 1f             	sar    $0x1f,%edx
+  80237e:	89 d1                	mov    %edx,%ecx
+  802380:	c1 e9 1b             	shr    $0x1b,%ecx
+  802383:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802386:	83 e2 1f             	and    $0x1f,%edx
+  802389:	29 ca                	sub    %ecx,%edx
+  80238b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80238f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802393:	83 c0 01             	add    $0x1,%eax
+  802396:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802399:	83 c7 01             	add    $0x1,%edi
+  80239c:	eb 9d                	jmp    80233b <devpipe_write+0x1c>
+
+0080239e <devpipe_read>:
+{
+  80239e:	55                   	push   %ebp
+  80239f:	89 e5                	mov    %esp,%ebp
+  8023a1:	57                   	push   %edi
+  8023a2:	56                   	push   %esi
+  8023a3:	53                   	push   %ebx
+  8023a4:	83 ec 18             	sub    $0x18,%esp
+  8023a7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8023aa:	57                   	push   %edi
+  8023ab:	e8 4f f2 ff ff       	call   8015ff <fd2data>
+  8023b0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8023b2:	83 c4 10             	add    $0x10,%esp
+  8023b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ba:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8023bd:	75 13                	jne    8023d2 <devpipe_read+0x34>
+	return i;
+  8023bf:	89 f0                	mov    %esi,%eax
+  8023c1:	eb 02                	jmp    8023c5 <devpipe_read+0x27>
+				return i;
+  8023c3:	89 f0                	mov    %esi,%eax
+}
+  8023c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023c8:	5b                   	pop    %ebx
+  8023c9:	5e                   	pop    %esi
+  8023ca:	5f                   	pop    %edi
+  8023cb:	5d                   	pop    %ebp
+  8023cc:	c3                   	ret
+			sys_yield();
+  8023cd:	e8 16 ea ff ff       	call   800de8 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8023d2:	8b 03                	mov    (%ebx),%eax
+  8023d4:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8023d7:	75 18                	jne    8023f1 <devpipe_read+0x53>
+			if (i > 0)
+  8023d9:	85 f6                	test   %esi,%esi
+  8023db:	75 e6                	jne    8023c3 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8023dd:	89 da                	mov    %ebx,%edx
+  8023df:	89 f8                	mov    %edi,%eax
+  8023e1:	e8 d4 fe ff ff       	call   8022ba <_pipeisclosed>
+  8023e6:	85 c0                	test   %eax,%eax
+  8023e8:	74 e3                	je     8023cd <devpipe_read+0x2f>
+				return 0;
+  8023ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ef:	eb d4                	jmp    8023c5 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8023f1:	99                   	cltd
+  8023f2:	c1 ea 1b             	shr    $0x1b,%edx
+  8023f5:	01 d0                	add    %edx,%eax
+  8023f7:	83 e0 1f             	and    $0x1f,%eax
+  8023fa:	29 d0                	sub    %edx,%eax
+  8023fc:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802401:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802404:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802407:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80240a:	83 c6 01             	add    $0x1,%esi
+  80240d:	eb ab                	jmp    8023ba <devpipe_read+0x1c>
+
+0080240f <pipe>:
+{
+  80240f:	55                   	push   %ebp
+  802410:	89 e5                	mov    %esp,%ebp
+  802412:	56                   	push   %esi
+  802413:	53                   	push   %ebx
+  802414:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802417:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80241a:	50                   	push   %eax
+  80241b:	e8 f6 f1 ff ff       	call   801616 <fd_alloc>
+  802420:	89 c3                	mov    %eax,%ebx
+  802422:	83 c4 10             	add    $0x10,%esp
+  802425:	85 c0                	test   %eax,%eax
+  802427:	0f 88 23 01 00 00    	js     802550 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80242d:	83 ec 04             	sub    $0x4,%esp
+  802430:	68 07 04 00 00       	push   $0x407
+  802435:	ff 75 f4             	push   -0xc(%ebp)
+  802438:	6a 00                	push   $0x0
+  80243a:	e8 29 ea ff ff       	call   800e68 <sys_page_alloc>
+  80243f:	89 c3                	mov    %eax,%ebx
+  802441:	83 c4 10             	add    $0x10,%esp
+  802444:	85 c0                	test   %eax,%eax
+  802446:	0f 88 04 01 00 00    	js     802550 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80244c:	83 ec 0c             	sub    $0xc,%esp
+  80244f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802452:	50                   	push   %eax
+  802453:	e8 be f1 ff ff       	call   801616 <fd_alloc>
+  802458:	89 c3                	mov    %eax,%ebx
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	0f 88 db 00 00 00    	js     802540 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802465:	83 ec 04             	sub    $0x4,%esp
+  802468:	68 07 04 00 00       	push   $0x407
+  80246d:	ff 75 f0             	push   -0x10(%ebp)
+  802470:	6a 00                	push   $0x0
+  802472:	e8 f1 e9 ff ff       	call   800e68 <sys_page_alloc>
+  802477:	89 c3                	mov    %eax,%ebx
+  802479:	83 c4 10             	add    $0x10,%esp
+  80247c:	85 c0                	test   %eax,%eax
+  80247e:	0f 88 bc 00 00 00    	js     802540 <pipe+0x131>
+	va = fd2data(fd0);
+  802484:	83 ec 0c             	sub    $0xc,%esp
+  802487:	ff 75 f4             	push   -0xc(%ebp)
+  80248a:	e8 70 f1 ff ff       	call   8015ff <fd2data>
+  80248f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802491:	83 c4 0c             	add    $0xc,%esp
+  802494:	68 07 04 00 00       	push   $0x407
+  802499:	50                   	push   %eax
+  80249a:	6a 00                	push   $0x0
+  80249c:	e8 c7 e9 ff ff       	call   800e68 <sys_page_alloc>
+  8024a1:	89 c3                	mov    %eax,%ebx
+  8024a3:	83 c4 10             	add    $0x10,%esp
+  8024a6:	85 c0                	test   %eax,%eax
+  8024a8:	0f 88 82 00 00 00    	js     802530 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024ae:	83 ec 0c             	sub    $0xc,%esp
+  8024b1:	ff 75 f0             	push   -0x10(%ebp)
+  8024b4:	e8 46 f1 ff ff       	call   8015ff <fd2data>
+  8024b9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8024c0:	50                   	push   %eax
+  8024c1:	6a 00                	push   $0x0
+  8024c3:	56                   	push   %esi
+  8024c4:	6a 00                	push   $0x0
+  8024c6:	e8 23 ea ff ff       	call   800eee <sys_page_map>
+  8024cb:	89 c3                	mov    %eax,%ebx
+  8024cd:	83 c4 20             	add    $0x20,%esp
+  8024d0:	85 c0                	test   %eax,%eax
+  8024d2:	78 4e                	js     802522 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8024d4:	a1 40 40 80 00       	mov    0x804040,%eax
+  8024d9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024dc:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8024de:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024e1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8024e8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8024eb:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8024ed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8024f0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8024f7:	83 ec 0c             	sub    $0xc,%esp
+  8024fa:	ff 75 f4             	push   -0xc(%ebp)
+  8024fd:	e8 ed f0 ff ff       	call   8015ef <fd2num>
+  802502:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802505:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802507:	83 c4 04             	add    $0x4,%esp
+  80250a:	ff 75 f0             	push   -0x10(%ebp)
+  80250d:	e8 dd f0 ff ff       	call   8015ef <fd2num>
+  802512:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802515:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802518:	83 c4 10             	add    $0x10,%esp
+  80251b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802520:	eb 2e                	jmp    802550 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802522:	83 ec 08             	sub    $0x8,%esp
+  802525:	56                   	push   %esi
+  802526:	6a 00                	push   $0x0
+  802528:	e8 03 ea ff ff       	call   800f30 <sys_page_unmap>
+  80252d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802530:	83 ec 08             	sub    $0x8,%esp
+  802533:	ff 75 f0             	push   -0x10(%ebp)
+  802536:	6a 00                	push   $0x0
+  802538:	e8 f3 e9 ff ff       	call   800f30 <sys_page_unmap>
+  80253d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802540:	83 ec 08             	sub    $0x8,%esp
+  802543:	ff 75 f4             	push   -0xc(%ebp)
+  802546:	6a 00                	push   $0x0
+  802548:	e8 e3 e9 ff ff       	call   800f30 <sys_page_unmap>
+  80254d:	83 c4 10             	add    $0x10,%esp
+}
+  802550:	89 d8                	mov    %ebx,%eax
+  802552:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802555:	5b                   	pop    %ebx
+  802556:	5e                   	pop    %esi
+  802557:	5d                   	pop    %ebp
+  802558:	c3                   	ret
+
+00802559 <pipeisclosed>:
+{
+  802559:	55                   	push   %ebp
+  80255a:	89 e5                	mov    %esp,%ebp
+  80255c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80255f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802562:	50                   	push   %eax
+  802563:	ff 75 08             	push   0x8(%ebp)
+  802566:	e8 01 f1 ff ff       	call   80166c <fd_lookup>
+  80256b:	83 c4 10             	add    $0x10,%esp
+  80256e:	85 c0                	test   %eax,%eax
+  802570:	78 18                	js     80258a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802572:	83 ec 0c             	sub    $0xc,%esp
+  802575:	ff 75 f4             	push   -0xc(%ebp)
+  802578:	e8 82 f0 ff ff       	call   8015ff <fd2data>
+  80257d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80257f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802582:	e8 33 fd ff ff       	call   8022ba <_pipeisclosed>
+  802587:	83 c4 10             	add    $0x10,%esp
+}
+  80258a:	c9                   	leave
+  80258b:	c3                   	ret
+
+0080258c <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  80258c:	55                   	push   %ebp
+  80258d:	89 e5                	mov    %esp,%ebp
+  80258f:	56                   	push   %esi
+  802590:	53                   	push   %ebx
+  802591:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  802594:	85 f6                	test   %esi,%esi
+  802596:	74 13                	je     8025ab <wait+0x1f>
+	e = &envs[ENVX(envid)];
+  802598:	89 f3                	mov    %esi,%ebx
+  80259a:	81 e3 ff 1f 00 00    	and    $0x1fff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8025a0:	c1 e3 09             	shl    $0x9,%ebx
+  8025a3:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8025a9:	eb 1b                	jmp    8025c6 <wait+0x3a>
+	assert(envid != 0);
+  8025ab:	68 fb 33 80 00       	push   $0x8033fb
+  8025b0:	68 77 33 80 00       	push   $0x803377
+  8025b5:	6a 09                	push   $0x9
+  8025b7:	68 06 34 80 00       	push   $0x803406
+  8025bc:	e8 71 dd ff ff       	call   800332 <_panic>
+		sys_yield();
+  8025c1:	e8 22 e8 ff ff       	call   800de8 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8025c6:	8b 43 4c             	mov    0x4c(%ebx),%eax
+  8025c9:	39 f0                	cmp    %esi,%eax
+  8025cb:	75 07                	jne    8025d4 <wait+0x48>
+  8025cd:	8b 43 58             	mov    0x58(%ebx),%eax
+  8025d0:	85 c0                	test   %eax,%eax
+  8025d2:	75 ed                	jne    8025c1 <wait+0x35>
+}
+  8025d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025d7:	5b                   	pop    %ebx
+  8025d8:	5e                   	pop    %esi
+  8025d9:	5d                   	pop    %ebp
+  8025da:	c3                   	ret
+
+008025db <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8025db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e0:	c3                   	ret
+
+008025e1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025e1:	55                   	push   %ebp
+  8025e2:	89 e5                	mov    %esp,%ebp
+  8025e4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8025e7:	68 11 34 80 00       	push   $0x803411
+  8025ec:	ff 75 0c             	push   0xc(%ebp)
+  8025ef:	e8 07 e4 ff ff       	call   8009fb <strcpy>
+	return 0;
+}
+  8025f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f9:	c9                   	leave
+  8025fa:	c3                   	ret
+
+008025fb <devcons_write>:
+{
+  8025fb:	55                   	push   %ebp
+  8025fc:	89 e5                	mov    %esp,%ebp
+  8025fe:	57                   	push   %edi
+  8025ff:	56                   	push   %esi
+  802600:	53                   	push   %ebx
+  802601:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802607:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80260c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802612:	eb 2e                	jmp    802642 <devcons_write+0x47>
+		m = n - tot;
+  802614:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802617:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802619:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80261e:	39 c3                	cmp    %eax,%ebx
+  802620:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802623:	83 ec 04             	sub    $0x4,%esp
+  802626:	53                   	push   %ebx
+  802627:	89 f0                	mov    %esi,%eax
+  802629:	03 45 0c             	add    0xc(%ebp),%eax
+  80262c:	50                   	push   %eax
+  80262d:	57                   	push   %edi
+  80262e:	e8 4e e5 ff ff       	call   800b81 <memmove>
+		sys_cputs(buf, m);
+  802633:	83 c4 08             	add    $0x8,%esp
+  802636:	53                   	push   %ebx
+  802637:	57                   	push   %edi
+  802638:	e8 ee e6 ff ff       	call   800d2b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80263d:	01 de                	add    %ebx,%esi
+  80263f:	83 c4 10             	add    $0x10,%esp
+  802642:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802645:	72 cd                	jb     802614 <devcons_write+0x19>
+}
+  802647:	89 f0                	mov    %esi,%eax
+  802649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264c:	5b                   	pop    %ebx
+  80264d:	5e                   	pop    %esi
+  80264e:	5f                   	pop    %edi
+  80264f:	5d                   	pop    %ebp
+  802650:	c3                   	ret
+
+00802651 <devcons_read>:
+{
+  802651:	55                   	push   %ebp
+  802652:	89 e5                	mov    %esp,%ebp
+  802654:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802660:	75 07                	jne    802669 <devcons_read+0x18>
+  802662:	eb 1f                	jmp    802683 <devcons_read+0x32>
+		sys_yield();
+  802664:	e8 7f e7 ff ff       	call   800de8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802669:	e8 db e6 ff ff       	call   800d49 <sys_cgetc>
+  80266e:	85 c0                	test   %eax,%eax
+  802670:	74 f2                	je     802664 <devcons_read+0x13>
+	if (c < 0)
+  802672:	78 0f                	js     802683 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802674:	83 f8 04             	cmp    $0x4,%eax
+  802677:	74 0c                	je     802685 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802679:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80267c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80267e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802683:	c9                   	leave
+  802684:	c3                   	ret
+		return 0;
+  802685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80268a:	eb f7                	jmp    802683 <devcons_read+0x32>
+
+0080268c <cputchar>:
+{
+  80268c:	55                   	push   %ebp
+  80268d:	89 e5                	mov    %esp,%ebp
+  80268f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802692:	8b 45 08             	mov    0x8(%ebp),%eax
+  802695:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802698:	6a 01                	push   $0x1
+  80269a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80269d:	50                   	push   %eax
+  80269e:	e8 88 e6 ff ff       	call   800d2b <sys_cputs>
+}
+  8026a3:	83 c4 10             	add    $0x10,%esp
+  8026a6:	c9                   	leave
+  8026a7:	c3                   	ret
+
+008026a8 <getchar>:
+{
+  8026a8:	55                   	push   %ebp
+  8026a9:	89 e5                	mov    %esp,%ebp
+  8026ab:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8026ae:	6a 01                	push   $0x1
+  8026b0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8026b3:	50                   	push   %eax
+  8026b4:	6a 00                	push   $0x0
+  8026b6:	e8 17 f2 ff ff       	call   8018d2 <read>
+	if (r < 0)
+  8026bb:	83 c4 10             	add    $0x10,%esp
+  8026be:	85 c0                	test   %eax,%eax
+  8026c0:	78 06                	js     8026c8 <getchar+0x20>
+	if (r < 1)
+  8026c2:	74 06                	je     8026ca <getchar+0x22>
+	return c;
+  8026c4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8026c8:	c9                   	leave
+  8026c9:	c3                   	ret
+		return -E_EOF;
+  8026ca:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8026cf:	eb f7                	jmp    8026c8 <getchar+0x20>
+
+008026d1 <iscons>:
+{
+  8026d1:	55                   	push   %ebp
+  8026d2:	89 e5                	mov    %esp,%ebp
+  8026d4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026da:	50                   	push   %eax
+  8026db:	ff 75 08             	push   0x8(%ebp)
+  8026de:	e8 89 ef ff ff       	call   80166c <fd_lookup>
+  8026e3:	83 c4 10             	add    $0x10,%esp
+  8026e6:	85 c0                	test   %eax,%eax
+  8026e8:	78 11                	js     8026fb <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8026ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026ed:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  8026f3:	39 10                	cmp    %edx,(%eax)
+  8026f5:	0f 94 c0             	sete   %al
+  8026f8:	0f b6 c0             	movzbl %al,%eax
+}
+  8026fb:	c9                   	leave
+  8026fc:	c3                   	ret
+
+008026fd <opencons>:
+{
+  8026fd:	55                   	push   %ebp
+  8026fe:	89 e5                	mov    %esp,%ebp
+  802700:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802703:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802706:	50                   	push   %eax
+  802707:	e8 0a ef ff ff       	call   801616 <fd_alloc>
+  80270c:	83 c4 10             	add    $0x10,%esp
+  80270f:	85 c0                	test   %eax,%eax
+  802711:	78 3a                	js     80274d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802713:	83 ec 04             	sub    $0x4,%esp
+  802716:	68 07 04 00 00       	push   $0x407
+  80271b:	ff 75 f4             	push   -0xc(%ebp)
+  80271e:	6a 00                	push   $0x0
+  802720:	e8 43 e7 ff ff       	call   800e68 <sys_page_alloc>
+  802725:	83 c4 10             	add    $0x10,%esp
+  802728:	85 c0                	test   %eax,%eax
+  80272a:	78 21                	js     80274d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80272c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80272f:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802735:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802737:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80273a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802741:	83 ec 0c             	sub    $0xc,%esp
+  802744:	50                   	push   %eax
+  802745:	e8 a5 ee ff ff       	call   8015ef <fd2num>
+  80274a:	83 c4 10             	add    $0x10,%esp
+}
+  80274d:	c9                   	leave
+  80274e:	c3                   	ret
+
+0080274f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80274f:	55                   	push   %ebp
+  802750:	89 e5                	mov    %esp,%ebp
+  802752:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802755:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80275c:	74 0a                	je     802768 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80275e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802761:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  802766:	c9                   	leave
+  802767:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  802768:	83 ec 04             	sub    $0x4,%esp
+  80276b:	6a 07                	push   $0x7
+  80276d:	68 00 f0 bf ee       	push   $0xeebff000
+  802772:	6a 00                	push   $0x0
+  802774:	e8 ef e6 ff ff       	call   800e68 <sys_page_alloc>
+  802779:	83 c4 10             	add    $0x10,%esp
+  80277c:	85 c0                	test   %eax,%eax
+  80277e:	78 28                	js     8027a8 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802780:	83 ec 08             	sub    $0x8,%esp
+  802783:	68 ba 27 80 00       	push   $0x8027ba
+  802788:	6a 00                	push   $0x0
+  80278a:	e8 d4 e9 ff ff       	call   801163 <sys_env_set_pgfault_upcall>
+  80278f:	83 c4 10             	add    $0x10,%esp
+  802792:	85 c0                	test   %eax,%eax
+  802794:	79 c8                	jns    80275e <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  802796:	50                   	push   %eax
+  802797:	68 2b 34 80 00       	push   $0x80342b
+  80279c:	6a 24                	push   $0x24
+  80279e:	68 1d 34 80 00       	push   $0x80341d
+  8027a3:	e8 8a db ff ff       	call   800332 <_panic>
+			panic("sys_page_alloc: %e", r);
+  8027a8:	50                   	push   %eax
+  8027a9:	68 06 32 80 00       	push   $0x803206
+  8027ae:	6a 21                	push   $0x21
+  8027b0:	68 1d 34 80 00       	push   $0x80341d
+  8027b5:	e8 78 db ff ff       	call   800332 <_panic>
+
+008027ba <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8027ba:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8027bb:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8027c0:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8027c2:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8027c5:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  8027c8:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  8027cc:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  8027cf:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  8027d3:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  8027d7:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  8027d9:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8027da:	83 c4 04             	add    $0x4,%esp
+	popf
+  8027dd:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8027de:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8027df:	c3                   	ret
+
+008027e0 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8027e0:	55                   	push   %ebp
+  8027e1:	89 e5                	mov    %esp,%ebp
+  8027e3:	57                   	push   %edi
+  8027e4:	56                   	push   %esi
+  8027e5:	53                   	push   %ebx
+  8027e6:	83 ec 18             	sub    $0x18,%esp
+  8027e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8027ef:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8027f2:	85 db                	test   %ebx,%ebx
+  8027f4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8027f9:	0f 45 c3             	cmovne %ebx,%eax
+  8027fc:	50                   	push   %eax
+  8027fd:	e8 e9 e9 ff ff       	call   8011eb <sys_ipc_recv>
+
+	if (from_env_store)
+  802802:	83 c4 10             	add    $0x10,%esp
+  802805:	85 ff                	test   %edi,%edi
+  802807:	74 17                	je     802820 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802809:	ba 00 00 00 00       	mov    $0x0,%edx
+  80280e:	85 c0                	test   %eax,%eax
+  802810:	75 0c                	jne    80281e <ipc_recv+0x3e>
+  802812:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802818:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  80281e:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802820:	85 f6                	test   %esi,%esi
+  802822:	74 2e                	je     802852 <ipc_recv+0x72>
+		if (!r && pg)
+  802824:	85 c0                	test   %eax,%eax
+  802826:	75 24                	jne    80284c <ipc_recv+0x6c>
+  802828:	85 db                	test   %ebx,%ebx
+  80282a:	74 20                	je     80284c <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  80282c:	a1 08 50 80 00       	mov    0x805008,%eax
+  802831:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802837:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802839:	a1 08 50 80 00       	mov    0x805008,%eax
+  80283e:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802847:	5b                   	pop    %ebx
+  802848:	5e                   	pop    %esi
+  802849:	5f                   	pop    %edi
+  80284a:	5d                   	pop    %ebp
+  80284b:	c3                   	ret
+			*perm_store = 0;
+  80284c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802852:	85 c0                	test   %eax,%eax
+  802854:	75 ee                	jne    802844 <ipc_recv+0x64>
+  802856:	eb e1                	jmp    802839 <ipc_recv+0x59>
+
+00802858 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802858:	55                   	push   %ebp
+  802859:	89 e5                	mov    %esp,%ebp
+  80285b:	57                   	push   %edi
+  80285c:	56                   	push   %esi
+  80285d:	53                   	push   %ebx
+  80285e:	83 ec 0c             	sub    $0xc,%esp
+  802861:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802864:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802867:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80286a:	85 db                	test   %ebx,%ebx
+  80286c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802871:	0f 44 d8             	cmove  %eax,%ebx
+  802874:	ff 75 14             	push   0x14(%ebp)
+  802877:	53                   	push   %ebx
+  802878:	56                   	push   %esi
+  802879:	57                   	push   %edi
+  80287a:	e8 49 e9 ff ff       	call   8011c8 <sys_ipc_try_send_yield>
+  80287f:	83 c4 10             	add    $0x10,%esp
+  802882:	85 c0                	test   %eax,%eax
+  802884:	79 1e                	jns    8028a4 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802886:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802889:	75 07                	jne    802892 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80288b:	e8 58 e5 ff ff       	call   800de8 <sys_yield>
+  802890:	eb e2                	jmp    802874 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802892:	50                   	push   %eax
+  802893:	68 49 34 80 00       	push   $0x803449
+  802898:	6a 3d                	push   $0x3d
+  80289a:	68 5e 34 80 00       	push   $0x80345e
+  80289f:	e8 8e da ff ff       	call   800332 <_panic>
+	}
+}
+  8028a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028a7:	5b                   	pop    %ebx
+  8028a8:	5e                   	pop    %esi
+  8028a9:	5f                   	pop    %edi
+  8028aa:	5d                   	pop    %ebp
+  8028ab:	c3                   	ret
+
+008028ac <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8028ac:	55                   	push   %ebp
+  8028ad:	89 e5                	mov    %esp,%ebp
+  8028af:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8028b2:	ff 75 08             	push   0x8(%ebp)
+  8028b5:	e8 ae e4 ff ff       	call   800d68 <sys_env_find>
+}
+  8028ba:	c9                   	leave
+  8028bb:	c3                   	ret
+
+008028bc <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8028bc:	55                   	push   %ebp
+  8028bd:	89 e5                	mov    %esp,%ebp
+  8028bf:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8028c2:	89 c2                	mov    %eax,%edx
+  8028c4:	c1 ea 16             	shr    $0x16,%edx
+  8028c7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8028ce:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8028d3:	f6 c1 01             	test   $0x1,%cl
+  8028d6:	74 22                	je     8028fa <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8028d8:	c1 e8 0c             	shr    $0xc,%eax
+  8028db:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8028e2:	a8 01                	test   $0x1,%al
+  8028e4:	74 14                	je     8028fa <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8028e6:	c1 e8 0c             	shr    $0xc,%eax
+  8028e9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8028ec:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8028f3:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8028f7:	0f b7 d2             	movzwl %dx,%edx
+}
+  8028fa:	89 d0                	mov    %edx,%eax
+  8028fc:	5d                   	pop    %ebp
+  8028fd:	c3                   	ret
+  8028fe:	66 90                	xchg   %ax,%ax
+
+00802900 <__udivmoddi4>:
+  802900:	55                   	push   %ebp
+  802901:	57                   	push   %edi
+  802902:	56                   	push   %esi
+  802903:	53                   	push   %ebx
+  802904:	83 ec 14             	sub    $0x14,%esp
+  802907:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80290b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80290f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802913:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802917:	89 f1                	mov    %esi,%ecx
+  802919:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80291d:	09 d9                	or     %ebx,%ecx
+  80291f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802923:	0f 84 92 00 00 00    	je     8029bb <__udivmoddi4+0xbb>
+  802929:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802930:	00 
+  802931:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802936:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80293d:	00 
+  80293e:	89 1c 24             	mov    %ebx,(%esp)
+  802941:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802945:	8d 76 00             	lea    0x0(%esi),%esi
+  802948:	89 e9                	mov    %ebp,%ecx
+  80294a:	89 c3                	mov    %eax,%ebx
+  80294c:	89 d6                	mov    %edx,%esi
+  80294e:	31 ff                	xor    %edi,%edi
+  802950:	d3 ee                	shr    %cl,%esi
+  802952:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802955:	f6 c1 20             	test   $0x20,%cl
+  802958:	0f 45 de             	cmovne %esi,%ebx
+  80295b:	0f 45 f7             	cmovne %edi,%esi
+  80295e:	8b 3c 24             	mov    (%esp),%edi
+  802961:	39 fb                	cmp    %edi,%ebx
+  802963:	89 f7                	mov    %esi,%edi
+  802965:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802969:	8b 1c 24             	mov    (%esp),%ebx
+  80296c:	19 f7                	sbb    %esi,%edi
+  80296e:	72 39                	jb     8029a9 <__udivmoddi4+0xa9>
+  802970:	89 e9                	mov    %ebp,%ecx
+  802972:	89 f7                	mov    %esi,%edi
+  802974:	89 de                	mov    %ebx,%esi
+  802976:	0f a5 df             	shld   %cl,%ebx,%edi
+  802979:	d3 e6                	shl    %cl,%esi
+  80297b:	31 db                	xor    %ebx,%ebx
+  80297d:	f6 c1 20             	test   $0x20,%cl
+  802980:	0f 45 fe             	cmovne %esi,%edi
+  802983:	0f 45 f3             	cmovne %ebx,%esi
+  802986:	29 f0                	sub    %esi,%eax
+  802988:	be 01 00 00 00       	mov    $0x1,%esi
+  80298d:	19 fa                	sbb    %edi,%edx
+  80298f:	31 ff                	xor    %edi,%edi
+  802991:	31 db                	xor    %ebx,%ebx
+  802993:	0f a5 f7             	shld   %cl,%esi,%edi
+  802996:	d3 e6                	shl    %cl,%esi
+  802998:	f6 c1 20             	test   $0x20,%cl
+  80299b:	0f 45 fe             	cmovne %esi,%edi
+  80299e:	0f 45 f3             	cmovne %ebx,%esi
+  8029a1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8029a5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8029a9:	83 ed 01             	sub    $0x1,%ebp
+  8029ac:	73 9a                	jae    802948 <__udivmoddi4+0x48>
+  8029ae:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8029b2:	85 ff                	test   %edi,%edi
+  8029b4:	74 05                	je     8029bb <__udivmoddi4+0xbb>
+  8029b6:	89 07                	mov    %eax,(%edi)
+  8029b8:	89 57 04             	mov    %edx,0x4(%edi)
+  8029bb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029bf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029c3:	83 c4 14             	add    $0x14,%esp
+  8029c6:	5b                   	pop    %ebx
+  8029c7:	5e                   	pop    %esi
+  8029c8:	5f                   	pop    %edi
+  8029c9:	5d                   	pop    %ebp
+  8029ca:	c3                   	ret
+  8029cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8029cf:	90                   	nop
+
+008029d0 <__udivdi3>:
+  8029d0:	55                   	push   %ebp
+  8029d1:	57                   	push   %edi
+  8029d2:	56                   	push   %esi
+  8029d3:	53                   	push   %ebx
+  8029d4:	83 ec 14             	sub    $0x14,%esp
+  8029d7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8029db:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8029df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8029e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8029e7:	89 fb                	mov    %edi,%ebx
+  8029e9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8029ed:	09 f3                	or     %esi,%ebx
+  8029ef:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8029f3:	0f 84 85 00 00 00    	je     802a7e <__udivdi3+0xae>
+  8029f9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802a00:	00 
+  802a01:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802a06:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802a0d:	00 
+  802a0e:	89 34 24             	mov    %esi,(%esp)
+  802a11:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802a15:	8d 76 00             	lea    0x0(%esi),%esi
+  802a18:	89 e9                	mov    %ebp,%ecx
+  802a1a:	89 c3                	mov    %eax,%ebx
+  802a1c:	89 d6                	mov    %edx,%esi
+  802a1e:	31 ff                	xor    %edi,%edi
+  802a20:	d3 ee                	shr    %cl,%esi
+  802a22:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a25:	f6 c1 20             	test   $0x20,%cl
+  802a28:	0f 45 de             	cmovne %esi,%ebx
+  802a2b:	0f 45 f7             	cmovne %edi,%esi
+  802a2e:	8b 3c 24             	mov    (%esp),%edi
+  802a31:	39 fb                	cmp    %edi,%ebx
+  802a33:	89 f7                	mov    %esi,%edi
+  802a35:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802a39:	8b 1c 24             	mov    (%esp),%ebx
+  802a3c:	19 f7                	sbb    %esi,%edi
+  802a3e:	72 39                	jb     802a79 <__udivdi3+0xa9>
+  802a40:	89 e9                	mov    %ebp,%ecx
+  802a42:	89 f7                	mov    %esi,%edi
+  802a44:	89 de                	mov    %ebx,%esi
+  802a46:	0f a5 df             	shld   %cl,%ebx,%edi
+  802a49:	d3 e6                	shl    %cl,%esi
+  802a4b:	31 db                	xor    %ebx,%ebx
+  802a4d:	f6 c1 20             	test   $0x20,%cl
+  802a50:	0f 45 fe             	cmovne %esi,%edi
+  802a53:	0f 45 f3             	cmovne %ebx,%esi
+  802a56:	29 f0                	sub    %esi,%eax
+  802a58:	be 01 00 00 00       	mov    $0x1,%esi
+  802a5d:	19 fa                	sbb    %edi,%edx
+  802a5f:	31 ff                	xor    %edi,%edi
+  802a61:	31 db                	xor    %ebx,%ebx
+  802a63:	0f a5 f7             	shld   %cl,%esi,%edi
+  802a66:	d3 e6                	shl    %cl,%esi
+  802a68:	f6 c1 20             	test   $0x20,%cl
+  802a6b:	0f 45 fe             	cmovne %esi,%edi
+  802a6e:	0f 45 f3             	cmovne %ebx,%esi
+  802a71:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802a75:	09 74 24 08          	or     %esi,0x8(%esp)
+  802a79:	83 ed 01             	sub    $0x1,%ebp
+  802a7c:	73 9a                	jae    802a18 <__udivdi3+0x48>
+  802a7e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802a82:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802a86:	83 c4 14             	add    $0x14,%esp
+  802a89:	5b                   	pop    %ebx
+  802a8a:	5e                   	pop    %esi
+  802a8b:	5f                   	pop    %edi
+  802a8c:	5d                   	pop    %ebp
+  802a8d:	c3                   	ret
+  802a8e:	66 90                	xchg   %ax,%ax
+
+00802a90 <__umoddi3>:
+  802a90:	57                   	push   %edi
+  802a91:	56                   	push   %esi
+  802a92:	53                   	push   %ebx
+  802a93:	83 ec 08             	sub    $0x8,%esp
+  802a96:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  802a9a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  802a9e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802aa2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802aa6:	89 f9                	mov    %edi,%ecx
+  802aa8:	89 34 24             	mov    %esi,(%esp)
+  802aab:	09 f1                	or     %esi,%ecx
+  802aad:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802ab1:	74 53                	je     802b06 <__umoddi3+0x76>
+  802ab3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802abf:	90                   	nop
+  802ac0:	89 c6                	mov    %eax,%esi
+  802ac2:	89 d7                	mov    %edx,%edi
+  802ac4:	31 db                	xor    %ebx,%ebx
+  802ac6:	d3 ef                	shr    %cl,%edi
+  802ac8:	0f ad d6             	shrd   %cl,%edx,%esi
+  802acb:	f6 c1 20             	test   $0x20,%cl
+  802ace:	0f 45 f7             	cmovne %edi,%esi
+  802ad1:	0f 45 fb             	cmovne %ebx,%edi
+  802ad4:	8b 1c 24             	mov    (%esp),%ebx
+  802ad7:	39 de                	cmp    %ebx,%esi
+  802ad9:	89 fb                	mov    %edi,%ebx
+  802adb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  802adf:	8b 34 24             	mov    (%esp),%esi
+  802ae2:	19 fb                	sbb    %edi,%ebx
+  802ae4:	72 14                	jb     802afa <__umoddi3+0x6a>
+  802ae6:	0f a5 f7             	shld   %cl,%esi,%edi
+  802ae9:	31 db                	xor    %ebx,%ebx
+  802aeb:	d3 e6                	shl    %cl,%esi
+  802aed:	f6 c1 20             	test   $0x20,%cl
+  802af0:	0f 45 fe             	cmovne %esi,%edi
+  802af3:	0f 45 f3             	cmovne %ebx,%esi
+  802af6:	29 f0                	sub    %esi,%eax
+  802af8:	19 fa                	sbb    %edi,%edx
+  802afa:	83 e9 01             	sub    $0x1,%ecx
+  802afd:	73 c1                	jae    802ac0 <__umoddi3+0x30>
+  802aff:	83 c4 08             	add    $0x8,%esp
+  802b02:	5b                   	pop    %ebx
+  802b03:	5e                   	pop    %esi
+  802b04:	5f                   	pop    %edi
+  802b05:	c3                   	ret
+  802b06:	83 c4 08             	add    $0x8,%esp
+  802b09:	31 c0                	xor    %eax,%eax
+  802b0b:	31 d2                	xor    %edx,%edx
+  802b0d:	5b                   	pop    %ebx
+  802b0e:	5e                   	pop    %esi
+  802b0f:	5f                   	pop    %edi
+  802b10:	c3                   	ret
+  802b11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802b1f:	90                   	nop
+
+00802b20 <__divdi3>:
+  802b20:	55                   	push   %ebp
+  802b21:	57                   	push   %edi
+  802b22:	56                   	push   %esi
+  802b23:	53                   	push   %ebx
+  802b24:	83 ec 1c             	sub    $0x1c,%esp
+  802b27:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802b2b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802b2f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802b33:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802b37:	85 ff                	test   %edi,%edi
+  802b39:	0f 88 da 00 00 00    	js     802c19 <__divdi3+0xf9>
+  802b3f:	85 db                	test   %ebx,%ebx
+  802b41:	78 16                	js     802b59 <__divdi3+0x39>
+  802b43:	89 dd                	mov    %ebx,%ebp
+  802b45:	89 c8                	mov    %ecx,%eax
+  802b47:	89 da                	mov    %ebx,%edx
+  802b49:	09 cd                	or     %ecx,%ebp
+  802b4b:	0f 85 fd 00 00 00    	jne    802c4e <__divdi3+0x12e>
+  802b51:	83 c4 1c             	add    $0x1c,%esp
+  802b54:	5b                   	pop    %ebx
+  802b55:	5e                   	pop    %esi
+  802b56:	5f                   	pop    %edi
+  802b57:	5d                   	pop    %ebp
+  802b58:	c3                   	ret
+  802b59:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802b5e:	f7 d9                	neg    %ecx
+  802b60:	89 f0                	mov    %esi,%eax
+  802b62:	89 fa                	mov    %edi,%edx
+  802b64:	83 d3 00             	adc    $0x0,%ebx
+  802b67:	89 0c 24             	mov    %ecx,(%esp)
+  802b6a:	f7 db                	neg    %ebx
+  802b6c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802b70:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802b77:	00 
+  802b78:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802b7d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802b84:	00 
+  802b85:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802b89:	89 cd                	mov    %ecx,%ebp
+  802b8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802b8f:	90                   	nop
+  802b90:	89 e9                	mov    %ebp,%ecx
+  802b92:	89 c3                	mov    %eax,%ebx
+  802b94:	89 d6                	mov    %edx,%esi
+  802b96:	31 ff                	xor    %edi,%edi
+  802b98:	d3 ee                	shr    %cl,%esi
+  802b9a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802b9d:	f6 c1 20             	test   $0x20,%cl
+  802ba0:	0f 45 de             	cmovne %esi,%ebx
+  802ba3:	0f 45 f7             	cmovne %edi,%esi
+  802ba6:	8b 3c 24             	mov    (%esp),%edi
+  802ba9:	39 fb                	cmp    %edi,%ebx
+  802bab:	89 f7                	mov    %esi,%edi
+  802bad:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802bb1:	8b 1c 24             	mov    (%esp),%ebx
+  802bb4:	19 f7                	sbb    %esi,%edi
+  802bb6:	72 39                	jb     802bf1 <__divdi3+0xd1>
+  802bb8:	89 e9                	mov    %ebp,%ecx
+  802bba:	89 f7                	mov    %esi,%edi
+  802bbc:	89 de                	mov    %ebx,%esi
+  802bbe:	0f a5 df             	shld   %cl,%ebx,%edi
+  802bc1:	d3 e6                	shl    %cl,%esi
+  802bc3:	31 db                	xor    %ebx,%ebx
+  802bc5:	f6 c1 20             	test   $0x20,%cl
+  802bc8:	0f 45 fe             	cmovne %esi,%edi
+  802bcb:	0f 45 f3             	cmovne %ebx,%esi
+  802bce:	29 f0                	sub    %esi,%eax
+  802bd0:	be 01 00 00 00       	mov    $0x1,%esi
+  802bd5:	19 fa                	sbb    %edi,%edx
+  802bd7:	31 ff                	xor    %edi,%edi
+  802bd9:	31 db                	xor    %ebx,%ebx
+  802bdb:	0f a5 f7             	shld   %cl,%esi,%edi
+  802bde:	d3 e6                	shl    %cl,%esi
+  802be0:	f6 c1 20             	test   $0x20,%cl
+  802be3:	0f 45 fe             	cmovne %esi,%edi
+  802be6:	0f 45 f3             	cmovne %ebx,%esi
+  802be9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802bed:	09 74 24 08          	or     %esi,0x8(%esp)
+  802bf1:	83 ed 01             	sub    $0x1,%ebp
+  802bf4:	73 9a                	jae    802b90 <__divdi3+0x70>
+  802bf6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802bfa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802bfe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c02:	85 ed                	test   %ebp,%ebp
+  802c04:	0f 84 47 ff ff ff    	je     802b51 <__divdi3+0x31>
+  802c0a:	f7 d8                	neg    %eax
+  802c0c:	83 d2 00             	adc    $0x0,%edx
+  802c0f:	83 c4 1c             	add    $0x1c,%esp
+  802c12:	5b                   	pop    %ebx
+  802c13:	f7 da                	neg    %edx
+  802c15:	5e                   	pop    %esi
+  802c16:	5f                   	pop    %edi
+  802c17:	5d                   	pop    %ebp
+  802c18:	c3                   	ret
+  802c19:	f7 de                	neg    %esi
+  802c1b:	83 d7 00             	adc    $0x0,%edi
+  802c1e:	f7 df                	neg    %edi
+  802c20:	85 db                	test   %ebx,%ebx
+  802c22:	78 23                	js     802c47 <__divdi3+0x127>
+  802c24:	89 dd                	mov    %ebx,%ebp
+  802c26:	89 c8                	mov    %ecx,%eax
+  802c28:	89 da                	mov    %ebx,%edx
+  802c2a:	09 cd                	or     %ecx,%ebp
+  802c2c:	0f 84 1f ff ff ff    	je     802b51 <__divdi3+0x31>
+  802c32:	89 0c 24             	mov    %ecx,(%esp)
+  802c35:	89 f0                	mov    %esi,%eax
+  802c37:	89 fa                	mov    %edi,%edx
+  802c39:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802c3e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802c42:	e9 29 ff ff ff       	jmp    802b70 <__divdi3+0x50>
+  802c47:	31 ed                	xor    %ebp,%ebp
+  802c49:	e9 10 ff ff ff       	jmp    802b5e <__divdi3+0x3e>
+  802c4e:	89 0c 24             	mov    %ecx,(%esp)
+  802c51:	89 f0                	mov    %esi,%eax
+  802c53:	89 fa                	mov    %edi,%edx
+  802c55:	31 ed                	xor    %ebp,%ebp
+  802c57:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802c5b:	e9 10 ff ff ff       	jmp    802b70 <__divdi3+0x50>
+
+00802c60 <__moddi3>:
+  802c60:	55                   	push   %ebp
+  802c61:	57                   	push   %edi
+  802c62:	56                   	push   %esi
+  802c63:	53                   	push   %ebx
+  802c64:	83 ec 14             	sub    $0x14,%esp
+  802c67:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802c6b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802c6f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802c73:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802c77:	85 d2                	test   %edx,%edx
+  802c79:	0f 88 9b 00 00 00    	js     802d1a <__moddi3+0xba>
+  802c7f:	89 f7                	mov    %esi,%edi
+  802c81:	31 ed                	xor    %ebp,%ebp
+  802c83:	09 cf                	or     %ecx,%edi
+  802c85:	0f 84 83 00 00 00    	je     802d0e <__moddi3+0xae>
+  802c8b:	89 cb                	mov    %ecx,%ebx
+  802c8d:	89 f7                	mov    %esi,%edi
+  802c8f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802c93:	f7 db                	neg    %ebx
+  802c95:	83 d7 00             	adc    $0x0,%edi
+  802c98:	f7 df                	neg    %edi
+  802c9a:	0f 49 f7             	cmovns %edi,%esi
+  802c9d:	0f 49 cb             	cmovns %ebx,%ecx
+  802ca0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802ca4:	89 0c 24             	mov    %ecx,(%esp)
+  802ca7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802cac:	89 cd                	mov    %ecx,%ebp
+  802cae:	66 90                	xchg   %ax,%ax
+  802cb0:	89 e9                	mov    %ebp,%ecx
+  802cb2:	89 c3                	mov    %eax,%ebx
+  802cb4:	89 d6                	mov    %edx,%esi
+  802cb6:	31 ff                	xor    %edi,%edi
+  802cb8:	d3 ee                	shr    %cl,%esi
+  802cba:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802cbd:	f6 c1 20             	test   $0x20,%cl
+  802cc0:	0f 45 de             	cmovne %esi,%ebx
+  802cc3:	0f 45 f7             	cmovne %edi,%esi
+  802cc6:	8b 3c 24             	mov    (%esp),%edi
+  802cc9:	39 fb                	cmp    %edi,%ebx
+  802ccb:	89 f7                	mov    %esi,%edi
+  802ccd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802cd1:	8b 1c 24             	mov    (%esp),%ebx
+  802cd4:	19 f7                	sbb    %esi,%edi
+  802cd6:	72 1a                	jb     802cf2 <__moddi3+0x92>
+  802cd8:	89 e9                	mov    %ebp,%ecx
+  802cda:	89 f7                	mov    %esi,%edi
+  802cdc:	89 de                	mov    %ebx,%esi
+  802cde:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ce1:	d3 e6                	shl    %cl,%esi
+  802ce3:	31 db                	xor    %ebx,%ebx
+  802ce5:	f6 c1 20             	test   $0x20,%cl
+  802ce8:	0f 45 fe             	cmovne %esi,%edi
+  802ceb:	0f 45 f3             	cmovne %ebx,%esi
+  802cee:	29 f0                	sub    %esi,%eax
+  802cf0:	19 fa                	sbb    %edi,%edx
+  802cf2:	83 ed 01             	sub    $0x1,%ebp
+  802cf5:	73 b9                	jae    802cb0 <__moddi3+0x50>
+  802cf7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802cfb:	85 ed                	test   %ebp,%ebp
+  802cfd:	74 07                	je     802d06 <__moddi3+0xa6>
+  802cff:	f7 d8                	neg    %eax
+  802d01:	83 d2 00             	adc    $0x0,%edx
+  802d04:	f7 da                	neg    %edx
+  802d06:	83 c4 14             	add    $0x14,%esp
+  802d09:	5b                   	pop    %ebx
+  802d0a:	5e                   	pop    %esi
+  802d0b:	5f                   	pop    %edi
+  802d0c:	5d                   	pop    %ebp
+  802d0d:	c3                   	ret
+  802d0e:	83 c4 14             	add    $0x14,%esp
+  802d11:	31 c0                	xor    %eax,%eax
+  802d13:	31 d2                	xor    %edx,%edx
+  802d15:	5b                   	pop    %ebx
+  802d16:	5e                   	pop    %esi
+  802d17:	5f                   	pop    %edi
+  802d18:	5d                   	pop    %ebp
+  802d19:	c3                   	ret
+  802d1a:	89 f7                	mov    %esi,%edi
+  802d1c:	09 cf                	or     %ecx,%edi
+  802d1e:	74 11                	je     802d31 <__moddi3+0xd1>
+  802d20:	f7 d8                	neg    %eax
+  802d22:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802d27:	83 d2 00             	adc    $0x0,%edx
+  802d2a:	f7 da                	neg    %edx
+  802d2c:	e9 5a ff ff ff       	jmp    802c8b <__moddi3+0x2b>
+  802d31:	31 c0                	xor    %eax,%eax
+  802d33:	31 d2                	xor    %edx,%edx
+  802d35:	eb c8                	jmp    802cff <__moddi3+0x9f>
@@ -0,0 +1,6233 @@
+
+obj/user/testpiperace.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b1 01 00 00       	call   8001e2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 1c             	sub    $0x1c,%esp
+	int p[2], r, pid, i, max;
+	void *va;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for dup race...\n");
+  80003b:	68 00 2c 80 00       	push   $0x802c00
+  800040:	e8 d8 02 00 00       	call   80031d <cprintf>
+	if ((r = pipe(p)) < 0)
+  800045:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800048:	89 04 24             	mov    %eax,(%esp)
+  80004b:	e8 ed 23 00 00       	call   80243d <pipe>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 4d                	js     8000a4 <umain+0x71>
+		panic("pipe: %e", r);
+	max = 200;
+	if ((r = fork()) < 0)
+  800057:	e8 1c 12 00 00       	call   801278 <fork>
+  80005c:	89 c6                	mov    %eax,%esi
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	78 54                	js     8000b6 <umain+0x83>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800062:	74 64                	je     8000c8 <umain+0x95>
+		}
+		// do something to be not runnable besides exiting
+		ipc_recv(0,0,0);
+	}
+	pid = r;
+	cprintf("pid is %d\n", pid);
+  800064:	83 ec 08             	sub    $0x8,%esp
+  800067:	56                   	push   %esi
+  800068:	68 51 2c 80 00       	push   $0x802c51
+  80006d:	e8 ab 02 00 00       	call   80031d <cprintf>
+	va = 0;
+	kid = &envs[ENVX(pid)];
+  800072:	81 e6 ff 1f 00 00    	and    $0x1fff,%esi
+	cprintf("kid is %d\n", kid-envs);
+  800078:	83 c4 08             	add    $0x8,%esp
+  80007b:	56                   	push   %esi
+  80007c:	68 5c 2c 80 00       	push   $0x802c5c
+  800081:	e8 97 02 00 00       	call   80031d <cprintf>
+	dup(p[0], 10);
+  800086:	83 c4 08             	add    $0x8,%esp
+  800089:	6a 0a                	push   $0xa
+  80008b:	ff 75 f0             	push   -0x10(%ebp)
+  80008e:	e8 41 17 00 00       	call   8017d4 <dup>
+	while (kid->env_status == ENV_RUNNABLE)
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	c1 e6 09             	shl    $0x9,%esi
+  800099:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80009f:	e9 92 00 00 00       	jmp    800136 <umain+0x103>
+		panic("pipe: %e", r);
+  8000a4:	50                   	push   %eax
+  8000a5:	68 19 2c 80 00       	push   $0x802c19
+  8000aa:	6a 0d                	push   $0xd
+  8000ac:	68 22 2c 80 00       	push   $0x802c22
+  8000b1:	e8 8c 01 00 00       	call   800242 <_panic>
+		panic("fork: %e", r);
+  8000b6:	50                   	push   %eax
+  8000b7:	68 a4 30 80 00       	push   $0x8030a4
+  8000bc:	6a 10                	push   $0x10
+  8000be:	68 22 2c 80 00       	push   $0x802c22
+  8000c3:	e8 7a 01 00 00       	call   800242 <_panic>
+		close(p[1]);
+  8000c8:	83 ec 0c             	sub    $0xc,%esp
+  8000cb:	ff 75 f4             	push   -0xc(%ebp)
+  8000ce:	e8 af 16 00 00       	call   801782 <close>
+		for (i=0; i<max; i++) {
+  8000d3:	83 c4 10             	add    $0x10,%esp
+  8000d6:	bb c9 00 00 00       	mov    $0xc9,%ebx
+  8000db:	eb 05                	jmp    8000e2 <umain+0xaf>
+			sys_yield();
+  8000dd:	e8 16 0c 00 00       	call   800cf8 <sys_yield>
+		for (i=0; i<max; i++) {
+  8000e2:	83 eb 01             	sub    $0x1,%ebx
+  8000e5:	74 29                	je     800110 <umain+0xdd>
+			if(pipeisclosed(p[0])){
+  8000e7:	83 ec 0c             	sub    $0xc,%esp
+  8000ea:	ff 75 f0             	push   -0x10(%ebp)
+  8000ed:	e8 95 24 00 00       	call   802587 <pipeisclosed>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	85 c0                	test   %eax,%eax
+  8000f7:	74 e4                	je     8000dd <umain+0xaa>
+				cprintf("RACE: pipe appears closed\n");
+  8000f9:	83 ec 0c             	sub    $0xc,%esp
+  8000fc:	68 36 2c 80 00       	push   $0x802c36
+  800101:	e8 17 02 00 00       	call   80031d <cprintf>
+				exit();
+  800106:	e8 1d 01 00 00       	call   800228 <exit>
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	eb cd                	jmp    8000dd <umain+0xaa>
+		ipc_recv(0,0,0);
+  800110:	83 ec 04             	sub    $0x4,%esp
+  800113:	6a 00                	push   $0x0
+  800115:	6a 00                	push   $0x0
+  800117:	6a 00                	push   $0x0
+  800119:	e8 e1 13 00 00       	call   8014ff <ipc_recv>
+  80011e:	83 c4 10             	add    $0x10,%esp
+  800121:	e9 3e ff ff ff       	jmp    800064 <umain+0x31>
+		dup(p[0], 10);
+  800126:	83 ec 08             	sub    $0x8,%esp
+  800129:	6a 0a                	push   $0xa
+  80012b:	ff 75 f0             	push   -0x10(%ebp)
+  80012e:	e8 a1 16 00 00       	call   8017d4 <dup>
+  800133:	83 c4 10             	add    $0x10,%esp
+	while (kid->env_status == ENV_RUNNABLE)
+  800136:	8b 46 58             	mov    0x58(%esi),%eax
+  800139:	83 f8 02             	cmp    $0x2,%eax
+  80013c:	74 e8                	je     800126 <umain+0xf3>
+
+	cprintf("child done with loop\n");
+  80013e:	83 ec 0c             	sub    $0xc,%esp
+  800141:	68 67 2c 80 00       	push   $0x802c67
+  800146:	e8 d2 01 00 00       	call   80031d <cprintf>
+	if (pipeisclosed(p[0]))
+  80014b:	83 c4 04             	add    $0x4,%esp
+  80014e:	ff 75 f0             	push   -0x10(%ebp)
+  800151:	e8 31 24 00 00       	call   802587 <pipeisclosed>
+  800156:	83 c4 10             	add    $0x10,%esp
+  800159:	85 c0                	test   %eax,%eax
+  80015b:	75 48                	jne    8001a5 <umain+0x172>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  80015d:	83 ec 08             	sub    $0x8,%esp
+  800160:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800163:	50                   	push   %eax
+  800164:	ff 75 f0             	push   -0x10(%ebp)
+  800167:	e8 ec 14 00 00       	call   801658 <fd_lookup>
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	85 c0                	test   %eax,%eax
+  800171:	78 46                	js     8001b9 <umain+0x186>
+		panic("cannot look up p[0]: %e", r);
+	va = fd2data(fd);
+  800173:	83 ec 0c             	sub    $0xc,%esp
+  800176:	ff 75 ec             	push   -0x14(%ebp)
+  800179:	e8 6d 14 00 00       	call   8015eb <fd2data>
+	if (pageref(va) != 3+1)
+  80017e:	89 04 24             	mov    %eax,(%esp)
+  800181:	e8 40 1c 00 00       	call   801dc6 <pageref>
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	83 f8 04             	cmp    $0x4,%eax
+  80018c:	74 3d                	je     8001cb <umain+0x198>
+		cprintf("\nchild detected race\n");
+  80018e:	83 ec 0c             	sub    $0xc,%esp
+  800191:	68 95 2c 80 00       	push   $0x802c95
+  800196:	e8 82 01 00 00       	call   80031d <cprintf>
+  80019b:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("\nrace didn't happen\n", max);
+}
+  80019e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001a1:	5b                   	pop    %ebx
+  8001a2:	5e                   	pop    %esi
+  8001a3:	5d                   	pop    %ebp
+  8001a4:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001a5:	83 ec 04             	sub    $0x4,%esp
+  8001a8:	68 c0 2c 80 00       	push   $0x802cc0
+  8001ad:	6a 3a                	push   $0x3a
+  8001af:	68 22 2c 80 00       	push   $0x802c22
+  8001b4:	e8 89 00 00 00       	call   800242 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001b9:	50                   	push   %eax
+  8001ba:	68 7d 2c 80 00       	push   $0x802c7d
+  8001bf:	6a 3c                	push   $0x3c
+  8001c1:	68 22 2c 80 00       	push   $0x802c22
+  8001c6:	e8 77 00 00 00       	call   800242 <_panic>
+		cprintf("\nrace didn't happen\n", max);
+  8001cb:	83 ec 08             	sub    $0x8,%esp
+  8001ce:	68 c8 00 00 00       	push   $0xc8
+  8001d3:	68 ab 2c 80 00       	push   $0x802cab
+  8001d8:	e8 40 01 00 00       	call   80031d <cprintf>
+  8001dd:	83 c4 10             	add    $0x10,%esp
+}
+  8001e0:	eb bc                	jmp    80019e <umain+0x16b>
+
+008001e2 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001e2:	55                   	push   %ebp
+  8001e3:	89 e5                	mov    %esp,%ebp
+  8001e5:	56                   	push   %esi
+  8001e6:	53                   	push   %ebx
+  8001e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001ea:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001ed:	e8 e7 0a 00 00       	call   800cd9 <sys_getenvid>
+  8001f2:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8001f7:	c1 e0 09             	shl    $0x9,%eax
+  8001fa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ff:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800204:	85 db                	test   %ebx,%ebx
+  800206:	7e 07                	jle    80020f <libmain+0x2d>
+		binaryname = argv[0];
+  800208:	8b 06                	mov    (%esi),%eax
+  80020a:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80020f:	83 ec 08             	sub    $0x8,%esp
+  800212:	56                   	push   %esi
+  800213:	53                   	push   %ebx
+  800214:	e8 1a fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800219:	e8 0a 00 00 00       	call   800228 <exit>
+}
+  80021e:	83 c4 10             	add    $0x10,%esp
+  800221:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800224:	5b                   	pop    %ebx
+  800225:	5e                   	pop    %esi
+  800226:	5d                   	pop    %ebp
+  800227:	c3                   	ret
+
+00800228 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800228:	55                   	push   %ebp
+  800229:	89 e5                	mov    %esp,%ebp
+  80022b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80022e:	e8 7c 15 00 00       	call   8017af <close_all>
+	sys_env_destroy(0);
+  800233:	83 ec 0c             	sub    $0xc,%esp
+  800236:	6a 00                	push   $0x0
+  800238:	e8 5b 0a 00 00       	call   800c98 <sys_env_destroy>
+}
+  80023d:	83 c4 10             	add    $0x10,%esp
+  800240:	c9                   	leave
+  800241:	c3                   	ret
+
+00800242 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800242:	55                   	push   %ebp
+  800243:	89 e5                	mov    %esp,%ebp
+  800245:	56                   	push   %esi
+  800246:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800247:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80024a:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800250:	e8 84 0a 00 00       	call   800cd9 <sys_getenvid>
+  800255:	83 ec 0c             	sub    $0xc,%esp
+  800258:	ff 75 0c             	push   0xc(%ebp)
+  80025b:	ff 75 08             	push   0x8(%ebp)
+  80025e:	56                   	push   %esi
+  80025f:	50                   	push   %eax
+  800260:	68 f4 2c 80 00       	push   $0x802cf4
+  800265:	e8 b3 00 00 00       	call   80031d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80026a:	83 c4 18             	add    $0x18,%esp
+  80026d:	53                   	push   %ebx
+  80026e:	ff 75 10             	push   0x10(%ebp)
+  800271:	e8 56 00 00 00       	call   8002cc <vcprintf>
+	cprintf("\n");
+  800276:	c7 04 24 17 2c 80 00 	movl   $0x802c17,(%esp)
+  80027d:	e8 9b 00 00 00       	call   80031d <cprintf>
+  800282:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800285:	cc                   	int3
+	while (1)
+  800286:	eb fd                	jmp    800285 <_panic+0x43>
+
+00800288 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800288:	55                   	push   %ebp
+  800289:	89 e5                	mov    %esp,%ebp
+  80028b:	53                   	push   %ebx
+  80028c:	83 ec 04             	sub    $0x4,%esp
+  80028f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800292:	8b 13                	mov    (%ebx),%edx
+  800294:	8d 42 01             	lea    0x1(%edx),%eax
+  800297:	89 03                	mov    %eax,(%ebx)
+  800299:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80029c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002a0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002a5:	74 09                	je     8002b0 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002a7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002b0:	83 ec 08             	sub    $0x8,%esp
+  8002b3:	68 ff 00 00 00       	push   $0xff
+  8002b8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002bb:	50                   	push   %eax
+  8002bc:	e8 7a 09 00 00       	call   800c3b <sys_cputs>
+		b->idx = 0;
+  8002c1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002c7:	83 c4 10             	add    $0x10,%esp
+  8002ca:	eb db                	jmp    8002a7 <putch+0x1f>
+
+008002cc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002d5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002dc:	00 00 00 
+	b.cnt = 0;
+  8002df:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002e6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002e9:	ff 75 0c             	push   0xc(%ebp)
+  8002ec:	ff 75 08             	push   0x8(%ebp)
+  8002ef:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002f5:	50                   	push   %eax
+  8002f6:	68 88 02 80 00       	push   $0x800288
+  8002fb:	e8 14 01 00 00       	call   800414 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800300:	83 c4 08             	add    $0x8,%esp
+  800303:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800309:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80030f:	50                   	push   %eax
+  800310:	e8 26 09 00 00       	call   800c3b <sys_cputs>
+
+	return b.cnt;
+}
+  800315:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80031b:	c9                   	leave
+  80031c:	c3                   	ret
+
+0080031d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80031d:	55                   	push   %ebp
+  80031e:	89 e5                	mov    %esp,%ebp
+  800320:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800323:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800326:	50                   	push   %eax
+  800327:	ff 75 08             	push   0x8(%ebp)
+  80032a:	e8 9d ff ff ff       	call   8002cc <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80032f:	c9                   	leave
+  800330:	c3                   	ret
+
+00800331 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	57                   	push   %edi
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	83 ec 1c             	sub    $0x1c,%esp
+  80033a:	89 c7                	mov    %eax,%edi
+  80033c:	89 d6                	mov    %edx,%esi
+  80033e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800341:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800344:	89 d1                	mov    %edx,%ecx
+  800346:	89 c2                	mov    %eax,%edx
+  800348:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80034b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80034e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800351:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800354:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800357:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80035e:	39 c2                	cmp    %eax,%edx
+  800360:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800363:	72 3e                	jb     8003a3 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800365:	83 ec 0c             	sub    $0xc,%esp
+  800368:	ff 75 18             	push   0x18(%ebp)
+  80036b:	83 eb 01             	sub    $0x1,%ebx
+  80036e:	53                   	push   %ebx
+  80036f:	50                   	push   %eax
+  800370:	83 ec 08             	sub    $0x8,%esp
+  800373:	ff 75 e4             	push   -0x1c(%ebp)
+  800376:	ff 75 e0             	push   -0x20(%ebp)
+  800379:	ff 75 dc             	push   -0x24(%ebp)
+  80037c:	ff 75 d8             	push   -0x28(%ebp)
+  80037f:	e8 0c 25 00 00       	call   802890 <__udivdi3>
+  800384:	83 c4 18             	add    $0x18,%esp
+  800387:	52                   	push   %edx
+  800388:	50                   	push   %eax
+  800389:	89 f2                	mov    %esi,%edx
+  80038b:	89 f8                	mov    %edi,%eax
+  80038d:	e8 9f ff ff ff       	call   800331 <printnum>
+  800392:	83 c4 20             	add    $0x20,%esp
+  800395:	eb 13                	jmp    8003aa <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800397:	83 ec 08             	sub    $0x8,%esp
+  80039a:	56                   	push   %esi
+  80039b:	ff 75 18             	push   0x18(%ebp)
+  80039e:	ff d7                	call   *%edi
+  8003a0:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003a3:	83 eb 01             	sub    $0x1,%ebx
+  8003a6:	85 db                	test   %ebx,%ebx
+  8003a8:	7f ed                	jg     800397 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003aa:	83 ec 08             	sub    $0x8,%esp
+  8003ad:	56                   	push   %esi
+  8003ae:	83 ec 04             	sub    $0x4,%esp
+  8003b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8003b4:	ff 75 e0             	push   -0x20(%ebp)
+  8003b7:	ff 75 dc             	push   -0x24(%ebp)
+  8003ba:	ff 75 d8             	push   -0x28(%ebp)
+  8003bd:	e8 8e 25 00 00       	call   802950 <__umoddi3>
+  8003c2:	83 c4 14             	add    $0x14,%esp
+  8003c5:	0f be 80 17 2d 80 00 	movsbl 0x802d17(%eax),%eax
+  8003cc:	50                   	push   %eax
+  8003cd:	ff d7                	call   *%edi
+}
+  8003cf:	83 c4 10             	add    $0x10,%esp
+  8003d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d5:	5b                   	pop    %ebx
+  8003d6:	5e                   	pop    %esi
+  8003d7:	5f                   	pop    %edi
+  8003d8:	5d                   	pop    %ebp
+  8003d9:	c3                   	ret
+
+008003da <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003da:	55                   	push   %ebp
+  8003db:	89 e5                	mov    %esp,%ebp
+  8003dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003e0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003e4:	8b 10                	mov    (%eax),%edx
+  8003e6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003e9:	73 0a                	jae    8003f5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003eb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003ee:	89 08                	mov    %ecx,(%eax)
+  8003f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003f3:	88 02                	mov    %al,(%edx)
+}
+  8003f5:	5d                   	pop    %ebp
+  8003f6:	c3                   	ret
+
+008003f7 <printfmt>:
+{
+  8003f7:	55                   	push   %ebp
+  8003f8:	89 e5                	mov    %esp,%ebp
+  8003fa:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003fd:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800400:	50                   	push   %eax
+  800401:	ff 75 10             	push   0x10(%ebp)
+  800404:	ff 75 0c             	push   0xc(%ebp)
+  800407:	ff 75 08             	push   0x8(%ebp)
+  80040a:	e8 05 00 00 00       	call   800414 <vprintfmt>
+}
+  80040f:	83 c4 10             	add    $0x10,%esp
+  800412:	c9                   	leave
+  800413:	c3                   	ret
+
+00800414 <vprintfmt>:
+{
+  800414:	55                   	push   %ebp
+  800415:	89 e5                	mov    %esp,%ebp
+  800417:	57                   	push   %edi
+  800418:	56                   	push   %esi
+  800419:	53                   	push   %ebx
+  80041a:	83 ec 2c             	sub    $0x2c,%esp
+  80041d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800420:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800423:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800426:	eb 0a                	jmp    800432 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800428:	83 ec 08             	sub    $0x8,%esp
+  80042b:	53                   	push   %ebx
+  80042c:	50                   	push   %eax
+  80042d:	ff d6                	call   *%esi
+  80042f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800432:	83 c7 01             	add    $0x1,%edi
+  800435:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800439:	83 f8 25             	cmp    $0x25,%eax
+  80043c:	74 0c                	je     80044a <vprintfmt+0x36>
+			if (ch == '\0')
+  80043e:	85 c0                	test   %eax,%eax
+  800440:	75 e6                	jne    800428 <vprintfmt+0x14>
+}
+  800442:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800445:	5b                   	pop    %ebx
+  800446:	5e                   	pop    %esi
+  800447:	5f                   	pop    %edi
+  800448:	5d                   	pop    %ebp
+  800449:	c3                   	ret
+		padc = ' ';
+  80044a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80044e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800455:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80045c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800463:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800468:	8d 47 01             	lea    0x1(%edi),%eax
+  80046b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80046e:	0f b6 17             	movzbl (%edi),%edx
+  800471:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800474:	3c 55                	cmp    $0x55,%al
+  800476:	0f 87 cf 03 00 00    	ja     80084b <vprintfmt+0x437>
+  80047c:	0f b6 c0             	movzbl %al,%eax
+  80047f:	ff 24 85 60 2e 80 00 	jmp    *0x802e60(,%eax,4)
+  800486:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800489:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80048d:	eb d9                	jmp    800468 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80048f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800492:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800496:	eb d0                	jmp    800468 <vprintfmt+0x54>
+  800498:	0f b6 d2             	movzbl %dl,%edx
+  80049b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80049e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004a6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004a9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004ad:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004b0:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004b3:	83 f9 09             	cmp    $0x9,%ecx
+  8004b6:	77 55                	ja     80050d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004b8:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004bb:	eb e9                	jmp    8004a6 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c0:	8b 00                	mov    (%eax),%eax
+  8004c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8004cb:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004d1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004d5:	79 91                	jns    800468 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004d7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004dd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004e4:	eb 82                	jmp    800468 <vprintfmt+0x54>
+			if (width < 0)
+  8004e6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e9:	85 d2                	test   %edx,%edx
+  8004eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f0:	0f 49 c2             	cmovns %edx,%eax
+  8004f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004f9:	e9 6a ff ff ff       	jmp    800468 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800501:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800508:	e9 5b ff ff ff       	jmp    800468 <vprintfmt+0x54>
+  80050d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800510:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800513:	eb bc                	jmp    8004d1 <vprintfmt+0xbd>
+			lflag++;
+  800515:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800518:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80051b:	e9 48 ff ff ff       	jmp    800468 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800520:	8b 45 14             	mov    0x14(%ebp),%eax
+  800523:	8d 78 04             	lea    0x4(%eax),%edi
+  800526:	83 ec 08             	sub    $0x8,%esp
+  800529:	53                   	push   %ebx
+  80052a:	ff 30                	push   (%eax)
+  80052c:	ff d6                	call   *%esi
+			break;
+  80052e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800531:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800534:	e9 b1 02 00 00       	jmp    8007ea <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800539:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80053f:	8b 10                	mov    (%eax),%edx
+  800541:	89 d0                	mov    %edx,%eax
+  800543:	f7 d8                	neg    %eax
+  800545:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800548:	83 f8 0f             	cmp    $0xf,%eax
+  80054b:	7f 23                	jg     800570 <vprintfmt+0x15c>
+  80054d:	8b 14 85 c0 2f 80 00 	mov    0x802fc0(,%eax,4),%edx
+  800554:	85 d2                	test   %edx,%edx
+  800556:	74 18                	je     800570 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800558:	52                   	push   %edx
+  800559:	68 09 32 80 00       	push   $0x803209
+  80055e:	53                   	push   %ebx
+  80055f:	56                   	push   %esi
+  800560:	e8 92 fe ff ff       	call   8003f7 <printfmt>
+  800565:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800568:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80056b:	e9 7a 02 00 00       	jmp    8007ea <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800570:	50                   	push   %eax
+  800571:	68 2f 2d 80 00       	push   $0x802d2f
+  800576:	53                   	push   %ebx
+  800577:	56                   	push   %esi
+  800578:	e8 7a fe ff ff       	call   8003f7 <printfmt>
+  80057d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800580:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800583:	e9 62 02 00 00       	jmp    8007ea <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058b:	83 c0 04             	add    $0x4,%eax
+  80058e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800596:	85 c9                	test   %ecx,%ecx
+  800598:	b8 28 2d 80 00       	mov    $0x802d28,%eax
+  80059d:	0f 45 c1             	cmovne %ecx,%eax
+  8005a0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005a3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005a7:	7e 06                	jle    8005af <vprintfmt+0x19b>
+  8005a9:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005ad:	75 0b                	jne    8005ba <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005af:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005b2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005b5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005b8:	eb 5c                	jmp    800616 <vprintfmt+0x202>
+  8005ba:	83 ec 08             	sub    $0x8,%esp
+  8005bd:	ff 75 d0             	push   -0x30(%ebp)
+  8005c0:	ff 75 cc             	push   -0x34(%ebp)
+  8005c3:	e8 20 03 00 00       	call   8008e8 <strnlen>
+  8005c8:	89 c2                	mov    %eax,%edx
+  8005ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005cd:	29 d0                	sub    %edx,%eax
+  8005cf:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005d2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005dc:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005de:	eb 0e                	jmp    8005ee <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005e0:	83 ec 08             	sub    $0x8,%esp
+  8005e3:	53                   	push   %ebx
+  8005e4:	57                   	push   %edi
+  8005e5:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005e8:	83 ee 01             	sub    $0x1,%esi
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	85 f6                	test   %esi,%esi
+  8005f0:	7f ee                	jg     8005e0 <vprintfmt+0x1cc>
+  8005f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005f8:	85 c0                	test   %eax,%eax
+  8005fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ff:	0f 49 d0             	cmovns %eax,%edx
+  800602:	29 d0                	sub    %edx,%eax
+  800604:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800607:	eb a6                	jmp    8005af <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800609:	83 ec 08             	sub    $0x8,%esp
+  80060c:	53                   	push   %ebx
+  80060d:	52                   	push   %edx
+  80060e:	ff 55 08             	call   *0x8(%ebp)
+  800611:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800614:	89 f1                	mov    %esi,%ecx
+  800616:	8d 71 01             	lea    0x1(%ecx),%esi
+  800619:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80061d:	0f be d0             	movsbl %al,%edx
+  800620:	85 d2                	test   %edx,%edx
+  800622:	74 28                	je     80064c <vprintfmt+0x238>
+  800624:	85 ff                	test   %edi,%edi
+  800626:	78 05                	js     80062d <vprintfmt+0x219>
+  800628:	83 ef 01             	sub    $0x1,%edi
+  80062b:	78 30                	js     80065d <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80062d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800631:	74 d6                	je     800609 <vprintfmt+0x1f5>
+  800633:	0f be c0             	movsbl %al,%eax
+  800636:	83 e8 20             	sub    $0x20,%eax
+  800639:	83 f8 5e             	cmp    $0x5e,%eax
+  80063c:	76 cb                	jbe    800609 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80063e:	83 ec 08             	sub    $0x8,%esp
+  800641:	53                   	push   %ebx
+  800642:	6a 3f                	push   $0x3f
+  800644:	ff 55 08             	call   *0x8(%ebp)
+  800647:	83 c4 10             	add    $0x10,%esp
+  80064a:	eb c8                	jmp    800614 <vprintfmt+0x200>
+  80064c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800652:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800655:	01 d0                	add    %edx,%eax
+  800657:	29 c8                	sub    %ecx,%eax
+  800659:	89 c7                	mov    %eax,%edi
+  80065b:	eb 13                	jmp    800670 <vprintfmt+0x25c>
+  80065d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800660:	eb ed                	jmp    80064f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800662:	83 ec 08             	sub    $0x8,%esp
+  800665:	53                   	push   %ebx
+  800666:	6a 20                	push   $0x20
+  800668:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80066a:	83 ef 01             	sub    $0x1,%edi
+  80066d:	83 c4 10             	add    $0x10,%esp
+  800670:	85 ff                	test   %edi,%edi
+  800672:	7f ee                	jg     800662 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800674:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800677:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067a:	e9 6b 01 00 00       	jmp    8007ea <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80067f:	83 f9 01             	cmp    $0x1,%ecx
+  800682:	7f 1f                	jg     8006a3 <vprintfmt+0x28f>
+	else if (lflag)
+  800684:	85 c9                	test   %ecx,%ecx
+  800686:	74 67                	je     8006ef <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8b 00                	mov    (%eax),%eax
+  80068d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800690:	89 c1                	mov    %eax,%ecx
+  800692:	c1 f9 1f             	sar    $0x1f,%ecx
+  800695:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8d 40 04             	lea    0x4(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a1:	eb 17                	jmp    8006ba <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 50 04             	mov    0x4(%eax),%edx
+  8006a9:	8b 00                	mov    (%eax),%eax
+  8006ab:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ae:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006ba:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006bd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006c0:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006c5:	85 c9                	test   %ecx,%ecx
+  8006c7:	0f 89 03 01 00 00    	jns    8007d0 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006cd:	83 ec 08             	sub    $0x8,%esp
+  8006d0:	53                   	push   %ebx
+  8006d1:	6a 2d                	push   $0x2d
+  8006d3:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006d5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006d8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006db:	f7 da                	neg    %edx
+  8006dd:	83 d1 00             	adc    $0x0,%ecx
+  8006e0:	f7 d9                	neg    %ecx
+  8006e2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006e5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006ea:	e9 e1 00 00 00       	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f2:	8b 00                	mov    (%eax),%eax
+  8006f4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006f7:	89 c1                	mov    %eax,%ecx
+  8006f9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800702:	8d 40 04             	lea    0x4(%eax),%eax
+  800705:	89 45 14             	mov    %eax,0x14(%ebp)
+  800708:	eb b0                	jmp    8006ba <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80070a:	83 f9 01             	cmp    $0x1,%ecx
+  80070d:	7f 1e                	jg     80072d <vprintfmt+0x319>
+	else if (lflag)
+  80070f:	85 c9                	test   %ecx,%ecx
+  800711:	74 32                	je     800745 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800713:	8b 45 14             	mov    0x14(%ebp),%eax
+  800716:	8b 10                	mov    (%eax),%edx
+  800718:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071d:	8d 40 04             	lea    0x4(%eax),%eax
+  800720:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800723:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800728:	e9 a3 00 00 00       	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80072d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800730:	8b 10                	mov    (%eax),%edx
+  800732:	8b 48 04             	mov    0x4(%eax),%ecx
+  800735:	8d 40 08             	lea    0x8(%eax),%eax
+  800738:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80073b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800740:	e9 8b 00 00 00       	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8b 10                	mov    (%eax),%edx
+  80074a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074f:	8d 40 04             	lea    0x4(%eax),%eax
+  800752:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800755:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80075a:	eb 74                	jmp    8007d0 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80075c:	83 f9 01             	cmp    $0x1,%ecx
+  80075f:	7f 1b                	jg     80077c <vprintfmt+0x368>
+	else if (lflag)
+  800761:	85 c9                	test   %ecx,%ecx
+  800763:	74 2c                	je     800791 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800765:	8b 45 14             	mov    0x14(%ebp),%eax
+  800768:	8b 10                	mov    (%eax),%edx
+  80076a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076f:	8d 40 04             	lea    0x4(%eax),%eax
+  800772:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800775:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80077a:	eb 54                	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80077c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077f:	8b 10                	mov    (%eax),%edx
+  800781:	8b 48 04             	mov    0x4(%eax),%ecx
+  800784:	8d 40 08             	lea    0x8(%eax),%eax
+  800787:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80078a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80078f:	eb 3f                	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800791:	8b 45 14             	mov    0x14(%ebp),%eax
+  800794:	8b 10                	mov    (%eax),%edx
+  800796:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80079b:	8d 40 04             	lea    0x4(%eax),%eax
+  80079e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007a1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007a6:	eb 28                	jmp    8007d0 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8007a8:	83 ec 08             	sub    $0x8,%esp
+  8007ab:	53                   	push   %ebx
+  8007ac:	6a 30                	push   $0x30
+  8007ae:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007b0:	83 c4 08             	add    $0x8,%esp
+  8007b3:	53                   	push   %ebx
+  8007b4:	6a 78                	push   $0x78
+  8007b6:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bb:	8b 10                	mov    (%eax),%edx
+  8007bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007c2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007cb:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007d0:	83 ec 0c             	sub    $0xc,%esp
+  8007d3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007d7:	50                   	push   %eax
+  8007d8:	ff 75 e0             	push   -0x20(%ebp)
+  8007db:	57                   	push   %edi
+  8007dc:	51                   	push   %ecx
+  8007dd:	52                   	push   %edx
+  8007de:	89 da                	mov    %ebx,%edx
+  8007e0:	89 f0                	mov    %esi,%eax
+  8007e2:	e8 4a fb ff ff       	call   800331 <printnum>
+			break;
+  8007e7:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007ed:	e9 40 fc ff ff       	jmp    800432 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007f2:	83 f9 01             	cmp    $0x1,%ecx
+  8007f5:	7f 1b                	jg     800812 <vprintfmt+0x3fe>
+	else if (lflag)
+  8007f7:	85 c9                	test   %ecx,%ecx
+  8007f9:	74 2c                	je     800827 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fe:	8b 10                	mov    (%eax),%edx
+  800800:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800805:	8d 40 04             	lea    0x4(%eax),%eax
+  800808:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800810:	eb be                	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800812:	8b 45 14             	mov    0x14(%ebp),%eax
+  800815:	8b 10                	mov    (%eax),%edx
+  800817:	8b 48 04             	mov    0x4(%eax),%ecx
+  80081a:	8d 40 08             	lea    0x8(%eax),%eax
+  80081d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800820:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800825:	eb a9                	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800827:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082a:	8b 10                	mov    (%eax),%edx
+  80082c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800831:	8d 40 04             	lea    0x4(%eax),%eax
+  800834:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800837:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80083c:	eb 92                	jmp    8007d0 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80083e:	83 ec 08             	sub    $0x8,%esp
+  800841:	53                   	push   %ebx
+  800842:	6a 25                	push   $0x25
+  800844:	ff d6                	call   *%esi
+			break;
+  800846:	83 c4 10             	add    $0x10,%esp
+  800849:	eb 9f                	jmp    8007ea <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80084b:	83 ec 08             	sub    $0x8,%esp
+  80084e:	53                   	push   %ebx
+  80084f:	6a 25                	push   $0x25
+  800851:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800853:	83 c4 10             	add    $0x10,%esp
+  800856:	89 f8                	mov    %edi,%eax
+  800858:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80085c:	74 05                	je     800863 <vprintfmt+0x44f>
+  80085e:	83 e8 01             	sub    $0x1,%eax
+  800861:	eb f5                	jmp    800858 <vprintfmt+0x444>
+  800863:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800866:	eb 82                	jmp    8007ea <vprintfmt+0x3d6>
+
+00800868 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800868:	55                   	push   %ebp
+  800869:	89 e5                	mov    %esp,%ebp
+  80086b:	83 ec 18             	sub    $0x18,%esp
+  80086e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800871:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800874:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800877:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80087b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80087e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800885:	85 c0                	test   %eax,%eax
+  800887:	74 26                	je     8008af <vsnprintf+0x47>
+  800889:	85 d2                	test   %edx,%edx
+  80088b:	7e 22                	jle    8008af <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80088d:	ff 75 14             	push   0x14(%ebp)
+  800890:	ff 75 10             	push   0x10(%ebp)
+  800893:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800896:	50                   	push   %eax
+  800897:	68 da 03 80 00       	push   $0x8003da
+  80089c:	e8 73 fb ff ff       	call   800414 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008a1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008a4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008aa:	83 c4 10             	add    $0x10,%esp
+}
+  8008ad:	c9                   	leave
+  8008ae:	c3                   	ret
+		return -E_INVAL;
+  8008af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008b4:	eb f7                	jmp    8008ad <vsnprintf+0x45>
+
+008008b6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008b6:	55                   	push   %ebp
+  8008b7:	89 e5                	mov    %esp,%ebp
+  8008b9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008bc:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008bf:	50                   	push   %eax
+  8008c0:	ff 75 10             	push   0x10(%ebp)
+  8008c3:	ff 75 0c             	push   0xc(%ebp)
+  8008c6:	ff 75 08             	push   0x8(%ebp)
+  8008c9:	e8 9a ff ff ff       	call   800868 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008ce:	c9                   	leave
+  8008cf:	c3                   	ret
+
+008008d0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008d0:	55                   	push   %ebp
+  8008d1:	89 e5                	mov    %esp,%ebp
+  8008d3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008db:	eb 03                	jmp    8008e0 <strlen+0x10>
+		n++;
+  8008dd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008e0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008e4:	75 f7                	jne    8008dd <strlen+0xd>
+	return n;
+}
+  8008e6:	5d                   	pop    %ebp
+  8008e7:	c3                   	ret
+
+008008e8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008e8:	55                   	push   %ebp
+  8008e9:	89 e5                	mov    %esp,%ebp
+  8008eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f6:	eb 03                	jmp    8008fb <strnlen+0x13>
+		n++;
+  8008f8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008fb:	39 d0                	cmp    %edx,%eax
+  8008fd:	74 08                	je     800907 <strnlen+0x1f>
+  8008ff:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800903:	75 f3                	jne    8008f8 <strnlen+0x10>
+  800905:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800907:	89 d0                	mov    %edx,%eax
+  800909:	5d                   	pop    %ebp
+  80090a:	c3                   	ret
+
+0080090b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80090b:	55                   	push   %ebp
+  80090c:	89 e5                	mov    %esp,%ebp
+  80090e:	53                   	push   %ebx
+  80090f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800912:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800915:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80091e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800921:	83 c0 01             	add    $0x1,%eax
+  800924:	84 d2                	test   %dl,%dl
+  800926:	75 f2                	jne    80091a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800928:	89 c8                	mov    %ecx,%eax
+  80092a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092d:	c9                   	leave
+  80092e:	c3                   	ret
+
+0080092f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	53                   	push   %ebx
+  800933:	83 ec 10             	sub    $0x10,%esp
+  800936:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800939:	53                   	push   %ebx
+  80093a:	e8 91 ff ff ff       	call   8008d0 <strlen>
+  80093f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800942:	ff 75 0c             	push   0xc(%ebp)
+  800945:	01 d8                	add    %ebx,%eax
+  800947:	50                   	push   %eax
+  800948:	e8 be ff ff ff       	call   80090b <strcpy>
+	return dst;
+}
+  80094d:	89 d8                	mov    %ebx,%eax
+  80094f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800952:	c9                   	leave
+  800953:	c3                   	ret
+
+00800954 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800954:	55                   	push   %ebp
+  800955:	89 e5                	mov    %esp,%ebp
+  800957:	56                   	push   %esi
+  800958:	53                   	push   %ebx
+  800959:	8b 75 08             	mov    0x8(%ebp),%esi
+  80095c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80095f:	89 f3                	mov    %esi,%ebx
+  800961:	03 5d 10             	add    0x10(%ebp),%ebx
+  800964:	89 f0                	mov    %esi,%eax
+  800966:	eb 0f                	jmp    800977 <strncpy+0x23>
+		*dst++ = *src;
+  800968:	83 c0 01             	add    $0x1,%eax
+  80096b:	0f b6 0a             	movzbl (%edx),%ecx
+  80096e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800971:	80 f9 01             	cmp    $0x1,%cl
+  800974:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800977:	39 d8                	cmp    %ebx,%eax
+  800979:	75 ed                	jne    800968 <strncpy+0x14>
+	}
+	return ret;
+}
+  80097b:	89 f0                	mov    %esi,%eax
+  80097d:	5b                   	pop    %ebx
+  80097e:	5e                   	pop    %esi
+  80097f:	5d                   	pop    %ebp
+  800980:	c3                   	ret
+
+00800981 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800981:	55                   	push   %ebp
+  800982:	89 e5                	mov    %esp,%ebp
+  800984:	56                   	push   %esi
+  800985:	53                   	push   %ebx
+  800986:	8b 75 08             	mov    0x8(%ebp),%esi
+  800989:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80098c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80098f:	89 f0                	mov    %esi,%eax
+  800991:	85 d2                	test   %edx,%edx
+  800993:	74 21                	je     8009b6 <strlcpy+0x35>
+  800995:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800999:	89 f2                	mov    %esi,%edx
+  80099b:	eb 09                	jmp    8009a6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80099d:	83 c1 01             	add    $0x1,%ecx
+  8009a0:	83 c2 01             	add    $0x1,%edx
+  8009a3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009a6:	39 c2                	cmp    %eax,%edx
+  8009a8:	74 09                	je     8009b3 <strlcpy+0x32>
+  8009aa:	0f b6 19             	movzbl (%ecx),%ebx
+  8009ad:	84 db                	test   %bl,%bl
+  8009af:	75 ec                	jne    80099d <strlcpy+0x1c>
+  8009b1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009b3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009b6:	29 f0                	sub    %esi,%eax
+}
+  8009b8:	5b                   	pop    %ebx
+  8009b9:	5e                   	pop    %esi
+  8009ba:	5d                   	pop    %ebp
+  8009bb:	c3                   	ret
+
+008009bc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009bc:	55                   	push   %ebp
+  8009bd:	89 e5                	mov    %esp,%ebp
+  8009bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009c5:	eb 06                	jmp    8009cd <strcmp+0x11>
+		p++, q++;
+  8009c7:	83 c1 01             	add    $0x1,%ecx
+  8009ca:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009cd:	0f b6 01             	movzbl (%ecx),%eax
+  8009d0:	84 c0                	test   %al,%al
+  8009d2:	74 04                	je     8009d8 <strcmp+0x1c>
+  8009d4:	3a 02                	cmp    (%edx),%al
+  8009d6:	74 ef                	je     8009c7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009d8:	0f b6 c0             	movzbl %al,%eax
+  8009db:	0f b6 12             	movzbl (%edx),%edx
+  8009de:	29 d0                	sub    %edx,%eax
+}
+  8009e0:	5d                   	pop    %ebp
+  8009e1:	c3                   	ret
+
+008009e2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009e2:	55                   	push   %ebp
+  8009e3:	89 e5                	mov    %esp,%ebp
+  8009e5:	53                   	push   %ebx
+  8009e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ec:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009ef:	eb 09                	jmp    8009fa <strncmp+0x18>
+		n--, p++, q++;
+  8009f1:	83 ea 01             	sub    $0x1,%edx
+  8009f4:	83 c0 01             	add    $0x1,%eax
+  8009f7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009fa:	85 d2                	test   %edx,%edx
+  8009fc:	74 18                	je     800a16 <strncmp+0x34>
+  8009fe:	0f b6 18             	movzbl (%eax),%ebx
+  800a01:	84 db                	test   %bl,%bl
+  800a03:	74 04                	je     800a09 <strncmp+0x27>
+  800a05:	3a 19                	cmp    (%ecx),%bl
+  800a07:	74 e8                	je     8009f1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a09:	0f b6 00             	movzbl (%eax),%eax
+  800a0c:	0f b6 11             	movzbl (%ecx),%edx
+  800a0f:	29 d0                	sub    %edx,%eax
+}
+  800a11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a14:	c9                   	leave
+  800a15:	c3                   	ret
+		return 0;
+  800a16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1b:	eb f4                	jmp    800a11 <strncmp+0x2f>
+
+00800a1d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a1d:	55                   	push   %ebp
+  800a1e:	89 e5                	mov    %esp,%ebp
+  800a20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a23:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a27:	eb 03                	jmp    800a2c <strchr+0xf>
+  800a29:	83 c0 01             	add    $0x1,%eax
+  800a2c:	0f b6 10             	movzbl (%eax),%edx
+  800a2f:	84 d2                	test   %dl,%dl
+  800a31:	74 06                	je     800a39 <strchr+0x1c>
+		if (*s == c)
+  800a33:	38 ca                	cmp    %cl,%dl
+  800a35:	75 f2                	jne    800a29 <strchr+0xc>
+  800a37:	eb 05                	jmp    800a3e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a3e:	5d                   	pop    %ebp
+  800a3f:	c3                   	ret
+
+00800a40 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a40:	55                   	push   %ebp
+  800a41:	89 e5                	mov    %esp,%ebp
+  800a43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a46:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a4a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a4d:	38 ca                	cmp    %cl,%dl
+  800a4f:	74 09                	je     800a5a <strfind+0x1a>
+  800a51:	84 d2                	test   %dl,%dl
+  800a53:	74 05                	je     800a5a <strfind+0x1a>
+	for (; *s; s++)
+  800a55:	83 c0 01             	add    $0x1,%eax
+  800a58:	eb f0                	jmp    800a4a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a5a:	5d                   	pop    %ebp
+  800a5b:	c3                   	ret
+
+00800a5c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a5c:	55                   	push   %ebp
+  800a5d:	89 e5                	mov    %esp,%ebp
+  800a5f:	57                   	push   %edi
+  800a60:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a63:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a66:	85 c9                	test   %ecx,%ecx
+  800a68:	74 20                	je     800a8a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a6a:	89 f8                	mov    %edi,%eax
+  800a6c:	09 c8                	or     %ecx,%eax
+  800a6e:	a8 03                	test   $0x3,%al
+  800a70:	75 12                	jne    800a84 <memset+0x28>
+		c &= 0xFF;
+  800a72:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a76:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a7c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a7f:	fc                   	cld
+  800a80:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a82:	eb 06                	jmp    800a8a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a87:	fc                   	cld
+  800a88:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a8a:	89 f8                	mov    %edi,%eax
+  800a8c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a8f:	c9                   	leave
+  800a90:	c3                   	ret
+
+00800a91 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	57                   	push   %edi
+  800a95:	56                   	push   %esi
+  800a96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a99:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a9c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a9f:	39 c6                	cmp    %eax,%esi
+  800aa1:	73 32                	jae    800ad5 <memmove+0x44>
+  800aa3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aa6:	39 d0                	cmp    %edx,%eax
+  800aa8:	73 2b                	jae    800ad5 <memmove+0x44>
+		s += n;
+		d += n;
+  800aaa:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aad:	89 d6                	mov    %edx,%esi
+  800aaf:	09 fe                	or     %edi,%esi
+  800ab1:	09 ce                	or     %ecx,%esi
+  800ab3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ab9:	75 0e                	jne    800ac9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800abb:	83 ef 04             	sub    $0x4,%edi
+  800abe:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ac1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ac4:	fd                   	std
+  800ac5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ac7:	eb 09                	jmp    800ad2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ac9:	83 ef 01             	sub    $0x1,%edi
+  800acc:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800acf:	fd                   	std
+  800ad0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ad2:	fc                   	cld
+  800ad3:	eb 1a                	jmp    800aef <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ad5:	89 f2                	mov    %esi,%edx
+  800ad7:	09 c2                	or     %eax,%edx
+  800ad9:	09 ca                	or     %ecx,%edx
+  800adb:	f6 c2 03             	test   $0x3,%dl
+  800ade:	75 0a                	jne    800aea <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ae0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ae3:	89 c7                	mov    %eax,%edi
+  800ae5:	fc                   	cld
+  800ae6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ae8:	eb 05                	jmp    800aef <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aea:	89 c7                	mov    %eax,%edi
+  800aec:	fc                   	cld
+  800aed:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aef:	5e                   	pop    %esi
+  800af0:	5f                   	pop    %edi
+  800af1:	5d                   	pop    %ebp
+  800af2:	c3                   	ret
+
+00800af3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800af9:	ff 75 10             	push   0x10(%ebp)
+  800afc:	ff 75 0c             	push   0xc(%ebp)
+  800aff:	ff 75 08             	push   0x8(%ebp)
+  800b02:	e8 8a ff ff ff       	call   800a91 <memmove>
+}
+  800b07:	c9                   	leave
+  800b08:	c3                   	ret
+
+00800b09 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b09:	55                   	push   %ebp
+  800b0a:	89 e5                	mov    %esp,%ebp
+  800b0c:	56                   	push   %esi
+  800b0d:	53                   	push   %ebx
+  800b0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b11:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b14:	89 c6                	mov    %eax,%esi
+  800b16:	03 75 10             	add    0x10(%ebp),%esi
+  800b19:	eb 06                	jmp    800b21 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b1b:	83 c0 01             	add    $0x1,%eax
+  800b1e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b21:	39 f0                	cmp    %esi,%eax
+  800b23:	74 14                	je     800b39 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b25:	0f b6 08             	movzbl (%eax),%ecx
+  800b28:	0f b6 1a             	movzbl (%edx),%ebx
+  800b2b:	38 d9                	cmp    %bl,%cl
+  800b2d:	74 ec                	je     800b1b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b2f:	0f b6 c1             	movzbl %cl,%eax
+  800b32:	0f b6 db             	movzbl %bl,%ebx
+  800b35:	29 d8                	sub    %ebx,%eax
+  800b37:	eb 05                	jmp    800b3e <memcmp+0x35>
+	}
+
+	return 0;
+  800b39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b3e:	5b                   	pop    %ebx
+  800b3f:	5e                   	pop    %esi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b4b:	89 c2                	mov    %eax,%edx
+  800b4d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b50:	eb 03                	jmp    800b55 <memfind+0x13>
+  800b52:	83 c0 01             	add    $0x1,%eax
+  800b55:	39 d0                	cmp    %edx,%eax
+  800b57:	73 04                	jae    800b5d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b59:	38 08                	cmp    %cl,(%eax)
+  800b5b:	75 f5                	jne    800b52 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b5d:	5d                   	pop    %ebp
+  800b5e:	c3                   	ret
+
+00800b5f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b5f:	55                   	push   %ebp
+  800b60:	89 e5                	mov    %esp,%ebp
+  800b62:	57                   	push   %edi
+  800b63:	56                   	push   %esi
+  800b64:	53                   	push   %ebx
+  800b65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b6b:	eb 03                	jmp    800b70 <strtol+0x11>
+		s++;
+  800b6d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b70:	0f b6 02             	movzbl (%edx),%eax
+  800b73:	3c 20                	cmp    $0x20,%al
+  800b75:	74 f6                	je     800b6d <strtol+0xe>
+  800b77:	3c 09                	cmp    $0x9,%al
+  800b79:	74 f2                	je     800b6d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b7b:	3c 2b                	cmp    $0x2b,%al
+  800b7d:	74 2a                	je     800ba9 <strtol+0x4a>
+	int neg = 0;
+  800b7f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b84:	3c 2d                	cmp    $0x2d,%al
+  800b86:	74 2b                	je     800bb3 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b88:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b8e:	75 0f                	jne    800b9f <strtol+0x40>
+  800b90:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b93:	74 28                	je     800bbd <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b95:	85 db                	test   %ebx,%ebx
+  800b97:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b9c:	0f 44 d8             	cmove  %eax,%ebx
+  800b9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba4:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ba7:	eb 46                	jmp    800bef <strtol+0x90>
+		s++;
+  800ba9:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bac:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bb1:	eb d5                	jmp    800b88 <strtol+0x29>
+		s++, neg = 1;
+  800bb3:	83 c2 01             	add    $0x1,%edx
+  800bb6:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bbb:	eb cb                	jmp    800b88 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bbd:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bc1:	74 0e                	je     800bd1 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bc3:	85 db                	test   %ebx,%ebx
+  800bc5:	75 d8                	jne    800b9f <strtol+0x40>
+		s++, base = 8;
+  800bc7:	83 c2 01             	add    $0x1,%edx
+  800bca:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bcf:	eb ce                	jmp    800b9f <strtol+0x40>
+		s += 2, base = 16;
+  800bd1:	83 c2 02             	add    $0x2,%edx
+  800bd4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bd9:	eb c4                	jmp    800b9f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bdb:	0f be c0             	movsbl %al,%eax
+  800bde:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800be1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800be4:	7d 3a                	jge    800c20 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800be6:	83 c2 01             	add    $0x1,%edx
+  800be9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bed:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bef:	0f b6 02             	movzbl (%edx),%eax
+  800bf2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bf5:	89 f3                	mov    %esi,%ebx
+  800bf7:	80 fb 09             	cmp    $0x9,%bl
+  800bfa:	76 df                	jbe    800bdb <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bfc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bff:	89 f3                	mov    %esi,%ebx
+  800c01:	80 fb 19             	cmp    $0x19,%bl
+  800c04:	77 08                	ja     800c0e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c06:	0f be c0             	movsbl %al,%eax
+  800c09:	83 e8 57             	sub    $0x57,%eax
+  800c0c:	eb d3                	jmp    800be1 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c0e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c11:	89 f3                	mov    %esi,%ebx
+  800c13:	80 fb 19             	cmp    $0x19,%bl
+  800c16:	77 08                	ja     800c20 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c18:	0f be c0             	movsbl %al,%eax
+  800c1b:	83 e8 37             	sub    $0x37,%eax
+  800c1e:	eb c1                	jmp    800be1 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c20:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c24:	74 05                	je     800c2b <strtol+0xcc>
+		*endptr = (char *) s;
+  800c26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c29:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c2b:	89 c8                	mov    %ecx,%eax
+  800c2d:	f7 d8                	neg    %eax
+  800c2f:	85 ff                	test   %edi,%edi
+  800c31:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c34:	89 c8                	mov    %ecx,%eax
+  800c36:	5b                   	pop    %ebx
+  800c37:	5e                   	pop    %esi
+  800c38:	5f                   	pop    %edi
+  800c39:	5d                   	pop    %ebp
+  800c3a:	c3                   	ret
+
+00800c3b <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c3b:	55                   	push   %ebp
+  800c3c:	89 e5                	mov    %esp,%ebp
+  800c3e:	57                   	push   %edi
+  800c3f:	56                   	push   %esi
+  800c40:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c4c:	89 c3                	mov    %eax,%ebx
+  800c4e:	89 c7                	mov    %eax,%edi
+  800c50:	89 c6                	mov    %eax,%esi
+  800c52:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c54:	5b                   	pop    %ebx
+  800c55:	5e                   	pop    %esi
+  800c56:	5f                   	pop    %edi
+  800c57:	5d                   	pop    %ebp
+  800c58:	c3                   	ret
+
+00800c59 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	57                   	push   %edi
+  800c5d:	56                   	push   %esi
+  800c5e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c64:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c69:	89 d1                	mov    %edx,%ecx
+  800c6b:	89 d3                	mov    %edx,%ebx
+  800c6d:	89 d7                	mov    %edx,%edi
+  800c6f:	89 d6                	mov    %edx,%esi
+  800c71:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c73:	5b                   	pop    %ebx
+  800c74:	5e                   	pop    %esi
+  800c75:	5f                   	pop    %edi
+  800c76:	5d                   	pop    %ebp
+  800c77:	c3                   	ret
+
+00800c78 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	57                   	push   %edi
+  800c7c:	56                   	push   %esi
+  800c7d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c86:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c8b:	89 cb                	mov    %ecx,%ebx
+  800c8d:	89 cf                	mov    %ecx,%edi
+  800c8f:	89 ce                	mov    %ecx,%esi
+  800c91:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800c93:	5b                   	pop    %ebx
+  800c94:	5e                   	pop    %esi
+  800c95:	5f                   	pop    %edi
+  800c96:	5d                   	pop    %ebp
+  800c97:	c3                   	ret
+
+00800c98 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c98:	55                   	push   %ebp
+  800c99:	89 e5                	mov    %esp,%ebp
+  800c9b:	57                   	push   %edi
+  800c9c:	56                   	push   %esi
+  800c9d:	53                   	push   %ebx
+  800c9e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ca1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ca6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca9:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cae:	89 cb                	mov    %ecx,%ebx
+  800cb0:	89 cf                	mov    %ecx,%edi
+  800cb2:	89 ce                	mov    %ecx,%esi
+  800cb4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cb6:	85 c0                	test   %eax,%eax
+  800cb8:	7f 08                	jg     800cc2 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbd:	5b                   	pop    %ebx
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5f                   	pop    %edi
+  800cc0:	5d                   	pop    %ebp
+  800cc1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc2:	83 ec 0c             	sub    $0xc,%esp
+  800cc5:	50                   	push   %eax
+  800cc6:	6a 03                	push   $0x3
+  800cc8:	68 1f 30 80 00       	push   $0x80301f
+  800ccd:	6a 23                	push   $0x23
+  800ccf:	68 3c 30 80 00       	push   $0x80303c
+  800cd4:	e8 69 f5 ff ff       	call   800242 <_panic>
+
+00800cd9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	57                   	push   %edi
+  800cdd:	56                   	push   %esi
+  800cde:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ce9:	89 d1                	mov    %edx,%ecx
+  800ceb:	89 d3                	mov    %edx,%ebx
+  800ced:	89 d7                	mov    %edx,%edi
+  800cef:	89 d6                	mov    %edx,%esi
+  800cf1:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cf3:	5b                   	pop    %ebx
+  800cf4:	5e                   	pop    %esi
+  800cf5:	5f                   	pop    %edi
+  800cf6:	5d                   	pop    %ebp
+  800cf7:	c3                   	ret
+
+00800cf8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	57                   	push   %edi
+  800cfc:	56                   	push   %esi
+  800cfd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d03:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d08:	89 d1                	mov    %edx,%ecx
+  800d0a:	89 d3                	mov    %edx,%ebx
+  800d0c:	89 d7                	mov    %edx,%edi
+  800d0e:	89 d6                	mov    %edx,%esi
+  800d10:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d12:	5b                   	pop    %ebx
+  800d13:	5e                   	pop    %esi
+  800d14:	5f                   	pop    %edi
+  800d15:	5d                   	pop    %ebp
+  800d16:	c3                   	ret
+
+00800d17 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	57                   	push   %edi
+  800d1b:	56                   	push   %esi
+  800d1c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d22:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d27:	89 d1                	mov    %edx,%ecx
+  800d29:	89 d3                	mov    %edx,%ebx
+  800d2b:	89 d7                	mov    %edx,%edi
+  800d2d:	89 d6                	mov    %edx,%esi
+  800d2f:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800d31:	5b                   	pop    %ebx
+  800d32:	5e                   	pop    %esi
+  800d33:	5f                   	pop    %edi
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+
+00800d36 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	57                   	push   %edi
+  800d3a:	56                   	push   %esi
+  800d3b:	53                   	push   %ebx
+  800d3c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4a:	b8 15 00 00 00       	mov    $0x15,%eax
+  800d4f:	89 df                	mov    %ebx,%edi
+  800d51:	89 de                	mov    %ebx,%esi
+  800d53:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d55:	85 c0                	test   %eax,%eax
+  800d57:	7f 08                	jg     800d61 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800d59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5c:	5b                   	pop    %ebx
+  800d5d:	5e                   	pop    %esi
+  800d5e:	5f                   	pop    %edi
+  800d5f:	5d                   	pop    %ebp
+  800d60:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d61:	83 ec 0c             	sub    $0xc,%esp
+  800d64:	50                   	push   %eax
+  800d65:	6a 15                	push   $0x15
+  800d67:	68 1f 30 80 00       	push   $0x80301f
+  800d6c:	6a 23                	push   $0x23
+  800d6e:	68 3c 30 80 00       	push   $0x80303c
+  800d73:	e8 ca f4 ff ff       	call   800242 <_panic>
+
+00800d78 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d78:	55                   	push   %ebp
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	57                   	push   %edi
+  800d7c:	56                   	push   %esi
+  800d7d:	53                   	push   %ebx
+  800d7e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d81:	be 00 00 00 00       	mov    $0x0,%esi
+  800d86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d94:	89 f7                	mov    %esi,%edi
+  800d96:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d98:	85 c0                	test   %eax,%eax
+  800d9a:	7f 08                	jg     800da4 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9f:	5b                   	pop    %ebx
+  800da0:	5e                   	pop    %esi
+  800da1:	5f                   	pop    %edi
+  800da2:	5d                   	pop    %ebp
+  800da3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da4:	83 ec 0c             	sub    $0xc,%esp
+  800da7:	50                   	push   %eax
+  800da8:	6a 05                	push   $0x5
+  800daa:	68 1f 30 80 00       	push   $0x80301f
+  800daf:	6a 23                	push   $0x23
+  800db1:	68 3c 30 80 00       	push   $0x80303c
+  800db6:	e8 87 f4 ff ff       	call   800242 <_panic>
+
+00800dbb <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800dbb:	55                   	push   %ebp
+  800dbc:	89 e5                	mov    %esp,%ebp
+  800dbe:	57                   	push   %edi
+  800dbf:	56                   	push   %esi
+  800dc0:	53                   	push   %ebx
+  800dc1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc4:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcf:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd7:	89 f7                	mov    %esi,%edi
+  800dd9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddb:	85 c0                	test   %eax,%eax
+  800ddd:	7f 08                	jg     800de7 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de2:	5b                   	pop    %ebx
+  800de3:	5e                   	pop    %esi
+  800de4:	5f                   	pop    %edi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de7:	83 ec 0c             	sub    $0xc,%esp
+  800dea:	50                   	push   %eax
+  800deb:	6a 06                	push   $0x6
+  800ded:	68 1f 30 80 00       	push   $0x80301f
+  800df2:	6a 23                	push   $0x23
+  800df4:	68 3c 30 80 00       	push   $0x80303c
+  800df9:	e8 44 f4 ff ff       	call   800242 <_panic>
+
+00800dfe <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	57                   	push   %edi
+  800e02:	56                   	push   %esi
+  800e03:	53                   	push   %ebx
+  800e04:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0d:	b8 07 00 00 00       	mov    $0x7,%eax
+  800e12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e15:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e18:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e1b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e1d:	85 c0                	test   %eax,%eax
+  800e1f:	7f 08                	jg     800e29 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e24:	5b                   	pop    %ebx
+  800e25:	5e                   	pop    %esi
+  800e26:	5f                   	pop    %edi
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+  800e2c:	50                   	push   %eax
+  800e2d:	6a 07                	push   $0x7
+  800e2f:	68 1f 30 80 00       	push   $0x80301f
+  800e34:	6a 23                	push   $0x23
+  800e36:	68 3c 30 80 00       	push   $0x80303c
+  800e3b:	e8 02 f4 ff ff       	call   800242 <_panic>
+
+00800e40 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e40:	55                   	push   %ebp
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	57                   	push   %edi
+  800e44:	56                   	push   %esi
+  800e45:	53                   	push   %ebx
+  800e46:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e54:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e59:	89 df                	mov    %ebx,%edi
+  800e5b:	89 de                	mov    %ebx,%esi
+  800e5d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e5f:	85 c0                	test   %eax,%eax
+  800e61:	7f 08                	jg     800e6b <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e66:	5b                   	pop    %ebx
+  800e67:	5e                   	pop    %esi
+  800e68:	5f                   	pop    %edi
+  800e69:	5d                   	pop    %ebp
+  800e6a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e6b:	83 ec 0c             	sub    $0xc,%esp
+  800e6e:	50                   	push   %eax
+  800e6f:	6a 08                	push   $0x8
+  800e71:	68 1f 30 80 00       	push   $0x80301f
+  800e76:	6a 23                	push   $0x23
+  800e78:	68 3c 30 80 00       	push   $0x80303c
+  800e7d:	e8 c0 f3 ff ff       	call   800242 <_panic>
+
+00800e82 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	57                   	push   %edi
+  800e86:	56                   	push   %esi
+  800e87:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e93:	be 00 00 00 00       	mov    $0x0,%esi
+  800e98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e9e:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800ea0:	5b                   	pop    %ebx
+  800ea1:	5e                   	pop    %esi
+  800ea2:	5f                   	pop    %edi
+  800ea3:	5d                   	pop    %ebp
+  800ea4:	c3                   	ret
+
+00800ea5 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800ea5:	55                   	push   %ebp
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	57                   	push   %edi
+  800ea9:	56                   	push   %esi
+  800eaa:	53                   	push   %ebx
+  800eab:	8b 45 18             	mov    0x18(%ebp),%eax
+  800eae:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800eb1:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800eb6:	77 27                	ja     800edf <sys_page_map_range+0x3a>
+  800eb8:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800ebe:	77 1f                	ja     800edf <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800ec0:	c1 e0 0c             	shl    $0xc,%eax
+  800ec3:	89 c6                	mov    %eax,%esi
+  800ec5:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800ec7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ed2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed8:	cd 30                	int    $0x30
+}
+  800eda:	5b                   	pop    %ebx
+  800edb:	5e                   	pop    %esi
+  800edc:	5f                   	pop    %edi
+  800edd:	5d                   	pop    %ebp
+  800ede:	c3                   	ret
+		return -E_INVAL;
+  800edf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ee4:	eb f4                	jmp    800eda <sys_page_map_range+0x35>
+
+00800ee6 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800ee6:	55                   	push   %ebp
+  800ee7:	89 e5                	mov    %esp,%ebp
+  800ee9:	57                   	push   %edi
+  800eea:	56                   	push   %esi
+  800eeb:	53                   	push   %ebx
+  800eec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800efa:	be 00 00 00 00       	mov    $0x0,%esi
+  800eff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f02:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f05:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f07:	85 c0                	test   %eax,%eax
+  800f09:	7f 08                	jg     800f13 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800f0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0e:	5b                   	pop    %ebx
+  800f0f:	5e                   	pop    %esi
+  800f10:	5f                   	pop    %edi
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f13:	83 ec 0c             	sub    $0xc,%esp
+  800f16:	50                   	push   %eax
+  800f17:	6a 0c                	push   $0xc
+  800f19:	68 1f 30 80 00       	push   $0x80301f
+  800f1e:	6a 23                	push   $0x23
+  800f20:	68 3c 30 80 00       	push   $0x80303c
+  800f25:	e8 18 f3 ff ff       	call   800242 <_panic>
+
+00800f2a <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	57                   	push   %edi
+  800f2e:	56                   	push   %esi
+  800f2f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f30:	be 00 00 00 00       	mov    $0x0,%esi
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f43:	89 f7                	mov    %esi,%edi
+  800f45:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f47:	5b                   	pop    %ebx
+  800f48:	5e                   	pop    %esi
+  800f49:	5f                   	pop    %edi
+  800f4a:	5d                   	pop    %ebp
+  800f4b:	c3                   	ret
+
+00800f4c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	57                   	push   %edi
+  800f50:	56                   	push   %esi
+  800f51:	53                   	push   %ebx
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f60:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f65:	89 df                	mov    %ebx,%edi
+  800f67:	89 de                	mov    %ebx,%esi
+  800f69:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6b:	85 c0                	test   %eax,%eax
+  800f6d:	7f 08                	jg     800f77 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f72:	5b                   	pop    %ebx
+  800f73:	5e                   	pop    %esi
+  800f74:	5f                   	pop    %edi
+  800f75:	5d                   	pop    %ebp
+  800f76:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f77:	83 ec 0c             	sub    $0xc,%esp
+  800f7a:	50                   	push   %eax
+  800f7b:	6a 0f                	push   $0xf
+  800f7d:	68 1f 30 80 00       	push   $0x80301f
+  800f82:	6a 23                	push   $0x23
+  800f84:	68 3c 30 80 00       	push   $0x80303c
+  800f89:	e8 b4 f2 ff ff       	call   800242 <_panic>
+
+00800f8e <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800f8e:	55                   	push   %ebp
+  800f8f:	89 e5                	mov    %esp,%ebp
+  800f91:	57                   	push   %edi
+  800f92:	56                   	push   %esi
+  800f93:	53                   	push   %ebx
+  800f94:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa2:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fa7:	89 df                	mov    %ebx,%edi
+  800fa9:	89 de                	mov    %ebx,%esi
+  800fab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fad:	85 c0                	test   %eax,%eax
+  800faf:	7f 08                	jg     800fb9 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800fb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5e                   	pop    %esi
+  800fb6:	5f                   	pop    %edi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb9:	83 ec 0c             	sub    $0xc,%esp
+  800fbc:	50                   	push   %eax
+  800fbd:	6a 10                	push   $0x10
+  800fbf:	68 1f 30 80 00       	push   $0x80301f
+  800fc4:	6a 23                	push   $0x23
+  800fc6:	68 3c 30 80 00       	push   $0x80303c
+  800fcb:	e8 72 f2 ff ff       	call   800242 <_panic>
+
+00800fd0 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	57                   	push   %edi
+  800fd4:	56                   	push   %esi
+  800fd5:	53                   	push   %ebx
+  800fd6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe4:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fe9:	89 df                	mov    %ebx,%edi
+  800feb:	89 de                	mov    %ebx,%esi
+  800fed:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fef:	85 c0                	test   %eax,%eax
+  800ff1:	7f 08                	jg     800ffb <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800ff3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff6:	5b                   	pop    %ebx
+  800ff7:	5e                   	pop    %esi
+  800ff8:	5f                   	pop    %edi
+  800ff9:	5d                   	pop    %ebp
+  800ffa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffb:	83 ec 0c             	sub    $0xc,%esp
+  800ffe:	50                   	push   %eax
+  800fff:	6a 11                	push   $0x11
+  801001:	68 1f 30 80 00       	push   $0x80301f
+  801006:	6a 23                	push   $0x23
+  801008:	68 3c 30 80 00       	push   $0x80303c
+  80100d:	e8 30 f2 ff ff       	call   800242 <_panic>
+
+00801012 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  801012:	55                   	push   %ebp
+  801013:	89 e5                	mov    %esp,%ebp
+  801015:	57                   	push   %edi
+  801016:	56                   	push   %esi
+  801017:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801018:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801022:	89 d1                	mov    %edx,%ecx
+  801024:	89 d3                	mov    %edx,%ebx
+  801026:	89 d7                	mov    %edx,%edi
+  801028:	89 d6                	mov    %edx,%esi
+  80102a:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  80102c:	5b                   	pop    %ebx
+  80102d:	5e                   	pop    %esi
+  80102e:	5f                   	pop    %edi
+  80102f:	5d                   	pop    %ebp
+  801030:	c3                   	ret
+
+00801031 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	57                   	push   %edi
+  801035:	56                   	push   %esi
+  801036:	53                   	push   %ebx
+  801037:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80103a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801042:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801045:	b8 13 00 00 00       	mov    $0x13,%eax
+  80104a:	89 df                	mov    %ebx,%edi
+  80104c:	89 de                	mov    %ebx,%esi
+  80104e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801050:	85 c0                	test   %eax,%eax
+  801052:	7f 08                	jg     80105c <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801054:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801057:	5b                   	pop    %ebx
+  801058:	5e                   	pop    %esi
+  801059:	5f                   	pop    %edi
+  80105a:	5d                   	pop    %ebp
+  80105b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105c:	83 ec 0c             	sub    $0xc,%esp
+  80105f:	50                   	push   %eax
+  801060:	6a 13                	push   $0x13
+  801062:	68 1f 30 80 00       	push   $0x80301f
+  801067:	6a 23                	push   $0x23
+  801069:	68 3c 30 80 00       	push   $0x80303c
+  80106e:	e8 cf f1 ff ff       	call   800242 <_panic>
+
+00801073 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801073:	55                   	push   %ebp
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	57                   	push   %edi
+  801077:	56                   	push   %esi
+  801078:	53                   	push   %ebx
+  801079:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80107c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801081:	8b 55 08             	mov    0x8(%ebp),%edx
+  801084:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801087:	b8 14 00 00 00       	mov    $0x14,%eax
+  80108c:	89 df                	mov    %ebx,%edi
+  80108e:	89 de                	mov    %ebx,%esi
+  801090:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801092:	85 c0                	test   %eax,%eax
+  801094:	7f 08                	jg     80109e <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801096:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801099:	5b                   	pop    %ebx
+  80109a:	5e                   	pop    %esi
+  80109b:	5f                   	pop    %edi
+  80109c:	5d                   	pop    %ebp
+  80109d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109e:	83 ec 0c             	sub    $0xc,%esp
+  8010a1:	50                   	push   %eax
+  8010a2:	6a 14                	push   $0x14
+  8010a4:	68 1f 30 80 00       	push   $0x80301f
+  8010a9:	6a 23                	push   $0x23
+  8010ab:	68 3c 30 80 00       	push   $0x80303c
+  8010b0:	e8 8d f1 ff ff       	call   800242 <_panic>
+
+008010b5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ce:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010d1:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010d3:	5b                   	pop    %ebx
+  8010d4:	5e                   	pop    %esi
+  8010d5:	5f                   	pop    %edi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	c3                   	ret
+
+008010d8 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5f                   	pop    %edi
+  8010f9:	5d                   	pop    %ebp
+  8010fa:	c3                   	ret
+
+008010fb <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	57                   	push   %edi
+  8010ff:	56                   	push   %esi
+  801100:	53                   	push   %ebx
+  801101:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801104:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801109:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110c:	b8 19 00 00 00       	mov    $0x19,%eax
+  801111:	89 cb                	mov    %ecx,%ebx
+  801113:	89 cf                	mov    %ecx,%edi
+  801115:	89 ce                	mov    %ecx,%esi
+  801117:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801119:	85 c0                	test   %eax,%eax
+  80111b:	7f 08                	jg     801125 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80111d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801120:	5b                   	pop    %ebx
+  801121:	5e                   	pop    %esi
+  801122:	5f                   	pop    %edi
+  801123:	5d                   	pop    %ebp
+  801124:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801125:	83 ec 0c             	sub    $0xc,%esp
+  801128:	50                   	push   %eax
+  801129:	6a 19                	push   $0x19
+  80112b:	68 1f 30 80 00       	push   $0x80301f
+  801130:	6a 23                	push   $0x23
+  801132:	68 3c 30 80 00       	push   $0x80303c
+  801137:	e8 06 f1 ff ff       	call   800242 <_panic>
+
+0080113c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	57                   	push   %edi
+  801140:	56                   	push   %esi
+  801141:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801142:	ba 00 00 00 00       	mov    $0x0,%edx
+  801147:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80114c:	89 d1                	mov    %edx,%ecx
+  80114e:	89 d3                	mov    %edx,%ebx
+  801150:	89 d7                	mov    %edx,%edi
+  801152:	89 d6                	mov    %edx,%esi
+  801154:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801156:	5b                   	pop    %ebx
+  801157:	5e                   	pop    %esi
+  801158:	5f                   	pop    %edi
+  801159:	5d                   	pop    %ebp
+  80115a:	c3                   	ret
+
+0080115b <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  80115b:	55                   	push   %ebp
+  80115c:	89 e5                	mov    %esp,%ebp
+  80115e:	57                   	push   %edi
+  80115f:	56                   	push   %esi
+  801160:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801161:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801166:	8b 55 08             	mov    0x8(%ebp),%edx
+  801169:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801171:	89 df                	mov    %ebx,%edi
+  801173:	89 de                	mov    %ebx,%esi
+  801175:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801177:	5b                   	pop    %ebx
+  801178:	5e                   	pop    %esi
+  801179:	5f                   	pop    %edi
+  80117a:	5d                   	pop    %ebp
+  80117b:	c3                   	ret
+
+0080117c <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  80117c:	55                   	push   %ebp
+  80117d:	89 e5                	mov    %esp,%ebp
+  80117f:	57                   	push   %edi
+  801180:	56                   	push   %esi
+  801181:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801182:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801187:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801192:	89 df                	mov    %ebx,%edi
+  801194:	89 de                	mov    %ebx,%esi
+  801196:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801198:	5b                   	pop    %ebx
+  801199:	5e                   	pop    %esi
+  80119a:	5f                   	pop    %edi
+  80119b:	5d                   	pop    %ebp
+  80119c:	c3                   	ret
+
+0080119d <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80119d:	55                   	push   %ebp
+  80119e:	89 e5                	mov    %esp,%ebp
+  8011a0:	53                   	push   %ebx
+  8011a1:	83 ec 04             	sub    $0x4,%esp
+  8011a4:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8011a7:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  8011a9:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  8011ac:	f6 c2 02             	test   $0x2,%dl
+  8011af:	74 7b                	je     80122c <pgfault+0x8f>
+  8011b1:	89 c1                	mov    %eax,%ecx
+  8011b3:	c1 e9 0c             	shr    $0xc,%ecx
+  8011b6:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8011bd:	f6 c5 08             	test   $0x8,%ch
+  8011c0:	74 6a                	je     80122c <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8011c2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011c7:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8011c9:	83 ec 04             	sub    $0x4,%esp
+  8011cc:	6a 07                	push   $0x7
+  8011ce:	68 00 f0 7f 00       	push   $0x7ff000
+  8011d3:	6a 00                	push   $0x0
+  8011d5:	e8 9e fb ff ff       	call   800d78 <sys_page_alloc>
+  8011da:	83 c4 10             	add    $0x10,%esp
+  8011dd:	85 c0                	test   %eax,%eax
+  8011df:	78 61                	js     801242 <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  8011e1:	83 ec 04             	sub    $0x4,%esp
+  8011e4:	68 00 10 00 00       	push   $0x1000
+  8011e9:	53                   	push   %ebx
+  8011ea:	68 00 f0 7f 00       	push   $0x7ff000
+  8011ef:	e8 9d f8 ff ff       	call   800a91 <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  8011f4:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8011fb:	53                   	push   %ebx
+  8011fc:	6a 00                	push   $0x0
+  8011fe:	68 00 f0 7f 00       	push   $0x7ff000
+  801203:	6a 00                	push   $0x0
+  801205:	e8 f4 fb ff ff       	call   800dfe <sys_page_map>
+  80120a:	83 c4 20             	add    $0x20,%esp
+  80120d:	85 c0                	test   %eax,%eax
+  80120f:	78 43                	js     801254 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  801211:	83 ec 08             	sub    $0x8,%esp
+  801214:	68 00 f0 7f 00       	push   $0x7ff000
+  801219:	6a 00                	push   $0x0
+  80121b:	e8 20 fc ff ff       	call   800e40 <sys_page_unmap>
+  801220:	83 c4 10             	add    $0x10,%esp
+  801223:	85 c0                	test   %eax,%eax
+  801225:	78 3f                	js     801266 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  801227:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80122a:	c9                   	leave
+  80122b:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  80122c:	83 ec 0c             	sub    $0xc,%esp
+  80122f:	50                   	push   %eax
+  801230:	52                   	push   %edx
+  801231:	68 4a 30 80 00       	push   $0x80304a
+  801236:	6a 19                	push   $0x19
+  801238:	68 5b 30 80 00       	push   $0x80305b
+  80123d:	e8 00 f0 ff ff       	call   800242 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801242:	50                   	push   %eax
+  801243:	68 66 30 80 00       	push   $0x803066
+  801248:	6a 24                	push   $0x24
+  80124a:	68 5b 30 80 00       	push   $0x80305b
+  80124f:	e8 ee ef ff ff       	call   800242 <_panic>
+		panic("sys_page_map: %e", r);
+  801254:	50                   	push   %eax
+  801255:	68 79 30 80 00       	push   $0x803079
+  80125a:	6a 29                	push   $0x29
+  80125c:	68 5b 30 80 00       	push   $0x80305b
+  801261:	e8 dc ef ff ff       	call   800242 <_panic>
+		panic("sys_page_unmap: %e", r);
+  801266:	50                   	push   %eax
+  801267:	68 8a 30 80 00       	push   $0x80308a
+  80126c:	6a 2c                	push   $0x2c
+  80126e:	68 5b 30 80 00       	push   $0x80305b
+  801273:	e8 ca ef ff ff       	call   800242 <_panic>
+
+00801278 <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  801278:	55                   	push   %ebp
+  801279:	89 e5                	mov    %esp,%ebp
+  80127b:	57                   	push   %edi
+  80127c:	56                   	push   %esi
+  80127d:	53                   	push   %ebx
+  80127e:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801281:	68 9d 11 80 00       	push   $0x80119d
+  801286:	e8 a3 14 00 00       	call   80272e <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  80128b:	83 c4 08             	add    $0x8,%esp
+  80128e:	6a 01                	push   $0x1
+  801290:	6a 00                	push   $0x0
+  801292:	e8 9f fa ff ff       	call   800d36 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  801297:	e8 7b fa ff ff       	call   800d17 <sys_fork_cow>
+  80129c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  80129f:	83 c4 10             	add    $0x10,%esp
+  8012a2:	85 c0                	test   %eax,%eax
+  8012a4:	74 2c                	je     8012d2 <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  8012a6:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8012aa:	0f 85 8b 01 00 00    	jne    80143b <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8012b0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012b5:	cd 30                	int    $0x30
+  8012b7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8012ba:	85 c0                	test   %eax,%eax
+  8012bc:	78 30                	js     8012ee <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  8012be:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8012c3:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8012c8:	74 36                	je     801300 <fork+0x88>
+  8012ca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8012cd:	e9 99 00 00 00       	jmp    80136b <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8012d2:	e8 02 fa ff ff       	call   800cd9 <sys_getenvid>
+  8012d7:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8012dc:	c1 e0 09             	shl    $0x9,%eax
+  8012df:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8012e4:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  8012e9:	e9 4d 01 00 00       	jmp    80143b <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  8012ee:	50                   	push   %eax
+  8012ef:	68 9d 30 80 00       	push   $0x80309d
+  8012f4:	6a 7d                	push   $0x7d
+  8012f6:	68 5b 30 80 00       	push   $0x80305b
+  8012fb:	e8 42 ef ff ff       	call   800242 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801300:	e8 d4 f9 ff ff       	call   800cd9 <sys_getenvid>
+  801305:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80130a:	c1 e0 09             	shl    $0x9,%eax
+  80130d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801312:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801317:	e9 1f 01 00 00       	jmp    80143b <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  80131c:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801323:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801326:	25 07 0e 00 00       	and    $0xe07,%eax
+  80132b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+  801331:	50                   	push   %eax
+  801332:	56                   	push   %esi
+  801333:	ff 75 e4             	push   -0x1c(%ebp)
+  801336:	56                   	push   %esi
+  801337:	6a 00                	push   $0x0
+  801339:	e8 c0 fa ff ff       	call   800dfe <sys_page_map>
+  80133e:	83 c4 20             	add    $0x20,%esp
+  801341:	85 c0                	test   %eax,%eax
+  801343:	0f 88 98 00 00 00    	js     8013e1 <fork+0x169>
+	if (perm & PTE_COW) {
+  801349:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801350:	0f 85 61 01 00 00    	jne    8014b7 <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801356:	83 c7 01             	add    $0x1,%edi
+  801359:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80135f:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  801365:	0f 84 88 00 00 00    	je     8013f3 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  80136b:	89 f0                	mov    %esi,%eax
+  80136d:	c1 e8 16             	shr    $0x16,%eax
+  801370:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801377:	25 81 00 00 00       	and    $0x81,%eax
+  80137c:	83 f8 01             	cmp    $0x1,%eax
+  80137f:	75 d5                	jne    801356 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  801381:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  801388:	a8 01                	test   $0x1,%al
+  80138a:	74 ca                	je     801356 <fork+0xde>
+  80138c:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  801392:	74 c2                	je     801356 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  801394:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  801396:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80139d:	f6 c4 04             	test   $0x4,%ah
+  8013a0:	0f 85 76 ff ff ff    	jne    80131c <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  8013a6:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8013ad:	a8 02                	test   $0x2,%al
+  8013af:	0f 85 dc 00 00 00    	jne    801491 <fork+0x219>
+  8013b5:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8013bc:	f6 c4 08             	test   $0x8,%ah
+  8013bf:	0f 85 cc 00 00 00    	jne    801491 <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8013c5:	83 ec 0c             	sub    $0xc,%esp
+  8013c8:	6a 05                	push   $0x5
+  8013ca:	56                   	push   %esi
+  8013cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8013ce:	56                   	push   %esi
+  8013cf:	6a 00                	push   $0x0
+  8013d1:	e8 28 fa ff ff       	call   800dfe <sys_page_map>
+  8013d6:	83 c4 20             	add    $0x20,%esp
+  8013d9:	85 c0                	test   %eax,%eax
+  8013db:	0f 89 75 ff ff ff    	jns    801356 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  8013e1:	50                   	push   %eax
+  8013e2:	68 79 30 80 00       	push   $0x803079
+  8013e7:	6a 48                	push   $0x48
+  8013e9:	68 5b 30 80 00       	push   $0x80305b
+  8013ee:	e8 4f ee ff ff       	call   800242 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  8013f3:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8013f6:	83 ec 04             	sub    $0x4,%esp
+  8013f9:	6a 07                	push   $0x7
+  8013fb:	68 00 f0 bf ee       	push   $0xeebff000
+  801400:	53                   	push   %ebx
+  801401:	e8 72 f9 ff ff       	call   800d78 <sys_page_alloc>
+  801406:	83 c4 10             	add    $0x10,%esp
+  801409:	85 c0                	test   %eax,%eax
+  80140b:	78 39                	js     801446 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  80140d:	a1 08 50 80 00       	mov    0x805008,%eax
+  801412:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  801418:	83 ec 08             	sub    $0x8,%esp
+  80141b:	50                   	push   %eax
+  80141c:	53                   	push   %ebx
+  80141d:	e8 51 fc ff ff       	call   801073 <sys_env_set_pgfault_upcall>
+  801422:	83 c4 10             	add    $0x10,%esp
+  801425:	85 c0                	test   %eax,%eax
+  801427:	78 36                	js     80145f <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  801429:	83 ec 08             	sub    $0x8,%esp
+  80142c:	6a 02                	push   $0x2
+  80142e:	53                   	push   %ebx
+  80142f:	e8 18 fb ff ff       	call   800f4c <sys_env_set_status>
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	85 c0                	test   %eax,%eax
+  801439:	78 3d                	js     801478 <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  80143b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80143e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801441:	5b                   	pop    %ebx
+  801442:	5e                   	pop    %esi
+  801443:	5f                   	pop    %edi
+  801444:	5d                   	pop    %ebp
+  801445:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  801446:	83 ec 0c             	sub    $0xc,%esp
+  801449:	53                   	push   %ebx
+  80144a:	50                   	push   %eax
+  80144b:	68 c4 30 80 00       	push   $0x8030c4
+  801450:	68 92 00 00 00       	push   $0x92
+  801455:	68 5b 30 80 00       	push   $0x80305b
+  80145a:	e8 e3 ed ff ff       	call   800242 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  80145f:	83 ec 0c             	sub    $0xc,%esp
+  801462:	53                   	push   %ebx
+  801463:	50                   	push   %eax
+  801464:	68 e8 30 80 00       	push   $0x8030e8
+  801469:	68 95 00 00 00       	push   $0x95
+  80146e:	68 5b 30 80 00       	push   $0x80305b
+  801473:	e8 ca ed ff ff       	call   800242 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  801478:	83 ec 0c             	sub    $0xc,%esp
+  80147b:	53                   	push   %ebx
+  80147c:	50                   	push   %eax
+  80147d:	68 18 31 80 00       	push   $0x803118
+  801482:	68 98 00 00 00       	push   $0x98
+  801487:	68 5b 30 80 00       	push   $0x80305b
+  80148c:	e8 b1 ed ff ff       	call   800242 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801491:	83 ec 0c             	sub    $0xc,%esp
+  801494:	68 05 08 00 00       	push   $0x805
+  801499:	53                   	push   %ebx
+  80149a:	ff 75 e4             	push   -0x1c(%ebp)
+  80149d:	53                   	push   %ebx
+  80149e:	6a 00                	push   $0x0
+  8014a0:	e8 59 f9 ff ff       	call   800dfe <sys_page_map>
+  8014a5:	83 c4 20             	add    $0x20,%esp
+  8014a8:	85 c0                	test   %eax,%eax
+  8014aa:	0f 88 31 ff ff ff    	js     8013e1 <fork+0x169>
+		perm |= PTE_COW;
+  8014b0:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  8014b7:	83 ec 0c             	sub    $0xc,%esp
+  8014ba:	ff 75 e0             	push   -0x20(%ebp)
+  8014bd:	53                   	push   %ebx
+  8014be:	6a 00                	push   $0x0
+  8014c0:	53                   	push   %ebx
+  8014c1:	6a 00                	push   $0x0
+  8014c3:	e8 36 f9 ff ff       	call   800dfe <sys_page_map>
+  8014c8:	83 c4 20             	add    $0x20,%esp
+  8014cb:	85 c0                	test   %eax,%eax
+  8014cd:	0f 89 83 fe ff ff    	jns    801356 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  8014d3:	50                   	push   %eax
+  8014d4:	68 79 30 80 00       	push   $0x803079
+  8014d9:	6a 4c                	push   $0x4c
+  8014db:	68 5b 30 80 00       	push   $0x80305b
+  8014e0:	e8 5d ed ff ff       	call   800242 <_panic>
+
+008014e5 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8014e5:	55                   	push   %ebp
+  8014e6:	89 e5                	mov    %esp,%ebp
+  8014e8:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8014eb:	68 ad 30 80 00       	push   $0x8030ad
+  8014f0:	68 a0 00 00 00       	push   $0xa0
+  8014f5:	68 5b 30 80 00       	push   $0x80305b
+  8014fa:	e8 43 ed ff ff       	call   800242 <_panic>
+
+008014ff <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8014ff:	55                   	push   %ebp
+  801500:	89 e5                	mov    %esp,%ebp
+  801502:	57                   	push   %edi
+  801503:	56                   	push   %esi
+  801504:	53                   	push   %ebx
+  801505:	83 ec 18             	sub    $0x18,%esp
+  801508:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80150b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80150e:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801511:	85 db                	test   %ebx,%ebx
+  801513:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801518:	0f 45 c3             	cmovne %ebx,%eax
+  80151b:	50                   	push   %eax
+  80151c:	e8 da fb ff ff       	call   8010fb <sys_ipc_recv>
+
+	if (from_env_store)
+  801521:	83 c4 10             	add    $0x10,%esp
+  801524:	85 ff                	test   %edi,%edi
+  801526:	74 17                	je     80153f <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801528:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152d:	85 c0                	test   %eax,%eax
+  80152f:	75 0c                	jne    80153d <ipc_recv+0x3e>
+  801531:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  801537:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  80153d:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  80153f:	85 f6                	test   %esi,%esi
+  801541:	74 2e                	je     801571 <ipc_recv+0x72>
+		if (!r && pg)
+  801543:	85 c0                	test   %eax,%eax
+  801545:	75 24                	jne    80156b <ipc_recv+0x6c>
+  801547:	85 db                	test   %ebx,%ebx
+  801549:	74 20                	je     80156b <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  80154b:	a1 08 50 80 00       	mov    0x805008,%eax
+  801550:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  801556:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  801558:	a1 08 50 80 00       	mov    0x805008,%eax
+  80155d:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  801563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801566:	5b                   	pop    %ebx
+  801567:	5e                   	pop    %esi
+  801568:	5f                   	pop    %edi
+  801569:	5d                   	pop    %ebp
+  80156a:	c3                   	ret
+			*perm_store = 0;
+  80156b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  801571:	85 c0                	test   %eax,%eax
+  801573:	75 ee                	jne    801563 <ipc_recv+0x64>
+  801575:	eb e1                	jmp    801558 <ipc_recv+0x59>
+
+00801577 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801577:	55                   	push   %ebp
+  801578:	89 e5                	mov    %esp,%ebp
+  80157a:	57                   	push   %edi
+  80157b:	56                   	push   %esi
+  80157c:	53                   	push   %ebx
+  80157d:	83 ec 0c             	sub    $0xc,%esp
+  801580:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801583:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801586:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  801589:	85 db                	test   %ebx,%ebx
+  80158b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801590:	0f 44 d8             	cmove  %eax,%ebx
+  801593:	ff 75 14             	push   0x14(%ebp)
+  801596:	53                   	push   %ebx
+  801597:	56                   	push   %esi
+  801598:	57                   	push   %edi
+  801599:	e8 3a fb ff ff       	call   8010d8 <sys_ipc_try_send_yield>
+  80159e:	83 c4 10             	add    $0x10,%esp
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	79 1e                	jns    8015c3 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  8015a5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8015a8:	75 07                	jne    8015b1 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  8015aa:	e8 49 f7 ff ff       	call   800cf8 <sys_yield>
+  8015af:	eb e2                	jmp    801593 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  8015b1:	50                   	push   %eax
+  8015b2:	68 3e 31 80 00       	push   $0x80313e
+  8015b7:	6a 3d                	push   $0x3d
+  8015b9:	68 53 31 80 00       	push   $0x803153
+  8015be:	e8 7f ec ff ff       	call   800242 <_panic>
+	}
+}
+  8015c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c6:	5b                   	pop    %ebx
+  8015c7:	5e                   	pop    %esi
+  8015c8:	5f                   	pop    %edi
+  8015c9:	5d                   	pop    %ebp
+  8015ca:	c3                   	ret
+
+008015cb <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  8015d1:	ff 75 08             	push   0x8(%ebp)
+  8015d4:	e8 9f f6 ff ff       	call   800c78 <sys_env_find>
+}
+  8015d9:	c9                   	leave
+  8015da:	c3                   	ret
+
+008015db <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8015db:	55                   	push   %ebp
+  8015dc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8015e6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8015e9:	5d                   	pop    %ebp
+  8015ea:	c3                   	ret
+
+008015eb <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f1:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8015f6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8015fb:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801600:	5d                   	pop    %ebp
+  801601:	c3                   	ret
+
+00801602 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801602:	55                   	push   %ebp
+  801603:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801605:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80160a:	eb 02                	jmp    80160e <fd_alloc+0xc>
+  80160c:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80160e:	89 c2                	mov    %eax,%edx
+  801610:	c1 ea 16             	shr    $0x16,%edx
+  801613:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80161a:	f6 c2 01             	test   $0x1,%dl
+  80161d:	74 2b                	je     80164a <fd_alloc+0x48>
+  80161f:	89 c2                	mov    %eax,%edx
+  801621:	c1 ea 0c             	shr    $0xc,%edx
+  801624:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80162b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801631:	f6 c1 01             	test   $0x1,%cl
+  801634:	74 14                	je     80164a <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801636:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80163c:	75 ce                	jne    80160c <fd_alloc+0xa>
+  80163e:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801643:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801648:	eb 05                	jmp    80164f <fd_alloc+0x4d>
+			return 0;
+  80164a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80164f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801652:	89 02                	mov    %eax,(%edx)
+}
+  801654:	89 c8                	mov    %ecx,%eax
+  801656:	5d                   	pop    %ebp
+  801657:	c3                   	ret
+
+00801658 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801658:	55                   	push   %ebp
+  801659:	89 e5                	mov    %esp,%ebp
+  80165b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80165e:	83 f8 1f             	cmp    $0x1f,%eax
+  801661:	77 30                	ja     801693 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801663:	c1 e0 0c             	shl    $0xc,%eax
+  801666:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80166b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801671:	f6 c2 01             	test   $0x1,%dl
+  801674:	74 24                	je     80169a <fd_lookup+0x42>
+  801676:	89 c2                	mov    %eax,%edx
+  801678:	c1 ea 0c             	shr    $0xc,%edx
+  80167b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801682:	f6 c2 01             	test   $0x1,%dl
+  801685:	74 1a                	je     8016a1 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801687:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80168a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80168c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801691:	5d                   	pop    %ebp
+  801692:	c3                   	ret
+		return -E_INVAL;
+  801693:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801698:	eb f7                	jmp    801691 <fd_lookup+0x39>
+		return -E_INVAL;
+  80169a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80169f:	eb f0                	jmp    801691 <fd_lookup+0x39>
+  8016a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a6:	eb e9                	jmp    801691 <fd_lookup+0x39>
+
+008016a8 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8016a8:	55                   	push   %ebp
+  8016a9:	89 e5                	mov    %esp,%ebp
+  8016ab:	53                   	push   %ebx
+  8016ac:	83 ec 04             	sub    $0x4,%esp
+  8016af:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8016b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b7:	eb 03                	jmp    8016bc <dev_lookup+0x14>
+  8016b9:	83 c0 01             	add    $0x1,%eax
+  8016bc:	8b 1c 85 dc 31 80 00 	mov    0x8031dc(,%eax,4),%ebx
+  8016c3:	85 db                	test   %ebx,%ebx
+  8016c5:	74 0b                	je     8016d2 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8016c7:	39 13                	cmp    %edx,(%ebx)
+  8016c9:	75 ee                	jne    8016b9 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8016cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d0:	eb 1f                	jmp    8016f1 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016d2:	a1 08 50 80 00       	mov    0x805008,%eax
+  8016d7:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8016da:	83 ec 04             	sub    $0x4,%esp
+  8016dd:	52                   	push   %edx
+  8016de:	50                   	push   %eax
+  8016df:	68 60 31 80 00       	push   $0x803160
+  8016e4:	e8 34 ec ff ff       	call   80031d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8016e9:	83 c4 10             	add    $0x10,%esp
+  8016ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8016f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016f4:	89 1a                	mov    %ebx,(%edx)
+}
+  8016f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016f9:	c9                   	leave
+  8016fa:	c3                   	ret
+
+008016fb <fd_close>:
+{
+  8016fb:	55                   	push   %ebp
+  8016fc:	89 e5                	mov    %esp,%ebp
+  8016fe:	57                   	push   %edi
+  8016ff:	56                   	push   %esi
+  801700:	53                   	push   %ebx
+  801701:	83 ec 24             	sub    $0x24,%esp
+  801704:	8b 75 08             	mov    0x8(%ebp),%esi
+  801707:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80170a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80170d:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80170e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801714:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801717:	50                   	push   %eax
+  801718:	e8 3b ff ff ff       	call   801658 <fd_lookup>
+  80171d:	89 c3                	mov    %eax,%ebx
+  80171f:	83 c4 10             	add    $0x10,%esp
+  801722:	85 c0                	test   %eax,%eax
+  801724:	78 05                	js     80172b <fd_close+0x30>
+	    || fd != fd2)
+  801726:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801729:	74 16                	je     801741 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80172b:	89 f8                	mov    %edi,%eax
+  80172d:	84 c0                	test   %al,%al
+  80172f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801734:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801737:	89 d8                	mov    %ebx,%eax
+  801739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80173c:	5b                   	pop    %ebx
+  80173d:	5e                   	pop    %esi
+  80173e:	5f                   	pop    %edi
+  80173f:	5d                   	pop    %ebp
+  801740:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801741:	83 ec 08             	sub    $0x8,%esp
+  801744:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801747:	50                   	push   %eax
+  801748:	ff 36                	push   (%esi)
+  80174a:	e8 59 ff ff ff       	call   8016a8 <dev_lookup>
+  80174f:	89 c3                	mov    %eax,%ebx
+  801751:	83 c4 10             	add    $0x10,%esp
+  801754:	85 c0                	test   %eax,%eax
+  801756:	78 1a                	js     801772 <fd_close+0x77>
+		if (dev->dev_close)
+  801758:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80175b:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80175e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801763:	85 c0                	test   %eax,%eax
+  801765:	74 0b                	je     801772 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801767:	83 ec 0c             	sub    $0xc,%esp
+  80176a:	56                   	push   %esi
+  80176b:	ff d0                	call   *%eax
+  80176d:	89 c3                	mov    %eax,%ebx
+  80176f:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801772:	83 ec 08             	sub    $0x8,%esp
+  801775:	56                   	push   %esi
+  801776:	6a 00                	push   $0x0
+  801778:	e8 c3 f6 ff ff       	call   800e40 <sys_page_unmap>
+	return r;
+  80177d:	83 c4 10             	add    $0x10,%esp
+  801780:	eb b5                	jmp    801737 <fd_close+0x3c>
+
+00801782 <close>:
+
+int
+close(int fdnum)
+{
+  801782:	55                   	push   %ebp
+  801783:	89 e5                	mov    %esp,%ebp
+  801785:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801788:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80178b:	50                   	push   %eax
+  80178c:	ff 75 08             	push   0x8(%ebp)
+  80178f:	e8 c4 fe ff ff       	call   801658 <fd_lookup>
+  801794:	83 c4 10             	add    $0x10,%esp
+  801797:	85 c0                	test   %eax,%eax
+  801799:	79 02                	jns    80179d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80179b:	c9                   	leave
+  80179c:	c3                   	ret
+		return fd_close(fd, 1);
+  80179d:	83 ec 08             	sub    $0x8,%esp
+  8017a0:	6a 01                	push   $0x1
+  8017a2:	ff 75 f4             	push   -0xc(%ebp)
+  8017a5:	e8 51 ff ff ff       	call   8016fb <fd_close>
+  8017aa:	83 c4 10             	add    $0x10,%esp
+  8017ad:	eb ec                	jmp    80179b <close+0x19>
+
+008017af <close_all>:
+
+void
+close_all(void)
+{
+  8017af:	55                   	push   %ebp
+  8017b0:	89 e5                	mov    %esp,%ebp
+  8017b2:	53                   	push   %ebx
+  8017b3:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8017b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8017bb:	83 ec 0c             	sub    $0xc,%esp
+  8017be:	53                   	push   %ebx
+  8017bf:	e8 be ff ff ff       	call   801782 <close>
+	for (i = 0; i < MAXFD; i++)
+  8017c4:	83 c3 01             	add    $0x1,%ebx
+  8017c7:	83 c4 10             	add    $0x10,%esp
+  8017ca:	83 fb 20             	cmp    $0x20,%ebx
+  8017cd:	75 ec                	jne    8017bb <close_all+0xc>
+}
+  8017cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017d2:	c9                   	leave
+  8017d3:	c3                   	ret
+
+008017d4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8017d4:	55                   	push   %ebp
+  8017d5:	89 e5                	mov    %esp,%ebp
+  8017d7:	57                   	push   %edi
+  8017d8:	56                   	push   %esi
+  8017d9:	53                   	push   %ebx
+  8017da:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8017dd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017e0:	50                   	push   %eax
+  8017e1:	ff 75 08             	push   0x8(%ebp)
+  8017e4:	e8 6f fe ff ff       	call   801658 <fd_lookup>
+  8017e9:	89 c3                	mov    %eax,%ebx
+  8017eb:	83 c4 10             	add    $0x10,%esp
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	78 7f                	js     801871 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8017f2:	83 ec 0c             	sub    $0xc,%esp
+  8017f5:	ff 75 0c             	push   0xc(%ebp)
+  8017f8:	e8 85 ff ff ff       	call   801782 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8017fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801800:	c1 e6 0c             	shl    $0xc,%esi
+  801803:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801809:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80180c:	89 3c 24             	mov    %edi,(%esp)
+  80180f:	e8 d7 fd ff ff       	call   8015eb <fd2data>
+  801814:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801816:	89 34 24             	mov    %esi,(%esp)
+  801819:	e8 cd fd ff ff       	call   8015eb <fd2data>
+  80181e:	83 c4 10             	add    $0x10,%esp
+  801821:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801824:	89 d8                	mov    %ebx,%eax
+  801826:	c1 e8 16             	shr    $0x16,%eax
+  801829:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801830:	a8 01                	test   $0x1,%al
+  801832:	74 11                	je     801845 <dup+0x71>
+  801834:	89 d8                	mov    %ebx,%eax
+  801836:	c1 e8 0c             	shr    $0xc,%eax
+  801839:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801840:	f6 c2 01             	test   $0x1,%dl
+  801843:	75 36                	jne    80187b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801845:	89 f8                	mov    %edi,%eax
+  801847:	c1 e8 0c             	shr    $0xc,%eax
+  80184a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801851:	83 ec 0c             	sub    $0xc,%esp
+  801854:	25 07 0e 00 00       	and    $0xe07,%eax
+  801859:	50                   	push   %eax
+  80185a:	56                   	push   %esi
+  80185b:	6a 00                	push   $0x0
+  80185d:	57                   	push   %edi
+  80185e:	6a 00                	push   $0x0
+  801860:	e8 99 f5 ff ff       	call   800dfe <sys_page_map>
+  801865:	89 c3                	mov    %eax,%ebx
+  801867:	83 c4 20             	add    $0x20,%esp
+  80186a:	85 c0                	test   %eax,%eax
+  80186c:	78 33                	js     8018a1 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80186e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801871:	89 d8                	mov    %ebx,%eax
+  801873:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801876:	5b                   	pop    %ebx
+  801877:	5e                   	pop    %esi
+  801878:	5f                   	pop    %edi
+  801879:	5d                   	pop    %ebp
+  80187a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80187b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801882:	83 ec 0c             	sub    $0xc,%esp
+  801885:	25 07 0e 00 00       	and    $0xe07,%eax
+  80188a:	50                   	push   %eax
+  80188b:	ff 75 d4             	push   -0x2c(%ebp)
+  80188e:	6a 00                	push   $0x0
+  801890:	53                   	push   %ebx
+  801891:	6a 00                	push   $0x0
+  801893:	e8 66 f5 ff ff       	call   800dfe <sys_page_map>
+  801898:	89 c3                	mov    %eax,%ebx
+  80189a:	83 c4 20             	add    $0x20,%esp
+  80189d:	85 c0                	test   %eax,%eax
+  80189f:	79 a4                	jns    801845 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8018a1:	83 ec 08             	sub    $0x8,%esp
+  8018a4:	56                   	push   %esi
+  8018a5:	6a 00                	push   $0x0
+  8018a7:	e8 94 f5 ff ff       	call   800e40 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8018ac:	83 c4 08             	add    $0x8,%esp
+  8018af:	ff 75 d4             	push   -0x2c(%ebp)
+  8018b2:	6a 00                	push   $0x0
+  8018b4:	e8 87 f5 ff ff       	call   800e40 <sys_page_unmap>
+	return r;
+  8018b9:	83 c4 10             	add    $0x10,%esp
+  8018bc:	eb b3                	jmp    801871 <dup+0x9d>
+
+008018be <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8018be:	55                   	push   %ebp
+  8018bf:	89 e5                	mov    %esp,%ebp
+  8018c1:	56                   	push   %esi
+  8018c2:	53                   	push   %ebx
+  8018c3:	83 ec 18             	sub    $0x18,%esp
+  8018c6:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018c9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018cc:	50                   	push   %eax
+  8018cd:	56                   	push   %esi
+  8018ce:	e8 85 fd ff ff       	call   801658 <fd_lookup>
+  8018d3:	83 c4 10             	add    $0x10,%esp
+  8018d6:	85 c0                	test   %eax,%eax
+  8018d8:	78 3c                	js     801916 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018da:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018dd:	83 ec 08             	sub    $0x8,%esp
+  8018e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018e3:	50                   	push   %eax
+  8018e4:	ff 33                	push   (%ebx)
+  8018e6:	e8 bd fd ff ff       	call   8016a8 <dev_lookup>
+  8018eb:	83 c4 10             	add    $0x10,%esp
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	78 24                	js     801916 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018f2:	8b 43 08             	mov    0x8(%ebx),%eax
+  8018f5:	83 e0 03             	and    $0x3,%eax
+  8018f8:	83 f8 01             	cmp    $0x1,%eax
+  8018fb:	74 20                	je     80191d <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8018fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801900:	8b 40 08             	mov    0x8(%eax),%eax
+  801903:	85 c0                	test   %eax,%eax
+  801905:	74 37                	je     80193e <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801907:	83 ec 04             	sub    $0x4,%esp
+  80190a:	ff 75 10             	push   0x10(%ebp)
+  80190d:	ff 75 0c             	push   0xc(%ebp)
+  801910:	53                   	push   %ebx
+  801911:	ff d0                	call   *%eax
+  801913:	83 c4 10             	add    $0x10,%esp
+}
+  801916:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801919:	5b                   	pop    %ebx
+  80191a:	5e                   	pop    %esi
+  80191b:	5d                   	pop    %ebp
+  80191c:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80191d:	a1 08 50 80 00       	mov    0x805008,%eax
+  801922:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801925:	83 ec 04             	sub    $0x4,%esp
+  801928:	56                   	push   %esi
+  801929:	50                   	push   %eax
+  80192a:	68 a1 31 80 00       	push   $0x8031a1
+  80192f:	e8 e9 e9 ff ff       	call   80031d <cprintf>
+		return -E_INVAL;
+  801934:	83 c4 10             	add    $0x10,%esp
+  801937:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80193c:	eb d8                	jmp    801916 <read+0x58>
+		return -E_NOT_SUPP;
+  80193e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801943:	eb d1                	jmp    801916 <read+0x58>
+
+00801945 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801945:	55                   	push   %ebp
+  801946:	89 e5                	mov    %esp,%ebp
+  801948:	57                   	push   %edi
+  801949:	56                   	push   %esi
+  80194a:	53                   	push   %ebx
+  80194b:	83 ec 0c             	sub    $0xc,%esp
+  80194e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801951:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801954:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801959:	eb 02                	jmp    80195d <readn+0x18>
+  80195b:	01 c3                	add    %eax,%ebx
+  80195d:	39 f3                	cmp    %esi,%ebx
+  80195f:	73 21                	jae    801982 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801961:	83 ec 04             	sub    $0x4,%esp
+  801964:	89 f0                	mov    %esi,%eax
+  801966:	29 d8                	sub    %ebx,%eax
+  801968:	50                   	push   %eax
+  801969:	89 d8                	mov    %ebx,%eax
+  80196b:	03 45 0c             	add    0xc(%ebp),%eax
+  80196e:	50                   	push   %eax
+  80196f:	57                   	push   %edi
+  801970:	e8 49 ff ff ff       	call   8018be <read>
+		if (m < 0)
+  801975:	83 c4 10             	add    $0x10,%esp
+  801978:	85 c0                	test   %eax,%eax
+  80197a:	78 04                	js     801980 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80197c:	75 dd                	jne    80195b <readn+0x16>
+  80197e:	eb 02                	jmp    801982 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801980:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801982:	89 d8                	mov    %ebx,%eax
+  801984:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801987:	5b                   	pop    %ebx
+  801988:	5e                   	pop    %esi
+  801989:	5f                   	pop    %edi
+  80198a:	5d                   	pop    %ebp
+  80198b:	c3                   	ret
+
+0080198c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80198c:	55                   	push   %ebp
+  80198d:	89 e5                	mov    %esp,%ebp
+  80198f:	56                   	push   %esi
+  801990:	53                   	push   %ebx
+  801991:	83 ec 18             	sub    $0x18,%esp
+  801994:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801997:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80199a:	50                   	push   %eax
+  80199b:	53                   	push   %ebx
+  80199c:	e8 b7 fc ff ff       	call   801658 <fd_lookup>
+  8019a1:	83 c4 10             	add    $0x10,%esp
+  8019a4:	85 c0                	test   %eax,%eax
+  8019a6:	78 37                	js     8019df <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019a8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019ab:	83 ec 08             	sub    $0x8,%esp
+  8019ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b1:	50                   	push   %eax
+  8019b2:	ff 36                	push   (%esi)
+  8019b4:	e8 ef fc ff ff       	call   8016a8 <dev_lookup>
+  8019b9:	83 c4 10             	add    $0x10,%esp
+  8019bc:	85 c0                	test   %eax,%eax
+  8019be:	78 1f                	js     8019df <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019c0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019c4:	74 20                	je     8019e6 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8019c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019cc:	85 c0                	test   %eax,%eax
+  8019ce:	74 37                	je     801a07 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8019d0:	83 ec 04             	sub    $0x4,%esp
+  8019d3:	ff 75 10             	push   0x10(%ebp)
+  8019d6:	ff 75 0c             	push   0xc(%ebp)
+  8019d9:	56                   	push   %esi
+  8019da:	ff d0                	call   *%eax
+  8019dc:	83 c4 10             	add    $0x10,%esp
+}
+  8019df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019e2:	5b                   	pop    %ebx
+  8019e3:	5e                   	pop    %esi
+  8019e4:	5d                   	pop    %ebp
+  8019e5:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019e6:	a1 08 50 80 00       	mov    0x805008,%eax
+  8019eb:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8019ee:	83 ec 04             	sub    $0x4,%esp
+  8019f1:	53                   	push   %ebx
+  8019f2:	50                   	push   %eax
+  8019f3:	68 bd 31 80 00       	push   $0x8031bd
+  8019f8:	e8 20 e9 ff ff       	call   80031d <cprintf>
+		return -E_INVAL;
+  8019fd:	83 c4 10             	add    $0x10,%esp
+  801a00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a05:	eb d8                	jmp    8019df <write+0x53>
+		return -E_NOT_SUPP;
+  801a07:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a0c:	eb d1                	jmp    8019df <write+0x53>
+
+00801a0e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a0e:	55                   	push   %ebp
+  801a0f:	89 e5                	mov    %esp,%ebp
+  801a11:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a17:	50                   	push   %eax
+  801a18:	ff 75 08             	push   0x8(%ebp)
+  801a1b:	e8 38 fc ff ff       	call   801658 <fd_lookup>
+  801a20:	83 c4 10             	add    $0x10,%esp
+  801a23:	85 c0                	test   %eax,%eax
+  801a25:	78 0e                	js     801a35 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801a27:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a2d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801a30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a35:	c9                   	leave
+  801a36:	c3                   	ret
+
+00801a37 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a37:	55                   	push   %ebp
+  801a38:	89 e5                	mov    %esp,%ebp
+  801a3a:	56                   	push   %esi
+  801a3b:	53                   	push   %ebx
+  801a3c:	83 ec 18             	sub    $0x18,%esp
+  801a3f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a42:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a45:	50                   	push   %eax
+  801a46:	53                   	push   %ebx
+  801a47:	e8 0c fc ff ff       	call   801658 <fd_lookup>
+  801a4c:	83 c4 10             	add    $0x10,%esp
+  801a4f:	85 c0                	test   %eax,%eax
+  801a51:	78 34                	js     801a87 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a53:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a56:	83 ec 08             	sub    $0x8,%esp
+  801a59:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5c:	50                   	push   %eax
+  801a5d:	ff 36                	push   (%esi)
+  801a5f:	e8 44 fc ff ff       	call   8016a8 <dev_lookup>
+  801a64:	83 c4 10             	add    $0x10,%esp
+  801a67:	85 c0                	test   %eax,%eax
+  801a69:	78 1c                	js     801a87 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a6b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a6f:	74 1d                	je     801a8e <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a74:	8b 40 18             	mov    0x18(%eax),%eax
+  801a77:	85 c0                	test   %eax,%eax
+  801a79:	74 34                	je     801aaf <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a7b:	83 ec 08             	sub    $0x8,%esp
+  801a7e:	ff 75 0c             	push   0xc(%ebp)
+  801a81:	56                   	push   %esi
+  801a82:	ff d0                	call   *%eax
+  801a84:	83 c4 10             	add    $0x10,%esp
+}
+  801a87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a8a:	5b                   	pop    %ebx
+  801a8b:	5e                   	pop    %esi
+  801a8c:	5d                   	pop    %ebp
+  801a8d:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801a8e:	a1 08 50 80 00       	mov    0x805008,%eax
+  801a93:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a96:	83 ec 04             	sub    $0x4,%esp
+  801a99:	53                   	push   %ebx
+  801a9a:	50                   	push   %eax
+  801a9b:	68 80 31 80 00       	push   $0x803180
+  801aa0:	e8 78 e8 ff ff       	call   80031d <cprintf>
+		return -E_INVAL;
+  801aa5:	83 c4 10             	add    $0x10,%esp
+  801aa8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aad:	eb d8                	jmp    801a87 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801aaf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ab4:	eb d1                	jmp    801a87 <ftruncate+0x50>
+
+00801ab6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ab6:	55                   	push   %ebp
+  801ab7:	89 e5                	mov    %esp,%ebp
+  801ab9:	56                   	push   %esi
+  801aba:	53                   	push   %ebx
+  801abb:	83 ec 18             	sub    $0x18,%esp
+  801abe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ac1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ac4:	50                   	push   %eax
+  801ac5:	ff 75 08             	push   0x8(%ebp)
+  801ac8:	e8 8b fb ff ff       	call   801658 <fd_lookup>
+  801acd:	83 c4 10             	add    $0x10,%esp
+  801ad0:	85 c0                	test   %eax,%eax
+  801ad2:	78 49                	js     801b1d <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ad4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ad7:	83 ec 08             	sub    $0x8,%esp
+  801ada:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801add:	50                   	push   %eax
+  801ade:	ff 36                	push   (%esi)
+  801ae0:	e8 c3 fb ff ff       	call   8016a8 <dev_lookup>
+  801ae5:	83 c4 10             	add    $0x10,%esp
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	78 31                	js     801b1d <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801aec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aef:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801af3:	74 2f                	je     801b24 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801af5:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801af8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801aff:	00 00 00 
+	stat->st_isdir = 0;
+  801b02:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b09:	00 00 00 
+	stat->st_dev = dev;
+  801b0c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801b12:	83 ec 08             	sub    $0x8,%esp
+  801b15:	53                   	push   %ebx
+  801b16:	56                   	push   %esi
+  801b17:	ff 50 14             	call   *0x14(%eax)
+  801b1a:	83 c4 10             	add    $0x10,%esp
+}
+  801b1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b20:	5b                   	pop    %ebx
+  801b21:	5e                   	pop    %esi
+  801b22:	5d                   	pop    %ebp
+  801b23:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b24:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b29:	eb f2                	jmp    801b1d <fstat+0x67>
+
+00801b2b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b2b:	55                   	push   %ebp
+  801b2c:	89 e5                	mov    %esp,%ebp
+  801b2e:	56                   	push   %esi
+  801b2f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801b30:	83 ec 08             	sub    $0x8,%esp
+  801b33:	6a 00                	push   $0x0
+  801b35:	ff 75 08             	push   0x8(%ebp)
+  801b38:	e8 e4 01 00 00       	call   801d21 <open>
+  801b3d:	89 c3                	mov    %eax,%ebx
+  801b3f:	83 c4 10             	add    $0x10,%esp
+  801b42:	85 c0                	test   %eax,%eax
+  801b44:	78 1b                	js     801b61 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801b46:	83 ec 08             	sub    $0x8,%esp
+  801b49:	ff 75 0c             	push   0xc(%ebp)
+  801b4c:	50                   	push   %eax
+  801b4d:	e8 64 ff ff ff       	call   801ab6 <fstat>
+  801b52:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b54:	89 1c 24             	mov    %ebx,(%esp)
+  801b57:	e8 26 fc ff ff       	call   801782 <close>
+	return r;
+  801b5c:	83 c4 10             	add    $0x10,%esp
+  801b5f:	89 f3                	mov    %esi,%ebx
+}
+  801b61:	89 d8                	mov    %ebx,%eax
+  801b63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b66:	5b                   	pop    %ebx
+  801b67:	5e                   	pop    %esi
+  801b68:	5d                   	pop    %ebp
+  801b69:	c3                   	ret
+
+00801b6a <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b6a:	55                   	push   %ebp
+  801b6b:	89 e5                	mov    %esp,%ebp
+  801b6d:	56                   	push   %esi
+  801b6e:	53                   	push   %ebx
+  801b6f:	89 c6                	mov    %eax,%esi
+  801b71:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801b73:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801b7a:	74 27                	je     801ba3 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b7c:	6a 07                	push   $0x7
+  801b7e:	68 00 60 80 00       	push   $0x806000
+  801b83:	56                   	push   %esi
+  801b84:	ff 35 00 50 80 00    	push   0x805000
+  801b8a:	e8 e8 f9 ff ff       	call   801577 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801b8f:	83 c4 0c             	add    $0xc,%esp
+  801b92:	6a 00                	push   $0x0
+  801b94:	53                   	push   %ebx
+  801b95:	6a 00                	push   $0x0
+  801b97:	e8 63 f9 ff ff       	call   8014ff <ipc_recv>
+}
+  801b9c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b9f:	5b                   	pop    %ebx
+  801ba0:	5e                   	pop    %esi
+  801ba1:	5d                   	pop    %ebp
+  801ba2:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ba3:	83 ec 0c             	sub    $0xc,%esp
+  801ba6:	6a 01                	push   $0x1
+  801ba8:	e8 1e fa ff ff       	call   8015cb <ipc_find_env>
+  801bad:	a3 00 50 80 00       	mov    %eax,0x805000
+  801bb2:	83 c4 10             	add    $0x10,%esp
+  801bb5:	eb c5                	jmp    801b7c <fsipc+0x12>
+
+00801bb7 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801bb7:	55                   	push   %ebp
+  801bb8:	89 e5                	mov    %esp,%ebp
+  801bba:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bc3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801bc8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bcb:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801bd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd5:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bda:	e8 8b ff ff ff       	call   801b6a <fsipc>
+}
+  801bdf:	c9                   	leave
+  801be0:	c3                   	ret
+
+00801be1 <devfile_flush>:
+{
+  801be1:	55                   	push   %ebp
+  801be2:	89 e5                	mov    %esp,%ebp
+  801be4:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801be7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bea:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bed:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801bf2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf7:	b8 06 00 00 00       	mov    $0x6,%eax
+  801bfc:	e8 69 ff ff ff       	call   801b6a <fsipc>
+}
+  801c01:	c9                   	leave
+  801c02:	c3                   	ret
+
+00801c03 <devfile_stat>:
+{
+  801c03:	55                   	push   %ebp
+  801c04:	89 e5                	mov    %esp,%ebp
+  801c06:	53                   	push   %ebx
+  801c07:	83 ec 04             	sub    $0x4,%esp
+  801c0a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c10:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c13:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c1d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c22:	e8 43 ff ff ff       	call   801b6a <fsipc>
+  801c27:	85 c0                	test   %eax,%eax
+  801c29:	78 2c                	js     801c57 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c2b:	83 ec 08             	sub    $0x8,%esp
+  801c2e:	68 00 60 80 00       	push   $0x806000
+  801c33:	53                   	push   %ebx
+  801c34:	e8 d2 ec ff ff       	call   80090b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801c39:	a1 80 60 80 00       	mov    0x806080,%eax
+  801c3e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c44:	a1 84 60 80 00       	mov    0x806084,%eax
+  801c49:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801c4f:	83 c4 10             	add    $0x10,%esp
+  801c52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c5a:	c9                   	leave
+  801c5b:	c3                   	ret
+
+00801c5c <devfile_write>:
+{
+  801c5c:	55                   	push   %ebp
+  801c5d:	89 e5                	mov    %esp,%ebp
+  801c5f:	83 ec 0c             	sub    $0xc,%esp
+  801c62:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801c65:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801c6a:	39 d0                	cmp    %edx,%eax
+  801c6c:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c72:	8b 52 0c             	mov    0xc(%edx),%edx
+  801c75:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801c7b:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801c80:	50                   	push   %eax
+  801c81:	ff 75 0c             	push   0xc(%ebp)
+  801c84:	68 08 60 80 00       	push   $0x806008
+  801c89:	e8 03 ee ff ff       	call   800a91 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801c8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c93:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c98:	e8 cd fe ff ff       	call   801b6a <fsipc>
+}
+  801c9d:	c9                   	leave
+  801c9e:	c3                   	ret
+
+00801c9f <devfile_read>:
+{
+  801c9f:	55                   	push   %ebp
+  801ca0:	89 e5                	mov    %esp,%ebp
+  801ca2:	56                   	push   %esi
+  801ca3:	53                   	push   %ebx
+  801ca4:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ca7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801caa:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cad:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801cb2:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801cb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbd:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cc2:	e8 a3 fe ff ff       	call   801b6a <fsipc>
+  801cc7:	89 c3                	mov    %eax,%ebx
+  801cc9:	85 c0                	test   %eax,%eax
+  801ccb:	78 1f                	js     801cec <devfile_read+0x4d>
+	assert(r <= n);
+  801ccd:	39 c6                	cmp    %eax,%esi
+  801ccf:	72 24                	jb     801cf5 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801cd1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801cd6:	7f 33                	jg     801d0b <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801cd8:	83 ec 04             	sub    $0x4,%esp
+  801cdb:	50                   	push   %eax
+  801cdc:	68 00 60 80 00       	push   $0x806000
+  801ce1:	ff 75 0c             	push   0xc(%ebp)
+  801ce4:	e8 a8 ed ff ff       	call   800a91 <memmove>
+	return r;
+  801ce9:	83 c4 10             	add    $0x10,%esp
+}
+  801cec:	89 d8                	mov    %ebx,%eax
+  801cee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf1:	5b                   	pop    %ebx
+  801cf2:	5e                   	pop    %esi
+  801cf3:	5d                   	pop    %ebp
+  801cf4:	c3                   	ret
+	assert(r <= n);
+  801cf5:	68 f0 31 80 00       	push   $0x8031f0
+  801cfa:	68 f7 31 80 00       	push   $0x8031f7
+  801cff:	6a 7c                	push   $0x7c
+  801d01:	68 0c 32 80 00       	push   $0x80320c
+  801d06:	e8 37 e5 ff ff       	call   800242 <_panic>
+	assert(r <= PGSIZE);
+  801d0b:	68 17 32 80 00       	push   $0x803217
+  801d10:	68 f7 31 80 00       	push   $0x8031f7
+  801d15:	6a 7d                	push   $0x7d
+  801d17:	68 0c 32 80 00       	push   $0x80320c
+  801d1c:	e8 21 e5 ff ff       	call   800242 <_panic>
+
+00801d21 <open>:
+{
+  801d21:	55                   	push   %ebp
+  801d22:	89 e5                	mov    %esp,%ebp
+  801d24:	56                   	push   %esi
+  801d25:	53                   	push   %ebx
+  801d26:	83 ec 1c             	sub    $0x1c,%esp
+  801d29:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801d2c:	56                   	push   %esi
+  801d2d:	e8 9e eb ff ff       	call   8008d0 <strlen>
+  801d32:	83 c4 10             	add    $0x10,%esp
+  801d35:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d3a:	7f 6c                	jg     801da8 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d3c:	83 ec 0c             	sub    $0xc,%esp
+  801d3f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d42:	50                   	push   %eax
+  801d43:	e8 ba f8 ff ff       	call   801602 <fd_alloc>
+  801d48:	89 c3                	mov    %eax,%ebx
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	85 c0                	test   %eax,%eax
+  801d4f:	78 3c                	js     801d8d <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d51:	83 ec 08             	sub    $0x8,%esp
+  801d54:	56                   	push   %esi
+  801d55:	68 00 60 80 00       	push   $0x806000
+  801d5a:	e8 ac eb ff ff       	call   80090b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d62:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d67:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d6f:	e8 f6 fd ff ff       	call   801b6a <fsipc>
+  801d74:	89 c3                	mov    %eax,%ebx
+  801d76:	83 c4 10             	add    $0x10,%esp
+  801d79:	85 c0                	test   %eax,%eax
+  801d7b:	78 19                	js     801d96 <open+0x75>
+	return fd2num(fd);
+  801d7d:	83 ec 0c             	sub    $0xc,%esp
+  801d80:	ff 75 f4             	push   -0xc(%ebp)
+  801d83:	e8 53 f8 ff ff       	call   8015db <fd2num>
+  801d88:	89 c3                	mov    %eax,%ebx
+  801d8a:	83 c4 10             	add    $0x10,%esp
+}
+  801d8d:	89 d8                	mov    %ebx,%eax
+  801d8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d92:	5b                   	pop    %ebx
+  801d93:	5e                   	pop    %esi
+  801d94:	5d                   	pop    %ebp
+  801d95:	c3                   	ret
+		fd_close(fd, 0);
+  801d96:	83 ec 08             	sub    $0x8,%esp
+  801d99:	6a 00                	push   $0x0
+  801d9b:	ff 75 f4             	push   -0xc(%ebp)
+  801d9e:	e8 58 f9 ff ff       	call   8016fb <fd_close>
+		return r;
+  801da3:	83 c4 10             	add    $0x10,%esp
+  801da6:	eb e5                	jmp    801d8d <open+0x6c>
+		return -E_BAD_PATH;
+  801da8:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801dad:	eb de                	jmp    801d8d <open+0x6c>
+
+00801daf <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801daf:	55                   	push   %ebp
+  801db0:	89 e5                	mov    %esp,%ebp
+  801db2:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801db5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dba:	b8 08 00 00 00       	mov    $0x8,%eax
+  801dbf:	e8 a6 fd ff ff       	call   801b6a <fsipc>
+}
+  801dc4:	c9                   	leave
+  801dc5:	c3                   	ret
+
+00801dc6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  801dc6:	55                   	push   %ebp
+  801dc7:	89 e5                	mov    %esp,%ebp
+  801dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  801dcc:	89 c2                	mov    %eax,%edx
+  801dce:	c1 ea 16             	shr    $0x16,%edx
+  801dd1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  801dd8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  801ddd:	f6 c1 01             	test   $0x1,%cl
+  801de0:	74 22                	je     801e04 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  801de2:	c1 e8 0c             	shr    $0xc,%eax
+  801de5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  801dec:	a8 01                	test   $0x1,%al
+  801dee:	74 14                	je     801e04 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  801df0:	c1 e8 0c             	shr    $0xc,%eax
+  801df3:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  801df6:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  801dfd:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  801e01:	0f b7 d2             	movzwl %dx,%edx
+}
+  801e04:	89 d0                	mov    %edx,%eax
+  801e06:	5d                   	pop    %ebp
+  801e07:	c3                   	ret
+
+00801e08 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e08:	55                   	push   %ebp
+  801e09:	89 e5                	mov    %esp,%ebp
+  801e0b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801e0e:	68 23 32 80 00       	push   $0x803223
+  801e13:	ff 75 0c             	push   0xc(%ebp)
+  801e16:	e8 f0 ea ff ff       	call   80090b <strcpy>
+	return 0;
+}
+  801e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e20:	c9                   	leave
+  801e21:	c3                   	ret
+
+00801e22 <devsock_close>:
+{
+  801e22:	55                   	push   %ebp
+  801e23:	89 e5                	mov    %esp,%ebp
+  801e25:	53                   	push   %ebx
+  801e26:	83 ec 10             	sub    $0x10,%esp
+  801e29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801e2c:	53                   	push   %ebx
+  801e2d:	e8 94 ff ff ff       	call   801dc6 <pageref>
+  801e32:	89 c2                	mov    %eax,%edx
+  801e34:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801e37:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801e3c:	83 fa 01             	cmp    $0x1,%edx
+  801e3f:	74 05                	je     801e46 <devsock_close+0x24>
+}
+  801e41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e44:	c9                   	leave
+  801e45:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801e46:	83 ec 0c             	sub    $0xc,%esp
+  801e49:	ff 73 0c             	push   0xc(%ebx)
+  801e4c:	e8 b7 02 00 00       	call   802108 <nsipc_close>
+  801e51:	83 c4 10             	add    $0x10,%esp
+  801e54:	eb eb                	jmp    801e41 <devsock_close+0x1f>
+
+00801e56 <devsock_write>:
+{
+  801e56:	55                   	push   %ebp
+  801e57:	89 e5                	mov    %esp,%ebp
+  801e59:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801e5c:	6a 00                	push   $0x0
+  801e5e:	ff 75 10             	push   0x10(%ebp)
+  801e61:	ff 75 0c             	push   0xc(%ebp)
+  801e64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e67:	ff 70 0c             	push   0xc(%eax)
+  801e6a:	e8 79 03 00 00       	call   8021e8 <nsipc_send>
+}
+  801e6f:	c9                   	leave
+  801e70:	c3                   	ret
+
+00801e71 <devsock_read>:
+{
+  801e71:	55                   	push   %ebp
+  801e72:	89 e5                	mov    %esp,%ebp
+  801e74:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801e77:	6a 00                	push   $0x0
+  801e79:	ff 75 10             	push   0x10(%ebp)
+  801e7c:	ff 75 0c             	push   0xc(%ebp)
+  801e7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e82:	ff 70 0c             	push   0xc(%eax)
+  801e85:	e8 ef 02 00 00       	call   802179 <nsipc_recv>
+}
+  801e8a:	c9                   	leave
+  801e8b:	c3                   	ret
+
+00801e8c <fd2sockid>:
+{
+  801e8c:	55                   	push   %ebp
+  801e8d:	89 e5                	mov    %esp,%ebp
+  801e8f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801e92:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e95:	52                   	push   %edx
+  801e96:	50                   	push   %eax
+  801e97:	e8 bc f7 ff ff       	call   801658 <fd_lookup>
+  801e9c:	83 c4 10             	add    $0x10,%esp
+  801e9f:	85 c0                	test   %eax,%eax
+  801ea1:	78 10                	js     801eb3 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801ea3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ea6:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801eac:	39 08                	cmp    %ecx,(%eax)
+  801eae:	75 05                	jne    801eb5 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801eb0:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801eb3:	c9                   	leave
+  801eb4:	c3                   	ret
+		return -E_NOT_SUPP;
+  801eb5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eba:	eb f7                	jmp    801eb3 <fd2sockid+0x27>
+
+00801ebc <alloc_sockfd>:
+{
+  801ebc:	55                   	push   %ebp
+  801ebd:	89 e5                	mov    %esp,%ebp
+  801ebf:	56                   	push   %esi
+  801ec0:	53                   	push   %ebx
+  801ec1:	83 ec 1c             	sub    $0x1c,%esp
+  801ec4:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801ec6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ec9:	50                   	push   %eax
+  801eca:	e8 33 f7 ff ff       	call   801602 <fd_alloc>
+  801ecf:	89 c3                	mov    %eax,%ebx
+  801ed1:	83 c4 10             	add    $0x10,%esp
+  801ed4:	85 c0                	test   %eax,%eax
+  801ed6:	78 43                	js     801f1b <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ed8:	83 ec 04             	sub    $0x4,%esp
+  801edb:	68 07 04 00 00       	push   $0x407
+  801ee0:	ff 75 f4             	push   -0xc(%ebp)
+  801ee3:	6a 00                	push   $0x0
+  801ee5:	e8 8e ee ff ff       	call   800d78 <sys_page_alloc>
+  801eea:	89 c3                	mov    %eax,%ebx
+  801eec:	83 c4 10             	add    $0x10,%esp
+  801eef:	85 c0                	test   %eax,%eax
+  801ef1:	78 28                	js     801f1b <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801ef3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ef6:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801efc:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801efe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f01:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801f08:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801f0b:	83 ec 0c             	sub    $0xc,%esp
+  801f0e:	50                   	push   %eax
+  801f0f:	e8 c7 f6 ff ff       	call   8015db <fd2num>
+  801f14:	89 c3                	mov    %eax,%ebx
+  801f16:	83 c4 10             	add    $0x10,%esp
+  801f19:	eb 0c                	jmp    801f27 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801f1b:	83 ec 0c             	sub    $0xc,%esp
+  801f1e:	56                   	push   %esi
+  801f1f:	e8 e4 01 00 00       	call   802108 <nsipc_close>
+		return r;
+  801f24:	83 c4 10             	add    $0x10,%esp
+}
+  801f27:	89 d8                	mov    %ebx,%eax
+  801f29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f2c:	5b                   	pop    %ebx
+  801f2d:	5e                   	pop    %esi
+  801f2e:	5d                   	pop    %ebp
+  801f2f:	c3                   	ret
+
+00801f30 <accept>:
+{
+  801f30:	55                   	push   %ebp
+  801f31:	89 e5                	mov    %esp,%ebp
+  801f33:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f39:	e8 4e ff ff ff       	call   801e8c <fd2sockid>
+  801f3e:	85 c0                	test   %eax,%eax
+  801f40:	78 1b                	js     801f5d <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801f42:	83 ec 04             	sub    $0x4,%esp
+  801f45:	ff 75 10             	push   0x10(%ebp)
+  801f48:	ff 75 0c             	push   0xc(%ebp)
+  801f4b:	50                   	push   %eax
+  801f4c:	e8 0e 01 00 00       	call   80205f <nsipc_accept>
+  801f51:	83 c4 10             	add    $0x10,%esp
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	78 05                	js     801f5d <accept+0x2d>
+	return alloc_sockfd(r);
+  801f58:	e8 5f ff ff ff       	call   801ebc <alloc_sockfd>
+}
+  801f5d:	c9                   	leave
+  801f5e:	c3                   	ret
+
+00801f5f <bind>:
+{
+  801f5f:	55                   	push   %ebp
+  801f60:	89 e5                	mov    %esp,%ebp
+  801f62:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f65:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f68:	e8 1f ff ff ff       	call   801e8c <fd2sockid>
+  801f6d:	85 c0                	test   %eax,%eax
+  801f6f:	78 12                	js     801f83 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801f71:	83 ec 04             	sub    $0x4,%esp
+  801f74:	ff 75 10             	push   0x10(%ebp)
+  801f77:	ff 75 0c             	push   0xc(%ebp)
+  801f7a:	50                   	push   %eax
+  801f7b:	e8 31 01 00 00       	call   8020b1 <nsipc_bind>
+  801f80:	83 c4 10             	add    $0x10,%esp
+}
+  801f83:	c9                   	leave
+  801f84:	c3                   	ret
+
+00801f85 <shutdown>:
+{
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8e:	e8 f9 fe ff ff       	call   801e8c <fd2sockid>
+  801f93:	85 c0                	test   %eax,%eax
+  801f95:	78 0f                	js     801fa6 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801f97:	83 ec 08             	sub    $0x8,%esp
+  801f9a:	ff 75 0c             	push   0xc(%ebp)
+  801f9d:	50                   	push   %eax
+  801f9e:	e8 43 01 00 00       	call   8020e6 <nsipc_shutdown>
+  801fa3:	83 c4 10             	add    $0x10,%esp
+}
+  801fa6:	c9                   	leave
+  801fa7:	c3                   	ret
+
+00801fa8 <connect>:
+{
+  801fa8:	55                   	push   %ebp
+  801fa9:	89 e5                	mov    %esp,%ebp
+  801fab:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb1:	e8 d6 fe ff ff       	call   801e8c <fd2sockid>
+  801fb6:	85 c0                	test   %eax,%eax
+  801fb8:	78 12                	js     801fcc <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801fba:	83 ec 04             	sub    $0x4,%esp
+  801fbd:	ff 75 10             	push   0x10(%ebp)
+  801fc0:	ff 75 0c             	push   0xc(%ebp)
+  801fc3:	50                   	push   %eax
+  801fc4:	e8 59 01 00 00       	call   802122 <nsipc_connect>
+  801fc9:	83 c4 10             	add    $0x10,%esp
+}
+  801fcc:	c9                   	leave
+  801fcd:	c3                   	ret
+
+00801fce <listen>:
+{
+  801fce:	55                   	push   %ebp
+  801fcf:	89 e5                	mov    %esp,%ebp
+  801fd1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd7:	e8 b0 fe ff ff       	call   801e8c <fd2sockid>
+  801fdc:	85 c0                	test   %eax,%eax
+  801fde:	78 0f                	js     801fef <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801fe0:	83 ec 08             	sub    $0x8,%esp
+  801fe3:	ff 75 0c             	push   0xc(%ebp)
+  801fe6:	50                   	push   %eax
+  801fe7:	e8 6b 01 00 00       	call   802157 <nsipc_listen>
+  801fec:	83 c4 10             	add    $0x10,%esp
+}
+  801fef:	c9                   	leave
+  801ff0:	c3                   	ret
+
+00801ff1 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801ff1:	55                   	push   %ebp
+  801ff2:	89 e5                	mov    %esp,%ebp
+  801ff4:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801ff7:	ff 75 10             	push   0x10(%ebp)
+  801ffa:	ff 75 0c             	push   0xc(%ebp)
+  801ffd:	ff 75 08             	push   0x8(%ebp)
+  802000:	e8 41 02 00 00       	call   802246 <nsipc_socket>
+  802005:	83 c4 10             	add    $0x10,%esp
+  802008:	85 c0                	test   %eax,%eax
+  80200a:	78 05                	js     802011 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80200c:	e8 ab fe ff ff       	call   801ebc <alloc_sockfd>
+}
+  802011:	c9                   	leave
+  802012:	c3                   	ret
+
+00802013 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802013:	55                   	push   %ebp
+  802014:	89 e5                	mov    %esp,%ebp
+  802016:	53                   	push   %ebx
+  802017:	83 ec 04             	sub    $0x4,%esp
+  80201a:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80201c:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802023:	74 26                	je     80204b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802025:	6a 07                	push   $0x7
+  802027:	68 00 70 80 00       	push   $0x807000
+  80202c:	53                   	push   %ebx
+  80202d:	ff 35 04 50 80 00    	push   0x805004
+  802033:	e8 3f f5 ff ff       	call   801577 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802038:	83 c4 0c             	add    $0xc,%esp
+  80203b:	6a 00                	push   $0x0
+  80203d:	6a 00                	push   $0x0
+  80203f:	6a 00                	push   $0x0
+  802041:	e8 b9 f4 ff ff       	call   8014ff <ipc_recv>
+}
+  802046:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802049:	c9                   	leave
+  80204a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80204b:	83 ec 0c             	sub    $0xc,%esp
+  80204e:	6a 02                	push   $0x2
+  802050:	e8 76 f5 ff ff       	call   8015cb <ipc_find_env>
+  802055:	a3 04 50 80 00       	mov    %eax,0x805004
+  80205a:	83 c4 10             	add    $0x10,%esp
+  80205d:	eb c6                	jmp    802025 <nsipc+0x12>
+
+0080205f <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80205f:	55                   	push   %ebp
+  802060:	89 e5                	mov    %esp,%ebp
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802067:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80206f:	8b 06                	mov    (%esi),%eax
+  802071:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802076:	b8 01 00 00 00       	mov    $0x1,%eax
+  80207b:	e8 93 ff ff ff       	call   802013 <nsipc>
+  802080:	89 c3                	mov    %eax,%ebx
+  802082:	85 c0                	test   %eax,%eax
+  802084:	79 09                	jns    80208f <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802086:	89 d8                	mov    %ebx,%eax
+  802088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80208b:	5b                   	pop    %ebx
+  80208c:	5e                   	pop    %esi
+  80208d:	5d                   	pop    %ebp
+  80208e:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80208f:	83 ec 04             	sub    $0x4,%esp
+  802092:	ff 35 10 70 80 00    	push   0x807010
+  802098:	68 00 70 80 00       	push   $0x807000
+  80209d:	ff 75 0c             	push   0xc(%ebp)
+  8020a0:	e8 ec e9 ff ff       	call   800a91 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8020a5:	a1 10 70 80 00       	mov    0x807010,%eax
+  8020aa:	89 06                	mov    %eax,(%esi)
+  8020ac:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8020af:	eb d5                	jmp    802086 <nsipc_accept+0x27>
+
+008020b1 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8020b1:	55                   	push   %ebp
+  8020b2:	89 e5                	mov    %esp,%ebp
+  8020b4:	53                   	push   %ebx
+  8020b5:	83 ec 08             	sub    $0x8,%esp
+  8020b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8020bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020be:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8020c3:	53                   	push   %ebx
+  8020c4:	ff 75 0c             	push   0xc(%ebp)
+  8020c7:	68 04 70 80 00       	push   $0x807004
+  8020cc:	e8 c0 e9 ff ff       	call   800a91 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8020d1:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8020d7:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020dc:	e8 32 ff ff ff       	call   802013 <nsipc>
+}
+  8020e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020e4:	c9                   	leave
+  8020e5:	c3                   	ret
+
+008020e6 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8020e6:	55                   	push   %ebp
+  8020e7:	89 e5                	mov    %esp,%ebp
+  8020e9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8020ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ef:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8020f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020f7:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8020fc:	b8 03 00 00 00       	mov    $0x3,%eax
+  802101:	e8 0d ff ff ff       	call   802013 <nsipc>
+}
+  802106:	c9                   	leave
+  802107:	c3                   	ret
+
+00802108 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802108:	55                   	push   %ebp
+  802109:	89 e5                	mov    %esp,%ebp
+  80210b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80210e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802111:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802116:	b8 04 00 00 00       	mov    $0x4,%eax
+  80211b:	e8 f3 fe ff ff       	call   802013 <nsipc>
+}
+  802120:	c9                   	leave
+  802121:	c3                   	ret
+
+00802122 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802122:	55                   	push   %ebp
+  802123:	89 e5                	mov    %esp,%ebp
+  802125:	53                   	push   %ebx
+  802126:	83 ec 08             	sub    $0x8,%esp
+  802129:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80212c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80212f:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802134:	53                   	push   %ebx
+  802135:	ff 75 0c             	push   0xc(%ebp)
+  802138:	68 04 70 80 00       	push   $0x807004
+  80213d:	e8 4f e9 ff ff       	call   800a91 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802142:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802148:	b8 05 00 00 00       	mov    $0x5,%eax
+  80214d:	e8 c1 fe ff ff       	call   802013 <nsipc>
+}
+  802152:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802155:	c9                   	leave
+  802156:	c3                   	ret
+
+00802157 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802157:	55                   	push   %ebp
+  802158:	89 e5                	mov    %esp,%ebp
+  80215a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80215d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802160:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802165:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802168:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80216d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802172:	e8 9c fe ff ff       	call   802013 <nsipc>
+}
+  802177:	c9                   	leave
+  802178:	c3                   	ret
+
+00802179 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802179:	55                   	push   %ebp
+  80217a:	89 e5                	mov    %esp,%ebp
+  80217c:	56                   	push   %esi
+  80217d:	53                   	push   %ebx
+  80217e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802181:	8b 45 08             	mov    0x8(%ebp),%eax
+  802184:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802189:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80218f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802192:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802197:	b8 07 00 00 00       	mov    $0x7,%eax
+  80219c:	e8 72 fe ff ff       	call   802013 <nsipc>
+  8021a1:	89 c3                	mov    %eax,%ebx
+  8021a3:	85 c0                	test   %eax,%eax
+  8021a5:	78 22                	js     8021c9 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8021a7:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8021ac:	39 c6                	cmp    %eax,%esi
+  8021ae:	0f 4e c6             	cmovle %esi,%eax
+  8021b1:	39 c3                	cmp    %eax,%ebx
+  8021b3:	7f 1d                	jg     8021d2 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8021b5:	83 ec 04             	sub    $0x4,%esp
+  8021b8:	53                   	push   %ebx
+  8021b9:	68 00 70 80 00       	push   $0x807000
+  8021be:	ff 75 0c             	push   0xc(%ebp)
+  8021c1:	e8 cb e8 ff ff       	call   800a91 <memmove>
+  8021c6:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8021c9:	89 d8                	mov    %ebx,%eax
+  8021cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021ce:	5b                   	pop    %ebx
+  8021cf:	5e                   	pop    %esi
+  8021d0:	5d                   	pop    %ebp
+  8021d1:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8021d2:	68 2f 32 80 00       	push   $0x80322f
+  8021d7:	68 f7 31 80 00       	push   $0x8031f7
+  8021dc:	6a 62                	push   $0x62
+  8021de:	68 44 32 80 00       	push   $0x803244
+  8021e3:	e8 5a e0 ff ff       	call   800242 <_panic>
+
+008021e8 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8021e8:	55                   	push   %ebp
+  8021e9:	89 e5                	mov    %esp,%ebp
+  8021eb:	53                   	push   %ebx
+  8021ec:	83 ec 04             	sub    $0x4,%esp
+  8021ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8021f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f5:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8021fa:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802200:	7f 2e                	jg     802230 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802202:	83 ec 04             	sub    $0x4,%esp
+  802205:	53                   	push   %ebx
+  802206:	ff 75 0c             	push   0xc(%ebp)
+  802209:	68 0c 70 80 00       	push   $0x80700c
+  80220e:	e8 7e e8 ff ff       	call   800a91 <memmove>
+	nsipcbuf.send.req_size = size;
+  802213:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802219:	8b 45 14             	mov    0x14(%ebp),%eax
+  80221c:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802221:	b8 08 00 00 00       	mov    $0x8,%eax
+  802226:	e8 e8 fd ff ff       	call   802013 <nsipc>
+}
+  80222b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80222e:	c9                   	leave
+  80222f:	c3                   	ret
+	assert(size < 1600);
+  802230:	68 50 32 80 00       	push   $0x803250
+  802235:	68 f7 31 80 00       	push   $0x8031f7
+  80223a:	6a 6d                	push   $0x6d
+  80223c:	68 44 32 80 00       	push   $0x803244
+  802241:	e8 fc df ff ff       	call   800242 <_panic>
+
+00802246 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802246:	55                   	push   %ebp
+  802247:	89 e5                	mov    %esp,%ebp
+  802249:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80224c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80224f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802254:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802257:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80225c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80225f:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802264:	b8 09 00 00 00       	mov    $0x9,%eax
+  802269:	e8 a5 fd ff ff       	call   802013 <nsipc>
+}
+  80226e:	c9                   	leave
+  80226f:	c3                   	ret
+
+00802270 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802270:	55                   	push   %ebp
+  802271:	89 e5                	mov    %esp,%ebp
+  802273:	56                   	push   %esi
+  802274:	53                   	push   %ebx
+  802275:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802278:	83 ec 0c             	sub    $0xc,%esp
+  80227b:	ff 75 08             	push   0x8(%ebp)
+  80227e:	e8 68 f3 ff ff       	call   8015eb <fd2data>
+  802283:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802285:	83 c4 08             	add    $0x8,%esp
+  802288:	68 5c 32 80 00       	push   $0x80325c
+  80228d:	53                   	push   %ebx
+  80228e:	e8 78 e6 ff ff       	call   80090b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802293:	8b 46 04             	mov    0x4(%esi),%eax
+  802296:	2b 06                	sub    (%esi),%eax
+  802298:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80229e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022a5:	00 00 00 
+	stat->st_dev = &devpipe;
+  8022a8:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8022af:	40 80 00 
+	return 0;
+}
+  8022b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ba:	5b                   	pop    %ebx
+  8022bb:	5e                   	pop    %esi
+  8022bc:	5d                   	pop    %ebp
+  8022bd:	c3                   	ret
+
+008022be <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8022be:	55                   	push   %ebp
+  8022bf:	89 e5                	mov    %esp,%ebp
+  8022c1:	53                   	push   %ebx
+  8022c2:	83 ec 0c             	sub    $0xc,%esp
+  8022c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8022c8:	53                   	push   %ebx
+  8022c9:	6a 00                	push   $0x0
+  8022cb:	e8 70 eb ff ff       	call   800e40 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8022d0:	89 1c 24             	mov    %ebx,(%esp)
+  8022d3:	e8 13 f3 ff ff       	call   8015eb <fd2data>
+  8022d8:	83 c4 08             	add    $0x8,%esp
+  8022db:	50                   	push   %eax
+  8022dc:	6a 00                	push   $0x0
+  8022de:	e8 5d eb ff ff       	call   800e40 <sys_page_unmap>
+}
+  8022e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e6:	c9                   	leave
+  8022e7:	c3                   	ret
+
+008022e8 <_pipeisclosed>:
+{
+  8022e8:	55                   	push   %ebp
+  8022e9:	89 e5                	mov    %esp,%ebp
+  8022eb:	57                   	push   %edi
+  8022ec:	56                   	push   %esi
+  8022ed:	53                   	push   %ebx
+  8022ee:	83 ec 1c             	sub    $0x1c,%esp
+  8022f1:	89 c7                	mov    %eax,%edi
+  8022f3:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8022f5:	a1 08 50 80 00       	mov    0x805008,%eax
+  8022fa:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8022fd:	83 ec 0c             	sub    $0xc,%esp
+  802300:	57                   	push   %edi
+  802301:	e8 c0 fa ff ff       	call   801dc6 <pageref>
+  802306:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802309:	89 34 24             	mov    %esi,(%esp)
+  80230c:	e8 b5 fa ff ff       	call   801dc6 <pageref>
+		nn = thisenv->env_runs;
+  802311:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802317:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  80231a:	83 c4 10             	add    $0x10,%esp
+  80231d:	39 cb                	cmp    %ecx,%ebx
+  80231f:	74 1b                	je     80233c <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802321:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802324:	75 cf                	jne    8022f5 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802326:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802329:	6a 01                	push   $0x1
+  80232b:	50                   	push   %eax
+  80232c:	53                   	push   %ebx
+  80232d:	68 63 32 80 00       	push   $0x803263
+  802332:	e8 e6 df ff ff       	call   80031d <cprintf>
+  802337:	83 c4 10             	add    $0x10,%esp
+  80233a:	eb b9                	jmp    8022f5 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80233c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80233f:	0f 94 c0             	sete   %al
+  802342:	0f b6 c0             	movzbl %al,%eax
+}
+  802345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802348:	5b                   	pop    %ebx
+  802349:	5e                   	pop    %esi
+  80234a:	5f                   	pop    %edi
+  80234b:	5d                   	pop    %ebp
+  80234c:	c3                   	ret
+
+0080234d <devpipe_write>:
+{
+  80234d:	55                   	push   %ebp
+  80234e:	89 e5                	mov    %esp,%ebp
+  802350:	57                   	push   %edi
+  802351:	56                   	push   %esi
+  802352:	53                   	push   %ebx
+  802353:	83 ec 28             	sub    $0x28,%esp
+  802356:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802359:	56                   	push   %esi
+  80235a:	e8 8c f2 ff ff       	call   8015eb <fd2data>
+  80235f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802361:	83 c4 10             	add    $0x10,%esp
+  802364:	bf 00 00 00 00       	mov    $0x0,%edi
+  802369:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80236c:	75 09                	jne    802377 <devpipe_write+0x2a>
+	return i;
+  80236e:	89 f8                	mov    %edi,%eax
+  802370:	eb 23                	jmp    802395 <devpipe_write+0x48>
+			sys_yield();
+  802372:	e8 81 e9 ff ff       	call   800cf8 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802377:	8b 43 04             	mov    0x4(%ebx),%eax
+  80237a:	8b 0b                	mov    (%ebx),%ecx
+  80237c:	8d 51 20             	lea    0x20(%ecx),%edx
+  80237f:	39 d0                	cmp    %edx,%eax
+  802381:	72 1a                	jb     80239d <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802383:	89 da                	mov    %ebx,%edx
+  802385:	89 f0                	mov    %esi,%eax
+  802387:	e8 5c ff ff ff       	call   8022e8 <_pipeisclosed>
+  80238c:	85 c0                	test   %eax,%eax
+  80238e:	74 e2                	je     802372 <devpipe_write+0x25>
+				return 0;
+  802390:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802395:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802398:	5b                   	pop    %ebx
+  802399:	5e                   	pop    %esi
+  80239a:	5f                   	pop    %edi
+  80239b:	5d                   	pop    %ebp
+  80239c:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80239d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023a0:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8023a4:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8023a7:	89 c2                	mov    %eax,%edx
+  8023a9:	c1 fa 1f             	sar    $0x1f,%edx
+  8023ac:	89 d1                	mov    %edx,%ecx
+  8023ae:	c1 e9 1b             	shr    $0x1b,%ecx
+  8023b1:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8023b4:	83 e2 1f             	and    $0x1f,%edx
+  8023b7:	29 ca                	sub    %ecx,%edx
+  8023b9:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8023bd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8023c1:	83 c0 01             	add    $0x1,%eax
+  8023c4:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8023c7:	83 c7 01             	add    $0x1,%edi
+  8023ca:	eb 9d                	jmp    802369 <devpipe_write+0x1c>
+
+008023cc <devpipe_read>:
+{
+  8023cc:	55                   	push   %ebp
+  8023cd:	89 e5                	mov    %esp,%ebp
+  8023cf:	57                   	push   %edi
+  8023d0:	56                   	push   %esi
+  8023d1:	53                   	push   %ebx
+  8023d2:	83 ec 18             	sub    $0x18,%esp
+  8023d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8023d8:	57                   	push   %edi
+  8023d9:	e8 0d f2 ff ff       	call   8015eb <fd2data>
+  8023de:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8023e0:	83 c4 10             	add    $0x10,%esp
+  8023e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8023e8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8023eb:	75 13                	jne    802400 <devpipe_read+0x34>
+	return i;
+  8023ed:	89 f0                	mov    %esi,%eax
+  8023ef:	eb 02                	jmp    8023f3 <devpipe_read+0x27>
+				return i;
+  8023f1:	89 f0                	mov    %esi,%eax
+}
+  8023f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023f6:	5b                   	pop    %ebx
+  8023f7:	5e                   	pop    %esi
+  8023f8:	5f                   	pop    %edi
+  8023f9:	5d                   	pop    %ebp
+  8023fa:	c3                   	ret
+			sys_yield();
+  8023fb:	e8 f8 e8 ff ff       	call   800cf8 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802400:	8b 03                	mov    (%ebx),%eax
+  802402:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802405:	75 18                	jne    80241f <devpipe_read+0x53>
+			if (i > 0)
+  802407:	85 f6                	test   %esi,%esi
+  802409:	75 e6                	jne    8023f1 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80240b:	89 da                	mov    %ebx,%edx
+  80240d:	89 f8                	mov    %edi,%eax
+  80240f:	e8 d4 fe ff ff       	call   8022e8 <_pipeisclosed>
+  802414:	85 c0                	test   %eax,%eax
+  802416:	74 e3                	je     8023fb <devpipe_read+0x2f>
+				return 0;
+  802418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241d:	eb d4                	jmp    8023f3 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80241f:	99                   	cltd
+  802420:	c1 ea 1b             	shr    $0x1b,%edx
+  802423:	01 d0                	add    %edx,%eax
+  802425:	83 e0 1f             	and    $0x1f,%eax
+  802428:	29 d0                	sub    %edx,%eax
+  80242a:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80242f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802432:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802435:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802438:	83 c6 01             	add    $0x1,%esi
+  80243b:	eb ab                	jmp    8023e8 <devpipe_read+0x1c>
+
+0080243d <pipe>:
+{
+  80243d:	55                   	push   %ebp
+  80243e:	89 e5                	mov    %esp,%ebp
+  802440:	56                   	push   %esi
+  802441:	53                   	push   %ebx
+  802442:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802445:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802448:	50                   	push   %eax
+  802449:	e8 b4 f1 ff ff       	call   801602 <fd_alloc>
+  80244e:	89 c3                	mov    %eax,%ebx
+  802450:	83 c4 10             	add    $0x10,%esp
+  802453:	85 c0                	test   %eax,%eax
+  802455:	0f 88 23 01 00 00    	js     80257e <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80245b:	83 ec 04             	sub    $0x4,%esp
+  80245e:	68 07 04 00 00       	push   $0x407
+  802463:	ff 75 f4             	push   -0xc(%ebp)
+  802466:	6a 00                	push   $0x0
+  802468:	e8 0b e9 ff ff       	call   800d78 <sys_page_alloc>
+  80246d:	89 c3                	mov    %eax,%ebx
+  80246f:	83 c4 10             	add    $0x10,%esp
+  802472:	85 c0                	test   %eax,%eax
+  802474:	0f 88 04 01 00 00    	js     80257e <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80247a:	83 ec 0c             	sub    $0xc,%esp
+  80247d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802480:	50                   	push   %eax
+  802481:	e8 7c f1 ff ff       	call   801602 <fd_alloc>
+  802486:	89 c3                	mov    %eax,%ebx
+  802488:	83 c4 10             	add    $0x10,%esp
+  80248b:	85 c0                	test   %eax,%eax
+  80248d:	0f 88 db 00 00 00    	js     80256e <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802493:	83 ec 04             	sub    $0x4,%esp
+  802496:	68 07 04 00 00       	push   $0x407
+  80249b:	ff 75 f0             	push   -0x10(%ebp)
+  80249e:	6a 00                	push   $0x0
+  8024a0:	e8 d3 e8 ff ff       	call   800d78 <sys_page_alloc>
+  8024a5:	89 c3                	mov    %eax,%ebx
+  8024a7:	83 c4 10             	add    $0x10,%esp
+  8024aa:	85 c0                	test   %eax,%eax
+  8024ac:	0f 88 bc 00 00 00    	js     80256e <pipe+0x131>
+	va = fd2data(fd0);
+  8024b2:	83 ec 0c             	sub    $0xc,%esp
+  8024b5:	ff 75 f4             	push   -0xc(%ebp)
+  8024b8:	e8 2e f1 ff ff       	call   8015eb <fd2data>
+  8024bd:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024bf:	83 c4 0c             	add    $0xc,%esp
+  8024c2:	68 07 04 00 00       	push   $0x407
+  8024c7:	50                   	push   %eax
+  8024c8:	6a 00                	push   $0x0
+  8024ca:	e8 a9 e8 ff ff       	call   800d78 <sys_page_alloc>
+  8024cf:	89 c3                	mov    %eax,%ebx
+  8024d1:	83 c4 10             	add    $0x10,%esp
+  8024d4:	85 c0                	test   %eax,%eax
+  8024d6:	0f 88 82 00 00 00    	js     80255e <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024dc:	83 ec 0c             	sub    $0xc,%esp
+  8024df:	ff 75 f0             	push   -0x10(%ebp)
+  8024e2:	e8 04 f1 ff ff       	call   8015eb <fd2data>
+  8024e7:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8024ee:	50                   	push   %eax
+  8024ef:	6a 00                	push   $0x0
+  8024f1:	56                   	push   %esi
+  8024f2:	6a 00                	push   $0x0
+  8024f4:	e8 05 e9 ff ff       	call   800dfe <sys_page_map>
+  8024f9:	89 c3                	mov    %eax,%ebx
+  8024fb:	83 c4 20             	add    $0x20,%esp
+  8024fe:	85 c0                	test   %eax,%eax
+  802500:	78 4e                	js     802550 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802502:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802507:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80250a:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80250c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80250f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802516:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802519:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80251b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80251e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802525:	83 ec 0c             	sub    $0xc,%esp
+  802528:	ff 75 f4             	push   -0xc(%ebp)
+  80252b:	e8 ab f0 ff ff       	call   8015db <fd2num>
+  802530:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802533:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802535:	83 c4 04             	add    $0x4,%esp
+  802538:	ff 75 f0             	push   -0x10(%ebp)
+  80253b:	e8 9b f0 ff ff       	call   8015db <fd2num>
+  802540:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802543:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802546:	83 c4 10             	add    $0x10,%esp
+  802549:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80254e:	eb 2e                	jmp    80257e <pipe+0x141>
+	sys_page_unmap(0, va);
+  802550:	83 ec 08             	sub    $0x8,%esp
+  802553:	56                   	push   %esi
+  802554:	6a 00                	push   $0x0
+  802556:	e8 e5 e8 ff ff       	call   800e40 <sys_page_unmap>
+  80255b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80255e:	83 ec 08             	sub    $0x8,%esp
+  802561:	ff 75 f0             	push   -0x10(%ebp)
+  802564:	6a 00                	push   $0x0
+  802566:	e8 d5 e8 ff ff       	call   800e40 <sys_page_unmap>
+  80256b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80256e:	83 ec 08             	sub    $0x8,%esp
+  802571:	ff 75 f4             	push   -0xc(%ebp)
+  802574:	6a 00                	push   $0x0
+  802576:	e8 c5 e8 ff ff       	call   800e40 <sys_page_unmap>
+  80257b:	83 c4 10             	add    $0x10,%esp
+}
+  80257e:	89 d8                	mov    %ebx,%eax
+  802580:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802583:	5b                   	pop    %ebx
+  802584:	5e                   	pop    %esi
+  802585:	5d                   	pop    %ebp
+  802586:	c3                   	ret
+
+00802587 <pipeisclosed>:
+{
+  802587:	55                   	push   %ebp
+  802588:	89 e5                	mov    %esp,%ebp
+  80258a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80258d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802590:	50                   	push   %eax
+  802591:	ff 75 08             	push   0x8(%ebp)
+  802594:	e8 bf f0 ff ff       	call   801658 <fd_lookup>
+  802599:	83 c4 10             	add    $0x10,%esp
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	78 18                	js     8025b8 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8025a0:	83 ec 0c             	sub    $0xc,%esp
+  8025a3:	ff 75 f4             	push   -0xc(%ebp)
+  8025a6:	e8 40 f0 ff ff       	call   8015eb <fd2data>
+  8025ab:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8025ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025b0:	e8 33 fd ff ff       	call   8022e8 <_pipeisclosed>
+  8025b5:	83 c4 10             	add    $0x10,%esp
+}
+  8025b8:	c9                   	leave
+  8025b9:	c3                   	ret
+
+008025ba <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8025ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025bf:	c3                   	ret
+
+008025c0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025c0:	55                   	push   %ebp
+  8025c1:	89 e5                	mov    %esp,%ebp
+  8025c3:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8025c6:	68 7b 32 80 00       	push   $0x80327b
+  8025cb:	ff 75 0c             	push   0xc(%ebp)
+  8025ce:	e8 38 e3 ff ff       	call   80090b <strcpy>
+	return 0;
+}
+  8025d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d8:	c9                   	leave
+  8025d9:	c3                   	ret
+
+008025da <devcons_write>:
+{
+  8025da:	55                   	push   %ebp
+  8025db:	89 e5                	mov    %esp,%ebp
+  8025dd:	57                   	push   %edi
+  8025de:	56                   	push   %esi
+  8025df:	53                   	push   %ebx
+  8025e0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8025e6:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8025eb:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8025f1:	eb 2e                	jmp    802621 <devcons_write+0x47>
+		m = n - tot;
+  8025f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025f6:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8025f8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8025fd:	39 c3                	cmp    %eax,%ebx
+  8025ff:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802602:	83 ec 04             	sub    $0x4,%esp
+  802605:	53                   	push   %ebx
+  802606:	89 f0                	mov    %esi,%eax
+  802608:	03 45 0c             	add    0xc(%ebp),%eax
+  80260b:	50                   	push   %eax
+  80260c:	57                   	push   %edi
+  80260d:	e8 7f e4 ff ff       	call   800a91 <memmove>
+		sys_cputs(buf, m);
+  802612:	83 c4 08             	add    $0x8,%esp
+  802615:	53                   	push   %ebx
+  802616:	57                   	push   %edi
+  802617:	e8 1f e6 ff ff       	call   800c3b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80261c:	01 de                	add    %ebx,%esi
+  80261e:	83 c4 10             	add    $0x10,%esp
+  802621:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802624:	72 cd                	jb     8025f3 <devcons_write+0x19>
+}
+  802626:	89 f0                	mov    %esi,%eax
+  802628:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80262b:	5b                   	pop    %ebx
+  80262c:	5e                   	pop    %esi
+  80262d:	5f                   	pop    %edi
+  80262e:	5d                   	pop    %ebp
+  80262f:	c3                   	ret
+
+00802630 <devcons_read>:
+{
+  802630:	55                   	push   %ebp
+  802631:	89 e5                	mov    %esp,%ebp
+  802633:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802636:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80263f:	75 07                	jne    802648 <devcons_read+0x18>
+  802641:	eb 1f                	jmp    802662 <devcons_read+0x32>
+		sys_yield();
+  802643:	e8 b0 e6 ff ff       	call   800cf8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802648:	e8 0c e6 ff ff       	call   800c59 <sys_cgetc>
+  80264d:	85 c0                	test   %eax,%eax
+  80264f:	74 f2                	je     802643 <devcons_read+0x13>
+	if (c < 0)
+  802651:	78 0f                	js     802662 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802653:	83 f8 04             	cmp    $0x4,%eax
+  802656:	74 0c                	je     802664 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802658:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80265b:	88 02                	mov    %al,(%edx)
+	return 1;
+  80265d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802662:	c9                   	leave
+  802663:	c3                   	ret
+		return 0;
+  802664:	b8 00 00 00 00       	mov    $0x0,%eax
+  802669:	eb f7                	jmp    802662 <devcons_read+0x32>
+
+0080266b <cputchar>:
+{
+  80266b:	55                   	push   %ebp
+  80266c:	89 e5                	mov    %esp,%ebp
+  80266e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802671:	8b 45 08             	mov    0x8(%ebp),%eax
+  802674:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802677:	6a 01                	push   $0x1
+  802679:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80267c:	50                   	push   %eax
+  80267d:	e8 b9 e5 ff ff       	call   800c3b <sys_cputs>
+}
+  802682:	83 c4 10             	add    $0x10,%esp
+  802685:	c9                   	leave
+  802686:	c3                   	ret
+
+00802687 <getchar>:
+{
+  802687:	55                   	push   %ebp
+  802688:	89 e5                	mov    %esp,%ebp
+  80268a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80268d:	6a 01                	push   $0x1
+  80268f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802692:	50                   	push   %eax
+  802693:	6a 00                	push   $0x0
+  802695:	e8 24 f2 ff ff       	call   8018be <read>
+	if (r < 0)
+  80269a:	83 c4 10             	add    $0x10,%esp
+  80269d:	85 c0                	test   %eax,%eax
+  80269f:	78 06                	js     8026a7 <getchar+0x20>
+	if (r < 1)
+  8026a1:	74 06                	je     8026a9 <getchar+0x22>
+	return c;
+  8026a3:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8026a7:	c9                   	leave
+  8026a8:	c3                   	ret
+		return -E_EOF;
+  8026a9:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8026ae:	eb f7                	jmp    8026a7 <getchar+0x20>
+
+008026b0 <iscons>:
+{
+  8026b0:	55                   	push   %ebp
+  8026b1:	89 e5                	mov    %esp,%ebp
+  8026b3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b9:	50                   	push   %eax
+  8026ba:	ff 75 08             	push   0x8(%ebp)
+  8026bd:	e8 96 ef ff ff       	call   801658 <fd_lookup>
+  8026c2:	83 c4 10             	add    $0x10,%esp
+  8026c5:	85 c0                	test   %eax,%eax
+  8026c7:	78 11                	js     8026da <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8026c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026cc:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8026d2:	39 10                	cmp    %edx,(%eax)
+  8026d4:	0f 94 c0             	sete   %al
+  8026d7:	0f b6 c0             	movzbl %al,%eax
+}
+  8026da:	c9                   	leave
+  8026db:	c3                   	ret
+
+008026dc <opencons>:
+{
+  8026dc:	55                   	push   %ebp
+  8026dd:	89 e5                	mov    %esp,%ebp
+  8026df:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8026e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026e5:	50                   	push   %eax
+  8026e6:	e8 17 ef ff ff       	call   801602 <fd_alloc>
+  8026eb:	83 c4 10             	add    $0x10,%esp
+  8026ee:	85 c0                	test   %eax,%eax
+  8026f0:	78 3a                	js     80272c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8026f2:	83 ec 04             	sub    $0x4,%esp
+  8026f5:	68 07 04 00 00       	push   $0x407
+  8026fa:	ff 75 f4             	push   -0xc(%ebp)
+  8026fd:	6a 00                	push   $0x0
+  8026ff:	e8 74 e6 ff ff       	call   800d78 <sys_page_alloc>
+  802704:	83 c4 10             	add    $0x10,%esp
+  802707:	85 c0                	test   %eax,%eax
+  802709:	78 21                	js     80272c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80270b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80270e:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802714:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802716:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802719:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802720:	83 ec 0c             	sub    $0xc,%esp
+  802723:	50                   	push   %eax
+  802724:	e8 b2 ee ff ff       	call   8015db <fd2num>
+  802729:	83 c4 10             	add    $0x10,%esp
+}
+  80272c:	c9                   	leave
+  80272d:	c3                   	ret
+
+0080272e <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80272e:	55                   	push   %ebp
+  80272f:	89 e5                	mov    %esp,%ebp
+  802731:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802734:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80273b:	74 0a                	je     802747 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80273d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802740:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  802745:	c9                   	leave
+  802746:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  802747:	83 ec 04             	sub    $0x4,%esp
+  80274a:	6a 07                	push   $0x7
+  80274c:	68 00 f0 bf ee       	push   $0xeebff000
+  802751:	6a 00                	push   $0x0
+  802753:	e8 20 e6 ff ff       	call   800d78 <sys_page_alloc>
+  802758:	83 c4 10             	add    $0x10,%esp
+  80275b:	85 c0                	test   %eax,%eax
+  80275d:	78 28                	js     802787 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  80275f:	83 ec 08             	sub    $0x8,%esp
+  802762:	68 99 27 80 00       	push   $0x802799
+  802767:	6a 00                	push   $0x0
+  802769:	e8 05 e9 ff ff       	call   801073 <sys_env_set_pgfault_upcall>
+  80276e:	83 c4 10             	add    $0x10,%esp
+  802771:	85 c0                	test   %eax,%eax
+  802773:	79 c8                	jns    80273d <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  802775:	50                   	push   %eax
+  802776:	68 95 32 80 00       	push   $0x803295
+  80277b:	6a 24                	push   $0x24
+  80277d:	68 87 32 80 00       	push   $0x803287
+  802782:	e8 bb da ff ff       	call   800242 <_panic>
+			panic("sys_page_alloc: %e", r);
+  802787:	50                   	push   %eax
+  802788:	68 66 30 80 00       	push   $0x803066
+  80278d:	6a 21                	push   $0x21
+  80278f:	68 87 32 80 00       	push   $0x803287
+  802794:	e8 a9 da ff ff       	call   800242 <_panic>
+
+00802799 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802799:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80279a:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  80279f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8027a1:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8027a4:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  8027a7:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  8027ab:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  8027ae:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  8027b2:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  8027b6:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  8027b8:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8027b9:	83 c4 04             	add    $0x4,%esp
+	popf
+  8027bc:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8027bd:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8027be:	c3                   	ret
+  8027bf:	90                   	nop
+
+008027c0 <__udivmoddi4>:
+  8027c0:	55                   	push   %ebp
+  8027c1:	57                   	push   %edi
+  8027c2:	56                   	push   %esi
+  8027c3:	53                   	push   %ebx
+  8027c4:	83 ec 14             	sub    $0x14,%esp
+  8027c7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8027cb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8027cf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027d3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027d7:	89 f1                	mov    %esi,%ecx
+  8027d9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8027dd:	09 d9                	or     %ebx,%ecx
+  8027df:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8027e3:	0f 84 92 00 00 00    	je     80287b <__udivmoddi4+0xbb>
+  8027e9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027f0:	00 
+  8027f1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8027f6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027fd:	00 
+  8027fe:	89 1c 24             	mov    %ebx,(%esp)
+  802801:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802805:	8d 76 00             	lea    0x0(%esi),%esi
+  802808:	89 e9                	mov    %ebp,%ecx
+  80280a:	89 c3                	mov    %eax,%ebx
+  80280c:	89 d6                	mov    %edx,%esi
+  80280e:	31 ff                	xor    %edi,%edi
+  802810:	d3 ee                	shr    %cl,%esi
+  802812:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802815:	f6 c1 20             	test   $0x20,%cl
+  802818:	0f 45 de             	cmovne %esi,%ebx
+  80281b:	0f 45 f7             	cmovne %edi,%esi
+  80281e:	8b 3c 24             	mov    (%esp),%edi
+  802821:	39 fb                	cmp    %edi,%ebx
+  802823:	89 f7                	mov    %esi,%edi
+  802825:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802829:	8b 1c 24             	mov    (%esp),%ebx
+  80282c:	19 f7                	sbb    %esi,%edi
+  80282e:	72 39                	jb     802869 <__udivmoddi4+0xa9>
+  802830:	89 e9                	mov    %ebp,%ecx
+  802832:	89 f7                	mov    %esi,%edi
+  802834:	89 de                	mov    %ebx,%esi
+  802836:	0f a5 df             	shld   %cl,%ebx,%edi
+  802839:	d3 e6                	shl    %cl,%esi
+  80283b:	31 db                	xor    %ebx,%ebx
+  80283d:	f6 c1 20             	test   $0x20,%cl
+  802840:	0f 45 fe             	cmovne %esi,%edi
+  802843:	0f 45 f3             	cmovne %ebx,%esi
+  802846:	29 f0                	sub    %esi,%eax
+  802848:	be 01 00 00 00       	mov    $0x1,%esi
+  80284d:	19 fa                	sbb    %edi,%edx
+  80284f:	31 ff                	xor    %edi,%edi
+  802851:	31 db                	xor    %ebx,%ebx
+  802853:	0f a5 f7             	shld   %cl,%esi,%edi
+  802856:	d3 e6                	shl    %cl,%esi
+  802858:	f6 c1 20             	test   $0x20,%cl
+  80285b:	0f 45 fe             	cmovne %esi,%edi
+  80285e:	0f 45 f3             	cmovne %ebx,%esi
+  802861:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802865:	09 74 24 08          	or     %esi,0x8(%esp)
+  802869:	83 ed 01             	sub    $0x1,%ebp
+  80286c:	73 9a                	jae    802808 <__udivmoddi4+0x48>
+  80286e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802872:	85 ff                	test   %edi,%edi
+  802874:	74 05                	je     80287b <__udivmoddi4+0xbb>
+  802876:	89 07                	mov    %eax,(%edi)
+  802878:	89 57 04             	mov    %edx,0x4(%edi)
+  80287b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80287f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802883:	83 c4 14             	add    $0x14,%esp
+  802886:	5b                   	pop    %ebx
+  802887:	5e                   	pop    %esi
+  802888:	5f                   	pop    %edi
+  802889:	5d                   	pop    %ebp
+  80288a:	c3                   	ret
+  80288b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80288f:	90                   	nop
+
+00802890 <__udivdi3>:
+  802890:	55                   	push   %ebp
+  802891:	57                   	push   %edi
+  802892:	56                   	push   %esi
+  802893:	53                   	push   %ebx
+  802894:	83 ec 14             	sub    $0x14,%esp
+  802897:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80289b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80289f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8028a3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8028a7:	89 fb                	mov    %edi,%ebx
+  8028a9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8028ad:	09 f3                	or     %esi,%ebx
+  8028af:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8028b3:	0f 84 85 00 00 00    	je     80293e <__udivdi3+0xae>
+  8028b9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8028c0:	00 
+  8028c1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8028c6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8028cd:	00 
+  8028ce:	89 34 24             	mov    %esi,(%esp)
+  8028d1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8028d5:	8d 76 00             	lea    0x0(%esi),%esi
+  8028d8:	89 e9                	mov    %ebp,%ecx
+  8028da:	89 c3                	mov    %eax,%ebx
+  8028dc:	89 d6                	mov    %edx,%esi
+  8028de:	31 ff                	xor    %edi,%edi
+  8028e0:	d3 ee                	shr    %cl,%esi
+  8028e2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8028e5:	f6 c1 20             	test   $0x20,%cl
+  8028e8:	0f 45 de             	cmovne %esi,%ebx
+  8028eb:	0f 45 f7             	cmovne %edi,%esi
+  8028ee:	8b 3c 24             	mov    (%esp),%edi
+  8028f1:	39 fb                	cmp    %edi,%ebx
+  8028f3:	89 f7                	mov    %esi,%edi
+  8028f5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8028f9:	8b 1c 24             	mov    (%esp),%ebx
+  8028fc:	19 f7                	sbb    %esi,%edi
+  8028fe:	72 39                	jb     802939 <__udivdi3+0xa9>
+  802900:	89 e9                	mov    %ebp,%ecx
+  802902:	89 f7                	mov    %esi,%edi
+  802904:	89 de                	mov    %ebx,%esi
+  802906:	0f a5 df             	shld   %cl,%ebx,%edi
+  802909:	d3 e6                	shl    %cl,%esi
+  80290b:	31 db                	xor    %ebx,%ebx
+  80290d:	f6 c1 20             	test   $0x20,%cl
+  802910:	0f 45 fe             	cmovne %esi,%edi
+  802913:	0f 45 f3             	cmovne %ebx,%esi
+  802916:	29 f0                	sub    %esi,%eax
+  802918:	be 01 00 00 00       	mov    $0x1,%esi
+  80291d:	19 fa                	sbb    %edi,%edx
+  80291f:	31 ff                	xor    %edi,%edi
+  802921:	31 db                	xor    %ebx,%ebx
+  802923:	0f a5 f7             	shld   %cl,%esi,%edi
+  802926:	d3 e6                	shl    %cl,%esi
+  802928:	f6 c1 20             	test   $0x20,%cl
+  80292b:	0f 45 fe             	cmovne %esi,%edi
+  80292e:	0f 45 f3             	cmovne %ebx,%esi
+  802931:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802935:	09 74 24 08          	or     %esi,0x8(%esp)
+  802939:	83 ed 01             	sub    $0x1,%ebp
+  80293c:	73 9a                	jae    8028d8 <__udivdi3+0x48>
+  80293e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802942:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802946:	83 c4 14             	add    $0x14,%esp
+  802949:	5b                   	pop    %ebx
+  80294a:	5e                   	pop    %esi
+  80294b:	5f                   	pop    %edi
+  80294c:	5d                   	pop    %ebp
+  80294d:	c3                   	ret
+  80294e:	66 90                	xchg   %ax,%ax
+
+00802950 <__umoddi3>:
+  802950:	57                   	push   %edi
+  802951:	56                   	push   %esi
+  802952:	53                   	push   %ebx
+  802953:	83 ec 08             	sub    $0x8,%esp
+  802956:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80295a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80295e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802962:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802966:	89 f9                	mov    %edi,%ecx
+  802968:	89 34 24             	mov    %esi,(%esp)
+  80296b:	09 f1                	or     %esi,%ecx
+  80296d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802971:	74 53                	je     8029c6 <__umoddi3+0x76>
+  802973:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80297f:	90                   	nop
+  802980:	89 c6                	mov    %eax,%esi
+  802982:	89 d7                	mov    %edx,%edi
+  802984:	31 db                	xor    %ebx,%ebx
+  802986:	d3 ef                	shr    %cl,%edi
+  802988:	0f ad d6             	shrd   %cl,%edx,%esi
+  80298b:	f6 c1 20             	test   $0x20,%cl
+  80298e:	0f 45 f7             	cmovne %edi,%esi
+  802991:	0f 45 fb             	cmovne %ebx,%edi
+  802994:	8b 1c 24             	mov    (%esp),%ebx
+  802997:	39 de                	cmp    %ebx,%esi
+  802999:	89 fb                	mov    %edi,%ebx
+  80299b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80299f:	8b 34 24             	mov    (%esp),%esi
+  8029a2:	19 fb                	sbb    %edi,%ebx
+  8029a4:	72 14                	jb     8029ba <__umoddi3+0x6a>
+  8029a6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8029a9:	31 db                	xor    %ebx,%ebx
+  8029ab:	d3 e6                	shl    %cl,%esi
+  8029ad:	f6 c1 20             	test   $0x20,%cl
+  8029b0:	0f 45 fe             	cmovne %esi,%edi
+  8029b3:	0f 45 f3             	cmovne %ebx,%esi
+  8029b6:	29 f0                	sub    %esi,%eax
+  8029b8:	19 fa                	sbb    %edi,%edx
+  8029ba:	83 e9 01             	sub    $0x1,%ecx
+  8029bd:	73 c1                	jae    802980 <__umoddi3+0x30>
+  8029bf:	83 c4 08             	add    $0x8,%esp
+  8029c2:	5b                   	pop    %ebx
+  8029c3:	5e                   	pop    %esi
+  8029c4:	5f                   	pop    %edi
+  8029c5:	c3                   	ret
+  8029c6:	83 c4 08             	add    $0x8,%esp
+  8029c9:	31 c0                	xor    %eax,%eax
+  8029cb:	31 d2                	xor    %edx,%edx
+  8029cd:	5b                   	pop    %ebx
+  8029ce:	5e                   	pop    %esi
+  8029cf:	5f                   	pop    %edi
+  8029d0:	c3                   	ret
+  8029d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029df:	90                   	nop
+
+008029e0 <__divdi3>:
+  8029e0:	55                   	push   %ebp
+  8029e1:	57                   	push   %edi
+  8029e2:	56                   	push   %esi
+  8029e3:	53                   	push   %ebx
+  8029e4:	83 ec 1c             	sub    $0x1c,%esp
+  8029e7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8029eb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8029ef:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8029f3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8029f7:	85 ff                	test   %edi,%edi
+  8029f9:	0f 88 da 00 00 00    	js     802ad9 <__divdi3+0xf9>
+  8029ff:	85 db                	test   %ebx,%ebx
+  802a01:	78 16                	js     802a19 <__divdi3+0x39>
+  802a03:	89 dd                	mov    %ebx,%ebp
+  802a05:	89 c8                	mov    %ecx,%eax
+  802a07:	89 da                	mov    %ebx,%edx
+  802a09:	09 cd                	or     %ecx,%ebp
+  802a0b:	0f 85 fd 00 00 00    	jne    802b0e <__divdi3+0x12e>
+  802a11:	83 c4 1c             	add    $0x1c,%esp
+  802a14:	5b                   	pop    %ebx
+  802a15:	5e                   	pop    %esi
+  802a16:	5f                   	pop    %edi
+  802a17:	5d                   	pop    %ebp
+  802a18:	c3                   	ret
+  802a19:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802a1e:	f7 d9                	neg    %ecx
+  802a20:	89 f0                	mov    %esi,%eax
+  802a22:	89 fa                	mov    %edi,%edx
+  802a24:	83 d3 00             	adc    $0x0,%ebx
+  802a27:	89 0c 24             	mov    %ecx,(%esp)
+  802a2a:	f7 db                	neg    %ebx
+  802a2c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a30:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802a37:	00 
+  802a38:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a3d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802a44:	00 
+  802a45:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a49:	89 cd                	mov    %ecx,%ebp
+  802a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802a4f:	90                   	nop
+  802a50:	89 e9                	mov    %ebp,%ecx
+  802a52:	89 c3                	mov    %eax,%ebx
+  802a54:	89 d6                	mov    %edx,%esi
+  802a56:	31 ff                	xor    %edi,%edi
+  802a58:	d3 ee                	shr    %cl,%esi
+  802a5a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a5d:	f6 c1 20             	test   $0x20,%cl
+  802a60:	0f 45 de             	cmovne %esi,%ebx
+  802a63:	0f 45 f7             	cmovne %edi,%esi
+  802a66:	8b 3c 24             	mov    (%esp),%edi
+  802a69:	39 fb                	cmp    %edi,%ebx
+  802a6b:	89 f7                	mov    %esi,%edi
+  802a6d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802a71:	8b 1c 24             	mov    (%esp),%ebx
+  802a74:	19 f7                	sbb    %esi,%edi
+  802a76:	72 39                	jb     802ab1 <__divdi3+0xd1>
+  802a78:	89 e9                	mov    %ebp,%ecx
+  802a7a:	89 f7                	mov    %esi,%edi
+  802a7c:	89 de                	mov    %ebx,%esi
+  802a7e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802a81:	d3 e6                	shl    %cl,%esi
+  802a83:	31 db                	xor    %ebx,%ebx
+  802a85:	f6 c1 20             	test   $0x20,%cl
+  802a88:	0f 45 fe             	cmovne %esi,%edi
+  802a8b:	0f 45 f3             	cmovne %ebx,%esi
+  802a8e:	29 f0                	sub    %esi,%eax
+  802a90:	be 01 00 00 00       	mov    $0x1,%esi
+  802a95:	19 fa                	sbb    %edi,%edx
+  802a97:	31 ff                	xor    %edi,%edi
+  802a99:	31 db                	xor    %ebx,%ebx
+  802a9b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802a9e:	d3 e6                	shl    %cl,%esi
+  802aa0:	f6 c1 20             	test   $0x20,%cl
+  802aa3:	0f 45 fe             	cmovne %esi,%edi
+  802aa6:	0f 45 f3             	cmovne %ebx,%esi
+  802aa9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802aad:	09 74 24 08          	or     %esi,0x8(%esp)
+  802ab1:	83 ed 01             	sub    $0x1,%ebp
+  802ab4:	73 9a                	jae    802a50 <__divdi3+0x70>
+  802ab6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802aba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802abe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ac2:	85 ed                	test   %ebp,%ebp
+  802ac4:	0f 84 47 ff ff ff    	je     802a11 <__divdi3+0x31>
+  802aca:	f7 d8                	neg    %eax
+  802acc:	83 d2 00             	adc    $0x0,%edx
+  802acf:	83 c4 1c             	add    $0x1c,%esp
+  802ad2:	5b                   	pop    %ebx
+  802ad3:	f7 da                	neg    %edx
+  802ad5:	5e                   	pop    %esi
+  802ad6:	5f                   	pop    %edi
+  802ad7:	5d                   	pop    %ebp
+  802ad8:	c3                   	ret
+  802ad9:	f7 de                	neg    %esi
+  802adb:	83 d7 00             	adc    $0x0,%edi
+  802ade:	f7 df                	neg    %edi
+  802ae0:	85 db                	test   %ebx,%ebx
+  802ae2:	78 23                	js     802b07 <__divdi3+0x127>
+  802ae4:	89 dd                	mov    %ebx,%ebp
+  802ae6:	89 c8                	mov    %ecx,%eax
+  802ae8:	89 da                	mov    %ebx,%edx
+  802aea:	09 cd                	or     %ecx,%ebp
+  802aec:	0f 84 1f ff ff ff    	je     802a11 <__divdi3+0x31>
+  802af2:	89 0c 24             	mov    %ecx,(%esp)
+  802af5:	89 f0                	mov    %esi,%eax
+  802af7:	89 fa                	mov    %edi,%edx
+  802af9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802afe:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802b02:	e9 29 ff ff ff       	jmp    802a30 <__divdi3+0x50>
+  802b07:	31 ed                	xor    %ebp,%ebp
+  802b09:	e9 10 ff ff ff       	jmp    802a1e <__divdi3+0x3e>
+  802b0e:	89 0c 24             	mov    %ecx,(%esp)
+  802b11:	89 f0                	mov    %esi,%eax
+  802b13:	89 fa                	mov    %edi,%edx
+  802b15:	31 ed                	xor    %ebp,%ebp
+  802b17:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802b1b:	e9 10 ff ff ff       	jmp    802a30 <__divdi3+0x50>
+
+00802b20 <__moddi3>:
+  802b20:	55                   	push   %ebp
+  802b21:	57                   	push   %edi
+  802b22:	56                   	push   %esi
+  802b23:	53                   	push   %ebx
+  802b24:	83 ec 14             	sub    $0x14,%esp
+  802b27:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802b2b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802b2f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802b33:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802b37:	85 d2                	test   %edx,%edx
+  802b39:	0f 88 9b 00 00 00    	js     802bda <__moddi3+0xba>
+  802b3f:	89 f7                	mov    %esi,%edi
+  802b41:	31 ed                	xor    %ebp,%ebp
+  802b43:	09 cf                	or     %ecx,%edi
+  802b45:	0f 84 83 00 00 00    	je     802bce <__moddi3+0xae>
+  802b4b:	89 cb                	mov    %ecx,%ebx
+  802b4d:	89 f7                	mov    %esi,%edi
+  802b4f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802b53:	f7 db                	neg    %ebx
+  802b55:	83 d7 00             	adc    $0x0,%edi
+  802b58:	f7 df                	neg    %edi
+  802b5a:	0f 49 f7             	cmovns %edi,%esi
+  802b5d:	0f 49 cb             	cmovns %ebx,%ecx
+  802b60:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802b64:	89 0c 24             	mov    %ecx,(%esp)
+  802b67:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802b6c:	89 cd                	mov    %ecx,%ebp
+  802b6e:	66 90                	xchg   %ax,%ax
+  802b70:	89 e9                	mov    %ebp,%ecx
+  802b72:	89 c3                	mov    %eax,%ebx
+  802b74:	89 d6                	mov    %edx,%esi
+  802b76:	31 ff                	xor    %edi,%edi
+  802b78:	d3 ee                	shr    %cl,%esi
+  802b7a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802b7d:	f6 c1 20             	test   $0x20,%cl
+  802b80:	0f 45 de             	cmovne %esi,%ebx
+  802b83:	0f 45 f7             	cmovne %edi,%esi
+  802b86:	8b 3c 24             	mov    (%esp),%edi
+  802b89:	39 fb                	cmp    %edi,%ebx
+  802b8b:	89 f7                	mov    %esi,%edi
+  802b8d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802b91:	8b 1c 24             	mov    (%esp),%ebx
+  802b94:	19 f7                	sbb    %esi,%edi
+  802b96:	72 1a                	jb     802bb2 <__moddi3+0x92>
+  802b98:	89 e9                	mov    %ebp,%ecx
+  802b9a:	89 f7                	mov    %esi,%edi
+  802b9c:	89 de                	mov    %ebx,%esi
+  802b9e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ba1:	d3 e6                	shl    %cl,%esi
+  802ba3:	31 db                	xor    %ebx,%ebx
+  802ba5:	f6 c1 20             	test   $0x20,%cl
+  802ba8:	0f 45 fe             	cmovne %esi,%edi
+  802bab:	0f 45 f3             	cmovne %ebx,%esi
+  802bae:	29 f0                	sub    %esi,%eax
+  802bb0:	19 fa                	sbb    %edi,%edx
+  802bb2:	83 ed 01             	sub    $0x1,%ebp
+  802bb5:	73 b9                	jae    802b70 <__moddi3+0x50>
+  802bb7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802bbb:	85 ed                	test   %ebp,%ebp
+  802bbd:	74 07                	je     802bc6 <__moddi3+0xa6>
+  802bbf:	f7 d8                	neg    %eax
+  802bc1:	83 d2 00             	adc    $0x0,%edx
+  802bc4:	f7 da                	neg    %edx
+  802bc6:	83 c4 14             	add    $0x14,%esp
+  802bc9:	5b                   	pop    %ebx
+  802bca:	5e                   	pop    %esi
+  802bcb:	5f                   	pop    %edi
+  802bcc:	5d                   	pop    %ebp
+  802bcd:	c3                   	ret
+  802bce:	83 c4 14             	add    $0x14,%esp
+  802bd1:	31 c0                	xor    %eax,%eax
+  802bd3:	31 d2                	xor    %edx,%edx
+  802bd5:	5b                   	pop    %ebx
+  802bd6:	5e                   	pop    %esi
+  802bd7:	5f                   	pop    %edi
+  802bd8:	5d                   	pop    %ebp
+  802bd9:	c3                   	ret
+  802bda:	89 f7                	mov    %esi,%edi
+  802bdc:	09 cf                	or     %ecx,%edi
+  802bde:	74 11                	je     802bf1 <__moddi3+0xd1>
+  802be0:	f7 d8                	neg    %eax
+  802be2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802be7:	83 d2 00             	adc    $0x0,%edx
+  802bea:	f7 da                	neg    %edx
+  802bec:	e9 5a ff ff ff       	jmp    802b4b <__moddi3+0x2b>
+  802bf1:	31 c0                	xor    %eax,%eax
+  802bf3:	31 d2                	xor    %edx,%edx
+  802bf5:	eb c8                	jmp    802bbf <__moddi3+0x9f>
@@ -0,0 +1,6224 @@
+
+obj/user/testpiperace2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9f 01 00 00       	call   8001d0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 28             	sub    $0x28,%esp
+	int p[2], r, i;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for pipeisclosed race...\n");
+  80003c:	68 00 2c 80 00       	push   $0x802c00
+  800041:	e8 c5 02 00 00       	call   80030b <cprintf>
+	if ((r = pipe(p)) < 0)
+  800046:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800049:	89 04 24             	mov    %eax,(%esp)
+  80004c:	e8 bc 22 00 00       	call   80230d <pipe>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	85 c0                	test   %eax,%eax
+  800056:	78 5b                	js     8000b3 <umain+0x80>
+		panic("pipe: %e", r);
+	if ((r = fork()) < 0)
+  800058:	e8 09 12 00 00       	call   801266 <fork>
+  80005d:	89 c7                	mov    %eax,%edi
+  80005f:	85 c0                	test   %eax,%eax
+  800061:	78 62                	js     8000c5 <umain+0x92>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800063:	74 72                	je     8000d7 <umain+0xa4>
+	// pageref(p[0]) and gets 3, then it will return true when
+	// it shouldn't.
+	//
+	// So either way, pipeisclosed is going give a wrong answer.
+	//
+	kid = &envs[ENVX(r)];
+  800065:	89 fb                	mov    %edi,%ebx
+  800067:	81 e3 ff 1f 00 00    	and    $0x1fff,%ebx
+	while (kid->env_status == ENV_RUNNABLE)
+  80006d:	c1 e3 09             	shl    $0x9,%ebx
+  800070:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  800076:	8b 43 58             	mov    0x58(%ebx),%eax
+  800079:	83 f8 02             	cmp    $0x2,%eax
+  80007c:	0f 85 d1 00 00 00    	jne    800153 <umain+0x120>
+		if (pipeisclosed(p[0]) != 0) {
+  800082:	83 ec 0c             	sub    $0xc,%esp
+  800085:	ff 75 e0             	push   -0x20(%ebp)
+  800088:	e8 ca 23 00 00       	call   802457 <pipeisclosed>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	74 e2                	je     800076 <umain+0x43>
+			cprintf("\nRACE: pipe appears closed\n");
+  800094:	83 ec 0c             	sub    $0xc,%esp
+  800097:	68 70 2c 80 00       	push   $0x802c70
+  80009c:	e8 6a 02 00 00       	call   80030b <cprintf>
+			sys_env_destroy(r);
+  8000a1:	89 3c 24             	mov    %edi,(%esp)
+  8000a4:	e8 dd 0b 00 00       	call   800c86 <sys_env_destroy>
+			exit();
+  8000a9:	e8 68 01 00 00       	call   800216 <exit>
+  8000ae:	83 c4 10             	add    $0x10,%esp
+  8000b1:	eb c3                	jmp    800076 <umain+0x43>
+		panic("pipe: %e", r);
+  8000b3:	50                   	push   %eax
+  8000b4:	68 4e 2c 80 00       	push   $0x802c4e
+  8000b9:	6a 0d                	push   $0xd
+  8000bb:	68 57 2c 80 00       	push   $0x802c57
+  8000c0:	e8 6b 01 00 00       	call   800230 <_panic>
+		panic("fork: %e", r);
+  8000c5:	50                   	push   %eax
+  8000c6:	68 84 30 80 00       	push   $0x803084
+  8000cb:	6a 0f                	push   $0xf
+  8000cd:	68 57 2c 80 00       	push   $0x802c57
+  8000d2:	e8 59 01 00 00       	call   800230 <_panic>
+		close(p[1]);
+  8000d7:	83 ec 0c             	sub    $0xc,%esp
+  8000da:	ff 75 e4             	push   -0x1c(%ebp)
+  8000dd:	e8 b2 15 00 00       	call   801694 <close>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 200; i++) {
+  8000e5:	89 fb                	mov    %edi,%ebx
+			if (i % 10 == 0)
+  8000e7:	be 67 66 66 66       	mov    $0x66666667,%esi
+  8000ec:	eb 31                	jmp    80011f <umain+0xec>
+			dup(p[0], 10);
+  8000ee:	83 ec 08             	sub    $0x8,%esp
+  8000f1:	6a 0a                	push   $0xa
+  8000f3:	ff 75 e0             	push   -0x20(%ebp)
+  8000f6:	e8 eb 15 00 00       	call   8016e6 <dup>
+			sys_yield();
+  8000fb:	e8 e6 0b 00 00       	call   800ce6 <sys_yield>
+			close(10);
+  800100:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+  800107:	e8 88 15 00 00       	call   801694 <close>
+			sys_yield();
+  80010c:	e8 d5 0b 00 00       	call   800ce6 <sys_yield>
+		for (i = 0; i < 200; i++) {
+  800111:	83 c3 01             	add    $0x1,%ebx
+  800114:	83 c4 10             	add    $0x10,%esp
+  800117:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  80011d:	74 2a                	je     800149 <umain+0x116>
+			if (i % 10 == 0)
+  80011f:	89 d8                	mov    %ebx,%eax
+  800121:	f7 ee                	imul   %esi
+  800123:	c1 fa 02             	sar    $0x2,%edx
+  800126:	89 d8                	mov    %ebx,%eax
+  800128:	c1 f8 1f             	sar    $0x1f,%eax
+  80012b:	29 c2                	sub    %eax,%edx
+  80012d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800130:	01 c0                	add    %eax,%eax
+  800132:	39 c3                	cmp    %eax,%ebx
+  800134:	75 b8                	jne    8000ee <umain+0xbb>
+				cprintf("%d.", i);
+  800136:	83 ec 08             	sub    $0x8,%esp
+  800139:	53                   	push   %ebx
+  80013a:	68 6c 2c 80 00       	push   $0x802c6c
+  80013f:	e8 c7 01 00 00       	call   80030b <cprintf>
+  800144:	83 c4 10             	add    $0x10,%esp
+  800147:	eb a5                	jmp    8000ee <umain+0xbb>
+		exit();
+  800149:	e8 c8 00 00 00       	call   800216 <exit>
+  80014e:	e9 12 ff ff ff       	jmp    800065 <umain+0x32>
+		}
+	cprintf("child done with loop\n");
+  800153:	83 ec 0c             	sub    $0xc,%esp
+  800156:	68 8c 2c 80 00       	push   $0x802c8c
+  80015b:	e8 ab 01 00 00       	call   80030b <cprintf>
+	if (pipeisclosed(p[0]))
+  800160:	83 c4 04             	add    $0x4,%esp
+  800163:	ff 75 e0             	push   -0x20(%ebp)
+  800166:	e8 ec 22 00 00       	call   802457 <pipeisclosed>
+  80016b:	83 c4 10             	add    $0x10,%esp
+  80016e:	85 c0                	test   %eax,%eax
+  800170:	75 38                	jne    8001aa <umain+0x177>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  800172:	83 ec 08             	sub    $0x8,%esp
+  800175:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800178:	50                   	push   %eax
+  800179:	ff 75 e0             	push   -0x20(%ebp)
+  80017c:	e8 e9 13 00 00       	call   80156a <fd_lookup>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	85 c0                	test   %eax,%eax
+  800186:	78 36                	js     8001be <umain+0x18b>
+		panic("cannot look up p[0]: %e", r);
+	(void) fd2data(fd);
+  800188:	83 ec 0c             	sub    $0xc,%esp
+  80018b:	ff 75 dc             	push   -0x24(%ebp)
+  80018e:	e8 6a 13 00 00       	call   8014fd <fd2data>
+	cprintf("race didn't happen\n");
+  800193:	c7 04 24 ba 2c 80 00 	movl   $0x802cba,(%esp)
+  80019a:	e8 6c 01 00 00       	call   80030b <cprintf>
+}
+  80019f:	83 c4 10             	add    $0x10,%esp
+  8001a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a5:	5b                   	pop    %ebx
+  8001a6:	5e                   	pop    %esi
+  8001a7:	5f                   	pop    %edi
+  8001a8:	5d                   	pop    %ebp
+  8001a9:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001aa:	83 ec 04             	sub    $0x4,%esp
+  8001ad:	68 24 2c 80 00       	push   $0x802c24
+  8001b2:	6a 40                	push   $0x40
+  8001b4:	68 57 2c 80 00       	push   $0x802c57
+  8001b9:	e8 72 00 00 00       	call   800230 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001be:	50                   	push   %eax
+  8001bf:	68 a2 2c 80 00       	push   $0x802ca2
+  8001c4:	6a 42                	push   $0x42
+  8001c6:	68 57 2c 80 00       	push   $0x802c57
+  8001cb:	e8 60 00 00 00       	call   800230 <_panic>
+
+008001d0 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001d0:	55                   	push   %ebp
+  8001d1:	89 e5                	mov    %esp,%ebp
+  8001d3:	56                   	push   %esi
+  8001d4:	53                   	push   %ebx
+  8001d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001db:	e8 e7 0a 00 00       	call   800cc7 <sys_getenvid>
+  8001e0:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8001e5:	c1 e0 09             	shl    $0x9,%eax
+  8001e8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ed:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001f2:	85 db                	test   %ebx,%ebx
+  8001f4:	7e 07                	jle    8001fd <libmain+0x2d>
+		binaryname = argv[0];
+  8001f6:	8b 06                	mov    (%esi),%eax
+  8001f8:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001fd:	83 ec 08             	sub    $0x8,%esp
+  800200:	56                   	push   %esi
+  800201:	53                   	push   %ebx
+  800202:	e8 2c fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800207:	e8 0a 00 00 00       	call   800216 <exit>
+}
+  80020c:	83 c4 10             	add    $0x10,%esp
+  80020f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800212:	5b                   	pop    %ebx
+  800213:	5e                   	pop    %esi
+  800214:	5d                   	pop    %ebp
+  800215:	c3                   	ret
+
+00800216 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800216:	55                   	push   %ebp
+  800217:	89 e5                	mov    %esp,%ebp
+  800219:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80021c:	e8 a0 14 00 00       	call   8016c1 <close_all>
+	sys_env_destroy(0);
+  800221:	83 ec 0c             	sub    $0xc,%esp
+  800224:	6a 00                	push   $0x0
+  800226:	e8 5b 0a 00 00       	call   800c86 <sys_env_destroy>
+}
+  80022b:	83 c4 10             	add    $0x10,%esp
+  80022e:	c9                   	leave
+  80022f:	c3                   	ret
+
+00800230 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800230:	55                   	push   %ebp
+  800231:	89 e5                	mov    %esp,%ebp
+  800233:	56                   	push   %esi
+  800234:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800235:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800238:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80023e:	e8 84 0a 00 00       	call   800cc7 <sys_getenvid>
+  800243:	83 ec 0c             	sub    $0xc,%esp
+  800246:	ff 75 0c             	push   0xc(%ebp)
+  800249:	ff 75 08             	push   0x8(%ebp)
+  80024c:	56                   	push   %esi
+  80024d:	50                   	push   %eax
+  80024e:	68 d8 2c 80 00       	push   $0x802cd8
+  800253:	e8 b3 00 00 00       	call   80030b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800258:	83 c4 18             	add    $0x18,%esp
+  80025b:	53                   	push   %ebx
+  80025c:	ff 75 10             	push   0x10(%ebp)
+  80025f:	e8 56 00 00 00       	call   8002ba <vcprintf>
+	cprintf("\n");
+  800264:	c7 04 24 34 32 80 00 	movl   $0x803234,(%esp)
+  80026b:	e8 9b 00 00 00       	call   80030b <cprintf>
+  800270:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800273:	cc                   	int3
+	while (1)
+  800274:	eb fd                	jmp    800273 <_panic+0x43>
+
+00800276 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800276:	55                   	push   %ebp
+  800277:	89 e5                	mov    %esp,%ebp
+  800279:	53                   	push   %ebx
+  80027a:	83 ec 04             	sub    $0x4,%esp
+  80027d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800280:	8b 13                	mov    (%ebx),%edx
+  800282:	8d 42 01             	lea    0x1(%edx),%eax
+  800285:	89 03                	mov    %eax,(%ebx)
+  800287:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80028a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80028e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800293:	74 09                	je     80029e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800295:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800299:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80029c:	c9                   	leave
+  80029d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80029e:	83 ec 08             	sub    $0x8,%esp
+  8002a1:	68 ff 00 00 00       	push   $0xff
+  8002a6:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a9:	50                   	push   %eax
+  8002aa:	e8 7a 09 00 00       	call   800c29 <sys_cputs>
+		b->idx = 0;
+  8002af:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b5:	83 c4 10             	add    $0x10,%esp
+  8002b8:	eb db                	jmp    800295 <putch+0x1f>
+
+008002ba <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002ba:	55                   	push   %ebp
+  8002bb:	89 e5                	mov    %esp,%ebp
+  8002bd:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002ca:	00 00 00 
+	b.cnt = 0;
+  8002cd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d7:	ff 75 0c             	push   0xc(%ebp)
+  8002da:	ff 75 08             	push   0x8(%ebp)
+  8002dd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e3:	50                   	push   %eax
+  8002e4:	68 76 02 80 00       	push   $0x800276
+  8002e9:	e8 14 01 00 00       	call   800402 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002ee:	83 c4 08             	add    $0x8,%esp
+  8002f1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002fd:	50                   	push   %eax
+  8002fe:	e8 26 09 00 00       	call   800c29 <sys_cputs>
+
+	return b.cnt;
+}
+  800303:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+
+0080030b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80030b:	55                   	push   %ebp
+  80030c:	89 e5                	mov    %esp,%ebp
+  80030e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800311:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800314:	50                   	push   %eax
+  800315:	ff 75 08             	push   0x8(%ebp)
+  800318:	e8 9d ff ff ff       	call   8002ba <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80031d:	c9                   	leave
+  80031e:	c3                   	ret
+
+0080031f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80031f:	55                   	push   %ebp
+  800320:	89 e5                	mov    %esp,%ebp
+  800322:	57                   	push   %edi
+  800323:	56                   	push   %esi
+  800324:	53                   	push   %ebx
+  800325:	83 ec 1c             	sub    $0x1c,%esp
+  800328:	89 c7                	mov    %eax,%edi
+  80032a:	89 d6                	mov    %edx,%esi
+  80032c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800332:	89 d1                	mov    %edx,%ecx
+  800334:	89 c2                	mov    %eax,%edx
+  800336:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800339:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80033c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80033f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800342:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800345:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80034c:	39 c2                	cmp    %eax,%edx
+  80034e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800351:	72 3e                	jb     800391 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800353:	83 ec 0c             	sub    $0xc,%esp
+  800356:	ff 75 18             	push   0x18(%ebp)
+  800359:	83 eb 01             	sub    $0x1,%ebx
+  80035c:	53                   	push   %ebx
+  80035d:	50                   	push   %eax
+  80035e:	83 ec 08             	sub    $0x8,%esp
+  800361:	ff 75 e4             	push   -0x1c(%ebp)
+  800364:	ff 75 e0             	push   -0x20(%ebp)
+  800367:	ff 75 dc             	push   -0x24(%ebp)
+  80036a:	ff 75 d8             	push   -0x28(%ebp)
+  80036d:	e8 0e 25 00 00       	call   802880 <__udivdi3>
+  800372:	83 c4 18             	add    $0x18,%esp
+  800375:	52                   	push   %edx
+  800376:	50                   	push   %eax
+  800377:	89 f2                	mov    %esi,%edx
+  800379:	89 f8                	mov    %edi,%eax
+  80037b:	e8 9f ff ff ff       	call   80031f <printnum>
+  800380:	83 c4 20             	add    $0x20,%esp
+  800383:	eb 13                	jmp    800398 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800385:	83 ec 08             	sub    $0x8,%esp
+  800388:	56                   	push   %esi
+  800389:	ff 75 18             	push   0x18(%ebp)
+  80038c:	ff d7                	call   *%edi
+  80038e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800391:	83 eb 01             	sub    $0x1,%ebx
+  800394:	85 db                	test   %ebx,%ebx
+  800396:	7f ed                	jg     800385 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800398:	83 ec 08             	sub    $0x8,%esp
+  80039b:	56                   	push   %esi
+  80039c:	83 ec 04             	sub    $0x4,%esp
+  80039f:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a2:	ff 75 e0             	push   -0x20(%ebp)
+  8003a5:	ff 75 dc             	push   -0x24(%ebp)
+  8003a8:	ff 75 d8             	push   -0x28(%ebp)
+  8003ab:	e8 90 25 00 00       	call   802940 <__umoddi3>
+  8003b0:	83 c4 14             	add    $0x14,%esp
+  8003b3:	0f be 80 fb 2c 80 00 	movsbl 0x802cfb(%eax),%eax
+  8003ba:	50                   	push   %eax
+  8003bb:	ff d7                	call   *%edi
+}
+  8003bd:	83 c4 10             	add    $0x10,%esp
+  8003c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c3:	5b                   	pop    %ebx
+  8003c4:	5e                   	pop    %esi
+  8003c5:	5f                   	pop    %edi
+  8003c6:	5d                   	pop    %ebp
+  8003c7:	c3                   	ret
+
+008003c8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c8:	55                   	push   %ebp
+  8003c9:	89 e5                	mov    %esp,%ebp
+  8003cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003ce:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003d2:	8b 10                	mov    (%eax),%edx
+  8003d4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d7:	73 0a                	jae    8003e3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003dc:	89 08                	mov    %ecx,(%eax)
+  8003de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e1:	88 02                	mov    %al,(%edx)
+}
+  8003e3:	5d                   	pop    %ebp
+  8003e4:	c3                   	ret
+
+008003e5 <printfmt>:
+{
+  8003e5:	55                   	push   %ebp
+  8003e6:	89 e5                	mov    %esp,%ebp
+  8003e8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003eb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003ee:	50                   	push   %eax
+  8003ef:	ff 75 10             	push   0x10(%ebp)
+  8003f2:	ff 75 0c             	push   0xc(%ebp)
+  8003f5:	ff 75 08             	push   0x8(%ebp)
+  8003f8:	e8 05 00 00 00       	call   800402 <vprintfmt>
+}
+  8003fd:	83 c4 10             	add    $0x10,%esp
+  800400:	c9                   	leave
+  800401:	c3                   	ret
+
+00800402 <vprintfmt>:
+{
+  800402:	55                   	push   %ebp
+  800403:	89 e5                	mov    %esp,%ebp
+  800405:	57                   	push   %edi
+  800406:	56                   	push   %esi
+  800407:	53                   	push   %ebx
+  800408:	83 ec 2c             	sub    $0x2c,%esp
+  80040b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80040e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800411:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800414:	eb 0a                	jmp    800420 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800416:	83 ec 08             	sub    $0x8,%esp
+  800419:	53                   	push   %ebx
+  80041a:	50                   	push   %eax
+  80041b:	ff d6                	call   *%esi
+  80041d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800420:	83 c7 01             	add    $0x1,%edi
+  800423:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800427:	83 f8 25             	cmp    $0x25,%eax
+  80042a:	74 0c                	je     800438 <vprintfmt+0x36>
+			if (ch == '\0')
+  80042c:	85 c0                	test   %eax,%eax
+  80042e:	75 e6                	jne    800416 <vprintfmt+0x14>
+}
+  800430:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800433:	5b                   	pop    %ebx
+  800434:	5e                   	pop    %esi
+  800435:	5f                   	pop    %edi
+  800436:	5d                   	pop    %ebp
+  800437:	c3                   	ret
+		padc = ' ';
+  800438:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80043c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800443:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80044a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800451:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800456:	8d 47 01             	lea    0x1(%edi),%eax
+  800459:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80045c:	0f b6 17             	movzbl (%edi),%edx
+  80045f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800462:	3c 55                	cmp    $0x55,%al
+  800464:	0f 87 cf 03 00 00    	ja     800839 <vprintfmt+0x437>
+  80046a:	0f b6 c0             	movzbl %al,%eax
+  80046d:	ff 24 85 40 2e 80 00 	jmp    *0x802e40(,%eax,4)
+  800474:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800477:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80047b:	eb d9                	jmp    800456 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800480:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800484:	eb d0                	jmp    800456 <vprintfmt+0x54>
+  800486:	0f b6 d2             	movzbl %dl,%edx
+  800489:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80048c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800491:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800494:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800497:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80049b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80049e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004a1:	83 f9 09             	cmp    $0x9,%ecx
+  8004a4:	77 55                	ja     8004fb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004a6:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004a9:	eb e9                	jmp    800494 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ae:	8b 00                	mov    (%eax),%eax
+  8004b0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004bf:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c3:	79 91                	jns    800456 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004c5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004cb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004d2:	eb 82                	jmp    800456 <vprintfmt+0x54>
+			if (width < 0)
+  8004d4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d7:	85 d2                	test   %edx,%edx
+  8004d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004de:	0f 49 c2             	cmovns %edx,%eax
+  8004e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e7:	e9 6a ff ff ff       	jmp    800456 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004ef:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f6:	e9 5b ff ff ff       	jmp    800456 <vprintfmt+0x54>
+  8004fb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004fe:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800501:	eb bc                	jmp    8004bf <vprintfmt+0xbd>
+			lflag++;
+  800503:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800506:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800509:	e9 48 ff ff ff       	jmp    800456 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80050e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800511:	8d 78 04             	lea    0x4(%eax),%edi
+  800514:	83 ec 08             	sub    $0x8,%esp
+  800517:	53                   	push   %ebx
+  800518:	ff 30                	push   (%eax)
+  80051a:	ff d6                	call   *%esi
+			break;
+  80051c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80051f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800522:	e9 b1 02 00 00       	jmp    8007d8 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800527:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80052d:	8b 10                	mov    (%eax),%edx
+  80052f:	89 d0                	mov    %edx,%eax
+  800531:	f7 d8                	neg    %eax
+  800533:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800536:	83 f8 0f             	cmp    $0xf,%eax
+  800539:	7f 23                	jg     80055e <vprintfmt+0x15c>
+  80053b:	8b 14 85 a0 2f 80 00 	mov    0x802fa0(,%eax,4),%edx
+  800542:	85 d2                	test   %edx,%edx
+  800544:	74 18                	je     80055e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800546:	52                   	push   %edx
+  800547:	68 c9 31 80 00       	push   $0x8031c9
+  80054c:	53                   	push   %ebx
+  80054d:	56                   	push   %esi
+  80054e:	e8 92 fe ff ff       	call   8003e5 <printfmt>
+  800553:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800556:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800559:	e9 7a 02 00 00       	jmp    8007d8 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80055e:	50                   	push   %eax
+  80055f:	68 13 2d 80 00       	push   $0x802d13
+  800564:	53                   	push   %ebx
+  800565:	56                   	push   %esi
+  800566:	e8 7a fe ff ff       	call   8003e5 <printfmt>
+  80056b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800571:	e9 62 02 00 00       	jmp    8007d8 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800576:	8b 45 14             	mov    0x14(%ebp),%eax
+  800579:	83 c0 04             	add    $0x4,%eax
+  80057c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80057f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800582:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800584:	85 c9                	test   %ecx,%ecx
+  800586:	b8 0c 2d 80 00       	mov    $0x802d0c,%eax
+  80058b:	0f 45 c1             	cmovne %ecx,%eax
+  80058e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800591:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800595:	7e 06                	jle    80059d <vprintfmt+0x19b>
+  800597:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80059b:	75 0b                	jne    8005a8 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005a0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a6:	eb 5c                	jmp    800604 <vprintfmt+0x202>
+  8005a8:	83 ec 08             	sub    $0x8,%esp
+  8005ab:	ff 75 d0             	push   -0x30(%ebp)
+  8005ae:	ff 75 cc             	push   -0x34(%ebp)
+  8005b1:	e8 20 03 00 00       	call   8008d6 <strnlen>
+  8005b6:	89 c2                	mov    %eax,%edx
+  8005b8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005bb:	29 d0                	sub    %edx,%eax
+  8005bd:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005c0:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005ca:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cc:	eb 0e                	jmp    8005dc <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005ce:	83 ec 08             	sub    $0x8,%esp
+  8005d1:	53                   	push   %ebx
+  8005d2:	57                   	push   %edi
+  8005d3:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d6:	83 ee 01             	sub    $0x1,%esi
+  8005d9:	83 c4 10             	add    $0x10,%esp
+  8005dc:	85 f6                	test   %esi,%esi
+  8005de:	7f ee                	jg     8005ce <vprintfmt+0x1cc>
+  8005e0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e6:	85 c0                	test   %eax,%eax
+  8005e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ed:	0f 49 d0             	cmovns %eax,%edx
+  8005f0:	29 d0                	sub    %edx,%eax
+  8005f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f5:	eb a6                	jmp    80059d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005f7:	83 ec 08             	sub    $0x8,%esp
+  8005fa:	53                   	push   %ebx
+  8005fb:	52                   	push   %edx
+  8005fc:	ff 55 08             	call   *0x8(%ebp)
+  8005ff:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800602:	89 f1                	mov    %esi,%ecx
+  800604:	8d 71 01             	lea    0x1(%ecx),%esi
+  800607:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80060b:	0f be d0             	movsbl %al,%edx
+  80060e:	85 d2                	test   %edx,%edx
+  800610:	74 28                	je     80063a <vprintfmt+0x238>
+  800612:	85 ff                	test   %edi,%edi
+  800614:	78 05                	js     80061b <vprintfmt+0x219>
+  800616:	83 ef 01             	sub    $0x1,%edi
+  800619:	78 30                	js     80064b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80061b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80061f:	74 d6                	je     8005f7 <vprintfmt+0x1f5>
+  800621:	0f be c0             	movsbl %al,%eax
+  800624:	83 e8 20             	sub    $0x20,%eax
+  800627:	83 f8 5e             	cmp    $0x5e,%eax
+  80062a:	76 cb                	jbe    8005f7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80062c:	83 ec 08             	sub    $0x8,%esp
+  80062f:	53                   	push   %ebx
+  800630:	6a 3f                	push   $0x3f
+  800632:	ff 55 08             	call   *0x8(%ebp)
+  800635:	83 c4 10             	add    $0x10,%esp
+  800638:	eb c8                	jmp    800602 <vprintfmt+0x200>
+  80063a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800640:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800643:	01 d0                	add    %edx,%eax
+  800645:	29 c8                	sub    %ecx,%eax
+  800647:	89 c7                	mov    %eax,%edi
+  800649:	eb 13                	jmp    80065e <vprintfmt+0x25c>
+  80064b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064e:	eb ed                	jmp    80063d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800650:	83 ec 08             	sub    $0x8,%esp
+  800653:	53                   	push   %ebx
+  800654:	6a 20                	push   $0x20
+  800656:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800658:	83 ef 01             	sub    $0x1,%edi
+  80065b:	83 c4 10             	add    $0x10,%esp
+  80065e:	85 ff                	test   %edi,%edi
+  800660:	7f ee                	jg     800650 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800662:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800665:	89 45 14             	mov    %eax,0x14(%ebp)
+  800668:	e9 6b 01 00 00       	jmp    8007d8 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80066d:	83 f9 01             	cmp    $0x1,%ecx
+  800670:	7f 1f                	jg     800691 <vprintfmt+0x28f>
+	else if (lflag)
+  800672:	85 c9                	test   %ecx,%ecx
+  800674:	74 67                	je     8006dd <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8b 00                	mov    (%eax),%eax
+  80067b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067e:	89 c1                	mov    %eax,%ecx
+  800680:	c1 f9 1f             	sar    $0x1f,%ecx
+  800683:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800686:	8b 45 14             	mov    0x14(%ebp),%eax
+  800689:	8d 40 04             	lea    0x4(%eax),%eax
+  80068c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068f:	eb 17                	jmp    8006a8 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800691:	8b 45 14             	mov    0x14(%ebp),%eax
+  800694:	8b 50 04             	mov    0x4(%eax),%edx
+  800697:	8b 00                	mov    (%eax),%eax
+  800699:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80069f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006ab:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006ae:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006b3:	85 c9                	test   %ecx,%ecx
+  8006b5:	0f 89 03 01 00 00    	jns    8007be <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006bb:	83 ec 08             	sub    $0x8,%esp
+  8006be:	53                   	push   %ebx
+  8006bf:	6a 2d                	push   $0x2d
+  8006c1:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006c3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006c9:	f7 da                	neg    %edx
+  8006cb:	83 d1 00             	adc    $0x0,%ecx
+  8006ce:	f7 d9                	neg    %ecx
+  8006d0:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006d3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d8:	e9 e1 00 00 00       	jmp    8007be <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e0:	8b 00                	mov    (%eax),%eax
+  8006e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e5:	89 c1                	mov    %eax,%ecx
+  8006e7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006ea:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f6:	eb b0                	jmp    8006a8 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006f8:	83 f9 01             	cmp    $0x1,%ecx
+  8006fb:	7f 1e                	jg     80071b <vprintfmt+0x319>
+	else if (lflag)
+  8006fd:	85 c9                	test   %ecx,%ecx
+  8006ff:	74 32                	je     800733 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800701:	8b 45 14             	mov    0x14(%ebp),%eax
+  800704:	8b 10                	mov    (%eax),%edx
+  800706:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070b:	8d 40 04             	lea    0x4(%eax),%eax
+  80070e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800711:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800716:	e9 a3 00 00 00       	jmp    8007be <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80071b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071e:	8b 10                	mov    (%eax),%edx
+  800720:	8b 48 04             	mov    0x4(%eax),%ecx
+  800723:	8d 40 08             	lea    0x8(%eax),%eax
+  800726:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800729:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80072e:	e9 8b 00 00 00       	jmp    8007be <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8b 10                	mov    (%eax),%edx
+  800738:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073d:	8d 40 04             	lea    0x4(%eax),%eax
+  800740:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800743:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800748:	eb 74                	jmp    8007be <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80074a:	83 f9 01             	cmp    $0x1,%ecx
+  80074d:	7f 1b                	jg     80076a <vprintfmt+0x368>
+	else if (lflag)
+  80074f:	85 c9                	test   %ecx,%ecx
+  800751:	74 2c                	je     80077f <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800753:	8b 45 14             	mov    0x14(%ebp),%eax
+  800756:	8b 10                	mov    (%eax),%edx
+  800758:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075d:	8d 40 04             	lea    0x4(%eax),%eax
+  800760:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800763:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800768:	eb 54                	jmp    8007be <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80076a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076d:	8b 10                	mov    (%eax),%edx
+  80076f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800772:	8d 40 08             	lea    0x8(%eax),%eax
+  800775:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800778:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80077d:	eb 3f                	jmp    8007be <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80077f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800782:	8b 10                	mov    (%eax),%edx
+  800784:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800789:	8d 40 04             	lea    0x4(%eax),%eax
+  80078c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80078f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800794:	eb 28                	jmp    8007be <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800796:	83 ec 08             	sub    $0x8,%esp
+  800799:	53                   	push   %ebx
+  80079a:	6a 30                	push   $0x30
+  80079c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80079e:	83 c4 08             	add    $0x8,%esp
+  8007a1:	53                   	push   %ebx
+  8007a2:	6a 78                	push   $0x78
+  8007a4:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8b 10                	mov    (%eax),%edx
+  8007ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007b0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b9:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007be:	83 ec 0c             	sub    $0xc,%esp
+  8007c1:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007c5:	50                   	push   %eax
+  8007c6:	ff 75 e0             	push   -0x20(%ebp)
+  8007c9:	57                   	push   %edi
+  8007ca:	51                   	push   %ecx
+  8007cb:	52                   	push   %edx
+  8007cc:	89 da                	mov    %ebx,%edx
+  8007ce:	89 f0                	mov    %esi,%eax
+  8007d0:	e8 4a fb ff ff       	call   80031f <printnum>
+			break;
+  8007d5:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007d8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007db:	e9 40 fc ff ff       	jmp    800420 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007e0:	83 f9 01             	cmp    $0x1,%ecx
+  8007e3:	7f 1b                	jg     800800 <vprintfmt+0x3fe>
+	else if (lflag)
+  8007e5:	85 c9                	test   %ecx,%ecx
+  8007e7:	74 2c                	je     800815 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ec:	8b 10                	mov    (%eax),%edx
+  8007ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007fe:	eb be                	jmp    8007be <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800800:	8b 45 14             	mov    0x14(%ebp),%eax
+  800803:	8b 10                	mov    (%eax),%edx
+  800805:	8b 48 04             	mov    0x4(%eax),%ecx
+  800808:	8d 40 08             	lea    0x8(%eax),%eax
+  80080b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800813:	eb a9                	jmp    8007be <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800815:	8b 45 14             	mov    0x14(%ebp),%eax
+  800818:	8b 10                	mov    (%eax),%edx
+  80081a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081f:	8d 40 04             	lea    0x4(%eax),%eax
+  800822:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800825:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80082a:	eb 92                	jmp    8007be <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80082c:	83 ec 08             	sub    $0x8,%esp
+  80082f:	53                   	push   %ebx
+  800830:	6a 25                	push   $0x25
+  800832:	ff d6                	call   *%esi
+			break;
+  800834:	83 c4 10             	add    $0x10,%esp
+  800837:	eb 9f                	jmp    8007d8 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800839:	83 ec 08             	sub    $0x8,%esp
+  80083c:	53                   	push   %ebx
+  80083d:	6a 25                	push   $0x25
+  80083f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800841:	83 c4 10             	add    $0x10,%esp
+  800844:	89 f8                	mov    %edi,%eax
+  800846:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80084a:	74 05                	je     800851 <vprintfmt+0x44f>
+  80084c:	83 e8 01             	sub    $0x1,%eax
+  80084f:	eb f5                	jmp    800846 <vprintfmt+0x444>
+  800851:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800854:	eb 82                	jmp    8007d8 <vprintfmt+0x3d6>
+
+00800856 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800856:	55                   	push   %ebp
+  800857:	89 e5                	mov    %esp,%ebp
+  800859:	83 ec 18             	sub    $0x18,%esp
+  80085c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800862:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800865:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800869:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80086c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800873:	85 c0                	test   %eax,%eax
+  800875:	74 26                	je     80089d <vsnprintf+0x47>
+  800877:	85 d2                	test   %edx,%edx
+  800879:	7e 22                	jle    80089d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80087b:	ff 75 14             	push   0x14(%ebp)
+  80087e:	ff 75 10             	push   0x10(%ebp)
+  800881:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800884:	50                   	push   %eax
+  800885:	68 c8 03 80 00       	push   $0x8003c8
+  80088a:	e8 73 fb ff ff       	call   800402 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80088f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800892:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800895:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800898:	83 c4 10             	add    $0x10,%esp
+}
+  80089b:	c9                   	leave
+  80089c:	c3                   	ret
+		return -E_INVAL;
+  80089d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008a2:	eb f7                	jmp    80089b <vsnprintf+0x45>
+
+008008a4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008a4:	55                   	push   %ebp
+  8008a5:	89 e5                	mov    %esp,%ebp
+  8008a7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008aa:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008ad:	50                   	push   %eax
+  8008ae:	ff 75 10             	push   0x10(%ebp)
+  8008b1:	ff 75 0c             	push   0xc(%ebp)
+  8008b4:	ff 75 08             	push   0x8(%ebp)
+  8008b7:	e8 9a ff ff ff       	call   800856 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008bc:	c9                   	leave
+  8008bd:	c3                   	ret
+
+008008be <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008be:	55                   	push   %ebp
+  8008bf:	89 e5                	mov    %esp,%ebp
+  8008c1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c9:	eb 03                	jmp    8008ce <strlen+0x10>
+		n++;
+  8008cb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008ce:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008d2:	75 f7                	jne    8008cb <strlen+0xd>
+	return n;
+}
+  8008d4:	5d                   	pop    %ebp
+  8008d5:	c3                   	ret
+
+008008d6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008d6:	55                   	push   %ebp
+  8008d7:	89 e5                	mov    %esp,%ebp
+  8008d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e4:	eb 03                	jmp    8008e9 <strnlen+0x13>
+		n++;
+  8008e6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e9:	39 d0                	cmp    %edx,%eax
+  8008eb:	74 08                	je     8008f5 <strnlen+0x1f>
+  8008ed:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008f1:	75 f3                	jne    8008e6 <strnlen+0x10>
+  8008f3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008f5:	89 d0                	mov    %edx,%eax
+  8008f7:	5d                   	pop    %ebp
+  8008f8:	c3                   	ret
+
+008008f9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008f9:	55                   	push   %ebp
+  8008fa:	89 e5                	mov    %esp,%ebp
+  8008fc:	53                   	push   %ebx
+  8008fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800900:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800903:	b8 00 00 00 00       	mov    $0x0,%eax
+  800908:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80090c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80090f:	83 c0 01             	add    $0x1,%eax
+  800912:	84 d2                	test   %dl,%dl
+  800914:	75 f2                	jne    800908 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800916:	89 c8                	mov    %ecx,%eax
+  800918:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80091b:	c9                   	leave
+  80091c:	c3                   	ret
+
+0080091d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80091d:	55                   	push   %ebp
+  80091e:	89 e5                	mov    %esp,%ebp
+  800920:	53                   	push   %ebx
+  800921:	83 ec 10             	sub    $0x10,%esp
+  800924:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800927:	53                   	push   %ebx
+  800928:	e8 91 ff ff ff       	call   8008be <strlen>
+  80092d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800930:	ff 75 0c             	push   0xc(%ebp)
+  800933:	01 d8                	add    %ebx,%eax
+  800935:	50                   	push   %eax
+  800936:	e8 be ff ff ff       	call   8008f9 <strcpy>
+	return dst;
+}
+  80093b:	89 d8                	mov    %ebx,%eax
+  80093d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800940:	c9                   	leave
+  800941:	c3                   	ret
+
+00800942 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800942:	55                   	push   %ebp
+  800943:	89 e5                	mov    %esp,%ebp
+  800945:	56                   	push   %esi
+  800946:	53                   	push   %ebx
+  800947:	8b 75 08             	mov    0x8(%ebp),%esi
+  80094a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80094d:	89 f3                	mov    %esi,%ebx
+  80094f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800952:	89 f0                	mov    %esi,%eax
+  800954:	eb 0f                	jmp    800965 <strncpy+0x23>
+		*dst++ = *src;
+  800956:	83 c0 01             	add    $0x1,%eax
+  800959:	0f b6 0a             	movzbl (%edx),%ecx
+  80095c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80095f:	80 f9 01             	cmp    $0x1,%cl
+  800962:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800965:	39 d8                	cmp    %ebx,%eax
+  800967:	75 ed                	jne    800956 <strncpy+0x14>
+	}
+	return ret;
+}
+  800969:	89 f0                	mov    %esi,%eax
+  80096b:	5b                   	pop    %ebx
+  80096c:	5e                   	pop    %esi
+  80096d:	5d                   	pop    %ebp
+  80096e:	c3                   	ret
+
+0080096f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80096f:	55                   	push   %ebp
+  800970:	89 e5                	mov    %esp,%ebp
+  800972:	56                   	push   %esi
+  800973:	53                   	push   %ebx
+  800974:	8b 75 08             	mov    0x8(%ebp),%esi
+  800977:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80097a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80097d:	89 f0                	mov    %esi,%eax
+  80097f:	85 d2                	test   %edx,%edx
+  800981:	74 21                	je     8009a4 <strlcpy+0x35>
+  800983:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800987:	89 f2                	mov    %esi,%edx
+  800989:	eb 09                	jmp    800994 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80098b:	83 c1 01             	add    $0x1,%ecx
+  80098e:	83 c2 01             	add    $0x1,%edx
+  800991:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800994:	39 c2                	cmp    %eax,%edx
+  800996:	74 09                	je     8009a1 <strlcpy+0x32>
+  800998:	0f b6 19             	movzbl (%ecx),%ebx
+  80099b:	84 db                	test   %bl,%bl
+  80099d:	75 ec                	jne    80098b <strlcpy+0x1c>
+  80099f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009a1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009a4:	29 f0                	sub    %esi,%eax
+}
+  8009a6:	5b                   	pop    %ebx
+  8009a7:	5e                   	pop    %esi
+  8009a8:	5d                   	pop    %ebp
+  8009a9:	c3                   	ret
+
+008009aa <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009b3:	eb 06                	jmp    8009bb <strcmp+0x11>
+		p++, q++;
+  8009b5:	83 c1 01             	add    $0x1,%ecx
+  8009b8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009bb:	0f b6 01             	movzbl (%ecx),%eax
+  8009be:	84 c0                	test   %al,%al
+  8009c0:	74 04                	je     8009c6 <strcmp+0x1c>
+  8009c2:	3a 02                	cmp    (%edx),%al
+  8009c4:	74 ef                	je     8009b5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c6:	0f b6 c0             	movzbl %al,%eax
+  8009c9:	0f b6 12             	movzbl (%edx),%edx
+  8009cc:	29 d0                	sub    %edx,%eax
+}
+  8009ce:	5d                   	pop    %ebp
+  8009cf:	c3                   	ret
+
+008009d0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009d0:	55                   	push   %ebp
+  8009d1:	89 e5                	mov    %esp,%ebp
+  8009d3:	53                   	push   %ebx
+  8009d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009da:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009dd:	eb 09                	jmp    8009e8 <strncmp+0x18>
+		n--, p++, q++;
+  8009df:	83 ea 01             	sub    $0x1,%edx
+  8009e2:	83 c0 01             	add    $0x1,%eax
+  8009e5:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009e8:	85 d2                	test   %edx,%edx
+  8009ea:	74 18                	je     800a04 <strncmp+0x34>
+  8009ec:	0f b6 18             	movzbl (%eax),%ebx
+  8009ef:	84 db                	test   %bl,%bl
+  8009f1:	74 04                	je     8009f7 <strncmp+0x27>
+  8009f3:	3a 19                	cmp    (%ecx),%bl
+  8009f5:	74 e8                	je     8009df <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f7:	0f b6 00             	movzbl (%eax),%eax
+  8009fa:	0f b6 11             	movzbl (%ecx),%edx
+  8009fd:	29 d0                	sub    %edx,%eax
+}
+  8009ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a02:	c9                   	leave
+  800a03:	c3                   	ret
+		return 0;
+  800a04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a09:	eb f4                	jmp    8009ff <strncmp+0x2f>
+
+00800a0b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a11:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a15:	eb 03                	jmp    800a1a <strchr+0xf>
+  800a17:	83 c0 01             	add    $0x1,%eax
+  800a1a:	0f b6 10             	movzbl (%eax),%edx
+  800a1d:	84 d2                	test   %dl,%dl
+  800a1f:	74 06                	je     800a27 <strchr+0x1c>
+		if (*s == c)
+  800a21:	38 ca                	cmp    %cl,%dl
+  800a23:	75 f2                	jne    800a17 <strchr+0xc>
+  800a25:	eb 05                	jmp    800a2c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a2c:	5d                   	pop    %ebp
+  800a2d:	c3                   	ret
+
+00800a2e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a2e:	55                   	push   %ebp
+  800a2f:	89 e5                	mov    %esp,%ebp
+  800a31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a34:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a38:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a3b:	38 ca                	cmp    %cl,%dl
+  800a3d:	74 09                	je     800a48 <strfind+0x1a>
+  800a3f:	84 d2                	test   %dl,%dl
+  800a41:	74 05                	je     800a48 <strfind+0x1a>
+	for (; *s; s++)
+  800a43:	83 c0 01             	add    $0x1,%eax
+  800a46:	eb f0                	jmp    800a38 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a48:	5d                   	pop    %ebp
+  800a49:	c3                   	ret
+
+00800a4a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a4a:	55                   	push   %ebp
+  800a4b:	89 e5                	mov    %esp,%ebp
+  800a4d:	57                   	push   %edi
+  800a4e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a51:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a54:	85 c9                	test   %ecx,%ecx
+  800a56:	74 20                	je     800a78 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a58:	89 f8                	mov    %edi,%eax
+  800a5a:	09 c8                	or     %ecx,%eax
+  800a5c:	a8 03                	test   $0x3,%al
+  800a5e:	75 12                	jne    800a72 <memset+0x28>
+		c &= 0xFF;
+  800a60:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a64:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a6a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a6d:	fc                   	cld
+  800a6e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a70:	eb 06                	jmp    800a78 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a75:	fc                   	cld
+  800a76:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a78:	89 f8                	mov    %edi,%eax
+  800a7a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a7d:	c9                   	leave
+  800a7e:	c3                   	ret
+
+00800a7f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	57                   	push   %edi
+  800a83:	56                   	push   %esi
+  800a84:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a87:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a8a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a8d:	39 c6                	cmp    %eax,%esi
+  800a8f:	73 32                	jae    800ac3 <memmove+0x44>
+  800a91:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a94:	39 d0                	cmp    %edx,%eax
+  800a96:	73 2b                	jae    800ac3 <memmove+0x44>
+		s += n;
+		d += n;
+  800a98:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a9b:	89 d6                	mov    %edx,%esi
+  800a9d:	09 fe                	or     %edi,%esi
+  800a9f:	09 ce                	or     %ecx,%esi
+  800aa1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aa7:	75 0e                	jne    800ab7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800aa9:	83 ef 04             	sub    $0x4,%edi
+  800aac:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aaf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ab2:	fd                   	std
+  800ab3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ab5:	eb 09                	jmp    800ac0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ab7:	83 ef 01             	sub    $0x1,%edi
+  800aba:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800abd:	fd                   	std
+  800abe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ac0:	fc                   	cld
+  800ac1:	eb 1a                	jmp    800add <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac3:	89 f2                	mov    %esi,%edx
+  800ac5:	09 c2                	or     %eax,%edx
+  800ac7:	09 ca                	or     %ecx,%edx
+  800ac9:	f6 c2 03             	test   $0x3,%dl
+  800acc:	75 0a                	jne    800ad8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ace:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ad1:	89 c7                	mov    %eax,%edi
+  800ad3:	fc                   	cld
+  800ad4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad6:	eb 05                	jmp    800add <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ad8:	89 c7                	mov    %eax,%edi
+  800ada:	fc                   	cld
+  800adb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800add:	5e                   	pop    %esi
+  800ade:	5f                   	pop    %edi
+  800adf:	5d                   	pop    %ebp
+  800ae0:	c3                   	ret
+
+00800ae1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ae1:	55                   	push   %ebp
+  800ae2:	89 e5                	mov    %esp,%ebp
+  800ae4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ae7:	ff 75 10             	push   0x10(%ebp)
+  800aea:	ff 75 0c             	push   0xc(%ebp)
+  800aed:	ff 75 08             	push   0x8(%ebp)
+  800af0:	e8 8a ff ff ff       	call   800a7f <memmove>
+}
+  800af5:	c9                   	leave
+  800af6:	c3                   	ret
+
+00800af7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800af7:	55                   	push   %ebp
+  800af8:	89 e5                	mov    %esp,%ebp
+  800afa:	56                   	push   %esi
+  800afb:	53                   	push   %ebx
+  800afc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b02:	89 c6                	mov    %eax,%esi
+  800b04:	03 75 10             	add    0x10(%ebp),%esi
+  800b07:	eb 06                	jmp    800b0f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b09:	83 c0 01             	add    $0x1,%eax
+  800b0c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b0f:	39 f0                	cmp    %esi,%eax
+  800b11:	74 14                	je     800b27 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b13:	0f b6 08             	movzbl (%eax),%ecx
+  800b16:	0f b6 1a             	movzbl (%edx),%ebx
+  800b19:	38 d9                	cmp    %bl,%cl
+  800b1b:	74 ec                	je     800b09 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b1d:	0f b6 c1             	movzbl %cl,%eax
+  800b20:	0f b6 db             	movzbl %bl,%ebx
+  800b23:	29 d8                	sub    %ebx,%eax
+  800b25:	eb 05                	jmp    800b2c <memcmp+0x35>
+	}
+
+	return 0;
+  800b27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b2c:	5b                   	pop    %ebx
+  800b2d:	5e                   	pop    %esi
+  800b2e:	5d                   	pop    %ebp
+  800b2f:	c3                   	ret
+
+00800b30 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b39:	89 c2                	mov    %eax,%edx
+  800b3b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b3e:	eb 03                	jmp    800b43 <memfind+0x13>
+  800b40:	83 c0 01             	add    $0x1,%eax
+  800b43:	39 d0                	cmp    %edx,%eax
+  800b45:	73 04                	jae    800b4b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b47:	38 08                	cmp    %cl,(%eax)
+  800b49:	75 f5                	jne    800b40 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b4b:	5d                   	pop    %ebp
+  800b4c:	c3                   	ret
+
+00800b4d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	57                   	push   %edi
+  800b51:	56                   	push   %esi
+  800b52:	53                   	push   %ebx
+  800b53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b59:	eb 03                	jmp    800b5e <strtol+0x11>
+		s++;
+  800b5b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b5e:	0f b6 02             	movzbl (%edx),%eax
+  800b61:	3c 20                	cmp    $0x20,%al
+  800b63:	74 f6                	je     800b5b <strtol+0xe>
+  800b65:	3c 09                	cmp    $0x9,%al
+  800b67:	74 f2                	je     800b5b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b69:	3c 2b                	cmp    $0x2b,%al
+  800b6b:	74 2a                	je     800b97 <strtol+0x4a>
+	int neg = 0;
+  800b6d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b72:	3c 2d                	cmp    $0x2d,%al
+  800b74:	74 2b                	je     800ba1 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b76:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b7c:	75 0f                	jne    800b8d <strtol+0x40>
+  800b7e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b81:	74 28                	je     800bab <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b83:	85 db                	test   %ebx,%ebx
+  800b85:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b8a:	0f 44 d8             	cmove  %eax,%ebx
+  800b8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b92:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b95:	eb 46                	jmp    800bdd <strtol+0x90>
+		s++;
+  800b97:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b9f:	eb d5                	jmp    800b76 <strtol+0x29>
+		s++, neg = 1;
+  800ba1:	83 c2 01             	add    $0x1,%edx
+  800ba4:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ba9:	eb cb                	jmp    800b76 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bab:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800baf:	74 0e                	je     800bbf <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bb1:	85 db                	test   %ebx,%ebx
+  800bb3:	75 d8                	jne    800b8d <strtol+0x40>
+		s++, base = 8;
+  800bb5:	83 c2 01             	add    $0x1,%edx
+  800bb8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bbd:	eb ce                	jmp    800b8d <strtol+0x40>
+		s += 2, base = 16;
+  800bbf:	83 c2 02             	add    $0x2,%edx
+  800bc2:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bc7:	eb c4                	jmp    800b8d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bc9:	0f be c0             	movsbl %al,%eax
+  800bcc:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bcf:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bd2:	7d 3a                	jge    800c0e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bd4:	83 c2 01             	add    $0x1,%edx
+  800bd7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bdb:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bdd:	0f b6 02             	movzbl (%edx),%eax
+  800be0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800be3:	89 f3                	mov    %esi,%ebx
+  800be5:	80 fb 09             	cmp    $0x9,%bl
+  800be8:	76 df                	jbe    800bc9 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bea:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bed:	89 f3                	mov    %esi,%ebx
+  800bef:	80 fb 19             	cmp    $0x19,%bl
+  800bf2:	77 08                	ja     800bfc <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bf4:	0f be c0             	movsbl %al,%eax
+  800bf7:	83 e8 57             	sub    $0x57,%eax
+  800bfa:	eb d3                	jmp    800bcf <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bfc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bff:	89 f3                	mov    %esi,%ebx
+  800c01:	80 fb 19             	cmp    $0x19,%bl
+  800c04:	77 08                	ja     800c0e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c06:	0f be c0             	movsbl %al,%eax
+  800c09:	83 e8 37             	sub    $0x37,%eax
+  800c0c:	eb c1                	jmp    800bcf <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c0e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c12:	74 05                	je     800c19 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c17:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c19:	89 c8                	mov    %ecx,%eax
+  800c1b:	f7 d8                	neg    %eax
+  800c1d:	85 ff                	test   %edi,%edi
+  800c1f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c22:	89 c8                	mov    %ecx,%eax
+  800c24:	5b                   	pop    %ebx
+  800c25:	5e                   	pop    %esi
+  800c26:	5f                   	pop    %edi
+  800c27:	5d                   	pop    %ebp
+  800c28:	c3                   	ret
+
+00800c29 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c29:	55                   	push   %ebp
+  800c2a:	89 e5                	mov    %esp,%ebp
+  800c2c:	57                   	push   %edi
+  800c2d:	56                   	push   %esi
+  800c2e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3a:	89 c3                	mov    %eax,%ebx
+  800c3c:	89 c7                	mov    %eax,%edi
+  800c3e:	89 c6                	mov    %eax,%esi
+  800c40:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c42:	5b                   	pop    %ebx
+  800c43:	5e                   	pop    %esi
+  800c44:	5f                   	pop    %edi
+  800c45:	5d                   	pop    %ebp
+  800c46:	c3                   	ret
+
+00800c47 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c47:	55                   	push   %ebp
+  800c48:	89 e5                	mov    %esp,%ebp
+  800c4a:	57                   	push   %edi
+  800c4b:	56                   	push   %esi
+  800c4c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c52:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c57:	89 d1                	mov    %edx,%ecx
+  800c59:	89 d3                	mov    %edx,%ebx
+  800c5b:	89 d7                	mov    %edx,%edi
+  800c5d:	89 d6                	mov    %edx,%esi
+  800c5f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c61:	5b                   	pop    %ebx
+  800c62:	5e                   	pop    %esi
+  800c63:	5f                   	pop    %edi
+  800c64:	5d                   	pop    %ebp
+  800c65:	c3                   	ret
+
+00800c66 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	57                   	push   %edi
+  800c6a:	56                   	push   %esi
+  800c6b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c74:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c79:	89 cb                	mov    %ecx,%ebx
+  800c7b:	89 cf                	mov    %ecx,%edi
+  800c7d:	89 ce                	mov    %ecx,%esi
+  800c7f:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800c81:	5b                   	pop    %ebx
+  800c82:	5e                   	pop    %esi
+  800c83:	5f                   	pop    %edi
+  800c84:	5d                   	pop    %ebp
+  800c85:	c3                   	ret
+
+00800c86 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c86:	55                   	push   %ebp
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	57                   	push   %edi
+  800c8a:	56                   	push   %esi
+  800c8b:	53                   	push   %ebx
+  800c8c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c97:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c9c:	89 cb                	mov    %ecx,%ebx
+  800c9e:	89 cf                	mov    %ecx,%edi
+  800ca0:	89 ce                	mov    %ecx,%esi
+  800ca2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ca4:	85 c0                	test   %eax,%eax
+  800ca6:	7f 08                	jg     800cb0 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ca8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cab:	5b                   	pop    %ebx
+  800cac:	5e                   	pop    %esi
+  800cad:	5f                   	pop    %edi
+  800cae:	5d                   	pop    %ebp
+  800caf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb0:	83 ec 0c             	sub    $0xc,%esp
+  800cb3:	50                   	push   %eax
+  800cb4:	6a 03                	push   $0x3
+  800cb6:	68 ff 2f 80 00       	push   $0x802fff
+  800cbb:	6a 23                	push   $0x23
+  800cbd:	68 1c 30 80 00       	push   $0x80301c
+  800cc2:	e8 69 f5 ff ff       	call   800230 <_panic>
+
+00800cc7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cc7:	55                   	push   %ebp
+  800cc8:	89 e5                	mov    %esp,%ebp
+  800cca:	57                   	push   %edi
+  800ccb:	56                   	push   %esi
+  800ccc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ccd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd7:	89 d1                	mov    %edx,%ecx
+  800cd9:	89 d3                	mov    %edx,%ebx
+  800cdb:	89 d7                	mov    %edx,%edi
+  800cdd:	89 d6                	mov    %edx,%esi
+  800cdf:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ce1:	5b                   	pop    %ebx
+  800ce2:	5e                   	pop    %esi
+  800ce3:	5f                   	pop    %edi
+  800ce4:	5d                   	pop    %ebp
+  800ce5:	c3                   	ret
+
+00800ce6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ce6:	55                   	push   %ebp
+  800ce7:	89 e5                	mov    %esp,%ebp
+  800ce9:	57                   	push   %edi
+  800cea:	56                   	push   %esi
+  800ceb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cec:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf1:	b8 16 00 00 00       	mov    $0x16,%eax
+  800cf6:	89 d1                	mov    %edx,%ecx
+  800cf8:	89 d3                	mov    %edx,%ebx
+  800cfa:	89 d7                	mov    %edx,%edi
+  800cfc:	89 d6                	mov    %edx,%esi
+  800cfe:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d00:	5b                   	pop    %ebx
+  800d01:	5e                   	pop    %esi
+  800d02:	5f                   	pop    %edi
+  800d03:	5d                   	pop    %ebp
+  800d04:	c3                   	ret
+
+00800d05 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800d05:	55                   	push   %ebp
+  800d06:	89 e5                	mov    %esp,%ebp
+  800d08:	57                   	push   %edi
+  800d09:	56                   	push   %esi
+  800d0a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d10:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d15:	89 d1                	mov    %edx,%ecx
+  800d17:	89 d3                	mov    %edx,%ebx
+  800d19:	89 d7                	mov    %edx,%edi
+  800d1b:	89 d6                	mov    %edx,%esi
+  800d1d:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800d1f:	5b                   	pop    %ebx
+  800d20:	5e                   	pop    %esi
+  800d21:	5f                   	pop    %edi
+  800d22:	5d                   	pop    %ebp
+  800d23:	c3                   	ret
+
+00800d24 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800d24:	55                   	push   %ebp
+  800d25:	89 e5                	mov    %esp,%ebp
+  800d27:	57                   	push   %edi
+  800d28:	56                   	push   %esi
+  800d29:	53                   	push   %ebx
+  800d2a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d38:	b8 15 00 00 00       	mov    $0x15,%eax
+  800d3d:	89 df                	mov    %ebx,%edi
+  800d3f:	89 de                	mov    %ebx,%esi
+  800d41:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d43:	85 c0                	test   %eax,%eax
+  800d45:	7f 08                	jg     800d4f <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800d47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4a:	5b                   	pop    %ebx
+  800d4b:	5e                   	pop    %esi
+  800d4c:	5f                   	pop    %edi
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d4f:	83 ec 0c             	sub    $0xc,%esp
+  800d52:	50                   	push   %eax
+  800d53:	6a 15                	push   $0x15
+  800d55:	68 ff 2f 80 00       	push   $0x802fff
+  800d5a:	6a 23                	push   $0x23
+  800d5c:	68 1c 30 80 00       	push   $0x80301c
+  800d61:	e8 ca f4 ff ff       	call   800230 <_panic>
+
+00800d66 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d66:	55                   	push   %ebp
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	57                   	push   %edi
+  800d6a:	56                   	push   %esi
+  800d6b:	53                   	push   %ebx
+  800d6c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d82:	89 f7                	mov    %esi,%edi
+  800d84:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d86:	85 c0                	test   %eax,%eax
+  800d88:	7f 08                	jg     800d92 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8d:	5b                   	pop    %ebx
+  800d8e:	5e                   	pop    %esi
+  800d8f:	5f                   	pop    %edi
+  800d90:	5d                   	pop    %ebp
+  800d91:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d92:	83 ec 0c             	sub    $0xc,%esp
+  800d95:	50                   	push   %eax
+  800d96:	6a 05                	push   $0x5
+  800d98:	68 ff 2f 80 00       	push   $0x802fff
+  800d9d:	6a 23                	push   $0x23
+  800d9f:	68 1c 30 80 00       	push   $0x80301c
+  800da4:	e8 87 f4 ff ff       	call   800230 <_panic>
+
+00800da9 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800da9:	55                   	push   %ebp
+  800daa:	89 e5                	mov    %esp,%ebp
+  800dac:	57                   	push   %edi
+  800dad:	56                   	push   %esi
+  800dae:	53                   	push   %ebx
+  800daf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db2:	be 00 00 00 00       	mov    $0x0,%esi
+  800db7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbd:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dc2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc5:	89 f7                	mov    %esi,%edi
+  800dc7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc9:	85 c0                	test   %eax,%eax
+  800dcb:	7f 08                	jg     800dd5 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd0:	5b                   	pop    %ebx
+  800dd1:	5e                   	pop    %esi
+  800dd2:	5f                   	pop    %edi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd5:	83 ec 0c             	sub    $0xc,%esp
+  800dd8:	50                   	push   %eax
+  800dd9:	6a 06                	push   $0x6
+  800ddb:	68 ff 2f 80 00       	push   $0x802fff
+  800de0:	6a 23                	push   $0x23
+  800de2:	68 1c 30 80 00       	push   $0x80301c
+  800de7:	e8 44 f4 ff ff       	call   800230 <_panic>
+
+00800dec <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+  800df2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfb:	b8 07 00 00 00       	mov    $0x7,%eax
+  800e00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e03:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e06:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e09:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e0b:	85 c0                	test   %eax,%eax
+  800e0d:	7f 08                	jg     800e17 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e12:	5b                   	pop    %ebx
+  800e13:	5e                   	pop    %esi
+  800e14:	5f                   	pop    %edi
+  800e15:	5d                   	pop    %ebp
+  800e16:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e17:	83 ec 0c             	sub    $0xc,%esp
+  800e1a:	50                   	push   %eax
+  800e1b:	6a 07                	push   $0x7
+  800e1d:	68 ff 2f 80 00       	push   $0x802fff
+  800e22:	6a 23                	push   $0x23
+  800e24:	68 1c 30 80 00       	push   $0x80301c
+  800e29:	e8 02 f4 ff ff       	call   800230 <_panic>
+
+00800e2e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e2e:	55                   	push   %ebp
+  800e2f:	89 e5                	mov    %esp,%ebp
+  800e31:	57                   	push   %edi
+  800e32:	56                   	push   %esi
+  800e33:	53                   	push   %ebx
+  800e34:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e42:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e47:	89 df                	mov    %ebx,%edi
+  800e49:	89 de                	mov    %ebx,%esi
+  800e4b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e4d:	85 c0                	test   %eax,%eax
+  800e4f:	7f 08                	jg     800e59 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e54:	5b                   	pop    %ebx
+  800e55:	5e                   	pop    %esi
+  800e56:	5f                   	pop    %edi
+  800e57:	5d                   	pop    %ebp
+  800e58:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+  800e5c:	50                   	push   %eax
+  800e5d:	6a 08                	push   $0x8
+  800e5f:	68 ff 2f 80 00       	push   $0x802fff
+  800e64:	6a 23                	push   $0x23
+  800e66:	68 1c 30 80 00       	push   $0x80301c
+  800e6b:	e8 c0 f3 ff ff       	call   800230 <_panic>
+
+00800e70 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e81:	be 00 00 00 00       	mov    $0x0,%esi
+  800e86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e89:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8c:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e8e:	5b                   	pop    %ebx
+  800e8f:	5e                   	pop    %esi
+  800e90:	5f                   	pop    %edi
+  800e91:	5d                   	pop    %ebp
+  800e92:	c3                   	ret
+
+00800e93 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	57                   	push   %edi
+  800e97:	56                   	push   %esi
+  800e98:	53                   	push   %ebx
+  800e99:	8b 45 18             	mov    0x18(%ebp),%eax
+  800e9c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800e9f:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800ea4:	77 27                	ja     800ecd <sys_page_map_range+0x3a>
+  800ea6:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800eac:	77 1f                	ja     800ecd <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800eae:	c1 e0 0c             	shl    $0xc,%eax
+  800eb1:	89 c6                	mov    %eax,%esi
+  800eb3:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ec0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec6:	cd 30                	int    $0x30
+}
+  800ec8:	5b                   	pop    %ebx
+  800ec9:	5e                   	pop    %esi
+  800eca:	5f                   	pop    %edi
+  800ecb:	5d                   	pop    %ebp
+  800ecc:	c3                   	ret
+		return -E_INVAL;
+  800ecd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed2:	eb f4                	jmp    800ec8 <sys_page_map_range+0x35>
+
+00800ed4 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	57                   	push   %edi
+  800ed8:	56                   	push   %esi
+  800ed9:	53                   	push   %ebx
+  800eda:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800edd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ee8:	be 00 00 00 00       	mov    $0x0,%esi
+  800eed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef5:	85 c0                	test   %eax,%eax
+  800ef7:	7f 08                	jg     800f01 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800ef9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efc:	5b                   	pop    %ebx
+  800efd:	5e                   	pop    %esi
+  800efe:	5f                   	pop    %edi
+  800eff:	5d                   	pop    %ebp
+  800f00:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f01:	83 ec 0c             	sub    $0xc,%esp
+  800f04:	50                   	push   %eax
+  800f05:	6a 0c                	push   $0xc
+  800f07:	68 ff 2f 80 00       	push   $0x802fff
+  800f0c:	6a 23                	push   $0x23
+  800f0e:	68 1c 30 80 00       	push   $0x80301c
+  800f13:	e8 18 f3 ff ff       	call   800230 <_panic>
+
+00800f18 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f18:	55                   	push   %ebp
+  800f19:	89 e5                	mov    %esp,%ebp
+  800f1b:	57                   	push   %edi
+  800f1c:	56                   	push   %esi
+  800f1d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f1e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f29:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f31:	89 f7                	mov    %esi,%edi
+  800f33:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f35:	5b                   	pop    %ebx
+  800f36:	5e                   	pop    %esi
+  800f37:	5f                   	pop    %edi
+  800f38:	5d                   	pop    %ebp
+  800f39:	c3                   	ret
+
+00800f3a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f3a:	55                   	push   %ebp
+  800f3b:	89 e5                	mov    %esp,%ebp
+  800f3d:	57                   	push   %edi
+  800f3e:	56                   	push   %esi
+  800f3f:	53                   	push   %ebx
+  800f40:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f53:	89 df                	mov    %ebx,%edi
+  800f55:	89 de                	mov    %ebx,%esi
+  800f57:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f59:	85 c0                	test   %eax,%eax
+  800f5b:	7f 08                	jg     800f65 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f60:	5b                   	pop    %ebx
+  800f61:	5e                   	pop    %esi
+  800f62:	5f                   	pop    %edi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f65:	83 ec 0c             	sub    $0xc,%esp
+  800f68:	50                   	push   %eax
+  800f69:	6a 0f                	push   $0xf
+  800f6b:	68 ff 2f 80 00       	push   $0x802fff
+  800f70:	6a 23                	push   $0x23
+  800f72:	68 1c 30 80 00       	push   $0x80301c
+  800f77:	e8 b4 f2 ff ff       	call   800230 <_panic>
+
+00800f7c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	56                   	push   %esi
+  800f81:	53                   	push   %ebx
+  800f82:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f90:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f95:	89 df                	mov    %ebx,%edi
+  800f97:	89 de                	mov    %ebx,%esi
+  800f99:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9b:	85 c0                	test   %eax,%eax
+  800f9d:	7f 08                	jg     800fa7 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800f9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5e                   	pop    %esi
+  800fa4:	5f                   	pop    %edi
+  800fa5:	5d                   	pop    %ebp
+  800fa6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa7:	83 ec 0c             	sub    $0xc,%esp
+  800faa:	50                   	push   %eax
+  800fab:	6a 10                	push   $0x10
+  800fad:	68 ff 2f 80 00       	push   $0x802fff
+  800fb2:	6a 23                	push   $0x23
+  800fb4:	68 1c 30 80 00       	push   $0x80301c
+  800fb9:	e8 72 f2 ff ff       	call   800230 <_panic>
+
+00800fbe <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	57                   	push   %edi
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd2:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fd7:	89 df                	mov    %ebx,%edi
+  800fd9:	89 de                	mov    %ebx,%esi
+  800fdb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fdd:	85 c0                	test   %eax,%eax
+  800fdf:	7f 08                	jg     800fe9 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe4:	5b                   	pop    %ebx
+  800fe5:	5e                   	pop    %esi
+  800fe6:	5f                   	pop    %edi
+  800fe7:	5d                   	pop    %ebp
+  800fe8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe9:	83 ec 0c             	sub    $0xc,%esp
+  800fec:	50                   	push   %eax
+  800fed:	6a 11                	push   $0x11
+  800fef:	68 ff 2f 80 00       	push   $0x802fff
+  800ff4:	6a 23                	push   $0x23
+  800ff6:	68 1c 30 80 00       	push   $0x80301c
+  800ffb:	e8 30 f2 ff ff       	call   800230 <_panic>
+
+00801000 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801006:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100b:	b8 12 00 00 00       	mov    $0x12,%eax
+  801010:	89 d1                	mov    %edx,%ecx
+  801012:	89 d3                	mov    %edx,%ebx
+  801014:	89 d7                	mov    %edx,%edi
+  801016:	89 d6                	mov    %edx,%esi
+  801018:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  80101a:	5b                   	pop    %ebx
+  80101b:	5e                   	pop    %esi
+  80101c:	5f                   	pop    %edi
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+
+0080101f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80101f:	55                   	push   %ebp
+  801020:	89 e5                	mov    %esp,%ebp
+  801022:	57                   	push   %edi
+  801023:	56                   	push   %esi
+  801024:	53                   	push   %ebx
+  801025:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801028:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801030:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801033:	b8 13 00 00 00       	mov    $0x13,%eax
+  801038:	89 df                	mov    %ebx,%edi
+  80103a:	89 de                	mov    %ebx,%esi
+  80103c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103e:	85 c0                	test   %eax,%eax
+  801040:	7f 08                	jg     80104a <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801042:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801045:	5b                   	pop    %ebx
+  801046:	5e                   	pop    %esi
+  801047:	5f                   	pop    %edi
+  801048:	5d                   	pop    %ebp
+  801049:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104a:	83 ec 0c             	sub    $0xc,%esp
+  80104d:	50                   	push   %eax
+  80104e:	6a 13                	push   $0x13
+  801050:	68 ff 2f 80 00       	push   $0x802fff
+  801055:	6a 23                	push   $0x23
+  801057:	68 1c 30 80 00       	push   $0x80301c
+  80105c:	e8 cf f1 ff ff       	call   800230 <_panic>
+
+00801061 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	57                   	push   %edi
+  801065:	56                   	push   %esi
+  801066:	53                   	push   %ebx
+  801067:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80106a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801072:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801075:	b8 14 00 00 00       	mov    $0x14,%eax
+  80107a:	89 df                	mov    %ebx,%edi
+  80107c:	89 de                	mov    %ebx,%esi
+  80107e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801080:	85 c0                	test   %eax,%eax
+  801082:	7f 08                	jg     80108c <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801084:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801087:	5b                   	pop    %ebx
+  801088:	5e                   	pop    %esi
+  801089:	5f                   	pop    %edi
+  80108a:	5d                   	pop    %ebp
+  80108b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80108c:	83 ec 0c             	sub    $0xc,%esp
+  80108f:	50                   	push   %eax
+  801090:	6a 14                	push   $0x14
+  801092:	68 ff 2f 80 00       	push   $0x802fff
+  801097:	6a 23                	push   $0x23
+  801099:	68 1c 30 80 00       	push   $0x80301c
+  80109e:	e8 8d f1 ff ff       	call   800230 <_panic>
+
+008010a3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	57                   	push   %edi
+  8010a7:	56                   	push   %esi
+  8010a8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010af:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010bc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010bf:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010c1:	5b                   	pop    %ebx
+  8010c2:	5e                   	pop    %esi
+  8010c3:	5f                   	pop    %edi
+  8010c4:	5d                   	pop    %ebp
+  8010c5:	c3                   	ret
+
+008010c6 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010c6:	55                   	push   %ebp
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	57                   	push   %edi
+  8010ca:	56                   	push   %esi
+  8010cb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010df:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010e4:	5b                   	pop    %ebx
+  8010e5:	5e                   	pop    %esi
+  8010e6:	5f                   	pop    %edi
+  8010e7:	5d                   	pop    %ebp
+  8010e8:	c3                   	ret
+
+008010e9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010e9:	55                   	push   %ebp
+  8010ea:	89 e5                	mov    %esp,%ebp
+  8010ec:	57                   	push   %edi
+  8010ed:	56                   	push   %esi
+  8010ee:	53                   	push   %ebx
+  8010ef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fa:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010ff:	89 cb                	mov    %ecx,%ebx
+  801101:	89 cf                	mov    %ecx,%edi
+  801103:	89 ce                	mov    %ecx,%esi
+  801105:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801107:	85 c0                	test   %eax,%eax
+  801109:	7f 08                	jg     801113 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80110b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110e:	5b                   	pop    %ebx
+  80110f:	5e                   	pop    %esi
+  801110:	5f                   	pop    %edi
+  801111:	5d                   	pop    %ebp
+  801112:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801113:	83 ec 0c             	sub    $0xc,%esp
+  801116:	50                   	push   %eax
+  801117:	6a 19                	push   $0x19
+  801119:	68 ff 2f 80 00       	push   $0x802fff
+  80111e:	6a 23                	push   $0x23
+  801120:	68 1c 30 80 00       	push   $0x80301c
+  801125:	e8 06 f1 ff ff       	call   800230 <_panic>
+
+0080112a <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80112a:	55                   	push   %ebp
+  80112b:	89 e5                	mov    %esp,%ebp
+  80112d:	57                   	push   %edi
+  80112e:	56                   	push   %esi
+  80112f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801130:	ba 00 00 00 00       	mov    $0x0,%edx
+  801135:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80113a:	89 d1                	mov    %edx,%ecx
+  80113c:	89 d3                	mov    %edx,%ebx
+  80113e:	89 d7                	mov    %edx,%edi
+  801140:	89 d6                	mov    %edx,%esi
+  801142:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801144:	5b                   	pop    %ebx
+  801145:	5e                   	pop    %esi
+  801146:	5f                   	pop    %edi
+  801147:	5d                   	pop    %ebp
+  801148:	c3                   	ret
+
+00801149 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80114f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801154:	8b 55 08             	mov    0x8(%ebp),%edx
+  801157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80115f:	89 df                	mov    %ebx,%edi
+  801161:	89 de                	mov    %ebx,%esi
+  801163:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801165:	5b                   	pop    %ebx
+  801166:	5e                   	pop    %esi
+  801167:	5f                   	pop    %edi
+  801168:	5d                   	pop    %ebp
+  801169:	c3                   	ret
+
+0080116a <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+  80116d:	57                   	push   %edi
+  80116e:	56                   	push   %esi
+  80116f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801170:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801175:	8b 55 08             	mov    0x8(%ebp),%edx
+  801178:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801180:	89 df                	mov    %ebx,%edi
+  801182:	89 de                	mov    %ebx,%esi
+  801184:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  801186:	5b                   	pop    %ebx
+  801187:	5e                   	pop    %esi
+  801188:	5f                   	pop    %edi
+  801189:	5d                   	pop    %ebp
+  80118a:	c3                   	ret
+
+0080118b <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80118b:	55                   	push   %ebp
+  80118c:	89 e5                	mov    %esp,%ebp
+  80118e:	53                   	push   %ebx
+  80118f:	83 ec 04             	sub    $0x4,%esp
+  801192:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801195:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  801197:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  80119a:	f6 c2 02             	test   $0x2,%dl
+  80119d:	74 7b                	je     80121a <pgfault+0x8f>
+  80119f:	89 c1                	mov    %eax,%ecx
+  8011a1:	c1 e9 0c             	shr    $0xc,%ecx
+  8011a4:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8011ab:	f6 c5 08             	test   $0x8,%ch
+  8011ae:	74 6a                	je     80121a <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8011b0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011b5:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8011b7:	83 ec 04             	sub    $0x4,%esp
+  8011ba:	6a 07                	push   $0x7
+  8011bc:	68 00 f0 7f 00       	push   $0x7ff000
+  8011c1:	6a 00                	push   $0x0
+  8011c3:	e8 9e fb ff ff       	call   800d66 <sys_page_alloc>
+  8011c8:	83 c4 10             	add    $0x10,%esp
+  8011cb:	85 c0                	test   %eax,%eax
+  8011cd:	78 61                	js     801230 <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  8011cf:	83 ec 04             	sub    $0x4,%esp
+  8011d2:	68 00 10 00 00       	push   $0x1000
+  8011d7:	53                   	push   %ebx
+  8011d8:	68 00 f0 7f 00       	push   $0x7ff000
+  8011dd:	e8 9d f8 ff ff       	call   800a7f <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  8011e2:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8011e9:	53                   	push   %ebx
+  8011ea:	6a 00                	push   $0x0
+  8011ec:	68 00 f0 7f 00       	push   $0x7ff000
+  8011f1:	6a 00                	push   $0x0
+  8011f3:	e8 f4 fb ff ff       	call   800dec <sys_page_map>
+  8011f8:	83 c4 20             	add    $0x20,%esp
+  8011fb:	85 c0                	test   %eax,%eax
+  8011fd:	78 43                	js     801242 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  8011ff:	83 ec 08             	sub    $0x8,%esp
+  801202:	68 00 f0 7f 00       	push   $0x7ff000
+  801207:	6a 00                	push   $0x0
+  801209:	e8 20 fc ff ff       	call   800e2e <sys_page_unmap>
+  80120e:	83 c4 10             	add    $0x10,%esp
+  801211:	85 c0                	test   %eax,%eax
+  801213:	78 3f                	js     801254 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  801215:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801218:	c9                   	leave
+  801219:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  80121a:	83 ec 0c             	sub    $0xc,%esp
+  80121d:	50                   	push   %eax
+  80121e:	52                   	push   %edx
+  80121f:	68 2a 30 80 00       	push   $0x80302a
+  801224:	6a 19                	push   $0x19
+  801226:	68 3b 30 80 00       	push   $0x80303b
+  80122b:	e8 00 f0 ff ff       	call   800230 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801230:	50                   	push   %eax
+  801231:	68 46 30 80 00       	push   $0x803046
+  801236:	6a 24                	push   $0x24
+  801238:	68 3b 30 80 00       	push   $0x80303b
+  80123d:	e8 ee ef ff ff       	call   800230 <_panic>
+		panic("sys_page_map: %e", r);
+  801242:	50                   	push   %eax
+  801243:	68 59 30 80 00       	push   $0x803059
+  801248:	6a 29                	push   $0x29
+  80124a:	68 3b 30 80 00       	push   $0x80303b
+  80124f:	e8 dc ef ff ff       	call   800230 <_panic>
+		panic("sys_page_unmap: %e", r);
+  801254:	50                   	push   %eax
+  801255:	68 6a 30 80 00       	push   $0x80306a
+  80125a:	6a 2c                	push   $0x2c
+  80125c:	68 3b 30 80 00       	push   $0x80303b
+  801261:	e8 ca ef ff ff       	call   800230 <_panic>
+
+00801266 <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	56                   	push   %esi
+  80126b:	53                   	push   %ebx
+  80126c:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80126f:	68 8b 11 80 00       	push   $0x80118b
+  801274:	e8 85 13 00 00       	call   8025fe <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  801279:	83 c4 08             	add    $0x8,%esp
+  80127c:	6a 01                	push   $0x1
+  80127e:	6a 00                	push   $0x0
+  801280:	e8 9f fa ff ff       	call   800d24 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  801285:	e8 7b fa ff ff       	call   800d05 <sys_fork_cow>
+  80128a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  80128d:	83 c4 10             	add    $0x10,%esp
+  801290:	85 c0                	test   %eax,%eax
+  801292:	74 2c                	je     8012c0 <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  801294:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  801298:	0f 85 8b 01 00 00    	jne    801429 <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80129e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012a3:	cd 30                	int    $0x30
+  8012a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8012a8:	85 c0                	test   %eax,%eax
+  8012aa:	78 30                	js     8012dc <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  8012ac:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8012b1:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8012b6:	74 36                	je     8012ee <fork+0x88>
+  8012b8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8012bb:	e9 99 00 00 00       	jmp    801359 <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8012c0:	e8 02 fa ff ff       	call   800cc7 <sys_getenvid>
+  8012c5:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8012ca:	c1 e0 09             	shl    $0x9,%eax
+  8012cd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8012d2:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  8012d7:	e9 4d 01 00 00       	jmp    801429 <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  8012dc:	50                   	push   %eax
+  8012dd:	68 7d 30 80 00       	push   $0x80307d
+  8012e2:	6a 7d                	push   $0x7d
+  8012e4:	68 3b 30 80 00       	push   $0x80303b
+  8012e9:	e8 42 ef ff ff       	call   800230 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8012ee:	e8 d4 f9 ff ff       	call   800cc7 <sys_getenvid>
+  8012f3:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8012f8:	c1 e0 09             	shl    $0x9,%eax
+  8012fb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801300:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801305:	e9 1f 01 00 00       	jmp    801429 <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  80130a:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801311:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801314:	25 07 0e 00 00       	and    $0xe07,%eax
+  801319:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  80131c:	83 ec 0c             	sub    $0xc,%esp
+  80131f:	50                   	push   %eax
+  801320:	56                   	push   %esi
+  801321:	ff 75 e4             	push   -0x1c(%ebp)
+  801324:	56                   	push   %esi
+  801325:	6a 00                	push   $0x0
+  801327:	e8 c0 fa ff ff       	call   800dec <sys_page_map>
+  80132c:	83 c4 20             	add    $0x20,%esp
+  80132f:	85 c0                	test   %eax,%eax
+  801331:	0f 88 98 00 00 00    	js     8013cf <fork+0x169>
+	if (perm & PTE_COW) {
+  801337:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  80133e:	0f 85 61 01 00 00    	jne    8014a5 <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801344:	83 c7 01             	add    $0x1,%edi
+  801347:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80134d:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  801353:	0f 84 88 00 00 00    	je     8013e1 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  801359:	89 f0                	mov    %esi,%eax
+  80135b:	c1 e8 16             	shr    $0x16,%eax
+  80135e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801365:	25 81 00 00 00       	and    $0x81,%eax
+  80136a:	83 f8 01             	cmp    $0x1,%eax
+  80136d:	75 d5                	jne    801344 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  80136f:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  801376:	a8 01                	test   $0x1,%al
+  801378:	74 ca                	je     801344 <fork+0xde>
+  80137a:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  801380:	74 c2                	je     801344 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  801382:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  801384:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80138b:	f6 c4 04             	test   $0x4,%ah
+  80138e:	0f 85 76 ff ff ff    	jne    80130a <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  801394:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80139b:	a8 02                	test   $0x2,%al
+  80139d:	0f 85 dc 00 00 00    	jne    80147f <fork+0x219>
+  8013a3:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8013aa:	f6 c4 08             	test   $0x8,%ah
+  8013ad:	0f 85 cc 00 00 00    	jne    80147f <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8013b3:	83 ec 0c             	sub    $0xc,%esp
+  8013b6:	6a 05                	push   $0x5
+  8013b8:	56                   	push   %esi
+  8013b9:	ff 75 e4             	push   -0x1c(%ebp)
+  8013bc:	56                   	push   %esi
+  8013bd:	6a 00                	push   $0x0
+  8013bf:	e8 28 fa ff ff       	call   800dec <sys_page_map>
+  8013c4:	83 c4 20             	add    $0x20,%esp
+  8013c7:	85 c0                	test   %eax,%eax
+  8013c9:	0f 89 75 ff ff ff    	jns    801344 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  8013cf:	50                   	push   %eax
+  8013d0:	68 59 30 80 00       	push   $0x803059
+  8013d5:	6a 48                	push   $0x48
+  8013d7:	68 3b 30 80 00       	push   $0x80303b
+  8013dc:	e8 4f ee ff ff       	call   800230 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  8013e1:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8013e4:	83 ec 04             	sub    $0x4,%esp
+  8013e7:	6a 07                	push   $0x7
+  8013e9:	68 00 f0 bf ee       	push   $0xeebff000
+  8013ee:	53                   	push   %ebx
+  8013ef:	e8 72 f9 ff ff       	call   800d66 <sys_page_alloc>
+  8013f4:	83 c4 10             	add    $0x10,%esp
+  8013f7:	85 c0                	test   %eax,%eax
+  8013f9:	78 39                	js     801434 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8013fb:	a1 08 50 80 00       	mov    0x805008,%eax
+  801400:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  801406:	83 ec 08             	sub    $0x8,%esp
+  801409:	50                   	push   %eax
+  80140a:	53                   	push   %ebx
+  80140b:	e8 51 fc ff ff       	call   801061 <sys_env_set_pgfault_upcall>
+  801410:	83 c4 10             	add    $0x10,%esp
+  801413:	85 c0                	test   %eax,%eax
+  801415:	78 36                	js     80144d <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  801417:	83 ec 08             	sub    $0x8,%esp
+  80141a:	6a 02                	push   $0x2
+  80141c:	53                   	push   %ebx
+  80141d:	e8 18 fb ff ff       	call   800f3a <sys_env_set_status>
+  801422:	83 c4 10             	add    $0x10,%esp
+  801425:	85 c0                	test   %eax,%eax
+  801427:	78 3d                	js     801466 <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  801429:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80142c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142f:	5b                   	pop    %ebx
+  801430:	5e                   	pop    %esi
+  801431:	5f                   	pop    %edi
+  801432:	5d                   	pop    %ebp
+  801433:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  801434:	83 ec 0c             	sub    $0xc,%esp
+  801437:	53                   	push   %ebx
+  801438:	50                   	push   %eax
+  801439:	68 a4 30 80 00       	push   $0x8030a4
+  80143e:	68 92 00 00 00       	push   $0x92
+  801443:	68 3b 30 80 00       	push   $0x80303b
+  801448:	e8 e3 ed ff ff       	call   800230 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  80144d:	83 ec 0c             	sub    $0xc,%esp
+  801450:	53                   	push   %ebx
+  801451:	50                   	push   %eax
+  801452:	68 c8 30 80 00       	push   $0x8030c8
+  801457:	68 95 00 00 00       	push   $0x95
+  80145c:	68 3b 30 80 00       	push   $0x80303b
+  801461:	e8 ca ed ff ff       	call   800230 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  801466:	83 ec 0c             	sub    $0xc,%esp
+  801469:	53                   	push   %ebx
+  80146a:	50                   	push   %eax
+  80146b:	68 f8 30 80 00       	push   $0x8030f8
+  801470:	68 98 00 00 00       	push   $0x98
+  801475:	68 3b 30 80 00       	push   $0x80303b
+  80147a:	e8 b1 ed ff ff       	call   800230 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  80147f:	83 ec 0c             	sub    $0xc,%esp
+  801482:	68 05 08 00 00       	push   $0x805
+  801487:	53                   	push   %ebx
+  801488:	ff 75 e4             	push   -0x1c(%ebp)
+  80148b:	53                   	push   %ebx
+  80148c:	6a 00                	push   $0x0
+  80148e:	e8 59 f9 ff ff       	call   800dec <sys_page_map>
+  801493:	83 c4 20             	add    $0x20,%esp
+  801496:	85 c0                	test   %eax,%eax
+  801498:	0f 88 31 ff ff ff    	js     8013cf <fork+0x169>
+		perm |= PTE_COW;
+  80149e:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	ff 75 e0             	push   -0x20(%ebp)
+  8014ab:	53                   	push   %ebx
+  8014ac:	6a 00                	push   $0x0
+  8014ae:	53                   	push   %ebx
+  8014af:	6a 00                	push   $0x0
+  8014b1:	e8 36 f9 ff ff       	call   800dec <sys_page_map>
+  8014b6:	83 c4 20             	add    $0x20,%esp
+  8014b9:	85 c0                	test   %eax,%eax
+  8014bb:	0f 89 83 fe ff ff    	jns    801344 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  8014c1:	50                   	push   %eax
+  8014c2:	68 59 30 80 00       	push   $0x803059
+  8014c7:	6a 4c                	push   $0x4c
+  8014c9:	68 3b 30 80 00       	push   $0x80303b
+  8014ce:	e8 5d ed ff ff       	call   800230 <_panic>
+
+008014d3 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8014d3:	55                   	push   %ebp
+  8014d4:	89 e5                	mov    %esp,%ebp
+  8014d6:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8014d9:	68 8d 30 80 00       	push   $0x80308d
+  8014de:	68 a0 00 00 00       	push   $0xa0
+  8014e3:	68 3b 30 80 00       	push   $0x80303b
+  8014e8:	e8 43 ed ff ff       	call   800230 <_panic>
+
+008014ed <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014f8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014fb:	5d                   	pop    %ebp
+  8014fc:	c3                   	ret
+
+008014fd <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801500:	8b 45 08             	mov    0x8(%ebp),%eax
+  801503:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801508:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80150d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801512:	5d                   	pop    %ebp
+  801513:	c3                   	ret
+
+00801514 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801514:	55                   	push   %ebp
+  801515:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801517:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80151c:	eb 02                	jmp    801520 <fd_alloc+0xc>
+  80151e:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801520:	89 c2                	mov    %eax,%edx
+  801522:	c1 ea 16             	shr    $0x16,%edx
+  801525:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80152c:	f6 c2 01             	test   $0x1,%dl
+  80152f:	74 2b                	je     80155c <fd_alloc+0x48>
+  801531:	89 c2                	mov    %eax,%edx
+  801533:	c1 ea 0c             	shr    $0xc,%edx
+  801536:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80153d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801543:	f6 c1 01             	test   $0x1,%cl
+  801546:	74 14                	je     80155c <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801548:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80154e:	75 ce                	jne    80151e <fd_alloc+0xa>
+  801550:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801555:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80155a:	eb 05                	jmp    801561 <fd_alloc+0x4d>
+			return 0;
+  80155c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801561:	8b 55 08             	mov    0x8(%ebp),%edx
+  801564:	89 02                	mov    %eax,(%edx)
+}
+  801566:	89 c8                	mov    %ecx,%eax
+  801568:	5d                   	pop    %ebp
+  801569:	c3                   	ret
+
+0080156a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80156a:	55                   	push   %ebp
+  80156b:	89 e5                	mov    %esp,%ebp
+  80156d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801570:	83 f8 1f             	cmp    $0x1f,%eax
+  801573:	77 30                	ja     8015a5 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801575:	c1 e0 0c             	shl    $0xc,%eax
+  801578:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80157d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801583:	f6 c2 01             	test   $0x1,%dl
+  801586:	74 24                	je     8015ac <fd_lookup+0x42>
+  801588:	89 c2                	mov    %eax,%edx
+  80158a:	c1 ea 0c             	shr    $0xc,%edx
+  80158d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801594:	f6 c2 01             	test   $0x1,%dl
+  801597:	74 1a                	je     8015b3 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801599:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80159c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80159e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015a3:	5d                   	pop    %ebp
+  8015a4:	c3                   	ret
+		return -E_INVAL;
+  8015a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015aa:	eb f7                	jmp    8015a3 <fd_lookup+0x39>
+		return -E_INVAL;
+  8015ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b1:	eb f0                	jmp    8015a3 <fd_lookup+0x39>
+  8015b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b8:	eb e9                	jmp    8015a3 <fd_lookup+0x39>
+
+008015ba <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015ba:	55                   	push   %ebp
+  8015bb:	89 e5                	mov    %esp,%ebp
+  8015bd:	53                   	push   %ebx
+  8015be:	83 ec 04             	sub    $0x4,%esp
+  8015c1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c9:	eb 03                	jmp    8015ce <dev_lookup+0x14>
+  8015cb:	83 c0 01             	add    $0x1,%eax
+  8015ce:	8b 1c 85 9c 31 80 00 	mov    0x80319c(,%eax,4),%ebx
+  8015d5:	85 db                	test   %ebx,%ebx
+  8015d7:	74 0b                	je     8015e4 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8015d9:	39 13                	cmp    %edx,(%ebx)
+  8015db:	75 ee                	jne    8015cb <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8015dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e2:	eb 1f                	jmp    801603 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015e4:	a1 08 50 80 00       	mov    0x805008,%eax
+  8015e9:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8015ec:	83 ec 04             	sub    $0x4,%esp
+  8015ef:	52                   	push   %edx
+  8015f0:	50                   	push   %eax
+  8015f1:	68 20 31 80 00       	push   $0x803120
+  8015f6:	e8 10 ed ff ff       	call   80030b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015fb:	83 c4 10             	add    $0x10,%esp
+  8015fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801603:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801606:	89 1a                	mov    %ebx,(%edx)
+}
+  801608:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80160b:	c9                   	leave
+  80160c:	c3                   	ret
+
+0080160d <fd_close>:
+{
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	57                   	push   %edi
+  801611:	56                   	push   %esi
+  801612:	53                   	push   %ebx
+  801613:	83 ec 24             	sub    $0x24,%esp
+  801616:	8b 75 08             	mov    0x8(%ebp),%esi
+  801619:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80161c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80161f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801620:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801626:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801629:	50                   	push   %eax
+  80162a:	e8 3b ff ff ff       	call   80156a <fd_lookup>
+  80162f:	89 c3                	mov    %eax,%ebx
+  801631:	83 c4 10             	add    $0x10,%esp
+  801634:	85 c0                	test   %eax,%eax
+  801636:	78 05                	js     80163d <fd_close+0x30>
+	    || fd != fd2)
+  801638:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80163b:	74 16                	je     801653 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80163d:	89 f8                	mov    %edi,%eax
+  80163f:	84 c0                	test   %al,%al
+  801641:	b8 00 00 00 00       	mov    $0x0,%eax
+  801646:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801649:	89 d8                	mov    %ebx,%eax
+  80164b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164e:	5b                   	pop    %ebx
+  80164f:	5e                   	pop    %esi
+  801650:	5f                   	pop    %edi
+  801651:	5d                   	pop    %ebp
+  801652:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801653:	83 ec 08             	sub    $0x8,%esp
+  801656:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801659:	50                   	push   %eax
+  80165a:	ff 36                	push   (%esi)
+  80165c:	e8 59 ff ff ff       	call   8015ba <dev_lookup>
+  801661:	89 c3                	mov    %eax,%ebx
+  801663:	83 c4 10             	add    $0x10,%esp
+  801666:	85 c0                	test   %eax,%eax
+  801668:	78 1a                	js     801684 <fd_close+0x77>
+		if (dev->dev_close)
+  80166a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80166d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801670:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801675:	85 c0                	test   %eax,%eax
+  801677:	74 0b                	je     801684 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801679:	83 ec 0c             	sub    $0xc,%esp
+  80167c:	56                   	push   %esi
+  80167d:	ff d0                	call   *%eax
+  80167f:	89 c3                	mov    %eax,%ebx
+  801681:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801684:	83 ec 08             	sub    $0x8,%esp
+  801687:	56                   	push   %esi
+  801688:	6a 00                	push   $0x0
+  80168a:	e8 9f f7 ff ff       	call   800e2e <sys_page_unmap>
+	return r;
+  80168f:	83 c4 10             	add    $0x10,%esp
+  801692:	eb b5                	jmp    801649 <fd_close+0x3c>
+
+00801694 <close>:
+
+int
+close(int fdnum)
+{
+  801694:	55                   	push   %ebp
+  801695:	89 e5                	mov    %esp,%ebp
+  801697:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80169a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80169d:	50                   	push   %eax
+  80169e:	ff 75 08             	push   0x8(%ebp)
+  8016a1:	e8 c4 fe ff ff       	call   80156a <fd_lookup>
+  8016a6:	83 c4 10             	add    $0x10,%esp
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	79 02                	jns    8016af <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016ad:	c9                   	leave
+  8016ae:	c3                   	ret
+		return fd_close(fd, 1);
+  8016af:	83 ec 08             	sub    $0x8,%esp
+  8016b2:	6a 01                	push   $0x1
+  8016b4:	ff 75 f4             	push   -0xc(%ebp)
+  8016b7:	e8 51 ff ff ff       	call   80160d <fd_close>
+  8016bc:	83 c4 10             	add    $0x10,%esp
+  8016bf:	eb ec                	jmp    8016ad <close+0x19>
+
+008016c1 <close_all>:
+
+void
+close_all(void)
+{
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	53                   	push   %ebx
+  8016c5:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8016c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8016cd:	83 ec 0c             	sub    $0xc,%esp
+  8016d0:	53                   	push   %ebx
+  8016d1:	e8 be ff ff ff       	call   801694 <close>
+	for (i = 0; i < MAXFD; i++)
+  8016d6:	83 c3 01             	add    $0x1,%ebx
+  8016d9:	83 c4 10             	add    $0x10,%esp
+  8016dc:	83 fb 20             	cmp    $0x20,%ebx
+  8016df:	75 ec                	jne    8016cd <close_all+0xc>
+}
+  8016e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+
+008016e6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016e6:	55                   	push   %ebp
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	57                   	push   %edi
+  8016ea:	56                   	push   %esi
+  8016eb:	53                   	push   %ebx
+  8016ec:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016ef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016f2:	50                   	push   %eax
+  8016f3:	ff 75 08             	push   0x8(%ebp)
+  8016f6:	e8 6f fe ff ff       	call   80156a <fd_lookup>
+  8016fb:	89 c3                	mov    %eax,%ebx
+  8016fd:	83 c4 10             	add    $0x10,%esp
+  801700:	85 c0                	test   %eax,%eax
+  801702:	78 7f                	js     801783 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801704:	83 ec 0c             	sub    $0xc,%esp
+  801707:	ff 75 0c             	push   0xc(%ebp)
+  80170a:	e8 85 ff ff ff       	call   801694 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80170f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801712:	c1 e6 0c             	shl    $0xc,%esi
+  801715:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80171b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80171e:	89 3c 24             	mov    %edi,(%esp)
+  801721:	e8 d7 fd ff ff       	call   8014fd <fd2data>
+  801726:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801728:	89 34 24             	mov    %esi,(%esp)
+  80172b:	e8 cd fd ff ff       	call   8014fd <fd2data>
+  801730:	83 c4 10             	add    $0x10,%esp
+  801733:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801736:	89 d8                	mov    %ebx,%eax
+  801738:	c1 e8 16             	shr    $0x16,%eax
+  80173b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801742:	a8 01                	test   $0x1,%al
+  801744:	74 11                	je     801757 <dup+0x71>
+  801746:	89 d8                	mov    %ebx,%eax
+  801748:	c1 e8 0c             	shr    $0xc,%eax
+  80174b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801752:	f6 c2 01             	test   $0x1,%dl
+  801755:	75 36                	jne    80178d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801757:	89 f8                	mov    %edi,%eax
+  801759:	c1 e8 0c             	shr    $0xc,%eax
+  80175c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801763:	83 ec 0c             	sub    $0xc,%esp
+  801766:	25 07 0e 00 00       	and    $0xe07,%eax
+  80176b:	50                   	push   %eax
+  80176c:	56                   	push   %esi
+  80176d:	6a 00                	push   $0x0
+  80176f:	57                   	push   %edi
+  801770:	6a 00                	push   $0x0
+  801772:	e8 75 f6 ff ff       	call   800dec <sys_page_map>
+  801777:	89 c3                	mov    %eax,%ebx
+  801779:	83 c4 20             	add    $0x20,%esp
+  80177c:	85 c0                	test   %eax,%eax
+  80177e:	78 33                	js     8017b3 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801780:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801783:	89 d8                	mov    %ebx,%eax
+  801785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801788:	5b                   	pop    %ebx
+  801789:	5e                   	pop    %esi
+  80178a:	5f                   	pop    %edi
+  80178b:	5d                   	pop    %ebp
+  80178c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80178d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801794:	83 ec 0c             	sub    $0xc,%esp
+  801797:	25 07 0e 00 00       	and    $0xe07,%eax
+  80179c:	50                   	push   %eax
+  80179d:	ff 75 d4             	push   -0x2c(%ebp)
+  8017a0:	6a 00                	push   $0x0
+  8017a2:	53                   	push   %ebx
+  8017a3:	6a 00                	push   $0x0
+  8017a5:	e8 42 f6 ff ff       	call   800dec <sys_page_map>
+  8017aa:	89 c3                	mov    %eax,%ebx
+  8017ac:	83 c4 20             	add    $0x20,%esp
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	79 a4                	jns    801757 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8017b3:	83 ec 08             	sub    $0x8,%esp
+  8017b6:	56                   	push   %esi
+  8017b7:	6a 00                	push   $0x0
+  8017b9:	e8 70 f6 ff ff       	call   800e2e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017be:	83 c4 08             	add    $0x8,%esp
+  8017c1:	ff 75 d4             	push   -0x2c(%ebp)
+  8017c4:	6a 00                	push   $0x0
+  8017c6:	e8 63 f6 ff ff       	call   800e2e <sys_page_unmap>
+	return r;
+  8017cb:	83 c4 10             	add    $0x10,%esp
+  8017ce:	eb b3                	jmp    801783 <dup+0x9d>
+
+008017d0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8017d0:	55                   	push   %ebp
+  8017d1:	89 e5                	mov    %esp,%ebp
+  8017d3:	56                   	push   %esi
+  8017d4:	53                   	push   %ebx
+  8017d5:	83 ec 18             	sub    $0x18,%esp
+  8017d8:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017de:	50                   	push   %eax
+  8017df:	56                   	push   %esi
+  8017e0:	e8 85 fd ff ff       	call   80156a <fd_lookup>
+  8017e5:	83 c4 10             	add    $0x10,%esp
+  8017e8:	85 c0                	test   %eax,%eax
+  8017ea:	78 3c                	js     801828 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017ec:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017ef:	83 ec 08             	sub    $0x8,%esp
+  8017f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f5:	50                   	push   %eax
+  8017f6:	ff 33                	push   (%ebx)
+  8017f8:	e8 bd fd ff ff       	call   8015ba <dev_lookup>
+  8017fd:	83 c4 10             	add    $0x10,%esp
+  801800:	85 c0                	test   %eax,%eax
+  801802:	78 24                	js     801828 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801804:	8b 43 08             	mov    0x8(%ebx),%eax
+  801807:	83 e0 03             	and    $0x3,%eax
+  80180a:	83 f8 01             	cmp    $0x1,%eax
+  80180d:	74 20                	je     80182f <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80180f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801812:	8b 40 08             	mov    0x8(%eax),%eax
+  801815:	85 c0                	test   %eax,%eax
+  801817:	74 37                	je     801850 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801819:	83 ec 04             	sub    $0x4,%esp
+  80181c:	ff 75 10             	push   0x10(%ebp)
+  80181f:	ff 75 0c             	push   0xc(%ebp)
+  801822:	53                   	push   %ebx
+  801823:	ff d0                	call   *%eax
+  801825:	83 c4 10             	add    $0x10,%esp
+}
+  801828:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182b:	5b                   	pop    %ebx
+  80182c:	5e                   	pop    %esi
+  80182d:	5d                   	pop    %ebp
+  80182e:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80182f:	a1 08 50 80 00       	mov    0x805008,%eax
+  801834:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801837:	83 ec 04             	sub    $0x4,%esp
+  80183a:	56                   	push   %esi
+  80183b:	50                   	push   %eax
+  80183c:	68 61 31 80 00       	push   $0x803161
+  801841:	e8 c5 ea ff ff       	call   80030b <cprintf>
+		return -E_INVAL;
+  801846:	83 c4 10             	add    $0x10,%esp
+  801849:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184e:	eb d8                	jmp    801828 <read+0x58>
+		return -E_NOT_SUPP;
+  801850:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801855:	eb d1                	jmp    801828 <read+0x58>
+
+00801857 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801857:	55                   	push   %ebp
+  801858:	89 e5                	mov    %esp,%ebp
+  80185a:	57                   	push   %edi
+  80185b:	56                   	push   %esi
+  80185c:	53                   	push   %ebx
+  80185d:	83 ec 0c             	sub    $0xc,%esp
+  801860:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801863:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801866:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186b:	eb 02                	jmp    80186f <readn+0x18>
+  80186d:	01 c3                	add    %eax,%ebx
+  80186f:	39 f3                	cmp    %esi,%ebx
+  801871:	73 21                	jae    801894 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801873:	83 ec 04             	sub    $0x4,%esp
+  801876:	89 f0                	mov    %esi,%eax
+  801878:	29 d8                	sub    %ebx,%eax
+  80187a:	50                   	push   %eax
+  80187b:	89 d8                	mov    %ebx,%eax
+  80187d:	03 45 0c             	add    0xc(%ebp),%eax
+  801880:	50                   	push   %eax
+  801881:	57                   	push   %edi
+  801882:	e8 49 ff ff ff       	call   8017d0 <read>
+		if (m < 0)
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	85 c0                	test   %eax,%eax
+  80188c:	78 04                	js     801892 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80188e:	75 dd                	jne    80186d <readn+0x16>
+  801890:	eb 02                	jmp    801894 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801892:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801894:	89 d8                	mov    %ebx,%eax
+  801896:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801899:	5b                   	pop    %ebx
+  80189a:	5e                   	pop    %esi
+  80189b:	5f                   	pop    %edi
+  80189c:	5d                   	pop    %ebp
+  80189d:	c3                   	ret
+
+0080189e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80189e:	55                   	push   %ebp
+  80189f:	89 e5                	mov    %esp,%ebp
+  8018a1:	56                   	push   %esi
+  8018a2:	53                   	push   %ebx
+  8018a3:	83 ec 18             	sub    $0x18,%esp
+  8018a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018a9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ac:	50                   	push   %eax
+  8018ad:	53                   	push   %ebx
+  8018ae:	e8 b7 fc ff ff       	call   80156a <fd_lookup>
+  8018b3:	83 c4 10             	add    $0x10,%esp
+  8018b6:	85 c0                	test   %eax,%eax
+  8018b8:	78 37                	js     8018f1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018ba:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018bd:	83 ec 08             	sub    $0x8,%esp
+  8018c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c3:	50                   	push   %eax
+  8018c4:	ff 36                	push   (%esi)
+  8018c6:	e8 ef fc ff ff       	call   8015ba <dev_lookup>
+  8018cb:	83 c4 10             	add    $0x10,%esp
+  8018ce:	85 c0                	test   %eax,%eax
+  8018d0:	78 1f                	js     8018f1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018d2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018d6:	74 20                	je     8018f8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8018d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018db:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018de:	85 c0                	test   %eax,%eax
+  8018e0:	74 37                	je     801919 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018e2:	83 ec 04             	sub    $0x4,%esp
+  8018e5:	ff 75 10             	push   0x10(%ebp)
+  8018e8:	ff 75 0c             	push   0xc(%ebp)
+  8018eb:	56                   	push   %esi
+  8018ec:	ff d0                	call   *%eax
+  8018ee:	83 c4 10             	add    $0x10,%esp
+}
+  8018f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018f4:	5b                   	pop    %ebx
+  8018f5:	5e                   	pop    %esi
+  8018f6:	5d                   	pop    %ebp
+  8018f7:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018f8:	a1 08 50 80 00       	mov    0x805008,%eax
+  8018fd:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801900:	83 ec 04             	sub    $0x4,%esp
+  801903:	53                   	push   %ebx
+  801904:	50                   	push   %eax
+  801905:	68 7d 31 80 00       	push   $0x80317d
+  80190a:	e8 fc e9 ff ff       	call   80030b <cprintf>
+		return -E_INVAL;
+  80190f:	83 c4 10             	add    $0x10,%esp
+  801912:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801917:	eb d8                	jmp    8018f1 <write+0x53>
+		return -E_NOT_SUPP;
+  801919:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80191e:	eb d1                	jmp    8018f1 <write+0x53>
+
+00801920 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801920:	55                   	push   %ebp
+  801921:	89 e5                	mov    %esp,%ebp
+  801923:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801926:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801929:	50                   	push   %eax
+  80192a:	ff 75 08             	push   0x8(%ebp)
+  80192d:	e8 38 fc ff ff       	call   80156a <fd_lookup>
+  801932:	83 c4 10             	add    $0x10,%esp
+  801935:	85 c0                	test   %eax,%eax
+  801937:	78 0e                	js     801947 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801939:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80193c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80193f:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801942:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801947:	c9                   	leave
+  801948:	c3                   	ret
+
+00801949 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	56                   	push   %esi
+  80194d:	53                   	push   %ebx
+  80194e:	83 ec 18             	sub    $0x18,%esp
+  801951:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801954:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801957:	50                   	push   %eax
+  801958:	53                   	push   %ebx
+  801959:	e8 0c fc ff ff       	call   80156a <fd_lookup>
+  80195e:	83 c4 10             	add    $0x10,%esp
+  801961:	85 c0                	test   %eax,%eax
+  801963:	78 34                	js     801999 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801965:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801968:	83 ec 08             	sub    $0x8,%esp
+  80196b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80196e:	50                   	push   %eax
+  80196f:	ff 36                	push   (%esi)
+  801971:	e8 44 fc ff ff       	call   8015ba <dev_lookup>
+  801976:	83 c4 10             	add    $0x10,%esp
+  801979:	85 c0                	test   %eax,%eax
+  80197b:	78 1c                	js     801999 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80197d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801981:	74 1d                	je     8019a0 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801983:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801986:	8b 40 18             	mov    0x18(%eax),%eax
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	74 34                	je     8019c1 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80198d:	83 ec 08             	sub    $0x8,%esp
+  801990:	ff 75 0c             	push   0xc(%ebp)
+  801993:	56                   	push   %esi
+  801994:	ff d0                	call   *%eax
+  801996:	83 c4 10             	add    $0x10,%esp
+}
+  801999:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80199c:	5b                   	pop    %ebx
+  80199d:	5e                   	pop    %esi
+  80199e:	5d                   	pop    %ebp
+  80199f:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8019a0:	a1 08 50 80 00       	mov    0x805008,%eax
+  8019a5:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019a8:	83 ec 04             	sub    $0x4,%esp
+  8019ab:	53                   	push   %ebx
+  8019ac:	50                   	push   %eax
+  8019ad:	68 40 31 80 00       	push   $0x803140
+  8019b2:	e8 54 e9 ff ff       	call   80030b <cprintf>
+		return -E_INVAL;
+  8019b7:	83 c4 10             	add    $0x10,%esp
+  8019ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019bf:	eb d8                	jmp    801999 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8019c1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019c6:	eb d1                	jmp    801999 <ftruncate+0x50>
+
+008019c8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8019c8:	55                   	push   %ebp
+  8019c9:	89 e5                	mov    %esp,%ebp
+  8019cb:	56                   	push   %esi
+  8019cc:	53                   	push   %ebx
+  8019cd:	83 ec 18             	sub    $0x18,%esp
+  8019d0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019d3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019d6:	50                   	push   %eax
+  8019d7:	ff 75 08             	push   0x8(%ebp)
+  8019da:	e8 8b fb ff ff       	call   80156a <fd_lookup>
+  8019df:	83 c4 10             	add    $0x10,%esp
+  8019e2:	85 c0                	test   %eax,%eax
+  8019e4:	78 49                	js     801a2f <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019e6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019e9:	83 ec 08             	sub    $0x8,%esp
+  8019ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ef:	50                   	push   %eax
+  8019f0:	ff 36                	push   (%esi)
+  8019f2:	e8 c3 fb ff ff       	call   8015ba <dev_lookup>
+  8019f7:	83 c4 10             	add    $0x10,%esp
+  8019fa:	85 c0                	test   %eax,%eax
+  8019fc:	78 31                	js     801a2f <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8019fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a01:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a05:	74 2f                	je     801a36 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a07:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a0a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a11:	00 00 00 
+	stat->st_isdir = 0;
+  801a14:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a1b:	00 00 00 
+	stat->st_dev = dev;
+  801a1e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a24:	83 ec 08             	sub    $0x8,%esp
+  801a27:	53                   	push   %ebx
+  801a28:	56                   	push   %esi
+  801a29:	ff 50 14             	call   *0x14(%eax)
+  801a2c:	83 c4 10             	add    $0x10,%esp
+}
+  801a2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a32:	5b                   	pop    %ebx
+  801a33:	5e                   	pop    %esi
+  801a34:	5d                   	pop    %ebp
+  801a35:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a36:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a3b:	eb f2                	jmp    801a2f <fstat+0x67>
+
+00801a3d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a3d:	55                   	push   %ebp
+  801a3e:	89 e5                	mov    %esp,%ebp
+  801a40:	56                   	push   %esi
+  801a41:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a42:	83 ec 08             	sub    $0x8,%esp
+  801a45:	6a 00                	push   $0x0
+  801a47:	ff 75 08             	push   0x8(%ebp)
+  801a4a:	e8 e4 01 00 00       	call   801c33 <open>
+  801a4f:	89 c3                	mov    %eax,%ebx
+  801a51:	83 c4 10             	add    $0x10,%esp
+  801a54:	85 c0                	test   %eax,%eax
+  801a56:	78 1b                	js     801a73 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801a58:	83 ec 08             	sub    $0x8,%esp
+  801a5b:	ff 75 0c             	push   0xc(%ebp)
+  801a5e:	50                   	push   %eax
+  801a5f:	e8 64 ff ff ff       	call   8019c8 <fstat>
+  801a64:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a66:	89 1c 24             	mov    %ebx,(%esp)
+  801a69:	e8 26 fc ff ff       	call   801694 <close>
+	return r;
+  801a6e:	83 c4 10             	add    $0x10,%esp
+  801a71:	89 f3                	mov    %esi,%ebx
+}
+  801a73:	89 d8                	mov    %ebx,%eax
+  801a75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a78:	5b                   	pop    %ebx
+  801a79:	5e                   	pop    %esi
+  801a7a:	5d                   	pop    %ebp
+  801a7b:	c3                   	ret
+
+00801a7c <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a7c:	55                   	push   %ebp
+  801a7d:	89 e5                	mov    %esp,%ebp
+  801a7f:	56                   	push   %esi
+  801a80:	53                   	push   %ebx
+  801a81:	89 c6                	mov    %eax,%esi
+  801a83:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801a85:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801a8c:	74 27                	je     801ab5 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a8e:	6a 07                	push   $0x7
+  801a90:	68 00 60 80 00       	push   $0x806000
+  801a95:	56                   	push   %esi
+  801a96:	ff 35 00 50 80 00    	push   0x805000
+  801a9c:	e8 66 0c 00 00       	call   802707 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801aa1:	83 c4 0c             	add    $0xc,%esp
+  801aa4:	6a 00                	push   $0x0
+  801aa6:	53                   	push   %ebx
+  801aa7:	6a 00                	push   $0x0
+  801aa9:	e8 e1 0b 00 00       	call   80268f <ipc_recv>
+}
+  801aae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab1:	5b                   	pop    %ebx
+  801ab2:	5e                   	pop    %esi
+  801ab3:	5d                   	pop    %ebp
+  801ab4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ab5:	83 ec 0c             	sub    $0xc,%esp
+  801ab8:	6a 01                	push   $0x1
+  801aba:	e8 9c 0c 00 00       	call   80275b <ipc_find_env>
+  801abf:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ac4:	83 c4 10             	add    $0x10,%esp
+  801ac7:	eb c5                	jmp    801a8e <fsipc+0x12>
+
+00801ac9 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ac9:	55                   	push   %ebp
+  801aca:	89 e5                	mov    %esp,%ebp
+  801acc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801acf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ad5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801ada:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801add:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ae2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae7:	b8 02 00 00 00       	mov    $0x2,%eax
+  801aec:	e8 8b ff ff ff       	call   801a7c <fsipc>
+}
+  801af1:	c9                   	leave
+  801af2:	c3                   	ret
+
+00801af3 <devfile_flush>:
+{
+  801af3:	55                   	push   %ebp
+  801af4:	89 e5                	mov    %esp,%ebp
+  801af6:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801afc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aff:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801b04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b09:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b0e:	e8 69 ff ff ff       	call   801a7c <fsipc>
+}
+  801b13:	c9                   	leave
+  801b14:	c3                   	ret
+
+00801b15 <devfile_stat>:
+{
+  801b15:	55                   	push   %ebp
+  801b16:	89 e5                	mov    %esp,%ebp
+  801b18:	53                   	push   %ebx
+  801b19:	83 ec 04             	sub    $0x4,%esp
+  801b1c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b22:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b25:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b34:	e8 43 ff ff ff       	call   801a7c <fsipc>
+  801b39:	85 c0                	test   %eax,%eax
+  801b3b:	78 2c                	js     801b69 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b3d:	83 ec 08             	sub    $0x8,%esp
+  801b40:	68 00 60 80 00       	push   $0x806000
+  801b45:	53                   	push   %ebx
+  801b46:	e8 ae ed ff ff       	call   8008f9 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b4b:	a1 80 60 80 00       	mov    0x806080,%eax
+  801b50:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b56:	a1 84 60 80 00       	mov    0x806084,%eax
+  801b5b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801b61:	83 c4 10             	add    $0x10,%esp
+  801b64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b6c:	c9                   	leave
+  801b6d:	c3                   	ret
+
+00801b6e <devfile_write>:
+{
+  801b6e:	55                   	push   %ebp
+  801b6f:	89 e5                	mov    %esp,%ebp
+  801b71:	83 ec 0c             	sub    $0xc,%esp
+  801b74:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801b77:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801b7c:	39 d0                	cmp    %edx,%eax
+  801b7e:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b81:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b84:	8b 52 0c             	mov    0xc(%edx),%edx
+  801b87:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801b8d:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801b92:	50                   	push   %eax
+  801b93:	ff 75 0c             	push   0xc(%ebp)
+  801b96:	68 08 60 80 00       	push   $0x806008
+  801b9b:	e8 df ee ff ff       	call   800a7f <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801ba0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba5:	b8 04 00 00 00       	mov    $0x4,%eax
+  801baa:	e8 cd fe ff ff       	call   801a7c <fsipc>
+}
+  801baf:	c9                   	leave
+  801bb0:	c3                   	ret
+
+00801bb1 <devfile_read>:
+{
+  801bb1:	55                   	push   %ebp
+  801bb2:	89 e5                	mov    %esp,%ebp
+  801bb4:	56                   	push   %esi
+  801bb5:	53                   	push   %ebx
+  801bb6:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bbc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bbf:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801bc4:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801bca:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcf:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bd4:	e8 a3 fe ff ff       	call   801a7c <fsipc>
+  801bd9:	89 c3                	mov    %eax,%ebx
+  801bdb:	85 c0                	test   %eax,%eax
+  801bdd:	78 1f                	js     801bfe <devfile_read+0x4d>
+	assert(r <= n);
+  801bdf:	39 c6                	cmp    %eax,%esi
+  801be1:	72 24                	jb     801c07 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801be3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801be8:	7f 33                	jg     801c1d <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801bea:	83 ec 04             	sub    $0x4,%esp
+  801bed:	50                   	push   %eax
+  801bee:	68 00 60 80 00       	push   $0x806000
+  801bf3:	ff 75 0c             	push   0xc(%ebp)
+  801bf6:	e8 84 ee ff ff       	call   800a7f <memmove>
+	return r;
+  801bfb:	83 c4 10             	add    $0x10,%esp
+}
+  801bfe:	89 d8                	mov    %ebx,%eax
+  801c00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c03:	5b                   	pop    %ebx
+  801c04:	5e                   	pop    %esi
+  801c05:	5d                   	pop    %ebp
+  801c06:	c3                   	ret
+	assert(r <= n);
+  801c07:	68 b0 31 80 00       	push   $0x8031b0
+  801c0c:	68 b7 31 80 00       	push   $0x8031b7
+  801c11:	6a 7c                	push   $0x7c
+  801c13:	68 cc 31 80 00       	push   $0x8031cc
+  801c18:	e8 13 e6 ff ff       	call   800230 <_panic>
+	assert(r <= PGSIZE);
+  801c1d:	68 d7 31 80 00       	push   $0x8031d7
+  801c22:	68 b7 31 80 00       	push   $0x8031b7
+  801c27:	6a 7d                	push   $0x7d
+  801c29:	68 cc 31 80 00       	push   $0x8031cc
+  801c2e:	e8 fd e5 ff ff       	call   800230 <_panic>
+
+00801c33 <open>:
+{
+  801c33:	55                   	push   %ebp
+  801c34:	89 e5                	mov    %esp,%ebp
+  801c36:	56                   	push   %esi
+  801c37:	53                   	push   %ebx
+  801c38:	83 ec 1c             	sub    $0x1c,%esp
+  801c3b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801c3e:	56                   	push   %esi
+  801c3f:	e8 7a ec ff ff       	call   8008be <strlen>
+  801c44:	83 c4 10             	add    $0x10,%esp
+  801c47:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c4c:	7f 6c                	jg     801cba <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801c4e:	83 ec 0c             	sub    $0xc,%esp
+  801c51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c54:	50                   	push   %eax
+  801c55:	e8 ba f8 ff ff       	call   801514 <fd_alloc>
+  801c5a:	89 c3                	mov    %eax,%ebx
+  801c5c:	83 c4 10             	add    $0x10,%esp
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	78 3c                	js     801c9f <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801c63:	83 ec 08             	sub    $0x8,%esp
+  801c66:	56                   	push   %esi
+  801c67:	68 00 60 80 00       	push   $0x806000
+  801c6c:	e8 88 ec ff ff       	call   8008f9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801c71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c74:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801c79:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c7c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c81:	e8 f6 fd ff ff       	call   801a7c <fsipc>
+  801c86:	89 c3                	mov    %eax,%ebx
+  801c88:	83 c4 10             	add    $0x10,%esp
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 19                	js     801ca8 <open+0x75>
+	return fd2num(fd);
+  801c8f:	83 ec 0c             	sub    $0xc,%esp
+  801c92:	ff 75 f4             	push   -0xc(%ebp)
+  801c95:	e8 53 f8 ff ff       	call   8014ed <fd2num>
+  801c9a:	89 c3                	mov    %eax,%ebx
+  801c9c:	83 c4 10             	add    $0x10,%esp
+}
+  801c9f:	89 d8                	mov    %ebx,%eax
+  801ca1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ca4:	5b                   	pop    %ebx
+  801ca5:	5e                   	pop    %esi
+  801ca6:	5d                   	pop    %ebp
+  801ca7:	c3                   	ret
+		fd_close(fd, 0);
+  801ca8:	83 ec 08             	sub    $0x8,%esp
+  801cab:	6a 00                	push   $0x0
+  801cad:	ff 75 f4             	push   -0xc(%ebp)
+  801cb0:	e8 58 f9 ff ff       	call   80160d <fd_close>
+		return r;
+  801cb5:	83 c4 10             	add    $0x10,%esp
+  801cb8:	eb e5                	jmp    801c9f <open+0x6c>
+		return -E_BAD_PATH;
+  801cba:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801cbf:	eb de                	jmp    801c9f <open+0x6c>
+
+00801cc1 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801cc1:	55                   	push   %ebp
+  801cc2:	89 e5                	mov    %esp,%ebp
+  801cc4:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801cc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ccc:	b8 08 00 00 00       	mov    $0x8,%eax
+  801cd1:	e8 a6 fd ff ff       	call   801a7c <fsipc>
+}
+  801cd6:	c9                   	leave
+  801cd7:	c3                   	ret
+
+00801cd8 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cd8:	55                   	push   %ebp
+  801cd9:	89 e5                	mov    %esp,%ebp
+  801cdb:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801cde:	68 e3 31 80 00       	push   $0x8031e3
+  801ce3:	ff 75 0c             	push   0xc(%ebp)
+  801ce6:	e8 0e ec ff ff       	call   8008f9 <strcpy>
+	return 0;
+}
+  801ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf0:	c9                   	leave
+  801cf1:	c3                   	ret
+
+00801cf2 <devsock_close>:
+{
+  801cf2:	55                   	push   %ebp
+  801cf3:	89 e5                	mov    %esp,%ebp
+  801cf5:	53                   	push   %ebx
+  801cf6:	83 ec 10             	sub    $0x10,%esp
+  801cf9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801cfc:	53                   	push   %ebx
+  801cfd:	e8 69 0a 00 00       	call   80276b <pageref>
+  801d02:	89 c2                	mov    %eax,%edx
+  801d04:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d07:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801d0c:	83 fa 01             	cmp    $0x1,%edx
+  801d0f:	74 05                	je     801d16 <devsock_close+0x24>
+}
+  801d11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d14:	c9                   	leave
+  801d15:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801d16:	83 ec 0c             	sub    $0xc,%esp
+  801d19:	ff 73 0c             	push   0xc(%ebx)
+  801d1c:	e8 b7 02 00 00       	call   801fd8 <nsipc_close>
+  801d21:	83 c4 10             	add    $0x10,%esp
+  801d24:	eb eb                	jmp    801d11 <devsock_close+0x1f>
+
+00801d26 <devsock_write>:
+{
+  801d26:	55                   	push   %ebp
+  801d27:	89 e5                	mov    %esp,%ebp
+  801d29:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801d2c:	6a 00                	push   $0x0
+  801d2e:	ff 75 10             	push   0x10(%ebp)
+  801d31:	ff 75 0c             	push   0xc(%ebp)
+  801d34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d37:	ff 70 0c             	push   0xc(%eax)
+  801d3a:	e8 79 03 00 00       	call   8020b8 <nsipc_send>
+}
+  801d3f:	c9                   	leave
+  801d40:	c3                   	ret
+
+00801d41 <devsock_read>:
+{
+  801d41:	55                   	push   %ebp
+  801d42:	89 e5                	mov    %esp,%ebp
+  801d44:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801d47:	6a 00                	push   $0x0
+  801d49:	ff 75 10             	push   0x10(%ebp)
+  801d4c:	ff 75 0c             	push   0xc(%ebp)
+  801d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d52:	ff 70 0c             	push   0xc(%eax)
+  801d55:	e8 ef 02 00 00       	call   802049 <nsipc_recv>
+}
+  801d5a:	c9                   	leave
+  801d5b:	c3                   	ret
+
+00801d5c <fd2sockid>:
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d62:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d65:	52                   	push   %edx
+  801d66:	50                   	push   %eax
+  801d67:	e8 fe f7 ff ff       	call   80156a <fd_lookup>
+  801d6c:	83 c4 10             	add    $0x10,%esp
+  801d6f:	85 c0                	test   %eax,%eax
+  801d71:	78 10                	js     801d83 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d76:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801d7c:	39 08                	cmp    %ecx,(%eax)
+  801d7e:	75 05                	jne    801d85 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d80:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d83:	c9                   	leave
+  801d84:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d85:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d8a:	eb f7                	jmp    801d83 <fd2sockid+0x27>
+
+00801d8c <alloc_sockfd>:
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	56                   	push   %esi
+  801d90:	53                   	push   %ebx
+  801d91:	83 ec 1c             	sub    $0x1c,%esp
+  801d94:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d96:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d99:	50                   	push   %eax
+  801d9a:	e8 75 f7 ff ff       	call   801514 <fd_alloc>
+  801d9f:	89 c3                	mov    %eax,%ebx
+  801da1:	83 c4 10             	add    $0x10,%esp
+  801da4:	85 c0                	test   %eax,%eax
+  801da6:	78 43                	js     801deb <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801da8:	83 ec 04             	sub    $0x4,%esp
+  801dab:	68 07 04 00 00       	push   $0x407
+  801db0:	ff 75 f4             	push   -0xc(%ebp)
+  801db3:	6a 00                	push   $0x0
+  801db5:	e8 ac ef ff ff       	call   800d66 <sys_page_alloc>
+  801dba:	89 c3                	mov    %eax,%ebx
+  801dbc:	83 c4 10             	add    $0x10,%esp
+  801dbf:	85 c0                	test   %eax,%eax
+  801dc1:	78 28                	js     801deb <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801dc3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc6:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801dcc:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801dce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dd1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801dd8:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801ddb:	83 ec 0c             	sub    $0xc,%esp
+  801dde:	50                   	push   %eax
+  801ddf:	e8 09 f7 ff ff       	call   8014ed <fd2num>
+  801de4:	89 c3                	mov    %eax,%ebx
+  801de6:	83 c4 10             	add    $0x10,%esp
+  801de9:	eb 0c                	jmp    801df7 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801deb:	83 ec 0c             	sub    $0xc,%esp
+  801dee:	56                   	push   %esi
+  801def:	e8 e4 01 00 00       	call   801fd8 <nsipc_close>
+		return r;
+  801df4:	83 c4 10             	add    $0x10,%esp
+}
+  801df7:	89 d8                	mov    %ebx,%eax
+  801df9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfc:	5b                   	pop    %ebx
+  801dfd:	5e                   	pop    %esi
+  801dfe:	5d                   	pop    %ebp
+  801dff:	c3                   	ret
+
+00801e00 <accept>:
+{
+  801e00:	55                   	push   %ebp
+  801e01:	89 e5                	mov    %esp,%ebp
+  801e03:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e06:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e09:	e8 4e ff ff ff       	call   801d5c <fd2sockid>
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 1b                	js     801e2d <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801e12:	83 ec 04             	sub    $0x4,%esp
+  801e15:	ff 75 10             	push   0x10(%ebp)
+  801e18:	ff 75 0c             	push   0xc(%ebp)
+  801e1b:	50                   	push   %eax
+  801e1c:	e8 0e 01 00 00       	call   801f2f <nsipc_accept>
+  801e21:	83 c4 10             	add    $0x10,%esp
+  801e24:	85 c0                	test   %eax,%eax
+  801e26:	78 05                	js     801e2d <accept+0x2d>
+	return alloc_sockfd(r);
+  801e28:	e8 5f ff ff ff       	call   801d8c <alloc_sockfd>
+}
+  801e2d:	c9                   	leave
+  801e2e:	c3                   	ret
+
+00801e2f <bind>:
+{
+  801e2f:	55                   	push   %ebp
+  801e30:	89 e5                	mov    %esp,%ebp
+  801e32:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e38:	e8 1f ff ff ff       	call   801d5c <fd2sockid>
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	78 12                	js     801e53 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e41:	83 ec 04             	sub    $0x4,%esp
+  801e44:	ff 75 10             	push   0x10(%ebp)
+  801e47:	ff 75 0c             	push   0xc(%ebp)
+  801e4a:	50                   	push   %eax
+  801e4b:	e8 31 01 00 00       	call   801f81 <nsipc_bind>
+  801e50:	83 c4 10             	add    $0x10,%esp
+}
+  801e53:	c9                   	leave
+  801e54:	c3                   	ret
+
+00801e55 <shutdown>:
+{
+  801e55:	55                   	push   %ebp
+  801e56:	89 e5                	mov    %esp,%ebp
+  801e58:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e5e:	e8 f9 fe ff ff       	call   801d5c <fd2sockid>
+  801e63:	85 c0                	test   %eax,%eax
+  801e65:	78 0f                	js     801e76 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e67:	83 ec 08             	sub    $0x8,%esp
+  801e6a:	ff 75 0c             	push   0xc(%ebp)
+  801e6d:	50                   	push   %eax
+  801e6e:	e8 43 01 00 00       	call   801fb6 <nsipc_shutdown>
+  801e73:	83 c4 10             	add    $0x10,%esp
+}
+  801e76:	c9                   	leave
+  801e77:	c3                   	ret
+
+00801e78 <connect>:
+{
+  801e78:	55                   	push   %ebp
+  801e79:	89 e5                	mov    %esp,%ebp
+  801e7b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e81:	e8 d6 fe ff ff       	call   801d5c <fd2sockid>
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	78 12                	js     801e9c <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e8a:	83 ec 04             	sub    $0x4,%esp
+  801e8d:	ff 75 10             	push   0x10(%ebp)
+  801e90:	ff 75 0c             	push   0xc(%ebp)
+  801e93:	50                   	push   %eax
+  801e94:	e8 59 01 00 00       	call   801ff2 <nsipc_connect>
+  801e99:	83 c4 10             	add    $0x10,%esp
+}
+  801e9c:	c9                   	leave
+  801e9d:	c3                   	ret
+
+00801e9e <listen>:
+{
+  801e9e:	55                   	push   %ebp
+  801e9f:	89 e5                	mov    %esp,%ebp
+  801ea1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea7:	e8 b0 fe ff ff       	call   801d5c <fd2sockid>
+  801eac:	85 c0                	test   %eax,%eax
+  801eae:	78 0f                	js     801ebf <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801eb0:	83 ec 08             	sub    $0x8,%esp
+  801eb3:	ff 75 0c             	push   0xc(%ebp)
+  801eb6:	50                   	push   %eax
+  801eb7:	e8 6b 01 00 00       	call   802027 <nsipc_listen>
+  801ebc:	83 c4 10             	add    $0x10,%esp
+}
+  801ebf:	c9                   	leave
+  801ec0:	c3                   	ret
+
+00801ec1 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801ec1:	55                   	push   %ebp
+  801ec2:	89 e5                	mov    %esp,%ebp
+  801ec4:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801ec7:	ff 75 10             	push   0x10(%ebp)
+  801eca:	ff 75 0c             	push   0xc(%ebp)
+  801ecd:	ff 75 08             	push   0x8(%ebp)
+  801ed0:	e8 41 02 00 00       	call   802116 <nsipc_socket>
+  801ed5:	83 c4 10             	add    $0x10,%esp
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	78 05                	js     801ee1 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801edc:	e8 ab fe ff ff       	call   801d8c <alloc_sockfd>
+}
+  801ee1:	c9                   	leave
+  801ee2:	c3                   	ret
+
+00801ee3 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801ee3:	55                   	push   %ebp
+  801ee4:	89 e5                	mov    %esp,%ebp
+  801ee6:	53                   	push   %ebx
+  801ee7:	83 ec 04             	sub    $0x4,%esp
+  801eea:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801eec:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801ef3:	74 26                	je     801f1b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801ef5:	6a 07                	push   $0x7
+  801ef7:	68 00 70 80 00       	push   $0x807000
+  801efc:	53                   	push   %ebx
+  801efd:	ff 35 04 50 80 00    	push   0x805004
+  801f03:	e8 ff 07 00 00       	call   802707 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f08:	83 c4 0c             	add    $0xc,%esp
+  801f0b:	6a 00                	push   $0x0
+  801f0d:	6a 00                	push   $0x0
+  801f0f:	6a 00                	push   $0x0
+  801f11:	e8 79 07 00 00       	call   80268f <ipc_recv>
+}
+  801f16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f19:	c9                   	leave
+  801f1a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f1b:	83 ec 0c             	sub    $0xc,%esp
+  801f1e:	6a 02                	push   $0x2
+  801f20:	e8 36 08 00 00       	call   80275b <ipc_find_env>
+  801f25:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f2a:	83 c4 10             	add    $0x10,%esp
+  801f2d:	eb c6                	jmp    801ef5 <nsipc+0x12>
+
+00801f2f <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801f2f:	55                   	push   %ebp
+  801f30:	89 e5                	mov    %esp,%ebp
+  801f32:	56                   	push   %esi
+  801f33:	53                   	push   %ebx
+  801f34:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801f37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801f3f:	8b 06                	mov    (%esi),%eax
+  801f41:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801f46:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f4b:	e8 93 ff ff ff       	call   801ee3 <nsipc>
+  801f50:	89 c3                	mov    %eax,%ebx
+  801f52:	85 c0                	test   %eax,%eax
+  801f54:	79 09                	jns    801f5f <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801f56:	89 d8                	mov    %ebx,%eax
+  801f58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f5b:	5b                   	pop    %ebx
+  801f5c:	5e                   	pop    %esi
+  801f5d:	5d                   	pop    %ebp
+  801f5e:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801f5f:	83 ec 04             	sub    $0x4,%esp
+  801f62:	ff 35 10 70 80 00    	push   0x807010
+  801f68:	68 00 70 80 00       	push   $0x807000
+  801f6d:	ff 75 0c             	push   0xc(%ebp)
+  801f70:	e8 0a eb ff ff       	call   800a7f <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f75:	a1 10 70 80 00       	mov    0x807010,%eax
+  801f7a:	89 06                	mov    %eax,(%esi)
+  801f7c:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f7f:	eb d5                	jmp    801f56 <nsipc_accept+0x27>
+
+00801f81 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f81:	55                   	push   %ebp
+  801f82:	89 e5                	mov    %esp,%ebp
+  801f84:	53                   	push   %ebx
+  801f85:	83 ec 08             	sub    $0x8,%esp
+  801f88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8e:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f93:	53                   	push   %ebx
+  801f94:	ff 75 0c             	push   0xc(%ebp)
+  801f97:	68 04 70 80 00       	push   $0x807004
+  801f9c:	e8 de ea ff ff       	call   800a7f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801fa1:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801fa7:	b8 02 00 00 00       	mov    $0x2,%eax
+  801fac:	e8 32 ff ff ff       	call   801ee3 <nsipc>
+}
+  801fb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb4:	c9                   	leave
+  801fb5:	c3                   	ret
+
+00801fb6 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801fb6:	55                   	push   %ebp
+  801fb7:	89 e5                	mov    %esp,%ebp
+  801fb9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801fbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbf:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801fc4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc7:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801fcc:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fd1:	e8 0d ff ff ff       	call   801ee3 <nsipc>
+}
+  801fd6:	c9                   	leave
+  801fd7:	c3                   	ret
+
+00801fd8 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801fde:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe1:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801fe6:	b8 04 00 00 00       	mov    $0x4,%eax
+  801feb:	e8 f3 fe ff ff       	call   801ee3 <nsipc>
+}
+  801ff0:	c9                   	leave
+  801ff1:	c3                   	ret
+
+00801ff2 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801ff2:	55                   	push   %ebp
+  801ff3:	89 e5                	mov    %esp,%ebp
+  801ff5:	53                   	push   %ebx
+  801ff6:	83 ec 08             	sub    $0x8,%esp
+  801ff9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801ffc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fff:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802004:	53                   	push   %ebx
+  802005:	ff 75 0c             	push   0xc(%ebp)
+  802008:	68 04 70 80 00       	push   $0x807004
+  80200d:	e8 6d ea ff ff       	call   800a7f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802012:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802018:	b8 05 00 00 00       	mov    $0x5,%eax
+  80201d:	e8 c1 fe ff ff       	call   801ee3 <nsipc>
+}
+  802022:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802025:	c9                   	leave
+  802026:	c3                   	ret
+
+00802027 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802027:	55                   	push   %ebp
+  802028:	89 e5                	mov    %esp,%ebp
+  80202a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80202d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802030:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802035:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802038:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80203d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802042:	e8 9c fe ff ff       	call   801ee3 <nsipc>
+}
+  802047:	c9                   	leave
+  802048:	c3                   	ret
+
+00802049 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802049:	55                   	push   %ebp
+  80204a:	89 e5                	mov    %esp,%ebp
+  80204c:	56                   	push   %esi
+  80204d:	53                   	push   %ebx
+  80204e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802051:	8b 45 08             	mov    0x8(%ebp),%eax
+  802054:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802059:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80205f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802062:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802067:	b8 07 00 00 00       	mov    $0x7,%eax
+  80206c:	e8 72 fe ff ff       	call   801ee3 <nsipc>
+  802071:	89 c3                	mov    %eax,%ebx
+  802073:	85 c0                	test   %eax,%eax
+  802075:	78 22                	js     802099 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802077:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80207c:	39 c6                	cmp    %eax,%esi
+  80207e:	0f 4e c6             	cmovle %esi,%eax
+  802081:	39 c3                	cmp    %eax,%ebx
+  802083:	7f 1d                	jg     8020a2 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802085:	83 ec 04             	sub    $0x4,%esp
+  802088:	53                   	push   %ebx
+  802089:	68 00 70 80 00       	push   $0x807000
+  80208e:	ff 75 0c             	push   0xc(%ebp)
+  802091:	e8 e9 e9 ff ff       	call   800a7f <memmove>
+  802096:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802099:	89 d8                	mov    %ebx,%eax
+  80209b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80209e:	5b                   	pop    %ebx
+  80209f:	5e                   	pop    %esi
+  8020a0:	5d                   	pop    %ebp
+  8020a1:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8020a2:	68 ef 31 80 00       	push   $0x8031ef
+  8020a7:	68 b7 31 80 00       	push   $0x8031b7
+  8020ac:	6a 62                	push   $0x62
+  8020ae:	68 04 32 80 00       	push   $0x803204
+  8020b3:	e8 78 e1 ff ff       	call   800230 <_panic>
+
+008020b8 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8020b8:	55                   	push   %ebp
+  8020b9:	89 e5                	mov    %esp,%ebp
+  8020bb:	53                   	push   %ebx
+  8020bc:	83 ec 04             	sub    $0x4,%esp
+  8020bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8020c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c5:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8020ca:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8020d0:	7f 2e                	jg     802100 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8020d2:	83 ec 04             	sub    $0x4,%esp
+  8020d5:	53                   	push   %ebx
+  8020d6:	ff 75 0c             	push   0xc(%ebp)
+  8020d9:	68 0c 70 80 00       	push   $0x80700c
+  8020de:	e8 9c e9 ff ff       	call   800a7f <memmove>
+	nsipcbuf.send.req_size = size;
+  8020e3:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8020e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020ec:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8020f1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020f6:	e8 e8 fd ff ff       	call   801ee3 <nsipc>
+}
+  8020fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020fe:	c9                   	leave
+  8020ff:	c3                   	ret
+	assert(size < 1600);
+  802100:	68 10 32 80 00       	push   $0x803210
+  802105:	68 b7 31 80 00       	push   $0x8031b7
+  80210a:	6a 6d                	push   $0x6d
+  80210c:	68 04 32 80 00       	push   $0x803204
+  802111:	e8 1a e1 ff ff       	call   800230 <_panic>
+
+00802116 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802116:	55                   	push   %ebp
+  802117:	89 e5                	mov    %esp,%ebp
+  802119:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80211c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80211f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802124:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802127:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80212c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80212f:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802134:	b8 09 00 00 00       	mov    $0x9,%eax
+  802139:	e8 a5 fd ff ff       	call   801ee3 <nsipc>
+}
+  80213e:	c9                   	leave
+  80213f:	c3                   	ret
+
+00802140 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	56                   	push   %esi
+  802144:	53                   	push   %ebx
+  802145:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802148:	83 ec 0c             	sub    $0xc,%esp
+  80214b:	ff 75 08             	push   0x8(%ebp)
+  80214e:	e8 aa f3 ff ff       	call   8014fd <fd2data>
+  802153:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802155:	83 c4 08             	add    $0x8,%esp
+  802158:	68 1c 32 80 00       	push   $0x80321c
+  80215d:	53                   	push   %ebx
+  80215e:	e8 96 e7 ff ff       	call   8008f9 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802163:	8b 46 04             	mov    0x4(%esi),%eax
+  802166:	2b 06                	sub    (%esi),%eax
+  802168:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80216e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802175:	00 00 00 
+	stat->st_dev = &devpipe;
+  802178:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80217f:	40 80 00 
+	return 0;
+}
+  802182:	b8 00 00 00 00       	mov    $0x0,%eax
+  802187:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80218a:	5b                   	pop    %ebx
+  80218b:	5e                   	pop    %esi
+  80218c:	5d                   	pop    %ebp
+  80218d:	c3                   	ret
+
+0080218e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80218e:	55                   	push   %ebp
+  80218f:	89 e5                	mov    %esp,%ebp
+  802191:	53                   	push   %ebx
+  802192:	83 ec 0c             	sub    $0xc,%esp
+  802195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802198:	53                   	push   %ebx
+  802199:	6a 00                	push   $0x0
+  80219b:	e8 8e ec ff ff       	call   800e2e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8021a0:	89 1c 24             	mov    %ebx,(%esp)
+  8021a3:	e8 55 f3 ff ff       	call   8014fd <fd2data>
+  8021a8:	83 c4 08             	add    $0x8,%esp
+  8021ab:	50                   	push   %eax
+  8021ac:	6a 00                	push   $0x0
+  8021ae:	e8 7b ec ff ff       	call   800e2e <sys_page_unmap>
+}
+  8021b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b6:	c9                   	leave
+  8021b7:	c3                   	ret
+
+008021b8 <_pipeisclosed>:
+{
+  8021b8:	55                   	push   %ebp
+  8021b9:	89 e5                	mov    %esp,%ebp
+  8021bb:	57                   	push   %edi
+  8021bc:	56                   	push   %esi
+  8021bd:	53                   	push   %ebx
+  8021be:	83 ec 1c             	sub    $0x1c,%esp
+  8021c1:	89 c7                	mov    %eax,%edi
+  8021c3:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8021c5:	a1 08 50 80 00       	mov    0x805008,%eax
+  8021ca:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8021cd:	83 ec 0c             	sub    $0xc,%esp
+  8021d0:	57                   	push   %edi
+  8021d1:	e8 95 05 00 00       	call   80276b <pageref>
+  8021d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021d9:	89 34 24             	mov    %esi,(%esp)
+  8021dc:	e8 8a 05 00 00       	call   80276b <pageref>
+		nn = thisenv->env_runs;
+  8021e1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8021e7:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  8021ea:	83 c4 10             	add    $0x10,%esp
+  8021ed:	39 cb                	cmp    %ecx,%ebx
+  8021ef:	74 1b                	je     80220c <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8021f1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021f4:	75 cf                	jne    8021c5 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8021f6:	8b 42 5c             	mov    0x5c(%edx),%eax
+  8021f9:	6a 01                	push   $0x1
+  8021fb:	50                   	push   %eax
+  8021fc:	53                   	push   %ebx
+  8021fd:	68 23 32 80 00       	push   $0x803223
+  802202:	e8 04 e1 ff ff       	call   80030b <cprintf>
+  802207:	83 c4 10             	add    $0x10,%esp
+  80220a:	eb b9                	jmp    8021c5 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80220c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80220f:	0f 94 c0             	sete   %al
+  802212:	0f b6 c0             	movzbl %al,%eax
+}
+  802215:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802218:	5b                   	pop    %ebx
+  802219:	5e                   	pop    %esi
+  80221a:	5f                   	pop    %edi
+  80221b:	5d                   	pop    %ebp
+  80221c:	c3                   	ret
+
+0080221d <devpipe_write>:
+{
+  80221d:	55                   	push   %ebp
+  80221e:	89 e5                	mov    %esp,%ebp
+  802220:	57                   	push   %edi
+  802221:	56                   	push   %esi
+  802222:	53                   	push   %ebx
+  802223:	83 ec 28             	sub    $0x28,%esp
+  802226:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802229:	56                   	push   %esi
+  80222a:	e8 ce f2 ff ff       	call   8014fd <fd2data>
+  80222f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802231:	83 c4 10             	add    $0x10,%esp
+  802234:	bf 00 00 00 00       	mov    $0x0,%edi
+  802239:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80223c:	75 09                	jne    802247 <devpipe_write+0x2a>
+	return i;
+  80223e:	89 f8                	mov    %edi,%eax
+  802240:	eb 23                	jmp    802265 <devpipe_write+0x48>
+			sys_yield();
+  802242:	e8 9f ea ff ff       	call   800ce6 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802247:	8b 43 04             	mov    0x4(%ebx),%eax
+  80224a:	8b 0b                	mov    (%ebx),%ecx
+  80224c:	8d 51 20             	lea    0x20(%ecx),%edx
+  80224f:	39 d0                	cmp    %edx,%eax
+  802251:	72 1a                	jb     80226d <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802253:	89 da                	mov    %ebx,%edx
+  802255:	89 f0                	mov    %esi,%eax
+  802257:	e8 5c ff ff ff       	call   8021b8 <_pipeisclosed>
+  80225c:	85 c0                	test   %eax,%eax
+  80225e:	74 e2                	je     802242 <devpipe_write+0x25>
+				return 0;
+  802260:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802265:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802268:	5b                   	pop    %ebx
+  802269:	5e                   	pop    %esi
+  80226a:	5f                   	pop    %edi
+  80226b:	5d                   	pop    %ebp
+  80226c:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80226d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802270:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802274:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802277:	89 c2                	mov    %eax,%edx
+  802279:	c1 fa 1f             	sar    $0x1f,%edx
+  80227c:	89 d1                	mov    %edx,%ecx
+  80227e:	c1 e9 1b             	shr    $0x1b,%ecx
+  802281:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802284:	83 e2 1f             	and    $0x1f,%edx
+  802287:	29 ca                	sub    %ecx,%edx
+  802289:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80228d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802291:	83 c0 01             	add    $0x1,%eax
+  802294:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802297:	83 c7 01             	add    $0x1,%edi
+  80229a:	eb 9d                	jmp    802239 <devpipe_write+0x1c>
+
+0080229c <devpipe_read>:
+{
+  80229c:	55                   	push   %ebp
+  80229d:	89 e5                	mov    %esp,%ebp
+  80229f:	57                   	push   %edi
+  8022a0:	56                   	push   %esi
+  8022a1:	53                   	push   %ebx
+  8022a2:	83 ec 18             	sub    $0x18,%esp
+  8022a5:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8022a8:	57                   	push   %edi
+  8022a9:	e8 4f f2 ff ff       	call   8014fd <fd2data>
+  8022ae:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8022b0:	83 c4 10             	add    $0x10,%esp
+  8022b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022bb:	75 13                	jne    8022d0 <devpipe_read+0x34>
+	return i;
+  8022bd:	89 f0                	mov    %esi,%eax
+  8022bf:	eb 02                	jmp    8022c3 <devpipe_read+0x27>
+				return i;
+  8022c1:	89 f0                	mov    %esi,%eax
+}
+  8022c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c6:	5b                   	pop    %ebx
+  8022c7:	5e                   	pop    %esi
+  8022c8:	5f                   	pop    %edi
+  8022c9:	5d                   	pop    %ebp
+  8022ca:	c3                   	ret
+			sys_yield();
+  8022cb:	e8 16 ea ff ff       	call   800ce6 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8022d0:	8b 03                	mov    (%ebx),%eax
+  8022d2:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8022d5:	75 18                	jne    8022ef <devpipe_read+0x53>
+			if (i > 0)
+  8022d7:	85 f6                	test   %esi,%esi
+  8022d9:	75 e6                	jne    8022c1 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8022db:	89 da                	mov    %ebx,%edx
+  8022dd:	89 f8                	mov    %edi,%eax
+  8022df:	e8 d4 fe ff ff       	call   8021b8 <_pipeisclosed>
+  8022e4:	85 c0                	test   %eax,%eax
+  8022e6:	74 e3                	je     8022cb <devpipe_read+0x2f>
+				return 0;
+  8022e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ed:	eb d4                	jmp    8022c3 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8022ef:	99                   	cltd
+  8022f0:	c1 ea 1b             	shr    $0x1b,%edx
+  8022f3:	01 d0                	add    %edx,%eax
+  8022f5:	83 e0 1f             	and    $0x1f,%eax
+  8022f8:	29 d0                	sub    %edx,%eax
+  8022fa:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8022ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802302:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802305:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802308:	83 c6 01             	add    $0x1,%esi
+  80230b:	eb ab                	jmp    8022b8 <devpipe_read+0x1c>
+
+0080230d <pipe>:
+{
+  80230d:	55                   	push   %ebp
+  80230e:	89 e5                	mov    %esp,%ebp
+  802310:	56                   	push   %esi
+  802311:	53                   	push   %ebx
+  802312:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802315:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802318:	50                   	push   %eax
+  802319:	e8 f6 f1 ff ff       	call   801514 <fd_alloc>
+  80231e:	89 c3                	mov    %eax,%ebx
+  802320:	83 c4 10             	add    $0x10,%esp
+  802323:	85 c0                	test   %eax,%eax
+  802325:	0f 88 23 01 00 00    	js     80244e <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80232b:	83 ec 04             	sub    $0x4,%esp
+  80232e:	68 07 04 00 00       	push   $0x407
+  802333:	ff 75 f4             	push   -0xc(%ebp)
+  802336:	6a 00                	push   $0x0
+  802338:	e8 29 ea ff ff       	call   800d66 <sys_page_alloc>
+  80233d:	89 c3                	mov    %eax,%ebx
+  80233f:	83 c4 10             	add    $0x10,%esp
+  802342:	85 c0                	test   %eax,%eax
+  802344:	0f 88 04 01 00 00    	js     80244e <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80234a:	83 ec 0c             	sub    $0xc,%esp
+  80234d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802350:	50                   	push   %eax
+  802351:	e8 be f1 ff ff       	call   801514 <fd_alloc>
+  802356:	89 c3                	mov    %eax,%ebx
+  802358:	83 c4 10             	add    $0x10,%esp
+  80235b:	85 c0                	test   %eax,%eax
+  80235d:	0f 88 db 00 00 00    	js     80243e <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802363:	83 ec 04             	sub    $0x4,%esp
+  802366:	68 07 04 00 00       	push   $0x407
+  80236b:	ff 75 f0             	push   -0x10(%ebp)
+  80236e:	6a 00                	push   $0x0
+  802370:	e8 f1 e9 ff ff       	call   800d66 <sys_page_alloc>
+  802375:	89 c3                	mov    %eax,%ebx
+  802377:	83 c4 10             	add    $0x10,%esp
+  80237a:	85 c0                	test   %eax,%eax
+  80237c:	0f 88 bc 00 00 00    	js     80243e <pipe+0x131>
+	va = fd2data(fd0);
+  802382:	83 ec 0c             	sub    $0xc,%esp
+  802385:	ff 75 f4             	push   -0xc(%ebp)
+  802388:	e8 70 f1 ff ff       	call   8014fd <fd2data>
+  80238d:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80238f:	83 c4 0c             	add    $0xc,%esp
+  802392:	68 07 04 00 00       	push   $0x407
+  802397:	50                   	push   %eax
+  802398:	6a 00                	push   $0x0
+  80239a:	e8 c7 e9 ff ff       	call   800d66 <sys_page_alloc>
+  80239f:	89 c3                	mov    %eax,%ebx
+  8023a1:	83 c4 10             	add    $0x10,%esp
+  8023a4:	85 c0                	test   %eax,%eax
+  8023a6:	0f 88 82 00 00 00    	js     80242e <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023ac:	83 ec 0c             	sub    $0xc,%esp
+  8023af:	ff 75 f0             	push   -0x10(%ebp)
+  8023b2:	e8 46 f1 ff ff       	call   8014fd <fd2data>
+  8023b7:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8023be:	50                   	push   %eax
+  8023bf:	6a 00                	push   $0x0
+  8023c1:	56                   	push   %esi
+  8023c2:	6a 00                	push   $0x0
+  8023c4:	e8 23 ea ff ff       	call   800dec <sys_page_map>
+  8023c9:	89 c3                	mov    %eax,%ebx
+  8023cb:	83 c4 20             	add    $0x20,%esp
+  8023ce:	85 c0                	test   %eax,%eax
+  8023d0:	78 4e                	js     802420 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8023d2:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8023d7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023da:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8023dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023df:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8023e6:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8023e9:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8023eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8023ee:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8023f5:	83 ec 0c             	sub    $0xc,%esp
+  8023f8:	ff 75 f4             	push   -0xc(%ebp)
+  8023fb:	e8 ed f0 ff ff       	call   8014ed <fd2num>
+  802400:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802403:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802405:	83 c4 04             	add    $0x4,%esp
+  802408:	ff 75 f0             	push   -0x10(%ebp)
+  80240b:	e8 dd f0 ff ff       	call   8014ed <fd2num>
+  802410:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802413:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802416:	83 c4 10             	add    $0x10,%esp
+  802419:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80241e:	eb 2e                	jmp    80244e <pipe+0x141>
+	sys_page_unmap(0, va);
+  802420:	83 ec 08             	sub    $0x8,%esp
+  802423:	56                   	push   %esi
+  802424:	6a 00                	push   $0x0
+  802426:	e8 03 ea ff ff       	call   800e2e <sys_page_unmap>
+  80242b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80242e:	83 ec 08             	sub    $0x8,%esp
+  802431:	ff 75 f0             	push   -0x10(%ebp)
+  802434:	6a 00                	push   $0x0
+  802436:	e8 f3 e9 ff ff       	call   800e2e <sys_page_unmap>
+  80243b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80243e:	83 ec 08             	sub    $0x8,%esp
+  802441:	ff 75 f4             	push   -0xc(%ebp)
+  802444:	6a 00                	push   $0x0
+  802446:	e8 e3 e9 ff ff       	call   800e2e <sys_page_unmap>
+  80244b:	83 c4 10             	add    $0x10,%esp
+}
+  80244e:	89 d8                	mov    %ebx,%eax
+  802450:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802453:	5b                   	pop    %ebx
+  802454:	5e                   	pop    %esi
+  802455:	5d                   	pop    %ebp
+  802456:	c3                   	ret
+
+00802457 <pipeisclosed>:
+{
+  802457:	55                   	push   %ebp
+  802458:	89 e5                	mov    %esp,%ebp
+  80245a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80245d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802460:	50                   	push   %eax
+  802461:	ff 75 08             	push   0x8(%ebp)
+  802464:	e8 01 f1 ff ff       	call   80156a <fd_lookup>
+  802469:	83 c4 10             	add    $0x10,%esp
+  80246c:	85 c0                	test   %eax,%eax
+  80246e:	78 18                	js     802488 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802470:	83 ec 0c             	sub    $0xc,%esp
+  802473:	ff 75 f4             	push   -0xc(%ebp)
+  802476:	e8 82 f0 ff ff       	call   8014fd <fd2data>
+  80247b:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80247d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802480:	e8 33 fd ff ff       	call   8021b8 <_pipeisclosed>
+  802485:	83 c4 10             	add    $0x10,%esp
+}
+  802488:	c9                   	leave
+  802489:	c3                   	ret
+
+0080248a <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80248a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80248f:	c3                   	ret
+
+00802490 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802490:	55                   	push   %ebp
+  802491:	89 e5                	mov    %esp,%ebp
+  802493:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802496:	68 3b 32 80 00       	push   $0x80323b
+  80249b:	ff 75 0c             	push   0xc(%ebp)
+  80249e:	e8 56 e4 ff ff       	call   8008f9 <strcpy>
+	return 0;
+}
+  8024a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a8:	c9                   	leave
+  8024a9:	c3                   	ret
+
+008024aa <devcons_write>:
+{
+  8024aa:	55                   	push   %ebp
+  8024ab:	89 e5                	mov    %esp,%ebp
+  8024ad:	57                   	push   %edi
+  8024ae:	56                   	push   %esi
+  8024af:	53                   	push   %ebx
+  8024b0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8024b6:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8024bb:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8024c1:	eb 2e                	jmp    8024f1 <devcons_write+0x47>
+		m = n - tot;
+  8024c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8024c6:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8024c8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8024cd:	39 c3                	cmp    %eax,%ebx
+  8024cf:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8024d2:	83 ec 04             	sub    $0x4,%esp
+  8024d5:	53                   	push   %ebx
+  8024d6:	89 f0                	mov    %esi,%eax
+  8024d8:	03 45 0c             	add    0xc(%ebp),%eax
+  8024db:	50                   	push   %eax
+  8024dc:	57                   	push   %edi
+  8024dd:	e8 9d e5 ff ff       	call   800a7f <memmove>
+		sys_cputs(buf, m);
+  8024e2:	83 c4 08             	add    $0x8,%esp
+  8024e5:	53                   	push   %ebx
+  8024e6:	57                   	push   %edi
+  8024e7:	e8 3d e7 ff ff       	call   800c29 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8024ec:	01 de                	add    %ebx,%esi
+  8024ee:	83 c4 10             	add    $0x10,%esp
+  8024f1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8024f4:	72 cd                	jb     8024c3 <devcons_write+0x19>
+}
+  8024f6:	89 f0                	mov    %esi,%eax
+  8024f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024fb:	5b                   	pop    %ebx
+  8024fc:	5e                   	pop    %esi
+  8024fd:	5f                   	pop    %edi
+  8024fe:	5d                   	pop    %ebp
+  8024ff:	c3                   	ret
+
+00802500 <devcons_read>:
+{
+  802500:	55                   	push   %ebp
+  802501:	89 e5                	mov    %esp,%ebp
+  802503:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802506:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80250f:	75 07                	jne    802518 <devcons_read+0x18>
+  802511:	eb 1f                	jmp    802532 <devcons_read+0x32>
+		sys_yield();
+  802513:	e8 ce e7 ff ff       	call   800ce6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802518:	e8 2a e7 ff ff       	call   800c47 <sys_cgetc>
+  80251d:	85 c0                	test   %eax,%eax
+  80251f:	74 f2                	je     802513 <devcons_read+0x13>
+	if (c < 0)
+  802521:	78 0f                	js     802532 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802523:	83 f8 04             	cmp    $0x4,%eax
+  802526:	74 0c                	je     802534 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802528:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80252b:	88 02                	mov    %al,(%edx)
+	return 1;
+  80252d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802532:	c9                   	leave
+  802533:	c3                   	ret
+		return 0;
+  802534:	b8 00 00 00 00       	mov    $0x0,%eax
+  802539:	eb f7                	jmp    802532 <devcons_read+0x32>
+
+0080253b <cputchar>:
+{
+  80253b:	55                   	push   %ebp
+  80253c:	89 e5                	mov    %esp,%ebp
+  80253e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802541:	8b 45 08             	mov    0x8(%ebp),%eax
+  802544:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802547:	6a 01                	push   $0x1
+  802549:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80254c:	50                   	push   %eax
+  80254d:	e8 d7 e6 ff ff       	call   800c29 <sys_cputs>
+}
+  802552:	83 c4 10             	add    $0x10,%esp
+  802555:	c9                   	leave
+  802556:	c3                   	ret
+
+00802557 <getchar>:
+{
+  802557:	55                   	push   %ebp
+  802558:	89 e5                	mov    %esp,%ebp
+  80255a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80255d:	6a 01                	push   $0x1
+  80255f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802562:	50                   	push   %eax
+  802563:	6a 00                	push   $0x0
+  802565:	e8 66 f2 ff ff       	call   8017d0 <read>
+	if (r < 0)
+  80256a:	83 c4 10             	add    $0x10,%esp
+  80256d:	85 c0                	test   %eax,%eax
+  80256f:	78 06                	js     802577 <getchar+0x20>
+	if (r < 1)
+  802571:	74 06                	je     802579 <getchar+0x22>
+	return c;
+  802573:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802577:	c9                   	leave
+  802578:	c3                   	ret
+		return -E_EOF;
+  802579:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80257e:	eb f7                	jmp    802577 <getchar+0x20>
+
+00802580 <iscons>:
+{
+  802580:	55                   	push   %ebp
+  802581:	89 e5                	mov    %esp,%ebp
+  802583:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802586:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802589:	50                   	push   %eax
+  80258a:	ff 75 08             	push   0x8(%ebp)
+  80258d:	e8 d8 ef ff ff       	call   80156a <fd_lookup>
+  802592:	83 c4 10             	add    $0x10,%esp
+  802595:	85 c0                	test   %eax,%eax
+  802597:	78 11                	js     8025aa <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802599:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80259c:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8025a2:	39 10                	cmp    %edx,(%eax)
+  8025a4:	0f 94 c0             	sete   %al
+  8025a7:	0f b6 c0             	movzbl %al,%eax
+}
+  8025aa:	c9                   	leave
+  8025ab:	c3                   	ret
+
+008025ac <opencons>:
+{
+  8025ac:	55                   	push   %ebp
+  8025ad:	89 e5                	mov    %esp,%ebp
+  8025af:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8025b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025b5:	50                   	push   %eax
+  8025b6:	e8 59 ef ff ff       	call   801514 <fd_alloc>
+  8025bb:	83 c4 10             	add    $0x10,%esp
+  8025be:	85 c0                	test   %eax,%eax
+  8025c0:	78 3a                	js     8025fc <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8025c2:	83 ec 04             	sub    $0x4,%esp
+  8025c5:	68 07 04 00 00       	push   $0x407
+  8025ca:	ff 75 f4             	push   -0xc(%ebp)
+  8025cd:	6a 00                	push   $0x0
+  8025cf:	e8 92 e7 ff ff       	call   800d66 <sys_page_alloc>
+  8025d4:	83 c4 10             	add    $0x10,%esp
+  8025d7:	85 c0                	test   %eax,%eax
+  8025d9:	78 21                	js     8025fc <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8025db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025de:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8025e4:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8025e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025e9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8025f0:	83 ec 0c             	sub    $0xc,%esp
+  8025f3:	50                   	push   %eax
+  8025f4:	e8 f4 ee ff ff       	call   8014ed <fd2num>
+  8025f9:	83 c4 10             	add    $0x10,%esp
+}
+  8025fc:	c9                   	leave
+  8025fd:	c3                   	ret
+
+008025fe <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8025fe:	55                   	push   %ebp
+  8025ff:	89 e5                	mov    %esp,%ebp
+  802601:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802604:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80260b:	74 0a                	je     802617 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80260d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802610:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  802615:	c9                   	leave
+  802616:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  802617:	83 ec 04             	sub    $0x4,%esp
+  80261a:	6a 07                	push   $0x7
+  80261c:	68 00 f0 bf ee       	push   $0xeebff000
+  802621:	6a 00                	push   $0x0
+  802623:	e8 3e e7 ff ff       	call   800d66 <sys_page_alloc>
+  802628:	83 c4 10             	add    $0x10,%esp
+  80262b:	85 c0                	test   %eax,%eax
+  80262d:	78 28                	js     802657 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  80262f:	83 ec 08             	sub    $0x8,%esp
+  802632:	68 69 26 80 00       	push   $0x802669
+  802637:	6a 00                	push   $0x0
+  802639:	e8 23 ea ff ff       	call   801061 <sys_env_set_pgfault_upcall>
+  80263e:	83 c4 10             	add    $0x10,%esp
+  802641:	85 c0                	test   %eax,%eax
+  802643:	79 c8                	jns    80260d <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  802645:	50                   	push   %eax
+  802646:	68 55 32 80 00       	push   $0x803255
+  80264b:	6a 24                	push   $0x24
+  80264d:	68 47 32 80 00       	push   $0x803247
+  802652:	e8 d9 db ff ff       	call   800230 <_panic>
+			panic("sys_page_alloc: %e", r);
+  802657:	50                   	push   %eax
+  802658:	68 46 30 80 00       	push   $0x803046
+  80265d:	6a 21                	push   $0x21
+  80265f:	68 47 32 80 00       	push   $0x803247
+  802664:	e8 c7 db ff ff       	call   800230 <_panic>
+
+00802669 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802669:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80266a:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  80266f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802671:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802674:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  802677:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  80267b:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  80267e:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  802682:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  802686:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  802688:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802689:	83 c4 04             	add    $0x4,%esp
+	popf
+  80268c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80268d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80268e:	c3                   	ret
+
+0080268f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80268f:	55                   	push   %ebp
+  802690:	89 e5                	mov    %esp,%ebp
+  802692:	57                   	push   %edi
+  802693:	56                   	push   %esi
+  802694:	53                   	push   %ebx
+  802695:	83 ec 18             	sub    $0x18,%esp
+  802698:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80269b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80269e:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8026a1:	85 db                	test   %ebx,%ebx
+  8026a3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8026a8:	0f 45 c3             	cmovne %ebx,%eax
+  8026ab:	50                   	push   %eax
+  8026ac:	e8 38 ea ff ff       	call   8010e9 <sys_ipc_recv>
+
+	if (from_env_store)
+  8026b1:	83 c4 10             	add    $0x10,%esp
+  8026b4:	85 ff                	test   %edi,%edi
+  8026b6:	74 17                	je     8026cf <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8026b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	75 0c                	jne    8026cd <ipc_recv+0x3e>
+  8026c1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8026c7:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8026cd:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8026cf:	85 f6                	test   %esi,%esi
+  8026d1:	74 2e                	je     802701 <ipc_recv+0x72>
+		if (!r && pg)
+  8026d3:	85 c0                	test   %eax,%eax
+  8026d5:	75 24                	jne    8026fb <ipc_recv+0x6c>
+  8026d7:	85 db                	test   %ebx,%ebx
+  8026d9:	74 20                	je     8026fb <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8026db:	a1 08 50 80 00       	mov    0x805008,%eax
+  8026e0:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8026e6:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8026e8:	a1 08 50 80 00       	mov    0x805008,%eax
+  8026ed:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  8026f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026f6:	5b                   	pop    %ebx
+  8026f7:	5e                   	pop    %esi
+  8026f8:	5f                   	pop    %edi
+  8026f9:	5d                   	pop    %ebp
+  8026fa:	c3                   	ret
+			*perm_store = 0;
+  8026fb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802701:	85 c0                	test   %eax,%eax
+  802703:	75 ee                	jne    8026f3 <ipc_recv+0x64>
+  802705:	eb e1                	jmp    8026e8 <ipc_recv+0x59>
+
+00802707 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802707:	55                   	push   %ebp
+  802708:	89 e5                	mov    %esp,%ebp
+  80270a:	57                   	push   %edi
+  80270b:	56                   	push   %esi
+  80270c:	53                   	push   %ebx
+  80270d:	83 ec 0c             	sub    $0xc,%esp
+  802710:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802713:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802716:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802719:	85 db                	test   %ebx,%ebx
+  80271b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802720:	0f 44 d8             	cmove  %eax,%ebx
+  802723:	ff 75 14             	push   0x14(%ebp)
+  802726:	53                   	push   %ebx
+  802727:	56                   	push   %esi
+  802728:	57                   	push   %edi
+  802729:	e8 98 e9 ff ff       	call   8010c6 <sys_ipc_try_send_yield>
+  80272e:	83 c4 10             	add    $0x10,%esp
+  802731:	85 c0                	test   %eax,%eax
+  802733:	79 1e                	jns    802753 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802735:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802738:	75 07                	jne    802741 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80273a:	e8 a7 e5 ff ff       	call   800ce6 <sys_yield>
+  80273f:	eb e2                	jmp    802723 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802741:	50                   	push   %eax
+  802742:	68 73 32 80 00       	push   $0x803273
+  802747:	6a 3d                	push   $0x3d
+  802749:	68 88 32 80 00       	push   $0x803288
+  80274e:	e8 dd da ff ff       	call   800230 <_panic>
+	}
+}
+  802753:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802756:	5b                   	pop    %ebx
+  802757:	5e                   	pop    %esi
+  802758:	5f                   	pop    %edi
+  802759:	5d                   	pop    %ebp
+  80275a:	c3                   	ret
+
+0080275b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80275b:	55                   	push   %ebp
+  80275c:	89 e5                	mov    %esp,%ebp
+  80275e:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802761:	ff 75 08             	push   0x8(%ebp)
+  802764:	e8 fd e4 ff ff       	call   800c66 <sys_env_find>
+}
+  802769:	c9                   	leave
+  80276a:	c3                   	ret
+
+0080276b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80276b:	55                   	push   %ebp
+  80276c:	89 e5                	mov    %esp,%ebp
+  80276e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802771:	89 c2                	mov    %eax,%edx
+  802773:	c1 ea 16             	shr    $0x16,%edx
+  802776:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80277d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802782:	f6 c1 01             	test   $0x1,%cl
+  802785:	74 22                	je     8027a9 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802787:	c1 e8 0c             	shr    $0xc,%eax
+  80278a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802791:	a8 01                	test   $0x1,%al
+  802793:	74 14                	je     8027a9 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802795:	c1 e8 0c             	shr    $0xc,%eax
+  802798:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80279b:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8027a2:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8027a6:	0f b7 d2             	movzwl %dx,%edx
+}
+  8027a9:	89 d0                	mov    %edx,%eax
+  8027ab:	5d                   	pop    %ebp
+  8027ac:	c3                   	ret
+  8027ad:	66 90                	xchg   %ax,%ax
+  8027af:	90                   	nop
+
+008027b0 <__udivmoddi4>:
+  8027b0:	55                   	push   %ebp
+  8027b1:	57                   	push   %edi
+  8027b2:	56                   	push   %esi
+  8027b3:	53                   	push   %ebx
+  8027b4:	83 ec 14             	sub    $0x14,%esp
+  8027b7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8027bb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8027bf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027c3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027c7:	89 f1                	mov    %esi,%ecx
+  8027c9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8027cd:	09 d9                	or     %ebx,%ecx
+  8027cf:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8027d3:	0f 84 92 00 00 00    	je     80286b <__udivmoddi4+0xbb>
+  8027d9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8027e0:	00 
+  8027e1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8027e6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8027ed:	00 
+  8027ee:	89 1c 24             	mov    %ebx,(%esp)
+  8027f1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8027f5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027f8:	89 e9                	mov    %ebp,%ecx
+  8027fa:	89 c3                	mov    %eax,%ebx
+  8027fc:	89 d6                	mov    %edx,%esi
+  8027fe:	31 ff                	xor    %edi,%edi
+  802800:	d3 ee                	shr    %cl,%esi
+  802802:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802805:	f6 c1 20             	test   $0x20,%cl
+  802808:	0f 45 de             	cmovne %esi,%ebx
+  80280b:	0f 45 f7             	cmovne %edi,%esi
+  80280e:	8b 3c 24             	mov    (%esp),%edi
+  802811:	39 fb                	cmp    %edi,%ebx
+  802813:	89 f7                	mov    %esi,%edi
+  802815:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802819:	8b 1c 24             	mov    (%esp),%ebx
+  80281c:	19 f7                	sbb    %esi,%edi
+  80281e:	72 39                	jb     802859 <__udivmoddi4+0xa9>
+  802820:	89 e9                	mov    %ebp,%ecx
+  802822:	89 f7                	mov    %esi,%edi
+  802824:	89 de                	mov    %ebx,%esi
+  802826:	0f a5 df             	shld   %cl,%ebx,%edi
+  802829:	d3 e6                	shl    %cl,%esi
+  80282b:	31 db                	xor    %ebx,%ebx
+  80282d:	f6 c1 20             	test   $0x20,%cl
+  802830:	0f 45 fe             	cmovne %esi,%edi
+  802833:	0f 45 f3             	cmovne %ebx,%esi
+  802836:	29 f0                	sub    %esi,%eax
+  802838:	be 01 00 00 00       	mov    $0x1,%esi
+  80283d:	19 fa                	sbb    %edi,%edx
+  80283f:	31 ff                	xor    %edi,%edi
+  802841:	31 db                	xor    %ebx,%ebx
+  802843:	0f a5 f7             	shld   %cl,%esi,%edi
+  802846:	d3 e6                	shl    %cl,%esi
+  802848:	f6 c1 20             	test   $0x20,%cl
+  80284b:	0f 45 fe             	cmovne %esi,%edi
+  80284e:	0f 45 f3             	cmovne %ebx,%esi
+  802851:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802855:	09 74 24 08          	or     %esi,0x8(%esp)
+  802859:	83 ed 01             	sub    $0x1,%ebp
+  80285c:	73 9a                	jae    8027f8 <__udivmoddi4+0x48>
+  80285e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802862:	85 ff                	test   %edi,%edi
+  802864:	74 05                	je     80286b <__udivmoddi4+0xbb>
+  802866:	89 07                	mov    %eax,(%edi)
+  802868:	89 57 04             	mov    %edx,0x4(%edi)
+  80286b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80286f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802873:	83 c4 14             	add    $0x14,%esp
+  802876:	5b                   	pop    %ebx
+  802877:	5e                   	pop    %esi
+  802878:	5f                   	pop    %edi
+  802879:	5d                   	pop    %ebp
+  80287a:	c3                   	ret
+  80287b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80287f:	90                   	nop
+
+00802880 <__udivdi3>:
+  802880:	55                   	push   %ebp
+  802881:	57                   	push   %edi
+  802882:	56                   	push   %esi
+  802883:	53                   	push   %ebx
+  802884:	83 ec 14             	sub    $0x14,%esp
+  802887:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80288b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80288f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802893:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802897:	89 fb                	mov    %edi,%ebx
+  802899:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80289d:	09 f3                	or     %esi,%ebx
+  80289f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8028a3:	0f 84 85 00 00 00    	je     80292e <__udivdi3+0xae>
+  8028a9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8028b0:	00 
+  8028b1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8028b6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8028bd:	00 
+  8028be:	89 34 24             	mov    %esi,(%esp)
+  8028c1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8028c5:	8d 76 00             	lea    0x0(%esi),%esi
+  8028c8:	89 e9                	mov    %ebp,%ecx
+  8028ca:	89 c3                	mov    %eax,%ebx
+  8028cc:	89 d6                	mov    %edx,%esi
+  8028ce:	31 ff                	xor    %edi,%edi
+  8028d0:	d3 ee                	shr    %cl,%esi
+  8028d2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8028d5:	f6 c1 20             	test   $0x20,%cl
+  8028d8:	0f 45 de             	cmovne %esi,%ebx
+  8028db:	0f 45 f7             	cmovne %edi,%esi
+  8028de:	8b 3c 24             	mov    (%esp),%edi
+  8028e1:	39 fb                	cmp    %edi,%ebx
+  8028e3:	89 f7                	mov    %esi,%edi
+  8028e5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8028e9:	8b 1c 24             	mov    (%esp),%ebx
+  8028ec:	19 f7                	sbb    %esi,%edi
+  8028ee:	72 39                	jb     802929 <__udivdi3+0xa9>
+  8028f0:	89 e9                	mov    %ebp,%ecx
+  8028f2:	89 f7                	mov    %esi,%edi
+  8028f4:	89 de                	mov    %ebx,%esi
+  8028f6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8028f9:	d3 e6                	shl    %cl,%esi
+  8028fb:	31 db                	xor    %ebx,%ebx
+  8028fd:	f6 c1 20             	test   $0x20,%cl
+  802900:	0f 45 fe             	cmovne %esi,%edi
+  802903:	0f 45 f3             	cmovne %ebx,%esi
+  802906:	29 f0                	sub    %esi,%eax
+  802908:	be 01 00 00 00       	mov    $0x1,%esi
+  80290d:	19 fa                	sbb    %edi,%edx
+  80290f:	31 ff                	xor    %edi,%edi
+  802911:	31 db                	xor    %ebx,%ebx
+  802913:	0f a5 f7             	shld   %cl,%esi,%edi
+  802916:	d3 e6                	shl    %cl,%esi
+  802918:	f6 c1 20             	test   $0x20,%cl
+  80291b:	0f 45 fe             	cmovne %esi,%edi
+  80291e:	0f 45 f3             	cmovne %ebx,%esi
+  802921:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802925:	09 74 24 08          	or     %esi,0x8(%esp)
+  802929:	83 ed 01             	sub    $0x1,%ebp
+  80292c:	73 9a                	jae    8028c8 <__udivdi3+0x48>
+  80292e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802932:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802936:	83 c4 14             	add    $0x14,%esp
+  802939:	5b                   	pop    %ebx
+  80293a:	5e                   	pop    %esi
+  80293b:	5f                   	pop    %edi
+  80293c:	5d                   	pop    %ebp
+  80293d:	c3                   	ret
+  80293e:	66 90                	xchg   %ax,%ax
+
+00802940 <__umoddi3>:
+  802940:	57                   	push   %edi
+  802941:	56                   	push   %esi
+  802942:	53                   	push   %ebx
+  802943:	83 ec 08             	sub    $0x8,%esp
+  802946:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80294a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80294e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802952:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802956:	89 f9                	mov    %edi,%ecx
+  802958:	89 34 24             	mov    %esi,(%esp)
+  80295b:	09 f1                	or     %esi,%ecx
+  80295d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802961:	74 53                	je     8029b6 <__umoddi3+0x76>
+  802963:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80296f:	90                   	nop
+  802970:	89 c6                	mov    %eax,%esi
+  802972:	89 d7                	mov    %edx,%edi
+  802974:	31 db                	xor    %ebx,%ebx
+  802976:	d3 ef                	shr    %cl,%edi
+  802978:	0f ad d6             	shrd   %cl,%edx,%esi
+  80297b:	f6 c1 20             	test   $0x20,%cl
+  80297e:	0f 45 f7             	cmovne %edi,%esi
+  802981:	0f 45 fb             	cmovne %ebx,%edi
+  802984:	8b 1c 24             	mov    (%esp),%ebx
+  802987:	39 de                	cmp    %ebx,%esi
+  802989:	89 fb                	mov    %edi,%ebx
+  80298b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80298f:	8b 34 24             	mov    (%esp),%esi
+  802992:	19 fb                	sbb    %edi,%ebx
+  802994:	72 14                	jb     8029aa <__umoddi3+0x6a>
+  802996:	0f a5 f7             	shld   %cl,%esi,%edi
+  802999:	31 db                	xor    %ebx,%ebx
+  80299b:	d3 e6                	shl    %cl,%esi
+  80299d:	f6 c1 20             	test   $0x20,%cl
+  8029a0:	0f 45 fe             	cmovne %esi,%edi
+  8029a3:	0f 45 f3             	cmovne %ebx,%esi
+  8029a6:	29 f0                	sub    %esi,%eax
+  8029a8:	19 fa                	sbb    %edi,%edx
+  8029aa:	83 e9 01             	sub    $0x1,%ecx
+  8029ad:	73 c1                	jae    802970 <__umoddi3+0x30>
+  8029af:	83 c4 08             	add    $0x8,%esp
+  8029b2:	5b                   	pop    %ebx
+  8029b3:	5e                   	pop    %esi
+  8029b4:	5f                   	pop    %edi
+  8029b5:	c3                   	ret
+  8029b6:	83 c4 08             	add    $0x8,%esp
+  8029b9:	31 c0                	xor    %eax,%eax
+  8029bb:	31 d2                	xor    %edx,%edx
+  8029bd:	5b                   	pop    %ebx
+  8029be:	5e                   	pop    %esi
+  8029bf:	5f                   	pop    %edi
+  8029c0:	c3                   	ret
+  8029c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029cf:	90                   	nop
+
+008029d0 <__divdi3>:
+  8029d0:	55                   	push   %ebp
+  8029d1:	57                   	push   %edi
+  8029d2:	56                   	push   %esi
+  8029d3:	53                   	push   %ebx
+  8029d4:	83 ec 1c             	sub    $0x1c,%esp
+  8029d7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8029db:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8029df:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8029e3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8029e7:	85 ff                	test   %edi,%edi
+  8029e9:	0f 88 da 00 00 00    	js     802ac9 <__divdi3+0xf9>
+  8029ef:	85 db                	test   %ebx,%ebx
+  8029f1:	78 16                	js     802a09 <__divdi3+0x39>
+  8029f3:	89 dd                	mov    %ebx,%ebp
+  8029f5:	89 c8                	mov    %ecx,%eax
+  8029f7:	89 da                	mov    %ebx,%edx
+  8029f9:	09 cd                	or     %ecx,%ebp
+  8029fb:	0f 85 fd 00 00 00    	jne    802afe <__divdi3+0x12e>
+  802a01:	83 c4 1c             	add    $0x1c,%esp
+  802a04:	5b                   	pop    %ebx
+  802a05:	5e                   	pop    %esi
+  802a06:	5f                   	pop    %edi
+  802a07:	5d                   	pop    %ebp
+  802a08:	c3                   	ret
+  802a09:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802a0e:	f7 d9                	neg    %ecx
+  802a10:	89 f0                	mov    %esi,%eax
+  802a12:	89 fa                	mov    %edi,%edx
+  802a14:	83 d3 00             	adc    $0x0,%ebx
+  802a17:	89 0c 24             	mov    %ecx,(%esp)
+  802a1a:	f7 db                	neg    %ebx
+  802a1c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802a20:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802a27:	00 
+  802a28:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a2d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802a34:	00 
+  802a35:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a39:	89 cd                	mov    %ecx,%ebp
+  802a3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802a3f:	90                   	nop
+  802a40:	89 e9                	mov    %ebp,%ecx
+  802a42:	89 c3                	mov    %eax,%ebx
+  802a44:	89 d6                	mov    %edx,%esi
+  802a46:	31 ff                	xor    %edi,%edi
+  802a48:	d3 ee                	shr    %cl,%esi
+  802a4a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802a4d:	f6 c1 20             	test   $0x20,%cl
+  802a50:	0f 45 de             	cmovne %esi,%ebx
+  802a53:	0f 45 f7             	cmovne %edi,%esi
+  802a56:	8b 3c 24             	mov    (%esp),%edi
+  802a59:	39 fb                	cmp    %edi,%ebx
+  802a5b:	89 f7                	mov    %esi,%edi
+  802a5d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802a61:	8b 1c 24             	mov    (%esp),%ebx
+  802a64:	19 f7                	sbb    %esi,%edi
+  802a66:	72 39                	jb     802aa1 <__divdi3+0xd1>
+  802a68:	89 e9                	mov    %ebp,%ecx
+  802a6a:	89 f7                	mov    %esi,%edi
+  802a6c:	89 de                	mov    %ebx,%esi
+  802a6e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802a71:	d3 e6                	shl    %cl,%esi
+  802a73:	31 db                	xor    %ebx,%ebx
+  802a75:	f6 c1 20             	test   $0x20,%cl
+  802a78:	0f 45 fe             	cmovne %esi,%edi
+  802a7b:	0f 45 f3             	cmovne %ebx,%esi
+  802a7e:	29 f0                	sub    %esi,%eax
+  802a80:	be 01 00 00 00       	mov    $0x1,%esi
+  802a85:	19 fa                	sbb    %edi,%edx
+  802a87:	31 ff                	xor    %edi,%edi
+  802a89:	31 db                	xor    %ebx,%ebx
+  802a8b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802a8e:	d3 e6                	shl    %cl,%esi
+  802a90:	f6 c1 20             	test   $0x20,%cl
+  802a93:	0f 45 fe             	cmovne %esi,%edi
+  802a96:	0f 45 f3             	cmovne %ebx,%esi
+  802a99:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802a9d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802aa1:	83 ed 01             	sub    $0x1,%ebp
+  802aa4:	73 9a                	jae    802a40 <__divdi3+0x70>
+  802aa6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  802aaa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802aae:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ab2:	85 ed                	test   %ebp,%ebp
+  802ab4:	0f 84 47 ff ff ff    	je     802a01 <__divdi3+0x31>
+  802aba:	f7 d8                	neg    %eax
+  802abc:	83 d2 00             	adc    $0x0,%edx
+  802abf:	83 c4 1c             	add    $0x1c,%esp
+  802ac2:	5b                   	pop    %ebx
+  802ac3:	f7 da                	neg    %edx
+  802ac5:	5e                   	pop    %esi
+  802ac6:	5f                   	pop    %edi
+  802ac7:	5d                   	pop    %ebp
+  802ac8:	c3                   	ret
+  802ac9:	f7 de                	neg    %esi
+  802acb:	83 d7 00             	adc    $0x0,%edi
+  802ace:	f7 df                	neg    %edi
+  802ad0:	85 db                	test   %ebx,%ebx
+  802ad2:	78 23                	js     802af7 <__divdi3+0x127>
+  802ad4:	89 dd                	mov    %ebx,%ebp
+  802ad6:	89 c8                	mov    %ecx,%eax
+  802ad8:	89 da                	mov    %ebx,%edx
+  802ada:	09 cd                	or     %ecx,%ebp
+  802adc:	0f 84 1f ff ff ff    	je     802a01 <__divdi3+0x31>
+  802ae2:	89 0c 24             	mov    %ecx,(%esp)
+  802ae5:	89 f0                	mov    %esi,%eax
+  802ae7:	89 fa                	mov    %edi,%edx
+  802ae9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802aee:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802af2:	e9 29 ff ff ff       	jmp    802a20 <__divdi3+0x50>
+  802af7:	31 ed                	xor    %ebp,%ebp
+  802af9:	e9 10 ff ff ff       	jmp    802a0e <__divdi3+0x3e>
+  802afe:	89 0c 24             	mov    %ecx,(%esp)
+  802b01:	89 f0                	mov    %esi,%eax
+  802b03:	89 fa                	mov    %edi,%edx
+  802b05:	31 ed                	xor    %ebp,%ebp
+  802b07:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802b0b:	e9 10 ff ff ff       	jmp    802a20 <__divdi3+0x50>
+
+00802b10 <__moddi3>:
+  802b10:	55                   	push   %ebp
+  802b11:	57                   	push   %edi
+  802b12:	56                   	push   %esi
+  802b13:	53                   	push   %ebx
+  802b14:	83 ec 14             	sub    $0x14,%esp
+  802b17:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802b1b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802b1f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802b23:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802b27:	85 d2                	test   %edx,%edx
+  802b29:	0f 88 9b 00 00 00    	js     802bca <__moddi3+0xba>
+  802b2f:	89 f7                	mov    %esi,%edi
+  802b31:	31 ed                	xor    %ebp,%ebp
+  802b33:	09 cf                	or     %ecx,%edi
+  802b35:	0f 84 83 00 00 00    	je     802bbe <__moddi3+0xae>
+  802b3b:	89 cb                	mov    %ecx,%ebx
+  802b3d:	89 f7                	mov    %esi,%edi
+  802b3f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802b43:	f7 db                	neg    %ebx
+  802b45:	83 d7 00             	adc    $0x0,%edi
+  802b48:	f7 df                	neg    %edi
+  802b4a:	0f 49 f7             	cmovns %edi,%esi
+  802b4d:	0f 49 cb             	cmovns %ebx,%ecx
+  802b50:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802b54:	89 0c 24             	mov    %ecx,(%esp)
+  802b57:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802b5c:	89 cd                	mov    %ecx,%ebp
+  802b5e:	66 90                	xchg   %ax,%ax
+  802b60:	89 e9                	mov    %ebp,%ecx
+  802b62:	89 c3                	mov    %eax,%ebx
+  802b64:	89 d6                	mov    %edx,%esi
+  802b66:	31 ff                	xor    %edi,%edi
+  802b68:	d3 ee                	shr    %cl,%esi
+  802b6a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802b6d:	f6 c1 20             	test   $0x20,%cl
+  802b70:	0f 45 de             	cmovne %esi,%ebx
+  802b73:	0f 45 f7             	cmovne %edi,%esi
+  802b76:	8b 3c 24             	mov    (%esp),%edi
+  802b79:	39 fb                	cmp    %edi,%ebx
+  802b7b:	89 f7                	mov    %esi,%edi
+  802b7d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802b81:	8b 1c 24             	mov    (%esp),%ebx
+  802b84:	19 f7                	sbb    %esi,%edi
+  802b86:	72 1a                	jb     802ba2 <__moddi3+0x92>
+  802b88:	89 e9                	mov    %ebp,%ecx
+  802b8a:	89 f7                	mov    %esi,%edi
+  802b8c:	89 de                	mov    %ebx,%esi
+  802b8e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802b91:	d3 e6                	shl    %cl,%esi
+  802b93:	31 db                	xor    %ebx,%ebx
+  802b95:	f6 c1 20             	test   $0x20,%cl
+  802b98:	0f 45 fe             	cmovne %esi,%edi
+  802b9b:	0f 45 f3             	cmovne %ebx,%esi
+  802b9e:	29 f0                	sub    %esi,%eax
+  802ba0:	19 fa                	sbb    %edi,%edx
+  802ba2:	83 ed 01             	sub    $0x1,%ebp
+  802ba5:	73 b9                	jae    802b60 <__moddi3+0x50>
+  802ba7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  802bab:	85 ed                	test   %ebp,%ebp
+  802bad:	74 07                	je     802bb6 <__moddi3+0xa6>
+  802baf:	f7 d8                	neg    %eax
+  802bb1:	83 d2 00             	adc    $0x0,%edx
+  802bb4:	f7 da                	neg    %edx
+  802bb6:	83 c4 14             	add    $0x14,%esp
+  802bb9:	5b                   	pop    %ebx
+  802bba:	5e                   	pop    %esi
+  802bbb:	5f                   	pop    %edi
+  802bbc:	5d                   	pop    %ebp
+  802bbd:	c3                   	ret
+  802bbe:	83 c4 14             	add    $0x14,%esp
+  802bc1:	31 c0                	xor    %eax,%eax
+  802bc3:	31 d2                	xor    %edx,%edx
+  802bc5:	5b                   	pop    %ebx
+  802bc6:	5e                   	pop    %esi
+  802bc7:	5f                   	pop    %edi
+  802bc8:	5d                   	pop    %ebp
+  802bc9:	c3                   	ret
+  802bca:	89 f7                	mov    %esi,%edi
+  802bcc:	09 cf                	or     %ecx,%edi
+  802bce:	74 11                	je     802be1 <__moddi3+0xd1>
+  802bd0:	f7 d8                	neg    %eax
+  802bd2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802bd7:	83 d2 00             	adc    $0x0,%edx
+  802bda:	f7 da                	neg    %edx
+  802bdc:	e9 5a ff ff ff       	jmp    802b3b <__moddi3+0x2b>
+  802be1:	31 c0                	xor    %eax,%eax
+  802be3:	31 d2                	xor    %edx,%edx
+  802be5:	eb c8                	jmp    802baf <__moddi3+0x9f>
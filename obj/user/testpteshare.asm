@@ -0,0 +1,6871 @@
+
+obj/user/testpteshare.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 63 01 00 00       	call   800194 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <childofspawn>:
+	breakpoint();
+}
+
+void
+childofspawn(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	strcpy(VA, msg2);
+  800039:	ff 35 00 40 80 00    	push   0x804000
+  80003f:	68 00 00 00 a0       	push   $0xa0000000
+  800044:	e8 74 08 00 00       	call   8008bd <strcpy>
+	exit();
+  800049:	e8 8c 01 00 00       	call   8001da <exit>
+}
+  80004e:	83 c4 10             	add    $0x10,%esp
+  800051:	c9                   	leave
+  800052:	c3                   	ret
+
+00800053 <umain>:
+{
+  800053:	55                   	push   %ebp
+  800054:	89 e5                	mov    %esp,%ebp
+  800056:	53                   	push   %ebx
+  800057:	83 ec 04             	sub    $0x4,%esp
+	if (argc != 0)
+  80005a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80005e:	0f 85 d0 00 00 00    	jne    800134 <umain+0xe1>
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  800064:	83 ec 04             	sub    $0x4,%esp
+  800067:	68 07 04 00 00       	push   $0x407
+  80006c:	68 00 00 00 a0       	push   $0xa0000000
+  800071:	6a 00                	push   $0x0
+  800073:	e8 b2 0c 00 00       	call   800d2a <sys_page_alloc>
+  800078:	83 c4 10             	add    $0x10,%esp
+  80007b:	85 c0                	test   %eax,%eax
+  80007d:	0f 88 bb 00 00 00    	js     80013e <umain+0xeb>
+	if ((r = fork()) < 0)
+  800083:	e8 a2 11 00 00       	call   80122a <fork>
+  800088:	89 c3                	mov    %eax,%ebx
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	0f 88 be 00 00 00    	js     800150 <umain+0xfd>
+	if (r == 0) {
+  800092:	0f 84 ca 00 00 00    	je     800162 <umain+0x10f>
+	wait(r);
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	e8 4d 2a 00 00       	call   802aee <wait>
+	cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	ff 35 04 40 80 00    	push   0x804004
+  8000aa:	68 00 00 00 a0       	push   $0xa0000000
+  8000af:	e8 ba 08 00 00       	call   80096e <strcmp>
+  8000b4:	83 c4 08             	add    $0x8,%esp
+  8000b7:	85 c0                	test   %eax,%eax
+  8000b9:	b8 a6 32 80 00       	mov    $0x8032a6,%eax
+  8000be:	ba a0 32 80 00       	mov    $0x8032a0,%edx
+  8000c3:	0f 44 c2             	cmove  %edx,%eax
+  8000c6:	50                   	push   %eax
+  8000c7:	68 d3 32 80 00       	push   $0x8032d3
+  8000cc:	e8 fe 01 00 00       	call   8002cf <cprintf>
+	if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  8000d1:	6a 00                	push   $0x0
+  8000d3:	68 ee 32 80 00       	push   $0x8032ee
+  8000d8:	68 f3 32 80 00       	push   $0x8032f3
+  8000dd:	68 f2 32 80 00       	push   $0x8032f2
+  8000e2:	e8 e1 21 00 00       	call   8022c8 <spawnl>
+  8000e7:	83 c4 20             	add    $0x20,%esp
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 88 90 00 00 00    	js     800182 <umain+0x12f>
+	wait(r);
+  8000f2:	83 ec 0c             	sub    $0xc,%esp
+  8000f5:	50                   	push   %eax
+  8000f6:	e8 f3 29 00 00       	call   802aee <wait>
+	cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  8000fb:	83 c4 08             	add    $0x8,%esp
+  8000fe:	ff 35 00 40 80 00    	push   0x804000
+  800104:	68 00 00 00 a0       	push   $0xa0000000
+  800109:	e8 60 08 00 00       	call   80096e <strcmp>
+  80010e:	83 c4 08             	add    $0x8,%esp
+  800111:	85 c0                	test   %eax,%eax
+  800113:	b8 a6 32 80 00       	mov    $0x8032a6,%eax
+  800118:	ba a0 32 80 00       	mov    $0x8032a0,%edx
+  80011d:	0f 44 c2             	cmove  %edx,%eax
+  800120:	50                   	push   %eax
+  800121:	68 0a 33 80 00       	push   $0x80330a
+  800126:	e8 a4 01 00 00       	call   8002cf <cprintf>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  80012b:	cc                   	int3
+}
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800132:	c9                   	leave
+  800133:	c3                   	ret
+		childofspawn();
+  800134:	e8 fa fe ff ff       	call   800033 <childofspawn>
+  800139:	e9 26 ff ff ff       	jmp    800064 <umain+0x11>
+		panic("sys_page_alloc: %e", r);
+  80013e:	50                   	push   %eax
+  80013f:	68 ac 32 80 00       	push   $0x8032ac
+  800144:	6a 13                	push   $0x13
+  800146:	68 bf 32 80 00       	push   $0x8032bf
+  80014b:	e8 a4 00 00 00       	call   8001f4 <_panic>
+		panic("fork: %e", r);
+  800150:	50                   	push   %eax
+  800151:	68 f1 36 80 00       	push   $0x8036f1
+  800156:	6a 17                	push   $0x17
+  800158:	68 bf 32 80 00       	push   $0x8032bf
+  80015d:	e8 92 00 00 00       	call   8001f4 <_panic>
+		strcpy(VA, msg);
+  800162:	83 ec 08             	sub    $0x8,%esp
+  800165:	ff 35 04 40 80 00    	push   0x804004
+  80016b:	68 00 00 00 a0       	push   $0xa0000000
+  800170:	e8 48 07 00 00       	call   8008bd <strcpy>
+		exit();
+  800175:	e8 60 00 00 00       	call   8001da <exit>
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	e9 16 ff ff ff       	jmp    800098 <umain+0x45>
+		panic("spawn: %e", r);
+  800182:	50                   	push   %eax
+  800183:	68 00 33 80 00       	push   $0x803300
+  800188:	6a 21                	push   $0x21
+  80018a:	68 bf 32 80 00       	push   $0x8032bf
+  80018f:	e8 60 00 00 00       	call   8001f4 <_panic>
+
+00800194 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	56                   	push   %esi
+  800198:	53                   	push   %ebx
+  800199:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80019c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80019f:	e8 e7 0a 00 00       	call   800c8b <sys_getenvid>
+  8001a4:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8001a9:	c1 e0 09             	shl    $0x9,%eax
+  8001ac:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001b1:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001b6:	85 db                	test   %ebx,%ebx
+  8001b8:	7e 07                	jle    8001c1 <libmain+0x2d>
+		binaryname = argv[0];
+  8001ba:	8b 06                	mov    (%esi),%eax
+  8001bc:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// call user main routine
+	umain(argc, argv);
+  8001c1:	83 ec 08             	sub    $0x8,%esp
+  8001c4:	56                   	push   %esi
+  8001c5:	53                   	push   %ebx
+  8001c6:	e8 88 fe ff ff       	call   800053 <umain>
+
+	// exit gracefully
+	exit();
+  8001cb:	e8 0a 00 00 00       	call   8001da <exit>
+}
+  8001d0:	83 c4 10             	add    $0x10,%esp
+  8001d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001d6:	5b                   	pop    %ebx
+  8001d7:	5e                   	pop    %esi
+  8001d8:	5d                   	pop    %ebp
+  8001d9:	c3                   	ret
+
+008001da <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001da:	55                   	push   %ebp
+  8001db:	89 e5                	mov    %esp,%ebp
+  8001dd:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001e0:	e8 a0 14 00 00       	call   801685 <close_all>
+	sys_env_destroy(0);
+  8001e5:	83 ec 0c             	sub    $0xc,%esp
+  8001e8:	6a 00                	push   $0x0
+  8001ea:	e8 5b 0a 00 00       	call   800c4a <sys_env_destroy>
+}
+  8001ef:	83 c4 10             	add    $0x10,%esp
+  8001f2:	c9                   	leave
+  8001f3:	c3                   	ret
+
+008001f4 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001f4:	55                   	push   %ebp
+  8001f5:	89 e5                	mov    %esp,%ebp
+  8001f7:	56                   	push   %esi
+  8001f8:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001f9:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001fc:	8b 35 08 40 80 00    	mov    0x804008,%esi
+  800202:	e8 84 0a 00 00       	call   800c8b <sys_getenvid>
+  800207:	83 ec 0c             	sub    $0xc,%esp
+  80020a:	ff 75 0c             	push   0xc(%ebp)
+  80020d:	ff 75 08             	push   0x8(%ebp)
+  800210:	56                   	push   %esi
+  800211:	50                   	push   %eax
+  800212:	68 50 33 80 00       	push   $0x803350
+  800217:	e8 b3 00 00 00       	call   8002cf <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80021c:	83 c4 18             	add    $0x18,%esp
+  80021f:	53                   	push   %ebx
+  800220:	ff 75 10             	push   0x10(%ebp)
+  800223:	e8 56 00 00 00       	call   80027e <vcprintf>
+	cprintf("\n");
+  800228:	c7 04 24 5c 39 80 00 	movl   $0x80395c,(%esp)
+  80022f:	e8 9b 00 00 00       	call   8002cf <cprintf>
+  800234:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800237:	cc                   	int3
+	while (1)
+  800238:	eb fd                	jmp    800237 <_panic+0x43>
+
+0080023a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80023a:	55                   	push   %ebp
+  80023b:	89 e5                	mov    %esp,%ebp
+  80023d:	53                   	push   %ebx
+  80023e:	83 ec 04             	sub    $0x4,%esp
+  800241:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800244:	8b 13                	mov    (%ebx),%edx
+  800246:	8d 42 01             	lea    0x1(%edx),%eax
+  800249:	89 03                	mov    %eax,(%ebx)
+  80024b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80024e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800252:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800257:	74 09                	je     800262 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800259:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80025d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800260:	c9                   	leave
+  800261:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800262:	83 ec 08             	sub    $0x8,%esp
+  800265:	68 ff 00 00 00       	push   $0xff
+  80026a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80026d:	50                   	push   %eax
+  80026e:	e8 7a 09 00 00       	call   800bed <sys_cputs>
+		b->idx = 0;
+  800273:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800279:	83 c4 10             	add    $0x10,%esp
+  80027c:	eb db                	jmp    800259 <putch+0x1f>
+
+0080027e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80027e:	55                   	push   %ebp
+  80027f:	89 e5                	mov    %esp,%ebp
+  800281:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800287:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80028e:	00 00 00 
+	b.cnt = 0;
+  800291:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800298:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80029b:	ff 75 0c             	push   0xc(%ebp)
+  80029e:	ff 75 08             	push   0x8(%ebp)
+  8002a1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002a7:	50                   	push   %eax
+  8002a8:	68 3a 02 80 00       	push   $0x80023a
+  8002ad:	e8 14 01 00 00       	call   8003c6 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002b2:	83 c4 08             	add    $0x8,%esp
+  8002b5:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002bb:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002c1:	50                   	push   %eax
+  8002c2:	e8 26 09 00 00       	call   800bed <sys_cputs>
+
+	return b.cnt;
+}
+  8002c7:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002cd:	c9                   	leave
+  8002ce:	c3                   	ret
+
+008002cf <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002cf:	55                   	push   %ebp
+  8002d0:	89 e5                	mov    %esp,%ebp
+  8002d2:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002d5:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002d8:	50                   	push   %eax
+  8002d9:	ff 75 08             	push   0x8(%ebp)
+  8002dc:	e8 9d ff ff ff       	call   80027e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002e1:	c9                   	leave
+  8002e2:	c3                   	ret
+
+008002e3 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002e3:	55                   	push   %ebp
+  8002e4:	89 e5                	mov    %esp,%ebp
+  8002e6:	57                   	push   %edi
+  8002e7:	56                   	push   %esi
+  8002e8:	53                   	push   %ebx
+  8002e9:	83 ec 1c             	sub    $0x1c,%esp
+  8002ec:	89 c7                	mov    %eax,%edi
+  8002ee:	89 d6                	mov    %edx,%esi
+  8002f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002f6:	89 d1                	mov    %edx,%ecx
+  8002f8:	89 c2                	mov    %eax,%edx
+  8002fa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002fd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800300:	8b 45 10             	mov    0x10(%ebp),%eax
+  800303:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800306:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800309:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800310:	39 c2                	cmp    %eax,%edx
+  800312:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800315:	72 3e                	jb     800355 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800317:	83 ec 0c             	sub    $0xc,%esp
+  80031a:	ff 75 18             	push   0x18(%ebp)
+  80031d:	83 eb 01             	sub    $0x1,%ebx
+  800320:	53                   	push   %ebx
+  800321:	50                   	push   %eax
+  800322:	83 ec 08             	sub    $0x8,%esp
+  800325:	ff 75 e4             	push   -0x1c(%ebp)
+  800328:	ff 75 e0             	push   -0x20(%ebp)
+  80032b:	ff 75 dc             	push   -0x24(%ebp)
+  80032e:	ff 75 d8             	push   -0x28(%ebp)
+  800331:	e8 fa 2b 00 00       	call   802f30 <__udivdi3>
+  800336:	83 c4 18             	add    $0x18,%esp
+  800339:	52                   	push   %edx
+  80033a:	50                   	push   %eax
+  80033b:	89 f2                	mov    %esi,%edx
+  80033d:	89 f8                	mov    %edi,%eax
+  80033f:	e8 9f ff ff ff       	call   8002e3 <printnum>
+  800344:	83 c4 20             	add    $0x20,%esp
+  800347:	eb 13                	jmp    80035c <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800349:	83 ec 08             	sub    $0x8,%esp
+  80034c:	56                   	push   %esi
+  80034d:	ff 75 18             	push   0x18(%ebp)
+  800350:	ff d7                	call   *%edi
+  800352:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800355:	83 eb 01             	sub    $0x1,%ebx
+  800358:	85 db                	test   %ebx,%ebx
+  80035a:	7f ed                	jg     800349 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80035c:	83 ec 08             	sub    $0x8,%esp
+  80035f:	56                   	push   %esi
+  800360:	83 ec 04             	sub    $0x4,%esp
+  800363:	ff 75 e4             	push   -0x1c(%ebp)
+  800366:	ff 75 e0             	push   -0x20(%ebp)
+  800369:	ff 75 dc             	push   -0x24(%ebp)
+  80036c:	ff 75 d8             	push   -0x28(%ebp)
+  80036f:	e8 7c 2c 00 00       	call   802ff0 <__umoddi3>
+  800374:	83 c4 14             	add    $0x14,%esp
+  800377:	0f be 80 73 33 80 00 	movsbl 0x803373(%eax),%eax
+  80037e:	50                   	push   %eax
+  80037f:	ff d7                	call   *%edi
+}
+  800381:	83 c4 10             	add    $0x10,%esp
+  800384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800387:	5b                   	pop    %ebx
+  800388:	5e                   	pop    %esi
+  800389:	5f                   	pop    %edi
+  80038a:	5d                   	pop    %ebp
+  80038b:	c3                   	ret
+
+0080038c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80038c:	55                   	push   %ebp
+  80038d:	89 e5                	mov    %esp,%ebp
+  80038f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800392:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800396:	8b 10                	mov    (%eax),%edx
+  800398:	3b 50 04             	cmp    0x4(%eax),%edx
+  80039b:	73 0a                	jae    8003a7 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80039d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003a0:	89 08                	mov    %ecx,(%eax)
+  8003a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003a5:	88 02                	mov    %al,(%edx)
+}
+  8003a7:	5d                   	pop    %ebp
+  8003a8:	c3                   	ret
+
+008003a9 <printfmt>:
+{
+  8003a9:	55                   	push   %ebp
+  8003aa:	89 e5                	mov    %esp,%ebp
+  8003ac:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003af:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003b2:	50                   	push   %eax
+  8003b3:	ff 75 10             	push   0x10(%ebp)
+  8003b6:	ff 75 0c             	push   0xc(%ebp)
+  8003b9:	ff 75 08             	push   0x8(%ebp)
+  8003bc:	e8 05 00 00 00       	call   8003c6 <vprintfmt>
+}
+  8003c1:	83 c4 10             	add    $0x10,%esp
+  8003c4:	c9                   	leave
+  8003c5:	c3                   	ret
+
+008003c6 <vprintfmt>:
+{
+  8003c6:	55                   	push   %ebp
+  8003c7:	89 e5                	mov    %esp,%ebp
+  8003c9:	57                   	push   %edi
+  8003ca:	56                   	push   %esi
+  8003cb:	53                   	push   %ebx
+  8003cc:	83 ec 2c             	sub    $0x2c,%esp
+  8003cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003d5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003d8:	eb 0a                	jmp    8003e4 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003da:	83 ec 08             	sub    $0x8,%esp
+  8003dd:	53                   	push   %ebx
+  8003de:	50                   	push   %eax
+  8003df:	ff d6                	call   *%esi
+  8003e1:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003e4:	83 c7 01             	add    $0x1,%edi
+  8003e7:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003eb:	83 f8 25             	cmp    $0x25,%eax
+  8003ee:	74 0c                	je     8003fc <vprintfmt+0x36>
+			if (ch == '\0')
+  8003f0:	85 c0                	test   %eax,%eax
+  8003f2:	75 e6                	jne    8003da <vprintfmt+0x14>
+}
+  8003f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f7:	5b                   	pop    %ebx
+  8003f8:	5e                   	pop    %esi
+  8003f9:	5f                   	pop    %edi
+  8003fa:	5d                   	pop    %ebp
+  8003fb:	c3                   	ret
+		padc = ' ';
+  8003fc:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800400:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800407:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80040e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800415:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80041a:	8d 47 01             	lea    0x1(%edi),%eax
+  80041d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800420:	0f b6 17             	movzbl (%edi),%edx
+  800423:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800426:	3c 55                	cmp    $0x55,%al
+  800428:	0f 87 cf 03 00 00    	ja     8007fd <vprintfmt+0x437>
+  80042e:	0f b6 c0             	movzbl %al,%eax
+  800431:	ff 24 85 c0 34 80 00 	jmp    *0x8034c0(,%eax,4)
+  800438:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80043b:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80043f:	eb d9                	jmp    80041a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800441:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800444:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800448:	eb d0                	jmp    80041a <vprintfmt+0x54>
+  80044a:	0f b6 d2             	movzbl %dl,%edx
+  80044d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800450:	b8 00 00 00 00       	mov    $0x0,%eax
+  800455:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800458:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80045b:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80045f:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800462:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800465:	83 f9 09             	cmp    $0x9,%ecx
+  800468:	77 55                	ja     8004bf <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80046a:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80046d:	eb e9                	jmp    800458 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80046f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800472:	8b 00                	mov    (%eax),%eax
+  800474:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800477:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047a:	8d 40 04             	lea    0x4(%eax),%eax
+  80047d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800480:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800483:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800487:	79 91                	jns    80041a <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800489:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80048c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80048f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800496:	eb 82                	jmp    80041a <vprintfmt+0x54>
+			if (width < 0)
+  800498:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80049b:	85 d2                	test   %edx,%edx
+  80049d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a2:	0f 49 c2             	cmovns %edx,%eax
+  8004a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004ab:	e9 6a ff ff ff       	jmp    80041a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004b3:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004ba:	e9 5b ff ff ff       	jmp    80041a <vprintfmt+0x54>
+  8004bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004c5:	eb bc                	jmp    800483 <vprintfmt+0xbd>
+			lflag++;
+  8004c7:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004cd:	e9 48 ff ff ff       	jmp    80041a <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d5:	8d 78 04             	lea    0x4(%eax),%edi
+  8004d8:	83 ec 08             	sub    $0x8,%esp
+  8004db:	53                   	push   %ebx
+  8004dc:	ff 30                	push   (%eax)
+  8004de:	ff d6                	call   *%esi
+			break;
+  8004e0:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004e3:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004e6:	e9 b1 02 00 00       	jmp    80079c <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8004eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ee:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004f1:	8b 10                	mov    (%eax),%edx
+  8004f3:	89 d0                	mov    %edx,%eax
+  8004f5:	f7 d8                	neg    %eax
+  8004f7:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004fa:	83 f8 0f             	cmp    $0xf,%eax
+  8004fd:	7f 23                	jg     800522 <vprintfmt+0x15c>
+  8004ff:	8b 14 85 20 36 80 00 	mov    0x803620(,%eax,4),%edx
+  800506:	85 d2                	test   %edx,%edx
+  800508:	74 18                	je     800522 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80050a:	52                   	push   %edx
+  80050b:	68 35 38 80 00       	push   $0x803835
+  800510:	53                   	push   %ebx
+  800511:	56                   	push   %esi
+  800512:	e8 92 fe ff ff       	call   8003a9 <printfmt>
+  800517:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80051a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80051d:	e9 7a 02 00 00       	jmp    80079c <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800522:	50                   	push   %eax
+  800523:	68 8b 33 80 00       	push   $0x80338b
+  800528:	53                   	push   %ebx
+  800529:	56                   	push   %esi
+  80052a:	e8 7a fe ff ff       	call   8003a9 <printfmt>
+  80052f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800532:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800535:	e9 62 02 00 00       	jmp    80079c <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80053a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053d:	83 c0 04             	add    $0x4,%eax
+  800540:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800543:	8b 45 14             	mov    0x14(%ebp),%eax
+  800546:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800548:	85 c9                	test   %ecx,%ecx
+  80054a:	b8 84 33 80 00       	mov    $0x803384,%eax
+  80054f:	0f 45 c1             	cmovne %ecx,%eax
+  800552:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800555:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800559:	7e 06                	jle    800561 <vprintfmt+0x19b>
+  80055b:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80055f:	75 0b                	jne    80056c <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800561:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800564:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800567:	89 75 08             	mov    %esi,0x8(%ebp)
+  80056a:	eb 5c                	jmp    8005c8 <vprintfmt+0x202>
+  80056c:	83 ec 08             	sub    $0x8,%esp
+  80056f:	ff 75 d0             	push   -0x30(%ebp)
+  800572:	ff 75 cc             	push   -0x34(%ebp)
+  800575:	e8 20 03 00 00       	call   80089a <strnlen>
+  80057a:	89 c2                	mov    %eax,%edx
+  80057c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80057f:	29 d0                	sub    %edx,%eax
+  800581:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800584:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800588:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80058b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80058e:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800590:	eb 0e                	jmp    8005a0 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800592:	83 ec 08             	sub    $0x8,%esp
+  800595:	53                   	push   %ebx
+  800596:	57                   	push   %edi
+  800597:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059a:	83 ee 01             	sub    $0x1,%esi
+  80059d:	83 c4 10             	add    $0x10,%esp
+  8005a0:	85 f6                	test   %esi,%esi
+  8005a2:	7f ee                	jg     800592 <vprintfmt+0x1cc>
+  8005a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005aa:	85 c0                	test   %eax,%eax
+  8005ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b1:	0f 49 d0             	cmovns %eax,%edx
+  8005b4:	29 d0                	sub    %edx,%eax
+  8005b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005b9:	eb a6                	jmp    800561 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005bb:	83 ec 08             	sub    $0x8,%esp
+  8005be:	53                   	push   %ebx
+  8005bf:	52                   	push   %edx
+  8005c0:	ff 55 08             	call   *0x8(%ebp)
+  8005c3:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005c6:	89 f1                	mov    %esi,%ecx
+  8005c8:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005cb:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005cf:	0f be d0             	movsbl %al,%edx
+  8005d2:	85 d2                	test   %edx,%edx
+  8005d4:	74 28                	je     8005fe <vprintfmt+0x238>
+  8005d6:	85 ff                	test   %edi,%edi
+  8005d8:	78 05                	js     8005df <vprintfmt+0x219>
+  8005da:	83 ef 01             	sub    $0x1,%edi
+  8005dd:	78 30                	js     80060f <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005df:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e3:	74 d6                	je     8005bb <vprintfmt+0x1f5>
+  8005e5:	0f be c0             	movsbl %al,%eax
+  8005e8:	83 e8 20             	sub    $0x20,%eax
+  8005eb:	83 f8 5e             	cmp    $0x5e,%eax
+  8005ee:	76 cb                	jbe    8005bb <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005f0:	83 ec 08             	sub    $0x8,%esp
+  8005f3:	53                   	push   %ebx
+  8005f4:	6a 3f                	push   $0x3f
+  8005f6:	ff 55 08             	call   *0x8(%ebp)
+  8005f9:	83 c4 10             	add    $0x10,%esp
+  8005fc:	eb c8                	jmp    8005c6 <vprintfmt+0x200>
+  8005fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800601:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800604:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800607:	01 d0                	add    %edx,%eax
+  800609:	29 c8                	sub    %ecx,%eax
+  80060b:	89 c7                	mov    %eax,%edi
+  80060d:	eb 13                	jmp    800622 <vprintfmt+0x25c>
+  80060f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800612:	eb ed                	jmp    800601 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800614:	83 ec 08             	sub    $0x8,%esp
+  800617:	53                   	push   %ebx
+  800618:	6a 20                	push   $0x20
+  80061a:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80061c:	83 ef 01             	sub    $0x1,%edi
+  80061f:	83 c4 10             	add    $0x10,%esp
+  800622:	85 ff                	test   %edi,%edi
+  800624:	7f ee                	jg     800614 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800626:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800629:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062c:	e9 6b 01 00 00       	jmp    80079c <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800631:	83 f9 01             	cmp    $0x1,%ecx
+  800634:	7f 1f                	jg     800655 <vprintfmt+0x28f>
+	else if (lflag)
+  800636:	85 c9                	test   %ecx,%ecx
+  800638:	74 67                	je     8006a1 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80063a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063d:	8b 00                	mov    (%eax),%eax
+  80063f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800642:	89 c1                	mov    %eax,%ecx
+  800644:	c1 f9 1f             	sar    $0x1f,%ecx
+  800647:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80064a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064d:	8d 40 04             	lea    0x4(%eax),%eax
+  800650:	89 45 14             	mov    %eax,0x14(%ebp)
+  800653:	eb 17                	jmp    80066c <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800655:	8b 45 14             	mov    0x14(%ebp),%eax
+  800658:	8b 50 04             	mov    0x4(%eax),%edx
+  80065b:	8b 00                	mov    (%eax),%eax
+  80065d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800660:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800663:	8b 45 14             	mov    0x14(%ebp),%eax
+  800666:	8d 40 08             	lea    0x8(%eax),%eax
+  800669:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80066c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80066f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800672:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800677:	85 c9                	test   %ecx,%ecx
+  800679:	0f 89 03 01 00 00    	jns    800782 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80067f:	83 ec 08             	sub    $0x8,%esp
+  800682:	53                   	push   %ebx
+  800683:	6a 2d                	push   $0x2d
+  800685:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800687:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80068a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80068d:	f7 da                	neg    %edx
+  80068f:	83 d1 00             	adc    $0x0,%ecx
+  800692:	f7 d9                	neg    %ecx
+  800694:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800697:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80069c:	e9 e1 00 00 00       	jmp    800782 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a4:	8b 00                	mov    (%eax),%eax
+  8006a6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a9:	89 c1                	mov    %eax,%ecx
+  8006ab:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006ae:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ba:	eb b0                	jmp    80066c <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006bc:	83 f9 01             	cmp    $0x1,%ecx
+  8006bf:	7f 1e                	jg     8006df <vprintfmt+0x319>
+	else if (lflag)
+  8006c1:	85 c9                	test   %ecx,%ecx
+  8006c3:	74 32                	je     8006f7 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8006c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c8:	8b 10                	mov    (%eax),%edx
+  8006ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006da:	e9 a3 00 00 00       	jmp    800782 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e2:	8b 10                	mov    (%eax),%edx
+  8006e4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006e7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ed:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006f2:	e9 8b 00 00 00       	jmp    800782 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fa:	8b 10                	mov    (%eax),%edx
+  8006fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800701:	8d 40 04             	lea    0x4(%eax),%eax
+  800704:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800707:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80070c:	eb 74                	jmp    800782 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80070e:	83 f9 01             	cmp    $0x1,%ecx
+  800711:	7f 1b                	jg     80072e <vprintfmt+0x368>
+	else if (lflag)
+  800713:	85 c9                	test   %ecx,%ecx
+  800715:	74 2c                	je     800743 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800717:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071a:	8b 10                	mov    (%eax),%edx
+  80071c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800721:	8d 40 04             	lea    0x4(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800727:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80072c:	eb 54                	jmp    800782 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8b 10                	mov    (%eax),%edx
+  800733:	8b 48 04             	mov    0x4(%eax),%ecx
+  800736:	8d 40 08             	lea    0x8(%eax),%eax
+  800739:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80073c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800741:	eb 3f                	jmp    800782 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800743:	8b 45 14             	mov    0x14(%ebp),%eax
+  800746:	8b 10                	mov    (%eax),%edx
+  800748:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074d:	8d 40 04             	lea    0x4(%eax),%eax
+  800750:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800753:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800758:	eb 28                	jmp    800782 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80075a:	83 ec 08             	sub    $0x8,%esp
+  80075d:	53                   	push   %ebx
+  80075e:	6a 30                	push   $0x30
+  800760:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800762:	83 c4 08             	add    $0x8,%esp
+  800765:	53                   	push   %ebx
+  800766:	6a 78                	push   $0x78
+  800768:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80076a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076d:	8b 10                	mov    (%eax),%edx
+  80076f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800774:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800777:	8d 40 04             	lea    0x4(%eax),%eax
+  80077a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80077d:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800782:	83 ec 0c             	sub    $0xc,%esp
+  800785:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800789:	50                   	push   %eax
+  80078a:	ff 75 e0             	push   -0x20(%ebp)
+  80078d:	57                   	push   %edi
+  80078e:	51                   	push   %ecx
+  80078f:	52                   	push   %edx
+  800790:	89 da                	mov    %ebx,%edx
+  800792:	89 f0                	mov    %esi,%eax
+  800794:	e8 4a fb ff ff       	call   8002e3 <printnum>
+			break;
+  800799:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80079c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80079f:	e9 40 fc ff ff       	jmp    8003e4 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007a4:	83 f9 01             	cmp    $0x1,%ecx
+  8007a7:	7f 1b                	jg     8007c4 <vprintfmt+0x3fe>
+	else if (lflag)
+  8007a9:	85 c9                	test   %ecx,%ecx
+  8007ab:	74 2c                	je     8007d9 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b0:	8b 10                	mov    (%eax),%edx
+  8007b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007bd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007c2:	eb be                	jmp    800782 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c7:	8b 10                	mov    (%eax),%edx
+  8007c9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007cc:	8d 40 08             	lea    0x8(%eax),%eax
+  8007cf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007d7:	eb a9                	jmp    800782 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007dc:	8b 10                	mov    (%eax),%edx
+  8007de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007ee:	eb 92                	jmp    800782 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8007f0:	83 ec 08             	sub    $0x8,%esp
+  8007f3:	53                   	push   %ebx
+  8007f4:	6a 25                	push   $0x25
+  8007f6:	ff d6                	call   *%esi
+			break;
+  8007f8:	83 c4 10             	add    $0x10,%esp
+  8007fb:	eb 9f                	jmp    80079c <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8007fd:	83 ec 08             	sub    $0x8,%esp
+  800800:	53                   	push   %ebx
+  800801:	6a 25                	push   $0x25
+  800803:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800805:	83 c4 10             	add    $0x10,%esp
+  800808:	89 f8                	mov    %edi,%eax
+  80080a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80080e:	74 05                	je     800815 <vprintfmt+0x44f>
+  800810:	83 e8 01             	sub    $0x1,%eax
+  800813:	eb f5                	jmp    80080a <vprintfmt+0x444>
+  800815:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800818:	eb 82                	jmp    80079c <vprintfmt+0x3d6>
+
+0080081a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80081a:	55                   	push   %ebp
+  80081b:	89 e5                	mov    %esp,%ebp
+  80081d:	83 ec 18             	sub    $0x18,%esp
+  800820:	8b 45 08             	mov    0x8(%ebp),%eax
+  800823:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800826:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800829:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80082d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800830:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800837:	85 c0                	test   %eax,%eax
+  800839:	74 26                	je     800861 <vsnprintf+0x47>
+  80083b:	85 d2                	test   %edx,%edx
+  80083d:	7e 22                	jle    800861 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80083f:	ff 75 14             	push   0x14(%ebp)
+  800842:	ff 75 10             	push   0x10(%ebp)
+  800845:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800848:	50                   	push   %eax
+  800849:	68 8c 03 80 00       	push   $0x80038c
+  80084e:	e8 73 fb ff ff       	call   8003c6 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800853:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800856:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800859:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80085c:	83 c4 10             	add    $0x10,%esp
+}
+  80085f:	c9                   	leave
+  800860:	c3                   	ret
+		return -E_INVAL;
+  800861:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800866:	eb f7                	jmp    80085f <vsnprintf+0x45>
+
+00800868 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800868:	55                   	push   %ebp
+  800869:	89 e5                	mov    %esp,%ebp
+  80086b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80086e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800871:	50                   	push   %eax
+  800872:	ff 75 10             	push   0x10(%ebp)
+  800875:	ff 75 0c             	push   0xc(%ebp)
+  800878:	ff 75 08             	push   0x8(%ebp)
+  80087b:	e8 9a ff ff ff       	call   80081a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800880:	c9                   	leave
+  800881:	c3                   	ret
+
+00800882 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088d:	eb 03                	jmp    800892 <strlen+0x10>
+		n++;
+  80088f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800892:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800896:	75 f7                	jne    80088f <strlen+0xd>
+	return n;
+}
+  800898:	5d                   	pop    %ebp
+  800899:	c3                   	ret
+
+0080089a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80089a:	55                   	push   %ebp
+  80089b:	89 e5                	mov    %esp,%ebp
+  80089d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a8:	eb 03                	jmp    8008ad <strnlen+0x13>
+		n++;
+  8008aa:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ad:	39 d0                	cmp    %edx,%eax
+  8008af:	74 08                	je     8008b9 <strnlen+0x1f>
+  8008b1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008b5:	75 f3                	jne    8008aa <strnlen+0x10>
+  8008b7:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008b9:	89 d0                	mov    %edx,%eax
+  8008bb:	5d                   	pop    %ebp
+  8008bc:	c3                   	ret
+
+008008bd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	53                   	push   %ebx
+  8008c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cc:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008d0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008d3:	83 c0 01             	add    $0x1,%eax
+  8008d6:	84 d2                	test   %dl,%dl
+  8008d8:	75 f2                	jne    8008cc <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008da:	89 c8                	mov    %ecx,%eax
+  8008dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008df:	c9                   	leave
+  8008e0:	c3                   	ret
+
+008008e1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008e1:	55                   	push   %ebp
+  8008e2:	89 e5                	mov    %esp,%ebp
+  8008e4:	53                   	push   %ebx
+  8008e5:	83 ec 10             	sub    $0x10,%esp
+  8008e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008eb:	53                   	push   %ebx
+  8008ec:	e8 91 ff ff ff       	call   800882 <strlen>
+  8008f1:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008f4:	ff 75 0c             	push   0xc(%ebp)
+  8008f7:	01 d8                	add    %ebx,%eax
+  8008f9:	50                   	push   %eax
+  8008fa:	e8 be ff ff ff       	call   8008bd <strcpy>
+	return dst;
+}
+  8008ff:	89 d8                	mov    %ebx,%eax
+  800901:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800904:	c9                   	leave
+  800905:	c3                   	ret
+
+00800906 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800906:	55                   	push   %ebp
+  800907:	89 e5                	mov    %esp,%ebp
+  800909:	56                   	push   %esi
+  80090a:	53                   	push   %ebx
+  80090b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80090e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800911:	89 f3                	mov    %esi,%ebx
+  800913:	03 5d 10             	add    0x10(%ebp),%ebx
+  800916:	89 f0                	mov    %esi,%eax
+  800918:	eb 0f                	jmp    800929 <strncpy+0x23>
+		*dst++ = *src;
+  80091a:	83 c0 01             	add    $0x1,%eax
+  80091d:	0f b6 0a             	movzbl (%edx),%ecx
+  800920:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800923:	80 f9 01             	cmp    $0x1,%cl
+  800926:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800929:	39 d8                	cmp    %ebx,%eax
+  80092b:	75 ed                	jne    80091a <strncpy+0x14>
+	}
+	return ret;
+}
+  80092d:	89 f0                	mov    %esi,%eax
+  80092f:	5b                   	pop    %ebx
+  800930:	5e                   	pop    %esi
+  800931:	5d                   	pop    %ebp
+  800932:	c3                   	ret
+
+00800933 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	56                   	push   %esi
+  800937:	53                   	push   %ebx
+  800938:	8b 75 08             	mov    0x8(%ebp),%esi
+  80093b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80093e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800941:	89 f0                	mov    %esi,%eax
+  800943:	85 d2                	test   %edx,%edx
+  800945:	74 21                	je     800968 <strlcpy+0x35>
+  800947:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80094b:	89 f2                	mov    %esi,%edx
+  80094d:	eb 09                	jmp    800958 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80094f:	83 c1 01             	add    $0x1,%ecx
+  800952:	83 c2 01             	add    $0x1,%edx
+  800955:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800958:	39 c2                	cmp    %eax,%edx
+  80095a:	74 09                	je     800965 <strlcpy+0x32>
+  80095c:	0f b6 19             	movzbl (%ecx),%ebx
+  80095f:	84 db                	test   %bl,%bl
+  800961:	75 ec                	jne    80094f <strlcpy+0x1c>
+  800963:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800965:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800968:	29 f0                	sub    %esi,%eax
+}
+  80096a:	5b                   	pop    %ebx
+  80096b:	5e                   	pop    %esi
+  80096c:	5d                   	pop    %ebp
+  80096d:	c3                   	ret
+
+0080096e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800974:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800977:	eb 06                	jmp    80097f <strcmp+0x11>
+		p++, q++;
+  800979:	83 c1 01             	add    $0x1,%ecx
+  80097c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80097f:	0f b6 01             	movzbl (%ecx),%eax
+  800982:	84 c0                	test   %al,%al
+  800984:	74 04                	je     80098a <strcmp+0x1c>
+  800986:	3a 02                	cmp    (%edx),%al
+  800988:	74 ef                	je     800979 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80098a:	0f b6 c0             	movzbl %al,%eax
+  80098d:	0f b6 12             	movzbl (%edx),%edx
+  800990:	29 d0                	sub    %edx,%eax
+}
+  800992:	5d                   	pop    %ebp
+  800993:	c3                   	ret
+
+00800994 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800994:	55                   	push   %ebp
+  800995:	89 e5                	mov    %esp,%ebp
+  800997:	53                   	push   %ebx
+  800998:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80099e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009a1:	eb 09                	jmp    8009ac <strncmp+0x18>
+		n--, p++, q++;
+  8009a3:	83 ea 01             	sub    $0x1,%edx
+  8009a6:	83 c0 01             	add    $0x1,%eax
+  8009a9:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009ac:	85 d2                	test   %edx,%edx
+  8009ae:	74 18                	je     8009c8 <strncmp+0x34>
+  8009b0:	0f b6 18             	movzbl (%eax),%ebx
+  8009b3:	84 db                	test   %bl,%bl
+  8009b5:	74 04                	je     8009bb <strncmp+0x27>
+  8009b7:	3a 19                	cmp    (%ecx),%bl
+  8009b9:	74 e8                	je     8009a3 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009bb:	0f b6 00             	movzbl (%eax),%eax
+  8009be:	0f b6 11             	movzbl (%ecx),%edx
+  8009c1:	29 d0                	sub    %edx,%eax
+}
+  8009c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c6:	c9                   	leave
+  8009c7:	c3                   	ret
+		return 0;
+  8009c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cd:	eb f4                	jmp    8009c3 <strncmp+0x2f>
+
+008009cf <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009cf:	55                   	push   %ebp
+  8009d0:	89 e5                	mov    %esp,%ebp
+  8009d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009d9:	eb 03                	jmp    8009de <strchr+0xf>
+  8009db:	83 c0 01             	add    $0x1,%eax
+  8009de:	0f b6 10             	movzbl (%eax),%edx
+  8009e1:	84 d2                	test   %dl,%dl
+  8009e3:	74 06                	je     8009eb <strchr+0x1c>
+		if (*s == c)
+  8009e5:	38 ca                	cmp    %cl,%dl
+  8009e7:	75 f2                	jne    8009db <strchr+0xc>
+  8009e9:	eb 05                	jmp    8009f0 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f0:	5d                   	pop    %ebp
+  8009f1:	c3                   	ret
+
+008009f2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009f2:	55                   	push   %ebp
+  8009f3:	89 e5                	mov    %esp,%ebp
+  8009f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009fc:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009ff:	38 ca                	cmp    %cl,%dl
+  800a01:	74 09                	je     800a0c <strfind+0x1a>
+  800a03:	84 d2                	test   %dl,%dl
+  800a05:	74 05                	je     800a0c <strfind+0x1a>
+	for (; *s; s++)
+  800a07:	83 c0 01             	add    $0x1,%eax
+  800a0a:	eb f0                	jmp    8009fc <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a0c:	5d                   	pop    %ebp
+  800a0d:	c3                   	ret
+
+00800a0e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a0e:	55                   	push   %ebp
+  800a0f:	89 e5                	mov    %esp,%ebp
+  800a11:	57                   	push   %edi
+  800a12:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a15:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a18:	85 c9                	test   %ecx,%ecx
+  800a1a:	74 20                	je     800a3c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a1c:	89 f8                	mov    %edi,%eax
+  800a1e:	09 c8                	or     %ecx,%eax
+  800a20:	a8 03                	test   $0x3,%al
+  800a22:	75 12                	jne    800a36 <memset+0x28>
+		c &= 0xFF;
+  800a24:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a28:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a2e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a31:	fc                   	cld
+  800a32:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a34:	eb 06                	jmp    800a3c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a36:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a39:	fc                   	cld
+  800a3a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a3c:	89 f8                	mov    %edi,%eax
+  800a3e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a41:	c9                   	leave
+  800a42:	c3                   	ret
+
+00800a43 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a43:	55                   	push   %ebp
+  800a44:	89 e5                	mov    %esp,%ebp
+  800a46:	57                   	push   %edi
+  800a47:	56                   	push   %esi
+  800a48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a4e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a51:	39 c6                	cmp    %eax,%esi
+  800a53:	73 32                	jae    800a87 <memmove+0x44>
+  800a55:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a58:	39 d0                	cmp    %edx,%eax
+  800a5a:	73 2b                	jae    800a87 <memmove+0x44>
+		s += n;
+		d += n;
+  800a5c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a5f:	89 d6                	mov    %edx,%esi
+  800a61:	09 fe                	or     %edi,%esi
+  800a63:	09 ce                	or     %ecx,%esi
+  800a65:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a6b:	75 0e                	jne    800a7b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a6d:	83 ef 04             	sub    $0x4,%edi
+  800a70:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a73:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a76:	fd                   	std
+  800a77:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a79:	eb 09                	jmp    800a84 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a7b:	83 ef 01             	sub    $0x1,%edi
+  800a7e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a81:	fd                   	std
+  800a82:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a84:	fc                   	cld
+  800a85:	eb 1a                	jmp    800aa1 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a87:	89 f2                	mov    %esi,%edx
+  800a89:	09 c2                	or     %eax,%edx
+  800a8b:	09 ca                	or     %ecx,%edx
+  800a8d:	f6 c2 03             	test   $0x3,%dl
+  800a90:	75 0a                	jne    800a9c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a92:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a95:	89 c7                	mov    %eax,%edi
+  800a97:	fc                   	cld
+  800a98:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a9a:	eb 05                	jmp    800aa1 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a9c:	89 c7                	mov    %eax,%edi
+  800a9e:	fc                   	cld
+  800a9f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aa1:	5e                   	pop    %esi
+  800aa2:	5f                   	pop    %edi
+  800aa3:	5d                   	pop    %ebp
+  800aa4:	c3                   	ret
+
+00800aa5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800aa5:	55                   	push   %ebp
+  800aa6:	89 e5                	mov    %esp,%ebp
+  800aa8:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800aab:	ff 75 10             	push   0x10(%ebp)
+  800aae:	ff 75 0c             	push   0xc(%ebp)
+  800ab1:	ff 75 08             	push   0x8(%ebp)
+  800ab4:	e8 8a ff ff ff       	call   800a43 <memmove>
+}
+  800ab9:	c9                   	leave
+  800aba:	c3                   	ret
+
+00800abb <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800abb:	55                   	push   %ebp
+  800abc:	89 e5                	mov    %esp,%ebp
+  800abe:	56                   	push   %esi
+  800abf:	53                   	push   %ebx
+  800ac0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ac6:	89 c6                	mov    %eax,%esi
+  800ac8:	03 75 10             	add    0x10(%ebp),%esi
+  800acb:	eb 06                	jmp    800ad3 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800acd:	83 c0 01             	add    $0x1,%eax
+  800ad0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ad3:	39 f0                	cmp    %esi,%eax
+  800ad5:	74 14                	je     800aeb <memcmp+0x30>
+		if (*s1 != *s2)
+  800ad7:	0f b6 08             	movzbl (%eax),%ecx
+  800ada:	0f b6 1a             	movzbl (%edx),%ebx
+  800add:	38 d9                	cmp    %bl,%cl
+  800adf:	74 ec                	je     800acd <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ae1:	0f b6 c1             	movzbl %cl,%eax
+  800ae4:	0f b6 db             	movzbl %bl,%ebx
+  800ae7:	29 d8                	sub    %ebx,%eax
+  800ae9:	eb 05                	jmp    800af0 <memcmp+0x35>
+	}
+
+	return 0;
+  800aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af0:	5b                   	pop    %ebx
+  800af1:	5e                   	pop    %esi
+  800af2:	5d                   	pop    %ebp
+  800af3:	c3                   	ret
+
+00800af4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800af4:	55                   	push   %ebp
+  800af5:	89 e5                	mov    %esp,%ebp
+  800af7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800afd:	89 c2                	mov    %eax,%edx
+  800aff:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b02:	eb 03                	jmp    800b07 <memfind+0x13>
+  800b04:	83 c0 01             	add    $0x1,%eax
+  800b07:	39 d0                	cmp    %edx,%eax
+  800b09:	73 04                	jae    800b0f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b0b:	38 08                	cmp    %cl,(%eax)
+  800b0d:	75 f5                	jne    800b04 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b0f:	5d                   	pop    %ebp
+  800b10:	c3                   	ret
+
+00800b11 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b11:	55                   	push   %ebp
+  800b12:	89 e5                	mov    %esp,%ebp
+  800b14:	57                   	push   %edi
+  800b15:	56                   	push   %esi
+  800b16:	53                   	push   %ebx
+  800b17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b1d:	eb 03                	jmp    800b22 <strtol+0x11>
+		s++;
+  800b1f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b22:	0f b6 02             	movzbl (%edx),%eax
+  800b25:	3c 20                	cmp    $0x20,%al
+  800b27:	74 f6                	je     800b1f <strtol+0xe>
+  800b29:	3c 09                	cmp    $0x9,%al
+  800b2b:	74 f2                	je     800b1f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b2d:	3c 2b                	cmp    $0x2b,%al
+  800b2f:	74 2a                	je     800b5b <strtol+0x4a>
+	int neg = 0;
+  800b31:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b36:	3c 2d                	cmp    $0x2d,%al
+  800b38:	74 2b                	je     800b65 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b3a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b40:	75 0f                	jne    800b51 <strtol+0x40>
+  800b42:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b45:	74 28                	je     800b6f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b47:	85 db                	test   %ebx,%ebx
+  800b49:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b4e:	0f 44 d8             	cmove  %eax,%ebx
+  800b51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b56:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b59:	eb 46                	jmp    800ba1 <strtol+0x90>
+		s++;
+  800b5b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b63:	eb d5                	jmp    800b3a <strtol+0x29>
+		s++, neg = 1;
+  800b65:	83 c2 01             	add    $0x1,%edx
+  800b68:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b6d:	eb cb                	jmp    800b3a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b6f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b73:	74 0e                	je     800b83 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b75:	85 db                	test   %ebx,%ebx
+  800b77:	75 d8                	jne    800b51 <strtol+0x40>
+		s++, base = 8;
+  800b79:	83 c2 01             	add    $0x1,%edx
+  800b7c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b81:	eb ce                	jmp    800b51 <strtol+0x40>
+		s += 2, base = 16;
+  800b83:	83 c2 02             	add    $0x2,%edx
+  800b86:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b8b:	eb c4                	jmp    800b51 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b8d:	0f be c0             	movsbl %al,%eax
+  800b90:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b93:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b96:	7d 3a                	jge    800bd2 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b98:	83 c2 01             	add    $0x1,%edx
+  800b9b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b9f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ba1:	0f b6 02             	movzbl (%edx),%eax
+  800ba4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ba7:	89 f3                	mov    %esi,%ebx
+  800ba9:	80 fb 09             	cmp    $0x9,%bl
+  800bac:	76 df                	jbe    800b8d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bae:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bb1:	89 f3                	mov    %esi,%ebx
+  800bb3:	80 fb 19             	cmp    $0x19,%bl
+  800bb6:	77 08                	ja     800bc0 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bb8:	0f be c0             	movsbl %al,%eax
+  800bbb:	83 e8 57             	sub    $0x57,%eax
+  800bbe:	eb d3                	jmp    800b93 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bc3:	89 f3                	mov    %esi,%ebx
+  800bc5:	80 fb 19             	cmp    $0x19,%bl
+  800bc8:	77 08                	ja     800bd2 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bca:	0f be c0             	movsbl %al,%eax
+  800bcd:	83 e8 37             	sub    $0x37,%eax
+  800bd0:	eb c1                	jmp    800b93 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bd2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bd6:	74 05                	je     800bdd <strtol+0xcc>
+		*endptr = (char *) s;
+  800bd8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bdb:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bdd:	89 c8                	mov    %ecx,%eax
+  800bdf:	f7 d8                	neg    %eax
+  800be1:	85 ff                	test   %edi,%edi
+  800be3:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800be6:	89 c8                	mov    %ecx,%eax
+  800be8:	5b                   	pop    %ebx
+  800be9:	5e                   	pop    %esi
+  800bea:	5f                   	pop    %edi
+  800beb:	5d                   	pop    %ebp
+  800bec:	c3                   	ret
+
+00800bed <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bed:	55                   	push   %ebp
+  800bee:	89 e5                	mov    %esp,%ebp
+  800bf0:	57                   	push   %edi
+  800bf1:	56                   	push   %esi
+  800bf2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfe:	89 c3                	mov    %eax,%ebx
+  800c00:	89 c7                	mov    %eax,%edi
+  800c02:	89 c6                	mov    %eax,%esi
+  800c04:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c06:	5b                   	pop    %ebx
+  800c07:	5e                   	pop    %esi
+  800c08:	5f                   	pop    %edi
+  800c09:	5d                   	pop    %ebp
+  800c0a:	c3                   	ret
+
+00800c0b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c0b:	55                   	push   %ebp
+  800c0c:	89 e5                	mov    %esp,%ebp
+  800c0e:	57                   	push   %edi
+  800c0f:	56                   	push   %esi
+  800c10:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c16:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c1b:	89 d1                	mov    %edx,%ecx
+  800c1d:	89 d3                	mov    %edx,%ebx
+  800c1f:	89 d7                	mov    %edx,%edi
+  800c21:	89 d6                	mov    %edx,%esi
+  800c23:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c25:	5b                   	pop    %ebx
+  800c26:	5e                   	pop    %esi
+  800c27:	5f                   	pop    %edi
+  800c28:	5d                   	pop    %ebp
+  800c29:	c3                   	ret
+
+00800c2a <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800c2a:	55                   	push   %ebp
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	57                   	push   %edi
+  800c2e:	56                   	push   %esi
+  800c2f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c38:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c3d:	89 cb                	mov    %ecx,%ebx
+  800c3f:	89 cf                	mov    %ecx,%edi
+  800c41:	89 ce                	mov    %ecx,%esi
+  800c43:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800c45:	5b                   	pop    %ebx
+  800c46:	5e                   	pop    %esi
+  800c47:	5f                   	pop    %edi
+  800c48:	5d                   	pop    %ebp
+  800c49:	c3                   	ret
+
+00800c4a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c4a:	55                   	push   %ebp
+  800c4b:	89 e5                	mov    %esp,%ebp
+  800c4d:	57                   	push   %edi
+  800c4e:	56                   	push   %esi
+  800c4f:	53                   	push   %ebx
+  800c50:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c60:	89 cb                	mov    %ecx,%ebx
+  800c62:	89 cf                	mov    %ecx,%edi
+  800c64:	89 ce                	mov    %ecx,%esi
+  800c66:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c68:	85 c0                	test   %eax,%eax
+  800c6a:	7f 08                	jg     800c74 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6f:	5b                   	pop    %ebx
+  800c70:	5e                   	pop    %esi
+  800c71:	5f                   	pop    %edi
+  800c72:	5d                   	pop    %ebp
+  800c73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c74:	83 ec 0c             	sub    $0xc,%esp
+  800c77:	50                   	push   %eax
+  800c78:	6a 03                	push   $0x3
+  800c7a:	68 7f 36 80 00       	push   $0x80367f
+  800c7f:	6a 23                	push   $0x23
+  800c81:	68 9c 36 80 00       	push   $0x80369c
+  800c86:	e8 69 f5 ff ff       	call   8001f4 <_panic>
+
+00800c8b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c8b:	55                   	push   %ebp
+  800c8c:	89 e5                	mov    %esp,%ebp
+  800c8e:	57                   	push   %edi
+  800c8f:	56                   	push   %esi
+  800c90:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c96:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c9b:	89 d1                	mov    %edx,%ecx
+  800c9d:	89 d3                	mov    %edx,%ebx
+  800c9f:	89 d7                	mov    %edx,%edi
+  800ca1:	89 d6                	mov    %edx,%esi
+  800ca3:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ca5:	5b                   	pop    %ebx
+  800ca6:	5e                   	pop    %esi
+  800ca7:	5f                   	pop    %edi
+  800ca8:	5d                   	pop    %ebp
+  800ca9:	c3                   	ret
+
+00800caa <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800caa:	55                   	push   %ebp
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	57                   	push   %edi
+  800cae:	56                   	push   %esi
+  800caf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb5:	b8 16 00 00 00       	mov    $0x16,%eax
+  800cba:	89 d1                	mov    %edx,%ecx
+  800cbc:	89 d3                	mov    %edx,%ebx
+  800cbe:	89 d7                	mov    %edx,%edi
+  800cc0:	89 d6                	mov    %edx,%esi
+  800cc2:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cc4:	5b                   	pop    %ebx
+  800cc5:	5e                   	pop    %esi
+  800cc6:	5f                   	pop    %edi
+  800cc7:	5d                   	pop    %ebp
+  800cc8:	c3                   	ret
+
+00800cc9 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	57                   	push   %edi
+  800ccd:	56                   	push   %esi
+  800cce:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ccf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800cd9:	89 d1                	mov    %edx,%ecx
+  800cdb:	89 d3                	mov    %edx,%ebx
+  800cdd:	89 d7                	mov    %edx,%edi
+  800cdf:	89 d6                	mov    %edx,%esi
+  800ce1:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800ce3:	5b                   	pop    %ebx
+  800ce4:	5e                   	pop    %esi
+  800ce5:	5f                   	pop    %edi
+  800ce6:	5d                   	pop    %ebp
+  800ce7:	c3                   	ret
+
+00800ce8 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800ce8:	55                   	push   %ebp
+  800ce9:	89 e5                	mov    %esp,%ebp
+  800ceb:	57                   	push   %edi
+  800cec:	56                   	push   %esi
+  800ced:	53                   	push   %ebx
+  800cee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cf1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfc:	b8 15 00 00 00       	mov    $0x15,%eax
+  800d01:	89 df                	mov    %ebx,%edi
+  800d03:	89 de                	mov    %ebx,%esi
+  800d05:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d07:	85 c0                	test   %eax,%eax
+  800d09:	7f 08                	jg     800d13 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800d0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0e:	5b                   	pop    %ebx
+  800d0f:	5e                   	pop    %esi
+  800d10:	5f                   	pop    %edi
+  800d11:	5d                   	pop    %ebp
+  800d12:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d13:	83 ec 0c             	sub    $0xc,%esp
+  800d16:	50                   	push   %eax
+  800d17:	6a 15                	push   $0x15
+  800d19:	68 7f 36 80 00       	push   $0x80367f
+  800d1e:	6a 23                	push   $0x23
+  800d20:	68 9c 36 80 00       	push   $0x80369c
+  800d25:	e8 ca f4 ff ff       	call   8001f4 <_panic>
+
+00800d2a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d2a:	55                   	push   %ebp
+  800d2b:	89 e5                	mov    %esp,%ebp
+  800d2d:	57                   	push   %edi
+  800d2e:	56                   	push   %esi
+  800d2f:	53                   	push   %ebx
+  800d30:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d33:	be 00 00 00 00       	mov    $0x0,%esi
+  800d38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d46:	89 f7                	mov    %esi,%edi
+  800d48:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d4a:	85 c0                	test   %eax,%eax
+  800d4c:	7f 08                	jg     800d56 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d51:	5b                   	pop    %ebx
+  800d52:	5e                   	pop    %esi
+  800d53:	5f                   	pop    %edi
+  800d54:	5d                   	pop    %ebp
+  800d55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d56:	83 ec 0c             	sub    $0xc,%esp
+  800d59:	50                   	push   %eax
+  800d5a:	6a 05                	push   $0x5
+  800d5c:	68 7f 36 80 00       	push   $0x80367f
+  800d61:	6a 23                	push   $0x23
+  800d63:	68 9c 36 80 00       	push   $0x80369c
+  800d68:	e8 87 f4 ff ff       	call   8001f4 <_panic>
+
+00800d6d <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	57                   	push   %edi
+  800d71:	56                   	push   %esi
+  800d72:	53                   	push   %ebx
+  800d73:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d76:	be 00 00 00 00       	mov    $0x0,%esi
+  800d7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d81:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d89:	89 f7                	mov    %esi,%edi
+  800d8b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d8d:	85 c0                	test   %eax,%eax
+  800d8f:	7f 08                	jg     800d99 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d94:	5b                   	pop    %ebx
+  800d95:	5e                   	pop    %esi
+  800d96:	5f                   	pop    %edi
+  800d97:	5d                   	pop    %ebp
+  800d98:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d99:	83 ec 0c             	sub    $0xc,%esp
+  800d9c:	50                   	push   %eax
+  800d9d:	6a 06                	push   $0x6
+  800d9f:	68 7f 36 80 00       	push   $0x80367f
+  800da4:	6a 23                	push   $0x23
+  800da6:	68 9c 36 80 00       	push   $0x80369c
+  800dab:	e8 44 f4 ff ff       	call   8001f4 <_panic>
+
+00800db0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	57                   	push   %edi
+  800db4:	56                   	push   %esi
+  800db5:	53                   	push   %ebx
+  800db6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbf:	b8 07 00 00 00       	mov    $0x7,%eax
+  800dc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dca:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dcd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dcf:	85 c0                	test   %eax,%eax
+  800dd1:	7f 08                	jg     800ddb <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd6:	5b                   	pop    %ebx
+  800dd7:	5e                   	pop    %esi
+  800dd8:	5f                   	pop    %edi
+  800dd9:	5d                   	pop    %ebp
+  800dda:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ddb:	83 ec 0c             	sub    $0xc,%esp
+  800dde:	50                   	push   %eax
+  800ddf:	6a 07                	push   $0x7
+  800de1:	68 7f 36 80 00       	push   $0x80367f
+  800de6:	6a 23                	push   $0x23
+  800de8:	68 9c 36 80 00       	push   $0x80369c
+  800ded:	e8 02 f4 ff ff       	call   8001f4 <_panic>
+
+00800df2 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	56                   	push   %esi
+  800df7:	53                   	push   %ebx
+  800df8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e06:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e0b:	89 df                	mov    %ebx,%edi
+  800e0d:	89 de                	mov    %ebx,%esi
+  800e0f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e11:	85 c0                	test   %eax,%eax
+  800e13:	7f 08                	jg     800e1d <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e18:	5b                   	pop    %ebx
+  800e19:	5e                   	pop    %esi
+  800e1a:	5f                   	pop    %edi
+  800e1b:	5d                   	pop    %ebp
+  800e1c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1d:	83 ec 0c             	sub    $0xc,%esp
+  800e20:	50                   	push   %eax
+  800e21:	6a 08                	push   $0x8
+  800e23:	68 7f 36 80 00       	push   $0x80367f
+  800e28:	6a 23                	push   $0x23
+  800e2a:	68 9c 36 80 00       	push   $0x80369c
+  800e2f:	e8 c0 f3 ff ff       	call   8001f4 <_panic>
+
+00800e34 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e34:	55                   	push   %ebp
+  800e35:	89 e5                	mov    %esp,%ebp
+  800e37:	57                   	push   %edi
+  800e38:	56                   	push   %esi
+  800e39:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e40:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e45:	be 00 00 00 00       	mov    $0x0,%esi
+  800e4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e50:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e52:	5b                   	pop    %ebx
+  800e53:	5e                   	pop    %esi
+  800e54:	5f                   	pop    %edi
+  800e55:	5d                   	pop    %ebp
+  800e56:	c3                   	ret
+
+00800e57 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	57                   	push   %edi
+  800e5b:	56                   	push   %esi
+  800e5c:	53                   	push   %ebx
+  800e5d:	8b 45 18             	mov    0x18(%ebp),%eax
+  800e60:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800e63:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800e68:	77 27                	ja     800e91 <sys_page_map_range+0x3a>
+  800e6a:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800e70:	77 1f                	ja     800e91 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800e72:	c1 e0 0c             	shl    $0xc,%eax
+  800e75:	89 c6                	mov    %eax,%esi
+  800e77:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800e79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e87:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8a:	cd 30                	int    $0x30
+}
+  800e8c:	5b                   	pop    %ebx
+  800e8d:	5e                   	pop    %esi
+  800e8e:	5f                   	pop    %edi
+  800e8f:	5d                   	pop    %ebp
+  800e90:	c3                   	ret
+		return -E_INVAL;
+  800e91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e96:	eb f4                	jmp    800e8c <sys_page_map_range+0x35>
+
+00800e98 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800e98:	55                   	push   %ebp
+  800e99:	89 e5                	mov    %esp,%ebp
+  800e9b:	57                   	push   %edi
+  800e9c:	56                   	push   %esi
+  800e9d:	53                   	push   %ebx
+  800e9e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800eac:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eb4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eb7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb9:	85 c0                	test   %eax,%eax
+  800ebb:	7f 08                	jg     800ec5 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800ebd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5f                   	pop    %edi
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec5:	83 ec 0c             	sub    $0xc,%esp
+  800ec8:	50                   	push   %eax
+  800ec9:	6a 0c                	push   $0xc
+  800ecb:	68 7f 36 80 00       	push   $0x80367f
+  800ed0:	6a 23                	push   $0x23
+  800ed2:	68 9c 36 80 00       	push   $0x80369c
+  800ed7:	e8 18 f3 ff ff       	call   8001f4 <_panic>
+
+00800edc <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800edc:	55                   	push   %ebp
+  800edd:	89 e5                	mov    %esp,%ebp
+  800edf:	57                   	push   %edi
+  800ee0:	56                   	push   %esi
+  800ee1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eed:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ef2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef5:	89 f7                	mov    %esi,%edi
+  800ef7:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ef9:	5b                   	pop    %ebx
+  800efa:	5e                   	pop    %esi
+  800efb:	5f                   	pop    %edi
+  800efc:	5d                   	pop    %ebp
+  800efd:	c3                   	ret
+
+00800efe <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800efe:	55                   	push   %ebp
+  800eff:	89 e5                	mov    %esp,%ebp
+  800f01:	57                   	push   %edi
+  800f02:	56                   	push   %esi
+  800f03:	53                   	push   %ebx
+  800f04:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f12:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f17:	89 df                	mov    %ebx,%edi
+  800f19:	89 de                	mov    %ebx,%esi
+  800f1b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f1d:	85 c0                	test   %eax,%eax
+  800f1f:	7f 08                	jg     800f29 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f24:	5b                   	pop    %ebx
+  800f25:	5e                   	pop    %esi
+  800f26:	5f                   	pop    %edi
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f29:	83 ec 0c             	sub    $0xc,%esp
+  800f2c:	50                   	push   %eax
+  800f2d:	6a 0f                	push   $0xf
+  800f2f:	68 7f 36 80 00       	push   $0x80367f
+  800f34:	6a 23                	push   $0x23
+  800f36:	68 9c 36 80 00       	push   $0x80369c
+  800f3b:	e8 b4 f2 ff ff       	call   8001f4 <_panic>
+
+00800f40 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	57                   	push   %edi
+  800f44:	56                   	push   %esi
+  800f45:	53                   	push   %ebx
+  800f46:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f59:	89 df                	mov    %ebx,%edi
+  800f5b:	89 de                	mov    %ebx,%esi
+  800f5d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5f:	85 c0                	test   %eax,%eax
+  800f61:	7f 08                	jg     800f6b <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800f63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f66:	5b                   	pop    %ebx
+  800f67:	5e                   	pop    %esi
+  800f68:	5f                   	pop    %edi
+  800f69:	5d                   	pop    %ebp
+  800f6a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6b:	83 ec 0c             	sub    $0xc,%esp
+  800f6e:	50                   	push   %eax
+  800f6f:	6a 10                	push   $0x10
+  800f71:	68 7f 36 80 00       	push   $0x80367f
+  800f76:	6a 23                	push   $0x23
+  800f78:	68 9c 36 80 00       	push   $0x80369c
+  800f7d:	e8 72 f2 ff ff       	call   8001f4 <_panic>
+
+00800f82 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800f82:	55                   	push   %ebp
+  800f83:	89 e5                	mov    %esp,%ebp
+  800f85:	57                   	push   %edi
+  800f86:	56                   	push   %esi
+  800f87:	53                   	push   %ebx
+  800f88:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f96:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f9b:	89 df                	mov    %ebx,%edi
+  800f9d:	89 de                	mov    %ebx,%esi
+  800f9f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa1:	85 c0                	test   %eax,%eax
+  800fa3:	7f 08                	jg     800fad <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800fa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa8:	5b                   	pop    %ebx
+  800fa9:	5e                   	pop    %esi
+  800faa:	5f                   	pop    %edi
+  800fab:	5d                   	pop    %ebp
+  800fac:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fad:	83 ec 0c             	sub    $0xc,%esp
+  800fb0:	50                   	push   %eax
+  800fb1:	6a 11                	push   $0x11
+  800fb3:	68 7f 36 80 00       	push   $0x80367f
+  800fb8:	6a 23                	push   $0x23
+  800fba:	68 9c 36 80 00       	push   $0x80369c
+  800fbf:	e8 30 f2 ff ff       	call   8001f4 <_panic>
+
+00800fc4 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800fc4:	55                   	push   %ebp
+  800fc5:	89 e5                	mov    %esp,%ebp
+  800fc7:	57                   	push   %edi
+  800fc8:	56                   	push   %esi
+  800fc9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fcf:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fd4:	89 d1                	mov    %edx,%ecx
+  800fd6:	89 d3                	mov    %edx,%ebx
+  800fd8:	89 d7                	mov    %edx,%edi
+  800fda:	89 d6                	mov    %edx,%esi
+  800fdc:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800fde:	5b                   	pop    %ebx
+  800fdf:	5e                   	pop    %esi
+  800fe0:	5f                   	pop    %edi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+
+00800fe3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fe3:	55                   	push   %ebp
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	57                   	push   %edi
+  800fe7:	56                   	push   %esi
+  800fe8:	53                   	push   %ebx
+  800fe9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff7:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ffc:	89 df                	mov    %ebx,%edi
+  800ffe:	89 de                	mov    %ebx,%esi
+  801000:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801002:	85 c0                	test   %eax,%eax
+  801004:	7f 08                	jg     80100e <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801006:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801009:	5b                   	pop    %ebx
+  80100a:	5e                   	pop    %esi
+  80100b:	5f                   	pop    %edi
+  80100c:	5d                   	pop    %ebp
+  80100d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80100e:	83 ec 0c             	sub    $0xc,%esp
+  801011:	50                   	push   %eax
+  801012:	6a 13                	push   $0x13
+  801014:	68 7f 36 80 00       	push   $0x80367f
+  801019:	6a 23                	push   $0x23
+  80101b:	68 9c 36 80 00       	push   $0x80369c
+  801020:	e8 cf f1 ff ff       	call   8001f4 <_panic>
+
+00801025 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	57                   	push   %edi
+  801029:	56                   	push   %esi
+  80102a:	53                   	push   %ebx
+  80102b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80102e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801033:	8b 55 08             	mov    0x8(%ebp),%edx
+  801036:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801039:	b8 14 00 00 00       	mov    $0x14,%eax
+  80103e:	89 df                	mov    %ebx,%edi
+  801040:	89 de                	mov    %ebx,%esi
+  801042:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801044:	85 c0                	test   %eax,%eax
+  801046:	7f 08                	jg     801050 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801048:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104b:	5b                   	pop    %ebx
+  80104c:	5e                   	pop    %esi
+  80104d:	5f                   	pop    %edi
+  80104e:	5d                   	pop    %ebp
+  80104f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801050:	83 ec 0c             	sub    $0xc,%esp
+  801053:	50                   	push   %eax
+  801054:	6a 14                	push   $0x14
+  801056:	68 7f 36 80 00       	push   $0x80367f
+  80105b:	6a 23                	push   $0x23
+  80105d:	68 9c 36 80 00       	push   $0x80369c
+  801062:	e8 8d f1 ff ff       	call   8001f4 <_panic>
+
+00801067 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801067:	55                   	push   %ebp
+  801068:	89 e5                	mov    %esp,%ebp
+  80106a:	57                   	push   %edi
+  80106b:	56                   	push   %esi
+  80106c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80106d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801070:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801073:	b8 17 00 00 00       	mov    $0x17,%eax
+  801078:	be 00 00 00 00       	mov    $0x0,%esi
+  80107d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801080:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801083:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801085:	5b                   	pop    %ebx
+  801086:	5e                   	pop    %esi
+  801087:	5f                   	pop    %edi
+  801088:	5d                   	pop    %ebp
+  801089:	c3                   	ret
+
+0080108a <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80108a:	55                   	push   %ebp
+  80108b:	89 e5                	mov    %esp,%ebp
+  80108d:	57                   	push   %edi
+  80108e:	56                   	push   %esi
+  80108f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801090:	8b 55 08             	mov    0x8(%ebp),%edx
+  801093:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801096:	b8 18 00 00 00       	mov    $0x18,%eax
+  80109b:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010a8:	5b                   	pop    %ebx
+  8010a9:	5e                   	pop    %esi
+  8010aa:	5f                   	pop    %edi
+  8010ab:	5d                   	pop    %ebp
+  8010ac:	c3                   	ret
+
+008010ad <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	57                   	push   %edi
+  8010b1:	56                   	push   %esi
+  8010b2:	53                   	push   %ebx
+  8010b3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010be:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010c3:	89 cb                	mov    %ecx,%ebx
+  8010c5:	89 cf                	mov    %ecx,%edi
+  8010c7:	89 ce                	mov    %ecx,%esi
+  8010c9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010cb:	85 c0                	test   %eax,%eax
+  8010cd:	7f 08                	jg     8010d7 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8010cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d2:	5b                   	pop    %ebx
+  8010d3:	5e                   	pop    %esi
+  8010d4:	5f                   	pop    %edi
+  8010d5:	5d                   	pop    %ebp
+  8010d6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d7:	83 ec 0c             	sub    $0xc,%esp
+  8010da:	50                   	push   %eax
+  8010db:	6a 19                	push   $0x19
+  8010dd:	68 7f 36 80 00       	push   $0x80367f
+  8010e2:	6a 23                	push   $0x23
+  8010e4:	68 9c 36 80 00       	push   $0x80369c
+  8010e9:	e8 06 f1 ff ff       	call   8001f4 <_panic>
+
+008010ee <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010ee:	55                   	push   %ebp
+  8010ef:	89 e5                	mov    %esp,%ebp
+  8010f1:	57                   	push   %edi
+  8010f2:	56                   	push   %esi
+  8010f3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010fe:	89 d1                	mov    %edx,%ecx
+  801100:	89 d3                	mov    %edx,%ebx
+  801102:	89 d7                	mov    %edx,%edi
+  801104:	89 d6                	mov    %edx,%esi
+  801106:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801108:	5b                   	pop    %ebx
+  801109:	5e                   	pop    %esi
+  80110a:	5f                   	pop    %edi
+  80110b:	5d                   	pop    %ebp
+  80110c:	c3                   	ret
+
+0080110d <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  80110d:	55                   	push   %ebp
+  80110e:	89 e5                	mov    %esp,%ebp
+  801110:	57                   	push   %edi
+  801111:	56                   	push   %esi
+  801112:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801113:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801118:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801123:	89 df                	mov    %ebx,%edi
+  801125:	89 de                	mov    %ebx,%esi
+  801127:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801129:	5b                   	pop    %ebx
+  80112a:	5e                   	pop    %esi
+  80112b:	5f                   	pop    %edi
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+
+0080112e <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	57                   	push   %edi
+  801132:	56                   	push   %esi
+  801133:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801134:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801139:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801144:	89 df                	mov    %ebx,%edi
+  801146:	89 de                	mov    %ebx,%esi
+  801148:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  80114a:	5b                   	pop    %ebx
+  80114b:	5e                   	pop    %esi
+  80114c:	5f                   	pop    %edi
+  80114d:	5d                   	pop    %ebp
+  80114e:	c3                   	ret
+
+0080114f <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80114f:	55                   	push   %ebp
+  801150:	89 e5                	mov    %esp,%ebp
+  801152:	53                   	push   %ebx
+  801153:	83 ec 04             	sub    $0x4,%esp
+  801156:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801159:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  80115b:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  80115e:	f6 c2 02             	test   $0x2,%dl
+  801161:	74 7b                	je     8011de <pgfault+0x8f>
+  801163:	89 c1                	mov    %eax,%ecx
+  801165:	c1 e9 0c             	shr    $0xc,%ecx
+  801168:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  80116f:	f6 c5 08             	test   $0x8,%ch
+  801172:	74 6a                	je     8011de <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801174:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801179:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80117b:	83 ec 04             	sub    $0x4,%esp
+  80117e:	6a 07                	push   $0x7
+  801180:	68 00 f0 7f 00       	push   $0x7ff000
+  801185:	6a 00                	push   $0x0
+  801187:	e8 9e fb ff ff       	call   800d2a <sys_page_alloc>
+  80118c:	83 c4 10             	add    $0x10,%esp
+  80118f:	85 c0                	test   %eax,%eax
+  801191:	78 61                	js     8011f4 <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  801193:	83 ec 04             	sub    $0x4,%esp
+  801196:	68 00 10 00 00       	push   $0x1000
+  80119b:	53                   	push   %ebx
+  80119c:	68 00 f0 7f 00       	push   $0x7ff000
+  8011a1:	e8 9d f8 ff ff       	call   800a43 <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  8011a6:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8011ad:	53                   	push   %ebx
+  8011ae:	6a 00                	push   $0x0
+  8011b0:	68 00 f0 7f 00       	push   $0x7ff000
+  8011b5:	6a 00                	push   $0x0
+  8011b7:	e8 f4 fb ff ff       	call   800db0 <sys_page_map>
+  8011bc:	83 c4 20             	add    $0x20,%esp
+  8011bf:	85 c0                	test   %eax,%eax
+  8011c1:	78 43                	js     801206 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  8011c3:	83 ec 08             	sub    $0x8,%esp
+  8011c6:	68 00 f0 7f 00       	push   $0x7ff000
+  8011cb:	6a 00                	push   $0x0
+  8011cd:	e8 20 fc ff ff       	call   800df2 <sys_page_unmap>
+  8011d2:	83 c4 10             	add    $0x10,%esp
+  8011d5:	85 c0                	test   %eax,%eax
+  8011d7:	78 3f                	js     801218 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  8011d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011dc:	c9                   	leave
+  8011dd:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  8011de:	83 ec 0c             	sub    $0xc,%esp
+  8011e1:	50                   	push   %eax
+  8011e2:	52                   	push   %edx
+  8011e3:	68 aa 36 80 00       	push   $0x8036aa
+  8011e8:	6a 19                	push   $0x19
+  8011ea:	68 bb 36 80 00       	push   $0x8036bb
+  8011ef:	e8 00 f0 ff ff       	call   8001f4 <_panic>
+		panic("sys_page_alloc: %e", r);
+  8011f4:	50                   	push   %eax
+  8011f5:	68 ac 32 80 00       	push   $0x8032ac
+  8011fa:	6a 24                	push   $0x24
+  8011fc:	68 bb 36 80 00       	push   $0x8036bb
+  801201:	e8 ee ef ff ff       	call   8001f4 <_panic>
+		panic("sys_page_map: %e", r);
+  801206:	50                   	push   %eax
+  801207:	68 c6 36 80 00       	push   $0x8036c6
+  80120c:	6a 29                	push   $0x29
+  80120e:	68 bb 36 80 00       	push   $0x8036bb
+  801213:	e8 dc ef ff ff       	call   8001f4 <_panic>
+		panic("sys_page_unmap: %e", r);
+  801218:	50                   	push   %eax
+  801219:	68 d7 36 80 00       	push   $0x8036d7
+  80121e:	6a 2c                	push   $0x2c
+  801220:	68 bb 36 80 00       	push   $0x8036bb
+  801225:	e8 ca ef ff ff       	call   8001f4 <_panic>
+
+0080122a <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  80122a:	55                   	push   %ebp
+  80122b:	89 e5                	mov    %esp,%ebp
+  80122d:	57                   	push   %edi
+  80122e:	56                   	push   %esi
+  80122f:	53                   	push   %ebx
+  801230:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801233:	68 4f 11 80 00       	push   $0x80114f
+  801238:	e8 74 1a 00 00       	call   802cb1 <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  80123d:	83 c4 08             	add    $0x8,%esp
+  801240:	6a 01                	push   $0x1
+  801242:	6a 00                	push   $0x0
+  801244:	e8 9f fa ff ff       	call   800ce8 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  801249:	e8 7b fa ff ff       	call   800cc9 <sys_fork_cow>
+  80124e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  801251:	83 c4 10             	add    $0x10,%esp
+  801254:	85 c0                	test   %eax,%eax
+  801256:	74 2c                	je     801284 <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  801258:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  80125c:	0f 85 8b 01 00 00    	jne    8013ed <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801262:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801267:	cd 30                	int    $0x30
+  801269:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  80126c:	85 c0                	test   %eax,%eax
+  80126e:	78 30                	js     8012a0 <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  801270:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801275:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  80127a:	74 36                	je     8012b2 <fork+0x88>
+  80127c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80127f:	e9 99 00 00 00       	jmp    80131d <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801284:	e8 02 fa ff ff       	call   800c8b <sys_getenvid>
+  801289:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80128e:	c1 e0 09             	shl    $0x9,%eax
+  801291:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801296:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  80129b:	e9 4d 01 00 00       	jmp    8013ed <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  8012a0:	50                   	push   %eax
+  8012a1:	68 ea 36 80 00       	push   $0x8036ea
+  8012a6:	6a 7d                	push   $0x7d
+  8012a8:	68 bb 36 80 00       	push   $0x8036bb
+  8012ad:	e8 42 ef ff ff       	call   8001f4 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8012b2:	e8 d4 f9 ff ff       	call   800c8b <sys_getenvid>
+  8012b7:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8012bc:	c1 e0 09             	shl    $0x9,%eax
+  8012bf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8012c4:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  8012c9:	e9 1f 01 00 00       	jmp    8013ed <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  8012ce:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8012d5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8012d8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8012e0:	83 ec 0c             	sub    $0xc,%esp
+  8012e3:	50                   	push   %eax
+  8012e4:	56                   	push   %esi
+  8012e5:	ff 75 e4             	push   -0x1c(%ebp)
+  8012e8:	56                   	push   %esi
+  8012e9:	6a 00                	push   $0x0
+  8012eb:	e8 c0 fa ff ff       	call   800db0 <sys_page_map>
+  8012f0:	83 c4 20             	add    $0x20,%esp
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	0f 88 98 00 00 00    	js     801393 <fork+0x169>
+	if (perm & PTE_COW) {
+  8012fb:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801302:	0f 85 61 01 00 00    	jne    801469 <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801308:	83 c7 01             	add    $0x1,%edi
+  80130b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801311:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  801317:	0f 84 88 00 00 00    	je     8013a5 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  80131d:	89 f0                	mov    %esi,%eax
+  80131f:	c1 e8 16             	shr    $0x16,%eax
+  801322:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801329:	25 81 00 00 00       	and    $0x81,%eax
+  80132e:	83 f8 01             	cmp    $0x1,%eax
+  801331:	75 d5                	jne    801308 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  801333:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  80133a:	a8 01                	test   $0x1,%al
+  80133c:	74 ca                	je     801308 <fork+0xde>
+  80133e:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  801344:	74 c2                	je     801308 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  801346:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  801348:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80134f:	f6 c4 04             	test   $0x4,%ah
+  801352:	0f 85 76 ff ff ff    	jne    8012ce <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  801358:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80135f:	a8 02                	test   $0x2,%al
+  801361:	0f 85 dc 00 00 00    	jne    801443 <fork+0x219>
+  801367:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80136e:	f6 c4 08             	test   $0x8,%ah
+  801371:	0f 85 cc 00 00 00    	jne    801443 <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801377:	83 ec 0c             	sub    $0xc,%esp
+  80137a:	6a 05                	push   $0x5
+  80137c:	56                   	push   %esi
+  80137d:	ff 75 e4             	push   -0x1c(%ebp)
+  801380:	56                   	push   %esi
+  801381:	6a 00                	push   $0x0
+  801383:	e8 28 fa ff ff       	call   800db0 <sys_page_map>
+  801388:	83 c4 20             	add    $0x20,%esp
+  80138b:	85 c0                	test   %eax,%eax
+  80138d:	0f 89 75 ff ff ff    	jns    801308 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  801393:	50                   	push   %eax
+  801394:	68 c6 36 80 00       	push   $0x8036c6
+  801399:	6a 48                	push   $0x48
+  80139b:	68 bb 36 80 00       	push   $0x8036bb
+  8013a0:	e8 4f ee ff ff       	call   8001f4 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  8013a5:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8013a8:	83 ec 04             	sub    $0x4,%esp
+  8013ab:	6a 07                	push   $0x7
+  8013ad:	68 00 f0 bf ee       	push   $0xeebff000
+  8013b2:	53                   	push   %ebx
+  8013b3:	e8 72 f9 ff ff       	call   800d2a <sys_page_alloc>
+  8013b8:	83 c4 10             	add    $0x10,%esp
+  8013bb:	85 c0                	test   %eax,%eax
+  8013bd:	78 39                	js     8013f8 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8013bf:	a1 08 50 80 00       	mov    0x805008,%eax
+  8013c4:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  8013ca:	83 ec 08             	sub    $0x8,%esp
+  8013cd:	50                   	push   %eax
+  8013ce:	53                   	push   %ebx
+  8013cf:	e8 51 fc ff ff       	call   801025 <sys_env_set_pgfault_upcall>
+  8013d4:	83 c4 10             	add    $0x10,%esp
+  8013d7:	85 c0                	test   %eax,%eax
+  8013d9:	78 36                	js     801411 <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8013db:	83 ec 08             	sub    $0x8,%esp
+  8013de:	6a 02                	push   $0x2
+  8013e0:	53                   	push   %ebx
+  8013e1:	e8 18 fb ff ff       	call   800efe <sys_env_set_status>
+  8013e6:	83 c4 10             	add    $0x10,%esp
+  8013e9:	85 c0                	test   %eax,%eax
+  8013eb:	78 3d                	js     80142a <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  8013ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f3:	5b                   	pop    %ebx
+  8013f4:	5e                   	pop    %esi
+  8013f5:	5f                   	pop    %edi
+  8013f6:	5d                   	pop    %ebp
+  8013f7:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  8013f8:	83 ec 0c             	sub    $0xc,%esp
+  8013fb:	53                   	push   %ebx
+  8013fc:	50                   	push   %eax
+  8013fd:	68 10 37 80 00       	push   $0x803710
+  801402:	68 92 00 00 00       	push   $0x92
+  801407:	68 bb 36 80 00       	push   $0x8036bb
+  80140c:	e8 e3 ed ff ff       	call   8001f4 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  801411:	83 ec 0c             	sub    $0xc,%esp
+  801414:	53                   	push   %ebx
+  801415:	50                   	push   %eax
+  801416:	68 34 37 80 00       	push   $0x803734
+  80141b:	68 95 00 00 00       	push   $0x95
+  801420:	68 bb 36 80 00       	push   $0x8036bb
+  801425:	e8 ca ed ff ff       	call   8001f4 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  80142a:	83 ec 0c             	sub    $0xc,%esp
+  80142d:	53                   	push   %ebx
+  80142e:	50                   	push   %eax
+  80142f:	68 64 37 80 00       	push   $0x803764
+  801434:	68 98 00 00 00       	push   $0x98
+  801439:	68 bb 36 80 00       	push   $0x8036bb
+  80143e:	e8 b1 ed ff ff       	call   8001f4 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801443:	83 ec 0c             	sub    $0xc,%esp
+  801446:	68 05 08 00 00       	push   $0x805
+  80144b:	53                   	push   %ebx
+  80144c:	ff 75 e4             	push   -0x1c(%ebp)
+  80144f:	53                   	push   %ebx
+  801450:	6a 00                	push   $0x0
+  801452:	e8 59 f9 ff ff       	call   800db0 <sys_page_map>
+  801457:	83 c4 20             	add    $0x20,%esp
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	0f 88 31 ff ff ff    	js     801393 <fork+0x169>
+		perm |= PTE_COW;
+  801462:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  801469:	83 ec 0c             	sub    $0xc,%esp
+  80146c:	ff 75 e0             	push   -0x20(%ebp)
+  80146f:	53                   	push   %ebx
+  801470:	6a 00                	push   $0x0
+  801472:	53                   	push   %ebx
+  801473:	6a 00                	push   $0x0
+  801475:	e8 36 f9 ff ff       	call   800db0 <sys_page_map>
+  80147a:	83 c4 20             	add    $0x20,%esp
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	0f 89 83 fe ff ff    	jns    801308 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  801485:	50                   	push   %eax
+  801486:	68 c6 36 80 00       	push   $0x8036c6
+  80148b:	6a 4c                	push   $0x4c
+  80148d:	68 bb 36 80 00       	push   $0x8036bb
+  801492:	e8 5d ed ff ff       	call   8001f4 <_panic>
+
+00801497 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801497:	55                   	push   %ebp
+  801498:	89 e5                	mov    %esp,%ebp
+  80149a:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80149d:	68 fa 36 80 00       	push   $0x8036fa
+  8014a2:	68 a0 00 00 00       	push   $0xa0
+  8014a7:	68 bb 36 80 00       	push   $0x8036bb
+  8014ac:	e8 43 ed ff ff       	call   8001f4 <_panic>
+
+008014b1 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014b1:	55                   	push   %ebp
+  8014b2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014b7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014bc:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014bf:	5d                   	pop    %ebp
+  8014c0:	c3                   	ret
+
+008014c1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014c1:	55                   	push   %ebp
+  8014c2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c7:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8014cc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8014d1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8014d6:	5d                   	pop    %ebp
+  8014d7:	c3                   	ret
+
+008014d8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014d8:	55                   	push   %ebp
+  8014d9:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8014db:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8014e0:	eb 02                	jmp    8014e4 <fd_alloc+0xc>
+  8014e2:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014e4:	89 c2                	mov    %eax,%edx
+  8014e6:	c1 ea 16             	shr    $0x16,%edx
+  8014e9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014f0:	f6 c2 01             	test   $0x1,%dl
+  8014f3:	74 2b                	je     801520 <fd_alloc+0x48>
+  8014f5:	89 c2                	mov    %eax,%edx
+  8014f7:	c1 ea 0c             	shr    $0xc,%edx
+  8014fa:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801501:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801507:	f6 c1 01             	test   $0x1,%cl
+  80150a:	74 14                	je     801520 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80150c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801512:	75 ce                	jne    8014e2 <fd_alloc+0xa>
+  801514:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801519:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80151e:	eb 05                	jmp    801525 <fd_alloc+0x4d>
+			return 0;
+  801520:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801525:	8b 55 08             	mov    0x8(%ebp),%edx
+  801528:	89 02                	mov    %eax,(%edx)
+}
+  80152a:	89 c8                	mov    %ecx,%eax
+  80152c:	5d                   	pop    %ebp
+  80152d:	c3                   	ret
+
+0080152e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80152e:	55                   	push   %ebp
+  80152f:	89 e5                	mov    %esp,%ebp
+  801531:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801534:	83 f8 1f             	cmp    $0x1f,%eax
+  801537:	77 30                	ja     801569 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801539:	c1 e0 0c             	shl    $0xc,%eax
+  80153c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801541:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801547:	f6 c2 01             	test   $0x1,%dl
+  80154a:	74 24                	je     801570 <fd_lookup+0x42>
+  80154c:	89 c2                	mov    %eax,%edx
+  80154e:	c1 ea 0c             	shr    $0xc,%edx
+  801551:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801558:	f6 c2 01             	test   $0x1,%dl
+  80155b:	74 1a                	je     801577 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80155d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801560:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801562:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801567:	5d                   	pop    %ebp
+  801568:	c3                   	ret
+		return -E_INVAL;
+  801569:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80156e:	eb f7                	jmp    801567 <fd_lookup+0x39>
+		return -E_INVAL;
+  801570:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801575:	eb f0                	jmp    801567 <fd_lookup+0x39>
+  801577:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157c:	eb e9                	jmp    801567 <fd_lookup+0x39>
+
+0080157e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80157e:	55                   	push   %ebp
+  80157f:	89 e5                	mov    %esp,%ebp
+  801581:	53                   	push   %ebx
+  801582:	83 ec 04             	sub    $0x4,%esp
+  801585:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801588:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158d:	eb 03                	jmp    801592 <dev_lookup+0x14>
+  80158f:	83 c0 01             	add    $0x1,%eax
+  801592:	8b 1c 85 08 38 80 00 	mov    0x803808(,%eax,4),%ebx
+  801599:	85 db                	test   %ebx,%ebx
+  80159b:	74 0b                	je     8015a8 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80159d:	39 13                	cmp    %edx,(%ebx)
+  80159f:	75 ee                	jne    80158f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8015a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a6:	eb 1f                	jmp    8015c7 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015a8:	a1 08 50 80 00       	mov    0x805008,%eax
+  8015ad:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8015b0:	83 ec 04             	sub    $0x4,%esp
+  8015b3:	52                   	push   %edx
+  8015b4:	50                   	push   %eax
+  8015b5:	68 8c 37 80 00       	push   $0x80378c
+  8015ba:	e8 10 ed ff ff       	call   8002cf <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015bf:	83 c4 10             	add    $0x10,%esp
+  8015c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8015c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ca:	89 1a                	mov    %ebx,(%edx)
+}
+  8015cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015cf:	c9                   	leave
+  8015d0:	c3                   	ret
+
+008015d1 <fd_close>:
+{
+  8015d1:	55                   	push   %ebp
+  8015d2:	89 e5                	mov    %esp,%ebp
+  8015d4:	57                   	push   %edi
+  8015d5:	56                   	push   %esi
+  8015d6:	53                   	push   %ebx
+  8015d7:	83 ec 24             	sub    $0x24,%esp
+  8015da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015e0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015e3:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015e4:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8015ea:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015ed:	50                   	push   %eax
+  8015ee:	e8 3b ff ff ff       	call   80152e <fd_lookup>
+  8015f3:	89 c3                	mov    %eax,%ebx
+  8015f5:	83 c4 10             	add    $0x10,%esp
+  8015f8:	85 c0                	test   %eax,%eax
+  8015fa:	78 05                	js     801601 <fd_close+0x30>
+	    || fd != fd2)
+  8015fc:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8015ff:	74 16                	je     801617 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801601:	89 f8                	mov    %edi,%eax
+  801603:	84 c0                	test   %al,%al
+  801605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80160d:	89 d8                	mov    %ebx,%eax
+  80160f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801612:	5b                   	pop    %ebx
+  801613:	5e                   	pop    %esi
+  801614:	5f                   	pop    %edi
+  801615:	5d                   	pop    %ebp
+  801616:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801617:	83 ec 08             	sub    $0x8,%esp
+  80161a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80161d:	50                   	push   %eax
+  80161e:	ff 36                	push   (%esi)
+  801620:	e8 59 ff ff ff       	call   80157e <dev_lookup>
+  801625:	89 c3                	mov    %eax,%ebx
+  801627:	83 c4 10             	add    $0x10,%esp
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	78 1a                	js     801648 <fd_close+0x77>
+		if (dev->dev_close)
+  80162e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801631:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801634:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801639:	85 c0                	test   %eax,%eax
+  80163b:	74 0b                	je     801648 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80163d:	83 ec 0c             	sub    $0xc,%esp
+  801640:	56                   	push   %esi
+  801641:	ff d0                	call   *%eax
+  801643:	89 c3                	mov    %eax,%ebx
+  801645:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801648:	83 ec 08             	sub    $0x8,%esp
+  80164b:	56                   	push   %esi
+  80164c:	6a 00                	push   $0x0
+  80164e:	e8 9f f7 ff ff       	call   800df2 <sys_page_unmap>
+	return r;
+  801653:	83 c4 10             	add    $0x10,%esp
+  801656:	eb b5                	jmp    80160d <fd_close+0x3c>
+
+00801658 <close>:
+
+int
+close(int fdnum)
+{
+  801658:	55                   	push   %ebp
+  801659:	89 e5                	mov    %esp,%ebp
+  80165b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80165e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801661:	50                   	push   %eax
+  801662:	ff 75 08             	push   0x8(%ebp)
+  801665:	e8 c4 fe ff ff       	call   80152e <fd_lookup>
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	79 02                	jns    801673 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801671:	c9                   	leave
+  801672:	c3                   	ret
+		return fd_close(fd, 1);
+  801673:	83 ec 08             	sub    $0x8,%esp
+  801676:	6a 01                	push   $0x1
+  801678:	ff 75 f4             	push   -0xc(%ebp)
+  80167b:	e8 51 ff ff ff       	call   8015d1 <fd_close>
+  801680:	83 c4 10             	add    $0x10,%esp
+  801683:	eb ec                	jmp    801671 <close+0x19>
+
+00801685 <close_all>:
+
+void
+close_all(void)
+{
+  801685:	55                   	push   %ebp
+  801686:	89 e5                	mov    %esp,%ebp
+  801688:	53                   	push   %ebx
+  801689:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80168c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801691:	83 ec 0c             	sub    $0xc,%esp
+  801694:	53                   	push   %ebx
+  801695:	e8 be ff ff ff       	call   801658 <close>
+	for (i = 0; i < MAXFD; i++)
+  80169a:	83 c3 01             	add    $0x1,%ebx
+  80169d:	83 c4 10             	add    $0x10,%esp
+  8016a0:	83 fb 20             	cmp    $0x20,%ebx
+  8016a3:	75 ec                	jne    801691 <close_all+0xc>
+}
+  8016a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016a8:	c9                   	leave
+  8016a9:	c3                   	ret
+
+008016aa <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016aa:	55                   	push   %ebp
+  8016ab:	89 e5                	mov    %esp,%ebp
+  8016ad:	57                   	push   %edi
+  8016ae:	56                   	push   %esi
+  8016af:	53                   	push   %ebx
+  8016b0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016b3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016b6:	50                   	push   %eax
+  8016b7:	ff 75 08             	push   0x8(%ebp)
+  8016ba:	e8 6f fe ff ff       	call   80152e <fd_lookup>
+  8016bf:	89 c3                	mov    %eax,%ebx
+  8016c1:	83 c4 10             	add    $0x10,%esp
+  8016c4:	85 c0                	test   %eax,%eax
+  8016c6:	78 7f                	js     801747 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8016c8:	83 ec 0c             	sub    $0xc,%esp
+  8016cb:	ff 75 0c             	push   0xc(%ebp)
+  8016ce:	e8 85 ff ff ff       	call   801658 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8016d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016d6:	c1 e6 0c             	shl    $0xc,%esi
+  8016d9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8016df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016e2:	89 3c 24             	mov    %edi,(%esp)
+  8016e5:	e8 d7 fd ff ff       	call   8014c1 <fd2data>
+  8016ea:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8016ec:	89 34 24             	mov    %esi,(%esp)
+  8016ef:	e8 cd fd ff ff       	call   8014c1 <fd2data>
+  8016f4:	83 c4 10             	add    $0x10,%esp
+  8016f7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8016fa:	89 d8                	mov    %ebx,%eax
+  8016fc:	c1 e8 16             	shr    $0x16,%eax
+  8016ff:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801706:	a8 01                	test   $0x1,%al
+  801708:	74 11                	je     80171b <dup+0x71>
+  80170a:	89 d8                	mov    %ebx,%eax
+  80170c:	c1 e8 0c             	shr    $0xc,%eax
+  80170f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801716:	f6 c2 01             	test   $0x1,%dl
+  801719:	75 36                	jne    801751 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80171b:	89 f8                	mov    %edi,%eax
+  80171d:	c1 e8 0c             	shr    $0xc,%eax
+  801720:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801727:	83 ec 0c             	sub    $0xc,%esp
+  80172a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80172f:	50                   	push   %eax
+  801730:	56                   	push   %esi
+  801731:	6a 00                	push   $0x0
+  801733:	57                   	push   %edi
+  801734:	6a 00                	push   $0x0
+  801736:	e8 75 f6 ff ff       	call   800db0 <sys_page_map>
+  80173b:	89 c3                	mov    %eax,%ebx
+  80173d:	83 c4 20             	add    $0x20,%esp
+  801740:	85 c0                	test   %eax,%eax
+  801742:	78 33                	js     801777 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801744:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801747:	89 d8                	mov    %ebx,%eax
+  801749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174c:	5b                   	pop    %ebx
+  80174d:	5e                   	pop    %esi
+  80174e:	5f                   	pop    %edi
+  80174f:	5d                   	pop    %ebp
+  801750:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801751:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801758:	83 ec 0c             	sub    $0xc,%esp
+  80175b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801760:	50                   	push   %eax
+  801761:	ff 75 d4             	push   -0x2c(%ebp)
+  801764:	6a 00                	push   $0x0
+  801766:	53                   	push   %ebx
+  801767:	6a 00                	push   $0x0
+  801769:	e8 42 f6 ff ff       	call   800db0 <sys_page_map>
+  80176e:	89 c3                	mov    %eax,%ebx
+  801770:	83 c4 20             	add    $0x20,%esp
+  801773:	85 c0                	test   %eax,%eax
+  801775:	79 a4                	jns    80171b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801777:	83 ec 08             	sub    $0x8,%esp
+  80177a:	56                   	push   %esi
+  80177b:	6a 00                	push   $0x0
+  80177d:	e8 70 f6 ff ff       	call   800df2 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801782:	83 c4 08             	add    $0x8,%esp
+  801785:	ff 75 d4             	push   -0x2c(%ebp)
+  801788:	6a 00                	push   $0x0
+  80178a:	e8 63 f6 ff ff       	call   800df2 <sys_page_unmap>
+	return r;
+  80178f:	83 c4 10             	add    $0x10,%esp
+  801792:	eb b3                	jmp    801747 <dup+0x9d>
+
+00801794 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801794:	55                   	push   %ebp
+  801795:	89 e5                	mov    %esp,%ebp
+  801797:	56                   	push   %esi
+  801798:	53                   	push   %ebx
+  801799:	83 ec 18             	sub    $0x18,%esp
+  80179c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80179f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017a2:	50                   	push   %eax
+  8017a3:	56                   	push   %esi
+  8017a4:	e8 85 fd ff ff       	call   80152e <fd_lookup>
+  8017a9:	83 c4 10             	add    $0x10,%esp
+  8017ac:	85 c0                	test   %eax,%eax
+  8017ae:	78 3c                	js     8017ec <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017b0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017b3:	83 ec 08             	sub    $0x8,%esp
+  8017b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b9:	50                   	push   %eax
+  8017ba:	ff 33                	push   (%ebx)
+  8017bc:	e8 bd fd ff ff       	call   80157e <dev_lookup>
+  8017c1:	83 c4 10             	add    $0x10,%esp
+  8017c4:	85 c0                	test   %eax,%eax
+  8017c6:	78 24                	js     8017ec <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8017c8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8017cb:	83 e0 03             	and    $0x3,%eax
+  8017ce:	83 f8 01             	cmp    $0x1,%eax
+  8017d1:	74 20                	je     8017f3 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8017d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d6:	8b 40 08             	mov    0x8(%eax),%eax
+  8017d9:	85 c0                	test   %eax,%eax
+  8017db:	74 37                	je     801814 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8017dd:	83 ec 04             	sub    $0x4,%esp
+  8017e0:	ff 75 10             	push   0x10(%ebp)
+  8017e3:	ff 75 0c             	push   0xc(%ebp)
+  8017e6:	53                   	push   %ebx
+  8017e7:	ff d0                	call   *%eax
+  8017e9:	83 c4 10             	add    $0x10,%esp
+}
+  8017ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ef:	5b                   	pop    %ebx
+  8017f0:	5e                   	pop    %esi
+  8017f1:	5d                   	pop    %ebp
+  8017f2:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017f3:	a1 08 50 80 00       	mov    0x805008,%eax
+  8017f8:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8017fb:	83 ec 04             	sub    $0x4,%esp
+  8017fe:	56                   	push   %esi
+  8017ff:	50                   	push   %eax
+  801800:	68 cd 37 80 00       	push   $0x8037cd
+  801805:	e8 c5 ea ff ff       	call   8002cf <cprintf>
+		return -E_INVAL;
+  80180a:	83 c4 10             	add    $0x10,%esp
+  80180d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801812:	eb d8                	jmp    8017ec <read+0x58>
+		return -E_NOT_SUPP;
+  801814:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801819:	eb d1                	jmp    8017ec <read+0x58>
+
+0080181b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80181b:	55                   	push   %ebp
+  80181c:	89 e5                	mov    %esp,%ebp
+  80181e:	57                   	push   %edi
+  80181f:	56                   	push   %esi
+  801820:	53                   	push   %ebx
+  801821:	83 ec 0c             	sub    $0xc,%esp
+  801824:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801827:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80182a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182f:	eb 02                	jmp    801833 <readn+0x18>
+  801831:	01 c3                	add    %eax,%ebx
+  801833:	39 f3                	cmp    %esi,%ebx
+  801835:	73 21                	jae    801858 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801837:	83 ec 04             	sub    $0x4,%esp
+  80183a:	89 f0                	mov    %esi,%eax
+  80183c:	29 d8                	sub    %ebx,%eax
+  80183e:	50                   	push   %eax
+  80183f:	89 d8                	mov    %ebx,%eax
+  801841:	03 45 0c             	add    0xc(%ebp),%eax
+  801844:	50                   	push   %eax
+  801845:	57                   	push   %edi
+  801846:	e8 49 ff ff ff       	call   801794 <read>
+		if (m < 0)
+  80184b:	83 c4 10             	add    $0x10,%esp
+  80184e:	85 c0                	test   %eax,%eax
+  801850:	78 04                	js     801856 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801852:	75 dd                	jne    801831 <readn+0x16>
+  801854:	eb 02                	jmp    801858 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801856:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801858:	89 d8                	mov    %ebx,%eax
+  80185a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80185d:	5b                   	pop    %ebx
+  80185e:	5e                   	pop    %esi
+  80185f:	5f                   	pop    %edi
+  801860:	5d                   	pop    %ebp
+  801861:	c3                   	ret
+
+00801862 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801862:	55                   	push   %ebp
+  801863:	89 e5                	mov    %esp,%ebp
+  801865:	56                   	push   %esi
+  801866:	53                   	push   %ebx
+  801867:	83 ec 18             	sub    $0x18,%esp
+  80186a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80186d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801870:	50                   	push   %eax
+  801871:	53                   	push   %ebx
+  801872:	e8 b7 fc ff ff       	call   80152e <fd_lookup>
+  801877:	83 c4 10             	add    $0x10,%esp
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	78 37                	js     8018b5 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80187e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801881:	83 ec 08             	sub    $0x8,%esp
+  801884:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801887:	50                   	push   %eax
+  801888:	ff 36                	push   (%esi)
+  80188a:	e8 ef fc ff ff       	call   80157e <dev_lookup>
+  80188f:	83 c4 10             	add    $0x10,%esp
+  801892:	85 c0                	test   %eax,%eax
+  801894:	78 1f                	js     8018b5 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801896:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80189a:	74 20                	je     8018bc <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80189c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80189f:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018a2:	85 c0                	test   %eax,%eax
+  8018a4:	74 37                	je     8018dd <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018a6:	83 ec 04             	sub    $0x4,%esp
+  8018a9:	ff 75 10             	push   0x10(%ebp)
+  8018ac:	ff 75 0c             	push   0xc(%ebp)
+  8018af:	56                   	push   %esi
+  8018b0:	ff d0                	call   *%eax
+  8018b2:	83 c4 10             	add    $0x10,%esp
+}
+  8018b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b8:	5b                   	pop    %ebx
+  8018b9:	5e                   	pop    %esi
+  8018ba:	5d                   	pop    %ebp
+  8018bb:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018bc:	a1 08 50 80 00       	mov    0x805008,%eax
+  8018c1:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8018c4:	83 ec 04             	sub    $0x4,%esp
+  8018c7:	53                   	push   %ebx
+  8018c8:	50                   	push   %eax
+  8018c9:	68 e9 37 80 00       	push   $0x8037e9
+  8018ce:	e8 fc e9 ff ff       	call   8002cf <cprintf>
+		return -E_INVAL;
+  8018d3:	83 c4 10             	add    $0x10,%esp
+  8018d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018db:	eb d8                	jmp    8018b5 <write+0x53>
+		return -E_NOT_SUPP;
+  8018dd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018e2:	eb d1                	jmp    8018b5 <write+0x53>
+
+008018e4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8018e4:	55                   	push   %ebp
+  8018e5:	89 e5                	mov    %esp,%ebp
+  8018e7:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018ed:	50                   	push   %eax
+  8018ee:	ff 75 08             	push   0x8(%ebp)
+  8018f1:	e8 38 fc ff ff       	call   80152e <fd_lookup>
+  8018f6:	83 c4 10             	add    $0x10,%esp
+  8018f9:	85 c0                	test   %eax,%eax
+  8018fb:	78 0e                	js     80190b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8018fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801900:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801903:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801906:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80190b:	c9                   	leave
+  80190c:	c3                   	ret
+
+0080190d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+  801910:	56                   	push   %esi
+  801911:	53                   	push   %ebx
+  801912:	83 ec 18             	sub    $0x18,%esp
+  801915:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801918:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80191b:	50                   	push   %eax
+  80191c:	53                   	push   %ebx
+  80191d:	e8 0c fc ff ff       	call   80152e <fd_lookup>
+  801922:	83 c4 10             	add    $0x10,%esp
+  801925:	85 c0                	test   %eax,%eax
+  801927:	78 34                	js     80195d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801929:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80192c:	83 ec 08             	sub    $0x8,%esp
+  80192f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801932:	50                   	push   %eax
+  801933:	ff 36                	push   (%esi)
+  801935:	e8 44 fc ff ff       	call   80157e <dev_lookup>
+  80193a:	83 c4 10             	add    $0x10,%esp
+  80193d:	85 c0                	test   %eax,%eax
+  80193f:	78 1c                	js     80195d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801941:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801945:	74 1d                	je     801964 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801947:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80194a:	8b 40 18             	mov    0x18(%eax),%eax
+  80194d:	85 c0                	test   %eax,%eax
+  80194f:	74 34                	je     801985 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801951:	83 ec 08             	sub    $0x8,%esp
+  801954:	ff 75 0c             	push   0xc(%ebp)
+  801957:	56                   	push   %esi
+  801958:	ff d0                	call   *%eax
+  80195a:	83 c4 10             	add    $0x10,%esp
+}
+  80195d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801960:	5b                   	pop    %ebx
+  801961:	5e                   	pop    %esi
+  801962:	5d                   	pop    %ebp
+  801963:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801964:	a1 08 50 80 00       	mov    0x805008,%eax
+  801969:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80196c:	83 ec 04             	sub    $0x4,%esp
+  80196f:	53                   	push   %ebx
+  801970:	50                   	push   %eax
+  801971:	68 ac 37 80 00       	push   $0x8037ac
+  801976:	e8 54 e9 ff ff       	call   8002cf <cprintf>
+		return -E_INVAL;
+  80197b:	83 c4 10             	add    $0x10,%esp
+  80197e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801983:	eb d8                	jmp    80195d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801985:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80198a:	eb d1                	jmp    80195d <ftruncate+0x50>
+
+0080198c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80198c:	55                   	push   %ebp
+  80198d:	89 e5                	mov    %esp,%ebp
+  80198f:	56                   	push   %esi
+  801990:	53                   	push   %ebx
+  801991:	83 ec 18             	sub    $0x18,%esp
+  801994:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801997:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80199a:	50                   	push   %eax
+  80199b:	ff 75 08             	push   0x8(%ebp)
+  80199e:	e8 8b fb ff ff       	call   80152e <fd_lookup>
+  8019a3:	83 c4 10             	add    $0x10,%esp
+  8019a6:	85 c0                	test   %eax,%eax
+  8019a8:	78 49                	js     8019f3 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019aa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019ad:	83 ec 08             	sub    $0x8,%esp
+  8019b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b3:	50                   	push   %eax
+  8019b4:	ff 36                	push   (%esi)
+  8019b6:	e8 c3 fb ff ff       	call   80157e <dev_lookup>
+  8019bb:	83 c4 10             	add    $0x10,%esp
+  8019be:	85 c0                	test   %eax,%eax
+  8019c0:	78 31                	js     8019f3 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8019c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8019c9:	74 2f                	je     8019fa <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8019cb:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8019ce:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8019d5:	00 00 00 
+	stat->st_isdir = 0;
+  8019d8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019df:	00 00 00 
+	stat->st_dev = dev;
+  8019e2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8019e8:	83 ec 08             	sub    $0x8,%esp
+  8019eb:	53                   	push   %ebx
+  8019ec:	56                   	push   %esi
+  8019ed:	ff 50 14             	call   *0x14(%eax)
+  8019f0:	83 c4 10             	add    $0x10,%esp
+}
+  8019f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019f6:	5b                   	pop    %ebx
+  8019f7:	5e                   	pop    %esi
+  8019f8:	5d                   	pop    %ebp
+  8019f9:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019fa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019ff:	eb f2                	jmp    8019f3 <fstat+0x67>
+
+00801a01 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a01:	55                   	push   %ebp
+  801a02:	89 e5                	mov    %esp,%ebp
+  801a04:	56                   	push   %esi
+  801a05:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a06:	83 ec 08             	sub    $0x8,%esp
+  801a09:	6a 00                	push   $0x0
+  801a0b:	ff 75 08             	push   0x8(%ebp)
+  801a0e:	e8 e4 01 00 00       	call   801bf7 <open>
+  801a13:	89 c3                	mov    %eax,%ebx
+  801a15:	83 c4 10             	add    $0x10,%esp
+  801a18:	85 c0                	test   %eax,%eax
+  801a1a:	78 1b                	js     801a37 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801a1c:	83 ec 08             	sub    $0x8,%esp
+  801a1f:	ff 75 0c             	push   0xc(%ebp)
+  801a22:	50                   	push   %eax
+  801a23:	e8 64 ff ff ff       	call   80198c <fstat>
+  801a28:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a2a:	89 1c 24             	mov    %ebx,(%esp)
+  801a2d:	e8 26 fc ff ff       	call   801658 <close>
+	return r;
+  801a32:	83 c4 10             	add    $0x10,%esp
+  801a35:	89 f3                	mov    %esi,%ebx
+}
+  801a37:	89 d8                	mov    %ebx,%eax
+  801a39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a3c:	5b                   	pop    %ebx
+  801a3d:	5e                   	pop    %esi
+  801a3e:	5d                   	pop    %ebp
+  801a3f:	c3                   	ret
+
+00801a40 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a40:	55                   	push   %ebp
+  801a41:	89 e5                	mov    %esp,%ebp
+  801a43:	56                   	push   %esi
+  801a44:	53                   	push   %ebx
+  801a45:	89 c6                	mov    %eax,%esi
+  801a47:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801a49:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801a50:	74 27                	je     801a79 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a52:	6a 07                	push   $0x7
+  801a54:	68 00 60 80 00       	push   $0x806000
+  801a59:	56                   	push   %esi
+  801a5a:	ff 35 00 50 80 00    	push   0x805000
+  801a60:	e8 55 13 00 00       	call   802dba <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801a65:	83 c4 0c             	add    $0xc,%esp
+  801a68:	6a 00                	push   $0x0
+  801a6a:	53                   	push   %ebx
+  801a6b:	6a 00                	push   $0x0
+  801a6d:	e8 d0 12 00 00       	call   802d42 <ipc_recv>
+}
+  801a72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a75:	5b                   	pop    %ebx
+  801a76:	5e                   	pop    %esi
+  801a77:	5d                   	pop    %ebp
+  801a78:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a79:	83 ec 0c             	sub    $0xc,%esp
+  801a7c:	6a 01                	push   $0x1
+  801a7e:	e8 8b 13 00 00       	call   802e0e <ipc_find_env>
+  801a83:	a3 00 50 80 00       	mov    %eax,0x805000
+  801a88:	83 c4 10             	add    $0x10,%esp
+  801a8b:	eb c5                	jmp    801a52 <fsipc+0x12>
+
+00801a8d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a8d:	55                   	push   %ebp
+  801a8e:	89 e5                	mov    %esp,%ebp
+  801a90:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a96:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a99:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801a9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aa1:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801aa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aab:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ab0:	e8 8b ff ff ff       	call   801a40 <fsipc>
+}
+  801ab5:	c9                   	leave
+  801ab6:	c3                   	ret
+
+00801ab7 <devfile_flush>:
+{
+  801ab7:	55                   	push   %ebp
+  801ab8:	89 e5                	mov    %esp,%ebp
+  801aba:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801abd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ac3:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801ac8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801acd:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ad2:	e8 69 ff ff ff       	call   801a40 <fsipc>
+}
+  801ad7:	c9                   	leave
+  801ad8:	c3                   	ret
+
+00801ad9 <devfile_stat>:
+{
+  801ad9:	55                   	push   %ebp
+  801ada:	89 e5                	mov    %esp,%ebp
+  801adc:	53                   	push   %ebx
+  801add:	83 ec 04             	sub    $0x4,%esp
+  801ae0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ae9:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801aee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af3:	b8 05 00 00 00       	mov    $0x5,%eax
+  801af8:	e8 43 ff ff ff       	call   801a40 <fsipc>
+  801afd:	85 c0                	test   %eax,%eax
+  801aff:	78 2c                	js     801b2d <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b01:	83 ec 08             	sub    $0x8,%esp
+  801b04:	68 00 60 80 00       	push   $0x806000
+  801b09:	53                   	push   %ebx
+  801b0a:	e8 ae ed ff ff       	call   8008bd <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b0f:	a1 80 60 80 00       	mov    0x806080,%eax
+  801b14:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b1a:	a1 84 60 80 00       	mov    0x806084,%eax
+  801b1f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801b25:	83 c4 10             	add    $0x10,%esp
+  801b28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b30:	c9                   	leave
+  801b31:	c3                   	ret
+
+00801b32 <devfile_write>:
+{
+  801b32:	55                   	push   %ebp
+  801b33:	89 e5                	mov    %esp,%ebp
+  801b35:	83 ec 0c             	sub    $0xc,%esp
+  801b38:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801b3b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801b40:	39 d0                	cmp    %edx,%eax
+  801b42:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b45:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b48:	8b 52 0c             	mov    0xc(%edx),%edx
+  801b4b:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801b51:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801b56:	50                   	push   %eax
+  801b57:	ff 75 0c             	push   0xc(%ebp)
+  801b5a:	68 08 60 80 00       	push   $0x806008
+  801b5f:	e8 df ee ff ff       	call   800a43 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801b64:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b69:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b6e:	e8 cd fe ff ff       	call   801a40 <fsipc>
+}
+  801b73:	c9                   	leave
+  801b74:	c3                   	ret
+
+00801b75 <devfile_read>:
+{
+  801b75:	55                   	push   %ebp
+  801b76:	89 e5                	mov    %esp,%ebp
+  801b78:	56                   	push   %esi
+  801b79:	53                   	push   %ebx
+  801b7a:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b80:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b83:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801b88:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b93:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b98:	e8 a3 fe ff ff       	call   801a40 <fsipc>
+  801b9d:	89 c3                	mov    %eax,%ebx
+  801b9f:	85 c0                	test   %eax,%eax
+  801ba1:	78 1f                	js     801bc2 <devfile_read+0x4d>
+	assert(r <= n);
+  801ba3:	39 c6                	cmp    %eax,%esi
+  801ba5:	72 24                	jb     801bcb <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801ba7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801bac:	7f 33                	jg     801be1 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801bae:	83 ec 04             	sub    $0x4,%esp
+  801bb1:	50                   	push   %eax
+  801bb2:	68 00 60 80 00       	push   $0x806000
+  801bb7:	ff 75 0c             	push   0xc(%ebp)
+  801bba:	e8 84 ee ff ff       	call   800a43 <memmove>
+	return r;
+  801bbf:	83 c4 10             	add    $0x10,%esp
+}
+  801bc2:	89 d8                	mov    %ebx,%eax
+  801bc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bc7:	5b                   	pop    %ebx
+  801bc8:	5e                   	pop    %esi
+  801bc9:	5d                   	pop    %ebp
+  801bca:	c3                   	ret
+	assert(r <= n);
+  801bcb:	68 1c 38 80 00       	push   $0x80381c
+  801bd0:	68 23 38 80 00       	push   $0x803823
+  801bd5:	6a 7c                	push   $0x7c
+  801bd7:	68 38 38 80 00       	push   $0x803838
+  801bdc:	e8 13 e6 ff ff       	call   8001f4 <_panic>
+	assert(r <= PGSIZE);
+  801be1:	68 43 38 80 00       	push   $0x803843
+  801be6:	68 23 38 80 00       	push   $0x803823
+  801beb:	6a 7d                	push   $0x7d
+  801bed:	68 38 38 80 00       	push   $0x803838
+  801bf2:	e8 fd e5 ff ff       	call   8001f4 <_panic>
+
+00801bf7 <open>:
+{
+  801bf7:	55                   	push   %ebp
+  801bf8:	89 e5                	mov    %esp,%ebp
+  801bfa:	56                   	push   %esi
+  801bfb:	53                   	push   %ebx
+  801bfc:	83 ec 1c             	sub    $0x1c,%esp
+  801bff:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801c02:	56                   	push   %esi
+  801c03:	e8 7a ec ff ff       	call   800882 <strlen>
+  801c08:	83 c4 10             	add    $0x10,%esp
+  801c0b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c10:	7f 6c                	jg     801c7e <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801c12:	83 ec 0c             	sub    $0xc,%esp
+  801c15:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c18:	50                   	push   %eax
+  801c19:	e8 ba f8 ff ff       	call   8014d8 <fd_alloc>
+  801c1e:	89 c3                	mov    %eax,%ebx
+  801c20:	83 c4 10             	add    $0x10,%esp
+  801c23:	85 c0                	test   %eax,%eax
+  801c25:	78 3c                	js     801c63 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801c27:	83 ec 08             	sub    $0x8,%esp
+  801c2a:	56                   	push   %esi
+  801c2b:	68 00 60 80 00       	push   $0x806000
+  801c30:	e8 88 ec ff ff       	call   8008bd <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801c35:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c38:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801c3d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c40:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c45:	e8 f6 fd ff ff       	call   801a40 <fsipc>
+  801c4a:	89 c3                	mov    %eax,%ebx
+  801c4c:	83 c4 10             	add    $0x10,%esp
+  801c4f:	85 c0                	test   %eax,%eax
+  801c51:	78 19                	js     801c6c <open+0x75>
+	return fd2num(fd);
+  801c53:	83 ec 0c             	sub    $0xc,%esp
+  801c56:	ff 75 f4             	push   -0xc(%ebp)
+  801c59:	e8 53 f8 ff ff       	call   8014b1 <fd2num>
+  801c5e:	89 c3                	mov    %eax,%ebx
+  801c60:	83 c4 10             	add    $0x10,%esp
+}
+  801c63:	89 d8                	mov    %ebx,%eax
+  801c65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c68:	5b                   	pop    %ebx
+  801c69:	5e                   	pop    %esi
+  801c6a:	5d                   	pop    %ebp
+  801c6b:	c3                   	ret
+		fd_close(fd, 0);
+  801c6c:	83 ec 08             	sub    $0x8,%esp
+  801c6f:	6a 00                	push   $0x0
+  801c71:	ff 75 f4             	push   -0xc(%ebp)
+  801c74:	e8 58 f9 ff ff       	call   8015d1 <fd_close>
+		return r;
+  801c79:	83 c4 10             	add    $0x10,%esp
+  801c7c:	eb e5                	jmp    801c63 <open+0x6c>
+		return -E_BAD_PATH;
+  801c7e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c83:	eb de                	jmp    801c63 <open+0x6c>
+
+00801c85 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c85:	55                   	push   %ebp
+  801c86:	89 e5                	mov    %esp,%ebp
+  801c88:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c90:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c95:	e8 a6 fd ff ff       	call   801a40 <fsipc>
+}
+  801c9a:	c9                   	leave
+  801c9b:	c3                   	ret
+
+00801c9c <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	57                   	push   %edi
+  801ca0:	56                   	push   %esi
+  801ca1:	53                   	push   %ebx
+  801ca2:	81 ec 94 02 00 00    	sub    $0x294,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  801ca8:	6a 00                	push   $0x0
+  801caa:	ff 75 08             	push   0x8(%ebp)
+  801cad:	e8 45 ff ff ff       	call   801bf7 <open>
+  801cb2:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  801cb8:	83 c4 10             	add    $0x10,%esp
+  801cbb:	85 c0                	test   %eax,%eax
+  801cbd:	0f 88 d0 05 00 00    	js     802293 <spawn+0x5f7>
+  801cc3:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801cc5:	83 ec 04             	sub    $0x4,%esp
+  801cc8:	68 00 02 00 00       	push   $0x200
+  801ccd:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801cd3:	50                   	push   %eax
+  801cd4:	51                   	push   %ecx
+  801cd5:	e8 41 fb ff ff       	call   80181b <readn>
+  801cda:	83 c4 10             	add    $0x10,%esp
+  801cdd:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801ce2:	75 73                	jne    801d57 <spawn+0xbb>
+	    || elf->e_magic != ELF_MAGIC) {
+  801ce4:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801ceb:	45 4c 46 
+  801cee:	75 67                	jne    801d57 <spawn+0xbb>
+  801cf0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801cf5:	cd 30                	int    $0x30
+  801cf7:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  801cfd:	85 c0                	test   %eax,%eax
+  801cff:	0f 88 82 05 00 00    	js     802287 <spawn+0x5eb>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  801d05:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801d0a:	89 c6                	mov    %eax,%esi
+  801d0c:	c1 e6 09             	shl    $0x9,%esi
+  801d0f:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801d15:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  801d1b:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801d20:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  801d22:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  801d28:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  801d2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  801d33:	be 00 00 00 00       	mov    $0x0,%esi
+  801d38:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801d3b:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	74 4d                	je     801d8f <spawn+0xf3>
+		string_size += strlen(argv[argc]) + 1;
+  801d42:	83 ec 0c             	sub    $0xc,%esp
+  801d45:	50                   	push   %eax
+  801d46:	e8 37 eb ff ff       	call   800882 <strlen>
+  801d4b:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801d4f:	83 c3 01             	add    $0x1,%ebx
+  801d52:	83 c4 10             	add    $0x10,%esp
+  801d55:	eb e4                	jmp    801d3b <spawn+0x9f>
+		close(fd);
+  801d57:	83 ec 0c             	sub    $0xc,%esp
+  801d5a:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  801d60:	e8 f3 f8 ff ff       	call   801658 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  801d65:	83 c4 0c             	add    $0xc,%esp
+  801d68:	68 7f 45 4c 46       	push   $0x464c457f
+  801d6d:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  801d73:	68 4f 38 80 00       	push   $0x80384f
+  801d78:	e8 52 e5 ff ff       	call   8002cf <cprintf>
+		return -E_NOT_EXEC;
+  801d7d:	83 c4 10             	add    $0x10,%esp
+  801d80:	c7 85 80 fd ff ff f2 	movl   $0xfffffff2,-0x280(%ebp)
+  801d87:	ff ff ff 
+  801d8a:	e9 04 05 00 00       	jmp    802293 <spawn+0x5f7>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  801d8f:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  801d95:	bf 00 10 40 00       	mov    $0x401000,%edi
+  801d9a:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  801d9c:	89 fa                	mov    %edi,%edx
+  801d9e:	83 e2 fc             	and    $0xfffffffc,%edx
+  801da1:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  801da8:	29 c2                	sub    %eax,%edx
+  801daa:	89 95 90 fd ff ff    	mov    %edx,-0x270(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  801db0:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801db3:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  801db8:	0f 86 e3 04 00 00    	jbe    8022a1 <spawn+0x605>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801dbe:	83 ec 04             	sub    $0x4,%esp
+  801dc1:	6a 07                	push   $0x7
+  801dc3:	68 00 00 40 00       	push   $0x400000
+  801dc8:	6a 00                	push   $0x0
+  801dca:	e8 5b ef ff ff       	call   800d2a <sys_page_alloc>
+  801dcf:	83 c4 10             	add    $0x10,%esp
+  801dd2:	85 c0                	test   %eax,%eax
+  801dd4:	0f 88 cc 04 00 00    	js     8022a6 <spawn+0x60a>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  801dda:	be 00 00 00 00       	mov    $0x0,%esi
+  801ddf:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  801de5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801de8:	eb 30                	jmp    801e1a <spawn+0x17e>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  801dea:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801df0:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  801df6:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  801df9:	83 ec 08             	sub    $0x8,%esp
+  801dfc:	ff 34 b3             	push   (%ebx,%esi,4)
+  801dff:	57                   	push   %edi
+  801e00:	e8 b8 ea ff ff       	call   8008bd <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  801e05:	83 c4 04             	add    $0x4,%esp
+  801e08:	ff 34 b3             	push   (%ebx,%esi,4)
+  801e0b:	e8 72 ea ff ff       	call   800882 <strlen>
+  801e10:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  801e14:	83 c6 01             	add    $0x1,%esi
+  801e17:	83 c4 10             	add    $0x10,%esp
+  801e1a:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  801e20:	7f c8                	jg     801dea <spawn+0x14e>
+	}
+	argv_store[argc] = 0;
+  801e22:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  801e28:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  801e2e:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801e35:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  801e3b:	0f 85 81 00 00 00    	jne    801ec2 <spawn+0x226>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  801e41:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  801e47:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  801e4d:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  801e50:	89 c8                	mov    %ecx,%eax
+  801e52:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  801e58:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  801e5b:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  801e60:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  801e66:	83 ec 0c             	sub    $0xc,%esp
+  801e69:	6a 07                	push   $0x7
+  801e6b:	68 00 d0 bf ee       	push   $0xeebfd000
+  801e70:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801e76:	68 00 00 40 00       	push   $0x400000
+  801e7b:	6a 00                	push   $0x0
+  801e7d:	e8 2e ef ff ff       	call   800db0 <sys_page_map>
+  801e82:	89 c3                	mov    %eax,%ebx
+  801e84:	83 c4 20             	add    $0x20,%esp
+  801e87:	85 c0                	test   %eax,%eax
+  801e89:	0f 88 1f 04 00 00    	js     8022ae <spawn+0x612>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801e8f:	83 ec 08             	sub    $0x8,%esp
+  801e92:	68 00 00 40 00       	push   $0x400000
+  801e97:	6a 00                	push   $0x0
+  801e99:	e8 54 ef ff ff       	call   800df2 <sys_page_unmap>
+  801e9e:	89 c3                	mov    %eax,%ebx
+  801ea0:	83 c4 10             	add    $0x10,%esp
+  801ea3:	85 c0                	test   %eax,%eax
+  801ea5:	0f 88 03 04 00 00    	js     8022ae <spawn+0x612>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  801eab:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  801eb1:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801eb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ebd:	e9 87 01 00 00       	jmp    802049 <spawn+0x3ad>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801ec2:	68 c0 38 80 00       	push   $0x8038c0
+  801ec7:	68 23 38 80 00       	push   $0x803823
+  801ecc:	68 f1 00 00 00       	push   $0xf1
+  801ed1:	68 69 38 80 00       	push   $0x803869
+  801ed6:	e8 19 e3 ff ff       	call   8001f4 <_panic>
+	}
+
+	// from file, as many pages at a time as fit below PFTEMP
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+		for (j = 0; j < n; j += r)
+  801edb:	01 c6                	add    %eax,%esi
+  801edd:	39 f3                	cmp    %esi,%ebx
+  801edf:	7e 4c                	jle    801f2d <spawn+0x291>
+			if ((r = sys_page_alloc_range(0, UTEMP + j * PGSIZE, n - j, PTE_P|PTE_U|PTE_W)) < 0)
+  801ee1:	6a 07                	push   $0x7
+  801ee3:	89 d8                	mov    %ebx,%eax
+  801ee5:	29 f0                	sub    %esi,%eax
+  801ee7:	50                   	push   %eax
+  801ee8:	89 f0                	mov    %esi,%eax
+  801eea:	c1 e0 0c             	shl    $0xc,%eax
+  801eed:	05 00 00 40 00       	add    $0x400000,%eax
+  801ef2:	50                   	push   %eax
+  801ef3:	6a 00                	push   $0x0
+  801ef5:	e8 3a ef ff ff       	call   800e34 <sys_page_alloc_range>
+  801efa:	83 c4 10             	add    $0x10,%esp
+  801efd:	85 c0                	test   %eax,%eax
+  801eff:	79 da                	jns    801edb <spawn+0x23f>
+  801f01:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  801f03:	83 ec 0c             	sub    $0xc,%esp
+  801f06:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801f0c:	e8 39 ed ff ff       	call   800c4a <sys_env_destroy>
+	close(fd);
+  801f11:	83 c4 04             	add    $0x4,%esp
+  801f14:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  801f1a:	e8 39 f7 ff ff       	call   801658 <close>
+	return r;
+  801f1f:	83 c4 10             	add    $0x10,%esp
+  801f22:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  801f28:	e9 66 03 00 00       	jmp    802293 <spawn+0x5f7>
+				return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  801f2d:	83 ec 08             	sub    $0x8,%esp
+  801f30:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  801f36:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  801f3c:	01 c8                	add    %ecx,%eax
+  801f3e:	50                   	push   %eax
+  801f3f:	8b b5 80 fd ff ff    	mov    -0x280(%ebp),%esi
+  801f45:	56                   	push   %esi
+  801f46:	e8 99 f9 ff ff       	call   8018e4 <seek>
+  801f4b:	83 c4 10             	add    $0x10,%esp
+  801f4e:	85 c0                	test   %eax,%eax
+  801f50:	0f 88 cd 01 00 00    	js     802123 <spawn+0x487>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  801f56:	89 d8                	mov    %ebx,%eax
+  801f58:	c1 e0 0c             	shl    $0xc,%eax
+  801f5b:	89 85 74 fd ff ff    	mov    %eax,-0x28c(%ebp)
+  801f61:	83 ec 04             	sub    $0x4,%esp
+  801f64:	39 f8                	cmp    %edi,%eax
+  801f66:	0f 46 f8             	cmovbe %eax,%edi
+  801f69:	57                   	push   %edi
+  801f6a:	68 00 00 40 00       	push   $0x400000
+  801f6f:	56                   	push   %esi
+  801f70:	e8 a6 f8 ff ff       	call   80181b <readn>
+  801f75:	83 c4 10             	add    $0x10,%esp
+  801f78:	85 c0                	test   %eax,%eax
+  801f7a:	0f 88 aa 01 00 00    	js     80212a <spawn+0x48e>
+			return r;
+		for (j = 0; j < n; j += r)
+  801f80:	be 00 00 00 00       	mov    $0x0,%esi
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  801f85:	8b bd 84 fd ff ff    	mov    -0x27c(%ebp),%edi
+  801f8b:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  801f91:	01 c7                	add    %eax,%edi
+		for (j = 0; j < n; j += r)
+  801f93:	39 f3                	cmp    %esi,%ebx
+  801f95:	7e 4a                	jle    801fe1 <spawn+0x345>
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  801f97:	89 f0                	mov    %esi,%eax
+  801f99:	c1 e0 0c             	shl    $0xc,%eax
+  801f9c:	83 ec 08             	sub    $0x8,%esp
+  801f9f:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  801fa5:	89 da                	mov    %ebx,%edx
+  801fa7:	29 f2                	sub    %esi,%edx
+  801fa9:	52                   	push   %edx
+  801faa:	8d 14 07             	lea    (%edi,%eax,1),%edx
+  801fad:	52                   	push   %edx
+  801fae:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  801fb4:	05 00 00 40 00       	add    $0x400000,%eax
+  801fb9:	50                   	push   %eax
+  801fba:	6a 00                	push   $0x0
+  801fbc:	e8 96 ee ff ff       	call   800e57 <sys_page_map_range>
+  801fc1:	83 c4 20             	add    $0x20,%esp
+  801fc4:	85 c0                	test   %eax,%eax
+  801fc6:	78 04                	js     801fcc <spawn+0x330>
+		for (j = 0; j < n; j += r)
+  801fc8:	01 c6                	add    %eax,%esi
+  801fca:	eb c7                	jmp    801f93 <spawn+0x2f7>
+				panic("spawn: sys_page_map_range data: %e", r);
+  801fcc:	50                   	push   %eax
+  801fcd:	68 e8 38 80 00       	push   $0x8038e8
+  801fd2:	68 22 01 00 00       	push   $0x122
+  801fd7:	68 69 38 80 00       	push   $0x803869
+  801fdc:	e8 13 e2 ff ff       	call   8001f4 <_panic>
+		sys_page_unmap_range(0, UTEMP, n);
+  801fe1:	83 ec 04             	sub    $0x4,%esp
+  801fe4:	53                   	push   %ebx
+  801fe5:	68 00 00 40 00       	push   $0x400000
+  801fea:	6a 00                	push   $0x0
+  801fec:	e8 eb ee ff ff       	call   800edc <sys_page_unmap_range>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  801ff1:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  801ff7:	01 8d 8c fd ff ff    	add    %ecx,-0x274(%ebp)
+  801ffd:	83 c4 10             	add    $0x10,%esp
+  802000:	e9 c4 00 00 00       	jmp    8020c9 <spawn+0x42d>
+	}
+
+	// the rest is zero-filled on demand
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  802005:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  80200b:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  802011:	8b 9d 6c fd ff ff    	mov    -0x294(%ebp),%ebx
+  802017:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  80201d:	39 c8                	cmp    %ecx,%eax
+  80201f:	73 22                	jae    802043 <spawn+0x3a7>
+  802021:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802027:	29 c1                	sub    %eax,%ecx
+  802029:	51                   	push   %ecx
+  80202a:	01 d0                	add    %edx,%eax
+  80202c:	50                   	push   %eax
+  80202d:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802033:	e8 60 ee ff ff       	call   800e98 <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802038:	83 c4 10             	add    $0x10,%esp
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	0f 88 d1 00 00 00    	js     802114 <spawn+0x478>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802043:	83 c3 01             	add    $0x1,%ebx
+  802046:	83 c6 20             	add    $0x20,%esi
+  802049:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802050:	39 d8                	cmp    %ebx,%eax
+  802052:	0f 8e d9 00 00 00    	jle    802131 <spawn+0x495>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802058:	83 3e 01             	cmpl   $0x1,(%esi)
+  80205b:	75 e6                	jne    802043 <spawn+0x3a7>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  80205d:	8b 46 18             	mov    0x18(%esi),%eax
+  802060:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802063:	83 f8 01             	cmp    $0x1,%eax
+  802066:	19 c0                	sbb    %eax,%eax
+  802068:	83 e0 fe             	and    $0xfffffffe,%eax
+  80206b:	83 c0 07             	add    $0x7,%eax
+  80206e:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802074:	8b 7e 04             	mov    0x4(%esi),%edi
+  802077:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  80207d:	8b 46 10             	mov    0x10(%esi),%eax
+  802080:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802086:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802089:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  80208c:	89 d0                	mov    %edx,%eax
+  80208e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802093:	74 12                	je     8020a7 <spawn+0x40b>
+		va -= i;
+  802095:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  802097:	01 c1                	add    %eax,%ecx
+		filesz += i;
+  802099:	01 85 88 fd ff ff    	add    %eax,-0x278(%ebp)
+		fileoffset -= i;
+  80209f:	29 c7                	sub    %eax,%edi
+  8020a1:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  8020a7:	c7 85 8c fd ff ff 00 	movl   $0x0,-0x274(%ebp)
+  8020ae:	00 00 00 
+  8020b1:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  8020b7:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  8020bd:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  8020c3:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  8020c9:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  8020cf:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  8020d5:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  8020db:	39 c8                	cmp    %ecx,%eax
+  8020dd:	0f 83 22 ff ff ff    	jae    802005 <spawn+0x369>
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+  8020e3:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  8020e9:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  8020ef:	29 c7                	sub    %eax,%edi
+  8020f1:	8d 9f ff 0f 00 00    	lea    0xfff(%edi),%ebx
+  8020f7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8020fd:	b8 00 f0 3f 00       	mov    $0x3ff000,%eax
+  802102:	39 c3                	cmp    %eax,%ebx
+  802104:	0f 47 d8             	cmova  %eax,%ebx
+  802107:	c1 eb 0c             	shr    $0xc,%ebx
+		for (j = 0; j < n; j += r)
+  80210a:	be 00 00 00 00       	mov    $0x0,%esi
+  80210f:	e9 c9 fd ff ff       	jmp    801edd <spawn+0x241>
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  802114:	ba 00 00 00 00       	mov    $0x0,%edx
+  802119:	89 d7                	mov    %edx,%edi
+  80211b:	0f 4e f8             	cmovle %eax,%edi
+  80211e:	e9 e0 fd ff ff       	jmp    801f03 <spawn+0x267>
+  802123:	89 c7                	mov    %eax,%edi
+  802125:	e9 d9 fd ff ff       	jmp    801f03 <spawn+0x267>
+  80212a:	89 c7                	mov    %eax,%edi
+  80212c:	e9 d2 fd ff ff       	jmp    801f03 <spawn+0x267>
+	close(fd);
+  802131:	83 ec 0c             	sub    $0xc,%esp
+  802134:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  80213a:	e8 19 f5 ff ff       	call   801658 <close>
+  80213f:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	uint32_t pn, n;
+	void *va;
+	int perm, r;
+
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  802142:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802147:	e9 82 00 00 00       	jmp    8021ce <spawn+0x532>
+		// in one go.
+		perm = uvpt[pn] & PTE_SYSCALL;
+		while (pn + n < PGNUM(UTOP)
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+			n++;
+  80214c:	83 c6 01             	add    $0x1,%esi
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  80214f:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  802154:	74 2e                	je     802184 <spawn+0x4e8>
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+  802156:	89 c2                	mov    %eax,%edx
+  802158:	c1 e2 0c             	shl    $0xc,%edx
+  80215b:	c1 ea 16             	shr    $0x16,%edx
+  80215e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802165:	81 e2 81 00 00 00    	and    $0x81,%edx
+  80216b:	83 fa 01             	cmp    $0x1,%edx
+  80216e:	75 14                	jne    802184 <spawn+0x4e8>
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  802170:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802177:	83 c0 01             	add    $0x1,%eax
+  80217a:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  802180:	39 d7                	cmp    %edx,%edi
+  802182:	74 c8                	je     80214c <spawn+0x4b0>
+		if ((r = sys_page_map_range(0, va, child, va, n, perm)) != n)
+  802184:	83 ec 08             	sub    $0x8,%esp
+  802187:	57                   	push   %edi
+  802188:	56                   	push   %esi
+  802189:	51                   	push   %ecx
+  80218a:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802190:	51                   	push   %ecx
+  802191:	6a 00                	push   $0x0
+  802193:	e8 bf ec ff ff       	call   800e57 <sys_page_map_range>
+  802198:	89 c2                	mov    %eax,%edx
+  80219a:	83 c4 20             	add    $0x20,%esp
+  80219d:	39 c6                	cmp    %eax,%esi
+  80219f:	74 23                	je     8021c4 <spawn+0x528>
+			panic("sys_page_map_range: %e", r < 0 ? r : -E_NO_MEM);
+  8021a1:	85 c0                	test   %eax,%eax
+  8021a3:	78 05                	js     8021aa <spawn+0x50e>
+  8021a5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8021aa:	50                   	push   %eax
+  8021ab:	68 75 38 80 00       	push   $0x803875
+  8021b0:	68 47 01 00 00       	push   $0x147
+  8021b5:	68 69 38 80 00       	push   $0x803869
+  8021ba:	e8 35 e0 ff ff       	call   8001f4 <_panic>
+		n = 1;
+  8021bf:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  8021c4:	01 d3                	add    %edx,%ebx
+  8021c6:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8021cc:	77 4e                	ja     80221c <spawn+0x580>
+		va = (void *) (pn << PGSHIFT);
+  8021ce:	89 d9                	mov    %ebx,%ecx
+  8021d0:	c1 e1 0c             	shl    $0xc,%ecx
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  8021d3:	89 c8                	mov    %ecx,%eax
+  8021d5:	c1 e8 16             	shr    $0x16,%eax
+  8021d8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8021df:	25 81 00 00 00       	and    $0x81,%eax
+  8021e4:	83 f8 01             	cmp    $0x1,%eax
+  8021e7:	75 d6                	jne    8021bf <spawn+0x523>
+		if (!(uvpt[pn] & PTE_P))
+  8021e9:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  8021f0:	83 e2 01             	and    $0x1,%edx
+  8021f3:	74 23                	je     802218 <spawn+0x57c>
+		if (!(uvpt[pn] & PTE_SHARE))
+  8021f5:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8021fc:	f6 c4 04             	test   $0x4,%ah
+  8021ff:	74 c3                	je     8021c4 <spawn+0x528>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  802201:	8b 3c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edi
+  802208:	81 e7 07 0e 00 00    	and    $0xe07,%edi
+		while (pn + n < PGNUM(UTOP)
+  80220e:	8d 43 01             	lea    0x1(%ebx),%eax
+		n = 1;
+  802211:	89 d6                	mov    %edx,%esi
+		while (pn + n < PGNUM(UTOP)
+  802213:	e9 37 ff ff ff       	jmp    80214f <spawn+0x4b3>
+		n = 1;
+  802218:	89 c2                	mov    %eax,%edx
+  80221a:	eb a8                	jmp    8021c4 <spawn+0x528>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80221c:	83 ec 08             	sub    $0x8,%esp
+  80221f:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802225:	50                   	push   %eax
+  802226:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  80222c:	e8 b2 ed ff ff       	call   800fe3 <sys_env_set_trapframe>
+  802231:	83 c4 10             	add    $0x10,%esp
+  802234:	85 c0                	test   %eax,%eax
+  802236:	78 25                	js     80225d <spawn+0x5c1>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802238:	83 ec 08             	sub    $0x8,%esp
+  80223b:	6a 02                	push   $0x2
+  80223d:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802243:	e8 b6 ec ff ff       	call   800efe <sys_env_set_status>
+  802248:	83 c4 10             	add    $0x10,%esp
+  80224b:	85 c0                	test   %eax,%eax
+  80224d:	78 23                	js     802272 <spawn+0x5d6>
+	return child;
+  80224f:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802255:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  80225b:	eb 36                	jmp    802293 <spawn+0x5f7>
+		panic("sys_env_set_trapframe: %e", r);
+  80225d:	50                   	push   %eax
+  80225e:	68 8c 38 80 00       	push   $0x80388c
+  802263:	68 85 00 00 00       	push   $0x85
+  802268:	68 69 38 80 00       	push   $0x803869
+  80226d:	e8 82 df ff ff       	call   8001f4 <_panic>
+		panic("sys_env_set_status: %e", r);
+  802272:	50                   	push   %eax
+  802273:	68 a6 38 80 00       	push   $0x8038a6
+  802278:	68 88 00 00 00       	push   $0x88
+  80227d:	68 69 38 80 00       	push   $0x803869
+  802282:	e8 6d df ff ff       	call   8001f4 <_panic>
+		return r;
+  802287:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  80228d:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+}
+  802293:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80229c:	5b                   	pop    %ebx
+  80229d:	5e                   	pop    %esi
+  80229e:	5f                   	pop    %edi
+  80229f:	5d                   	pop    %ebp
+  8022a0:	c3                   	ret
+		return -E_NO_MEM;
+  8022a1:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  8022a6:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  8022ac:	eb e5                	jmp    802293 <spawn+0x5f7>
+	sys_page_unmap(0, UTEMP);
+  8022ae:	83 ec 08             	sub    $0x8,%esp
+  8022b1:	68 00 00 40 00       	push   $0x400000
+  8022b6:	6a 00                	push   $0x0
+  8022b8:	e8 35 eb ff ff       	call   800df2 <sys_page_unmap>
+  8022bd:	83 c4 10             	add    $0x10,%esp
+  8022c0:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  8022c6:	eb cb                	jmp    802293 <spawn+0x5f7>
+
+008022c8 <spawnl>:
+{
+  8022c8:	55                   	push   %ebp
+  8022c9:	89 e5                	mov    %esp,%ebp
+  8022cb:	56                   	push   %esi
+  8022cc:	53                   	push   %ebx
+	va_start(vl, arg0);
+  8022cd:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  8022d0:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  8022d5:	eb 05                	jmp    8022dc <spawnl+0x14>
+		argc++;
+  8022d7:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  8022da:	89 ca                	mov    %ecx,%edx
+  8022dc:	8d 4a 04             	lea    0x4(%edx),%ecx
+  8022df:	83 3a 00             	cmpl   $0x0,(%edx)
+  8022e2:	75 f3                	jne    8022d7 <spawnl+0xf>
+	const char *argv[argc+2];
+  8022e4:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  8022eb:	83 e2 f0             	and    $0xfffffff0,%edx
+  8022ee:	29 d4                	sub    %edx,%esp
+  8022f0:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  8022f4:	89 da                	mov    %ebx,%edx
+  8022f6:	c1 ea 02             	shr    $0x2,%edx
+  8022f9:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  8022fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022ff:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802306:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  80230d:	00 
+	va_start(vl, arg0);
+  80230e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802311:	89 c2                	mov    %eax,%edx
+  802313:	b8 00 00 00 00       	mov    $0x0,%eax
+  802318:	eb 0b                	jmp    802325 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  80231a:	83 c0 01             	add    $0x1,%eax
+  80231d:	8b 31                	mov    (%ecx),%esi
+  80231f:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802322:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802325:	39 d0                	cmp    %edx,%eax
+  802327:	75 f1                	jne    80231a <spawnl+0x52>
+	return spawn(prog, argv);
+  802329:	83 ec 08             	sub    $0x8,%esp
+  80232c:	53                   	push   %ebx
+  80232d:	ff 75 08             	push   0x8(%ebp)
+  802330:	e8 67 f9 ff ff       	call   801c9c <spawn>
+}
+  802335:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802338:	5b                   	pop    %ebx
+  802339:	5e                   	pop    %esi
+  80233a:	5d                   	pop    %ebp
+  80233b:	c3                   	ret
+
+0080233c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80233c:	55                   	push   %ebp
+  80233d:	89 e5                	mov    %esp,%ebp
+  80233f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802342:	68 0b 39 80 00       	push   $0x80390b
+  802347:	ff 75 0c             	push   0xc(%ebp)
+  80234a:	e8 6e e5 ff ff       	call   8008bd <strcpy>
+	return 0;
+}
+  80234f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802354:	c9                   	leave
+  802355:	c3                   	ret
+
+00802356 <devsock_close>:
+{
+  802356:	55                   	push   %ebp
+  802357:	89 e5                	mov    %esp,%ebp
+  802359:	53                   	push   %ebx
+  80235a:	83 ec 10             	sub    $0x10,%esp
+  80235d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802360:	53                   	push   %ebx
+  802361:	e8 b8 0a 00 00       	call   802e1e <pageref>
+  802366:	89 c2                	mov    %eax,%edx
+  802368:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80236b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802370:	83 fa 01             	cmp    $0x1,%edx
+  802373:	74 05                	je     80237a <devsock_close+0x24>
+}
+  802375:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802378:	c9                   	leave
+  802379:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80237a:	83 ec 0c             	sub    $0xc,%esp
+  80237d:	ff 73 0c             	push   0xc(%ebx)
+  802380:	e8 b7 02 00 00       	call   80263c <nsipc_close>
+  802385:	83 c4 10             	add    $0x10,%esp
+  802388:	eb eb                	jmp    802375 <devsock_close+0x1f>
+
+0080238a <devsock_write>:
+{
+  80238a:	55                   	push   %ebp
+  80238b:	89 e5                	mov    %esp,%ebp
+  80238d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802390:	6a 00                	push   $0x0
+  802392:	ff 75 10             	push   0x10(%ebp)
+  802395:	ff 75 0c             	push   0xc(%ebp)
+  802398:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239b:	ff 70 0c             	push   0xc(%eax)
+  80239e:	e8 79 03 00 00       	call   80271c <nsipc_send>
+}
+  8023a3:	c9                   	leave
+  8023a4:	c3                   	ret
+
+008023a5 <devsock_read>:
+{
+  8023a5:	55                   	push   %ebp
+  8023a6:	89 e5                	mov    %esp,%ebp
+  8023a8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8023ab:	6a 00                	push   $0x0
+  8023ad:	ff 75 10             	push   0x10(%ebp)
+  8023b0:	ff 75 0c             	push   0xc(%ebp)
+  8023b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b6:	ff 70 0c             	push   0xc(%eax)
+  8023b9:	e8 ef 02 00 00       	call   8026ad <nsipc_recv>
+}
+  8023be:	c9                   	leave
+  8023bf:	c3                   	ret
+
+008023c0 <fd2sockid>:
+{
+  8023c0:	55                   	push   %ebp
+  8023c1:	89 e5                	mov    %esp,%ebp
+  8023c3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8023c6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023c9:	52                   	push   %edx
+  8023ca:	50                   	push   %eax
+  8023cb:	e8 5e f1 ff ff       	call   80152e <fd_lookup>
+  8023d0:	83 c4 10             	add    $0x10,%esp
+  8023d3:	85 c0                	test   %eax,%eax
+  8023d5:	78 10                	js     8023e7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8023d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023da:	8b 0d 28 40 80 00    	mov    0x804028,%ecx
+  8023e0:	39 08                	cmp    %ecx,(%eax)
+  8023e2:	75 05                	jne    8023e9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8023e4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8023e7:	c9                   	leave
+  8023e8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023e9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023ee:	eb f7                	jmp    8023e7 <fd2sockid+0x27>
+
+008023f0 <alloc_sockfd>:
+{
+  8023f0:	55                   	push   %ebp
+  8023f1:	89 e5                	mov    %esp,%ebp
+  8023f3:	56                   	push   %esi
+  8023f4:	53                   	push   %ebx
+  8023f5:	83 ec 1c             	sub    $0x1c,%esp
+  8023f8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8023fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023fd:	50                   	push   %eax
+  8023fe:	e8 d5 f0 ff ff       	call   8014d8 <fd_alloc>
+  802403:	89 c3                	mov    %eax,%ebx
+  802405:	83 c4 10             	add    $0x10,%esp
+  802408:	85 c0                	test   %eax,%eax
+  80240a:	78 43                	js     80244f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80240c:	83 ec 04             	sub    $0x4,%esp
+  80240f:	68 07 04 00 00       	push   $0x407
+  802414:	ff 75 f4             	push   -0xc(%ebp)
+  802417:	6a 00                	push   $0x0
+  802419:	e8 0c e9 ff ff       	call   800d2a <sys_page_alloc>
+  80241e:	89 c3                	mov    %eax,%ebx
+  802420:	83 c4 10             	add    $0x10,%esp
+  802423:	85 c0                	test   %eax,%eax
+  802425:	78 28                	js     80244f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802427:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80242a:	8b 15 28 40 80 00    	mov    0x804028,%edx
+  802430:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802432:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802435:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80243c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80243f:	83 ec 0c             	sub    $0xc,%esp
+  802442:	50                   	push   %eax
+  802443:	e8 69 f0 ff ff       	call   8014b1 <fd2num>
+  802448:	89 c3                	mov    %eax,%ebx
+  80244a:	83 c4 10             	add    $0x10,%esp
+  80244d:	eb 0c                	jmp    80245b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80244f:	83 ec 0c             	sub    $0xc,%esp
+  802452:	56                   	push   %esi
+  802453:	e8 e4 01 00 00       	call   80263c <nsipc_close>
+		return r;
+  802458:	83 c4 10             	add    $0x10,%esp
+}
+  80245b:	89 d8                	mov    %ebx,%eax
+  80245d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802460:	5b                   	pop    %ebx
+  802461:	5e                   	pop    %esi
+  802462:	5d                   	pop    %ebp
+  802463:	c3                   	ret
+
+00802464 <accept>:
+{
+  802464:	55                   	push   %ebp
+  802465:	89 e5                	mov    %esp,%ebp
+  802467:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80246a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80246d:	e8 4e ff ff ff       	call   8023c0 <fd2sockid>
+  802472:	85 c0                	test   %eax,%eax
+  802474:	78 1b                	js     802491 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802476:	83 ec 04             	sub    $0x4,%esp
+  802479:	ff 75 10             	push   0x10(%ebp)
+  80247c:	ff 75 0c             	push   0xc(%ebp)
+  80247f:	50                   	push   %eax
+  802480:	e8 0e 01 00 00       	call   802593 <nsipc_accept>
+  802485:	83 c4 10             	add    $0x10,%esp
+  802488:	85 c0                	test   %eax,%eax
+  80248a:	78 05                	js     802491 <accept+0x2d>
+	return alloc_sockfd(r);
+  80248c:	e8 5f ff ff ff       	call   8023f0 <alloc_sockfd>
+}
+  802491:	c9                   	leave
+  802492:	c3                   	ret
+
+00802493 <bind>:
+{
+  802493:	55                   	push   %ebp
+  802494:	89 e5                	mov    %esp,%ebp
+  802496:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802499:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249c:	e8 1f ff ff ff       	call   8023c0 <fd2sockid>
+  8024a1:	85 c0                	test   %eax,%eax
+  8024a3:	78 12                	js     8024b7 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8024a5:	83 ec 04             	sub    $0x4,%esp
+  8024a8:	ff 75 10             	push   0x10(%ebp)
+  8024ab:	ff 75 0c             	push   0xc(%ebp)
+  8024ae:	50                   	push   %eax
+  8024af:	e8 31 01 00 00       	call   8025e5 <nsipc_bind>
+  8024b4:	83 c4 10             	add    $0x10,%esp
+}
+  8024b7:	c9                   	leave
+  8024b8:	c3                   	ret
+
+008024b9 <shutdown>:
+{
+  8024b9:	55                   	push   %ebp
+  8024ba:	89 e5                	mov    %esp,%ebp
+  8024bc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c2:	e8 f9 fe ff ff       	call   8023c0 <fd2sockid>
+  8024c7:	85 c0                	test   %eax,%eax
+  8024c9:	78 0f                	js     8024da <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8024cb:	83 ec 08             	sub    $0x8,%esp
+  8024ce:	ff 75 0c             	push   0xc(%ebp)
+  8024d1:	50                   	push   %eax
+  8024d2:	e8 43 01 00 00       	call   80261a <nsipc_shutdown>
+  8024d7:	83 c4 10             	add    $0x10,%esp
+}
+  8024da:	c9                   	leave
+  8024db:	c3                   	ret
+
+008024dc <connect>:
+{
+  8024dc:	55                   	push   %ebp
+  8024dd:	89 e5                	mov    %esp,%ebp
+  8024df:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e5:	e8 d6 fe ff ff       	call   8023c0 <fd2sockid>
+  8024ea:	85 c0                	test   %eax,%eax
+  8024ec:	78 12                	js     802500 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8024ee:	83 ec 04             	sub    $0x4,%esp
+  8024f1:	ff 75 10             	push   0x10(%ebp)
+  8024f4:	ff 75 0c             	push   0xc(%ebp)
+  8024f7:	50                   	push   %eax
+  8024f8:	e8 59 01 00 00       	call   802656 <nsipc_connect>
+  8024fd:	83 c4 10             	add    $0x10,%esp
+}
+  802500:	c9                   	leave
+  802501:	c3                   	ret
+
+00802502 <listen>:
+{
+  802502:	55                   	push   %ebp
+  802503:	89 e5                	mov    %esp,%ebp
+  802505:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802508:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250b:	e8 b0 fe ff ff       	call   8023c0 <fd2sockid>
+  802510:	85 c0                	test   %eax,%eax
+  802512:	78 0f                	js     802523 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802514:	83 ec 08             	sub    $0x8,%esp
+  802517:	ff 75 0c             	push   0xc(%ebp)
+  80251a:	50                   	push   %eax
+  80251b:	e8 6b 01 00 00       	call   80268b <nsipc_listen>
+  802520:	83 c4 10             	add    $0x10,%esp
+}
+  802523:	c9                   	leave
+  802524:	c3                   	ret
+
+00802525 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802525:	55                   	push   %ebp
+  802526:	89 e5                	mov    %esp,%ebp
+  802528:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80252b:	ff 75 10             	push   0x10(%ebp)
+  80252e:	ff 75 0c             	push   0xc(%ebp)
+  802531:	ff 75 08             	push   0x8(%ebp)
+  802534:	e8 41 02 00 00       	call   80277a <nsipc_socket>
+  802539:	83 c4 10             	add    $0x10,%esp
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	78 05                	js     802545 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802540:	e8 ab fe ff ff       	call   8023f0 <alloc_sockfd>
+}
+  802545:	c9                   	leave
+  802546:	c3                   	ret
+
+00802547 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802547:	55                   	push   %ebp
+  802548:	89 e5                	mov    %esp,%ebp
+  80254a:	53                   	push   %ebx
+  80254b:	83 ec 04             	sub    $0x4,%esp
+  80254e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802550:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802557:	74 26                	je     80257f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802559:	6a 07                	push   $0x7
+  80255b:	68 00 70 80 00       	push   $0x807000
+  802560:	53                   	push   %ebx
+  802561:	ff 35 04 50 80 00    	push   0x805004
+  802567:	e8 4e 08 00 00       	call   802dba <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80256c:	83 c4 0c             	add    $0xc,%esp
+  80256f:	6a 00                	push   $0x0
+  802571:	6a 00                	push   $0x0
+  802573:	6a 00                	push   $0x0
+  802575:	e8 c8 07 00 00       	call   802d42 <ipc_recv>
+}
+  80257a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80257d:	c9                   	leave
+  80257e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80257f:	83 ec 0c             	sub    $0xc,%esp
+  802582:	6a 02                	push   $0x2
+  802584:	e8 85 08 00 00       	call   802e0e <ipc_find_env>
+  802589:	a3 04 50 80 00       	mov    %eax,0x805004
+  80258e:	83 c4 10             	add    $0x10,%esp
+  802591:	eb c6                	jmp    802559 <nsipc+0x12>
+
+00802593 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802593:	55                   	push   %ebp
+  802594:	89 e5                	mov    %esp,%ebp
+  802596:	56                   	push   %esi
+  802597:	53                   	push   %ebx
+  802598:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80259b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80259e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8025a3:	8b 06                	mov    (%esi),%eax
+  8025a5:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8025aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025af:	e8 93 ff ff ff       	call   802547 <nsipc>
+  8025b4:	89 c3                	mov    %eax,%ebx
+  8025b6:	85 c0                	test   %eax,%eax
+  8025b8:	79 09                	jns    8025c3 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8025ba:	89 d8                	mov    %ebx,%eax
+  8025bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025bf:	5b                   	pop    %ebx
+  8025c0:	5e                   	pop    %esi
+  8025c1:	5d                   	pop    %ebp
+  8025c2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8025c3:	83 ec 04             	sub    $0x4,%esp
+  8025c6:	ff 35 10 70 80 00    	push   0x807010
+  8025cc:	68 00 70 80 00       	push   $0x807000
+  8025d1:	ff 75 0c             	push   0xc(%ebp)
+  8025d4:	e8 6a e4 ff ff       	call   800a43 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8025d9:	a1 10 70 80 00       	mov    0x807010,%eax
+  8025de:	89 06                	mov    %eax,(%esi)
+  8025e0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8025e3:	eb d5                	jmp    8025ba <nsipc_accept+0x27>
+
+008025e5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8025e5:	55                   	push   %ebp
+  8025e6:	89 e5                	mov    %esp,%ebp
+  8025e8:	53                   	push   %ebx
+  8025e9:	83 ec 08             	sub    $0x8,%esp
+  8025ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8025ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f2:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8025f7:	53                   	push   %ebx
+  8025f8:	ff 75 0c             	push   0xc(%ebp)
+  8025fb:	68 04 70 80 00       	push   $0x807004
+  802600:	e8 3e e4 ff ff       	call   800a43 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802605:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80260b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802610:	e8 32 ff ff ff       	call   802547 <nsipc>
+}
+  802615:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802618:	c9                   	leave
+  802619:	c3                   	ret
+
+0080261a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80261a:	55                   	push   %ebp
+  80261b:	89 e5                	mov    %esp,%ebp
+  80261d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802620:	8b 45 08             	mov    0x8(%ebp),%eax
+  802623:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802628:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80262b:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802630:	b8 03 00 00 00       	mov    $0x3,%eax
+  802635:	e8 0d ff ff ff       	call   802547 <nsipc>
+}
+  80263a:	c9                   	leave
+  80263b:	c3                   	ret
+
+0080263c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80263c:	55                   	push   %ebp
+  80263d:	89 e5                	mov    %esp,%ebp
+  80263f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802642:	8b 45 08             	mov    0x8(%ebp),%eax
+  802645:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80264a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80264f:	e8 f3 fe ff ff       	call   802547 <nsipc>
+}
+  802654:	c9                   	leave
+  802655:	c3                   	ret
+
+00802656 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802656:	55                   	push   %ebp
+  802657:	89 e5                	mov    %esp,%ebp
+  802659:	53                   	push   %ebx
+  80265a:	83 ec 08             	sub    $0x8,%esp
+  80265d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802660:	8b 45 08             	mov    0x8(%ebp),%eax
+  802663:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802668:	53                   	push   %ebx
+  802669:	ff 75 0c             	push   0xc(%ebp)
+  80266c:	68 04 70 80 00       	push   $0x807004
+  802671:	e8 cd e3 ff ff       	call   800a43 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802676:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80267c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802681:	e8 c1 fe ff ff       	call   802547 <nsipc>
+}
+  802686:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802689:	c9                   	leave
+  80268a:	c3                   	ret
+
+0080268b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80268b:	55                   	push   %ebp
+  80268c:	89 e5                	mov    %esp,%ebp
+  80268e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802691:	8b 45 08             	mov    0x8(%ebp),%eax
+  802694:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802699:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80269c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8026a1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8026a6:	e8 9c fe ff ff       	call   802547 <nsipc>
+}
+  8026ab:	c9                   	leave
+  8026ac:	c3                   	ret
+
+008026ad <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8026ad:	55                   	push   %ebp
+  8026ae:	89 e5                	mov    %esp,%ebp
+  8026b0:	56                   	push   %esi
+  8026b1:	53                   	push   %ebx
+  8026b2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8026b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8026bd:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8026c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026c6:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8026cb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026d0:	e8 72 fe ff ff       	call   802547 <nsipc>
+  8026d5:	89 c3                	mov    %eax,%ebx
+  8026d7:	85 c0                	test   %eax,%eax
+  8026d9:	78 22                	js     8026fd <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8026db:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8026e0:	39 c6                	cmp    %eax,%esi
+  8026e2:	0f 4e c6             	cmovle %esi,%eax
+  8026e5:	39 c3                	cmp    %eax,%ebx
+  8026e7:	7f 1d                	jg     802706 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8026e9:	83 ec 04             	sub    $0x4,%esp
+  8026ec:	53                   	push   %ebx
+  8026ed:	68 00 70 80 00       	push   $0x807000
+  8026f2:	ff 75 0c             	push   0xc(%ebp)
+  8026f5:	e8 49 e3 ff ff       	call   800a43 <memmove>
+  8026fa:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8026fd:	89 d8                	mov    %ebx,%eax
+  8026ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802702:	5b                   	pop    %ebx
+  802703:	5e                   	pop    %esi
+  802704:	5d                   	pop    %ebp
+  802705:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802706:	68 17 39 80 00       	push   $0x803917
+  80270b:	68 23 38 80 00       	push   $0x803823
+  802710:	6a 62                	push   $0x62
+  802712:	68 2c 39 80 00       	push   $0x80392c
+  802717:	e8 d8 da ff ff       	call   8001f4 <_panic>
+
+0080271c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80271c:	55                   	push   %ebp
+  80271d:	89 e5                	mov    %esp,%ebp
+  80271f:	53                   	push   %ebx
+  802720:	83 ec 04             	sub    $0x4,%esp
+  802723:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802726:	8b 45 08             	mov    0x8(%ebp),%eax
+  802729:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80272e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802734:	7f 2e                	jg     802764 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802736:	83 ec 04             	sub    $0x4,%esp
+  802739:	53                   	push   %ebx
+  80273a:	ff 75 0c             	push   0xc(%ebp)
+  80273d:	68 0c 70 80 00       	push   $0x80700c
+  802742:	e8 fc e2 ff ff       	call   800a43 <memmove>
+	nsipcbuf.send.req_size = size;
+  802747:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80274d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802750:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802755:	b8 08 00 00 00       	mov    $0x8,%eax
+  80275a:	e8 e8 fd ff ff       	call   802547 <nsipc>
+}
+  80275f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802762:	c9                   	leave
+  802763:	c3                   	ret
+	assert(size < 1600);
+  802764:	68 38 39 80 00       	push   $0x803938
+  802769:	68 23 38 80 00       	push   $0x803823
+  80276e:	6a 6d                	push   $0x6d
+  802770:	68 2c 39 80 00       	push   $0x80392c
+  802775:	e8 7a da ff ff       	call   8001f4 <_panic>
+
+0080277a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80277a:	55                   	push   %ebp
+  80277b:	89 e5                	mov    %esp,%ebp
+  80277d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802780:	8b 45 08             	mov    0x8(%ebp),%eax
+  802783:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802788:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80278b:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802790:	8b 45 10             	mov    0x10(%ebp),%eax
+  802793:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802798:	b8 09 00 00 00       	mov    $0x9,%eax
+  80279d:	e8 a5 fd ff ff       	call   802547 <nsipc>
+}
+  8027a2:	c9                   	leave
+  8027a3:	c3                   	ret
+
+008027a4 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8027a4:	55                   	push   %ebp
+  8027a5:	89 e5                	mov    %esp,%ebp
+  8027a7:	56                   	push   %esi
+  8027a8:	53                   	push   %ebx
+  8027a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8027ac:	83 ec 0c             	sub    $0xc,%esp
+  8027af:	ff 75 08             	push   0x8(%ebp)
+  8027b2:	e8 0a ed ff ff       	call   8014c1 <fd2data>
+  8027b7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8027b9:	83 c4 08             	add    $0x8,%esp
+  8027bc:	68 44 39 80 00       	push   $0x803944
+  8027c1:	53                   	push   %ebx
+  8027c2:	e8 f6 e0 ff ff       	call   8008bd <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8027c7:	8b 46 04             	mov    0x4(%esi),%eax
+  8027ca:	2b 06                	sub    (%esi),%eax
+  8027cc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8027d2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8027d9:	00 00 00 
+	stat->st_dev = &devpipe;
+  8027dc:	c7 83 88 00 00 00 44 	movl   $0x804044,0x88(%ebx)
+  8027e3:	40 80 00 
+	return 0;
+}
+  8027e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ee:	5b                   	pop    %ebx
+  8027ef:	5e                   	pop    %esi
+  8027f0:	5d                   	pop    %ebp
+  8027f1:	c3                   	ret
+
+008027f2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8027f2:	55                   	push   %ebp
+  8027f3:	89 e5                	mov    %esp,%ebp
+  8027f5:	53                   	push   %ebx
+  8027f6:	83 ec 0c             	sub    $0xc,%esp
+  8027f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8027fc:	53                   	push   %ebx
+  8027fd:	6a 00                	push   $0x0
+  8027ff:	e8 ee e5 ff ff       	call   800df2 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802804:	89 1c 24             	mov    %ebx,(%esp)
+  802807:	e8 b5 ec ff ff       	call   8014c1 <fd2data>
+  80280c:	83 c4 08             	add    $0x8,%esp
+  80280f:	50                   	push   %eax
+  802810:	6a 00                	push   $0x0
+  802812:	e8 db e5 ff ff       	call   800df2 <sys_page_unmap>
+}
+  802817:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80281a:	c9                   	leave
+  80281b:	c3                   	ret
+
+0080281c <_pipeisclosed>:
+{
+  80281c:	55                   	push   %ebp
+  80281d:	89 e5                	mov    %esp,%ebp
+  80281f:	57                   	push   %edi
+  802820:	56                   	push   %esi
+  802821:	53                   	push   %ebx
+  802822:	83 ec 1c             	sub    $0x1c,%esp
+  802825:	89 c7                	mov    %eax,%edi
+  802827:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802829:	a1 08 50 80 00       	mov    0x805008,%eax
+  80282e:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802831:	83 ec 0c             	sub    $0xc,%esp
+  802834:	57                   	push   %edi
+  802835:	e8 e4 05 00 00       	call   802e1e <pageref>
+  80283a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80283d:	89 34 24             	mov    %esi,(%esp)
+  802840:	e8 d9 05 00 00       	call   802e1e <pageref>
+		nn = thisenv->env_runs;
+  802845:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  80284b:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  80284e:	83 c4 10             	add    $0x10,%esp
+  802851:	39 cb                	cmp    %ecx,%ebx
+  802853:	74 1b                	je     802870 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802855:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802858:	75 cf                	jne    802829 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80285a:	8b 42 5c             	mov    0x5c(%edx),%eax
+  80285d:	6a 01                	push   $0x1
+  80285f:	50                   	push   %eax
+  802860:	53                   	push   %ebx
+  802861:	68 4b 39 80 00       	push   $0x80394b
+  802866:	e8 64 da ff ff       	call   8002cf <cprintf>
+  80286b:	83 c4 10             	add    $0x10,%esp
+  80286e:	eb b9                	jmp    802829 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802870:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802873:	0f 94 c0             	sete   %al
+  802876:	0f b6 c0             	movzbl %al,%eax
+}
+  802879:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80287c:	5b                   	pop    %ebx
+  80287d:	5e                   	pop    %esi
+  80287e:	5f                   	pop    %edi
+  80287f:	5d                   	pop    %ebp
+  802880:	c3                   	ret
+
+00802881 <devpipe_write>:
+{
+  802881:	55                   	push   %ebp
+  802882:	89 e5                	mov    %esp,%ebp
+  802884:	57                   	push   %edi
+  802885:	56                   	push   %esi
+  802886:	53                   	push   %ebx
+  802887:	83 ec 28             	sub    $0x28,%esp
+  80288a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80288d:	56                   	push   %esi
+  80288e:	e8 2e ec ff ff       	call   8014c1 <fd2data>
+  802893:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802895:	83 c4 10             	add    $0x10,%esp
+  802898:	bf 00 00 00 00       	mov    $0x0,%edi
+  80289d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8028a0:	75 09                	jne    8028ab <devpipe_write+0x2a>
+	return i;
+  8028a2:	89 f8                	mov    %edi,%eax
+  8028a4:	eb 23                	jmp    8028c9 <devpipe_write+0x48>
+			sys_yield();
+  8028a6:	e8 ff e3 ff ff       	call   800caa <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8028ab:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028ae:	8b 0b                	mov    (%ebx),%ecx
+  8028b0:	8d 51 20             	lea    0x20(%ecx),%edx
+  8028b3:	39 d0                	cmp    %edx,%eax
+  8028b5:	72 1a                	jb     8028d1 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8028b7:	89 da                	mov    %ebx,%edx
+  8028b9:	89 f0                	mov    %esi,%eax
+  8028bb:	e8 5c ff ff ff       	call   80281c <_pipeisclosed>
+  8028c0:	85 c0                	test   %eax,%eax
+  8028c2:	74 e2                	je     8028a6 <devpipe_write+0x25>
+				return 0;
+  8028c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028cc:	5b                   	pop    %ebx
+  8028cd:	5e                   	pop    %esi
+  8028ce:	5f                   	pop    %edi
+  8028cf:	5d                   	pop    %ebp
+  8028d0:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8028d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028d4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8028d8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8028db:	89 c2                	mov    %eax,%edx
+  8028dd:	c1 fa 1f             	sar    $0x1f,%edx
+  8028e0:	89 d1                	mov    %edx,%ecx
+  8028e2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8028e5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8028e8:	83 e2 1f             	and    $0x1f,%edx
+  8028eb:	29 ca                	sub    %ecx,%edx
+  8028ed:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8028f1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8028f5:	83 c0 01             	add    $0x1,%eax
+  8028f8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8028fb:	83 c7 01             	add    $0x1,%edi
+  8028fe:	eb 9d                	jmp    80289d <devpipe_write+0x1c>
+
+00802900 <devpipe_read>:
+{
+  802900:	55                   	push   %ebp
+  802901:	89 e5                	mov    %esp,%ebp
+  802903:	57                   	push   %edi
+  802904:	56                   	push   %esi
+  802905:	53                   	push   %ebx
+  802906:	83 ec 18             	sub    $0x18,%esp
+  802909:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80290c:	57                   	push   %edi
+  80290d:	e8 af eb ff ff       	call   8014c1 <fd2data>
+  802912:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802914:	83 c4 10             	add    $0x10,%esp
+  802917:	be 00 00 00 00       	mov    $0x0,%esi
+  80291c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80291f:	75 13                	jne    802934 <devpipe_read+0x34>
+	return i;
+  802921:	89 f0                	mov    %esi,%eax
+  802923:	eb 02                	jmp    802927 <devpipe_read+0x27>
+				return i;
+  802925:	89 f0                	mov    %esi,%eax
+}
+  802927:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80292a:	5b                   	pop    %ebx
+  80292b:	5e                   	pop    %esi
+  80292c:	5f                   	pop    %edi
+  80292d:	5d                   	pop    %ebp
+  80292e:	c3                   	ret
+			sys_yield();
+  80292f:	e8 76 e3 ff ff       	call   800caa <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802934:	8b 03                	mov    (%ebx),%eax
+  802936:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802939:	75 18                	jne    802953 <devpipe_read+0x53>
+			if (i > 0)
+  80293b:	85 f6                	test   %esi,%esi
+  80293d:	75 e6                	jne    802925 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80293f:	89 da                	mov    %ebx,%edx
+  802941:	89 f8                	mov    %edi,%eax
+  802943:	e8 d4 fe ff ff       	call   80281c <_pipeisclosed>
+  802948:	85 c0                	test   %eax,%eax
+  80294a:	74 e3                	je     80292f <devpipe_read+0x2f>
+				return 0;
+  80294c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802951:	eb d4                	jmp    802927 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802953:	99                   	cltd
+  802954:	c1 ea 1b             	shr    $0x1b,%edx
+  802957:	01 d0                	add    %edx,%eax
+  802959:	83 e0 1f             	and    $0x1f,%eax
+  80295c:	29 d0                	sub    %edx,%eax
+  80295e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802963:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802966:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802969:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80296c:	83 c6 01             	add    $0x1,%esi
+  80296f:	eb ab                	jmp    80291c <devpipe_read+0x1c>
+
+00802971 <pipe>:
+{
+  802971:	55                   	push   %ebp
+  802972:	89 e5                	mov    %esp,%ebp
+  802974:	56                   	push   %esi
+  802975:	53                   	push   %ebx
+  802976:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802979:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80297c:	50                   	push   %eax
+  80297d:	e8 56 eb ff ff       	call   8014d8 <fd_alloc>
+  802982:	89 c3                	mov    %eax,%ebx
+  802984:	83 c4 10             	add    $0x10,%esp
+  802987:	85 c0                	test   %eax,%eax
+  802989:	0f 88 23 01 00 00    	js     802ab2 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80298f:	83 ec 04             	sub    $0x4,%esp
+  802992:	68 07 04 00 00       	push   $0x407
+  802997:	ff 75 f4             	push   -0xc(%ebp)
+  80299a:	6a 00                	push   $0x0
+  80299c:	e8 89 e3 ff ff       	call   800d2a <sys_page_alloc>
+  8029a1:	89 c3                	mov    %eax,%ebx
+  8029a3:	83 c4 10             	add    $0x10,%esp
+  8029a6:	85 c0                	test   %eax,%eax
+  8029a8:	0f 88 04 01 00 00    	js     802ab2 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8029ae:	83 ec 0c             	sub    $0xc,%esp
+  8029b1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8029b4:	50                   	push   %eax
+  8029b5:	e8 1e eb ff ff       	call   8014d8 <fd_alloc>
+  8029ba:	89 c3                	mov    %eax,%ebx
+  8029bc:	83 c4 10             	add    $0x10,%esp
+  8029bf:	85 c0                	test   %eax,%eax
+  8029c1:	0f 88 db 00 00 00    	js     802aa2 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029c7:	83 ec 04             	sub    $0x4,%esp
+  8029ca:	68 07 04 00 00       	push   $0x407
+  8029cf:	ff 75 f0             	push   -0x10(%ebp)
+  8029d2:	6a 00                	push   $0x0
+  8029d4:	e8 51 e3 ff ff       	call   800d2a <sys_page_alloc>
+  8029d9:	89 c3                	mov    %eax,%ebx
+  8029db:	83 c4 10             	add    $0x10,%esp
+  8029de:	85 c0                	test   %eax,%eax
+  8029e0:	0f 88 bc 00 00 00    	js     802aa2 <pipe+0x131>
+	va = fd2data(fd0);
+  8029e6:	83 ec 0c             	sub    $0xc,%esp
+  8029e9:	ff 75 f4             	push   -0xc(%ebp)
+  8029ec:	e8 d0 ea ff ff       	call   8014c1 <fd2data>
+  8029f1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029f3:	83 c4 0c             	add    $0xc,%esp
+  8029f6:	68 07 04 00 00       	push   $0x407
+  8029fb:	50                   	push   %eax
+  8029fc:	6a 00                	push   $0x0
+  8029fe:	e8 27 e3 ff ff       	call   800d2a <sys_page_alloc>
+  802a03:	89 c3                	mov    %eax,%ebx
+  802a05:	83 c4 10             	add    $0x10,%esp
+  802a08:	85 c0                	test   %eax,%eax
+  802a0a:	0f 88 82 00 00 00    	js     802a92 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a10:	83 ec 0c             	sub    $0xc,%esp
+  802a13:	ff 75 f0             	push   -0x10(%ebp)
+  802a16:	e8 a6 ea ff ff       	call   8014c1 <fd2data>
+  802a1b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802a22:	50                   	push   %eax
+  802a23:	6a 00                	push   $0x0
+  802a25:	56                   	push   %esi
+  802a26:	6a 00                	push   $0x0
+  802a28:	e8 83 e3 ff ff       	call   800db0 <sys_page_map>
+  802a2d:	89 c3                	mov    %eax,%ebx
+  802a2f:	83 c4 20             	add    $0x20,%esp
+  802a32:	85 c0                	test   %eax,%eax
+  802a34:	78 4e                	js     802a84 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802a36:	a1 44 40 80 00       	mov    0x804044,%eax
+  802a3b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a3e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802a40:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a43:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802a4a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802a4d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802a4f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802a52:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802a59:	83 ec 0c             	sub    $0xc,%esp
+  802a5c:	ff 75 f4             	push   -0xc(%ebp)
+  802a5f:	e8 4d ea ff ff       	call   8014b1 <fd2num>
+  802a64:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a67:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802a69:	83 c4 04             	add    $0x4,%esp
+  802a6c:	ff 75 f0             	push   -0x10(%ebp)
+  802a6f:	e8 3d ea ff ff       	call   8014b1 <fd2num>
+  802a74:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a77:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802a7a:	83 c4 10             	add    $0x10,%esp
+  802a7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a82:	eb 2e                	jmp    802ab2 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802a84:	83 ec 08             	sub    $0x8,%esp
+  802a87:	56                   	push   %esi
+  802a88:	6a 00                	push   $0x0
+  802a8a:	e8 63 e3 ff ff       	call   800df2 <sys_page_unmap>
+  802a8f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802a92:	83 ec 08             	sub    $0x8,%esp
+  802a95:	ff 75 f0             	push   -0x10(%ebp)
+  802a98:	6a 00                	push   $0x0
+  802a9a:	e8 53 e3 ff ff       	call   800df2 <sys_page_unmap>
+  802a9f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802aa2:	83 ec 08             	sub    $0x8,%esp
+  802aa5:	ff 75 f4             	push   -0xc(%ebp)
+  802aa8:	6a 00                	push   $0x0
+  802aaa:	e8 43 e3 ff ff       	call   800df2 <sys_page_unmap>
+  802aaf:	83 c4 10             	add    $0x10,%esp
+}
+  802ab2:	89 d8                	mov    %ebx,%eax
+  802ab4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ab7:	5b                   	pop    %ebx
+  802ab8:	5e                   	pop    %esi
+  802ab9:	5d                   	pop    %ebp
+  802aba:	c3                   	ret
+
+00802abb <pipeisclosed>:
+{
+  802abb:	55                   	push   %ebp
+  802abc:	89 e5                	mov    %esp,%ebp
+  802abe:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ac1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ac4:	50                   	push   %eax
+  802ac5:	ff 75 08             	push   0x8(%ebp)
+  802ac8:	e8 61 ea ff ff       	call   80152e <fd_lookup>
+  802acd:	83 c4 10             	add    $0x10,%esp
+  802ad0:	85 c0                	test   %eax,%eax
+  802ad2:	78 18                	js     802aec <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802ad4:	83 ec 0c             	sub    $0xc,%esp
+  802ad7:	ff 75 f4             	push   -0xc(%ebp)
+  802ada:	e8 e2 e9 ff ff       	call   8014c1 <fd2data>
+  802adf:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802ae1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ae4:	e8 33 fd ff ff       	call   80281c <_pipeisclosed>
+  802ae9:	83 c4 10             	add    $0x10,%esp
+}
+  802aec:	c9                   	leave
+  802aed:	c3                   	ret
+
+00802aee <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802aee:	55                   	push   %ebp
+  802aef:	89 e5                	mov    %esp,%ebp
+  802af1:	56                   	push   %esi
+  802af2:	53                   	push   %ebx
+  802af3:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  802af6:	85 f6                	test   %esi,%esi
+  802af8:	74 13                	je     802b0d <wait+0x1f>
+	e = &envs[ENVX(envid)];
+  802afa:	89 f3                	mov    %esi,%ebx
+  802afc:	81 e3 ff 1f 00 00    	and    $0x1fff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  802b02:	c1 e3 09             	shl    $0x9,%ebx
+  802b05:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802b0b:	eb 1b                	jmp    802b28 <wait+0x3a>
+	assert(envid != 0);
+  802b0d:	68 63 39 80 00       	push   $0x803963
+  802b12:	68 23 38 80 00       	push   $0x803823
+  802b17:	6a 09                	push   $0x9
+  802b19:	68 6e 39 80 00       	push   $0x80396e
+  802b1e:	e8 d1 d6 ff ff       	call   8001f4 <_panic>
+		sys_yield();
+  802b23:	e8 82 e1 ff ff       	call   800caa <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  802b28:	8b 43 4c             	mov    0x4c(%ebx),%eax
+  802b2b:	39 f0                	cmp    %esi,%eax
+  802b2d:	75 07                	jne    802b36 <wait+0x48>
+  802b2f:	8b 43 58             	mov    0x58(%ebx),%eax
+  802b32:	85 c0                	test   %eax,%eax
+  802b34:	75 ed                	jne    802b23 <wait+0x35>
+}
+  802b36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b39:	5b                   	pop    %ebx
+  802b3a:	5e                   	pop    %esi
+  802b3b:	5d                   	pop    %ebp
+  802b3c:	c3                   	ret
+
+00802b3d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b42:	c3                   	ret
+
+00802b43 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b43:	55                   	push   %ebp
+  802b44:	89 e5                	mov    %esp,%ebp
+  802b46:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802b49:	68 79 39 80 00       	push   $0x803979
+  802b4e:	ff 75 0c             	push   0xc(%ebp)
+  802b51:	e8 67 dd ff ff       	call   8008bd <strcpy>
+	return 0;
+}
+  802b56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b5b:	c9                   	leave
+  802b5c:	c3                   	ret
+
+00802b5d <devcons_write>:
+{
+  802b5d:	55                   	push   %ebp
+  802b5e:	89 e5                	mov    %esp,%ebp
+  802b60:	57                   	push   %edi
+  802b61:	56                   	push   %esi
+  802b62:	53                   	push   %ebx
+  802b63:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802b69:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802b6e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802b74:	eb 2e                	jmp    802ba4 <devcons_write+0x47>
+		m = n - tot;
+  802b76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b79:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802b7b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b80:	39 c3                	cmp    %eax,%ebx
+  802b82:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802b85:	83 ec 04             	sub    $0x4,%esp
+  802b88:	53                   	push   %ebx
+  802b89:	89 f0                	mov    %esi,%eax
+  802b8b:	03 45 0c             	add    0xc(%ebp),%eax
+  802b8e:	50                   	push   %eax
+  802b8f:	57                   	push   %edi
+  802b90:	e8 ae de ff ff       	call   800a43 <memmove>
+		sys_cputs(buf, m);
+  802b95:	83 c4 08             	add    $0x8,%esp
+  802b98:	53                   	push   %ebx
+  802b99:	57                   	push   %edi
+  802b9a:	e8 4e e0 ff ff       	call   800bed <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802b9f:	01 de                	add    %ebx,%esi
+  802ba1:	83 c4 10             	add    $0x10,%esp
+  802ba4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ba7:	72 cd                	jb     802b76 <devcons_write+0x19>
+}
+  802ba9:	89 f0                	mov    %esi,%eax
+  802bab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bae:	5b                   	pop    %ebx
+  802baf:	5e                   	pop    %esi
+  802bb0:	5f                   	pop    %edi
+  802bb1:	5d                   	pop    %ebp
+  802bb2:	c3                   	ret
+
+00802bb3 <devcons_read>:
+{
+  802bb3:	55                   	push   %ebp
+  802bb4:	89 e5                	mov    %esp,%ebp
+  802bb6:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbe:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802bc2:	75 07                	jne    802bcb <devcons_read+0x18>
+  802bc4:	eb 1f                	jmp    802be5 <devcons_read+0x32>
+		sys_yield();
+  802bc6:	e8 df e0 ff ff       	call   800caa <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802bcb:	e8 3b e0 ff ff       	call   800c0b <sys_cgetc>
+  802bd0:	85 c0                	test   %eax,%eax
+  802bd2:	74 f2                	je     802bc6 <devcons_read+0x13>
+	if (c < 0)
+  802bd4:	78 0f                	js     802be5 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802bd6:	83 f8 04             	cmp    $0x4,%eax
+  802bd9:	74 0c                	je     802be7 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802bdb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bde:	88 02                	mov    %al,(%edx)
+	return 1;
+  802be0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802be5:	c9                   	leave
+  802be6:	c3                   	ret
+		return 0;
+  802be7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bec:	eb f7                	jmp    802be5 <devcons_read+0x32>
+
+00802bee <cputchar>:
+{
+  802bee:	55                   	push   %ebp
+  802bef:	89 e5                	mov    %esp,%ebp
+  802bf1:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf7:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802bfa:	6a 01                	push   $0x1
+  802bfc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bff:	50                   	push   %eax
+  802c00:	e8 e8 df ff ff       	call   800bed <sys_cputs>
+}
+  802c05:	83 c4 10             	add    $0x10,%esp
+  802c08:	c9                   	leave
+  802c09:	c3                   	ret
+
+00802c0a <getchar>:
+{
+  802c0a:	55                   	push   %ebp
+  802c0b:	89 e5                	mov    %esp,%ebp
+  802c0d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802c10:	6a 01                	push   $0x1
+  802c12:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c15:	50                   	push   %eax
+  802c16:	6a 00                	push   $0x0
+  802c18:	e8 77 eb ff ff       	call   801794 <read>
+	if (r < 0)
+  802c1d:	83 c4 10             	add    $0x10,%esp
+  802c20:	85 c0                	test   %eax,%eax
+  802c22:	78 06                	js     802c2a <getchar+0x20>
+	if (r < 1)
+  802c24:	74 06                	je     802c2c <getchar+0x22>
+	return c;
+  802c26:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802c2a:	c9                   	leave
+  802c2b:	c3                   	ret
+		return -E_EOF;
+  802c2c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c31:	eb f7                	jmp    802c2a <getchar+0x20>
+
+00802c33 <iscons>:
+{
+  802c33:	55                   	push   %ebp
+  802c34:	89 e5                	mov    %esp,%ebp
+  802c36:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c3c:	50                   	push   %eax
+  802c3d:	ff 75 08             	push   0x8(%ebp)
+  802c40:	e8 e9 e8 ff ff       	call   80152e <fd_lookup>
+  802c45:	83 c4 10             	add    $0x10,%esp
+  802c48:	85 c0                	test   %eax,%eax
+  802c4a:	78 11                	js     802c5d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802c4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c4f:	8b 15 60 40 80 00    	mov    0x804060,%edx
+  802c55:	39 10                	cmp    %edx,(%eax)
+  802c57:	0f 94 c0             	sete   %al
+  802c5a:	0f b6 c0             	movzbl %al,%eax
+}
+  802c5d:	c9                   	leave
+  802c5e:	c3                   	ret
+
+00802c5f <opencons>:
+{
+  802c5f:	55                   	push   %ebp
+  802c60:	89 e5                	mov    %esp,%ebp
+  802c62:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802c65:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c68:	50                   	push   %eax
+  802c69:	e8 6a e8 ff ff       	call   8014d8 <fd_alloc>
+  802c6e:	83 c4 10             	add    $0x10,%esp
+  802c71:	85 c0                	test   %eax,%eax
+  802c73:	78 3a                	js     802caf <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802c75:	83 ec 04             	sub    $0x4,%esp
+  802c78:	68 07 04 00 00       	push   $0x407
+  802c7d:	ff 75 f4             	push   -0xc(%ebp)
+  802c80:	6a 00                	push   $0x0
+  802c82:	e8 a3 e0 ff ff       	call   800d2a <sys_page_alloc>
+  802c87:	83 c4 10             	add    $0x10,%esp
+  802c8a:	85 c0                	test   %eax,%eax
+  802c8c:	78 21                	js     802caf <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802c8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c91:	8b 15 60 40 80 00    	mov    0x804060,%edx
+  802c97:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802c99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c9c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802ca3:	83 ec 0c             	sub    $0xc,%esp
+  802ca6:	50                   	push   %eax
+  802ca7:	e8 05 e8 ff ff       	call   8014b1 <fd2num>
+  802cac:	83 c4 10             	add    $0x10,%esp
+}
+  802caf:	c9                   	leave
+  802cb0:	c3                   	ret
+
+00802cb1 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802cb1:	55                   	push   %ebp
+  802cb2:	89 e5                	mov    %esp,%ebp
+  802cb4:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802cb7:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802cbe:	74 0a                	je     802cca <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc3:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  802cc8:	c9                   	leave
+  802cc9:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  802cca:	83 ec 04             	sub    $0x4,%esp
+  802ccd:	6a 07                	push   $0x7
+  802ccf:	68 00 f0 bf ee       	push   $0xeebff000
+  802cd4:	6a 00                	push   $0x0
+  802cd6:	e8 4f e0 ff ff       	call   800d2a <sys_page_alloc>
+  802cdb:	83 c4 10             	add    $0x10,%esp
+  802cde:	85 c0                	test   %eax,%eax
+  802ce0:	78 28                	js     802d0a <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802ce2:	83 ec 08             	sub    $0x8,%esp
+  802ce5:	68 1c 2d 80 00       	push   $0x802d1c
+  802cea:	6a 00                	push   $0x0
+  802cec:	e8 34 e3 ff ff       	call   801025 <sys_env_set_pgfault_upcall>
+  802cf1:	83 c4 10             	add    $0x10,%esp
+  802cf4:	85 c0                	test   %eax,%eax
+  802cf6:	79 c8                	jns    802cc0 <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  802cf8:	50                   	push   %eax
+  802cf9:	68 93 39 80 00       	push   $0x803993
+  802cfe:	6a 24                	push   $0x24
+  802d00:	68 85 39 80 00       	push   $0x803985
+  802d05:	e8 ea d4 ff ff       	call   8001f4 <_panic>
+			panic("sys_page_alloc: %e", r);
+  802d0a:	50                   	push   %eax
+  802d0b:	68 ac 32 80 00       	push   $0x8032ac
+  802d10:	6a 21                	push   $0x21
+  802d12:	68 85 39 80 00       	push   $0x803985
+  802d17:	e8 d8 d4 ff ff       	call   8001f4 <_panic>
+
+00802d1c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802d1c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802d1d:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802d22:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802d24:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802d27:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  802d2a:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  802d2e:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  802d31:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  802d35:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  802d39:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  802d3b:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802d3c:	83 c4 04             	add    $0x4,%esp
+	popf
+  802d3f:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802d40:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802d41:	c3                   	ret
+
+00802d42 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802d42:	55                   	push   %ebp
+  802d43:	89 e5                	mov    %esp,%ebp
+  802d45:	57                   	push   %edi
+  802d46:	56                   	push   %esi
+  802d47:	53                   	push   %ebx
+  802d48:	83 ec 18             	sub    $0x18,%esp
+  802d4b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d4e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802d51:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802d54:	85 db                	test   %ebx,%ebx
+  802d56:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d5b:	0f 45 c3             	cmovne %ebx,%eax
+  802d5e:	50                   	push   %eax
+  802d5f:	e8 49 e3 ff ff       	call   8010ad <sys_ipc_recv>
+
+	if (from_env_store)
+  802d64:	83 c4 10             	add    $0x10,%esp
+  802d67:	85 ff                	test   %edi,%edi
+  802d69:	74 17                	je     802d82 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802d6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d70:	85 c0                	test   %eax,%eax
+  802d72:	75 0c                	jne    802d80 <ipc_recv+0x3e>
+  802d74:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802d7a:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802d80:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802d82:	85 f6                	test   %esi,%esi
+  802d84:	74 2e                	je     802db4 <ipc_recv+0x72>
+		if (!r && pg)
+  802d86:	85 c0                	test   %eax,%eax
+  802d88:	75 24                	jne    802dae <ipc_recv+0x6c>
+  802d8a:	85 db                	test   %ebx,%ebx
+  802d8c:	74 20                	je     802dae <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802d8e:	a1 08 50 80 00       	mov    0x805008,%eax
+  802d93:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802d99:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802d9b:	a1 08 50 80 00       	mov    0x805008,%eax
+  802da0:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802da6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802da9:	5b                   	pop    %ebx
+  802daa:	5e                   	pop    %esi
+  802dab:	5f                   	pop    %edi
+  802dac:	5d                   	pop    %ebp
+  802dad:	c3                   	ret
+			*perm_store = 0;
+  802dae:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802db4:	85 c0                	test   %eax,%eax
+  802db6:	75 ee                	jne    802da6 <ipc_recv+0x64>
+  802db8:	eb e1                	jmp    802d9b <ipc_recv+0x59>
+
+00802dba <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802dba:	55                   	push   %ebp
+  802dbb:	89 e5                	mov    %esp,%ebp
+  802dbd:	57                   	push   %edi
+  802dbe:	56                   	push   %esi
+  802dbf:	53                   	push   %ebx
+  802dc0:	83 ec 0c             	sub    $0xc,%esp
+  802dc3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802dc6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802dc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802dcc:	85 db                	test   %ebx,%ebx
+  802dce:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802dd3:	0f 44 d8             	cmove  %eax,%ebx
+  802dd6:	ff 75 14             	push   0x14(%ebp)
+  802dd9:	53                   	push   %ebx
+  802dda:	56                   	push   %esi
+  802ddb:	57                   	push   %edi
+  802ddc:	e8 a9 e2 ff ff       	call   80108a <sys_ipc_try_send_yield>
+  802de1:	83 c4 10             	add    $0x10,%esp
+  802de4:	85 c0                	test   %eax,%eax
+  802de6:	79 1e                	jns    802e06 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802de8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802deb:	75 07                	jne    802df4 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802ded:	e8 b8 de ff ff       	call   800caa <sys_yield>
+  802df2:	eb e2                	jmp    802dd6 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802df4:	50                   	push   %eax
+  802df5:	68 b1 39 80 00       	push   $0x8039b1
+  802dfa:	6a 3d                	push   $0x3d
+  802dfc:	68 c6 39 80 00       	push   $0x8039c6
+  802e01:	e8 ee d3 ff ff       	call   8001f4 <_panic>
+	}
+}
+  802e06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e09:	5b                   	pop    %ebx
+  802e0a:	5e                   	pop    %esi
+  802e0b:	5f                   	pop    %edi
+  802e0c:	5d                   	pop    %ebp
+  802e0d:	c3                   	ret
+
+00802e0e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802e0e:	55                   	push   %ebp
+  802e0f:	89 e5                	mov    %esp,%ebp
+  802e11:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802e14:	ff 75 08             	push   0x8(%ebp)
+  802e17:	e8 0e de ff ff       	call   800c2a <sys_env_find>
+}
+  802e1c:	c9                   	leave
+  802e1d:	c3                   	ret
+
+00802e1e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802e1e:	55                   	push   %ebp
+  802e1f:	89 e5                	mov    %esp,%ebp
+  802e21:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802e24:	89 c2                	mov    %eax,%edx
+  802e26:	c1 ea 16             	shr    $0x16,%edx
+  802e29:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802e30:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802e35:	f6 c1 01             	test   $0x1,%cl
+  802e38:	74 22                	je     802e5c <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802e3a:	c1 e8 0c             	shr    $0xc,%eax
+  802e3d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802e44:	a8 01                	test   $0x1,%al
+  802e46:	74 14                	je     802e5c <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802e48:	c1 e8 0c             	shr    $0xc,%eax
+  802e4b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802e4e:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802e55:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802e59:	0f b7 d2             	movzwl %dx,%edx
+}
+  802e5c:	89 d0                	mov    %edx,%eax
+  802e5e:	5d                   	pop    %ebp
+  802e5f:	c3                   	ret
+
+00802e60 <__udivmoddi4>:
+  802e60:	55                   	push   %ebp
+  802e61:	57                   	push   %edi
+  802e62:	56                   	push   %esi
+  802e63:	53                   	push   %ebx
+  802e64:	83 ec 14             	sub    $0x14,%esp
+  802e67:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802e6b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802e6f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e73:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e77:	89 f1                	mov    %esi,%ecx
+  802e79:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  802e7d:	09 d9                	or     %ebx,%ecx
+  802e7f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802e83:	0f 84 92 00 00 00    	je     802f1b <__udivmoddi4+0xbb>
+  802e89:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802e90:	00 
+  802e91:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802e96:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802e9d:	00 
+  802e9e:	89 1c 24             	mov    %ebx,(%esp)
+  802ea1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802ea5:	8d 76 00             	lea    0x0(%esi),%esi
+  802ea8:	89 e9                	mov    %ebp,%ecx
+  802eaa:	89 c3                	mov    %eax,%ebx
+  802eac:	89 d6                	mov    %edx,%esi
+  802eae:	31 ff                	xor    %edi,%edi
+  802eb0:	d3 ee                	shr    %cl,%esi
+  802eb2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802eb5:	f6 c1 20             	test   $0x20,%cl
+  802eb8:	0f 45 de             	cmovne %esi,%ebx
+  802ebb:	0f 45 f7             	cmovne %edi,%esi
+  802ebe:	8b 3c 24             	mov    (%esp),%edi
+  802ec1:	39 fb                	cmp    %edi,%ebx
+  802ec3:	89 f7                	mov    %esi,%edi
+  802ec5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ec9:	8b 1c 24             	mov    (%esp),%ebx
+  802ecc:	19 f7                	sbb    %esi,%edi
+  802ece:	72 39                	jb     802f09 <__udivmoddi4+0xa9>
+  802ed0:	89 e9                	mov    %ebp,%ecx
+  802ed2:	89 f7                	mov    %esi,%edi
+  802ed4:	89 de                	mov    %ebx,%esi
+  802ed6:	0f a5 df             	shld   %cl,%ebx,%edi
+  802ed9:	d3 e6                	shl    %cl,%esi
+  802edb:	31 db                	xor    %ebx,%ebx
+  802edd:	f6 c1 20             	test   $0x20,%cl
+  802ee0:	0f 45 fe             	cmovne %esi,%edi
+  802ee3:	0f 45 f3             	cmovne %ebx,%esi
+  802ee6:	29 f0                	sub    %esi,%eax
+  802ee8:	be 01 00 00 00       	mov    $0x1,%esi
+  802eed:	19 fa                	sbb    %edi,%edx
+  802eef:	31 ff                	xor    %edi,%edi
+  802ef1:	31 db                	xor    %ebx,%ebx
+  802ef3:	0f a5 f7             	shld   %cl,%esi,%edi
+  802ef6:	d3 e6                	shl    %cl,%esi
+  802ef8:	f6 c1 20             	test   $0x20,%cl
+  802efb:	0f 45 fe             	cmovne %esi,%edi
+  802efe:	0f 45 f3             	cmovne %ebx,%esi
+  802f01:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802f05:	09 74 24 08          	or     %esi,0x8(%esp)
+  802f09:	83 ed 01             	sub    $0x1,%ebp
+  802f0c:	73 9a                	jae    802ea8 <__udivmoddi4+0x48>
+  802f0e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802f12:	85 ff                	test   %edi,%edi
+  802f14:	74 05                	je     802f1b <__udivmoddi4+0xbb>
+  802f16:	89 07                	mov    %eax,(%edi)
+  802f18:	89 57 04             	mov    %edx,0x4(%edi)
+  802f1b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f1f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f23:	83 c4 14             	add    $0x14,%esp
+  802f26:	5b                   	pop    %ebx
+  802f27:	5e                   	pop    %esi
+  802f28:	5f                   	pop    %edi
+  802f29:	5d                   	pop    %ebp
+  802f2a:	c3                   	ret
+  802f2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802f2f:	90                   	nop
+
+00802f30 <__udivdi3>:
+  802f30:	55                   	push   %ebp
+  802f31:	57                   	push   %edi
+  802f32:	56                   	push   %esi
+  802f33:	53                   	push   %ebx
+  802f34:	83 ec 14             	sub    $0x14,%esp
+  802f37:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  802f3b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802f3f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f43:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f47:	89 fb                	mov    %edi,%ebx
+  802f49:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802f4d:	09 f3                	or     %esi,%ebx
+  802f4f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802f53:	0f 84 85 00 00 00    	je     802fde <__udivdi3+0xae>
+  802f59:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802f60:	00 
+  802f61:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802f66:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802f6d:	00 
+  802f6e:	89 34 24             	mov    %esi,(%esp)
+  802f71:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802f75:	8d 76 00             	lea    0x0(%esi),%esi
+  802f78:	89 e9                	mov    %ebp,%ecx
+  802f7a:	89 c3                	mov    %eax,%ebx
+  802f7c:	89 d6                	mov    %edx,%esi
+  802f7e:	31 ff                	xor    %edi,%edi
+  802f80:	d3 ee                	shr    %cl,%esi
+  802f82:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802f85:	f6 c1 20             	test   $0x20,%cl
+  802f88:	0f 45 de             	cmovne %esi,%ebx
+  802f8b:	0f 45 f7             	cmovne %edi,%esi
+  802f8e:	8b 3c 24             	mov    (%esp),%edi
+  802f91:	39 fb                	cmp    %edi,%ebx
+  802f93:	89 f7                	mov    %esi,%edi
+  802f95:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802f99:	8b 1c 24             	mov    (%esp),%ebx
+  802f9c:	19 f7                	sbb    %esi,%edi
+  802f9e:	72 39                	jb     802fd9 <__udivdi3+0xa9>
+  802fa0:	89 e9                	mov    %ebp,%ecx
+  802fa2:	89 f7                	mov    %esi,%edi
+  802fa4:	89 de                	mov    %ebx,%esi
+  802fa6:	0f a5 df             	shld   %cl,%ebx,%edi
+  802fa9:	d3 e6                	shl    %cl,%esi
+  802fab:	31 db                	xor    %ebx,%ebx
+  802fad:	f6 c1 20             	test   $0x20,%cl
+  802fb0:	0f 45 fe             	cmovne %esi,%edi
+  802fb3:	0f 45 f3             	cmovne %ebx,%esi
+  802fb6:	29 f0                	sub    %esi,%eax
+  802fb8:	be 01 00 00 00       	mov    $0x1,%esi
+  802fbd:	19 fa                	sbb    %edi,%edx
+  802fbf:	31 ff                	xor    %edi,%edi
+  802fc1:	31 db                	xor    %ebx,%ebx
+  802fc3:	0f a5 f7             	shld   %cl,%esi,%edi
+  802fc6:	d3 e6                	shl    %cl,%esi
+  802fc8:	f6 c1 20             	test   $0x20,%cl
+  802fcb:	0f 45 fe             	cmovne %esi,%edi
+  802fce:	0f 45 f3             	cmovne %ebx,%esi
+  802fd1:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802fd5:	09 74 24 08          	or     %esi,0x8(%esp)
+  802fd9:	83 ed 01             	sub    $0x1,%ebp
+  802fdc:	73 9a                	jae    802f78 <__udivdi3+0x48>
+  802fde:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fe2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fe6:	83 c4 14             	add    $0x14,%esp
+  802fe9:	5b                   	pop    %ebx
+  802fea:	5e                   	pop    %esi
+  802feb:	5f                   	pop    %edi
+  802fec:	5d                   	pop    %ebp
+  802fed:	c3                   	ret
+  802fee:	66 90                	xchg   %ax,%ax
+
+00802ff0 <__umoddi3>:
+  802ff0:	57                   	push   %edi
+  802ff1:	56                   	push   %esi
+  802ff2:	53                   	push   %ebx
+  802ff3:	83 ec 08             	sub    $0x8,%esp
+  802ff6:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  802ffa:	8b 74 24 20          	mov    0x20(%esp),%esi
+  802ffe:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803002:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803006:	89 f9                	mov    %edi,%ecx
+  803008:	89 34 24             	mov    %esi,(%esp)
+  80300b:	09 f1                	or     %esi,%ecx
+  80300d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803011:	74 53                	je     803066 <__umoddi3+0x76>
+  803013:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80301f:	90                   	nop
+  803020:	89 c6                	mov    %eax,%esi
+  803022:	89 d7                	mov    %edx,%edi
+  803024:	31 db                	xor    %ebx,%ebx
+  803026:	d3 ef                	shr    %cl,%edi
+  803028:	0f ad d6             	shrd   %cl,%edx,%esi
+  80302b:	f6 c1 20             	test   $0x20,%cl
+  80302e:	0f 45 f7             	cmovne %edi,%esi
+  803031:	0f 45 fb             	cmovne %ebx,%edi
+  803034:	8b 1c 24             	mov    (%esp),%ebx
+  803037:	39 de                	cmp    %ebx,%esi
+  803039:	89 fb                	mov    %edi,%ebx
+  80303b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80303f:	8b 34 24             	mov    (%esp),%esi
+  803042:	19 fb                	sbb    %edi,%ebx
+  803044:	72 14                	jb     80305a <__umoddi3+0x6a>
+  803046:	0f a5 f7             	shld   %cl,%esi,%edi
+  803049:	31 db                	xor    %ebx,%ebx
+  80304b:	d3 e6                	shl    %cl,%esi
+  80304d:	f6 c1 20             	test   $0x20,%cl
+  803050:	0f 45 fe             	cmovne %esi,%edi
+  803053:	0f 45 f3             	cmovne %ebx,%esi
+  803056:	29 f0                	sub    %esi,%eax
+  803058:	19 fa                	sbb    %edi,%edx
+  80305a:	83 e9 01             	sub    $0x1,%ecx
+  80305d:	73 c1                	jae    803020 <__umoddi3+0x30>
+  80305f:	83 c4 08             	add    $0x8,%esp
+  803062:	5b                   	pop    %ebx
+  803063:	5e                   	pop    %esi
+  803064:	5f                   	pop    %edi
+  803065:	c3                   	ret
+  803066:	83 c4 08             	add    $0x8,%esp
+  803069:	31 c0                	xor    %eax,%eax
+  80306b:	31 d2                	xor    %edx,%edx
+  80306d:	5b                   	pop    %ebx
+  80306e:	5e                   	pop    %esi
+  80306f:	5f                   	pop    %edi
+  803070:	c3                   	ret
+  803071:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803078:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80307f:	90                   	nop
+
+00803080 <__divdi3>:
+  803080:	55                   	push   %ebp
+  803081:	57                   	push   %edi
+  803082:	56                   	push   %esi
+  803083:	53                   	push   %ebx
+  803084:	83 ec 1c             	sub    $0x1c,%esp
+  803087:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80308b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80308f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  803093:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  803097:	85 ff                	test   %edi,%edi
+  803099:	0f 88 da 00 00 00    	js     803179 <__divdi3+0xf9>
+  80309f:	85 db                	test   %ebx,%ebx
+  8030a1:	78 16                	js     8030b9 <__divdi3+0x39>
+  8030a3:	89 dd                	mov    %ebx,%ebp
+  8030a5:	89 c8                	mov    %ecx,%eax
+  8030a7:	89 da                	mov    %ebx,%edx
+  8030a9:	09 cd                	or     %ecx,%ebp
+  8030ab:	0f 85 fd 00 00 00    	jne    8031ae <__divdi3+0x12e>
+  8030b1:	83 c4 1c             	add    $0x1c,%esp
+  8030b4:	5b                   	pop    %ebx
+  8030b5:	5e                   	pop    %esi
+  8030b6:	5f                   	pop    %edi
+  8030b7:	5d                   	pop    %ebp
+  8030b8:	c3                   	ret
+  8030b9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8030be:	f7 d9                	neg    %ecx
+  8030c0:	89 f0                	mov    %esi,%eax
+  8030c2:	89 fa                	mov    %edi,%edx
+  8030c4:	83 d3 00             	adc    $0x0,%ebx
+  8030c7:	89 0c 24             	mov    %ecx,(%esp)
+  8030ca:	f7 db                	neg    %ebx
+  8030cc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8030d0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8030d7:	00 
+  8030d8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8030dd:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8030e4:	00 
+  8030e5:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8030e9:	89 cd                	mov    %ecx,%ebp
+  8030eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8030ef:	90                   	nop
+  8030f0:	89 e9                	mov    %ebp,%ecx
+  8030f2:	89 c3                	mov    %eax,%ebx
+  8030f4:	89 d6                	mov    %edx,%esi
+  8030f6:	31 ff                	xor    %edi,%edi
+  8030f8:	d3 ee                	shr    %cl,%esi
+  8030fa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8030fd:	f6 c1 20             	test   $0x20,%cl
+  803100:	0f 45 de             	cmovne %esi,%ebx
+  803103:	0f 45 f7             	cmovne %edi,%esi
+  803106:	8b 3c 24             	mov    (%esp),%edi
+  803109:	39 fb                	cmp    %edi,%ebx
+  80310b:	89 f7                	mov    %esi,%edi
+  80310d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803111:	8b 1c 24             	mov    (%esp),%ebx
+  803114:	19 f7                	sbb    %esi,%edi
+  803116:	72 39                	jb     803151 <__divdi3+0xd1>
+  803118:	89 e9                	mov    %ebp,%ecx
+  80311a:	89 f7                	mov    %esi,%edi
+  80311c:	89 de                	mov    %ebx,%esi
+  80311e:	0f a5 df             	shld   %cl,%ebx,%edi
+  803121:	d3 e6                	shl    %cl,%esi
+  803123:	31 db                	xor    %ebx,%ebx
+  803125:	f6 c1 20             	test   $0x20,%cl
+  803128:	0f 45 fe             	cmovne %esi,%edi
+  80312b:	0f 45 f3             	cmovne %ebx,%esi
+  80312e:	29 f0                	sub    %esi,%eax
+  803130:	be 01 00 00 00       	mov    $0x1,%esi
+  803135:	19 fa                	sbb    %edi,%edx
+  803137:	31 ff                	xor    %edi,%edi
+  803139:	31 db                	xor    %ebx,%ebx
+  80313b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80313e:	d3 e6                	shl    %cl,%esi
+  803140:	f6 c1 20             	test   $0x20,%cl
+  803143:	0f 45 fe             	cmovne %esi,%edi
+  803146:	0f 45 f3             	cmovne %ebx,%esi
+  803149:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80314d:	09 74 24 08          	or     %esi,0x8(%esp)
+  803151:	83 ed 01             	sub    $0x1,%ebp
+  803154:	73 9a                	jae    8030f0 <__divdi3+0x70>
+  803156:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80315a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80315e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803162:	85 ed                	test   %ebp,%ebp
+  803164:	0f 84 47 ff ff ff    	je     8030b1 <__divdi3+0x31>
+  80316a:	f7 d8                	neg    %eax
+  80316c:	83 d2 00             	adc    $0x0,%edx
+  80316f:	83 c4 1c             	add    $0x1c,%esp
+  803172:	5b                   	pop    %ebx
+  803173:	f7 da                	neg    %edx
+  803175:	5e                   	pop    %esi
+  803176:	5f                   	pop    %edi
+  803177:	5d                   	pop    %ebp
+  803178:	c3                   	ret
+  803179:	f7 de                	neg    %esi
+  80317b:	83 d7 00             	adc    $0x0,%edi
+  80317e:	f7 df                	neg    %edi
+  803180:	85 db                	test   %ebx,%ebx
+  803182:	78 23                	js     8031a7 <__divdi3+0x127>
+  803184:	89 dd                	mov    %ebx,%ebp
+  803186:	89 c8                	mov    %ecx,%eax
+  803188:	89 da                	mov    %ebx,%edx
+  80318a:	09 cd                	or     %ecx,%ebp
+  80318c:	0f 84 1f ff ff ff    	je     8030b1 <__divdi3+0x31>
+  803192:	89 0c 24             	mov    %ecx,(%esp)
+  803195:	89 f0                	mov    %esi,%eax
+  803197:	89 fa                	mov    %edi,%edx
+  803199:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80319e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8031a2:	e9 29 ff ff ff       	jmp    8030d0 <__divdi3+0x50>
+  8031a7:	31 ed                	xor    %ebp,%ebp
+  8031a9:	e9 10 ff ff ff       	jmp    8030be <__divdi3+0x3e>
+  8031ae:	89 0c 24             	mov    %ecx,(%esp)
+  8031b1:	89 f0                	mov    %esi,%eax
+  8031b3:	89 fa                	mov    %edi,%edx
+  8031b5:	31 ed                	xor    %ebp,%ebp
+  8031b7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8031bb:	e9 10 ff ff ff       	jmp    8030d0 <__divdi3+0x50>
+
+008031c0 <__moddi3>:
+  8031c0:	55                   	push   %ebp
+  8031c1:	57                   	push   %edi
+  8031c2:	56                   	push   %esi
+  8031c3:	53                   	push   %ebx
+  8031c4:	83 ec 14             	sub    $0x14,%esp
+  8031c7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8031cb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8031cf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8031d3:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8031d7:	85 d2                	test   %edx,%edx
+  8031d9:	0f 88 9b 00 00 00    	js     80327a <__moddi3+0xba>
+  8031df:	89 f7                	mov    %esi,%edi
+  8031e1:	31 ed                	xor    %ebp,%ebp
+  8031e3:	09 cf                	or     %ecx,%edi
+  8031e5:	0f 84 83 00 00 00    	je     80326e <__moddi3+0xae>
+  8031eb:	89 cb                	mov    %ecx,%ebx
+  8031ed:	89 f7                	mov    %esi,%edi
+  8031ef:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  8031f3:	f7 db                	neg    %ebx
+  8031f5:	83 d7 00             	adc    $0x0,%edi
+  8031f8:	f7 df                	neg    %edi
+  8031fa:	0f 49 f7             	cmovns %edi,%esi
+  8031fd:	0f 49 cb             	cmovns %ebx,%ecx
+  803200:	89 74 24 04          	mov    %esi,0x4(%esp)
+  803204:	89 0c 24             	mov    %ecx,(%esp)
+  803207:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80320c:	89 cd                	mov    %ecx,%ebp
+  80320e:	66 90                	xchg   %ax,%ax
+  803210:	89 e9                	mov    %ebp,%ecx
+  803212:	89 c3                	mov    %eax,%ebx
+  803214:	89 d6                	mov    %edx,%esi
+  803216:	31 ff                	xor    %edi,%edi
+  803218:	d3 ee                	shr    %cl,%esi
+  80321a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80321d:	f6 c1 20             	test   $0x20,%cl
+  803220:	0f 45 de             	cmovne %esi,%ebx
+  803223:	0f 45 f7             	cmovne %edi,%esi
+  803226:	8b 3c 24             	mov    (%esp),%edi
+  803229:	39 fb                	cmp    %edi,%ebx
+  80322b:	89 f7                	mov    %esi,%edi
+  80322d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803231:	8b 1c 24             	mov    (%esp),%ebx
+  803234:	19 f7                	sbb    %esi,%edi
+  803236:	72 1a                	jb     803252 <__moddi3+0x92>
+  803238:	89 e9                	mov    %ebp,%ecx
+  80323a:	89 f7                	mov    %esi,%edi
+  80323c:	89 de                	mov    %ebx,%esi
+  80323e:	0f a5 df             	shld   %cl,%ebx,%edi
+  803241:	d3 e6                	shl    %cl,%esi
+  803243:	31 db                	xor    %ebx,%ebx
+  803245:	f6 c1 20             	test   $0x20,%cl
+  803248:	0f 45 fe             	cmovne %esi,%edi
+  80324b:	0f 45 f3             	cmovne %ebx,%esi
+  80324e:	29 f0                	sub    %esi,%eax
+  803250:	19 fa                	sbb    %edi,%edx
+  803252:	83 ed 01             	sub    $0x1,%ebp
+  803255:	73 b9                	jae    803210 <__moddi3+0x50>
+  803257:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80325b:	85 ed                	test   %ebp,%ebp
+  80325d:	74 07                	je     803266 <__moddi3+0xa6>
+  80325f:	f7 d8                	neg    %eax
+  803261:	83 d2 00             	adc    $0x0,%edx
+  803264:	f7 da                	neg    %edx
+  803266:	83 c4 14             	add    $0x14,%esp
+  803269:	5b                   	pop    %ebx
+  80326a:	5e                   	pop    %esi
+  80326b:	5f                   	pop    %edi
+  80326c:	5d                   	pop    %ebp
+  80326d:	c3                   	ret
+  80326e:	83 c4 14             	add    $0x14,%esp
+  803271:	31 c0                	xor    %eax,%eax
+  803273:	31 d2                	xor    %edx,%edx
+  803275:	5b                   	pop    %ebx
+  803276:	5e                   	pop    %esi
+  803277:	5f                   	pop    %edi
+  803278:	5d                   	pop    %ebp
+  803279:	c3                   	ret
+  80327a:	89 f7                	mov    %esi,%edi
+  80327c:	09 cf                	or     %ecx,%edi
+  80327e:	74 11                	je     803291 <__moddi3+0xd1>
+  803280:	f7 d8                	neg    %eax
+  803282:	bd 01 00 00 00       	mov    $0x1,%ebp
+  803287:	83 d2 00             	adc    $0x0,%edx
+  80328a:	f7 da                	neg    %edx
+  80328c:	e9 5a ff ff ff       	jmp    8031eb <__moddi3+0x2b>
+  803291:	31 c0                	xor    %eax,%eax
+  803293:	31 d2                	xor    %edx,%edx
+  803295:	eb c8                	jmp    80325f <__moddi3+0x9f>
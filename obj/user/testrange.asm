@@ -0,0 +1,5864 @@
+
+obj/user/testrange.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 87 03 00 00       	call   8003b8 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <mapped>:
+#define L	((char *) 0xA0400000)	// 4MB-aligned
+
+static bool
+mapped(char *va)
+{
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  800033:	89 c2                	mov    %eax,%edx
+  800035:	c1 ea 16             	shr    $0x16,%edx
+  800038:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80003f:	f6 c2 01             	test   $0x1,%dl
+  800042:	74 11                	je     800055 <mapped+0x22>
+  800044:	c1 e8 0c             	shr    $0xc,%eax
+  800047:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80004e:	83 e0 01             	and    $0x1,%eax
+  800051:	83 e0 01             	and    $0x1,%eax
+}
+  800054:	c3                   	ret
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  800055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005a:	eb f5                	jmp    800051 <mapped+0x1e>
+
+0080005c <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80005c:	55                   	push   %ebp
+  80005d:	89 e5                	mov    %esp,%ebp
+  80005f:	53                   	push   %ebx
+  800060:	83 ec 04             	sub    $0x4,%esp
+	int i, r;
+
+	if ((r = sys_page_alloc_range(0, A, 8, PERM)) != 8)
+  800063:	6a 07                	push   $0x7
+  800065:	6a 08                	push   $0x8
+  800067:	68 00 00 00 a0       	push   $0xa0000000
+  80006c:	6a 00                	push   $0x0
+  80006e:	e8 e5 0f 00 00       	call   801058 <sys_page_alloc_range>
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	83 f8 08             	cmp    $0x8,%eax
+  800079:	0f 85 1f 02 00 00    	jne    80029e <umain+0x242>
+		panic("sys_page_alloc_range returned %d", r);
+	for (i = 0; i < 8; i++)
+		A[i * PGSIZE] = 'a' + i;
+  80007f:	c6 05 00 00 00 a0 61 	movb   $0x61,0xa0000000
+  800086:	c6 05 00 10 00 a0 62 	movb   $0x62,0xa0001000
+  80008d:	c6 05 00 20 00 a0 63 	movb   $0x63,0xa0002000
+  800094:	c6 05 00 30 00 a0 64 	movb   $0x64,0xa0003000
+  80009b:	c6 05 00 40 00 a0 65 	movb   $0x65,0xa0004000
+  8000a2:	c6 05 00 50 00 a0 66 	movb   $0x66,0xa0005000
+  8000a9:	c6 05 00 60 00 a0 67 	movb   $0x67,0xa0006000
+  8000b0:	c6 05 00 70 00 a0 68 	movb   $0x68,0xa0007000
+	if ((r = sys_page_map_range(0, A, 0, B, 8, PERM)) != 8)
+  8000b7:	83 ec 08             	sub    $0x8,%esp
+  8000ba:	6a 07                	push   $0x7
+  8000bc:	6a 08                	push   $0x8
+  8000be:	68 00 00 10 a0       	push   $0xa0100000
+  8000c3:	6a 00                	push   $0x0
+  8000c5:	68 00 00 00 a0       	push   $0xa0000000
+  8000ca:	6a 00                	push   $0x0
+  8000cc:	e8 aa 0f 00 00       	call   80107b <sys_page_map_range>
+  8000d1:	83 c4 20             	add    $0x20,%esp
+  8000d4:	83 f8 08             	cmp    $0x8,%eax
+  8000d7:	0f 85 d3 01 00 00    	jne    8002b0 <umain+0x254>
+  8000dd:	ba 00 00 10 a0       	mov    $0xa0100000,%edx
+		panic("sys_page_map_range returned %d", r);
+	for (i = 0; i < 8; i++)
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (B[i * PGSIZE] != 'a' + i)
+  8000e7:	0f be 1a             	movsbl (%edx),%ebx
+  8000ea:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  8000f0:	8d 48 61             	lea    0x61(%eax),%ecx
+  8000f3:	39 cb                	cmp    %ecx,%ebx
+  8000f5:	0f 85 c7 01 00 00    	jne    8002c2 <umain+0x266>
+	for (i = 0; i < 8; i++)
+  8000fb:	83 c0 01             	add    $0x1,%eax
+  8000fe:	83 f8 08             	cmp    $0x8,%eax
+  800101:	75 e4                	jne    8000e7 <umain+0x8b>
+			panic("B page %d doesn't map A page %d", i, i);
+
+	// A partial success returns the number of pages done; a failure
+	// on the first page returns the error.
+	if ((r = sys_page_unmap(0, A + 3 * PGSIZE)) < 0)
+  800103:	83 ec 08             	sub    $0x8,%esp
+  800106:	68 00 30 00 a0       	push   $0xa0003000
+  80010b:	6a 00                	push   $0x0
+  80010d:	e8 04 0f 00 00       	call   801016 <sys_page_unmap>
+  800112:	83 c4 10             	add    $0x10,%esp
+  800115:	85 c0                	test   %eax,%eax
+  800117:	0f 88 bb 01 00 00    	js     8002d8 <umain+0x27c>
+		panic("sys_page_unmap: %e", r);
+	if ((r = sys_page_map_range(0, A, 0, C, 8, PERM)) != 3)
+  80011d:	83 ec 08             	sub    $0x8,%esp
+  800120:	6a 07                	push   $0x7
+  800122:	6a 08                	push   $0x8
+  800124:	68 00 00 20 a0       	push   $0xa0200000
+  800129:	6a 00                	push   $0x0
+  80012b:	68 00 00 00 a0       	push   $0xa0000000
+  800130:	6a 00                	push   $0x0
+  800132:	e8 44 0f 00 00       	call   80107b <sys_page_map_range>
+  800137:	83 c4 20             	add    $0x20,%esp
+  80013a:	83 f8 03             	cmp    $0x3,%eax
+  80013d:	0f 85 a7 01 00 00    	jne    8002ea <umain+0x28e>
+		panic("sys_page_map_range past a hole returned %d", r);
+	if (!mapped(C + 2 * PGSIZE) || mapped(C + 3 * PGSIZE))
+  800143:	b8 00 20 20 a0       	mov    $0xa0202000,%eax
+  800148:	e8 e6 fe ff ff       	call   800033 <mapped>
+  80014d:	84 c0                	test   %al,%al
+  80014f:	0f 84 a7 01 00 00    	je     8002fc <umain+0x2a0>
+  800155:	b8 00 30 20 a0       	mov    $0xa0203000,%eax
+  80015a:	e8 d4 fe ff ff       	call   800033 <mapped>
+  80015f:	84 c0                	test   %al,%al
+  800161:	0f 85 95 01 00 00    	jne    8002fc <umain+0x2a0>
+		panic("sys_page_map_range mapped the wrong pages");
+	if ((r = sys_page_map_range(0, A + 3 * PGSIZE, 0, C, 1, PERM)) != -E_INVAL)
+  800167:	83 ec 08             	sub    $0x8,%esp
+  80016a:	6a 07                	push   $0x7
+  80016c:	6a 01                	push   $0x1
+  80016e:	68 00 00 20 a0       	push   $0xa0200000
+  800173:	6a 00                	push   $0x0
+  800175:	68 00 30 00 a0       	push   $0xa0003000
+  80017a:	6a 00                	push   $0x0
+  80017c:	e8 fa 0e 00 00       	call   80107b <sys_page_map_range>
+  800181:	83 c4 20             	add    $0x20,%esp
+  800184:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800187:	0f 85 83 01 00 00    	jne    800310 <umain+0x2b4>
+		panic("sys_page_map_range from a hole returned %d", r);
+	cprintf("sys_page_map_range stops at the first unmapped page\n");
+  80018d:	83 ec 0c             	sub    $0xc,%esp
+  800190:	68 e8 2a 80 00       	push   $0x802ae8
+  800195:	e8 59 03 00 00       	call   8004f3 <cprintf>
+
+	if ((r = sys_page_alloc_large(0, L, PERM)) < 0)
+  80019a:	83 c4 0c             	add    $0xc,%esp
+  80019d:	6a 07                	push   $0x7
+  80019f:	68 00 00 40 a0       	push   $0xa0400000
+  8001a4:	6a 00                	push   $0x0
+  8001a6:	e8 e6 0d 00 00       	call   800f91 <sys_page_alloc_large>
+  8001ab:	83 c4 10             	add    $0x10,%esp
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	0f 88 6c 01 00 00    	js     800322 <umain+0x2c6>
+		panic("sys_page_alloc_large: %e", r);
+	if (!(uvpd[PDX(L)] & PTE_PS))
+  8001b6:	a1 04 da 7b ef       	mov    0xef7bda04,%eax
+  8001bb:	a8 80                	test   $0x80,%al
+  8001bd:	0f 84 71 01 00 00    	je     800334 <umain+0x2d8>
+		panic("sys_page_alloc_large didn't map a large page");
+	L[0] = 1;
+  8001c3:	c6 05 00 00 40 a0 01 	movb   $0x1,0xa0400000
+	L[PTSIZE - 1] = 2;
+  8001ca:	c6 05 ff ff 7f a0 02 	movb   $0x2,0xa07fffff
+	if ((r = sys_page_alloc_range(0, L - 2 * PGSIZE, 4, PERM)) != 2)
+  8001d1:	6a 07                	push   $0x7
+  8001d3:	6a 04                	push   $0x4
+  8001d5:	68 00 e0 3f a0       	push   $0xa03fe000
+  8001da:	6a 00                	push   $0x0
+  8001dc:	e8 77 0e 00 00       	call   801058 <sys_page_alloc_range>
+  8001e1:	83 c4 10             	add    $0x10,%esp
+  8001e4:	83 f8 02             	cmp    $0x2,%eax
+  8001e7:	0f 85 5b 01 00 00    	jne    800348 <umain+0x2ec>
+		panic("sys_page_alloc_range into a large page returned %d", r);
+	if (L[0] != 1 || L[PTSIZE - 1] != 2)
+  8001ed:	80 3d 00 00 40 a0 01 	cmpb   $0x1,0xa0400000
+  8001f4:	0f 85 60 01 00 00    	jne    80035a <umain+0x2fe>
+  8001fa:	80 3d ff ff 7f a0 02 	cmpb   $0x2,0xa07fffff
+  800201:	0f 85 53 01 00 00    	jne    80035a <umain+0x2fe>
+		panic("sys_page_alloc_range changed the large page");
+	cprintf("sys_page_alloc_range stops at the first page it can't map\n");
+  800207:	83 ec 0c             	sub    $0xc,%esp
+  80020a:	68 b0 2b 80 00       	push   $0x802bb0
+  80020f:	e8 df 02 00 00       	call   8004f3 <cprintf>
+
+	if ((r = sys_page_unmap(0, L + 5 * PGSIZE)) < 0)
+  800214:	83 c4 08             	add    $0x8,%esp
+  800217:	68 00 50 40 a0       	push   $0xa0405000
+  80021c:	6a 00                	push   $0x0
+  80021e:	e8 f3 0d 00 00       	call   801016 <sys_page_unmap>
+  800223:	83 c4 10             	add    $0x10,%esp
+  800226:	85 c0                	test   %eax,%eax
+  800228:	0f 88 40 01 00 00    	js     80036e <umain+0x312>
+		panic("sys_page_unmap: %e", r);
+	if (uvpd[PDX(L)] & PTE_P)
+  80022e:	a1 04 da 7b ef       	mov    0xef7bda04,%eax
+  800233:	a8 01                	test   $0x1,%al
+  800235:	0f 85 45 01 00 00    	jne    800380 <umain+0x324>
+		panic("unmapping one page left the rest of the large page");
+	cprintf("a large page is unmapped as a unit\n");
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	68 20 2c 80 00       	push   $0x802c20
+  800243:	e8 ab 02 00 00       	call   8004f3 <cprintf>
+
+	if ((r = sys_page_unmap_range(0, A, 8)) != 8)
+  800248:	83 c4 0c             	add    $0xc,%esp
+  80024b:	6a 08                	push   $0x8
+  80024d:	68 00 00 00 a0       	push   $0xa0000000
+  800252:	6a 00                	push   $0x0
+  800254:	e8 a7 0e 00 00       	call   801100 <sys_page_unmap_range>
+  800259:	83 c4 10             	add    $0x10,%esp
+  80025c:	83 f8 08             	cmp    $0x8,%eax
+  80025f:	0f 85 2f 01 00 00    	jne    800394 <umain+0x338>
+		panic("sys_page_unmap_range returned %d", r);
+	for (i = 0; i < 8; i++)
+  800265:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (mapped(A + i * PGSIZE))
+  80026a:	89 d8                	mov    %ebx,%eax
+  80026c:	c1 e0 0c             	shl    $0xc,%eax
+  80026f:	2d 00 00 00 60       	sub    $0x60000000,%eax
+  800274:	e8 ba fd ff ff       	call   800033 <mapped>
+  800279:	84 c0                	test   %al,%al
+  80027b:	0f 85 25 01 00 00    	jne    8003a6 <umain+0x34a>
+	for (i = 0; i < 8; i++)
+  800281:	83 c3 01             	add    $0x1,%ebx
+  800284:	83 fb 08             	cmp    $0x8,%ebx
+  800287:	75 e1                	jne    80026a <umain+0x20e>
+			panic("sys_page_unmap_range left page %d", i);
+	cprintf("sys_page_unmap_range unmaps every page\n");
+  800289:	83 ec 0c             	sub    $0xc,%esp
+  80028c:	68 8c 2c 80 00       	push   $0x802c8c
+  800291:	e8 5d 02 00 00       	call   8004f3 <cprintf>
+}
+  800296:	83 c4 10             	add    $0x10,%esp
+  800299:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80029c:	c9                   	leave
+  80029d:	c3                   	ret
+		panic("sys_page_alloc_range returned %d", r);
+  80029e:	50                   	push   %eax
+  80029f:	68 00 2a 80 00       	push   $0x802a00
+  8002a4:	6a 18                	push   $0x18
+  8002a6:	68 b4 2c 80 00       	push   $0x802cb4
+  8002ab:	e8 68 01 00 00       	call   800418 <_panic>
+		panic("sys_page_map_range returned %d", r);
+  8002b0:	50                   	push   %eax
+  8002b1:	68 24 2a 80 00       	push   $0x802a24
+  8002b6:	6a 1c                	push   $0x1c
+  8002b8:	68 b4 2c 80 00       	push   $0x802cb4
+  8002bd:	e8 56 01 00 00       	call   800418 <_panic>
+			panic("B page %d doesn't map A page %d", i, i);
+  8002c2:	83 ec 0c             	sub    $0xc,%esp
+  8002c5:	50                   	push   %eax
+  8002c6:	50                   	push   %eax
+  8002c7:	68 44 2a 80 00       	push   $0x802a44
+  8002cc:	6a 1f                	push   $0x1f
+  8002ce:	68 b4 2c 80 00       	push   $0x802cb4
+  8002d3:	e8 40 01 00 00       	call   800418 <_panic>
+		panic("sys_page_unmap: %e", r);
+  8002d8:	50                   	push   %eax
+  8002d9:	68 c5 2c 80 00       	push   $0x802cc5
+  8002de:	6a 24                	push   $0x24
+  8002e0:	68 b4 2c 80 00       	push   $0x802cb4
+  8002e5:	e8 2e 01 00 00       	call   800418 <_panic>
+		panic("sys_page_map_range past a hole returned %d", r);
+  8002ea:	50                   	push   %eax
+  8002eb:	68 64 2a 80 00       	push   $0x802a64
+  8002f0:	6a 26                	push   $0x26
+  8002f2:	68 b4 2c 80 00       	push   $0x802cb4
+  8002f7:	e8 1c 01 00 00       	call   800418 <_panic>
+		panic("sys_page_map_range mapped the wrong pages");
+  8002fc:	83 ec 04             	sub    $0x4,%esp
+  8002ff:	68 90 2a 80 00       	push   $0x802a90
+  800304:	6a 28                	push   $0x28
+  800306:	68 b4 2c 80 00       	push   $0x802cb4
+  80030b:	e8 08 01 00 00       	call   800418 <_panic>
+		panic("sys_page_map_range from a hole returned %d", r);
+  800310:	50                   	push   %eax
+  800311:	68 bc 2a 80 00       	push   $0x802abc
+  800316:	6a 2a                	push   $0x2a
+  800318:	68 b4 2c 80 00       	push   $0x802cb4
+  80031d:	e8 f6 00 00 00       	call   800418 <_panic>
+		panic("sys_page_alloc_large: %e", r);
+  800322:	50                   	push   %eax
+  800323:	68 d8 2c 80 00       	push   $0x802cd8
+  800328:	6a 2e                	push   $0x2e
+  80032a:	68 b4 2c 80 00       	push   $0x802cb4
+  80032f:	e8 e4 00 00 00       	call   800418 <_panic>
+		panic("sys_page_alloc_large didn't map a large page");
+  800334:	83 ec 04             	sub    $0x4,%esp
+  800337:	68 20 2b 80 00       	push   $0x802b20
+  80033c:	6a 30                	push   $0x30
+  80033e:	68 b4 2c 80 00       	push   $0x802cb4
+  800343:	e8 d0 00 00 00       	call   800418 <_panic>
+		panic("sys_page_alloc_range into a large page returned %d", r);
+  800348:	50                   	push   %eax
+  800349:	68 50 2b 80 00       	push   $0x802b50
+  80034e:	6a 34                	push   $0x34
+  800350:	68 b4 2c 80 00       	push   $0x802cb4
+  800355:	e8 be 00 00 00       	call   800418 <_panic>
+		panic("sys_page_alloc_range changed the large page");
+  80035a:	83 ec 04             	sub    $0x4,%esp
+  80035d:	68 84 2b 80 00       	push   $0x802b84
+  800362:	6a 36                	push   $0x36
+  800364:	68 b4 2c 80 00       	push   $0x802cb4
+  800369:	e8 aa 00 00 00       	call   800418 <_panic>
+		panic("sys_page_unmap: %e", r);
+  80036e:	50                   	push   %eax
+  80036f:	68 c5 2c 80 00       	push   $0x802cc5
+  800374:	6a 3a                	push   $0x3a
+  800376:	68 b4 2c 80 00       	push   $0x802cb4
+  80037b:	e8 98 00 00 00       	call   800418 <_panic>
+		panic("unmapping one page left the rest of the large page");
+  800380:	83 ec 04             	sub    $0x4,%esp
+  800383:	68 ec 2b 80 00       	push   $0x802bec
+  800388:	6a 3c                	push   $0x3c
+  80038a:	68 b4 2c 80 00       	push   $0x802cb4
+  80038f:	e8 84 00 00 00       	call   800418 <_panic>
+		panic("sys_page_unmap_range returned %d", r);
+  800394:	50                   	push   %eax
+  800395:	68 44 2c 80 00       	push   $0x802c44
+  80039a:	6a 40                	push   $0x40
+  80039c:	68 b4 2c 80 00       	push   $0x802cb4
+  8003a1:	e8 72 00 00 00       	call   800418 <_panic>
+			panic("sys_page_unmap_range left page %d", i);
+  8003a6:	53                   	push   %ebx
+  8003a7:	68 68 2c 80 00       	push   $0x802c68
+  8003ac:	6a 43                	push   $0x43
+  8003ae:	68 b4 2c 80 00       	push   $0x802cb4
+  8003b3:	e8 60 00 00 00       	call   800418 <_panic>
+
+008003b8 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8003b8:	55                   	push   %ebp
+  8003b9:	89 e5                	mov    %esp,%ebp
+  8003bb:	56                   	push   %esi
+  8003bc:	53                   	push   %ebx
+  8003bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003c0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8003c3:	e8 e7 0a 00 00       	call   800eaf <sys_getenvid>
+  8003c8:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8003cd:	c1 e0 09             	shl    $0x9,%eax
+  8003d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003d5:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003da:	85 db                	test   %ebx,%ebx
+  8003dc:	7e 07                	jle    8003e5 <libmain+0x2d>
+		binaryname = argv[0];
+  8003de:	8b 06                	mov    (%esi),%eax
+  8003e0:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8003e5:	83 ec 08             	sub    $0x8,%esp
+  8003e8:	56                   	push   %esi
+  8003e9:	53                   	push   %ebx
+  8003ea:	e8 6d fc ff ff       	call   80005c <umain>
+
+	// exit gracefully
+	exit();
+  8003ef:	e8 0a 00 00 00       	call   8003fe <exit>
+}
+  8003f4:	83 c4 10             	add    $0x10,%esp
+  8003f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003fa:	5b                   	pop    %ebx
+  8003fb:	5e                   	pop    %esi
+  8003fc:	5d                   	pop    %ebp
+  8003fd:	c3                   	ret
+
+008003fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003fe:	55                   	push   %ebp
+  8003ff:	89 e5                	mov    %esp,%ebp
+  800401:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800404:	e8 3e 11 00 00       	call   801547 <close_all>
+	sys_env_destroy(0);
+  800409:	83 ec 0c             	sub    $0xc,%esp
+  80040c:	6a 00                	push   $0x0
+  80040e:	e8 5b 0a 00 00       	call   800e6e <sys_env_destroy>
+}
+  800413:	83 c4 10             	add    $0x10,%esp
+  800416:	c9                   	leave
+  800417:	c3                   	ret
+
+00800418 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800418:	55                   	push   %ebp
+  800419:	89 e5                	mov    %esp,%ebp
+  80041b:	56                   	push   %esi
+  80041c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80041d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800420:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800426:	e8 84 0a 00 00       	call   800eaf <sys_getenvid>
+  80042b:	83 ec 0c             	sub    $0xc,%esp
+  80042e:	ff 75 0c             	push   0xc(%ebp)
+  800431:	ff 75 08             	push   0x8(%ebp)
+  800434:	56                   	push   %esi
+  800435:	50                   	push   %eax
+  800436:	68 fc 2c 80 00       	push   $0x802cfc
+  80043b:	e8 b3 00 00 00       	call   8004f3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800440:	83 c4 18             	add    $0x18,%esp
+  800443:	53                   	push   %ebx
+  800444:	ff 75 10             	push   0x10(%ebp)
+  800447:	e8 56 00 00 00       	call   8004a2 <vcprintf>
+	cprintf("\n");
+  80044c:	c7 04 24 60 31 80 00 	movl   $0x803160,(%esp)
+  800453:	e8 9b 00 00 00       	call   8004f3 <cprintf>
+  800458:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80045b:	cc                   	int3
+	while (1)
+  80045c:	eb fd                	jmp    80045b <_panic+0x43>
+
+0080045e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80045e:	55                   	push   %ebp
+  80045f:	89 e5                	mov    %esp,%ebp
+  800461:	53                   	push   %ebx
+  800462:	83 ec 04             	sub    $0x4,%esp
+  800465:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800468:	8b 13                	mov    (%ebx),%edx
+  80046a:	8d 42 01             	lea    0x1(%edx),%eax
+  80046d:	89 03                	mov    %eax,(%ebx)
+  80046f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800472:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800476:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80047b:	74 09                	je     800486 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80047d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800481:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800484:	c9                   	leave
+  800485:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800486:	83 ec 08             	sub    $0x8,%esp
+  800489:	68 ff 00 00 00       	push   $0xff
+  80048e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800491:	50                   	push   %eax
+  800492:	e8 7a 09 00 00       	call   800e11 <sys_cputs>
+		b->idx = 0;
+  800497:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80049d:	83 c4 10             	add    $0x10,%esp
+  8004a0:	eb db                	jmp    80047d <putch+0x1f>
+
+008004a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004a2:	55                   	push   %ebp
+  8004a3:	89 e5                	mov    %esp,%ebp
+  8004a5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004b2:	00 00 00 
+	b.cnt = 0;
+  8004b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004bc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004bf:	ff 75 0c             	push   0xc(%ebp)
+  8004c2:	ff 75 08             	push   0x8(%ebp)
+  8004c5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004cb:	50                   	push   %eax
+  8004cc:	68 5e 04 80 00       	push   $0x80045e
+  8004d1:	e8 14 01 00 00       	call   8005ea <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004d6:	83 c4 08             	add    $0x8,%esp
+  8004d9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004df:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004e5:	50                   	push   %eax
+  8004e6:	e8 26 09 00 00       	call   800e11 <sys_cputs>
+
+	return b.cnt;
+}
+  8004eb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004f1:	c9                   	leave
+  8004f2:	c3                   	ret
+
+008004f3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004f3:	55                   	push   %ebp
+  8004f4:	89 e5                	mov    %esp,%ebp
+  8004f6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004f9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004fc:	50                   	push   %eax
+  8004fd:	ff 75 08             	push   0x8(%ebp)
+  800500:	e8 9d ff ff ff       	call   8004a2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800505:	c9                   	leave
+  800506:	c3                   	ret
+
+00800507 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800507:	55                   	push   %ebp
+  800508:	89 e5                	mov    %esp,%ebp
+  80050a:	57                   	push   %edi
+  80050b:	56                   	push   %esi
+  80050c:	53                   	push   %ebx
+  80050d:	83 ec 1c             	sub    $0x1c,%esp
+  800510:	89 c7                	mov    %eax,%edi
+  800512:	89 d6                	mov    %edx,%esi
+  800514:	8b 45 08             	mov    0x8(%ebp),%eax
+  800517:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80051a:	89 d1                	mov    %edx,%ecx
+  80051c:	89 c2                	mov    %eax,%edx
+  80051e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800521:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800524:	8b 45 10             	mov    0x10(%ebp),%eax
+  800527:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80052a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80052d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800534:	39 c2                	cmp    %eax,%edx
+  800536:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800539:	72 3e                	jb     800579 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80053b:	83 ec 0c             	sub    $0xc,%esp
+  80053e:	ff 75 18             	push   0x18(%ebp)
+  800541:	83 eb 01             	sub    $0x1,%ebx
+  800544:	53                   	push   %ebx
+  800545:	50                   	push   %eax
+  800546:	83 ec 08             	sub    $0x8,%esp
+  800549:	ff 75 e4             	push   -0x1c(%ebp)
+  80054c:	ff 75 e0             	push   -0x20(%ebp)
+  80054f:	ff 75 dc             	push   -0x24(%ebp)
+  800552:	ff 75 d8             	push   -0x28(%ebp)
+  800555:	e8 26 21 00 00       	call   802680 <__udivdi3>
+  80055a:	83 c4 18             	add    $0x18,%esp
+  80055d:	52                   	push   %edx
+  80055e:	50                   	push   %eax
+  80055f:	89 f2                	mov    %esi,%edx
+  800561:	89 f8                	mov    %edi,%eax
+  800563:	e8 9f ff ff ff       	call   800507 <printnum>
+  800568:	83 c4 20             	add    $0x20,%esp
+  80056b:	eb 13                	jmp    800580 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80056d:	83 ec 08             	sub    $0x8,%esp
+  800570:	56                   	push   %esi
+  800571:	ff 75 18             	push   0x18(%ebp)
+  800574:	ff d7                	call   *%edi
+  800576:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800579:	83 eb 01             	sub    $0x1,%ebx
+  80057c:	85 db                	test   %ebx,%ebx
+  80057e:	7f ed                	jg     80056d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800580:	83 ec 08             	sub    $0x8,%esp
+  800583:	56                   	push   %esi
+  800584:	83 ec 04             	sub    $0x4,%esp
+  800587:	ff 75 e4             	push   -0x1c(%ebp)
+  80058a:	ff 75 e0             	push   -0x20(%ebp)
+  80058d:	ff 75 dc             	push   -0x24(%ebp)
+  800590:	ff 75 d8             	push   -0x28(%ebp)
+  800593:	e8 a8 21 00 00       	call   802740 <__umoddi3>
+  800598:	83 c4 14             	add    $0x14,%esp
+  80059b:	0f be 80 1f 2d 80 00 	movsbl 0x802d1f(%eax),%eax
+  8005a2:	50                   	push   %eax
+  8005a3:	ff d7                	call   *%edi
+}
+  8005a5:	83 c4 10             	add    $0x10,%esp
+  8005a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ab:	5b                   	pop    %ebx
+  8005ac:	5e                   	pop    %esi
+  8005ad:	5f                   	pop    %edi
+  8005ae:	5d                   	pop    %ebp
+  8005af:	c3                   	ret
+
+008005b0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005b0:	55                   	push   %ebp
+  8005b1:	89 e5                	mov    %esp,%ebp
+  8005b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005b6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005ba:	8b 10                	mov    (%eax),%edx
+  8005bc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005bf:	73 0a                	jae    8005cb <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005c1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005c4:	89 08                	mov    %ecx,(%eax)
+  8005c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005c9:	88 02                	mov    %al,(%edx)
+}
+  8005cb:	5d                   	pop    %ebp
+  8005cc:	c3                   	ret
+
+008005cd <printfmt>:
+{
+  8005cd:	55                   	push   %ebp
+  8005ce:	89 e5                	mov    %esp,%ebp
+  8005d0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005d3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005d6:	50                   	push   %eax
+  8005d7:	ff 75 10             	push   0x10(%ebp)
+  8005da:	ff 75 0c             	push   0xc(%ebp)
+  8005dd:	ff 75 08             	push   0x8(%ebp)
+  8005e0:	e8 05 00 00 00       	call   8005ea <vprintfmt>
+}
+  8005e5:	83 c4 10             	add    $0x10,%esp
+  8005e8:	c9                   	leave
+  8005e9:	c3                   	ret
+
+008005ea <vprintfmt>:
+{
+  8005ea:	55                   	push   %ebp
+  8005eb:	89 e5                	mov    %esp,%ebp
+  8005ed:	57                   	push   %edi
+  8005ee:	56                   	push   %esi
+  8005ef:	53                   	push   %ebx
+  8005f0:	83 ec 2c             	sub    $0x2c,%esp
+  8005f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005f9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005fc:	eb 0a                	jmp    800608 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8005fe:	83 ec 08             	sub    $0x8,%esp
+  800601:	53                   	push   %ebx
+  800602:	50                   	push   %eax
+  800603:	ff d6                	call   *%esi
+  800605:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800608:	83 c7 01             	add    $0x1,%edi
+  80060b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80060f:	83 f8 25             	cmp    $0x25,%eax
+  800612:	74 0c                	je     800620 <vprintfmt+0x36>
+			if (ch == '\0')
+  800614:	85 c0                	test   %eax,%eax
+  800616:	75 e6                	jne    8005fe <vprintfmt+0x14>
+}
+  800618:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80061b:	5b                   	pop    %ebx
+  80061c:	5e                   	pop    %esi
+  80061d:	5f                   	pop    %edi
+  80061e:	5d                   	pop    %ebp
+  80061f:	c3                   	ret
+		padc = ' ';
+  800620:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800624:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80062b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800632:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800639:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80063e:	8d 47 01             	lea    0x1(%edi),%eax
+  800641:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800644:	0f b6 17             	movzbl (%edi),%edx
+  800647:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80064a:	3c 55                	cmp    $0x55,%al
+  80064c:	0f 87 cf 03 00 00    	ja     800a21 <vprintfmt+0x437>
+  800652:	0f b6 c0             	movzbl %al,%eax
+  800655:	ff 24 85 60 2e 80 00 	jmp    *0x802e60(,%eax,4)
+  80065c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80065f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800663:	eb d9                	jmp    80063e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800665:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800668:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80066c:	eb d0                	jmp    80063e <vprintfmt+0x54>
+  80066e:	0f b6 d2             	movzbl %dl,%edx
+  800671:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800674:	b8 00 00 00 00       	mov    $0x0,%eax
+  800679:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80067c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80067f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800683:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800686:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800689:	83 f9 09             	cmp    $0x9,%ecx
+  80068c:	77 55                	ja     8006e3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80068e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800691:	eb e9                	jmp    80067c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8b 00                	mov    (%eax),%eax
+  800698:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80069b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069e:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8006a7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006ab:	79 91                	jns    80063e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8006ad:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006b0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006b3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006ba:	eb 82                	jmp    80063e <vprintfmt+0x54>
+			if (width < 0)
+  8006bc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006bf:	85 d2                	test   %edx,%edx
+  8006c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c6:	0f 49 c2             	cmovns %edx,%eax
+  8006c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006cf:	e9 6a ff ff ff       	jmp    80063e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8006d7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006de:	e9 5b ff ff ff       	jmp    80063e <vprintfmt+0x54>
+  8006e3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006e6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006e9:	eb bc                	jmp    8006a7 <vprintfmt+0xbd>
+			lflag++;
+  8006eb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006f1:	e9 48 ff ff ff       	jmp    80063e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f9:	8d 78 04             	lea    0x4(%eax),%edi
+  8006fc:	83 ec 08             	sub    $0x8,%esp
+  8006ff:	53                   	push   %ebx
+  800700:	ff 30                	push   (%eax)
+  800702:	ff d6                	call   *%esi
+			break;
+  800704:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800707:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80070a:	e9 b1 02 00 00       	jmp    8009c0 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800715:	8b 10                	mov    (%eax),%edx
+  800717:	89 d0                	mov    %edx,%eax
+  800719:	f7 d8                	neg    %eax
+  80071b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80071e:	83 f8 0f             	cmp    $0xf,%eax
+  800721:	7f 23                	jg     800746 <vprintfmt+0x15c>
+  800723:	8b 14 85 c0 2f 80 00 	mov    0x802fc0(,%eax,4),%edx
+  80072a:	85 d2                	test   %edx,%edx
+  80072c:	74 18                	je     800746 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80072e:	52                   	push   %edx
+  80072f:	68 f5 30 80 00       	push   $0x8030f5
+  800734:	53                   	push   %ebx
+  800735:	56                   	push   %esi
+  800736:	e8 92 fe ff ff       	call   8005cd <printfmt>
+  80073b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80073e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800741:	e9 7a 02 00 00       	jmp    8009c0 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800746:	50                   	push   %eax
+  800747:	68 37 2d 80 00       	push   $0x802d37
+  80074c:	53                   	push   %ebx
+  80074d:	56                   	push   %esi
+  80074e:	e8 7a fe ff ff       	call   8005cd <printfmt>
+  800753:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800756:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800759:	e9 62 02 00 00       	jmp    8009c0 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80075e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800761:	83 c0 04             	add    $0x4,%eax
+  800764:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800767:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80076c:	85 c9                	test   %ecx,%ecx
+  80076e:	b8 30 2d 80 00       	mov    $0x802d30,%eax
+  800773:	0f 45 c1             	cmovne %ecx,%eax
+  800776:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800779:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80077d:	7e 06                	jle    800785 <vprintfmt+0x19b>
+  80077f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800783:	75 0b                	jne    800790 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800785:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800788:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80078b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80078e:	eb 5c                	jmp    8007ec <vprintfmt+0x202>
+  800790:	83 ec 08             	sub    $0x8,%esp
+  800793:	ff 75 d0             	push   -0x30(%ebp)
+  800796:	ff 75 cc             	push   -0x34(%ebp)
+  800799:	e8 20 03 00 00       	call   800abe <strnlen>
+  80079e:	89 c2                	mov    %eax,%edx
+  8007a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a3:	29 d0                	sub    %edx,%eax
+  8007a5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8007a8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8007ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007af:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007b2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007b4:	eb 0e                	jmp    8007c4 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8007b6:	83 ec 08             	sub    $0x8,%esp
+  8007b9:	53                   	push   %ebx
+  8007ba:	57                   	push   %edi
+  8007bb:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007be:	83 ee 01             	sub    $0x1,%esi
+  8007c1:	83 c4 10             	add    $0x10,%esp
+  8007c4:	85 f6                	test   %esi,%esi
+  8007c6:	7f ee                	jg     8007b6 <vprintfmt+0x1cc>
+  8007c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ce:	85 c0                	test   %eax,%eax
+  8007d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007d5:	0f 49 d0             	cmovns %eax,%edx
+  8007d8:	29 d0                	sub    %edx,%eax
+  8007da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007dd:	eb a6                	jmp    800785 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8007df:	83 ec 08             	sub    $0x8,%esp
+  8007e2:	53                   	push   %ebx
+  8007e3:	52                   	push   %edx
+  8007e4:	ff 55 08             	call   *0x8(%ebp)
+  8007e7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007ea:	89 f1                	mov    %esi,%ecx
+  8007ec:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007ef:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007f3:	0f be d0             	movsbl %al,%edx
+  8007f6:	85 d2                	test   %edx,%edx
+  8007f8:	74 28                	je     800822 <vprintfmt+0x238>
+  8007fa:	85 ff                	test   %edi,%edi
+  8007fc:	78 05                	js     800803 <vprintfmt+0x219>
+  8007fe:	83 ef 01             	sub    $0x1,%edi
+  800801:	78 30                	js     800833 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800803:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800807:	74 d6                	je     8007df <vprintfmt+0x1f5>
+  800809:	0f be c0             	movsbl %al,%eax
+  80080c:	83 e8 20             	sub    $0x20,%eax
+  80080f:	83 f8 5e             	cmp    $0x5e,%eax
+  800812:	76 cb                	jbe    8007df <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800814:	83 ec 08             	sub    $0x8,%esp
+  800817:	53                   	push   %ebx
+  800818:	6a 3f                	push   $0x3f
+  80081a:	ff 55 08             	call   *0x8(%ebp)
+  80081d:	83 c4 10             	add    $0x10,%esp
+  800820:	eb c8                	jmp    8007ea <vprintfmt+0x200>
+  800822:	8b 75 08             	mov    0x8(%ebp),%esi
+  800825:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800828:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80082b:	01 d0                	add    %edx,%eax
+  80082d:	29 c8                	sub    %ecx,%eax
+  80082f:	89 c7                	mov    %eax,%edi
+  800831:	eb 13                	jmp    800846 <vprintfmt+0x25c>
+  800833:	8b 75 08             	mov    0x8(%ebp),%esi
+  800836:	eb ed                	jmp    800825 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800838:	83 ec 08             	sub    $0x8,%esp
+  80083b:	53                   	push   %ebx
+  80083c:	6a 20                	push   $0x20
+  80083e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800840:	83 ef 01             	sub    $0x1,%edi
+  800843:	83 c4 10             	add    $0x10,%esp
+  800846:	85 ff                	test   %edi,%edi
+  800848:	7f ee                	jg     800838 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80084a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80084d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800850:	e9 6b 01 00 00       	jmp    8009c0 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800855:	83 f9 01             	cmp    $0x1,%ecx
+  800858:	7f 1f                	jg     800879 <vprintfmt+0x28f>
+	else if (lflag)
+  80085a:	85 c9                	test   %ecx,%ecx
+  80085c:	74 67                	je     8008c5 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80085e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800861:	8b 00                	mov    (%eax),%eax
+  800863:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800866:	89 c1                	mov    %eax,%ecx
+  800868:	c1 f9 1f             	sar    $0x1f,%ecx
+  80086b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80086e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800871:	8d 40 04             	lea    0x4(%eax),%eax
+  800874:	89 45 14             	mov    %eax,0x14(%ebp)
+  800877:	eb 17                	jmp    800890 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800879:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087c:	8b 50 04             	mov    0x4(%eax),%edx
+  80087f:	8b 00                	mov    (%eax),%eax
+  800881:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800884:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800887:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088a:	8d 40 08             	lea    0x8(%eax),%eax
+  80088d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800890:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800893:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800896:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80089b:	85 c9                	test   %ecx,%ecx
+  80089d:	0f 89 03 01 00 00    	jns    8009a6 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8008a3:	83 ec 08             	sub    $0x8,%esp
+  8008a6:	53                   	push   %ebx
+  8008a7:	6a 2d                	push   $0x2d
+  8008a9:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8008ab:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008ae:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008b1:	f7 da                	neg    %edx
+  8008b3:	83 d1 00             	adc    $0x0,%ecx
+  8008b6:	f7 d9                	neg    %ecx
+  8008b8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8008bb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8008c0:	e9 e1 00 00 00       	jmp    8009a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8008c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c8:	8b 00                	mov    (%eax),%eax
+  8008ca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008cd:	89 c1                	mov    %eax,%ecx
+  8008cf:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008d2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008de:	eb b0                	jmp    800890 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8008e0:	83 f9 01             	cmp    $0x1,%ecx
+  8008e3:	7f 1e                	jg     800903 <vprintfmt+0x319>
+	else if (lflag)
+  8008e5:	85 c9                	test   %ecx,%ecx
+  8008e7:	74 32                	je     80091b <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8008e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ec:	8b 10                	mov    (%eax),%edx
+  8008ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8008fe:	e9 a3 00 00 00       	jmp    8009a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800903:	8b 45 14             	mov    0x14(%ebp),%eax
+  800906:	8b 10                	mov    (%eax),%edx
+  800908:	8b 48 04             	mov    0x4(%eax),%ecx
+  80090b:	8d 40 08             	lea    0x8(%eax),%eax
+  80090e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800911:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800916:	e9 8b 00 00 00       	jmp    8009a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80091b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091e:	8b 10                	mov    (%eax),%edx
+  800920:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800925:	8d 40 04             	lea    0x4(%eax),%eax
+  800928:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80092b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800930:	eb 74                	jmp    8009a6 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800932:	83 f9 01             	cmp    $0x1,%ecx
+  800935:	7f 1b                	jg     800952 <vprintfmt+0x368>
+	else if (lflag)
+  800937:	85 c9                	test   %ecx,%ecx
+  800939:	74 2c                	je     800967 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80093b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093e:	8b 10                	mov    (%eax),%edx
+  800940:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800945:	8d 40 04             	lea    0x4(%eax),%eax
+  800948:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80094b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800950:	eb 54                	jmp    8009a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800952:	8b 45 14             	mov    0x14(%ebp),%eax
+  800955:	8b 10                	mov    (%eax),%edx
+  800957:	8b 48 04             	mov    0x4(%eax),%ecx
+  80095a:	8d 40 08             	lea    0x8(%eax),%eax
+  80095d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800960:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800965:	eb 3f                	jmp    8009a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800967:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096a:	8b 10                	mov    (%eax),%edx
+  80096c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800971:	8d 40 04             	lea    0x4(%eax),%eax
+  800974:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800977:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80097c:	eb 28                	jmp    8009a6 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80097e:	83 ec 08             	sub    $0x8,%esp
+  800981:	53                   	push   %ebx
+  800982:	6a 30                	push   $0x30
+  800984:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800986:	83 c4 08             	add    $0x8,%esp
+  800989:	53                   	push   %ebx
+  80098a:	6a 78                	push   $0x78
+  80098c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80098e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800991:	8b 10                	mov    (%eax),%edx
+  800993:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800998:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80099b:	8d 40 04             	lea    0x4(%eax),%eax
+  80099e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009a1:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8009a6:	83 ec 0c             	sub    $0xc,%esp
+  8009a9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8009ad:	50                   	push   %eax
+  8009ae:	ff 75 e0             	push   -0x20(%ebp)
+  8009b1:	57                   	push   %edi
+  8009b2:	51                   	push   %ecx
+  8009b3:	52                   	push   %edx
+  8009b4:	89 da                	mov    %ebx,%edx
+  8009b6:	89 f0                	mov    %esi,%eax
+  8009b8:	e8 4a fb ff ff       	call   800507 <printnum>
+			break;
+  8009bd:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8009c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8009c3:	e9 40 fc ff ff       	jmp    800608 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8009c8:	83 f9 01             	cmp    $0x1,%ecx
+  8009cb:	7f 1b                	jg     8009e8 <vprintfmt+0x3fe>
+	else if (lflag)
+  8009cd:	85 c9                	test   %ecx,%ecx
+  8009cf:	74 2c                	je     8009fd <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8009d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d4:	8b 10                	mov    (%eax),%edx
+  8009d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009db:	8d 40 04             	lea    0x4(%eax),%eax
+  8009de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009e1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8009e6:	eb be                	jmp    8009a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009eb:	8b 10                	mov    (%eax),%edx
+  8009ed:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009f0:	8d 40 08             	lea    0x8(%eax),%eax
+  8009f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009f6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8009fb:	eb a9                	jmp    8009a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8009fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a00:	8b 10                	mov    (%eax),%edx
+  800a02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a07:	8d 40 04             	lea    0x4(%eax),%eax
+  800a0a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a0d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800a12:	eb 92                	jmp    8009a6 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800a14:	83 ec 08             	sub    $0x8,%esp
+  800a17:	53                   	push   %ebx
+  800a18:	6a 25                	push   $0x25
+  800a1a:	ff d6                	call   *%esi
+			break;
+  800a1c:	83 c4 10             	add    $0x10,%esp
+  800a1f:	eb 9f                	jmp    8009c0 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800a21:	83 ec 08             	sub    $0x8,%esp
+  800a24:	53                   	push   %ebx
+  800a25:	6a 25                	push   $0x25
+  800a27:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a29:	83 c4 10             	add    $0x10,%esp
+  800a2c:	89 f8                	mov    %edi,%eax
+  800a2e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a32:	74 05                	je     800a39 <vprintfmt+0x44f>
+  800a34:	83 e8 01             	sub    $0x1,%eax
+  800a37:	eb f5                	jmp    800a2e <vprintfmt+0x444>
+  800a39:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a3c:	eb 82                	jmp    8009c0 <vprintfmt+0x3d6>
+
+00800a3e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a3e:	55                   	push   %ebp
+  800a3f:	89 e5                	mov    %esp,%ebp
+  800a41:	83 ec 18             	sub    $0x18,%esp
+  800a44:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a47:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a4a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a4d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a51:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a54:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a5b:	85 c0                	test   %eax,%eax
+  800a5d:	74 26                	je     800a85 <vsnprintf+0x47>
+  800a5f:	85 d2                	test   %edx,%edx
+  800a61:	7e 22                	jle    800a85 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a63:	ff 75 14             	push   0x14(%ebp)
+  800a66:	ff 75 10             	push   0x10(%ebp)
+  800a69:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a6c:	50                   	push   %eax
+  800a6d:	68 b0 05 80 00       	push   $0x8005b0
+  800a72:	e8 73 fb ff ff       	call   8005ea <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a77:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a7a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a80:	83 c4 10             	add    $0x10,%esp
+}
+  800a83:	c9                   	leave
+  800a84:	c3                   	ret
+		return -E_INVAL;
+  800a85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a8a:	eb f7                	jmp    800a83 <vsnprintf+0x45>
+
+00800a8c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a92:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a95:	50                   	push   %eax
+  800a96:	ff 75 10             	push   0x10(%ebp)
+  800a99:	ff 75 0c             	push   0xc(%ebp)
+  800a9c:	ff 75 08             	push   0x8(%ebp)
+  800a9f:	e8 9a ff ff ff       	call   800a3e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800aa4:	c9                   	leave
+  800aa5:	c3                   	ret
+
+00800aa6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800aa6:	55                   	push   %ebp
+  800aa7:	89 e5                	mov    %esp,%ebp
+  800aa9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab1:	eb 03                	jmp    800ab6 <strlen+0x10>
+		n++;
+  800ab3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800ab6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800aba:	75 f7                	jne    800ab3 <strlen+0xd>
+	return n;
+}
+  800abc:	5d                   	pop    %ebp
+  800abd:	c3                   	ret
+
+00800abe <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800abe:	55                   	push   %ebp
+  800abf:	89 e5                	mov    %esp,%ebp
+  800ac1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ac4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acc:	eb 03                	jmp    800ad1 <strnlen+0x13>
+		n++;
+  800ace:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ad1:	39 d0                	cmp    %edx,%eax
+  800ad3:	74 08                	je     800add <strnlen+0x1f>
+  800ad5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ad9:	75 f3                	jne    800ace <strnlen+0x10>
+  800adb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800add:	89 d0                	mov    %edx,%eax
+  800adf:	5d                   	pop    %ebp
+  800ae0:	c3                   	ret
+
+00800ae1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ae1:	55                   	push   %ebp
+  800ae2:	89 e5                	mov    %esp,%ebp
+  800ae4:	53                   	push   %ebx
+  800ae5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800af4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800af7:	83 c0 01             	add    $0x1,%eax
+  800afa:	84 d2                	test   %dl,%dl
+  800afc:	75 f2                	jne    800af0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800afe:	89 c8                	mov    %ecx,%eax
+  800b00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b03:	c9                   	leave
+  800b04:	c3                   	ret
+
+00800b05 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	53                   	push   %ebx
+  800b09:	83 ec 10             	sub    $0x10,%esp
+  800b0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b0f:	53                   	push   %ebx
+  800b10:	e8 91 ff ff ff       	call   800aa6 <strlen>
+  800b15:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b18:	ff 75 0c             	push   0xc(%ebp)
+  800b1b:	01 d8                	add    %ebx,%eax
+  800b1d:	50                   	push   %eax
+  800b1e:	e8 be ff ff ff       	call   800ae1 <strcpy>
+	return dst;
+}
+  800b23:	89 d8                	mov    %ebx,%eax
+  800b25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b28:	c9                   	leave
+  800b29:	c3                   	ret
+
+00800b2a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	56                   	push   %esi
+  800b2e:	53                   	push   %ebx
+  800b2f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b32:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b35:	89 f3                	mov    %esi,%ebx
+  800b37:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b3a:	89 f0                	mov    %esi,%eax
+  800b3c:	eb 0f                	jmp    800b4d <strncpy+0x23>
+		*dst++ = *src;
+  800b3e:	83 c0 01             	add    $0x1,%eax
+  800b41:	0f b6 0a             	movzbl (%edx),%ecx
+  800b44:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b47:	80 f9 01             	cmp    $0x1,%cl
+  800b4a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b4d:	39 d8                	cmp    %ebx,%eax
+  800b4f:	75 ed                	jne    800b3e <strncpy+0x14>
+	}
+	return ret;
+}
+  800b51:	89 f0                	mov    %esi,%eax
+  800b53:	5b                   	pop    %ebx
+  800b54:	5e                   	pop    %esi
+  800b55:	5d                   	pop    %ebp
+  800b56:	c3                   	ret
+
+00800b57 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	56                   	push   %esi
+  800b5b:	53                   	push   %ebx
+  800b5c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b62:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b65:	89 f0                	mov    %esi,%eax
+  800b67:	85 d2                	test   %edx,%edx
+  800b69:	74 21                	je     800b8c <strlcpy+0x35>
+  800b6b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b6f:	89 f2                	mov    %esi,%edx
+  800b71:	eb 09                	jmp    800b7c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b73:	83 c1 01             	add    $0x1,%ecx
+  800b76:	83 c2 01             	add    $0x1,%edx
+  800b79:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b7c:	39 c2                	cmp    %eax,%edx
+  800b7e:	74 09                	je     800b89 <strlcpy+0x32>
+  800b80:	0f b6 19             	movzbl (%ecx),%ebx
+  800b83:	84 db                	test   %bl,%bl
+  800b85:	75 ec                	jne    800b73 <strlcpy+0x1c>
+  800b87:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b89:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b8c:	29 f0                	sub    %esi,%eax
+}
+  800b8e:	5b                   	pop    %ebx
+  800b8f:	5e                   	pop    %esi
+  800b90:	5d                   	pop    %ebp
+  800b91:	c3                   	ret
+
+00800b92 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b92:	55                   	push   %ebp
+  800b93:	89 e5                	mov    %esp,%ebp
+  800b95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b98:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b9b:	eb 06                	jmp    800ba3 <strcmp+0x11>
+		p++, q++;
+  800b9d:	83 c1 01             	add    $0x1,%ecx
+  800ba0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ba3:	0f b6 01             	movzbl (%ecx),%eax
+  800ba6:	84 c0                	test   %al,%al
+  800ba8:	74 04                	je     800bae <strcmp+0x1c>
+  800baa:	3a 02                	cmp    (%edx),%al
+  800bac:	74 ef                	je     800b9d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bae:	0f b6 c0             	movzbl %al,%eax
+  800bb1:	0f b6 12             	movzbl (%edx),%edx
+  800bb4:	29 d0                	sub    %edx,%eax
+}
+  800bb6:	5d                   	pop    %ebp
+  800bb7:	c3                   	ret
+
+00800bb8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	53                   	push   %ebx
+  800bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800bc5:	eb 09                	jmp    800bd0 <strncmp+0x18>
+		n--, p++, q++;
+  800bc7:	83 ea 01             	sub    $0x1,%edx
+  800bca:	83 c0 01             	add    $0x1,%eax
+  800bcd:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800bd0:	85 d2                	test   %edx,%edx
+  800bd2:	74 18                	je     800bec <strncmp+0x34>
+  800bd4:	0f b6 18             	movzbl (%eax),%ebx
+  800bd7:	84 db                	test   %bl,%bl
+  800bd9:	74 04                	je     800bdf <strncmp+0x27>
+  800bdb:	3a 19                	cmp    (%ecx),%bl
+  800bdd:	74 e8                	je     800bc7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bdf:	0f b6 00             	movzbl (%eax),%eax
+  800be2:	0f b6 11             	movzbl (%ecx),%edx
+  800be5:	29 d0                	sub    %edx,%eax
+}
+  800be7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bea:	c9                   	leave
+  800beb:	c3                   	ret
+		return 0;
+  800bec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf1:	eb f4                	jmp    800be7 <strncmp+0x2f>
+
+00800bf3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bf3:	55                   	push   %ebp
+  800bf4:	89 e5                	mov    %esp,%ebp
+  800bf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bfd:	eb 03                	jmp    800c02 <strchr+0xf>
+  800bff:	83 c0 01             	add    $0x1,%eax
+  800c02:	0f b6 10             	movzbl (%eax),%edx
+  800c05:	84 d2                	test   %dl,%dl
+  800c07:	74 06                	je     800c0f <strchr+0x1c>
+		if (*s == c)
+  800c09:	38 ca                	cmp    %cl,%dl
+  800c0b:	75 f2                	jne    800bff <strchr+0xc>
+  800c0d:	eb 05                	jmp    800c14 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c14:	5d                   	pop    %ebp
+  800c15:	c3                   	ret
+
+00800c16 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c1c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c20:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c23:	38 ca                	cmp    %cl,%dl
+  800c25:	74 09                	je     800c30 <strfind+0x1a>
+  800c27:	84 d2                	test   %dl,%dl
+  800c29:	74 05                	je     800c30 <strfind+0x1a>
+	for (; *s; s++)
+  800c2b:	83 c0 01             	add    $0x1,%eax
+  800c2e:	eb f0                	jmp    800c20 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c30:	5d                   	pop    %ebp
+  800c31:	c3                   	ret
+
+00800c32 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	57                   	push   %edi
+  800c36:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c39:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c3c:	85 c9                	test   %ecx,%ecx
+  800c3e:	74 20                	je     800c60 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c40:	89 f8                	mov    %edi,%eax
+  800c42:	09 c8                	or     %ecx,%eax
+  800c44:	a8 03                	test   $0x3,%al
+  800c46:	75 12                	jne    800c5a <memset+0x28>
+		c &= 0xFF;
+  800c48:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c4c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c52:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c55:	fc                   	cld
+  800c56:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c58:	eb 06                	jmp    800c60 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c5d:	fc                   	cld
+  800c5e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c60:	89 f8                	mov    %edi,%eax
+  800c62:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c65:	c9                   	leave
+  800c66:	c3                   	ret
+
+00800c67 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c67:	55                   	push   %ebp
+  800c68:	89 e5                	mov    %esp,%ebp
+  800c6a:	57                   	push   %edi
+  800c6b:	56                   	push   %esi
+  800c6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c72:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c75:	39 c6                	cmp    %eax,%esi
+  800c77:	73 32                	jae    800cab <memmove+0x44>
+  800c79:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c7c:	39 d0                	cmp    %edx,%eax
+  800c7e:	73 2b                	jae    800cab <memmove+0x44>
+		s += n;
+		d += n;
+  800c80:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c83:	89 d6                	mov    %edx,%esi
+  800c85:	09 fe                	or     %edi,%esi
+  800c87:	09 ce                	or     %ecx,%esi
+  800c89:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c8f:	75 0e                	jne    800c9f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c91:	83 ef 04             	sub    $0x4,%edi
+  800c94:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c97:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c9a:	fd                   	std
+  800c9b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c9d:	eb 09                	jmp    800ca8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c9f:	83 ef 01             	sub    $0x1,%edi
+  800ca2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ca5:	fd                   	std
+  800ca6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ca8:	fc                   	cld
+  800ca9:	eb 1a                	jmp    800cc5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cab:	89 f2                	mov    %esi,%edx
+  800cad:	09 c2                	or     %eax,%edx
+  800caf:	09 ca                	or     %ecx,%edx
+  800cb1:	f6 c2 03             	test   $0x3,%dl
+  800cb4:	75 0a                	jne    800cc0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800cb6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800cb9:	89 c7                	mov    %eax,%edi
+  800cbb:	fc                   	cld
+  800cbc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cbe:	eb 05                	jmp    800cc5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800cc0:	89 c7                	mov    %eax,%edi
+  800cc2:	fc                   	cld
+  800cc3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800cc5:	5e                   	pop    %esi
+  800cc6:	5f                   	pop    %edi
+  800cc7:	5d                   	pop    %ebp
+  800cc8:	c3                   	ret
+
+00800cc9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ccf:	ff 75 10             	push   0x10(%ebp)
+  800cd2:	ff 75 0c             	push   0xc(%ebp)
+  800cd5:	ff 75 08             	push   0x8(%ebp)
+  800cd8:	e8 8a ff ff ff       	call   800c67 <memmove>
+}
+  800cdd:	c9                   	leave
+  800cde:	c3                   	ret
+
+00800cdf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	56                   	push   %esi
+  800ce3:	53                   	push   %ebx
+  800ce4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cea:	89 c6                	mov    %eax,%esi
+  800cec:	03 75 10             	add    0x10(%ebp),%esi
+  800cef:	eb 06                	jmp    800cf7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cf1:	83 c0 01             	add    $0x1,%eax
+  800cf4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cf7:	39 f0                	cmp    %esi,%eax
+  800cf9:	74 14                	je     800d0f <memcmp+0x30>
+		if (*s1 != *s2)
+  800cfb:	0f b6 08             	movzbl (%eax),%ecx
+  800cfe:	0f b6 1a             	movzbl (%edx),%ebx
+  800d01:	38 d9                	cmp    %bl,%cl
+  800d03:	74 ec                	je     800cf1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d05:	0f b6 c1             	movzbl %cl,%eax
+  800d08:	0f b6 db             	movzbl %bl,%ebx
+  800d0b:	29 d8                	sub    %ebx,%eax
+  800d0d:	eb 05                	jmp    800d14 <memcmp+0x35>
+	}
+
+	return 0;
+  800d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d14:	5b                   	pop    %ebx
+  800d15:	5e                   	pop    %esi
+  800d16:	5d                   	pop    %ebp
+  800d17:	c3                   	ret
+
+00800d18 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d18:	55                   	push   %ebp
+  800d19:	89 e5                	mov    %esp,%ebp
+  800d1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d21:	89 c2                	mov    %eax,%edx
+  800d23:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d26:	eb 03                	jmp    800d2b <memfind+0x13>
+  800d28:	83 c0 01             	add    $0x1,%eax
+  800d2b:	39 d0                	cmp    %edx,%eax
+  800d2d:	73 04                	jae    800d33 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d2f:	38 08                	cmp    %cl,(%eax)
+  800d31:	75 f5                	jne    800d28 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d33:	5d                   	pop    %ebp
+  800d34:	c3                   	ret
+
+00800d35 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d35:	55                   	push   %ebp
+  800d36:	89 e5                	mov    %esp,%ebp
+  800d38:	57                   	push   %edi
+  800d39:	56                   	push   %esi
+  800d3a:	53                   	push   %ebx
+  800d3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d41:	eb 03                	jmp    800d46 <strtol+0x11>
+		s++;
+  800d43:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d46:	0f b6 02             	movzbl (%edx),%eax
+  800d49:	3c 20                	cmp    $0x20,%al
+  800d4b:	74 f6                	je     800d43 <strtol+0xe>
+  800d4d:	3c 09                	cmp    $0x9,%al
+  800d4f:	74 f2                	je     800d43 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d51:	3c 2b                	cmp    $0x2b,%al
+  800d53:	74 2a                	je     800d7f <strtol+0x4a>
+	int neg = 0;
+  800d55:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d5a:	3c 2d                	cmp    $0x2d,%al
+  800d5c:	74 2b                	je     800d89 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d5e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d64:	75 0f                	jne    800d75 <strtol+0x40>
+  800d66:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d69:	74 28                	je     800d93 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d6b:	85 db                	test   %ebx,%ebx
+  800d6d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d72:	0f 44 d8             	cmove  %eax,%ebx
+  800d75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d7a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d7d:	eb 46                	jmp    800dc5 <strtol+0x90>
+		s++;
+  800d7f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d82:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d87:	eb d5                	jmp    800d5e <strtol+0x29>
+		s++, neg = 1;
+  800d89:	83 c2 01             	add    $0x1,%edx
+  800d8c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d91:	eb cb                	jmp    800d5e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d93:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d97:	74 0e                	je     800da7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d99:	85 db                	test   %ebx,%ebx
+  800d9b:	75 d8                	jne    800d75 <strtol+0x40>
+		s++, base = 8;
+  800d9d:	83 c2 01             	add    $0x1,%edx
+  800da0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800da5:	eb ce                	jmp    800d75 <strtol+0x40>
+		s += 2, base = 16;
+  800da7:	83 c2 02             	add    $0x2,%edx
+  800daa:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800daf:	eb c4                	jmp    800d75 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800db1:	0f be c0             	movsbl %al,%eax
+  800db4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800db7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800dba:	7d 3a                	jge    800df6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800dbc:	83 c2 01             	add    $0x1,%edx
+  800dbf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800dc3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800dc5:	0f b6 02             	movzbl (%edx),%eax
+  800dc8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800dcb:	89 f3                	mov    %esi,%ebx
+  800dcd:	80 fb 09             	cmp    $0x9,%bl
+  800dd0:	76 df                	jbe    800db1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800dd2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800dd5:	89 f3                	mov    %esi,%ebx
+  800dd7:	80 fb 19             	cmp    $0x19,%bl
+  800dda:	77 08                	ja     800de4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ddc:	0f be c0             	movsbl %al,%eax
+  800ddf:	83 e8 57             	sub    $0x57,%eax
+  800de2:	eb d3                	jmp    800db7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800de4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800de7:	89 f3                	mov    %esi,%ebx
+  800de9:	80 fb 19             	cmp    $0x19,%bl
+  800dec:	77 08                	ja     800df6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800dee:	0f be c0             	movsbl %al,%eax
+  800df1:	83 e8 37             	sub    $0x37,%eax
+  800df4:	eb c1                	jmp    800db7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800df6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dfa:	74 05                	je     800e01 <strtol+0xcc>
+		*endptr = (char *) s;
+  800dfc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dff:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800e01:	89 c8                	mov    %ecx,%eax
+  800e03:	f7 d8                	neg    %eax
+  800e05:	85 ff                	test   %edi,%edi
+  800e07:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800e0a:	89 c8                	mov    %ecx,%eax
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5f                   	pop    %edi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+
+00800e11 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	56                   	push   %esi
+  800e16:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e22:	89 c3                	mov    %eax,%ebx
+  800e24:	89 c7                	mov    %eax,%edi
+  800e26:	89 c6                	mov    %eax,%esi
+  800e28:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e2a:	5b                   	pop    %ebx
+  800e2b:	5e                   	pop    %esi
+  800e2c:	5f                   	pop    %edi
+  800e2d:	5d                   	pop    %ebp
+  800e2e:	c3                   	ret
+
+00800e2f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e2f:	55                   	push   %ebp
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	57                   	push   %edi
+  800e33:	56                   	push   %esi
+  800e34:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e35:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e3f:	89 d1                	mov    %edx,%ecx
+  800e41:	89 d3                	mov    %edx,%ebx
+  800e43:	89 d7                	mov    %edx,%edi
+  800e45:	89 d6                	mov    %edx,%esi
+  800e47:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e49:	5b                   	pop    %ebx
+  800e4a:	5e                   	pop    %esi
+  800e4b:	5f                   	pop    %edi
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	c3                   	ret
+
+00800e4e <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800e4e:	55                   	push   %ebp
+  800e4f:	89 e5                	mov    %esp,%ebp
+  800e51:	57                   	push   %edi
+  800e52:	56                   	push   %esi
+  800e53:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e54:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e61:	89 cb                	mov    %ecx,%ebx
+  800e63:	89 cf                	mov    %ecx,%edi
+  800e65:	89 ce                	mov    %ecx,%esi
+  800e67:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800e69:	5b                   	pop    %ebx
+  800e6a:	5e                   	pop    %esi
+  800e6b:	5f                   	pop    %edi
+  800e6c:	5d                   	pop    %ebp
+  800e6d:	c3                   	ret
+
+00800e6e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e6e:	55                   	push   %ebp
+  800e6f:	89 e5                	mov    %esp,%ebp
+  800e71:	57                   	push   %edi
+  800e72:	56                   	push   %esi
+  800e73:	53                   	push   %ebx
+  800e74:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e84:	89 cb                	mov    %ecx,%ebx
+  800e86:	89 cf                	mov    %ecx,%edi
+  800e88:	89 ce                	mov    %ecx,%esi
+  800e8a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8c:	85 c0                	test   %eax,%eax
+  800e8e:	7f 08                	jg     800e98 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e93:	5b                   	pop    %ebx
+  800e94:	5e                   	pop    %esi
+  800e95:	5f                   	pop    %edi
+  800e96:	5d                   	pop    %ebp
+  800e97:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e98:	83 ec 0c             	sub    $0xc,%esp
+  800e9b:	50                   	push   %eax
+  800e9c:	6a 03                	push   $0x3
+  800e9e:	68 1f 30 80 00       	push   $0x80301f
+  800ea3:	6a 23                	push   $0x23
+  800ea5:	68 3c 30 80 00       	push   $0x80303c
+  800eaa:	e8 69 f5 ff ff       	call   800418 <_panic>
+
+00800eaf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800eaf:	55                   	push   %ebp
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	57                   	push   %edi
+  800eb3:	56                   	push   %esi
+  800eb4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eba:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ebf:	89 d1                	mov    %edx,%ecx
+  800ec1:	89 d3                	mov    %edx,%ebx
+  800ec3:	89 d7                	mov    %edx,%edi
+  800ec5:	89 d6                	mov    %edx,%esi
+  800ec7:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ec9:	5b                   	pop    %ebx
+  800eca:	5e                   	pop    %esi
+  800ecb:	5f                   	pop    %edi
+  800ecc:	5d                   	pop    %ebp
+  800ecd:	c3                   	ret
+
+00800ece <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	57                   	push   %edi
+  800ed2:	56                   	push   %esi
+  800ed3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ed4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed9:	b8 16 00 00 00       	mov    $0x16,%eax
+  800ede:	89 d1                	mov    %edx,%ecx
+  800ee0:	89 d3                	mov    %edx,%ebx
+  800ee2:	89 d7                	mov    %edx,%edi
+  800ee4:	89 d6                	mov    %edx,%esi
+  800ee6:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ee8:	5b                   	pop    %ebx
+  800ee9:	5e                   	pop    %esi
+  800eea:	5f                   	pop    %edi
+  800eeb:	5d                   	pop    %ebp
+  800eec:	c3                   	ret
+
+00800eed <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800eed:	55                   	push   %ebp
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	57                   	push   %edi
+  800ef1:	56                   	push   %esi
+  800ef2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800efd:	89 d1                	mov    %edx,%ecx
+  800eff:	89 d3                	mov    %edx,%ebx
+  800f01:	89 d7                	mov    %edx,%edi
+  800f03:	89 d6                	mov    %edx,%esi
+  800f05:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800f07:	5b                   	pop    %ebx
+  800f08:	5e                   	pop    %esi
+  800f09:	5f                   	pop    %edi
+  800f0a:	5d                   	pop    %ebp
+  800f0b:	c3                   	ret
+
+00800f0c <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	57                   	push   %edi
+  800f10:	56                   	push   %esi
+  800f11:	53                   	push   %ebx
+  800f12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f20:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f25:	89 df                	mov    %ebx,%edi
+  800f27:	89 de                	mov    %ebx,%esi
+  800f29:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f2b:	85 c0                	test   %eax,%eax
+  800f2d:	7f 08                	jg     800f37 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800f2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f32:	5b                   	pop    %ebx
+  800f33:	5e                   	pop    %esi
+  800f34:	5f                   	pop    %edi
+  800f35:	5d                   	pop    %ebp
+  800f36:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+  800f3a:	50                   	push   %eax
+  800f3b:	6a 15                	push   $0x15
+  800f3d:	68 1f 30 80 00       	push   $0x80301f
+  800f42:	6a 23                	push   $0x23
+  800f44:	68 3c 30 80 00       	push   $0x80303c
+  800f49:	e8 ca f4 ff ff       	call   800418 <_panic>
+
+00800f4e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	57                   	push   %edi
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f57:	be 00 00 00 00       	mov    $0x0,%esi
+  800f5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f62:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6a:	89 f7                	mov    %esi,%edi
+  800f6c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6e:	85 c0                	test   %eax,%eax
+  800f70:	7f 08                	jg     800f7a <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f75:	5b                   	pop    %ebx
+  800f76:	5e                   	pop    %esi
+  800f77:	5f                   	pop    %edi
+  800f78:	5d                   	pop    %ebp
+  800f79:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f7a:	83 ec 0c             	sub    $0xc,%esp
+  800f7d:	50                   	push   %eax
+  800f7e:	6a 05                	push   $0x5
+  800f80:	68 1f 30 80 00       	push   $0x80301f
+  800f85:	6a 23                	push   $0x23
+  800f87:	68 3c 30 80 00       	push   $0x80303c
+  800f8c:	e8 87 f4 ff ff       	call   800418 <_panic>
+
+00800f91 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800f91:	55                   	push   %ebp
+  800f92:	89 e5                	mov    %esp,%ebp
+  800f94:	57                   	push   %edi
+  800f95:	56                   	push   %esi
+  800f96:	53                   	push   %ebx
+  800f97:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f9a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800faa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fad:	89 f7                	mov    %esi,%edi
+  800faf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb1:	85 c0                	test   %eax,%eax
+  800fb3:	7f 08                	jg     800fbd <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800fb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb8:	5b                   	pop    %ebx
+  800fb9:	5e                   	pop    %esi
+  800fba:	5f                   	pop    %edi
+  800fbb:	5d                   	pop    %ebp
+  800fbc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fbd:	83 ec 0c             	sub    $0xc,%esp
+  800fc0:	50                   	push   %eax
+  800fc1:	6a 06                	push   $0x6
+  800fc3:	68 1f 30 80 00       	push   $0x80301f
+  800fc8:	6a 23                	push   $0x23
+  800fca:	68 3c 30 80 00       	push   $0x80303c
+  800fcf:	e8 44 f4 ff ff       	call   800418 <_panic>
+
+00800fd4 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fd4:	55                   	push   %ebp
+  800fd5:	89 e5                	mov    %esp,%ebp
+  800fd7:	57                   	push   %edi
+  800fd8:	56                   	push   %esi
+  800fd9:	53                   	push   %ebx
+  800fda:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe3:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fe8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800feb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fee:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ff1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff3:	85 c0                	test   %eax,%eax
+  800ff5:	7f 08                	jg     800fff <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ff7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ffa:	5b                   	pop    %ebx
+  800ffb:	5e                   	pop    %esi
+  800ffc:	5f                   	pop    %edi
+  800ffd:	5d                   	pop    %ebp
+  800ffe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fff:	83 ec 0c             	sub    $0xc,%esp
+  801002:	50                   	push   %eax
+  801003:	6a 07                	push   $0x7
+  801005:	68 1f 30 80 00       	push   $0x80301f
+  80100a:	6a 23                	push   $0x23
+  80100c:	68 3c 30 80 00       	push   $0x80303c
+  801011:	e8 02 f4 ff ff       	call   800418 <_panic>
+
+00801016 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	57                   	push   %edi
+  80101a:	56                   	push   %esi
+  80101b:	53                   	push   %ebx
+  80101c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80101f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801024:	8b 55 08             	mov    0x8(%ebp),%edx
+  801027:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80102f:	89 df                	mov    %ebx,%edi
+  801031:	89 de                	mov    %ebx,%esi
+  801033:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801035:	85 c0                	test   %eax,%eax
+  801037:	7f 08                	jg     801041 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801039:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103c:	5b                   	pop    %ebx
+  80103d:	5e                   	pop    %esi
+  80103e:	5f                   	pop    %edi
+  80103f:	5d                   	pop    %ebp
+  801040:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801041:	83 ec 0c             	sub    $0xc,%esp
+  801044:	50                   	push   %eax
+  801045:	6a 08                	push   $0x8
+  801047:	68 1f 30 80 00       	push   $0x80301f
+  80104c:	6a 23                	push   $0x23
+  80104e:	68 3c 30 80 00       	push   $0x80303c
+  801053:	e8 c0 f3 ff ff       	call   800418 <_panic>
+
+00801058 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  801058:	55                   	push   %ebp
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	57                   	push   %edi
+  80105c:	56                   	push   %esi
+  80105d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801061:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801064:	b8 09 00 00 00       	mov    $0x9,%eax
+  801069:	be 00 00 00 00       	mov    $0x0,%esi
+  80106e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801071:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801074:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  801076:	5b                   	pop    %ebx
+  801077:	5e                   	pop    %esi
+  801078:	5f                   	pop    %edi
+  801079:	5d                   	pop    %ebp
+  80107a:	c3                   	ret
+
+0080107b <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  80107b:	55                   	push   %ebp
+  80107c:	89 e5                	mov    %esp,%ebp
+  80107e:	57                   	push   %edi
+  80107f:	56                   	push   %esi
+  801080:	53                   	push   %ebx
+  801081:	8b 45 18             	mov    0x18(%ebp),%eax
+  801084:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  801087:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  80108c:	77 27                	ja     8010b5 <sys_page_map_range+0x3a>
+  80108e:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  801094:	77 1f                	ja     8010b5 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  801096:	c1 e0 0c             	shl    $0xc,%eax
+  801099:	89 c6                	mov    %eax,%esi
+  80109b:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  80109d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ae:	cd 30                	int    $0x30
+}
+  8010b0:	5b                   	pop    %ebx
+  8010b1:	5e                   	pop    %esi
+  8010b2:	5f                   	pop    %edi
+  8010b3:	5d                   	pop    %ebp
+  8010b4:	c3                   	ret
+		return -E_INVAL;
+  8010b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010ba:	eb f4                	jmp    8010b0 <sys_page_map_range+0x35>
+
+008010bc <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	57                   	push   %edi
+  8010c0:	56                   	push   %esi
+  8010c1:	53                   	push   %ebx
+  8010c2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010dd:	85 c0                	test   %eax,%eax
+  8010df:	7f 08                	jg     8010e9 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8010e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e4:	5b                   	pop    %ebx
+  8010e5:	5e                   	pop    %esi
+  8010e6:	5f                   	pop    %edi
+  8010e7:	5d                   	pop    %ebp
+  8010e8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+  8010ec:	50                   	push   %eax
+  8010ed:	6a 0c                	push   $0xc
+  8010ef:	68 1f 30 80 00       	push   $0x80301f
+  8010f4:	6a 23                	push   $0x23
+  8010f6:	68 3c 30 80 00       	push   $0x80303c
+  8010fb:	e8 18 f3 ff ff       	call   800418 <_panic>
+
+00801100 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  801100:	55                   	push   %ebp
+  801101:	89 e5                	mov    %esp,%ebp
+  801103:	57                   	push   %edi
+  801104:	56                   	push   %esi
+  801105:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801106:	be 00 00 00 00       	mov    $0x0,%esi
+  80110b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801111:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801116:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801119:	89 f7                	mov    %esi,%edi
+  80111b:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  80111d:	5b                   	pop    %ebx
+  80111e:	5e                   	pop    %esi
+  80111f:	5f                   	pop    %edi
+  801120:	5d                   	pop    %ebp
+  801121:	c3                   	ret
+
+00801122 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	57                   	push   %edi
+  801126:	56                   	push   %esi
+  801127:	53                   	push   %ebx
+  801128:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80112b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801130:	8b 55 08             	mov    0x8(%ebp),%edx
+  801133:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801136:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80113b:	89 df                	mov    %ebx,%edi
+  80113d:	89 de                	mov    %ebx,%esi
+  80113f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801141:	85 c0                	test   %eax,%eax
+  801143:	7f 08                	jg     80114d <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801148:	5b                   	pop    %ebx
+  801149:	5e                   	pop    %esi
+  80114a:	5f                   	pop    %edi
+  80114b:	5d                   	pop    %ebp
+  80114c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114d:	83 ec 0c             	sub    $0xc,%esp
+  801150:	50                   	push   %eax
+  801151:	6a 0f                	push   $0xf
+  801153:	68 1f 30 80 00       	push   $0x80301f
+  801158:	6a 23                	push   $0x23
+  80115a:	68 3c 30 80 00       	push   $0x80303c
+  80115f:	e8 b4 f2 ff ff       	call   800418 <_panic>
+
+00801164 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  80116a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80116d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801172:	8b 55 08             	mov    0x8(%ebp),%edx
+  801175:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801178:	b8 10 00 00 00       	mov    $0x10,%eax
+  80117d:	89 df                	mov    %ebx,%edi
+  80117f:	89 de                	mov    %ebx,%esi
+  801181:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801183:	85 c0                	test   %eax,%eax
+  801185:	7f 08                	jg     80118f <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  801187:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118a:	5b                   	pop    %ebx
+  80118b:	5e                   	pop    %esi
+  80118c:	5f                   	pop    %edi
+  80118d:	5d                   	pop    %ebp
+  80118e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118f:	83 ec 0c             	sub    $0xc,%esp
+  801192:	50                   	push   %eax
+  801193:	6a 10                	push   $0x10
+  801195:	68 1f 30 80 00       	push   $0x80301f
+  80119a:	6a 23                	push   $0x23
+  80119c:	68 3c 30 80 00       	push   $0x80303c
+  8011a1:	e8 72 f2 ff ff       	call   800418 <_panic>
+
+008011a6 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	57                   	push   %edi
+  8011aa:	56                   	push   %esi
+  8011ab:	53                   	push   %ebx
+  8011ac:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ba:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011bf:	89 df                	mov    %ebx,%edi
+  8011c1:	89 de                	mov    %ebx,%esi
+  8011c3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c5:	85 c0                	test   %eax,%eax
+  8011c7:	7f 08                	jg     8011d1 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  8011c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cc:	5b                   	pop    %ebx
+  8011cd:	5e                   	pop    %esi
+  8011ce:	5f                   	pop    %edi
+  8011cf:	5d                   	pop    %ebp
+  8011d0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d1:	83 ec 0c             	sub    $0xc,%esp
+  8011d4:	50                   	push   %eax
+  8011d5:	6a 11                	push   $0x11
+  8011d7:	68 1f 30 80 00       	push   $0x80301f
+  8011dc:	6a 23                	push   $0x23
+  8011de:	68 3c 30 80 00       	push   $0x80303c
+  8011e3:	e8 30 f2 ff ff       	call   800418 <_panic>
+
+008011e8 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  8011e8:	55                   	push   %ebp
+  8011e9:	89 e5                	mov    %esp,%ebp
+  8011eb:	57                   	push   %edi
+  8011ec:	56                   	push   %esi
+  8011ed:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f3:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011f8:	89 d1                	mov    %edx,%ecx
+  8011fa:	89 d3                	mov    %edx,%ebx
+  8011fc:	89 d7                	mov    %edx,%edi
+  8011fe:	89 d6                	mov    %edx,%esi
+  801200:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  801202:	5b                   	pop    %ebx
+  801203:	5e                   	pop    %esi
+  801204:	5f                   	pop    %edi
+  801205:	5d                   	pop    %ebp
+  801206:	c3                   	ret
+
+00801207 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801207:	55                   	push   %ebp
+  801208:	89 e5                	mov    %esp,%ebp
+  80120a:	57                   	push   %edi
+  80120b:	56                   	push   %esi
+  80120c:	53                   	push   %ebx
+  80120d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801210:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801215:	8b 55 08             	mov    0x8(%ebp),%edx
+  801218:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801220:	89 df                	mov    %ebx,%edi
+  801222:	89 de                	mov    %ebx,%esi
+  801224:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801226:	85 c0                	test   %eax,%eax
+  801228:	7f 08                	jg     801232 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80122a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122d:	5b                   	pop    %ebx
+  80122e:	5e                   	pop    %esi
+  80122f:	5f                   	pop    %edi
+  801230:	5d                   	pop    %ebp
+  801231:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801232:	83 ec 0c             	sub    $0xc,%esp
+  801235:	50                   	push   %eax
+  801236:	6a 13                	push   $0x13
+  801238:	68 1f 30 80 00       	push   $0x80301f
+  80123d:	6a 23                	push   $0x23
+  80123f:	68 3c 30 80 00       	push   $0x80303c
+  801244:	e8 cf f1 ff ff       	call   800418 <_panic>
+
+00801249 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801249:	55                   	push   %ebp
+  80124a:	89 e5                	mov    %esp,%ebp
+  80124c:	57                   	push   %edi
+  80124d:	56                   	push   %esi
+  80124e:	53                   	push   %ebx
+  80124f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801252:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801257:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801262:	89 df                	mov    %ebx,%edi
+  801264:	89 de                	mov    %ebx,%esi
+  801266:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801268:	85 c0                	test   %eax,%eax
+  80126a:	7f 08                	jg     801274 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80126c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126f:	5b                   	pop    %ebx
+  801270:	5e                   	pop    %esi
+  801271:	5f                   	pop    %edi
+  801272:	5d                   	pop    %ebp
+  801273:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801274:	83 ec 0c             	sub    $0xc,%esp
+  801277:	50                   	push   %eax
+  801278:	6a 14                	push   $0x14
+  80127a:	68 1f 30 80 00       	push   $0x80301f
+  80127f:	6a 23                	push   $0x23
+  801281:	68 3c 30 80 00       	push   $0x80303c
+  801286:	e8 8d f1 ff ff       	call   800418 <_panic>
+
+0080128b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80128b:	55                   	push   %ebp
+  80128c:	89 e5                	mov    %esp,%ebp
+  80128e:	57                   	push   %edi
+  80128f:	56                   	push   %esi
+  801290:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801291:	8b 55 08             	mov    0x8(%ebp),%edx
+  801294:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801297:	b8 17 00 00 00       	mov    $0x17,%eax
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012a7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8012a9:	5b                   	pop    %ebx
+  8012aa:	5e                   	pop    %esi
+  8012ab:	5f                   	pop    %edi
+  8012ac:	5d                   	pop    %ebp
+  8012ad:	c3                   	ret
+
+008012ae <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	57                   	push   %edi
+  8012b2:	56                   	push   %esi
+  8012b3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ba:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012ca:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8012cc:	5b                   	pop    %ebx
+  8012cd:	5e                   	pop    %esi
+  8012ce:	5f                   	pop    %edi
+  8012cf:	5d                   	pop    %ebp
+  8012d0:	c3                   	ret
+
+008012d1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8012d1:	55                   	push   %ebp
+  8012d2:	89 e5                	mov    %esp,%ebp
+  8012d4:	57                   	push   %edi
+  8012d5:	56                   	push   %esi
+  8012d6:	53                   	push   %ebx
+  8012d7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012e7:	89 cb                	mov    %ecx,%ebx
+  8012e9:	89 cf                	mov    %ecx,%edi
+  8012eb:	89 ce                	mov    %ecx,%esi
+  8012ed:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ef:	85 c0                	test   %eax,%eax
+  8012f1:	7f 08                	jg     8012fb <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8012f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f6:	5b                   	pop    %ebx
+  8012f7:	5e                   	pop    %esi
+  8012f8:	5f                   	pop    %edi
+  8012f9:	5d                   	pop    %ebp
+  8012fa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012fb:	83 ec 0c             	sub    $0xc,%esp
+  8012fe:	50                   	push   %eax
+  8012ff:	6a 19                	push   $0x19
+  801301:	68 1f 30 80 00       	push   $0x80301f
+  801306:	6a 23                	push   $0x23
+  801308:	68 3c 30 80 00       	push   $0x80303c
+  80130d:	e8 06 f1 ff ff       	call   800418 <_panic>
+
+00801312 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801312:	55                   	push   %ebp
+  801313:	89 e5                	mov    %esp,%ebp
+  801315:	57                   	push   %edi
+  801316:	56                   	push   %esi
+  801317:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801318:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801322:	89 d1                	mov    %edx,%ecx
+  801324:	89 d3                	mov    %edx,%ebx
+  801326:	89 d7                	mov    %edx,%edi
+  801328:	89 d6                	mov    %edx,%esi
+  80132a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80132c:	5b                   	pop    %ebx
+  80132d:	5e                   	pop    %esi
+  80132e:	5f                   	pop    %edi
+  80132f:	5d                   	pop    %ebp
+  801330:	c3                   	ret
+
+00801331 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801331:	55                   	push   %ebp
+  801332:	89 e5                	mov    %esp,%ebp
+  801334:	57                   	push   %edi
+  801335:	56                   	push   %esi
+  801336:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801337:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801342:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801347:	89 df                	mov    %ebx,%edi
+  801349:	89 de                	mov    %ebx,%esi
+  80134b:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  80134d:	5b                   	pop    %ebx
+  80134e:	5e                   	pop    %esi
+  80134f:	5f                   	pop    %edi
+  801350:	5d                   	pop    %ebp
+  801351:	c3                   	ret
+
+00801352 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801352:	55                   	push   %ebp
+  801353:	89 e5                	mov    %esp,%ebp
+  801355:	57                   	push   %edi
+  801356:	56                   	push   %esi
+  801357:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801358:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801360:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801363:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801368:	89 df                	mov    %ebx,%edi
+  80136a:	89 de                	mov    %ebx,%esi
+  80136c:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  80136e:	5b                   	pop    %ebx
+  80136f:	5e                   	pop    %esi
+  801370:	5f                   	pop    %edi
+  801371:	5d                   	pop    %ebp
+  801372:	c3                   	ret
+
+00801373 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801373:	55                   	push   %ebp
+  801374:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801376:	8b 45 08             	mov    0x8(%ebp),%eax
+  801379:	05 00 00 00 30       	add    $0x30000000,%eax
+  80137e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801381:	5d                   	pop    %ebp
+  801382:	c3                   	ret
+
+00801383 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801386:	8b 45 08             	mov    0x8(%ebp),%eax
+  801389:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80138e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801393:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801398:	5d                   	pop    %ebp
+  801399:	c3                   	ret
+
+0080139a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80139a:	55                   	push   %ebp
+  80139b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80139d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013a2:	eb 02                	jmp    8013a6 <fd_alloc+0xc>
+  8013a4:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013a6:	89 c2                	mov    %eax,%edx
+  8013a8:	c1 ea 16             	shr    $0x16,%edx
+  8013ab:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8013b2:	f6 c2 01             	test   $0x1,%dl
+  8013b5:	74 2b                	je     8013e2 <fd_alloc+0x48>
+  8013b7:	89 c2                	mov    %eax,%edx
+  8013b9:	c1 ea 0c             	shr    $0xc,%edx
+  8013bc:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013c3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8013c9:	f6 c1 01             	test   $0x1,%cl
+  8013cc:	74 14                	je     8013e2 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8013ce:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8013d4:	75 ce                	jne    8013a4 <fd_alloc+0xa>
+  8013d6:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013db:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8013e0:	eb 05                	jmp    8013e7 <fd_alloc+0x4d>
+			return 0;
+  8013e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8013e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ea:	89 02                	mov    %eax,(%edx)
+}
+  8013ec:	89 c8                	mov    %ecx,%eax
+  8013ee:	5d                   	pop    %ebp
+  8013ef:	c3                   	ret
+
+008013f0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013f0:	55                   	push   %ebp
+  8013f1:	89 e5                	mov    %esp,%ebp
+  8013f3:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8013f6:	83 f8 1f             	cmp    $0x1f,%eax
+  8013f9:	77 30                	ja     80142b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8013fb:	c1 e0 0c             	shl    $0xc,%eax
+  8013fe:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801403:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801409:	f6 c2 01             	test   $0x1,%dl
+  80140c:	74 24                	je     801432 <fd_lookup+0x42>
+  80140e:	89 c2                	mov    %eax,%edx
+  801410:	c1 ea 0c             	shr    $0xc,%edx
+  801413:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80141a:	f6 c2 01             	test   $0x1,%dl
+  80141d:	74 1a                	je     801439 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80141f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801422:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801424:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801429:	5d                   	pop    %ebp
+  80142a:	c3                   	ret
+		return -E_INVAL;
+  80142b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801430:	eb f7                	jmp    801429 <fd_lookup+0x39>
+		return -E_INVAL;
+  801432:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801437:	eb f0                	jmp    801429 <fd_lookup+0x39>
+  801439:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80143e:	eb e9                	jmp    801429 <fd_lookup+0x39>
+
+00801440 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801440:	55                   	push   %ebp
+  801441:	89 e5                	mov    %esp,%ebp
+  801443:	53                   	push   %ebx
+  801444:	83 ec 04             	sub    $0x4,%esp
+  801447:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80144a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144f:	eb 03                	jmp    801454 <dev_lookup+0x14>
+  801451:	83 c0 01             	add    $0x1,%eax
+  801454:	8b 1c 85 c8 30 80 00 	mov    0x8030c8(,%eax,4),%ebx
+  80145b:	85 db                	test   %ebx,%ebx
+  80145d:	74 0b                	je     80146a <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80145f:	39 13                	cmp    %edx,(%ebx)
+  801461:	75 ee                	jne    801451 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801463:	b8 00 00 00 00       	mov    $0x0,%eax
+  801468:	eb 1f                	jmp    801489 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80146a:	a1 08 50 80 00       	mov    0x805008,%eax
+  80146f:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801472:	83 ec 04             	sub    $0x4,%esp
+  801475:	52                   	push   %edx
+  801476:	50                   	push   %eax
+  801477:	68 4c 30 80 00       	push   $0x80304c
+  80147c:	e8 72 f0 ff ff       	call   8004f3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801481:	83 c4 10             	add    $0x10,%esp
+  801484:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801489:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80148c:	89 1a                	mov    %ebx,(%edx)
+}
+  80148e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801491:	c9                   	leave
+  801492:	c3                   	ret
+
+00801493 <fd_close>:
+{
+  801493:	55                   	push   %ebp
+  801494:	89 e5                	mov    %esp,%ebp
+  801496:	57                   	push   %edi
+  801497:	56                   	push   %esi
+  801498:	53                   	push   %ebx
+  801499:	83 ec 24             	sub    $0x24,%esp
+  80149c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80149f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014a2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014a5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014a6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014ac:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014af:	50                   	push   %eax
+  8014b0:	e8 3b ff ff ff       	call   8013f0 <fd_lookup>
+  8014b5:	89 c3                	mov    %eax,%ebx
+  8014b7:	83 c4 10             	add    $0x10,%esp
+  8014ba:	85 c0                	test   %eax,%eax
+  8014bc:	78 05                	js     8014c3 <fd_close+0x30>
+	    || fd != fd2)
+  8014be:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014c1:	74 16                	je     8014d9 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8014c3:	89 f8                	mov    %edi,%eax
+  8014c5:	84 c0                	test   %al,%al
+  8014c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cc:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014cf:	89 d8                	mov    %ebx,%eax
+  8014d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d4:	5b                   	pop    %ebx
+  8014d5:	5e                   	pop    %esi
+  8014d6:	5f                   	pop    %edi
+  8014d7:	5d                   	pop    %ebp
+  8014d8:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014d9:	83 ec 08             	sub    $0x8,%esp
+  8014dc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014df:	50                   	push   %eax
+  8014e0:	ff 36                	push   (%esi)
+  8014e2:	e8 59 ff ff ff       	call   801440 <dev_lookup>
+  8014e7:	89 c3                	mov    %eax,%ebx
+  8014e9:	83 c4 10             	add    $0x10,%esp
+  8014ec:	85 c0                	test   %eax,%eax
+  8014ee:	78 1a                	js     80150a <fd_close+0x77>
+		if (dev->dev_close)
+  8014f0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014f3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014fb:	85 c0                	test   %eax,%eax
+  8014fd:	74 0b                	je     80150a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8014ff:	83 ec 0c             	sub    $0xc,%esp
+  801502:	56                   	push   %esi
+  801503:	ff d0                	call   *%eax
+  801505:	89 c3                	mov    %eax,%ebx
+  801507:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80150a:	83 ec 08             	sub    $0x8,%esp
+  80150d:	56                   	push   %esi
+  80150e:	6a 00                	push   $0x0
+  801510:	e8 01 fb ff ff       	call   801016 <sys_page_unmap>
+	return r;
+  801515:	83 c4 10             	add    $0x10,%esp
+  801518:	eb b5                	jmp    8014cf <fd_close+0x3c>
+
+0080151a <close>:
+
+int
+close(int fdnum)
+{
+  80151a:	55                   	push   %ebp
+  80151b:	89 e5                	mov    %esp,%ebp
+  80151d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801520:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801523:	50                   	push   %eax
+  801524:	ff 75 08             	push   0x8(%ebp)
+  801527:	e8 c4 fe ff ff       	call   8013f0 <fd_lookup>
+  80152c:	83 c4 10             	add    $0x10,%esp
+  80152f:	85 c0                	test   %eax,%eax
+  801531:	79 02                	jns    801535 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801533:	c9                   	leave
+  801534:	c3                   	ret
+		return fd_close(fd, 1);
+  801535:	83 ec 08             	sub    $0x8,%esp
+  801538:	6a 01                	push   $0x1
+  80153a:	ff 75 f4             	push   -0xc(%ebp)
+  80153d:	e8 51 ff ff ff       	call   801493 <fd_close>
+  801542:	83 c4 10             	add    $0x10,%esp
+  801545:	eb ec                	jmp    801533 <close+0x19>
+
+00801547 <close_all>:
+
+void
+close_all(void)
+{
+  801547:	55                   	push   %ebp
+  801548:	89 e5                	mov    %esp,%ebp
+  80154a:	53                   	push   %ebx
+  80154b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80154e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801553:	83 ec 0c             	sub    $0xc,%esp
+  801556:	53                   	push   %ebx
+  801557:	e8 be ff ff ff       	call   80151a <close>
+	for (i = 0; i < MAXFD; i++)
+  80155c:	83 c3 01             	add    $0x1,%ebx
+  80155f:	83 c4 10             	add    $0x10,%esp
+  801562:	83 fb 20             	cmp    $0x20,%ebx
+  801565:	75 ec                	jne    801553 <close_all+0xc>
+}
+  801567:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80156a:	c9                   	leave
+  80156b:	c3                   	ret
+
+0080156c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80156c:	55                   	push   %ebp
+  80156d:	89 e5                	mov    %esp,%ebp
+  80156f:	57                   	push   %edi
+  801570:	56                   	push   %esi
+  801571:	53                   	push   %ebx
+  801572:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801575:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801578:	50                   	push   %eax
+  801579:	ff 75 08             	push   0x8(%ebp)
+  80157c:	e8 6f fe ff ff       	call   8013f0 <fd_lookup>
+  801581:	89 c3                	mov    %eax,%ebx
+  801583:	83 c4 10             	add    $0x10,%esp
+  801586:	85 c0                	test   %eax,%eax
+  801588:	78 7f                	js     801609 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80158a:	83 ec 0c             	sub    $0xc,%esp
+  80158d:	ff 75 0c             	push   0xc(%ebp)
+  801590:	e8 85 ff ff ff       	call   80151a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801595:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801598:	c1 e6 0c             	shl    $0xc,%esi
+  80159b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015a4:	89 3c 24             	mov    %edi,(%esp)
+  8015a7:	e8 d7 fd ff ff       	call   801383 <fd2data>
+  8015ac:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015ae:	89 34 24             	mov    %esi,(%esp)
+  8015b1:	e8 cd fd ff ff       	call   801383 <fd2data>
+  8015b6:	83 c4 10             	add    $0x10,%esp
+  8015b9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8015bc:	89 d8                	mov    %ebx,%eax
+  8015be:	c1 e8 16             	shr    $0x16,%eax
+  8015c1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015c8:	a8 01                	test   $0x1,%al
+  8015ca:	74 11                	je     8015dd <dup+0x71>
+  8015cc:	89 d8                	mov    %ebx,%eax
+  8015ce:	c1 e8 0c             	shr    $0xc,%eax
+  8015d1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015d8:	f6 c2 01             	test   $0x1,%dl
+  8015db:	75 36                	jne    801613 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015dd:	89 f8                	mov    %edi,%eax
+  8015df:	c1 e8 0c             	shr    $0xc,%eax
+  8015e2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015e9:	83 ec 0c             	sub    $0xc,%esp
+  8015ec:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015f1:	50                   	push   %eax
+  8015f2:	56                   	push   %esi
+  8015f3:	6a 00                	push   $0x0
+  8015f5:	57                   	push   %edi
+  8015f6:	6a 00                	push   $0x0
+  8015f8:	e8 d7 f9 ff ff       	call   800fd4 <sys_page_map>
+  8015fd:	89 c3                	mov    %eax,%ebx
+  8015ff:	83 c4 20             	add    $0x20,%esp
+  801602:	85 c0                	test   %eax,%eax
+  801604:	78 33                	js     801639 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801606:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801609:	89 d8                	mov    %ebx,%eax
+  80160b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160e:	5b                   	pop    %ebx
+  80160f:	5e                   	pop    %esi
+  801610:	5f                   	pop    %edi
+  801611:	5d                   	pop    %ebp
+  801612:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801613:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80161a:	83 ec 0c             	sub    $0xc,%esp
+  80161d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801622:	50                   	push   %eax
+  801623:	ff 75 d4             	push   -0x2c(%ebp)
+  801626:	6a 00                	push   $0x0
+  801628:	53                   	push   %ebx
+  801629:	6a 00                	push   $0x0
+  80162b:	e8 a4 f9 ff ff       	call   800fd4 <sys_page_map>
+  801630:	89 c3                	mov    %eax,%ebx
+  801632:	83 c4 20             	add    $0x20,%esp
+  801635:	85 c0                	test   %eax,%eax
+  801637:	79 a4                	jns    8015dd <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801639:	83 ec 08             	sub    $0x8,%esp
+  80163c:	56                   	push   %esi
+  80163d:	6a 00                	push   $0x0
+  80163f:	e8 d2 f9 ff ff       	call   801016 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801644:	83 c4 08             	add    $0x8,%esp
+  801647:	ff 75 d4             	push   -0x2c(%ebp)
+  80164a:	6a 00                	push   $0x0
+  80164c:	e8 c5 f9 ff ff       	call   801016 <sys_page_unmap>
+	return r;
+  801651:	83 c4 10             	add    $0x10,%esp
+  801654:	eb b3                	jmp    801609 <dup+0x9d>
+
+00801656 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801656:	55                   	push   %ebp
+  801657:	89 e5                	mov    %esp,%ebp
+  801659:	56                   	push   %esi
+  80165a:	53                   	push   %ebx
+  80165b:	83 ec 18             	sub    $0x18,%esp
+  80165e:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801661:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801664:	50                   	push   %eax
+  801665:	56                   	push   %esi
+  801666:	e8 85 fd ff ff       	call   8013f0 <fd_lookup>
+  80166b:	83 c4 10             	add    $0x10,%esp
+  80166e:	85 c0                	test   %eax,%eax
+  801670:	78 3c                	js     8016ae <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801672:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801675:	83 ec 08             	sub    $0x8,%esp
+  801678:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80167b:	50                   	push   %eax
+  80167c:	ff 33                	push   (%ebx)
+  80167e:	e8 bd fd ff ff       	call   801440 <dev_lookup>
+  801683:	83 c4 10             	add    $0x10,%esp
+  801686:	85 c0                	test   %eax,%eax
+  801688:	78 24                	js     8016ae <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80168a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80168d:	83 e0 03             	and    $0x3,%eax
+  801690:	83 f8 01             	cmp    $0x1,%eax
+  801693:	74 20                	je     8016b5 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801695:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801698:	8b 40 08             	mov    0x8(%eax),%eax
+  80169b:	85 c0                	test   %eax,%eax
+  80169d:	74 37                	je     8016d6 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80169f:	83 ec 04             	sub    $0x4,%esp
+  8016a2:	ff 75 10             	push   0x10(%ebp)
+  8016a5:	ff 75 0c             	push   0xc(%ebp)
+  8016a8:	53                   	push   %ebx
+  8016a9:	ff d0                	call   *%eax
+  8016ab:	83 c4 10             	add    $0x10,%esp
+}
+  8016ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016b1:	5b                   	pop    %ebx
+  8016b2:	5e                   	pop    %esi
+  8016b3:	5d                   	pop    %ebp
+  8016b4:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016b5:	a1 08 50 80 00       	mov    0x805008,%eax
+  8016ba:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8016bd:	83 ec 04             	sub    $0x4,%esp
+  8016c0:	56                   	push   %esi
+  8016c1:	50                   	push   %eax
+  8016c2:	68 8d 30 80 00       	push   $0x80308d
+  8016c7:	e8 27 ee ff ff       	call   8004f3 <cprintf>
+		return -E_INVAL;
+  8016cc:	83 c4 10             	add    $0x10,%esp
+  8016cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d4:	eb d8                	jmp    8016ae <read+0x58>
+		return -E_NOT_SUPP;
+  8016d6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016db:	eb d1                	jmp    8016ae <read+0x58>
+
+008016dd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016dd:	55                   	push   %ebp
+  8016de:	89 e5                	mov    %esp,%ebp
+  8016e0:	57                   	push   %edi
+  8016e1:	56                   	push   %esi
+  8016e2:	53                   	push   %ebx
+  8016e3:	83 ec 0c             	sub    $0xc,%esp
+  8016e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016e9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f1:	eb 02                	jmp    8016f5 <readn+0x18>
+  8016f3:	01 c3                	add    %eax,%ebx
+  8016f5:	39 f3                	cmp    %esi,%ebx
+  8016f7:	73 21                	jae    80171a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016f9:	83 ec 04             	sub    $0x4,%esp
+  8016fc:	89 f0                	mov    %esi,%eax
+  8016fe:	29 d8                	sub    %ebx,%eax
+  801700:	50                   	push   %eax
+  801701:	89 d8                	mov    %ebx,%eax
+  801703:	03 45 0c             	add    0xc(%ebp),%eax
+  801706:	50                   	push   %eax
+  801707:	57                   	push   %edi
+  801708:	e8 49 ff ff ff       	call   801656 <read>
+		if (m < 0)
+  80170d:	83 c4 10             	add    $0x10,%esp
+  801710:	85 c0                	test   %eax,%eax
+  801712:	78 04                	js     801718 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801714:	75 dd                	jne    8016f3 <readn+0x16>
+  801716:	eb 02                	jmp    80171a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801718:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80171a:	89 d8                	mov    %ebx,%eax
+  80171c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80171f:	5b                   	pop    %ebx
+  801720:	5e                   	pop    %esi
+  801721:	5f                   	pop    %edi
+  801722:	5d                   	pop    %ebp
+  801723:	c3                   	ret
+
+00801724 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801724:	55                   	push   %ebp
+  801725:	89 e5                	mov    %esp,%ebp
+  801727:	56                   	push   %esi
+  801728:	53                   	push   %ebx
+  801729:	83 ec 18             	sub    $0x18,%esp
+  80172c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80172f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801732:	50                   	push   %eax
+  801733:	53                   	push   %ebx
+  801734:	e8 b7 fc ff ff       	call   8013f0 <fd_lookup>
+  801739:	83 c4 10             	add    $0x10,%esp
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	78 37                	js     801777 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801740:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801743:	83 ec 08             	sub    $0x8,%esp
+  801746:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801749:	50                   	push   %eax
+  80174a:	ff 36                	push   (%esi)
+  80174c:	e8 ef fc ff ff       	call   801440 <dev_lookup>
+  801751:	83 c4 10             	add    $0x10,%esp
+  801754:	85 c0                	test   %eax,%eax
+  801756:	78 1f                	js     801777 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801758:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80175c:	74 20                	je     80177e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80175e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801761:	8b 40 0c             	mov    0xc(%eax),%eax
+  801764:	85 c0                	test   %eax,%eax
+  801766:	74 37                	je     80179f <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801768:	83 ec 04             	sub    $0x4,%esp
+  80176b:	ff 75 10             	push   0x10(%ebp)
+  80176e:	ff 75 0c             	push   0xc(%ebp)
+  801771:	56                   	push   %esi
+  801772:	ff d0                	call   *%eax
+  801774:	83 c4 10             	add    $0x10,%esp
+}
+  801777:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80177a:	5b                   	pop    %ebx
+  80177b:	5e                   	pop    %esi
+  80177c:	5d                   	pop    %ebp
+  80177d:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80177e:	a1 08 50 80 00       	mov    0x805008,%eax
+  801783:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801786:	83 ec 04             	sub    $0x4,%esp
+  801789:	53                   	push   %ebx
+  80178a:	50                   	push   %eax
+  80178b:	68 a9 30 80 00       	push   $0x8030a9
+  801790:	e8 5e ed ff ff       	call   8004f3 <cprintf>
+		return -E_INVAL;
+  801795:	83 c4 10             	add    $0x10,%esp
+  801798:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80179d:	eb d8                	jmp    801777 <write+0x53>
+		return -E_NOT_SUPP;
+  80179f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017a4:	eb d1                	jmp    801777 <write+0x53>
+
+008017a6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017a6:	55                   	push   %ebp
+  8017a7:	89 e5                	mov    %esp,%ebp
+  8017a9:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017af:	50                   	push   %eax
+  8017b0:	ff 75 08             	push   0x8(%ebp)
+  8017b3:	e8 38 fc ff ff       	call   8013f0 <fd_lookup>
+  8017b8:	83 c4 10             	add    $0x10,%esp
+  8017bb:	85 c0                	test   %eax,%eax
+  8017bd:	78 0e                	js     8017cd <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017c5:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017cd:	c9                   	leave
+  8017ce:	c3                   	ret
+
+008017cf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017cf:	55                   	push   %ebp
+  8017d0:	89 e5                	mov    %esp,%ebp
+  8017d2:	56                   	push   %esi
+  8017d3:	53                   	push   %ebx
+  8017d4:	83 ec 18             	sub    $0x18,%esp
+  8017d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017da:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017dd:	50                   	push   %eax
+  8017de:	53                   	push   %ebx
+  8017df:	e8 0c fc ff ff       	call   8013f0 <fd_lookup>
+  8017e4:	83 c4 10             	add    $0x10,%esp
+  8017e7:	85 c0                	test   %eax,%eax
+  8017e9:	78 34                	js     80181f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017eb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017ee:	83 ec 08             	sub    $0x8,%esp
+  8017f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f4:	50                   	push   %eax
+  8017f5:	ff 36                	push   (%esi)
+  8017f7:	e8 44 fc ff ff       	call   801440 <dev_lookup>
+  8017fc:	83 c4 10             	add    $0x10,%esp
+  8017ff:	85 c0                	test   %eax,%eax
+  801801:	78 1c                	js     80181f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801803:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801807:	74 1d                	je     801826 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801809:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180c:	8b 40 18             	mov    0x18(%eax),%eax
+  80180f:	85 c0                	test   %eax,%eax
+  801811:	74 34                	je     801847 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801813:	83 ec 08             	sub    $0x8,%esp
+  801816:	ff 75 0c             	push   0xc(%ebp)
+  801819:	56                   	push   %esi
+  80181a:	ff d0                	call   *%eax
+  80181c:	83 c4 10             	add    $0x10,%esp
+}
+  80181f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801822:	5b                   	pop    %ebx
+  801823:	5e                   	pop    %esi
+  801824:	5d                   	pop    %ebp
+  801825:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801826:	a1 08 50 80 00       	mov    0x805008,%eax
+  80182b:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80182e:	83 ec 04             	sub    $0x4,%esp
+  801831:	53                   	push   %ebx
+  801832:	50                   	push   %eax
+  801833:	68 6c 30 80 00       	push   $0x80306c
+  801838:	e8 b6 ec ff ff       	call   8004f3 <cprintf>
+		return -E_INVAL;
+  80183d:	83 c4 10             	add    $0x10,%esp
+  801840:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801845:	eb d8                	jmp    80181f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801847:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80184c:	eb d1                	jmp    80181f <ftruncate+0x50>
+
+0080184e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80184e:	55                   	push   %ebp
+  80184f:	89 e5                	mov    %esp,%ebp
+  801851:	56                   	push   %esi
+  801852:	53                   	push   %ebx
+  801853:	83 ec 18             	sub    $0x18,%esp
+  801856:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801859:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80185c:	50                   	push   %eax
+  80185d:	ff 75 08             	push   0x8(%ebp)
+  801860:	e8 8b fb ff ff       	call   8013f0 <fd_lookup>
+  801865:	83 c4 10             	add    $0x10,%esp
+  801868:	85 c0                	test   %eax,%eax
+  80186a:	78 49                	js     8018b5 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80186c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80186f:	83 ec 08             	sub    $0x8,%esp
+  801872:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801875:	50                   	push   %eax
+  801876:	ff 36                	push   (%esi)
+  801878:	e8 c3 fb ff ff       	call   801440 <dev_lookup>
+  80187d:	83 c4 10             	add    $0x10,%esp
+  801880:	85 c0                	test   %eax,%eax
+  801882:	78 31                	js     8018b5 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801884:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801887:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80188b:	74 2f                	je     8018bc <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80188d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801890:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801897:	00 00 00 
+	stat->st_isdir = 0;
+  80189a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018a1:	00 00 00 
+	stat->st_dev = dev;
+  8018a4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018aa:	83 ec 08             	sub    $0x8,%esp
+  8018ad:	53                   	push   %ebx
+  8018ae:	56                   	push   %esi
+  8018af:	ff 50 14             	call   *0x14(%eax)
+  8018b2:	83 c4 10             	add    $0x10,%esp
+}
+  8018b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b8:	5b                   	pop    %ebx
+  8018b9:	5e                   	pop    %esi
+  8018ba:	5d                   	pop    %ebp
+  8018bb:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018bc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018c1:	eb f2                	jmp    8018b5 <fstat+0x67>
+
+008018c3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018c3:	55                   	push   %ebp
+  8018c4:	89 e5                	mov    %esp,%ebp
+  8018c6:	56                   	push   %esi
+  8018c7:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018c8:	83 ec 08             	sub    $0x8,%esp
+  8018cb:	6a 00                	push   $0x0
+  8018cd:	ff 75 08             	push   0x8(%ebp)
+  8018d0:	e8 e4 01 00 00       	call   801ab9 <open>
+  8018d5:	89 c3                	mov    %eax,%ebx
+  8018d7:	83 c4 10             	add    $0x10,%esp
+  8018da:	85 c0                	test   %eax,%eax
+  8018dc:	78 1b                	js     8018f9 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018de:	83 ec 08             	sub    $0x8,%esp
+  8018e1:	ff 75 0c             	push   0xc(%ebp)
+  8018e4:	50                   	push   %eax
+  8018e5:	e8 64 ff ff ff       	call   80184e <fstat>
+  8018ea:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018ec:	89 1c 24             	mov    %ebx,(%esp)
+  8018ef:	e8 26 fc ff ff       	call   80151a <close>
+	return r;
+  8018f4:	83 c4 10             	add    $0x10,%esp
+  8018f7:	89 f3                	mov    %esi,%ebx
+}
+  8018f9:	89 d8                	mov    %ebx,%eax
+  8018fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018fe:	5b                   	pop    %ebx
+  8018ff:	5e                   	pop    %esi
+  801900:	5d                   	pop    %ebp
+  801901:	c3                   	ret
+
+00801902 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801902:	55                   	push   %ebp
+  801903:	89 e5                	mov    %esp,%ebp
+  801905:	56                   	push   %esi
+  801906:	53                   	push   %ebx
+  801907:	89 c6                	mov    %eax,%esi
+  801909:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80190b:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801912:	74 27                	je     80193b <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801914:	6a 07                	push   $0x7
+  801916:	68 00 60 80 00       	push   $0x806000
+  80191b:	56                   	push   %esi
+  80191c:	ff 35 00 50 80 00    	push   0x805000
+  801922:	e8 d5 0b 00 00       	call   8024fc <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801927:	83 c4 0c             	add    $0xc,%esp
+  80192a:	6a 00                	push   $0x0
+  80192c:	53                   	push   %ebx
+  80192d:	6a 00                	push   $0x0
+  80192f:	e8 50 0b 00 00       	call   802484 <ipc_recv>
+}
+  801934:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801937:	5b                   	pop    %ebx
+  801938:	5e                   	pop    %esi
+  801939:	5d                   	pop    %ebp
+  80193a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80193b:	83 ec 0c             	sub    $0xc,%esp
+  80193e:	6a 01                	push   $0x1
+  801940:	e8 0b 0c 00 00       	call   802550 <ipc_find_env>
+  801945:	a3 00 50 80 00       	mov    %eax,0x805000
+  80194a:	83 c4 10             	add    $0x10,%esp
+  80194d:	eb c5                	jmp    801914 <fsipc+0x12>
+
+0080194f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80194f:	55                   	push   %ebp
+  801950:	89 e5                	mov    %esp,%ebp
+  801952:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801955:	8b 45 08             	mov    0x8(%ebp),%eax
+  801958:	8b 40 0c             	mov    0xc(%eax),%eax
+  80195b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801960:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801963:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801968:	ba 00 00 00 00       	mov    $0x0,%edx
+  80196d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801972:	e8 8b ff ff ff       	call   801902 <fsipc>
+}
+  801977:	c9                   	leave
+  801978:	c3                   	ret
+
+00801979 <devfile_flush>:
+{
+  801979:	55                   	push   %ebp
+  80197a:	89 e5                	mov    %esp,%ebp
+  80197c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80197f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801982:	8b 40 0c             	mov    0xc(%eax),%eax
+  801985:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80198a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80198f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801994:	e8 69 ff ff ff       	call   801902 <fsipc>
+}
+  801999:	c9                   	leave
+  80199a:	c3                   	ret
+
+0080199b <devfile_stat>:
+{
+  80199b:	55                   	push   %ebp
+  80199c:	89 e5                	mov    %esp,%ebp
+  80199e:	53                   	push   %ebx
+  80199f:	83 ec 04             	sub    $0x4,%esp
+  8019a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ab:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019ba:	e8 43 ff ff ff       	call   801902 <fsipc>
+  8019bf:	85 c0                	test   %eax,%eax
+  8019c1:	78 2c                	js     8019ef <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019c3:	83 ec 08             	sub    $0x8,%esp
+  8019c6:	68 00 60 80 00       	push   $0x806000
+  8019cb:	53                   	push   %ebx
+  8019cc:	e8 10 f1 ff ff       	call   800ae1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019d1:	a1 80 60 80 00       	mov    0x806080,%eax
+  8019d6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019dc:	a1 84 60 80 00       	mov    0x806084,%eax
+  8019e1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8019e7:	83 c4 10             	add    $0x10,%esp
+  8019ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f2:	c9                   	leave
+  8019f3:	c3                   	ret
+
+008019f4 <devfile_write>:
+{
+  8019f4:	55                   	push   %ebp
+  8019f5:	89 e5                	mov    %esp,%ebp
+  8019f7:	83 ec 0c             	sub    $0xc,%esp
+  8019fa:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8019fd:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a02:	39 d0                	cmp    %edx,%eax
+  801a04:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a07:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a0a:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a0d:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801a13:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a18:	50                   	push   %eax
+  801a19:	ff 75 0c             	push   0xc(%ebp)
+  801a1c:	68 08 60 80 00       	push   $0x806008
+  801a21:	e8 41 f2 ff ff       	call   800c67 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a30:	e8 cd fe ff ff       	call   801902 <fsipc>
+}
+  801a35:	c9                   	leave
+  801a36:	c3                   	ret
+
+00801a37 <devfile_read>:
+{
+  801a37:	55                   	push   %ebp
+  801a38:	89 e5                	mov    %esp,%ebp
+  801a3a:	56                   	push   %esi
+  801a3b:	53                   	push   %ebx
+  801a3c:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a42:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a45:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801a4a:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a55:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a5a:	e8 a3 fe ff ff       	call   801902 <fsipc>
+  801a5f:	89 c3                	mov    %eax,%ebx
+  801a61:	85 c0                	test   %eax,%eax
+  801a63:	78 1f                	js     801a84 <devfile_read+0x4d>
+	assert(r <= n);
+  801a65:	39 c6                	cmp    %eax,%esi
+  801a67:	72 24                	jb     801a8d <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801a69:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a6e:	7f 33                	jg     801aa3 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a70:	83 ec 04             	sub    $0x4,%esp
+  801a73:	50                   	push   %eax
+  801a74:	68 00 60 80 00       	push   $0x806000
+  801a79:	ff 75 0c             	push   0xc(%ebp)
+  801a7c:	e8 e6 f1 ff ff       	call   800c67 <memmove>
+	return r;
+  801a81:	83 c4 10             	add    $0x10,%esp
+}
+  801a84:	89 d8                	mov    %ebx,%eax
+  801a86:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a89:	5b                   	pop    %ebx
+  801a8a:	5e                   	pop    %esi
+  801a8b:	5d                   	pop    %ebp
+  801a8c:	c3                   	ret
+	assert(r <= n);
+  801a8d:	68 dc 30 80 00       	push   $0x8030dc
+  801a92:	68 e3 30 80 00       	push   $0x8030e3
+  801a97:	6a 7c                	push   $0x7c
+  801a99:	68 f8 30 80 00       	push   $0x8030f8
+  801a9e:	e8 75 e9 ff ff       	call   800418 <_panic>
+	assert(r <= PGSIZE);
+  801aa3:	68 03 31 80 00       	push   $0x803103
+  801aa8:	68 e3 30 80 00       	push   $0x8030e3
+  801aad:	6a 7d                	push   $0x7d
+  801aaf:	68 f8 30 80 00       	push   $0x8030f8
+  801ab4:	e8 5f e9 ff ff       	call   800418 <_panic>
+
+00801ab9 <open>:
+{
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+  801abc:	56                   	push   %esi
+  801abd:	53                   	push   %ebx
+  801abe:	83 ec 1c             	sub    $0x1c,%esp
+  801ac1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ac4:	56                   	push   %esi
+  801ac5:	e8 dc ef ff ff       	call   800aa6 <strlen>
+  801aca:	83 c4 10             	add    $0x10,%esp
+  801acd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ad2:	7f 6c                	jg     801b40 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801ad4:	83 ec 0c             	sub    $0xc,%esp
+  801ad7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ada:	50                   	push   %eax
+  801adb:	e8 ba f8 ff ff       	call   80139a <fd_alloc>
+  801ae0:	89 c3                	mov    %eax,%ebx
+  801ae2:	83 c4 10             	add    $0x10,%esp
+  801ae5:	85 c0                	test   %eax,%eax
+  801ae7:	78 3c                	js     801b25 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801ae9:	83 ec 08             	sub    $0x8,%esp
+  801aec:	56                   	push   %esi
+  801aed:	68 00 60 80 00       	push   $0x806000
+  801af2:	e8 ea ef ff ff       	call   800ae1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801af7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801afa:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801aff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b02:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b07:	e8 f6 fd ff ff       	call   801902 <fsipc>
+  801b0c:	89 c3                	mov    %eax,%ebx
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	78 19                	js     801b2e <open+0x75>
+	return fd2num(fd);
+  801b15:	83 ec 0c             	sub    $0xc,%esp
+  801b18:	ff 75 f4             	push   -0xc(%ebp)
+  801b1b:	e8 53 f8 ff ff       	call   801373 <fd2num>
+  801b20:	89 c3                	mov    %eax,%ebx
+  801b22:	83 c4 10             	add    $0x10,%esp
+}
+  801b25:	89 d8                	mov    %ebx,%eax
+  801b27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b2a:	5b                   	pop    %ebx
+  801b2b:	5e                   	pop    %esi
+  801b2c:	5d                   	pop    %ebp
+  801b2d:	c3                   	ret
+		fd_close(fd, 0);
+  801b2e:	83 ec 08             	sub    $0x8,%esp
+  801b31:	6a 00                	push   $0x0
+  801b33:	ff 75 f4             	push   -0xc(%ebp)
+  801b36:	e8 58 f9 ff ff       	call   801493 <fd_close>
+		return r;
+  801b3b:	83 c4 10             	add    $0x10,%esp
+  801b3e:	eb e5                	jmp    801b25 <open+0x6c>
+		return -E_BAD_PATH;
+  801b40:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b45:	eb de                	jmp    801b25 <open+0x6c>
+
+00801b47 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b47:	55                   	push   %ebp
+  801b48:	89 e5                	mov    %esp,%ebp
+  801b4a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b52:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b57:	e8 a6 fd ff ff       	call   801902 <fsipc>
+}
+  801b5c:	c9                   	leave
+  801b5d:	c3                   	ret
+
+00801b5e <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b5e:	55                   	push   %ebp
+  801b5f:	89 e5                	mov    %esp,%ebp
+  801b61:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801b64:	68 0f 31 80 00       	push   $0x80310f
+  801b69:	ff 75 0c             	push   0xc(%ebp)
+  801b6c:	e8 70 ef ff ff       	call   800ae1 <strcpy>
+	return 0;
+}
+  801b71:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b76:	c9                   	leave
+  801b77:	c3                   	ret
+
+00801b78 <devsock_close>:
+{
+  801b78:	55                   	push   %ebp
+  801b79:	89 e5                	mov    %esp,%ebp
+  801b7b:	53                   	push   %ebx
+  801b7c:	83 ec 10             	sub    $0x10,%esp
+  801b7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801b82:	53                   	push   %ebx
+  801b83:	e8 d8 09 00 00       	call   802560 <pageref>
+  801b88:	89 c2                	mov    %eax,%edx
+  801b8a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801b92:	83 fa 01             	cmp    $0x1,%edx
+  801b95:	74 05                	je     801b9c <devsock_close+0x24>
+}
+  801b97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b9a:	c9                   	leave
+  801b9b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801b9c:	83 ec 0c             	sub    $0xc,%esp
+  801b9f:	ff 73 0c             	push   0xc(%ebx)
+  801ba2:	e8 b7 02 00 00       	call   801e5e <nsipc_close>
+  801ba7:	83 c4 10             	add    $0x10,%esp
+  801baa:	eb eb                	jmp    801b97 <devsock_close+0x1f>
+
+00801bac <devsock_write>:
+{
+  801bac:	55                   	push   %ebp
+  801bad:	89 e5                	mov    %esp,%ebp
+  801baf:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801bb2:	6a 00                	push   $0x0
+  801bb4:	ff 75 10             	push   0x10(%ebp)
+  801bb7:	ff 75 0c             	push   0xc(%ebp)
+  801bba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bbd:	ff 70 0c             	push   0xc(%eax)
+  801bc0:	e8 79 03 00 00       	call   801f3e <nsipc_send>
+}
+  801bc5:	c9                   	leave
+  801bc6:	c3                   	ret
+
+00801bc7 <devsock_read>:
+{
+  801bc7:	55                   	push   %ebp
+  801bc8:	89 e5                	mov    %esp,%ebp
+  801bca:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801bcd:	6a 00                	push   $0x0
+  801bcf:	ff 75 10             	push   0x10(%ebp)
+  801bd2:	ff 75 0c             	push   0xc(%ebp)
+  801bd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd8:	ff 70 0c             	push   0xc(%eax)
+  801bdb:	e8 ef 02 00 00       	call   801ecf <nsipc_recv>
+}
+  801be0:	c9                   	leave
+  801be1:	c3                   	ret
+
+00801be2 <fd2sockid>:
+{
+  801be2:	55                   	push   %ebp
+  801be3:	89 e5                	mov    %esp,%ebp
+  801be5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801be8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801beb:	52                   	push   %edx
+  801bec:	50                   	push   %eax
+  801bed:	e8 fe f7 ff ff       	call   8013f0 <fd_lookup>
+  801bf2:	83 c4 10             	add    $0x10,%esp
+  801bf5:	85 c0                	test   %eax,%eax
+  801bf7:	78 10                	js     801c09 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801bf9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bfc:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801c02:	39 08                	cmp    %ecx,(%eax)
+  801c04:	75 05                	jne    801c0b <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801c06:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801c09:	c9                   	leave
+  801c0a:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c0b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c10:	eb f7                	jmp    801c09 <fd2sockid+0x27>
+
+00801c12 <alloc_sockfd>:
+{
+  801c12:	55                   	push   %ebp
+  801c13:	89 e5                	mov    %esp,%ebp
+  801c15:	56                   	push   %esi
+  801c16:	53                   	push   %ebx
+  801c17:	83 ec 1c             	sub    $0x1c,%esp
+  801c1a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801c1c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c1f:	50                   	push   %eax
+  801c20:	e8 75 f7 ff ff       	call   80139a <fd_alloc>
+  801c25:	89 c3                	mov    %eax,%ebx
+  801c27:	83 c4 10             	add    $0x10,%esp
+  801c2a:	85 c0                	test   %eax,%eax
+  801c2c:	78 43                	js     801c71 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801c2e:	83 ec 04             	sub    $0x4,%esp
+  801c31:	68 07 04 00 00       	push   $0x407
+  801c36:	ff 75 f4             	push   -0xc(%ebp)
+  801c39:	6a 00                	push   $0x0
+  801c3b:	e8 0e f3 ff ff       	call   800f4e <sys_page_alloc>
+  801c40:	89 c3                	mov    %eax,%ebx
+  801c42:	83 c4 10             	add    $0x10,%esp
+  801c45:	85 c0                	test   %eax,%eax
+  801c47:	78 28                	js     801c71 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801c49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c4c:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801c52:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801c54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c57:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801c5e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801c61:	83 ec 0c             	sub    $0xc,%esp
+  801c64:	50                   	push   %eax
+  801c65:	e8 09 f7 ff ff       	call   801373 <fd2num>
+  801c6a:	89 c3                	mov    %eax,%ebx
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	eb 0c                	jmp    801c7d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801c71:	83 ec 0c             	sub    $0xc,%esp
+  801c74:	56                   	push   %esi
+  801c75:	e8 e4 01 00 00       	call   801e5e <nsipc_close>
+		return r;
+  801c7a:	83 c4 10             	add    $0x10,%esp
+}
+  801c7d:	89 d8                	mov    %ebx,%eax
+  801c7f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c82:	5b                   	pop    %ebx
+  801c83:	5e                   	pop    %esi
+  801c84:	5d                   	pop    %ebp
+  801c85:	c3                   	ret
+
+00801c86 <accept>:
+{
+  801c86:	55                   	push   %ebp
+  801c87:	89 e5                	mov    %esp,%ebp
+  801c89:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c8f:	e8 4e ff ff ff       	call   801be2 <fd2sockid>
+  801c94:	85 c0                	test   %eax,%eax
+  801c96:	78 1b                	js     801cb3 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801c98:	83 ec 04             	sub    $0x4,%esp
+  801c9b:	ff 75 10             	push   0x10(%ebp)
+  801c9e:	ff 75 0c             	push   0xc(%ebp)
+  801ca1:	50                   	push   %eax
+  801ca2:	e8 0e 01 00 00       	call   801db5 <nsipc_accept>
+  801ca7:	83 c4 10             	add    $0x10,%esp
+  801caa:	85 c0                	test   %eax,%eax
+  801cac:	78 05                	js     801cb3 <accept+0x2d>
+	return alloc_sockfd(r);
+  801cae:	e8 5f ff ff ff       	call   801c12 <alloc_sockfd>
+}
+  801cb3:	c9                   	leave
+  801cb4:	c3                   	ret
+
+00801cb5 <bind>:
+{
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbe:	e8 1f ff ff ff       	call   801be2 <fd2sockid>
+  801cc3:	85 c0                	test   %eax,%eax
+  801cc5:	78 12                	js     801cd9 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801cc7:	83 ec 04             	sub    $0x4,%esp
+  801cca:	ff 75 10             	push   0x10(%ebp)
+  801ccd:	ff 75 0c             	push   0xc(%ebp)
+  801cd0:	50                   	push   %eax
+  801cd1:	e8 31 01 00 00       	call   801e07 <nsipc_bind>
+  801cd6:	83 c4 10             	add    $0x10,%esp
+}
+  801cd9:	c9                   	leave
+  801cda:	c3                   	ret
+
+00801cdb <shutdown>:
+{
+  801cdb:	55                   	push   %ebp
+  801cdc:	89 e5                	mov    %esp,%ebp
+  801cde:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce4:	e8 f9 fe ff ff       	call   801be2 <fd2sockid>
+  801ce9:	85 c0                	test   %eax,%eax
+  801ceb:	78 0f                	js     801cfc <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801ced:	83 ec 08             	sub    $0x8,%esp
+  801cf0:	ff 75 0c             	push   0xc(%ebp)
+  801cf3:	50                   	push   %eax
+  801cf4:	e8 43 01 00 00       	call   801e3c <nsipc_shutdown>
+  801cf9:	83 c4 10             	add    $0x10,%esp
+}
+  801cfc:	c9                   	leave
+  801cfd:	c3                   	ret
+
+00801cfe <connect>:
+{
+  801cfe:	55                   	push   %ebp
+  801cff:	89 e5                	mov    %esp,%ebp
+  801d01:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d04:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d07:	e8 d6 fe ff ff       	call   801be2 <fd2sockid>
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	78 12                	js     801d22 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801d10:	83 ec 04             	sub    $0x4,%esp
+  801d13:	ff 75 10             	push   0x10(%ebp)
+  801d16:	ff 75 0c             	push   0xc(%ebp)
+  801d19:	50                   	push   %eax
+  801d1a:	e8 59 01 00 00       	call   801e78 <nsipc_connect>
+  801d1f:	83 c4 10             	add    $0x10,%esp
+}
+  801d22:	c9                   	leave
+  801d23:	c3                   	ret
+
+00801d24 <listen>:
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d2d:	e8 b0 fe ff ff       	call   801be2 <fd2sockid>
+  801d32:	85 c0                	test   %eax,%eax
+  801d34:	78 0f                	js     801d45 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801d36:	83 ec 08             	sub    $0x8,%esp
+  801d39:	ff 75 0c             	push   0xc(%ebp)
+  801d3c:	50                   	push   %eax
+  801d3d:	e8 6b 01 00 00       	call   801ead <nsipc_listen>
+  801d42:	83 c4 10             	add    $0x10,%esp
+}
+  801d45:	c9                   	leave
+  801d46:	c3                   	ret
+
+00801d47 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801d47:	55                   	push   %ebp
+  801d48:	89 e5                	mov    %esp,%ebp
+  801d4a:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801d4d:	ff 75 10             	push   0x10(%ebp)
+  801d50:	ff 75 0c             	push   0xc(%ebp)
+  801d53:	ff 75 08             	push   0x8(%ebp)
+  801d56:	e8 41 02 00 00       	call   801f9c <nsipc_socket>
+  801d5b:	83 c4 10             	add    $0x10,%esp
+  801d5e:	85 c0                	test   %eax,%eax
+  801d60:	78 05                	js     801d67 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801d62:	e8 ab fe ff ff       	call   801c12 <alloc_sockfd>
+}
+  801d67:	c9                   	leave
+  801d68:	c3                   	ret
+
+00801d69 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801d69:	55                   	push   %ebp
+  801d6a:	89 e5                	mov    %esp,%ebp
+  801d6c:	53                   	push   %ebx
+  801d6d:	83 ec 04             	sub    $0x4,%esp
+  801d70:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801d72:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801d79:	74 26                	je     801da1 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801d7b:	6a 07                	push   $0x7
+  801d7d:	68 00 70 80 00       	push   $0x807000
+  801d82:	53                   	push   %ebx
+  801d83:	ff 35 04 50 80 00    	push   0x805004
+  801d89:	e8 6e 07 00 00       	call   8024fc <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801d8e:	83 c4 0c             	add    $0xc,%esp
+  801d91:	6a 00                	push   $0x0
+  801d93:	6a 00                	push   $0x0
+  801d95:	6a 00                	push   $0x0
+  801d97:	e8 e8 06 00 00       	call   802484 <ipc_recv>
+}
+  801d9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d9f:	c9                   	leave
+  801da0:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801da1:	83 ec 0c             	sub    $0xc,%esp
+  801da4:	6a 02                	push   $0x2
+  801da6:	e8 a5 07 00 00       	call   802550 <ipc_find_env>
+  801dab:	a3 04 50 80 00       	mov    %eax,0x805004
+  801db0:	83 c4 10             	add    $0x10,%esp
+  801db3:	eb c6                	jmp    801d7b <nsipc+0x12>
+
+00801db5 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	56                   	push   %esi
+  801db9:	53                   	push   %ebx
+  801dba:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801dbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801dc5:	8b 06                	mov    (%esi),%eax
+  801dc7:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801dcc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dd1:	e8 93 ff ff ff       	call   801d69 <nsipc>
+  801dd6:	89 c3                	mov    %eax,%ebx
+  801dd8:	85 c0                	test   %eax,%eax
+  801dda:	79 09                	jns    801de5 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801ddc:	89 d8                	mov    %ebx,%eax
+  801dde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de1:	5b                   	pop    %ebx
+  801de2:	5e                   	pop    %esi
+  801de3:	5d                   	pop    %ebp
+  801de4:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801de5:	83 ec 04             	sub    $0x4,%esp
+  801de8:	ff 35 10 70 80 00    	push   0x807010
+  801dee:	68 00 70 80 00       	push   $0x807000
+  801df3:	ff 75 0c             	push   0xc(%ebp)
+  801df6:	e8 6c ee ff ff       	call   800c67 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801dfb:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e00:	89 06                	mov    %eax,(%esi)
+  801e02:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801e05:	eb d5                	jmp    801ddc <nsipc_accept+0x27>
+
+00801e07 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801e07:	55                   	push   %ebp
+  801e08:	89 e5                	mov    %esp,%ebp
+  801e0a:	53                   	push   %ebx
+  801e0b:	83 ec 08             	sub    $0x8,%esp
+  801e0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801e11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e14:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801e19:	53                   	push   %ebx
+  801e1a:	ff 75 0c             	push   0xc(%ebp)
+  801e1d:	68 04 70 80 00       	push   $0x807004
+  801e22:	e8 40 ee ff ff       	call   800c67 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801e27:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801e2d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e32:	e8 32 ff ff ff       	call   801d69 <nsipc>
+}
+  801e37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e3a:	c9                   	leave
+  801e3b:	c3                   	ret
+
+00801e3c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801e3c:	55                   	push   %ebp
+  801e3d:	89 e5                	mov    %esp,%ebp
+  801e3f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801e42:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e45:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801e4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e4d:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801e52:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e57:	e8 0d ff ff ff       	call   801d69 <nsipc>
+}
+  801e5c:	c9                   	leave
+  801e5d:	c3                   	ret
+
+00801e5e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801e5e:	55                   	push   %ebp
+  801e5f:	89 e5                	mov    %esp,%ebp
+  801e61:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801e64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e67:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801e6c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e71:	e8 f3 fe ff ff       	call   801d69 <nsipc>
+}
+  801e76:	c9                   	leave
+  801e77:	c3                   	ret
+
+00801e78 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801e78:	55                   	push   %ebp
+  801e79:	89 e5                	mov    %esp,%ebp
+  801e7b:	53                   	push   %ebx
+  801e7c:	83 ec 08             	sub    $0x8,%esp
+  801e7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801e82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e85:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801e8a:	53                   	push   %ebx
+  801e8b:	ff 75 0c             	push   0xc(%ebp)
+  801e8e:	68 04 70 80 00       	push   $0x807004
+  801e93:	e8 cf ed ff ff       	call   800c67 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801e98:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801e9e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ea3:	e8 c1 fe ff ff       	call   801d69 <nsipc>
+}
+  801ea8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eab:	c9                   	leave
+  801eac:	c3                   	ret
+
+00801ead <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801ead:	55                   	push   %ebp
+  801eae:	89 e5                	mov    %esp,%ebp
+  801eb0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801eb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801ebb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ebe:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801ec3:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ec8:	e8 9c fe ff ff       	call   801d69 <nsipc>
+}
+  801ecd:	c9                   	leave
+  801ece:	c3                   	ret
+
+00801ecf <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801ecf:	55                   	push   %ebp
+  801ed0:	89 e5                	mov    %esp,%ebp
+  801ed2:	56                   	push   %esi
+  801ed3:	53                   	push   %ebx
+  801ed4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eda:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801edf:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801ee5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ee8:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801eed:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ef2:	e8 72 fe ff ff       	call   801d69 <nsipc>
+  801ef7:	89 c3                	mov    %eax,%ebx
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	78 22                	js     801f1f <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801efd:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801f02:	39 c6                	cmp    %eax,%esi
+  801f04:	0f 4e c6             	cmovle %esi,%eax
+  801f07:	39 c3                	cmp    %eax,%ebx
+  801f09:	7f 1d                	jg     801f28 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801f0b:	83 ec 04             	sub    $0x4,%esp
+  801f0e:	53                   	push   %ebx
+  801f0f:	68 00 70 80 00       	push   $0x807000
+  801f14:	ff 75 0c             	push   0xc(%ebp)
+  801f17:	e8 4b ed ff ff       	call   800c67 <memmove>
+  801f1c:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801f1f:	89 d8                	mov    %ebx,%eax
+  801f21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f24:	5b                   	pop    %ebx
+  801f25:	5e                   	pop    %esi
+  801f26:	5d                   	pop    %ebp
+  801f27:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801f28:	68 1b 31 80 00       	push   $0x80311b
+  801f2d:	68 e3 30 80 00       	push   $0x8030e3
+  801f32:	6a 62                	push   $0x62
+  801f34:	68 30 31 80 00       	push   $0x803130
+  801f39:	e8 da e4 ff ff       	call   800418 <_panic>
+
+00801f3e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801f3e:	55                   	push   %ebp
+  801f3f:	89 e5                	mov    %esp,%ebp
+  801f41:	53                   	push   %ebx
+  801f42:	83 ec 04             	sub    $0x4,%esp
+  801f45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801f48:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4b:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801f50:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801f56:	7f 2e                	jg     801f86 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801f58:	83 ec 04             	sub    $0x4,%esp
+  801f5b:	53                   	push   %ebx
+  801f5c:	ff 75 0c             	push   0xc(%ebp)
+  801f5f:	68 0c 70 80 00       	push   $0x80700c
+  801f64:	e8 fe ec ff ff       	call   800c67 <memmove>
+	nsipcbuf.send.req_size = size;
+  801f69:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801f6f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f72:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801f77:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f7c:	e8 e8 fd ff ff       	call   801d69 <nsipc>
+}
+  801f81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f84:	c9                   	leave
+  801f85:	c3                   	ret
+	assert(size < 1600);
+  801f86:	68 3c 31 80 00       	push   $0x80313c
+  801f8b:	68 e3 30 80 00       	push   $0x8030e3
+  801f90:	6a 6d                	push   $0x6d
+  801f92:	68 30 31 80 00       	push   $0x803130
+  801f97:	e8 7c e4 ff ff       	call   800418 <_panic>
+
+00801f9c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f9c:	55                   	push   %ebp
+  801f9d:	89 e5                	mov    %esp,%ebp
+  801f9f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801fa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801faa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fad:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801fb2:	8b 45 10             	mov    0x10(%ebp),%eax
+  801fb5:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801fba:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fbf:	e8 a5 fd ff ff       	call   801d69 <nsipc>
+}
+  801fc4:	c9                   	leave
+  801fc5:	c3                   	ret
+
+00801fc6 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801fc6:	55                   	push   %ebp
+  801fc7:	89 e5                	mov    %esp,%ebp
+  801fc9:	56                   	push   %esi
+  801fca:	53                   	push   %ebx
+  801fcb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801fce:	83 ec 0c             	sub    $0xc,%esp
+  801fd1:	ff 75 08             	push   0x8(%ebp)
+  801fd4:	e8 aa f3 ff ff       	call   801383 <fd2data>
+  801fd9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801fdb:	83 c4 08             	add    $0x8,%esp
+  801fde:	68 48 31 80 00       	push   $0x803148
+  801fe3:	53                   	push   %ebx
+  801fe4:	e8 f8 ea ff ff       	call   800ae1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801fe9:	8b 46 04             	mov    0x4(%esi),%eax
+  801fec:	2b 06                	sub    (%esi),%eax
+  801fee:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801ff4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ffb:	00 00 00 
+	stat->st_dev = &devpipe;
+  801ffe:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802005:	40 80 00 
+	return 0;
+}
+  802008:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802010:	5b                   	pop    %ebx
+  802011:	5e                   	pop    %esi
+  802012:	5d                   	pop    %ebp
+  802013:	c3                   	ret
+
+00802014 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802014:	55                   	push   %ebp
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	53                   	push   %ebx
+  802018:	83 ec 0c             	sub    $0xc,%esp
+  80201b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80201e:	53                   	push   %ebx
+  80201f:	6a 00                	push   $0x0
+  802021:	e8 f0 ef ff ff       	call   801016 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802026:	89 1c 24             	mov    %ebx,(%esp)
+  802029:	e8 55 f3 ff ff       	call   801383 <fd2data>
+  80202e:	83 c4 08             	add    $0x8,%esp
+  802031:	50                   	push   %eax
+  802032:	6a 00                	push   $0x0
+  802034:	e8 dd ef ff ff       	call   801016 <sys_page_unmap>
+}
+  802039:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80203c:	c9                   	leave
+  80203d:	c3                   	ret
+
+0080203e <_pipeisclosed>:
+{
+  80203e:	55                   	push   %ebp
+  80203f:	89 e5                	mov    %esp,%ebp
+  802041:	57                   	push   %edi
+  802042:	56                   	push   %esi
+  802043:	53                   	push   %ebx
+  802044:	83 ec 1c             	sub    $0x1c,%esp
+  802047:	89 c7                	mov    %eax,%edi
+  802049:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80204b:	a1 08 50 80 00       	mov    0x805008,%eax
+  802050:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802053:	83 ec 0c             	sub    $0xc,%esp
+  802056:	57                   	push   %edi
+  802057:	e8 04 05 00 00       	call   802560 <pageref>
+  80205c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80205f:	89 34 24             	mov    %esi,(%esp)
+  802062:	e8 f9 04 00 00       	call   802560 <pageref>
+		nn = thisenv->env_runs;
+  802067:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  80206d:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802070:	83 c4 10             	add    $0x10,%esp
+  802073:	39 cb                	cmp    %ecx,%ebx
+  802075:	74 1b                	je     802092 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802077:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80207a:	75 cf                	jne    80204b <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80207c:	8b 42 5c             	mov    0x5c(%edx),%eax
+  80207f:	6a 01                	push   $0x1
+  802081:	50                   	push   %eax
+  802082:	53                   	push   %ebx
+  802083:	68 4f 31 80 00       	push   $0x80314f
+  802088:	e8 66 e4 ff ff       	call   8004f3 <cprintf>
+  80208d:	83 c4 10             	add    $0x10,%esp
+  802090:	eb b9                	jmp    80204b <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802092:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802095:	0f 94 c0             	sete   %al
+  802098:	0f b6 c0             	movzbl %al,%eax
+}
+  80209b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80209e:	5b                   	pop    %ebx
+  80209f:	5e                   	pop    %esi
+  8020a0:	5f                   	pop    %edi
+  8020a1:	5d                   	pop    %ebp
+  8020a2:	c3                   	ret
+
+008020a3 <devpipe_write>:
+{
+  8020a3:	55                   	push   %ebp
+  8020a4:	89 e5                	mov    %esp,%ebp
+  8020a6:	57                   	push   %edi
+  8020a7:	56                   	push   %esi
+  8020a8:	53                   	push   %ebx
+  8020a9:	83 ec 28             	sub    $0x28,%esp
+  8020ac:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8020af:	56                   	push   %esi
+  8020b0:	e8 ce f2 ff ff       	call   801383 <fd2data>
+  8020b5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8020b7:	83 c4 10             	add    $0x10,%esp
+  8020ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020bf:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8020c2:	75 09                	jne    8020cd <devpipe_write+0x2a>
+	return i;
+  8020c4:	89 f8                	mov    %edi,%eax
+  8020c6:	eb 23                	jmp    8020eb <devpipe_write+0x48>
+			sys_yield();
+  8020c8:	e8 01 ee ff ff       	call   800ece <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8020cd:	8b 43 04             	mov    0x4(%ebx),%eax
+  8020d0:	8b 0b                	mov    (%ebx),%ecx
+  8020d2:	8d 51 20             	lea    0x20(%ecx),%edx
+  8020d5:	39 d0                	cmp    %edx,%eax
+  8020d7:	72 1a                	jb     8020f3 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8020d9:	89 da                	mov    %ebx,%edx
+  8020db:	89 f0                	mov    %esi,%eax
+  8020dd:	e8 5c ff ff ff       	call   80203e <_pipeisclosed>
+  8020e2:	85 c0                	test   %eax,%eax
+  8020e4:	74 e2                	je     8020c8 <devpipe_write+0x25>
+				return 0;
+  8020e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ee:	5b                   	pop    %ebx
+  8020ef:	5e                   	pop    %esi
+  8020f0:	5f                   	pop    %edi
+  8020f1:	5d                   	pop    %ebp
+  8020f2:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8020f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020f6:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8020fa:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8020fd:	89 c2                	mov    %eax,%edx
+  8020ff:	c1 fa 1f             	sar    $0x1f,%edx
+  802102:	89 d1                	mov    %edx,%ecx
+  802104:	c1 e9 1b             	shr    $0x1b,%ecx
+  802107:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80210a:	83 e2 1f             	and    $0x1f,%edx
+  80210d:	29 ca                	sub    %ecx,%edx
+  80210f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802113:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802117:	83 c0 01             	add    $0x1,%eax
+  80211a:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80211d:	83 c7 01             	add    $0x1,%edi
+  802120:	eb 9d                	jmp    8020bf <devpipe_write+0x1c>
+
+00802122 <devpipe_read>:
+{
+  802122:	55                   	push   %ebp
+  802123:	89 e5                	mov    %esp,%ebp
+  802125:	57                   	push   %edi
+  802126:	56                   	push   %esi
+  802127:	53                   	push   %ebx
+  802128:	83 ec 18             	sub    $0x18,%esp
+  80212b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80212e:	57                   	push   %edi
+  80212f:	e8 4f f2 ff ff       	call   801383 <fd2data>
+  802134:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802136:	83 c4 10             	add    $0x10,%esp
+  802139:	be 00 00 00 00       	mov    $0x0,%esi
+  80213e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802141:	75 13                	jne    802156 <devpipe_read+0x34>
+	return i;
+  802143:	89 f0                	mov    %esi,%eax
+  802145:	eb 02                	jmp    802149 <devpipe_read+0x27>
+				return i;
+  802147:	89 f0                	mov    %esi,%eax
+}
+  802149:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214c:	5b                   	pop    %ebx
+  80214d:	5e                   	pop    %esi
+  80214e:	5f                   	pop    %edi
+  80214f:	5d                   	pop    %ebp
+  802150:	c3                   	ret
+			sys_yield();
+  802151:	e8 78 ed ff ff       	call   800ece <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802156:	8b 03                	mov    (%ebx),%eax
+  802158:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80215b:	75 18                	jne    802175 <devpipe_read+0x53>
+			if (i > 0)
+  80215d:	85 f6                	test   %esi,%esi
+  80215f:	75 e6                	jne    802147 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802161:	89 da                	mov    %ebx,%edx
+  802163:	89 f8                	mov    %edi,%eax
+  802165:	e8 d4 fe ff ff       	call   80203e <_pipeisclosed>
+  80216a:	85 c0                	test   %eax,%eax
+  80216c:	74 e3                	je     802151 <devpipe_read+0x2f>
+				return 0;
+  80216e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802173:	eb d4                	jmp    802149 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802175:	99                   	cltd
+  802176:	c1 ea 1b             	shr    $0x1b,%edx
+  802179:	01 d0                	add    %edx,%eax
+  80217b:	83 e0 1f             	and    $0x1f,%eax
+  80217e:	29 d0                	sub    %edx,%eax
+  802180:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802185:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802188:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80218b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80218e:	83 c6 01             	add    $0x1,%esi
+  802191:	eb ab                	jmp    80213e <devpipe_read+0x1c>
+
+00802193 <pipe>:
+{
+  802193:	55                   	push   %ebp
+  802194:	89 e5                	mov    %esp,%ebp
+  802196:	56                   	push   %esi
+  802197:	53                   	push   %ebx
+  802198:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80219b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80219e:	50                   	push   %eax
+  80219f:	e8 f6 f1 ff ff       	call   80139a <fd_alloc>
+  8021a4:	89 c3                	mov    %eax,%ebx
+  8021a6:	83 c4 10             	add    $0x10,%esp
+  8021a9:	85 c0                	test   %eax,%eax
+  8021ab:	0f 88 23 01 00 00    	js     8022d4 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021b1:	83 ec 04             	sub    $0x4,%esp
+  8021b4:	68 07 04 00 00       	push   $0x407
+  8021b9:	ff 75 f4             	push   -0xc(%ebp)
+  8021bc:	6a 00                	push   $0x0
+  8021be:	e8 8b ed ff ff       	call   800f4e <sys_page_alloc>
+  8021c3:	89 c3                	mov    %eax,%ebx
+  8021c5:	83 c4 10             	add    $0x10,%esp
+  8021c8:	85 c0                	test   %eax,%eax
+  8021ca:	0f 88 04 01 00 00    	js     8022d4 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8021d0:	83 ec 0c             	sub    $0xc,%esp
+  8021d3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021d6:	50                   	push   %eax
+  8021d7:	e8 be f1 ff ff       	call   80139a <fd_alloc>
+  8021dc:	89 c3                	mov    %eax,%ebx
+  8021de:	83 c4 10             	add    $0x10,%esp
+  8021e1:	85 c0                	test   %eax,%eax
+  8021e3:	0f 88 db 00 00 00    	js     8022c4 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021e9:	83 ec 04             	sub    $0x4,%esp
+  8021ec:	68 07 04 00 00       	push   $0x407
+  8021f1:	ff 75 f0             	push   -0x10(%ebp)
+  8021f4:	6a 00                	push   $0x0
+  8021f6:	e8 53 ed ff ff       	call   800f4e <sys_page_alloc>
+  8021fb:	89 c3                	mov    %eax,%ebx
+  8021fd:	83 c4 10             	add    $0x10,%esp
+  802200:	85 c0                	test   %eax,%eax
+  802202:	0f 88 bc 00 00 00    	js     8022c4 <pipe+0x131>
+	va = fd2data(fd0);
+  802208:	83 ec 0c             	sub    $0xc,%esp
+  80220b:	ff 75 f4             	push   -0xc(%ebp)
+  80220e:	e8 70 f1 ff ff       	call   801383 <fd2data>
+  802213:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802215:	83 c4 0c             	add    $0xc,%esp
+  802218:	68 07 04 00 00       	push   $0x407
+  80221d:	50                   	push   %eax
+  80221e:	6a 00                	push   $0x0
+  802220:	e8 29 ed ff ff       	call   800f4e <sys_page_alloc>
+  802225:	89 c3                	mov    %eax,%ebx
+  802227:	83 c4 10             	add    $0x10,%esp
+  80222a:	85 c0                	test   %eax,%eax
+  80222c:	0f 88 82 00 00 00    	js     8022b4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802232:	83 ec 0c             	sub    $0xc,%esp
+  802235:	ff 75 f0             	push   -0x10(%ebp)
+  802238:	e8 46 f1 ff ff       	call   801383 <fd2data>
+  80223d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802244:	50                   	push   %eax
+  802245:	6a 00                	push   $0x0
+  802247:	56                   	push   %esi
+  802248:	6a 00                	push   $0x0
+  80224a:	e8 85 ed ff ff       	call   800fd4 <sys_page_map>
+  80224f:	89 c3                	mov    %eax,%ebx
+  802251:	83 c4 20             	add    $0x20,%esp
+  802254:	85 c0                	test   %eax,%eax
+  802256:	78 4e                	js     8022a6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802258:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80225d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802260:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802262:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802265:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80226c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80226f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802271:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802274:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80227b:	83 ec 0c             	sub    $0xc,%esp
+  80227e:	ff 75 f4             	push   -0xc(%ebp)
+  802281:	e8 ed f0 ff ff       	call   801373 <fd2num>
+  802286:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802289:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80228b:	83 c4 04             	add    $0x4,%esp
+  80228e:	ff 75 f0             	push   -0x10(%ebp)
+  802291:	e8 dd f0 ff ff       	call   801373 <fd2num>
+  802296:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802299:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80229c:	83 c4 10             	add    $0x10,%esp
+  80229f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022a4:	eb 2e                	jmp    8022d4 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8022a6:	83 ec 08             	sub    $0x8,%esp
+  8022a9:	56                   	push   %esi
+  8022aa:	6a 00                	push   $0x0
+  8022ac:	e8 65 ed ff ff       	call   801016 <sys_page_unmap>
+  8022b1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8022b4:	83 ec 08             	sub    $0x8,%esp
+  8022b7:	ff 75 f0             	push   -0x10(%ebp)
+  8022ba:	6a 00                	push   $0x0
+  8022bc:	e8 55 ed ff ff       	call   801016 <sys_page_unmap>
+  8022c1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8022c4:	83 ec 08             	sub    $0x8,%esp
+  8022c7:	ff 75 f4             	push   -0xc(%ebp)
+  8022ca:	6a 00                	push   $0x0
+  8022cc:	e8 45 ed ff ff       	call   801016 <sys_page_unmap>
+  8022d1:	83 c4 10             	add    $0x10,%esp
+}
+  8022d4:	89 d8                	mov    %ebx,%eax
+  8022d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022d9:	5b                   	pop    %ebx
+  8022da:	5e                   	pop    %esi
+  8022db:	5d                   	pop    %ebp
+  8022dc:	c3                   	ret
+
+008022dd <pipeisclosed>:
+{
+  8022dd:	55                   	push   %ebp
+  8022de:	89 e5                	mov    %esp,%ebp
+  8022e0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022e6:	50                   	push   %eax
+  8022e7:	ff 75 08             	push   0x8(%ebp)
+  8022ea:	e8 01 f1 ff ff       	call   8013f0 <fd_lookup>
+  8022ef:	83 c4 10             	add    $0x10,%esp
+  8022f2:	85 c0                	test   %eax,%eax
+  8022f4:	78 18                	js     80230e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8022f6:	83 ec 0c             	sub    $0xc,%esp
+  8022f9:	ff 75 f4             	push   -0xc(%ebp)
+  8022fc:	e8 82 f0 ff ff       	call   801383 <fd2data>
+  802301:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802303:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802306:	e8 33 fd ff ff       	call   80203e <_pipeisclosed>
+  80230b:	83 c4 10             	add    $0x10,%esp
+}
+  80230e:	c9                   	leave
+  80230f:	c3                   	ret
+
+00802310 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802310:	b8 00 00 00 00       	mov    $0x0,%eax
+  802315:	c3                   	ret
+
+00802316 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802316:	55                   	push   %ebp
+  802317:	89 e5                	mov    %esp,%ebp
+  802319:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80231c:	68 67 31 80 00       	push   $0x803167
+  802321:	ff 75 0c             	push   0xc(%ebp)
+  802324:	e8 b8 e7 ff ff       	call   800ae1 <strcpy>
+	return 0;
+}
+  802329:	b8 00 00 00 00       	mov    $0x0,%eax
+  80232e:	c9                   	leave
+  80232f:	c3                   	ret
+
+00802330 <devcons_write>:
+{
+  802330:	55                   	push   %ebp
+  802331:	89 e5                	mov    %esp,%ebp
+  802333:	57                   	push   %edi
+  802334:	56                   	push   %esi
+  802335:	53                   	push   %ebx
+  802336:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80233c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802341:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802347:	eb 2e                	jmp    802377 <devcons_write+0x47>
+		m = n - tot;
+  802349:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80234c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80234e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802353:	39 c3                	cmp    %eax,%ebx
+  802355:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802358:	83 ec 04             	sub    $0x4,%esp
+  80235b:	53                   	push   %ebx
+  80235c:	89 f0                	mov    %esi,%eax
+  80235e:	03 45 0c             	add    0xc(%ebp),%eax
+  802361:	50                   	push   %eax
+  802362:	57                   	push   %edi
+  802363:	e8 ff e8 ff ff       	call   800c67 <memmove>
+		sys_cputs(buf, m);
+  802368:	83 c4 08             	add    $0x8,%esp
+  80236b:	53                   	push   %ebx
+  80236c:	57                   	push   %edi
+  80236d:	e8 9f ea ff ff       	call   800e11 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802372:	01 de                	add    %ebx,%esi
+  802374:	83 c4 10             	add    $0x10,%esp
+  802377:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80237a:	72 cd                	jb     802349 <devcons_write+0x19>
+}
+  80237c:	89 f0                	mov    %esi,%eax
+  80237e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802381:	5b                   	pop    %ebx
+  802382:	5e                   	pop    %esi
+  802383:	5f                   	pop    %edi
+  802384:	5d                   	pop    %ebp
+  802385:	c3                   	ret
+
+00802386 <devcons_read>:
+{
+  802386:	55                   	push   %ebp
+  802387:	89 e5                	mov    %esp,%ebp
+  802389:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80238c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802391:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802395:	75 07                	jne    80239e <devcons_read+0x18>
+  802397:	eb 1f                	jmp    8023b8 <devcons_read+0x32>
+		sys_yield();
+  802399:	e8 30 eb ff ff       	call   800ece <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80239e:	e8 8c ea ff ff       	call   800e2f <sys_cgetc>
+  8023a3:	85 c0                	test   %eax,%eax
+  8023a5:	74 f2                	je     802399 <devcons_read+0x13>
+	if (c < 0)
+  8023a7:	78 0f                	js     8023b8 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8023a9:	83 f8 04             	cmp    $0x4,%eax
+  8023ac:	74 0c                	je     8023ba <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8023ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023b1:	88 02                	mov    %al,(%edx)
+	return 1;
+  8023b3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8023b8:	c9                   	leave
+  8023b9:	c3                   	ret
+		return 0;
+  8023ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023bf:	eb f7                	jmp    8023b8 <devcons_read+0x32>
+
+008023c1 <cputchar>:
+{
+  8023c1:	55                   	push   %ebp
+  8023c2:	89 e5                	mov    %esp,%ebp
+  8023c4:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8023c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ca:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8023cd:	6a 01                	push   $0x1
+  8023cf:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8023d2:	50                   	push   %eax
+  8023d3:	e8 39 ea ff ff       	call   800e11 <sys_cputs>
+}
+  8023d8:	83 c4 10             	add    $0x10,%esp
+  8023db:	c9                   	leave
+  8023dc:	c3                   	ret
+
+008023dd <getchar>:
+{
+  8023dd:	55                   	push   %ebp
+  8023de:	89 e5                	mov    %esp,%ebp
+  8023e0:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8023e3:	6a 01                	push   $0x1
+  8023e5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8023e8:	50                   	push   %eax
+  8023e9:	6a 00                	push   $0x0
+  8023eb:	e8 66 f2 ff ff       	call   801656 <read>
+	if (r < 0)
+  8023f0:	83 c4 10             	add    $0x10,%esp
+  8023f3:	85 c0                	test   %eax,%eax
+  8023f5:	78 06                	js     8023fd <getchar+0x20>
+	if (r < 1)
+  8023f7:	74 06                	je     8023ff <getchar+0x22>
+	return c;
+  8023f9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8023fd:	c9                   	leave
+  8023fe:	c3                   	ret
+		return -E_EOF;
+  8023ff:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802404:	eb f7                	jmp    8023fd <getchar+0x20>
+
+00802406 <iscons>:
+{
+  802406:	55                   	push   %ebp
+  802407:	89 e5                	mov    %esp,%ebp
+  802409:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80240c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80240f:	50                   	push   %eax
+  802410:	ff 75 08             	push   0x8(%ebp)
+  802413:	e8 d8 ef ff ff       	call   8013f0 <fd_lookup>
+  802418:	83 c4 10             	add    $0x10,%esp
+  80241b:	85 c0                	test   %eax,%eax
+  80241d:	78 11                	js     802430 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80241f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802422:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802428:	39 10                	cmp    %edx,(%eax)
+  80242a:	0f 94 c0             	sete   %al
+  80242d:	0f b6 c0             	movzbl %al,%eax
+}
+  802430:	c9                   	leave
+  802431:	c3                   	ret
+
+00802432 <opencons>:
+{
+  802432:	55                   	push   %ebp
+  802433:	89 e5                	mov    %esp,%ebp
+  802435:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802438:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80243b:	50                   	push   %eax
+  80243c:	e8 59 ef ff ff       	call   80139a <fd_alloc>
+  802441:	83 c4 10             	add    $0x10,%esp
+  802444:	85 c0                	test   %eax,%eax
+  802446:	78 3a                	js     802482 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802448:	83 ec 04             	sub    $0x4,%esp
+  80244b:	68 07 04 00 00       	push   $0x407
+  802450:	ff 75 f4             	push   -0xc(%ebp)
+  802453:	6a 00                	push   $0x0
+  802455:	e8 f4 ea ff ff       	call   800f4e <sys_page_alloc>
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	78 21                	js     802482 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802461:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802464:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80246a:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80246c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80246f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802476:	83 ec 0c             	sub    $0xc,%esp
+  802479:	50                   	push   %eax
+  80247a:	e8 f4 ee ff ff       	call   801373 <fd2num>
+  80247f:	83 c4 10             	add    $0x10,%esp
+}
+  802482:	c9                   	leave
+  802483:	c3                   	ret
+
+00802484 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802484:	55                   	push   %ebp
+  802485:	89 e5                	mov    %esp,%ebp
+  802487:	57                   	push   %edi
+  802488:	56                   	push   %esi
+  802489:	53                   	push   %ebx
+  80248a:	83 ec 18             	sub    $0x18,%esp
+  80248d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802490:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802493:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802496:	85 db                	test   %ebx,%ebx
+  802498:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80249d:	0f 45 c3             	cmovne %ebx,%eax
+  8024a0:	50                   	push   %eax
+  8024a1:	e8 2b ee ff ff       	call   8012d1 <sys_ipc_recv>
+
+	if (from_env_store)
+  8024a6:	83 c4 10             	add    $0x10,%esp
+  8024a9:	85 ff                	test   %edi,%edi
+  8024ab:	74 17                	je     8024c4 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8024ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b2:	85 c0                	test   %eax,%eax
+  8024b4:	75 0c                	jne    8024c2 <ipc_recv+0x3e>
+  8024b6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8024bc:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8024c2:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8024c4:	85 f6                	test   %esi,%esi
+  8024c6:	74 2e                	je     8024f6 <ipc_recv+0x72>
+		if (!r && pg)
+  8024c8:	85 c0                	test   %eax,%eax
+  8024ca:	75 24                	jne    8024f0 <ipc_recv+0x6c>
+  8024cc:	85 db                	test   %ebx,%ebx
+  8024ce:	74 20                	je     8024f0 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8024d0:	a1 08 50 80 00       	mov    0x805008,%eax
+  8024d5:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8024db:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8024dd:	a1 08 50 80 00       	mov    0x805008,%eax
+  8024e2:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  8024e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024eb:	5b                   	pop    %ebx
+  8024ec:	5e                   	pop    %esi
+  8024ed:	5f                   	pop    %edi
+  8024ee:	5d                   	pop    %ebp
+  8024ef:	c3                   	ret
+			*perm_store = 0;
+  8024f0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  8024f6:	85 c0                	test   %eax,%eax
+  8024f8:	75 ee                	jne    8024e8 <ipc_recv+0x64>
+  8024fa:	eb e1                	jmp    8024dd <ipc_recv+0x59>
+
+008024fc <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8024fc:	55                   	push   %ebp
+  8024fd:	89 e5                	mov    %esp,%ebp
+  8024ff:	57                   	push   %edi
+  802500:	56                   	push   %esi
+  802501:	53                   	push   %ebx
+  802502:	83 ec 0c             	sub    $0xc,%esp
+  802505:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802508:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80250b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80250e:	85 db                	test   %ebx,%ebx
+  802510:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802515:	0f 44 d8             	cmove  %eax,%ebx
+  802518:	ff 75 14             	push   0x14(%ebp)
+  80251b:	53                   	push   %ebx
+  80251c:	56                   	push   %esi
+  80251d:	57                   	push   %edi
+  80251e:	e8 8b ed ff ff       	call   8012ae <sys_ipc_try_send_yield>
+  802523:	83 c4 10             	add    $0x10,%esp
+  802526:	85 c0                	test   %eax,%eax
+  802528:	79 1e                	jns    802548 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80252a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80252d:	75 07                	jne    802536 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80252f:	e8 9a e9 ff ff       	call   800ece <sys_yield>
+  802534:	eb e2                	jmp    802518 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802536:	50                   	push   %eax
+  802537:	68 73 31 80 00       	push   $0x803173
+  80253c:	6a 3d                	push   $0x3d
+  80253e:	68 88 31 80 00       	push   $0x803188
+  802543:	e8 d0 de ff ff       	call   800418 <_panic>
+	}
+}
+  802548:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80254b:	5b                   	pop    %ebx
+  80254c:	5e                   	pop    %esi
+  80254d:	5f                   	pop    %edi
+  80254e:	5d                   	pop    %ebp
+  80254f:	c3                   	ret
+
+00802550 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802550:	55                   	push   %ebp
+  802551:	89 e5                	mov    %esp,%ebp
+  802553:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802556:	ff 75 08             	push   0x8(%ebp)
+  802559:	e8 f0 e8 ff ff       	call   800e4e <sys_env_find>
+}
+  80255e:	c9                   	leave
+  80255f:	c3                   	ret
+
+00802560 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802560:	55                   	push   %ebp
+  802561:	89 e5                	mov    %esp,%ebp
+  802563:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802566:	89 c2                	mov    %eax,%edx
+  802568:	c1 ea 16             	shr    $0x16,%edx
+  80256b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802572:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802577:	f6 c1 01             	test   $0x1,%cl
+  80257a:	74 22                	je     80259e <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80257c:	c1 e8 0c             	shr    $0xc,%eax
+  80257f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802586:	a8 01                	test   $0x1,%al
+  802588:	74 14                	je     80259e <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80258a:	c1 e8 0c             	shr    $0xc,%eax
+  80258d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802590:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802597:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80259b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80259e:	89 d0                	mov    %edx,%eax
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+  8025a2:	66 90                	xchg   %ax,%ax
+  8025a4:	66 90                	xchg   %ax,%ax
+  8025a6:	66 90                	xchg   %ax,%ax
+  8025a8:	66 90                	xchg   %ax,%ax
+  8025aa:	66 90                	xchg   %ax,%ax
+  8025ac:	66 90                	xchg   %ax,%ax
+  8025ae:	66 90                	xchg   %ax,%ax
+
+008025b0 <__udivmoddi4>:
+  8025b0:	55                   	push   %ebp
+  8025b1:	57                   	push   %edi
+  8025b2:	56                   	push   %esi
+  8025b3:	53                   	push   %ebx
+  8025b4:	83 ec 14             	sub    $0x14,%esp
+  8025b7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8025bb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8025bf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025c3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025c7:	89 f1                	mov    %esi,%ecx
+  8025c9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8025cd:	09 d9                	or     %ebx,%ecx
+  8025cf:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8025d3:	0f 84 92 00 00 00    	je     80266b <__udivmoddi4+0xbb>
+  8025d9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8025e0:	00 
+  8025e1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8025e6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8025ed:	00 
+  8025ee:	89 1c 24             	mov    %ebx,(%esp)
+  8025f1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025f5:	8d 76 00             	lea    0x0(%esi),%esi
+  8025f8:	89 e9                	mov    %ebp,%ecx
+  8025fa:	89 c3                	mov    %eax,%ebx
+  8025fc:	89 d6                	mov    %edx,%esi
+  8025fe:	31 ff                	xor    %edi,%edi
+  802600:	d3 ee                	shr    %cl,%esi
+  802602:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802605:	f6 c1 20             	test   $0x20,%cl
+  802608:	0f 45 de             	cmovne %esi,%ebx
+  80260b:	0f 45 f7             	cmovne %edi,%esi
+  80260e:	8b 3c 24             	mov    (%esp),%edi
+  802611:	39 fb                	cmp    %edi,%ebx
+  802613:	89 f7                	mov    %esi,%edi
+  802615:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802619:	8b 1c 24             	mov    (%esp),%ebx
+  80261c:	19 f7                	sbb    %esi,%edi
+  80261e:	72 39                	jb     802659 <__udivmoddi4+0xa9>
+  802620:	89 e9                	mov    %ebp,%ecx
+  802622:	89 f7                	mov    %esi,%edi
+  802624:	89 de                	mov    %ebx,%esi
+  802626:	0f a5 df             	shld   %cl,%ebx,%edi
+  802629:	d3 e6                	shl    %cl,%esi
+  80262b:	31 db                	xor    %ebx,%ebx
+  80262d:	f6 c1 20             	test   $0x20,%cl
+  802630:	0f 45 fe             	cmovne %esi,%edi
+  802633:	0f 45 f3             	cmovne %ebx,%esi
+  802636:	29 f0                	sub    %esi,%eax
+  802638:	be 01 00 00 00       	mov    $0x1,%esi
+  80263d:	19 fa                	sbb    %edi,%edx
+  80263f:	31 ff                	xor    %edi,%edi
+  802641:	31 db                	xor    %ebx,%ebx
+  802643:	0f a5 f7             	shld   %cl,%esi,%edi
+  802646:	d3 e6                	shl    %cl,%esi
+  802648:	f6 c1 20             	test   $0x20,%cl
+  80264b:	0f 45 fe             	cmovne %esi,%edi
+  80264e:	0f 45 f3             	cmovne %ebx,%esi
+  802651:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802655:	09 74 24 08          	or     %esi,0x8(%esp)
+  802659:	83 ed 01             	sub    $0x1,%ebp
+  80265c:	73 9a                	jae    8025f8 <__udivmoddi4+0x48>
+  80265e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802662:	85 ff                	test   %edi,%edi
+  802664:	74 05                	je     80266b <__udivmoddi4+0xbb>
+  802666:	89 07                	mov    %eax,(%edi)
+  802668:	89 57 04             	mov    %edx,0x4(%edi)
+  80266b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80266f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802673:	83 c4 14             	add    $0x14,%esp
+  802676:	5b                   	pop    %ebx
+  802677:	5e                   	pop    %esi
+  802678:	5f                   	pop    %edi
+  802679:	5d                   	pop    %ebp
+  80267a:	c3                   	ret
+  80267b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80267f:	90                   	nop
+
+00802680 <__udivdi3>:
+  802680:	55                   	push   %ebp
+  802681:	57                   	push   %edi
+  802682:	56                   	push   %esi
+  802683:	53                   	push   %ebx
+  802684:	83 ec 14             	sub    $0x14,%esp
+  802687:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80268b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80268f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802693:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802697:	89 fb                	mov    %edi,%ebx
+  802699:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80269d:	09 f3                	or     %esi,%ebx
+  80269f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8026a3:	0f 84 85 00 00 00    	je     80272e <__udivdi3+0xae>
+  8026a9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8026b0:	00 
+  8026b1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8026b6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8026bd:	00 
+  8026be:	89 34 24             	mov    %esi,(%esp)
+  8026c1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8026c5:	8d 76 00             	lea    0x0(%esi),%esi
+  8026c8:	89 e9                	mov    %ebp,%ecx
+  8026ca:	89 c3                	mov    %eax,%ebx
+  8026cc:	89 d6                	mov    %edx,%esi
+  8026ce:	31 ff                	xor    %edi,%edi
+  8026d0:	d3 ee                	shr    %cl,%esi
+  8026d2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8026d5:	f6 c1 20             	test   $0x20,%cl
+  8026d8:	0f 45 de             	cmovne %esi,%ebx
+  8026db:	0f 45 f7             	cmovne %edi,%esi
+  8026de:	8b 3c 24             	mov    (%esp),%edi
+  8026e1:	39 fb                	cmp    %edi,%ebx
+  8026e3:	89 f7                	mov    %esi,%edi
+  8026e5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8026e9:	8b 1c 24             	mov    (%esp),%ebx
+  8026ec:	19 f7                	sbb    %esi,%edi
+  8026ee:	72 39                	jb     802729 <__udivdi3+0xa9>
+  8026f0:	89 e9                	mov    %ebp,%ecx
+  8026f2:	89 f7                	mov    %esi,%edi
+  8026f4:	89 de                	mov    %ebx,%esi
+  8026f6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8026f9:	d3 e6                	shl    %cl,%esi
+  8026fb:	31 db                	xor    %ebx,%ebx
+  8026fd:	f6 c1 20             	test   $0x20,%cl
+  802700:	0f 45 fe             	cmovne %esi,%edi
+  802703:	0f 45 f3             	cmovne %ebx,%esi
+  802706:	29 f0                	sub    %esi,%eax
+  802708:	be 01 00 00 00       	mov    $0x1,%esi
+  80270d:	19 fa                	sbb    %edi,%edx
+  80270f:	31 ff                	xor    %edi,%edi
+  802711:	31 db                	xor    %ebx,%ebx
+  802713:	0f a5 f7             	shld   %cl,%esi,%edi
+  802716:	d3 e6                	shl    %cl,%esi
+  802718:	f6 c1 20             	test   $0x20,%cl
+  80271b:	0f 45 fe             	cmovne %esi,%edi
+  80271e:	0f 45 f3             	cmovne %ebx,%esi
+  802721:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802725:	09 74 24 08          	or     %esi,0x8(%esp)
+  802729:	83 ed 01             	sub    $0x1,%ebp
+  80272c:	73 9a                	jae    8026c8 <__udivdi3+0x48>
+  80272e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802732:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802736:	83 c4 14             	add    $0x14,%esp
+  802739:	5b                   	pop    %ebx
+  80273a:	5e                   	pop    %esi
+  80273b:	5f                   	pop    %edi
+  80273c:	5d                   	pop    %ebp
+  80273d:	c3                   	ret
+  80273e:	66 90                	xchg   %ax,%ax
+
+00802740 <__umoddi3>:
+  802740:	57                   	push   %edi
+  802741:	56                   	push   %esi
+  802742:	53                   	push   %ebx
+  802743:	83 ec 08             	sub    $0x8,%esp
+  802746:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80274a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80274e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802752:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802756:	89 f9                	mov    %edi,%ecx
+  802758:	89 34 24             	mov    %esi,(%esp)
+  80275b:	09 f1                	or     %esi,%ecx
+  80275d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802761:	74 53                	je     8027b6 <__umoddi3+0x76>
+  802763:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80276f:	90                   	nop
+  802770:	89 c6                	mov    %eax,%esi
+  802772:	89 d7                	mov    %edx,%edi
+  802774:	31 db                	xor    %ebx,%ebx
+  802776:	d3 ef                	shr    %cl,%edi
+  802778:	0f ad d6             	shrd   %cl,%edx,%esi
+  80277b:	f6 c1 20             	test   $0x20,%cl
+  80277e:	0f 45 f7             	cmovne %edi,%esi
+  802781:	0f 45 fb             	cmovne %ebx,%edi
+  802784:	8b 1c 24             	mov    (%esp),%ebx
+  802787:	39 de                	cmp    %ebx,%esi
+  802789:	89 fb                	mov    %edi,%ebx
+  80278b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80278f:	8b 34 24             	mov    (%esp),%esi
+  802792:	19 fb                	sbb    %edi,%ebx
+  802794:	72 14                	jb     8027aa <__umoddi3+0x6a>
+  802796:	0f a5 f7             	shld   %cl,%esi,%edi
+  802799:	31 db                	xor    %ebx,%ebx
+  80279b:	d3 e6                	shl    %cl,%esi
+  80279d:	f6 c1 20             	test   $0x20,%cl
+  8027a0:	0f 45 fe             	cmovne %esi,%edi
+  8027a3:	0f 45 f3             	cmovne %ebx,%esi
+  8027a6:	29 f0                	sub    %esi,%eax
+  8027a8:	19 fa                	sbb    %edi,%edx
+  8027aa:	83 e9 01             	sub    $0x1,%ecx
+  8027ad:	73 c1                	jae    802770 <__umoddi3+0x30>
+  8027af:	83 c4 08             	add    $0x8,%esp
+  8027b2:	5b                   	pop    %ebx
+  8027b3:	5e                   	pop    %esi
+  8027b4:	5f                   	pop    %edi
+  8027b5:	c3                   	ret
+  8027b6:	83 c4 08             	add    $0x8,%esp
+  8027b9:	31 c0                	xor    %eax,%eax
+  8027bb:	31 d2                	xor    %edx,%edx
+  8027bd:	5b                   	pop    %ebx
+  8027be:	5e                   	pop    %esi
+  8027bf:	5f                   	pop    %edi
+  8027c0:	c3                   	ret
+  8027c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8027c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8027cf:	90                   	nop
+
+008027d0 <__divdi3>:
+  8027d0:	55                   	push   %ebp
+  8027d1:	57                   	push   %edi
+  8027d2:	56                   	push   %esi
+  8027d3:	53                   	push   %ebx
+  8027d4:	83 ec 1c             	sub    $0x1c,%esp
+  8027d7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8027db:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8027df:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8027e3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8027e7:	85 ff                	test   %edi,%edi
+  8027e9:	0f 88 da 00 00 00    	js     8028c9 <__divdi3+0xf9>
+  8027ef:	85 db                	test   %ebx,%ebx
+  8027f1:	78 16                	js     802809 <__divdi3+0x39>
+  8027f3:	89 dd                	mov    %ebx,%ebp
+  8027f5:	89 c8                	mov    %ecx,%eax
+  8027f7:	89 da                	mov    %ebx,%edx
+  8027f9:	09 cd                	or     %ecx,%ebp
+  8027fb:	0f 85 fd 00 00 00    	jne    8028fe <__divdi3+0x12e>
+  802801:	83 c4 1c             	add    $0x1c,%esp
+  802804:	5b                   	pop    %ebx
+  802805:	5e                   	pop    %esi
+  802806:	5f                   	pop    %edi
+  802807:	5d                   	pop    %ebp
+  802808:	c3                   	ret
+  802809:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80280e:	f7 d9                	neg    %ecx
+  802810:	89 f0                	mov    %esi,%eax
+  802812:	89 fa                	mov    %edi,%edx
+  802814:	83 d3 00             	adc    $0x0,%ebx
+  802817:	89 0c 24             	mov    %ecx,(%esp)
+  80281a:	f7 db                	neg    %ebx
+  80281c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802820:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802827:	00 
+  802828:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80282d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802834:	00 
+  802835:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802839:	89 cd                	mov    %ecx,%ebp
+  80283b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80283f:	90                   	nop
+  802840:	89 e9                	mov    %ebp,%ecx
+  802842:	89 c3                	mov    %eax,%ebx
+  802844:	89 d6                	mov    %edx,%esi
+  802846:	31 ff                	xor    %edi,%edi
+  802848:	d3 ee                	shr    %cl,%esi
+  80284a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80284d:	f6 c1 20             	test   $0x20,%cl
+  802850:	0f 45 de             	cmovne %esi,%ebx
+  802853:	0f 45 f7             	cmovne %edi,%esi
+  802856:	8b 3c 24             	mov    (%esp),%edi
+  802859:	39 fb                	cmp    %edi,%ebx
+  80285b:	89 f7                	mov    %esi,%edi
+  80285d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802861:	8b 1c 24             	mov    (%esp),%ebx
+  802864:	19 f7                	sbb    %esi,%edi
+  802866:	72 39                	jb     8028a1 <__divdi3+0xd1>
+  802868:	89 e9                	mov    %ebp,%ecx
+  80286a:	89 f7                	mov    %esi,%edi
+  80286c:	89 de                	mov    %ebx,%esi
+  80286e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802871:	d3 e6                	shl    %cl,%esi
+  802873:	31 db                	xor    %ebx,%ebx
+  802875:	f6 c1 20             	test   $0x20,%cl
+  802878:	0f 45 fe             	cmovne %esi,%edi
+  80287b:	0f 45 f3             	cmovne %ebx,%esi
+  80287e:	29 f0                	sub    %esi,%eax
+  802880:	be 01 00 00 00       	mov    $0x1,%esi
+  802885:	19 fa                	sbb    %edi,%edx
+  802887:	31 ff                	xor    %edi,%edi
+  802889:	31 db                	xor    %ebx,%ebx
+  80288b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80288e:	d3 e6                	shl    %cl,%esi
+  802890:	f6 c1 20             	test   $0x20,%cl
+  802893:	0f 45 fe             	cmovne %esi,%edi
+  802896:	0f 45 f3             	cmovne %ebx,%esi
+  802899:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80289d:	09 74 24 08          	or     %esi,0x8(%esp)
+  8028a1:	83 ed 01             	sub    $0x1,%ebp
+  8028a4:	73 9a                	jae    802840 <__divdi3+0x70>
+  8028a6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8028aa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028ae:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028b2:	85 ed                	test   %ebp,%ebp
+  8028b4:	0f 84 47 ff ff ff    	je     802801 <__divdi3+0x31>
+  8028ba:	f7 d8                	neg    %eax
+  8028bc:	83 d2 00             	adc    $0x0,%edx
+  8028bf:	83 c4 1c             	add    $0x1c,%esp
+  8028c2:	5b                   	pop    %ebx
+  8028c3:	f7 da                	neg    %edx
+  8028c5:	5e                   	pop    %esi
+  8028c6:	5f                   	pop    %edi
+  8028c7:	5d                   	pop    %ebp
+  8028c8:	c3                   	ret
+  8028c9:	f7 de                	neg    %esi
+  8028cb:	83 d7 00             	adc    $0x0,%edi
+  8028ce:	f7 df                	neg    %edi
+  8028d0:	85 db                	test   %ebx,%ebx
+  8028d2:	78 23                	js     8028f7 <__divdi3+0x127>
+  8028d4:	89 dd                	mov    %ebx,%ebp
+  8028d6:	89 c8                	mov    %ecx,%eax
+  8028d8:	89 da                	mov    %ebx,%edx
+  8028da:	09 cd                	or     %ecx,%ebp
+  8028dc:	0f 84 1f ff ff ff    	je     802801 <__divdi3+0x31>
+  8028e2:	89 0c 24             	mov    %ecx,(%esp)
+  8028e5:	89 f0                	mov    %esi,%eax
+  8028e7:	89 fa                	mov    %edi,%edx
+  8028e9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8028ee:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8028f2:	e9 29 ff ff ff       	jmp    802820 <__divdi3+0x50>
+  8028f7:	31 ed                	xor    %ebp,%ebp
+  8028f9:	e9 10 ff ff ff       	jmp    80280e <__divdi3+0x3e>
+  8028fe:	89 0c 24             	mov    %ecx,(%esp)
+  802901:	89 f0                	mov    %esi,%eax
+  802903:	89 fa                	mov    %edi,%edx
+  802905:	31 ed                	xor    %ebp,%ebp
+  802907:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80290b:	e9 10 ff ff ff       	jmp    802820 <__divdi3+0x50>
+
+00802910 <__moddi3>:
+  802910:	55                   	push   %ebp
+  802911:	57                   	push   %edi
+  802912:	56                   	push   %esi
+  802913:	53                   	push   %ebx
+  802914:	83 ec 14             	sub    $0x14,%esp
+  802917:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80291b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80291f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802923:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802927:	85 d2                	test   %edx,%edx
+  802929:	0f 88 9b 00 00 00    	js     8029ca <__moddi3+0xba>
+  80292f:	89 f7                	mov    %esi,%edi
+  802931:	31 ed                	xor    %ebp,%ebp
+  802933:	09 cf                	or     %ecx,%edi
+  802935:	0f 84 83 00 00 00    	je     8029be <__moddi3+0xae>
+  80293b:	89 cb                	mov    %ecx,%ebx
+  80293d:	89 f7                	mov    %esi,%edi
+  80293f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802943:	f7 db                	neg    %ebx
+  802945:	83 d7 00             	adc    $0x0,%edi
+  802948:	f7 df                	neg    %edi
+  80294a:	0f 49 f7             	cmovns %edi,%esi
+  80294d:	0f 49 cb             	cmovns %ebx,%ecx
+  802950:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802954:	89 0c 24             	mov    %ecx,(%esp)
+  802957:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80295c:	89 cd                	mov    %ecx,%ebp
+  80295e:	66 90                	xchg   %ax,%ax
+  802960:	89 e9                	mov    %ebp,%ecx
+  802962:	89 c3                	mov    %eax,%ebx
+  802964:	89 d6                	mov    %edx,%esi
+  802966:	31 ff                	xor    %edi,%edi
+  802968:	d3 ee                	shr    %cl,%esi
+  80296a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80296d:	f6 c1 20             	test   $0x20,%cl
+  802970:	0f 45 de             	cmovne %esi,%ebx
+  802973:	0f 45 f7             	cmovne %edi,%esi
+  802976:	8b 3c 24             	mov    (%esp),%edi
+  802979:	39 fb                	cmp    %edi,%ebx
+  80297b:	89 f7                	mov    %esi,%edi
+  80297d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802981:	8b 1c 24             	mov    (%esp),%ebx
+  802984:	19 f7                	sbb    %esi,%edi
+  802986:	72 1a                	jb     8029a2 <__moddi3+0x92>
+  802988:	89 e9                	mov    %ebp,%ecx
+  80298a:	89 f7                	mov    %esi,%edi
+  80298c:	89 de                	mov    %ebx,%esi
+  80298e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802991:	d3 e6                	shl    %cl,%esi
+  802993:	31 db                	xor    %ebx,%ebx
+  802995:	f6 c1 20             	test   $0x20,%cl
+  802998:	0f 45 fe             	cmovne %esi,%edi
+  80299b:	0f 45 f3             	cmovne %ebx,%esi
+  80299e:	29 f0                	sub    %esi,%eax
+  8029a0:	19 fa                	sbb    %edi,%edx
+  8029a2:	83 ed 01             	sub    $0x1,%ebp
+  8029a5:	73 b9                	jae    802960 <__moddi3+0x50>
+  8029a7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  8029ab:	85 ed                	test   %ebp,%ebp
+  8029ad:	74 07                	je     8029b6 <__moddi3+0xa6>
+  8029af:	f7 d8                	neg    %eax
+  8029b1:	83 d2 00             	adc    $0x0,%edx
+  8029b4:	f7 da                	neg    %edx
+  8029b6:	83 c4 14             	add    $0x14,%esp
+  8029b9:	5b                   	pop    %ebx
+  8029ba:	5e                   	pop    %esi
+  8029bb:	5f                   	pop    %edi
+  8029bc:	5d                   	pop    %ebp
+  8029bd:	c3                   	ret
+  8029be:	83 c4 14             	add    $0x14,%esp
+  8029c1:	31 c0                	xor    %eax,%eax
+  8029c3:	31 d2                	xor    %edx,%edx
+  8029c5:	5b                   	pop    %ebx
+  8029c6:	5e                   	pop    %esi
+  8029c7:	5f                   	pop    %edi
+  8029c8:	5d                   	pop    %ebp
+  8029c9:	c3                   	ret
+  8029ca:	89 f7                	mov    %esi,%edi
+  8029cc:	09 cf                	or     %ecx,%edi
+  8029ce:	74 11                	je     8029e1 <__moddi3+0xd1>
+  8029d0:	f7 d8                	neg    %eax
+  8029d2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8029d7:	83 d2 00             	adc    $0x0,%edx
+  8029da:	f7 da                	neg    %edx
+  8029dc:	e9 5a ff ff ff       	jmp    80293b <__moddi3+0x2b>
+  8029e1:	31 c0                	xor    %eax,%eax
+  8029e3:	31 d2                	xor    %edx,%edx
+  8029e5:	eb c8                	jmp    8029af <__moddi3+0x9f>
@@ -0,0 +1,5790 @@
+
+obj/user/testregion.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 cc 02 00 00       	call   8002fd <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if ((r = sys_region_reserve(0, R, 8 * PGSIZE, PERM)) < 0)
+  800039:	6a 07                	push   $0x7
+  80003b:	68 00 80 00 00       	push   $0x8000
+  800040:	68 00 00 00 a0       	push   $0xa0000000
+  800045:	6a 00                	push   $0x0
+  800047:	e8 b5 0f 00 00       	call   801001 <sys_region_reserve>
+  80004c:	83 c4 10             	add    $0x10,%esp
+  80004f:	85 c0                	test   %eax,%eax
+  800051:	0f 88 9a 01 00 00    	js     8001f1 <umain+0x1be>
+		panic("sys_region_reserve: %e", r);
+	if ((r = sys_region_reserve(0, R + 4 * PGSIZE, 8 * PGSIZE, PERM)) != -E_INVAL)
+  800057:	6a 07                	push   $0x7
+  800059:	68 00 80 00 00       	push   $0x8000
+  80005e:	68 00 40 00 a0       	push   $0xa0004000
+  800063:	6a 00                	push   $0x0
+  800065:	e8 97 0f 00 00       	call   801001 <sys_region_reserve>
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800070:	0f 85 8d 01 00 00    	jne    800203 <umain+0x1d0>
+		panic("overlapping sys_region_reserve returned %d", r);
+	if ((r = sys_region_reserve(0, R2, PGSIZE, PERM|PTE_SHARE)) != -E_INVAL)
+  800076:	68 07 04 00 00       	push   $0x407
+  80007b:	68 00 10 00 00       	push   $0x1000
+  800080:	68 00 00 10 a0       	push   $0xa0100000
+  800085:	6a 00                	push   $0x0
+  800087:	e8 75 0f 00 00       	call   801001 <sys_region_reserve>
+  80008c:	83 c4 10             	add    $0x10,%esp
+  80008f:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800092:	0f 85 7d 01 00 00    	jne    800215 <umain+0x1e2>
+		panic("PTE_SHARE sys_region_reserve returned %d", r);
+	if ((r = sys_region_reserve(0, R2, PGSIZE, PTE_U|PTE_W)) != -E_INVAL)
+  800098:	6a 06                	push   $0x6
+  80009a:	68 00 10 00 00       	push   $0x1000
+  80009f:	68 00 00 10 a0       	push   $0xa0100000
+  8000a4:	6a 00                	push   $0x0
+  8000a6:	e8 56 0f 00 00       	call   801001 <sys_region_reserve>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8000b1:	0f 85 70 01 00 00    	jne    800227 <umain+0x1f4>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8000b7:	a1 00 da 7b ef       	mov    0xef7bda00,%eax
+  8000bc:	a8 01                	test   $0x1,%al
+  8000be:	74 0d                	je     8000cd <umain+0x9a>
+  8000c0:	a1 00 00 68 ef       	mov    0xef680000,%eax
+		panic("sys_region_reserve without PTE_P returned %d", r);
+
+	if (mapped(R))
+  8000c5:	a8 01                	test   $0x1,%al
+  8000c7:	0f 85 6c 01 00 00    	jne    800239 <umain+0x206>
+		panic("region page mapped before it was touched");
+	if (R[0] != 0)
+  8000cd:	80 3d 00 00 00 a0 00 	cmpb   $0x0,0xa0000000
+  8000d4:	0f 85 73 01 00 00    	jne    80024d <umain+0x21a>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8000da:	a1 00 da 7b ef       	mov    0xef7bda00,%eax
+  8000df:	a8 01                	test   $0x1,%al
+  8000e1:	0f 84 7a 01 00 00    	je     800261 <umain+0x22e>
+  8000e7:	a1 00 00 68 ef       	mov    0xef680000,%eax
+		panic("region page isn't cleared");
+	if (!mapped(R) || (uvpt[PGNUM(R)] & PTE_W))
+  8000ec:	a8 01                	test   $0x1,%al
+  8000ee:	0f 84 6d 01 00 00    	je     800261 <umain+0x22e>
+  8000f4:	a1 00 00 68 ef       	mov    0xef680000,%eax
+  8000f9:	a8 02                	test   $0x2,%al
+  8000fb:	0f 85 60 01 00 00    	jne    800261 <umain+0x22e>
+		panic("read fault didn't map a read-only page");
+	R[0] = 'x';
+  800101:	c6 05 00 00 00 a0 78 	movb   $0x78,0xa0000000
+	if (R[0] != 'x' || !(uvpt[PGNUM(R)] & PTE_W))
+  800108:	a1 00 00 68 ef       	mov    0xef680000,%eax
+  80010d:	a8 02                	test   $0x2,%al
+  80010f:	0f 84 60 01 00 00    	je     800275 <umain+0x242>
+		panic("write after a read fault didn't stick");
+	R[PGSIZE] = 'y';
+  800115:	c6 05 00 10 00 a0 79 	movb   $0x79,0xa0001000
+	if (R[PGSIZE] != 'y')
+		panic("write to an untouched page didn't stick");
+	cprintf("reads and writes of untouched region pages work\n");
+  80011c:	83 ec 0c             	sub    $0xc,%esp
+  80011f:	68 88 2a 80 00       	push   $0x802a88
+  800124:	e8 0f 03 00 00       	call   800438 <cprintf>
+
+	sys_cputs(R + 2 * PGSIZE, 16);
+  800129:	83 c4 08             	add    $0x8,%esp
+  80012c:	6a 10                	push   $0x10
+  80012e:	68 00 20 00 a0       	push   $0xa0002000
+  800133:	e8 1e 0c 00 00       	call   800d56 <sys_cputs>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  800138:	a1 00 da 7b ef       	mov    0xef7bda00,%eax
+  80013d:	83 c4 10             	add    $0x10,%esp
+  800140:	a8 01                	test   $0x1,%al
+  800142:	0f 84 41 01 00 00    	je     800289 <umain+0x256>
+  800148:	a1 08 00 68 ef       	mov    0xef680008,%eax
+	if (!mapped(R + 2 * PGSIZE))
+  80014d:	a8 01                	test   $0x1,%al
+  80014f:	0f 84 34 01 00 00    	je     800289 <umain+0x256>
+		panic("sys_cputs didn't fault in the region page");
+	cprintf("sys_cputs faults in an untouched region page\n");
+  800155:	83 ec 0c             	sub    $0xc,%esp
+  800158:	68 e8 2a 80 00       	push   $0x802ae8
+  80015d:	e8 d6 02 00 00       	call   800438 <cprintf>
+
+	if ((r = sys_page_map(0, R + 3 * PGSIZE, 0, T, PERM)) < 0)
+  800162:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800169:	68 00 00 40 00       	push   $0x400000
+  80016e:	6a 00                	push   $0x0
+  800170:	68 00 30 00 a0       	push   $0xa0003000
+  800175:	6a 00                	push   $0x0
+  800177:	e8 9d 0d 00 00       	call   800f19 <sys_page_map>
+  80017c:	83 c4 20             	add    $0x20,%esp
+  80017f:	85 c0                	test   %eax,%eax
+  800181:	0f 88 16 01 00 00    	js     80029d <umain+0x26a>
+		panic("sys_page_map of an untouched page: %e", r);
+	T[0] = 'z';
+  800187:	c6 05 00 00 40 00 7a 	movb   $0x7a,0x400000
+	if (R[3 * PGSIZE] != 'z')
+  80018e:	80 3d 00 30 00 a0 7a 	cmpb   $0x7a,0xa0003000
+  800195:	0f 85 14 01 00 00    	jne    8002af <umain+0x27c>
+		panic("sys_page_map of an untouched page didn't share it");
+	if (R[4 * PGSIZE] != 0)
+  80019b:	80 3d 00 40 00 a0 00 	cmpb   $0x0,0xa0004000
+  8001a2:	0f 85 1b 01 00 00    	jne    8002c3 <umain+0x290>
+		panic("region page isn't cleared");
+	if ((r = sys_page_map(0, R + 4 * PGSIZE, 0, T + PGSIZE, PERM)) < 0)
+  8001a8:	83 ec 0c             	sub    $0xc,%esp
+  8001ab:	6a 07                	push   $0x7
+  8001ad:	68 00 10 40 00       	push   $0x401000
+  8001b2:	6a 00                	push   $0x0
+  8001b4:	68 00 40 00 a0       	push   $0xa0004000
+  8001b9:	6a 00                	push   $0x0
+  8001bb:	e8 59 0d 00 00       	call   800f19 <sys_page_map>
+  8001c0:	83 c4 20             	add    $0x20,%esp
+  8001c3:	85 c0                	test   %eax,%eax
+  8001c5:	0f 88 0c 01 00 00    	js     8002d7 <umain+0x2a4>
+		panic("sys_page_map of a read-faulted page: %e", r);
+	T[PGSIZE] = 'w';
+  8001cb:	c6 05 00 10 40 00 77 	movb   $0x77,0x401000
+	if (R[4 * PGSIZE] != 'w')
+  8001d2:	80 3d 00 40 00 a0 77 	cmpb   $0x77,0xa0004000
+  8001d9:	0f 85 0a 01 00 00    	jne    8002e9 <umain+0x2b6>
+		panic("sys_page_map of a read-faulted page didn't share it");
+	cprintf("sys_page_map maps untouched and read-faulted region pages\n");
+  8001df:	83 ec 0c             	sub    $0xc,%esp
+  8001e2:	68 d0 2b 80 00       	push   $0x802bd0
+  8001e7:	e8 4c 02 00 00       	call   800438 <cprintf>
+}
+  8001ec:	83 c4 10             	add    $0x10,%esp
+  8001ef:	c9                   	leave
+  8001f0:	c3                   	ret
+		panic("sys_region_reserve: %e", r);
+  8001f1:	50                   	push   %eax
+  8001f2:	68 40 29 80 00       	push   $0x802940
+  8001f7:	6a 17                	push   $0x17
+  8001f9:	68 57 29 80 00       	push   $0x802957
+  8001fe:	e8 5a 01 00 00       	call   80035d <_panic>
+		panic("overlapping sys_region_reserve returned %d", r);
+  800203:	50                   	push   %eax
+  800204:	68 84 29 80 00       	push   $0x802984
+  800209:	6a 19                	push   $0x19
+  80020b:	68 57 29 80 00       	push   $0x802957
+  800210:	e8 48 01 00 00       	call   80035d <_panic>
+		panic("PTE_SHARE sys_region_reserve returned %d", r);
+  800215:	50                   	push   %eax
+  800216:	68 b0 29 80 00       	push   $0x8029b0
+  80021b:	6a 1b                	push   $0x1b
+  80021d:	68 57 29 80 00       	push   $0x802957
+  800222:	e8 36 01 00 00       	call   80035d <_panic>
+		panic("sys_region_reserve without PTE_P returned %d", r);
+  800227:	50                   	push   %eax
+  800228:	68 dc 29 80 00       	push   $0x8029dc
+  80022d:	6a 1d                	push   $0x1d
+  80022f:	68 57 29 80 00       	push   $0x802957
+  800234:	e8 24 01 00 00       	call   80035d <_panic>
+		panic("region page mapped before it was touched");
+  800239:	83 ec 04             	sub    $0x4,%esp
+  80023c:	68 0c 2a 80 00       	push   $0x802a0c
+  800241:	6a 20                	push   $0x20
+  800243:	68 57 29 80 00       	push   $0x802957
+  800248:	e8 10 01 00 00       	call   80035d <_panic>
+		panic("region page isn't cleared");
+  80024d:	83 ec 04             	sub    $0x4,%esp
+  800250:	68 69 29 80 00       	push   $0x802969
+  800255:	6a 22                	push   $0x22
+  800257:	68 57 29 80 00       	push   $0x802957
+  80025c:	e8 fc 00 00 00       	call   80035d <_panic>
+		panic("read fault didn't map a read-only page");
+  800261:	83 ec 04             	sub    $0x4,%esp
+  800264:	68 38 2a 80 00       	push   $0x802a38
+  800269:	6a 24                	push   $0x24
+  80026b:	68 57 29 80 00       	push   $0x802957
+  800270:	e8 e8 00 00 00       	call   80035d <_panic>
+		panic("write after a read fault didn't stick");
+  800275:	83 ec 04             	sub    $0x4,%esp
+  800278:	68 60 2a 80 00       	push   $0x802a60
+  80027d:	6a 27                	push   $0x27
+  80027f:	68 57 29 80 00       	push   $0x802957
+  800284:	e8 d4 00 00 00       	call   80035d <_panic>
+		panic("sys_cputs didn't fault in the region page");
+  800289:	83 ec 04             	sub    $0x4,%esp
+  80028c:	68 bc 2a 80 00       	push   $0x802abc
+  800291:	6a 2f                	push   $0x2f
+  800293:	68 57 29 80 00       	push   $0x802957
+  800298:	e8 c0 00 00 00       	call   80035d <_panic>
+		panic("sys_page_map of an untouched page: %e", r);
+  80029d:	50                   	push   %eax
+  80029e:	68 18 2b 80 00       	push   $0x802b18
+  8002a3:	6a 33                	push   $0x33
+  8002a5:	68 57 29 80 00       	push   $0x802957
+  8002aa:	e8 ae 00 00 00       	call   80035d <_panic>
+		panic("sys_page_map of an untouched page didn't share it");
+  8002af:	83 ec 04             	sub    $0x4,%esp
+  8002b2:	68 40 2b 80 00       	push   $0x802b40
+  8002b7:	6a 36                	push   $0x36
+  8002b9:	68 57 29 80 00       	push   $0x802957
+  8002be:	e8 9a 00 00 00       	call   80035d <_panic>
+		panic("region page isn't cleared");
+  8002c3:	83 ec 04             	sub    $0x4,%esp
+  8002c6:	68 69 29 80 00       	push   $0x802969
+  8002cb:	6a 38                	push   $0x38
+  8002cd:	68 57 29 80 00       	push   $0x802957
+  8002d2:	e8 86 00 00 00       	call   80035d <_panic>
+		panic("sys_page_map of a read-faulted page: %e", r);
+  8002d7:	50                   	push   %eax
+  8002d8:	68 74 2b 80 00       	push   $0x802b74
+  8002dd:	6a 3a                	push   $0x3a
+  8002df:	68 57 29 80 00       	push   $0x802957
+  8002e4:	e8 74 00 00 00       	call   80035d <_panic>
+		panic("sys_page_map of a read-faulted page didn't share it");
+  8002e9:	83 ec 04             	sub    $0x4,%esp
+  8002ec:	68 9c 2b 80 00       	push   $0x802b9c
+  8002f1:	6a 3d                	push   $0x3d
+  8002f3:	68 57 29 80 00       	push   $0x802957
+  8002f8:	e8 60 00 00 00       	call   80035d <_panic>
+
+008002fd <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002fd:	55                   	push   %ebp
+  8002fe:	89 e5                	mov    %esp,%ebp
+  800300:	56                   	push   %esi
+  800301:	53                   	push   %ebx
+  800302:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800305:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800308:	e8 e7 0a 00 00       	call   800df4 <sys_getenvid>
+  80030d:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800312:	c1 e0 09             	shl    $0x9,%eax
+  800315:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80031a:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80031f:	85 db                	test   %ebx,%ebx
+  800321:	7e 07                	jle    80032a <libmain+0x2d>
+		binaryname = argv[0];
+  800323:	8b 06                	mov    (%esi),%eax
+  800325:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80032a:	83 ec 08             	sub    $0x8,%esp
+  80032d:	56                   	push   %esi
+  80032e:	53                   	push   %ebx
+  80032f:	e8 ff fc ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800334:	e8 0a 00 00 00       	call   800343 <exit>
+}
+  800339:	83 c4 10             	add    $0x10,%esp
+  80033c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80033f:	5b                   	pop    %ebx
+  800340:	5e                   	pop    %esi
+  800341:	5d                   	pop    %ebp
+  800342:	c3                   	ret
+
+00800343 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800343:	55                   	push   %ebp
+  800344:	89 e5                	mov    %esp,%ebp
+  800346:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800349:	e8 3e 11 00 00       	call   80148c <close_all>
+	sys_env_destroy(0);
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	6a 00                	push   $0x0
+  800353:	e8 5b 0a 00 00       	call   800db3 <sys_env_destroy>
+}
+  800358:	83 c4 10             	add    $0x10,%esp
+  80035b:	c9                   	leave
+  80035c:	c3                   	ret
+
+0080035d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80035d:	55                   	push   %ebp
+  80035e:	89 e5                	mov    %esp,%ebp
+  800360:	56                   	push   %esi
+  800361:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800362:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800365:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80036b:	e8 84 0a 00 00       	call   800df4 <sys_getenvid>
+  800370:	83 ec 0c             	sub    $0xc,%esp
+  800373:	ff 75 0c             	push   0xc(%ebp)
+  800376:	ff 75 08             	push   0x8(%ebp)
+  800379:	56                   	push   %esi
+  80037a:	50                   	push   %eax
+  80037b:	68 18 2c 80 00       	push   $0x802c18
+  800380:	e8 b3 00 00 00       	call   800438 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800385:	83 c4 18             	add    $0x18,%esp
+  800388:	53                   	push   %ebx
+  800389:	ff 75 10             	push   0x10(%ebp)
+  80038c:	e8 56 00 00 00       	call   8003e7 <vcprintf>
+	cprintf("\n");
+  800391:	c7 04 24 80 30 80 00 	movl   $0x803080,(%esp)
+  800398:	e8 9b 00 00 00       	call   800438 <cprintf>
+  80039d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003a0:	cc                   	int3
+	while (1)
+  8003a1:	eb fd                	jmp    8003a0 <_panic+0x43>
+
+008003a3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003a3:	55                   	push   %ebp
+  8003a4:	89 e5                	mov    %esp,%ebp
+  8003a6:	53                   	push   %ebx
+  8003a7:	83 ec 04             	sub    $0x4,%esp
+  8003aa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003ad:	8b 13                	mov    (%ebx),%edx
+  8003af:	8d 42 01             	lea    0x1(%edx),%eax
+  8003b2:	89 03                	mov    %eax,(%ebx)
+  8003b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003b7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003bb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003c0:	74 09                	je     8003cb <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003c2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003c9:	c9                   	leave
+  8003ca:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003cb:	83 ec 08             	sub    $0x8,%esp
+  8003ce:	68 ff 00 00 00       	push   $0xff
+  8003d3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003d6:	50                   	push   %eax
+  8003d7:	e8 7a 09 00 00       	call   800d56 <sys_cputs>
+		b->idx = 0;
+  8003dc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003e2:	83 c4 10             	add    $0x10,%esp
+  8003e5:	eb db                	jmp    8003c2 <putch+0x1f>
+
+008003e7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003e7:	55                   	push   %ebp
+  8003e8:	89 e5                	mov    %esp,%ebp
+  8003ea:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003f0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003f7:	00 00 00 
+	b.cnt = 0;
+  8003fa:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800401:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800404:	ff 75 0c             	push   0xc(%ebp)
+  800407:	ff 75 08             	push   0x8(%ebp)
+  80040a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800410:	50                   	push   %eax
+  800411:	68 a3 03 80 00       	push   $0x8003a3
+  800416:	e8 14 01 00 00       	call   80052f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80041b:	83 c4 08             	add    $0x8,%esp
+  80041e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800424:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80042a:	50                   	push   %eax
+  80042b:	e8 26 09 00 00       	call   800d56 <sys_cputs>
+
+	return b.cnt;
+}
+  800430:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800436:	c9                   	leave
+  800437:	c3                   	ret
+
+00800438 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800438:	55                   	push   %ebp
+  800439:	89 e5                	mov    %esp,%ebp
+  80043b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80043e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800441:	50                   	push   %eax
+  800442:	ff 75 08             	push   0x8(%ebp)
+  800445:	e8 9d ff ff ff       	call   8003e7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80044a:	c9                   	leave
+  80044b:	c3                   	ret
+
+0080044c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80044c:	55                   	push   %ebp
+  80044d:	89 e5                	mov    %esp,%ebp
+  80044f:	57                   	push   %edi
+  800450:	56                   	push   %esi
+  800451:	53                   	push   %ebx
+  800452:	83 ec 1c             	sub    $0x1c,%esp
+  800455:	89 c7                	mov    %eax,%edi
+  800457:	89 d6                	mov    %edx,%esi
+  800459:	8b 45 08             	mov    0x8(%ebp),%eax
+  80045c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80045f:	89 d1                	mov    %edx,%ecx
+  800461:	89 c2                	mov    %eax,%edx
+  800463:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800466:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800469:	8b 45 10             	mov    0x10(%ebp),%eax
+  80046c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80046f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800472:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800479:	39 c2                	cmp    %eax,%edx
+  80047b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80047e:	72 3e                	jb     8004be <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800480:	83 ec 0c             	sub    $0xc,%esp
+  800483:	ff 75 18             	push   0x18(%ebp)
+  800486:	83 eb 01             	sub    $0x1,%ebx
+  800489:	53                   	push   %ebx
+  80048a:	50                   	push   %eax
+  80048b:	83 ec 08             	sub    $0x8,%esp
+  80048e:	ff 75 e4             	push   -0x1c(%ebp)
+  800491:	ff 75 e0             	push   -0x20(%ebp)
+  800494:	ff 75 dc             	push   -0x24(%ebp)
+  800497:	ff 75 d8             	push   -0x28(%ebp)
+  80049a:	e8 21 21 00 00       	call   8025c0 <__udivdi3>
+  80049f:	83 c4 18             	add    $0x18,%esp
+  8004a2:	52                   	push   %edx
+  8004a3:	50                   	push   %eax
+  8004a4:	89 f2                	mov    %esi,%edx
+  8004a6:	89 f8                	mov    %edi,%eax
+  8004a8:	e8 9f ff ff ff       	call   80044c <printnum>
+  8004ad:	83 c4 20             	add    $0x20,%esp
+  8004b0:	eb 13                	jmp    8004c5 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004b2:	83 ec 08             	sub    $0x8,%esp
+  8004b5:	56                   	push   %esi
+  8004b6:	ff 75 18             	push   0x18(%ebp)
+  8004b9:	ff d7                	call   *%edi
+  8004bb:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004be:	83 eb 01             	sub    $0x1,%ebx
+  8004c1:	85 db                	test   %ebx,%ebx
+  8004c3:	7f ed                	jg     8004b2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004c5:	83 ec 08             	sub    $0x8,%esp
+  8004c8:	56                   	push   %esi
+  8004c9:	83 ec 04             	sub    $0x4,%esp
+  8004cc:	ff 75 e4             	push   -0x1c(%ebp)
+  8004cf:	ff 75 e0             	push   -0x20(%ebp)
+  8004d2:	ff 75 dc             	push   -0x24(%ebp)
+  8004d5:	ff 75 d8             	push   -0x28(%ebp)
+  8004d8:	e8 a3 21 00 00       	call   802680 <__umoddi3>
+  8004dd:	83 c4 14             	add    $0x14,%esp
+  8004e0:	0f be 80 3b 2c 80 00 	movsbl 0x802c3b(%eax),%eax
+  8004e7:	50                   	push   %eax
+  8004e8:	ff d7                	call   *%edi
+}
+  8004ea:	83 c4 10             	add    $0x10,%esp
+  8004ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004f0:	5b                   	pop    %ebx
+  8004f1:	5e                   	pop    %esi
+  8004f2:	5f                   	pop    %edi
+  8004f3:	5d                   	pop    %ebp
+  8004f4:	c3                   	ret
+
+008004f5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004f5:	55                   	push   %ebp
+  8004f6:	89 e5                	mov    %esp,%ebp
+  8004f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004fb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004ff:	8b 10                	mov    (%eax),%edx
+  800501:	3b 50 04             	cmp    0x4(%eax),%edx
+  800504:	73 0a                	jae    800510 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800506:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800509:	89 08                	mov    %ecx,(%eax)
+  80050b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80050e:	88 02                	mov    %al,(%edx)
+}
+  800510:	5d                   	pop    %ebp
+  800511:	c3                   	ret
+
+00800512 <printfmt>:
+{
+  800512:	55                   	push   %ebp
+  800513:	89 e5                	mov    %esp,%ebp
+  800515:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800518:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80051b:	50                   	push   %eax
+  80051c:	ff 75 10             	push   0x10(%ebp)
+  80051f:	ff 75 0c             	push   0xc(%ebp)
+  800522:	ff 75 08             	push   0x8(%ebp)
+  800525:	e8 05 00 00 00       	call   80052f <vprintfmt>
+}
+  80052a:	83 c4 10             	add    $0x10,%esp
+  80052d:	c9                   	leave
+  80052e:	c3                   	ret
+
+0080052f <vprintfmt>:
+{
+  80052f:	55                   	push   %ebp
+  800530:	89 e5                	mov    %esp,%ebp
+  800532:	57                   	push   %edi
+  800533:	56                   	push   %esi
+  800534:	53                   	push   %ebx
+  800535:	83 ec 2c             	sub    $0x2c,%esp
+  800538:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80053e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800541:	eb 0a                	jmp    80054d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800543:	83 ec 08             	sub    $0x8,%esp
+  800546:	53                   	push   %ebx
+  800547:	50                   	push   %eax
+  800548:	ff d6                	call   *%esi
+  80054a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80054d:	83 c7 01             	add    $0x1,%edi
+  800550:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800554:	83 f8 25             	cmp    $0x25,%eax
+  800557:	74 0c                	je     800565 <vprintfmt+0x36>
+			if (ch == '\0')
+  800559:	85 c0                	test   %eax,%eax
+  80055b:	75 e6                	jne    800543 <vprintfmt+0x14>
+}
+  80055d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800560:	5b                   	pop    %ebx
+  800561:	5e                   	pop    %esi
+  800562:	5f                   	pop    %edi
+  800563:	5d                   	pop    %ebp
+  800564:	c3                   	ret
+		padc = ' ';
+  800565:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800569:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800570:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800577:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80057e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800583:	8d 47 01             	lea    0x1(%edi),%eax
+  800586:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800589:	0f b6 17             	movzbl (%edi),%edx
+  80058c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80058f:	3c 55                	cmp    $0x55,%al
+  800591:	0f 87 cf 03 00 00    	ja     800966 <vprintfmt+0x437>
+  800597:	0f b6 c0             	movzbl %al,%eax
+  80059a:	ff 24 85 80 2d 80 00 	jmp    *0x802d80(,%eax,4)
+  8005a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8005a4:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8005a8:	eb d9                	jmp    800583 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005ad:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8005b1:	eb d0                	jmp    800583 <vprintfmt+0x54>
+  8005b3:	0f b6 d2             	movzbl %dl,%edx
+  8005b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8005b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005be:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8005c1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005c4:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005c8:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005cb:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005ce:	83 f9 09             	cmp    $0x9,%ecx
+  8005d1:	77 55                	ja     800628 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005d3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005d6:	eb e9                	jmp    8005c1 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005db:	8b 00                	mov    (%eax),%eax
+  8005dd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005ec:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005f0:	79 91                	jns    800583 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005f2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005ff:	eb 82                	jmp    800583 <vprintfmt+0x54>
+			if (width < 0)
+  800601:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800604:	85 d2                	test   %edx,%edx
+  800606:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060b:	0f 49 c2             	cmovns %edx,%eax
+  80060e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800611:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800614:	e9 6a ff ff ff       	jmp    800583 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800619:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80061c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800623:	e9 5b ff ff ff       	jmp    800583 <vprintfmt+0x54>
+  800628:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80062b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80062e:	eb bc                	jmp    8005ec <vprintfmt+0xbd>
+			lflag++;
+  800630:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800633:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800636:	e9 48 ff ff ff       	jmp    800583 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8d 78 04             	lea    0x4(%eax),%edi
+  800641:	83 ec 08             	sub    $0x8,%esp
+  800644:	53                   	push   %ebx
+  800645:	ff 30                	push   (%eax)
+  800647:	ff d6                	call   *%esi
+			break;
+  800649:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80064c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80064f:	e9 b1 02 00 00       	jmp    800905 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80065a:	8b 10                	mov    (%eax),%edx
+  80065c:	89 d0                	mov    %edx,%eax
+  80065e:	f7 d8                	neg    %eax
+  800660:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800663:	83 f8 0f             	cmp    $0xf,%eax
+  800666:	7f 23                	jg     80068b <vprintfmt+0x15c>
+  800668:	8b 14 85 e0 2e 80 00 	mov    0x802ee0(,%eax,4),%edx
+  80066f:	85 d2                	test   %edx,%edx
+  800671:	74 18                	je     80068b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800673:	52                   	push   %edx
+  800674:	68 15 30 80 00       	push   $0x803015
+  800679:	53                   	push   %ebx
+  80067a:	56                   	push   %esi
+  80067b:	e8 92 fe ff ff       	call   800512 <printfmt>
+  800680:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800683:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800686:	e9 7a 02 00 00       	jmp    800905 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80068b:	50                   	push   %eax
+  80068c:	68 53 2c 80 00       	push   $0x802c53
+  800691:	53                   	push   %ebx
+  800692:	56                   	push   %esi
+  800693:	e8 7a fe ff ff       	call   800512 <printfmt>
+  800698:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80069b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80069e:	e9 62 02 00 00       	jmp    800905 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	83 c0 04             	add    $0x4,%eax
+  8006a9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006b1:	85 c9                	test   %ecx,%ecx
+  8006b3:	b8 4c 2c 80 00       	mov    $0x802c4c,%eax
+  8006b8:	0f 45 c1             	cmovne %ecx,%eax
+  8006bb:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8006be:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006c2:	7e 06                	jle    8006ca <vprintfmt+0x19b>
+  8006c4:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006c8:	75 0b                	jne    8006d5 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006ca:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006cd:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006d0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006d3:	eb 5c                	jmp    800731 <vprintfmt+0x202>
+  8006d5:	83 ec 08             	sub    $0x8,%esp
+  8006d8:	ff 75 d0             	push   -0x30(%ebp)
+  8006db:	ff 75 cc             	push   -0x34(%ebp)
+  8006de:	e8 20 03 00 00       	call   800a03 <strnlen>
+  8006e3:	89 c2                	mov    %eax,%edx
+  8006e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006e8:	29 d0                	sub    %edx,%eax
+  8006ea:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006ed:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006f1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006f4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006f7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006f9:	eb 0e                	jmp    800709 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8006fb:	83 ec 08             	sub    $0x8,%esp
+  8006fe:	53                   	push   %ebx
+  8006ff:	57                   	push   %edi
+  800700:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800703:	83 ee 01             	sub    $0x1,%esi
+  800706:	83 c4 10             	add    $0x10,%esp
+  800709:	85 f6                	test   %esi,%esi
+  80070b:	7f ee                	jg     8006fb <vprintfmt+0x1cc>
+  80070d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800710:	8b 75 08             	mov    0x8(%ebp),%esi
+  800713:	85 c0                	test   %eax,%eax
+  800715:	ba 00 00 00 00       	mov    $0x0,%edx
+  80071a:	0f 49 d0             	cmovns %eax,%edx
+  80071d:	29 d0                	sub    %edx,%eax
+  80071f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800722:	eb a6                	jmp    8006ca <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800724:	83 ec 08             	sub    $0x8,%esp
+  800727:	53                   	push   %ebx
+  800728:	52                   	push   %edx
+  800729:	ff 55 08             	call   *0x8(%ebp)
+  80072c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80072f:	89 f1                	mov    %esi,%ecx
+  800731:	8d 71 01             	lea    0x1(%ecx),%esi
+  800734:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800738:	0f be d0             	movsbl %al,%edx
+  80073b:	85 d2                	test   %edx,%edx
+  80073d:	74 28                	je     800767 <vprintfmt+0x238>
+  80073f:	85 ff                	test   %edi,%edi
+  800741:	78 05                	js     800748 <vprintfmt+0x219>
+  800743:	83 ef 01             	sub    $0x1,%edi
+  800746:	78 30                	js     800778 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800748:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80074c:	74 d6                	je     800724 <vprintfmt+0x1f5>
+  80074e:	0f be c0             	movsbl %al,%eax
+  800751:	83 e8 20             	sub    $0x20,%eax
+  800754:	83 f8 5e             	cmp    $0x5e,%eax
+  800757:	76 cb                	jbe    800724 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800759:	83 ec 08             	sub    $0x8,%esp
+  80075c:	53                   	push   %ebx
+  80075d:	6a 3f                	push   $0x3f
+  80075f:	ff 55 08             	call   *0x8(%ebp)
+  800762:	83 c4 10             	add    $0x10,%esp
+  800765:	eb c8                	jmp    80072f <vprintfmt+0x200>
+  800767:	8b 75 08             	mov    0x8(%ebp),%esi
+  80076a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80076d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800770:	01 d0                	add    %edx,%eax
+  800772:	29 c8                	sub    %ecx,%eax
+  800774:	89 c7                	mov    %eax,%edi
+  800776:	eb 13                	jmp    80078b <vprintfmt+0x25c>
+  800778:	8b 75 08             	mov    0x8(%ebp),%esi
+  80077b:	eb ed                	jmp    80076a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80077d:	83 ec 08             	sub    $0x8,%esp
+  800780:	53                   	push   %ebx
+  800781:	6a 20                	push   $0x20
+  800783:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800785:	83 ef 01             	sub    $0x1,%edi
+  800788:	83 c4 10             	add    $0x10,%esp
+  80078b:	85 ff                	test   %edi,%edi
+  80078d:	7f ee                	jg     80077d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80078f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800792:	89 45 14             	mov    %eax,0x14(%ebp)
+  800795:	e9 6b 01 00 00       	jmp    800905 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80079a:	83 f9 01             	cmp    $0x1,%ecx
+  80079d:	7f 1f                	jg     8007be <vprintfmt+0x28f>
+	else if (lflag)
+  80079f:	85 c9                	test   %ecx,%ecx
+  8007a1:	74 67                	je     80080a <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8007a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a6:	8b 00                	mov    (%eax),%eax
+  8007a8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ab:	89 c1                	mov    %eax,%ecx
+  8007ad:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007b0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007bc:	eb 17                	jmp    8007d5 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8007be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c1:	8b 50 04             	mov    0x4(%eax),%edx
+  8007c4:	8b 00                	mov    (%eax),%eax
+  8007c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007c9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cf:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007d5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007d8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007db:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007e0:	85 c9                	test   %ecx,%ecx
+  8007e2:	0f 89 03 01 00 00    	jns    8008eb <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8007e8:	83 ec 08             	sub    $0x8,%esp
+  8007eb:	53                   	push   %ebx
+  8007ec:	6a 2d                	push   $0x2d
+  8007ee:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007f0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007f3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007f6:	f7 da                	neg    %edx
+  8007f8:	83 d1 00             	adc    $0x0,%ecx
+  8007fb:	f7 d9                	neg    %ecx
+  8007fd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800800:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800805:	e9 e1 00 00 00       	jmp    8008eb <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80080a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080d:	8b 00                	mov    (%eax),%eax
+  80080f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800812:	89 c1                	mov    %eax,%ecx
+  800814:	c1 f9 1f             	sar    $0x1f,%ecx
+  800817:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80081a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081d:	8d 40 04             	lea    0x4(%eax),%eax
+  800820:	89 45 14             	mov    %eax,0x14(%ebp)
+  800823:	eb b0                	jmp    8007d5 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800825:	83 f9 01             	cmp    $0x1,%ecx
+  800828:	7f 1e                	jg     800848 <vprintfmt+0x319>
+	else if (lflag)
+  80082a:	85 c9                	test   %ecx,%ecx
+  80082c:	74 32                	je     800860 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80082e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800831:	8b 10                	mov    (%eax),%edx
+  800833:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800838:	8d 40 04             	lea    0x4(%eax),%eax
+  80083b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80083e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800843:	e9 a3 00 00 00       	jmp    8008eb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800848:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084b:	8b 10                	mov    (%eax),%edx
+  80084d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800850:	8d 40 08             	lea    0x8(%eax),%eax
+  800853:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800856:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80085b:	e9 8b 00 00 00       	jmp    8008eb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800860:	8b 45 14             	mov    0x14(%ebp),%eax
+  800863:	8b 10                	mov    (%eax),%edx
+  800865:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80086a:	8d 40 04             	lea    0x4(%eax),%eax
+  80086d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800870:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800875:	eb 74                	jmp    8008eb <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800877:	83 f9 01             	cmp    $0x1,%ecx
+  80087a:	7f 1b                	jg     800897 <vprintfmt+0x368>
+	else if (lflag)
+  80087c:	85 c9                	test   %ecx,%ecx
+  80087e:	74 2c                	je     8008ac <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800880:	8b 45 14             	mov    0x14(%ebp),%eax
+  800883:	8b 10                	mov    (%eax),%edx
+  800885:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80088a:	8d 40 04             	lea    0x4(%eax),%eax
+  80088d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800890:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800895:	eb 54                	jmp    8008eb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800897:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089a:	8b 10                	mov    (%eax),%edx
+  80089c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80089f:	8d 40 08             	lea    0x8(%eax),%eax
+  8008a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008a5:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8008aa:	eb 3f                	jmp    8008eb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008af:	8b 10                	mov    (%eax),%edx
+  8008b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008bc:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8008c1:	eb 28                	jmp    8008eb <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8008c3:	83 ec 08             	sub    $0x8,%esp
+  8008c6:	53                   	push   %ebx
+  8008c7:	6a 30                	push   $0x30
+  8008c9:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008cb:	83 c4 08             	add    $0x8,%esp
+  8008ce:	53                   	push   %ebx
+  8008cf:	6a 78                	push   $0x78
+  8008d1:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d6:	8b 10                	mov    (%eax),%edx
+  8008d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008dd:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008e6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8008eb:	83 ec 0c             	sub    $0xc,%esp
+  8008ee:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008f2:	50                   	push   %eax
+  8008f3:	ff 75 e0             	push   -0x20(%ebp)
+  8008f6:	57                   	push   %edi
+  8008f7:	51                   	push   %ecx
+  8008f8:	52                   	push   %edx
+  8008f9:	89 da                	mov    %ebx,%edx
+  8008fb:	89 f0                	mov    %esi,%eax
+  8008fd:	e8 4a fb ff ff       	call   80044c <printnum>
+			break;
+  800902:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800905:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800908:	e9 40 fc ff ff       	jmp    80054d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80090d:	83 f9 01             	cmp    $0x1,%ecx
+  800910:	7f 1b                	jg     80092d <vprintfmt+0x3fe>
+	else if (lflag)
+  800912:	85 c9                	test   %ecx,%ecx
+  800914:	74 2c                	je     800942 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800916:	8b 45 14             	mov    0x14(%ebp),%eax
+  800919:	8b 10                	mov    (%eax),%edx
+  80091b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800920:	8d 40 04             	lea    0x4(%eax),%eax
+  800923:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800926:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80092b:	eb be                	jmp    8008eb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80092d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800930:	8b 10                	mov    (%eax),%edx
+  800932:	8b 48 04             	mov    0x4(%eax),%ecx
+  800935:	8d 40 08             	lea    0x8(%eax),%eax
+  800938:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80093b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800940:	eb a9                	jmp    8008eb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800942:	8b 45 14             	mov    0x14(%ebp),%eax
+  800945:	8b 10                	mov    (%eax),%edx
+  800947:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094c:	8d 40 04             	lea    0x4(%eax),%eax
+  80094f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800952:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800957:	eb 92                	jmp    8008eb <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800959:	83 ec 08             	sub    $0x8,%esp
+  80095c:	53                   	push   %ebx
+  80095d:	6a 25                	push   $0x25
+  80095f:	ff d6                	call   *%esi
+			break;
+  800961:	83 c4 10             	add    $0x10,%esp
+  800964:	eb 9f                	jmp    800905 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800966:	83 ec 08             	sub    $0x8,%esp
+  800969:	53                   	push   %ebx
+  80096a:	6a 25                	push   $0x25
+  80096c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80096e:	83 c4 10             	add    $0x10,%esp
+  800971:	89 f8                	mov    %edi,%eax
+  800973:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800977:	74 05                	je     80097e <vprintfmt+0x44f>
+  800979:	83 e8 01             	sub    $0x1,%eax
+  80097c:	eb f5                	jmp    800973 <vprintfmt+0x444>
+  80097e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800981:	eb 82                	jmp    800905 <vprintfmt+0x3d6>
+
+00800983 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800983:	55                   	push   %ebp
+  800984:	89 e5                	mov    %esp,%ebp
+  800986:	83 ec 18             	sub    $0x18,%esp
+  800989:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80098f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800992:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800996:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800999:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009a0:	85 c0                	test   %eax,%eax
+  8009a2:	74 26                	je     8009ca <vsnprintf+0x47>
+  8009a4:	85 d2                	test   %edx,%edx
+  8009a6:	7e 22                	jle    8009ca <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009a8:	ff 75 14             	push   0x14(%ebp)
+  8009ab:	ff 75 10             	push   0x10(%ebp)
+  8009ae:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009b1:	50                   	push   %eax
+  8009b2:	68 f5 04 80 00       	push   $0x8004f5
+  8009b7:	e8 73 fb ff ff       	call   80052f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009bc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009bf:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009c5:	83 c4 10             	add    $0x10,%esp
+}
+  8009c8:	c9                   	leave
+  8009c9:	c3                   	ret
+		return -E_INVAL;
+  8009ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009cf:	eb f7                	jmp    8009c8 <vsnprintf+0x45>
+
+008009d1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009d7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009da:	50                   	push   %eax
+  8009db:	ff 75 10             	push   0x10(%ebp)
+  8009de:	ff 75 0c             	push   0xc(%ebp)
+  8009e1:	ff 75 08             	push   0x8(%ebp)
+  8009e4:	e8 9a ff ff ff       	call   800983 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009e9:	c9                   	leave
+  8009ea:	c3                   	ret
+
+008009eb <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009eb:	55                   	push   %ebp
+  8009ec:	89 e5                	mov    %esp,%ebp
+  8009ee:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f6:	eb 03                	jmp    8009fb <strlen+0x10>
+		n++;
+  8009f8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009fb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009ff:	75 f7                	jne    8009f8 <strlen+0xd>
+	return n;
+}
+  800a01:	5d                   	pop    %ebp
+  800a02:	c3                   	ret
+
+00800a03 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a03:	55                   	push   %ebp
+  800a04:	89 e5                	mov    %esp,%ebp
+  800a06:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a09:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a11:	eb 03                	jmp    800a16 <strnlen+0x13>
+		n++;
+  800a13:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a16:	39 d0                	cmp    %edx,%eax
+  800a18:	74 08                	je     800a22 <strnlen+0x1f>
+  800a1a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a1e:	75 f3                	jne    800a13 <strnlen+0x10>
+  800a20:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a22:	89 d0                	mov    %edx,%eax
+  800a24:	5d                   	pop    %ebp
+  800a25:	c3                   	ret
+
+00800a26 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a26:	55                   	push   %ebp
+  800a27:	89 e5                	mov    %esp,%ebp
+  800a29:	53                   	push   %ebx
+  800a2a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a2d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a35:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a39:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a3c:	83 c0 01             	add    $0x1,%eax
+  800a3f:	84 d2                	test   %dl,%dl
+  800a41:	75 f2                	jne    800a35 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a43:	89 c8                	mov    %ecx,%eax
+  800a45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a48:	c9                   	leave
+  800a49:	c3                   	ret
+
+00800a4a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a4a:	55                   	push   %ebp
+  800a4b:	89 e5                	mov    %esp,%ebp
+  800a4d:	53                   	push   %ebx
+  800a4e:	83 ec 10             	sub    $0x10,%esp
+  800a51:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a54:	53                   	push   %ebx
+  800a55:	e8 91 ff ff ff       	call   8009eb <strlen>
+  800a5a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a5d:	ff 75 0c             	push   0xc(%ebp)
+  800a60:	01 d8                	add    %ebx,%eax
+  800a62:	50                   	push   %eax
+  800a63:	e8 be ff ff ff       	call   800a26 <strcpy>
+	return dst;
+}
+  800a68:	89 d8                	mov    %ebx,%eax
+  800a6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a6d:	c9                   	leave
+  800a6e:	c3                   	ret
+
+00800a6f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a6f:	55                   	push   %ebp
+  800a70:	89 e5                	mov    %esp,%ebp
+  800a72:	56                   	push   %esi
+  800a73:	53                   	push   %ebx
+  800a74:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a77:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a7a:	89 f3                	mov    %esi,%ebx
+  800a7c:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a7f:	89 f0                	mov    %esi,%eax
+  800a81:	eb 0f                	jmp    800a92 <strncpy+0x23>
+		*dst++ = *src;
+  800a83:	83 c0 01             	add    $0x1,%eax
+  800a86:	0f b6 0a             	movzbl (%edx),%ecx
+  800a89:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a8c:	80 f9 01             	cmp    $0x1,%cl
+  800a8f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a92:	39 d8                	cmp    %ebx,%eax
+  800a94:	75 ed                	jne    800a83 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a96:	89 f0                	mov    %esi,%eax
+  800a98:	5b                   	pop    %ebx
+  800a99:	5e                   	pop    %esi
+  800a9a:	5d                   	pop    %ebp
+  800a9b:	c3                   	ret
+
+00800a9c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a9c:	55                   	push   %ebp
+  800a9d:	89 e5                	mov    %esp,%ebp
+  800a9f:	56                   	push   %esi
+  800aa0:	53                   	push   %ebx
+  800aa1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aa7:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800aaa:	89 f0                	mov    %esi,%eax
+  800aac:	85 d2                	test   %edx,%edx
+  800aae:	74 21                	je     800ad1 <strlcpy+0x35>
+  800ab0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800ab4:	89 f2                	mov    %esi,%edx
+  800ab6:	eb 09                	jmp    800ac1 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ab8:	83 c1 01             	add    $0x1,%ecx
+  800abb:	83 c2 01             	add    $0x1,%edx
+  800abe:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ac1:	39 c2                	cmp    %eax,%edx
+  800ac3:	74 09                	je     800ace <strlcpy+0x32>
+  800ac5:	0f b6 19             	movzbl (%ecx),%ebx
+  800ac8:	84 db                	test   %bl,%bl
+  800aca:	75 ec                	jne    800ab8 <strlcpy+0x1c>
+  800acc:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800ace:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ad1:	29 f0                	sub    %esi,%eax
+}
+  800ad3:	5b                   	pop    %ebx
+  800ad4:	5e                   	pop    %esi
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+
+00800ad7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800add:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ae0:	eb 06                	jmp    800ae8 <strcmp+0x11>
+		p++, q++;
+  800ae2:	83 c1 01             	add    $0x1,%ecx
+  800ae5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ae8:	0f b6 01             	movzbl (%ecx),%eax
+  800aeb:	84 c0                	test   %al,%al
+  800aed:	74 04                	je     800af3 <strcmp+0x1c>
+  800aef:	3a 02                	cmp    (%edx),%al
+  800af1:	74 ef                	je     800ae2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800af3:	0f b6 c0             	movzbl %al,%eax
+  800af6:	0f b6 12             	movzbl (%edx),%edx
+  800af9:	29 d0                	sub    %edx,%eax
+}
+  800afb:	5d                   	pop    %ebp
+  800afc:	c3                   	ret
+
+00800afd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	53                   	push   %ebx
+  800b01:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b07:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b0a:	eb 09                	jmp    800b15 <strncmp+0x18>
+		n--, p++, q++;
+  800b0c:	83 ea 01             	sub    $0x1,%edx
+  800b0f:	83 c0 01             	add    $0x1,%eax
+  800b12:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b15:	85 d2                	test   %edx,%edx
+  800b17:	74 18                	je     800b31 <strncmp+0x34>
+  800b19:	0f b6 18             	movzbl (%eax),%ebx
+  800b1c:	84 db                	test   %bl,%bl
+  800b1e:	74 04                	je     800b24 <strncmp+0x27>
+  800b20:	3a 19                	cmp    (%ecx),%bl
+  800b22:	74 e8                	je     800b0c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b24:	0f b6 00             	movzbl (%eax),%eax
+  800b27:	0f b6 11             	movzbl (%ecx),%edx
+  800b2a:	29 d0                	sub    %edx,%eax
+}
+  800b2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b2f:	c9                   	leave
+  800b30:	c3                   	ret
+		return 0;
+  800b31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b36:	eb f4                	jmp    800b2c <strncmp+0x2f>
+
+00800b38 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b38:	55                   	push   %ebp
+  800b39:	89 e5                	mov    %esp,%ebp
+  800b3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b42:	eb 03                	jmp    800b47 <strchr+0xf>
+  800b44:	83 c0 01             	add    $0x1,%eax
+  800b47:	0f b6 10             	movzbl (%eax),%edx
+  800b4a:	84 d2                	test   %dl,%dl
+  800b4c:	74 06                	je     800b54 <strchr+0x1c>
+		if (*s == c)
+  800b4e:	38 ca                	cmp    %cl,%dl
+  800b50:	75 f2                	jne    800b44 <strchr+0xc>
+  800b52:	eb 05                	jmp    800b59 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b59:	5d                   	pop    %ebp
+  800b5a:	c3                   	ret
+
+00800b5b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b5b:	55                   	push   %ebp
+  800b5c:	89 e5                	mov    %esp,%ebp
+  800b5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b61:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b65:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b68:	38 ca                	cmp    %cl,%dl
+  800b6a:	74 09                	je     800b75 <strfind+0x1a>
+  800b6c:	84 d2                	test   %dl,%dl
+  800b6e:	74 05                	je     800b75 <strfind+0x1a>
+	for (; *s; s++)
+  800b70:	83 c0 01             	add    $0x1,%eax
+  800b73:	eb f0                	jmp    800b65 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b75:	5d                   	pop    %ebp
+  800b76:	c3                   	ret
+
+00800b77 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	57                   	push   %edi
+  800b7b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b7e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b81:	85 c9                	test   %ecx,%ecx
+  800b83:	74 20                	je     800ba5 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b85:	89 f8                	mov    %edi,%eax
+  800b87:	09 c8                	or     %ecx,%eax
+  800b89:	a8 03                	test   $0x3,%al
+  800b8b:	75 12                	jne    800b9f <memset+0x28>
+		c &= 0xFF;
+  800b8d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b91:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b97:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b9a:	fc                   	cld
+  800b9b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b9d:	eb 06                	jmp    800ba5 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ba2:	fc                   	cld
+  800ba3:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ba5:	89 f8                	mov    %edi,%eax
+  800ba7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800baa:	c9                   	leave
+  800bab:	c3                   	ret
+
+00800bac <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	57                   	push   %edi
+  800bb0:	56                   	push   %esi
+  800bb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bb7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bba:	39 c6                	cmp    %eax,%esi
+  800bbc:	73 32                	jae    800bf0 <memmove+0x44>
+  800bbe:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bc1:	39 d0                	cmp    %edx,%eax
+  800bc3:	73 2b                	jae    800bf0 <memmove+0x44>
+		s += n;
+		d += n;
+  800bc5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bc8:	89 d6                	mov    %edx,%esi
+  800bca:	09 fe                	or     %edi,%esi
+  800bcc:	09 ce                	or     %ecx,%esi
+  800bce:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bd4:	75 0e                	jne    800be4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bd6:	83 ef 04             	sub    $0x4,%edi
+  800bd9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bdc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bdf:	fd                   	std
+  800be0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800be2:	eb 09                	jmp    800bed <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800be4:	83 ef 01             	sub    $0x1,%edi
+  800be7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bea:	fd                   	std
+  800beb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bed:	fc                   	cld
+  800bee:	eb 1a                	jmp    800c0a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bf0:	89 f2                	mov    %esi,%edx
+  800bf2:	09 c2                	or     %eax,%edx
+  800bf4:	09 ca                	or     %ecx,%edx
+  800bf6:	f6 c2 03             	test   $0x3,%dl
+  800bf9:	75 0a                	jne    800c05 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bfb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bfe:	89 c7                	mov    %eax,%edi
+  800c00:	fc                   	cld
+  800c01:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c03:	eb 05                	jmp    800c0a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c05:	89 c7                	mov    %eax,%edi
+  800c07:	fc                   	cld
+  800c08:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c0a:	5e                   	pop    %esi
+  800c0b:	5f                   	pop    %edi
+  800c0c:	5d                   	pop    %ebp
+  800c0d:	c3                   	ret
+
+00800c0e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c0e:	55                   	push   %ebp
+  800c0f:	89 e5                	mov    %esp,%ebp
+  800c11:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c14:	ff 75 10             	push   0x10(%ebp)
+  800c17:	ff 75 0c             	push   0xc(%ebp)
+  800c1a:	ff 75 08             	push   0x8(%ebp)
+  800c1d:	e8 8a ff ff ff       	call   800bac <memmove>
+}
+  800c22:	c9                   	leave
+  800c23:	c3                   	ret
+
+00800c24 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	56                   	push   %esi
+  800c28:	53                   	push   %ebx
+  800c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c2c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c2f:	89 c6                	mov    %eax,%esi
+  800c31:	03 75 10             	add    0x10(%ebp),%esi
+  800c34:	eb 06                	jmp    800c3c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c36:	83 c0 01             	add    $0x1,%eax
+  800c39:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c3c:	39 f0                	cmp    %esi,%eax
+  800c3e:	74 14                	je     800c54 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c40:	0f b6 08             	movzbl (%eax),%ecx
+  800c43:	0f b6 1a             	movzbl (%edx),%ebx
+  800c46:	38 d9                	cmp    %bl,%cl
+  800c48:	74 ec                	je     800c36 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c4a:	0f b6 c1             	movzbl %cl,%eax
+  800c4d:	0f b6 db             	movzbl %bl,%ebx
+  800c50:	29 d8                	sub    %ebx,%eax
+  800c52:	eb 05                	jmp    800c59 <memcmp+0x35>
+	}
+
+	return 0;
+  800c54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c59:	5b                   	pop    %ebx
+  800c5a:	5e                   	pop    %esi
+  800c5b:	5d                   	pop    %ebp
+  800c5c:	c3                   	ret
+
+00800c5d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c5d:	55                   	push   %ebp
+  800c5e:	89 e5                	mov    %esp,%ebp
+  800c60:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c66:	89 c2                	mov    %eax,%edx
+  800c68:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c6b:	eb 03                	jmp    800c70 <memfind+0x13>
+  800c6d:	83 c0 01             	add    $0x1,%eax
+  800c70:	39 d0                	cmp    %edx,%eax
+  800c72:	73 04                	jae    800c78 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c74:	38 08                	cmp    %cl,(%eax)
+  800c76:	75 f5                	jne    800c6d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c78:	5d                   	pop    %ebp
+  800c79:	c3                   	ret
+
+00800c7a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c7a:	55                   	push   %ebp
+  800c7b:	89 e5                	mov    %esp,%ebp
+  800c7d:	57                   	push   %edi
+  800c7e:	56                   	push   %esi
+  800c7f:	53                   	push   %ebx
+  800c80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c83:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c86:	eb 03                	jmp    800c8b <strtol+0x11>
+		s++;
+  800c88:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c8b:	0f b6 02             	movzbl (%edx),%eax
+  800c8e:	3c 20                	cmp    $0x20,%al
+  800c90:	74 f6                	je     800c88 <strtol+0xe>
+  800c92:	3c 09                	cmp    $0x9,%al
+  800c94:	74 f2                	je     800c88 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c96:	3c 2b                	cmp    $0x2b,%al
+  800c98:	74 2a                	je     800cc4 <strtol+0x4a>
+	int neg = 0;
+  800c9a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c9f:	3c 2d                	cmp    $0x2d,%al
+  800ca1:	74 2b                	je     800cce <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ca3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ca9:	75 0f                	jne    800cba <strtol+0x40>
+  800cab:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cae:	74 28                	je     800cd8 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cb0:	85 db                	test   %ebx,%ebx
+  800cb2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cb7:	0f 44 d8             	cmove  %eax,%ebx
+  800cba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cbf:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cc2:	eb 46                	jmp    800d0a <strtol+0x90>
+		s++;
+  800cc4:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800cc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ccc:	eb d5                	jmp    800ca3 <strtol+0x29>
+		s++, neg = 1;
+  800cce:	83 c2 01             	add    $0x1,%edx
+  800cd1:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cd6:	eb cb                	jmp    800ca3 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cd8:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cdc:	74 0e                	je     800cec <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800cde:	85 db                	test   %ebx,%ebx
+  800ce0:	75 d8                	jne    800cba <strtol+0x40>
+		s++, base = 8;
+  800ce2:	83 c2 01             	add    $0x1,%edx
+  800ce5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cea:	eb ce                	jmp    800cba <strtol+0x40>
+		s += 2, base = 16;
+  800cec:	83 c2 02             	add    $0x2,%edx
+  800cef:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cf4:	eb c4                	jmp    800cba <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cf6:	0f be c0             	movsbl %al,%eax
+  800cf9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800cfc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cff:	7d 3a                	jge    800d3b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d01:	83 c2 01             	add    $0x1,%edx
+  800d04:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d08:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d0a:	0f b6 02             	movzbl (%edx),%eax
+  800d0d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d10:	89 f3                	mov    %esi,%ebx
+  800d12:	80 fb 09             	cmp    $0x9,%bl
+  800d15:	76 df                	jbe    800cf6 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d17:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d1a:	89 f3                	mov    %esi,%ebx
+  800d1c:	80 fb 19             	cmp    $0x19,%bl
+  800d1f:	77 08                	ja     800d29 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d21:	0f be c0             	movsbl %al,%eax
+  800d24:	83 e8 57             	sub    $0x57,%eax
+  800d27:	eb d3                	jmp    800cfc <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d29:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d2c:	89 f3                	mov    %esi,%ebx
+  800d2e:	80 fb 19             	cmp    $0x19,%bl
+  800d31:	77 08                	ja     800d3b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d33:	0f be c0             	movsbl %al,%eax
+  800d36:	83 e8 37             	sub    $0x37,%eax
+  800d39:	eb c1                	jmp    800cfc <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d3b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d3f:	74 05                	je     800d46 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d44:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d46:	89 c8                	mov    %ecx,%eax
+  800d48:	f7 d8                	neg    %eax
+  800d4a:	85 ff                	test   %edi,%edi
+  800d4c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d4f:	89 c8                	mov    %ecx,%eax
+  800d51:	5b                   	pop    %ebx
+  800d52:	5e                   	pop    %esi
+  800d53:	5f                   	pop    %edi
+  800d54:	5d                   	pop    %ebp
+  800d55:	c3                   	ret
+
+00800d56 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	57                   	push   %edi
+  800d5a:	56                   	push   %esi
+  800d5b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d67:	89 c3                	mov    %eax,%ebx
+  800d69:	89 c7                	mov    %eax,%edi
+  800d6b:	89 c6                	mov    %eax,%esi
+  800d6d:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d6f:	5b                   	pop    %ebx
+  800d70:	5e                   	pop    %esi
+  800d71:	5f                   	pop    %edi
+  800d72:	5d                   	pop    %ebp
+  800d73:	c3                   	ret
+
+00800d74 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d74:	55                   	push   %ebp
+  800d75:	89 e5                	mov    %esp,%ebp
+  800d77:	57                   	push   %edi
+  800d78:	56                   	push   %esi
+  800d79:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d84:	89 d1                	mov    %edx,%ecx
+  800d86:	89 d3                	mov    %edx,%ebx
+  800d88:	89 d7                	mov    %edx,%edi
+  800d8a:	89 d6                	mov    %edx,%esi
+  800d8c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d8e:	5b                   	pop    %ebx
+  800d8f:	5e                   	pop    %esi
+  800d90:	5f                   	pop    %edi
+  800d91:	5d                   	pop    %ebp
+  800d92:	c3                   	ret
+
+00800d93 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800d93:	55                   	push   %ebp
+  800d94:	89 e5                	mov    %esp,%ebp
+  800d96:	57                   	push   %edi
+  800d97:	56                   	push   %esi
+  800d98:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800da6:	89 cb                	mov    %ecx,%ebx
+  800da8:	89 cf                	mov    %ecx,%edi
+  800daa:	89 ce                	mov    %ecx,%esi
+  800dac:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800dae:	5b                   	pop    %ebx
+  800daf:	5e                   	pop    %esi
+  800db0:	5f                   	pop    %edi
+  800db1:	5d                   	pop    %ebp
+  800db2:	c3                   	ret
+
+00800db3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800db3:	55                   	push   %ebp
+  800db4:	89 e5                	mov    %esp,%ebp
+  800db6:	57                   	push   %edi
+  800db7:	56                   	push   %esi
+  800db8:	53                   	push   %ebx
+  800db9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dbc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dc9:	89 cb                	mov    %ecx,%ebx
+  800dcb:	89 cf                	mov    %ecx,%edi
+  800dcd:	89 ce                	mov    %ecx,%esi
+  800dcf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dd1:	85 c0                	test   %eax,%eax
+  800dd3:	7f 08                	jg     800ddd <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800dd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd8:	5b                   	pop    %ebx
+  800dd9:	5e                   	pop    %esi
+  800dda:	5f                   	pop    %edi
+  800ddb:	5d                   	pop    %ebp
+  800ddc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ddd:	83 ec 0c             	sub    $0xc,%esp
+  800de0:	50                   	push   %eax
+  800de1:	6a 03                	push   $0x3
+  800de3:	68 3f 2f 80 00       	push   $0x802f3f
+  800de8:	6a 23                	push   $0x23
+  800dea:	68 5c 2f 80 00       	push   $0x802f5c
+  800def:	e8 69 f5 ff ff       	call   80035d <_panic>
+
+00800df4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dff:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e04:	89 d1                	mov    %edx,%ecx
+  800e06:	89 d3                	mov    %edx,%ebx
+  800e08:	89 d7                	mov    %edx,%edi
+  800e0a:	89 d6                	mov    %edx,%esi
+  800e0c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e0e:	5b                   	pop    %ebx
+  800e0f:	5e                   	pop    %esi
+  800e10:	5f                   	pop    %edi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+
+00800e13 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1e:	b8 16 00 00 00       	mov    $0x16,%eax
+  800e23:	89 d1                	mov    %edx,%ecx
+  800e25:	89 d3                	mov    %edx,%ebx
+  800e27:	89 d7                	mov    %edx,%edi
+  800e29:	89 d6                	mov    %edx,%esi
+  800e2b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e2d:	5b                   	pop    %ebx
+  800e2e:	5e                   	pop    %esi
+  800e2f:	5f                   	pop    %edi
+  800e30:	5d                   	pop    %ebp
+  800e31:	c3                   	ret
+
+00800e32 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800e32:	55                   	push   %ebp
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	57                   	push   %edi
+  800e36:	56                   	push   %esi
+  800e37:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e38:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e42:	89 d1                	mov    %edx,%ecx
+  800e44:	89 d3                	mov    %edx,%ebx
+  800e46:	89 d7                	mov    %edx,%edi
+  800e48:	89 d6                	mov    %edx,%esi
+  800e4a:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5e                   	pop    %esi
+  800e4e:	5f                   	pop    %edi
+  800e4f:	5d                   	pop    %ebp
+  800e50:	c3                   	ret
+
+00800e51 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800e51:	55                   	push   %ebp
+  800e52:	89 e5                	mov    %esp,%ebp
+  800e54:	57                   	push   %edi
+  800e55:	56                   	push   %esi
+  800e56:	53                   	push   %ebx
+  800e57:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e65:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e6a:	89 df                	mov    %ebx,%edi
+  800e6c:	89 de                	mov    %ebx,%esi
+  800e6e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e70:	85 c0                	test   %eax,%eax
+  800e72:	7f 08                	jg     800e7c <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800e74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e77:	5b                   	pop    %ebx
+  800e78:	5e                   	pop    %esi
+  800e79:	5f                   	pop    %edi
+  800e7a:	5d                   	pop    %ebp
+  800e7b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7c:	83 ec 0c             	sub    $0xc,%esp
+  800e7f:	50                   	push   %eax
+  800e80:	6a 15                	push   $0x15
+  800e82:	68 3f 2f 80 00       	push   $0x802f3f
+  800e87:	6a 23                	push   $0x23
+  800e89:	68 5c 2f 80 00       	push   $0x802f5c
+  800e8e:	e8 ca f4 ff ff       	call   80035d <_panic>
+
+00800e93 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	57                   	push   %edi
+  800e97:	56                   	push   %esi
+  800e98:	53                   	push   %ebx
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e9c:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eaf:	89 f7                	mov    %esi,%edi
+  800eb1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb3:	85 c0                	test   %eax,%eax
+  800eb5:	7f 08                	jg     800ebf <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800eb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eba:	5b                   	pop    %ebx
+  800ebb:	5e                   	pop    %esi
+  800ebc:	5f                   	pop    %edi
+  800ebd:	5d                   	pop    %ebp
+  800ebe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebf:	83 ec 0c             	sub    $0xc,%esp
+  800ec2:	50                   	push   %eax
+  800ec3:	6a 05                	push   $0x5
+  800ec5:	68 3f 2f 80 00       	push   $0x802f3f
+  800eca:	6a 23                	push   $0x23
+  800ecc:	68 5c 2f 80 00       	push   $0x802f5c
+  800ed1:	e8 87 f4 ff ff       	call   80035d <_panic>
+
+00800ed6 <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800ed6:	55                   	push   %ebp
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	57                   	push   %edi
+  800eda:	56                   	push   %esi
+  800edb:	53                   	push   %ebx
+  800edc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800edf:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eea:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef2:	89 f7                	mov    %esi,%edi
+  800ef4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef6:	85 c0                	test   %eax,%eax
+  800ef8:	7f 08                	jg     800f02 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800efa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efd:	5b                   	pop    %ebx
+  800efe:	5e                   	pop    %esi
+  800eff:	5f                   	pop    %edi
+  800f00:	5d                   	pop    %ebp
+  800f01:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f02:	83 ec 0c             	sub    $0xc,%esp
+  800f05:	50                   	push   %eax
+  800f06:	6a 06                	push   $0x6
+  800f08:	68 3f 2f 80 00       	push   $0x802f3f
+  800f0d:	6a 23                	push   $0x23
+  800f0f:	68 5c 2f 80 00       	push   $0x802f5c
+  800f14:	e8 44 f4 ff ff       	call   80035d <_panic>
+
+00800f19 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+  800f1f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f28:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f30:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f33:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f36:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f38:	85 c0                	test   %eax,%eax
+  800f3a:	7f 08                	jg     800f44 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5e                   	pop    %esi
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f44:	83 ec 0c             	sub    $0xc,%esp
+  800f47:	50                   	push   %eax
+  800f48:	6a 07                	push   $0x7
+  800f4a:	68 3f 2f 80 00       	push   $0x802f3f
+  800f4f:	6a 23                	push   $0x23
+  800f51:	68 5c 2f 80 00       	push   $0x802f5c
+  800f56:	e8 02 f4 ff ff       	call   80035d <_panic>
+
+00800f5b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f5b:	55                   	push   %ebp
+  800f5c:	89 e5                	mov    %esp,%ebp
+  800f5e:	57                   	push   %edi
+  800f5f:	56                   	push   %esi
+  800f60:	53                   	push   %ebx
+  800f61:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f74:	89 df                	mov    %ebx,%edi
+  800f76:	89 de                	mov    %ebx,%esi
+  800f78:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	7f 08                	jg     800f86 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f81:	5b                   	pop    %ebx
+  800f82:	5e                   	pop    %esi
+  800f83:	5f                   	pop    %edi
+  800f84:	5d                   	pop    %ebp
+  800f85:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f86:	83 ec 0c             	sub    $0xc,%esp
+  800f89:	50                   	push   %eax
+  800f8a:	6a 08                	push   $0x8
+  800f8c:	68 3f 2f 80 00       	push   $0x802f3f
+  800f91:	6a 23                	push   $0x23
+  800f93:	68 5c 2f 80 00       	push   $0x802f5c
+  800f98:	e8 c0 f3 ff ff       	call   80035d <_panic>
+
+00800f9d <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	57                   	push   %edi
+  800fa1:	56                   	push   %esi
+  800fa2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa9:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fae:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb9:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800fbb:	5b                   	pop    %ebx
+  800fbc:	5e                   	pop    %esi
+  800fbd:	5f                   	pop    %edi
+  800fbe:	5d                   	pop    %ebp
+  800fbf:	c3                   	ret
+
+00800fc0 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800fc0:	55                   	push   %ebp
+  800fc1:	89 e5                	mov    %esp,%ebp
+  800fc3:	57                   	push   %edi
+  800fc4:	56                   	push   %esi
+  800fc5:	53                   	push   %ebx
+  800fc6:	8b 45 18             	mov    0x18(%ebp),%eax
+  800fc9:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800fcc:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800fd1:	77 27                	ja     800ffa <sys_page_map_range+0x3a>
+  800fd3:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800fd9:	77 1f                	ja     800ffa <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800fdb:	c1 e0 0c             	shl    $0xc,%eax
+  800fde:	89 c6                	mov    %eax,%esi
+  800fe0:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800fe2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ff3:	cd 30                	int    $0x30
+}
+  800ff5:	5b                   	pop    %ebx
+  800ff6:	5e                   	pop    %esi
+  800ff7:	5f                   	pop    %edi
+  800ff8:	5d                   	pop    %ebp
+  800ff9:	c3                   	ret
+		return -E_INVAL;
+  800ffa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fff:	eb f4                	jmp    800ff5 <sys_page_map_range+0x35>
+
+00801001 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801001:	55                   	push   %ebp
+  801002:	89 e5                	mov    %esp,%ebp
+  801004:	57                   	push   %edi
+  801005:	56                   	push   %esi
+  801006:	53                   	push   %ebx
+  801007:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80100a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801010:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801015:	be 00 00 00 00       	mov    $0x0,%esi
+  80101a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80101d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801020:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801022:	85 c0                	test   %eax,%eax
+  801024:	7f 08                	jg     80102e <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801026:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801029:	5b                   	pop    %ebx
+  80102a:	5e                   	pop    %esi
+  80102b:	5f                   	pop    %edi
+  80102c:	5d                   	pop    %ebp
+  80102d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80102e:	83 ec 0c             	sub    $0xc,%esp
+  801031:	50                   	push   %eax
+  801032:	6a 0c                	push   $0xc
+  801034:	68 3f 2f 80 00       	push   $0x802f3f
+  801039:	6a 23                	push   $0x23
+  80103b:	68 5c 2f 80 00       	push   $0x802f5c
+  801040:	e8 18 f3 ff ff       	call   80035d <_panic>
+
+00801045 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  801045:	55                   	push   %ebp
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	57                   	push   %edi
+  801049:	56                   	push   %esi
+  80104a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80104b:	be 00 00 00 00       	mov    $0x0,%esi
+  801050:	8b 55 08             	mov    0x8(%ebp),%edx
+  801053:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801056:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80105b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80105e:	89 f7                	mov    %esi,%edi
+  801060:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  801062:	5b                   	pop    %ebx
+  801063:	5e                   	pop    %esi
+  801064:	5f                   	pop    %edi
+  801065:	5d                   	pop    %ebp
+  801066:	c3                   	ret
+
+00801067 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801067:	55                   	push   %ebp
+  801068:	89 e5                	mov    %esp,%ebp
+  80106a:	57                   	push   %edi
+  80106b:	56                   	push   %esi
+  80106c:	53                   	push   %ebx
+  80106d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801070:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801075:	8b 55 08             	mov    0x8(%ebp),%edx
+  801078:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801080:	89 df                	mov    %ebx,%edi
+  801082:	89 de                	mov    %ebx,%esi
+  801084:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801086:	85 c0                	test   %eax,%eax
+  801088:	7f 08                	jg     801092 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80108a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108d:	5b                   	pop    %ebx
+  80108e:	5e                   	pop    %esi
+  80108f:	5f                   	pop    %edi
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801092:	83 ec 0c             	sub    $0xc,%esp
+  801095:	50                   	push   %eax
+  801096:	6a 0f                	push   $0xf
+  801098:	68 3f 2f 80 00       	push   $0x802f3f
+  80109d:	6a 23                	push   $0x23
+  80109f:	68 5c 2f 80 00       	push   $0x802f5c
+  8010a4:	e8 b4 f2 ff ff       	call   80035d <_panic>
+
+008010a9 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8010a9:	55                   	push   %ebp
+  8010aa:	89 e5                	mov    %esp,%ebp
+  8010ac:	57                   	push   %edi
+  8010ad:	56                   	push   %esi
+  8010ae:	53                   	push   %ebx
+  8010af:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bd:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010c2:	89 df                	mov    %ebx,%edi
+  8010c4:	89 de                	mov    %ebx,%esi
+  8010c6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c8:	85 c0                	test   %eax,%eax
+  8010ca:	7f 08                	jg     8010d4 <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  8010cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cf:	5b                   	pop    %ebx
+  8010d0:	5e                   	pop    %esi
+  8010d1:	5f                   	pop    %edi
+  8010d2:	5d                   	pop    %ebp
+  8010d3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d4:	83 ec 0c             	sub    $0xc,%esp
+  8010d7:	50                   	push   %eax
+  8010d8:	6a 10                	push   $0x10
+  8010da:	68 3f 2f 80 00       	push   $0x802f3f
+  8010df:	6a 23                	push   $0x23
+  8010e1:	68 5c 2f 80 00       	push   $0x802f5c
+  8010e6:	e8 72 f2 ff ff       	call   80035d <_panic>
+
+008010eb <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8010eb:	55                   	push   %ebp
+  8010ec:	89 e5                	mov    %esp,%ebp
+  8010ee:	57                   	push   %edi
+  8010ef:	56                   	push   %esi
+  8010f0:	53                   	push   %ebx
+  8010f1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ff:	b8 11 00 00 00       	mov    $0x11,%eax
+  801104:	89 df                	mov    %ebx,%edi
+  801106:	89 de                	mov    %ebx,%esi
+  801108:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80110a:	85 c0                	test   %eax,%eax
+  80110c:	7f 08                	jg     801116 <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  80110e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801111:	5b                   	pop    %ebx
+  801112:	5e                   	pop    %esi
+  801113:	5f                   	pop    %edi
+  801114:	5d                   	pop    %ebp
+  801115:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801116:	83 ec 0c             	sub    $0xc,%esp
+  801119:	50                   	push   %eax
+  80111a:	6a 11                	push   $0x11
+  80111c:	68 3f 2f 80 00       	push   $0x802f3f
+  801121:	6a 23                	push   $0x23
+  801123:	68 5c 2f 80 00       	push   $0x802f5c
+  801128:	e8 30 f2 ff ff       	call   80035d <_panic>
+
+0080112d <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	57                   	push   %edi
+  801131:	56                   	push   %esi
+  801132:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801133:	ba 00 00 00 00       	mov    $0x0,%edx
+  801138:	b8 12 00 00 00       	mov    $0x12,%eax
+  80113d:	89 d1                	mov    %edx,%ecx
+  80113f:	89 d3                	mov    %edx,%ebx
+  801141:	89 d7                	mov    %edx,%edi
+  801143:	89 d6                	mov    %edx,%esi
+  801145:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  801147:	5b                   	pop    %ebx
+  801148:	5e                   	pop    %esi
+  801149:	5f                   	pop    %edi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+
+0080114c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	57                   	push   %edi
+  801150:	56                   	push   %esi
+  801151:	53                   	push   %ebx
+  801152:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801155:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801160:	b8 13 00 00 00       	mov    $0x13,%eax
+  801165:	89 df                	mov    %ebx,%edi
+  801167:	89 de                	mov    %ebx,%esi
+  801169:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80116b:	85 c0                	test   %eax,%eax
+  80116d:	7f 08                	jg     801177 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80116f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801172:	5b                   	pop    %ebx
+  801173:	5e                   	pop    %esi
+  801174:	5f                   	pop    %edi
+  801175:	5d                   	pop    %ebp
+  801176:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801177:	83 ec 0c             	sub    $0xc,%esp
+  80117a:	50                   	push   %eax
+  80117b:	6a 13                	push   $0x13
+  80117d:	68 3f 2f 80 00       	push   $0x802f3f
+  801182:	6a 23                	push   $0x23
+  801184:	68 5c 2f 80 00       	push   $0x802f5c
+  801189:	e8 cf f1 ff ff       	call   80035d <_panic>
+
+0080118e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	57                   	push   %edi
+  801192:	56                   	push   %esi
+  801193:	53                   	push   %ebx
+  801194:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801197:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011a7:	89 df                	mov    %ebx,%edi
+  8011a9:	89 de                	mov    %ebx,%esi
+  8011ab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ad:	85 c0                	test   %eax,%eax
+  8011af:	7f 08                	jg     8011b9 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b4:	5b                   	pop    %ebx
+  8011b5:	5e                   	pop    %esi
+  8011b6:	5f                   	pop    %edi
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b9:	83 ec 0c             	sub    $0xc,%esp
+  8011bc:	50                   	push   %eax
+  8011bd:	6a 14                	push   $0x14
+  8011bf:	68 3f 2f 80 00       	push   $0x802f3f
+  8011c4:	6a 23                	push   $0x23
+  8011c6:	68 5c 2f 80 00       	push   $0x802f5c
+  8011cb:	e8 8d f1 ff ff       	call   80035d <_panic>
+
+008011d0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	57                   	push   %edi
+  8011d4:	56                   	push   %esi
+  8011d5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dc:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ec:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011ee:	5b                   	pop    %ebx
+  8011ef:	5e                   	pop    %esi
+  8011f0:	5f                   	pop    %edi
+  8011f1:	5d                   	pop    %ebp
+  8011f2:	c3                   	ret
+
+008011f3 <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	57                   	push   %edi
+  8011f7:	56                   	push   %esi
+  8011f8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ff:	b8 18 00 00 00       	mov    $0x18,%eax
+  801204:	be 00 00 00 00       	mov    $0x0,%esi
+  801209:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80120f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801211:	5b                   	pop    %ebx
+  801212:	5e                   	pop    %esi
+  801213:	5f                   	pop    %edi
+  801214:	5d                   	pop    %ebp
+  801215:	c3                   	ret
+
+00801216 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	57                   	push   %edi
+  80121a:	56                   	push   %esi
+  80121b:	53                   	push   %ebx
+  80121c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80121f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801224:	8b 55 08             	mov    0x8(%ebp),%edx
+  801227:	b8 19 00 00 00       	mov    $0x19,%eax
+  80122c:	89 cb                	mov    %ecx,%ebx
+  80122e:	89 cf                	mov    %ecx,%edi
+  801230:	89 ce                	mov    %ecx,%esi
+  801232:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801234:	85 c0                	test   %eax,%eax
+  801236:	7f 08                	jg     801240 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801238:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123b:	5b                   	pop    %ebx
+  80123c:	5e                   	pop    %esi
+  80123d:	5f                   	pop    %edi
+  80123e:	5d                   	pop    %ebp
+  80123f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801240:	83 ec 0c             	sub    $0xc,%esp
+  801243:	50                   	push   %eax
+  801244:	6a 19                	push   $0x19
+  801246:	68 3f 2f 80 00       	push   $0x802f3f
+  80124b:	6a 23                	push   $0x23
+  80124d:	68 5c 2f 80 00       	push   $0x802f5c
+  801252:	e8 06 f1 ff ff       	call   80035d <_panic>
+
+00801257 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801257:	55                   	push   %ebp
+  801258:	89 e5                	mov    %esp,%ebp
+  80125a:	57                   	push   %edi
+  80125b:	56                   	push   %esi
+  80125c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80125d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801262:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801267:	89 d1                	mov    %edx,%ecx
+  801269:	89 d3                	mov    %edx,%ebx
+  80126b:	89 d7                	mov    %edx,%edi
+  80126d:	89 d6                	mov    %edx,%esi
+  80126f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801271:	5b                   	pop    %ebx
+  801272:	5e                   	pop    %esi
+  801273:	5f                   	pop    %edi
+  801274:	5d                   	pop    %ebp
+  801275:	c3                   	ret
+
+00801276 <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  801276:	55                   	push   %ebp
+  801277:	89 e5                	mov    %esp,%ebp
+  801279:	57                   	push   %edi
+  80127a:	56                   	push   %esi
+  80127b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80127c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801281:	8b 55 08             	mov    0x8(%ebp),%edx
+  801284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801287:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80128c:	89 df                	mov    %ebx,%edi
+  80128e:	89 de                	mov    %ebx,%esi
+  801290:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  801292:	5b                   	pop    %ebx
+  801293:	5e                   	pop    %esi
+  801294:	5f                   	pop    %edi
+  801295:	5d                   	pop    %ebp
+  801296:	c3                   	ret
+
+00801297 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801297:	55                   	push   %ebp
+  801298:	89 e5                	mov    %esp,%ebp
+  80129a:	57                   	push   %edi
+  80129b:	56                   	push   %esi
+  80129c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80129d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8012ad:	89 df                	mov    %ebx,%edi
+  8012af:	89 de                	mov    %ebx,%esi
+  8012b1:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  8012b3:	5b                   	pop    %ebx
+  8012b4:	5e                   	pop    %esi
+  8012b5:	5f                   	pop    %edi
+  8012b6:	5d                   	pop    %ebp
+  8012b7:	c3                   	ret
+
+008012b8 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012b8:	55                   	push   %ebp
+  8012b9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012be:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012c3:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012c6:	5d                   	pop    %ebp
+  8012c7:	c3                   	ret
+
+008012c8 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012c8:	55                   	push   %ebp
+  8012c9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012ce:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012d3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012d8:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012dd:	5d                   	pop    %ebp
+  8012de:	c3                   	ret
+
+008012df <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8012e2:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8012e7:	eb 02                	jmp    8012eb <fd_alloc+0xc>
+  8012e9:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012eb:	89 c2                	mov    %eax,%edx
+  8012ed:	c1 ea 16             	shr    $0x16,%edx
+  8012f0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8012f7:	f6 c2 01             	test   $0x1,%dl
+  8012fa:	74 2b                	je     801327 <fd_alloc+0x48>
+  8012fc:	89 c2                	mov    %eax,%edx
+  8012fe:	c1 ea 0c             	shr    $0xc,%edx
+  801301:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801308:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80130e:	f6 c1 01             	test   $0x1,%cl
+  801311:	74 14                	je     801327 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801313:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801319:	75 ce                	jne    8012e9 <fd_alloc+0xa>
+  80131b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801320:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801325:	eb 05                	jmp    80132c <fd_alloc+0x4d>
+			return 0;
+  801327:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80132c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132f:	89 02                	mov    %eax,(%edx)
+}
+  801331:	89 c8                	mov    %ecx,%eax
+  801333:	5d                   	pop    %ebp
+  801334:	c3                   	ret
+
+00801335 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801335:	55                   	push   %ebp
+  801336:	89 e5                	mov    %esp,%ebp
+  801338:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80133b:	83 f8 1f             	cmp    $0x1f,%eax
+  80133e:	77 30                	ja     801370 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801340:	c1 e0 0c             	shl    $0xc,%eax
+  801343:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801348:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80134e:	f6 c2 01             	test   $0x1,%dl
+  801351:	74 24                	je     801377 <fd_lookup+0x42>
+  801353:	89 c2                	mov    %eax,%edx
+  801355:	c1 ea 0c             	shr    $0xc,%edx
+  801358:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80135f:	f6 c2 01             	test   $0x1,%dl
+  801362:	74 1a                	je     80137e <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801364:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801367:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801369:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80136e:	5d                   	pop    %ebp
+  80136f:	c3                   	ret
+		return -E_INVAL;
+  801370:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801375:	eb f7                	jmp    80136e <fd_lookup+0x39>
+		return -E_INVAL;
+  801377:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80137c:	eb f0                	jmp    80136e <fd_lookup+0x39>
+  80137e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801383:	eb e9                	jmp    80136e <fd_lookup+0x39>
+
+00801385 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801385:	55                   	push   %ebp
+  801386:	89 e5                	mov    %esp,%ebp
+  801388:	53                   	push   %ebx
+  801389:	83 ec 04             	sub    $0x4,%esp
+  80138c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80138f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801394:	eb 03                	jmp    801399 <dev_lookup+0x14>
+  801396:	83 c0 01             	add    $0x1,%eax
+  801399:	8b 1c 85 e8 2f 80 00 	mov    0x802fe8(,%eax,4),%ebx
+  8013a0:	85 db                	test   %ebx,%ebx
+  8013a2:	74 0b                	je     8013af <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8013a4:	39 13                	cmp    %edx,(%ebx)
+  8013a6:	75 ee                	jne    801396 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8013a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ad:	eb 1f                	jmp    8013ce <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013af:	a1 08 50 80 00       	mov    0x805008,%eax
+  8013b4:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8013b7:	83 ec 04             	sub    $0x4,%esp
+  8013ba:	52                   	push   %edx
+  8013bb:	50                   	push   %eax
+  8013bc:	68 6c 2f 80 00       	push   $0x802f6c
+  8013c1:	e8 72 f0 ff ff       	call   800438 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013c6:	83 c4 10             	add    $0x10,%esp
+  8013c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013d1:	89 1a                	mov    %ebx,(%edx)
+}
+  8013d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013d6:	c9                   	leave
+  8013d7:	c3                   	ret
+
+008013d8 <fd_close>:
+{
+  8013d8:	55                   	push   %ebp
+  8013d9:	89 e5                	mov    %esp,%ebp
+  8013db:	57                   	push   %edi
+  8013dc:	56                   	push   %esi
+  8013dd:	53                   	push   %ebx
+  8013de:	83 ec 24             	sub    $0x24,%esp
+  8013e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013e4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013e7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013ea:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013eb:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013f1:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013f4:	50                   	push   %eax
+  8013f5:	e8 3b ff ff ff       	call   801335 <fd_lookup>
+  8013fa:	89 c3                	mov    %eax,%ebx
+  8013fc:	83 c4 10             	add    $0x10,%esp
+  8013ff:	85 c0                	test   %eax,%eax
+  801401:	78 05                	js     801408 <fd_close+0x30>
+	    || fd != fd2)
+  801403:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801406:	74 16                	je     80141e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801408:	89 f8                	mov    %edi,%eax
+  80140a:	84 c0                	test   %al,%al
+  80140c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801411:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801414:	89 d8                	mov    %ebx,%eax
+  801416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801419:	5b                   	pop    %ebx
+  80141a:	5e                   	pop    %esi
+  80141b:	5f                   	pop    %edi
+  80141c:	5d                   	pop    %ebp
+  80141d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80141e:	83 ec 08             	sub    $0x8,%esp
+  801421:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801424:	50                   	push   %eax
+  801425:	ff 36                	push   (%esi)
+  801427:	e8 59 ff ff ff       	call   801385 <dev_lookup>
+  80142c:	89 c3                	mov    %eax,%ebx
+  80142e:	83 c4 10             	add    $0x10,%esp
+  801431:	85 c0                	test   %eax,%eax
+  801433:	78 1a                	js     80144f <fd_close+0x77>
+		if (dev->dev_close)
+  801435:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801438:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80143b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801440:	85 c0                	test   %eax,%eax
+  801442:	74 0b                	je     80144f <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801444:	83 ec 0c             	sub    $0xc,%esp
+  801447:	56                   	push   %esi
+  801448:	ff d0                	call   *%eax
+  80144a:	89 c3                	mov    %eax,%ebx
+  80144c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80144f:	83 ec 08             	sub    $0x8,%esp
+  801452:	56                   	push   %esi
+  801453:	6a 00                	push   $0x0
+  801455:	e8 01 fb ff ff       	call   800f5b <sys_page_unmap>
+	return r;
+  80145a:	83 c4 10             	add    $0x10,%esp
+  80145d:	eb b5                	jmp    801414 <fd_close+0x3c>
+
+0080145f <close>:
+
+int
+close(int fdnum)
+{
+  80145f:	55                   	push   %ebp
+  801460:	89 e5                	mov    %esp,%ebp
+  801462:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801465:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801468:	50                   	push   %eax
+  801469:	ff 75 08             	push   0x8(%ebp)
+  80146c:	e8 c4 fe ff ff       	call   801335 <fd_lookup>
+  801471:	83 c4 10             	add    $0x10,%esp
+  801474:	85 c0                	test   %eax,%eax
+  801476:	79 02                	jns    80147a <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801478:	c9                   	leave
+  801479:	c3                   	ret
+		return fd_close(fd, 1);
+  80147a:	83 ec 08             	sub    $0x8,%esp
+  80147d:	6a 01                	push   $0x1
+  80147f:	ff 75 f4             	push   -0xc(%ebp)
+  801482:	e8 51 ff ff ff       	call   8013d8 <fd_close>
+  801487:	83 c4 10             	add    $0x10,%esp
+  80148a:	eb ec                	jmp    801478 <close+0x19>
+
+0080148c <close_all>:
+
+void
+close_all(void)
+{
+  80148c:	55                   	push   %ebp
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	53                   	push   %ebx
+  801490:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801493:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801498:	83 ec 0c             	sub    $0xc,%esp
+  80149b:	53                   	push   %ebx
+  80149c:	e8 be ff ff ff       	call   80145f <close>
+	for (i = 0; i < MAXFD; i++)
+  8014a1:	83 c3 01             	add    $0x1,%ebx
+  8014a4:	83 c4 10             	add    $0x10,%esp
+  8014a7:	83 fb 20             	cmp    $0x20,%ebx
+  8014aa:	75 ec                	jne    801498 <close_all+0xc>
+}
+  8014ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014af:	c9                   	leave
+  8014b0:	c3                   	ret
+
+008014b1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014b1:	55                   	push   %ebp
+  8014b2:	89 e5                	mov    %esp,%ebp
+  8014b4:	57                   	push   %edi
+  8014b5:	56                   	push   %esi
+  8014b6:	53                   	push   %ebx
+  8014b7:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014ba:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014bd:	50                   	push   %eax
+  8014be:	ff 75 08             	push   0x8(%ebp)
+  8014c1:	e8 6f fe ff ff       	call   801335 <fd_lookup>
+  8014c6:	89 c3                	mov    %eax,%ebx
+  8014c8:	83 c4 10             	add    $0x10,%esp
+  8014cb:	85 c0                	test   %eax,%eax
+  8014cd:	78 7f                	js     80154e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014cf:	83 ec 0c             	sub    $0xc,%esp
+  8014d2:	ff 75 0c             	push   0xc(%ebp)
+  8014d5:	e8 85 ff ff ff       	call   80145f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014da:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014dd:	c1 e6 0c             	shl    $0xc,%esi
+  8014e0:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014e9:	89 3c 24             	mov    %edi,(%esp)
+  8014ec:	e8 d7 fd ff ff       	call   8012c8 <fd2data>
+  8014f1:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014f3:	89 34 24             	mov    %esi,(%esp)
+  8014f6:	e8 cd fd ff ff       	call   8012c8 <fd2data>
+  8014fb:	83 c4 10             	add    $0x10,%esp
+  8014fe:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801501:	89 d8                	mov    %ebx,%eax
+  801503:	c1 e8 16             	shr    $0x16,%eax
+  801506:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80150d:	a8 01                	test   $0x1,%al
+  80150f:	74 11                	je     801522 <dup+0x71>
+  801511:	89 d8                	mov    %ebx,%eax
+  801513:	c1 e8 0c             	shr    $0xc,%eax
+  801516:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80151d:	f6 c2 01             	test   $0x1,%dl
+  801520:	75 36                	jne    801558 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801522:	89 f8                	mov    %edi,%eax
+  801524:	c1 e8 0c             	shr    $0xc,%eax
+  801527:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80152e:	83 ec 0c             	sub    $0xc,%esp
+  801531:	25 07 0e 00 00       	and    $0xe07,%eax
+  801536:	50                   	push   %eax
+  801537:	56                   	push   %esi
+  801538:	6a 00                	push   $0x0
+  80153a:	57                   	push   %edi
+  80153b:	6a 00                	push   $0x0
+  80153d:	e8 d7 f9 ff ff       	call   800f19 <sys_page_map>
+  801542:	89 c3                	mov    %eax,%ebx
+  801544:	83 c4 20             	add    $0x20,%esp
+  801547:	85 c0                	test   %eax,%eax
+  801549:	78 33                	js     80157e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80154b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80154e:	89 d8                	mov    %ebx,%eax
+  801550:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801553:	5b                   	pop    %ebx
+  801554:	5e                   	pop    %esi
+  801555:	5f                   	pop    %edi
+  801556:	5d                   	pop    %ebp
+  801557:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801558:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80155f:	83 ec 0c             	sub    $0xc,%esp
+  801562:	25 07 0e 00 00       	and    $0xe07,%eax
+  801567:	50                   	push   %eax
+  801568:	ff 75 d4             	push   -0x2c(%ebp)
+  80156b:	6a 00                	push   $0x0
+  80156d:	53                   	push   %ebx
+  80156e:	6a 00                	push   $0x0
+  801570:	e8 a4 f9 ff ff       	call   800f19 <sys_page_map>
+  801575:	89 c3                	mov    %eax,%ebx
+  801577:	83 c4 20             	add    $0x20,%esp
+  80157a:	85 c0                	test   %eax,%eax
+  80157c:	79 a4                	jns    801522 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80157e:	83 ec 08             	sub    $0x8,%esp
+  801581:	56                   	push   %esi
+  801582:	6a 00                	push   $0x0
+  801584:	e8 d2 f9 ff ff       	call   800f5b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801589:	83 c4 08             	add    $0x8,%esp
+  80158c:	ff 75 d4             	push   -0x2c(%ebp)
+  80158f:	6a 00                	push   $0x0
+  801591:	e8 c5 f9 ff ff       	call   800f5b <sys_page_unmap>
+	return r;
+  801596:	83 c4 10             	add    $0x10,%esp
+  801599:	eb b3                	jmp    80154e <dup+0x9d>
+
+0080159b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80159b:	55                   	push   %ebp
+  80159c:	89 e5                	mov    %esp,%ebp
+  80159e:	56                   	push   %esi
+  80159f:	53                   	push   %ebx
+  8015a0:	83 ec 18             	sub    $0x18,%esp
+  8015a3:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015a9:	50                   	push   %eax
+  8015aa:	56                   	push   %esi
+  8015ab:	e8 85 fd ff ff       	call   801335 <fd_lookup>
+  8015b0:	83 c4 10             	add    $0x10,%esp
+  8015b3:	85 c0                	test   %eax,%eax
+  8015b5:	78 3c                	js     8015f3 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015b7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015ba:	83 ec 08             	sub    $0x8,%esp
+  8015bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015c0:	50                   	push   %eax
+  8015c1:	ff 33                	push   (%ebx)
+  8015c3:	e8 bd fd ff ff       	call   801385 <dev_lookup>
+  8015c8:	83 c4 10             	add    $0x10,%esp
+  8015cb:	85 c0                	test   %eax,%eax
+  8015cd:	78 24                	js     8015f3 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015cf:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015d2:	83 e0 03             	and    $0x3,%eax
+  8015d5:	83 f8 01             	cmp    $0x1,%eax
+  8015d8:	74 20                	je     8015fa <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015dd:	8b 40 08             	mov    0x8(%eax),%eax
+  8015e0:	85 c0                	test   %eax,%eax
+  8015e2:	74 37                	je     80161b <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015e4:	83 ec 04             	sub    $0x4,%esp
+  8015e7:	ff 75 10             	push   0x10(%ebp)
+  8015ea:	ff 75 0c             	push   0xc(%ebp)
+  8015ed:	53                   	push   %ebx
+  8015ee:	ff d0                	call   *%eax
+  8015f0:	83 c4 10             	add    $0x10,%esp
+}
+  8015f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015f6:	5b                   	pop    %ebx
+  8015f7:	5e                   	pop    %esi
+  8015f8:	5d                   	pop    %ebp
+  8015f9:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015fa:	a1 08 50 80 00       	mov    0x805008,%eax
+  8015ff:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801602:	83 ec 04             	sub    $0x4,%esp
+  801605:	56                   	push   %esi
+  801606:	50                   	push   %eax
+  801607:	68 ad 2f 80 00       	push   $0x802fad
+  80160c:	e8 27 ee ff ff       	call   800438 <cprintf>
+		return -E_INVAL;
+  801611:	83 c4 10             	add    $0x10,%esp
+  801614:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801619:	eb d8                	jmp    8015f3 <read+0x58>
+		return -E_NOT_SUPP;
+  80161b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801620:	eb d1                	jmp    8015f3 <read+0x58>
+
+00801622 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801622:	55                   	push   %ebp
+  801623:	89 e5                	mov    %esp,%ebp
+  801625:	57                   	push   %edi
+  801626:	56                   	push   %esi
+  801627:	53                   	push   %ebx
+  801628:	83 ec 0c             	sub    $0xc,%esp
+  80162b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80162e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801631:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801636:	eb 02                	jmp    80163a <readn+0x18>
+  801638:	01 c3                	add    %eax,%ebx
+  80163a:	39 f3                	cmp    %esi,%ebx
+  80163c:	73 21                	jae    80165f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80163e:	83 ec 04             	sub    $0x4,%esp
+  801641:	89 f0                	mov    %esi,%eax
+  801643:	29 d8                	sub    %ebx,%eax
+  801645:	50                   	push   %eax
+  801646:	89 d8                	mov    %ebx,%eax
+  801648:	03 45 0c             	add    0xc(%ebp),%eax
+  80164b:	50                   	push   %eax
+  80164c:	57                   	push   %edi
+  80164d:	e8 49 ff ff ff       	call   80159b <read>
+		if (m < 0)
+  801652:	83 c4 10             	add    $0x10,%esp
+  801655:	85 c0                	test   %eax,%eax
+  801657:	78 04                	js     80165d <readn+0x3b>
+			return m;
+		if (m == 0)
+  801659:	75 dd                	jne    801638 <readn+0x16>
+  80165b:	eb 02                	jmp    80165f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80165d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80165f:	89 d8                	mov    %ebx,%eax
+  801661:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801664:	5b                   	pop    %ebx
+  801665:	5e                   	pop    %esi
+  801666:	5f                   	pop    %edi
+  801667:	5d                   	pop    %ebp
+  801668:	c3                   	ret
+
+00801669 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801669:	55                   	push   %ebp
+  80166a:	89 e5                	mov    %esp,%ebp
+  80166c:	56                   	push   %esi
+  80166d:	53                   	push   %ebx
+  80166e:	83 ec 18             	sub    $0x18,%esp
+  801671:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801674:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801677:	50                   	push   %eax
+  801678:	53                   	push   %ebx
+  801679:	e8 b7 fc ff ff       	call   801335 <fd_lookup>
+  80167e:	83 c4 10             	add    $0x10,%esp
+  801681:	85 c0                	test   %eax,%eax
+  801683:	78 37                	js     8016bc <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801685:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801688:	83 ec 08             	sub    $0x8,%esp
+  80168b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80168e:	50                   	push   %eax
+  80168f:	ff 36                	push   (%esi)
+  801691:	e8 ef fc ff ff       	call   801385 <dev_lookup>
+  801696:	83 c4 10             	add    $0x10,%esp
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	78 1f                	js     8016bc <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80169d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016a1:	74 20                	je     8016c3 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	74 37                	je     8016e4 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016ad:	83 ec 04             	sub    $0x4,%esp
+  8016b0:	ff 75 10             	push   0x10(%ebp)
+  8016b3:	ff 75 0c             	push   0xc(%ebp)
+  8016b6:	56                   	push   %esi
+  8016b7:	ff d0                	call   *%eax
+  8016b9:	83 c4 10             	add    $0x10,%esp
+}
+  8016bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016bf:	5b                   	pop    %ebx
+  8016c0:	5e                   	pop    %esi
+  8016c1:	5d                   	pop    %ebp
+  8016c2:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016c3:	a1 08 50 80 00       	mov    0x805008,%eax
+  8016c8:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8016cb:	83 ec 04             	sub    $0x4,%esp
+  8016ce:	53                   	push   %ebx
+  8016cf:	50                   	push   %eax
+  8016d0:	68 c9 2f 80 00       	push   $0x802fc9
+  8016d5:	e8 5e ed ff ff       	call   800438 <cprintf>
+		return -E_INVAL;
+  8016da:	83 c4 10             	add    $0x10,%esp
+  8016dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e2:	eb d8                	jmp    8016bc <write+0x53>
+		return -E_NOT_SUPP;
+  8016e4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016e9:	eb d1                	jmp    8016bc <write+0x53>
+
+008016eb <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016eb:	55                   	push   %ebp
+  8016ec:	89 e5                	mov    %esp,%ebp
+  8016ee:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016f4:	50                   	push   %eax
+  8016f5:	ff 75 08             	push   0x8(%ebp)
+  8016f8:	e8 38 fc ff ff       	call   801335 <fd_lookup>
+  8016fd:	83 c4 10             	add    $0x10,%esp
+  801700:	85 c0                	test   %eax,%eax
+  801702:	78 0e                	js     801712 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801704:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801707:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80170d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801712:	c9                   	leave
+  801713:	c3                   	ret
+
+00801714 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801714:	55                   	push   %ebp
+  801715:	89 e5                	mov    %esp,%ebp
+  801717:	56                   	push   %esi
+  801718:	53                   	push   %ebx
+  801719:	83 ec 18             	sub    $0x18,%esp
+  80171c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80171f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801722:	50                   	push   %eax
+  801723:	53                   	push   %ebx
+  801724:	e8 0c fc ff ff       	call   801335 <fd_lookup>
+  801729:	83 c4 10             	add    $0x10,%esp
+  80172c:	85 c0                	test   %eax,%eax
+  80172e:	78 34                	js     801764 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801730:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801733:	83 ec 08             	sub    $0x8,%esp
+  801736:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801739:	50                   	push   %eax
+  80173a:	ff 36                	push   (%esi)
+  80173c:	e8 44 fc ff ff       	call   801385 <dev_lookup>
+  801741:	83 c4 10             	add    $0x10,%esp
+  801744:	85 c0                	test   %eax,%eax
+  801746:	78 1c                	js     801764 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801748:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80174c:	74 1d                	je     80176b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80174e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801751:	8b 40 18             	mov    0x18(%eax),%eax
+  801754:	85 c0                	test   %eax,%eax
+  801756:	74 34                	je     80178c <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801758:	83 ec 08             	sub    $0x8,%esp
+  80175b:	ff 75 0c             	push   0xc(%ebp)
+  80175e:	56                   	push   %esi
+  80175f:	ff d0                	call   *%eax
+  801761:	83 c4 10             	add    $0x10,%esp
+}
+  801764:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801767:	5b                   	pop    %ebx
+  801768:	5e                   	pop    %esi
+  801769:	5d                   	pop    %ebp
+  80176a:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80176b:	a1 08 50 80 00       	mov    0x805008,%eax
+  801770:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801773:	83 ec 04             	sub    $0x4,%esp
+  801776:	53                   	push   %ebx
+  801777:	50                   	push   %eax
+  801778:	68 8c 2f 80 00       	push   $0x802f8c
+  80177d:	e8 b6 ec ff ff       	call   800438 <cprintf>
+		return -E_INVAL;
+  801782:	83 c4 10             	add    $0x10,%esp
+  801785:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80178a:	eb d8                	jmp    801764 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80178c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801791:	eb d1                	jmp    801764 <ftruncate+0x50>
+
+00801793 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	56                   	push   %esi
+  801797:	53                   	push   %ebx
+  801798:	83 ec 18             	sub    $0x18,%esp
+  80179b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80179e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017a1:	50                   	push   %eax
+  8017a2:	ff 75 08             	push   0x8(%ebp)
+  8017a5:	e8 8b fb ff ff       	call   801335 <fd_lookup>
+  8017aa:	83 c4 10             	add    $0x10,%esp
+  8017ad:	85 c0                	test   %eax,%eax
+  8017af:	78 49                	js     8017fa <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017b1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017b4:	83 ec 08             	sub    $0x8,%esp
+  8017b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ba:	50                   	push   %eax
+  8017bb:	ff 36                	push   (%esi)
+  8017bd:	e8 c3 fb ff ff       	call   801385 <dev_lookup>
+  8017c2:	83 c4 10             	add    $0x10,%esp
+  8017c5:	85 c0                	test   %eax,%eax
+  8017c7:	78 31                	js     8017fa <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017cc:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017d0:	74 2f                	je     801801 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017d2:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017d5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017dc:	00 00 00 
+	stat->st_isdir = 0;
+  8017df:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017e6:	00 00 00 
+	stat->st_dev = dev;
+  8017e9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017ef:	83 ec 08             	sub    $0x8,%esp
+  8017f2:	53                   	push   %ebx
+  8017f3:	56                   	push   %esi
+  8017f4:	ff 50 14             	call   *0x14(%eax)
+  8017f7:	83 c4 10             	add    $0x10,%esp
+}
+  8017fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017fd:	5b                   	pop    %ebx
+  8017fe:	5e                   	pop    %esi
+  8017ff:	5d                   	pop    %ebp
+  801800:	c3                   	ret
+		return -E_NOT_SUPP;
+  801801:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801806:	eb f2                	jmp    8017fa <fstat+0x67>
+
+00801808 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801808:	55                   	push   %ebp
+  801809:	89 e5                	mov    %esp,%ebp
+  80180b:	56                   	push   %esi
+  80180c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80180d:	83 ec 08             	sub    $0x8,%esp
+  801810:	6a 00                	push   $0x0
+  801812:	ff 75 08             	push   0x8(%ebp)
+  801815:	e8 e4 01 00 00       	call   8019fe <open>
+  80181a:	89 c3                	mov    %eax,%ebx
+  80181c:	83 c4 10             	add    $0x10,%esp
+  80181f:	85 c0                	test   %eax,%eax
+  801821:	78 1b                	js     80183e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801823:	83 ec 08             	sub    $0x8,%esp
+  801826:	ff 75 0c             	push   0xc(%ebp)
+  801829:	50                   	push   %eax
+  80182a:	e8 64 ff ff ff       	call   801793 <fstat>
+  80182f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801831:	89 1c 24             	mov    %ebx,(%esp)
+  801834:	e8 26 fc ff ff       	call   80145f <close>
+	return r;
+  801839:	83 c4 10             	add    $0x10,%esp
+  80183c:	89 f3                	mov    %esi,%ebx
+}
+  80183e:	89 d8                	mov    %ebx,%eax
+  801840:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801843:	5b                   	pop    %ebx
+  801844:	5e                   	pop    %esi
+  801845:	5d                   	pop    %ebp
+  801846:	c3                   	ret
+
+00801847 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801847:	55                   	push   %ebp
+  801848:	89 e5                	mov    %esp,%ebp
+  80184a:	56                   	push   %esi
+  80184b:	53                   	push   %ebx
+  80184c:	89 c6                	mov    %eax,%esi
+  80184e:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801850:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801857:	74 27                	je     801880 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801859:	6a 07                	push   $0x7
+  80185b:	68 00 60 80 00       	push   $0x806000
+  801860:	56                   	push   %esi
+  801861:	ff 35 00 50 80 00    	push   0x805000
+  801867:	e8 d5 0b 00 00       	call   802441 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80186c:	83 c4 0c             	add    $0xc,%esp
+  80186f:	6a 00                	push   $0x0
+  801871:	53                   	push   %ebx
+  801872:	6a 00                	push   $0x0
+  801874:	e8 50 0b 00 00       	call   8023c9 <ipc_recv>
+}
+  801879:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80187c:	5b                   	pop    %ebx
+  80187d:	5e                   	pop    %esi
+  80187e:	5d                   	pop    %ebp
+  80187f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801880:	83 ec 0c             	sub    $0xc,%esp
+  801883:	6a 01                	push   $0x1
+  801885:	e8 0b 0c 00 00       	call   802495 <ipc_find_env>
+  80188a:	a3 00 50 80 00       	mov    %eax,0x805000
+  80188f:	83 c4 10             	add    $0x10,%esp
+  801892:	eb c5                	jmp    801859 <fsipc+0x12>
+
+00801894 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801894:	55                   	push   %ebp
+  801895:	89 e5                	mov    %esp,%ebp
+  801897:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80189a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80189d:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018a0:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8018a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018a8:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8018ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018b7:	e8 8b ff ff ff       	call   801847 <fsipc>
+}
+  8018bc:	c9                   	leave
+  8018bd:	c3                   	ret
+
+008018be <devfile_flush>:
+{
+  8018be:	55                   	push   %ebp
+  8018bf:	89 e5                	mov    %esp,%ebp
+  8018c1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018ca:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8018cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018d9:	e8 69 ff ff ff       	call   801847 <fsipc>
+}
+  8018de:	c9                   	leave
+  8018df:	c3                   	ret
+
+008018e0 <devfile_stat>:
+{
+  8018e0:	55                   	push   %ebp
+  8018e1:	89 e5                	mov    %esp,%ebp
+  8018e3:	53                   	push   %ebx
+  8018e4:	83 ec 04             	sub    $0x4,%esp
+  8018e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ed:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018f0:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8018f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fa:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018ff:	e8 43 ff ff ff       	call   801847 <fsipc>
+  801904:	85 c0                	test   %eax,%eax
+  801906:	78 2c                	js     801934 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801908:	83 ec 08             	sub    $0x8,%esp
+  80190b:	68 00 60 80 00       	push   $0x806000
+  801910:	53                   	push   %ebx
+  801911:	e8 10 f1 ff ff       	call   800a26 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801916:	a1 80 60 80 00       	mov    0x806080,%eax
+  80191b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801921:	a1 84 60 80 00       	mov    0x806084,%eax
+  801926:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80192c:	83 c4 10             	add    $0x10,%esp
+  80192f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801934:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801937:	c9                   	leave
+  801938:	c3                   	ret
+
+00801939 <devfile_write>:
+{
+  801939:	55                   	push   %ebp
+  80193a:	89 e5                	mov    %esp,%ebp
+  80193c:	83 ec 0c             	sub    $0xc,%esp
+  80193f:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801942:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801947:	39 d0                	cmp    %edx,%eax
+  801949:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80194c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80194f:	8b 52 0c             	mov    0xc(%edx),%edx
+  801952:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801958:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80195d:	50                   	push   %eax
+  80195e:	ff 75 0c             	push   0xc(%ebp)
+  801961:	68 08 60 80 00       	push   $0x806008
+  801966:	e8 41 f2 ff ff       	call   800bac <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80196b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801970:	b8 04 00 00 00       	mov    $0x4,%eax
+  801975:	e8 cd fe ff ff       	call   801847 <fsipc>
+}
+  80197a:	c9                   	leave
+  80197b:	c3                   	ret
+
+0080197c <devfile_read>:
+{
+  80197c:	55                   	push   %ebp
+  80197d:	89 e5                	mov    %esp,%ebp
+  80197f:	56                   	push   %esi
+  801980:	53                   	push   %ebx
+  801981:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801984:	8b 45 08             	mov    0x8(%ebp),%eax
+  801987:	8b 40 0c             	mov    0xc(%eax),%eax
+  80198a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80198f:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801995:	ba 00 00 00 00       	mov    $0x0,%edx
+  80199a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80199f:	e8 a3 fe ff ff       	call   801847 <fsipc>
+  8019a4:	89 c3                	mov    %eax,%ebx
+  8019a6:	85 c0                	test   %eax,%eax
+  8019a8:	78 1f                	js     8019c9 <devfile_read+0x4d>
+	assert(r <= n);
+  8019aa:	39 c6                	cmp    %eax,%esi
+  8019ac:	72 24                	jb     8019d2 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8019ae:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019b3:	7f 33                	jg     8019e8 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8019b5:	83 ec 04             	sub    $0x4,%esp
+  8019b8:	50                   	push   %eax
+  8019b9:	68 00 60 80 00       	push   $0x806000
+  8019be:	ff 75 0c             	push   0xc(%ebp)
+  8019c1:	e8 e6 f1 ff ff       	call   800bac <memmove>
+	return r;
+  8019c6:	83 c4 10             	add    $0x10,%esp
+}
+  8019c9:	89 d8                	mov    %ebx,%eax
+  8019cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ce:	5b                   	pop    %ebx
+  8019cf:	5e                   	pop    %esi
+  8019d0:	5d                   	pop    %ebp
+  8019d1:	c3                   	ret
+	assert(r <= n);
+  8019d2:	68 fc 2f 80 00       	push   $0x802ffc
+  8019d7:	68 03 30 80 00       	push   $0x803003
+  8019dc:	6a 7c                	push   $0x7c
+  8019de:	68 18 30 80 00       	push   $0x803018
+  8019e3:	e8 75 e9 ff ff       	call   80035d <_panic>
+	assert(r <= PGSIZE);
+  8019e8:	68 23 30 80 00       	push   $0x803023
+  8019ed:	68 03 30 80 00       	push   $0x803003
+  8019f2:	6a 7d                	push   $0x7d
+  8019f4:	68 18 30 80 00       	push   $0x803018
+  8019f9:	e8 5f e9 ff ff       	call   80035d <_panic>
+
+008019fe <open>:
+{
+  8019fe:	55                   	push   %ebp
+  8019ff:	89 e5                	mov    %esp,%ebp
+  801a01:	56                   	push   %esi
+  801a02:	53                   	push   %ebx
+  801a03:	83 ec 1c             	sub    $0x1c,%esp
+  801a06:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a09:	56                   	push   %esi
+  801a0a:	e8 dc ef ff ff       	call   8009eb <strlen>
+  801a0f:	83 c4 10             	add    $0x10,%esp
+  801a12:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a17:	7f 6c                	jg     801a85 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801a19:	83 ec 0c             	sub    $0xc,%esp
+  801a1c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a1f:	50                   	push   %eax
+  801a20:	e8 ba f8 ff ff       	call   8012df <fd_alloc>
+  801a25:	89 c3                	mov    %eax,%ebx
+  801a27:	83 c4 10             	add    $0x10,%esp
+  801a2a:	85 c0                	test   %eax,%eax
+  801a2c:	78 3c                	js     801a6a <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a2e:	83 ec 08             	sub    $0x8,%esp
+  801a31:	56                   	push   %esi
+  801a32:	68 00 60 80 00       	push   $0x806000
+  801a37:	e8 ea ef ff ff       	call   800a26 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a3f:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a44:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a47:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a4c:	e8 f6 fd ff ff       	call   801847 <fsipc>
+  801a51:	89 c3                	mov    %eax,%ebx
+  801a53:	83 c4 10             	add    $0x10,%esp
+  801a56:	85 c0                	test   %eax,%eax
+  801a58:	78 19                	js     801a73 <open+0x75>
+	return fd2num(fd);
+  801a5a:	83 ec 0c             	sub    $0xc,%esp
+  801a5d:	ff 75 f4             	push   -0xc(%ebp)
+  801a60:	e8 53 f8 ff ff       	call   8012b8 <fd2num>
+  801a65:	89 c3                	mov    %eax,%ebx
+  801a67:	83 c4 10             	add    $0x10,%esp
+}
+  801a6a:	89 d8                	mov    %ebx,%eax
+  801a6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a6f:	5b                   	pop    %ebx
+  801a70:	5e                   	pop    %esi
+  801a71:	5d                   	pop    %ebp
+  801a72:	c3                   	ret
+		fd_close(fd, 0);
+  801a73:	83 ec 08             	sub    $0x8,%esp
+  801a76:	6a 00                	push   $0x0
+  801a78:	ff 75 f4             	push   -0xc(%ebp)
+  801a7b:	e8 58 f9 ff ff       	call   8013d8 <fd_close>
+		return r;
+  801a80:	83 c4 10             	add    $0x10,%esp
+  801a83:	eb e5                	jmp    801a6a <open+0x6c>
+		return -E_BAD_PATH;
+  801a85:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a8a:	eb de                	jmp    801a6a <open+0x6c>
+
+00801a8c <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801a8c:	55                   	push   %ebp
+  801a8d:	89 e5                	mov    %esp,%ebp
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801a92:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a97:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a9c:	e8 a6 fd ff ff       	call   801847 <fsipc>
+}
+  801aa1:	c9                   	leave
+  801aa2:	c3                   	ret
+
+00801aa3 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801aa3:	55                   	push   %ebp
+  801aa4:	89 e5                	mov    %esp,%ebp
+  801aa6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801aa9:	68 2f 30 80 00       	push   $0x80302f
+  801aae:	ff 75 0c             	push   0xc(%ebp)
+  801ab1:	e8 70 ef ff ff       	call   800a26 <strcpy>
+	return 0;
+}
+  801ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abb:	c9                   	leave
+  801abc:	c3                   	ret
+
+00801abd <devsock_close>:
+{
+  801abd:	55                   	push   %ebp
+  801abe:	89 e5                	mov    %esp,%ebp
+  801ac0:	53                   	push   %ebx
+  801ac1:	83 ec 10             	sub    $0x10,%esp
+  801ac4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801ac7:	53                   	push   %ebx
+  801ac8:	e8 d8 09 00 00       	call   8024a5 <pageref>
+  801acd:	89 c2                	mov    %eax,%edx
+  801acf:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801ad7:	83 fa 01             	cmp    $0x1,%edx
+  801ada:	74 05                	je     801ae1 <devsock_close+0x24>
+}
+  801adc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801adf:	c9                   	leave
+  801ae0:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801ae1:	83 ec 0c             	sub    $0xc,%esp
+  801ae4:	ff 73 0c             	push   0xc(%ebx)
+  801ae7:	e8 b7 02 00 00       	call   801da3 <nsipc_close>
+  801aec:	83 c4 10             	add    $0x10,%esp
+  801aef:	eb eb                	jmp    801adc <devsock_close+0x1f>
+
+00801af1 <devsock_write>:
+{
+  801af1:	55                   	push   %ebp
+  801af2:	89 e5                	mov    %esp,%ebp
+  801af4:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801af7:	6a 00                	push   $0x0
+  801af9:	ff 75 10             	push   0x10(%ebp)
+  801afc:	ff 75 0c             	push   0xc(%ebp)
+  801aff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b02:	ff 70 0c             	push   0xc(%eax)
+  801b05:	e8 79 03 00 00       	call   801e83 <nsipc_send>
+}
+  801b0a:	c9                   	leave
+  801b0b:	c3                   	ret
+
+00801b0c <devsock_read>:
+{
+  801b0c:	55                   	push   %ebp
+  801b0d:	89 e5                	mov    %esp,%ebp
+  801b0f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801b12:	6a 00                	push   $0x0
+  801b14:	ff 75 10             	push   0x10(%ebp)
+  801b17:	ff 75 0c             	push   0xc(%ebp)
+  801b1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b1d:	ff 70 0c             	push   0xc(%eax)
+  801b20:	e8 ef 02 00 00       	call   801e14 <nsipc_recv>
+}
+  801b25:	c9                   	leave
+  801b26:	c3                   	ret
+
+00801b27 <fd2sockid>:
+{
+  801b27:	55                   	push   %ebp
+  801b28:	89 e5                	mov    %esp,%ebp
+  801b2a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801b2d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b30:	52                   	push   %edx
+  801b31:	50                   	push   %eax
+  801b32:	e8 fe f7 ff ff       	call   801335 <fd_lookup>
+  801b37:	83 c4 10             	add    $0x10,%esp
+  801b3a:	85 c0                	test   %eax,%eax
+  801b3c:	78 10                	js     801b4e <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801b3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b41:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801b47:	39 08                	cmp    %ecx,(%eax)
+  801b49:	75 05                	jne    801b50 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801b4b:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801b4e:	c9                   	leave
+  801b4f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b50:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b55:	eb f7                	jmp    801b4e <fd2sockid+0x27>
+
+00801b57 <alloc_sockfd>:
+{
+  801b57:	55                   	push   %ebp
+  801b58:	89 e5                	mov    %esp,%ebp
+  801b5a:	56                   	push   %esi
+  801b5b:	53                   	push   %ebx
+  801b5c:	83 ec 1c             	sub    $0x1c,%esp
+  801b5f:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801b61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b64:	50                   	push   %eax
+  801b65:	e8 75 f7 ff ff       	call   8012df <fd_alloc>
+  801b6a:	89 c3                	mov    %eax,%ebx
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	78 43                	js     801bb6 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801b73:	83 ec 04             	sub    $0x4,%esp
+  801b76:	68 07 04 00 00       	push   $0x407
+  801b7b:	ff 75 f4             	push   -0xc(%ebp)
+  801b7e:	6a 00                	push   $0x0
+  801b80:	e8 0e f3 ff ff       	call   800e93 <sys_page_alloc>
+  801b85:	89 c3                	mov    %eax,%ebx
+  801b87:	83 c4 10             	add    $0x10,%esp
+  801b8a:	85 c0                	test   %eax,%eax
+  801b8c:	78 28                	js     801bb6 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801b8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b91:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801b97:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801b99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b9c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801ba3:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801ba6:	83 ec 0c             	sub    $0xc,%esp
+  801ba9:	50                   	push   %eax
+  801baa:	e8 09 f7 ff ff       	call   8012b8 <fd2num>
+  801baf:	89 c3                	mov    %eax,%ebx
+  801bb1:	83 c4 10             	add    $0x10,%esp
+  801bb4:	eb 0c                	jmp    801bc2 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801bb6:	83 ec 0c             	sub    $0xc,%esp
+  801bb9:	56                   	push   %esi
+  801bba:	e8 e4 01 00 00       	call   801da3 <nsipc_close>
+		return r;
+  801bbf:	83 c4 10             	add    $0x10,%esp
+}
+  801bc2:	89 d8                	mov    %ebx,%eax
+  801bc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bc7:	5b                   	pop    %ebx
+  801bc8:	5e                   	pop    %esi
+  801bc9:	5d                   	pop    %ebp
+  801bca:	c3                   	ret
+
+00801bcb <accept>:
+{
+  801bcb:	55                   	push   %ebp
+  801bcc:	89 e5                	mov    %esp,%ebp
+  801bce:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd4:	e8 4e ff ff ff       	call   801b27 <fd2sockid>
+  801bd9:	85 c0                	test   %eax,%eax
+  801bdb:	78 1b                	js     801bf8 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801bdd:	83 ec 04             	sub    $0x4,%esp
+  801be0:	ff 75 10             	push   0x10(%ebp)
+  801be3:	ff 75 0c             	push   0xc(%ebp)
+  801be6:	50                   	push   %eax
+  801be7:	e8 0e 01 00 00       	call   801cfa <nsipc_accept>
+  801bec:	83 c4 10             	add    $0x10,%esp
+  801bef:	85 c0                	test   %eax,%eax
+  801bf1:	78 05                	js     801bf8 <accept+0x2d>
+	return alloc_sockfd(r);
+  801bf3:	e8 5f ff ff ff       	call   801b57 <alloc_sockfd>
+}
+  801bf8:	c9                   	leave
+  801bf9:	c3                   	ret
+
+00801bfa <bind>:
+{
+  801bfa:	55                   	push   %ebp
+  801bfb:	89 e5                	mov    %esp,%ebp
+  801bfd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c00:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c03:	e8 1f ff ff ff       	call   801b27 <fd2sockid>
+  801c08:	85 c0                	test   %eax,%eax
+  801c0a:	78 12                	js     801c1e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801c0c:	83 ec 04             	sub    $0x4,%esp
+  801c0f:	ff 75 10             	push   0x10(%ebp)
+  801c12:	ff 75 0c             	push   0xc(%ebp)
+  801c15:	50                   	push   %eax
+  801c16:	e8 31 01 00 00       	call   801d4c <nsipc_bind>
+  801c1b:	83 c4 10             	add    $0x10,%esp
+}
+  801c1e:	c9                   	leave
+  801c1f:	c3                   	ret
+
+00801c20 <shutdown>:
+{
+  801c20:	55                   	push   %ebp
+  801c21:	89 e5                	mov    %esp,%ebp
+  801c23:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c29:	e8 f9 fe ff ff       	call   801b27 <fd2sockid>
+  801c2e:	85 c0                	test   %eax,%eax
+  801c30:	78 0f                	js     801c41 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801c32:	83 ec 08             	sub    $0x8,%esp
+  801c35:	ff 75 0c             	push   0xc(%ebp)
+  801c38:	50                   	push   %eax
+  801c39:	e8 43 01 00 00       	call   801d81 <nsipc_shutdown>
+  801c3e:	83 c4 10             	add    $0x10,%esp
+}
+  801c41:	c9                   	leave
+  801c42:	c3                   	ret
+
+00801c43 <connect>:
+{
+  801c43:	55                   	push   %ebp
+  801c44:	89 e5                	mov    %esp,%ebp
+  801c46:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c49:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c4c:	e8 d6 fe ff ff       	call   801b27 <fd2sockid>
+  801c51:	85 c0                	test   %eax,%eax
+  801c53:	78 12                	js     801c67 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801c55:	83 ec 04             	sub    $0x4,%esp
+  801c58:	ff 75 10             	push   0x10(%ebp)
+  801c5b:	ff 75 0c             	push   0xc(%ebp)
+  801c5e:	50                   	push   %eax
+  801c5f:	e8 59 01 00 00       	call   801dbd <nsipc_connect>
+  801c64:	83 c4 10             	add    $0x10,%esp
+}
+  801c67:	c9                   	leave
+  801c68:	c3                   	ret
+
+00801c69 <listen>:
+{
+  801c69:	55                   	push   %ebp
+  801c6a:	89 e5                	mov    %esp,%ebp
+  801c6c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c72:	e8 b0 fe ff ff       	call   801b27 <fd2sockid>
+  801c77:	85 c0                	test   %eax,%eax
+  801c79:	78 0f                	js     801c8a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801c7b:	83 ec 08             	sub    $0x8,%esp
+  801c7e:	ff 75 0c             	push   0xc(%ebp)
+  801c81:	50                   	push   %eax
+  801c82:	e8 6b 01 00 00       	call   801df2 <nsipc_listen>
+  801c87:	83 c4 10             	add    $0x10,%esp
+}
+  801c8a:	c9                   	leave
+  801c8b:	c3                   	ret
+
+00801c8c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801c8c:	55                   	push   %ebp
+  801c8d:	89 e5                	mov    %esp,%ebp
+  801c8f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801c92:	ff 75 10             	push   0x10(%ebp)
+  801c95:	ff 75 0c             	push   0xc(%ebp)
+  801c98:	ff 75 08             	push   0x8(%ebp)
+  801c9b:	e8 41 02 00 00       	call   801ee1 <nsipc_socket>
+  801ca0:	83 c4 10             	add    $0x10,%esp
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	78 05                	js     801cac <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801ca7:	e8 ab fe ff ff       	call   801b57 <alloc_sockfd>
+}
+  801cac:	c9                   	leave
+  801cad:	c3                   	ret
+
+00801cae <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801cae:	55                   	push   %ebp
+  801caf:	89 e5                	mov    %esp,%ebp
+  801cb1:	53                   	push   %ebx
+  801cb2:	83 ec 04             	sub    $0x4,%esp
+  801cb5:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801cb7:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801cbe:	74 26                	je     801ce6 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801cc0:	6a 07                	push   $0x7
+  801cc2:	68 00 70 80 00       	push   $0x807000
+  801cc7:	53                   	push   %ebx
+  801cc8:	ff 35 04 50 80 00    	push   0x805004
+  801cce:	e8 6e 07 00 00       	call   802441 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801cd3:	83 c4 0c             	add    $0xc,%esp
+  801cd6:	6a 00                	push   $0x0
+  801cd8:	6a 00                	push   $0x0
+  801cda:	6a 00                	push   $0x0
+  801cdc:	e8 e8 06 00 00       	call   8023c9 <ipc_recv>
+}
+  801ce1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ce4:	c9                   	leave
+  801ce5:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ce6:	83 ec 0c             	sub    $0xc,%esp
+  801ce9:	6a 02                	push   $0x2
+  801ceb:	e8 a5 07 00 00       	call   802495 <ipc_find_env>
+  801cf0:	a3 04 50 80 00       	mov    %eax,0x805004
+  801cf5:	83 c4 10             	add    $0x10,%esp
+  801cf8:	eb c6                	jmp    801cc0 <nsipc+0x12>
+
+00801cfa <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801cfa:	55                   	push   %ebp
+  801cfb:	89 e5                	mov    %esp,%ebp
+  801cfd:	56                   	push   %esi
+  801cfe:	53                   	push   %ebx
+  801cff:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801d02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d05:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801d0a:	8b 06                	mov    (%esi),%eax
+  801d0c:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801d11:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d16:	e8 93 ff ff ff       	call   801cae <nsipc>
+  801d1b:	89 c3                	mov    %eax,%ebx
+  801d1d:	85 c0                	test   %eax,%eax
+  801d1f:	79 09                	jns    801d2a <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801d21:	89 d8                	mov    %ebx,%eax
+  801d23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d26:	5b                   	pop    %ebx
+  801d27:	5e                   	pop    %esi
+  801d28:	5d                   	pop    %ebp
+  801d29:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801d2a:	83 ec 04             	sub    $0x4,%esp
+  801d2d:	ff 35 10 70 80 00    	push   0x807010
+  801d33:	68 00 70 80 00       	push   $0x807000
+  801d38:	ff 75 0c             	push   0xc(%ebp)
+  801d3b:	e8 6c ee ff ff       	call   800bac <memmove>
+		*addrlen = ret->ret_addrlen;
+  801d40:	a1 10 70 80 00       	mov    0x807010,%eax
+  801d45:	89 06                	mov    %eax,(%esi)
+  801d47:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801d4a:	eb d5                	jmp    801d21 <nsipc_accept+0x27>
+
+00801d4c <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801d4c:	55                   	push   %ebp
+  801d4d:	89 e5                	mov    %esp,%ebp
+  801d4f:	53                   	push   %ebx
+  801d50:	83 ec 08             	sub    $0x8,%esp
+  801d53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801d56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d59:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801d5e:	53                   	push   %ebx
+  801d5f:	ff 75 0c             	push   0xc(%ebp)
+  801d62:	68 04 70 80 00       	push   $0x807004
+  801d67:	e8 40 ee ff ff       	call   800bac <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801d6c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801d72:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d77:	e8 32 ff ff ff       	call   801cae <nsipc>
+}
+  801d7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d7f:	c9                   	leave
+  801d80:	c3                   	ret
+
+00801d81 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801d81:	55                   	push   %ebp
+  801d82:	89 e5                	mov    %esp,%ebp
+  801d84:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801d87:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801d8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d92:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801d97:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d9c:	e8 0d ff ff ff       	call   801cae <nsipc>
+}
+  801da1:	c9                   	leave
+  801da2:	c3                   	ret
+
+00801da3 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801da3:	55                   	push   %ebp
+  801da4:	89 e5                	mov    %esp,%ebp
+  801da6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dac:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801db1:	b8 04 00 00 00       	mov    $0x4,%eax
+  801db6:	e8 f3 fe ff ff       	call   801cae <nsipc>
+}
+  801dbb:	c9                   	leave
+  801dbc:	c3                   	ret
+
+00801dbd <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801dbd:	55                   	push   %ebp
+  801dbe:	89 e5                	mov    %esp,%ebp
+  801dc0:	53                   	push   %ebx
+  801dc1:	83 ec 08             	sub    $0x8,%esp
+  801dc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801dc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dca:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801dcf:	53                   	push   %ebx
+  801dd0:	ff 75 0c             	push   0xc(%ebp)
+  801dd3:	68 04 70 80 00       	push   $0x807004
+  801dd8:	e8 cf ed ff ff       	call   800bac <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801ddd:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801de3:	b8 05 00 00 00       	mov    $0x5,%eax
+  801de8:	e8 c1 fe ff ff       	call   801cae <nsipc>
+}
+  801ded:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801df0:	c9                   	leave
+  801df1:	c3                   	ret
+
+00801df2 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801df2:	55                   	push   %ebp
+  801df3:	89 e5                	mov    %esp,%ebp
+  801df5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801df8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dfb:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801e00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e03:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801e08:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e0d:	e8 9c fe ff ff       	call   801cae <nsipc>
+}
+  801e12:	c9                   	leave
+  801e13:	c3                   	ret
+
+00801e14 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801e14:	55                   	push   %ebp
+  801e15:	89 e5                	mov    %esp,%ebp
+  801e17:	56                   	push   %esi
+  801e18:	53                   	push   %ebx
+  801e19:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801e1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801e24:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801e2a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e2d:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801e32:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e37:	e8 72 fe ff ff       	call   801cae <nsipc>
+  801e3c:	89 c3                	mov    %eax,%ebx
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	78 22                	js     801e64 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801e42:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801e47:	39 c6                	cmp    %eax,%esi
+  801e49:	0f 4e c6             	cmovle %esi,%eax
+  801e4c:	39 c3                	cmp    %eax,%ebx
+  801e4e:	7f 1d                	jg     801e6d <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801e50:	83 ec 04             	sub    $0x4,%esp
+  801e53:	53                   	push   %ebx
+  801e54:	68 00 70 80 00       	push   $0x807000
+  801e59:	ff 75 0c             	push   0xc(%ebp)
+  801e5c:	e8 4b ed ff ff       	call   800bac <memmove>
+  801e61:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801e64:	89 d8                	mov    %ebx,%eax
+  801e66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e69:	5b                   	pop    %ebx
+  801e6a:	5e                   	pop    %esi
+  801e6b:	5d                   	pop    %ebp
+  801e6c:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801e6d:	68 3b 30 80 00       	push   $0x80303b
+  801e72:	68 03 30 80 00       	push   $0x803003
+  801e77:	6a 62                	push   $0x62
+  801e79:	68 50 30 80 00       	push   $0x803050
+  801e7e:	e8 da e4 ff ff       	call   80035d <_panic>
+
+00801e83 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801e83:	55                   	push   %ebp
+  801e84:	89 e5                	mov    %esp,%ebp
+  801e86:	53                   	push   %ebx
+  801e87:	83 ec 04             	sub    $0x4,%esp
+  801e8a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801e8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e90:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801e95:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801e9b:	7f 2e                	jg     801ecb <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801e9d:	83 ec 04             	sub    $0x4,%esp
+  801ea0:	53                   	push   %ebx
+  801ea1:	ff 75 0c             	push   0xc(%ebp)
+  801ea4:	68 0c 70 80 00       	push   $0x80700c
+  801ea9:	e8 fe ec ff ff       	call   800bac <memmove>
+	nsipcbuf.send.req_size = size;
+  801eae:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801eb4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801eb7:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801ebc:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ec1:	e8 e8 fd ff ff       	call   801cae <nsipc>
+}
+  801ec6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ec9:	c9                   	leave
+  801eca:	c3                   	ret
+	assert(size < 1600);
+  801ecb:	68 5c 30 80 00       	push   $0x80305c
+  801ed0:	68 03 30 80 00       	push   $0x803003
+  801ed5:	6a 6d                	push   $0x6d
+  801ed7:	68 50 30 80 00       	push   $0x803050
+  801edc:	e8 7c e4 ff ff       	call   80035d <_panic>
+
+00801ee1 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801ee1:	55                   	push   %ebp
+  801ee2:	89 e5                	mov    %esp,%ebp
+  801ee4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801ee7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eea:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801eef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ef2:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801ef7:	8b 45 10             	mov    0x10(%ebp),%eax
+  801efa:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801eff:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f04:	e8 a5 fd ff ff       	call   801cae <nsipc>
+}
+  801f09:	c9                   	leave
+  801f0a:	c3                   	ret
+
+00801f0b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f0b:	55                   	push   %ebp
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	56                   	push   %esi
+  801f0f:	53                   	push   %ebx
+  801f10:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801f13:	83 ec 0c             	sub    $0xc,%esp
+  801f16:	ff 75 08             	push   0x8(%ebp)
+  801f19:	e8 aa f3 ff ff       	call   8012c8 <fd2data>
+  801f1e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801f20:	83 c4 08             	add    $0x8,%esp
+  801f23:	68 68 30 80 00       	push   $0x803068
+  801f28:	53                   	push   %ebx
+  801f29:	e8 f8 ea ff ff       	call   800a26 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801f2e:	8b 46 04             	mov    0x4(%esi),%eax
+  801f31:	2b 06                	sub    (%esi),%eax
+  801f33:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801f39:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f40:	00 00 00 
+	stat->st_dev = &devpipe;
+  801f43:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801f4a:	40 80 00 
+	return 0;
+}
+  801f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f55:	5b                   	pop    %ebx
+  801f56:	5e                   	pop    %esi
+  801f57:	5d                   	pop    %ebp
+  801f58:	c3                   	ret
+
+00801f59 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801f59:	55                   	push   %ebp
+  801f5a:	89 e5                	mov    %esp,%ebp
+  801f5c:	53                   	push   %ebx
+  801f5d:	83 ec 0c             	sub    $0xc,%esp
+  801f60:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801f63:	53                   	push   %ebx
+  801f64:	6a 00                	push   $0x0
+  801f66:	e8 f0 ef ff ff       	call   800f5b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801f6b:	89 1c 24             	mov    %ebx,(%esp)
+  801f6e:	e8 55 f3 ff ff       	call   8012c8 <fd2data>
+  801f73:	83 c4 08             	add    $0x8,%esp
+  801f76:	50                   	push   %eax
+  801f77:	6a 00                	push   $0x0
+  801f79:	e8 dd ef ff ff       	call   800f5b <sys_page_unmap>
+}
+  801f7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f81:	c9                   	leave
+  801f82:	c3                   	ret
+
+00801f83 <_pipeisclosed>:
+{
+  801f83:	55                   	push   %ebp
+  801f84:	89 e5                	mov    %esp,%ebp
+  801f86:	57                   	push   %edi
+  801f87:	56                   	push   %esi
+  801f88:	53                   	push   %ebx
+  801f89:	83 ec 1c             	sub    $0x1c,%esp
+  801f8c:	89 c7                	mov    %eax,%edi
+  801f8e:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801f90:	a1 08 50 80 00       	mov    0x805008,%eax
+  801f95:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801f98:	83 ec 0c             	sub    $0xc,%esp
+  801f9b:	57                   	push   %edi
+  801f9c:	e8 04 05 00 00       	call   8024a5 <pageref>
+  801fa1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fa4:	89 34 24             	mov    %esi,(%esp)
+  801fa7:	e8 f9 04 00 00       	call   8024a5 <pageref>
+		nn = thisenv->env_runs;
+  801fac:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  801fb2:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801fb5:	83 c4 10             	add    $0x10,%esp
+  801fb8:	39 cb                	cmp    %ecx,%ebx
+  801fba:	74 1b                	je     801fd7 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801fbc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801fbf:	75 cf                	jne    801f90 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801fc1:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801fc4:	6a 01                	push   $0x1
+  801fc6:	50                   	push   %eax
+  801fc7:	53                   	push   %ebx
+  801fc8:	68 6f 30 80 00       	push   $0x80306f
+  801fcd:	e8 66 e4 ff ff       	call   800438 <cprintf>
+  801fd2:	83 c4 10             	add    $0x10,%esp
+  801fd5:	eb b9                	jmp    801f90 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801fd7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801fda:	0f 94 c0             	sete   %al
+  801fdd:	0f b6 c0             	movzbl %al,%eax
+}
+  801fe0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fe3:	5b                   	pop    %ebx
+  801fe4:	5e                   	pop    %esi
+  801fe5:	5f                   	pop    %edi
+  801fe6:	5d                   	pop    %ebp
+  801fe7:	c3                   	ret
+
+00801fe8 <devpipe_write>:
+{
+  801fe8:	55                   	push   %ebp
+  801fe9:	89 e5                	mov    %esp,%ebp
+  801feb:	57                   	push   %edi
+  801fec:	56                   	push   %esi
+  801fed:	53                   	push   %ebx
+  801fee:	83 ec 28             	sub    $0x28,%esp
+  801ff1:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801ff4:	56                   	push   %esi
+  801ff5:	e8 ce f2 ff ff       	call   8012c8 <fd2data>
+  801ffa:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801ffc:	83 c4 10             	add    $0x10,%esp
+  801fff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802004:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802007:	75 09                	jne    802012 <devpipe_write+0x2a>
+	return i;
+  802009:	89 f8                	mov    %edi,%eax
+  80200b:	eb 23                	jmp    802030 <devpipe_write+0x48>
+			sys_yield();
+  80200d:	e8 01 ee ff ff       	call   800e13 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802012:	8b 43 04             	mov    0x4(%ebx),%eax
+  802015:	8b 0b                	mov    (%ebx),%ecx
+  802017:	8d 51 20             	lea    0x20(%ecx),%edx
+  80201a:	39 d0                	cmp    %edx,%eax
+  80201c:	72 1a                	jb     802038 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80201e:	89 da                	mov    %ebx,%edx
+  802020:	89 f0                	mov    %esi,%eax
+  802022:	e8 5c ff ff ff       	call   801f83 <_pipeisclosed>
+  802027:	85 c0                	test   %eax,%eax
+  802029:	74 e2                	je     80200d <devpipe_write+0x25>
+				return 0;
+  80202b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802030:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802033:	5b                   	pop    %ebx
+  802034:	5e                   	pop    %esi
+  802035:	5f                   	pop    %edi
+  802036:	5d                   	pop    %ebp
+  802037:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802038:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80203b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80203f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802042:	89 c2                	mov    %eax,%edx
+  802044:	c1 fa 1f             	sar    $0x1f,%edx
+  802047:	89 d1                	mov    %edx,%ecx
+  802049:	c1 e9 1b             	shr    $0x1b,%ecx
+  80204c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80204f:	83 e2 1f             	and    $0x1f,%edx
+  802052:	29 ca                	sub    %ecx,%edx
+  802054:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802058:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80205c:	83 c0 01             	add    $0x1,%eax
+  80205f:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802062:	83 c7 01             	add    $0x1,%edi
+  802065:	eb 9d                	jmp    802004 <devpipe_write+0x1c>
+
+00802067 <devpipe_read>:
+{
+  802067:	55                   	push   %ebp
+  802068:	89 e5                	mov    %esp,%ebp
+  80206a:	57                   	push   %edi
+  80206b:	56                   	push   %esi
+  80206c:	53                   	push   %ebx
+  80206d:	83 ec 18             	sub    $0x18,%esp
+  802070:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802073:	57                   	push   %edi
+  802074:	e8 4f f2 ff ff       	call   8012c8 <fd2data>
+  802079:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80207b:	83 c4 10             	add    $0x10,%esp
+  80207e:	be 00 00 00 00       	mov    $0x0,%esi
+  802083:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802086:	75 13                	jne    80209b <devpipe_read+0x34>
+	return i;
+  802088:	89 f0                	mov    %esi,%eax
+  80208a:	eb 02                	jmp    80208e <devpipe_read+0x27>
+				return i;
+  80208c:	89 f0                	mov    %esi,%eax
+}
+  80208e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802091:	5b                   	pop    %ebx
+  802092:	5e                   	pop    %esi
+  802093:	5f                   	pop    %edi
+  802094:	5d                   	pop    %ebp
+  802095:	c3                   	ret
+			sys_yield();
+  802096:	e8 78 ed ff ff       	call   800e13 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80209b:	8b 03                	mov    (%ebx),%eax
+  80209d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8020a0:	75 18                	jne    8020ba <devpipe_read+0x53>
+			if (i > 0)
+  8020a2:	85 f6                	test   %esi,%esi
+  8020a4:	75 e6                	jne    80208c <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8020a6:	89 da                	mov    %ebx,%edx
+  8020a8:	89 f8                	mov    %edi,%eax
+  8020aa:	e8 d4 fe ff ff       	call   801f83 <_pipeisclosed>
+  8020af:	85 c0                	test   %eax,%eax
+  8020b1:	74 e3                	je     802096 <devpipe_read+0x2f>
+				return 0;
+  8020b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b8:	eb d4                	jmp    80208e <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8020ba:	99                   	cltd
+  8020bb:	c1 ea 1b             	shr    $0x1b,%edx
+  8020be:	01 d0                	add    %edx,%eax
+  8020c0:	83 e0 1f             	and    $0x1f,%eax
+  8020c3:	29 d0                	sub    %edx,%eax
+  8020c5:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8020ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020cd:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8020d0:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8020d3:	83 c6 01             	add    $0x1,%esi
+  8020d6:	eb ab                	jmp    802083 <devpipe_read+0x1c>
+
+008020d8 <pipe>:
+{
+  8020d8:	55                   	push   %ebp
+  8020d9:	89 e5                	mov    %esp,%ebp
+  8020db:	56                   	push   %esi
+  8020dc:	53                   	push   %ebx
+  8020dd:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8020e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e3:	50                   	push   %eax
+  8020e4:	e8 f6 f1 ff ff       	call   8012df <fd_alloc>
+  8020e9:	89 c3                	mov    %eax,%ebx
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	85 c0                	test   %eax,%eax
+  8020f0:	0f 88 23 01 00 00    	js     802219 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020f6:	83 ec 04             	sub    $0x4,%esp
+  8020f9:	68 07 04 00 00       	push   $0x407
+  8020fe:	ff 75 f4             	push   -0xc(%ebp)
+  802101:	6a 00                	push   $0x0
+  802103:	e8 8b ed ff ff       	call   800e93 <sys_page_alloc>
+  802108:	89 c3                	mov    %eax,%ebx
+  80210a:	83 c4 10             	add    $0x10,%esp
+  80210d:	85 c0                	test   %eax,%eax
+  80210f:	0f 88 04 01 00 00    	js     802219 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802115:	83 ec 0c             	sub    $0xc,%esp
+  802118:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80211b:	50                   	push   %eax
+  80211c:	e8 be f1 ff ff       	call   8012df <fd_alloc>
+  802121:	89 c3                	mov    %eax,%ebx
+  802123:	83 c4 10             	add    $0x10,%esp
+  802126:	85 c0                	test   %eax,%eax
+  802128:	0f 88 db 00 00 00    	js     802209 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80212e:	83 ec 04             	sub    $0x4,%esp
+  802131:	68 07 04 00 00       	push   $0x407
+  802136:	ff 75 f0             	push   -0x10(%ebp)
+  802139:	6a 00                	push   $0x0
+  80213b:	e8 53 ed ff ff       	call   800e93 <sys_page_alloc>
+  802140:	89 c3                	mov    %eax,%ebx
+  802142:	83 c4 10             	add    $0x10,%esp
+  802145:	85 c0                	test   %eax,%eax
+  802147:	0f 88 bc 00 00 00    	js     802209 <pipe+0x131>
+	va = fd2data(fd0);
+  80214d:	83 ec 0c             	sub    $0xc,%esp
+  802150:	ff 75 f4             	push   -0xc(%ebp)
+  802153:	e8 70 f1 ff ff       	call   8012c8 <fd2data>
+  802158:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80215a:	83 c4 0c             	add    $0xc,%esp
+  80215d:	68 07 04 00 00       	push   $0x407
+  802162:	50                   	push   %eax
+  802163:	6a 00                	push   $0x0
+  802165:	e8 29 ed ff ff       	call   800e93 <sys_page_alloc>
+  80216a:	89 c3                	mov    %eax,%ebx
+  80216c:	83 c4 10             	add    $0x10,%esp
+  80216f:	85 c0                	test   %eax,%eax
+  802171:	0f 88 82 00 00 00    	js     8021f9 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802177:	83 ec 0c             	sub    $0xc,%esp
+  80217a:	ff 75 f0             	push   -0x10(%ebp)
+  80217d:	e8 46 f1 ff ff       	call   8012c8 <fd2data>
+  802182:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802189:	50                   	push   %eax
+  80218a:	6a 00                	push   $0x0
+  80218c:	56                   	push   %esi
+  80218d:	6a 00                	push   $0x0
+  80218f:	e8 85 ed ff ff       	call   800f19 <sys_page_map>
+  802194:	89 c3                	mov    %eax,%ebx
+  802196:	83 c4 20             	add    $0x20,%esp
+  802199:	85 c0                	test   %eax,%eax
+  80219b:	78 4e                	js     8021eb <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80219d:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8021a2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021a5:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8021a7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021aa:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8021b1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8021b4:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8021b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8021b9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8021c0:	83 ec 0c             	sub    $0xc,%esp
+  8021c3:	ff 75 f4             	push   -0xc(%ebp)
+  8021c6:	e8 ed f0 ff ff       	call   8012b8 <fd2num>
+  8021cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021ce:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8021d0:	83 c4 04             	add    $0x4,%esp
+  8021d3:	ff 75 f0             	push   -0x10(%ebp)
+  8021d6:	e8 dd f0 ff ff       	call   8012b8 <fd2num>
+  8021db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021de:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8021e1:	83 c4 10             	add    $0x10,%esp
+  8021e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021e9:	eb 2e                	jmp    802219 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8021eb:	83 ec 08             	sub    $0x8,%esp
+  8021ee:	56                   	push   %esi
+  8021ef:	6a 00                	push   $0x0
+  8021f1:	e8 65 ed ff ff       	call   800f5b <sys_page_unmap>
+  8021f6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8021f9:	83 ec 08             	sub    $0x8,%esp
+  8021fc:	ff 75 f0             	push   -0x10(%ebp)
+  8021ff:	6a 00                	push   $0x0
+  802201:	e8 55 ed ff ff       	call   800f5b <sys_page_unmap>
+  802206:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802209:	83 ec 08             	sub    $0x8,%esp
+  80220c:	ff 75 f4             	push   -0xc(%ebp)
+  80220f:	6a 00                	push   $0x0
+  802211:	e8 45 ed ff ff       	call   800f5b <sys_page_unmap>
+  802216:	83 c4 10             	add    $0x10,%esp
+}
+  802219:	89 d8                	mov    %ebx,%eax
+  80221b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80221e:	5b                   	pop    %ebx
+  80221f:	5e                   	pop    %esi
+  802220:	5d                   	pop    %ebp
+  802221:	c3                   	ret
+
+00802222 <pipeisclosed>:
+{
+  802222:	55                   	push   %ebp
+  802223:	89 e5                	mov    %esp,%ebp
+  802225:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802228:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80222b:	50                   	push   %eax
+  80222c:	ff 75 08             	push   0x8(%ebp)
+  80222f:	e8 01 f1 ff ff       	call   801335 <fd_lookup>
+  802234:	83 c4 10             	add    $0x10,%esp
+  802237:	85 c0                	test   %eax,%eax
+  802239:	78 18                	js     802253 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80223b:	83 ec 0c             	sub    $0xc,%esp
+  80223e:	ff 75 f4             	push   -0xc(%ebp)
+  802241:	e8 82 f0 ff ff       	call   8012c8 <fd2data>
+  802246:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802248:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80224b:	e8 33 fd ff ff       	call   801f83 <_pipeisclosed>
+  802250:	83 c4 10             	add    $0x10,%esp
+}
+  802253:	c9                   	leave
+  802254:	c3                   	ret
+
+00802255 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225a:	c3                   	ret
+
+0080225b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80225b:	55                   	push   %ebp
+  80225c:	89 e5                	mov    %esp,%ebp
+  80225e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802261:	68 87 30 80 00       	push   $0x803087
+  802266:	ff 75 0c             	push   0xc(%ebp)
+  802269:	e8 b8 e7 ff ff       	call   800a26 <strcpy>
+	return 0;
+}
+  80226e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802273:	c9                   	leave
+  802274:	c3                   	ret
+
+00802275 <devcons_write>:
+{
+  802275:	55                   	push   %ebp
+  802276:	89 e5                	mov    %esp,%ebp
+  802278:	57                   	push   %edi
+  802279:	56                   	push   %esi
+  80227a:	53                   	push   %ebx
+  80227b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802281:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802286:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80228c:	eb 2e                	jmp    8022bc <devcons_write+0x47>
+		m = n - tot;
+  80228e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802291:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802293:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802298:	39 c3                	cmp    %eax,%ebx
+  80229a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80229d:	83 ec 04             	sub    $0x4,%esp
+  8022a0:	53                   	push   %ebx
+  8022a1:	89 f0                	mov    %esi,%eax
+  8022a3:	03 45 0c             	add    0xc(%ebp),%eax
+  8022a6:	50                   	push   %eax
+  8022a7:	57                   	push   %edi
+  8022a8:	e8 ff e8 ff ff       	call   800bac <memmove>
+		sys_cputs(buf, m);
+  8022ad:	83 c4 08             	add    $0x8,%esp
+  8022b0:	53                   	push   %ebx
+  8022b1:	57                   	push   %edi
+  8022b2:	e8 9f ea ff ff       	call   800d56 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8022b7:	01 de                	add    %ebx,%esi
+  8022b9:	83 c4 10             	add    $0x10,%esp
+  8022bc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022bf:	72 cd                	jb     80228e <devcons_write+0x19>
+}
+  8022c1:	89 f0                	mov    %esi,%eax
+  8022c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c6:	5b                   	pop    %ebx
+  8022c7:	5e                   	pop    %esi
+  8022c8:	5f                   	pop    %edi
+  8022c9:	5d                   	pop    %ebp
+  8022ca:	c3                   	ret
+
+008022cb <devcons_read>:
+{
+  8022cb:	55                   	push   %ebp
+  8022cc:	89 e5                	mov    %esp,%ebp
+  8022ce:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8022d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8022da:	75 07                	jne    8022e3 <devcons_read+0x18>
+  8022dc:	eb 1f                	jmp    8022fd <devcons_read+0x32>
+		sys_yield();
+  8022de:	e8 30 eb ff ff       	call   800e13 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8022e3:	e8 8c ea ff ff       	call   800d74 <sys_cgetc>
+  8022e8:	85 c0                	test   %eax,%eax
+  8022ea:	74 f2                	je     8022de <devcons_read+0x13>
+	if (c < 0)
+  8022ec:	78 0f                	js     8022fd <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8022ee:	83 f8 04             	cmp    $0x4,%eax
+  8022f1:	74 0c                	je     8022ff <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8022f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022f6:	88 02                	mov    %al,(%edx)
+	return 1;
+  8022f8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8022fd:	c9                   	leave
+  8022fe:	c3                   	ret
+		return 0;
+  8022ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802304:	eb f7                	jmp    8022fd <devcons_read+0x32>
+
+00802306 <cputchar>:
+{
+  802306:	55                   	push   %ebp
+  802307:	89 e5                	mov    %esp,%ebp
+  802309:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80230c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80230f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802312:	6a 01                	push   $0x1
+  802314:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802317:	50                   	push   %eax
+  802318:	e8 39 ea ff ff       	call   800d56 <sys_cputs>
+}
+  80231d:	83 c4 10             	add    $0x10,%esp
+  802320:	c9                   	leave
+  802321:	c3                   	ret
+
+00802322 <getchar>:
+{
+  802322:	55                   	push   %ebp
+  802323:	89 e5                	mov    %esp,%ebp
+  802325:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802328:	6a 01                	push   $0x1
+  80232a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80232d:	50                   	push   %eax
+  80232e:	6a 00                	push   $0x0
+  802330:	e8 66 f2 ff ff       	call   80159b <read>
+	if (r < 0)
+  802335:	83 c4 10             	add    $0x10,%esp
+  802338:	85 c0                	test   %eax,%eax
+  80233a:	78 06                	js     802342 <getchar+0x20>
+	if (r < 1)
+  80233c:	74 06                	je     802344 <getchar+0x22>
+	return c;
+  80233e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802342:	c9                   	leave
+  802343:	c3                   	ret
+		return -E_EOF;
+  802344:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802349:	eb f7                	jmp    802342 <getchar+0x20>
+
+0080234b <iscons>:
+{
+  80234b:	55                   	push   %ebp
+  80234c:	89 e5                	mov    %esp,%ebp
+  80234e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802351:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802354:	50                   	push   %eax
+  802355:	ff 75 08             	push   0x8(%ebp)
+  802358:	e8 d8 ef ff ff       	call   801335 <fd_lookup>
+  80235d:	83 c4 10             	add    $0x10,%esp
+  802360:	85 c0                	test   %eax,%eax
+  802362:	78 11                	js     802375 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802364:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802367:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80236d:	39 10                	cmp    %edx,(%eax)
+  80236f:	0f 94 c0             	sete   %al
+  802372:	0f b6 c0             	movzbl %al,%eax
+}
+  802375:	c9                   	leave
+  802376:	c3                   	ret
+
+00802377 <opencons>:
+{
+  802377:	55                   	push   %ebp
+  802378:	89 e5                	mov    %esp,%ebp
+  80237a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80237d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802380:	50                   	push   %eax
+  802381:	e8 59 ef ff ff       	call   8012df <fd_alloc>
+  802386:	83 c4 10             	add    $0x10,%esp
+  802389:	85 c0                	test   %eax,%eax
+  80238b:	78 3a                	js     8023c7 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80238d:	83 ec 04             	sub    $0x4,%esp
+  802390:	68 07 04 00 00       	push   $0x407
+  802395:	ff 75 f4             	push   -0xc(%ebp)
+  802398:	6a 00                	push   $0x0
+  80239a:	e8 f4 ea ff ff       	call   800e93 <sys_page_alloc>
+  80239f:	83 c4 10             	add    $0x10,%esp
+  8023a2:	85 c0                	test   %eax,%eax
+  8023a4:	78 21                	js     8023c7 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8023a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023a9:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8023af:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8023b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8023bb:	83 ec 0c             	sub    $0xc,%esp
+  8023be:	50                   	push   %eax
+  8023bf:	e8 f4 ee ff ff       	call   8012b8 <fd2num>
+  8023c4:	83 c4 10             	add    $0x10,%esp
+}
+  8023c7:	c9                   	leave
+  8023c8:	c3                   	ret
+
+008023c9 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8023c9:	55                   	push   %ebp
+  8023ca:	89 e5                	mov    %esp,%ebp
+  8023cc:	57                   	push   %edi
+  8023cd:	56                   	push   %esi
+  8023ce:	53                   	push   %ebx
+  8023cf:	83 ec 18             	sub    $0x18,%esp
+  8023d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8023d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8023db:	85 db                	test   %ebx,%ebx
+  8023dd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023e2:	0f 45 c3             	cmovne %ebx,%eax
+  8023e5:	50                   	push   %eax
+  8023e6:	e8 2b ee ff ff       	call   801216 <sys_ipc_recv>
+
+	if (from_env_store)
+  8023eb:	83 c4 10             	add    $0x10,%esp
+  8023ee:	85 ff                	test   %edi,%edi
+  8023f0:	74 17                	je     802409 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8023f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023f7:	85 c0                	test   %eax,%eax
+  8023f9:	75 0c                	jne    802407 <ipc_recv+0x3e>
+  8023fb:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802401:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802407:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802409:	85 f6                	test   %esi,%esi
+  80240b:	74 2e                	je     80243b <ipc_recv+0x72>
+		if (!r && pg)
+  80240d:	85 c0                	test   %eax,%eax
+  80240f:	75 24                	jne    802435 <ipc_recv+0x6c>
+  802411:	85 db                	test   %ebx,%ebx
+  802413:	74 20                	je     802435 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802415:	a1 08 50 80 00       	mov    0x805008,%eax
+  80241a:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802420:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802422:	a1 08 50 80 00       	mov    0x805008,%eax
+  802427:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  80242d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802430:	5b                   	pop    %ebx
+  802431:	5e                   	pop    %esi
+  802432:	5f                   	pop    %edi
+  802433:	5d                   	pop    %ebp
+  802434:	c3                   	ret
+			*perm_store = 0;
+  802435:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  80243b:	85 c0                	test   %eax,%eax
+  80243d:	75 ee                	jne    80242d <ipc_recv+0x64>
+  80243f:	eb e1                	jmp    802422 <ipc_recv+0x59>
+
+00802441 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802441:	55                   	push   %ebp
+  802442:	89 e5                	mov    %esp,%ebp
+  802444:	57                   	push   %edi
+  802445:	56                   	push   %esi
+  802446:	53                   	push   %ebx
+  802447:	83 ec 0c             	sub    $0xc,%esp
+  80244a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80244d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802450:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802453:	85 db                	test   %ebx,%ebx
+  802455:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80245a:	0f 44 d8             	cmove  %eax,%ebx
+  80245d:	ff 75 14             	push   0x14(%ebp)
+  802460:	53                   	push   %ebx
+  802461:	56                   	push   %esi
+  802462:	57                   	push   %edi
+  802463:	e8 8b ed ff ff       	call   8011f3 <sys_ipc_try_send_yield>
+  802468:	83 c4 10             	add    $0x10,%esp
+  80246b:	85 c0                	test   %eax,%eax
+  80246d:	79 1e                	jns    80248d <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80246f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802472:	75 07                	jne    80247b <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802474:	e8 9a e9 ff ff       	call   800e13 <sys_yield>
+  802479:	eb e2                	jmp    80245d <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  80247b:	50                   	push   %eax
+  80247c:	68 93 30 80 00       	push   $0x803093
+  802481:	6a 3d                	push   $0x3d
+  802483:	68 a8 30 80 00       	push   $0x8030a8
+  802488:	e8 d0 de ff ff       	call   80035d <_panic>
+	}
+}
+  80248d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802490:	5b                   	pop    %ebx
+  802491:	5e                   	pop    %esi
+  802492:	5f                   	pop    %edi
+  802493:	5d                   	pop    %ebp
+  802494:	c3                   	ret
+
+00802495 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802495:	55                   	push   %ebp
+  802496:	89 e5                	mov    %esp,%ebp
+  802498:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  80249b:	ff 75 08             	push   0x8(%ebp)
+  80249e:	e8 f0 e8 ff ff       	call   800d93 <sys_env_find>
+}
+  8024a3:	c9                   	leave
+  8024a4:	c3                   	ret
+
+008024a5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8024a5:	55                   	push   %ebp
+  8024a6:	89 e5                	mov    %esp,%ebp
+  8024a8:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024ab:	89 c2                	mov    %eax,%edx
+  8024ad:	c1 ea 16             	shr    $0x16,%edx
+  8024b0:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8024b7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024bc:	f6 c1 01             	test   $0x1,%cl
+  8024bf:	74 22                	je     8024e3 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8024c1:	c1 e8 0c             	shr    $0xc,%eax
+  8024c4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8024cb:	a8 01                	test   $0x1,%al
+  8024cd:	74 14                	je     8024e3 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8024cf:	c1 e8 0c             	shr    $0xc,%eax
+  8024d2:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8024d5:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8024dc:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8024e0:	0f b7 d2             	movzwl %dx,%edx
+}
+  8024e3:	89 d0                	mov    %edx,%eax
+  8024e5:	5d                   	pop    %ebp
+  8024e6:	c3                   	ret
+  8024e7:	66 90                	xchg   %ax,%ax
+  8024e9:	66 90                	xchg   %ax,%ax
+  8024eb:	66 90                	xchg   %ax,%ax
+  8024ed:	66 90                	xchg   %ax,%ax
+  8024ef:	90                   	nop
+
+008024f0 <__udivmoddi4>:
+  8024f0:	55                   	push   %ebp
+  8024f1:	57                   	push   %edi
+  8024f2:	56                   	push   %esi
+  8024f3:	53                   	push   %ebx
+  8024f4:	83 ec 14             	sub    $0x14,%esp
+  8024f7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8024fb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8024ff:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802503:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802507:	89 f1                	mov    %esi,%ecx
+  802509:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80250d:	09 d9                	or     %ebx,%ecx
+  80250f:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802513:	0f 84 92 00 00 00    	je     8025ab <__udivmoddi4+0xbb>
+  802519:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802520:	00 
+  802521:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802526:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80252d:	00 
+  80252e:	89 1c 24             	mov    %ebx,(%esp)
+  802531:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802535:	8d 76 00             	lea    0x0(%esi),%esi
+  802538:	89 e9                	mov    %ebp,%ecx
+  80253a:	89 c3                	mov    %eax,%ebx
+  80253c:	89 d6                	mov    %edx,%esi
+  80253e:	31 ff                	xor    %edi,%edi
+  802540:	d3 ee                	shr    %cl,%esi
+  802542:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802545:	f6 c1 20             	test   $0x20,%cl
+  802548:	0f 45 de             	cmovne %esi,%ebx
+  80254b:	0f 45 f7             	cmovne %edi,%esi
+  80254e:	8b 3c 24             	mov    (%esp),%edi
+  802551:	39 fb                	cmp    %edi,%ebx
+  802553:	89 f7                	mov    %esi,%edi
+  802555:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802559:	8b 1c 24             	mov    (%esp),%ebx
+  80255c:	19 f7                	sbb    %esi,%edi
+  80255e:	72 39                	jb     802599 <__udivmoddi4+0xa9>
+  802560:	89 e9                	mov    %ebp,%ecx
+  802562:	89 f7                	mov    %esi,%edi
+  802564:	89 de                	mov    %ebx,%esi
+  802566:	0f a5 df             	shld   %cl,%ebx,%edi
+  802569:	d3 e6                	shl    %cl,%esi
+  80256b:	31 db                	xor    %ebx,%ebx
+  80256d:	f6 c1 20             	test   $0x20,%cl
+  802570:	0f 45 fe             	cmovne %esi,%edi
+  802573:	0f 45 f3             	cmovne %ebx,%esi
+  802576:	29 f0                	sub    %esi,%eax
+  802578:	be 01 00 00 00       	mov    $0x1,%esi
+  80257d:	19 fa                	sbb    %edi,%edx
+  80257f:	31 ff                	xor    %edi,%edi
+  802581:	31 db                	xor    %ebx,%ebx
+  802583:	0f a5 f7             	shld   %cl,%esi,%edi
+  802586:	d3 e6                	shl    %cl,%esi
+  802588:	f6 c1 20             	test   $0x20,%cl
+  80258b:	0f 45 fe             	cmovne %esi,%edi
+  80258e:	0f 45 f3             	cmovne %ebx,%esi
+  802591:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802595:	09 74 24 08          	or     %esi,0x8(%esp)
+  802599:	83 ed 01             	sub    $0x1,%ebp
+  80259c:	73 9a                	jae    802538 <__udivmoddi4+0x48>
+  80259e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  8025a2:	85 ff                	test   %edi,%edi
+  8025a4:	74 05                	je     8025ab <__udivmoddi4+0xbb>
+  8025a6:	89 07                	mov    %eax,(%edi)
+  8025a8:	89 57 04             	mov    %edx,0x4(%edi)
+  8025ab:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025af:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025b3:	83 c4 14             	add    $0x14,%esp
+  8025b6:	5b                   	pop    %ebx
+  8025b7:	5e                   	pop    %esi
+  8025b8:	5f                   	pop    %edi
+  8025b9:	5d                   	pop    %ebp
+  8025ba:	c3                   	ret
+  8025bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8025bf:	90                   	nop
+
+008025c0 <__udivdi3>:
+  8025c0:	55                   	push   %ebp
+  8025c1:	57                   	push   %edi
+  8025c2:	56                   	push   %esi
+  8025c3:	53                   	push   %ebx
+  8025c4:	83 ec 14             	sub    $0x14,%esp
+  8025c7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8025cb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025cf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025d3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025d7:	89 fb                	mov    %edi,%ebx
+  8025d9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8025dd:	09 f3                	or     %esi,%ebx
+  8025df:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8025e3:	0f 84 85 00 00 00    	je     80266e <__udivdi3+0xae>
+  8025e9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8025f0:	00 
+  8025f1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8025f6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8025fd:	00 
+  8025fe:	89 34 24             	mov    %esi,(%esp)
+  802601:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802605:	8d 76 00             	lea    0x0(%esi),%esi
+  802608:	89 e9                	mov    %ebp,%ecx
+  80260a:	89 c3                	mov    %eax,%ebx
+  80260c:	89 d6                	mov    %edx,%esi
+  80260e:	31 ff                	xor    %edi,%edi
+  802610:	d3 ee                	shr    %cl,%esi
+  802612:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802615:	f6 c1 20             	test   $0x20,%cl
+  802618:	0f 45 de             	cmovne %esi,%ebx
+  80261b:	0f 45 f7             	cmovne %edi,%esi
+  80261e:	8b 3c 24             	mov    (%esp),%edi
+  802621:	39 fb                	cmp    %edi,%ebx
+  802623:	89 f7                	mov    %esi,%edi
+  802625:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802629:	8b 1c 24             	mov    (%esp),%ebx
+  80262c:	19 f7                	sbb    %esi,%edi
+  80262e:	72 39                	jb     802669 <__udivdi3+0xa9>
+  802630:	89 e9                	mov    %ebp,%ecx
+  802632:	89 f7                	mov    %esi,%edi
+  802634:	89 de                	mov    %ebx,%esi
+  802636:	0f a5 df             	shld   %cl,%ebx,%edi
+  802639:	d3 e6                	shl    %cl,%esi
+  80263b:	31 db                	xor    %ebx,%ebx
+  80263d:	f6 c1 20             	test   $0x20,%cl
+  802640:	0f 45 fe             	cmovne %esi,%edi
+  802643:	0f 45 f3             	cmovne %ebx,%esi
+  802646:	29 f0                	sub    %esi,%eax
+  802648:	be 01 00 00 00       	mov    $0x1,%esi
+  80264d:	19 fa                	sbb    %edi,%edx
+  80264f:	31 ff                	xor    %edi,%edi
+  802651:	31 db                	xor    %ebx,%ebx
+  802653:	0f a5 f7             	shld   %cl,%esi,%edi
+  802656:	d3 e6                	shl    %cl,%esi
+  802658:	f6 c1 20             	test   $0x20,%cl
+  80265b:	0f 45 fe             	cmovne %esi,%edi
+  80265e:	0f 45 f3             	cmovne %ebx,%esi
+  802661:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802665:	09 74 24 08          	or     %esi,0x8(%esp)
+  802669:	83 ed 01             	sub    $0x1,%ebp
+  80266c:	73 9a                	jae    802608 <__udivdi3+0x48>
+  80266e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802672:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802676:	83 c4 14             	add    $0x14,%esp
+  802679:	5b                   	pop    %ebx
+  80267a:	5e                   	pop    %esi
+  80267b:	5f                   	pop    %edi
+  80267c:	5d                   	pop    %ebp
+  80267d:	c3                   	ret
+  80267e:	66 90                	xchg   %ax,%ax
+
+00802680 <__umoddi3>:
+  802680:	57                   	push   %edi
+  802681:	56                   	push   %esi
+  802682:	53                   	push   %ebx
+  802683:	83 ec 08             	sub    $0x8,%esp
+  802686:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80268a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80268e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802692:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802696:	89 f9                	mov    %edi,%ecx
+  802698:	89 34 24             	mov    %esi,(%esp)
+  80269b:	09 f1                	or     %esi,%ecx
+  80269d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8026a1:	74 53                	je     8026f6 <__umoddi3+0x76>
+  8026a3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026af:	90                   	nop
+  8026b0:	89 c6                	mov    %eax,%esi
+  8026b2:	89 d7                	mov    %edx,%edi
+  8026b4:	31 db                	xor    %ebx,%ebx
+  8026b6:	d3 ef                	shr    %cl,%edi
+  8026b8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8026bb:	f6 c1 20             	test   $0x20,%cl
+  8026be:	0f 45 f7             	cmovne %edi,%esi
+  8026c1:	0f 45 fb             	cmovne %ebx,%edi
+  8026c4:	8b 1c 24             	mov    (%esp),%ebx
+  8026c7:	39 de                	cmp    %ebx,%esi
+  8026c9:	89 fb                	mov    %edi,%ebx
+  8026cb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8026cf:	8b 34 24             	mov    (%esp),%esi
+  8026d2:	19 fb                	sbb    %edi,%ebx
+  8026d4:	72 14                	jb     8026ea <__umoddi3+0x6a>
+  8026d6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8026d9:	31 db                	xor    %ebx,%ebx
+  8026db:	d3 e6                	shl    %cl,%esi
+  8026dd:	f6 c1 20             	test   $0x20,%cl
+  8026e0:	0f 45 fe             	cmovne %esi,%edi
+  8026e3:	0f 45 f3             	cmovne %ebx,%esi
+  8026e6:	29 f0                	sub    %esi,%eax
+  8026e8:	19 fa                	sbb    %edi,%edx
+  8026ea:	83 e9 01             	sub    $0x1,%ecx
+  8026ed:	73 c1                	jae    8026b0 <__umoddi3+0x30>
+  8026ef:	83 c4 08             	add    $0x8,%esp
+  8026f2:	5b                   	pop    %ebx
+  8026f3:	5e                   	pop    %esi
+  8026f4:	5f                   	pop    %edi
+  8026f5:	c3                   	ret
+  8026f6:	83 c4 08             	add    $0x8,%esp
+  8026f9:	31 c0                	xor    %eax,%eax
+  8026fb:	31 d2                	xor    %edx,%edx
+  8026fd:	5b                   	pop    %ebx
+  8026fe:	5e                   	pop    %esi
+  8026ff:	5f                   	pop    %edi
+  802700:	c3                   	ret
+  802701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80270f:	90                   	nop
+
+00802710 <__divdi3>:
+  802710:	55                   	push   %ebp
+  802711:	57                   	push   %edi
+  802712:	56                   	push   %esi
+  802713:	53                   	push   %ebx
+  802714:	83 ec 1c             	sub    $0x1c,%esp
+  802717:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80271b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80271f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802723:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802727:	85 ff                	test   %edi,%edi
+  802729:	0f 88 da 00 00 00    	js     802809 <__divdi3+0xf9>
+  80272f:	85 db                	test   %ebx,%ebx
+  802731:	78 16                	js     802749 <__divdi3+0x39>
+  802733:	89 dd                	mov    %ebx,%ebp
+  802735:	89 c8                	mov    %ecx,%eax
+  802737:	89 da                	mov    %ebx,%edx
+  802739:	09 cd                	or     %ecx,%ebp
+  80273b:	0f 85 fd 00 00 00    	jne    80283e <__divdi3+0x12e>
+  802741:	83 c4 1c             	add    $0x1c,%esp
+  802744:	5b                   	pop    %ebx
+  802745:	5e                   	pop    %esi
+  802746:	5f                   	pop    %edi
+  802747:	5d                   	pop    %ebp
+  802748:	c3                   	ret
+  802749:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80274e:	f7 d9                	neg    %ecx
+  802750:	89 f0                	mov    %esi,%eax
+  802752:	89 fa                	mov    %edi,%edx
+  802754:	83 d3 00             	adc    $0x0,%ebx
+  802757:	89 0c 24             	mov    %ecx,(%esp)
+  80275a:	f7 db                	neg    %ebx
+  80275c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802760:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802767:	00 
+  802768:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80276d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802774:	00 
+  802775:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802779:	89 cd                	mov    %ecx,%ebp
+  80277b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80277f:	90                   	nop
+  802780:	89 e9                	mov    %ebp,%ecx
+  802782:	89 c3                	mov    %eax,%ebx
+  802784:	89 d6                	mov    %edx,%esi
+  802786:	31 ff                	xor    %edi,%edi
+  802788:	d3 ee                	shr    %cl,%esi
+  80278a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80278d:	f6 c1 20             	test   $0x20,%cl
+  802790:	0f 45 de             	cmovne %esi,%ebx
+  802793:	0f 45 f7             	cmovne %edi,%esi
+  802796:	8b 3c 24             	mov    (%esp),%edi
+  802799:	39 fb                	cmp    %edi,%ebx
+  80279b:	89 f7                	mov    %esi,%edi
+  80279d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8027a1:	8b 1c 24             	mov    (%esp),%ebx
+  8027a4:	19 f7                	sbb    %esi,%edi
+  8027a6:	72 39                	jb     8027e1 <__divdi3+0xd1>
+  8027a8:	89 e9                	mov    %ebp,%ecx
+  8027aa:	89 f7                	mov    %esi,%edi
+  8027ac:	89 de                	mov    %ebx,%esi
+  8027ae:	0f a5 df             	shld   %cl,%ebx,%edi
+  8027b1:	d3 e6                	shl    %cl,%esi
+  8027b3:	31 db                	xor    %ebx,%ebx
+  8027b5:	f6 c1 20             	test   $0x20,%cl
+  8027b8:	0f 45 fe             	cmovne %esi,%edi
+  8027bb:	0f 45 f3             	cmovne %ebx,%esi
+  8027be:	29 f0                	sub    %esi,%eax
+  8027c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8027c5:	19 fa                	sbb    %edi,%edx
+  8027c7:	31 ff                	xor    %edi,%edi
+  8027c9:	31 db                	xor    %ebx,%ebx
+  8027cb:	0f a5 f7             	shld   %cl,%esi,%edi
+  8027ce:	d3 e6                	shl    %cl,%esi
+  8027d0:	f6 c1 20             	test   $0x20,%cl
+  8027d3:	0f 45 fe             	cmovne %esi,%edi
+  8027d6:	0f 45 f3             	cmovne %ebx,%esi
+  8027d9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8027dd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8027e1:	83 ed 01             	sub    $0x1,%ebp
+  8027e4:	73 9a                	jae    802780 <__divdi3+0x70>
+  8027e6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8027ea:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027ee:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027f2:	85 ed                	test   %ebp,%ebp
+  8027f4:	0f 84 47 ff ff ff    	je     802741 <__divdi3+0x31>
+  8027fa:	f7 d8                	neg    %eax
+  8027fc:	83 d2 00             	adc    $0x0,%edx
+  8027ff:	83 c4 1c             	add    $0x1c,%esp
+  802802:	5b                   	pop    %ebx
+  802803:	f7 da                	neg    %edx
+  802805:	5e                   	pop    %esi
+  802806:	5f                   	pop    %edi
+  802807:	5d                   	pop    %ebp
+  802808:	c3                   	ret
+  802809:	f7 de                	neg    %esi
+  80280b:	83 d7 00             	adc    $0x0,%edi
+  80280e:	f7 df                	neg    %edi
+  802810:	85 db                	test   %ebx,%ebx
+  802812:	78 23                	js     802837 <__divdi3+0x127>
+  802814:	89 dd                	mov    %ebx,%ebp
+  802816:	89 c8                	mov    %ecx,%eax
+  802818:	89 da                	mov    %ebx,%edx
+  80281a:	09 cd                	or     %ecx,%ebp
+  80281c:	0f 84 1f ff ff ff    	je     802741 <__divdi3+0x31>
+  802822:	89 0c 24             	mov    %ecx,(%esp)
+  802825:	89 f0                	mov    %esi,%eax
+  802827:	89 fa                	mov    %edi,%edx
+  802829:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80282e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802832:	e9 29 ff ff ff       	jmp    802760 <__divdi3+0x50>
+  802837:	31 ed                	xor    %ebp,%ebp
+  802839:	e9 10 ff ff ff       	jmp    80274e <__divdi3+0x3e>
+  80283e:	89 0c 24             	mov    %ecx,(%esp)
+  802841:	89 f0                	mov    %esi,%eax
+  802843:	89 fa                	mov    %edi,%edx
+  802845:	31 ed                	xor    %ebp,%ebp
+  802847:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80284b:	e9 10 ff ff ff       	jmp    802760 <__divdi3+0x50>
+
+00802850 <__moddi3>:
+  802850:	55                   	push   %ebp
+  802851:	57                   	push   %edi
+  802852:	56                   	push   %esi
+  802853:	53                   	push   %ebx
+  802854:	83 ec 14             	sub    $0x14,%esp
+  802857:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80285b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80285f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802863:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802867:	85 d2                	test   %edx,%edx
+  802869:	0f 88 9b 00 00 00    	js     80290a <__moddi3+0xba>
+  80286f:	89 f7                	mov    %esi,%edi
+  802871:	31 ed                	xor    %ebp,%ebp
+  802873:	09 cf                	or     %ecx,%edi
+  802875:	0f 84 83 00 00 00    	je     8028fe <__moddi3+0xae>
+  80287b:	89 cb                	mov    %ecx,%ebx
+  80287d:	89 f7                	mov    %esi,%edi
+  80287f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802883:	f7 db                	neg    %ebx
+  802885:	83 d7 00             	adc    $0x0,%edi
+  802888:	f7 df                	neg    %edi
+  80288a:	0f 49 f7             	cmovns %edi,%esi
+  80288d:	0f 49 cb             	cmovns %ebx,%ecx
+  802890:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802894:	89 0c 24             	mov    %ecx,(%esp)
+  802897:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80289c:	89 cd                	mov    %ecx,%ebp
+  80289e:	66 90                	xchg   %ax,%ax
+  8028a0:	89 e9                	mov    %ebp,%ecx
+  8028a2:	89 c3                	mov    %eax,%ebx
+  8028a4:	89 d6                	mov    %edx,%esi
+  8028a6:	31 ff                	xor    %edi,%edi
+  8028a8:	d3 ee                	shr    %cl,%esi
+  8028aa:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8028ad:	f6 c1 20             	test   $0x20,%cl
+  8028b0:	0f 45 de             	cmovne %esi,%ebx
+  8028b3:	0f 45 f7             	cmovne %edi,%esi
+  8028b6:	8b 3c 24             	mov    (%esp),%edi
+  8028b9:	39 fb                	cmp    %edi,%ebx
+  8028bb:	89 f7                	mov    %esi,%edi
+  8028bd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8028c1:	8b 1c 24             	mov    (%esp),%ebx
+  8028c4:	19 f7                	sbb    %esi,%edi
+  8028c6:	72 1a                	jb     8028e2 <__moddi3+0x92>
+  8028c8:	89 e9                	mov    %ebp,%ecx
+  8028ca:	89 f7                	mov    %esi,%edi
+  8028cc:	89 de                	mov    %ebx,%esi
+  8028ce:	0f a5 df             	shld   %cl,%ebx,%edi
+  8028d1:	d3 e6                	shl    %cl,%esi
+  8028d3:	31 db                	xor    %ebx,%ebx
+  8028d5:	f6 c1 20             	test   $0x20,%cl
+  8028d8:	0f 45 fe             	cmovne %esi,%edi
+  8028db:	0f 45 f3             	cmovne %ebx,%esi
+  8028de:	29 f0                	sub    %esi,%eax
+  8028e0:	19 fa                	sbb    %edi,%edx
+  8028e2:	83 ed 01             	sub    $0x1,%ebp
+  8028e5:	73 b9                	jae    8028a0 <__moddi3+0x50>
+  8028e7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  8028eb:	85 ed                	test   %ebp,%ebp
+  8028ed:	74 07                	je     8028f6 <__moddi3+0xa6>
+  8028ef:	f7 d8                	neg    %eax
+  8028f1:	83 d2 00             	adc    $0x0,%edx
+  8028f4:	f7 da                	neg    %edx
+  8028f6:	83 c4 14             	add    $0x14,%esp
+  8028f9:	5b                   	pop    %ebx
+  8028fa:	5e                   	pop    %esi
+  8028fb:	5f                   	pop    %edi
+  8028fc:	5d                   	pop    %ebp
+  8028fd:	c3                   	ret
+  8028fe:	83 c4 14             	add    $0x14,%esp
+  802901:	31 c0                	xor    %eax,%eax
+  802903:	31 d2                	xor    %edx,%edx
+  802905:	5b                   	pop    %ebx
+  802906:	5e                   	pop    %esi
+  802907:	5f                   	pop    %edi
+  802908:	5d                   	pop    %ebp
+  802909:	c3                   	ret
+  80290a:	89 f7                	mov    %esi,%edi
+  80290c:	09 cf                	or     %ecx,%edi
+  80290e:	74 11                	je     802921 <__moddi3+0xd1>
+  802910:	f7 d8                	neg    %eax
+  802912:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802917:	83 d2 00             	adc    $0x0,%edx
+  80291a:	f7 da                	neg    %edx
+  80291c:	e9 5a ff ff ff       	jmp    80287b <__moddi3+0x2b>
+  802921:	31 c0                	xor    %eax,%eax
+  802923:	31 d2                	xor    %edx,%edx
+  802925:	eb c8                	jmp    8028ef <__moddi3+0x9f>
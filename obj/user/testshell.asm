@@ -0,0 +1,7053 @@
+
+obj/user/testshell.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 54 04 00 00       	call   800485 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <wrong>:
+	breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  80003f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800042:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800045:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char buf[100];
+	int n;
+
+	seek(rfd, off);
+  800048:	53                   	push   %ebx
+  800049:	56                   	push   %esi
+  80004a:	e8 86 1b 00 00       	call   801bd5 <seek>
+	seek(kfd, off);
+  80004f:	83 c4 08             	add    $0x8,%esp
+  800052:	53                   	push   %ebx
+  800053:	57                   	push   %edi
+  800054:	e8 7c 1b 00 00       	call   801bd5 <seek>
+
+	cprintf("shell produced incorrect output.\n");
+  800059:	c7 04 24 20 34 80 00 	movl   $0x803420,(%esp)
+  800060:	e8 5b 05 00 00       	call   8005c0 <cprintf>
+	cprintf("expected:\n===\n");
+  800065:	c7 04 24 8b 34 80 00 	movl   $0x80348b,(%esp)
+  80006c:	e8 4f 05 00 00       	call   8005c0 <cprintf>
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800071:	83 c4 10             	add    $0x10,%esp
+  800074:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  800077:	eb 0d                	jmp    800086 <wrong+0x53>
+		sys_cputs(buf, n);
+  800079:	83 ec 08             	sub    $0x8,%esp
+  80007c:	50                   	push   %eax
+  80007d:	53                   	push   %ebx
+  80007e:	e8 5b 0e 00 00       	call   800ede <sys_cputs>
+  800083:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800086:	83 ec 04             	sub    $0x4,%esp
+  800089:	6a 63                	push   $0x63
+  80008b:	53                   	push   %ebx
+  80008c:	57                   	push   %edi
+  80008d:	e8 f3 19 00 00       	call   801a85 <read>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	85 c0                	test   %eax,%eax
+  800097:	7f e0                	jg     800079 <wrong+0x46>
+	cprintf("===\ngot:\n===\n");
+  800099:	83 ec 0c             	sub    $0xc,%esp
+  80009c:	68 9a 34 80 00       	push   $0x80349a
+  8000a1:	e8 1a 05 00 00       	call   8005c0 <cprintf>
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  8000ac:	eb 0d                	jmp    8000bb <wrong+0x88>
+		sys_cputs(buf, n);
+  8000ae:	83 ec 08             	sub    $0x8,%esp
+  8000b1:	50                   	push   %eax
+  8000b2:	53                   	push   %ebx
+  8000b3:	e8 26 0e 00 00       	call   800ede <sys_cputs>
+  8000b8:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	6a 63                	push   $0x63
+  8000c0:	53                   	push   %ebx
+  8000c1:	56                   	push   %esi
+  8000c2:	e8 be 19 00 00       	call   801a85 <read>
+  8000c7:	83 c4 10             	add    $0x10,%esp
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f e0                	jg     8000ae <wrong+0x7b>
+	cprintf("===\n");
+  8000ce:	83 ec 0c             	sub    $0xc,%esp
+  8000d1:	68 95 34 80 00       	push   $0x803495
+  8000d6:	e8 e5 04 00 00       	call   8005c0 <cprintf>
+	exit();
+  8000db:	e8 eb 03 00 00       	call   8004cb <exit>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+
+008000eb <umain>:
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 38             	sub    $0x38,%esp
+	close(0);
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	e8 4e 18 00 00       	call   801949 <close>
+	close(1);
+  8000fb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800102:	e8 42 18 00 00       	call   801949 <close>
+	opencons();
+  800107:	e8 27 03 00 00       	call   800433 <opencons>
+	opencons();
+  80010c:	e8 22 03 00 00       	call   800433 <opencons>
+	if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800111:	83 c4 08             	add    $0x8,%esp
+  800114:	6a 00                	push   $0x0
+  800116:	68 a8 34 80 00       	push   $0x8034a8
+  80011b:	e8 c8 1d 00 00       	call   801ee8 <open>
+  800120:	89 c3                	mov    %eax,%ebx
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 e7 00 00 00    	js     800214 <umain+0x129>
+	if ((wfd = pipe(pfds)) < 0)
+  80012d:	83 ec 0c             	sub    $0xc,%esp
+  800130:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800133:	50                   	push   %eax
+  800134:	e8 29 2b 00 00       	call   802c62 <pipe>
+  800139:	83 c4 10             	add    $0x10,%esp
+  80013c:	85 c0                	test   %eax,%eax
+  80013e:	0f 88 e2 00 00 00    	js     800226 <umain+0x13b>
+	wfd = pfds[1];
+  800144:	8b 75 e0             	mov    -0x20(%ebp),%esi
+	cprintf("running sh -x < testshell.sh | cat\n");
+  800147:	83 ec 0c             	sub    $0xc,%esp
+  80014a:	68 44 34 80 00       	push   $0x803444
+  80014f:	e8 6c 04 00 00       	call   8005c0 <cprintf>
+	if ((r = fork()) < 0)
+  800154:	e8 c2 13 00 00       	call   80151b <fork>
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	85 c0                	test   %eax,%eax
+  80015e:	0f 88 d4 00 00 00    	js     800238 <umain+0x14d>
+	if (r == 0) {
+  800164:	75 6f                	jne    8001d5 <umain+0xea>
+		dup(rfd, 0);
+  800166:	83 ec 08             	sub    $0x8,%esp
+  800169:	6a 00                	push   $0x0
+  80016b:	53                   	push   %ebx
+  80016c:	e8 2a 18 00 00       	call   80199b <dup>
+		dup(wfd, 1);
+  800171:	83 c4 08             	add    $0x8,%esp
+  800174:	6a 01                	push   $0x1
+  800176:	56                   	push   %esi
+  800177:	e8 1f 18 00 00       	call   80199b <dup>
+		close(rfd);
+  80017c:	89 1c 24             	mov    %ebx,(%esp)
+  80017f:	e8 c5 17 00 00       	call   801949 <close>
+		close(wfd);
+  800184:	89 34 24             	mov    %esi,(%esp)
+  800187:	e8 bd 17 00 00       	call   801949 <close>
+		if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  80018c:	6a 00                	push   $0x0
+  80018e:	68 e5 34 80 00       	push   $0x8034e5
+  800193:	68 b2 34 80 00       	push   $0x8034b2
+  800198:	68 e8 34 80 00       	push   $0x8034e8
+  80019d:	e8 17 24 00 00       	call   8025b9 <spawnl>
+  8001a2:	89 c7                	mov    %eax,%edi
+  8001a4:	83 c4 20             	add    $0x20,%esp
+  8001a7:	85 c0                	test   %eax,%eax
+  8001a9:	0f 88 9b 00 00 00    	js     80024a <umain+0x15f>
+		close(0);
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	6a 00                	push   $0x0
+  8001b4:	e8 90 17 00 00       	call   801949 <close>
+		close(1);
+  8001b9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8001c0:	e8 84 17 00 00       	call   801949 <close>
+		wait(r);
+  8001c5:	89 3c 24             	mov    %edi,(%esp)
+  8001c8:	e8 12 2c 00 00       	call   802ddf <wait>
+		exit();
+  8001cd:	e8 f9 02 00 00       	call   8004cb <exit>
+  8001d2:	83 c4 10             	add    $0x10,%esp
+	close(rfd);
+  8001d5:	83 ec 0c             	sub    $0xc,%esp
+  8001d8:	53                   	push   %ebx
+  8001d9:	e8 6b 17 00 00       	call   801949 <close>
+	close(wfd);
+  8001de:	89 34 24             	mov    %esi,(%esp)
+  8001e1:	e8 63 17 00 00       	call   801949 <close>
+	rfd = pfds[0];
+  8001e6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8001e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	6a 00                	push   $0x0
+  8001f1:	68 f6 34 80 00       	push   $0x8034f6
+  8001f6:	e8 ed 1c 00 00       	call   801ee8 <open>
+  8001fb:	83 c4 10             	add    $0x10,%esp
+  8001fe:	85 c0                	test   %eax,%eax
+  800200:	78 5a                	js     80025c <umain+0x171>
+  800202:	be 01 00 00 00       	mov    $0x1,%esi
+	nloff = 0;
+  800207:	bf 00 00 00 00       	mov    $0x0,%edi
+		n2 = read(kfd, &c2, 1);
+  80020c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80020f:	e9 9a 00 00 00       	jmp    8002ae <umain+0x1c3>
+		panic("open testshell.sh: %e", rfd);
+  800214:	50                   	push   %eax
+  800215:	68 b5 34 80 00       	push   $0x8034b5
+  80021a:	6a 13                	push   $0x13
+  80021c:	68 cb 34 80 00       	push   $0x8034cb
+  800221:	e8 bf 02 00 00       	call   8004e5 <_panic>
+		panic("pipe: %e", wfd);
+  800226:	50                   	push   %eax
+  800227:	68 dc 34 80 00       	push   $0x8034dc
+  80022c:	6a 15                	push   $0x15
+  80022e:	68 cb 34 80 00       	push   $0x8034cb
+  800233:	e8 ad 02 00 00       	call   8004e5 <_panic>
+		panic("fork: %e", r);
+  800238:	50                   	push   %eax
+  800239:	68 04 39 80 00       	push   $0x803904
+  80023e:	6a 1a                	push   $0x1a
+  800240:	68 cb 34 80 00       	push   $0x8034cb
+  800245:	e8 9b 02 00 00       	call   8004e5 <_panic>
+			panic("spawn: %e", r);
+  80024a:	50                   	push   %eax
+  80024b:	68 ec 34 80 00       	push   $0x8034ec
+  800250:	6a 21                	push   $0x21
+  800252:	68 cb 34 80 00       	push   $0x8034cb
+  800257:	e8 89 02 00 00       	call   8004e5 <_panic>
+		panic("open testshell.key for reading: %e", kfd);
+  80025c:	50                   	push   %eax
+  80025d:	68 68 34 80 00       	push   $0x803468
+  800262:	6a 2c                	push   $0x2c
+  800264:	68 cb 34 80 00       	push   $0x8034cb
+  800269:	e8 77 02 00 00       	call   8004e5 <_panic>
+			panic("reading testshell.out: %e", n1);
+  80026e:	53                   	push   %ebx
+  80026f:	68 04 35 80 00       	push   $0x803504
+  800274:	6a 33                	push   $0x33
+  800276:	68 cb 34 80 00       	push   $0x8034cb
+  80027b:	e8 65 02 00 00       	call   8004e5 <_panic>
+			panic("reading testshell.key: %e", n2);
+  800280:	50                   	push   %eax
+  800281:	68 1e 35 80 00       	push   $0x80351e
+  800286:	6a 35                	push   $0x35
+  800288:	68 cb 34 80 00       	push   $0x8034cb
+  80028d:	e8 53 02 00 00       	call   8004e5 <_panic>
+			wrong(rfd, kfd, nloff);
+  800292:	83 ec 04             	sub    $0x4,%esp
+  800295:	57                   	push   %edi
+  800296:	ff 75 d0             	push   -0x30(%ebp)
+  800299:	ff 75 d4             	push   -0x2c(%ebp)
+  80029c:	e8 92 fd ff ff       	call   800033 <wrong>
+  8002a1:	83 c4 10             	add    $0x10,%esp
+			nloff = off+1;
+  8002a4:	80 7d e7 0a          	cmpb   $0xa,-0x19(%ebp)
+  8002a8:	0f 44 fe             	cmove  %esi,%edi
+	for (off=0;; off++) {
+  8002ab:	83 c6 01             	add    $0x1,%esi
+		n1 = read(rfd, &c1, 1);
+  8002ae:	83 ec 04             	sub    $0x4,%esp
+  8002b1:	6a 01                	push   $0x1
+  8002b3:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  8002b6:	50                   	push   %eax
+  8002b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8002ba:	e8 c6 17 00 00       	call   801a85 <read>
+  8002bf:	89 c3                	mov    %eax,%ebx
+		n2 = read(kfd, &c2, 1);
+  8002c1:	83 c4 0c             	add    $0xc,%esp
+  8002c4:	6a 01                	push   $0x1
+  8002c6:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	ff 75 d0             	push   -0x30(%ebp)
+  8002cd:	e8 b3 17 00 00       	call   801a85 <read>
+		if (n1 < 0)
+  8002d2:	83 c4 10             	add    $0x10,%esp
+  8002d5:	85 db                	test   %ebx,%ebx
+  8002d7:	78 95                	js     80026e <umain+0x183>
+		if (n2 < 0)
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	78 a3                	js     800280 <umain+0x195>
+		if (n1 == 0 && n2 == 0)
+  8002dd:	89 d9                	mov    %ebx,%ecx
+  8002df:	09 c1                	or     %eax,%ecx
+  8002e1:	74 15                	je     8002f8 <umain+0x20d>
+		if (n1 != 1 || n2 != 1 || c1 != c2)
+  8002e3:	83 fb 01             	cmp    $0x1,%ebx
+  8002e6:	75 aa                	jne    800292 <umain+0x1a7>
+  8002e8:	83 f8 01             	cmp    $0x1,%eax
+  8002eb:	75 a5                	jne    800292 <umain+0x1a7>
+  8002ed:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  8002f1:	38 45 e7             	cmp    %al,-0x19(%ebp)
+  8002f4:	75 9c                	jne    800292 <umain+0x1a7>
+  8002f6:	eb ac                	jmp    8002a4 <umain+0x1b9>
+	cprintf("shell ran correctly\n");
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+  8002fb:	68 38 35 80 00       	push   $0x803538
+  800300:	e8 bb 02 00 00       	call   8005c0 <cprintf>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  800305:	cc                   	int3
+}
+  800306:	83 c4 10             	add    $0x10,%esp
+  800309:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030c:	5b                   	pop    %ebx
+  80030d:	5e                   	pop    %esi
+  80030e:	5f                   	pop    %edi
+  80030f:	5d                   	pop    %ebp
+  800310:	c3                   	ret
+
+00800311 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	c3                   	ret
+
+00800317 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80031d:	68 4d 35 80 00       	push   $0x80354d
+  800322:	ff 75 0c             	push   0xc(%ebp)
+  800325:	e8 84 08 00 00       	call   800bae <strcpy>
+	return 0;
+}
+  80032a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032f:	c9                   	leave
+  800330:	c3                   	ret
+
+00800331 <devcons_write>:
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	57                   	push   %edi
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80033d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800342:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800348:	eb 2e                	jmp    800378 <devcons_write+0x47>
+		m = n - tot;
+  80034a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80034d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80034f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  800354:	39 c3                	cmp    %eax,%ebx
+  800356:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800359:	83 ec 04             	sub    $0x4,%esp
+  80035c:	53                   	push   %ebx
+  80035d:	89 f0                	mov    %esi,%eax
+  80035f:	03 45 0c             	add    0xc(%ebp),%eax
+  800362:	50                   	push   %eax
+  800363:	57                   	push   %edi
+  800364:	e8 cb 09 00 00       	call   800d34 <memmove>
+		sys_cputs(buf, m);
+  800369:	83 c4 08             	add    $0x8,%esp
+  80036c:	53                   	push   %ebx
+  80036d:	57                   	push   %edi
+  80036e:	e8 6b 0b 00 00       	call   800ede <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800373:	01 de                	add    %ebx,%esi
+  800375:	83 c4 10             	add    $0x10,%esp
+  800378:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80037b:	72 cd                	jb     80034a <devcons_write+0x19>
+}
+  80037d:	89 f0                	mov    %esi,%eax
+  80037f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800382:	5b                   	pop    %ebx
+  800383:	5e                   	pop    %esi
+  800384:	5f                   	pop    %edi
+  800385:	5d                   	pop    %ebp
+  800386:	c3                   	ret
+
+00800387 <devcons_read>:
+{
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800396:	75 07                	jne    80039f <devcons_read+0x18>
+  800398:	eb 1f                	jmp    8003b9 <devcons_read+0x32>
+		sys_yield();
+  80039a:	e8 fc 0b 00 00       	call   800f9b <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80039f:	e8 58 0b 00 00       	call   800efc <sys_cgetc>
+  8003a4:	85 c0                	test   %eax,%eax
+  8003a6:	74 f2                	je     80039a <devcons_read+0x13>
+	if (c < 0)
+  8003a8:	78 0f                	js     8003b9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8003aa:	83 f8 04             	cmp    $0x4,%eax
+  8003ad:	74 0c                	je     8003bb <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8003af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003b2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8003b4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8003b9:	c9                   	leave
+  8003ba:	c3                   	ret
+		return 0;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c0:	eb f7                	jmp    8003b9 <devcons_read+0x32>
+
+008003c2 <cputchar>:
+{
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8003c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003cb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8003ce:	6a 01                	push   $0x1
+  8003d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003d3:	50                   	push   %eax
+  8003d4:	e8 05 0b 00 00       	call   800ede <sys_cputs>
+}
+  8003d9:	83 c4 10             	add    $0x10,%esp
+  8003dc:	c9                   	leave
+  8003dd:	c3                   	ret
+
+008003de <getchar>:
+{
+  8003de:	55                   	push   %ebp
+  8003df:	89 e5                	mov    %esp,%ebp
+  8003e1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8003e4:	6a 01                	push   $0x1
+  8003e6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003e9:	50                   	push   %eax
+  8003ea:	6a 00                	push   $0x0
+  8003ec:	e8 94 16 00 00       	call   801a85 <read>
+	if (r < 0)
+  8003f1:	83 c4 10             	add    $0x10,%esp
+  8003f4:	85 c0                	test   %eax,%eax
+  8003f6:	78 06                	js     8003fe <getchar+0x20>
+	if (r < 1)
+  8003f8:	74 06                	je     800400 <getchar+0x22>
+	return c;
+  8003fa:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+		return -E_EOF;
+  800400:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800405:	eb f7                	jmp    8003fe <getchar+0x20>
+
+00800407 <iscons>:
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80040d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800410:	50                   	push   %eax
+  800411:	ff 75 08             	push   0x8(%ebp)
+  800414:	e8 06 14 00 00       	call   80181f <fd_lookup>
+  800419:	83 c4 10             	add    $0x10,%esp
+  80041c:	85 c0                	test   %eax,%eax
+  80041e:	78 11                	js     800431 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  800420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800423:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  800429:	39 10                	cmp    %edx,(%eax)
+  80042b:	0f 94 c0             	sete   %al
+  80042e:	0f b6 c0             	movzbl %al,%eax
+}
+  800431:	c9                   	leave
+  800432:	c3                   	ret
+
+00800433 <opencons>:
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800439:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80043c:	50                   	push   %eax
+  80043d:	e8 87 13 00 00       	call   8017c9 <fd_alloc>
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	85 c0                	test   %eax,%eax
+  800447:	78 3a                	js     800483 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800449:	83 ec 04             	sub    $0x4,%esp
+  80044c:	68 07 04 00 00       	push   $0x407
+  800451:	ff 75 f4             	push   -0xc(%ebp)
+  800454:	6a 00                	push   $0x0
+  800456:	e8 c0 0b 00 00       	call   80101b <sys_page_alloc>
+  80045b:	83 c4 10             	add    $0x10,%esp
+  80045e:	85 c0                	test   %eax,%eax
+  800460:	78 21                	js     800483 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800462:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800465:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  80046b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80046d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800470:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800477:	83 ec 0c             	sub    $0xc,%esp
+  80047a:	50                   	push   %eax
+  80047b:	e8 22 13 00 00       	call   8017a2 <fd2num>
+  800480:	83 c4 10             	add    $0x10,%esp
+}
+  800483:	c9                   	leave
+  800484:	c3                   	ret
+
+00800485 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800485:	55                   	push   %ebp
+  800486:	89 e5                	mov    %esp,%ebp
+  800488:	56                   	push   %esi
+  800489:	53                   	push   %ebx
+  80048a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80048d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800490:	e8 e7 0a 00 00       	call   800f7c <sys_getenvid>
+  800495:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80049a:	c1 e0 09             	shl    $0x9,%eax
+  80049d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004a2:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004a7:	85 db                	test   %ebx,%ebx
+  8004a9:	7e 07                	jle    8004b2 <libmain+0x2d>
+		binaryname = argv[0];
+  8004ab:	8b 06                	mov    (%esi),%eax
+  8004ad:	a3 1c 40 80 00       	mov    %eax,0x80401c
+
+	// call user main routine
+	umain(argc, argv);
+  8004b2:	83 ec 08             	sub    $0x8,%esp
+  8004b5:	56                   	push   %esi
+  8004b6:	53                   	push   %ebx
+  8004b7:	e8 2f fc ff ff       	call   8000eb <umain>
+
+	// exit gracefully
+	exit();
+  8004bc:	e8 0a 00 00 00       	call   8004cb <exit>
+}
+  8004c1:	83 c4 10             	add    $0x10,%esp
+  8004c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8004c7:	5b                   	pop    %ebx
+  8004c8:	5e                   	pop    %esi
+  8004c9:	5d                   	pop    %ebp
+  8004ca:	c3                   	ret
+
+008004cb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8004cb:	55                   	push   %ebp
+  8004cc:	89 e5                	mov    %esp,%ebp
+  8004ce:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8004d1:	e8 a0 14 00 00       	call   801976 <close_all>
+	sys_env_destroy(0);
+  8004d6:	83 ec 0c             	sub    $0xc,%esp
+  8004d9:	6a 00                	push   $0x0
+  8004db:	e8 5b 0a 00 00       	call   800f3b <sys_env_destroy>
+}
+  8004e0:	83 c4 10             	add    $0x10,%esp
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+008004e5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004e5:	55                   	push   %ebp
+  8004e6:	89 e5                	mov    %esp,%ebp
+  8004e8:	56                   	push   %esi
+  8004e9:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8004ea:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004ed:	8b 35 1c 40 80 00    	mov    0x80401c,%esi
+  8004f3:	e8 84 0a 00 00       	call   800f7c <sys_getenvid>
+  8004f8:	83 ec 0c             	sub    $0xc,%esp
+  8004fb:	ff 75 0c             	push   0xc(%ebp)
+  8004fe:	ff 75 08             	push   0x8(%ebp)
+  800501:	56                   	push   %esi
+  800502:	50                   	push   %eax
+  800503:	68 64 35 80 00       	push   $0x803564
+  800508:	e8 b3 00 00 00       	call   8005c0 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80050d:	83 c4 18             	add    $0x18,%esp
+  800510:	53                   	push   %ebx
+  800511:	ff 75 10             	push   0x10(%ebp)
+  800514:	e8 56 00 00 00       	call   80056f <vcprintf>
+	cprintf("\n");
+  800519:	c7 04 24 98 34 80 00 	movl   $0x803498,(%esp)
+  800520:	e8 9b 00 00 00       	call   8005c0 <cprintf>
+  800525:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800528:	cc                   	int3
+	while (1)
+  800529:	eb fd                	jmp    800528 <_panic+0x43>
+
+0080052b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80052b:	55                   	push   %ebp
+  80052c:	89 e5                	mov    %esp,%ebp
+  80052e:	53                   	push   %ebx
+  80052f:	83 ec 04             	sub    $0x4,%esp
+  800532:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800535:	8b 13                	mov    (%ebx),%edx
+  800537:	8d 42 01             	lea    0x1(%edx),%eax
+  80053a:	89 03                	mov    %eax,(%ebx)
+  80053c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80053f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800543:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800548:	74 09                	je     800553 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80054a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80054e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800551:	c9                   	leave
+  800552:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800553:	83 ec 08             	sub    $0x8,%esp
+  800556:	68 ff 00 00 00       	push   $0xff
+  80055b:	8d 43 08             	lea    0x8(%ebx),%eax
+  80055e:	50                   	push   %eax
+  80055f:	e8 7a 09 00 00       	call   800ede <sys_cputs>
+		b->idx = 0;
+  800564:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	eb db                	jmp    80054a <putch+0x1f>
+
+0080056f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80056f:	55                   	push   %ebp
+  800570:	89 e5                	mov    %esp,%ebp
+  800572:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800578:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80057f:	00 00 00 
+	b.cnt = 0;
+  800582:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800589:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80058c:	ff 75 0c             	push   0xc(%ebp)
+  80058f:	ff 75 08             	push   0x8(%ebp)
+  800592:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800598:	50                   	push   %eax
+  800599:	68 2b 05 80 00       	push   $0x80052b
+  80059e:	e8 14 01 00 00       	call   8006b7 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005a3:	83 c4 08             	add    $0x8,%esp
+  8005a6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005ac:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005b2:	50                   	push   %eax
+  8005b3:	e8 26 09 00 00       	call   800ede <sys_cputs>
+
+	return b.cnt;
+}
+  8005b8:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005be:	c9                   	leave
+  8005bf:	c3                   	ret
+
+008005c0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005c0:	55                   	push   %ebp
+  8005c1:	89 e5                	mov    %esp,%ebp
+  8005c3:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005c6:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005c9:	50                   	push   %eax
+  8005ca:	ff 75 08             	push   0x8(%ebp)
+  8005cd:	e8 9d ff ff ff       	call   80056f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005d2:	c9                   	leave
+  8005d3:	c3                   	ret
+
+008005d4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005d4:	55                   	push   %ebp
+  8005d5:	89 e5                	mov    %esp,%ebp
+  8005d7:	57                   	push   %edi
+  8005d8:	56                   	push   %esi
+  8005d9:	53                   	push   %ebx
+  8005da:	83 ec 1c             	sub    $0x1c,%esp
+  8005dd:	89 c7                	mov    %eax,%edi
+  8005df:	89 d6                	mov    %edx,%esi
+  8005e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005e7:	89 d1                	mov    %edx,%ecx
+  8005e9:	89 c2                	mov    %eax,%edx
+  8005eb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ee:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005f1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005f4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005fa:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800601:	39 c2                	cmp    %eax,%edx
+  800603:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800606:	72 3e                	jb     800646 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800608:	83 ec 0c             	sub    $0xc,%esp
+  80060b:	ff 75 18             	push   0x18(%ebp)
+  80060e:	83 eb 01             	sub    $0x1,%ebx
+  800611:	53                   	push   %ebx
+  800612:	50                   	push   %eax
+  800613:	83 ec 08             	sub    $0x8,%esp
+  800616:	ff 75 e4             	push   -0x1c(%ebp)
+  800619:	ff 75 e0             	push   -0x20(%ebp)
+  80061c:	ff 75 dc             	push   -0x24(%ebp)
+  80061f:	ff 75 d8             	push   -0x28(%ebp)
+  800622:	e8 89 2a 00 00       	call   8030b0 <__udivdi3>
+  800627:	83 c4 18             	add    $0x18,%esp
+  80062a:	52                   	push   %edx
+  80062b:	50                   	push   %eax
+  80062c:	89 f2                	mov    %esi,%edx
+  80062e:	89 f8                	mov    %edi,%eax
+  800630:	e8 9f ff ff ff       	call   8005d4 <printnum>
+  800635:	83 c4 20             	add    $0x20,%esp
+  800638:	eb 13                	jmp    80064d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80063a:	83 ec 08             	sub    $0x8,%esp
+  80063d:	56                   	push   %esi
+  80063e:	ff 75 18             	push   0x18(%ebp)
+  800641:	ff d7                	call   *%edi
+  800643:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800646:	83 eb 01             	sub    $0x1,%ebx
+  800649:	85 db                	test   %ebx,%ebx
+  80064b:	7f ed                	jg     80063a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80064d:	83 ec 08             	sub    $0x8,%esp
+  800650:	56                   	push   %esi
+  800651:	83 ec 04             	sub    $0x4,%esp
+  800654:	ff 75 e4             	push   -0x1c(%ebp)
+  800657:	ff 75 e0             	push   -0x20(%ebp)
+  80065a:	ff 75 dc             	push   -0x24(%ebp)
+  80065d:	ff 75 d8             	push   -0x28(%ebp)
+  800660:	e8 0b 2b 00 00       	call   803170 <__umoddi3>
+  800665:	83 c4 14             	add    $0x14,%esp
+  800668:	0f be 80 87 35 80 00 	movsbl 0x803587(%eax),%eax
+  80066f:	50                   	push   %eax
+  800670:	ff d7                	call   *%edi
+}
+  800672:	83 c4 10             	add    $0x10,%esp
+  800675:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800678:	5b                   	pop    %ebx
+  800679:	5e                   	pop    %esi
+  80067a:	5f                   	pop    %edi
+  80067b:	5d                   	pop    %ebp
+  80067c:	c3                   	ret
+
+0080067d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80067d:	55                   	push   %ebp
+  80067e:	89 e5                	mov    %esp,%ebp
+  800680:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800683:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800687:	8b 10                	mov    (%eax),%edx
+  800689:	3b 50 04             	cmp    0x4(%eax),%edx
+  80068c:	73 0a                	jae    800698 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80068e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800691:	89 08                	mov    %ecx,(%eax)
+  800693:	8b 45 08             	mov    0x8(%ebp),%eax
+  800696:	88 02                	mov    %al,(%edx)
+}
+  800698:	5d                   	pop    %ebp
+  800699:	c3                   	ret
+
+0080069a <printfmt>:
+{
+  80069a:	55                   	push   %ebp
+  80069b:	89 e5                	mov    %esp,%ebp
+  80069d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006a0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006a3:	50                   	push   %eax
+  8006a4:	ff 75 10             	push   0x10(%ebp)
+  8006a7:	ff 75 0c             	push   0xc(%ebp)
+  8006aa:	ff 75 08             	push   0x8(%ebp)
+  8006ad:	e8 05 00 00 00       	call   8006b7 <vprintfmt>
+}
+  8006b2:	83 c4 10             	add    $0x10,%esp
+  8006b5:	c9                   	leave
+  8006b6:	c3                   	ret
+
+008006b7 <vprintfmt>:
+{
+  8006b7:	55                   	push   %ebp
+  8006b8:	89 e5                	mov    %esp,%ebp
+  8006ba:	57                   	push   %edi
+  8006bb:	56                   	push   %esi
+  8006bc:	53                   	push   %ebx
+  8006bd:	83 ec 2c             	sub    $0x2c,%esp
+  8006c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006c6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006c9:	eb 0a                	jmp    8006d5 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006cb:	83 ec 08             	sub    $0x8,%esp
+  8006ce:	53                   	push   %ebx
+  8006cf:	50                   	push   %eax
+  8006d0:	ff d6                	call   *%esi
+  8006d2:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006d5:	83 c7 01             	add    $0x1,%edi
+  8006d8:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8006dc:	83 f8 25             	cmp    $0x25,%eax
+  8006df:	74 0c                	je     8006ed <vprintfmt+0x36>
+			if (ch == '\0')
+  8006e1:	85 c0                	test   %eax,%eax
+  8006e3:	75 e6                	jne    8006cb <vprintfmt+0x14>
+}
+  8006e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006e8:	5b                   	pop    %ebx
+  8006e9:	5e                   	pop    %esi
+  8006ea:	5f                   	pop    %edi
+  8006eb:	5d                   	pop    %ebp
+  8006ec:	c3                   	ret
+		padc = ' ';
+  8006ed:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8006f1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8006f8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8006ff:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800706:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80070b:	8d 47 01             	lea    0x1(%edi),%eax
+  80070e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800711:	0f b6 17             	movzbl (%edi),%edx
+  800714:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800717:	3c 55                	cmp    $0x55,%al
+  800719:	0f 87 cf 03 00 00    	ja     800aee <vprintfmt+0x437>
+  80071f:	0f b6 c0             	movzbl %al,%eax
+  800722:	ff 24 85 c0 36 80 00 	jmp    *0x8036c0(,%eax,4)
+  800729:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80072c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800730:	eb d9                	jmp    80070b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800732:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800735:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800739:	eb d0                	jmp    80070b <vprintfmt+0x54>
+  80073b:	0f b6 d2             	movzbl %dl,%edx
+  80073e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800741:	b8 00 00 00 00       	mov    $0x0,%eax
+  800746:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800749:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80074c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800750:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800753:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800756:	83 f9 09             	cmp    $0x9,%ecx
+  800759:	77 55                	ja     8007b0 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80075b:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80075e:	eb e9                	jmp    800749 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800760:	8b 45 14             	mov    0x14(%ebp),%eax
+  800763:	8b 00                	mov    (%eax),%eax
+  800765:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	8d 40 04             	lea    0x4(%eax),%eax
+  80076e:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800771:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800774:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800778:	79 91                	jns    80070b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80077a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80077d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800780:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800787:	eb 82                	jmp    80070b <vprintfmt+0x54>
+			if (width < 0)
+  800789:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80078c:	85 d2                	test   %edx,%edx
+  80078e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800793:	0f 49 c2             	cmovns %edx,%eax
+  800796:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800799:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80079c:	e9 6a ff ff ff       	jmp    80070b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007a4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007ab:	e9 5b ff ff ff       	jmp    80070b <vprintfmt+0x54>
+  8007b0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007b3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007b6:	eb bc                	jmp    800774 <vprintfmt+0xbd>
+			lflag++;
+  8007b8:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007be:	e9 48 ff ff ff       	jmp    80070b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c6:	8d 78 04             	lea    0x4(%eax),%edi
+  8007c9:	83 ec 08             	sub    $0x8,%esp
+  8007cc:	53                   	push   %ebx
+  8007cd:	ff 30                	push   (%eax)
+  8007cf:	ff d6                	call   *%esi
+			break;
+  8007d1:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007d4:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007d7:	e9 b1 02 00 00       	jmp    800a8d <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8007dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007df:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8007e2:	8b 10                	mov    (%eax),%edx
+  8007e4:	89 d0                	mov    %edx,%eax
+  8007e6:	f7 d8                	neg    %eax
+  8007e8:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007eb:	83 f8 0f             	cmp    $0xf,%eax
+  8007ee:	7f 23                	jg     800813 <vprintfmt+0x15c>
+  8007f0:	8b 14 85 20 38 80 00 	mov    0x803820(,%eax,4),%edx
+  8007f7:	85 d2                	test   %edx,%edx
+  8007f9:	74 18                	je     800813 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8007fb:	52                   	push   %edx
+  8007fc:	68 49 3a 80 00       	push   $0x803a49
+  800801:	53                   	push   %ebx
+  800802:	56                   	push   %esi
+  800803:	e8 92 fe ff ff       	call   80069a <printfmt>
+  800808:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80080b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80080e:	e9 7a 02 00 00       	jmp    800a8d <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800813:	50                   	push   %eax
+  800814:	68 9f 35 80 00       	push   $0x80359f
+  800819:	53                   	push   %ebx
+  80081a:	56                   	push   %esi
+  80081b:	e8 7a fe ff ff       	call   80069a <printfmt>
+  800820:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800823:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800826:	e9 62 02 00 00       	jmp    800a8d <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80082b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082e:	83 c0 04             	add    $0x4,%eax
+  800831:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800834:	8b 45 14             	mov    0x14(%ebp),%eax
+  800837:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800839:	85 c9                	test   %ecx,%ecx
+  80083b:	b8 98 35 80 00       	mov    $0x803598,%eax
+  800840:	0f 45 c1             	cmovne %ecx,%eax
+  800843:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800846:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80084a:	7e 06                	jle    800852 <vprintfmt+0x19b>
+  80084c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800850:	75 0b                	jne    80085d <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800852:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800855:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800858:	89 75 08             	mov    %esi,0x8(%ebp)
+  80085b:	eb 5c                	jmp    8008b9 <vprintfmt+0x202>
+  80085d:	83 ec 08             	sub    $0x8,%esp
+  800860:	ff 75 d0             	push   -0x30(%ebp)
+  800863:	ff 75 cc             	push   -0x34(%ebp)
+  800866:	e8 20 03 00 00       	call   800b8b <strnlen>
+  80086b:	89 c2                	mov    %eax,%edx
+  80086d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800870:	29 d0                	sub    %edx,%eax
+  800872:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800875:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800879:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80087c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80087f:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800881:	eb 0e                	jmp    800891 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800883:	83 ec 08             	sub    $0x8,%esp
+  800886:	53                   	push   %ebx
+  800887:	57                   	push   %edi
+  800888:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80088b:	83 ee 01             	sub    $0x1,%esi
+  80088e:	83 c4 10             	add    $0x10,%esp
+  800891:	85 f6                	test   %esi,%esi
+  800893:	7f ee                	jg     800883 <vprintfmt+0x1cc>
+  800895:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800898:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089b:	85 c0                	test   %eax,%eax
+  80089d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008a2:	0f 49 d0             	cmovns %eax,%edx
+  8008a5:	29 d0                	sub    %edx,%eax
+  8008a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008aa:	eb a6                	jmp    800852 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8008ac:	83 ec 08             	sub    $0x8,%esp
+  8008af:	53                   	push   %ebx
+  8008b0:	52                   	push   %edx
+  8008b1:	ff 55 08             	call   *0x8(%ebp)
+  8008b4:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008b7:	89 f1                	mov    %esi,%ecx
+  8008b9:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008bc:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008c0:	0f be d0             	movsbl %al,%edx
+  8008c3:	85 d2                	test   %edx,%edx
+  8008c5:	74 28                	je     8008ef <vprintfmt+0x238>
+  8008c7:	85 ff                	test   %edi,%edi
+  8008c9:	78 05                	js     8008d0 <vprintfmt+0x219>
+  8008cb:	83 ef 01             	sub    $0x1,%edi
+  8008ce:	78 30                	js     800900 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008d0:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008d4:	74 d6                	je     8008ac <vprintfmt+0x1f5>
+  8008d6:	0f be c0             	movsbl %al,%eax
+  8008d9:	83 e8 20             	sub    $0x20,%eax
+  8008dc:	83 f8 5e             	cmp    $0x5e,%eax
+  8008df:	76 cb                	jbe    8008ac <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8008e1:	83 ec 08             	sub    $0x8,%esp
+  8008e4:	53                   	push   %ebx
+  8008e5:	6a 3f                	push   $0x3f
+  8008e7:	ff 55 08             	call   *0x8(%ebp)
+  8008ea:	83 c4 10             	add    $0x10,%esp
+  8008ed:	eb c8                	jmp    8008b7 <vprintfmt+0x200>
+  8008ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008f5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008f8:	01 d0                	add    %edx,%eax
+  8008fa:	29 c8                	sub    %ecx,%eax
+  8008fc:	89 c7                	mov    %eax,%edi
+  8008fe:	eb 13                	jmp    800913 <vprintfmt+0x25c>
+  800900:	8b 75 08             	mov    0x8(%ebp),%esi
+  800903:	eb ed                	jmp    8008f2 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800905:	83 ec 08             	sub    $0x8,%esp
+  800908:	53                   	push   %ebx
+  800909:	6a 20                	push   $0x20
+  80090b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80090d:	83 ef 01             	sub    $0x1,%edi
+  800910:	83 c4 10             	add    $0x10,%esp
+  800913:	85 ff                	test   %edi,%edi
+  800915:	7f ee                	jg     800905 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800917:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80091a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80091d:	e9 6b 01 00 00       	jmp    800a8d <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800922:	83 f9 01             	cmp    $0x1,%ecx
+  800925:	7f 1f                	jg     800946 <vprintfmt+0x28f>
+	else if (lflag)
+  800927:	85 c9                	test   %ecx,%ecx
+  800929:	74 67                	je     800992 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80092b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092e:	8b 00                	mov    (%eax),%eax
+  800930:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800933:	89 c1                	mov    %eax,%ecx
+  800935:	c1 f9 1f             	sar    $0x1f,%ecx
+  800938:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80093b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093e:	8d 40 04             	lea    0x4(%eax),%eax
+  800941:	89 45 14             	mov    %eax,0x14(%ebp)
+  800944:	eb 17                	jmp    80095d <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800946:	8b 45 14             	mov    0x14(%ebp),%eax
+  800949:	8b 50 04             	mov    0x4(%eax),%edx
+  80094c:	8b 00                	mov    (%eax),%eax
+  80094e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800951:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800954:	8b 45 14             	mov    0x14(%ebp),%eax
+  800957:	8d 40 08             	lea    0x8(%eax),%eax
+  80095a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80095d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800960:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800963:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800968:	85 c9                	test   %ecx,%ecx
+  80096a:	0f 89 03 01 00 00    	jns    800a73 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800970:	83 ec 08             	sub    $0x8,%esp
+  800973:	53                   	push   %ebx
+  800974:	6a 2d                	push   $0x2d
+  800976:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800978:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80097b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80097e:	f7 da                	neg    %edx
+  800980:	83 d1 00             	adc    $0x0,%ecx
+  800983:	f7 d9                	neg    %ecx
+  800985:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800988:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80098d:	e9 e1 00 00 00       	jmp    800a73 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800992:	8b 45 14             	mov    0x14(%ebp),%eax
+  800995:	8b 00                	mov    (%eax),%eax
+  800997:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80099a:	89 c1                	mov    %eax,%ecx
+  80099c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80099f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ab:	eb b0                	jmp    80095d <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8009ad:	83 f9 01             	cmp    $0x1,%ecx
+  8009b0:	7f 1e                	jg     8009d0 <vprintfmt+0x319>
+	else if (lflag)
+  8009b2:	85 c9                	test   %ecx,%ecx
+  8009b4:	74 32                	je     8009e8 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8009b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b9:	8b 10                	mov    (%eax),%edx
+  8009bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8009c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009c6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8009cb:	e9 a3 00 00 00       	jmp    800a73 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d3:	8b 10                	mov    (%eax),%edx
+  8009d5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8009db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009de:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8009e3:	e9 8b 00 00 00       	jmp    800a73 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8009e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009eb:	8b 10                	mov    (%eax),%edx
+  8009ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009f8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8009fd:	eb 74                	jmp    800a73 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8009ff:	83 f9 01             	cmp    $0x1,%ecx
+  800a02:	7f 1b                	jg     800a1f <vprintfmt+0x368>
+	else if (lflag)
+  800a04:	85 c9                	test   %ecx,%ecx
+  800a06:	74 2c                	je     800a34 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800a08:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0b:	8b 10                	mov    (%eax),%edx
+  800a0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a12:	8d 40 04             	lea    0x4(%eax),%eax
+  800a15:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a18:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800a1d:	eb 54                	jmp    800a73 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800a1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a22:	8b 10                	mov    (%eax),%edx
+  800a24:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a27:	8d 40 08             	lea    0x8(%eax),%eax
+  800a2a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a2d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800a32:	eb 3f                	jmp    800a73 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a34:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a37:	8b 10                	mov    (%eax),%edx
+  800a39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a3e:	8d 40 04             	lea    0x4(%eax),%eax
+  800a41:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a44:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800a49:	eb 28                	jmp    800a73 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800a4b:	83 ec 08             	sub    $0x8,%esp
+  800a4e:	53                   	push   %ebx
+  800a4f:	6a 30                	push   $0x30
+  800a51:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a53:	83 c4 08             	add    $0x8,%esp
+  800a56:	53                   	push   %ebx
+  800a57:	6a 78                	push   $0x78
+  800a59:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5e:	8b 10                	mov    (%eax),%edx
+  800a60:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a65:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a68:	8d 40 04             	lea    0x4(%eax),%eax
+  800a6b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a6e:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a73:	83 ec 0c             	sub    $0xc,%esp
+  800a76:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a7a:	50                   	push   %eax
+  800a7b:	ff 75 e0             	push   -0x20(%ebp)
+  800a7e:	57                   	push   %edi
+  800a7f:	51                   	push   %ecx
+  800a80:	52                   	push   %edx
+  800a81:	89 da                	mov    %ebx,%edx
+  800a83:	89 f0                	mov    %esi,%eax
+  800a85:	e8 4a fb ff ff       	call   8005d4 <printnum>
+			break;
+  800a8a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a8d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a90:	e9 40 fc ff ff       	jmp    8006d5 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800a95:	83 f9 01             	cmp    $0x1,%ecx
+  800a98:	7f 1b                	jg     800ab5 <vprintfmt+0x3fe>
+	else if (lflag)
+  800a9a:	85 c9                	test   %ecx,%ecx
+  800a9c:	74 2c                	je     800aca <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800a9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa1:	8b 10                	mov    (%eax),%edx
+  800aa3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa8:	8d 40 04             	lea    0x4(%eax),%eax
+  800aab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800aae:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800ab3:	eb be                	jmp    800a73 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800ab5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab8:	8b 10                	mov    (%eax),%edx
+  800aba:	8b 48 04             	mov    0x4(%eax),%ecx
+  800abd:	8d 40 08             	lea    0x8(%eax),%eax
+  800ac0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ac3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800ac8:	eb a9                	jmp    800a73 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800aca:	8b 45 14             	mov    0x14(%ebp),%eax
+  800acd:	8b 10                	mov    (%eax),%edx
+  800acf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad4:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ada:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800adf:	eb 92                	jmp    800a73 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800ae1:	83 ec 08             	sub    $0x8,%esp
+  800ae4:	53                   	push   %ebx
+  800ae5:	6a 25                	push   $0x25
+  800ae7:	ff d6                	call   *%esi
+			break;
+  800ae9:	83 c4 10             	add    $0x10,%esp
+  800aec:	eb 9f                	jmp    800a8d <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800aee:	83 ec 08             	sub    $0x8,%esp
+  800af1:	53                   	push   %ebx
+  800af2:	6a 25                	push   $0x25
+  800af4:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800af6:	83 c4 10             	add    $0x10,%esp
+  800af9:	89 f8                	mov    %edi,%eax
+  800afb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800aff:	74 05                	je     800b06 <vprintfmt+0x44f>
+  800b01:	83 e8 01             	sub    $0x1,%eax
+  800b04:	eb f5                	jmp    800afb <vprintfmt+0x444>
+  800b06:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b09:	eb 82                	jmp    800a8d <vprintfmt+0x3d6>
+
+00800b0b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b0b:	55                   	push   %ebp
+  800b0c:	89 e5                	mov    %esp,%ebp
+  800b0e:	83 ec 18             	sub    $0x18,%esp
+  800b11:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b14:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b17:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b1a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b1e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b21:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b28:	85 c0                	test   %eax,%eax
+  800b2a:	74 26                	je     800b52 <vsnprintf+0x47>
+  800b2c:	85 d2                	test   %edx,%edx
+  800b2e:	7e 22                	jle    800b52 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b30:	ff 75 14             	push   0x14(%ebp)
+  800b33:	ff 75 10             	push   0x10(%ebp)
+  800b36:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b39:	50                   	push   %eax
+  800b3a:	68 7d 06 80 00       	push   $0x80067d
+  800b3f:	e8 73 fb ff ff       	call   8006b7 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b44:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b47:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b4d:	83 c4 10             	add    $0x10,%esp
+}
+  800b50:	c9                   	leave
+  800b51:	c3                   	ret
+		return -E_INVAL;
+  800b52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b57:	eb f7                	jmp    800b50 <vsnprintf+0x45>
+
+00800b59 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b5f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b62:	50                   	push   %eax
+  800b63:	ff 75 10             	push   0x10(%ebp)
+  800b66:	ff 75 0c             	push   0xc(%ebp)
+  800b69:	ff 75 08             	push   0x8(%ebp)
+  800b6c:	e8 9a ff ff ff       	call   800b0b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b71:	c9                   	leave
+  800b72:	c3                   	ret
+
+00800b73 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b73:	55                   	push   %ebp
+  800b74:	89 e5                	mov    %esp,%ebp
+  800b76:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b79:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7e:	eb 03                	jmp    800b83 <strlen+0x10>
+		n++;
+  800b80:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b83:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b87:	75 f7                	jne    800b80 <strlen+0xd>
+	return n;
+}
+  800b89:	5d                   	pop    %ebp
+  800b8a:	c3                   	ret
+
+00800b8b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b8b:	55                   	push   %ebp
+  800b8c:	89 e5                	mov    %esp,%ebp
+  800b8e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b91:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b99:	eb 03                	jmp    800b9e <strnlen+0x13>
+		n++;
+  800b9b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b9e:	39 d0                	cmp    %edx,%eax
+  800ba0:	74 08                	je     800baa <strnlen+0x1f>
+  800ba2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ba6:	75 f3                	jne    800b9b <strnlen+0x10>
+  800ba8:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800baa:	89 d0                	mov    %edx,%eax
+  800bac:	5d                   	pop    %ebp
+  800bad:	c3                   	ret
+
+00800bae <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	53                   	push   %ebx
+  800bb2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bb5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbd:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bc1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bc4:	83 c0 01             	add    $0x1,%eax
+  800bc7:	84 d2                	test   %dl,%dl
+  800bc9:	75 f2                	jne    800bbd <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bcb:	89 c8                	mov    %ecx,%eax
+  800bcd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bd0:	c9                   	leave
+  800bd1:	c3                   	ret
+
+00800bd2 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bd2:	55                   	push   %ebp
+  800bd3:	89 e5                	mov    %esp,%ebp
+  800bd5:	53                   	push   %ebx
+  800bd6:	83 ec 10             	sub    $0x10,%esp
+  800bd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800bdc:	53                   	push   %ebx
+  800bdd:	e8 91 ff ff ff       	call   800b73 <strlen>
+  800be2:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800be5:	ff 75 0c             	push   0xc(%ebp)
+  800be8:	01 d8                	add    %ebx,%eax
+  800bea:	50                   	push   %eax
+  800beb:	e8 be ff ff ff       	call   800bae <strcpy>
+	return dst;
+}
+  800bf0:	89 d8                	mov    %ebx,%eax
+  800bf2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf5:	c9                   	leave
+  800bf6:	c3                   	ret
+
+00800bf7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bf7:	55                   	push   %ebp
+  800bf8:	89 e5                	mov    %esp,%ebp
+  800bfa:	56                   	push   %esi
+  800bfb:	53                   	push   %ebx
+  800bfc:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c02:	89 f3                	mov    %esi,%ebx
+  800c04:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c07:	89 f0                	mov    %esi,%eax
+  800c09:	eb 0f                	jmp    800c1a <strncpy+0x23>
+		*dst++ = *src;
+  800c0b:	83 c0 01             	add    $0x1,%eax
+  800c0e:	0f b6 0a             	movzbl (%edx),%ecx
+  800c11:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c14:	80 f9 01             	cmp    $0x1,%cl
+  800c17:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c1a:	39 d8                	cmp    %ebx,%eax
+  800c1c:	75 ed                	jne    800c0b <strncpy+0x14>
+	}
+	return ret;
+}
+  800c1e:	89 f0                	mov    %esi,%eax
+  800c20:	5b                   	pop    %ebx
+  800c21:	5e                   	pop    %esi
+  800c22:	5d                   	pop    %ebp
+  800c23:	c3                   	ret
+
+00800c24 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	56                   	push   %esi
+  800c28:	53                   	push   %ebx
+  800c29:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c32:	89 f0                	mov    %esi,%eax
+  800c34:	85 d2                	test   %edx,%edx
+  800c36:	74 21                	je     800c59 <strlcpy+0x35>
+  800c38:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c3c:	89 f2                	mov    %esi,%edx
+  800c3e:	eb 09                	jmp    800c49 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c40:	83 c1 01             	add    $0x1,%ecx
+  800c43:	83 c2 01             	add    $0x1,%edx
+  800c46:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c49:	39 c2                	cmp    %eax,%edx
+  800c4b:	74 09                	je     800c56 <strlcpy+0x32>
+  800c4d:	0f b6 19             	movzbl (%ecx),%ebx
+  800c50:	84 db                	test   %bl,%bl
+  800c52:	75 ec                	jne    800c40 <strlcpy+0x1c>
+  800c54:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c56:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c59:	29 f0                	sub    %esi,%eax
+}
+  800c5b:	5b                   	pop    %ebx
+  800c5c:	5e                   	pop    %esi
+  800c5d:	5d                   	pop    %ebp
+  800c5e:	c3                   	ret
+
+00800c5f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c65:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c68:	eb 06                	jmp    800c70 <strcmp+0x11>
+		p++, q++;
+  800c6a:	83 c1 01             	add    $0x1,%ecx
+  800c6d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c70:	0f b6 01             	movzbl (%ecx),%eax
+  800c73:	84 c0                	test   %al,%al
+  800c75:	74 04                	je     800c7b <strcmp+0x1c>
+  800c77:	3a 02                	cmp    (%edx),%al
+  800c79:	74 ef                	je     800c6a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c7b:	0f b6 c0             	movzbl %al,%eax
+  800c7e:	0f b6 12             	movzbl (%edx),%edx
+  800c81:	29 d0                	sub    %edx,%eax
+}
+  800c83:	5d                   	pop    %ebp
+  800c84:	c3                   	ret
+
+00800c85 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c85:	55                   	push   %ebp
+  800c86:	89 e5                	mov    %esp,%ebp
+  800c88:	53                   	push   %ebx
+  800c89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c92:	eb 09                	jmp    800c9d <strncmp+0x18>
+		n--, p++, q++;
+  800c94:	83 ea 01             	sub    $0x1,%edx
+  800c97:	83 c0 01             	add    $0x1,%eax
+  800c9a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c9d:	85 d2                	test   %edx,%edx
+  800c9f:	74 18                	je     800cb9 <strncmp+0x34>
+  800ca1:	0f b6 18             	movzbl (%eax),%ebx
+  800ca4:	84 db                	test   %bl,%bl
+  800ca6:	74 04                	je     800cac <strncmp+0x27>
+  800ca8:	3a 19                	cmp    (%ecx),%bl
+  800caa:	74 e8                	je     800c94 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cac:	0f b6 00             	movzbl (%eax),%eax
+  800caf:	0f b6 11             	movzbl (%ecx),%edx
+  800cb2:	29 d0                	sub    %edx,%eax
+}
+  800cb4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cb7:	c9                   	leave
+  800cb8:	c3                   	ret
+		return 0;
+  800cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbe:	eb f4                	jmp    800cb4 <strncmp+0x2f>
+
+00800cc0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cca:	eb 03                	jmp    800ccf <strchr+0xf>
+  800ccc:	83 c0 01             	add    $0x1,%eax
+  800ccf:	0f b6 10             	movzbl (%eax),%edx
+  800cd2:	84 d2                	test   %dl,%dl
+  800cd4:	74 06                	je     800cdc <strchr+0x1c>
+		if (*s == c)
+  800cd6:	38 ca                	cmp    %cl,%dl
+  800cd8:	75 f2                	jne    800ccc <strchr+0xc>
+  800cda:	eb 05                	jmp    800ce1 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ce1:	5d                   	pop    %ebp
+  800ce2:	c3                   	ret
+
+00800ce3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ced:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cf0:	38 ca                	cmp    %cl,%dl
+  800cf2:	74 09                	je     800cfd <strfind+0x1a>
+  800cf4:	84 d2                	test   %dl,%dl
+  800cf6:	74 05                	je     800cfd <strfind+0x1a>
+	for (; *s; s++)
+  800cf8:	83 c0 01             	add    $0x1,%eax
+  800cfb:	eb f0                	jmp    800ced <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800cfd:	5d                   	pop    %ebp
+  800cfe:	c3                   	ret
+
+00800cff <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cff:	55                   	push   %ebp
+  800d00:	89 e5                	mov    %esp,%ebp
+  800d02:	57                   	push   %edi
+  800d03:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d06:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d09:	85 c9                	test   %ecx,%ecx
+  800d0b:	74 20                	je     800d2d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d0d:	89 f8                	mov    %edi,%eax
+  800d0f:	09 c8                	or     %ecx,%eax
+  800d11:	a8 03                	test   $0x3,%al
+  800d13:	75 12                	jne    800d27 <memset+0x28>
+		c &= 0xFF;
+  800d15:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d19:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d1f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d22:	fc                   	cld
+  800d23:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d25:	eb 06                	jmp    800d2d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d2a:	fc                   	cld
+  800d2b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d2d:	89 f8                	mov    %edi,%eax
+  800d2f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d32:	c9                   	leave
+  800d33:	c3                   	ret
+
+00800d34 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	57                   	push   %edi
+  800d38:	56                   	push   %esi
+  800d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d3f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d42:	39 c6                	cmp    %eax,%esi
+  800d44:	73 32                	jae    800d78 <memmove+0x44>
+  800d46:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d49:	39 d0                	cmp    %edx,%eax
+  800d4b:	73 2b                	jae    800d78 <memmove+0x44>
+		s += n;
+		d += n;
+  800d4d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d50:	89 d6                	mov    %edx,%esi
+  800d52:	09 fe                	or     %edi,%esi
+  800d54:	09 ce                	or     %ecx,%esi
+  800d56:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d5c:	75 0e                	jne    800d6c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d5e:	83 ef 04             	sub    $0x4,%edi
+  800d61:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d64:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d67:	fd                   	std
+  800d68:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d6a:	eb 09                	jmp    800d75 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d6c:	83 ef 01             	sub    $0x1,%edi
+  800d6f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d72:	fd                   	std
+  800d73:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d75:	fc                   	cld
+  800d76:	eb 1a                	jmp    800d92 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d78:	89 f2                	mov    %esi,%edx
+  800d7a:	09 c2                	or     %eax,%edx
+  800d7c:	09 ca                	or     %ecx,%edx
+  800d7e:	f6 c2 03             	test   $0x3,%dl
+  800d81:	75 0a                	jne    800d8d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d83:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d86:	89 c7                	mov    %eax,%edi
+  800d88:	fc                   	cld
+  800d89:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d8b:	eb 05                	jmp    800d92 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d8d:	89 c7                	mov    %eax,%edi
+  800d8f:	fc                   	cld
+  800d90:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d92:	5e                   	pop    %esi
+  800d93:	5f                   	pop    %edi
+  800d94:	5d                   	pop    %ebp
+  800d95:	c3                   	ret
+
+00800d96 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d96:	55                   	push   %ebp
+  800d97:	89 e5                	mov    %esp,%ebp
+  800d99:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d9c:	ff 75 10             	push   0x10(%ebp)
+  800d9f:	ff 75 0c             	push   0xc(%ebp)
+  800da2:	ff 75 08             	push   0x8(%ebp)
+  800da5:	e8 8a ff ff ff       	call   800d34 <memmove>
+}
+  800daa:	c9                   	leave
+  800dab:	c3                   	ret
+
+00800dac <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800dac:	55                   	push   %ebp
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	56                   	push   %esi
+  800db0:	53                   	push   %ebx
+  800db1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800db7:	89 c6                	mov    %eax,%esi
+  800db9:	03 75 10             	add    0x10(%ebp),%esi
+  800dbc:	eb 06                	jmp    800dc4 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800dbe:	83 c0 01             	add    $0x1,%eax
+  800dc1:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800dc4:	39 f0                	cmp    %esi,%eax
+  800dc6:	74 14                	je     800ddc <memcmp+0x30>
+		if (*s1 != *s2)
+  800dc8:	0f b6 08             	movzbl (%eax),%ecx
+  800dcb:	0f b6 1a             	movzbl (%edx),%ebx
+  800dce:	38 d9                	cmp    %bl,%cl
+  800dd0:	74 ec                	je     800dbe <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800dd2:	0f b6 c1             	movzbl %cl,%eax
+  800dd5:	0f b6 db             	movzbl %bl,%ebx
+  800dd8:	29 d8                	sub    %ebx,%eax
+  800dda:	eb 05                	jmp    800de1 <memcmp+0x35>
+	}
+
+	return 0;
+  800ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800de1:	5b                   	pop    %ebx
+  800de2:	5e                   	pop    %esi
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+
+00800de5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800deb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dee:	89 c2                	mov    %eax,%edx
+  800df0:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800df3:	eb 03                	jmp    800df8 <memfind+0x13>
+  800df5:	83 c0 01             	add    $0x1,%eax
+  800df8:	39 d0                	cmp    %edx,%eax
+  800dfa:	73 04                	jae    800e00 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dfc:	38 08                	cmp    %cl,(%eax)
+  800dfe:	75 f5                	jne    800df5 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e00:	5d                   	pop    %ebp
+  800e01:	c3                   	ret
+
+00800e02 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e02:	55                   	push   %ebp
+  800e03:	89 e5                	mov    %esp,%ebp
+  800e05:	57                   	push   %edi
+  800e06:	56                   	push   %esi
+  800e07:	53                   	push   %ebx
+  800e08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e0e:	eb 03                	jmp    800e13 <strtol+0x11>
+		s++;
+  800e10:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e13:	0f b6 02             	movzbl (%edx),%eax
+  800e16:	3c 20                	cmp    $0x20,%al
+  800e18:	74 f6                	je     800e10 <strtol+0xe>
+  800e1a:	3c 09                	cmp    $0x9,%al
+  800e1c:	74 f2                	je     800e10 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e1e:	3c 2b                	cmp    $0x2b,%al
+  800e20:	74 2a                	je     800e4c <strtol+0x4a>
+	int neg = 0;
+  800e22:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e27:	3c 2d                	cmp    $0x2d,%al
+  800e29:	74 2b                	je     800e56 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e2b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e31:	75 0f                	jne    800e42 <strtol+0x40>
+  800e33:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e36:	74 28                	je     800e60 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e38:	85 db                	test   %ebx,%ebx
+  800e3a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e3f:	0f 44 d8             	cmove  %eax,%ebx
+  800e42:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e47:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e4a:	eb 46                	jmp    800e92 <strtol+0x90>
+		s++;
+  800e4c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e54:	eb d5                	jmp    800e2b <strtol+0x29>
+		s++, neg = 1;
+  800e56:	83 c2 01             	add    $0x1,%edx
+  800e59:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e5e:	eb cb                	jmp    800e2b <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e60:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e64:	74 0e                	je     800e74 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e66:	85 db                	test   %ebx,%ebx
+  800e68:	75 d8                	jne    800e42 <strtol+0x40>
+		s++, base = 8;
+  800e6a:	83 c2 01             	add    $0x1,%edx
+  800e6d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e72:	eb ce                	jmp    800e42 <strtol+0x40>
+		s += 2, base = 16;
+  800e74:	83 c2 02             	add    $0x2,%edx
+  800e77:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e7c:	eb c4                	jmp    800e42 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e7e:	0f be c0             	movsbl %al,%eax
+  800e81:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e84:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e87:	7d 3a                	jge    800ec3 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e89:	83 c2 01             	add    $0x1,%edx
+  800e8c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e90:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e92:	0f b6 02             	movzbl (%edx),%eax
+  800e95:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e98:	89 f3                	mov    %esi,%ebx
+  800e9a:	80 fb 09             	cmp    $0x9,%bl
+  800e9d:	76 df                	jbe    800e7e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800e9f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ea2:	89 f3                	mov    %esi,%ebx
+  800ea4:	80 fb 19             	cmp    $0x19,%bl
+  800ea7:	77 08                	ja     800eb1 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ea9:	0f be c0             	movsbl %al,%eax
+  800eac:	83 e8 57             	sub    $0x57,%eax
+  800eaf:	eb d3                	jmp    800e84 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800eb1:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800eb4:	89 f3                	mov    %esi,%ebx
+  800eb6:	80 fb 19             	cmp    $0x19,%bl
+  800eb9:	77 08                	ja     800ec3 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ebb:	0f be c0             	movsbl %al,%eax
+  800ebe:	83 e8 37             	sub    $0x37,%eax
+  800ec1:	eb c1                	jmp    800e84 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ec3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ec7:	74 05                	je     800ece <strtol+0xcc>
+		*endptr = (char *) s;
+  800ec9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ecc:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ece:	89 c8                	mov    %ecx,%eax
+  800ed0:	f7 d8                	neg    %eax
+  800ed2:	85 ff                	test   %edi,%edi
+  800ed4:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ed7:	89 c8                	mov    %ecx,%eax
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5e                   	pop    %esi
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+
+00800ede <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ede:	55                   	push   %ebp
+  800edf:	89 e5                	mov    %esp,%ebp
+  800ee1:	57                   	push   %edi
+  800ee2:	56                   	push   %esi
+  800ee3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eef:	89 c3                	mov    %eax,%ebx
+  800ef1:	89 c7                	mov    %eax,%edi
+  800ef3:	89 c6                	mov    %eax,%esi
+  800ef5:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+
+00800efc <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800efc:	55                   	push   %ebp
+  800efd:	89 e5                	mov    %esp,%ebp
+  800eff:	57                   	push   %edi
+  800f00:	56                   	push   %esi
+  800f01:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f02:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f07:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f0c:	89 d1                	mov    %edx,%ecx
+  800f0e:	89 d3                	mov    %edx,%ebx
+  800f10:	89 d7                	mov    %edx,%edi
+  800f12:	89 d6                	mov    %edx,%esi
+  800f14:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f16:	5b                   	pop    %ebx
+  800f17:	5e                   	pop    %esi
+  800f18:	5f                   	pop    %edi
+  800f19:	5d                   	pop    %ebp
+  800f1a:	c3                   	ret
+
+00800f1b <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	57                   	push   %edi
+  800f1f:	56                   	push   %esi
+  800f20:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f29:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f2e:	89 cb                	mov    %ecx,%ebx
+  800f30:	89 cf                	mov    %ecx,%edi
+  800f32:	89 ce                	mov    %ecx,%esi
+  800f34:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+
+00800f3b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	56                   	push   %esi
+  800f40:	53                   	push   %ebx
+  800f41:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f44:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f51:	89 cb                	mov    %ecx,%ebx
+  800f53:	89 cf                	mov    %ecx,%edi
+  800f55:	89 ce                	mov    %ecx,%esi
+  800f57:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f59:	85 c0                	test   %eax,%eax
+  800f5b:	7f 08                	jg     800f65 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f60:	5b                   	pop    %ebx
+  800f61:	5e                   	pop    %esi
+  800f62:	5f                   	pop    %edi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f65:	83 ec 0c             	sub    $0xc,%esp
+  800f68:	50                   	push   %eax
+  800f69:	6a 03                	push   $0x3
+  800f6b:	68 7f 38 80 00       	push   $0x80387f
+  800f70:	6a 23                	push   $0x23
+  800f72:	68 9c 38 80 00       	push   $0x80389c
+  800f77:	e8 69 f5 ff ff       	call   8004e5 <_panic>
+
+00800f7c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	56                   	push   %esi
+  800f81:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f82:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f87:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f8c:	89 d1                	mov    %edx,%ecx
+  800f8e:	89 d3                	mov    %edx,%ebx
+  800f90:	89 d7                	mov    %edx,%edi
+  800f92:	89 d6                	mov    %edx,%esi
+  800f94:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+
+00800f9b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	57                   	push   %edi
+  800f9f:	56                   	push   %esi
+  800fa0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa6:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fab:	89 d1                	mov    %edx,%ecx
+  800fad:	89 d3                	mov    %edx,%ebx
+  800faf:	89 d7                	mov    %edx,%edi
+  800fb1:	89 d6                	mov    %edx,%esi
+  800fb3:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fb5:	5b                   	pop    %ebx
+  800fb6:	5e                   	pop    %esi
+  800fb7:	5f                   	pop    %edi
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	c3                   	ret
+
+00800fba <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	57                   	push   %edi
+  800fbe:	56                   	push   %esi
+  800fbf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fca:	89 d1                	mov    %edx,%ecx
+  800fcc:	89 d3                	mov    %edx,%ebx
+  800fce:	89 d7                	mov    %edx,%edi
+  800fd0:	89 d6                	mov    %edx,%esi
+  800fd2:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800fd4:	5b                   	pop    %ebx
+  800fd5:	5e                   	pop    %esi
+  800fd6:	5f                   	pop    %edi
+  800fd7:	5d                   	pop    %ebp
+  800fd8:	c3                   	ret
+
+00800fd9 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800fd9:	55                   	push   %ebp
+  800fda:	89 e5                	mov    %esp,%ebp
+  800fdc:	57                   	push   %edi
+  800fdd:	56                   	push   %esi
+  800fde:	53                   	push   %ebx
+  800fdf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fe2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fed:	b8 15 00 00 00       	mov    $0x15,%eax
+  800ff2:	89 df                	mov    %ebx,%edi
+  800ff4:	89 de                	mov    %ebx,%esi
+  800ff6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff8:	85 c0                	test   %eax,%eax
+  800ffa:	7f 08                	jg     801004 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800ffc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fff:	5b                   	pop    %ebx
+  801000:	5e                   	pop    %esi
+  801001:	5f                   	pop    %edi
+  801002:	5d                   	pop    %ebp
+  801003:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801004:	83 ec 0c             	sub    $0xc,%esp
+  801007:	50                   	push   %eax
+  801008:	6a 15                	push   $0x15
+  80100a:	68 7f 38 80 00       	push   $0x80387f
+  80100f:	6a 23                	push   $0x23
+  801011:	68 9c 38 80 00       	push   $0x80389c
+  801016:	e8 ca f4 ff ff       	call   8004e5 <_panic>
+
+0080101b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801024:	be 00 00 00 00       	mov    $0x0,%esi
+  801029:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801034:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801037:	89 f7                	mov    %esi,%edi
+  801039:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103b:	85 c0                	test   %eax,%eax
+  80103d:	7f 08                	jg     801047 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80103f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801042:	5b                   	pop    %ebx
+  801043:	5e                   	pop    %esi
+  801044:	5f                   	pop    %edi
+  801045:	5d                   	pop    %ebp
+  801046:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801047:	83 ec 0c             	sub    $0xc,%esp
+  80104a:	50                   	push   %eax
+  80104b:	6a 05                	push   $0x5
+  80104d:	68 7f 38 80 00       	push   $0x80387f
+  801052:	6a 23                	push   $0x23
+  801054:	68 9c 38 80 00       	push   $0x80389c
+  801059:	e8 87 f4 ff ff       	call   8004e5 <_panic>
+
+0080105e <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+  801064:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801067:	be 00 00 00 00       	mov    $0x0,%esi
+  80106c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801072:	b8 06 00 00 00       	mov    $0x6,%eax
+  801077:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107a:	89 f7                	mov    %esi,%edi
+  80107c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107e:	85 c0                	test   %eax,%eax
+  801080:	7f 08                	jg     80108a <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801082:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801085:	5b                   	pop    %ebx
+  801086:	5e                   	pop    %esi
+  801087:	5f                   	pop    %edi
+  801088:	5d                   	pop    %ebp
+  801089:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80108a:	83 ec 0c             	sub    $0xc,%esp
+  80108d:	50                   	push   %eax
+  80108e:	6a 06                	push   $0x6
+  801090:	68 7f 38 80 00       	push   $0x80387f
+  801095:	6a 23                	push   $0x23
+  801097:	68 9c 38 80 00       	push   $0x80389c
+  80109c:	e8 44 f4 ff ff       	call   8004e5 <_panic>
+
+008010a1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	57                   	push   %edi
+  8010a5:	56                   	push   %esi
+  8010a6:	53                   	push   %ebx
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8010b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010bb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010be:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	7f 08                	jg     8010cc <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8010c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c7:	5b                   	pop    %ebx
+  8010c8:	5e                   	pop    %esi
+  8010c9:	5f                   	pop    %edi
+  8010ca:	5d                   	pop    %ebp
+  8010cb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cc:	83 ec 0c             	sub    $0xc,%esp
+  8010cf:	50                   	push   %eax
+  8010d0:	6a 07                	push   $0x7
+  8010d2:	68 7f 38 80 00       	push   $0x80387f
+  8010d7:	6a 23                	push   $0x23
+  8010d9:	68 9c 38 80 00       	push   $0x80389c
+  8010de:	e8 02 f4 ff ff       	call   8004e5 <_panic>
+
+008010e3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010fc:	89 df                	mov    %ebx,%edi
+  8010fe:	89 de                	mov    %ebx,%esi
+  801100:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801102:	85 c0                	test   %eax,%eax
+  801104:	7f 08                	jg     80110e <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801109:	5b                   	pop    %ebx
+  80110a:	5e                   	pop    %esi
+  80110b:	5f                   	pop    %edi
+  80110c:	5d                   	pop    %ebp
+  80110d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110e:	83 ec 0c             	sub    $0xc,%esp
+  801111:	50                   	push   %eax
+  801112:	6a 08                	push   $0x8
+  801114:	68 7f 38 80 00       	push   $0x80387f
+  801119:	6a 23                	push   $0x23
+  80111b:	68 9c 38 80 00       	push   $0x80389c
+  801120:	e8 c0 f3 ff ff       	call   8004e5 <_panic>
+
+00801125 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801131:	b8 09 00 00 00       	mov    $0x9,%eax
+  801136:	be 00 00 00 00       	mov    $0x0,%esi
+  80113b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801141:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  801143:	5b                   	pop    %ebx
+  801144:	5e                   	pop    %esi
+  801145:	5f                   	pop    %edi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+  80114e:	8b 45 18             	mov    0x18(%ebp),%eax
+  801151:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  801154:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  801159:	77 27                	ja     801182 <sys_page_map_range+0x3a>
+  80115b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  801161:	77 1f                	ja     801182 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  801163:	c1 e0 0c             	shl    $0xc,%eax
+  801166:	89 c6                	mov    %eax,%esi
+  801168:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  80116a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801170:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801175:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801178:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80117b:	cd 30                	int    $0x30
+}
+  80117d:	5b                   	pop    %ebx
+  80117e:	5e                   	pop    %esi
+  80117f:	5f                   	pop    %edi
+  801180:	5d                   	pop    %ebp
+  801181:	c3                   	ret
+		return -E_INVAL;
+  801182:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801187:	eb f4                	jmp    80117d <sys_page_map_range+0x35>
+
+00801189 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+  80118f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801192:	8b 55 08             	mov    0x8(%ebp),%edx
+  801195:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801198:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80119d:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011a8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011aa:	85 c0                	test   %eax,%eax
+  8011ac:	7f 08                	jg     8011b6 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8011ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b1:	5b                   	pop    %ebx
+  8011b2:	5e                   	pop    %esi
+  8011b3:	5f                   	pop    %edi
+  8011b4:	5d                   	pop    %ebp
+  8011b5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b6:	83 ec 0c             	sub    $0xc,%esp
+  8011b9:	50                   	push   %eax
+  8011ba:	6a 0c                	push   $0xc
+  8011bc:	68 7f 38 80 00       	push   $0x80387f
+  8011c1:	6a 23                	push   $0x23
+  8011c3:	68 9c 38 80 00       	push   $0x80389c
+  8011c8:	e8 18 f3 ff ff       	call   8004e5 <_panic>
+
+008011cd <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8011cd:	55                   	push   %ebp
+  8011ce:	89 e5                	mov    %esp,%ebp
+  8011d0:	57                   	push   %edi
+  8011d1:	56                   	push   %esi
+  8011d2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011de:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8011e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e6:	89 f7                	mov    %esi,%edi
+  8011e8:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  8011ea:	5b                   	pop    %ebx
+  8011eb:	5e                   	pop    %esi
+  8011ec:	5f                   	pop    %edi
+  8011ed:	5d                   	pop    %ebp
+  8011ee:	c3                   	ret
+
+008011ef <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	57                   	push   %edi
+  8011f3:	56                   	push   %esi
+  8011f4:	53                   	push   %ebx
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801200:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801203:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801208:	89 df                	mov    %ebx,%edi
+  80120a:	89 de                	mov    %ebx,%esi
+  80120c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80120e:	85 c0                	test   %eax,%eax
+  801210:	7f 08                	jg     80121a <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801212:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801215:	5b                   	pop    %ebx
+  801216:	5e                   	pop    %esi
+  801217:	5f                   	pop    %edi
+  801218:	5d                   	pop    %ebp
+  801219:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80121a:	83 ec 0c             	sub    $0xc,%esp
+  80121d:	50                   	push   %eax
+  80121e:	6a 0f                	push   $0xf
+  801220:	68 7f 38 80 00       	push   $0x80387f
+  801225:	6a 23                	push   $0x23
+  801227:	68 9c 38 80 00       	push   $0x80389c
+  80122c:	e8 b4 f2 ff ff       	call   8004e5 <_panic>
+
+00801231 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  801231:	55                   	push   %ebp
+  801232:	89 e5                	mov    %esp,%ebp
+  801234:	57                   	push   %edi
+  801235:	56                   	push   %esi
+  801236:	53                   	push   %ebx
+  801237:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80123a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801242:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801245:	b8 10 00 00 00       	mov    $0x10,%eax
+  80124a:	89 df                	mov    %ebx,%edi
+  80124c:	89 de                	mov    %ebx,%esi
+  80124e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801250:	85 c0                	test   %eax,%eax
+  801252:	7f 08                	jg     80125c <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  801254:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801257:	5b                   	pop    %ebx
+  801258:	5e                   	pop    %esi
+  801259:	5f                   	pop    %edi
+  80125a:	5d                   	pop    %ebp
+  80125b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125c:	83 ec 0c             	sub    $0xc,%esp
+  80125f:	50                   	push   %eax
+  801260:	6a 10                	push   $0x10
+  801262:	68 7f 38 80 00       	push   $0x80387f
+  801267:	6a 23                	push   $0x23
+  801269:	68 9c 38 80 00       	push   $0x80389c
+  80126e:	e8 72 f2 ff ff       	call   8004e5 <_panic>
+
+00801273 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	57                   	push   %edi
+  801277:	56                   	push   %esi
+  801278:	53                   	push   %ebx
+  801279:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80127c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801281:	8b 55 08             	mov    0x8(%ebp),%edx
+  801284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801287:	b8 11 00 00 00       	mov    $0x11,%eax
+  80128c:	89 df                	mov    %ebx,%edi
+  80128e:	89 de                	mov    %ebx,%esi
+  801290:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801292:	85 c0                	test   %eax,%eax
+  801294:	7f 08                	jg     80129e <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  801296:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5f                   	pop    %edi
+  80129c:	5d                   	pop    %ebp
+  80129d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80129e:	83 ec 0c             	sub    $0xc,%esp
+  8012a1:	50                   	push   %eax
+  8012a2:	6a 11                	push   $0x11
+  8012a4:	68 7f 38 80 00       	push   $0x80387f
+  8012a9:	6a 23                	push   $0x23
+  8012ab:	68 9c 38 80 00       	push   $0x80389c
+  8012b0:	e8 30 f2 ff ff       	call   8004e5 <_panic>
+
+008012b5 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  8012b5:	55                   	push   %ebp
+  8012b6:	89 e5                	mov    %esp,%ebp
+  8012b8:	57                   	push   %edi
+  8012b9:	56                   	push   %esi
+  8012ba:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012c5:	89 d1                	mov    %edx,%ecx
+  8012c7:	89 d3                	mov    %edx,%ebx
+  8012c9:	89 d7                	mov    %edx,%edi
+  8012cb:	89 d6                	mov    %edx,%esi
+  8012cd:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  8012cf:	5b                   	pop    %ebx
+  8012d0:	5e                   	pop    %esi
+  8012d1:	5f                   	pop    %edi
+  8012d2:	5d                   	pop    %ebp
+  8012d3:	c3                   	ret
+
+008012d4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8012d4:	55                   	push   %ebp
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	57                   	push   %edi
+  8012d8:	56                   	push   %esi
+  8012d9:	53                   	push   %ebx
+  8012da:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012ed:	89 df                	mov    %ebx,%edi
+  8012ef:	89 de                	mov    %ebx,%esi
+  8012f1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	7f 08                	jg     8012ff <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8012f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fa:	5b                   	pop    %ebx
+  8012fb:	5e                   	pop    %esi
+  8012fc:	5f                   	pop    %edi
+  8012fd:	5d                   	pop    %ebp
+  8012fe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012ff:	83 ec 0c             	sub    $0xc,%esp
+  801302:	50                   	push   %eax
+  801303:	6a 13                	push   $0x13
+  801305:	68 7f 38 80 00       	push   $0x80387f
+  80130a:	6a 23                	push   $0x23
+  80130c:	68 9c 38 80 00       	push   $0x80389c
+  801311:	e8 cf f1 ff ff       	call   8004e5 <_panic>
+
+00801316 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	57                   	push   %edi
+  80131a:	56                   	push   %esi
+  80131b:	53                   	push   %ebx
+  80131c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80131f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801324:	8b 55 08             	mov    0x8(%ebp),%edx
+  801327:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80132f:	89 df                	mov    %ebx,%edi
+  801331:	89 de                	mov    %ebx,%esi
+  801333:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801335:	85 c0                	test   %eax,%eax
+  801337:	7f 08                	jg     801341 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801339:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80133c:	5b                   	pop    %ebx
+  80133d:	5e                   	pop    %esi
+  80133e:	5f                   	pop    %edi
+  80133f:	5d                   	pop    %ebp
+  801340:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801341:	83 ec 0c             	sub    $0xc,%esp
+  801344:	50                   	push   %eax
+  801345:	6a 14                	push   $0x14
+  801347:	68 7f 38 80 00       	push   $0x80387f
+  80134c:	6a 23                	push   $0x23
+  80134e:	68 9c 38 80 00       	push   $0x80389c
+  801353:	e8 8d f1 ff ff       	call   8004e5 <_panic>
+
+00801358 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801358:	55                   	push   %ebp
+  801359:	89 e5                	mov    %esp,%ebp
+  80135b:	57                   	push   %edi
+  80135c:	56                   	push   %esi
+  80135d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80135e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801361:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801364:	b8 17 00 00 00       	mov    $0x17,%eax
+  801369:	be 00 00 00 00       	mov    $0x0,%esi
+  80136e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801371:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801374:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801376:	5b                   	pop    %ebx
+  801377:	5e                   	pop    %esi
+  801378:	5f                   	pop    %edi
+  801379:	5d                   	pop    %ebp
+  80137a:	c3                   	ret
+
+0080137b <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	57                   	push   %edi
+  80137f:	56                   	push   %esi
+  801380:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801381:	8b 55 08             	mov    0x8(%ebp),%edx
+  801384:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801387:	b8 18 00 00 00       	mov    $0x18,%eax
+  80138c:	be 00 00 00 00       	mov    $0x0,%esi
+  801391:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801394:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801397:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801399:	5b                   	pop    %ebx
+  80139a:	5e                   	pop    %esi
+  80139b:	5f                   	pop    %edi
+  80139c:	5d                   	pop    %ebp
+  80139d:	c3                   	ret
+
+0080139e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80139e:	55                   	push   %ebp
+  80139f:	89 e5                	mov    %esp,%ebp
+  8013a1:	57                   	push   %edi
+  8013a2:	56                   	push   %esi
+  8013a3:	53                   	push   %ebx
+  8013a4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013af:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013b4:	89 cb                	mov    %ecx,%ebx
+  8013b6:	89 cf                	mov    %ecx,%edi
+  8013b8:	89 ce                	mov    %ecx,%esi
+  8013ba:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013bc:	85 c0                	test   %eax,%eax
+  8013be:	7f 08                	jg     8013c8 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8013c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c3:	5b                   	pop    %ebx
+  8013c4:	5e                   	pop    %esi
+  8013c5:	5f                   	pop    %edi
+  8013c6:	5d                   	pop    %ebp
+  8013c7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013c8:	83 ec 0c             	sub    $0xc,%esp
+  8013cb:	50                   	push   %eax
+  8013cc:	6a 19                	push   $0x19
+  8013ce:	68 7f 38 80 00       	push   $0x80387f
+  8013d3:	6a 23                	push   $0x23
+  8013d5:	68 9c 38 80 00       	push   $0x80389c
+  8013da:	e8 06 f1 ff ff       	call   8004e5 <_panic>
+
+008013df <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8013df:	55                   	push   %ebp
+  8013e0:	89 e5                	mov    %esp,%ebp
+  8013e2:	57                   	push   %edi
+  8013e3:	56                   	push   %esi
+  8013e4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ea:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013ef:	89 d1                	mov    %edx,%ecx
+  8013f1:	89 d3                	mov    %edx,%ebx
+  8013f3:	89 d7                	mov    %edx,%edi
+  8013f5:	89 d6                	mov    %edx,%esi
+  8013f7:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8013f9:	5b                   	pop    %ebx
+  8013fa:	5e                   	pop    %esi
+  8013fb:	5f                   	pop    %edi
+  8013fc:	5d                   	pop    %ebp
+  8013fd:	c3                   	ret
+
+008013fe <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  8013fe:	55                   	push   %ebp
+  8013ff:	89 e5                	mov    %esp,%ebp
+  801401:	57                   	push   %edi
+  801402:	56                   	push   %esi
+  801403:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801404:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801409:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801414:	89 df                	mov    %ebx,%edi
+  801416:	89 de                	mov    %ebx,%esi
+  801418:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  80141a:	5b                   	pop    %ebx
+  80141b:	5e                   	pop    %esi
+  80141c:	5f                   	pop    %edi
+  80141d:	5d                   	pop    %ebp
+  80141e:	c3                   	ret
+
+0080141f <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	57                   	push   %edi
+  801423:	56                   	push   %esi
+  801424:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801425:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801430:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801435:	89 df                	mov    %ebx,%edi
+  801437:	89 de                	mov    %ebx,%esi
+  801439:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  80143b:	5b                   	pop    %ebx
+  80143c:	5e                   	pop    %esi
+  80143d:	5f                   	pop    %edi
+  80143e:	5d                   	pop    %ebp
+  80143f:	c3                   	ret
+
+00801440 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801440:	55                   	push   %ebp
+  801441:	89 e5                	mov    %esp,%ebp
+  801443:	53                   	push   %ebx
+  801444:	83 ec 04             	sub    $0x4,%esp
+  801447:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80144a:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  80144c:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+  80144f:	f6 c2 02             	test   $0x2,%dl
+  801452:	74 7b                	je     8014cf <pgfault+0x8f>
+  801454:	89 c1                	mov    %eax,%ecx
+  801456:	c1 e9 0c             	shr    $0xc,%ecx
+  801459:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  801460:	f6 c5 08             	test   $0x8,%ch
+  801463:	74 6a                	je     8014cf <pgfault+0x8f>
+	// page to the old page's address.
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801465:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80146a:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80146c:	83 ec 04             	sub    $0x4,%esp
+  80146f:	6a 07                	push   $0x7
+  801471:	68 00 f0 7f 00       	push   $0x7ff000
+  801476:	6a 00                	push   $0x0
+  801478:	e8 9e fb ff ff       	call   80101b <sys_page_alloc>
+  80147d:	83 c4 10             	add    $0x10,%esp
+  801480:	85 c0                	test   %eax,%eax
+  801482:	78 61                	js     8014e5 <pgfault+0xa5>
+		panic("sys_page_alloc: %e", r);
+
+	memmove((void *) PFTEMP, addr, PGSIZE);
+  801484:	83 ec 04             	sub    $0x4,%esp
+  801487:	68 00 10 00 00       	push   $0x1000
+  80148c:	53                   	push   %ebx
+  80148d:	68 00 f0 7f 00       	push   $0x7ff000
+  801492:	e8 9d f8 ff ff       	call   800d34 <memmove>
+
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  801497:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80149e:	53                   	push   %ebx
+  80149f:	6a 00                	push   $0x0
+  8014a1:	68 00 f0 7f 00       	push   $0x7ff000
+  8014a6:	6a 00                	push   $0x0
+  8014a8:	e8 f4 fb ff ff       	call   8010a1 <sys_page_map>
+  8014ad:	83 c4 20             	add    $0x20,%esp
+  8014b0:	85 c0                	test   %eax,%eax
+  8014b2:	78 43                	js     8014f7 <pgfault+0xb7>
+		panic("sys_page_map: %e", r);
+
+	if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0)
+  8014b4:	83 ec 08             	sub    $0x8,%esp
+  8014b7:	68 00 f0 7f 00       	push   $0x7ff000
+  8014bc:	6a 00                	push   $0x0
+  8014be:	e8 20 fc ff ff       	call   8010e3 <sys_page_unmap>
+  8014c3:	83 c4 10             	add    $0x10,%esp
+  8014c6:	85 c0                	test   %eax,%eax
+  8014c8:	78 3f                	js     801509 <pgfault+0xc9>
+		panic("sys_page_unmap: %e", r);
+}
+  8014ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014cd:	c9                   	leave
+  8014ce:	c3                   	ret
+		panic("err %d addr 0x%x", err, addr);
+  8014cf:	83 ec 0c             	sub    $0xc,%esp
+  8014d2:	50                   	push   %eax
+  8014d3:	52                   	push   %edx
+  8014d4:	68 aa 38 80 00       	push   $0x8038aa
+  8014d9:	6a 19                	push   $0x19
+  8014db:	68 bb 38 80 00       	push   $0x8038bb
+  8014e0:	e8 00 f0 ff ff       	call   8004e5 <_panic>
+		panic("sys_page_alloc: %e", r);
+  8014e5:	50                   	push   %eax
+  8014e6:	68 c6 38 80 00       	push   $0x8038c6
+  8014eb:	6a 24                	push   $0x24
+  8014ed:	68 bb 38 80 00       	push   $0x8038bb
+  8014f2:	e8 ee ef ff ff       	call   8004e5 <_panic>
+		panic("sys_page_map: %e", r);
+  8014f7:	50                   	push   %eax
+  8014f8:	68 d9 38 80 00       	push   $0x8038d9
+  8014fd:	6a 29                	push   $0x29
+  8014ff:	68 bb 38 80 00       	push   $0x8038bb
+  801504:	e8 dc ef ff ff       	call   8004e5 <_panic>
+		panic("sys_page_unmap: %e", r);
+  801509:	50                   	push   %eax
+  80150a:	68 ea 38 80 00       	push   $0x8038ea
+  80150f:	6a 2c                	push   $0x2c
+  801511:	68 bb 38 80 00       	push   $0x8038bb
+  801516:	e8 ca ef ff ff       	call   8004e5 <_panic>
+
+0080151b <fork>:
+// The kernel does all of this in a single system call, sys_fork_cow.
+// The page-by-page version is only used if the kernel doesn't have it.
+//
+envid_t
+fork(void)
+{
+  80151b:	55                   	push   %ebp
+  80151c:	89 e5                	mov    %esp,%ebp
+  80151e:	57                   	push   %edi
+  80151f:	56                   	push   %esi
+  801520:	53                   	push   %ebx
+  801521:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	uint32_t pn;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801524:	68 40 14 80 00       	push   $0x801440
+  801529:	e8 00 19 00 00       	call   802e2e <set_pgfault_handler>
+
+	// Let the kernel resolve our copy-on-write faults, and our
+	// children's: pgfault does the same, only slower, and remains in
+	// charge if the kernel can't.
+	sys_env_set_kernel_cow(0, 1);
+  80152e:	83 c4 08             	add    $0x8,%esp
+  801531:	6a 01                	push   $0x1
+  801533:	6a 00                	push   $0x0
+  801535:	e8 9f fa ff ff       	call   800fd9 <sys_env_set_kernel_cow>
+
+	envid = sys_fork_cow();
+  80153a:	e8 7b fa ff ff       	call   800fba <sys_fork_cow>
+  80153f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid == 0) {
+  801542:	83 c4 10             	add    $0x10,%esp
+  801545:	85 c0                	test   %eax,%eax
+  801547:	74 2c                	je     801575 <fork+0x5a>
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid != -E_INVAL)
+  801549:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  80154d:	0f 85 8b 01 00 00    	jne    8016de <fork+0x1c3>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801553:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801558:	cd 30                	int    $0x30
+  80155a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		return envid;
+
+	envid = sys_exofork();
+	if (envid < 0)
+  80155d:	85 c0                	test   %eax,%eax
+  80155f:	78 30                	js     801591 <fork+0x76>
+		panic("sys_exofork: %e", envid);
+
+	if (envid == 0) {
+  801561:	be 00 00 00 00       	mov    $0x0,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  801566:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  80156b:	74 36                	je     8015a3 <fork+0x88>
+  80156d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801570:	e9 99 00 00 00       	jmp    80160e <fork+0xf3>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801575:	e8 02 fa ff ff       	call   800f7c <sys_getenvid>
+  80157a:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80157f:	c1 e0 09             	shl    $0x9,%eax
+  801582:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801587:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  80158c:	e9 4d 01 00 00       	jmp    8016de <fork+0x1c3>
+		panic("sys_exofork: %e", envid);
+  801591:	50                   	push   %eax
+  801592:	68 fd 38 80 00       	push   $0x8038fd
+  801597:	6a 7d                	push   $0x7d
+  801599:	68 bb 38 80 00       	push   $0x8038bb
+  80159e:	e8 42 ef ff ff       	call   8004e5 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8015a3:	e8 d4 f9 ff ff       	call   800f7c <sys_getenvid>
+  8015a8:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8015ad:	c1 e0 09             	shl    $0x9,%eax
+  8015b0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015b5:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  8015ba:	e9 1f 01 00 00       	jmp    8016de <fork+0x1c3>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  8015bf:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  8015c6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8015c9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  8015d1:	83 ec 0c             	sub    $0xc,%esp
+  8015d4:	50                   	push   %eax
+  8015d5:	56                   	push   %esi
+  8015d6:	ff 75 e4             	push   -0x1c(%ebp)
+  8015d9:	56                   	push   %esi
+  8015da:	6a 00                	push   $0x0
+  8015dc:	e8 c0 fa ff ff       	call   8010a1 <sys_page_map>
+  8015e1:	83 c4 20             	add    $0x20,%esp
+  8015e4:	85 c0                	test   %eax,%eax
+  8015e6:	0f 88 98 00 00 00    	js     801684 <fork+0x169>
+	if (perm & PTE_COW) {
+  8015ec:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  8015f3:	0f 85 61 01 00 00    	jne    80175a <fork+0x23f>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8015f9:	83 c7 01             	add    $0x1,%edi
+  8015fc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801602:	81 ff 00 ec 0e 00    	cmp    $0xeec00,%edi
+  801608:	0f 84 88 00 00 00    	je     801696 <fork+0x17b>
+		uintptr_t va = pn << PGSHIFT;
+		// 4MB pages (sys_page_alloc_large) are not inherited
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  80160e:	89 f0                	mov    %esi,%eax
+  801610:	c1 e8 16             	shr    $0x16,%eax
+  801613:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80161a:	25 81 00 00 00       	and    $0x81,%eax
+  80161f:	83 f8 01             	cmp    $0x1,%eax
+  801622:	75 d5                	jne    8015f9 <fork+0xde>
+			continue;
+
+		if (!(uvpt[pn] & PTE_P))
+  801624:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+		    continue;
+
+		if (va != UXSTACKTOP - PGSIZE)
+  80162b:	a8 01                	test   $0x1,%al
+  80162d:	74 ca                	je     8015f9 <fork+0xde>
+  80162f:	81 fe 00 f0 bf ee    	cmp    $0xeebff000,%esi
+  801635:	74 c2                	je     8015f9 <fork+0xde>
+	void *va = (void *) (pn << PGSHIFT);
+  801637:	89 f3                	mov    %esi,%ebx
+	if (uvpt[pn] & PTE_SHARE)
+  801639:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801640:	f6 c4 04             	test   $0x4,%ah
+  801643:	0f 85 76 ff ff ff    	jne    8015bf <fork+0xa4>
+	else if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW)
+  801649:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801650:	a8 02                	test   $0x2,%al
+  801652:	0f 85 dc 00 00 00    	jne    801734 <fork+0x219>
+  801658:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  80165f:	f6 c4 08             	test   $0x8,%ah
+  801662:	0f 85 cc 00 00 00    	jne    801734 <fork+0x219>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801668:	83 ec 0c             	sub    $0xc,%esp
+  80166b:	6a 05                	push   $0x5
+  80166d:	56                   	push   %esi
+  80166e:	ff 75 e4             	push   -0x1c(%ebp)
+  801671:	56                   	push   %esi
+  801672:	6a 00                	push   $0x0
+  801674:	e8 28 fa ff ff       	call   8010a1 <sys_page_map>
+  801679:	83 c4 20             	add    $0x20,%esp
+  80167c:	85 c0                	test   %eax,%eax
+  80167e:	0f 89 75 ff ff ff    	jns    8015f9 <fork+0xde>
+		panic("sys_page_map: %e", r);
+  801684:	50                   	push   %eax
+  801685:	68 d9 38 80 00       	push   $0x8038d9
+  80168a:	6a 48                	push   $0x48
+  80168c:	68 bb 38 80 00       	push   $0x8038bb
+  801691:	e8 4f ee ff ff       	call   8004e5 <_panic>
+			duppage(envid, pn);
+	}
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W)) < 0)
+  801696:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  801699:	83 ec 04             	sub    $0x4,%esp
+  80169c:	6a 07                	push   $0x7
+  80169e:	68 00 f0 bf ee       	push   $0xeebff000
+  8016a3:	53                   	push   %ebx
+  8016a4:	e8 72 f9 ff ff       	call   80101b <sys_page_alloc>
+  8016a9:	83 c4 10             	add    $0x10,%esp
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	78 39                	js     8016e9 <fork+0x1ce>
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8016b0:	a1 08 50 80 00       	mov    0x805008,%eax
+  8016b5:	8b 80 94 01 00 00    	mov    0x194(%eax),%eax
+  8016bb:	83 ec 08             	sub    $0x8,%esp
+  8016be:	50                   	push   %eax
+  8016bf:	53                   	push   %ebx
+  8016c0:	e8 51 fc ff ff       	call   801316 <sys_env_set_pgfault_upcall>
+  8016c5:	83 c4 10             	add    $0x10,%esp
+  8016c8:	85 c0                	test   %eax,%eax
+  8016ca:	78 36                	js     801702 <fork+0x1e7>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8016cc:	83 ec 08             	sub    $0x8,%esp
+  8016cf:	6a 02                	push   $0x2
+  8016d1:	53                   	push   %ebx
+  8016d2:	e8 18 fb ff ff       	call   8011ef <sys_env_set_status>
+  8016d7:	83 c4 10             	add    $0x10,%esp
+  8016da:	85 c0                	test   %eax,%eax
+  8016dc:	78 3d                	js     80171b <fork+0x200>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+	return envid;
+}
+  8016de:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8016e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e4:	5b                   	pop    %ebx
+  8016e5:	5e                   	pop    %esi
+  8016e6:	5f                   	pop    %edi
+  8016e7:	5d                   	pop    %ebp
+  8016e8:	c3                   	ret
+	    panic("sys_page_alloc: %e for env [%08x]", r, envid);
+  8016e9:	83 ec 0c             	sub    $0xc,%esp
+  8016ec:	53                   	push   %ebx
+  8016ed:	50                   	push   %eax
+  8016ee:	68 24 39 80 00       	push   $0x803924
+  8016f3:	68 92 00 00 00       	push   $0x92
+  8016f8:	68 bb 38 80 00       	push   $0x8038bb
+  8016fd:	e8 e3 ed ff ff       	call   8004e5 <_panic>
+		panic("sys_env_set_pgfault_upcall: %e for env [%08x]", r, envid);
+  801702:	83 ec 0c             	sub    $0xc,%esp
+  801705:	53                   	push   %ebx
+  801706:	50                   	push   %eax
+  801707:	68 48 39 80 00       	push   $0x803948
+  80170c:	68 95 00 00 00       	push   $0x95
+  801711:	68 bb 38 80 00       	push   $0x8038bb
+  801716:	e8 ca ed ff ff       	call   8004e5 <_panic>
+		panic("sys_env_set_status: %e for env [%08x]", r, envid);
+  80171b:	83 ec 0c             	sub    $0xc,%esp
+  80171e:	53                   	push   %ebx
+  80171f:	50                   	push   %eax
+  801720:	68 78 39 80 00       	push   $0x803978
+  801725:	68 98 00 00 00       	push   $0x98
+  80172a:	68 bb 38 80 00       	push   $0x8038bb
+  80172f:	e8 b1 ed ff ff       	call   8004e5 <_panic>
+	if ((r = sys_page_map(0, va, envid, va, perm)) < 0)
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	68 05 08 00 00       	push   $0x805
+  80173c:	53                   	push   %ebx
+  80173d:	ff 75 e4             	push   -0x1c(%ebp)
+  801740:	53                   	push   %ebx
+  801741:	6a 00                	push   $0x0
+  801743:	e8 59 f9 ff ff       	call   8010a1 <sys_page_map>
+  801748:	83 c4 20             	add    $0x20,%esp
+  80174b:	85 c0                	test   %eax,%eax
+  80174d:	0f 88 31 ff ff ff    	js     801684 <fork+0x169>
+		perm |= PTE_COW;
+  801753:	c7 45 e0 05 08 00 00 	movl   $0x805,-0x20(%ebp)
+		if ((r = sys_page_map(0, va, 0, va, perm)) < 0)
+  80175a:	83 ec 0c             	sub    $0xc,%esp
+  80175d:	ff 75 e0             	push   -0x20(%ebp)
+  801760:	53                   	push   %ebx
+  801761:	6a 00                	push   $0x0
+  801763:	53                   	push   %ebx
+  801764:	6a 00                	push   $0x0
+  801766:	e8 36 f9 ff ff       	call   8010a1 <sys_page_map>
+  80176b:	83 c4 20             	add    $0x20,%esp
+  80176e:	85 c0                	test   %eax,%eax
+  801770:	0f 89 83 fe ff ff    	jns    8015f9 <fork+0xde>
+			panic("sys_page_map: %e", r);
+  801776:	50                   	push   %eax
+  801777:	68 d9 38 80 00       	push   $0x8038d9
+  80177c:	6a 4c                	push   $0x4c
+  80177e:	68 bb 38 80 00       	push   $0x8038bb
+  801783:	e8 5d ed ff ff       	call   8004e5 <_panic>
+
+00801788 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801788:	55                   	push   %ebp
+  801789:	89 e5                	mov    %esp,%ebp
+  80178b:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80178e:	68 0d 39 80 00       	push   $0x80390d
+  801793:	68 a0 00 00 00       	push   $0xa0
+  801798:	68 bb 38 80 00       	push   $0x8038bb
+  80179d:	e8 43 ed ff ff       	call   8004e5 <_panic>
+
+008017a2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017a2:	55                   	push   %ebp
+  8017a3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017ad:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017b0:	5d                   	pop    %ebp
+  8017b1:	c3                   	ret
+
+008017b2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017b2:	55                   	push   %ebp
+  8017b3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b8:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017bd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017c2:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017c7:	5d                   	pop    %ebp
+  8017c8:	c3                   	ret
+
+008017c9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017c9:	55                   	push   %ebp
+  8017ca:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017cc:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017d1:	eb 02                	jmp    8017d5 <fd_alloc+0xc>
+  8017d3:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017d5:	89 c2                	mov    %eax,%edx
+  8017d7:	c1 ea 16             	shr    $0x16,%edx
+  8017da:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017e1:	f6 c2 01             	test   $0x1,%dl
+  8017e4:	74 2b                	je     801811 <fd_alloc+0x48>
+  8017e6:	89 c2                	mov    %eax,%edx
+  8017e8:	c1 ea 0c             	shr    $0xc,%edx
+  8017eb:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017f2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017f8:	f6 c1 01             	test   $0x1,%cl
+  8017fb:	74 14                	je     801811 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8017fd:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801803:	75 ce                	jne    8017d3 <fd_alloc+0xa>
+  801805:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80180a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80180f:	eb 05                	jmp    801816 <fd_alloc+0x4d>
+			return 0;
+  801811:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801816:	8b 55 08             	mov    0x8(%ebp),%edx
+  801819:	89 02                	mov    %eax,(%edx)
+}
+  80181b:	89 c8                	mov    %ecx,%eax
+  80181d:	5d                   	pop    %ebp
+  80181e:	c3                   	ret
+
+0080181f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80181f:	55                   	push   %ebp
+  801820:	89 e5                	mov    %esp,%ebp
+  801822:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801825:	83 f8 1f             	cmp    $0x1f,%eax
+  801828:	77 30                	ja     80185a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80182a:	c1 e0 0c             	shl    $0xc,%eax
+  80182d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801832:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801838:	f6 c2 01             	test   $0x1,%dl
+  80183b:	74 24                	je     801861 <fd_lookup+0x42>
+  80183d:	89 c2                	mov    %eax,%edx
+  80183f:	c1 ea 0c             	shr    $0xc,%edx
+  801842:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801849:	f6 c2 01             	test   $0x1,%dl
+  80184c:	74 1a                	je     801868 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80184e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801851:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801853:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801858:	5d                   	pop    %ebp
+  801859:	c3                   	ret
+		return -E_INVAL;
+  80185a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185f:	eb f7                	jmp    801858 <fd_lookup+0x39>
+		return -E_INVAL;
+  801861:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801866:	eb f0                	jmp    801858 <fd_lookup+0x39>
+  801868:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80186d:	eb e9                	jmp    801858 <fd_lookup+0x39>
+
+0080186f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80186f:	55                   	push   %ebp
+  801870:	89 e5                	mov    %esp,%ebp
+  801872:	53                   	push   %ebx
+  801873:	83 ec 04             	sub    $0x4,%esp
+  801876:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187e:	eb 03                	jmp    801883 <dev_lookup+0x14>
+  801880:	83 c0 01             	add    $0x1,%eax
+  801883:	8b 1c 85 1c 3a 80 00 	mov    0x803a1c(,%eax,4),%ebx
+  80188a:	85 db                	test   %ebx,%ebx
+  80188c:	74 0b                	je     801899 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80188e:	39 13                	cmp    %edx,(%ebx)
+  801890:	75 ee                	jne    801880 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801892:	b8 00 00 00 00       	mov    $0x0,%eax
+  801897:	eb 1f                	jmp    8018b8 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801899:	a1 08 50 80 00       	mov    0x805008,%eax
+  80189e:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8018a1:	83 ec 04             	sub    $0x4,%esp
+  8018a4:	52                   	push   %edx
+  8018a5:	50                   	push   %eax
+  8018a6:	68 a0 39 80 00       	push   $0x8039a0
+  8018ab:	e8 10 ed ff ff       	call   8005c0 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018b0:	83 c4 10             	add    $0x10,%esp
+  8018b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018bb:	89 1a                	mov    %ebx,(%edx)
+}
+  8018bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018c0:	c9                   	leave
+  8018c1:	c3                   	ret
+
+008018c2 <fd_close>:
+{
+  8018c2:	55                   	push   %ebp
+  8018c3:	89 e5                	mov    %esp,%ebp
+  8018c5:	57                   	push   %edi
+  8018c6:	56                   	push   %esi
+  8018c7:	53                   	push   %ebx
+  8018c8:	83 ec 24             	sub    $0x24,%esp
+  8018cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018ce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018d1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018d4:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018d5:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018db:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018de:	50                   	push   %eax
+  8018df:	e8 3b ff ff ff       	call   80181f <fd_lookup>
+  8018e4:	89 c3                	mov    %eax,%ebx
+  8018e6:	83 c4 10             	add    $0x10,%esp
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	78 05                	js     8018f2 <fd_close+0x30>
+	    || fd != fd2)
+  8018ed:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8018f0:	74 16                	je     801908 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8018f2:	89 f8                	mov    %edi,%eax
+  8018f4:	84 c0                	test   %al,%al
+  8018f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fb:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8018fe:	89 d8                	mov    %ebx,%eax
+  801900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801903:	5b                   	pop    %ebx
+  801904:	5e                   	pop    %esi
+  801905:	5f                   	pop    %edi
+  801906:	5d                   	pop    %ebp
+  801907:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801908:	83 ec 08             	sub    $0x8,%esp
+  80190b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80190e:	50                   	push   %eax
+  80190f:	ff 36                	push   (%esi)
+  801911:	e8 59 ff ff ff       	call   80186f <dev_lookup>
+  801916:	89 c3                	mov    %eax,%ebx
+  801918:	83 c4 10             	add    $0x10,%esp
+  80191b:	85 c0                	test   %eax,%eax
+  80191d:	78 1a                	js     801939 <fd_close+0x77>
+		if (dev->dev_close)
+  80191f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801922:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801925:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80192a:	85 c0                	test   %eax,%eax
+  80192c:	74 0b                	je     801939 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80192e:	83 ec 0c             	sub    $0xc,%esp
+  801931:	56                   	push   %esi
+  801932:	ff d0                	call   *%eax
+  801934:	89 c3                	mov    %eax,%ebx
+  801936:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801939:	83 ec 08             	sub    $0x8,%esp
+  80193c:	56                   	push   %esi
+  80193d:	6a 00                	push   $0x0
+  80193f:	e8 9f f7 ff ff       	call   8010e3 <sys_page_unmap>
+	return r;
+  801944:	83 c4 10             	add    $0x10,%esp
+  801947:	eb b5                	jmp    8018fe <fd_close+0x3c>
+
+00801949 <close>:
+
+int
+close(int fdnum)
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80194f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801952:	50                   	push   %eax
+  801953:	ff 75 08             	push   0x8(%ebp)
+  801956:	e8 c4 fe ff ff       	call   80181f <fd_lookup>
+  80195b:	83 c4 10             	add    $0x10,%esp
+  80195e:	85 c0                	test   %eax,%eax
+  801960:	79 02                	jns    801964 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801962:	c9                   	leave
+  801963:	c3                   	ret
+		return fd_close(fd, 1);
+  801964:	83 ec 08             	sub    $0x8,%esp
+  801967:	6a 01                	push   $0x1
+  801969:	ff 75 f4             	push   -0xc(%ebp)
+  80196c:	e8 51 ff ff ff       	call   8018c2 <fd_close>
+  801971:	83 c4 10             	add    $0x10,%esp
+  801974:	eb ec                	jmp    801962 <close+0x19>
+
+00801976 <close_all>:
+
+void
+close_all(void)
+{
+  801976:	55                   	push   %ebp
+  801977:	89 e5                	mov    %esp,%ebp
+  801979:	53                   	push   %ebx
+  80197a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80197d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801982:	83 ec 0c             	sub    $0xc,%esp
+  801985:	53                   	push   %ebx
+  801986:	e8 be ff ff ff       	call   801949 <close>
+	for (i = 0; i < MAXFD; i++)
+  80198b:	83 c3 01             	add    $0x1,%ebx
+  80198e:	83 c4 10             	add    $0x10,%esp
+  801991:	83 fb 20             	cmp    $0x20,%ebx
+  801994:	75 ec                	jne    801982 <close_all+0xc>
+}
+  801996:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801999:	c9                   	leave
+  80199a:	c3                   	ret
+
+0080199b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80199b:	55                   	push   %ebp
+  80199c:	89 e5                	mov    %esp,%ebp
+  80199e:	57                   	push   %edi
+  80199f:	56                   	push   %esi
+  8019a0:	53                   	push   %ebx
+  8019a1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019a4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019a7:	50                   	push   %eax
+  8019a8:	ff 75 08             	push   0x8(%ebp)
+  8019ab:	e8 6f fe ff ff       	call   80181f <fd_lookup>
+  8019b0:	89 c3                	mov    %eax,%ebx
+  8019b2:	83 c4 10             	add    $0x10,%esp
+  8019b5:	85 c0                	test   %eax,%eax
+  8019b7:	78 7f                	js     801a38 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019b9:	83 ec 0c             	sub    $0xc,%esp
+  8019bc:	ff 75 0c             	push   0xc(%ebp)
+  8019bf:	e8 85 ff ff ff       	call   801949 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019c4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019c7:	c1 e6 0c             	shl    $0xc,%esi
+  8019ca:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019d3:	89 3c 24             	mov    %edi,(%esp)
+  8019d6:	e8 d7 fd ff ff       	call   8017b2 <fd2data>
+  8019db:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019dd:	89 34 24             	mov    %esi,(%esp)
+  8019e0:	e8 cd fd ff ff       	call   8017b2 <fd2data>
+  8019e5:	83 c4 10             	add    $0x10,%esp
+  8019e8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8019eb:	89 d8                	mov    %ebx,%eax
+  8019ed:	c1 e8 16             	shr    $0x16,%eax
+  8019f0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8019f7:	a8 01                	test   $0x1,%al
+  8019f9:	74 11                	je     801a0c <dup+0x71>
+  8019fb:	89 d8                	mov    %ebx,%eax
+  8019fd:	c1 e8 0c             	shr    $0xc,%eax
+  801a00:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a07:	f6 c2 01             	test   $0x1,%dl
+  801a0a:	75 36                	jne    801a42 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a0c:	89 f8                	mov    %edi,%eax
+  801a0e:	c1 e8 0c             	shr    $0xc,%eax
+  801a11:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a18:	83 ec 0c             	sub    $0xc,%esp
+  801a1b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a20:	50                   	push   %eax
+  801a21:	56                   	push   %esi
+  801a22:	6a 00                	push   $0x0
+  801a24:	57                   	push   %edi
+  801a25:	6a 00                	push   $0x0
+  801a27:	e8 75 f6 ff ff       	call   8010a1 <sys_page_map>
+  801a2c:	89 c3                	mov    %eax,%ebx
+  801a2e:	83 c4 20             	add    $0x20,%esp
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	78 33                	js     801a68 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a38:	89 d8                	mov    %ebx,%eax
+  801a3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a3d:	5b                   	pop    %ebx
+  801a3e:	5e                   	pop    %esi
+  801a3f:	5f                   	pop    %edi
+  801a40:	5d                   	pop    %ebp
+  801a41:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a42:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a49:	83 ec 0c             	sub    $0xc,%esp
+  801a4c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a51:	50                   	push   %eax
+  801a52:	ff 75 d4             	push   -0x2c(%ebp)
+  801a55:	6a 00                	push   $0x0
+  801a57:	53                   	push   %ebx
+  801a58:	6a 00                	push   $0x0
+  801a5a:	e8 42 f6 ff ff       	call   8010a1 <sys_page_map>
+  801a5f:	89 c3                	mov    %eax,%ebx
+  801a61:	83 c4 20             	add    $0x20,%esp
+  801a64:	85 c0                	test   %eax,%eax
+  801a66:	79 a4                	jns    801a0c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a68:	83 ec 08             	sub    $0x8,%esp
+  801a6b:	56                   	push   %esi
+  801a6c:	6a 00                	push   $0x0
+  801a6e:	e8 70 f6 ff ff       	call   8010e3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a73:	83 c4 08             	add    $0x8,%esp
+  801a76:	ff 75 d4             	push   -0x2c(%ebp)
+  801a79:	6a 00                	push   $0x0
+  801a7b:	e8 63 f6 ff ff       	call   8010e3 <sys_page_unmap>
+	return r;
+  801a80:	83 c4 10             	add    $0x10,%esp
+  801a83:	eb b3                	jmp    801a38 <dup+0x9d>
+
+00801a85 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a85:	55                   	push   %ebp
+  801a86:	89 e5                	mov    %esp,%ebp
+  801a88:	56                   	push   %esi
+  801a89:	53                   	push   %ebx
+  801a8a:	83 ec 18             	sub    $0x18,%esp
+  801a8d:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a90:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a93:	50                   	push   %eax
+  801a94:	56                   	push   %esi
+  801a95:	e8 85 fd ff ff       	call   80181f <fd_lookup>
+  801a9a:	83 c4 10             	add    $0x10,%esp
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	78 3c                	js     801add <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801aa1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801aa4:	83 ec 08             	sub    $0x8,%esp
+  801aa7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aaa:	50                   	push   %eax
+  801aab:	ff 33                	push   (%ebx)
+  801aad:	e8 bd fd ff ff       	call   80186f <dev_lookup>
+  801ab2:	83 c4 10             	add    $0x10,%esp
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	78 24                	js     801add <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ab9:	8b 43 08             	mov    0x8(%ebx),%eax
+  801abc:	83 e0 03             	and    $0x3,%eax
+  801abf:	83 f8 01             	cmp    $0x1,%eax
+  801ac2:	74 20                	je     801ae4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ac4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ac7:	8b 40 08             	mov    0x8(%eax),%eax
+  801aca:	85 c0                	test   %eax,%eax
+  801acc:	74 37                	je     801b05 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ace:	83 ec 04             	sub    $0x4,%esp
+  801ad1:	ff 75 10             	push   0x10(%ebp)
+  801ad4:	ff 75 0c             	push   0xc(%ebp)
+  801ad7:	53                   	push   %ebx
+  801ad8:	ff d0                	call   *%eax
+  801ada:	83 c4 10             	add    $0x10,%esp
+}
+  801add:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae0:	5b                   	pop    %ebx
+  801ae1:	5e                   	pop    %esi
+  801ae2:	5d                   	pop    %ebp
+  801ae3:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ae4:	a1 08 50 80 00       	mov    0x805008,%eax
+  801ae9:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801aec:	83 ec 04             	sub    $0x4,%esp
+  801aef:	56                   	push   %esi
+  801af0:	50                   	push   %eax
+  801af1:	68 e1 39 80 00       	push   $0x8039e1
+  801af6:	e8 c5 ea ff ff       	call   8005c0 <cprintf>
+		return -E_INVAL;
+  801afb:	83 c4 10             	add    $0x10,%esp
+  801afe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b03:	eb d8                	jmp    801add <read+0x58>
+		return -E_NOT_SUPP;
+  801b05:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b0a:	eb d1                	jmp    801add <read+0x58>
+
+00801b0c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b0c:	55                   	push   %ebp
+  801b0d:	89 e5                	mov    %esp,%ebp
+  801b0f:	57                   	push   %edi
+  801b10:	56                   	push   %esi
+  801b11:	53                   	push   %ebx
+  801b12:	83 ec 0c             	sub    $0xc,%esp
+  801b15:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b18:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b20:	eb 02                	jmp    801b24 <readn+0x18>
+  801b22:	01 c3                	add    %eax,%ebx
+  801b24:	39 f3                	cmp    %esi,%ebx
+  801b26:	73 21                	jae    801b49 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b28:	83 ec 04             	sub    $0x4,%esp
+  801b2b:	89 f0                	mov    %esi,%eax
+  801b2d:	29 d8                	sub    %ebx,%eax
+  801b2f:	50                   	push   %eax
+  801b30:	89 d8                	mov    %ebx,%eax
+  801b32:	03 45 0c             	add    0xc(%ebp),%eax
+  801b35:	50                   	push   %eax
+  801b36:	57                   	push   %edi
+  801b37:	e8 49 ff ff ff       	call   801a85 <read>
+		if (m < 0)
+  801b3c:	83 c4 10             	add    $0x10,%esp
+  801b3f:	85 c0                	test   %eax,%eax
+  801b41:	78 04                	js     801b47 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b43:	75 dd                	jne    801b22 <readn+0x16>
+  801b45:	eb 02                	jmp    801b49 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b47:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b49:	89 d8                	mov    %ebx,%eax
+  801b4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b4e:	5b                   	pop    %ebx
+  801b4f:	5e                   	pop    %esi
+  801b50:	5f                   	pop    %edi
+  801b51:	5d                   	pop    %ebp
+  801b52:	c3                   	ret
+
+00801b53 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b53:	55                   	push   %ebp
+  801b54:	89 e5                	mov    %esp,%ebp
+  801b56:	56                   	push   %esi
+  801b57:	53                   	push   %ebx
+  801b58:	83 ec 18             	sub    $0x18,%esp
+  801b5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b5e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b61:	50                   	push   %eax
+  801b62:	53                   	push   %ebx
+  801b63:	e8 b7 fc ff ff       	call   80181f <fd_lookup>
+  801b68:	83 c4 10             	add    $0x10,%esp
+  801b6b:	85 c0                	test   %eax,%eax
+  801b6d:	78 37                	js     801ba6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b6f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b72:	83 ec 08             	sub    $0x8,%esp
+  801b75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b78:	50                   	push   %eax
+  801b79:	ff 36                	push   (%esi)
+  801b7b:	e8 ef fc ff ff       	call   80186f <dev_lookup>
+  801b80:	83 c4 10             	add    $0x10,%esp
+  801b83:	85 c0                	test   %eax,%eax
+  801b85:	78 1f                	js     801ba6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b87:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b8b:	74 20                	je     801bad <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801b8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b90:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b93:	85 c0                	test   %eax,%eax
+  801b95:	74 37                	je     801bce <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801b97:	83 ec 04             	sub    $0x4,%esp
+  801b9a:	ff 75 10             	push   0x10(%ebp)
+  801b9d:	ff 75 0c             	push   0xc(%ebp)
+  801ba0:	56                   	push   %esi
+  801ba1:	ff d0                	call   *%eax
+  801ba3:	83 c4 10             	add    $0x10,%esp
+}
+  801ba6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba9:	5b                   	pop    %ebx
+  801baa:	5e                   	pop    %esi
+  801bab:	5d                   	pop    %ebp
+  801bac:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bad:	a1 08 50 80 00       	mov    0x805008,%eax
+  801bb2:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801bb5:	83 ec 04             	sub    $0x4,%esp
+  801bb8:	53                   	push   %ebx
+  801bb9:	50                   	push   %eax
+  801bba:	68 fd 39 80 00       	push   $0x8039fd
+  801bbf:	e8 fc e9 ff ff       	call   8005c0 <cprintf>
+		return -E_INVAL;
+  801bc4:	83 c4 10             	add    $0x10,%esp
+  801bc7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bcc:	eb d8                	jmp    801ba6 <write+0x53>
+		return -E_NOT_SUPP;
+  801bce:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bd3:	eb d1                	jmp    801ba6 <write+0x53>
+
+00801bd5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801bd5:	55                   	push   %ebp
+  801bd6:	89 e5                	mov    %esp,%ebp
+  801bd8:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801bdb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bde:	50                   	push   %eax
+  801bdf:	ff 75 08             	push   0x8(%ebp)
+  801be2:	e8 38 fc ff ff       	call   80181f <fd_lookup>
+  801be7:	83 c4 10             	add    $0x10,%esp
+  801bea:	85 c0                	test   %eax,%eax
+  801bec:	78 0e                	js     801bfc <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801bee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bf1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bf4:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bfc:	c9                   	leave
+  801bfd:	c3                   	ret
+
+00801bfe <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801bfe:	55                   	push   %ebp
+  801bff:	89 e5                	mov    %esp,%ebp
+  801c01:	56                   	push   %esi
+  801c02:	53                   	push   %ebx
+  801c03:	83 ec 18             	sub    $0x18,%esp
+  801c06:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c09:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c0c:	50                   	push   %eax
+  801c0d:	53                   	push   %ebx
+  801c0e:	e8 0c fc ff ff       	call   80181f <fd_lookup>
+  801c13:	83 c4 10             	add    $0x10,%esp
+  801c16:	85 c0                	test   %eax,%eax
+  801c18:	78 34                	js     801c4e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c1a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c1d:	83 ec 08             	sub    $0x8,%esp
+  801c20:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c23:	50                   	push   %eax
+  801c24:	ff 36                	push   (%esi)
+  801c26:	e8 44 fc ff ff       	call   80186f <dev_lookup>
+  801c2b:	83 c4 10             	add    $0x10,%esp
+  801c2e:	85 c0                	test   %eax,%eax
+  801c30:	78 1c                	js     801c4e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c32:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c36:	74 1d                	je     801c55 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c3b:	8b 40 18             	mov    0x18(%eax),%eax
+  801c3e:	85 c0                	test   %eax,%eax
+  801c40:	74 34                	je     801c76 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c42:	83 ec 08             	sub    $0x8,%esp
+  801c45:	ff 75 0c             	push   0xc(%ebp)
+  801c48:	56                   	push   %esi
+  801c49:	ff d0                	call   *%eax
+  801c4b:	83 c4 10             	add    $0x10,%esp
+}
+  801c4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c51:	5b                   	pop    %ebx
+  801c52:	5e                   	pop    %esi
+  801c53:	5d                   	pop    %ebp
+  801c54:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801c55:	a1 08 50 80 00       	mov    0x805008,%eax
+  801c5a:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c5d:	83 ec 04             	sub    $0x4,%esp
+  801c60:	53                   	push   %ebx
+  801c61:	50                   	push   %eax
+  801c62:	68 c0 39 80 00       	push   $0x8039c0
+  801c67:	e8 54 e9 ff ff       	call   8005c0 <cprintf>
+		return -E_INVAL;
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c74:	eb d8                	jmp    801c4e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801c76:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c7b:	eb d1                	jmp    801c4e <ftruncate+0x50>
+
+00801c7d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801c7d:	55                   	push   %ebp
+  801c7e:	89 e5                	mov    %esp,%ebp
+  801c80:	56                   	push   %esi
+  801c81:	53                   	push   %ebx
+  801c82:	83 ec 18             	sub    $0x18,%esp
+  801c85:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c88:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c8b:	50                   	push   %eax
+  801c8c:	ff 75 08             	push   0x8(%ebp)
+  801c8f:	e8 8b fb ff ff       	call   80181f <fd_lookup>
+  801c94:	83 c4 10             	add    $0x10,%esp
+  801c97:	85 c0                	test   %eax,%eax
+  801c99:	78 49                	js     801ce4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c9b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c9e:	83 ec 08             	sub    $0x8,%esp
+  801ca1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ca4:	50                   	push   %eax
+  801ca5:	ff 36                	push   (%esi)
+  801ca7:	e8 c3 fb ff ff       	call   80186f <dev_lookup>
+  801cac:	83 c4 10             	add    $0x10,%esp
+  801caf:	85 c0                	test   %eax,%eax
+  801cb1:	78 31                	js     801ce4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801cb3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cb6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801cba:	74 2f                	je     801ceb <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801cbc:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801cbf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801cc6:	00 00 00 
+	stat->st_isdir = 0;
+  801cc9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801cd0:	00 00 00 
+	stat->st_dev = dev;
+  801cd3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801cd9:	83 ec 08             	sub    $0x8,%esp
+  801cdc:	53                   	push   %ebx
+  801cdd:	56                   	push   %esi
+  801cde:	ff 50 14             	call   *0x14(%eax)
+  801ce1:	83 c4 10             	add    $0x10,%esp
+}
+  801ce4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce7:	5b                   	pop    %ebx
+  801ce8:	5e                   	pop    %esi
+  801ce9:	5d                   	pop    %ebp
+  801cea:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ceb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cf0:	eb f2                	jmp    801ce4 <fstat+0x67>
+
+00801cf2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801cf2:	55                   	push   %ebp
+  801cf3:	89 e5                	mov    %esp,%ebp
+  801cf5:	56                   	push   %esi
+  801cf6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801cf7:	83 ec 08             	sub    $0x8,%esp
+  801cfa:	6a 00                	push   $0x0
+  801cfc:	ff 75 08             	push   0x8(%ebp)
+  801cff:	e8 e4 01 00 00       	call   801ee8 <open>
+  801d04:	89 c3                	mov    %eax,%ebx
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	85 c0                	test   %eax,%eax
+  801d0b:	78 1b                	js     801d28 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d0d:	83 ec 08             	sub    $0x8,%esp
+  801d10:	ff 75 0c             	push   0xc(%ebp)
+  801d13:	50                   	push   %eax
+  801d14:	e8 64 ff ff ff       	call   801c7d <fstat>
+  801d19:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d1b:	89 1c 24             	mov    %ebx,(%esp)
+  801d1e:	e8 26 fc ff ff       	call   801949 <close>
+	return r;
+  801d23:	83 c4 10             	add    $0x10,%esp
+  801d26:	89 f3                	mov    %esi,%ebx
+}
+  801d28:	89 d8                	mov    %ebx,%eax
+  801d2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2d:	5b                   	pop    %ebx
+  801d2e:	5e                   	pop    %esi
+  801d2f:	5d                   	pop    %ebp
+  801d30:	c3                   	ret
+
+00801d31 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801d31:	55                   	push   %ebp
+  801d32:	89 e5                	mov    %esp,%ebp
+  801d34:	56                   	push   %esi
+  801d35:	53                   	push   %ebx
+  801d36:	89 c6                	mov    %eax,%esi
+  801d38:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801d3a:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801d41:	74 27                	je     801d6a <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d43:	6a 07                	push   $0x7
+  801d45:	68 00 60 80 00       	push   $0x806000
+  801d4a:	56                   	push   %esi
+  801d4b:	ff 35 00 50 80 00    	push   0x805000
+  801d51:	e8 e1 11 00 00       	call   802f37 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801d56:	83 c4 0c             	add    $0xc,%esp
+  801d59:	6a 00                	push   $0x0
+  801d5b:	53                   	push   %ebx
+  801d5c:	6a 00                	push   $0x0
+  801d5e:	e8 5c 11 00 00       	call   802ebf <ipc_recv>
+}
+  801d63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d66:	5b                   	pop    %ebx
+  801d67:	5e                   	pop    %esi
+  801d68:	5d                   	pop    %ebp
+  801d69:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d6a:	83 ec 0c             	sub    $0xc,%esp
+  801d6d:	6a 01                	push   $0x1
+  801d6f:	e8 17 12 00 00       	call   802f8b <ipc_find_env>
+  801d74:	a3 00 50 80 00       	mov    %eax,0x805000
+  801d79:	83 c4 10             	add    $0x10,%esp
+  801d7c:	eb c5                	jmp    801d43 <fsipc+0x12>
+
+00801d7e <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d7e:	55                   	push   %ebp
+  801d7f:	89 e5                	mov    %esp,%ebp
+  801d81:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d87:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d8a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801d8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d92:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801da1:	e8 8b ff ff ff       	call   801d31 <fsipc>
+}
+  801da6:	c9                   	leave
+  801da7:	c3                   	ret
+
+00801da8 <devfile_flush>:
+{
+  801da8:	55                   	push   %ebp
+  801da9:	89 e5                	mov    %esp,%ebp
+  801dab:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801dae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801db4:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801db9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dbe:	b8 06 00 00 00       	mov    $0x6,%eax
+  801dc3:	e8 69 ff ff ff       	call   801d31 <fsipc>
+}
+  801dc8:	c9                   	leave
+  801dc9:	c3                   	ret
+
+00801dca <devfile_stat>:
+{
+  801dca:	55                   	push   %ebp
+  801dcb:	89 e5                	mov    %esp,%ebp
+  801dcd:	53                   	push   %ebx
+  801dce:	83 ec 04             	sub    $0x4,%esp
+  801dd1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801dd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dda:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ddf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de4:	b8 05 00 00 00       	mov    $0x5,%eax
+  801de9:	e8 43 ff ff ff       	call   801d31 <fsipc>
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	78 2c                	js     801e1e <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801df2:	83 ec 08             	sub    $0x8,%esp
+  801df5:	68 00 60 80 00       	push   $0x806000
+  801dfa:	53                   	push   %ebx
+  801dfb:	e8 ae ed ff ff       	call   800bae <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e00:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e05:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e0b:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e10:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801e16:	83 c4 10             	add    $0x10,%esp
+  801e19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e21:	c9                   	leave
+  801e22:	c3                   	ret
+
+00801e23 <devfile_write>:
+{
+  801e23:	55                   	push   %ebp
+  801e24:	89 e5                	mov    %esp,%ebp
+  801e26:	83 ec 0c             	sub    $0xc,%esp
+  801e29:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801e2c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801e31:	39 d0                	cmp    %edx,%eax
+  801e33:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e36:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e39:	8b 52 0c             	mov    0xc(%edx),%edx
+  801e3c:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801e42:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801e47:	50                   	push   %eax
+  801e48:	ff 75 0c             	push   0xc(%ebp)
+  801e4b:	68 08 60 80 00       	push   $0x806008
+  801e50:	e8 df ee ff ff       	call   800d34 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801e55:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e5a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e5f:	e8 cd fe ff ff       	call   801d31 <fsipc>
+}
+  801e64:	c9                   	leave
+  801e65:	c3                   	ret
+
+00801e66 <devfile_read>:
+{
+  801e66:	55                   	push   %ebp
+  801e67:	89 e5                	mov    %esp,%ebp
+  801e69:	56                   	push   %esi
+  801e6a:	53                   	push   %ebx
+  801e6b:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e71:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e74:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801e79:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e84:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e89:	e8 a3 fe ff ff       	call   801d31 <fsipc>
+  801e8e:	89 c3                	mov    %eax,%ebx
+  801e90:	85 c0                	test   %eax,%eax
+  801e92:	78 1f                	js     801eb3 <devfile_read+0x4d>
+	assert(r <= n);
+  801e94:	39 c6                	cmp    %eax,%esi
+  801e96:	72 24                	jb     801ebc <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801e98:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e9d:	7f 33                	jg     801ed2 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e9f:	83 ec 04             	sub    $0x4,%esp
+  801ea2:	50                   	push   %eax
+  801ea3:	68 00 60 80 00       	push   $0x806000
+  801ea8:	ff 75 0c             	push   0xc(%ebp)
+  801eab:	e8 84 ee ff ff       	call   800d34 <memmove>
+	return r;
+  801eb0:	83 c4 10             	add    $0x10,%esp
+}
+  801eb3:	89 d8                	mov    %ebx,%eax
+  801eb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb8:	5b                   	pop    %ebx
+  801eb9:	5e                   	pop    %esi
+  801eba:	5d                   	pop    %ebp
+  801ebb:	c3                   	ret
+	assert(r <= n);
+  801ebc:	68 30 3a 80 00       	push   $0x803a30
+  801ec1:	68 37 3a 80 00       	push   $0x803a37
+  801ec6:	6a 7c                	push   $0x7c
+  801ec8:	68 4c 3a 80 00       	push   $0x803a4c
+  801ecd:	e8 13 e6 ff ff       	call   8004e5 <_panic>
+	assert(r <= PGSIZE);
+  801ed2:	68 57 3a 80 00       	push   $0x803a57
+  801ed7:	68 37 3a 80 00       	push   $0x803a37
+  801edc:	6a 7d                	push   $0x7d
+  801ede:	68 4c 3a 80 00       	push   $0x803a4c
+  801ee3:	e8 fd e5 ff ff       	call   8004e5 <_panic>
+
+00801ee8 <open>:
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	56                   	push   %esi
+  801eec:	53                   	push   %ebx
+  801eed:	83 ec 1c             	sub    $0x1c,%esp
+  801ef0:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ef3:	56                   	push   %esi
+  801ef4:	e8 7a ec ff ff       	call   800b73 <strlen>
+  801ef9:	83 c4 10             	add    $0x10,%esp
+  801efc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f01:	7f 6c                	jg     801f6f <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f03:	83 ec 0c             	sub    $0xc,%esp
+  801f06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f09:	50                   	push   %eax
+  801f0a:	e8 ba f8 ff ff       	call   8017c9 <fd_alloc>
+  801f0f:	89 c3                	mov    %eax,%ebx
+  801f11:	83 c4 10             	add    $0x10,%esp
+  801f14:	85 c0                	test   %eax,%eax
+  801f16:	78 3c                	js     801f54 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801f18:	83 ec 08             	sub    $0x8,%esp
+  801f1b:	56                   	push   %esi
+  801f1c:	68 00 60 80 00       	push   $0x806000
+  801f21:	e8 88 ec ff ff       	call   800bae <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801f26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f29:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801f2e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f31:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f36:	e8 f6 fd ff ff       	call   801d31 <fsipc>
+  801f3b:	89 c3                	mov    %eax,%ebx
+  801f3d:	83 c4 10             	add    $0x10,%esp
+  801f40:	85 c0                	test   %eax,%eax
+  801f42:	78 19                	js     801f5d <open+0x75>
+	return fd2num(fd);
+  801f44:	83 ec 0c             	sub    $0xc,%esp
+  801f47:	ff 75 f4             	push   -0xc(%ebp)
+  801f4a:	e8 53 f8 ff ff       	call   8017a2 <fd2num>
+  801f4f:	89 c3                	mov    %eax,%ebx
+  801f51:	83 c4 10             	add    $0x10,%esp
+}
+  801f54:	89 d8                	mov    %ebx,%eax
+  801f56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f59:	5b                   	pop    %ebx
+  801f5a:	5e                   	pop    %esi
+  801f5b:	5d                   	pop    %ebp
+  801f5c:	c3                   	ret
+		fd_close(fd, 0);
+  801f5d:	83 ec 08             	sub    $0x8,%esp
+  801f60:	6a 00                	push   $0x0
+  801f62:	ff 75 f4             	push   -0xc(%ebp)
+  801f65:	e8 58 f9 ff ff       	call   8018c2 <fd_close>
+		return r;
+  801f6a:	83 c4 10             	add    $0x10,%esp
+  801f6d:	eb e5                	jmp    801f54 <open+0x6c>
+		return -E_BAD_PATH;
+  801f6f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f74:	eb de                	jmp    801f54 <open+0x6c>
+
+00801f76 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801f76:	55                   	push   %ebp
+  801f77:	89 e5                	mov    %esp,%ebp
+  801f79:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801f7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f81:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f86:	e8 a6 fd ff ff       	call   801d31 <fsipc>
+}
+  801f8b:	c9                   	leave
+  801f8c:	c3                   	ret
+
+00801f8d <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  801f8d:	55                   	push   %ebp
+  801f8e:	89 e5                	mov    %esp,%ebp
+  801f90:	57                   	push   %edi
+  801f91:	56                   	push   %esi
+  801f92:	53                   	push   %ebx
+  801f93:	81 ec 94 02 00 00    	sub    $0x294,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  801f99:	6a 00                	push   $0x0
+  801f9b:	ff 75 08             	push   0x8(%ebp)
+  801f9e:	e8 45 ff ff ff       	call   801ee8 <open>
+  801fa3:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  801fa9:	83 c4 10             	add    $0x10,%esp
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	0f 88 d0 05 00 00    	js     802584 <spawn+0x5f7>
+  801fb4:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801fb6:	83 ec 04             	sub    $0x4,%esp
+  801fb9:	68 00 02 00 00       	push   $0x200
+  801fbe:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801fc4:	50                   	push   %eax
+  801fc5:	51                   	push   %ecx
+  801fc6:	e8 41 fb ff ff       	call   801b0c <readn>
+  801fcb:	83 c4 10             	add    $0x10,%esp
+  801fce:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801fd3:	75 73                	jne    802048 <spawn+0xbb>
+	    || elf->e_magic != ELF_MAGIC) {
+  801fd5:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801fdc:	45 4c 46 
+  801fdf:	75 67                	jne    802048 <spawn+0xbb>
+  801fe1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801fe6:	cd 30                	int    $0x30
+  801fe8:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  801fee:	85 c0                	test   %eax,%eax
+  801ff0:	0f 88 82 05 00 00    	js     802578 <spawn+0x5eb>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  801ff6:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  801ffb:	89 c6                	mov    %eax,%esi
+  801ffd:	c1 e6 09             	shl    $0x9,%esi
+  802000:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802006:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  80200c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802011:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802013:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802019:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  80201f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802024:	be 00 00 00 00       	mov    $0x0,%esi
+  802029:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  80202c:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	74 4d                	je     802080 <spawn+0xf3>
+		string_size += strlen(argv[argc]) + 1;
+  802033:	83 ec 0c             	sub    $0xc,%esp
+  802036:	50                   	push   %eax
+  802037:	e8 37 eb ff ff       	call   800b73 <strlen>
+  80203c:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802040:	83 c3 01             	add    $0x1,%ebx
+  802043:	83 c4 10             	add    $0x10,%esp
+  802046:	eb e4                	jmp    80202c <spawn+0x9f>
+		close(fd);
+  802048:	83 ec 0c             	sub    $0xc,%esp
+  80204b:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  802051:	e8 f3 f8 ff ff       	call   801949 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802056:	83 c4 0c             	add    $0xc,%esp
+  802059:	68 7f 45 4c 46       	push   $0x464c457f
+  80205e:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802064:	68 63 3a 80 00       	push   $0x803a63
+  802069:	e8 52 e5 ff ff       	call   8005c0 <cprintf>
+		return -E_NOT_EXEC;
+  80206e:	83 c4 10             	add    $0x10,%esp
+  802071:	c7 85 80 fd ff ff f2 	movl   $0xfffffff2,-0x280(%ebp)
+  802078:	ff ff ff 
+  80207b:	e9 04 05 00 00       	jmp    802584 <spawn+0x5f7>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802080:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802086:	bf 00 10 40 00       	mov    $0x401000,%edi
+  80208b:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80208d:	89 fa                	mov    %edi,%edx
+  80208f:	83 e2 fc             	and    $0xfffffffc,%edx
+  802092:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802099:	29 c2                	sub    %eax,%edx
+  80209b:	89 95 90 fd ff ff    	mov    %edx,-0x270(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  8020a1:	8d 42 f8             	lea    -0x8(%edx),%eax
+  8020a4:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  8020a9:	0f 86 e3 04 00 00    	jbe    802592 <spawn+0x605>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8020af:	83 ec 04             	sub    $0x4,%esp
+  8020b2:	6a 07                	push   $0x7
+  8020b4:	68 00 00 40 00       	push   $0x400000
+  8020b9:	6a 00                	push   $0x0
+  8020bb:	e8 5b ef ff ff       	call   80101b <sys_page_alloc>
+  8020c0:	83 c4 10             	add    $0x10,%esp
+  8020c3:	85 c0                	test   %eax,%eax
+  8020c5:	0f 88 cc 04 00 00    	js     802597 <spawn+0x60a>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8020cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d0:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  8020d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8020d9:	eb 30                	jmp    80210b <spawn+0x17e>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8020db:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8020e1:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  8020e7:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  8020ea:	83 ec 08             	sub    $0x8,%esp
+  8020ed:	ff 34 b3             	push   (%ebx,%esi,4)
+  8020f0:	57                   	push   %edi
+  8020f1:	e8 b8 ea ff ff       	call   800bae <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8020f6:	83 c4 04             	add    $0x4,%esp
+  8020f9:	ff 34 b3             	push   (%ebx,%esi,4)
+  8020fc:	e8 72 ea ff ff       	call   800b73 <strlen>
+  802101:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  802105:	83 c6 01             	add    $0x1,%esi
+  802108:	83 c4 10             	add    $0x10,%esp
+  80210b:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  802111:	7f c8                	jg     8020db <spawn+0x14e>
+	}
+	argv_store[argc] = 0;
+  802113:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802119:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  80211f:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802126:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  80212c:	0f 85 81 00 00 00    	jne    8021b3 <spawn+0x226>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802132:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  802138:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  80213e:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  802141:	89 c8                	mov    %ecx,%eax
+  802143:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802149:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  80214c:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802151:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802157:	83 ec 0c             	sub    $0xc,%esp
+  80215a:	6a 07                	push   $0x7
+  80215c:	68 00 d0 bf ee       	push   $0xeebfd000
+  802161:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802167:	68 00 00 40 00       	push   $0x400000
+  80216c:	6a 00                	push   $0x0
+  80216e:	e8 2e ef ff ff       	call   8010a1 <sys_page_map>
+  802173:	89 c3                	mov    %eax,%ebx
+  802175:	83 c4 20             	add    $0x20,%esp
+  802178:	85 c0                	test   %eax,%eax
+  80217a:	0f 88 1f 04 00 00    	js     80259f <spawn+0x612>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802180:	83 ec 08             	sub    $0x8,%esp
+  802183:	68 00 00 40 00       	push   $0x400000
+  802188:	6a 00                	push   $0x0
+  80218a:	e8 54 ef ff ff       	call   8010e3 <sys_page_unmap>
+  80218f:	89 c3                	mov    %eax,%ebx
+  802191:	83 c4 10             	add    $0x10,%esp
+  802194:	85 c0                	test   %eax,%eax
+  802196:	0f 88 03 04 00 00    	js     80259f <spawn+0x612>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  80219c:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  8021a2:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8021a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021ae:	e9 87 01 00 00       	jmp    80233a <spawn+0x3ad>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8021b3:	68 d4 3a 80 00       	push   $0x803ad4
+  8021b8:	68 37 3a 80 00       	push   $0x803a37
+  8021bd:	68 f1 00 00 00       	push   $0xf1
+  8021c2:	68 7d 3a 80 00       	push   $0x803a7d
+  8021c7:	e8 19 e3 ff ff       	call   8004e5 <_panic>
+	}
+
+	// from file, as many pages at a time as fit below PFTEMP
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+		for (j = 0; j < n; j += r)
+  8021cc:	01 c6                	add    %eax,%esi
+  8021ce:	39 f3                	cmp    %esi,%ebx
+  8021d0:	7e 4c                	jle    80221e <spawn+0x291>
+			if ((r = sys_page_alloc_range(0, UTEMP + j * PGSIZE, n - j, PTE_P|PTE_U|PTE_W)) < 0)
+  8021d2:	6a 07                	push   $0x7
+  8021d4:	89 d8                	mov    %ebx,%eax
+  8021d6:	29 f0                	sub    %esi,%eax
+  8021d8:	50                   	push   %eax
+  8021d9:	89 f0                	mov    %esi,%eax
+  8021db:	c1 e0 0c             	shl    $0xc,%eax
+  8021de:	05 00 00 40 00       	add    $0x400000,%eax
+  8021e3:	50                   	push   %eax
+  8021e4:	6a 00                	push   $0x0
+  8021e6:	e8 3a ef ff ff       	call   801125 <sys_page_alloc_range>
+  8021eb:	83 c4 10             	add    $0x10,%esp
+  8021ee:	85 c0                	test   %eax,%eax
+  8021f0:	79 da                	jns    8021cc <spawn+0x23f>
+  8021f2:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  8021f4:	83 ec 0c             	sub    $0xc,%esp
+  8021f7:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  8021fd:	e8 39 ed ff ff       	call   800f3b <sys_env_destroy>
+	close(fd);
+  802202:	83 c4 04             	add    $0x4,%esp
+  802205:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  80220b:	e8 39 f7 ff ff       	call   801949 <close>
+	return r;
+  802210:	83 c4 10             	add    $0x10,%esp
+  802213:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  802219:	e9 66 03 00 00       	jmp    802584 <spawn+0x5f7>
+				return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  80221e:	83 ec 08             	sub    $0x8,%esp
+  802221:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  802227:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  80222d:	01 c8                	add    %ecx,%eax
+  80222f:	50                   	push   %eax
+  802230:	8b b5 80 fd ff ff    	mov    -0x280(%ebp),%esi
+  802236:	56                   	push   %esi
+  802237:	e8 99 f9 ff ff       	call   801bd5 <seek>
+  80223c:	83 c4 10             	add    $0x10,%esp
+  80223f:	85 c0                	test   %eax,%eax
+  802241:	0f 88 cd 01 00 00    	js     802414 <spawn+0x487>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  802247:	89 d8                	mov    %ebx,%eax
+  802249:	c1 e0 0c             	shl    $0xc,%eax
+  80224c:	89 85 74 fd ff ff    	mov    %eax,-0x28c(%ebp)
+  802252:	83 ec 04             	sub    $0x4,%esp
+  802255:	39 f8                	cmp    %edi,%eax
+  802257:	0f 46 f8             	cmovbe %eax,%edi
+  80225a:	57                   	push   %edi
+  80225b:	68 00 00 40 00       	push   $0x400000
+  802260:	56                   	push   %esi
+  802261:	e8 a6 f8 ff ff       	call   801b0c <readn>
+  802266:	83 c4 10             	add    $0x10,%esp
+  802269:	85 c0                	test   %eax,%eax
+  80226b:	0f 88 aa 01 00 00    	js     80241b <spawn+0x48e>
+			return r;
+		for (j = 0; j < n; j += r)
+  802271:	be 00 00 00 00       	mov    $0x0,%esi
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  802276:	8b bd 84 fd ff ff    	mov    -0x27c(%ebp),%edi
+  80227c:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802282:	01 c7                	add    %eax,%edi
+		for (j = 0; j < n; j += r)
+  802284:	39 f3                	cmp    %esi,%ebx
+  802286:	7e 4a                	jle    8022d2 <spawn+0x345>
+			if ((r = sys_page_map_range(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), n - j, perm)) < 0)
+  802288:	89 f0                	mov    %esi,%eax
+  80228a:	c1 e0 0c             	shl    $0xc,%eax
+  80228d:	83 ec 08             	sub    $0x8,%esp
+  802290:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802296:	89 da                	mov    %ebx,%edx
+  802298:	29 f2                	sub    %esi,%edx
+  80229a:	52                   	push   %edx
+  80229b:	8d 14 07             	lea    (%edi,%eax,1),%edx
+  80229e:	52                   	push   %edx
+  80229f:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  8022a5:	05 00 00 40 00       	add    $0x400000,%eax
+  8022aa:	50                   	push   %eax
+  8022ab:	6a 00                	push   $0x0
+  8022ad:	e8 96 ee ff ff       	call   801148 <sys_page_map_range>
+  8022b2:	83 c4 20             	add    $0x20,%esp
+  8022b5:	85 c0                	test   %eax,%eax
+  8022b7:	78 04                	js     8022bd <spawn+0x330>
+		for (j = 0; j < n; j += r)
+  8022b9:	01 c6                	add    %eax,%esi
+  8022bb:	eb c7                	jmp    802284 <spawn+0x2f7>
+				panic("spawn: sys_page_map_range data: %e", r);
+  8022bd:	50                   	push   %eax
+  8022be:	68 fc 3a 80 00       	push   $0x803afc
+  8022c3:	68 22 01 00 00       	push   $0x122
+  8022c8:	68 7d 3a 80 00       	push   $0x803a7d
+  8022cd:	e8 13 e2 ff ff       	call   8004e5 <_panic>
+		sys_page_unmap_range(0, UTEMP, n);
+  8022d2:	83 ec 04             	sub    $0x4,%esp
+  8022d5:	53                   	push   %ebx
+  8022d6:	68 00 00 40 00       	push   $0x400000
+  8022db:	6a 00                	push   $0x0
+  8022dd:	e8 eb ee ff ff       	call   8011cd <sys_page_unmap_range>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  8022e2:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  8022e8:	01 8d 8c fd ff ff    	add    %ecx,-0x274(%ebp)
+  8022ee:	83 c4 10             	add    $0x10,%esp
+  8022f1:	e9 c4 00 00 00       	jmp    8023ba <spawn+0x42d>
+	}
+
+	// the rest is zero-filled on demand
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  8022f6:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  8022fc:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  802302:	8b 9d 6c fd ff ff    	mov    -0x294(%ebp),%ebx
+  802308:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  80230e:	39 c8                	cmp    %ecx,%eax
+  802310:	73 22                	jae    802334 <spawn+0x3a7>
+  802312:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802318:	29 c1                	sub    %eax,%ecx
+  80231a:	51                   	push   %ecx
+  80231b:	01 d0                	add    %edx,%eax
+  80231d:	50                   	push   %eax
+  80231e:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802324:	e8 60 ee ff ff       	call   801189 <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802329:	83 c4 10             	add    $0x10,%esp
+  80232c:	85 c0                	test   %eax,%eax
+  80232e:	0f 88 d1 00 00 00    	js     802405 <spawn+0x478>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802334:	83 c3 01             	add    $0x1,%ebx
+  802337:	83 c6 20             	add    $0x20,%esi
+  80233a:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802341:	39 d8                	cmp    %ebx,%eax
+  802343:	0f 8e d9 00 00 00    	jle    802422 <spawn+0x495>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802349:	83 3e 01             	cmpl   $0x1,(%esi)
+  80234c:	75 e6                	jne    802334 <spawn+0x3a7>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  80234e:	8b 46 18             	mov    0x18(%esi),%eax
+  802351:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802354:	83 f8 01             	cmp    $0x1,%eax
+  802357:	19 c0                	sbb    %eax,%eax
+  802359:	83 e0 fe             	and    $0xfffffffe,%eax
+  80235c:	83 c0 07             	add    $0x7,%eax
+  80235f:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802365:	8b 7e 04             	mov    0x4(%esi),%edi
+  802368:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  80236e:	8b 46 10             	mov    0x10(%esi),%eax
+  802371:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802377:	8b 4e 14             	mov    0x14(%esi),%ecx
+  80237a:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  80237d:	89 d0                	mov    %edx,%eax
+  80237f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802384:	74 12                	je     802398 <spawn+0x40b>
+		va -= i;
+  802386:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  802388:	01 c1                	add    %eax,%ecx
+		filesz += i;
+  80238a:	01 85 88 fd ff ff    	add    %eax,-0x278(%ebp)
+		fileoffset -= i;
+  802390:	29 c7                	sub    %eax,%edi
+  802392:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802398:	c7 85 8c fd ff ff 00 	movl   $0x0,-0x274(%ebp)
+  80239f:	00 00 00 
+  8023a2:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  8023a8:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  8023ae:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  8023b4:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  8023ba:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  8023c0:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  8023c6:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  8023cc:	39 c8                	cmp    %ecx,%eax
+  8023ce:	0f 83 22 ff ff ff    	jae    8022f6 <spawn+0x369>
+		n = MIN(ROUNDUP(filesz - i, PGSIZE), PFTEMP - UTEMP) / PGSIZE;
+  8023d4:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  8023da:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  8023e0:	29 c7                	sub    %eax,%edi
+  8023e2:	8d 9f ff 0f 00 00    	lea    0xfff(%edi),%ebx
+  8023e8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8023ee:	b8 00 f0 3f 00       	mov    $0x3ff000,%eax
+  8023f3:	39 c3                	cmp    %eax,%ebx
+  8023f5:	0f 47 d8             	cmova  %eax,%ebx
+  8023f8:	c1 eb 0c             	shr    $0xc,%ebx
+		for (j = 0; j < n; j += r)
+  8023fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802400:	e9 c9 fd ff ff       	jmp    8021ce <spawn+0x241>
+	if (i < memsz && (r = sys_region_reserve(child, (void*) (va + i), memsz - i, perm)) < 0)
+  802405:	ba 00 00 00 00       	mov    $0x0,%edx
+  80240a:	89 d7                	mov    %edx,%edi
+  80240c:	0f 4e f8             	cmovle %eax,%edi
+  80240f:	e9 e0 fd ff ff       	jmp    8021f4 <spawn+0x267>
+  802414:	89 c7                	mov    %eax,%edi
+  802416:	e9 d9 fd ff ff       	jmp    8021f4 <spawn+0x267>
+  80241b:	89 c7                	mov    %eax,%edi
+  80241d:	e9 d2 fd ff ff       	jmp    8021f4 <spawn+0x267>
+	close(fd);
+  802422:	83 ec 0c             	sub    $0xc,%esp
+  802425:	ff b5 80 fd ff ff    	push   -0x280(%ebp)
+  80242b:	e8 19 f5 ff ff       	call   801949 <close>
+  802430:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	uint32_t pn, n;
+	void *va;
+	int perm, r;
+
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  802433:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802438:	e9 82 00 00 00       	jmp    8024bf <spawn+0x532>
+		// in one go.
+		perm = uvpt[pn] & PTE_SYSCALL;
+		while (pn + n < PGNUM(UTOP)
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+			n++;
+  80243d:	83 c6 01             	add    $0x1,%esi
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  802440:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  802445:	74 2e                	je     802475 <spawn+0x4e8>
+		       && (uvpd[PDX((pn + n) << PGSHIFT)] & (PTE_P|PTE_PS)) == PTE_P
+  802447:	89 c2                	mov    %eax,%edx
+  802449:	c1 e2 0c             	shl    $0xc,%edx
+  80244c:	c1 ea 16             	shr    $0x16,%edx
+  80244f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802456:	81 e2 81 00 00 00    	and    $0x81,%edx
+  80245c:	83 fa 01             	cmp    $0x1,%edx
+  80245f:	75 14                	jne    802475 <spawn+0x4e8>
+		       && (uvpt[pn + n] & PTE_SYSCALL) == perm)
+  802461:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802468:	83 c0 01             	add    $0x1,%eax
+  80246b:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  802471:	39 d7                	cmp    %edx,%edi
+  802473:	74 c8                	je     80243d <spawn+0x4b0>
+		if ((r = sys_page_map_range(0, va, child, va, n, perm)) != n)
+  802475:	83 ec 08             	sub    $0x8,%esp
+  802478:	57                   	push   %edi
+  802479:	56                   	push   %esi
+  80247a:	51                   	push   %ecx
+  80247b:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802481:	51                   	push   %ecx
+  802482:	6a 00                	push   $0x0
+  802484:	e8 bf ec ff ff       	call   801148 <sys_page_map_range>
+  802489:	89 c2                	mov    %eax,%edx
+  80248b:	83 c4 20             	add    $0x20,%esp
+  80248e:	39 c6                	cmp    %eax,%esi
+  802490:	74 23                	je     8024b5 <spawn+0x528>
+			panic("sys_page_map_range: %e", r < 0 ? r : -E_NO_MEM);
+  802492:	85 c0                	test   %eax,%eax
+  802494:	78 05                	js     80249b <spawn+0x50e>
+  802496:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80249b:	50                   	push   %eax
+  80249c:	68 89 3a 80 00       	push   $0x803a89
+  8024a1:	68 47 01 00 00       	push   $0x147
+  8024a6:	68 7d 3a 80 00       	push   $0x803a7d
+  8024ab:	e8 35 e0 ff ff       	call   8004e5 <_panic>
+		n = 1;
+  8024b0:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (pn = 0; pn < PGNUM(UTOP); pn += n) {
+  8024b5:	01 d3                	add    %edx,%ebx
+  8024b7:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8024bd:	77 4e                	ja     80250d <spawn+0x580>
+		va = (void *) (pn << PGSHIFT);
+  8024bf:	89 d9                	mov    %ebx,%ecx
+  8024c1:	c1 e1 0c             	shl    $0xc,%ecx
+		if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P)
+  8024c4:	89 c8                	mov    %ecx,%eax
+  8024c6:	c1 e8 16             	shr    $0x16,%eax
+  8024c9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8024d0:	25 81 00 00 00       	and    $0x81,%eax
+  8024d5:	83 f8 01             	cmp    $0x1,%eax
+  8024d8:	75 d6                	jne    8024b0 <spawn+0x523>
+		if (!(uvpt[pn] & PTE_P))
+  8024da:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  8024e1:	83 e2 01             	and    $0x1,%edx
+  8024e4:	74 23                	je     802509 <spawn+0x57c>
+		if (!(uvpt[pn] & PTE_SHARE))
+  8024e6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8024ed:	f6 c4 04             	test   $0x4,%ah
+  8024f0:	74 c3                	je     8024b5 <spawn+0x528>
+		perm = uvpt[pn] & PTE_SYSCALL;
+  8024f2:	8b 3c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edi
+  8024f9:	81 e7 07 0e 00 00    	and    $0xe07,%edi
+		while (pn + n < PGNUM(UTOP)
+  8024ff:	8d 43 01             	lea    0x1(%ebx),%eax
+		n = 1;
+  802502:	89 d6                	mov    %edx,%esi
+		while (pn + n < PGNUM(UTOP)
+  802504:	e9 37 ff ff ff       	jmp    802440 <spawn+0x4b3>
+		n = 1;
+  802509:	89 c2                	mov    %eax,%edx
+  80250b:	eb a8                	jmp    8024b5 <spawn+0x528>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80250d:	83 ec 08             	sub    $0x8,%esp
+  802510:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802516:	50                   	push   %eax
+  802517:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  80251d:	e8 b2 ed ff ff       	call   8012d4 <sys_env_set_trapframe>
+  802522:	83 c4 10             	add    $0x10,%esp
+  802525:	85 c0                	test   %eax,%eax
+  802527:	78 25                	js     80254e <spawn+0x5c1>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802529:	83 ec 08             	sub    $0x8,%esp
+  80252c:	6a 02                	push   $0x2
+  80252e:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802534:	e8 b6 ec ff ff       	call   8011ef <sys_env_set_status>
+  802539:	83 c4 10             	add    $0x10,%esp
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	78 23                	js     802563 <spawn+0x5d6>
+	return child;
+  802540:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802546:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  80254c:	eb 36                	jmp    802584 <spawn+0x5f7>
+		panic("sys_env_set_trapframe: %e", r);
+  80254e:	50                   	push   %eax
+  80254f:	68 a0 3a 80 00       	push   $0x803aa0
+  802554:	68 85 00 00 00       	push   $0x85
+  802559:	68 7d 3a 80 00       	push   $0x803a7d
+  80255e:	e8 82 df ff ff       	call   8004e5 <_panic>
+		panic("sys_env_set_status: %e", r);
+  802563:	50                   	push   %eax
+  802564:	68 ba 3a 80 00       	push   $0x803aba
+  802569:	68 88 00 00 00       	push   $0x88
+  80256e:	68 7d 3a 80 00       	push   $0x803a7d
+  802573:	e8 6d df ff ff       	call   8004e5 <_panic>
+		return r;
+  802578:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  80257e:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+}
+  802584:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  80258a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80258d:	5b                   	pop    %ebx
+  80258e:	5e                   	pop    %esi
+  80258f:	5f                   	pop    %edi
+  802590:	5d                   	pop    %ebp
+  802591:	c3                   	ret
+		return -E_NO_MEM;
+  802592:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802597:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  80259d:	eb e5                	jmp    802584 <spawn+0x5f7>
+	sys_page_unmap(0, UTEMP);
+  80259f:	83 ec 08             	sub    $0x8,%esp
+  8025a2:	68 00 00 40 00       	push   $0x400000
+  8025a7:	6a 00                	push   $0x0
+  8025a9:	e8 35 eb ff ff       	call   8010e3 <sys_page_unmap>
+  8025ae:	83 c4 10             	add    $0x10,%esp
+  8025b1:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  8025b7:	eb cb                	jmp    802584 <spawn+0x5f7>
+
+008025b9 <spawnl>:
+{
+  8025b9:	55                   	push   %ebp
+  8025ba:	89 e5                	mov    %esp,%ebp
+  8025bc:	56                   	push   %esi
+  8025bd:	53                   	push   %ebx
+	va_start(vl, arg0);
+  8025be:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  8025c1:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  8025c6:	eb 05                	jmp    8025cd <spawnl+0x14>
+		argc++;
+  8025c8:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  8025cb:	89 ca                	mov    %ecx,%edx
+  8025cd:	8d 4a 04             	lea    0x4(%edx),%ecx
+  8025d0:	83 3a 00             	cmpl   $0x0,(%edx)
+  8025d3:	75 f3                	jne    8025c8 <spawnl+0xf>
+	const char *argv[argc+2];
+  8025d5:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  8025dc:	83 e2 f0             	and    $0xfffffff0,%edx
+  8025df:	29 d4                	sub    %edx,%esp
+  8025e1:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  8025e5:	89 da                	mov    %ebx,%edx
+  8025e7:	c1 ea 02             	shr    $0x2,%edx
+  8025ea:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  8025ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025f0:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  8025f7:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  8025fe:	00 
+	va_start(vl, arg0);
+  8025ff:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802602:	89 c2                	mov    %eax,%edx
+  802604:	b8 00 00 00 00       	mov    $0x0,%eax
+  802609:	eb 0b                	jmp    802616 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  80260b:	83 c0 01             	add    $0x1,%eax
+  80260e:	8b 31                	mov    (%ecx),%esi
+  802610:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802613:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802616:	39 d0                	cmp    %edx,%eax
+  802618:	75 f1                	jne    80260b <spawnl+0x52>
+	return spawn(prog, argv);
+  80261a:	83 ec 08             	sub    $0x8,%esp
+  80261d:	53                   	push   %ebx
+  80261e:	ff 75 08             	push   0x8(%ebp)
+  802621:	e8 67 f9 ff ff       	call   801f8d <spawn>
+}
+  802626:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802629:	5b                   	pop    %ebx
+  80262a:	5e                   	pop    %esi
+  80262b:	5d                   	pop    %ebp
+  80262c:	c3                   	ret
+
+0080262d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80262d:	55                   	push   %ebp
+  80262e:	89 e5                	mov    %esp,%ebp
+  802630:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802633:	68 1f 3b 80 00       	push   $0x803b1f
+  802638:	ff 75 0c             	push   0xc(%ebp)
+  80263b:	e8 6e e5 ff ff       	call   800bae <strcpy>
+	return 0;
+}
+  802640:	b8 00 00 00 00       	mov    $0x0,%eax
+  802645:	c9                   	leave
+  802646:	c3                   	ret
+
+00802647 <devsock_close>:
+{
+  802647:	55                   	push   %ebp
+  802648:	89 e5                	mov    %esp,%ebp
+  80264a:	53                   	push   %ebx
+  80264b:	83 ec 10             	sub    $0x10,%esp
+  80264e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802651:	53                   	push   %ebx
+  802652:	e8 44 09 00 00       	call   802f9b <pageref>
+  802657:	89 c2                	mov    %eax,%edx
+  802659:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80265c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802661:	83 fa 01             	cmp    $0x1,%edx
+  802664:	74 05                	je     80266b <devsock_close+0x24>
+}
+  802666:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802669:	c9                   	leave
+  80266a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80266b:	83 ec 0c             	sub    $0xc,%esp
+  80266e:	ff 73 0c             	push   0xc(%ebx)
+  802671:	e8 b7 02 00 00       	call   80292d <nsipc_close>
+  802676:	83 c4 10             	add    $0x10,%esp
+  802679:	eb eb                	jmp    802666 <devsock_close+0x1f>
+
+0080267b <devsock_write>:
+{
+  80267b:	55                   	push   %ebp
+  80267c:	89 e5                	mov    %esp,%ebp
+  80267e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802681:	6a 00                	push   $0x0
+  802683:	ff 75 10             	push   0x10(%ebp)
+  802686:	ff 75 0c             	push   0xc(%ebp)
+  802689:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268c:	ff 70 0c             	push   0xc(%eax)
+  80268f:	e8 79 03 00 00       	call   802a0d <nsipc_send>
+}
+  802694:	c9                   	leave
+  802695:	c3                   	ret
+
+00802696 <devsock_read>:
+{
+  802696:	55                   	push   %ebp
+  802697:	89 e5                	mov    %esp,%ebp
+  802699:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80269c:	6a 00                	push   $0x0
+  80269e:	ff 75 10             	push   0x10(%ebp)
+  8026a1:	ff 75 0c             	push   0xc(%ebp)
+  8026a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a7:	ff 70 0c             	push   0xc(%eax)
+  8026aa:	e8 ef 02 00 00       	call   80299e <nsipc_recv>
+}
+  8026af:	c9                   	leave
+  8026b0:	c3                   	ret
+
+008026b1 <fd2sockid>:
+{
+  8026b1:	55                   	push   %ebp
+  8026b2:	89 e5                	mov    %esp,%ebp
+  8026b4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8026b7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026ba:	52                   	push   %edx
+  8026bb:	50                   	push   %eax
+  8026bc:	e8 5e f1 ff ff       	call   80181f <fd_lookup>
+  8026c1:	83 c4 10             	add    $0x10,%esp
+  8026c4:	85 c0                	test   %eax,%eax
+  8026c6:	78 10                	js     8026d8 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8026c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026cb:	8b 0d 3c 40 80 00    	mov    0x80403c,%ecx
+  8026d1:	39 08                	cmp    %ecx,(%eax)
+  8026d3:	75 05                	jne    8026da <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8026d5:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8026d8:	c9                   	leave
+  8026d9:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026da:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026df:	eb f7                	jmp    8026d8 <fd2sockid+0x27>
+
+008026e1 <alloc_sockfd>:
+{
+  8026e1:	55                   	push   %ebp
+  8026e2:	89 e5                	mov    %esp,%ebp
+  8026e4:	56                   	push   %esi
+  8026e5:	53                   	push   %ebx
+  8026e6:	83 ec 1c             	sub    $0x1c,%esp
+  8026e9:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8026eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026ee:	50                   	push   %eax
+  8026ef:	e8 d5 f0 ff ff       	call   8017c9 <fd_alloc>
+  8026f4:	89 c3                	mov    %eax,%ebx
+  8026f6:	83 c4 10             	add    $0x10,%esp
+  8026f9:	85 c0                	test   %eax,%eax
+  8026fb:	78 43                	js     802740 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8026fd:	83 ec 04             	sub    $0x4,%esp
+  802700:	68 07 04 00 00       	push   $0x407
+  802705:	ff 75 f4             	push   -0xc(%ebp)
+  802708:	6a 00                	push   $0x0
+  80270a:	e8 0c e9 ff ff       	call   80101b <sys_page_alloc>
+  80270f:	89 c3                	mov    %eax,%ebx
+  802711:	83 c4 10             	add    $0x10,%esp
+  802714:	85 c0                	test   %eax,%eax
+  802716:	78 28                	js     802740 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802718:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80271b:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802721:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802723:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802726:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80272d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802730:	83 ec 0c             	sub    $0xc,%esp
+  802733:	50                   	push   %eax
+  802734:	e8 69 f0 ff ff       	call   8017a2 <fd2num>
+  802739:	89 c3                	mov    %eax,%ebx
+  80273b:	83 c4 10             	add    $0x10,%esp
+  80273e:	eb 0c                	jmp    80274c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802740:	83 ec 0c             	sub    $0xc,%esp
+  802743:	56                   	push   %esi
+  802744:	e8 e4 01 00 00       	call   80292d <nsipc_close>
+		return r;
+  802749:	83 c4 10             	add    $0x10,%esp
+}
+  80274c:	89 d8                	mov    %ebx,%eax
+  80274e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802751:	5b                   	pop    %ebx
+  802752:	5e                   	pop    %esi
+  802753:	5d                   	pop    %ebp
+  802754:	c3                   	ret
+
+00802755 <accept>:
+{
+  802755:	55                   	push   %ebp
+  802756:	89 e5                	mov    %esp,%ebp
+  802758:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80275b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80275e:	e8 4e ff ff ff       	call   8026b1 <fd2sockid>
+  802763:	85 c0                	test   %eax,%eax
+  802765:	78 1b                	js     802782 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802767:	83 ec 04             	sub    $0x4,%esp
+  80276a:	ff 75 10             	push   0x10(%ebp)
+  80276d:	ff 75 0c             	push   0xc(%ebp)
+  802770:	50                   	push   %eax
+  802771:	e8 0e 01 00 00       	call   802884 <nsipc_accept>
+  802776:	83 c4 10             	add    $0x10,%esp
+  802779:	85 c0                	test   %eax,%eax
+  80277b:	78 05                	js     802782 <accept+0x2d>
+	return alloc_sockfd(r);
+  80277d:	e8 5f ff ff ff       	call   8026e1 <alloc_sockfd>
+}
+  802782:	c9                   	leave
+  802783:	c3                   	ret
+
+00802784 <bind>:
+{
+  802784:	55                   	push   %ebp
+  802785:	89 e5                	mov    %esp,%ebp
+  802787:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80278a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278d:	e8 1f ff ff ff       	call   8026b1 <fd2sockid>
+  802792:	85 c0                	test   %eax,%eax
+  802794:	78 12                	js     8027a8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802796:	83 ec 04             	sub    $0x4,%esp
+  802799:	ff 75 10             	push   0x10(%ebp)
+  80279c:	ff 75 0c             	push   0xc(%ebp)
+  80279f:	50                   	push   %eax
+  8027a0:	e8 31 01 00 00       	call   8028d6 <nsipc_bind>
+  8027a5:	83 c4 10             	add    $0x10,%esp
+}
+  8027a8:	c9                   	leave
+  8027a9:	c3                   	ret
+
+008027aa <shutdown>:
+{
+  8027aa:	55                   	push   %ebp
+  8027ab:	89 e5                	mov    %esp,%ebp
+  8027ad:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027b3:	e8 f9 fe ff ff       	call   8026b1 <fd2sockid>
+  8027b8:	85 c0                	test   %eax,%eax
+  8027ba:	78 0f                	js     8027cb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8027bc:	83 ec 08             	sub    $0x8,%esp
+  8027bf:	ff 75 0c             	push   0xc(%ebp)
+  8027c2:	50                   	push   %eax
+  8027c3:	e8 43 01 00 00       	call   80290b <nsipc_shutdown>
+  8027c8:	83 c4 10             	add    $0x10,%esp
+}
+  8027cb:	c9                   	leave
+  8027cc:	c3                   	ret
+
+008027cd <connect>:
+{
+  8027cd:	55                   	push   %ebp
+  8027ce:	89 e5                	mov    %esp,%ebp
+  8027d0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d6:	e8 d6 fe ff ff       	call   8026b1 <fd2sockid>
+  8027db:	85 c0                	test   %eax,%eax
+  8027dd:	78 12                	js     8027f1 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8027df:	83 ec 04             	sub    $0x4,%esp
+  8027e2:	ff 75 10             	push   0x10(%ebp)
+  8027e5:	ff 75 0c             	push   0xc(%ebp)
+  8027e8:	50                   	push   %eax
+  8027e9:	e8 59 01 00 00       	call   802947 <nsipc_connect>
+  8027ee:	83 c4 10             	add    $0x10,%esp
+}
+  8027f1:	c9                   	leave
+  8027f2:	c3                   	ret
+
+008027f3 <listen>:
+{
+  8027f3:	55                   	push   %ebp
+  8027f4:	89 e5                	mov    %esp,%ebp
+  8027f6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027fc:	e8 b0 fe ff ff       	call   8026b1 <fd2sockid>
+  802801:	85 c0                	test   %eax,%eax
+  802803:	78 0f                	js     802814 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802805:	83 ec 08             	sub    $0x8,%esp
+  802808:	ff 75 0c             	push   0xc(%ebp)
+  80280b:	50                   	push   %eax
+  80280c:	e8 6b 01 00 00       	call   80297c <nsipc_listen>
+  802811:	83 c4 10             	add    $0x10,%esp
+}
+  802814:	c9                   	leave
+  802815:	c3                   	ret
+
+00802816 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80281c:	ff 75 10             	push   0x10(%ebp)
+  80281f:	ff 75 0c             	push   0xc(%ebp)
+  802822:	ff 75 08             	push   0x8(%ebp)
+  802825:	e8 41 02 00 00       	call   802a6b <nsipc_socket>
+  80282a:	83 c4 10             	add    $0x10,%esp
+  80282d:	85 c0                	test   %eax,%eax
+  80282f:	78 05                	js     802836 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802831:	e8 ab fe ff ff       	call   8026e1 <alloc_sockfd>
+}
+  802836:	c9                   	leave
+  802837:	c3                   	ret
+
+00802838 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802838:	55                   	push   %ebp
+  802839:	89 e5                	mov    %esp,%ebp
+  80283b:	53                   	push   %ebx
+  80283c:	83 ec 04             	sub    $0x4,%esp
+  80283f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802841:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802848:	74 26                	je     802870 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80284a:	6a 07                	push   $0x7
+  80284c:	68 00 70 80 00       	push   $0x807000
+  802851:	53                   	push   %ebx
+  802852:	ff 35 04 50 80 00    	push   0x805004
+  802858:	e8 da 06 00 00       	call   802f37 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80285d:	83 c4 0c             	add    $0xc,%esp
+  802860:	6a 00                	push   $0x0
+  802862:	6a 00                	push   $0x0
+  802864:	6a 00                	push   $0x0
+  802866:	e8 54 06 00 00       	call   802ebf <ipc_recv>
+}
+  80286b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80286e:	c9                   	leave
+  80286f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802870:	83 ec 0c             	sub    $0xc,%esp
+  802873:	6a 02                	push   $0x2
+  802875:	e8 11 07 00 00       	call   802f8b <ipc_find_env>
+  80287a:	a3 04 50 80 00       	mov    %eax,0x805004
+  80287f:	83 c4 10             	add    $0x10,%esp
+  802882:	eb c6                	jmp    80284a <nsipc+0x12>
+
+00802884 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802884:	55                   	push   %ebp
+  802885:	89 e5                	mov    %esp,%ebp
+  802887:	56                   	push   %esi
+  802888:	53                   	push   %ebx
+  802889:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80288c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802894:	8b 06                	mov    (%esi),%eax
+  802896:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80289b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028a0:	e8 93 ff ff ff       	call   802838 <nsipc>
+  8028a5:	89 c3                	mov    %eax,%ebx
+  8028a7:	85 c0                	test   %eax,%eax
+  8028a9:	79 09                	jns    8028b4 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8028ab:	89 d8                	mov    %ebx,%eax
+  8028ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028b0:	5b                   	pop    %ebx
+  8028b1:	5e                   	pop    %esi
+  8028b2:	5d                   	pop    %ebp
+  8028b3:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8028b4:	83 ec 04             	sub    $0x4,%esp
+  8028b7:	ff 35 10 70 80 00    	push   0x807010
+  8028bd:	68 00 70 80 00       	push   $0x807000
+  8028c2:	ff 75 0c             	push   0xc(%ebp)
+  8028c5:	e8 6a e4 ff ff       	call   800d34 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8028ca:	a1 10 70 80 00       	mov    0x807010,%eax
+  8028cf:	89 06                	mov    %eax,(%esi)
+  8028d1:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8028d4:	eb d5                	jmp    8028ab <nsipc_accept+0x27>
+
+008028d6 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	53                   	push   %ebx
+  8028da:	83 ec 08             	sub    $0x8,%esp
+  8028dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8028e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e3:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8028e8:	53                   	push   %ebx
+  8028e9:	ff 75 0c             	push   0xc(%ebp)
+  8028ec:	68 04 70 80 00       	push   $0x807004
+  8028f1:	e8 3e e4 ff ff       	call   800d34 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8028f6:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8028fc:	b8 02 00 00 00       	mov    $0x2,%eax
+  802901:	e8 32 ff ff ff       	call   802838 <nsipc>
+}
+  802906:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802909:	c9                   	leave
+  80290a:	c3                   	ret
+
+0080290b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80290b:	55                   	push   %ebp
+  80290c:	89 e5                	mov    %esp,%ebp
+  80290e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802911:	8b 45 08             	mov    0x8(%ebp),%eax
+  802914:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802919:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80291c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802921:	b8 03 00 00 00       	mov    $0x3,%eax
+  802926:	e8 0d ff ff ff       	call   802838 <nsipc>
+}
+  80292b:	c9                   	leave
+  80292c:	c3                   	ret
+
+0080292d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80292d:	55                   	push   %ebp
+  80292e:	89 e5                	mov    %esp,%ebp
+  802930:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802933:	8b 45 08             	mov    0x8(%ebp),%eax
+  802936:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80293b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802940:	e8 f3 fe ff ff       	call   802838 <nsipc>
+}
+  802945:	c9                   	leave
+  802946:	c3                   	ret
+
+00802947 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802947:	55                   	push   %ebp
+  802948:	89 e5                	mov    %esp,%ebp
+  80294a:	53                   	push   %ebx
+  80294b:	83 ec 08             	sub    $0x8,%esp
+  80294e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802951:	8b 45 08             	mov    0x8(%ebp),%eax
+  802954:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802959:	53                   	push   %ebx
+  80295a:	ff 75 0c             	push   0xc(%ebp)
+  80295d:	68 04 70 80 00       	push   $0x807004
+  802962:	e8 cd e3 ff ff       	call   800d34 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802967:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80296d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802972:	e8 c1 fe ff ff       	call   802838 <nsipc>
+}
+  802977:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80297a:	c9                   	leave
+  80297b:	c3                   	ret
+
+0080297c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80297c:	55                   	push   %ebp
+  80297d:	89 e5                	mov    %esp,%ebp
+  80297f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802982:	8b 45 08             	mov    0x8(%ebp),%eax
+  802985:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80298a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80298d:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802992:	b8 06 00 00 00       	mov    $0x6,%eax
+  802997:	e8 9c fe ff ff       	call   802838 <nsipc>
+}
+  80299c:	c9                   	leave
+  80299d:	c3                   	ret
+
+0080299e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80299e:	55                   	push   %ebp
+  80299f:	89 e5                	mov    %esp,%ebp
+  8029a1:	56                   	push   %esi
+  8029a2:	53                   	push   %ebx
+  8029a3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8029a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8029ae:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8029b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029b7:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8029bc:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029c1:	e8 72 fe ff ff       	call   802838 <nsipc>
+  8029c6:	89 c3                	mov    %eax,%ebx
+  8029c8:	85 c0                	test   %eax,%eax
+  8029ca:	78 22                	js     8029ee <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8029cc:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8029d1:	39 c6                	cmp    %eax,%esi
+  8029d3:	0f 4e c6             	cmovle %esi,%eax
+  8029d6:	39 c3                	cmp    %eax,%ebx
+  8029d8:	7f 1d                	jg     8029f7 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8029da:	83 ec 04             	sub    $0x4,%esp
+  8029dd:	53                   	push   %ebx
+  8029de:	68 00 70 80 00       	push   $0x807000
+  8029e3:	ff 75 0c             	push   0xc(%ebp)
+  8029e6:	e8 49 e3 ff ff       	call   800d34 <memmove>
+  8029eb:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8029ee:	89 d8                	mov    %ebx,%eax
+  8029f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029f3:	5b                   	pop    %ebx
+  8029f4:	5e                   	pop    %esi
+  8029f5:	5d                   	pop    %ebp
+  8029f6:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8029f7:	68 2b 3b 80 00       	push   $0x803b2b
+  8029fc:	68 37 3a 80 00       	push   $0x803a37
+  802a01:	6a 62                	push   $0x62
+  802a03:	68 40 3b 80 00       	push   $0x803b40
+  802a08:	e8 d8 da ff ff       	call   8004e5 <_panic>
+
+00802a0d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802a0d:	55                   	push   %ebp
+  802a0e:	89 e5                	mov    %esp,%ebp
+  802a10:	53                   	push   %ebx
+  802a11:	83 ec 04             	sub    $0x4,%esp
+  802a14:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802a17:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1a:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802a1f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802a25:	7f 2e                	jg     802a55 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802a27:	83 ec 04             	sub    $0x4,%esp
+  802a2a:	53                   	push   %ebx
+  802a2b:	ff 75 0c             	push   0xc(%ebp)
+  802a2e:	68 0c 70 80 00       	push   $0x80700c
+  802a33:	e8 fc e2 ff ff       	call   800d34 <memmove>
+	nsipcbuf.send.req_size = size;
+  802a38:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802a3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a41:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802a46:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a4b:	e8 e8 fd ff ff       	call   802838 <nsipc>
+}
+  802a50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a53:	c9                   	leave
+  802a54:	c3                   	ret
+	assert(size < 1600);
+  802a55:	68 4c 3b 80 00       	push   $0x803b4c
+  802a5a:	68 37 3a 80 00       	push   $0x803a37
+  802a5f:	6a 6d                	push   $0x6d
+  802a61:	68 40 3b 80 00       	push   $0x803b40
+  802a66:	e8 7a da ff ff       	call   8004e5 <_panic>
+
+00802a6b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a6b:	55                   	push   %ebp
+  802a6c:	89 e5                	mov    %esp,%ebp
+  802a6e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a74:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a7c:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802a81:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a84:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802a89:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a8e:	e8 a5 fd ff ff       	call   802838 <nsipc>
+}
+  802a93:	c9                   	leave
+  802a94:	c3                   	ret
+
+00802a95 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a95:	55                   	push   %ebp
+  802a96:	89 e5                	mov    %esp,%ebp
+  802a98:	56                   	push   %esi
+  802a99:	53                   	push   %ebx
+  802a9a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802a9d:	83 ec 0c             	sub    $0xc,%esp
+  802aa0:	ff 75 08             	push   0x8(%ebp)
+  802aa3:	e8 0a ed ff ff       	call   8017b2 <fd2data>
+  802aa8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802aaa:	83 c4 08             	add    $0x8,%esp
+  802aad:	68 58 3b 80 00       	push   $0x803b58
+  802ab2:	53                   	push   %ebx
+  802ab3:	e8 f6 e0 ff ff       	call   800bae <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802ab8:	8b 46 04             	mov    0x4(%esi),%eax
+  802abb:	2b 06                	sub    (%esi),%eax
+  802abd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802ac3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802aca:	00 00 00 
+	stat->st_dev = &devpipe;
+  802acd:	c7 83 88 00 00 00 58 	movl   $0x804058,0x88(%ebx)
+  802ad4:	40 80 00 
+	return 0;
+}
+  802ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802adc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802adf:	5b                   	pop    %ebx
+  802ae0:	5e                   	pop    %esi
+  802ae1:	5d                   	pop    %ebp
+  802ae2:	c3                   	ret
+
+00802ae3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ae3:	55                   	push   %ebp
+  802ae4:	89 e5                	mov    %esp,%ebp
+  802ae6:	53                   	push   %ebx
+  802ae7:	83 ec 0c             	sub    $0xc,%esp
+  802aea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802aed:	53                   	push   %ebx
+  802aee:	6a 00                	push   $0x0
+  802af0:	e8 ee e5 ff ff       	call   8010e3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802af5:	89 1c 24             	mov    %ebx,(%esp)
+  802af8:	e8 b5 ec ff ff       	call   8017b2 <fd2data>
+  802afd:	83 c4 08             	add    $0x8,%esp
+  802b00:	50                   	push   %eax
+  802b01:	6a 00                	push   $0x0
+  802b03:	e8 db e5 ff ff       	call   8010e3 <sys_page_unmap>
+}
+  802b08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b0b:	c9                   	leave
+  802b0c:	c3                   	ret
+
+00802b0d <_pipeisclosed>:
+{
+  802b0d:	55                   	push   %ebp
+  802b0e:	89 e5                	mov    %esp,%ebp
+  802b10:	57                   	push   %edi
+  802b11:	56                   	push   %esi
+  802b12:	53                   	push   %ebx
+  802b13:	83 ec 1c             	sub    $0x1c,%esp
+  802b16:	89 c7                	mov    %eax,%edi
+  802b18:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802b1a:	a1 08 50 80 00       	mov    0x805008,%eax
+  802b1f:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802b22:	83 ec 0c             	sub    $0xc,%esp
+  802b25:	57                   	push   %edi
+  802b26:	e8 70 04 00 00       	call   802f9b <pageref>
+  802b2b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b2e:	89 34 24             	mov    %esi,(%esp)
+  802b31:	e8 65 04 00 00       	call   802f9b <pageref>
+		nn = thisenv->env_runs;
+  802b36:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802b3c:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  802b3f:	83 c4 10             	add    $0x10,%esp
+  802b42:	39 cb                	cmp    %ecx,%ebx
+  802b44:	74 1b                	je     802b61 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802b46:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b49:	75 cf                	jne    802b1a <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802b4b:	8b 42 5c             	mov    0x5c(%edx),%eax
+  802b4e:	6a 01                	push   $0x1
+  802b50:	50                   	push   %eax
+  802b51:	53                   	push   %ebx
+  802b52:	68 5f 3b 80 00       	push   $0x803b5f
+  802b57:	e8 64 da ff ff       	call   8005c0 <cprintf>
+  802b5c:	83 c4 10             	add    $0x10,%esp
+  802b5f:	eb b9                	jmp    802b1a <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802b61:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b64:	0f 94 c0             	sete   %al
+  802b67:	0f b6 c0             	movzbl %al,%eax
+}
+  802b6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b6d:	5b                   	pop    %ebx
+  802b6e:	5e                   	pop    %esi
+  802b6f:	5f                   	pop    %edi
+  802b70:	5d                   	pop    %ebp
+  802b71:	c3                   	ret
+
+00802b72 <devpipe_write>:
+{
+  802b72:	55                   	push   %ebp
+  802b73:	89 e5                	mov    %esp,%ebp
+  802b75:	57                   	push   %edi
+  802b76:	56                   	push   %esi
+  802b77:	53                   	push   %ebx
+  802b78:	83 ec 28             	sub    $0x28,%esp
+  802b7b:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802b7e:	56                   	push   %esi
+  802b7f:	e8 2e ec ff ff       	call   8017b2 <fd2data>
+  802b84:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802b86:	83 c4 10             	add    $0x10,%esp
+  802b89:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b8e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802b91:	75 09                	jne    802b9c <devpipe_write+0x2a>
+	return i;
+  802b93:	89 f8                	mov    %edi,%eax
+  802b95:	eb 23                	jmp    802bba <devpipe_write+0x48>
+			sys_yield();
+  802b97:	e8 ff e3 ff ff       	call   800f9b <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802b9c:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b9f:	8b 0b                	mov    (%ebx),%ecx
+  802ba1:	8d 51 20             	lea    0x20(%ecx),%edx
+  802ba4:	39 d0                	cmp    %edx,%eax
+  802ba6:	72 1a                	jb     802bc2 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802ba8:	89 da                	mov    %ebx,%edx
+  802baa:	89 f0                	mov    %esi,%eax
+  802bac:	e8 5c ff ff ff       	call   802b0d <_pipeisclosed>
+  802bb1:	85 c0                	test   %eax,%eax
+  802bb3:	74 e2                	je     802b97 <devpipe_write+0x25>
+				return 0;
+  802bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bbd:	5b                   	pop    %ebx
+  802bbe:	5e                   	pop    %esi
+  802bbf:	5f                   	pop    %edi
+  802bc0:	5d                   	pop    %ebp
+  802bc1:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802bc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bc5:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802bc9:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802bcc:	89 c2                	mov    %eax,%edx
+  802bce:	c1 fa 1f             	sar    $0x1f,%edx
+  802bd1:	89 d1                	mov    %edx,%ecx
+  802bd3:	c1 e9 1b             	shr    $0x1b,%ecx
+  802bd6:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802bd9:	83 e2 1f             	and    $0x1f,%edx
+  802bdc:	29 ca                	sub    %ecx,%edx
+  802bde:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802be2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802be6:	83 c0 01             	add    $0x1,%eax
+  802be9:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802bec:	83 c7 01             	add    $0x1,%edi
+  802bef:	eb 9d                	jmp    802b8e <devpipe_write+0x1c>
+
+00802bf1 <devpipe_read>:
+{
+  802bf1:	55                   	push   %ebp
+  802bf2:	89 e5                	mov    %esp,%ebp
+  802bf4:	57                   	push   %edi
+  802bf5:	56                   	push   %esi
+  802bf6:	53                   	push   %ebx
+  802bf7:	83 ec 18             	sub    $0x18,%esp
+  802bfa:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802bfd:	57                   	push   %edi
+  802bfe:	e8 af eb ff ff       	call   8017b2 <fd2data>
+  802c03:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802c05:	83 c4 10             	add    $0x10,%esp
+  802c08:	be 00 00 00 00       	mov    $0x0,%esi
+  802c0d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c10:	75 13                	jne    802c25 <devpipe_read+0x34>
+	return i;
+  802c12:	89 f0                	mov    %esi,%eax
+  802c14:	eb 02                	jmp    802c18 <devpipe_read+0x27>
+				return i;
+  802c16:	89 f0                	mov    %esi,%eax
+}
+  802c18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c1b:	5b                   	pop    %ebx
+  802c1c:	5e                   	pop    %esi
+  802c1d:	5f                   	pop    %edi
+  802c1e:	5d                   	pop    %ebp
+  802c1f:	c3                   	ret
+			sys_yield();
+  802c20:	e8 76 e3 ff ff       	call   800f9b <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802c25:	8b 03                	mov    (%ebx),%eax
+  802c27:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802c2a:	75 18                	jne    802c44 <devpipe_read+0x53>
+			if (i > 0)
+  802c2c:	85 f6                	test   %esi,%esi
+  802c2e:	75 e6                	jne    802c16 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802c30:	89 da                	mov    %ebx,%edx
+  802c32:	89 f8                	mov    %edi,%eax
+  802c34:	e8 d4 fe ff ff       	call   802b0d <_pipeisclosed>
+  802c39:	85 c0                	test   %eax,%eax
+  802c3b:	74 e3                	je     802c20 <devpipe_read+0x2f>
+				return 0;
+  802c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c42:	eb d4                	jmp    802c18 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802c44:	99                   	cltd
+  802c45:	c1 ea 1b             	shr    $0x1b,%edx
+  802c48:	01 d0                	add    %edx,%eax
+  802c4a:	83 e0 1f             	and    $0x1f,%eax
+  802c4d:	29 d0                	sub    %edx,%eax
+  802c4f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802c54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c57:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802c5a:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802c5d:	83 c6 01             	add    $0x1,%esi
+  802c60:	eb ab                	jmp    802c0d <devpipe_read+0x1c>
+
+00802c62 <pipe>:
+{
+  802c62:	55                   	push   %ebp
+  802c63:	89 e5                	mov    %esp,%ebp
+  802c65:	56                   	push   %esi
+  802c66:	53                   	push   %ebx
+  802c67:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802c6a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c6d:	50                   	push   %eax
+  802c6e:	e8 56 eb ff ff       	call   8017c9 <fd_alloc>
+  802c73:	89 c3                	mov    %eax,%ebx
+  802c75:	83 c4 10             	add    $0x10,%esp
+  802c78:	85 c0                	test   %eax,%eax
+  802c7a:	0f 88 23 01 00 00    	js     802da3 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c80:	83 ec 04             	sub    $0x4,%esp
+  802c83:	68 07 04 00 00       	push   $0x407
+  802c88:	ff 75 f4             	push   -0xc(%ebp)
+  802c8b:	6a 00                	push   $0x0
+  802c8d:	e8 89 e3 ff ff       	call   80101b <sys_page_alloc>
+  802c92:	89 c3                	mov    %eax,%ebx
+  802c94:	83 c4 10             	add    $0x10,%esp
+  802c97:	85 c0                	test   %eax,%eax
+  802c99:	0f 88 04 01 00 00    	js     802da3 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802c9f:	83 ec 0c             	sub    $0xc,%esp
+  802ca2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802ca5:	50                   	push   %eax
+  802ca6:	e8 1e eb ff ff       	call   8017c9 <fd_alloc>
+  802cab:	89 c3                	mov    %eax,%ebx
+  802cad:	83 c4 10             	add    $0x10,%esp
+  802cb0:	85 c0                	test   %eax,%eax
+  802cb2:	0f 88 db 00 00 00    	js     802d93 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cb8:	83 ec 04             	sub    $0x4,%esp
+  802cbb:	68 07 04 00 00       	push   $0x407
+  802cc0:	ff 75 f0             	push   -0x10(%ebp)
+  802cc3:	6a 00                	push   $0x0
+  802cc5:	e8 51 e3 ff ff       	call   80101b <sys_page_alloc>
+  802cca:	89 c3                	mov    %eax,%ebx
+  802ccc:	83 c4 10             	add    $0x10,%esp
+  802ccf:	85 c0                	test   %eax,%eax
+  802cd1:	0f 88 bc 00 00 00    	js     802d93 <pipe+0x131>
+	va = fd2data(fd0);
+  802cd7:	83 ec 0c             	sub    $0xc,%esp
+  802cda:	ff 75 f4             	push   -0xc(%ebp)
+  802cdd:	e8 d0 ea ff ff       	call   8017b2 <fd2data>
+  802ce2:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ce4:	83 c4 0c             	add    $0xc,%esp
+  802ce7:	68 07 04 00 00       	push   $0x407
+  802cec:	50                   	push   %eax
+  802ced:	6a 00                	push   $0x0
+  802cef:	e8 27 e3 ff ff       	call   80101b <sys_page_alloc>
+  802cf4:	89 c3                	mov    %eax,%ebx
+  802cf6:	83 c4 10             	add    $0x10,%esp
+  802cf9:	85 c0                	test   %eax,%eax
+  802cfb:	0f 88 82 00 00 00    	js     802d83 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d01:	83 ec 0c             	sub    $0xc,%esp
+  802d04:	ff 75 f0             	push   -0x10(%ebp)
+  802d07:	e8 a6 ea ff ff       	call   8017b2 <fd2data>
+  802d0c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802d13:	50                   	push   %eax
+  802d14:	6a 00                	push   $0x0
+  802d16:	56                   	push   %esi
+  802d17:	6a 00                	push   $0x0
+  802d19:	e8 83 e3 ff ff       	call   8010a1 <sys_page_map>
+  802d1e:	89 c3                	mov    %eax,%ebx
+  802d20:	83 c4 20             	add    $0x20,%esp
+  802d23:	85 c0                	test   %eax,%eax
+  802d25:	78 4e                	js     802d75 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802d27:	a1 58 40 80 00       	mov    0x804058,%eax
+  802d2c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802d2f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802d31:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802d34:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802d3b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802d3e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802d40:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802d43:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802d4a:	83 ec 0c             	sub    $0xc,%esp
+  802d4d:	ff 75 f4             	push   -0xc(%ebp)
+  802d50:	e8 4d ea ff ff       	call   8017a2 <fd2num>
+  802d55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d58:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802d5a:	83 c4 04             	add    $0x4,%esp
+  802d5d:	ff 75 f0             	push   -0x10(%ebp)
+  802d60:	e8 3d ea ff ff       	call   8017a2 <fd2num>
+  802d65:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d68:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802d6b:	83 c4 10             	add    $0x10,%esp
+  802d6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d73:	eb 2e                	jmp    802da3 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802d75:	83 ec 08             	sub    $0x8,%esp
+  802d78:	56                   	push   %esi
+  802d79:	6a 00                	push   $0x0
+  802d7b:	e8 63 e3 ff ff       	call   8010e3 <sys_page_unmap>
+  802d80:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802d83:	83 ec 08             	sub    $0x8,%esp
+  802d86:	ff 75 f0             	push   -0x10(%ebp)
+  802d89:	6a 00                	push   $0x0
+  802d8b:	e8 53 e3 ff ff       	call   8010e3 <sys_page_unmap>
+  802d90:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802d93:	83 ec 08             	sub    $0x8,%esp
+  802d96:	ff 75 f4             	push   -0xc(%ebp)
+  802d99:	6a 00                	push   $0x0
+  802d9b:	e8 43 e3 ff ff       	call   8010e3 <sys_page_unmap>
+  802da0:	83 c4 10             	add    $0x10,%esp
+}
+  802da3:	89 d8                	mov    %ebx,%eax
+  802da5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802da8:	5b                   	pop    %ebx
+  802da9:	5e                   	pop    %esi
+  802daa:	5d                   	pop    %ebp
+  802dab:	c3                   	ret
+
+00802dac <pipeisclosed>:
+{
+  802dac:	55                   	push   %ebp
+  802dad:	89 e5                	mov    %esp,%ebp
+  802daf:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802db2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802db5:	50                   	push   %eax
+  802db6:	ff 75 08             	push   0x8(%ebp)
+  802db9:	e8 61 ea ff ff       	call   80181f <fd_lookup>
+  802dbe:	83 c4 10             	add    $0x10,%esp
+  802dc1:	85 c0                	test   %eax,%eax
+  802dc3:	78 18                	js     802ddd <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802dc5:	83 ec 0c             	sub    $0xc,%esp
+  802dc8:	ff 75 f4             	push   -0xc(%ebp)
+  802dcb:	e8 e2 e9 ff ff       	call   8017b2 <fd2data>
+  802dd0:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802dd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dd5:	e8 33 fd ff ff       	call   802b0d <_pipeisclosed>
+  802dda:	83 c4 10             	add    $0x10,%esp
+}
+  802ddd:	c9                   	leave
+  802dde:	c3                   	ret
+
+00802ddf <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802ddf:	55                   	push   %ebp
+  802de0:	89 e5                	mov    %esp,%ebp
+  802de2:	56                   	push   %esi
+  802de3:	53                   	push   %ebx
+  802de4:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  802de7:	85 f6                	test   %esi,%esi
+  802de9:	74 13                	je     802dfe <wait+0x1f>
+	e = &envs[ENVX(envid)];
+  802deb:	89 f3                	mov    %esi,%ebx
+  802ded:	81 e3 ff 1f 00 00    	and    $0x1fff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  802df3:	c1 e3 09             	shl    $0x9,%ebx
+  802df6:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802dfc:	eb 1b                	jmp    802e19 <wait+0x3a>
+	assert(envid != 0);
+  802dfe:	68 77 3b 80 00       	push   $0x803b77
+  802e03:	68 37 3a 80 00       	push   $0x803a37
+  802e08:	6a 09                	push   $0x9
+  802e0a:	68 82 3b 80 00       	push   $0x803b82
+  802e0f:	e8 d1 d6 ff ff       	call   8004e5 <_panic>
+		sys_yield();
+  802e14:	e8 82 e1 ff ff       	call   800f9b <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  802e19:	8b 43 4c             	mov    0x4c(%ebx),%eax
+  802e1c:	39 f0                	cmp    %esi,%eax
+  802e1e:	75 07                	jne    802e27 <wait+0x48>
+  802e20:	8b 43 58             	mov    0x58(%ebx),%eax
+  802e23:	85 c0                	test   %eax,%eax
+  802e25:	75 ed                	jne    802e14 <wait+0x35>
+}
+  802e27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e2a:	5b                   	pop    %ebx
+  802e2b:	5e                   	pop    %esi
+  802e2c:	5d                   	pop    %ebp
+  802e2d:	c3                   	ret
+
+00802e2e <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802e2e:	55                   	push   %ebp
+  802e2f:	89 e5                	mov    %esp,%ebp
+  802e31:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802e34:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802e3b:	74 0a                	je     802e47 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("sys_env_set_pgfault_upcall %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802e3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e40:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  802e45:	c9                   	leave
+  802e46:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W)) < 0)
+  802e47:	83 ec 04             	sub    $0x4,%esp
+  802e4a:	6a 07                	push   $0x7
+  802e4c:	68 00 f0 bf ee       	push   $0xeebff000
+  802e51:	6a 00                	push   $0x0
+  802e53:	e8 c3 e1 ff ff       	call   80101b <sys_page_alloc>
+  802e58:	83 c4 10             	add    $0x10,%esp
+  802e5b:	85 c0                	test   %eax,%eax
+  802e5d:	78 28                	js     802e87 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802e5f:	83 ec 08             	sub    $0x8,%esp
+  802e62:	68 99 2e 80 00       	push   $0x802e99
+  802e67:	6a 00                	push   $0x0
+  802e69:	e8 a8 e4 ff ff       	call   801316 <sys_env_set_pgfault_upcall>
+  802e6e:	83 c4 10             	add    $0x10,%esp
+  802e71:	85 c0                	test   %eax,%eax
+  802e73:	79 c8                	jns    802e3d <set_pgfault_handler+0xf>
+			panic("sys_env_set_pgfault_upcall %e", r);
+  802e75:	50                   	push   %eax
+  802e76:	68 9b 3b 80 00       	push   $0x803b9b
+  802e7b:	6a 24                	push   $0x24
+  802e7d:	68 8d 3b 80 00       	push   $0x803b8d
+  802e82:	e8 5e d6 ff ff       	call   8004e5 <_panic>
+			panic("sys_page_alloc: %e", r);
+  802e87:	50                   	push   %eax
+  802e88:	68 c6 38 80 00       	push   $0x8038c6
+  802e8d:	6a 21                	push   $0x21
+  802e8f:	68 8d 3b 80 00       	push   $0x803b8d
+  802e94:	e8 4c d6 ff ff       	call   8004e5 <_panic>
+
+00802e99 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802e99:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802e9a:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802e9f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802ea1:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	addl $8, %esp
+  802ea4:	83 c4 08             	add    $0x8,%esp
+	movl 0x28(%esp), %eax
+  802ea7:	8b 44 24 28          	mov    0x28(%esp),%eax
+	subl $4, %eax
+  802eab:	83 e8 04             	sub    $0x4,%eax
+	movl %eax, 0x28(%esp)
+  802eae:	89 44 24 28          	mov    %eax,0x28(%esp)
+	movl 0x20(%esp), %ebx
+  802eb2:	8b 5c 24 20          	mov    0x20(%esp),%ebx
+	movl %ebx, (%eax)
+  802eb6:	89 18                	mov    %ebx,(%eax)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	popal
+  802eb8:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802eb9:	83 c4 04             	add    $0x4,%esp
+	popf
+  802ebc:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802ebd:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802ebe:	c3                   	ret
+
+00802ebf <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802ebf:	55                   	push   %ebp
+  802ec0:	89 e5                	mov    %esp,%ebp
+  802ec2:	57                   	push   %edi
+  802ec3:	56                   	push   %esi
+  802ec4:	53                   	push   %ebx
+  802ec5:	83 ec 18             	sub    $0x18,%esp
+  802ec8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ecb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802ece:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802ed1:	85 db                	test   %ebx,%ebx
+  802ed3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ed8:	0f 45 c3             	cmovne %ebx,%eax
+  802edb:	50                   	push   %eax
+  802edc:	e8 bd e4 ff ff       	call   80139e <sys_ipc_recv>
+
+	if (from_env_store)
+  802ee1:	83 c4 10             	add    $0x10,%esp
+  802ee4:	85 ff                	test   %edi,%edi
+  802ee6:	74 17                	je     802eff <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  802ee8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eed:	85 c0                	test   %eax,%eax
+  802eef:	75 0c                	jne    802efd <ipc_recv+0x3e>
+  802ef1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802ef7:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802efd:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802eff:	85 f6                	test   %esi,%esi
+  802f01:	74 2e                	je     802f31 <ipc_recv+0x72>
+		if (!r && pg)
+  802f03:	85 c0                	test   %eax,%eax
+  802f05:	75 24                	jne    802f2b <ipc_recv+0x6c>
+  802f07:	85 db                	test   %ebx,%ebx
+  802f09:	74 20                	je     802f2b <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  802f0b:	a1 08 50 80 00       	mov    0x805008,%eax
+  802f10:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802f16:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  802f18:	a1 08 50 80 00       	mov    0x805008,%eax
+  802f1d:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f26:	5b                   	pop    %ebx
+  802f27:	5e                   	pop    %esi
+  802f28:	5f                   	pop    %edi
+  802f29:	5d                   	pop    %ebp
+  802f2a:	c3                   	ret
+			*perm_store = 0;
+  802f2b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802f31:	85 c0                	test   %eax,%eax
+  802f33:	75 ee                	jne    802f23 <ipc_recv+0x64>
+  802f35:	eb e1                	jmp    802f18 <ipc_recv+0x59>
+
+00802f37 <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802f37:	55                   	push   %ebp
+  802f38:	89 e5                	mov    %esp,%ebp
+  802f3a:	57                   	push   %edi
+  802f3b:	56                   	push   %esi
+  802f3c:	53                   	push   %ebx
+  802f3d:	83 ec 0c             	sub    $0xc,%esp
+  802f40:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f43:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802f46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  802f49:	85 db                	test   %ebx,%ebx
+  802f4b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802f50:	0f 44 d8             	cmove  %eax,%ebx
+  802f53:	ff 75 14             	push   0x14(%ebp)
+  802f56:	53                   	push   %ebx
+  802f57:	56                   	push   %esi
+  802f58:	57                   	push   %edi
+  802f59:	e8 1d e4 ff ff       	call   80137b <sys_ipc_try_send_yield>
+  802f5e:	83 c4 10             	add    $0x10,%esp
+  802f61:	85 c0                	test   %eax,%eax
+  802f63:	79 1e                	jns    802f83 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802f65:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f68:	75 07                	jne    802f71 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802f6a:	e8 2c e0 ff ff       	call   800f9b <sys_yield>
+  802f6f:	eb e2                	jmp    802f53 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802f71:	50                   	push   %eax
+  802f72:	68 b9 3b 80 00       	push   $0x803bb9
+  802f77:	6a 3d                	push   $0x3d
+  802f79:	68 ce 3b 80 00       	push   $0x803bce
+  802f7e:	e8 62 d5 ff ff       	call   8004e5 <_panic>
+	}
+}
+  802f83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f86:	5b                   	pop    %ebx
+  802f87:	5e                   	pop    %esi
+  802f88:	5f                   	pop    %edi
+  802f89:	5d                   	pop    %ebp
+  802f8a:	c3                   	ret
+
+00802f8b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802f8b:	55                   	push   %ebp
+  802f8c:	89 e5                	mov    %esp,%ebp
+  802f8e:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802f91:	ff 75 08             	push   0x8(%ebp)
+  802f94:	e8 82 df ff ff       	call   800f1b <sys_env_find>
+}
+  802f99:	c9                   	leave
+  802f9a:	c3                   	ret
+
+00802f9b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802f9b:	55                   	push   %ebp
+  802f9c:	89 e5                	mov    %esp,%ebp
+  802f9e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802fa1:	89 c2                	mov    %eax,%edx
+  802fa3:	c1 ea 16             	shr    $0x16,%edx
+  802fa6:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802fad:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802fb2:	f6 c1 01             	test   $0x1,%cl
+  802fb5:	74 22                	je     802fd9 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802fb7:	c1 e8 0c             	shr    $0xc,%eax
+  802fba:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802fc1:	a8 01                	test   $0x1,%al
+  802fc3:	74 14                	je     802fd9 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802fc5:	c1 e8 0c             	shr    $0xc,%eax
+  802fc8:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802fcb:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802fd2:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802fd6:	0f b7 d2             	movzwl %dx,%edx
+}
+  802fd9:	89 d0                	mov    %edx,%eax
+  802fdb:	5d                   	pop    %ebp
+  802fdc:	c3                   	ret
+  802fdd:	66 90                	xchg   %ax,%ax
+  802fdf:	90                   	nop
+
+00802fe0 <__udivmoddi4>:
+  802fe0:	55                   	push   %ebp
+  802fe1:	57                   	push   %edi
+  802fe2:	56                   	push   %esi
+  802fe3:	53                   	push   %ebx
+  802fe4:	83 ec 14             	sub    $0x14,%esp
+  802fe7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802feb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802fef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ff3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ff7:	89 f1                	mov    %esi,%ecx
+  802ff9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  802ffd:	09 d9                	or     %ebx,%ecx
+  802fff:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  803003:	0f 84 92 00 00 00    	je     80309b <__udivmoddi4+0xbb>
+  803009:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803010:	00 
+  803011:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  803016:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80301d:	00 
+  80301e:	89 1c 24             	mov    %ebx,(%esp)
+  803021:	89 74 24 04          	mov    %esi,0x4(%esp)
+  803025:	8d 76 00             	lea    0x0(%esi),%esi
+  803028:	89 e9                	mov    %ebp,%ecx
+  80302a:	89 c3                	mov    %eax,%ebx
+  80302c:	89 d6                	mov    %edx,%esi
+  80302e:	31 ff                	xor    %edi,%edi
+  803030:	d3 ee                	shr    %cl,%esi
+  803032:	0f ad d3             	shrd   %cl,%edx,%ebx
+  803035:	f6 c1 20             	test   $0x20,%cl
+  803038:	0f 45 de             	cmovne %esi,%ebx
+  80303b:	0f 45 f7             	cmovne %edi,%esi
+  80303e:	8b 3c 24             	mov    (%esp),%edi
+  803041:	39 fb                	cmp    %edi,%ebx
+  803043:	89 f7                	mov    %esi,%edi
+  803045:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803049:	8b 1c 24             	mov    (%esp),%ebx
+  80304c:	19 f7                	sbb    %esi,%edi
+  80304e:	72 39                	jb     803089 <__udivmoddi4+0xa9>
+  803050:	89 e9                	mov    %ebp,%ecx
+  803052:	89 f7                	mov    %esi,%edi
+  803054:	89 de                	mov    %ebx,%esi
+  803056:	0f a5 df             	shld   %cl,%ebx,%edi
+  803059:	d3 e6                	shl    %cl,%esi
+  80305b:	31 db                	xor    %ebx,%ebx
+  80305d:	f6 c1 20             	test   $0x20,%cl
+  803060:	0f 45 fe             	cmovne %esi,%edi
+  803063:	0f 45 f3             	cmovne %ebx,%esi
+  803066:	29 f0                	sub    %esi,%eax
+  803068:	be 01 00 00 00       	mov    $0x1,%esi
+  80306d:	19 fa                	sbb    %edi,%edx
+  80306f:	31 ff                	xor    %edi,%edi
+  803071:	31 db                	xor    %ebx,%ebx
+  803073:	0f a5 f7             	shld   %cl,%esi,%edi
+  803076:	d3 e6                	shl    %cl,%esi
+  803078:	f6 c1 20             	test   $0x20,%cl
+  80307b:	0f 45 fe             	cmovne %esi,%edi
+  80307e:	0f 45 f3             	cmovne %ebx,%esi
+  803081:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803085:	09 74 24 08          	or     %esi,0x8(%esp)
+  803089:	83 ed 01             	sub    $0x1,%ebp
+  80308c:	73 9a                	jae    803028 <__udivmoddi4+0x48>
+  80308e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  803092:	85 ff                	test   %edi,%edi
+  803094:	74 05                	je     80309b <__udivmoddi4+0xbb>
+  803096:	89 07                	mov    %eax,(%edi)
+  803098:	89 57 04             	mov    %edx,0x4(%edi)
+  80309b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80309f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030a3:	83 c4 14             	add    $0x14,%esp
+  8030a6:	5b                   	pop    %ebx
+  8030a7:	5e                   	pop    %esi
+  8030a8:	5f                   	pop    %edi
+  8030a9:	5d                   	pop    %ebp
+  8030aa:	c3                   	ret
+  8030ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8030af:	90                   	nop
+
+008030b0 <__udivdi3>:
+  8030b0:	55                   	push   %ebp
+  8030b1:	57                   	push   %edi
+  8030b2:	56                   	push   %esi
+  8030b3:	53                   	push   %ebx
+  8030b4:	83 ec 14             	sub    $0x14,%esp
+  8030b7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8030bb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8030bf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030c3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030c7:	89 fb                	mov    %edi,%ebx
+  8030c9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8030cd:	09 f3                	or     %esi,%ebx
+  8030cf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8030d3:	0f 84 85 00 00 00    	je     80315e <__udivdi3+0xae>
+  8030d9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8030e0:	00 
+  8030e1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8030e6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8030ed:	00 
+  8030ee:	89 34 24             	mov    %esi,(%esp)
+  8030f1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8030f5:	8d 76 00             	lea    0x0(%esi),%esi
+  8030f8:	89 e9                	mov    %ebp,%ecx
+  8030fa:	89 c3                	mov    %eax,%ebx
+  8030fc:	89 d6                	mov    %edx,%esi
+  8030fe:	31 ff                	xor    %edi,%edi
+  803100:	d3 ee                	shr    %cl,%esi
+  803102:	0f ad d3             	shrd   %cl,%edx,%ebx
+  803105:	f6 c1 20             	test   $0x20,%cl
+  803108:	0f 45 de             	cmovne %esi,%ebx
+  80310b:	0f 45 f7             	cmovne %edi,%esi
+  80310e:	8b 3c 24             	mov    (%esp),%edi
+  803111:	39 fb                	cmp    %edi,%ebx
+  803113:	89 f7                	mov    %esi,%edi
+  803115:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803119:	8b 1c 24             	mov    (%esp),%ebx
+  80311c:	19 f7                	sbb    %esi,%edi
+  80311e:	72 39                	jb     803159 <__udivdi3+0xa9>
+  803120:	89 e9                	mov    %ebp,%ecx
+  803122:	89 f7                	mov    %esi,%edi
+  803124:	89 de                	mov    %ebx,%esi
+  803126:	0f a5 df             	shld   %cl,%ebx,%edi
+  803129:	d3 e6                	shl    %cl,%esi
+  80312b:	31 db                	xor    %ebx,%ebx
+  80312d:	f6 c1 20             	test   $0x20,%cl
+  803130:	0f 45 fe             	cmovne %esi,%edi
+  803133:	0f 45 f3             	cmovne %ebx,%esi
+  803136:	29 f0                	sub    %esi,%eax
+  803138:	be 01 00 00 00       	mov    $0x1,%esi
+  80313d:	19 fa                	sbb    %edi,%edx
+  80313f:	31 ff                	xor    %edi,%edi
+  803141:	31 db                	xor    %ebx,%ebx
+  803143:	0f a5 f7             	shld   %cl,%esi,%edi
+  803146:	d3 e6                	shl    %cl,%esi
+  803148:	f6 c1 20             	test   $0x20,%cl
+  80314b:	0f 45 fe             	cmovne %esi,%edi
+  80314e:	0f 45 f3             	cmovne %ebx,%esi
+  803151:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803155:	09 74 24 08          	or     %esi,0x8(%esp)
+  803159:	83 ed 01             	sub    $0x1,%ebp
+  80315c:	73 9a                	jae    8030f8 <__udivdi3+0x48>
+  80315e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803162:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803166:	83 c4 14             	add    $0x14,%esp
+  803169:	5b                   	pop    %ebx
+  80316a:	5e                   	pop    %esi
+  80316b:	5f                   	pop    %edi
+  80316c:	5d                   	pop    %ebp
+  80316d:	c3                   	ret
+  80316e:	66 90                	xchg   %ax,%ax
+
+00803170 <__umoddi3>:
+  803170:	57                   	push   %edi
+  803171:	56                   	push   %esi
+  803172:	53                   	push   %ebx
+  803173:	83 ec 08             	sub    $0x8,%esp
+  803176:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80317a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80317e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803182:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803186:	89 f9                	mov    %edi,%ecx
+  803188:	89 34 24             	mov    %esi,(%esp)
+  80318b:	09 f1                	or     %esi,%ecx
+  80318d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803191:	74 53                	je     8031e6 <__umoddi3+0x76>
+  803193:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80319f:	90                   	nop
+  8031a0:	89 c6                	mov    %eax,%esi
+  8031a2:	89 d7                	mov    %edx,%edi
+  8031a4:	31 db                	xor    %ebx,%ebx
+  8031a6:	d3 ef                	shr    %cl,%edi
+  8031a8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8031ab:	f6 c1 20             	test   $0x20,%cl
+  8031ae:	0f 45 f7             	cmovne %edi,%esi
+  8031b1:	0f 45 fb             	cmovne %ebx,%edi
+  8031b4:	8b 1c 24             	mov    (%esp),%ebx
+  8031b7:	39 de                	cmp    %ebx,%esi
+  8031b9:	89 fb                	mov    %edi,%ebx
+  8031bb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8031bf:	8b 34 24             	mov    (%esp),%esi
+  8031c2:	19 fb                	sbb    %edi,%ebx
+  8031c4:	72 14                	jb     8031da <__umoddi3+0x6a>
+  8031c6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8031c9:	31 db                	xor    %ebx,%ebx
+  8031cb:	d3 e6                	shl    %cl,%esi
+  8031cd:	f6 c1 20             	test   $0x20,%cl
+  8031d0:	0f 45 fe             	cmovne %esi,%edi
+  8031d3:	0f 45 f3             	cmovne %ebx,%esi
+  8031d6:	29 f0                	sub    %esi,%eax
+  8031d8:	19 fa                	sbb    %edi,%edx
+  8031da:	83 e9 01             	sub    $0x1,%ecx
+  8031dd:	73 c1                	jae    8031a0 <__umoddi3+0x30>
+  8031df:	83 c4 08             	add    $0x8,%esp
+  8031e2:	5b                   	pop    %ebx
+  8031e3:	5e                   	pop    %esi
+  8031e4:	5f                   	pop    %edi
+  8031e5:	c3                   	ret
+  8031e6:	83 c4 08             	add    $0x8,%esp
+  8031e9:	31 c0                	xor    %eax,%eax
+  8031eb:	31 d2                	xor    %edx,%edx
+  8031ed:	5b                   	pop    %ebx
+  8031ee:	5e                   	pop    %esi
+  8031ef:	5f                   	pop    %edi
+  8031f0:	c3                   	ret
+  8031f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8031f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8031ff:	90                   	nop
+
+00803200 <__divdi3>:
+  803200:	55                   	push   %ebp
+  803201:	57                   	push   %edi
+  803202:	56                   	push   %esi
+  803203:	53                   	push   %ebx
+  803204:	83 ec 1c             	sub    $0x1c,%esp
+  803207:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80320b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80320f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  803213:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  803217:	85 ff                	test   %edi,%edi
+  803219:	0f 88 da 00 00 00    	js     8032f9 <__divdi3+0xf9>
+  80321f:	85 db                	test   %ebx,%ebx
+  803221:	78 16                	js     803239 <__divdi3+0x39>
+  803223:	89 dd                	mov    %ebx,%ebp
+  803225:	89 c8                	mov    %ecx,%eax
+  803227:	89 da                	mov    %ebx,%edx
+  803229:	09 cd                	or     %ecx,%ebp
+  80322b:	0f 85 fd 00 00 00    	jne    80332e <__divdi3+0x12e>
+  803231:	83 c4 1c             	add    $0x1c,%esp
+  803234:	5b                   	pop    %ebx
+  803235:	5e                   	pop    %esi
+  803236:	5f                   	pop    %edi
+  803237:	5d                   	pop    %ebp
+  803238:	c3                   	ret
+  803239:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80323e:	f7 d9                	neg    %ecx
+  803240:	89 f0                	mov    %esi,%eax
+  803242:	89 fa                	mov    %edi,%edx
+  803244:	83 d3 00             	adc    $0x0,%ebx
+  803247:	89 0c 24             	mov    %ecx,(%esp)
+  80324a:	f7 db                	neg    %ebx
+  80324c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  803250:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803257:	00 
+  803258:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80325d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803264:	00 
+  803265:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  803269:	89 cd                	mov    %ecx,%ebp
+  80326b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80326f:	90                   	nop
+  803270:	89 e9                	mov    %ebp,%ecx
+  803272:	89 c3                	mov    %eax,%ebx
+  803274:	89 d6                	mov    %edx,%esi
+  803276:	31 ff                	xor    %edi,%edi
+  803278:	d3 ee                	shr    %cl,%esi
+  80327a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80327d:	f6 c1 20             	test   $0x20,%cl
+  803280:	0f 45 de             	cmovne %esi,%ebx
+  803283:	0f 45 f7             	cmovne %edi,%esi
+  803286:	8b 3c 24             	mov    (%esp),%edi
+  803289:	39 fb                	cmp    %edi,%ebx
+  80328b:	89 f7                	mov    %esi,%edi
+  80328d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803291:	8b 1c 24             	mov    (%esp),%ebx
+  803294:	19 f7                	sbb    %esi,%edi
+  803296:	72 39                	jb     8032d1 <__divdi3+0xd1>
+  803298:	89 e9                	mov    %ebp,%ecx
+  80329a:	89 f7                	mov    %esi,%edi
+  80329c:	89 de                	mov    %ebx,%esi
+  80329e:	0f a5 df             	shld   %cl,%ebx,%edi
+  8032a1:	d3 e6                	shl    %cl,%esi
+  8032a3:	31 db                	xor    %ebx,%ebx
+  8032a5:	f6 c1 20             	test   $0x20,%cl
+  8032a8:	0f 45 fe             	cmovne %esi,%edi
+  8032ab:	0f 45 f3             	cmovne %ebx,%esi
+  8032ae:	29 f0                	sub    %esi,%eax
+  8032b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8032b5:	19 fa                	sbb    %edi,%edx
+  8032b7:	31 ff                	xor    %edi,%edi
+  8032b9:	31 db                	xor    %ebx,%ebx
+  8032bb:	0f a5 f7             	shld   %cl,%esi,%edi
+  8032be:	d3 e6                	shl    %cl,%esi
+  8032c0:	f6 c1 20             	test   $0x20,%cl
+  8032c3:	0f 45 fe             	cmovne %esi,%edi
+  8032c6:	0f 45 f3             	cmovne %ebx,%esi
+  8032c9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8032cd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8032d1:	83 ed 01             	sub    $0x1,%ebp
+  8032d4:	73 9a                	jae    803270 <__divdi3+0x70>
+  8032d6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8032da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8032de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8032e2:	85 ed                	test   %ebp,%ebp
+  8032e4:	0f 84 47 ff ff ff    	je     803231 <__divdi3+0x31>
+  8032ea:	f7 d8                	neg    %eax
+  8032ec:	83 d2 00             	adc    $0x0,%edx
+  8032ef:	83 c4 1c             	add    $0x1c,%esp
+  8032f2:	5b                   	pop    %ebx
+  8032f3:	f7 da                	neg    %edx
+  8032f5:	5e                   	pop    %esi
+  8032f6:	5f                   	pop    %edi
+  8032f7:	5d                   	pop    %ebp
+  8032f8:	c3                   	ret
+  8032f9:	f7 de                	neg    %esi
+  8032fb:	83 d7 00             	adc    $0x0,%edi
+  8032fe:	f7 df                	neg    %edi
+  803300:	85 db                	test   %ebx,%ebx
+  803302:	78 23                	js     803327 <__divdi3+0x127>
+  803304:	89 dd                	mov    %ebx,%ebp
+  803306:	89 c8                	mov    %ecx,%eax
+  803308:	89 da                	mov    %ebx,%edx
+  80330a:	09 cd                	or     %ecx,%ebp
+  80330c:	0f 84 1f ff ff ff    	je     803231 <__divdi3+0x31>
+  803312:	89 0c 24             	mov    %ecx,(%esp)
+  803315:	89 f0                	mov    %esi,%eax
+  803317:	89 fa                	mov    %edi,%edx
+  803319:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80331e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  803322:	e9 29 ff ff ff       	jmp    803250 <__divdi3+0x50>
+  803327:	31 ed                	xor    %ebp,%ebp
+  803329:	e9 10 ff ff ff       	jmp    80323e <__divdi3+0x3e>
+  80332e:	89 0c 24             	mov    %ecx,(%esp)
+  803331:	89 f0                	mov    %esi,%eax
+  803333:	89 fa                	mov    %edi,%edx
+  803335:	31 ed                	xor    %ebp,%ebp
+  803337:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80333b:	e9 10 ff ff ff       	jmp    803250 <__divdi3+0x50>
+
+00803340 <__moddi3>:
+  803340:	55                   	push   %ebp
+  803341:	57                   	push   %edi
+  803342:	56                   	push   %esi
+  803343:	53                   	push   %ebx
+  803344:	83 ec 14             	sub    $0x14,%esp
+  803347:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80334b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80334f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803353:	8b 74 24 34          	mov    0x34(%esp),%esi
+  803357:	85 d2                	test   %edx,%edx
+  803359:	0f 88 9b 00 00 00    	js     8033fa <__moddi3+0xba>
+  80335f:	89 f7                	mov    %esi,%edi
+  803361:	31 ed                	xor    %ebp,%ebp
+  803363:	09 cf                	or     %ecx,%edi
+  803365:	0f 84 83 00 00 00    	je     8033ee <__moddi3+0xae>
+  80336b:	89 cb                	mov    %ecx,%ebx
+  80336d:	89 f7                	mov    %esi,%edi
+  80336f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  803373:	f7 db                	neg    %ebx
+  803375:	83 d7 00             	adc    $0x0,%edi
+  803378:	f7 df                	neg    %edi
+  80337a:	0f 49 f7             	cmovns %edi,%esi
+  80337d:	0f 49 cb             	cmovns %ebx,%ecx
+  803380:	89 74 24 04          	mov    %esi,0x4(%esp)
+  803384:	89 0c 24             	mov    %ecx,(%esp)
+  803387:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80338c:	89 cd                	mov    %ecx,%ebp
+  80338e:	66 90                	xchg   %ax,%ax
+  803390:	89 e9                	mov    %ebp,%ecx
+  803392:	89 c3                	mov    %eax,%ebx
+  803394:	89 d6                	mov    %edx,%esi
+  803396:	31 ff                	xor    %edi,%edi
+  803398:	d3 ee                	shr    %cl,%esi
+  80339a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80339d:	f6 c1 20             	test   $0x20,%cl
+  8033a0:	0f 45 de             	cmovne %esi,%ebx
+  8033a3:	0f 45 f7             	cmovne %edi,%esi
+  8033a6:	8b 3c 24             	mov    (%esp),%edi
+  8033a9:	39 fb                	cmp    %edi,%ebx
+  8033ab:	89 f7                	mov    %esi,%edi
+  8033ad:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8033b1:	8b 1c 24             	mov    (%esp),%ebx
+  8033b4:	19 f7                	sbb    %esi,%edi
+  8033b6:	72 1a                	jb     8033d2 <__moddi3+0x92>
+  8033b8:	89 e9                	mov    %ebp,%ecx
+  8033ba:	89 f7                	mov    %esi,%edi
+  8033bc:	89 de                	mov    %ebx,%esi
+  8033be:	0f a5 df             	shld   %cl,%ebx,%edi
+  8033c1:	d3 e6                	shl    %cl,%esi
+  8033c3:	31 db                	xor    %ebx,%ebx
+  8033c5:	f6 c1 20             	test   $0x20,%cl
+  8033c8:	0f 45 fe             	cmovne %esi,%edi
+  8033cb:	0f 45 f3             	cmovne %ebx,%esi
+  8033ce:	29 f0                	sub    %esi,%eax
+  8033d0:	19 fa                	sbb    %edi,%edx
+  8033d2:	83 ed 01             	sub    $0x1,%ebp
+  8033d5:	73 b9                	jae    803390 <__moddi3+0x50>
+  8033d7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  8033db:	85 ed                	test   %ebp,%ebp
+  8033dd:	74 07                	je     8033e6 <__moddi3+0xa6>
+  8033df:	f7 d8                	neg    %eax
+  8033e1:	83 d2 00             	adc    $0x0,%edx
+  8033e4:	f7 da                	neg    %edx
+  8033e6:	83 c4 14             	add    $0x14,%esp
+  8033e9:	5b                   	pop    %ebx
+  8033ea:	5e                   	pop    %esi
+  8033eb:	5f                   	pop    %edi
+  8033ec:	5d                   	pop    %ebp
+  8033ed:	c3                   	ret
+  8033ee:	83 c4 14             	add    $0x14,%esp
+  8033f1:	31 c0                	xor    %eax,%eax
+  8033f3:	31 d2                	xor    %edx,%edx
+  8033f5:	5b                   	pop    %ebx
+  8033f6:	5e                   	pop    %esi
+  8033f7:	5f                   	pop    %edi
+  8033f8:	5d                   	pop    %ebp
+  8033f9:	c3                   	ret
+  8033fa:	89 f7                	mov    %esi,%edi
+  8033fc:	09 cf                	or     %ecx,%edi
+  8033fe:	74 11                	je     803411 <__moddi3+0xd1>
+  803400:	f7 d8                	neg    %eax
+  803402:	bd 01 00 00 00       	mov    $0x1,%ebp
+  803407:	83 d2 00             	adc    $0x0,%edx
+  80340a:	f7 da                	neg    %edx
+  80340c:	e9 5a ff ff ff       	jmp    80336b <__moddi3+0x2b>
+  803411:	31 c0                	xor    %eax,%eax
+  803413:	31 d2                	xor    %edx,%edx
+  803415:	eb c8                	jmp    8033df <__moddi3+0x9f>
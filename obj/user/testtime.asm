@@ -0,0 +1,5650 @@
+
+obj/user/testtime.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c5 00 00 00       	call   8000f6 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sleep>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+sleep(int sec)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	unsigned now = sys_time_msec();
+  80003a:	e8 11 10 00 00       	call   801050 <sys_time_msec>
+	unsigned end = now + sec * 1000;
+  80003f:	69 5d 08 e8 03 00 00 	imul   $0x3e8,0x8(%ebp),%ebx
+  800046:	01 c3                	add    %eax,%ebx
+
+	if ((int)now < 0 && (int)now > -MAXERROR)
+  800048:	85 c0                	test   %eax,%eax
+  80004a:	79 05                	jns    800051 <sleep+0x1e>
+  80004c:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80004f:	7d 18                	jge    800069 <sleep+0x36>
+		panic("sys_time_msec: %e", (int)now);
+	if (end < now)
+  800051:	39 c3                	cmp    %eax,%ebx
+  800053:	73 2b                	jae    800080 <sleep+0x4d>
+		panic("sleep: wrap");
+  800055:	83 ec 04             	sub    $0x4,%esp
+  800058:	68 42 27 80 00       	push   $0x802742
+  80005d:	6a 0d                	push   $0xd
+  80005f:	68 32 27 80 00       	push   $0x802732
+  800064:	e8 ed 00 00 00       	call   800156 <_panic>
+		panic("sys_time_msec: %e", (int)now);
+  800069:	50                   	push   %eax
+  80006a:	68 20 27 80 00       	push   $0x802720
+  80006f:	6a 0b                	push   $0xb
+  800071:	68 32 27 80 00       	push   $0x802732
+  800076:	e8 db 00 00 00       	call   800156 <_panic>
+
+	while (sys_time_msec() < end)
+		sys_yield();
+  80007b:	e8 8c 0b 00 00       	call   800c0c <sys_yield>
+	while (sys_time_msec() < end)
+  800080:	e8 cb 0f 00 00       	call   801050 <sys_time_msec>
+  800085:	39 d8                	cmp    %ebx,%eax
+  800087:	72 f2                	jb     80007b <sleep+0x48>
+}
+  800089:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80008c:	c9                   	leave
+  80008d:	c3                   	ret
+
+0080008e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80008e:	55                   	push   %ebp
+  80008f:	89 e5                	mov    %esp,%ebp
+  800091:	53                   	push   %ebx
+  800092:	83 ec 04             	sub    $0x4,%esp
+	int i;
+
+	// Wait for the console to calm down
+	for (i = 0; i < 50; i++)
+  800095:	bb 33 00 00 00       	mov    $0x33,%ebx
+  80009a:	eb 05                	jmp    8000a1 <umain+0x13>
+		sys_yield();
+  80009c:	e8 6b 0b 00 00       	call   800c0c <sys_yield>
+	for (i = 0; i < 50; i++)
+  8000a1:	83 eb 01             	sub    $0x1,%ebx
+  8000a4:	75 f6                	jne    80009c <umain+0xe>
+
+	cprintf("starting count down: ");
+  8000a6:	83 ec 0c             	sub    $0xc,%esp
+  8000a9:	68 4e 27 80 00       	push   $0x80274e
+  8000ae:	e8 7e 01 00 00       	call   800231 <cprintf>
+  8000b3:	83 c4 10             	add    $0x10,%esp
+	for (i = 5; i >= 0; i--) {
+  8000b6:	bb 05 00 00 00       	mov    $0x5,%ebx
+		cprintf("%d ", i);
+  8000bb:	83 ec 08             	sub    $0x8,%esp
+  8000be:	53                   	push   %ebx
+  8000bf:	68 64 27 80 00       	push   $0x802764
+  8000c4:	e8 68 01 00 00       	call   800231 <cprintf>
+		sleep(1);
+  8000c9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8000d0:	e8 5e ff ff ff       	call   800033 <sleep>
+	for (i = 5; i >= 0; i--) {
+  8000d5:	83 eb 01             	sub    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	83 fb ff             	cmp    $0xffffffff,%ebx
+  8000de:	75 db                	jne    8000bb <umain+0x2d>
+	}
+	cprintf("\n");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 e0 2b 80 00       	push   $0x802be0
+  8000e8:	e8 44 01 00 00       	call   800231 <cprintf>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  8000ed:	cc                   	int3
+	breakpoint();
+}
+  8000ee:	83 c4 10             	add    $0x10,%esp
+  8000f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000f4:	c9                   	leave
+  8000f5:	c3                   	ret
+
+008000f6 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000f6:	55                   	push   %ebp
+  8000f7:	89 e5                	mov    %esp,%ebp
+  8000f9:	56                   	push   %esi
+  8000fa:	53                   	push   %ebx
+  8000fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fe:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800101:	e8 e7 0a 00 00       	call   800bed <sys_getenvid>
+  800106:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80010b:	c1 e0 09             	shl    $0x9,%eax
+  80010e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800113:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800118:	85 db                	test   %ebx,%ebx
+  80011a:	7e 07                	jle    800123 <libmain+0x2d>
+		binaryname = argv[0];
+  80011c:	8b 06                	mov    (%esi),%eax
+  80011e:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800123:	83 ec 08             	sub    $0x8,%esp
+  800126:	56                   	push   %esi
+  800127:	53                   	push   %ebx
+  800128:	e8 61 ff ff ff       	call   80008e <umain>
+
+	// exit gracefully
+	exit();
+  80012d:	e8 0a 00 00 00       	call   80013c <exit>
+}
+  800132:	83 c4 10             	add    $0x10,%esp
+  800135:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800138:	5b                   	pop    %ebx
+  800139:	5e                   	pop    %esi
+  80013a:	5d                   	pop    %ebp
+  80013b:	c3                   	ret
+
+0080013c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80013c:	55                   	push   %ebp
+  80013d:	89 e5                	mov    %esp,%ebp
+  80013f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800142:	e8 3e 11 00 00       	call   801285 <close_all>
+	sys_env_destroy(0);
+  800147:	83 ec 0c             	sub    $0xc,%esp
+  80014a:	6a 00                	push   $0x0
+  80014c:	e8 5b 0a 00 00       	call   800bac <sys_env_destroy>
+}
+  800151:	83 c4 10             	add    $0x10,%esp
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+00800156 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	56                   	push   %esi
+  80015a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80015b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80015e:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  800164:	e8 84 0a 00 00       	call   800bed <sys_getenvid>
+  800169:	83 ec 0c             	sub    $0xc,%esp
+  80016c:	ff 75 0c             	push   0xc(%ebp)
+  80016f:	ff 75 08             	push   0x8(%ebp)
+  800172:	56                   	push   %esi
+  800173:	50                   	push   %eax
+  800174:	68 74 27 80 00       	push   $0x802774
+  800179:	e8 b3 00 00 00       	call   800231 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80017e:	83 c4 18             	add    $0x18,%esp
+  800181:	53                   	push   %ebx
+  800182:	ff 75 10             	push   0x10(%ebp)
+  800185:	e8 56 00 00 00       	call   8001e0 <vcprintf>
+	cprintf("\n");
+  80018a:	c7 04 24 e0 2b 80 00 	movl   $0x802be0,(%esp)
+  800191:	e8 9b 00 00 00       	call   800231 <cprintf>
+  800196:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800199:	cc                   	int3
+	while (1)
+  80019a:	eb fd                	jmp    800199 <_panic+0x43>
+
+0080019c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80019c:	55                   	push   %ebp
+  80019d:	89 e5                	mov    %esp,%ebp
+  80019f:	53                   	push   %ebx
+  8001a0:	83 ec 04             	sub    $0x4,%esp
+  8001a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001a6:	8b 13                	mov    (%ebx),%edx
+  8001a8:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ab:	89 03                	mov    %eax,(%ebx)
+  8001ad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001b4:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001b9:	74 09                	je     8001c4 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001bb:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c2:	c9                   	leave
+  8001c3:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001c4:	83 ec 08             	sub    $0x8,%esp
+  8001c7:	68 ff 00 00 00       	push   $0xff
+  8001cc:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001cf:	50                   	push   %eax
+  8001d0:	e8 7a 09 00 00       	call   800b4f <sys_cputs>
+		b->idx = 0;
+  8001d5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001db:	83 c4 10             	add    $0x10,%esp
+  8001de:	eb db                	jmp    8001bb <putch+0x1f>
+
+008001e0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001e0:	55                   	push   %ebp
+  8001e1:	89 e5                	mov    %esp,%ebp
+  8001e3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001e9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f0:	00 00 00 
+	b.cnt = 0;
+  8001f3:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001fa:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001fd:	ff 75 0c             	push   0xc(%ebp)
+  800200:	ff 75 08             	push   0x8(%ebp)
+  800203:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800209:	50                   	push   %eax
+  80020a:	68 9c 01 80 00       	push   $0x80019c
+  80020f:	e8 14 01 00 00       	call   800328 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800214:	83 c4 08             	add    $0x8,%esp
+  800217:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80021d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800223:	50                   	push   %eax
+  800224:	e8 26 09 00 00       	call   800b4f <sys_cputs>
+
+	return b.cnt;
+}
+  800229:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80022f:	c9                   	leave
+  800230:	c3                   	ret
+
+00800231 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800237:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80023a:	50                   	push   %eax
+  80023b:	ff 75 08             	push   0x8(%ebp)
+  80023e:	e8 9d ff ff ff       	call   8001e0 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800243:	c9                   	leave
+  800244:	c3                   	ret
+
+00800245 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800245:	55                   	push   %ebp
+  800246:	89 e5                	mov    %esp,%ebp
+  800248:	57                   	push   %edi
+  800249:	56                   	push   %esi
+  80024a:	53                   	push   %ebx
+  80024b:	83 ec 1c             	sub    $0x1c,%esp
+  80024e:	89 c7                	mov    %eax,%edi
+  800250:	89 d6                	mov    %edx,%esi
+  800252:	8b 45 08             	mov    0x8(%ebp),%eax
+  800255:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800258:	89 d1                	mov    %edx,%ecx
+  80025a:	89 c2                	mov    %eax,%edx
+  80025c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80025f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800262:	8b 45 10             	mov    0x10(%ebp),%eax
+  800265:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800268:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80026b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800272:	39 c2                	cmp    %eax,%edx
+  800274:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800277:	72 3e                	jb     8002b7 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800279:	83 ec 0c             	sub    $0xc,%esp
+  80027c:	ff 75 18             	push   0x18(%ebp)
+  80027f:	83 eb 01             	sub    $0x1,%ebx
+  800282:	53                   	push   %ebx
+  800283:	50                   	push   %eax
+  800284:	83 ec 08             	sub    $0x8,%esp
+  800287:	ff 75 e4             	push   -0x1c(%ebp)
+  80028a:	ff 75 e0             	push   -0x20(%ebp)
+  80028d:	ff 75 dc             	push   -0x24(%ebp)
+  800290:	ff 75 d8             	push   -0x28(%ebp)
+  800293:	e8 18 21 00 00       	call   8023b0 <__udivdi3>
+  800298:	83 c4 18             	add    $0x18,%esp
+  80029b:	52                   	push   %edx
+  80029c:	50                   	push   %eax
+  80029d:	89 f2                	mov    %esi,%edx
+  80029f:	89 f8                	mov    %edi,%eax
+  8002a1:	e8 9f ff ff ff       	call   800245 <printnum>
+  8002a6:	83 c4 20             	add    $0x20,%esp
+  8002a9:	eb 13                	jmp    8002be <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ab:	83 ec 08             	sub    $0x8,%esp
+  8002ae:	56                   	push   %esi
+  8002af:	ff 75 18             	push   0x18(%ebp)
+  8002b2:	ff d7                	call   *%edi
+  8002b4:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002b7:	83 eb 01             	sub    $0x1,%ebx
+  8002ba:	85 db                	test   %ebx,%ebx
+  8002bc:	7f ed                	jg     8002ab <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002be:	83 ec 08             	sub    $0x8,%esp
+  8002c1:	56                   	push   %esi
+  8002c2:	83 ec 04             	sub    $0x4,%esp
+  8002c5:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c8:	ff 75 e0             	push   -0x20(%ebp)
+  8002cb:	ff 75 dc             	push   -0x24(%ebp)
+  8002ce:	ff 75 d8             	push   -0x28(%ebp)
+  8002d1:	e8 9a 21 00 00       	call   802470 <__umoddi3>
+  8002d6:	83 c4 14             	add    $0x14,%esp
+  8002d9:	0f be 80 97 27 80 00 	movsbl 0x802797(%eax),%eax
+  8002e0:	50                   	push   %eax
+  8002e1:	ff d7                	call   *%edi
+}
+  8002e3:	83 c4 10             	add    $0x10,%esp
+  8002e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e9:	5b                   	pop    %ebx
+  8002ea:	5e                   	pop    %esi
+  8002eb:	5f                   	pop    %edi
+  8002ec:	5d                   	pop    %ebp
+  8002ed:	c3                   	ret
+
+008002ee <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002ee:	55                   	push   %ebp
+  8002ef:	89 e5                	mov    %esp,%ebp
+  8002f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002f4:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002f8:	8b 10                	mov    (%eax),%edx
+  8002fa:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002fd:	73 0a                	jae    800309 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002ff:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800302:	89 08                	mov    %ecx,(%eax)
+  800304:	8b 45 08             	mov    0x8(%ebp),%eax
+  800307:	88 02                	mov    %al,(%edx)
+}
+  800309:	5d                   	pop    %ebp
+  80030a:	c3                   	ret
+
+0080030b <printfmt>:
+{
+  80030b:	55                   	push   %ebp
+  80030c:	89 e5                	mov    %esp,%ebp
+  80030e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800311:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800314:	50                   	push   %eax
+  800315:	ff 75 10             	push   0x10(%ebp)
+  800318:	ff 75 0c             	push   0xc(%ebp)
+  80031b:	ff 75 08             	push   0x8(%ebp)
+  80031e:	e8 05 00 00 00       	call   800328 <vprintfmt>
+}
+  800323:	83 c4 10             	add    $0x10,%esp
+  800326:	c9                   	leave
+  800327:	c3                   	ret
+
+00800328 <vprintfmt>:
+{
+  800328:	55                   	push   %ebp
+  800329:	89 e5                	mov    %esp,%ebp
+  80032b:	57                   	push   %edi
+  80032c:	56                   	push   %esi
+  80032d:	53                   	push   %ebx
+  80032e:	83 ec 2c             	sub    $0x2c,%esp
+  800331:	8b 75 08             	mov    0x8(%ebp),%esi
+  800334:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800337:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80033a:	eb 0a                	jmp    800346 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80033c:	83 ec 08             	sub    $0x8,%esp
+  80033f:	53                   	push   %ebx
+  800340:	50                   	push   %eax
+  800341:	ff d6                	call   *%esi
+  800343:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800346:	83 c7 01             	add    $0x1,%edi
+  800349:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80034d:	83 f8 25             	cmp    $0x25,%eax
+  800350:	74 0c                	je     80035e <vprintfmt+0x36>
+			if (ch == '\0')
+  800352:	85 c0                	test   %eax,%eax
+  800354:	75 e6                	jne    80033c <vprintfmt+0x14>
+}
+  800356:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800359:	5b                   	pop    %ebx
+  80035a:	5e                   	pop    %esi
+  80035b:	5f                   	pop    %edi
+  80035c:	5d                   	pop    %ebp
+  80035d:	c3                   	ret
+		padc = ' ';
+  80035e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800362:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800369:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800370:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800377:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80037c:	8d 47 01             	lea    0x1(%edi),%eax
+  80037f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800382:	0f b6 17             	movzbl (%edi),%edx
+  800385:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800388:	3c 55                	cmp    $0x55,%al
+  80038a:	0f 87 cf 03 00 00    	ja     80075f <vprintfmt+0x437>
+  800390:	0f b6 c0             	movzbl %al,%eax
+  800393:	ff 24 85 e0 28 80 00 	jmp    *0x8028e0(,%eax,4)
+  80039a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80039d:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003a1:	eb d9                	jmp    80037c <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003a6:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003aa:	eb d0                	jmp    80037c <vprintfmt+0x54>
+  8003ac:	0f b6 d2             	movzbl %dl,%edx
+  8003af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003ba:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003bd:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003c1:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003c4:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003c7:	83 f9 09             	cmp    $0x9,%ecx
+  8003ca:	77 55                	ja     800421 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003cc:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003cf:	eb e9                	jmp    8003ba <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d4:	8b 00                	mov    (%eax),%eax
+  8003d6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8003df:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003e5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e9:	79 91                	jns    80037c <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003eb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003f1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003f8:	eb 82                	jmp    80037c <vprintfmt+0x54>
+			if (width < 0)
+  8003fa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003fd:	85 d2                	test   %edx,%edx
+  8003ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800404:	0f 49 c2             	cmovns %edx,%eax
+  800407:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80040a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80040d:	e9 6a ff ff ff       	jmp    80037c <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800412:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800415:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80041c:	e9 5b ff ff ff       	jmp    80037c <vprintfmt+0x54>
+  800421:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800424:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800427:	eb bc                	jmp    8003e5 <vprintfmt+0xbd>
+			lflag++;
+  800429:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80042c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80042f:	e9 48 ff ff ff       	jmp    80037c <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800434:	8b 45 14             	mov    0x14(%ebp),%eax
+  800437:	8d 78 04             	lea    0x4(%eax),%edi
+  80043a:	83 ec 08             	sub    $0x8,%esp
+  80043d:	53                   	push   %ebx
+  80043e:	ff 30                	push   (%eax)
+  800440:	ff d6                	call   *%esi
+			break;
+  800442:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800445:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800448:	e9 b1 02 00 00       	jmp    8006fe <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80044d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800450:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800453:	8b 10                	mov    (%eax),%edx
+  800455:	89 d0                	mov    %edx,%eax
+  800457:	f7 d8                	neg    %eax
+  800459:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80045c:	83 f8 0f             	cmp    $0xf,%eax
+  80045f:	7f 23                	jg     800484 <vprintfmt+0x15c>
+  800461:	8b 14 85 40 2a 80 00 	mov    0x802a40(,%eax,4),%edx
+  800468:	85 d2                	test   %edx,%edx
+  80046a:	74 18                	je     800484 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80046c:	52                   	push   %edx
+  80046d:	68 75 2b 80 00       	push   $0x802b75
+  800472:	53                   	push   %ebx
+  800473:	56                   	push   %esi
+  800474:	e8 92 fe ff ff       	call   80030b <printfmt>
+  800479:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047c:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80047f:	e9 7a 02 00 00       	jmp    8006fe <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800484:	50                   	push   %eax
+  800485:	68 af 27 80 00       	push   $0x8027af
+  80048a:	53                   	push   %ebx
+  80048b:	56                   	push   %esi
+  80048c:	e8 7a fe ff ff       	call   80030b <printfmt>
+  800491:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800494:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800497:	e9 62 02 00 00       	jmp    8006fe <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049f:	83 c0 04             	add    $0x4,%eax
+  8004a2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a8:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004aa:	85 c9                	test   %ecx,%ecx
+  8004ac:	b8 a8 27 80 00       	mov    $0x8027a8,%eax
+  8004b1:	0f 45 c1             	cmovne %ecx,%eax
+  8004b4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004b7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004bb:	7e 06                	jle    8004c3 <vprintfmt+0x19b>
+  8004bd:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004c1:	75 0b                	jne    8004ce <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004c6:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004c9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004cc:	eb 5c                	jmp    80052a <vprintfmt+0x202>
+  8004ce:	83 ec 08             	sub    $0x8,%esp
+  8004d1:	ff 75 d0             	push   -0x30(%ebp)
+  8004d4:	ff 75 cc             	push   -0x34(%ebp)
+  8004d7:	e8 20 03 00 00       	call   8007fc <strnlen>
+  8004dc:	89 c2                	mov    %eax,%edx
+  8004de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e1:	29 d0                	sub    %edx,%eax
+  8004e3:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004e6:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ed:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004f0:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f2:	eb 0e                	jmp    800502 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004f4:	83 ec 08             	sub    $0x8,%esp
+  8004f7:	53                   	push   %ebx
+  8004f8:	57                   	push   %edi
+  8004f9:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fc:	83 ee 01             	sub    $0x1,%esi
+  8004ff:	83 c4 10             	add    $0x10,%esp
+  800502:	85 f6                	test   %esi,%esi
+  800504:	7f ee                	jg     8004f4 <vprintfmt+0x1cc>
+  800506:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800509:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050c:	85 c0                	test   %eax,%eax
+  80050e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800513:	0f 49 d0             	cmovns %eax,%edx
+  800516:	29 d0                	sub    %edx,%eax
+  800518:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051b:	eb a6                	jmp    8004c3 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80051d:	83 ec 08             	sub    $0x8,%esp
+  800520:	53                   	push   %ebx
+  800521:	52                   	push   %edx
+  800522:	ff 55 08             	call   *0x8(%ebp)
+  800525:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800528:	89 f1                	mov    %esi,%ecx
+  80052a:	8d 71 01             	lea    0x1(%ecx),%esi
+  80052d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800531:	0f be d0             	movsbl %al,%edx
+  800534:	85 d2                	test   %edx,%edx
+  800536:	74 28                	je     800560 <vprintfmt+0x238>
+  800538:	85 ff                	test   %edi,%edi
+  80053a:	78 05                	js     800541 <vprintfmt+0x219>
+  80053c:	83 ef 01             	sub    $0x1,%edi
+  80053f:	78 30                	js     800571 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800541:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800545:	74 d6                	je     80051d <vprintfmt+0x1f5>
+  800547:	0f be c0             	movsbl %al,%eax
+  80054a:	83 e8 20             	sub    $0x20,%eax
+  80054d:	83 f8 5e             	cmp    $0x5e,%eax
+  800550:	76 cb                	jbe    80051d <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800552:	83 ec 08             	sub    $0x8,%esp
+  800555:	53                   	push   %ebx
+  800556:	6a 3f                	push   $0x3f
+  800558:	ff 55 08             	call   *0x8(%ebp)
+  80055b:	83 c4 10             	add    $0x10,%esp
+  80055e:	eb c8                	jmp    800528 <vprintfmt+0x200>
+  800560:	8b 75 08             	mov    0x8(%ebp),%esi
+  800563:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800566:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800569:	01 d0                	add    %edx,%eax
+  80056b:	29 c8                	sub    %ecx,%eax
+  80056d:	89 c7                	mov    %eax,%edi
+  80056f:	eb 13                	jmp    800584 <vprintfmt+0x25c>
+  800571:	8b 75 08             	mov    0x8(%ebp),%esi
+  800574:	eb ed                	jmp    800563 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800576:	83 ec 08             	sub    $0x8,%esp
+  800579:	53                   	push   %ebx
+  80057a:	6a 20                	push   $0x20
+  80057c:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80057e:	83 ef 01             	sub    $0x1,%edi
+  800581:	83 c4 10             	add    $0x10,%esp
+  800584:	85 ff                	test   %edi,%edi
+  800586:	7f ee                	jg     800576 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800588:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80058b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058e:	e9 6b 01 00 00       	jmp    8006fe <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800593:	83 f9 01             	cmp    $0x1,%ecx
+  800596:	7f 1f                	jg     8005b7 <vprintfmt+0x28f>
+	else if (lflag)
+  800598:	85 c9                	test   %ecx,%ecx
+  80059a:	74 67                	je     800603 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80059c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059f:	8b 00                	mov    (%eax),%eax
+  8005a1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a4:	89 c1                	mov    %eax,%ecx
+  8005a6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005a9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005af:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b5:	eb 17                	jmp    8005ce <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ba:	8b 50 04             	mov    0x4(%eax),%edx
+  8005bd:	8b 00                	mov    (%eax),%eax
+  8005bf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8d 40 08             	lea    0x8(%eax),%eax
+  8005cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005ce:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005d9:	85 c9                	test   %ecx,%ecx
+  8005db:	0f 89 03 01 00 00    	jns    8006e4 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 2d                	push   $0x2d
+  8005e7:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005e9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ec:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005ef:	f7 da                	neg    %edx
+  8005f1:	83 d1 00             	adc    $0x0,%ecx
+  8005f4:	f7 d9                	neg    %ecx
+  8005f6:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005fe:	e9 e1 00 00 00       	jmp    8006e4 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8b 00                	mov    (%eax),%eax
+  800608:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060b:	89 c1                	mov    %eax,%ecx
+  80060d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800610:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8d 40 04             	lea    0x4(%eax),%eax
+  800619:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061c:	eb b0                	jmp    8005ce <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80061e:	83 f9 01             	cmp    $0x1,%ecx
+  800621:	7f 1e                	jg     800641 <vprintfmt+0x319>
+	else if (lflag)
+  800623:	85 c9                	test   %ecx,%ecx
+  800625:	74 32                	je     800659 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800627:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062a:	8b 10                	mov    (%eax),%edx
+  80062c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800631:	8d 40 04             	lea    0x4(%eax),%eax
+  800634:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800637:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80063c:	e9 a3 00 00 00       	jmp    8006e4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800641:	8b 45 14             	mov    0x14(%ebp),%eax
+  800644:	8b 10                	mov    (%eax),%edx
+  800646:	8b 48 04             	mov    0x4(%eax),%ecx
+  800649:	8d 40 08             	lea    0x8(%eax),%eax
+  80064c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800654:	e9 8b 00 00 00       	jmp    8006e4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800659:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065c:	8b 10                	mov    (%eax),%edx
+  80065e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800663:	8d 40 04             	lea    0x4(%eax),%eax
+  800666:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800669:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80066e:	eb 74                	jmp    8006e4 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800670:	83 f9 01             	cmp    $0x1,%ecx
+  800673:	7f 1b                	jg     800690 <vprintfmt+0x368>
+	else if (lflag)
+  800675:	85 c9                	test   %ecx,%ecx
+  800677:	74 2c                	je     8006a5 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800679:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067c:	8b 10                	mov    (%eax),%edx
+  80067e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800683:	8d 40 04             	lea    0x4(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800689:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80068e:	eb 54                	jmp    8006e4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800690:	8b 45 14             	mov    0x14(%ebp),%eax
+  800693:	8b 10                	mov    (%eax),%edx
+  800695:	8b 48 04             	mov    0x4(%eax),%ecx
+  800698:	8d 40 08             	lea    0x8(%eax),%eax
+  80069b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80069e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006a3:	eb 3f                	jmp    8006e4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a8:	8b 10                	mov    (%eax),%edx
+  8006aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006af:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006b5:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006ba:	eb 28                	jmp    8006e4 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006bc:	83 ec 08             	sub    $0x8,%esp
+  8006bf:	53                   	push   %ebx
+  8006c0:	6a 30                	push   $0x30
+  8006c2:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006c4:	83 c4 08             	add    $0x8,%esp
+  8006c7:	53                   	push   %ebx
+  8006c8:	6a 78                	push   $0x78
+  8006ca:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cf:	8b 10                	mov    (%eax),%edx
+  8006d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006d6:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006df:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006e4:	83 ec 0c             	sub    $0xc,%esp
+  8006e7:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006eb:	50                   	push   %eax
+  8006ec:	ff 75 e0             	push   -0x20(%ebp)
+  8006ef:	57                   	push   %edi
+  8006f0:	51                   	push   %ecx
+  8006f1:	52                   	push   %edx
+  8006f2:	89 da                	mov    %ebx,%edx
+  8006f4:	89 f0                	mov    %esi,%eax
+  8006f6:	e8 4a fb ff ff       	call   800245 <printnum>
+			break;
+  8006fb:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800701:	e9 40 fc ff ff       	jmp    800346 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800706:	83 f9 01             	cmp    $0x1,%ecx
+  800709:	7f 1b                	jg     800726 <vprintfmt+0x3fe>
+	else if (lflag)
+  80070b:	85 c9                	test   %ecx,%ecx
+  80070d:	74 2c                	je     80073b <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8b 10                	mov    (%eax),%edx
+  800714:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800719:	8d 40 04             	lea    0x4(%eax),%eax
+  80071c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800724:	eb be                	jmp    8006e4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800726:	8b 45 14             	mov    0x14(%ebp),%eax
+  800729:	8b 10                	mov    (%eax),%edx
+  80072b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80072e:	8d 40 08             	lea    0x8(%eax),%eax
+  800731:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800734:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800739:	eb a9                	jmp    8006e4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80073b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073e:	8b 10                	mov    (%eax),%edx
+  800740:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800745:	8d 40 04             	lea    0x4(%eax),%eax
+  800748:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80074b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800750:	eb 92                	jmp    8006e4 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800752:	83 ec 08             	sub    $0x8,%esp
+  800755:	53                   	push   %ebx
+  800756:	6a 25                	push   $0x25
+  800758:	ff d6                	call   *%esi
+			break;
+  80075a:	83 c4 10             	add    $0x10,%esp
+  80075d:	eb 9f                	jmp    8006fe <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80075f:	83 ec 08             	sub    $0x8,%esp
+  800762:	53                   	push   %ebx
+  800763:	6a 25                	push   $0x25
+  800765:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800767:	83 c4 10             	add    $0x10,%esp
+  80076a:	89 f8                	mov    %edi,%eax
+  80076c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800770:	74 05                	je     800777 <vprintfmt+0x44f>
+  800772:	83 e8 01             	sub    $0x1,%eax
+  800775:	eb f5                	jmp    80076c <vprintfmt+0x444>
+  800777:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80077a:	eb 82                	jmp    8006fe <vprintfmt+0x3d6>
+
+0080077c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80077c:	55                   	push   %ebp
+  80077d:	89 e5                	mov    %esp,%ebp
+  80077f:	83 ec 18             	sub    $0x18,%esp
+  800782:	8b 45 08             	mov    0x8(%ebp),%eax
+  800785:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800788:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80078b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80078f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800792:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800799:	85 c0                	test   %eax,%eax
+  80079b:	74 26                	je     8007c3 <vsnprintf+0x47>
+  80079d:	85 d2                	test   %edx,%edx
+  80079f:	7e 22                	jle    8007c3 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007a1:	ff 75 14             	push   0x14(%ebp)
+  8007a4:	ff 75 10             	push   0x10(%ebp)
+  8007a7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007aa:	50                   	push   %eax
+  8007ab:	68 ee 02 80 00       	push   $0x8002ee
+  8007b0:	e8 73 fb ff ff       	call   800328 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007b5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007b8:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007be:	83 c4 10             	add    $0x10,%esp
+}
+  8007c1:	c9                   	leave
+  8007c2:	c3                   	ret
+		return -E_INVAL;
+  8007c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007c8:	eb f7                	jmp    8007c1 <vsnprintf+0x45>
+
+008007ca <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007ca:	55                   	push   %ebp
+  8007cb:	89 e5                	mov    %esp,%ebp
+  8007cd:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007d0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007d3:	50                   	push   %eax
+  8007d4:	ff 75 10             	push   0x10(%ebp)
+  8007d7:	ff 75 0c             	push   0xc(%ebp)
+  8007da:	ff 75 08             	push   0x8(%ebp)
+  8007dd:	e8 9a ff ff ff       	call   80077c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007e2:	c9                   	leave
+  8007e3:	c3                   	ret
+
+008007e4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007e4:	55                   	push   %ebp
+  8007e5:	89 e5                	mov    %esp,%ebp
+  8007e7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ef:	eb 03                	jmp    8007f4 <strlen+0x10>
+		n++;
+  8007f1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007f4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007f8:	75 f7                	jne    8007f1 <strlen+0xd>
+	return n;
+}
+  8007fa:	5d                   	pop    %ebp
+  8007fb:	c3                   	ret
+
+008007fc <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007fc:	55                   	push   %ebp
+  8007fd:	89 e5                	mov    %esp,%ebp
+  8007ff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800802:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800805:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080a:	eb 03                	jmp    80080f <strnlen+0x13>
+		n++;
+  80080c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80080f:	39 d0                	cmp    %edx,%eax
+  800811:	74 08                	je     80081b <strnlen+0x1f>
+  800813:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800817:	75 f3                	jne    80080c <strnlen+0x10>
+  800819:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80081b:	89 d0                	mov    %edx,%eax
+  80081d:	5d                   	pop    %ebp
+  80081e:	c3                   	ret
+
+0080081f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80081f:	55                   	push   %ebp
+  800820:	89 e5                	mov    %esp,%ebp
+  800822:	53                   	push   %ebx
+  800823:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800826:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800832:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800835:	83 c0 01             	add    $0x1,%eax
+  800838:	84 d2                	test   %dl,%dl
+  80083a:	75 f2                	jne    80082e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80083c:	89 c8                	mov    %ecx,%eax
+  80083e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800841:	c9                   	leave
+  800842:	c3                   	ret
+
+00800843 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800843:	55                   	push   %ebp
+  800844:	89 e5                	mov    %esp,%ebp
+  800846:	53                   	push   %ebx
+  800847:	83 ec 10             	sub    $0x10,%esp
+  80084a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80084d:	53                   	push   %ebx
+  80084e:	e8 91 ff ff ff       	call   8007e4 <strlen>
+  800853:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800856:	ff 75 0c             	push   0xc(%ebp)
+  800859:	01 d8                	add    %ebx,%eax
+  80085b:	50                   	push   %eax
+  80085c:	e8 be ff ff ff       	call   80081f <strcpy>
+	return dst;
+}
+  800861:	89 d8                	mov    %ebx,%eax
+  800863:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800866:	c9                   	leave
+  800867:	c3                   	ret
+
+00800868 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800868:	55                   	push   %ebp
+  800869:	89 e5                	mov    %esp,%ebp
+  80086b:	56                   	push   %esi
+  80086c:	53                   	push   %ebx
+  80086d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800870:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800873:	89 f3                	mov    %esi,%ebx
+  800875:	03 5d 10             	add    0x10(%ebp),%ebx
+  800878:	89 f0                	mov    %esi,%eax
+  80087a:	eb 0f                	jmp    80088b <strncpy+0x23>
+		*dst++ = *src;
+  80087c:	83 c0 01             	add    $0x1,%eax
+  80087f:	0f b6 0a             	movzbl (%edx),%ecx
+  800882:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800885:	80 f9 01             	cmp    $0x1,%cl
+  800888:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80088b:	39 d8                	cmp    %ebx,%eax
+  80088d:	75 ed                	jne    80087c <strncpy+0x14>
+	}
+	return ret;
+}
+  80088f:	89 f0                	mov    %esi,%eax
+  800891:	5b                   	pop    %ebx
+  800892:	5e                   	pop    %esi
+  800893:	5d                   	pop    %ebp
+  800894:	c3                   	ret
+
+00800895 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800895:	55                   	push   %ebp
+  800896:	89 e5                	mov    %esp,%ebp
+  800898:	56                   	push   %esi
+  800899:	53                   	push   %ebx
+  80089a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a0:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008a3:	89 f0                	mov    %esi,%eax
+  8008a5:	85 d2                	test   %edx,%edx
+  8008a7:	74 21                	je     8008ca <strlcpy+0x35>
+  8008a9:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008ad:	89 f2                	mov    %esi,%edx
+  8008af:	eb 09                	jmp    8008ba <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008b1:	83 c1 01             	add    $0x1,%ecx
+  8008b4:	83 c2 01             	add    $0x1,%edx
+  8008b7:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008ba:	39 c2                	cmp    %eax,%edx
+  8008bc:	74 09                	je     8008c7 <strlcpy+0x32>
+  8008be:	0f b6 19             	movzbl (%ecx),%ebx
+  8008c1:	84 db                	test   %bl,%bl
+  8008c3:	75 ec                	jne    8008b1 <strlcpy+0x1c>
+  8008c5:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008c7:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008ca:	29 f0                	sub    %esi,%eax
+}
+  8008cc:	5b                   	pop    %ebx
+  8008cd:	5e                   	pop    %esi
+  8008ce:	5d                   	pop    %ebp
+  8008cf:	c3                   	ret
+
+008008d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008d0:	55                   	push   %ebp
+  8008d1:	89 e5                	mov    %esp,%ebp
+  8008d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008d9:	eb 06                	jmp    8008e1 <strcmp+0x11>
+		p++, q++;
+  8008db:	83 c1 01             	add    $0x1,%ecx
+  8008de:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008e1:	0f b6 01             	movzbl (%ecx),%eax
+  8008e4:	84 c0                	test   %al,%al
+  8008e6:	74 04                	je     8008ec <strcmp+0x1c>
+  8008e8:	3a 02                	cmp    (%edx),%al
+  8008ea:	74 ef                	je     8008db <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ec:	0f b6 c0             	movzbl %al,%eax
+  8008ef:	0f b6 12             	movzbl (%edx),%edx
+  8008f2:	29 d0                	sub    %edx,%eax
+}
+  8008f4:	5d                   	pop    %ebp
+  8008f5:	c3                   	ret
+
+008008f6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	53                   	push   %ebx
+  8008fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800900:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800903:	eb 09                	jmp    80090e <strncmp+0x18>
+		n--, p++, q++;
+  800905:	83 ea 01             	sub    $0x1,%edx
+  800908:	83 c0 01             	add    $0x1,%eax
+  80090b:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80090e:	85 d2                	test   %edx,%edx
+  800910:	74 18                	je     80092a <strncmp+0x34>
+  800912:	0f b6 18             	movzbl (%eax),%ebx
+  800915:	84 db                	test   %bl,%bl
+  800917:	74 04                	je     80091d <strncmp+0x27>
+  800919:	3a 19                	cmp    (%ecx),%bl
+  80091b:	74 e8                	je     800905 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80091d:	0f b6 00             	movzbl (%eax),%eax
+  800920:	0f b6 11             	movzbl (%ecx),%edx
+  800923:	29 d0                	sub    %edx,%eax
+}
+  800925:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800928:	c9                   	leave
+  800929:	c3                   	ret
+		return 0;
+  80092a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092f:	eb f4                	jmp    800925 <strncmp+0x2f>
+
+00800931 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800931:	55                   	push   %ebp
+  800932:	89 e5                	mov    %esp,%ebp
+  800934:	8b 45 08             	mov    0x8(%ebp),%eax
+  800937:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80093b:	eb 03                	jmp    800940 <strchr+0xf>
+  80093d:	83 c0 01             	add    $0x1,%eax
+  800940:	0f b6 10             	movzbl (%eax),%edx
+  800943:	84 d2                	test   %dl,%dl
+  800945:	74 06                	je     80094d <strchr+0x1c>
+		if (*s == c)
+  800947:	38 ca                	cmp    %cl,%dl
+  800949:	75 f2                	jne    80093d <strchr+0xc>
+  80094b:	eb 05                	jmp    800952 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80094d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800952:	5d                   	pop    %ebp
+  800953:	c3                   	ret
+
+00800954 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800954:	55                   	push   %ebp
+  800955:	89 e5                	mov    %esp,%ebp
+  800957:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80095e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800961:	38 ca                	cmp    %cl,%dl
+  800963:	74 09                	je     80096e <strfind+0x1a>
+  800965:	84 d2                	test   %dl,%dl
+  800967:	74 05                	je     80096e <strfind+0x1a>
+	for (; *s; s++)
+  800969:	83 c0 01             	add    $0x1,%eax
+  80096c:	eb f0                	jmp    80095e <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80096e:	5d                   	pop    %ebp
+  80096f:	c3                   	ret
+
+00800970 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800970:	55                   	push   %ebp
+  800971:	89 e5                	mov    %esp,%ebp
+  800973:	57                   	push   %edi
+  800974:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800977:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80097a:	85 c9                	test   %ecx,%ecx
+  80097c:	74 20                	je     80099e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80097e:	89 f8                	mov    %edi,%eax
+  800980:	09 c8                	or     %ecx,%eax
+  800982:	a8 03                	test   $0x3,%al
+  800984:	75 12                	jne    800998 <memset+0x28>
+		c &= 0xFF;
+  800986:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80098a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800990:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800993:	fc                   	cld
+  800994:	f3 ab                	rep stos %eax,%es:(%edi)
+  800996:	eb 06                	jmp    80099e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800998:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80099b:	fc                   	cld
+  80099c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80099e:	89 f8                	mov    %edi,%eax
+  8009a0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009a3:	c9                   	leave
+  8009a4:	c3                   	ret
+
+008009a5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	57                   	push   %edi
+  8009a9:	56                   	push   %esi
+  8009aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009b0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009b3:	39 c6                	cmp    %eax,%esi
+  8009b5:	73 32                	jae    8009e9 <memmove+0x44>
+  8009b7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009ba:	39 d0                	cmp    %edx,%eax
+  8009bc:	73 2b                	jae    8009e9 <memmove+0x44>
+		s += n;
+		d += n;
+  8009be:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009c1:	89 d6                	mov    %edx,%esi
+  8009c3:	09 fe                	or     %edi,%esi
+  8009c5:	09 ce                	or     %ecx,%esi
+  8009c7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009cd:	75 0e                	jne    8009dd <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009cf:	83 ef 04             	sub    $0x4,%edi
+  8009d2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009d5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009d8:	fd                   	std
+  8009d9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009db:	eb 09                	jmp    8009e6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009dd:	83 ef 01             	sub    $0x1,%edi
+  8009e0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009e3:	fd                   	std
+  8009e4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009e6:	fc                   	cld
+  8009e7:	eb 1a                	jmp    800a03 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009e9:	89 f2                	mov    %esi,%edx
+  8009eb:	09 c2                	or     %eax,%edx
+  8009ed:	09 ca                	or     %ecx,%edx
+  8009ef:	f6 c2 03             	test   $0x3,%dl
+  8009f2:	75 0a                	jne    8009fe <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009f4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009f7:	89 c7                	mov    %eax,%edi
+  8009f9:	fc                   	cld
+  8009fa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009fc:	eb 05                	jmp    800a03 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009fe:	89 c7                	mov    %eax,%edi
+  800a00:	fc                   	cld
+  800a01:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a03:	5e                   	pop    %esi
+  800a04:	5f                   	pop    %edi
+  800a05:	5d                   	pop    %ebp
+  800a06:	c3                   	ret
+
+00800a07 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a07:	55                   	push   %ebp
+  800a08:	89 e5                	mov    %esp,%ebp
+  800a0a:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a0d:	ff 75 10             	push   0x10(%ebp)
+  800a10:	ff 75 0c             	push   0xc(%ebp)
+  800a13:	ff 75 08             	push   0x8(%ebp)
+  800a16:	e8 8a ff ff ff       	call   8009a5 <memmove>
+}
+  800a1b:	c9                   	leave
+  800a1c:	c3                   	ret
+
+00800a1d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a1d:	55                   	push   %ebp
+  800a1e:	89 e5                	mov    %esp,%ebp
+  800a20:	56                   	push   %esi
+  800a21:	53                   	push   %ebx
+  800a22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a25:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a28:	89 c6                	mov    %eax,%esi
+  800a2a:	03 75 10             	add    0x10(%ebp),%esi
+  800a2d:	eb 06                	jmp    800a35 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a2f:	83 c0 01             	add    $0x1,%eax
+  800a32:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a35:	39 f0                	cmp    %esi,%eax
+  800a37:	74 14                	je     800a4d <memcmp+0x30>
+		if (*s1 != *s2)
+  800a39:	0f b6 08             	movzbl (%eax),%ecx
+  800a3c:	0f b6 1a             	movzbl (%edx),%ebx
+  800a3f:	38 d9                	cmp    %bl,%cl
+  800a41:	74 ec                	je     800a2f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a43:	0f b6 c1             	movzbl %cl,%eax
+  800a46:	0f b6 db             	movzbl %bl,%ebx
+  800a49:	29 d8                	sub    %ebx,%eax
+  800a4b:	eb 05                	jmp    800a52 <memcmp+0x35>
+	}
+
+	return 0;
+  800a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a52:	5b                   	pop    %ebx
+  800a53:	5e                   	pop    %esi
+  800a54:	5d                   	pop    %ebp
+  800a55:	c3                   	ret
+
+00800a56 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a56:	55                   	push   %ebp
+  800a57:	89 e5                	mov    %esp,%ebp
+  800a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a5f:	89 c2                	mov    %eax,%edx
+  800a61:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a64:	eb 03                	jmp    800a69 <memfind+0x13>
+  800a66:	83 c0 01             	add    $0x1,%eax
+  800a69:	39 d0                	cmp    %edx,%eax
+  800a6b:	73 04                	jae    800a71 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a6d:	38 08                	cmp    %cl,(%eax)
+  800a6f:	75 f5                	jne    800a66 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a71:	5d                   	pop    %ebp
+  800a72:	c3                   	ret
+
+00800a73 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a73:	55                   	push   %ebp
+  800a74:	89 e5                	mov    %esp,%ebp
+  800a76:	57                   	push   %edi
+  800a77:	56                   	push   %esi
+  800a78:	53                   	push   %ebx
+  800a79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a7c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a7f:	eb 03                	jmp    800a84 <strtol+0x11>
+		s++;
+  800a81:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a84:	0f b6 02             	movzbl (%edx),%eax
+  800a87:	3c 20                	cmp    $0x20,%al
+  800a89:	74 f6                	je     800a81 <strtol+0xe>
+  800a8b:	3c 09                	cmp    $0x9,%al
+  800a8d:	74 f2                	je     800a81 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a8f:	3c 2b                	cmp    $0x2b,%al
+  800a91:	74 2a                	je     800abd <strtol+0x4a>
+	int neg = 0;
+  800a93:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a98:	3c 2d                	cmp    $0x2d,%al
+  800a9a:	74 2b                	je     800ac7 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a9c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aa2:	75 0f                	jne    800ab3 <strtol+0x40>
+  800aa4:	80 3a 30             	cmpb   $0x30,(%edx)
+  800aa7:	74 28                	je     800ad1 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aa9:	85 db                	test   %ebx,%ebx
+  800aab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ab0:	0f 44 d8             	cmove  %eax,%ebx
+  800ab3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab8:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800abb:	eb 46                	jmp    800b03 <strtol+0x90>
+		s++;
+  800abd:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ac0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ac5:	eb d5                	jmp    800a9c <strtol+0x29>
+		s++, neg = 1;
+  800ac7:	83 c2 01             	add    $0x1,%edx
+  800aca:	bf 01 00 00 00       	mov    $0x1,%edi
+  800acf:	eb cb                	jmp    800a9c <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ad5:	74 0e                	je     800ae5 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ad7:	85 db                	test   %ebx,%ebx
+  800ad9:	75 d8                	jne    800ab3 <strtol+0x40>
+		s++, base = 8;
+  800adb:	83 c2 01             	add    $0x1,%edx
+  800ade:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ae3:	eb ce                	jmp    800ab3 <strtol+0x40>
+		s += 2, base = 16;
+  800ae5:	83 c2 02             	add    $0x2,%edx
+  800ae8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800aed:	eb c4                	jmp    800ab3 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800aef:	0f be c0             	movsbl %al,%eax
+  800af2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800af5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800af8:	7d 3a                	jge    800b34 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800afa:	83 c2 01             	add    $0x1,%edx
+  800afd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b01:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b03:	0f b6 02             	movzbl (%edx),%eax
+  800b06:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b09:	89 f3                	mov    %esi,%ebx
+  800b0b:	80 fb 09             	cmp    $0x9,%bl
+  800b0e:	76 df                	jbe    800aef <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b10:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b13:	89 f3                	mov    %esi,%ebx
+  800b15:	80 fb 19             	cmp    $0x19,%bl
+  800b18:	77 08                	ja     800b22 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b1a:	0f be c0             	movsbl %al,%eax
+  800b1d:	83 e8 57             	sub    $0x57,%eax
+  800b20:	eb d3                	jmp    800af5 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b22:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b25:	89 f3                	mov    %esi,%ebx
+  800b27:	80 fb 19             	cmp    $0x19,%bl
+  800b2a:	77 08                	ja     800b34 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b2c:	0f be c0             	movsbl %al,%eax
+  800b2f:	83 e8 37             	sub    $0x37,%eax
+  800b32:	eb c1                	jmp    800af5 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b34:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b38:	74 05                	je     800b3f <strtol+0xcc>
+		*endptr = (char *) s;
+  800b3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b3d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b3f:	89 c8                	mov    %ecx,%eax
+  800b41:	f7 d8                	neg    %eax
+  800b43:	85 ff                	test   %edi,%edi
+  800b45:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b48:	89 c8                	mov    %ecx,%eax
+  800b4a:	5b                   	pop    %ebx
+  800b4b:	5e                   	pop    %esi
+  800b4c:	5f                   	pop    %edi
+  800b4d:	5d                   	pop    %ebp
+  800b4e:	c3                   	ret
+
+00800b4f <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	57                   	push   %edi
+  800b53:	56                   	push   %esi
+  800b54:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b60:	89 c3                	mov    %eax,%ebx
+  800b62:	89 c7                	mov    %eax,%edi
+  800b64:	89 c6                	mov    %eax,%esi
+  800b66:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b68:	5b                   	pop    %ebx
+  800b69:	5e                   	pop    %esi
+  800b6a:	5f                   	pop    %edi
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+
+00800b6d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	57                   	push   %edi
+  800b71:	56                   	push   %esi
+  800b72:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b78:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b7d:	89 d1                	mov    %edx,%ecx
+  800b7f:	89 d3                	mov    %edx,%ebx
+  800b81:	89 d7                	mov    %edx,%edi
+  800b83:	89 d6                	mov    %edx,%esi
+  800b85:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b87:	5b                   	pop    %ebx
+  800b88:	5e                   	pop    %esi
+  800b89:	5f                   	pop    %edi
+  800b8a:	5d                   	pop    %ebp
+  800b8b:	c3                   	ret
+
+00800b8c <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800b8c:	55                   	push   %ebp
+  800b8d:	89 e5                	mov    %esp,%ebp
+  800b8f:	57                   	push   %edi
+  800b90:	56                   	push   %esi
+  800b91:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b9a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b9f:	89 cb                	mov    %ecx,%ebx
+  800ba1:	89 cf                	mov    %ecx,%edi
+  800ba3:	89 ce                	mov    %ecx,%esi
+  800ba5:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800ba7:	5b                   	pop    %ebx
+  800ba8:	5e                   	pop    %esi
+  800ba9:	5f                   	pop    %edi
+  800baa:	5d                   	pop    %ebp
+  800bab:	c3                   	ret
+
+00800bac <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	57                   	push   %edi
+  800bb0:	56                   	push   %esi
+  800bb1:	53                   	push   %ebx
+  800bb2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bb5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbd:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bc2:	89 cb                	mov    %ecx,%ebx
+  800bc4:	89 cf                	mov    %ecx,%edi
+  800bc6:	89 ce                	mov    %ecx,%esi
+  800bc8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bca:	85 c0                	test   %eax,%eax
+  800bcc:	7f 08                	jg     800bd6 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd1:	5b                   	pop    %ebx
+  800bd2:	5e                   	pop    %esi
+  800bd3:	5f                   	pop    %edi
+  800bd4:	5d                   	pop    %ebp
+  800bd5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bd6:	83 ec 0c             	sub    $0xc,%esp
+  800bd9:	50                   	push   %eax
+  800bda:	6a 03                	push   $0x3
+  800bdc:	68 9f 2a 80 00       	push   $0x802a9f
+  800be1:	6a 23                	push   $0x23
+  800be3:	68 bc 2a 80 00       	push   $0x802abc
+  800be8:	e8 69 f5 ff ff       	call   800156 <_panic>
+
+00800bed <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bed:	55                   	push   %ebp
+  800bee:	89 e5                	mov    %esp,%ebp
+  800bf0:	57                   	push   %edi
+  800bf1:	56                   	push   %esi
+  800bf2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf8:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bfd:	89 d1                	mov    %edx,%ecx
+  800bff:	89 d3                	mov    %edx,%ebx
+  800c01:	89 d7                	mov    %edx,%edi
+  800c03:	89 d6                	mov    %edx,%esi
+  800c05:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c07:	5b                   	pop    %ebx
+  800c08:	5e                   	pop    %esi
+  800c09:	5f                   	pop    %edi
+  800c0a:	5d                   	pop    %ebp
+  800c0b:	c3                   	ret
+
+00800c0c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c0c:	55                   	push   %ebp
+  800c0d:	89 e5                	mov    %esp,%ebp
+  800c0f:	57                   	push   %edi
+  800c10:	56                   	push   %esi
+  800c11:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c12:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c17:	b8 16 00 00 00       	mov    $0x16,%eax
+  800c1c:	89 d1                	mov    %edx,%ecx
+  800c1e:	89 d3                	mov    %edx,%ebx
+  800c20:	89 d7                	mov    %edx,%edi
+  800c22:	89 d6                	mov    %edx,%esi
+  800c24:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c26:	5b                   	pop    %ebx
+  800c27:	5e                   	pop    %esi
+  800c28:	5f                   	pop    %edi
+  800c29:	5d                   	pop    %ebp
+  800c2a:	c3                   	ret
+
+00800c2b <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800c2b:	55                   	push   %ebp
+  800c2c:	89 e5                	mov    %esp,%ebp
+  800c2e:	57                   	push   %edi
+  800c2f:	56                   	push   %esi
+  800c30:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c36:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800c3b:	89 d1                	mov    %edx,%ecx
+  800c3d:	89 d3                	mov    %edx,%ebx
+  800c3f:	89 d7                	mov    %edx,%edi
+  800c41:	89 d6                	mov    %edx,%esi
+  800c43:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800c45:	5b                   	pop    %ebx
+  800c46:	5e                   	pop    %esi
+  800c47:	5f                   	pop    %edi
+  800c48:	5d                   	pop    %ebp
+  800c49:	c3                   	ret
+
+00800c4a <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800c4a:	55                   	push   %ebp
+  800c4b:	89 e5                	mov    %esp,%ebp
+  800c4d:	57                   	push   %edi
+  800c4e:	56                   	push   %esi
+  800c4f:	53                   	push   %ebx
+  800c50:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5e:	b8 15 00 00 00       	mov    $0x15,%eax
+  800c63:	89 df                	mov    %ebx,%edi
+  800c65:	89 de                	mov    %ebx,%esi
+  800c67:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c69:	85 c0                	test   %eax,%eax
+  800c6b:	7f 08                	jg     800c75 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800c6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c70:	5b                   	pop    %ebx
+  800c71:	5e                   	pop    %esi
+  800c72:	5f                   	pop    %edi
+  800c73:	5d                   	pop    %ebp
+  800c74:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c75:	83 ec 0c             	sub    $0xc,%esp
+  800c78:	50                   	push   %eax
+  800c79:	6a 15                	push   $0x15
+  800c7b:	68 9f 2a 80 00       	push   $0x802a9f
+  800c80:	6a 23                	push   $0x23
+  800c82:	68 bc 2a 80 00       	push   $0x802abc
+  800c87:	e8 ca f4 ff ff       	call   800156 <_panic>
+
+00800c8c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c8c:	55                   	push   %ebp
+  800c8d:	89 e5                	mov    %esp,%ebp
+  800c8f:	57                   	push   %edi
+  800c90:	56                   	push   %esi
+  800c91:	53                   	push   %ebx
+  800c92:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c95:	be 00 00 00 00       	mov    $0x0,%esi
+  800c9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ca5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ca8:	89 f7                	mov    %esi,%edi
+  800caa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cac:	85 c0                	test   %eax,%eax
+  800cae:	7f 08                	jg     800cb8 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb3:	5b                   	pop    %ebx
+  800cb4:	5e                   	pop    %esi
+  800cb5:	5f                   	pop    %edi
+  800cb6:	5d                   	pop    %ebp
+  800cb7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb8:	83 ec 0c             	sub    $0xc,%esp
+  800cbb:	50                   	push   %eax
+  800cbc:	6a 05                	push   $0x5
+  800cbe:	68 9f 2a 80 00       	push   $0x802a9f
+  800cc3:	6a 23                	push   $0x23
+  800cc5:	68 bc 2a 80 00       	push   $0x802abc
+  800cca:	e8 87 f4 ff ff       	call   800156 <_panic>
+
+00800ccf <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	57                   	push   %edi
+  800cd3:	56                   	push   %esi
+  800cd4:	53                   	push   %ebx
+  800cd5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cd8:	be 00 00 00 00       	mov    $0x0,%esi
+  800cdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce3:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ce8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ceb:	89 f7                	mov    %esi,%edi
+  800ced:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cef:	85 c0                	test   %eax,%eax
+  800cf1:	7f 08                	jg     800cfb <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf6:	5b                   	pop    %ebx
+  800cf7:	5e                   	pop    %esi
+  800cf8:	5f                   	pop    %edi
+  800cf9:	5d                   	pop    %ebp
+  800cfa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cfb:	83 ec 0c             	sub    $0xc,%esp
+  800cfe:	50                   	push   %eax
+  800cff:	6a 06                	push   $0x6
+  800d01:	68 9f 2a 80 00       	push   $0x802a9f
+  800d06:	6a 23                	push   $0x23
+  800d08:	68 bc 2a 80 00       	push   $0x802abc
+  800d0d:	e8 44 f4 ff ff       	call   800156 <_panic>
+
+00800d12 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	57                   	push   %edi
+  800d16:	56                   	push   %esi
+  800d17:	53                   	push   %ebx
+  800d18:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d21:	b8 07 00 00 00       	mov    $0x7,%eax
+  800d26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d29:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d2c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d2f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d31:	85 c0                	test   %eax,%eax
+  800d33:	7f 08                	jg     800d3d <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d38:	5b                   	pop    %ebx
+  800d39:	5e                   	pop    %esi
+  800d3a:	5f                   	pop    %edi
+  800d3b:	5d                   	pop    %ebp
+  800d3c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d3d:	83 ec 0c             	sub    $0xc,%esp
+  800d40:	50                   	push   %eax
+  800d41:	6a 07                	push   $0x7
+  800d43:	68 9f 2a 80 00       	push   $0x802a9f
+  800d48:	6a 23                	push   $0x23
+  800d4a:	68 bc 2a 80 00       	push   $0x802abc
+  800d4f:	e8 02 f4 ff ff       	call   800156 <_panic>
+
+00800d54 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d54:	55                   	push   %ebp
+  800d55:	89 e5                	mov    %esp,%ebp
+  800d57:	57                   	push   %edi
+  800d58:	56                   	push   %esi
+  800d59:	53                   	push   %ebx
+  800d5a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d68:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d6d:	89 df                	mov    %ebx,%edi
+  800d6f:	89 de                	mov    %ebx,%esi
+  800d71:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d73:	85 c0                	test   %eax,%eax
+  800d75:	7f 08                	jg     800d7f <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d7a:	5b                   	pop    %ebx
+  800d7b:	5e                   	pop    %esi
+  800d7c:	5f                   	pop    %edi
+  800d7d:	5d                   	pop    %ebp
+  800d7e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d7f:	83 ec 0c             	sub    $0xc,%esp
+  800d82:	50                   	push   %eax
+  800d83:	6a 08                	push   $0x8
+  800d85:	68 9f 2a 80 00       	push   $0x802a9f
+  800d8a:	6a 23                	push   $0x23
+  800d8c:	68 bc 2a 80 00       	push   $0x802abc
+  800d91:	e8 c0 f3 ff ff       	call   800156 <_panic>
+
+00800d96 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d96:	55                   	push   %ebp
+  800d97:	89 e5                	mov    %esp,%ebp
+  800d99:	57                   	push   %edi
+  800d9a:	56                   	push   %esi
+  800d9b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da2:	b8 09 00 00 00       	mov    $0x9,%eax
+  800da7:	be 00 00 00 00       	mov    $0x0,%esi
+  800dac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800daf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db2:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800db4:	5b                   	pop    %ebx
+  800db5:	5e                   	pop    %esi
+  800db6:	5f                   	pop    %edi
+  800db7:	5d                   	pop    %ebp
+  800db8:	c3                   	ret
+
+00800db9 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	57                   	push   %edi
+  800dbd:	56                   	push   %esi
+  800dbe:	53                   	push   %ebx
+  800dbf:	8b 45 18             	mov    0x18(%ebp),%eax
+  800dc2:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800dc5:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800dca:	77 27                	ja     800df3 <sys_page_map_range+0x3a>
+  800dcc:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800dd2:	77 1f                	ja     800df3 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800dd4:	c1 e0 0c             	shl    $0xc,%eax
+  800dd7:	89 c6                	mov    %eax,%esi
+  800dd9:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800ddb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800de6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dec:	cd 30                	int    $0x30
+}
+  800dee:	5b                   	pop    %ebx
+  800def:	5e                   	pop    %esi
+  800df0:	5f                   	pop    %edi
+  800df1:	5d                   	pop    %ebp
+  800df2:	c3                   	ret
+		return -E_INVAL;
+  800df3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800df8:	eb f4                	jmp    800dee <sys_page_map_range+0x35>
+
+00800dfa <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	57                   	push   %edi
+  800dfe:	56                   	push   %esi
+  800dff:	53                   	push   %ebx
+  800e00:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e09:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e0e:	be 00 00 00 00       	mov    $0x0,%esi
+  800e13:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e16:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e19:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e1b:	85 c0                	test   %eax,%eax
+  800e1d:	7f 08                	jg     800e27 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e27:	83 ec 0c             	sub    $0xc,%esp
+  800e2a:	50                   	push   %eax
+  800e2b:	6a 0c                	push   $0xc
+  800e2d:	68 9f 2a 80 00       	push   $0x802a9f
+  800e32:	6a 23                	push   $0x23
+  800e34:	68 bc 2a 80 00       	push   $0x802abc
+  800e39:	e8 18 f3 ff ff       	call   800156 <_panic>
+
+00800e3e <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	57                   	push   %edi
+  800e42:	56                   	push   %esi
+  800e43:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e44:	be 00 00 00 00       	mov    $0x0,%esi
+  800e49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e57:	89 f7                	mov    %esi,%edi
+  800e59:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e5b:	5b                   	pop    %ebx
+  800e5c:	5e                   	pop    %esi
+  800e5d:	5f                   	pop    %edi
+  800e5e:	5d                   	pop    %ebp
+  800e5f:	c3                   	ret
+
+00800e60 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	57                   	push   %edi
+  800e64:	56                   	push   %esi
+  800e65:	53                   	push   %ebx
+  800e66:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e74:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e79:	89 df                	mov    %ebx,%edi
+  800e7b:	89 de                	mov    %ebx,%esi
+  800e7d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e7f:	85 c0                	test   %eax,%eax
+  800e81:	7f 08                	jg     800e8b <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e86:	5b                   	pop    %ebx
+  800e87:	5e                   	pop    %esi
+  800e88:	5f                   	pop    %edi
+  800e89:	5d                   	pop    %ebp
+  800e8a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8b:	83 ec 0c             	sub    $0xc,%esp
+  800e8e:	50                   	push   %eax
+  800e8f:	6a 0f                	push   $0xf
+  800e91:	68 9f 2a 80 00       	push   $0x802a9f
+  800e96:	6a 23                	push   $0x23
+  800e98:	68 bc 2a 80 00       	push   $0x802abc
+  800e9d:	e8 b4 f2 ff ff       	call   800156 <_panic>
+
+00800ea2 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800ea2:	55                   	push   %ebp
+  800ea3:	89 e5                	mov    %esp,%ebp
+  800ea5:	57                   	push   %edi
+  800ea6:	56                   	push   %esi
+  800ea7:	53                   	push   %ebx
+  800ea8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb6:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ebb:	89 df                	mov    %ebx,%edi
+  800ebd:	89 de                	mov    %ebx,%esi
+  800ebf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec1:	85 c0                	test   %eax,%eax
+  800ec3:	7f 08                	jg     800ecd <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800ec5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec8:	5b                   	pop    %ebx
+  800ec9:	5e                   	pop    %esi
+  800eca:	5f                   	pop    %edi
+  800ecb:	5d                   	pop    %ebp
+  800ecc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ecd:	83 ec 0c             	sub    $0xc,%esp
+  800ed0:	50                   	push   %eax
+  800ed1:	6a 10                	push   $0x10
+  800ed3:	68 9f 2a 80 00       	push   $0x802a9f
+  800ed8:	6a 23                	push   $0x23
+  800eda:	68 bc 2a 80 00       	push   $0x802abc
+  800edf:	e8 72 f2 ff ff       	call   800156 <_panic>
+
+00800ee4 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	57                   	push   %edi
+  800ee8:	56                   	push   %esi
+  800ee9:	53                   	push   %ebx
+  800eea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef8:	b8 11 00 00 00       	mov    $0x11,%eax
+  800efd:	89 df                	mov    %ebx,%edi
+  800eff:	89 de                	mov    %ebx,%esi
+  800f01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f03:	85 c0                	test   %eax,%eax
+  800f05:	7f 08                	jg     800f0f <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800f07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0a:	5b                   	pop    %ebx
+  800f0b:	5e                   	pop    %esi
+  800f0c:	5f                   	pop    %edi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0f:	83 ec 0c             	sub    $0xc,%esp
+  800f12:	50                   	push   %eax
+  800f13:	6a 11                	push   $0x11
+  800f15:	68 9f 2a 80 00       	push   $0x802a9f
+  800f1a:	6a 23                	push   $0x23
+  800f1c:	68 bc 2a 80 00       	push   $0x802abc
+  800f21:	e8 30 f2 ff ff       	call   800156 <_panic>
+
+00800f26 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800f26:	55                   	push   %ebp
+  800f27:	89 e5                	mov    %esp,%ebp
+  800f29:	57                   	push   %edi
+  800f2a:	56                   	push   %esi
+  800f2b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f31:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f36:	89 d1                	mov    %edx,%ecx
+  800f38:	89 d3                	mov    %edx,%ebx
+  800f3a:	89 d7                	mov    %edx,%edi
+  800f3c:	89 d6                	mov    %edx,%esi
+  800f3e:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800f40:	5b                   	pop    %ebx
+  800f41:	5e                   	pop    %esi
+  800f42:	5f                   	pop    %edi
+  800f43:	5d                   	pop    %ebp
+  800f44:	c3                   	ret
+
+00800f45 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f45:	55                   	push   %ebp
+  800f46:	89 e5                	mov    %esp,%ebp
+  800f48:	57                   	push   %edi
+  800f49:	56                   	push   %esi
+  800f4a:	53                   	push   %ebx
+  800f4b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f59:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f5e:	89 df                	mov    %ebx,%edi
+  800f60:	89 de                	mov    %ebx,%esi
+  800f62:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f64:	85 c0                	test   %eax,%eax
+  800f66:	7f 08                	jg     800f70 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f6b:	5b                   	pop    %ebx
+  800f6c:	5e                   	pop    %esi
+  800f6d:	5f                   	pop    %edi
+  800f6e:	5d                   	pop    %ebp
+  800f6f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f70:	83 ec 0c             	sub    $0xc,%esp
+  800f73:	50                   	push   %eax
+  800f74:	6a 13                	push   $0x13
+  800f76:	68 9f 2a 80 00       	push   $0x802a9f
+  800f7b:	6a 23                	push   $0x23
+  800f7d:	68 bc 2a 80 00       	push   $0x802abc
+  800f82:	e8 cf f1 ff ff       	call   800156 <_panic>
+
+00800f87 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f87:	55                   	push   %ebp
+  800f88:	89 e5                	mov    %esp,%ebp
+  800f8a:	57                   	push   %edi
+  800f8b:	56                   	push   %esi
+  800f8c:	53                   	push   %ebx
+  800f8d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f90:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9b:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fa0:	89 df                	mov    %ebx,%edi
+  800fa2:	89 de                	mov    %ebx,%esi
+  800fa4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa6:	85 c0                	test   %eax,%eax
+  800fa8:	7f 08                	jg     800fb2 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800faa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fad:	5b                   	pop    %ebx
+  800fae:	5e                   	pop    %esi
+  800faf:	5f                   	pop    %edi
+  800fb0:	5d                   	pop    %ebp
+  800fb1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb2:	83 ec 0c             	sub    $0xc,%esp
+  800fb5:	50                   	push   %eax
+  800fb6:	6a 14                	push   $0x14
+  800fb8:	68 9f 2a 80 00       	push   $0x802a9f
+  800fbd:	6a 23                	push   $0x23
+  800fbf:	68 bc 2a 80 00       	push   $0x802abc
+  800fc4:	e8 8d f1 ff ff       	call   800156 <_panic>
+
+00800fc9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	57                   	push   %edi
+  800fcd:	56                   	push   %esi
+  800fce:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd5:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fda:	be 00 00 00 00       	mov    $0x0,%esi
+  800fdf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fe5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fe7:	5b                   	pop    %ebx
+  800fe8:	5e                   	pop    %esi
+  800fe9:	5f                   	pop    %edi
+  800fea:	5d                   	pop    %ebp
+  800feb:	c3                   	ret
+
+00800fec <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fec:	55                   	push   %ebp
+  800fed:	89 e5                	mov    %esp,%ebp
+  800fef:	57                   	push   %edi
+  800ff0:	56                   	push   %esi
+  800ff1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff8:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ffd:	be 00 00 00 00       	mov    $0x0,%esi
+  801002:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801005:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801008:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80100a:	5b                   	pop    %ebx
+  80100b:	5e                   	pop    %esi
+  80100c:	5f                   	pop    %edi
+  80100d:	5d                   	pop    %ebp
+  80100e:	c3                   	ret
+
+0080100f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	56                   	push   %esi
+  801014:	53                   	push   %ebx
+  801015:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801018:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801020:	b8 19 00 00 00       	mov    $0x19,%eax
+  801025:	89 cb                	mov    %ecx,%ebx
+  801027:	89 cf                	mov    %ecx,%edi
+  801029:	89 ce                	mov    %ecx,%esi
+  80102b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80102d:	85 c0                	test   %eax,%eax
+  80102f:	7f 08                	jg     801039 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801031:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801034:	5b                   	pop    %ebx
+  801035:	5e                   	pop    %esi
+  801036:	5f                   	pop    %edi
+  801037:	5d                   	pop    %ebp
+  801038:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801039:	83 ec 0c             	sub    $0xc,%esp
+  80103c:	50                   	push   %eax
+  80103d:	6a 19                	push   $0x19
+  80103f:	68 9f 2a 80 00       	push   $0x802a9f
+  801044:	6a 23                	push   $0x23
+  801046:	68 bc 2a 80 00       	push   $0x802abc
+  80104b:	e8 06 f1 ff ff       	call   800156 <_panic>
+
+00801050 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801050:	55                   	push   %ebp
+  801051:	89 e5                	mov    %esp,%ebp
+  801053:	57                   	push   %edi
+  801054:	56                   	push   %esi
+  801055:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801056:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801060:	89 d1                	mov    %edx,%ecx
+  801062:	89 d3                	mov    %edx,%ebx
+  801064:	89 d7                	mov    %edx,%edi
+  801066:	89 d6                	mov    %edx,%esi
+  801068:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80106a:	5b                   	pop    %ebx
+  80106b:	5e                   	pop    %esi
+  80106c:	5f                   	pop    %edi
+  80106d:	5d                   	pop    %ebp
+  80106e:	c3                   	ret
+
+0080106f <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801075:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801080:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801085:	89 df                	mov    %ebx,%edi
+  801087:	89 de                	mov    %ebx,%esi
+  801089:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  80108b:	5b                   	pop    %ebx
+  80108c:	5e                   	pop    %esi
+  80108d:	5f                   	pop    %edi
+  80108e:	5d                   	pop    %ebp
+  80108f:	c3                   	ret
+
+00801090 <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  801090:	55                   	push   %ebp
+  801091:	89 e5                	mov    %esp,%ebp
+  801093:	57                   	push   %edi
+  801094:	56                   	push   %esi
+  801095:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801096:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010a6:	89 df                	mov    %ebx,%edi
+  8010a8:	89 de                	mov    %ebx,%esi
+  8010aa:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  8010ac:	5b                   	pop    %ebx
+  8010ad:	5e                   	pop    %esi
+  8010ae:	5f                   	pop    %edi
+  8010af:	5d                   	pop    %ebp
+  8010b0:	c3                   	ret
+
+008010b1 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010b7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010bc:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	c3                   	ret
+
+008010c1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010c7:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8010cc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8010d1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	c3                   	ret
+
+008010d8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8010db:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8010e0:	eb 02                	jmp    8010e4 <fd_alloc+0xc>
+  8010e2:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8010e4:	89 c2                	mov    %eax,%edx
+  8010e6:	c1 ea 16             	shr    $0x16,%edx
+  8010e9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010f0:	f6 c2 01             	test   $0x1,%dl
+  8010f3:	74 2b                	je     801120 <fd_alloc+0x48>
+  8010f5:	89 c2                	mov    %eax,%edx
+  8010f7:	c1 ea 0c             	shr    $0xc,%edx
+  8010fa:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801101:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801107:	f6 c1 01             	test   $0x1,%cl
+  80110a:	74 14                	je     801120 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80110c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801112:	75 ce                	jne    8010e2 <fd_alloc+0xa>
+  801114:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801119:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80111e:	eb 05                	jmp    801125 <fd_alloc+0x4d>
+			return 0;
+  801120:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801125:	8b 55 08             	mov    0x8(%ebp),%edx
+  801128:	89 02                	mov    %eax,(%edx)
+}
+  80112a:	89 c8                	mov    %ecx,%eax
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+
+0080112e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801134:	83 f8 1f             	cmp    $0x1f,%eax
+  801137:	77 30                	ja     801169 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801139:	c1 e0 0c             	shl    $0xc,%eax
+  80113c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801141:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801147:	f6 c2 01             	test   $0x1,%dl
+  80114a:	74 24                	je     801170 <fd_lookup+0x42>
+  80114c:	89 c2                	mov    %eax,%edx
+  80114e:	c1 ea 0c             	shr    $0xc,%edx
+  801151:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801158:	f6 c2 01             	test   $0x1,%dl
+  80115b:	74 1a                	je     801177 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80115d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801160:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801162:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801167:	5d                   	pop    %ebp
+  801168:	c3                   	ret
+		return -E_INVAL;
+  801169:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80116e:	eb f7                	jmp    801167 <fd_lookup+0x39>
+		return -E_INVAL;
+  801170:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801175:	eb f0                	jmp    801167 <fd_lookup+0x39>
+  801177:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80117c:	eb e9                	jmp    801167 <fd_lookup+0x39>
+
+0080117e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	53                   	push   %ebx
+  801182:	83 ec 04             	sub    $0x4,%esp
+  801185:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801188:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118d:	eb 03                	jmp    801192 <dev_lookup+0x14>
+  80118f:	83 c0 01             	add    $0x1,%eax
+  801192:	8b 1c 85 48 2b 80 00 	mov    0x802b48(,%eax,4),%ebx
+  801199:	85 db                	test   %ebx,%ebx
+  80119b:	74 0b                	je     8011a8 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80119d:	39 13                	cmp    %edx,(%ebx)
+  80119f:	75 ee                	jne    80118f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8011a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a6:	eb 1f                	jmp    8011c7 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8011a8:	a1 08 40 80 00       	mov    0x804008,%eax
+  8011ad:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8011b0:	83 ec 04             	sub    $0x4,%esp
+  8011b3:	52                   	push   %edx
+  8011b4:	50                   	push   %eax
+  8011b5:	68 cc 2a 80 00       	push   $0x802acc
+  8011ba:	e8 72 f0 ff ff       	call   800231 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8011bf:	83 c4 10             	add    $0x10,%esp
+  8011c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8011c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011ca:	89 1a                	mov    %ebx,(%edx)
+}
+  8011cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011cf:	c9                   	leave
+  8011d0:	c3                   	ret
+
+008011d1 <fd_close>:
+{
+  8011d1:	55                   	push   %ebp
+  8011d2:	89 e5                	mov    %esp,%ebp
+  8011d4:	57                   	push   %edi
+  8011d5:	56                   	push   %esi
+  8011d6:	53                   	push   %ebx
+  8011d7:	83 ec 24             	sub    $0x24,%esp
+  8011da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011e0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011e3:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011e4:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011ea:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011ed:	50                   	push   %eax
+  8011ee:	e8 3b ff ff ff       	call   80112e <fd_lookup>
+  8011f3:	89 c3                	mov    %eax,%ebx
+  8011f5:	83 c4 10             	add    $0x10,%esp
+  8011f8:	85 c0                	test   %eax,%eax
+  8011fa:	78 05                	js     801201 <fd_close+0x30>
+	    || fd != fd2)
+  8011fc:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011ff:	74 16                	je     801217 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801201:	89 f8                	mov    %edi,%eax
+  801203:	84 c0                	test   %al,%al
+  801205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80120d:	89 d8                	mov    %ebx,%eax
+  80120f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801212:	5b                   	pop    %ebx
+  801213:	5e                   	pop    %esi
+  801214:	5f                   	pop    %edi
+  801215:	5d                   	pop    %ebp
+  801216:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801217:	83 ec 08             	sub    $0x8,%esp
+  80121a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80121d:	50                   	push   %eax
+  80121e:	ff 36                	push   (%esi)
+  801220:	e8 59 ff ff ff       	call   80117e <dev_lookup>
+  801225:	89 c3                	mov    %eax,%ebx
+  801227:	83 c4 10             	add    $0x10,%esp
+  80122a:	85 c0                	test   %eax,%eax
+  80122c:	78 1a                	js     801248 <fd_close+0x77>
+		if (dev->dev_close)
+  80122e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801231:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801234:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801239:	85 c0                	test   %eax,%eax
+  80123b:	74 0b                	je     801248 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80123d:	83 ec 0c             	sub    $0xc,%esp
+  801240:	56                   	push   %esi
+  801241:	ff d0                	call   *%eax
+  801243:	89 c3                	mov    %eax,%ebx
+  801245:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801248:	83 ec 08             	sub    $0x8,%esp
+  80124b:	56                   	push   %esi
+  80124c:	6a 00                	push   $0x0
+  80124e:	e8 01 fb ff ff       	call   800d54 <sys_page_unmap>
+	return r;
+  801253:	83 c4 10             	add    $0x10,%esp
+  801256:	eb b5                	jmp    80120d <fd_close+0x3c>
+
+00801258 <close>:
+
+int
+close(int fdnum)
+{
+  801258:	55                   	push   %ebp
+  801259:	89 e5                	mov    %esp,%ebp
+  80125b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80125e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801261:	50                   	push   %eax
+  801262:	ff 75 08             	push   0x8(%ebp)
+  801265:	e8 c4 fe ff ff       	call   80112e <fd_lookup>
+  80126a:	83 c4 10             	add    $0x10,%esp
+  80126d:	85 c0                	test   %eax,%eax
+  80126f:	79 02                	jns    801273 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801271:	c9                   	leave
+  801272:	c3                   	ret
+		return fd_close(fd, 1);
+  801273:	83 ec 08             	sub    $0x8,%esp
+  801276:	6a 01                	push   $0x1
+  801278:	ff 75 f4             	push   -0xc(%ebp)
+  80127b:	e8 51 ff ff ff       	call   8011d1 <fd_close>
+  801280:	83 c4 10             	add    $0x10,%esp
+  801283:	eb ec                	jmp    801271 <close+0x19>
+
+00801285 <close_all>:
+
+void
+close_all(void)
+{
+  801285:	55                   	push   %ebp
+  801286:	89 e5                	mov    %esp,%ebp
+  801288:	53                   	push   %ebx
+  801289:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80128c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801291:	83 ec 0c             	sub    $0xc,%esp
+  801294:	53                   	push   %ebx
+  801295:	e8 be ff ff ff       	call   801258 <close>
+	for (i = 0; i < MAXFD; i++)
+  80129a:	83 c3 01             	add    $0x1,%ebx
+  80129d:	83 c4 10             	add    $0x10,%esp
+  8012a0:	83 fb 20             	cmp    $0x20,%ebx
+  8012a3:	75 ec                	jne    801291 <close_all+0xc>
+}
+  8012a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012a8:	c9                   	leave
+  8012a9:	c3                   	ret
+
+008012aa <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8012aa:	55                   	push   %ebp
+  8012ab:	89 e5                	mov    %esp,%ebp
+  8012ad:	57                   	push   %edi
+  8012ae:	56                   	push   %esi
+  8012af:	53                   	push   %ebx
+  8012b0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8012b3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012b6:	50                   	push   %eax
+  8012b7:	ff 75 08             	push   0x8(%ebp)
+  8012ba:	e8 6f fe ff ff       	call   80112e <fd_lookup>
+  8012bf:	89 c3                	mov    %eax,%ebx
+  8012c1:	83 c4 10             	add    $0x10,%esp
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	78 7f                	js     801347 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8012c8:	83 ec 0c             	sub    $0xc,%esp
+  8012cb:	ff 75 0c             	push   0xc(%ebp)
+  8012ce:	e8 85 ff ff ff       	call   801258 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8012d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8012d6:	c1 e6 0c             	shl    $0xc,%esi
+  8012d9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8012df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8012e2:	89 3c 24             	mov    %edi,(%esp)
+  8012e5:	e8 d7 fd ff ff       	call   8010c1 <fd2data>
+  8012ea:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012ec:	89 34 24             	mov    %esi,(%esp)
+  8012ef:	e8 cd fd ff ff       	call   8010c1 <fd2data>
+  8012f4:	83 c4 10             	add    $0x10,%esp
+  8012f7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012fa:	89 d8                	mov    %ebx,%eax
+  8012fc:	c1 e8 16             	shr    $0x16,%eax
+  8012ff:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801306:	a8 01                	test   $0x1,%al
+  801308:	74 11                	je     80131b <dup+0x71>
+  80130a:	89 d8                	mov    %ebx,%eax
+  80130c:	c1 e8 0c             	shr    $0xc,%eax
+  80130f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801316:	f6 c2 01             	test   $0x1,%dl
+  801319:	75 36                	jne    801351 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80131b:	89 f8                	mov    %edi,%eax
+  80131d:	c1 e8 0c             	shr    $0xc,%eax
+  801320:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801327:	83 ec 0c             	sub    $0xc,%esp
+  80132a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80132f:	50                   	push   %eax
+  801330:	56                   	push   %esi
+  801331:	6a 00                	push   $0x0
+  801333:	57                   	push   %edi
+  801334:	6a 00                	push   $0x0
+  801336:	e8 d7 f9 ff ff       	call   800d12 <sys_page_map>
+  80133b:	89 c3                	mov    %eax,%ebx
+  80133d:	83 c4 20             	add    $0x20,%esp
+  801340:	85 c0                	test   %eax,%eax
+  801342:	78 33                	js     801377 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801344:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801347:	89 d8                	mov    %ebx,%eax
+  801349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134c:	5b                   	pop    %ebx
+  80134d:	5e                   	pop    %esi
+  80134e:	5f                   	pop    %edi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801351:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801358:	83 ec 0c             	sub    $0xc,%esp
+  80135b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801360:	50                   	push   %eax
+  801361:	ff 75 d4             	push   -0x2c(%ebp)
+  801364:	6a 00                	push   $0x0
+  801366:	53                   	push   %ebx
+  801367:	6a 00                	push   $0x0
+  801369:	e8 a4 f9 ff ff       	call   800d12 <sys_page_map>
+  80136e:	89 c3                	mov    %eax,%ebx
+  801370:	83 c4 20             	add    $0x20,%esp
+  801373:	85 c0                	test   %eax,%eax
+  801375:	79 a4                	jns    80131b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801377:	83 ec 08             	sub    $0x8,%esp
+  80137a:	56                   	push   %esi
+  80137b:	6a 00                	push   $0x0
+  80137d:	e8 d2 f9 ff ff       	call   800d54 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801382:	83 c4 08             	add    $0x8,%esp
+  801385:	ff 75 d4             	push   -0x2c(%ebp)
+  801388:	6a 00                	push   $0x0
+  80138a:	e8 c5 f9 ff ff       	call   800d54 <sys_page_unmap>
+	return r;
+  80138f:	83 c4 10             	add    $0x10,%esp
+  801392:	eb b3                	jmp    801347 <dup+0x9d>
+
+00801394 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801394:	55                   	push   %ebp
+  801395:	89 e5                	mov    %esp,%ebp
+  801397:	56                   	push   %esi
+  801398:	53                   	push   %ebx
+  801399:	83 ec 18             	sub    $0x18,%esp
+  80139c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80139f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013a2:	50                   	push   %eax
+  8013a3:	56                   	push   %esi
+  8013a4:	e8 85 fd ff ff       	call   80112e <fd_lookup>
+  8013a9:	83 c4 10             	add    $0x10,%esp
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	78 3c                	js     8013ec <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013b0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013b3:	83 ec 08             	sub    $0x8,%esp
+  8013b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013b9:	50                   	push   %eax
+  8013ba:	ff 33                	push   (%ebx)
+  8013bc:	e8 bd fd ff ff       	call   80117e <dev_lookup>
+  8013c1:	83 c4 10             	add    $0x10,%esp
+  8013c4:	85 c0                	test   %eax,%eax
+  8013c6:	78 24                	js     8013ec <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8013c8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013cb:	83 e0 03             	and    $0x3,%eax
+  8013ce:	83 f8 01             	cmp    $0x1,%eax
+  8013d1:	74 20                	je     8013f3 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8013d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013d6:	8b 40 08             	mov    0x8(%eax),%eax
+  8013d9:	85 c0                	test   %eax,%eax
+  8013db:	74 37                	je     801414 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8013dd:	83 ec 04             	sub    $0x4,%esp
+  8013e0:	ff 75 10             	push   0x10(%ebp)
+  8013e3:	ff 75 0c             	push   0xc(%ebp)
+  8013e6:	53                   	push   %ebx
+  8013e7:	ff d0                	call   *%eax
+  8013e9:	83 c4 10             	add    $0x10,%esp
+}
+  8013ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013ef:	5b                   	pop    %ebx
+  8013f0:	5e                   	pop    %esi
+  8013f1:	5d                   	pop    %ebp
+  8013f2:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013f3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013f8:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8013fb:	83 ec 04             	sub    $0x4,%esp
+  8013fe:	56                   	push   %esi
+  8013ff:	50                   	push   %eax
+  801400:	68 0d 2b 80 00       	push   $0x802b0d
+  801405:	e8 27 ee ff ff       	call   800231 <cprintf>
+		return -E_INVAL;
+  80140a:	83 c4 10             	add    $0x10,%esp
+  80140d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801412:	eb d8                	jmp    8013ec <read+0x58>
+		return -E_NOT_SUPP;
+  801414:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801419:	eb d1                	jmp    8013ec <read+0x58>
+
+0080141b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80141b:	55                   	push   %ebp
+  80141c:	89 e5                	mov    %esp,%ebp
+  80141e:	57                   	push   %edi
+  80141f:	56                   	push   %esi
+  801420:	53                   	push   %ebx
+  801421:	83 ec 0c             	sub    $0xc,%esp
+  801424:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801427:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80142a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142f:	eb 02                	jmp    801433 <readn+0x18>
+  801431:	01 c3                	add    %eax,%ebx
+  801433:	39 f3                	cmp    %esi,%ebx
+  801435:	73 21                	jae    801458 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801437:	83 ec 04             	sub    $0x4,%esp
+  80143a:	89 f0                	mov    %esi,%eax
+  80143c:	29 d8                	sub    %ebx,%eax
+  80143e:	50                   	push   %eax
+  80143f:	89 d8                	mov    %ebx,%eax
+  801441:	03 45 0c             	add    0xc(%ebp),%eax
+  801444:	50                   	push   %eax
+  801445:	57                   	push   %edi
+  801446:	e8 49 ff ff ff       	call   801394 <read>
+		if (m < 0)
+  80144b:	83 c4 10             	add    $0x10,%esp
+  80144e:	85 c0                	test   %eax,%eax
+  801450:	78 04                	js     801456 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801452:	75 dd                	jne    801431 <readn+0x16>
+  801454:	eb 02                	jmp    801458 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801456:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801458:	89 d8                	mov    %ebx,%eax
+  80145a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145d:	5b                   	pop    %ebx
+  80145e:	5e                   	pop    %esi
+  80145f:	5f                   	pop    %edi
+  801460:	5d                   	pop    %ebp
+  801461:	c3                   	ret
+
+00801462 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801462:	55                   	push   %ebp
+  801463:	89 e5                	mov    %esp,%ebp
+  801465:	56                   	push   %esi
+  801466:	53                   	push   %ebx
+  801467:	83 ec 18             	sub    $0x18,%esp
+  80146a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80146d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801470:	50                   	push   %eax
+  801471:	53                   	push   %ebx
+  801472:	e8 b7 fc ff ff       	call   80112e <fd_lookup>
+  801477:	83 c4 10             	add    $0x10,%esp
+  80147a:	85 c0                	test   %eax,%eax
+  80147c:	78 37                	js     8014b5 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80147e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801481:	83 ec 08             	sub    $0x8,%esp
+  801484:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801487:	50                   	push   %eax
+  801488:	ff 36                	push   (%esi)
+  80148a:	e8 ef fc ff ff       	call   80117e <dev_lookup>
+  80148f:	83 c4 10             	add    $0x10,%esp
+  801492:	85 c0                	test   %eax,%eax
+  801494:	78 1f                	js     8014b5 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801496:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80149a:	74 20                	je     8014bc <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80149c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80149f:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014a2:	85 c0                	test   %eax,%eax
+  8014a4:	74 37                	je     8014dd <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8014a6:	83 ec 04             	sub    $0x4,%esp
+  8014a9:	ff 75 10             	push   0x10(%ebp)
+  8014ac:	ff 75 0c             	push   0xc(%ebp)
+  8014af:	56                   	push   %esi
+  8014b0:	ff d0                	call   *%eax
+  8014b2:	83 c4 10             	add    $0x10,%esp
+}
+  8014b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014b8:	5b                   	pop    %ebx
+  8014b9:	5e                   	pop    %esi
+  8014ba:	5d                   	pop    %ebp
+  8014bb:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014bc:	a1 08 40 80 00       	mov    0x804008,%eax
+  8014c1:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8014c4:	83 ec 04             	sub    $0x4,%esp
+  8014c7:	53                   	push   %ebx
+  8014c8:	50                   	push   %eax
+  8014c9:	68 29 2b 80 00       	push   $0x802b29
+  8014ce:	e8 5e ed ff ff       	call   800231 <cprintf>
+		return -E_INVAL;
+  8014d3:	83 c4 10             	add    $0x10,%esp
+  8014d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014db:	eb d8                	jmp    8014b5 <write+0x53>
+		return -E_NOT_SUPP;
+  8014dd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014e2:	eb d1                	jmp    8014b5 <write+0x53>
+
+008014e4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8014e4:	55                   	push   %ebp
+  8014e5:	89 e5                	mov    %esp,%ebp
+  8014e7:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014ed:	50                   	push   %eax
+  8014ee:	ff 75 08             	push   0x8(%ebp)
+  8014f1:	e8 38 fc ff ff       	call   80112e <fd_lookup>
+  8014f6:	83 c4 10             	add    $0x10,%esp
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	78 0e                	js     80150b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8014fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801500:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801503:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801506:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80150b:	c9                   	leave
+  80150c:	c3                   	ret
+
+0080150d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80150d:	55                   	push   %ebp
+  80150e:	89 e5                	mov    %esp,%ebp
+  801510:	56                   	push   %esi
+  801511:	53                   	push   %ebx
+  801512:	83 ec 18             	sub    $0x18,%esp
+  801515:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801518:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80151b:	50                   	push   %eax
+  80151c:	53                   	push   %ebx
+  80151d:	e8 0c fc ff ff       	call   80112e <fd_lookup>
+  801522:	83 c4 10             	add    $0x10,%esp
+  801525:	85 c0                	test   %eax,%eax
+  801527:	78 34                	js     80155d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801529:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80152c:	83 ec 08             	sub    $0x8,%esp
+  80152f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801532:	50                   	push   %eax
+  801533:	ff 36                	push   (%esi)
+  801535:	e8 44 fc ff ff       	call   80117e <dev_lookup>
+  80153a:	83 c4 10             	add    $0x10,%esp
+  80153d:	85 c0                	test   %eax,%eax
+  80153f:	78 1c                	js     80155d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801541:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801545:	74 1d                	je     801564 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801547:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80154a:	8b 40 18             	mov    0x18(%eax),%eax
+  80154d:	85 c0                	test   %eax,%eax
+  80154f:	74 34                	je     801585 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801551:	83 ec 08             	sub    $0x8,%esp
+  801554:	ff 75 0c             	push   0xc(%ebp)
+  801557:	56                   	push   %esi
+  801558:	ff d0                	call   *%eax
+  80155a:	83 c4 10             	add    $0x10,%esp
+}
+  80155d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801560:	5b                   	pop    %ebx
+  801561:	5e                   	pop    %esi
+  801562:	5d                   	pop    %ebp
+  801563:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801564:	a1 08 40 80 00       	mov    0x804008,%eax
+  801569:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80156c:	83 ec 04             	sub    $0x4,%esp
+  80156f:	53                   	push   %ebx
+  801570:	50                   	push   %eax
+  801571:	68 ec 2a 80 00       	push   $0x802aec
+  801576:	e8 b6 ec ff ff       	call   800231 <cprintf>
+		return -E_INVAL;
+  80157b:	83 c4 10             	add    $0x10,%esp
+  80157e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801583:	eb d8                	jmp    80155d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801585:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80158a:	eb d1                	jmp    80155d <ftruncate+0x50>
+
+0080158c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80158c:	55                   	push   %ebp
+  80158d:	89 e5                	mov    %esp,%ebp
+  80158f:	56                   	push   %esi
+  801590:	53                   	push   %ebx
+  801591:	83 ec 18             	sub    $0x18,%esp
+  801594:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801597:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80159a:	50                   	push   %eax
+  80159b:	ff 75 08             	push   0x8(%ebp)
+  80159e:	e8 8b fb ff ff       	call   80112e <fd_lookup>
+  8015a3:	83 c4 10             	add    $0x10,%esp
+  8015a6:	85 c0                	test   %eax,%eax
+  8015a8:	78 49                	js     8015f3 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015aa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015ad:	83 ec 08             	sub    $0x8,%esp
+  8015b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b3:	50                   	push   %eax
+  8015b4:	ff 36                	push   (%esi)
+  8015b6:	e8 c3 fb ff ff       	call   80117e <dev_lookup>
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	85 c0                	test   %eax,%eax
+  8015c0:	78 31                	js     8015f3 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8015c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015c5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8015c9:	74 2f                	je     8015fa <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8015cb:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8015ce:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8015d5:	00 00 00 
+	stat->st_isdir = 0;
+  8015d8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8015df:	00 00 00 
+	stat->st_dev = dev;
+  8015e2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8015e8:	83 ec 08             	sub    $0x8,%esp
+  8015eb:	53                   	push   %ebx
+  8015ec:	56                   	push   %esi
+  8015ed:	ff 50 14             	call   *0x14(%eax)
+  8015f0:	83 c4 10             	add    $0x10,%esp
+}
+  8015f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015f6:	5b                   	pop    %ebx
+  8015f7:	5e                   	pop    %esi
+  8015f8:	5d                   	pop    %ebp
+  8015f9:	c3                   	ret
+		return -E_NOT_SUPP;
+  8015fa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015ff:	eb f2                	jmp    8015f3 <fstat+0x67>
+
+00801601 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801601:	55                   	push   %ebp
+  801602:	89 e5                	mov    %esp,%ebp
+  801604:	56                   	push   %esi
+  801605:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801606:	83 ec 08             	sub    $0x8,%esp
+  801609:	6a 00                	push   $0x0
+  80160b:	ff 75 08             	push   0x8(%ebp)
+  80160e:	e8 e4 01 00 00       	call   8017f7 <open>
+  801613:	89 c3                	mov    %eax,%ebx
+  801615:	83 c4 10             	add    $0x10,%esp
+  801618:	85 c0                	test   %eax,%eax
+  80161a:	78 1b                	js     801637 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80161c:	83 ec 08             	sub    $0x8,%esp
+  80161f:	ff 75 0c             	push   0xc(%ebp)
+  801622:	50                   	push   %eax
+  801623:	e8 64 ff ff ff       	call   80158c <fstat>
+  801628:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80162a:	89 1c 24             	mov    %ebx,(%esp)
+  80162d:	e8 26 fc ff ff       	call   801258 <close>
+	return r;
+  801632:	83 c4 10             	add    $0x10,%esp
+  801635:	89 f3                	mov    %esi,%ebx
+}
+  801637:	89 d8                	mov    %ebx,%eax
+  801639:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80163c:	5b                   	pop    %ebx
+  80163d:	5e                   	pop    %esi
+  80163e:	5d                   	pop    %ebp
+  80163f:	c3                   	ret
+
+00801640 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801640:	55                   	push   %ebp
+  801641:	89 e5                	mov    %esp,%ebp
+  801643:	56                   	push   %esi
+  801644:	53                   	push   %ebx
+  801645:	89 c6                	mov    %eax,%esi
+  801647:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801649:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801650:	74 27                	je     801679 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801652:	6a 07                	push   $0x7
+  801654:	68 00 50 80 00       	push   $0x805000
+  801659:	56                   	push   %esi
+  80165a:	ff 35 00 40 80 00    	push   0x804000
+  801660:	e8 d5 0b 00 00       	call   80223a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801665:	83 c4 0c             	add    $0xc,%esp
+  801668:	6a 00                	push   $0x0
+  80166a:	53                   	push   %ebx
+  80166b:	6a 00                	push   $0x0
+  80166d:	e8 50 0b 00 00       	call   8021c2 <ipc_recv>
+}
+  801672:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801675:	5b                   	pop    %ebx
+  801676:	5e                   	pop    %esi
+  801677:	5d                   	pop    %ebp
+  801678:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801679:	83 ec 0c             	sub    $0xc,%esp
+  80167c:	6a 01                	push   $0x1
+  80167e:	e8 0b 0c 00 00       	call   80228e <ipc_find_env>
+  801683:	a3 00 40 80 00       	mov    %eax,0x804000
+  801688:	83 c4 10             	add    $0x10,%esp
+  80168b:	eb c5                	jmp    801652 <fsipc+0x12>
+
+0080168d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80168d:	55                   	push   %ebp
+  80168e:	89 e5                	mov    %esp,%ebp
+  801690:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801693:	8b 45 08             	mov    0x8(%ebp),%eax
+  801696:	8b 40 0c             	mov    0xc(%eax),%eax
+  801699:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  80169e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016a1:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8016a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ab:	b8 02 00 00 00       	mov    $0x2,%eax
+  8016b0:	e8 8b ff ff ff       	call   801640 <fsipc>
+}
+  8016b5:	c9                   	leave
+  8016b6:	c3                   	ret
+
+008016b7 <devfile_flush>:
+{
+  8016b7:	55                   	push   %ebp
+  8016b8:	89 e5                	mov    %esp,%ebp
+  8016ba:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8016bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016c0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016c3:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8016c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016cd:	b8 06 00 00 00       	mov    $0x6,%eax
+  8016d2:	e8 69 ff ff ff       	call   801640 <fsipc>
+}
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+
+008016d9 <devfile_stat>:
+{
+  8016d9:	55                   	push   %ebp
+  8016da:	89 e5                	mov    %esp,%ebp
+  8016dc:	53                   	push   %ebx
+  8016dd:	83 ec 04             	sub    $0x4,%esp
+  8016e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8016e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016e9:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8016ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8016f8:	e8 43 ff ff ff       	call   801640 <fsipc>
+  8016fd:	85 c0                	test   %eax,%eax
+  8016ff:	78 2c                	js     80172d <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801701:	83 ec 08             	sub    $0x8,%esp
+  801704:	68 00 50 80 00       	push   $0x805000
+  801709:	53                   	push   %ebx
+  80170a:	e8 10 f1 ff ff       	call   80081f <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80170f:	a1 80 50 80 00       	mov    0x805080,%eax
+  801714:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80171a:	a1 84 50 80 00       	mov    0x805084,%eax
+  80171f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801725:	83 c4 10             	add    $0x10,%esp
+  801728:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80172d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801730:	c9                   	leave
+  801731:	c3                   	ret
+
+00801732 <devfile_write>:
+{
+  801732:	55                   	push   %ebp
+  801733:	89 e5                	mov    %esp,%ebp
+  801735:	83 ec 0c             	sub    $0xc,%esp
+  801738:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80173b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801740:	39 d0                	cmp    %edx,%eax
+  801742:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801745:	8b 55 08             	mov    0x8(%ebp),%edx
+  801748:	8b 52 0c             	mov    0xc(%edx),%edx
+  80174b:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801751:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801756:	50                   	push   %eax
+  801757:	ff 75 0c             	push   0xc(%ebp)
+  80175a:	68 08 50 80 00       	push   $0x805008
+  80175f:	e8 41 f2 ff ff       	call   8009a5 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801764:	ba 00 00 00 00       	mov    $0x0,%edx
+  801769:	b8 04 00 00 00       	mov    $0x4,%eax
+  80176e:	e8 cd fe ff ff       	call   801640 <fsipc>
+}
+  801773:	c9                   	leave
+  801774:	c3                   	ret
+
+00801775 <devfile_read>:
+{
+  801775:	55                   	push   %ebp
+  801776:	89 e5                	mov    %esp,%ebp
+  801778:	56                   	push   %esi
+  801779:	53                   	push   %ebx
+  80177a:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80177d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801780:	8b 40 0c             	mov    0xc(%eax),%eax
+  801783:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  801788:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80178e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801793:	b8 03 00 00 00       	mov    $0x3,%eax
+  801798:	e8 a3 fe ff ff       	call   801640 <fsipc>
+  80179d:	89 c3                	mov    %eax,%ebx
+  80179f:	85 c0                	test   %eax,%eax
+  8017a1:	78 1f                	js     8017c2 <devfile_read+0x4d>
+	assert(r <= n);
+  8017a3:	39 c6                	cmp    %eax,%esi
+  8017a5:	72 24                	jb     8017cb <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8017a7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8017ac:	7f 33                	jg     8017e1 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8017ae:	83 ec 04             	sub    $0x4,%esp
+  8017b1:	50                   	push   %eax
+  8017b2:	68 00 50 80 00       	push   $0x805000
+  8017b7:	ff 75 0c             	push   0xc(%ebp)
+  8017ba:	e8 e6 f1 ff ff       	call   8009a5 <memmove>
+	return r;
+  8017bf:	83 c4 10             	add    $0x10,%esp
+}
+  8017c2:	89 d8                	mov    %ebx,%eax
+  8017c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c7:	5b                   	pop    %ebx
+  8017c8:	5e                   	pop    %esi
+  8017c9:	5d                   	pop    %ebp
+  8017ca:	c3                   	ret
+	assert(r <= n);
+  8017cb:	68 5c 2b 80 00       	push   $0x802b5c
+  8017d0:	68 63 2b 80 00       	push   $0x802b63
+  8017d5:	6a 7c                	push   $0x7c
+  8017d7:	68 78 2b 80 00       	push   $0x802b78
+  8017dc:	e8 75 e9 ff ff       	call   800156 <_panic>
+	assert(r <= PGSIZE);
+  8017e1:	68 83 2b 80 00       	push   $0x802b83
+  8017e6:	68 63 2b 80 00       	push   $0x802b63
+  8017eb:	6a 7d                	push   $0x7d
+  8017ed:	68 78 2b 80 00       	push   $0x802b78
+  8017f2:	e8 5f e9 ff ff       	call   800156 <_panic>
+
+008017f7 <open>:
+{
+  8017f7:	55                   	push   %ebp
+  8017f8:	89 e5                	mov    %esp,%ebp
+  8017fa:	56                   	push   %esi
+  8017fb:	53                   	push   %ebx
+  8017fc:	83 ec 1c             	sub    $0x1c,%esp
+  8017ff:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801802:	56                   	push   %esi
+  801803:	e8 dc ef ff ff       	call   8007e4 <strlen>
+  801808:	83 c4 10             	add    $0x10,%esp
+  80180b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801810:	7f 6c                	jg     80187e <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801812:	83 ec 0c             	sub    $0xc,%esp
+  801815:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801818:	50                   	push   %eax
+  801819:	e8 ba f8 ff ff       	call   8010d8 <fd_alloc>
+  80181e:	89 c3                	mov    %eax,%ebx
+  801820:	83 c4 10             	add    $0x10,%esp
+  801823:	85 c0                	test   %eax,%eax
+  801825:	78 3c                	js     801863 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801827:	83 ec 08             	sub    $0x8,%esp
+  80182a:	56                   	push   %esi
+  80182b:	68 00 50 80 00       	push   $0x805000
+  801830:	e8 ea ef ff ff       	call   80081f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801835:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801838:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80183d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801840:	b8 01 00 00 00       	mov    $0x1,%eax
+  801845:	e8 f6 fd ff ff       	call   801640 <fsipc>
+  80184a:	89 c3                	mov    %eax,%ebx
+  80184c:	83 c4 10             	add    $0x10,%esp
+  80184f:	85 c0                	test   %eax,%eax
+  801851:	78 19                	js     80186c <open+0x75>
+	return fd2num(fd);
+  801853:	83 ec 0c             	sub    $0xc,%esp
+  801856:	ff 75 f4             	push   -0xc(%ebp)
+  801859:	e8 53 f8 ff ff       	call   8010b1 <fd2num>
+  80185e:	89 c3                	mov    %eax,%ebx
+  801860:	83 c4 10             	add    $0x10,%esp
+}
+  801863:	89 d8                	mov    %ebx,%eax
+  801865:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801868:	5b                   	pop    %ebx
+  801869:	5e                   	pop    %esi
+  80186a:	5d                   	pop    %ebp
+  80186b:	c3                   	ret
+		fd_close(fd, 0);
+  80186c:	83 ec 08             	sub    $0x8,%esp
+  80186f:	6a 00                	push   $0x0
+  801871:	ff 75 f4             	push   -0xc(%ebp)
+  801874:	e8 58 f9 ff ff       	call   8011d1 <fd_close>
+		return r;
+  801879:	83 c4 10             	add    $0x10,%esp
+  80187c:	eb e5                	jmp    801863 <open+0x6c>
+		return -E_BAD_PATH;
+  80187e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801883:	eb de                	jmp    801863 <open+0x6c>
+
+00801885 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801885:	55                   	push   %ebp
+  801886:	89 e5                	mov    %esp,%ebp
+  801888:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80188b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801890:	b8 08 00 00 00       	mov    $0x8,%eax
+  801895:	e8 a6 fd ff ff       	call   801640 <fsipc>
+}
+  80189a:	c9                   	leave
+  80189b:	c3                   	ret
+
+0080189c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80189c:	55                   	push   %ebp
+  80189d:	89 e5                	mov    %esp,%ebp
+  80189f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8018a2:	68 8f 2b 80 00       	push   $0x802b8f
+  8018a7:	ff 75 0c             	push   0xc(%ebp)
+  8018aa:	e8 70 ef ff ff       	call   80081f <strcpy>
+	return 0;
+}
+  8018af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b4:	c9                   	leave
+  8018b5:	c3                   	ret
+
+008018b6 <devsock_close>:
+{
+  8018b6:	55                   	push   %ebp
+  8018b7:	89 e5                	mov    %esp,%ebp
+  8018b9:	53                   	push   %ebx
+  8018ba:	83 ec 10             	sub    $0x10,%esp
+  8018bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8018c0:	53                   	push   %ebx
+  8018c1:	e8 d8 09 00 00       	call   80229e <pageref>
+  8018c6:	89 c2                	mov    %eax,%edx
+  8018c8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8018cb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8018d0:	83 fa 01             	cmp    $0x1,%edx
+  8018d3:	74 05                	je     8018da <devsock_close+0x24>
+}
+  8018d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d8:	c9                   	leave
+  8018d9:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8018da:	83 ec 0c             	sub    $0xc,%esp
+  8018dd:	ff 73 0c             	push   0xc(%ebx)
+  8018e0:	e8 b7 02 00 00       	call   801b9c <nsipc_close>
+  8018e5:	83 c4 10             	add    $0x10,%esp
+  8018e8:	eb eb                	jmp    8018d5 <devsock_close+0x1f>
+
+008018ea <devsock_write>:
+{
+  8018ea:	55                   	push   %ebp
+  8018eb:	89 e5                	mov    %esp,%ebp
+  8018ed:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8018f0:	6a 00                	push   $0x0
+  8018f2:	ff 75 10             	push   0x10(%ebp)
+  8018f5:	ff 75 0c             	push   0xc(%ebp)
+  8018f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018fb:	ff 70 0c             	push   0xc(%eax)
+  8018fe:	e8 79 03 00 00       	call   801c7c <nsipc_send>
+}
+  801903:	c9                   	leave
+  801904:	c3                   	ret
+
+00801905 <devsock_read>:
+{
+  801905:	55                   	push   %ebp
+  801906:	89 e5                	mov    %esp,%ebp
+  801908:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80190b:	6a 00                	push   $0x0
+  80190d:	ff 75 10             	push   0x10(%ebp)
+  801910:	ff 75 0c             	push   0xc(%ebp)
+  801913:	8b 45 08             	mov    0x8(%ebp),%eax
+  801916:	ff 70 0c             	push   0xc(%eax)
+  801919:	e8 ef 02 00 00       	call   801c0d <nsipc_recv>
+}
+  80191e:	c9                   	leave
+  80191f:	c3                   	ret
+
+00801920 <fd2sockid>:
+{
+  801920:	55                   	push   %ebp
+  801921:	89 e5                	mov    %esp,%ebp
+  801923:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801926:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801929:	52                   	push   %edx
+  80192a:	50                   	push   %eax
+  80192b:	e8 fe f7 ff ff       	call   80112e <fd_lookup>
+  801930:	83 c4 10             	add    $0x10,%esp
+  801933:	85 c0                	test   %eax,%eax
+  801935:	78 10                	js     801947 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801937:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80193a:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801940:	39 08                	cmp    %ecx,(%eax)
+  801942:	75 05                	jne    801949 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801944:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801947:	c9                   	leave
+  801948:	c3                   	ret
+		return -E_NOT_SUPP;
+  801949:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80194e:	eb f7                	jmp    801947 <fd2sockid+0x27>
+
+00801950 <alloc_sockfd>:
+{
+  801950:	55                   	push   %ebp
+  801951:	89 e5                	mov    %esp,%ebp
+  801953:	56                   	push   %esi
+  801954:	53                   	push   %ebx
+  801955:	83 ec 1c             	sub    $0x1c,%esp
+  801958:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80195a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80195d:	50                   	push   %eax
+  80195e:	e8 75 f7 ff ff       	call   8010d8 <fd_alloc>
+  801963:	89 c3                	mov    %eax,%ebx
+  801965:	83 c4 10             	add    $0x10,%esp
+  801968:	85 c0                	test   %eax,%eax
+  80196a:	78 43                	js     8019af <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80196c:	83 ec 04             	sub    $0x4,%esp
+  80196f:	68 07 04 00 00       	push   $0x407
+  801974:	ff 75 f4             	push   -0xc(%ebp)
+  801977:	6a 00                	push   $0x0
+  801979:	e8 0e f3 ff ff       	call   800c8c <sys_page_alloc>
+  80197e:	89 c3                	mov    %eax,%ebx
+  801980:	83 c4 10             	add    $0x10,%esp
+  801983:	85 c0                	test   %eax,%eax
+  801985:	78 28                	js     8019af <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801987:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80198a:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801990:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801992:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801995:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80199c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80199f:	83 ec 0c             	sub    $0xc,%esp
+  8019a2:	50                   	push   %eax
+  8019a3:	e8 09 f7 ff ff       	call   8010b1 <fd2num>
+  8019a8:	89 c3                	mov    %eax,%ebx
+  8019aa:	83 c4 10             	add    $0x10,%esp
+  8019ad:	eb 0c                	jmp    8019bb <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8019af:	83 ec 0c             	sub    $0xc,%esp
+  8019b2:	56                   	push   %esi
+  8019b3:	e8 e4 01 00 00       	call   801b9c <nsipc_close>
+		return r;
+  8019b8:	83 c4 10             	add    $0x10,%esp
+}
+  8019bb:	89 d8                	mov    %ebx,%eax
+  8019bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019c0:	5b                   	pop    %ebx
+  8019c1:	5e                   	pop    %esi
+  8019c2:	5d                   	pop    %ebp
+  8019c3:	c3                   	ret
+
+008019c4 <accept>:
+{
+  8019c4:	55                   	push   %ebp
+  8019c5:	89 e5                	mov    %esp,%ebp
+  8019c7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019cd:	e8 4e ff ff ff       	call   801920 <fd2sockid>
+  8019d2:	85 c0                	test   %eax,%eax
+  8019d4:	78 1b                	js     8019f1 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8019d6:	83 ec 04             	sub    $0x4,%esp
+  8019d9:	ff 75 10             	push   0x10(%ebp)
+  8019dc:	ff 75 0c             	push   0xc(%ebp)
+  8019df:	50                   	push   %eax
+  8019e0:	e8 0e 01 00 00       	call   801af3 <nsipc_accept>
+  8019e5:	83 c4 10             	add    $0x10,%esp
+  8019e8:	85 c0                	test   %eax,%eax
+  8019ea:	78 05                	js     8019f1 <accept+0x2d>
+	return alloc_sockfd(r);
+  8019ec:	e8 5f ff ff ff       	call   801950 <alloc_sockfd>
+}
+  8019f1:	c9                   	leave
+  8019f2:	c3                   	ret
+
+008019f3 <bind>:
+{
+  8019f3:	55                   	push   %ebp
+  8019f4:	89 e5                	mov    %esp,%ebp
+  8019f6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019fc:	e8 1f ff ff ff       	call   801920 <fd2sockid>
+  801a01:	85 c0                	test   %eax,%eax
+  801a03:	78 12                	js     801a17 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801a05:	83 ec 04             	sub    $0x4,%esp
+  801a08:	ff 75 10             	push   0x10(%ebp)
+  801a0b:	ff 75 0c             	push   0xc(%ebp)
+  801a0e:	50                   	push   %eax
+  801a0f:	e8 31 01 00 00       	call   801b45 <nsipc_bind>
+  801a14:	83 c4 10             	add    $0x10,%esp
+}
+  801a17:	c9                   	leave
+  801a18:	c3                   	ret
+
+00801a19 <shutdown>:
+{
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a22:	e8 f9 fe ff ff       	call   801920 <fd2sockid>
+  801a27:	85 c0                	test   %eax,%eax
+  801a29:	78 0f                	js     801a3a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801a2b:	83 ec 08             	sub    $0x8,%esp
+  801a2e:	ff 75 0c             	push   0xc(%ebp)
+  801a31:	50                   	push   %eax
+  801a32:	e8 43 01 00 00       	call   801b7a <nsipc_shutdown>
+  801a37:	83 c4 10             	add    $0x10,%esp
+}
+  801a3a:	c9                   	leave
+  801a3b:	c3                   	ret
+
+00801a3c <connect>:
+{
+  801a3c:	55                   	push   %ebp
+  801a3d:	89 e5                	mov    %esp,%ebp
+  801a3f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a42:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a45:	e8 d6 fe ff ff       	call   801920 <fd2sockid>
+  801a4a:	85 c0                	test   %eax,%eax
+  801a4c:	78 12                	js     801a60 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801a4e:	83 ec 04             	sub    $0x4,%esp
+  801a51:	ff 75 10             	push   0x10(%ebp)
+  801a54:	ff 75 0c             	push   0xc(%ebp)
+  801a57:	50                   	push   %eax
+  801a58:	e8 59 01 00 00       	call   801bb6 <nsipc_connect>
+  801a5d:	83 c4 10             	add    $0x10,%esp
+}
+  801a60:	c9                   	leave
+  801a61:	c3                   	ret
+
+00801a62 <listen>:
+{
+  801a62:	55                   	push   %ebp
+  801a63:	89 e5                	mov    %esp,%ebp
+  801a65:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a68:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a6b:	e8 b0 fe ff ff       	call   801920 <fd2sockid>
+  801a70:	85 c0                	test   %eax,%eax
+  801a72:	78 0f                	js     801a83 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801a74:	83 ec 08             	sub    $0x8,%esp
+  801a77:	ff 75 0c             	push   0xc(%ebp)
+  801a7a:	50                   	push   %eax
+  801a7b:	e8 6b 01 00 00       	call   801beb <nsipc_listen>
+  801a80:	83 c4 10             	add    $0x10,%esp
+}
+  801a83:	c9                   	leave
+  801a84:	c3                   	ret
+
+00801a85 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801a85:	55                   	push   %ebp
+  801a86:	89 e5                	mov    %esp,%ebp
+  801a88:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801a8b:	ff 75 10             	push   0x10(%ebp)
+  801a8e:	ff 75 0c             	push   0xc(%ebp)
+  801a91:	ff 75 08             	push   0x8(%ebp)
+  801a94:	e8 41 02 00 00       	call   801cda <nsipc_socket>
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	85 c0                	test   %eax,%eax
+  801a9e:	78 05                	js     801aa5 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801aa0:	e8 ab fe ff ff       	call   801950 <alloc_sockfd>
+}
+  801aa5:	c9                   	leave
+  801aa6:	c3                   	ret
+
+00801aa7 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801aa7:	55                   	push   %ebp
+  801aa8:	89 e5                	mov    %esp,%ebp
+  801aaa:	53                   	push   %ebx
+  801aab:	83 ec 04             	sub    $0x4,%esp
+  801aae:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801ab0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ab7:	74 26                	je     801adf <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801ab9:	6a 07                	push   $0x7
+  801abb:	68 00 60 80 00       	push   $0x806000
+  801ac0:	53                   	push   %ebx
+  801ac1:	ff 35 04 40 80 00    	push   0x804004
+  801ac7:	e8 6e 07 00 00       	call   80223a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801acc:	83 c4 0c             	add    $0xc,%esp
+  801acf:	6a 00                	push   $0x0
+  801ad1:	6a 00                	push   $0x0
+  801ad3:	6a 00                	push   $0x0
+  801ad5:	e8 e8 06 00 00       	call   8021c2 <ipc_recv>
+}
+  801ada:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801add:	c9                   	leave
+  801ade:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801adf:	83 ec 0c             	sub    $0xc,%esp
+  801ae2:	6a 02                	push   $0x2
+  801ae4:	e8 a5 07 00 00       	call   80228e <ipc_find_env>
+  801ae9:	a3 04 40 80 00       	mov    %eax,0x804004
+  801aee:	83 c4 10             	add    $0x10,%esp
+  801af1:	eb c6                	jmp    801ab9 <nsipc+0x12>
+
+00801af3 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801af3:	55                   	push   %ebp
+  801af4:	89 e5                	mov    %esp,%ebp
+  801af6:	56                   	push   %esi
+  801af7:	53                   	push   %ebx
+  801af8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801afb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801afe:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801b03:	8b 06                	mov    (%esi),%eax
+  801b05:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801b0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b0f:	e8 93 ff ff ff       	call   801aa7 <nsipc>
+  801b14:	89 c3                	mov    %eax,%ebx
+  801b16:	85 c0                	test   %eax,%eax
+  801b18:	79 09                	jns    801b23 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801b1a:	89 d8                	mov    %ebx,%eax
+  801b1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b1f:	5b                   	pop    %ebx
+  801b20:	5e                   	pop    %esi
+  801b21:	5d                   	pop    %ebp
+  801b22:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801b23:	83 ec 04             	sub    $0x4,%esp
+  801b26:	ff 35 10 60 80 00    	push   0x806010
+  801b2c:	68 00 60 80 00       	push   $0x806000
+  801b31:	ff 75 0c             	push   0xc(%ebp)
+  801b34:	e8 6c ee ff ff       	call   8009a5 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801b39:	a1 10 60 80 00       	mov    0x806010,%eax
+  801b3e:	89 06                	mov    %eax,(%esi)
+  801b40:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801b43:	eb d5                	jmp    801b1a <nsipc_accept+0x27>
+
+00801b45 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801b45:	55                   	push   %ebp
+  801b46:	89 e5                	mov    %esp,%ebp
+  801b48:	53                   	push   %ebx
+  801b49:	83 ec 08             	sub    $0x8,%esp
+  801b4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801b4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b52:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801b57:	53                   	push   %ebx
+  801b58:	ff 75 0c             	push   0xc(%ebp)
+  801b5b:	68 04 60 80 00       	push   $0x806004
+  801b60:	e8 40 ee ff ff       	call   8009a5 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801b65:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801b6b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b70:	e8 32 ff ff ff       	call   801aa7 <nsipc>
+}
+  801b75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b78:	c9                   	leave
+  801b79:	c3                   	ret
+
+00801b7a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801b7a:	55                   	push   %ebp
+  801b7b:	89 e5                	mov    %esp,%ebp
+  801b7d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801b80:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b83:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801b88:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b8b:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801b90:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b95:	e8 0d ff ff ff       	call   801aa7 <nsipc>
+}
+  801b9a:	c9                   	leave
+  801b9b:	c3                   	ret
+
+00801b9c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801b9c:	55                   	push   %ebp
+  801b9d:	89 e5                	mov    %esp,%ebp
+  801b9f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801ba2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba5:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801baa:	b8 04 00 00 00       	mov    $0x4,%eax
+  801baf:	e8 f3 fe ff ff       	call   801aa7 <nsipc>
+}
+  801bb4:	c9                   	leave
+  801bb5:	c3                   	ret
+
+00801bb6 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801bb6:	55                   	push   %ebp
+  801bb7:	89 e5                	mov    %esp,%ebp
+  801bb9:	53                   	push   %ebx
+  801bba:	83 ec 08             	sub    $0x8,%esp
+  801bbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801bc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc3:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801bc8:	53                   	push   %ebx
+  801bc9:	ff 75 0c             	push   0xc(%ebp)
+  801bcc:	68 04 60 80 00       	push   $0x806004
+  801bd1:	e8 cf ed ff ff       	call   8009a5 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801bd6:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801bdc:	b8 05 00 00 00       	mov    $0x5,%eax
+  801be1:	e8 c1 fe ff ff       	call   801aa7 <nsipc>
+}
+  801be6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be9:	c9                   	leave
+  801bea:	c3                   	ret
+
+00801beb <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801beb:	55                   	push   %ebp
+  801bec:	89 e5                	mov    %esp,%ebp
+  801bee:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801bf1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf4:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801bf9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bfc:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801c01:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c06:	e8 9c fe ff ff       	call   801aa7 <nsipc>
+}
+  801c0b:	c9                   	leave
+  801c0c:	c3                   	ret
+
+00801c0d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801c0d:	55                   	push   %ebp
+  801c0e:	89 e5                	mov    %esp,%ebp
+  801c10:	56                   	push   %esi
+  801c11:	53                   	push   %ebx
+  801c12:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801c15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c18:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801c1d:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801c23:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c26:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801c2b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c30:	e8 72 fe ff ff       	call   801aa7 <nsipc>
+  801c35:	89 c3                	mov    %eax,%ebx
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	78 22                	js     801c5d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801c3b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801c40:	39 c6                	cmp    %eax,%esi
+  801c42:	0f 4e c6             	cmovle %esi,%eax
+  801c45:	39 c3                	cmp    %eax,%ebx
+  801c47:	7f 1d                	jg     801c66 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801c49:	83 ec 04             	sub    $0x4,%esp
+  801c4c:	53                   	push   %ebx
+  801c4d:	68 00 60 80 00       	push   $0x806000
+  801c52:	ff 75 0c             	push   0xc(%ebp)
+  801c55:	e8 4b ed ff ff       	call   8009a5 <memmove>
+  801c5a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801c5d:	89 d8                	mov    %ebx,%eax
+  801c5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c62:	5b                   	pop    %ebx
+  801c63:	5e                   	pop    %esi
+  801c64:	5d                   	pop    %ebp
+  801c65:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801c66:	68 9b 2b 80 00       	push   $0x802b9b
+  801c6b:	68 63 2b 80 00       	push   $0x802b63
+  801c70:	6a 62                	push   $0x62
+  801c72:	68 b0 2b 80 00       	push   $0x802bb0
+  801c77:	e8 da e4 ff ff       	call   800156 <_panic>
+
+00801c7c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801c7c:	55                   	push   %ebp
+  801c7d:	89 e5                	mov    %esp,%ebp
+  801c7f:	53                   	push   %ebx
+  801c80:	83 ec 04             	sub    $0x4,%esp
+  801c83:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801c86:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c89:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801c8e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801c94:	7f 2e                	jg     801cc4 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801c96:	83 ec 04             	sub    $0x4,%esp
+  801c99:	53                   	push   %ebx
+  801c9a:	ff 75 0c             	push   0xc(%ebp)
+  801c9d:	68 0c 60 80 00       	push   $0x80600c
+  801ca2:	e8 fe ec ff ff       	call   8009a5 <memmove>
+	nsipcbuf.send.req_size = size;
+  801ca7:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801cad:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cb0:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801cb5:	b8 08 00 00 00       	mov    $0x8,%eax
+  801cba:	e8 e8 fd ff ff       	call   801aa7 <nsipc>
+}
+  801cbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc2:	c9                   	leave
+  801cc3:	c3                   	ret
+	assert(size < 1600);
+  801cc4:	68 bc 2b 80 00       	push   $0x802bbc
+  801cc9:	68 63 2b 80 00       	push   $0x802b63
+  801cce:	6a 6d                	push   $0x6d
+  801cd0:	68 b0 2b 80 00       	push   $0x802bb0
+  801cd5:	e8 7c e4 ff ff       	call   800156 <_panic>
+
+00801cda <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801cda:	55                   	push   %ebp
+  801cdb:	89 e5                	mov    %esp,%ebp
+  801cdd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801ce0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce3:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801ce8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ceb:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801cf0:	8b 45 10             	mov    0x10(%ebp),%eax
+  801cf3:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801cf8:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cfd:	e8 a5 fd ff ff       	call   801aa7 <nsipc>
+}
+  801d02:	c9                   	leave
+  801d03:	c3                   	ret
+
+00801d04 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d04:	55                   	push   %ebp
+  801d05:	89 e5                	mov    %esp,%ebp
+  801d07:	56                   	push   %esi
+  801d08:	53                   	push   %ebx
+  801d09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801d0c:	83 ec 0c             	sub    $0xc,%esp
+  801d0f:	ff 75 08             	push   0x8(%ebp)
+  801d12:	e8 aa f3 ff ff       	call   8010c1 <fd2data>
+  801d17:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801d19:	83 c4 08             	add    $0x8,%esp
+  801d1c:	68 c8 2b 80 00       	push   $0x802bc8
+  801d21:	53                   	push   %ebx
+  801d22:	e8 f8 ea ff ff       	call   80081f <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801d27:	8b 46 04             	mov    0x4(%esi),%eax
+  801d2a:	2b 06                	sub    (%esi),%eax
+  801d2c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801d32:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d39:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d3c:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801d43:	30 80 00 
+	return 0;
+}
+  801d46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d4e:	5b                   	pop    %ebx
+  801d4f:	5e                   	pop    %esi
+  801d50:	5d                   	pop    %ebp
+  801d51:	c3                   	ret
+
+00801d52 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d52:	55                   	push   %ebp
+  801d53:	89 e5                	mov    %esp,%ebp
+  801d55:	53                   	push   %ebx
+  801d56:	83 ec 0c             	sub    $0xc,%esp
+  801d59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d5c:	53                   	push   %ebx
+  801d5d:	6a 00                	push   $0x0
+  801d5f:	e8 f0 ef ff ff       	call   800d54 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d64:	89 1c 24             	mov    %ebx,(%esp)
+  801d67:	e8 55 f3 ff ff       	call   8010c1 <fd2data>
+  801d6c:	83 c4 08             	add    $0x8,%esp
+  801d6f:	50                   	push   %eax
+  801d70:	6a 00                	push   $0x0
+  801d72:	e8 dd ef ff ff       	call   800d54 <sys_page_unmap>
+}
+  801d77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d7a:	c9                   	leave
+  801d7b:	c3                   	ret
+
+00801d7c <_pipeisclosed>:
+{
+  801d7c:	55                   	push   %ebp
+  801d7d:	89 e5                	mov    %esp,%ebp
+  801d7f:	57                   	push   %edi
+  801d80:	56                   	push   %esi
+  801d81:	53                   	push   %ebx
+  801d82:	83 ec 1c             	sub    $0x1c,%esp
+  801d85:	89 c7                	mov    %eax,%edi
+  801d87:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d89:	a1 08 40 80 00       	mov    0x804008,%eax
+  801d8e:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801d91:	83 ec 0c             	sub    $0xc,%esp
+  801d94:	57                   	push   %edi
+  801d95:	e8 04 05 00 00       	call   80229e <pageref>
+  801d9a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d9d:	89 34 24             	mov    %esi,(%esp)
+  801da0:	e8 f9 04 00 00       	call   80229e <pageref>
+		nn = thisenv->env_runs;
+  801da5:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801dab:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801dae:	83 c4 10             	add    $0x10,%esp
+  801db1:	39 cb                	cmp    %ecx,%ebx
+  801db3:	74 1b                	je     801dd0 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801db5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801db8:	75 cf                	jne    801d89 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801dba:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801dbd:	6a 01                	push   $0x1
+  801dbf:	50                   	push   %eax
+  801dc0:	53                   	push   %ebx
+  801dc1:	68 cf 2b 80 00       	push   $0x802bcf
+  801dc6:	e8 66 e4 ff ff       	call   800231 <cprintf>
+  801dcb:	83 c4 10             	add    $0x10,%esp
+  801dce:	eb b9                	jmp    801d89 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801dd0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801dd3:	0f 94 c0             	sete   %al
+  801dd6:	0f b6 c0             	movzbl %al,%eax
+}
+  801dd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ddc:	5b                   	pop    %ebx
+  801ddd:	5e                   	pop    %esi
+  801dde:	5f                   	pop    %edi
+  801ddf:	5d                   	pop    %ebp
+  801de0:	c3                   	ret
+
+00801de1 <devpipe_write>:
+{
+  801de1:	55                   	push   %ebp
+  801de2:	89 e5                	mov    %esp,%ebp
+  801de4:	57                   	push   %edi
+  801de5:	56                   	push   %esi
+  801de6:	53                   	push   %ebx
+  801de7:	83 ec 28             	sub    $0x28,%esp
+  801dea:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801ded:	56                   	push   %esi
+  801dee:	e8 ce f2 ff ff       	call   8010c1 <fd2data>
+  801df3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801df5:	83 c4 10             	add    $0x10,%esp
+  801df8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dfd:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801e00:	75 09                	jne    801e0b <devpipe_write+0x2a>
+	return i;
+  801e02:	89 f8                	mov    %edi,%eax
+  801e04:	eb 23                	jmp    801e29 <devpipe_write+0x48>
+			sys_yield();
+  801e06:	e8 01 ee ff ff       	call   800c0c <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801e0b:	8b 43 04             	mov    0x4(%ebx),%eax
+  801e0e:	8b 0b                	mov    (%ebx),%ecx
+  801e10:	8d 51 20             	lea    0x20(%ecx),%edx
+  801e13:	39 d0                	cmp    %edx,%eax
+  801e15:	72 1a                	jb     801e31 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801e17:	89 da                	mov    %ebx,%edx
+  801e19:	89 f0                	mov    %esi,%eax
+  801e1b:	e8 5c ff ff ff       	call   801d7c <_pipeisclosed>
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	74 e2                	je     801e06 <devpipe_write+0x25>
+				return 0;
+  801e24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e2c:	5b                   	pop    %ebx
+  801e2d:	5e                   	pop    %esi
+  801e2e:	5f                   	pop    %edi
+  801e2f:	5d                   	pop    %ebp
+  801e30:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801e31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e34:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801e38:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801e3b:	89 c2                	mov    %eax,%edx
+  801e3d:	c1 fa 1f             	sar    $0x1f,%edx
+  801e40:	89 d1                	mov    %edx,%ecx
+  801e42:	c1 e9 1b             	shr    $0x1b,%ecx
+  801e45:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801e48:	83 e2 1f             	and    $0x1f,%edx
+  801e4b:	29 ca                	sub    %ecx,%edx
+  801e4d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801e51:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801e55:	83 c0 01             	add    $0x1,%eax
+  801e58:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801e5b:	83 c7 01             	add    $0x1,%edi
+  801e5e:	eb 9d                	jmp    801dfd <devpipe_write+0x1c>
+
+00801e60 <devpipe_read>:
+{
+  801e60:	55                   	push   %ebp
+  801e61:	89 e5                	mov    %esp,%ebp
+  801e63:	57                   	push   %edi
+  801e64:	56                   	push   %esi
+  801e65:	53                   	push   %ebx
+  801e66:	83 ec 18             	sub    $0x18,%esp
+  801e69:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801e6c:	57                   	push   %edi
+  801e6d:	e8 4f f2 ff ff       	call   8010c1 <fd2data>
+  801e72:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801e74:	83 c4 10             	add    $0x10,%esp
+  801e77:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801e7f:	75 13                	jne    801e94 <devpipe_read+0x34>
+	return i;
+  801e81:	89 f0                	mov    %esi,%eax
+  801e83:	eb 02                	jmp    801e87 <devpipe_read+0x27>
+				return i;
+  801e85:	89 f0                	mov    %esi,%eax
+}
+  801e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e8a:	5b                   	pop    %ebx
+  801e8b:	5e                   	pop    %esi
+  801e8c:	5f                   	pop    %edi
+  801e8d:	5d                   	pop    %ebp
+  801e8e:	c3                   	ret
+			sys_yield();
+  801e8f:	e8 78 ed ff ff       	call   800c0c <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801e94:	8b 03                	mov    (%ebx),%eax
+  801e96:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801e99:	75 18                	jne    801eb3 <devpipe_read+0x53>
+			if (i > 0)
+  801e9b:	85 f6                	test   %esi,%esi
+  801e9d:	75 e6                	jne    801e85 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801e9f:	89 da                	mov    %ebx,%edx
+  801ea1:	89 f8                	mov    %edi,%eax
+  801ea3:	e8 d4 fe ff ff       	call   801d7c <_pipeisclosed>
+  801ea8:	85 c0                	test   %eax,%eax
+  801eaa:	74 e3                	je     801e8f <devpipe_read+0x2f>
+				return 0;
+  801eac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb1:	eb d4                	jmp    801e87 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801eb3:	99                   	cltd
+  801eb4:	c1 ea 1b             	shr    $0x1b,%edx
+  801eb7:	01 d0                	add    %edx,%eax
+  801eb9:	83 e0 1f             	and    $0x1f,%eax
+  801ebc:	29 d0                	sub    %edx,%eax
+  801ebe:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ec3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ec6:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801ec9:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801ecc:	83 c6 01             	add    $0x1,%esi
+  801ecf:	eb ab                	jmp    801e7c <devpipe_read+0x1c>
+
+00801ed1 <pipe>:
+{
+  801ed1:	55                   	push   %ebp
+  801ed2:	89 e5                	mov    %esp,%ebp
+  801ed4:	56                   	push   %esi
+  801ed5:	53                   	push   %ebx
+  801ed6:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801ed9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801edc:	50                   	push   %eax
+  801edd:	e8 f6 f1 ff ff       	call   8010d8 <fd_alloc>
+  801ee2:	89 c3                	mov    %eax,%ebx
+  801ee4:	83 c4 10             	add    $0x10,%esp
+  801ee7:	85 c0                	test   %eax,%eax
+  801ee9:	0f 88 23 01 00 00    	js     802012 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801eef:	83 ec 04             	sub    $0x4,%esp
+  801ef2:	68 07 04 00 00       	push   $0x407
+  801ef7:	ff 75 f4             	push   -0xc(%ebp)
+  801efa:	6a 00                	push   $0x0
+  801efc:	e8 8b ed ff ff       	call   800c8c <sys_page_alloc>
+  801f01:	89 c3                	mov    %eax,%ebx
+  801f03:	83 c4 10             	add    $0x10,%esp
+  801f06:	85 c0                	test   %eax,%eax
+  801f08:	0f 88 04 01 00 00    	js     802012 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801f0e:	83 ec 0c             	sub    $0xc,%esp
+  801f11:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f14:	50                   	push   %eax
+  801f15:	e8 be f1 ff ff       	call   8010d8 <fd_alloc>
+  801f1a:	89 c3                	mov    %eax,%ebx
+  801f1c:	83 c4 10             	add    $0x10,%esp
+  801f1f:	85 c0                	test   %eax,%eax
+  801f21:	0f 88 db 00 00 00    	js     802002 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f27:	83 ec 04             	sub    $0x4,%esp
+  801f2a:	68 07 04 00 00       	push   $0x407
+  801f2f:	ff 75 f0             	push   -0x10(%ebp)
+  801f32:	6a 00                	push   $0x0
+  801f34:	e8 53 ed ff ff       	call   800c8c <sys_page_alloc>
+  801f39:	89 c3                	mov    %eax,%ebx
+  801f3b:	83 c4 10             	add    $0x10,%esp
+  801f3e:	85 c0                	test   %eax,%eax
+  801f40:	0f 88 bc 00 00 00    	js     802002 <pipe+0x131>
+	va = fd2data(fd0);
+  801f46:	83 ec 0c             	sub    $0xc,%esp
+  801f49:	ff 75 f4             	push   -0xc(%ebp)
+  801f4c:	e8 70 f1 ff ff       	call   8010c1 <fd2data>
+  801f51:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f53:	83 c4 0c             	add    $0xc,%esp
+  801f56:	68 07 04 00 00       	push   $0x407
+  801f5b:	50                   	push   %eax
+  801f5c:	6a 00                	push   $0x0
+  801f5e:	e8 29 ed ff ff       	call   800c8c <sys_page_alloc>
+  801f63:	89 c3                	mov    %eax,%ebx
+  801f65:	83 c4 10             	add    $0x10,%esp
+  801f68:	85 c0                	test   %eax,%eax
+  801f6a:	0f 88 82 00 00 00    	js     801ff2 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f70:	83 ec 0c             	sub    $0xc,%esp
+  801f73:	ff 75 f0             	push   -0x10(%ebp)
+  801f76:	e8 46 f1 ff ff       	call   8010c1 <fd2data>
+  801f7b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801f82:	50                   	push   %eax
+  801f83:	6a 00                	push   $0x0
+  801f85:	56                   	push   %esi
+  801f86:	6a 00                	push   $0x0
+  801f88:	e8 85 ed ff ff       	call   800d12 <sys_page_map>
+  801f8d:	89 c3                	mov    %eax,%ebx
+  801f8f:	83 c4 20             	add    $0x20,%esp
+  801f92:	85 c0                	test   %eax,%eax
+  801f94:	78 4e                	js     801fe4 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801f96:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801f9b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f9e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801fa0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fa3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801faa:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801fad:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801faf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801fb2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801fb9:	83 ec 0c             	sub    $0xc,%esp
+  801fbc:	ff 75 f4             	push   -0xc(%ebp)
+  801fbf:	e8 ed f0 ff ff       	call   8010b1 <fd2num>
+  801fc4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fc7:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801fc9:	83 c4 04             	add    $0x4,%esp
+  801fcc:	ff 75 f0             	push   -0x10(%ebp)
+  801fcf:	e8 dd f0 ff ff       	call   8010b1 <fd2num>
+  801fd4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fd7:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801fda:	83 c4 10             	add    $0x10,%esp
+  801fdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fe2:	eb 2e                	jmp    802012 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801fe4:	83 ec 08             	sub    $0x8,%esp
+  801fe7:	56                   	push   %esi
+  801fe8:	6a 00                	push   $0x0
+  801fea:	e8 65 ed ff ff       	call   800d54 <sys_page_unmap>
+  801fef:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801ff2:	83 ec 08             	sub    $0x8,%esp
+  801ff5:	ff 75 f0             	push   -0x10(%ebp)
+  801ff8:	6a 00                	push   $0x0
+  801ffa:	e8 55 ed ff ff       	call   800d54 <sys_page_unmap>
+  801fff:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802002:	83 ec 08             	sub    $0x8,%esp
+  802005:	ff 75 f4             	push   -0xc(%ebp)
+  802008:	6a 00                	push   $0x0
+  80200a:	e8 45 ed ff ff       	call   800d54 <sys_page_unmap>
+  80200f:	83 c4 10             	add    $0x10,%esp
+}
+  802012:	89 d8                	mov    %ebx,%eax
+  802014:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802017:	5b                   	pop    %ebx
+  802018:	5e                   	pop    %esi
+  802019:	5d                   	pop    %ebp
+  80201a:	c3                   	ret
+
+0080201b <pipeisclosed>:
+{
+  80201b:	55                   	push   %ebp
+  80201c:	89 e5                	mov    %esp,%ebp
+  80201e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802021:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802024:	50                   	push   %eax
+  802025:	ff 75 08             	push   0x8(%ebp)
+  802028:	e8 01 f1 ff ff       	call   80112e <fd_lookup>
+  80202d:	83 c4 10             	add    $0x10,%esp
+  802030:	85 c0                	test   %eax,%eax
+  802032:	78 18                	js     80204c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802034:	83 ec 0c             	sub    $0xc,%esp
+  802037:	ff 75 f4             	push   -0xc(%ebp)
+  80203a:	e8 82 f0 ff ff       	call   8010c1 <fd2data>
+  80203f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802041:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802044:	e8 33 fd ff ff       	call   801d7c <_pipeisclosed>
+  802049:	83 c4 10             	add    $0x10,%esp
+}
+  80204c:	c9                   	leave
+  80204d:	c3                   	ret
+
+0080204e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80204e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802053:	c3                   	ret
+
+00802054 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802054:	55                   	push   %ebp
+  802055:	89 e5                	mov    %esp,%ebp
+  802057:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80205a:	68 e7 2b 80 00       	push   $0x802be7
+  80205f:	ff 75 0c             	push   0xc(%ebp)
+  802062:	e8 b8 e7 ff ff       	call   80081f <strcpy>
+	return 0;
+}
+  802067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80206c:	c9                   	leave
+  80206d:	c3                   	ret
+
+0080206e <devcons_write>:
+{
+  80206e:	55                   	push   %ebp
+  80206f:	89 e5                	mov    %esp,%ebp
+  802071:	57                   	push   %edi
+  802072:	56                   	push   %esi
+  802073:	53                   	push   %ebx
+  802074:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80207a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80207f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802085:	eb 2e                	jmp    8020b5 <devcons_write+0x47>
+		m = n - tot;
+  802087:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80208a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80208c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802091:	39 c3                	cmp    %eax,%ebx
+  802093:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802096:	83 ec 04             	sub    $0x4,%esp
+  802099:	53                   	push   %ebx
+  80209a:	89 f0                	mov    %esi,%eax
+  80209c:	03 45 0c             	add    0xc(%ebp),%eax
+  80209f:	50                   	push   %eax
+  8020a0:	57                   	push   %edi
+  8020a1:	e8 ff e8 ff ff       	call   8009a5 <memmove>
+		sys_cputs(buf, m);
+  8020a6:	83 c4 08             	add    $0x8,%esp
+  8020a9:	53                   	push   %ebx
+  8020aa:	57                   	push   %edi
+  8020ab:	e8 9f ea ff ff       	call   800b4f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8020b0:	01 de                	add    %ebx,%esi
+  8020b2:	83 c4 10             	add    $0x10,%esp
+  8020b5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8020b8:	72 cd                	jb     802087 <devcons_write+0x19>
+}
+  8020ba:	89 f0                	mov    %esi,%eax
+  8020bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020bf:	5b                   	pop    %ebx
+  8020c0:	5e                   	pop    %esi
+  8020c1:	5f                   	pop    %edi
+  8020c2:	5d                   	pop    %ebp
+  8020c3:	c3                   	ret
+
+008020c4 <devcons_read>:
+{
+  8020c4:	55                   	push   %ebp
+  8020c5:	89 e5                	mov    %esp,%ebp
+  8020c7:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8020ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8020d3:	75 07                	jne    8020dc <devcons_read+0x18>
+  8020d5:	eb 1f                	jmp    8020f6 <devcons_read+0x32>
+		sys_yield();
+  8020d7:	e8 30 eb ff ff       	call   800c0c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8020dc:	e8 8c ea ff ff       	call   800b6d <sys_cgetc>
+  8020e1:	85 c0                	test   %eax,%eax
+  8020e3:	74 f2                	je     8020d7 <devcons_read+0x13>
+	if (c < 0)
+  8020e5:	78 0f                	js     8020f6 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8020e7:	83 f8 04             	cmp    $0x4,%eax
+  8020ea:	74 0c                	je     8020f8 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8020ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020ef:	88 02                	mov    %al,(%edx)
+	return 1;
+  8020f1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8020f6:	c9                   	leave
+  8020f7:	c3                   	ret
+		return 0;
+  8020f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fd:	eb f7                	jmp    8020f6 <devcons_read+0x32>
+
+008020ff <cputchar>:
+{
+  8020ff:	55                   	push   %ebp
+  802100:	89 e5                	mov    %esp,%ebp
+  802102:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802105:	8b 45 08             	mov    0x8(%ebp),%eax
+  802108:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80210b:	6a 01                	push   $0x1
+  80210d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802110:	50                   	push   %eax
+  802111:	e8 39 ea ff ff       	call   800b4f <sys_cputs>
+}
+  802116:	83 c4 10             	add    $0x10,%esp
+  802119:	c9                   	leave
+  80211a:	c3                   	ret
+
+0080211b <getchar>:
+{
+  80211b:	55                   	push   %ebp
+  80211c:	89 e5                	mov    %esp,%ebp
+  80211e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802121:	6a 01                	push   $0x1
+  802123:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802126:	50                   	push   %eax
+  802127:	6a 00                	push   $0x0
+  802129:	e8 66 f2 ff ff       	call   801394 <read>
+	if (r < 0)
+  80212e:	83 c4 10             	add    $0x10,%esp
+  802131:	85 c0                	test   %eax,%eax
+  802133:	78 06                	js     80213b <getchar+0x20>
+	if (r < 1)
+  802135:	74 06                	je     80213d <getchar+0x22>
+	return c;
+  802137:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80213b:	c9                   	leave
+  80213c:	c3                   	ret
+		return -E_EOF;
+  80213d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802142:	eb f7                	jmp    80213b <getchar+0x20>
+
+00802144 <iscons>:
+{
+  802144:	55                   	push   %ebp
+  802145:	89 e5                	mov    %esp,%ebp
+  802147:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80214a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80214d:	50                   	push   %eax
+  80214e:	ff 75 08             	push   0x8(%ebp)
+  802151:	e8 d8 ef ff ff       	call   80112e <fd_lookup>
+  802156:	83 c4 10             	add    $0x10,%esp
+  802159:	85 c0                	test   %eax,%eax
+  80215b:	78 11                	js     80216e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80215d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802160:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802166:	39 10                	cmp    %edx,(%eax)
+  802168:	0f 94 c0             	sete   %al
+  80216b:	0f b6 c0             	movzbl %al,%eax
+}
+  80216e:	c9                   	leave
+  80216f:	c3                   	ret
+
+00802170 <opencons>:
+{
+  802170:	55                   	push   %ebp
+  802171:	89 e5                	mov    %esp,%ebp
+  802173:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802176:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802179:	50                   	push   %eax
+  80217a:	e8 59 ef ff ff       	call   8010d8 <fd_alloc>
+  80217f:	83 c4 10             	add    $0x10,%esp
+  802182:	85 c0                	test   %eax,%eax
+  802184:	78 3a                	js     8021c0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802186:	83 ec 04             	sub    $0x4,%esp
+  802189:	68 07 04 00 00       	push   $0x407
+  80218e:	ff 75 f4             	push   -0xc(%ebp)
+  802191:	6a 00                	push   $0x0
+  802193:	e8 f4 ea ff ff       	call   800c8c <sys_page_alloc>
+  802198:	83 c4 10             	add    $0x10,%esp
+  80219b:	85 c0                	test   %eax,%eax
+  80219d:	78 21                	js     8021c0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80219f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021a2:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8021a8:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8021aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ad:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8021b4:	83 ec 0c             	sub    $0xc,%esp
+  8021b7:	50                   	push   %eax
+  8021b8:	e8 f4 ee ff ff       	call   8010b1 <fd2num>
+  8021bd:	83 c4 10             	add    $0x10,%esp
+}
+  8021c0:	c9                   	leave
+  8021c1:	c3                   	ret
+
+008021c2 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8021c2:	55                   	push   %ebp
+  8021c3:	89 e5                	mov    %esp,%ebp
+  8021c5:	57                   	push   %edi
+  8021c6:	56                   	push   %esi
+  8021c7:	53                   	push   %ebx
+  8021c8:	83 ec 18             	sub    $0x18,%esp
+  8021cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021d1:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8021d4:	85 db                	test   %ebx,%ebx
+  8021d6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021db:	0f 45 c3             	cmovne %ebx,%eax
+  8021de:	50                   	push   %eax
+  8021df:	e8 2b ee ff ff       	call   80100f <sys_ipc_recv>
+
+	if (from_env_store)
+  8021e4:	83 c4 10             	add    $0x10,%esp
+  8021e7:	85 ff                	test   %edi,%edi
+  8021e9:	74 17                	je     802202 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8021eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f0:	85 c0                	test   %eax,%eax
+  8021f2:	75 0c                	jne    802200 <ipc_recv+0x3e>
+  8021f4:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  8021fa:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  802200:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  802202:	85 f6                	test   %esi,%esi
+  802204:	74 2e                	je     802234 <ipc_recv+0x72>
+		if (!r && pg)
+  802206:	85 c0                	test   %eax,%eax
+  802208:	75 24                	jne    80222e <ipc_recv+0x6c>
+  80220a:	85 db                	test   %ebx,%ebx
+  80220c:	74 20                	je     80222e <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  80220e:	a1 08 40 80 00       	mov    0x804008,%eax
+  802213:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  802219:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  80221b:	a1 08 40 80 00       	mov    0x804008,%eax
+  802220:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  802226:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802229:	5b                   	pop    %ebx
+  80222a:	5e                   	pop    %esi
+  80222b:	5f                   	pop    %edi
+  80222c:	5d                   	pop    %ebp
+  80222d:	c3                   	ret
+			*perm_store = 0;
+  80222e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  802234:	85 c0                	test   %eax,%eax
+  802236:	75 ee                	jne    802226 <ipc_recv+0x64>
+  802238:	eb e1                	jmp    80221b <ipc_recv+0x59>
+
+0080223a <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80223a:	55                   	push   %ebp
+  80223b:	89 e5                	mov    %esp,%ebp
+  80223d:	57                   	push   %edi
+  80223e:	56                   	push   %esi
+  80223f:	53                   	push   %ebx
+  802240:	83 ec 0c             	sub    $0xc,%esp
+  802243:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802246:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802249:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  80224c:	85 db                	test   %ebx,%ebx
+  80224e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802253:	0f 44 d8             	cmove  %eax,%ebx
+  802256:	ff 75 14             	push   0x14(%ebp)
+  802259:	53                   	push   %ebx
+  80225a:	56                   	push   %esi
+  80225b:	57                   	push   %edi
+  80225c:	e8 8b ed ff ff       	call   800fec <sys_ipc_try_send_yield>
+  802261:	83 c4 10             	add    $0x10,%esp
+  802264:	85 c0                	test   %eax,%eax
+  802266:	79 1e                	jns    802286 <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  802268:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80226b:	75 07                	jne    802274 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  80226d:	e8 9a e9 ff ff       	call   800c0c <sys_yield>
+  802272:	eb e2                	jmp    802256 <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802274:	50                   	push   %eax
+  802275:	68 f3 2b 80 00       	push   $0x802bf3
+  80227a:	6a 3d                	push   $0x3d
+  80227c:	68 08 2c 80 00       	push   $0x802c08
+  802281:	e8 d0 de ff ff       	call   800156 <_panic>
+	}
+}
+  802286:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802289:	5b                   	pop    %ebx
+  80228a:	5e                   	pop    %esi
+  80228b:	5f                   	pop    %edi
+  80228c:	5d                   	pop    %ebp
+  80228d:	c3                   	ret
+
+0080228e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80228e:	55                   	push   %ebp
+  80228f:	89 e5                	mov    %esp,%ebp
+  802291:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802294:	ff 75 08             	push   0x8(%ebp)
+  802297:	e8 f0 e8 ff ff       	call   800b8c <sys_env_find>
+}
+  80229c:	c9                   	leave
+  80229d:	c3                   	ret
+
+0080229e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80229e:	55                   	push   %ebp
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8022a4:	89 c2                	mov    %eax,%edx
+  8022a6:	c1 ea 16             	shr    $0x16,%edx
+  8022a9:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8022b0:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8022b5:	f6 c1 01             	test   $0x1,%cl
+  8022b8:	74 22                	je     8022dc <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8022ba:	c1 e8 0c             	shr    $0xc,%eax
+  8022bd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8022c4:	a8 01                	test   $0x1,%al
+  8022c6:	74 14                	je     8022dc <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8022c8:	c1 e8 0c             	shr    $0xc,%eax
+  8022cb:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8022ce:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8022d5:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8022d9:	0f b7 d2             	movzwl %dx,%edx
+}
+  8022dc:	89 d0                	mov    %edx,%eax
+  8022de:	5d                   	pop    %ebp
+  8022df:	c3                   	ret
+
+008022e0 <__udivmoddi4>:
+  8022e0:	55                   	push   %ebp
+  8022e1:	57                   	push   %edi
+  8022e2:	56                   	push   %esi
+  8022e3:	53                   	push   %ebx
+  8022e4:	83 ec 14             	sub    $0x14,%esp
+  8022e7:	8b 74 24 34          	mov    0x34(%esp),%esi
+  8022eb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8022ef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022f3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022f7:	89 f1                	mov    %esi,%ecx
+  8022f9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022fd:	09 d9                	or     %ebx,%ecx
+  8022ff:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802303:	0f 84 92 00 00 00    	je     80239b <__udivmoddi4+0xbb>
+  802309:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802310:	00 
+  802311:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802316:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80231d:	00 
+  80231e:	89 1c 24             	mov    %ebx,(%esp)
+  802321:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802325:	8d 76 00             	lea    0x0(%esi),%esi
+  802328:	89 e9                	mov    %ebp,%ecx
+  80232a:	89 c3                	mov    %eax,%ebx
+  80232c:	89 d6                	mov    %edx,%esi
+  80232e:	31 ff                	xor    %edi,%edi
+  802330:	d3 ee                	shr    %cl,%esi
+  802332:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802335:	f6 c1 20             	test   $0x20,%cl
+  802338:	0f 45 de             	cmovne %esi,%ebx
+  80233b:	0f 45 f7             	cmovne %edi,%esi
+  80233e:	8b 3c 24             	mov    (%esp),%edi
+  802341:	39 fb                	cmp    %edi,%ebx
+  802343:	89 f7                	mov    %esi,%edi
+  802345:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802349:	8b 1c 24             	mov    (%esp),%ebx
+  80234c:	19 f7                	sbb    %esi,%edi
+  80234e:	72 39                	jb     802389 <__udivmoddi4+0xa9>
+  802350:	89 e9                	mov    %ebp,%ecx
+  802352:	89 f7                	mov    %esi,%edi
+  802354:	89 de                	mov    %ebx,%esi
+  802356:	0f a5 df             	shld   %cl,%ebx,%edi
+  802359:	d3 e6                	shl    %cl,%esi
+  80235b:	31 db                	xor    %ebx,%ebx
+  80235d:	f6 c1 20             	test   $0x20,%cl
+  802360:	0f 45 fe             	cmovne %esi,%edi
+  802363:	0f 45 f3             	cmovne %ebx,%esi
+  802366:	29 f0                	sub    %esi,%eax
+  802368:	be 01 00 00 00       	mov    $0x1,%esi
+  80236d:	19 fa                	sbb    %edi,%edx
+  80236f:	31 ff                	xor    %edi,%edi
+  802371:	31 db                	xor    %ebx,%ebx
+  802373:	0f a5 f7             	shld   %cl,%esi,%edi
+  802376:	d3 e6                	shl    %cl,%esi
+  802378:	f6 c1 20             	test   $0x20,%cl
+  80237b:	0f 45 fe             	cmovne %esi,%edi
+  80237e:	0f 45 f3             	cmovne %ebx,%esi
+  802381:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802385:	09 74 24 08          	or     %esi,0x8(%esp)
+  802389:	83 ed 01             	sub    $0x1,%ebp
+  80238c:	73 9a                	jae    802328 <__udivmoddi4+0x48>
+  80238e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802392:	85 ff                	test   %edi,%edi
+  802394:	74 05                	je     80239b <__udivmoddi4+0xbb>
+  802396:	89 07                	mov    %eax,(%edi)
+  802398:	89 57 04             	mov    %edx,0x4(%edi)
+  80239b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80239f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023a3:	83 c4 14             	add    $0x14,%esp
+  8023a6:	5b                   	pop    %ebx
+  8023a7:	5e                   	pop    %esi
+  8023a8:	5f                   	pop    %edi
+  8023a9:	5d                   	pop    %ebp
+  8023aa:	c3                   	ret
+  8023ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8023af:	90                   	nop
+
+008023b0 <__udivdi3>:
+  8023b0:	55                   	push   %ebp
+  8023b1:	57                   	push   %edi
+  8023b2:	56                   	push   %esi
+  8023b3:	53                   	push   %ebx
+  8023b4:	83 ec 14             	sub    $0x14,%esp
+  8023b7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8023bb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8023bf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8023c3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8023c7:	89 fb                	mov    %edi,%ebx
+  8023c9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8023cd:	09 f3                	or     %esi,%ebx
+  8023cf:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8023d3:	0f 84 85 00 00 00    	je     80245e <__udivdi3+0xae>
+  8023d9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8023e0:	00 
+  8023e1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8023e6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8023ed:	00 
+  8023ee:	89 34 24             	mov    %esi,(%esp)
+  8023f1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023f5:	8d 76 00             	lea    0x0(%esi),%esi
+  8023f8:	89 e9                	mov    %ebp,%ecx
+  8023fa:	89 c3                	mov    %eax,%ebx
+  8023fc:	89 d6                	mov    %edx,%esi
+  8023fe:	31 ff                	xor    %edi,%edi
+  802400:	d3 ee                	shr    %cl,%esi
+  802402:	0f ad d3             	shrd   %cl,%edx,%ebx
+  802405:	f6 c1 20             	test   $0x20,%cl
+  802408:	0f 45 de             	cmovne %esi,%ebx
+  80240b:	0f 45 f7             	cmovne %edi,%esi
+  80240e:	8b 3c 24             	mov    (%esp),%edi
+  802411:	39 fb                	cmp    %edi,%ebx
+  802413:	89 f7                	mov    %esi,%edi
+  802415:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802419:	8b 1c 24             	mov    (%esp),%ebx
+  80241c:	19 f7                	sbb    %esi,%edi
+  80241e:	72 39                	jb     802459 <__udivdi3+0xa9>
+  802420:	89 e9                	mov    %ebp,%ecx
+  802422:	89 f7                	mov    %esi,%edi
+  802424:	89 de                	mov    %ebx,%esi
+  802426:	0f a5 df             	shld   %cl,%ebx,%edi
+  802429:	d3 e6                	shl    %cl,%esi
+  80242b:	31 db                	xor    %ebx,%ebx
+  80242d:	f6 c1 20             	test   $0x20,%cl
+  802430:	0f 45 fe             	cmovne %esi,%edi
+  802433:	0f 45 f3             	cmovne %ebx,%esi
+  802436:	29 f0                	sub    %esi,%eax
+  802438:	be 01 00 00 00       	mov    $0x1,%esi
+  80243d:	19 fa                	sbb    %edi,%edx
+  80243f:	31 ff                	xor    %edi,%edi
+  802441:	31 db                	xor    %ebx,%ebx
+  802443:	0f a5 f7             	shld   %cl,%esi,%edi
+  802446:	d3 e6                	shl    %cl,%esi
+  802448:	f6 c1 20             	test   $0x20,%cl
+  80244b:	0f 45 fe             	cmovne %esi,%edi
+  80244e:	0f 45 f3             	cmovne %ebx,%esi
+  802451:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802455:	09 74 24 08          	or     %esi,0x8(%esp)
+  802459:	83 ed 01             	sub    $0x1,%ebp
+  80245c:	73 9a                	jae    8023f8 <__udivdi3+0x48>
+  80245e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802462:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802466:	83 c4 14             	add    $0x14,%esp
+  802469:	5b                   	pop    %ebx
+  80246a:	5e                   	pop    %esi
+  80246b:	5f                   	pop    %edi
+  80246c:	5d                   	pop    %ebp
+  80246d:	c3                   	ret
+  80246e:	66 90                	xchg   %ax,%ax
+
+00802470 <__umoddi3>:
+  802470:	57                   	push   %edi
+  802471:	56                   	push   %esi
+  802472:	53                   	push   %ebx
+  802473:	83 ec 08             	sub    $0x8,%esp
+  802476:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80247a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80247e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802482:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802486:	89 f9                	mov    %edi,%ecx
+  802488:	89 34 24             	mov    %esi,(%esp)
+  80248b:	09 f1                	or     %esi,%ecx
+  80248d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802491:	74 53                	je     8024e6 <__umoddi3+0x76>
+  802493:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802498:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80249f:	90                   	nop
+  8024a0:	89 c6                	mov    %eax,%esi
+  8024a2:	89 d7                	mov    %edx,%edi
+  8024a4:	31 db                	xor    %ebx,%ebx
+  8024a6:	d3 ef                	shr    %cl,%edi
+  8024a8:	0f ad d6             	shrd   %cl,%edx,%esi
+  8024ab:	f6 c1 20             	test   $0x20,%cl
+  8024ae:	0f 45 f7             	cmovne %edi,%esi
+  8024b1:	0f 45 fb             	cmovne %ebx,%edi
+  8024b4:	8b 1c 24             	mov    (%esp),%ebx
+  8024b7:	39 de                	cmp    %ebx,%esi
+  8024b9:	89 fb                	mov    %edi,%ebx
+  8024bb:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  8024bf:	8b 34 24             	mov    (%esp),%esi
+  8024c2:	19 fb                	sbb    %edi,%ebx
+  8024c4:	72 14                	jb     8024da <__umoddi3+0x6a>
+  8024c6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8024c9:	31 db                	xor    %ebx,%ebx
+  8024cb:	d3 e6                	shl    %cl,%esi
+  8024cd:	f6 c1 20             	test   $0x20,%cl
+  8024d0:	0f 45 fe             	cmovne %esi,%edi
+  8024d3:	0f 45 f3             	cmovne %ebx,%esi
+  8024d6:	29 f0                	sub    %esi,%eax
+  8024d8:	19 fa                	sbb    %edi,%edx
+  8024da:	83 e9 01             	sub    $0x1,%ecx
+  8024dd:	73 c1                	jae    8024a0 <__umoddi3+0x30>
+  8024df:	83 c4 08             	add    $0x8,%esp
+  8024e2:	5b                   	pop    %ebx
+  8024e3:	5e                   	pop    %esi
+  8024e4:	5f                   	pop    %edi
+  8024e5:	c3                   	ret
+  8024e6:	83 c4 08             	add    $0x8,%esp
+  8024e9:	31 c0                	xor    %eax,%eax
+  8024eb:	31 d2                	xor    %edx,%edx
+  8024ed:	5b                   	pop    %ebx
+  8024ee:	5e                   	pop    %esi
+  8024ef:	5f                   	pop    %edi
+  8024f0:	c3                   	ret
+  8024f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024ff:	90                   	nop
+
+00802500 <__divdi3>:
+  802500:	55                   	push   %ebp
+  802501:	57                   	push   %edi
+  802502:	56                   	push   %esi
+  802503:	53                   	push   %ebx
+  802504:	83 ec 1c             	sub    $0x1c,%esp
+  802507:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80250b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80250f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802513:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  802517:	85 ff                	test   %edi,%edi
+  802519:	0f 88 da 00 00 00    	js     8025f9 <__divdi3+0xf9>
+  80251f:	85 db                	test   %ebx,%ebx
+  802521:	78 16                	js     802539 <__divdi3+0x39>
+  802523:	89 dd                	mov    %ebx,%ebp
+  802525:	89 c8                	mov    %ecx,%eax
+  802527:	89 da                	mov    %ebx,%edx
+  802529:	09 cd                	or     %ecx,%ebp
+  80252b:	0f 85 fd 00 00 00    	jne    80262e <__divdi3+0x12e>
+  802531:	83 c4 1c             	add    $0x1c,%esp
+  802534:	5b                   	pop    %ebx
+  802535:	5e                   	pop    %esi
+  802536:	5f                   	pop    %edi
+  802537:	5d                   	pop    %ebp
+  802538:	c3                   	ret
+  802539:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80253e:	f7 d9                	neg    %ecx
+  802540:	89 f0                	mov    %esi,%eax
+  802542:	89 fa                	mov    %edi,%edx
+  802544:	83 d3 00             	adc    $0x0,%ebx
+  802547:	89 0c 24             	mov    %ecx,(%esp)
+  80254a:	f7 db                	neg    %ebx
+  80254c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802550:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802557:	00 
+  802558:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80255d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802564:	00 
+  802565:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802569:	89 cd                	mov    %ecx,%ebp
+  80256b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80256f:	90                   	nop
+  802570:	89 e9                	mov    %ebp,%ecx
+  802572:	89 c3                	mov    %eax,%ebx
+  802574:	89 d6                	mov    %edx,%esi
+  802576:	31 ff                	xor    %edi,%edi
+  802578:	d3 ee                	shr    %cl,%esi
+  80257a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80257d:	f6 c1 20             	test   $0x20,%cl
+  802580:	0f 45 de             	cmovne %esi,%ebx
+  802583:	0f 45 f7             	cmovne %edi,%esi
+  802586:	8b 3c 24             	mov    (%esp),%edi
+  802589:	39 fb                	cmp    %edi,%ebx
+  80258b:	89 f7                	mov    %esi,%edi
+  80258d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802591:	8b 1c 24             	mov    (%esp),%ebx
+  802594:	19 f7                	sbb    %esi,%edi
+  802596:	72 39                	jb     8025d1 <__divdi3+0xd1>
+  802598:	89 e9                	mov    %ebp,%ecx
+  80259a:	89 f7                	mov    %esi,%edi
+  80259c:	89 de                	mov    %ebx,%esi
+  80259e:	0f a5 df             	shld   %cl,%ebx,%edi
+  8025a1:	d3 e6                	shl    %cl,%esi
+  8025a3:	31 db                	xor    %ebx,%ebx
+  8025a5:	f6 c1 20             	test   $0x20,%cl
+  8025a8:	0f 45 fe             	cmovne %esi,%edi
+  8025ab:	0f 45 f3             	cmovne %ebx,%esi
+  8025ae:	29 f0                	sub    %esi,%eax
+  8025b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8025b5:	19 fa                	sbb    %edi,%edx
+  8025b7:	31 ff                	xor    %edi,%edi
+  8025b9:	31 db                	xor    %ebx,%ebx
+  8025bb:	0f a5 f7             	shld   %cl,%esi,%edi
+  8025be:	d3 e6                	shl    %cl,%esi
+  8025c0:	f6 c1 20             	test   $0x20,%cl
+  8025c3:	0f 45 fe             	cmovne %esi,%edi
+  8025c6:	0f 45 f3             	cmovne %ebx,%esi
+  8025c9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8025cd:	09 74 24 08          	or     %esi,0x8(%esp)
+  8025d1:	83 ed 01             	sub    $0x1,%ebp
+  8025d4:	73 9a                	jae    802570 <__divdi3+0x70>
+  8025d6:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  8025da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025e2:	85 ed                	test   %ebp,%ebp
+  8025e4:	0f 84 47 ff ff ff    	je     802531 <__divdi3+0x31>
+  8025ea:	f7 d8                	neg    %eax
+  8025ec:	83 d2 00             	adc    $0x0,%edx
+  8025ef:	83 c4 1c             	add    $0x1c,%esp
+  8025f2:	5b                   	pop    %ebx
+  8025f3:	f7 da                	neg    %edx
+  8025f5:	5e                   	pop    %esi
+  8025f6:	5f                   	pop    %edi
+  8025f7:	5d                   	pop    %ebp
+  8025f8:	c3                   	ret
+  8025f9:	f7 de                	neg    %esi
+  8025fb:	83 d7 00             	adc    $0x0,%edi
+  8025fe:	f7 df                	neg    %edi
+  802600:	85 db                	test   %ebx,%ebx
+  802602:	78 23                	js     802627 <__divdi3+0x127>
+  802604:	89 dd                	mov    %ebx,%ebp
+  802606:	89 c8                	mov    %ecx,%eax
+  802608:	89 da                	mov    %ebx,%edx
+  80260a:	09 cd                	or     %ecx,%ebp
+  80260c:	0f 84 1f ff ff ff    	je     802531 <__divdi3+0x31>
+  802612:	89 0c 24             	mov    %ecx,(%esp)
+  802615:	89 f0                	mov    %esi,%eax
+  802617:	89 fa                	mov    %edi,%edx
+  802619:	bd 01 00 00 00       	mov    $0x1,%ebp
+  80261e:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802622:	e9 29 ff ff ff       	jmp    802550 <__divdi3+0x50>
+  802627:	31 ed                	xor    %ebp,%ebp
+  802629:	e9 10 ff ff ff       	jmp    80253e <__divdi3+0x3e>
+  80262e:	89 0c 24             	mov    %ecx,(%esp)
+  802631:	89 f0                	mov    %esi,%eax
+  802633:	89 fa                	mov    %edi,%edx
+  802635:	31 ed                	xor    %ebp,%ebp
+  802637:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  80263b:	e9 10 ff ff ff       	jmp    802550 <__divdi3+0x50>
+
+00802640 <__moddi3>:
+  802640:	55                   	push   %ebp
+  802641:	57                   	push   %edi
+  802642:	56                   	push   %esi
+  802643:	53                   	push   %ebx
+  802644:	83 ec 14             	sub    $0x14,%esp
+  802647:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80264b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80264f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802653:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802657:	85 d2                	test   %edx,%edx
+  802659:	0f 88 9b 00 00 00    	js     8026fa <__moddi3+0xba>
+  80265f:	89 f7                	mov    %esi,%edi
+  802661:	31 ed                	xor    %ebp,%ebp
+  802663:	09 cf                	or     %ecx,%edi
+  802665:	0f 84 83 00 00 00    	je     8026ee <__moddi3+0xae>
+  80266b:	89 cb                	mov    %ecx,%ebx
+  80266d:	89 f7                	mov    %esi,%edi
+  80266f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802673:	f7 db                	neg    %ebx
+  802675:	83 d7 00             	adc    $0x0,%edi
+  802678:	f7 df                	neg    %edi
+  80267a:	0f 49 f7             	cmovns %edi,%esi
+  80267d:	0f 49 cb             	cmovns %ebx,%ecx
+  802680:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802684:	89 0c 24             	mov    %ecx,(%esp)
+  802687:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80268c:	89 cd                	mov    %ecx,%ebp
+  80268e:	66 90                	xchg   %ax,%ax
+  802690:	89 e9                	mov    %ebp,%ecx
+  802692:	89 c3                	mov    %eax,%ebx
+  802694:	89 d6                	mov    %edx,%esi
+  802696:	31 ff                	xor    %edi,%edi
+  802698:	d3 ee                	shr    %cl,%esi
+  80269a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80269d:	f6 c1 20             	test   $0x20,%cl
+  8026a0:	0f 45 de             	cmovne %esi,%ebx
+  8026a3:	0f 45 f7             	cmovne %edi,%esi
+  8026a6:	8b 3c 24             	mov    (%esp),%edi
+  8026a9:	39 fb                	cmp    %edi,%ebx
+  8026ab:	89 f7                	mov    %esi,%edi
+  8026ad:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8026b1:	8b 1c 24             	mov    (%esp),%ebx
+  8026b4:	19 f7                	sbb    %esi,%edi
+  8026b6:	72 1a                	jb     8026d2 <__moddi3+0x92>
+  8026b8:	89 e9                	mov    %ebp,%ecx
+  8026ba:	89 f7                	mov    %esi,%edi
+  8026bc:	89 de                	mov    %ebx,%esi
+  8026be:	0f a5 df             	shld   %cl,%ebx,%edi
+  8026c1:	d3 e6                	shl    %cl,%esi
+  8026c3:	31 db                	xor    %ebx,%ebx
+  8026c5:	f6 c1 20             	test   $0x20,%cl
+  8026c8:	0f 45 fe             	cmovne %esi,%edi
+  8026cb:	0f 45 f3             	cmovne %ebx,%esi
+  8026ce:	29 f0                	sub    %esi,%eax
+  8026d0:	19 fa                	sbb    %edi,%edx
+  8026d2:	83 ed 01             	sub    $0x1,%ebp
+  8026d5:	73 b9                	jae    802690 <__moddi3+0x50>
+  8026d7:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  8026db:	85 ed                	test   %ebp,%ebp
+  8026dd:	74 07                	je     8026e6 <__moddi3+0xa6>
+  8026df:	f7 d8                	neg    %eax
+  8026e1:	83 d2 00             	adc    $0x0,%edx
+  8026e4:	f7 da                	neg    %edx
+  8026e6:	83 c4 14             	add    $0x14,%esp
+  8026e9:	5b                   	pop    %ebx
+  8026ea:	5e                   	pop    %esi
+  8026eb:	5f                   	pop    %edi
+  8026ec:	5d                   	pop    %ebp
+  8026ed:	c3                   	ret
+  8026ee:	83 c4 14             	add    $0x14,%esp
+  8026f1:	31 c0                	xor    %eax,%eax
+  8026f3:	31 d2                	xor    %edx,%edx
+  8026f5:	5b                   	pop    %ebx
+  8026f6:	5e                   	pop    %esi
+  8026f7:	5f                   	pop    %edi
+  8026f8:	5d                   	pop    %ebp
+  8026f9:	c3                   	ret
+  8026fa:	89 f7                	mov    %esi,%edi
+  8026fc:	09 cf                	or     %ecx,%edi
+  8026fe:	74 11                	je     802711 <__moddi3+0xd1>
+  802700:	f7 d8                	neg    %eax
+  802702:	bd 01 00 00 00       	mov    $0x1,%ebp
+  802707:	83 d2 00             	adc    $0x0,%edx
+  80270a:	f7 da                	neg    %edx
+  80270c:	e9 5a ff ff ff       	jmp    80266b <__moddi3+0x2b>
+  802711:	31 c0                	xor    %eax,%eax
+  802713:	31 d2                	xor    %edx,%edx
+  802715:	eb c8                	jmp    8026df <__moddi3+0x9f>
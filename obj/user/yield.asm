@@ -0,0 +1,5598 @@
+
+obj/user/yield.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 69 00 00 00       	call   80009a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int i;
+
+	cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  80003a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80003f:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800042:	50                   	push   %eax
+  800043:	68 e0 26 80 00       	push   $0x8026e0
+  800048:	e8 42 01 00 00       	call   80018f <cprintf>
+  80004d:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 5; i++) {
+  800050:	bb 00 00 00 00       	mov    $0x0,%ebx
+		sys_yield();
+  800055:	e8 10 0b 00 00       	call   800b6a <sys_yield>
+		cprintf("Back in environment %08x, iteration %d.\n",
+			thisenv->env_id, i);
+  80005a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80005f:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("Back in environment %08x, iteration %d.\n",
+  800062:	83 ec 04             	sub    $0x4,%esp
+  800065:	53                   	push   %ebx
+  800066:	50                   	push   %eax
+  800067:	68 00 27 80 00       	push   $0x802700
+  80006c:	e8 1e 01 00 00       	call   80018f <cprintf>
+	for (i = 0; i < 5; i++) {
+  800071:	83 c3 01             	add    $0x1,%ebx
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	83 fb 05             	cmp    $0x5,%ebx
+  80007a:	75 d9                	jne    800055 <umain+0x22>
+	}
+	cprintf("All done in environment %08x.\n", thisenv->env_id);
+  80007c:	a1 08 40 80 00       	mov    0x804008,%eax
+  800081:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	50                   	push   %eax
+  800088:	68 2c 27 80 00       	push   $0x80272c
+  80008d:	e8 fd 00 00 00       	call   80018f <cprintf>
+}
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800098:	c9                   	leave
+  800099:	c3                   	ret
+
+0080009a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+  80009f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000a5:	e8 a1 0a 00 00       	call   800b4b <sys_getenvid>
+  8000aa:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  8000af:	c1 e0 09             	shl    $0x9,%eax
+  8000b2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000b7:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000bc:	85 db                	test   %ebx,%ebx
+  8000be:	7e 07                	jle    8000c7 <libmain+0x2d>
+		binaryname = argv[0];
+  8000c0:	8b 06                	mov    (%esi),%eax
+  8000c2:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000c7:	83 ec 08             	sub    $0x8,%esp
+  8000ca:	56                   	push   %esi
+  8000cb:	53                   	push   %ebx
+  8000cc:	e8 62 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000d1:	e8 0a 00 00 00       	call   8000e0 <exit>
+}
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000dc:	5b                   	pop    %ebx
+  8000dd:	5e                   	pop    %esi
+  8000de:	5d                   	pop    %ebp
+  8000df:	c3                   	ret
+
+008000e0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e0:	55                   	push   %ebp
+  8000e1:	89 e5                	mov    %esp,%ebp
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000e6:	e8 f8 10 00 00       	call   8011e3 <close_all>
+	sys_env_destroy(0);
+  8000eb:	83 ec 0c             	sub    $0xc,%esp
+  8000ee:	6a 00                	push   $0x0
+  8000f0:	e8 15 0a 00 00       	call   800b0a <sys_env_destroy>
+}
+  8000f5:	83 c4 10             	add    $0x10,%esp
+  8000f8:	c9                   	leave
+  8000f9:	c3                   	ret
+
+008000fa <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000fa:	55                   	push   %ebp
+  8000fb:	89 e5                	mov    %esp,%ebp
+  8000fd:	53                   	push   %ebx
+  8000fe:	83 ec 04             	sub    $0x4,%esp
+  800101:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800104:	8b 13                	mov    (%ebx),%edx
+  800106:	8d 42 01             	lea    0x1(%edx),%eax
+  800109:	89 03                	mov    %eax,(%ebx)
+  80010b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80010e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800112:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800117:	74 09                	je     800122 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800119:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80011d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800120:	c9                   	leave
+  800121:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800122:	83 ec 08             	sub    $0x8,%esp
+  800125:	68 ff 00 00 00       	push   $0xff
+  80012a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80012d:	50                   	push   %eax
+  80012e:	e8 7a 09 00 00       	call   800aad <sys_cputs>
+		b->idx = 0;
+  800133:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800139:	83 c4 10             	add    $0x10,%esp
+  80013c:	eb db                	jmp    800119 <putch+0x1f>
+
+0080013e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80013e:	55                   	push   %ebp
+  80013f:	89 e5                	mov    %esp,%ebp
+  800141:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800147:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80014e:	00 00 00 
+	b.cnt = 0;
+  800151:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800158:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80015b:	ff 75 0c             	push   0xc(%ebp)
+  80015e:	ff 75 08             	push   0x8(%ebp)
+  800161:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800167:	50                   	push   %eax
+  800168:	68 fa 00 80 00       	push   $0x8000fa
+  80016d:	e8 14 01 00 00       	call   800286 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800172:	83 c4 08             	add    $0x8,%esp
+  800175:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80017b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800181:	50                   	push   %eax
+  800182:	e8 26 09 00 00       	call   800aad <sys_cputs>
+
+	return b.cnt;
+}
+  800187:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80018d:	c9                   	leave
+  80018e:	c3                   	ret
+
+0080018f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80018f:	55                   	push   %ebp
+  800190:	89 e5                	mov    %esp,%ebp
+  800192:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800195:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800198:	50                   	push   %eax
+  800199:	ff 75 08             	push   0x8(%ebp)
+  80019c:	e8 9d ff ff ff       	call   80013e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001a1:	c9                   	leave
+  8001a2:	c3                   	ret
+
+008001a3 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001a3:	55                   	push   %ebp
+  8001a4:	89 e5                	mov    %esp,%ebp
+  8001a6:	57                   	push   %edi
+  8001a7:	56                   	push   %esi
+  8001a8:	53                   	push   %ebx
+  8001a9:	83 ec 1c             	sub    $0x1c,%esp
+  8001ac:	89 c7                	mov    %eax,%edi
+  8001ae:	89 d6                	mov    %edx,%esi
+  8001b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b6:	89 d1                	mov    %edx,%ecx
+  8001b8:	89 c2                	mov    %eax,%edx
+  8001ba:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001bd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001c0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001c3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001c9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001d0:	39 c2                	cmp    %eax,%edx
+  8001d2:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001d5:	72 3e                	jb     800215 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001d7:	83 ec 0c             	sub    $0xc,%esp
+  8001da:	ff 75 18             	push   0x18(%ebp)
+  8001dd:	83 eb 01             	sub    $0x1,%ebx
+  8001e0:	53                   	push   %ebx
+  8001e1:	50                   	push   %eax
+  8001e2:	83 ec 08             	sub    $0x8,%esp
+  8001e5:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e8:	ff 75 e0             	push   -0x20(%ebp)
+  8001eb:	ff 75 dc             	push   -0x24(%ebp)
+  8001ee:	ff 75 d8             	push   -0x28(%ebp)
+  8001f1:	e8 6a 21 00 00       	call   802360 <__udivdi3>
+  8001f6:	83 c4 18             	add    $0x18,%esp
+  8001f9:	52                   	push   %edx
+  8001fa:	50                   	push   %eax
+  8001fb:	89 f2                	mov    %esi,%edx
+  8001fd:	89 f8                	mov    %edi,%eax
+  8001ff:	e8 9f ff ff ff       	call   8001a3 <printnum>
+  800204:	83 c4 20             	add    $0x20,%esp
+  800207:	eb 13                	jmp    80021c <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800209:	83 ec 08             	sub    $0x8,%esp
+  80020c:	56                   	push   %esi
+  80020d:	ff 75 18             	push   0x18(%ebp)
+  800210:	ff d7                	call   *%edi
+  800212:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800215:	83 eb 01             	sub    $0x1,%ebx
+  800218:	85 db                	test   %ebx,%ebx
+  80021a:	7f ed                	jg     800209 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80021c:	83 ec 08             	sub    $0x8,%esp
+  80021f:	56                   	push   %esi
+  800220:	83 ec 04             	sub    $0x4,%esp
+  800223:	ff 75 e4             	push   -0x1c(%ebp)
+  800226:	ff 75 e0             	push   -0x20(%ebp)
+  800229:	ff 75 dc             	push   -0x24(%ebp)
+  80022c:	ff 75 d8             	push   -0x28(%ebp)
+  80022f:	e8 ec 21 00 00       	call   802420 <__umoddi3>
+  800234:	83 c4 14             	add    $0x14,%esp
+  800237:	0f be 80 55 27 80 00 	movsbl 0x802755(%eax),%eax
+  80023e:	50                   	push   %eax
+  80023f:	ff d7                	call   *%edi
+}
+  800241:	83 c4 10             	add    $0x10,%esp
+  800244:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800247:	5b                   	pop    %ebx
+  800248:	5e                   	pop    %esi
+  800249:	5f                   	pop    %edi
+  80024a:	5d                   	pop    %ebp
+  80024b:	c3                   	ret
+
+0080024c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80024c:	55                   	push   %ebp
+  80024d:	89 e5                	mov    %esp,%ebp
+  80024f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800252:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800256:	8b 10                	mov    (%eax),%edx
+  800258:	3b 50 04             	cmp    0x4(%eax),%edx
+  80025b:	73 0a                	jae    800267 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80025d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800260:	89 08                	mov    %ecx,(%eax)
+  800262:	8b 45 08             	mov    0x8(%ebp),%eax
+  800265:	88 02                	mov    %al,(%edx)
+}
+  800267:	5d                   	pop    %ebp
+  800268:	c3                   	ret
+
+00800269 <printfmt>:
+{
+  800269:	55                   	push   %ebp
+  80026a:	89 e5                	mov    %esp,%ebp
+  80026c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80026f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800272:	50                   	push   %eax
+  800273:	ff 75 10             	push   0x10(%ebp)
+  800276:	ff 75 0c             	push   0xc(%ebp)
+  800279:	ff 75 08             	push   0x8(%ebp)
+  80027c:	e8 05 00 00 00       	call   800286 <vprintfmt>
+}
+  800281:	83 c4 10             	add    $0x10,%esp
+  800284:	c9                   	leave
+  800285:	c3                   	ret
+
+00800286 <vprintfmt>:
+{
+  800286:	55                   	push   %ebp
+  800287:	89 e5                	mov    %esp,%ebp
+  800289:	57                   	push   %edi
+  80028a:	56                   	push   %esi
+  80028b:	53                   	push   %ebx
+  80028c:	83 ec 2c             	sub    $0x2c,%esp
+  80028f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800292:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800295:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800298:	eb 0a                	jmp    8002a4 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80029a:	83 ec 08             	sub    $0x8,%esp
+  80029d:	53                   	push   %ebx
+  80029e:	50                   	push   %eax
+  80029f:	ff d6                	call   *%esi
+  8002a1:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002a4:	83 c7 01             	add    $0x1,%edi
+  8002a7:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002ab:	83 f8 25             	cmp    $0x25,%eax
+  8002ae:	74 0c                	je     8002bc <vprintfmt+0x36>
+			if (ch == '\0')
+  8002b0:	85 c0                	test   %eax,%eax
+  8002b2:	75 e6                	jne    80029a <vprintfmt+0x14>
+}
+  8002b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b7:	5b                   	pop    %ebx
+  8002b8:	5e                   	pop    %esi
+  8002b9:	5f                   	pop    %edi
+  8002ba:	5d                   	pop    %ebp
+  8002bb:	c3                   	ret
+		padc = ' ';
+  8002bc:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002c0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002c7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002ce:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002da:	8d 47 01             	lea    0x1(%edi),%eax
+  8002dd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002e0:	0f b6 17             	movzbl (%edi),%edx
+  8002e3:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002e6:	3c 55                	cmp    $0x55,%al
+  8002e8:	0f 87 cf 03 00 00    	ja     8006bd <vprintfmt+0x437>
+  8002ee:	0f b6 c0             	movzbl %al,%eax
+  8002f1:	ff 24 85 a0 28 80 00 	jmp    *0x8028a0(,%eax,4)
+  8002f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002fb:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002ff:	eb d9                	jmp    8002da <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800301:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800304:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800308:	eb d0                	jmp    8002da <vprintfmt+0x54>
+  80030a:	0f b6 d2             	movzbl %dl,%edx
+  80030d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800310:	b8 00 00 00 00       	mov    $0x0,%eax
+  800315:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800318:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80031b:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80031f:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800322:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800325:	83 f9 09             	cmp    $0x9,%ecx
+  800328:	77 55                	ja     80037f <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80032a:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80032d:	eb e9                	jmp    800318 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80032f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800332:	8b 00                	mov    (%eax),%eax
+  800334:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800337:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033a:	8d 40 04             	lea    0x4(%eax),%eax
+  80033d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800340:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800343:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800347:	79 91                	jns    8002da <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800349:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80034c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80034f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800356:	eb 82                	jmp    8002da <vprintfmt+0x54>
+			if (width < 0)
+  800358:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80035b:	85 d2                	test   %edx,%edx
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	0f 49 c2             	cmovns %edx,%eax
+  800365:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800368:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80036b:	e9 6a ff ff ff       	jmp    8002da <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800370:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800373:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80037a:	e9 5b ff ff ff       	jmp    8002da <vprintfmt+0x54>
+  80037f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800382:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800385:	eb bc                	jmp    800343 <vprintfmt+0xbd>
+			lflag++;
+  800387:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80038a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80038d:	e9 48 ff ff ff       	jmp    8002da <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800392:	8b 45 14             	mov    0x14(%ebp),%eax
+  800395:	8d 78 04             	lea    0x4(%eax),%edi
+  800398:	83 ec 08             	sub    $0x8,%esp
+  80039b:	53                   	push   %ebx
+  80039c:	ff 30                	push   (%eax)
+  80039e:	ff d6                	call   *%esi
+			break;
+  8003a0:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003a3:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003a6:	e9 b1 02 00 00       	jmp    80065c <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ae:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003b1:	8b 10                	mov    (%eax),%edx
+  8003b3:	89 d0                	mov    %edx,%eax
+  8003b5:	f7 d8                	neg    %eax
+  8003b7:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003ba:	83 f8 0f             	cmp    $0xf,%eax
+  8003bd:	7f 23                	jg     8003e2 <vprintfmt+0x15c>
+  8003bf:	8b 14 85 00 2a 80 00 	mov    0x802a00(,%eax,4),%edx
+  8003c6:	85 d2                	test   %edx,%edx
+  8003c8:	74 18                	je     8003e2 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003ca:	52                   	push   %edx
+  8003cb:	68 35 2b 80 00       	push   $0x802b35
+  8003d0:	53                   	push   %ebx
+  8003d1:	56                   	push   %esi
+  8003d2:	e8 92 fe ff ff       	call   800269 <printfmt>
+  8003d7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003da:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003dd:	e9 7a 02 00 00       	jmp    80065c <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003e2:	50                   	push   %eax
+  8003e3:	68 6d 27 80 00       	push   $0x80276d
+  8003e8:	53                   	push   %ebx
+  8003e9:	56                   	push   %esi
+  8003ea:	e8 7a fe ff ff       	call   800269 <printfmt>
+  8003ef:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f2:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003f5:	e9 62 02 00 00       	jmp    80065c <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fd:	83 c0 04             	add    $0x4,%eax
+  800400:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800403:	8b 45 14             	mov    0x14(%ebp),%eax
+  800406:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800408:	85 c9                	test   %ecx,%ecx
+  80040a:	b8 66 27 80 00       	mov    $0x802766,%eax
+  80040f:	0f 45 c1             	cmovne %ecx,%eax
+  800412:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800415:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800419:	7e 06                	jle    800421 <vprintfmt+0x19b>
+  80041b:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80041f:	75 0b                	jne    80042c <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800421:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800424:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800427:	89 75 08             	mov    %esi,0x8(%ebp)
+  80042a:	eb 5c                	jmp    800488 <vprintfmt+0x202>
+  80042c:	83 ec 08             	sub    $0x8,%esp
+  80042f:	ff 75 d0             	push   -0x30(%ebp)
+  800432:	ff 75 cc             	push   -0x34(%ebp)
+  800435:	e8 20 03 00 00       	call   80075a <strnlen>
+  80043a:	89 c2                	mov    %eax,%edx
+  80043c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80043f:	29 d0                	sub    %edx,%eax
+  800441:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800444:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800448:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80044e:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800450:	eb 0e                	jmp    800460 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800452:	83 ec 08             	sub    $0x8,%esp
+  800455:	53                   	push   %ebx
+  800456:	57                   	push   %edi
+  800457:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80045a:	83 ee 01             	sub    $0x1,%esi
+  80045d:	83 c4 10             	add    $0x10,%esp
+  800460:	85 f6                	test   %esi,%esi
+  800462:	7f ee                	jg     800452 <vprintfmt+0x1cc>
+  800464:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800467:	8b 75 08             	mov    0x8(%ebp),%esi
+  80046a:	85 c0                	test   %eax,%eax
+  80046c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800471:	0f 49 d0             	cmovns %eax,%edx
+  800474:	29 d0                	sub    %edx,%eax
+  800476:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800479:	eb a6                	jmp    800421 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80047b:	83 ec 08             	sub    $0x8,%esp
+  80047e:	53                   	push   %ebx
+  80047f:	52                   	push   %edx
+  800480:	ff 55 08             	call   *0x8(%ebp)
+  800483:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800486:	89 f1                	mov    %esi,%ecx
+  800488:	8d 71 01             	lea    0x1(%ecx),%esi
+  80048b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80048f:	0f be d0             	movsbl %al,%edx
+  800492:	85 d2                	test   %edx,%edx
+  800494:	74 28                	je     8004be <vprintfmt+0x238>
+  800496:	85 ff                	test   %edi,%edi
+  800498:	78 05                	js     80049f <vprintfmt+0x219>
+  80049a:	83 ef 01             	sub    $0x1,%edi
+  80049d:	78 30                	js     8004cf <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80049f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004a3:	74 d6                	je     80047b <vprintfmt+0x1f5>
+  8004a5:	0f be c0             	movsbl %al,%eax
+  8004a8:	83 e8 20             	sub    $0x20,%eax
+  8004ab:	83 f8 5e             	cmp    $0x5e,%eax
+  8004ae:	76 cb                	jbe    80047b <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004b0:	83 ec 08             	sub    $0x8,%esp
+  8004b3:	53                   	push   %ebx
+  8004b4:	6a 3f                	push   $0x3f
+  8004b6:	ff 55 08             	call   *0x8(%ebp)
+  8004b9:	83 c4 10             	add    $0x10,%esp
+  8004bc:	eb c8                	jmp    800486 <vprintfmt+0x200>
+  8004be:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004c4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004c7:	01 d0                	add    %edx,%eax
+  8004c9:	29 c8                	sub    %ecx,%eax
+  8004cb:	89 c7                	mov    %eax,%edi
+  8004cd:	eb 13                	jmp    8004e2 <vprintfmt+0x25c>
+  8004cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d2:	eb ed                	jmp    8004c1 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004d4:	83 ec 08             	sub    $0x8,%esp
+  8004d7:	53                   	push   %ebx
+  8004d8:	6a 20                	push   $0x20
+  8004da:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004dc:	83 ef 01             	sub    $0x1,%edi
+  8004df:	83 c4 10             	add    $0x10,%esp
+  8004e2:	85 ff                	test   %edi,%edi
+  8004e4:	7f ee                	jg     8004d4 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004e6:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004e9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ec:	e9 6b 01 00 00       	jmp    80065c <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004f1:	83 f9 01             	cmp    $0x1,%ecx
+  8004f4:	7f 1f                	jg     800515 <vprintfmt+0x28f>
+	else if (lflag)
+  8004f6:	85 c9                	test   %ecx,%ecx
+  8004f8:	74 67                	je     800561 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fd:	8b 00                	mov    (%eax),%eax
+  8004ff:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800502:	89 c1                	mov    %eax,%ecx
+  800504:	c1 f9 1f             	sar    $0x1f,%ecx
+  800507:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80050a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050d:	8d 40 04             	lea    0x4(%eax),%eax
+  800510:	89 45 14             	mov    %eax,0x14(%ebp)
+  800513:	eb 17                	jmp    80052c <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800515:	8b 45 14             	mov    0x14(%ebp),%eax
+  800518:	8b 50 04             	mov    0x4(%eax),%edx
+  80051b:	8b 00                	mov    (%eax),%eax
+  80051d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800520:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800523:	8b 45 14             	mov    0x14(%ebp),%eax
+  800526:	8d 40 08             	lea    0x8(%eax),%eax
+  800529:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80052c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80052f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800532:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800537:	85 c9                	test   %ecx,%ecx
+  800539:	0f 89 03 01 00 00    	jns    800642 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80053f:	83 ec 08             	sub    $0x8,%esp
+  800542:	53                   	push   %ebx
+  800543:	6a 2d                	push   $0x2d
+  800545:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800547:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80054a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80054d:	f7 da                	neg    %edx
+  80054f:	83 d1 00             	adc    $0x0,%ecx
+  800552:	f7 d9                	neg    %ecx
+  800554:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800557:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80055c:	e9 e1 00 00 00       	jmp    800642 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800561:	8b 45 14             	mov    0x14(%ebp),%eax
+  800564:	8b 00                	mov    (%eax),%eax
+  800566:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800569:	89 c1                	mov    %eax,%ecx
+  80056b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80056e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800571:	8b 45 14             	mov    0x14(%ebp),%eax
+  800574:	8d 40 04             	lea    0x4(%eax),%eax
+  800577:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057a:	eb b0                	jmp    80052c <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80057c:	83 f9 01             	cmp    $0x1,%ecx
+  80057f:	7f 1e                	jg     80059f <vprintfmt+0x319>
+	else if (lflag)
+  800581:	85 c9                	test   %ecx,%ecx
+  800583:	74 32                	je     8005b7 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	8b 10                	mov    (%eax),%edx
+  80058a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80058f:	8d 40 04             	lea    0x4(%eax),%eax
+  800592:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800595:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80059a:	e9 a3 00 00 00       	jmp    800642 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80059f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a2:	8b 10                	mov    (%eax),%edx
+  8005a4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8005aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ad:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005b2:	e9 8b 00 00 00       	jmp    800642 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ba:	8b 10                	mov    (%eax),%edx
+  8005bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005c7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005cc:	eb 74                	jmp    800642 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005ce:	83 f9 01             	cmp    $0x1,%ecx
+  8005d1:	7f 1b                	jg     8005ee <vprintfmt+0x368>
+	else if (lflag)
+  8005d3:	85 c9                	test   %ecx,%ecx
+  8005d5:	74 2c                	je     800603 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005da:	8b 10                	mov    (%eax),%edx
+  8005dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005e7:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005ec:	eb 54                	jmp    800642 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f1:	8b 10                	mov    (%eax),%edx
+  8005f3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005f6:	8d 40 08             	lea    0x8(%eax),%eax
+  8005f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005fc:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800601:	eb 3f                	jmp    800642 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8b 10                	mov    (%eax),%edx
+  800608:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80060d:	8d 40 04             	lea    0x4(%eax),%eax
+  800610:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800613:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800618:	eb 28                	jmp    800642 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80061a:	83 ec 08             	sub    $0x8,%esp
+  80061d:	53                   	push   %ebx
+  80061e:	6a 30                	push   $0x30
+  800620:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800622:	83 c4 08             	add    $0x8,%esp
+  800625:	53                   	push   %ebx
+  800626:	6a 78                	push   $0x78
+  800628:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80062a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062d:	8b 10                	mov    (%eax),%edx
+  80062f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800634:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800637:	8d 40 04             	lea    0x4(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80063d:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800642:	83 ec 0c             	sub    $0xc,%esp
+  800645:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800649:	50                   	push   %eax
+  80064a:	ff 75 e0             	push   -0x20(%ebp)
+  80064d:	57                   	push   %edi
+  80064e:	51                   	push   %ecx
+  80064f:	52                   	push   %edx
+  800650:	89 da                	mov    %ebx,%edx
+  800652:	89 f0                	mov    %esi,%eax
+  800654:	e8 4a fb ff ff       	call   8001a3 <printnum>
+			break;
+  800659:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80065c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80065f:	e9 40 fc ff ff       	jmp    8002a4 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800664:	83 f9 01             	cmp    $0x1,%ecx
+  800667:	7f 1b                	jg     800684 <vprintfmt+0x3fe>
+	else if (lflag)
+  800669:	85 c9                	test   %ecx,%ecx
+  80066b:	74 2c                	je     800699 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80066d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800670:	8b 10                	mov    (%eax),%edx
+  800672:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800677:	8d 40 04             	lea    0x4(%eax),%eax
+  80067a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80067d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800682:	eb be                	jmp    800642 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 10                	mov    (%eax),%edx
+  800689:	8b 48 04             	mov    0x4(%eax),%ecx
+  80068c:	8d 40 08             	lea    0x8(%eax),%eax
+  80068f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800692:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800697:	eb a9                	jmp    800642 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800699:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069c:	8b 10                	mov    (%eax),%edx
+  80069e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006ae:	eb 92                	jmp    800642 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006b0:	83 ec 08             	sub    $0x8,%esp
+  8006b3:	53                   	push   %ebx
+  8006b4:	6a 25                	push   $0x25
+  8006b6:	ff d6                	call   *%esi
+			break;
+  8006b8:	83 c4 10             	add    $0x10,%esp
+  8006bb:	eb 9f                	jmp    80065c <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006bd:	83 ec 08             	sub    $0x8,%esp
+  8006c0:	53                   	push   %ebx
+  8006c1:	6a 25                	push   $0x25
+  8006c3:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006c5:	83 c4 10             	add    $0x10,%esp
+  8006c8:	89 f8                	mov    %edi,%eax
+  8006ca:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006ce:	74 05                	je     8006d5 <vprintfmt+0x44f>
+  8006d0:	83 e8 01             	sub    $0x1,%eax
+  8006d3:	eb f5                	jmp    8006ca <vprintfmt+0x444>
+  8006d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006d8:	eb 82                	jmp    80065c <vprintfmt+0x3d6>
+
+008006da <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006da:	55                   	push   %ebp
+  8006db:	89 e5                	mov    %esp,%ebp
+  8006dd:	83 ec 18             	sub    $0x18,%esp
+  8006e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006e6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006e9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006ed:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006f0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006f7:	85 c0                	test   %eax,%eax
+  8006f9:	74 26                	je     800721 <vsnprintf+0x47>
+  8006fb:	85 d2                	test   %edx,%edx
+  8006fd:	7e 22                	jle    800721 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006ff:	ff 75 14             	push   0x14(%ebp)
+  800702:	ff 75 10             	push   0x10(%ebp)
+  800705:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800708:	50                   	push   %eax
+  800709:	68 4c 02 80 00       	push   $0x80024c
+  80070e:	e8 73 fb ff ff       	call   800286 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800713:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800716:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800719:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80071c:	83 c4 10             	add    $0x10,%esp
+}
+  80071f:	c9                   	leave
+  800720:	c3                   	ret
+		return -E_INVAL;
+  800721:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800726:	eb f7                	jmp    80071f <vsnprintf+0x45>
+
+00800728 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800728:	55                   	push   %ebp
+  800729:	89 e5                	mov    %esp,%ebp
+  80072b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80072e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800731:	50                   	push   %eax
+  800732:	ff 75 10             	push   0x10(%ebp)
+  800735:	ff 75 0c             	push   0xc(%ebp)
+  800738:	ff 75 08             	push   0x8(%ebp)
+  80073b:	e8 9a ff ff ff       	call   8006da <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800740:	c9                   	leave
+  800741:	c3                   	ret
+
+00800742 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800742:	55                   	push   %ebp
+  800743:	89 e5                	mov    %esp,%ebp
+  800745:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800748:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074d:	eb 03                	jmp    800752 <strlen+0x10>
+		n++;
+  80074f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800752:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800756:	75 f7                	jne    80074f <strlen+0xd>
+	return n;
+}
+  800758:	5d                   	pop    %ebp
+  800759:	c3                   	ret
+
+0080075a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80075a:	55                   	push   %ebp
+  80075b:	89 e5                	mov    %esp,%ebp
+  80075d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800760:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800763:	b8 00 00 00 00       	mov    $0x0,%eax
+  800768:	eb 03                	jmp    80076d <strnlen+0x13>
+		n++;
+  80076a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80076d:	39 d0                	cmp    %edx,%eax
+  80076f:	74 08                	je     800779 <strnlen+0x1f>
+  800771:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800775:	75 f3                	jne    80076a <strnlen+0x10>
+  800777:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800779:	89 d0                	mov    %edx,%eax
+  80077b:	5d                   	pop    %ebp
+  80077c:	c3                   	ret
+
+0080077d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80077d:	55                   	push   %ebp
+  80077e:	89 e5                	mov    %esp,%ebp
+  800780:	53                   	push   %ebx
+  800781:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800784:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800790:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800793:	83 c0 01             	add    $0x1,%eax
+  800796:	84 d2                	test   %dl,%dl
+  800798:	75 f2                	jne    80078c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80079a:	89 c8                	mov    %ecx,%eax
+  80079c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80079f:	c9                   	leave
+  8007a0:	c3                   	ret
+
+008007a1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007a1:	55                   	push   %ebp
+  8007a2:	89 e5                	mov    %esp,%ebp
+  8007a4:	53                   	push   %ebx
+  8007a5:	83 ec 10             	sub    $0x10,%esp
+  8007a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007ab:	53                   	push   %ebx
+  8007ac:	e8 91 ff ff ff       	call   800742 <strlen>
+  8007b1:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007b4:	ff 75 0c             	push   0xc(%ebp)
+  8007b7:	01 d8                	add    %ebx,%eax
+  8007b9:	50                   	push   %eax
+  8007ba:	e8 be ff ff ff       	call   80077d <strcpy>
+	return dst;
+}
+  8007bf:	89 d8                	mov    %ebx,%eax
+  8007c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c4:	c9                   	leave
+  8007c5:	c3                   	ret
+
+008007c6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007c6:	55                   	push   %ebp
+  8007c7:	89 e5                	mov    %esp,%ebp
+  8007c9:	56                   	push   %esi
+  8007ca:	53                   	push   %ebx
+  8007cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007d1:	89 f3                	mov    %esi,%ebx
+  8007d3:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007d6:	89 f0                	mov    %esi,%eax
+  8007d8:	eb 0f                	jmp    8007e9 <strncpy+0x23>
+		*dst++ = *src;
+  8007da:	83 c0 01             	add    $0x1,%eax
+  8007dd:	0f b6 0a             	movzbl (%edx),%ecx
+  8007e0:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007e3:	80 f9 01             	cmp    $0x1,%cl
+  8007e6:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007e9:	39 d8                	cmp    %ebx,%eax
+  8007eb:	75 ed                	jne    8007da <strncpy+0x14>
+	}
+	return ret;
+}
+  8007ed:	89 f0                	mov    %esi,%eax
+  8007ef:	5b                   	pop    %ebx
+  8007f0:	5e                   	pop    %esi
+  8007f1:	5d                   	pop    %ebp
+  8007f2:	c3                   	ret
+
+008007f3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007f3:	55                   	push   %ebp
+  8007f4:	89 e5                	mov    %esp,%ebp
+  8007f6:	56                   	push   %esi
+  8007f7:	53                   	push   %ebx
+  8007f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007fe:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800801:	89 f0                	mov    %esi,%eax
+  800803:	85 d2                	test   %edx,%edx
+  800805:	74 21                	je     800828 <strlcpy+0x35>
+  800807:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80080b:	89 f2                	mov    %esi,%edx
+  80080d:	eb 09                	jmp    800818 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80080f:	83 c1 01             	add    $0x1,%ecx
+  800812:	83 c2 01             	add    $0x1,%edx
+  800815:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800818:	39 c2                	cmp    %eax,%edx
+  80081a:	74 09                	je     800825 <strlcpy+0x32>
+  80081c:	0f b6 19             	movzbl (%ecx),%ebx
+  80081f:	84 db                	test   %bl,%bl
+  800821:	75 ec                	jne    80080f <strlcpy+0x1c>
+  800823:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800825:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800828:	29 f0                	sub    %esi,%eax
+}
+  80082a:	5b                   	pop    %ebx
+  80082b:	5e                   	pop    %esi
+  80082c:	5d                   	pop    %ebp
+  80082d:	c3                   	ret
+
+0080082e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80082e:	55                   	push   %ebp
+  80082f:	89 e5                	mov    %esp,%ebp
+  800831:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800834:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800837:	eb 06                	jmp    80083f <strcmp+0x11>
+		p++, q++;
+  800839:	83 c1 01             	add    $0x1,%ecx
+  80083c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80083f:	0f b6 01             	movzbl (%ecx),%eax
+  800842:	84 c0                	test   %al,%al
+  800844:	74 04                	je     80084a <strcmp+0x1c>
+  800846:	3a 02                	cmp    (%edx),%al
+  800848:	74 ef                	je     800839 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80084a:	0f b6 c0             	movzbl %al,%eax
+  80084d:	0f b6 12             	movzbl (%edx),%edx
+  800850:	29 d0                	sub    %edx,%eax
+}
+  800852:	5d                   	pop    %ebp
+  800853:	c3                   	ret
+
+00800854 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	53                   	push   %ebx
+  800858:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80085e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800861:	eb 09                	jmp    80086c <strncmp+0x18>
+		n--, p++, q++;
+  800863:	83 ea 01             	sub    $0x1,%edx
+  800866:	83 c0 01             	add    $0x1,%eax
+  800869:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80086c:	85 d2                	test   %edx,%edx
+  80086e:	74 18                	je     800888 <strncmp+0x34>
+  800870:	0f b6 18             	movzbl (%eax),%ebx
+  800873:	84 db                	test   %bl,%bl
+  800875:	74 04                	je     80087b <strncmp+0x27>
+  800877:	3a 19                	cmp    (%ecx),%bl
+  800879:	74 e8                	je     800863 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80087b:	0f b6 00             	movzbl (%eax),%eax
+  80087e:	0f b6 11             	movzbl (%ecx),%edx
+  800881:	29 d0                	sub    %edx,%eax
+}
+  800883:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800886:	c9                   	leave
+  800887:	c3                   	ret
+		return 0;
+  800888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088d:	eb f4                	jmp    800883 <strncmp+0x2f>
+
+0080088f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80088f:	55                   	push   %ebp
+  800890:	89 e5                	mov    %esp,%ebp
+  800892:	8b 45 08             	mov    0x8(%ebp),%eax
+  800895:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800899:	eb 03                	jmp    80089e <strchr+0xf>
+  80089b:	83 c0 01             	add    $0x1,%eax
+  80089e:	0f b6 10             	movzbl (%eax),%edx
+  8008a1:	84 d2                	test   %dl,%dl
+  8008a3:	74 06                	je     8008ab <strchr+0x1c>
+		if (*s == c)
+  8008a5:	38 ca                	cmp    %cl,%dl
+  8008a7:	75 f2                	jne    80089b <strchr+0xc>
+  8008a9:	eb 05                	jmp    8008b0 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008b0:	5d                   	pop    %ebp
+  8008b1:	c3                   	ret
+
+008008b2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008b2:	55                   	push   %ebp
+  8008b3:	89 e5                	mov    %esp,%ebp
+  8008b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008bc:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008bf:	38 ca                	cmp    %cl,%dl
+  8008c1:	74 09                	je     8008cc <strfind+0x1a>
+  8008c3:	84 d2                	test   %dl,%dl
+  8008c5:	74 05                	je     8008cc <strfind+0x1a>
+	for (; *s; s++)
+  8008c7:	83 c0 01             	add    $0x1,%eax
+  8008ca:	eb f0                	jmp    8008bc <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008cc:	5d                   	pop    %ebp
+  8008cd:	c3                   	ret
+
+008008ce <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008ce:	55                   	push   %ebp
+  8008cf:	89 e5                	mov    %esp,%ebp
+  8008d1:	57                   	push   %edi
+  8008d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008d5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008d8:	85 c9                	test   %ecx,%ecx
+  8008da:	74 20                	je     8008fc <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008dc:	89 f8                	mov    %edi,%eax
+  8008de:	09 c8                	or     %ecx,%eax
+  8008e0:	a8 03                	test   $0x3,%al
+  8008e2:	75 12                	jne    8008f6 <memset+0x28>
+		c &= 0xFF;
+  8008e4:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008e8:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008ee:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008f1:	fc                   	cld
+  8008f2:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008f4:	eb 06                	jmp    8008fc <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008f9:	fc                   	cld
+  8008fa:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008fc:	89 f8                	mov    %edi,%eax
+  8008fe:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800901:	c9                   	leave
+  800902:	c3                   	ret
+
+00800903 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800903:	55                   	push   %ebp
+  800904:	89 e5                	mov    %esp,%ebp
+  800906:	57                   	push   %edi
+  800907:	56                   	push   %esi
+  800908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80090e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800911:	39 c6                	cmp    %eax,%esi
+  800913:	73 32                	jae    800947 <memmove+0x44>
+  800915:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800918:	39 d0                	cmp    %edx,%eax
+  80091a:	73 2b                	jae    800947 <memmove+0x44>
+		s += n;
+		d += n;
+  80091c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80091f:	89 d6                	mov    %edx,%esi
+  800921:	09 fe                	or     %edi,%esi
+  800923:	09 ce                	or     %ecx,%esi
+  800925:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80092b:	75 0e                	jne    80093b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80092d:	83 ef 04             	sub    $0x4,%edi
+  800930:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800933:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800936:	fd                   	std
+  800937:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800939:	eb 09                	jmp    800944 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80093b:	83 ef 01             	sub    $0x1,%edi
+  80093e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800941:	fd                   	std
+  800942:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800944:	fc                   	cld
+  800945:	eb 1a                	jmp    800961 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800947:	89 f2                	mov    %esi,%edx
+  800949:	09 c2                	or     %eax,%edx
+  80094b:	09 ca                	or     %ecx,%edx
+  80094d:	f6 c2 03             	test   $0x3,%dl
+  800950:	75 0a                	jne    80095c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800952:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800955:	89 c7                	mov    %eax,%edi
+  800957:	fc                   	cld
+  800958:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80095a:	eb 05                	jmp    800961 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80095c:	89 c7                	mov    %eax,%edi
+  80095e:	fc                   	cld
+  80095f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800961:	5e                   	pop    %esi
+  800962:	5f                   	pop    %edi
+  800963:	5d                   	pop    %ebp
+  800964:	c3                   	ret
+
+00800965 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800965:	55                   	push   %ebp
+  800966:	89 e5                	mov    %esp,%ebp
+  800968:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80096b:	ff 75 10             	push   0x10(%ebp)
+  80096e:	ff 75 0c             	push   0xc(%ebp)
+  800971:	ff 75 08             	push   0x8(%ebp)
+  800974:	e8 8a ff ff ff       	call   800903 <memmove>
+}
+  800979:	c9                   	leave
+  80097a:	c3                   	ret
+
+0080097b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80097b:	55                   	push   %ebp
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	56                   	push   %esi
+  80097f:	53                   	push   %ebx
+  800980:	8b 45 08             	mov    0x8(%ebp),%eax
+  800983:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800986:	89 c6                	mov    %eax,%esi
+  800988:	03 75 10             	add    0x10(%ebp),%esi
+  80098b:	eb 06                	jmp    800993 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80098d:	83 c0 01             	add    $0x1,%eax
+  800990:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800993:	39 f0                	cmp    %esi,%eax
+  800995:	74 14                	je     8009ab <memcmp+0x30>
+		if (*s1 != *s2)
+  800997:	0f b6 08             	movzbl (%eax),%ecx
+  80099a:	0f b6 1a             	movzbl (%edx),%ebx
+  80099d:	38 d9                	cmp    %bl,%cl
+  80099f:	74 ec                	je     80098d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009a1:	0f b6 c1             	movzbl %cl,%eax
+  8009a4:	0f b6 db             	movzbl %bl,%ebx
+  8009a7:	29 d8                	sub    %ebx,%eax
+  8009a9:	eb 05                	jmp    8009b0 <memcmp+0x35>
+	}
+
+	return 0;
+  8009ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009b0:	5b                   	pop    %ebx
+  8009b1:	5e                   	pop    %esi
+  8009b2:	5d                   	pop    %ebp
+  8009b3:	c3                   	ret
+
+008009b4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009b4:	55                   	push   %ebp
+  8009b5:	89 e5                	mov    %esp,%ebp
+  8009b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009bd:	89 c2                	mov    %eax,%edx
+  8009bf:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009c2:	eb 03                	jmp    8009c7 <memfind+0x13>
+  8009c4:	83 c0 01             	add    $0x1,%eax
+  8009c7:	39 d0                	cmp    %edx,%eax
+  8009c9:	73 04                	jae    8009cf <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009cb:	38 08                	cmp    %cl,(%eax)
+  8009cd:	75 f5                	jne    8009c4 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009cf:	5d                   	pop    %ebp
+  8009d0:	c3                   	ret
+
+008009d1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	57                   	push   %edi
+  8009d5:	56                   	push   %esi
+  8009d6:	53                   	push   %ebx
+  8009d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009dd:	eb 03                	jmp    8009e2 <strtol+0x11>
+		s++;
+  8009df:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009e2:	0f b6 02             	movzbl (%edx),%eax
+  8009e5:	3c 20                	cmp    $0x20,%al
+  8009e7:	74 f6                	je     8009df <strtol+0xe>
+  8009e9:	3c 09                	cmp    $0x9,%al
+  8009eb:	74 f2                	je     8009df <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009ed:	3c 2b                	cmp    $0x2b,%al
+  8009ef:	74 2a                	je     800a1b <strtol+0x4a>
+	int neg = 0;
+  8009f1:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009f6:	3c 2d                	cmp    $0x2d,%al
+  8009f8:	74 2b                	je     800a25 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009fa:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a00:	75 0f                	jne    800a11 <strtol+0x40>
+  800a02:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a05:	74 28                	je     800a2f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a07:	85 db                	test   %ebx,%ebx
+  800a09:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a0e:	0f 44 d8             	cmove  %eax,%ebx
+  800a11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a16:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a19:	eb 46                	jmp    800a61 <strtol+0x90>
+		s++;
+  800a1b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a23:	eb d5                	jmp    8009fa <strtol+0x29>
+		s++, neg = 1;
+  800a25:	83 c2 01             	add    $0x1,%edx
+  800a28:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a2d:	eb cb                	jmp    8009fa <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a2f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a33:	74 0e                	je     800a43 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a35:	85 db                	test   %ebx,%ebx
+  800a37:	75 d8                	jne    800a11 <strtol+0x40>
+		s++, base = 8;
+  800a39:	83 c2 01             	add    $0x1,%edx
+  800a3c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a41:	eb ce                	jmp    800a11 <strtol+0x40>
+		s += 2, base = 16;
+  800a43:	83 c2 02             	add    $0x2,%edx
+  800a46:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a4b:	eb c4                	jmp    800a11 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a4d:	0f be c0             	movsbl %al,%eax
+  800a50:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a53:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a56:	7d 3a                	jge    800a92 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a58:	83 c2 01             	add    $0x1,%edx
+  800a5b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a5f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a61:	0f b6 02             	movzbl (%edx),%eax
+  800a64:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a67:	89 f3                	mov    %esi,%ebx
+  800a69:	80 fb 09             	cmp    $0x9,%bl
+  800a6c:	76 df                	jbe    800a4d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a6e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a71:	89 f3                	mov    %esi,%ebx
+  800a73:	80 fb 19             	cmp    $0x19,%bl
+  800a76:	77 08                	ja     800a80 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a78:	0f be c0             	movsbl %al,%eax
+  800a7b:	83 e8 57             	sub    $0x57,%eax
+  800a7e:	eb d3                	jmp    800a53 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a80:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a83:	89 f3                	mov    %esi,%ebx
+  800a85:	80 fb 19             	cmp    $0x19,%bl
+  800a88:	77 08                	ja     800a92 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a8a:	0f be c0             	movsbl %al,%eax
+  800a8d:	83 e8 37             	sub    $0x37,%eax
+  800a90:	eb c1                	jmp    800a53 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a92:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a96:	74 05                	je     800a9d <strtol+0xcc>
+		*endptr = (char *) s;
+  800a98:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a9b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a9d:	89 c8                	mov    %ecx,%eax
+  800a9f:	f7 d8                	neg    %eax
+  800aa1:	85 ff                	test   %edi,%edi
+  800aa3:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aa6:	89 c8                	mov    %ecx,%eax
+  800aa8:	5b                   	pop    %ebx
+  800aa9:	5e                   	pop    %esi
+  800aaa:	5f                   	pop    %edi
+  800aab:	5d                   	pop    %ebp
+  800aac:	c3                   	ret
+
+00800aad <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	57                   	push   %edi
+  800ab1:	56                   	push   %esi
+  800ab2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800abb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800abe:	89 c3                	mov    %eax,%ebx
+  800ac0:	89 c7                	mov    %eax,%edi
+  800ac2:	89 c6                	mov    %eax,%esi
+  800ac4:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ac6:	5b                   	pop    %ebx
+  800ac7:	5e                   	pop    %esi
+  800ac8:	5f                   	pop    %edi
+  800ac9:	5d                   	pop    %ebp
+  800aca:	c3                   	ret
+
+00800acb <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800acb:	55                   	push   %ebp
+  800acc:	89 e5                	mov    %esp,%ebp
+  800ace:	57                   	push   %edi
+  800acf:	56                   	push   %esi
+  800ad0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ad1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ad6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800adb:	89 d1                	mov    %edx,%ecx
+  800add:	89 d3                	mov    %edx,%ebx
+  800adf:	89 d7                	mov    %edx,%edi
+  800ae1:	89 d6                	mov    %edx,%esi
+  800ae3:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ae5:	5b                   	pop    %ebx
+  800ae6:	5e                   	pop    %esi
+  800ae7:	5f                   	pop    %edi
+  800ae8:	5d                   	pop    %ebp
+  800ae9:	c3                   	ret
+
+00800aea <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	57                   	push   %edi
+  800aee:	56                   	push   %esi
+  800aef:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800af0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800af8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800afd:	89 cb                	mov    %ecx,%ebx
+  800aff:	89 cf                	mov    %ecx,%edi
+  800b01:	89 ce                	mov    %ecx,%esi
+  800b03:	cd 30                	int    $0x30
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+  800b05:	5b                   	pop    %ebx
+  800b06:	5e                   	pop    %esi
+  800b07:	5f                   	pop    %edi
+  800b08:	5d                   	pop    %ebp
+  800b09:	c3                   	ret
+
+00800b0a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b0a:	55                   	push   %ebp
+  800b0b:	89 e5                	mov    %esp,%ebp
+  800b0d:	57                   	push   %edi
+  800b0e:	56                   	push   %esi
+  800b0f:	53                   	push   %ebx
+  800b10:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b20:	89 cb                	mov    %ecx,%ebx
+  800b22:	89 cf                	mov    %ecx,%edi
+  800b24:	89 ce                	mov    %ecx,%esi
+  800b26:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b28:	85 c0                	test   %eax,%eax
+  800b2a:	7f 08                	jg     800b34 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b2f:	5b                   	pop    %ebx
+  800b30:	5e                   	pop    %esi
+  800b31:	5f                   	pop    %edi
+  800b32:	5d                   	pop    %ebp
+  800b33:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b34:	83 ec 0c             	sub    $0xc,%esp
+  800b37:	50                   	push   %eax
+  800b38:	6a 03                	push   $0x3
+  800b3a:	68 5f 2a 80 00       	push   $0x802a5f
+  800b3f:	6a 23                	push   $0x23
+  800b41:	68 7c 2a 80 00       	push   $0x802a7c
+  800b46:	e8 d5 15 00 00       	call   802120 <_panic>
+
+00800b4b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	57                   	push   %edi
+  800b4f:	56                   	push   %esi
+  800b50:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b56:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b5b:	89 d1                	mov    %edx,%ecx
+  800b5d:	89 d3                	mov    %edx,%ebx
+  800b5f:	89 d7                	mov    %edx,%edi
+  800b61:	89 d6                	mov    %edx,%esi
+  800b63:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b65:	5b                   	pop    %ebx
+  800b66:	5e                   	pop    %esi
+  800b67:	5f                   	pop    %edi
+  800b68:	5d                   	pop    %ebp
+  800b69:	c3                   	ret
+
+00800b6a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b6a:	55                   	push   %ebp
+  800b6b:	89 e5                	mov    %esp,%ebp
+  800b6d:	57                   	push   %edi
+  800b6e:	56                   	push   %esi
+  800b6f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b75:	b8 16 00 00 00       	mov    $0x16,%eax
+  800b7a:	89 d1                	mov    %edx,%ecx
+  800b7c:	89 d3                	mov    %edx,%ebx
+  800b7e:	89 d7                	mov    %edx,%edi
+  800b80:	89 d6                	mov    %edx,%esi
+  800b82:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b84:	5b                   	pop    %ebx
+  800b85:	5e                   	pop    %esi
+  800b86:	5f                   	pop    %edi
+  800b87:	5d                   	pop    %ebp
+  800b88:	c3                   	ret
+
+00800b89 <sys_fork_cow>:
+
+envid_t
+sys_fork_cow(void)
+{
+  800b89:	55                   	push   %ebp
+  800b8a:	89 e5                	mov    %esp,%ebp
+  800b8c:	57                   	push   %edi
+  800b8d:	56                   	push   %esi
+  800b8e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b94:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800b99:	89 d1                	mov    %edx,%ecx
+  800b9b:	89 d3                	mov    %edx,%ebx
+  800b9d:	89 d7                	mov    %edx,%edi
+  800b9f:	89 d6                	mov    %edx,%esi
+  800ba1:	cd 30                	int    $0x30
+	return syscall(SYS_fork_cow, 0, 0, 0, 0, 0, 0);
+}
+  800ba3:	5b                   	pop    %ebx
+  800ba4:	5e                   	pop    %esi
+  800ba5:	5f                   	pop    %edi
+  800ba6:	5d                   	pop    %ebp
+  800ba7:	c3                   	ret
+
+00800ba8 <sys_env_set_kernel_cow>:
+
+int
+sys_env_set_kernel_cow(envid_t envid, int enable)
+{
+  800ba8:	55                   	push   %ebp
+  800ba9:	89 e5                	mov    %esp,%ebp
+  800bab:	57                   	push   %edi
+  800bac:	56                   	push   %esi
+  800bad:	53                   	push   %ebx
+  800bae:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bbc:	b8 15 00 00 00       	mov    $0x15,%eax
+  800bc1:	89 df                	mov    %ebx,%edi
+  800bc3:	89 de                	mov    %ebx,%esi
+  800bc5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bc7:	85 c0                	test   %eax,%eax
+  800bc9:	7f 08                	jg     800bd3 <sys_env_set_kernel_cow+0x2b>
+	return syscall(SYS_env_set_kernel_cow, 1, envid, enable, 0, 0, 0);
+}
+  800bcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bce:	5b                   	pop    %ebx
+  800bcf:	5e                   	pop    %esi
+  800bd0:	5f                   	pop    %edi
+  800bd1:	5d                   	pop    %ebp
+  800bd2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bd3:	83 ec 0c             	sub    $0xc,%esp
+  800bd6:	50                   	push   %eax
+  800bd7:	6a 15                	push   $0x15
+  800bd9:	68 5f 2a 80 00       	push   $0x802a5f
+  800bde:	6a 23                	push   $0x23
+  800be0:	68 7c 2a 80 00       	push   $0x802a7c
+  800be5:	e8 36 15 00 00       	call   802120 <_panic>
+
+00800bea <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	57                   	push   %edi
+  800bee:	56                   	push   %esi
+  800bef:	53                   	push   %ebx
+  800bf0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bf3:	be 00 00 00 00       	mov    $0x0,%esi
+  800bf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfe:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c06:	89 f7                	mov    %esi,%edi
+  800c08:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c0a:	85 c0                	test   %eax,%eax
+  800c0c:	7f 08                	jg     800c16 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c11:	5b                   	pop    %ebx
+  800c12:	5e                   	pop    %esi
+  800c13:	5f                   	pop    %edi
+  800c14:	5d                   	pop    %ebp
+  800c15:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c16:	83 ec 0c             	sub    $0xc,%esp
+  800c19:	50                   	push   %eax
+  800c1a:	6a 05                	push   $0x5
+  800c1c:	68 5f 2a 80 00       	push   $0x802a5f
+  800c21:	6a 23                	push   $0x23
+  800c23:	68 7c 2a 80 00       	push   $0x802a7c
+  800c28:	e8 f3 14 00 00       	call   802120 <_panic>
+
+00800c2d <sys_page_alloc_large>:
+
+int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	57                   	push   %edi
+  800c31:	56                   	push   %esi
+  800c32:	53                   	push   %ebx
+  800c33:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c36:	be 00 00 00 00       	mov    $0x0,%esi
+  800c3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c41:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c49:	89 f7                	mov    %esi,%edi
+  800c4b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c4d:	85 c0                	test   %eax,%eax
+  800c4f:	7f 08                	jg     800c59 <sys_page_alloc_large+0x2c>
+	return syscall(SYS_page_alloc_large, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c54:	5b                   	pop    %ebx
+  800c55:	5e                   	pop    %esi
+  800c56:	5f                   	pop    %edi
+  800c57:	5d                   	pop    %ebp
+  800c58:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c59:	83 ec 0c             	sub    $0xc,%esp
+  800c5c:	50                   	push   %eax
+  800c5d:	6a 06                	push   $0x6
+  800c5f:	68 5f 2a 80 00       	push   $0x802a5f
+  800c64:	6a 23                	push   $0x23
+  800c66:	68 7c 2a 80 00       	push   $0x802a7c
+  800c6b:	e8 b0 14 00 00       	call   802120 <_panic>
+
+00800c70 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c70:	55                   	push   %ebp
+  800c71:	89 e5                	mov    %esp,%ebp
+  800c73:	57                   	push   %edi
+  800c74:	56                   	push   %esi
+  800c75:	53                   	push   %ebx
+  800c76:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7f:	b8 07 00 00 00       	mov    $0x7,%eax
+  800c84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c87:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c8a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c8d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c8f:	85 c0                	test   %eax,%eax
+  800c91:	7f 08                	jg     800c9b <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c96:	5b                   	pop    %ebx
+  800c97:	5e                   	pop    %esi
+  800c98:	5f                   	pop    %edi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c9b:	83 ec 0c             	sub    $0xc,%esp
+  800c9e:	50                   	push   %eax
+  800c9f:	6a 07                	push   $0x7
+  800ca1:	68 5f 2a 80 00       	push   $0x802a5f
+  800ca6:	6a 23                	push   $0x23
+  800ca8:	68 7c 2a 80 00       	push   $0x802a7c
+  800cad:	e8 6e 14 00 00       	call   802120 <_panic>
+
+00800cb2 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cb2:	55                   	push   %ebp
+  800cb3:	89 e5                	mov    %esp,%ebp
+  800cb5:	57                   	push   %edi
+  800cb6:	56                   	push   %esi
+  800cb7:	53                   	push   %ebx
+  800cb8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc6:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ccb:	89 df                	mov    %ebx,%edi
+  800ccd:	89 de                	mov    %ebx,%esi
+  800ccf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd1:	85 c0                	test   %eax,%eax
+  800cd3:	7f 08                	jg     800cdd <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd8:	5b                   	pop    %ebx
+  800cd9:	5e                   	pop    %esi
+  800cda:	5f                   	pop    %edi
+  800cdb:	5d                   	pop    %ebp
+  800cdc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cdd:	83 ec 0c             	sub    $0xc,%esp
+  800ce0:	50                   	push   %eax
+  800ce1:	6a 08                	push   $0x8
+  800ce3:	68 5f 2a 80 00       	push   $0x802a5f
+  800ce8:	6a 23                	push   $0x23
+  800cea:	68 7c 2a 80 00       	push   $0x802a7c
+  800cef:	e8 2c 14 00 00       	call   802120 <_panic>
+
+00800cf4 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	57                   	push   %edi
+  800cf8:	56                   	push   %esi
+  800cf9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d00:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d05:	be 00 00 00 00       	mov    $0x0,%esi
+  800d0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d0d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d10:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d12:	5b                   	pop    %ebx
+  800d13:	5e                   	pop    %esi
+  800d14:	5f                   	pop    %edi
+  800d15:	5d                   	pop    %ebp
+  800d16:	c3                   	ret
+
+00800d17 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	57                   	push   %edi
+  800d1b:	56                   	push   %esi
+  800d1c:	53                   	push   %ebx
+  800d1d:	8b 45 18             	mov    0x18(%ebp),%eax
+  800d20:	8b 55 1c             	mov    0x1c(%ebp),%edx
+	// Six arguments don't fit: npages goes above perm's bits.
+	if (npages > PGNUM(UTOP) || PTE_ADDR(perm))
+  800d23:	3d 00 ec 0e 00       	cmp    $0xeec00,%eax
+  800d28:	77 27                	ja     800d51 <sys_page_map_range+0x3a>
+  800d2a:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800d30:	77 1f                	ja     800d51 <sys_page_map_range+0x3a>
+		return -E_INVAL;
+	return syscall(SYS_page_map_range, 0, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, (npages << PGSHIFT) | perm);
+  800d32:	c1 e0 0c             	shl    $0xc,%eax
+  800d35:	89 c6                	mov    %eax,%esi
+  800d37:	09 d6                	or     %edx,%esi
+	asm volatile("int %1\n"
+  800d39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d47:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d4a:	cd 30                	int    $0x30
+}
+  800d4c:	5b                   	pop    %ebx
+  800d4d:	5e                   	pop    %esi
+  800d4e:	5f                   	pop    %edi
+  800d4f:	5d                   	pop    %ebp
+  800d50:	c3                   	ret
+		return -E_INVAL;
+  800d51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d56:	eb f4                	jmp    800d4c <sys_page_map_range+0x35>
+
+00800d58 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  800d58:	55                   	push   %ebp
+  800d59:	89 e5                	mov    %esp,%ebp
+  800d5b:	57                   	push   %edi
+  800d5c:	56                   	push   %esi
+  800d5d:	53                   	push   %ebx
+  800d5e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d67:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d6c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d74:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d77:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d79:	85 c0                	test   %eax,%eax
+  800d7b:	7f 08                	jg     800d85 <sys_region_reserve+0x2d>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  800d7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d80:	5b                   	pop    %ebx
+  800d81:	5e                   	pop    %esi
+  800d82:	5f                   	pop    %edi
+  800d83:	5d                   	pop    %ebp
+  800d84:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d85:	83 ec 0c             	sub    $0xc,%esp
+  800d88:	50                   	push   %eax
+  800d89:	6a 0c                	push   $0xc
+  800d8b:	68 5f 2a 80 00       	push   $0x802a5f
+  800d90:	6a 23                	push   $0x23
+  800d92:	68 7c 2a 80 00       	push   $0x802a7c
+  800d97:	e8 84 13 00 00       	call   802120 <_panic>
+
+00800d9c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	57                   	push   %edi
+  800da0:	56                   	push   %esi
+  800da1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800da2:	be 00 00 00 00       	mov    $0x0,%esi
+  800da7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800daa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dad:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800db2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db5:	89 f7                	mov    %esi,%edi
+  800db7:	cd 30                	int    $0x30
+	return syscall(SYS_page_unmap_range, 0, envid, (uint32_t) va, npages, 0, 0);
+}
+  800db9:	5b                   	pop    %ebx
+  800dba:	5e                   	pop    %esi
+  800dbb:	5f                   	pop    %edi
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	c3                   	ret
+
+00800dbe <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	57                   	push   %edi
+  800dc2:	56                   	push   %esi
+  800dc3:	53                   	push   %ebx
+  800dc4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dd7:	89 df                	mov    %ebx,%edi
+  800dd9:	89 de                	mov    %ebx,%esi
+  800ddb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddd:	85 c0                	test   %eax,%eax
+  800ddf:	7f 08                	jg     800de9 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800de1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de9:	83 ec 0c             	sub    $0xc,%esp
+  800dec:	50                   	push   %eax
+  800ded:	6a 0f                	push   $0xf
+  800def:	68 5f 2a 80 00       	push   $0x802a5f
+  800df4:	6a 23                	push   $0x23
+  800df6:	68 7c 2a 80 00       	push   $0x802a7c
+  800dfb:	e8 20 13 00 00       	call   802120 <_panic>
+
+00800e00 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	57                   	push   %edi
+  800e04:	56                   	push   %esi
+  800e05:	53                   	push   %ebx
+  800e06:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e14:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e19:	89 df                	mov    %ebx,%edi
+  800e1b:	89 de                	mov    %ebx,%esi
+  800e1d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e1f:	85 c0                	test   %eax,%eax
+  800e21:	7f 08                	jg     800e2b <sys_env_set_priority+0x2b>
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+  800e23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e26:	5b                   	pop    %ebx
+  800e27:	5e                   	pop    %esi
+  800e28:	5f                   	pop    %edi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2b:	83 ec 0c             	sub    $0xc,%esp
+  800e2e:	50                   	push   %eax
+  800e2f:	6a 10                	push   $0x10
+  800e31:	68 5f 2a 80 00       	push   $0x802a5f
+  800e36:	6a 23                	push   $0x23
+  800e38:	68 7c 2a 80 00       	push   $0x802a7c
+  800e3d:	e8 de 12 00 00       	call   802120 <_panic>
+
+00800e42 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	57                   	push   %edi
+  800e46:	56                   	push   %esi
+  800e47:	53                   	push   %ebx
+  800e48:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e56:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e5b:	89 df                	mov    %ebx,%edi
+  800e5d:	89 de                	mov    %ebx,%esi
+  800e5f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e61:	85 c0                	test   %eax,%eax
+  800e63:	7f 08                	jg     800e6d <sys_env_set_affinity+0x2b>
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+}
+  800e65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e68:	5b                   	pop    %ebx
+  800e69:	5e                   	pop    %esi
+  800e6a:	5f                   	pop    %edi
+  800e6b:	5d                   	pop    %ebp
+  800e6c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e6d:	83 ec 0c             	sub    $0xc,%esp
+  800e70:	50                   	push   %eax
+  800e71:	6a 11                	push   $0x11
+  800e73:	68 5f 2a 80 00       	push   $0x802a5f
+  800e78:	6a 23                	push   $0x23
+  800e7a:	68 7c 2a 80 00       	push   $0x802a7c
+  800e7f:	e8 9c 12 00 00       	call   802120 <_panic>
+
+00800e84 <sys_ncpu>:
+
+int
+sys_ncpu(void)
+{
+  800e84:	55                   	push   %ebp
+  800e85:	89 e5                	mov    %esp,%ebp
+  800e87:	57                   	push   %edi
+  800e88:	56                   	push   %esi
+  800e89:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e94:	89 d1                	mov    %edx,%ecx
+  800e96:	89 d3                	mov    %edx,%ebx
+  800e98:	89 d7                	mov    %edx,%edi
+  800e9a:	89 d6                	mov    %edx,%esi
+  800e9c:	cd 30                	int    $0x30
+	return syscall(SYS_ncpu, 0, 0, 0, 0, 0, 0);
+}
+  800e9e:	5b                   	pop    %ebx
+  800e9f:	5e                   	pop    %esi
+  800ea0:	5f                   	pop    %edi
+  800ea1:	5d                   	pop    %ebp
+  800ea2:	c3                   	ret
+
+00800ea3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ea3:	55                   	push   %ebp
+  800ea4:	89 e5                	mov    %esp,%ebp
+  800ea6:	57                   	push   %edi
+  800ea7:	56                   	push   %esi
+  800ea8:	53                   	push   %ebx
+  800ea9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb7:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ebc:	89 df                	mov    %ebx,%edi
+  800ebe:	89 de                	mov    %ebx,%esi
+  800ec0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec2:	85 c0                	test   %eax,%eax
+  800ec4:	7f 08                	jg     800ece <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ec6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec9:	5b                   	pop    %ebx
+  800eca:	5e                   	pop    %esi
+  800ecb:	5f                   	pop    %edi
+  800ecc:	5d                   	pop    %ebp
+  800ecd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ece:	83 ec 0c             	sub    $0xc,%esp
+  800ed1:	50                   	push   %eax
+  800ed2:	6a 13                	push   $0x13
+  800ed4:	68 5f 2a 80 00       	push   $0x802a5f
+  800ed9:	6a 23                	push   $0x23
+  800edb:	68 7c 2a 80 00       	push   $0x802a7c
+  800ee0:	e8 3b 12 00 00       	call   802120 <_panic>
+
+00800ee5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ee5:	55                   	push   %ebp
+  800ee6:	89 e5                	mov    %esp,%ebp
+  800ee8:	57                   	push   %edi
+  800ee9:	56                   	push   %esi
+  800eea:	53                   	push   %ebx
+  800eeb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef9:	b8 14 00 00 00       	mov    $0x14,%eax
+  800efe:	89 df                	mov    %ebx,%edi
+  800f00:	89 de                	mov    %ebx,%esi
+  800f02:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f04:	85 c0                	test   %eax,%eax
+  800f06:	7f 08                	jg     800f10 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0b:	5b                   	pop    %ebx
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5f                   	pop    %edi
+  800f0e:	5d                   	pop    %ebp
+  800f0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f10:	83 ec 0c             	sub    $0xc,%esp
+  800f13:	50                   	push   %eax
+  800f14:	6a 14                	push   $0x14
+  800f16:	68 5f 2a 80 00       	push   $0x802a5f
+  800f1b:	6a 23                	push   $0x23
+  800f1d:	68 7c 2a 80 00       	push   $0x802a7c
+  800f22:	e8 f9 11 00 00       	call   802120 <_panic>
+
+00800f27 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	57                   	push   %edi
+  800f2b:	56                   	push   %esi
+  800f2c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f33:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f38:	be 00 00 00 00       	mov    $0x0,%esi
+  800f3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f40:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f43:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f45:	5b                   	pop    %ebx
+  800f46:	5e                   	pop    %esi
+  800f47:	5f                   	pop    %edi
+  800f48:	5d                   	pop    %ebp
+  800f49:	c3                   	ret
+
+00800f4a <sys_ipc_try_send_yield>:
+
+int
+sys_ipc_try_send_yield(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f4a:	55                   	push   %ebp
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	57                   	push   %edi
+  800f4e:	56                   	push   %esi
+  800f4f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f56:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f5b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f63:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f66:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send_yield, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f68:	5b                   	pop    %ebx
+  800f69:	5e                   	pop    %esi
+  800f6a:	5f                   	pop    %edi
+  800f6b:	5d                   	pop    %ebp
+  800f6c:	c3                   	ret
+
+00800f6d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f6d:	55                   	push   %ebp
+  800f6e:	89 e5                	mov    %esp,%ebp
+  800f70:	57                   	push   %edi
+  800f71:	56                   	push   %esi
+  800f72:	53                   	push   %ebx
+  800f73:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7e:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f83:	89 cb                	mov    %ecx,%ebx
+  800f85:	89 cf                	mov    %ecx,%edi
+  800f87:	89 ce                	mov    %ecx,%esi
+  800f89:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f8b:	85 c0                	test   %eax,%eax
+  800f8d:	7f 08                	jg     800f97 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f92:	5b                   	pop    %ebx
+  800f93:	5e                   	pop    %esi
+  800f94:	5f                   	pop    %edi
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f97:	83 ec 0c             	sub    $0xc,%esp
+  800f9a:	50                   	push   %eax
+  800f9b:	6a 19                	push   $0x19
+  800f9d:	68 5f 2a 80 00       	push   $0x802a5f
+  800fa2:	6a 23                	push   $0x23
+  800fa4:	68 7c 2a 80 00       	push   $0x802a7c
+  800fa9:	e8 72 11 00 00       	call   802120 <_panic>
+
+00800fae <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	57                   	push   %edi
+  800fb2:	56                   	push   %esi
+  800fb3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fbe:	89 d1                	mov    %edx,%ecx
+  800fc0:	89 d3                	mov    %edx,%ebx
+  800fc2:	89 d7                	mov    %edx,%edi
+  800fc4:	89 d6                	mov    %edx,%esi
+  800fc6:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fc8:	5b                   	pop    %ebx
+  800fc9:	5e                   	pop    %esi
+  800fca:	5f                   	pop    %edi
+  800fcb:	5d                   	pop    %ebp
+  800fcc:	c3                   	ret
+
+00800fcd <sys_net_try_send>:
+
+int
+sys_net_try_send(void *data, size_t size)
+{
+  800fcd:	55                   	push   %ebp
+  800fce:	89 e5                	mov    %esp,%ebp
+  800fd0:	57                   	push   %edi
+  800fd1:	56                   	push   %esi
+  800fd2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fde:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fe3:	89 df                	mov    %ebx,%edi
+  800fe5:	89 de                	mov    %ebx,%esi
+  800fe7:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_send, 0, (uintptr_t) data, size, 0, 0, 0);
+}
+  800fe9:	5b                   	pop    %ebx
+  800fea:	5e                   	pop    %esi
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+
+00800fee <sys_net_try_receive>:
+
+int
+sys_net_try_receive(void *data, size_t *size)
+{
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	57                   	push   %edi
+  800ff2:	56                   	push   %esi
+  800ff3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fff:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801004:	89 df                	mov    %ebx,%edi
+  801006:	89 de                	mov    %ebx,%esi
+  801008:	cd 30                	int    $0x30
+	return syscall(SYS_net_try_receive, 0, (uintptr_t) data, (uintptr_t) size, 0, 0, 0);
+}
+  80100a:	5b                   	pop    %ebx
+  80100b:	5e                   	pop    %esi
+  80100c:	5f                   	pop    %edi
+  80100d:	5d                   	pop    %ebp
+  80100e:	c3                   	ret
+
+0080100f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801012:	8b 45 08             	mov    0x8(%ebp),%eax
+  801015:	05 00 00 00 30       	add    $0x30000000,%eax
+  80101a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+
+0080101f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80101f:	55                   	push   %ebp
+  801020:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801022:	8b 45 08             	mov    0x8(%ebp),%eax
+  801025:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80102a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80102f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801034:	5d                   	pop    %ebp
+  801035:	c3                   	ret
+
+00801036 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801036:	55                   	push   %ebp
+  801037:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801039:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80103e:	eb 02                	jmp    801042 <fd_alloc+0xc>
+  801040:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801042:	89 c2                	mov    %eax,%edx
+  801044:	c1 ea 16             	shr    $0x16,%edx
+  801047:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80104e:	f6 c2 01             	test   $0x1,%dl
+  801051:	74 2b                	je     80107e <fd_alloc+0x48>
+  801053:	89 c2                	mov    %eax,%edx
+  801055:	c1 ea 0c             	shr    $0xc,%edx
+  801058:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80105f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801065:	f6 c1 01             	test   $0x1,%cl
+  801068:	74 14                	je     80107e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80106a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801070:	75 ce                	jne    801040 <fd_alloc+0xa>
+  801072:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801077:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80107c:	eb 05                	jmp    801083 <fd_alloc+0x4d>
+			return 0;
+  80107e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801083:	8b 55 08             	mov    0x8(%ebp),%edx
+  801086:	89 02                	mov    %eax,(%edx)
+}
+  801088:	89 c8                	mov    %ecx,%eax
+  80108a:	5d                   	pop    %ebp
+  80108b:	c3                   	ret
+
+0080108c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80108c:	55                   	push   %ebp
+  80108d:	89 e5                	mov    %esp,%ebp
+  80108f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801092:	83 f8 1f             	cmp    $0x1f,%eax
+  801095:	77 30                	ja     8010c7 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801097:	c1 e0 0c             	shl    $0xc,%eax
+  80109a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80109f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010a5:	f6 c2 01             	test   $0x1,%dl
+  8010a8:	74 24                	je     8010ce <fd_lookup+0x42>
+  8010aa:	89 c2                	mov    %eax,%edx
+  8010ac:	c1 ea 0c             	shr    $0xc,%edx
+  8010af:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8010b6:	f6 c2 01             	test   $0x1,%dl
+  8010b9:	74 1a                	je     8010d5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8010bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010be:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8010c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+		return -E_INVAL;
+  8010c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010cc:	eb f7                	jmp    8010c5 <fd_lookup+0x39>
+		return -E_INVAL;
+  8010ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010d3:	eb f0                	jmp    8010c5 <fd_lookup+0x39>
+  8010d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010da:	eb e9                	jmp    8010c5 <fd_lookup+0x39>
+
+008010dc <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8010dc:	55                   	push   %ebp
+  8010dd:	89 e5                	mov    %esp,%ebp
+  8010df:	53                   	push   %ebx
+  8010e0:	83 ec 04             	sub    $0x4,%esp
+  8010e3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8010e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010eb:	eb 03                	jmp    8010f0 <dev_lookup+0x14>
+  8010ed:	83 c0 01             	add    $0x1,%eax
+  8010f0:	8b 1c 85 08 2b 80 00 	mov    0x802b08(,%eax,4),%ebx
+  8010f7:	85 db                	test   %ebx,%ebx
+  8010f9:	74 0b                	je     801106 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8010fb:	39 13                	cmp    %edx,(%ebx)
+  8010fd:	75 ee                	jne    8010ed <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8010ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801104:	eb 1f                	jmp    801125 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801106:	a1 08 40 80 00       	mov    0x804008,%eax
+  80110b:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80110e:	83 ec 04             	sub    $0x4,%esp
+  801111:	52                   	push   %edx
+  801112:	50                   	push   %eax
+  801113:	68 8c 2a 80 00       	push   $0x802a8c
+  801118:	e8 72 f0 ff ff       	call   80018f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80111d:	83 c4 10             	add    $0x10,%esp
+  801120:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801125:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801128:	89 1a                	mov    %ebx,(%edx)
+}
+  80112a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80112d:	c9                   	leave
+  80112e:	c3                   	ret
+
+0080112f <fd_close>:
+{
+  80112f:	55                   	push   %ebp
+  801130:	89 e5                	mov    %esp,%ebp
+  801132:	57                   	push   %edi
+  801133:	56                   	push   %esi
+  801134:	53                   	push   %ebx
+  801135:	83 ec 24             	sub    $0x24,%esp
+  801138:	8b 75 08             	mov    0x8(%ebp),%esi
+  80113b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80113e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801141:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801142:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801148:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80114b:	50                   	push   %eax
+  80114c:	e8 3b ff ff ff       	call   80108c <fd_lookup>
+  801151:	89 c3                	mov    %eax,%ebx
+  801153:	83 c4 10             	add    $0x10,%esp
+  801156:	85 c0                	test   %eax,%eax
+  801158:	78 05                	js     80115f <fd_close+0x30>
+	    || fd != fd2)
+  80115a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80115d:	74 16                	je     801175 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80115f:	89 f8                	mov    %edi,%eax
+  801161:	84 c0                	test   %al,%al
+  801163:	b8 00 00 00 00       	mov    $0x0,%eax
+  801168:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80116b:	89 d8                	mov    %ebx,%eax
+  80116d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801170:	5b                   	pop    %ebx
+  801171:	5e                   	pop    %esi
+  801172:	5f                   	pop    %edi
+  801173:	5d                   	pop    %ebp
+  801174:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801175:	83 ec 08             	sub    $0x8,%esp
+  801178:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80117b:	50                   	push   %eax
+  80117c:	ff 36                	push   (%esi)
+  80117e:	e8 59 ff ff ff       	call   8010dc <dev_lookup>
+  801183:	89 c3                	mov    %eax,%ebx
+  801185:	83 c4 10             	add    $0x10,%esp
+  801188:	85 c0                	test   %eax,%eax
+  80118a:	78 1a                	js     8011a6 <fd_close+0x77>
+		if (dev->dev_close)
+  80118c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80118f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801192:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801197:	85 c0                	test   %eax,%eax
+  801199:	74 0b                	je     8011a6 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80119b:	83 ec 0c             	sub    $0xc,%esp
+  80119e:	56                   	push   %esi
+  80119f:	ff d0                	call   *%eax
+  8011a1:	89 c3                	mov    %eax,%ebx
+  8011a3:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8011a6:	83 ec 08             	sub    $0x8,%esp
+  8011a9:	56                   	push   %esi
+  8011aa:	6a 00                	push   $0x0
+  8011ac:	e8 01 fb ff ff       	call   800cb2 <sys_page_unmap>
+	return r;
+  8011b1:	83 c4 10             	add    $0x10,%esp
+  8011b4:	eb b5                	jmp    80116b <fd_close+0x3c>
+
+008011b6 <close>:
+
+int
+close(int fdnum)
+{
+  8011b6:	55                   	push   %ebp
+  8011b7:	89 e5                	mov    %esp,%ebp
+  8011b9:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8011bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011bf:	50                   	push   %eax
+  8011c0:	ff 75 08             	push   0x8(%ebp)
+  8011c3:	e8 c4 fe ff ff       	call   80108c <fd_lookup>
+  8011c8:	83 c4 10             	add    $0x10,%esp
+  8011cb:	85 c0                	test   %eax,%eax
+  8011cd:	79 02                	jns    8011d1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8011cf:	c9                   	leave
+  8011d0:	c3                   	ret
+		return fd_close(fd, 1);
+  8011d1:	83 ec 08             	sub    $0x8,%esp
+  8011d4:	6a 01                	push   $0x1
+  8011d6:	ff 75 f4             	push   -0xc(%ebp)
+  8011d9:	e8 51 ff ff ff       	call   80112f <fd_close>
+  8011de:	83 c4 10             	add    $0x10,%esp
+  8011e1:	eb ec                	jmp    8011cf <close+0x19>
+
+008011e3 <close_all>:
+
+void
+close_all(void)
+{
+  8011e3:	55                   	push   %ebp
+  8011e4:	89 e5                	mov    %esp,%ebp
+  8011e6:	53                   	push   %ebx
+  8011e7:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8011ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+  8011f2:	53                   	push   %ebx
+  8011f3:	e8 be ff ff ff       	call   8011b6 <close>
+	for (i = 0; i < MAXFD; i++)
+  8011f8:	83 c3 01             	add    $0x1,%ebx
+  8011fb:	83 c4 10             	add    $0x10,%esp
+  8011fe:	83 fb 20             	cmp    $0x20,%ebx
+  801201:	75 ec                	jne    8011ef <close_all+0xc>
+}
+  801203:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801206:	c9                   	leave
+  801207:	c3                   	ret
+
+00801208 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801208:	55                   	push   %ebp
+  801209:	89 e5                	mov    %esp,%ebp
+  80120b:	57                   	push   %edi
+  80120c:	56                   	push   %esi
+  80120d:	53                   	push   %ebx
+  80120e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801211:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801214:	50                   	push   %eax
+  801215:	ff 75 08             	push   0x8(%ebp)
+  801218:	e8 6f fe ff ff       	call   80108c <fd_lookup>
+  80121d:	89 c3                	mov    %eax,%ebx
+  80121f:	83 c4 10             	add    $0x10,%esp
+  801222:	85 c0                	test   %eax,%eax
+  801224:	78 7f                	js     8012a5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801226:	83 ec 0c             	sub    $0xc,%esp
+  801229:	ff 75 0c             	push   0xc(%ebp)
+  80122c:	e8 85 ff ff ff       	call   8011b6 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801231:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801234:	c1 e6 0c             	shl    $0xc,%esi
+  801237:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80123d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801240:	89 3c 24             	mov    %edi,(%esp)
+  801243:	e8 d7 fd ff ff       	call   80101f <fd2data>
+  801248:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80124a:	89 34 24             	mov    %esi,(%esp)
+  80124d:	e8 cd fd ff ff       	call   80101f <fd2data>
+  801252:	83 c4 10             	add    $0x10,%esp
+  801255:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801258:	89 d8                	mov    %ebx,%eax
+  80125a:	c1 e8 16             	shr    $0x16,%eax
+  80125d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801264:	a8 01                	test   $0x1,%al
+  801266:	74 11                	je     801279 <dup+0x71>
+  801268:	89 d8                	mov    %ebx,%eax
+  80126a:	c1 e8 0c             	shr    $0xc,%eax
+  80126d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801274:	f6 c2 01             	test   $0x1,%dl
+  801277:	75 36                	jne    8012af <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801279:	89 f8                	mov    %edi,%eax
+  80127b:	c1 e8 0c             	shr    $0xc,%eax
+  80127e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801285:	83 ec 0c             	sub    $0xc,%esp
+  801288:	25 07 0e 00 00       	and    $0xe07,%eax
+  80128d:	50                   	push   %eax
+  80128e:	56                   	push   %esi
+  80128f:	6a 00                	push   $0x0
+  801291:	57                   	push   %edi
+  801292:	6a 00                	push   $0x0
+  801294:	e8 d7 f9 ff ff       	call   800c70 <sys_page_map>
+  801299:	89 c3                	mov    %eax,%ebx
+  80129b:	83 c4 20             	add    $0x20,%esp
+  80129e:	85 c0                	test   %eax,%eax
+  8012a0:	78 33                	js     8012d5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8012a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8012a5:	89 d8                	mov    %ebx,%eax
+  8012a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012aa:	5b                   	pop    %ebx
+  8012ab:	5e                   	pop    %esi
+  8012ac:	5f                   	pop    %edi
+  8012ad:	5d                   	pop    %ebp
+  8012ae:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8012af:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012b6:	83 ec 0c             	sub    $0xc,%esp
+  8012b9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012be:	50                   	push   %eax
+  8012bf:	ff 75 d4             	push   -0x2c(%ebp)
+  8012c2:	6a 00                	push   $0x0
+  8012c4:	53                   	push   %ebx
+  8012c5:	6a 00                	push   $0x0
+  8012c7:	e8 a4 f9 ff ff       	call   800c70 <sys_page_map>
+  8012cc:	89 c3                	mov    %eax,%ebx
+  8012ce:	83 c4 20             	add    $0x20,%esp
+  8012d1:	85 c0                	test   %eax,%eax
+  8012d3:	79 a4                	jns    801279 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8012d5:	83 ec 08             	sub    $0x8,%esp
+  8012d8:	56                   	push   %esi
+  8012d9:	6a 00                	push   $0x0
+  8012db:	e8 d2 f9 ff ff       	call   800cb2 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8012e0:	83 c4 08             	add    $0x8,%esp
+  8012e3:	ff 75 d4             	push   -0x2c(%ebp)
+  8012e6:	6a 00                	push   $0x0
+  8012e8:	e8 c5 f9 ff ff       	call   800cb2 <sys_page_unmap>
+	return r;
+  8012ed:	83 c4 10             	add    $0x10,%esp
+  8012f0:	eb b3                	jmp    8012a5 <dup+0x9d>
+
+008012f2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8012f2:	55                   	push   %ebp
+  8012f3:	89 e5                	mov    %esp,%ebp
+  8012f5:	56                   	push   %esi
+  8012f6:	53                   	push   %ebx
+  8012f7:	83 ec 18             	sub    $0x18,%esp
+  8012fa:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012fd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801300:	50                   	push   %eax
+  801301:	56                   	push   %esi
+  801302:	e8 85 fd ff ff       	call   80108c <fd_lookup>
+  801307:	83 c4 10             	add    $0x10,%esp
+  80130a:	85 c0                	test   %eax,%eax
+  80130c:	78 3c                	js     80134a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80130e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801311:	83 ec 08             	sub    $0x8,%esp
+  801314:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801317:	50                   	push   %eax
+  801318:	ff 33                	push   (%ebx)
+  80131a:	e8 bd fd ff ff       	call   8010dc <dev_lookup>
+  80131f:	83 c4 10             	add    $0x10,%esp
+  801322:	85 c0                	test   %eax,%eax
+  801324:	78 24                	js     80134a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801326:	8b 43 08             	mov    0x8(%ebx),%eax
+  801329:	83 e0 03             	and    $0x3,%eax
+  80132c:	83 f8 01             	cmp    $0x1,%eax
+  80132f:	74 20                	je     801351 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801331:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801334:	8b 40 08             	mov    0x8(%eax),%eax
+  801337:	85 c0                	test   %eax,%eax
+  801339:	74 37                	je     801372 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80133b:	83 ec 04             	sub    $0x4,%esp
+  80133e:	ff 75 10             	push   0x10(%ebp)
+  801341:	ff 75 0c             	push   0xc(%ebp)
+  801344:	53                   	push   %ebx
+  801345:	ff d0                	call   *%eax
+  801347:	83 c4 10             	add    $0x10,%esp
+}
+  80134a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80134d:	5b                   	pop    %ebx
+  80134e:	5e                   	pop    %esi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801351:	a1 08 40 80 00       	mov    0x804008,%eax
+  801356:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801359:	83 ec 04             	sub    $0x4,%esp
+  80135c:	56                   	push   %esi
+  80135d:	50                   	push   %eax
+  80135e:	68 cd 2a 80 00       	push   $0x802acd
+  801363:	e8 27 ee ff ff       	call   80018f <cprintf>
+		return -E_INVAL;
+  801368:	83 c4 10             	add    $0x10,%esp
+  80136b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801370:	eb d8                	jmp    80134a <read+0x58>
+		return -E_NOT_SUPP;
+  801372:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801377:	eb d1                	jmp    80134a <read+0x58>
+
+00801379 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801379:	55                   	push   %ebp
+  80137a:	89 e5                	mov    %esp,%ebp
+  80137c:	57                   	push   %edi
+  80137d:	56                   	push   %esi
+  80137e:	53                   	push   %ebx
+  80137f:	83 ec 0c             	sub    $0xc,%esp
+  801382:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801385:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801388:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138d:	eb 02                	jmp    801391 <readn+0x18>
+  80138f:	01 c3                	add    %eax,%ebx
+  801391:	39 f3                	cmp    %esi,%ebx
+  801393:	73 21                	jae    8013b6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801395:	83 ec 04             	sub    $0x4,%esp
+  801398:	89 f0                	mov    %esi,%eax
+  80139a:	29 d8                	sub    %ebx,%eax
+  80139c:	50                   	push   %eax
+  80139d:	89 d8                	mov    %ebx,%eax
+  80139f:	03 45 0c             	add    0xc(%ebp),%eax
+  8013a2:	50                   	push   %eax
+  8013a3:	57                   	push   %edi
+  8013a4:	e8 49 ff ff ff       	call   8012f2 <read>
+		if (m < 0)
+  8013a9:	83 c4 10             	add    $0x10,%esp
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	78 04                	js     8013b4 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8013b0:	75 dd                	jne    80138f <readn+0x16>
+  8013b2:	eb 02                	jmp    8013b6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8013b4:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8013b6:	89 d8                	mov    %ebx,%eax
+  8013b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bb:	5b                   	pop    %ebx
+  8013bc:	5e                   	pop    %esi
+  8013bd:	5f                   	pop    %edi
+  8013be:	5d                   	pop    %ebp
+  8013bf:	c3                   	ret
+
+008013c0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8013c0:	55                   	push   %ebp
+  8013c1:	89 e5                	mov    %esp,%ebp
+  8013c3:	56                   	push   %esi
+  8013c4:	53                   	push   %ebx
+  8013c5:	83 ec 18             	sub    $0x18,%esp
+  8013c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013cb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013ce:	50                   	push   %eax
+  8013cf:	53                   	push   %ebx
+  8013d0:	e8 b7 fc ff ff       	call   80108c <fd_lookup>
+  8013d5:	83 c4 10             	add    $0x10,%esp
+  8013d8:	85 c0                	test   %eax,%eax
+  8013da:	78 37                	js     801413 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013df:	83 ec 08             	sub    $0x8,%esp
+  8013e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013e5:	50                   	push   %eax
+  8013e6:	ff 36                	push   (%esi)
+  8013e8:	e8 ef fc ff ff       	call   8010dc <dev_lookup>
+  8013ed:	83 c4 10             	add    $0x10,%esp
+  8013f0:	85 c0                	test   %eax,%eax
+  8013f2:	78 1f                	js     801413 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013f4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013f8:	74 20                	je     80141a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8013fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013fd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801400:	85 c0                	test   %eax,%eax
+  801402:	74 37                	je     80143b <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801404:	83 ec 04             	sub    $0x4,%esp
+  801407:	ff 75 10             	push   0x10(%ebp)
+  80140a:	ff 75 0c             	push   0xc(%ebp)
+  80140d:	56                   	push   %esi
+  80140e:	ff d0                	call   *%eax
+  801410:	83 c4 10             	add    $0x10,%esp
+}
+  801413:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801416:	5b                   	pop    %ebx
+  801417:	5e                   	pop    %esi
+  801418:	5d                   	pop    %ebp
+  801419:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80141a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80141f:	8b 40 4c             	mov    0x4c(%eax),%eax
+  801422:	83 ec 04             	sub    $0x4,%esp
+  801425:	53                   	push   %ebx
+  801426:	50                   	push   %eax
+  801427:	68 e9 2a 80 00       	push   $0x802ae9
+  80142c:	e8 5e ed ff ff       	call   80018f <cprintf>
+		return -E_INVAL;
+  801431:	83 c4 10             	add    $0x10,%esp
+  801434:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801439:	eb d8                	jmp    801413 <write+0x53>
+		return -E_NOT_SUPP;
+  80143b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801440:	eb d1                	jmp    801413 <write+0x53>
+
+00801442 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801442:	55                   	push   %ebp
+  801443:	89 e5                	mov    %esp,%ebp
+  801445:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801448:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80144b:	50                   	push   %eax
+  80144c:	ff 75 08             	push   0x8(%ebp)
+  80144f:	e8 38 fc ff ff       	call   80108c <fd_lookup>
+  801454:	83 c4 10             	add    $0x10,%esp
+  801457:	85 c0                	test   %eax,%eax
+  801459:	78 0e                	js     801469 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80145b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80145e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801461:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801464:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801469:	c9                   	leave
+  80146a:	c3                   	ret
+
+0080146b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	56                   	push   %esi
+  80146f:	53                   	push   %ebx
+  801470:	83 ec 18             	sub    $0x18,%esp
+  801473:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801476:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801479:	50                   	push   %eax
+  80147a:	53                   	push   %ebx
+  80147b:	e8 0c fc ff ff       	call   80108c <fd_lookup>
+  801480:	83 c4 10             	add    $0x10,%esp
+  801483:	85 c0                	test   %eax,%eax
+  801485:	78 34                	js     8014bb <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801487:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80148a:	83 ec 08             	sub    $0x8,%esp
+  80148d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801490:	50                   	push   %eax
+  801491:	ff 36                	push   (%esi)
+  801493:	e8 44 fc ff ff       	call   8010dc <dev_lookup>
+  801498:	83 c4 10             	add    $0x10,%esp
+  80149b:	85 c0                	test   %eax,%eax
+  80149d:	78 1c                	js     8014bb <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80149f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014a3:	74 1d                	je     8014c2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8014a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014a8:	8b 40 18             	mov    0x18(%eax),%eax
+  8014ab:	85 c0                	test   %eax,%eax
+  8014ad:	74 34                	je     8014e3 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8014af:	83 ec 08             	sub    $0x8,%esp
+  8014b2:	ff 75 0c             	push   0xc(%ebp)
+  8014b5:	56                   	push   %esi
+  8014b6:	ff d0                	call   *%eax
+  8014b8:	83 c4 10             	add    $0x10,%esp
+}
+  8014bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014be:	5b                   	pop    %ebx
+  8014bf:	5e                   	pop    %esi
+  8014c0:	5d                   	pop    %ebp
+  8014c1:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8014c2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8014c7:	8b 40 4c             	mov    0x4c(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8014ca:	83 ec 04             	sub    $0x4,%esp
+  8014cd:	53                   	push   %ebx
+  8014ce:	50                   	push   %eax
+  8014cf:	68 ac 2a 80 00       	push   $0x802aac
+  8014d4:	e8 b6 ec ff ff       	call   80018f <cprintf>
+		return -E_INVAL;
+  8014d9:	83 c4 10             	add    $0x10,%esp
+  8014dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e1:	eb d8                	jmp    8014bb <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8014e3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014e8:	eb d1                	jmp    8014bb <ftruncate+0x50>
+
+008014ea <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8014ea:	55                   	push   %ebp
+  8014eb:	89 e5                	mov    %esp,%ebp
+  8014ed:	56                   	push   %esi
+  8014ee:	53                   	push   %ebx
+  8014ef:	83 ec 18             	sub    $0x18,%esp
+  8014f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014f5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014f8:	50                   	push   %eax
+  8014f9:	ff 75 08             	push   0x8(%ebp)
+  8014fc:	e8 8b fb ff ff       	call   80108c <fd_lookup>
+  801501:	83 c4 10             	add    $0x10,%esp
+  801504:	85 c0                	test   %eax,%eax
+  801506:	78 49                	js     801551 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801508:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80150b:	83 ec 08             	sub    $0x8,%esp
+  80150e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801511:	50                   	push   %eax
+  801512:	ff 36                	push   (%esi)
+  801514:	e8 c3 fb ff ff       	call   8010dc <dev_lookup>
+  801519:	83 c4 10             	add    $0x10,%esp
+  80151c:	85 c0                	test   %eax,%eax
+  80151e:	78 31                	js     801551 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801520:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801523:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801527:	74 2f                	je     801558 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801529:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80152c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801533:	00 00 00 
+	stat->st_isdir = 0;
+  801536:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80153d:	00 00 00 
+	stat->st_dev = dev;
+  801540:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801546:	83 ec 08             	sub    $0x8,%esp
+  801549:	53                   	push   %ebx
+  80154a:	56                   	push   %esi
+  80154b:	ff 50 14             	call   *0x14(%eax)
+  80154e:	83 c4 10             	add    $0x10,%esp
+}
+  801551:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801554:	5b                   	pop    %ebx
+  801555:	5e                   	pop    %esi
+  801556:	5d                   	pop    %ebp
+  801557:	c3                   	ret
+		return -E_NOT_SUPP;
+  801558:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80155d:	eb f2                	jmp    801551 <fstat+0x67>
+
+0080155f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80155f:	55                   	push   %ebp
+  801560:	89 e5                	mov    %esp,%ebp
+  801562:	56                   	push   %esi
+  801563:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801564:	83 ec 08             	sub    $0x8,%esp
+  801567:	6a 00                	push   $0x0
+  801569:	ff 75 08             	push   0x8(%ebp)
+  80156c:	e8 e4 01 00 00       	call   801755 <open>
+  801571:	89 c3                	mov    %eax,%ebx
+  801573:	83 c4 10             	add    $0x10,%esp
+  801576:	85 c0                	test   %eax,%eax
+  801578:	78 1b                	js     801595 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80157a:	83 ec 08             	sub    $0x8,%esp
+  80157d:	ff 75 0c             	push   0xc(%ebp)
+  801580:	50                   	push   %eax
+  801581:	e8 64 ff ff ff       	call   8014ea <fstat>
+  801586:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801588:	89 1c 24             	mov    %ebx,(%esp)
+  80158b:	e8 26 fc ff ff       	call   8011b6 <close>
+	return r;
+  801590:	83 c4 10             	add    $0x10,%esp
+  801593:	89 f3                	mov    %esi,%ebx
+}
+  801595:	89 d8                	mov    %ebx,%eax
+  801597:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80159a:	5b                   	pop    %ebx
+  80159b:	5e                   	pop    %esi
+  80159c:	5d                   	pop    %ebp
+  80159d:	c3                   	ret
+
+0080159e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80159e:	55                   	push   %ebp
+  80159f:	89 e5                	mov    %esp,%ebp
+  8015a1:	56                   	push   %esi
+  8015a2:	53                   	push   %ebx
+  8015a3:	89 c6                	mov    %eax,%esi
+  8015a5:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8015a7:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8015ae:	74 27                	je     8015d7 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8015b0:	6a 07                	push   $0x7
+  8015b2:	68 00 50 80 00       	push   $0x805000
+  8015b7:	56                   	push   %esi
+  8015b8:	ff 35 00 40 80 00    	push   0x804000
+  8015be:	e8 1b 0c 00 00       	call   8021de <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8015c3:	83 c4 0c             	add    $0xc,%esp
+  8015c6:	6a 00                	push   $0x0
+  8015c8:	53                   	push   %ebx
+  8015c9:	6a 00                	push   $0x0
+  8015cb:	e8 96 0b 00 00       	call   802166 <ipc_recv>
+}
+  8015d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d3:	5b                   	pop    %ebx
+  8015d4:	5e                   	pop    %esi
+  8015d5:	5d                   	pop    %ebp
+  8015d6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8015d7:	83 ec 0c             	sub    $0xc,%esp
+  8015da:	6a 01                	push   $0x1
+  8015dc:	e8 51 0c 00 00       	call   802232 <ipc_find_env>
+  8015e1:	a3 00 40 80 00       	mov    %eax,0x804000
+  8015e6:	83 c4 10             	add    $0x10,%esp
+  8015e9:	eb c5                	jmp    8015b0 <fsipc+0x12>
+
+008015eb <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8015f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015f7:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8015fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015ff:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801604:	ba 00 00 00 00       	mov    $0x0,%edx
+  801609:	b8 02 00 00 00       	mov    $0x2,%eax
+  80160e:	e8 8b ff ff ff       	call   80159e <fsipc>
+}
+  801613:	c9                   	leave
+  801614:	c3                   	ret
+
+00801615 <devfile_flush>:
+{
+  801615:	55                   	push   %ebp
+  801616:	89 e5                	mov    %esp,%ebp
+  801618:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80161b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80161e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801621:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801626:	ba 00 00 00 00       	mov    $0x0,%edx
+  80162b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801630:	e8 69 ff ff ff       	call   80159e <fsipc>
+}
+  801635:	c9                   	leave
+  801636:	c3                   	ret
+
+00801637 <devfile_stat>:
+{
+  801637:	55                   	push   %ebp
+  801638:	89 e5                	mov    %esp,%ebp
+  80163a:	53                   	push   %ebx
+  80163b:	83 ec 04             	sub    $0x4,%esp
+  80163e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801641:	8b 45 08             	mov    0x8(%ebp),%eax
+  801644:	8b 40 0c             	mov    0xc(%eax),%eax
+  801647:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80164c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801651:	b8 05 00 00 00       	mov    $0x5,%eax
+  801656:	e8 43 ff ff ff       	call   80159e <fsipc>
+  80165b:	85 c0                	test   %eax,%eax
+  80165d:	78 2c                	js     80168b <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80165f:	83 ec 08             	sub    $0x8,%esp
+  801662:	68 00 50 80 00       	push   $0x805000
+  801667:	53                   	push   %ebx
+  801668:	e8 10 f1 ff ff       	call   80077d <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80166d:	a1 80 50 80 00       	mov    0x805080,%eax
+  801672:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801678:	a1 84 50 80 00       	mov    0x805084,%eax
+  80167d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801683:	83 c4 10             	add    $0x10,%esp
+  801686:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80168b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80168e:	c9                   	leave
+  80168f:	c3                   	ret
+
+00801690 <devfile_write>:
+{
+  801690:	55                   	push   %ebp
+  801691:	89 e5                	mov    %esp,%ebp
+  801693:	83 ec 0c             	sub    $0xc,%esp
+  801696:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801699:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80169e:	39 d0                	cmp    %edx,%eax
+  8016a0:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8016a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a6:	8b 52 0c             	mov    0xc(%edx),%edx
+  8016a9:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  8016af:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8016b4:	50                   	push   %eax
+  8016b5:	ff 75 0c             	push   0xc(%ebp)
+  8016b8:	68 08 50 80 00       	push   $0x805008
+  8016bd:	e8 41 f2 ff ff       	call   800903 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8016c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8016cc:	e8 cd fe ff ff       	call   80159e <fsipc>
+}
+  8016d1:	c9                   	leave
+  8016d2:	c3                   	ret
+
+008016d3 <devfile_read>:
+{
+  8016d3:	55                   	push   %ebp
+  8016d4:	89 e5                	mov    %esp,%ebp
+  8016d6:	56                   	push   %esi
+  8016d7:	53                   	push   %ebx
+  8016d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8016db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016de:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016e1:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  8016e6:	89 35 04 50 80 00    	mov    %esi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8016ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8016f6:	e8 a3 fe ff ff       	call   80159e <fsipc>
+  8016fb:	89 c3                	mov    %eax,%ebx
+  8016fd:	85 c0                	test   %eax,%eax
+  8016ff:	78 1f                	js     801720 <devfile_read+0x4d>
+	assert(r <= n);
+  801701:	39 c6                	cmp    %eax,%esi
+  801703:	72 24                	jb     801729 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801705:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80170a:	7f 33                	jg     80173f <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80170c:	83 ec 04             	sub    $0x4,%esp
+  80170f:	50                   	push   %eax
+  801710:	68 00 50 80 00       	push   $0x805000
+  801715:	ff 75 0c             	push   0xc(%ebp)
+  801718:	e8 e6 f1 ff ff       	call   800903 <memmove>
+	return r;
+  80171d:	83 c4 10             	add    $0x10,%esp
+}
+  801720:	89 d8                	mov    %ebx,%eax
+  801722:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801725:	5b                   	pop    %ebx
+  801726:	5e                   	pop    %esi
+  801727:	5d                   	pop    %ebp
+  801728:	c3                   	ret
+	assert(r <= n);
+  801729:	68 1c 2b 80 00       	push   $0x802b1c
+  80172e:	68 23 2b 80 00       	push   $0x802b23
+  801733:	6a 7c                	push   $0x7c
+  801735:	68 38 2b 80 00       	push   $0x802b38
+  80173a:	e8 e1 09 00 00       	call   802120 <_panic>
+	assert(r <= PGSIZE);
+  80173f:	68 43 2b 80 00       	push   $0x802b43
+  801744:	68 23 2b 80 00       	push   $0x802b23
+  801749:	6a 7d                	push   $0x7d
+  80174b:	68 38 2b 80 00       	push   $0x802b38
+  801750:	e8 cb 09 00 00       	call   802120 <_panic>
+
+00801755 <open>:
+{
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	56                   	push   %esi
+  801759:	53                   	push   %ebx
+  80175a:	83 ec 1c             	sub    $0x1c,%esp
+  80175d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801760:	56                   	push   %esi
+  801761:	e8 dc ef ff ff       	call   800742 <strlen>
+  801766:	83 c4 10             	add    $0x10,%esp
+  801769:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80176e:	7f 6c                	jg     8017dc <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801770:	83 ec 0c             	sub    $0xc,%esp
+  801773:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801776:	50                   	push   %eax
+  801777:	e8 ba f8 ff ff       	call   801036 <fd_alloc>
+  80177c:	89 c3                	mov    %eax,%ebx
+  80177e:	83 c4 10             	add    $0x10,%esp
+  801781:	85 c0                	test   %eax,%eax
+  801783:	78 3c                	js     8017c1 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801785:	83 ec 08             	sub    $0x8,%esp
+  801788:	56                   	push   %esi
+  801789:	68 00 50 80 00       	push   $0x805000
+  80178e:	e8 ea ef ff ff       	call   80077d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801793:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801796:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80179b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80179e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017a3:	e8 f6 fd ff ff       	call   80159e <fsipc>
+  8017a8:	89 c3                	mov    %eax,%ebx
+  8017aa:	83 c4 10             	add    $0x10,%esp
+  8017ad:	85 c0                	test   %eax,%eax
+  8017af:	78 19                	js     8017ca <open+0x75>
+	return fd2num(fd);
+  8017b1:	83 ec 0c             	sub    $0xc,%esp
+  8017b4:	ff 75 f4             	push   -0xc(%ebp)
+  8017b7:	e8 53 f8 ff ff       	call   80100f <fd2num>
+  8017bc:	89 c3                	mov    %eax,%ebx
+  8017be:	83 c4 10             	add    $0x10,%esp
+}
+  8017c1:	89 d8                	mov    %ebx,%eax
+  8017c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c6:	5b                   	pop    %ebx
+  8017c7:	5e                   	pop    %esi
+  8017c8:	5d                   	pop    %ebp
+  8017c9:	c3                   	ret
+		fd_close(fd, 0);
+  8017ca:	83 ec 08             	sub    $0x8,%esp
+  8017cd:	6a 00                	push   $0x0
+  8017cf:	ff 75 f4             	push   -0xc(%ebp)
+  8017d2:	e8 58 f9 ff ff       	call   80112f <fd_close>
+		return r;
+  8017d7:	83 c4 10             	add    $0x10,%esp
+  8017da:	eb e5                	jmp    8017c1 <open+0x6c>
+		return -E_BAD_PATH;
+  8017dc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8017e1:	eb de                	jmp    8017c1 <open+0x6c>
+
+008017e3 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8017e3:	55                   	push   %ebp
+  8017e4:	89 e5                	mov    %esp,%ebp
+  8017e6:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8017e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ee:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017f3:	e8 a6 fd ff ff       	call   80159e <fsipc>
+}
+  8017f8:	c9                   	leave
+  8017f9:	c3                   	ret
+
+008017fa <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801800:	68 4f 2b 80 00       	push   $0x802b4f
+  801805:	ff 75 0c             	push   0xc(%ebp)
+  801808:	e8 70 ef ff ff       	call   80077d <strcpy>
+	return 0;
+}
+  80180d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801812:	c9                   	leave
+  801813:	c3                   	ret
+
+00801814 <devsock_close>:
+{
+  801814:	55                   	push   %ebp
+  801815:	89 e5                	mov    %esp,%ebp
+  801817:	53                   	push   %ebx
+  801818:	83 ec 10             	sub    $0x10,%esp
+  80181b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80181e:	53                   	push   %ebx
+  80181f:	e8 1e 0a 00 00       	call   802242 <pageref>
+  801824:	89 c2                	mov    %eax,%edx
+  801826:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801829:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80182e:	83 fa 01             	cmp    $0x1,%edx
+  801831:	74 05                	je     801838 <devsock_close+0x24>
+}
+  801833:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801836:	c9                   	leave
+  801837:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801838:	83 ec 0c             	sub    $0xc,%esp
+  80183b:	ff 73 0c             	push   0xc(%ebx)
+  80183e:	e8 b7 02 00 00       	call   801afa <nsipc_close>
+  801843:	83 c4 10             	add    $0x10,%esp
+  801846:	eb eb                	jmp    801833 <devsock_close+0x1f>
+
+00801848 <devsock_write>:
+{
+  801848:	55                   	push   %ebp
+  801849:	89 e5                	mov    %esp,%ebp
+  80184b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80184e:	6a 00                	push   $0x0
+  801850:	ff 75 10             	push   0x10(%ebp)
+  801853:	ff 75 0c             	push   0xc(%ebp)
+  801856:	8b 45 08             	mov    0x8(%ebp),%eax
+  801859:	ff 70 0c             	push   0xc(%eax)
+  80185c:	e8 79 03 00 00       	call   801bda <nsipc_send>
+}
+  801861:	c9                   	leave
+  801862:	c3                   	ret
+
+00801863 <devsock_read>:
+{
+  801863:	55                   	push   %ebp
+  801864:	89 e5                	mov    %esp,%ebp
+  801866:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801869:	6a 00                	push   $0x0
+  80186b:	ff 75 10             	push   0x10(%ebp)
+  80186e:	ff 75 0c             	push   0xc(%ebp)
+  801871:	8b 45 08             	mov    0x8(%ebp),%eax
+  801874:	ff 70 0c             	push   0xc(%eax)
+  801877:	e8 ef 02 00 00       	call   801b6b <nsipc_recv>
+}
+  80187c:	c9                   	leave
+  80187d:	c3                   	ret
+
+0080187e <fd2sockid>:
+{
+  80187e:	55                   	push   %ebp
+  80187f:	89 e5                	mov    %esp,%ebp
+  801881:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801884:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801887:	52                   	push   %edx
+  801888:	50                   	push   %eax
+  801889:	e8 fe f7 ff ff       	call   80108c <fd_lookup>
+  80188e:	83 c4 10             	add    $0x10,%esp
+  801891:	85 c0                	test   %eax,%eax
+  801893:	78 10                	js     8018a5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801895:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801898:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  80189e:	39 08                	cmp    %ecx,(%eax)
+  8018a0:	75 05                	jne    8018a7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8018a2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8018a5:	c9                   	leave
+  8018a6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018ac:	eb f7                	jmp    8018a5 <fd2sockid+0x27>
+
+008018ae <alloc_sockfd>:
+{
+  8018ae:	55                   	push   %ebp
+  8018af:	89 e5                	mov    %esp,%ebp
+  8018b1:	56                   	push   %esi
+  8018b2:	53                   	push   %ebx
+  8018b3:	83 ec 1c             	sub    $0x1c,%esp
+  8018b6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8018b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018bb:	50                   	push   %eax
+  8018bc:	e8 75 f7 ff ff       	call   801036 <fd_alloc>
+  8018c1:	89 c3                	mov    %eax,%ebx
+  8018c3:	83 c4 10             	add    $0x10,%esp
+  8018c6:	85 c0                	test   %eax,%eax
+  8018c8:	78 43                	js     80190d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8018ca:	83 ec 04             	sub    $0x4,%esp
+  8018cd:	68 07 04 00 00       	push   $0x407
+  8018d2:	ff 75 f4             	push   -0xc(%ebp)
+  8018d5:	6a 00                	push   $0x0
+  8018d7:	e8 0e f3 ff ff       	call   800bea <sys_page_alloc>
+  8018dc:	89 c3                	mov    %eax,%ebx
+  8018de:	83 c4 10             	add    $0x10,%esp
+  8018e1:	85 c0                	test   %eax,%eax
+  8018e3:	78 28                	js     80190d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8018e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018e8:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8018ee:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8018f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018f3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8018fa:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8018fd:	83 ec 0c             	sub    $0xc,%esp
+  801900:	50                   	push   %eax
+  801901:	e8 09 f7 ff ff       	call   80100f <fd2num>
+  801906:	89 c3                	mov    %eax,%ebx
+  801908:	83 c4 10             	add    $0x10,%esp
+  80190b:	eb 0c                	jmp    801919 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80190d:	83 ec 0c             	sub    $0xc,%esp
+  801910:	56                   	push   %esi
+  801911:	e8 e4 01 00 00       	call   801afa <nsipc_close>
+		return r;
+  801916:	83 c4 10             	add    $0x10,%esp
+}
+  801919:	89 d8                	mov    %ebx,%eax
+  80191b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80191e:	5b                   	pop    %ebx
+  80191f:	5e                   	pop    %esi
+  801920:	5d                   	pop    %ebp
+  801921:	c3                   	ret
+
+00801922 <accept>:
+{
+  801922:	55                   	push   %ebp
+  801923:	89 e5                	mov    %esp,%ebp
+  801925:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801928:	8b 45 08             	mov    0x8(%ebp),%eax
+  80192b:	e8 4e ff ff ff       	call   80187e <fd2sockid>
+  801930:	85 c0                	test   %eax,%eax
+  801932:	78 1b                	js     80194f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801934:	83 ec 04             	sub    $0x4,%esp
+  801937:	ff 75 10             	push   0x10(%ebp)
+  80193a:	ff 75 0c             	push   0xc(%ebp)
+  80193d:	50                   	push   %eax
+  80193e:	e8 0e 01 00 00       	call   801a51 <nsipc_accept>
+  801943:	83 c4 10             	add    $0x10,%esp
+  801946:	85 c0                	test   %eax,%eax
+  801948:	78 05                	js     80194f <accept+0x2d>
+	return alloc_sockfd(r);
+  80194a:	e8 5f ff ff ff       	call   8018ae <alloc_sockfd>
+}
+  80194f:	c9                   	leave
+  801950:	c3                   	ret
+
+00801951 <bind>:
+{
+  801951:	55                   	push   %ebp
+  801952:	89 e5                	mov    %esp,%ebp
+  801954:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801957:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195a:	e8 1f ff ff ff       	call   80187e <fd2sockid>
+  80195f:	85 c0                	test   %eax,%eax
+  801961:	78 12                	js     801975 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801963:	83 ec 04             	sub    $0x4,%esp
+  801966:	ff 75 10             	push   0x10(%ebp)
+  801969:	ff 75 0c             	push   0xc(%ebp)
+  80196c:	50                   	push   %eax
+  80196d:	e8 31 01 00 00       	call   801aa3 <nsipc_bind>
+  801972:	83 c4 10             	add    $0x10,%esp
+}
+  801975:	c9                   	leave
+  801976:	c3                   	ret
+
+00801977 <shutdown>:
+{
+  801977:	55                   	push   %ebp
+  801978:	89 e5                	mov    %esp,%ebp
+  80197a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80197d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801980:	e8 f9 fe ff ff       	call   80187e <fd2sockid>
+  801985:	85 c0                	test   %eax,%eax
+  801987:	78 0f                	js     801998 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801989:	83 ec 08             	sub    $0x8,%esp
+  80198c:	ff 75 0c             	push   0xc(%ebp)
+  80198f:	50                   	push   %eax
+  801990:	e8 43 01 00 00       	call   801ad8 <nsipc_shutdown>
+  801995:	83 c4 10             	add    $0x10,%esp
+}
+  801998:	c9                   	leave
+  801999:	c3                   	ret
+
+0080199a <connect>:
+{
+  80199a:	55                   	push   %ebp
+  80199b:	89 e5                	mov    %esp,%ebp
+  80199d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a3:	e8 d6 fe ff ff       	call   80187e <fd2sockid>
+  8019a8:	85 c0                	test   %eax,%eax
+  8019aa:	78 12                	js     8019be <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8019ac:	83 ec 04             	sub    $0x4,%esp
+  8019af:	ff 75 10             	push   0x10(%ebp)
+  8019b2:	ff 75 0c             	push   0xc(%ebp)
+  8019b5:	50                   	push   %eax
+  8019b6:	e8 59 01 00 00       	call   801b14 <nsipc_connect>
+  8019bb:	83 c4 10             	add    $0x10,%esp
+}
+  8019be:	c9                   	leave
+  8019bf:	c3                   	ret
+
+008019c0 <listen>:
+{
+  8019c0:	55                   	push   %ebp
+  8019c1:	89 e5                	mov    %esp,%ebp
+  8019c3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c9:	e8 b0 fe ff ff       	call   80187e <fd2sockid>
+  8019ce:	85 c0                	test   %eax,%eax
+  8019d0:	78 0f                	js     8019e1 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8019d2:	83 ec 08             	sub    $0x8,%esp
+  8019d5:	ff 75 0c             	push   0xc(%ebp)
+  8019d8:	50                   	push   %eax
+  8019d9:	e8 6b 01 00 00       	call   801b49 <nsipc_listen>
+  8019de:	83 c4 10             	add    $0x10,%esp
+}
+  8019e1:	c9                   	leave
+  8019e2:	c3                   	ret
+
+008019e3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8019e3:	55                   	push   %ebp
+  8019e4:	89 e5                	mov    %esp,%ebp
+  8019e6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8019e9:	ff 75 10             	push   0x10(%ebp)
+  8019ec:	ff 75 0c             	push   0xc(%ebp)
+  8019ef:	ff 75 08             	push   0x8(%ebp)
+  8019f2:	e8 41 02 00 00       	call   801c38 <nsipc_socket>
+  8019f7:	83 c4 10             	add    $0x10,%esp
+  8019fa:	85 c0                	test   %eax,%eax
+  8019fc:	78 05                	js     801a03 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8019fe:	e8 ab fe ff ff       	call   8018ae <alloc_sockfd>
+}
+  801a03:	c9                   	leave
+  801a04:	c3                   	ret
+
+00801a05 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801a05:	55                   	push   %ebp
+  801a06:	89 e5                	mov    %esp,%ebp
+  801a08:	53                   	push   %ebx
+  801a09:	83 ec 04             	sub    $0x4,%esp
+  801a0c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801a0e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a15:	74 26                	je     801a3d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801a17:	6a 07                	push   $0x7
+  801a19:	68 00 60 80 00       	push   $0x806000
+  801a1e:	53                   	push   %ebx
+  801a1f:	ff 35 04 40 80 00    	push   0x804004
+  801a25:	e8 b4 07 00 00       	call   8021de <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801a2a:	83 c4 0c             	add    $0xc,%esp
+  801a2d:	6a 00                	push   $0x0
+  801a2f:	6a 00                	push   $0x0
+  801a31:	6a 00                	push   $0x0
+  801a33:	e8 2e 07 00 00       	call   802166 <ipc_recv>
+}
+  801a38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3b:	c9                   	leave
+  801a3c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a3d:	83 ec 0c             	sub    $0xc,%esp
+  801a40:	6a 02                	push   $0x2
+  801a42:	e8 eb 07 00 00       	call   802232 <ipc_find_env>
+  801a47:	a3 04 40 80 00       	mov    %eax,0x804004
+  801a4c:	83 c4 10             	add    $0x10,%esp
+  801a4f:	eb c6                	jmp    801a17 <nsipc+0x12>
+
+00801a51 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801a51:	55                   	push   %ebp
+  801a52:	89 e5                	mov    %esp,%ebp
+  801a54:	56                   	push   %esi
+  801a55:	53                   	push   %ebx
+  801a56:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a5c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801a61:	8b 06                	mov    (%esi),%eax
+  801a63:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801a68:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a6d:	e8 93 ff ff ff       	call   801a05 <nsipc>
+  801a72:	89 c3                	mov    %eax,%ebx
+  801a74:	85 c0                	test   %eax,%eax
+  801a76:	79 09                	jns    801a81 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801a78:	89 d8                	mov    %ebx,%eax
+  801a7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a7d:	5b                   	pop    %ebx
+  801a7e:	5e                   	pop    %esi
+  801a7f:	5d                   	pop    %ebp
+  801a80:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801a81:	83 ec 04             	sub    $0x4,%esp
+  801a84:	ff 35 10 60 80 00    	push   0x806010
+  801a8a:	68 00 60 80 00       	push   $0x806000
+  801a8f:	ff 75 0c             	push   0xc(%ebp)
+  801a92:	e8 6c ee ff ff       	call   800903 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801a97:	a1 10 60 80 00       	mov    0x806010,%eax
+  801a9c:	89 06                	mov    %eax,(%esi)
+  801a9e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801aa1:	eb d5                	jmp    801a78 <nsipc_accept+0x27>
+
+00801aa3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801aa3:	55                   	push   %ebp
+  801aa4:	89 e5                	mov    %esp,%ebp
+  801aa6:	53                   	push   %ebx
+  801aa7:	83 ec 08             	sub    $0x8,%esp
+  801aaa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801aad:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab0:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ab5:	53                   	push   %ebx
+  801ab6:	ff 75 0c             	push   0xc(%ebp)
+  801ab9:	68 04 60 80 00       	push   $0x806004
+  801abe:	e8 40 ee ff ff       	call   800903 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801ac3:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801ac9:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ace:	e8 32 ff ff ff       	call   801a05 <nsipc>
+}
+  801ad3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ad6:	c9                   	leave
+  801ad7:	c3                   	ret
+
+00801ad8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801ad8:	55                   	push   %ebp
+  801ad9:	89 e5                	mov    %esp,%ebp
+  801adb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801ade:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae1:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801ae6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ae9:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801aee:	b8 03 00 00 00       	mov    $0x3,%eax
+  801af3:	e8 0d ff ff ff       	call   801a05 <nsipc>
+}
+  801af8:	c9                   	leave
+  801af9:	c3                   	ret
+
+00801afa <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801afa:	55                   	push   %ebp
+  801afb:	89 e5                	mov    %esp,%ebp
+  801afd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801b00:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b03:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801b08:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b0d:	e8 f3 fe ff ff       	call   801a05 <nsipc>
+}
+  801b12:	c9                   	leave
+  801b13:	c3                   	ret
+
+00801b14 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801b14:	55                   	push   %ebp
+  801b15:	89 e5                	mov    %esp,%ebp
+  801b17:	53                   	push   %ebx
+  801b18:	83 ec 08             	sub    $0x8,%esp
+  801b1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801b1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b21:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801b26:	53                   	push   %ebx
+  801b27:	ff 75 0c             	push   0xc(%ebp)
+  801b2a:	68 04 60 80 00       	push   $0x806004
+  801b2f:	e8 cf ed ff ff       	call   800903 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801b34:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801b3a:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b3f:	e8 c1 fe ff ff       	call   801a05 <nsipc>
+}
+  801b44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b47:	c9                   	leave
+  801b48:	c3                   	ret
+
+00801b49 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801b49:	55                   	push   %ebp
+  801b4a:	89 e5                	mov    %esp,%ebp
+  801b4c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801b4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b52:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801b57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b5a:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801b5f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b64:	e8 9c fe ff ff       	call   801a05 <nsipc>
+}
+  801b69:	c9                   	leave
+  801b6a:	c3                   	ret
+
+00801b6b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801b6b:	55                   	push   %ebp
+  801b6c:	89 e5                	mov    %esp,%ebp
+  801b6e:	56                   	push   %esi
+  801b6f:	53                   	push   %ebx
+  801b70:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801b73:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b76:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801b7b:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801b81:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b84:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801b89:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b8e:	e8 72 fe ff ff       	call   801a05 <nsipc>
+  801b93:	89 c3                	mov    %eax,%ebx
+  801b95:	85 c0                	test   %eax,%eax
+  801b97:	78 22                	js     801bbb <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801b99:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801b9e:	39 c6                	cmp    %eax,%esi
+  801ba0:	0f 4e c6             	cmovle %esi,%eax
+  801ba3:	39 c3                	cmp    %eax,%ebx
+  801ba5:	7f 1d                	jg     801bc4 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801ba7:	83 ec 04             	sub    $0x4,%esp
+  801baa:	53                   	push   %ebx
+  801bab:	68 00 60 80 00       	push   $0x806000
+  801bb0:	ff 75 0c             	push   0xc(%ebp)
+  801bb3:	e8 4b ed ff ff       	call   800903 <memmove>
+  801bb8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801bbb:	89 d8                	mov    %ebx,%eax
+  801bbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bc0:	5b                   	pop    %ebx
+  801bc1:	5e                   	pop    %esi
+  801bc2:	5d                   	pop    %ebp
+  801bc3:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801bc4:	68 5b 2b 80 00       	push   $0x802b5b
+  801bc9:	68 23 2b 80 00       	push   $0x802b23
+  801bce:	6a 62                	push   $0x62
+  801bd0:	68 70 2b 80 00       	push   $0x802b70
+  801bd5:	e8 46 05 00 00       	call   802120 <_panic>
+
+00801bda <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801bda:	55                   	push   %ebp
+  801bdb:	89 e5                	mov    %esp,%ebp
+  801bdd:	53                   	push   %ebx
+  801bde:	83 ec 04             	sub    $0x4,%esp
+  801be1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801be4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be7:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801bec:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801bf2:	7f 2e                	jg     801c22 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801bf4:	83 ec 04             	sub    $0x4,%esp
+  801bf7:	53                   	push   %ebx
+  801bf8:	ff 75 0c             	push   0xc(%ebp)
+  801bfb:	68 0c 60 80 00       	push   $0x80600c
+  801c00:	e8 fe ec ff ff       	call   800903 <memmove>
+	nsipcbuf.send.req_size = size;
+  801c05:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801c0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c0e:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801c13:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c18:	e8 e8 fd ff ff       	call   801a05 <nsipc>
+}
+  801c1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c20:	c9                   	leave
+  801c21:	c3                   	ret
+	assert(size < 1600);
+  801c22:	68 7c 2b 80 00       	push   $0x802b7c
+  801c27:	68 23 2b 80 00       	push   $0x802b23
+  801c2c:	6a 6d                	push   $0x6d
+  801c2e:	68 70 2b 80 00       	push   $0x802b70
+  801c33:	e8 e8 04 00 00       	call   802120 <_panic>
+
+00801c38 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801c38:	55                   	push   %ebp
+  801c39:	89 e5                	mov    %esp,%ebp
+  801c3b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801c3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c41:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801c46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c49:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801c4e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c51:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801c56:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c5b:	e8 a5 fd ff ff       	call   801a05 <nsipc>
+}
+  801c60:	c9                   	leave
+  801c61:	c3                   	ret
+
+00801c62 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c62:	55                   	push   %ebp
+  801c63:	89 e5                	mov    %esp,%ebp
+  801c65:	56                   	push   %esi
+  801c66:	53                   	push   %ebx
+  801c67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801c6a:	83 ec 0c             	sub    $0xc,%esp
+  801c6d:	ff 75 08             	push   0x8(%ebp)
+  801c70:	e8 aa f3 ff ff       	call   80101f <fd2data>
+  801c75:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801c77:	83 c4 08             	add    $0x8,%esp
+  801c7a:	68 88 2b 80 00       	push   $0x802b88
+  801c7f:	53                   	push   %ebx
+  801c80:	e8 f8 ea ff ff       	call   80077d <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801c85:	8b 46 04             	mov    0x4(%esi),%eax
+  801c88:	2b 06                	sub    (%esi),%eax
+  801c8a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801c90:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c97:	00 00 00 
+	stat->st_dev = &devpipe;
+  801c9a:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801ca1:	30 80 00 
+	return 0;
+}
+  801ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cac:	5b                   	pop    %ebx
+  801cad:	5e                   	pop    %esi
+  801cae:	5d                   	pop    %ebp
+  801caf:	c3                   	ret
+
+00801cb0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801cb0:	55                   	push   %ebp
+  801cb1:	89 e5                	mov    %esp,%ebp
+  801cb3:	53                   	push   %ebx
+  801cb4:	83 ec 0c             	sub    $0xc,%esp
+  801cb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801cba:	53                   	push   %ebx
+  801cbb:	6a 00                	push   $0x0
+  801cbd:	e8 f0 ef ff ff       	call   800cb2 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801cc2:	89 1c 24             	mov    %ebx,(%esp)
+  801cc5:	e8 55 f3 ff ff       	call   80101f <fd2data>
+  801cca:	83 c4 08             	add    $0x8,%esp
+  801ccd:	50                   	push   %eax
+  801cce:	6a 00                	push   $0x0
+  801cd0:	e8 dd ef ff ff       	call   800cb2 <sys_page_unmap>
+}
+  801cd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd8:	c9                   	leave
+  801cd9:	c3                   	ret
+
+00801cda <_pipeisclosed>:
+{
+  801cda:	55                   	push   %ebp
+  801cdb:	89 e5                	mov    %esp,%ebp
+  801cdd:	57                   	push   %edi
+  801cde:	56                   	push   %esi
+  801cdf:	53                   	push   %ebx
+  801ce0:	83 ec 1c             	sub    $0x1c,%esp
+  801ce3:	89 c7                	mov    %eax,%edi
+  801ce5:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801ce7:	a1 08 40 80 00       	mov    0x804008,%eax
+  801cec:	8b 58 5c             	mov    0x5c(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801cef:	83 ec 0c             	sub    $0xc,%esp
+  801cf2:	57                   	push   %edi
+  801cf3:	e8 4a 05 00 00       	call   802242 <pageref>
+  801cf8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801cfb:	89 34 24             	mov    %esi,(%esp)
+  801cfe:	e8 3f 05 00 00       	call   802242 <pageref>
+		nn = thisenv->env_runs;
+  801d03:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801d09:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+		if (n == nn)
+  801d0c:	83 c4 10             	add    $0x10,%esp
+  801d0f:	39 cb                	cmp    %ecx,%ebx
+  801d11:	74 1b                	je     801d2e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801d13:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d16:	75 cf                	jne    801ce7 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801d18:	8b 42 5c             	mov    0x5c(%edx),%eax
+  801d1b:	6a 01                	push   $0x1
+  801d1d:	50                   	push   %eax
+  801d1e:	53                   	push   %ebx
+  801d1f:	68 8f 2b 80 00       	push   $0x802b8f
+  801d24:	e8 66 e4 ff ff       	call   80018f <cprintf>
+  801d29:	83 c4 10             	add    $0x10,%esp
+  801d2c:	eb b9                	jmp    801ce7 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801d2e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d31:	0f 94 c0             	sete   %al
+  801d34:	0f b6 c0             	movzbl %al,%eax
+}
+  801d37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d3a:	5b                   	pop    %ebx
+  801d3b:	5e                   	pop    %esi
+  801d3c:	5f                   	pop    %edi
+  801d3d:	5d                   	pop    %ebp
+  801d3e:	c3                   	ret
+
+00801d3f <devpipe_write>:
+{
+  801d3f:	55                   	push   %ebp
+  801d40:	89 e5                	mov    %esp,%ebp
+  801d42:	57                   	push   %edi
+  801d43:	56                   	push   %esi
+  801d44:	53                   	push   %ebx
+  801d45:	83 ec 28             	sub    $0x28,%esp
+  801d48:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801d4b:	56                   	push   %esi
+  801d4c:	e8 ce f2 ff ff       	call   80101f <fd2data>
+  801d51:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d5b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801d5e:	75 09                	jne    801d69 <devpipe_write+0x2a>
+	return i;
+  801d60:	89 f8                	mov    %edi,%eax
+  801d62:	eb 23                	jmp    801d87 <devpipe_write+0x48>
+			sys_yield();
+  801d64:	e8 01 ee ff ff       	call   800b6a <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801d69:	8b 43 04             	mov    0x4(%ebx),%eax
+  801d6c:	8b 0b                	mov    (%ebx),%ecx
+  801d6e:	8d 51 20             	lea    0x20(%ecx),%edx
+  801d71:	39 d0                	cmp    %edx,%eax
+  801d73:	72 1a                	jb     801d8f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801d75:	89 da                	mov    %ebx,%edx
+  801d77:	89 f0                	mov    %esi,%eax
+  801d79:	e8 5c ff ff ff       	call   801cda <_pipeisclosed>
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	74 e2                	je     801d64 <devpipe_write+0x25>
+				return 0;
+  801d82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d8a:	5b                   	pop    %ebx
+  801d8b:	5e                   	pop    %esi
+  801d8c:	5f                   	pop    %edi
+  801d8d:	5d                   	pop    %ebp
+  801d8e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d92:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801d96:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801d99:	89 c2                	mov    %eax,%edx
+  801d9b:	c1 fa 1f             	sar    $0x1f,%edx
+  801d9e:	89 d1                	mov    %edx,%ecx
+  801da0:	c1 e9 1b             	shr    $0x1b,%ecx
+  801da3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801da6:	83 e2 1f             	and    $0x1f,%edx
+  801da9:	29 ca                	sub    %ecx,%edx
+  801dab:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801daf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801db3:	83 c0 01             	add    $0x1,%eax
+  801db6:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801db9:	83 c7 01             	add    $0x1,%edi
+  801dbc:	eb 9d                	jmp    801d5b <devpipe_write+0x1c>
+
+00801dbe <devpipe_read>:
+{
+  801dbe:	55                   	push   %ebp
+  801dbf:	89 e5                	mov    %esp,%ebp
+  801dc1:	57                   	push   %edi
+  801dc2:	56                   	push   %esi
+  801dc3:	53                   	push   %ebx
+  801dc4:	83 ec 18             	sub    $0x18,%esp
+  801dc7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801dca:	57                   	push   %edi
+  801dcb:	e8 4f f2 ff ff       	call   80101f <fd2data>
+  801dd0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801dd2:	83 c4 10             	add    $0x10,%esp
+  801dd5:	be 00 00 00 00       	mov    $0x0,%esi
+  801dda:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801ddd:	75 13                	jne    801df2 <devpipe_read+0x34>
+	return i;
+  801ddf:	89 f0                	mov    %esi,%eax
+  801de1:	eb 02                	jmp    801de5 <devpipe_read+0x27>
+				return i;
+  801de3:	89 f0                	mov    %esi,%eax
+}
+  801de5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801de8:	5b                   	pop    %ebx
+  801de9:	5e                   	pop    %esi
+  801dea:	5f                   	pop    %edi
+  801deb:	5d                   	pop    %ebp
+  801dec:	c3                   	ret
+			sys_yield();
+  801ded:	e8 78 ed ff ff       	call   800b6a <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801df2:	8b 03                	mov    (%ebx),%eax
+  801df4:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801df7:	75 18                	jne    801e11 <devpipe_read+0x53>
+			if (i > 0)
+  801df9:	85 f6                	test   %esi,%esi
+  801dfb:	75 e6                	jne    801de3 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801dfd:	89 da                	mov    %ebx,%edx
+  801dff:	89 f8                	mov    %edi,%eax
+  801e01:	e8 d4 fe ff ff       	call   801cda <_pipeisclosed>
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	74 e3                	je     801ded <devpipe_read+0x2f>
+				return 0;
+  801e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0f:	eb d4                	jmp    801de5 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e11:	99                   	cltd
+  801e12:	c1 ea 1b             	shr    $0x1b,%edx
+  801e15:	01 d0                	add    %edx,%eax
+  801e17:	83 e0 1f             	and    $0x1f,%eax
+  801e1a:	29 d0                	sub    %edx,%eax
+  801e1c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801e21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e24:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801e27:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801e2a:	83 c6 01             	add    $0x1,%esi
+  801e2d:	eb ab                	jmp    801dda <devpipe_read+0x1c>
+
+00801e2f <pipe>:
+{
+  801e2f:	55                   	push   %ebp
+  801e30:	89 e5                	mov    %esp,%ebp
+  801e32:	56                   	push   %esi
+  801e33:	53                   	push   %ebx
+  801e34:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801e37:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e3a:	50                   	push   %eax
+  801e3b:	e8 f6 f1 ff ff       	call   801036 <fd_alloc>
+  801e40:	89 c3                	mov    %eax,%ebx
+  801e42:	83 c4 10             	add    $0x10,%esp
+  801e45:	85 c0                	test   %eax,%eax
+  801e47:	0f 88 23 01 00 00    	js     801f70 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e4d:	83 ec 04             	sub    $0x4,%esp
+  801e50:	68 07 04 00 00       	push   $0x407
+  801e55:	ff 75 f4             	push   -0xc(%ebp)
+  801e58:	6a 00                	push   $0x0
+  801e5a:	e8 8b ed ff ff       	call   800bea <sys_page_alloc>
+  801e5f:	89 c3                	mov    %eax,%ebx
+  801e61:	83 c4 10             	add    $0x10,%esp
+  801e64:	85 c0                	test   %eax,%eax
+  801e66:	0f 88 04 01 00 00    	js     801f70 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801e6c:	83 ec 0c             	sub    $0xc,%esp
+  801e6f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e72:	50                   	push   %eax
+  801e73:	e8 be f1 ff ff       	call   801036 <fd_alloc>
+  801e78:	89 c3                	mov    %eax,%ebx
+  801e7a:	83 c4 10             	add    $0x10,%esp
+  801e7d:	85 c0                	test   %eax,%eax
+  801e7f:	0f 88 db 00 00 00    	js     801f60 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e85:	83 ec 04             	sub    $0x4,%esp
+  801e88:	68 07 04 00 00       	push   $0x407
+  801e8d:	ff 75 f0             	push   -0x10(%ebp)
+  801e90:	6a 00                	push   $0x0
+  801e92:	e8 53 ed ff ff       	call   800bea <sys_page_alloc>
+  801e97:	89 c3                	mov    %eax,%ebx
+  801e99:	83 c4 10             	add    $0x10,%esp
+  801e9c:	85 c0                	test   %eax,%eax
+  801e9e:	0f 88 bc 00 00 00    	js     801f60 <pipe+0x131>
+	va = fd2data(fd0);
+  801ea4:	83 ec 0c             	sub    $0xc,%esp
+  801ea7:	ff 75 f4             	push   -0xc(%ebp)
+  801eaa:	e8 70 f1 ff ff       	call   80101f <fd2data>
+  801eaf:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801eb1:	83 c4 0c             	add    $0xc,%esp
+  801eb4:	68 07 04 00 00       	push   $0x407
+  801eb9:	50                   	push   %eax
+  801eba:	6a 00                	push   $0x0
+  801ebc:	e8 29 ed ff ff       	call   800bea <sys_page_alloc>
+  801ec1:	89 c3                	mov    %eax,%ebx
+  801ec3:	83 c4 10             	add    $0x10,%esp
+  801ec6:	85 c0                	test   %eax,%eax
+  801ec8:	0f 88 82 00 00 00    	js     801f50 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ece:	83 ec 0c             	sub    $0xc,%esp
+  801ed1:	ff 75 f0             	push   -0x10(%ebp)
+  801ed4:	e8 46 f1 ff ff       	call   80101f <fd2data>
+  801ed9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801ee0:	50                   	push   %eax
+  801ee1:	6a 00                	push   $0x0
+  801ee3:	56                   	push   %esi
+  801ee4:	6a 00                	push   $0x0
+  801ee6:	e8 85 ed ff ff       	call   800c70 <sys_page_map>
+  801eeb:	89 c3                	mov    %eax,%ebx
+  801eed:	83 c4 20             	add    $0x20,%esp
+  801ef0:	85 c0                	test   %eax,%eax
+  801ef2:	78 4e                	js     801f42 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801ef4:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801ef9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801efc:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801efe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f01:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801f08:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801f0b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801f0d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801f10:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801f17:	83 ec 0c             	sub    $0xc,%esp
+  801f1a:	ff 75 f4             	push   -0xc(%ebp)
+  801f1d:	e8 ed f0 ff ff       	call   80100f <fd2num>
+  801f22:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f25:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801f27:	83 c4 04             	add    $0x4,%esp
+  801f2a:	ff 75 f0             	push   -0x10(%ebp)
+  801f2d:	e8 dd f0 ff ff       	call   80100f <fd2num>
+  801f32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f35:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801f38:	83 c4 10             	add    $0x10,%esp
+  801f3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f40:	eb 2e                	jmp    801f70 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801f42:	83 ec 08             	sub    $0x8,%esp
+  801f45:	56                   	push   %esi
+  801f46:	6a 00                	push   $0x0
+  801f48:	e8 65 ed ff ff       	call   800cb2 <sys_page_unmap>
+  801f4d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801f50:	83 ec 08             	sub    $0x8,%esp
+  801f53:	ff 75 f0             	push   -0x10(%ebp)
+  801f56:	6a 00                	push   $0x0
+  801f58:	e8 55 ed ff ff       	call   800cb2 <sys_page_unmap>
+  801f5d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801f60:	83 ec 08             	sub    $0x8,%esp
+  801f63:	ff 75 f4             	push   -0xc(%ebp)
+  801f66:	6a 00                	push   $0x0
+  801f68:	e8 45 ed ff ff       	call   800cb2 <sys_page_unmap>
+  801f6d:	83 c4 10             	add    $0x10,%esp
+}
+  801f70:	89 d8                	mov    %ebx,%eax
+  801f72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f75:	5b                   	pop    %ebx
+  801f76:	5e                   	pop    %esi
+  801f77:	5d                   	pop    %ebp
+  801f78:	c3                   	ret
+
+00801f79 <pipeisclosed>:
+{
+  801f79:	55                   	push   %ebp
+  801f7a:	89 e5                	mov    %esp,%ebp
+  801f7c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f7f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f82:	50                   	push   %eax
+  801f83:	ff 75 08             	push   0x8(%ebp)
+  801f86:	e8 01 f1 ff ff       	call   80108c <fd_lookup>
+  801f8b:	83 c4 10             	add    $0x10,%esp
+  801f8e:	85 c0                	test   %eax,%eax
+  801f90:	78 18                	js     801faa <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801f92:	83 ec 0c             	sub    $0xc,%esp
+  801f95:	ff 75 f4             	push   -0xc(%ebp)
+  801f98:	e8 82 f0 ff ff       	call   80101f <fd2data>
+  801f9d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801f9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fa2:	e8 33 fd ff ff       	call   801cda <_pipeisclosed>
+  801fa7:	83 c4 10             	add    $0x10,%esp
+}
+  801faa:	c9                   	leave
+  801fab:	c3                   	ret
+
+00801fac <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801fac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb1:	c3                   	ret
+
+00801fb2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801fb2:	55                   	push   %ebp
+  801fb3:	89 e5                	mov    %esp,%ebp
+  801fb5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801fb8:	68 a7 2b 80 00       	push   $0x802ba7
+  801fbd:	ff 75 0c             	push   0xc(%ebp)
+  801fc0:	e8 b8 e7 ff ff       	call   80077d <strcpy>
+	return 0;
+}
+  801fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fca:	c9                   	leave
+  801fcb:	c3                   	ret
+
+00801fcc <devcons_write>:
+{
+  801fcc:	55                   	push   %ebp
+  801fcd:	89 e5                	mov    %esp,%ebp
+  801fcf:	57                   	push   %edi
+  801fd0:	56                   	push   %esi
+  801fd1:	53                   	push   %ebx
+  801fd2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801fd8:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801fdd:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801fe3:	eb 2e                	jmp    802013 <devcons_write+0x47>
+		m = n - tot;
+  801fe5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fe8:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801fea:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801fef:	39 c3                	cmp    %eax,%ebx
+  801ff1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801ff4:	83 ec 04             	sub    $0x4,%esp
+  801ff7:	53                   	push   %ebx
+  801ff8:	89 f0                	mov    %esi,%eax
+  801ffa:	03 45 0c             	add    0xc(%ebp),%eax
+  801ffd:	50                   	push   %eax
+  801ffe:	57                   	push   %edi
+  801fff:	e8 ff e8 ff ff       	call   800903 <memmove>
+		sys_cputs(buf, m);
+  802004:	83 c4 08             	add    $0x8,%esp
+  802007:	53                   	push   %ebx
+  802008:	57                   	push   %edi
+  802009:	e8 9f ea ff ff       	call   800aad <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80200e:	01 de                	add    %ebx,%esi
+  802010:	83 c4 10             	add    $0x10,%esp
+  802013:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802016:	72 cd                	jb     801fe5 <devcons_write+0x19>
+}
+  802018:	89 f0                	mov    %esi,%eax
+  80201a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80201d:	5b                   	pop    %ebx
+  80201e:	5e                   	pop    %esi
+  80201f:	5f                   	pop    %edi
+  802020:	5d                   	pop    %ebp
+  802021:	c3                   	ret
+
+00802022 <devcons_read>:
+{
+  802022:	55                   	push   %ebp
+  802023:	89 e5                	mov    %esp,%ebp
+  802025:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802031:	75 07                	jne    80203a <devcons_read+0x18>
+  802033:	eb 1f                	jmp    802054 <devcons_read+0x32>
+		sys_yield();
+  802035:	e8 30 eb ff ff       	call   800b6a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80203a:	e8 8c ea ff ff       	call   800acb <sys_cgetc>
+  80203f:	85 c0                	test   %eax,%eax
+  802041:	74 f2                	je     802035 <devcons_read+0x13>
+	if (c < 0)
+  802043:	78 0f                	js     802054 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802045:	83 f8 04             	cmp    $0x4,%eax
+  802048:	74 0c                	je     802056 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80204a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80204d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80204f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802054:	c9                   	leave
+  802055:	c3                   	ret
+		return 0;
+  802056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205b:	eb f7                	jmp    802054 <devcons_read+0x32>
+
+0080205d <cputchar>:
+{
+  80205d:	55                   	push   %ebp
+  80205e:	89 e5                	mov    %esp,%ebp
+  802060:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802063:	8b 45 08             	mov    0x8(%ebp),%eax
+  802066:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802069:	6a 01                	push   $0x1
+  80206b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80206e:	50                   	push   %eax
+  80206f:	e8 39 ea ff ff       	call   800aad <sys_cputs>
+}
+  802074:	83 c4 10             	add    $0x10,%esp
+  802077:	c9                   	leave
+  802078:	c3                   	ret
+
+00802079 <getchar>:
+{
+  802079:	55                   	push   %ebp
+  80207a:	89 e5                	mov    %esp,%ebp
+  80207c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80207f:	6a 01                	push   $0x1
+  802081:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802084:	50                   	push   %eax
+  802085:	6a 00                	push   $0x0
+  802087:	e8 66 f2 ff ff       	call   8012f2 <read>
+	if (r < 0)
+  80208c:	83 c4 10             	add    $0x10,%esp
+  80208f:	85 c0                	test   %eax,%eax
+  802091:	78 06                	js     802099 <getchar+0x20>
+	if (r < 1)
+  802093:	74 06                	je     80209b <getchar+0x22>
+	return c;
+  802095:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802099:	c9                   	leave
+  80209a:	c3                   	ret
+		return -E_EOF;
+  80209b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8020a0:	eb f7                	jmp    802099 <getchar+0x20>
+
+008020a2 <iscons>:
+{
+  8020a2:	55                   	push   %ebp
+  8020a3:	89 e5                	mov    %esp,%ebp
+  8020a5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ab:	50                   	push   %eax
+  8020ac:	ff 75 08             	push   0x8(%ebp)
+  8020af:	e8 d8 ef ff ff       	call   80108c <fd_lookup>
+  8020b4:	83 c4 10             	add    $0x10,%esp
+  8020b7:	85 c0                	test   %eax,%eax
+  8020b9:	78 11                	js     8020cc <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8020bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020be:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8020c4:	39 10                	cmp    %edx,(%eax)
+  8020c6:	0f 94 c0             	sete   %al
+  8020c9:	0f b6 c0             	movzbl %al,%eax
+}
+  8020cc:	c9                   	leave
+  8020cd:	c3                   	ret
+
+008020ce <opencons>:
+{
+  8020ce:	55                   	push   %ebp
+  8020cf:	89 e5                	mov    %esp,%ebp
+  8020d1:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8020d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020d7:	50                   	push   %eax
+  8020d8:	e8 59 ef ff ff       	call   801036 <fd_alloc>
+  8020dd:	83 c4 10             	add    $0x10,%esp
+  8020e0:	85 c0                	test   %eax,%eax
+  8020e2:	78 3a                	js     80211e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8020e4:	83 ec 04             	sub    $0x4,%esp
+  8020e7:	68 07 04 00 00       	push   $0x407
+  8020ec:	ff 75 f4             	push   -0xc(%ebp)
+  8020ef:	6a 00                	push   $0x0
+  8020f1:	e8 f4 ea ff ff       	call   800bea <sys_page_alloc>
+  8020f6:	83 c4 10             	add    $0x10,%esp
+  8020f9:	85 c0                	test   %eax,%eax
+  8020fb:	78 21                	js     80211e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8020fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802100:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802106:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802108:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80210b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802112:	83 ec 0c             	sub    $0xc,%esp
+  802115:	50                   	push   %eax
+  802116:	e8 f4 ee ff ff       	call   80100f <fd2num>
+  80211b:	83 c4 10             	add    $0x10,%esp
+}
+  80211e:	c9                   	leave
+  80211f:	c3                   	ret
+
+00802120 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802120:	55                   	push   %ebp
+  802121:	89 e5                	mov    %esp,%ebp
+  802123:	56                   	push   %esi
+  802124:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802125:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802128:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80212e:	e8 18 ea ff ff       	call   800b4b <sys_getenvid>
+  802133:	83 ec 0c             	sub    $0xc,%esp
+  802136:	ff 75 0c             	push   0xc(%ebp)
+  802139:	ff 75 08             	push   0x8(%ebp)
+  80213c:	56                   	push   %esi
+  80213d:	50                   	push   %eax
+  80213e:	68 b4 2b 80 00       	push   $0x802bb4
+  802143:	e8 47 e0 ff ff       	call   80018f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802148:	83 c4 18             	add    $0x18,%esp
+  80214b:	53                   	push   %ebx
+  80214c:	ff 75 10             	push   0x10(%ebp)
+  80214f:	e8 ea df ff ff       	call   80013e <vcprintf>
+	cprintf("\n");
+  802154:	c7 04 24 a0 2b 80 00 	movl   $0x802ba0,(%esp)
+  80215b:	e8 2f e0 ff ff       	call   80018f <cprintf>
+  802160:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802163:	cc                   	int3
+	while (1)
+  802164:	eb fd                	jmp    802163 <_panic+0x43>
+
+00802166 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802166:	55                   	push   %ebp
+  802167:	89 e5                	mov    %esp,%ebp
+  802169:	57                   	push   %edi
+  80216a:	56                   	push   %esi
+  80216b:	53                   	push   %ebx
+  80216c:	83 ec 18             	sub    $0x18,%esp
+  80216f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802172:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802175:	8b 75 10             	mov    0x10(%ebp),%esi
+	// LAB 4: Your code here.
+	int r;
+	
+	r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802178:	85 db                	test   %ebx,%ebx
+  80217a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80217f:	0f 45 c3             	cmovne %ebx,%eax
+  802182:	50                   	push   %eax
+  802183:	e8 e5 ed ff ff       	call   800f6d <sys_ipc_recv>
+
+	if (from_env_store)
+  802188:	83 c4 10             	add    $0x10,%esp
+  80218b:	85 ff                	test   %edi,%edi
+  80218d:	74 17                	je     8021a6 <ipc_recv+0x40>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80218f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802194:	85 c0                	test   %eax,%eax
+  802196:	75 0c                	jne    8021a4 <ipc_recv+0x3e>
+  802198:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80219e:	8b 92 a4 01 00 00    	mov    0x1a4(%edx),%edx
+  8021a4:	89 17                	mov    %edx,(%edi)
+
+	if (perm_store) {
+  8021a6:	85 f6                	test   %esi,%esi
+  8021a8:	74 2e                	je     8021d8 <ipc_recv+0x72>
+		if (!r && pg)
+  8021aa:	85 c0                	test   %eax,%eax
+  8021ac:	75 24                	jne    8021d2 <ipc_recv+0x6c>
+  8021ae:	85 db                	test   %ebx,%ebx
+  8021b0:	74 20                	je     8021d2 <ipc_recv+0x6c>
+			*perm_store = thisenv->env_ipc_perm;
+  8021b2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8021b7:	8b 80 a8 01 00 00    	mov    0x1a8(%eax),%eax
+  8021bd:	89 06                	mov    %eax,(%esi)
+		else
+			*perm_store = 0;
+	}
+	return !r ? thisenv->env_ipc_value : r;
+  8021bf:	a1 08 40 80 00       	mov    0x804008,%eax
+  8021c4:	8b 80 a0 01 00 00    	mov    0x1a0(%eax),%eax
+}
+  8021ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021cd:	5b                   	pop    %ebx
+  8021ce:	5e                   	pop    %esi
+  8021cf:	5f                   	pop    %edi
+  8021d0:	5d                   	pop    %ebp
+  8021d1:	c3                   	ret
+			*perm_store = 0;
+  8021d2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	return !r ? thisenv->env_ipc_value : r;
+  8021d8:	85 c0                	test   %eax,%eax
+  8021da:	75 ee                	jne    8021ca <ipc_recv+0x64>
+  8021dc:	eb e1                	jmp    8021bf <ipc_recv+0x59>
+
+008021de <ipc_send>:
+//
+// A successful send hands our CPU, and the rest of our time slice,
+// directly to 'toenv', which is usually about to reply to us.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8021de:	55                   	push   %ebp
+  8021df:	89 e5                	mov    %esp,%ebp
+  8021e1:	57                   	push   %edi
+  8021e2:	56                   	push   %esi
+  8021e3:	53                   	push   %ebx
+  8021e4:	83 ec 0c             	sub    $0xc,%esp
+  8021e7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021ea:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_try_send_yield(to_env, val, pg ? pg : (void *) UTOP, perm)) < 0) {
+  8021f0:	85 db                	test   %ebx,%ebx
+  8021f2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021f7:	0f 44 d8             	cmove  %eax,%ebx
+  8021fa:	ff 75 14             	push   0x14(%ebp)
+  8021fd:	53                   	push   %ebx
+  8021fe:	56                   	push   %esi
+  8021ff:	57                   	push   %edi
+  802200:	e8 45 ed ff ff       	call   800f4a <sys_ipc_try_send_yield>
+  802205:	83 c4 10             	add    $0x10,%esp
+  802208:	85 c0                	test   %eax,%eax
+  80220a:	79 1e                	jns    80222a <ipc_send+0x4c>
+		if (r != -E_IPC_NOT_RECV)
+  80220c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80220f:	75 07                	jne    802218 <ipc_send+0x3a>
+			panic("sys_ipc_try_send: %e", r);
+		sys_yield();
+  802211:	e8 54 e9 ff ff       	call   800b6a <sys_yield>
+  802216:	eb e2                	jmp    8021fa <ipc_send+0x1c>
+			panic("sys_ipc_try_send: %e", r);
+  802218:	50                   	push   %eax
+  802219:	68 d7 2b 80 00       	push   $0x802bd7
+  80221e:	6a 3d                	push   $0x3d
+  802220:	68 ec 2b 80 00       	push   $0x802bec
+  802225:	e8 f6 fe ff ff       	call   802120 <_panic>
+	}
+}
+  80222a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80222d:	5b                   	pop    %ebx
+  80222e:	5e                   	pop    %esi
+  80222f:	5f                   	pop    %edi
+  802230:	5d                   	pop    %ebp
+  802231:	c3                   	ret
+
+00802232 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802232:	55                   	push   %ebp
+  802233:	89 e5                	mov    %esp,%ebp
+  802235:	83 ec 14             	sub    $0x14,%esp
+	// Most of envs[] isn't mapped, so let the kernel search the part
+	// in use.
+	return sys_env_find(type);
+  802238:	ff 75 08             	push   0x8(%ebp)
+  80223b:	e8 aa e8 ff ff       	call   800aea <sys_env_find>
+}
+  802240:	c9                   	leave
+  802241:	c3                   	ret
+
+00802242 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802242:	55                   	push   %ebp
+  802243:	89 e5                	mov    %esp,%ebp
+  802245:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802248:	89 c2                	mov    %eax,%edx
+  80224a:	c1 ea 16             	shr    $0x16,%edx
+  80224d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802254:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802259:	f6 c1 01             	test   $0x1,%cl
+  80225c:	74 22                	je     802280 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80225e:	c1 e8 0c             	shr    $0xc,%eax
+  802261:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802268:	a8 01                	test   $0x1,%al
+  80226a:	74 14                	je     802280 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80226c:	c1 e8 0c             	shr    $0xc,%eax
+  80226f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802272:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802279:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80227d:	0f b7 d2             	movzwl %dx,%edx
+}
+  802280:	89 d0                	mov    %edx,%eax
+  802282:	5d                   	pop    %ebp
+  802283:	c3                   	ret
+  802284:	66 90                	xchg   %ax,%ax
+  802286:	66 90                	xchg   %ax,%ax
+  802288:	66 90                	xchg   %ax,%ax
+  80228a:	66 90                	xchg   %ax,%ax
+  80228c:	66 90                	xchg   %ax,%ax
+  80228e:	66 90                	xchg   %ax,%ax
+
+00802290 <__udivmoddi4>:
+  802290:	55                   	push   %ebp
+  802291:	57                   	push   %edi
+  802292:	56                   	push   %esi
+  802293:	53                   	push   %ebx
+  802294:	83 ec 14             	sub    $0x14,%esp
+  802297:	8b 74 24 34          	mov    0x34(%esp),%esi
+  80229b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80229f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022a3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022a7:	89 f1                	mov    %esi,%ecx
+  8022a9:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022ad:	09 d9                	or     %ebx,%ecx
+  8022af:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022b3:	0f 84 92 00 00 00    	je     80234b <__udivmoddi4+0xbb>
+  8022b9:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8022c0:	00 
+  8022c1:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  8022c6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8022cd:	00 
+  8022ce:	89 1c 24             	mov    %ebx,(%esp)
+  8022d1:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8022d5:	8d 76 00             	lea    0x0(%esi),%esi
+  8022d8:	89 e9                	mov    %ebp,%ecx
+  8022da:	89 c3                	mov    %eax,%ebx
+  8022dc:	89 d6                	mov    %edx,%esi
+  8022de:	31 ff                	xor    %edi,%edi
+  8022e0:	d3 ee                	shr    %cl,%esi
+  8022e2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8022e5:	f6 c1 20             	test   $0x20,%cl
+  8022e8:	0f 45 de             	cmovne %esi,%ebx
+  8022eb:	0f 45 f7             	cmovne %edi,%esi
+  8022ee:	8b 3c 24             	mov    (%esp),%edi
+  8022f1:	39 fb                	cmp    %edi,%ebx
+  8022f3:	89 f7                	mov    %esi,%edi
+  8022f5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8022f9:	8b 1c 24             	mov    (%esp),%ebx
+  8022fc:	19 f7                	sbb    %esi,%edi
+  8022fe:	72 39                	jb     802339 <__udivmoddi4+0xa9>
+  802300:	89 e9                	mov    %ebp,%ecx
+  802302:	89 f7                	mov    %esi,%edi
+  802304:	89 de                	mov    %ebx,%esi
+  802306:	0f a5 df             	shld   %cl,%ebx,%edi
+  802309:	d3 e6                	shl    %cl,%esi
+  80230b:	31 db                	xor    %ebx,%ebx
+  80230d:	f6 c1 20             	test   $0x20,%cl
+  802310:	0f 45 fe             	cmovne %esi,%edi
+  802313:	0f 45 f3             	cmovne %ebx,%esi
+  802316:	29 f0                	sub    %esi,%eax
+  802318:	be 01 00 00 00       	mov    $0x1,%esi
+  80231d:	19 fa                	sbb    %edi,%edx
+  80231f:	31 ff                	xor    %edi,%edi
+  802321:	31 db                	xor    %ebx,%ebx
+  802323:	0f a5 f7             	shld   %cl,%esi,%edi
+  802326:	d3 e6                	shl    %cl,%esi
+  802328:	f6 c1 20             	test   $0x20,%cl
+  80232b:	0f 45 fe             	cmovne %esi,%edi
+  80232e:	0f 45 f3             	cmovne %ebx,%esi
+  802331:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802335:	09 74 24 08          	or     %esi,0x8(%esp)
+  802339:	83 ed 01             	sub    $0x1,%ebp
+  80233c:	73 9a                	jae    8022d8 <__udivmoddi4+0x48>
+  80233e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  802342:	85 ff                	test   %edi,%edi
+  802344:	74 05                	je     80234b <__udivmoddi4+0xbb>
+  802346:	89 07                	mov    %eax,(%edi)
+  802348:	89 57 04             	mov    %edx,0x4(%edi)
+  80234b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80234f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802353:	83 c4 14             	add    $0x14,%esp
+  802356:	5b                   	pop    %ebx
+  802357:	5e                   	pop    %esi
+  802358:	5f                   	pop    %edi
+  802359:	5d                   	pop    %ebp
+  80235a:	c3                   	ret
+  80235b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80235f:	90                   	nop
+
+00802360 <__udivdi3>:
+  802360:	55                   	push   %ebp
+  802361:	57                   	push   %edi
+  802362:	56                   	push   %esi
+  802363:	53                   	push   %ebx
+  802364:	83 ec 14             	sub    $0x14,%esp
+  802367:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  80236b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80236f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802373:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802377:	89 fb                	mov    %edi,%ebx
+  802379:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80237d:	09 f3                	or     %esi,%ebx
+  80237f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802383:	0f 84 85 00 00 00    	je     80240e <__udivdi3+0xae>
+  802389:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802390:	00 
+  802391:	bd 3f 00 00 00       	mov    $0x3f,%ebp
+  802396:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80239d:	00 
+  80239e:	89 34 24             	mov    %esi,(%esp)
+  8023a1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8023a5:	8d 76 00             	lea    0x0(%esi),%esi
+  8023a8:	89 e9                	mov    %ebp,%ecx
+  8023aa:	89 c3                	mov    %eax,%ebx
+  8023ac:	89 d6                	mov    %edx,%esi
+  8023ae:	31 ff                	xor    %edi,%edi
+  8023b0:	d3 ee                	shr    %cl,%esi
+  8023b2:	0f ad d3             	shrd   %cl,%edx,%ebx
+  8023b5:	f6 c1 20             	test   $0x20,%cl
+  8023b8:	0f 45 de             	cmovne %esi,%ebx
+  8023bb:	0f 45 f7             	cmovne %edi,%esi
+  8023be:	8b 3c 24             	mov    (%esp),%edi
+  8023c1:	39 fb                	cmp    %edi,%ebx
+  8023c3:	89 f7                	mov    %esi,%edi
+  8023c5:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8023c9:	8b 1c 24             	mov    (%esp),%ebx
+  8023cc:	19 f7                	sbb    %esi,%edi
+  8023ce:	72 39                	jb     802409 <__udivdi3+0xa9>
+  8023d0:	89 e9                	mov    %ebp,%ecx
+  8023d2:	89 f7                	mov    %esi,%edi
+  8023d4:	89 de                	mov    %ebx,%esi
+  8023d6:	0f a5 df             	shld   %cl,%ebx,%edi
+  8023d9:	d3 e6                	shl    %cl,%esi
+  8023db:	31 db                	xor    %ebx,%ebx
+  8023dd:	f6 c1 20             	test   $0x20,%cl
+  8023e0:	0f 45 fe             	cmovne %esi,%edi
+  8023e3:	0f 45 f3             	cmovne %ebx,%esi
+  8023e6:	29 f0                	sub    %esi,%eax
+  8023e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ed:	19 fa                	sbb    %edi,%edx
+  8023ef:	31 ff                	xor    %edi,%edi
+  8023f1:	31 db                	xor    %ebx,%ebx
+  8023f3:	0f a5 f7             	shld   %cl,%esi,%edi
+  8023f6:	d3 e6                	shl    %cl,%esi
+  8023f8:	f6 c1 20             	test   $0x20,%cl
+  8023fb:	0f 45 fe             	cmovne %esi,%edi
+  8023fe:	0f 45 f3             	cmovne %ebx,%esi
+  802401:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802405:	09 74 24 08          	or     %esi,0x8(%esp)
+  802409:	83 ed 01             	sub    $0x1,%ebp
+  80240c:	73 9a                	jae    8023a8 <__udivdi3+0x48>
+  80240e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802412:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802416:	83 c4 14             	add    $0x14,%esp
+  802419:	5b                   	pop    %ebx
+  80241a:	5e                   	pop    %esi
+  80241b:	5f                   	pop    %edi
+  80241c:	5d                   	pop    %ebp
+  80241d:	c3                   	ret
+  80241e:	66 90                	xchg   %ax,%ax
+
+00802420 <__umoddi3>:
+  802420:	57                   	push   %edi
+  802421:	56                   	push   %esi
+  802422:	53                   	push   %ebx
+  802423:	83 ec 08             	sub    $0x8,%esp
+  802426:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80242a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80242e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802432:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802436:	89 f9                	mov    %edi,%ecx
+  802438:	89 34 24             	mov    %esi,(%esp)
+  80243b:	09 f1                	or     %esi,%ecx
+  80243d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802441:	74 53                	je     802496 <__umoddi3+0x76>
+  802443:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80244f:	90                   	nop
+  802450:	89 c6                	mov    %eax,%esi
+  802452:	89 d7                	mov    %edx,%edi
+  802454:	31 db                	xor    %ebx,%ebx
+  802456:	d3 ef                	shr    %cl,%edi
+  802458:	0f ad d6             	shrd   %cl,%edx,%esi
+  80245b:	f6 c1 20             	test   $0x20,%cl
+  80245e:	0f 45 f7             	cmovne %edi,%esi
+  802461:	0f 45 fb             	cmovne %ebx,%edi
+  802464:	8b 1c 24             	mov    (%esp),%ebx
+  802467:	39 de                	cmp    %ebx,%esi
+  802469:	89 fb                	mov    %edi,%ebx
+  80246b:	8b 7c 24 04          	mov    0x4(%esp),%edi
+  80246f:	8b 34 24             	mov    (%esp),%esi
+  802472:	19 fb                	sbb    %edi,%ebx
+  802474:	72 14                	jb     80248a <__umoddi3+0x6a>
+  802476:	0f a5 f7             	shld   %cl,%esi,%edi
+  802479:	31 db                	xor    %ebx,%ebx
+  80247b:	d3 e6                	shl    %cl,%esi
+  80247d:	f6 c1 20             	test   $0x20,%cl
+  802480:	0f 45 fe             	cmovne %esi,%edi
+  802483:	0f 45 f3             	cmovne %ebx,%esi
+  802486:	29 f0                	sub    %esi,%eax
+  802488:	19 fa                	sbb    %edi,%edx
+  80248a:	83 e9 01             	sub    $0x1,%ecx
+  80248d:	73 c1                	jae    802450 <__umoddi3+0x30>
+  80248f:	83 c4 08             	add    $0x8,%esp
+  802492:	5b                   	pop    %ebx
+  802493:	5e                   	pop    %esi
+  802494:	5f                   	pop    %edi
+  802495:	c3                   	ret
+  802496:	83 c4 08             	add    $0x8,%esp
+  802499:	31 c0                	xor    %eax,%eax
+  80249b:	31 d2                	xor    %edx,%edx
+  80249d:	5b                   	pop    %ebx
+  80249e:	5e                   	pop    %esi
+  80249f:	5f                   	pop    %edi
+  8024a0:	c3                   	ret
+  8024a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024af:	90                   	nop
+
+008024b0 <__divdi3>:
+  8024b0:	55                   	push   %ebp
+  8024b1:	57                   	push   %edi
+  8024b2:	56                   	push   %esi
+  8024b3:	53                   	push   %ebx
+  8024b4:	83 ec 1c             	sub    $0x1c,%esp
+  8024b7:	8b 7c 24 34          	mov    0x34(%esp),%edi
+  8024bb:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8024bf:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8024c3:	8b 5c 24 3c          	mov    0x3c(%esp),%ebx
+  8024c7:	85 ff                	test   %edi,%edi
+  8024c9:	0f 88 da 00 00 00    	js     8025a9 <__divdi3+0xf9>
+  8024cf:	85 db                	test   %ebx,%ebx
+  8024d1:	78 16                	js     8024e9 <__divdi3+0x39>
+  8024d3:	89 dd                	mov    %ebx,%ebp
+  8024d5:	89 c8                	mov    %ecx,%eax
+  8024d7:	89 da                	mov    %ebx,%edx
+  8024d9:	09 cd                	or     %ecx,%ebp
+  8024db:	0f 85 fd 00 00 00    	jne    8025de <__divdi3+0x12e>
+  8024e1:	83 c4 1c             	add    $0x1c,%esp
+  8024e4:	5b                   	pop    %ebx
+  8024e5:	5e                   	pop    %esi
+  8024e6:	5f                   	pop    %edi
+  8024e7:	5d                   	pop    %ebp
+  8024e8:	c3                   	ret
+  8024e9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8024ee:	f7 d9                	neg    %ecx
+  8024f0:	89 f0                	mov    %esi,%eax
+  8024f2:	89 fa                	mov    %edi,%edx
+  8024f4:	83 d3 00             	adc    $0x0,%ebx
+  8024f7:	89 0c 24             	mov    %ecx,(%esp)
+  8024fa:	f7 db                	neg    %ebx
+  8024fc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  802500:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802507:	00 
+  802508:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80250d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802514:	00 
+  802515:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802519:	89 cd                	mov    %ecx,%ebp
+  80251b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80251f:	90                   	nop
+  802520:	89 e9                	mov    %ebp,%ecx
+  802522:	89 c3                	mov    %eax,%ebx
+  802524:	89 d6                	mov    %edx,%esi
+  802526:	31 ff                	xor    %edi,%edi
+  802528:	d3 ee                	shr    %cl,%esi
+  80252a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80252d:	f6 c1 20             	test   $0x20,%cl
+  802530:	0f 45 de             	cmovne %esi,%ebx
+  802533:	0f 45 f7             	cmovne %edi,%esi
+  802536:	8b 3c 24             	mov    (%esp),%edi
+  802539:	39 fb                	cmp    %edi,%ebx
+  80253b:	89 f7                	mov    %esi,%edi
+  80253d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802541:	8b 1c 24             	mov    (%esp),%ebx
+  802544:	19 f7                	sbb    %esi,%edi
+  802546:	72 39                	jb     802581 <__divdi3+0xd1>
+  802548:	89 e9                	mov    %ebp,%ecx
+  80254a:	89 f7                	mov    %esi,%edi
+  80254c:	89 de                	mov    %ebx,%esi
+  80254e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802551:	d3 e6                	shl    %cl,%esi
+  802553:	31 db                	xor    %ebx,%ebx
+  802555:	f6 c1 20             	test   $0x20,%cl
+  802558:	0f 45 fe             	cmovne %esi,%edi
+  80255b:	0f 45 f3             	cmovne %ebx,%esi
+  80255e:	29 f0                	sub    %esi,%eax
+  802560:	be 01 00 00 00       	mov    $0x1,%esi
+  802565:	19 fa                	sbb    %edi,%edx
+  802567:	31 ff                	xor    %edi,%edi
+  802569:	31 db                	xor    %ebx,%ebx
+  80256b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80256e:	d3 e6                	shl    %cl,%esi
+  802570:	f6 c1 20             	test   $0x20,%cl
+  802573:	0f 45 fe             	cmovne %esi,%edi
+  802576:	0f 45 f3             	cmovne %ebx,%esi
+  802579:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80257d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802581:	83 ed 01             	sub    $0x1,%ebp
+  802584:	73 9a                	jae    802520 <__divdi3+0x70>
+  802586:	8b 6c 24 14          	mov    0x14(%esp),%ebp
+  80258a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80258e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802592:	85 ed                	test   %ebp,%ebp
+  802594:	0f 84 47 ff ff ff    	je     8024e1 <__divdi3+0x31>
+  80259a:	f7 d8                	neg    %eax
+  80259c:	83 d2 00             	adc    $0x0,%edx
+  80259f:	83 c4 1c             	add    $0x1c,%esp
+  8025a2:	5b                   	pop    %ebx
+  8025a3:	f7 da                	neg    %edx
+  8025a5:	5e                   	pop    %esi
+  8025a6:	5f                   	pop    %edi
+  8025a7:	5d                   	pop    %ebp
+  8025a8:	c3                   	ret
+  8025a9:	f7 de                	neg    %esi
+  8025ab:	83 d7 00             	adc    $0x0,%edi
+  8025ae:	f7 df                	neg    %edi
+  8025b0:	85 db                	test   %ebx,%ebx
+  8025b2:	78 23                	js     8025d7 <__divdi3+0x127>
+  8025b4:	89 dd                	mov    %ebx,%ebp
+  8025b6:	89 c8                	mov    %ecx,%eax
+  8025b8:	89 da                	mov    %ebx,%edx
+  8025ba:	09 cd                	or     %ecx,%ebp
+  8025bc:	0f 84 1f ff ff ff    	je     8024e1 <__divdi3+0x31>
+  8025c2:	89 0c 24             	mov    %ecx,(%esp)
+  8025c5:	89 f0                	mov    %esi,%eax
+  8025c7:	89 fa                	mov    %edi,%edx
+  8025c9:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8025ce:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8025d2:	e9 29 ff ff ff       	jmp    802500 <__divdi3+0x50>
+  8025d7:	31 ed                	xor    %ebp,%ebp
+  8025d9:	e9 10 ff ff ff       	jmp    8024ee <__divdi3+0x3e>
+  8025de:	89 0c 24             	mov    %ecx,(%esp)
+  8025e1:	89 f0                	mov    %esi,%eax
+  8025e3:	89 fa                	mov    %edi,%edx
+  8025e5:	31 ed                	xor    %ebp,%ebp
+  8025e7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  8025eb:	e9 10 ff ff ff       	jmp    802500 <__divdi3+0x50>
+
+008025f0 <__moddi3>:
+  8025f0:	55                   	push   %ebp
+  8025f1:	57                   	push   %edi
+  8025f2:	56                   	push   %esi
+  8025f3:	53                   	push   %ebx
+  8025f4:	83 ec 14             	sub    $0x14,%esp
+  8025f7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025fb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025ff:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802603:	8b 74 24 34          	mov    0x34(%esp),%esi
+  802607:	85 d2                	test   %edx,%edx
+  802609:	0f 88 9b 00 00 00    	js     8026aa <__moddi3+0xba>
+  80260f:	89 f7                	mov    %esi,%edi
+  802611:	31 ed                	xor    %ebp,%ebp
+  802613:	09 cf                	or     %ecx,%edi
+  802615:	0f 84 83 00 00 00    	je     80269e <__moddi3+0xae>
+  80261b:	89 cb                	mov    %ecx,%ebx
+  80261d:	89 f7                	mov    %esi,%edi
+  80261f:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+  802623:	f7 db                	neg    %ebx
+  802625:	83 d7 00             	adc    $0x0,%edi
+  802628:	f7 df                	neg    %edi
+  80262a:	0f 49 f7             	cmovns %edi,%esi
+  80262d:	0f 49 cb             	cmovns %ebx,%ecx
+  802630:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802634:	89 0c 24             	mov    %ecx,(%esp)
+  802637:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80263c:	89 cd                	mov    %ecx,%ebp
+  80263e:	66 90                	xchg   %ax,%ax
+  802640:	89 e9                	mov    %ebp,%ecx
+  802642:	89 c3                	mov    %eax,%ebx
+  802644:	89 d6                	mov    %edx,%esi
+  802646:	31 ff                	xor    %edi,%edi
+  802648:	d3 ee                	shr    %cl,%esi
+  80264a:	0f ad d3             	shrd   %cl,%edx,%ebx
+  80264d:	f6 c1 20             	test   $0x20,%cl
+  802650:	0f 45 de             	cmovne %esi,%ebx
+  802653:	0f 45 f7             	cmovne %edi,%esi
+  802656:	8b 3c 24             	mov    (%esp),%edi
+  802659:	39 fb                	cmp    %edi,%ebx
+  80265b:	89 f7                	mov    %esi,%edi
+  80265d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802661:	8b 1c 24             	mov    (%esp),%ebx
+  802664:	19 f7                	sbb    %esi,%edi
+  802666:	72 1a                	jb     802682 <__moddi3+0x92>
+  802668:	89 e9                	mov    %ebp,%ecx
+  80266a:	89 f7                	mov    %esi,%edi
+  80266c:	89 de                	mov    %ebx,%esi
+  80266e:	0f a5 df             	shld   %cl,%ebx,%edi
+  802671:	d3 e6                	shl    %cl,%esi
+  802673:	31 db                	xor    %ebx,%ebx
+  802675:	f6 c1 20             	test   $0x20,%cl
+  802678:	0f 45 fe             	cmovne %esi,%edi
+  80267b:	0f 45 f3             	cmovne %ebx,%esi
+  80267e:	29 f0                	sub    %esi,%eax
+  802680:	19 fa                	sbb    %edi,%edx
+  802682:	83 ed 01             	sub    $0x1,%ebp
+  802685:	73 b9                	jae    802640 <__moddi3+0x50>
+  802687:	8b 6c 24 0c          	mov    0xc(%esp),%ebp
+  80268b:	85 ed                	test   %ebp,%ebp
+  80268d:	74 07                	je     802696 <__moddi3+0xa6>
+  80268f:	f7 d8                	neg    %eax
+  802691:	83 d2 00             	adc    $0x0,%edx
+  802694:	f7 da                	neg    %edx
+  802696:	83 c4 14             	add    $0x14,%esp
+  802699:	5b                   	pop    %ebx
+  80269a:	5e                   	pop    %esi
+  80269b:	5f                   	pop    %edi
+  80269c:	5d                   	pop    %ebp
+  80269d:	c3                   	ret
+  80269e:	83 c4 14             	add    $0x14,%esp
+  8026a1:	31 c0                	xor    %eax,%eax
+  8026a3:	31 d2                	xor    %edx,%edx
+  8026a5:	5b                   	pop    %ebx
+  8026a6:	5e                   	pop    %esi
+  8026a7:	5f                   	pop    %edi
+  8026a8:	5d                   	pop    %ebp
+  8026a9:	c3                   	ret
+  8026aa:	89 f7                	mov    %esi,%edi
+  8026ac:	09 cf                	or     %ecx,%edi
+  8026ae:	74 11                	je     8026c1 <__moddi3+0xd1>
+  8026b0:	f7 d8                	neg    %eax
+  8026b2:	bd 01 00 00 00       	mov    $0x1,%ebp
+  8026b7:	83 d2 00             	adc    $0x0,%edx
+  8026ba:	f7 da                	neg    %edx
+  8026bc:	e9 5a ff ff ff       	jmp    80261b <__moddi3+0x2b>
+  8026c1:	31 c0                	xor    %eax,%eax
+  8026c3:	31 d2                	xor    %edx,%edx
+  8026c5:	eb c8                	jmp    80268f <__moddi3+0x9f>
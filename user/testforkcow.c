@@ -0,0 +1,54 @@
+// test that a child of sys_fork_cow sees its parent's bss and
+// demand-zero region pages, touched or not, and that neither sees
+// the other's writes
+
+#include <inc/lib.h>
+
+#define REGION	((char *) 0xA0000000)
+#define WORDS	(PGSIZE / sizeof(uint32_t))
+
+// Big enough that most of it is past the pages loaded from the file.
+uint32_t bigbss[16 * WORDS];
+
+void
+umain(int argc, char **argv)
+{
+	envid_t child;
+	int r;
+
+	if ((r = sys_region_reserve(0, REGION, 3 * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+		panic("sys_region_reserve: %e", r);
+	bigbss[0] = 1;
+	bigbss[5 * WORDS] = 2;
+	REGION[0] = 'p';
+	if (REGION[PGSIZE] != 0)
+		panic("region page isn't cleared");
+	// bigbss[10 * WORDS] and REGION[2 * PGSIZE] stay untouched.
+
+	if ((r = sys_env_set_kernel_cow(0, 1)) < 0)
+		panic("sys_env_set_kernel_cow: %e", r);
+	if ((child = sys_fork_cow()) < 0)
+		panic("sys_fork_cow: %e", child);
+
+	if (child == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		if (bigbss[0] != 1 || bigbss[5 * WORDS] != 2 || bigbss[10 * WORDS] != 0)
+			panic("child: wrong bss");
+		if (REGION[0] != 'p' || REGION[PGSIZE] != 0 || REGION[2 * PGSIZE] != 0)
+			panic("child: wrong region");
+		bigbss[0] = 10;
+		bigbss[10 * WORDS] = 11;
+		REGION[0] = 'c';
+		REGION[PGSIZE] = 'c';
+		REGION[2 * PGSIZE] = 'c';
+		cprintf("child sees the parent's bss and region\n");
+		exit();
+	}
+
+	wait(child);
+	if (bigbss[0] != 1 || bigbss[5 * WORDS] != 2 || bigbss[10 * WORDS] != 0)
+		panic("parent: bss changed");
+	if (REGION[0] != 'p' || REGION[PGSIZE] != 0 || REGION[2 * PGSIZE] != 0)
+		panic("parent: region changed");
+	cprintf("parent keeps its own bss and region\n");
+}
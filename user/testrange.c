@@ -0,0 +1,69 @@
+// test the range variants of the page system calls, including where
+// they stop part way, and that a large page is unmapped as a unit
+
+#include <inc/lib.h>
+
+#define PERM	(PTE_P|PTE_U|PTE_W)
+#define A	((char *) 0xA0000000)
+#define B	((char *) 0xA0100000)
+#define C	((char *) 0xA0200000)
+#define L	((char *) 0xA0400000)	// 4MB-aligned
+
+static bool
+mapped(char *va)
+{
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+}
+
+void
+umain(int argc, char **argv)
+{
+	int i, r;
+
+	if ((r = sys_page_alloc_range(0, A, 8, PERM)) != 8)
+		panic("sys_page_alloc_range returned %d", r);
+	for (i = 0; i < 8; i++)
+		A[i * PGSIZE] = 'a' + i;
+	if ((r = sys_page_map_range(0, A, 0, B, 8, PERM)) != 8)
+		panic("sys_page_map_range returned %d", r);
+	for (i = 0; i < 8; i++)
+		if (B[i * PGSIZE] != 'a' + i)
+			panic("B page %d doesn't map A page %d", i, i);
+
+	// A partial success returns the number of pages done; a failure
+	// on the first page returns the error.
+	if ((r = sys_page_unmap(0, A + 3 * PGSIZE)) < 0)
+		panic("sys_page_unmap: %e", r);
+	if ((r = sys_page_map_range(0, A, 0, C, 8, PERM)) != 3)
+		panic("sys_page_map_range past a hole returned %d", r);
+	if (!mapped(C + 2 * PGSIZE) || mapped(C + 3 * PGSIZE))
+		panic("sys_page_map_range mapped the wrong pages");
+	if ((r = sys_page_map_range(0, A + 3 * PGSIZE, 0, C, 1, PERM)) != -E_INVAL)
+		panic("sys_page_map_range from a hole returned %d", r);
+	cprintf("sys_page_map_range stops at the first unmapped page\n");
+
+	if ((r = sys_page_alloc_large(0, L, PERM)) < 0)
+		panic("sys_page_alloc_large: %e", r);
+	if (!(uvpd[PDX(L)] & PTE_PS))
+		panic("sys_page_alloc_large didn't map a large page");
+	L[0] = 1;
+	L[PTSIZE - 1] = 2;
+	if ((r = sys_page_alloc_range(0, L - 2 * PGSIZE, 4, PERM)) != 2)
+		panic("sys_page_alloc_range into a large page returned %d", r);
+	if (L[0] != 1 || L[PTSIZE - 1] != 2)
+		panic("sys_page_alloc_range changed the large page");
+	cprintf("sys_page_alloc_range stops at the first page it can't map\n");
+
+	if ((r = sys_page_unmap(0, L + 5 * PGSIZE)) < 0)
+		panic("sys_page_unmap: %e", r);
+	if (uvpd[PDX(L)] & PTE_P)
+		panic("unmapping one page left the rest of the large page");
+	cprintf("a large page is unmapped as a unit\n");
+
+	if ((r = sys_page_unmap_range(0, A, 8)) != 8)
+		panic("sys_page_unmap_range returned %d", r);
+	for (i = 0; i < 8; i++)
+		if (mapped(A + i * PGSIZE))
+			panic("sys_page_unmap_range left page %d", i);
+	cprintf("sys_page_unmap_range unmaps every page\n");
+}
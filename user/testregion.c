@@ -0,0 +1,63 @@
+// test demand-zero regions from sys_region_reserve: pages nobody has
+// touched yet, read, written, passed to sys_cputs and to sys_page_map
+
+#include <inc/lib.h>
+
+#define PERM	(PTE_P|PTE_U|PTE_W)
+#define R	((char *) 0xA0000000)
+#define R2	((char *) 0xA0100000)
+#define T	((char *) UTEMP)
+
+static bool
+mapped(char *va)
+{
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+}
+
+void
+umain(int argc, char **argv)
+{
+	int r;
+
+	if ((r = sys_region_reserve(0, R, 8 * PGSIZE, PERM)) < 0)
+		panic("sys_region_reserve: %e", r);
+	if ((r = sys_region_reserve(0, R + 4 * PGSIZE, 8 * PGSIZE, PERM)) != -E_INVAL)
+		panic("overlapping sys_region_reserve returned %d", r);
+	if ((r = sys_region_reserve(0, R2, PGSIZE, PERM|PTE_SHARE)) != -E_INVAL)
+		panic("PTE_SHARE sys_region_reserve returned %d", r);
+	if ((r = sys_region_reserve(0, R2, PGSIZE, PTE_U|PTE_W)) != -E_INVAL)
+		panic("sys_region_reserve without PTE_P returned %d", r);
+
+	if (mapped(R))
+		panic("region page mapped before it was touched");
+	if (R[0] != 0)
+		panic("region page isn't cleared");
+	if (!mapped(R) || (uvpt[PGNUM(R)] & PTE_W))
+		panic("read fault didn't map a read-only page");
+	R[0] = 'x';
+	if (R[0] != 'x' || !(uvpt[PGNUM(R)] & PTE_W))
+		panic("write after a read fault didn't stick");
+	R[PGSIZE] = 'y';
+	if (R[PGSIZE] != 'y')
+		panic("write to an untouched page didn't stick");
+	cprintf("reads and writes of untouched region pages work\n");
+
+	sys_cputs(R + 2 * PGSIZE, 16);
+	if (!mapped(R + 2 * PGSIZE))
+		panic("sys_cputs didn't fault in the region page");
+	cprintf("sys_cputs faults in an untouched region page\n");
+
+	if ((r = sys_page_map(0, R + 3 * PGSIZE, 0, T, PERM)) < 0)
+		panic("sys_page_map of an untouched page: %e", r);
+	T[0] = 'z';
+	if (R[3 * PGSIZE] != 'z')
+		panic("sys_page_map of an untouched page didn't share it");
+	if (R[4 * PGSIZE] != 0)
+		panic("region page isn't cleared");
+	if ((r = sys_page_map(0, R + 4 * PGSIZE, 0, T + PGSIZE, PERM)) < 0)
+		panic("sys_page_map of a read-faulted page: %e", r);
+	T[PGSIZE] = 'w';
+	if (R[4 * PGSIZE] != 'w')
+		panic("sys_page_map of a read-faulted page didn't share it");
+	cprintf("sys_page_map maps untouched and read-faulted region pages\n");
+}